@@ -1,6 +1,31 @@
 
 #include "fs.h"
 
+// The block cache holds at most bc_cap blocks besides the superblock
+// and the bitmap, which stay mapped for good.  The blocks it holds
+// sit in a ring swept by a CLOCK hand: a block whose PTE_A bit is set
+// has its bit cleared and is passed over once, the first one found
+// with the bit clear is evicted.  An entry whose block was unmapped
+// behind the ring's back is simply reused.
+static uint32_t *bc_ring;
+static uint32_t bc_cap, bc_count, bc_hand;
+
+// Blocks file reads and writes found cached, blocks read from disk,
+// and blocks evicted.
+static uint64_t bc_hits, bc_misses, bc_evictions;
+
+// Dirty blocks found by the last bc_collect_dirty, in ascending
+// order, and for how many write-back ticks each has been dirty.  The
+// previous list is kept in the other buffer to carry the ages over.
+static uint32_t *bc_dirty, *bc_dirty_buf[2];
+static uint8_t *bc_dirty_age, *bc_dirty_age_buf[2];
+static uint32_t bc_ndirty, bc_dirty_size;
+static int bc_dirty_cur;
+
+// Read-ahead for faults: a fault on bc_ra_next, the block after the
+// ones the last fault read, doubles bc_ra_window up to BC_MAXRUN.
+static uint32_t bc_ra_next, bc_ra_window;
+
 // Return the virtual address of this disk block.
 void *
 diskaddr(uint32_t blockno) {
@@ -26,8 +51,91 @@ va_is_dirty(void *va) {
   return (uvpt[PGNUM(va)] & PTE_D) != 0;
 }
 
+// Blocks below this are never evicted: the superblock and the bitmap
+// are used by every operation, bc_pgfault included.
+static uint32_t
+bc_npinned(void) {
+  return super ? 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE : 2;
+}
+
+static bool
+bc_pinned(uint32_t blockno) {
+  return blockno < bc_npinned();
+}
+
+// Advance the CLOCK hand to a block that has not been used since the
+// hand last passed it, write it out if dirty and unmap it.  A dirty
+// block may point at blocks just allocated, so the superblock and the
+// bitmap are written out before it, as fs_writeback does.  Blocks in
+// [keep, keep + nkeep) are being brought in and are passed over.
+// Returns the ring slot that is now free.
+static uint32_t
+bc_evict(uint32_t keep, uint32_t nkeep) {
+  uint32_t slot, blockno, b;
+  void *addr;
+  int r;
+
+  while (1) {
+    slot    = bc_hand;
+    bc_hand = (bc_hand + 1) % bc_count;
+    blockno = bc_ring[slot];
+    addr    = diskaddr(blockno);
+
+    if (!va_is_mapped(addr))
+      return slot;
+    if (blockno - keep < nkeep)
+      continue;
+    if (uvpt[PGNUM(addr)] & PTE_A) {
+      if ((r = sys_page_clear_bits(addr, 1, PTE_A)) < 0)
+        panic("bc_evict: sys_page_clear_bits: %i", r);
+      continue;
+    }
+
+    if (va_is_dirty(addr)) {
+      for (b = 1; b < bc_npinned(); b++)
+        flush_block(diskaddr(b));
+    }
+    flush_block(addr);
+    if ((r = sys_page_unmap(0, addr)) < 0)
+      panic("bc_evict: sys_page_unmap: %i", r);
+    bc_evictions++;
+    return slot;
+  }
+}
+
+// Enter blockno, about to be read in, into the ring, evicting another
+// block if the cache is full.  [keep, keep + nkeep) as for bc_evict.
+static void
+bc_insert(uint32_t blockno, uint32_t keep, uint32_t nkeep) {
+  bc_misses++;
+  if (bc_pinned(blockno))
+    return;
+  if (bc_count < bc_cap)
+    bc_ring[bc_count++] = blockno;
+  else
+    bc_ring[bc_evict(keep, nkeep)] = blockno;
+}
+
+// How many blocks to read for a fault on blockno: the faulting one,
+// and as many of the allocated blocks right after it that are not
+// cached yet as the read-ahead window allows.
+static uint32_t
+bc_readahead(uint32_t blockno) {
+  uint32_t n;
+
+  bc_ra_window = blockno == bc_ra_next ? MIN(2 * bc_ra_window, BC_MAXRUN) : 1;
+  n            = 1;
+  if (bitmap && !bc_pinned(blockno)) {
+    while (n < bc_ra_window && blockno + n < super->s_nblocks &&
+           !block_is_free(blockno + n) && !va_is_mapped(diskaddr(blockno + n)))
+      n++;
+  }
+  bc_ra_next = blockno + n;
+  return n;
+}
+
 // Fault any disk block that is read in to memory by
-// loading it from disk.
+// loading it from disk, along with the blocks read-ahead picks.
 static void
 bc_pgfault(struct UTrapframe *utf) {
   void *addr       = (void *)utf->utf_fault_va;
@@ -42,26 +150,7 @@ bc_pgfault(struct UTrapframe *utf) {
   if (super && blockno >= super->s_nblocks)
     panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
 
-  // Allocate a page in the disk map region, read the contents
-  // of the block from the disk into that page.
-  // Hint: first round addr to page boundary. fs/ide.c has code to read
-  // the disk.
-  //
-  // LAB 10: Your code here.
-  int r;
-  addr = ROUNDDOWN(addr, PGSIZE);
-  if ((r = sys_page_alloc(0, addr, PTE_W)) < 0) {
-    panic("bc_pgfault: sys_page_alloc: %i", r);
-  }
-  if ((r = ide_read(blockno * BLKSECTS, addr, BLKSECTS)) < 0) {
-    panic("bc_pgfault: ide_read: %i", r);
-  }
-
-  // Clear the dirty bit for the disk block page since we just read the
-  // block from disk
-  if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
-    panic("in bc_pgfault, sys_page_map: %i", r);
-  }
+  bc_fetch(blockno, bc_readahead(blockno));
 
   // Check that the block we read was allocated.
   // If we are reading bitmap itself, we should read it before accessing. Or we would have recursive pgfault.
@@ -71,11 +160,10 @@ bc_pgfault(struct UTrapframe *utf) {
 }
 
 // Flush the contents of the block containing VA out to disk if
-// necessary, then clear the PTE_D bit using sys_page_map.
+// necessary, then clear the PTE_D bit using sys_page_clear_bits.
 // If the block is not in the block cache or is not dirty, does
 // nothing.
-// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
-// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Use va_is_mapped, va_is_dirty, and disk_write.
 // Hint: Don't forget to round addr down.
 void
 flush_block(void *addr) {
@@ -94,12 +182,231 @@ flush_block(void *addr) {
   }
 
   int r;
-  if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0) {
-    panic("flush_block: ide_write: %i", r);
+  if ((r = disk_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0) {
+    panic("flush_block: disk_write: %i", r);
+  }
+  if ((r = sys_page_clear_bits(addr, 1, PTE_D)) < 0) {
+    panic("flush_block: sys_page_clear_bits: %i", r);
+  }
+}
+
+// Bring blocks [blockno, blockno + nblocks) into the block cache.
+// Each run of blocks that are not cached yet is mapped with one
+// system call and read with a single multi-sector disk transfer
+// instead of one page fault per block.  Runs close together are read
+// in one batch, none of which may be evicted until it is in.  With a
+// cache smaller than nblocks, the first blocks may be evicted again
+// by the time the last ones are in; touching them just faults them
+// back in.
+void
+bc_fetch(uint32_t blockno, uint32_t nblocks) {
+  uint32_t i, start, batch = 0;
+  bool reading = 0;
+  void *addr;
+  int r;
+
+  for (i = 0; i < nblocks;) {
+    if (va_is_mapped(diskaddr(blockno + i))) {
+      bc_hits++;
+      i++;
+      continue;
+    }
+
+    // Keep the batch within BC_MINCAP blocks, so that the blocks
+    // kept from eviction never fill the cache.
+    if (!reading || i - batch >= BC_MAXRUN) {
+      if (reading && (r = disk_wait()) < 0)
+        panic("bc_fetch: disk_wait: %i", r);
+      batch = i;
+    }
+    for (start = i; i < nblocks && i - start < BC_MAXRUN &&
+                    !va_is_mapped(diskaddr(blockno + i));
+         i++)
+      bc_insert(blockno + i, blockno + batch, start + BC_MAXRUN - batch);
+
+    addr = diskaddr(blockno + start);
+    if ((r = sys_page_alloc_range(0, addr, i - start, PTE_P | PTE_U | PTE_W)) < 0)
+      panic("bc_fetch: sys_page_alloc_range: %i", r);
+    if ((r = disk_submit((blockno + start) * BLKSECTS, addr, (i - start) * BLKSECTS, 0)) < 0)
+      panic("bc_fetch: disk_submit: %i", r);
+    reading = 1;
+
+    // Clear the bits the read left behind: the blocks are clean, and
+    // blocks read ahead that are never used should be the first to go.
+    if ((r = sys_page_clear_bits(addr, i - start, PTE_A | PTE_D)) < 0)
+      panic("bc_fetch: sys_page_clear_bits: %i", r);
+  }
+  if (reading && (r = disk_wait()) < 0)
+    panic("bc_fetch: disk_wait: %i", r);
+}
+
+static void
+sift_down(uint32_t *v, uint32_t i, uint32_t n) {
+  uint32_t child, t;
+
+  while ((child = 2 * i + 1) < n) {
+    if (child + 1 < n && v[child + 1] > v[child])
+      child++;
+    if (v[i] >= v[child])
+      return;
+    t        = v[i];
+    v[i]     = v[child];
+    v[child] = t;
+    i        = child;
+  }
+}
+
+// Heapsort n block numbers into ascending order.
+static void
+sort_blocks(uint32_t *v, uint32_t n) {
+  uint32_t i, t;
+
+  for (i = n / 2; i-- > 0;)
+    sift_down(v, i, n);
+  while (n > 1) {
+    t    = v[0];
+    v[0] = v[--n];
+    v[n] = t;
+    sift_down(v, 0, n);
+  }
+}
+
+// Find the dirty blocks, whose PTE_D bit is set, by looking only at
+// the blocks in the cache, and list them in ascending order for
+// bc_flush_dirty.  The cost grows with the size of the cache, not
+// of the disk.  Returns the number of dirty blocks.
+uint32_t
+bc_collect_dirty(void) {
+  uint32_t npinned = bc_npinned(), n = npinned + bc_count, i, j, k;
+  uint32_t *list, *old, nold = bc_ndirty;
+  uint8_t *age, *old_age;
+  int b;
+
+  if (n > bc_dirty_size) {
+    for (b = 0; b < 2; b++) {
+      if (!(list = realloc(bc_dirty_buf[b], n * sizeof(*list))) ||
+          !(age = realloc(bc_dirty_age_buf[b], n * sizeof(*age))))
+        panic("bc_collect_dirty: out of memory");
+      bc_dirty_buf[b]     = list;
+      bc_dirty_age_buf[b] = age;
+    }
+    bc_dirty_size = n;
+  }
+  old          = bc_dirty_buf[bc_dirty_cur];
+  old_age      = bc_dirty_age_buf[bc_dirty_cur];
+  bc_dirty_cur = !bc_dirty_cur;
+  bc_dirty     = list = bc_dirty_buf[bc_dirty_cur];
+  bc_dirty_age = age = bc_dirty_age_buf[bc_dirty_cur];
+
+  for (i = 1, k = 0; i < n; i++) {
+    void *addr = diskaddr(i < npinned ? i : bc_ring[i - npinned]);
+    if (va_is_mapped(addr) && va_is_dirty(addr))
+      list[k++] = i < npinned ? i : bc_ring[i - npinned];
+  }
+
+  // A block unmapped behind the ring's back and read in again has
+  // two ring entries.
+  sort_blocks(list, k);
+  for (i = j = bc_ndirty = 0; i < k; i++) {
+    if (bc_ndirty && list[i] == list[bc_ndirty - 1])
+      continue;
+    for (; j < nold && old[j] < list[i]; j++)
+      ;
+    age[bc_ndirty]    = j < nold && old[j] == list[i] ? old_age[j] : 0;
+    list[bc_ndirty++] = list[i];
+  }
+  return bc_ndirty;
+}
+
+// Collect the dirty blocks as bc_collect_dirty does, and count one
+// more write-back tick for each.
+uint32_t
+bc_age_dirty(void) {
+  uint32_t i, n = bc_collect_dirty();
+
+  for (i = 0; i < n; i++)
+    bc_dirty_age[i] += bc_dirty_age[i] < 255;
+  return n;
+}
+
+// Write out the blocks listed by the last bc_collect_dirty that lie in
+// [blockno, blockno + nblocks), are still dirty, and have been dirty
+// for at least min_age ticks, in ascending order.  Neighbouring dirty
+// blocks are written with a single multi-sector disk transfer, young
+// ones included if the run holds a block old enough.  All the runs
+// are submitted before waiting for any.
+// Returns the number of dirty blocks in the range left unwritten.
+uint32_t
+bc_flush_dirty(uint32_t blockno, uint32_t nblocks, uint32_t min_age) {
+  uint32_t lo = 0, hi = bc_ndirty, mid, i, n = 0, left = 0;
+  uint8_t oldest;
+  void *addr;
+  int r;
+
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    if (bc_dirty[mid] < blockno)
+      lo = mid + 1;
+    else
+      hi = mid;
   }
-  if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0) {
-    panic("flush_block: sys_page_map: %i", r);
+
+  for (i = lo; i < bc_ndirty && bc_dirty[i] - blockno < nblocks; i += MAX(n, 1)) {
+    // The run of consecutive blocks from bc_dirty[i] that are still dirty
+    for (n = oldest = 0; i + n < bc_ndirty && n < BC_MAXRUN &&
+                         bc_dirty[i + n] == bc_dirty[i] + n && bc_dirty[i + n] - blockno < nblocks &&
+                         va_is_mapped(diskaddr(bc_dirty[i + n])) && va_is_dirty(diskaddr(bc_dirty[i + n]));
+         n++)
+      oldest = MAX(oldest, bc_dirty_age[i + n]);
+    if (!n)
+      continue;
+    if (oldest < min_age) {
+      left += n;
+      continue;
+    }
+
+    addr = diskaddr(bc_dirty[i]);
+    if ((r = disk_submit(bc_dirty[i] * BLKSECTS, addr, n * BLKSECTS, 1)) < 0)
+      panic("bc_flush_dirty: disk_submit: %i", r);
+    if ((r = sys_page_clear_bits(addr, n, PTE_D)) < 0)
+      panic("bc_flush_dirty: sys_page_clear_bits: %i", r);
   }
+  if ((r = disk_wait()) < 0)
+    panic("bc_flush_dirty: disk_wait: %i", r);
+  return left;
+}
+
+// Let the cache hold at most nblocks blocks besides the superblock
+// and the bitmap, evicting blocks if it holds more already.
+// Returns 0 on success, -E_INVAL if nblocks is out of range, or
+// -E_NO_MEM if there is no memory for the ring.
+int
+bc_set_capacity(uint32_t nblocks) {
+  uint32_t *ring, slot;
+
+  if (nblocks < BC_MINCAP || nblocks > DISKSIZE / BLKSIZE)
+    return -E_INVAL;
+
+  while (bc_count > nblocks) {
+    slot          = bc_evict(0, 0);
+    bc_ring[slot] = bc_ring[--bc_count];
+    if (bc_hand >= bc_count)
+      bc_hand = 0;
+  }
+  if (!(ring = realloc(bc_ring, nblocks * sizeof(*ring))))
+    return -E_NO_MEM;
+  bc_ring = ring;
+  bc_cap  = nblocks;
+  return 0;
+}
+
+void
+bc_get_stats(struct Fsret_stats *st) {
+  st->ret_bc_capacity  = bc_cap;
+  st->ret_bc_cached    = bc_count;
+  st->ret_bc_hits      = bc_hits;
+  st->ret_bc_misses    = bc_misses;
+  st->ret_bc_evictions = bc_evictions;
 }
 
 // Test that the block cache works, by smashing the superblock and
@@ -134,6 +441,10 @@ check_bc(void) {
 void
 bc_init(void) {
   struct Super super;
+  int r;
+
+  if ((r = bc_set_capacity(BC_CAPACITY)) < 0)
+    panic("bc_set_capacity: %i", r);
   set_pgfault_handler(bc_pgfault);
   check_bc();
 
@@ -0,0 +1,69 @@
+// The disk the file system lives on: a virtio-blk device if there is
+// one, the IDE disk otherwise.  Transfers are submitted and may
+// complete in any order until disk_wait; virtio-blk keeps many of
+// them in flight, IDE does each one as it is submitted.
+
+#include "fs.h"
+
+static bool virtio;
+
+void
+disk_init(void) {
+  if ((virtio = virtio_blk_init()))
+    return;
+
+  // Use the second IDE disk (number 1) if available
+  ide_init();
+  if (ide_probe_disk1())
+    ide_set_disk(1);
+  else
+    ide_set_disk(0);
+}
+
+// Start reading (or writing) nsecs sectors from sector secno into
+// (or from) buf, which must stay mapped until disk_wait.
+int
+disk_submit(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  if (virtio)
+    return virtio_blk_submit(secno, buf, nsecs, write);
+  return write ? ide_write(secno, buf, nsecs) : ide_read(secno, buf, nsecs);
+}
+
+// Wait for every transfer submitted so far.
+// Returns 0, or < 0 if any of them failed.
+int
+disk_wait(void) {
+  return virtio ? virtio_blk_wait() : 0;
+}
+
+int
+disk_read(uint32_t secno, void *dst, size_t nsecs) {
+  int r;
+
+  if ((r = disk_submit(secno, dst, nsecs, 0)) < 0)
+    return r;
+  return disk_wait();
+}
+
+int
+disk_write(uint32_t secno, const void *src, size_t nsecs) {
+  int r;
+
+  if ((r = disk_submit(secno, (void *)src, nsecs, 1)) < 0)
+    return r;
+  return disk_wait();
+}
+
+// Turn IDE DMA on or off.  Returns -E_NOT_SUPP on virtio-blk.
+int
+disk_set_dma(bool on) {
+  return virtio ? -E_NOT_SUPP : ide_set_dma(on);
+}
+
+void
+disk_get_stats(struct Fsret_stats *st) {
+  if (virtio)
+    virtio_blk_get_stats(st);
+  else
+    ide_get_stats(st);
+}
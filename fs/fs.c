@@ -6,6 +6,13 @@
 struct Super *super; // superblock
 uint32_t *bitmap;    // bitmap blocks mapped in memory
 
+// Blocks freed but not yet marked free in the bitmap, laid out like
+// the bitmap.  A freed block is only marked free once every block
+// that pointed at it has been written out (see fs_writeback), so that
+// the disk never shows a block as free while a file still uses it.
+static uint32_t *freeing;
+static uint32_t nfreeing;
+
 // --------------------------------------------------------------
 // Super block
 // --------------------------------------------------------------
@@ -37,39 +44,97 @@ block_is_free(uint32_t blockno) {
   return 0;
 }
 
-// Mark a block free in the bitmap
+// Free a block.  It is marked free in the bitmap, and can be
+// allocated again, after the next write-back that leaves nothing
+// dirty.
 void
 free_block(uint32_t blockno) {
   // Blockno zero is the null pointer of block numbers.
   if (blockno == 0)
     panic("attempt to free zero block");
-  bitmap[blockno / 32] |= 1U << (blockno % 32);
+  if (block_is_free(blockno) || (freeing[blockno / 32] & (1U << (blockno % 32))))
+    return;
+  freeing[blockno / 32] |= 1U << (blockno % 32);
+  nfreeing++;
+}
+
+// Mark the blocks freed since the last call free in the bitmap.
+static void
+release_freed_blocks(void) {
+  uint32_t i;
+
+  for (i = 0; nfreeing && i < (super->s_nblocks + 31) / 32; i++) {
+    if (freeing[i]) {
+      bitmap[i] |= freeing[i];
+      nfreeing -= __builtin_popcount(freeing[i]);
+      super->s_nfree += __builtin_popcount(freeing[i]);
+      freeing[i] = 0;
+    }
+  }
 }
 
-// Search the bitmap for a free block and allocate it.  When you
-// allocate a block, immediately flush the changed bitmap block
-// to disk.
+// Where the next search for a free block without a goal starts: just
+// past the block allocated last, so that searches do not rescan the
+// full part of the disk every time.
+static uint32_t alloc_cursor;
+
+// Return the first free block in [start, end), or 0 if there is none.
+// Looks at 64 blocks at a time.
+static uint32_t
+bitmap_scan(uint32_t start, uint32_t end) {
+  const uint64_t *words = (const uint64_t *)bitmap;
+  uint64_t w;
+  uint32_t i, b;
+
+  for (i = start / 64; i * 64 < end; i++) {
+    w = words[i];
+    if (i == start / 64)
+      w &= ~0ULL << (start % 64);
+    if (w) {
+      b = i * 64 + __builtin_ctzll(w);
+      return b < end ? b : 0;
+    }
+  }
+  return 0;
+}
+
+// Allocate the first free block at or after 'goal', wrapping around
+// at the end of the disk; a goal of 0 means no preference.  Callers
+// pass the block after the one that precedes the new block in its
+// file, so that files stay contiguous on disk.
+//
+// The bitmap is not written to disk here; the write-back does that.
+// If the disk is full but blocks are waiting to be marked free, the
+// whole file system is synced to get them back.
 //
 // Return block number allocated on success,
 // -E_NO_DISK if we are out of blocks.
+int
+alloc_block_near(uint32_t goal) {
+  uint32_t b;
+
+  if (!super->s_nfree && nfreeing)
+    fs_sync();
+  if (!super->s_nfree)
+    return -E_NO_DISK;
+  if (!goal || goal >= super->s_nblocks)
+    goal = alloc_cursor;
+  if (!(b = bitmap_scan(goal, super->s_nblocks)) && !(b = bitmap_scan(0, goal)))
+    return -E_NO_DISK;
+
+  bitmap[b / 32] &= ~(1U << (b % 32));
+  super->s_nfree--;
+  alloc_cursor = b + 1;
+  return b;
+}
+
+// Allocate a free block anywhere on the disk.
 //
-// Hint: use free_block as an example for manipulating the bitmap.
+// Return block number allocated on success,
+// -E_NO_DISK if we are out of blocks.
 int
 alloc_block(void) {
-  // The bitmap consists of one or more blocks.  A single bitmap block
-  // contains the in-use bits for BLKBITSIZE blocks.  There are
-  // super->s_nblocks blocks in the disk altogether.
-
-  // LAB 10: Your code here.
-  int i;
-  for (i = 0; i < super->s_nblocks; ++i) {
-    if (block_is_free(i)) {
-      bitmap[i / 32] &= ~(1 << (i % 32));
-      flush_block(&bitmap[i / 32]);
-      return i;
-    }
-  }
-  return -E_NO_DISK;
+  return alloc_block_near(0);
 }
 
 // Validate the file system bitmap.
@@ -91,6 +156,23 @@ check_bitmap(void) {
   cprintf("bitmap is good\n");
 }
 
+// Count the free blocks, and correct the superblock's count if it is
+// off, as it is if the bitmap was written without the superblock.
+static void
+count_free_blocks(void) {
+  const uint64_t *words = (const uint64_t *)bitmap;
+  uint32_t i, nfree = 0;
+
+  for (i = 0; i < super->s_nblocks / 64; i++)
+    nfree += __builtin_popcountll(words[i]);
+  for (i *= 64; i < super->s_nblocks; i++)
+    nfree += block_is_free(i);
+  if (super->s_nfree != nfree) {
+    cprintf("superblock free count %u, bitmap has %u\n", super->s_nfree, nfree);
+    super->s_nfree = nfree;
+  }
+}
+
 // --------------------------------------------------------------
 // File system structures
 // --------------------------------------------------------------
@@ -100,11 +182,7 @@ void
 fs_init(void) {
   static_assert(sizeof(struct File) == 256, "Unsupported file size");
 
-  // Find a JOS disk.  Use the second IDE disk (number 1) if availabl
-  if (ide_probe_disk1())
-    ide_set_disk(1);
-  else
-    ide_set_disk(0);
+  disk_init();
   bc_init();
 
   // Set "super" to point to the super block.
@@ -114,6 +192,10 @@ fs_init(void) {
   // Set "bitmap" to the beginning of the first bitmap block.
   bitmap = diskaddr(2);
   check_bitmap();
+  count_free_blocks();
+
+  if (!(freeing = calloc((super->s_nblocks + 31) / 32, sizeof(*freeing))))
+    panic("fs_init: out of memory");
 }
 
 // Find the disk block number slot for the 'filebno'th block in file 'f'.
@@ -159,6 +241,310 @@ file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool all
   return 0;
 }
 
+// --------------------------------------------------------------
+// Extent trees
+// --------------------------------------------------------------
+
+// Return the index of the last of the n extents in ents that starts
+// at or before file block filebno, or -1 if there is none.
+static int
+ext_search(struct Extent *ents, int n, uint32_t filebno) {
+  int lo = 0, hi = n, mid;
+
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (ents[mid].e_fileblk <= filebno)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo - 1;
+}
+
+// Capacity of a node at 'level' of an extent tree (0 is the root).
+#define EXT_CAP(level) ((level) ? NEXTENT_NODE : NEXTENT_ROOT)
+
+// The nodes visited from the root of an extent tree down to a leaf.
+struct ExtPath {
+  int depth; // level of the leaf
+  struct {
+    struct ExtentHeader *hdr;
+    struct Extent *ents;
+    int idx; // entry followed, or at the leaf, the last extent
+             // starting at or before the block looked up (maybe -1)
+  } p[EXT_MAXDEPTH + 1];
+};
+
+// Walk f's extent tree down to the leaf that holds the extents around
+// file block filebno.
+static void
+ext_walk(struct File *f, uint32_t filebno, struct ExtPath *path) {
+  struct ExtentNode *node;
+  int l;
+
+  path->depth     = f->f_exthdr.eh_depth;
+  path->p[0].hdr  = &f->f_exthdr;
+  path->p[0].ents = f->f_extent;
+  for (l = 0;; l++) {
+    path->p[l].idx = ext_search(path->p[l].ents, path->p[l].hdr->eh_nent, filebno);
+    if (l == path->depth)
+      break;
+    // The first child also takes the blocks before its first extent.
+    path->p[l].idx      = MAX(path->p[l].idx, 0);
+    node                = diskaddr(path->p[l].ents[path->p[l].idx].e_diskblk);
+    path->p[l + 1].hdr  = &node->en_hdr;
+    path->p[l + 1].ents = node->en_extent;
+  }
+}
+
+// Look up file block filebno of extent file f.  Set *pdiskbno to its
+// disk block, or 0 if it is a hole, and *pcount to the number of
+// blocks from filebno to the end of its extent or of the hole.
+static void
+ext_map(struct File *f, uint32_t filebno, uint32_t *pdiskbno, uint32_t *pcount) {
+  struct ExtPath path;
+  struct Extent *e;
+  uint32_t next;
+  int l;
+
+  ext_walk(f, filebno, &path);
+  l = path.depth;
+  e = &path.p[l].ents[path.p[l].idx];
+  if (path.p[l].idx >= 0 && filebno - e->e_fileblk < e->e_len) {
+    *pdiskbno = e->e_diskblk + (filebno - e->e_fileblk);
+    *pcount   = e->e_len - (filebno - e->e_fileblk);
+    return;
+  }
+
+  // The hole ends where the next entry at the lowest level that has
+  // one begins.
+  next = MAXEXTFILESIZE / BLKSIZE;
+  for (; l >= 0; l--) {
+    if (path.p[l].idx + 1 < path.p[l].hdr->eh_nent) {
+      next = path.p[l].ents[path.p[l].idx + 1].e_fileblk;
+      break;
+    }
+  }
+  *pdiskbno = 0;
+  *pcount   = next - filebno;
+}
+
+// Make room for one more entry in the node at level l of 'path',
+// which is about to get an entry for file block filebno.  A full root
+// moves its entries into a new node below it, deepening the tree; any
+// other node is split in two, or, if its parent is full, the parent
+// is made room in first and the caller has to walk the tree again.
+// Returns 0 on success, -E_NO_DISK if the disk is full or the tree
+// is as deep as it may get.
+static int
+ext_split(struct File *f, struct ExtPath *path, int l, uint32_t filebno) {
+  struct ExtentHeader *hdr = path->p[l].hdr, *phdr;
+  struct Extent *ents = path->p[l].ents, *pents;
+  struct ExtentNode *node;
+  int r, at, i;
+
+  if (l == 0) {
+    if (f->f_exthdr.eh_depth == EXT_MAXDEPTH)
+      return -E_NO_DISK;
+    if ((r = alloc_block()) < 0)
+      return r;
+    node = diskaddr(r);
+    memset(node, 0, BLKSIZE);
+    node->en_hdr = f->f_exthdr;
+    memmove(node->en_extent, f->f_extent, sizeof(f->f_extent));
+    f->f_exthdr.eh_nent = 1;
+    f->f_exthdr.eh_depth++;
+    f->f_extent[0] = (struct Extent){0, r, 0};
+    return 0;
+  }
+
+  phdr  = path->p[l - 1].hdr;
+  pents = path->p[l - 1].ents;
+  i     = path->p[l - 1].idx;
+  if (phdr->eh_nent == EXT_CAP(l - 1))
+    return ext_split(f, path, l - 1, filebno);
+  if ((r = alloc_block()) < 0)
+    return r;
+  node = diskaddr(r);
+  memset(node, 0, BLKSIZE);
+
+  // Appending splits off only the last entry, so that the nodes of a
+  // file written front to back end up full.
+  at = filebno > ents[hdr->eh_nent - 1].e_fileblk ? hdr->eh_nent - 1 : hdr->eh_nent / 2;
+  node->en_hdr.eh_depth = hdr->eh_depth;
+  node->en_hdr.eh_nent  = hdr->eh_nent - at;
+  memmove(node->en_extent, ents + at, node->en_hdr.eh_nent * sizeof(struct Extent));
+  hdr->eh_nent = at;
+
+  memmove(&pents[i + 2], &pents[i + 1], (phdr->eh_nent - i - 1) * sizeof(struct Extent));
+  pents[i + 1] = (struct Extent){node->en_extent[0].e_fileblk, r, 0};
+  phdr->eh_nent++;
+  return 0;
+}
+
+// Map file block filebno of extent file f, which must be a hole, to
+// disk block diskbno.  Grows a neighbouring extent if diskbno is next
+// to it on disk.  Returns 0 on success, < 0 on error (see ext_split).
+static int
+ext_insert(struct File *f, uint32_t filebno, uint32_t diskbno) {
+  struct ExtPath path;
+  struct ExtentHeader *hdr;
+  struct Extent *ents, *e;
+  int i, r;
+
+  while (1) {
+    ext_walk(f, filebno, &path);
+    hdr  = path.p[path.depth].hdr;
+    ents = path.p[path.depth].ents;
+    i    = path.p[path.depth].idx;
+
+    e = &ents[i];
+    if (i >= 0 && e->e_fileblk + e->e_len == filebno && e->e_diskblk + e->e_len == diskbno) {
+      // Append to the extent before, and merge with the one after if
+      // the block closes the gap between them.
+      e->e_len++;
+      if (i + 1 < hdr->eh_nent && e[1].e_fileblk == filebno + 1 &&
+          e[1].e_diskblk == diskbno + 1) {
+        e->e_len += e[1].e_len;
+        memmove(&e[1], &e[2], (hdr->eh_nent - i - 2) * sizeof(struct Extent));
+        hdr->eh_nent--;
+      }
+      return 0;
+    }
+
+    e = &ents[i + 1];
+    if (i + 1 < hdr->eh_nent && e->e_fileblk == filebno + 1 && e->e_diskblk == diskbno + 1) {
+      // Prepend to the extent after.
+      e->e_fileblk--;
+      e->e_diskblk--;
+      e->e_len++;
+      return 0;
+    }
+
+    if (hdr->eh_nent < EXT_CAP(path.depth)) {
+      memmove(&e[1], e, (hdr->eh_nent - i - 1) * sizeof(struct Extent));
+      *e = (struct Extent){filebno, diskbno, 1};
+      hdr->eh_nent++;
+      return 0;
+    }
+
+    if ((r = ext_split(f, &path, path.depth, filebno)) < 0)
+      return r;
+  }
+}
+
+// Free the blocks from file block nblocks on in the subtree rooted at
+// the node with header hdr and entries ents.  Children that become
+// empty are freed as well.
+static void
+ext_truncate_node(struct ExtentHeader *hdr, struct Extent *ents, uint32_t nblocks) {
+  struct ExtentNode *child;
+  struct Extent *e;
+
+  while (hdr->eh_nent) {
+    e = &ents[hdr->eh_nent - 1];
+    if (hdr->eh_depth == 0) {
+      for (; e->e_len && e->e_fileblk + e->e_len > nblocks; e->e_len--)
+        free_block(e->e_diskblk + e->e_len - 1);
+      if (e->e_len)
+        return;
+    } else {
+      child = diskaddr(e->e_diskblk);
+      ext_truncate_node(&child->en_hdr, child->en_extent, nblocks);
+      if (child->en_hdr.eh_nent)
+        return;
+      free_block(e->e_diskblk);
+    }
+    hdr->eh_nent--;
+  }
+}
+
+// Free the blocks of extent file f from file block nblocks on.
+static void
+ext_truncate(struct File *f, uint32_t nblocks) {
+  struct ExtentNode *child;
+  uint32_t blk;
+
+  ext_truncate_node(&f->f_exthdr, f->f_extent, nblocks);
+  if (!f->f_exthdr.eh_nent)
+    f->f_exthdr.eh_depth = 0;
+
+  // Pull a lone child up into the root while its entries fit there.
+  while (f->f_exthdr.eh_depth && f->f_exthdr.eh_nent == 1) {
+    blk   = f->f_extent[0].e_diskblk;
+    child = diskaddr(blk);
+    if (child->en_hdr.eh_nent > NEXTENT_ROOT)
+      break;
+    f->f_exthdr = child->en_hdr;
+    memmove(f->f_extent, child->en_extent, child->en_hdr.eh_nent * sizeof(struct Extent));
+    free_block(blk);
+  }
+}
+
+// Flush the interior and leaf blocks of the extent tree below the
+// node with header hdr and entries ents.
+static void
+ext_flush_node(struct ExtentHeader *hdr, struct Extent *ents) {
+  struct ExtentNode *child;
+  int i;
+
+  for (i = 0; hdr->eh_depth && i < hdr->eh_nent; i++) {
+    child = diskaddr(ents[i].e_diskblk);
+    ext_flush_node(&child->en_hdr, child->en_extent);
+    flush_block(child);
+  }
+}
+
+// --------------------------------------------------------------
+// File block mapping
+// --------------------------------------------------------------
+
+// Look up the filebno'th block of file 'f' without allocating.
+// Set *pdiskbno to its disk block number, or to 0 if the block is not
+// allocated, and *pcount to the number of blocks, at least 1 and at
+// most max, from filebno on that lie at consecutive disk blocks (or
+// that are all unallocated).  A run can then be read or written with
+// a single disk operation.
+//
+// Returns 0 on success, -E_INVAL if filebno is out of range.
+int
+file_map_run(struct File *f, uint32_t filebno, uint32_t *pdiskbno, uint32_t *pcount, uint32_t max) {
+  uint32_t *ptr, diskbno, n;
+  int r;
+
+  if (f->f_flags & FILE_EXTENTS) {
+    if (filebno >= MAXEXTFILESIZE / BLKSIZE)
+      return -E_INVAL;
+    ext_map(f, filebno, pdiskbno, pcount);
+    *pcount = MAX(MIN(*pcount, max), 1);
+    return 0;
+  }
+
+  if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0 && r != -E_NOT_FOUND)
+    return r;
+  *pdiskbno = r < 0 ? 0 : *ptr;
+  for (n = 1; n < max; n++) {
+    if ((r = file_block_walk(f, filebno + n, &ptr, 0)) == -E_INVAL)
+      break;
+    diskbno = r < 0 ? 0 : *ptr;
+    if (*pdiskbno ? diskbno != *pdiskbno + n : diskbno != 0)
+      break;
+  }
+  *pcount = n;
+  return 0;
+}
+
+// Return the disk block that a new filebno'th block of file 'f'
+// should preferably go to: the one after the block before it.
+static uint32_t
+file_block_goal(struct File *f, uint32_t filebno) {
+  uint32_t diskbno, n;
+
+  if (filebno == 0 || file_map_run(f, filebno - 1, &diskbno, &n, 1) < 0 || !diskbno)
+    return 0;
+  return diskbno + 1;
+}
+
 // Set *blk to the address in memory where the filebno'th
 // block of file 'f' would be mapped.
 //
@@ -171,12 +557,29 @@ int
 file_get_block(struct File *f, uint32_t filebno, char **blk) {
   // LAB 10: Your code here.
   int r, newb;
-  uint32_t *pdiskbno;
+  uint32_t *pdiskbno, diskbno, n;
+
+  if (f->f_flags & FILE_EXTENTS) {
+    if ((r = file_map_run(f, filebno, &diskbno, &n, 1)) < 0)
+      return r;
+    if (!diskbno) {
+      if ((newb = alloc_block_near(file_block_goal(f, filebno))) < 0)
+        return -E_NO_DISK;
+      if ((r = ext_insert(f, filebno, newb)) < 0) {
+        free_block(newb);
+        return r;
+      }
+      diskbno = newb;
+    }
+    *blk = (char *)diskaddr(diskbno);
+    return 0;
+  }
+
   if ((r = file_block_walk(f, filebno, &pdiskbno, 1)) < 0) {
     return r;
   }
   if (!*pdiskbno) {
-    if ((newb = alloc_block()) < 0) {
+    if ((newb = alloc_block_near(file_block_goal(f, filebno))) < 0) {
       return -E_NO_DISK;
     }
     *pdiskbno = newb;
@@ -185,64 +588,380 @@ file_get_block(struct File *f, uint32_t filebno, char **blk) {
   return 0;
 }
 
-// Try to find a file named "name" in dir.  If so, set *file to it.
+// --------------------------------------------------------------
+// Directory index
+// --------------------------------------------------------------
+
+// Directories are searched through an in-memory hash table of their
+// entries' names, built the first time a directory is looked at.  The
+// index also chains the directory's free entries, so creating a file
+// takes one off that list instead of scanning for an empty name.  The
+// indexes of the NDIRINDEX most recently used directories are kept.
 //
-// Returns 0 and sets *file on success, < 0 on error.  Errors are:
-//	-E_NOT_FOUND if the file is not found
+// Entry 'slot' of a directory is entry slot % BLKFILES of its block
+// slot / BLKFILES.
+
+#define NDIRINDEX 8
+
+struct DirIndex {
+  struct File *di_dir;  // directory indexed, or NULL
+  uint32_t di_nslots;   // entries in the directory
+  uint32_t di_cap;      // entries di_next and di_hash have room for
+  uint32_t di_nbuckets; // a power of two
+  int32_t *di_bucket;   // first entry of each hash chain, or -1
+  int32_t *di_next;     // next entry in the hash chain or free list
+  uint32_t *di_hash;    // hash of each used entry's name
+  int32_t di_free;      // first free entry, or -1
+  uint32_t di_lastuse;
+};
+
+static struct DirIndex dir_indexes[NDIRINDEX];
+static uint32_t dir_index_clock;
+
+// FNV-1a
+static uint32_t
+name_hash(const char *name) {
+  uint32_t h = 2166136261U;
+
+  while (*name)
+    h = (h ^ (uint8_t)*name++) * 16777619U;
+  return h;
+}
+
+// Set *pf to entry 'slot' of dir.
 static int
-dir_lookup(struct File *dir, const char *name, struct File **file) {
-  int r;
-  uint32_t i, j, nblock;
+dir_slot(struct File *dir, uint32_t slot, struct File **pf) {
   char *blk;
+  int r;
+
+  if ((r = file_get_block(dir, slot / BLKFILES, &blk)) < 0)
+    return r;
+  *pf = (struct File *)blk + slot % BLKFILES;
+  return 0;
+}
+
+static void
+dir_index_drop(struct DirIndex *di) {
+  free(di->di_bucket);
+  free(di->di_next);
+  free(di->di_hash);
+  memset(di, 0, sizeof(*di));
+}
+
+static void
+dir_index_link(struct DirIndex *di, uint32_t slot, uint32_t h) {
+  int32_t *head = &di->di_bucket[h & (di->di_nbuckets - 1)];
+
+  di->di_hash[slot] = h;
+  di->di_next[slot] = *head;
+  *head             = slot;
+}
+
+// Make room for nslots entries, keeping the hash chains at two
+// entries per bucket or less.
+static int
+dir_index_reserve(struct DirIndex *di, uint32_t nslots) {
+  uint32_t cap, nbuckets, i, j;
+  int32_t *bucket, *next, s, t;
+  uint32_t *hash;
+
+  if (nslots > di->di_cap) {
+    cap = MAX(di->di_cap * 2, nslots);
+    if (!(next = realloc(di->di_next, cap * sizeof(*next))))
+      return -E_NO_MEM;
+    di->di_next = next;
+    if (!(hash = realloc(di->di_hash, cap * sizeof(*hash))))
+      return -E_NO_MEM;
+    di->di_hash = hash;
+    di->di_cap  = cap;
+  }
+
+  if (nslots <= 2 * di->di_nbuckets)
+    return 0;
+  for (nbuckets = MAX(di->di_nbuckets, 16); nslots > 2 * nbuckets; nbuckets *= 2)
+    ;
+  if (!(bucket = malloc(nbuckets * sizeof(*bucket))))
+    return -E_NO_MEM;
+  for (i = 0; i < nbuckets; i++)
+    bucket[i] = -1;
+  for (i = 0; i < di->di_nbuckets; i++) {
+    for (s = di->di_bucket[i]; s >= 0; s = t) {
+      t              = di->di_next[s];
+      j              = di->di_hash[s] & (nbuckets - 1);
+      di->di_next[s] = bucket[j];
+      bucket[j]      = s;
+    }
+  }
+  free(di->di_bucket);
+  di->di_bucket   = bucket;
+  di->di_nbuckets = nbuckets;
+  return 0;
+}
+
+// Add entries [from, to) of di's directory to the index.
+static int
+dir_index_scan(struct DirIndex *di, uint32_t from, uint32_t to) {
   struct File *f;
+  uint32_t slot;
+  int r;
+
+  if ((r = dir_index_reserve(di, to)) < 0)
+    return r;
+  // Backwards, so that the free list hands out low entries first.
+  for (slot = to; slot-- > from;) {
+    if ((r = dir_slot(di->di_dir, slot, &f)) < 0)
+      return r;
+    if (f->f_name[0]) {
+      dir_index_link(di, slot, name_hash(f->f_name));
+    } else {
+      di->di_next[slot] = di->di_free;
+      di->di_free       = slot;
+    }
+  }
+  di->di_nslots = to;
+  return 0;
+}
+
+// Set *pdi to the index of dir, building it if there is none.
+static int
+dir_index(struct File *dir, struct DirIndex **pdi) {
+  struct DirIndex *di, *victim = &dir_indexes[0];
+  int r;
 
-  // Search dir for name.
   // We maintain the invariant that the size of a directory-file
   // is always a multiple of the file system's block size.
   assert((dir->f_size % BLKSIZE) == 0);
-  nblock = dir->f_size / BLKSIZE;
-  for (i = 0; i < nblock; i++) {
-    if ((r = file_get_block(dir, i, &blk)) < 0)
+
+  for (di = dir_indexes; di < dir_indexes + NDIRINDEX; di++) {
+    if (di->di_dir == dir)
+      break;
+    if (!di->di_dir || (victim->di_dir && di->di_lastuse < victim->di_lastuse))
+      victim = di;
+  }
+  // A directory that shrank (only truncation does that) is reindexed.
+  if (di < dir_indexes + NDIRINDEX && di->di_nslots > dir->f_size / sizeof(struct File))
+    dir_index_drop(victim = di);
+  else if (di < dir_indexes + NDIRINDEX)
+    victim = NULL;
+
+  if (victim) {
+    di = victim;
+    dir_index_drop(di);
+    di->di_dir  = dir;
+    di->di_free = -1;
+    if ((r = dir_index_scan(di, 0, dir->f_size / sizeof(struct File))) < 0) {
+      dir_index_drop(di);
       return r;
-    f = (struct File *)blk;
-    for (j = 0; j < BLKFILES; j++)
-      if (strcmp(f[j].f_name, name) == 0) {
-        *file = &f[j];
-        return 0;
-      }
+    }
   }
-  return -E_NOT_FOUND;
+  di->di_lastuse = ++dir_index_clock;
+  *pdi           = di;
+  return 0;
 }
 
-// Set *file to point at a free File structure in dir.  The caller is
-// responsible for filling in the File fields.
+// Try to find a file named "name" in dir.  If so, set *file to it.
+//
+// Returns 0 and sets *file on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if the file is not found
 static int
-dir_alloc_file(struct File *dir, struct File **file) {
+dir_lookup(struct File *dir, const char *name, struct File **file) {
+  struct DirIndex *di;
+  struct File *f;
+  uint32_t h = name_hash(name);
+  int32_t s;
   int r;
-  uint32_t nblock, i, j;
+
+  if ((r = dir_index(dir, &di)) < 0)
+    return r;
+  for (s = di->di_bucket[h & (di->di_nbuckets - 1)]; s >= 0; s = di->di_next[s]) {
+    if (di->di_hash[s] != h)
+      continue;
+    if ((r = dir_slot(dir, s, &f)) < 0)
+      return r;
+    if (strcmp(f->f_name, name) == 0) {
+      *file = f;
+      return 0;
+    }
+  }
+  return -E_NOT_FOUND;
+}
+
+// Set *file to point at a free File structure in dir, cleared and
+// named 'name'.  The caller is responsible for filling in the other
+// File fields.
+static int
+dir_alloc_file(struct File *dir, const char *name, struct File **file) {
+  struct DirIndex *di;
+  uint32_t nslots;
   char *blk;
-  struct File *f;
+  int r;
 
-  assert((dir->f_size % BLKSIZE) == 0);
-  nblock = dir->f_size / BLKSIZE;
-  for (i = 0; i < nblock; i++) {
-    if ((r = file_get_block(dir, i, &blk)) < 0)
+  if ((r = dir_index(dir, &di)) < 0)
+    return r;
+  if (di->di_free < 0) {
+    // Grow the directory by a block of empty entries.
+    if ((r = file_get_block(dir, dir->f_size / BLKSIZE, &blk)) < 0)
       return r;
-    f = (struct File *)blk;
-    for (j = 0; j < BLKFILES; j++)
-      if (f[j].f_name[0] == '\0') {
-        *file = &f[j];
-        return 0;
-      }
+    memset(blk, 0, BLKSIZE);
+    dir->f_size += BLKSIZE;
+    nslots = di->di_nslots;
+    if ((r = dir_index_scan(di, nslots, nslots + BLKFILES)) < 0) {
+      dir_index_drop(di);
+      return r;
+    }
   }
-  dir->f_size += BLKSIZE;
-  if ((r = file_get_block(dir, i, &blk)) < 0)
+
+  if ((r = dir_slot(dir, di->di_free, file)) < 0)
     return r;
-  f     = (struct File *)blk;
-  *file = &f[0];
+  memset(*file, 0, sizeof(**file));
+  strcpy((*file)->f_name, name);
+  r           = di->di_free;
+  di->di_free = di->di_next[r];
+  dir_index_link(di, r, name_hash(name));
+  return 0;
+}
+
+// Clear the name of f, an entry of dir, and put the entry on dir's
+// free list.
+static int
+dir_free_file(struct File *dir, struct File *f) {
+  struct DirIndex *di;
+  struct File *g;
+  int32_t *link;
+  int r;
+
+  if ((r = dir_index(dir, &di)) < 0)
+    return r;
+  for (link = &di->di_bucket[name_hash(f->f_name) & (di->di_nbuckets - 1)];
+       *link >= 0; link = &di->di_next[*link]) {
+    if ((r = dir_slot(dir, *link, &g)) < 0)
+      return r;
+    if (g == f)
+      break;
+  }
+  if (*link < 0)
+    return -E_NOT_FOUND;
+
+  r              = *link;
+  *link          = di->di_next[r];
+  di->di_next[r] = di->di_free;
+  di->di_free    = r;
+  f->f_name[0]   = '\0';
   return 0;
 }
 
+// --------------------------------------------------------------
+// Path lookup cache
+// --------------------------------------------------------------
+
+// walk_path looks each path component up here before asking the
+// directory.  An entry maps a (directory, name) pair to the File
+// found, or to NULL if there is no such file (a negative entry).
+// The cache is set associative; a set replaces its least recently
+// used entry.  file_create, file_remove and truncating a directory
+// update the entries they make wrong.
+
+#define DCACHE_SETS 64
+#define DCACHE_WAYS 4
+
+struct Dentry {
+  struct File *d_dir;  // NULL if the entry is unused
+  struct File *d_file; // NULL for a negative entry
+  uint32_t d_hash;
+  uint32_t d_lastuse;
+  char d_name[MAXNAMELEN];
+};
+
+static struct Dentry dcache[DCACHE_SETS][DCACHE_WAYS];
+static uint32_t dcache_clock;
+static uint64_t dcache_lookups, dcache_hits, dcache_neg_hits;
+
+static uint32_t
+dcache_hash(struct File *dir, const char *name) {
+  return name_hash(name) ^ (uint32_t)((uintptr_t)dir / sizeof(struct File) * 2654435761U);
+}
+
+static struct Dentry *
+dcache_find(struct File *dir, const char *name, uint32_t h) {
+  struct Dentry *d = dcache[h % DCACHE_SETS];
+  int i;
+
+  for (i = 0; i < DCACHE_WAYS; i++) {
+    if (d[i].d_dir == dir && d[i].d_hash == h && strcmp(d[i].d_name, name) == 0)
+      return &d[i];
+  }
+  return NULL;
+}
+
+// Record that 'name' in dir is f, or does not exist if f is NULL.
+static void
+dcache_set(struct File *dir, const char *name, struct File *f) {
+  uint32_t h = dcache_hash(dir, name);
+  struct Dentry *d, *set;
+  int i;
+
+  if (!(d = dcache_find(dir, name, h))) {
+    set = dcache[h % DCACHE_SETS];
+    d   = &set[0];
+    for (i = 0; i < DCACHE_WAYS && d->d_dir; i++) {
+      if (!set[i].d_dir || set[i].d_lastuse < d->d_lastuse)
+        d = &set[i];
+    }
+    d->d_dir  = dir;
+    d->d_hash = h;
+    strcpy(d->d_name, name);
+  }
+  d->d_file    = f;
+  d->d_lastuse = ++dcache_clock;
+}
+
+// Forget everything cached about the entries of dir.
+static void
+dcache_forget_dir(struct File *dir) {
+  int i, j;
+
+  for (i = 0; i < DCACHE_SETS; i++) {
+    for (j = 0; j < DCACHE_WAYS; j++) {
+      if (dcache[i][j].d_dir == dir)
+        dcache[i][j].d_dir = NULL;
+    }
+  }
+}
+
+// dir_lookup through the cache.
+static int
+dir_lookup_cached(struct File *dir, const char *name, struct File **file) {
+  struct Dentry *d;
+  int r;
+
+  dcache_lookups++;
+  if ((d = dcache_find(dir, name, dcache_hash(dir, name)))) {
+    dcache_hits++;
+    d->d_lastuse = ++dcache_clock;
+    if (!d->d_file) {
+      dcache_neg_hits++;
+      return -E_NOT_FOUND;
+    }
+    *file = d->d_file;
+    return 0;
+  }
+
+  if ((r = dir_lookup(dir, name, file)) == 0)
+    dcache_set(dir, name, *file);
+  else if (r == -E_NOT_FOUND)
+    dcache_set(dir, name, NULL);
+  return r;
+}
+
+// Fill in the path lookup cache's part of the server's statistics.
+void
+fs_get_stats(struct Fsret_stats *st) {
+  st->ret_dcache_lookups  = dcache_lookups;
+  st->ret_dcache_hits     = dcache_hits;
+  st->ret_dcache_neg_hits = dcache_neg_hits;
+  st->ret_dcache_size     = DCACHE_SETS * DCACHE_WAYS;
+}
+
 // Skip over slashes.
 static const char *
 skip_slash(const char *p) {
@@ -288,7 +1007,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
     if (dir->f_type != FTYPE_DIR)
       return -E_NOT_FOUND;
 
-    if ((r = dir_lookup(dir, name, &f)) < 0) {
+    if ((r = dir_lookup_cached(dir, name, &f)) < 0) {
       if (r == -E_NOT_FOUND && *path == '\0') {
         if (pdir)
           *pdir = dir;
@@ -322,12 +1041,13 @@ file_create(const char *path, struct File **pf) {
     return -E_FILE_EXISTS;
   if (r != -E_NOT_FOUND || dir == 0)
     return r;
-  if ((r = dir_alloc_file(dir, &f)) < 0)
+  if ((r = dir_alloc_file(dir, name, &f)) < 0)
     return r;
+  dcache_set(dir, name, f);
 
-  strcpy(f->f_name, name);
+  if (super->s_flags & FS_EXTENTS)
+    f->f_flags = FILE_EXTENTS;
   *pf = f;
-  file_flush(dir);
   return 0;
 }
 
@@ -340,12 +1060,15 @@ file_open(const char *path, struct File **pf) {
 
 // Read count bytes from f into buf, starting from seek position
 // offset.  This meant to mimic the standard pread function.
+// Each run of blocks that is contiguous on disk is brought into the
+// block cache with as few disk reads as possible and copied at once;
+// unallocated blocks read as zeros.
 // Returns the number of bytes read, < 0 on error.
 ssize_t
 file_read(struct File *f, void *buf, size_t count, off_t offset) {
   int r, bn;
   off_t pos;
-  char *blk;
+  uint32_t bno, diskbno, n;
 
   if (offset >= f->f_size)
     return 0;
@@ -353,10 +1076,16 @@ file_read(struct File *f, void *buf, size_t count, off_t offset) {
   count = MIN(count, f->f_size - offset);
 
   for (pos = offset; pos < offset + count;) {
-    if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+    bno = pos / BLKSIZE;
+    if ((r = file_map_run(f, bno, &diskbno, &n, (offset + count - 1) / BLKSIZE - bno + 1)) < 0)
       return r;
-    bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-    memmove(buf, blk + pos % BLKSIZE, bn);
+    bn = MIN(n * BLKSIZE - pos % BLKSIZE, offset + count - pos);
+    if (diskbno) {
+      bc_fetch(diskbno, n);
+      memmove(buf, (char *)diskaddr(diskbno) + pos % BLKSIZE, bn);
+    } else {
+      memset(buf, 0, bn);
+    }
     pos += bn;
     buf += bn;
   }
@@ -364,6 +1093,22 @@ file_read(struct File *f, void *buf, size_t count, off_t offset) {
   return count;
 }
 
+// Bring the file blocks [filebno, filebno + nblocks) of f, as far as
+// they lie within the file, into the block cache ahead of reads,
+// with one disk read per run of consecutive blocks.
+void
+file_prefetch(struct File *f, uint32_t filebno, uint32_t nblocks) {
+  uint32_t end = MIN(filebno + nblocks, (f->f_size + BLKSIZE - 1) / BLKSIZE);
+  uint32_t diskbno, n;
+
+  for (; filebno < end; filebno += n) {
+    if (file_map_run(f, filebno, &diskbno, &n, end - filebno) < 0)
+      return;
+    if (diskbno)
+      bc_fetch(diskbno, n);
+  }
+}
+
 // Write count bytes from buf into f, starting at seek position
 // offset.  This is meant to mimic the standard pwrite function.
 // Extends the file if necessary.
@@ -372,6 +1117,7 @@ int
 file_write(struct File *f, const void *buf, size_t count, off_t offset) {
   int r, bn;
   off_t pos;
+  uint32_t bno, diskbno, n;
   char *blk;
 
   // Extend file if necessary
@@ -380,10 +1126,18 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
       return r;
 
   for (pos = offset; pos < offset + count;) {
-    if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+    bno = pos / BLKSIZE;
+    if ((r = file_map_run(f, bno, &diskbno, &n, (offset + count - 1) / BLKSIZE - bno + 1)) < 0)
       return r;
-    bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
-    memmove(blk + pos % BLKSIZE, buf, bn);
+    if (!diskbno) {
+      // Allocate the block, then look up the run it is part of now.
+      if ((r = file_get_block(f, bno, &blk)) < 0)
+        return r;
+      continue;
+    }
+    bn = MIN(n * BLKSIZE - pos % BLKSIZE, offset + count - pos);
+    bc_fetch(diskbno, n);
+    memmove((char *)diskaddr(diskbno) + pos % BLKSIZE, buf, bn);
     pos += bn;
     buf += bn;
   }
@@ -415,6 +1169,7 @@ file_free_block(struct File *f, uint32_t filebno) {
 // been allocated (f->f_indirect != 0), then free the indirect block too.
 // (Remember to clear the f->f_indirect pointer so you'll know
 // whether it's valid!)
+// Extent files trim their extent tree instead.
 // Do not change f->f_size.
 static void
 file_truncate_blocks(struct File *f, off_t newsize) {
@@ -423,6 +1178,11 @@ file_truncate_blocks(struct File *f, off_t newsize) {
 
   old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
   new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  if (f->f_flags & FILE_EXTENTS) {
+    ext_truncate(f, new_nblocks);
+    return;
+  }
+
   for (bno = new_nblocks; bno < old_nblocks; bno++)
     if ((r = file_free_block(f, bno)) < 0)
       cprintf("warning: file_free_block: %i", r);
@@ -434,39 +1194,109 @@ file_truncate_blocks(struct File *f, off_t newsize) {
 }
 
 // Set the size of file f, truncating or extending as necessary.
+// Returns 0 on success, -E_INVAL if newsize is negative or too big
+// for the file's block map.
 int
 file_set_size(struct File *f, off_t newsize) {
+  if (newsize < 0 || newsize > (f->f_flags & FILE_EXTENTS ? MAXEXTFILESIZE : MAXFILESIZE))
+    return -E_INVAL;
+  if (f->f_type == FTYPE_DIR && f->f_size > newsize)
+    dcache_forget_dir(f);
   if (f->f_size > newsize)
     file_truncate_blocks(f, newsize);
   f->f_size = newsize;
-  flush_block(f);
   return 0;
 }
 
+// Remove "path", freeing its blocks.
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_NOT_EMPTY if path is a directory that still has entries,
+//		whose blocks would otherwise be lost
+int
+file_remove(const char *path) {
+  struct File *dir, *f, *ent;
+  struct DirIndex *di;
+  uint32_t slot;
+  int r;
+
+  if ((r = walk_path(path, &dir, &f, 0)) < 0)
+    return r;
+  if (!dir)
+    return -E_BAD_PATH;
+
+  if (f->f_type == FTYPE_DIR) {
+    for (slot = 0; slot < f->f_size / sizeof(struct File); slot++) {
+      if ((r = dir_slot(f, slot, &ent)) < 0)
+        return r;
+      if (ent->f_name[0])
+        return -E_NOT_EMPTY;
+    }
+    for (di = dir_indexes; di < dir_indexes + NDIRINDEX; di++) {
+      if (di->di_dir == f)
+        dir_index_drop(di);
+    }
+    dcache_forget_dir(f);
+  }
+  file_truncate_blocks(f, 0);
+  f->f_size = 0;
+  dcache_set(dir, f->f_name, NULL);
+  return dir_free_file(dir, f);
+}
+
 // Flush the contents and metadata of file f out to disk.
-// Loop over all the blocks in file.
-// Translate the file block number into a disk block number
-// and then check whether that disk block is dirty.  If so, write it out.
+// Find the dirty blocks in the cache, and if there are any,
+// write out the bitmap, which may record blocks allocated to f,
+// then loop over the runs of blocks in the file, writing out the
+// dirty blocks of each.
 void
 file_flush(struct File *f) {
-  int i;
-  uint32_t *pdiskbno;
+  uint32_t bno, nblocks, diskbno, n;
 
-  for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
-    if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-        pdiskbno == NULL || *pdiskbno == 0)
-      continue;
-    flush_block(diskaddr(*pdiskbno));
+  nblocks = bc_collect_dirty() ? (f->f_size + BLKSIZE - 1) / BLKSIZE : 0;
+  if (nblocks)
+    bc_flush_dirty(1, 1 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE, 0);
+  for (bno = 0; bno < nblocks; bno += n) {
+    if (file_map_run(f, bno, &diskbno, &n, nblocks - bno) < 0)
+      break;
+    if (diskbno)
+      bc_flush_dirty(diskbno, n, 0);
   }
   flush_block(f);
-  if (f->f_indirect)
+  if (f->f_flags & FILE_EXTENTS)
+    ext_flush_node(&f->f_exthdr, f->f_extent);
+  else if (f->f_indirect)
     flush_block(diskaddr(f->f_indirect));
 }
 
-// Sync the entire file system.  A big hammer.
+// Write back the blocks that have been dirty for at least min_age
+// write-back ticks, and their dirty neighbours, in two ordered steps:
+// first the superblock and the bitmap, so that no block on disk
+// points at a block that is free there, then the rest in ascending
+// order.  If that leaves nothing dirty, no block on disk points at a
+// block freed since, and those are marked free.
+// Returns the number of dirty blocks left.
+uint32_t
+fs_writeback(uint32_t min_age) {
+  uint32_t nmeta = 1 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
+  uint32_t left;
+
+  if (!bc_age_dirty() && !nfreeing)
+    return 0;
+  bc_flush_dirty(1, nmeta, 0);
+  left = bc_flush_dirty(1 + nmeta, super->s_nblocks - 1 - nmeta, min_age);
+  if (!left && nfreeing) {
+    release_freed_blocks();
+    left = bc_collect_dirty();
+  }
+  return left;
+}
+
+// Sync the entire file system: write out every dirty block in the
+// cache, then the bitmap once more for the blocks that made free.
 void
 fs_sync(void) {
-  int i;
-  for (i = 1; i < super->s_nblocks; i++)
-    flush_block(diskaddr(i));
+  if (fs_writeback(0)) {
+    bc_collect_dirty();
+    bc_flush_dirty(1, super->s_nblocks - 1, 0);
+  }
 }
@@ -4,6 +4,19 @@
 #define SECTSIZE 512                  // bytes per disk sector
 #define BLKSECTS (BLKSIZE / SECTSIZE) // sectors per block
 
+// Most blocks read by one disk transfer
+#define BC_MAXRUN (256 / BLKSECTS)
+#if BC_MAXRUN > PAGE_ALLOC_RANGE_MAX
+#error "a run must fit in one sys_page_alloc_range"
+#endif
+
+// Blocks the block cache holds by default, and at the least: enough
+// that a whole run being read never fills it.
+#ifndef BC_CAPACITY
+#define BC_CAPACITY 2048
+#endif
+#define BC_MINCAP (2 * BC_MAXRUN)
+
 /* Disk block n, when in memory, is mapped into the file system
  * server's address space at DISKMAP + (n*BLKSIZE). */
 #define DISKMAP 0x10000000
@@ -15,17 +28,52 @@ extern struct Super *super; // superblock
 extern uint32_t *bitmap;    // bitmap blocks mapped in memory
 
 /* ide.c */
+void ide_init(void);
 bool ide_probe_disk1(void);
 void ide_set_disk(int diskno);
 void ide_set_partition(uint32_t first_sect, uint32_t nsect);
 int ide_read(uint32_t secno, void *dst, size_t nsecs);
 int ide_write(uint32_t secno, const void *src, size_t nsecs);
+int ide_set_dma(bool on);
+void ide_get_stats(struct Fsret_stats *st);
+
+/* virtio.c */
+bool virtio_blk_init(void);
+int virtio_blk_submit(uint32_t secno, void *buf, size_t nsecs, bool write);
+int virtio_blk_wait(void);
+void virtio_blk_get_stats(struct Fsret_stats *st);
+
+/* pci.c */
+#define PCI_ID      0x00
+#define PCI_COMMAND 0x04
+#define PCI_CLASS   0x08
+#define PCI_BAR(n)  (0x10 + 4 * (n))
+#define PCI_INTR    0x3C
+
+uint32_t pci_conf_read(int dev, int func, int reg);
+void pci_conf_write(int dev, int func, int reg, uint32_t v);
+void pci_enable(int dev, int func);
+
+/* disk.c */
+void disk_init(void);
+int disk_submit(uint32_t secno, void *buf, size_t nsecs, bool write);
+int disk_wait(void);
+int disk_read(uint32_t secno, void *dst, size_t nsecs);
+int disk_write(uint32_t secno, const void *src, size_t nsecs);
+int disk_set_dma(bool on);
+void disk_get_stats(struct Fsret_stats *st);
 
 /* bc.c */
 void *diskaddr(uint32_t blockno);
 bool va_is_mapped(void *va);
 bool va_is_dirty(void *va);
 void flush_block(void *addr);
+void bc_fetch(uint32_t blockno, uint32_t nblocks);
+uint32_t bc_collect_dirty(void);
+uint32_t bc_age_dirty(void);
+uint32_t bc_flush_dirty(uint32_t blockno, uint32_t nblocks, uint32_t min_age);
+int bc_set_capacity(uint32_t nblocks);
+void bc_get_stats(struct Fsret_stats *st);
 void bc_init(void);
 
 /* fs.c */
@@ -33,17 +81,23 @@ void fs_init(void);
 int file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
 int file_create(const char *path, struct File **f);
 int file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc);
+int file_map_run(struct File *f, uint32_t filebno, uint32_t *pdiskbno, uint32_t *pcount, uint32_t max);
 int file_open(const char *path, struct File **f);
 ssize_t file_read(struct File *f, void *buf, size_t count, off_t offset);
+void file_prefetch(struct File *f, uint32_t filebno, uint32_t nblocks);
 int file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int file_set_size(struct File *f, off_t newsize);
 void file_flush(struct File *f);
 int file_remove(const char *path);
+uint32_t fs_writeback(uint32_t min_age);
 void fs_sync(void);
+void fs_get_stats(struct Fsret_stats *st);
 
 /* int	map_block(uint32_t); */
 bool block_is_free(uint32_t blockno);
 int alloc_block(void);
+int alloc_block_near(uint32_t goal);
+void free_block(uint32_t blockno);
 
 /* test.c */
 void fs_test(void);
@@ -41,6 +41,7 @@ struct Dir {
 };
 
 uint32_t nblocks;
+int extents; // -e: build extent files
 char *diskmap, *diskpos;
 struct Super *super;
 uint32_t *bitmap;
@@ -106,6 +107,8 @@ opendisk(const char *name) {
   super->s_nblocks     = nblocks;
   super->s_root.f_type = FTYPE_DIR;
   strcpy(super->s_root.f_name, "/");
+  if (extents)
+    super->s_flags = FS_EXTENTS;
 
   nbitblocks = (nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
   bitmap     = alloc(nbitblocks * BLKSIZE);
@@ -118,6 +121,7 @@ finishdisk(void) {
 
   for (i = 0; i < blockof(diskpos); ++i)
     bitmap[i / 32] &= ~(1 << (i % 32));
+  super->s_nfree = nblocks - blockof(diskpos);
 
   if ((r = msync(diskmap, nblocks * BLKSIZE, MS_SYNC)) < 0)
     panic("msync: %s", strerror(errno));
@@ -128,6 +132,17 @@ finishfile(struct File *f, uint32_t start, uint32_t len) {
   int i;
   f->f_size = len;
   len       = ROUNDUP(len, BLKSIZE);
+  if (extents) {
+    // The data is contiguous, so one extent maps all of it.
+    f->f_flags = FILE_EXTENTS;
+    if (len) {
+      f->f_exthdr.eh_nent      = 1;
+      f->f_extent[0].e_fileblk = 0;
+      f->f_extent[0].e_diskblk = start;
+      f->f_extent[0].e_len     = len / BLKSIZE;
+    }
+    return;
+  }
   for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
     f->f_direct[i] = start + i;
   if (i == NDIRECT) {
@@ -179,7 +194,7 @@ writefile(struct Dir *dir, const char *name) {
     panic("stat %s: %s", name, strerror(errno));
   if (!S_ISREG(st.st_mode))
     panic("%s is not a regular file", name);
-  if (st.st_size >= MAXFILESIZE)
+  if (st.st_size >= (extents ? MAXEXTFILESIZE : MAXFILESIZE))
     panic("%s too large", name);
 
   last = strrchr(name, '/');
@@ -197,7 +212,8 @@ writefile(struct Dir *dir, const char *name) {
 
 void
 usage(void) {
-  fprintf(stderr, "Usage: fsformat fs.img NBLOCKS files...\n");
+  fprintf(stderr, "Usage: fsformat [-e] fs.img NBLOCKS files...\n");
+  fprintf(stderr, "  -e  map files with extents; allows files over 4MB\n");
   exit(2);
 }
 
@@ -209,11 +225,18 @@ main(int argc, char **argv) {
 
   assert(BLKSIZE % sizeof(struct File) == 0);
 
+  if (argc > 1 && strcmp(argv[1], "-e") == 0) {
+    extents = 1;
+    argc--;
+    argv++;
+  }
   if (argc < 3)
     usage();
 
+  // Extent images may be as large as the file system server can map
+  // (DISKSIZE in fs/fs.h).
   nblocks = strtol(argv[2], &s, 0);
-  if (*s || s == argv[2] || nblocks < 2 || nblocks > 1024)
+  if (*s || s == argv[2] || nblocks < 2 || nblocks > (extents ? 0xC0000000 / BLKSIZE : 1024))
     usage();
 
   opendisk(argv[1]);
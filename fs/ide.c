@@ -1,7 +1,14 @@
 /*
- * Minimal PIO-based (non-interrupt-driven) IDE driver code.
+ * Minimal IDE driver code.
  * For information about what all this IDE/ATA magic means,
  * see the materials available on the class references page.
+ *
+ * Page-aligned transfers of whole pages go through the PCI IDE
+ * controller's bus-master DMA engine (PIIX and compatibles) when
+ * there is one: the pages are described by a PRD table and the disk
+ * interrupts when it is done, which the kernel passes on as a
+ * POLLWAIT_DISK event.  Meanwhile other environments run.  Everything
+ * else, and any transfer touching memory above 4GB, uses PIO.
  */
 
 #include "fs.h"
@@ -12,8 +19,51 @@
 #define IDE_DF   0x20
 #define IDE_ERR  0x01
 
+// Device control register and its interrupt disable bit.  PIO
+// transfers run with interrupts off, DMA transfers with them on.
+#define IDE_CTRL 0x3F6
+#define IDE_NIEN 0x02
+
+#define IDE_CMD_READ      0x20
+#define IDE_CMD_WRITE     0x30
+#define IDE_CMD_READ_DMA  0xC8
+#define IDE_CMD_WRITE_DMA 0xCA
+
+#define PCI_CLASS_IDE  0x0101
+#define PCI_IDE_MASTER 0x80 // programming interface: can do bus-master DMA
+
+// Bus-master registers of the primary channel, from BAR4
+#define BM_CMD       0
+#define BM_STATUS    2
+#define BM_PRDT      4
+#define BM_CMD_START 0x01
+#define BM_CMD_READ  0x08 // the controller writes to memory
+#define BM_ST_ERR    0x02
+#define BM_ST_INTR   0x04
+
+// Physical region descriptor: one physically contiguous piece of the
+// buffer that does not cross a 64KB boundary.  A length of 0 is 64KB.
+struct Prd {
+  uint32_t prd_addr;
+  uint16_t prd_len;
+  uint16_t prd_flags;
+};
+#define PRD_EOT 0x8000 // last entry of the table
+
+// The PRD table's page, below serv.c's request page
+#define IDE_PRDVA (DISKMAP - 2 * PGSIZE)
+
+// How long to wait for a DMA transfer before giving up on it
+#define IDE_DMA_TIMEOUT 2000000000ULL // ns
+
 static int diskno = 1;
 
+static uint16_t bmbase;  // bus-master registers, 0 if there are none
+static bool dma_enabled; // use DMA where possible
+static bool irq_claimed; // IRQ 14 is routed to us
+static physaddr_t prdt_pa;
+static uint64_t ndma, npio; // transfers done each way
+
 static int
 ide_wait_ready(bool check_error) {
   int r;
@@ -56,20 +106,163 @@ ide_set_disk(int d) {
   diskno = d;
 }
 
-int
-ide_read(uint32_t secno, void *dst, size_t nsecs) {
-  int r;
+// Look on PCI bus 0 for an IDE controller that can do bus-master
+// DMA, and if there is one, let it master the bus.  DMA stays off
+// until ide_set_dma turns it on: the PIO path is the one every fs
+// test has been run on.
+void
+ide_init(void) {
+  uint32_t class, bar;
+  int dev, func, r;
 
-  assert(nsecs <= 256);
+  outb(IDE_CTRL, IDE_NIEN);
 
-  ide_wait_ready(0);
+  for (dev = 0; dev < 32 && !bmbase; dev++) {
+    for (func = 0; func < 8 && !bmbase; func++) {
+      if ((pci_conf_read(dev, func, PCI_ID) & 0xFFFF) == 0xFFFF)
+        continue;
+      class = pci_conf_read(dev, func, PCI_CLASS);
+      bar   = pci_conf_read(dev, func, PCI_BAR(4));
+      if (class >> 16 != PCI_CLASS_IDE || !(class & (PCI_IDE_MASTER << 8)) ||
+          !(bar & 1) || !(bar & 0xFFFC))
+        continue;
+      pci_enable(dev, func);
+      bmbase = bar & 0xFFFC;
+    }
+  }
+  if (!bmbase)
+    return;
 
+  if ((r = sys_page_alloc(0, (void *)IDE_PRDVA, PTE_P | PTE_U | PTE_W)) < 0 ||
+      (r = sys_page_phys((void *)IDE_PRDVA, 1, &prdt_pa)) < 0)
+    panic("ide_init: PRD table: %i", r);
+  if (prdt_pa >= 0x100000000ULL) {
+    cprintf("ide: not using DMA\n");
+    bmbase = 0;
+    return;
+  }
+  cprintf("ide: bus-master DMA at port 0x%x, off until enabled\n", bmbase);
+}
+
+// Turn DMA on or off; off, every transfer uses PIO.  The disk's IRQ
+// is routed to us the first time DMA is turned on.
+// Returns 0, or -E_NOT_SUPP to turn it on without a DMA controller
+// or without the IRQ.
+int
+ide_set_dma(bool on) {
+  if (on && !bmbase)
+    return -E_NOT_SUPP;
+  if (on && !irq_claimed) {
+    if (sys_disk_irq(IRQ_IDE) < 0)
+      return -E_NOT_SUPP;
+    irq_claimed = 1;
+  }
+  dma_enabled = on;
+  return 0;
+}
+
+void
+ide_get_stats(struct Fsret_stats *st) {
+  st->ret_ide_dma       = dma_enabled;
+  st->ret_ide_dma_xfers = ndma;
+  st->ret_ide_pio_xfers = npio;
+}
+
+static void
+ide_select(uint32_t secno, size_t nsecs) {
   outb(0x1F2, nsecs);
   outb(0x1F3, secno & 0xFF);
   outb(0x1F4, (secno >> 8) & 0xFF);
   outb(0x1F5, (secno >> 16) & 0xFF);
   outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-  outb(0x1F7, 0x20); // CMD 0x20 means read sector
+}
+
+// Transfer nsecs sectors between the disk and the pages at buf by
+// DMA, sleeping until the disk interrupts.  Returns 0 on success,
+// 1 if buf cannot be used for DMA, or -1 on a disk error.
+static int
+ide_dma(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  struct Prd *prd = (struct Prd *)IDE_PRDVA;
+  physaddr_t pa[256 * SECTSIZE / PGSIZE], end = 0;
+  size_t npages = nsecs * SECTSIZE / PGSIZE, i, n = 0;
+  uint8_t dir = write ? 0 : BM_CMD_READ;
+  int st, r;
+
+  if ((uintptr_t)buf % PGSIZE || (nsecs * SECTSIZE) % PGSIZE ||
+      sys_page_phys(buf, npages, pa) < 0)
+    return 1;
+  for (i = 0; i < npages; i++) {
+    if (pa[i] > 0x100000000ULL - PGSIZE)
+      return 1;
+    if (n && pa[i] == end && end % 0x10000) {
+      prd[n - 1].prd_len += PGSIZE;
+    } else {
+      prd[n++] = (struct Prd){(uint32_t)pa[i], PGSIZE, 0};
+    }
+    end = pa[i] + PGSIZE;
+  }
+  prd[n - 1].prd_flags = PRD_EOT;
+
+  ide_wait_ready(0);
+  outl(bmbase + BM_PRDT, prdt_pa);
+  outb(bmbase + BM_CMD, dir);
+  outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+  outb(IDE_CTRL, 0);
+  ide_select(secno, nsecs);
+  outb(0x1F7, write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+  outb(bmbase + BM_CMD, dir | BM_CMD_START);
+
+  // Let other environments run until the disk is done.  A wakeup
+  // may be left over from an earlier interrupt, so check each time.
+  while (!((st = inb(bmbase + BM_STATUS)) & BM_ST_INTR)) {
+    if (sys_poll_wait(NULL, 0, POLLWAIT_DISK, IDE_DMA_TIMEOUT) == -E_TIMEOUT) {
+      st = inb(bmbase + BM_STATUS);
+      break;
+    }
+  }
+
+  outb(bmbase + BM_CMD, dir);
+  r = ide_wait_ready(1); // reading the status acknowledges the interrupt
+  outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_INTR);
+  outb(IDE_CTRL, IDE_NIEN);
+  if ((st & (BM_ST_ERR | BM_ST_INTR)) != BM_ST_INTR)
+    r = -1;
+  return r;
+}
+
+// Try a DMA transfer if it is on; if it fails, turn it off for good
+// and let the caller fall back to PIO.  Returns 0 if done.
+static int
+ide_try_dma(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  int r;
+
+  if (!dma_enabled || (r = ide_dma(secno, buf, nsecs, write)) > 0)
+    return 1;
+  if (r < 0) {
+    cprintf("ide: DMA %s of sector %u failed, using PIO\n",
+            write ? "write" : "read", secno);
+    dma_enabled = 0;
+    bmbase      = 0;
+    return 1;
+  }
+  ndma++;
+  return 0;
+}
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+  int r;
+
+  assert(nsecs <= 256);
+
+  if (!ide_try_dma(secno, dst, nsecs, 0))
+    return 0;
+  npio++;
+
+  ide_wait_ready(0);
+
+  ide_select(secno, nsecs);
+  outb(0x1F7, IDE_CMD_READ);
 
   for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
     if ((r = ide_wait_ready(1)) < 0)
@@ -86,14 +279,14 @@ ide_write(uint32_t secno, const void *src, size_t nsecs) {
 
   assert(nsecs <= 256);
 
+  if (!ide_try_dma(secno, (void *)src, nsecs, 1))
+    return 0;
+  npio++;
+
   ide_wait_ready(0);
 
-  outb(0x1F2, nsecs);
-  outb(0x1F3, secno & 0xFF);
-  outb(0x1F4, (secno >> 8) & 0xFF);
-  outb(0x1F5, (secno >> 16) & 0xFF);
-  outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-  outb(0x1F7, 0x30); // CMD 0x30 means write sector
+  ide_select(secno, nsecs);
+  outb(0x1F7, IDE_CMD_WRITE);
 
   for (; nsecs > 0; nsecs--, src += SECTSIZE) {
     if ((r = ide_wait_ready(1)) < 0)
@@ -0,0 +1,33 @@
+// PCI configuration space of the devices on bus 0, for the disk
+// drivers, through configuration mechanism 1.
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define PCI_CONF_ADDR 0xCF8
+#define PCI_CONF_DATA 0xCFC
+
+#define PCI_CMD_IO     0x0001
+#define PCI_CMD_MASTER 0x0004
+
+uint32_t
+pci_conf_read(int dev, int func, int reg) {
+  outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+  return inl(PCI_CONF_DATA);
+}
+
+void
+pci_conf_write(int dev, int func, int reg, uint32_t v) {
+  outl(PCI_CONF_ADDR, 0x80000000 | dev << 11 | func << 8 | reg);
+  outl(PCI_CONF_DATA, v);
+}
+
+// Let the device answer to its I/O ports and master the bus.
+void
+pci_enable(int dev, int func) {
+  // The upper half is the status register; writing zeroes there
+  // leaves it alone.
+  pci_conf_write(dev, func, PCI_COMMAND,
+                 (pci_conf_read(dev, func, PCI_COMMAND) & 0xFFFF) |
+                     PCI_CMD_IO | PCI_CMD_MASTER);
+}
@@ -27,12 +27,24 @@
 //    file IDs to struct OpenFile.
 
 struct OpenFile {
-  uint32_t o_fileid;   // file id
-  struct File *o_file; // mapped descriptor for open file
-  int o_mode;          // open mode
-  struct Fd *o_fd;     // Fd page
+  uint32_t o_fileid;    // file id
+  struct File *o_file;  // mapped descriptor for open file
+  int o_mode;           // open mode
+  struct Fd *o_fd;      // Fd page
+  off_t o_ra_pos;       // where a sequential read would start next
+  uint32_t o_ra_end;    // first file block not read ahead yet
+  uint32_t o_ra_window; // read-ahead in blocks, 0 while reads are random
 };
 
+// Read-ahead window bounds, in blocks.  The largest is one disk transfer.
+#define RA_MINWINDOW 4
+#define RA_MAXWINDOW BC_MAXRUN
+
+// Write-back runs every WB_INTERVAL seconds while blocks are dirty,
+// and writes out the blocks that have been dirty for WB_AGE runs.
+#define WB_INTERVAL 1
+#define WB_AGE      5
+
 // initialize to force into data section
 struct OpenFile opentab[MAXOPEN] = {
     {0, 0, 1, 0}};
@@ -138,11 +150,6 @@ serve_open(envid_t envid, struct Fsreq_open *req,
       return r;
     }
   }
-  if ((r = file_open(path, &f)) < 0) {
-    if (debug)
-      cprintf("file_open failed: %i", r);
-    return r;
-  }
 
   // Save the file pointer
   o->o_file = f;
@@ -152,6 +159,9 @@ serve_open(envid_t envid, struct Fsreq_open *req,
   o->o_fd->fd_omode   = req->req_omode & O_ACCMODE;
   o->o_fd->fd_dev_id  = devfile.dev_id;
   o->o_mode           = req->req_omode;
+  o->o_ra_pos         = 0;
+  o->o_ra_end         = 0;
+  o->o_ra_window      = 0;
 
   if (debug)
     cprintf("sending success, page %08lx\n", (unsigned long)o->o_fd);
@@ -187,6 +197,37 @@ serve_set_size(envid_t envid, struct Fsreq_set_size *req) {
   return file_set_size(o->o_file, req->req_size);
 }
 
+// Read-ahead decided on by the request being served.  serve() does
+// it after sending the reply, so the client does not wait for it.
+static struct File *ra_file;
+static uint32_t ra_start, ra_nblocks;
+
+// Having read n bytes at offset from o, read ahead if o is being read
+// sequentially: every read that starts where the last one ended
+// doubles the window.  Blocks are fetched once fewer than half a
+// window of them are left ahead of the reader, so the disk sees a
+// few big reads rather than one per request.
+static void
+readahead(struct OpenFile *o, off_t offset, size_t n) {
+  uint32_t next = (offset + n + BLKSIZE - 1) / BLKSIZE, start;
+
+  if (offset == o->o_ra_pos) {
+    o->o_ra_window = MIN(MAX(2 * o->o_ra_window, RA_MINWINDOW), RA_MAXWINDOW);
+  } else {
+    o->o_ra_window = 0;
+    o->o_ra_end    = 0;
+  }
+  o->o_ra_pos = offset + n;
+  if (!o->o_ra_window || o->o_ra_end >= next + o->o_ra_window / 2)
+    return;
+
+  start       = MAX(o->o_ra_end, next);
+  ra_file     = o->o_file;
+  ra_start    = start;
+  ra_nblocks  = next + o->o_ra_window - start;
+  o->o_ra_end = next + o->o_ra_window;
+}
+
 // Read at most ipc->read.req_n bytes from the current seek position
 // in ipc->read.req_fileid.  Return the bytes read from the file to
 // the caller in ipc->readRet, then update the seek position.  Returns
@@ -209,6 +250,7 @@ serve_read(envid_t envid, union Fsipc *ipc) {
 
   int count = file_read(o->o_file, ret->ret_buf, req->req_n, o->o_fd->fd_offset);
   if (count > 0) {
+    readahead(o, o->o_fd->fd_offset, count);
     o->o_fd->fd_offset += count;
   }
   return count;
@@ -273,34 +315,106 @@ serve_flush(envid_t envid, struct Fsreq_flush *req) {
   return 0;
 }
 
+// Remove the file named by req->req_path.  Returns -E_BUSY while any
+// client has it open: its OpenFile points at the File's directory
+// slot, which file_remove frees for the next file created.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req) {
+  char path[MAXPATHLEN];
+  struct File *f;
+  int i, r;
+
+  if (debug)
+    cprintf("serve_remove %08x %s\n", envid, req->req_path);
+
+  // Copy in the path, making sure it's null-terminated
+  memmove(path, req->req_path, MAXPATHLEN);
+  path[MAXPATHLEN - 1] = 0;
+
+  if ((r = file_open(path, &f)) < 0)
+    return r;
+  for (i = 0; i < MAXOPEN; i++) {
+    if (pageref(opentab[i].o_fd) > 1 && opentab[i].o_file == f)
+      return -E_BUSY;
+  }
+  return file_remove(path);
+}
+
 int
 serve_sync(envid_t envid, union Fsipc *req) {
   fs_sync();
   return 0;
 }
 
+// Return the server's statistics in ipc->statsRet.
+int
+serve_stats(envid_t envid, union Fsipc *ipc) {
+  if (debug)
+    cprintf("serve_stats %08x\n", envid);
+
+  memset(&ipc->statsRet, 0, sizeof(ipc->statsRet));
+  fs_get_stats(&ipc->statsRet);
+  bc_get_stats(&ipc->statsRet);
+  disk_get_stats(&ipc->statsRet);
+  return 0;
+}
+
+// Resize the block cache.
+int
+serve_set_cache(envid_t envid, struct Fsreq_set_cache *req) {
+  if (debug)
+    cprintf("serve_set_cache %08x %u\n", envid, req->req_nblocks);
+
+  return bc_set_capacity(req->req_nblocks);
+}
+
+// Turn disk DMA on or off.
+int
+serve_set_dma(envid_t envid, struct Fsreq_set_dma *req) {
+  if (debug)
+    cprintf("serve_set_dma %08x %d\n", envid, req->req_on);
+
+  return disk_set_dma(req->req_on);
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
     // Open is handled specially because it passes pages
     /* [FSREQ_OPEN] =	(fshandler)serve_open, */
-    [FSREQ_READ]     = serve_read,
-    [FSREQ_STAT]     = serve_stat,
-    [FSREQ_FLUSH]    = (fshandler)serve_flush,
-    [FSREQ_WRITE]    = (fshandler)serve_write,
-    [FSREQ_SET_SIZE] = (fshandler)serve_set_size,
-    [FSREQ_SYNC]     = serve_sync};
+    [FSREQ_READ]      = serve_read,
+    [FSREQ_STAT]      = serve_stat,
+    [FSREQ_FLUSH]     = (fshandler)serve_flush,
+    [FSREQ_WRITE]     = (fshandler)serve_write,
+    [FSREQ_SET_SIZE]  = (fshandler)serve_set_size,
+    [FSREQ_REMOVE]    = (fshandler)serve_remove,
+    [FSREQ_SYNC]      = serve_sync,
+    [FSREQ_STATS]     = serve_stats,
+    [FSREQ_SET_CACHE] = (fshandler)serve_set_cache,
+    [FSREQ_SET_DMA]   = (fshandler)serve_set_dma};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
 void
 serve(void) {
   uint32_t req, whom;
-  int perm, r;
+  int perm, r, now, next_wb = 0;
   void *pg;
 
   while (1) {
+    // Between requests, write back when it is due.  With nothing left
+    // dirty, sleep until the next request.
+    now = vsys_gettime();
+    if (next_wb && now >= next_wb)
+      next_wb = fs_writeback(WB_AGE) ? now + WB_INTERVAL : 0;
+
     perm = 0;
-    req  = ipc_recv((int32_t *)&whom, fsreq, &perm);
+    r    = ipc_recv_timeout((int32_t *)&whom, fsreq, &perm,
+                            next_wb ? (next_wb - now) * 1000000000ULL : IPC_NO_TIMEOUT);
+    if (r < 0)
+      continue;
+    req = r;
+    if (!next_wb)
+      next_wb = vsys_gettime() + WB_INTERVAL;
     if (debug)
       cprintf("fs req %d from %08x [page %08lx: %s]\n",
               req, whom, (unsigned long)uvpt[PGNUM(fsreq)],
@@ -324,6 +438,11 @@ serve(void) {
     }
     ipc_send(whom, r, pg, perm);
     sys_page_unmap(0, fsreq);
+
+    if (ra_nblocks) {
+      file_prefetch(ra_file, ra_start, ra_nblocks);
+      ra_nblocks = 0;
+    }
   }
 }
 
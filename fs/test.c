@@ -15,22 +15,22 @@ check_consistency(void) {
 void
 check_dir(struct File *dir) {
   int r, i, j, k;
-  uint32_t *blk;
+  uint32_t blk, n;
   struct File *files;
 
   uint32_t nblock = dir->f_size / BLKSIZE;
   for (i = 0; i < nblock; ++i) {
 
-    if ((r = file_block_walk(dir, i, &blk, 0)) < 0) {
+    if ((r = file_map_run(dir, i, &blk, &n, 1)) < 0 || blk == 0) {
       continue;
     }
 
-    files = (struct File *)diskaddr(*blk);
+    files = (struct File *)diskaddr(blk);
 
     for (j = 0; j < BLKFILES; ++j) {
       struct File *f = &(files[j]);
       if (strcmp(f->f_name, "\0") != 0) {
-        uint32_t *pdiskbno = NULL;
+        uint32_t diskbno;
 
         cprintf("checking consistency of %s\n", f->f_name);
 
@@ -38,22 +38,169 @@ check_dir(struct File *dir) {
           if (f->f_type == FTYPE_DIR) {
             check_dir(f);
           }
-          if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+          if (file_map_run(f, k, &diskbno, &n, 1) < 0 || diskbno == 0) {
             continue;
           }
-          assert(!block_is_free(*pdiskbno));
+          assert(!block_is_free(diskbno));
         }
       }
     }
   }
 }
 
+// Build an extent file whose blocks are scattered over the disk,
+// check that it reads back, and free it again.
+static void
+check_extents(void) {
+  static const int nblocks = 48;
+  struct File *f;
+  char *blk, c;
+  uint32_t diskbno, n, nfree = 0, i, freed;
+  int r, pass, b;
+  struct Fsret_stats st, small;
+
+  if ((r = file_create("/extent-test", &f)) < 0)
+    panic("file_create /extent-test: %i", r);
+  for (i = 0; i < super->s_nblocks; i++)
+    nfree += block_is_free(i);
+  if (nfree < 2 * nblocks) {
+    file_remove("/extent-test");
+    return;
+  }
+
+  f->f_flags = FILE_EXTENTS;
+  if ((r = file_set_size(f, nblocks * BLKSIZE)) < 0)
+    panic("file_set_size: %i", r);
+
+  // Odd blocks first, then even ones, so that neighbours in the file
+  // are not neighbours on disk and the root has to grow a leaf.
+  for (pass = 1; pass >= 0; pass--) {
+    for (b = pass; b < nblocks; b += 2) {
+      if ((r = file_get_block(f, b, &blk)) < 0)
+        panic("file_get_block %d: %i", b, r);
+      memset(blk, b, BLKSIZE);
+    }
+  }
+  for (b = 0; b < nblocks; b++) {
+    assert(file_map_run(f, b, &diskbno, &n, nblocks) == 0 && diskbno != 0);
+    assert(!block_is_free(diskbno));
+    assert(*(char *)diskaddr(diskbno) == (char)b);
+  }
+  freed = diskbno;
+
+  // Touch twice as many blocks in use as the smallest cache allowed
+  // holds, which has to write blocks out and evict them to make room,
+  // then read the file back.  Bounded so boot time does not grow with
+  // the disk.
+  bc_get_stats(&st);
+  if ((r = bc_set_capacity(BC_MINCAP)) < 0)
+    panic("bc_set_capacity: %i", r);
+  for (i = 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE, n = 0;
+       i < super->s_nblocks && n < 2 * BC_MINCAP; i++) {
+    if (!block_is_free(i)) {
+      c = *(volatile char *)diskaddr(i);
+      n++;
+    }
+  }
+  for (b = 0; b < nblocks; b++) {
+    if ((r = file_read(f, &c, 1, b * BLKSIZE)) != 1 || c != (char)b)
+      panic("file_read %d through a small cache: %i", b, r);
+  }
+  bc_get_stats(&small);
+  assert(small.ret_bc_cached <= BC_MINCAP);
+  assert(n <= BC_MINCAP || small.ret_bc_evictions > st.ret_bc_evictions);
+  if ((r = bc_set_capacity(st.ret_bc_capacity)) < 0)
+    panic("bc_set_capacity: %i", r);
+
+  // Rewriting a block in place must not remap it.
+  if ((r = file_write(f, "x", 1, 5 * BLKSIZE)) != 1)
+    panic("file_write: %i", r);
+  if ((r = file_read(f, &c, 1, 5 * BLKSIZE)) != 1 || c != 'x')
+    panic("file_read: %i", r);
+
+  if ((r = file_set_size(f, 3 * BLKSIZE)) < 0)
+    panic("file_set_size: %i", r);
+  assert(f->f_exthdr.eh_depth == 0);
+  assert(file_map_run(f, 3, &diskbno, &n, 1) == 0 && diskbno == 0);
+  file_set_size(f, 0);
+  assert(f->f_exthdr.eh_nent == 0);
+  if ((r = file_remove("/extent-test")) < 0)
+    panic("file_remove: %i", r);
+  assert(file_open("/extent-test", &f) == -E_NOT_FOUND);
+
+  // Freed blocks are only marked free once nothing on disk uses them.
+  assert(!block_is_free(freed));
+  fs_sync();
+  assert(block_is_free(freed));
+
+  for (i = 0; i < super->s_nblocks; i++)
+    nfree -= block_is_free(i);
+  assert(nfree == 0);
+  cprintf("extent files are good\n");
+}
+
+// Write a pattern to a few blocks with all the transfers in flight
+// at once, read it back the same way, and compare.  The blocks are
+// allocated through the file system, which never hands out one still
+// waiting to be freed, and any the cache has a page for is left out,
+// so that the raw writes cannot go stale under a cached copy.
+static void
+check_disk(void) {
+  static const int nblocks = 8;
+  uint32_t blocks[nblocks], i;
+  char *buf = (char *)(2 * PGSIZE);
+  int r, b, tries;
+
+  for (b = 0, tries = 0; b < nblocks && tries < 4 * nblocks; tries++) {
+    if ((r = alloc_block()) < 0)
+      break;
+    if (va_is_mapped(diskaddr(r)))
+      free_block(r);
+    else
+      blocks[b++] = r;
+  }
+  if (b < nblocks) {
+    while (b > 0)
+      free_block(blocks[--b]);
+    fs_sync();
+    return;
+  }
+
+  for (b = 0; b < nblocks; b++) {
+    if ((r = sys_page_alloc(0, buf + b * BLKSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+      panic("sys_page_alloc: %i", r);
+    memset(buf + b * BLKSIZE, 'a' + b, BLKSIZE);
+  }
+  for (b = 0; b < nblocks; b++) {
+    if ((r = disk_submit(blocks[b] * BLKSECTS, buf + b * BLKSIZE, BLKSECTS, 1)) < 0)
+      panic("disk_submit write %d: %i", b, r);
+  }
+  if ((r = disk_wait()) < 0)
+    panic("disk_wait after writes: %i", r);
+
+  memset(buf, 0, nblocks * BLKSIZE);
+  for (b = 0; b < nblocks; b++) {
+    if ((r = disk_submit(blocks[b] * BLKSECTS, buf + b * BLKSIZE, BLKSECTS, 0)) < 0)
+      panic("disk_submit read %d: %i", b, r);
+  }
+  if ((r = disk_wait()) < 0)
+    panic("disk_wait after reads: %i", r);
+  for (b = 0; b < nblocks; b++) {
+    for (i = 0; i < BLKSIZE; i++)
+      assert(buf[b * BLKSIZE + i] == 'a' + b);
+    sys_page_unmap(0, buf + b * BLKSIZE);
+    free_block(blocks[b]);
+  }
+  fs_sync();
+  cprintf("disk transfers in flight are good\n");
+}
+
 void
 fs_test(void) {
   struct File *f;
   int r;
   char *blk;
-  uint32_t *bits;
+  uint32_t *bits, diskbno, n;
 
   // back up bitmap
   if ((r = sys_page_alloc(0, (void *)PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
@@ -93,13 +240,15 @@ fs_test(void) {
 
   if ((r = file_set_size(f, 0)) < 0)
     panic("file_set_size: %i", r);
-  assert(f->f_direct[0] == 0);
+  assert(file_map_run(f, 0, &diskbno, &n, 1) == 0 && diskbno == 0);
+  assert((uvpt[PGNUM(f)] & PTE_D));
+  file_flush(f);
   assert(!(uvpt[PGNUM(f)] & PTE_D));
   cprintf("file_truncate is good\n");
 
   if ((r = file_set_size(f, strlen(msg))) < 0)
     panic("file_set_size 2: %i", r);
-  assert(!(uvpt[PGNUM(f)] & PTE_D));
+  assert((uvpt[PGNUM(f)] & PTE_D));
   if ((r = file_get_block(f, 0, &blk)) < 0)
     panic("file_get_block 2: %i", r);
   strcpy(blk, msg);
@@ -108,4 +257,20 @@ fs_test(void) {
   assert(!(uvpt[PGNUM(blk)] & PTE_D));
   assert(!(uvpt[PGNUM(f)] & PTE_D));
   cprintf("file rewrite is good\n");
+
+  // A directory that still has entries cannot be removed.
+  if ((r = file_create("/rmdir-test", &f)) < 0)
+    panic("file_create /rmdir-test: %i", r);
+  f->f_type = FTYPE_DIR;
+  if ((r = file_create("/rmdir-test/f", &f)) < 0)
+    panic("file_create /rmdir-test/f: %i", r);
+  assert(file_remove("/rmdir-test") == -E_NOT_EMPTY);
+  if ((r = file_remove("/rmdir-test/f")) < 0)
+    panic("file_remove /rmdir-test/f: %i", r);
+  if ((r = file_remove("/rmdir-test")) < 0)
+    panic("file_remove /rmdir-test: %i", r);
+  cprintf("file_remove of a directory is good\n");
+
+  check_extents();
+  check_disk();
 }
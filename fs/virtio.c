@@ -0,0 +1,316 @@
+/*
+ * virtio-blk driver, for the legacy interface of a PCI virtio block
+ * device such as QEMU's -drive if=virtio.
+ *
+ * Requests go through a single split virtqueue.  Each one takes one
+ * ring descriptor, pointing to an indirect table in the request's
+ * slot: the request header, one entry per physically contiguous piece
+ * of the buffer, and the status byte the device fills in.  Submitting
+ * a request only queues it; the device is told about a whole batch at
+ * once when the caller waits, or when every slot is in use.  The
+ * device interrupts as requests complete, which the kernel passes on
+ * as a POLLWAIT_DISK event.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define VIRTIO_VENDOR  0x1AF4
+#define VIRTIO_DEV_BLK 0x1001 // block device with a legacy interface
+
+// Legacy registers, from BAR0
+#define VIRTIO_HOST_FEATURES  0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN      0x08
+#define VIRTIO_QUEUE_NUM      0x0C
+#define VIRTIO_QUEUE_SEL      0x0E
+#define VIRTIO_QUEUE_NOTIFY   0x10
+#define VIRTIO_STATUS         0x12
+#define VIRTIO_ISR            0x13 // reading it acknowledges the interrupt
+#define VIRTIO_BLK_CAPACITY   0x14 // 64 bits, in sectors
+
+#define VIRTIO_ST_ACK       0x01
+#define VIRTIO_ST_DRIVER    0x02
+#define VIRTIO_ST_DRIVER_OK 0x04
+#define VIRTIO_ST_FAILED    0x80
+
+#define VIRTIO_F_INDIRECT_DESC (1 << 28)
+
+#define VRING_DESC_F_NEXT      1
+#define VRING_DESC_F_WRITE     2 // the device writes the buffer
+#define VRING_DESC_F_INDIRECT  4
+#define VRING_USED_F_NO_NOTIFY 1
+#define VRING_ALIGN            PGSIZE
+
+#define VIRTIO_BLK_T_IN  0
+#define VIRTIO_BLK_T_OUT 1
+#define VIRTIO_BLK_S_OK  0
+
+struct VringDesc {
+  uint64_t d_addr;
+  uint32_t d_len;
+  uint16_t d_flags;
+  uint16_t d_next;
+};
+
+struct VringAvail {
+  uint16_t a_flags;
+  uint16_t a_idx;
+  uint16_t a_ring[];
+};
+
+struct VringUsed {
+  uint16_t u_flags;
+  uint16_t u_idx;
+  struct {
+    uint32_t ue_id;
+    uint32_t ue_len;
+  } u_ring[];
+};
+
+// Most pieces a buffer can be in: one per page of the largest request
+#define VIRTIO_MAXSEGS (256 * SECTSIZE / PGSIZE)
+
+// Most requests in flight at a time
+#define VIRTIO_MAXREQS 64
+
+// A request's slot, in memory the device reads and writes.  Slots
+// follow each other, and each starts with an indirect descriptor
+// table, which must be 16-byte aligned.
+struct VirtioReq {
+  struct VringDesc r_desc[VIRTIO_MAXSEGS + 2];
+  struct {
+    uint32_t h_type;
+    uint32_t h_reserved;
+    uint64_t h_sector;
+  } r_hdr;
+  uint8_t r_status;
+} __attribute__((aligned(16)));
+
+// Where the queue and, above it, the request slots are mapped: below
+// ide.c's PRD table page
+#define VIRTIO_VA      (DISKMAP - 64 * PGSIZE)
+#define VIRTIO_RINGMAX (32 * PGSIZE)
+
+// How long to wait for the device to complete anything
+#define VIRTIO_TIMEOUT 2000000000ULL // ns
+
+#define barrier() __asm __volatile("" ::: "memory")
+
+static uint16_t iobase;
+static uint16_t qsize; // entries in the queue
+static struct VringDesc *desc;
+static volatile struct VringAvail *avail;
+static volatile struct VringUsed *used;
+static uint16_t last_used;  // used ring entries retired
+static uint16_t unnotified; // requests the device has not been told about
+
+static volatile struct VirtioReq *reqs;
+static physaddr_t reqs_pa;
+static uint16_t free_slots[VIRTIO_MAXREQS], nfree;
+static int ninflight;
+static bool irq_ok; // the kernel delivers the device's interrupts
+static bool failed; // some request failed since the last virtio_blk_wait
+
+static uint64_t nreqs;
+static uint32_t max_inflight;
+
+static bool
+virtio_blk_fail(const char *why) {
+  outb(iobase + VIRTIO_STATUS, VIRTIO_ST_FAILED);
+  cprintf("virtio-blk: %s, not using it\n", why);
+  return 0;
+}
+
+// Look on PCI bus 0 for a virtio block device and set it up.
+// Returns whether there is one to use.
+bool
+virtio_blk_init(void) {
+  size_t availend, ringsize;
+  uint64_t capacity;
+  physaddr_t pa;
+  int dev, irq, i, r;
+
+  for (dev = 0; dev < 32; dev++) {
+    if (pci_conf_read(dev, 0, PCI_ID) == (VIRTIO_DEV_BLK << 16 | VIRTIO_VENDOR))
+      break;
+  }
+  if (dev == 32 || !(pci_conf_read(dev, 0, PCI_BAR(0)) & 1))
+    return 0;
+  iobase = pci_conf_read(dev, 0, PCI_BAR(0)) & 0xFFFC;
+  irq    = pci_conf_read(dev, 0, PCI_INTR) & 0xFF;
+  pci_enable(dev, 0);
+
+  outb(iobase + VIRTIO_STATUS, 0);
+  outb(iobase + VIRTIO_STATUS, VIRTIO_ST_ACK);
+  outb(iobase + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER);
+  if (!(inl(iobase + VIRTIO_HOST_FEATURES) & VIRTIO_F_INDIRECT_DESC))
+    return virtio_blk_fail("no indirect descriptors");
+  outl(iobase + VIRTIO_GUEST_FEATURES, VIRTIO_F_INDIRECT_DESC);
+
+  // The legacy layout: descriptors and the available ring, then the
+  // used ring on the next VRING_ALIGN boundary, all in one piece.
+  outw(iobase + VIRTIO_QUEUE_SEL, 0);
+  qsize    = inw(iobase + VIRTIO_QUEUE_NUM);
+  availend = qsize * sizeof(struct VringDesc) + sizeof(struct VringAvail) +
+             (qsize + 1) * sizeof(uint16_t);
+  ringsize = ROUNDUP(ROUNDUP(availend, VRING_ALIGN) + sizeof(struct VringUsed) +
+                         qsize * sizeof(used->u_ring[0]) + sizeof(uint16_t),
+                     PGSIZE);
+  if (!qsize || ringsize > VIRTIO_RINGMAX)
+    return virtio_blk_fail("bad queue size");
+  if ((r = sys_page_alloc_dma((void *)VIRTIO_VA, ringsize / PGSIZE, PTE_W, &pa)) < 0)
+    panic("virtio_blk_init: queue: %i", r);
+  desc  = (struct VringDesc *)VIRTIO_VA;
+  avail = (struct VringAvail *)(desc + qsize);
+  used  = (struct VringUsed *)(VIRTIO_VA + ROUNDUP(availend, VRING_ALIGN));
+  outl(iobase + VIRTIO_QUEUE_PFN, pa >> PGSHIFT);
+
+  nfree = MIN(qsize, VIRTIO_MAXREQS);
+  if ((r = sys_page_alloc_dma((void *)(VIRTIO_VA + VIRTIO_RINGMAX),
+                              ROUNDUP(nfree * sizeof(struct VirtioReq), PGSIZE) / PGSIZE,
+                              PTE_W, &reqs_pa)) < 0)
+    panic("virtio_blk_init: request slots: %i", r);
+  reqs = (struct VirtioReq *)(VIRTIO_VA + VIRTIO_RINGMAX);
+  for (i = 0; i < nfree; i++) {
+    free_slots[i]   = i;
+    desc[i].d_addr  = reqs_pa + i * sizeof(struct VirtioReq);
+    desc[i].d_flags = VRING_DESC_F_INDIRECT;
+  }
+
+  // Without the interrupt, waiting polls the queue.
+  if (!(irq_ok = sys_disk_irq(irq) == 0))
+    cprintf("virtio-blk: no IRQ %d, polling\n", irq);
+  outb(iobase + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER | VIRTIO_ST_DRIVER_OK);
+
+  capacity = inl(iobase + VIRTIO_BLK_CAPACITY) |
+             (uint64_t)inl(iobase + VIRTIO_BLK_CAPACITY + 4) << 32;
+  cprintf("virtio-blk: %ld MB, %d requests in flight at most\n",
+          (long)(capacity * SECTSIZE >> 20), nfree);
+  return 1;
+}
+
+static void
+virtio_blk_notify(void) {
+  barrier();
+  if (unnotified && !(used->u_flags & VRING_USED_F_NO_NOTIFY))
+    outw(iobase + VIRTIO_QUEUE_NOTIFY, 0);
+  unnotified = 0;
+}
+
+// Tell the device about the requests queued so far and retire those
+// it has completed.  With 'block', first wait until there is one.
+// Returns 0, or -E_TIMEOUT if the device seems to have stopped.
+static int
+virtio_blk_reap(bool block) {
+  uint16_t slot;
+  uint64_t now, deadline = 0;
+
+  virtio_blk_notify();
+  while (block && last_used == used->u_idx) {
+    // Acknowledge before looking, so that a completion after the
+    // look interrupts again.
+    inb(iobase + VIRTIO_ISR);
+    if (last_used != used->u_idx)
+      break;
+    // One deadline for the whole wait, polled or not, so that
+    // neither spurious wakeups nor a missing IRQ can stretch it.
+    now = vsys_clock_ns();
+    if (!deadline)
+      deadline = now + VIRTIO_TIMEOUT;
+    else if (now >= deadline)
+      return -E_TIMEOUT;
+    if (!irq_ok)
+      sys_yield();
+    else
+      sys_poll_wait(NULL, 0, POLLWAIT_DISK, deadline - now);
+  }
+
+  for (; last_used != used->u_idx; last_used++) {
+    barrier();
+    slot = used->u_ring[last_used % qsize].ue_id;
+    if (reqs[slot].r_status != VIRTIO_BLK_S_OK)
+      failed = 1;
+    free_slots[nfree++] = slot;
+    ninflight--;
+  }
+  return 0;
+}
+
+// Queue a transfer of nsecs sectors between sector secno and buf,
+// which must be whole pages.  buf must stay mapped until
+// virtio_blk_wait returns.
+// Returns 0, or < 0 if buf is unsuitable or the device stopped.
+int
+virtio_blk_submit(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  physaddr_t pa[VIRTIO_MAXSEGS], end = 0, slot_pa;
+  size_t npages = nsecs * SECTSIZE / PGSIZE, i;
+  volatile struct VirtioReq *req;
+  uint16_t slot, n = 1;
+  int r;
+
+  if ((uintptr_t)buf % PGSIZE || (nsecs * SECTSIZE) % PGSIZE ||
+      !npages || npages > VIRTIO_MAXSEGS)
+    return -E_INVAL;
+  if ((r = sys_page_phys(buf, npages, pa)) < 0)
+    return r;
+  while (!nfree) {
+    if ((r = virtio_blk_reap(1)) < 0)
+      return r;
+  }
+
+  slot    = free_slots[--nfree];
+  req     = &reqs[slot];
+  slot_pa = reqs_pa + slot * sizeof(struct VirtioReq);
+
+  req->r_hdr.h_type     = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  req->r_hdr.h_reserved = 0;
+  req->r_hdr.h_sector   = secno;
+  req->r_status         = 0xFF;
+  req->r_desc[0]        = (struct VringDesc){slot_pa + __builtin_offsetof(struct VirtioReq, r_hdr),
+                                      sizeof(req->r_hdr), VRING_DESC_F_NEXT, 1};
+  for (i = 0; i < npages; i++) {
+    if (n > 1 && pa[i] == end) {
+      req->r_desc[n - 1].d_len += PGSIZE;
+    } else {
+      req->r_desc[n] = (struct VringDesc){pa[i], PGSIZE,
+                                          VRING_DESC_F_NEXT | (write ? 0 : VRING_DESC_F_WRITE), n + 1};
+      n++;
+    }
+    end = pa[i] + PGSIZE;
+  }
+  req->r_desc[n++] = (struct VringDesc){slot_pa + __builtin_offsetof(struct VirtioReq, r_status),
+                                        1, VRING_DESC_F_WRITE, 0};
+
+  desc[slot].d_len = n * sizeof(struct VringDesc);
+  avail->a_ring[avail->a_idx % qsize] = slot;
+  barrier();
+  avail->a_idx++;
+
+  unnotified++;
+  nreqs++;
+  max_inflight = MAX(max_inflight, (uint32_t)++ninflight);
+  return 0;
+}
+
+// Wait until every request submitted so far is done.
+// Returns 0, -1 if any of them failed, or -E_TIMEOUT.
+int
+virtio_blk_wait(void) {
+  int r;
+
+  while (ninflight) {
+    if ((r = virtio_blk_reap(1)) < 0)
+      return r;
+  }
+  r      = failed ? -1 : 0;
+  failed = 0;
+  return r;
+}
+
+void
+virtio_blk_get_stats(struct Fsret_stats *st) {
+  st->ret_disk_virtio         = 1;
+  st->ret_virtio_reqs         = nreqs;
+  st->ret_virtio_max_inflight = max_inflight;
+}
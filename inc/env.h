@@ -6,6 +6,7 @@
 #include <inc/types.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
+#include <inc/syscall.h>
 
 typedef int32_t envid_t;
 extern pml4e_t *kern_pml4e;
@@ -62,8 +63,13 @@ struct Env {
   pml4e_t *env_pml4e; // Kernel virtual address of page dir
   physaddr_t env_cr3;
 
+  // FPU/SIMD registers, saved lazily (see kern/fpu.c); NULL until
+  // the env first uses them
+  void *env_fpu;
+
   // Exception handling
   void *env_pgfault_upcall; // Page fault upcall entry point
+  uintptr_t env_uxstacktop; // Top of this env's exception stack
 
   // Lab 9 IPC
   bool env_ipc_recving;   // Env is blocked receiving
@@ -71,6 +77,24 @@ struct Env {
   uint32_t env_ipc_value; // Data value sent to us
   envid_t env_ipc_from;   // envid of the sender
   int env_ipc_perm;       // Perm of page mapping received
+
+  // Timed waits (IPC receive and futex)
+  uint64_t env_deadline; // TSC value at which the wait gives up,
+                         // 0 if it waits forever
+
+  // Exit status and sys_env_wait
+  int env_exit_status;         // Status reported to waiters
+  struct Env *env_waiters;     // Envs blocked waiting for us to exit
+  struct Env *env_wait_link;   // Next env in the same wait queue
+  struct Env *env_waiting_on;  // Env we are blocked on, if any
+
+  bool env_cons_wait; // Blocked in sys_cons_read waiting for input
+
+  // Futex and poll waits
+  physaddr_t env_futex_keys[FUTEX_MAXKEYS]; // Physical addresses of the
+                                            // futex words we sleep on
+  int env_futex_nkeys;
+  int env_poll_flags; // POLLWAIT_* events that also wake us
 };
 
 #endif // !JOS_INC_ENV_H
@@ -29,6 +29,10 @@ enum {
   E_NOT_EXEC    = 17, // File not a valid executable
   E_NOT_SUPP    = 18, // Operation not supported
 
+  E_TIMEOUT   = 19, // Timed out waiting for an event
+  E_NOT_EMPTY = 20, // Directory is not empty
+  E_BUSY      = 21, // Lock or resource is held by someone else
+
   MAXERROR
 };
 
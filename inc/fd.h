@@ -7,10 +7,18 @@
 
 #include <inc/types.h>
 #include <inc/fs.h>
+#include <inc/syscall.h>
 
 struct Fd;
 struct Stat;
 struct Dev;
+struct PollWait;
+
+// Maximum number of file descriptors a program may hold open concurrently
+#define MAXFD 32
+
+// Size of the data area reserved for each file descriptor (see fd2data).
+#define FDDATASIZE (32 * PGSIZE)
 
 // Per-device-class file descriptor operations
 struct Dev {
@@ -21,12 +29,44 @@ struct Dev {
   int (*dev_close)(struct Fd *fd);
   int (*dev_stat)(struct Fd *fd, struct Stat *stat);
   int (*dev_trunc)(struct Fd *fd, off_t length);
+  // Return which of POLLIN/POLLOUT in 'events' are ready, plus POLLHUP.
+  // If none are, add what to sleep on until they might be to 'w'.
+  int (*dev_poll)(struct Fd *fd, int events, struct PollWait *w);
+};
+
+// poll
+struct pollfd {
+  int fd;      // file descriptor, or POLLFD_IPC
+  int events;  // requested events
+  int revents; // returned events
 };
 
+#define POLLIN   0x1 // data to read
+#define POLLOUT  0x2 // room to write
+#define POLLHUP  0x4 // the other end is gone
+#define POLLNVAL 0x8 // fd is not open
+
+// With POLLIN, ready when another env tries to send us IPC;
+// the sender gets through once we call ipc_recv.
+#define POLLFD_IPC (-2)
+
+// What poll sleeps on: futex words and kernel events (POLLWAIT_*).
+struct PollWait {
+  struct PollKey pw_keys[FUTEX_MAXKEYS];
+  int pw_nkeys;
+  int pw_flags;
+};
+
+int pollwait_key(struct PollWait *w, volatile uint32_t *addr);
+
 struct FdFile {
   int id;
 };
 
+struct FdCons {
+  int mode; // CONS_RAW or CONS_COOKED
+};
+
 struct Fd {
   int fd_dev_id;
   off_t fd_offset;
@@ -34,6 +74,8 @@ struct Fd {
   union {
     // File server files
     struct FdFile fd_file;
+    // Console
+    struct FdCons fd_cons;
   };
 };
 
@@ -26,21 +26,65 @@
 
 #define MAXFILESIZE ((NDIRECT + NINDIRECT) * BLKSIZE)
 
+// Extent files (FILE_EXTENTS) map their blocks with extents instead.
+// An extent maps a run of consecutive file blocks to consecutive disk
+// blocks.  Extents are kept sorted in a tree whose root lives in the
+// File and holds up to NEXTENT_ROOT entries.  The other nodes fill a
+// block each.  Entries of interior nodes index their children by the
+// first file block each child maps.
+struct Extent {
+  uint32_t e_fileblk; // first file block
+  uint32_t e_diskblk; // first disk block, or the child's block
+  uint32_t e_len;     // number of blocks; 0 in an interior node
+} __attribute__((packed)); // so it can be pointed to inside struct File
+
+struct ExtentHeader {
+  uint16_t eh_nent;  // entries in use
+  uint16_t eh_depth; // height above the leaves; 0 in a leaf
+} __attribute__((packed));
+
+#define NEXTENT_ROOT 9
+#define NEXTENT_NODE ((BLKSIZE - sizeof(struct ExtentHeader)) / sizeof(struct Extent))
+#define EXT_MAXDEPTH 3
+
+// The largest block-aligned size that fits in an off_t.
+#define MAXEXTFILESIZE 0x7FFFF000
+
 struct File {
   char f_name[MAXNAMELEN]; // filename
   off_t f_size;            // file size in bytes
   uint32_t f_type;         // file type
 
-  // Block pointers.
-  // A block is allocated iff its value is != 0.
-  uint32_t f_direct[NDIRECT]; // direct blocks
-  uint32_t f_indirect;        // indirect block
+  union {
+    // Block pointers.
+    // A block is allocated iff its value is != 0.
+    struct {
+      uint32_t f_direct[NDIRECT]; // direct blocks
+      uint32_t f_indirect;        // indirect block
+    };
+    // Extent tree root, if f_flags has FILE_EXTENTS
+    struct {
+      struct ExtentHeader f_exthdr;
+      struct Extent f_extent[NEXTENT_ROOT];
+    };
+  };
+  uint32_t f_flags; // FILE_*
 
   // Pad out to 256 bytes; must do arithmetic in case we're compiling
   // fsformat on a 64-bit machine.
-  uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 * NDIRECT - 4];
+  uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 - sizeof(struct ExtentHeader) -
+                NEXTENT_ROOT * sizeof(struct Extent)];
 } __attribute__((packed)); // required only on some 64-bit machines
 
+// A node of an extent tree other than the root
+struct ExtentNode {
+  struct ExtentHeader en_hdr;
+  struct Extent en_extent[NEXTENT_NODE];
+};
+
+// File flags
+#define FILE_EXTENTS 0x1 // blocks are mapped by f_exthdr and f_extent
+
 // An inode block contains exactly BLKFILES 'struct File's
 #define BLKFILES (BLKSIZE / sizeof(struct File))
 
@@ -56,8 +100,13 @@ struct Super {
   uint32_t s_magic;   // Magic number: FS_MAGIC
   uint32_t s_nblocks; // Total number of blocks on disk
   struct File s_root; // Root directory node
+  uint32_t s_flags;   // FS_*
+  uint32_t s_nfree;   // Number of free blocks, as of the last sync
 };
 
+// Super block flags
+#define FS_EXTENTS 0x1 // new files are extent files
+
 // Definitions for requests from clients to file system
 enum {
   FSREQ_OPEN = 1,
@@ -69,7 +118,11 @@ enum {
   FSREQ_STAT,
   FSREQ_FLUSH,
   FSREQ_REMOVE,
-  FSREQ_SYNC
+  FSREQ_SYNC,
+  // Stats returns a Fsret_stats on the request page
+  FSREQ_STATS,
+  FSREQ_SET_CACHE,
+  FSREQ_SET_DMA
 };
 
 union Fsipc {
@@ -107,6 +160,32 @@ union Fsipc {
   struct Fsreq_remove {
     char req_path[MAXPATHLEN];
   } remove;
+  struct Fsret_stats {
+    // Path lookup cache
+    uint64_t ret_dcache_lookups;  // path components looked up
+    uint64_t ret_dcache_hits;     // of which were found in the cache
+    uint64_t ret_dcache_neg_hits; // of the hits, names known not to exist
+    uint32_t ret_dcache_size;     // entries
+    // Block cache
+    uint32_t ret_bc_capacity;  // blocks it may hold
+    uint32_t ret_bc_cached;    // blocks it holds
+    uint64_t ret_bc_hits;      // blocks reads and writes found cached
+    uint64_t ret_bc_misses;    // blocks read from disk
+    uint64_t ret_bc_evictions; // blocks evicted
+    // Disk
+    uint32_t ret_disk_virtio;         // virtio-blk, not IDE
+    uint32_t ret_ide_dma;             // transfers use DMA where they can
+    uint64_t ret_ide_dma_xfers;       // transfers done by DMA
+    uint64_t ret_ide_pio_xfers;       // transfers done by PIO
+    uint64_t ret_virtio_reqs;         // virtio-blk requests
+    uint32_t ret_virtio_max_inflight; // most of them in flight at once
+  } statsRet;
+  struct Fsreq_set_cache {
+    uint32_t req_nblocks;
+  } set_cache;
+  struct Fsreq_set_dma {
+    int req_on;
+  } set_dma;
 
   // Ensure Fsipc is one page
   char _pad[PGSIZE];
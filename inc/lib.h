@@ -38,7 +38,13 @@ void umain(int argc, char **argv);
 // libmain.c or entry.S
 extern const char *binaryname;
 extern const volatile int vsys[];
+#ifdef CONFIG_KSPACE
 extern const volatile struct Env *thisenv;
+#else
+// Threads share their globals, so the kernel publishes the id of
+// whichever env is running instead.
+#define thisenv (&envs[ENVX(vsys[VSYS_envid])])
+#endif
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
 
@@ -56,6 +62,8 @@ void sys_cputs(const char *string, size_t len);
 int sys_cgetc(void);
 envid_t sys_getenvid(void);
 int sys_env_destroy(envid_t);
+void sys_env_exit(int status);
+int sys_env_wait(envid_t envid, int *status);
 void sys_yield(void);
 static envid_t sys_exofork(void);
 int sys_env_set_status(envid_t env, int status);
@@ -67,9 +75,24 @@ int sys_page_map(envid_t src_env, void *src_pg,
 int sys_page_unmap(envid_t env, void *pg);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, int perm);
 int sys_ipc_recv(void *rcv_pg);
+int sys_ipc_recv_timeout(void *rcv_pg, uint64_t timeout);
 int sys_gettime(void);
+int sys_klog_read(char *buf, size_t len);
+int sys_cons_read(char *buf, size_t len, int mode);
+int sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout);
+int sys_futex_wake(volatile uint32_t *addr, int n);
+int sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout);
+envid_t sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                          uintptr_t arg0, uintptr_t arg1);
+void sys_thread_exit(int status);
+int sys_page_alloc_range(envid_t env, void *pg, size_t npages, int perm);
+int sys_page_clear_bits(void *pg, size_t npages, int bits);
+int sys_page_phys(void *pg, size_t npages, physaddr_t *pa);
+int sys_page_alloc_dma(void *pg, size_t npages, int perm, physaddr_t *pa);
+int sys_disk_irq(int irq);
 
 int vsys_gettime(void);
+uint64_t vsys_clock_ns(void);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -83,14 +106,41 @@ sys_exofork(void) {
 }
 
 // ipc.c
+#define IPC_NO_TIMEOUT (~0UL)
 void ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                         uint64_t timeout);
 envid_t ipc_find_env(enum EnvType type);
 
 // fork.c
 #define PTE_SHARE 0x400
 envid_t fork(void);
-envid_t sfork(void); // Challenge!
+envid_t sfork(void);
+
+// thread.c
+envid_t thread_create(void (*fn)(void *), void *arg);
+void thread_exit(int status);
+int thread_join(envid_t id, int *status);
+void *thread_pftemp(void);
+bool thread_is_uxstack(uintptr_t va);
+
+// uthread.c
+int uthread_create(void (*fn)(void *), void *arg);
+void uthread_yield(void);
+void uthread_exit(void);
+void uthread_run(void);
+int uthread_wait(int fd, int events);
+ssize_t uthread_read(int fd, void *buf, size_t n);
+ssize_t uthread_write(int fd, const void *buf, size_t n);
+int32_t uthread_ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+
+// malloc.c
+void *malloc(size_t size);
+void *calloc(size_t nmemb, size_t size);
+void *realloc(void *ptr, size_t size);
+void free(void *ptr);
+void malloc_stats(size_t *inuse, size_t *mapped);
 
 // fd.c
 int close(int fd);
@@ -102,12 +152,17 @@ ssize_t readn(int fd, void *buf, size_t nbytes);
 int dup(int oldfd, int newfd);
 int fstat(int fd, struct Stat *statbuf);
 int stat(const char *path, struct Stat *statbuf);
+#define POLL_NO_TIMEOUT FUTEX_NO_TIMEOUT
+int poll(struct pollfd *fds, int nfds, uint64_t timeout);
 
 // file.c
 int open(const char *path, int mode);
 int ftruncate(int fd, off_t size);
 int remove(const char *path);
 int sync(void);
+int fs_stats(struct Fsret_stats *st);
+int fs_set_cache(uint32_t nblocks);
+int fs_set_dma(bool on);
 
 // pageref.c
 int pageref(void *addr);
@@ -121,13 +176,48 @@ void cputchar(int c);
 int getchar(void);
 int iscons(int fd);
 int opencons(void);
+int consmode(int fd, int mode);
+
+// sync.c
+// These may live in PTE_SHARE pages to synchronize several envs,
+// but not in copy-on-write pages: a copy would no longer be shared.
+struct Mutex {
+  volatile uint32_t m_state; // 0 unlocked, 1 locked, 2 locked with waiters
+};
+struct Cond {
+  volatile uint32_t c_seq;
+};
+struct Semaphore {
+  volatile uint32_t s_value;
+  volatile uint32_t s_waiters;
+};
+#define MUTEX_INITIALIZER {0}
+#define COND_INITIALIZER  {0}
+void mutex_init(struct Mutex *m);
+void mutex_lock(struct Mutex *m);
+int mutex_trylock(struct Mutex *m);
+void mutex_unlock(struct Mutex *m);
+void cond_init(struct Cond *c);
+void cond_wait(struct Cond *c, struct Mutex *m);
+int cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout);
+void cond_signal(struct Cond *c);
+void cond_broadcast(struct Cond *c);
+void sem_init(struct Semaphore *s, uint32_t value);
+void sem_wait(struct Semaphore *s);
+int sem_trywait(struct Semaphore *s);
+int sem_timedwait(struct Semaphore *s, uint64_t timeout);
+void sem_post(struct Semaphore *s);
 
 // pipe.c
+#define PIPEBUFSIZ        (4 * PGSIZE - 64) // default, leaves room for the header
+#define PIPE_SMALL_BUFSIZ 32                // small to provoke races
 int pipe(int pipefds[2]);
+int pipe_size(int pipefds[2], size_t size);
 int pipeisclosed(int pipefd);
 
 // wait.c
 void wait(envid_t env);
+int waitpid(envid_t env, int *status);
 
 /* File open modes */
 #define O_RDONLY  0x0000 /* open for reading only */
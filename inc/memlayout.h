@@ -239,6 +239,9 @@ struct PageInfo {
   // boot_alloc do not have valid reference count fields.
 
   uint16_t pp_ref;
+
+  // Number of envs blocked in futex_wait on a word in this page.
+  uint16_t pp_futex;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -75,6 +75,7 @@
 #define PTE_A   0x020 // Accessed
 #define PTE_D   0x040 // Dirty
 #define PTE_PS  0x080 // Page Size
+#define PTE_PAT 0x080 // Page Attribute Table index (4K pages only)
 #define PTE_G   0x100 // Global
 #define PTE_MBZ 0x180 // Bits must be zero
 
@@ -101,6 +102,9 @@
 #define CR0_CD 0x40000000 // Cache Disable
 #define CR0_PG 0x80000000 // Paging
 
+#define CR4_OSXSAVE    0x00040000 // XSAVE and extended states enable
+#define CR4_OSXMMEXCPT 0x00000400 // Unmasked SIMD FP exceptions support
+#define CR4_OSFXSR     0x00000200 // FXSAVE/FXRSTOR and SSE enable
 #define CR4_PCE 0x00000100 // Performance counter enable
 #define CR4_MCE 0x00000040 // Machine Check Enable
 #define CR4_PSE 0x00000010 // Page Size Extensions
@@ -114,6 +118,19 @@
 #define EFER_MSR 0xC0000080
 #define EFER_LME 8
 
+// Page Attribute Table
+#define PAT_MSR 0x277
+#define PAT_UC  0x00 // Uncacheable
+#define PAT_WC  0x01 // Write-combining
+#define PAT_WT  0x04 // Write-through
+#define PAT_WP  0x05 // Write-protected
+#define PAT_WB  0x06 // Write-back
+#define PAT_UCM 0x07 // Uncacheable, overridable by MTRRs (UC-)
+#define PAT_ENTRY(i, type) ((uint64_t)(type) << ((i)*8))
+
+// CPUID.1:EDX feature flags
+#define CPUID_PAT 0x00010000
+
 // Eflags register
 #define FL_CF        0x00000001 // Carry Flag
 #define FL_PF        0x00000004 // Parity Flag
@@ -1,12 +1,16 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
   SYS_cputs = 0,
   SYS_cgetc,
   SYS_getenvid,
   SYS_env_destroy,
+  SYS_env_exit,
+  SYS_env_wait,
   SYS_page_alloc,
   SYS_page_map,
   SYS_page_unmap,
@@ -17,8 +21,54 @@ enum {
   SYS_yield,
   SYS_ipc_try_send,
   SYS_ipc_recv,
+  SYS_ipc_recv_timeout,
   SYS_gettime,
+  SYS_klog_read,
+  SYS_cons_read,
+  SYS_futex_wait,
+  SYS_futex_wake,
+  SYS_poll_wait,
+  SYS_thread_create,
+  SYS_thread_exit,
+  SYS_page_alloc_range,
+  SYS_page_clear_bits,
+  SYS_page_phys,
+  SYS_page_alloc_dma,
+  SYS_disk_irq,
   NSYSCALLS
 };
 
+// Modes for SYS_cons_read
+#define CONS_RAW    0 // Return whatever characters are available
+#define CONS_COOKED 1 // Echo and edit input, return a line at a time
+
+// Size of the kernel log ring in bytes, a power of two: the most
+// SYS_klog_read can return
+#define KLOG_BUFSIZE 16384
+
+// Timeout for SYS_futex_wait that never expires
+#define FUTEX_NO_TIMEOUT (~0UL)
+// Count for SYS_futex_wake that wakes every waiter
+#define FUTEX_WAKE_ALL 0x7fffffff
+
+// Most futex words one SYS_poll_wait can sleep on
+#define FUTEX_MAXKEYS 32
+
+// Most pages one SYS_page_alloc_range can map: one 256-sector disk
+// transfer's worth
+#define PAGE_ALLOC_RANGE_MAX 32
+
+// A futex word for SYS_poll_wait, and the value it must still hold
+// for the call to go to sleep
+struct PollKey {
+  volatile uint32_t *pk_addr;
+  uint32_t pk_val;
+};
+
+// Kernel events SYS_poll_wait can wait for besides futexes
+#define POLLWAIT_CONS        0x1 // console input is ready ...
+#define POLLWAIT_CONS_COOKED 0x2 // ... in CONS_COOKED mode
+#define POLLWAIT_IPC         0x4 // another env tries to send us IPC
+#define POLLWAIT_DISK        0x8 // the disk interrupted (fs server only)
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -4,6 +4,8 @@
 /* system call numbers */
 enum {
   VSYS_gettime,
+  VSYS_envid,
+  VSYS_tsc_khz,
   NVSYSCALLS
 };
 
@@ -35,6 +35,9 @@ static __inline uint64_t read_rbp(void) __attribute__((always_inline));
 static __inline uint64_t read_rsp(void) __attribute__((always_inline));
 static __inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp);
 static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+static __inline uint64_t rdmsr(uint32_t msr) __attribute__((always_inline));
+static __inline void wrmsr(uint32_t msr, uint64_t val) __attribute__((always_inline));
+static __inline void wbinvd(void) __attribute__((always_inline));
 
 static __inline void
 breakpoint(void) {
@@ -272,7 +275,7 @@ cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *e
   uint32_t eax, ebx, ecx, edx;
   asm volatile("cpuid"
                : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
-               : "a"(info));
+               : "a"(info), "c"(0));
   if (eaxp)
     *eaxp = eax;
   if (ebxp)
@@ -293,6 +296,28 @@ read_tsc(void) {
   return res;
 }
 
+static __inline uint64_t
+rdmsr(uint32_t msr) {
+  uint32_t lo, hi;
+  __asm __volatile("rdmsr"
+                   : "=a"(lo), "=d"(hi)
+                   : "c"(msr));
+  return (uint64_t)lo | ((uint64_t)hi << 32);
+}
+
+static __inline void
+wrmsr(uint32_t msr, uint64_t val) {
+  __asm __volatile("wrmsr"
+                   :
+                   : "c"(msr), "a"((uint32_t)val), "d"((uint32_t)(val >> 32)));
+}
+
+static __inline void
+wbinvd(void) {
+  __asm __volatile("wbinvd" ::
+                       : "memory");
+}
+
 static inline uint32_t
 xchg(volatile uint32_t *addr, uint32_t newval) {
   uint32_t result;
@@ -305,6 +330,86 @@ xchg(volatile uint32_t *addr, uint32_t newval) {
   return result;
 }
 
+// Store 'newval' in *addr if it holds 'oldval'.
+// Returns the value *addr held before.
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval) {
+  uint32_t result;
+
+  asm volatile("lock; cmpxchgl %2, %1"
+               : "=a"(result), "+m"(*addr)
+               : "r"(newval), "0"(oldval)
+               : "cc", "memory");
+  return result;
+}
+
+// Add 'delta' to *addr and return the value it held before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t delta) {
+  asm volatile("lock; xaddl %0, %1"
+               : "+r"(delta), "+m"(*addr)
+               :
+               : "cc", "memory");
+  return delta;
+}
+
+static inline void
+clts(void) {
+  asm volatile("clts");
+}
+
+// Set extended control register 'reg' (XCR0 is the XSAVE feature mask).
+static inline void
+xsetbv(uint32_t reg, uint64_t val) {
+  asm volatile("xsetbv"
+               :
+               : "c"(reg), "a"((uint32_t)val), "d"((uint32_t)(val >> 32)));
+}
+
+static inline uint64_t
+xgetbv(uint32_t reg) {
+  uint32_t lo, hi;
+  asm volatile("xgetbv"
+               : "=a"(lo), "=d"(hi)
+               : "c"(reg));
+  return (uint64_t)lo | ((uint64_t)hi << 32);
+}
+
+// Save and restore the FPU/SIMD state components in 'mask'
+// to and from the 64-byte aligned XSAVE area at 'area'.
+static inline void
+xsave(void *area, uint64_t mask) {
+  asm volatile("xsave64 (%0)"
+               :
+               : "r"(area), "a"((uint32_t)mask), "d"((uint32_t)(mask >> 32))
+               : "memory");
+}
+
+static inline void
+xrstor(const void *area, uint64_t mask) {
+  asm volatile("xrstor64 (%0)"
+               :
+               : "r"(area), "a"((uint32_t)mask), "d"((uint32_t)(mask >> 32))
+               : "memory");
+}
+
+// The same for x87 and SSE state only, to a 16-byte aligned area.
+static inline void
+fxsave(void *area) {
+  asm volatile("fxsave64 (%0)"
+               :
+               : "r"(area)
+               : "memory");
+}
+
+static inline void
+fxrstor(const void *area) {
+  asm volatile("fxrstor64 (%0)"
+               :
+               : "r"(area)
+               : "memory");
+}
+
 #define NMI_LOCK 0x80
 
 static inline void
@@ -5,11 +5,15 @@
 #include <inc/kbdreg.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/syscall.h>
 
 #include <kern/console.h>
+#include <kern/klog.h>
 #include <kern/picirq.h>
 #include <inc/uefi.h>
 #include <kern/pmap.h>
+#include <kern/env.h>
+#include <kern/futex.h>
 
 static bool graphics_exists = false;
 static uint32_t uefi_vres;
@@ -19,7 +23,6 @@ static uint32_t crt_cols;
 static uint32_t crt_size;
 
 static void cons_intr(int (*proc)(void));
-static void cons_putc(int c);
 
 // Stupid I/O delay routine necessitated by historical PC design flaws
 static void
@@ -40,8 +43,13 @@ delay(void) {
 #define COM_DLM       1    // Out: Divisor Latch High (DLAB=1)
 #define COM_IER       1    // Out: Interrupt Enable Register
 #define COM_IER_RDI   0x01 //   Enable receiver data interrupt
+#define COM_IER_THRI  0x02 //   Enable transmitter holding register empty interrupt
 #define COM_IIR       2    // In:	Interrupt ID Register
 #define COM_FCR       2    // Out: FIFO Control Register
+#define COM_FCR_ENABLE 0x01 //   Enable the FIFOs
+#define COM_FCR_RXCLR 0x02 //   Clear the receive FIFO
+#define COM_FCR_TXCLR 0x04 //   Clear the transmit FIFO
+#define COM_FCR_TRIG8 0x80 //   Receive interrupt at 8 bytes
 #define COM_LCR       3    // Out: Line Control Register
 #define COM_LCR_DLAB  0x80 //   Divisor latch access bit
 #define COM_LCR_WLEN8 0x03 //   Wordlength: 8 bits
@@ -54,6 +62,9 @@ delay(void) {
 #define COM_LSR_TXRDY 0x20 //   Transmit buffer avail
 #define COM_LSR_TSRE  0x40 //   Transmitter off
 
+#define COM_BAUD     115200
+#define COM_FIFOSIZE 16 // 16550 transmit FIFO depth
+
 static bool serial_exists;
 
 static char font8x8_basic[128][8] = {
@@ -187,19 +198,6 @@ static char font8x8_basic[128][8] = {
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // U+007F
 };
 
-void
-draw_char(uint32_t *buffer, uint32_t x, uint32_t y, uint32_t color, char charcode) {
-  int pos = charcode;
-  char *p = &(font8x8_basic[pos][0]); // Size of a font's character
-  for (int h = 0; h < 8; h++) {
-    for (int w = 0; w < 8; w++) {
-      if ((p[h] >> (w)) & 1) {
-        buffer[uefi_hres * SYMBOL_SIZE * y + uefi_hres * h + SYMBOL_SIZE * x + w] = color;
-      }
-    }
-  }
-}
-
 static int
 serial_proc_data(void) {
   if (!(inb(COM1 + COM_LSR) & COM_LSR_DATA))
@@ -207,41 +205,109 @@ serial_proc_data(void) {
   return inb(COM1 + COM_RX);
 }
 
+// Transmit ring buffer.  serial_putc queues characters here and
+// the THRE interrupt moves them into the UART FIFO.
+#define SERIAL_TXBUFSIZE 4096
+
+static struct {
+  uint8_t buf[SERIAL_TXBUFSIZE];
+  uint32_t rpos;
+  uint32_t wpos;
+} serial_tx;
+
+// What IER was last set to, so that it is written only on changes.
+static uint8_t serial_ier;
+
+static void
+serial_set_ier(uint8_t ier) {
+  if (ier != serial_ier) {
+    serial_ier = ier;
+    outb(COM1 + COM_IER, ier);
+  }
+}
+
+// Move queued characters into the transmit FIFO if it is empty,
+// and keep the THRE interrupt enabled only while characters remain.
+static void
+serial_tx_fill(void) {
+  int i;
+
+  if (inb(COM1 + COM_LSR) & COM_LSR_TXRDY) {
+    for (i = 0; i < COM_FIFOSIZE && serial_tx.rpos != serial_tx.wpos; i++) {
+      outb(COM1 + COM_TX, serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+    }
+  }
+  serial_set_ier(COM_IER_RDI |
+                 (serial_tx.rpos != serial_tx.wpos ? COM_IER_THRI : 0));
+}
+
+// Push out everything queued, polling the line status register.
+// Like the old synchronous serial_putc, a character that waited too
+// long is sent anyway, so a stuck UART cannot hang the kernel here.
+static void
+serial_tx_flush(void) {
+  int i;
+
+  while (serial_tx.rpos != serial_tx.wpos) {
+    for (i = 0;
+         !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+         i++)
+      delay();
+    if (i == 12800)
+      outb(COM1 + COM_TX, serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+    serial_tx_fill();
+  }
+}
+
 void
 serial_intr(void) {
-  if (serial_exists)
+  if (serial_exists) {
+    // Reading IIR acknowledges a pending THRE interrupt.
+    (void)inb(COM1 + COM_IIR);
     cons_intr(serial_proc_data);
+    serial_tx_fill();
+  }
 }
 
 static void
 serial_putc(int c) {
-  int i;
+  extern const char *panicstr;
 
-  for (i = 0;
-       !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
-       i++)
-    delay();
+  if (!serial_exists)
+    return;
 
-  outb(COM1 + COM_TX, c);
+  // After a panic the interrupt will never come:
+  // drain the queue and send synchronously.
+  if (panicstr) {
+    serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
+    serial_tx_flush();
+    return;
+  }
+
+  if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE)
+    serial_tx_flush();
+  serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = c;
+  serial_tx_fill();
 }
 
 static void
 serial_init(void) {
-  // Turn off the FIFO
-  outb(COM1 + COM_FCR, 0);
+  // Turn on and reset the FIFOs
+  outb(COM1 + COM_FCR, COM_FCR_ENABLE | COM_FCR_RXCLR | COM_FCR_TXCLR | COM_FCR_TRIG8);
 
   // Set speed; requires DLAB latch
   outb(COM1 + COM_LCR, COM_LCR_DLAB);
-  outb(COM1 + COM_DLL, (uint8_t)(115200 / 9600));
+  outb(COM1 + COM_DLL, (uint8_t)(115200 / COM_BAUD));
   outb(COM1 + COM_DLM, 0);
 
   // 8 data bits, 1 stop bit, parity off; turn off DLAB latch
   outb(COM1 + COM_LCR, COM_LCR_WLEN8 & ~COM_LCR_DLAB);
 
-  // No modem controls
-  outb(COM1 + COM_MCR, 0);
-  // Enable rcv interrupts
-  outb(COM1 + COM_IER, COM_IER_RDI);
+  // No modem controls, but OUT2 gates the interrupt line on PCs
+  outb(COM1 + COM_MCR, COM_MCR_OUT2);
+  // Enable rcv interrupts; transmit interrupts are enabled on demand
+  serial_ier = COM_IER_RDI;
+  outb(COM1 + COM_IER, serial_ier);
 
   // Clear any preexisting overrun indications and interrupts
   // Serial port doesn't exist if COM_LSR returns 0xFF
@@ -271,8 +337,41 @@ lpt_putc(int c) {
 
 /***** Text-mode framebuffer display output *****/
 
+// fb_putc does not touch the framebuffer.  It updates a grid of
+// character cells kept in ordinary memory, and fb_flush redraws only
+// the screen cells whose character has changed.  The grid is a ring
+// of rows that starts at fb_top, so scrolling moves no memory at all.
+
+#define FB_MAX_CELLS (FBUFF_SIZE / sizeof(uint32_t) / (SYMBOL_SIZE * SYMBOL_SIZE))
+#define FB_MAX_ROWS  (FB_MAX_CELLS / CRT_COLS)
+
+#define FB_FG 0xffffffff
+#define FB_BG 0x0
+
 static uint32_t *crt_buf = (uint32_t *)FBUFFBASE;
-static uint16_t crt_pos;
+static uint32_t crt_pos;
+
+static uint8_t fb_cells[FB_MAX_CELLS];  // Text to display, ring of rows
+static uint8_t fb_screen[FB_MAX_CELLS]; // Text on the screen, by position
+static bool fb_dirty[FB_MAX_ROWS];      // Screen rows that may differ
+static uint32_t fb_top;                 // Ring row shown at the top
+
+// Glyphs expanded to pixels, two pixels per 64-bit word.
+static uint64_t fb_glyphs[128][SYMBOL_SIZE][SYMBOL_SIZE / 2];
+
+static void
+fb_glyphs_init(void) {
+  for (int g = 0; g < 128; g++) {
+    for (int h = 0; h < SYMBOL_SIZE; h++) {
+      uint8_t bits = font8x8_basic[g][h];
+      for (int w = 0; w < SYMBOL_SIZE; w += 2) {
+        uint64_t lo = (bits >> w) & 1 ? FB_FG : FB_BG;
+        uint64_t hi = (bits >> (w + 1)) & 1 ? FB_FG : FB_BG;
+        fb_glyphs[g][h][w / 2] = lo | hi << 32;
+      }
+    }
+  }
+}
 
 void
 fb_init(void) {
@@ -284,27 +383,71 @@ fb_init(void) {
   crt_size          = crt_rows * crt_cols;
   crt_pos           = crt_cols;
 
+  if (crt_size > FB_MAX_CELLS)
+    crt_size = (crt_rows = FB_MAX_CELLS / crt_cols) * crt_cols;
+
   // Clear screen
   memset(crt_buf, 0, lp->FrameBufferSize);
+  memset(fb_cells, ' ', crt_size);
+  memset(fb_screen, ' ', crt_size);
+  fb_top = 0;
+  fb_glyphs_init();
 
   graphics_exists = true;
 }
 
+static void
+fb_draw_cell(uint32_t col, uint32_t row, uint8_t ch) {
+  uint64_t *dst = (uint64_t *)(crt_buf + uefi_hres * SYMBOL_SIZE * row + SYMBOL_SIZE * col);
+
+  for (int h = 0; h < SYMBOL_SIZE; h++) {
+    for (int w = 0; w < SYMBOL_SIZE / 2; w++)
+      dst[w] = fb_glyphs[ch & 0x7F][h][w];
+    dst += uefi_hres / 2;
+  }
+}
+
+static void
+fb_set_cell(uint32_t pos, uint8_t ch) {
+  uint32_t row = pos / crt_cols;
+
+  fb_cells[(fb_top + row) % crt_rows * crt_cols + pos % crt_cols] = ch;
+  fb_dirty[row] = true;
+}
+
+// Redraw the screen cells that differ from the cell grid.
+static void
+fb_flush(void) {
+  if (!graphics_exists)
+    return;
+
+  for (uint32_t row = 0; row < crt_rows; row++) {
+    if (!fb_dirty[row])
+      continue;
+    fb_dirty[row] = false;
+
+    uint8_t *line   = fb_cells + (fb_top + row) % crt_rows * crt_cols;
+    uint8_t *screen = fb_screen + row * crt_cols;
+    for (uint32_t col = 0; col < crt_cols; col++) {
+      if (line[col] != screen[col]) {
+        screen[col] = line[col];
+        fb_draw_cell(col, row, line[col]);
+      }
+    }
+  }
+}
+
 static void
 fb_putc(int c) {
   if (!graphics_exists) {
     return;
   }
 
-  // if no attribute given, then use black on white
-  if (!(c & ~0xFF))
-    c |= 0x0700;
-
   switch (c & 0xff) {
     case '\b':
       if (crt_pos > 0) {
         crt_pos--;
-        draw_char(crt_buf, crt_pos % crt_cols, crt_pos / crt_cols, 0x0, 0x8);
+        fb_set_cell(crt_pos, ' ');
       }
       break;
     case '\n':
@@ -314,25 +457,24 @@ fb_putc(int c) {
       crt_pos -= (crt_pos % crt_cols);
       break;
     case '\t':
-      cons_putc(' ');
-      cons_putc(' ');
-      cons_putc(' ');
-      cons_putc(' ');
-      cons_putc(' ');
+      fb_putc(' ');
+      fb_putc(' ');
+      fb_putc(' ');
+      fb_putc(' ');
+      fb_putc(' ');
       break;
     default:
-      draw_char(crt_buf, crt_pos % crt_cols, crt_pos / crt_cols, 0xffffffff, (char)c); /* write the character */
+      fb_set_cell(crt_pos, c); /* write the character */
       crt_pos++;
       break;
   }
 
-  // What is the purpose of this?
+  // Scroll by advancing the top of the ring; the old top row
+  // becomes the new, blank bottom row.
   if (crt_pos >= crt_size) {
-    int i;
-
-    memmove(crt_buf, crt_buf + uefi_hres * SYMBOL_SIZE, uefi_hres * (uefi_vres - SYMBOL_SIZE) * sizeof(uint32_t));
-    for (i = uefi_hres * (uefi_vres - (uefi_vres % SYMBOL_SIZE) - SYMBOL_SIZE); i < uefi_hres * uefi_vres; i++)
-      crt_buf[i] = 0;
+    memset(fb_cells + fb_top * crt_cols, ' ', crt_cols);
+    fb_top = (fb_top + 1) % crt_rows;
+    memset(fb_dirty, true, crt_rows);
     crt_pos -= crt_cols;
   }
 }
@@ -498,33 +640,139 @@ kbd_init(void) {
 // where we stash characters received from the keyboard or serial port
 // whenever the corresponding interrupt occurs.
 
+// In cooked mode the characters between epos and wpos are the line
+// still being edited; readers only see the buffer up to epos.
+
 #define CONSBUFSIZE 512
 
+#define CONS_EOF 0x04 // ctl-d
+
 static struct {
   uint8_t buf[CONSBUFSIZE];
-  uint32_t rpos;
+  uint32_t rpos; // free-running; rpos <= epos <= wpos
+  uint32_t epos;
   uint32_t wpos;
+  int mode;
 } cons;
 
+static void
+cons_input(int c) {
+  if (cons.mode != CONS_COOKED) {
+    if (cons.wpos - cons.rpos < CONSBUFSIZE)
+      cons.buf[cons.wpos++ % CONSBUFSIZE] = c;
+    cons.epos = cons.wpos;
+    return;
+  }
+
+  switch (c) {
+    case '\b':
+    case '\x7f':
+      if (cons.wpos != cons.epos) {
+        cons.wpos--;
+        cputchar('\b');
+        cputchar(' ');
+        cputchar('\b');
+      }
+      break;
+    case '\r':
+    case '\n':
+    case CONS_EOF:
+      // Always keep room to end the line.
+      if (cons.wpos - cons.rpos == CONSBUFSIZE)
+        cons.wpos--;
+      cons.buf[cons.wpos++ % CONSBUFSIZE] = c == CONS_EOF ? c : '\n';
+      cons.epos = cons.wpos;
+      if (c != CONS_EOF)
+        cputchar('\n');
+      break;
+    default:
+      if (c >= ' ' && cons.wpos - cons.rpos < CONSBUFSIZE - 1) {
+        cons.buf[cons.wpos++ % CONSBUFSIZE] = c;
+        cputchar(c);
+      }
+  }
+}
+
+// Make runnable every env blocked in sys_cons_read;
+// they restart the read and find the new input.
+static void
+cons_wakeup(void) {
+  int i;
+
+  for (i = 0; i < NENV; i++) {
+    if (envs[i].env_cons_wait &&
+        envs[i].env_status == ENV_NOT_RUNNABLE) {
+      envs[i].env_cons_wait = 0;
+      envs[i].env_status    = ENV_RUNNABLE;
+    }
+  }
+}
+
 // called by device interrupt routines to feed input characters
 // into the circular console input buffer.
 static void
 cons_intr(int (*proc)(void)) {
+  uint32_t epos = cons.epos;
   int c;
 
   while ((c = (*proc)()) != -1) {
     if (c == 0)
       continue;
-    cons.buf[cons.wpos++] = c;
-    if (cons.wpos == CONSBUFSIZE)
-      cons.wpos = 0;
+    cons_input(c);
   }
+  if (cons.epos != epos) {
+    cons_wakeup();
+    futex_wake_poll(POLLWAIT_CONS);
+  }
+}
+
+// Switch the line discipline; a half-edited line is
+// handed over as is when leaving cooked mode.
+static void
+cons_set_mode(int mode) {
+  cons.mode = mode;
+  if (mode != CONS_COOKED)
+    cons.epos = cons.wpos;
+}
+
+// Return true if cons_read would not block in this mode.
+bool
+cons_readable(int mode) {
+  cons_set_mode(mode);
+  serial_intr();
+  kbd_intr();
+  return cons.rpos != cons.epos;
+}
+
+// Read at most n characters of input, stopping after a newline in
+// cooked mode.  Returns the number of characters read, or 0 for
+// end of file (a ctl-d with nothing before it).
+int
+cons_read(char *buf, size_t n, int mode) {
+  size_t i = 0;
+  int c;
+
+  cons_set_mode(mode);
+  while (i < n && cons.rpos != cons.epos) {
+    c = cons.buf[cons.rpos % CONSBUFSIZE];
+    if (c == CONS_EOF) {
+      if (!i)
+        cons.rpos++;
+      break;
+    }
+    cons.rpos++;
+    buf[i++] = c;
+    if (mode == CONS_COOKED && c == '\n')
+      break;
+  }
+  return i;
 }
 
 // return the next input character from the console, or 0 if none waiting
 int
 cons_getc(void) {
-  int c;
+  // someone is waiting at the console: show them the log first
+  klog_flush();
 
   // poll for any pending input characters,
   // so that this function works even when interrupts are disabled
@@ -533,21 +781,27 @@ cons_getc(void) {
   kbd_intr();
 
   // grab the next character from the input buffer.
-  if (cons.rpos != cons.wpos) {
-    c = cons.buf[cons.rpos++];
-    if (cons.rpos == CONSBUFSIZE)
-      cons.rpos = 0;
-    return c;
-  }
+  cons_set_mode(CONS_RAW);
+  if (cons.rpos != cons.wpos)
+    return cons.buf[cons.rpos++ % CONSBUFSIZE];
   return 0;
 }
 
-// output a character to the console
-static void
-cons_putc(int c) {
-  serial_putc(c);
-  lpt_putc(c);
-  fb_putc(c);
+// output a character to the selected console devices
+void
+cons_sink_putc(int c, int sinks) {
+  if (sinks & CONS_SINK_SERIAL)
+    serial_putc(c);
+  if (sinks & CONS_SINK_LPT)
+    lpt_putc(c);
+  if (sinks & CONS_SINK_FB)
+    fb_putc(c);
+}
+
+// redraw whatever cons_sink_putc left pending on the framebuffer
+void
+cons_sink_flush(void) {
+  fb_flush();
 }
 
 // initialize the console devices
@@ -562,9 +816,26 @@ cons_init(void) {
 
 // `High'-level console I/O.  Used by readline and cprintf.
 
+// Nesting depth of cons_batch_begin.  While output is synchronous
+// (see kern/klog.c) the log is drained when the outermost batch ends.
+static int cons_batch;
+
+void
+cons_batch_begin(void) {
+  cons_batch++;
+}
+
+void
+cons_batch_end(void) {
+  if (!--cons_batch)
+    klog_sync_flush();
+}
+
 void
 cputchar(int c) {
-  cons_putc(c);
+  klog_putc(c);
+  if (!cons_batch)
+    klog_sync_flush();
 }
 
 int
@@ -13,9 +13,21 @@
 #define CRT_SIZE    (CRT_ROWS * CRT_COLS)
 #define SYMBOL_SIZE 8
 
+// Console output devices, for cons_sink_putc.
+#define CONS_SINK_SERIAL 0x1
+#define CONS_SINK_LPT    0x2
+#define CONS_SINK_FB     0x4
+#define CONS_SINK_ALL    (CONS_SINK_SERIAL | CONS_SINK_LPT | CONS_SINK_FB)
+
 void cons_init(void);
 void fb_init(void);
 int cons_getc(void);
+bool cons_readable(int mode);
+int cons_read(char *buf, size_t n, int mode);
+void cons_batch_begin(void);
+void cons_batch_end(void);
+void cons_sink_putc(int c, int sinks);
+void cons_sink_flush(void);
 
 void kbd_intr(void);    // irq 1
 void serial_intr(void); // irq 4
@@ -6,6 +6,7 @@
 #include <inc/string.h>
 #include <inc/assert.h>
 #include <inc/elf.h>
+#include <inc/vsyscall.h>
 
 #include <kern/env.h>
 #include <kern/pmap.h>
@@ -14,6 +15,10 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/kdebug.h>
+#include <kern/klog.h>
+#include <kern/futex.h>
+#include <kern/fpu.h>
+#include <kern/vsyscall.h>
 #include <kern/macro.h>
 
 #ifdef CONFIG_KSPACE
@@ -204,6 +209,7 @@ env_setup_vm(struct Env *e) {
 
   e->env_pml4e = page2kva(p);
   e->env_cr3 = page2pa(p);
+  p->pp_ref++;
 
   e->env_pml4e[1] = kern_pml4e[1];
   pa2page(PTE_ADDR(kern_pml4e[1]))->pp_ref++;
@@ -251,6 +257,14 @@ env_alloc(struct Env **newenv_store, envid_t parent_id) {
   e->env_status = ENV_RUNNABLE;
   e->env_runs   = 0;
 
+  // Nobody waits for us yet, and we are not waiting for anyone.
+  // Envs destroyed without sys_env_exit report -1 to waiters.
+  e->env_exit_status = -1;
+  e->env_waiters     = NULL;
+  e->env_wait_link   = NULL;
+  e->env_waiting_on  = NULL;
+  e->env_cons_wait   = 0;
+
   // Clear out all the saved register state,
   // to prevent the register values
   // of a prior environment inhabiting this Env structure
@@ -294,15 +308,20 @@ env_alloc(struct Env **newenv_store, envid_t parent_id) {
 
   // Clear the page fault handler until user installs one.
   e->env_pgfault_upcall = 0;
+  e->env_uxstacktop     = UXSTACKTOP;
 
   // Also clear the IPC receiving flag.
   e->env_ipc_recving = 0;
+  e->env_deadline    = 0;
+  e->env_futex_nkeys = 0;
+  e->env_poll_flags  = 0;
+  e->env_fpu         = NULL;
 
   // commit the allocation
   env_free_list = e->env_link;
   *newenv_store = e;
 
-  cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+  cprintf(KERN_DEBUG "[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
   return 0;
 }
@@ -563,6 +582,69 @@ env_create(uint8_t *binary, enum EnvType type) {
   }
 }
 
+//
+// Block the current environment until 'e' is freed.
+// When that happens, sys_env_wait returns 0 with e's exit status
+// in the DX register.
+//
+void
+env_wait(struct Env *e) {
+  curenv->env_waiting_on = e;
+  curenv->env_wait_link  = e->env_waiters;
+  e->env_waiters         = curenv;
+
+  curenv->env_status             = ENV_NOT_RUNNABLE;
+  curenv->env_tf.tf_regs.reg_rax = 0;
+  sched_yield();
+}
+
+//
+// Wake up every env blocked in env_wait on 'e', handing out e's
+// exit status, and take 'e' itself off any wait queue it is on.
+//
+static void
+env_wait_release(struct Env *e) {
+  struct Env *w, **wp;
+
+  while ((w = e->env_waiters)) {
+    e->env_waiters = w->env_wait_link;
+
+    // Not stored to the waiter's memory: another thread sharing its
+    // address space may have forked meanwhile and left the page
+    // copy-on-write.
+    w->env_tf.tf_regs.reg_rdx = e->env_exit_status;
+    w->env_wait_link          = NULL;
+    w->env_waiting_on         = NULL;
+    w->env_status             = ENV_RUNNABLE;
+  }
+
+  if (e->env_waiting_on) {
+    for (wp = &e->env_waiting_on->env_waiters; *wp; wp = &(*wp)->env_wait_link) {
+      if (*wp == e) {
+        *wp = e->env_wait_link;
+        break;
+      }
+    }
+    e->env_waiting_on = NULL;
+    e->env_wait_link  = NULL;
+  }
+}
+
+//
+// Make e run in the address space of 'owner' instead of its own,
+// which must still be empty.  The page map is reference counted, so
+// env_free only tears the user mappings down for the last of them.
+//
+void
+env_share_vm(struct Env *e, struct Env *owner) {
+  physaddr_t pa = e->env_cr3;
+
+  e->env_pml4e = owner->env_pml4e;
+  e->env_cr3   = owner->env_cr3;
+  pa2page(e->env_cr3)->pp_ref++;
+  page_decref(pa2page(pa));
+}
+
 //
 // Frees env e and all memory it uses.
 //
@@ -584,52 +666,60 @@ env_free(struct Env *e) {
 #endif
 
   // Note the environment's demise.
-  cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+  cprintf(KERN_DEBUG "[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+
+  env_wait_release(e);
+  futex_dequeue(e);
+  fpu_free(e);
 
 #ifndef CONFIG_KSPACE
   // Flush all mapped pages in the user portion of the address space
   static_assert(UTOP % PTSIZE == 0, "Misaligned UTOP");
 
-  //UTOP < PDPE[1] start, so all mapped memory should be in first PDPE
-  pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
-  for (pdpeno = 0; pdpeno <= PDPE(UTOP); pdpeno++) {
-    // only look at mapped page directory pointer index
-    if (!(pdpe[pdpeno] & PTE_P))
-      continue;
+  // Threads share their creator's address space (see
+  // env_share_vm); only the last env using it tears it down.
+  if (pa2page(e->env_cr3)->pp_ref == 1) {
+    //UTOP < PDPE[1] start, so all mapped memory should be in first PDPE
+    pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
+    for (pdpeno = 0; pdpeno <= PDPE(UTOP); pdpeno++) {
+      // only look at mapped page directory pointer index
+      if (!(pdpe[pdpeno] & PTE_P))
+        continue;
 
-    pgdir       = KADDR(PTE_ADDR(pdpe[pdpeno]));
-    pdeno_limit = pdpeno == PDPE(UTOP) ? PDX(UTOP) : NPDPENTRIES;
-    for (pdeno = 0; pdeno < pdeno_limit; pdeno++) {
+      pgdir       = KADDR(PTE_ADDR(pdpe[pdpeno]));
+      pdeno_limit = pdpeno == PDPE(UTOP) ? PDX(UTOP) : NPDPENTRIES;
+      for (pdeno = 0; pdeno < pdeno_limit; pdeno++) {
 
-      // only look at mapped page tables
-      if (!(pgdir[pdeno] & PTE_P))
-        continue;
+        // only look at mapped page tables
+        if (!(pgdir[pdeno] & PTE_P))
+          continue;
+
+        // find the pa and va of the page table
+        pa = PTE_ADDR(pgdir[pdeno]);
+        pt = (pte_t *)KADDR(pa);
 
-      // find the pa and va of the page table
-      pa = PTE_ADDR(pgdir[pdeno]);
-      pt = (pte_t *)KADDR(pa);
+        // unmap all PTEs in this page table
+        for (pteno = 0; pteno <= PTX(~0); pteno++) {
+          if (pt[pteno] & PTE_P)
+            page_remove(e->env_pml4e, PGADDR((uint64_t)0,
+                                             pdpeno, pdeno, pteno, 0));
+        }
 
-      // unmap all PTEs in this page table
-      for (pteno = 0; pteno <= PTX(~0); pteno++) {
-        if (pt[pteno] & PTE_P)
-          page_remove(e->env_pml4e, PGADDR((uint64_t)0,
-                                           pdpeno, pdeno, pteno, 0));
+        // free the page table itself
+        pgdir[pdeno] = 0;
+        page_decref(pa2page(pa));
       }
 
-      // free the page table itself
-      pgdir[pdeno] = 0;
+      // free the page directory
+      pa           = PTE_ADDR(pdpe[pdpeno]);
+      pdpe[pdpeno] = 0;
       page_decref(pa2page(pa));
     }
-
-    // free the page directory
-    pa           = PTE_ADDR(pdpe[pdpeno]);
-    pdpe[pdpeno] = 0;
-    page_decref(pa2page(pa));
+    // free the page directory pointer
+    page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
+    e->env_pml4e[0] = 0;
   }
-  // free the page directory pointer
-  page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
   // free the page map level 4 (PML4)
-  e->env_pml4e[0] = 0;
   pa              = e->env_cr3;
   e->env_pml4e    = 0;
   e->env_cr3      = 0;
@@ -780,9 +870,18 @@ env_run(struct Env *e) {
 
   curenv = e;
   curenv->env_status = ENV_RUNNING;
+  // An env that runs again is no longer receiving, even if its
+  // timed receive expired without a sender.
+  curenv->env_ipc_recving = 0;
   curenv->env_runs++;
 
   lcr3(curenv->env_cr3);
+#ifndef CONFIG_KSPACE
+  fpu_switch(curenv);
+#endif
+  // Threads share their globals, so user code finds its own Env
+  // through this instead.
+  vsys[VSYS_envid] = curenv->env_id;
 
   env_pop_tf(&curenv->env_tf);
 
@@ -13,9 +13,11 @@ extern struct Segdesc gdt[];
 void env_init(void);
 void env_init_percpu(void);
 int env_alloc(struct Env **e, envid_t parent_id);
+void env_share_vm(struct Env *e, struct Env *owner);
 void env_free(struct Env *e);
 void env_create(uint8_t *binary, enum EnvType type);
 void env_destroy(struct Env *e); // Does not return if e == curenv
+void env_wait(struct Env *e) __attribute__((noreturn));
 
 int envid2env(envid_t envid, struct Env **env_store, bool checkperm);
 // The following two functions do not return
@@ -0,0 +1,163 @@
+/* See COPYRIGHT for copyright information. */
+
+// Lazy FPU/SIMD context switching.
+//
+// The x87, SSE and (if the CPU has it) AVX registers belong to at
+// most one environment at a time, fpu_owner.  Whenever another env
+// runs, CR0.TS is set, so its first FPU or SIMD instruction raises
+// #NM.  Only then does fpu_trap save the owner's registers and load
+// the new env's, which gets a page for them on its first use.  Envs
+// that never touch these registers never pay for them.
+//
+// The kernel itself is built without SSE and never uses them.
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+
+#include <kern/fpu.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/trap.h>
+
+#define CPUID1_EDX_FXSR  (1 << 24)
+#define CPUID1_ECX_XSAVE (1 << 26)
+#define CPUID1_ECX_AVX   (1 << 28)
+
+#define XFEATURE_X87 0x1
+#define XFEATURE_SSE 0x2
+#define XFEATURE_AVX 0x4
+
+#define MXCSR_DEFAULT 0x1F80 // all SIMD exceptions masked
+
+static struct Env *fpu_owner;
+static bool fpu_ts;           // CR0.TS is set
+static uint64_t fpu_features; // XCR0, or 0 if we use FXSAVE
+
+// Register state of an env that has not used the FPU yet.
+static uint8_t fpu_init_state[PGSIZE] __attribute__((aligned(64)));
+
+static void
+fpu_save(void *area) {
+  if (fpu_features)
+    xsave(area, fpu_features);
+  else
+    fxsave(area);
+}
+
+static void
+fpu_restore(const void *area) {
+  if (fpu_features)
+    xrstor(area, fpu_features);
+  else
+    fxrstor(area);
+}
+
+static void
+fpu_set_ts(bool ts) {
+  if (ts == fpu_ts)
+    return;
+  if (ts)
+    lcr0(rcr0() | CR0_TS);
+  else
+    clts();
+  fpu_ts = ts;
+}
+
+void
+fpu_init(void) {
+  uint32_t ecx, edx, mask, size;
+  uint32_t mxcsr = MXCSR_DEFAULT;
+
+  cpuid(1, NULL, NULL, &ecx, &edx);
+  if (!(edx & CPUID1_EDX_FXSR))
+    panic("fpu_init: no FXSAVE support");
+
+  lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+  if (ecx & CPUID1_ECX_XSAVE) {
+    lcr4(rcr4() | CR4_OSXSAVE);
+    cpuid(0xD, &mask, NULL, NULL, NULL);
+    fpu_features = XFEATURE_X87 | XFEATURE_SSE;
+    if ((ecx & CPUID1_ECX_AVX) && (mask & XFEATURE_AVX))
+      fpu_features |= XFEATURE_AVX;
+    xsetbv(0, fpu_features);
+    // The XSAVE area size for the features now enabled.
+    cpuid(0xD, NULL, &size, NULL, NULL);
+    assert(size <= PGSIZE);
+  }
+
+  clts();
+  asm volatile("fninit; ldmxcsr %0"
+               :
+               : "m"(mxcsr));
+  fpu_save(fpu_init_state);
+  fpu_ts = 0;
+  fpu_set_ts(1);
+
+  cprintf("FPU: %s%s\n", fpu_features ? "XSAVE" : "FXSAVE",
+          fpu_features & XFEATURE_AVX ? ", AVX" : "");
+}
+
+// Called whenever env e is about to run.
+void
+fpu_switch(struct Env *e) {
+  fpu_set_ts(e != fpu_owner);
+}
+
+// Handle #NM: give the FPU to the current environment.
+void
+fpu_trap(struct Trapframe *tf) {
+  struct PageInfo *pp;
+
+  if (!(tf->tf_cs & 3))
+    panic("FPU used in the kernel");
+
+  if (!curenv->env_fpu) {
+    if (!(pp = page_alloc(0))) {
+      cprintf("[%08x] out of memory for FPU state\n", curenv->env_id);
+      env_destroy(curenv);
+    }
+    pp->pp_ref++;
+    curenv->env_fpu = page2kva(pp);
+    memcpy(curenv->env_fpu, fpu_init_state, PGSIZE);
+  }
+
+  fpu_set_ts(0);
+  if (fpu_owner)
+    fpu_save(fpu_owner->env_fpu);
+  fpu_restore(curenv->env_fpu);
+  fpu_owner = curenv;
+}
+
+// Give curenv's new child a copy of curenv's FPU state, as
+// sys_exofork must: the code around the system call may keep values
+// in SIMD registers.  Returns 0 on success, -E_NO_MEM if out of memory.
+int
+fpu_fork(struct Env *child) {
+  struct PageInfo *pp;
+
+  if (!curenv->env_fpu)
+    return 0;
+  if (!(pp = page_alloc(0)))
+    return -E_NO_MEM;
+  pp->pp_ref++;
+  child->env_fpu = page2kva(pp);
+
+  // CR0.TS is clear while the owner runs.
+  if (curenv == fpu_owner)
+    fpu_save(curenv->env_fpu);
+  memcpy(child->env_fpu, curenv->env_fpu, PGSIZE);
+  return 0;
+}
+
+void
+fpu_free(struct Env *e) {
+  if (e == fpu_owner)
+    fpu_owner = NULL;
+  if (e->env_fpu) {
+    page_decref(pa2page(PADDR(e->env_fpu)));
+    e->env_fpu = NULL;
+  }
+}
@@ -0,0 +1,131 @@
+/* See COPYRIGHT for copyright information. */
+
+// Futexes.  An env blocked in futex_wait is ENV_NOT_RUNNABLE with
+// env_futex_keys holding the physical addresses of the words it waits
+// on, so envs that share a page through different virtual addresses
+// still find each other.  A poll wait may add kernel event sources
+// in env_poll_flags.  Each page counts its sleepers in pp_futex,
+// which lets page_remove wake them before the page can go away.
+
+#include <inc/mmu.h>
+#include <inc/assert.h>
+
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/futex.h>
+
+static physaddr_t
+futex_key(volatile uint32_t *uaddr) {
+  struct PageInfo *pp = page_lookup(curenv->env_pml4e, (void *)uaddr, NULL);
+
+  assert(pp);
+  return page2pa(pp) + PGOFF(uaddr);
+}
+
+// Take 'e' off every futex it sleeps on.
+void
+futex_dequeue(struct Env *e) {
+  int i;
+
+  for (i = 0; i < e->env_futex_nkeys; i++)
+    pa2page(e->env_futex_keys[i])->pp_futex--;
+  e->env_futex_nkeys = 0;
+}
+
+// Make 'e', blocked in futex_wait, runnable again,
+// and have its system call return 'ret'.
+void
+futex_wakeup(struct Env *e, int64_t ret) {
+  futex_dequeue(e);
+  e->env_poll_flags         = 0;
+  e->env_deadline           = 0;
+  e->env_tf.tf_regs.reg_rax = ret;
+  e->env_status             = ENV_RUNNABLE;
+}
+
+// Add the word at 'uaddr', which must be mapped, to the futexes
+// curenv is about to wait on.
+void
+futex_enqueue(volatile uint32_t *uaddr) {
+  physaddr_t key = futex_key(uaddr);
+
+  assert(curenv->env_futex_nkeys < FUTEX_MAXKEYS);
+  curenv->env_futex_keys[curenv->env_futex_nkeys++] = key;
+  pa2page(key)->pp_futex++;
+}
+
+// Block curenv on the futexes added with futex_enqueue and on the
+// POLLWAIT_* sources in 'flags', until one of them fires or until
+// 'deadline' (a TSC value, 0 for none).
+void
+futex_wait(int flags, uint64_t deadline) {
+  curenv->env_poll_flags = flags;
+  curenv->env_deadline   = deadline;
+
+  curenv->env_status             = ENV_NOT_RUNNABLE;
+  curenv->env_tf.tf_regs.reg_rax = 0;
+  sched_yield();
+}
+
+static bool
+futex_waits_on(struct Env *e, physaddr_t key) {
+  int i;
+
+  for (i = 0; i < e->env_futex_nkeys; i++)
+    if (e->env_futex_keys[i] == key)
+      return 1;
+  return 0;
+}
+
+// Wake up to 'n' envs blocked on the word at 'uaddr'.
+// Returns the number of envs woken.
+int
+futex_wake(volatile uint32_t *uaddr, int n) {
+  physaddr_t key = futex_key(uaddr);
+  int i, woken = 0;
+
+  if (!pa2page(key)->pp_futex)
+    return 0;
+  for (i = 0; i < NENV && woken < n; i++) {
+    if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+        futex_waits_on(&envs[i], key)) {
+      futex_wakeup(&envs[i], 0);
+      woken++;
+    }
+  }
+  return woken;
+}
+
+// Wake every env blocked on any word in page 'pp'.
+void
+futex_wake_page(struct PageInfo *pp) {
+  int i, k;
+
+  for (i = 0; i < NENV && pp->pp_futex; i++) {
+    if (envs[i].env_status != ENV_NOT_RUNNABLE)
+      continue;
+    for (k = 0; k < envs[i].env_futex_nkeys; k++) {
+      if (pa2page(envs[i].env_futex_keys[k]) == pp) {
+        futex_wakeup(&envs[i], 0);
+        break;
+      }
+    }
+  }
+}
+
+// Wake every env polling for the POLLWAIT_* event 'flag',
+// telling it which event that was.  Returns the number woken.
+int
+futex_wake_poll(int flag) {
+  int i, woken = 0;
+
+  for (i = 0; i < NENV; i++) {
+    if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+        (envs[i].env_poll_flags & flag)) {
+      futex_wakeup(&envs[i], flag);
+      woken++;
+    }
+  }
+  return woken;
+}
@@ -0,0 +1,22 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+struct PageInfo;
+
+void futex_enqueue(volatile uint32_t *uaddr);
+void futex_wait(int flags, uint64_t deadline) __attribute__((noreturn));
+int futex_wake(volatile uint32_t *uaddr, int n);
+void futex_wake_page(struct PageInfo *pp);
+int futex_wake_poll(int flag);
+void futex_wakeup(struct Env *e, int64_t ret);
+void futex_dequeue(struct Env *e);
+
+#endif // !JOS_KERN_FUTEX_H
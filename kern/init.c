@@ -18,6 +18,9 @@
 #include <kern/picirq.h>
 #include <kern/kclock.h>
 #include <kern/kdebug.h>
+#include <kern/vsyscall.h>
+#include <kern/klog.h>
+#include <kern/fpu.h>
 
 void
 timers_init(void) {
@@ -123,6 +126,8 @@ i386_init(void) {
 #ifndef CONFIG_KSPACE
   // Lab 6 memory management initialization functions
   mem_init();
+  fpu_init();
+  vsys[VSYS_tsc_khz] = tsc_calibrate() / 1000;
 #endif
 
   // Perform global constructor initialisation (e.g. asan)
@@ -177,6 +182,10 @@ i386_init(void) {
   // Should not be necessary - drains keyboard because interrupt has given up.
   kbd_intr();
 
+  // From now on console output is drained from the idle loop
+  // and device interrupts.
+  klog_set_sync(0);
+
   // Schedule and run the first user environment!
   sched_yield();
 }
@@ -0,0 +1,137 @@
+/* See COPYRIGHT for copyright information. */
+
+// Kernel log.  cputchar appends to a ring buffer in constant time;
+// the console devices are fed from it by klog_flush, which runs from
+// the idle loop and from the timer, keyboard and serial interrupts.
+// Until the first environment is scheduled, and again after a panic
+// or while the monitor is active, the log is drained synchronously.
+//
+// There is a single writer and a single console reader, and both run
+// with interrupts disabled, so no lock is needed: the writer only
+// advances head, the reader only advances cons.  If the console falls
+// a whole buffer behind, the writer drains it synchronously before it
+// overwrites anything, so console output is never lost.
+
+#include <inc/types.h>
+#include <inc/string.h>
+
+#include <kern/klog.h>
+#include <kern/console.h>
+
+static struct {
+  char buf[KLOG_BUFSIZE];
+  uint8_t level[KLOG_BUFSIZE];
+  uint32_t head;  // next byte to write, free-running
+  uint32_t cons;  // next byte for the console
+  uint32_t start; // first byte kept by klog_clear
+  uint8_t cur_level;
+  bool soh;       // previous byte was KERN_SOH
+  bool bol;       // at the beginning of a line
+} klog = {
+    .cur_level = KLOG_DEFAULT_LEVEL,
+    .bol       = 1,
+};
+
+int klog_console_level = 7;
+int klog_console_sinks = CONS_SINK_ALL;
+
+static bool klog_sync = 1;
+
+// Append c to the ring as it is, at the current level.
+static void
+klog_append(int c) {
+  if (klog.head - klog.cons >= KLOG_BUFSIZE)
+    klog_flush();
+
+  klog.buf[klog.head % KLOG_BUFSIZE]   = c;
+  klog.level[klog.head % KLOG_BUFSIZE] = klog.cur_level;
+  klog.head++;
+
+  klog.bol = (c == '\n');
+  if (klog.bol)
+    klog.cur_level = KLOG_DEFAULT_LEVEL;
+}
+
+void
+klog_putc(int c) {
+  if (klog.soh) {
+    klog.soh = 0;
+    if (c >= '0' && c <= '7') {
+      klog.cur_level = c - '0';
+      return;
+    }
+  } else if (c == KERN_SOH[0] && klog.bol) {
+    klog.soh = 1;
+    return;
+  }
+  klog_append(c);
+}
+
+// Append len bytes of user text.  Unlike klog_putc, a KERN_SOH byte
+// is kept as it is and never taken for a level prefix.
+void
+klog_write(const char *s, size_t len) {
+  while (len--)
+    klog_append(*s++);
+}
+
+// Send everything the console has not seen yet to the enabled sinks.
+void
+klog_flush(void) {
+  uint32_t i;
+
+  if (klog.cons == klog.head)
+    return;
+
+  for (; klog.cons != klog.head; klog.cons++) {
+    i = klog.cons % KLOG_BUFSIZE;
+    if (klog.level[i] <= klog_console_level)
+      cons_sink_putc(klog.buf[i], klog_console_sinks);
+  }
+  cons_sink_flush();
+}
+
+// Flush only if output is currently synchronous.
+void
+klog_sync_flush(void) {
+  extern const char *panicstr;
+
+  if (klog_sync || panicstr)
+    klog_flush();
+}
+
+void
+klog_set_sync(bool sync) {
+  if (sync)
+    klog_flush();
+  klog_sync = sync;
+}
+
+bool
+klog_get_sync(void) {
+  return klog_sync;
+}
+
+void
+klog_clear(void) {
+  klog.start = klog.head;
+}
+
+// Copy the most recent bytes of the log, at most len of them,
+// into buf.  Returns the number of bytes copied.
+size_t
+klog_read(char *buf, size_t len) {
+  uint32_t first = klog.start, n, i, part;
+
+  if (klog.head - first > KLOG_BUFSIZE)
+    first = klog.head - KLOG_BUFSIZE;
+  if (klog.head - first > len)
+    first = klog.head - len;
+
+  n = klog.head - first;
+  i = first % KLOG_BUFSIZE;
+  part = MIN(n, KLOG_BUFSIZE - i);
+  memcpy(buf, klog.buf + i, part);
+  memcpy(buf + part, klog.buf, n - part);
+  return n;
+}
@@ -0,0 +1,38 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_KLOG_H
+#define JOS_KERN_KLOG_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/syscall.h>
+
+// Message levels.  A cprintf format may start with one of these to
+// tag everything up to the next newline; untagged text is KERN_INFO.
+#define KERN_SOH     "\001"
+#define KERN_EMERG   KERN_SOH "0"
+#define KERN_ALERT   KERN_SOH "1"
+#define KERN_CRIT    KERN_SOH "2"
+#define KERN_ERR     KERN_SOH "3"
+#define KERN_WARNING KERN_SOH "4"
+#define KERN_NOTICE  KERN_SOH "5"
+#define KERN_INFO    KERN_SOH "6"
+#define KERN_DEBUG   KERN_SOH "7"
+
+#define KLOG_DEFAULT_LEVEL 6
+
+extern int klog_console_level;
+extern int klog_console_sinks;
+
+void klog_putc(int c);
+void klog_write(const char *s, size_t len);
+void klog_flush(void);
+void klog_sync_flush(void);
+void klog_set_sync(bool sync);
+bool klog_get_sync(void);
+void klog_clear(void);
+size_t klog_read(char *buf, size_t len);
+
+#endif // !JOS_KERN_KLOG_H
@@ -10,6 +10,7 @@
 #include <inc/error.h>
 
 #include <kern/console.h>
+#include <kern/klog.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
 #include <kern/tsc.h>
@@ -43,7 +44,8 @@ static struct Command commands[] = {
     {"timer_stop", "Stop timer", mon_stop},
     {"timer_freq", "Count processor frequency", mon_frequency},
     {"memory", "List all physical pages", mon_memory},
-    {"types", "Call a C function", mon_types}};
+    {"types", "Call a C function", mon_types},
+    {"dmesg", "Show kernel log [-c] [-n level] [-E|-D serial|lpt|fb]", mon_dmesg}};
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -153,6 +155,54 @@ mon_memory(int argc, char **argv, struct Trapframe *tf) {
   return 0;
 }
 
+static int
+dmesg_sink(const char *name) {
+  if (!strcmp(name, "serial"))
+    return CONS_SINK_SERIAL;
+  if (!strcmp(name, "lpt"))
+    return CONS_SINK_LPT;
+  if (!strcmp(name, "fb"))
+    return CONS_SINK_FB;
+  return 0;
+}
+
+int
+mon_dmesg(int argc, char **argv, struct Trapframe *tf) {
+  static char buf[KLOG_BUFSIZE];
+  size_t i, n;
+  int sink;
+
+  if (argc == 1) {
+    // Write straight to the devices so the dump doesn't log itself.
+    n = klog_read(buf, sizeof(buf));
+    for (i = 0; i < n; i++)
+      cons_sink_putc(buf[i], CONS_SINK_ALL);
+    cons_sink_flush();
+    return 0;
+  }
+
+  if (argc == 2 && !strcmp(argv[1], "-c")) {
+    klog_clear();
+    return 0;
+  }
+  if (argc == 3 && !strcmp(argv[1], "-n")) {
+    klog_console_level = strtol(argv[2], NULL, 10);
+    return 0;
+  }
+  if (argc == 3 && (sink = dmesg_sink(argv[2]))) {
+    if (!strcmp(argv[1], "-E")) {
+      klog_console_sinks |= sink;
+      return 0;
+    }
+    if (!strcmp(argv[1], "-D")) {
+      klog_console_sinks &= ~sink;
+      return 0;
+    }
+  }
+  cprintf("Usage: dmesg [-c] [-n level] [-E|-D serial|lpt|fb]\n");
+  return 0;
+}
+
 /***** Kernel monitor command interpreter *****/
 
 #define WHITESPACE "\t\r\n "
@@ -233,6 +283,10 @@ mon_types(int argc, char **argv, struct Trapframe *tf) {
 void
 monitor(struct Trapframe *tf) {
   char *buf;
+  bool sync = klog_get_sync();
+
+  // The monitor is interactive: echo everything immediately.
+  klog_set_sync(1);
 
   cprintf("Welcome to the JOS kernel monitor!\n");
   cprintf("Type 'help' for a list of commands.\n");
@@ -246,4 +300,5 @@ monitor(struct Trapframe *tf) {
       if (runcmd(buf, tf) < 0)
         break;
   }
+  klog_set_sync(sync);
 }
@@ -81,6 +81,23 @@ irq_setmask_8259A(uint16_t mask) {
   cprintf("\n");
 }
 
+// Mask or unmask a single line, quietly: this runs on every
+// interrupt of a line that is masked until its driver acknowledges it.
+void
+irq_set_masked(uint8_t irq, bool masked) {
+  uint16_t mask = masked ? irq_mask_8259A | (1 << irq) : irq_mask_8259A & ~(1 << irq);
+
+  if (mask == irq_mask_8259A)
+    return;
+  irq_mask_8259A = mask;
+  if (!didinit)
+    return;
+  if (irq < 8)
+    outb(IO_PIC1_DATA, (char)mask);
+  else
+    outb(IO_PIC2_DATA, (char)(mask >> 8));
+}
+
 void
 pic_send_eoi(uint8_t irq) {
   if (irq >= 8)
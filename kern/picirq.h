@@ -30,6 +30,7 @@
 extern uint16_t irq_mask_8259A;
 void pic_init(void);
 void irq_setmask_8259A(uint16_t mask);
+void irq_set_masked(uint8_t irq, bool masked);
 void pic_send_eoi(uint8_t irq);
 #endif // !__ASSEMBLER__
 
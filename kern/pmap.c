@@ -11,6 +11,7 @@
 #include <kern/pmap.h>
 #include <kern/kclock.h>
 #include <kern/env.h>
+#include <kern/futex.h>
 #include <inc/uefi.h>
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -138,7 +139,8 @@ fix_lp_addresses(void) {
 // Set up memory mappings above UTOP.
 // --------------------------------------------------------------
 
-static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm, int type);
+static void pat_init(void);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
 static void check_kern_pml4e(void);
@@ -223,6 +225,9 @@ mem_init(void) {
   // Find out how much memory the machine has (npages & npages_basemem).
   i386_detect_memory();
 
+  // Program memory types before creating any mappings that use them.
+  pat_init();
+
   // Remove this line when you're ready to test this function.
   // panic("mem_init: This function is not finished\n");
 
@@ -289,7 +294,7 @@ mem_init(void) {
   //    - pages itself -- kernel RW, user NONE
   // LAB 7: Your code goes here:
 
-  boot_map_region(kern_pml4e, UPAGES, ROUNDUP(npages * sizeof(*pages), PGSIZE), PADDR(pages), PTE_U | PTE_P);
+  boot_map_region(kern_pml4e, UPAGES, ROUNDUP(npages * sizeof(*pages), PGSIZE), PADDR(pages), PTE_U | PTE_P, MEM_WB);
 
   //////////////////////////////////////////////////////////////////////
   // Map the 'envs' array read-only by the user at linear address UENVS
@@ -299,7 +304,7 @@ mem_init(void) {
   //    - envs itself -- kernel RW, user NONE
   // LAB 8: Your code here.
 
-  boot_map_region(kern_pml4e, UENVS, ROUNDUP(NENV * sizeof(*envs), PGSIZE), PADDR(envs), PTE_U | PTE_P);
+  boot_map_region(kern_pml4e, UENVS, ROUNDUP(NENV * sizeof(*envs), PGSIZE), PADDR(envs), PTE_U | PTE_P, MEM_WB);
 
   //////////////////////////////////////////////////////////////////////
   // Map the 'vsys' array read-only by the user at linear address UVSYS
@@ -309,7 +314,7 @@ mem_init(void) {
   //    - envs itself -- kernel RW, user NONE
   // LAB 12: Your code here.
 
-  boot_map_region(kern_pml4e, UVSYS, ROUNDUP(NVSYSCALLS * sizeof(*vsys), PGSIZE), PADDR((int *)vsys), PTE_U | PTE_P);
+  boot_map_region(kern_pml4e, UVSYS, ROUNDUP(NVSYSCALLS * sizeof(*vsys), PGSIZE), PADDR((int *)vsys), PTE_U | PTE_P, MEM_WB);
 
   //////////////////////////////////////////////////////////////////////
   // Use the physical memory that 'bootstack' refers to as the kernel
@@ -323,10 +328,10 @@ mem_init(void) {
   //     Permissions: kernel RW, user NONE
   // LAB 7: Your code goes here:
 
-  boot_map_region(kern_pml4e, KSTACKTOP - KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P);
+  boot_map_region(kern_pml4e, KSTACKTOP - KSTKSIZE, KSTKSIZE, PADDR(bootstack), PTE_W | PTE_P, MEM_WB);
 
   // Additionally map stack to lower 32-bit addresses.
-  boot_map_region(kern_pml4e, X86ADDR(KSTACKTOP - KSTKSIZE), KSTKSIZE, PADDR(bootstack), PTE_P | PTE_W);
+  boot_map_region(kern_pml4e, X86ADDR(KSTACKTOP - KSTKSIZE), KSTKSIZE, PADDR(bootstack), PTE_P | PTE_W, MEM_WB);
 
   //////////////////////////////////////////////////////////////////////
   // Map all of physical memory at KERNBASE.
@@ -337,11 +342,11 @@ mem_init(void) {
   // Permissions: kernel RW, user NONE
   // LAB 7: Your code goes here:
 
-  boot_map_region(kern_pml4e, KERNBASE, npages * PGSIZE, 0, PTE_P | PTE_W);
+  boot_map_region(kern_pml4e, KERNBASE, npages * PGSIZE, 0, PTE_P | PTE_W, MEM_WB);
 
   // Additionally map kernel to lower 32-bit addresses. Assumes kernel should not exceed 50 mb.
   size_to_alloc = MIN(0x3200000, npages * PGSIZE);
-  boot_map_region(kern_pml4e, X86ADDR(KERNBASE), size_to_alloc, 0, PTE_P | PTE_W);
+  boot_map_region(kern_pml4e, X86ADDR(KERNBASE), size_to_alloc, 0, PTE_P | PTE_W, MEM_WB);
 
   //////////////////////////////////////////////////////////////////////
   // Map the UEFI runtime virtual memory to it corresponding physical
@@ -355,7 +360,7 @@ mem_init(void) {
     virt_start    = (uintptr_t)mmap_curr->VirtualStart;
     size_to_alloc = mmap_curr->NumberOfPages * PGSIZE;
     if (mmap_curr->Attribute & EFI_MEMORY_RUNTIME) {
-      boot_map_region(kern_pml4e, virt_start, size_to_alloc, phys_start, PTE_P | PTE_W);
+      boot_map_region(kern_pml4e, virt_start, size_to_alloc, phys_start, PTE_P | PTE_W, MEM_WB);
     }
   }
 
@@ -386,12 +391,13 @@ mem_init(void) {
   //////////////////////////////////////////////////////////////////////
   // Map the frame buffer from UEFI using base address as physical address
   // and mapping only the required passed amount of memory.
+  // Write-combining lets bulk pixel writes go out as full bursts.
   //     Permissions: kernel RW, user NONE
   LOADER_PARAMS *lp  = (LOADER_PARAMS *)uefi_lp;
   uintptr_t physaddr = lp->FrameBufferBase;
   uintptr_t size     = lp->FrameBufferSize;
 
-  boot_map_region(kern_pml4e, FBUFFBASE, size, physaddr, PTE_P | PTE_W);
+  boot_map_region(kern_pml4e, FBUFFBASE, size, physaddr, PTE_P | PTE_W, MEM_WC);
 
   // Some more checks, only possible after kern_pml4e is installed.
   check_page_installed_pml4();
@@ -562,6 +568,48 @@ page_is_allocated(const struct PageInfo *pp) {
   return !pp->pp_link && pp != page_free_list_top;
 }
 
+//
+// Allocates 'n' physically contiguous pages that all lie below
+// physical address 'limit', for devices that need a buffer in one
+// piece.  alloc_flags is as for page_alloc.  This walks the whole
+// free list, so it is meant for allocations made once, by drivers.
+//
+// Returns the first page, or NULL if there is no such run.
+struct PageInfo *
+page_alloc_contig(size_t n, physaddr_t limit, int alloc_flags) {
+  struct PageInfo *first = NULL, **pprev, *pp;
+  size_t i, run = 0;
+
+  for (i = 0; i < npages && page2pa(&pages[i]) + PGSIZE <= limit; i++) {
+    run = page_is_allocated(&pages[i]) ? 0 : run + 1;
+    if (run == n) {
+      first = &pages[i + 1 - n];
+      break;
+    }
+  }
+  if (!first)
+    return NULL;
+
+  for (pprev = &page_free_list; (pp = *pprev);) {
+    if (pp >= first && pp < first + n) {
+      *pprev      = pp->pp_link;
+      pp->pp_link = NULL;
+    } else {
+      pprev = &pp->pp_link;
+    }
+  }
+  page_free_list_top = evaluate_page_free_list_top();
+
+  for (pp = first; pp < first + n; pp++) {
+#ifdef SANITIZE_SHADOW_BASE
+    platform_asan_unpoison(page2kva(pp), PGSIZE);
+#endif
+    if (alloc_flags & ALLOC_ZERO)
+      memset(page2kva(pp), 0, PGSIZE);
+  }
+  return first;
+}
+
 //
 // Return a page to the free list.
 // (This function should only be called when pp->pp_ref reaches 0.)
@@ -686,11 +734,59 @@ pgdir_walk(pde_t *pgdir, const void *va, int create) {
   return (pte_t *)page2kva(np) + PTX(va);
 }
 
+static bool pat_supported;
+
+//
+// Program the IA32_PAT MSR.  Entries 0-3 keep their power-on values,
+// so PWT and PCD mean the same as without PAT; entry 4, selected by
+// PTE_PAT alone, becomes write-combining.
+//
+static void
+pat_init(void) {
+  uint32_t edx;
+
+  cpuid(1, NULL, NULL, NULL, &edx);
+  pat_supported = (edx & CPUID_PAT) != 0;
+  if (!pat_supported)
+    return;
+
+  wbinvd();
+  wrmsr(PAT_MSR, PAT_ENTRY(0, PAT_WB) | PAT_ENTRY(1, PAT_WT) |
+                     PAT_ENTRY(2, PAT_UCM) | PAT_ENTRY(3, PAT_UC) |
+                     PAT_ENTRY(4, PAT_WC) | PAT_ENTRY(5, PAT_WT) |
+                     PAT_ENTRY(6, PAT_UCM) | PAT_ENTRY(7, PAT_UC));
+  wbinvd();
+  tlbflush();
+}
+
+//
+// Return the PTE bits that select memory type 'type' (one of MEM_*).
+// Without PAT, write-combining falls back to uncacheable.
+//
+static int
+mem_type_bits(int type) {
+  switch (type) {
+    case MEM_WB:
+      return 0;
+    case MEM_WT:
+      return PTE_PWT;
+    case MEM_WC:
+      if (pat_supported)
+        return PTE_PAT;
+      /* fallthru */
+    case MEM_UC:
+      return PTE_PCD | PTE_PWT;
+    default:
+      panic("mem_type_bits: bad memory type %d", type);
+  }
+}
+
 //
 // Map [va, va+size) of virtual address space to physical [pa, pa+size)
 // in the page table rooted at pgdir.  Size is a multiple of PGSIZE, and
 // va and pa are both page-aligned.
-// Use permission bits perm|PTE_P for the entries.
+// Use permission bits perm|PTE_P for the entries, and memory type
+// 'type' (one of MEM_*).
 //
 // This function is only intended to set up the ``static'' mappings
 // above UTOP. As such, it should *not* change the pp_ref field on the
@@ -698,8 +794,9 @@ pgdir_walk(pde_t *pgdir, const void *va, int create) {
 //
 // Hint: the TA solution uses pgdir_walk
 static void
-boot_map_region(pml4e_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm) {
+boot_map_region(pml4e_t *pml4e, uintptr_t va, size_t size, physaddr_t pa, int perm, int type) {
   // LAB 7: Fill this function in
+  perm |= mem_type_bits(type);
   for (size_t i = 0; i < size; i += PGSIZE) {
     *pml4e_walk(pml4e, (void *)(va + i), 1) = (pa + i) | perm | PTE_P;
   }
@@ -802,6 +899,9 @@ page_remove(pml4e_t *pml4e, void *va) {
   struct PageInfo *pa = page_lookup(pml4e, va, &pte);
   if (!pa)
     return;
+  // Sleepers on this page must not outlive the mapping.
+  if (pa->pp_futex)
+    futex_wake_page(pa);
   page_decref(pa);
   tlb_invalidate(pml4e, va);
   *pte = 0;
@@ -820,14 +920,14 @@ tlb_invalidate(pml4e_t *pml4e, void *va) {
 
 //
 // Reserve size bytes in the MMIO region and map [pa,pa+size) at this
-// location.  Return the base of the reserved region.  size does *not*
-// have to be multiple of PGSIZE.
+// location with memory type 'type' (usually MEM_UC).  Return the base
+// of the reserved region.  size does *not* have to be multiple of PGSIZE.
 //
 
 static uintptr_t base = MMIOBASE;
 
 void *
-mmio_map_region(physaddr_t pa, size_t size) {
+mmio_map_region(physaddr_t pa, size_t size, int type) {
   // Where to start the next region.  Initially, this is the
   // beginning of the MMIO region.  Because this is static, its
   // value will be preserved between calls to mmio_map_region
@@ -856,7 +956,7 @@ mmio_map_region(physaddr_t pa, size_t size) {
     panic("Allocated MMIO addr is too high! [0x%016lu;0x%016lu]", pa, pa + size);
 
   size = ROUNDUP(size + (pa - pa2), PGSIZE);
-  boot_map_region(kern_pml4e, base, size, pa2, PTE_PCD | PTE_PWT | PTE_W);
+  boot_map_region(kern_pml4e, base, size, pa2, PTE_W, type);
 
   void *new = (void *)base;
   base += size;
@@ -55,6 +55,14 @@ enum {
   ALLOC_ZERO = 1 << 0,
 };
 
+// Memory types for boot_map_region and mmio_map_region.
+enum {
+  MEM_WB, // write-back, for ordinary RAM
+  MEM_WT, // write-through
+  MEM_WC, // write-combining, for framebuffers
+  MEM_UC, // uncacheable, for device registers
+};
+
 void mem_init(void);
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -63,6 +71,7 @@ void kasan_mem_init(void);
 
 void page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
+struct PageInfo *page_alloc_contig(size_t n, physaddr_t limit, int alloc_flags);
 void page_free(struct PageInfo *pp);
 int page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
 void page_remove(pml4e_t *pml4e, void *va);
@@ -72,7 +81,7 @@ int page_is_allocated(const struct PageInfo *pp);
 
 void tlb_invalidate(pml4e_t *pml4e, void *va);
 
-void *mmio_map_region(physaddr_t pa, size_t size);
+void *mmio_map_region(physaddr_t pa, size_t size, int type);
 
 int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
@@ -5,6 +5,8 @@
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+
 static void
 putch(int ch, int *cnt) {
   cputchar(ch);
@@ -15,7 +17,10 @@ int
 vcprintf(const char *fmt, va_list ap) {
   int cnt = 0;
 
+  // Drain the whole message at once if the log is synchronous.
+  cons_batch_begin();
   vprintfmt((void *)putch, &cnt, fmt, ap);
+  cons_batch_end();
   return cnt;
 }
 
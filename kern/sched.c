@@ -1,11 +1,33 @@
 #include <inc/assert.h>
+#include <inc/error.h>
 #include <inc/x86.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/klog.h>
+#include <kern/futex.h>
 
 struct Taskstate cpu_ts;
 void sched_halt(void);
 
+// Wake 'e' if it is blocked in a timed IPC receive or futex wait
+// whose deadline has passed.  A receive stays open until the env
+// actually runs, so a sender that gets there first still wins.
+static void
+sched_check_deadline(struct Env *e, uint64_t now) {
+  if (e->env_status != ENV_NOT_RUNNABLE || !e->env_deadline ||
+      now < e->env_deadline)
+    return;
+
+  if (!e->env_ipc_recving) {
+    futex_wakeup(e, -E_TIMEOUT);
+    return;
+  }
+
+  e->env_deadline       = 0;
+  e->env_tf.tf_regs.reg_rax = -E_TIMEOUT;
+  e->env_status             = ENV_RUNNABLE;
+}
+
 // Choose a user environment to run and run it.
 void
 sched_yield(void) {
@@ -26,10 +48,16 @@ sched_yield(void) {
   // LAB 3: Your code here.
 
   int cur = 0;
+  uint64_t now = read_tsc();
   if (curenv)
     cur = ENVX(curenv->env_id);
-  for (int i = 0; i < NENV; ++i) {
+  // Scan from just after curenv round to curenv itself.  An env that
+  // has just blocked with a deadline that has already passed, such as
+  // a zero-timeout receive, is then woken last rather than first,
+  // after the others have had their turn.
+  for (int i = 1; i <= NENV; ++i) {
 		int j = (cur + i) % NENV;
+		sched_check_deadline(envs + j, now);
 		if (envs[j].env_status == ENV_RUNNABLE) {
 			env_run(envs + j);
 		}
@@ -48,12 +76,17 @@ void
 sched_halt(void) {
   int i;
 
+  klog_flush();
+
   // For debugging and testing purposes, if there are no runnable
   // environments in the system, then drop into the kernel monitor.
   for (i = 0; i < NENV; i++) {
     if ((envs[i].env_status == ENV_RUNNABLE ||
          envs[i].env_status == ENV_RUNNING ||
-         envs[i].env_status == ENV_DYING))
+         envs[i].env_status == ENV_DYING ||
+         (envs[i].env_status == ENV_NOT_RUNNABLE &&
+          (envs[i].env_deadline || envs[i].env_cons_wait ||
+           (envs[i].env_poll_flags & (POLLWAIT_CONS | POLLWAIT_DISK))))))
       break;
   }
   if (i == NENV) {
@@ -10,8 +10,13 @@
 #include <kern/trap.h>
 #include <kern/syscall.h>
 #include <kern/console.h>
+#include <kern/klog.h>
 #include <kern/sched.h>
 #include <kern/kclock.h>
+#include <kern/tsc.h>
+#include <kern/futex.h>
+#include <kern/picirq.h>
+#include <kern/fpu.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -23,7 +28,9 @@ sys_cputs(const char *s, size_t len) {
 
   // LAB 8: Your code here.
   user_mem_assert(curenv, s, len, PTE_U);
-  cprintf("%.*s", (int)len, s);
+  // Copied in raw: user text must not set kernel log levels.
+  klog_write(s, len);
+  klog_sync_flush();
 }
 
 // Read a character from the system console without blocking.
@@ -34,6 +41,35 @@ sys_cgetc(void) {
   return cons_getc();
 }
 
+// Read console input into 'buf', blocking until there is some.
+// 'mode' is CONS_RAW or CONS_COOKED (see inc/syscall.h).
+// Returns the number of characters read, 0 at end of file, or
+//  -E_INVAL if 'mode' is invalid.
+// Destroys the environment on memory errors.
+static int
+sys_cons_read(char *buf, size_t n, int mode) {
+  int r;
+
+  if (mode != CONS_RAW && mode != CONS_COOKED)
+    return -E_INVAL;
+  user_mem_assert(curenv, buf, n, PTE_U | PTE_W);
+  if (!n)
+    return 0;
+
+  if (!cons_readable(mode)) {
+    // Sleep until the keyboard or serial interrupt brings input,
+    // then execute the system call again from the start.
+    curenv->env_cons_wait = 1;
+    curenv->env_status    = ENV_NOT_RUNNABLE;
+    curenv->env_tf.tf_rip -= SYSCALL_INSN_LEN;
+    klog_flush();
+    sched_yield();
+  }
+  r = cons_read(buf, n, mode);
+  klog_flush();
+  return r;
+}
+
 // Returns the current environment's envid.
 static envid_t
 sys_getenvid(void) {
@@ -54,14 +90,61 @@ sys_env_destroy(envid_t envid) {
 
 	if ((r = envid2env(envid, &e, 1)) < 0)
 		return r;
-  if (e == curenv)
+  if (e == curenv) {
 		cprintf("[%08x] exiting gracefully\n", curenv->env_id);
+		e->env_exit_status = 0;
+	}
 	else
 		cprintf("[%08x] destroying %08x\n", curenv->env_id, e->env_id);
 	env_destroy(e);
 	return 0;
 }
 
+// Exit the current thread, reporting 'status' to any environment
+// blocked in sys_env_wait on it.  Other threads sharing its address
+// space keep running.  Does not return.
+static void
+sys_thread_exit(int status) {
+  curenv->env_exit_status = status;
+  cprintf("[%08x] exiting gracefully\n", curenv->env_id);
+  env_destroy(curenv);
+}
+
+// Exit the current environment together with every thread sharing
+// its address space, reporting 'status' for the current one.
+// Does not return.
+static void
+sys_env_exit(int status) {
+  struct Env *e;
+
+  for (e = envs; e < envs + NENV; e++) {
+    if (e != curenv && e->env_status != ENV_FREE &&
+        e->env_cr3 == curenv->env_cr3)
+      env_destroy(e);
+  }
+  sys_thread_exit(status);
+}
+
+// Block until environment 'envid' exits, then return 0 with its exit
+// status in the caller's DX register.
+//
+// Returns < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist
+//		(including if it has already exited).
+//	-E_INVAL if envid is the current environment.
+static int
+sys_env_wait(envid_t envid) {
+  struct Env *e;
+
+  if (envid2env(envid, &e, 0) < 0) {
+    return -E_BAD_ENV;
+  }
+  if (e == curenv) {
+    return -E_INVAL;
+  }
+  env_wait(e);
+}
+
 static int
 sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
   struct Env *env;
@@ -107,6 +190,10 @@ sys_exofork(void) {
   if ((res = env_alloc(&e, curenv->env_id)) < 0) {
     return res;
   }
+  if ((res = fpu_fork(e)) < 0) {
+    env_free(e);
+    return res;
+  }
 
   e->env_status = ENV_NOT_RUNNABLE;
   e->env_tf = curenv->env_tf;
@@ -117,6 +204,39 @@ sys_exofork(void) {
   return e->env_id;
 }
 
+// Create a thread: a runnable environment sharing the current
+// environment's address space and page fault upcall.  It starts at
+// 'rip' on stack 'rsp' with 'arg0' and 'arg1' in its first two
+// argument registers, and takes page faults on the exception stack
+// page just below 'uxstacktop'.
+//
+// Returns the new thread's envid, < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+//	-E_INVAL if rip, rsp or uxstacktop is above UTOP,
+//		or uxstacktop is not page-aligned.
+static envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  struct Env *e;
+  int r;
+
+  if (rip >= UTOP || rsp > UTOP || uxstacktop > UTOP ||
+      uxstacktop < PGSIZE || uxstacktop % PGSIZE)
+    return -E_INVAL;
+  if ((r = env_alloc(&e, curenv->env_id)) < 0)
+    return r;
+  env_share_vm(e, curenv);
+
+  e->env_tf.tf_rip          = rip;
+  e->env_tf.tf_rsp          = rsp;
+  e->env_tf.tf_regs.reg_rdi = arg0;
+  e->env_tf.tf_regs.reg_rsi = arg1;
+  e->env_pgfault_upcall     = curenv->env_pgfault_upcall;
+  e->env_uxstacktop         = uxstacktop;
+  return e->env_id;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -155,11 +275,16 @@ sys_env_set_status(envid_t envid, int status) {
 static int
 sys_env_set_pgfault_upcall(envid_t envid, void *func) {
   // LAB 9: Your code here.
-  struct Env *e;
+  struct Env *e, *t;
   if (envid2env(envid, &e, 1) < 0) {
     return -E_BAD_ENV;
   }
-  e->env_pgfault_upcall = func;
+  // The upcall runs code in the address space, so every thread
+  // sharing it gets the same one.
+  for (t = envs; t < envs + NENV; t++) {
+    if (t->env_status != ENV_FREE && t->env_cr3 == e->env_cr3)
+      t->env_pgfault_upcall = func;
+  }
   return 0;
 }
 
@@ -288,6 +413,175 @@ sys_page_unmap(envid_t envid, void *va) {
   return 0;
 }
 
+// Allocate 'npages' pages of memory and map them at 'va' and up in
+// the address space of 'envid', as that many sys_page_alloc calls
+// would.  If one of them fails, the pages mapped so far are unmapped
+// again.
+//
+// Return 0 on success, < 0 on error.  Errors are those of
+// sys_page_alloc, and -E_INVAL if the range reaches past UTOP or
+// npages is above PAGE_ALLOC_RANGE_MAX.
+static int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  struct PageInfo *pp;
+  struct Env *e;
+  size_t i;
+
+  if (envid2env(envid, &e, 1) < 0)
+    return -E_BAD_ENV;
+  if ((uintptr_t)va >= UTOP || PGOFF(va) || npages > PAGE_ALLOC_RANGE_MAX ||
+      npages > (UTOP - (uintptr_t)va) / PGSIZE)
+    return -E_INVAL;
+  if (perm & ~PTE_SYSCALL)
+    return -E_INVAL;
+
+  for (i = 0; i < npages; i++) {
+    if (!(pp = page_alloc(ALLOC_ZERO)))
+      goto fail;
+    if (page_insert(e->env_pml4e, pp, va + i * PGSIZE, perm | PTE_U) < 0) {
+      page_free(pp);
+      goto fail;
+    }
+  }
+  return 0;
+
+fail:
+  while (i > 0)
+    page_remove(e->env_pml4e, va + --i * PGSIZE);
+  return -E_NO_MEM;
+}
+
+// Clear the PTE_A and PTE_D bits given in 'bits' for the 'npages'
+// pages at 'va' and up in the caller's address space, so that it can
+// tell whether they are used or written from now on.  Pages that are
+// not mapped are skipped.  Unlike remapping a page in place with
+// sys_page_map, this leaves the other bit alone.
+//
+// Return 0 on success, or -E_INVAL if va is not page-aligned, the
+// range reaches past UTOP, or bits has other bits set.
+static int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  pte_t *pte;
+  size_t i;
+
+  if ((uintptr_t)va >= UTOP || PGOFF(va) || npages > (UTOP - (uintptr_t)va) / PGSIZE)
+    return -E_INVAL;
+  if (bits & ~(PTE_A | PTE_D))
+    return -E_INVAL;
+
+  for (i = 0; i < npages; i++) {
+    if (page_lookup(curenv->env_pml4e, va + i * PGSIZE, &pte) && (*pte & bits)) {
+      *pte &= ~bits;
+      tlb_invalidate(curenv->env_pml4e, va + i * PGSIZE);
+    }
+  }
+  return 0;
+}
+
+// Store the physical addresses of the 'npages' pages mapped at 'va'
+// and up in the caller's address space into 'pa', so that the file
+// system server can point the disk's DMA engine at them.  An address
+// stays good only while the page remains mapped there.
+//
+// Return 0 on success, or
+//	-E_BAD_ENV if the caller is not the file system server.
+//	-E_INVAL if va is not page-aligned, the range reaches past UTOP,
+//		or some page in it is not mapped.
+// Destroys the environment if pa is not mapped writable.
+static int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  struct PageInfo *pp;
+  size_t i;
+
+  if (curenv->env_type != ENV_TYPE_FS)
+    return -E_BAD_ENV;
+  if ((uintptr_t)va >= UTOP || PGOFF(va) || npages > (UTOP - (uintptr_t)va) / PGSIZE)
+    return -E_INVAL;
+  user_mem_assert(curenv, pa, npages * sizeof(*pa), PTE_U | PTE_W);
+
+  for (i = 0; i < npages; i++) {
+    if (!(pp = page_lookup(curenv->env_pml4e, va + i * PGSIZE, NULL)))
+      return -E_INVAL;
+    pa[i] = page2pa(pp);
+  }
+  return 0;
+}
+
+// Allocate 'npages' physically contiguous, zeroed pages below 4GB,
+// which any DMA engine can reach, map them at 'va' and up in the
+// caller's address space with permission 'perm', and store the
+// physical address of the first one in '*pa'.
+//
+// Return 0 on success, or
+//	-E_BAD_ENV if the caller is not the file system server.
+//	-E_INVAL if va is not page-aligned, the range reaches past UTOP,
+//		or perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if there is no such run of free pages, or no memory
+//		for page tables.
+// Destroys the environment if pa is not mapped writable.
+static int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  struct PageInfo *pp;
+  size_t i, j;
+
+  if (curenv->env_type != ENV_TYPE_FS)
+    return -E_BAD_ENV;
+  if ((uintptr_t)va >= UTOP || PGOFF(va) || !npages ||
+      npages > (UTOP - (uintptr_t)va) / PGSIZE)
+    return -E_INVAL;
+  if (perm & ~PTE_SYSCALL)
+    return -E_INVAL;
+  user_mem_assert(curenv, pa, sizeof(*pa), PTE_U | PTE_W);
+
+  if (!(pp = page_alloc_contig(npages, 0x100000000ULL, ALLOC_ZERO)))
+    return -E_NO_MEM;
+  for (i = 0; i < npages; i++) {
+    if (page_insert(curenv->env_pml4e, pp + i, va + i * PGSIZE, perm | PTE_U) < 0) {
+      // Unmapping frees the pages mapped so far; free the rest.
+      for (j = i; j < npages; j++)
+        page_free(pp + j);
+      while (i > 0)
+        page_remove(curenv->env_pml4e, va + --i * PGSIZE);
+      return -E_NO_MEM;
+    }
+  }
+  *pa = page2pa(pp);
+  return 0;
+}
+
+// Deliver IRQ 'irq' to the file system server as POLLWAIT_DISK
+// events, instead of the one it asked for before.  The line stays
+// masked until the server first polls for POLLWAIT_DISK.
+//
+// Return 0 on success, or
+//	-E_BAD_ENV if the caller is not the file system server.
+//	-E_INVAL if irq is not one of DISK_IRQS.
+static int
+sys_disk_irq(int irq) {
+  if (curenv->env_type != ENV_TYPE_FS)
+    return -E_BAD_ENV;
+  if (irq < 0 || irq >= MAX_IRQS || !(DISK_IRQS & (1 << irq)))
+    return -E_INVAL;
+
+  if (disk_irq >= 0)
+    irq_set_masked(disk_irq, 1);
+  disk_irq         = irq;
+  disk_irq_pending = 0;
+  return 0;
+}
+
+// Convert a timeout in nanoseconds from now into a TSC deadline
+// for env_deadline.  Never returns 0, which means "no deadline".
+static uint64_t
+timeout_deadline(uint64_t timeout) {
+  uint64_t now   = read_tsc();
+  uint64_t ticks = tsc_ns_to_ticks(timeout);
+
+  if (ticks > ~0UL - now)
+    return ~0UL;
+  return now + ticks ? now + ticks : 1;
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -337,6 +631,12 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm) {
     return -E_BAD_ENV;
   }
   if (!e->env_ipc_recving) {
+    // Let a poller know someone has something for it;
+    // we will get through once it calls sys_ipc_recv.
+    if (e->env_status == ENV_NOT_RUNNABLE &&
+        (e->env_poll_flags & POLLWAIT_IPC)) {
+      futex_wakeup(e, POLLWAIT_IPC);
+    }
     return -E_IPC_NOT_RECV;
   }
   if ((uintptr_t) srcva < UTOP) {
@@ -363,9 +663,12 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm) {
     e->env_ipc_perm = 0;
   }
   e->env_ipc_recving = 0;
+  e->env_deadline = 0;
   e->env_ipc_from = curenv->env_id;
   e->env_ipc_value = value;
   e->env_status = ENV_RUNNABLE;
+  // A timed receive may already have expired and be waiting to run.
+  e->env_tf.tf_regs.reg_rax = 0;
   return 0;
 }
 
@@ -395,6 +698,122 @@ sys_ipc_recv(void *dstva) {
   return -1;
 }
 
+// Like sys_ipc_recv, but give up after 'timeout' nanoseconds.
+// The deadline is checked by the scheduler, so the actual wait is
+// rounded up to the next scheduling point.
+//
+// A zero timeout polls: the caller gives up the CPU, and the call
+// fails when the scheduler's scan next comes round to it, unless a
+// sender got there first.  No env is guaranteed to run before that.
+//
+// Return < 0 on error.  Errors are:
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_TIMEOUT if nothing was received before the deadline.
+static int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  if ((uintptr_t)dstva < UTOP && PGOFF(dstva)) {
+    return -E_INVAL;
+  }
+
+  curenv->env_ipc_recving = 1;
+  curenv->env_ipc_dstva = dstva;
+  curenv->env_deadline = timeout_deadline(timeout);
+  curenv->env_status = ENV_NOT_RUNNABLE;
+  curenv->env_tf.tf_regs.reg_rax = 0;
+  sched_yield();
+}
+
+// Block until another environment calls sys_futex_wake on the
+// 32-bit word at 'addr', as long as the word still holds 'expected'.
+// 'addr' is matched by physical address, so the waker may use
+// a different mapping of a PTE_SHARE page.
+// Gives up after 'timeout' nanoseconds unless it is FUTEX_NO_TIMEOUT.
+//
+// Returns 0 when woken up, or at once if *addr != expected, or
+//	-E_INVAL if addr is not 4-byte aligned.
+//	-E_TIMEOUT if the timeout expired first.
+// Destroys the environment if addr is not mapped readable.
+static int
+sys_futex_wait(uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  if ((uintptr_t)addr % sizeof(uint32_t))
+    return -E_INVAL;
+  user_mem_assert(curenv, addr, sizeof(uint32_t), PTE_U);
+
+  if (*addr != expected)
+    return 0;
+  if (!timeout)
+    return -E_TIMEOUT;
+  futex_enqueue(addr);
+  futex_wait(0, timeout == FUTEX_NO_TIMEOUT ? 0 : timeout_deadline(timeout));
+}
+
+// Wake up to 'n' environments blocked in sys_futex_wait on 'addr'.
+// Returns the number woken, or
+//	-E_INVAL if addr is not 4-byte aligned.
+// Destroys the environment if addr is not mapped readable.
+static int
+sys_futex_wake(uint32_t *addr, int n) {
+  if ((uintptr_t)addr % sizeof(uint32_t))
+    return -E_INVAL;
+  user_mem_assert(curenv, addr, sizeof(uint32_t), PTE_U);
+
+  return futex_wake(addr, n);
+}
+
+// Block until any of several events happens: a sys_futex_wake on
+// one of the 'n' words in 'keys', or one of the POLLWAIT_* events
+// in 'flags'.  Does not sleep at all if some key no longer holds its
+// value or the console is already readable.  Gives up after
+// 'timeout' nanoseconds unless it is FUTEX_NO_TIMEOUT;
+// a zero timeout just checks.
+//
+// POLLWAIT_DISK is only for the file system server; a disk interrupt
+// that came while it was not polling is remembered and returned by
+// its next call.  Otherwise the disk's IRQ line, masked since its
+// last interrupt, is unmasked again.
+//
+// Returns 0 if woken through a futex or a key had changed,
+// the POLLWAIT_* flag of the event that happened, or
+//	-E_INVAL if n is too big, a key is not 4-byte aligned, or
+//		POLLWAIT_DISK is asked for by another env.
+//	-E_TIMEOUT if the timeout expired first.
+// Destroys the environment if keys or the words they point to
+// are not mapped readable.
+static int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  int i;
+
+  if (n < 0 || n > FUTEX_MAXKEYS)
+    return -E_INVAL;
+  if ((flags & POLLWAIT_DISK) && curenv->env_type != ENV_TYPE_FS)
+    return -E_INVAL;
+  user_mem_assert(curenv, keys, n * sizeof(*keys), PTE_U);
+  for (i = 0; i < n; i++) {
+    if ((uintptr_t)keys[i].pk_addr % sizeof(uint32_t))
+      return -E_INVAL;
+    user_mem_assert(curenv, (void *)keys[i].pk_addr, sizeof(uint32_t), PTE_U);
+    if (*keys[i].pk_addr != keys[i].pk_val)
+      return 0;
+  }
+  if ((flags & POLLWAIT_CONS) &&
+      cons_readable(flags & POLLWAIT_CONS_COOKED ? CONS_COOKED : CONS_RAW))
+    return POLLWAIT_CONS;
+  if (flags & POLLWAIT_DISK) {
+    if (disk_irq_pending) {
+      disk_irq_pending = 0;
+      return POLLWAIT_DISK;
+    }
+    if (disk_irq >= 0)
+      irq_set_masked(disk_irq, 0);
+  }
+  if (!timeout)
+    return -E_TIMEOUT;
+
+  for (i = 0; i < n; i++)
+    futex_enqueue(keys[i].pk_addr);
+  futex_wait(flags, timeout == FUTEX_NO_TIMEOUT ? 0 : timeout_deadline(timeout));
+}
+
 // Return date and time in UNIX timestamp format: seconds passed
 // from 1970-01-01 00:00:00 UTC.
 static int
@@ -403,6 +822,16 @@ sys_gettime(void) {
   return gettime();
 }
 
+// Copy the most recent kernel log messages into 'buf',
+// at most 'len' bytes of them.
+// Returns the number of bytes copied.
+static int
+sys_klog_read(char *buf, size_t len) {
+  len = MIN(len, KLOG_BUFSIZE);
+  user_mem_assert(curenv, buf, len, PTE_U | PTE_W);
+  return klog_read(buf, len);
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 uintptr_t
 syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5) {
@@ -424,14 +853,34 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
     case SYS_env_destroy:
       return sys_env_destroy(a1);
       break;
+    case SYS_env_exit:
+      sys_env_exit(a1);
+      return 0;
+    case SYS_thread_exit:
+      sys_thread_exit(a1);
+      return 0;
+    case SYS_env_wait:
+      return sys_env_wait(a1);
     case SYS_page_alloc:
       return sys_page_alloc(a1, (void *) a2, a3);
     case SYS_page_map:
       return sys_page_map(a1, (void *)a2, a3, (void *)a4, a5);
     case SYS_page_unmap:
       return sys_page_unmap(a1, (void *)a2);
+    case SYS_page_alloc_range:
+      return sys_page_alloc_range(a1, (void *)a2, a3, a4);
+    case SYS_page_clear_bits:
+      return sys_page_clear_bits((void *)a1, a2, a3);
+    case SYS_page_phys:
+      return sys_page_phys((void *)a1, a2, (physaddr_t *)a3);
+    case SYS_page_alloc_dma:
+      return sys_page_alloc_dma((void *)a1, a2, a3, (physaddr_t *)a4);
+    case SYS_disk_irq:
+      return sys_disk_irq(a1);
     case SYS_exofork:
       return sys_exofork();
+    case SYS_thread_create:
+      return sys_thread_create(a1, a2, a3, a4, a5);
     case SYS_env_set_status:
       return sys_env_set_status(a1, a2);
     case SYS_env_set_pgfault_upcall:
@@ -445,8 +894,20 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
       return sys_ipc_try_send(a1, a2, (void *)a3, a4);
     case SYS_ipc_recv:
       return sys_ipc_recv((void *)a1);
+    case SYS_ipc_recv_timeout:
+      return sys_ipc_recv_timeout((void *)a1, a2);
     case SYS_gettime:
       return sys_gettime();
+    case SYS_klog_read:
+      return sys_klog_read((char *)a1, a2);
+    case SYS_cons_read:
+      return sys_cons_read((char *)a1, a2, a3);
+    case SYS_futex_wait:
+      return sys_futex_wait((uint32_t *)a1, a2, a3);
+    case SYS_futex_wake:
+      return sys_futex_wake((uint32_t *)a1, a2);
+    case SYS_poll_wait:
+      return sys_poll_wait((const struct PollKey *)a1, a2, a3, a4);
     default:
       return -E_INVAL;
   }
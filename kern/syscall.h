@@ -6,6 +6,11 @@
 
 #include <inc/syscall.h>
 
+// Length of the "int $T_SYSCALL" instruction.  Backing the saved rip
+// up by this much makes a blocked system call start over when the
+// environment next runs.
+#define SYSCALL_INSN_LEN 2
+
 uintptr_t syscall(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5);
 
 #endif /* !JOS_KERN_SYSCALL_H */
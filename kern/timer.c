@@ -22,16 +22,28 @@
 // Early variant of memory mapping that does 1:1 aligned area mapping
 // in 2MB pages. You will need to reimplement this code with proper
 // virtual memory mapping in the future.
+// The PAT is not programmed yet, so 'type' is given with PWT and PCD
+// alone and MEM_WC falls back to uncacheable.
 static void *
-mmio_map_region(physaddr_t pa, size_t size) {
+mmio_map_region(physaddr_t pa, size_t size, int type) {
   void map_addr_early_boot(uintptr_t addr, uintptr_t addr_phys, size_t sz);
+  extern uintptr_t pml4phys;
   const physaddr_t base_2mb = 0x200000;
-  uintptr_t org             = pa;
+  uintptr_t org             = pa, va;
+  pdpe_t *pdpt;
+  pde_t *pde;
   size += pa & (base_2mb - 1);
   size += (base_2mb - 1);
   pa &= ~(base_2mb - 1);
   size &= ~(base_2mb - 1);
   map_addr_early_boot(pa, pa, size);
+
+  pdpt = (pdpe_t *)PTE_ADDR((&pml4phys)[PML4(pa)]);
+  for (va = pa; va < pa + size; va += base_2mb) {
+    pde = (pde_t *)PTE_ADDR(pdpt[PDPE(va)]);
+    pde[PDX(va)] |= type == MEM_WB ? 0 : type == MEM_WT ? PTE_PWT : PTE_PCD | PTE_PWT;
+    invlpg((void *)va);
+  }
   return (void *)org;
 }
 #endif
@@ -101,7 +113,7 @@ get_rsdp(void) {
   if (uefi_lp->ACPIRoot == 0)
     panic("No rsdp\n");
 
-  krsdp = mmio_map_region(uefi_lp->ACPIRoot, sizeof(RSDP));
+  krsdp = mmio_map_region(uefi_lp->ACPIRoot, sizeof(RSDP), MEM_UC);
   return krsdp;
 }
 
@@ -125,8 +137,8 @@ find_entry_by_signature(char *sig) {
     rsd_table = rsd_pointer->RsdtAddress;
   }
   if (!krsdt) {
-    krsdt = mmio_map_region(rsd_table, sizeof(RSDT));
-    krsdt = mmio_map_region(rsd_table, ((RSDT *)krsdt)->h.Length);
+    krsdt = mmio_map_region(rsd_table, sizeof(RSDT), MEM_UC);
+    krsdt = mmio_map_region(rsd_table, ((RSDT *)krsdt)->h.Length, MEM_UC);
     entries = (((RSDT *)krsdt)->h.Length - sizeof(((RSDT *)krsdt)->h)) / entry_size;
   }
 
@@ -135,8 +147,8 @@ find_entry_by_signature(char *sig) {
       memcpy(&h_phys, (uint8_t *)((RSDT *)krsdt)->PointerToOtherSDT + i * entry_size, entry_size);
       ACPISDTHeader *h_virtual;
 
-      h_virtual = mmio_map_region(h_phys, sizeof(ACPISDTHeader));
-      h_virtual = mmio_map_region(h_phys, h_virtual->Length);
+      h_virtual = mmio_map_region(h_phys, sizeof(ACPISDTHeader), MEM_UC);
+      h_virtual = mmio_map_region(h_phys, h_virtual->Length, MEM_UC);
       if (!strncmp(h_virtual->Signature, sig, 4))
           return h_virtual;
   }
@@ -166,7 +178,7 @@ hpet_register(void) {
     panic("hpet is unavailable\n");
 
   uintptr_t paddr = hpet_timer->address.address;
-  return mmio_map_region(paddr, sizeof(HPETRegister));
+  return mmio_map_region(paddr, sizeof(HPETRegister), MEM_UC);
 }
 
 // Debug HPET timer state.
@@ -7,6 +7,8 @@
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/console.h>
+#include <kern/klog.h>
+#include <kern/fpu.h>
 #include <kern/monitor.h>
 #include <kern/env.h>
 #include <kern/syscall.h>
@@ -16,6 +18,7 @@
 #include <kern/cpu.h>
 #include <kern/timer.h>
 #include <kern/vsyscall.h>
+#include <kern/futex.h>
 
 extern uintptr_t gdtdesc_64;
 static struct Taskstate ts;
@@ -35,6 +38,11 @@ struct Gatedesc idt[256] = {{0}};
 struct Pseudodesc idt_pd = {
     sizeof(idt) - 1, (uint64_t)idt};
 
+// The IRQ delivered to the file system server as POLLWAIT_DISK, or
+// -1, and whether one came while nobody was polling for it.
+int disk_irq = -1;
+bool disk_irq_pending;
+
 static const char *
 trapname(int trapno) {
   static const char *const excnames[] = {
@@ -90,6 +98,11 @@ trap_init(void) {
   extern void (*syscall_thdlr)(void);
   extern void (*kbd_thdlr)(void);
   extern void (*serial_thdlr)(void);
+  extern void (*irq5_thdlr)(void);
+  extern void (*irq9_thdlr)(void);
+  extern void (*irq10_thdlr)(void);
+  extern void (*irq11_thdlr)(void);
+  extern void (*ide_thdlr)(void);
 
 	SETGATE(idt[T_DIVIDE], 0, GD_KT, (uint64_t) &divide_thdlr, 0);
 	SETGATE(idt[T_DEBUG], 0, GD_KT, (uint64_t) &debug_thdlr, 0);
@@ -109,6 +122,13 @@ trap_init(void) {
   SETGATE(idt[T_SYSCALL], 0, GD_KT, (uint64_t) &syscall_thdlr, 3);
   SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, &kbd_thdlr, 3);
   SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, &serial_thdlr, 3);
+  // Lines a disk may interrupt on: IDE, and those the firmware
+  // hands out to PCI devices.  They stay masked until sys_disk_irq.
+  SETGATE(idt[IRQ_OFFSET + 5], 0, GD_KT, &irq5_thdlr, 0);
+  SETGATE(idt[IRQ_OFFSET + 9], 0, GD_KT, &irq9_thdlr, 0);
+  SETGATE(idt[IRQ_OFFSET + 10], 0, GD_KT, &irq10_thdlr, 0);
+  SETGATE(idt[IRQ_OFFSET + 11], 0, GD_KT, &irq11_thdlr, 0);
+  SETGATE(idt[IRQ_OFFSET + IRQ_IDE], 0, GD_KT, &ide_thdlr, 0);
   // Per-CPU setup
   trap_init_percpu();
 }
@@ -219,6 +239,11 @@ trap_dispatch(struct Trapframe *tf) {
     return;
   }
 
+  if (tf->tf_trapno == T_DEVICE) {
+    fpu_trap(tf);
+    return;
+  }
+
   // Handle spurious interrupts
   // The hardware sometimes raises these because of noise on the
   // IRQ line or other reasons. We don't care.
@@ -239,6 +264,7 @@ trap_dispatch(struct Trapframe *tf) {
     vsys[VSYS_gettime] = gettime();
     pic_send_eoi(IRQ_CLOCK);
     timer_for_schedule->handle_interrupts();
+    klog_flush();
     sched_yield();
     return;
   }
@@ -248,12 +274,27 @@ trap_dispatch(struct Trapframe *tf) {
   if (tf->tf_trapno == IRQ_OFFSET + IRQ_KBD) {
     kbd_intr();
     pic_send_eoi(IRQ_KBD);
+    klog_flush();
     sched_yield();
     return;
   }
   if (tf->tf_trapno == IRQ_OFFSET + IRQ_SERIAL) {
     serial_intr();
     pic_send_eoi(IRQ_SERIAL);
+    klog_flush();
+    sched_yield();
+    return;
+  }
+
+  // The disk is driven by the file system server; tell it that a
+  // transfer has finished.  A PCI line stays asserted until the
+  // server acknowledges the device, so it stays masked till then:
+  // sys_poll_wait unmasks it.
+  if (disk_irq >= 0 && tf->tf_trapno == IRQ_OFFSET + disk_irq) {
+    irq_set_masked(disk_irq, 1);
+    pic_send_eoi(disk_irq);
+    if (!futex_wake_poll(POLLWAIT_DISK))
+      disk_irq_pending = 1;
     sched_yield();
     return;
   }
@@ -287,22 +328,24 @@ trap(struct Trapframe *tf) {
     cprintf("Incoming TRAP frame at %p\n", tf);
   }
 
-  assert(curenv);
+  // curenv is NULL if the interrupt woke up a halted CPU
+  // (see sched_halt), in which case there is no state to save.
+  if (curenv) {
+    // Garbage collect if current enviroment is a zombie
+    if (curenv->env_status == ENV_DYING) {
+      env_free(curenv);
+      curenv = NULL;
+      sched_yield();
+    }
 
-  // Garbage collect if current enviroment is a zombie
-  if (curenv->env_status == ENV_DYING) {
-    env_free(curenv);
-    curenv = NULL;
-    sched_yield();
+    // Copy trap frame (which is currently on the stack)
+    // into 'curenv->env_tf', so that running the environment
+    // will restart at the trap point.
+    curenv->env_tf = *tf;
+    // The trapframe on the stack should be ignored from here on.
+    tf = &curenv->env_tf;
   }
 
-  // Copy trap frame (which is currently on the stack)
-  // into 'curenv->env_tf', so that running the environment
-  // will restart at the trap point.
-  curenv->env_tf = *tf;
-  // The trapframe on the stack should be ignored from here on.
-  tf = &curenv->env_tf;
-
   // Record that tf is the last real trapframe so
   // print_trapframe can print some additional information.
   last_tf = tf;
@@ -338,9 +381,11 @@ page_fault_handler(struct Trapframe *tf) {
   uintptr_t uxrsp;
 
   if (curenv->env_pgfault_upcall) {
-    uxrsp = UXSTACKTOP;
-    if (tf->tf_rsp < UXSTACKTOP && tf->tf_rsp >= UXSTACKTOP - PGSIZE) {
-      uxrsp = tf->tf_rsp - sizeof(uintptr_t);
+    uxrsp = curenv->env_uxstacktop;
+    if (tf->tf_rsp < uxrsp && tf->tf_rsp >= uxrsp - PGSIZE) {
+      // Leave the scratch word, and keep the handler's stack
+      // 16-byte aligned as the calling convention requires.
+      uxrsp = ROUNDDOWN(tf->tf_rsp - sizeof(uintptr_t), 16);
     }
     uxrsp -= sizeof(struct UTrapframe);
     utf = (struct UTrapframe*) uxrsp;
@@ -13,6 +13,12 @@
 extern struct Gatedesc idt[];
 extern struct Pseudodesc idt_pd;
 
+// IRQs that can be routed to the file system server by sys_disk_irq
+#define DISK_IRQS ((1 << 5) | (1 << 9) | (1 << 10) | (1 << 11) | (1 << IRQ_IDE))
+
+extern int disk_irq;
+extern bool disk_irq_pending;
+
 void clock_idt_init(void);
 void trap_init(void);
 void trap_init_percpu(void);
@@ -188,6 +188,16 @@ tsc_calibrate(void) {
   return cpu_freq * 1000;
 }
 
+// Convert a duration in nanoseconds to TSC ticks.
+uint64_t
+tsc_ns_to_ticks(uint64_t ns) {
+  uint64_t freq = tsc_calibrate();
+
+  if (ns / 1000000000 > ~0UL / freq)
+    return ~0UL;
+  return ns / 1000000000 * freq + ns % 1000000000 * freq / 1000000000;
+}
+
 void
 print_time(unsigned seconds) {
   cprintf("%u\n", seconds);
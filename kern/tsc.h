@@ -7,6 +7,7 @@
 #endif
 
 uint64_t tsc_calibrate(void);
+uint64_t tsc_ns_to_ticks(uint64_t ns);
 void timer_start(const char *name);
 void timer_stop(void);
 void timer_cpu_frequency(const char *name);
@@ -35,6 +35,7 @@ static ssize_t devcons_read(struct Fd *, void *, size_t);
 static ssize_t devcons_write(struct Fd *, const void *, size_t);
 static int devcons_close(struct Fd *);
 static int devcons_stat(struct Fd *, struct Stat *);
+static int devcons_poll(struct Fd *, int, struct PollWait *);
 
 struct Dev devcons =
     {
@@ -43,7 +44,8 @@ struct Dev devcons =
         .dev_read  = devcons_read,
         .dev_write = devcons_write,
         .dev_close = devcons_close,
-        .dev_stat  = devcons_stat};
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
 
 int
 iscons(int fdnum) {
@@ -64,26 +66,34 @@ opencons(void) {
     return r;
   if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
     return r;
-  fd->fd_dev_id = devcons.dev_id;
-  fd->fd_omode  = O_RDWR;
+  fd->fd_dev_id    = devcons.dev_id;
+  fd->fd_omode     = O_RDWR;
+  fd->fd_cons.mode = CONS_RAW;
   return fd2num(fd);
 }
 
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  if (fd->fd_dev_id != devcons.dev_id)
+    return -E_INVAL;
+  r                = fd->fd_cons.mode;
+  fd->fd_cons.mode = mode;
+  return r;
+}
+
 static ssize_t
 devcons_read(struct Fd *fd, void *vbuf, size_t n) {
-  int c;
-
-  if (n == 0)
-    return 0;
-
-  while ((c = sys_cgetc()) == 0)
-    sys_yield();
-  if (c < 0)
-    return c;
-  if (c == 0x04) // ctl-d is eof
-    return 0;
-  *(char *)vbuf = c;
-  return 1;
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
 }
 
 static ssize_t
@@ -115,3 +125,19 @@ devcons_stat(struct Fd *fd, struct Stat *stat) {
   strcpy(stat->st_name, "<cons>");
   return 0;
 }
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  int flags   = POLLWAIT_CONS;
+  int revents = events & POLLOUT;
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+    flags |= POLLWAIT_CONS_COOKED;
+  if (events & POLLIN) {
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+      revents |= POLLIN;
+    else
+      w->pw_flags |= flags;
+  }
+  return revents;
+}
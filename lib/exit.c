@@ -4,5 +4,5 @@
 void
 exit(void) {
   close_all();
-  sys_env_destroy(0);
+  sys_env_exit(0);
 }
@@ -1,17 +1,15 @@
 #include <inc/lib.h>
 
-// Maximum number of file descriptors a program may hold open concurrently
-#define MAXFD 32
 // Bottom of file descriptor area
 #define FDTABLE 0xD0000000ll
-// Bottom of file data area.  We reserve one data page for each FD,
-// which devices can use if they choose.
+// Bottom of file data area.  We reserve FDDATASIZE bytes for each FD,
+// which devices can map pages into if they choose.
 #define FILEDATA (FDTABLE + MAXFD * PGSIZE)
 
 // Return the 'struct Fd*' for file descriptor index i
 #define INDEX2FD(i) ((struct Fd *)(FDTABLE + (i)*PGSIZE))
-// Return the file data page for file descriptor index i
-#define INDEX2DATA(i) ((char *)(FILEDATA + (i)*PGSIZE))
+// Return the file data area for file descriptor index i
+#define INDEX2DATA(i) ((char *)(FILEDATA + (i)*FDDATASIZE))
 
 // --------------------------------------------------------------
 // File descriptor manipulators
@@ -162,6 +160,7 @@ close_all(void) {
 int
 dup(int oldfdnum, int newfdnum) {
   int r;
+  size_t off;
   char *ova, *nva;
   struct Fd *oldfd, *newfd;
 
@@ -173,10 +172,15 @@ dup(int oldfdnum, int newfdnum) {
   ova   = fd2data(oldfd);
   nva   = fd2data(newfd);
 
-  if ((uvpml4e[VPML4E(ova)] & PTE_P) && (uvpde[VPDPE(ova)] & PTE_P) &&
-      (uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
-    if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
-      goto err;
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+    off -= PGSIZE;
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+        goto err;
+  }
   if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
     goto err;
 
@@ -184,7 +188,8 @@ dup(int oldfdnum, int newfdnum) {
 
 err:
   sys_page_unmap(0, newfd);
-  sys_page_unmap(0, nva);
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+    sys_page_unmap(0, nva + off);
   return r;
 }
 
@@ -284,6 +289,78 @@ fstat(int fdnum, struct Stat *stat) {
   return (*dev->dev_stat)(fd, stat);
 }
 
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+    return -E_INVAL;
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  w->pw_nkeys++;
+  return 0;
+}
+
+// Wait until one of the 'nfds' entries in 'fds' is ready, or for
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  int i, r, ready, ipc = 0;
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+    now      = vsys_clock_ns();
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+    w.pw_flags = 0;
+    ready      = 0;
+    for (i = 0; i < nfds; i++) {
+      fds[i].revents = 0;
+      if (fds[i].fd == POLLFD_IPC) {
+        if (fds[i].events & POLLIN) {
+          fds[i].revents = ipc;
+          w.pw_flags |= POLLWAIT_IPC;
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+        fds[i].revents = POLLNVAL;
+      } else if (dev->dev_poll) {
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+          return r;
+        fds[i].revents = r;
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+      }
+      if (fds[i].revents)
+        ready++;
+    }
+    if (ready)
+      return ready;
+
+    if (deadline) {
+      now     = vsys_clock_ns();
+      timeout = now < deadline ? deadline - now : 0;
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+    if (r == -E_TIMEOUT)
+      return 0;
+    if (r < 0)
+      return r;
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  }
+}
+
 int
 stat(const char *path, struct Stat *stat) {
   int fd, r;
@@ -30,6 +30,7 @@ static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
 static int devfile_trunc(struct Fd *fd, off_t newsize);
+static int devfile_poll(struct Fd *fd, int events, struct PollWait *w);
 
 struct Dev devfile =
     {
@@ -39,7 +40,8 @@ struct Dev devfile =
         .dev_close = devfile_flush,
         .dev_stat  = devfile_stat,
         .dev_write = devfile_write,
-        .dev_trunc = devfile_trunc};
+        .dev_trunc = devfile_trunc,
+        .dev_poll  = devfile_poll};
 
 // Open a file (or directory).
 //
@@ -205,6 +207,21 @@ devfile_trunc(struct Fd *fd, off_t newsize) {
   return fsipc(FSREQ_SET_SIZE, NULL);
 }
 
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  return events & (POLLIN | POLLOUT);
+}
+
+// Delete a file
+int
+remove(const char *path) {
+  if (strlen(path) >= MAXPATHLEN)
+    return -E_BAD_PATH;
+  strcpy(fsipcbuf.remove.req_path, path);
+  return fsipc(FSREQ_REMOVE, NULL);
+}
+
 // Synchronize disk with buffer cache
 int
 sync(void) {
@@ -213,3 +230,29 @@ sync(void) {
 
   return fsipc(FSREQ_SYNC, NULL);
 }
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+    return r;
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  return 0;
+}
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  return fsipc(FSREQ_SET_CACHE, NULL);
+}
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  fsipcbuf.set_dma.req_on = on;
+  return fsipc(FSREQ_SET_DMA, NULL);
+}
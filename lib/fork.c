@@ -27,8 +27,13 @@ pgfault(struct UTrapframe *utf) {
   // LAB 9: Your code here.
   void *addr = (void *) utf->utf_fault_va;
   uint64_t err = utf->utf_err;
+  void *tmp;
   int r;
 
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+    return;
   if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
     panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
   }
@@ -42,21 +47,26 @@ pgfault(struct UTrapframe *utf) {
   //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
 
   // LAB 9: Your code here.
-  if ((r = sys_page_alloc(0, (void *) PFTEMP, PTE_W)) < 0) {
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
     panic("pgfault error: sys_page_alloc: %i\n", r);
   }
 
 #ifdef SANITIZE_USER_SHADOW_BASE
-  __nosan_memcpy((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
 #else
-  memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
 #endif
 
-  if ((r = sys_page_map(0, (void *) PFTEMP, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
     panic("pgfault error: sys_page_map: %i\n", r);
   }
 
-  if ((r = sys_page_unmap(0, (void *) PFTEMP)) < 0) {
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
     panic("pgfault error: sys_page_unmap: %i\n", r);
   }
 }
@@ -101,23 +111,25 @@ duppage(envid_t envid, uintptr_t pn) {
 }
 
 //
-// User-level fork with copy-on-write.
-// Set up our page fault handler appropriately.
-// Create a child.
-// Copy our address space and page fault handler setup to the child.
-// Then mark the child as runnable and return.
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
 //
-// Returns: child's envid to the parent, 0 to the child, < 0 on error.
-// It is also OK to panic on error.
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  void *addr = (void *)(pn * PGSIZE);
+
+  if (uvpt[pn] & PTE_COW)
+    *(volatile char *)addr = *(volatile char *)addr;
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+}
+
 //
-// Hint:
-//   Use uvpd, uvpt, and duppage.
-//   Remember to fix "thisenv" in the child process.
-//   Neither user exception stack should ever be marked copy-on-write,
-//   so you must allocate a new page for the child's user exception stack.
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
 //
-envid_t
-fork(void) {
+static envid_t
+fork_common(bool share) {
   // LAB 9: Your code here.
 
   // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
@@ -132,7 +144,9 @@ fork(void) {
   }
 
   if (!e) {
+#ifdef CONFIG_KSPACE
     thisenv = &envs[ENVX(sys_getenvid())];
+#endif
     return 0;
   } else {
     uint64_t i;
@@ -157,8 +171,16 @@ fork(void) {
         }
 #endif
 
-        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) && (uvpt[PGNUM(addr)] & PTE_P)) {
-          if ((r = duppage(e, PGNUM(addr))) < 0) {
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+            r = sharepage(e, PGNUM(addr));
+          } else {
+            r = duppage(e, PGNUM(addr));
+          }
+          if (r < 0) {
             return r;
           }
         }
@@ -193,9 +215,34 @@ fork(void) {
   }
 }
 
-// Challenge!
-int
+//
+// User-level fork with copy-on-write.
+// Set up our page fault handler appropriately.
+// Create a child.
+// Copy our address space and page fault handler setup to the child.
+// Then mark the child as runnable and return.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+// It is also OK to panic on error.
+//
+// Hint:
+//   Use uvpd, uvpt, and duppage.
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  return fork_common(0);
+}
+
+//
+// Shared-memory fork: the child shares all our memory except the
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
 sfork(void) {
-  panic("sfork not implemented");
-  return -E_INVAL;
+  return fork_common(1);
 }
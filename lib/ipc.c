@@ -21,13 +21,27 @@
 //   a perfectly valid place to map a page.)
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+}
+
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
   // LAB 9: Your code here.
   int r;
 
   if (pg == NULL) {
     pg = (void *) UTOP;
   }
-  if ((r = sys_ipc_recv(pg)) < 0) {
+  if (timeout == IPC_NO_TIMEOUT) {
+    r = sys_ipc_recv(pg);
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  }
+  if (r < 0) {
     if (from_env_store) {
       *from_env_store = 0;
     }
@@ -5,7 +5,9 @@
 
 extern void umain(int argc, char **argv);
 
+#ifdef CONFIG_KSPACE
 const volatile struct Env *thisenv;
+#endif
 const char *binaryname = "<unknown>";
 
 #ifdef JOS_PROG
@@ -24,9 +26,11 @@ libmain(int argc, char **argv) {
     ctor++;
   }
 
+#ifdef CONFIG_KSPACE
   // set thisenv to point at our Env structure in envs[].
   // LAB 8: Your code here.
   thisenv = &envs[ENVX(sys_getenvid())];
+#endif
 
   // save the name of the program so that panic() can use it
   if (argc > 0)
@@ -0,0 +1,332 @@
+// General-purpose memory allocator.
+//
+// The heap is carved into spans: SPAN_SIZE-aligned runs of address
+// space that start with a struct Span header.  Small requests come
+// from slabs, single spans mapped with one batch of sys_page_alloc
+// calls and cut into objects of one size class.  A slab hands out
+// never-used objects by bumping a pointer and recycles freed ones
+// through a free list.  Bigger requests get a span of their own,
+// mapped only as far as needed.  Empty slabs beyond one per class,
+// and all freed large spans, are unmapped again.
+//
+// Finding an object's span is just rounding its address down, so
+// free needs no size.  Each size class has its own lock, so threads
+// (thread.c) allocating different sizes do not contend.
+
+#include <inc/lib.h>
+
+#define HEAP_BASE 0x1000000000ll
+#define HEAP_SIZE 0x1000000000ll
+#define SPAN_SIZE (16 * PGSIZE)
+#define SPAN_HDR  64
+
+// Size classes: multiples of 16 up to 128, then four per doubling.
+#define SMALL_MAX 2048
+#define NCLASSES  24
+
+// Free address ranges remembered for reuse; more are leaked.
+#define NFREERANGES 256
+
+struct Span {
+  int sp_class;                   // size class, or -1 if large
+  int sp_inuse;                   // objects handed out
+  size_t sp_size;                 // object size, or usable bytes if large
+  size_t sp_npages;               // pages mapped
+  size_t sp_nspans;               // SPAN_SIZE units of address space
+  struct Span *sp_next, *sp_prev; // slabs of the class with room left
+  void *sp_free;                  // freed objects
+  char *sp_bump;                  // first never-used object
+};
+
+struct SizeClass {
+  struct Mutex sc_lock;
+  struct Span *sc_slabs; // slabs with room left
+  int sc_nempty;         // of which are empty
+  size_t sc_inuse;       // bytes handed out
+};
+
+struct FreeRange {
+  uintptr_t fr_addr;
+  size_t fr_nspans;
+};
+
+static const uint16_t class_sizes[NCLASSES] = {
+    16, 32, 48, 64, 80, 96, 112, 128,
+    160, 192, 224, 256, 320, 384, 448, 512,
+    640, 768, 896, 1024, 1280, 1536, 1792, 2048};
+
+static struct SizeClass classes[NCLASSES];
+
+// Address space and statistics
+static struct Mutex heap_lock = MUTEX_INITIALIZER;
+static uintptr_t heap_top = HEAP_BASE;
+static struct FreeRange free_ranges[NFREERANGES];
+static int nfree_ranges;
+static size_t heap_pages, heap_large;
+
+static_assert(sizeof(struct Span) <= SPAN_HDR, "struct Span too big");
+
+static int
+size_class(size_t n) {
+  int c;
+
+  if (n <= 128)
+    return n ? (n - 1) / 16 : 0;
+  for (c = 8; class_sizes[c] < n; c++)
+    ;
+  return c;
+}
+
+// Reserve nspans aligned spans of address space and map their first
+// npages pages.  Returns NULL if out of address space or memory.
+static struct Span *
+span_alloc(size_t nspans, size_t npages) {
+  uintptr_t va = 0, p;
+  int i, best = -1;
+
+  mutex_lock(&heap_lock);
+  for (i = 0; i < nfree_ranges; i++) {
+    if (free_ranges[i].fr_nspans >= nspans &&
+        (best < 0 || free_ranges[i].fr_nspans < free_ranges[best].fr_nspans))
+      best = i;
+  }
+  if (best >= 0) {
+    va = free_ranges[best].fr_addr;
+    free_ranges[best].fr_addr += nspans * SPAN_SIZE;
+    if (!(free_ranges[best].fr_nspans -= nspans))
+      free_ranges[best] = free_ranges[--nfree_ranges];
+  } else if (heap_top + nspans * SPAN_SIZE <= HEAP_BASE + HEAP_SIZE) {
+    va = heap_top;
+    heap_top += nspans * SPAN_SIZE;
+  }
+  if (va)
+    heap_pages += npages;
+  mutex_unlock(&heap_lock);
+  if (!va)
+    return NULL;
+
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE) {
+    if (sys_page_alloc(0, (void *)p, PTE_P | PTE_U | PTE_W) < 0) {
+      while (p > va)
+        sys_page_unmap(0, (void *)(p -= PGSIZE));
+      mutex_lock(&heap_lock);
+      heap_pages -= npages;
+      mutex_unlock(&heap_lock);
+      return NULL;
+    }
+  }
+  ((struct Span *)va)->sp_npages = npages;
+  ((struct Span *)va)->sp_nspans = nspans;
+  return (struct Span *)va;
+}
+
+// Unmap span sp and keep its address space for reuse.
+static void
+span_free(struct Span *sp) {
+  uintptr_t va = (uintptr_t)sp, p;
+  size_t npages = sp->sp_npages, nspans = sp->sp_nspans;
+
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE)
+    sys_page_unmap(0, (void *)p);
+
+  mutex_lock(&heap_lock);
+  heap_pages -= npages;
+  if (va + nspans * SPAN_SIZE == heap_top)
+    heap_top = va;
+  else if (nfree_ranges < NFREERANGES)
+    free_ranges[nfree_ranges++] = (struct FreeRange){va, nspans};
+  mutex_unlock(&heap_lock);
+}
+
+static void
+slab_unlink(struct SizeClass *sc, struct Span *sp) {
+  if (sp->sp_prev)
+    sp->sp_prev->sp_next = sp->sp_next;
+  else
+    sc->sc_slabs = sp->sp_next;
+  if (sp->sp_next)
+    sp->sp_next->sp_prev = sp->sp_prev;
+}
+
+static void
+slab_link(struct SizeClass *sc, struct Span *sp) {
+  sp->sp_prev = NULL;
+  sp->sp_next = sc->sc_slabs;
+  if (sp->sp_next)
+    sp->sp_next->sp_prev = sp;
+  sc->sc_slabs = sp;
+}
+
+static void *
+small_alloc(int c) {
+  struct SizeClass *sc = &classes[c];
+  struct Span *sp;
+  void *v;
+
+  mutex_lock(&sc->sc_lock);
+  if (!(sp = sc->sc_slabs)) {
+    if (!(sp = span_alloc(1, SPAN_SIZE / PGSIZE))) {
+      mutex_unlock(&sc->sc_lock);
+      return NULL;
+    }
+    sp->sp_class = c;
+    sp->sp_size  = class_sizes[c];
+    sp->sp_free  = NULL;
+    sp->sp_bump  = (char *)sp + SPAN_HDR;
+    sp->sp_inuse = 0;
+    slab_link(sc, sp);
+    sc->sc_nempty++;
+  }
+
+  if ((v = sp->sp_free)) {
+    sp->sp_free = *(void **)v;
+  } else {
+    v = sp->sp_bump;
+    sp->sp_bump += sp->sp_size;
+  }
+  if (!sp->sp_inuse++)
+    sc->sc_nempty--;
+  sc->sc_inuse += sp->sp_size;
+  if (!sp->sp_free && sp->sp_bump + sp->sp_size > (char *)sp + SPAN_SIZE)
+    slab_unlink(sc, sp);
+  mutex_unlock(&sc->sc_lock);
+  return v;
+}
+
+static void
+small_free(struct Span *sp, void *v) {
+  struct SizeClass *sc = &classes[sp->sp_class];
+  bool full;
+
+  mutex_lock(&sc->sc_lock);
+  full        = !sp->sp_free && sp->sp_bump + sp->sp_size > (char *)sp + SPAN_SIZE;
+  *(void **)v = sp->sp_free;
+  sp->sp_free = v;
+  if (full)
+    slab_link(sc, sp);
+  sc->sc_inuse -= sp->sp_size;
+  if (!--sp->sp_inuse) {
+    // Keep one empty slab so that a malloc/free loop does not map
+    // and unmap pages every time.
+    if (sc->sc_nempty) {
+      slab_unlink(sc, sp);
+      mutex_unlock(&sc->sc_lock);
+      span_free(sp);
+      return;
+    }
+    sc->sc_nempty++;
+  }
+  mutex_unlock(&sc->sc_lock);
+}
+
+void *
+malloc(size_t n) {
+  struct Span *sp;
+  size_t npages;
+
+  if (n <= SMALL_MAX)
+    return small_alloc(size_class(n));
+
+  if (n > HEAP_SIZE)
+    return NULL;
+  npages = ROUNDUP(n + SPAN_HDR, PGSIZE) / PGSIZE;
+  if (!(sp = span_alloc(ROUNDUP(npages * PGSIZE, SPAN_SIZE) / SPAN_SIZE, npages)))
+    return NULL;
+  sp->sp_class = -1;
+  sp->sp_size  = npages * PGSIZE - SPAN_HDR;
+  mutex_lock(&heap_lock);
+  heap_large += sp->sp_size;
+  mutex_unlock(&heap_lock);
+  return (char *)sp + SPAN_HDR;
+}
+
+void
+free(void *v) {
+  struct Span *sp;
+
+  if (!v)
+    return;
+  if ((uintptr_t)v < HEAP_BASE || (uintptr_t)v >= HEAP_BASE + HEAP_SIZE)
+    panic("free: %p was not allocated by malloc", v);
+
+  sp = ROUNDDOWN((struct Span *)v, SPAN_SIZE);
+  if (sp->sp_class >= 0) {
+    small_free(sp, v);
+    return;
+  }
+  mutex_lock(&heap_lock);
+  heap_large -= sp->sp_size;
+  mutex_unlock(&heap_lock);
+  span_free(sp);
+}
+
+void *
+calloc(size_t nmemb, size_t size) {
+  void *v;
+
+  if (size && nmemb > (size_t)-1 / size)
+    return NULL;
+  if ((v = malloc(nmemb * size)))
+    memset(v, 0, nmemb * size);
+  return v;
+}
+
+void *
+realloc(void *v, size_t n) {
+  struct Span *sp;
+  size_t npages;
+  uintptr_t p;
+  void *nv;
+
+  if (!v)
+    return malloc(n);
+  if (!n) {
+    free(v);
+    return NULL;
+  }
+
+  sp = ROUNDDOWN((struct Span *)v, SPAN_SIZE);
+  if (sp->sp_class >= 0 && n <= SMALL_MAX && size_class(n) == sp->sp_class)
+    return v;
+  if (sp->sp_class < 0 && n > SMALL_MAX && n <= sp->sp_size) {
+    // Shrink in place, handing back the pages no longer needed.
+    npages = ROUNDUP(n + SPAN_HDR, PGSIZE) / PGSIZE;
+    for (p = (uintptr_t)sp + npages * PGSIZE;
+         p < (uintptr_t)sp + sp->sp_npages * PGSIZE; p += PGSIZE)
+      sys_page_unmap(0, (void *)p);
+    mutex_lock(&heap_lock);
+    heap_pages -= sp->sp_npages - npages;
+    heap_large -= sp->sp_size - (npages * PGSIZE - SPAN_HDR);
+    mutex_unlock(&heap_lock);
+    sp->sp_npages = npages;
+    sp->sp_size   = npages * PGSIZE - SPAN_HDR;
+    return v;
+  }
+
+  if (!(nv = malloc(n)))
+    return NULL;
+  memcpy(nv, v, MIN(n, sp->sp_size));
+  free(v);
+  return nv;
+}
+
+// Report the bytes handed out by malloc (rounded up to what each
+// allocation really uses) and the bytes of pages mapped for them.
+void
+malloc_stats(size_t *inuse, size_t *mapped) {
+  size_t n;
+  int c;
+
+  mutex_lock(&heap_lock);
+  n = heap_large;
+  if (mapped)
+    *mapped = heap_pages * PGSIZE;
+  mutex_unlock(&heap_lock);
+  for (c = 0; c < NCLASSES; c++) {
+    mutex_lock(&classes[c].sc_lock);
+    n += classes[c].sc_inuse;
+    mutex_unlock(&classes[c].sc_lock);
+  }
+  if (inuse)
+    *inuse = n;
+}
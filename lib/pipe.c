@@ -4,6 +4,7 @@ static ssize_t devpipe_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devpipe_write(struct Fd *fd, const void *buf, size_t n);
 static int devpipe_stat(struct Fd *fd, struct Stat *stat);
 static int devpipe_close(struct Fd *fd);
+static int devpipe_poll(struct Fd *fd, int events, struct PollWait *w);
 
 struct Dev devpipe =
     {
@@ -13,21 +14,48 @@ struct Dev devpipe =
         .dev_write = devpipe_write,
         .dev_close = devpipe_close,
         .dev_stat  = devpipe_stat,
+        .dev_poll  = devpipe_poll,
 };
 
-#define PIPEBUFSIZ 32 // small to provoke races
+// The pipe structure lives at the start of the data area of both fds.
+// Its ring buffer runs on over as many following pages as it needs.
+// A reader facing an empty pipe, or a writer facing a full one,
+// sleeps on the p_seq futex, which every change to the pipe bumps.
 
+// The positions count every byte ever read and written.  They are
+// 64 bits wide so that they never wrap: p_size need not be a power of
+// two, and a wrapping position would jump in the middle of the ring.
 struct Pipe {
-  off_t p_rpos;              // read position
-  off_t p_wpos;              // write position
-  uint8_t p_buf[PIPEBUFSIZ]; // data buffer
+  uint64_t p_rpos;             // read position
+  uint64_t p_wpos;             // write position
+  size_t p_size;               // size of p_buf
+  volatile uint32_t p_seq;     // change counter, futex word
+  volatile uint32_t p_waiting; // someone may sleep on p_seq
+  uint8_t p_buf[];             // data buffer
 };
 
+#define PIPEMAXBUF (FDDATASIZE - sizeof(struct Pipe))
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
 int
 pipe(int pfd[2]) {
+  return pipe_size(pfd, PIPEBUFSIZ);
+}
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
   int r;
+  size_t i = 0;
   struct Fd *fd0, *fd1;
-  void *va;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+    return -E_INVAL;
 
   // allocate the file descriptor table entries
   if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
@@ -36,12 +64,19 @@ pipe(int pfd[2]) {
   if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
     goto err1;
 
-  // allocate the pipe structure as first data page in both
+  // allocate the pipe structure and buffer as data pages in both
   va = fd2data(fd0);
-  if ((r = sys_page_alloc(0, va, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
-    goto err2;
-  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
-    goto err3;
+  for (i = 0; i < PIPEPAGES(size); i++) {
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+      goto err2;
+    }
+  }
+  p         = (struct Pipe *)va;
+  p->p_size = size;
 
   // set up fd structures
   fd0->fd_dev_id = devpipe.dev_id;
@@ -58,9 +93,11 @@ pipe(int pfd[2]) {
   pfd[1] = fd2num(fd1);
   return 0;
 
-err3:
-  sys_page_unmap(0, va);
 err2:
+  while (i-- > 0) {
+    sys_page_unmap(0, va + i * PGSIZE);
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  }
   sys_page_unmap(0, fd1);
 err1:
   sys_page_unmap(0, fd0);
@@ -95,10 +132,28 @@ pipeisclosed(int fdnum) {
   return _pipeisclosed(fd, p);
 }
 
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  p->p_seq++;
+  if (p->p_waiting) {
+    p->p_waiting = 0;
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  }
+}
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  p->p_waiting = 1;
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+}
+
 static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
   uint8_t *buf;
-  size_t i;
+  size_t off, m;
+  uint32_t seq;
   struct Pipe *p;
 
   p = (struct Pipe *)fd2data(fd);
@@ -107,33 +162,41 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
             thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
             (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
 
-  buf = vbuf;
-  for (i = 0; i < n; i++) {
-    while (p->p_rpos == p->p_wpos) {
-      // pipe is empty
-      // if we got any data, return it
-      if (i > 0)
-        return i;
-      // if all the writers are gone, note eof
-      if (_pipeisclosed(fd, p))
-        return 0;
-      // yield and see what happens
-      if (debug)
-        cprintf("devpipe_read yield\n");
-      sys_yield();
-    }
-    // there's a byte.  take it.
-    // wait to increment rpos until the byte is taken!
-    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
-    p->p_rpos++;
+  if (n == 0)
+    return 0;
+
+  while (1) {
+    seq = p->p_seq;
+    if (p->p_rpos != p->p_wpos)
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+      return 0;
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
   }
-  return i;
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  off = p->p_rpos % p->p_size;
+  m   = MIN(n, p->p_size - off);
+  memcpy(buf, p->p_buf + off, m);
+  memcpy(buf + m, p->p_buf, n - m);
+  p->p_rpos += n;
+  pipe_changed(p);
+  return n;
 }
 
 static ssize_t
 devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
   const uint8_t *buf;
-  size_t i;
+  size_t i, off, m;
+  uint32_t seq;
   struct Pipe *p;
 
   p = (struct Pipe *)fd2data(fd);
@@ -143,28 +206,55 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
             (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
 
   buf = vbuf;
-  for (i = 0; i < n; i++) {
-    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  for (i = 0; i < n; i += m) {
+    seq = p->p_seq;
+    if (p->p_wpos - p->p_rpos == p->p_size) {
       // pipe is full
       // if all the readers are gone
       // (it's only writers like us now),
       // note eof
       if (_pipeisclosed(fd, p))
         return 0;
-      // yield and see what happens
+      // wait for a reader
       if (debug)
-        cprintf("devpipe_write yield\n");
-      sys_yield();
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+      m = 0;
+      continue;
     }
-    // there's room for a byte.  store it.
-    // wait to increment wpos until the byte is stored!
-    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
-    p->p_wpos++;
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+    off = p->p_wpos % p->p_size;
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+    if (m > p->p_size - off)
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+    p->p_wpos += m;
+    pipe_changed(p);
   }
 
   return i;
 }
 
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  int r, revents = 0;
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+    return r;
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+    revents |= POLLIN;
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+    revents |= POLLOUT;
+  if (_pipeisclosed(fd, p))
+    revents |= POLLHUP;
+  if (!revents)
+    p->p_waiting = 1;
+  return revents;
+}
+
 static int
 devpipe_stat(struct Fd *fd, struct Stat *stat) {
   struct Pipe *p = (struct Pipe *)fd2data(fd);
@@ -177,6 +267,13 @@ devpipe_stat(struct Fd *fd, struct Stat *stat) {
 
 static int
 devpipe_close(struct Fd *fd) {
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  size_t i, npages = PIPEPAGES(p->p_size);
+
   (void)sys_page_unmap(0, fd);
-  return sys_page_unmap(0, fd2data(fd));
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  for (i = npages; i > 1; i--)
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  return sys_page_unmap(0, p);
 }
@@ -36,6 +36,9 @@ static const char *const error_string[MAXERROR] =
         [E_FILE_EXISTS]  = "file already exists",
         [E_NOT_EXEC]     = "file is not a valid executable",
         [E_NOT_SUPP]     = "operation not supported",
+        [E_TIMEOUT]      = "timed out",
+        [E_NOT_EMPTY]    = "directory not empty",
+        [E_BUSY]         = "resource busy",
 };
 
 /*
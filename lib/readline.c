@@ -1,10 +1,35 @@
 #include <inc/stdio.h>
 #include <inc/error.h>
 #include <inc/string.h>
+#if !JOS_KERNEL
+#include <inc/lib.h>
+#endif
 
 #define BUFLEN 1024
 static char buf[BUFLEN];
 
+#if !JOS_KERNEL
+// Read a line from a console in cooked mode: the kernel does the
+// echoing and editing and returns the whole line in one read.
+static char *
+readline_cooked(int mode) {
+  int r;
+
+  r = read(0, buf, BUFLEN - 1);
+  consmode(0, mode);
+  if (r < 0) {
+    cprintf("read error: %i\n", r);
+    return NULL;
+  }
+  if (r == 0)
+    return NULL;
+  if (buf[r - 1] == '\n')
+    r--;
+  buf[r] = 0;
+  return buf;
+}
+#endif
+
 char *
 readline(const char *prompt) {
   int i, c, echoing;
@@ -17,6 +42,11 @@ readline(const char *prompt) {
 #endif
   }
 
+#if !JOS_KERNEL
+  if ((c = consmode(0, CONS_COOKED)) >= 0)
+    return readline_cooked(c);
+#endif
+
   i       = 0;
   echoing = iscons(0);
   while (1) {
@@ -1,6 +1,13 @@
-// Basic string routines.  Not hardware optimized, but not shabby.
+// Basic string routines.
+//
+// memset and memmove work a word at a time, or with "rep movsb" and
+// "rep stosb" on CPUs with ERMS (fast string operations).  The
+// scanning routines look at a word at a time in the kernel, which is
+// built without SIMD, and at 16 or 32 bytes at a time with SSE2 or
+// AVX2 in user programs.
 
 #include <inc/string.h>
+#include <inc/x86.h>
 
 // Using assembly for memset/memmove
 // makes some difference on real hardware,
@@ -8,13 +15,156 @@
 // Primespipe runs 3x faster this way.
 #define ASM 1
 
+// Scanning whole aligned words or vectors may read bytes before and
+// after the string.  They are on the same page, so that is harmless,
+// but it upsets the address sanitizers.
+#if !defined(SAN_ENABLE_KASAN) && !defined(SAN_ENABLE_UASAN)
+#define STRING_WIDE 1
+#endif
+
+// Sizes from which "rep movsb"/"rep stosb" beat the word loops on
+// CPUs with ERMS.
+#define STRING_REP_MIN 128
+
+#define STRING_ERMS 0x1
+#define STRING_AVX2 0x2
+
+#define CPUID7_EBX_AVX2    (1 << 5)
+#define CPUID7_EBX_ERMS    (1 << 9)
+#define CPUID1_ECX_OSXSAVE (1 << 27)
+
+// Unaligned views of memory, for loads of whole words and vectors.
+typedef uint64_t uword_t __attribute__((aligned(1), may_alias));
+
+#define ONES  0x0101010101010101ULL
+#define HIGHS 0x8080808080808080ULL
+// Nonzero if some byte of x is zero; the lowest set 0x80 bit marks
+// the first one.
+#define HASZERO(x) (((x)-ONES) & ~(x)&HIGHS)
+
+static int string_features = -1;
+
+// Return the STRING_* features of this CPU.
+static int
+string_cpu(void) {
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  int f = 0;
+
+  if (string_features >= 0)
+    return string_features;
+
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  if (maxleaf >= 7)
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  if (ebx7 & CPUID7_EBX_ERMS)
+    f |= STRING_ERMS;
+#ifdef __SSE2__
+  // AVX2 also needs the kernel to save the AVX registers.
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+      (xgetbv(0) & 0x6) == 0x6)
+    f |= STRING_AVX2;
+#else
+  (void)ecx1;
+#endif
+  return string_features = f;
+}
+
+#ifdef __SSE2__
+typedef char v16qi __attribute__((vector_size(16)));
+typedef char v16qi_u __attribute__((vector_size(16), aligned(1)));
+typedef char v32qi __attribute__((vector_size(32)));
+typedef char v32qi_u __attribute__((vector_size(32), aligned(1)));
+
+// Bit i is set if byte i of a equals byte i of b.
+#define EQMASK16(a, b) ((unsigned)__builtin_ia32_pmovmskb128((v16qi)((a) == (b))))
+#define EQMASK32(a, b) ((unsigned)__builtin_ia32_pmovmskb256((v32qi)((a) == (b))))
+
+__attribute__((target("avx2"))) static int
+strlen_avx2(const char *s) {
+  unsigned off = (uintptr_t)s % 32, m;
+  const char *p = s - off;
+  v32qi zero = {0};
+
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  while (!m) {
+    p += 32;
+    m = EQMASK32(*(const v32qi *)p, zero);
+  }
+  return p + __builtin_ctz(m) - s;
+}
+
+__attribute__((target("avx2"))) static int
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  unsigned m;
+  int i;
+
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+    if (m != ~0U) {
+      i = __builtin_ctz(~m);
+      return (int)s1[i] - (int)s2[i];
+    }
+  }
+  for (; n > 0; s1++, s2++, n--) {
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+  }
+  return 0;
+}
+
+__attribute__((target("avx2"))) static const uint8_t *
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  v32qi vc = (v32qi){0} + (char)c;
+  unsigned m;
+
+  for (; n >= 32; s += 32, n -= 32) {
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+      return s + __builtin_ctz(m);
+  }
+  for (; n > 0 && *s != c; s++, n--)
+    ;
+  return s;
+}
+#endif
+
 int
 strlen(const char *s) {
+#if defined(STRING_WIDE) && defined(__SSE2__)
+  unsigned off, m;
+  const char *p;
+  v16qi zero = {0};
+
+  if (string_cpu() & STRING_AVX2)
+    return strlen_avx2(s);
+
+  off = (uintptr_t)s % 16;
+  p   = s - off;
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  while (!m) {
+    p += 16;
+    m = EQMASK16(*(const v16qi *)p, zero);
+  }
+  return p + __builtin_ctz(m) - s;
+#elif defined(STRING_WIDE)
+  const char *p = s;
+  const uint64_t *w;
+  uint64_t z;
+
+  for (; (uintptr_t)p % 8; p++) {
+    if (!*p)
+      return p - s;
+  }
+  for (w = (const uint64_t *)p; !(z = HASZERO(*w)); w++)
+    ;
+  return (const char *)w + __builtin_ctzll(z) / 8 - s;
+#else
   int n;
 
   for (n = 0; *s != '\0'; s++)
     n++;
   return n;
+#endif
 }
 
 int
@@ -107,10 +257,26 @@ strncmp(const char *p, const char *q, size_t n) {
 // or a null pointer if the string has no 'c'.
 char *
 strchr(const char *s, char c) {
+#if defined(STRING_WIDE) && defined(__SSE2__)
+  unsigned off = (uintptr_t)s % 16, m;
+  const char *p = s - off;
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+
+  v = *(const v16qi *)p;
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  while (!m) {
+    p += 16;
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
   for (; *s; s++)
     if (*s == c)
       return (char *)s;
   return 0;
+#endif
 }
 
 // Return a pointer to the first occurrence of 'c' in 's',
@@ -126,45 +292,83 @@ strfind(const char *s, char c) {
 #if ASM
 void *
 memset(void *v, int c, size_t n) {
-  if (n == 0)
-    return v;
-  if ((int64_t)v % 4 == 0 && n % 4 == 0) {
-    uint32_t k = c & 0xFFU;
-    k          = (k << 24U) | (k << 16U) | (k << 8U) | k;
-    asm volatile("cld; rep stosl\n" ::"D"(v), "a"(k), "c"(n / 4)
+  uint8_t *p = v;
+  uint64_t k;
+  size_t nq;
+
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+    asm volatile("cld; rep stosb"
+                 : "+D"(p), "+c"(n)
+                 : "a"(c)
                  : "cc", "memory");
-  } else
-    asm volatile("cld; rep stosb\n" ::"D"(v), "a"(c), "c"(n)
+    return v;
+  }
+
+  if (n >= 8) {
+    for (; (uintptr_t)p % 8; n--)
+      *p++ = c;
+    k  = (uint8_t)c * ONES;
+    nq = n / 8;
+    asm volatile("cld; rep stosq"
+                 : "+D"(p), "+c"(nq)
+                 : "a"(k)
                  : "cc", "memory");
+    n %= 8;
+  }
+  while (n-- > 0)
+    *p++ = c;
   return v;
 }
 
 void *
 memmove(void *dst, const void *src, size_t n) {
-  const char *s;
-  char *d;
+  const uint8_t *s;
+  uint8_t *d;
+  size_t nq;
 
   s = src;
   d = dst;
   if (s < d && s + n > d) {
+    // Copy backwards: ERMS does not help here.
     s += n;
     d += n;
-    if ((int64_t)s % 4 == 0 && (int64_t)d % 4 == 0 && n % 4 == 0)
-      asm volatile("std; rep movsl\n" ::"D"(d - 4), "S"(s - 4), "c"(n / 4)
+    if (n >= 8) {
+      for (; (uintptr_t)d % 8; n--)
+        *--d = *--s;
+      nq = n / 8;
+      n %= 8;
+      d -= 8;
+      s -= 8;
+      // Some versions of GCC rely on DF being clear
+      asm volatile("std; rep movsq; cld"
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
                    : "cc", "memory");
-    else
-      asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
-                   : "cc", "memory");
-    // Some versions of GCC rely on DF being clear
-    asm volatile("cld" ::
-                     : "cc");
+      d += 8;
+      s += 8;
+    }
+    while (n-- > 0)
+      *--d = *--s;
   } else {
-    if ((int64_t)s % 4 == 0 && (int64_t)d % 4 == 0 && n % 4 == 0)
-      asm volatile("cld; rep movsl\n" ::"D"(d), "S"(s), "c"(n / 4)
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+      asm volatile("cld; rep movsb"
+                   : "+D"(d), "+S"(s), "+c"(n)
+                   :
                    : "cc", "memory");
-    else
-      asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+      return dst;
+    }
+    if (n >= 8) {
+      for (; (uintptr_t)d % 8; n--)
+        *d++ = *s++;
+      nq = n / 8;
+      asm volatile("cld; rep movsq"
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
                    : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+      *d++ = *s++;
   }
   return dst;
 }
@@ -214,6 +418,25 @@ memcmp(const void *v1, const void *v2, size_t n) {
   const uint8_t *s1 = (const uint8_t *)v1;
   const uint8_t *s2 = (const uint8_t *)v2;
 
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+    return memcmp_avx2(s1, s2, n);
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+    if (m != 0xFFFF) {
+      i = __builtin_ctz(~m);
+      return (int)s1[i] - (int)s2[i];
+    }
+  }
+#else
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
   while (n-- > 0) {
     if (*s1 != *s2)
       return (int)*s1 - (int)*s2;
@@ -226,6 +449,24 @@ memcmp(const void *v1, const void *v2, size_t n) {
 void *
 memfind(const void *s, int c, size_t n) {
   const void *ends = (const char *)s + n;
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+    return (void *)memfind_avx2(s, c, n);
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+      return (void *)s + __builtin_ctz(m);
+  }
+#else
+  uint64_t k = (uint8_t)c * ONES, z;
+
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
   for (; s < ends; s++)
     if (*(const unsigned char *)s == (unsigned char)c)
       break;
@@ -0,0 +1,138 @@
+// Mutexes, condition variables and semaphores built on futexes.
+// The uncontended paths are a single atomic instruction; only
+// an env that has to wait, or has to wake one, enters the kernel.
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+mutex_init(struct Mutex *m) {
+  m->m_state = 0;
+}
+
+void
+mutex_lock(struct Mutex *m) {
+  uint32_t c;
+
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+    return;
+  // Contended: mark the mutex as having waiters, then sleep
+  // until it is released.
+  if (c != 2)
+    c = xchg(&m->m_state, 2);
+  while (c != 0) {
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+    c = xchg(&m->m_state, 2);
+  }
+}
+
+// Returns 0 if the mutex was taken, -E_BUSY if it is held.
+int
+mutex_trylock(struct Mutex *m) {
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+}
+
+void
+mutex_unlock(struct Mutex *m) {
+  if (xchg(&m->m_state, 0) == 2)
+    sys_futex_wake(&m->m_state, 1);
+}
+
+void
+cond_init(struct Cond *c) {
+  c->c_seq = 0;
+}
+
+// Release 'm', wait for a signal on 'c' for at most 'timeout'
+// nanoseconds, and take 'm' again.  Wakeups may be spurious.
+// Returns 0, or -E_TIMEOUT if the timeout expired.
+int
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  uint32_t seq = c->c_seq;
+  int r;
+
+  mutex_unlock(m);
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  // Others may have been woken with us, so assume contention.
+  while (xchg(&m->m_state, 2) != 0)
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  return r == -E_TIMEOUT ? r : 0;
+}
+
+void
+cond_wait(struct Cond *c, struct Mutex *m) {
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+}
+
+void
+cond_signal(struct Cond *c) {
+  xadd(&c->c_seq, 1);
+  sys_futex_wake(&c->c_seq, 1);
+}
+
+void
+cond_broadcast(struct Cond *c) {
+  xadd(&c->c_seq, 1);
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+}
+
+void
+sem_init(struct Semaphore *s, uint32_t value) {
+  s->s_value   = value;
+  s->s_waiters = 0;
+}
+
+// Returns 0 if the semaphore was decremented, -E_BUSY if it is 0.
+int
+sem_trywait(struct Semaphore *s) {
+  uint32_t v;
+
+  while ((v = s->s_value) > 0) {
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+      return 0;
+  }
+  return -E_BUSY;
+}
+
+// Decrement the semaphore, waiting at most 'timeout' nanoseconds
+// for it to become positive.
+// Returns 0, or -E_TIMEOUT if the timeout expired.
+int
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  uint64_t deadline = 0, now;
+  int r;
+
+  // Another waiter may take the value a wakeup was for, so count the
+  // timeout from one deadline rather than afresh after each wakeup.
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+    now      = vsys_clock_ns();
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  }
+
+  while (sem_trywait(s) < 0) {
+    if (deadline) {
+      now     = vsys_clock_ns();
+      timeout = now < deadline ? deadline - now : 0;
+    }
+    // sem_post checks s_waiters after raising s_value, and the
+    // kernel rechecks s_value, so the wakeup cannot be lost.
+    xadd(&s->s_waiters, 1);
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+    xadd(&s->s_waiters, -1);
+    if (r == -E_TIMEOUT)
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  }
+  return 0;
+}
+
+void
+sem_wait(struct Semaphore *s) {
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+}
+
+void
+sem_post(struct Semaphore *s) {
+  xadd(&s->s_value, 1);
+  if (s->s_waiters)
+    sys_futex_wake(&s->s_value, 1);
+}
@@ -51,6 +51,31 @@ sys_env_destroy(envid_t envid) {
   return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
 }
 
+void
+sys_env_exit(int status) {
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+}
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  int64_t ret, st;
+
+  // The exit status comes back in DX, which syscall() takes as an
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+               : "cc", "memory");
+
+  if (ret > 0)
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  if (!ret && status)
+    *status = st;
+  return ret;
+}
+
 envid_t
 sys_getenvid(void) {
   return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
@@ -109,7 +134,83 @@ sys_ipc_recv(void *dstva) {
   return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
 }
 
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+}
+
 int
 sys_gettime(void) {
   return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
 }
+
+int
+sys_klog_read(char *buf, size_t len) {
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+}
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+}
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+}
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+}
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+}
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+}
+
+void
+sys_thread_exit(int status) {
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+}
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+}
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+}
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+}
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+}
+
+int
+sys_disk_irq(int irq) {
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+}
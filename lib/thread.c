@@ -0,0 +1,132 @@
+// Threads: environments that share their creator's address space.
+//
+// Each thread other than the main one runs in a slot of the region
+// at THREADSTACKS.  From the bottom, a slot holds a guard page, the
+// thread's exception stack, more guard pages and the stack proper,
+// so running off either stack faults instead of corrupting a
+// neighbour.  A slot is handed back by thread_join.
+
+#include <inc/lib.h>
+
+#define THREADSTACKS     0xE0000000ll
+#define THREADSLOT       (16 * PGSIZE)
+#define THREAD_STACKSIZE (8 * PGSIZE)
+#define MAXTHREADS       64
+
+#define SLOT2UXSTACKTOP(i) (THREADSTACKS + (i)*THREADSLOT + 2 * PGSIZE)
+#define SLOT2STACKTOP(i)   (THREADSTACKS + ((i) + 1) * THREADSLOT)
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  fn(arg);
+  thread_exit(0);
+}
+
+static void
+slot_unmap(int i) {
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+    sys_page_unmap(0, (void *)va);
+}
+
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+    ;
+  if (i == MAXTHREADS) {
+    r = -E_NO_FREE_ENV;
+    goto out;
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  if (id < 0) {
+    r = id;
+    goto fail;
+  }
+  thread_slots[i] = r = id;
+  goto out;
+
+fail:
+  slot_unmap(i);
+out:
+  mutex_unlock(&thread_lock);
+  return r;
+}
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  sys_thread_exit(status);
+}
+
+// Wait for thread 'id' to exit, store its exit status in '*status'
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  int i;
+
+  mutex_lock(&thread_lock);
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+    ;
+  mutex_unlock(&thread_lock);
+  if (!id || i == MAXTHREADS)
+    return -E_BAD_ENV;
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+
+  mutex_lock(&thread_lock);
+  slot_unmap(i);
+  thread_slots[i] = 0;
+  mutex_unlock(&thread_lock);
+  return 0;
+}
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+}
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  uintptr_t top = thisenv->env_uxstacktop;
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+    return (void *)PFTEMP;
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+}
@@ -0,0 +1,279 @@
+// Green threads: cooperative tasks multiplexed on one environment.
+//
+// Tasks switch with uthread_switch (uswitch.S), which saves only the
+// callee-saved registers, so a switch never enters the kernel.  A
+// task waiting for a file descriptor or for IPC sits on a wait queue;
+// when no task can run, the scheduler sleeps in a single poll() on
+// everything the tasks wait for.
+//
+// Each task runs in a slot at UTHREAD_STACKS: a guard page below a
+// stack whose top holds the task's struct UThread.  Slots of exited
+// tasks stay mapped and are reused by uthread_create.
+//
+// The state here is global, so only one env of an address space
+// may use green threads.
+
+#include <inc/lib.h>
+
+#define UTHREAD_STACKS 0xF0000000ll
+#define UTHREAD_SLOT   (4 * PGSIZE)
+#define MAXUTHREADS    4096
+
+// While some task can run, look at the wait queues without blocking
+// only every this many switches.
+#define UTHREAD_POLL_INTERVAL 64
+
+// Wait queue index for tasks waiting for IPC; the others are by fd.
+#define IPC_WAITQ MAXFD
+
+struct UThread {
+  uintptr_t ut_rsp;        // saved stack pointer while switched out
+  struct UThread *ut_next; // link in the run, wait or free list
+  void (*ut_fn)(void *);
+  void *ut_arg;
+  int ut_events;           // POLLIN/POLLOUT a waiting task waits for
+};
+
+struct UThreadQueue {
+  struct UThread *q_head, *q_tail;
+  int q_events; // union of the waiters' ut_events
+};
+
+void uthread_switch(uintptr_t *save_rsp, uintptr_t rsp);
+
+static struct UThread uthread_main;
+static struct UThread *uthread_cur = &uthread_main;
+static struct UThreadQueue runq;
+static struct UThreadQueue waitq[MAXFD + 1];
+static struct UThread *freelist;
+static int nslots, ntasks, nwaiting;
+static bool main_waiting; // uthread_run waits for the tasks to exit
+static unsigned nswitches;
+
+static void
+enqueue(struct UThreadQueue *q, struct UThread *t) {
+  t->ut_next = NULL;
+  if (q->q_tail)
+    q->q_tail->ut_next = t;
+  else
+    q->q_head = t;
+  q->q_tail = t;
+}
+
+static struct UThread *
+dequeue(struct UThreadQueue *q) {
+  struct UThread *t = q->q_head;
+
+  if (t && !(q->q_head = t->ut_next))
+    q->q_tail = NULL;
+  return t;
+}
+
+// Make the tasks on wait queue q that wanted some of 'revents'
+// runnable; only the first one if q is the IPC queue, since only
+// one message is on its way.
+static void
+wakeup(int q, int revents) {
+  struct UThreadQueue *wq = &waitq[q], rest = {0};
+  struct UThread *t;
+
+  while ((t = dequeue(wq))) {
+    if ((t->ut_events | POLLHUP | POLLNVAL) & revents) {
+      enqueue(&runq, t);
+      nwaiting--;
+      if (q == IPC_WAITQ)
+        break;
+    } else {
+      enqueue(&rest, t);
+      rest.q_events |= t->ut_events;
+    }
+  }
+  // Keep the order of the tasks that go on waiting.
+  if (wq->q_head) {
+    if (rest.q_tail)
+      rest.q_tail->ut_next = wq->q_head;
+    else
+      rest.q_head = wq->q_head;
+    rest.q_tail = wq->q_tail;
+    for (t = wq->q_head; t; t = t->ut_next)
+      rest.q_events |= t->ut_events;
+  }
+  *wq = rest;
+}
+
+// Poll everything the waiting tasks wait for and wake those whose
+// events are ready.  With 'block', sleep until at least one is.
+static void
+uthread_poll(bool block) {
+  struct pollfd fds[MAXFD + 1];
+  int qs[MAXFD + 1];
+  int i, n = 0, r;
+
+  for (i = 0; i <= MAXFD; i++) {
+    if (!waitq[i].q_head)
+      continue;
+    fds[n].fd     = i == IPC_WAITQ ? POLLFD_IPC : i;
+    fds[n].events = waitq[i].q_events;
+    qs[n++]       = i;
+  }
+  if ((r = poll(fds, n, block ? POLL_NO_TIMEOUT : 0)) < 0)
+    panic("uthread: poll: %i", r);
+  for (i = 0; i < n; i++) {
+    if (fds[i].revents)
+      wakeup(qs[i], fds[i].revents);
+  }
+}
+
+// Switch to the next runnable task.  The current task must already
+// be on whatever queue it belongs to.
+static void
+uthread_schedule(void) {
+  struct UThread *prev = uthread_cur, *next;
+
+  if (nwaiting && (!runq.q_head || ++nswitches % UTHREAD_POLL_INTERVAL == 0))
+    uthread_poll(!runq.q_head);
+  if (!(next = dequeue(&runq)))
+    panic("uthread: no task can run");
+  if (next == prev)
+    return;
+  uthread_cur = next;
+  uthread_switch(&prev->ut_rsp, next->ut_rsp);
+}
+
+static void
+uthread_start(void) {
+  uthread_cur->ut_fn(uthread_cur->ut_arg);
+  uthread_exit();
+}
+
+// Create a task running fn(arg) and queue it to run.  Returning from
+// fn is the same as calling uthread_exit.
+// Returns 0 on success, -E_NO_MEM if there is no slot or no memory.
+int
+uthread_create(void (*fn)(void *), void *arg) {
+  struct UThread *t;
+  uintptr_t slot, va, *sp;
+  int r;
+
+  if ((t = freelist)) {
+    freelist = t->ut_next;
+  } else {
+    if (nslots == MAXUTHREADS)
+      return -E_NO_MEM;
+    slot = UTHREAD_STACKS + nslots * UTHREAD_SLOT;
+    for (va = slot + PGSIZE; va < slot + UTHREAD_SLOT; va += PGSIZE) {
+      if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+        return r;
+    }
+    nslots++;
+    t = (struct UThread *)(slot + UTHREAD_SLOT) - 1;
+  }
+
+  t->ut_fn  = fn;
+  t->ut_arg = arg;
+  // Lay out the stack so that uthread_switch pops zeroed registers
+  // and returns into uthread_start as if it had been called from a
+  // 16-byte aligned stack.
+  sp    = (uintptr_t *)ROUNDDOWN((uintptr_t)t, 16) - 2;
+  sp[1] = 0;
+  sp[0] = (uintptr_t)uthread_start;
+  sp -= 6;
+  memset(sp, 0, 6 * sizeof(*sp));
+  t->ut_rsp = (uintptr_t)sp;
+
+  ntasks++;
+  enqueue(&runq, t);
+  return 0;
+}
+
+// Let the other runnable tasks run.
+void
+uthread_yield(void) {
+  enqueue(&runq, uthread_cur);
+  uthread_schedule();
+}
+
+// End the calling task.  In the env's original context, exit the env.
+void
+uthread_exit(void) {
+  struct UThread *t = uthread_cur;
+
+  if (t == &uthread_main)
+    exit();
+  // The slot stays ours until we switch away from it.
+  t->ut_next = freelist;
+  freelist   = t;
+  if (!--ntasks && main_waiting) {
+    main_waiting = 0;
+    enqueue(&runq, &uthread_main);
+  }
+  uthread_schedule();
+}
+
+// From the env's original context, run tasks until all have exited.
+void
+uthread_run(void) {
+  assert(uthread_cur == &uthread_main);
+  if (!ntasks)
+    return;
+  main_waiting = 1;
+  uthread_schedule();
+}
+
+// Block the calling task until one of 'events' (POLLIN, POLLOUT) is
+// ready on 'fd', letting other tasks run meanwhile.  With fd
+// POLLFD_IPC and POLLIN, wait until another env tries to send us IPC;
+// tasks waiting for IPC are only woken when no task can run.
+// Returns the ready events as poll does, or < 0 on error.
+int
+uthread_wait(int fd, int events) {
+  struct pollfd pfd = {.fd = fd, .events = events};
+  int q = fd == POLLFD_IPC ? IPC_WAITQ : fd;
+  int r;
+
+  if (q < 0 || q > MAXFD)
+    return POLLNVAL;
+  while (1) {
+    // Another task may have consumed what woke us.
+    if (q != IPC_WAITQ && (r = poll(&pfd, 1, 0)) != 0)
+      return r < 0 ? r : pfd.revents;
+
+    uthread_cur->ut_events = events;
+    enqueue(&waitq[q], uthread_cur);
+    waitq[q].q_events |= events;
+    nwaiting++;
+    uthread_schedule();
+
+    if (q == IPC_WAITQ)
+      return POLLIN;
+  }
+}
+
+// read() without blocking the other tasks.
+ssize_t
+uthread_read(int fd, void *buf, size_t n) {
+  int r;
+
+  if ((r = uthread_wait(fd, POLLIN)) < 0)
+    return r;
+  return read(fd, buf, n);
+}
+
+// write() without blocking the other tasks while there is no room
+// at all.  A write bigger than the room available still blocks the
+// env until it completes.
+ssize_t
+uthread_write(int fd, const void *buf, size_t n) {
+  int r;
+
+  if ((r = uthread_wait(fd, POLLOUT)) < 0)
+    return r;
+  return write(fd, buf, n);
+}
+
+// ipc_recv() without blocking the other tasks.
+int32_t
+uthread_ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  uthread_wait(POLLFD_IPC, POLLIN);
+  return ipc_recv(from_env_store, pg, perm_store);
+}
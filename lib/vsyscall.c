@@ -1,5 +1,6 @@
 #include <inc/vsyscall.h>
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 static inline uint64_t
 vsyscall(int num) {
@@ -15,3 +16,12 @@ int
 vsys_gettime(void) {
   return vsyscall(VSYS_gettime);
 }
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+}
@@ -3,10 +3,17 @@
 // Waits until 'envid' exits.
 void
 wait(envid_t envid) {
-  const volatile struct Env *e;
+  waitpid(envid, NULL);
+}
 
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
   assert(envid != 0);
-  e = &envs[ENVX(envid)];
-  while (e->env_id == envid && e->env_status != ENV_FREE)
-    sys_yield();
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+    *status = 0;
+  return sys_env_wait(envid, status);
 }
@@ -0,0 +1,8042 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 1e 00 00 00       	call   80004a <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// program to cause a general protection exception
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  // Try to load the kernel's TSS selector into the DS register.
+  asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800041:	66 b8 38 00          	mov    $0x38,%ax
+  800045:	8e d8                	mov    %eax,%ds
+}
+  800047:	90                   	nop
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+
+000000000080004a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004a:	55                   	push   %rbp
+  80004b:	48 89 e5             	mov    %rsp,%rbp
+  80004e:	48 83 ec 20          	sub    $0x20,%rsp
+  800052:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800055:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800059:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800060:	00 00 00 
+  800063:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800067:	eb 13                	jmp    80007c <libmain+0x32>
+    (*ctor)();
+  800069:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80006d:	48 8b 10             	mov    (%rax),%rdx
+  800070:	b8 00 00 00 00       	mov    $0x0,%eax
+  800075:	ff d2                	call   *%rdx
+    ctor++;
+  800077:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80007c:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800083:	00 00 00 
+  800086:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80008a:	72 dd                	jb     800069 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80008c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800090:	7e 14                	jle    8000a6 <libmain+0x5c>
+    binaryname = argv[0];
+  800092:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800096:	48 8b 00             	mov    (%rax),%rax
+  800099:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000a0:	00 00 00 
+  8000a3:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ad:	48 89 d6             	mov    %rdx,%rsi
+  8000b0:	89 c7                	mov    %eax,%edi
+  8000b2:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000be:	48 b8 cd 00 80 00 00 	movabs $0x8000cd,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+#endif
+}
+  8000ca:	90                   	nop
+  8000cb:	c9                   	leave
+  8000cc:	c3                   	ret
+
+00000000008000cd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000cd:	55                   	push   %rbp
+  8000ce:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000d1:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  8000d8:	00 00 00 
+  8000db:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e2:	48 b8 59 02 80 00 00 	movabs $0x800259,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+}
+  8000ee:	90                   	nop
+  8000ef:	5d                   	pop    %rbp
+  8000f0:	c3                   	ret
+
+00000000008000f1 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8000f1:	55                   	push   %rbp
+  8000f2:	48 89 e5             	mov    %rsp,%rbp
+  8000f5:	53                   	push   %rbx
+  8000f6:	48 83 ec 48          	sub    $0x48,%rsp
+  8000fa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8000fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800102:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800106:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80010a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80010e:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800112:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800116:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80011a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80011e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800122:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800126:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80012a:	4c 89 c3             	mov    %r8,%rbx
+  80012d:	cd 30                	int    $0x30
+  80012f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  800133:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800138:	74 46                	je     800180 <syscall+0x8f>
+  80013a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80013f:	7e 3f                	jle    800180 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800141:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800145:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800149:	49 89 d0             	mov    %rdx,%r8
+  80014c:	48 89 c1             	mov    %rax,%rcx
+  80014f:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  800156:	00 00 00 
+  800159:	48 89 c2             	mov    %rax,%rdx
+  80015c:	be 22 00 00 00       	mov    $0x22,%esi
+  800161:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800168:	00 00 00 
+  80016b:	48 89 c7             	mov    %rax,%rdi
+  80016e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800173:	49 b9 31 2f 80 00 00 	movabs $0x802f31,%r9
+  80017a:	00 00 00 
+  80017d:	41 ff d1             	call   *%r9
+
+  return ret;
+  800180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800184:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800188:	c9                   	leave
+  800189:	c3                   	ret
+
+000000000080018a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80018a:	55                   	push   %rbp
+  80018b:	48 89 e5             	mov    %rsp,%rbp
+  80018e:	48 83 ec 10          	sub    $0x10,%rsp
+  800192:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800196:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80019a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80019e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8001a6:	6a 00                	push   $0x0
+  8001a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001b4:	48 89 d1             	mov    %rdx,%rcx
+  8001b7:	48 89 c2             	mov    %rax,%rdx
+  8001ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c4:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+  8001d0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001d4:	90                   	nop
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+00000000008001d7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001d7:	55                   	push   %rbp
+  8001d8:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001db:	48 83 ec 08          	sub    $0x8,%rsp
+  8001df:	6a 00                	push   $0x0
+  8001e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800201:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+  80020d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+
+0000000000800213 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800213:	55                   	push   %rbp
+  800214:	48 89 e5             	mov    %rsp,%rbp
+  800217:	48 83 ec 10          	sub    $0x10,%rsp
+  80021b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80021e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800221:	48 98                	cltq
+  800223:	48 83 ec 08          	sub    $0x8,%rsp
+  800227:	6a 00                	push   $0x0
+  800229:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80022f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800235:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80023a:	48 89 c2             	mov    %rax,%rdx
+  80023d:	be 01 00 00 00       	mov    $0x1,%esi
+  800242:	bf 03 00 00 00       	mov    $0x3,%edi
+  800247:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+  800253:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800257:	c9                   	leave
+  800258:	c3                   	ret
+
+0000000000800259 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800259:	55                   	push   %rbp
+  80025a:	48 89 e5             	mov    %rsp,%rbp
+  80025d:	48 83 ec 10          	sub    $0x10,%rsp
+  800261:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800264:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800267:	48 98                	cltq
+  800269:	48 83 ec 08          	sub    $0x8,%rsp
+  80026d:	6a 00                	push   $0x0
+  80026f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800275:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80027b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800280:	48 89 c2             	mov    %rax,%rdx
+  800283:	be 00 00 00 00       	mov    $0x0,%esi
+  800288:	bf 04 00 00 00       	mov    $0x4,%edi
+  80028d:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800294:	00 00 00 
+  800297:	ff d0                	call   *%rax
+  800299:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80029d:	90                   	nop
+  80029e:	c9                   	leave
+  80029f:	c3                   	ret
+
+00000000008002a0 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002a0:	55                   	push   %rbp
+  8002a1:	48 89 e5             	mov    %rsp,%rbp
+  8002a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8002a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002b2:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002ba:	cd 30                	int    $0x30
+  8002bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002c0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002c4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002c9:	7e 3d                	jle    800308 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002cf:	49 89 c0             	mov    %rax,%r8
+  8002d2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002d7:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002de:	00 00 00 
+  8002e1:	48 89 c2             	mov    %rax,%rdx
+  8002e4:	be 49 00 00 00       	mov    $0x49,%esi
+  8002e9:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  8002f0:	00 00 00 
+  8002f3:	48 89 c7             	mov    %rax,%rdi
+  8002f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fb:	49 b9 31 2f 80 00 00 	movabs $0x802f31,%r9
+  800302:	00 00 00 
+  800305:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800308:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80030d:	75 13                	jne    800322 <sys_env_wait+0x82>
+  80030f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800314:	74 0c                	je     800322 <sys_env_wait+0x82>
+    *status = st;
+  800316:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80031a:	89 c2                	mov    %eax,%edx
+  80031c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800320:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800326:	c9                   	leave
+  800327:	c3                   	ret
+
+0000000000800328 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800328:	55                   	push   %rbp
+  800329:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80032c:	48 83 ec 08          	sub    $0x8,%rsp
+  800330:	6a 00                	push   $0x0
+  800332:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800338:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80033e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800343:	ba 00 00 00 00       	mov    $0x0,%edx
+  800348:	be 00 00 00 00       	mov    $0x0,%esi
+  80034d:	bf 02 00 00 00       	mov    $0x2,%edi
+  800352:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800359:	00 00 00 
+  80035c:	ff d0                	call   *%rax
+  80035e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800362:	c9                   	leave
+  800363:	c3                   	ret
+
+0000000000800364 <sys_yield>:
+
+void
+sys_yield(void) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800368:	48 83 ec 08          	sub    $0x8,%rsp
+  80036c:	6a 00                	push   $0x0
+  80036e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800374:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80037a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80037f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800384:	be 00 00 00 00       	mov    $0x0,%esi
+  800389:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80038e:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+  80039a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80039e:	90                   	nop
+  80039f:	c9                   	leave
+  8003a0:	c3                   	ret
+
+00000000008003a1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003a1:	55                   	push   %rbp
+  8003a2:	48 89 e5             	mov    %rsp,%rbp
+  8003a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8003a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003b0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003b6:	48 63 c8             	movslq %eax,%rcx
+  8003b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003c0:	48 98                	cltq
+  8003c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c6:	6a 00                	push   $0x0
+  8003c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003ce:	49 89 c8             	mov    %rcx,%r8
+  8003d1:	48 89 d1             	mov    %rdx,%rcx
+  8003d4:	48 89 c2             	mov    %rax,%rdx
+  8003d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8003dc:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003e1:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8003e8:	00 00 00 
+  8003eb:	ff d0                	call   *%rax
+  8003ed:	48 83 c4 10          	add    $0x10,%rsp
+  8003f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8003f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8003f7:	c9                   	leave
+  8003f8:	c3                   	ret
+
+00000000008003f9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	48 83 ec 20          	sub    $0x20,%rsp
+  800401:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800404:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800408:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80040b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80040f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800413:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800416:	48 63 c8             	movslq %eax,%rcx
+  800419:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80041d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800420:	48 63 f0             	movslq %eax,%rsi
+  800423:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800427:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80042a:	48 98                	cltq
+  80042c:	48 83 ec 08          	sub    $0x8,%rsp
+  800430:	51                   	push   %rcx
+  800431:	49 89 f9             	mov    %rdi,%r9
+  800434:	49 89 f0             	mov    %rsi,%r8
+  800437:	48 89 d1             	mov    %rdx,%rcx
+  80043a:	48 89 c2             	mov    %rax,%rdx
+  80043d:	be 01 00 00 00       	mov    $0x1,%esi
+  800442:	bf 07 00 00 00       	mov    $0x7,%edi
+  800447:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  80044e:	00 00 00 
+  800451:	ff d0                	call   *%rax
+  800453:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800457:	c9                   	leave
+  800458:	c3                   	ret
+
+0000000000800459 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800459:	55                   	push   %rbp
+  80045a:	48 89 e5             	mov    %rsp,%rbp
+  80045d:	48 83 ec 10          	sub    $0x10,%rsp
+  800461:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800468:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80046c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046f:	48 98                	cltq
+  800471:	48 83 ec 08          	sub    $0x8,%rsp
+  800475:	6a 00                	push   $0x0
+  800477:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80047d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800483:	48 89 d1             	mov    %rdx,%rcx
+  800486:	48 89 c2             	mov    %rax,%rdx
+  800489:	be 01 00 00 00       	mov    $0x1,%esi
+  80048e:	bf 08 00 00 00       	mov    $0x8,%edi
+  800493:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+  80049f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004a3:	c9                   	leave
+  8004a4:	c3                   	ret
+
+00000000008004a5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004b0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004b3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004b6:	48 63 d0             	movslq %eax,%rdx
+  8004b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004bc:	48 98                	cltq
+  8004be:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c2:	6a 00                	push   $0x0
+  8004c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004d0:	48 89 d1             	mov    %rdx,%rcx
+  8004d3:	48 89 c2             	mov    %rax,%rdx
+  8004d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8004db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004e0:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+  8004ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004f0:	c9                   	leave
+  8004f1:	c3                   	ret
+
+00000000008004f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004f2:	55                   	push   %rbp
+  8004f3:	48 89 e5             	mov    %rsp,%rbp
+  8004f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8004fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800501:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800505:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800508:	48 98                	cltq
+  80050a:	48 83 ec 08          	sub    $0x8,%rsp
+  80050e:	6a 00                	push   $0x0
+  800510:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80051c:	48 89 d1             	mov    %rdx,%rcx
+  80051f:	48 89 c2             	mov    %rax,%rdx
+  800522:	be 01 00 00 00       	mov    $0x1,%esi
+  800527:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80052c:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800533:	00 00 00 
+  800536:	ff d0                	call   *%rax
+  800538:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+000000000080053e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+  800542:	48 83 ec 10          	sub    $0x10,%rsp
+  800546:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800549:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80054d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800551:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800554:	48 98                	cltq
+  800556:	48 83 ec 08          	sub    $0x8,%rsp
+  80055a:	6a 00                	push   $0x0
+  80055c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800562:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800568:	48 89 d1             	mov    %rdx,%rcx
+  80056b:	48 89 c2             	mov    %rax,%rdx
+  80056e:	be 01 00 00 00       	mov    $0x1,%esi
+  800573:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800578:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  80057f:	00 00 00 
+  800582:	ff d0                	call   *%rax
+  800584:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800588:	c9                   	leave
+  800589:	c3                   	ret
+
+000000000080058a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80058a:	55                   	push   %rbp
+  80058b:	48 89 e5             	mov    %rsp,%rbp
+  80058e:	48 83 ec 20          	sub    $0x20,%rsp
+  800592:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800595:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800599:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80059d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005a3:	48 63 f0             	movslq %eax,%rsi
+  8005a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005b1:	48 98                	cltq
+  8005b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b7:	6a 00                	push   $0x0
+  8005b9:	49 89 f1             	mov    %rsi,%r9
+  8005bc:	49 89 c8             	mov    %rcx,%r8
+  8005bf:	48 89 d1             	mov    %rdx,%rcx
+  8005c2:	48 89 c2             	mov    %rax,%rdx
+  8005c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ca:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005cf:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8005d6:	00 00 00 
+  8005d9:	ff d0                	call   *%rax
+  8005db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+00000000008005e1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8005e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f5:	6a 00                	push   $0x0
+  8005f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800603:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800608:	48 89 c2             	mov    %rax,%rdx
+  80060b:	be 01 00 00 00       	mov    $0x1,%esi
+  800610:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800615:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  80061c:	00 00 00 
+  80061f:	ff d0                	call   *%rax
+  800621:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+0000000000800627 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	48 83 ec 10          	sub    $0x10,%rsp
+  80062f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800633:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800637:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80063b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80063f:	48 83 ec 08          	sub    $0x8,%rsp
+  800643:	6a 00                	push   $0x0
+  800645:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80064b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800651:	48 89 d1             	mov    %rdx,%rcx
+  800654:	48 89 c2             	mov    %rax,%rdx
+  800657:	be 01 00 00 00       	mov    $0x1,%esi
+  80065c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800661:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800668:	00 00 00 
+  80066b:	ff d0                	call   *%rax
+  80066d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800671:	c9                   	leave
+  800672:	c3                   	ret
+
+0000000000800673 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800673:	55                   	push   %rbp
+  800674:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800677:	48 83 ec 08          	sub    $0x8,%rsp
+  80067b:	6a 00                	push   $0x0
+  80067d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800683:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800693:	be 00 00 00 00       	mov    $0x0,%esi
+  800698:	bf 11 00 00 00       	mov    $0x11,%edi
+  80069d:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006ad:	c9                   	leave
+  8006ae:	c3                   	ret
+
+00000000008006af <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006af:	55                   	push   %rbp
+  8006b0:	48 89 e5             	mov    %rsp,%rbp
+  8006b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8006b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006cb:	6a 00                	push   $0x0
+  8006cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006d9:	48 89 d1             	mov    %rdx,%rcx
+  8006dc:	48 89 c2             	mov    %rax,%rdx
+  8006df:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e4:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006e9:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8006f0:	00 00 00 
+  8006f3:	ff d0                	call   *%rax
+  8006f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006f9:	c9                   	leave
+  8006fa:	c3                   	ret
+
+00000000008006fb <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8006fb:	55                   	push   %rbp
+  8006fc:	48 89 e5             	mov    %rsp,%rbp
+  8006ff:	48 83 ec 20          	sub    $0x20,%rsp
+  800703:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800707:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80070b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80070e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800711:	48 63 c8             	movslq %eax,%rcx
+  800714:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80071c:	48 83 ec 08          	sub    $0x8,%rsp
+  800720:	6a 00                	push   $0x0
+  800722:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800728:	49 89 c8             	mov    %rcx,%r8
+  80072b:	48 89 d1             	mov    %rdx,%rcx
+  80072e:	48 89 c2             	mov    %rax,%rdx
+  800731:	be 00 00 00 00       	mov    $0x0,%esi
+  800736:	bf 13 00 00 00       	mov    $0x13,%edi
+  80073b:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800742:	00 00 00 
+  800745:	ff d0                	call   *%rax
+  800747:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80074b:	c9                   	leave
+  80074c:	c3                   	ret
+
+000000000080074d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80074d:	55                   	push   %rbp
+  80074e:	48 89 e5             	mov    %rsp,%rbp
+  800751:	48 83 ec 20          	sub    $0x20,%rsp
+  800755:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800759:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80075c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  800760:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800764:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80076b:	48 83 ec 08          	sub    $0x8,%rsp
+  80076f:	6a 00                	push   $0x0
+  800771:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800777:	49 89 c8             	mov    %rcx,%r8
+  80077a:	48 89 d1             	mov    %rdx,%rcx
+  80077d:	48 89 c2             	mov    %rax,%rdx
+  800780:	be 00 00 00 00       	mov    $0x0,%esi
+  800785:	bf 14 00 00 00       	mov    $0x14,%edi
+  80078a:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800791:	00 00 00 
+  800794:	ff d0                	call   *%rax
+  800796:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80079a:	c9                   	leave
+  80079b:	c3                   	ret
+
+000000000080079c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80079c:	55                   	push   %rbp
+  80079d:	48 89 e5             	mov    %rsp,%rbp
+  8007a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8007a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007ae:	48 63 d0             	movslq %eax,%rdx
+  8007b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8007b9:	6a 00                	push   $0x0
+  8007bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007c7:	48 89 d1             	mov    %rdx,%rcx
+  8007ca:	48 89 c2             	mov    %rax,%rdx
+  8007cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d2:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007d7:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8007de:	00 00 00 
+  8007e1:	ff d0                	call   *%rax
+  8007e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+00000000008007e9 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007e9:	55                   	push   %rbp
+  8007ea:	48 89 e5             	mov    %rsp,%rbp
+  8007ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8007f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007f5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007f8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8007fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8007ff:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800803:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800806:	48 63 c8             	movslq %eax,%rcx
+  800809:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80080c:	48 63 d0             	movslq %eax,%rdx
+  80080f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800813:	48 83 ec 08          	sub    $0x8,%rsp
+  800817:	6a 00                	push   $0x0
+  800819:	49 89 f1             	mov    %rsi,%r9
+  80081c:	49 89 c8             	mov    %rcx,%r8
+  80081f:	48 89 d1             	mov    %rdx,%rcx
+  800822:	48 89 c2             	mov    %rax,%rdx
+  800825:	be 00 00 00 00       	mov    $0x0,%esi
+  80082a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80082f:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+  80083b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80083f:	c9                   	leave
+  800840:	c3                   	ret
+
+0000000000800841 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800841:	55                   	push   %rbp
+  800842:	48 89 e5             	mov    %rsp,%rbp
+  800845:	48 83 ec 30          	sub    $0x30,%rsp
+  800849:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80084d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800851:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800855:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800859:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80085d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800861:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800865:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800869:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80086d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800871:	48 83 ec 08          	sub    $0x8,%rsp
+  800875:	51                   	push   %rcx
+  800876:	49 89 f9             	mov    %rdi,%r9
+  800879:	49 89 f0             	mov    %rsi,%r8
+  80087c:	48 89 d1             	mov    %rdx,%rcx
+  80087f:	48 89 c2             	mov    %rax,%rdx
+  800882:	be 00 00 00 00       	mov    $0x0,%esi
+  800887:	bf 17 00 00 00       	mov    $0x17,%edi
+  80088c:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800893:	00 00 00 
+  800896:	ff d0                	call   *%rax
+  800898:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+
+000000000080089e <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80089e:	55                   	push   %rbp
+  80089f:	48 89 e5             	mov    %rsp,%rbp
+  8008a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8008a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008ac:	48 98                	cltq
+  8008ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b2:	6a 00                	push   $0x0
+  8008b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c5:	48 89 c2             	mov    %rax,%rdx
+  8008c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008cd:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008d2:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8008d9:	00 00 00 
+  8008dc:	ff d0                	call   *%rax
+  8008de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008e2:	90                   	nop
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+00000000008008e5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008e5:	55                   	push   %rbp
+  8008e6:	48 89 e5             	mov    %rsp,%rbp
+  8008e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8008ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008f4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8008f8:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8008fb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8008fe:	48 63 f0             	movslq %eax,%rsi
+  800901:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800905:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800909:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80090c:	48 98                	cltq
+  80090e:	48 83 ec 08          	sub    $0x8,%rsp
+  800912:	6a 00                	push   $0x0
+  800914:	49 89 f1             	mov    %rsi,%r9
+  800917:	49 89 c8             	mov    %rcx,%r8
+  80091a:	48 89 d1             	mov    %rdx,%rcx
+  80091d:	48 89 c2             	mov    %rax,%rdx
+  800920:	be 01 00 00 00       	mov    $0x1,%esi
+  800925:	bf 19 00 00 00       	mov    $0x19,%edi
+  80092a:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800931:	00 00 00 
+  800934:	ff d0                	call   *%rax
+  800936:	48 83 c4 10          	add    $0x10,%rsp
+  80093a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80093d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+0000000000800942 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  800942:	55                   	push   %rbp
+  800943:	48 89 e5             	mov    %rsp,%rbp
+  800946:	48 83 ec 20          	sub    $0x20,%rsp
+  80094a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80094e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800952:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800955:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800958:	48 63 c8             	movslq %eax,%rcx
+  80095b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80095f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800963:	48 83 ec 08          	sub    $0x8,%rsp
+  800967:	6a 00                	push   $0x0
+  800969:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80096f:	49 89 c8             	mov    %rcx,%r8
+  800972:	48 89 d1             	mov    %rdx,%rcx
+  800975:	48 89 c2             	mov    %rax,%rdx
+  800978:	be 01 00 00 00       	mov    $0x1,%esi
+  80097d:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  800982:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800989:	00 00 00 
+  80098c:	ff d0                	call   *%rax
+  80098e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800992:	c9                   	leave
+  800993:	c3                   	ret
+
+0000000000800994 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  800994:	55                   	push   %rbp
+  800995:	48 89 e5             	mov    %rsp,%rbp
+  800998:	48 83 ec 20          	sub    $0x20,%rsp
+  80099c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009a4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009a8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b8:	6a 00                	push   $0x0
+  8009ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009c0:	49 89 c8             	mov    %rcx,%r8
+  8009c3:	48 89 d1             	mov    %rdx,%rcx
+  8009c6:	48 89 c2             	mov    %rax,%rdx
+  8009c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8009ce:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009d3:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  8009da:	00 00 00 
+  8009dd:	ff d0                	call   *%rax
+  8009df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009e3:	c9                   	leave
+  8009e4:	c3                   	ret
+
+00000000008009e5 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009e5:	55                   	push   %rbp
+  8009e6:	48 89 e5             	mov    %rsp,%rbp
+  8009e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8009ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009f5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8009f8:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8009fc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a00:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a03:	48 63 c8             	movslq %eax,%rcx
+  800a06:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a12:	6a 00                	push   $0x0
+  800a14:	49 89 f1             	mov    %rsi,%r9
+  800a17:	49 89 c8             	mov    %rcx,%r8
+  800a1a:	48 89 d1             	mov    %rdx,%rcx
+  800a1d:	48 89 c2             	mov    %rax,%rdx
+  800a20:	be 01 00 00 00       	mov    $0x1,%esi
+  800a25:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a2a:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800a31:	00 00 00 
+  800a34:	ff d0                	call   *%rax
+  800a36:	48 83 c4 10          	add    $0x10,%rsp
+  800a3a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+0000000000800a42 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a42:	55                   	push   %rbp
+  800a43:	48 89 e5             	mov    %rsp,%rbp
+  800a46:	48 83 ec 10          	sub    $0x10,%rsp
+  800a4a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a50:	48 98                	cltq
+  800a52:	48 83 ec 08          	sub    $0x8,%rsp
+  800a56:	6a 00                	push   $0x0
+  800a58:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a69:	48 89 c2             	mov    %rax,%rdx
+  800a6c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a71:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a76:	48 b8 f1 00 80 00 00 	movabs $0x8000f1,%rax
+  800a7d:	00 00 00 
+  800a80:	ff d0                	call   *%rax
+  800a82:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+
+0000000000800a88 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a88:	55                   	push   %rbp
+  800a89:	48 89 e5             	mov    %rsp,%rbp
+  800a8c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a98:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800a9f:	ff ff ff 
+  800aa2:	48 01 d0             	add    %rdx,%rax
+  800aa5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800aab:	55                   	push   %rbp
+  800aac:	48 89 e5             	mov    %rsp,%rbp
+  800aaf:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ab7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800abb:	48 89 c7             	mov    %rax,%rdi
+  800abe:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  800ac5:	00 00 00 
+  800ac8:	ff d0                	call   *%rax
+  800aca:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800ad0:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800ad4:	c9                   	leave
+  800ad5:	c3                   	ret
+
+0000000000800ad6 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800ad6:	55                   	push   %rbp
+  800ad7:	48 89 e5             	mov    %rsp,%rbp
+  800ada:	48 83 ec 18          	sub    $0x18,%rsp
+  800ade:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800ae2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ae9:	e9 ae 00 00 00       	jmp    800b9c <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800aee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800af1:	c1 e0 0c             	shl    $0xc,%eax
+  800af4:	48 98                	cltq
+  800af6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800afb:	48 01 d0             	add    %rdx,%rax
+  800afe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b06:	48 c1 e8 27          	shr    $0x27,%rax
+  800b0a:	48 89 c2             	mov    %rax,%rdx
+  800b0d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b14:	01 00 00 
+  800b17:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b1b:	83 e0 01             	and    $0x1,%eax
+  800b1e:	48 85 c0             	test   %rax,%rax
+  800b21:	74 63                	je     800b86 <fd_alloc+0xb0>
+  800b23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b27:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b2b:	48 89 c2             	mov    %rax,%rdx
+  800b2e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b35:	01 00 00 
+  800b38:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b3c:	83 e0 01             	and    $0x1,%eax
+  800b3f:	48 85 c0             	test   %rax,%rax
+  800b42:	74 42                	je     800b86 <fd_alloc+0xb0>
+  800b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b48:	48 c1 e8 15          	shr    $0x15,%rax
+  800b4c:	48 89 c2             	mov    %rax,%rdx
+  800b4f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b56:	01 00 00 
+  800b59:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b5d:	83 e0 01             	and    $0x1,%eax
+  800b60:	48 85 c0             	test   %rax,%rax
+  800b63:	74 21                	je     800b86 <fd_alloc+0xb0>
+  800b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b69:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b6d:	48 89 c2             	mov    %rax,%rdx
+  800b70:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b77:	01 00 00 
+  800b7a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b7e:	83 e0 01             	and    $0x1,%eax
+  800b81:	48 85 c0             	test   %rax,%rax
+  800b84:	75 12                	jne    800b98 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b8e:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b96:	eb 1e                	jmp    800bb6 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800b98:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800b9c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ba0:	0f 8e 48 ff ff ff    	jle    800aee <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800ba6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800baa:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bb1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bb6:	c9                   	leave
+  800bb7:	c3                   	ret
+
+0000000000800bb8 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bb8:	55                   	push   %rbp
+  800bb9:	48 89 e5             	mov    %rsp,%rbp
+  800bbc:	48 83 ec 20          	sub    $0x20,%rsp
+  800bc0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bc3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bc7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bcb:	78 06                	js     800bd3 <fd_lookup+0x1b>
+  800bcd:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bd1:	7e 0a                	jle    800bdd <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd8:	e9 af 00 00 00       	jmp    800c8c <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bdd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800be0:	c1 e0 0c             	shl    $0xc,%eax
+  800be3:	48 98                	cltq
+  800be5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800bea:	48 01 d0             	add    %rdx,%rax
+  800bed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bf5:	48 c1 e8 27          	shr    $0x27,%rax
+  800bf9:	48 89 c2             	mov    %rax,%rdx
+  800bfc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c03:	01 00 00 
+  800c06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c0a:	83 e0 01             	and    $0x1,%eax
+  800c0d:	48 85 c0             	test   %rax,%rax
+  800c10:	74 63                	je     800c75 <fd_lookup+0xbd>
+  800c12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c16:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c1a:	48 89 c2             	mov    %rax,%rdx
+  800c1d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c24:	01 00 00 
+  800c27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c2b:	83 e0 01             	and    $0x1,%eax
+  800c2e:	48 85 c0             	test   %rax,%rax
+  800c31:	74 42                	je     800c75 <fd_lookup+0xbd>
+  800c33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c37:	48 c1 e8 15          	shr    $0x15,%rax
+  800c3b:	48 89 c2             	mov    %rax,%rdx
+  800c3e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c45:	01 00 00 
+  800c48:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c4c:	83 e0 01             	and    $0x1,%eax
+  800c4f:	48 85 c0             	test   %rax,%rax
+  800c52:	74 21                	je     800c75 <fd_lookup+0xbd>
+  800c54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c58:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c5c:	48 89 c2             	mov    %rax,%rdx
+  800c5f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c66:	01 00 00 
+  800c69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c6d:	83 e0 01             	and    $0x1,%eax
+  800c70:	48 85 c0             	test   %rax,%rax
+  800c73:	75 07                	jne    800c7c <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c7a:	eb 10                	jmp    800c8c <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c80:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c84:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+
+0000000000800c8e <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c8e:	55                   	push   %rbp
+  800c8f:	48 89 e5             	mov    %rsp,%rbp
+  800c92:	48 83 ec 30          	sub    $0x30,%rsp
+  800c96:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c9a:	89 f0                	mov    %esi,%eax
+  800c9c:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800c9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ca3:	48 89 c7             	mov    %rax,%rdi
+  800ca6:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+  800cb2:	89 c2                	mov    %eax,%edx
+  800cb4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cb8:	48 89 c6             	mov    %rax,%rsi
+  800cbb:	89 d7                	mov    %edx,%edi
+  800cbd:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  800cc4:	00 00 00 
+  800cc7:	ff d0                	call   *%rax
+  800cc9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ccc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800cd0:	78 0a                	js     800cdc <fd_close+0x4e>
+  800cd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cd6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cda:	74 12                	je     800cee <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cdc:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800ce0:	74 05                	je     800ce7 <fd_close+0x59>
+  800ce2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ce5:	eb 70                	jmp    800d57 <fd_close+0xc9>
+  800ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cec:	eb 69                	jmp    800d57 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cf2:	8b 00                	mov    (%rax),%eax
+  800cf4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800cf8:	48 89 d6             	mov    %rdx,%rsi
+  800cfb:	89 c7                	mov    %eax,%edi
+  800cfd:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  800d04:	00 00 00 
+  800d07:	ff d0                	call   *%rax
+  800d09:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d0c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d10:	78 2a                	js     800d3c <fd_close+0xae>
+    if (dev->dev_close)
+  800d12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d16:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d1a:	48 85 c0             	test   %rax,%rax
+  800d1d:	74 16                	je     800d35 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d23:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d2b:	48 89 c7             	mov    %rax,%rdi
+  800d2e:	ff d2                	call   *%rdx
+  800d30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d33:	eb 07                	jmp    800d3c <fd_close+0xae>
+    else
+      r = 0;
+  800d35:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d40:	48 89 c6             	mov    %rax,%rsi
+  800d43:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d48:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  800d4f:	00 00 00 
+  800d52:	ff d0                	call   *%rax
+  return r;
+  800d54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+0000000000800d59 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d59:	55                   	push   %rbp
+  800d5a:	48 89 e5             	mov    %rsp,%rbp
+  800d5d:	48 83 ec 20          	sub    $0x20,%rsp
+  800d61:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d64:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d68:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d6f:	eb 3f                	jmp    800db0 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d71:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d78:	00 00 00 
+  800d7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d7e:	48 98                	cltq
+  800d80:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d84:	8b 00                	mov    (%rax),%eax
+  800d86:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d89:	75 21                	jne    800dac <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d8b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d92:	00 00 00 
+  800d95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d98:	48 98                	cltq
+  800d9a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800d9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800da2:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daa:	eb 7f                	jmp    800e2b <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800dac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800db0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800db7:	00 00 00 
+  800dba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dbd:	48 98                	cltq
+  800dbf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dc3:	48 85 c0             	test   %rax,%rax
+  800dc6:	75 a9                	jne    800d71 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dc8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dcf:	00 00 00 
+  800dd2:	8b 40 04             	mov    0x4(%rax),%eax
+  800dd5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dda:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800de1:	00 00 00 
+  800de4:	48 98                	cltq
+  800de6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800ded:	48 01 d0             	add    %rdx,%rax
+  800df0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800df6:	8b 00                	mov    (%rax),%eax
+  800df8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800dfb:	89 c6                	mov    %eax,%esi
+  800dfd:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800e04:	00 00 00 
+  800e07:	48 89 c7             	mov    %rax,%rdi
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0f:	48 b9 50 31 80 00 00 	movabs $0x803150,%rcx
+  800e16:	00 00 00 
+  800e19:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e1f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e2b:	c9                   	leave
+  800e2c:	c3                   	ret
+
+0000000000800e2d <close>:
+
+int
+close(int fdnum) {
+  800e2d:	55                   	push   %rbp
+  800e2e:	48 89 e5             	mov    %rsp,%rbp
+  800e31:	48 83 ec 20          	sub    $0x20,%rsp
+  800e35:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e38:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e3f:	48 89 d6             	mov    %rdx,%rsi
+  800e42:	89 c7                	mov    %eax,%edi
+  800e44:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  800e4b:	00 00 00 
+  800e4e:	ff d0                	call   *%rax
+  800e50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e57:	79 05                	jns    800e5e <close+0x31>
+    return r;
+  800e59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e5c:	eb 18                	jmp    800e76 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e62:	be 01 00 00 00       	mov    $0x1,%esi
+  800e67:	48 89 c7             	mov    %rax,%rdi
+  800e6a:	48 b8 8e 0c 80 00 00 	movabs $0x800c8e,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+}
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+0000000000800e78 <close_all>:
+
+void
+close_all(void) {
+  800e78:	55                   	push   %rbp
+  800e79:	48 89 e5             	mov    %rsp,%rbp
+  800e7c:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e87:	eb 15                	jmp    800e9e <close_all+0x26>
+    close(i);
+  800e89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e8c:	89 c7                	mov    %eax,%edi
+  800e8e:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  800e95:	00 00 00 
+  800e98:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800e9a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e9e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ea2:	7e e5                	jle    800e89 <close_all+0x11>
+}
+  800ea4:	90                   	nop
+  800ea5:	90                   	nop
+  800ea6:	c9                   	leave
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ea8:	55                   	push   %rbp
+  800ea9:	48 89 e5             	mov    %rsp,%rbp
+  800eac:	48 83 ec 40          	sub    $0x40,%rsp
+  800eb0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800eb3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800eb6:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800eba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ebd:	48 89 d6             	mov    %rdx,%rsi
+  800ec0:	89 c7                	mov    %eax,%edi
+  800ec2:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  800ec9:	00 00 00 
+  800ecc:	ff d0                	call   *%rax
+  800ece:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ed1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ed5:	79 08                	jns    800edf <dup+0x37>
+    return r;
+  800ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800eda:	e9 33 02 00 00       	jmp    801112 <dup+0x26a>
+  close(newfdnum);
+  800edf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ee2:	89 c7                	mov    %eax,%edi
+  800ee4:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  800eeb:	00 00 00 
+  800eee:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800ef0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ef3:	c1 e0 0c             	shl    $0xc,%eax
+  800ef6:	48 98                	cltq
+  800ef8:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800efd:	48 01 d0             	add    %rdx,%rax
+  800f00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f08:	48 89 c7             	mov    %rax,%rdi
+  800f0b:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+  800f17:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f1f:	48 89 c7             	mov    %rax,%rdi
+  800f22:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800f29:	00 00 00 
+  800f2c:	ff d0                	call   *%rax
+  800f2e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f32:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f39:	00 
+  800f3a:	e9 19 01 00 00       	jmp    801058 <dup+0x1b0>
+    off -= PGSIZE;
+  800f3f:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f46:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f4f:	48 01 d0             	add    %rdx,%rax
+  800f52:	48 c1 e8 27          	shr    $0x27,%rax
+  800f56:	48 89 c2             	mov    %rax,%rdx
+  800f59:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f60:	01 00 00 
+  800f63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f67:	83 e0 01             	and    $0x1,%eax
+  800f6a:	48 85 c0             	test   %rax,%rax
+  800f6d:	0f 84 e5 00 00 00    	je     801058 <dup+0x1b0>
+  800f73:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f7b:	48 01 d0             	add    %rdx,%rax
+  800f7e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f82:	48 89 c2             	mov    %rax,%rdx
+  800f85:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f8c:	01 00 00 
+  800f8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f93:	83 e0 01             	and    $0x1,%eax
+  800f96:	48 85 c0             	test   %rax,%rax
+  800f99:	0f 84 b9 00 00 00    	je     801058 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800f9f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa7:	48 01 d0             	add    %rdx,%rax
+  800faa:	48 c1 e8 15          	shr    $0x15,%rax
+  800fae:	48 89 c2             	mov    %rax,%rdx
+  800fb1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fb8:	01 00 00 
+  800fbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fbf:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fc2:	48 85 c0             	test   %rax,%rax
+  800fc5:	0f 84 8d 00 00 00    	je     801058 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fcb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd3:	48 01 d0             	add    %rdx,%rax
+  800fd6:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fda:	48 89 c2             	mov    %rax,%rdx
+  800fdd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fe4:	01 00 00 
+  800fe7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800feb:	83 e0 01             	and    $0x1,%eax
+  800fee:	48 85 c0             	test   %rax,%rax
+  800ff1:	74 65                	je     801058 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800ff3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ff7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ffb:	48 01 d0             	add    %rdx,%rax
+  800ffe:	48 c1 e8 0c          	shr    $0xc,%rax
+  801002:	48 89 c2             	mov    %rax,%rdx
+  801005:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80100c:	01 00 00 
+  80100f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801013:	25 07 0e 00 00       	and    $0xe07,%eax
+  801018:	89 c6                	mov    %eax,%esi
+  80101a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80101e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801022:	48 01 c2             	add    %rax,%rdx
+  801025:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801029:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80102d:	48 01 c8             	add    %rcx,%rax
+  801030:	41 89 f0             	mov    %esi,%r8d
+  801033:	48 89 d1             	mov    %rdx,%rcx
+  801036:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103b:	48 89 c6             	mov    %rax,%rsi
+  80103e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801043:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  80104a:	00 00 00 
+  80104d:	ff d0                	call   *%rax
+  80104f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801052:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801056:	78 60                	js     8010b8 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801058:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80105d:	0f 85 dc fe ff ff    	jne    800f3f <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801063:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801067:	48 c1 e8 0c          	shr    $0xc,%rax
+  80106b:	48 89 c2             	mov    %rax,%rdx
+  80106e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801075:	01 00 00 
+  801078:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80107c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801081:	89 c1                	mov    %eax,%ecx
+  801083:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801087:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80108b:	41 89 c8             	mov    %ecx,%r8d
+  80108e:	48 89 d1             	mov    %rdx,%rcx
+  801091:	ba 00 00 00 00       	mov    $0x0,%edx
+  801096:	48 89 c6             	mov    %rax,%rsi
+  801099:	bf 00 00 00 00       	mov    $0x0,%edi
+  80109e:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  8010a5:	00 00 00 
+  8010a8:	ff d0                	call   *%rax
+  8010aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010b1:	78 08                	js     8010bb <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010b3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010b6:	eb 5a                	jmp    801112 <dup+0x26a>
+        goto err;
+  8010b8:	90                   	nop
+  8010b9:	eb 01                	jmp    8010bc <dup+0x214>
+    goto err;
+  8010bb:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c0:	48 89 c6             	mov    %rax,%rsi
+  8010c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c8:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8010cf:	00 00 00 
+  8010d2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010d4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010db:	00 
+  8010dc:	eb 27                	jmp    801105 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010e6:	48 01 d0             	add    %rdx,%rax
+  8010e9:	48 89 c6             	mov    %rax,%rsi
+  8010ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010f1:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8010f8:	00 00 00 
+  8010fb:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010fd:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801104:	00 
+  801105:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80110c:	00 
+  80110d:	76 cf                	jbe    8010de <dup+0x236>
+  return r;
+  80110f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+0000000000801114 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	48 83 ec 40          	sub    $0x40,%rsp
+  80111c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80111f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801123:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801127:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80112b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80112e:	48 89 d6             	mov    %rdx,%rsi
+  801131:	89 c7                	mov    %eax,%edi
+  801133:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  80113a:	00 00 00 
+  80113d:	ff d0                	call   *%rax
+  80113f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801142:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801146:	78 24                	js     80116c <read+0x58>
+  801148:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114c:	8b 00                	mov    (%rax),%eax
+  80114e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801152:	48 89 d6             	mov    %rdx,%rsi
+  801155:	89 c7                	mov    %eax,%edi
+  801157:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  80115e:	00 00 00 
+  801161:	ff d0                	call   *%rax
+  801163:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801166:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80116a:	79 0a                	jns    801176 <read+0x62>
+    return r;
+  80116c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80116f:	48 98                	cltq
+  801171:	e9 9e 00 00 00       	jmp    801214 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801176:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80117a:	8b 40 08             	mov    0x8(%rax),%eax
+  80117d:	83 e0 03             	and    $0x3,%eax
+  801180:	83 f8 01             	cmp    $0x1,%eax
+  801183:	75 5c                	jne    8011e1 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801185:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80118c:	00 00 00 
+  80118f:	8b 40 04             	mov    0x4(%rax),%eax
+  801192:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801197:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80119e:	00 00 00 
+  8011a1:	48 98                	cltq
+  8011a3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011aa:	48 01 d0             	add    %rdx,%rax
+  8011ad:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011b3:	8b 00                	mov    (%rax),%eax
+  8011b5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011b8:	89 c6                	mov    %eax,%esi
+  8011ba:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011c1:	00 00 00 
+  8011c4:	48 89 c7             	mov    %rax,%rdi
+  8011c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cc:	48 b9 50 31 80 00 00 	movabs $0x803150,%rcx
+  8011d3:	00 00 00 
+  8011d6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011d8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011df:	eb 33                	jmp    801214 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011e9:	48 85 c0             	test   %rax,%rax
+  8011ec:	75 09                	jne    8011f7 <read+0xe3>
+    return -E_NOT_SUPP;
+  8011ee:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8011f5:	eb 1d                	jmp    801214 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8011f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011fb:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8011ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801203:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801207:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80120b:	48 89 ce             	mov    %rcx,%rsi
+  80120e:	48 89 c7             	mov    %rax,%rdi
+  801211:	41 ff d0             	call   *%r8
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+0000000000801216 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	48 83 ec 30          	sub    $0x30,%rsp
+  80121e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801221:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801225:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801229:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801230:	eb 49                	jmp    80127b <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  801232:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801235:	48 98                	cltq
+  801237:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80123b:	48 29 c2             	sub    %rax,%rdx
+  80123e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801241:	48 63 c8             	movslq %eax,%rcx
+  801244:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801248:	48 01 c1             	add    %rax,%rcx
+  80124b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80124e:	48 89 ce             	mov    %rcx,%rsi
+  801251:	89 c7                	mov    %eax,%edi
+  801253:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  80125a:	00 00 00 
+  80125d:	ff d0                	call   *%rax
+  80125f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  801262:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801266:	79 07                	jns    80126f <readn+0x59>
+      return m;
+  801268:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80126b:	48 98                	cltq
+  80126d:	eb 1f                	jmp    80128e <readn+0x78>
+    if (m == 0)
+  80126f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801273:	74 13                	je     801288 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801275:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801278:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80127b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80127e:	48 98                	cltq
+  801280:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801284:	72 ac                	jb     801232 <readn+0x1c>
+  801286:	eb 01                	jmp    801289 <readn+0x73>
+      break;
+  801288:	90                   	nop
+  }
+  return tot;
+  801289:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80128c:	48 98                	cltq
+}
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+
+0000000000801290 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	48 83 ec 40          	sub    $0x40,%rsp
+  801298:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80129b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80129f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012a3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012aa:	48 89 d6             	mov    %rdx,%rsi
+  8012ad:	89 c7                	mov    %eax,%edi
+  8012af:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  8012b6:	00 00 00 
+  8012b9:	ff d0                	call   *%rax
+  8012bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012c2:	78 24                	js     8012e8 <write+0x58>
+  8012c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c8:	8b 00                	mov    (%rax),%eax
+  8012ca:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012ce:	48 89 d6             	mov    %rdx,%rsi
+  8012d1:	89 c7                	mov    %eax,%edi
+  8012d3:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  8012da:	00 00 00 
+  8012dd:	ff d0                	call   *%rax
+  8012df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012e6:	79 0a                	jns    8012f2 <write+0x62>
+    return r;
+  8012e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012eb:	48 98                	cltq
+  8012ed:	e9 9d 00 00 00       	jmp    80138f <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f6:	8b 40 08             	mov    0x8(%rax),%eax
+  8012f9:	83 e0 03             	and    $0x3,%eax
+  8012fc:	85 c0                	test   %eax,%eax
+  8012fe:	75 5c                	jne    80135c <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801300:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801307:	00 00 00 
+  80130a:	8b 40 04             	mov    0x4(%rax),%eax
+  80130d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801312:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801319:	00 00 00 
+  80131c:	48 98                	cltq
+  80131e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801325:	48 01 d0             	add    %rdx,%rax
+  801328:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80132e:	8b 00                	mov    (%rax),%eax
+  801330:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801333:	89 c6                	mov    %eax,%esi
+  801335:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  80133c:	00 00 00 
+  80133f:	48 89 c7             	mov    %rax,%rdi
+  801342:	b8 00 00 00 00       	mov    $0x0,%eax
+  801347:	48 b9 50 31 80 00 00 	movabs $0x803150,%rcx
+  80134e:	00 00 00 
+  801351:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801353:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80135a:	eb 33                	jmp    80138f <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80135c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801360:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801364:	48 85 c0             	test   %rax,%rax
+  801367:	75 09                	jne    801372 <write+0xe2>
+    return -E_NOT_SUPP;
+  801369:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801370:	eb 1d                	jmp    80138f <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  801372:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801376:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80137a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801382:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801386:	48 89 ce             	mov    %rcx,%rsi
+  801389:	48 89 c7             	mov    %rax,%rdi
+  80138c:	41 ff d0             	call   *%r8
+}
+  80138f:	c9                   	leave
+  801390:	c3                   	ret
+
+0000000000801391 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801391:	55                   	push   %rbp
+  801392:	48 89 e5             	mov    %rsp,%rbp
+  801395:	48 83 ec 18          	sub    $0x18,%rsp
+  801399:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80139c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80139f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013a6:	48 89 d6             	mov    %rdx,%rsi
+  8013a9:	89 c7                	mov    %eax,%edi
+  8013ab:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  8013b2:	00 00 00 
+  8013b5:	ff d0                	call   *%rax
+  8013b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013be:	79 05                	jns    8013c5 <seek+0x34>
+    return r;
+  8013c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013c3:	eb 0f                	jmp    8013d4 <seek+0x43>
+  fd->fd_offset = offset;
+  8013c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013cc:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d4:	c9                   	leave
+  8013d5:	c3                   	ret
+
+00000000008013d6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013d6:	55                   	push   %rbp
+  8013d7:	48 89 e5             	mov    %rsp,%rbp
+  8013da:	48 83 ec 30          	sub    $0x30,%rsp
+  8013de:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013e1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013eb:	48 89 d6             	mov    %rdx,%rsi
+  8013ee:	89 c7                	mov    %eax,%edi
+  8013f0:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  8013f7:	00 00 00 
+  8013fa:	ff d0                	call   *%rax
+  8013fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801403:	78 24                	js     801429 <ftruncate+0x53>
+  801405:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801409:	8b 00                	mov    (%rax),%eax
+  80140b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80140f:	48 89 d6             	mov    %rdx,%rsi
+  801412:	89 c7                	mov    %eax,%edi
+  801414:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  80141b:	00 00 00 
+  80141e:	ff d0                	call   *%rax
+  801420:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801423:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801427:	79 08                	jns    801431 <ftruncate+0x5b>
+    return r;
+  801429:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80142c:	e9 92 00 00 00       	jmp    8014c3 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801435:	8b 40 08             	mov    0x8(%rax),%eax
+  801438:	83 e0 03             	and    $0x3,%eax
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	75 5a                	jne    801499 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80143f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801446:	00 00 00 
+  801449:	8b 40 04             	mov    0x4(%rax),%eax
+  80144c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801451:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801458:	00 00 00 
+  80145b:	48 98                	cltq
+  80145d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801464:	48 01 d0             	add    %rdx,%rax
+  801467:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80146d:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80146f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801472:	89 c6                	mov    %eax,%esi
+  801474:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  80147b:	00 00 00 
+  80147e:	48 89 c7             	mov    %rax,%rdi
+  801481:	b8 00 00 00 00       	mov    $0x0,%eax
+  801486:	48 b9 50 31 80 00 00 	movabs $0x803150,%rcx
+  80148d:	00 00 00 
+  801490:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801492:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801497:	eb 2a                	jmp    8014c3 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801499:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80149d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014a1:	48 85 c0             	test   %rax,%rax
+  8014a4:	75 07                	jne    8014ad <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014a6:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014ab:	eb 16                	jmp    8014c3 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b1:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014bc:	89 d6                	mov    %edx,%esi
+  8014be:	48 89 c7             	mov    %rax,%rdi
+  8014c1:	ff d1                	call   *%rcx
+}
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+00000000008014c5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8014cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014d0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014db:	48 89 d6             	mov    %rdx,%rsi
+  8014de:	89 c7                	mov    %eax,%edi
+  8014e0:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  8014e7:	00 00 00 
+  8014ea:	ff d0                	call   *%rax
+  8014ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014f3:	78 24                	js     801519 <fstat+0x54>
+  8014f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f9:	8b 00                	mov    (%rax),%eax
+  8014fb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8014ff:	48 89 d6             	mov    %rdx,%rsi
+  801502:	89 c7                	mov    %eax,%edi
+  801504:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  80150b:	00 00 00 
+  80150e:	ff d0                	call   *%rax
+  801510:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801513:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801517:	79 05                	jns    80151e <fstat+0x59>
+    return r;
+  801519:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80151c:	eb 5e                	jmp    80157c <fstat+0xb7>
+  if (!dev->dev_stat)
+  80151e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801522:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801526:	48 85 c0             	test   %rax,%rax
+  801529:	75 07                	jne    801532 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80152b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801530:	eb 4a                	jmp    80157c <fstat+0xb7>
+  stat->st_name[0] = 0;
+  801532:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801536:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801539:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80153d:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801544:	00 00 00 
+  stat->st_isdir   = 0;
+  801547:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80154b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  801552:	00 00 00 
+  stat->st_dev     = dev;
+  801555:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801559:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80155d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  801564:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801568:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80156c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801570:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801574:	48 89 d6             	mov    %rdx,%rsi
+  801577:	48 89 c7             	mov    %rax,%rdi
+  80157a:	ff d1                	call   *%rcx
+}
+  80157c:	c9                   	leave
+  80157d:	c3                   	ret
+
+000000000080157e <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80157e:	55                   	push   %rbp
+  80157f:	48 89 e5             	mov    %rsp,%rbp
+  801582:	48 83 ec 10          	sub    $0x10,%rsp
+  801586:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80158a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80158e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801592:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801598:	83 f8 20             	cmp    $0x20,%eax
+  80159b:	75 07                	jne    8015a4 <pollwait_key+0x26>
+    return -E_INVAL;
+  80159d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a2:	eb 5f                	jmp    801603 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a8:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b2:	48 63 d2             	movslq %edx,%rdx
+  8015b5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015b9:	48 01 c2             	add    %rax,%rdx
+  8015bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c0:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c7:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d1:	8b 00                	mov    (%rax),%eax
+  8015d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015d7:	48 63 c9             	movslq %ecx,%rcx
+  8015da:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015de:	48 01 ca             	add    %rcx,%rdx
+  8015e1:	48 83 c2 08          	add    $0x8,%rdx
+  8015e5:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015eb:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8015f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f8:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8015fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801603:	c9                   	leave
+  801604:	c3                   	ret
+
+0000000000801605 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801610:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801617:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80161d:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801624:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80162b:	00 
+  int i, r, ready, ipc = 0;
+  80162c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  801633:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80163a:	00 
+  80163b:	74 45                	je     801682 <poll+0x7d>
+  80163d:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801644:	ff 
+  801645:	74 3b                	je     801682 <poll+0x7d>
+    now      = vsys_clock_ns();
+  801647:	48 b8 40 2b 80 00 00 	movabs $0x802b40,%rax
+  80164e:	00 00 00 
+  801651:	ff d0                	call   *%rax
+  801653:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801657:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80165b:	48 f7 d0             	not    %rax
+  80165e:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801665:	73 10                	jae    801677 <poll+0x72>
+  801667:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80166b:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  801672:	48 01 d0             	add    %rdx,%rax
+  801675:	eb 07                	jmp    80167e <poll+0x79>
+  801677:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80167e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  801682:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801689:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  801690:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801697:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80169e:	e9 46 02 00 00       	jmp    8018e9 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016a6:	48 63 d0             	movslq %eax,%rdx
+  8016a9:	48 89 d0             	mov    %rdx,%rax
+  8016ac:	48 01 c0             	add    %rax,%rax
+  8016af:	48 01 d0             	add    %rdx,%rax
+  8016b2:	48 c1 e0 02          	shl    $0x2,%rax
+  8016b6:	48 89 c2             	mov    %rax,%rdx
+  8016b9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016c0:	48 01 d0             	add    %rdx,%rax
+  8016c3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016cd:	48 63 d0             	movslq %eax,%rdx
+  8016d0:	48 89 d0             	mov    %rdx,%rax
+  8016d3:	48 01 c0             	add    %rax,%rax
+  8016d6:	48 01 d0             	add    %rdx,%rax
+  8016d9:	48 c1 e0 02          	shl    $0x2,%rax
+  8016dd:	48 89 c2             	mov    %rax,%rdx
+  8016e0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016e7:	48 01 d0             	add    %rdx,%rax
+  8016ea:	8b 00                	mov    (%rax),%eax
+  8016ec:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016ef:	75 62                	jne    801753 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8016f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016f4:	48 63 d0             	movslq %eax,%rdx
+  8016f7:	48 89 d0             	mov    %rdx,%rax
+  8016fa:	48 01 c0             	add    %rax,%rax
+  8016fd:	48 01 d0             	add    %rdx,%rax
+  801700:	48 c1 e0 02          	shl    $0x2,%rax
+  801704:	48 89 c2             	mov    %rax,%rdx
+  801707:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80170e:	48 01 d0             	add    %rdx,%rax
+  801711:	8b 40 04             	mov    0x4(%rax),%eax
+  801714:	83 e0 01             	and    $0x1,%eax
+  801717:	85 c0                	test   %eax,%eax
+  801719:	0f 84 9b 01 00 00    	je     8018ba <poll+0x2b5>
+          fds[i].revents = ipc;
+  80171f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801722:	48 63 d0             	movslq %eax,%rdx
+  801725:	48 89 d0             	mov    %rdx,%rax
+  801728:	48 01 c0             	add    %rax,%rax
+  80172b:	48 01 d0             	add    %rdx,%rax
+  80172e:	48 c1 e0 02          	shl    $0x2,%rax
+  801732:	48 89 c2             	mov    %rax,%rdx
+  801735:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80173c:	48 01 c2             	add    %rax,%rdx
+  80173f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801742:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801745:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801748:	83 c8 04             	or     $0x4,%eax
+  80174b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80174e:	e9 67 01 00 00       	jmp    8018ba <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  801753:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801756:	48 63 d0             	movslq %eax,%rdx
+  801759:	48 89 d0             	mov    %rdx,%rax
+  80175c:	48 01 c0             	add    %rax,%rax
+  80175f:	48 01 d0             	add    %rdx,%rax
+  801762:	48 c1 e0 02          	shl    $0x2,%rax
+  801766:	48 89 c2             	mov    %rax,%rdx
+  801769:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801770:	48 01 d0             	add    %rdx,%rax
+  801773:	8b 00                	mov    (%rax),%eax
+  801775:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80177c:	48 89 d6             	mov    %rdx,%rsi
+  80177f:	89 c7                	mov    %eax,%edi
+  801781:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  801788:	00 00 00 
+  80178b:	ff d0                	call   *%rax
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 25                	js     8017b6 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  801791:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801798:	8b 00                	mov    (%rax),%eax
+  80179a:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017a1:	48 89 d6             	mov    %rdx,%rsi
+  8017a4:	89 c7                	mov    %eax,%edi
+  8017a6:	48 b8 59 0d 80 00 00 	movabs $0x800d59,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	79 2c                	jns    8017e2 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017b9:	48 63 d0             	movslq %eax,%rdx
+  8017bc:	48 89 d0             	mov    %rdx,%rax
+  8017bf:	48 01 c0             	add    %rax,%rax
+  8017c2:	48 01 d0             	add    %rdx,%rax
+  8017c5:	48 c1 e0 02          	shl    $0x2,%rax
+  8017c9:	48 89 c2             	mov    %rax,%rdx
+  8017cc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017d3:	48 01 d0             	add    %rdx,%rax
+  8017d6:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017dd:	e9 d8 00 00 00       	jmp    8018ba <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017e2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017e9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017ed:	48 85 c0             	test   %rax,%rax
+  8017f0:	74 7d                	je     80186f <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8017f2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017f9:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8017fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801800:	48 63 d0             	movslq %eax,%rdx
+  801803:	48 89 d0             	mov    %rdx,%rax
+  801806:	48 01 c0             	add    %rax,%rax
+  801809:	48 01 d0             	add    %rdx,%rax
+  80180c:	48 c1 e0 02          	shl    $0x2,%rax
+  801810:	48 89 c2             	mov    %rax,%rdx
+  801813:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80181a:	48 01 d0             	add    %rdx,%rax
+  80181d:	8b 48 04             	mov    0x4(%rax),%ecx
+  801820:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801827:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80182e:	89 ce                	mov    %ecx,%esi
+  801830:	48 89 c7             	mov    %rax,%rdi
+  801833:	41 ff d0             	call   *%r8
+  801836:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801839:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80183d:	79 08                	jns    801847 <poll+0x242>
+          return r;
+  80183f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801842:	e9 45 01 00 00       	jmp    80198c <poll+0x387>
+        fds[i].revents = r;
+  801847:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80184a:	48 63 d0             	movslq %eax,%rdx
+  80184d:	48 89 d0             	mov    %rdx,%rax
+  801850:	48 01 c0             	add    %rax,%rax
+  801853:	48 01 d0             	add    %rdx,%rax
+  801856:	48 c1 e0 02          	shl    $0x2,%rax
+  80185a:	48 89 c2             	mov    %rax,%rdx
+  80185d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801864:	48 01 c2             	add    %rax,%rdx
+  801867:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80186a:	89 42 08             	mov    %eax,0x8(%rdx)
+  80186d:	eb 4b                	jmp    8018ba <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80186f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801872:	48 63 d0             	movslq %eax,%rdx
+  801875:	48 89 d0             	mov    %rdx,%rax
+  801878:	48 01 c0             	add    %rax,%rax
+  80187b:	48 01 d0             	add    %rdx,%rax
+  80187e:	48 c1 e0 02          	shl    $0x2,%rax
+  801882:	48 89 c2             	mov    %rax,%rdx
+  801885:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80188c:	48 01 d0             	add    %rdx,%rax
+  80188f:	8b 48 04             	mov    0x4(%rax),%ecx
+  801892:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801895:	48 63 d0             	movslq %eax,%rdx
+  801898:	48 89 d0             	mov    %rdx,%rax
+  80189b:	48 01 c0             	add    %rax,%rax
+  80189e:	48 01 d0             	add    %rdx,%rax
+  8018a1:	48 c1 e0 02          	shl    $0x2,%rax
+  8018a5:	48 89 c2             	mov    %rax,%rdx
+  8018a8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018af:	48 01 d0             	add    %rdx,%rax
+  8018b2:	83 e1 03             	and    $0x3,%ecx
+  8018b5:	89 ca                	mov    %ecx,%edx
+  8018b7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018bd:	48 63 d0             	movslq %eax,%rdx
+  8018c0:	48 89 d0             	mov    %rdx,%rax
+  8018c3:	48 01 c0             	add    %rax,%rax
+  8018c6:	48 01 d0             	add    %rdx,%rax
+  8018c9:	48 c1 e0 02          	shl    $0x2,%rax
+  8018cd:	48 89 c2             	mov    %rax,%rdx
+  8018d0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018d7:	48 01 d0             	add    %rdx,%rax
+  8018da:	8b 40 08             	mov    0x8(%rax),%eax
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	74 04                	je     8018e5 <poll+0x2e0>
+        ready++;
+  8018e1:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018e5:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ec:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8018f2:	0f 8c ab fd ff ff    	jl     8016a3 <poll+0x9e>
+    }
+    if (ready)
+  8018f8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8018fc:	74 08                	je     801906 <poll+0x301>
+      return ready;
+  8018fe:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801901:	e9 86 00 00 00       	jmp    80198c <poll+0x387>
+
+    if (deadline) {
+  801906:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80190b:	74 30                	je     80193d <poll+0x338>
+      now     = vsys_clock_ns();
+  80190d:	48 b8 40 2b 80 00 00 	movabs $0x802b40,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+  801919:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80191d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801921:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801925:	73 0a                	jae    801931 <poll+0x32c>
+  801927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80192f:	eb 05                	jmp    801936 <poll+0x331>
+  801931:	b8 00 00 00 00       	mov    $0x0,%eax
+  801936:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80193d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801940:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  801943:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80194a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  801951:	48 89 c7             	mov    %rax,%rdi
+  801954:	48 b8 e9 07 80 00 00 	movabs $0x8007e9,%rax
+  80195b:	00 00 00 
+  80195e:	ff d0                	call   *%rax
+  801960:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  801963:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801967:	75 07                	jne    801970 <poll+0x36b>
+      return 0;
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196e:	eb 1c                	jmp    80198c <poll+0x387>
+    if (r < 0)
+  801970:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801974:	79 05                	jns    80197b <poll+0x376>
+      return r;
+  801976:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801979:	eb 11                	jmp    80198c <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80197b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80197e:	c1 f8 02             	sar    $0x2,%eax
+  801981:	83 e0 01             	and    $0x1,%eax
+  801984:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801987:	e9 f6 fc ff ff       	jmp    801682 <poll+0x7d>
+  }
+}
+  80198c:	c9                   	leave
+  80198d:	c3                   	ret
+
+000000000080198e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80198e:	55                   	push   %rbp
+  80198f:	48 89 e5             	mov    %rsp,%rbp
+  801992:	48 83 ec 20          	sub    $0x20,%rsp
+  801996:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80199a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80199e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a7:	48 89 c7             	mov    %rax,%rdi
+  8019aa:	48 b8 7c 1a 80 00 00 	movabs $0x801a7c,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019bd:	79 05                	jns    8019c4 <stat+0x36>
+    return fd;
+  8019bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019c2:	eb 2f                	jmp    8019f3 <stat+0x65>
+  r = fstat(fd, stat);
+  8019c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019cb:	48 89 d6             	mov    %rdx,%rsi
+  8019ce:	89 c7                	mov    %eax,%edi
+  8019d0:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8019d7:	00 00 00 
+  8019da:	ff d0                	call   *%rax
+  8019dc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019e2:	89 c7                	mov    %eax,%edi
+  8019e4:	48 b8 2d 0e 80 00 00 	movabs $0x800e2d,%rax
+  8019eb:	00 00 00 
+  8019ee:	ff d0                	call   *%rax
+  return r;
+  8019f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+00000000008019f5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019f5:	55                   	push   %rbp
+  8019f6:	48 89 e5             	mov    %rsp,%rbp
+  8019f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a04:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a0b:	00 00 00 
+  801a0e:	8b 00                	mov    (%rax),%eax
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	75 1d                	jne    801a31 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a14:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a19:	48 b8 48 4e 80 00 00 	movabs $0x804e48,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+  801a25:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a2c:	00 00 00 
+  801a2f:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a31:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a38:	00 00 00 
+  801a3b:	8b 00                	mov    (%rax),%eax
+  801a3d:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a40:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a45:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a4c:	00 00 00 
+  801a4f:	89 c7                	mov    %eax,%edi
+  801a51:	48 b8 9b 4d 80 00 00 	movabs $0x804d9b,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	48 89 c6             	mov    %rax,%rsi
+  801a69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6e:	48 b8 1e 4c 80 00 00 	movabs $0x804c1e,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+}
+  801a7a:	c9                   	leave
+  801a7b:	c3                   	ret
+
+0000000000801a7c <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a7c:	55                   	push   %rbp
+  801a7d:	48 89 e5             	mov    %rsp,%rbp
+  801a80:	48 83 ec 20          	sub    $0x20,%rsp
+  801a84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a88:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a8f:	48 89 c7             	mov    %rax,%rdi
+  801a92:	48 b8 ff 3f 80 00 00 	movabs $0x803fff,%rax
+  801a99:	00 00 00 
+  801a9c:	ff d0                	call   *%rax
+  801a9e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aa3:	7e 0a                	jle    801aaf <open+0x33>
+    return -E_BAD_PATH;
+  801aa5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aaa:	e9 a8 00 00 00       	jmp    801b57 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801aaf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801ab3:	48 89 c7             	mov    %rax,%rdi
+  801ab6:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+  801ac2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ac5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ac9:	79 08                	jns    801ad3 <open+0x57>
+    return r;
+  801acb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ace:	e9 84 00 00 00       	jmp    801b57 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801ad3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad7:	48 89 c6             	mov    %rax,%rsi
+  801ada:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ae1:	00 00 00 
+  801ae4:	48 89 c7             	mov    %rax,%rdi
+  801ae7:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  801aee:	00 00 00 
+  801af1:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801af3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801afa:	00 00 00 
+  801afd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b00:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b0a:	48 89 c6             	mov    %rax,%rsi
+  801b0d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b12:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801b19:	00 00 00 
+  801b1c:	ff d0                	call   *%rax
+  801b1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b25:	79 1d                	jns    801b44 <open+0xc8>
+    fd_close(fd, 0);
+  801b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b30:	48 89 c7             	mov    %rax,%rdi
+  801b33:	48 b8 8e 0c 80 00 00 	movabs $0x800c8e,%rax
+  801b3a:	00 00 00 
+  801b3d:	ff d0                	call   *%rax
+    return r;
+  801b3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b42:	eb 13                	jmp    801b57 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b48:	48 89 c7             	mov    %rax,%rdi
+  801b4b:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+}
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+0000000000801b59 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b69:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b6c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b73:	00 00 00 
+  801b76:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b78:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b82:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+}
+  801b8e:	c9                   	leave
+  801b8f:	c3                   	ret
+
+0000000000801b90 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b90:	55                   	push   %rbp
+  801b91:	48 89 e5             	mov    %rsp,%rbp
+  801b94:	48 83 ec 30          	sub    $0x30,%rsp
+  801b98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b9c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801ba0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801ba4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ba9:	74 07                	je     801bb2 <devfile_read+0x22>
+  801bab:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bb0:	75 0a                	jne    801bbc <devfile_read+0x2c>
+  return E_INVAL;
+  801bb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bb7:	e9 b4 00 00 00       	jmp    801c70 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bbc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bc3:	00 
+  while (n) {
+  801bc4:	e9 98 00 00 00       	jmp    801c61 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bcd:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bd0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bd7:	00 00 00 
+  801bda:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bdc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801be3:	00 00 00 
+  801be6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bea:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801bee:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bf8:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801bff:	00 00 00 
+  801c02:	ff d0                	call   *%rax
+  801c04:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c07:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c0b:	7f 13                	jg     801c20 <devfile_read+0x90>
+      return res ? res : res0;
+  801c0d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c11:	74 07                	je     801c1a <devfile_read+0x8a>
+  801c13:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c16:	48 98                	cltq
+  801c18:	eb 56                	jmp    801c70 <devfile_read+0xe0>
+  801c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c1e:	eb 50                	jmp    801c70 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c23:	48 63 d0             	movslq %eax,%rdx
+  801c26:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c2a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c31:	00 00 00 
+  801c34:	48 89 ce             	mov    %rcx,%rsi
+  801c37:	48 89 c7             	mov    %rax,%rdi
+  801c3a:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+
+    buf += res;
+  801c46:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c49:	48 98                	cltq
+  801c4b:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c4f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c52:	48 98                	cltq
+  801c54:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c58:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c5b:	48 98                	cltq
+  801c5d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c61:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c66:	0f 85 5d ff ff ff    	jne    801bc9 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+0000000000801c72 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c72:	55                   	push   %rbp
+  801c73:	48 89 e5             	mov    %rsp,%rbp
+  801c76:	48 83 ec 50          	sub    $0x50,%rsp
+  801c7a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c7e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c82:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c86:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c8b:	74 07                	je     801c94 <devfile_write+0x22>
+  801c8d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c92:	75 0a                	jne    801c9e <devfile_write+0x2c>
+  return E_INVAL;
+  801c94:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c99:	e9 c9 00 00 00       	jmp    801d67 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801c9e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ca5:	00 
+
+  while (n) {
+  801ca6:	e9 ad 00 00 00       	jmp    801d58 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cab:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801caf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cb3:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cba:	00 
+  801cbb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cc3:	48 39 c2             	cmp    %rax,%rdx
+  801cc6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801cca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cd2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cd6:	48 89 c6             	mov    %rax,%rsi
+  801cd9:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801ce0:	00 00 00 
+  801ce3:	48 89 c7             	mov    %rax,%rdi
+  801ce6:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf6:	8b 40 0c             	mov    0xc(%rax),%eax
+  801cf9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d00:	00 00 00 
+  801d03:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d05:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d0c:	00 00 00 
+  801d0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d13:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d17:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d21:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+  801d2d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d30:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d34:	79 07                	jns    801d3d <devfile_write+0xcb>
+      return res;
+  801d36:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d39:	48 98                	cltq
+  801d3b:	eb 2a                	jmp    801d67 <devfile_write+0xf5>
+
+    buf += res;
+  801d3d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d40:	48 98                	cltq
+  801d42:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d49:	48 98                	cltq
+  801d4b:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d52:	48 98                	cltq
+  801d54:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d58:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d5d:	0f 85 48 ff ff ff    	jne    801cab <devfile_write+0x39>
+  }
+
+  return res0;
+  801d63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d67:	c9                   	leave
+  801d68:	c3                   	ret
+
+0000000000801d69 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	48 83 ec 20          	sub    $0x20,%rsp
+  801d71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d75:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d7d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d80:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d87:	00 00 00 
+  801d8a:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d91:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d96:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801da5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801da9:	79 05                	jns    801db0 <devfile_stat+0x47>
+    return r;
+  801dab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dae:	eb 59                	jmp    801e09 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801db0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801db4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dbb:	00 00 00 
+  801dbe:	48 89 d6             	mov    %rdx,%rsi
+  801dc1:	48 89 c7             	mov    %rax,%rdi
+  801dc4:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dd0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dd7:	00 00 00 
+  801dda:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801de0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801de4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dea:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801df1:	00 00 00 
+  801df4:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801dfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dfe:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e09:	c9                   	leave
+  801e0a:	c3                   	ret
+
+0000000000801e0b <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e0b:	55                   	push   %rbp
+  801e0c:	48 89 e5             	mov    %rsp,%rbp
+  801e0f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e21:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e28:	00 00 00 
+  801e2b:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e2d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e34:	00 00 00 
+  801e37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e3a:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e42:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e47:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+}
+  801e53:	c9                   	leave
+  801e54:	c3                   	ret
+
+0000000000801e55 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e55:	55                   	push   %rbp
+  801e56:	48 89 e5             	mov    %rsp,%rbp
+  801e59:	48 83 ec 18          	sub    $0x18,%rsp
+  801e5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e61:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e64:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e6b:	83 e0 03             	and    $0x3,%eax
+}
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+0000000000801e70 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e70:	55                   	push   %rbp
+  801e71:	48 89 e5             	mov    %rsp,%rbp
+  801e74:	48 83 ec 10          	sub    $0x10,%rsp
+  801e78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e80:	48 89 c7             	mov    %rax,%rdi
+  801e83:	48 b8 ff 3f 80 00 00 	movabs $0x803fff,%rax
+  801e8a:	00 00 00 
+  801e8d:	ff d0                	call   *%rax
+  801e8f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e94:	7e 07                	jle    801e9d <remove+0x2d>
+    return -E_BAD_PATH;
+  801e96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e9b:	eb 36                	jmp    801ed3 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801e9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ea1:	48 89 c6             	mov    %rax,%rsi
+  801ea4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801eab:	00 00 00 
+  801eae:	48 89 c7             	mov    %rax,%rdi
+  801eb1:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec2:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ec7:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801ece:	00 00 00 
+  801ed1:	ff d0                	call   *%rax
+}
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+0000000000801ed5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ed5:	55                   	push   %rbp
+  801ed6:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ede:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ee3:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801eea:	00 00 00 
+  801eed:	ff d0                	call   *%rax
+}
+  801eef:	5d                   	pop    %rbp
+  801ef0:	c3                   	ret
+
+0000000000801ef1 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801ef1:	55                   	push   %rbp
+  801ef2:	48 89 e5             	mov    %rsp,%rbp
+  801ef5:	48 83 ec 20          	sub    $0x20,%rsp
+  801ef9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801efd:	be 00 00 00 00       	mov    $0x0,%esi
+  801f02:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f07:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801f0e:	00 00 00 
+  801f11:	ff d0                	call   *%rax
+  801f13:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f1a:	79 05                	jns    801f21 <fs_stats+0x30>
+    return r;
+  801f1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f1f:	eb 2a                	jmp    801f4b <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f25:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f2a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f31:	00 00 00 
+  801f34:	48 89 ce             	mov    %rcx,%rsi
+  801f37:	48 89 c7             	mov    %rax,%rdi
+  801f3a:	48 b8 43 46 80 00 00 	movabs $0x804643,%rax
+  801f41:	00 00 00 
+  801f44:	ff d0                	call   *%rax
+  return 0;
+  801f46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f4b:	c9                   	leave
+  801f4c:	c3                   	ret
+
+0000000000801f4d <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f4d:	55                   	push   %rbp
+  801f4e:	48 89 e5             	mov    %rsp,%rbp
+  801f51:	48 83 ec 10          	sub    $0x10,%rsp
+  801f55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f58:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f5f:	00 00 00 
+  801f62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f65:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f67:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f71:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+}
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+0000000000801f7f <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f7f:	55                   	push   %rbp
+  801f80:	48 89 e5             	mov    %rsp,%rbp
+  801f83:	48 83 ec 10          	sub    $0x10,%rsp
+  801f87:	89 f8                	mov    %edi,%eax
+  801f89:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f8c:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801f90:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f97:	00 00 00 
+  801f9a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801f9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fa6:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  801fad:	00 00 00 
+  801fb0:	ff d0                	call   *%rax
+}
+  801fb2:	c9                   	leave
+  801fb3:	c3                   	ret
+
+0000000000801fb4 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fb4:	55                   	push   %rbp
+  801fb5:	48 89 e5             	mov    %rsp,%rbp
+  801fb8:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc4:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fc9:	48 89 c7             	mov    %rax,%rdi
+  801fcc:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+0000000000801fda <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	48 83 ec 50          	sub    $0x50,%rsp
+  801fe2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801fe6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801fea:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ff1:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  801ff2:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  801ff7:	74 0a                	je     802003 <pipe_size+0x29>
+  801ff9:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802000:	00 
+  802001:	76 0a                	jbe    80200d <pipe_size+0x33>
+    return -E_INVAL;
+  802003:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802008:	e9 cc 02 00 00       	jmp    8022d9 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80200d:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802011:	48 89 c7             	mov    %rax,%rdi
+  802014:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+  802020:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802023:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802027:	0f 88 a8 02 00 00    	js     8022d5 <pipe_size+0x2fb>
+  80202d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802031:	ba 07 04 00 00       	mov    $0x407,%edx
+  802036:	48 89 c6             	mov    %rax,%rsi
+  802039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203e:	48 b8 a1 03 80 00 00 	movabs $0x8003a1,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+  80204a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80204d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802051:	0f 88 7e 02 00 00    	js     8022d5 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802057:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80205b:	48 89 c7             	mov    %rax,%rdi
+  80205e:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+  80206a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80206d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802071:	0f 88 43 02 00 00    	js     8022ba <pipe_size+0x2e0>
+  802077:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80207b:	ba 07 04 00 00       	mov    $0x407,%edx
+  802080:	48 89 c6             	mov    %rax,%rsi
+  802083:	bf 00 00 00 00       	mov    $0x0,%edi
+  802088:	48 b8 a1 03 80 00 00 	movabs $0x8003a1,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802097:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80209b:	0f 88 19 02 00 00    	js     8022ba <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a5:	48 89 c7             	mov    %rax,%rdi
+  8020a8:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+  8020b4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020b8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020bf:	00 
+  8020c0:	e9 a2 00 00 00       	jmp    802167 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020c9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020cd:	48 89 c2             	mov    %rax,%rdx
+  8020d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d4:	48 01 d0             	add    %rdx,%rax
+  8020d7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020dc:	48 89 c6             	mov    %rax,%rsi
+  8020df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e4:	48 b8 a1 03 80 00 00 	movabs $0x8003a1,%rax
+  8020eb:	00 00 00 
+  8020ee:	ff d0                	call   *%rax
+  8020f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020f7:	0f 88 37 01 00 00    	js     802234 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8020fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802101:	48 89 c7             	mov    %rax,%rdi
+  802104:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+  802110:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802114:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802118:	48 01 c2             	add    %rax,%rdx
+  80211b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80211f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802123:	48 89 c1             	mov    %rax,%rcx
+  802126:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80212a:	48 01 c8             	add    %rcx,%rax
+  80212d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  802133:	48 89 d1             	mov    %rdx,%rcx
+  802136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213b:	48 89 c6             	mov    %rax,%rsi
+  80213e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802143:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+  80214f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802152:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802156:	79 0a                	jns    802162 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802158:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80215d:	e9 d3 00 00 00       	jmp    802235 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  802162:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802167:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80216e:	00 
+  80216f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802173:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802177:	48 01 d0             	add    %rdx,%rax
+  80217a:	48 83 c0 1f          	add    $0x1f,%rax
+  80217e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802182:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802186:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218b:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80218f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802193:	48 29 d0             	sub    %rdx,%rax
+  802196:	48 c1 e8 0c          	shr    $0xc,%rax
+  80219a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80219e:	0f 82 21 ff ff ff    	jb     8020c5 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021b4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021bc:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021c3:	00 00 00 
+  8021c6:	8b 12                	mov    (%rdx),%edx
+  8021c8:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ce:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d9:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021e0:	00 00 00 
+  8021e3:	8b 12                	mov    (%rdx),%edx
+  8021e5:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021eb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8021f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f6:	48 89 c7             	mov    %rax,%rdi
+  8021f9:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+  802205:	89 c2                	mov    %eax,%edx
+  802207:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80220b:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80220d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802211:	48 89 c7             	mov    %rax,%rdi
+  802214:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802224:	48 83 c2 04          	add    $0x4,%rdx
+  802228:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222f:	e9 a5 00 00 00       	jmp    8022d9 <pipe_size+0x2ff>
+      goto err2;
+  802234:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802235:	eb 58                	jmp    80228f <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802237:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80223b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80223f:	48 89 c2             	mov    %rax,%rdx
+  802242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802246:	48 01 d0             	add    %rdx,%rax
+  802249:	48 89 c6             	mov    %rax,%rsi
+  80224c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802251:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  802258:	00 00 00 
+  80225b:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80225d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802261:	48 89 c7             	mov    %rax,%rdi
+  802264:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802274:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802278:	48 01 d0             	add    %rdx,%rax
+  80227b:	48 89 c6             	mov    %rax,%rsi
+  80227e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802283:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80228f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802293:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802297:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80229b:	48 85 c0             	test   %rax,%rax
+  80229e:	75 97                	jne    802237 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a4:	48 89 c6             	mov    %rax,%rsi
+  8022a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ac:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+  8022b8:	eb 01                	jmp    8022bb <pipe_size+0x2e1>
+    goto err1;
+  8022ba:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022bf:	48 89 c6             	mov    %rax,%rsi
+  8022c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c7:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+  8022d3:	eb 01                	jmp    8022d6 <pipe_size+0x2fc>
+    goto err;
+  8022d5:	90                   	nop
+err:
+  return r;
+  8022d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022d9:	c9                   	leave
+  8022da:	c3                   	ret
+
+00000000008022db <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022db:	55                   	push   %rbp
+  8022dc:	48 89 e5             	mov    %rsp,%rbp
+  8022df:	53                   	push   %rbx
+  8022e0:	48 83 ec 28          	sub    $0x28,%rsp
+  8022e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022ec:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022f3:	00 00 00 
+  8022f6:	8b 40 04             	mov    0x4(%rax),%eax
+  8022f9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022fe:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802305:	00 00 00 
+  802308:	48 98                	cltq
+  80230a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802311:	48 01 d0             	add    %rdx,%rax
+  802314:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80231a:	8b 00                	mov    (%rax),%eax
+  80231c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80231f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802323:	48 89 c7             	mov    %rax,%rdi
+  802326:	48 b8 b9 4e 80 00 00 	movabs $0x804eb9,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+  802332:	89 c3                	mov    %eax,%ebx
+  802334:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802338:	48 89 c7             	mov    %rax,%rdi
+  80233b:	48 b8 b9 4e 80 00 00 	movabs $0x804eb9,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	39 c3                	cmp    %eax,%ebx
+  802349:	0f 94 c0             	sete   %al
+  80234c:	0f b6 c0             	movzbl %al,%eax
+  80234f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  802352:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802359:	00 00 00 
+  80235c:	8b 40 04             	mov    0x4(%rax),%eax
+  80235f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802364:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80236b:	00 00 00 
+  80236e:	48 98                	cltq
+  802370:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802377:	48 01 d0             	add    %rdx,%rax
+  80237a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802380:	8b 00                	mov    (%rax),%eax
+  802382:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  802385:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802388:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80238b:	75 05                	jne    802392 <_pipeisclosed+0xb7>
+      return ret;
+  80238d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802390:	eb 68                	jmp    8023fa <_pipeisclosed+0x11f>
+    if (n != nn)
+  802392:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802395:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802398:	0f 84 4e ff ff ff    	je     8022ec <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80239e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023a5:	00 00 00 
+  8023a8:	8b 40 04             	mov    0x4(%rax),%eax
+  8023ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023b0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023b7:	00 00 00 
+  8023ba:	48 98                	cltq
+  8023bc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023c3:	48 01 d0             	add    %rdx,%rax
+  8023c6:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023cc:	8b 10                	mov    (%rax),%edx
+  8023ce:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023d4:	89 c6                	mov    %eax,%esi
+  8023d6:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023dd:	00 00 00 
+  8023e0:	48 89 c7             	mov    %rax,%rdi
+  8023e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e8:	49 b8 50 31 80 00 00 	movabs $0x803150,%r8
+  8023ef:	00 00 00 
+  8023f2:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8023f5:	e9 f2 fe ff ff       	jmp    8022ec <_pipeisclosed+0x11>
+  }
+}
+  8023fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023fe:	c9                   	leave
+  8023ff:	c3                   	ret
+
+0000000000802400 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802400:	55                   	push   %rbp
+  802401:	48 89 e5             	mov    %rsp,%rbp
+  802404:	48 83 ec 30          	sub    $0x30,%rsp
+  802408:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80240b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80240f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802412:	48 89 d6             	mov    %rdx,%rsi
+  802415:	89 c7                	mov    %eax,%edi
+  802417:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802426:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80242a:	79 05                	jns    802431 <pipeisclosed+0x31>
+    return r;
+  80242c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80242f:	eb 31                	jmp    802462 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  802431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802435:	48 89 c7             	mov    %rax,%rdi
+  802438:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+  802444:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802450:	48 89 d6             	mov    %rdx,%rsi
+  802453:	48 89 c7             	mov    %rax,%rdi
+  802456:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+}
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+
+0000000000802464 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  802464:	55                   	push   %rbp
+  802465:	48 89 e5             	mov    %rsp,%rbp
+  802468:	48 83 ec 10          	sub    $0x10,%rsp
+  80246c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  802470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802474:	8b 40 18             	mov    0x18(%rax),%eax
+  802477:	8d 50 01             	lea    0x1(%rax),%edx
+  80247a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247e:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  802481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802485:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	74 27                	je     8024b3 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80248c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802490:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  802497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249b:	48 83 c0 18          	add    $0x18,%rax
+  80249f:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024a4:	48 89 c7             	mov    %rax,%rdi
+  8024a7:	48 b8 9c 07 80 00 00 	movabs $0x80079c,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  }
+}
+  8024b3:	90                   	nop
+  8024b4:	c9                   	leave
+  8024b5:	c3                   	ret
+
+00000000008024b6 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024b6:	55                   	push   %rbp
+  8024b7:	48 89 e5             	mov    %rsp,%rbp
+  8024ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8024be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024c2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d4:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024db:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024e2:	89 c6                	mov    %eax,%esi
+  8024e4:	48 89 cf             	mov    %rcx,%rdi
+  8024e7:	48 b8 4d 07 80 00 00 	movabs $0x80074d,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+}
+  8024f3:	90                   	nop
+  8024f4:	c9                   	leave
+  8024f5:	c3                   	ret
+
+00000000008024f6 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024f6:	55                   	push   %rbp
+  8024f7:	48 89 e5             	mov    %rsp,%rbp
+  8024fa:	48 83 ec 70          	sub    $0x70,%rsp
+  8024fe:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802502:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802506:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80250a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80250e:	48 89 c7             	mov    %rax,%rdi
+  802511:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+  80251d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802521:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802526:	75 0a                	jne    802532 <devpipe_read+0x3c>
+    return 0;
+  802528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80252d:	e9 63 01 00 00       	jmp    802695 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  802532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802536:	8b 40 18             	mov    0x18(%rax),%eax
+  802539:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80253c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802540:	48 8b 10             	mov    (%rax),%rdx
+  802543:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802547:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80254b:	48 39 c2             	cmp    %rax,%rdx
+  80254e:	75 42                	jne    802592 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  802550:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802554:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802558:	48 89 d6             	mov    %rdx,%rsi
+  80255b:	48 89 c7             	mov    %rax,%rdi
+  80255e:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+  80256a:	85 c0                	test   %eax,%eax
+  80256c:	74 0a                	je     802578 <devpipe_read+0x82>
+      return 0;
+  80256e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802573:	e9 1d 01 00 00       	jmp    802695 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802578:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80257b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80257f:	89 d6                	mov    %edx,%esi
+  802581:	48 89 c7             	mov    %rax,%rdi
+  802584:	48 b8 b6 24 80 00 00 	movabs $0x8024b6,%rax
+  80258b:	00 00 00 
+  80258e:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  802590:	eb a0                	jmp    802532 <devpipe_read+0x3c>
+      break;
+  802592:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  802593:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802597:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80259b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80259f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025af:	48 8b 00             	mov    (%rax),%rax
+  8025b2:	48 29 c2             	sub    %rax,%rdx
+  8025b5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c1:	48 39 c2             	cmp    %rax,%rdx
+  8025c4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025c8:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025d0:	48 8b 00             	mov    (%rax),%rax
+  8025d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d7:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e0:	48 f7 f1             	div    %rcx
+  8025e3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025e7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025f3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025f7:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8025fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802603:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802607:	48 39 c2             	cmp    %rax,%rdx
+  80260a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80260e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802616:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80261a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80261e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  802622:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802626:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80262a:	48 89 ce             	mov    %rcx,%rsi
+  80262d:	48 89 c7             	mov    %rax,%rdi
+  802630:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80263c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802640:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802644:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802648:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80264c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802650:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802654:	48 01 d1             	add    %rdx,%rcx
+  802657:	48 89 c2             	mov    %rax,%rdx
+  80265a:	48 89 cf             	mov    %rcx,%rdi
+  80265d:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80266d:	48 8b 10             	mov    (%rax),%rdx
+  802670:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802674:	48 01 c2             	add    %rax,%rdx
+  802677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267b:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80267e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802682:	48 89 c7             	mov    %rax,%rdi
+  802685:	48 b8 64 24 80 00 00 	movabs $0x802464,%rax
+  80268c:	00 00 00 
+  80268f:	ff d0                	call   *%rax
+  return n;
+  802691:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+
+0000000000802697 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+  80269b:	48 83 ec 70          	sub    $0x70,%rsp
+  80269f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026a3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026a7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026af:	48 89 c7             	mov    %rax,%rdi
+  8026b2:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  8026b9:	00 00 00 
+  8026bc:	ff d0                	call   *%rax
+  8026be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026ca:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026d1:	00 
+  8026d2:	e9 b8 01 00 00       	jmp    80288f <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026db:	8b 40 18             	mov    0x18(%rax),%eax
+  8026de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ed:	48 8b 00             	mov    (%rax),%rax
+  8026f0:	48 29 c2             	sub    %rax,%rdx
+  8026f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026fb:	48 39 c2             	cmp    %rax,%rdx
+  8026fe:	75 4d                	jne    80274d <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802700:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802704:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802708:	48 89 d6             	mov    %rdx,%rsi
+  80270b:	48 89 c7             	mov    %rax,%rdi
+  80270e:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802715:	00 00 00 
+  802718:	ff d0                	call   *%rax
+  80271a:	85 c0                	test   %eax,%eax
+  80271c:	74 0a                	je     802728 <devpipe_write+0x91>
+        return 0;
+  80271e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802723:	e9 79 01 00 00       	jmp    8028a1 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802728:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80272b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80272f:	89 d6                	mov    %edx,%esi
+  802731:	48 89 c7             	mov    %rax,%rdi
+  802734:	48 b8 b6 24 80 00 00 	movabs $0x8024b6,%rax
+  80273b:	00 00 00 
+  80273e:	ff d0                	call   *%rax
+      m = 0;
+  802740:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802747:	00 
+      continue;
+  802748:	e9 3a 01 00 00       	jmp    802887 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80274d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802751:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802755:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802759:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80275d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802765:	48 8b 08             	mov    (%rax),%rcx
+  802768:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802770:	48 29 c1             	sub    %rax,%rcx
+  802773:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802777:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80277b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80277f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802783:	48 39 c2             	cmp    %rax,%rdx
+  802786:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80278a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80278e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802792:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802796:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80279a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80279e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a3:	48 f7 f1             	div    %rcx
+  8027a6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027ba:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027be:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027c6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027ca:	48 39 c2             	cmp    %rax,%rdx
+  8027cd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027d1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027d9:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027e1:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027e9:	48 01 d1             	add    %rdx,%rcx
+  8027ec:	48 89 c2             	mov    %rax,%rdx
+  8027ef:	48 89 cf             	mov    %rcx,%rdi
+  8027f2:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8027fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802802:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802806:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80280a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80280e:	73 4d                	jae    80285d <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802810:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802814:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802818:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80281c:	48 29 c2             	sub    %rax,%rdx
+  80281f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802823:	48 01 c2             	add    %rax,%rdx
+  802826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80282e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802832:	48 89 c1             	mov    %rax,%rcx
+  802835:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802839:	48 01 c1             	add    %rax,%rcx
+  80283c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802840:	48 01 c1             	add    %rax,%rcx
+  802843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802847:	48 83 c0 20          	add    $0x20,%rax
+  80284b:	48 89 ce             	mov    %rcx,%rsi
+  80284e:	48 89 c7             	mov    %rax,%rdi
+  802851:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80285d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802861:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802865:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802869:	48 01 c2             	add    %rax,%rdx
+  80286c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802870:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802874:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802878:	48 89 c7             	mov    %rax,%rdi
+  80287b:	48 b8 64 24 80 00 00 	movabs $0x802464,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80288b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80288f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802893:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802897:	0f 82 3a fe ff ff    	jb     8026d7 <devpipe_write+0x40>
+  }
+
+  return i;
+  80289d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+
+00000000008028a3 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028a3:	55                   	push   %rbp
+  8028a4:	48 89 e5             	mov    %rsp,%rbp
+  8028a7:	48 83 ec 40          	sub    $0x40,%rsp
+  8028ab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028af:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028ba:	48 89 c7             	mov    %rax,%rdi
+  8028bd:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+  8028c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d8:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028e0:	48 89 d6             	mov    %rdx,%rsi
+  8028e3:	48 89 c7             	mov    %rax,%rdi
+  8028e6:	48 b8 7e 15 80 00 00 	movabs $0x80157e,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028f9:	79 08                	jns    802903 <devpipe_poll+0x60>
+    return r;
+  8028fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028fe:	e9 85 00 00 00       	jmp    802988 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802903:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802906:	83 e0 01             	and    $0x1,%eax
+  802909:	85 c0                	test   %eax,%eax
+  80290b:	74 18                	je     802925 <devpipe_poll+0x82>
+  80290d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802911:	48 8b 10             	mov    (%rax),%rdx
+  802914:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802918:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80291c:	48 39 c2             	cmp    %rax,%rdx
+  80291f:	74 04                	je     802925 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802921:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802925:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802928:	83 e0 02             	and    $0x2,%eax
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	74 23                	je     802952 <devpipe_poll+0xaf>
+  80292f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802933:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80293b:	48 8b 00             	mov    (%rax),%rax
+  80293e:	48 29 c2             	sub    %rax,%rdx
+  802941:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802945:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802949:	48 39 c2             	cmp    %rax,%rdx
+  80294c:	73 04                	jae    802952 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80294e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  802952:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802956:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80295a:	48 89 d6             	mov    %rdx,%rsi
+  80295d:	48 89 c7             	mov    %rax,%rdi
+  802960:	48 b8 db 22 80 00 00 	movabs $0x8022db,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	74 04                	je     802974 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  802970:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802974:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802978:	75 0b                	jne    802985 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80297a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80297e:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802985:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802988:	c9                   	leave
+  802989:	c3                   	ret
+
+000000000080298a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80298a:	55                   	push   %rbp
+  80298b:	48 89 e5             	mov    %rsp,%rbp
+  80298e:	48 83 ec 20          	sub    $0x20,%rsp
+  802992:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802996:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80299a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299e:	48 89 c7             	mov    %rax,%rdi
+  8029a1:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+  8029ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029b5:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029bc:	00 00 00 
+  8029bf:	48 89 d6             	mov    %rdx,%rsi
+  8029c2:	48 89 c7             	mov    %rax,%rdi
+  8029c5:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  8029cc:	00 00 00 
+  8029cf:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029d9:	89 c1                	mov    %eax,%ecx
+  8029db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029df:	48 8b 00             	mov    (%rax),%rax
+  8029e2:	89 c2                	mov    %eax,%edx
+  8029e4:	89 c8                	mov    %ecx,%eax
+  8029e6:	29 d0                	sub    %edx,%eax
+  8029e8:	89 c2                	mov    %eax,%edx
+  8029ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ee:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8029f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8029ff:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a06:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a0d:	00 00 00 
+  802a10:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a1c:	c9                   	leave
+  802a1d:	c3                   	ret
+
+0000000000802a1e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a1e:	55                   	push   %rbp
+  802a1f:	48 89 e5             	mov    %rsp,%rbp
+  802a22:	48 83 ec 40          	sub    $0x40,%rsp
+  802a26:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a2e:	48 89 c7             	mov    %rax,%rdi
+  802a31:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  802a38:	00 00 00 
+  802a3b:	ff d0                	call   *%rax
+  802a3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a41:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a48:	00 
+  802a49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a4d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a55:	48 01 d0             	add    %rdx,%rax
+  802a58:	48 83 c0 1f          	add    $0x1f,%rax
+  802a5c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a69:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a71:	48 29 d0             	sub    %rdx,%rax
+  802a74:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a78:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a80:	48 89 c6             	mov    %rax,%rsi
+  802a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a88:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a98:	48 89 c7             	mov    %rax,%rdi
+  802a9b:	48 b8 64 24 80 00 00 	movabs $0x802464,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802aa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802aaf:	eb 2f                	jmp    802ae0 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802ab1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab5:	48 83 e8 01          	sub    $0x1,%rax
+  802ab9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802abd:	48 89 c2             	mov    %rax,%rdx
+  802ac0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac4:	48 01 d0             	add    %rdx,%rax
+  802ac7:	48 89 c6             	mov    %rax,%rsi
+  802aca:	bf 00 00 00 00       	mov    $0x0,%edi
+  802acf:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802adb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802ae0:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802ae5:	77 ca                	ja     802ab1 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802ae7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aeb:	48 89 c6             	mov    %rax,%rsi
+  802aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af3:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+}
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+
+0000000000802b01 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+  802b05:	48 83 ec 08          	sub    $0x8,%rsp
+  802b09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b0c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b10:	75 10                	jne    802b22 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b12:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b19:	00 00 00 
+  802b1c:	8b 00                	mov    (%rax),%eax
+  802b1e:	48 98                	cltq
+  802b20:	eb 05                	jmp    802b27 <vsyscall+0x26>
+  }
+  return 0;
+  802b22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b27:	c9                   	leave
+  802b28:	c3                   	ret
+
+0000000000802b29 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b29:	55                   	push   %rbp
+  802b2a:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b32:	48 b8 01 2b 80 00 00 	movabs $0x802b01,%rax
+  802b39:	00 00 00 
+  802b3c:	ff d0                	call   *%rax
+}
+  802b3e:	5d                   	pop    %rbp
+  802b3f:	c3                   	ret
+
+0000000000802b40 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b40:	55                   	push   %rbp
+  802b41:	48 89 e5             	mov    %rsp,%rbp
+  802b44:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b48:	0f 31                	rdtsc
+  802b4a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b4d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b53:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b56:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b5a:	48 09 d0             	or     %rdx,%rax
+  802b5d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b69:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b70:	00 00 00 
+  802b73:	8b 40 08             	mov    0x8(%rax),%eax
+  802b76:	48 98                	cltq
+  802b78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b85:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b89:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b99:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b9d:	48 89 d0             	mov    %rdx,%rax
+  802ba0:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bac:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bb0:	48 01 c8             	add    %rcx,%rax
+}
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+0000000000802bb5 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bb5:	55                   	push   %rbp
+  802bb6:	48 89 e5             	mov    %rsp,%rbp
+  802bb9:	48 83 ec 20          	sub    $0x20,%rsp
+  802bbd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bc3:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bc6:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bca:	be 01 00 00 00       	mov    $0x1,%esi
+  802bcf:	48 89 c7             	mov    %rax,%rdi
+  802bd2:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+}
+  802bde:	90                   	nop
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+0000000000802be1 <getchar>:
+
+int
+getchar(void) {
+  802be1:	55                   	push   %rbp
+  802be2:	48 89 e5             	mov    %rsp,%rbp
+  802be5:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802be9:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802bed:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bf2:	48 89 c6             	mov    %rax,%rsi
+  802bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfa:	48 b8 14 11 80 00 00 	movabs $0x801114,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+  802c06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c09:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c0d:	79 05                	jns    802c14 <getchar+0x33>
+    return r;
+  802c0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c12:	eb 14                	jmp    802c28 <getchar+0x47>
+  if (r < 1)
+  802c14:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c18:	7f 07                	jg     802c21 <getchar+0x40>
+    return -E_EOF;
+  802c1a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c1f:	eb 07                	jmp    802c28 <getchar+0x47>
+  return c;
+  802c21:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c25:	0f b6 c0             	movzbl %al,%eax
+}
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+
+0000000000802c2a <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c2a:	55                   	push   %rbp
+  802c2b:	48 89 e5             	mov    %rsp,%rbp
+  802c2e:	48 83 ec 20          	sub    $0x20,%rsp
+  802c32:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c35:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c3c:	48 89 d6             	mov    %rdx,%rsi
+  802c3f:	89 c7                	mov    %eax,%edi
+  802c41:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  802c48:	00 00 00 
+  802c4b:	ff d0                	call   *%rax
+  802c4d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c50:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c54:	79 05                	jns    802c5b <iscons+0x31>
+    return r;
+  802c56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c59:	eb 1a                	jmp    802c75 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5f:	8b 10                	mov    (%rax),%edx
+  802c61:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c68:	00 00 00 
+  802c6b:	8b 00                	mov    (%rax),%eax
+  802c6d:	39 c2                	cmp    %eax,%edx
+  802c6f:	0f 94 c0             	sete   %al
+  802c72:	0f b6 c0             	movzbl %al,%eax
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+
+0000000000802c77 <opencons>:
+
+int
+opencons(void) {
+  802c77:	55                   	push   %rbp
+  802c78:	48 89 e5             	mov    %rsp,%rbp
+  802c7b:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c7f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c83:	48 89 c7             	mov    %rax,%rdi
+  802c86:	48 b8 d6 0a 80 00 00 	movabs $0x800ad6,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+  802c92:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c99:	79 05                	jns    802ca0 <opencons+0x29>
+    return r;
+  802c9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9e:	eb 66                	jmp    802d06 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802ca0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca4:	ba 07 04 00 00       	mov    $0x407,%edx
+  802ca9:	48 89 c6             	mov    %rax,%rsi
+  802cac:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb1:	48 b8 a1 03 80 00 00 	movabs $0x8003a1,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+  802cbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cc4:	79 05                	jns    802ccb <opencons+0x54>
+    return r;
+  802cc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc9:	eb 3b                	jmp    802d06 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ccf:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cd6:	00 00 00 
+  802cd9:	8b 12                	mov    (%rdx),%edx
+  802cdb:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802ce8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cec:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802cf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf7:	48 89 c7             	mov    %rax,%rdi
+  802cfa:	48 b8 88 0a 80 00 00 	movabs $0x800a88,%rax
+  802d01:	00 00 00 
+  802d04:	ff d0                	call   *%rax
+}
+  802d06:	c9                   	leave
+  802d07:	c3                   	ret
+
+0000000000802d08 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d08:	55                   	push   %rbp
+  802d09:	48 89 e5             	mov    %rsp,%rbp
+  802d0c:	48 83 ec 20          	sub    $0x20,%rsp
+  802d10:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d13:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d16:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d1d:	48 89 d6             	mov    %rdx,%rsi
+  802d20:	89 c7                	mov    %eax,%edi
+  802d22:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d35:	79 05                	jns    802d3c <consmode+0x34>
+    return r;
+  802d37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d3a:	eb 34                	jmp    802d70 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d40:	8b 10                	mov    (%rax),%edx
+  802d42:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d49:	00 00 00 
+  802d4c:	8b 00                	mov    (%rax),%eax
+  802d4e:	39 c2                	cmp    %eax,%edx
+  802d50:	74 07                	je     802d59 <consmode+0x51>
+    return -E_INVAL;
+  802d52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d57:	eb 17                	jmp    802d70 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d5d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d67:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d6a:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d70:	c9                   	leave
+  802d71:	c3                   	ret
+
+0000000000802d72 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	48 83 ec 20          	sub    $0x20,%rsp
+  802d7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d82:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d8a:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d8d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d95:	48 89 ce             	mov    %rcx,%rsi
+  802d98:	48 89 c7             	mov    %rax,%rdi
+  802d9b:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  802da2:	00 00 00 
+  802da5:	ff d0                	call   *%rax
+  802da7:	48 98                	cltq
+}
+  802da9:	c9                   	leave
+  802daa:	c3                   	ret
+
+0000000000802dab <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dab:	55                   	push   %rbp
+  802dac:	48 89 e5             	mov    %rsp,%rbp
+  802daf:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802db6:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dbd:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dc4:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802dcb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dd2:	eb 74                	jmp    802e48 <devcons_write+0x9d>
+    m = n - tot;
+  802dd4:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802ddb:	89 c2                	mov    %eax,%edx
+  802ddd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802de0:	29 c2                	sub    %eax,%edx
+  802de2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802de5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802de8:	83 f8 7f             	cmp    $0x7f,%eax
+  802deb:	76 07                	jbe    802df4 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802ded:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802df4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802df7:	48 63 d0             	movslq %eax,%rdx
+  802dfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dfd:	48 63 c8             	movslq %eax,%rcx
+  802e00:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e07:	48 01 c1             	add    %rax,%rcx
+  802e0a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e11:	48 89 ce             	mov    %rcx,%rsi
+  802e14:	48 89 c7             	mov    %rax,%rdi
+  802e17:	48 b8 43 46 80 00 00 	movabs $0x804643,%rax
+  802e1e:	00 00 00 
+  802e21:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e23:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e26:	48 63 d0             	movslq %eax,%rdx
+  802e29:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e30:	48 89 d6             	mov    %rdx,%rsi
+  802e33:	48 89 c7             	mov    %rax,%rdi
+  802e36:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e42:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e45:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e4b:	48 98                	cltq
+  802e4d:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e54:	0f 82 7a ff ff ff    	jb     802dd4 <devcons_write+0x29>
+  }
+  return tot;
+  802e5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e5d:	48 98                	cltq
+}
+  802e5f:	c9                   	leave
+  802e60:	c3                   	ret
+
+0000000000802e61 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e61:	55                   	push   %rbp
+  802e62:	48 89 e5             	mov    %rsp,%rbp
+  802e65:	48 83 ec 08          	sub    $0x8,%rsp
+  802e69:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e72:	c9                   	leave
+  802e73:	c3                   	ret
+
+0000000000802e74 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e74:	55                   	push   %rbp
+  802e75:	48 89 e5             	mov    %rsp,%rbp
+  802e78:	48 83 ec 10          	sub    $0x10,%rsp
+  802e7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e80:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e88:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e8f:	00 00 00 
+  802e92:	48 89 d6             	mov    %rdx,%rsi
+  802e95:	48 89 c7             	mov    %rax,%rdi
+  802e98:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  802e9f:	00 00 00 
+  802ea2:	ff d0                	call   *%rax
+  return 0;
+  802ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ea9:	c9                   	leave
+  802eaa:	c3                   	ret
+
+0000000000802eab <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802eab:	55                   	push   %rbp
+  802eac:	48 89 e5             	mov    %rsp,%rbp
+  802eaf:	48 83 ec 30          	sub    $0x30,%rsp
+  802eb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eb7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802eba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ebe:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ec5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ec8:	83 e0 02             	and    $0x2,%eax
+  802ecb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ece:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ed5:	83 f8 01             	cmp    $0x1,%eax
+  802ed8:	75 04                	jne    802ede <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802eda:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ede:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ee1:	83 e0 01             	and    $0x1,%eax
+  802ee4:	85 c0                	test   %eax,%eax
+  802ee6:	74 44                	je     802f2c <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802ee8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ef0:	89 c2                	mov    %eax,%edx
+  802ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efc:	48 b8 e9 07 80 00 00 	movabs $0x8007e9,%rax
+  802f03:	00 00 00 
+  802f06:	ff d0                	call   *%rax
+  802f08:	83 f8 01             	cmp    $0x1,%eax
+  802f0b:	75 06                	jne    802f13 <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f0d:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f11:	eb 19                	jmp    802f2c <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f17:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f1d:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f20:	89 c2                	mov    %eax,%edx
+  802f22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f26:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f2f:	c9                   	leave
+  802f30:	c3                   	ret
+
+0000000000802f31 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f31:	55                   	push   %rbp
+  802f32:	48 89 e5             	mov    %rsp,%rbp
+  802f35:	53                   	push   %rbx
+  802f36:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f3d:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f44:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f4a:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f51:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f58:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f5f:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f66:	84 c0                	test   %al,%al
+  802f68:	74 23                	je     802f8d <_panic+0x5c>
+  802f6a:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f71:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f75:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f79:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f7d:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f81:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f85:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f89:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f8d:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802f94:	00 00 00 
+  802f97:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802f9e:	00 00 00 
+  802fa1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fa5:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fac:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fb3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fba:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fc1:	00 00 00 
+  802fc4:	48 8b 18             	mov    (%rax),%rbx
+  802fc7:	48 b8 28 03 80 00 00 	movabs $0x800328,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+  802fd3:	89 c6                	mov    %eax,%esi
+  802fd5:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802fdb:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802fe2:	41 89 d0             	mov    %edx,%r8d
+  802fe5:	48 89 c1             	mov    %rax,%rcx
+  802fe8:	48 89 da             	mov    %rbx,%rdx
+  802feb:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  802ff2:	00 00 00 
+  802ff5:	48 89 c7             	mov    %rax,%rdi
+  802ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffd:	49 b9 50 31 80 00 00 	movabs $0x803150,%r9
+  803004:	00 00 00 
+  803007:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80300a:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803011:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803018:	48 89 d6             	mov    %rdx,%rsi
+  80301b:	48 89 c7             	mov    %rax,%rdi
+  80301e:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  803025:	00 00 00 
+  803028:	ff d0                	call   *%rax
+  cprintf("\n");
+  80302a:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  803031:	00 00 00 
+  803034:	48 89 c7             	mov    %rax,%rdi
+  803037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303c:	48 ba 50 31 80 00 00 	movabs $0x803150,%rdx
+  803043:	00 00 00 
+  803046:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803048:	cc                   	int3
+  803049:	eb fd                	jmp    803048 <_panic+0x117>
+
+000000000080304b <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80304b:	55                   	push   %rbp
+  80304c:	48 89 e5             	mov    %rsp,%rbp
+  80304f:	48 83 ec 10          	sub    $0x10,%rsp
+  803053:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803056:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80305a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80305e:	8b 00                	mov    (%rax),%eax
+  803060:	8d 48 01             	lea    0x1(%rax),%ecx
+  803063:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803067:	89 0a                	mov    %ecx,(%rdx)
+  803069:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80306c:	89 d1                	mov    %edx,%ecx
+  80306e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803072:	48 98                	cltq
+  803074:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803078:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80307c:	8b 00                	mov    (%rax),%eax
+  80307e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803083:	75 2c                	jne    8030b1 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  803085:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803089:	8b 00                	mov    (%rax),%eax
+  80308b:	48 98                	cltq
+  80308d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803091:	48 83 c2 08          	add    $0x8,%rdx
+  803095:	48 89 c6             	mov    %rax,%rsi
+  803098:	48 89 d7             	mov    %rdx,%rdi
+  80309b:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ab:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b5:	8b 40 04             	mov    0x4(%rax),%eax
+  8030b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8030bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bf:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030c2:	90                   	nop
+  8030c3:	c9                   	leave
+  8030c4:	c3                   	ret
+
+00000000008030c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030c5:	55                   	push   %rbp
+  8030c6:	48 89 e5             	mov    %rsp,%rbp
+  8030c9:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030d0:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030d7:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030e5:	00 00 00 
+  b.cnt = 0;
+  8030e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030ef:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8030f2:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8030f9:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803100:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803107:	48 89 c6             	mov    %rax,%rsi
+  80310a:	48 b8 4b 30 80 00 00 	movabs $0x80304b,%rax
+  803111:	00 00 00 
+  803114:	48 89 c7             	mov    %rax,%rdi
+  803117:	48 b8 aa 34 80 00 00 	movabs $0x8034aa,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  803123:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803129:	48 98                	cltq
+  80312b:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  803132:	48 83 c2 08          	add    $0x8,%rdx
+  803136:	48 89 c6             	mov    %rax,%rsi
+  803139:	48 89 d7             	mov    %rdx,%rdi
+  80313c:	48 b8 8a 01 80 00 00 	movabs $0x80018a,%rax
+  803143:	00 00 00 
+  803146:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803148:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80314e:	c9                   	leave
+  80314f:	c3                   	ret
+
+0000000000803150 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803150:	55                   	push   %rbp
+  803151:	48 89 e5             	mov    %rsp,%rbp
+  803154:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80315b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803162:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803169:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803170:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803177:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80317e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803185:	84 c0                	test   %al,%al
+  803187:	74 20                	je     8031a9 <cprintf+0x59>
+  803189:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80318d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803191:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803195:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803199:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80319d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031a1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031a5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031a9:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031b0:	00 00 00 
+  8031b3:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031ba:	00 00 00 
+  8031bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031c1:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031c8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031cf:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031d6:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031dd:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031e4:	48 89 d6             	mov    %rdx,%rsi
+  8031e7:	48 89 c7             	mov    %rax,%rdi
+  8031ea:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8031f1:	00 00 00 
+  8031f4:	ff d0                	call   *%rax
+  8031f6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8031fc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+
+0000000000803204 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+  803208:	48 83 ec 30          	sub    $0x30,%rsp
+  80320c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803210:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803214:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803218:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80321b:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80321f:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  803223:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803226:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80322a:	72 54                	jb     803280 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80322c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80322f:	8d 78 ff             	lea    -0x1(%rax),%edi
+  803232:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803239:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323e:	48 f7 f6             	div    %rsi
+  803241:	49 89 c2             	mov    %rax,%r10
+  803244:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803247:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80324a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80324e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803252:	41 89 c9             	mov    %ecx,%r9d
+  803255:	41 89 f8             	mov    %edi,%r8d
+  803258:	89 d1                	mov    %edx,%ecx
+  80325a:	4c 89 d2             	mov    %r10,%rdx
+  80325d:	48 89 c7             	mov    %rax,%rdi
+  803260:	48 b8 04 32 80 00 00 	movabs $0x803204,%rax
+  803267:	00 00 00 
+  80326a:	ff d0                	call   *%rax
+  80326c:	eb 1c                	jmp    80328a <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80326e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803272:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803275:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803279:	48 89 d6             	mov    %rdx,%rsi
+  80327c:	89 c7                	mov    %eax,%edi
+  80327e:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803280:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  803284:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803288:	7f e4                	jg     80326e <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80328a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80328d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803291:	ba 00 00 00 00       	mov    $0x0,%edx
+  803296:	48 f7 f1             	div    %rcx
+  803299:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  8032a0:	00 00 00 
+  8032a3:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032a7:	0f be c0             	movsbl %al,%eax
+  8032aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ae:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032b2:	48 89 d6             	mov    %rdx,%rsi
+  8032b5:	89 c7                	mov    %eax,%edi
+  8032b7:	ff d1                	call   *%rcx
+}
+  8032b9:	90                   	nop
+  8032ba:	c9                   	leave
+  8032bb:	c3                   	ret
+
+00000000008032bc <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032bc:	55                   	push   %rbp
+  8032bd:	48 89 e5             	mov    %rsp,%rbp
+  8032c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8032c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032c8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032cb:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032cf:	7e 4b                	jle    80331c <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d5:	8b 00                	mov    (%rax),%eax
+  8032d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8032da:	77 24                	ja     803300 <getuint+0x44>
+  8032dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e8:	8b 00                	mov    (%rax),%eax
+  8032ea:	89 c0                	mov    %eax,%eax
+  8032ec:	48 01 d0             	add    %rdx,%rax
+  8032ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f3:	8b 12                	mov    (%rdx),%edx
+  8032f5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8032f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032fc:	89 0a                	mov    %ecx,(%rdx)
+  8032fe:	eb 14                	jmp    803314 <getuint+0x58>
+  803300:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803304:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803308:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80330c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803310:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803314:	48 8b 00             	mov    (%rax),%rax
+  803317:	e9 95 00 00 00       	jmp    8033b1 <getuint+0xf5>
+  else if (lflag)
+  80331c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803320:	74 48                	je     80336a <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  803322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803326:	8b 00                	mov    (%rax),%eax
+  803328:	83 f8 2f             	cmp    $0x2f,%eax
+  80332b:	77 24                	ja     803351 <getuint+0x95>
+  80332d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803331:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803335:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803339:	8b 00                	mov    (%rax),%eax
+  80333b:	89 c0                	mov    %eax,%eax
+  80333d:	48 01 d0             	add    %rdx,%rax
+  803340:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803344:	8b 12                	mov    (%rdx),%edx
+  803346:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803349:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80334d:	89 0a                	mov    %ecx,(%rdx)
+  80334f:	eb 14                	jmp    803365 <getuint+0xa9>
+  803351:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803355:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803359:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80335d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803361:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803365:	48 8b 00             	mov    (%rax),%rax
+  803368:	eb 47                	jmp    8033b1 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80336a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336e:	8b 00                	mov    (%rax),%eax
+  803370:	83 f8 2f             	cmp    $0x2f,%eax
+  803373:	77 24                	ja     803399 <getuint+0xdd>
+  803375:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803379:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80337d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803381:	8b 00                	mov    (%rax),%eax
+  803383:	89 c0                	mov    %eax,%eax
+  803385:	48 01 d0             	add    %rdx,%rax
+  803388:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80338c:	8b 12                	mov    (%rdx),%edx
+  80338e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803391:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803395:	89 0a                	mov    %ecx,(%rdx)
+  803397:	eb 14                	jmp    8033ad <getuint+0xf1>
+  803399:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033a1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033ad:	8b 00                	mov    (%rax),%eax
+  8033af:	89 c0                	mov    %eax,%eax
+}
+  8033b1:	c9                   	leave
+  8033b2:	c3                   	ret
+
+00000000008033b3 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033b3:	55                   	push   %rbp
+  8033b4:	48 89 e5             	mov    %rsp,%rbp
+  8033b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8033bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033bf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033c2:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033c6:	7e 4b                	jle    803413 <getint+0x60>
+    return va_arg(*ap, long long);
+  8033c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033cc:	8b 00                	mov    (%rax),%eax
+  8033ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d1:	77 24                	ja     8033f7 <getint+0x44>
+  8033d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033df:	8b 00                	mov    (%rax),%eax
+  8033e1:	89 c0                	mov    %eax,%eax
+  8033e3:	48 01 d0             	add    %rdx,%rax
+  8033e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ea:	8b 12                	mov    (%rdx),%edx
+  8033ec:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033f3:	89 0a                	mov    %ecx,(%rdx)
+  8033f5:	eb 14                	jmp    80340b <getint+0x58>
+  8033f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033ff:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803403:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803407:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80340b:	48 8b 00             	mov    (%rax),%rax
+  80340e:	e9 95 00 00 00       	jmp    8034a8 <getint+0xf5>
+  else if (lflag)
+  803413:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803417:	74 48                	je     803461 <getint+0xae>
+    return va_arg(*ap, long);
+  803419:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80341d:	8b 00                	mov    (%rax),%eax
+  80341f:	83 f8 2f             	cmp    $0x2f,%eax
+  803422:	77 24                	ja     803448 <getint+0x95>
+  803424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803428:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80342c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803430:	8b 00                	mov    (%rax),%eax
+  803432:	89 c0                	mov    %eax,%eax
+  803434:	48 01 d0             	add    %rdx,%rax
+  803437:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80343b:	8b 12                	mov    (%rdx),%edx
+  80343d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803440:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803444:	89 0a                	mov    %ecx,(%rdx)
+  803446:	eb 14                	jmp    80345c <getint+0xa9>
+  803448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803450:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803454:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803458:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80345c:	48 8b 00             	mov    (%rax),%rax
+  80345f:	eb 47                	jmp    8034a8 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  803461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803465:	8b 00                	mov    (%rax),%eax
+  803467:	83 f8 2f             	cmp    $0x2f,%eax
+  80346a:	77 24                	ja     803490 <getint+0xdd>
+  80346c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803470:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803478:	8b 00                	mov    (%rax),%eax
+  80347a:	89 c0                	mov    %eax,%eax
+  80347c:	48 01 d0             	add    %rdx,%rax
+  80347f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803483:	8b 12                	mov    (%rdx),%edx
+  803485:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803488:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80348c:	89 0a                	mov    %ecx,(%rdx)
+  80348e:	eb 14                	jmp    8034a4 <getint+0xf1>
+  803490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803494:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803498:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80349c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034a0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034a4:	8b 00                	mov    (%rax),%eax
+  8034a6:	48 98                	cltq
+}
+  8034a8:	c9                   	leave
+  8034a9:	c3                   	ret
+
+00000000008034aa <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034aa:	55                   	push   %rbp
+  8034ab:	48 89 e5             	mov    %rsp,%rbp
+  8034ae:	41 54                	push   %r12
+  8034b0:	53                   	push   %rbx
+  8034b1:	48 83 ec 60          	sub    $0x60,%rsp
+  8034b5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034b9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034bd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034c1:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034c5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034c9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034cd:	48 8b 06             	mov    (%rsi),%rax
+  8034d0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034d4:	48 89 01             	mov    %rax,(%rcx)
+  8034d7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034db:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034df:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034e3:	eb 17                	jmp    8034fc <vprintfmt+0x52>
+      if (ch == '\0')
+  8034e5:	85 db                	test   %ebx,%ebx
+  8034e7:	0f 84 bf 04 00 00    	je     8039ac <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034f1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8034f5:	48 89 c6             	mov    %rax,%rsi
+  8034f8:	89 df                	mov    %ebx,%edi
+  8034fa:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034fc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803500:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803504:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803508:	0f b6 00             	movzbl (%rax),%eax
+  80350b:	0f b6 d8             	movzbl %al,%ebx
+  80350e:	83 fb 25             	cmp    $0x25,%ebx
+  803511:	75 d2                	jne    8034e5 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803513:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803517:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80351e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803525:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80352c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  803533:	eb 04                	jmp    803539 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803535:	90                   	nop
+  803536:	eb 01                	jmp    803539 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803538:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803539:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80353d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803541:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803545:	0f b6 00             	movzbl (%rax),%eax
+  803548:	0f b6 d8             	movzbl %al,%ebx
+  80354b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80354e:	83 f8 55             	cmp    $0x55,%eax
+  803551:	0f 87 22 04 00 00    	ja     803979 <vprintfmt+0x4cf>
+  803557:	89 c0                	mov    %eax,%eax
+  803559:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803560:	00 
+  803561:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  803568:	00 00 00 
+  80356b:	48 01 d0             	add    %rdx,%rax
+  80356e:	48 8b 00             	mov    (%rax),%rax
+  803571:	ff e0                	jmp    *%rax
+        padc = '-';
+  803573:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803577:	eb c0                	jmp    803539 <vprintfmt+0x8f>
+        padc = '0';
+  803579:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80357d:	eb ba                	jmp    803539 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80357f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  803586:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803589:	89 d0                	mov    %edx,%eax
+  80358b:	c1 e0 02             	shl    $0x2,%eax
+  80358e:	01 d0                	add    %edx,%eax
+  803590:	01 c0                	add    %eax,%eax
+  803592:	01 d8                	add    %ebx,%eax
+  803594:	83 e8 30             	sub    $0x30,%eax
+  803597:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80359a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80359e:	0f b6 00             	movzbl (%rax),%eax
+  8035a1:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035a4:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035a7:	7e 60                	jle    803609 <vprintfmt+0x15f>
+  8035a9:	83 fb 39             	cmp    $0x39,%ebx
+  8035ac:	7f 5b                	jg     803609 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035ae:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035b3:	eb d1                	jmp    803586 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035bb:	77 17                	ja     8035d4 <vprintfmt+0x12a>
+  8035bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035c1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035c4:	89 d2                	mov    %edx,%edx
+  8035c6:	48 01 d0             	add    %rdx,%rax
+  8035c9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035cc:	83 c2 08             	add    $0x8,%edx
+  8035cf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035d2:	eb 0c                	jmp    8035e0 <vprintfmt+0x136>
+  8035d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035d8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035dc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035e0:	8b 00                	mov    (%rax),%eax
+  8035e2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035e5:	eb 23                	jmp    80360a <vprintfmt+0x160>
+        if (width < 0)
+  8035e7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035eb:	0f 89 44 ff ff ff    	jns    803535 <vprintfmt+0x8b>
+          width = 0;
+  8035f1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8035f8:	e9 38 ff ff ff       	jmp    803535 <vprintfmt+0x8b>
+        altflag = 1;
+  8035fd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803604:	e9 30 ff ff ff       	jmp    803539 <vprintfmt+0x8f>
+        goto process_precision;
+  803609:	90                   	nop
+        if (width < 0)
+  80360a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80360e:	0f 89 24 ff ff ff    	jns    803538 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803614:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803617:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80361a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803621:	e9 12 ff ff ff       	jmp    803538 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803626:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80362a:	e9 0a ff ff ff       	jmp    803539 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80362f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803632:	83 f8 2f             	cmp    $0x2f,%eax
+  803635:	77 17                	ja     80364e <vprintfmt+0x1a4>
+  803637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80363b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80363e:	89 d2                	mov    %edx,%edx
+  803640:	48 01 d0             	add    %rdx,%rax
+  803643:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803646:	83 c2 08             	add    $0x8,%edx
+  803649:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80364c:	eb 0c                	jmp    80365a <vprintfmt+0x1b0>
+  80364e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803652:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803656:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80365a:	8b 00                	mov    (%rax),%eax
+  80365c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803660:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803664:	48 89 d6             	mov    %rdx,%rsi
+  803667:	89 c7                	mov    %eax,%edi
+  803669:	ff d1                	call   *%rcx
+        break;
+  80366b:	e9 37 03 00 00       	jmp    8039a7 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  803670:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803673:	83 f8 2f             	cmp    $0x2f,%eax
+  803676:	77 17                	ja     80368f <vprintfmt+0x1e5>
+  803678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80367c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80367f:	89 d2                	mov    %edx,%edx
+  803681:	48 01 d0             	add    %rdx,%rax
+  803684:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803687:	83 c2 08             	add    $0x8,%edx
+  80368a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80368d:	eb 0c                	jmp    80369b <vprintfmt+0x1f1>
+  80368f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803693:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803697:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80369b:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80369d:	85 db                	test   %ebx,%ebx
+  80369f:	79 02                	jns    8036a3 <vprintfmt+0x1f9>
+          err = -err;
+  8036a1:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036a3:	83 fb 15             	cmp    $0x15,%ebx
+  8036a6:	7f 16                	jg     8036be <vprintfmt+0x214>
+  8036a8:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036af:	00 00 00 
+  8036b2:	48 63 c3             	movslq %ebx,%rax
+  8036b5:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036b9:	4d 85 e4             	test   %r12,%r12
+  8036bc:	75 2e                	jne    8036ec <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036be:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036c6:	89 d9                	mov    %ebx,%ecx
+  8036c8:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036cf:	00 00 00 
+  8036d2:	48 89 c7             	mov    %rax,%rdi
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	49 b8 b6 39 80 00 00 	movabs $0x8039b6,%r8
+  8036e1:	00 00 00 
+  8036e4:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036e7:	e9 bb 02 00 00       	jmp    8039a7 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036ec:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036f0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036f4:	4c 89 e1             	mov    %r12,%rcx
+  8036f7:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  8036fe:	00 00 00 
+  803701:	48 89 c7             	mov    %rax,%rdi
+  803704:	b8 00 00 00 00       	mov    $0x0,%eax
+  803709:	49 b8 b6 39 80 00 00 	movabs $0x8039b6,%r8
+  803710:	00 00 00 
+  803713:	41 ff d0             	call   *%r8
+        break;
+  803716:	e9 8c 02 00 00       	jmp    8039a7 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80371b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80371e:	83 f8 2f             	cmp    $0x2f,%eax
+  803721:	77 17                	ja     80373a <vprintfmt+0x290>
+  803723:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803727:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80372a:	89 d2                	mov    %edx,%edx
+  80372c:	48 01 d0             	add    %rdx,%rax
+  80372f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803732:	83 c2 08             	add    $0x8,%edx
+  803735:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803738:	eb 0c                	jmp    803746 <vprintfmt+0x29c>
+  80373a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80373e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803742:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803746:	4c 8b 20             	mov    (%rax),%r12
+  803749:	4d 85 e4             	test   %r12,%r12
+  80374c:	75 0a                	jne    803758 <vprintfmt+0x2ae>
+          p = "(null)";
+  80374e:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  803755:	00 00 00 
+        if (width > 0 && padc != '-')
+  803758:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80375c:	7e 78                	jle    8037d6 <vprintfmt+0x32c>
+  80375e:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  803762:	74 72                	je     8037d6 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803764:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803767:	48 98                	cltq
+  803769:	48 89 c6             	mov    %rax,%rsi
+  80376c:	4c 89 e7             	mov    %r12,%rdi
+  80376f:	48 b8 c2 40 80 00 00 	movabs $0x8040c2,%rax
+  803776:	00 00 00 
+  803779:	ff d0                	call   *%rax
+  80377b:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80377e:	eb 17                	jmp    803797 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803780:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  803784:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803788:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80378c:	48 89 d6             	mov    %rdx,%rsi
+  80378f:	89 c7                	mov    %eax,%edi
+  803791:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803793:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803797:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80379b:	7f e3                	jg     803780 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80379d:	eb 37                	jmp    8037d6 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80379f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037a3:	74 1e                	je     8037c3 <vprintfmt+0x319>
+  8037a5:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037a8:	7e 05                	jle    8037af <vprintfmt+0x305>
+  8037aa:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037ad:	7e 14                	jle    8037c3 <vprintfmt+0x319>
+            putch('?', putdat);
+  8037af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037b3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037b7:	48 89 c6             	mov    %rax,%rsi
+  8037ba:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037bf:	ff d2                	call   *%rdx
+  8037c1:	eb 0f                	jmp    8037d2 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037c3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037c7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037cb:	48 89 c6             	mov    %rax,%rsi
+  8037ce:	89 df                	mov    %ebx,%edi
+  8037d0:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037d2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037d6:	4c 89 e0             	mov    %r12,%rax
+  8037d9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037dd:	0f b6 00             	movzbl (%rax),%eax
+  8037e0:	0f be d8             	movsbl %al,%ebx
+  8037e3:	85 db                	test   %ebx,%ebx
+  8037e5:	74 28                	je     80380f <vprintfmt+0x365>
+  8037e7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037eb:	78 b2                	js     80379f <vprintfmt+0x2f5>
+  8037ed:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8037f1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037f5:	79 a8                	jns    80379f <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8037f7:	eb 16                	jmp    80380f <vprintfmt+0x365>
+          putch(' ', putdat);
+  8037f9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037fd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803801:	48 89 c6             	mov    %rax,%rsi
+  803804:	bf 20 00 00 00       	mov    $0x20,%edi
+  803809:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80380b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80380f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803813:	7f e4                	jg     8037f9 <vprintfmt+0x34f>
+        break;
+  803815:	e9 8d 01 00 00       	jmp    8039a7 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80381a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80381d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803821:	89 d6                	mov    %edx,%esi
+  803823:	48 89 c7             	mov    %rax,%rdi
+  803826:	48 b8 b3 33 80 00 00 	movabs $0x8033b3,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+  803832:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80383a:	48 85 c0             	test   %rax,%rax
+  80383d:	79 1d                	jns    80385c <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80383f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803843:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803847:	48 89 c6             	mov    %rax,%rsi
+  80384a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80384f:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803855:	48 f7 d8             	neg    %rax
+  803858:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80385c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803863:	e9 d2 00 00 00       	jmp    80393a <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803868:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80386b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80386f:	89 d6                	mov    %edx,%esi
+  803871:	48 89 c7             	mov    %rax,%rdi
+  803874:	48 b8 bc 32 80 00 00 	movabs $0x8032bc,%rax
+  80387b:	00 00 00 
+  80387e:	ff d0                	call   *%rax
+  803880:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  803884:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80388b:	e9 aa 00 00 00       	jmp    80393a <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  803890:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803893:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803897:	89 d6                	mov    %edx,%esi
+  803899:	48 89 c7             	mov    %rax,%rdi
+  80389c:	48 b8 bc 32 80 00 00 	movabs $0x8032bc,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+  8038a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038ac:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038b3:	e9 82 00 00 00       	jmp    80393a <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038bc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038c0:	48 89 c6             	mov    %rax,%rsi
+  8038c3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038c8:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038ca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038ce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038d2:	48 89 c6             	mov    %rax,%rsi
+  8038d5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038da:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038df:	83 f8 2f             	cmp    $0x2f,%eax
+  8038e2:	77 17                	ja     8038fb <vprintfmt+0x451>
+  8038e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038eb:	89 d2                	mov    %edx,%edx
+  8038ed:	48 01 d0             	add    %rdx,%rax
+  8038f0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038f3:	83 c2 08             	add    $0x8,%edx
+  8038f6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8038f9:	eb 0c                	jmp    803907 <vprintfmt+0x45d>
+  8038fb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038ff:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803903:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803907:	48 8b 00             	mov    (%rax),%rax
+  80390a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80390e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803915:	eb 23                	jmp    80393a <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803917:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80391a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80391e:	89 d6                	mov    %edx,%esi
+  803920:	48 89 c7             	mov    %rax,%rdi
+  803923:	48 b8 bc 32 80 00 00 	movabs $0x8032bc,%rax
+  80392a:	00 00 00 
+  80392d:	ff d0                	call   *%rax
+  80392f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803933:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80393a:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80393f:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803942:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803945:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803949:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80394d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803951:	45 89 c1             	mov    %r8d,%r9d
+  803954:	41 89 f8             	mov    %edi,%r8d
+  803957:	48 89 c7             	mov    %rax,%rdi
+  80395a:	48 b8 04 32 80 00 00 	movabs $0x803204,%rax
+  803961:	00 00 00 
+  803964:	ff d0                	call   *%rax
+        break;
+  803966:	eb 3f                	jmp    8039a7 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803968:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80396c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803970:	48 89 c6             	mov    %rax,%rsi
+  803973:	89 df                	mov    %ebx,%edi
+  803975:	ff d2                	call   *%rdx
+        break;
+  803977:	eb 2e                	jmp    8039a7 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803979:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80397d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803981:	48 89 c6             	mov    %rax,%rsi
+  803984:	bf 25 00 00 00       	mov    $0x25,%edi
+  803989:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  80398b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803990:	eb 05                	jmp    803997 <vprintfmt+0x4ed>
+  803992:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803997:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80399b:	48 83 e8 01          	sub    $0x1,%rax
+  80399f:	0f b6 00             	movzbl (%rax),%eax
+  8039a2:	3c 25                	cmp    $0x25,%al
+  8039a4:	75 ec                	jne    803992 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039a6:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039a7:	e9 50 fb ff ff       	jmp    8034fc <vprintfmt+0x52>
+        return;
+  8039ac:	90                   	nop
+    }
+  }
+}
+  8039ad:	48 83 c4 60          	add    $0x60,%rsp
+  8039b1:	5b                   	pop    %rbx
+  8039b2:	41 5c                	pop    %r12
+  8039b4:	5d                   	pop    %rbp
+  8039b5:	c3                   	ret
+
+00000000008039b6 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039c1:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039c8:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039cf:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039d6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039dd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039e4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039eb:	84 c0                	test   %al,%al
+  8039ed:	74 20                	je     803a0f <printfmt+0x59>
+  8039ef:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039f3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8039f7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8039fb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8039ff:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a03:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a07:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a0b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a0f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a16:	00 00 00 
+  803a19:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a20:	00 00 00 
+  803a23:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a27:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a2e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a35:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a3c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a43:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a4a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a51:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a58:	48 89 c7             	mov    %rax,%rdi
+  803a5b:	48 b8 aa 34 80 00 00 	movabs $0x8034aa,%rax
+  803a62:	00 00 00 
+  803a65:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a67:	90                   	nop
+  803a68:	c9                   	leave
+  803a69:	c3                   	ret
+
+0000000000803a6a <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a6a:	55                   	push   %rbp
+  803a6b:	48 89 e5             	mov    %rsp,%rbp
+  803a6e:	48 83 ec 10          	sub    $0x10,%rsp
+  803a72:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a75:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a7d:	8b 40 10             	mov    0x10(%rax),%eax
+  803a80:	8d 50 01             	lea    0x1(%rax),%edx
+  803a83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a87:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8e:	48 8b 10             	mov    (%rax),%rdx
+  803a91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803a99:	48 39 c2             	cmp    %rax,%rdx
+  803a9c:	73 17                	jae    803ab5 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa2:	48 8b 00             	mov    (%rax),%rax
+  803aa5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803aa9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803aad:	48 89 0a             	mov    %rcx,(%rdx)
+  803ab0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803ab3:	88 10                	mov    %dl,(%rax)
+}
+  803ab5:	90                   	nop
+  803ab6:	c9                   	leave
+  803ab7:	c3                   	ret
+
+0000000000803ab8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ab8:	55                   	push   %rbp
+  803ab9:	48 89 e5             	mov    %rsp,%rbp
+  803abc:	48 83 ec 40          	sub    $0x40,%rsp
+  803ac0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ac4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ac7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803acb:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803acf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ad3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ad7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ada:	48 98                	cltq
+  803adc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae4:	48 01 d0             	add    %rdx,%rax
+  803ae7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803aeb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803af2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803af7:	74 06                	je     803aff <vsnprintf+0x47>
+  803af9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803afd:	7f 07                	jg     803b06 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803aff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b04:	eb 32                	jmp    803b38 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b06:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b0a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b0e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b12:	48 89 c6             	mov    %rax,%rsi
+  803b15:	48 b8 6a 3a 80 00 00 	movabs $0x803a6a,%rax
+  803b1c:	00 00 00 
+  803b1f:	48 89 c7             	mov    %rax,%rdi
+  803b22:	48 b8 aa 34 80 00 00 	movabs $0x8034aa,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b32:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b35:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b38:	c9                   	leave
+  803b39:	c3                   	ret
+
+0000000000803b3a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b3a:	55                   	push   %rbp
+  803b3b:	48 89 e5             	mov    %rsp,%rbp
+  803b3e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b45:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b4c:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b52:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b59:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b60:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b67:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b6e:	84 c0                	test   %al,%al
+  803b70:	74 20                	je     803b92 <snprintf+0x58>
+  803b72:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b76:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b7a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b7e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b82:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b86:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b8a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b8e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803b92:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803b99:	00 00 00 
+  803b9c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803ba3:	00 00 00 
+  803ba6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803baa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bb1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bb8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bbf:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bc6:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bcd:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bd3:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bda:	48 89 c7             	mov    %rax,%rdi
+  803bdd:	48 b8 b8 3a 80 00 00 	movabs $0x803ab8,%rax
+  803be4:	00 00 00 
+  803be7:	ff d0                	call   *%rax
+  803be9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803bef:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803bf5:	c9                   	leave
+  803bf6:	c3                   	ret
+
+0000000000803bf7 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803bf7:	55                   	push   %rbp
+  803bf8:	48 89 e5             	mov    %rsp,%rbp
+  803bfb:	53                   	push   %rbx
+  803bfc:	48 83 ec 38          	sub    $0x38,%rsp
+  803c00:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c03:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c07:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c0b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c0f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c13:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1b:	89 d1                	mov    %edx,%ecx
+  803c1d:	0f a2                	cpuid
+  803c1f:	89 de                	mov    %ebx,%esi
+  803c21:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c24:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c27:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c2a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c2d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c32:	74 09                	je     803c3d <cpuid+0x46>
+}
+  803c34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c38:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c3b:	89 10                	mov    %edx,(%rax)
+
+  803c3d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c42:	74 09                	je     803c4d <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c48:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c4b:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c4d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c52:	74 09                	je     803c5d <cpuid+0x66>
+char *
+  803c54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c58:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c5b:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c5d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c62:	74 09                	je     803c6d <cpuid+0x76>
+  for (; *s; s++)
+  803c64:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c68:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c6b:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c6d:	90                   	nop
+  803c6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c72:	c9                   	leave
+  803c73:	c3                   	ret
+
+0000000000803c74 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c74:	55                   	push   %rbp
+  803c75:	48 89 e5             	mov    %rsp,%rbp
+  803c78:	48 83 ec 18          	sub    $0x18,%rsp
+  803c7c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c82:	89 c1                	mov    %eax,%ecx
+  803c84:	0f 01 d0             	xgetbv
+  803c87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c90:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803c93:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c97:	48 09 d0             	or     %rdx,%rax
+#else
+  803c9a:	c9                   	leave
+  803c9b:	c3                   	ret
+
+0000000000803c9c <string_cpu>:
+string_cpu(void) {
+  803c9c:	55                   	push   %rbp
+  803c9d:	48 89 e5             	mov    %rsp,%rbp
+  803ca0:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803ca4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cb2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cb9:	00 00 00 
+  803cbc:	8b 00                	mov    (%rax),%eax
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	78 11                	js     803cd3 <string_cpu+0x37>
+    return string_features;
+  803cc2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cc9:	00 00 00 
+  803ccc:	8b 00                	mov    (%rax),%eax
+  803cce:	e9 df 00 00 00       	jmp    803db2 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cd3:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce7:	48 89 c6             	mov    %rax,%rsi
+  803cea:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cef:	48 b8 f7 3b 80 00 00 	movabs $0x803bf7,%rax
+  803cf6:	00 00 00 
+  803cf9:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803cfb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803cfe:	83 f8 06             	cmp    $0x6,%eax
+  803d01:	76 28                	jbe    803d2b <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d03:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d12:	48 89 c2             	mov    %rax,%rdx
+  803d15:	be 00 00 00 00       	mov    $0x0,%esi
+  803d1a:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d1f:	48 b8 f7 3b 80 00 00 	movabs $0x803bf7,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d2e:	25 00 02 00 00       	and    $0x200,%eax
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	74 04                	je     803d3b <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d37:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d3b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d45:	48 89 c1             	mov    %rax,%rcx
+  803d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d4d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d52:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d57:	48 b8 f7 3b 80 00 00 	movabs $0x803bf7,%rax
+  803d5e:	00 00 00 
+  803d61:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d63:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d66:	83 e0 20             	and    $0x20,%eax
+  803d69:	85 c0                	test   %eax,%eax
+  803d6b:	74 2a                	je     803d97 <string_cpu+0xfb>
+  803d6d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d70:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d75:	85 c0                	test   %eax,%eax
+  803d77:	74 1e                	je     803d97 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7e:	48 b8 74 3c 80 00 00 	movabs $0x803c74,%rax
+  803d85:	00 00 00 
+  803d88:	ff d0                	call   *%rax
+  803d8a:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d8d:	48 83 f8 06          	cmp    $0x6,%rax
+  803d91:	75 04                	jne    803d97 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803d93:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803d97:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803d9e:	00 00 00 
+  803da1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803da4:	89 02                	mov    %eax,(%rdx)
+  803da6:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dad:	00 00 00 
+  803db0:	8b 00                	mov    (%rax),%eax
+}
+  803db2:	c9                   	leave
+  803db3:	c3                   	ret
+
+0000000000803db4 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803db4:	55                   	push   %rbp
+  803db5:	48 89 e5             	mov    %rsp,%rbp
+  803db8:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dbc:	48 83 ec 60          	sub    $0x60,%rsp
+  803dc0:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dc5:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dca:	83 e0 1f             	and    $0x1f,%eax
+  803dcd:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803dd1:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803dd5:	48 f7 d8             	neg    %rax
+  803dd8:	48 89 c2             	mov    %rax,%rdx
+  803ddb:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803de0:	48 01 d0             	add    %rdx,%rax
+  803de3:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803de8:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803dec:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803df2:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803df7:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803dfb:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e01:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e05:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e09:	89 c2                	mov    %eax,%edx
+  803e0b:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e0f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e14:	89 c1                	mov    %eax,%ecx
+  803e16:	d3 e6                	shl    %cl,%esi
+  803e18:	89 f0                	mov    %esi,%eax
+  803e1a:	21 d0                	and    %edx,%eax
+  803e1c:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e20:	eb 21                	jmp    803e43 <strlen_avx2+0x8f>
+    p += 32;
+  803e22:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e28:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e2d:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e31:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e37:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e3b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e3f:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e43:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e48:	74 d8                	je     803e22 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e4a:	31 c0                	xor    %eax,%eax
+  803e4c:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e52:	48 63 d0             	movslq %eax,%rdx
+  803e55:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e5a:	48 01 d0             	add    %rdx,%rax
+  803e5d:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e62:	c9                   	leave
+  803e63:	c3                   	ret
+
+0000000000803e64 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e64:	55                   	push   %rbp
+  803e65:	48 89 e5             	mov    %rsp,%rbp
+  803e68:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e6c:	48 83 ec 40          	sub    $0x40,%rsp
+  803e70:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e75:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e7a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e7f:	eb 77                	jmp    803ef8 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e81:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e86:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e8a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e8e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803e93:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e97:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e9b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e9f:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ea3:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ea8:	74 3c                	je     803ee6 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803eaa:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eae:	f7 d0                	not    %eax
+  803eb0:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803eb4:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803eb8:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ebc:	48 63 d0             	movslq %eax,%rdx
+  803ebf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ec4:	48 01 d0             	add    %rdx,%rax
+  803ec7:	0f b6 00             	movzbl (%rax),%eax
+  803eca:	0f b6 c0             	movzbl %al,%eax
+  803ecd:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ed1:	48 63 ca             	movslq %edx,%rcx
+  803ed4:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ed9:	48 01 ca             	add    %rcx,%rdx
+  803edc:	0f b6 12             	movzbl (%rdx),%edx
+  803edf:	0f b6 d2             	movzbl %dl,%edx
+  803ee2:	29 d0                	sub    %edx,%eax
+  803ee4:	eb 6b                	jmp    803f51 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ee6:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803eec:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803ef2:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803ef8:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803efe:	77 81                	ja     803e81 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f00:	eb 42                	jmp    803f44 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f02:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f07:	0f b6 10             	movzbl (%rax),%edx
+  803f0a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f0f:	0f b6 00             	movzbl (%rax),%eax
+  803f12:	38 c2                	cmp    %al,%dl
+  803f14:	74 1c                	je     803f32 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f16:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f1b:	0f b6 00             	movzbl (%rax),%eax
+  803f1e:	0f b6 c8             	movzbl %al,%ecx
+  803f21:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f26:	0f b6 00             	movzbl (%rax),%eax
+  803f29:	0f b6 d0             	movzbl %al,%edx
+  803f2c:	89 c8                	mov    %ecx,%eax
+  803f2e:	29 d0                	sub    %edx,%eax
+  803f30:	eb 1f                	jmp    803f51 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f32:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f38:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f3e:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f44:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f4a:	75 b6                	jne    803f02 <memcmp_avx2+0x9e>
+  return 0;
+  803f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f51:	c9                   	leave
+  803f52:	c3                   	ret
+
+0000000000803f53 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f53:	55                   	push   %rbp
+  803f54:	48 89 e5             	mov    %rsp,%rbp
+  803f57:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f5b:	48 83 ec 60          	sub    $0x60,%rsp
+  803f5f:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f64:	89 f0                	mov    %esi,%eax
+  803f66:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f6b:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f6f:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f74:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f78:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f7d:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f83:	eb 47                	jmp    803fcc <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f85:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f8a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f8e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f92:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803f98:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803f9c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fa0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fa4:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fa9:	74 15                	je     803fc0 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fab:	31 c0                	xor    %eax,%eax
+  803fad:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fb3:	48 63 d0             	movslq %eax,%rdx
+  803fb6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fbb:	48 01 d0             	add    %rdx,%rax
+  803fbe:	eb 3d                	jmp    803ffd <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fc0:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fc6:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fcc:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fd2:	77 b1                	ja     803f85 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fd4:	eb 0c                	jmp    803fe2 <memfind_avx2+0x8f>
+  803fd6:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fdc:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fe2:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fe8:	74 0e                	je     803ff8 <memfind_avx2+0xa5>
+  803fea:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fef:	0f b6 00             	movzbl (%rax),%eax
+  803ff2:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  803ff6:	75 de                	jne    803fd6 <memfind_avx2+0x83>
+  return s;
+  803ff8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  803ffd:	c9                   	leave
+  803ffe:	c3                   	ret
+
+0000000000803fff <strlen>:
+strlen(const char *s) {
+  803fff:	55                   	push   %rbp
+  804000:	48 89 e5             	mov    %rsp,%rbp
+  804003:	48 83 ec 40          	sub    $0x40,%rsp
+  804007:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80400b:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80400f:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804013:	48 b8 9c 3c 80 00 00 	movabs $0x803c9c,%rax
+  80401a:	00 00 00 
+  80401d:	ff d0                	call   *%rax
+  80401f:	83 e0 02             	and    $0x2,%eax
+  804022:	85 c0                	test   %eax,%eax
+  804024:	74 18                	je     80403e <strlen+0x3f>
+    return strlen_avx2(s);
+  804026:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80402a:	48 89 c7             	mov    %rax,%rdi
+  80402d:	48 b8 b4 3d 80 00 00 	movabs $0x803db4,%rax
+  804034:	00 00 00 
+  804037:	ff d0                	call   *%rax
+  804039:	e9 82 00 00 00       	jmp    8040c0 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80403e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804042:	83 e0 0f             	and    $0xf,%eax
+  804045:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804048:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80404b:	48 f7 d8             	neg    %rax
+  80404e:	48 89 c2             	mov    %rax,%rdx
+  804051:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804055:	48 01 d0             	add    %rdx,%rax
+  804058:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80405c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804060:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804064:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804069:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80406d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804071:	89 c2                	mov    %eax,%edx
+  804073:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804076:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80407b:	89 c1                	mov    %eax,%ecx
+  80407d:	d3 e6                	shl    %cl,%esi
+  80407f:	89 f0                	mov    %esi,%eax
+  804081:	21 d0                	and    %edx,%eax
+  804083:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804086:	eb 1d                	jmp    8040a5 <strlen+0xa6>
+    p += 16;
+  804088:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80408d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804091:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804095:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80409a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80409e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a9:	74 dd                	je     804088 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040ab:	31 c0                	xor    %eax,%eax
+  8040ad:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040b2:	48 63 d0             	movslq %eax,%rdx
+  8040b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040b9:	48 01 d0             	add    %rdx,%rax
+  8040bc:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040c0:	c9                   	leave
+  8040c1:	c3                   	ret
+
+00000000008040c2 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040c2:	55                   	push   %rbp
+  8040c3:	48 89 e5             	mov    %rsp,%rbp
+  8040c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8040ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040d9:	eb 0e                	jmp    8040e9 <strnlen+0x27>
+    n++;
+  8040db:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040df:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040e4:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040e9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040ee:	74 0b                	je     8040fb <strnlen+0x39>
+  8040f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040f4:	0f b6 00             	movzbl (%rax),%eax
+  8040f7:	84 c0                	test   %al,%al
+  8040f9:	75 e0                	jne    8040db <strnlen+0x19>
+  return n;
+  8040fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8040fe:	c9                   	leave
+  8040ff:	c3                   	ret
+
+0000000000804100 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804100:	55                   	push   %rbp
+  804101:	48 89 e5             	mov    %rsp,%rbp
+  804104:	48 83 ec 20          	sub    $0x20,%rsp
+  804108:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80410c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804114:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804118:	90                   	nop
+  804119:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80411d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804121:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804125:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804129:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80412d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804131:	0f b6 12             	movzbl (%rdx),%edx
+  804134:	88 10                	mov    %dl,(%rax)
+  804136:	0f b6 00             	movzbl (%rax),%eax
+  804139:	84 c0                	test   %al,%al
+  80413b:	75 dc                	jne    804119 <strcpy+0x19>
+  return ret;
+  80413d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804141:	c9                   	leave
+  804142:	c3                   	ret
+
+0000000000804143 <strcat>:
+strcat(char *dst, const char *src) {
+  804143:	55                   	push   %rbp
+  804144:	48 89 e5             	mov    %rsp,%rbp
+  804147:	48 83 ec 20          	sub    $0x20,%rsp
+  80414b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80414f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  804153:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804157:	48 89 c7             	mov    %rax,%rdi
+  80415a:	48 b8 ff 3f 80 00 00 	movabs $0x803fff,%rax
+  804161:	00 00 00 
+  804164:	ff d0                	call   *%rax
+  804166:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80416c:	48 63 d0             	movslq %eax,%rdx
+  80416f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804173:	48 01 c2             	add    %rax,%rdx
+  804176:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80417a:	48 89 c6             	mov    %rax,%rsi
+  80417d:	48 89 d7             	mov    %rdx,%rdi
+  804180:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  804187:	00 00 00 
+  80418a:	ff d0                	call   *%rax
+  return dst;
+  80418c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804190:	c9                   	leave
+  804191:	c3                   	ret
+
+0000000000804192 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  804192:	55                   	push   %rbp
+  804193:	48 89 e5             	mov    %rsp,%rbp
+  804196:	48 83 ec 28          	sub    $0x28,%rsp
+  80419a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80419e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041ae:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041b5:	00 
+  8041b6:	eb 2a                	jmp    8041e2 <strncpy+0x50>
+    *dst++ = *src;
+  8041b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041c8:	0f b6 12             	movzbl (%rdx),%edx
+  8041cb:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d1:	0f b6 00             	movzbl (%rax),%eax
+  8041d4:	84 c0                	test   %al,%al
+  8041d6:	74 05                	je     8041dd <strncpy+0x4b>
+      src++;
+  8041d8:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041dd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041ea:	72 cc                	jb     8041b8 <strncpy+0x26>
+  return ret;
+  8041ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8041f0:	c9                   	leave
+  8041f1:	c3                   	ret
+
+00000000008041f2 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8041f2:	55                   	push   %rbp
+  8041f3:	48 89 e5             	mov    %rsp,%rbp
+  8041f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8041fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804202:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804206:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80420a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80420e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804213:	74 3d                	je     804252 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804215:	eb 1d                	jmp    804234 <strlcpy+0x42>
+      *dst++ = *src++;
+  804217:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80421b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80421f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804223:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804227:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80422b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80422f:	0f b6 12             	movzbl (%rdx),%edx
+  804232:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804234:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804239:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80423e:	74 0b                	je     80424b <strlcpy+0x59>
+  804240:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804244:	0f b6 00             	movzbl (%rax),%eax
+  804247:	84 c0                	test   %al,%al
+  804249:	75 cc                	jne    804217 <strlcpy+0x25>
+    *dst = '\0';
+  80424b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80424f:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  804252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804256:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80425a:	c9                   	leave
+  80425b:	c3                   	ret
+
+000000000080425c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80425c:	55                   	push   %rbp
+  80425d:	48 89 e5             	mov    %rsp,%rbp
+  804260:	48 83 ec 30          	sub    $0x30,%rsp
+  804264:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804268:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80426c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  804270:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804274:	48 89 c7             	mov    %rax,%rdi
+  804277:	48 b8 ff 3f 80 00 00 	movabs $0x803fff,%rax
+  80427e:	00 00 00 
+  804281:	ff d0                	call   *%rax
+  804283:	48 98                	cltq
+  804285:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804289:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80428d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804291:	48 89 d6             	mov    %rdx,%rsi
+  804294:	48 89 c7             	mov    %rax,%rdi
+  804297:	48 b8 c2 40 80 00 00 	movabs $0x8040c2,%rax
+  80429e:	00 00 00 
+  8042a1:	ff d0                	call   *%rax
+  8042a3:	48 98                	cltq
+  8042a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042ad:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042b1:	75 10                	jne    8042c3 <strlcat+0x67>
+    return maxlen + srclen;
+  8042b3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042bb:	48 01 d0             	add    %rdx,%rax
+  8042be:	e9 86 00 00 00       	jmp    804349 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042c7:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042cb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042cf:	73 2b                	jae    8042fc <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042d9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042e1:	48 01 c1             	add    %rax,%rcx
+  8042e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042e8:	48 89 c6             	mov    %rax,%rsi
+  8042eb:	48 89 cf             	mov    %rcx,%rdi
+  8042ee:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  8042f5:	00 00 00 
+  8042f8:	ff d0                	call   *%rax
+  8042fa:	eb 42                	jmp    80433e <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8042fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804300:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804304:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80430c:	48 01 c1             	add    %rax,%rcx
+  80430f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804313:	48 89 c6             	mov    %rax,%rsi
+  804316:	48 89 cf             	mov    %rcx,%rdi
+  804319:	48 b8 49 48 80 00 00 	movabs $0x804849,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804325:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804329:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80432d:	48 01 d0             	add    %rdx,%rax
+  804330:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804334:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804338:	48 01 d0             	add    %rdx,%rax
+  80433b:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80433e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804346:	48 01 d0             	add    %rdx,%rax
+}
+  804349:	c9                   	leave
+  80434a:	c3                   	ret
+
+000000000080434b <strcmp>:
+strcmp(const char *p, const char *q) {
+  80434b:	55                   	push   %rbp
+  80434c:	48 89 e5             	mov    %rsp,%rbp
+  80434f:	48 83 ec 10          	sub    $0x10,%rsp
+  804353:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804357:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80435b:	eb 0a                	jmp    804367 <strcmp+0x1c>
+    p++, q++;
+  80435d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804362:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804367:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80436b:	0f b6 00             	movzbl (%rax),%eax
+  80436e:	84 c0                	test   %al,%al
+  804370:	74 12                	je     804384 <strcmp+0x39>
+  804372:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804376:	0f b6 10             	movzbl (%rax),%edx
+  804379:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80437d:	0f b6 00             	movzbl (%rax),%eax
+  804380:	38 c2                	cmp    %al,%dl
+  804382:	74 d9                	je     80435d <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  804384:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804388:	0f b6 00             	movzbl (%rax),%eax
+  80438b:	0f b6 d0             	movzbl %al,%edx
+  80438e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804392:	0f b6 00             	movzbl (%rax),%eax
+  804395:	0f b6 c0             	movzbl %al,%eax
+  804398:	29 c2                	sub    %eax,%edx
+  80439a:	89 d0                	mov    %edx,%eax
+}
+  80439c:	c9                   	leave
+  80439d:	c3                   	ret
+
+000000000080439e <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80439e:	55                   	push   %rbp
+  80439f:	48 89 e5             	mov    %rsp,%rbp
+  8043a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043ae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043b2:	eb 0f                	jmp    8043c3 <strncmp+0x25>
+    n--, p++, q++;
+  8043b4:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043b9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043be:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043c3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043c8:	74 1d                	je     8043e7 <strncmp+0x49>
+  8043ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ce:	0f b6 00             	movzbl (%rax),%eax
+  8043d1:	84 c0                	test   %al,%al
+  8043d3:	74 12                	je     8043e7 <strncmp+0x49>
+  8043d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d9:	0f b6 10             	movzbl (%rax),%edx
+  8043dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e0:	0f b6 00             	movzbl (%rax),%eax
+  8043e3:	38 c2                	cmp    %al,%dl
+  8043e5:	74 cd                	je     8043b4 <strncmp+0x16>
+  if (n == 0)
+  8043e7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043ec:	75 07                	jne    8043f5 <strncmp+0x57>
+    return 0;
+  8043ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043f3:	eb 16                	jmp    80440b <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8043f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f9:	0f b6 00             	movzbl (%rax),%eax
+  8043fc:	0f b6 d0             	movzbl %al,%edx
+  8043ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804403:	0f b6 00             	movzbl (%rax),%eax
+  804406:	0f b6 c0             	movzbl %al,%eax
+  804409:	29 c2                	sub    %eax,%edx
+}
+  80440b:	89 d0                	mov    %edx,%eax
+  80440d:	c9                   	leave
+  80440e:	c3                   	ret
+
+000000000080440f <strchr>:
+strchr(const char *s, char c) {
+  80440f:	55                   	push   %rbp
+  804410:	48 89 e5             	mov    %rsp,%rbp
+  804413:	48 83 ec 60          	sub    $0x60,%rsp
+  804417:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80441b:	89 f0                	mov    %esi,%eax
+  80441d:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804420:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804424:	83 e0 0f             	and    $0xf,%eax
+  804427:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80442a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80442d:	48 f7 d8             	neg    %rax
+  804430:	48 89 c2             	mov    %rax,%rdx
+  804433:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804437:	48 01 d0             	add    %rdx,%rax
+  80443a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80443e:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804442:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804446:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80444a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80444e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804452:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804456:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80445b:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80445f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804463:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804467:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80446b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804470:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804475:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804479:	89 c2                	mov    %eax,%edx
+  80447b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804480:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804485:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804489:	09 c2                	or     %eax,%edx
+  80448b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80448e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804493:	89 c1                	mov    %eax,%ecx
+  804495:	d3 e6                	shl    %cl,%esi
+  804497:	89 f0                	mov    %esi,%eax
+  804499:	21 d0                	and    %edx,%eax
+  80449b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80449e:	eb 34                	jmp    8044d4 <strchr+0xc5>
+    p += 16;
+  8044a0:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044a9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044ad:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044b1:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044b6:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044bb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044bf:	89 c2                	mov    %eax,%edx
+  8044c1:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c6:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044cb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044cf:	09 d0                	or     %edx,%eax
+  8044d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044d8:	74 c6                	je     8044a0 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044da:	31 c0                	xor    %eax,%eax
+  8044dc:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044e1:	48 98                	cltq
+  8044e3:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044eb:	0f b6 00             	movzbl (%rax),%eax
+  8044ee:	84 c0                	test   %al,%al
+  8044f0:	74 06                	je     8044f8 <strchr+0xe9>
+  8044f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f6:	eb 05                	jmp    8044fd <strchr+0xee>
+  8044f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044fd:	c9                   	leave
+  8044fe:	c3                   	ret
+
+00000000008044ff <strfind>:
+strfind(const char *s, char c) {
+  8044ff:	55                   	push   %rbp
+  804500:	48 89 e5             	mov    %rsp,%rbp
+  804503:	48 83 ec 10          	sub    $0x10,%rsp
+  804507:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80450b:	89 f0                	mov    %esi,%eax
+  80450d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804510:	eb 11                	jmp    804523 <strfind+0x24>
+    if (*s == c)
+  804512:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804516:	0f b6 00             	movzbl (%rax),%eax
+  804519:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80451c:	74 12                	je     804530 <strfind+0x31>
+  for (; *s; s++)
+  80451e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804523:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804527:	0f b6 00             	movzbl (%rax),%eax
+  80452a:	84 c0                	test   %al,%al
+  80452c:	75 e4                	jne    804512 <strfind+0x13>
+  80452e:	eb 01                	jmp    804531 <strfind+0x32>
+      break;
+  804530:	90                   	nop
+  return (char *)s;
+  804531:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804535:	c9                   	leave
+  804536:	c3                   	ret
+
+0000000000804537 <memset>:
+memset(void *v, int c, size_t n) {
+  804537:	55                   	push   %rbp
+  804538:	48 89 e5             	mov    %rsp,%rbp
+  80453b:	48 83 ec 38          	sub    $0x38,%rsp
+  80453f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804543:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804546:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80454a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80454e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804552:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804557:	76 41                	jbe    80459a <memset+0x63>
+  804559:	48 b8 9c 3c 80 00 00 	movabs $0x803c9c,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+  804565:	83 e0 01             	and    $0x1,%eax
+  804568:	85 c0                	test   %eax,%eax
+  80456a:	74 2e                	je     80459a <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80456c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80456f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804573:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804577:	48 89 ce             	mov    %rcx,%rsi
+  80457a:	48 89 f7             	mov    %rsi,%rdi
+  80457d:	48 89 d1             	mov    %rdx,%rcx
+  804580:	fc                   	cld
+  804581:	f3 aa                	rep stos %al,%es:(%rdi)
+  804583:	48 89 ca             	mov    %rcx,%rdx
+  804586:	48 89 fe             	mov    %rdi,%rsi
+  804589:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80458d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  804591:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804595:	e9 a7 00 00 00       	jmp    804641 <memset+0x10a>
+  if (n >= 8) {
+  80459a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80459f:	0f 86 87 00 00 00    	jbe    80462c <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045a5:	eb 16                	jmp    8045bd <memset+0x86>
+      *p++ = c;
+  8045a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045af:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045b3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045b6:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045b8:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c1:	83 e0 07             	and    $0x7,%eax
+  8045c4:	48 85 c0             	test   %rax,%rax
+  8045c7:	75 de                	jne    8045a7 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045c9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045cc:	0f b6 c0             	movzbl %al,%eax
+  8045cf:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045d6:	01 01 01 
+  8045d9:	48 0f af c2          	imul   %rdx,%rax
+  8045dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045e5:	48 c1 e8 03          	shr    $0x3,%rax
+  8045e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045f9:	48 89 ce             	mov    %rcx,%rsi
+  8045fc:	48 89 f7             	mov    %rsi,%rdi
+  8045ff:	48 89 d1             	mov    %rdx,%rcx
+  804602:	fc                   	cld
+  804603:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804606:	48 89 ca             	mov    %rcx,%rdx
+  804609:	48 89 fe             	mov    %rdi,%rsi
+  80460c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804610:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804614:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804619:	eb 11                	jmp    80462c <memset+0xf5>
+    *p++ = c;
+  80461b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80461f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804623:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804627:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80462a:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80462c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804630:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804634:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804638:	48 85 c0             	test   %rax,%rax
+  80463b:	75 de                	jne    80461b <memset+0xe4>
+  return v;
+  80463d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804641:	c9                   	leave
+  804642:	c3                   	ret
+
+0000000000804643 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  804643:	55                   	push   %rbp
+  804644:	48 89 e5             	mov    %rsp,%rbp
+  804647:	48 83 ec 38          	sub    $0x38,%rsp
+  80464b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80464f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804653:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804657:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80465b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80465f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804663:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804667:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80466b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80466f:	0f 83 da 00 00 00    	jae    80474f <memmove+0x10c>
+  804675:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804679:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80467d:	48 01 d0             	add    %rdx,%rax
+  804680:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804684:	0f 83 c5 00 00 00    	jae    80474f <memmove+0x10c>
+    s += n;
+  80468a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80468e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  804692:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804696:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80469a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80469f:	0f 86 94 00 00 00    	jbe    804739 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046a5:	eb 1c                	jmp    8046c3 <memmove+0x80>
+        *--d = *--s;
+  8046a7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046ac:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b5:	0f b6 10             	movzbl (%rax),%edx
+  8046b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046bc:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046be:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c7:	83 e0 07             	and    $0x7,%eax
+  8046ca:	48 85 c0             	test   %rax,%rax
+  8046cd:	75 d8                	jne    8046a7 <memmove+0x64>
+      nq = n / 8;
+  8046cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046d3:	48 c1 e8 03          	shr    $0x3,%rax
+  8046d7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046db:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046e0:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046e5:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046ea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f6:	48 89 cf             	mov    %rcx,%rdi
+  8046f9:	48 89 d6             	mov    %rdx,%rsi
+  8046fc:	48 89 c1             	mov    %rax,%rcx
+  8046ff:	fd                   	std
+  804700:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804703:	fc                   	cld
+  804704:	48 89 c8             	mov    %rcx,%rax
+  804707:	48 89 f2             	mov    %rsi,%rdx
+  80470a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80470e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804712:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804716:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80471b:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804720:	eb 17                	jmp    804739 <memmove+0xf6>
+      *--d = *--s;
+  804722:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804727:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80472c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804730:	0f b6 10             	movzbl (%rax),%edx
+  804733:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804737:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804739:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80473d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804741:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804745:	48 85 c0             	test   %rax,%rax
+  804748:	75 d8                	jne    804722 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80474a:	e9 f4 00 00 00       	jmp    804843 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80474f:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804754:	76 46                	jbe    80479c <memmove+0x159>
+  804756:	48 b8 9c 3c 80 00 00 	movabs $0x803c9c,%rax
+  80475d:	00 00 00 
+  804760:	ff d0                	call   *%rax
+  804762:	83 e0 01             	and    $0x1,%eax
+  804765:	85 c0                	test   %eax,%eax
+  804767:	74 33                	je     80479c <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804769:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80476d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804771:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804775:	48 89 cf             	mov    %rcx,%rdi
+  804778:	48 89 d6             	mov    %rdx,%rsi
+  80477b:	48 89 c1             	mov    %rax,%rcx
+  80477e:	fc                   	cld
+  80477f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804781:	48 89 c8             	mov    %rcx,%rax
+  804784:	48 89 f2             	mov    %rsi,%rdx
+  804787:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80478b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80478f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  804793:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804797:	e9 ab 00 00 00       	jmp    804847 <memmove+0x204>
+    if (n >= 8) {
+  80479c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047a1:	0f 86 8b 00 00 00    	jbe    804832 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047a7:	eb 22                	jmp    8047cb <memmove+0x188>
+        *d++ = *s++;
+  8047a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047ad:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047bd:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047c1:	0f b6 12             	movzbl (%rdx),%edx
+  8047c4:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047c6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047cf:	83 e0 07             	and    $0x7,%eax
+  8047d2:	48 85 c0             	test   %rax,%rax
+  8047d5:	75 d2                	jne    8047a9 <memmove+0x166>
+      nq = n / 8;
+  8047d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047db:	48 c1 e8 03          	shr    $0x3,%rax
+  8047df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047e3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ef:	48 89 cf             	mov    %rcx,%rdi
+  8047f2:	48 89 d6             	mov    %rdx,%rsi
+  8047f5:	48 89 c1             	mov    %rax,%rcx
+  8047f8:	fc                   	cld
+  8047f9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8047fc:	48 89 c8             	mov    %rcx,%rax
+  8047ff:	48 89 f2             	mov    %rsi,%rdx
+  804802:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804806:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80480a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80480e:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804813:	eb 1d                	jmp    804832 <memmove+0x1ef>
+      *d++ = *s++;
+  804815:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804819:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80481d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804821:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804825:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804829:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80482d:	0f b6 12             	movzbl (%rdx),%edx
+  804830:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804832:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804836:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80483a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80483e:	48 85 c0             	test   %rax,%rax
+  804841:	75 d2                	jne    804815 <memmove+0x1d2>
+  return dst;
+  804843:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804847:	c9                   	leave
+  804848:	c3                   	ret
+
+0000000000804849 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804849:	55                   	push   %rbp
+  80484a:	48 89 e5             	mov    %rsp,%rbp
+  80484d:	48 83 ec 18          	sub    $0x18,%rsp
+  804851:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804855:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804859:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80485d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804861:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804869:	48 89 ce             	mov    %rcx,%rsi
+  80486c:	48 89 c7             	mov    %rax,%rdi
+  80486f:	48 b8 43 46 80 00 00 	movabs $0x804643,%rax
+  804876:	00 00 00 
+  804879:	ff d0                	call   *%rax
+}
+  80487b:	c9                   	leave
+  80487c:	c3                   	ret
+
+000000000080487d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80487d:	55                   	push   %rbp
+  80487e:	48 89 e5             	mov    %rsp,%rbp
+  804881:	48 83 ec 40          	sub    $0x40,%rsp
+  804885:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804889:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80488d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  804891:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804895:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804899:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80489d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048a1:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048a6:	0f 86 a7 00 00 00    	jbe    804953 <memcmp+0xd6>
+  8048ac:	48 b8 9c 3c 80 00 00 	movabs $0x803c9c,%rax
+  8048b3:	00 00 00 
+  8048b6:	ff d0                	call   *%rax
+  8048b8:	83 e0 02             	and    $0x2,%eax
+  8048bb:	85 c0                	test   %eax,%eax
+  8048bd:	0f 84 90 00 00 00    	je     804953 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048c3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048c7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048cf:	48 89 ce             	mov    %rcx,%rsi
+  8048d2:	48 89 c7             	mov    %rax,%rdi
+  8048d5:	48 b8 64 3e 80 00 00 	movabs $0x803e64,%rax
+  8048dc:	00 00 00 
+  8048df:	ff d0                	call   *%rax
+  8048e1:	e9 c2 00 00 00       	jmp    8049a8 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ea:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048ee:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8048f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048fa:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8048fe:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804902:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804905:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  80490c:	74 36                	je     804944 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80490e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804911:	f7 d0                	not    %eax
+  804913:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804917:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80491a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80491d:	48 63 d0             	movslq %eax,%rdx
+  804920:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804924:	48 01 d0             	add    %rdx,%rax
+  804927:	0f b6 00             	movzbl (%rax),%eax
+  80492a:	0f b6 c0             	movzbl %al,%eax
+  80492d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804930:	48 63 ca             	movslq %edx,%rcx
+  804933:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804937:	48 01 ca             	add    %rcx,%rdx
+  80493a:	0f b6 12             	movzbl (%rdx),%edx
+  80493d:	0f b6 d2             	movzbl %dl,%edx
+  804940:	29 d0                	sub    %edx,%eax
+  804942:	eb 64                	jmp    8049a8 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804944:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804949:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80494e:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  804953:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804958:	77 8c                	ja     8048e6 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80495a:	eb 36                	jmp    804992 <memcmp+0x115>
+    if (*s1 != *s2)
+  80495c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804960:	0f b6 10             	movzbl (%rax),%edx
+  804963:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804967:	0f b6 00             	movzbl (%rax),%eax
+  80496a:	38 c2                	cmp    %al,%dl
+  80496c:	74 1a                	je     804988 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80496e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804972:	0f b6 00             	movzbl (%rax),%eax
+  804975:	0f b6 c8             	movzbl %al,%ecx
+  804978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497c:	0f b6 00             	movzbl (%rax),%eax
+  80497f:	0f b6 d0             	movzbl %al,%edx
+  804982:	89 c8                	mov    %ecx,%eax
+  804984:	29 d0                	sub    %edx,%eax
+  804986:	eb 20                	jmp    8049a8 <memcmp+0x12b>
+    s1++, s2++;
+  804988:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80498d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  804992:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804996:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80499a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80499e:	48 85 c0             	test   %rax,%rax
+  8049a1:	75 b9                	jne    80495c <memcmp+0xdf>
+  }
+
+  return 0;
+  8049a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049a8:	c9                   	leave
+  8049a9:	c3                   	ret
+
+00000000008049aa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049aa:	55                   	push   %rbp
+  8049ab:	48 89 e5             	mov    %rsp,%rbp
+  8049ae:	48 83 ec 50          	sub    $0x50,%rsp
+  8049b2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049b6:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049b9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049c1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049c5:	48 01 d0             	add    %rdx,%rax
+  8049c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049cc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049cf:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049d3:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049d7:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049db:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049e0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049e4:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049e9:	76 73                	jbe    804a5e <memfind+0xb4>
+  8049eb:	48 b8 9c 3c 80 00 00 	movabs $0x803c9c,%rax
+  8049f2:	00 00 00 
+  8049f5:	ff d0                	call   *%rax
+  8049f7:	83 e0 02             	and    $0x2,%eax
+  8049fa:	85 c0                	test   %eax,%eax
+  8049fc:	74 60                	je     804a5e <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8049fe:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a01:	0f b6 c8             	movzbl %al,%ecx
+  804a04:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a0c:	89 ce                	mov    %ecx,%esi
+  804a0e:	48 89 c7             	mov    %rax,%rdi
+  804a11:	48 b8 53 3f 80 00 00 	movabs $0x803f53,%rax
+  804a18:	00 00 00 
+  804a1b:	ff d0                	call   *%rax
+  804a1d:	eb 6c                	jmp    804a8b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a23:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a27:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a2b:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a30:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a34:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a38:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a3b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a3f:	74 13                	je     804a54 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a41:	31 c0                	xor    %eax,%eax
+  804a43:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a48:	48 63 d0             	movslq %eax,%rdx
+  804a4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4f:	48 01 d0             	add    %rdx,%rax
+  804a52:	eb 37                	jmp    804a8b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a54:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a59:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a5e:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a63:	77 ba                	ja     804a1f <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a65:	eb 13                	jmp    804a7a <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a6b:	0f b6 00             	movzbl (%rax),%eax
+  804a6e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a71:	38 d0                	cmp    %dl,%al
+  804a73:	74 11                	je     804a86 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a75:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a7e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a82:	72 e3                	jb     804a67 <memfind+0xbd>
+  804a84:	eb 01                	jmp    804a87 <memfind+0xdd>
+      break;
+  804a86:	90                   	nop
+  return (void *)s;
+  804a87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a8b:	c9                   	leave
+  804a8c:	c3                   	ret
+
+0000000000804a8d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a8d:	55                   	push   %rbp
+  804a8e:	48 89 e5             	mov    %rsp,%rbp
+  804a91:	48 83 ec 38          	sub    $0x38,%rsp
+  804a95:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a99:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a9d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804aa0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804aa7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804aae:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804aaf:	eb 05                	jmp    804ab6 <strtol+0x29>
+    s++;
+  804ab1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ab6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aba:	0f b6 00             	movzbl (%rax),%eax
+  804abd:	3c 20                	cmp    $0x20,%al
+  804abf:	74 f0                	je     804ab1 <strtol+0x24>
+  804ac1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac5:	0f b6 00             	movzbl (%rax),%eax
+  804ac8:	3c 09                	cmp    $0x9,%al
+  804aca:	74 e5                	je     804ab1 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804acc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad0:	0f b6 00             	movzbl (%rax),%eax
+  804ad3:	3c 2b                	cmp    $0x2b,%al
+  804ad5:	75 07                	jne    804ade <strtol+0x51>
+    s++;
+  804ad7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804adc:	eb 17                	jmp    804af5 <strtol+0x68>
+  else if (*s == '-')
+  804ade:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae2:	0f b6 00             	movzbl (%rax),%eax
+  804ae5:	3c 2d                	cmp    $0x2d,%al
+  804ae7:	75 0c                	jne    804af5 <strtol+0x68>
+    s++, neg = 1;
+  804ae9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804aee:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804af5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804af9:	74 06                	je     804b01 <strtol+0x74>
+  804afb:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804aff:	75 28                	jne    804b29 <strtol+0x9c>
+  804b01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b05:	0f b6 00             	movzbl (%rax),%eax
+  804b08:	3c 30                	cmp    $0x30,%al
+  804b0a:	75 1d                	jne    804b29 <strtol+0x9c>
+  804b0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b10:	48 83 c0 01          	add    $0x1,%rax
+  804b14:	0f b6 00             	movzbl (%rax),%eax
+  804b17:	3c 78                	cmp    $0x78,%al
+  804b19:	75 0e                	jne    804b29 <strtol+0x9c>
+    s += 2, base = 16;
+  804b1b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b20:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b27:	eb 2c                	jmp    804b55 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b29:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b2d:	75 19                	jne    804b48 <strtol+0xbb>
+  804b2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b33:	0f b6 00             	movzbl (%rax),%eax
+  804b36:	3c 30                	cmp    $0x30,%al
+  804b38:	75 0e                	jne    804b48 <strtol+0xbb>
+    s++, base = 8;
+  804b3a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b3f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b46:	eb 0d                	jmp    804b55 <strtol+0xc8>
+  else if (base == 0)
+  804b48:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b4c:	75 07                	jne    804b55 <strtol+0xc8>
+    base = 10;
+  804b4e:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b59:	0f b6 00             	movzbl (%rax),%eax
+  804b5c:	3c 2f                	cmp    $0x2f,%al
+  804b5e:	7e 1d                	jle    804b7d <strtol+0xf0>
+  804b60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b64:	0f b6 00             	movzbl (%rax),%eax
+  804b67:	3c 39                	cmp    $0x39,%al
+  804b69:	7f 12                	jg     804b7d <strtol+0xf0>
+      dig = *s - '0';
+  804b6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6f:	0f b6 00             	movzbl (%rax),%eax
+  804b72:	0f be c0             	movsbl %al,%eax
+  804b75:	83 e8 30             	sub    $0x30,%eax
+  804b78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b7b:	eb 4e                	jmp    804bcb <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b81:	0f b6 00             	movzbl (%rax),%eax
+  804b84:	3c 60                	cmp    $0x60,%al
+  804b86:	7e 1d                	jle    804ba5 <strtol+0x118>
+  804b88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8c:	0f b6 00             	movzbl (%rax),%eax
+  804b8f:	3c 7a                	cmp    $0x7a,%al
+  804b91:	7f 12                	jg     804ba5 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804b93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b97:	0f b6 00             	movzbl (%rax),%eax
+  804b9a:	0f be c0             	movsbl %al,%eax
+  804b9d:	83 e8 57             	sub    $0x57,%eax
+  804ba0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ba3:	eb 26                	jmp    804bcb <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804ba5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba9:	0f b6 00             	movzbl (%rax),%eax
+  804bac:	3c 40                	cmp    $0x40,%al
+  804bae:	7e 47                	jle    804bf7 <strtol+0x16a>
+  804bb0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb4:	0f b6 00             	movzbl (%rax),%eax
+  804bb7:	3c 5a                	cmp    $0x5a,%al
+  804bb9:	7f 3c                	jg     804bf7 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bbf:	0f b6 00             	movzbl (%rax),%eax
+  804bc2:	0f be c0             	movsbl %al,%eax
+  804bc5:	83 e8 37             	sub    $0x37,%eax
+  804bc8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bce:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bd1:	7d 23                	jge    804bf6 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bd3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bd8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bdb:	48 98                	cltq
+  804bdd:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804be2:	48 89 c2             	mov    %rax,%rdx
+  804be5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be8:	48 98                	cltq
+  804bea:	48 01 d0             	add    %rdx,%rax
+  804bed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804bf1:	e9 5f ff ff ff       	jmp    804b55 <strtol+0xc8>
+      break;
+  804bf6:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804bf7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804bfc:	74 0b                	je     804c09 <strtol+0x17c>
+    *endptr = (char *)s;
+  804bfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c02:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c06:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c09:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c0d:	74 09                	je     804c18 <strtol+0x18b>
+  804c0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c13:	48 f7 d8             	neg    %rax
+  804c16:	eb 04                	jmp    804c1c <strtol+0x18f>
+  804c18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c1c:	c9                   	leave
+  804c1d:	c3                   	ret
+
+0000000000804c1e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c1e:	55                   	push   %rbp
+  804c1f:	48 89 e5             	mov    %rsp,%rbp
+  804c22:	48 83 ec 20          	sub    $0x20,%rsp
+  804c26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c2a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c2e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c36:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3e:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c45:	48 89 c7             	mov    %rax,%rdi
+  804c48:	48 b8 56 4c 80 00 00 	movabs $0x804c56,%rax
+  804c4f:	00 00 00 
+  804c52:	ff d0                	call   *%rax
+}
+  804c54:	c9                   	leave
+  804c55:	c3                   	ret
+
+0000000000804c56 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c56:	55                   	push   %rbp
+  804c57:	48 89 e5             	mov    %rsp,%rbp
+  804c5a:	48 83 ec 30          	sub    $0x30,%rsp
+  804c5e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c62:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c66:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c6a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c6e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c73:	75 0e                	jne    804c83 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c75:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c7c:	00 00 00 
+  804c7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c83:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c88:	75 18                	jne    804ca2 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c8e:	48 89 c7             	mov    %rax,%rdi
+  804c91:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  804c98:	00 00 00 
+  804c9b:	ff d0                	call   *%rax
+  804c9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ca0:	eb 1d                	jmp    804cbf <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804ca2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ca6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804caa:	48 89 d6             	mov    %rdx,%rsi
+  804cad:	48 89 c7             	mov    %rax,%rdi
+  804cb0:	48 b8 27 06 80 00 00 	movabs $0x800627,%rax
+  804cb7:	00 00 00 
+  804cba:	ff d0                	call   *%rax
+  804cbc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cbf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cc3:	79 2a                	jns    804cef <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cc5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cca:	74 0a                	je     804cd6 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ccc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cd6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cdb:	74 0a                	je     804ce7 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ce1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804ce7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cea:	e9 aa 00 00 00       	jmp    804d99 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804cef:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf4:	74 36                	je     804d2c <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804cf6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804cfd:	00 00 00 
+  804d00:	8b 40 04             	mov    0x4(%rax),%eax
+  804d03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d08:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d0f:	00 00 00 
+  804d12:	48 98                	cltq
+  804d14:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d1b:	48 01 d0             	add    %rdx,%rax
+  804d1e:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d24:	8b 10                	mov    (%rax),%edx
+  804d26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d2a:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d2c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d31:	74 36                	je     804d69 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d33:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d3a:	00 00 00 
+  804d3d:	8b 40 04             	mov    0x4(%rax),%eax
+  804d40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d45:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d4c:	00 00 00 
+  804d4f:	48 98                	cltq
+  804d51:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d58:	48 01 d0             	add    %rdx,%rax
+  804d5b:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d61:	8b 10                	mov    (%rax),%edx
+  804d63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d67:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d69:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d70:	00 00 00 
+  804d73:	8b 40 04             	mov    0x4(%rax),%eax
+  804d76:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d7b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d82:	00 00 00 
+  804d85:	48 98                	cltq
+  804d87:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d8e:	48 01 d0             	add    %rdx,%rax
+  804d91:	48 05 20 01 00 00    	add    $0x120,%rax
+  804d97:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804d99:	c9                   	leave
+  804d9a:	c3                   	ret
+
+0000000000804d9b <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804d9b:	55                   	push   %rbp
+  804d9c:	48 89 e5             	mov    %rsp,%rbp
+  804d9f:	48 83 ec 30          	sub    $0x30,%rsp
+  804da3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804da6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804da9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dad:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804db0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804db5:	75 5e                	jne    804e15 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804db7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dbe:	00 00 00 
+  804dc1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dc5:	eb 4e                	jmp    804e15 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dc7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dcb:	79 3c                	jns    804e09 <ipc_send+0x6e>
+  804dcd:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dd1:	74 36                	je     804e09 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dd6:	89 c1                	mov    %eax,%ecx
+  804dd8:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804ddf:	00 00 00 
+  804de2:	48 89 c2             	mov    %rax,%rdx
+  804de5:	be 54 00 00 00       	mov    $0x54,%esi
+  804dea:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804df1:	00 00 00 
+  804df4:	48 89 c7             	mov    %rax,%rdi
+  804df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfc:	49 b8 31 2f 80 00 00 	movabs $0x802f31,%r8
+  804e03:	00 00 00 
+  804e06:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e09:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  804e10:	00 00 00 
+  804e13:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e15:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e18:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e1b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e22:	89 c7                	mov    %eax,%edi
+  804e24:	48 b8 8a 05 80 00 00 	movabs $0x80058a,%rax
+  804e2b:	00 00 00 
+  804e2e:	ff d0                	call   *%rax
+  804e30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e37:	75 8e                	jne    804dc7 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e39:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  804e40:	00 00 00 
+  804e43:	ff d0                	call   *%rax
+}
+  804e45:	90                   	nop
+  804e46:	c9                   	leave
+  804e47:	c3                   	ret
+
+0000000000804e48 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e48:	55                   	push   %rbp
+  804e49:	48 89 e5             	mov    %rsp,%rbp
+  804e4c:	48 83 ec 18          	sub    $0x18,%rsp
+  804e50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e53:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e5a:	eb 4d                	jmp    804ea9 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e5c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e63:	00 00 00 
+  804e66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e69:	48 98                	cltq
+  804e6b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e72:	48 01 d0             	add    %rdx,%rax
+  804e75:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e7b:	8b 00                	mov    (%rax),%eax
+  804e7d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e80:	75 23                	jne    804ea5 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e82:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e89:	00 00 00 
+  804e8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e8f:	48 98                	cltq
+  804e91:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e98:	48 01 d0             	add    %rdx,%rax
+  804e9b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ea1:	8b 00                	mov    (%rax),%eax
+  804ea3:	eb 12                	jmp    804eb7 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ea5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ea9:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804eb0:	7e aa                	jle    804e5c <ipc_find_env+0x14>
+  return 0;
+  804eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eb7:	c9                   	leave
+  804eb8:	c3                   	ret
+
+0000000000804eb9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804eb9:	55                   	push   %rbp
+  804eba:	48 89 e5             	mov    %rsp,%rbp
+  804ebd:	48 83 ec 18          	sub    $0x18,%rsp
+  804ec1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ec5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec9:	48 c1 e8 27          	shr    $0x27,%rax
+  804ecd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ed2:	48 89 c2             	mov    %rax,%rdx
+  804ed5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804edc:	01 00 00 
+  804edf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ee3:	83 e0 01             	and    $0x1,%eax
+  804ee6:	48 85 c0             	test   %rax,%rax
+  804ee9:	74 63                	je     804f4e <pageref+0x95>
+  804eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eef:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804ef3:	48 89 c2             	mov    %rax,%rdx
+  804ef6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804efd:	01 00 00 
+  804f00:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f04:	83 e0 01             	and    $0x1,%eax
+  804f07:	48 85 c0             	test   %rax,%rax
+  804f0a:	74 42                	je     804f4e <pageref+0x95>
+  804f0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f10:	48 c1 e8 15          	shr    $0x15,%rax
+  804f14:	48 89 c2             	mov    %rax,%rdx
+  804f17:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f1e:	01 00 00 
+  804f21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f25:	83 e0 01             	and    $0x1,%eax
+  804f28:	48 85 c0             	test   %rax,%rax
+  804f2b:	74 21                	je     804f4e <pageref+0x95>
+  804f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f31:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f35:	48 89 c2             	mov    %rax,%rdx
+  804f38:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f3f:	01 00 00 
+  804f42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f46:	83 e0 01             	and    $0x1,%eax
+  804f49:	48 85 c0             	test   %rax,%rax
+  804f4c:	75 07                	jne    804f55 <pageref+0x9c>
+    return 0;
+  804f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f53:	eb 53                	jmp    804fa8 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f59:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f5d:	48 89 c2             	mov    %rax,%rdx
+  804f60:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f67:	01 00 00 
+  804f6a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f6e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f76:	83 e0 01             	and    $0x1,%eax
+  804f79:	48 85 c0             	test   %rax,%rax
+  804f7c:	75 07                	jne    804f85 <pageref+0xcc>
+    return 0;
+  804f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f83:	eb 23                	jmp    804fa8 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f89:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f8d:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804f94:	00 00 00 
+  804f97:	48 c1 e0 04          	shl    $0x4,%rax
+  804f9b:	48 01 d0             	add    %rdx,%rax
+  804f9e:	48 83 c0 08          	add    $0x8,%rax
+  804fa2:	0f b7 00             	movzwl (%rax),%eax
+  804fa5:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fa8:	c9                   	leave
+  804fa9:	c3                   	ret
+  804faa:	66 90                	xchg   %ax,%ax
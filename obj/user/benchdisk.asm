@@ -0,0 +1,8870 @@
+
+obj/user/benchdisk:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 36 07 00 00       	call   800762 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <drop_cache>:
+static char buf[BUFSIZE];
+
+// Shrink the block cache as far as the server lets us and grow it
+// back, so that the file has to come from the disk again.
+static void
+drop_cache(uint32_t capacity) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uint32_t n;
+
+  for (n = 1; n < capacity && fs_set_cache(n) < 0; n *= 2)
+  80003d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  800044:	eb 03                	jmp    800049 <drop_cache+0x17>
+  800046:	d1 65 fc             	shll   -0x4(%rbp)
+  800049:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80004c:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  80004f:	73 15                	jae    800066 <drop_cache+0x34>
+  800051:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800054:	89 c7                	mov    %eax,%edi
+  800056:	48 b8 52 43 80 00 00 	movabs $0x804352,%rax
+  80005d:	00 00 00 
+  800060:	ff d0                	call   *%rax
+  800062:	85 c0                	test   %eax,%eax
+  800064:	78 e0                	js     800046 <drop_cache+0x14>
+    ;
+  fs_set_cache(capacity);
+  800066:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800069:	89 c7                	mov    %eax,%edi
+  80006b:	48 b8 52 43 80 00 00 	movabs $0x804352,%rax
+  800072:	00 00 00 
+  800075:	ff d0                	call   *%rax
+}
+  800077:	90                   	nop
+  800078:	c9                   	leave
+  800079:	c3                   	ret
+
+000000000080007a <run>:
+
+// Average cycles per KiB to read the whole file, or to write it over
+// and sync it, starting with nothing cached.
+static uint64_t
+run(size_t kib, bool writing, uint32_t capacity) {
+  80007a:	55                   	push   %rbp
+  80007b:	48 89 e5             	mov    %rsp,%rbp
+  80007e:	48 83 ec 60          	sub    $0x60,%rsp
+  800082:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800086:	89 f0                	mov    %esi,%eax
+  800088:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80008b:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  uint64_t start;
+  size_t done;
+  ssize_t n;
+  int fd;
+
+  if ((fd = open(PATH, O_RDWR)) < 0)
+  80008e:	be 02 00 00 00       	mov    $0x2,%esi
+  800093:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  80009a:	00 00 00 
+  80009d:	48 89 c7             	mov    %rax,%rdi
+  8000a0:	48 b8 81 3e 80 00 00 	movabs $0x803e81,%rax
+  8000a7:	00 00 00 
+  8000aa:	ff d0                	call   *%rax
+  8000ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8000af:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8000b3:	79 44                	jns    8000f9 <run+0x7f>
+    panic("open %s: %i", PATH, fd);
+  8000b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000b8:	41 89 c0             	mov    %eax,%r8d
+  8000bb:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  8000c2:	00 00 00 
+  8000c5:	48 89 c1             	mov    %rax,%rcx
+  8000c8:	48 b8 ef 59 80 00 00 	movabs $0x8059ef,%rax
+  8000cf:	00 00 00 
+  8000d2:	48 89 c2             	mov    %rax,%rdx
+  8000d5:	be 24 00 00 00       	mov    $0x24,%esi
+  8000da:	48 b8 fb 59 80 00 00 	movabs $0x8059fb,%rax
+  8000e1:	00 00 00 
+  8000e4:	48 89 c7             	mov    %rax,%rdi
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	49 b9 09 08 80 00 00 	movabs $0x800809,%r9
+  8000f3:	00 00 00 
+  8000f6:	41 ff d1             	call   *%r9
+  sync();
+  8000f9:	48 b8 da 42 80 00 00 	movabs $0x8042da,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+  drop_cache(capacity);
+  800105:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800108:	89 c7                	mov    %eax,%edi
+  80010a:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800111:	00 00 00 
+  800114:	ff d0                	call   *%rax
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  800116:	0f 31                	rdtsc
+  800118:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80011b:	89 55 c8             	mov    %edx,-0x38(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80011e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800121:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800124:	48 c1 e2 20          	shl    $0x20,%rdx
+  800128:	48 09 d0             	or     %rdx,%rax
+  80012b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  return res;
+  80012f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+
+  start = read_tsc();
+  800133:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (done = 0; done < kib * 1024; done += n) {
+  800137:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80013e:	00 
+  80013f:	e9 ee 00 00 00       	jmp    800232 <run+0x1b8>
+    n = MIN(BUFSIZE, kib * 1024 - done);
+  800144:	c7 45 e4 00 00 01 00 	movl   $0x10000,-0x1c(%rbp)
+  80014b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80014f:	48 c1 e0 0a          	shl    $0xa,%rax
+  800153:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  800157:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80015b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80015e:	48 63 d0             	movslq %eax,%rdx
+  800161:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800165:	48 39 c2             	cmp    %rax,%rdx
+  800168:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80016c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if ((n = writing ? write(fd, buf, n) : readn(fd, buf, n)) <= 0)
+  800170:	80 7d a4 00          	cmpb   $0x0,-0x5c(%rbp)
+  800174:	74 24                	je     80019a <run+0x120>
+  800176:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80017a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80017d:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  800184:	00 00 00 
+  800187:	48 89 ce             	mov    %rcx,%rsi
+  80018a:	89 c7                	mov    %eax,%edi
+  80018c:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  800193:	00 00 00 
+  800196:	ff d0                	call   *%rax
+  800198:	eb 22                	jmp    8001bc <run+0x142>
+  80019a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80019e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8001a1:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8001a8:	00 00 00 
+  8001ab:	48 89 ce             	mov    %rcx,%rsi
+  8001ae:	89 c7                	mov    %eax,%edi
+  8001b0:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8001c0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001c5:	7f 63                	jg     80022a <run+0x1b0>
+      panic("%s %s: %i", writing ? "write" : "read", PATH, (int)n);
+  8001c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001cb:	89 c2                	mov    %eax,%edx
+  8001cd:	80 7d a4 00          	cmpb   $0x0,-0x5c(%rbp)
+  8001d1:	74 0c                	je     8001df <run+0x165>
+  8001d3:	48 b8 0c 5a 80 00 00 	movabs $0x805a0c,%rax
+  8001da:	00 00 00 
+  8001dd:	eb 0a                	jmp    8001e9 <run+0x16f>
+  8001df:	48 b8 12 5a 80 00 00 	movabs $0x805a12,%rax
+  8001e6:	00 00 00 
+  8001e9:	41 89 d1             	mov    %edx,%r9d
+  8001ec:	49 b8 e0 59 80 00 00 	movabs $0x8059e0,%r8
+  8001f3:	00 00 00 
+  8001f6:	48 89 c1             	mov    %rax,%rcx
+  8001f9:	48 b8 17 5a 80 00 00 	movabs $0x805a17,%rax
+  800200:	00 00 00 
+  800203:	48 89 c2             	mov    %rax,%rdx
+  800206:	be 2c 00 00 00       	mov    $0x2c,%esi
+  80020b:	48 b8 fb 59 80 00 00 	movabs $0x8059fb,%rax
+  800212:	00 00 00 
+  800215:	48 89 c7             	mov    %rax,%rdi
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	49 ba 09 08 80 00 00 	movabs $0x800809,%r10
+  800224:	00 00 00 
+  800227:	41 ff d2             	call   *%r10
+  for (done = 0; done < kib * 1024; done += n) {
+  80022a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80022e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  800232:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800236:	48 c1 e0 0a          	shl    $0xa,%rax
+  80023a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80023e:	0f 82 00 ff ff ff    	jb     800144 <run+0xca>
+  }
+  if (writing)
+  800244:	80 7d a4 00          	cmpb   $0x0,-0x5c(%rbp)
+  800248:	74 0c                	je     800256 <run+0x1dc>
+    sync();
+  80024a:	48 b8 da 42 80 00 00 	movabs $0x8042da,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  __asm __volatile("rdtsc"
+  800256:	0f 31                	rdtsc
+  800258:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  80025b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80025e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800261:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800264:	48 c1 e2 20          	shl    $0x20,%rdx
+  800268:	48 09 d0             	or     %rdx,%rax
+  80026b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  return res;
+  80026f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  start = read_tsc() - start;
+  800273:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  800277:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  close(fd);
+  80027b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80027e:	89 c7                	mov    %eax,%edi
+  800280:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+  return start / kib;
+  80028c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800290:	ba 00 00 00 00       	mov    $0x0,%edx
+  800295:	48 f7 75 a8          	divq   -0x58(%rbp)
+}
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <umain>:
+
+void
+umain(int argc, char **argv) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 81 ec a0 01 00 00 	sub    $0x1a0,%rsp
+  8002a6:	89 bd 6c fe ff ff    	mov    %edi,-0x194(%rbp)
+  8002ac:	48 89 b5 60 fe ff ff 	mov    %rsi,-0x1a0(%rbp)
+  struct Fsret_stats st, before, after;
+  size_t kib = argc > 1 ? strtol(argv[1], NULL, 0) : 512, i;
+  8002b3:	83 bd 6c fe ff ff 01 	cmpl   $0x1,-0x194(%rbp)
+  8002ba:	7e 29                	jle    8002e5 <umain+0x4a>
+  8002bc:	48 8b 85 60 fe ff ff 	mov    -0x1a0(%rbp),%rax
+  8002c3:	48 83 c0 08          	add    $0x8,%rax
+  8002c7:	48 8b 00             	mov    (%rax),%rax
+  8002ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d4:	48 89 c7             	mov    %rax,%rdi
+  8002d7:	48 b8 65 23 80 00 00 	movabs $0x802365,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+  8002e3:	eb 05                	jmp    8002ea <umain+0x4f>
+  8002e5:	b8 00 02 00 00       	mov    $0x200,%eax
+  8002ea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  uint64_t rd, wr;
+  int fd, r, on;
+
+  if (!kib) {
+  8002ee:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8002f3:	75 23                	jne    800318 <umain+0x7d>
+    printf("usage: benchdisk [KiB]\n");
+  8002f5:	48 b8 21 5a 80 00 00 	movabs $0x805a21,%rax
+  8002fc:	00 00 00 
+  8002ff:	48 89 c7             	mov    %rax,%rdi
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+  800307:	48 ba 1c 46 80 00 00 	movabs $0x80461c,%rdx
+  80030e:	00 00 00 
+  800311:	ff d2                	call   *%rdx
+    return;
+  800313:	e9 48 04 00 00       	jmp    800760 <umain+0x4c5>
+  }
+  if ((r = fs_stats(&st)) < 0)
+  800318:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80031f:	48 89 c7             	mov    %rax,%rdi
+  800322:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+  80032e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800331:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800335:	79 36                	jns    80036d <umain+0xd2>
+    panic("fs_stats: %i", r);
+  800337:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80033a:	89 c1                	mov    %eax,%ecx
+  80033c:	48 b8 39 5a 80 00 00 	movabs $0x805a39,%rax
+  800343:	00 00 00 
+  800346:	48 89 c2             	mov    %rax,%rdx
+  800349:	be 41 00 00 00       	mov    $0x41,%esi
+  80034e:	48 b8 fb 59 80 00 00 	movabs $0x8059fb,%rax
+  800355:	00 00 00 
+  800358:	48 89 c7             	mov    %rax,%rdi
+  80035b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800360:	49 b8 09 08 80 00 00 	movabs $0x800809,%r8
+  800367:	00 00 00 
+  80036a:	41 ff d0             	call   *%r8
+  for (i = 0; i < BUFSIZE; i++)
+  80036d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800374:	00 
+  800375:	eb 1e                	jmp    800395 <umain+0xfa>
+    buf[i] = i;
+  800377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80037b:	89 c1                	mov    %eax,%ecx
+  80037d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800384:	00 00 00 
+  800387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80038b:	48 01 d0             	add    %rdx,%rax
+  80038e:	88 08                	mov    %cl,(%rax)
+  for (i = 0; i < BUFSIZE; i++)
+  800390:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800395:	48 81 7d f8 ff ff 00 	cmpq   $0xffff,-0x8(%rbp)
+  80039c:	00 
+  80039d:	76 d8                	jbe    800377 <umain+0xdc>
+  if ((fd = open(PATH, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  80039f:	be 02 03 00 00       	mov    $0x302,%esi
+  8003a4:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  8003ab:	00 00 00 
+  8003ae:	48 89 c7             	mov    %rax,%rdi
+  8003b1:	48 b8 81 3e 80 00 00 	movabs $0x803e81,%rax
+  8003b8:	00 00 00 
+  8003bb:	ff d0                	call   *%rax
+  8003bd:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8003c0:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8003c4:	79 44                	jns    80040a <umain+0x16f>
+    panic("open %s: %i", PATH, fd);
+  8003c6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003c9:	41 89 c0             	mov    %eax,%r8d
+  8003cc:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  8003d3:	00 00 00 
+  8003d6:	48 89 c1             	mov    %rax,%rcx
+  8003d9:	48 b8 ef 59 80 00 00 	movabs $0x8059ef,%rax
+  8003e0:	00 00 00 
+  8003e3:	48 89 c2             	mov    %rax,%rdx
+  8003e6:	be 45 00 00 00       	mov    $0x45,%esi
+  8003eb:	48 b8 fb 59 80 00 00 	movabs $0x8059fb,%rax
+  8003f2:	00 00 00 
+  8003f5:	48 89 c7             	mov    %rax,%rdi
+  8003f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fd:	49 b9 09 08 80 00 00 	movabs $0x800809,%r9
+  800404:	00 00 00 
+  800407:	41 ff d1             	call   *%r9
+  for (i = 0; i < kib * 1024; i += r) {
+  80040a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800411:	00 
+  800412:	e9 9c 00 00 00       	jmp    8004b3 <umain+0x218>
+    if ((r = write(fd, buf, MIN(BUFSIZE, kib * 1024 - i))) <= 0)
+  800417:	c7 45 cc 00 00 01 00 	movl   $0x10000,-0x34(%rbp)
+  80041e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800422:	48 c1 e0 0a          	shl    $0xa,%rax
+  800426:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80042a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80042e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800431:	48 63 d0             	movslq %eax,%rdx
+  800434:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800438:	48 39 c2             	cmp    %rax,%rdx
+  80043b:	48 0f 47 d0          	cmova  %rax,%rdx
+  80043f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800442:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  800449:	00 00 00 
+  80044c:	48 89 ce             	mov    %rcx,%rsi
+  80044f:	89 c7                	mov    %eax,%edi
+  800451:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+  80045d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800460:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800464:	7f 44                	jg     8004aa <umain+0x20f>
+      panic("write %s: %i", PATH, r);
+  800466:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800469:	41 89 c0             	mov    %eax,%r8d
+  80046c:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  800473:	00 00 00 
+  800476:	48 89 c1             	mov    %rax,%rcx
+  800479:	48 b8 46 5a 80 00 00 	movabs $0x805a46,%rax
+  800480:	00 00 00 
+  800483:	48 89 c2             	mov    %rax,%rdx
+  800486:	be 48 00 00 00       	mov    $0x48,%esi
+  80048b:	48 b8 fb 59 80 00 00 	movabs $0x8059fb,%rax
+  800492:	00 00 00 
+  800495:	48 89 c7             	mov    %rax,%rdi
+  800498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049d:	49 b9 09 08 80 00 00 	movabs $0x800809,%r9
+  8004a4:	00 00 00 
+  8004a7:	41 ff d1             	call   *%r9
+  for (i = 0; i < kib * 1024; i += r) {
+  8004aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004ad:	48 98                	cltq
+  8004af:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8004b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004b7:	48 c1 e0 0a          	shl    $0xa,%rax
+  8004bb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8004bf:	0f 82 52 ff ff ff    	jb     800417 <umain+0x17c>
+  }
+  close(fd);
+  8004c5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004c8:	89 c7                	mov    %eax,%edi
+  8004ca:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  8004d1:	00 00 00 
+  8004d4:	ff d0                	call   *%rax
+
+  if (st.ret_disk_virtio) {
+  8004d6:	8b 45 90             	mov    -0x70(%rbp),%eax
+  8004d9:	85 c0                	test   %eax,%eax
+  8004db:	0f 84 dc 00 00 00    	je     8005bd <umain+0x322>
+    fs_stats(&before);
+  8004e1:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8004e8:	48 89 c7             	mov    %rax,%rdi
+  8004eb:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  8004f2:	00 00 00 
+  8004f5:	ff d0                	call   *%rax
+    rd = run(kib, 0, st.ret_bc_capacity);
+  8004f7:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8004fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800501:	be 00 00 00 00       	mov    $0x0,%esi
+  800506:	48 89 c7             	mov    %rax,%rdi
+  800509:	48 b8 7a 00 80 00 00 	movabs $0x80007a,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+  800515:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    wr = run(kib, 1, st.ret_bc_capacity);
+  800519:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80051f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800523:	be 01 00 00 00       	mov    $0x1,%esi
+  800528:	48 89 c7             	mov    %rax,%rdi
+  80052b:	48 b8 7a 00 80 00 00 	movabs $0x80007a,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+  800537:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    fs_stats(&after);
+  80053b:	48 8d 85 70 fe ff ff 	lea    -0x190(%rbp),%rax
+  800542:	48 89 c7             	mov    %rax,%rdi
+  800545:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+    cprintf("virtio-blk: %ld KiB: read %ld, write %ld cycles per KiB (%ld requests, at most %d in flight)\n",
+  800551:	8b b5 d0 fe ff ff    	mov    -0x130(%rbp),%esi
+            (long)kib, (long)rd, (long)wr,
+            (long)(after.ret_virtio_reqs - before.ret_virtio_reqs), after.ret_virtio_max_inflight);
+  800557:	48 8b 95 c8 fe ff ff 	mov    -0x138(%rbp),%rdx
+  80055e:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  800565:	48 29 c2             	sub    %rax,%rdx
+    cprintf("virtio-blk: %ld KiB: read %ld, write %ld cycles per KiB (%ld requests, at most %d in flight)\n",
+  800568:	48 89 d7             	mov    %rdx,%rdi
+  80056b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80056f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800573:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800577:	41 89 f1             	mov    %esi,%r9d
+  80057a:	49 89 f8             	mov    %rdi,%r8
+  80057d:	48 89 c6             	mov    %rax,%rsi
+  800580:	48 b8 58 5a 80 00 00 	movabs $0x805a58,%rax
+  800587:	00 00 00 
+  80058a:	48 89 c7             	mov    %rax,%rdi
+  80058d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800592:	49 ba 28 0a 80 00 00 	movabs $0x800a28,%r10
+  800599:	00 00 00 
+  80059c:	41 ff d2             	call   *%r10
+    remove(PATH);
+  80059f:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  8005a6:	00 00 00 
+  8005a9:	48 89 c7             	mov    %rax,%rdi
+  8005ac:	48 b8 75 42 80 00 00 	movabs $0x804275,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+    return;
+  8005b8:	e9 a3 01 00 00       	jmp    800760 <umain+0x4c5>
+  }
+
+  for (on = 1; on >= 0; on--) {
+  8005bd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%rbp)
+  8005c4:	e9 5b 01 00 00       	jmp    800724 <umain+0x489>
+    if ((r = fs_set_dma(on)) < 0) {
+  8005c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005cd:	0f 95 c0             	setne  %al
+  8005d0:	0f b6 c0             	movzbl %al,%eax
+  8005d3:	89 c7                	mov    %eax,%edi
+  8005d5:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  8005dc:	00 00 00 
+  8005df:	ff d0                	call   *%rax
+  8005e1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8005e4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005e8:	79 45                	jns    80062f <umain+0x394>
+      cprintf("%s: %i\n", on ? "DMA" : "PIO", r);
+  8005ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005ee:	74 0c                	je     8005fc <umain+0x361>
+  8005f0:	48 b8 b6 5a 80 00 00 	movabs $0x805ab6,%rax
+  8005f7:	00 00 00 
+  8005fa:	eb 0a                	jmp    800606 <umain+0x36b>
+  8005fc:	48 b8 ba 5a 80 00 00 	movabs $0x805aba,%rax
+  800603:	00 00 00 
+  800606:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800609:	48 89 c6             	mov    %rax,%rsi
+  80060c:	48 b8 be 5a 80 00 00 	movabs $0x805abe,%rax
+  800613:	00 00 00 
+  800616:	48 89 c7             	mov    %rax,%rdi
+  800619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061e:	48 b9 28 0a 80 00 00 	movabs $0x800a28,%rcx
+  800625:	00 00 00 
+  800628:	ff d1                	call   *%rcx
+      continue;
+  80062a:	e9 f1 00 00 00       	jmp    800720 <umain+0x485>
+    }
+    fs_stats(&before);
+  80062f:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800636:	48 89 c7             	mov    %rax,%rdi
+  800639:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  800640:	00 00 00 
+  800643:	ff d0                	call   *%rax
+    rd = run(kib, 0, st.ret_bc_capacity);
+  800645:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80064b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80064f:	be 00 00 00 00       	mov    $0x0,%esi
+  800654:	48 89 c7             	mov    %rax,%rdi
+  800657:	48 b8 7a 00 80 00 00 	movabs $0x80007a,%rax
+  80065e:	00 00 00 
+  800661:	ff d0                	call   *%rax
+  800663:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    wr = run(kib, 1, st.ret_bc_capacity);
+  800667:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80066d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800671:	be 01 00 00 00       	mov    $0x1,%esi
+  800676:	48 89 c7             	mov    %rax,%rdi
+  800679:	48 b8 7a 00 80 00 00 	movabs $0x80007a,%rax
+  800680:	00 00 00 
+  800683:	ff d0                	call   *%rax
+  800685:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    fs_stats(&after);
+  800689:	48 8d 85 70 fe ff ff 	lea    -0x190(%rbp),%rax
+  800690:	48 89 c7             	mov    %rax,%rdi
+  800693:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  80069a:	00 00 00 
+  80069d:	ff d0                	call   *%rax
+    cprintf("%s: %ld KiB: read %ld, write %ld cycles per KiB (%ld DMA, %ld PIO transfers)\n",
+            on ? "DMA" : "PIO", (long)kib, (long)rd, (long)wr,
+            (long)(after.ret_ide_dma_xfers - before.ret_ide_dma_xfers),
+            (long)(after.ret_ide_pio_xfers - before.ret_ide_pio_xfers));
+  80069f:	48 8b 95 c0 fe ff ff 	mov    -0x140(%rbp),%rdx
+  8006a6:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+  8006ad:	48 29 c2             	sub    %rax,%rdx
+    cprintf("%s: %ld KiB: read %ld, write %ld cycles per KiB (%ld DMA, %ld PIO transfers)\n",
+  8006b0:	48 89 d7             	mov    %rdx,%rdi
+            (long)(after.ret_ide_dma_xfers - before.ret_ide_dma_xfers),
+  8006b3:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8006ba:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8006c1:	48 29 c2             	sub    %rax,%rdx
+    cprintf("%s: %ld KiB: read %ld, write %ld cycles per KiB (%ld DMA, %ld PIO transfers)\n",
+  8006c4:	49 89 d0             	mov    %rdx,%r8
+  8006c7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8006cb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8006cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006d7:	74 0c                	je     8006e5 <umain+0x44a>
+  8006d9:	48 b8 b6 5a 80 00 00 	movabs $0x805ab6,%rax
+  8006e0:	00 00 00 
+  8006e3:	eb 0a                	jmp    8006ef <umain+0x454>
+  8006e5:	48 b8 ba 5a 80 00 00 	movabs $0x805aba,%rax
+  8006ec:	00 00 00 
+  8006ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f3:	57                   	push   %rdi
+  8006f4:	4d 89 c1             	mov    %r8,%r9
+  8006f7:	49 89 f0             	mov    %rsi,%r8
+  8006fa:	48 89 c6             	mov    %rax,%rsi
+  8006fd:	48 b8 c8 5a 80 00 00 	movabs $0x805ac8,%rax
+  800704:	00 00 00 
+  800707:	48 89 c7             	mov    %rax,%rdi
+  80070a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070f:	49 ba 28 0a 80 00 00 	movabs $0x800a28,%r10
+  800716:	00 00 00 
+  800719:	41 ff d2             	call   *%r10
+  80071c:	48 83 c4 10          	add    $0x10,%rsp
+  for (on = 1; on >= 0; on--) {
+  800720:	83 6d f4 01          	subl   $0x1,-0xc(%rbp)
+  800724:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800728:	0f 89 9b fe ff ff    	jns    8005c9 <umain+0x32e>
+  }
+
+  fs_set_dma(st.ret_ide_dma);
+  80072e:	8b 45 94             	mov    -0x6c(%rbp),%eax
+  800731:	85 c0                	test   %eax,%eax
+  800733:	0f 95 c0             	setne  %al
+  800736:	0f b6 c0             	movzbl %al,%eax
+  800739:	89 c7                	mov    %eax,%edi
+  80073b:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  800742:	00 00 00 
+  800745:	ff d0                	call   *%rax
+  remove(PATH);
+  800747:	48 b8 e0 59 80 00 00 	movabs $0x8059e0,%rax
+  80074e:	00 00 00 
+  800751:	48 89 c7             	mov    %rax,%rdi
+  800754:	48 b8 75 42 80 00 00 	movabs $0x804275,%rax
+  80075b:	00 00 00 
+  80075e:	ff d0                	call   *%rax
+}
+  800760:	c9                   	leave
+  800761:	c3                   	ret
+
+0000000000800762 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800762:	55                   	push   %rbp
+  800763:	48 89 e5             	mov    %rsp,%rbp
+  800766:	48 83 ec 20          	sub    $0x20,%rsp
+  80076a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80076d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800771:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800778:	00 00 00 
+  80077b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80077f:	eb 13                	jmp    800794 <libmain+0x32>
+    (*ctor)();
+  800781:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800785:	48 8b 10             	mov    (%rax),%rdx
+  800788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078d:	ff d2                	call   *%rdx
+    ctor++;
+  80078f:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800794:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80079b:	00 00 00 
+  80079e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8007a2:	72 dd                	jb     800781 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8007a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8007a8:	7e 14                	jle    8007be <libmain+0x5c>
+    binaryname = argv[0];
+  8007aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007ae:	48 8b 00             	mov    (%rax),%rax
+  8007b1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8007b8:	00 00 00 
+  8007bb:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8007be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8007c5:	48 89 d6             	mov    %rdx,%rsi
+  8007c8:	89 c7                	mov    %eax,%edi
+  8007ca:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  8007d1:	00 00 00 
+  8007d4:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8007d6:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  8007dd:	00 00 00 
+  8007e0:	ff d0                	call   *%rax
+#endif
+}
+  8007e2:	90                   	nop
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+00000000008007e5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007e5:	55                   	push   %rbp
+  8007e6:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8007e9:	48 b8 7d 32 80 00 00 	movabs $0x80327d,%rax
+  8007f0:	00 00 00 
+  8007f3:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8007f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007fa:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  800801:	00 00 00 
+  800804:	ff d0                	call   *%rax
+}
+  800806:	90                   	nop
+  800807:	5d                   	pop    %rbp
+  800808:	c3                   	ret
+
+0000000000800809 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800809:	55                   	push   %rbp
+  80080a:	48 89 e5             	mov    %rsp,%rbp
+  80080d:	53                   	push   %rbx
+  80080e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800815:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80081c:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800822:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800829:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800830:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800837:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80083e:	84 c0                	test   %al,%al
+  800840:	74 23                	je     800865 <_panic+0x5c>
+  800842:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800849:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80084d:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800851:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800855:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800859:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80085d:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800861:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800865:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80086c:	00 00 00 
+  80086f:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800876:	00 00 00 
+  800879:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80087d:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800884:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80088b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800892:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800899:	00 00 00 
+  80089c:	48 8b 18             	mov    (%rax),%rbx
+  80089f:	48 b8 2d 27 80 00 00 	movabs $0x80272d,%rax
+  8008a6:	00 00 00 
+  8008a9:	ff d0                	call   *%rax
+  8008ab:	89 c6                	mov    %eax,%esi
+  8008ad:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8008b3:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8008ba:	41 89 d0             	mov    %edx,%r8d
+  8008bd:	48 89 c1             	mov    %rax,%rcx
+  8008c0:	48 89 da             	mov    %rbx,%rdx
+  8008c3:	48 b8 20 5b 80 00 00 	movabs $0x805b20,%rax
+  8008ca:	00 00 00 
+  8008cd:	48 89 c7             	mov    %rax,%rdi
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	49 b9 28 0a 80 00 00 	movabs $0x800a28,%r9
+  8008dc:	00 00 00 
+  8008df:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8008e2:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8008e9:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8008f0:	48 89 d6             	mov    %rdx,%rsi
+  8008f3:	48 89 c7             	mov    %rax,%rdi
+  8008f6:	48 b8 9d 09 80 00 00 	movabs $0x80099d,%rax
+  8008fd:	00 00 00 
+  800900:	ff d0                	call   *%rax
+  cprintf("\n");
+  800902:	48 b8 43 5b 80 00 00 	movabs $0x805b43,%rax
+  800909:	00 00 00 
+  80090c:	48 89 c7             	mov    %rax,%rdi
+  80090f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800914:	48 ba 28 0a 80 00 00 	movabs $0x800a28,%rdx
+  80091b:	00 00 00 
+  80091e:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800920:	cc                   	int3
+  800921:	eb fd                	jmp    800920 <_panic+0x117>
+
+0000000000800923 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800923:	55                   	push   %rbp
+  800924:	48 89 e5             	mov    %rsp,%rbp
+  800927:	48 83 ec 10          	sub    $0x10,%rsp
+  80092b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80092e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800932:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800936:	8b 00                	mov    (%rax),%eax
+  800938:	8d 48 01             	lea    0x1(%rax),%ecx
+  80093b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80093f:	89 0a                	mov    %ecx,(%rdx)
+  800941:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800944:	89 d1                	mov    %edx,%ecx
+  800946:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80094a:	48 98                	cltq
+  80094c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800950:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800954:	8b 00                	mov    (%rax),%eax
+  800956:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80095b:	75 2c                	jne    800989 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80095d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800961:	8b 00                	mov    (%rax),%eax
+  800963:	48 98                	cltq
+  800965:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800969:	48 83 c2 08          	add    $0x8,%rdx
+  80096d:	48 89 c6             	mov    %rax,%rsi
+  800970:	48 89 d7             	mov    %rdx,%rdi
+  800973:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  80097a:	00 00 00 
+  80097d:	ff d0                	call   *%rax
+    b->idx = 0;
+  80097f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800983:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800989:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80098d:	8b 40 04             	mov    0x4(%rax),%eax
+  800990:	8d 50 01             	lea    0x1(%rax),%edx
+  800993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800997:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80099a:	90                   	nop
+  80099b:	c9                   	leave
+  80099c:	c3                   	ret
+
+000000000080099d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80099d:	55                   	push   %rbp
+  80099e:	48 89 e5             	mov    %rsp,%rbp
+  8009a1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8009a8:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8009af:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8009b6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8009bd:	00 00 00 
+  b.cnt = 0;
+  8009c0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8009c7:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8009ca:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8009d1:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8009d8:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8009df:	48 89 c6             	mov    %rax,%rsi
+  8009e2:	48 b8 23 09 80 00 00 	movabs $0x800923,%rax
+  8009e9:	00 00 00 
+  8009ec:	48 89 c7             	mov    %rax,%rdi
+  8009ef:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  8009f6:	00 00 00 
+  8009f9:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8009fb:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800a01:	48 98                	cltq
+  800a03:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800a0a:	48 83 c2 08          	add    $0x8,%rdx
+  800a0e:	48 89 c6             	mov    %rax,%rsi
+  800a11:	48 89 d7             	mov    %rdx,%rdi
+  800a14:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  800a1b:	00 00 00 
+  800a1e:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800a20:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800a26:	c9                   	leave
+  800a27:	c3                   	ret
+
+0000000000800a28 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800a28:	55                   	push   %rbp
+  800a29:	48 89 e5             	mov    %rsp,%rbp
+  800a2c:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800a33:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a3a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800a41:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800a48:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a4f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a56:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a5d:	84 c0                	test   %al,%al
+  800a5f:	74 20                	je     800a81 <cprintf+0x59>
+  800a61:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a65:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a69:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a6d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a71:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a75:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a79:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a7d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800a81:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800a88:	00 00 00 
+  800a8b:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800a92:	00 00 00 
+  800a95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a99:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800aa0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800aa7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800aae:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800ab5:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800abc:	48 89 d6             	mov    %rdx,%rsi
+  800abf:	48 89 c7             	mov    %rax,%rdi
+  800ac2:	48 b8 9d 09 80 00 00 	movabs $0x80099d,%rax
+  800ac9:	00 00 00 
+  800acc:	ff d0                	call   *%rax
+  800ace:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800ad4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ada:	c9                   	leave
+  800adb:	c3                   	ret
+
+0000000000800adc <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800adc:	55                   	push   %rbp
+  800add:	48 89 e5             	mov    %rsp,%rbp
+  800ae0:	48 83 ec 30          	sub    $0x30,%rsp
+  800ae4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ae8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800aec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800af0:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800af3:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800af7:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800afb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800afe:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800b02:	72 54                	jb     800b58 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b04:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800b07:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800b0a:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800b0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b16:	48 f7 f6             	div    %rsi
+  800b19:	49 89 c2             	mov    %rax,%r10
+  800b1c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800b1f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800b22:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800b26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b2a:	41 89 c9             	mov    %ecx,%r9d
+  800b2d:	41 89 f8             	mov    %edi,%r8d
+  800b30:	89 d1                	mov    %edx,%ecx
+  800b32:	4c 89 d2             	mov    %r10,%rdx
+  800b35:	48 89 c7             	mov    %rax,%rdi
+  800b38:	48 b8 dc 0a 80 00 00 	movabs $0x800adc,%rax
+  800b3f:	00 00 00 
+  800b42:	ff d0                	call   *%rax
+  800b44:	eb 1c                	jmp    800b62 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800b46:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800b4d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800b51:	48 89 d6             	mov    %rdx,%rsi
+  800b54:	89 c7                	mov    %eax,%edi
+  800b56:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800b58:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800b5c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800b60:	7f e4                	jg     800b46 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800b62:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6e:	48 f7 f1             	div    %rcx
+  800b71:	48 b8 90 5d 80 00 00 	movabs $0x805d90,%rax
+  800b78:	00 00 00 
+  800b7b:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800b7f:	0f be c0             	movsbl %al,%eax
+  800b82:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b86:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800b8a:	48 89 d6             	mov    %rdx,%rsi
+  800b8d:	89 c7                	mov    %eax,%edi
+  800b8f:	ff d1                	call   *%rcx
+}
+  800b91:	90                   	nop
+  800b92:	c9                   	leave
+  800b93:	c3                   	ret
+
+0000000000800b94 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800b94:	55                   	push   %rbp
+  800b95:	48 89 e5             	mov    %rsp,%rbp
+  800b98:	48 83 ec 10          	sub    $0x10,%rsp
+  800b9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ba0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800ba3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800ba7:	7e 4b                	jle    800bf4 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800ba9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bad:	8b 00                	mov    (%rax),%eax
+  800baf:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb2:	77 24                	ja     800bd8 <getuint+0x44>
+  800bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bb8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bc0:	8b 00                	mov    (%rax),%eax
+  800bc2:	89 c0                	mov    %eax,%eax
+  800bc4:	48 01 d0             	add    %rdx,%rax
+  800bc7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bcb:	8b 12                	mov    (%rdx),%edx
+  800bcd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bd0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bd4:	89 0a                	mov    %ecx,(%rdx)
+  800bd6:	eb 14                	jmp    800bec <getuint+0x58>
+  800bd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bdc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800be0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800be4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800be8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bec:	48 8b 00             	mov    (%rax),%rax
+  800bef:	e9 95 00 00 00       	jmp    800c89 <getuint+0xf5>
+  else if (lflag)
+  800bf4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800bf8:	74 48                	je     800c42 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800bfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bfe:	8b 00                	mov    (%rax),%eax
+  800c00:	83 f8 2f             	cmp    $0x2f,%eax
+  800c03:	77 24                	ja     800c29 <getuint+0x95>
+  800c05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c09:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c11:	8b 00                	mov    (%rax),%eax
+  800c13:	89 c0                	mov    %eax,%eax
+  800c15:	48 01 d0             	add    %rdx,%rax
+  800c18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c1c:	8b 12                	mov    (%rdx),%edx
+  800c1e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c25:	89 0a                	mov    %ecx,(%rdx)
+  800c27:	eb 14                	jmp    800c3d <getuint+0xa9>
+  800c29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c2d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c31:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c35:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c39:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c3d:	48 8b 00             	mov    (%rax),%rax
+  800c40:	eb 47                	jmp    800c89 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800c42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c46:	8b 00                	mov    (%rax),%eax
+  800c48:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4b:	77 24                	ja     800c71 <getuint+0xdd>
+  800c4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c51:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c59:	8b 00                	mov    (%rax),%eax
+  800c5b:	89 c0                	mov    %eax,%eax
+  800c5d:	48 01 d0             	add    %rdx,%rax
+  800c60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c64:	8b 12                	mov    (%rdx),%edx
+  800c66:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c6d:	89 0a                	mov    %ecx,(%rdx)
+  800c6f:	eb 14                	jmp    800c85 <getuint+0xf1>
+  800c71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c75:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c79:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c81:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c85:	8b 00                	mov    (%rax),%eax
+  800c87:	89 c0                	mov    %eax,%eax
+}
+  800c89:	c9                   	leave
+  800c8a:	c3                   	ret
+
+0000000000800c8b <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800c8b:	55                   	push   %rbp
+  800c8c:	48 89 e5             	mov    %rsp,%rbp
+  800c8f:	48 83 ec 10          	sub    $0x10,%rsp
+  800c93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c97:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800c9a:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800c9e:	7e 4b                	jle    800ceb <getint+0x60>
+    return va_arg(*ap, long long);
+  800ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ca4:	8b 00                	mov    (%rax),%eax
+  800ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca9:	77 24                	ja     800ccf <getint+0x44>
+  800cab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800caf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800cb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cb7:	8b 00                	mov    (%rax),%eax
+  800cb9:	89 c0                	mov    %eax,%eax
+  800cbb:	48 01 d0             	add    %rdx,%rax
+  800cbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cc2:	8b 12                	mov    (%rdx),%edx
+  800cc4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cc7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ccb:	89 0a                	mov    %ecx,(%rdx)
+  800ccd:	eb 14                	jmp    800ce3 <getint+0x58>
+  800ccf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cd3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cd7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cdb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cdf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ce3:	48 8b 00             	mov    (%rax),%rax
+  800ce6:	e9 95 00 00 00       	jmp    800d80 <getint+0xf5>
+  else if (lflag)
+  800ceb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800cef:	74 48                	je     800d39 <getint+0xae>
+    return va_arg(*ap, long);
+  800cf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cf5:	8b 00                	mov    (%rax),%eax
+  800cf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfa:	77 24                	ja     800d20 <getint+0x95>
+  800cfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d00:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d08:	8b 00                	mov    (%rax),%eax
+  800d0a:	89 c0                	mov    %eax,%eax
+  800d0c:	48 01 d0             	add    %rdx,%rax
+  800d0f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d13:	8b 12                	mov    (%rdx),%edx
+  800d15:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d1c:	89 0a                	mov    %ecx,(%rdx)
+  800d1e:	eb 14                	jmp    800d34 <getint+0xa9>
+  800d20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d24:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d28:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d2c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d30:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d34:	48 8b 00             	mov    (%rax),%rax
+  800d37:	eb 47                	jmp    800d80 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800d39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d3d:	8b 00                	mov    (%rax),%eax
+  800d3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d42:	77 24                	ja     800d68 <getint+0xdd>
+  800d44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d48:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d50:	8b 00                	mov    (%rax),%eax
+  800d52:	89 c0                	mov    %eax,%eax
+  800d54:	48 01 d0             	add    %rdx,%rax
+  800d57:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d5b:	8b 12                	mov    (%rdx),%edx
+  800d5d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d64:	89 0a                	mov    %ecx,(%rdx)
+  800d66:	eb 14                	jmp    800d7c <getint+0xf1>
+  800d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d70:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d74:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d78:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d7c:	8b 00                	mov    (%rax),%eax
+  800d7e:	48 98                	cltq
+}
+  800d80:	c9                   	leave
+  800d81:	c3                   	ret
+
+0000000000800d82 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800d82:	55                   	push   %rbp
+  800d83:	48 89 e5             	mov    %rsp,%rbp
+  800d86:	41 54                	push   %r12
+  800d88:	53                   	push   %rbx
+  800d89:	48 83 ec 60          	sub    $0x60,%rsp
+  800d8d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800d91:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800d95:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800d99:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800d9d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800da1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800da5:	48 8b 06             	mov    (%rsi),%rax
+  800da8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dac:	48 89 01             	mov    %rax,(%rcx)
+  800daf:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800db3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800db7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800dbb:	eb 17                	jmp    800dd4 <vprintfmt+0x52>
+      if (ch == '\0')
+  800dbd:	85 db                	test   %ebx,%ebx
+  800dbf:	0f 84 bf 04 00 00    	je     801284 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800dc5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dc9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dcd:	48 89 c6             	mov    %rax,%rsi
+  800dd0:	89 df                	mov    %ebx,%edi
+  800dd2:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800dd4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dd8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ddc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800de0:	0f b6 00             	movzbl (%rax),%eax
+  800de3:	0f b6 d8             	movzbl %al,%ebx
+  800de6:	83 fb 25             	cmp    $0x25,%ebx
+  800de9:	75 d2                	jne    800dbd <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800deb:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800def:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800df6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800dfd:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800e04:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800e0b:	eb 04                	jmp    800e11 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800e0d:	90                   	nop
+  800e0e:	eb 01                	jmp    800e11 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800e10:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800e11:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e15:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e19:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800e1d:	0f b6 00             	movzbl (%rax),%eax
+  800e20:	0f b6 d8             	movzbl %al,%ebx
+  800e23:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800e26:	83 f8 55             	cmp    $0x55,%eax
+  800e29:	0f 87 22 04 00 00    	ja     801251 <vprintfmt+0x4cf>
+  800e2f:	89 c0                	mov    %eax,%eax
+  800e31:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800e38:	00 
+  800e39:	48 b8 b8 5d 80 00 00 	movabs $0x805db8,%rax
+  800e40:	00 00 00 
+  800e43:	48 01 d0             	add    %rdx,%rax
+  800e46:	48 8b 00             	mov    (%rax),%rax
+  800e49:	ff e0                	jmp    *%rax
+        padc = '-';
+  800e4b:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800e4f:	eb c0                	jmp    800e11 <vprintfmt+0x8f>
+        padc = '0';
+  800e51:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800e55:	eb ba                	jmp    800e11 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800e57:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800e5e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800e61:	89 d0                	mov    %edx,%eax
+  800e63:	c1 e0 02             	shl    $0x2,%eax
+  800e66:	01 d0                	add    %edx,%eax
+  800e68:	01 c0                	add    %eax,%eax
+  800e6a:	01 d8                	add    %ebx,%eax
+  800e6c:	83 e8 30             	sub    $0x30,%eax
+  800e6f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800e72:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e76:	0f b6 00             	movzbl (%rax),%eax
+  800e79:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800e7c:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e7f:	7e 60                	jle    800ee1 <vprintfmt+0x15f>
+  800e81:	83 fb 39             	cmp    $0x39,%ebx
+  800e84:	7f 5b                	jg     800ee1 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800e86:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800e8b:	eb d1                	jmp    800e5e <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800e8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e90:	83 f8 2f             	cmp    $0x2f,%eax
+  800e93:	77 17                	ja     800eac <vprintfmt+0x12a>
+  800e95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e99:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e9c:	89 d2                	mov    %edx,%edx
+  800e9e:	48 01 d0             	add    %rdx,%rax
+  800ea1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ea4:	83 c2 08             	add    $0x8,%edx
+  800ea7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800eaa:	eb 0c                	jmp    800eb8 <vprintfmt+0x136>
+  800eac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800eb0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eb4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800eb8:	8b 00                	mov    (%rax),%eax
+  800eba:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800ebd:	eb 23                	jmp    800ee2 <vprintfmt+0x160>
+        if (width < 0)
+  800ebf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ec3:	0f 89 44 ff ff ff    	jns    800e0d <vprintfmt+0x8b>
+          width = 0;
+  800ec9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800ed0:	e9 38 ff ff ff       	jmp    800e0d <vprintfmt+0x8b>
+        altflag = 1;
+  800ed5:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800edc:	e9 30 ff ff ff       	jmp    800e11 <vprintfmt+0x8f>
+        goto process_precision;
+  800ee1:	90                   	nop
+        if (width < 0)
+  800ee2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ee6:	0f 89 24 ff ff ff    	jns    800e10 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800eec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800eef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ef2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800ef9:	e9 12 ff ff ff       	jmp    800e10 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800efe:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800f02:	e9 0a ff ff ff       	jmp    800e11 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800f07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0d:	77 17                	ja     800f26 <vprintfmt+0x1a4>
+  800f0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f13:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f16:	89 d2                	mov    %edx,%edx
+  800f18:	48 01 d0             	add    %rdx,%rax
+  800f1b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f1e:	83 c2 08             	add    $0x8,%edx
+  800f21:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800f24:	eb 0c                	jmp    800f32 <vprintfmt+0x1b0>
+  800f26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f2a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f2e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f32:	8b 00                	mov    (%rax),%eax
+  800f34:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800f38:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800f3c:	48 89 d6             	mov    %rdx,%rsi
+  800f3f:	89 c7                	mov    %eax,%edi
+  800f41:	ff d1                	call   *%rcx
+        break;
+  800f43:	e9 37 03 00 00       	jmp    80127f <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800f48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4e:	77 17                	ja     800f67 <vprintfmt+0x1e5>
+  800f50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f54:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f57:	89 d2                	mov    %edx,%edx
+  800f59:	48 01 d0             	add    %rdx,%rax
+  800f5c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f5f:	83 c2 08             	add    $0x8,%edx
+  800f62:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800f65:	eb 0c                	jmp    800f73 <vprintfmt+0x1f1>
+  800f67:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f6b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f6f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f73:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800f75:	85 db                	test   %ebx,%ebx
+  800f77:	79 02                	jns    800f7b <vprintfmt+0x1f9>
+          err = -err;
+  800f79:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f7b:	83 fb 15             	cmp    $0x15,%ebx
+  800f7e:	7f 16                	jg     800f96 <vprintfmt+0x214>
+  800f80:	48 ba e0 5c 80 00 00 	movabs $0x805ce0,%rdx
+  800f87:	00 00 00 
+  800f8a:	48 63 c3             	movslq %ebx,%rax
+  800f8d:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800f91:	4d 85 e4             	test   %r12,%r12
+  800f94:	75 2e                	jne    800fc4 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800f96:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800f9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f9e:	89 d9                	mov    %ebx,%ecx
+  800fa0:	48 ba a1 5d 80 00 00 	movabs $0x805da1,%rdx
+  800fa7:	00 00 00 
+  800faa:	48 89 c7             	mov    %rax,%rdi
+  800fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb2:	49 b8 8e 12 80 00 00 	movabs $0x80128e,%r8
+  800fb9:	00 00 00 
+  800fbc:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800fbf:	e9 bb 02 00 00       	jmp    80127f <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800fc4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800fc8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fcc:	4c 89 e1             	mov    %r12,%rcx
+  800fcf:	48 ba aa 5d 80 00 00 	movabs $0x805daa,%rdx
+  800fd6:	00 00 00 
+  800fd9:	48 89 c7             	mov    %rax,%rdi
+  800fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe1:	49 b8 8e 12 80 00 00 	movabs $0x80128e,%r8
+  800fe8:	00 00 00 
+  800feb:	41 ff d0             	call   *%r8
+        break;
+  800fee:	e9 8c 02 00 00       	jmp    80127f <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800ff3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ff6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ff9:	77 17                	ja     801012 <vprintfmt+0x290>
+  800ffb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801002:	89 d2                	mov    %edx,%edx
+  801004:	48 01 d0             	add    %rdx,%rax
+  801007:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80100a:	83 c2 08             	add    $0x8,%edx
+  80100d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801010:	eb 0c                	jmp    80101e <vprintfmt+0x29c>
+  801012:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801016:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80101a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80101e:	4c 8b 20             	mov    (%rax),%r12
+  801021:	4d 85 e4             	test   %r12,%r12
+  801024:	75 0a                	jne    801030 <vprintfmt+0x2ae>
+          p = "(null)";
+  801026:	49 bc ad 5d 80 00 00 	movabs $0x805dad,%r12
+  80102d:	00 00 00 
+        if (width > 0 && padc != '-')
+  801030:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801034:	7e 78                	jle    8010ae <vprintfmt+0x32c>
+  801036:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80103a:	74 72                	je     8010ae <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80103c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80103f:	48 98                	cltq
+  801041:	48 89 c6             	mov    %rax,%rsi
+  801044:	4c 89 e7             	mov    %r12,%rdi
+  801047:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+  801053:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  801056:	eb 17                	jmp    80106f <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  801058:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80105c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801060:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801064:	48 89 d6             	mov    %rdx,%rsi
+  801067:	89 c7                	mov    %eax,%edi
+  801069:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80106b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80106f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801073:	7f e3                	jg     801058 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801075:	eb 37                	jmp    8010ae <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  801077:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80107b:	74 1e                	je     80109b <vprintfmt+0x319>
+  80107d:	83 fb 1f             	cmp    $0x1f,%ebx
+  801080:	7e 05                	jle    801087 <vprintfmt+0x305>
+  801082:	83 fb 7e             	cmp    $0x7e,%ebx
+  801085:	7e 14                	jle    80109b <vprintfmt+0x319>
+            putch('?', putdat);
+  801087:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80108b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80108f:	48 89 c6             	mov    %rax,%rsi
+  801092:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801097:	ff d2                	call   *%rdx
+  801099:	eb 0f                	jmp    8010aa <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80109b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80109f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010a3:	48 89 c6             	mov    %rax,%rsi
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8010aa:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8010ae:	4c 89 e0             	mov    %r12,%rax
+  8010b1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8010b5:	0f b6 00             	movzbl (%rax),%eax
+  8010b8:	0f be d8             	movsbl %al,%ebx
+  8010bb:	85 db                	test   %ebx,%ebx
+  8010bd:	74 28                	je     8010e7 <vprintfmt+0x365>
+  8010bf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8010c3:	78 b2                	js     801077 <vprintfmt+0x2f5>
+  8010c5:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8010c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8010cd:	79 a8                	jns    801077 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8010cf:	eb 16                	jmp    8010e7 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8010d1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010d5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010d9:	48 89 c6             	mov    %rax,%rsi
+  8010dc:	bf 20 00 00 00       	mov    $0x20,%edi
+  8010e1:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8010e3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8010e7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8010eb:	7f e4                	jg     8010d1 <vprintfmt+0x34f>
+        break;
+  8010ed:	e9 8d 01 00 00       	jmp    80127f <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8010f2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8010f5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8010f9:	89 d6                	mov    %edx,%esi
+  8010fb:	48 89 c7             	mov    %rax,%rdi
+  8010fe:	48 b8 8b 0c 80 00 00 	movabs $0x800c8b,%rax
+  801105:	00 00 00 
+  801108:	ff d0                	call   *%rax
+  80110a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80110e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801112:	48 85 c0             	test   %rax,%rax
+  801115:	79 1d                	jns    801134 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  801117:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80111b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80111f:	48 89 c6             	mov    %rax,%rsi
+  801122:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801127:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  801129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80112d:	48 f7 d8             	neg    %rax
+  801130:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  801134:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80113b:	e9 d2 00 00 00       	jmp    801212 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  801140:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801143:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801147:	89 d6                	mov    %edx,%esi
+  801149:	48 89 c7             	mov    %rax,%rdi
+  80114c:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  801153:	00 00 00 
+  801156:	ff d0                	call   *%rax
+  801158:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80115c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801163:	e9 aa 00 00 00       	jmp    801212 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  801168:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80116b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80116f:	89 d6                	mov    %edx,%esi
+  801171:	48 89 c7             	mov    %rax,%rdi
+  801174:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  80117b:	00 00 00 
+  80117e:	ff d0                	call   *%rax
+  801180:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  801184:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80118b:	e9 82 00 00 00       	jmp    801212 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  801190:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801194:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801198:	48 89 c6             	mov    %rax,%rsi
+  80119b:	bf 30 00 00 00       	mov    $0x30,%edi
+  8011a0:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8011a2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8011a6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011aa:	48 89 c6             	mov    %rax,%rsi
+  8011ad:	bf 78 00 00 00       	mov    $0x78,%edi
+  8011b2:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8011b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8011ba:	77 17                	ja     8011d3 <vprintfmt+0x451>
+  8011bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011c0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011c3:	89 d2                	mov    %edx,%edx
+  8011c5:	48 01 d0             	add    %rdx,%rax
+  8011c8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011cb:	83 c2 08             	add    $0x8,%edx
+  8011ce:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8011d1:	eb 0c                	jmp    8011df <vprintfmt+0x45d>
+  8011d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011d7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8011db:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8011df:	48 8b 00             	mov    (%rax),%rax
+  8011e2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8011e6:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8011ed:	eb 23                	jmp    801212 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8011ef:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8011f2:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8011f6:	89 d6                	mov    %edx,%esi
+  8011f8:	48 89 c7             	mov    %rax,%rdi
+  8011fb:	48 b8 94 0b 80 00 00 	movabs $0x800b94,%rax
+  801202:	00 00 00 
+  801205:	ff d0                	call   *%rax
+  801207:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80120b:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  801212:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801217:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80121a:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80121d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801221:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801225:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801229:	45 89 c1             	mov    %r8d,%r9d
+  80122c:	41 89 f8             	mov    %edi,%r8d
+  80122f:	48 89 c7             	mov    %rax,%rdi
+  801232:	48 b8 dc 0a 80 00 00 	movabs $0x800adc,%rax
+  801239:	00 00 00 
+  80123c:	ff d0                	call   *%rax
+        break;
+  80123e:	eb 3f                	jmp    80127f <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801240:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801244:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801248:	48 89 c6             	mov    %rax,%rsi
+  80124b:	89 df                	mov    %ebx,%edi
+  80124d:	ff d2                	call   *%rdx
+        break;
+  80124f:	eb 2e                	jmp    80127f <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801251:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801255:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801259:	48 89 c6             	mov    %rax,%rsi
+  80125c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801261:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801263:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801268:	eb 05                	jmp    80126f <vprintfmt+0x4ed>
+  80126a:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80126f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801273:	48 83 e8 01          	sub    $0x1,%rax
+  801277:	0f b6 00             	movzbl (%rax),%eax
+  80127a:	3c 25                	cmp    $0x25,%al
+  80127c:	75 ec                	jne    80126a <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  80127e:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80127f:	e9 50 fb ff ff       	jmp    800dd4 <vprintfmt+0x52>
+        return;
+  801284:	90                   	nop
+    }
+  }
+}
+  801285:	48 83 c4 60          	add    $0x60,%rsp
+  801289:	5b                   	pop    %rbx
+  80128a:	41 5c                	pop    %r12
+  80128c:	5d                   	pop    %rbp
+  80128d:	c3                   	ret
+
+000000000080128e <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80128e:	55                   	push   %rbp
+  80128f:	48 89 e5             	mov    %rsp,%rbp
+  801292:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801299:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012a0:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012a7:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8012ae:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012b5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012bc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012c3:	84 c0                	test   %al,%al
+  8012c5:	74 20                	je     8012e7 <printfmt+0x59>
+  8012c7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012cb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012cf:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012d3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012d7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012db:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012df:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012e3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8012e7:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8012ee:	00 00 00 
+  8012f1:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8012f8:	00 00 00 
+  8012fb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012ff:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801306:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80130d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801314:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80131b:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801322:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801329:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801330:	48 89 c7             	mov    %rax,%rdi
+  801333:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  80133a:	00 00 00 
+  80133d:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  80133f:	90                   	nop
+  801340:	c9                   	leave
+  801341:	c3                   	ret
+
+0000000000801342 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801342:	55                   	push   %rbp
+  801343:	48 89 e5             	mov    %rsp,%rbp
+  801346:	48 83 ec 10          	sub    $0x10,%rsp
+  80134a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80134d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801355:	8b 40 10             	mov    0x10(%rax),%eax
+  801358:	8d 50 01             	lea    0x1(%rax),%edx
+  80135b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135f:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801366:	48 8b 10             	mov    (%rax),%rdx
+  801369:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80136d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801371:	48 39 c2             	cmp    %rax,%rdx
+  801374:	73 17                	jae    80138d <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801376:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137a:	48 8b 00             	mov    (%rax),%rax
+  80137d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801381:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801385:	48 89 0a             	mov    %rcx,(%rdx)
+  801388:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80138b:	88 10                	mov    %dl,(%rax)
+}
+  80138d:	90                   	nop
+  80138e:	c9                   	leave
+  80138f:	c3                   	ret
+
+0000000000801390 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+  801394:	48 83 ec 40          	sub    $0x40,%rsp
+  801398:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80139c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80139f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8013a3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8013a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013af:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8013b2:	48 98                	cltq
+  8013b4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013bc:	48 01 d0             	add    %rdx,%rax
+  8013bf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8013c3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8013ca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013cf:	74 06                	je     8013d7 <vsnprintf+0x47>
+  8013d1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8013d5:	7f 07                	jg     8013de <vsnprintf+0x4e>
+    return -E_INVAL;
+  8013d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013dc:	eb 32                	jmp    801410 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8013de:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8013e2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8013e6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8013ea:	48 89 c6             	mov    %rax,%rsi
+  8013ed:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  8013f4:	00 00 00 
+  8013f7:	48 89 c7             	mov    %rax,%rdi
+  8013fa:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  801401:	00 00 00 
+  801404:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801406:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80140a:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  80140d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801410:	c9                   	leave
+  801411:	c3                   	ret
+
+0000000000801412 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801412:	55                   	push   %rbp
+  801413:	48 89 e5             	mov    %rsp,%rbp
+  801416:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80141d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801424:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80142a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801431:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801438:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80143f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801446:	84 c0                	test   %al,%al
+  801448:	74 20                	je     80146a <snprintf+0x58>
+  80144a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80144e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801452:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801456:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80145a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80145e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801462:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801466:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80146a:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801471:	00 00 00 
+  801474:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80147b:	00 00 00 
+  80147e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801482:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801489:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801490:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801497:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  80149e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8014a5:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8014ab:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8014b2:	48 89 c7             	mov    %rax,%rdi
+  8014b5:	48 b8 90 13 80 00 00 	movabs $0x801390,%rax
+  8014bc:	00 00 00 
+  8014bf:	ff d0                	call   *%rax
+  8014c1:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8014c7:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+00000000008014cf <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	53                   	push   %rbx
+  8014d4:	48 83 ec 38          	sub    $0x38,%rsp
+  8014d8:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8014db:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8014df:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8014e3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8014e7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8014eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8014ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f3:	89 d1                	mov    %edx,%ecx
+  8014f5:	0f a2                	cpuid
+  8014f7:	89 de                	mov    %ebx,%esi
+  8014f9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8014fc:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8014ff:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801502:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801505:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80150a:	74 09                	je     801515 <cpuid+0x46>
+}
+  80150c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801510:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801513:	89 10                	mov    %edx,(%rax)
+
+  801515:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80151a:	74 09                	je     801525 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80151c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801520:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801523:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801525:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80152a:	74 09                	je     801535 <cpuid+0x66>
+char *
+  80152c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801530:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801533:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801535:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80153a:	74 09                	je     801545 <cpuid+0x76>
+  for (; *s; s++)
+  80153c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801540:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801543:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801545:	90                   	nop
+  801546:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154a:	c9                   	leave
+  80154b:	c3                   	ret
+
+000000000080154c <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80154c:	55                   	push   %rbp
+  80154d:	48 89 e5             	mov    %rsp,%rbp
+  801550:	48 83 ec 18          	sub    $0x18,%rsp
+  801554:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801557:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80155a:	89 c1                	mov    %eax,%ecx
+  80155c:	0f 01 d0             	xgetbv
+  80155f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801562:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801565:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801568:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80156b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80156f:	48 09 d0             	or     %rdx,%rax
+#else
+  801572:	c9                   	leave
+  801573:	c3                   	ret
+
+0000000000801574 <string_cpu>:
+string_cpu(void) {
+  801574:	55                   	push   %rbp
+  801575:	48 89 e5             	mov    %rsp,%rbp
+  801578:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80157c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801583:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80158a:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801591:	00 00 00 
+  801594:	8b 00                	mov    (%rax),%eax
+  801596:	85 c0                	test   %eax,%eax
+  801598:	78 11                	js     8015ab <string_cpu+0x37>
+    return string_features;
+  80159a:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8015a1:	00 00 00 
+  8015a4:	8b 00                	mov    (%rax),%eax
+  8015a6:	e9 df 00 00 00       	jmp    80168a <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8015ab:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8015af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bf:	48 89 c6             	mov    %rax,%rsi
+  8015c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c7:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  8015ce:	00 00 00 
+  8015d1:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8015d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8015d6:	83 f8 06             	cmp    $0x6,%eax
+  8015d9:	76 28                	jbe    801603 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8015db:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8015df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ea:	48 89 c2             	mov    %rax,%rdx
+  8015ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8015f7:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  8015fe:	00 00 00 
+  801601:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801603:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801606:	25 00 02 00 00       	and    $0x200,%eax
+  80160b:	85 c0                	test   %eax,%eax
+  80160d:	74 04                	je     801613 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80160f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801613:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801617:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80161d:	48 89 c1             	mov    %rax,%rcx
+  801620:	ba 00 00 00 00       	mov    $0x0,%edx
+  801625:	be 00 00 00 00       	mov    $0x0,%esi
+  80162a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80162f:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80163b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80163e:	83 e0 20             	and    $0x20,%eax
+  801641:	85 c0                	test   %eax,%eax
+  801643:	74 2a                	je     80166f <string_cpu+0xfb>
+  801645:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801648:	25 00 00 00 08       	and    $0x8000000,%eax
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	74 1e                	je     80166f <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801651:	bf 00 00 00 00       	mov    $0x0,%edi
+  801656:	48 b8 4c 15 80 00 00 	movabs $0x80154c,%rax
+  80165d:	00 00 00 
+  801660:	ff d0                	call   *%rax
+  801662:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801665:	48 83 f8 06          	cmp    $0x6,%rax
+  801669:	75 04                	jne    80166f <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80166b:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80166f:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801676:	00 00 00 
+  801679:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80167c:	89 02                	mov    %eax,(%rdx)
+  80167e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801685:	00 00 00 
+  801688:	8b 00                	mov    (%rax),%eax
+}
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+
+000000000080168c <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80168c:	55                   	push   %rbp
+  80168d:	48 89 e5             	mov    %rsp,%rbp
+  801690:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801694:	48 83 ec 60          	sub    $0x60,%rsp
+  801698:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80169d:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8016a2:	83 e0 1f             	and    $0x1f,%eax
+  8016a5:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8016a9:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8016ad:	48 f7 d8             	neg    %rax
+  8016b0:	48 89 c2             	mov    %rax,%rdx
+  8016b3:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8016b8:	48 01 d0             	add    %rdx,%rax
+  8016bb:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8016c0:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8016c4:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8016ca:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8016cf:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8016d3:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8016d9:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8016dd:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8016e1:	89 c2                	mov    %eax,%edx
+  8016e3:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8016e7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8016ec:	89 c1                	mov    %eax,%ecx
+  8016ee:	d3 e6                	shl    %cl,%esi
+  8016f0:	89 f0                	mov    %esi,%eax
+  8016f2:	21 d0                	and    %edx,%eax
+  8016f4:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8016f8:	eb 21                	jmp    80171b <strlen_avx2+0x8f>
+    p += 32;
+  8016fa:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801700:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801705:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801709:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80170f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801713:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801717:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80171b:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801720:	74 d8                	je     8016fa <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801722:	31 c0                	xor    %eax,%eax
+  801724:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80172a:	48 63 d0             	movslq %eax,%rdx
+  80172d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801732:	48 01 d0             	add    %rdx,%rax
+  801735:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+000000000080173c <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80173c:	55                   	push   %rbp
+  80173d:	48 89 e5             	mov    %rsp,%rbp
+  801740:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801744:	48 83 ec 40          	sub    $0x40,%rsp
+  801748:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80174d:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801752:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801757:	eb 77                	jmp    8017d0 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801759:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80175e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801762:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801766:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80176b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80176f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801773:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801777:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80177b:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801780:	74 3c                	je     8017be <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801782:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801786:	f7 d0                	not    %eax
+  801788:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80178c:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801790:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801794:	48 63 d0             	movslq %eax,%rdx
+  801797:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80179c:	48 01 d0             	add    %rdx,%rax
+  80179f:	0f b6 00             	movzbl (%rax),%eax
+  8017a2:	0f b6 c0             	movzbl %al,%eax
+  8017a5:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8017a9:	48 63 ca             	movslq %edx,%rcx
+  8017ac:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8017b1:	48 01 ca             	add    %rcx,%rdx
+  8017b4:	0f b6 12             	movzbl (%rdx),%edx
+  8017b7:	0f b6 d2             	movzbl %dl,%edx
+  8017ba:	29 d0                	sub    %edx,%eax
+  8017bc:	eb 6b                	jmp    801829 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8017be:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8017c4:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8017ca:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8017d0:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8017d6:	77 81                	ja     801759 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8017d8:	eb 42                	jmp    80181c <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8017da:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8017df:	0f b6 10             	movzbl (%rax),%edx
+  8017e2:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8017e7:	0f b6 00             	movzbl (%rax),%eax
+  8017ea:	38 c2                	cmp    %al,%dl
+  8017ec:	74 1c                	je     80180a <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8017ee:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8017f3:	0f b6 00             	movzbl (%rax),%eax
+  8017f6:	0f b6 c8             	movzbl %al,%ecx
+  8017f9:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8017fe:	0f b6 00             	movzbl (%rax),%eax
+  801801:	0f b6 d0             	movzbl %al,%edx
+  801804:	89 c8                	mov    %ecx,%eax
+  801806:	29 d0                	sub    %edx,%eax
+  801808:	eb 1f                	jmp    801829 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  80180a:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801810:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801816:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80181c:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801822:	75 b6                	jne    8017da <memcmp_avx2+0x9e>
+  return 0;
+  801824:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801829:	c9                   	leave
+  80182a:	c3                   	ret
+
+000000000080182b <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801833:	48 83 ec 60          	sub    $0x60,%rsp
+  801837:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80183c:	89 f0                	mov    %esi,%eax
+  80183e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801843:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801847:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80184c:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801850:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801855:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80185b:	eb 47                	jmp    8018a4 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80185d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801862:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801866:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80186a:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801870:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801874:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801878:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80187c:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801881:	74 15                	je     801898 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801883:	31 c0                	xor    %eax,%eax
+  801885:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80188b:	48 63 d0             	movslq %eax,%rdx
+  80188e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801893:	48 01 d0             	add    %rdx,%rax
+  801896:	eb 3d                	jmp    8018d5 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801898:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80189e:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8018a4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8018aa:	77 b1                	ja     80185d <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8018ac:	eb 0c                	jmp    8018ba <memfind_avx2+0x8f>
+  8018ae:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8018b4:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8018ba:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8018c0:	74 0e                	je     8018d0 <memfind_avx2+0xa5>
+  8018c2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8018c7:	0f b6 00             	movzbl (%rax),%eax
+  8018ca:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8018ce:	75 de                	jne    8018ae <memfind_avx2+0x83>
+  return s;
+  8018d0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8018d5:	c9                   	leave
+  8018d6:	c3                   	ret
+
+00000000008018d7 <strlen>:
+strlen(const char *s) {
+  8018d7:	55                   	push   %rbp
+  8018d8:	48 89 e5             	mov    %rsp,%rbp
+  8018db:	48 83 ec 40          	sub    $0x40,%rsp
+  8018df:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8018e3:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8018e7:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8018eb:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  8018f2:	00 00 00 
+  8018f5:	ff d0                	call   *%rax
+  8018f7:	83 e0 02             	and    $0x2,%eax
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	74 18                	je     801916 <strlen+0x3f>
+    return strlen_avx2(s);
+  8018fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801902:	48 89 c7             	mov    %rax,%rdi
+  801905:	48 b8 8c 16 80 00 00 	movabs $0x80168c,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+  801911:	e9 82 00 00 00       	jmp    801998 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801916:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80191a:	83 e0 0f             	and    $0xf,%eax
+  80191d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801920:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801923:	48 f7 d8             	neg    %rax
+  801926:	48 89 c2             	mov    %rax,%rdx
+  801929:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192d:	48 01 d0             	add    %rdx,%rax
+  801930:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801938:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80193c:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801941:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801945:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801949:	89 c2                	mov    %eax,%edx
+  80194b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80194e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801953:	89 c1                	mov    %eax,%ecx
+  801955:	d3 e6                	shl    %cl,%esi
+  801957:	89 f0                	mov    %esi,%eax
+  801959:	21 d0                	and    %edx,%eax
+  80195b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80195e:	eb 1d                	jmp    80197d <strlen+0xa6>
+    p += 16;
+  801960:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801965:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801969:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80196d:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801972:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801976:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80197a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80197d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801981:	74 dd                	je     801960 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801983:	31 c0                	xor    %eax,%eax
+  801985:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80198a:	48 63 d0             	movslq %eax,%rdx
+  80198d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801991:	48 01 d0             	add    %rdx,%rax
+  801994:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801998:	c9                   	leave
+  801999:	c3                   	ret
+
+000000000080199a <strnlen>:
+strnlen(const char *s, size_t size) {
+  80199a:	55                   	push   %rbp
+  80199b:	48 89 e5             	mov    %rsp,%rbp
+  80199e:	48 83 ec 20          	sub    $0x20,%rsp
+  8019a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8019b1:	eb 0e                	jmp    8019c1 <strnlen+0x27>
+    n++;
+  8019b3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019b7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019bc:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8019c1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8019c6:	74 0b                	je     8019d3 <strnlen+0x39>
+  8019c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019cc:	0f b6 00             	movzbl (%rax),%eax
+  8019cf:	84 c0                	test   %al,%al
+  8019d1:	75 e0                	jne    8019b3 <strnlen+0x19>
+  return n;
+  8019d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8019d6:	c9                   	leave
+  8019d7:	c3                   	ret
+
+00000000008019d8 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8019d8:	55                   	push   %rbp
+  8019d9:	48 89 e5             	mov    %rsp,%rbp
+  8019dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8019e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8019e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8019f0:	90                   	nop
+  8019f1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019f5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8019fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a01:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a05:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a09:	0f b6 12             	movzbl (%rdx),%edx
+  801a0c:	88 10                	mov    %dl,(%rax)
+  801a0e:	0f b6 00             	movzbl (%rax),%eax
+  801a11:	84 c0                	test   %al,%al
+  801a13:	75 dc                	jne    8019f1 <strcpy+0x19>
+  return ret;
+  801a15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a19:	c9                   	leave
+  801a1a:	c3                   	ret
+
+0000000000801a1b <strcat>:
+strcat(char *dst, const char *src) {
+  801a1b:	55                   	push   %rbp
+  801a1c:	48 89 e5             	mov    %rsp,%rbp
+  801a1f:	48 83 ec 20          	sub    $0x20,%rsp
+  801a23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a27:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801a2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2f:	48 89 c7             	mov    %rax,%rdi
+  801a32:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+  801a3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801a41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a44:	48 63 d0             	movslq %eax,%rdx
+  801a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a4b:	48 01 c2             	add    %rax,%rdx
+  801a4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a52:	48 89 c6             	mov    %rax,%rsi
+  801a55:	48 89 d7             	mov    %rdx,%rdi
+  801a58:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  801a5f:	00 00 00 
+  801a62:	ff d0                	call   *%rax
+  return dst;
+  801a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+
+0000000000801a6a <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	48 83 ec 28          	sub    $0x28,%rsp
+  801a72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a76:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a7a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801a7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a82:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801a86:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801a8d:	00 
+  801a8e:	eb 2a                	jmp    801aba <strncpy+0x50>
+    *dst++ = *src;
+  801a90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a94:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a98:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801a9c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801aa0:	0f b6 12             	movzbl (%rdx),%edx
+  801aa3:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801aa5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801aa9:	0f b6 00             	movzbl (%rax),%eax
+  801aac:	84 c0                	test   %al,%al
+  801aae:	74 05                	je     801ab5 <strncpy+0x4b>
+      src++;
+  801ab0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801ab5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801aba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abe:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801ac2:	72 cc                	jb     801a90 <strncpy+0x26>
+  return ret;
+  801ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ac8:	c9                   	leave
+  801ac9:	c3                   	ret
+
+0000000000801aca <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801aca:	55                   	push   %rbp
+  801acb:	48 89 e5             	mov    %rsp,%rbp
+  801ace:	48 83 ec 28          	sub    $0x28,%rsp
+  801ad2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ad6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801ada:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801ade:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ae2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801ae6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801aeb:	74 3d                	je     801b2a <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801aed:	eb 1d                	jmp    801b0c <strlcpy+0x42>
+      *dst++ = *src++;
+  801aef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801af3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801af7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801afb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aff:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b03:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b07:	0f b6 12             	movzbl (%rdx),%edx
+  801b0a:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801b0c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801b11:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b16:	74 0b                	je     801b23 <strlcpy+0x59>
+  801b18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b1c:	0f b6 00             	movzbl (%rax),%eax
+  801b1f:	84 c0                	test   %al,%al
+  801b21:	75 cc                	jne    801aef <strlcpy+0x25>
+    *dst = '\0';
+  801b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b27:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801b2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b2e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801b32:	c9                   	leave
+  801b33:	c3                   	ret
+
+0000000000801b34 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801b34:	55                   	push   %rbp
+  801b35:	48 89 e5             	mov    %rsp,%rbp
+  801b38:	48 83 ec 30          	sub    $0x30,%rsp
+  801b3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b40:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b44:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801b48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b4c:	48 89 c7             	mov    %rax,%rdi
+  801b4f:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	48 98                	cltq
+  801b5d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801b61:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b69:	48 89 d6             	mov    %rdx,%rsi
+  801b6c:	48 89 c7             	mov    %rax,%rdi
+  801b6f:	48 b8 9a 19 80 00 00 	movabs $0x80199a,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+  801b7b:	48 98                	cltq
+  801b7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801b81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b85:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801b89:	75 10                	jne    801b9b <strlcat+0x67>
+    return maxlen + srclen;
+  801b8b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b93:	48 01 d0             	add    %rdx,%rax
+  801b96:	e9 86 00 00 00       	jmp    801c21 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801b9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9f:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801ba3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801ba7:	73 2b                	jae    801bd4 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801ba9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bb1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801bb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb9:	48 01 c1             	add    %rax,%rcx
+  801bbc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bc0:	48 89 c6             	mov    %rax,%rsi
+  801bc3:	48 89 cf             	mov    %rcx,%rdi
+  801bc6:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+  801bd2:	eb 42                	jmp    801c16 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801bd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bdc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801be0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be4:	48 01 c1             	add    %rax,%rcx
+  801be7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801beb:	48 89 c6             	mov    %rax,%rsi
+  801bee:	48 89 cf             	mov    %rcx,%rdi
+  801bf1:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801bfd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c05:	48 01 d0             	add    %rdx,%rax
+  801c08:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c10:	48 01 d0             	add    %rdx,%rax
+  801c13:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801c16:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c1e:	48 01 d0             	add    %rdx,%rax
+}
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+0000000000801c23 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801c23:	55                   	push   %rbp
+  801c24:	48 89 e5             	mov    %rsp,%rbp
+  801c27:	48 83 ec 10          	sub    $0x10,%rsp
+  801c2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801c33:	eb 0a                	jmp    801c3f <strcmp+0x1c>
+    p++, q++;
+  801c35:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c3a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c43:	0f b6 00             	movzbl (%rax),%eax
+  801c46:	84 c0                	test   %al,%al
+  801c48:	74 12                	je     801c5c <strcmp+0x39>
+  801c4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c4e:	0f b6 10             	movzbl (%rax),%edx
+  801c51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c55:	0f b6 00             	movzbl (%rax),%eax
+  801c58:	38 c2                	cmp    %al,%dl
+  801c5a:	74 d9                	je     801c35 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801c5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c60:	0f b6 00             	movzbl (%rax),%eax
+  801c63:	0f b6 d0             	movzbl %al,%edx
+  801c66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c6a:	0f b6 00             	movzbl (%rax),%eax
+  801c6d:	0f b6 c0             	movzbl %al,%eax
+  801c70:	29 c2                	sub    %eax,%edx
+  801c72:	89 d0                	mov    %edx,%eax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+0000000000801c76 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801c7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c82:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c86:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801c8a:	eb 0f                	jmp    801c9b <strncmp+0x25>
+    n--, p++, q++;
+  801c8c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801c91:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c96:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801c9b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ca0:	74 1d                	je     801cbf <strncmp+0x49>
+  801ca2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca6:	0f b6 00             	movzbl (%rax),%eax
+  801ca9:	84 c0                	test   %al,%al
+  801cab:	74 12                	je     801cbf <strncmp+0x49>
+  801cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cb1:	0f b6 10             	movzbl (%rax),%edx
+  801cb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cb8:	0f b6 00             	movzbl (%rax),%eax
+  801cbb:	38 c2                	cmp    %al,%dl
+  801cbd:	74 cd                	je     801c8c <strncmp+0x16>
+  if (n == 0)
+  801cbf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801cc4:	75 07                	jne    801ccd <strncmp+0x57>
+    return 0;
+  801cc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ccb:	eb 16                	jmp    801ce3 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801ccd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cd1:	0f b6 00             	movzbl (%rax),%eax
+  801cd4:	0f b6 d0             	movzbl %al,%edx
+  801cd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cdb:	0f b6 00             	movzbl (%rax),%eax
+  801cde:	0f b6 c0             	movzbl %al,%eax
+  801ce1:	29 c2                	sub    %eax,%edx
+}
+  801ce3:	89 d0                	mov    %edx,%eax
+  801ce5:	c9                   	leave
+  801ce6:	c3                   	ret
+
+0000000000801ce7 <strchr>:
+strchr(const char *s, char c) {
+  801ce7:	55                   	push   %rbp
+  801ce8:	48 89 e5             	mov    %rsp,%rbp
+  801ceb:	48 83 ec 60          	sub    $0x60,%rsp
+  801cef:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801cf3:	89 f0                	mov    %esi,%eax
+  801cf5:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801cf8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801cfc:	83 e0 0f             	and    $0xf,%eax
+  801cff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801d02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d05:	48 f7 d8             	neg    %rax
+  801d08:	48 89 c2             	mov    %rax,%rdx
+  801d0b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801d0f:	48 01 d0             	add    %rdx,%rax
+  801d12:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801d16:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801d1a:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801d1e:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801d22:	66 0f 6e c0          	movd   %eax,%xmm0
+  801d26:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801d2a:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801d2e:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801d33:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801d37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d3b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801d3f:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801d43:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d48:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801d4d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d51:	89 c2                	mov    %eax,%edx
+  801d53:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d58:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801d5d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d61:	09 c2                	or     %eax,%edx
+  801d63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d66:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801d6b:	89 c1                	mov    %eax,%ecx
+  801d6d:	d3 e6                	shl    %cl,%esi
+  801d6f:	89 f0                	mov    %esi,%eax
+  801d71:	21 d0                	and    %edx,%eax
+  801d73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801d76:	eb 34                	jmp    801dac <strchr+0xc5>
+    p += 16;
+  801d78:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801d7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d81:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801d85:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801d89:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d8e:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801d93:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d97:	89 c2                	mov    %eax,%edx
+  801d99:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d9e:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801da3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801da7:	09 d0                	or     %edx,%eax
+  801da9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801dac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801db0:	74 c6                	je     801d78 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801db2:	31 c0                	xor    %eax,%eax
+  801db4:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801db9:	48 98                	cltq
+  801dbb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801dbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dc3:	0f b6 00             	movzbl (%rax),%eax
+  801dc6:	84 c0                	test   %al,%al
+  801dc8:	74 06                	je     801dd0 <strchr+0xe9>
+  801dca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dce:	eb 05                	jmp    801dd5 <strchr+0xee>
+  801dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dd5:	c9                   	leave
+  801dd6:	c3                   	ret
+
+0000000000801dd7 <strfind>:
+strfind(const char *s, char c) {
+  801dd7:	55                   	push   %rbp
+  801dd8:	48 89 e5             	mov    %rsp,%rbp
+  801ddb:	48 83 ec 10          	sub    $0x10,%rsp
+  801ddf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801de3:	89 f0                	mov    %esi,%eax
+  801de5:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801de8:	eb 11                	jmp    801dfb <strfind+0x24>
+    if (*s == c)
+  801dea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dee:	0f b6 00             	movzbl (%rax),%eax
+  801df1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801df4:	74 12                	je     801e08 <strfind+0x31>
+  for (; *s; s++)
+  801df6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801dfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dff:	0f b6 00             	movzbl (%rax),%eax
+  801e02:	84 c0                	test   %al,%al
+  801e04:	75 e4                	jne    801dea <strfind+0x13>
+  801e06:	eb 01                	jmp    801e09 <strfind+0x32>
+      break;
+  801e08:	90                   	nop
+  return (char *)s;
+  801e09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801e0d:	c9                   	leave
+  801e0e:	c3                   	ret
+
+0000000000801e0f <memset>:
+memset(void *v, int c, size_t n) {
+  801e0f:	55                   	push   %rbp
+  801e10:	48 89 e5             	mov    %rsp,%rbp
+  801e13:	48 83 ec 38          	sub    $0x38,%rsp
+  801e17:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e1b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801e1e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801e22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e26:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e2a:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e2f:	76 41                	jbe    801e72 <memset+0x63>
+  801e31:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  801e38:	00 00 00 
+  801e3b:	ff d0                	call   *%rax
+  801e3d:	83 e0 01             	and    $0x1,%eax
+  801e40:	85 c0                	test   %eax,%eax
+  801e42:	74 2e                	je     801e72 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801e44:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801e47:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801e4b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e4f:	48 89 ce             	mov    %rcx,%rsi
+  801e52:	48 89 f7             	mov    %rsi,%rdi
+  801e55:	48 89 d1             	mov    %rdx,%rcx
+  801e58:	fc                   	cld
+  801e59:	f3 aa                	rep stos %al,%es:(%rdi)
+  801e5b:	48 89 ca             	mov    %rcx,%rdx
+  801e5e:	48 89 fe             	mov    %rdi,%rsi
+  801e61:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801e65:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801e69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6d:	e9 a7 00 00 00       	jmp    801f19 <memset+0x10a>
+  if (n >= 8) {
+  801e72:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801e77:	0f 86 87 00 00 00    	jbe    801f04 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801e7d:	eb 16                	jmp    801e95 <memset+0x86>
+      *p++ = c;
+  801e7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e83:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e87:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e8b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801e8e:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801e90:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801e95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e99:	83 e0 07             	and    $0x7,%eax
+  801e9c:	48 85 c0             	test   %rax,%rax
+  801e9f:	75 de                	jne    801e7f <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801ea1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ea4:	0f b6 c0             	movzbl %al,%eax
+  801ea7:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801eae:	01 01 01 
+  801eb1:	48 0f af c2          	imul   %rdx,%rax
+  801eb5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801eb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ebd:	48 c1 e8 03          	shr    $0x3,%rax
+  801ec1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801ec5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ecd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ed1:	48 89 ce             	mov    %rcx,%rsi
+  801ed4:	48 89 f7             	mov    %rsi,%rdi
+  801ed7:	48 89 d1             	mov    %rdx,%rcx
+  801eda:	fc                   	cld
+  801edb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ede:	48 89 ca             	mov    %rcx,%rdx
+  801ee1:	48 89 fe             	mov    %rdi,%rsi
+  801ee4:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801ee8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801eec:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ef1:	eb 11                	jmp    801f04 <memset+0xf5>
+    *p++ = c;
+  801ef3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801efb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801eff:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801f02:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801f04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f08:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f0c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f10:	48 85 c0             	test   %rax,%rax
+  801f13:	75 de                	jne    801ef3 <memset+0xe4>
+  return v;
+  801f15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+0000000000801f1b <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	48 83 ec 38          	sub    $0x38,%rsp
+  801f23:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f27:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f2b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801f2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f33:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801f37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f43:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801f47:	0f 83 da 00 00 00    	jae    802027 <memmove+0x10c>
+  801f4d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f55:	48 01 d0             	add    %rdx,%rax
+  801f58:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801f5c:	0f 83 c5 00 00 00    	jae    802027 <memmove+0x10c>
+    s += n;
+  801f62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f66:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801f6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f6e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801f72:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801f77:	0f 86 94 00 00 00    	jbe    802011 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801f7d:	eb 1c                	jmp    801f9b <memmove+0x80>
+        *--d = *--s;
+  801f7f:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801f84:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801f89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f8d:	0f b6 10             	movzbl (%rax),%edx
+  801f90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f94:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801f96:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801f9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f9f:	83 e0 07             	and    $0x7,%eax
+  801fa2:	48 85 c0             	test   %rax,%rax
+  801fa5:	75 d8                	jne    801f7f <memmove+0x64>
+      nq = n / 8;
+  801fa7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fab:	48 c1 e8 03          	shr    $0x3,%rax
+  801faf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801fb3:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801fb8:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801fbd:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801fc2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fc6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fce:	48 89 cf             	mov    %rcx,%rdi
+  801fd1:	48 89 d6             	mov    %rdx,%rsi
+  801fd4:	48 89 c1             	mov    %rax,%rcx
+  801fd7:	fd                   	std
+  801fd8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801fdb:	fc                   	cld
+  801fdc:	48 89 c8             	mov    %rcx,%rax
+  801fdf:	48 89 f2             	mov    %rsi,%rdx
+  801fe2:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801fe6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801fea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801fee:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801ff3:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801ff8:	eb 17                	jmp    802011 <memmove+0xf6>
+      *--d = *--s;
+  801ffa:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801fff:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  802004:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802008:	0f b6 10             	movzbl (%rax),%edx
+  80200b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80200f:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  802011:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802015:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802019:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80201d:	48 85 c0             	test   %rax,%rax
+  802020:	75 d8                	jne    801ffa <memmove+0xdf>
+  if (s < d && s + n > d) {
+  802022:	e9 f4 00 00 00       	jmp    80211b <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802027:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80202c:	76 46                	jbe    802074 <memmove+0x159>
+  80202e:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  802035:	00 00 00 
+  802038:	ff d0                	call   *%rax
+  80203a:	83 e0 01             	and    $0x1,%eax
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	74 33                	je     802074 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  802041:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802045:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802049:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80204d:	48 89 cf             	mov    %rcx,%rdi
+  802050:	48 89 d6             	mov    %rdx,%rsi
+  802053:	48 89 c1             	mov    %rax,%rcx
+  802056:	fc                   	cld
+  802057:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802059:	48 89 c8             	mov    %rcx,%rax
+  80205c:	48 89 f2             	mov    %rsi,%rdx
+  80205f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802063:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802067:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80206b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206f:	e9 ab 00 00 00       	jmp    80211f <memmove+0x204>
+    if (n >= 8) {
+  802074:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802079:	0f 86 8b 00 00 00    	jbe    80210a <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80207f:	eb 22                	jmp    8020a3 <memmove+0x188>
+        *d++ = *s++;
+  802081:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802085:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802089:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80208d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802091:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802095:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802099:	0f b6 12             	movzbl (%rdx),%edx
+  80209c:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80209e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8020a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020a7:	83 e0 07             	and    $0x7,%eax
+  8020aa:	48 85 c0             	test   %rax,%rax
+  8020ad:	75 d2                	jne    802081 <memmove+0x166>
+      nq = n / 8;
+  8020af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b3:	48 c1 e8 03          	shr    $0x3,%rax
+  8020b7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8020bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020c7:	48 89 cf             	mov    %rcx,%rdi
+  8020ca:	48 89 d6             	mov    %rdx,%rsi
+  8020cd:	48 89 c1             	mov    %rax,%rcx
+  8020d0:	fc                   	cld
+  8020d1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8020d4:	48 89 c8             	mov    %rcx,%rax
+  8020d7:	48 89 f2             	mov    %rsi,%rdx
+  8020da:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8020de:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8020e2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8020e6:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8020eb:	eb 1d                	jmp    80210a <memmove+0x1ef>
+      *d++ = *s++;
+  8020ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8020f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8020f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802101:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802105:	0f b6 12             	movzbl (%rdx),%edx
+  802108:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80210a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80210e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802112:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802116:	48 85 c0             	test   %rax,%rax
+  802119:	75 d2                	jne    8020ed <memmove+0x1d2>
+  return dst;
+  80211b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+
+0000000000802121 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+  802125:	48 83 ec 18          	sub    $0x18,%rsp
+  802129:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80212d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802131:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  802135:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802139:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80213d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802141:	48 89 ce             	mov    %rcx,%rsi
+  802144:	48 89 c7             	mov    %rax,%rdi
+  802147:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  80214e:	00 00 00 
+  802151:	ff d0                	call   *%rax
+}
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+0000000000802155 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  802155:	55                   	push   %rbp
+  802156:	48 89 e5             	mov    %rsp,%rbp
+  802159:	48 83 ec 40          	sub    $0x40,%rsp
+  80215d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802161:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802165:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  802169:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80216d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  802171:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802175:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802179:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80217e:	0f 86 a7 00 00 00    	jbe    80222b <memcmp+0xd6>
+  802184:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+  802190:	83 e0 02             	and    $0x2,%eax
+  802193:	85 c0                	test   %eax,%eax
+  802195:	0f 84 90 00 00 00    	je     80222b <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80219b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80219f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021a7:	48 89 ce             	mov    %rcx,%rsi
+  8021aa:	48 89 c7             	mov    %rax,%rdi
+  8021ad:	48 b8 3c 17 80 00 00 	movabs $0x80173c,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	e9 c2 00 00 00       	jmp    802280 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8021be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021c2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8021c6:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8021ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021ce:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8021d2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8021d6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8021da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8021dd:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8021e4:	74 36                	je     80221c <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8021e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021e9:	f7 d0                	not    %eax
+  8021eb:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8021ef:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8021f2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8021f5:	48 63 d0             	movslq %eax,%rdx
+  8021f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021fc:	48 01 d0             	add    %rdx,%rax
+  8021ff:	0f b6 00             	movzbl (%rax),%eax
+  802202:	0f b6 c0             	movzbl %al,%eax
+  802205:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802208:	48 63 ca             	movslq %edx,%rcx
+  80220b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80220f:	48 01 ca             	add    %rcx,%rdx
+  802212:	0f b6 12             	movzbl (%rdx),%edx
+  802215:	0f b6 d2             	movzbl %dl,%edx
+  802218:	29 d0                	sub    %edx,%eax
+  80221a:	eb 64                	jmp    802280 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80221c:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  802221:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802226:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80222b:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802230:	77 8c                	ja     8021be <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802232:	eb 36                	jmp    80226a <memcmp+0x115>
+    if (*s1 != *s2)
+  802234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802238:	0f b6 10             	movzbl (%rax),%edx
+  80223b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80223f:	0f b6 00             	movzbl (%rax),%eax
+  802242:	38 c2                	cmp    %al,%dl
+  802244:	74 1a                	je     802260 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802246:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80224a:	0f b6 00             	movzbl (%rax),%eax
+  80224d:	0f b6 c8             	movzbl %al,%ecx
+  802250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802254:	0f b6 00             	movzbl (%rax),%eax
+  802257:	0f b6 d0             	movzbl %al,%edx
+  80225a:	89 c8                	mov    %ecx,%eax
+  80225c:	29 d0                	sub    %edx,%eax
+  80225e:	eb 20                	jmp    802280 <memcmp+0x12b>
+    s1++, s2++;
+  802260:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802265:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80226a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80226e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802272:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802276:	48 85 c0             	test   %rax,%rax
+  802279:	75 b9                	jne    802234 <memcmp+0xdf>
+  }
+
+  return 0;
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+0000000000802282 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802282:	55                   	push   %rbp
+  802283:	48 89 e5             	mov    %rsp,%rbp
+  802286:	48 83 ec 50          	sub    $0x50,%rsp
+  80228a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80228e:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802291:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802295:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802299:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80229d:	48 01 d0             	add    %rdx,%rax
+  8022a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8022a4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8022a7:	66 0f 6e c0          	movd   %eax,%xmm0
+  8022ab:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8022af:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8022b3:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8022b8:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8022bc:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8022c1:	76 73                	jbe    802336 <memfind+0xb4>
+  8022c3:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	83 e0 02             	and    $0x2,%eax
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	74 60                	je     802336 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8022d6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8022d9:	0f b6 c8             	movzbl %al,%ecx
+  8022dc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8022e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e4:	89 ce                	mov    %ecx,%esi
+  8022e6:	48 89 c7             	mov    %rax,%rdi
+  8022e9:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+  8022f5:	eb 6c                	jmp    802363 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8022f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022fb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8022ff:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802303:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802308:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80230c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802310:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802313:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802317:	74 13                	je     80232c <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802319:	31 c0                	xor    %eax,%eax
+  80231b:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802320:	48 63 d0             	movslq %eax,%rdx
+  802323:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802327:	48 01 d0             	add    %rdx,%rax
+  80232a:	eb 37                	jmp    802363 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  80232c:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802331:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802336:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  80233b:	77 ba                	ja     8022f7 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80233d:	eb 13                	jmp    802352 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  80233f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802343:	0f b6 00             	movzbl (%rax),%eax
+  802346:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802349:	38 d0                	cmp    %dl,%al
+  80234b:	74 11                	je     80235e <memfind+0xdc>
+  for (; s < ends; s++)
+  80234d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802352:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802356:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80235a:	72 e3                	jb     80233f <memfind+0xbd>
+  80235c:	eb 01                	jmp    80235f <memfind+0xdd>
+      break;
+  80235e:	90                   	nop
+  return (void *)s;
+  80235f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802363:	c9                   	leave
+  802364:	c3                   	ret
+
+0000000000802365 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802365:	55                   	push   %rbp
+  802366:	48 89 e5             	mov    %rsp,%rbp
+  802369:	48 83 ec 38          	sub    $0x38,%rsp
+  80236d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802371:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802375:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802378:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  80237f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802386:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802387:	eb 05                	jmp    80238e <strtol+0x29>
+    s++;
+  802389:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80238e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802392:	0f b6 00             	movzbl (%rax),%eax
+  802395:	3c 20                	cmp    $0x20,%al
+  802397:	74 f0                	je     802389 <strtol+0x24>
+  802399:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80239d:	0f b6 00             	movzbl (%rax),%eax
+  8023a0:	3c 09                	cmp    $0x9,%al
+  8023a2:	74 e5                	je     802389 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8023a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a8:	0f b6 00             	movzbl (%rax),%eax
+  8023ab:	3c 2b                	cmp    $0x2b,%al
+  8023ad:	75 07                	jne    8023b6 <strtol+0x51>
+    s++;
+  8023af:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023b4:	eb 17                	jmp    8023cd <strtol+0x68>
+  else if (*s == '-')
+  8023b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ba:	0f b6 00             	movzbl (%rax),%eax
+  8023bd:	3c 2d                	cmp    $0x2d,%al
+  8023bf:	75 0c                	jne    8023cd <strtol+0x68>
+    s++, neg = 1;
+  8023c1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023c6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8023cd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8023d1:	74 06                	je     8023d9 <strtol+0x74>
+  8023d3:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8023d7:	75 28                	jne    802401 <strtol+0x9c>
+  8023d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023dd:	0f b6 00             	movzbl (%rax),%eax
+  8023e0:	3c 30                	cmp    $0x30,%al
+  8023e2:	75 1d                	jne    802401 <strtol+0x9c>
+  8023e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023e8:	48 83 c0 01          	add    $0x1,%rax
+  8023ec:	0f b6 00             	movzbl (%rax),%eax
+  8023ef:	3c 78                	cmp    $0x78,%al
+  8023f1:	75 0e                	jne    802401 <strtol+0x9c>
+    s += 2, base = 16;
+  8023f3:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8023f8:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8023ff:	eb 2c                	jmp    80242d <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802401:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802405:	75 19                	jne    802420 <strtol+0xbb>
+  802407:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80240b:	0f b6 00             	movzbl (%rax),%eax
+  80240e:	3c 30                	cmp    $0x30,%al
+  802410:	75 0e                	jne    802420 <strtol+0xbb>
+    s++, base = 8;
+  802412:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802417:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80241e:	eb 0d                	jmp    80242d <strtol+0xc8>
+  else if (base == 0)
+  802420:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802424:	75 07                	jne    80242d <strtol+0xc8>
+    base = 10;
+  802426:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80242d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802431:	0f b6 00             	movzbl (%rax),%eax
+  802434:	3c 2f                	cmp    $0x2f,%al
+  802436:	7e 1d                	jle    802455 <strtol+0xf0>
+  802438:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80243c:	0f b6 00             	movzbl (%rax),%eax
+  80243f:	3c 39                	cmp    $0x39,%al
+  802441:	7f 12                	jg     802455 <strtol+0xf0>
+      dig = *s - '0';
+  802443:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802447:	0f b6 00             	movzbl (%rax),%eax
+  80244a:	0f be c0             	movsbl %al,%eax
+  80244d:	83 e8 30             	sub    $0x30,%eax
+  802450:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802453:	eb 4e                	jmp    8024a3 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802455:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802459:	0f b6 00             	movzbl (%rax),%eax
+  80245c:	3c 60                	cmp    $0x60,%al
+  80245e:	7e 1d                	jle    80247d <strtol+0x118>
+  802460:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802464:	0f b6 00             	movzbl (%rax),%eax
+  802467:	3c 7a                	cmp    $0x7a,%al
+  802469:	7f 12                	jg     80247d <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80246b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80246f:	0f b6 00             	movzbl (%rax),%eax
+  802472:	0f be c0             	movsbl %al,%eax
+  802475:	83 e8 57             	sub    $0x57,%eax
+  802478:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80247b:	eb 26                	jmp    8024a3 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80247d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802481:	0f b6 00             	movzbl (%rax),%eax
+  802484:	3c 40                	cmp    $0x40,%al
+  802486:	7e 47                	jle    8024cf <strtol+0x16a>
+  802488:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80248c:	0f b6 00             	movzbl (%rax),%eax
+  80248f:	3c 5a                	cmp    $0x5a,%al
+  802491:	7f 3c                	jg     8024cf <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802493:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802497:	0f b6 00             	movzbl (%rax),%eax
+  80249a:	0f be c0             	movsbl %al,%eax
+  80249d:	83 e8 37             	sub    $0x37,%eax
+  8024a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8024a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024a6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8024a9:	7d 23                	jge    8024ce <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8024ab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8024b0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024b3:	48 98                	cltq
+  8024b5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8024ba:	48 89 c2             	mov    %rax,%rdx
+  8024bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024c0:	48 98                	cltq
+  8024c2:	48 01 d0             	add    %rdx,%rax
+  8024c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8024c9:	e9 5f ff ff ff       	jmp    80242d <strtol+0xc8>
+      break;
+  8024ce:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8024cf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8024d4:	74 0b                	je     8024e1 <strtol+0x17c>
+    *endptr = (char *)s;
+  8024d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024de:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8024e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024e5:	74 09                	je     8024f0 <strtol+0x18b>
+  8024e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024eb:	48 f7 d8             	neg    %rax
+  8024ee:	eb 04                	jmp    8024f4 <strtol+0x18f>
+  8024f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8024f4:	c9                   	leave
+  8024f5:	c3                   	ret
+
+00000000008024f6 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8024f6:	55                   	push   %rbp
+  8024f7:	48 89 e5             	mov    %rsp,%rbp
+  8024fa:	53                   	push   %rbx
+  8024fb:	48 83 ec 48          	sub    $0x48,%rsp
+  8024ff:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802503:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802507:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80250b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80250f:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802513:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802517:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80251b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80251f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802523:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802527:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80252b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80252f:	4c 89 c3             	mov    %r8,%rbx
+  802532:	cd 30                	int    $0x30
+  802534:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802538:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80253d:	74 46                	je     802585 <syscall+0x8f>
+  80253f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802544:	7e 3f                	jle    802585 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802546:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80254a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80254e:	49 89 d0             	mov    %rdx,%r8
+  802551:	48 89 c1             	mov    %rax,%rcx
+  802554:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  80255b:	00 00 00 
+  80255e:	48 89 c2             	mov    %rax,%rdx
+  802561:	be 22 00 00 00       	mov    $0x22,%esi
+  802566:	48 b8 87 60 80 00 00 	movabs $0x806087,%rax
+  80256d:	00 00 00 
+  802570:	48 89 c7             	mov    %rax,%rdi
+  802573:	b8 00 00 00 00       	mov    $0x0,%eax
+  802578:	49 b9 09 08 80 00 00 	movabs $0x800809,%r9
+  80257f:	00 00 00 
+  802582:	41 ff d1             	call   *%r9
+
+  return ret;
+  802585:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80258d:	c9                   	leave
+  80258e:	c3                   	ret
+
+000000000080258f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	48 83 ec 10          	sub    $0x10,%rsp
+  802597:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80259b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80259f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ab:	6a 00                	push   $0x0
+  8025ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025b9:	48 89 d1             	mov    %rdx,%rcx
+  8025bc:	48 89 c2             	mov    %rax,%rdx
+  8025bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c9:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+  8025d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025d9:	90                   	nop
+  8025da:	c9                   	leave
+  8025db:	c3                   	ret
+
+00000000008025dc <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8025dc:	55                   	push   %rbp
+  8025dd:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8025e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e4:	6a 00                	push   $0x0
+  8025e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802601:	bf 01 00 00 00       	mov    $0x1,%edi
+  802606:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  80260d:	00 00 00 
+  802610:	ff d0                	call   *%rax
+  802612:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+0000000000802618 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	48 83 ec 10          	sub    $0x10,%rsp
+  802620:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802623:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802626:	48 98                	cltq
+  802628:	48 83 ec 08          	sub    $0x8,%rsp
+  80262c:	6a 00                	push   $0x0
+  80262e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80263a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263f:	48 89 c2             	mov    %rax,%rdx
+  802642:	be 01 00 00 00       	mov    $0x1,%esi
+  802647:	bf 03 00 00 00       	mov    $0x3,%edi
+  80264c:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80265c:	c9                   	leave
+  80265d:	c3                   	ret
+
+000000000080265e <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80265e:	55                   	push   %rbp
+  80265f:	48 89 e5             	mov    %rsp,%rbp
+  802662:	48 83 ec 10          	sub    $0x10,%rsp
+  802666:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802669:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80266c:	48 98                	cltq
+  80266e:	48 83 ec 08          	sub    $0x8,%rsp
+  802672:	6a 00                	push   $0x0
+  802674:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80267a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802685:	48 89 c2             	mov    %rax,%rdx
+  802688:	be 00 00 00 00       	mov    $0x0,%esi
+  80268d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802692:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802699:	00 00 00 
+  80269c:	ff d0                	call   *%rax
+  80269e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a2:	90                   	nop
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+00000000008026a5 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8026a5:	55                   	push   %rbp
+  8026a6:	48 89 e5             	mov    %rsp,%rbp
+  8026a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8026ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8026b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026b7:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8026ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026bf:	cd 30                	int    $0x30
+  8026c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8026c5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8026c9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8026ce:	7e 3d                	jle    80270d <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8026d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d4:	49 89 c0             	mov    %rax,%r8
+  8026d7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8026dc:	48 b8 68 60 80 00 00 	movabs $0x806068,%rax
+  8026e3:	00 00 00 
+  8026e6:	48 89 c2             	mov    %rax,%rdx
+  8026e9:	be 49 00 00 00       	mov    $0x49,%esi
+  8026ee:	48 b8 87 60 80 00 00 	movabs $0x806087,%rax
+  8026f5:	00 00 00 
+  8026f8:	48 89 c7             	mov    %rax,%rdi
+  8026fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802700:	49 b9 09 08 80 00 00 	movabs $0x800809,%r9
+  802707:	00 00 00 
+  80270a:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80270d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802712:	75 13                	jne    802727 <sys_env_wait+0x82>
+  802714:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802719:	74 0c                	je     802727 <sys_env_wait+0x82>
+    *status = st;
+  80271b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80271f:	89 c2                	mov    %eax,%edx
+  802721:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802725:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+
+000000000080272d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80272d:	55                   	push   %rbp
+  80272e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802731:	48 83 ec 08          	sub    $0x8,%rsp
+  802735:	6a 00                	push   $0x0
+  802737:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274d:	be 00 00 00 00       	mov    $0x0,%esi
+  802752:	bf 02 00 00 00       	mov    $0x2,%edi
+  802757:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+  802763:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802767:	c9                   	leave
+  802768:	c3                   	ret
+
+0000000000802769 <sys_yield>:
+
+void
+sys_yield(void) {
+  802769:	55                   	push   %rbp
+  80276a:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80276d:	48 83 ec 08          	sub    $0x8,%rsp
+  802771:	6a 00                	push   $0x0
+  802773:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802779:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80277f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802784:	ba 00 00 00 00       	mov    $0x0,%edx
+  802789:	be 00 00 00 00       	mov    $0x0,%esi
+  80278e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802793:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+  80279f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027a3:	90                   	nop
+  8027a4:	c9                   	leave
+  8027a5:	c3                   	ret
+
+00000000008027a6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8027a6:	55                   	push   %rbp
+  8027a7:	48 89 e5             	mov    %rsp,%rbp
+  8027aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8027ae:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027b5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8027b8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8027bb:	48 63 c8             	movslq %eax,%rcx
+  8027be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8027c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027c5:	48 98                	cltq
+  8027c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d3:	49 89 c8             	mov    %rcx,%r8
+  8027d6:	48 89 d1             	mov    %rdx,%rcx
+  8027d9:	48 89 c2             	mov    %rax,%rdx
+  8027dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8027e1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027e6:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+  8027f2:	48 83 c4 10          	add    $0x10,%rsp
+  8027f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8027f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8027fc:	c9                   	leave
+  8027fd:	c3                   	ret
+
+00000000008027fe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8027fe:	55                   	push   %rbp
+  8027ff:	48 89 e5             	mov    %rsp,%rbp
+  802802:	48 83 ec 20          	sub    $0x20,%rsp
+  802806:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802809:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80280d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802810:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802814:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802818:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80281b:	48 63 c8             	movslq %eax,%rcx
+  80281e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802822:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802825:	48 63 f0             	movslq %eax,%rsi
+  802828:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80282c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80282f:	48 98                	cltq
+  802831:	48 83 ec 08          	sub    $0x8,%rsp
+  802835:	51                   	push   %rcx
+  802836:	49 89 f9             	mov    %rdi,%r9
+  802839:	49 89 f0             	mov    %rsi,%r8
+  80283c:	48 89 d1             	mov    %rdx,%rcx
+  80283f:	48 89 c2             	mov    %rax,%rdx
+  802842:	be 01 00 00 00       	mov    $0x1,%esi
+  802847:	bf 07 00 00 00       	mov    $0x7,%edi
+  80284c:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+  802858:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80285c:	c9                   	leave
+  80285d:	c3                   	ret
+
+000000000080285e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80285e:	55                   	push   %rbp
+  80285f:	48 89 e5             	mov    %rsp,%rbp
+  802862:	48 83 ec 10          	sub    $0x10,%rsp
+  802866:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802869:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80286d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802871:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802874:	48 98                	cltq
+  802876:	48 83 ec 08          	sub    $0x8,%rsp
+  80287a:	6a 00                	push   $0x0
+  80287c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802882:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802888:	48 89 d1             	mov    %rdx,%rcx
+  80288b:	48 89 c2             	mov    %rax,%rdx
+  80288e:	be 01 00 00 00       	mov    $0x1,%esi
+  802893:	bf 08 00 00 00       	mov    $0x8,%edi
+  802898:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  80289f:	00 00 00 
+  8028a2:	ff d0                	call   *%rax
+  8028a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a8:	c9                   	leave
+  8028a9:	c3                   	ret
+
+00000000008028aa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8028aa:	55                   	push   %rbp
+  8028ab:	48 89 e5             	mov    %rsp,%rbp
+  8028ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028b5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8028b8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8028bb:	48 63 d0             	movslq %eax,%rdx
+  8028be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028c1:	48 98                	cltq
+  8028c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c7:	6a 00                	push   $0x0
+  8028c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028d5:	48 89 d1             	mov    %rdx,%rcx
+  8028d8:	48 89 c2             	mov    %rax,%rdx
+  8028db:	be 01 00 00 00       	mov    $0x1,%esi
+  8028e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8028e5:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+  8028f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+
+00000000008028f7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f7:	55                   	push   %rbp
+  8028f8:	48 89 e5             	mov    %rsp,%rbp
+  8028fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802902:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802906:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80290a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80290d:	48 98                	cltq
+  80290f:	48 83 ec 08          	sub    $0x8,%rsp
+  802913:	6a 00                	push   $0x0
+  802915:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802921:	48 89 d1             	mov    %rdx,%rcx
+  802924:	48 89 c2             	mov    %rax,%rdx
+  802927:	be 01 00 00 00       	mov    $0x1,%esi
+  80292c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802931:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+0000000000802943 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	48 83 ec 10          	sub    $0x10,%rsp
+  80294b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80294e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802952:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802956:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802959:	48 98                	cltq
+  80295b:	48 83 ec 08          	sub    $0x8,%rsp
+  80295f:	6a 00                	push   $0x0
+  802961:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802967:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80296d:	48 89 d1             	mov    %rdx,%rcx
+  802970:	48 89 c2             	mov    %rax,%rdx
+  802973:	be 01 00 00 00       	mov    $0x1,%esi
+  802978:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80297d:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+  802989:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+
+000000000080298f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	48 83 ec 20          	sub    $0x20,%rsp
+  802997:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80299a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80299e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8029a2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8029a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8029a8:	48 63 f0             	movslq %eax,%rsi
+  8029ab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b6:	48 98                	cltq
+  8029b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bc:	6a 00                	push   $0x0
+  8029be:	49 89 f1             	mov    %rsi,%r9
+  8029c1:	49 89 c8             	mov    %rcx,%r8
+  8029c4:	48 89 d1             	mov    %rdx,%rcx
+  8029c7:	48 89 c2             	mov    %rax,%rdx
+  8029ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cf:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8029d4:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+  8029e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+00000000008029e6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8029f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fa:	6a 00                	push   $0x0
+  8029fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a0d:	48 89 c2             	mov    %rax,%rdx
+  802a10:	be 01 00 00 00       	mov    $0x1,%esi
+  802a15:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a1a:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802a21:	00 00 00 
+  802a24:	ff d0                	call   *%rax
+  802a26:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a2a:	c9                   	leave
+  802a2b:	c3                   	ret
+
+0000000000802a2c <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802a2c:	55                   	push   %rbp
+  802a2d:	48 89 e5             	mov    %rsp,%rbp
+  802a30:	48 83 ec 10          	sub    $0x10,%rsp
+  802a34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802a3c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a44:	48 83 ec 08          	sub    $0x8,%rsp
+  802a48:	6a 00                	push   $0x0
+  802a4a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a56:	48 89 d1             	mov    %rdx,%rcx
+  802a59:	48 89 c2             	mov    %rax,%rdx
+  802a5c:	be 01 00 00 00       	mov    $0x1,%esi
+  802a61:	bf 10 00 00 00       	mov    $0x10,%edi
+  802a66:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802a6d:	00 00 00 
+  802a70:	ff d0                	call   *%rax
+  802a72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a76:	c9                   	leave
+  802a77:	c3                   	ret
+
+0000000000802a78 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802a78:	55                   	push   %rbp
+  802a79:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802a7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a80:	6a 00                	push   $0x0
+  802a82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a93:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a98:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9d:	bf 11 00 00 00       	mov    $0x11,%edi
+  802aa2:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802aa9:	00 00 00 
+  802aac:	ff d0                	call   *%rax
+  802aae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+
+0000000000802ab4 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802ab4:	55                   	push   %rbp
+  802ab5:	48 89 e5             	mov    %rsp,%rbp
+  802ab8:	48 83 ec 10          	sub    $0x10,%rsp
+  802abc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ac0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802ac4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ac8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802acc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ad8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ade:	48 89 d1             	mov    %rdx,%rcx
+  802ae1:	48 89 c2             	mov    %rax,%rdx
+  802ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae9:	bf 12 00 00 00       	mov    $0x12,%edi
+  802aee:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+  802afa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+0000000000802b00 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802b00:	55                   	push   %rbp
+  802b01:	48 89 e5             	mov    %rsp,%rbp
+  802b04:	48 83 ec 20          	sub    $0x20,%rsp
+  802b08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b0c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b10:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802b13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b16:	48 63 c8             	movslq %eax,%rcx
+  802b19:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b21:	48 83 ec 08          	sub    $0x8,%rsp
+  802b25:	6a 00                	push   $0x0
+  802b27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b2d:	49 89 c8             	mov    %rcx,%r8
+  802b30:	48 89 d1             	mov    %rdx,%rcx
+  802b33:	48 89 c2             	mov    %rax,%rdx
+  802b36:	be 00 00 00 00       	mov    $0x0,%esi
+  802b3b:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b40:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802b47:	00 00 00 
+  802b4a:	ff d0                	call   *%rax
+  802b4c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+
+0000000000802b52 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802b52:	55                   	push   %rbp
+  802b53:	48 89 e5             	mov    %rsp,%rbp
+  802b56:	48 83 ec 20          	sub    $0x20,%rsp
+  802b5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b5e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802b61:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802b65:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802b69:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802b6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b70:	48 83 ec 08          	sub    $0x8,%rsp
+  802b74:	6a 00                	push   $0x0
+  802b76:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b7c:	49 89 c8             	mov    %rcx,%r8
+  802b7f:	48 89 d1             	mov    %rdx,%rcx
+  802b82:	48 89 c2             	mov    %rax,%rdx
+  802b85:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8a:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b8f:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+  802b9b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+0000000000802ba1 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+  802ba5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ba9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bad:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802bb0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802bb3:	48 63 d0             	movslq %eax,%rdx
+  802bb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bba:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbe:	6a 00                	push   $0x0
+  802bc0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bcc:	48 89 d1             	mov    %rdx,%rcx
+  802bcf:	48 89 c2             	mov    %rax,%rdx
+  802bd2:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd7:	bf 15 00 00 00       	mov    $0x15,%edi
+  802bdc:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+  802be8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bec:	c9                   	leave
+  802bed:	c3                   	ret
+
+0000000000802bee <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802bee:	55                   	push   %rbp
+  802bef:	48 89 e5             	mov    %rsp,%rbp
+  802bf2:	48 83 ec 20          	sub    $0x20,%rsp
+  802bf6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bfa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802bfd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802c00:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802c04:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c08:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802c0b:	48 63 c8             	movslq %eax,%rcx
+  802c0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802c11:	48 63 d0             	movslq %eax,%rdx
+  802c14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c18:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1c:	6a 00                	push   $0x0
+  802c1e:	49 89 f1             	mov    %rsi,%r9
+  802c21:	49 89 c8             	mov    %rcx,%r8
+  802c24:	48 89 d1             	mov    %rdx,%rcx
+  802c27:	48 89 c2             	mov    %rax,%rdx
+  802c2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c2f:	bf 16 00 00 00       	mov    $0x16,%edi
+  802c34:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802c3b:	00 00 00 
+  802c3e:	ff d0                	call   *%rax
+  802c40:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c44:	c9                   	leave
+  802c45:	c3                   	ret
+
+0000000000802c46 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	48 83 ec 30          	sub    $0x30,%rsp
+  802c4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c52:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c56:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802c5a:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802c5e:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802c62:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802c66:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802c6a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c6e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c76:	48 83 ec 08          	sub    $0x8,%rsp
+  802c7a:	51                   	push   %rcx
+  802c7b:	49 89 f9             	mov    %rdi,%r9
+  802c7e:	49 89 f0             	mov    %rsi,%r8
+  802c81:	48 89 d1             	mov    %rdx,%rcx
+  802c84:	48 89 c2             	mov    %rax,%rdx
+  802c87:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8c:	bf 17 00 00 00       	mov    $0x17,%edi
+  802c91:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802c98:	00 00 00 
+  802c9b:	ff d0                	call   *%rax
+  802c9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ca1:	c9                   	leave
+  802ca2:	c3                   	ret
+
+0000000000802ca3 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802ca3:	55                   	push   %rbp
+  802ca4:	48 89 e5             	mov    %rsp,%rbp
+  802ca7:	48 83 ec 10          	sub    $0x10,%rsp
+  802cab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802cae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cb1:	48 98                	cltq
+  802cb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb7:	6a 00                	push   $0x0
+  802cb9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cca:	48 89 c2             	mov    %rax,%rdx
+  802ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd2:	bf 18 00 00 00       	mov    $0x18,%edi
+  802cd7:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+  802ce3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ce7:	90                   	nop
+  802ce8:	c9                   	leave
+  802ce9:	c3                   	ret
+
+0000000000802cea <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802cea:	55                   	push   %rbp
+  802ceb:	48 89 e5             	mov    %rsp,%rbp
+  802cee:	48 83 ec 30          	sub    $0x30,%rsp
+  802cf2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cf5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802cf9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802cfd:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802d00:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d03:	48 63 f0             	movslq %eax,%rsi
+  802d06:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802d0a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d11:	48 98                	cltq
+  802d13:	48 83 ec 08          	sub    $0x8,%rsp
+  802d17:	6a 00                	push   $0x0
+  802d19:	49 89 f1             	mov    %rsi,%r9
+  802d1c:	49 89 c8             	mov    %rcx,%r8
+  802d1f:	48 89 d1             	mov    %rdx,%rcx
+  802d22:	48 89 c2             	mov    %rax,%rdx
+  802d25:	be 01 00 00 00       	mov    $0x1,%esi
+  802d2a:	bf 19 00 00 00       	mov    $0x19,%edi
+  802d2f:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802d36:	00 00 00 
+  802d39:	ff d0                	call   *%rax
+  802d3b:	48 83 c4 10          	add    $0x10,%rsp
+  802d3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802d42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d45:	c9                   	leave
+  802d46:	c3                   	ret
+
+0000000000802d47 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802d47:	55                   	push   %rbp
+  802d48:	48 89 e5             	mov    %rsp,%rbp
+  802d4b:	48 83 ec 20          	sub    $0x20,%rsp
+  802d4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d53:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d57:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802d5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d5d:	48 63 c8             	movslq %eax,%rcx
+  802d60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802d64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d68:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6c:	6a 00                	push   $0x0
+  802d6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d74:	49 89 c8             	mov    %rcx,%r8
+  802d77:	48 89 d1             	mov    %rdx,%rcx
+  802d7a:	48 89 c2             	mov    %rax,%rdx
+  802d7d:	be 01 00 00 00       	mov    $0x1,%esi
+  802d82:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802d87:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+  802d93:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d97:	c9                   	leave
+  802d98:	c3                   	ret
+
+0000000000802d99 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	48 83 ec 20          	sub    $0x20,%rsp
+  802da1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802da5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802da9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802dad:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802db1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802db9:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbd:	6a 00                	push   $0x0
+  802dbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dc5:	49 89 c8             	mov    %rcx,%r8
+  802dc8:	48 89 d1             	mov    %rdx,%rcx
+  802dcb:	48 89 c2             	mov    %rax,%rdx
+  802dce:	be 01 00 00 00       	mov    $0x1,%esi
+  802dd3:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802dd8:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802ddf:	00 00 00 
+  802de2:	ff d0                	call   *%rax
+  802de4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802de8:	c9                   	leave
+  802de9:	c3                   	ret
+
+0000000000802dea <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802dea:	55                   	push   %rbp
+  802deb:	48 89 e5             	mov    %rsp,%rbp
+  802dee:	48 83 ec 30          	sub    $0x30,%rsp
+  802df2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802df6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802dfa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802dfd:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802e01:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e08:	48 63 c8             	movslq %eax,%rcx
+  802e0b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e13:	48 83 ec 08          	sub    $0x8,%rsp
+  802e17:	6a 00                	push   $0x0
+  802e19:	49 89 f1             	mov    %rsi,%r9
+  802e1c:	49 89 c8             	mov    %rcx,%r8
+  802e1f:	48 89 d1             	mov    %rdx,%rcx
+  802e22:	48 89 c2             	mov    %rax,%rdx
+  802e25:	be 01 00 00 00       	mov    $0x1,%esi
+  802e2a:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802e2f:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+  802e3b:	48 83 c4 10          	add    $0x10,%rsp
+  802e3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802e42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e45:	c9                   	leave
+  802e46:	c3                   	ret
+
+0000000000802e47 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802e47:	55                   	push   %rbp
+  802e48:	48 89 e5             	mov    %rsp,%rbp
+  802e4b:	48 83 ec 10          	sub    $0x10,%rsp
+  802e4f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802e52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e55:	48 98                	cltq
+  802e57:	48 83 ec 08          	sub    $0x8,%rsp
+  802e5b:	6a 00                	push   $0x0
+  802e5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e6e:	48 89 c2             	mov    %rax,%rdx
+  802e71:	be 01 00 00 00       	mov    $0x1,%esi
+  802e76:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802e7b:	48 b8 f6 24 80 00 00 	movabs $0x8024f6,%rax
+  802e82:	00 00 00 
+  802e85:	ff d0                	call   *%rax
+  802e87:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e8b:	c9                   	leave
+  802e8c:	c3                   	ret
+
+0000000000802e8d <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802e8d:	55                   	push   %rbp
+  802e8e:	48 89 e5             	mov    %rsp,%rbp
+  802e91:	48 83 ec 08          	sub    $0x8,%rsp
+  802e95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e9d:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802ea4:	ff ff ff 
+  802ea7:	48 01 d0             	add    %rdx,%rax
+  802eaa:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802eae:	c9                   	leave
+  802eaf:	c3                   	ret
+
+0000000000802eb0 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802ebc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ec0:	48 89 c7             	mov    %rax,%rdi
+  802ec3:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802ed5:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802ed9:	c9                   	leave
+  802eda:	c3                   	ret
+
+0000000000802edb <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802edb:	55                   	push   %rbp
+  802edc:	48 89 e5             	mov    %rsp,%rbp
+  802edf:	48 83 ec 18          	sub    $0x18,%rsp
+  802ee3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802ee7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802eee:	e9 ae 00 00 00       	jmp    802fa1 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802ef3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ef6:	c1 e0 0c             	shl    $0xc,%eax
+  802ef9:	48 98                	cltq
+  802efb:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802f00:	48 01 d0             	add    %rdx,%rax
+  802f03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802f07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f0b:	48 c1 e8 27          	shr    $0x27,%rax
+  802f0f:	48 89 c2             	mov    %rax,%rdx
+  802f12:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f19:	01 00 00 
+  802f1c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f20:	83 e0 01             	and    $0x1,%eax
+  802f23:	48 85 c0             	test   %rax,%rax
+  802f26:	74 63                	je     802f8b <fd_alloc+0xb0>
+  802f28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f2c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f30:	48 89 c2             	mov    %rax,%rdx
+  802f33:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f3a:	01 00 00 
+  802f3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f41:	83 e0 01             	and    $0x1,%eax
+  802f44:	48 85 c0             	test   %rax,%rax
+  802f47:	74 42                	je     802f8b <fd_alloc+0xb0>
+  802f49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f4d:	48 c1 e8 15          	shr    $0x15,%rax
+  802f51:	48 89 c2             	mov    %rax,%rdx
+  802f54:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f5b:	01 00 00 
+  802f5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f62:	83 e0 01             	and    $0x1,%eax
+  802f65:	48 85 c0             	test   %rax,%rax
+  802f68:	74 21                	je     802f8b <fd_alloc+0xb0>
+  802f6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f6e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f72:	48 89 c2             	mov    %rax,%rdx
+  802f75:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f7c:	01 00 00 
+  802f7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f83:	83 e0 01             	and    $0x1,%eax
+  802f86:	48 85 c0             	test   %rax,%rax
+  802f89:	75 12                	jne    802f9d <fd_alloc+0xc2>
+      *fd_store = fd;
+  802f8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f8f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f93:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9b:	eb 1e                	jmp    802fbb <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802f9d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802fa1:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802fa5:	0f 8e 48 ff ff ff    	jle    802ef3 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802fab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802faf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802fb6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+
+0000000000802fbd <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802fbd:	55                   	push   %rbp
+  802fbe:	48 89 e5             	mov    %rsp,%rbp
+  802fc1:	48 83 ec 20          	sub    $0x20,%rsp
+  802fc5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802fcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fd0:	78 06                	js     802fd8 <fd_lookup+0x1b>
+  802fd2:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802fd6:	7e 0a                	jle    802fe2 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802fd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fdd:	e9 af 00 00 00       	jmp    803091 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802fe2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fe5:	c1 e0 0c             	shl    $0xc,%eax
+  802fe8:	48 98                	cltq
+  802fea:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802fef:	48 01 d0             	add    %rdx,%rax
+  802ff2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802ff6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ffa:	48 c1 e8 27          	shr    $0x27,%rax
+  802ffe:	48 89 c2             	mov    %rax,%rdx
+  803001:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803008:	01 00 00 
+  80300b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80300f:	83 e0 01             	and    $0x1,%eax
+  803012:	48 85 c0             	test   %rax,%rax
+  803015:	74 63                	je     80307a <fd_lookup+0xbd>
+  803017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80301b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80301f:	48 89 c2             	mov    %rax,%rdx
+  803022:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803029:	01 00 00 
+  80302c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803030:	83 e0 01             	and    $0x1,%eax
+  803033:	48 85 c0             	test   %rax,%rax
+  803036:	74 42                	je     80307a <fd_lookup+0xbd>
+  803038:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80303c:	48 c1 e8 15          	shr    $0x15,%rax
+  803040:	48 89 c2             	mov    %rax,%rdx
+  803043:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80304a:	01 00 00 
+  80304d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803051:	83 e0 01             	and    $0x1,%eax
+  803054:	48 85 c0             	test   %rax,%rax
+  803057:	74 21                	je     80307a <fd_lookup+0xbd>
+  803059:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80305d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803061:	48 89 c2             	mov    %rax,%rdx
+  803064:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80306b:	01 00 00 
+  80306e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803072:	83 e0 01             	and    $0x1,%eax
+  803075:	48 85 c0             	test   %rax,%rax
+  803078:	75 07                	jne    803081 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80307a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80307f:	eb 10                	jmp    803091 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803085:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803089:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80308c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803091:	c9                   	leave
+  803092:	c3                   	ret
+
+0000000000803093 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	48 83 ec 30          	sub    $0x30,%rsp
+  80309b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80309f:	89 f0                	mov    %esi,%eax
+  8030a1:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8030a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030a8:	48 89 c7             	mov    %rax,%rdi
+  8030ab:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+  8030b7:	89 c2                	mov    %eax,%edx
+  8030b9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8030bd:	48 89 c6             	mov    %rax,%rsi
+  8030c0:	89 d7                	mov    %edx,%edi
+  8030c2:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8030c9:	00 00 00 
+  8030cc:	ff d0                	call   *%rax
+  8030ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030d5:	78 0a                	js     8030e1 <fd_close+0x4e>
+  8030d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030db:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8030df:	74 12                	je     8030f3 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8030e1:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8030e5:	74 05                	je     8030ec <fd_close+0x59>
+  8030e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ea:	eb 70                	jmp    80315c <fd_close+0xc9>
+  8030ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f1:	eb 69                	jmp    80315c <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8030f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030f7:	8b 00                	mov    (%rax),%eax
+  8030f9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030fd:	48 89 d6             	mov    %rdx,%rsi
+  803100:	89 c7                	mov    %eax,%edi
+  803102:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803111:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803115:	78 2a                	js     803141 <fd_close+0xae>
+    if (dev->dev_close)
+  803117:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80311b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80311f:	48 85 c0             	test   %rax,%rax
+  803122:	74 16                	je     80313a <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803128:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80312c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803130:	48 89 c7             	mov    %rax,%rdi
+  803133:	ff d2                	call   *%rdx
+  803135:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803138:	eb 07                	jmp    803141 <fd_close+0xae>
+    else
+      r = 0;
+  80313a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803145:	48 89 c6             	mov    %rax,%rsi
+  803148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80314d:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  return r;
+  803159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80315c:	c9                   	leave
+  80315d:	c3                   	ret
+
+000000000080315e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80315e:	55                   	push   %rbp
+  80315f:	48 89 e5             	mov    %rsp,%rbp
+  803162:	48 83 ec 20          	sub    $0x20,%rsp
+  803166:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803169:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  80316d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803174:	eb 3f                	jmp    8031b5 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803176:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80317d:	00 00 00 
+  803180:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803183:	48 98                	cltq
+  803185:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803189:	8b 00                	mov    (%rax),%eax
+  80318b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80318e:	75 21                	jne    8031b1 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803190:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803197:	00 00 00 
+  80319a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80319d:	48 98                	cltq
+  80319f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031a7:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8031aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031af:	eb 7f                	jmp    803230 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8031b1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8031b5:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8031bc:	00 00 00 
+  8031bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031c2:	48 98                	cltq
+  8031c4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031c8:	48 85 c0             	test   %rax,%rax
+  8031cb:	75 a9                	jne    803176 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031cd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031d4:	00 00 00 
+  8031d7:	8b 40 04             	mov    0x4(%rax),%eax
+  8031da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031df:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031e6:	00 00 00 
+  8031e9:	48 98                	cltq
+  8031eb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031f2:	48 01 d0             	add    %rdx,%rax
+  8031f5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8031fb:	8b 00                	mov    (%rax),%eax
+  8031fd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803200:	89 c6                	mov    %eax,%esi
+  803202:	48 b8 98 60 80 00 00 	movabs $0x806098,%rax
+  803209:	00 00 00 
+  80320c:	48 89 c7             	mov    %rax,%rdi
+  80320f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803214:	48 b9 28 0a 80 00 00 	movabs $0x800a28,%rcx
+  80321b:	00 00 00 
+  80321e:	ff d1                	call   *%rcx
+  *dev = 0;
+  803220:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803224:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80322b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803230:	c9                   	leave
+  803231:	c3                   	ret
+
+0000000000803232 <close>:
+
+int
+close(int fdnum) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	48 83 ec 20          	sub    $0x20,%rsp
+  80323a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80323d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803241:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803244:	48 89 d6             	mov    %rdx,%rsi
+  803247:	89 c7                	mov    %eax,%edi
+  803249:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  803250:	00 00 00 
+  803253:	ff d0                	call   *%rax
+  803255:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803258:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80325c:	79 05                	jns    803263 <close+0x31>
+    return r;
+  80325e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803261:	eb 18                	jmp    80327b <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803263:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803267:	be 01 00 00 00       	mov    $0x1,%esi
+  80326c:	48 89 c7             	mov    %rax,%rdi
+  80326f:	48 b8 93 30 80 00 00 	movabs $0x803093,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+}
+  80327b:	c9                   	leave
+  80327c:	c3                   	ret
+
+000000000080327d <close_all>:
+
+void
+close_all(void) {
+  80327d:	55                   	push   %rbp
+  80327e:	48 89 e5             	mov    %rsp,%rbp
+  803281:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803285:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80328c:	eb 15                	jmp    8032a3 <close_all+0x26>
+    close(i);
+  80328e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803291:	89 c7                	mov    %eax,%edi
+  803293:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  80329f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032a3:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8032a7:	7e e5                	jle    80328e <close_all+0x11>
+}
+  8032a9:	90                   	nop
+  8032aa:	90                   	nop
+  8032ab:	c9                   	leave
+  8032ac:	c3                   	ret
+
+00000000008032ad <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8032ad:	55                   	push   %rbp
+  8032ae:	48 89 e5             	mov    %rsp,%rbp
+  8032b1:	48 83 ec 40          	sub    $0x40,%rsp
+  8032b5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032b8:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8032bb:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8032bf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032c2:	48 89 d6             	mov    %rdx,%rsi
+  8032c5:	89 c7                	mov    %eax,%edi
+  8032c7:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+  8032d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032da:	79 08                	jns    8032e4 <dup+0x37>
+    return r;
+  8032dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032df:	e9 33 02 00 00       	jmp    803517 <dup+0x26a>
+  close(newfdnum);
+  8032e4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8032e7:	89 c7                	mov    %eax,%edi
+  8032e9:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8032f5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8032f8:	c1 e0 0c             	shl    $0xc,%eax
+  8032fb:	48 98                	cltq
+  8032fd:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803302:	48 01 d0             	add    %rdx,%rax
+  803305:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803309:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80330d:	48 89 c7             	mov    %rax,%rdi
+  803310:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  803317:	00 00 00 
+  80331a:	ff d0                	call   *%rax
+  80331c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803320:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803324:	48 89 c7             	mov    %rax,%rdi
+  803327:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+  803333:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803337:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80333e:	00 
+  80333f:	e9 19 01 00 00       	jmp    80345d <dup+0x1b0>
+    off -= PGSIZE;
+  803344:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80334b:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80334c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803350:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803354:	48 01 d0             	add    %rdx,%rax
+  803357:	48 c1 e8 27          	shr    $0x27,%rax
+  80335b:	48 89 c2             	mov    %rax,%rdx
+  80335e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803365:	01 00 00 
+  803368:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80336c:	83 e0 01             	and    $0x1,%eax
+  80336f:	48 85 c0             	test   %rax,%rax
+  803372:	0f 84 e5 00 00 00    	je     80345d <dup+0x1b0>
+  803378:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80337c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803380:	48 01 d0             	add    %rdx,%rax
+  803383:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803387:	48 89 c2             	mov    %rax,%rdx
+  80338a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803391:	01 00 00 
+  803394:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803398:	83 e0 01             	and    $0x1,%eax
+  80339b:	48 85 c0             	test   %rax,%rax
+  80339e:	0f 84 b9 00 00 00    	je     80345d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8033a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033ac:	48 01 d0             	add    %rdx,%rax
+  8033af:	48 c1 e8 15          	shr    $0x15,%rax
+  8033b3:	48 89 c2             	mov    %rax,%rdx
+  8033b6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8033bd:	01 00 00 
+  8033c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c4:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8033c7:	48 85 c0             	test   %rax,%rax
+  8033ca:	0f 84 8d 00 00 00    	je     80345d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8033d0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033d8:	48 01 d0             	add    %rdx,%rax
+  8033db:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033df:	48 89 c2             	mov    %rax,%rdx
+  8033e2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033e9:	01 00 00 
+  8033ec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f0:	83 e0 01             	and    $0x1,%eax
+  8033f3:	48 85 c0             	test   %rax,%rax
+  8033f6:	74 65                	je     80345d <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8033f8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803400:	48 01 d0             	add    %rdx,%rax
+  803403:	48 c1 e8 0c          	shr    $0xc,%rax
+  803407:	48 89 c2             	mov    %rax,%rdx
+  80340a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803411:	01 00 00 
+  803414:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803418:	25 07 0e 00 00       	and    $0xe07,%eax
+  80341d:	89 c6                	mov    %eax,%esi
+  80341f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803423:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803427:	48 01 c2             	add    %rax,%rdx
+  80342a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80342e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803432:	48 01 c8             	add    %rcx,%rax
+  803435:	41 89 f0             	mov    %esi,%r8d
+  803438:	48 89 d1             	mov    %rdx,%rcx
+  80343b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803440:	48 89 c6             	mov    %rax,%rsi
+  803443:	bf 00 00 00 00       	mov    $0x0,%edi
+  803448:	48 b8 fe 27 80 00 00 	movabs $0x8027fe,%rax
+  80344f:	00 00 00 
+  803452:	ff d0                	call   *%rax
+  803454:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803457:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80345b:	78 60                	js     8034bd <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80345d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803462:	0f 85 dc fe ff ff    	jne    803344 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803468:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80346c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803470:	48 89 c2             	mov    %rax,%rdx
+  803473:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80347a:	01 00 00 
+  80347d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803481:	25 07 0e 00 00       	and    $0xe07,%eax
+  803486:	89 c1                	mov    %eax,%ecx
+  803488:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80348c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803490:	41 89 c8             	mov    %ecx,%r8d
+  803493:	48 89 d1             	mov    %rdx,%rcx
+  803496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80349b:	48 89 c6             	mov    %rax,%rsi
+  80349e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a3:	48 b8 fe 27 80 00 00 	movabs $0x8027fe,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+  8034af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034b6:	78 08                	js     8034c0 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8034b8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8034bb:	eb 5a                	jmp    803517 <dup+0x26a>
+        goto err;
+  8034bd:	90                   	nop
+  8034be:	eb 01                	jmp    8034c1 <dup+0x214>
+    goto err;
+  8034c0:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8034c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034c5:	48 89 c6             	mov    %rax,%rsi
+  8034c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cd:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8034d4:	00 00 00 
+  8034d7:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8034d9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8034e0:	00 
+  8034e1:	eb 27                	jmp    80350a <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8034e3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034eb:	48 01 d0             	add    %rdx,%rax
+  8034ee:	48 89 c6             	mov    %rax,%rsi
+  8034f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f6:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803502:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803509:	00 
+  80350a:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803511:	00 
+  803512:	76 cf                	jbe    8034e3 <dup+0x236>
+  return r;
+  803514:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803517:	c9                   	leave
+  803518:	c3                   	ret
+
+0000000000803519 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803519:	55                   	push   %rbp
+  80351a:	48 89 e5             	mov    %rsp,%rbp
+  80351d:	48 83 ec 40          	sub    $0x40,%rsp
+  803521:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803524:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803528:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80352c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803530:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803533:	48 89 d6             	mov    %rdx,%rsi
+  803536:	89 c7                	mov    %eax,%edi
+  803538:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+  803544:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803547:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80354b:	78 24                	js     803571 <read+0x58>
+  80354d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803551:	8b 00                	mov    (%rax),%eax
+  803553:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803557:	48 89 d6             	mov    %rdx,%rsi
+  80355a:	89 c7                	mov    %eax,%edi
+  80355c:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803563:	00 00 00 
+  803566:	ff d0                	call   *%rax
+  803568:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80356b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80356f:	79 0a                	jns    80357b <read+0x62>
+    return r;
+  803571:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803574:	48 98                	cltq
+  803576:	e9 9e 00 00 00       	jmp    803619 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80357b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80357f:	8b 40 08             	mov    0x8(%rax),%eax
+  803582:	83 e0 03             	and    $0x3,%eax
+  803585:	83 f8 01             	cmp    $0x1,%eax
+  803588:	75 5c                	jne    8035e6 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80358a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803591:	00 00 00 
+  803594:	8b 40 04             	mov    0x4(%rax),%eax
+  803597:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80359c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035a3:	00 00 00 
+  8035a6:	48 98                	cltq
+  8035a8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035af:	48 01 d0             	add    %rdx,%rax
+  8035b2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035b8:	8b 00                	mov    (%rax),%eax
+  8035ba:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8035bd:	89 c6                	mov    %eax,%esi
+  8035bf:	48 b8 b7 60 80 00 00 	movabs $0x8060b7,%rax
+  8035c6:	00 00 00 
+  8035c9:	48 89 c7             	mov    %rax,%rdi
+  8035cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d1:	48 b9 28 0a 80 00 00 	movabs $0x800a28,%rcx
+  8035d8:	00 00 00 
+  8035db:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8035dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8035e4:	eb 33                	jmp    803619 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8035e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8035ee:	48 85 c0             	test   %rax,%rax
+  8035f1:	75 09                	jne    8035fc <read+0xe3>
+    return -E_NOT_SUPP;
+  8035f3:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8035fa:	eb 1d                	jmp    803619 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8035fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803600:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803608:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80360c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803610:	48 89 ce             	mov    %rcx,%rsi
+  803613:	48 89 c7             	mov    %rax,%rdi
+  803616:	41 ff d0             	call   *%r8
+}
+  803619:	c9                   	leave
+  80361a:	c3                   	ret
+
+000000000080361b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	48 83 ec 30          	sub    $0x30,%rsp
+  803623:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803626:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80362a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80362e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803635:	eb 49                	jmp    803680 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803637:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80363a:	48 98                	cltq
+  80363c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803640:	48 29 c2             	sub    %rax,%rdx
+  803643:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803646:	48 63 c8             	movslq %eax,%rcx
+  803649:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80364d:	48 01 c1             	add    %rax,%rcx
+  803650:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803653:	48 89 ce             	mov    %rcx,%rsi
+  803656:	89 c7                	mov    %eax,%edi
+  803658:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+  803664:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803667:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80366b:	79 07                	jns    803674 <readn+0x59>
+      return m;
+  80366d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803670:	48 98                	cltq
+  803672:	eb 1f                	jmp    803693 <readn+0x78>
+    if (m == 0)
+  803674:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803678:	74 13                	je     80368d <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80367a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80367d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803680:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803683:	48 98                	cltq
+  803685:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803689:	72 ac                	jb     803637 <readn+0x1c>
+  80368b:	eb 01                	jmp    80368e <readn+0x73>
+      break;
+  80368d:	90                   	nop
+  }
+  return tot;
+  80368e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803691:	48 98                	cltq
+}
+  803693:	c9                   	leave
+  803694:	c3                   	ret
+
+0000000000803695 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803695:	55                   	push   %rbp
+  803696:	48 89 e5             	mov    %rsp,%rbp
+  803699:	48 83 ec 40          	sub    $0x40,%rsp
+  80369d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8036a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8036a8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8036ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036af:	48 89 d6             	mov    %rdx,%rsi
+  8036b2:	89 c7                	mov    %eax,%edi
+  8036b4:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8036bb:	00 00 00 
+  8036be:	ff d0                	call   *%rax
+  8036c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036c7:	78 24                	js     8036ed <write+0x58>
+  8036c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036cd:	8b 00                	mov    (%rax),%eax
+  8036cf:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8036d3:	48 89 d6             	mov    %rdx,%rsi
+  8036d6:	89 c7                	mov    %eax,%edi
+  8036d8:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  8036df:	00 00 00 
+  8036e2:	ff d0                	call   *%rax
+  8036e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036eb:	79 0a                	jns    8036f7 <write+0x62>
+    return r;
+  8036ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036f0:	48 98                	cltq
+  8036f2:	e9 9d 00 00 00       	jmp    803794 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036fb:	8b 40 08             	mov    0x8(%rax),%eax
+  8036fe:	83 e0 03             	and    $0x3,%eax
+  803701:	85 c0                	test   %eax,%eax
+  803703:	75 5c                	jne    803761 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803705:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80370c:	00 00 00 
+  80370f:	8b 40 04             	mov    0x4(%rax),%eax
+  803712:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803717:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80371e:	00 00 00 
+  803721:	48 98                	cltq
+  803723:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80372a:	48 01 d0             	add    %rdx,%rax
+  80372d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803733:	8b 00                	mov    (%rax),%eax
+  803735:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803738:	89 c6                	mov    %eax,%esi
+  80373a:	48 b8 d3 60 80 00 00 	movabs $0x8060d3,%rax
+  803741:	00 00 00 
+  803744:	48 89 c7             	mov    %rax,%rdi
+  803747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374c:	48 b9 28 0a 80 00 00 	movabs $0x800a28,%rcx
+  803753:	00 00 00 
+  803756:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803758:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80375f:	eb 33                	jmp    803794 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803761:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803765:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803769:	48 85 c0             	test   %rax,%rax
+  80376c:	75 09                	jne    803777 <write+0xe2>
+    return -E_NOT_SUPP;
+  80376e:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803775:	eb 1d                	jmp    803794 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803777:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80377b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80377f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803783:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803787:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80378b:	48 89 ce             	mov    %rcx,%rsi
+  80378e:	48 89 c7             	mov    %rax,%rdi
+  803791:	41 ff d0             	call   *%r8
+}
+  803794:	c9                   	leave
+  803795:	c3                   	ret
+
+0000000000803796 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803796:	55                   	push   %rbp
+  803797:	48 89 e5             	mov    %rsp,%rbp
+  80379a:	48 83 ec 18          	sub    $0x18,%rsp
+  80379e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8037a1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037a4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8037a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037ab:	48 89 d6             	mov    %rdx,%rsi
+  8037ae:	89 c7                	mov    %eax,%edi
+  8037b0:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8037b7:	00 00 00 
+  8037ba:	ff d0                	call   *%rax
+  8037bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037c3:	79 05                	jns    8037ca <seek+0x34>
+    return r;
+  8037c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037c8:	eb 0f                	jmp    8037d9 <seek+0x43>
+  fd->fd_offset = offset;
+  8037ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037ce:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8037d1:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8037d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037d9:	c9                   	leave
+  8037da:	c3                   	ret
+
+00000000008037db <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8037db:	55                   	push   %rbp
+  8037dc:	48 89 e5             	mov    %rsp,%rbp
+  8037df:	48 83 ec 30          	sub    $0x30,%rsp
+  8037e3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037e6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8037e9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8037ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037f0:	48 89 d6             	mov    %rdx,%rsi
+  8037f3:	89 c7                	mov    %eax,%edi
+  8037f5:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8037fc:	00 00 00 
+  8037ff:	ff d0                	call   *%rax
+  803801:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803804:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803808:	78 24                	js     80382e <ftruncate+0x53>
+  80380a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80380e:	8b 00                	mov    (%rax),%eax
+  803810:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803814:	48 89 d6             	mov    %rdx,%rsi
+  803817:	89 c7                	mov    %eax,%edi
+  803819:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803820:	00 00 00 
+  803823:	ff d0                	call   *%rax
+  803825:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803828:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80382c:	79 08                	jns    803836 <ftruncate+0x5b>
+    return r;
+  80382e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803831:	e9 92 00 00 00       	jmp    8038c8 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80383a:	8b 40 08             	mov    0x8(%rax),%eax
+  80383d:	83 e0 03             	and    $0x3,%eax
+  803840:	85 c0                	test   %eax,%eax
+  803842:	75 5a                	jne    80389e <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803844:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80384b:	00 00 00 
+  80384e:	8b 40 04             	mov    0x4(%rax),%eax
+  803851:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803856:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80385d:	00 00 00 
+  803860:	48 98                	cltq
+  803862:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803869:	48 01 d0             	add    %rdx,%rax
+  80386c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803872:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803874:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803877:	89 c6                	mov    %eax,%esi
+  803879:	48 b8 f0 60 80 00 00 	movabs $0x8060f0,%rax
+  803880:	00 00 00 
+  803883:	48 89 c7             	mov    %rax,%rdi
+  803886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388b:	48 b9 28 0a 80 00 00 	movabs $0x800a28,%rcx
+  803892:	00 00 00 
+  803895:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803897:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80389c:	eb 2a                	jmp    8038c8 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80389e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038a2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8038a6:	48 85 c0             	test   %rax,%rax
+  8038a9:	75 07                	jne    8038b2 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8038ab:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8038b0:	eb 16                	jmp    8038c8 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8038b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038b6:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8038ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038be:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8038c1:	89 d6                	mov    %edx,%esi
+  8038c3:	48 89 c7             	mov    %rax,%rdi
+  8038c6:	ff d1                	call   *%rcx
+}
+  8038c8:	c9                   	leave
+  8038c9:	c3                   	ret
+
+00000000008038ca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8038ca:	55                   	push   %rbp
+  8038cb:	48 89 e5             	mov    %rsp,%rbp
+  8038ce:	48 83 ec 30          	sub    $0x30,%rsp
+  8038d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038d9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8038dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038e0:	48 89 d6             	mov    %rdx,%rsi
+  8038e3:	89 c7                	mov    %eax,%edi
+  8038e5:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  8038ec:	00 00 00 
+  8038ef:	ff d0                	call   *%rax
+  8038f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038f4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038f8:	78 24                	js     80391e <fstat+0x54>
+  8038fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038fe:	8b 00                	mov    (%rax),%eax
+  803900:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803904:	48 89 d6             	mov    %rdx,%rsi
+  803907:	89 c7                	mov    %eax,%edi
+  803909:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803910:	00 00 00 
+  803913:	ff d0                	call   *%rax
+  803915:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803918:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80391c:	79 05                	jns    803923 <fstat+0x59>
+    return r;
+  80391e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803921:	eb 5e                	jmp    803981 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803927:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80392b:	48 85 c0             	test   %rax,%rax
+  80392e:	75 07                	jne    803937 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803930:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803935:	eb 4a                	jmp    803981 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803937:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80393b:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80393e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803942:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803949:	00 00 00 
+  stat->st_isdir   = 0;
+  80394c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803950:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803957:	00 00 00 
+  stat->st_dev     = dev;
+  80395a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80395e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803962:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803969:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80396d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803975:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803979:	48 89 d6             	mov    %rdx,%rsi
+  80397c:	48 89 c7             	mov    %rax,%rdi
+  80397f:	ff d1                	call   *%rcx
+}
+  803981:	c9                   	leave
+  803982:	c3                   	ret
+
+0000000000803983 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803983:	55                   	push   %rbp
+  803984:	48 89 e5             	mov    %rsp,%rbp
+  803987:	48 83 ec 10          	sub    $0x10,%rsp
+  80398b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80398f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803993:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803997:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80399d:	83 f8 20             	cmp    $0x20,%eax
+  8039a0:	75 07                	jne    8039a9 <pollwait_key+0x26>
+    return -E_INVAL;
+  8039a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039a7:	eb 5f                	jmp    803a08 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8039a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039ad:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8039b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039b7:	48 63 d2             	movslq %edx,%rdx
+  8039ba:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039be:	48 01 c2             	add    %rax,%rdx
+  8039c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039c5:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8039c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039cc:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8039d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d6:	8b 00                	mov    (%rax),%eax
+  8039d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039dc:	48 63 c9             	movslq %ecx,%rcx
+  8039df:	48 c1 e1 04          	shl    $0x4,%rcx
+  8039e3:	48 01 ca             	add    %rcx,%rdx
+  8039e6:	48 83 c2 08          	add    $0x8,%rdx
+  8039ea:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8039ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f0:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8039f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8039f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039fd:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803a03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a08:	c9                   	leave
+  803a09:	c3                   	ret
+
+0000000000803a0a <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803a0a:	55                   	push   %rbp
+  803a0b:	48 89 e5             	mov    %rsp,%rbp
+  803a0e:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803a15:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803a1c:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803a22:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803a29:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a30:	00 
+  int i, r, ready, ipc = 0;
+  803a31:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803a38:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803a3f:	00 
+  803a40:	74 45                	je     803a87 <poll+0x7d>
+  803a42:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803a49:	ff 
+  803a4a:	74 3b                	je     803a87 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803a4c:	48 b8 5e 52 80 00 00 	movabs $0x80525e,%rax
+  803a53:	00 00 00 
+  803a56:	ff d0                	call   *%rax
+  803a58:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803a5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a60:	48 f7 d0             	not    %rax
+  803a63:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803a6a:	73 10                	jae    803a7c <poll+0x72>
+  803a6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a70:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803a77:	48 01 d0             	add    %rdx,%rax
+  803a7a:	eb 07                	jmp    803a83 <poll+0x79>
+  803a7c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803a83:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803a87:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803a8e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803a95:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803a9c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803aa3:	e9 46 02 00 00       	jmp    803cee <poll+0x2e4>
+      fds[i].revents = 0;
+  803aa8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803aab:	48 63 d0             	movslq %eax,%rdx
+  803aae:	48 89 d0             	mov    %rdx,%rax
+  803ab1:	48 01 c0             	add    %rax,%rax
+  803ab4:	48 01 d0             	add    %rdx,%rax
+  803ab7:	48 c1 e0 02          	shl    $0x2,%rax
+  803abb:	48 89 c2             	mov    %rax,%rdx
+  803abe:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ac5:	48 01 d0             	add    %rdx,%rax
+  803ac8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803acf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ad2:	48 63 d0             	movslq %eax,%rdx
+  803ad5:	48 89 d0             	mov    %rdx,%rax
+  803ad8:	48 01 c0             	add    %rax,%rax
+  803adb:	48 01 d0             	add    %rdx,%rax
+  803ade:	48 c1 e0 02          	shl    $0x2,%rax
+  803ae2:	48 89 c2             	mov    %rax,%rdx
+  803ae5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803aec:	48 01 d0             	add    %rdx,%rax
+  803aef:	8b 00                	mov    (%rax),%eax
+  803af1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803af4:	75 62                	jne    803b58 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803af6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803af9:	48 63 d0             	movslq %eax,%rdx
+  803afc:	48 89 d0             	mov    %rdx,%rax
+  803aff:	48 01 c0             	add    %rax,%rax
+  803b02:	48 01 d0             	add    %rdx,%rax
+  803b05:	48 c1 e0 02          	shl    $0x2,%rax
+  803b09:	48 89 c2             	mov    %rax,%rdx
+  803b0c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b13:	48 01 d0             	add    %rdx,%rax
+  803b16:	8b 40 04             	mov    0x4(%rax),%eax
+  803b19:	83 e0 01             	and    $0x1,%eax
+  803b1c:	85 c0                	test   %eax,%eax
+  803b1e:	0f 84 9b 01 00 00    	je     803cbf <poll+0x2b5>
+          fds[i].revents = ipc;
+  803b24:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b27:	48 63 d0             	movslq %eax,%rdx
+  803b2a:	48 89 d0             	mov    %rdx,%rax
+  803b2d:	48 01 c0             	add    %rax,%rax
+  803b30:	48 01 d0             	add    %rdx,%rax
+  803b33:	48 c1 e0 02          	shl    $0x2,%rax
+  803b37:	48 89 c2             	mov    %rax,%rdx
+  803b3a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b41:	48 01 c2             	add    %rax,%rdx
+  803b44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b47:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803b4a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803b4d:	83 c8 04             	or     $0x4,%eax
+  803b50:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803b53:	e9 67 01 00 00       	jmp    803cbf <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803b58:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b5b:	48 63 d0             	movslq %eax,%rdx
+  803b5e:	48 89 d0             	mov    %rdx,%rax
+  803b61:	48 01 c0             	add    %rax,%rax
+  803b64:	48 01 d0             	add    %rdx,%rax
+  803b67:	48 c1 e0 02          	shl    $0x2,%rax
+  803b6b:	48 89 c2             	mov    %rax,%rdx
+  803b6e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b75:	48 01 d0             	add    %rdx,%rax
+  803b78:	8b 00                	mov    (%rax),%eax
+  803b7a:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803b81:	48 89 d6             	mov    %rdx,%rsi
+  803b84:	89 c7                	mov    %eax,%edi
+  803b86:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	85 c0                	test   %eax,%eax
+  803b94:	78 25                	js     803bbb <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803b96:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803b9d:	8b 00                	mov    (%rax),%eax
+  803b9f:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803ba6:	48 89 d6             	mov    %rdx,%rsi
+  803ba9:	89 c7                	mov    %eax,%edi
+  803bab:	48 b8 5e 31 80 00 00 	movabs $0x80315e,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803bb7:	85 c0                	test   %eax,%eax
+  803bb9:	79 2c                	jns    803be7 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803bbb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bbe:	48 63 d0             	movslq %eax,%rdx
+  803bc1:	48 89 d0             	mov    %rdx,%rax
+  803bc4:	48 01 c0             	add    %rax,%rax
+  803bc7:	48 01 d0             	add    %rdx,%rax
+  803bca:	48 c1 e0 02          	shl    $0x2,%rax
+  803bce:	48 89 c2             	mov    %rax,%rdx
+  803bd1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bd8:	48 01 d0             	add    %rdx,%rax
+  803bdb:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803be2:	e9 d8 00 00 00       	jmp    803cbf <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803be7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803bee:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803bf2:	48 85 c0             	test   %rax,%rax
+  803bf5:	74 7d                	je     803c74 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803bf7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803bfe:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803c02:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c05:	48 63 d0             	movslq %eax,%rdx
+  803c08:	48 89 d0             	mov    %rdx,%rax
+  803c0b:	48 01 c0             	add    %rax,%rax
+  803c0e:	48 01 d0             	add    %rdx,%rax
+  803c11:	48 c1 e0 02          	shl    $0x2,%rax
+  803c15:	48 89 c2             	mov    %rax,%rdx
+  803c18:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c1f:	48 01 d0             	add    %rdx,%rax
+  803c22:	8b 48 04             	mov    0x4(%rax),%ecx
+  803c25:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c2c:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803c33:	89 ce                	mov    %ecx,%esi
+  803c35:	48 89 c7             	mov    %rax,%rdi
+  803c38:	41 ff d0             	call   *%r8
+  803c3b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803c3e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c42:	79 08                	jns    803c4c <poll+0x242>
+          return r;
+  803c44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c47:	e9 45 01 00 00       	jmp    803d91 <poll+0x387>
+        fds[i].revents = r;
+  803c4c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c4f:	48 63 d0             	movslq %eax,%rdx
+  803c52:	48 89 d0             	mov    %rdx,%rax
+  803c55:	48 01 c0             	add    %rax,%rax
+  803c58:	48 01 d0             	add    %rdx,%rax
+  803c5b:	48 c1 e0 02          	shl    $0x2,%rax
+  803c5f:	48 89 c2             	mov    %rax,%rdx
+  803c62:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c69:	48 01 c2             	add    %rax,%rdx
+  803c6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c6f:	89 42 08             	mov    %eax,0x8(%rdx)
+  803c72:	eb 4b                	jmp    803cbf <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803c74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c77:	48 63 d0             	movslq %eax,%rdx
+  803c7a:	48 89 d0             	mov    %rdx,%rax
+  803c7d:	48 01 c0             	add    %rax,%rax
+  803c80:	48 01 d0             	add    %rdx,%rax
+  803c83:	48 c1 e0 02          	shl    $0x2,%rax
+  803c87:	48 89 c2             	mov    %rax,%rdx
+  803c8a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c91:	48 01 d0             	add    %rdx,%rax
+  803c94:	8b 48 04             	mov    0x4(%rax),%ecx
+  803c97:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c9a:	48 63 d0             	movslq %eax,%rdx
+  803c9d:	48 89 d0             	mov    %rdx,%rax
+  803ca0:	48 01 c0             	add    %rax,%rax
+  803ca3:	48 01 d0             	add    %rdx,%rax
+  803ca6:	48 c1 e0 02          	shl    $0x2,%rax
+  803caa:	48 89 c2             	mov    %rax,%rdx
+  803cad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cb4:	48 01 d0             	add    %rdx,%rax
+  803cb7:	83 e1 03             	and    $0x3,%ecx
+  803cba:	89 ca                	mov    %ecx,%edx
+  803cbc:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803cbf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cc2:	48 63 d0             	movslq %eax,%rdx
+  803cc5:	48 89 d0             	mov    %rdx,%rax
+  803cc8:	48 01 c0             	add    %rax,%rax
+  803ccb:	48 01 d0             	add    %rdx,%rax
+  803cce:	48 c1 e0 02          	shl    $0x2,%rax
+  803cd2:	48 89 c2             	mov    %rax,%rdx
+  803cd5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cdc:	48 01 d0             	add    %rdx,%rax
+  803cdf:	8b 40 08             	mov    0x8(%rax),%eax
+  803ce2:	85 c0                	test   %eax,%eax
+  803ce4:	74 04                	je     803cea <poll+0x2e0>
+        ready++;
+  803ce6:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803cea:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803cee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cf1:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803cf7:	0f 8c ab fd ff ff    	jl     803aa8 <poll+0x9e>
+    }
+    if (ready)
+  803cfd:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803d01:	74 08                	je     803d0b <poll+0x301>
+      return ready;
+  803d03:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d06:	e9 86 00 00 00       	jmp    803d91 <poll+0x387>
+
+    if (deadline) {
+  803d0b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803d10:	74 30                	je     803d42 <poll+0x338>
+      now     = vsys_clock_ns();
+  803d12:	48 b8 5e 52 80 00 00 	movabs $0x80525e,%rax
+  803d19:	00 00 00 
+  803d1c:	ff d0                	call   *%rax
+  803d1e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803d22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d26:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803d2a:	73 0a                	jae    803d36 <poll+0x32c>
+  803d2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d30:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803d34:	eb 05                	jmp    803d3b <poll+0x331>
+  803d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3b:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803d42:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803d45:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803d48:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803d4f:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803d56:	48 89 c7             	mov    %rax,%rdi
+  803d59:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+  803d65:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803d68:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803d6c:	75 07                	jne    803d75 <poll+0x36b>
+      return 0;
+  803d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d73:	eb 1c                	jmp    803d91 <poll+0x387>
+    if (r < 0)
+  803d75:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d79:	79 05                	jns    803d80 <poll+0x376>
+      return r;
+  803d7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d7e:	eb 11                	jmp    803d91 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803d80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d83:	c1 f8 02             	sar    $0x2,%eax
+  803d86:	83 e0 01             	and    $0x1,%eax
+  803d89:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803d8c:	e9 f6 fc ff ff       	jmp    803a87 <poll+0x7d>
+  }
+}
+  803d91:	c9                   	leave
+  803d92:	c3                   	ret
+
+0000000000803d93 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803d93:	55                   	push   %rbp
+  803d94:	48 89 e5             	mov    %rsp,%rbp
+  803d97:	48 83 ec 20          	sub    $0x20,%rsp
+  803d9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da7:	be 00 00 00 00       	mov    $0x0,%esi
+  803dac:	48 89 c7             	mov    %rax,%rdi
+  803daf:	48 b8 81 3e 80 00 00 	movabs $0x803e81,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+  803dbb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dbe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dc2:	79 05                	jns    803dc9 <stat+0x36>
+    return fd;
+  803dc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dc7:	eb 2f                	jmp    803df8 <stat+0x65>
+  r = fstat(fd, stat);
+  803dc9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803dcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dd0:	48 89 d6             	mov    %rdx,%rsi
+  803dd3:	89 c7                	mov    %eax,%edi
+  803dd5:	48 b8 ca 38 80 00 00 	movabs $0x8038ca,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+  803de1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803de4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803de7:	89 c7                	mov    %eax,%edi
+  803de9:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  803df0:	00 00 00 
+  803df3:	ff d0                	call   *%rax
+  return r;
+  803df5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803df8:	c9                   	leave
+  803df9:	c3                   	ret
+
+0000000000803dfa <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803dfa:	55                   	push   %rbp
+  803dfb:	48 89 e5             	mov    %rsp,%rbp
+  803dfe:	48 83 ec 10          	sub    $0x10,%rsp
+  803e02:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803e05:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803e09:	48 b8 00 90 81 00 00 	movabs $0x819000,%rax
+  803e10:	00 00 00 
+  803e13:	8b 00                	mov    (%rax),%eax
+  803e15:	85 c0                	test   %eax,%eax
+  803e17:	75 1d                	jne    803e36 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e19:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e1e:	48 b8 79 58 80 00 00 	movabs $0x805879,%rax
+  803e25:	00 00 00 
+  803e28:	ff d0                	call   *%rax
+  803e2a:	48 ba 00 90 81 00 00 	movabs $0x819000,%rdx
+  803e31:	00 00 00 
+  803e34:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803e36:	48 b8 00 90 81 00 00 	movabs $0x819000,%rax
+  803e3d:	00 00 00 
+  803e40:	8b 00                	mov    (%rax),%eax
+  803e42:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803e45:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803e4a:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  803e51:	00 00 00 
+  803e54:	89 c7                	mov    %eax,%edi
+  803e56:	48 b8 cc 57 80 00 00 	movabs $0x8057cc,%rax
+  803e5d:	00 00 00 
+  803e60:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803e62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e6b:	48 89 c6             	mov    %rax,%rsi
+  803e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e73:	48 b8 4f 56 80 00 00 	movabs $0x80564f,%rax
+  803e7a:	00 00 00 
+  803e7d:	ff d0                	call   *%rax
+}
+  803e7f:	c9                   	leave
+  803e80:	c3                   	ret
+
+0000000000803e81 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803e81:	55                   	push   %rbp
+  803e82:	48 89 e5             	mov    %rsp,%rbp
+  803e85:	48 83 ec 20          	sub    $0x20,%rsp
+  803e89:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e8d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803e90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e94:	48 89 c7             	mov    %rax,%rdi
+  803e97:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  803e9e:	00 00 00 
+  803ea1:	ff d0                	call   *%rax
+  803ea3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803ea8:	7e 0a                	jle    803eb4 <open+0x33>
+    return -E_BAD_PATH;
+  803eaa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803eaf:	e9 a8 00 00 00       	jmp    803f5c <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803eb4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803eb8:	48 89 c7             	mov    %rax,%rdi
+  803ebb:	48 b8 db 2e 80 00 00 	movabs $0x802edb,%rax
+  803ec2:	00 00 00 
+  803ec5:	ff d0                	call   *%rax
+  803ec7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803eca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ece:	79 08                	jns    803ed8 <open+0x57>
+    return r;
+  803ed0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ed3:	e9 84 00 00 00       	jmp    803f5c <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803ed8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803edc:	48 89 c6             	mov    %rax,%rsi
+  803edf:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  803ee6:	00 00 00 
+  803ee9:	48 89 c7             	mov    %rax,%rdi
+  803eec:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  803ef3:	00 00 00 
+  803ef6:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803ef8:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  803eff:	00 00 00 
+  803f02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f05:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f0f:	48 89 c6             	mov    %rax,%rsi
+  803f12:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f17:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+  803f23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f2a:	79 1d                	jns    803f49 <open+0xc8>
+    fd_close(fd, 0);
+  803f2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f30:	be 00 00 00 00       	mov    $0x0,%esi
+  803f35:	48 89 c7             	mov    %rax,%rdi
+  803f38:	48 b8 93 30 80 00 00 	movabs $0x803093,%rax
+  803f3f:	00 00 00 
+  803f42:	ff d0                	call   *%rax
+    return r;
+  803f44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f47:	eb 13                	jmp    803f5c <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803f49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f4d:	48 89 c7             	mov    %rax,%rdi
+  803f50:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  803f57:	00 00 00 
+  803f5a:	ff d0                	call   *%rax
+}
+  803f5c:	c9                   	leave
+  803f5d:	c3                   	ret
+
+0000000000803f5e <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803f5e:	55                   	push   %rbp
+  803f5f:	48 89 e5             	mov    %rsp,%rbp
+  803f62:	48 83 ec 10          	sub    $0x10,%rsp
+  803f66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803f6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f6e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f71:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  803f78:	00 00 00 
+  803f7b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803f82:	bf 06 00 00 00       	mov    $0x6,%edi
+  803f87:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+}
+  803f93:	c9                   	leave
+  803f94:	c3                   	ret
+
+0000000000803f95 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803f95:	55                   	push   %rbp
+  803f96:	48 89 e5             	mov    %rsp,%rbp
+  803f99:	48 83 ec 30          	sub    $0x30,%rsp
+  803f9d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803fa1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803fa5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803fa9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803fae:	74 07                	je     803fb7 <devfile_read+0x22>
+  803fb0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803fb5:	75 0a                	jne    803fc1 <devfile_read+0x2c>
+  return E_INVAL;
+  803fb7:	b8 03 00 00 00       	mov    $0x3,%eax
+  803fbc:	e9 b4 00 00 00       	jmp    804075 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803fc1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803fc8:	00 
+  while (n) {
+  803fc9:	e9 98 00 00 00       	jmp    804066 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803fce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fd2:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fd5:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  803fdc:	00 00 00 
+  803fdf:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803fe1:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  803fe8:	00 00 00 
+  803feb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fef:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ff8:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ffd:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  804004:	00 00 00 
+  804007:	ff d0                	call   *%rax
+  804009:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  80400c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804010:	7f 13                	jg     804025 <devfile_read+0x90>
+      return res ? res : res0;
+  804012:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804016:	74 07                	je     80401f <devfile_read+0x8a>
+  804018:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80401b:	48 98                	cltq
+  80401d:	eb 56                	jmp    804075 <devfile_read+0xe0>
+  80401f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804023:	eb 50                	jmp    804075 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804025:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804028:	48 63 d0             	movslq %eax,%rdx
+  80402b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80402f:	48 b9 00 80 81 00 00 	movabs $0x818000,%rcx
+  804036:	00 00 00 
+  804039:	48 89 ce             	mov    %rcx,%rsi
+  80403c:	48 89 c7             	mov    %rax,%rdi
+  80403f:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  804046:	00 00 00 
+  804049:	ff d0                	call   *%rax
+
+    buf += res;
+  80404b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80404e:	48 98                	cltq
+  804050:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804054:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804057:	48 98                	cltq
+  804059:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  80405d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804060:	48 98                	cltq
+  804062:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804066:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80406b:	0f 85 5d ff ff ff    	jne    803fce <devfile_read+0x39>
+  }
+
+  return res0;
+  804071:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804075:	c9                   	leave
+  804076:	c3                   	ret
+
+0000000000804077 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804077:	55                   	push   %rbp
+  804078:	48 89 e5             	mov    %rsp,%rbp
+  80407b:	48 83 ec 50          	sub    $0x50,%rsp
+  80407f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804083:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804087:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80408b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804090:	74 07                	je     804099 <devfile_write+0x22>
+  804092:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804097:	75 0a                	jne    8040a3 <devfile_write+0x2c>
+  return E_INVAL;
+  804099:	b8 03 00 00 00       	mov    $0x3,%eax
+  80409e:	e9 c9 00 00 00       	jmp    80416c <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8040a3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8040aa:	00 
+
+  while (n) {
+  8040ab:	e9 ad 00 00 00       	jmp    80415d <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8040b0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8040b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8040b8:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8040bf:	00 
+  8040c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040c8:	48 39 c2             	cmp    %rax,%rdx
+  8040cb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8040cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8040d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8040d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040db:	48 89 c6             	mov    %rax,%rsi
+  8040de:	48 b8 10 80 81 00 00 	movabs $0x818010,%rax
+  8040e5:	00 00 00 
+  8040e8:	48 89 c7             	mov    %rax,%rdi
+  8040eb:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8040f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040fb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040fe:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804105:	00 00 00 
+  804108:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  80410a:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804111:	00 00 00 
+  804114:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804118:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  80411c:	be 00 00 00 00       	mov    $0x0,%esi
+  804121:	bf 04 00 00 00       	mov    $0x4,%edi
+  804126:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  80412d:	00 00 00 
+  804130:	ff d0                	call   *%rax
+  804132:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804135:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804139:	79 07                	jns    804142 <devfile_write+0xcb>
+      return res;
+  80413b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80413e:	48 98                	cltq
+  804140:	eb 2a                	jmp    80416c <devfile_write+0xf5>
+
+    buf += res;
+  804142:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804145:	48 98                	cltq
+  804147:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80414b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80414e:	48 98                	cltq
+  804150:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804154:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804157:	48 98                	cltq
+  804159:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80415d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804162:	0f 85 48 ff ff ff    	jne    8040b0 <devfile_write+0x39>
+  }
+
+  return res0;
+  804168:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80416c:	c9                   	leave
+  80416d:	c3                   	ret
+
+000000000080416e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80416e:	55                   	push   %rbp
+  80416f:	48 89 e5             	mov    %rsp,%rbp
+  804172:	48 83 ec 20          	sub    $0x20,%rsp
+  804176:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80417a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80417e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804182:	8b 40 0c             	mov    0xc(%rax),%eax
+  804185:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  80418c:	00 00 00 
+  80418f:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804191:	be 00 00 00 00       	mov    $0x0,%esi
+  804196:	bf 05 00 00 00       	mov    $0x5,%edi
+  80419b:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+  8041a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041ae:	79 05                	jns    8041b5 <devfile_stat+0x47>
+    return r;
+  8041b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041b3:	eb 59                	jmp    80420e <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8041b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041b9:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8041c0:	00 00 00 
+  8041c3:	48 89 d6             	mov    %rdx,%rsi
+  8041c6:	48 89 c7             	mov    %rax,%rdi
+  8041c9:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  8041d0:	00 00 00 
+  8041d3:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8041d5:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  8041dc:	00 00 00 
+  8041df:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8041e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8041ef:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  8041f6:	00 00 00 
+  8041f9:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8041ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804203:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804209:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80420e:	c9                   	leave
+  80420f:	c3                   	ret
+
+0000000000804210 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804210:	55                   	push   %rbp
+  804211:	48 89 e5             	mov    %rsp,%rbp
+  804214:	48 83 ec 10          	sub    $0x10,%rsp
+  804218:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80421c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80421f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804223:	8b 40 0c             	mov    0xc(%rax),%eax
+  804226:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  80422d:	00 00 00 
+  804230:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804232:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804239:	00 00 00 
+  80423c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80423f:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804242:	be 00 00 00 00       	mov    $0x0,%esi
+  804247:	bf 02 00 00 00       	mov    $0x2,%edi
+  80424c:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  804253:	00 00 00 
+  804256:	ff d0                	call   *%rax
+}
+  804258:	c9                   	leave
+  804259:	c3                   	ret
+
+000000000080425a <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80425a:	55                   	push   %rbp
+  80425b:	48 89 e5             	mov    %rsp,%rbp
+  80425e:	48 83 ec 18          	sub    $0x18,%rsp
+  804262:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804266:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804269:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  80426d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804270:	83 e0 03             	and    $0x3,%eax
+}
+  804273:	c9                   	leave
+  804274:	c3                   	ret
+
+0000000000804275 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804275:	55                   	push   %rbp
+  804276:	48 89 e5             	mov    %rsp,%rbp
+  804279:	48 83 ec 10          	sub    $0x10,%rsp
+  80427d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804281:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804285:	48 89 c7             	mov    %rax,%rdi
+  804288:	48 b8 d7 18 80 00 00 	movabs $0x8018d7,%rax
+  80428f:	00 00 00 
+  804292:	ff d0                	call   *%rax
+  804294:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804299:	7e 07                	jle    8042a2 <remove+0x2d>
+    return -E_BAD_PATH;
+  80429b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8042a0:	eb 36                	jmp    8042d8 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8042a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042a6:	48 89 c6             	mov    %rax,%rsi
+  8042a9:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  8042b0:	00 00 00 
+  8042b3:	48 89 c7             	mov    %rax,%rdi
+  8042b6:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  8042bd:	00 00 00 
+  8042c0:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8042c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8042c7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8042cc:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  8042d3:	00 00 00 
+  8042d6:	ff d0                	call   *%rax
+}
+  8042d8:	c9                   	leave
+  8042d9:	c3                   	ret
+
+00000000008042da <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8042da:	55                   	push   %rbp
+  8042db:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8042de:	be 00 00 00 00       	mov    $0x0,%esi
+  8042e3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8042e8:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+}
+  8042f4:	5d                   	pop    %rbp
+  8042f5:	c3                   	ret
+
+00000000008042f6 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8042f6:	55                   	push   %rbp
+  8042f7:	48 89 e5             	mov    %rsp,%rbp
+  8042fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8042fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804302:	be 00 00 00 00       	mov    $0x0,%esi
+  804307:	bf 09 00 00 00       	mov    $0x9,%edi
+  80430c:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  804313:	00 00 00 
+  804316:	ff d0                	call   *%rax
+  804318:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80431b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80431f:	79 05                	jns    804326 <fs_stats+0x30>
+    return r;
+  804321:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804324:	eb 2a                	jmp    804350 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804326:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432a:	ba 68 00 00 00       	mov    $0x68,%edx
+  80432f:	48 b9 00 80 81 00 00 	movabs $0x818000,%rcx
+  804336:	00 00 00 
+  804339:	48 89 ce             	mov    %rcx,%rsi
+  80433c:	48 89 c7             	mov    %rax,%rdi
+  80433f:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+  return 0;
+  80434b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804350:	c9                   	leave
+  804351:	c3                   	ret
+
+0000000000804352 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804352:	55                   	push   %rbp
+  804353:	48 89 e5             	mov    %rsp,%rbp
+  804356:	48 83 ec 10          	sub    $0x10,%rsp
+  80435a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80435d:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804364:	00 00 00 
+  804367:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80436a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80436c:	be 00 00 00 00       	mov    $0x0,%esi
+  804371:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804376:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  80437d:	00 00 00 
+  804380:	ff d0                	call   *%rax
+}
+  804382:	c9                   	leave
+  804383:	c3                   	ret
+
+0000000000804384 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804384:	55                   	push   %rbp
+  804385:	48 89 e5             	mov    %rsp,%rbp
+  804388:	48 83 ec 10          	sub    $0x10,%rsp
+  80438c:	89 f8                	mov    %edi,%eax
+  80438e:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804391:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804395:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  80439c:	00 00 00 
+  80439f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8043a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8043a6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8043ab:	48 b8 fa 3d 80 00 00 	movabs $0x803dfa,%rax
+  8043b2:	00 00 00 
+  8043b5:	ff d0                	call   *%rax
+}
+  8043b7:	c9                   	leave
+  8043b8:	c3                   	ret
+
+00000000008043b9 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  8043b9:	55                   	push   %rbp
+  8043ba:	48 89 e5             	mov    %rsp,%rbp
+  8043bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8043c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  8043c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043c9:	8b 40 10             	mov    0x10(%rax),%eax
+  8043cc:	85 c0                	test   %eax,%eax
+  8043ce:	7e 73                	jle    804443 <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  8043d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043d4:	8b 40 04             	mov    0x4(%rax),%eax
+  8043d7:	48 63 d0             	movslq %eax,%rdx
+  8043da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043de:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  8043e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043e6:	8b 00                	mov    (%rax),%eax
+  8043e8:	48 89 ce             	mov    %rcx,%rsi
+  8043eb:	89 c7                	mov    %eax,%edi
+  8043ed:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  8043f4:	00 00 00 
+  8043f7:	ff d0                	call   *%rax
+  8043f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  8043fd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804402:	7e 17                	jle    80441b <writebuf+0x62>
+      b->result += result;
+  804404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804408:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80440c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804410:	48 01 c2             	add    %rax,%rdx
+  804413:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804417:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  80441b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80441f:	8b 40 04             	mov    0x4(%rax),%eax
+  804422:	48 98                	cltq
+  804424:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804428:	74 19                	je     804443 <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  80442a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80442e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804433:	48 85 c0             	test   %rax,%rax
+  804436:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80443a:	89 c2                	mov    %eax,%edx
+  80443c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804440:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  804443:	90                   	nop
+  804444:	c9                   	leave
+  804445:	c3                   	ret
+
+0000000000804446 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  804446:	55                   	push   %rbp
+  804447:	48 89 e5             	mov    %rsp,%rbp
+  80444a:	48 83 ec 20          	sub    $0x20,%rsp
+  80444e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804451:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  804455:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804459:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  80445d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804461:	8b 40 04             	mov    0x4(%rax),%eax
+  804464:	8d 48 01             	lea    0x1(%rax),%ecx
+  804467:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80446b:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80446e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804471:	89 d1                	mov    %edx,%ecx
+  804473:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804477:	48 98                	cltq
+  804479:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  80447d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804481:	8b 40 04             	mov    0x4(%rax),%eax
+  804484:	3d 00 01 00 00       	cmp    $0x100,%eax
+  804489:	75 1e                	jne    8044a9 <putch+0x63>
+    writebuf(b);
+  80448b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80448f:	48 89 c7             	mov    %rax,%rdi
+  804492:	48 b8 b9 43 80 00 00 	movabs $0x8043b9,%rax
+  804499:	00 00 00 
+  80449c:	ff d0                	call   *%rax
+    b->idx = 0;
+  80449e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044a2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  8044a9:	90                   	nop
+  8044aa:	c9                   	leave
+  8044ab:	c3                   	ret
+
+00000000008044ac <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8044ac:	55                   	push   %rbp
+  8044ad:	48 89 e5             	mov    %rsp,%rbp
+  8044b0:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8044b7:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  8044bd:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  8044c4:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  8044cb:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  8044d1:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  8044d7:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8044de:	00 00 00 
+  b.result = 0;
+  8044e1:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  8044e8:	00 00 00 00 
+  b.error  = 1;
+  8044ec:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  8044f3:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  8044f6:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  8044fd:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804504:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80450b:	48 89 c6             	mov    %rax,%rsi
+  80450e:	48 b8 46 44 80 00 00 	movabs $0x804446,%rax
+  804515:	00 00 00 
+  804518:	48 89 c7             	mov    %rax,%rdi
+  80451b:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  804522:	00 00 00 
+  804525:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  804527:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  80452d:	85 c0                	test   %eax,%eax
+  80452f:	7e 16                	jle    804547 <vfprintf+0x9b>
+    writebuf(&b);
+  804531:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804538:	48 89 c7             	mov    %rax,%rdi
+  80453b:	48 b8 b9 43 80 00 00 	movabs $0x8043b9,%rax
+  804542:	00 00 00 
+  804545:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  804547:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80454e:	48 85 c0             	test   %rax,%rax
+  804551:	74 09                	je     80455c <vfprintf+0xb0>
+  804553:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80455a:	eb 06                	jmp    804562 <vfprintf+0xb6>
+  80455c:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  804562:	c9                   	leave
+  804563:	c3                   	ret
+
+0000000000804564 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804564:	55                   	push   %rbp
+  804565:	48 89 e5             	mov    %rsp,%rbp
+  804568:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80456f:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  804575:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80457c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804583:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80458a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804591:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804598:	84 c0                	test   %al,%al
+  80459a:	74 20                	je     8045bc <fprintf+0x58>
+  80459c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8045a0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8045a4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8045a8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8045ac:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8045b0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8045b4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8045b8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8045bc:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  8045c3:	00 00 00 
+  8045c6:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8045cd:	00 00 00 
+  8045d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8045d4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8045db:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8045e2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  8045e9:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8045f0:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8045f7:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8045fd:	48 89 ce             	mov    %rcx,%rsi
+  804600:	89 c7                	mov    %eax,%edi
+  804602:	48 b8 ac 44 80 00 00 	movabs $0x8044ac,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804614:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80461a:	c9                   	leave
+  80461b:	c3                   	ret
+
+000000000080461c <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80461c:	55                   	push   %rbp
+  80461d:	48 89 e5             	mov    %rsp,%rbp
+  804620:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804627:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80462e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804635:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80463c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804643:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80464a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804651:	84 c0                	test   %al,%al
+  804653:	74 20                	je     804675 <printf+0x59>
+  804655:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804659:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80465d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804661:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804665:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804669:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80466d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804671:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804675:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80467c:	00 00 00 
+  80467f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804686:	00 00 00 
+  804689:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80468d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804694:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80469b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  8046a2:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8046a9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8046b0:	48 89 c6             	mov    %rax,%rsi
+  8046b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046b8:	48 b8 ac 44 80 00 00 	movabs $0x8044ac,%rax
+  8046bf:	00 00 00 
+  8046c2:	ff d0                	call   *%rax
+  8046c4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8046ca:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8046d0:	c9                   	leave
+  8046d1:	c3                   	ret
+
+00000000008046d2 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8046d2:	55                   	push   %rbp
+  8046d3:	48 89 e5             	mov    %rsp,%rbp
+  8046d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8046da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8046de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e2:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8046e7:	48 89 c7             	mov    %rax,%rdi
+  8046ea:	48 b8 f8 46 80 00 00 	movabs $0x8046f8,%rax
+  8046f1:	00 00 00 
+  8046f4:	ff d0                	call   *%rax
+}
+  8046f6:	c9                   	leave
+  8046f7:	c3                   	ret
+
+00000000008046f8 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8046f8:	55                   	push   %rbp
+  8046f9:	48 89 e5             	mov    %rsp,%rbp
+  8046fc:	48 83 ec 50          	sub    $0x50,%rsp
+  804700:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804704:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804708:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80470f:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804710:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804715:	74 0a                	je     804721 <pipe_size+0x29>
+  804717:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80471e:	00 
+  80471f:	76 0a                	jbe    80472b <pipe_size+0x33>
+    return -E_INVAL;
+  804721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804726:	e9 cc 02 00 00       	jmp    8049f7 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80472b:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80472f:	48 89 c7             	mov    %rax,%rdi
+  804732:	48 b8 db 2e 80 00 00 	movabs $0x802edb,%rax
+  804739:	00 00 00 
+  80473c:	ff d0                	call   *%rax
+  80473e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804741:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804745:	0f 88 a8 02 00 00    	js     8049f3 <pipe_size+0x2fb>
+  80474b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80474f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804754:	48 89 c6             	mov    %rax,%rsi
+  804757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80475c:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  804763:	00 00 00 
+  804766:	ff d0                	call   *%rax
+  804768:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80476b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80476f:	0f 88 7e 02 00 00    	js     8049f3 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804775:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804779:	48 89 c7             	mov    %rax,%rdi
+  80477c:	48 b8 db 2e 80 00 00 	movabs $0x802edb,%rax
+  804783:	00 00 00 
+  804786:	ff d0                	call   *%rax
+  804788:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80478b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80478f:	0f 88 43 02 00 00    	js     8049d8 <pipe_size+0x2e0>
+  804795:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804799:	ba 07 04 00 00       	mov    $0x407,%edx
+  80479e:	48 89 c6             	mov    %rax,%rsi
+  8047a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a6:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  8047ad:	00 00 00 
+  8047b0:	ff d0                	call   *%rax
+  8047b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047b9:	0f 88 19 02 00 00    	js     8049d8 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8047bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047c3:	48 89 c7             	mov    %rax,%rdi
+  8047c6:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  8047cd:	00 00 00 
+  8047d0:	ff d0                	call   *%rax
+  8047d2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8047d6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8047dd:	00 
+  8047de:	e9 a2 00 00 00       	jmp    804885 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8047e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047e7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8047eb:	48 89 c2             	mov    %rax,%rdx
+  8047ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f2:	48 01 d0             	add    %rdx,%rax
+  8047f5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047fa:	48 89 c6             	mov    %rax,%rsi
+  8047fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804802:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  804809:	00 00 00 
+  80480c:	ff d0                	call   *%rax
+  80480e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804811:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804815:	0f 88 37 01 00 00    	js     804952 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80481b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80481f:	48 89 c7             	mov    %rax,%rdi
+  804822:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804829:	00 00 00 
+  80482c:	ff d0                	call   *%rax
+  80482e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804832:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804836:	48 01 c2             	add    %rax,%rdx
+  804839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80483d:	48 c1 e0 0c          	shl    $0xc,%rax
+  804841:	48 89 c1             	mov    %rax,%rcx
+  804844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804848:	48 01 c8             	add    %rcx,%rax
+  80484b:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804851:	48 89 d1             	mov    %rdx,%rcx
+  804854:	ba 00 00 00 00       	mov    $0x0,%edx
+  804859:	48 89 c6             	mov    %rax,%rsi
+  80485c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804861:	48 b8 fe 27 80 00 00 	movabs $0x8027fe,%rax
+  804868:	00 00 00 
+  80486b:	ff d0                	call   *%rax
+  80486d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804870:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804874:	79 0a                	jns    804880 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804876:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80487b:	e9 d3 00 00 00       	jmp    804953 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804880:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804885:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80488c:	00 
+  80488d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804891:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804895:	48 01 d0             	add    %rdx,%rax
+  804898:	48 83 c0 1f          	add    $0x1f,%rax
+  80489c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8048a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048a9:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8048ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048b1:	48 29 d0             	sub    %rdx,%rax
+  8048b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8048b8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8048bc:	0f 82 21 ff ff ff    	jb     8047e3 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8048c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8048ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ce:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8048d2:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8048d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048da:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8048e1:	00 00 00 
+  8048e4:	8b 12                	mov    (%rdx),%edx
+  8048e6:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8048e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ec:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8048f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048f7:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8048fe:	00 00 00 
+  804901:	8b 12                	mov    (%rdx),%edx
+  804903:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804905:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804909:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804910:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804914:	48 89 c7             	mov    %rax,%rdi
+  804917:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  80491e:	00 00 00 
+  804921:	ff d0                	call   *%rax
+  804923:	89 c2                	mov    %eax,%edx
+  804925:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804929:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80492b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80492f:	48 89 c7             	mov    %rax,%rdi
+  804932:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  804939:	00 00 00 
+  80493c:	ff d0                	call   *%rax
+  80493e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804942:	48 83 c2 04          	add    $0x4,%rdx
+  804946:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80494d:	e9 a5 00 00 00       	jmp    8049f7 <pipe_size+0x2ff>
+      goto err2;
+  804952:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804953:	eb 58                	jmp    8049ad <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804955:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804959:	48 c1 e0 0c          	shl    $0xc,%rax
+  80495d:	48 89 c2             	mov    %rax,%rdx
+  804960:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804964:	48 01 d0             	add    %rdx,%rax
+  804967:	48 89 c6             	mov    %rax,%rsi
+  80496a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80496f:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  804976:	00 00 00 
+  804979:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80497b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80497f:	48 89 c7             	mov    %rax,%rdi
+  804982:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804989:	00 00 00 
+  80498c:	ff d0                	call   *%rax
+  80498e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804992:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804996:	48 01 d0             	add    %rdx,%rax
+  804999:	48 89 c6             	mov    %rax,%rsi
+  80499c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049a1:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8049a8:	00 00 00 
+  8049ab:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8049ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049b1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049b5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8049b9:	48 85 c0             	test   %rax,%rax
+  8049bc:	75 97                	jne    804955 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8049be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049c2:	48 89 c6             	mov    %rax,%rsi
+  8049c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ca:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8049d1:	00 00 00 
+  8049d4:	ff d0                	call   *%rax
+  8049d6:	eb 01                	jmp    8049d9 <pipe_size+0x2e1>
+    goto err1;
+  8049d8:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8049d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049dd:	48 89 c6             	mov    %rax,%rsi
+  8049e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e5:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8049ec:	00 00 00 
+  8049ef:	ff d0                	call   *%rax
+  8049f1:	eb 01                	jmp    8049f4 <pipe_size+0x2fc>
+    goto err;
+  8049f3:	90                   	nop
+err:
+  return r;
+  8049f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8049f7:	c9                   	leave
+  8049f8:	c3                   	ret
+
+00000000008049f9 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8049f9:	55                   	push   %rbp
+  8049fa:	48 89 e5             	mov    %rsp,%rbp
+  8049fd:	53                   	push   %rbx
+  8049fe:	48 83 ec 28          	sub    $0x28,%rsp
+  804a02:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a06:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804a0a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a11:	00 00 00 
+  804a14:	8b 40 04             	mov    0x4(%rax),%eax
+  804a17:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a1c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804a23:	00 00 00 
+  804a26:	48 98                	cltq
+  804a28:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804a2f:	48 01 d0             	add    %rdx,%rax
+  804a32:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804a38:	8b 00                	mov    (%rax),%eax
+  804a3a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804a3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a41:	48 89 c7             	mov    %rax,%rdi
+  804a44:	48 b8 ea 58 80 00 00 	movabs $0x8058ea,%rax
+  804a4b:	00 00 00 
+  804a4e:	ff d0                	call   *%rax
+  804a50:	89 c3                	mov    %eax,%ebx
+  804a52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a56:	48 89 c7             	mov    %rax,%rdi
+  804a59:	48 b8 ea 58 80 00 00 	movabs $0x8058ea,%rax
+  804a60:	00 00 00 
+  804a63:	ff d0                	call   *%rax
+  804a65:	39 c3                	cmp    %eax,%ebx
+  804a67:	0f 94 c0             	sete   %al
+  804a6a:	0f b6 c0             	movzbl %al,%eax
+  804a6d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804a70:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a77:	00 00 00 
+  804a7a:	8b 40 04             	mov    0x4(%rax),%eax
+  804a7d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a82:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804a89:	00 00 00 
+  804a8c:	48 98                	cltq
+  804a8e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804a95:	48 01 d0             	add    %rdx,%rax
+  804a98:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804a9e:	8b 00                	mov    (%rax),%eax
+  804aa0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804aa3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aa6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804aa9:	75 05                	jne    804ab0 <_pipeisclosed+0xb7>
+      return ret;
+  804aab:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804aae:	eb 68                	jmp    804b18 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ab3:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804ab6:	0f 84 4e ff ff ff    	je     804a0a <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804abc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ac3:	00 00 00 
+  804ac6:	8b 40 04             	mov    0x4(%rax),%eax
+  804ac9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ace:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ad5:	00 00 00 
+  804ad8:	48 98                	cltq
+  804ada:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ae1:	48 01 d0             	add    %rdx,%rax
+  804ae4:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804aea:	8b 10                	mov    (%rax),%edx
+  804aec:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804aef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af2:	89 c6                	mov    %eax,%esi
+  804af4:	48 b8 20 61 80 00 00 	movabs $0x806120,%rax
+  804afb:	00 00 00 
+  804afe:	48 89 c7             	mov    %rax,%rdi
+  804b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b06:	49 b8 28 0a 80 00 00 	movabs $0x800a28,%r8
+  804b0d:	00 00 00 
+  804b10:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804b13:	e9 f2 fe ff ff       	jmp    804a0a <_pipeisclosed+0x11>
+  }
+}
+  804b18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b1c:	c9                   	leave
+  804b1d:	c3                   	ret
+
+0000000000804b1e <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804b1e:	55                   	push   %rbp
+  804b1f:	48 89 e5             	mov    %rsp,%rbp
+  804b22:	48 83 ec 30          	sub    $0x30,%rsp
+  804b26:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b29:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804b2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b30:	48 89 d6             	mov    %rdx,%rsi
+  804b33:	89 c7                	mov    %eax,%edi
+  804b35:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  804b3c:	00 00 00 
+  804b3f:	ff d0                	call   *%rax
+  804b41:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b44:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b48:	79 05                	jns    804b4f <pipeisclosed+0x31>
+    return r;
+  804b4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b4d:	eb 31                	jmp    804b80 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804b4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b53:	48 89 c7             	mov    %rax,%rdi
+  804b56:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804b5d:	00 00 00 
+  804b60:	ff d0                	call   *%rax
+  804b62:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804b66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b6a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b6e:	48 89 d6             	mov    %rdx,%rsi
+  804b71:	48 89 c7             	mov    %rax,%rdi
+  804b74:	48 b8 f9 49 80 00 00 	movabs $0x8049f9,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+}
+  804b80:	c9                   	leave
+  804b81:	c3                   	ret
+
+0000000000804b82 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804b82:	55                   	push   %rbp
+  804b83:	48 89 e5             	mov    %rsp,%rbp
+  804b86:	48 83 ec 10          	sub    $0x10,%rsp
+  804b8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804b8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b92:	8b 40 18             	mov    0x18(%rax),%eax
+  804b95:	8d 50 01             	lea    0x1(%rax),%edx
+  804b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b9c:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804b9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ba3:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804ba6:	85 c0                	test   %eax,%eax
+  804ba8:	74 27                	je     804bd1 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804baa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bae:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bb9:	48 83 c0 18          	add    $0x18,%rax
+  804bbd:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804bc2:	48 89 c7             	mov    %rax,%rdi
+  804bc5:	48 b8 a1 2b 80 00 00 	movabs $0x802ba1,%rax
+  804bcc:	00 00 00 
+  804bcf:	ff d0                	call   *%rax
+  }
+}
+  804bd1:	90                   	nop
+  804bd2:	c9                   	leave
+  804bd3:	c3                   	ret
+
+0000000000804bd4 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804bd4:	55                   	push   %rbp
+  804bd5:	48 89 e5             	mov    %rsp,%rbp
+  804bd8:	48 83 ec 10          	sub    $0x10,%rsp
+  804bdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804be0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804be3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804be7:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804bee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bf2:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804bf6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804bf9:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804c00:	89 c6                	mov    %eax,%esi
+  804c02:	48 89 cf             	mov    %rcx,%rdi
+  804c05:	48 b8 52 2b 80 00 00 	movabs $0x802b52,%rax
+  804c0c:	00 00 00 
+  804c0f:	ff d0                	call   *%rax
+}
+  804c11:	90                   	nop
+  804c12:	c9                   	leave
+  804c13:	c3                   	ret
+
+0000000000804c14 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c14:	55                   	push   %rbp
+  804c15:	48 89 e5             	mov    %rsp,%rbp
+  804c18:	48 83 ec 70          	sub    $0x70,%rsp
+  804c1c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804c20:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804c24:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804c28:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c2c:	48 89 c7             	mov    %rax,%rdi
+  804c2f:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804c36:	00 00 00 
+  804c39:	ff d0                	call   *%rax
+  804c3b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804c3f:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804c44:	75 0a                	jne    804c50 <devpipe_read+0x3c>
+    return 0;
+  804c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4b:	e9 63 01 00 00       	jmp    804db3 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804c50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c54:	8b 40 18             	mov    0x18(%rax),%eax
+  804c57:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804c5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c5e:	48 8b 10             	mov    (%rax),%rdx
+  804c61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c65:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c69:	48 39 c2             	cmp    %rax,%rdx
+  804c6c:	75 42                	jne    804cb0 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804c6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c72:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c76:	48 89 d6             	mov    %rdx,%rsi
+  804c79:	48 89 c7             	mov    %rax,%rdi
+  804c7c:	48 b8 f9 49 80 00 00 	movabs $0x8049f9,%rax
+  804c83:	00 00 00 
+  804c86:	ff d0                	call   *%rax
+  804c88:	85 c0                	test   %eax,%eax
+  804c8a:	74 0a                	je     804c96 <devpipe_read+0x82>
+      return 0;
+  804c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c91:	e9 1d 01 00 00       	jmp    804db3 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804c96:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804c99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c9d:	89 d6                	mov    %edx,%esi
+  804c9f:	48 89 c7             	mov    %rax,%rdi
+  804ca2:	48 b8 d4 4b 80 00 00 	movabs $0x804bd4,%rax
+  804ca9:	00 00 00 
+  804cac:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804cae:	eb a0                	jmp    804c50 <devpipe_read+0x3c>
+      break;
+  804cb0:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804cb1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804cb5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804cb9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804cbd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804cc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804cc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ccd:	48 8b 00             	mov    (%rax),%rax
+  804cd0:	48 29 c2             	sub    %rax,%rdx
+  804cd3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804cd7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804cdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cdf:	48 39 c2             	cmp    %rax,%rdx
+  804ce2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ce6:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804cea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cee:	48 8b 00             	mov    (%rax),%rax
+  804cf1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804cf5:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804cf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cfe:	48 f7 f1             	div    %rcx
+  804d01:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804d05:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d09:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d11:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804d15:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804d19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d1d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d25:	48 39 c2             	cmp    %rax,%rdx
+  804d28:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d2c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d34:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804d38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d3c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804d40:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d48:	48 89 ce             	mov    %rcx,%rsi
+  804d4b:	48 89 c7             	mov    %rax,%rdi
+  804d4e:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  804d55:	00 00 00 
+  804d58:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804d5a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d5e:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804d62:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d66:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804d6a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d6e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d72:	48 01 d1             	add    %rdx,%rcx
+  804d75:	48 89 c2             	mov    %rax,%rdx
+  804d78:	48 89 cf             	mov    %rcx,%rdi
+  804d7b:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  804d82:	00 00 00 
+  804d85:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d8b:	48 8b 10             	mov    (%rax),%rdx
+  804d8e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d92:	48 01 c2             	add    %rax,%rdx
+  804d95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d99:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804d9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804da0:	48 89 c7             	mov    %rax,%rdi
+  804da3:	48 b8 82 4b 80 00 00 	movabs $0x804b82,%rax
+  804daa:	00 00 00 
+  804dad:	ff d0                	call   *%rax
+  return n;
+  804daf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804db3:	c9                   	leave
+  804db4:	c3                   	ret
+
+0000000000804db5 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804db5:	55                   	push   %rbp
+  804db6:	48 89 e5             	mov    %rsp,%rbp
+  804db9:	48 83 ec 70          	sub    $0x70,%rsp
+  804dbd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804dc1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804dc5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804dc9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804dcd:	48 89 c7             	mov    %rax,%rdi
+  804dd0:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804dd7:	00 00 00 
+  804dda:	ff d0                	call   *%rax
+  804ddc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804de0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804de4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804de8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804def:	00 
+  804df0:	e9 b8 01 00 00       	jmp    804fad <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804df5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df9:	8b 40 18             	mov    0x18(%rax),%eax
+  804dfc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e03:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e0b:	48 8b 00             	mov    (%rax),%rax
+  804e0e:	48 29 c2             	sub    %rax,%rdx
+  804e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e15:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e19:	48 39 c2             	cmp    %rax,%rdx
+  804e1c:	75 4d                	jne    804e6b <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804e1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e22:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e26:	48 89 d6             	mov    %rdx,%rsi
+  804e29:	48 89 c7             	mov    %rax,%rdi
+  804e2c:	48 b8 f9 49 80 00 00 	movabs $0x8049f9,%rax
+  804e33:	00 00 00 
+  804e36:	ff d0                	call   *%rax
+  804e38:	85 c0                	test   %eax,%eax
+  804e3a:	74 0a                	je     804e46 <devpipe_write+0x91>
+        return 0;
+  804e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e41:	e9 79 01 00 00       	jmp    804fbf <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804e46:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e4d:	89 d6                	mov    %edx,%esi
+  804e4f:	48 89 c7             	mov    %rax,%rdi
+  804e52:	48 b8 d4 4b 80 00 00 	movabs $0x804bd4,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+      m = 0;
+  804e5e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804e65:	00 
+      continue;
+  804e66:	e9 3a 01 00 00       	jmp    804fa5 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804e6b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e6f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804e73:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e7b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804e7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e83:	48 8b 08             	mov    (%rax),%rcx
+  804e86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e8a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e8e:	48 29 c1             	sub    %rax,%rcx
+  804e91:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804e95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e99:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ea1:	48 39 c2             	cmp    %rax,%rdx
+  804ea4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ea8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804eac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804eb4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804eb8:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ec1:	48 f7 f1             	div    %rcx
+  804ec4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ecc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804ed0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ed8:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804edc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804ee0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ee4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ee8:	48 39 c2             	cmp    %rax,%rdx
+  804eeb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804eef:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804ef3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ef7:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804efb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804eff:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804f03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f07:	48 01 d1             	add    %rdx,%rcx
+  804f0a:	48 89 c2             	mov    %rax,%rdx
+  804f0d:	48 89 cf             	mov    %rcx,%rdi
+  804f10:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  804f17:	00 00 00 
+  804f1a:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f20:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f24:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f28:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804f2c:	73 4d                	jae    804f7b <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804f2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f3a:	48 29 c2             	sub    %rax,%rdx
+  804f3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f41:	48 01 c2             	add    %rax,%rdx
+  804f44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f48:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f4c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f50:	48 89 c1             	mov    %rax,%rcx
+  804f53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f57:	48 01 c1             	add    %rax,%rcx
+  804f5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f5e:	48 01 c1             	add    %rax,%rcx
+  804f61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f65:	48 83 c0 20          	add    $0x20,%rax
+  804f69:	48 89 ce             	mov    %rcx,%rsi
+  804f6c:	48 89 c7             	mov    %rax,%rdi
+  804f6f:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  804f76:	00 00 00 
+  804f79:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f87:	48 01 c2             	add    %rax,%rdx
+  804f8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f8e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804f92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f96:	48 89 c7             	mov    %rax,%rdi
+  804f99:	48 b8 82 4b 80 00 00 	movabs $0x804b82,%rax
+  804fa0:	00 00 00 
+  804fa3:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804fa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fa9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804fad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb1:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804fb5:	0f 82 3a fe ff ff    	jb     804df5 <devpipe_write+0x40>
+  }
+
+  return i;
+  804fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804fbf:	c9                   	leave
+  804fc0:	c3                   	ret
+
+0000000000804fc1 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804fc1:	55                   	push   %rbp
+  804fc2:	48 89 e5             	mov    %rsp,%rbp
+  804fc5:	48 83 ec 40          	sub    $0x40,%rsp
+  804fc9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804fcd:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804fd0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804fd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fd8:	48 89 c7             	mov    %rax,%rdi
+  804fdb:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  804fe2:	00 00 00 
+  804fe5:	ff d0                	call   *%rax
+  804fe7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804feb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ff6:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804ffa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ffe:	48 89 d6             	mov    %rdx,%rsi
+  805001:	48 89 c7             	mov    %rax,%rdi
+  805004:	48 b8 83 39 80 00 00 	movabs $0x803983,%rax
+  80500b:	00 00 00 
+  80500e:	ff d0                	call   *%rax
+  805010:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805013:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805017:	79 08                	jns    805021 <devpipe_poll+0x60>
+    return r;
+  805019:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80501c:	e9 85 00 00 00       	jmp    8050a6 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805021:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805024:	83 e0 01             	and    $0x1,%eax
+  805027:	85 c0                	test   %eax,%eax
+  805029:	74 18                	je     805043 <devpipe_poll+0x82>
+  80502b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80502f:	48 8b 10             	mov    (%rax),%rdx
+  805032:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805036:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80503a:	48 39 c2             	cmp    %rax,%rdx
+  80503d:	74 04                	je     805043 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80503f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805043:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805046:	83 e0 02             	and    $0x2,%eax
+  805049:	85 c0                	test   %eax,%eax
+  80504b:	74 23                	je     805070 <devpipe_poll+0xaf>
+  80504d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805051:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805059:	48 8b 00             	mov    (%rax),%rax
+  80505c:	48 29 c2             	sub    %rax,%rdx
+  80505f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805063:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805067:	48 39 c2             	cmp    %rax,%rdx
+  80506a:	73 04                	jae    805070 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80506c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805070:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805074:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805078:	48 89 d6             	mov    %rdx,%rsi
+  80507b:	48 89 c7             	mov    %rax,%rdi
+  80507e:	48 b8 f9 49 80 00 00 	movabs $0x8049f9,%rax
+  805085:	00 00 00 
+  805088:	ff d0                	call   *%rax
+  80508a:	85 c0                	test   %eax,%eax
+  80508c:	74 04                	je     805092 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80508e:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805092:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805096:	75 0b                	jne    8050a3 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805098:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80509c:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8050a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8050a6:	c9                   	leave
+  8050a7:	c3                   	ret
+
+00000000008050a8 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8050a8:	55                   	push   %rbp
+  8050a9:	48 89 e5             	mov    %rsp,%rbp
+  8050ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8050b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050bc:	48 89 c7             	mov    %rax,%rdi
+  8050bf:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  8050c6:	00 00 00 
+  8050c9:	ff d0                	call   *%rax
+  8050cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8050cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050d3:	48 ba 51 61 80 00 00 	movabs $0x806151,%rdx
+  8050da:	00 00 00 
+  8050dd:	48 89 d6             	mov    %rdx,%rsi
+  8050e0:	48 89 c7             	mov    %rax,%rdi
+  8050e3:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  8050ea:	00 00 00 
+  8050ed:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8050ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050f3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8050f7:	89 c1                	mov    %eax,%ecx
+  8050f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050fd:	48 8b 00             	mov    (%rax),%rax
+  805100:	89 c2                	mov    %eax,%edx
+  805102:	89 c8                	mov    %ecx,%eax
+  805104:	29 d0                	sub    %edx,%eax
+  805106:	89 c2                	mov    %eax,%edx
+  805108:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80510c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805112:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805116:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80511d:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805120:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805124:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  80512b:	00 00 00 
+  80512e:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80513a:	c9                   	leave
+  80513b:	c3                   	ret
+
+000000000080513c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80513c:	55                   	push   %rbp
+  80513d:	48 89 e5             	mov    %rsp,%rbp
+  805140:	48 83 ec 40          	sub    $0x40,%rsp
+  805144:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805148:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80514c:	48 89 c7             	mov    %rax,%rdi
+  80514f:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  805156:	00 00 00 
+  805159:	ff d0                	call   *%rax
+  80515b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80515f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805166:	00 
+  805167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80516b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80516f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805173:	48 01 d0             	add    %rdx,%rax
+  805176:	48 83 c0 1f          	add    $0x1f,%rax
+  80517a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80517e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805182:	ba 00 00 00 00       	mov    $0x0,%edx
+  805187:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80518b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80518f:	48 29 d0             	sub    %rdx,%rax
+  805192:	48 c1 e8 0c          	shr    $0xc,%rax
+  805196:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80519a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80519e:	48 89 c6             	mov    %rax,%rsi
+  8051a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a6:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8051ad:	00 00 00 
+  8051b0:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8051b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051b6:	48 89 c7             	mov    %rax,%rdi
+  8051b9:	48 b8 82 4b 80 00 00 	movabs $0x804b82,%rax
+  8051c0:	00 00 00 
+  8051c3:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8051c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8051cd:	eb 2f                	jmp    8051fe <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8051cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051d3:	48 83 e8 01          	sub    $0x1,%rax
+  8051d7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8051db:	48 89 c2             	mov    %rax,%rdx
+  8051de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051e2:	48 01 d0             	add    %rdx,%rax
+  8051e5:	48 89 c6             	mov    %rax,%rsi
+  8051e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051ed:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  8051f4:	00 00 00 
+  8051f7:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8051f9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8051fe:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805203:	77 ca                	ja     8051cf <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805209:	48 89 c6             	mov    %rax,%rsi
+  80520c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805211:	48 b8 5e 28 80 00 00 	movabs $0x80285e,%rax
+  805218:	00 00 00 
+  80521b:	ff d0                	call   *%rax
+}
+  80521d:	c9                   	leave
+  80521e:	c3                   	ret
+
+000000000080521f <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80521f:	55                   	push   %rbp
+  805220:	48 89 e5             	mov    %rsp,%rbp
+  805223:	48 83 ec 08          	sub    $0x8,%rsp
+  805227:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80522a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80522e:	75 10                	jne    805240 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805230:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805237:	00 00 00 
+  80523a:	8b 00                	mov    (%rax),%eax
+  80523c:	48 98                	cltq
+  80523e:	eb 05                	jmp    805245 <vsyscall+0x26>
+  }
+  return 0;
+  805240:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805245:	c9                   	leave
+  805246:	c3                   	ret
+
+0000000000805247 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805247:	55                   	push   %rbp
+  805248:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80524b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805250:	48 b8 1f 52 80 00 00 	movabs $0x80521f,%rax
+  805257:	00 00 00 
+  80525a:	ff d0                	call   *%rax
+}
+  80525c:	5d                   	pop    %rbp
+  80525d:	c3                   	ret
+
+000000000080525e <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80525e:	55                   	push   %rbp
+  80525f:	48 89 e5             	mov    %rsp,%rbp
+  805262:	48 83 ec 20          	sub    $0x20,%rsp
+  __asm __volatile("rdtsc"
+  805266:	0f 31                	rdtsc
+  805268:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80526b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80526e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805271:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805274:	48 c1 e2 20          	shl    $0x20,%rdx
+  805278:	48 09 d0             	or     %rdx,%rax
+  80527b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80527f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805283:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805287:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80528e:	00 00 00 
+  805291:	8b 40 08             	mov    0x8(%rax),%eax
+  805294:	48 98                	cltq
+  805296:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80529a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80529e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052a3:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8052a7:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8052ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052b7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8052bb:	48 89 d0             	mov    %rdx,%rax
+  8052be:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8052c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052ca:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8052ce:	48 01 c8             	add    %rcx,%rax
+}
+  8052d1:	c9                   	leave
+  8052d2:	c3                   	ret
+
+00000000008052d3 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8052d3:	55                   	push   %rbp
+  8052d4:	48 89 e5             	mov    %rsp,%rbp
+  8052d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8052db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8052de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052e1:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8052e4:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8052e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8052ed:	48 89 c7             	mov    %rax,%rdi
+  8052f0:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  8052f7:	00 00 00 
+  8052fa:	ff d0                	call   *%rax
+}
+  8052fc:	90                   	nop
+  8052fd:	c9                   	leave
+  8052fe:	c3                   	ret
+
+00000000008052ff <getchar>:
+
+int
+getchar(void) {
+  8052ff:	55                   	push   %rbp
+  805300:	48 89 e5             	mov    %rsp,%rbp
+  805303:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805307:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  80530b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805310:	48 89 c6             	mov    %rax,%rsi
+  805313:	bf 00 00 00 00       	mov    $0x0,%edi
+  805318:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  80531f:	00 00 00 
+  805322:	ff d0                	call   *%rax
+  805324:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805327:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80532b:	79 05                	jns    805332 <getchar+0x33>
+    return r;
+  80532d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805330:	eb 14                	jmp    805346 <getchar+0x47>
+  if (r < 1)
+  805332:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805336:	7f 07                	jg     80533f <getchar+0x40>
+    return -E_EOF;
+  805338:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80533d:	eb 07                	jmp    805346 <getchar+0x47>
+  return c;
+  80533f:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805343:	0f b6 c0             	movzbl %al,%eax
+}
+  805346:	c9                   	leave
+  805347:	c3                   	ret
+
+0000000000805348 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805348:	55                   	push   %rbp
+  805349:	48 89 e5             	mov    %rsp,%rbp
+  80534c:	48 83 ec 20          	sub    $0x20,%rsp
+  805350:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805353:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805357:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80535a:	48 89 d6             	mov    %rdx,%rsi
+  80535d:	89 c7                	mov    %eax,%edi
+  80535f:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  805366:	00 00 00 
+  805369:	ff d0                	call   *%rax
+  80536b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80536e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805372:	79 05                	jns    805379 <iscons+0x31>
+    return r;
+  805374:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805377:	eb 1a                	jmp    805393 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805379:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80537d:	8b 10                	mov    (%rax),%edx
+  80537f:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805386:	00 00 00 
+  805389:	8b 00                	mov    (%rax),%eax
+  80538b:	39 c2                	cmp    %eax,%edx
+  80538d:	0f 94 c0             	sete   %al
+  805390:	0f b6 c0             	movzbl %al,%eax
+}
+  805393:	c9                   	leave
+  805394:	c3                   	ret
+
+0000000000805395 <opencons>:
+
+int
+opencons(void) {
+  805395:	55                   	push   %rbp
+  805396:	48 89 e5             	mov    %rsp,%rbp
+  805399:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80539d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8053a1:	48 89 c7             	mov    %rax,%rdi
+  8053a4:	48 b8 db 2e 80 00 00 	movabs $0x802edb,%rax
+  8053ab:	00 00 00 
+  8053ae:	ff d0                	call   *%rax
+  8053b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053b7:	79 05                	jns    8053be <opencons+0x29>
+    return r;
+  8053b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053bc:	eb 66                	jmp    805424 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8053be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053c2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8053c7:	48 89 c6             	mov    %rax,%rsi
+  8053ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053cf:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  8053d6:	00 00 00 
+  8053d9:	ff d0                	call   *%rax
+  8053db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053e2:	79 05                	jns    8053e9 <opencons+0x54>
+    return r;
+  8053e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053e7:	eb 3b                	jmp    805424 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8053e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053ed:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8053f4:	00 00 00 
+  8053f7:	8b 12                	mov    (%rdx),%edx
+  8053f9:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8053fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053ff:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805406:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80540a:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805411:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805415:	48 89 c7             	mov    %rax,%rdi
+  805418:	48 b8 8d 2e 80 00 00 	movabs $0x802e8d,%rax
+  80541f:	00 00 00 
+  805422:	ff d0                	call   *%rax
+}
+  805424:	c9                   	leave
+  805425:	c3                   	ret
+
+0000000000805426 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805426:	55                   	push   %rbp
+  805427:	48 89 e5             	mov    %rsp,%rbp
+  80542a:	48 83 ec 20          	sub    $0x20,%rsp
+  80542e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805431:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805434:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805438:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80543b:	48 89 d6             	mov    %rdx,%rsi
+  80543e:	89 c7                	mov    %eax,%edi
+  805440:	48 b8 bd 2f 80 00 00 	movabs $0x802fbd,%rax
+  805447:	00 00 00 
+  80544a:	ff d0                	call   *%rax
+  80544c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80544f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805453:	79 05                	jns    80545a <consmode+0x34>
+    return r;
+  805455:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805458:	eb 34                	jmp    80548e <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80545a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80545e:	8b 10                	mov    (%rax),%edx
+  805460:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805467:	00 00 00 
+  80546a:	8b 00                	mov    (%rax),%eax
+  80546c:	39 c2                	cmp    %eax,%edx
+  80546e:	74 07                	je     805477 <consmode+0x51>
+    return -E_INVAL;
+  805470:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805475:	eb 17                	jmp    80548e <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80547b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80547e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805481:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805485:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805488:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80548b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80548e:	c9                   	leave
+  80548f:	c3                   	ret
+
+0000000000805490 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805490:	55                   	push   %rbp
+  805491:	48 89 e5             	mov    %rsp,%rbp
+  805494:	48 83 ec 20          	sub    $0x20,%rsp
+  805498:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80549c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8054a0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8054a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054a8:	8b 50 0c             	mov    0xc(%rax),%edx
+  8054ab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8054af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054b3:	48 89 ce             	mov    %rcx,%rsi
+  8054b6:	48 89 c7             	mov    %rax,%rdi
+  8054b9:	48 b8 00 2b 80 00 00 	movabs $0x802b00,%rax
+  8054c0:	00 00 00 
+  8054c3:	ff d0                	call   *%rax
+  8054c5:	48 98                	cltq
+}
+  8054c7:	c9                   	leave
+  8054c8:	c3                   	ret
+
+00000000008054c9 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8054c9:	55                   	push   %rbp
+  8054ca:	48 89 e5             	mov    %rsp,%rbp
+  8054cd:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8054d4:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8054db:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8054e2:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8054e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8054f0:	eb 74                	jmp    805566 <devcons_write+0x9d>
+    m = n - tot;
+  8054f2:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8054f9:	89 c2                	mov    %eax,%edx
+  8054fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054fe:	29 c2                	sub    %eax,%edx
+  805500:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805503:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805506:	83 f8 7f             	cmp    $0x7f,%eax
+  805509:	76 07                	jbe    805512 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  80550b:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805512:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805515:	48 63 d0             	movslq %eax,%rdx
+  805518:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80551b:	48 63 c8             	movslq %eax,%rcx
+  80551e:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805525:	48 01 c1             	add    %rax,%rcx
+  805528:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80552f:	48 89 ce             	mov    %rcx,%rsi
+  805532:	48 89 c7             	mov    %rax,%rdi
+  805535:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  80553c:	00 00 00 
+  80553f:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805541:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805544:	48 63 d0             	movslq %eax,%rdx
+  805547:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80554e:	48 89 d6             	mov    %rdx,%rsi
+  805551:	48 89 c7             	mov    %rax,%rdi
+  805554:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  80555b:	00 00 00 
+  80555e:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805560:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805563:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805566:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805569:	48 98                	cltq
+  80556b:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805572:	0f 82 7a ff ff ff    	jb     8054f2 <devcons_write+0x29>
+  }
+  return tot;
+  805578:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80557b:	48 98                	cltq
+}
+  80557d:	c9                   	leave
+  80557e:	c3                   	ret
+
+000000000080557f <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80557f:	55                   	push   %rbp
+  805580:	48 89 e5             	mov    %rsp,%rbp
+  805583:	48 83 ec 08          	sub    $0x8,%rsp
+  805587:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80558b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805590:	c9                   	leave
+  805591:	c3                   	ret
+
+0000000000805592 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805592:	55                   	push   %rbp
+  805593:	48 89 e5             	mov    %rsp,%rbp
+  805596:	48 83 ec 10          	sub    $0x10,%rsp
+  80559a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80559e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8055a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055a6:	48 ba 5d 61 80 00 00 	movabs $0x80615d,%rdx
+  8055ad:	00 00 00 
+  8055b0:	48 89 d6             	mov    %rdx,%rsi
+  8055b3:	48 89 c7             	mov    %rax,%rdi
+  8055b6:	48 b8 d8 19 80 00 00 	movabs $0x8019d8,%rax
+  8055bd:	00 00 00 
+  8055c0:	ff d0                	call   *%rax
+  return 0;
+  8055c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055c7:	c9                   	leave
+  8055c8:	c3                   	ret
+
+00000000008055c9 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8055c9:	55                   	push   %rbp
+  8055ca:	48 89 e5             	mov    %rsp,%rbp
+  8055cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8055d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8055d5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8055d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8055dc:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8055e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8055e6:	83 e0 02             	and    $0x2,%eax
+  8055e9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8055ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8055f3:	83 f8 01             	cmp    $0x1,%eax
+  8055f6:	75 04                	jne    8055fc <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8055f8:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8055fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8055ff:	83 e0 01             	and    $0x1,%eax
+  805602:	85 c0                	test   %eax,%eax
+  805604:	74 44                	je     80564a <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805606:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805609:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80560e:	89 c2                	mov    %eax,%edx
+  805610:	be 00 00 00 00       	mov    $0x0,%esi
+  805615:	bf 00 00 00 00       	mov    $0x0,%edi
+  80561a:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  805621:	00 00 00 
+  805624:	ff d0                	call   *%rax
+  805626:	83 f8 01             	cmp    $0x1,%eax
+  805629:	75 06                	jne    805631 <devcons_poll+0x68>
+      revents |= POLLIN;
+  80562b:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80562f:	eb 19                	jmp    80564a <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805631:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805635:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80563b:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80563e:	89 c2                	mov    %eax,%edx
+  805640:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805644:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  80564a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80564d:	c9                   	leave
+  80564e:	c3                   	ret
+
+000000000080564f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80564f:	55                   	push   %rbp
+  805650:	48 89 e5             	mov    %rsp,%rbp
+  805653:	48 83 ec 20          	sub    $0x20,%rsp
+  805657:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80565b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80565f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805663:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805667:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80566b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80566f:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805676:	48 89 c7             	mov    %rax,%rdi
+  805679:	48 b8 87 56 80 00 00 	movabs $0x805687,%rax
+  805680:	00 00 00 
+  805683:	ff d0                	call   *%rax
+}
+  805685:	c9                   	leave
+  805686:	c3                   	ret
+
+0000000000805687 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805687:	55                   	push   %rbp
+  805688:	48 89 e5             	mov    %rsp,%rbp
+  80568b:	48 83 ec 30          	sub    $0x30,%rsp
+  80568f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805693:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805697:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80569b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80569f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8056a4:	75 0e                	jne    8056b4 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8056a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056ad:	00 00 00 
+  8056b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8056b4:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8056b9:	75 18                	jne    8056d3 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8056bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056bf:	48 89 c7             	mov    %rax,%rdi
+  8056c2:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  8056c9:	00 00 00 
+  8056cc:	ff d0                	call   *%rax
+  8056ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056d1:	eb 1d                	jmp    8056f0 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8056d3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8056d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056db:	48 89 d6             	mov    %rdx,%rsi
+  8056de:	48 89 c7             	mov    %rax,%rdi
+  8056e1:	48 b8 2c 2a 80 00 00 	movabs $0x802a2c,%rax
+  8056e8:	00 00 00 
+  8056eb:	ff d0                	call   *%rax
+  8056ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8056f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056f4:	79 2a                	jns    805720 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8056f6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8056fb:	74 0a                	je     805707 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8056fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805701:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805707:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80570c:	74 0a                	je     805718 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  80570e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805712:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805718:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80571b:	e9 aa 00 00 00       	jmp    8057ca <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805720:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805725:	74 36                	je     80575d <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805727:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80572e:	00 00 00 
+  805731:	8b 40 04             	mov    0x4(%rax),%eax
+  805734:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805739:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805740:	00 00 00 
+  805743:	48 98                	cltq
+  805745:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80574c:	48 01 d0             	add    %rdx,%rax
+  80574f:	48 05 24 01 00 00    	add    $0x124,%rax
+  805755:	8b 10                	mov    (%rax),%edx
+  805757:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80575b:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80575d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805762:	74 36                	je     80579a <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805764:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80576b:	00 00 00 
+  80576e:	8b 40 04             	mov    0x4(%rax),%eax
+  805771:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805776:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80577d:	00 00 00 
+  805780:	48 98                	cltq
+  805782:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805789:	48 01 d0             	add    %rdx,%rax
+  80578c:	48 05 28 01 00 00    	add    $0x128,%rax
+  805792:	8b 10                	mov    (%rax),%edx
+  805794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805798:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80579a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057a1:	00 00 00 
+  8057a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8057a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8057ac:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8057b3:	00 00 00 
+  8057b6:	48 98                	cltq
+  8057b8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057bf:	48 01 d0             	add    %rdx,%rax
+  8057c2:	48 05 20 01 00 00    	add    $0x120,%rax
+  8057c8:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8057ca:	c9                   	leave
+  8057cb:	c3                   	ret
+
+00000000008057cc <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8057cc:	55                   	push   %rbp
+  8057cd:	48 89 e5             	mov    %rsp,%rbp
+  8057d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8057d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057d7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8057da:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8057de:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8057e1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8057e6:	75 5e                	jne    805846 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8057e8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057ef:	00 00 00 
+  8057f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8057f6:	eb 4e                	jmp    805846 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8057f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057fc:	79 3c                	jns    80583a <ipc_send+0x6e>
+  8057fe:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805802:	74 36                	je     80583a <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805804:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805807:	89 c1                	mov    %eax,%ecx
+  805809:	48 b8 68 61 80 00 00 	movabs $0x806168,%rax
+  805810:	00 00 00 
+  805813:	48 89 c2             	mov    %rax,%rdx
+  805816:	be 54 00 00 00       	mov    $0x54,%esi
+  80581b:	48 b8 8e 61 80 00 00 	movabs $0x80618e,%rax
+  805822:	00 00 00 
+  805825:	48 89 c7             	mov    %rax,%rdi
+  805828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582d:	49 b8 09 08 80 00 00 	movabs $0x800809,%r8
+  805834:	00 00 00 
+  805837:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  80583a:	48 b8 69 27 80 00 00 	movabs $0x802769,%rax
+  805841:	00 00 00 
+  805844:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805846:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805849:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80584c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805850:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805853:	89 c7                	mov    %eax,%edi
+  805855:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  80585c:	00 00 00 
+  80585f:	ff d0                	call   *%rax
+  805861:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805864:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805868:	75 8e                	jne    8057f8 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  80586a:	48 b8 69 27 80 00 00 	movabs $0x802769,%rax
+  805871:	00 00 00 
+  805874:	ff d0                	call   *%rax
+}
+  805876:	90                   	nop
+  805877:	c9                   	leave
+  805878:	c3                   	ret
+
+0000000000805879 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805879:	55                   	push   %rbp
+  80587a:	48 89 e5             	mov    %rsp,%rbp
+  80587d:	48 83 ec 18          	sub    $0x18,%rsp
+  805881:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805884:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80588b:	eb 4d                	jmp    8058da <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80588d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805894:	00 00 00 
+  805897:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80589a:	48 98                	cltq
+  80589c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8058a3:	48 01 d0             	add    %rdx,%rax
+  8058a6:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8058ac:	8b 00                	mov    (%rax),%eax
+  8058ae:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8058b1:	75 23                	jne    8058d6 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8058b3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8058ba:	00 00 00 
+  8058bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058c0:	48 98                	cltq
+  8058c2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8058c9:	48 01 d0             	add    %rdx,%rax
+  8058cc:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8058d2:	8b 00                	mov    (%rax),%eax
+  8058d4:	eb 12                	jmp    8058e8 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8058d6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8058da:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8058e1:	7e aa                	jle    80588d <ipc_find_env+0x14>
+  return 0;
+  8058e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058e8:	c9                   	leave
+  8058e9:	c3                   	ret
+
+00000000008058ea <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8058ea:	55                   	push   %rbp
+  8058eb:	48 89 e5             	mov    %rsp,%rbp
+  8058ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8058f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8058f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8058fe:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805903:	48 89 c2             	mov    %rax,%rdx
+  805906:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80590d:	01 00 00 
+  805910:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805914:	83 e0 01             	and    $0x1,%eax
+  805917:	48 85 c0             	test   %rax,%rax
+  80591a:	74 63                	je     80597f <pageref+0x95>
+  80591c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805920:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805924:	48 89 c2             	mov    %rax,%rdx
+  805927:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80592e:	01 00 00 
+  805931:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805935:	83 e0 01             	and    $0x1,%eax
+  805938:	48 85 c0             	test   %rax,%rax
+  80593b:	74 42                	je     80597f <pageref+0x95>
+  80593d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805941:	48 c1 e8 15          	shr    $0x15,%rax
+  805945:	48 89 c2             	mov    %rax,%rdx
+  805948:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80594f:	01 00 00 
+  805952:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805956:	83 e0 01             	and    $0x1,%eax
+  805959:	48 85 c0             	test   %rax,%rax
+  80595c:	74 21                	je     80597f <pageref+0x95>
+  80595e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805962:	48 c1 e8 0c          	shr    $0xc,%rax
+  805966:	48 89 c2             	mov    %rax,%rdx
+  805969:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805970:	01 00 00 
+  805973:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805977:	83 e0 01             	and    $0x1,%eax
+  80597a:	48 85 c0             	test   %rax,%rax
+  80597d:	75 07                	jne    805986 <pageref+0x9c>
+    return 0;
+  80597f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805984:	eb 53                	jmp    8059d9 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805986:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80598a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80598e:	48 89 c2             	mov    %rax,%rdx
+  805991:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805998:	01 00 00 
+  80599b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80599f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8059a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059a7:	83 e0 01             	and    $0x1,%eax
+  8059aa:	48 85 c0             	test   %rax,%rax
+  8059ad:	75 07                	jne    8059b6 <pageref+0xcc>
+    return 0;
+  8059af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059b4:	eb 23                	jmp    8059d9 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8059b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8059be:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8059c5:	00 00 00 
+  8059c8:	48 c1 e0 04          	shl    $0x4,%rax
+  8059cc:	48 01 d0             	add    %rdx,%rax
+  8059cf:	48 83 c0 08          	add    $0x8,%rax
+  8059d3:	0f b7 00             	movzwl (%rax),%eax
+  8059d6:	0f b7 c0             	movzwl %ax,%eax
+}
+  8059d9:	c9                   	leave
+  8059da:	c3                   	ret
+  8059db:	90                   	nop
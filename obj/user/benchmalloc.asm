@@ -0,0 +1,10404 @@
+
+obj/user/benchmalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 27 05 00 00       	call   800553 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <rnd>:
+
+static void *objs[NOBJS];
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(void) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  seed = seed * 1103515245 + 12345;
+  800036:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80003d:	00 00 00 
+  800040:	8b 00                	mov    (%rax),%eax
+  800042:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+  800048:	8d 90 39 30 00 00    	lea    0x3039(%rax),%edx
+  80004e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800055:	00 00 00 
+  800058:	89 10                	mov    %edx,(%rax)
+  return seed >> 8;
+  80005a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800061:	00 00 00 
+  800064:	8b 00                	mov    (%rax),%eax
+  800066:	c1 e8 08             	shr    $0x8,%eax
+}
+  800069:	5d                   	pop    %rbp
+  80006a:	c3                   	ret
+
+000000000080006b <throughput>:
+
+// Average cycles per malloc/free pair of 'size' bytes, keeping up
+// to 'live' objects allocated at a time.
+static uint64_t
+throughput(size_t size, int live, int iters) {
+  80006b:	55                   	push   %rbp
+  80006c:	48 89 e5             	mov    %rsp,%rbp
+  80006f:	48 83 ec 40          	sub    $0x40,%rsp
+  800073:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800077:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80007a:	89 55 c0             	mov    %edx,-0x40(%rbp)
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80007d:	0f 31                	rdtsc
+  80007f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800082:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  800085:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800088:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80008b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80008f:	48 09 d0             	or     %rdx,%rax
+  800092:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  800096:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t start;
+  int i, j;
+
+  start = read_tsc();
+  80009a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < iters; i += live) {
+  80009e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000a5:	e9 cd 00 00 00       	jmp    800177 <throughput+0x10c>
+    for (j = 0; j < live; j++) {
+  8000aa:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  8000b1:	eb 7b                	jmp    80012e <throughput+0xc3>
+      if (!(objs[j] = malloc(size)))
+  8000b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000b7:	48 89 c7             	mov    %rax,%rdi
+  8000ba:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+  8000c6:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8000cd:	00 00 00 
+  8000d0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8000d3:	48 63 d2             	movslq %edx,%rdx
+  8000d6:	48 89 04 d1          	mov    %rax,(%rcx,%rdx,8)
+  8000da:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8000e1:	00 00 00 
+  8000e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000e7:	48 98                	cltq
+  8000e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8000ed:	48 85 c0             	test   %rax,%rax
+  8000f0:	75 38                	jne    80012a <throughput+0xbf>
+        panic("malloc %ld failed", (long)size);
+  8000f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000f6:	48 89 c1             	mov    %rax,%rcx
+  8000f9:	48 b8 40 6a 80 00 00 	movabs $0x806a40,%rax
+  800100:	00 00 00 
+  800103:	48 89 c2             	mov    %rax,%rdx
+  800106:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80010b:	48 b8 52 6a 80 00 00 	movabs $0x806a52,%rax
+  800112:	00 00 00 
+  800115:	48 89 c7             	mov    %rax,%rdi
+  800118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011d:	49 b8 fa 05 80 00 00 	movabs $0x8005fa,%r8
+  800124:	00 00 00 
+  800127:	41 ff d0             	call   *%r8
+    for (j = 0; j < live; j++) {
+  80012a:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  80012e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800131:	3b 45 c4             	cmp    -0x3c(%rbp),%eax
+  800134:	0f 8c 79 ff ff ff    	jl     8000b3 <throughput+0x48>
+    }
+    for (j = 0; j < live; j++)
+  80013a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  800141:	eb 26                	jmp    800169 <throughput+0xfe>
+      free(objs[j]);
+  800143:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80014a:	00 00 00 
+  80014d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800150:	48 98                	cltq
+  800152:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800156:	48 89 c7             	mov    %rax,%rdi
+  800159:	48 b8 e7 57 80 00 00 	movabs $0x8057e7,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+    for (j = 0; j < live; j++)
+  800165:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  800169:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80016c:	3b 45 c4             	cmp    -0x3c(%rbp),%eax
+  80016f:	7c d2                	jl     800143 <throughput+0xd8>
+  for (i = 0; i < iters; i += live) {
+  800171:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800174:	01 45 fc             	add    %eax,-0x4(%rbp)
+  800177:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80017a:	3b 45 c0             	cmp    -0x40(%rbp),%eax
+  80017d:	0f 8c 27 ff ff ff    	jl     8000aa <throughput+0x3f>
+  __asm __volatile("rdtsc"
+  800183:	0f 31                	rdtsc
+  800185:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800188:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80018b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80018e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800191:	48 c1 e2 20          	shl    $0x20,%rdx
+  800195:	48 09 d0             	or     %rdx,%rax
+  800198:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  return res;
+  80019c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  }
+  return (read_tsc() - start) / i;
+  8001a0:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8001a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001a7:	48 63 f2             	movslq %edx,%rsi
+  8001aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001af:	48 f7 f6             	div    %rsi
+}
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+00000000008001b4 <fragmentation>:
+
+static void
+fragmentation(void) {
+  8001b4:	55                   	push   %rbp
+  8001b5:	48 89 e5             	mov    %rsp,%rbp
+  8001b8:	48 83 ec 20          	sub    $0x20,%rsp
+  size_t inuse, mapped;
+  int i;
+
+  for (i = 0; i < NOBJS; i++) {
+  8001bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8001c3:	e9 c2 00 00 00       	jmp    80028a <fragmentation+0xd6>
+    // Mostly small objects, with a few larger ones.
+    size_t n = rnd() % 8 ? 16 + rnd() % 512 : 1024 + rnd() % 8192;
+  8001c8:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+  8001d4:	83 e0 07             	and    $0x7,%eax
+  8001d7:	85 c0                	test   %eax,%eax
+  8001d9:	74 18                	je     8001f3 <fragmentation+0x3f>
+  8001db:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001e2:	00 00 00 
+  8001e5:	ff d0                	call   *%rax
+  8001e7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8001ec:	83 c0 10             	add    $0x10,%eax
+  8001ef:	89 c0                	mov    %eax,%eax
+  8001f1:	eb 18                	jmp    80020b <fragmentation+0x57>
+  8001f3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001fa:	00 00 00 
+  8001fd:	ff d0                	call   *%rax
+  8001ff:	25 ff 1f 00 00       	and    $0x1fff,%eax
+  800204:	05 00 04 00 00       	add    $0x400,%eax
+  800209:	89 c0                	mov    %eax,%eax
+  80020b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (!(objs[i] = malloc(n)))
+  80020f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800213:	48 89 c7             	mov    %rax,%rdi
+  800216:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  80021d:	00 00 00 
+  800220:	ff d0                	call   *%rax
+  800222:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  800229:	00 00 00 
+  80022c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80022f:	48 63 d2             	movslq %edx,%rdx
+  800232:	48 89 04 d1          	mov    %rax,(%rcx,%rdx,8)
+  800236:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80023d:	00 00 00 
+  800240:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800243:	48 98                	cltq
+  800245:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800249:	48 85 c0             	test   %rax,%rax
+  80024c:	75 38                	jne    800286 <fragmentation+0xd2>
+      panic("malloc %ld failed", (long)n);
+  80024e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800252:	48 89 c1             	mov    %rax,%rcx
+  800255:	48 b8 40 6a 80 00 00 	movabs $0x806a40,%rax
+  80025c:	00 00 00 
+  80025f:	48 89 c2             	mov    %rax,%rdx
+  800262:	be 2f 00 00 00       	mov    $0x2f,%esi
+  800267:	48 b8 52 6a 80 00 00 	movabs $0x806a52,%rax
+  80026e:	00 00 00 
+  800271:	48 89 c7             	mov    %rax,%rdi
+  800274:	b8 00 00 00 00       	mov    $0x0,%eax
+  800279:	49 b8 fa 05 80 00 00 	movabs $0x8005fa,%r8
+  800280:	00 00 00 
+  800283:	41 ff d0             	call   *%r8
+  for (i = 0; i < NOBJS; i++) {
+  800286:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80028a:	81 7d fc ff 0f 00 00 	cmpl   $0xfff,-0x4(%rbp)
+  800291:	0f 8e 31 ff ff ff    	jle    8001c8 <fragmentation+0x14>
+  }
+  malloc_stats(&inuse, &mapped);
+  800297:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80029b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80029f:	48 89 d6             	mov    %rdx,%rsi
+  8002a2:	48 89 c7             	mov    %rax,%rdi
+  8002a5:	48 b8 1e 5c 80 00 00 	movabs $0x805c1e,%rax
+  8002ac:	00 00 00 
+  8002af:	ff d0                	call   *%rax
+  cprintf("fragmentation: %d objects: %ld KiB in use, %ld KiB mapped\n",
+          NOBJS, (long)inuse / 1024, (long)mapped / 1024);
+  8002b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  cprintf("fragmentation: %d objects: %ld KiB in use, %ld KiB mapped\n",
+  8002b5:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  8002bc:	48 85 c0             	test   %rax,%rax
+  8002bf:	48 0f 48 c2          	cmovs  %rdx,%rax
+  8002c3:	48 c1 f8 0a          	sar    $0xa,%rax
+  8002c7:	48 89 c1             	mov    %rax,%rcx
+          NOBJS, (long)inuse / 1024, (long)mapped / 1024);
+  8002ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  cprintf("fragmentation: %d objects: %ld KiB in use, %ld KiB mapped\n",
+  8002ce:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  8002d5:	48 85 c0             	test   %rax,%rax
+  8002d8:	48 0f 48 c2          	cmovs  %rdx,%rax
+  8002dc:	48 c1 f8 0a          	sar    $0xa,%rax
+  8002e0:	48 89 c2             	mov    %rax,%rdx
+  8002e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8002e8:	48 b8 68 6a 80 00 00 	movabs $0x806a68,%rax
+  8002ef:	00 00 00 
+  8002f2:	48 89 c7             	mov    %rax,%rdi
+  8002f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fa:	49 b8 19 08 80 00 00 	movabs $0x800819,%r8
+  800301:	00 00 00 
+  800304:	41 ff d0             	call   *%r8
+
+  for (i = 0; i < NOBJS; i += 2)
+  800307:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80030e:	eb 26                	jmp    800336 <fragmentation+0x182>
+    free(objs[i]);
+  800310:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  800317:	00 00 00 
+  80031a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80031d:	48 98                	cltq
+  80031f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800323:	48 89 c7             	mov    %rax,%rdi
+  800326:	48 b8 e7 57 80 00 00 	movabs $0x8057e7,%rax
+  80032d:	00 00 00 
+  800330:	ff d0                	call   *%rax
+  for (i = 0; i < NOBJS; i += 2)
+  800332:	83 45 fc 02          	addl   $0x2,-0x4(%rbp)
+  800336:	81 7d fc ff 0f 00 00 	cmpl   $0xfff,-0x4(%rbp)
+  80033d:	7e d1                	jle    800310 <fragmentation+0x15c>
+  malloc_stats(&inuse, &mapped);
+  80033f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800343:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  800347:	48 89 d6             	mov    %rdx,%rsi
+  80034a:	48 89 c7             	mov    %rax,%rdi
+  80034d:	48 b8 1e 5c 80 00 00 	movabs $0x805c1e,%rax
+  800354:	00 00 00 
+  800357:	ff d0                	call   *%rax
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+          (long)inuse / 1024, (long)mapped / 1024,
+          mapped ? (long)(inuse * 100 / mapped) : 0L);
+  800359:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+  80035d:	48 85 c0             	test   %rax,%rax
+  800360:	74 2e                	je     800390 <fragmentation+0x1dc>
+          mapped ? (long)(inuse * 100 / mapped) : 0L);
+  800362:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800366:	48 89 d0             	mov    %rdx,%rax
+  800369:	48 c1 e0 02          	shl    $0x2,%rax
+  80036d:	48 01 d0             	add    %rdx,%rax
+  800370:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  800377:	00 
+  800378:	48 01 d0             	add    %rdx,%rax
+  80037b:	48 c1 e0 02          	shl    $0x2,%rax
+  80037f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800383:	ba 00 00 00 00       	mov    $0x0,%edx
+  800388:	48 f7 f6             	div    %rsi
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+  80038b:	48 89 c1             	mov    %rax,%rcx
+  80038e:	eb 05                	jmp    800395 <fragmentation+0x1e1>
+  800390:	b9 00 00 00 00       	mov    $0x0,%ecx
+          (long)inuse / 1024, (long)mapped / 1024,
+  800395:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+  800399:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  8003a0:	48 85 c0             	test   %rax,%rax
+  8003a3:	48 0f 48 c2          	cmovs  %rdx,%rax
+  8003a7:	48 c1 f8 0a          	sar    $0xa,%rax
+  8003ab:	48 89 c6             	mov    %rax,%rsi
+          (long)inuse / 1024, (long)mapped / 1024,
+  8003ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+  8003b2:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  8003b9:	48 85 c0             	test   %rax,%rax
+  8003bc:	48 0f 48 c2          	cmovs  %rdx,%rax
+  8003c0:	48 c1 f8 0a          	sar    $0xa,%rax
+  8003c4:	48 89 f2             	mov    %rsi,%rdx
+  8003c7:	48 89 c6             	mov    %rax,%rsi
+  8003ca:	48 b8 a8 6a 80 00 00 	movabs $0x806aa8,%rax
+  8003d1:	00 00 00 
+  8003d4:	48 89 c7             	mov    %rax,%rdi
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	49 b8 19 08 80 00 00 	movabs $0x800819,%r8
+  8003e3:	00 00 00 
+  8003e6:	41 ff d0             	call   *%r8
+
+  for (i = 1; i < NOBJS; i += 2)
+  8003e9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  8003f0:	eb 26                	jmp    800418 <fragmentation+0x264>
+    free(objs[i]);
+  8003f2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8003f9:	00 00 00 
+  8003fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003ff:	48 98                	cltq
+  800401:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800405:	48 89 c7             	mov    %rax,%rdi
+  800408:	48 b8 e7 57 80 00 00 	movabs $0x8057e7,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+  for (i = 1; i < NOBJS; i += 2)
+  800414:	83 45 fc 02          	addl   $0x2,-0x4(%rbp)
+  800418:	81 7d fc ff 0f 00 00 	cmpl   $0xfff,-0x4(%rbp)
+  80041f:	7e d1                	jle    8003f2 <fragmentation+0x23e>
+  malloc_stats(&inuse, &mapped);
+  800421:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800425:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  800429:	48 89 d6             	mov    %rdx,%rsi
+  80042c:	48 89 c7             	mov    %rax,%rdi
+  80042f:	48 b8 1e 5c 80 00 00 	movabs $0x805c1e,%rax
+  800436:	00 00 00 
+  800439:	ff d0                	call   *%rax
+  cprintf("fragmentation: all freed: %ld KiB in use, %ld KiB mapped\n",
+          (long)inuse / 1024, (long)mapped / 1024);
+  80043b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  cprintf("fragmentation: all freed: %ld KiB in use, %ld KiB mapped\n",
+  80043f:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  800446:	48 85 c0             	test   %rax,%rax
+  800449:	48 0f 48 c2          	cmovs  %rdx,%rax
+  80044d:	48 c1 f8 0a          	sar    $0xa,%rax
+  800451:	48 89 c1             	mov    %rax,%rcx
+          (long)inuse / 1024, (long)mapped / 1024);
+  800454:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  cprintf("fragmentation: all freed: %ld KiB in use, %ld KiB mapped\n",
+  800458:	48 8d 90 ff 03 00 00 	lea    0x3ff(%rax),%rdx
+  80045f:	48 85 c0             	test   %rax,%rax
+  800462:	48 0f 48 c2          	cmovs  %rdx,%rax
+  800466:	48 c1 f8 0a          	sar    $0xa,%rax
+  80046a:	48 89 ca             	mov    %rcx,%rdx
+  80046d:	48 89 c6             	mov    %rax,%rsi
+  800470:	48 b8 f0 6a 80 00 00 	movabs $0x806af0,%rax
+  800477:	00 00 00 
+  80047a:	48 89 c7             	mov    %rax,%rdi
+  80047d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800482:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  800489:	00 00 00 
+  80048c:	ff d1                	call   *%rcx
+}
+  80048e:	90                   	nop
+  80048f:	c9                   	leave
+  800490:	c3                   	ret
+
+0000000000800491 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	48 83 ec 20          	sub    $0x20,%rsp
+  800499:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80049c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  static const size_t sizes[] = {16, 64, 256, 1024, 2048, 8192, 65536};
+  size_t i;
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+  8004a0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8004a7:	00 
+  8004a8:	e9 8c 00 00 00       	jmp    800539 <umain+0xa8>
+    cprintf("throughput: %6ld bytes: %6ld cycles per malloc+free\n",
+            (long)sizes[i], (long)throughput(sizes[i], 64, sizes[i] > 2048 ? 1024 : 65536));
+  8004ad:	48 ba 80 6b 80 00 00 	movabs $0x806b80,%rdx
+  8004b4:	00 00 00 
+  8004b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004bf:	48 3d 00 08 00 00    	cmp    $0x800,%rax
+  8004c5:	76 07                	jbe    8004ce <umain+0x3d>
+  8004c7:	b9 00 04 00 00       	mov    $0x400,%ecx
+  8004cc:	eb 05                	jmp    8004d3 <umain+0x42>
+  8004ce:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8004d3:	48 ba 80 6b 80 00 00 	movabs $0x806b80,%rdx
+  8004da:	00 00 00 
+  8004dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e5:	89 ca                	mov    %ecx,%edx
+  8004e7:	be 40 00 00 00       	mov    $0x40,%esi
+  8004ec:	48 89 c7             	mov    %rax,%rdi
+  8004ef:	48 b8 6b 00 80 00 00 	movabs $0x80006b,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+    cprintf("throughput: %6ld bytes: %6ld cycles per malloc+free\n",
+  8004fb:	48 89 c1             	mov    %rax,%rcx
+            (long)sizes[i], (long)throughput(sizes[i], 64, sizes[i] > 2048 ? 1024 : 65536));
+  8004fe:	48 ba 80 6b 80 00 00 	movabs $0x806b80,%rdx
+  800505:	00 00 00 
+  800508:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80050c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+    cprintf("throughput: %6ld bytes: %6ld cycles per malloc+free\n",
+  800510:	48 89 ca             	mov    %rcx,%rdx
+  800513:	48 89 c6             	mov    %rax,%rsi
+  800516:	48 b8 30 6b 80 00 00 	movabs $0x806b30,%rax
+  80051d:	00 00 00 
+  800520:	48 89 c7             	mov    %rax,%rdi
+  800523:	b8 00 00 00 00       	mov    $0x0,%eax
+  800528:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  80052f:	00 00 00 
+  800532:	ff d1                	call   *%rcx
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+  800534:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800539:	48 83 7d f8 06       	cmpq   $0x6,-0x8(%rbp)
+  80053e:	0f 86 69 ff ff ff    	jbe    8004ad <umain+0x1c>
+  }
+  fragmentation();
+  800544:	48 b8 b4 01 80 00 00 	movabs $0x8001b4,%rax
+  80054b:	00 00 00 
+  80054e:	ff d0                	call   *%rax
+}
+  800550:	90                   	nop
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+
+0000000000800553 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800553:	55                   	push   %rbp
+  800554:	48 89 e5             	mov    %rsp,%rbp
+  800557:	48 83 ec 20          	sub    $0x20,%rsp
+  80055b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80055e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800562:	48 b8 20 81 80 00 00 	movabs $0x808120,%rax
+  800569:	00 00 00 
+  80056c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800570:	eb 13                	jmp    800585 <libmain+0x32>
+    (*ctor)();
+  800572:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800576:	48 8b 10             	mov    (%rax),%rdx
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	ff d2                	call   *%rdx
+    ctor++;
+  800580:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800585:	48 b8 20 81 80 00 00 	movabs $0x808120,%rax
+  80058c:	00 00 00 
+  80058f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800593:	72 dd                	jb     800572 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800595:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800599:	7e 14                	jle    8005af <libmain+0x5c>
+    binaryname = argv[0];
+  80059b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80059f:	48 8b 00             	mov    (%rax),%rax
+  8005a2:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  8005a9:	00 00 00 
+  8005ac:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8005af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005b6:	48 89 d6             	mov    %rdx,%rsi
+  8005b9:	89 c7                	mov    %eax,%edi
+  8005bb:	48 b8 91 04 80 00 00 	movabs $0x800491,%rax
+  8005c2:	00 00 00 
+  8005c5:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8005c7:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  8005ce:	00 00 00 
+  8005d1:	ff d0                	call   *%rax
+#endif
+}
+  8005d3:	90                   	nop
+  8005d4:	c9                   	leave
+  8005d5:	c3                   	ret
+
+00000000008005d6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8005da:	48 b8 6e 30 80 00 00 	movabs $0x80306e,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8005e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005eb:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  8005f2:	00 00 00 
+  8005f5:	ff d0                	call   *%rax
+}
+  8005f7:	90                   	nop
+  8005f8:	5d                   	pop    %rbp
+  8005f9:	c3                   	ret
+
+00000000008005fa <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	53                   	push   %rbx
+  8005ff:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800606:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80060d:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800613:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80061a:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800621:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800628:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80062f:	84 c0                	test   %al,%al
+  800631:	74 23                	je     800656 <_panic+0x5c>
+  800633:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80063a:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80063e:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800642:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800646:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80064a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80064e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800652:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800656:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80065d:	00 00 00 
+  800660:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800667:	00 00 00 
+  80066a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80066e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800675:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80067c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800683:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80068a:	00 00 00 
+  80068d:	48 8b 18             	mov    (%rax),%rbx
+  800690:	48 b8 1e 25 80 00 00 	movabs $0x80251e,%rax
+  800697:	00 00 00 
+  80069a:	ff d0                	call   *%rax
+  80069c:	89 c6                	mov    %eax,%esi
+  80069e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8006a4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8006ab:	41 89 d0             	mov    %edx,%r8d
+  8006ae:	48 89 c1             	mov    %rax,%rcx
+  8006b1:	48 89 da             	mov    %rbx,%rdx
+  8006b4:	48 b8 c8 6b 80 00 00 	movabs $0x806bc8,%rax
+  8006bb:	00 00 00 
+  8006be:	48 89 c7             	mov    %rax,%rdi
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c6:	49 b9 19 08 80 00 00 	movabs $0x800819,%r9
+  8006cd:	00 00 00 
+  8006d0:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8006d3:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8006da:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006e1:	48 89 d6             	mov    %rdx,%rsi
+  8006e4:	48 89 c7             	mov    %rax,%rdi
+  8006e7:	48 b8 8e 07 80 00 00 	movabs $0x80078e,%rax
+  8006ee:	00 00 00 
+  8006f1:	ff d0                	call   *%rax
+  cprintf("\n");
+  8006f3:	48 b8 eb 6b 80 00 00 	movabs $0x806beb,%rax
+  8006fa:	00 00 00 
+  8006fd:	48 89 c7             	mov    %rax,%rdi
+  800700:	b8 00 00 00 00       	mov    $0x0,%eax
+  800705:	48 ba 19 08 80 00 00 	movabs $0x800819,%rdx
+  80070c:	00 00 00 
+  80070f:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800711:	cc                   	int3
+  800712:	eb fd                	jmp    800711 <_panic+0x117>
+
+0000000000800714 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800714:	55                   	push   %rbp
+  800715:	48 89 e5             	mov    %rsp,%rbp
+  800718:	48 83 ec 10          	sub    $0x10,%rsp
+  80071c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80071f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800723:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800727:	8b 00                	mov    (%rax),%eax
+  800729:	8d 48 01             	lea    0x1(%rax),%ecx
+  80072c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800730:	89 0a                	mov    %ecx,(%rdx)
+  800732:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800735:	89 d1                	mov    %edx,%ecx
+  800737:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80073b:	48 98                	cltq
+  80073d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800745:	8b 00                	mov    (%rax),%eax
+  800747:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80074c:	75 2c                	jne    80077a <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80074e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800752:	8b 00                	mov    (%rax),%eax
+  800754:	48 98                	cltq
+  800756:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80075a:	48 83 c2 08          	add    $0x8,%rdx
+  80075e:	48 89 c6             	mov    %rax,%rsi
+  800761:	48 89 d7             	mov    %rdx,%rdi
+  800764:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  80076b:	00 00 00 
+  80076e:	ff d0                	call   *%rax
+    b->idx = 0;
+  800770:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800774:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80077a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80077e:	8b 40 04             	mov    0x4(%rax),%eax
+  800781:	8d 50 01             	lea    0x1(%rax),%edx
+  800784:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800788:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80078b:	90                   	nop
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+000000000080078e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80078e:	55                   	push   %rbp
+  80078f:	48 89 e5             	mov    %rsp,%rbp
+  800792:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800799:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8007a0:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8007a7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8007ae:	00 00 00 
+  b.cnt = 0;
+  8007b1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8007b8:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8007bb:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8007c2:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8007c9:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8007d0:	48 89 c6             	mov    %rax,%rsi
+  8007d3:	48 b8 14 07 80 00 00 	movabs $0x800714,%rax
+  8007da:	00 00 00 
+  8007dd:	48 89 c7             	mov    %rax,%rdi
+  8007e0:	48 b8 73 0b 80 00 00 	movabs $0x800b73,%rax
+  8007e7:	00 00 00 
+  8007ea:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8007ec:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8007f2:	48 98                	cltq
+  8007f4:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8007fb:	48 83 c2 08          	add    $0x8,%rdx
+  8007ff:	48 89 c6             	mov    %rax,%rsi
+  800802:	48 89 d7             	mov    %rdx,%rdi
+  800805:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  80080c:	00 00 00 
+  80080f:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800811:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800817:	c9                   	leave
+  800818:	c3                   	ret
+
+0000000000800819 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800819:	55                   	push   %rbp
+  80081a:	48 89 e5             	mov    %rsp,%rbp
+  80081d:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800824:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80082b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800832:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800839:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800840:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800847:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80084e:	84 c0                	test   %al,%al
+  800850:	74 20                	je     800872 <cprintf+0x59>
+  800852:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800856:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80085a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80085e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800862:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800866:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80086a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80086e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800872:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800879:	00 00 00 
+  80087c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800883:	00 00 00 
+  800886:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80088a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800891:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800898:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80089f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8008a6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8008ad:	48 89 d6             	mov    %rdx,%rsi
+  8008b0:	48 89 c7             	mov    %rax,%rdi
+  8008b3:	48 b8 8e 07 80 00 00 	movabs $0x80078e,%rax
+  8008ba:	00 00 00 
+  8008bd:	ff d0                	call   *%rax
+  8008bf:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8008c5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+
+00000000008008cd <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8008cd:	55                   	push   %rbp
+  8008ce:	48 89 e5             	mov    %rsp,%rbp
+  8008d1:	48 83 ec 30          	sub    $0x30,%rsp
+  8008d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008e1:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8008e4:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8008e8:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8008ec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008ef:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8008f3:	72 54                	jb     800949 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008f5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8008f8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008fb:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8008fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800902:	ba 00 00 00 00       	mov    $0x0,%edx
+  800907:	48 f7 f6             	div    %rsi
+  80090a:	49 89 c2             	mov    %rax,%r10
+  80090d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800910:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800913:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800917:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80091b:	41 89 c9             	mov    %ecx,%r9d
+  80091e:	41 89 f8             	mov    %edi,%r8d
+  800921:	89 d1                	mov    %edx,%ecx
+  800923:	4c 89 d2             	mov    %r10,%rdx
+  800926:	48 89 c7             	mov    %rax,%rdi
+  800929:	48 b8 cd 08 80 00 00 	movabs $0x8008cd,%rax
+  800930:	00 00 00 
+  800933:	ff d0                	call   *%rax
+  800935:	eb 1c                	jmp    800953 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800937:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80093b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80093e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800942:	48 89 d6             	mov    %rdx,%rsi
+  800945:	89 c7                	mov    %eax,%edi
+  800947:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800949:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80094d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800951:	7f e4                	jg     800937 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800953:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095f:	48 f7 f1             	div    %rcx
+  800962:	48 b8 30 6e 80 00 00 	movabs $0x806e30,%rax
+  800969:	00 00 00 
+  80096c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800970:	0f be c0             	movsbl %al,%eax
+  800973:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800977:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80097b:	48 89 d6             	mov    %rdx,%rsi
+  80097e:	89 c7                	mov    %eax,%edi
+  800980:	ff d1                	call   *%rcx
+}
+  800982:	90                   	nop
+  800983:	c9                   	leave
+  800984:	c3                   	ret
+
+0000000000800985 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800985:	55                   	push   %rbp
+  800986:	48 89 e5             	mov    %rsp,%rbp
+  800989:	48 83 ec 10          	sub    $0x10,%rsp
+  80098d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800991:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800994:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800998:	7e 4b                	jle    8009e5 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80099a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80099e:	8b 00                	mov    (%rax),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 24                	ja     8009c9 <getuint+0x44>
+  8009a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b1:	8b 00                	mov    (%rax),%eax
+  8009b3:	89 c0                	mov    %eax,%eax
+  8009b5:	48 01 d0             	add    %rdx,%rax
+  8009b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009bc:	8b 12                	mov    (%rdx),%edx
+  8009be:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c5:	89 0a                	mov    %ecx,(%rdx)
+  8009c7:	eb 14                	jmp    8009dd <getuint+0x58>
+  8009c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009d9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009dd:	48 8b 00             	mov    (%rax),%rax
+  8009e0:	e9 95 00 00 00       	jmp    800a7a <getuint+0xf5>
+  else if (lflag)
+  8009e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009e9:	74 48                	je     800a33 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8009eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ef:	8b 00                	mov    (%rax),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 24                	ja     800a1a <getuint+0x95>
+  8009f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009fa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a02:	8b 00                	mov    (%rax),%eax
+  800a04:	89 c0                	mov    %eax,%eax
+  800a06:	48 01 d0             	add    %rdx,%rax
+  800a09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a0d:	8b 12                	mov    (%rdx),%edx
+  800a0f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a16:	89 0a                	mov    %ecx,(%rdx)
+  800a18:	eb 14                	jmp    800a2e <getuint+0xa9>
+  800a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a22:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a2a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a2e:	48 8b 00             	mov    (%rax),%rax
+  800a31:	eb 47                	jmp    800a7a <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a37:	8b 00                	mov    (%rax),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 24                	ja     800a62 <getuint+0xdd>
+  800a3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a42:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a4a:	8b 00                	mov    (%rax),%eax
+  800a4c:	89 c0                	mov    %eax,%eax
+  800a4e:	48 01 d0             	add    %rdx,%rax
+  800a51:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a55:	8b 12                	mov    (%rdx),%edx
+  800a57:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a5e:	89 0a                	mov    %ecx,(%rdx)
+  800a60:	eb 14                	jmp    800a76 <getuint+0xf1>
+  800a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a72:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a76:	8b 00                	mov    (%rax),%eax
+  800a78:	89 c0                	mov    %eax,%eax
+}
+  800a7a:	c9                   	leave
+  800a7b:	c3                   	ret
+
+0000000000800a7c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800a7c:	55                   	push   %rbp
+  800a7d:	48 89 e5             	mov    %rsp,%rbp
+  800a80:	48 83 ec 10          	sub    $0x10,%rsp
+  800a84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a88:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800a8b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800a8f:	7e 4b                	jle    800adc <getint+0x60>
+    return va_arg(*ap, long long);
+  800a91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a95:	8b 00                	mov    (%rax),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 24                	ja     800ac0 <getint+0x44>
+  800a9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aa4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa8:	8b 00                	mov    (%rax),%eax
+  800aaa:	89 c0                	mov    %eax,%eax
+  800aac:	48 01 d0             	add    %rdx,%rax
+  800aaf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ab3:	8b 12                	mov    (%rdx),%edx
+  800ab5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ab8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800abc:	89 0a                	mov    %ecx,(%rdx)
+  800abe:	eb 14                	jmp    800ad4 <getint+0x58>
+  800ac0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ac8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800acc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ad0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ad4:	48 8b 00             	mov    (%rax),%rax
+  800ad7:	e9 95 00 00 00       	jmp    800b71 <getint+0xf5>
+  else if (lflag)
+  800adc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800ae0:	74 48                	je     800b2a <getint+0xae>
+    return va_arg(*ap, long);
+  800ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ae6:	8b 00                	mov    (%rax),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	77 24                	ja     800b11 <getint+0x95>
+  800aed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af9:	8b 00                	mov    (%rax),%eax
+  800afb:	89 c0                	mov    %eax,%eax
+  800afd:	48 01 d0             	add    %rdx,%rax
+  800b00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b04:	8b 12                	mov    (%rdx),%edx
+  800b06:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b0d:	89 0a                	mov    %ecx,(%rdx)
+  800b0f:	eb 14                	jmp    800b25 <getint+0xa9>
+  800b11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b15:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b19:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b21:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b25:	48 8b 00             	mov    (%rax),%rax
+  800b28:	eb 47                	jmp    800b71 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800b2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b2e:	8b 00                	mov    (%rax),%eax
+  800b30:	83 f8 2f             	cmp    $0x2f,%eax
+  800b33:	77 24                	ja     800b59 <getint+0xdd>
+  800b35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b39:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b41:	8b 00                	mov    (%rax),%eax
+  800b43:	89 c0                	mov    %eax,%eax
+  800b45:	48 01 d0             	add    %rdx,%rax
+  800b48:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b4c:	8b 12                	mov    (%rdx),%edx
+  800b4e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b51:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b55:	89 0a                	mov    %ecx,(%rdx)
+  800b57:	eb 14                	jmp    800b6d <getint+0xf1>
+  800b59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b61:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b65:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b69:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b6d:	8b 00                	mov    (%rax),%eax
+  800b6f:	48 98                	cltq
+}
+  800b71:	c9                   	leave
+  800b72:	c3                   	ret
+
+0000000000800b73 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800b73:	55                   	push   %rbp
+  800b74:	48 89 e5             	mov    %rsp,%rbp
+  800b77:	41 54                	push   %r12
+  800b79:	53                   	push   %rbx
+  800b7a:	48 83 ec 60          	sub    $0x60,%rsp
+  800b7e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800b82:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800b86:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800b8a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800b8e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b92:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b96:	48 8b 06             	mov    (%rsi),%rax
+  800b99:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b9d:	48 89 01             	mov    %rax,(%rcx)
+  800ba0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ba4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ba8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bac:	eb 17                	jmp    800bc5 <vprintfmt+0x52>
+      if (ch == '\0')
+  800bae:	85 db                	test   %ebx,%ebx
+  800bb0:	0f 84 bf 04 00 00    	je     801075 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800bb6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bba:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bbe:	48 89 c6             	mov    %rax,%rsi
+  800bc1:	89 df                	mov    %ebx,%edi
+  800bc3:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bc5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bc9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bcd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800bd1:	0f b6 00             	movzbl (%rax),%eax
+  800bd4:	0f b6 d8             	movzbl %al,%ebx
+  800bd7:	83 fb 25             	cmp    $0x25,%ebx
+  800bda:	75 d2                	jne    800bae <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800bdc:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800be0:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800be7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800bee:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800bf5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800bfc:	eb 04                	jmp    800c02 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800bfe:	90                   	nop
+  800bff:	eb 01                	jmp    800c02 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800c01:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800c02:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c06:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c0a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c0e:	0f b6 00             	movzbl (%rax),%eax
+  800c11:	0f b6 d8             	movzbl %al,%ebx
+  800c14:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c17:	83 f8 55             	cmp    $0x55,%eax
+  800c1a:	0f 87 22 04 00 00    	ja     801042 <vprintfmt+0x4cf>
+  800c20:	89 c0                	mov    %eax,%eax
+  800c22:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c29:	00 
+  800c2a:	48 b8 58 6e 80 00 00 	movabs $0x806e58,%rax
+  800c31:	00 00 00 
+  800c34:	48 01 d0             	add    %rdx,%rax
+  800c37:	48 8b 00             	mov    (%rax),%rax
+  800c3a:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c3c:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c40:	eb c0                	jmp    800c02 <vprintfmt+0x8f>
+        padc = '0';
+  800c42:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800c46:	eb ba                	jmp    800c02 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800c48:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c4f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800c52:	89 d0                	mov    %edx,%eax
+  800c54:	c1 e0 02             	shl    $0x2,%eax
+  800c57:	01 d0                	add    %edx,%eax
+  800c59:	01 c0                	add    %eax,%eax
+  800c5b:	01 d8                	add    %ebx,%eax
+  800c5d:	83 e8 30             	sub    $0x30,%eax
+  800c60:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800c63:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c67:	0f b6 00             	movzbl (%rax),%eax
+  800c6a:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800c6d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c70:	7e 60                	jle    800cd2 <vprintfmt+0x15f>
+  800c72:	83 fb 39             	cmp    $0x39,%ebx
+  800c75:	7f 5b                	jg     800cd2 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800c77:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c7c:	eb d1                	jmp    800c4f <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800c7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c81:	83 f8 2f             	cmp    $0x2f,%eax
+  800c84:	77 17                	ja     800c9d <vprintfmt+0x12a>
+  800c86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c8a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c8d:	89 d2                	mov    %edx,%edx
+  800c8f:	48 01 d0             	add    %rdx,%rax
+  800c92:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c95:	83 c2 08             	add    $0x8,%edx
+  800c98:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c9b:	eb 0c                	jmp    800ca9 <vprintfmt+0x136>
+  800c9d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ca1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ca5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ca9:	8b 00                	mov    (%rax),%eax
+  800cab:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800cae:	eb 23                	jmp    800cd3 <vprintfmt+0x160>
+        if (width < 0)
+  800cb0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cb4:	0f 89 44 ff ff ff    	jns    800bfe <vprintfmt+0x8b>
+          width = 0;
+  800cba:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800cc1:	e9 38 ff ff ff       	jmp    800bfe <vprintfmt+0x8b>
+        altflag = 1;
+  800cc6:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800ccd:	e9 30 ff ff ff       	jmp    800c02 <vprintfmt+0x8f>
+        goto process_precision;
+  800cd2:	90                   	nop
+        if (width < 0)
+  800cd3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cd7:	0f 89 24 ff ff ff    	jns    800c01 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800cdd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ce0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ce3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800cea:	e9 12 ff ff ff       	jmp    800c01 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800cef:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800cf3:	e9 0a ff ff ff       	jmp    800c02 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800cf8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfe:	77 17                	ja     800d17 <vprintfmt+0x1a4>
+  800d00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d04:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d07:	89 d2                	mov    %edx,%edx
+  800d09:	48 01 d0             	add    %rdx,%rax
+  800d0c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d0f:	83 c2 08             	add    $0x8,%edx
+  800d12:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d15:	eb 0c                	jmp    800d23 <vprintfmt+0x1b0>
+  800d17:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d1b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d1f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d23:	8b 00                	mov    (%rax),%eax
+  800d25:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d29:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d2d:	48 89 d6             	mov    %rdx,%rsi
+  800d30:	89 c7                	mov    %eax,%edi
+  800d32:	ff d1                	call   *%rcx
+        break;
+  800d34:	e9 37 03 00 00       	jmp    801070 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3f:	77 17                	ja     800d58 <vprintfmt+0x1e5>
+  800d41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d45:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d48:	89 d2                	mov    %edx,%edx
+  800d4a:	48 01 d0             	add    %rdx,%rax
+  800d4d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d50:	83 c2 08             	add    $0x8,%edx
+  800d53:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d56:	eb 0c                	jmp    800d64 <vprintfmt+0x1f1>
+  800d58:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d5c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d60:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d64:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800d66:	85 db                	test   %ebx,%ebx
+  800d68:	79 02                	jns    800d6c <vprintfmt+0x1f9>
+          err = -err;
+  800d6a:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d6c:	83 fb 15             	cmp    $0x15,%ebx
+  800d6f:	7f 16                	jg     800d87 <vprintfmt+0x214>
+  800d71:	48 ba 80 6d 80 00 00 	movabs $0x806d80,%rdx
+  800d78:	00 00 00 
+  800d7b:	48 63 c3             	movslq %ebx,%rax
+  800d7e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800d82:	4d 85 e4             	test   %r12,%r12
+  800d85:	75 2e                	jne    800db5 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800d87:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d8b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d8f:	89 d9                	mov    %ebx,%ecx
+  800d91:	48 ba 41 6e 80 00 00 	movabs $0x806e41,%rdx
+  800d98:	00 00 00 
+  800d9b:	48 89 c7             	mov    %rax,%rdi
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da3:	49 b8 7f 10 80 00 00 	movabs $0x80107f,%r8
+  800daa:	00 00 00 
+  800dad:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800db0:	e9 bb 02 00 00       	jmp    801070 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800db5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800db9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dbd:	4c 89 e1             	mov    %r12,%rcx
+  800dc0:	48 ba 4a 6e 80 00 00 	movabs $0x806e4a,%rdx
+  800dc7:	00 00 00 
+  800dca:	48 89 c7             	mov    %rax,%rdi
+  800dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd2:	49 b8 7f 10 80 00 00 	movabs $0x80107f,%r8
+  800dd9:	00 00 00 
+  800ddc:	41 ff d0             	call   *%r8
+        break;
+  800ddf:	e9 8c 02 00 00       	jmp    801070 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800de4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de7:	83 f8 2f             	cmp    $0x2f,%eax
+  800dea:	77 17                	ja     800e03 <vprintfmt+0x290>
+  800dec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800df0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800df3:	89 d2                	mov    %edx,%edx
+  800df5:	48 01 d0             	add    %rdx,%rax
+  800df8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dfb:	83 c2 08             	add    $0x8,%edx
+  800dfe:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e01:	eb 0c                	jmp    800e0f <vprintfmt+0x29c>
+  800e03:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e07:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e0b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e0f:	4c 8b 20             	mov    (%rax),%r12
+  800e12:	4d 85 e4             	test   %r12,%r12
+  800e15:	75 0a                	jne    800e21 <vprintfmt+0x2ae>
+          p = "(null)";
+  800e17:	49 bc 4d 6e 80 00 00 	movabs $0x806e4d,%r12
+  800e1e:	00 00 00 
+        if (width > 0 && padc != '-')
+  800e21:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e25:	7e 78                	jle    800e9f <vprintfmt+0x32c>
+  800e27:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800e2b:	74 72                	je     800e9f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e2d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e30:	48 98                	cltq
+  800e32:	48 89 c6             	mov    %rax,%rsi
+  800e35:	4c 89 e7             	mov    %r12,%rdi
+  800e38:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+  800e44:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800e47:	eb 17                	jmp    800e60 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800e49:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800e4d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800e51:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800e55:	48 89 d6             	mov    %rdx,%rsi
+  800e58:	89 c7                	mov    %eax,%edi
+  800e5a:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e5c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e64:	7f e3                	jg     800e49 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e66:	eb 37                	jmp    800e9f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800e68:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e6c:	74 1e                	je     800e8c <vprintfmt+0x319>
+  800e6e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e71:	7e 05                	jle    800e78 <vprintfmt+0x305>
+  800e73:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e76:	7e 14                	jle    800e8c <vprintfmt+0x319>
+            putch('?', putdat);
+  800e78:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e7c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e80:	48 89 c6             	mov    %rax,%rsi
+  800e83:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e88:	ff d2                	call   *%rdx
+  800e8a:	eb 0f                	jmp    800e9b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800e8c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e90:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e94:	48 89 c6             	mov    %rax,%rsi
+  800e97:	89 df                	mov    %ebx,%edi
+  800e99:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e9b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e9f:	4c 89 e0             	mov    %r12,%rax
+  800ea2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800ea6:	0f b6 00             	movzbl (%rax),%eax
+  800ea9:	0f be d8             	movsbl %al,%ebx
+  800eac:	85 db                	test   %ebx,%ebx
+  800eae:	74 28                	je     800ed8 <vprintfmt+0x365>
+  800eb0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800eb4:	78 b2                	js     800e68 <vprintfmt+0x2f5>
+  800eb6:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800eba:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ebe:	79 a8                	jns    800e68 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800ec0:	eb 16                	jmp    800ed8 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800ec2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ec6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800eca:	48 89 c6             	mov    %rax,%rsi
+  800ecd:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ed2:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ed4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ed8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800edc:	7f e4                	jg     800ec2 <vprintfmt+0x34f>
+        break;
+  800ede:	e9 8d 01 00 00       	jmp    801070 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800ee3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ee6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800eea:	89 d6                	mov    %edx,%esi
+  800eec:	48 89 c7             	mov    %rax,%rdi
+  800eef:	48 b8 7c 0a 80 00 00 	movabs $0x800a7c,%rax
+  800ef6:	00 00 00 
+  800ef9:	ff d0                	call   *%rax
+  800efb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800eff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f03:	48 85 c0             	test   %rax,%rax
+  800f06:	79 1d                	jns    800f25 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800f08:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f0c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f10:	48 89 c6             	mov    %rax,%rsi
+  800f13:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f18:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800f1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f1e:	48 f7 d8             	neg    %rax
+  800f21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800f25:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f2c:	e9 d2 00 00 00       	jmp    801003 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f31:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f34:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f38:	89 d6                	mov    %edx,%esi
+  800f3a:	48 89 c7             	mov    %rax,%rdi
+  800f3d:	48 b8 85 09 80 00 00 	movabs $0x800985,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+  800f49:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800f4d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f54:	e9 aa 00 00 00       	jmp    801003 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800f59:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f5c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f60:	89 d6                	mov    %edx,%esi
+  800f62:	48 89 c7             	mov    %rax,%rdi
+  800f65:	48 b8 85 09 80 00 00 	movabs $0x800985,%rax
+  800f6c:	00 00 00 
+  800f6f:	ff d0                	call   *%rax
+  800f71:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800f75:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800f7c:	e9 82 00 00 00       	jmp    801003 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800f81:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f85:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f89:	48 89 c6             	mov    %rax,%rsi
+  800f8c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f91:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800f93:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f97:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f9b:	48 89 c6             	mov    %rax,%rsi
+  800f9e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800fa3:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800fa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800fab:	77 17                	ja     800fc4 <vprintfmt+0x451>
+  800fad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fb1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800fb4:	89 d2                	mov    %edx,%edx
+  800fb6:	48 01 d0             	add    %rdx,%rax
+  800fb9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800fbc:	83 c2 08             	add    $0x8,%edx
+  800fbf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800fc2:	eb 0c                	jmp    800fd0 <vprintfmt+0x45d>
+  800fc4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fc8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fcc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800fd0:	48 8b 00             	mov    (%rax),%rax
+  800fd3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fd7:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800fde:	eb 23                	jmp    801003 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800fe0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fe3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800fe7:	89 d6                	mov    %edx,%esi
+  800fe9:	48 89 c7             	mov    %rax,%rdi
+  800fec:	48 b8 85 09 80 00 00 	movabs $0x800985,%rax
+  800ff3:	00 00 00 
+  800ff6:	ff d0                	call   *%rax
+  800ff8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ffc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  801003:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801008:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80100b:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80100e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801012:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801016:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80101a:	45 89 c1             	mov    %r8d,%r9d
+  80101d:	41 89 f8             	mov    %edi,%r8d
+  801020:	48 89 c7             	mov    %rax,%rdi
+  801023:	48 b8 cd 08 80 00 00 	movabs $0x8008cd,%rax
+  80102a:	00 00 00 
+  80102d:	ff d0                	call   *%rax
+        break;
+  80102f:	eb 3f                	jmp    801070 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801031:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801035:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801039:	48 89 c6             	mov    %rax,%rsi
+  80103c:	89 df                	mov    %ebx,%edi
+  80103e:	ff d2                	call   *%rdx
+        break;
+  801040:	eb 2e                	jmp    801070 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801042:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801046:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80104a:	48 89 c6             	mov    %rax,%rsi
+  80104d:	bf 25 00 00 00       	mov    $0x25,%edi
+  801052:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801054:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801059:	eb 05                	jmp    801060 <vprintfmt+0x4ed>
+  80105b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801060:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801064:	48 83 e8 01          	sub    $0x1,%rax
+  801068:	0f b6 00             	movzbl (%rax),%eax
+  80106b:	3c 25                	cmp    $0x25,%al
+  80106d:	75 ec                	jne    80105b <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  80106f:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801070:	e9 50 fb ff ff       	jmp    800bc5 <vprintfmt+0x52>
+        return;
+  801075:	90                   	nop
+    }
+  }
+}
+  801076:	48 83 c4 60          	add    $0x60,%rsp
+  80107a:	5b                   	pop    %rbx
+  80107b:	41 5c                	pop    %r12
+  80107d:	5d                   	pop    %rbp
+  80107e:	c3                   	ret
+
+000000000080107f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80107f:	55                   	push   %rbp
+  801080:	48 89 e5             	mov    %rsp,%rbp
+  801083:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80108a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801091:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801098:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80109f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010a6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010ad:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010b4:	84 c0                	test   %al,%al
+  8010b6:	74 20                	je     8010d8 <printfmt+0x59>
+  8010b8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010bc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010c0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010c4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010c8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010cc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010d0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010d4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8010d8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010df:	00 00 00 
+  8010e2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010e9:	00 00 00 
+  8010ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010f0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010f7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010fe:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801105:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80110c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801113:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80111a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801121:	48 89 c7             	mov    %rax,%rdi
+  801124:	48 b8 73 0b 80 00 00 	movabs $0x800b73,%rax
+  80112b:	00 00 00 
+  80112e:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801130:	90                   	nop
+  801131:	c9                   	leave
+  801132:	c3                   	ret
+
+0000000000801133 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	48 83 ec 10          	sub    $0x10,%rsp
+  80113b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80113e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801142:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801146:	8b 40 10             	mov    0x10(%rax),%eax
+  801149:	8d 50 01             	lea    0x1(%rax),%edx
+  80114c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801150:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801153:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801157:	48 8b 10             	mov    (%rax),%rdx
+  80115a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80115e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801162:	48 39 c2             	cmp    %rax,%rdx
+  801165:	73 17                	jae    80117e <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116b:	48 8b 00             	mov    (%rax),%rax
+  80116e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801172:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801176:	48 89 0a             	mov    %rcx,(%rdx)
+  801179:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80117c:	88 10                	mov    %dl,(%rax)
+}
+  80117e:	90                   	nop
+  80117f:	c9                   	leave
+  801180:	c3                   	ret
+
+0000000000801181 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801181:	55                   	push   %rbp
+  801182:	48 89 e5             	mov    %rsp,%rbp
+  801185:	48 83 ec 40          	sub    $0x40,%rsp
+  801189:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80118d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801190:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801194:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801198:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80119c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011a0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8011a3:	48 98                	cltq
+  8011a5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8011a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011ad:	48 01 d0             	add    %rdx,%rax
+  8011b0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8011b4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8011bb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011c0:	74 06                	je     8011c8 <vsnprintf+0x47>
+  8011c2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8011c6:	7f 07                	jg     8011cf <vsnprintf+0x4e>
+    return -E_INVAL;
+  8011c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cd:	eb 32                	jmp    801201 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8011cf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8011d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8011d7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8011db:	48 89 c6             	mov    %rax,%rsi
+  8011de:	48 b8 33 11 80 00 00 	movabs $0x801133,%rax
+  8011e5:	00 00 00 
+  8011e8:	48 89 c7             	mov    %rax,%rdi
+  8011eb:	48 b8 73 0b 80 00 00 	movabs $0x800b73,%rax
+  8011f2:	00 00 00 
+  8011f5:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8011f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011fb:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8011fe:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801201:	c9                   	leave
+  801202:	c3                   	ret
+
+0000000000801203 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801203:	55                   	push   %rbp
+  801204:	48 89 e5             	mov    %rsp,%rbp
+  801207:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80120e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801215:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80121b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801222:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801229:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801230:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801237:	84 c0                	test   %al,%al
+  801239:	74 20                	je     80125b <snprintf+0x58>
+  80123b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80123f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801243:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801247:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80124b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80124f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801253:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801257:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80125b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801262:	00 00 00 
+  801265:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80126c:	00 00 00 
+  80126f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801273:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80127a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801281:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801288:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  80128f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801296:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80129c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8012a3:	48 89 c7             	mov    %rax,%rdi
+  8012a6:	48 b8 81 11 80 00 00 	movabs $0x801181,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+  8012b2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8012b8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+
+00000000008012c0 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+  8012c4:	53                   	push   %rbx
+  8012c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8012c9:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8012cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8012d0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8012d4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8012d8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8012dc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e4:	89 d1                	mov    %edx,%ecx
+  8012e6:	0f a2                	cpuid
+  8012e8:	89 de                	mov    %ebx,%esi
+  8012ea:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8012ed:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8012f0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8012f3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8012f6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012fb:	74 09                	je     801306 <cpuid+0x46>
+}
+  8012fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801301:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801304:	89 10                	mov    %edx,(%rax)
+
+  801306:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80130b:	74 09                	je     801316 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80130d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801311:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801314:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801316:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80131b:	74 09                	je     801326 <cpuid+0x66>
+char *
+  80131d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801321:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801324:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801326:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80132b:	74 09                	je     801336 <cpuid+0x76>
+  for (; *s; s++)
+  80132d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801331:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801334:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801336:	90                   	nop
+  801337:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133b:	c9                   	leave
+  80133c:	c3                   	ret
+
+000000000080133d <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80133d:	55                   	push   %rbp
+  80133e:	48 89 e5             	mov    %rsp,%rbp
+  801341:	48 83 ec 18          	sub    $0x18,%rsp
+  801345:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801348:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80134b:	89 c1                	mov    %eax,%ecx
+  80134d:	0f 01 d0             	xgetbv
+  801350:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801353:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801356:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801359:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80135c:	48 c1 e2 20          	shl    $0x20,%rdx
+  801360:	48 09 d0             	or     %rdx,%rax
+#else
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+
+0000000000801365 <string_cpu>:
+string_cpu(void) {
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80136d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801374:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80137b:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801382:	00 00 00 
+  801385:	8b 00                	mov    (%rax),%eax
+  801387:	85 c0                	test   %eax,%eax
+  801389:	78 11                	js     80139c <string_cpu+0x37>
+    return string_features;
+  80138b:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801392:	00 00 00 
+  801395:	8b 00                	mov    (%rax),%eax
+  801397:	e9 df 00 00 00       	jmp    80147b <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80139c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8013a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b0:	48 89 c6             	mov    %rax,%rsi
+  8013b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b8:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8013bf:	00 00 00 
+  8013c2:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8013c4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013c7:	83 f8 06             	cmp    $0x6,%eax
+  8013ca:	76 28                	jbe    8013f4 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8013cc:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013db:	48 89 c2             	mov    %rax,%rdx
+  8013de:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8013e8:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8013ef:	00 00 00 
+  8013f2:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8013f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013f7:	25 00 02 00 00       	and    $0x200,%eax
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	74 04                	je     801404 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801400:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801404:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80140e:	48 89 c1             	mov    %rax,%rcx
+  801411:	ba 00 00 00 00       	mov    $0x0,%edx
+  801416:	be 00 00 00 00       	mov    $0x0,%esi
+  80141b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801420:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  801427:	00 00 00 
+  80142a:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80142c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80142f:	83 e0 20             	and    $0x20,%eax
+  801432:	85 c0                	test   %eax,%eax
+  801434:	74 2a                	je     801460 <string_cpu+0xfb>
+  801436:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801439:	25 00 00 00 08       	and    $0x8000000,%eax
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	74 1e                	je     801460 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801442:	bf 00 00 00 00       	mov    $0x0,%edi
+  801447:	48 b8 3d 13 80 00 00 	movabs $0x80133d,%rax
+  80144e:	00 00 00 
+  801451:	ff d0                	call   *%rax
+  801453:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801456:	48 83 f8 06          	cmp    $0x6,%rax
+  80145a:	75 04                	jne    801460 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80145c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801460:	48 ba 10 80 80 00 00 	movabs $0x808010,%rdx
+  801467:	00 00 00 
+  80146a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80146d:	89 02                	mov    %eax,(%rdx)
+  80146f:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  801476:	00 00 00 
+  801479:	8b 00                	mov    (%rax),%eax
+}
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+
+000000000080147d <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801485:	48 83 ec 60          	sub    $0x60,%rsp
+  801489:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80148e:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801493:	83 e0 1f             	and    $0x1f,%eax
+  801496:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80149a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80149e:	48 f7 d8             	neg    %rax
+  8014a1:	48 89 c2             	mov    %rax,%rdx
+  8014a4:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8014a9:	48 01 d0             	add    %rdx,%rax
+  8014ac:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8014b1:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8014b5:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8014bb:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014c0:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014c4:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8014ca:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014ce:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014d2:	89 c2                	mov    %eax,%edx
+  8014d4:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014d8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014dd:	89 c1                	mov    %eax,%ecx
+  8014df:	d3 e6                	shl    %cl,%esi
+  8014e1:	89 f0                	mov    %esi,%eax
+  8014e3:	21 d0                	and    %edx,%eax
+  8014e5:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014e9:	eb 21                	jmp    80150c <strlen_avx2+0x8f>
+    p += 32;
+  8014eb:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8014f1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014f6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014fa:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801500:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801504:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801508:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80150c:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801511:	74 d8                	je     8014eb <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801513:	31 c0                	xor    %eax,%eax
+  801515:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80151b:	48 63 d0             	movslq %eax,%rdx
+  80151e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801523:	48 01 d0             	add    %rdx,%rax
+  801526:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+000000000080152d <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801535:	48 83 ec 40          	sub    $0x40,%rsp
+  801539:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80153e:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801543:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801548:	eb 77                	jmp    8015c1 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80154a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80154f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801553:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801557:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80155c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801560:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801564:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801568:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80156c:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801571:	74 3c                	je     8015af <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801573:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801577:	f7 d0                	not    %eax
+  801579:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80157d:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801581:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801585:	48 63 d0             	movslq %eax,%rdx
+  801588:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80158d:	48 01 d0             	add    %rdx,%rax
+  801590:	0f b6 00             	movzbl (%rax),%eax
+  801593:	0f b6 c0             	movzbl %al,%eax
+  801596:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80159a:	48 63 ca             	movslq %edx,%rcx
+  80159d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8015a2:	48 01 ca             	add    %rcx,%rdx
+  8015a5:	0f b6 12             	movzbl (%rdx),%edx
+  8015a8:	0f b6 d2             	movzbl %dl,%edx
+  8015ab:	29 d0                	sub    %edx,%eax
+  8015ad:	eb 6b                	jmp    80161a <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8015af:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8015b5:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8015bb:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8015c1:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8015c7:	77 81                	ja     80154a <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8015c9:	eb 42                	jmp    80160d <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8015cb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015d0:	0f b6 10             	movzbl (%rax),%edx
+  8015d3:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015d8:	0f b6 00             	movzbl (%rax),%eax
+  8015db:	38 c2                	cmp    %al,%dl
+  8015dd:	74 1c                	je     8015fb <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8015df:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015e4:	0f b6 00             	movzbl (%rax),%eax
+  8015e7:	0f b6 c8             	movzbl %al,%ecx
+  8015ea:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015ef:	0f b6 00             	movzbl (%rax),%eax
+  8015f2:	0f b6 d0             	movzbl %al,%edx
+  8015f5:	89 c8                	mov    %ecx,%eax
+  8015f7:	29 d0                	sub    %edx,%eax
+  8015f9:	eb 1f                	jmp    80161a <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8015fb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801601:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801607:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80160d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801613:	75 b6                	jne    8015cb <memcmp_avx2+0x9e>
+  return 0;
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+
+000000000080161c <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80161c:	55                   	push   %rbp
+  80161d:	48 89 e5             	mov    %rsp,%rbp
+  801620:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801624:	48 83 ec 60          	sub    $0x60,%rsp
+  801628:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80162d:	89 f0                	mov    %esi,%eax
+  80162f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801634:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801638:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80163d:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801641:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801646:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80164c:	eb 47                	jmp    801695 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80164e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801653:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801657:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80165b:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801661:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801665:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801669:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80166d:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801672:	74 15                	je     801689 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801674:	31 c0                	xor    %eax,%eax
+  801676:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80167c:	48 63 d0             	movslq %eax,%rdx
+  80167f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801684:	48 01 d0             	add    %rdx,%rax
+  801687:	eb 3d                	jmp    8016c6 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801689:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80168f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801695:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80169b:	77 b1                	ja     80164e <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80169d:	eb 0c                	jmp    8016ab <memfind_avx2+0x8f>
+  80169f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8016a5:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8016ab:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8016b1:	74 0e                	je     8016c1 <memfind_avx2+0xa5>
+  8016b3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016b8:	0f b6 00             	movzbl (%rax),%eax
+  8016bb:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8016bf:	75 de                	jne    80169f <memfind_avx2+0x83>
+  return s;
+  8016c1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8016c6:	c9                   	leave
+  8016c7:	c3                   	ret
+
+00000000008016c8 <strlen>:
+strlen(const char *s) {
+  8016c8:	55                   	push   %rbp
+  8016c9:	48 89 e5             	mov    %rsp,%rbp
+  8016cc:	48 83 ec 40          	sub    $0x40,%rsp
+  8016d0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8016d4:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016d8:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8016dc:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  8016e3:	00 00 00 
+  8016e6:	ff d0                	call   *%rax
+  8016e8:	83 e0 02             	and    $0x2,%eax
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	74 18                	je     801707 <strlen+0x3f>
+    return strlen_avx2(s);
+  8016ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f3:	48 89 c7             	mov    %rax,%rdi
+  8016f6:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  8016fd:	00 00 00 
+  801700:	ff d0                	call   *%rax
+  801702:	e9 82 00 00 00       	jmp    801789 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801707:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80170b:	83 e0 0f             	and    $0xf,%eax
+  80170e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801711:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801714:	48 f7 d8             	neg    %rax
+  801717:	48 89 c2             	mov    %rax,%rdx
+  80171a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80171e:	48 01 d0             	add    %rdx,%rax
+  801721:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801725:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801729:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80172d:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801732:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801736:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80173a:	89 c2                	mov    %eax,%edx
+  80173c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80173f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801744:	89 c1                	mov    %eax,%ecx
+  801746:	d3 e6                	shl    %cl,%esi
+  801748:	89 f0                	mov    %esi,%eax
+  80174a:	21 d0                	and    %edx,%eax
+  80174c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80174f:	eb 1d                	jmp    80176e <strlen+0xa6>
+    p += 16;
+  801751:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801756:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80175a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80175e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801763:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801767:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80176b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80176e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801772:	74 dd                	je     801751 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801774:	31 c0                	xor    %eax,%eax
+  801776:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80177b:	48 63 d0             	movslq %eax,%rdx
+  80177e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801782:	48 01 d0             	add    %rdx,%rax
+  801785:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801789:	c9                   	leave
+  80178a:	c3                   	ret
+
+000000000080178b <strnlen>:
+strnlen(const char *s, size_t size) {
+  80178b:	55                   	push   %rbp
+  80178c:	48 89 e5             	mov    %rsp,%rbp
+  80178f:	48 83 ec 20          	sub    $0x20,%rsp
+  801793:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801797:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80179b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8017a2:	eb 0e                	jmp    8017b2 <strnlen+0x27>
+    n++;
+  8017a4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017a8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017ad:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8017b2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8017b7:	74 0b                	je     8017c4 <strnlen+0x39>
+  8017b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017bd:	0f b6 00             	movzbl (%rax),%eax
+  8017c0:	84 c0                	test   %al,%al
+  8017c2:	75 e0                	jne    8017a4 <strnlen+0x19>
+  return n;
+  8017c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8017c7:	c9                   	leave
+  8017c8:	c3                   	ret
+
+00000000008017c9 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8017c9:	55                   	push   %rbp
+  8017ca:	48 89 e5             	mov    %rsp,%rbp
+  8017cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8017d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8017d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8017e1:	90                   	nop
+  8017e2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017e6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017ea:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017fa:	0f b6 12             	movzbl (%rdx),%edx
+  8017fd:	88 10                	mov    %dl,(%rax)
+  8017ff:	0f b6 00             	movzbl (%rax),%eax
+  801802:	84 c0                	test   %al,%al
+  801804:	75 dc                	jne    8017e2 <strcpy+0x19>
+  return ret;
+  801806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80180a:	c9                   	leave
+  80180b:	c3                   	ret
+
+000000000080180c <strcat>:
+strcat(char *dst, const char *src) {
+  80180c:	55                   	push   %rbp
+  80180d:	48 89 e5             	mov    %rsp,%rbp
+  801810:	48 83 ec 20          	sub    $0x20,%rsp
+  801814:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801818:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80181c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801820:	48 89 c7             	mov    %rax,%rdi
+  801823:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801832:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801835:	48 63 d0             	movslq %eax,%rdx
+  801838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80183c:	48 01 c2             	add    %rax,%rdx
+  80183f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801843:	48 89 c6             	mov    %rax,%rsi
+  801846:	48 89 d7             	mov    %rdx,%rdi
+  801849:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  801850:	00 00 00 
+  801853:	ff d0                	call   *%rax
+  return dst;
+  801855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+
+000000000080185b <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80185b:	55                   	push   %rbp
+  80185c:	48 89 e5             	mov    %rsp,%rbp
+  80185f:	48 83 ec 28          	sub    $0x28,%rsp
+  801863:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801867:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80186b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80186f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801873:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801877:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80187e:	00 
+  80187f:	eb 2a                	jmp    8018ab <strncpy+0x50>
+    *dst++ = *src;
+  801881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801885:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801889:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80188d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801891:	0f b6 12             	movzbl (%rdx),%edx
+  801894:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801896:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80189a:	0f b6 00             	movzbl (%rax),%eax
+  80189d:	84 c0                	test   %al,%al
+  80189f:	74 05                	je     8018a6 <strncpy+0x4b>
+      src++;
+  8018a1:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8018a6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018af:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8018b3:	72 cc                	jb     801881 <strncpy+0x26>
+  return ret;
+  8018b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8018b9:	c9                   	leave
+  8018ba:	c3                   	ret
+
+00000000008018bb <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8018c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8018cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8018d7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018dc:	74 3d                	je     80191b <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8018de:	eb 1d                	jmp    8018fd <strlcpy+0x42>
+      *dst++ = *src++;
+  8018e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018e4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018f8:	0f b6 12             	movzbl (%rdx),%edx
+  8018fb:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8018fd:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801902:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801907:	74 0b                	je     801914 <strlcpy+0x59>
+  801909:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80190d:	0f b6 00             	movzbl (%rax),%eax
+  801910:	84 c0                	test   %al,%al
+  801912:	75 cc                	jne    8018e0 <strlcpy+0x25>
+    *dst = '\0';
+  801914:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801918:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80191b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80191f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+
+0000000000801925 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	48 83 ec 30          	sub    $0x30,%rsp
+  80192d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801931:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801935:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801939:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80193d:	48 89 c7             	mov    %rax,%rdi
+  801940:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  801947:	00 00 00 
+  80194a:	ff d0                	call   *%rax
+  80194c:	48 98                	cltq
+  80194e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801952:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80195a:	48 89 d6             	mov    %rdx,%rsi
+  80195d:	48 89 c7             	mov    %rax,%rdi
+  801960:	48 b8 8b 17 80 00 00 	movabs $0x80178b,%rax
+  801967:	00 00 00 
+  80196a:	ff d0                	call   *%rax
+  80196c:	48 98                	cltq
+  80196e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801972:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801976:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80197a:	75 10                	jne    80198c <strlcat+0x67>
+    return maxlen + srclen;
+  80197c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801980:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801984:	48 01 d0             	add    %rdx,%rax
+  801987:	e9 86 00 00 00       	jmp    801a12 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80198c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801990:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801994:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801998:	73 2b                	jae    8019c5 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80199a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019a2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019aa:	48 01 c1             	add    %rax,%rcx
+  8019ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019b1:	48 89 c6             	mov    %rax,%rsi
+  8019b4:	48 89 cf             	mov    %rcx,%rdi
+  8019b7:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  8019be:	00 00 00 
+  8019c1:	ff d0                	call   *%rax
+  8019c3:	eb 42                	jmp    801a07 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8019c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019cd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d5:	48 01 c1             	add    %rax,%rcx
+  8019d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019dc:	48 89 c6             	mov    %rax,%rsi
+  8019df:	48 89 cf             	mov    %rcx,%rdi
+  8019e2:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  8019e9:	00 00 00 
+  8019ec:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8019ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f6:	48 01 d0             	add    %rdx,%rax
+  8019f9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a01:	48 01 d0             	add    %rdx,%rax
+  801a04:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801a07:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a0f:	48 01 d0             	add    %rdx,%rax
+}
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+
+0000000000801a14 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	48 83 ec 10          	sub    $0x10,%rsp
+  801a1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a20:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a24:	eb 0a                	jmp    801a30 <strcmp+0x1c>
+    p++, q++;
+  801a26:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a2b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a34:	0f b6 00             	movzbl (%rax),%eax
+  801a37:	84 c0                	test   %al,%al
+  801a39:	74 12                	je     801a4d <strcmp+0x39>
+  801a3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3f:	0f b6 10             	movzbl (%rax),%edx
+  801a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a46:	0f b6 00             	movzbl (%rax),%eax
+  801a49:	38 c2                	cmp    %al,%dl
+  801a4b:	74 d9                	je     801a26 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801a4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a51:	0f b6 00             	movzbl (%rax),%eax
+  801a54:	0f b6 d0             	movzbl %al,%edx
+  801a57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5b:	0f b6 00             	movzbl (%rax),%eax
+  801a5e:	0f b6 c0             	movzbl %al,%eax
+  801a61:	29 c2                	sub    %eax,%edx
+  801a63:	89 d0                	mov    %edx,%eax
+}
+  801a65:	c9                   	leave
+  801a66:	c3                   	ret
+
+0000000000801a67 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	48 83 ec 18          	sub    $0x18,%rsp
+  801a6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a7b:	eb 0f                	jmp    801a8c <strncmp+0x25>
+    n--, p++, q++;
+  801a7d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801a82:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a87:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a8c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a91:	74 1d                	je     801ab0 <strncmp+0x49>
+  801a93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a97:	0f b6 00             	movzbl (%rax),%eax
+  801a9a:	84 c0                	test   %al,%al
+  801a9c:	74 12                	je     801ab0 <strncmp+0x49>
+  801a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa2:	0f b6 10             	movzbl (%rax),%edx
+  801aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa9:	0f b6 00             	movzbl (%rax),%eax
+  801aac:	38 c2                	cmp    %al,%dl
+  801aae:	74 cd                	je     801a7d <strncmp+0x16>
+  if (n == 0)
+  801ab0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ab5:	75 07                	jne    801abe <strncmp+0x57>
+    return 0;
+  801ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abc:	eb 16                	jmp    801ad4 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801abe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac2:	0f b6 00             	movzbl (%rax),%eax
+  801ac5:	0f b6 d0             	movzbl %al,%edx
+  801ac8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801acc:	0f b6 00             	movzbl (%rax),%eax
+  801acf:	0f b6 c0             	movzbl %al,%eax
+  801ad2:	29 c2                	sub    %eax,%edx
+}
+  801ad4:	89 d0                	mov    %edx,%eax
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+
+0000000000801ad8 <strchr>:
+strchr(const char *s, char c) {
+  801ad8:	55                   	push   %rbp
+  801ad9:	48 89 e5             	mov    %rsp,%rbp
+  801adc:	48 83 ec 60          	sub    $0x60,%rsp
+  801ae0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801ae4:	89 f0                	mov    %esi,%eax
+  801ae6:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801ae9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801aed:	83 e0 0f             	and    $0xf,%eax
+  801af0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801af3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801af6:	48 f7 d8             	neg    %rax
+  801af9:	48 89 c2             	mov    %rax,%rdx
+  801afc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b00:	48 01 d0             	add    %rdx,%rax
+  801b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801b07:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801b0b:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801b0f:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801b13:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b17:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b1b:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b1f:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b24:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801b28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b2c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b30:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b34:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b39:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b3e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b42:	89 c2                	mov    %eax,%edx
+  801b44:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b49:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b4e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b52:	09 c2                	or     %eax,%edx
+  801b54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b57:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801b5c:	89 c1                	mov    %eax,%ecx
+  801b5e:	d3 e6                	shl    %cl,%esi
+  801b60:	89 f0                	mov    %esi,%eax
+  801b62:	21 d0                	and    %edx,%eax
+  801b64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b67:	eb 34                	jmp    801b9d <strchr+0xc5>
+    p += 16;
+  801b69:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801b6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b72:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b76:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801b7a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b7f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b84:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b88:	89 c2                	mov    %eax,%edx
+  801b8a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b8f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b94:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b98:	09 d0                	or     %edx,%eax
+  801b9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ba1:	74 c6                	je     801b69 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801ba3:	31 c0                	xor    %eax,%eax
+  801ba5:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801baa:	48 98                	cltq
+  801bac:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801bb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb4:	0f b6 00             	movzbl (%rax),%eax
+  801bb7:	84 c0                	test   %al,%al
+  801bb9:	74 06                	je     801bc1 <strchr+0xe9>
+  801bbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bbf:	eb 05                	jmp    801bc6 <strchr+0xee>
+  801bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bc6:	c9                   	leave
+  801bc7:	c3                   	ret
+
+0000000000801bc8 <strfind>:
+strfind(const char *s, char c) {
+  801bc8:	55                   	push   %rbp
+  801bc9:	48 89 e5             	mov    %rsp,%rbp
+  801bcc:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bd4:	89 f0                	mov    %esi,%eax
+  801bd6:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801bd9:	eb 11                	jmp    801bec <strfind+0x24>
+    if (*s == c)
+  801bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bdf:	0f b6 00             	movzbl (%rax),%eax
+  801be2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801be5:	74 12                	je     801bf9 <strfind+0x31>
+  for (; *s; s++)
+  801be7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf0:	0f b6 00             	movzbl (%rax),%eax
+  801bf3:	84 c0                	test   %al,%al
+  801bf5:	75 e4                	jne    801bdb <strfind+0x13>
+  801bf7:	eb 01                	jmp    801bfa <strfind+0x32>
+      break;
+  801bf9:	90                   	nop
+  return (char *)s;
+  801bfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bfe:	c9                   	leave
+  801bff:	c3                   	ret
+
+0000000000801c00 <memset>:
+memset(void *v, int c, size_t n) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+  801c04:	48 83 ec 38          	sub    $0x38,%rsp
+  801c08:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c0c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801c0f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801c13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c1b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c20:	76 41                	jbe    801c63 <memset+0x63>
+  801c22:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+  801c2e:	83 e0 01             	and    $0x1,%eax
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	74 2e                	je     801c63 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c35:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c38:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c3c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c40:	48 89 ce             	mov    %rcx,%rsi
+  801c43:	48 89 f7             	mov    %rsi,%rdi
+  801c46:	48 89 d1             	mov    %rdx,%rcx
+  801c49:	fc                   	cld
+  801c4a:	f3 aa                	rep stos %al,%es:(%rdi)
+  801c4c:	48 89 ca             	mov    %rcx,%rdx
+  801c4f:	48 89 fe             	mov    %rdi,%rsi
+  801c52:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801c56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801c5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5e:	e9 a7 00 00 00       	jmp    801d0a <memset+0x10a>
+  if (n >= 8) {
+  801c63:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c68:	0f 86 87 00 00 00    	jbe    801cf5 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801c6e:	eb 16                	jmp    801c86 <memset+0x86>
+      *p++ = c;
+  801c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c74:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c78:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c7c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801c7f:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801c81:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8a:	83 e0 07             	and    $0x7,%eax
+  801c8d:	48 85 c0             	test   %rax,%rax
+  801c90:	75 de                	jne    801c70 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801c92:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c95:	0f b6 c0             	movzbl %al,%eax
+  801c98:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801c9f:	01 01 01 
+  801ca2:	48 0f af c2          	imul   %rdx,%rax
+  801ca6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801caa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cae:	48 c1 e8 03          	shr    $0x3,%rax
+  801cb2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cba:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801cbe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cc2:	48 89 ce             	mov    %rcx,%rsi
+  801cc5:	48 89 f7             	mov    %rsi,%rdi
+  801cc8:	48 89 d1             	mov    %rdx,%rcx
+  801ccb:	fc                   	cld
+  801ccc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ccf:	48 89 ca             	mov    %rcx,%rdx
+  801cd2:	48 89 fe             	mov    %rdi,%rsi
+  801cd5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801cd9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801cdd:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ce2:	eb 11                	jmp    801cf5 <memset+0xf5>
+    *p++ = c;
+  801ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ce8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cec:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cf0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cf3:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801cf5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cfd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d01:	48 85 c0             	test   %rax,%rax
+  801d04:	75 de                	jne    801ce4 <memset+0xe4>
+  return v;
+  801d06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d0a:	c9                   	leave
+  801d0b:	c3                   	ret
+
+0000000000801d0c <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	48 83 ec 38          	sub    $0x38,%rsp
+  801d14:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801d20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801d28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d34:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d38:	0f 83 da 00 00 00    	jae    801e18 <memmove+0x10c>
+  801d3e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d46:	48 01 d0             	add    %rdx,%rax
+  801d49:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801d4d:	0f 83 c5 00 00 00    	jae    801e18 <memmove+0x10c>
+    s += n;
+  801d53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d57:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801d5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d5f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801d63:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d68:	0f 86 94 00 00 00    	jbe    801e02 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801d6e:	eb 1c                	jmp    801d8c <memmove+0x80>
+        *--d = *--s;
+  801d70:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801d75:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801d7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d7e:	0f b6 10             	movzbl (%rax),%edx
+  801d81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d85:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d87:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d90:	83 e0 07             	and    $0x7,%eax
+  801d93:	48 85 c0             	test   %rax,%rax
+  801d96:	75 d8                	jne    801d70 <memmove+0x64>
+      nq = n / 8;
+  801d98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d9c:	48 c1 e8 03          	shr    $0x3,%rax
+  801da0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801da4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801da9:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801dae:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801db3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801db7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dbf:	48 89 cf             	mov    %rcx,%rdi
+  801dc2:	48 89 d6             	mov    %rdx,%rsi
+  801dc5:	48 89 c1             	mov    %rax,%rcx
+  801dc8:	fd                   	std
+  801dc9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801dcc:	fc                   	cld
+  801dcd:	48 89 c8             	mov    %rcx,%rax
+  801dd0:	48 89 f2             	mov    %rsi,%rdx
+  801dd3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801dd7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ddb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801ddf:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801de4:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801de9:	eb 17                	jmp    801e02 <memmove+0xf6>
+      *--d = *--s;
+  801deb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801df0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801df5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801df9:	0f b6 10             	movzbl (%rax),%edx
+  801dfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e00:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801e02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e06:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e0e:	48 85 c0             	test   %rax,%rax
+  801e11:	75 d8                	jne    801deb <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801e13:	e9 f4 00 00 00       	jmp    801f0c <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e18:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e1d:	76 46                	jbe    801e65 <memmove+0x159>
+  801e1f:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  801e26:	00 00 00 
+  801e29:	ff d0                	call   *%rax
+  801e2b:	83 e0 01             	and    $0x1,%eax
+  801e2e:	85 c0                	test   %eax,%eax
+  801e30:	74 33                	je     801e65 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e32:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e36:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3e:	48 89 cf             	mov    %rcx,%rdi
+  801e41:	48 89 d6             	mov    %rdx,%rsi
+  801e44:	48 89 c1             	mov    %rax,%rcx
+  801e47:	fc                   	cld
+  801e48:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e4a:	48 89 c8             	mov    %rcx,%rax
+  801e4d:	48 89 f2             	mov    %rsi,%rdx
+  801e50:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e54:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e58:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801e5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e60:	e9 ab 00 00 00       	jmp    801f10 <memmove+0x204>
+    if (n >= 8) {
+  801e65:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801e6a:	0f 86 8b 00 00 00    	jbe    801efb <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801e70:	eb 22                	jmp    801e94 <memmove+0x188>
+        *d++ = *s++;
+  801e72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e76:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e7a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e82:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e86:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801e8a:	0f b6 12             	movzbl (%rdx),%edx
+  801e8d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801e8f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801e94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e98:	83 e0 07             	and    $0x7,%eax
+  801e9b:	48 85 c0             	test   %rax,%rax
+  801e9e:	75 d2                	jne    801e72 <memmove+0x166>
+      nq = n / 8;
+  801ea0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea4:	48 c1 e8 03          	shr    $0x3,%rax
+  801ea8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801eac:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801eb0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb8:	48 89 cf             	mov    %rcx,%rdi
+  801ebb:	48 89 d6             	mov    %rdx,%rsi
+  801ebe:	48 89 c1             	mov    %rax,%rcx
+  801ec1:	fc                   	cld
+  801ec2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ec5:	48 89 c8             	mov    %rcx,%rax
+  801ec8:	48 89 f2             	mov    %rsi,%rdx
+  801ecb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ecf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ed3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801ed7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801edc:	eb 1d                	jmp    801efb <memmove+0x1ef>
+      *d++ = *s++;
+  801ede:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ee2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ee6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801eea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801eee:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ef2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ef6:	0f b6 12             	movzbl (%rdx),%edx
+  801ef9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801efb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eff:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f03:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f07:	48 85 c0             	test   %rax,%rax
+  801f0a:	75 d2                	jne    801ede <memmove+0x1d2>
+  return dst;
+  801f0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+
+0000000000801f12 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801f12:	55                   	push   %rbp
+  801f13:	48 89 e5             	mov    %rsp,%rbp
+  801f16:	48 83 ec 18          	sub    $0x18,%rsp
+  801f1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f1e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f22:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801f26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f2a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f32:	48 89 ce             	mov    %rcx,%rsi
+  801f35:	48 89 c7             	mov    %rax,%rdi
+  801f38:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	48 83 ec 40          	sub    $0x40,%rsp
+  801f4e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f52:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801f5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801f62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f6a:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801f6f:	0f 86 a7 00 00 00    	jbe    80201c <memcmp+0xd6>
+  801f75:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+  801f81:	83 e0 02             	and    $0x2,%eax
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	0f 84 90 00 00 00    	je     80201c <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801f8c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f90:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f98:	48 89 ce             	mov    %rcx,%rsi
+  801f9b:	48 89 c7             	mov    %rax,%rdi
+  801f9e:	48 b8 2d 15 80 00 00 	movabs $0x80152d,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	e9 c2 00 00 00       	jmp    802071 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801faf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb3:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fb7:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801fbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fbf:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fc3:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fc7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fcb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801fce:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801fd5:	74 36                	je     80200d <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801fd7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fda:	f7 d0                	not    %eax
+  801fdc:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801fe0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801fe3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fe6:	48 63 d0             	movslq %eax,%rdx
+  801fe9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fed:	48 01 d0             	add    %rdx,%rax
+  801ff0:	0f b6 00             	movzbl (%rax),%eax
+  801ff3:	0f b6 c0             	movzbl %al,%eax
+  801ff6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ff9:	48 63 ca             	movslq %edx,%rcx
+  801ffc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802000:	48 01 ca             	add    %rcx,%rdx
+  802003:	0f b6 12             	movzbl (%rdx),%edx
+  802006:	0f b6 d2             	movzbl %dl,%edx
+  802009:	29 d0                	sub    %edx,%eax
+  80200b:	eb 64                	jmp    802071 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80200d:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  802012:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802017:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80201c:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802021:	77 8c                	ja     801faf <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802023:	eb 36                	jmp    80205b <memcmp+0x115>
+    if (*s1 != *s2)
+  802025:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802029:	0f b6 10             	movzbl (%rax),%edx
+  80202c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802030:	0f b6 00             	movzbl (%rax),%eax
+  802033:	38 c2                	cmp    %al,%dl
+  802035:	74 1a                	je     802051 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802037:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80203b:	0f b6 00             	movzbl (%rax),%eax
+  80203e:	0f b6 c8             	movzbl %al,%ecx
+  802041:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802045:	0f b6 00             	movzbl (%rax),%eax
+  802048:	0f b6 d0             	movzbl %al,%edx
+  80204b:	89 c8                	mov    %ecx,%eax
+  80204d:	29 d0                	sub    %edx,%eax
+  80204f:	eb 20                	jmp    802071 <memcmp+0x12b>
+    s1++, s2++;
+  802051:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802056:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80205b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80205f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802063:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802067:	48 85 c0             	test   %rax,%rax
+  80206a:	75 b9                	jne    802025 <memcmp+0xdf>
+  }
+
+  return 0;
+  80206c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+0000000000802073 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802073:	55                   	push   %rbp
+  802074:	48 89 e5             	mov    %rsp,%rbp
+  802077:	48 83 ec 50          	sub    $0x50,%rsp
+  80207b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80207f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802082:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802086:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80208a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80208e:	48 01 d0             	add    %rdx,%rax
+  802091:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802095:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802098:	66 0f 6e c0          	movd   %eax,%xmm0
+  80209c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8020a0:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8020a4:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8020a9:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8020ad:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8020b2:	76 73                	jbe    802127 <memfind+0xb4>
+  8020b4:	48 b8 65 13 80 00 00 	movabs $0x801365,%rax
+  8020bb:	00 00 00 
+  8020be:	ff d0                	call   *%rax
+  8020c0:	83 e0 02             	and    $0x2,%eax
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	74 60                	je     802127 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8020c7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020ca:	0f b6 c8             	movzbl %al,%ecx
+  8020cd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d5:	89 ce                	mov    %ecx,%esi
+  8020d7:	48 89 c7             	mov    %rax,%rdi
+  8020da:	48 b8 1c 16 80 00 00 	movabs $0x80161c,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+  8020e6:	eb 6c                	jmp    802154 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8020e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ec:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8020f0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8020f4:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8020f9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8020fd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802101:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802104:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802108:	74 13                	je     80211d <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  80210a:	31 c0                	xor    %eax,%eax
+  80210c:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802111:	48 63 d0             	movslq %eax,%rdx
+  802114:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802118:	48 01 d0             	add    %rdx,%rax
+  80211b:	eb 37                	jmp    802154 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  80211d:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802122:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802127:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  80212c:	77 ba                	ja     8020e8 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80212e:	eb 13                	jmp    802143 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802130:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802134:	0f b6 00             	movzbl (%rax),%eax
+  802137:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80213a:	38 d0                	cmp    %dl,%al
+  80213c:	74 11                	je     80214f <memfind+0xdc>
+  for (; s < ends; s++)
+  80213e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802147:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80214b:	72 e3                	jb     802130 <memfind+0xbd>
+  80214d:	eb 01                	jmp    802150 <memfind+0xdd>
+      break;
+  80214f:	90                   	nop
+  return (void *)s;
+  802150:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802154:	c9                   	leave
+  802155:	c3                   	ret
+
+0000000000802156 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802156:	55                   	push   %rbp
+  802157:	48 89 e5             	mov    %rsp,%rbp
+  80215a:	48 83 ec 38          	sub    $0x38,%rsp
+  80215e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802162:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802166:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802169:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802170:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802177:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802178:	eb 05                	jmp    80217f <strtol+0x29>
+    s++;
+  80217a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80217f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802183:	0f b6 00             	movzbl (%rax),%eax
+  802186:	3c 20                	cmp    $0x20,%al
+  802188:	74 f0                	je     80217a <strtol+0x24>
+  80218a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218e:	0f b6 00             	movzbl (%rax),%eax
+  802191:	3c 09                	cmp    $0x9,%al
+  802193:	74 e5                	je     80217a <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802195:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802199:	0f b6 00             	movzbl (%rax),%eax
+  80219c:	3c 2b                	cmp    $0x2b,%al
+  80219e:	75 07                	jne    8021a7 <strtol+0x51>
+    s++;
+  8021a0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021a5:	eb 17                	jmp    8021be <strtol+0x68>
+  else if (*s == '-')
+  8021a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ab:	0f b6 00             	movzbl (%rax),%eax
+  8021ae:	3c 2d                	cmp    $0x2d,%al
+  8021b0:	75 0c                	jne    8021be <strtol+0x68>
+    s++, neg = 1;
+  8021b2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021b7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8021be:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021c2:	74 06                	je     8021ca <strtol+0x74>
+  8021c4:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8021c8:	75 28                	jne    8021f2 <strtol+0x9c>
+  8021ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ce:	0f b6 00             	movzbl (%rax),%eax
+  8021d1:	3c 30                	cmp    $0x30,%al
+  8021d3:	75 1d                	jne    8021f2 <strtol+0x9c>
+  8021d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d9:	48 83 c0 01          	add    $0x1,%rax
+  8021dd:	0f b6 00             	movzbl (%rax),%eax
+  8021e0:	3c 78                	cmp    $0x78,%al
+  8021e2:	75 0e                	jne    8021f2 <strtol+0x9c>
+    s += 2, base = 16;
+  8021e4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8021e9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8021f0:	eb 2c                	jmp    80221e <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8021f2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021f6:	75 19                	jne    802211 <strtol+0xbb>
+  8021f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021fc:	0f b6 00             	movzbl (%rax),%eax
+  8021ff:	3c 30                	cmp    $0x30,%al
+  802201:	75 0e                	jne    802211 <strtol+0xbb>
+    s++, base = 8;
+  802203:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802208:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80220f:	eb 0d                	jmp    80221e <strtol+0xc8>
+  else if (base == 0)
+  802211:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802215:	75 07                	jne    80221e <strtol+0xc8>
+    base = 10;
+  802217:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80221e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802222:	0f b6 00             	movzbl (%rax),%eax
+  802225:	3c 2f                	cmp    $0x2f,%al
+  802227:	7e 1d                	jle    802246 <strtol+0xf0>
+  802229:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80222d:	0f b6 00             	movzbl (%rax),%eax
+  802230:	3c 39                	cmp    $0x39,%al
+  802232:	7f 12                	jg     802246 <strtol+0xf0>
+      dig = *s - '0';
+  802234:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802238:	0f b6 00             	movzbl (%rax),%eax
+  80223b:	0f be c0             	movsbl %al,%eax
+  80223e:	83 e8 30             	sub    $0x30,%eax
+  802241:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802244:	eb 4e                	jmp    802294 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802246:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224a:	0f b6 00             	movzbl (%rax),%eax
+  80224d:	3c 60                	cmp    $0x60,%al
+  80224f:	7e 1d                	jle    80226e <strtol+0x118>
+  802251:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802255:	0f b6 00             	movzbl (%rax),%eax
+  802258:	3c 7a                	cmp    $0x7a,%al
+  80225a:	7f 12                	jg     80226e <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80225c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802260:	0f b6 00             	movzbl (%rax),%eax
+  802263:	0f be c0             	movsbl %al,%eax
+  802266:	83 e8 57             	sub    $0x57,%eax
+  802269:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80226c:	eb 26                	jmp    802294 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80226e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802272:	0f b6 00             	movzbl (%rax),%eax
+  802275:	3c 40                	cmp    $0x40,%al
+  802277:	7e 47                	jle    8022c0 <strtol+0x16a>
+  802279:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80227d:	0f b6 00             	movzbl (%rax),%eax
+  802280:	3c 5a                	cmp    $0x5a,%al
+  802282:	7f 3c                	jg     8022c0 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802284:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802288:	0f b6 00             	movzbl (%rax),%eax
+  80228b:	0f be c0             	movsbl %al,%eax
+  80228e:	83 e8 37             	sub    $0x37,%eax
+  802291:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802294:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802297:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80229a:	7d 23                	jge    8022bf <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80229c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8022a1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022a4:	48 98                	cltq
+  8022a6:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8022ab:	48 89 c2             	mov    %rax,%rdx
+  8022ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022b1:	48 98                	cltq
+  8022b3:	48 01 d0             	add    %rdx,%rax
+  8022b6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8022ba:	e9 5f ff ff ff       	jmp    80221e <strtol+0xc8>
+      break;
+  8022bf:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8022c0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8022c5:	74 0b                	je     8022d2 <strtol+0x17c>
+    *endptr = (char *)s;
+  8022c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8022cf:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8022d2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022d6:	74 09                	je     8022e1 <strtol+0x18b>
+  8022d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022dc:	48 f7 d8             	neg    %rax
+  8022df:	eb 04                	jmp    8022e5 <strtol+0x18f>
+  8022e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+
+00000000008022e7 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8022e7:	55                   	push   %rbp
+  8022e8:	48 89 e5             	mov    %rsp,%rbp
+  8022eb:	53                   	push   %rbx
+  8022ec:	48 83 ec 48          	sub    $0x48,%rsp
+  8022f0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022f4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8022f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8022fc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802300:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802304:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802308:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802310:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802314:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802318:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80231c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802320:	4c 89 c3             	mov    %r8,%rbx
+  802323:	cd 30                	int    $0x30
+  802325:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802329:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80232e:	74 46                	je     802376 <syscall+0x8f>
+  802330:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802335:	7e 3f                	jle    802376 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802337:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80233b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80233f:	49 89 d0             	mov    %rdx,%r8
+  802342:	48 89 c1             	mov    %rax,%rcx
+  802345:	48 b8 08 71 80 00 00 	movabs $0x807108,%rax
+  80234c:	00 00 00 
+  80234f:	48 89 c2             	mov    %rax,%rdx
+  802352:	be 22 00 00 00       	mov    $0x22,%esi
+  802357:	48 b8 27 71 80 00 00 	movabs $0x807127,%rax
+  80235e:	00 00 00 
+  802361:	48 89 c7             	mov    %rax,%rdi
+  802364:	b8 00 00 00 00       	mov    $0x0,%eax
+  802369:	49 b9 fa 05 80 00 00 	movabs $0x8005fa,%r9
+  802370:	00 00 00 
+  802373:	41 ff d1             	call   *%r9
+
+  return ret;
+  802376:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80237a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80237e:	c9                   	leave
+  80237f:	c3                   	ret
+
+0000000000802380 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+  802384:	48 83 ec 10          	sub    $0x10,%rsp
+  802388:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80238c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802390:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802398:	48 83 ec 08          	sub    $0x8,%rsp
+  80239c:	6a 00                	push   $0x0
+  80239e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023aa:	48 89 d1             	mov    %rdx,%rcx
+  8023ad:	48 89 c2             	mov    %rax,%rdx
+  8023b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ba:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+  8023c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ca:	90                   	nop
+  8023cb:	c9                   	leave
+  8023cc:	c3                   	ret
+
+00000000008023cd <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8023cd:	55                   	push   %rbp
+  8023ce:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8023d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d5:	6a 00                	push   $0x0
+  8023d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023f7:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+  802403:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+
+0000000000802409 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+  80240d:	48 83 ec 10          	sub    $0x10,%rsp
+  802411:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802414:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802417:	48 98                	cltq
+  802419:	48 83 ec 08          	sub    $0x8,%rsp
+  80241d:	6a 00                	push   $0x0
+  80241f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802430:	48 89 c2             	mov    %rax,%rdx
+  802433:	be 01 00 00 00       	mov    $0x1,%esi
+  802438:	bf 03 00 00 00       	mov    $0x3,%edi
+  80243d:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+  802449:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80244d:	c9                   	leave
+  80244e:	c3                   	ret
+
+000000000080244f <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	48 83 ec 10          	sub    $0x10,%rsp
+  802457:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80245a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80245d:	48 98                	cltq
+  80245f:	48 83 ec 08          	sub    $0x8,%rsp
+  802463:	6a 00                	push   $0x0
+  802465:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80246b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802471:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802476:	48 89 c2             	mov    %rax,%rdx
+  802479:	be 00 00 00 00       	mov    $0x0,%esi
+  80247e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802483:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+  80248f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802493:	90                   	nop
+  802494:	c9                   	leave
+  802495:	c3                   	ret
+
+0000000000802496 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	48 83 ec 20          	sub    $0x20,%rsp
+  80249e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8024a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024a8:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8024ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024b0:	cd 30                	int    $0x30
+  8024b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8024b6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8024ba:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8024bf:	7e 3d                	jle    8024fe <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8024c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c5:	49 89 c0             	mov    %rax,%r8
+  8024c8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024cd:	48 b8 08 71 80 00 00 	movabs $0x807108,%rax
+  8024d4:	00 00 00 
+  8024d7:	48 89 c2             	mov    %rax,%rdx
+  8024da:	be 49 00 00 00       	mov    $0x49,%esi
+  8024df:	48 b8 27 71 80 00 00 	movabs $0x807127,%rax
+  8024e6:	00 00 00 
+  8024e9:	48 89 c7             	mov    %rax,%rdi
+  8024ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f1:	49 b9 fa 05 80 00 00 	movabs $0x8005fa,%r9
+  8024f8:	00 00 00 
+  8024fb:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8024fe:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802503:	75 13                	jne    802518 <sys_env_wait+0x82>
+  802505:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80250a:	74 0c                	je     802518 <sys_env_wait+0x82>
+    *status = st;
+  80250c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802510:	89 c2                	mov    %eax,%edx
+  802512:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802516:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802518:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80251c:	c9                   	leave
+  80251d:	c3                   	ret
+
+000000000080251e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80251e:	55                   	push   %rbp
+  80251f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802522:	48 83 ec 08          	sub    $0x8,%rsp
+  802526:	6a 00                	push   $0x0
+  802528:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80252e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802534:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253e:	be 00 00 00 00       	mov    $0x0,%esi
+  802543:	bf 02 00 00 00       	mov    $0x2,%edi
+  802548:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802558:	c9                   	leave
+  802559:	c3                   	ret
+
+000000000080255a <sys_yield>:
+
+void
+sys_yield(void) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80255e:	48 83 ec 08          	sub    $0x8,%rsp
+  802562:	6a 00                	push   $0x0
+  802564:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80256a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257a:	be 00 00 00 00       	mov    $0x0,%esi
+  80257f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802584:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  80258b:	00 00 00 
+  80258e:	ff d0                	call   *%rax
+  802590:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802594:	90                   	nop
+  802595:	c9                   	leave
+  802596:	c3                   	ret
+
+0000000000802597 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802597:	55                   	push   %rbp
+  802598:	48 89 e5             	mov    %rsp,%rbp
+  80259b:	48 83 ec 20          	sub    $0x20,%rsp
+  80259f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025a6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8025a9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025ac:	48 63 c8             	movslq %eax,%rcx
+  8025af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025b6:	48 98                	cltq
+  8025b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bc:	6a 00                	push   $0x0
+  8025be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c4:	49 89 c8             	mov    %rcx,%r8
+  8025c7:	48 89 d1             	mov    %rdx,%rcx
+  8025ca:	48 89 c2             	mov    %rax,%rdx
+  8025cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8025d7:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	48 83 c4 10          	add    $0x10,%rsp
+  8025e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8025ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8025ed:	c9                   	leave
+  8025ee:	c3                   	ret
+
+00000000008025ef <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8025ef:	55                   	push   %rbp
+  8025f0:	48 89 e5             	mov    %rsp,%rbp
+  8025f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025fe:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802601:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802605:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802609:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80260c:	48 63 c8             	movslq %eax,%rcx
+  80260f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802613:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802616:	48 63 f0             	movslq %eax,%rsi
+  802619:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80261d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802620:	48 98                	cltq
+  802622:	48 83 ec 08          	sub    $0x8,%rsp
+  802626:	51                   	push   %rcx
+  802627:	49 89 f9             	mov    %rdi,%r9
+  80262a:	49 89 f0             	mov    %rsi,%r8
+  80262d:	48 89 d1             	mov    %rdx,%rcx
+  802630:	48 89 c2             	mov    %rax,%rdx
+  802633:	be 01 00 00 00       	mov    $0x1,%esi
+  802638:	bf 07 00 00 00       	mov    $0x7,%edi
+  80263d:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802644:	00 00 00 
+  802647:	ff d0                	call   *%rax
+  802649:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80264d:	c9                   	leave
+  80264e:	c3                   	ret
+
+000000000080264f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80264f:	55                   	push   %rbp
+  802650:	48 89 e5             	mov    %rsp,%rbp
+  802653:	48 83 ec 10          	sub    $0x10,%rsp
+  802657:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80265a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80265e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802662:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802665:	48 98                	cltq
+  802667:	48 83 ec 08          	sub    $0x8,%rsp
+  80266b:	6a 00                	push   $0x0
+  80266d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802673:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802679:	48 89 d1             	mov    %rdx,%rcx
+  80267c:	48 89 c2             	mov    %rax,%rdx
+  80267f:	be 01 00 00 00       	mov    $0x1,%esi
+  802684:	bf 08 00 00 00       	mov    $0x8,%edi
+  802689:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802699:	c9                   	leave
+  80269a:	c3                   	ret
+
+000000000080269b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026a6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8026a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8026ac:	48 63 d0             	movslq %eax,%rdx
+  8026af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026b2:	48 98                	cltq
+  8026b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b8:	6a 00                	push   $0x0
+  8026ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c6:	48 89 d1             	mov    %rdx,%rcx
+  8026c9:	48 89 c2             	mov    %rax,%rdx
+  8026cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8026d6:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8026dd:	00 00 00 
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e6:	c9                   	leave
+  8026e7:	c3                   	ret
+
+00000000008026e8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8026e8:	55                   	push   %rbp
+  8026e9:	48 89 e5             	mov    %rsp,%rbp
+  8026ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8026f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026fe:	48 98                	cltq
+  802700:	48 83 ec 08          	sub    $0x8,%rsp
+  802704:	6a 00                	push   $0x0
+  802706:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802712:	48 89 d1             	mov    %rdx,%rcx
+  802715:	48 89 c2             	mov    %rax,%rdx
+  802718:	be 01 00 00 00       	mov    $0x1,%esi
+  80271d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802722:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+  80272e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802732:	c9                   	leave
+  802733:	c3                   	ret
+
+0000000000802734 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802734:	55                   	push   %rbp
+  802735:	48 89 e5             	mov    %rsp,%rbp
+  802738:	48 83 ec 10          	sub    $0x10,%rsp
+  80273c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80273f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802743:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802747:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80274a:	48 98                	cltq
+  80274c:	48 83 ec 08          	sub    $0x8,%rsp
+  802750:	6a 00                	push   $0x0
+  802752:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80275e:	48 89 d1             	mov    %rdx,%rcx
+  802761:	48 89 c2             	mov    %rax,%rdx
+  802764:	be 01 00 00 00       	mov    $0x1,%esi
+  802769:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80276e:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80277e:	c9                   	leave
+  80277f:	c3                   	ret
+
+0000000000802780 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802780:	55                   	push   %rbp
+  802781:	48 89 e5             	mov    %rsp,%rbp
+  802784:	48 83 ec 20          	sub    $0x20,%rsp
+  802788:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80278b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80278f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802793:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802796:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802799:	48 63 f0             	movslq %eax,%rsi
+  80279c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027a7:	48 98                	cltq
+  8027a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ad:	6a 00                	push   $0x0
+  8027af:	49 89 f1             	mov    %rsi,%r9
+  8027b2:	49 89 c8             	mov    %rcx,%r8
+  8027b5:	48 89 d1             	mov    %rdx,%rcx
+  8027b8:	48 89 c2             	mov    %rax,%rdx
+  8027bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c0:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027c5:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8027cc:	00 00 00 
+  8027cf:	ff d0                	call   *%rax
+  8027d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+
+00000000008027d7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8027d7:	55                   	push   %rbp
+  8027d8:	48 89 e5             	mov    %rsp,%rbp
+  8027db:	48 83 ec 10          	sub    $0x10,%rsp
+  8027df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8027e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027eb:	6a 00                	push   $0x0
+  8027ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027fe:	48 89 c2             	mov    %rax,%rdx
+  802801:	be 01 00 00 00       	mov    $0x1,%esi
+  802806:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80280b:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+  802817:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80281b:	c9                   	leave
+  80281c:	c3                   	ret
+
+000000000080281d <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80281d:	55                   	push   %rbp
+  80281e:	48 89 e5             	mov    %rsp,%rbp
+  802821:	48 83 ec 10          	sub    $0x10,%rsp
+  802825:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802829:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80282d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802835:	48 83 ec 08          	sub    $0x8,%rsp
+  802839:	6a 00                	push   $0x0
+  80283b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802841:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802847:	48 89 d1             	mov    %rdx,%rcx
+  80284a:	48 89 c2             	mov    %rax,%rdx
+  80284d:	be 01 00 00 00       	mov    $0x1,%esi
+  802852:	bf 10 00 00 00       	mov    $0x10,%edi
+  802857:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  80285e:	00 00 00 
+  802861:	ff d0                	call   *%rax
+  802863:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+
+0000000000802869 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802869:	55                   	push   %rbp
+  80286a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80286d:	48 83 ec 08          	sub    $0x8,%rsp
+  802871:	6a 00                	push   $0x0
+  802873:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802879:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80287f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802884:	ba 00 00 00 00       	mov    $0x0,%edx
+  802889:	be 00 00 00 00       	mov    $0x0,%esi
+  80288e:	bf 11 00 00 00       	mov    $0x11,%edi
+  802893:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  80289a:	00 00 00 
+  80289d:	ff d0                	call   *%rax
+  80289f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a3:	c9                   	leave
+  8028a4:	c3                   	ret
+
+00000000008028a5 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8028b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c1:	6a 00                	push   $0x0
+  8028c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028cf:	48 89 d1             	mov    %rdx,%rcx
+  8028d2:	48 89 c2             	mov    %rax,%rdx
+  8028d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028da:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028df:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+  8028eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ef:	c9                   	leave
+  8028f0:	c3                   	ret
+
+00000000008028f1 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8028f1:	55                   	push   %rbp
+  8028f2:	48 89 e5             	mov    %rsp,%rbp
+  8028f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8028f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802901:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802904:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802907:	48 63 c8             	movslq %eax,%rcx
+  80290a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80290e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802912:	48 83 ec 08          	sub    $0x8,%rsp
+  802916:	6a 00                	push   $0x0
+  802918:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291e:	49 89 c8             	mov    %rcx,%r8
+  802921:	48 89 d1             	mov    %rdx,%rcx
+  802924:	48 89 c2             	mov    %rax,%rdx
+  802927:	be 00 00 00 00       	mov    $0x0,%esi
+  80292c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802931:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+0000000000802943 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	48 83 ec 20          	sub    $0x20,%rsp
+  80294b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80294f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802952:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802956:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80295a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80295d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802961:	48 83 ec 08          	sub    $0x8,%rsp
+  802965:	6a 00                	push   $0x0
+  802967:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80296d:	49 89 c8             	mov    %rcx,%r8
+  802970:	48 89 d1             	mov    %rdx,%rcx
+  802973:	48 89 c2             	mov    %rax,%rdx
+  802976:	be 00 00 00 00       	mov    $0x0,%esi
+  80297b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802980:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802987:	00 00 00 
+  80298a:	ff d0                	call   *%rax
+  80298c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802990:	c9                   	leave
+  802991:	c3                   	ret
+
+0000000000802992 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802992:	55                   	push   %rbp
+  802993:	48 89 e5             	mov    %rsp,%rbp
+  802996:	48 83 ec 10          	sub    $0x10,%rsp
+  80299a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80299e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8029a1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029a4:	48 63 d0             	movslq %eax,%rdx
+  8029a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8029af:	6a 00                	push   $0x0
+  8029b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029bd:	48 89 d1             	mov    %rdx,%rcx
+  8029c0:	48 89 c2             	mov    %rax,%rdx
+  8029c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c8:	bf 15 00 00 00       	mov    $0x15,%edi
+  8029cd:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  8029d4:	00 00 00 
+  8029d7:	ff d0                	call   *%rax
+  8029d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029dd:	c9                   	leave
+  8029de:	c3                   	ret
+
+00000000008029df <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8029df:	55                   	push   %rbp
+  8029e0:	48 89 e5             	mov    %rsp,%rbp
+  8029e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8029e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029eb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8029ee:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8029f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8029f5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8029f9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8029fc:	48 63 c8             	movslq %eax,%rcx
+  8029ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a02:	48 63 d0             	movslq %eax,%rdx
+  802a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a09:	48 83 ec 08          	sub    $0x8,%rsp
+  802a0d:	6a 00                	push   $0x0
+  802a0f:	49 89 f1             	mov    %rsi,%r9
+  802a12:	49 89 c8             	mov    %rcx,%r8
+  802a15:	48 89 d1             	mov    %rdx,%rcx
+  802a18:	48 89 c2             	mov    %rax,%rdx
+  802a1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a20:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a25:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+  802a31:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a35:	c9                   	leave
+  802a36:	c3                   	ret
+
+0000000000802a37 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802a37:	55                   	push   %rbp
+  802a38:	48 89 e5             	mov    %rsp,%rbp
+  802a3b:	48 83 ec 30          	sub    $0x30,%rsp
+  802a3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a47:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a4b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802a4f:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802a53:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802a57:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802a5b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a5f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a67:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6b:	51                   	push   %rcx
+  802a6c:	49 89 f9             	mov    %rdi,%r9
+  802a6f:	49 89 f0             	mov    %rsi,%r8
+  802a72:	48 89 d1             	mov    %rdx,%rcx
+  802a75:	48 89 c2             	mov    %rax,%rdx
+  802a78:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802a82:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+  802a8e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a92:	c9                   	leave
+  802a93:	c3                   	ret
+
+0000000000802a94 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802a94:	55                   	push   %rbp
+  802a95:	48 89 e5             	mov    %rsp,%rbp
+  802a98:	48 83 ec 10          	sub    $0x10,%rsp
+  802a9c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802a9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aa2:	48 98                	cltq
+  802aa4:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ab0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ab6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802abb:	48 89 c2             	mov    %rax,%rdx
+  802abe:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac3:	bf 18 00 00 00       	mov    $0x18,%edi
+  802ac8:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802acf:	00 00 00 
+  802ad2:	ff d0                	call   *%rax
+  802ad4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ad8:	90                   	nop
+  802ad9:	c9                   	leave
+  802ada:	c3                   	ret
+
+0000000000802adb <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802adb:	55                   	push   %rbp
+  802adc:	48 89 e5             	mov    %rsp,%rbp
+  802adf:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ae6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802aea:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802aee:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802af1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802af4:	48 63 f0             	movslq %eax,%rsi
+  802af7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802afb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802aff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b02:	48 98                	cltq
+  802b04:	48 83 ec 08          	sub    $0x8,%rsp
+  802b08:	6a 00                	push   $0x0
+  802b0a:	49 89 f1             	mov    %rsi,%r9
+  802b0d:	49 89 c8             	mov    %rcx,%r8
+  802b10:	48 89 d1             	mov    %rdx,%rcx
+  802b13:	48 89 c2             	mov    %rax,%rdx
+  802b16:	be 01 00 00 00       	mov    $0x1,%esi
+  802b1b:	bf 19 00 00 00       	mov    $0x19,%edi
+  802b20:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802b27:	00 00 00 
+  802b2a:	ff d0                	call   *%rax
+  802b2c:	48 83 c4 10          	add    $0x10,%rsp
+  802b30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+
+0000000000802b38 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802b38:	55                   	push   %rbp
+  802b39:	48 89 e5             	mov    %rsp,%rbp
+  802b3c:	48 83 ec 20          	sub    $0x20,%rsp
+  802b40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b44:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b48:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4e:	48 63 c8             	movslq %eax,%rcx
+  802b51:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b59:	48 83 ec 08          	sub    $0x8,%rsp
+  802b5d:	6a 00                	push   $0x0
+  802b5f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b65:	49 89 c8             	mov    %rcx,%r8
+  802b68:	48 89 d1             	mov    %rdx,%rcx
+  802b6b:	48 89 c2             	mov    %rax,%rdx
+  802b6e:	be 01 00 00 00       	mov    $0x1,%esi
+  802b73:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802b78:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+0000000000802b8a <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802b8a:	55                   	push   %rbp
+  802b8b:	48 89 e5             	mov    %rsp,%rbp
+  802b8e:	48 83 ec 20          	sub    $0x20,%rsp
+  802b92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b96:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b9a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802b9e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802ba2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802baa:	48 83 ec 08          	sub    $0x8,%rsp
+  802bae:	6a 00                	push   $0x0
+  802bb0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bb6:	49 89 c8             	mov    %rcx,%r8
+  802bb9:	48 89 d1             	mov    %rdx,%rcx
+  802bbc:	48 89 c2             	mov    %rax,%rdx
+  802bbf:	be 01 00 00 00       	mov    $0x1,%esi
+  802bc4:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802bc9:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+  802bd5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bd9:	c9                   	leave
+  802bda:	c3                   	ret
+
+0000000000802bdb <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802bdb:	55                   	push   %rbp
+  802bdc:	48 89 e5             	mov    %rsp,%rbp
+  802bdf:	48 83 ec 30          	sub    $0x30,%rsp
+  802be3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802be7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802beb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802bee:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802bf2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bf6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bf9:	48 63 c8             	movslq %eax,%rcx
+  802bfc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c04:	48 83 ec 08          	sub    $0x8,%rsp
+  802c08:	6a 00                	push   $0x0
+  802c0a:	49 89 f1             	mov    %rsi,%r9
+  802c0d:	49 89 c8             	mov    %rcx,%r8
+  802c10:	48 89 d1             	mov    %rdx,%rcx
+  802c13:	48 89 c2             	mov    %rax,%rdx
+  802c16:	be 01 00 00 00       	mov    $0x1,%esi
+  802c1b:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802c20:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802c27:	00 00 00 
+  802c2a:	ff d0                	call   *%rax
+  802c2c:	48 83 c4 10          	add    $0x10,%rsp
+  802c30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802c33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c36:	c9                   	leave
+  802c37:	c3                   	ret
+
+0000000000802c38 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802c38:	55                   	push   %rbp
+  802c39:	48 89 e5             	mov    %rsp,%rbp
+  802c3c:	48 83 ec 10          	sub    $0x10,%rsp
+  802c40:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802c43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c46:	48 98                	cltq
+  802c48:	48 83 ec 08          	sub    $0x8,%rsp
+  802c4c:	6a 00                	push   $0x0
+  802c4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c5f:	48 89 c2             	mov    %rax,%rdx
+  802c62:	be 01 00 00 00       	mov    $0x1,%esi
+  802c67:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802c6c:	48 b8 e7 22 80 00 00 	movabs $0x8022e7,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c7c:	c9                   	leave
+  802c7d:	c3                   	ret
+
+0000000000802c7e <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802c7e:	55                   	push   %rbp
+  802c7f:	48 89 e5             	mov    %rsp,%rbp
+  802c82:	48 83 ec 08          	sub    $0x8,%rsp
+  802c86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802c8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c8e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802c95:	ff ff ff 
+  802c98:	48 01 d0             	add    %rdx,%rax
+  802c9b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802c9f:	c9                   	leave
+  802ca0:	c3                   	ret
+
+0000000000802ca1 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802ca1:	55                   	push   %rbp
+  802ca2:	48 89 e5             	mov    %rsp,%rbp
+  802ca5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cb1:	48 89 c7             	mov    %rax,%rdi
+  802cb4:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  802cbb:	00 00 00 
+  802cbe:	ff d0                	call   *%rax
+  802cc0:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802cc6:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802cca:	c9                   	leave
+  802ccb:	c3                   	ret
+
+0000000000802ccc <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802ccc:	55                   	push   %rbp
+  802ccd:	48 89 e5             	mov    %rsp,%rbp
+  802cd0:	48 83 ec 18          	sub    $0x18,%rsp
+  802cd4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802cd8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802cdf:	e9 ae 00 00 00       	jmp    802d92 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802ce4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce7:	c1 e0 0c             	shl    $0xc,%eax
+  802cea:	48 98                	cltq
+  802cec:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802cf1:	48 01 d0             	add    %rdx,%rax
+  802cf4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802cf8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfc:	48 c1 e8 27          	shr    $0x27,%rax
+  802d00:	48 89 c2             	mov    %rax,%rdx
+  802d03:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d0a:	01 00 00 
+  802d0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d11:	83 e0 01             	and    $0x1,%eax
+  802d14:	48 85 c0             	test   %rax,%rax
+  802d17:	74 63                	je     802d7c <fd_alloc+0xb0>
+  802d19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d1d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d21:	48 89 c2             	mov    %rax,%rdx
+  802d24:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802d2b:	01 00 00 
+  802d2e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d32:	83 e0 01             	and    $0x1,%eax
+  802d35:	48 85 c0             	test   %rax,%rax
+  802d38:	74 42                	je     802d7c <fd_alloc+0xb0>
+  802d3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3e:	48 c1 e8 15          	shr    $0x15,%rax
+  802d42:	48 89 c2             	mov    %rax,%rdx
+  802d45:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802d4c:	01 00 00 
+  802d4f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d53:	83 e0 01             	and    $0x1,%eax
+  802d56:	48 85 c0             	test   %rax,%rax
+  802d59:	74 21                	je     802d7c <fd_alloc+0xb0>
+  802d5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d5f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d63:	48 89 c2             	mov    %rax,%rdx
+  802d66:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d6d:	01 00 00 
+  802d70:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d74:	83 e0 01             	and    $0x1,%eax
+  802d77:	48 85 c0             	test   %rax,%rax
+  802d7a:	75 12                	jne    802d8e <fd_alloc+0xc2>
+      *fd_store = fd;
+  802d7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d80:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802d84:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8c:	eb 1e                	jmp    802dac <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802d8e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d92:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802d96:	0f 8e 48 ff ff ff    	jle    802ce4 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802d9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802da0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802da7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802dac:	c9                   	leave
+  802dad:	c3                   	ret
+
+0000000000802dae <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+  802db2:	48 83 ec 20          	sub    $0x20,%rsp
+  802db6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802db9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802dbd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802dc1:	78 06                	js     802dc9 <fd_lookup+0x1b>
+  802dc3:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802dc7:	7e 0a                	jle    802dd3 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802dc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dce:	e9 af 00 00 00       	jmp    802e82 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802dd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dd6:	c1 e0 0c             	shl    $0xc,%eax
+  802dd9:	48 98                	cltq
+  802ddb:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802de0:	48 01 d0             	add    %rdx,%rax
+  802de3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802de7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802deb:	48 c1 e8 27          	shr    $0x27,%rax
+  802def:	48 89 c2             	mov    %rax,%rdx
+  802df2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802df9:	01 00 00 
+  802dfc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e00:	83 e0 01             	and    $0x1,%eax
+  802e03:	48 85 c0             	test   %rax,%rax
+  802e06:	74 63                	je     802e6b <fd_lookup+0xbd>
+  802e08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e0c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e10:	48 89 c2             	mov    %rax,%rdx
+  802e13:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802e1a:	01 00 00 
+  802e1d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e21:	83 e0 01             	and    $0x1,%eax
+  802e24:	48 85 c0             	test   %rax,%rax
+  802e27:	74 42                	je     802e6b <fd_lookup+0xbd>
+  802e29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e2d:	48 c1 e8 15          	shr    $0x15,%rax
+  802e31:	48 89 c2             	mov    %rax,%rdx
+  802e34:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802e3b:	01 00 00 
+  802e3e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e42:	83 e0 01             	and    $0x1,%eax
+  802e45:	48 85 c0             	test   %rax,%rax
+  802e48:	74 21                	je     802e6b <fd_lookup+0xbd>
+  802e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e4e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e52:	48 89 c2             	mov    %rax,%rdx
+  802e55:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e5c:	01 00 00 
+  802e5f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e63:	83 e0 01             	and    $0x1,%eax
+  802e66:	48 85 c0             	test   %rax,%rax
+  802e69:	75 07                	jne    802e72 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802e6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e70:	eb 10                	jmp    802e82 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802e72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e7a:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+0000000000802e84 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	48 83 ec 30          	sub    $0x30,%rsp
+  802e8c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802e90:	89 f0                	mov    %esi,%eax
+  802e92:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802e95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e99:	48 89 c7             	mov    %rax,%rdi
+  802e9c:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	89 c2                	mov    %eax,%edx
+  802eaa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802eae:	48 89 c6             	mov    %rax,%rsi
+  802eb1:	89 d7                	mov    %edx,%edi
+  802eb3:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+  802ebf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ec2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ec6:	78 0a                	js     802ed2 <fd_close+0x4e>
+  802ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ecc:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802ed0:	74 12                	je     802ee4 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802ed2:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802ed6:	74 05                	je     802edd <fd_close+0x59>
+  802ed8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802edb:	eb 70                	jmp    802f4d <fd_close+0xc9>
+  802edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee2:	eb 69                	jmp    802f4d <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ee4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ee8:	8b 00                	mov    (%rax),%eax
+  802eea:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802eee:	48 89 d6             	mov    %rdx,%rsi
+  802ef1:	89 c7                	mov    %eax,%edi
+  802ef3:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+  802eff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f02:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f06:	78 2a                	js     802f32 <fd_close+0xae>
+    if (dev->dev_close)
+  802f08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f0c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f10:	48 85 c0             	test   %rax,%rax
+  802f13:	74 16                	je     802f2b <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802f15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f19:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f21:	48 89 c7             	mov    %rax,%rdi
+  802f24:	ff d2                	call   *%rdx
+  802f26:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f29:	eb 07                	jmp    802f32 <fd_close+0xae>
+    else
+      r = 0;
+  802f2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f36:	48 89 c6             	mov    %rax,%rsi
+  802f39:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3e:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  802f45:	00 00 00 
+  802f48:	ff d0                	call   *%rax
+  return r;
+  802f4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f4d:	c9                   	leave
+  802f4e:	c3                   	ret
+
+0000000000802f4f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802f4f:	55                   	push   %rbp
+  802f50:	48 89 e5             	mov    %rsp,%rbp
+  802f53:	48 83 ec 20          	sub    $0x20,%rsp
+  802f57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f5a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802f5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f65:	eb 3f                	jmp    802fa6 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802f67:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802f6e:	00 00 00 
+  802f71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f74:	48 98                	cltq
+  802f76:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f7a:	8b 00                	mov    (%rax),%eax
+  802f7c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802f7f:	75 21                	jne    802fa2 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802f81:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802f88:	00 00 00 
+  802f8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f8e:	48 98                	cltq
+  802f90:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802f94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f98:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa0:	eb 7f                	jmp    803021 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802fa2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802fa6:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  802fad:	00 00 00 
+  802fb0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fb3:	48 98                	cltq
+  802fb5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802fb9:	48 85 c0             	test   %rax,%rax
+  802fbc:	75 a9                	jne    802f67 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802fbe:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802fc5:	00 00 00 
+  802fc8:	8b 40 04             	mov    0x4(%rax),%eax
+  802fcb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fd0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802fd7:	00 00 00 
+  802fda:	48 98                	cltq
+  802fdc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802fe3:	48 01 d0             	add    %rdx,%rax
+  802fe6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802fec:	8b 00                	mov    (%rax),%eax
+  802fee:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ff1:	89 c6                	mov    %eax,%esi
+  802ff3:	48 b8 38 71 80 00 00 	movabs $0x807138,%rax
+  802ffa:	00 00 00 
+  802ffd:	48 89 c7             	mov    %rax,%rdi
+  803000:	b8 00 00 00 00       	mov    $0x0,%eax
+  803005:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  80300c:	00 00 00 
+  80300f:	ff d1                	call   *%rcx
+  *dev = 0;
+  803011:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803015:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80301c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803021:	c9                   	leave
+  803022:	c3                   	ret
+
+0000000000803023 <close>:
+
+int
+close(int fdnum) {
+  803023:	55                   	push   %rbp
+  803024:	48 89 e5             	mov    %rsp,%rbp
+  803027:	48 83 ec 20          	sub    $0x20,%rsp
+  80302b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80302e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803032:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803035:	48 89 d6             	mov    %rdx,%rsi
+  803038:	89 c7                	mov    %eax,%edi
+  80303a:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803041:	00 00 00 
+  803044:	ff d0                	call   *%rax
+  803046:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803049:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80304d:	79 05                	jns    803054 <close+0x31>
+    return r;
+  80304f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803052:	eb 18                	jmp    80306c <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803054:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803058:	be 01 00 00 00       	mov    $0x1,%esi
+  80305d:	48 89 c7             	mov    %rax,%rdi
+  803060:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  803067:	00 00 00 
+  80306a:	ff d0                	call   *%rax
+}
+  80306c:	c9                   	leave
+  80306d:	c3                   	ret
+
+000000000080306e <close_all>:
+
+void
+close_all(void) {
+  80306e:	55                   	push   %rbp
+  80306f:	48 89 e5             	mov    %rsp,%rbp
+  803072:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803076:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80307d:	eb 15                	jmp    803094 <close_all+0x26>
+    close(i);
+  80307f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803082:	89 c7                	mov    %eax,%edi
+  803084:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803090:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803094:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803098:	7e e5                	jle    80307f <close_all+0x11>
+}
+  80309a:	90                   	nop
+  80309b:	90                   	nop
+  80309c:	c9                   	leave
+  80309d:	c3                   	ret
+
+000000000080309e <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  80309e:	55                   	push   %rbp
+  80309f:	48 89 e5             	mov    %rsp,%rbp
+  8030a2:	48 83 ec 40          	sub    $0x40,%rsp
+  8030a6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030a9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8030ac:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8030b0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030b3:	48 89 d6             	mov    %rdx,%rsi
+  8030b6:	89 c7                	mov    %eax,%edi
+  8030b8:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8030bf:	00 00 00 
+  8030c2:	ff d0                	call   *%rax
+  8030c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030cb:	79 08                	jns    8030d5 <dup+0x37>
+    return r;
+  8030cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030d0:	e9 33 02 00 00       	jmp    803308 <dup+0x26a>
+  close(newfdnum);
+  8030d5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8030d8:	89 c7                	mov    %eax,%edi
+  8030da:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8030e6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8030e9:	c1 e0 0c             	shl    $0xc,%eax
+  8030ec:	48 98                	cltq
+  8030ee:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8030f3:	48 01 d0             	add    %rdx,%rax
+  8030f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8030fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030fe:	48 89 c7             	mov    %rax,%rdi
+  803101:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  803108:	00 00 00 
+  80310b:	ff d0                	call   *%rax
+  80310d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803111:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803115:	48 89 c7             	mov    %rax,%rdi
+  803118:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  80311f:	00 00 00 
+  803122:	ff d0                	call   *%rax
+  803124:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803128:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80312f:	00 
+  803130:	e9 19 01 00 00       	jmp    80324e <dup+0x1b0>
+    off -= PGSIZE;
+  803135:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80313c:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80313d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803141:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803145:	48 01 d0             	add    %rdx,%rax
+  803148:	48 c1 e8 27          	shr    $0x27,%rax
+  80314c:	48 89 c2             	mov    %rax,%rdx
+  80314f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803156:	01 00 00 
+  803159:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80315d:	83 e0 01             	and    $0x1,%eax
+  803160:	48 85 c0             	test   %rax,%rax
+  803163:	0f 84 e5 00 00 00    	je     80324e <dup+0x1b0>
+  803169:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80316d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803171:	48 01 d0             	add    %rdx,%rax
+  803174:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803178:	48 89 c2             	mov    %rax,%rdx
+  80317b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803182:	01 00 00 
+  803185:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803189:	83 e0 01             	and    $0x1,%eax
+  80318c:	48 85 c0             	test   %rax,%rax
+  80318f:	0f 84 b9 00 00 00    	je     80324e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803195:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803199:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80319d:	48 01 d0             	add    %rdx,%rax
+  8031a0:	48 c1 e8 15          	shr    $0x15,%rax
+  8031a4:	48 89 c2             	mov    %rax,%rdx
+  8031a7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8031ae:	01 00 00 
+  8031b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031b5:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8031b8:	48 85 c0             	test   %rax,%rax
+  8031bb:	0f 84 8d 00 00 00    	je     80324e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8031c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8031c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c9:	48 01 d0             	add    %rdx,%rax
+  8031cc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031d0:	48 89 c2             	mov    %rax,%rdx
+  8031d3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8031da:	01 00 00 
+  8031dd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e1:	83 e0 01             	and    $0x1,%eax
+  8031e4:	48 85 c0             	test   %rax,%rax
+  8031e7:	74 65                	je     80324e <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8031e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8031ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031f1:	48 01 d0             	add    %rdx,%rax
+  8031f4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031f8:	48 89 c2             	mov    %rax,%rdx
+  8031fb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803202:	01 00 00 
+  803205:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803209:	25 07 0e 00 00       	and    $0xe07,%eax
+  80320e:	89 c6                	mov    %eax,%esi
+  803210:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803214:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803218:	48 01 c2             	add    %rax,%rdx
+  80321b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80321f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803223:	48 01 c8             	add    %rcx,%rax
+  803226:	41 89 f0             	mov    %esi,%r8d
+  803229:	48 89 d1             	mov    %rdx,%rcx
+  80322c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803231:	48 89 c6             	mov    %rax,%rsi
+  803234:	bf 00 00 00 00       	mov    $0x0,%edi
+  803239:	48 b8 ef 25 80 00 00 	movabs $0x8025ef,%rax
+  803240:	00 00 00 
+  803243:	ff d0                	call   *%rax
+  803245:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803248:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80324c:	78 60                	js     8032ae <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80324e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803253:	0f 85 dc fe ff ff    	jne    803135 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803259:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80325d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803261:	48 89 c2             	mov    %rax,%rdx
+  803264:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80326b:	01 00 00 
+  80326e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803272:	25 07 0e 00 00       	and    $0xe07,%eax
+  803277:	89 c1                	mov    %eax,%ecx
+  803279:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80327d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803281:	41 89 c8             	mov    %ecx,%r8d
+  803284:	48 89 d1             	mov    %rdx,%rcx
+  803287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328c:	48 89 c6             	mov    %rax,%rsi
+  80328f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803294:	48 b8 ef 25 80 00 00 	movabs $0x8025ef,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032a7:	78 08                	js     8032b1 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8032a9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8032ac:	eb 5a                	jmp    803308 <dup+0x26a>
+        goto err;
+  8032ae:	90                   	nop
+  8032af:	eb 01                	jmp    8032b2 <dup+0x214>
+    goto err;
+  8032b1:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8032b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032b6:	48 89 c6             	mov    %rax,%rsi
+  8032b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032be:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  8032c5:	00 00 00 
+  8032c8:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8032ca:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8032d1:	00 
+  8032d2:	eb 27                	jmp    8032fb <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8032d4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032dc:	48 01 d0             	add    %rdx,%rax
+  8032df:	48 89 c6             	mov    %rax,%rsi
+  8032e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e7:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  8032ee:	00 00 00 
+  8032f1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8032f3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8032fa:	00 
+  8032fb:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803302:	00 
+  803303:	76 cf                	jbe    8032d4 <dup+0x236>
+  return r;
+  803305:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803308:	c9                   	leave
+  803309:	c3                   	ret
+
+000000000080330a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+  80330e:	48 83 ec 40          	sub    $0x40,%rsp
+  803312:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803315:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803319:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80331d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803321:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803324:	48 89 d6             	mov    %rdx,%rsi
+  803327:	89 c7                	mov    %eax,%edi
+  803329:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803330:	00 00 00 
+  803333:	ff d0                	call   *%rax
+  803335:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803338:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80333c:	78 24                	js     803362 <read+0x58>
+  80333e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803342:	8b 00                	mov    (%rax),%eax
+  803344:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803348:	48 89 d6             	mov    %rdx,%rsi
+  80334b:	89 c7                	mov    %eax,%edi
+  80334d:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  803354:	00 00 00 
+  803357:	ff d0                	call   *%rax
+  803359:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80335c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803360:	79 0a                	jns    80336c <read+0x62>
+    return r;
+  803362:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803365:	48 98                	cltq
+  803367:	e9 9e 00 00 00       	jmp    80340a <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80336c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803370:	8b 40 08             	mov    0x8(%rax),%eax
+  803373:	83 e0 03             	and    $0x3,%eax
+  803376:	83 f8 01             	cmp    $0x1,%eax
+  803379:	75 5c                	jne    8033d7 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80337b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803382:	00 00 00 
+  803385:	8b 40 04             	mov    0x4(%rax),%eax
+  803388:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80338d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803394:	00 00 00 
+  803397:	48 98                	cltq
+  803399:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033a0:	48 01 d0             	add    %rdx,%rax
+  8033a3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033a9:	8b 00                	mov    (%rax),%eax
+  8033ab:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033ae:	89 c6                	mov    %eax,%esi
+  8033b0:	48 b8 57 71 80 00 00 	movabs $0x807157,%rax
+  8033b7:	00 00 00 
+  8033ba:	48 89 c7             	mov    %rax,%rdi
+  8033bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c2:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  8033c9:	00 00 00 
+  8033cc:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8033ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033d5:	eb 33                	jmp    80340a <read+0x100>
+  }
+  if (!dev->dev_read)
+  8033d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033db:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033df:	48 85 c0             	test   %rax,%rax
+  8033e2:	75 09                	jne    8033ed <read+0xe3>
+    return -E_NOT_SUPP;
+  8033e4:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8033eb:	eb 1d                	jmp    80340a <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8033ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033f1:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8033f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033fd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803401:	48 89 ce             	mov    %rcx,%rsi
+  803404:	48 89 c7             	mov    %rax,%rdi
+  803407:	41 ff d0             	call   *%r8
+}
+  80340a:	c9                   	leave
+  80340b:	c3                   	ret
+
+000000000080340c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80340c:	55                   	push   %rbp
+  80340d:	48 89 e5             	mov    %rsp,%rbp
+  803410:	48 83 ec 30          	sub    $0x30,%rsp
+  803414:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803417:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80341b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80341f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803426:	eb 49                	jmp    803471 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803428:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80342b:	48 98                	cltq
+  80342d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803431:	48 29 c2             	sub    %rax,%rdx
+  803434:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803437:	48 63 c8             	movslq %eax,%rcx
+  80343a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80343e:	48 01 c1             	add    %rax,%rcx
+  803441:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803444:	48 89 ce             	mov    %rcx,%rsi
+  803447:	89 c7                	mov    %eax,%edi
+  803449:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+  803455:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803458:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80345c:	79 07                	jns    803465 <readn+0x59>
+      return m;
+  80345e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803461:	48 98                	cltq
+  803463:	eb 1f                	jmp    803484 <readn+0x78>
+    if (m == 0)
+  803465:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803469:	74 13                	je     80347e <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80346b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80346e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803471:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803474:	48 98                	cltq
+  803476:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80347a:	72 ac                	jb     803428 <readn+0x1c>
+  80347c:	eb 01                	jmp    80347f <readn+0x73>
+      break;
+  80347e:	90                   	nop
+  }
+  return tot;
+  80347f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803482:	48 98                	cltq
+}
+  803484:	c9                   	leave
+  803485:	c3                   	ret
+
+0000000000803486 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803486:	55                   	push   %rbp
+  803487:	48 89 e5             	mov    %rsp,%rbp
+  80348a:	48 83 ec 40          	sub    $0x40,%rsp
+  80348e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803491:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803495:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803499:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80349d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034a0:	48 89 d6             	mov    %rdx,%rsi
+  8034a3:	89 c7                	mov    %eax,%edi
+  8034a5:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+  8034b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034b8:	78 24                	js     8034de <write+0x58>
+  8034ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034be:	8b 00                	mov    (%rax),%eax
+  8034c0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8034c4:	48 89 d6             	mov    %rdx,%rsi
+  8034c7:	89 c7                	mov    %eax,%edi
+  8034c9:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  8034d0:	00 00 00 
+  8034d3:	ff d0                	call   *%rax
+  8034d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034dc:	79 0a                	jns    8034e8 <write+0x62>
+    return r;
+  8034de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034e1:	48 98                	cltq
+  8034e3:	e9 9d 00 00 00       	jmp    803585 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ec:	8b 40 08             	mov    0x8(%rax),%eax
+  8034ef:	83 e0 03             	and    $0x3,%eax
+  8034f2:	85 c0                	test   %eax,%eax
+  8034f4:	75 5c                	jne    803552 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034f6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8034fd:	00 00 00 
+  803500:	8b 40 04             	mov    0x4(%rax),%eax
+  803503:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803508:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80350f:	00 00 00 
+  803512:	48 98                	cltq
+  803514:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80351b:	48 01 d0             	add    %rdx,%rax
+  80351e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803524:	8b 00                	mov    (%rax),%eax
+  803526:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803529:	89 c6                	mov    %eax,%esi
+  80352b:	48 b8 73 71 80 00 00 	movabs $0x807173,%rax
+  803532:	00 00 00 
+  803535:	48 89 c7             	mov    %rax,%rdi
+  803538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353d:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  803544:	00 00 00 
+  803547:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803549:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803550:	eb 33                	jmp    803585 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803552:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803556:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80355a:	48 85 c0             	test   %rax,%rax
+  80355d:	75 09                	jne    803568 <write+0xe2>
+    return -E_NOT_SUPP;
+  80355f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803566:	eb 1d                	jmp    803585 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803568:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80356c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803574:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803578:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80357c:	48 89 ce             	mov    %rcx,%rsi
+  80357f:	48 89 c7             	mov    %rax,%rdi
+  803582:	41 ff d0             	call   *%r8
+}
+  803585:	c9                   	leave
+  803586:	c3                   	ret
+
+0000000000803587 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803587:	55                   	push   %rbp
+  803588:	48 89 e5             	mov    %rsp,%rbp
+  80358b:	48 83 ec 18          	sub    $0x18,%rsp
+  80358f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803592:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803595:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803599:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80359c:	48 89 d6             	mov    %rdx,%rsi
+  80359f:	89 c7                	mov    %eax,%edi
+  8035a1:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8035a8:	00 00 00 
+  8035ab:	ff d0                	call   *%rax
+  8035ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035b4:	79 05                	jns    8035bb <seek+0x34>
+    return r;
+  8035b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035b9:	eb 0f                	jmp    8035ca <seek+0x43>
+  fd->fd_offset = offset;
+  8035bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035bf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8035c2:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8035c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ca:	c9                   	leave
+  8035cb:	c3                   	ret
+
+00000000008035cc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8035cc:	55                   	push   %rbp
+  8035cd:	48 89 e5             	mov    %rsp,%rbp
+  8035d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8035d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8035d7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8035da:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8035de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035e1:	48 89 d6             	mov    %rdx,%rsi
+  8035e4:	89 c7                	mov    %eax,%edi
+  8035e6:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+  8035f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035f9:	78 24                	js     80361f <ftruncate+0x53>
+  8035fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035ff:	8b 00                	mov    (%rax),%eax
+  803601:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803605:	48 89 d6             	mov    %rdx,%rsi
+  803608:	89 c7                	mov    %eax,%edi
+  80360a:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  803611:	00 00 00 
+  803614:	ff d0                	call   *%rax
+  803616:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803619:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80361d:	79 08                	jns    803627 <ftruncate+0x5b>
+    return r;
+  80361f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803622:	e9 92 00 00 00       	jmp    8036b9 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803627:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80362b:	8b 40 08             	mov    0x8(%rax),%eax
+  80362e:	83 e0 03             	and    $0x3,%eax
+  803631:	85 c0                	test   %eax,%eax
+  803633:	75 5a                	jne    80368f <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803635:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80363c:	00 00 00 
+  80363f:	8b 40 04             	mov    0x4(%rax),%eax
+  803642:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803647:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80364e:	00 00 00 
+  803651:	48 98                	cltq
+  803653:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80365a:	48 01 d0             	add    %rdx,%rax
+  80365d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803663:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803665:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803668:	89 c6                	mov    %eax,%esi
+  80366a:	48 b8 90 71 80 00 00 	movabs $0x807190,%rax
+  803671:	00 00 00 
+  803674:	48 89 c7             	mov    %rax,%rdi
+  803677:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367c:	48 b9 19 08 80 00 00 	movabs $0x800819,%rcx
+  803683:	00 00 00 
+  803686:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803688:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80368d:	eb 2a                	jmp    8036b9 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80368f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803693:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803697:	48 85 c0             	test   %rax,%rax
+  80369a:	75 07                	jne    8036a3 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80369c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8036a1:	eb 16                	jmp    8036b9 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8036a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036a7:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8036ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036af:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8036b2:	89 d6                	mov    %edx,%esi
+  8036b4:	48 89 c7             	mov    %rax,%rdi
+  8036b7:	ff d1                	call   *%rcx
+}
+  8036b9:	c9                   	leave
+  8036ba:	c3                   	ret
+
+00000000008036bb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8036bb:	55                   	push   %rbp
+  8036bc:	48 89 e5             	mov    %rsp,%rbp
+  8036bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8036c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8036ca:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8036ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036d1:	48 89 d6             	mov    %rdx,%rsi
+  8036d4:	89 c7                	mov    %eax,%edi
+  8036d6:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  8036dd:	00 00 00 
+  8036e0:	ff d0                	call   *%rax
+  8036e2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036e5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036e9:	78 24                	js     80370f <fstat+0x54>
+  8036eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ef:	8b 00                	mov    (%rax),%eax
+  8036f1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8036f5:	48 89 d6             	mov    %rdx,%rsi
+  8036f8:	89 c7                	mov    %eax,%edi
+  8036fa:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803709:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80370d:	79 05                	jns    803714 <fstat+0x59>
+    return r;
+  80370f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803712:	eb 5e                	jmp    803772 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803714:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803718:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80371c:	48 85 c0             	test   %rax,%rax
+  80371f:	75 07                	jne    803728 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803721:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803726:	eb 4a                	jmp    803772 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803728:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80372c:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80372f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803733:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80373a:	00 00 00 
+  stat->st_isdir   = 0;
+  80373d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803741:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803748:	00 00 00 
+  stat->st_dev     = dev;
+  80374b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80374f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803753:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80375a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80375e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803766:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80376a:	48 89 d6             	mov    %rdx,%rsi
+  80376d:	48 89 c7             	mov    %rax,%rdi
+  803770:	ff d1                	call   *%rcx
+}
+  803772:	c9                   	leave
+  803773:	c3                   	ret
+
+0000000000803774 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803774:	55                   	push   %rbp
+  803775:	48 89 e5             	mov    %rsp,%rbp
+  803778:	48 83 ec 10          	sub    $0x10,%rsp
+  80377c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803780:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803788:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80378e:	83 f8 20             	cmp    $0x20,%eax
+  803791:	75 07                	jne    80379a <pollwait_key+0x26>
+    return -E_INVAL;
+  803793:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803798:	eb 5f                	jmp    8037f9 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80379a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80379e:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8037a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037a8:	48 63 d2             	movslq %edx,%rdx
+  8037ab:	48 c1 e2 04          	shl    $0x4,%rdx
+  8037af:	48 01 c2             	add    %rax,%rdx
+  8037b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037b6:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8037b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037bd:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8037c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c7:	8b 00                	mov    (%rax),%eax
+  8037c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037cd:	48 63 c9             	movslq %ecx,%rcx
+  8037d0:	48 c1 e1 04          	shl    $0x4,%rcx
+  8037d4:	48 01 ca             	add    %rcx,%rdx
+  8037d7:	48 83 c2 08          	add    $0x8,%rdx
+  8037db:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8037dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037e1:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8037e7:	8d 50 01             	lea    0x1(%rax),%edx
+  8037ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ee:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8037f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f9:	c9                   	leave
+  8037fa:	c3                   	ret
+
+00000000008037fb <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8037fb:	55                   	push   %rbp
+  8037fc:	48 89 e5             	mov    %rsp,%rbp
+  8037ff:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803806:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80380d:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803813:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80381a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803821:	00 
+  int i, r, ready, ipc = 0;
+  803822:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803829:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803830:	00 
+  803831:	74 45                	je     803878 <poll+0x7d>
+  803833:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80383a:	ff 
+  80383b:	74 3b                	je     803878 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80383d:	48 b8 6b 5d 80 00 00 	movabs $0x805d6b,%rax
+  803844:	00 00 00 
+  803847:	ff d0                	call   *%rax
+  803849:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80384d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803851:	48 f7 d0             	not    %rax
+  803854:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80385b:	73 10                	jae    80386d <poll+0x72>
+  80385d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803861:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803868:	48 01 d0             	add    %rdx,%rax
+  80386b:	eb 07                	jmp    803874 <poll+0x79>
+  80386d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803874:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803878:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80387f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803886:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80388d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803894:	e9 46 02 00 00       	jmp    803adf <poll+0x2e4>
+      fds[i].revents = 0;
+  803899:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80389c:	48 63 d0             	movslq %eax,%rdx
+  80389f:	48 89 d0             	mov    %rdx,%rax
+  8038a2:	48 01 c0             	add    %rax,%rax
+  8038a5:	48 01 d0             	add    %rdx,%rax
+  8038a8:	48 c1 e0 02          	shl    $0x2,%rax
+  8038ac:	48 89 c2             	mov    %rax,%rdx
+  8038af:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038b6:	48 01 d0             	add    %rdx,%rax
+  8038b9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8038c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038c3:	48 63 d0             	movslq %eax,%rdx
+  8038c6:	48 89 d0             	mov    %rdx,%rax
+  8038c9:	48 01 c0             	add    %rax,%rax
+  8038cc:	48 01 d0             	add    %rdx,%rax
+  8038cf:	48 c1 e0 02          	shl    $0x2,%rax
+  8038d3:	48 89 c2             	mov    %rax,%rdx
+  8038d6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038dd:	48 01 d0             	add    %rdx,%rax
+  8038e0:	8b 00                	mov    (%rax),%eax
+  8038e2:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8038e5:	75 62                	jne    803949 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8038e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038ea:	48 63 d0             	movslq %eax,%rdx
+  8038ed:	48 89 d0             	mov    %rdx,%rax
+  8038f0:	48 01 c0             	add    %rax,%rax
+  8038f3:	48 01 d0             	add    %rdx,%rax
+  8038f6:	48 c1 e0 02          	shl    $0x2,%rax
+  8038fa:	48 89 c2             	mov    %rax,%rdx
+  8038fd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803904:	48 01 d0             	add    %rdx,%rax
+  803907:	8b 40 04             	mov    0x4(%rax),%eax
+  80390a:	83 e0 01             	and    $0x1,%eax
+  80390d:	85 c0                	test   %eax,%eax
+  80390f:	0f 84 9b 01 00 00    	je     803ab0 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803915:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803918:	48 63 d0             	movslq %eax,%rdx
+  80391b:	48 89 d0             	mov    %rdx,%rax
+  80391e:	48 01 c0             	add    %rax,%rax
+  803921:	48 01 d0             	add    %rdx,%rax
+  803924:	48 c1 e0 02          	shl    $0x2,%rax
+  803928:	48 89 c2             	mov    %rax,%rdx
+  80392b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803932:	48 01 c2             	add    %rax,%rdx
+  803935:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803938:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80393b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80393e:	83 c8 04             	or     $0x4,%eax
+  803941:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803944:	e9 67 01 00 00       	jmp    803ab0 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803949:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80394c:	48 63 d0             	movslq %eax,%rdx
+  80394f:	48 89 d0             	mov    %rdx,%rax
+  803952:	48 01 c0             	add    %rax,%rax
+  803955:	48 01 d0             	add    %rdx,%rax
+  803958:	48 c1 e0 02          	shl    $0x2,%rax
+  80395c:	48 89 c2             	mov    %rax,%rdx
+  80395f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803966:	48 01 d0             	add    %rdx,%rax
+  803969:	8b 00                	mov    (%rax),%eax
+  80396b:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803972:	48 89 d6             	mov    %rdx,%rsi
+  803975:	89 c7                	mov    %eax,%edi
+  803977:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  80397e:	00 00 00 
+  803981:	ff d0                	call   *%rax
+  803983:	85 c0                	test   %eax,%eax
+  803985:	78 25                	js     8039ac <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803987:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80398e:	8b 00                	mov    (%rax),%eax
+  803990:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803997:	48 89 d6             	mov    %rdx,%rsi
+  80399a:	89 c7                	mov    %eax,%edi
+  80399c:	48 b8 4f 2f 80 00 00 	movabs $0x802f4f,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8039a8:	85 c0                	test   %eax,%eax
+  8039aa:	79 2c                	jns    8039d8 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8039ac:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039af:	48 63 d0             	movslq %eax,%rdx
+  8039b2:	48 89 d0             	mov    %rdx,%rax
+  8039b5:	48 01 c0             	add    %rax,%rax
+  8039b8:	48 01 d0             	add    %rdx,%rax
+  8039bb:	48 c1 e0 02          	shl    $0x2,%rax
+  8039bf:	48 89 c2             	mov    %rax,%rdx
+  8039c2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8039c9:	48 01 d0             	add    %rdx,%rax
+  8039cc:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8039d3:	e9 d8 00 00 00       	jmp    803ab0 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8039d8:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8039df:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8039e3:	48 85 c0             	test   %rax,%rax
+  8039e6:	74 7d                	je     803a65 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8039e8:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8039ef:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8039f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039f6:	48 63 d0             	movslq %eax,%rdx
+  8039f9:	48 89 d0             	mov    %rdx,%rax
+  8039fc:	48 01 c0             	add    %rax,%rax
+  8039ff:	48 01 d0             	add    %rdx,%rax
+  803a02:	48 c1 e0 02          	shl    $0x2,%rax
+  803a06:	48 89 c2             	mov    %rax,%rdx
+  803a09:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803a10:	48 01 d0             	add    %rdx,%rax
+  803a13:	8b 48 04             	mov    0x4(%rax),%ecx
+  803a16:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803a1d:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803a24:	89 ce                	mov    %ecx,%esi
+  803a26:	48 89 c7             	mov    %rax,%rdi
+  803a29:	41 ff d0             	call   *%r8
+  803a2c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803a2f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a33:	79 08                	jns    803a3d <poll+0x242>
+          return r;
+  803a35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a38:	e9 45 01 00 00       	jmp    803b82 <poll+0x387>
+        fds[i].revents = r;
+  803a3d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a40:	48 63 d0             	movslq %eax,%rdx
+  803a43:	48 89 d0             	mov    %rdx,%rax
+  803a46:	48 01 c0             	add    %rax,%rax
+  803a49:	48 01 d0             	add    %rdx,%rax
+  803a4c:	48 c1 e0 02          	shl    $0x2,%rax
+  803a50:	48 89 c2             	mov    %rax,%rdx
+  803a53:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803a5a:	48 01 c2             	add    %rax,%rdx
+  803a5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a60:	89 42 08             	mov    %eax,0x8(%rdx)
+  803a63:	eb 4b                	jmp    803ab0 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803a65:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a68:	48 63 d0             	movslq %eax,%rdx
+  803a6b:	48 89 d0             	mov    %rdx,%rax
+  803a6e:	48 01 c0             	add    %rax,%rax
+  803a71:	48 01 d0             	add    %rdx,%rax
+  803a74:	48 c1 e0 02          	shl    $0x2,%rax
+  803a78:	48 89 c2             	mov    %rax,%rdx
+  803a7b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803a82:	48 01 d0             	add    %rdx,%rax
+  803a85:	8b 48 04             	mov    0x4(%rax),%ecx
+  803a88:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a8b:	48 63 d0             	movslq %eax,%rdx
+  803a8e:	48 89 d0             	mov    %rdx,%rax
+  803a91:	48 01 c0             	add    %rax,%rax
+  803a94:	48 01 d0             	add    %rdx,%rax
+  803a97:	48 c1 e0 02          	shl    $0x2,%rax
+  803a9b:	48 89 c2             	mov    %rax,%rdx
+  803a9e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803aa5:	48 01 d0             	add    %rdx,%rax
+  803aa8:	83 e1 03             	and    $0x3,%ecx
+  803aab:	89 ca                	mov    %ecx,%edx
+  803aad:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803ab0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ab3:	48 63 d0             	movslq %eax,%rdx
+  803ab6:	48 89 d0             	mov    %rdx,%rax
+  803ab9:	48 01 c0             	add    %rax,%rax
+  803abc:	48 01 d0             	add    %rdx,%rax
+  803abf:	48 c1 e0 02          	shl    $0x2,%rax
+  803ac3:	48 89 c2             	mov    %rax,%rdx
+  803ac6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803acd:	48 01 d0             	add    %rdx,%rax
+  803ad0:	8b 40 08             	mov    0x8(%rax),%eax
+  803ad3:	85 c0                	test   %eax,%eax
+  803ad5:	74 04                	je     803adb <poll+0x2e0>
+        ready++;
+  803ad7:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803adb:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803adf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ae2:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803ae8:	0f 8c ab fd ff ff    	jl     803899 <poll+0x9e>
+    }
+    if (ready)
+  803aee:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803af2:	74 08                	je     803afc <poll+0x301>
+      return ready;
+  803af4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803af7:	e9 86 00 00 00       	jmp    803b82 <poll+0x387>
+
+    if (deadline) {
+  803afc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803b01:	74 30                	je     803b33 <poll+0x338>
+      now     = vsys_clock_ns();
+  803b03:	48 b8 6b 5d 80 00 00 	movabs $0x805d6b,%rax
+  803b0a:	00 00 00 
+  803b0d:	ff d0                	call   *%rax
+  803b0f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803b13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b17:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803b1b:	73 0a                	jae    803b27 <poll+0x32c>
+  803b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b21:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803b25:	eb 05                	jmp    803b2c <poll+0x331>
+  803b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2c:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803b33:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803b36:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803b39:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803b40:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803b47:	48 89 c7             	mov    %rax,%rdi
+  803b4a:	48 b8 df 29 80 00 00 	movabs $0x8029df,%rax
+  803b51:	00 00 00 
+  803b54:	ff d0                	call   *%rax
+  803b56:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803b59:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803b5d:	75 07                	jne    803b66 <poll+0x36b>
+      return 0;
+  803b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b64:	eb 1c                	jmp    803b82 <poll+0x387>
+    if (r < 0)
+  803b66:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803b6a:	79 05                	jns    803b71 <poll+0x376>
+      return r;
+  803b6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b6f:	eb 11                	jmp    803b82 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803b71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b74:	c1 f8 02             	sar    $0x2,%eax
+  803b77:	83 e0 01             	and    $0x1,%eax
+  803b7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803b7d:	e9 f6 fc ff ff       	jmp    803878 <poll+0x7d>
+  }
+}
+  803b82:	c9                   	leave
+  803b83:	c3                   	ret
+
+0000000000803b84 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803b84:	55                   	push   %rbp
+  803b85:	48 89 e5             	mov    %rsp,%rbp
+  803b88:	48 83 ec 20          	sub    $0x20,%rsp
+  803b8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b90:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b98:	be 00 00 00 00       	mov    $0x0,%esi
+  803b9d:	48 89 c7             	mov    %rax,%rdi
+  803ba0:	48 b8 72 3c 80 00 00 	movabs $0x803c72,%rax
+  803ba7:	00 00 00 
+  803baa:	ff d0                	call   *%rax
+  803bac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803baf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bb3:	79 05                	jns    803bba <stat+0x36>
+    return fd;
+  803bb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bb8:	eb 2f                	jmp    803be9 <stat+0x65>
+  r = fstat(fd, stat);
+  803bba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803bbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bc1:	48 89 d6             	mov    %rdx,%rsi
+  803bc4:	89 c7                	mov    %eax,%edi
+  803bc6:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+  803bd2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803bd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bd8:	89 c7                	mov    %eax,%edi
+  803bda:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  803be1:	00 00 00 
+  803be4:	ff d0                	call   *%rax
+  return r;
+  803be6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803be9:	c9                   	leave
+  803bea:	c3                   	ret
+
+0000000000803beb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803beb:	55                   	push   %rbp
+  803bec:	48 89 e5             	mov    %rsp,%rbp
+  803bef:	48 83 ec 10          	sub    $0x10,%rsp
+  803bf3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803bf6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803bfa:	48 b8 00 20 81 00 00 	movabs $0x812000,%rax
+  803c01:	00 00 00 
+  803c04:	8b 00                	mov    (%rax),%eax
+  803c06:	85 c0                	test   %eax,%eax
+  803c08:	75 1d                	jne    803c27 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803c0a:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c0f:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  803c16:	00 00 00 
+  803c19:	ff d0                	call   *%rax
+  803c1b:	48 ba 00 20 81 00 00 	movabs $0x812000,%rdx
+  803c22:	00 00 00 
+  803c25:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803c27:	48 b8 00 20 81 00 00 	movabs $0x812000,%rax
+  803c2e:	00 00 00 
+  803c31:	8b 00                	mov    (%rax),%eax
+  803c33:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803c36:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c3b:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803c42:	00 00 00 
+  803c45:	89 c7                	mov    %eax,%edi
+  803c47:	48 b8 d9 62 80 00 00 	movabs $0x8062d9,%rax
+  803c4e:	00 00 00 
+  803c51:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803c53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c5c:	48 89 c6             	mov    %rax,%rsi
+  803c5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c64:	48 b8 5c 61 80 00 00 	movabs $0x80615c,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+}
+  803c70:	c9                   	leave
+  803c71:	c3                   	ret
+
+0000000000803c72 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803c72:	55                   	push   %rbp
+  803c73:	48 89 e5             	mov    %rsp,%rbp
+  803c76:	48 83 ec 20          	sub    $0x20,%rsp
+  803c7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c7e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803c81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c85:	48 89 c7             	mov    %rax,%rdi
+  803c88:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  803c8f:	00 00 00 
+  803c92:	ff d0                	call   *%rax
+  803c94:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803c99:	7e 0a                	jle    803ca5 <open+0x33>
+    return -E_BAD_PATH;
+  803c9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ca0:	e9 a8 00 00 00       	jmp    803d4d <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803ca5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803ca9:	48 89 c7             	mov    %rax,%rdi
+  803cac:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  803cb3:	00 00 00 
+  803cb6:	ff d0                	call   *%rax
+  803cb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cbf:	79 08                	jns    803cc9 <open+0x57>
+    return r;
+  803cc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cc4:	e9 84 00 00 00       	jmp    803d4d <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803cc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ccd:	48 89 c6             	mov    %rax,%rsi
+  803cd0:	48 b8 00 10 81 00 00 	movabs $0x811000,%rax
+  803cd7:	00 00 00 
+  803cda:	48 89 c7             	mov    %rax,%rdi
+  803cdd:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  803ce4:	00 00 00 
+  803ce7:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803ce9:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803cf0:	00 00 00 
+  803cf3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803cf6:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803cfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d00:	48 89 c6             	mov    %rax,%rsi
+  803d03:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d08:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803d0f:	00 00 00 
+  803d12:	ff d0                	call   *%rax
+  803d14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d1b:	79 1d                	jns    803d3a <open+0xc8>
+    fd_close(fd, 0);
+  803d1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d21:	be 00 00 00 00       	mov    $0x0,%esi
+  803d26:	48 89 c7             	mov    %rax,%rdi
+  803d29:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  803d30:	00 00 00 
+  803d33:	ff d0                	call   *%rax
+    return r;
+  803d35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d38:	eb 13                	jmp    803d4d <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803d3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d3e:	48 89 c7             	mov    %rax,%rdi
+  803d41:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  803d48:	00 00 00 
+  803d4b:	ff d0                	call   *%rax
+}
+  803d4d:	c9                   	leave
+  803d4e:	c3                   	ret
+
+0000000000803d4f <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803d4f:	55                   	push   %rbp
+  803d50:	48 89 e5             	mov    %rsp,%rbp
+  803d53:	48 83 ec 10          	sub    $0x10,%rsp
+  803d57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803d5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d5f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d62:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803d69:	00 00 00 
+  803d6c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803d6e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d73:	bf 06 00 00 00       	mov    $0x6,%edi
+  803d78:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803d7f:	00 00 00 
+  803d82:	ff d0                	call   *%rax
+}
+  803d84:	c9                   	leave
+  803d85:	c3                   	ret
+
+0000000000803d86 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803d86:	55                   	push   %rbp
+  803d87:	48 89 e5             	mov    %rsp,%rbp
+  803d8a:	48 83 ec 30          	sub    $0x30,%rsp
+  803d8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d92:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803d96:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803d9a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803d9f:	74 07                	je     803da8 <devfile_read+0x22>
+  803da1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803da6:	75 0a                	jne    803db2 <devfile_read+0x2c>
+  return E_INVAL;
+  803da8:	b8 03 00 00 00       	mov    $0x3,%eax
+  803dad:	e9 b4 00 00 00       	jmp    803e66 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803db2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803db9:	00 
+  while (n) {
+  803dba:	e9 98 00 00 00       	jmp    803e57 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803dbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dc3:	8b 40 0c             	mov    0xc(%rax),%eax
+  803dc6:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803dcd:	00 00 00 
+  803dd0:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803dd2:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803dd9:	00 00 00 
+  803ddc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803de0:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803de4:	be 00 00 00 00       	mov    $0x0,%esi
+  803de9:	bf 03 00 00 00       	mov    $0x3,%edi
+  803dee:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+  803dfa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803dfd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803e01:	7f 13                	jg     803e16 <devfile_read+0x90>
+      return res ? res : res0;
+  803e03:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803e07:	74 07                	je     803e10 <devfile_read+0x8a>
+  803e09:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e0c:	48 98                	cltq
+  803e0e:	eb 56                	jmp    803e66 <devfile_read+0xe0>
+  803e10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e14:	eb 50                	jmp    803e66 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803e16:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e19:	48 63 d0             	movslq %eax,%rdx
+  803e1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e20:	48 b9 00 10 81 00 00 	movabs $0x811000,%rcx
+  803e27:	00 00 00 
+  803e2a:	48 89 ce             	mov    %rcx,%rsi
+  803e2d:	48 89 c7             	mov    %rax,%rdi
+  803e30:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+
+    buf += res;
+  803e3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e3f:	48 98                	cltq
+  803e41:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803e45:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e48:	48 98                	cltq
+  803e4a:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803e4e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e51:	48 98                	cltq
+  803e53:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803e57:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803e5c:	0f 85 5d ff ff ff    	jne    803dbf <devfile_read+0x39>
+  }
+
+  return res0;
+  803e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803e66:	c9                   	leave
+  803e67:	c3                   	ret
+
+0000000000803e68 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e68:	55                   	push   %rbp
+  803e69:	48 89 e5             	mov    %rsp,%rbp
+  803e6c:	48 83 ec 50          	sub    $0x50,%rsp
+  803e70:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803e74:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e78:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803e7c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803e81:	74 07                	je     803e8a <devfile_write+0x22>
+  803e83:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803e88:	75 0a                	jne    803e94 <devfile_write+0x2c>
+  return E_INVAL;
+  803e8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  803e8f:	e9 c9 00 00 00       	jmp    803f5d <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803e94:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e9b:	00 
+
+  while (n) {
+  803e9c:	e9 ad 00 00 00       	jmp    803f4e <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803ea1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803ea5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803ea9:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803eb0:	00 
+  803eb1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803eb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb9:	48 39 c2             	cmp    %rax,%rdx
+  803ebc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803ec0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803ec4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ec8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ecc:	48 89 c6             	mov    %rax,%rsi
+  803ecf:	48 b8 10 10 81 00 00 	movabs $0x811010,%rax
+  803ed6:	00 00 00 
+  803ed9:	48 89 c7             	mov    %rax,%rdi
+  803edc:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  803ee3:	00 00 00 
+  803ee6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ee8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eec:	8b 40 0c             	mov    0xc(%rax),%eax
+  803eef:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803ef6:	00 00 00 
+  803ef9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803efb:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803f02:	00 00 00 
+  803f05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f09:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  803f12:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f17:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+  803f23:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803f26:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803f2a:	79 07                	jns    803f33 <devfile_write+0xcb>
+      return res;
+  803f2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f2f:	48 98                	cltq
+  803f31:	eb 2a                	jmp    803f5d <devfile_write+0xf5>
+
+    buf += res;
+  803f33:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f36:	48 98                	cltq
+  803f38:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803f3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f3f:	48 98                	cltq
+  803f41:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803f45:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f48:	48 98                	cltq
+  803f4a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803f4e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803f53:	0f 85 48 ff ff ff    	jne    803ea1 <devfile_write+0x39>
+  }
+
+  return res0;
+  803f59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803f5d:	c9                   	leave
+  803f5e:	c3                   	ret
+
+0000000000803f5f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803f5f:	55                   	push   %rbp
+  803f60:	48 89 e5             	mov    %rsp,%rbp
+  803f63:	48 83 ec 20          	sub    $0x20,%rsp
+  803f67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803f6b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803f6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f73:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f76:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803f7d:	00 00 00 
+  803f80:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803f82:	be 00 00 00 00       	mov    $0x0,%esi
+  803f87:	bf 05 00 00 00       	mov    $0x5,%edi
+  803f8c:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803f93:	00 00 00 
+  803f96:	ff d0                	call   *%rax
+  803f98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f9f:	79 05                	jns    803fa6 <devfile_stat+0x47>
+    return r;
+  803fa1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fa4:	eb 59                	jmp    803fff <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803fa6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803faa:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  803fb1:	00 00 00 
+  803fb4:	48 89 d6             	mov    %rdx,%rsi
+  803fb7:	48 89 c7             	mov    %rax,%rdi
+  803fba:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  803fc1:	00 00 00 
+  803fc4:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803fc6:	48 b8 00 10 81 00 00 	movabs $0x811000,%rax
+  803fcd:	00 00 00 
+  803fd0:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803fd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fda:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803fe0:	48 b8 00 10 81 00 00 	movabs $0x811000,%rax
+  803fe7:	00 00 00 
+  803fea:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803ff0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ff4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fff:	c9                   	leave
+  804000:	c3                   	ret
+
+0000000000804001 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804001:	55                   	push   %rbp
+  804002:	48 89 e5             	mov    %rsp,%rbp
+  804005:	48 83 ec 10          	sub    $0x10,%rsp
+  804009:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80400d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804010:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804014:	8b 40 0c             	mov    0xc(%rax),%eax
+  804017:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  80401e:	00 00 00 
+  804021:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804023:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  80402a:	00 00 00 
+  80402d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804030:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804033:	be 00 00 00 00       	mov    $0x0,%esi
+  804038:	bf 02 00 00 00       	mov    $0x2,%edi
+  80403d:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  804044:	00 00 00 
+  804047:	ff d0                	call   *%rax
+}
+  804049:	c9                   	leave
+  80404a:	c3                   	ret
+
+000000000080404b <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80404b:	55                   	push   %rbp
+  80404c:	48 89 e5             	mov    %rsp,%rbp
+  80404f:	48 83 ec 18          	sub    $0x18,%rsp
+  804053:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804057:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80405a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  80405e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804061:	83 e0 03             	and    $0x3,%eax
+}
+  804064:	c9                   	leave
+  804065:	c3                   	ret
+
+0000000000804066 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804066:	55                   	push   %rbp
+  804067:	48 89 e5             	mov    %rsp,%rbp
+  80406a:	48 83 ec 10          	sub    $0x10,%rsp
+  80406e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804076:	48 89 c7             	mov    %rax,%rdi
+  804079:	48 b8 c8 16 80 00 00 	movabs $0x8016c8,%rax
+  804080:	00 00 00 
+  804083:	ff d0                	call   *%rax
+  804085:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80408a:	7e 07                	jle    804093 <remove+0x2d>
+    return -E_BAD_PATH;
+  80408c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804091:	eb 36                	jmp    8040c9 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804093:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804097:	48 89 c6             	mov    %rax,%rsi
+  80409a:	48 b8 00 10 81 00 00 	movabs $0x811000,%rax
+  8040a1:	00 00 00 
+  8040a4:	48 89 c7             	mov    %rax,%rdi
+  8040a7:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8040ae:	00 00 00 
+  8040b1:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8040b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8040b8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8040bd:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8040c4:	00 00 00 
+  8040c7:	ff d0                	call   *%rax
+}
+  8040c9:	c9                   	leave
+  8040ca:	c3                   	ret
+
+00000000008040cb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8040cb:	55                   	push   %rbp
+  8040cc:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8040cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8040d4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8040d9:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8040e0:	00 00 00 
+  8040e3:	ff d0                	call   *%rax
+}
+  8040e5:	5d                   	pop    %rbp
+  8040e6:	c3                   	ret
+
+00000000008040e7 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8040e7:	55                   	push   %rbp
+  8040e8:	48 89 e5             	mov    %rsp,%rbp
+  8040eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8040ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8040f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8040f8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8040fd:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  804104:	00 00 00 
+  804107:	ff d0                	call   *%rax
+  804109:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80410c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804110:	79 05                	jns    804117 <fs_stats+0x30>
+    return r;
+  804112:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804115:	eb 2a                	jmp    804141 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804117:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80411b:	ba 68 00 00 00       	mov    $0x68,%edx
+  804120:	48 b9 00 10 81 00 00 	movabs $0x811000,%rcx
+  804127:	00 00 00 
+  80412a:	48 89 ce             	mov    %rcx,%rsi
+  80412d:	48 89 c7             	mov    %rax,%rdi
+  804130:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  804137:	00 00 00 
+  80413a:	ff d0                	call   *%rax
+  return 0;
+  80413c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804141:	c9                   	leave
+  804142:	c3                   	ret
+
+0000000000804143 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804143:	55                   	push   %rbp
+  804144:	48 89 e5             	mov    %rsp,%rbp
+  804147:	48 83 ec 10          	sub    $0x10,%rsp
+  80414b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80414e:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  804155:	00 00 00 
+  804158:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80415b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80415d:	be 00 00 00 00       	mov    $0x0,%esi
+  804162:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804167:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  80416e:	00 00 00 
+  804171:	ff d0                	call   *%rax
+}
+  804173:	c9                   	leave
+  804174:	c3                   	ret
+
+0000000000804175 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804175:	55                   	push   %rbp
+  804176:	48 89 e5             	mov    %rsp,%rbp
+  804179:	48 83 ec 10          	sub    $0x10,%rsp
+  80417d:	89 f8                	mov    %edi,%eax
+  80417f:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804182:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804186:	48 ba 00 10 81 00 00 	movabs $0x811000,%rdx
+  80418d:	00 00 00 
+  804190:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804192:	be 00 00 00 00       	mov    $0x0,%esi
+  804197:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80419c:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+}
+  8041a8:	c9                   	leave
+  8041a9:	c3                   	ret
+
+00000000008041aa <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8041aa:	55                   	push   %rbp
+  8041ab:	48 89 e5             	mov    %rsp,%rbp
+  8041ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8041b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8041b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ba:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8041bf:	48 89 c7             	mov    %rax,%rdi
+  8041c2:	48 b8 d0 41 80 00 00 	movabs $0x8041d0,%rax
+  8041c9:	00 00 00 
+  8041cc:	ff d0                	call   *%rax
+}
+  8041ce:	c9                   	leave
+  8041cf:	c3                   	ret
+
+00000000008041d0 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8041d0:	55                   	push   %rbp
+  8041d1:	48 89 e5             	mov    %rsp,%rbp
+  8041d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8041d8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8041dc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8041e0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8041e7:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8041e8:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8041ed:	74 0a                	je     8041f9 <pipe_size+0x29>
+  8041ef:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8041f6:	00 
+  8041f7:	76 0a                	jbe    804203 <pipe_size+0x33>
+    return -E_INVAL;
+  8041f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041fe:	e9 cc 02 00 00       	jmp    8044cf <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804203:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804207:	48 89 c7             	mov    %rax,%rdi
+  80420a:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  804211:	00 00 00 
+  804214:	ff d0                	call   *%rax
+  804216:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804219:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80421d:	0f 88 a8 02 00 00    	js     8044cb <pipe_size+0x2fb>
+  804223:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804227:	ba 07 04 00 00       	mov    $0x407,%edx
+  80422c:	48 89 c6             	mov    %rax,%rsi
+  80422f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804234:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  80423b:	00 00 00 
+  80423e:	ff d0                	call   *%rax
+  804240:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804243:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804247:	0f 88 7e 02 00 00    	js     8044cb <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80424d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804251:	48 89 c7             	mov    %rax,%rdi
+  804254:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  80425b:	00 00 00 
+  80425e:	ff d0                	call   *%rax
+  804260:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804263:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804267:	0f 88 43 02 00 00    	js     8044b0 <pipe_size+0x2e0>
+  80426d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804271:	ba 07 04 00 00       	mov    $0x407,%edx
+  804276:	48 89 c6             	mov    %rax,%rsi
+  804279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80427e:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  804285:	00 00 00 
+  804288:	ff d0                	call   *%rax
+  80428a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80428d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804291:	0f 88 19 02 00 00    	js     8044b0 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80429b:	48 89 c7             	mov    %rax,%rdi
+  80429e:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+  8042aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8042ae:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8042b5:	00 
+  8042b6:	e9 a2 00 00 00       	jmp    80435d <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8042bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042bf:	48 c1 e0 0c          	shl    $0xc,%rax
+  8042c3:	48 89 c2             	mov    %rax,%rdx
+  8042c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ca:	48 01 d0             	add    %rdx,%rax
+  8042cd:	ba 07 04 00 00       	mov    $0x407,%edx
+  8042d2:	48 89 c6             	mov    %rax,%rsi
+  8042d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042da:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  8042e1:	00 00 00 
+  8042e4:	ff d0                	call   *%rax
+  8042e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042ed:	0f 88 37 01 00 00    	js     80442a <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8042f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042f7:	48 89 c7             	mov    %rax,%rdi
+  8042fa:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804301:	00 00 00 
+  804304:	ff d0                	call   *%rax
+  804306:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80430a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80430e:	48 01 c2             	add    %rax,%rdx
+  804311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804315:	48 c1 e0 0c          	shl    $0xc,%rax
+  804319:	48 89 c1             	mov    %rax,%rcx
+  80431c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804320:	48 01 c8             	add    %rcx,%rax
+  804323:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804329:	48 89 d1             	mov    %rdx,%rcx
+  80432c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804331:	48 89 c6             	mov    %rax,%rsi
+  804334:	bf 00 00 00 00       	mov    $0x0,%edi
+  804339:	48 b8 ef 25 80 00 00 	movabs $0x8025ef,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  804345:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804348:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80434c:	79 0a                	jns    804358 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80434e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804353:	e9 d3 00 00 00       	jmp    80442b <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804358:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80435d:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804364:	00 
+  804365:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804369:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80436d:	48 01 d0             	add    %rdx,%rax
+  804370:	48 83 c0 1f          	add    $0x1f,%rax
+  804374:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804378:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80437c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804381:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804385:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804389:	48 29 d0             	sub    %rdx,%rax
+  80438c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804390:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804394:	0f 82 21 ff ff ff    	jb     8042bb <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80439a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80439e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8043a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043a6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8043aa:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8043ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043b2:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  8043b9:	00 00 00 
+  8043bc:	8b 12                	mov    (%rdx),%edx
+  8043be:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8043c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8043cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043cf:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  8043d6:	00 00 00 
+  8043d9:	8b 12                	mov    (%rdx),%edx
+  8043db:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8043dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043e1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8043e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043ec:	48 89 c7             	mov    %rax,%rdi
+  8043ef:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  8043f6:	00 00 00 
+  8043f9:	ff d0                	call   *%rax
+  8043fb:	89 c2                	mov    %eax,%edx
+  8043fd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804401:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804403:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804407:	48 89 c7             	mov    %rax,%rdi
+  80440a:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  804411:	00 00 00 
+  804414:	ff d0                	call   *%rax
+  804416:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80441a:	48 83 c2 04          	add    $0x4,%rdx
+  80441e:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804420:	b8 00 00 00 00       	mov    $0x0,%eax
+  804425:	e9 a5 00 00 00       	jmp    8044cf <pipe_size+0x2ff>
+      goto err2;
+  80442a:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80442b:	eb 58                	jmp    804485 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80442d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804431:	48 c1 e0 0c          	shl    $0xc,%rax
+  804435:	48 89 c2             	mov    %rax,%rdx
+  804438:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443c:	48 01 d0             	add    %rdx,%rax
+  80443f:	48 89 c6             	mov    %rax,%rsi
+  804442:	bf 00 00 00 00       	mov    $0x0,%edi
+  804447:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  80444e:	00 00 00 
+  804451:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804453:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804457:	48 89 c7             	mov    %rax,%rdi
+  80445a:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804461:	00 00 00 
+  804464:	ff d0                	call   *%rax
+  804466:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80446a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80446e:	48 01 d0             	add    %rdx,%rax
+  804471:	48 89 c6             	mov    %rax,%rsi
+  804474:	bf 00 00 00 00       	mov    $0x0,%edi
+  804479:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804485:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804489:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80448d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804491:	48 85 c0             	test   %rax,%rax
+  804494:	75 97                	jne    80442d <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804496:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80449a:	48 89 c6             	mov    %rax,%rsi
+  80449d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a2:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  8044a9:	00 00 00 
+  8044ac:	ff d0                	call   *%rax
+  8044ae:	eb 01                	jmp    8044b1 <pipe_size+0x2e1>
+    goto err1;
+  8044b0:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8044b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044b5:	48 89 c6             	mov    %rax,%rsi
+  8044b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044bd:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	eb 01                	jmp    8044cc <pipe_size+0x2fc>
+    goto err;
+  8044cb:	90                   	nop
+err:
+  return r;
+  8044cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8044cf:	c9                   	leave
+  8044d0:	c3                   	ret
+
+00000000008044d1 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8044d1:	55                   	push   %rbp
+  8044d2:	48 89 e5             	mov    %rsp,%rbp
+  8044d5:	53                   	push   %rbx
+  8044d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8044da:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8044e2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8044e9:	00 00 00 
+  8044ec:	8b 40 04             	mov    0x4(%rax),%eax
+  8044ef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8044f4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8044fb:	00 00 00 
+  8044fe:	48 98                	cltq
+  804500:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804507:	48 01 d0             	add    %rdx,%rax
+  80450a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804510:	8b 00                	mov    (%rax),%eax
+  804512:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804515:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804519:	48 89 c7             	mov    %rax,%rdi
+  80451c:	48 b8 f7 63 80 00 00 	movabs $0x8063f7,%rax
+  804523:	00 00 00 
+  804526:	ff d0                	call   *%rax
+  804528:	89 c3                	mov    %eax,%ebx
+  80452a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80452e:	48 89 c7             	mov    %rax,%rdi
+  804531:	48 b8 f7 63 80 00 00 	movabs $0x8063f7,%rax
+  804538:	00 00 00 
+  80453b:	ff d0                	call   *%rax
+  80453d:	39 c3                	cmp    %eax,%ebx
+  80453f:	0f 94 c0             	sete   %al
+  804542:	0f b6 c0             	movzbl %al,%eax
+  804545:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804548:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80454f:	00 00 00 
+  804552:	8b 40 04             	mov    0x4(%rax),%eax
+  804555:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80455a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804561:	00 00 00 
+  804564:	48 98                	cltq
+  804566:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80456d:	48 01 d0             	add    %rdx,%rax
+  804570:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804576:	8b 00                	mov    (%rax),%eax
+  804578:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80457b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80457e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804581:	75 05                	jne    804588 <_pipeisclosed+0xb7>
+      return ret;
+  804583:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804586:	eb 68                	jmp    8045f0 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804588:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80458b:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80458e:	0f 84 4e ff ff ff    	je     8044e2 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804594:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80459b:	00 00 00 
+  80459e:	8b 40 04             	mov    0x4(%rax),%eax
+  8045a1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045a6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8045ad:	00 00 00 
+  8045b0:	48 98                	cltq
+  8045b2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8045b9:	48 01 d0             	add    %rdx,%rax
+  8045bc:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8045c2:	8b 10                	mov    (%rax),%edx
+  8045c4:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8045c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045ca:	89 c6                	mov    %eax,%esi
+  8045cc:	48 b8 c0 71 80 00 00 	movabs $0x8071c0,%rax
+  8045d3:	00 00 00 
+  8045d6:	48 89 c7             	mov    %rax,%rdi
+  8045d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045de:	49 b8 19 08 80 00 00 	movabs $0x800819,%r8
+  8045e5:	00 00 00 
+  8045e8:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8045eb:	e9 f2 fe ff ff       	jmp    8044e2 <_pipeisclosed+0x11>
+  }
+}
+  8045f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045f4:	c9                   	leave
+  8045f5:	c3                   	ret
+
+00000000008045f6 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8045fe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804601:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804605:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804608:	48 89 d6             	mov    %rdx,%rsi
+  80460b:	89 c7                	mov    %eax,%edi
+  80460d:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  804614:	00 00 00 
+  804617:	ff d0                	call   *%rax
+  804619:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80461c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804620:	79 05                	jns    804627 <pipeisclosed+0x31>
+    return r;
+  804622:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804625:	eb 31                	jmp    804658 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804627:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80462b:	48 89 c7             	mov    %rax,%rdi
+  80462e:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+  80463a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80463e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804642:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804646:	48 89 d6             	mov    %rdx,%rsi
+  804649:	48 89 c7             	mov    %rax,%rdi
+  80464c:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+}
+  804658:	c9                   	leave
+  804659:	c3                   	ret
+
+000000000080465a <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80465a:	55                   	push   %rbp
+  80465b:	48 89 e5             	mov    %rsp,%rbp
+  80465e:	48 83 ec 10          	sub    $0x10,%rsp
+  804662:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80466a:	8b 40 18             	mov    0x18(%rax),%eax
+  80466d:	8d 50 01             	lea    0x1(%rax),%edx
+  804670:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804674:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80467b:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80467e:	85 c0                	test   %eax,%eax
+  804680:	74 27                	je     8046a9 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804686:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80468d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804691:	48 83 c0 18          	add    $0x18,%rax
+  804695:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80469a:	48 89 c7             	mov    %rax,%rdi
+  80469d:	48 b8 92 29 80 00 00 	movabs $0x802992,%rax
+  8046a4:	00 00 00 
+  8046a7:	ff d0                	call   *%rax
+  }
+}
+  8046a9:	90                   	nop
+  8046aa:	c9                   	leave
+  8046ab:	c3                   	ret
+
+00000000008046ac <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8046ac:	55                   	push   %rbp
+  8046ad:	48 89 e5             	mov    %rsp,%rbp
+  8046b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8046b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046b8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8046bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046bf:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8046c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ca:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8046ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046d1:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8046d8:	89 c6                	mov    %eax,%esi
+  8046da:	48 89 cf             	mov    %rcx,%rdi
+  8046dd:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  8046e4:	00 00 00 
+  8046e7:	ff d0                	call   *%rax
+}
+  8046e9:	90                   	nop
+  8046ea:	c9                   	leave
+  8046eb:	c3                   	ret
+
+00000000008046ec <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046ec:	55                   	push   %rbp
+  8046ed:	48 89 e5             	mov    %rsp,%rbp
+  8046f0:	48 83 ec 70          	sub    $0x70,%rsp
+  8046f4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8046f8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8046fc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804700:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804704:	48 89 c7             	mov    %rax,%rdi
+  804707:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  80470e:	00 00 00 
+  804711:	ff d0                	call   *%rax
+  804713:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804717:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80471c:	75 0a                	jne    804728 <devpipe_read+0x3c>
+    return 0;
+  80471e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804723:	e9 63 01 00 00       	jmp    80488b <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80472c:	8b 40 18             	mov    0x18(%rax),%eax
+  80472f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804736:	48 8b 10             	mov    (%rax),%rdx
+  804739:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80473d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804741:	48 39 c2             	cmp    %rax,%rdx
+  804744:	75 42                	jne    804788 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804746:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80474a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80474e:	48 89 d6             	mov    %rdx,%rsi
+  804751:	48 89 c7             	mov    %rax,%rdi
+  804754:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  80475b:	00 00 00 
+  80475e:	ff d0                	call   *%rax
+  804760:	85 c0                	test   %eax,%eax
+  804762:	74 0a                	je     80476e <devpipe_read+0x82>
+      return 0;
+  804764:	b8 00 00 00 00       	mov    $0x0,%eax
+  804769:	e9 1d 01 00 00       	jmp    80488b <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80476e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804771:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804775:	89 d6                	mov    %edx,%esi
+  804777:	48 89 c7             	mov    %rax,%rdi
+  80477a:	48 b8 ac 46 80 00 00 	movabs $0x8046ac,%rax
+  804781:	00 00 00 
+  804784:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804786:	eb a0                	jmp    804728 <devpipe_read+0x3c>
+      break;
+  804788:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804789:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80478d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804791:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804795:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80479d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047a5:	48 8b 00             	mov    (%rax),%rax
+  8047a8:	48 29 c2             	sub    %rax,%rdx
+  8047ab:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8047af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8047b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047b7:	48 39 c2             	cmp    %rax,%rdx
+  8047ba:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8047be:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8047c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047c6:	48 8b 00             	mov    (%rax),%rax
+  8047c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047cd:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8047d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d6:	48 f7 f1             	div    %rcx
+  8047d9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8047dd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8047e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8047e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047e9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047ed:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8047f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047f5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8047f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047fd:	48 39 c2             	cmp    %rax,%rdx
+  804800:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804804:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80480c:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804810:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804814:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804818:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80481c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804820:	48 89 ce             	mov    %rcx,%rsi
+  804823:	48 89 c7             	mov    %rax,%rdi
+  804826:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  80482d:	00 00 00 
+  804830:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804832:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804836:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80483a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80483e:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804842:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804846:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80484a:	48 01 d1             	add    %rdx,%rcx
+  80484d:	48 89 c2             	mov    %rax,%rdx
+  804850:	48 89 cf             	mov    %rcx,%rdi
+  804853:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  80485a:	00 00 00 
+  80485d:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80485f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804863:	48 8b 10             	mov    (%rax),%rdx
+  804866:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80486a:	48 01 c2             	add    %rax,%rdx
+  80486d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804871:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804874:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804878:	48 89 c7             	mov    %rax,%rdi
+  80487b:	48 b8 5a 46 80 00 00 	movabs $0x80465a,%rax
+  804882:	00 00 00 
+  804885:	ff d0                	call   *%rax
+  return n;
+  804887:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80488b:	c9                   	leave
+  80488c:	c3                   	ret
+
+000000000080488d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80488d:	55                   	push   %rbp
+  80488e:	48 89 e5             	mov    %rsp,%rbp
+  804891:	48 83 ec 70          	sub    $0x70,%rsp
+  804895:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804899:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80489d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8048a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048a5:	48 89 c7             	mov    %rax,%rdi
+  8048a8:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  8048af:	00 00 00 
+  8048b2:	ff d0                	call   *%rax
+  8048b4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8048b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8048bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8048c0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8048c7:	00 
+  8048c8:	e9 b8 01 00 00       	jmp    804a85 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8048cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048d1:	8b 40 18             	mov    0x18(%rax),%eax
+  8048d4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8048d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8048df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e3:	48 8b 00             	mov    (%rax),%rax
+  8048e6:	48 29 c2             	sub    %rax,%rdx
+  8048e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048ed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048f1:	48 39 c2             	cmp    %rax,%rdx
+  8048f4:	75 4d                	jne    804943 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8048f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048fe:	48 89 d6             	mov    %rdx,%rsi
+  804901:	48 89 c7             	mov    %rax,%rdi
+  804904:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  80490b:	00 00 00 
+  80490e:	ff d0                	call   *%rax
+  804910:	85 c0                	test   %eax,%eax
+  804912:	74 0a                	je     80491e <devpipe_write+0x91>
+        return 0;
+  804914:	b8 00 00 00 00       	mov    $0x0,%eax
+  804919:	e9 79 01 00 00       	jmp    804a97 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80491e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804925:	89 d6                	mov    %edx,%esi
+  804927:	48 89 c7             	mov    %rax,%rdi
+  80492a:	48 b8 ac 46 80 00 00 	movabs $0x8046ac,%rax
+  804931:	00 00 00 
+  804934:	ff d0                	call   *%rax
+      m = 0;
+  804936:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80493d:	00 
+      continue;
+  80493e:	e9 3a 01 00 00       	jmp    804a7d <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804943:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804947:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80494b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80494f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804953:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804957:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80495b:	48 8b 08             	mov    (%rax),%rcx
+  80495e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804962:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804966:	48 29 c1             	sub    %rax,%rcx
+  804969:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80496d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804971:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804975:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804979:	48 39 c2             	cmp    %rax,%rdx
+  80497c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804980:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804984:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804988:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80498c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804990:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804994:	ba 00 00 00 00       	mov    $0x0,%edx
+  804999:	48 f7 f1             	div    %rcx
+  80499c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8049a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049a4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8049a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049ac:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8049b0:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8049b4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8049b8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8049bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049c0:	48 39 c2             	cmp    %rax,%rdx
+  8049c3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8049c7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8049cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049cf:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8049d3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049d7:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8049db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049df:	48 01 d1             	add    %rdx,%rcx
+  8049e2:	48 89 c2             	mov    %rax,%rdx
+  8049e5:	48 89 cf             	mov    %rcx,%rdi
+  8049e8:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  8049ef:	00 00 00 
+  8049f2:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8049f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049f8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8049fc:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a00:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804a04:	73 4d                	jae    804a53 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804a06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a0a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a12:	48 29 c2             	sub    %rax,%rdx
+  804a15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a19:	48 01 c2             	add    %rax,%rdx
+  804a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a20:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a24:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a28:	48 89 c1             	mov    %rax,%rcx
+  804a2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a2f:	48 01 c1             	add    %rax,%rcx
+  804a32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a36:	48 01 c1             	add    %rax,%rcx
+  804a39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a3d:	48 83 c0 20          	add    $0x20,%rax
+  804a41:	48 89 ce             	mov    %rcx,%rsi
+  804a44:	48 89 c7             	mov    %rax,%rdi
+  804a47:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  804a4e:	00 00 00 
+  804a51:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804a53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a57:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a5f:	48 01 c2             	add    %rax,%rdx
+  804a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a66:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804a6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a6e:	48 89 c7             	mov    %rax,%rdi
+  804a71:	48 b8 5a 46 80 00 00 	movabs $0x80465a,%rax
+  804a78:	00 00 00 
+  804a7b:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a81:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804a85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a89:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804a8d:	0f 82 3a fe ff ff    	jb     8048cd <devpipe_write+0x40>
+  }
+
+  return i;
+  804a93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804a97:	c9                   	leave
+  804a98:	c3                   	ret
+
+0000000000804a99 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804a99:	55                   	push   %rbp
+  804a9a:	48 89 e5             	mov    %rsp,%rbp
+  804a9d:	48 83 ec 40          	sub    $0x40,%rsp
+  804aa1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804aa5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804aa8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804aac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ab0:	48 89 c7             	mov    %rax,%rdi
+  804ab3:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804aba:	00 00 00 
+  804abd:	ff d0                	call   *%rax
+  804abf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804ac3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804aca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ace:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804ad2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad6:	48 89 d6             	mov    %rdx,%rsi
+  804ad9:	48 89 c7             	mov    %rax,%rdi
+  804adc:	48 b8 74 37 80 00 00 	movabs $0x803774,%rax
+  804ae3:	00 00 00 
+  804ae6:	ff d0                	call   *%rax
+  804ae8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804aef:	79 08                	jns    804af9 <devpipe_poll+0x60>
+    return r;
+  804af1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af4:	e9 85 00 00 00       	jmp    804b7e <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804af9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804afc:	83 e0 01             	and    $0x1,%eax
+  804aff:	85 c0                	test   %eax,%eax
+  804b01:	74 18                	je     804b1b <devpipe_poll+0x82>
+  804b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b07:	48 8b 10             	mov    (%rax),%rdx
+  804b0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b0e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b12:	48 39 c2             	cmp    %rax,%rdx
+  804b15:	74 04                	je     804b1b <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804b17:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804b1b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b1e:	83 e0 02             	and    $0x2,%eax
+  804b21:	85 c0                	test   %eax,%eax
+  804b23:	74 23                	je     804b48 <devpipe_poll+0xaf>
+  804b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b29:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b31:	48 8b 00             	mov    (%rax),%rax
+  804b34:	48 29 c2             	sub    %rax,%rdx
+  804b37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b3b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b3f:	48 39 c2             	cmp    %rax,%rdx
+  804b42:	73 04                	jae    804b48 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804b44:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804b48:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b50:	48 89 d6             	mov    %rdx,%rsi
+  804b53:	48 89 c7             	mov    %rax,%rdi
+  804b56:	48 b8 d1 44 80 00 00 	movabs $0x8044d1,%rax
+  804b5d:	00 00 00 
+  804b60:	ff d0                	call   *%rax
+  804b62:	85 c0                	test   %eax,%eax
+  804b64:	74 04                	je     804b6a <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804b66:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804b6a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b6e:	75 0b                	jne    804b7b <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804b70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b74:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804b7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b7e:	c9                   	leave
+  804b7f:	c3                   	ret
+
+0000000000804b80 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804b80:	55                   	push   %rbp
+  804b81:	48 89 e5             	mov    %rsp,%rbp
+  804b84:	48 83 ec 20          	sub    $0x20,%rsp
+  804b88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b8c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b94:	48 89 c7             	mov    %rax,%rdi
+  804b97:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804b9e:	00 00 00 
+  804ba1:	ff d0                	call   *%rax
+  804ba3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804ba7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bab:	48 ba f1 71 80 00 00 	movabs $0x8071f1,%rdx
+  804bb2:	00 00 00 
+  804bb5:	48 89 d6             	mov    %rdx,%rsi
+  804bb8:	48 89 c7             	mov    %rax,%rdi
+  804bbb:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  804bc2:	00 00 00 
+  804bc5:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804bc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bcb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bcf:	89 c1                	mov    %eax,%ecx
+  804bd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bd5:	48 8b 00             	mov    (%rax),%rax
+  804bd8:	89 c2                	mov    %eax,%edx
+  804bda:	89 c8                	mov    %ecx,%eax
+  804bdc:	29 d0                	sub    %edx,%eax
+  804bde:	89 c2                	mov    %eax,%edx
+  804be0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804be4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804bea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bee:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804bf5:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804bf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bfc:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  804c03:	00 00 00 
+  804c06:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c12:	c9                   	leave
+  804c13:	c3                   	ret
+
+0000000000804c14 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804c14:	55                   	push   %rbp
+  804c15:	48 89 e5             	mov    %rsp,%rbp
+  804c18:	48 83 ec 40          	sub    $0x40,%rsp
+  804c1c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c24:	48 89 c7             	mov    %rax,%rdi
+  804c27:	48 b8 a1 2c 80 00 00 	movabs $0x802ca1,%rax
+  804c2e:	00 00 00 
+  804c31:	ff d0                	call   *%rax
+  804c33:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804c37:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804c3e:	00 
+  804c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c43:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c4b:	48 01 d0             	add    %rdx,%rax
+  804c4e:	48 83 c0 1f          	add    $0x1f,%rax
+  804c52:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c5f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804c63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c67:	48 29 d0             	sub    %rdx,%rax
+  804c6a:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c6e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804c72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c76:	48 89 c6             	mov    %rax,%rsi
+  804c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c7e:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  804c85:	00 00 00 
+  804c88:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804c8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c8e:	48 89 c7             	mov    %rax,%rdi
+  804c91:	48 b8 5a 46 80 00 00 	movabs $0x80465a,%rax
+  804c98:	00 00 00 
+  804c9b:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804c9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ca1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804ca5:	eb 2f                	jmp    804cd6 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804ca7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cab:	48 83 e8 01          	sub    $0x1,%rax
+  804caf:	48 c1 e0 0c          	shl    $0xc,%rax
+  804cb3:	48 89 c2             	mov    %rax,%rdx
+  804cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cba:	48 01 d0             	add    %rdx,%rax
+  804cbd:	48 89 c6             	mov    %rax,%rsi
+  804cc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cc5:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  804ccc:	00 00 00 
+  804ccf:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804cd1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804cd6:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804cdb:	77 ca                	ja     804ca7 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804cdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ce1:	48 89 c6             	mov    %rax,%rsi
+  804ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ce9:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  804cf0:	00 00 00 
+  804cf3:	ff d0                	call   *%rax
+}
+  804cf5:	c9                   	leave
+  804cf6:	c3                   	ret
+
+0000000000804cf7 <size_class>:
+static size_t heap_pages, heap_large;
+
+static_assert(sizeof(struct Span) <= SPAN_HDR, "struct Span too big");
+
+static int
+size_class(size_t n) {
+  804cf7:	55                   	push   %rbp
+  804cf8:	48 89 e5             	mov    %rsp,%rbp
+  804cfb:	48 83 ec 18          	sub    $0x18,%rsp
+  804cff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c;
+
+  if (n <= 128)
+  804d03:	48 81 7d e8 80 00 00 	cmpq   $0x80,-0x18(%rbp)
+  804d0a:	00 
+  804d0b:	77 1c                	ja     804d29 <size_class+0x32>
+    return n ? (n - 1) / 16 : 0;
+  804d0d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d12:	74 0e                	je     804d22 <size_class+0x2b>
+  804d14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d18:	48 83 e8 01          	sub    $0x1,%rax
+  804d1c:	48 c1 e8 04          	shr    $0x4,%rax
+  804d20:	eb 33                	jmp    804d55 <size_class+0x5e>
+  804d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d27:	eb 2c                	jmp    804d55 <size_class+0x5e>
+  for (c = 8; class_sizes[c] < n; c++)
+  804d29:	c7 45 fc 08 00 00 00 	movl   $0x8,-0x4(%rbp)
+  804d30:	eb 04                	jmp    804d36 <size_class+0x3f>
+  804d32:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804d36:	48 ba 00 72 80 00 00 	movabs $0x807200,%rdx
+  804d3d:	00 00 00 
+  804d40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d43:	48 98                	cltq
+  804d45:	0f b7 04 42          	movzwl (%rdx,%rax,2),%eax
+  804d49:	0f b7 c0             	movzwl %ax,%eax
+  804d4c:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  804d50:	72 e0                	jb     804d32 <size_class+0x3b>
+    ;
+  return c;
+  804d52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d55:	c9                   	leave
+  804d56:	c3                   	ret
+
+0000000000804d57 <span_alloc>:
+
+// Reserve nspans aligned spans of address space and map their first
+// npages pages.  Returns NULL if out of address space or memory.
+static struct Span *
+span_alloc(size_t nspans, size_t npages) {
+  804d57:	55                   	push   %rbp
+  804d58:	48 89 e5             	mov    %rsp,%rbp
+  804d5b:	48 83 ec 30          	sub    $0x30,%rsp
+  804d5f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804d63:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va = 0, p;
+  804d67:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804d6e:	00 
+  int i, best = -1;
+  804d6f:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%rbp)
+
+  mutex_lock(&heap_lock);
+  804d76:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  804d7d:	00 00 00 
+  804d80:	48 89 c7             	mov    %rax,%rdi
+  804d83:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  804d8a:	00 00 00 
+  804d8d:	ff d0                	call   *%rax
+  for (i = 0; i < nfree_ranges; i++) {
+  804d8f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804d96:	eb 72                	jmp    804e0a <span_alloc+0xb3>
+    if (free_ranges[i].fr_nspans >= nspans &&
+  804d98:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804d9f:	00 00 00 
+  804da2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804da5:	48 98                	cltq
+  804da7:	48 c1 e0 04          	shl    $0x4,%rax
+  804dab:	48 01 d0             	add    %rdx,%rax
+  804dae:	48 83 c0 08          	add    $0x8,%rax
+  804db2:	48 8b 00             	mov    (%rax),%rax
+  804db5:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804db9:	72 4b                	jb     804e06 <span_alloc+0xaf>
+  804dbb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804dbf:	78 3f                	js     804e00 <span_alloc+0xa9>
+        (best < 0 || free_ranges[i].fr_nspans < free_ranges[best].fr_nspans))
+  804dc1:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804dc8:	00 00 00 
+  804dcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dce:	48 98                	cltq
+  804dd0:	48 c1 e0 04          	shl    $0x4,%rax
+  804dd4:	48 01 d0             	add    %rdx,%rax
+  804dd7:	48 83 c0 08          	add    $0x8,%rax
+  804ddb:	48 8b 10             	mov    (%rax),%rdx
+  804dde:	48 b9 40 23 81 00 00 	movabs $0x812340,%rcx
+  804de5:	00 00 00 
+  804de8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804deb:	48 98                	cltq
+  804ded:	48 c1 e0 04          	shl    $0x4,%rax
+  804df1:	48 01 c8             	add    %rcx,%rax
+  804df4:	48 83 c0 08          	add    $0x8,%rax
+  804df8:	48 8b 00             	mov    (%rax),%rax
+  804dfb:	48 39 c2             	cmp    %rax,%rdx
+  804dfe:	73 06                	jae    804e06 <span_alloc+0xaf>
+      best = i;
+  804e00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e03:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  for (i = 0; i < nfree_ranges; i++) {
+  804e06:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804e0a:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  804e11:	00 00 00 
+  804e14:	8b 00                	mov    (%rax),%eax
+  804e16:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e19:	0f 8c 79 ff ff ff    	jl     804d98 <span_alloc+0x41>
+  }
+  if (best >= 0) {
+  804e1f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804e23:	0f 88 20 01 00 00    	js     804f49 <span_alloc+0x1f2>
+    va = free_ranges[best].fr_addr;
+  804e29:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804e30:	00 00 00 
+  804e33:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e36:	48 98                	cltq
+  804e38:	48 c1 e0 04          	shl    $0x4,%rax
+  804e3c:	48 01 d0             	add    %rdx,%rax
+  804e3f:	48 8b 00             	mov    (%rax),%rax
+  804e42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    free_ranges[best].fr_addr += nspans * SPAN_SIZE;
+  804e46:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804e4d:	00 00 00 
+  804e50:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e53:	48 98                	cltq
+  804e55:	48 c1 e0 04          	shl    $0x4,%rax
+  804e59:	48 01 d0             	add    %rdx,%rax
+  804e5c:	48 8b 00             	mov    (%rax),%rax
+  804e5f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e63:	48 c1 e2 10          	shl    $0x10,%rdx
+  804e67:	48 01 c2             	add    %rax,%rdx
+  804e6a:	48 b9 40 23 81 00 00 	movabs $0x812340,%rcx
+  804e71:	00 00 00 
+  804e74:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e77:	48 98                	cltq
+  804e79:	48 c1 e0 04          	shl    $0x4,%rax
+  804e7d:	48 01 c8             	add    %rcx,%rax
+  804e80:	48 89 10             	mov    %rdx,(%rax)
+    if (!(free_ranges[best].fr_nspans -= nspans))
+  804e83:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804e8a:	00 00 00 
+  804e8d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e90:	48 98                	cltq
+  804e92:	48 c1 e0 04          	shl    $0x4,%rax
+  804e96:	48 01 d0             	add    %rdx,%rax
+  804e99:	48 83 c0 08          	add    $0x8,%rax
+  804e9d:	48 8b 00             	mov    (%rax),%rax
+  804ea0:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+  804ea4:	48 b9 40 23 81 00 00 	movabs $0x812340,%rcx
+  804eab:	00 00 00 
+  804eae:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804eb1:	48 63 d2             	movslq %edx,%rdx
+  804eb4:	48 c1 e2 04          	shl    $0x4,%rdx
+  804eb8:	48 01 ca             	add    %rcx,%rdx
+  804ebb:	48 83 c2 08          	add    $0x8,%rdx
+  804ebf:	48 89 02             	mov    %rax,(%rdx)
+  804ec2:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804ec9:	00 00 00 
+  804ecc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ecf:	48 98                	cltq
+  804ed1:	48 c1 e0 04          	shl    $0x4,%rax
+  804ed5:	48 01 d0             	add    %rdx,%rax
+  804ed8:	48 83 c0 08          	add    $0x8,%rax
+  804edc:	48 8b 00             	mov    (%rax),%rax
+  804edf:	48 85 c0             	test   %rax,%rax
+  804ee2:	0f 85 c4 00 00 00    	jne    804fac <span_alloc+0x255>
+      free_ranges[best] = free_ranges[--nfree_ranges];
+  804ee8:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  804eef:	00 00 00 
+  804ef2:	8b 00                	mov    (%rax),%eax
+  804ef4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  804ef7:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  804efe:	00 00 00 
+  804f01:	89 10                	mov    %edx,(%rax)
+  804f03:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  804f0a:	00 00 00 
+  804f0d:	8b 00                	mov    (%rax),%eax
+  804f0f:	48 b9 40 23 81 00 00 	movabs $0x812340,%rcx
+  804f16:	00 00 00 
+  804f19:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804f1c:	48 63 d2             	movslq %edx,%rdx
+  804f1f:	48 c1 e2 04          	shl    $0x4,%rdx
+  804f23:	48 01 d1             	add    %rdx,%rcx
+  804f26:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  804f2d:	00 00 00 
+  804f30:	48 98                	cltq
+  804f32:	48 c1 e0 04          	shl    $0x4,%rax
+  804f36:	48 01 d0             	add    %rdx,%rax
+  804f39:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f3d:	48 8b 00             	mov    (%rax),%rax
+  804f40:	48 89 01             	mov    %rax,(%rcx)
+  804f43:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804f47:	eb 63                	jmp    804fac <span_alloc+0x255>
+  } else if (heap_top + nspans * SPAN_SIZE <= HEAP_BASE + HEAP_SIZE) {
+  804f49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f4d:	48 c1 e0 10          	shl    $0x10,%rax
+  804f51:	48 89 c2             	mov    %rax,%rdx
+  804f54:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  804f5b:	00 00 00 
+  804f5e:	48 8b 00             	mov    (%rax),%rax
+  804f61:	48 01 d0             	add    %rdx,%rax
+  804f64:	48 ba 00 00 00 00 20 	movabs $0x2000000000,%rdx
+  804f6b:	00 00 00 
+  804f6e:	48 39 c2             	cmp    %rax,%rdx
+  804f71:	72 39                	jb     804fac <span_alloc+0x255>
+    va = heap_top;
+  804f73:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  804f7a:	00 00 00 
+  804f7d:	48 8b 00             	mov    (%rax),%rax
+  804f80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    heap_top += nspans * SPAN_SIZE;
+  804f84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f88:	48 c1 e0 10          	shl    $0x10,%rax
+  804f8c:	48 89 c2             	mov    %rax,%rdx
+  804f8f:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  804f96:	00 00 00 
+  804f99:	48 8b 00             	mov    (%rax),%rax
+  804f9c:	48 01 c2             	add    %rax,%rdx
+  804f9f:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  804fa6:	00 00 00 
+  804fa9:	48 89 10             	mov    %rdx,(%rax)
+  }
+  if (va)
+  804fac:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804fb1:	74 21                	je     804fd4 <span_alloc+0x27d>
+    heap_pages += npages;
+  804fb3:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  804fba:	00 00 00 
+  804fbd:	48 8b 10             	mov    (%rax),%rdx
+  804fc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc4:	48 01 c2             	add    %rax,%rdx
+  804fc7:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  804fce:	00 00 00 
+  804fd1:	48 89 10             	mov    %rdx,(%rax)
+  mutex_unlock(&heap_lock);
+  804fd4:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  804fdb:	00 00 00 
+  804fde:	48 89 c7             	mov    %rax,%rdi
+  804fe1:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  804fe8:	00 00 00 
+  804feb:	ff d0                	call   *%rax
+  if (!va)
+  804fed:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804ff2:	75 0a                	jne    804ffe <span_alloc+0x2a7>
+    return NULL;
+  804ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff9:	e9 f5 00 00 00       	jmp    8050f3 <span_alloc+0x39c>
+
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE) {
+  804ffe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805002:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  805006:	e9 b0 00 00 00       	jmp    8050bb <span_alloc+0x364>
+    if (sys_page_alloc(0, (void *)p, PTE_P | PTE_U | PTE_W) < 0) {
+  80500b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80500f:	ba 07 00 00 00       	mov    $0x7,%edx
+  805014:	48 89 c6             	mov    %rax,%rsi
+  805017:	bf 00 00 00 00       	mov    $0x0,%edi
+  80501c:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  805023:	00 00 00 
+  805026:	ff d0                	call   *%rax
+  805028:	85 c0                	test   %eax,%eax
+  80502a:	0f 89 83 00 00 00    	jns    8050b3 <span_alloc+0x35c>
+      while (p > va)
+  805030:	eb 20                	jmp    805052 <span_alloc+0x2fb>
+        sys_page_unmap(0, (void *)(p -= PGSIZE));
+  805032:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  805039:	00 
+  80503a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80503e:	48 89 c6             	mov    %rax,%rsi
+  805041:	bf 00 00 00 00       	mov    $0x0,%edi
+  805046:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  80504d:	00 00 00 
+  805050:	ff d0                	call   *%rax
+      while (p > va)
+  805052:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805056:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80505a:	72 d6                	jb     805032 <span_alloc+0x2db>
+      mutex_lock(&heap_lock);
+  80505c:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  805063:	00 00 00 
+  805066:	48 89 c7             	mov    %rax,%rdi
+  805069:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805070:	00 00 00 
+  805073:	ff d0                	call   *%rax
+      heap_pages -= npages;
+  805075:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  80507c:	00 00 00 
+  80507f:	48 8b 00             	mov    (%rax),%rax
+  805082:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805086:	48 ba 48 33 81 00 00 	movabs $0x813348,%rdx
+  80508d:	00 00 00 
+  805090:	48 89 02             	mov    %rax,(%rdx)
+      mutex_unlock(&heap_lock);
+  805093:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  80509a:	00 00 00 
+  80509d:	48 89 c7             	mov    %rax,%rdi
+  8050a0:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  8050a7:	00 00 00 
+  8050aa:	ff d0                	call   *%rax
+      return NULL;
+  8050ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050b1:	eb 40                	jmp    8050f3 <span_alloc+0x39c>
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE) {
+  8050b3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8050ba:	00 
+  8050bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050bf:	48 c1 e0 0c          	shl    $0xc,%rax
+  8050c3:	48 89 c2             	mov    %rax,%rdx
+  8050c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ca:	48 01 d0             	add    %rdx,%rax
+  8050cd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8050d1:	0f 82 34 ff ff ff    	jb     80500b <span_alloc+0x2b4>
+    }
+  }
+  ((struct Span *)va)->sp_npages = npages;
+  8050d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050db:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8050df:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  ((struct Span *)va)->sp_nspans = nspans;
+  8050e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050e7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8050eb:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  return (struct Span *)va;
+  8050ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8050f3:	c9                   	leave
+  8050f4:	c3                   	ret
+
+00000000008050f5 <span_free>:
+
+// Unmap span sp and keep its address space for reuse.
+static void
+span_free(struct Span *sp) {
+  8050f5:	55                   	push   %rbp
+  8050f6:	48 89 e5             	mov    %rsp,%rbp
+  8050f9:	48 83 ec 30          	sub    $0x30,%rsp
+  8050fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  uintptr_t va = (uintptr_t)sp, p;
+  805101:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805105:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t npages = sp->sp_npages, nspans = sp->sp_nspans;
+  805109:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80510d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805111:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  805115:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805119:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80511d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE)
+  805121:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805125:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805129:	eb 20                	jmp    80514b <span_free+0x56>
+    sys_page_unmap(0, (void *)p);
+  80512b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512f:	48 89 c6             	mov    %rax,%rsi
+  805132:	bf 00 00 00 00       	mov    $0x0,%edi
+  805137:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  80513e:	00 00 00 
+  805141:	ff d0                	call   *%rax
+  for (p = va; p < va + npages * PGSIZE; p += PGSIZE)
+  805143:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80514a:	00 
+  80514b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80514f:	48 c1 e0 0c          	shl    $0xc,%rax
+  805153:	48 89 c2             	mov    %rax,%rdx
+  805156:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80515a:	48 01 d0             	add    %rdx,%rax
+  80515d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805161:	72 c8                	jb     80512b <span_free+0x36>
+
+  mutex_lock(&heap_lock);
+  805163:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  80516a:	00 00 00 
+  80516d:	48 89 c7             	mov    %rax,%rdi
+  805170:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805177:	00 00 00 
+  80517a:	ff d0                	call   *%rax
+  heap_pages -= npages;
+  80517c:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  805183:	00 00 00 
+  805186:	48 8b 00             	mov    (%rax),%rax
+  805189:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  80518d:	48 ba 48 33 81 00 00 	movabs $0x813348,%rdx
+  805194:	00 00 00 
+  805197:	48 89 02             	mov    %rax,(%rdx)
+  if (va + nspans * SPAN_SIZE == heap_top)
+  80519a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80519e:	48 c1 e0 10          	shl    $0x10,%rax
+  8051a2:	48 89 c2             	mov    %rax,%rdx
+  8051a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051a9:	48 01 c2             	add    %rax,%rdx
+  8051ac:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  8051b3:	00 00 00 
+  8051b6:	48 8b 00             	mov    (%rax),%rax
+  8051b9:	48 39 c2             	cmp    %rax,%rdx
+  8051bc:	75 13                	jne    8051d1 <span_free+0xdc>
+    heap_top = va;
+  8051be:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  8051c5:	00 00 00 
+  8051c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051cc:	48 89 02             	mov    %rax,(%rdx)
+  8051cf:	eb 67                	jmp    805238 <span_free+0x143>
+  else if (nfree_ranges < NFREERANGES)
+  8051d1:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  8051d8:	00 00 00 
+  8051db:	8b 00                	mov    (%rax),%eax
+  8051dd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8051e2:	7f 54                	jg     805238 <span_free+0x143>
+    free_ranges[nfree_ranges++] = (struct FreeRange){va, nspans};
+  8051e4:	48 b8 40 33 81 00 00 	movabs $0x813340,%rax
+  8051eb:	00 00 00 
+  8051ee:	8b 00                	mov    (%rax),%eax
+  8051f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8051f3:	48 b9 40 33 81 00 00 	movabs $0x813340,%rcx
+  8051fa:	00 00 00 
+  8051fd:	89 11                	mov    %edx,(%rcx)
+  8051ff:	48 b9 40 23 81 00 00 	movabs $0x812340,%rcx
+  805206:	00 00 00 
+  805209:	48 63 d0             	movslq %eax,%rdx
+  80520c:	48 c1 e2 04          	shl    $0x4,%rdx
+  805210:	48 01 d1             	add    %rdx,%rcx
+  805213:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805217:	48 89 11             	mov    %rdx,(%rcx)
+  80521a:	48 ba 40 23 81 00 00 	movabs $0x812340,%rdx
+  805221:	00 00 00 
+  805224:	48 98                	cltq
+  805226:	48 c1 e0 04          	shl    $0x4,%rax
+  80522a:	48 01 d0             	add    %rdx,%rax
+  80522d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805231:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805235:	48 89 02             	mov    %rax,(%rdx)
+  mutex_unlock(&heap_lock);
+  805238:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  80523f:	00 00 00 
+  805242:	48 89 c7             	mov    %rax,%rdi
+  805245:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  80524c:	00 00 00 
+  80524f:	ff d0                	call   *%rax
+}
+  805251:	90                   	nop
+  805252:	c9                   	leave
+  805253:	c3                   	ret
+
+0000000000805254 <slab_unlink>:
+
+static void
+slab_unlink(struct SizeClass *sc, struct Span *sp) {
+  805254:	55                   	push   %rbp
+  805255:	48 89 e5             	mov    %rsp,%rbp
+  805258:	48 83 ec 10          	sub    $0x10,%rsp
+  80525c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805260:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (sp->sp_prev)
+  805264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805268:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80526c:	48 85 c0             	test   %rax,%rax
+  80526f:	74 16                	je     805287 <slab_unlink+0x33>
+    sp->sp_prev->sp_next = sp->sp_next;
+  805271:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805275:	48 8b 40 28          	mov    0x28(%rax),%rax
+  805279:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80527d:	48 8b 52 20          	mov    0x20(%rdx),%rdx
+  805281:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  805285:	eb 10                	jmp    805297 <slab_unlink+0x43>
+  else
+    sc->sc_slabs = sp->sp_next;
+  805287:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80528b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80528f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805293:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (sp->sp_next)
+  805297:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80529b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80529f:	48 85 c0             	test   %rax,%rax
+  8052a2:	74 14                	je     8052b8 <slab_unlink+0x64>
+    sp->sp_next->sp_prev = sp->sp_prev;
+  8052a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052a8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8052ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8052b0:	48 8b 52 28          	mov    0x28(%rdx),%rdx
+  8052b4:	48 89 50 28          	mov    %rdx,0x28(%rax)
+}
+  8052b8:	90                   	nop
+  8052b9:	c9                   	leave
+  8052ba:	c3                   	ret
+
+00000000008052bb <slab_link>:
+
+static void
+slab_link(struct SizeClass *sc, struct Span *sp) {
+  8052bb:	55                   	push   %rbp
+  8052bc:	48 89 e5             	mov    %rsp,%rbp
+  8052bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8052c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8052c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  sp->sp_prev = NULL;
+  8052cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052cf:	48 c7 40 28 00 00 00 	movq   $0x0,0x28(%rax)
+  8052d6:	00 
+  sp->sp_next = sc->sc_slabs;
+  8052d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8052df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052e3:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  if (sp->sp_next)
+  8052e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052eb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8052ef:	48 85 c0             	test   %rax,%rax
+  8052f2:	74 10                	je     805304 <slab_link+0x49>
+    sp->sp_next->sp_prev = sp;
+  8052f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052f8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8052fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805300:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  sc->sc_slabs = sp;
+  805304:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805308:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80530c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+}
+  805310:	90                   	nop
+  805311:	c9                   	leave
+  805312:	c3                   	ret
+
+0000000000805313 <small_alloc>:
+
+static void *
+small_alloc(int c) {
+  805313:	55                   	push   %rbp
+  805314:	48 89 e5             	mov    %rsp,%rbp
+  805317:	48 83 ec 30          	sub    $0x30,%rsp
+  80531b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct SizeClass *sc = &classes[c];
+  80531e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805321:	48 98                	cltq
+  805323:	48 c1 e0 05          	shl    $0x5,%rax
+  805327:	48 89 c2             	mov    %rax,%rdx
+  80532a:	48 b8 20 20 81 00 00 	movabs $0x812020,%rax
+  805331:	00 00 00 
+  805334:	48 01 d0             	add    %rdx,%rax
+  805337:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  struct Span *sp;
+  void *v;
+
+  mutex_lock(&sc->sc_lock);
+  80533b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80533f:	48 89 c7             	mov    %rax,%rdi
+  805342:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805349:	00 00 00 
+  80534c:	ff d0                	call   *%rax
+  if (!(sp = sc->sc_slabs)) {
+  80534e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805352:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805356:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80535a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80535f:	0f 85 b7 00 00 00    	jne    80541c <small_alloc+0x109>
+    if (!(sp = span_alloc(1, SPAN_SIZE / PGSIZE))) {
+  805365:	be 10 00 00 00       	mov    $0x10,%esi
+  80536a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80536f:	48 b8 57 4d 80 00 00 	movabs $0x804d57,%rax
+  805376:	00 00 00 
+  805379:	ff d0                	call   *%rax
+  80537b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80537f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  805384:	75 1d                	jne    8053a3 <small_alloc+0x90>
+      mutex_unlock(&sc->sc_lock);
+  805386:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80538a:	48 89 c7             	mov    %rax,%rdi
+  80538d:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805394:	00 00 00 
+  805397:	ff d0                	call   *%rax
+      return NULL;
+  805399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80539e:	e9 66 01 00 00       	jmp    805509 <small_alloc+0x1f6>
+    }
+    sp->sp_class = c;
+  8053a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053a7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8053aa:	89 10                	mov    %edx,(%rax)
+    sp->sp_size  = class_sizes[c];
+  8053ac:	48 ba 00 72 80 00 00 	movabs $0x807200,%rdx
+  8053b3:	00 00 00 
+  8053b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053b9:	48 98                	cltq
+  8053bb:	0f b7 04 42          	movzwl (%rdx,%rax,2),%eax
+  8053bf:	0f b7 d0             	movzwl %ax,%edx
+  8053c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053c6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    sp->sp_free  = NULL;
+  8053ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ce:	48 c7 40 30 00 00 00 	movq   $0x0,0x30(%rax)
+  8053d5:	00 
+    sp->sp_bump  = (char *)sp + SPAN_HDR;
+  8053d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053da:	48 8d 50 40          	lea    0x40(%rax),%rdx
+  8053de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053e2:	48 89 50 38          	mov    %rdx,0x38(%rax)
+    sp->sp_inuse = 0;
+  8053e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ea:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+    slab_link(sc, sp);
+  8053f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053f9:	48 89 d6             	mov    %rdx,%rsi
+  8053fc:	48 89 c7             	mov    %rax,%rdi
+  8053ff:	48 b8 bb 52 80 00 00 	movabs $0x8052bb,%rax
+  805406:	00 00 00 
+  805409:	ff d0                	call   *%rax
+    sc->sc_nempty++;
+  80540b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80540f:	8b 40 10             	mov    0x10(%rax),%eax
+  805412:	8d 50 01             	lea    0x1(%rax),%edx
+  805415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805419:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+
+  if ((v = sp->sp_free)) {
+  80541c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805420:	48 8b 40 30          	mov    0x30(%rax),%rax
+  805424:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  805428:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80542d:	74 11                	je     805440 <small_alloc+0x12d>
+    sp->sp_free = *(void **)v;
+  80542f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805433:	48 8b 10             	mov    (%rax),%rdx
+  805436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80543a:	48 89 50 30          	mov    %rdx,0x30(%rax)
+  80543e:	eb 27                	jmp    805467 <small_alloc+0x154>
+  } else {
+    v = sp->sp_bump;
+  805440:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805444:	48 8b 40 38          	mov    0x38(%rax),%rax
+  805448:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sp->sp_bump += sp->sp_size;
+  80544c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805450:	48 8b 50 38          	mov    0x38(%rax),%rdx
+  805454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805458:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80545c:	48 01 c2             	add    %rax,%rdx
+  80545f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805463:	48 89 50 38          	mov    %rdx,0x38(%rax)
+  }
+  if (!sp->sp_inuse++)
+  805467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80546b:	8b 40 04             	mov    0x4(%rax),%eax
+  80546e:	8d 48 01             	lea    0x1(%rax),%ecx
+  805471:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805475:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  805478:	85 c0                	test   %eax,%eax
+  80547a:	75 11                	jne    80548d <small_alloc+0x17a>
+    sc->sc_nempty--;
+  80547c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805480:	8b 40 10             	mov    0x10(%rax),%eax
+  805483:	8d 50 ff             	lea    -0x1(%rax),%edx
+  805486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80548a:	89 50 10             	mov    %edx,0x10(%rax)
+  sc->sc_inuse += sp->sp_size;
+  80548d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805491:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  805495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805499:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80549d:	48 01 c2             	add    %rax,%rdx
+  8054a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054a4:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  if (!sp->sp_free && sp->sp_bump + sp->sp_size > (char *)sp + SPAN_SIZE)
+  8054a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054ac:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8054b0:	48 85 c0             	test   %rax,%rax
+  8054b3:	75 3d                	jne    8054f2 <small_alloc+0x1df>
+  8054b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054b9:	48 8b 50 38          	mov    0x38(%rax),%rdx
+  8054bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054c5:	48 01 d0             	add    %rdx,%rax
+  8054c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054cc:	48 81 c2 00 00 01 00 	add    $0x10000,%rdx
+  8054d3:	48 39 c2             	cmp    %rax,%rdx
+  8054d6:	73 1a                	jae    8054f2 <small_alloc+0x1df>
+    slab_unlink(sc, sp);
+  8054d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054e0:	48 89 d6             	mov    %rdx,%rsi
+  8054e3:	48 89 c7             	mov    %rax,%rdi
+  8054e6:	48 b8 54 52 80 00 00 	movabs $0x805254,%rax
+  8054ed:	00 00 00 
+  8054f0:	ff d0                	call   *%rax
+  mutex_unlock(&sc->sc_lock);
+  8054f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054f6:	48 89 c7             	mov    %rax,%rdi
+  8054f9:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805500:	00 00 00 
+  805503:	ff d0                	call   *%rax
+  return v;
+  805505:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  805509:	c9                   	leave
+  80550a:	c3                   	ret
+
+000000000080550b <small_free>:
+
+static void
+small_free(struct Span *sp, void *v) {
+  80550b:	55                   	push   %rbp
+  80550c:	48 89 e5             	mov    %rsp,%rbp
+  80550f:	48 83 ec 20          	sub    $0x20,%rsp
+  805513:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805517:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct SizeClass *sc = &classes[sp->sp_class];
+  80551b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80551f:	8b 00                	mov    (%rax),%eax
+  805521:	48 98                	cltq
+  805523:	48 c1 e0 05          	shl    $0x5,%rax
+  805527:	48 89 c2             	mov    %rax,%rdx
+  80552a:	48 b8 20 20 81 00 00 	movabs $0x812020,%rax
+  805531:	00 00 00 
+  805534:	48 01 d0             	add    %rdx,%rax
+  805537:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  bool full;
+
+  mutex_lock(&sc->sc_lock);
+  80553b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80553f:	48 89 c7             	mov    %rax,%rdi
+  805542:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805549:	00 00 00 
+  80554c:	ff d0                	call   *%rax
+  full        = !sp->sp_free && sp->sp_bump + sp->sp_size > (char *)sp + SPAN_SIZE;
+  80554e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805552:	48 8b 40 30          	mov    0x30(%rax),%rax
+  805556:	48 85 c0             	test   %rax,%rax
+  805559:	75 2a                	jne    805585 <small_free+0x7a>
+  80555b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80555f:	48 8b 50 38          	mov    0x38(%rax),%rdx
+  805563:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805567:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80556b:	48 01 d0             	add    %rdx,%rax
+  80556e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805572:	48 81 c2 00 00 01 00 	add    $0x10000,%rdx
+  805579:	48 39 c2             	cmp    %rax,%rdx
+  80557c:	73 07                	jae    805585 <small_free+0x7a>
+  80557e:	b8 01 00 00 00       	mov    $0x1,%eax
+  805583:	eb 05                	jmp    80558a <small_free+0x7f>
+  805585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80558a:	88 45 f7             	mov    %al,-0x9(%rbp)
+  80558d:	80 65 f7 01          	andb   $0x1,-0x9(%rbp)
+  *(void **)v = sp->sp_free;
+  805591:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805595:	48 8b 50 30          	mov    0x30(%rax),%rdx
+  805599:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80559d:	48 89 10             	mov    %rdx,(%rax)
+  sp->sp_free = v;
+  8055a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8055a8:	48 89 50 30          	mov    %rdx,0x30(%rax)
+  if (full)
+  8055ac:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8055b0:	74 1a                	je     8055cc <small_free+0xc1>
+    slab_link(sc, sp);
+  8055b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8055b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055ba:	48 89 d6             	mov    %rdx,%rsi
+  8055bd:	48 89 c7             	mov    %rax,%rdi
+  8055c0:	48 b8 bb 52 80 00 00 	movabs $0x8052bb,%rax
+  8055c7:	00 00 00 
+  8055ca:	ff d0                	call   *%rax
+  sc->sc_inuse -= sp->sp_size;
+  8055cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055d0:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8055d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8055dc:	48 29 c2             	sub    %rax,%rdx
+  8055df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055e3:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  if (!--sp->sp_inuse) {
+  8055e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055eb:	8b 40 04             	mov    0x4(%rax),%eax
+  8055ee:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8055f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055f5:	89 50 04             	mov    %edx,0x4(%rax)
+  8055f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055fc:	8b 40 04             	mov    0x4(%rax),%eax
+  8055ff:	85 c0                	test   %eax,%eax
+  805601:	75 5e                	jne    805661 <small_free+0x156>
+    // Keep one empty slab so that a malloc/free loop does not map
+    // and unmap pages every time.
+    if (sc->sc_nempty) {
+  805603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805607:	8b 40 10             	mov    0x10(%rax),%eax
+  80560a:	85 c0                	test   %eax,%eax
+  80560c:	74 42                	je     805650 <small_free+0x145>
+      slab_unlink(sc, sp);
+  80560e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805616:	48 89 d6             	mov    %rdx,%rsi
+  805619:	48 89 c7             	mov    %rax,%rdi
+  80561c:	48 b8 54 52 80 00 00 	movabs $0x805254,%rax
+  805623:	00 00 00 
+  805626:	ff d0                	call   *%rax
+      mutex_unlock(&sc->sc_lock);
+  805628:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80562c:	48 89 c7             	mov    %rax,%rdi
+  80562f:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805636:	00 00 00 
+  805639:	ff d0                	call   *%rax
+      span_free(sp);
+  80563b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80563f:	48 89 c7             	mov    %rax,%rdi
+  805642:	48 b8 f5 50 80 00 00 	movabs $0x8050f5,%rax
+  805649:	00 00 00 
+  80564c:	ff d0                	call   *%rax
+      return;
+  80564e:	eb 24                	jmp    805674 <small_free+0x169>
+    }
+    sc->sc_nempty++;
+  805650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805654:	8b 40 10             	mov    0x10(%rax),%eax
+  805657:	8d 50 01             	lea    0x1(%rax),%edx
+  80565a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80565e:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+  mutex_unlock(&sc->sc_lock);
+  805661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805665:	48 89 c7             	mov    %rax,%rdi
+  805668:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  80566f:	00 00 00 
+  805672:	ff d0                	call   *%rax
+}
+  805674:	c9                   	leave
+  805675:	c3                   	ret
+
+0000000000805676 <malloc>:
+
+void *
+malloc(size_t n) {
+  805676:	55                   	push   %rbp
+  805677:	48 89 e5             	mov    %rsp,%rbp
+  80567a:	48 83 ec 40          	sub    $0x40,%rsp
+  80567e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Span *sp;
+  size_t npages;
+
+  if (n <= SMALL_MAX)
+  805682:	48 81 7d c8 00 08 00 	cmpq   $0x800,-0x38(%rbp)
+  805689:	00 
+  80568a:	77 26                	ja     8056b2 <malloc+0x3c>
+    return small_alloc(size_class(n));
+  80568c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805690:	48 89 c7             	mov    %rax,%rdi
+  805693:	48 b8 f7 4c 80 00 00 	movabs $0x804cf7,%rax
+  80569a:	00 00 00 
+  80569d:	ff d0                	call   *%rax
+  80569f:	89 c7                	mov    %eax,%edi
+  8056a1:	48 b8 13 53 80 00 00 	movabs $0x805313,%rax
+  8056a8:	00 00 00 
+  8056ab:	ff d0                	call   *%rax
+  8056ad:	e9 33 01 00 00       	jmp    8057e5 <malloc+0x16f>
+
+  if (n > HEAP_SIZE)
+  8056b2:	48 b8 00 00 00 00 10 	movabs $0x1000000000,%rax
+  8056b9:	00 00 00 
+  8056bc:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8056c0:	73 0a                	jae    8056cc <malloc+0x56>
+    return NULL;
+  8056c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056c7:	e9 19 01 00 00       	jmp    8057e5 <malloc+0x16f>
+  npages = ROUNDUP(n + SPAN_HDR, PGSIZE) / PGSIZE;
+  8056cc:	48 c7 45 f8 00 10 00 	movq   $0x1000,-0x8(%rbp)
+  8056d3:	00 
+  8056d4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8056d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056dc:	48 01 d0             	add    %rdx,%rax
+  8056df:	48 83 c0 3f          	add    $0x3f,%rax
+  8056e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8056e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056f0:	48 f7 75 f8          	divq   -0x8(%rbp)
+  8056f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056f8:	48 29 d0             	sub    %rdx,%rax
+  8056fb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (!(sp = span_alloc(ROUNDUP(npages * PGSIZE, SPAN_SIZE) / SPAN_SIZE, npages)))
+  805703:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+  80570a:	00 
+  80570b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80570f:	48 c1 e0 0c          	shl    $0xc,%rax
+  805713:	48 89 c2             	mov    %rax,%rdx
+  805716:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80571a:	48 01 d0             	add    %rdx,%rax
+  80571d:	48 83 e8 01          	sub    $0x1,%rax
+  805721:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805725:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805729:	ba 00 00 00 00       	mov    $0x0,%edx
+  80572e:	48 f7 75 e0          	divq   -0x20(%rbp)
+  805732:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805736:	48 29 d0             	sub    %rdx,%rax
+  805739:	48 c1 e8 10          	shr    $0x10,%rax
+  80573d:	48 89 c2             	mov    %rax,%rdx
+  805740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805744:	48 89 c6             	mov    %rax,%rsi
+  805747:	48 89 d7             	mov    %rdx,%rdi
+  80574a:	48 b8 57 4d 80 00 00 	movabs $0x804d57,%rax
+  805751:	00 00 00 
+  805754:	ff d0                	call   *%rax
+  805756:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80575a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80575f:	75 07                	jne    805768 <malloc+0xf2>
+    return NULL;
+  805761:	b8 00 00 00 00       	mov    $0x0,%eax
+  805766:	eb 7d                	jmp    8057e5 <malloc+0x16f>
+  sp->sp_class = -1;
+  805768:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80576c:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%rax)
+  sp->sp_size  = npages * PGSIZE - SPAN_HDR;
+  805772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805776:	48 c1 e0 0c          	shl    $0xc,%rax
+  80577a:	48 8d 50 c0          	lea    -0x40(%rax),%rdx
+  80577e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805782:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  mutex_lock(&heap_lock);
+  805786:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  80578d:	00 00 00 
+  805790:	48 89 c7             	mov    %rax,%rdi
+  805793:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  80579a:	00 00 00 
+  80579d:	ff d0                	call   *%rax
+  heap_large += sp->sp_size;
+  80579f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057a3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8057a7:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  8057ae:	00 00 00 
+  8057b1:	48 8b 00             	mov    (%rax),%rax
+  8057b4:	48 01 c2             	add    %rax,%rdx
+  8057b7:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  8057be:	00 00 00 
+  8057c1:	48 89 10             	mov    %rdx,(%rax)
+  mutex_unlock(&heap_lock);
+  8057c4:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  8057cb:	00 00 00 
+  8057ce:	48 89 c7             	mov    %rax,%rdi
+  8057d1:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  8057d8:	00 00 00 
+  8057db:	ff d0                	call   *%rax
+  return (char *)sp + SPAN_HDR;
+  8057dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057e1:	48 83 c0 40          	add    $0x40,%rax
+}
+  8057e5:	c9                   	leave
+  8057e6:	c3                   	ret
+
+00000000008057e7 <free>:
+
+void
+free(void *v) {
+  8057e7:	55                   	push   %rbp
+  8057e8:	48 89 e5             	mov    %rsp,%rbp
+  8057eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8057ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct Span *sp;
+
+  if (!v)
+  8057f3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8057f8:	0f 84 04 01 00 00    	je     805902 <free+0x11b>
+    return;
+  if ((uintptr_t)v < HEAP_BASE || (uintptr_t)v >= HEAP_BASE + HEAP_SIZE)
+  8057fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805802:	48 ba ff ff ff ff 0f 	movabs $0xfffffffff,%rdx
+  805809:	00 00 00 
+  80580c:	48 39 c2             	cmp    %rax,%rdx
+  80580f:	73 13                	jae    805824 <free+0x3d>
+  805811:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805815:	48 ba ff ff ff ff 1f 	movabs $0x1fffffffff,%rdx
+  80581c:	00 00 00 
+  80581f:	48 39 c2             	cmp    %rax,%rdx
+  805822:	73 38                	jae    80585c <free+0x75>
+    panic("free: %p was not allocated by malloc", v);
+  805824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805828:	48 89 c1             	mov    %rax,%rcx
+  80582b:	48 b8 30 72 80 00 00 	movabs $0x807230,%rax
+  805832:	00 00 00 
+  805835:	48 89 c2             	mov    %rax,%rdx
+  805838:	be fa 00 00 00       	mov    $0xfa,%esi
+  80583d:	48 b8 55 72 80 00 00 	movabs $0x807255,%rax
+  805844:	00 00 00 
+  805847:	48 89 c7             	mov    %rax,%rdi
+  80584a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80584f:	49 b8 fa 05 80 00 00 	movabs $0x8005fa,%r8
+  805856:	00 00 00 
+  805859:	41 ff d0             	call   *%r8
+
+  sp = ROUNDDOWN((struct Span *)v, SPAN_SIZE);
+  80585c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805860:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805864:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805868:	66 b8 00 00          	mov    $0x0,%ax
+  80586c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (sp->sp_class >= 0) {
+  805870:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805874:	8b 00                	mov    (%rax),%eax
+  805876:	85 c0                	test   %eax,%eax
+  805878:	78 1c                	js     805896 <free+0xaf>
+    small_free(sp, v);
+  80587a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80587e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805882:	48 89 d6             	mov    %rdx,%rsi
+  805885:	48 89 c7             	mov    %rax,%rdi
+  805888:	48 b8 0b 55 80 00 00 	movabs $0x80550b,%rax
+  80588f:	00 00 00 
+  805892:	ff d0                	call   *%rax
+    return;
+  805894:	eb 6d                	jmp    805903 <free+0x11c>
+  }
+  mutex_lock(&heap_lock);
+  805896:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  80589d:	00 00 00 
+  8058a0:	48 89 c7             	mov    %rax,%rdi
+  8058a3:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  8058aa:	00 00 00 
+  8058ad:	ff d0                	call   *%rax
+  heap_large -= sp->sp_size;
+  8058af:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  8058b6:	00 00 00 
+  8058b9:	48 8b 10             	mov    (%rax),%rdx
+  8058bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8058c4:	48 29 c2             	sub    %rax,%rdx
+  8058c7:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  8058ce:	00 00 00 
+  8058d1:	48 89 10             	mov    %rdx,(%rax)
+  mutex_unlock(&heap_lock);
+  8058d4:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  8058db:	00 00 00 
+  8058de:	48 89 c7             	mov    %rax,%rdi
+  8058e1:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  8058e8:	00 00 00 
+  8058eb:	ff d0                	call   *%rax
+  span_free(sp);
+  8058ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058f1:	48 89 c7             	mov    %rax,%rdi
+  8058f4:	48 b8 f5 50 80 00 00 	movabs $0x8050f5,%rax
+  8058fb:	00 00 00 
+  8058fe:	ff d0                	call   *%rax
+  805900:	eb 01                	jmp    805903 <free+0x11c>
+    return;
+  805902:	90                   	nop
+}
+  805903:	c9                   	leave
+  805904:	c3                   	ret
+
+0000000000805905 <calloc>:
+
+void *
+calloc(size_t nmemb, size_t size) {
+  805905:	55                   	push   %rbp
+  805906:	48 89 e5             	mov    %rsp,%rbp
+  805909:	48 83 ec 20          	sub    $0x20,%rsp
+  80590d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805911:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *v;
+
+  if (size && nmemb > (size_t)-1 / size)
+  805915:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80591a:	74 23                	je     80593f <calloc+0x3a>
+  80591c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805925:	48 f7 65 e0          	mulq   -0x20(%rbp)
+  805929:	71 05                	jno    805930 <calloc+0x2b>
+  80592b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  805930:	48 89 c8             	mov    %rcx,%rax
+  805933:	48 85 c0             	test   %rax,%rax
+  805936:	74 07                	je     80593f <calloc+0x3a>
+    return NULL;
+  805938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80593d:	eb 4b                	jmp    80598a <calloc+0x85>
+  if ((v = malloc(nmemb * size)))
+  80593f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805943:	48 0f af 45 e0       	imul   -0x20(%rbp),%rax
+  805948:	48 89 c7             	mov    %rax,%rdi
+  80594b:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  805952:	00 00 00 
+  805955:	ff d0                	call   *%rax
+  805957:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80595b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  805960:	74 24                	je     805986 <calloc+0x81>
+    memset(v, 0, nmemb * size);
+  805962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805966:	48 0f af 45 e0       	imul   -0x20(%rbp),%rax
+  80596b:	48 89 c2             	mov    %rax,%rdx
+  80596e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805972:	be 00 00 00 00       	mov    $0x0,%esi
+  805977:	48 89 c7             	mov    %rax,%rdi
+  80597a:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  805981:	00 00 00 
+  805984:	ff d0                	call   *%rax
+  return v;
+  805986:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80598a:	c9                   	leave
+  80598b:	c3                   	ret
+
+000000000080598c <realloc>:
+
+void *
+realloc(void *v, size_t n) {
+  80598c:	55                   	push   %rbp
+  80598d:	48 89 e5             	mov    %rsp,%rbp
+  805990:	48 83 ec 60          	sub    $0x60,%rsp
+  805994:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805998:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  struct Span *sp;
+  size_t npages;
+  uintptr_t p;
+  void *nv;
+
+  if (!v)
+  80599c:	48 83 7d a8 00       	cmpq   $0x0,-0x58(%rbp)
+  8059a1:	75 18                	jne    8059bb <realloc+0x2f>
+    return malloc(n);
+  8059a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8059a7:	48 89 c7             	mov    %rax,%rdi
+  8059aa:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  8059b1:	00 00 00 
+  8059b4:	ff d0                	call   *%rax
+  8059b6:	e9 61 02 00 00       	jmp    805c1c <realloc+0x290>
+  if (!n) {
+  8059bb:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8059c0:	75 1d                	jne    8059df <realloc+0x53>
+    free(v);
+  8059c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8059c6:	48 89 c7             	mov    %rax,%rdi
+  8059c9:	48 b8 e7 57 80 00 00 	movabs $0x8057e7,%rax
+  8059d0:	00 00 00 
+  8059d3:	ff d0                	call   *%rax
+    return NULL;
+  8059d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059da:	e9 3d 02 00 00       	jmp    805c1c <realloc+0x290>
+  }
+
+  sp = ROUNDDOWN((struct Span *)v, SPAN_SIZE);
+  8059df:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8059e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8059e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059eb:	66 b8 00 00          	mov    $0x0,%ax
+  8059ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (sp->sp_class >= 0 && n <= SMALL_MAX && size_class(n) == sp->sp_class)
+  8059f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059f7:	8b 00                	mov    (%rax),%eax
+  8059f9:	85 c0                	test   %eax,%eax
+  8059fb:	78 32                	js     805a2f <realloc+0xa3>
+  8059fd:	48 81 7d a0 00 08 00 	cmpq   $0x800,-0x60(%rbp)
+  805a04:	00 
+  805a05:	77 28                	ja     805a2f <realloc+0xa3>
+  805a07:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805a0b:	48 89 c7             	mov    %rax,%rdi
+  805a0e:	48 b8 f7 4c 80 00 00 	movabs $0x804cf7,%rax
+  805a15:	00 00 00 
+  805a18:	ff d0                	call   *%rax
+  805a1a:	89 c2                	mov    %eax,%edx
+  805a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a20:	8b 00                	mov    (%rax),%eax
+  805a22:	39 c2                	cmp    %eax,%edx
+  805a24:	75 09                	jne    805a2f <realloc+0xa3>
+    return v;
+  805a26:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805a2a:	e9 ed 01 00 00       	jmp    805c1c <realloc+0x290>
+  if (sp->sp_class < 0 && n > SMALL_MAX && n <= sp->sp_size) {
+  805a2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a33:	8b 00                	mov    (%rax),%eax
+  805a35:	85 c0                	test   %eax,%eax
+  805a37:	0f 89 66 01 00 00    	jns    805ba3 <realloc+0x217>
+  805a3d:	48 81 7d a0 00 08 00 	cmpq   $0x800,-0x60(%rbp)
+  805a44:	00 
+  805a45:	0f 86 58 01 00 00    	jbe    805ba3 <realloc+0x217>
+  805a4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805a53:	48 3b 45 a0          	cmp    -0x60(%rbp),%rax
+  805a57:	0f 82 46 01 00 00    	jb     805ba3 <realloc+0x217>
+    // Shrink in place, handing back the pages no longer needed.
+    npages = ROUNDUP(n + SPAN_HDR, PGSIZE) / PGSIZE;
+  805a5d:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  805a64:	00 
+  805a65:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  805a69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a6d:	48 01 d0             	add    %rdx,%rax
+  805a70:	48 83 c0 3f          	add    $0x3f,%rax
+  805a74:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805a78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a81:	48 f7 75 e0          	divq   -0x20(%rbp)
+  805a85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a89:	48 29 d0             	sub    %rdx,%rax
+  805a8c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a90:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    for (p = (uintptr_t)sp + npages * PGSIZE;
+  805a94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a98:	48 c1 e0 0c          	shl    $0xc,%rax
+  805a9c:	48 89 c2             	mov    %rax,%rdx
+  805a9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805aa3:	48 01 d0             	add    %rdx,%rax
+  805aa6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805aaa:	eb 20                	jmp    805acc <realloc+0x140>
+         p < (uintptr_t)sp + sp->sp_npages * PGSIZE; p += PGSIZE)
+      sys_page_unmap(0, (void *)p);
+  805aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ab0:	48 89 c6             	mov    %rax,%rsi
+  805ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ab8:	48 b8 4f 26 80 00 00 	movabs $0x80264f,%rax
+  805abf:	00 00 00 
+  805ac2:	ff d0                	call   *%rax
+         p < (uintptr_t)sp + sp->sp_npages * PGSIZE; p += PGSIZE)
+  805ac4:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805acb:	00 
+  805acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ad0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805ad4:	48 c1 e0 0c          	shl    $0xc,%rax
+  805ad8:	48 89 c2             	mov    %rax,%rdx
+  805adb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805adf:	48 01 d0             	add    %rdx,%rax
+  805ae2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805ae6:	72 c4                	jb     805aac <realloc+0x120>
+    mutex_lock(&heap_lock);
+  805ae8:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  805aef:	00 00 00 
+  805af2:	48 89 c7             	mov    %rax,%rdi
+  805af5:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805afc:	00 00 00 
+  805aff:	ff d0                	call   *%rax
+    heap_pages -= sp->sp_npages - npages;
+  805b01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b05:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805b09:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b0d:	48 29 c2             	sub    %rax,%rdx
+  805b10:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  805b17:	00 00 00 
+  805b1a:	48 8b 00             	mov    (%rax),%rax
+  805b1d:	48 01 c2             	add    %rax,%rdx
+  805b20:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  805b27:	00 00 00 
+  805b2a:	48 89 10             	mov    %rdx,(%rax)
+    heap_large -= sp->sp_size - (npages * PGSIZE - SPAN_HDR);
+  805b2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b31:	48 c1 e0 0c          	shl    $0xc,%rax
+  805b35:	48 89 c2             	mov    %rax,%rdx
+  805b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805b40:	48 29 c2             	sub    %rax,%rdx
+  805b43:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  805b4a:	00 00 00 
+  805b4d:	48 8b 00             	mov    (%rax),%rax
+  805b50:	48 01 d0             	add    %rdx,%rax
+  805b53:	48 8d 50 c0          	lea    -0x40(%rax),%rdx
+  805b57:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  805b5e:	00 00 00 
+  805b61:	48 89 10             	mov    %rdx,(%rax)
+    mutex_unlock(&heap_lock);
+  805b64:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  805b6b:	00 00 00 
+  805b6e:	48 89 c7             	mov    %rax,%rdi
+  805b71:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805b78:	00 00 00 
+  805b7b:	ff d0                	call   *%rax
+    sp->sp_npages = npages;
+  805b7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b81:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b85:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    sp->sp_size   = npages * PGSIZE - SPAN_HDR;
+  805b89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b8d:	48 c1 e0 0c          	shl    $0xc,%rax
+  805b91:	48 8d 50 c0          	lea    -0x40(%rax),%rdx
+  805b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b99:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    return v;
+  805b9d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805ba1:	eb 79                	jmp    805c1c <realloc+0x290>
+  }
+
+  if (!(nv = malloc(n)))
+  805ba3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805ba7:	48 89 c7             	mov    %rax,%rdi
+  805baa:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  805bb1:	00 00 00 
+  805bb4:	ff d0                	call   *%rax
+  805bb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805bba:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805bbf:	75 07                	jne    805bc8 <realloc+0x23c>
+    return NULL;
+  805bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bc6:	eb 54                	jmp    805c1c <realloc+0x290>
+  memcpy(nv, v, MIN(n, sp->sp_size));
+  805bc8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805bcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805bd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805bd8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805bdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805be0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805be4:	48 39 c2             	cmp    %rax,%rdx
+  805be7:	48 0f 47 d0          	cmova  %rax,%rdx
+  805beb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  805bef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805bf3:	48 89 ce             	mov    %rcx,%rsi
+  805bf6:	48 89 c7             	mov    %rax,%rdi
+  805bf9:	48 b8 12 1f 80 00 00 	movabs $0x801f12,%rax
+  805c00:	00 00 00 
+  805c03:	ff d0                	call   *%rax
+  free(v);
+  805c05:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805c09:	48 89 c7             	mov    %rax,%rdi
+  805c0c:	48 b8 e7 57 80 00 00 	movabs $0x8057e7,%rax
+  805c13:	00 00 00 
+  805c16:	ff d0                	call   *%rax
+  return nv;
+  805c18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  805c1c:	c9                   	leave
+  805c1d:	c3                   	ret
+
+0000000000805c1e <malloc_stats>:
+
+// Report the bytes handed out by malloc (rounded up to what each
+// allocation really uses) and the bytes of pages mapped for them.
+void
+malloc_stats(size_t *inuse, size_t *mapped) {
+  805c1e:	55                   	push   %rbp
+  805c1f:	48 89 e5             	mov    %rsp,%rbp
+  805c22:	48 83 ec 20          	sub    $0x20,%rsp
+  805c26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805c2a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  size_t n;
+  int c;
+
+  mutex_lock(&heap_lock);
+  805c2e:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  805c35:	00 00 00 
+  805c38:	48 89 c7             	mov    %rax,%rdi
+  805c3b:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805c42:	00 00 00 
+  805c45:	ff d0                	call   *%rax
+  n = heap_large;
+  805c47:	48 b8 50 33 81 00 00 	movabs $0x813350,%rax
+  805c4e:	00 00 00 
+  805c51:	48 8b 00             	mov    (%rax),%rax
+  805c54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (mapped)
+  805c58:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805c5d:	74 1b                	je     805c7a <malloc_stats+0x5c>
+    *mapped = heap_pages * PGSIZE;
+  805c5f:	48 b8 48 33 81 00 00 	movabs $0x813348,%rax
+  805c66:	00 00 00 
+  805c69:	48 8b 00             	mov    (%rax),%rax
+  805c6c:	48 c1 e0 0c          	shl    $0xc,%rax
+  805c70:	48 89 c2             	mov    %rax,%rdx
+  805c73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c77:	48 89 10             	mov    %rdx,(%rax)
+  mutex_unlock(&heap_lock);
+  805c7a:	48 b8 20 23 81 00 00 	movabs $0x812320,%rax
+  805c81:	00 00 00 
+  805c84:	48 89 c7             	mov    %rax,%rdi
+  805c87:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805c8e:	00 00 00 
+  805c91:	ff d0                	call   *%rax
+  for (c = 0; c < NCLASSES; c++) {
+  805c93:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805c9a:	eb 75                	jmp    805d11 <malloc_stats+0xf3>
+    mutex_lock(&classes[c].sc_lock);
+  805c9c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805c9f:	48 98                	cltq
+  805ca1:	48 c1 e0 05          	shl    $0x5,%rax
+  805ca5:	48 89 c2             	mov    %rax,%rdx
+  805ca8:	48 b8 20 20 81 00 00 	movabs $0x812020,%rax
+  805caf:	00 00 00 
+  805cb2:	48 01 d0             	add    %rdx,%rax
+  805cb5:	48 89 c7             	mov    %rax,%rdi
+  805cb8:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  805cbf:	00 00 00 
+  805cc2:	ff d0                	call   *%rax
+    n += classes[c].sc_inuse;
+  805cc4:	48 ba 20 20 81 00 00 	movabs $0x812020,%rdx
+  805ccb:	00 00 00 
+  805cce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805cd1:	48 98                	cltq
+  805cd3:	48 c1 e0 05          	shl    $0x5,%rax
+  805cd7:	48 01 d0             	add    %rdx,%rax
+  805cda:	48 83 c0 18          	add    $0x18,%rax
+  805cde:	48 8b 00             	mov    (%rax),%rax
+  805ce1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    mutex_unlock(&classes[c].sc_lock);
+  805ce5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805ce8:	48 98                	cltq
+  805cea:	48 c1 e0 05          	shl    $0x5,%rax
+  805cee:	48 89 c2             	mov    %rax,%rdx
+  805cf1:	48 b8 20 20 81 00 00 	movabs $0x812020,%rax
+  805cf8:	00 00 00 
+  805cfb:	48 01 d0             	add    %rdx,%rax
+  805cfe:	48 89 c7             	mov    %rax,%rdi
+  805d01:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  805d08:	00 00 00 
+  805d0b:	ff d0                	call   *%rax
+  for (c = 0; c < NCLASSES; c++) {
+  805d0d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805d11:	83 7d f4 17          	cmpl   $0x17,-0xc(%rbp)
+  805d15:	7e 85                	jle    805c9c <malloc_stats+0x7e>
+  }
+  if (inuse)
+  805d17:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d1c:	74 0b                	je     805d29 <malloc_stats+0x10b>
+    *inuse = n;
+  805d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d22:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805d26:	48 89 10             	mov    %rdx,(%rax)
+}
+  805d29:	90                   	nop
+  805d2a:	c9                   	leave
+  805d2b:	c3                   	ret
+
+0000000000805d2c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805d2c:	55                   	push   %rbp
+  805d2d:	48 89 e5             	mov    %rsp,%rbp
+  805d30:	48 83 ec 08          	sub    $0x8,%rsp
+  805d34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805d37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d3b:	75 10                	jne    805d4d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805d3d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d44:	00 00 00 
+  805d47:	8b 00                	mov    (%rax),%eax
+  805d49:	48 98                	cltq
+  805d4b:	eb 05                	jmp    805d52 <vsyscall+0x26>
+  }
+  return 0;
+  805d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d52:	c9                   	leave
+  805d53:	c3                   	ret
+
+0000000000805d54 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805d54:	55                   	push   %rbp
+  805d55:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805d58:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d5d:	48 b8 2c 5d 80 00 00 	movabs $0x805d2c,%rax
+  805d64:	00 00 00 
+  805d67:	ff d0                	call   *%rax
+}
+  805d69:	5d                   	pop    %rbp
+  805d6a:	c3                   	ret
+
+0000000000805d6b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805d6b:	55                   	push   %rbp
+  805d6c:	48 89 e5             	mov    %rsp,%rbp
+  805d6f:	48 83 ec 20          	sub    $0x20,%rsp
+  __asm __volatile("rdtsc"
+  805d73:	0f 31                	rdtsc
+  805d75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d78:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805d7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d7e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d81:	48 c1 e2 20          	shl    $0x20,%rdx
+  805d85:	48 09 d0             	or     %rdx,%rax
+  805d88:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805d8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805d90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805d94:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d9b:	00 00 00 
+  805d9e:	8b 40 08             	mov    0x8(%rax),%eax
+  805da1:	48 98                	cltq
+  805da3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805da7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  805db0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805db4:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805dbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805dbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  805dc4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805dc8:	48 89 d0             	mov    %rdx,%rax
+  805dcb:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  805dd7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805ddb:	48 01 c8             	add    %rcx,%rax
+}
+  805dde:	c9                   	leave
+  805ddf:	c3                   	ret
+
+0000000000805de0 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805de0:	55                   	push   %rbp
+  805de1:	48 89 e5             	mov    %rsp,%rbp
+  805de4:	48 83 ec 20          	sub    $0x20,%rsp
+  805de8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805deb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dee:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805df1:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805df5:	be 01 00 00 00       	mov    $0x1,%esi
+  805dfa:	48 89 c7             	mov    %rax,%rdi
+  805dfd:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  805e04:	00 00 00 
+  805e07:	ff d0                	call   *%rax
+}
+  805e09:	90                   	nop
+  805e0a:	c9                   	leave
+  805e0b:	c3                   	ret
+
+0000000000805e0c <getchar>:
+
+int
+getchar(void) {
+  805e0c:	55                   	push   %rbp
+  805e0d:	48 89 e5             	mov    %rsp,%rbp
+  805e10:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805e14:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805e18:	ba 01 00 00 00       	mov    $0x1,%edx
+  805e1d:	48 89 c6             	mov    %rax,%rsi
+  805e20:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e25:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  805e2c:	00 00 00 
+  805e2f:	ff d0                	call   *%rax
+  805e31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805e34:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e38:	79 05                	jns    805e3f <getchar+0x33>
+    return r;
+  805e3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e3d:	eb 14                	jmp    805e53 <getchar+0x47>
+  if (r < 1)
+  805e3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e43:	7f 07                	jg     805e4c <getchar+0x40>
+    return -E_EOF;
+  805e45:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805e4a:	eb 07                	jmp    805e53 <getchar+0x47>
+  return c;
+  805e4c:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805e50:	0f b6 c0             	movzbl %al,%eax
+}
+  805e53:	c9                   	leave
+  805e54:	c3                   	ret
+
+0000000000805e55 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805e55:	55                   	push   %rbp
+  805e56:	48 89 e5             	mov    %rsp,%rbp
+  805e59:	48 83 ec 20          	sub    $0x20,%rsp
+  805e5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e60:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805e64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e67:	48 89 d6             	mov    %rdx,%rsi
+  805e6a:	89 c7                	mov    %eax,%edi
+  805e6c:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  805e73:	00 00 00 
+  805e76:	ff d0                	call   *%rax
+  805e78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e7f:	79 05                	jns    805e86 <iscons+0x31>
+    return r;
+  805e81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e84:	eb 1a                	jmp    805ea0 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805e86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805e8a:	8b 10                	mov    (%rax),%edx
+  805e8c:	48 b8 e0 80 80 00 00 	movabs $0x8080e0,%rax
+  805e93:	00 00 00 
+  805e96:	8b 00                	mov    (%rax),%eax
+  805e98:	39 c2                	cmp    %eax,%edx
+  805e9a:	0f 94 c0             	sete   %al
+  805e9d:	0f b6 c0             	movzbl %al,%eax
+}
+  805ea0:	c9                   	leave
+  805ea1:	c3                   	ret
+
+0000000000805ea2 <opencons>:
+
+int
+opencons(void) {
+  805ea2:	55                   	push   %rbp
+  805ea3:	48 89 e5             	mov    %rsp,%rbp
+  805ea6:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805eaa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805eae:	48 89 c7             	mov    %rax,%rdi
+  805eb1:	48 b8 cc 2c 80 00 00 	movabs $0x802ccc,%rax
+  805eb8:	00 00 00 
+  805ebb:	ff d0                	call   *%rax
+  805ebd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ec0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ec4:	79 05                	jns    805ecb <opencons+0x29>
+    return r;
+  805ec6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ec9:	eb 66                	jmp    805f31 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805ecb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ecf:	ba 07 04 00 00       	mov    $0x407,%edx
+  805ed4:	48 89 c6             	mov    %rax,%rsi
+  805ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  805edc:	48 b8 97 25 80 00 00 	movabs $0x802597,%rax
+  805ee3:	00 00 00 
+  805ee6:	ff d0                	call   *%rax
+  805ee8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805eeb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805eef:	79 05                	jns    805ef6 <opencons+0x54>
+    return r;
+  805ef1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ef4:	eb 3b                	jmp    805f31 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805ef6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805efa:	48 ba e0 80 80 00 00 	movabs $0x8080e0,%rdx
+  805f01:	00 00 00 
+  805f04:	8b 12                	mov    (%rdx),%edx
+  805f06:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805f08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805f13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f17:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805f1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f22:	48 89 c7             	mov    %rax,%rdi
+  805f25:	48 b8 7e 2c 80 00 00 	movabs $0x802c7e,%rax
+  805f2c:	00 00 00 
+  805f2f:	ff d0                	call   *%rax
+}
+  805f31:	c9                   	leave
+  805f32:	c3                   	ret
+
+0000000000805f33 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805f33:	55                   	push   %rbp
+  805f34:	48 89 e5             	mov    %rsp,%rbp
+  805f37:	48 83 ec 20          	sub    $0x20,%rsp
+  805f3b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f3e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805f41:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805f45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f48:	48 89 d6             	mov    %rdx,%rsi
+  805f4b:	89 c7                	mov    %eax,%edi
+  805f4d:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  805f54:	00 00 00 
+  805f57:	ff d0                	call   *%rax
+  805f59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f60:	79 05                	jns    805f67 <consmode+0x34>
+    return r;
+  805f62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f65:	eb 34                	jmp    805f9b <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805f67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f6b:	8b 10                	mov    (%rax),%edx
+  805f6d:	48 b8 e0 80 80 00 00 	movabs $0x8080e0,%rax
+  805f74:	00 00 00 
+  805f77:	8b 00                	mov    (%rax),%eax
+  805f79:	39 c2                	cmp    %eax,%edx
+  805f7b:	74 07                	je     805f84 <consmode+0x51>
+    return -E_INVAL;
+  805f7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805f82:	eb 17                	jmp    805f9b <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f88:	8b 40 0c             	mov    0xc(%rax),%eax
+  805f8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805f8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f92:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f95:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805f98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805f9b:	c9                   	leave
+  805f9c:	c3                   	ret
+
+0000000000805f9d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805f9d:	55                   	push   %rbp
+  805f9e:	48 89 e5             	mov    %rsp,%rbp
+  805fa1:	48 83 ec 20          	sub    $0x20,%rsp
+  805fa5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805fa9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805fad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fb5:	8b 50 0c             	mov    0xc(%rax),%edx
+  805fb8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805fbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805fc0:	48 89 ce             	mov    %rcx,%rsi
+  805fc3:	48 89 c7             	mov    %rax,%rdi
+  805fc6:	48 b8 f1 28 80 00 00 	movabs $0x8028f1,%rax
+  805fcd:	00 00 00 
+  805fd0:	ff d0                	call   *%rax
+  805fd2:	48 98                	cltq
+}
+  805fd4:	c9                   	leave
+  805fd5:	c3                   	ret
+
+0000000000805fd6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805fd6:	55                   	push   %rbp
+  805fd7:	48 89 e5             	mov    %rsp,%rbp
+  805fda:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805fe1:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805fe8:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805fef:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805ff6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805ffd:	eb 74                	jmp    806073 <devcons_write+0x9d>
+    m = n - tot;
+  805fff:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  806006:	89 c2                	mov    %eax,%edx
+  806008:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80600b:	29 c2                	sub    %eax,%edx
+  80600d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  806010:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806013:	83 f8 7f             	cmp    $0x7f,%eax
+  806016:	76 07                	jbe    80601f <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  806018:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80601f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806022:	48 63 d0             	movslq %eax,%rdx
+  806025:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806028:	48 63 c8             	movslq %eax,%rcx
+  80602b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  806032:	48 01 c1             	add    %rax,%rcx
+  806035:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80603c:	48 89 ce             	mov    %rcx,%rsi
+  80603f:	48 89 c7             	mov    %rax,%rdi
+  806042:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  806049:	00 00 00 
+  80604c:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80604e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806051:	48 63 d0             	movslq %eax,%rdx
+  806054:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80605b:	48 89 d6             	mov    %rdx,%rsi
+  80605e:	48 89 c7             	mov    %rax,%rdi
+  806061:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  806068:	00 00 00 
+  80606b:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80606d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806070:	01 45 fc             	add    %eax,-0x4(%rbp)
+  806073:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806076:	48 98                	cltq
+  806078:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  80607f:	0f 82 7a ff ff ff    	jb     805fff <devcons_write+0x29>
+  }
+  return tot;
+  806085:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806088:	48 98                	cltq
+}
+  80608a:	c9                   	leave
+  80608b:	c3                   	ret
+
+000000000080608c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80608c:	55                   	push   %rbp
+  80608d:	48 89 e5             	mov    %rsp,%rbp
+  806090:	48 83 ec 08          	sub    $0x8,%rsp
+  806094:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  806098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80609d:	c9                   	leave
+  80609e:	c3                   	ret
+
+000000000080609f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80609f:	55                   	push   %rbp
+  8060a0:	48 89 e5             	mov    %rsp,%rbp
+  8060a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8060a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8060ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8060af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8060b3:	48 ba 67 72 80 00 00 	movabs $0x807267,%rdx
+  8060ba:	00 00 00 
+  8060bd:	48 89 d6             	mov    %rdx,%rsi
+  8060c0:	48 89 c7             	mov    %rax,%rdi
+  8060c3:	48 b8 c9 17 80 00 00 	movabs $0x8017c9,%rax
+  8060ca:	00 00 00 
+  8060cd:	ff d0                	call   *%rax
+  return 0;
+  8060cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060d4:	c9                   	leave
+  8060d5:	c3                   	ret
+
+00000000008060d6 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8060d6:	55                   	push   %rbp
+  8060d7:	48 89 e5             	mov    %rsp,%rbp
+  8060da:	48 83 ec 30          	sub    $0x30,%rsp
+  8060de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060e2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8060e5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8060e9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8060f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060f3:	83 e0 02             	and    $0x2,%eax
+  8060f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8060f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060fd:	8b 40 0c             	mov    0xc(%rax),%eax
+  806100:	83 f8 01             	cmp    $0x1,%eax
+  806103:	75 04                	jne    806109 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  806105:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  806109:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80610c:	83 e0 01             	and    $0x1,%eax
+  80610f:	85 c0                	test   %eax,%eax
+  806111:	74 44                	je     806157 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  806113:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806116:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80611b:	89 c2                	mov    %eax,%edx
+  80611d:	be 00 00 00 00       	mov    $0x0,%esi
+  806122:	bf 00 00 00 00       	mov    $0x0,%edi
+  806127:	48 b8 df 29 80 00 00 	movabs $0x8029df,%rax
+  80612e:	00 00 00 
+  806131:	ff d0                	call   *%rax
+  806133:	83 f8 01             	cmp    $0x1,%eax
+  806136:	75 06                	jne    80613e <devcons_poll+0x68>
+      revents |= POLLIN;
+  806138:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80613c:	eb 19                	jmp    806157 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80613e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806142:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  806148:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80614b:	89 c2                	mov    %eax,%edx
+  80614d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806151:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  806157:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80615a:	c9                   	leave
+  80615b:	c3                   	ret
+
+000000000080615c <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80615c:	55                   	push   %rbp
+  80615d:	48 89 e5             	mov    %rsp,%rbp
+  806160:	48 83 ec 20          	sub    $0x20,%rsp
+  806164:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806168:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80616c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  806170:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806174:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  806178:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80617c:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  806183:	48 89 c7             	mov    %rax,%rdi
+  806186:	48 b8 94 61 80 00 00 	movabs $0x806194,%rax
+  80618d:	00 00 00 
+  806190:	ff d0                	call   *%rax
+}
+  806192:	c9                   	leave
+  806193:	c3                   	ret
+
+0000000000806194 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  806194:	55                   	push   %rbp
+  806195:	48 89 e5             	mov    %rsp,%rbp
+  806198:	48 83 ec 30          	sub    $0x30,%rsp
+  80619c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8061a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8061a4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8061a8:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8061ac:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8061b1:	75 0e                	jne    8061c1 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8061b3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8061ba:	00 00 00 
+  8061bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8061c1:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8061c6:	75 18                	jne    8061e0 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8061c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061cc:	48 89 c7             	mov    %rax,%rdi
+  8061cf:	48 b8 d7 27 80 00 00 	movabs $0x8027d7,%rax
+  8061d6:	00 00 00 
+  8061d9:	ff d0                	call   *%rax
+  8061db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8061de:	eb 1d                	jmp    8061fd <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8061e0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8061e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061e8:	48 89 d6             	mov    %rdx,%rsi
+  8061eb:	48 89 c7             	mov    %rax,%rdi
+  8061ee:	48 b8 1d 28 80 00 00 	movabs $0x80281d,%rax
+  8061f5:	00 00 00 
+  8061f8:	ff d0                	call   *%rax
+  8061fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8061fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806201:	79 2a                	jns    80622d <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  806203:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806208:	74 0a                	je     806214 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  80620a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80620e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  806214:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806219:	74 0a                	je     806225 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  80621b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80621f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  806225:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806228:	e9 aa 00 00 00       	jmp    8062d7 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80622d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806232:	74 36                	je     80626a <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  806234:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80623b:	00 00 00 
+  80623e:	8b 40 04             	mov    0x4(%rax),%eax
+  806241:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806246:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80624d:	00 00 00 
+  806250:	48 98                	cltq
+  806252:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806259:	48 01 d0             	add    %rdx,%rax
+  80625c:	48 05 24 01 00 00    	add    $0x124,%rax
+  806262:	8b 10                	mov    (%rax),%edx
+  806264:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806268:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80626a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80626f:	74 36                	je     8062a7 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  806271:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806278:	00 00 00 
+  80627b:	8b 40 04             	mov    0x4(%rax),%eax
+  80627e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806283:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80628a:	00 00 00 
+  80628d:	48 98                	cltq
+  80628f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806296:	48 01 d0             	add    %rdx,%rax
+  806299:	48 05 28 01 00 00    	add    $0x128,%rax
+  80629f:	8b 10                	mov    (%rax),%edx
+  8062a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062a5:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8062a7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8062ae:	00 00 00 
+  8062b1:	8b 40 04             	mov    0x4(%rax),%eax
+  8062b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8062b9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8062c0:	00 00 00 
+  8062c3:	48 98                	cltq
+  8062c5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8062cc:	48 01 d0             	add    %rdx,%rax
+  8062cf:	48 05 20 01 00 00    	add    $0x120,%rax
+  8062d5:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8062d7:	c9                   	leave
+  8062d8:	c3                   	ret
+
+00000000008062d9 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8062d9:	55                   	push   %rbp
+  8062da:	48 89 e5             	mov    %rsp,%rbp
+  8062dd:	48 83 ec 30          	sub    $0x30,%rsp
+  8062e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8062e4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8062e7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8062eb:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8062ee:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8062f3:	75 5e                	jne    806353 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8062f5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8062fc:	00 00 00 
+  8062ff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806303:	eb 4e                	jmp    806353 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806305:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806309:	79 3c                	jns    806347 <ipc_send+0x6e>
+  80630b:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80630f:	74 36                	je     806347 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  806311:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806314:	89 c1                	mov    %eax,%ecx
+  806316:	48 b8 70 72 80 00 00 	movabs $0x807270,%rax
+  80631d:	00 00 00 
+  806320:	48 89 c2             	mov    %rax,%rdx
+  806323:	be 54 00 00 00       	mov    $0x54,%esi
+  806328:	48 b8 96 72 80 00 00 	movabs $0x807296,%rax
+  80632f:	00 00 00 
+  806332:	48 89 c7             	mov    %rax,%rdi
+  806335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80633a:	49 b8 fa 05 80 00 00 	movabs $0x8005fa,%r8
+  806341:	00 00 00 
+  806344:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806347:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  80634e:	00 00 00 
+  806351:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806353:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806356:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806359:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80635d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806360:	89 c7                	mov    %eax,%edi
+  806362:	48 b8 80 27 80 00 00 	movabs $0x802780,%rax
+  806369:	00 00 00 
+  80636c:	ff d0                	call   *%rax
+  80636e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806371:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806375:	75 8e                	jne    806305 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806377:	48 b8 5a 25 80 00 00 	movabs $0x80255a,%rax
+  80637e:	00 00 00 
+  806381:	ff d0                	call   *%rax
+}
+  806383:	90                   	nop
+  806384:	c9                   	leave
+  806385:	c3                   	ret
+
+0000000000806386 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  806386:	55                   	push   %rbp
+  806387:	48 89 e5             	mov    %rsp,%rbp
+  80638a:	48 83 ec 18          	sub    $0x18,%rsp
+  80638e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  806391:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806398:	eb 4d                	jmp    8063e7 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80639a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063a1:	00 00 00 
+  8063a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8063a7:	48 98                	cltq
+  8063a9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8063b0:	48 01 d0             	add    %rdx,%rax
+  8063b3:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8063b9:	8b 00                	mov    (%rax),%eax
+  8063bb:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8063be:	75 23                	jne    8063e3 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8063c0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063c7:	00 00 00 
+  8063ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8063cd:	48 98                	cltq
+  8063cf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8063d6:	48 01 d0             	add    %rdx,%rax
+  8063d9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8063df:	8b 00                	mov    (%rax),%eax
+  8063e1:	eb 12                	jmp    8063f5 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8063e3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8063e7:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8063ee:	7e aa                	jle    80639a <ipc_find_env+0x14>
+  return 0;
+  8063f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063f5:	c9                   	leave
+  8063f6:	c3                   	ret
+
+00000000008063f7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8063f7:	55                   	push   %rbp
+  8063f8:	48 89 e5             	mov    %rsp,%rbp
+  8063fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8063ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806403:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806407:	48 c1 e8 27          	shr    $0x27,%rax
+  80640b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806410:	48 89 c2             	mov    %rax,%rdx
+  806413:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80641a:	01 00 00 
+  80641d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806421:	83 e0 01             	and    $0x1,%eax
+  806424:	48 85 c0             	test   %rax,%rax
+  806427:	74 63                	je     80648c <pageref+0x95>
+  806429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80642d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806431:	48 89 c2             	mov    %rax,%rdx
+  806434:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80643b:	01 00 00 
+  80643e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806442:	83 e0 01             	and    $0x1,%eax
+  806445:	48 85 c0             	test   %rax,%rax
+  806448:	74 42                	je     80648c <pageref+0x95>
+  80644a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80644e:	48 c1 e8 15          	shr    $0x15,%rax
+  806452:	48 89 c2             	mov    %rax,%rdx
+  806455:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80645c:	01 00 00 
+  80645f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806463:	83 e0 01             	and    $0x1,%eax
+  806466:	48 85 c0             	test   %rax,%rax
+  806469:	74 21                	je     80648c <pageref+0x95>
+  80646b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80646f:	48 c1 e8 0c          	shr    $0xc,%rax
+  806473:	48 89 c2             	mov    %rax,%rdx
+  806476:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80647d:	01 00 00 
+  806480:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806484:	83 e0 01             	and    $0x1,%eax
+  806487:	48 85 c0             	test   %rax,%rax
+  80648a:	75 07                	jne    806493 <pageref+0x9c>
+    return 0;
+  80648c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806491:	eb 53                	jmp    8064e6 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  806493:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806497:	48 c1 e8 0c          	shr    $0xc,%rax
+  80649b:	48 89 c2             	mov    %rax,%rdx
+  80649e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8064a5:	01 00 00 
+  8064a8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8064ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8064b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064b4:	83 e0 01             	and    $0x1,%eax
+  8064b7:	48 85 c0             	test   %rax,%rax
+  8064ba:	75 07                	jne    8064c3 <pageref+0xcc>
+    return 0;
+  8064bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064c1:	eb 23                	jmp    8064e6 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8064c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8064cb:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8064d2:	00 00 00 
+  8064d5:	48 c1 e0 04          	shl    $0x4,%rax
+  8064d9:	48 01 d0             	add    %rdx,%rax
+  8064dc:	48 83 c0 08          	add    $0x8,%rax
+  8064e0:	0f b7 00             	movzwl (%rax),%eax
+  8064e3:	0f b7 c0             	movzwl %ax,%eax
+}
+  8064e6:	c9                   	leave
+  8064e7:	c3                   	ret
+
+00000000008064e8 <xchg>:
+  8064e8:	55                   	push   %rbp
+  8064e9:	48 89 e5             	mov    %rsp,%rbp
+  8064ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8064f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8064f4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8064f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8064fb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8064fe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806502:	f0 87 02             	lock xchg %eax,(%rdx)
+  806505:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806508:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80650b:	c9                   	leave
+  80650c:	c3                   	ret
+
+000000000080650d <cmpxchg>:
+  80650d:	55                   	push   %rbp
+  80650e:	48 89 e5             	mov    %rsp,%rbp
+  806511:	48 83 ec 20          	sub    $0x20,%rsp
+  806515:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806519:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80651c:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  80651f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806523:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806526:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806529:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80652d:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806531:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806534:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806537:	c9                   	leave
+  806538:	c3                   	ret
+
+0000000000806539 <xadd>:
+  806539:	55                   	push   %rbp
+  80653a:	48 89 e5             	mov    %rsp,%rbp
+  80653d:	48 83 ec 10          	sub    $0x10,%rsp
+  806541:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806545:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806548:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80654c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80654f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806553:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  806557:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80655a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80655d:	c9                   	leave
+  80655e:	c3                   	ret
+
+000000000080655f <mutex_init>:
+mutex_init(struct Mutex *m) {
+  80655f:	55                   	push   %rbp
+  806560:	48 89 e5             	mov    %rsp,%rbp
+  806563:	48 83 ec 08          	sub    $0x8,%rsp
+  806567:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80656b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80656f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806575:	90                   	nop
+  806576:	c9                   	leave
+  806577:	c3                   	ret
+
+0000000000806578 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  806578:	55                   	push   %rbp
+  806579:	48 89 e5             	mov    %rsp,%rbp
+  80657c:	48 83 ec 20          	sub    $0x20,%rsp
+  806580:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806584:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806588:	ba 01 00 00 00       	mov    $0x1,%edx
+  80658d:	be 00 00 00 00       	mov    $0x0,%esi
+  806592:	48 89 c7             	mov    %rax,%rdi
+  806595:	48 b8 0d 65 80 00 00 	movabs $0x80650d,%rax
+  80659c:	00 00 00 
+  80659f:	ff d0                	call   *%rax
+  8065a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8065a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8065a8:	74 65                	je     80660f <mutex_lock+0x97>
+  if (c != 2)
+  8065aa:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8065ae:	74 57                	je     806607 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8065b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065b4:	be 02 00 00 00       	mov    $0x2,%esi
+  8065b9:	48 89 c7             	mov    %rax,%rdi
+  8065bc:	48 b8 e8 64 80 00 00 	movabs $0x8064e8,%rax
+  8065c3:	00 00 00 
+  8065c6:	ff d0                	call   *%rax
+  8065c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8065cb:	eb 3a                	jmp    806607 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8065cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065d1:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8065d8:	be 02 00 00 00       	mov    $0x2,%esi
+  8065dd:	48 89 c7             	mov    %rax,%rdi
+  8065e0:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  8065e7:	00 00 00 
+  8065ea:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8065ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065f0:	be 02 00 00 00       	mov    $0x2,%esi
+  8065f5:	48 89 c7             	mov    %rax,%rdi
+  8065f8:	48 b8 e8 64 80 00 00 	movabs $0x8064e8,%rax
+  8065ff:	00 00 00 
+  806602:	ff d0                	call   *%rax
+  806604:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806607:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80660b:	75 c0                	jne    8065cd <mutex_lock+0x55>
+  80660d:	eb 01                	jmp    806610 <mutex_lock+0x98>
+    return;
+  80660f:	90                   	nop
+}
+  806610:	c9                   	leave
+  806611:	c3                   	ret
+
+0000000000806612 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806612:	55                   	push   %rbp
+  806613:	48 89 e5             	mov    %rsp,%rbp
+  806616:	48 83 ec 08          	sub    $0x8,%rsp
+  80661a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80661e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806622:	ba 01 00 00 00       	mov    $0x1,%edx
+  806627:	be 00 00 00 00       	mov    $0x0,%esi
+  80662c:	48 89 c7             	mov    %rax,%rdi
+  80662f:	48 b8 0d 65 80 00 00 	movabs $0x80650d,%rax
+  806636:	00 00 00 
+  806639:	ff d0                	call   *%rax
+  80663b:	85 c0                	test   %eax,%eax
+  80663d:	75 07                	jne    806646 <mutex_trylock+0x34>
+  80663f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806644:	eb 05                	jmp    80664b <mutex_trylock+0x39>
+  806646:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80664b:	c9                   	leave
+  80664c:	c3                   	ret
+
+000000000080664d <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  80664d:	55                   	push   %rbp
+  80664e:	48 89 e5             	mov    %rsp,%rbp
+  806651:	48 83 ec 10          	sub    $0x10,%rsp
+  806655:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806659:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80665d:	be 00 00 00 00       	mov    $0x0,%esi
+  806662:	48 89 c7             	mov    %rax,%rdi
+  806665:	48 b8 e8 64 80 00 00 	movabs $0x8064e8,%rax
+  80666c:	00 00 00 
+  80666f:	ff d0                	call   *%rax
+  806671:	83 f8 02             	cmp    $0x2,%eax
+  806674:	75 18                	jne    80668e <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80667a:	be 01 00 00 00       	mov    $0x1,%esi
+  80667f:	48 89 c7             	mov    %rax,%rdi
+  806682:	48 b8 92 29 80 00 00 	movabs $0x802992,%rax
+  806689:	00 00 00 
+  80668c:	ff d0                	call   *%rax
+}
+  80668e:	90                   	nop
+  80668f:	c9                   	leave
+  806690:	c3                   	ret
+
+0000000000806691 <cond_init>:
+cond_init(struct Cond *c) {
+  806691:	55                   	push   %rbp
+  806692:	48 89 e5             	mov    %rsp,%rbp
+  806695:	48 83 ec 08          	sub    $0x8,%rsp
+  806699:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  80669d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066a1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8066a7:	90                   	nop
+  8066a8:	c9                   	leave
+  8066a9:	c3                   	ret
+
+00000000008066aa <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8066aa:	55                   	push   %rbp
+  8066ab:	48 89 e5             	mov    %rsp,%rbp
+  8066ae:	48 83 ec 30          	sub    $0x30,%rsp
+  8066b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8066b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8066ba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8066be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066c2:	8b 00                	mov    (%rax),%eax
+  8066c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8066c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066cb:	48 89 c7             	mov    %rax,%rdi
+  8066ce:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  8066d5:	00 00 00 
+  8066d8:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8066da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8066e2:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8066e5:	89 ce                	mov    %ecx,%esi
+  8066e7:	48 89 c7             	mov    %rax,%rdi
+  8066ea:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  8066f1:	00 00 00 
+  8066f4:	ff d0                	call   *%rax
+  8066f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8066f9:	eb 1f                	jmp    80671a <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8066fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066ff:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806706:	be 02 00 00 00       	mov    $0x2,%esi
+  80670b:	48 89 c7             	mov    %rax,%rdi
+  80670e:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  806715:	00 00 00 
+  806718:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  80671a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80671e:	be 02 00 00 00       	mov    $0x2,%esi
+  806723:	48 89 c7             	mov    %rax,%rdi
+  806726:	48 b8 e8 64 80 00 00 	movabs $0x8064e8,%rax
+  80672d:	00 00 00 
+  806730:	ff d0                	call   *%rax
+  806732:	85 c0                	test   %eax,%eax
+  806734:	75 c5                	jne    8066fb <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806736:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80673a:	75 07                	jne    806743 <cond_timedwait+0x99>
+  80673c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806741:	eb 05                	jmp    806748 <cond_timedwait+0x9e>
+  806743:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806748:	c9                   	leave
+  806749:	c3                   	ret
+
+000000000080674a <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80674a:	55                   	push   %rbp
+  80674b:	48 89 e5             	mov    %rsp,%rbp
+  80674e:	48 83 ec 10          	sub    $0x10,%rsp
+  806752:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806756:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80675a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80675e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806762:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806769:	48 89 ce             	mov    %rcx,%rsi
+  80676c:	48 89 c7             	mov    %rax,%rdi
+  80676f:	48 b8 aa 66 80 00 00 	movabs $0x8066aa,%rax
+  806776:	00 00 00 
+  806779:	ff d0                	call   *%rax
+}
+  80677b:	90                   	nop
+  80677c:	c9                   	leave
+  80677d:	c3                   	ret
+
+000000000080677e <cond_signal>:
+cond_signal(struct Cond *c) {
+  80677e:	55                   	push   %rbp
+  80677f:	48 89 e5             	mov    %rsp,%rbp
+  806782:	48 83 ec 10          	sub    $0x10,%rsp
+  806786:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80678a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80678e:	be 01 00 00 00       	mov    $0x1,%esi
+  806793:	48 89 c7             	mov    %rax,%rdi
+  806796:	48 b8 39 65 80 00 00 	movabs $0x806539,%rax
+  80679d:	00 00 00 
+  8067a0:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8067a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8067ab:	48 89 c7             	mov    %rax,%rdi
+  8067ae:	48 b8 92 29 80 00 00 	movabs $0x802992,%rax
+  8067b5:	00 00 00 
+  8067b8:	ff d0                	call   *%rax
+}
+  8067ba:	90                   	nop
+  8067bb:	c9                   	leave
+  8067bc:	c3                   	ret
+
+00000000008067bd <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8067bd:	55                   	push   %rbp
+  8067be:	48 89 e5             	mov    %rsp,%rbp
+  8067c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8067c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8067c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8067d2:	48 89 c7             	mov    %rax,%rdi
+  8067d5:	48 b8 39 65 80 00 00 	movabs $0x806539,%rax
+  8067dc:	00 00 00 
+  8067df:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8067e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067e5:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8067ea:	48 89 c7             	mov    %rax,%rdi
+  8067ed:	48 b8 92 29 80 00 00 	movabs $0x802992,%rax
+  8067f4:	00 00 00 
+  8067f7:	ff d0                	call   *%rax
+}
+  8067f9:	90                   	nop
+  8067fa:	c9                   	leave
+  8067fb:	c3                   	ret
+
+00000000008067fc <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8067fc:	55                   	push   %rbp
+  8067fd:	48 89 e5             	mov    %rsp,%rbp
+  806800:	48 83 ec 10          	sub    $0x10,%rsp
+  806804:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806808:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80680b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80680f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806812:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806818:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  80681f:	90                   	nop
+  806820:	c9                   	leave
+  806821:	c3                   	ret
+
+0000000000806822 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806822:	55                   	push   %rbp
+  806823:	48 89 e5             	mov    %rsp,%rbp
+  806826:	48 83 ec 18          	sub    $0x18,%rsp
+  80682a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80682e:	eb 2a                	jmp    80685a <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806830:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806833:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80683a:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80683d:	89 ce                	mov    %ecx,%esi
+  80683f:	48 89 c7             	mov    %rax,%rdi
+  806842:	48 b8 0d 65 80 00 00 	movabs $0x80650d,%rax
+  806849:	00 00 00 
+  80684c:	ff d0                	call   *%rax
+  80684e:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806851:	75 07                	jne    80685a <sem_trywait+0x38>
+      return 0;
+  806853:	b8 00 00 00 00       	mov    $0x0,%eax
+  806858:	eb 14                	jmp    80686e <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80685a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80685e:	8b 00                	mov    (%rax),%eax
+  806860:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806863:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806867:	75 c7                	jne    806830 <sem_trywait+0xe>
+  return -E_BUSY;
+  806869:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80686e:	c9                   	leave
+  80686f:	c3                   	ret
+
+0000000000806870 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806870:	55                   	push   %rbp
+  806871:	48 89 e5             	mov    %rsp,%rbp
+  806874:	48 83 ec 30          	sub    $0x30,%rsp
+  806878:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80687c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806880:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806887:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  806888:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80688d:	0f 84 fb 00 00 00    	je     80698e <sem_timedwait+0x11e>
+  806893:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806898:	0f 84 f0 00 00 00    	je     80698e <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80689e:	48 b8 6b 5d 80 00 00 	movabs $0x805d6b,%rax
+  8068a5:	00 00 00 
+  8068a8:	ff d0                	call   *%rax
+  8068aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8068ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8068b2:	48 f7 d0             	not    %rax
+  8068b5:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8068b9:	73 0d                	jae    8068c8 <sem_timedwait+0x58>
+  8068bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8068bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068c3:	48 01 d0             	add    %rdx,%rax
+  8068c6:	eb 07                	jmp    8068cf <sem_timedwait+0x5f>
+  8068c8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8068cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8068d3:	e9 b6 00 00 00       	jmp    80698e <sem_timedwait+0x11e>
+    if (deadline) {
+  8068d8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8068dd:	74 2d                	je     80690c <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8068df:	48 b8 6b 5d 80 00 00 	movabs $0x805d6b,%rax
+  8068e6:	00 00 00 
+  8068e9:	ff d0                	call   *%rax
+  8068eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8068ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8068f3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8068f7:	73 0a                	jae    806903 <sem_timedwait+0x93>
+  8068f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8068fd:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  806901:	eb 05                	jmp    806908 <sem_timedwait+0x98>
+  806903:	b8 00 00 00 00       	mov    $0x0,%eax
+  806908:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80690c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806910:	48 83 c0 04          	add    $0x4,%rax
+  806914:	be 01 00 00 00       	mov    $0x1,%esi
+  806919:	48 89 c7             	mov    %rax,%rdi
+  80691c:	48 b8 39 65 80 00 00 	movabs $0x806539,%rax
+  806923:	00 00 00 
+  806926:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806928:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80692c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806930:	be 00 00 00 00       	mov    $0x0,%esi
+  806935:	48 89 c7             	mov    %rax,%rdi
+  806938:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  80693f:	00 00 00 
+  806942:	ff d0                	call   *%rax
+  806944:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806947:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80694b:	48 83 c0 04          	add    $0x4,%rax
+  80694f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806954:	48 89 c7             	mov    %rax,%rdi
+  806957:	48 b8 39 65 80 00 00 	movabs $0x806539,%rax
+  80695e:	00 00 00 
+  806961:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806963:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  806967:	75 25                	jne    80698e <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  806969:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80696d:	48 89 c7             	mov    %rax,%rdi
+  806970:	48 b8 22 68 80 00 00 	movabs $0x806822,%rax
+  806977:	00 00 00 
+  80697a:	ff d0                	call   *%rax
+  80697c:	85 c0                	test   %eax,%eax
+  80697e:	79 07                	jns    806987 <sem_timedwait+0x117>
+  806980:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806985:	eb 27                	jmp    8069ae <sem_timedwait+0x13e>
+  806987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80698c:	eb 20                	jmp    8069ae <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80698e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806992:	48 89 c7             	mov    %rax,%rdi
+  806995:	48 b8 22 68 80 00 00 	movabs $0x806822,%rax
+  80699c:	00 00 00 
+  80699f:	ff d0                	call   *%rax
+  8069a1:	85 c0                	test   %eax,%eax
+  8069a3:	0f 88 2f ff ff ff    	js     8068d8 <sem_timedwait+0x68>
+  return 0;
+  8069a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8069ae:	c9                   	leave
+  8069af:	c3                   	ret
+
+00000000008069b0 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8069b0:	55                   	push   %rbp
+  8069b1:	48 89 e5             	mov    %rsp,%rbp
+  8069b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8069b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8069bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8069c0:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8069c7:	48 89 c7             	mov    %rax,%rdi
+  8069ca:	48 b8 70 68 80 00 00 	movabs $0x806870,%rax
+  8069d1:	00 00 00 
+  8069d4:	ff d0                	call   *%rax
+}
+  8069d6:	90                   	nop
+  8069d7:	c9                   	leave
+  8069d8:	c3                   	ret
+
+00000000008069d9 <sem_post>:
+sem_post(struct Semaphore *s) {
+  8069d9:	55                   	push   %rbp
+  8069da:	48 89 e5             	mov    %rsp,%rbp
+  8069dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8069e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8069e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8069e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8069ee:	48 89 c7             	mov    %rax,%rdi
+  8069f1:	48 b8 39 65 80 00 00 	movabs $0x806539,%rax
+  8069f8:	00 00 00 
+  8069fb:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8069fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806a01:	8b 40 04             	mov    0x4(%rax),%eax
+  806a04:	85 c0                	test   %eax,%eax
+  806a06:	74 18                	je     806a20 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806a08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806a0c:	be 01 00 00 00       	mov    $0x1,%esi
+  806a11:	48 89 c7             	mov    %rax,%rdi
+  806a14:	48 b8 92 29 80 00 00 	movabs $0x802992,%rax
+  806a1b:	00 00 00 
+  806a1e:	ff d0                	call   *%rax
+}
+  806a20:	90                   	nop
+  806a21:	c9                   	leave
+  806a22:	c3                   	ret
+  806a23:	90                   	nop
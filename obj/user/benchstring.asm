@@ -0,0 +1,8359 @@
+
+obj/user/benchstring:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 03 04 00 00       	call   80042f <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <run>:
+
+enum { B_MEMCPY, B_MEMSET, B_MEMCMP, B_STRLEN, B_MEMFIND, NBENCH };
+static const char *names[NBENCH] = {"memcpy", "memset", "memcmp", "strlen", "memfind"};
+
+static uint64_t
+run(int bench, size_t n, int iters) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 50          	sub    $0x50,%rsp
+  80003a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80003d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  800041:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  volatile uint64_t sink = 0;
+  800044:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80004b:	00 
+  uint64_t start;
+  int i;
+
+  src[n] = 0;
+  80004c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800053:	00 00 00 
+  800056:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80005a:	48 01 d0             	add    %rdx,%rax
+  80005d:	c6 00 00             	movb   $0x0,(%rax)
+  // memset leaves dst different from src, and memcmp would stop at
+  // the first byte: make them equal so it compares all n.
+  if (bench == B_MEMCMP)
+  800060:	83 7d bc 02          	cmpl   $0x2,-0x44(%rbp)
+  800064:	75 2d                	jne    800093 <run+0x61>
+    memcpy(dst, src, n);
+  800066:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80006a:	48 89 c2             	mov    %rax,%rdx
+  80006d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800074:	00 00 00 
+  800077:	48 89 c6             	mov    %rax,%rsi
+  80007a:	48 b8 40 70 81 00 00 	movabs $0x817040,%rax
+  800081:	00 00 00 
+  800084:	48 89 c7             	mov    %rax,%rdi
+  800087:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  800093:	0f 31                	rdtsc
+  800095:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800098:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80009b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80009e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8000a1:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000a5:	48 09 d0             	or     %rdx,%rax
+  8000a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8000ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  start = read_tsc();
+  8000b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < iters; i++) {
+  8000b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000bb:	e9 2b 01 00 00       	jmp    8001eb <run+0x1b9>
+    switch (bench) {
+  8000c0:	83 7d bc 04          	cmpl   $0x4,-0x44(%rbp)
+  8000c4:	0f 87 1d 01 00 00    	ja     8001e7 <run+0x1b5>
+  8000ca:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8000cd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8000d4:	00 
+  8000d5:	48 b8 f8 53 80 00 00 	movabs $0x8053f8,%rax
+  8000dc:	00 00 00 
+  8000df:	48 01 d0             	add    %rdx,%rax
+  8000e2:	48 8b 00             	mov    (%rax),%rax
+  8000e5:	ff e0                	jmp    *%rax
+    case B_MEMCPY:
+      memcpy(dst, src, n);
+  8000e7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8000eb:	48 89 c2             	mov    %rax,%rdx
+  8000ee:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f5:	00 00 00 
+  8000f8:	48 89 c6             	mov    %rax,%rsi
+  8000fb:	48 b8 40 70 81 00 00 	movabs $0x817040,%rax
+  800102:	00 00 00 
+  800105:	48 89 c7             	mov    %rax,%rdi
+  800108:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+      break;
+  800114:	e9 ce 00 00 00       	jmp    8001e7 <run+0x1b5>
+    case B_MEMSET:
+      memset(dst, i, n);
+  800119:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80011d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	48 b8 40 70 81 00 00 	movabs $0x817040,%rax
+  800129:	00 00 00 
+  80012c:	48 89 c7             	mov    %rax,%rdi
+  80012f:	48 b8 c2 19 80 00 00 	movabs $0x8019c2,%rax
+  800136:	00 00 00 
+  800139:	ff d0                	call   *%rax
+      break;
+  80013b:	e9 a7 00 00 00       	jmp    8001e7 <run+0x1b5>
+    case B_MEMCMP:
+      sink += memcmp(dst, src, n);
+  800140:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800144:	48 89 c2             	mov    %rax,%rdx
+  800147:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80014e:	00 00 00 
+  800151:	48 89 c6             	mov    %rax,%rsi
+  800154:	48 b8 40 70 81 00 00 	movabs $0x817040,%rax
+  80015b:	00 00 00 
+  80015e:	48 89 c7             	mov    %rax,%rdi
+  800161:	48 b8 08 1d 80 00 00 	movabs $0x801d08,%rax
+  800168:	00 00 00 
+  80016b:	ff d0                	call   *%rax
+  80016d:	48 63 d0             	movslq %eax,%rdx
+  800170:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800174:	48 01 d0             	add    %rdx,%rax
+  800177:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      break;
+  80017b:	eb 6a                	jmp    8001e7 <run+0x1b5>
+    case B_STRLEN:
+      sink += strlen(src);
+  80017d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800184:	00 00 00 
+  800187:	48 89 c7             	mov    %rax,%rdi
+  80018a:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  800191:	00 00 00 
+  800194:	ff d0                	call   *%rax
+  800196:	48 63 d0             	movslq %eax,%rdx
+  800199:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80019d:	48 01 d0             	add    %rdx,%rax
+  8001a0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      break;
+  8001a4:	eb 41                	jmp    8001e7 <run+0x1b5>
+    case B_MEMFIND:
+      sink += (char *)memfind(src, 0, n) - src;
+  8001a6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8001aa:	48 89 c2             	mov    %rax,%rdx
+  8001ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8001b9:	00 00 00 
+  8001bc:	48 89 c7             	mov    %rax,%rdi
+  8001bf:	48 b8 35 1e 80 00 00 	movabs $0x801e35,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8001d2:	00 00 00 
+  8001d5:	48 29 d0             	sub    %rdx,%rax
+  8001d8:	48 89 c2             	mov    %rax,%rdx
+  8001db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001df:	48 01 d0             	add    %rdx,%rax
+  8001e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      break;
+  8001e6:	90                   	nop
+  for (i = 0; i < iters; i++) {
+  8001e7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8001eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001ee:	3b 45 b8             	cmp    -0x48(%rbp),%eax
+  8001f1:	0f 8c c9 fe ff ff    	jl     8000c0 <run+0x8e>
+    }
+  }
+  src[n] = 'x';
+  8001f7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8001fe:	00 00 00 
+  800201:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800205:	48 01 d0             	add    %rdx,%rax
+  800208:	c6 00 78             	movb   $0x78,(%rax)
+  __asm __volatile("rdtsc"
+  80020b:	0f 31                	rdtsc
+  80020d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800210:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  800213:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800216:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800219:	48 c1 e2 20          	shl    $0x20,%rdx
+  80021d:	48 09 d0             	or     %rdx,%rax
+  800220:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  return res;
+  800224:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  return (read_tsc() - start) / iters;
+  800228:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80022c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80022f:	48 63 ca             	movslq %edx,%rcx
+  800232:	ba 00 00 00 00       	mov    $0x0,%edx
+  800237:	48 f7 f1             	div    %rcx
+}
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+000000000080023c <umain>:
+
+void
+umain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	48 83 ec 30          	sub    $0x30,%rsp
+  800244:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800247:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  size_t i;
+  int b, iters;
+
+  memset(src, 'x', sizeof(src));
+  80024b:	ba 40 00 01 00       	mov    $0x10040,%edx
+  800250:	be 78 00 00 00       	mov    $0x78,%esi
+  800255:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80025c:	00 00 00 
+  80025f:	48 89 c7             	mov    %rax,%rdi
+  800262:	48 b8 c2 19 80 00 00 	movabs $0x8019c2,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+  memcpy(dst, src, sizeof(dst));
+  80026e:	ba 40 00 01 00       	mov    $0x10040,%edx
+  800273:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80027a:	00 00 00 
+  80027d:	48 89 c6             	mov    %rax,%rsi
+  800280:	48 b8 40 70 81 00 00 	movabs $0x817040,%rax
+  800287:	00 00 00 
+  80028a:	48 89 c7             	mov    %rax,%rdi
+  80028d:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  800294:	00 00 00 
+  800297:	ff d0                	call   *%rax
+
+  cprintf("%-8s", "size");
+  800299:	48 b8 20 54 80 00 00 	movabs $0x805420,%rax
+  8002a0:	00 00 00 
+  8002a3:	48 89 c6             	mov    %rax,%rsi
+  8002a6:	48 b8 25 54 80 00 00 	movabs $0x805425,%rax
+  8002ad:	00 00 00 
+  8002b0:	48 89 c7             	mov    %rax,%rdi
+  8002b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b8:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  8002bf:	00 00 00 
+  8002c2:	ff d2                	call   *%rdx
+  for (b = 0; b < NBENCH; b++)
+  8002c4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8002cb:	eb 38                	jmp    800305 <umain+0xc9>
+    cprintf("%10s", names[b]);
+  8002cd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8002d4:	00 00 00 
+  8002d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8002da:	48 98                	cltq
+  8002dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8002e0:	48 89 c6             	mov    %rax,%rsi
+  8002e3:	48 b8 2a 54 80 00 00 	movabs $0x80542a,%rax
+  8002ea:	00 00 00 
+  8002ed:	48 89 c7             	mov    %rax,%rdi
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f5:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  8002fc:	00 00 00 
+  8002ff:	ff d2                	call   *%rdx
+  for (b = 0; b < NBENCH; b++)
+  800301:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  800305:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+  800309:	7e c2                	jle    8002cd <umain+0x91>
+  cprintf("   (cycles per call)\n");
+  80030b:	48 b8 2f 54 80 00 00 	movabs $0x80542f,%rax
+  800312:	00 00 00 
+  800315:	48 89 c7             	mov    %rax,%rdi
+  800318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031d:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  800324:	00 00 00 
+  800327:	ff d2                	call   *%rdx
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+  800329:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800330:	00 
+  800331:	e9 ea 00 00 00       	jmp    800420 <umain+0x1e4>
+    iters = MAX(8, (int)(4 * 1024 * 1024 / sizes[i]));
+  800336:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%rbp)
+  80033d:	48 ba a0 53 80 00 00 	movabs $0x8053a0,%rdx
+  800344:	00 00 00 
+  800347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80034b:	48 8b 0c c2          	mov    (%rdx,%rax,8),%rcx
+  80034f:	b8 00 00 40 00       	mov    $0x400000,%eax
+  800354:	ba 00 00 00 00       	mov    $0x0,%edx
+  800359:	48 f7 f1             	div    %rcx
+  80035c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80035f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800362:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800365:	39 c2                	cmp    %eax,%edx
+  800367:	0f 4d c2             	cmovge %edx,%eax
+  80036a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    cprintf("%-8ld", (long)sizes[i]);
+  80036d:	48 ba a0 53 80 00 00 	movabs $0x8053a0,%rdx
+  800374:	00 00 00 
+  800377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80037b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80037f:	48 89 c6             	mov    %rax,%rsi
+  800382:	48 b8 45 54 80 00 00 	movabs $0x805445,%rax
+  800389:	00 00 00 
+  80038c:	48 89 c7             	mov    %rax,%rdi
+  80038f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800394:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  80039b:	00 00 00 
+  80039e:	ff d2                	call   *%rdx
+    for (b = 0; b < NBENCH; b++)
+  8003a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8003a7:	eb 4e                	jmp    8003f7 <umain+0x1bb>
+      cprintf("%10ld", (long)run(b, sizes[i], iters));
+  8003a9:	48 ba a0 53 80 00 00 	movabs $0x8053a0,%rdx
+  8003b0:	00 00 00 
+  8003b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003b7:	48 8b 0c c2          	mov    (%rdx,%rax,8),%rcx
+  8003bb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8003be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8003c1:	48 89 ce             	mov    %rcx,%rsi
+  8003c4:	89 c7                	mov    %eax,%edi
+  8003c6:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003cd:	00 00 00 
+  8003d0:	ff d0                	call   *%rax
+  8003d2:	48 89 c6             	mov    %rax,%rsi
+  8003d5:	48 b8 4b 54 80 00 00 	movabs $0x80544b,%rax
+  8003dc:	00 00 00 
+  8003df:	48 89 c7             	mov    %rax,%rdi
+  8003e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e7:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  8003ee:	00 00 00 
+  8003f1:	ff d2                	call   *%rdx
+    for (b = 0; b < NBENCH; b++)
+  8003f3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8003f7:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+  8003fb:	7e ac                	jle    8003a9 <umain+0x16d>
+    cprintf("\n");
+  8003fd:	48 b8 51 54 80 00 00 	movabs $0x805451,%rax
+  800404:	00 00 00 
+  800407:	48 89 c7             	mov    %rax,%rdi
+  80040a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040f:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  800416:	00 00 00 
+  800419:	ff d2                	call   *%rdx
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+  80041b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800420:	48 83 7d f8 05       	cmpq   $0x5,-0x8(%rbp)
+  800425:	0f 86 0b ff ff ff    	jbe    800336 <umain+0xfa>
+  }
+}
+  80042b:	90                   	nop
+  80042c:	90                   	nop
+  80042d:	c9                   	leave
+  80042e:	c3                   	ret
+
+000000000080042f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	48 83 ec 20          	sub    $0x20,%rsp
+  800437:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80043a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80043e:	48 b8 20 61 80 00 00 	movabs $0x806120,%rax
+  800445:	00 00 00 
+  800448:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80044c:	eb 13                	jmp    800461 <libmain+0x32>
+    (*ctor)();
+  80044e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800452:	48 8b 10             	mov    (%rax),%rdx
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	ff d2                	call   *%rdx
+    ctor++;
+  80045c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800461:	48 b8 20 61 80 00 00 	movabs $0x806120,%rax
+  800468:	00 00 00 
+  80046b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80046f:	72 dd                	jb     80044e <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800471:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800475:	7e 14                	jle    80048b <libmain+0x5c>
+    binaryname = argv[0];
+  800477:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80047b:	48 8b 00             	mov    (%rax),%rax
+  80047e:	48 ba 28 60 80 00 00 	movabs $0x806028,%rdx
+  800485:	00 00 00 
+  800488:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80048b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80048f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800492:	48 89 d6             	mov    %rdx,%rsi
+  800495:	89 c7                	mov    %eax,%edi
+  800497:	48 b8 3c 02 80 00 00 	movabs $0x80023c,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8004a3:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+#endif
+}
+  8004af:	90                   	nop
+  8004b0:	c9                   	leave
+  8004b1:	c3                   	ret
+
+00000000008004b2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8004b6:	48 b8 30 2e 80 00 00 	movabs $0x802e30,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8004c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004c7:	48 b8 11 22 80 00 00 	movabs $0x802211,%rax
+  8004ce:	00 00 00 
+  8004d1:	ff d0                	call   *%rax
+}
+  8004d3:	90                   	nop
+  8004d4:	5d                   	pop    %rbp
+  8004d5:	c3                   	ret
+
+00000000008004d6 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8004d6:	55                   	push   %rbp
+  8004d7:	48 89 e5             	mov    %rsp,%rbp
+  8004da:	48 83 ec 10          	sub    $0x10,%rsp
+  8004de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8004e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004e9:	8b 00                	mov    (%rax),%eax
+  8004eb:	8d 48 01             	lea    0x1(%rax),%ecx
+  8004ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004f2:	89 0a                	mov    %ecx,(%rdx)
+  8004f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8004f7:	89 d1                	mov    %edx,%ecx
+  8004f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004fd:	48 98                	cltq
+  8004ff:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800507:	8b 00                	mov    (%rax),%eax
+  800509:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80050e:	75 2c                	jne    80053c <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800510:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800514:	8b 00                	mov    (%rax),%eax
+  800516:	48 98                	cltq
+  800518:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80051c:	48 83 c2 08          	add    $0x8,%rdx
+  800520:	48 89 c6             	mov    %rax,%rsi
+  800523:	48 89 d7             	mov    %rdx,%rdi
+  800526:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  80052d:	00 00 00 
+  800530:	ff d0                	call   *%rax
+    b->idx = 0;
+  800532:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800536:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80053c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800540:	8b 40 04             	mov    0x4(%rax),%eax
+  800543:	8d 50 01             	lea    0x1(%rax),%edx
+  800546:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80054a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80054d:	90                   	nop
+  80054e:	c9                   	leave
+  80054f:	c3                   	ret
+
+0000000000800550 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800550:	55                   	push   %rbp
+  800551:	48 89 e5             	mov    %rsp,%rbp
+  800554:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80055b:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800562:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800569:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800570:	00 00 00 
+  b.cnt = 0;
+  800573:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80057a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80057d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800584:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80058b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800592:	48 89 c6             	mov    %rax,%rsi
+  800595:	48 b8 d6 04 80 00 00 	movabs $0x8004d6,%rax
+  80059c:	00 00 00 
+  80059f:	48 89 c7             	mov    %rax,%rdi
+  8005a2:	48 b8 35 09 80 00 00 	movabs $0x800935,%rax
+  8005a9:	00 00 00 
+  8005ac:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8005ae:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8005b4:	48 98                	cltq
+  8005b6:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8005bd:	48 83 c2 08          	add    $0x8,%rdx
+  8005c1:	48 89 c6             	mov    %rax,%rsi
+  8005c4:	48 89 d7             	mov    %rdx,%rdi
+  8005c7:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  8005ce:	00 00 00 
+  8005d1:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8005d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8005d9:	c9                   	leave
+  8005da:	c3                   	ret
+
+00000000008005db <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005db:	55                   	push   %rbp
+  8005dc:	48 89 e5             	mov    %rsp,%rbp
+  8005df:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8005e6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8005ed:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8005f4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8005fb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800602:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800609:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800610:	84 c0                	test   %al,%al
+  800612:	74 20                	je     800634 <cprintf+0x59>
+  800614:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800618:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80061c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800620:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800624:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800628:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80062c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800630:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800634:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80063b:	00 00 00 
+  80063e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800645:	00 00 00 
+  800648:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80064c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800653:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80065a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800661:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800668:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80066f:	48 89 d6             	mov    %rdx,%rsi
+  800672:	48 89 c7             	mov    %rax,%rdi
+  800675:	48 b8 50 05 80 00 00 	movabs $0x800550,%rax
+  80067c:	00 00 00 
+  80067f:	ff d0                	call   *%rax
+  800681:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800687:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80068d:	c9                   	leave
+  80068e:	c3                   	ret
+
+000000000080068f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80068f:	55                   	push   %rbp
+  800690:	48 89 e5             	mov    %rsp,%rbp
+  800693:	48 83 ec 30          	sub    $0x30,%rsp
+  800697:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80069b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80069f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8006a3:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8006a6:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8006aa:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8006ae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8006b1:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8006b5:	72 54                	jb     80070b <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006b7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8006ba:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006bd:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8006c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c9:	48 f7 f6             	div    %rsi
+  8006cc:	49 89 c2             	mov    %rax,%r10
+  8006cf:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8006d2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8006d5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8006d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006dd:	41 89 c9             	mov    %ecx,%r9d
+  8006e0:	41 89 f8             	mov    %edi,%r8d
+  8006e3:	89 d1                	mov    %edx,%ecx
+  8006e5:	4c 89 d2             	mov    %r10,%rdx
+  8006e8:	48 89 c7             	mov    %rax,%rdi
+  8006eb:	48 b8 8f 06 80 00 00 	movabs $0x80068f,%rax
+  8006f2:	00 00 00 
+  8006f5:	ff d0                	call   *%rax
+  8006f7:	eb 1c                	jmp    800715 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8006f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800700:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800704:	48 89 d6             	mov    %rdx,%rsi
+  800707:	89 c7                	mov    %eax,%edi
+  800709:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80070b:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80070f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800713:	7f e4                	jg     8006f9 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800715:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800721:	48 f7 f1             	div    %rcx
+  800724:	48 b8 90 56 80 00 00 	movabs $0x805690,%rax
+  80072b:	00 00 00 
+  80072e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800732:	0f be c0             	movsbl %al,%eax
+  800735:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800739:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80073d:	48 89 d6             	mov    %rdx,%rsi
+  800740:	89 c7                	mov    %eax,%edi
+  800742:	ff d1                	call   *%rcx
+}
+  800744:	90                   	nop
+  800745:	c9                   	leave
+  800746:	c3                   	ret
+
+0000000000800747 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800747:	55                   	push   %rbp
+  800748:	48 89 e5             	mov    %rsp,%rbp
+  80074b:	48 83 ec 10          	sub    $0x10,%rsp
+  80074f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800753:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800756:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80075a:	7e 4b                	jle    8007a7 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80075c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800760:	8b 00                	mov    (%rax),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	77 24                	ja     80078b <getuint+0x44>
+  800767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80076b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80076f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800773:	8b 00                	mov    (%rax),%eax
+  800775:	89 c0                	mov    %eax,%eax
+  800777:	48 01 d0             	add    %rdx,%rax
+  80077a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80077e:	8b 12                	mov    (%rdx),%edx
+  800780:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800783:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800787:	89 0a                	mov    %ecx,(%rdx)
+  800789:	eb 14                	jmp    80079f <getuint+0x58>
+  80078b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800793:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800797:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80079b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80079f:	48 8b 00             	mov    (%rax),%rax
+  8007a2:	e9 95 00 00 00       	jmp    80083c <getuint+0xf5>
+  else if (lflag)
+  8007a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007ab:	74 48                	je     8007f5 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8007ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b1:	8b 00                	mov    (%rax),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 24                	ja     8007dc <getuint+0x95>
+  8007b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007bc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c4:	8b 00                	mov    (%rax),%eax
+  8007c6:	89 c0                	mov    %eax,%eax
+  8007c8:	48 01 d0             	add    %rdx,%rax
+  8007cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007cf:	8b 12                	mov    (%rdx),%edx
+  8007d1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007d8:	89 0a                	mov    %ecx,(%rdx)
+  8007da:	eb 14                	jmp    8007f0 <getuint+0xa9>
+  8007dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007e4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ec:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007f0:	48 8b 00             	mov    (%rax),%rax
+  8007f3:	eb 47                	jmp    80083c <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8007f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f9:	8b 00                	mov    (%rax),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	77 24                	ja     800824 <getuint+0xdd>
+  800800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800804:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080c:	8b 00                	mov    (%rax),%eax
+  80080e:	89 c0                	mov    %eax,%eax
+  800810:	48 01 d0             	add    %rdx,%rax
+  800813:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800817:	8b 12                	mov    (%rdx),%edx
+  800819:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80081c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800820:	89 0a                	mov    %ecx,(%rdx)
+  800822:	eb 14                	jmp    800838 <getuint+0xf1>
+  800824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800828:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80082c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800830:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800834:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800838:	8b 00                	mov    (%rax),%eax
+  80083a:	89 c0                	mov    %eax,%eax
+}
+  80083c:	c9                   	leave
+  80083d:	c3                   	ret
+
+000000000080083e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80083e:	55                   	push   %rbp
+  80083f:	48 89 e5             	mov    %rsp,%rbp
+  800842:	48 83 ec 10          	sub    $0x10,%rsp
+  800846:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80084a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80084d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800851:	7e 4b                	jle    80089e <getint+0x60>
+    return va_arg(*ap, long long);
+  800853:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800857:	8b 00                	mov    (%rax),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 24                	ja     800882 <getint+0x44>
+  80085e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800862:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086a:	8b 00                	mov    (%rax),%eax
+  80086c:	89 c0                	mov    %eax,%eax
+  80086e:	48 01 d0             	add    %rdx,%rax
+  800871:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800875:	8b 12                	mov    (%rdx),%edx
+  800877:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80087a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80087e:	89 0a                	mov    %ecx,(%rdx)
+  800880:	eb 14                	jmp    800896 <getint+0x58>
+  800882:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800886:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80088a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80088e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800892:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800896:	48 8b 00             	mov    (%rax),%rax
+  800899:	e9 95 00 00 00       	jmp    800933 <getint+0xf5>
+  else if (lflag)
+  80089e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008a2:	74 48                	je     8008ec <getint+0xae>
+    return va_arg(*ap, long);
+  8008a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008a8:	8b 00                	mov    (%rax),%eax
+  8008aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ad:	77 24                	ja     8008d3 <getint+0x95>
+  8008af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008bb:	8b 00                	mov    (%rax),%eax
+  8008bd:	89 c0                	mov    %eax,%eax
+  8008bf:	48 01 d0             	add    %rdx,%rax
+  8008c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008c6:	8b 12                	mov    (%rdx),%edx
+  8008c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008cf:	89 0a                	mov    %ecx,(%rdx)
+  8008d1:	eb 14                	jmp    8008e7 <getint+0xa9>
+  8008d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008e7:	48 8b 00             	mov    (%rax),%rax
+  8008ea:	eb 47                	jmp    800933 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8008ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008f0:	8b 00                	mov    (%rax),%eax
+  8008f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f5:	77 24                	ja     80091b <getint+0xdd>
+  8008f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800903:	8b 00                	mov    (%rax),%eax
+  800905:	89 c0                	mov    %eax,%eax
+  800907:	48 01 d0             	add    %rdx,%rax
+  80090a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80090e:	8b 12                	mov    (%rdx),%edx
+  800910:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800913:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800917:	89 0a                	mov    %ecx,(%rdx)
+  800919:	eb 14                	jmp    80092f <getint+0xf1>
+  80091b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80091f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800923:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800927:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80092f:	8b 00                	mov    (%rax),%eax
+  800931:	48 98                	cltq
+}
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+
+0000000000800935 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800935:	55                   	push   %rbp
+  800936:	48 89 e5             	mov    %rsp,%rbp
+  800939:	41 54                	push   %r12
+  80093b:	53                   	push   %rbx
+  80093c:	48 83 ec 60          	sub    $0x60,%rsp
+  800940:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800944:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800948:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80094c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800950:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800954:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800958:	48 8b 06             	mov    (%rsi),%rax
+  80095b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80095f:	48 89 01             	mov    %rax,(%rcx)
+  800962:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800966:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80096a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80096e:	eb 17                	jmp    800987 <vprintfmt+0x52>
+      if (ch == '\0')
+  800970:	85 db                	test   %ebx,%ebx
+  800972:	0f 84 bf 04 00 00    	je     800e37 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800978:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80097c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800980:	48 89 c6             	mov    %rax,%rsi
+  800983:	89 df                	mov    %ebx,%edi
+  800985:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800987:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80098b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80098f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800993:	0f b6 00             	movzbl (%rax),%eax
+  800996:	0f b6 d8             	movzbl %al,%ebx
+  800999:	83 fb 25             	cmp    $0x25,%ebx
+  80099c:	75 d2                	jne    800970 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80099e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8009a2:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8009a9:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8009b0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8009b7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8009be:	eb 04                	jmp    8009c4 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8009c0:	90                   	nop
+  8009c1:	eb 01                	jmp    8009c4 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8009c3:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8009c4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009cc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009d0:	0f b6 00             	movzbl (%rax),%eax
+  8009d3:	0f b6 d8             	movzbl %al,%ebx
+  8009d6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8009d9:	83 f8 55             	cmp    $0x55,%eax
+  8009dc:	0f 87 22 04 00 00    	ja     800e04 <vprintfmt+0x4cf>
+  8009e2:	89 c0                	mov    %eax,%eax
+  8009e4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009eb:	00 
+  8009ec:	48 b8 b8 56 80 00 00 	movabs $0x8056b8,%rax
+  8009f3:	00 00 00 
+  8009f6:	48 01 d0             	add    %rdx,%rax
+  8009f9:	48 8b 00             	mov    (%rax),%rax
+  8009fc:	ff e0                	jmp    *%rax
+        padc = '-';
+  8009fe:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a02:	eb c0                	jmp    8009c4 <vprintfmt+0x8f>
+        padc = '0';
+  800a04:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a08:	eb ba                	jmp    8009c4 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a0a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a11:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a14:	89 d0                	mov    %edx,%eax
+  800a16:	c1 e0 02             	shl    $0x2,%eax
+  800a19:	01 d0                	add    %edx,%eax
+  800a1b:	01 c0                	add    %eax,%eax
+  800a1d:	01 d8                	add    %ebx,%eax
+  800a1f:	83 e8 30             	sub    $0x30,%eax
+  800a22:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800a25:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a29:	0f b6 00             	movzbl (%rax),%eax
+  800a2c:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800a2f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a32:	7e 60                	jle    800a94 <vprintfmt+0x15f>
+  800a34:	83 fb 39             	cmp    $0x39,%ebx
+  800a37:	7f 5b                	jg     800a94 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800a39:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a3e:	eb d1                	jmp    800a11 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	77 17                	ja     800a5f <vprintfmt+0x12a>
+  800a48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a4c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a4f:	89 d2                	mov    %edx,%edx
+  800a51:	48 01 d0             	add    %rdx,%rax
+  800a54:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a57:	83 c2 08             	add    $0x8,%edx
+  800a5a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a5d:	eb 0c                	jmp    800a6b <vprintfmt+0x136>
+  800a5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a63:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a67:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a6b:	8b 00                	mov    (%rax),%eax
+  800a6d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800a70:	eb 23                	jmp    800a95 <vprintfmt+0x160>
+        if (width < 0)
+  800a72:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a76:	0f 89 44 ff ff ff    	jns    8009c0 <vprintfmt+0x8b>
+          width = 0;
+  800a7c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800a83:	e9 38 ff ff ff       	jmp    8009c0 <vprintfmt+0x8b>
+        altflag = 1;
+  800a88:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800a8f:	e9 30 ff ff ff       	jmp    8009c4 <vprintfmt+0x8f>
+        goto process_precision;
+  800a94:	90                   	nop
+        if (width < 0)
+  800a95:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a99:	0f 89 24 ff ff ff    	jns    8009c3 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800a9f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800aa2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800aa5:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800aac:	e9 12 ff ff ff       	jmp    8009c3 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800ab1:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800ab5:	e9 0a ff ff ff       	jmp    8009c4 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800aba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac0:	77 17                	ja     800ad9 <vprintfmt+0x1a4>
+  800ac2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ac6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ac9:	89 d2                	mov    %edx,%edx
+  800acb:	48 01 d0             	add    %rdx,%rax
+  800ace:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ad1:	83 c2 08             	add    $0x8,%edx
+  800ad4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ad7:	eb 0c                	jmp    800ae5 <vprintfmt+0x1b0>
+  800ad9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800add:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ae1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ae5:	8b 00                	mov    (%rax),%eax
+  800ae7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800aeb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800aef:	48 89 d6             	mov    %rdx,%rsi
+  800af2:	89 c7                	mov    %eax,%edi
+  800af4:	ff d1                	call   *%rcx
+        break;
+  800af6:	e9 37 03 00 00       	jmp    800e32 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afe:	83 f8 2f             	cmp    $0x2f,%eax
+  800b01:	77 17                	ja     800b1a <vprintfmt+0x1e5>
+  800b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b07:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b0a:	89 d2                	mov    %edx,%edx
+  800b0c:	48 01 d0             	add    %rdx,%rax
+  800b0f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b12:	83 c2 08             	add    $0x8,%edx
+  800b15:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b18:	eb 0c                	jmp    800b26 <vprintfmt+0x1f1>
+  800b1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b1e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b22:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b26:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800b28:	85 db                	test   %ebx,%ebx
+  800b2a:	79 02                	jns    800b2e <vprintfmt+0x1f9>
+          err = -err;
+  800b2c:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b2e:	83 fb 15             	cmp    $0x15,%ebx
+  800b31:	7f 16                	jg     800b49 <vprintfmt+0x214>
+  800b33:	48 ba e0 55 80 00 00 	movabs $0x8055e0,%rdx
+  800b3a:	00 00 00 
+  800b3d:	48 63 c3             	movslq %ebx,%rax
+  800b40:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b44:	4d 85 e4             	test   %r12,%r12
+  800b47:	75 2e                	jne    800b77 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b49:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b4d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b51:	89 d9                	mov    %ebx,%ecx
+  800b53:	48 ba a1 56 80 00 00 	movabs $0x8056a1,%rdx
+  800b5a:	00 00 00 
+  800b5d:	48 89 c7             	mov    %rax,%rdi
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	49 b8 41 0e 80 00 00 	movabs $0x800e41,%r8
+  800b6c:	00 00 00 
+  800b6f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800b72:	e9 bb 02 00 00       	jmp    800e32 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800b77:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b7b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b7f:	4c 89 e1             	mov    %r12,%rcx
+  800b82:	48 ba aa 56 80 00 00 	movabs $0x8056aa,%rdx
+  800b89:	00 00 00 
+  800b8c:	48 89 c7             	mov    %rax,%rdi
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	49 b8 41 0e 80 00 00 	movabs $0x800e41,%r8
+  800b9b:	00 00 00 
+  800b9e:	41 ff d0             	call   *%r8
+        break;
+  800ba1:	e9 8c 02 00 00       	jmp    800e32 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bac:	77 17                	ja     800bc5 <vprintfmt+0x290>
+  800bae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bb2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bb5:	89 d2                	mov    %edx,%edx
+  800bb7:	48 01 d0             	add    %rdx,%rax
+  800bba:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bbd:	83 c2 08             	add    $0x8,%edx
+  800bc0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bc3:	eb 0c                	jmp    800bd1 <vprintfmt+0x29c>
+  800bc5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bc9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bcd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bd1:	4c 8b 20             	mov    (%rax),%r12
+  800bd4:	4d 85 e4             	test   %r12,%r12
+  800bd7:	75 0a                	jne    800be3 <vprintfmt+0x2ae>
+          p = "(null)";
+  800bd9:	49 bc ad 56 80 00 00 	movabs $0x8056ad,%r12
+  800be0:	00 00 00 
+        if (width > 0 && padc != '-')
+  800be3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800be7:	7e 78                	jle    800c61 <vprintfmt+0x32c>
+  800be9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800bed:	74 72                	je     800c61 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800bef:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800bf2:	48 98                	cltq
+  800bf4:	48 89 c6             	mov    %rax,%rsi
+  800bf7:	4c 89 e7             	mov    %r12,%rdi
+  800bfa:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  800c01:	00 00 00 
+  800c04:	ff d0                	call   *%rax
+  800c06:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c09:	eb 17                	jmp    800c22 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c0b:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c0f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c13:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c17:	48 89 d6             	mov    %rdx,%rsi
+  800c1a:	89 c7                	mov    %eax,%edi
+  800c1c:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c1e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c22:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c26:	7f e3                	jg     800c0b <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c28:	eb 37                	jmp    800c61 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800c2a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c2e:	74 1e                	je     800c4e <vprintfmt+0x319>
+  800c30:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c33:	7e 05                	jle    800c3a <vprintfmt+0x305>
+  800c35:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c38:	7e 14                	jle    800c4e <vprintfmt+0x319>
+            putch('?', putdat);
+  800c3a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c3e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c42:	48 89 c6             	mov    %rax,%rsi
+  800c45:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c4a:	ff d2                	call   *%rdx
+  800c4c:	eb 0f                	jmp    800c5d <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800c4e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c52:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c56:	48 89 c6             	mov    %rax,%rsi
+  800c59:	89 df                	mov    %ebx,%edi
+  800c5b:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c5d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c61:	4c 89 e0             	mov    %r12,%rax
+  800c64:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c68:	0f b6 00             	movzbl (%rax),%eax
+  800c6b:	0f be d8             	movsbl %al,%ebx
+  800c6e:	85 db                	test   %ebx,%ebx
+  800c70:	74 28                	je     800c9a <vprintfmt+0x365>
+  800c72:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c76:	78 b2                	js     800c2a <vprintfmt+0x2f5>
+  800c78:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800c7c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c80:	79 a8                	jns    800c2a <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800c82:	eb 16                	jmp    800c9a <vprintfmt+0x365>
+          putch(' ', putdat);
+  800c84:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c88:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c8c:	48 89 c6             	mov    %rax,%rsi
+  800c8f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c94:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800c96:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c9a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c9e:	7f e4                	jg     800c84 <vprintfmt+0x34f>
+        break;
+  800ca0:	e9 8d 01 00 00       	jmp    800e32 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800ca5:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ca8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cac:	89 d6                	mov    %edx,%esi
+  800cae:	48 89 c7             	mov    %rax,%rdi
+  800cb1:	48 b8 3e 08 80 00 00 	movabs $0x80083e,%rax
+  800cb8:	00 00 00 
+  800cbb:	ff d0                	call   *%rax
+  800cbd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc5:	48 85 c0             	test   %rax,%rax
+  800cc8:	79 1d                	jns    800ce7 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800cca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cd2:	48 89 c6             	mov    %rax,%rsi
+  800cd5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cda:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800cdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce0:	48 f7 d8             	neg    %rax
+  800ce3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800ce7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800cee:	e9 d2 00 00 00       	jmp    800dc5 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800cf3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cf6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cfa:	89 d6                	mov    %edx,%esi
+  800cfc:	48 89 c7             	mov    %rax,%rdi
+  800cff:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  800d06:	00 00 00 
+  800d09:	ff d0                	call   *%rax
+  800d0b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d0f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d16:	e9 aa 00 00 00       	jmp    800dc5 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800d1b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d1e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d22:	89 d6                	mov    %edx,%esi
+  800d24:	48 89 c7             	mov    %rax,%rdi
+  800d27:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  800d2e:	00 00 00 
+  800d31:	ff d0                	call   *%rax
+  800d33:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800d37:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d3e:	e9 82 00 00 00       	jmp    800dc5 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d47:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d4b:	48 89 c6             	mov    %rax,%rsi
+  800d4e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d53:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800d55:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d59:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d5d:	48 89 c6             	mov    %rax,%rsi
+  800d60:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d65:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6d:	77 17                	ja     800d86 <vprintfmt+0x451>
+  800d6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d73:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d76:	89 d2                	mov    %edx,%edx
+  800d78:	48 01 d0             	add    %rdx,%rax
+  800d7b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d7e:	83 c2 08             	add    $0x8,%edx
+  800d81:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d84:	eb 0c                	jmp    800d92 <vprintfmt+0x45d>
+  800d86:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d8a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d8e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d92:	48 8b 00             	mov    (%rax),%rax
+  800d95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d99:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800da0:	eb 23                	jmp    800dc5 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800da2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800da5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800da9:	89 d6                	mov    %edx,%esi
+  800dab:	48 89 c7             	mov    %rax,%rdi
+  800dae:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  800db5:	00 00 00 
+  800db8:	ff d0                	call   *%rax
+  800dba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800dbe:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800dc5:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800dca:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800dcd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800dd0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dd4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800dd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ddc:	45 89 c1             	mov    %r8d,%r9d
+  800ddf:	41 89 f8             	mov    %edi,%r8d
+  800de2:	48 89 c7             	mov    %rax,%rdi
+  800de5:	48 b8 8f 06 80 00 00 	movabs $0x80068f,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+        break;
+  800df1:	eb 3f                	jmp    800e32 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800df3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800df7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dfb:	48 89 c6             	mov    %rax,%rsi
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	ff d2                	call   *%rdx
+        break;
+  800e02:	eb 2e                	jmp    800e32 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e04:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e08:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e0c:	48 89 c6             	mov    %rax,%rsi
+  800e0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e14:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800e16:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e1b:	eb 05                	jmp    800e22 <vprintfmt+0x4ed>
+  800e1d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e22:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e26:	48 83 e8 01          	sub    $0x1,%rax
+  800e2a:	0f b6 00             	movzbl (%rax),%eax
+  800e2d:	3c 25                	cmp    $0x25,%al
+  800e2f:	75 ec                	jne    800e1d <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800e31:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800e32:	e9 50 fb ff ff       	jmp    800987 <vprintfmt+0x52>
+        return;
+  800e37:	90                   	nop
+    }
+  }
+}
+  800e38:	48 83 c4 60          	add    $0x60,%rsp
+  800e3c:	5b                   	pop    %rbx
+  800e3d:	41 5c                	pop    %r12
+  800e3f:	5d                   	pop    %rbp
+  800e40:	c3                   	ret
+
+0000000000800e41 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e41:	55                   	push   %rbp
+  800e42:	48 89 e5             	mov    %rsp,%rbp
+  800e45:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e4c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e53:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e5a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e61:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e68:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e6f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e76:	84 c0                	test   %al,%al
+  800e78:	74 20                	je     800e9a <printfmt+0x59>
+  800e7a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e7e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e82:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e86:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e8a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e8e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e92:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e96:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800e9a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ea1:	00 00 00 
+  800ea4:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800eab:	00 00 00 
+  800eae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800eb2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800eb9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ec0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800ec7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ece:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ed5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800edc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ee3:	48 89 c7             	mov    %rax,%rdi
+  800ee6:	48 b8 35 09 80 00 00 	movabs $0x800935,%rax
+  800eed:	00 00 00 
+  800ef0:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800ef2:	90                   	nop
+  800ef3:	c9                   	leave
+  800ef4:	c3                   	ret
+
+0000000000800ef5 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800ef5:	55                   	push   %rbp
+  800ef6:	48 89 e5             	mov    %rsp,%rbp
+  800ef9:	48 83 ec 10          	sub    $0x10,%rsp
+  800efd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f08:	8b 40 10             	mov    0x10(%rax),%eax
+  800f0b:	8d 50 01             	lea    0x1(%rax),%edx
+  800f0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f12:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800f15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f19:	48 8b 10             	mov    (%rax),%rdx
+  800f1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f24:	48 39 c2             	cmp    %rax,%rdx
+  800f27:	73 17                	jae    800f40 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800f29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f2d:	48 8b 00             	mov    (%rax),%rax
+  800f30:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f34:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f38:	48 89 0a             	mov    %rcx,(%rdx)
+  800f3b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f3e:	88 10                	mov    %dl,(%rax)
+}
+  800f40:	90                   	nop
+  800f41:	c9                   	leave
+  800f42:	c3                   	ret
+
+0000000000800f43 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f43:	55                   	push   %rbp
+  800f44:	48 89 e5             	mov    %rsp,%rbp
+  800f47:	48 83 ec 40          	sub    $0x40,%rsp
+  800f4b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800f4f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800f52:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f56:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f5e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f62:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f65:	48 98                	cltq
+  800f67:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f6f:	48 01 d0             	add    %rdx,%rax
+  800f72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f76:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800f7d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f82:	74 06                	je     800f8a <vsnprintf+0x47>
+  800f84:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800f88:	7f 07                	jg     800f91 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800f8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f8f:	eb 32                	jmp    800fc3 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800f91:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f95:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800f99:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800f9d:	48 89 c6             	mov    %rax,%rsi
+  800fa0:	48 b8 f5 0e 80 00 00 	movabs $0x800ef5,%rax
+  800fa7:	00 00 00 
+  800faa:	48 89 c7             	mov    %rax,%rdi
+  800fad:	48 b8 35 09 80 00 00 	movabs $0x800935,%rax
+  800fb4:	00 00 00 
+  800fb7:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800fb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fbd:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800fc0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800fc3:	c9                   	leave
+  800fc4:	c3                   	ret
+
+0000000000800fc5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800fc5:	55                   	push   %rbp
+  800fc6:	48 89 e5             	mov    %rsp,%rbp
+  800fc9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800fd0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800fd7:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800fdd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800fe4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800feb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ff2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ff9:	84 c0                	test   %al,%al
+  800ffb:	74 20                	je     80101d <snprintf+0x58>
+  800ffd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801001:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801005:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801009:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80100d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801011:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801015:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801019:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80101d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801024:	00 00 00 
+  801027:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80102e:	00 00 00 
+  801031:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801035:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80103c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801043:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80104a:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801051:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801058:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80105e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801065:	48 89 c7             	mov    %rax,%rdi
+  801068:	48 b8 43 0f 80 00 00 	movabs $0x800f43,%rax
+  80106f:	00 00 00 
+  801072:	ff d0                	call   *%rax
+  801074:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  80107a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+0000000000801082 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801082:	55                   	push   %rbp
+  801083:	48 89 e5             	mov    %rsp,%rbp
+  801086:	53                   	push   %rbx
+  801087:	48 83 ec 38          	sub    $0x38,%rsp
+  80108b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80108e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801092:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801096:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80109a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  80109e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	89 d1                	mov    %edx,%ecx
+  8010a8:	0f a2                	cpuid
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8010af:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8010b2:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8010b5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8010b8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010bd:	74 09                	je     8010c8 <cpuid+0x46>
+}
+  8010bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010c3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010c6:	89 10                	mov    %edx,(%rax)
+
+  8010c8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010cd:	74 09                	je     8010d8 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8010cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010d3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8010d6:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8010d8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010dd:	74 09                	je     8010e8 <cpuid+0x66>
+char *
+  8010df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010e3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8010e6:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8010e8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8010ed:	74 09                	je     8010f8 <cpuid+0x76>
+  for (; *s; s++)
+  8010ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010f3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8010f6:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  8010f8:	90                   	nop
+  8010f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fd:	c9                   	leave
+  8010fe:	c3                   	ret
+
+00000000008010ff <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8010ff:	55                   	push   %rbp
+  801100:	48 89 e5             	mov    %rsp,%rbp
+  801103:	48 83 ec 18          	sub    $0x18,%rsp
+  801107:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80110a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80110d:	89 c1                	mov    %eax,%ecx
+  80110f:	0f 01 d0             	xgetbv
+  801112:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801115:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80111b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80111e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801122:	48 09 d0             	or     %rdx,%rax
+#else
+  801125:	c9                   	leave
+  801126:	c3                   	ret
+
+0000000000801127 <string_cpu>:
+string_cpu(void) {
+  801127:	55                   	push   %rbp
+  801128:	48 89 e5             	mov    %rsp,%rbp
+  80112b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80112f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801136:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80113d:	48 b8 30 60 80 00 00 	movabs $0x806030,%rax
+  801144:	00 00 00 
+  801147:	8b 00                	mov    (%rax),%eax
+  801149:	85 c0                	test   %eax,%eax
+  80114b:	78 11                	js     80115e <string_cpu+0x37>
+    return string_features;
+  80114d:	48 b8 30 60 80 00 00 	movabs $0x806030,%rax
+  801154:	00 00 00 
+  801157:	8b 00                	mov    (%rax),%eax
+  801159:	e9 df 00 00 00       	jmp    80123d <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80115e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801168:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80116d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801172:	48 89 c6             	mov    %rax,%rsi
+  801175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117a:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801186:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801189:	83 f8 06             	cmp    $0x6,%eax
+  80118c:	76 28                	jbe    8011b6 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80118e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801192:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119d:	48 89 c2             	mov    %rax,%rdx
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8011aa:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8011b1:	00 00 00 
+  8011b4:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8011b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011b9:	25 00 02 00 00       	and    $0x200,%eax
+  8011be:	85 c0                	test   %eax,%eax
+  8011c0:	74 04                	je     8011c6 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8011c2:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8011c6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8011ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d0:	48 89 c1             	mov    %rax,%rcx
+  8011d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011e2:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8011ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011f1:	83 e0 20             	and    $0x20,%eax
+  8011f4:	85 c0                	test   %eax,%eax
+  8011f6:	74 2a                	je     801222 <string_cpu+0xfb>
+  8011f8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8011fb:	25 00 00 00 08       	and    $0x8000000,%eax
+  801200:	85 c0                	test   %eax,%eax
+  801202:	74 1e                	je     801222 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801204:	bf 00 00 00 00       	mov    $0x0,%edi
+  801209:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  801210:	00 00 00 
+  801213:	ff d0                	call   *%rax
+  801215:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801218:	48 83 f8 06          	cmp    $0x6,%rax
+  80121c:	75 04                	jne    801222 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80121e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801222:	48 ba 30 60 80 00 00 	movabs $0x806030,%rdx
+  801229:	00 00 00 
+  80122c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80122f:	89 02                	mov    %eax,(%rdx)
+  801231:	48 b8 30 60 80 00 00 	movabs $0x806030,%rax
+  801238:	00 00 00 
+  80123b:	8b 00                	mov    (%rax),%eax
+}
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+000000000080123f <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+  801243:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801247:	48 83 ec 60          	sub    $0x60,%rsp
+  80124b:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801250:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801255:	83 e0 1f             	and    $0x1f,%eax
+  801258:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80125c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801260:	48 f7 d8             	neg    %rax
+  801263:	48 89 c2             	mov    %rax,%rdx
+  801266:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80126b:	48 01 d0             	add    %rdx,%rax
+  80126e:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801273:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801277:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80127d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801282:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801286:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80128c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801290:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801294:	89 c2                	mov    %eax,%edx
+  801296:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80129a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80129f:	89 c1                	mov    %eax,%ecx
+  8012a1:	d3 e6                	shl    %cl,%esi
+  8012a3:	89 f0                	mov    %esi,%eax
+  8012a5:	21 d0                	and    %edx,%eax
+  8012a7:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012ab:	eb 21                	jmp    8012ce <strlen_avx2+0x8f>
+    p += 32;
+  8012ad:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8012b3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012b8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012bc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012c2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012c6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012ca:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012ce:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8012d3:	74 d8                	je     8012ad <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8012d5:	31 c0                	xor    %eax,%eax
+  8012d7:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8012dd:	48 63 d0             	movslq %eax,%rdx
+  8012e0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012e5:	48 01 d0             	add    %rdx,%rax
+  8012e8:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8012ed:	c9                   	leave
+  8012ee:	c3                   	ret
+
+00000000008012ef <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8012ef:	55                   	push   %rbp
+  8012f0:	48 89 e5             	mov    %rsp,%rbp
+  8012f3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8012f7:	48 83 ec 40          	sub    $0x40,%rsp
+  8012fb:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801300:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801305:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80130a:	eb 77                	jmp    801383 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80130c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801311:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801315:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801319:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80131e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801322:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801326:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80132a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80132e:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801333:	74 3c                	je     801371 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801335:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801339:	f7 d0                	not    %eax
+  80133b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80133f:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801343:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801347:	48 63 d0             	movslq %eax,%rdx
+  80134a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80134f:	48 01 d0             	add    %rdx,%rax
+  801352:	0f b6 00             	movzbl (%rax),%eax
+  801355:	0f b6 c0             	movzbl %al,%eax
+  801358:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80135c:	48 63 ca             	movslq %edx,%rcx
+  80135f:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801364:	48 01 ca             	add    %rcx,%rdx
+  801367:	0f b6 12             	movzbl (%rdx),%edx
+  80136a:	0f b6 d2             	movzbl %dl,%edx
+  80136d:	29 d0                	sub    %edx,%eax
+  80136f:	eb 6b                	jmp    8013dc <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801371:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801377:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80137d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801383:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801389:	77 81                	ja     80130c <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80138b:	eb 42                	jmp    8013cf <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80138d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801392:	0f b6 10             	movzbl (%rax),%edx
+  801395:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80139a:	0f b6 00             	movzbl (%rax),%eax
+  80139d:	38 c2                	cmp    %al,%dl
+  80139f:	74 1c                	je     8013bd <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8013a1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013a6:	0f b6 00             	movzbl (%rax),%eax
+  8013a9:	0f b6 c8             	movzbl %al,%ecx
+  8013ac:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013b1:	0f b6 00             	movzbl (%rax),%eax
+  8013b4:	0f b6 d0             	movzbl %al,%edx
+  8013b7:	89 c8                	mov    %ecx,%eax
+  8013b9:	29 d0                	sub    %edx,%eax
+  8013bb:	eb 1f                	jmp    8013dc <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8013bd:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8013c3:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8013c9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8013cf:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8013d5:	75 b6                	jne    80138d <memcmp_avx2+0x9e>
+  return 0;
+  8013d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013dc:	c9                   	leave
+  8013dd:	c3                   	ret
+
+00000000008013de <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8013de:	55                   	push   %rbp
+  8013df:	48 89 e5             	mov    %rsp,%rbp
+  8013e2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013e6:	48 83 ec 60          	sub    $0x60,%rsp
+  8013ea:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8013ef:	89 f0                	mov    %esi,%eax
+  8013f1:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8013f6:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8013fa:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8013ff:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801403:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801408:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80140e:	eb 47                	jmp    801457 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801410:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801415:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801419:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80141d:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801423:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801427:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80142b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80142f:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801434:	74 15                	je     80144b <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801436:	31 c0                	xor    %eax,%eax
+  801438:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80143e:	48 63 d0             	movslq %eax,%rdx
+  801441:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801446:	48 01 d0             	add    %rdx,%rax
+  801449:	eb 3d                	jmp    801488 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80144b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801451:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801457:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80145d:	77 b1                	ja     801410 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80145f:	eb 0c                	jmp    80146d <memfind_avx2+0x8f>
+  801461:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801467:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80146d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801473:	74 0e                	je     801483 <memfind_avx2+0xa5>
+  801475:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80147a:	0f b6 00             	movzbl (%rax),%eax
+  80147d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801481:	75 de                	jne    801461 <memfind_avx2+0x83>
+  return s;
+  801483:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+000000000080148a <strlen>:
+strlen(const char *s) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	48 83 ec 40          	sub    $0x40,%rsp
+  801492:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801496:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80149a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80149e:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  8014a5:	00 00 00 
+  8014a8:	ff d0                	call   *%rax
+  8014aa:	83 e0 02             	and    $0x2,%eax
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	74 18                	je     8014c9 <strlen+0x3f>
+    return strlen_avx2(s);
+  8014b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014b5:	48 89 c7             	mov    %rax,%rdi
+  8014b8:	48 b8 3f 12 80 00 00 	movabs $0x80123f,%rax
+  8014bf:	00 00 00 
+  8014c2:	ff d0                	call   *%rax
+  8014c4:	e9 82 00 00 00       	jmp    80154b <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8014c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014cd:	83 e0 0f             	and    $0xf,%eax
+  8014d0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8014d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014d6:	48 f7 d8             	neg    %rax
+  8014d9:	48 89 c2             	mov    %rax,%rdx
+  8014dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e0:	48 01 d0             	add    %rdx,%rax
+  8014e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8014e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014eb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8014ef:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8014f4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8014f8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8014fc:	89 c2                	mov    %eax,%edx
+  8014fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801501:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801506:	89 c1                	mov    %eax,%ecx
+  801508:	d3 e6                	shl    %cl,%esi
+  80150a:	89 f0                	mov    %esi,%eax
+  80150c:	21 d0                	and    %edx,%eax
+  80150e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801511:	eb 1d                	jmp    801530 <strlen+0xa6>
+    p += 16;
+  801513:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801520:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801525:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801529:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80152d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801530:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801534:	74 dd                	je     801513 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801536:	31 c0                	xor    %eax,%eax
+  801538:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80153d:	48 63 d0             	movslq %eax,%rdx
+  801540:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801544:	48 01 d0             	add    %rdx,%rax
+  801547:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80154b:	c9                   	leave
+  80154c:	c3                   	ret
+
+000000000080154d <strnlen>:
+strnlen(const char *s, size_t size) {
+  80154d:	55                   	push   %rbp
+  80154e:	48 89 e5             	mov    %rsp,%rbp
+  801551:	48 83 ec 20          	sub    $0x20,%rsp
+  801555:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801559:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80155d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801564:	eb 0e                	jmp    801574 <strnlen+0x27>
+    n++;
+  801566:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80156a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80156f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801574:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801579:	74 0b                	je     801586 <strnlen+0x39>
+  80157b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157f:	0f b6 00             	movzbl (%rax),%eax
+  801582:	84 c0                	test   %al,%al
+  801584:	75 e0                	jne    801566 <strnlen+0x19>
+  return n;
+  801586:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+
+000000000080158b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80158b:	55                   	push   %rbp
+  80158c:	48 89 e5             	mov    %rsp,%rbp
+  80158f:	48 83 ec 20          	sub    $0x20,%rsp
+  801593:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801597:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80159b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8015a3:	90                   	nop
+  8015a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015a8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015ac:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015bc:	0f b6 12             	movzbl (%rdx),%edx
+  8015bf:	88 10                	mov    %dl,(%rax)
+  8015c1:	0f b6 00             	movzbl (%rax),%eax
+  8015c4:	84 c0                	test   %al,%al
+  8015c6:	75 dc                	jne    8015a4 <strcpy+0x19>
+  return ret;
+  8015c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015cc:	c9                   	leave
+  8015cd:	c3                   	ret
+
+00000000008015ce <strcat>:
+strcat(char *dst, const char *src) {
+  8015ce:	55                   	push   %rbp
+  8015cf:	48 89 e5             	mov    %rsp,%rbp
+  8015d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8015d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8015de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e2:	48 89 c7             	mov    %rax,%rdi
+  8015e5:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  8015ec:	00 00 00 
+  8015ef:	ff d0                	call   *%rax
+  8015f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8015f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8015f7:	48 63 d0             	movslq %eax,%rdx
+  8015fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015fe:	48 01 c2             	add    %rax,%rdx
+  801601:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801605:	48 89 c6             	mov    %rax,%rsi
+  801608:	48 89 d7             	mov    %rdx,%rdi
+  80160b:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  801612:	00 00 00 
+  801615:	ff d0                	call   *%rax
+  return dst;
+  801617:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+
+000000000080161d <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	48 83 ec 28          	sub    $0x28,%rsp
+  801625:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801629:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80162d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801631:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801635:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801639:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801640:	00 
+  801641:	eb 2a                	jmp    80166d <strncpy+0x50>
+    *dst++ = *src;
+  801643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801647:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80164b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80164f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801653:	0f b6 12             	movzbl (%rdx),%edx
+  801656:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801658:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80165c:	0f b6 00             	movzbl (%rax),%eax
+  80165f:	84 c0                	test   %al,%al
+  801661:	74 05                	je     801668 <strncpy+0x4b>
+      src++;
+  801663:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801668:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80166d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801671:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801675:	72 cc                	jb     801643 <strncpy+0x26>
+  return ret;
+  801677:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80167b:	c9                   	leave
+  80167c:	c3                   	ret
+
+000000000080167d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80167d:	55                   	push   %rbp
+  80167e:	48 89 e5             	mov    %rsp,%rbp
+  801681:	48 83 ec 28          	sub    $0x28,%rsp
+  801685:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801689:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80168d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801691:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801695:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801699:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80169e:	74 3d                	je     8016dd <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8016a0:	eb 1d                	jmp    8016bf <strlcpy+0x42>
+      *dst++ = *src++;
+  8016a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016a6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016ba:	0f b6 12             	movzbl (%rdx),%edx
+  8016bd:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8016bf:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016c4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016c9:	74 0b                	je     8016d6 <strlcpy+0x59>
+  8016cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016cf:	0f b6 00             	movzbl (%rax),%eax
+  8016d2:	84 c0                	test   %al,%al
+  8016d4:	75 cc                	jne    8016a2 <strlcpy+0x25>
+    *dst = '\0';
+  8016d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016da:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8016dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016e5:	c9                   	leave
+  8016e6:	c3                   	ret
+
+00000000008016e7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8016e7:	55                   	push   %rbp
+  8016e8:	48 89 e5             	mov    %rsp,%rbp
+  8016eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8016ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8016fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ff:	48 89 c7             	mov    %rax,%rdi
+  801702:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  801709:	00 00 00 
+  80170c:	ff d0                	call   *%rax
+  80170e:	48 98                	cltq
+  801710:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801714:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80171c:	48 89 d6             	mov    %rdx,%rsi
+  80171f:	48 89 c7             	mov    %rax,%rdi
+  801722:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  801729:	00 00 00 
+  80172c:	ff d0                	call   *%rax
+  80172e:	48 98                	cltq
+  801730:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801734:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801738:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80173c:	75 10                	jne    80174e <strlcat+0x67>
+    return maxlen + srclen;
+  80173e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801746:	48 01 d0             	add    %rdx,%rax
+  801749:	e9 86 00 00 00       	jmp    8017d4 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80174e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801752:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801756:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80175a:	73 2b                	jae    801787 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80175c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801760:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801764:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176c:	48 01 c1             	add    %rax,%rcx
+  80176f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801773:	48 89 c6             	mov    %rax,%rsi
+  801776:	48 89 cf             	mov    %rcx,%rdi
+  801779:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  801780:	00 00 00 
+  801783:	ff d0                	call   *%rax
+  801785:	eb 42                	jmp    8017c9 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801787:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80178b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80178f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801797:	48 01 c1             	add    %rax,%rcx
+  80179a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80179e:	48 89 c6             	mov    %rax,%rsi
+  8017a1:	48 89 cf             	mov    %rcx,%rdi
+  8017a4:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  8017ab:	00 00 00 
+  8017ae:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8017b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b8:	48 01 d0             	add    %rdx,%rax
+  8017bb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c3:	48 01 d0             	add    %rdx,%rax
+  8017c6:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8017c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d1:	48 01 d0             	add    %rdx,%rax
+}
+  8017d4:	c9                   	leave
+  8017d5:	c3                   	ret
+
+00000000008017d6 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8017d6:	55                   	push   %rbp
+  8017d7:	48 89 e5             	mov    %rsp,%rbp
+  8017da:	48 83 ec 10          	sub    $0x10,%rsp
+  8017de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8017e6:	eb 0a                	jmp    8017f2 <strcmp+0x1c>
+    p++, q++;
+  8017e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ed:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8017f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f6:	0f b6 00             	movzbl (%rax),%eax
+  8017f9:	84 c0                	test   %al,%al
+  8017fb:	74 12                	je     80180f <strcmp+0x39>
+  8017fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801801:	0f b6 10             	movzbl (%rax),%edx
+  801804:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801808:	0f b6 00             	movzbl (%rax),%eax
+  80180b:	38 c2                	cmp    %al,%dl
+  80180d:	74 d9                	je     8017e8 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80180f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801813:	0f b6 00             	movzbl (%rax),%eax
+  801816:	0f b6 d0             	movzbl %al,%edx
+  801819:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80181d:	0f b6 00             	movzbl (%rax),%eax
+  801820:	0f b6 c0             	movzbl %al,%eax
+  801823:	29 c2                	sub    %eax,%edx
+  801825:	89 d0                	mov    %edx,%eax
+}
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+
+0000000000801829 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801829:	55                   	push   %rbp
+  80182a:	48 89 e5             	mov    %rsp,%rbp
+  80182d:	48 83 ec 18          	sub    $0x18,%rsp
+  801831:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801835:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801839:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80183d:	eb 0f                	jmp    80184e <strncmp+0x25>
+    n--, p++, q++;
+  80183f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801844:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801849:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80184e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801853:	74 1d                	je     801872 <strncmp+0x49>
+  801855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801859:	0f b6 00             	movzbl (%rax),%eax
+  80185c:	84 c0                	test   %al,%al
+  80185e:	74 12                	je     801872 <strncmp+0x49>
+  801860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801864:	0f b6 10             	movzbl (%rax),%edx
+  801867:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186b:	0f b6 00             	movzbl (%rax),%eax
+  80186e:	38 c2                	cmp    %al,%dl
+  801870:	74 cd                	je     80183f <strncmp+0x16>
+  if (n == 0)
+  801872:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801877:	75 07                	jne    801880 <strncmp+0x57>
+    return 0;
+  801879:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187e:	eb 16                	jmp    801896 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801884:	0f b6 00             	movzbl (%rax),%eax
+  801887:	0f b6 d0             	movzbl %al,%edx
+  80188a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188e:	0f b6 00             	movzbl (%rax),%eax
+  801891:	0f b6 c0             	movzbl %al,%eax
+  801894:	29 c2                	sub    %eax,%edx
+}
+  801896:	89 d0                	mov    %edx,%eax
+  801898:	c9                   	leave
+  801899:	c3                   	ret
+
+000000000080189a <strchr>:
+strchr(const char *s, char c) {
+  80189a:	55                   	push   %rbp
+  80189b:	48 89 e5             	mov    %rsp,%rbp
+  80189e:	48 83 ec 60          	sub    $0x60,%rsp
+  8018a2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8018a6:	89 f0                	mov    %esi,%eax
+  8018a8:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8018ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018af:	83 e0 0f             	and    $0xf,%eax
+  8018b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8018b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018b8:	48 f7 d8             	neg    %rax
+  8018bb:	48 89 c2             	mov    %rax,%rdx
+  8018be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018c2:	48 01 d0             	add    %rdx,%rax
+  8018c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8018c9:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8018cd:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8018d1:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8018d5:	66 0f 6e c0          	movd   %eax,%xmm0
+  8018d9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8018dd:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8018e1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8018e6:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8018ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ee:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8018f2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8018f6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018fb:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801900:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801904:	89 c2                	mov    %eax,%edx
+  801906:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80190b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801910:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801914:	09 c2                	or     %eax,%edx
+  801916:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801919:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80191e:	89 c1                	mov    %eax,%ecx
+  801920:	d3 e6                	shl    %cl,%esi
+  801922:	89 f0                	mov    %esi,%eax
+  801924:	21 d0                	and    %edx,%eax
+  801926:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801929:	eb 34                	jmp    80195f <strchr+0xc5>
+    p += 16;
+  80192b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801930:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801934:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801938:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80193c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801941:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801946:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80194a:	89 c2                	mov    %eax,%edx
+  80194c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801951:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801956:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80195a:	09 d0                	or     %edx,%eax
+  80195c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80195f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801963:	74 c6                	je     80192b <strchr+0x91>
+  p += __builtin_ctz(m);
+  801965:	31 c0                	xor    %eax,%eax
+  801967:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80196c:	48 98                	cltq
+  80196e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801972:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801976:	0f b6 00             	movzbl (%rax),%eax
+  801979:	84 c0                	test   %al,%al
+  80197b:	74 06                	je     801983 <strchr+0xe9>
+  80197d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801981:	eb 05                	jmp    801988 <strchr+0xee>
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+000000000080198a <strfind>:
+strfind(const char *s, char c) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	48 83 ec 10          	sub    $0x10,%rsp
+  801992:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801996:	89 f0                	mov    %esi,%eax
+  801998:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80199b:	eb 11                	jmp    8019ae <strfind+0x24>
+    if (*s == c)
+  80199d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a1:	0f b6 00             	movzbl (%rax),%eax
+  8019a4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019a7:	74 12                	je     8019bb <strfind+0x31>
+  for (; *s; s++)
+  8019a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b2:	0f b6 00             	movzbl (%rax),%eax
+  8019b5:	84 c0                	test   %al,%al
+  8019b7:	75 e4                	jne    80199d <strfind+0x13>
+  8019b9:	eb 01                	jmp    8019bc <strfind+0x32>
+      break;
+  8019bb:	90                   	nop
+  return (char *)s;
+  8019bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019c0:	c9                   	leave
+  8019c1:	c3                   	ret
+
+00000000008019c2 <memset>:
+memset(void *v, int c, size_t n) {
+  8019c2:	55                   	push   %rbp
+  8019c3:	48 89 e5             	mov    %rsp,%rbp
+  8019c6:	48 83 ec 38          	sub    $0x38,%rsp
+  8019ca:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019ce:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8019d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8019d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019dd:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8019e2:	76 41                	jbe    801a25 <memset+0x63>
+  8019e4:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  8019eb:	00 00 00 
+  8019ee:	ff d0                	call   *%rax
+  8019f0:	83 e0 01             	and    $0x1,%eax
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	74 2e                	je     801a25 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8019f7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8019fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a02:	48 89 ce             	mov    %rcx,%rsi
+  801a05:	48 89 f7             	mov    %rsi,%rdi
+  801a08:	48 89 d1             	mov    %rdx,%rcx
+  801a0b:	fc                   	cld
+  801a0c:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a0e:	48 89 ca             	mov    %rcx,%rdx
+  801a11:	48 89 fe             	mov    %rdi,%rsi
+  801a14:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a18:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801a1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a20:	e9 a7 00 00 00       	jmp    801acc <memset+0x10a>
+  if (n >= 8) {
+  801a25:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a2a:	0f 86 87 00 00 00    	jbe    801ab7 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801a30:	eb 16                	jmp    801a48 <memset+0x86>
+      *p++ = c;
+  801a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a36:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a3a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a3e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a41:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a43:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a4c:	83 e0 07             	and    $0x7,%eax
+  801a4f:	48 85 c0             	test   %rax,%rax
+  801a52:	75 de                	jne    801a32 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801a54:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a57:	0f b6 c0             	movzbl %al,%eax
+  801a5a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a61:	01 01 01 
+  801a64:	48 0f af c2          	imul   %rdx,%rax
+  801a68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a70:	48 c1 e8 03          	shr    $0x3,%rax
+  801a74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a84:	48 89 ce             	mov    %rcx,%rsi
+  801a87:	48 89 f7             	mov    %rsi,%rdi
+  801a8a:	48 89 d1             	mov    %rdx,%rcx
+  801a8d:	fc                   	cld
+  801a8e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801a91:	48 89 ca             	mov    %rcx,%rdx
+  801a94:	48 89 fe             	mov    %rdi,%rsi
+  801a97:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801a9f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801aa4:	eb 11                	jmp    801ab7 <memset+0xf5>
+    *p++ = c;
+  801aa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aaa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aae:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ab2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801ab5:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801ab7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801abb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801abf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ac3:	48 85 c0             	test   %rax,%rax
+  801ac6:	75 de                	jne    801aa6 <memset+0xe4>
+  return v;
+  801ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+
+0000000000801ace <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801ace:	55                   	push   %rbp
+  801acf:	48 89 e5             	mov    %rsp,%rbp
+  801ad2:	48 83 ec 38          	sub    $0x38,%rsp
+  801ad6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ada:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ade:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801ae2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801af2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801afa:	0f 83 da 00 00 00    	jae    801bda <memmove+0x10c>
+  801b00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b08:	48 01 d0             	add    %rdx,%rax
+  801b0b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b0f:	0f 83 c5 00 00 00    	jae    801bda <memmove+0x10c>
+    s += n;
+  801b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b19:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801b1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b21:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801b25:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b2a:	0f 86 94 00 00 00    	jbe    801bc4 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801b30:	eb 1c                	jmp    801b4e <memmove+0x80>
+        *--d = *--s;
+  801b32:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b37:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b40:	0f b6 10             	movzbl (%rax),%edx
+  801b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b47:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b49:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b52:	83 e0 07             	and    $0x7,%eax
+  801b55:	48 85 c0             	test   %rax,%rax
+  801b58:	75 d8                	jne    801b32 <memmove+0x64>
+      nq = n / 8;
+  801b5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b5e:	48 c1 e8 03          	shr    $0x3,%rax
+  801b62:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b66:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b6b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801b70:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801b75:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b79:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b81:	48 89 cf             	mov    %rcx,%rdi
+  801b84:	48 89 d6             	mov    %rdx,%rsi
+  801b87:	48 89 c1             	mov    %rax,%rcx
+  801b8a:	fd                   	std
+  801b8b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b8e:	fc                   	cld
+  801b8f:	48 89 c8             	mov    %rcx,%rax
+  801b92:	48 89 f2             	mov    %rsi,%rdx
+  801b95:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b99:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801ba1:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801ba6:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801bab:	eb 17                	jmp    801bc4 <memmove+0xf6>
+      *--d = *--s;
+  801bad:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801bb2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801bb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bbb:	0f b6 10             	movzbl (%rax),%edx
+  801bbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801bc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bcc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bd0:	48 85 c0             	test   %rax,%rax
+  801bd3:	75 d8                	jne    801bad <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801bd5:	e9 f4 00 00 00       	jmp    801cce <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801bda:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801bdf:	76 46                	jbe    801c27 <memmove+0x159>
+  801be1:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+  801bed:	83 e0 01             	and    $0x1,%eax
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	74 33                	je     801c27 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801bf4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bf8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bfc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c00:	48 89 cf             	mov    %rcx,%rdi
+  801c03:	48 89 d6             	mov    %rdx,%rsi
+  801c06:	48 89 c1             	mov    %rax,%rcx
+  801c09:	fc                   	cld
+  801c0a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c0c:	48 89 c8             	mov    %rcx,%rax
+  801c0f:	48 89 f2             	mov    %rsi,%rdx
+  801c12:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c16:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c1a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801c1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c22:	e9 ab 00 00 00       	jmp    801cd2 <memmove+0x204>
+    if (n >= 8) {
+  801c27:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c2c:	0f 86 8b 00 00 00    	jbe    801cbd <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801c32:	eb 22                	jmp    801c56 <memmove+0x188>
+        *d++ = *s++;
+  801c34:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c38:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c44:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c48:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c4c:	0f b6 12             	movzbl (%rdx),%edx
+  801c4f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c51:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c5a:	83 e0 07             	and    $0x7,%eax
+  801c5d:	48 85 c0             	test   %rax,%rax
+  801c60:	75 d2                	jne    801c34 <memmove+0x166>
+      nq = n / 8;
+  801c62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c66:	48 c1 e8 03          	shr    $0x3,%rax
+  801c6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c6e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c7a:	48 89 cf             	mov    %rcx,%rdi
+  801c7d:	48 89 d6             	mov    %rdx,%rsi
+  801c80:	48 89 c1             	mov    %rax,%rcx
+  801c83:	fc                   	cld
+  801c84:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c87:	48 89 c8             	mov    %rcx,%rax
+  801c8a:	48 89 f2             	mov    %rsi,%rdx
+  801c8d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c91:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c99:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801c9e:	eb 1d                	jmp    801cbd <memmove+0x1ef>
+      *d++ = *s++;
+  801ca0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ca4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ca8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cb0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cb4:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801cb8:	0f b6 12             	movzbl (%rdx),%edx
+  801cbb:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801cbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cc5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cc9:	48 85 c0             	test   %rax,%rax
+  801ccc:	75 d2                	jne    801ca0 <memmove+0x1d2>
+  return dst;
+  801cce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801cd2:	c9                   	leave
+  801cd3:	c3                   	ret
+
+0000000000801cd4 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801cd4:	55                   	push   %rbp
+  801cd5:	48 89 e5             	mov    %rsp,%rbp
+  801cd8:	48 83 ec 18          	sub    $0x18,%rsp
+  801cdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ce0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ce4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801ce8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cf4:	48 89 ce             	mov    %rcx,%rsi
+  801cf7:	48 89 c7             	mov    %rax,%rdi
+  801cfa:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  801d01:	00 00 00 
+  801d04:	ff d0                	call   *%rax
+}
+  801d06:	c9                   	leave
+  801d07:	c3                   	ret
+
+0000000000801d08 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d08:	55                   	push   %rbp
+  801d09:	48 89 e5             	mov    %rsp,%rbp
+  801d0c:	48 83 ec 40          	sub    $0x40,%rsp
+  801d10:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d14:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d18:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801d1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801d24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d28:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d2c:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801d31:	0f 86 a7 00 00 00    	jbe    801dde <memcmp+0xd6>
+  801d37:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  801d3e:	00 00 00 
+  801d41:	ff d0                	call   *%rax
+  801d43:	83 e0 02             	and    $0x2,%eax
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	0f 84 90 00 00 00    	je     801dde <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801d4e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d52:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d5a:	48 89 ce             	mov    %rcx,%rsi
+  801d5d:	48 89 c7             	mov    %rax,%rdi
+  801d60:	48 b8 ef 12 80 00 00 	movabs $0x8012ef,%rax
+  801d67:	00 00 00 
+  801d6a:	ff d0                	call   *%rax
+  801d6c:	e9 c2 00 00 00       	jmp    801e33 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801d71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d75:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d79:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d81:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d85:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d89:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d8d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801d90:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801d97:	74 36                	je     801dcf <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801d99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d9c:	f7 d0                	not    %eax
+  801d9e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801da2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801da5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801da8:	48 63 d0             	movslq %eax,%rdx
+  801dab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801daf:	48 01 d0             	add    %rdx,%rax
+  801db2:	0f b6 00             	movzbl (%rax),%eax
+  801db5:	0f b6 c0             	movzbl %al,%eax
+  801db8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801dbb:	48 63 ca             	movslq %edx,%rcx
+  801dbe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dc2:	48 01 ca             	add    %rcx,%rdx
+  801dc5:	0f b6 12             	movzbl (%rdx),%edx
+  801dc8:	0f b6 d2             	movzbl %dl,%edx
+  801dcb:	29 d0                	sub    %edx,%eax
+  801dcd:	eb 64                	jmp    801e33 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801dcf:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801dd4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801dd9:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801dde:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801de3:	77 8c                	ja     801d71 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801de5:	eb 36                	jmp    801e1d <memcmp+0x115>
+    if (*s1 != *s2)
+  801de7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801deb:	0f b6 10             	movzbl (%rax),%edx
+  801dee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801df2:	0f b6 00             	movzbl (%rax),%eax
+  801df5:	38 c2                	cmp    %al,%dl
+  801df7:	74 1a                	je     801e13 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801df9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dfd:	0f b6 00             	movzbl (%rax),%eax
+  801e00:	0f b6 c8             	movzbl %al,%ecx
+  801e03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e07:	0f b6 00             	movzbl (%rax),%eax
+  801e0a:	0f b6 d0             	movzbl %al,%edx
+  801e0d:	89 c8                	mov    %ecx,%eax
+  801e0f:	29 d0                	sub    %edx,%eax
+  801e11:	eb 20                	jmp    801e33 <memcmp+0x12b>
+    s1++, s2++;
+  801e13:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e18:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801e1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e21:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e25:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e29:	48 85 c0             	test   %rax,%rax
+  801e2c:	75 b9                	jne    801de7 <memcmp+0xdf>
+  }
+
+  return 0;
+  801e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e33:	c9                   	leave
+  801e34:	c3                   	ret
+
+0000000000801e35 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801e35:	55                   	push   %rbp
+  801e36:	48 89 e5             	mov    %rsp,%rbp
+  801e39:	48 83 ec 50          	sub    $0x50,%rsp
+  801e3d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e41:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e44:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e48:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e4c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801e50:	48 01 d0             	add    %rdx,%rax
+  801e53:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801e57:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e5a:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e5e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e62:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e66:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e6b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e6f:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801e74:	76 73                	jbe    801ee9 <memfind+0xb4>
+  801e76:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	83 e0 02             	and    $0x2,%eax
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	74 60                	je     801ee9 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801e89:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e8c:	0f b6 c8             	movzbl %al,%ecx
+  801e8f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801e93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e97:	89 ce                	mov    %ecx,%esi
+  801e99:	48 89 c7             	mov    %rax,%rdi
+  801e9c:	48 b8 de 13 80 00 00 	movabs $0x8013de,%rax
+  801ea3:	00 00 00 
+  801ea6:	ff d0                	call   *%rax
+  801ea8:	eb 6c                	jmp    801f16 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801eaa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eae:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801eb2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801eb6:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801ebb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ebf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ec3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801ec6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801eca:	74 13                	je     801edf <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801ecc:	31 c0                	xor    %eax,%eax
+  801ece:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801ed3:	48 63 d0             	movslq %eax,%rdx
+  801ed6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eda:	48 01 d0             	add    %rdx,%rax
+  801edd:	eb 37                	jmp    801f16 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801edf:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801ee4:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801ee9:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801eee:	77 ba                	ja     801eaa <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801ef0:	eb 13                	jmp    801f05 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801ef2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef6:	0f b6 00             	movzbl (%rax),%eax
+  801ef9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801efc:	38 d0                	cmp    %dl,%al
+  801efe:	74 11                	je     801f11 <memfind+0xdc>
+  for (; s < ends; s++)
+  801f00:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f09:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f0d:	72 e3                	jb     801ef2 <memfind+0xbd>
+  801f0f:	eb 01                	jmp    801f12 <memfind+0xdd>
+      break;
+  801f11:	90                   	nop
+  return (void *)s;
+  801f12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+0000000000801f18 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f18:	55                   	push   %rbp
+  801f19:	48 89 e5             	mov    %rsp,%rbp
+  801f1c:	48 83 ec 38          	sub    $0x38,%rsp
+  801f20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f24:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f28:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801f2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801f32:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801f39:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f3a:	eb 05                	jmp    801f41 <strtol+0x29>
+    s++;
+  801f3c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f45:	0f b6 00             	movzbl (%rax),%eax
+  801f48:	3c 20                	cmp    $0x20,%al
+  801f4a:	74 f0                	je     801f3c <strtol+0x24>
+  801f4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f50:	0f b6 00             	movzbl (%rax),%eax
+  801f53:	3c 09                	cmp    $0x9,%al
+  801f55:	74 e5                	je     801f3c <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801f57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f5b:	0f b6 00             	movzbl (%rax),%eax
+  801f5e:	3c 2b                	cmp    $0x2b,%al
+  801f60:	75 07                	jne    801f69 <strtol+0x51>
+    s++;
+  801f62:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f67:	eb 17                	jmp    801f80 <strtol+0x68>
+  else if (*s == '-')
+  801f69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f6d:	0f b6 00             	movzbl (%rax),%eax
+  801f70:	3c 2d                	cmp    $0x2d,%al
+  801f72:	75 0c                	jne    801f80 <strtol+0x68>
+    s++, neg = 1;
+  801f74:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f79:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f80:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f84:	74 06                	je     801f8c <strtol+0x74>
+  801f86:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f8a:	75 28                	jne    801fb4 <strtol+0x9c>
+  801f8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f90:	0f b6 00             	movzbl (%rax),%eax
+  801f93:	3c 30                	cmp    $0x30,%al
+  801f95:	75 1d                	jne    801fb4 <strtol+0x9c>
+  801f97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f9b:	48 83 c0 01          	add    $0x1,%rax
+  801f9f:	0f b6 00             	movzbl (%rax),%eax
+  801fa2:	3c 78                	cmp    $0x78,%al
+  801fa4:	75 0e                	jne    801fb4 <strtol+0x9c>
+    s += 2, base = 16;
+  801fa6:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801fab:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801fb2:	eb 2c                	jmp    801fe0 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801fb4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fb8:	75 19                	jne    801fd3 <strtol+0xbb>
+  801fba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fbe:	0f b6 00             	movzbl (%rax),%eax
+  801fc1:	3c 30                	cmp    $0x30,%al
+  801fc3:	75 0e                	jne    801fd3 <strtol+0xbb>
+    s++, base = 8;
+  801fc5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fca:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801fd1:	eb 0d                	jmp    801fe0 <strtol+0xc8>
+  else if (base == 0)
+  801fd3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fd7:	75 07                	jne    801fe0 <strtol+0xc8>
+    base = 10;
+  801fd9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801fe0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe4:	0f b6 00             	movzbl (%rax),%eax
+  801fe7:	3c 2f                	cmp    $0x2f,%al
+  801fe9:	7e 1d                	jle    802008 <strtol+0xf0>
+  801feb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fef:	0f b6 00             	movzbl (%rax),%eax
+  801ff2:	3c 39                	cmp    $0x39,%al
+  801ff4:	7f 12                	jg     802008 <strtol+0xf0>
+      dig = *s - '0';
+  801ff6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ffa:	0f b6 00             	movzbl (%rax),%eax
+  801ffd:	0f be c0             	movsbl %al,%eax
+  802000:	83 e8 30             	sub    $0x30,%eax
+  802003:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802006:	eb 4e                	jmp    802056 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802008:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80200c:	0f b6 00             	movzbl (%rax),%eax
+  80200f:	3c 60                	cmp    $0x60,%al
+  802011:	7e 1d                	jle    802030 <strtol+0x118>
+  802013:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802017:	0f b6 00             	movzbl (%rax),%eax
+  80201a:	3c 7a                	cmp    $0x7a,%al
+  80201c:	7f 12                	jg     802030 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80201e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802022:	0f b6 00             	movzbl (%rax),%eax
+  802025:	0f be c0             	movsbl %al,%eax
+  802028:	83 e8 57             	sub    $0x57,%eax
+  80202b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80202e:	eb 26                	jmp    802056 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802030:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802034:	0f b6 00             	movzbl (%rax),%eax
+  802037:	3c 40                	cmp    $0x40,%al
+  802039:	7e 47                	jle    802082 <strtol+0x16a>
+  80203b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80203f:	0f b6 00             	movzbl (%rax),%eax
+  802042:	3c 5a                	cmp    $0x5a,%al
+  802044:	7f 3c                	jg     802082 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802046:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80204a:	0f b6 00             	movzbl (%rax),%eax
+  80204d:	0f be c0             	movsbl %al,%eax
+  802050:	83 e8 37             	sub    $0x37,%eax
+  802053:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802056:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802059:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80205c:	7d 23                	jge    802081 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80205e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802063:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802066:	48 98                	cltq
+  802068:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80206d:	48 89 c2             	mov    %rax,%rdx
+  802070:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802073:	48 98                	cltq
+  802075:	48 01 d0             	add    %rdx,%rax
+  802078:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80207c:	e9 5f ff ff ff       	jmp    801fe0 <strtol+0xc8>
+      break;
+  802081:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802082:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802087:	74 0b                	je     802094 <strtol+0x17c>
+    *endptr = (char *)s;
+  802089:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80208d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802091:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802094:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802098:	74 09                	je     8020a3 <strtol+0x18b>
+  80209a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80209e:	48 f7 d8             	neg    %rax
+  8020a1:	eb 04                	jmp    8020a7 <strtol+0x18f>
+  8020a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8020a7:	c9                   	leave
+  8020a8:	c3                   	ret
+
+00000000008020a9 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8020a9:	55                   	push   %rbp
+  8020aa:	48 89 e5             	mov    %rsp,%rbp
+  8020ad:	53                   	push   %rbx
+  8020ae:	48 83 ec 48          	sub    $0x48,%rsp
+  8020b2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8020b6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8020ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020be:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8020c2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8020c6:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8020ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ce:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020d2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020d6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8020da:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020de:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8020e2:	4c 89 c3             	mov    %r8,%rbx
+  8020e5:	cd 30                	int    $0x30
+  8020e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8020eb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8020f0:	74 46                	je     802138 <syscall+0x8f>
+  8020f2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8020f7:	7e 3f                	jle    802138 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8020f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802101:	49 89 d0             	mov    %rdx,%r8
+  802104:	48 89 c1             	mov    %rax,%rcx
+  802107:	48 b8 68 59 80 00 00 	movabs $0x805968,%rax
+  80210e:	00 00 00 
+  802111:	48 89 c2             	mov    %rax,%rdx
+  802114:	be 22 00 00 00       	mov    $0x22,%esi
+  802119:	48 b8 87 59 80 00 00 	movabs $0x805987,%rax
+  802120:	00 00 00 
+  802123:	48 89 c7             	mov    %rax,%rdi
+  802126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212b:	49 b9 e9 4e 80 00 00 	movabs $0x804ee9,%r9
+  802132:	00 00 00 
+  802135:	41 ff d1             	call   *%r9
+
+  return ret;
+  802138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80213c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+
+0000000000802142 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	48 83 ec 10          	sub    $0x10,%rsp
+  80214a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80214e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802152:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802156:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80215a:	48 83 ec 08          	sub    $0x8,%rsp
+  80215e:	6a 00                	push   $0x0
+  802160:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216c:	48 89 d1             	mov    %rdx,%rcx
+  80216f:	48 89 c2             	mov    %rax,%rdx
+  802172:	be 00 00 00 00       	mov    $0x0,%esi
+  802177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217c:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218c:	90                   	nop
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+000000000080218f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80218f:	55                   	push   %rbp
+  802190:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802193:	48 83 ec 08          	sub    $0x8,%rsp
+  802197:	6a 00                	push   $0x0
+  802199:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021af:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021b9:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+  8021c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c9:	c9                   	leave
+  8021ca:	c3                   	ret
+
+00000000008021cb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+  8021cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021d9:	48 98                	cltq
+  8021db:	48 83 ec 08          	sub    $0x8,%rsp
+  8021df:	6a 00                	push   $0x0
+  8021e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f2:	48 89 c2             	mov    %rax,%rdx
+  8021f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8021fa:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021ff:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802206:	00 00 00 
+  802209:	ff d0                	call   *%rax
+  80220b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80220f:	c9                   	leave
+  802210:	c3                   	ret
+
+0000000000802211 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802211:	55                   	push   %rbp
+  802212:	48 89 e5             	mov    %rsp,%rbp
+  802215:	48 83 ec 10          	sub    $0x10,%rsp
+  802219:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80221c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80221f:	48 98                	cltq
+  802221:	48 83 ec 08          	sub    $0x8,%rsp
+  802225:	6a 00                	push   $0x0
+  802227:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802233:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802238:	48 89 c2             	mov    %rax,%rdx
+  80223b:	be 00 00 00 00       	mov    $0x0,%esi
+  802240:	bf 04 00 00 00       	mov    $0x4,%edi
+  802245:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80224c:	00 00 00 
+  80224f:	ff d0                	call   *%rax
+  802251:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802255:	90                   	nop
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+0000000000802258 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802258:	55                   	push   %rbp
+  802259:	48 89 e5             	mov    %rsp,%rbp
+  80225c:	48 83 ec 20          	sub    $0x20,%rsp
+  802260:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802263:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802267:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80226a:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80226d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802272:	cd 30                	int    $0x30
+  802274:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802278:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80227c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802281:	7e 3d                	jle    8022c0 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802287:	49 89 c0             	mov    %rax,%r8
+  80228a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80228f:	48 b8 68 59 80 00 00 	movabs $0x805968,%rax
+  802296:	00 00 00 
+  802299:	48 89 c2             	mov    %rax,%rdx
+  80229c:	be 49 00 00 00       	mov    $0x49,%esi
+  8022a1:	48 b8 87 59 80 00 00 	movabs $0x805987,%rax
+  8022a8:	00 00 00 
+  8022ab:	48 89 c7             	mov    %rax,%rdi
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b3:	49 b9 e9 4e 80 00 00 	movabs $0x804ee9,%r9
+  8022ba:	00 00 00 
+  8022bd:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8022c0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022c5:	75 13                	jne    8022da <sys_env_wait+0x82>
+  8022c7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8022cc:	74 0c                	je     8022da <sys_env_wait+0x82>
+    *status = st;
+  8022ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022d2:	89 c2                	mov    %eax,%edx
+  8022d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022d8:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8022da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+00000000008022e0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8022e0:	55                   	push   %rbp
+  8022e1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8022e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e8:	6a 00                	push   $0x0
+  8022ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802300:	be 00 00 00 00       	mov    $0x0,%esi
+  802305:	bf 02 00 00 00       	mov    $0x2,%edi
+  80230a:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+  802316:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80231a:	c9                   	leave
+  80231b:	c3                   	ret
+
+000000000080231c <sys_yield>:
+
+void
+sys_yield(void) {
+  80231c:	55                   	push   %rbp
+  80231d:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802320:	48 83 ec 08          	sub    $0x8,%rsp
+  802324:	6a 00                	push   $0x0
+  802326:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802332:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233c:	be 00 00 00 00       	mov    $0x0,%esi
+  802341:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802346:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+  802352:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802356:	90                   	nop
+  802357:	c9                   	leave
+  802358:	c3                   	ret
+
+0000000000802359 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802359:	55                   	push   %rbp
+  80235a:	48 89 e5             	mov    %rsp,%rbp
+  80235d:	48 83 ec 20          	sub    $0x20,%rsp
+  802361:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802364:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802368:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80236b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80236e:	48 63 c8             	movslq %eax,%rcx
+  802371:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802375:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802378:	48 98                	cltq
+  80237a:	48 83 ec 08          	sub    $0x8,%rsp
+  80237e:	6a 00                	push   $0x0
+  802380:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802386:	49 89 c8             	mov    %rcx,%r8
+  802389:	48 89 d1             	mov    %rdx,%rcx
+  80238c:	48 89 c2             	mov    %rax,%rdx
+  80238f:	be 01 00 00 00       	mov    $0x1,%esi
+  802394:	bf 06 00 00 00       	mov    $0x6,%edi
+  802399:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	48 83 c4 10          	add    $0x10,%rsp
+  8023a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8023ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8023af:	c9                   	leave
+  8023b0:	c3                   	ret
+
+00000000008023b1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8023b1:	55                   	push   %rbp
+  8023b2:	48 89 e5             	mov    %rsp,%rbp
+  8023b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8023b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023c0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8023c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023c7:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8023cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023ce:	48 63 c8             	movslq %eax,%rcx
+  8023d1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023d8:	48 63 f0             	movslq %eax,%rsi
+  8023db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023e2:	48 98                	cltq
+  8023e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e8:	51                   	push   %rcx
+  8023e9:	49 89 f9             	mov    %rdi,%r9
+  8023ec:	49 89 f0             	mov    %rsi,%r8
+  8023ef:	48 89 d1             	mov    %rdx,%rcx
+  8023f2:	48 89 c2             	mov    %rax,%rdx
+  8023f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8023fa:	bf 07 00 00 00       	mov    $0x7,%edi
+  8023ff:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+  80240b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240f:	c9                   	leave
+  802410:	c3                   	ret
+
+0000000000802411 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802411:	55                   	push   %rbp
+  802412:	48 89 e5             	mov    %rsp,%rbp
+  802415:	48 83 ec 10          	sub    $0x10,%rsp
+  802419:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80241c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802420:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802424:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802427:	48 98                	cltq
+  802429:	48 83 ec 08          	sub    $0x8,%rsp
+  80242d:	6a 00                	push   $0x0
+  80242f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80243b:	48 89 d1             	mov    %rdx,%rcx
+  80243e:	48 89 c2             	mov    %rax,%rdx
+  802441:	be 01 00 00 00       	mov    $0x1,%esi
+  802446:	bf 08 00 00 00       	mov    $0x8,%edi
+  80244b:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802452:	00 00 00 
+  802455:	ff d0                	call   *%rax
+  802457:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+000000000080245d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80245d:	55                   	push   %rbp
+  80245e:	48 89 e5             	mov    %rsp,%rbp
+  802461:	48 83 ec 10          	sub    $0x10,%rsp
+  802465:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802468:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80246b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80246e:	48 63 d0             	movslq %eax,%rdx
+  802471:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802474:	48 98                	cltq
+  802476:	48 83 ec 08          	sub    $0x8,%rsp
+  80247a:	6a 00                	push   $0x0
+  80247c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802482:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802488:	48 89 d1             	mov    %rdx,%rcx
+  80248b:	48 89 c2             	mov    %rax,%rdx
+  80248e:	be 01 00 00 00       	mov    $0x1,%esi
+  802493:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802498:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80249f:	00 00 00 
+  8024a2:	ff d0                	call   *%rax
+  8024a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+00000000008024aa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+  8024ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8024b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024c0:	48 98                	cltq
+  8024c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c6:	6a 00                	push   $0x0
+  8024c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024d4:	48 89 d1             	mov    %rdx,%rcx
+  8024d7:	48 89 c2             	mov    %rax,%rdx
+  8024da:	be 01 00 00 00       	mov    $0x1,%esi
+  8024df:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024e4:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+  8024f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f4:	c9                   	leave
+  8024f5:	c3                   	ret
+
+00000000008024f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8024f6:	55                   	push   %rbp
+  8024f7:	48 89 e5             	mov    %rsp,%rbp
+  8024fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8024fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802501:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802505:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802509:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80250c:	48 98                	cltq
+  80250e:	48 83 ec 08          	sub    $0x8,%rsp
+  802512:	6a 00                	push   $0x0
+  802514:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80251a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802520:	48 89 d1             	mov    %rdx,%rcx
+  802523:	48 89 c2             	mov    %rax,%rdx
+  802526:	be 01 00 00 00       	mov    $0x1,%esi
+  80252b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802530:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+0000000000802542 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	48 83 ec 20          	sub    $0x20,%rsp
+  80254a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80254d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802551:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802555:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802558:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80255b:	48 63 f0             	movslq %eax,%rsi
+  80255e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802562:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802566:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802569:	48 98                	cltq
+  80256b:	48 83 ec 08          	sub    $0x8,%rsp
+  80256f:	6a 00                	push   $0x0
+  802571:	49 89 f1             	mov    %rsi,%r9
+  802574:	49 89 c8             	mov    %rcx,%r8
+  802577:	48 89 d1             	mov    %rdx,%rcx
+  80257a:	48 89 c2             	mov    %rax,%rdx
+  80257d:	be 00 00 00 00       	mov    $0x0,%esi
+  802582:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802587:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+  802593:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802597:	c9                   	leave
+  802598:	c3                   	ret
+
+0000000000802599 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802599:	55                   	push   %rbp
+  80259a:	48 89 e5             	mov    %rsp,%rbp
+  80259d:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8025a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ad:	6a 00                	push   $0x0
+  8025af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c0:	48 89 c2             	mov    %rax,%rdx
+  8025c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c8:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025cd:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+
+00000000008025df <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8025ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8025fb:	6a 00                	push   $0x0
+  8025fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802603:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802609:	48 89 d1             	mov    %rdx,%rcx
+  80260c:	48 89 c2             	mov    %rax,%rdx
+  80260f:	be 01 00 00 00       	mov    $0x1,%esi
+  802614:	bf 10 00 00 00       	mov    $0x10,%edi
+  802619:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802620:	00 00 00 
+  802623:	ff d0                	call   *%rax
+  802625:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802629:	c9                   	leave
+  80262a:	c3                   	ret
+
+000000000080262b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80262f:	48 83 ec 08          	sub    $0x8,%rsp
+  802633:	6a 00                	push   $0x0
+  802635:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80263b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802641:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802646:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264b:	be 00 00 00 00       	mov    $0x0,%esi
+  802650:	bf 11 00 00 00       	mov    $0x11,%edi
+  802655:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+  802661:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802665:	c9                   	leave
+  802666:	c3                   	ret
+
+0000000000802667 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802667:	55                   	push   %rbp
+  802668:	48 89 e5             	mov    %rsp,%rbp
+  80266b:	48 83 ec 10          	sub    $0x10,%rsp
+  80266f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802673:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802677:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80267b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267f:	48 83 ec 08          	sub    $0x8,%rsp
+  802683:	6a 00                	push   $0x0
+  802685:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80268b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802691:	48 89 d1             	mov    %rdx,%rcx
+  802694:	48 89 c2             	mov    %rax,%rdx
+  802697:	be 00 00 00 00       	mov    $0x0,%esi
+  80269c:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026a1:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+  8026ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+00000000008026b3 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8026b3:	55                   	push   %rbp
+  8026b4:	48 89 e5             	mov    %rsp,%rbp
+  8026b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8026bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026c3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8026c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026c9:	48 63 c8             	movslq %eax,%rcx
+  8026cc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d8:	6a 00                	push   $0x0
+  8026da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026e0:	49 89 c8             	mov    %rcx,%r8
+  8026e3:	48 89 d1             	mov    %rdx,%rcx
+  8026e6:	48 89 c2             	mov    %rax,%rdx
+  8026e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ee:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026f3:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802703:	c9                   	leave
+  802704:	c3                   	ret
+
+0000000000802705 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802705:	55                   	push   %rbp
+  802706:	48 89 e5             	mov    %rsp,%rbp
+  802709:	48 83 ec 20          	sub    $0x20,%rsp
+  80270d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802711:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802714:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802718:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80271c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80271f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802723:	48 83 ec 08          	sub    $0x8,%rsp
+  802727:	6a 00                	push   $0x0
+  802729:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80272f:	49 89 c8             	mov    %rcx,%r8
+  802732:	48 89 d1             	mov    %rdx,%rcx
+  802735:	48 89 c2             	mov    %rax,%rdx
+  802738:	be 00 00 00 00       	mov    $0x0,%esi
+  80273d:	bf 14 00 00 00       	mov    $0x14,%edi
+  802742:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802749:	00 00 00 
+  80274c:	ff d0                	call   *%rax
+  80274e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+
+0000000000802754 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802754:	55                   	push   %rbp
+  802755:	48 89 e5             	mov    %rsp,%rbp
+  802758:	48 83 ec 10          	sub    $0x10,%rsp
+  80275c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802760:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802763:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802766:	48 63 d0             	movslq %eax,%rdx
+  802769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80276d:	48 83 ec 08          	sub    $0x8,%rsp
+  802771:	6a 00                	push   $0x0
+  802773:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802779:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80277f:	48 89 d1             	mov    %rdx,%rcx
+  802782:	48 89 c2             	mov    %rax,%rdx
+  802785:	be 00 00 00 00       	mov    $0x0,%esi
+  80278a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80278f:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802796:	00 00 00 
+  802799:	ff d0                	call   *%rax
+  80279b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80279f:	c9                   	leave
+  8027a0:	c3                   	ret
+
+00000000008027a1 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8027a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027ad:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027b0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8027b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8027b7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027bb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8027be:	48 63 c8             	movslq %eax,%rcx
+  8027c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027c4:	48 63 d0             	movslq %eax,%rdx
+  8027c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027cf:	6a 00                	push   $0x0
+  8027d1:	49 89 f1             	mov    %rsi,%r9
+  8027d4:	49 89 c8             	mov    %rcx,%r8
+  8027d7:	48 89 d1             	mov    %rdx,%rcx
+  8027da:	48 89 c2             	mov    %rax,%rdx
+  8027dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027e7:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+00000000008027f9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	48 83 ec 30          	sub    $0x30,%rsp
+  802801:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802805:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802809:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80280d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802811:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802815:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802819:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80281d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802821:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802825:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802829:	48 83 ec 08          	sub    $0x8,%rsp
+  80282d:	51                   	push   %rcx
+  80282e:	49 89 f9             	mov    %rdi,%r9
+  802831:	49 89 f0             	mov    %rsi,%r8
+  802834:	48 89 d1             	mov    %rdx,%rcx
+  802837:	48 89 c2             	mov    %rax,%rdx
+  80283a:	be 00 00 00 00       	mov    $0x0,%esi
+  80283f:	bf 17 00 00 00       	mov    $0x17,%edi
+  802844:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  80284b:	00 00 00 
+  80284e:	ff d0                	call   *%rax
+  802850:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802854:	c9                   	leave
+  802855:	c3                   	ret
+
+0000000000802856 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802856:	55                   	push   %rbp
+  802857:	48 89 e5             	mov    %rsp,%rbp
+  80285a:	48 83 ec 10          	sub    $0x10,%rsp
+  80285e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802861:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802864:	48 98                	cltq
+  802866:	48 83 ec 08          	sub    $0x8,%rsp
+  80286a:	6a 00                	push   $0x0
+  80286c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802872:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802878:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80287d:	48 89 c2             	mov    %rax,%rdx
+  802880:	be 00 00 00 00       	mov    $0x0,%esi
+  802885:	bf 18 00 00 00       	mov    $0x18,%edi
+  80288a:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+  802896:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80289a:	90                   	nop
+  80289b:	c9                   	leave
+  80289c:	c3                   	ret
+
+000000000080289d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+  8028a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8028a5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8028b0:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8028b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8028b6:	48 63 f0             	movslq %eax,%rsi
+  8028b9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8028c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028c4:	48 98                	cltq
+  8028c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ca:	6a 00                	push   $0x0
+  8028cc:	49 89 f1             	mov    %rsi,%r9
+  8028cf:	49 89 c8             	mov    %rcx,%r8
+  8028d2:	48 89 d1             	mov    %rdx,%rcx
+  8028d5:	48 89 c2             	mov    %rax,%rdx
+  8028d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028dd:	bf 19 00 00 00       	mov    $0x19,%edi
+  8028e2:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	48 83 c4 10          	add    $0x10,%rsp
+  8028f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8028f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8028f8:	c9                   	leave
+  8028f9:	c3                   	ret
+
+00000000008028fa <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8028fa:	55                   	push   %rbp
+  8028fb:	48 89 e5             	mov    %rsp,%rbp
+  8028fe:	48 83 ec 20          	sub    $0x20,%rsp
+  802902:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802906:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80290a:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80290d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802910:	48 63 c8             	movslq %eax,%rcx
+  802913:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802917:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80291b:	48 83 ec 08          	sub    $0x8,%rsp
+  80291f:	6a 00                	push   $0x0
+  802921:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802927:	49 89 c8             	mov    %rcx,%r8
+  80292a:	48 89 d1             	mov    %rdx,%rcx
+  80292d:	48 89 c2             	mov    %rax,%rdx
+  802930:	be 01 00 00 00       	mov    $0x1,%esi
+  802935:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80293a:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80294a:	c9                   	leave
+  80294b:	c3                   	ret
+
+000000000080294c <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80294c:	55                   	push   %rbp
+  80294d:	48 89 e5             	mov    %rsp,%rbp
+  802950:	48 83 ec 20          	sub    $0x20,%rsp
+  802954:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802958:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80295c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802960:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802964:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802968:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80296c:	48 83 ec 08          	sub    $0x8,%rsp
+  802970:	6a 00                	push   $0x0
+  802972:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802978:	49 89 c8             	mov    %rcx,%r8
+  80297b:	48 89 d1             	mov    %rdx,%rcx
+  80297e:	48 89 c2             	mov    %rax,%rdx
+  802981:	be 01 00 00 00       	mov    $0x1,%esi
+  802986:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80298b:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802992:	00 00 00 
+  802995:	ff d0                	call   *%rax
+  802997:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+000000000080299d <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  80299d:	55                   	push   %rbp
+  80299e:	48 89 e5             	mov    %rsp,%rbp
+  8029a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8029a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029ad:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8029b0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8029b4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8029b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029bb:	48 63 c8             	movslq %eax,%rcx
+  8029be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ca:	6a 00                	push   $0x0
+  8029cc:	49 89 f1             	mov    %rsi,%r9
+  8029cf:	49 89 c8             	mov    %rcx,%r8
+  8029d2:	48 89 d1             	mov    %rdx,%rcx
+  8029d5:	48 89 c2             	mov    %rax,%rdx
+  8029d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029dd:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8029e2:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  8029e9:	00 00 00 
+  8029ec:	ff d0                	call   *%rax
+  8029ee:	48 83 c4 10          	add    $0x10,%rsp
+  8029f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8029f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+00000000008029fa <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8029fa:	55                   	push   %rbp
+  8029fb:	48 89 e5             	mov    %rsp,%rbp
+  8029fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802a02:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a08:	48 98                	cltq
+  802a0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a0e:	6a 00                	push   $0x0
+  802a10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a21:	48 89 c2             	mov    %rax,%rdx
+  802a24:	be 01 00 00 00       	mov    $0x1,%esi
+  802a29:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802a2e:	48 b8 a9 20 80 00 00 	movabs $0x8020a9,%rax
+  802a35:	00 00 00 
+  802a38:	ff d0                	call   *%rax
+  802a3a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a3e:	c9                   	leave
+  802a3f:	c3                   	ret
+
+0000000000802a40 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802a40:	55                   	push   %rbp
+  802a41:	48 89 e5             	mov    %rsp,%rbp
+  802a44:	48 83 ec 08          	sub    $0x8,%rsp
+  802a48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802a4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a50:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802a57:	ff ff ff 
+  802a5a:	48 01 d0             	add    %rdx,%rax
+  802a5d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+
+0000000000802a63 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802a63:	55                   	push   %rbp
+  802a64:	48 89 e5             	mov    %rsp,%rbp
+  802a67:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a73:	48 89 c7             	mov    %rax,%rdi
+  802a76:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802a88:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802a8c:	c9                   	leave
+  802a8d:	c3                   	ret
+
+0000000000802a8e <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802a8e:	55                   	push   %rbp
+  802a8f:	48 89 e5             	mov    %rsp,%rbp
+  802a92:	48 83 ec 18          	sub    $0x18,%rsp
+  802a96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802a9a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802aa1:	e9 ae 00 00 00       	jmp    802b54 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802aa6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aa9:	c1 e0 0c             	shl    $0xc,%eax
+  802aac:	48 98                	cltq
+  802aae:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ab3:	48 01 d0             	add    %rdx,%rax
+  802ab6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802aba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802abe:	48 c1 e8 27          	shr    $0x27,%rax
+  802ac2:	48 89 c2             	mov    %rax,%rdx
+  802ac5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802acc:	01 00 00 
+  802acf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ad3:	83 e0 01             	and    $0x1,%eax
+  802ad6:	48 85 c0             	test   %rax,%rax
+  802ad9:	74 63                	je     802b3e <fd_alloc+0xb0>
+  802adb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802adf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ae3:	48 89 c2             	mov    %rax,%rdx
+  802ae6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802aed:	01 00 00 
+  802af0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802af4:	83 e0 01             	and    $0x1,%eax
+  802af7:	48 85 c0             	test   %rax,%rax
+  802afa:	74 42                	je     802b3e <fd_alloc+0xb0>
+  802afc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b00:	48 c1 e8 15          	shr    $0x15,%rax
+  802b04:	48 89 c2             	mov    %rax,%rdx
+  802b07:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b0e:	01 00 00 
+  802b11:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b15:	83 e0 01             	and    $0x1,%eax
+  802b18:	48 85 c0             	test   %rax,%rax
+  802b1b:	74 21                	je     802b3e <fd_alloc+0xb0>
+  802b1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b21:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b25:	48 89 c2             	mov    %rax,%rdx
+  802b28:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b2f:	01 00 00 
+  802b32:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b36:	83 e0 01             	and    $0x1,%eax
+  802b39:	48 85 c0             	test   %rax,%rax
+  802b3c:	75 12                	jne    802b50 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b46:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4e:	eb 1e                	jmp    802b6e <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802b50:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b54:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b58:	0f 8e 48 ff ff ff    	jle    802aa6 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802b5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b62:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b69:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+
+0000000000802b70 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b70:	55                   	push   %rbp
+  802b71:	48 89 e5             	mov    %rsp,%rbp
+  802b74:	48 83 ec 20          	sub    $0x20,%rsp
+  802b78:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b7b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b83:	78 06                	js     802b8b <fd_lookup+0x1b>
+  802b85:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b89:	7e 0a                	jle    802b95 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b90:	e9 af 00 00 00       	jmp    802c44 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802b95:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b98:	c1 e0 0c             	shl    $0xc,%eax
+  802b9b:	48 98                	cltq
+  802b9d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ba2:	48 01 d0             	add    %rdx,%rax
+  802ba5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802ba9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bad:	48 c1 e8 27          	shr    $0x27,%rax
+  802bb1:	48 89 c2             	mov    %rax,%rdx
+  802bb4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802bbb:	01 00 00 
+  802bbe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc2:	83 e0 01             	and    $0x1,%eax
+  802bc5:	48 85 c0             	test   %rax,%rax
+  802bc8:	74 63                	je     802c2d <fd_lookup+0xbd>
+  802bca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bce:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bd2:	48 89 c2             	mov    %rax,%rdx
+  802bd5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802bdc:	01 00 00 
+  802bdf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be3:	83 e0 01             	and    $0x1,%eax
+  802be6:	48 85 c0             	test   %rax,%rax
+  802be9:	74 42                	je     802c2d <fd_lookup+0xbd>
+  802beb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bef:	48 c1 e8 15          	shr    $0x15,%rax
+  802bf3:	48 89 c2             	mov    %rax,%rdx
+  802bf6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bfd:	01 00 00 
+  802c00:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c04:	83 e0 01             	and    $0x1,%eax
+  802c07:	48 85 c0             	test   %rax,%rax
+  802c0a:	74 21                	je     802c2d <fd_lookup+0xbd>
+  802c0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c10:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c14:	48 89 c2             	mov    %rax,%rdx
+  802c17:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c1e:	01 00 00 
+  802c21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c25:	83 e0 01             	and    $0x1,%eax
+  802c28:	48 85 c0             	test   %rax,%rax
+  802c2b:	75 07                	jne    802c34 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802c2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c32:	eb 10                	jmp    802c44 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802c34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c3c:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c44:	c9                   	leave
+  802c45:	c3                   	ret
+
+0000000000802c46 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	48 83 ec 30          	sub    $0x30,%rsp
+  802c4e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c52:	89 f0                	mov    %esi,%eax
+  802c54:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802c57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c5b:	48 89 c7             	mov    %rax,%rdi
+  802c5e:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+  802c6a:	89 c2                	mov    %eax,%edx
+  802c6c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c70:	48 89 c6             	mov    %rax,%rsi
+  802c73:	89 d7                	mov    %edx,%edi
+  802c75:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+  802c81:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c84:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c88:	78 0a                	js     802c94 <fd_close+0x4e>
+  802c8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c8e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802c92:	74 12                	je     802ca6 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802c94:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802c98:	74 05                	je     802c9f <fd_close+0x59>
+  802c9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9d:	eb 70                	jmp    802d0f <fd_close+0xc9>
+  802c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca4:	eb 69                	jmp    802d0f <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ca6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802caa:	8b 00                	mov    (%rax),%eax
+  802cac:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802cb0:	48 89 d6             	mov    %rdx,%rsi
+  802cb3:	89 c7                	mov    %eax,%edi
+  802cb5:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  802cbc:	00 00 00 
+  802cbf:	ff d0                	call   *%rax
+  802cc1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cc8:	78 2a                	js     802cf4 <fd_close+0xae>
+    if (dev->dev_close)
+  802cca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cce:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802cd2:	48 85 c0             	test   %rax,%rax
+  802cd5:	74 16                	je     802ced <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802cd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cdb:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802cdf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ce3:	48 89 c7             	mov    %rax,%rdi
+  802ce6:	ff d2                	call   *%rdx
+  802ce8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ceb:	eb 07                	jmp    802cf4 <fd_close+0xae>
+    else
+      r = 0;
+  802ced:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802cf4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cf8:	48 89 c6             	mov    %rax,%rsi
+  802cfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d00:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  return r;
+  802d0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d0f:	c9                   	leave
+  802d10:	c3                   	ret
+
+0000000000802d11 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802d11:	55                   	push   %rbp
+  802d12:	48 89 e5             	mov    %rsp,%rbp
+  802d15:	48 83 ec 20          	sub    $0x20,%rsp
+  802d19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d1c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802d20:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d27:	eb 3f                	jmp    802d68 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802d29:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802d30:	00 00 00 
+  802d33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d36:	48 98                	cltq
+  802d38:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d3c:	8b 00                	mov    (%rax),%eax
+  802d3e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802d41:	75 21                	jne    802d64 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802d43:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802d4a:	00 00 00 
+  802d4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d50:	48 98                	cltq
+  802d52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d5a:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d62:	eb 7f                	jmp    802de3 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802d64:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d68:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  802d6f:	00 00 00 
+  802d72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d75:	48 98                	cltq
+  802d77:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d7b:	48 85 c0             	test   %rax,%rax
+  802d7e:	75 a9                	jne    802d29 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d80:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d87:	00 00 00 
+  802d8a:	8b 40 04             	mov    0x4(%rax),%eax
+  802d8d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d92:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d99:	00 00 00 
+  802d9c:	48 98                	cltq
+  802d9e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802da5:	48 01 d0             	add    %rdx,%rax
+  802da8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802dae:	8b 00                	mov    (%rax),%eax
+  802db0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802db3:	89 c6                	mov    %eax,%esi
+  802db5:	48 b8 98 59 80 00 00 	movabs $0x805998,%rax
+  802dbc:	00 00 00 
+  802dbf:	48 89 c7             	mov    %rax,%rdi
+  802dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc7:	48 b9 db 05 80 00 00 	movabs $0x8005db,%rcx
+  802dce:	00 00 00 
+  802dd1:	ff d1                	call   *%rcx
+  *dev = 0;
+  802dd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dd7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802dde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802de3:	c9                   	leave
+  802de4:	c3                   	ret
+
+0000000000802de5 <close>:
+
+int
+close(int fdnum) {
+  802de5:	55                   	push   %rbp
+  802de6:	48 89 e5             	mov    %rsp,%rbp
+  802de9:	48 83 ec 20          	sub    $0x20,%rsp
+  802ded:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802df0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802df4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802df7:	48 89 d6             	mov    %rdx,%rsi
+  802dfa:	89 c7                	mov    %eax,%edi
+  802dfc:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  802e03:	00 00 00 
+  802e06:	ff d0                	call   *%rax
+  802e08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e0f:	79 05                	jns    802e16 <close+0x31>
+    return r;
+  802e11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e14:	eb 18                	jmp    802e2e <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802e16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1a:	be 01 00 00 00       	mov    $0x1,%esi
+  802e1f:	48 89 c7             	mov    %rax,%rdi
+  802e22:	48 b8 46 2c 80 00 00 	movabs $0x802c46,%rax
+  802e29:	00 00 00 
+  802e2c:	ff d0                	call   *%rax
+}
+  802e2e:	c9                   	leave
+  802e2f:	c3                   	ret
+
+0000000000802e30 <close_all>:
+
+void
+close_all(void) {
+  802e30:	55                   	push   %rbp
+  802e31:	48 89 e5             	mov    %rsp,%rbp
+  802e34:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802e38:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e3f:	eb 15                	jmp    802e56 <close_all+0x26>
+    close(i);
+  802e41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e44:	89 c7                	mov    %eax,%edi
+  802e46:	48 b8 e5 2d 80 00 00 	movabs $0x802de5,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802e52:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802e56:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802e5a:	7e e5                	jle    802e41 <close_all+0x11>
+}
+  802e5c:	90                   	nop
+  802e5d:	90                   	nop
+  802e5e:	c9                   	leave
+  802e5f:	c3                   	ret
+
+0000000000802e60 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802e60:	55                   	push   %rbp
+  802e61:	48 89 e5             	mov    %rsp,%rbp
+  802e64:	48 83 ec 40          	sub    $0x40,%rsp
+  802e68:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e6b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e6e:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e72:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e75:	48 89 d6             	mov    %rdx,%rsi
+  802e78:	89 c7                	mov    %eax,%edi
+  802e7a:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  802e81:	00 00 00 
+  802e84:	ff d0                	call   *%rax
+  802e86:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e89:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e8d:	79 08                	jns    802e97 <dup+0x37>
+    return r;
+  802e8f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e92:	e9 33 02 00 00       	jmp    8030ca <dup+0x26a>
+  close(newfdnum);
+  802e97:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e9a:	89 c7                	mov    %eax,%edi
+  802e9c:	48 b8 e5 2d 80 00 00 	movabs $0x802de5,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802ea8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802eab:	c1 e0 0c             	shl    $0xc,%eax
+  802eae:	48 98                	cltq
+  802eb0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802eb5:	48 01 d0             	add    %rdx,%rax
+  802eb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802ebc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ec0:	48 89 c7             	mov    %rax,%rdi
+  802ec3:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802ed3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed7:	48 89 c7             	mov    %rax,%rdi
+  802eda:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+  802ee6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802eea:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802ef1:	00 
+  802ef2:	e9 19 01 00 00       	jmp    803010 <dup+0x1b0>
+    off -= PGSIZE;
+  802ef7:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802efe:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802eff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f07:	48 01 d0             	add    %rdx,%rax
+  802f0a:	48 c1 e8 27          	shr    $0x27,%rax
+  802f0e:	48 89 c2             	mov    %rax,%rdx
+  802f11:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f18:	01 00 00 
+  802f1b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f1f:	83 e0 01             	and    $0x1,%eax
+  802f22:	48 85 c0             	test   %rax,%rax
+  802f25:	0f 84 e5 00 00 00    	je     803010 <dup+0x1b0>
+  802f2b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f33:	48 01 d0             	add    %rdx,%rax
+  802f36:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f3a:	48 89 c2             	mov    %rax,%rdx
+  802f3d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f44:	01 00 00 
+  802f47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f4b:	83 e0 01             	and    $0x1,%eax
+  802f4e:	48 85 c0             	test   %rax,%rax
+  802f51:	0f 84 b9 00 00 00    	je     803010 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f57:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f5f:	48 01 d0             	add    %rdx,%rax
+  802f62:	48 c1 e8 15          	shr    $0x15,%rax
+  802f66:	48 89 c2             	mov    %rax,%rdx
+  802f69:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f70:	01 00 00 
+  802f73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f77:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f7a:	48 85 c0             	test   %rax,%rax
+  802f7d:	0f 84 8d 00 00 00    	je     803010 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f8b:	48 01 d0             	add    %rdx,%rax
+  802f8e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f92:	48 89 c2             	mov    %rax,%rdx
+  802f95:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f9c:	01 00 00 
+  802f9f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa3:	83 e0 01             	and    $0x1,%eax
+  802fa6:	48 85 c0             	test   %rax,%rax
+  802fa9:	74 65                	je     803010 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802fab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802faf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb3:	48 01 d0             	add    %rdx,%rax
+  802fb6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fba:	48 89 c2             	mov    %rax,%rdx
+  802fbd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fc4:	01 00 00 
+  802fc7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fcb:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fd0:	89 c6                	mov    %eax,%esi
+  802fd2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fda:	48 01 c2             	add    %rax,%rdx
+  802fdd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802fe1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fe5:	48 01 c8             	add    %rcx,%rax
+  802fe8:	41 89 f0             	mov    %esi,%r8d
+  802feb:	48 89 d1             	mov    %rdx,%rcx
+  802fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff3:	48 89 c6             	mov    %rax,%rsi
+  802ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffb:	48 b8 b1 23 80 00 00 	movabs $0x8023b1,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+  803007:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80300a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80300e:	78 60                	js     803070 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803010:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803015:	0f 85 dc fe ff ff    	jne    802ef7 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80301b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80301f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803023:	48 89 c2             	mov    %rax,%rdx
+  803026:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80302d:	01 00 00 
+  803030:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803034:	25 07 0e 00 00       	and    $0xe07,%eax
+  803039:	89 c1                	mov    %eax,%ecx
+  80303b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80303f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803043:	41 89 c8             	mov    %ecx,%r8d
+  803046:	48 89 d1             	mov    %rdx,%rcx
+  803049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304e:	48 89 c6             	mov    %rax,%rsi
+  803051:	bf 00 00 00 00       	mov    $0x0,%edi
+  803056:	48 b8 b1 23 80 00 00 	movabs $0x8023b1,%rax
+  80305d:	00 00 00 
+  803060:	ff d0                	call   *%rax
+  803062:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803065:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803069:	78 08                	js     803073 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80306b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80306e:	eb 5a                	jmp    8030ca <dup+0x26a>
+        goto err;
+  803070:	90                   	nop
+  803071:	eb 01                	jmp    803074 <dup+0x214>
+    goto err;
+  803073:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803078:	48 89 c6             	mov    %rax,%rsi
+  80307b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803080:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  803087:	00 00 00 
+  80308a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80308c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803093:	00 
+  803094:	eb 27                	jmp    8030bd <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803096:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80309a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309e:	48 01 d0             	add    %rdx,%rax
+  8030a1:	48 89 c6             	mov    %rax,%rsi
+  8030a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a9:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  8030b0:	00 00 00 
+  8030b3:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8030b5:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8030bc:	00 
+  8030bd:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8030c4:	00 
+  8030c5:	76 cf                	jbe    803096 <dup+0x236>
+  return r;
+  8030c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030ca:	c9                   	leave
+  8030cb:	c3                   	ret
+
+00000000008030cc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030cc:	55                   	push   %rbp
+  8030cd:	48 89 e5             	mov    %rsp,%rbp
+  8030d0:	48 83 ec 40          	sub    $0x40,%rsp
+  8030d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030d7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030df:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030e6:	48 89 d6             	mov    %rdx,%rsi
+  8030e9:	89 c7                	mov    %eax,%edi
+  8030eb:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+  8030f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030fe:	78 24                	js     803124 <read+0x58>
+  803100:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803104:	8b 00                	mov    (%rax),%eax
+  803106:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80310a:	48 89 d6             	mov    %rdx,%rsi
+  80310d:	89 c7                	mov    %eax,%edi
+  80310f:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+  80311b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80311e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803122:	79 0a                	jns    80312e <read+0x62>
+    return r;
+  803124:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803127:	48 98                	cltq
+  803129:	e9 9e 00 00 00       	jmp    8031cc <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80312e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803132:	8b 40 08             	mov    0x8(%rax),%eax
+  803135:	83 e0 03             	and    $0x3,%eax
+  803138:	83 f8 01             	cmp    $0x1,%eax
+  80313b:	75 5c                	jne    803199 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80313d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803144:	00 00 00 
+  803147:	8b 40 04             	mov    0x4(%rax),%eax
+  80314a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80314f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803156:	00 00 00 
+  803159:	48 98                	cltq
+  80315b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803162:	48 01 d0             	add    %rdx,%rax
+  803165:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80316b:	8b 00                	mov    (%rax),%eax
+  80316d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803170:	89 c6                	mov    %eax,%esi
+  803172:	48 b8 b7 59 80 00 00 	movabs $0x8059b7,%rax
+  803179:	00 00 00 
+  80317c:	48 89 c7             	mov    %rax,%rdi
+  80317f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803184:	48 b9 db 05 80 00 00 	movabs $0x8005db,%rcx
+  80318b:	00 00 00 
+  80318e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803190:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803197:	eb 33                	jmp    8031cc <read+0x100>
+  }
+  if (!dev->dev_read)
+  803199:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80319d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8031a1:	48 85 c0             	test   %rax,%rax
+  8031a4:	75 09                	jne    8031af <read+0xe3>
+    return -E_NOT_SUPP;
+  8031a6:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8031ad:	eb 1d                	jmp    8031cc <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8031af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8031b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031bf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031c3:	48 89 ce             	mov    %rcx,%rsi
+  8031c6:	48 89 c7             	mov    %rax,%rdi
+  8031c9:	41 ff d0             	call   *%r8
+}
+  8031cc:	c9                   	leave
+  8031cd:	c3                   	ret
+
+00000000008031ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031ce:	55                   	push   %rbp
+  8031cf:	48 89 e5             	mov    %rsp,%rbp
+  8031d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8031d6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8031dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8031e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8031e8:	eb 49                	jmp    803233 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8031ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031ed:	48 98                	cltq
+  8031ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031f3:	48 29 c2             	sub    %rax,%rdx
+  8031f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031f9:	48 63 c8             	movslq %eax,%rcx
+  8031fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803200:	48 01 c1             	add    %rax,%rcx
+  803203:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803206:	48 89 ce             	mov    %rcx,%rsi
+  803209:	89 c7                	mov    %eax,%edi
+  80320b:	48 b8 cc 30 80 00 00 	movabs $0x8030cc,%rax
+  803212:	00 00 00 
+  803215:	ff d0                	call   *%rax
+  803217:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80321a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80321e:	79 07                	jns    803227 <readn+0x59>
+      return m;
+  803220:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803223:	48 98                	cltq
+  803225:	eb 1f                	jmp    803246 <readn+0x78>
+    if (m == 0)
+  803227:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80322b:	74 13                	je     803240 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80322d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803230:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803233:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803236:	48 98                	cltq
+  803238:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80323c:	72 ac                	jb     8031ea <readn+0x1c>
+  80323e:	eb 01                	jmp    803241 <readn+0x73>
+      break;
+  803240:	90                   	nop
+  }
+  return tot;
+  803241:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803244:	48 98                	cltq
+}
+  803246:	c9                   	leave
+  803247:	c3                   	ret
+
+0000000000803248 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803248:	55                   	push   %rbp
+  803249:	48 89 e5             	mov    %rsp,%rbp
+  80324c:	48 83 ec 40          	sub    $0x40,%rsp
+  803250:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803253:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803257:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80325b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80325f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803262:	48 89 d6             	mov    %rdx,%rsi
+  803265:	89 c7                	mov    %eax,%edi
+  803267:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  80326e:	00 00 00 
+  803271:	ff d0                	call   *%rax
+  803273:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803276:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80327a:	78 24                	js     8032a0 <write+0x58>
+  80327c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803280:	8b 00                	mov    (%rax),%eax
+  803282:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803286:	48 89 d6             	mov    %rdx,%rsi
+  803289:	89 c7                	mov    %eax,%edi
+  80328b:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+  803297:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80329a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80329e:	79 0a                	jns    8032aa <write+0x62>
+    return r;
+  8032a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032a3:	48 98                	cltq
+  8032a5:	e9 9d 00 00 00       	jmp    803347 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032ae:	8b 40 08             	mov    0x8(%rax),%eax
+  8032b1:	83 e0 03             	and    $0x3,%eax
+  8032b4:	85 c0                	test   %eax,%eax
+  8032b6:	75 5c                	jne    803314 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032b8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8032bf:	00 00 00 
+  8032c2:	8b 40 04             	mov    0x4(%rax),%eax
+  8032c5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032ca:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032d1:	00 00 00 
+  8032d4:	48 98                	cltq
+  8032d6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032dd:	48 01 d0             	add    %rdx,%rax
+  8032e0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032e6:	8b 00                	mov    (%rax),%eax
+  8032e8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8032eb:	89 c6                	mov    %eax,%esi
+  8032ed:	48 b8 d3 59 80 00 00 	movabs $0x8059d3,%rax
+  8032f4:	00 00 00 
+  8032f7:	48 89 c7             	mov    %rax,%rdi
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ff:	48 b9 db 05 80 00 00 	movabs $0x8005db,%rcx
+  803306:	00 00 00 
+  803309:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80330b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803312:	eb 33                	jmp    803347 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803314:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803318:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80331c:	48 85 c0             	test   %rax,%rax
+  80331f:	75 09                	jne    80332a <write+0xe2>
+    return -E_NOT_SUPP;
+  803321:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803328:	eb 1d                	jmp    803347 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80332a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80332e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803332:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803336:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80333a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80333e:	48 89 ce             	mov    %rcx,%rsi
+  803341:	48 89 c7             	mov    %rax,%rdi
+  803344:	41 ff d0             	call   *%r8
+}
+  803347:	c9                   	leave
+  803348:	c3                   	ret
+
+0000000000803349 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803349:	55                   	push   %rbp
+  80334a:	48 89 e5             	mov    %rsp,%rbp
+  80334d:	48 83 ec 18          	sub    $0x18,%rsp
+  803351:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803354:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803357:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80335b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80335e:	48 89 d6             	mov    %rdx,%rsi
+  803361:	89 c7                	mov    %eax,%edi
+  803363:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  80336a:	00 00 00 
+  80336d:	ff d0                	call   *%rax
+  80336f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803372:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803376:	79 05                	jns    80337d <seek+0x34>
+    return r;
+  803378:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80337b:	eb 0f                	jmp    80338c <seek+0x43>
+  fd->fd_offset = offset;
+  80337d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803381:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803384:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80338c:	c9                   	leave
+  80338d:	c3                   	ret
+
+000000000080338e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80338e:	55                   	push   %rbp
+  80338f:	48 89 e5             	mov    %rsp,%rbp
+  803392:	48 83 ec 30          	sub    $0x30,%rsp
+  803396:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803399:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80339c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8033a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033a3:	48 89 d6             	mov    %rdx,%rsi
+  8033a6:	89 c7                	mov    %eax,%edi
+  8033a8:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  8033af:	00 00 00 
+  8033b2:	ff d0                	call   *%rax
+  8033b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033bb:	78 24                	js     8033e1 <ftruncate+0x53>
+  8033bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033c1:	8b 00                	mov    (%rax),%eax
+  8033c3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033c7:	48 89 d6             	mov    %rdx,%rsi
+  8033ca:	89 c7                	mov    %eax,%edi
+  8033cc:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  8033d3:	00 00 00 
+  8033d6:	ff d0                	call   *%rax
+  8033d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033df:	79 08                	jns    8033e9 <ftruncate+0x5b>
+    return r;
+  8033e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033e4:	e9 92 00 00 00       	jmp    80347b <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033ed:	8b 40 08             	mov    0x8(%rax),%eax
+  8033f0:	83 e0 03             	and    $0x3,%eax
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	75 5a                	jne    803451 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8033f7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033fe:	00 00 00 
+  803401:	8b 40 04             	mov    0x4(%rax),%eax
+  803404:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803409:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803410:	00 00 00 
+  803413:	48 98                	cltq
+  803415:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80341c:	48 01 d0             	add    %rdx,%rax
+  80341f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803425:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803427:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80342a:	89 c6                	mov    %eax,%esi
+  80342c:	48 b8 f0 59 80 00 00 	movabs $0x8059f0,%rax
+  803433:	00 00 00 
+  803436:	48 89 c7             	mov    %rax,%rdi
+  803439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343e:	48 b9 db 05 80 00 00 	movabs $0x8005db,%rcx
+  803445:	00 00 00 
+  803448:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80344a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80344f:	eb 2a                	jmp    80347b <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803451:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803455:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803459:	48 85 c0             	test   %rax,%rax
+  80345c:	75 07                	jne    803465 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80345e:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803463:	eb 16                	jmp    80347b <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803469:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80346d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803471:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803474:	89 d6                	mov    %edx,%esi
+  803476:	48 89 c7             	mov    %rax,%rdi
+  803479:	ff d1                	call   *%rcx
+}
+  80347b:	c9                   	leave
+  80347c:	c3                   	ret
+
+000000000080347d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80347d:	55                   	push   %rbp
+  80347e:	48 89 e5             	mov    %rsp,%rbp
+  803481:	48 83 ec 30          	sub    $0x30,%rsp
+  803485:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803488:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80348c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803490:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803493:	48 89 d6             	mov    %rdx,%rsi
+  803496:	89 c7                	mov    %eax,%edi
+  803498:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  80349f:	00 00 00 
+  8034a2:	ff d0                	call   *%rax
+  8034a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034ab:	78 24                	js     8034d1 <fstat+0x54>
+  8034ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034b1:	8b 00                	mov    (%rax),%eax
+  8034b3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8034b7:	48 89 d6             	mov    %rdx,%rsi
+  8034ba:	89 c7                	mov    %eax,%edi
+  8034bc:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  8034c3:	00 00 00 
+  8034c6:	ff d0                	call   *%rax
+  8034c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034cf:	79 05                	jns    8034d6 <fstat+0x59>
+    return r;
+  8034d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d4:	eb 5e                	jmp    803534 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8034d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034da:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034de:	48 85 c0             	test   %rax,%rax
+  8034e1:	75 07                	jne    8034ea <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8034e3:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8034e8:	eb 4a                	jmp    803534 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8034ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034ee:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8034f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034f5:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034fc:	00 00 00 
+  stat->st_isdir   = 0;
+  8034ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803503:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80350a:	00 00 00 
+  stat->st_dev     = dev;
+  80350d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803511:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803515:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80351c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803520:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803528:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80352c:	48 89 d6             	mov    %rdx,%rsi
+  80352f:	48 89 c7             	mov    %rax,%rdi
+  803532:	ff d1                	call   *%rcx
+}
+  803534:	c9                   	leave
+  803535:	c3                   	ret
+
+0000000000803536 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803536:	55                   	push   %rbp
+  803537:	48 89 e5             	mov    %rsp,%rbp
+  80353a:	48 83 ec 10          	sub    $0x10,%rsp
+  80353e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803542:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803546:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80354a:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803550:	83 f8 20             	cmp    $0x20,%eax
+  803553:	75 07                	jne    80355c <pollwait_key+0x26>
+    return -E_INVAL;
+  803555:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355a:	eb 5f                	jmp    8035bb <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80355c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803560:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80356a:	48 63 d2             	movslq %edx,%rdx
+  80356d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803571:	48 01 c2             	add    %rax,%rdx
+  803574:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803578:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80357b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80357f:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803585:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803589:	8b 00                	mov    (%rax),%eax
+  80358b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80358f:	48 63 c9             	movslq %ecx,%rcx
+  803592:	48 c1 e1 04          	shl    $0x4,%rcx
+  803596:	48 01 ca             	add    %rcx,%rdx
+  803599:	48 83 c2 08          	add    $0x8,%rdx
+  80359d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80359f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035a3:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8035a9:	8d 50 01             	lea    0x1(%rax),%edx
+  8035ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035b0:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8035b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035bb:	c9                   	leave
+  8035bc:	c3                   	ret
+
+00000000008035bd <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8035bd:	55                   	push   %rbp
+  8035be:	48 89 e5             	mov    %rsp,%rbp
+  8035c1:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8035c8:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8035cf:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8035d5:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8035dc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8035e3:	00 
+  int i, r, ready, ipc = 0;
+  8035e4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8035eb:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8035f2:	00 
+  8035f3:	74 45                	je     80363a <poll+0x7d>
+  8035f5:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8035fc:	ff 
+  8035fd:	74 3b                	je     80363a <poll+0x7d>
+    now      = vsys_clock_ns();
+  8035ff:	48 b8 f8 4a 80 00 00 	movabs $0x804af8,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+  80360b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80360f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803613:	48 f7 d0             	not    %rax
+  803616:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80361d:	73 10                	jae    80362f <poll+0x72>
+  80361f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803623:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80362a:	48 01 d0             	add    %rdx,%rax
+  80362d:	eb 07                	jmp    803636 <poll+0x79>
+  80362f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803636:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80363a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803641:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803648:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80364f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803656:	e9 46 02 00 00       	jmp    8038a1 <poll+0x2e4>
+      fds[i].revents = 0;
+  80365b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80365e:	48 63 d0             	movslq %eax,%rdx
+  803661:	48 89 d0             	mov    %rdx,%rax
+  803664:	48 01 c0             	add    %rax,%rax
+  803667:	48 01 d0             	add    %rdx,%rax
+  80366a:	48 c1 e0 02          	shl    $0x2,%rax
+  80366e:	48 89 c2             	mov    %rax,%rdx
+  803671:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803678:	48 01 d0             	add    %rdx,%rax
+  80367b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803682:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803685:	48 63 d0             	movslq %eax,%rdx
+  803688:	48 89 d0             	mov    %rdx,%rax
+  80368b:	48 01 c0             	add    %rax,%rax
+  80368e:	48 01 d0             	add    %rdx,%rax
+  803691:	48 c1 e0 02          	shl    $0x2,%rax
+  803695:	48 89 c2             	mov    %rax,%rdx
+  803698:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80369f:	48 01 d0             	add    %rdx,%rax
+  8036a2:	8b 00                	mov    (%rax),%eax
+  8036a4:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8036a7:	75 62                	jne    80370b <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8036a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036ac:	48 63 d0             	movslq %eax,%rdx
+  8036af:	48 89 d0             	mov    %rdx,%rax
+  8036b2:	48 01 c0             	add    %rax,%rax
+  8036b5:	48 01 d0             	add    %rdx,%rax
+  8036b8:	48 c1 e0 02          	shl    $0x2,%rax
+  8036bc:	48 89 c2             	mov    %rax,%rdx
+  8036bf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036c6:	48 01 d0             	add    %rdx,%rax
+  8036c9:	8b 40 04             	mov    0x4(%rax),%eax
+  8036cc:	83 e0 01             	and    $0x1,%eax
+  8036cf:	85 c0                	test   %eax,%eax
+  8036d1:	0f 84 9b 01 00 00    	je     803872 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8036d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036da:	48 63 d0             	movslq %eax,%rdx
+  8036dd:	48 89 d0             	mov    %rdx,%rax
+  8036e0:	48 01 c0             	add    %rax,%rax
+  8036e3:	48 01 d0             	add    %rdx,%rax
+  8036e6:	48 c1 e0 02          	shl    $0x2,%rax
+  8036ea:	48 89 c2             	mov    %rax,%rdx
+  8036ed:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036f4:	48 01 c2             	add    %rax,%rdx
+  8036f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036fa:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8036fd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803700:	83 c8 04             	or     $0x4,%eax
+  803703:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803706:	e9 67 01 00 00       	jmp    803872 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80370b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80370e:	48 63 d0             	movslq %eax,%rdx
+  803711:	48 89 d0             	mov    %rdx,%rax
+  803714:	48 01 c0             	add    %rax,%rax
+  803717:	48 01 d0             	add    %rdx,%rax
+  80371a:	48 c1 e0 02          	shl    $0x2,%rax
+  80371e:	48 89 c2             	mov    %rax,%rdx
+  803721:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803728:	48 01 d0             	add    %rdx,%rax
+  80372b:	8b 00                	mov    (%rax),%eax
+  80372d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803734:	48 89 d6             	mov    %rdx,%rsi
+  803737:	89 c7                	mov    %eax,%edi
+  803739:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+  803745:	85 c0                	test   %eax,%eax
+  803747:	78 25                	js     80376e <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803749:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803750:	8b 00                	mov    (%rax),%eax
+  803752:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803759:	48 89 d6             	mov    %rdx,%rsi
+  80375c:	89 c7                	mov    %eax,%edi
+  80375e:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  803765:	00 00 00 
+  803768:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	79 2c                	jns    80379a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80376e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803771:	48 63 d0             	movslq %eax,%rdx
+  803774:	48 89 d0             	mov    %rdx,%rax
+  803777:	48 01 c0             	add    %rax,%rax
+  80377a:	48 01 d0             	add    %rdx,%rax
+  80377d:	48 c1 e0 02          	shl    $0x2,%rax
+  803781:	48 89 c2             	mov    %rax,%rdx
+  803784:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80378b:	48 01 d0             	add    %rdx,%rax
+  80378e:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803795:	e9 d8 00 00 00       	jmp    803872 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80379a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8037a1:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8037a5:	48 85 c0             	test   %rax,%rax
+  8037a8:	74 7d                	je     803827 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8037aa:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8037b1:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8037b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037b8:	48 63 d0             	movslq %eax,%rdx
+  8037bb:	48 89 d0             	mov    %rdx,%rax
+  8037be:	48 01 c0             	add    %rax,%rax
+  8037c1:	48 01 d0             	add    %rdx,%rax
+  8037c4:	48 c1 e0 02          	shl    $0x2,%rax
+  8037c8:	48 89 c2             	mov    %rax,%rdx
+  8037cb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037d2:	48 01 d0             	add    %rdx,%rax
+  8037d5:	8b 48 04             	mov    0x4(%rax),%ecx
+  8037d8:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8037df:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8037e6:	89 ce                	mov    %ecx,%esi
+  8037e8:	48 89 c7             	mov    %rax,%rdi
+  8037eb:	41 ff d0             	call   *%r8
+  8037ee:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8037f1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037f5:	79 08                	jns    8037ff <poll+0x242>
+          return r;
+  8037f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037fa:	e9 45 01 00 00       	jmp    803944 <poll+0x387>
+        fds[i].revents = r;
+  8037ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803802:	48 63 d0             	movslq %eax,%rdx
+  803805:	48 89 d0             	mov    %rdx,%rax
+  803808:	48 01 c0             	add    %rax,%rax
+  80380b:	48 01 d0             	add    %rdx,%rax
+  80380e:	48 c1 e0 02          	shl    $0x2,%rax
+  803812:	48 89 c2             	mov    %rax,%rdx
+  803815:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80381c:	48 01 c2             	add    %rax,%rdx
+  80381f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803822:	89 42 08             	mov    %eax,0x8(%rdx)
+  803825:	eb 4b                	jmp    803872 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803827:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80382a:	48 63 d0             	movslq %eax,%rdx
+  80382d:	48 89 d0             	mov    %rdx,%rax
+  803830:	48 01 c0             	add    %rax,%rax
+  803833:	48 01 d0             	add    %rdx,%rax
+  803836:	48 c1 e0 02          	shl    $0x2,%rax
+  80383a:	48 89 c2             	mov    %rax,%rdx
+  80383d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803844:	48 01 d0             	add    %rdx,%rax
+  803847:	8b 48 04             	mov    0x4(%rax),%ecx
+  80384a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384d:	48 63 d0             	movslq %eax,%rdx
+  803850:	48 89 d0             	mov    %rdx,%rax
+  803853:	48 01 c0             	add    %rax,%rax
+  803856:	48 01 d0             	add    %rdx,%rax
+  803859:	48 c1 e0 02          	shl    $0x2,%rax
+  80385d:	48 89 c2             	mov    %rax,%rdx
+  803860:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803867:	48 01 d0             	add    %rdx,%rax
+  80386a:	83 e1 03             	and    $0x3,%ecx
+  80386d:	89 ca                	mov    %ecx,%edx
+  80386f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803872:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803875:	48 63 d0             	movslq %eax,%rdx
+  803878:	48 89 d0             	mov    %rdx,%rax
+  80387b:	48 01 c0             	add    %rax,%rax
+  80387e:	48 01 d0             	add    %rdx,%rax
+  803881:	48 c1 e0 02          	shl    $0x2,%rax
+  803885:	48 89 c2             	mov    %rax,%rdx
+  803888:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80388f:	48 01 d0             	add    %rdx,%rax
+  803892:	8b 40 08             	mov    0x8(%rax),%eax
+  803895:	85 c0                	test   %eax,%eax
+  803897:	74 04                	je     80389d <poll+0x2e0>
+        ready++;
+  803899:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80389d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8038a1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038a4:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8038aa:	0f 8c ab fd ff ff    	jl     80365b <poll+0x9e>
+    }
+    if (ready)
+  8038b0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8038b4:	74 08                	je     8038be <poll+0x301>
+      return ready;
+  8038b6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8038b9:	e9 86 00 00 00       	jmp    803944 <poll+0x387>
+
+    if (deadline) {
+  8038be:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8038c3:	74 30                	je     8038f5 <poll+0x338>
+      now     = vsys_clock_ns();
+  8038c5:	48 b8 f8 4a 80 00 00 	movabs $0x804af8,%rax
+  8038cc:	00 00 00 
+  8038cf:	ff d0                	call   *%rax
+  8038d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8038d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038d9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8038dd:	73 0a                	jae    8038e9 <poll+0x32c>
+  8038df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038e3:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8038e7:	eb 05                	jmp    8038ee <poll+0x331>
+  8038e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ee:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8038f5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8038f8:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8038fb:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803902:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803909:	48 89 c7             	mov    %rax,%rdi
+  80390c:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+  803918:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80391b:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80391f:	75 07                	jne    803928 <poll+0x36b>
+      return 0;
+  803921:	b8 00 00 00 00       	mov    $0x0,%eax
+  803926:	eb 1c                	jmp    803944 <poll+0x387>
+    if (r < 0)
+  803928:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80392c:	79 05                	jns    803933 <poll+0x376>
+      return r;
+  80392e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803931:	eb 11                	jmp    803944 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803933:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803936:	c1 f8 02             	sar    $0x2,%eax
+  803939:	83 e0 01             	and    $0x1,%eax
+  80393c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80393f:	e9 f6 fc ff ff       	jmp    80363a <poll+0x7d>
+  }
+}
+  803944:	c9                   	leave
+  803945:	c3                   	ret
+
+0000000000803946 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803946:	55                   	push   %rbp
+  803947:	48 89 e5             	mov    %rsp,%rbp
+  80394a:	48 83 ec 20          	sub    $0x20,%rsp
+  80394e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803952:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395a:	be 00 00 00 00       	mov    $0x0,%esi
+  80395f:	48 89 c7             	mov    %rax,%rdi
+  803962:	48 b8 34 3a 80 00 00 	movabs $0x803a34,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+  80396e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803971:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803975:	79 05                	jns    80397c <stat+0x36>
+    return fd;
+  803977:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80397a:	eb 2f                	jmp    8039ab <stat+0x65>
+  r = fstat(fd, stat);
+  80397c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803983:	48 89 d6             	mov    %rdx,%rsi
+  803986:	89 c7                	mov    %eax,%edi
+  803988:	48 b8 7d 34 80 00 00 	movabs $0x80347d,%rax
+  80398f:	00 00 00 
+  803992:	ff d0                	call   *%rax
+  803994:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803997:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80399a:	89 c7                	mov    %eax,%edi
+  80399c:	48 b8 e5 2d 80 00 00 	movabs $0x802de5,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+  return r;
+  8039a8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8039ab:	c9                   	leave
+  8039ac:	c3                   	ret
+
+00000000008039ad <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8039ad:	55                   	push   %rbp
+  8039ae:	48 89 e5             	mov    %rsp,%rbp
+  8039b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8039b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8039b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8039bc:	48 b8 00 90 82 00 00 	movabs $0x829000,%rax
+  8039c3:	00 00 00 
+  8039c6:	8b 00                	mov    (%rax),%eax
+  8039c8:	85 c0                	test   %eax,%eax
+  8039ca:	75 1d                	jne    8039e9 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039cc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039d1:	48 b8 2d 52 80 00 00 	movabs $0x80522d,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	48 ba 00 90 82 00 00 	movabs $0x829000,%rdx
+  8039e4:	00 00 00 
+  8039e7:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8039e9:	48 b8 00 90 82 00 00 	movabs $0x829000,%rax
+  8039f0:	00 00 00 
+  8039f3:	8b 00                	mov    (%rax),%eax
+  8039f5:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8039f8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039fd:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803a04:	00 00 00 
+  803a07:	89 c7                	mov    %eax,%edi
+  803a09:	48 b8 80 51 80 00 00 	movabs $0x805180,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803a15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a1e:	48 89 c6             	mov    %rax,%rsi
+  803a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a26:	48 b8 03 50 80 00 00 	movabs $0x805003,%rax
+  803a2d:	00 00 00 
+  803a30:	ff d0                	call   *%rax
+}
+  803a32:	c9                   	leave
+  803a33:	c3                   	ret
+
+0000000000803a34 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803a34:	55                   	push   %rbp
+  803a35:	48 89 e5             	mov    %rsp,%rbp
+  803a38:	48 83 ec 20          	sub    $0x20,%rsp
+  803a3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a40:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803a43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a47:	48 89 c7             	mov    %rax,%rdi
+  803a4a:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803a51:	00 00 00 
+  803a54:	ff d0                	call   *%rax
+  803a56:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a5b:	7e 0a                	jle    803a67 <open+0x33>
+    return -E_BAD_PATH;
+  803a5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a62:	e9 a8 00 00 00       	jmp    803b0f <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a67:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a6b:	48 89 c7             	mov    %rax,%rdi
+  803a6e:	48 b8 8e 2a 80 00 00 	movabs $0x802a8e,%rax
+  803a75:	00 00 00 
+  803a78:	ff d0                	call   *%rax
+  803a7a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a7d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a81:	79 08                	jns    803a8b <open+0x57>
+    return r;
+  803a83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a86:	e9 84 00 00 00       	jmp    803b0f <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803a8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a8f:	48 89 c6             	mov    %rax,%rsi
+  803a92:	48 b8 00 80 82 00 00 	movabs $0x828000,%rax
+  803a99:	00 00 00 
+  803a9c:	48 89 c7             	mov    %rax,%rdi
+  803a9f:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803aab:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803ab2:	00 00 00 
+  803ab5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ab8:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803abe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ac2:	48 89 c6             	mov    %rax,%rsi
+  803ac5:	bf 01 00 00 00       	mov    $0x1,%edi
+  803aca:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+  803ad6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ad9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803add:	79 1d                	jns    803afc <open+0xc8>
+    fd_close(fd, 0);
+  803adf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ae3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae8:	48 89 c7             	mov    %rax,%rdi
+  803aeb:	48 b8 46 2c 80 00 00 	movabs $0x802c46,%rax
+  803af2:	00 00 00 
+  803af5:	ff d0                	call   *%rax
+    return r;
+  803af7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803afa:	eb 13                	jmp    803b0f <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803afc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b00:	48 89 c7             	mov    %rax,%rdi
+  803b03:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  803b0a:	00 00 00 
+  803b0d:	ff d0                	call   *%rax
+}
+  803b0f:	c9                   	leave
+  803b10:	c3                   	ret
+
+0000000000803b11 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803b11:	55                   	push   %rbp
+  803b12:	48 89 e5             	mov    %rsp,%rbp
+  803b15:	48 83 ec 10          	sub    $0x10,%rsp
+  803b19:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b21:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b24:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803b2b:	00 00 00 
+  803b2e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803b30:	be 00 00 00 00       	mov    $0x0,%esi
+  803b35:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b3a:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+}
+  803b46:	c9                   	leave
+  803b47:	c3                   	ret
+
+0000000000803b48 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b48:	55                   	push   %rbp
+  803b49:	48 89 e5             	mov    %rsp,%rbp
+  803b4c:	48 83 ec 30          	sub    $0x30,%rsp
+  803b50:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b54:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b58:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b5c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803b61:	74 07                	je     803b6a <devfile_read+0x22>
+  803b63:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b68:	75 0a                	jne    803b74 <devfile_read+0x2c>
+  return E_INVAL;
+  803b6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b6f:	e9 b4 00 00 00       	jmp    803c28 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b74:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b7b:	00 
+  while (n) {
+  803b7c:	e9 98 00 00 00       	jmp    803c19 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b85:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b88:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803b8f:	00 00 00 
+  803b92:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803b94:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803b9b:	00 00 00 
+  803b9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ba2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803ba6:	be 00 00 00 00       	mov    $0x0,%esi
+  803bab:	bf 03 00 00 00       	mov    $0x3,%edi
+  803bb0:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803bb7:	00 00 00 
+  803bba:	ff d0                	call   *%rax
+  803bbc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803bbf:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803bc3:	7f 13                	jg     803bd8 <devfile_read+0x90>
+      return res ? res : res0;
+  803bc5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803bc9:	74 07                	je     803bd2 <devfile_read+0x8a>
+  803bcb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bce:	48 98                	cltq
+  803bd0:	eb 56                	jmp    803c28 <devfile_read+0xe0>
+  803bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bd6:	eb 50                	jmp    803c28 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803bd8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bdb:	48 63 d0             	movslq %eax,%rdx
+  803bde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803be2:	48 b9 00 80 82 00 00 	movabs $0x828000,%rcx
+  803be9:	00 00 00 
+  803bec:	48 89 ce             	mov    %rcx,%rsi
+  803bef:	48 89 c7             	mov    %rax,%rdi
+  803bf2:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  803bf9:	00 00 00 
+  803bfc:	ff d0                	call   *%rax
+
+    buf += res;
+  803bfe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c01:	48 98                	cltq
+  803c03:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803c07:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c0a:	48 98                	cltq
+  803c0c:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803c10:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c13:	48 98                	cltq
+  803c15:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803c19:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c1e:	0f 85 5d ff ff ff    	jne    803b81 <devfile_read+0x39>
+  }
+
+  return res0;
+  803c24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803c28:	c9                   	leave
+  803c29:	c3                   	ret
+
+0000000000803c2a <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803c2a:	55                   	push   %rbp
+  803c2b:	48 89 e5             	mov    %rsp,%rbp
+  803c2e:	48 83 ec 50          	sub    $0x50,%rsp
+  803c32:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c36:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c3a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803c3e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c43:	74 07                	je     803c4c <devfile_write+0x22>
+  803c45:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c4a:	75 0a                	jne    803c56 <devfile_write+0x2c>
+  return E_INVAL;
+  803c4c:	b8 03 00 00 00       	mov    $0x3,%eax
+  803c51:	e9 c9 00 00 00       	jmp    803d1f <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803c56:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c5d:	00 
+
+  while (n) {
+  803c5e:	e9 ad 00 00 00       	jmp    803d10 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803c63:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c67:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c6b:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c72:	00 
+  803c73:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c7b:	48 39 c2             	cmp    %rax,%rdx
+  803c7e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803c82:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803c86:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c8e:	48 89 c6             	mov    %rax,%rsi
+  803c91:	48 b8 10 80 82 00 00 	movabs $0x828010,%rax
+  803c98:	00 00 00 
+  803c9b:	48 89 c7             	mov    %rax,%rdi
+  803c9e:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803caa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cae:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cb1:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803cb8:	00 00 00 
+  803cbb:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803cbd:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803cc4:	00 00 00 
+  803cc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ccb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  803cd4:	bf 04 00 00 00       	mov    $0x4,%edi
+  803cd9:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803ce0:	00 00 00 
+  803ce3:	ff d0                	call   *%rax
+  803ce5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803ce8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803cec:	79 07                	jns    803cf5 <devfile_write+0xcb>
+      return res;
+  803cee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cf1:	48 98                	cltq
+  803cf3:	eb 2a                	jmp    803d1f <devfile_write+0xf5>
+
+    buf += res;
+  803cf5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cf8:	48 98                	cltq
+  803cfa:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803cfe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d01:	48 98                	cltq
+  803d03:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803d07:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d0a:	48 98                	cltq
+  803d0c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803d10:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803d15:	0f 85 48 ff ff ff    	jne    803c63 <devfile_write+0x39>
+  }
+
+  return res0;
+  803d1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803d1f:	c9                   	leave
+  803d20:	c3                   	ret
+
+0000000000803d21 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803d21:	55                   	push   %rbp
+  803d22:	48 89 e5             	mov    %rsp,%rbp
+  803d25:	48 83 ec 20          	sub    $0x20,%rsp
+  803d29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d2d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d35:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d38:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803d3f:	00 00 00 
+  803d42:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d44:	be 00 00 00 00       	mov    $0x0,%esi
+  803d49:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d4e:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803d55:	00 00 00 
+  803d58:	ff d0                	call   *%rax
+  803d5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d61:	79 05                	jns    803d68 <devfile_stat+0x47>
+    return r;
+  803d63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d66:	eb 59                	jmp    803dc1 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d6c:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803d73:	00 00 00 
+  803d76:	48 89 d6             	mov    %rdx,%rsi
+  803d79:	48 89 c7             	mov    %rax,%rdi
+  803d7c:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  803d83:	00 00 00 
+  803d86:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803d88:	48 b8 00 80 82 00 00 	movabs $0x828000,%rax
+  803d8f:	00 00 00 
+  803d92:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803d98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d9c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803da2:	48 b8 00 80 82 00 00 	movabs $0x828000,%rax
+  803da9:	00 00 00 
+  803dac:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803db2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803db6:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dc1:	c9                   	leave
+  803dc2:	c3                   	ret
+
+0000000000803dc3 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803dc3:	55                   	push   %rbp
+  803dc4:	48 89 e5             	mov    %rsp,%rbp
+  803dc7:	48 83 ec 10          	sub    $0x10,%rsp
+  803dcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dcf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803dd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dd6:	8b 40 0c             	mov    0xc(%rax),%eax
+  803dd9:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803de0:	00 00 00 
+  803de3:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803de5:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803dec:	00 00 00 
+  803def:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803df2:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803df5:	be 00 00 00 00       	mov    $0x0,%esi
+  803dfa:	bf 02 00 00 00       	mov    $0x2,%edi
+  803dff:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803e06:	00 00 00 
+  803e09:	ff d0                	call   *%rax
+}
+  803e0b:	c9                   	leave
+  803e0c:	c3                   	ret
+
+0000000000803e0d <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803e0d:	55                   	push   %rbp
+  803e0e:	48 89 e5             	mov    %rsp,%rbp
+  803e11:	48 83 ec 18          	sub    $0x18,%rsp
+  803e15:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e19:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803e1c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803e20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e23:	83 e0 03             	and    $0x3,%eax
+}
+  803e26:	c9                   	leave
+  803e27:	c3                   	ret
+
+0000000000803e28 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803e28:	55                   	push   %rbp
+  803e29:	48 89 e5             	mov    %rsp,%rbp
+  803e2c:	48 83 ec 10          	sub    $0x10,%rsp
+  803e30:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803e34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e38:	48 89 c7             	mov    %rax,%rdi
+  803e3b:	48 b8 8a 14 80 00 00 	movabs $0x80148a,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+  803e47:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e4c:	7e 07                	jle    803e55 <remove+0x2d>
+    return -E_BAD_PATH;
+  803e4e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803e53:	eb 36                	jmp    803e8b <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803e55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e59:	48 89 c6             	mov    %rax,%rsi
+  803e5c:	48 b8 00 80 82 00 00 	movabs $0x828000,%rax
+  803e63:	00 00 00 
+  803e66:	48 89 c7             	mov    %rax,%rdi
+  803e69:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e75:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7a:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e7f:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+}
+  803e8b:	c9                   	leave
+  803e8c:	c3                   	ret
+
+0000000000803e8d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803e8d:	55                   	push   %rbp
+  803e8e:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803e91:	be 00 00 00 00       	mov    $0x0,%esi
+  803e96:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e9b:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803ea2:	00 00 00 
+  803ea5:	ff d0                	call   *%rax
+}
+  803ea7:	5d                   	pop    %rbp
+  803ea8:	c3                   	ret
+
+0000000000803ea9 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803ea9:	55                   	push   %rbp
+  803eaa:	48 89 e5             	mov    %rsp,%rbp
+  803ead:	48 83 ec 20          	sub    $0x20,%rsp
+  803eb1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803eb5:	be 00 00 00 00       	mov    $0x0,%esi
+  803eba:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ebf:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+  803ecb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ece:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ed2:	79 05                	jns    803ed9 <fs_stats+0x30>
+    return r;
+  803ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ed7:	eb 2a                	jmp    803f03 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803ed9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803edd:	ba 68 00 00 00       	mov    $0x68,%edx
+  803ee2:	48 b9 00 80 82 00 00 	movabs $0x828000,%rcx
+  803ee9:	00 00 00 
+  803eec:	48 89 ce             	mov    %rcx,%rsi
+  803eef:	48 89 c7             	mov    %rax,%rdi
+  803ef2:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  803ef9:	00 00 00 
+  803efc:	ff d0                	call   *%rax
+  return 0;
+  803efe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f03:	c9                   	leave
+  803f04:	c3                   	ret
+
+0000000000803f05 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803f05:	55                   	push   %rbp
+  803f06:	48 89 e5             	mov    %rsp,%rbp
+  803f09:	48 83 ec 10          	sub    $0x10,%rsp
+  803f0d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803f10:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803f17:	00 00 00 
+  803f1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f1d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803f1f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f24:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803f29:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+}
+  803f35:	c9                   	leave
+  803f36:	c3                   	ret
+
+0000000000803f37 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803f37:	55                   	push   %rbp
+  803f38:	48 89 e5             	mov    %rsp,%rbp
+  803f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  803f3f:	89 f8                	mov    %edi,%eax
+  803f41:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803f44:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803f48:	48 ba 00 80 82 00 00 	movabs $0x828000,%rdx
+  803f4f:	00 00 00 
+  803f52:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803f54:	be 00 00 00 00       	mov    $0x0,%esi
+  803f59:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803f5e:	48 b8 ad 39 80 00 00 	movabs $0x8039ad,%rax
+  803f65:	00 00 00 
+  803f68:	ff d0                	call   *%rax
+}
+  803f6a:	c9                   	leave
+  803f6b:	c3                   	ret
+
+0000000000803f6c <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803f6c:	55                   	push   %rbp
+  803f6d:	48 89 e5             	mov    %rsp,%rbp
+  803f70:	48 83 ec 10          	sub    $0x10,%rsp
+  803f74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f7c:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803f81:	48 89 c7             	mov    %rax,%rdi
+  803f84:	48 b8 92 3f 80 00 00 	movabs $0x803f92,%rax
+  803f8b:	00 00 00 
+  803f8e:	ff d0                	call   *%rax
+}
+  803f90:	c9                   	leave
+  803f91:	c3                   	ret
+
+0000000000803f92 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	48 83 ec 50          	sub    $0x50,%rsp
+  803f9a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803f9e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803fa2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803fa9:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803faa:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803faf:	74 0a                	je     803fbb <pipe_size+0x29>
+  803fb1:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803fb8:	00 
+  803fb9:	76 0a                	jbe    803fc5 <pipe_size+0x33>
+    return -E_INVAL;
+  803fbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fc0:	e9 cc 02 00 00       	jmp    804291 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803fc5:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803fc9:	48 89 c7             	mov    %rax,%rdi
+  803fcc:	48 b8 8e 2a 80 00 00 	movabs $0x802a8e,%rax
+  803fd3:	00 00 00 
+  803fd6:	ff d0                	call   *%rax
+  803fd8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fdb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fdf:	0f 88 a8 02 00 00    	js     80428d <pipe_size+0x2fb>
+  803fe5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fe9:	ba 07 04 00 00       	mov    $0x407,%edx
+  803fee:	48 89 c6             	mov    %rax,%rsi
+  803ff1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff6:	48 b8 59 23 80 00 00 	movabs $0x802359,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+  804002:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804005:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804009:	0f 88 7e 02 00 00    	js     80428d <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80400f:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804013:	48 89 c7             	mov    %rax,%rdi
+  804016:	48 b8 8e 2a 80 00 00 	movabs $0x802a8e,%rax
+  80401d:	00 00 00 
+  804020:	ff d0                	call   *%rax
+  804022:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804025:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804029:	0f 88 43 02 00 00    	js     804272 <pipe_size+0x2e0>
+  80402f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804033:	ba 07 04 00 00       	mov    $0x407,%edx
+  804038:	48 89 c6             	mov    %rax,%rsi
+  80403b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804040:	48 b8 59 23 80 00 00 	movabs $0x802359,%rax
+  804047:	00 00 00 
+  80404a:	ff d0                	call   *%rax
+  80404c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80404f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804053:	0f 88 19 02 00 00    	js     804272 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804059:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405d:	48 89 c7             	mov    %rax,%rdi
+  804060:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  804067:	00 00 00 
+  80406a:	ff d0                	call   *%rax
+  80406c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804070:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804077:	00 
+  804078:	e9 a2 00 00 00       	jmp    80411f <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80407d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804081:	48 c1 e0 0c          	shl    $0xc,%rax
+  804085:	48 89 c2             	mov    %rax,%rdx
+  804088:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80408c:	48 01 d0             	add    %rdx,%rax
+  80408f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804094:	48 89 c6             	mov    %rax,%rsi
+  804097:	bf 00 00 00 00       	mov    $0x0,%edi
+  80409c:	48 b8 59 23 80 00 00 	movabs $0x802359,%rax
+  8040a3:	00 00 00 
+  8040a6:	ff d0                	call   *%rax
+  8040a8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040ab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040af:	0f 88 37 01 00 00    	js     8041ec <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8040b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040b9:	48 89 c7             	mov    %rax,%rdi
+  8040bc:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  8040c3:	00 00 00 
+  8040c6:	ff d0                	call   *%rax
+  8040c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040cc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8040d0:	48 01 c2             	add    %rax,%rdx
+  8040d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8040db:	48 89 c1             	mov    %rax,%rcx
+  8040de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040e2:	48 01 c8             	add    %rcx,%rax
+  8040e5:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8040eb:	48 89 d1             	mov    %rdx,%rcx
+  8040ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040f3:	48 89 c6             	mov    %rax,%rsi
+  8040f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fb:	48 b8 b1 23 80 00 00 	movabs $0x8023b1,%rax
+  804102:	00 00 00 
+  804105:	ff d0                	call   *%rax
+  804107:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80410a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80410e:	79 0a                	jns    80411a <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804110:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804115:	e9 d3 00 00 00       	jmp    8041ed <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80411a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80411f:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804126:	00 
+  804127:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80412b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80412f:	48 01 d0             	add    %rdx,%rax
+  804132:	48 83 c0 1f          	add    $0x1f,%rax
+  804136:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80413a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80413e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804143:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804147:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80414b:	48 29 d0             	sub    %rdx,%rax
+  80414e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804152:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804156:	0f 82 21 ff ff ff    	jb     80407d <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80415c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804160:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804164:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804168:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80416c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804170:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804174:	48 ba a0 60 80 00 00 	movabs $0x8060a0,%rdx
+  80417b:	00 00 00 
+  80417e:	8b 12                	mov    (%rdx),%edx
+  804180:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804182:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804186:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80418d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804191:	48 ba a0 60 80 00 00 	movabs $0x8060a0,%rdx
+  804198:	00 00 00 
+  80419b:	8b 12                	mov    (%rdx),%edx
+  80419d:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80419f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8041aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041ae:	48 89 c7             	mov    %rax,%rdi
+  8041b1:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  8041b8:	00 00 00 
+  8041bb:	ff d0                	call   *%rax
+  8041bd:	89 c2                	mov    %eax,%edx
+  8041bf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041c3:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8041c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041c9:	48 89 c7             	mov    %rax,%rdi
+  8041cc:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8041dc:	48 83 c2 04          	add    $0x4,%rdx
+  8041e0:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8041e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e7:	e9 a5 00 00 00       	jmp    804291 <pipe_size+0x2ff>
+      goto err2;
+  8041ec:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8041ed:	eb 58                	jmp    804247 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8041ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041f3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8041f7:	48 89 c2             	mov    %rax,%rdx
+  8041fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041fe:	48 01 d0             	add    %rdx,%rax
+  804201:	48 89 c6             	mov    %rax,%rsi
+  804204:	bf 00 00 00 00       	mov    $0x0,%edi
+  804209:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804210:	00 00 00 
+  804213:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804215:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804219:	48 89 c7             	mov    %rax,%rdi
+  80421c:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  804223:	00 00 00 
+  804226:	ff d0                	call   *%rax
+  804228:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80422c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804230:	48 01 d0             	add    %rdx,%rax
+  804233:	48 89 c6             	mov    %rax,%rsi
+  804236:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423b:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804242:	00 00 00 
+  804245:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804247:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80424b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80424f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804253:	48 85 c0             	test   %rax,%rax
+  804256:	75 97                	jne    8041ef <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804258:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80425c:	48 89 c6             	mov    %rax,%rsi
+  80425f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804264:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  80426b:	00 00 00 
+  80426e:	ff d0                	call   *%rax
+  804270:	eb 01                	jmp    804273 <pipe_size+0x2e1>
+    goto err1;
+  804272:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804273:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804277:	48 89 c6             	mov    %rax,%rsi
+  80427a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80427f:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804286:	00 00 00 
+  804289:	ff d0                	call   *%rax
+  80428b:	eb 01                	jmp    80428e <pipe_size+0x2fc>
+    goto err;
+  80428d:	90                   	nop
+err:
+  return r;
+  80428e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804291:	c9                   	leave
+  804292:	c3                   	ret
+
+0000000000804293 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804293:	55                   	push   %rbp
+  804294:	48 89 e5             	mov    %rsp,%rbp
+  804297:	53                   	push   %rbx
+  804298:	48 83 ec 28          	sub    $0x28,%rsp
+  80429c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8042a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8042a4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042ab:	00 00 00 
+  8042ae:	8b 40 04             	mov    0x4(%rax),%eax
+  8042b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042b6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8042bd:	00 00 00 
+  8042c0:	48 98                	cltq
+  8042c2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8042c9:	48 01 d0             	add    %rdx,%rax
+  8042cc:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8042d2:	8b 00                	mov    (%rax),%eax
+  8042d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8042d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042db:	48 89 c7             	mov    %rax,%rdi
+  8042de:	48 b8 9e 52 80 00 00 	movabs $0x80529e,%rax
+  8042e5:	00 00 00 
+  8042e8:	ff d0                	call   *%rax
+  8042ea:	89 c3                	mov    %eax,%ebx
+  8042ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042f0:	48 89 c7             	mov    %rax,%rdi
+  8042f3:	48 b8 9e 52 80 00 00 	movabs $0x80529e,%rax
+  8042fa:	00 00 00 
+  8042fd:	ff d0                	call   *%rax
+  8042ff:	39 c3                	cmp    %eax,%ebx
+  804301:	0f 94 c0             	sete   %al
+  804304:	0f b6 c0             	movzbl %al,%eax
+  804307:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80430a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804311:	00 00 00 
+  804314:	8b 40 04             	mov    0x4(%rax),%eax
+  804317:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80431c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804323:	00 00 00 
+  804326:	48 98                	cltq
+  804328:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80432f:	48 01 d0             	add    %rdx,%rax
+  804332:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804338:	8b 00                	mov    (%rax),%eax
+  80433a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80433d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804340:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804343:	75 05                	jne    80434a <_pipeisclosed+0xb7>
+      return ret;
+  804345:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804348:	eb 68                	jmp    8043b2 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80434a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80434d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804350:	0f 84 4e ff ff ff    	je     8042a4 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804356:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80435d:	00 00 00 
+  804360:	8b 40 04             	mov    0x4(%rax),%eax
+  804363:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804368:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80436f:	00 00 00 
+  804372:	48 98                	cltq
+  804374:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80437b:	48 01 d0             	add    %rdx,%rax
+  80437e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804384:	8b 10                	mov    (%rax),%edx
+  804386:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804389:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80438c:	89 c6                	mov    %eax,%esi
+  80438e:	48 b8 20 5a 80 00 00 	movabs $0x805a20,%rax
+  804395:	00 00 00 
+  804398:	48 89 c7             	mov    %rax,%rdi
+  80439b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a0:	49 b8 db 05 80 00 00 	movabs $0x8005db,%r8
+  8043a7:	00 00 00 
+  8043aa:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8043ad:	e9 f2 fe ff ff       	jmp    8042a4 <_pipeisclosed+0x11>
+  }
+}
+  8043b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043b6:	c9                   	leave
+  8043b7:	c3                   	ret
+
+00000000008043b8 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8043b8:	55                   	push   %rbp
+  8043b9:	48 89 e5             	mov    %rsp,%rbp
+  8043bc:	48 83 ec 30          	sub    $0x30,%rsp
+  8043c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8043c3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8043c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043ca:	48 89 d6             	mov    %rdx,%rsi
+  8043cd:	89 c7                	mov    %eax,%edi
+  8043cf:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  8043d6:	00 00 00 
+  8043d9:	ff d0                	call   *%rax
+  8043db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043e2:	79 05                	jns    8043e9 <pipeisclosed+0x31>
+    return r;
+  8043e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043e7:	eb 31                	jmp    80441a <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8043e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ed:	48 89 c7             	mov    %rax,%rdi
+  8043f0:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  8043f7:	00 00 00 
+  8043fa:	ff d0                	call   *%rax
+  8043fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804404:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804408:	48 89 d6             	mov    %rdx,%rsi
+  80440b:	48 89 c7             	mov    %rax,%rdi
+  80440e:	48 b8 93 42 80 00 00 	movabs $0x804293,%rax
+  804415:	00 00 00 
+  804418:	ff d0                	call   *%rax
+}
+  80441a:	c9                   	leave
+  80441b:	c3                   	ret
+
+000000000080441c <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80441c:	55                   	push   %rbp
+  80441d:	48 89 e5             	mov    %rsp,%rbp
+  804420:	48 83 ec 10          	sub    $0x10,%rsp
+  804424:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804428:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80442c:	8b 40 18             	mov    0x18(%rax),%eax
+  80442f:	8d 50 01             	lea    0x1(%rax),%edx
+  804432:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804436:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80443d:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804440:	85 c0                	test   %eax,%eax
+  804442:	74 27                	je     80446b <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804448:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80444f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804453:	48 83 c0 18          	add    $0x18,%rax
+  804457:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80445c:	48 89 c7             	mov    %rax,%rdi
+  80445f:	48 b8 54 27 80 00 00 	movabs $0x802754,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+  }
+}
+  80446b:	90                   	nop
+  80446c:	c9                   	leave
+  80446d:	c3                   	ret
+
+000000000080446e <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80446e:	55                   	push   %rbp
+  80446f:	48 89 e5             	mov    %rsp,%rbp
+  804472:	48 83 ec 10          	sub    $0x10,%rsp
+  804476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80447a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80447d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804481:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80448c:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804490:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804493:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80449a:	89 c6                	mov    %eax,%esi
+  80449c:	48 89 cf             	mov    %rcx,%rdi
+  80449f:	48 b8 05 27 80 00 00 	movabs $0x802705,%rax
+  8044a6:	00 00 00 
+  8044a9:	ff d0                	call   *%rax
+}
+  8044ab:	90                   	nop
+  8044ac:	c9                   	leave
+  8044ad:	c3                   	ret
+
+00000000008044ae <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044ae:	55                   	push   %rbp
+  8044af:	48 89 e5             	mov    %rsp,%rbp
+  8044b2:	48 83 ec 70          	sub    $0x70,%rsp
+  8044b6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8044ba:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8044be:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8044c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044c6:	48 89 c7             	mov    %rax,%rdi
+  8044c9:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  8044d0:	00 00 00 
+  8044d3:	ff d0                	call   *%rax
+  8044d5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8044d9:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8044de:	75 0a                	jne    8044ea <devpipe_read+0x3c>
+    return 0;
+  8044e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e5:	e9 63 01 00 00       	jmp    80464d <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8044ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044ee:	8b 40 18             	mov    0x18(%rax),%eax
+  8044f1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8044f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044f8:	48 8b 10             	mov    (%rax),%rdx
+  8044fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804503:	48 39 c2             	cmp    %rax,%rdx
+  804506:	75 42                	jne    80454a <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804508:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80450c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804510:	48 89 d6             	mov    %rdx,%rsi
+  804513:	48 89 c7             	mov    %rax,%rdi
+  804516:	48 b8 93 42 80 00 00 	movabs $0x804293,%rax
+  80451d:	00 00 00 
+  804520:	ff d0                	call   *%rax
+  804522:	85 c0                	test   %eax,%eax
+  804524:	74 0a                	je     804530 <devpipe_read+0x82>
+      return 0;
+  804526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80452b:	e9 1d 01 00 00       	jmp    80464d <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804530:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804533:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804537:	89 d6                	mov    %edx,%esi
+  804539:	48 89 c7             	mov    %rax,%rdi
+  80453c:	48 b8 6e 44 80 00 00 	movabs $0x80446e,%rax
+  804543:	00 00 00 
+  804546:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804548:	eb a0                	jmp    8044ea <devpipe_read+0x3c>
+      break;
+  80454a:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80454b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80454f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804553:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804557:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80455b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80455f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804567:	48 8b 00             	mov    (%rax),%rax
+  80456a:	48 29 c2             	sub    %rax,%rdx
+  80456d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804571:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804575:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804579:	48 39 c2             	cmp    %rax,%rdx
+  80457c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804580:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804588:	48 8b 00             	mov    (%rax),%rax
+  80458b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80458f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804593:	ba 00 00 00 00       	mov    $0x0,%edx
+  804598:	48 f7 f1             	div    %rcx
+  80459b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80459f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8045a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045af:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8045b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045b7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045bf:	48 39 c2             	cmp    %rax,%rdx
+  8045c2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8045c6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8045ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ce:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8045d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045d6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8045da:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045e2:	48 89 ce             	mov    %rcx,%rsi
+  8045e5:	48 89 c7             	mov    %rax,%rdi
+  8045e8:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  8045ef:	00 00 00 
+  8045f2:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8045f4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045f8:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8045fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804600:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804604:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804608:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80460c:	48 01 d1             	add    %rdx,%rcx
+  80460f:	48 89 c2             	mov    %rax,%rdx
+  804612:	48 89 cf             	mov    %rcx,%rdi
+  804615:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  80461c:	00 00 00 
+  80461f:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804625:	48 8b 10             	mov    (%rax),%rdx
+  804628:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80462c:	48 01 c2             	add    %rax,%rdx
+  80462f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804633:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804636:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80463a:	48 89 c7             	mov    %rax,%rdi
+  80463d:	48 b8 1c 44 80 00 00 	movabs $0x80441c,%rax
+  804644:	00 00 00 
+  804647:	ff d0                	call   *%rax
+  return n;
+  804649:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80464d:	c9                   	leave
+  80464e:	c3                   	ret
+
+000000000080464f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80464f:	55                   	push   %rbp
+  804650:	48 89 e5             	mov    %rsp,%rbp
+  804653:	48 83 ec 70          	sub    $0x70,%rsp
+  804657:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80465b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80465f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804663:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804667:	48 89 c7             	mov    %rax,%rdi
+  80466a:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  804671:	00 00 00 
+  804674:	ff d0                	call   *%rax
+  804676:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80467a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80467e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804682:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804689:	00 
+  80468a:	e9 b8 01 00 00       	jmp    804847 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80468f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804693:	8b 40 18             	mov    0x18(%rax),%eax
+  804696:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80469d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8046a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046a5:	48 8b 00             	mov    (%rax),%rax
+  8046a8:	48 29 c2             	sub    %rax,%rdx
+  8046ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8046b3:	48 39 c2             	cmp    %rax,%rdx
+  8046b6:	75 4d                	jne    804705 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8046b8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8046c0:	48 89 d6             	mov    %rdx,%rsi
+  8046c3:	48 89 c7             	mov    %rax,%rdi
+  8046c6:	48 b8 93 42 80 00 00 	movabs $0x804293,%rax
+  8046cd:	00 00 00 
+  8046d0:	ff d0                	call   *%rax
+  8046d2:	85 c0                	test   %eax,%eax
+  8046d4:	74 0a                	je     8046e0 <devpipe_write+0x91>
+        return 0;
+  8046d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046db:	e9 79 01 00 00       	jmp    804859 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8046e0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8046e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046e7:	89 d6                	mov    %edx,%esi
+  8046e9:	48 89 c7             	mov    %rax,%rdi
+  8046ec:	48 b8 6e 44 80 00 00 	movabs $0x80446e,%rax
+  8046f3:	00 00 00 
+  8046f6:	ff d0                	call   *%rax
+      m = 0;
+  8046f8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8046ff:	00 
+      continue;
+  804700:	e9 3a 01 00 00       	jmp    80483f <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804705:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804709:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80470d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804715:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804719:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80471d:	48 8b 08             	mov    (%rax),%rcx
+  804720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804728:	48 29 c1             	sub    %rax,%rcx
+  80472b:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80472f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804733:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804737:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80473b:	48 39 c2             	cmp    %rax,%rdx
+  80473e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804742:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804746:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80474a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80474e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804752:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804756:	ba 00 00 00 00       	mov    $0x0,%edx
+  80475b:	48 f7 f1             	div    %rcx
+  80475e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804762:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804766:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80476a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80476e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804772:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804776:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80477a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80477e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804782:	48 39 c2             	cmp    %rax,%rdx
+  804785:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804789:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80478d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804791:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804795:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804799:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80479d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8047a1:	48 01 d1             	add    %rdx,%rcx
+  8047a4:	48 89 c2             	mov    %rax,%rdx
+  8047a7:	48 89 cf             	mov    %rcx,%rdi
+  8047aa:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  8047b1:	00 00 00 
+  8047b4:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8047b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ba:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047be:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8047c2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8047c6:	73 4d                	jae    804815 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8047c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047cc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8047d4:	48 29 c2             	sub    %rax,%rdx
+  8047d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047db:	48 01 c2             	add    %rax,%rdx
+  8047de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047e2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047e6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8047ea:	48 89 c1             	mov    %rax,%rcx
+  8047ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047f1:	48 01 c1             	add    %rax,%rcx
+  8047f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047f8:	48 01 c1             	add    %rax,%rcx
+  8047fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ff:	48 83 c0 20          	add    $0x20,%rax
+  804803:	48 89 ce             	mov    %rcx,%rsi
+  804806:	48 89 c7             	mov    %rax,%rdi
+  804809:	48 b8 d4 1c 80 00 00 	movabs $0x801cd4,%rax
+  804810:	00 00 00 
+  804813:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804819:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80481d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804821:	48 01 c2             	add    %rax,%rdx
+  804824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804828:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80482c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804830:	48 89 c7             	mov    %rax,%rdi
+  804833:	48 b8 1c 44 80 00 00 	movabs $0x80441c,%rax
+  80483a:	00 00 00 
+  80483d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80483f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804843:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804847:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80484b:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80484f:	0f 82 3a fe ff ff    	jb     80468f <devpipe_write+0x40>
+  }
+
+  return i;
+  804855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804859:	c9                   	leave
+  80485a:	c3                   	ret
+
+000000000080485b <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80485b:	55                   	push   %rbp
+  80485c:	48 89 e5             	mov    %rsp,%rbp
+  80485f:	48 83 ec 40          	sub    $0x40,%rsp
+  804863:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804867:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80486a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80486e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804872:	48 89 c7             	mov    %rax,%rdi
+  804875:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  80487c:	00 00 00 
+  80487f:	ff d0                	call   *%rax
+  804881:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804885:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80488c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804890:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804894:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804898:	48 89 d6             	mov    %rdx,%rsi
+  80489b:	48 89 c7             	mov    %rax,%rdi
+  80489e:	48 b8 36 35 80 00 00 	movabs $0x803536,%rax
+  8048a5:	00 00 00 
+  8048a8:	ff d0                	call   *%rax
+  8048aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048b1:	79 08                	jns    8048bb <devpipe_poll+0x60>
+    return r;
+  8048b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048b6:	e9 85 00 00 00       	jmp    804940 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8048bb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048be:	83 e0 01             	and    $0x1,%eax
+  8048c1:	85 c0                	test   %eax,%eax
+  8048c3:	74 18                	je     8048dd <devpipe_poll+0x82>
+  8048c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c9:	48 8b 10             	mov    (%rax),%rdx
+  8048cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8048d4:	48 39 c2             	cmp    %rax,%rdx
+  8048d7:	74 04                	je     8048dd <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8048d9:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8048dd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048e0:	83 e0 02             	and    $0x2,%eax
+  8048e3:	85 c0                	test   %eax,%eax
+  8048e5:	74 23                	je     80490a <devpipe_poll+0xaf>
+  8048e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048eb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8048ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f3:	48 8b 00             	mov    (%rax),%rax
+  8048f6:	48 29 c2             	sub    %rax,%rdx
+  8048f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048fd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804901:	48 39 c2             	cmp    %rax,%rdx
+  804904:	73 04                	jae    80490a <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804906:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80490a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80490e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804912:	48 89 d6             	mov    %rdx,%rsi
+  804915:	48 89 c7             	mov    %rax,%rdi
+  804918:	48 b8 93 42 80 00 00 	movabs $0x804293,%rax
+  80491f:	00 00 00 
+  804922:	ff d0                	call   *%rax
+  804924:	85 c0                	test   %eax,%eax
+  804926:	74 04                	je     80492c <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804928:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80492c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804930:	75 0b                	jne    80493d <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804932:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804936:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80493d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804940:	c9                   	leave
+  804941:	c3                   	ret
+
+0000000000804942 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804942:	55                   	push   %rbp
+  804943:	48 89 e5             	mov    %rsp,%rbp
+  804946:	48 83 ec 20          	sub    $0x20,%rsp
+  80494a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80494e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804952:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804956:	48 89 c7             	mov    %rax,%rdi
+  804959:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  804960:	00 00 00 
+  804963:	ff d0                	call   *%rax
+  804965:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804969:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80496d:	48 ba 51 5a 80 00 00 	movabs $0x805a51,%rdx
+  804974:	00 00 00 
+  804977:	48 89 d6             	mov    %rdx,%rsi
+  80497a:	48 89 c7             	mov    %rax,%rdi
+  80497d:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  804984:	00 00 00 
+  804987:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804991:	89 c1                	mov    %eax,%ecx
+  804993:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804997:	48 8b 00             	mov    (%rax),%rax
+  80499a:	89 c2                	mov    %eax,%edx
+  80499c:	89 c8                	mov    %ecx,%eax
+  80499e:	29 d0                	sub    %edx,%eax
+  8049a0:	89 c2                	mov    %eax,%edx
+  8049a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049a6:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8049ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049b0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8049b7:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8049ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049be:	48 b9 a0 60 80 00 00 	movabs $0x8060a0,%rcx
+  8049c5:	00 00 00 
+  8049c8:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8049cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049d4:	c9                   	leave
+  8049d5:	c3                   	ret
+
+00000000008049d6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8049d6:	55                   	push   %rbp
+  8049d7:	48 89 e5             	mov    %rsp,%rbp
+  8049da:	48 83 ec 40          	sub    $0x40,%rsp
+  8049de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8049e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049e6:	48 89 c7             	mov    %rax,%rdi
+  8049e9:	48 b8 63 2a 80 00 00 	movabs $0x802a63,%rax
+  8049f0:	00 00 00 
+  8049f3:	ff d0                	call   *%rax
+  8049f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8049f9:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804a00:	00 
+  804a01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a05:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a0d:	48 01 d0             	add    %rdx,%rax
+  804a10:	48 83 c0 1f          	add    $0x1f,%rax
+  804a14:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804a18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a21:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804a25:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a29:	48 29 d0             	sub    %rdx,%rax
+  804a2c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a30:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804a34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a38:	48 89 c6             	mov    %rax,%rsi
+  804a3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a40:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804a47:	00 00 00 
+  804a4a:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804a4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a50:	48 89 c7             	mov    %rax,%rdi
+  804a53:	48 b8 1c 44 80 00 00 	movabs $0x80441c,%rax
+  804a5a:	00 00 00 
+  804a5d:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804a67:	eb 2f                	jmp    804a98 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804a69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a6d:	48 83 e8 01          	sub    $0x1,%rax
+  804a71:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a75:	48 89 c2             	mov    %rax,%rdx
+  804a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a7c:	48 01 d0             	add    %rdx,%rax
+  804a7f:	48 89 c6             	mov    %rax,%rsi
+  804a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a87:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804a8e:	00 00 00 
+  804a91:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a93:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804a98:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804a9d:	77 ca                	ja     804a69 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804a9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aa3:	48 89 c6             	mov    %rax,%rsi
+  804aa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aab:	48 b8 11 24 80 00 00 	movabs $0x802411,%rax
+  804ab2:	00 00 00 
+  804ab5:	ff d0                	call   *%rax
+}
+  804ab7:	c9                   	leave
+  804ab8:	c3                   	ret
+
+0000000000804ab9 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804ab9:	55                   	push   %rbp
+  804aba:	48 89 e5             	mov    %rsp,%rbp
+  804abd:	48 83 ec 08          	sub    $0x8,%rsp
+  804ac1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804ac4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ac8:	75 10                	jne    804ada <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804aca:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ad1:	00 00 00 
+  804ad4:	8b 00                	mov    (%rax),%eax
+  804ad6:	48 98                	cltq
+  804ad8:	eb 05                	jmp    804adf <vsyscall+0x26>
+  }
+  return 0;
+  804ada:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804adf:	c9                   	leave
+  804ae0:	c3                   	ret
+
+0000000000804ae1 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804ae1:	55                   	push   %rbp
+  804ae2:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aea:	48 b8 b9 4a 80 00 00 	movabs $0x804ab9,%rax
+  804af1:	00 00 00 
+  804af4:	ff d0                	call   *%rax
+}
+  804af6:	5d                   	pop    %rbp
+  804af7:	c3                   	ret
+
+0000000000804af8 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804af8:	55                   	push   %rbp
+  804af9:	48 89 e5             	mov    %rsp,%rbp
+  804afc:	48 83 ec 20          	sub    $0x20,%rsp
+  __asm __volatile("rdtsc"
+  804b00:	0f 31                	rdtsc
+  804b02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b05:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804b08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b0e:	48 c1 e2 20          	shl    $0x20,%rdx
+  804b12:	48 09 d0             	or     %rdx,%rax
+  804b15:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804b19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804b1d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804b21:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b28:	00 00 00 
+  804b2b:	8b 40 08             	mov    0x8(%rax),%eax
+  804b2e:	48 98                	cltq
+  804b30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b38:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b3d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b41:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b51:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b55:	48 89 d0             	mov    %rdx,%rax
+  804b58:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b64:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b68:	48 01 c8             	add    %rcx,%rax
+}
+  804b6b:	c9                   	leave
+  804b6c:	c3                   	ret
+
+0000000000804b6d <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804b6d:	55                   	push   %rbp
+  804b6e:	48 89 e5             	mov    %rsp,%rbp
+  804b71:	48 83 ec 20          	sub    $0x20,%rsp
+  804b75:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804b78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b7b:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804b7e:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804b82:	be 01 00 00 00       	mov    $0x1,%esi
+  804b87:	48 89 c7             	mov    %rax,%rdi
+  804b8a:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  804b91:	00 00 00 
+  804b94:	ff d0                	call   *%rax
+}
+  804b96:	90                   	nop
+  804b97:	c9                   	leave
+  804b98:	c3                   	ret
+
+0000000000804b99 <getchar>:
+
+int
+getchar(void) {
+  804b99:	55                   	push   %rbp
+  804b9a:	48 89 e5             	mov    %rsp,%rbp
+  804b9d:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804ba1:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804ba5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804baa:	48 89 c6             	mov    %rax,%rsi
+  804bad:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bb2:	48 b8 cc 30 80 00 00 	movabs $0x8030cc,%rax
+  804bb9:	00 00 00 
+  804bbc:	ff d0                	call   *%rax
+  804bbe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804bc1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bc5:	79 05                	jns    804bcc <getchar+0x33>
+    return r;
+  804bc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bca:	eb 14                	jmp    804be0 <getchar+0x47>
+  if (r < 1)
+  804bcc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bd0:	7f 07                	jg     804bd9 <getchar+0x40>
+    return -E_EOF;
+  804bd2:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804bd7:	eb 07                	jmp    804be0 <getchar+0x47>
+  return c;
+  804bd9:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804bdd:	0f b6 c0             	movzbl %al,%eax
+}
+  804be0:	c9                   	leave
+  804be1:	c3                   	ret
+
+0000000000804be2 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804be2:	55                   	push   %rbp
+  804be3:	48 89 e5             	mov    %rsp,%rbp
+  804be6:	48 83 ec 20          	sub    $0x20,%rsp
+  804bea:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bed:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804bf1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bf4:	48 89 d6             	mov    %rdx,%rsi
+  804bf7:	89 c7                	mov    %eax,%edi
+  804bf9:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  804c00:	00 00 00 
+  804c03:	ff d0                	call   *%rax
+  804c05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c0c:	79 05                	jns    804c13 <iscons+0x31>
+    return r;
+  804c0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c11:	eb 1a                	jmp    804c2d <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804c13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c17:	8b 10                	mov    (%rax),%edx
+  804c19:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  804c20:	00 00 00 
+  804c23:	8b 00                	mov    (%rax),%eax
+  804c25:	39 c2                	cmp    %eax,%edx
+  804c27:	0f 94 c0             	sete   %al
+  804c2a:	0f b6 c0             	movzbl %al,%eax
+}
+  804c2d:	c9                   	leave
+  804c2e:	c3                   	ret
+
+0000000000804c2f <opencons>:
+
+int
+opencons(void) {
+  804c2f:	55                   	push   %rbp
+  804c30:	48 89 e5             	mov    %rsp,%rbp
+  804c33:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804c37:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804c3b:	48 89 c7             	mov    %rax,%rdi
+  804c3e:	48 b8 8e 2a 80 00 00 	movabs $0x802a8e,%rax
+  804c45:	00 00 00 
+  804c48:	ff d0                	call   *%rax
+  804c4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c51:	79 05                	jns    804c58 <opencons+0x29>
+    return r;
+  804c53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c56:	eb 66                	jmp    804cbe <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804c58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c5c:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c61:	48 89 c6             	mov    %rax,%rsi
+  804c64:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c69:	48 b8 59 23 80 00 00 	movabs $0x802359,%rax
+  804c70:	00 00 00 
+  804c73:	ff d0                	call   *%rax
+  804c75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c78:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c7c:	79 05                	jns    804c83 <opencons+0x54>
+    return r;
+  804c7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c81:	eb 3b                	jmp    804cbe <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804c83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c87:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  804c8e:	00 00 00 
+  804c91:	8b 12                	mov    (%rdx),%edx
+  804c93:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804c95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c99:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804ca0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ca4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804cab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804caf:	48 89 c7             	mov    %rax,%rdi
+  804cb2:	48 b8 40 2a 80 00 00 	movabs $0x802a40,%rax
+  804cb9:	00 00 00 
+  804cbc:	ff d0                	call   *%rax
+}
+  804cbe:	c9                   	leave
+  804cbf:	c3                   	ret
+
+0000000000804cc0 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804cc0:	55                   	push   %rbp
+  804cc1:	48 89 e5             	mov    %rsp,%rbp
+  804cc4:	48 83 ec 20          	sub    $0x20,%rsp
+  804cc8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ccb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804cce:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804cd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cd5:	48 89 d6             	mov    %rdx,%rsi
+  804cd8:	89 c7                	mov    %eax,%edi
+  804cda:	48 b8 70 2b 80 00 00 	movabs $0x802b70,%rax
+  804ce1:	00 00 00 
+  804ce4:	ff d0                	call   *%rax
+  804ce6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ce9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ced:	79 05                	jns    804cf4 <consmode+0x34>
+    return r;
+  804cef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cf2:	eb 34                	jmp    804d28 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804cf4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cf8:	8b 10                	mov    (%rax),%edx
+  804cfa:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  804d01:	00 00 00 
+  804d04:	8b 00                	mov    (%rax),%eax
+  804d06:	39 c2                	cmp    %eax,%edx
+  804d08:	74 07                	je     804d11 <consmode+0x51>
+    return -E_INVAL;
+  804d0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d0f:	eb 17                	jmp    804d28 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804d11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d15:	8b 40 0c             	mov    0xc(%rax),%eax
+  804d18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804d1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d1f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d22:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804d25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d28:	c9                   	leave
+  804d29:	c3                   	ret
+
+0000000000804d2a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d2a:	55                   	push   %rbp
+  804d2b:	48 89 e5             	mov    %rsp,%rbp
+  804d2e:	48 83 ec 20          	sub    $0x20,%rsp
+  804d32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804d3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d42:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d45:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d4d:	48 89 ce             	mov    %rcx,%rsi
+  804d50:	48 89 c7             	mov    %rax,%rdi
+  804d53:	48 b8 b3 26 80 00 00 	movabs $0x8026b3,%rax
+  804d5a:	00 00 00 
+  804d5d:	ff d0                	call   *%rax
+  804d5f:	48 98                	cltq
+}
+  804d61:	c9                   	leave
+  804d62:	c3                   	ret
+
+0000000000804d63 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d63:	55                   	push   %rbp
+  804d64:	48 89 e5             	mov    %rsp,%rbp
+  804d67:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804d6e:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804d75:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804d7c:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804d83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d8a:	eb 74                	jmp    804e00 <devcons_write+0x9d>
+    m = n - tot;
+  804d8c:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804d93:	89 c2                	mov    %eax,%edx
+  804d95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d98:	29 c2                	sub    %eax,%edx
+  804d9a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804d9d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804da0:	83 f8 7f             	cmp    $0x7f,%eax
+  804da3:	76 07                	jbe    804dac <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804da5:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804dac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804daf:	48 63 d0             	movslq %eax,%rdx
+  804db2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804db5:	48 63 c8             	movslq %eax,%rcx
+  804db8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804dbf:	48 01 c1             	add    %rax,%rcx
+  804dc2:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804dc9:	48 89 ce             	mov    %rcx,%rsi
+  804dcc:	48 89 c7             	mov    %rax,%rdi
+  804dcf:	48 b8 ce 1a 80 00 00 	movabs $0x801ace,%rax
+  804dd6:	00 00 00 
+  804dd9:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804ddb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dde:	48 63 d0             	movslq %eax,%rdx
+  804de1:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804de8:	48 89 d6             	mov    %rdx,%rsi
+  804deb:	48 89 c7             	mov    %rax,%rdi
+  804dee:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  804df5:	00 00 00 
+  804df8:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804dfa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dfd:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804e00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e03:	48 98                	cltq
+  804e05:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804e0c:	0f 82 7a ff ff ff    	jb     804d8c <devcons_write+0x29>
+  }
+  return tot;
+  804e12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e15:	48 98                	cltq
+}
+  804e17:	c9                   	leave
+  804e18:	c3                   	ret
+
+0000000000804e19 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804e19:	55                   	push   %rbp
+  804e1a:	48 89 e5             	mov    %rsp,%rbp
+  804e1d:	48 83 ec 08          	sub    $0x8,%rsp
+  804e21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804e25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e2a:	c9                   	leave
+  804e2b:	c3                   	ret
+
+0000000000804e2c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e2c:	55                   	push   %rbp
+  804e2d:	48 89 e5             	mov    %rsp,%rbp
+  804e30:	48 83 ec 10          	sub    $0x10,%rsp
+  804e34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804e3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e40:	48 ba 5d 5a 80 00 00 	movabs $0x805a5d,%rdx
+  804e47:	00 00 00 
+  804e4a:	48 89 d6             	mov    %rdx,%rsi
+  804e4d:	48 89 c7             	mov    %rax,%rdi
+  804e50:	48 b8 8b 15 80 00 00 	movabs $0x80158b,%rax
+  804e57:	00 00 00 
+  804e5a:	ff d0                	call   *%rax
+  return 0;
+  804e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e61:	c9                   	leave
+  804e62:	c3                   	ret
+
+0000000000804e63 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804e63:	55                   	push   %rbp
+  804e64:	48 89 e5             	mov    %rsp,%rbp
+  804e67:	48 83 ec 30          	sub    $0x30,%rsp
+  804e6b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e6f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804e72:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804e76:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804e7d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e80:	83 e0 02             	and    $0x2,%eax
+  804e83:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804e86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e8a:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e8d:	83 f8 01             	cmp    $0x1,%eax
+  804e90:	75 04                	jne    804e96 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804e92:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804e96:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e99:	83 e0 01             	and    $0x1,%eax
+  804e9c:	85 c0                	test   %eax,%eax
+  804e9e:	74 44                	je     804ee4 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ea0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ea3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ea8:	89 c2                	mov    %eax,%edx
+  804eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  804eaf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804eb4:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  804ebb:	00 00 00 
+  804ebe:	ff d0                	call   *%rax
+  804ec0:	83 f8 01             	cmp    $0x1,%eax
+  804ec3:	75 06                	jne    804ecb <devcons_poll+0x68>
+      revents |= POLLIN;
+  804ec5:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804ec9:	eb 19                	jmp    804ee4 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804ecb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ecf:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804ed5:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804ed8:	89 c2                	mov    %eax,%edx
+  804eda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ede:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804ee4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804ee7:	c9                   	leave
+  804ee8:	c3                   	ret
+
+0000000000804ee9 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804ee9:	55                   	push   %rbp
+  804eea:	48 89 e5             	mov    %rsp,%rbp
+  804eed:	53                   	push   %rbx
+  804eee:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804ef5:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804efc:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804f02:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804f09:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804f10:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804f17:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804f1e:	84 c0                	test   %al,%al
+  804f20:	74 23                	je     804f45 <_panic+0x5c>
+  804f22:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804f29:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804f2d:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804f31:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804f35:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804f39:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804f3d:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804f41:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804f45:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804f4c:	00 00 00 
+  804f4f:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804f56:	00 00 00 
+  804f59:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804f5d:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804f64:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804f6b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804f72:	48 b8 28 60 80 00 00 	movabs $0x806028,%rax
+  804f79:	00 00 00 
+  804f7c:	48 8b 18             	mov    (%rax),%rbx
+  804f7f:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  804f86:	00 00 00 
+  804f89:	ff d0                	call   *%rax
+  804f8b:	89 c6                	mov    %eax,%esi
+  804f8d:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804f93:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804f9a:	41 89 d0             	mov    %edx,%r8d
+  804f9d:	48 89 c1             	mov    %rax,%rcx
+  804fa0:	48 89 da             	mov    %rbx,%rdx
+  804fa3:	48 b8 68 5a 80 00 00 	movabs $0x805a68,%rax
+  804faa:	00 00 00 
+  804fad:	48 89 c7             	mov    %rax,%rdi
+  804fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb5:	49 b9 db 05 80 00 00 	movabs $0x8005db,%r9
+  804fbc:	00 00 00 
+  804fbf:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804fc2:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804fc9:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804fd0:	48 89 d6             	mov    %rdx,%rsi
+  804fd3:	48 89 c7             	mov    %rax,%rdi
+  804fd6:	48 b8 50 05 80 00 00 	movabs $0x800550,%rax
+  804fdd:	00 00 00 
+  804fe0:	ff d0                	call   *%rax
+  cprintf("\n");
+  804fe2:	48 b8 8b 5a 80 00 00 	movabs $0x805a8b,%rax
+  804fe9:	00 00 00 
+  804fec:	48 89 c7             	mov    %rax,%rdi
+  804fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff4:	48 ba db 05 80 00 00 	movabs $0x8005db,%rdx
+  804ffb:	00 00 00 
+  804ffe:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805000:	cc                   	int3
+  805001:	eb fd                	jmp    805000 <_panic+0x117>
+
+0000000000805003 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805003:	55                   	push   %rbp
+  805004:	48 89 e5             	mov    %rsp,%rbp
+  805007:	48 83 ec 20          	sub    $0x20,%rsp
+  80500b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80500f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805013:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805017:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80501b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80501f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805023:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  80502a:	48 89 c7             	mov    %rax,%rdi
+  80502d:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  805034:	00 00 00 
+  805037:	ff d0                	call   *%rax
+}
+  805039:	c9                   	leave
+  80503a:	c3                   	ret
+
+000000000080503b <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  80503b:	55                   	push   %rbp
+  80503c:	48 89 e5             	mov    %rsp,%rbp
+  80503f:	48 83 ec 30          	sub    $0x30,%rsp
+  805043:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805047:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80504b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80504f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805053:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805058:	75 0e                	jne    805068 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80505a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805061:	00 00 00 
+  805064:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805068:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80506d:	75 18                	jne    805087 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  80506f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805073:	48 89 c7             	mov    %rax,%rdi
+  805076:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  80507d:	00 00 00 
+  805080:	ff d0                	call   *%rax
+  805082:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805085:	eb 1d                	jmp    8050a4 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805087:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80508b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80508f:	48 89 d6             	mov    %rdx,%rsi
+  805092:	48 89 c7             	mov    %rax,%rdi
+  805095:	48 b8 df 25 80 00 00 	movabs $0x8025df,%rax
+  80509c:	00 00 00 
+  80509f:	ff d0                	call   *%rax
+  8050a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8050a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050a8:	79 2a                	jns    8050d4 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8050aa:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8050af:	74 0a                	je     8050bb <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8050b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050b5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8050bb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8050c0:	74 0a                	je     8050cc <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8050c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050c6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  8050cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050cf:	e9 aa 00 00 00       	jmp    80517e <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  8050d4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8050d9:	74 36                	je     805111 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  8050db:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8050e2:	00 00 00 
+  8050e5:	8b 40 04             	mov    0x4(%rax),%eax
+  8050e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8050ed:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050f4:	00 00 00 
+  8050f7:	48 98                	cltq
+  8050f9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805100:	48 01 d0             	add    %rdx,%rax
+  805103:	48 05 24 01 00 00    	add    $0x124,%rax
+  805109:	8b 10                	mov    (%rax),%edx
+  80510b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510f:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805111:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805116:	74 36                	je     80514e <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805118:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80511f:	00 00 00 
+  805122:	8b 40 04             	mov    0x4(%rax),%eax
+  805125:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80512a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805131:	00 00 00 
+  805134:	48 98                	cltq
+  805136:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80513d:	48 01 d0             	add    %rdx,%rax
+  805140:	48 05 28 01 00 00    	add    $0x128,%rax
+  805146:	8b 10                	mov    (%rax),%edx
+  805148:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80514c:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80514e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805155:	00 00 00 
+  805158:	8b 40 04             	mov    0x4(%rax),%eax
+  80515b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805160:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805167:	00 00 00 
+  80516a:	48 98                	cltq
+  80516c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805173:	48 01 d0             	add    %rdx,%rax
+  805176:	48 05 20 01 00 00    	add    $0x120,%rax
+  80517c:	8b 00                	mov    (%rax),%eax
+  }
+}
+  80517e:	c9                   	leave
+  80517f:	c3                   	ret
+
+0000000000805180 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805180:	55                   	push   %rbp
+  805181:	48 89 e5             	mov    %rsp,%rbp
+  805184:	48 83 ec 30          	sub    $0x30,%rsp
+  805188:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80518b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80518e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805192:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805195:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80519a:	75 5e                	jne    8051fa <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  80519c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8051a3:	00 00 00 
+  8051a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8051aa:	eb 4e                	jmp    8051fa <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8051ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051b0:	79 3c                	jns    8051ee <ipc_send+0x6e>
+  8051b2:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8051b6:	74 36                	je     8051ee <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8051b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8051bb:	89 c1                	mov    %eax,%ecx
+  8051bd:	48 b8 90 5a 80 00 00 	movabs $0x805a90,%rax
+  8051c4:	00 00 00 
+  8051c7:	48 89 c2             	mov    %rax,%rdx
+  8051ca:	be 54 00 00 00       	mov    $0x54,%esi
+  8051cf:	48 b8 b6 5a 80 00 00 	movabs $0x805ab6,%rax
+  8051d6:	00 00 00 
+  8051d9:	48 89 c7             	mov    %rax,%rdi
+  8051dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051e1:	49 b8 e9 4e 80 00 00 	movabs $0x804ee9,%r8
+  8051e8:	00 00 00 
+  8051eb:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8051ee:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  8051f5:	00 00 00 
+  8051f8:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8051fa:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8051fd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805200:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805204:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805207:	89 c7                	mov    %eax,%edi
+  805209:	48 b8 42 25 80 00 00 	movabs $0x802542,%rax
+  805210:	00 00 00 
+  805213:	ff d0                	call   *%rax
+  805215:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805218:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80521c:	75 8e                	jne    8051ac <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  80521e:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  805225:	00 00 00 
+  805228:	ff d0                	call   *%rax
+}
+  80522a:	90                   	nop
+  80522b:	c9                   	leave
+  80522c:	c3                   	ret
+
+000000000080522d <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80522d:	55                   	push   %rbp
+  80522e:	48 89 e5             	mov    %rsp,%rbp
+  805231:	48 83 ec 18          	sub    $0x18,%rsp
+  805235:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805238:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80523f:	eb 4d                	jmp    80528e <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805241:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805248:	00 00 00 
+  80524b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80524e:	48 98                	cltq
+  805250:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805257:	48 01 d0             	add    %rdx,%rax
+  80525a:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805260:	8b 00                	mov    (%rax),%eax
+  805262:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805265:	75 23                	jne    80528a <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805267:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80526e:	00 00 00 
+  805271:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805274:	48 98                	cltq
+  805276:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80527d:	48 01 d0             	add    %rdx,%rax
+  805280:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805286:	8b 00                	mov    (%rax),%eax
+  805288:	eb 12                	jmp    80529c <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80528a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80528e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805295:	7e aa                	jle    805241 <ipc_find_env+0x14>
+  return 0;
+  805297:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80529c:	c9                   	leave
+  80529d:	c3                   	ret
+
+000000000080529e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80529e:	55                   	push   %rbp
+  80529f:	48 89 e5             	mov    %rsp,%rbp
+  8052a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8052a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8052aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8052b2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8052b7:	48 89 c2             	mov    %rax,%rdx
+  8052ba:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8052c1:	01 00 00 
+  8052c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052c8:	83 e0 01             	and    $0x1,%eax
+  8052cb:	48 85 c0             	test   %rax,%rax
+  8052ce:	74 63                	je     805333 <pageref+0x95>
+  8052d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052d4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8052d8:	48 89 c2             	mov    %rax,%rdx
+  8052db:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8052e2:	01 00 00 
+  8052e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052e9:	83 e0 01             	and    $0x1,%eax
+  8052ec:	48 85 c0             	test   %rax,%rax
+  8052ef:	74 42                	je     805333 <pageref+0x95>
+  8052f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8052f9:	48 89 c2             	mov    %rax,%rdx
+  8052fc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805303:	01 00 00 
+  805306:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80530a:	83 e0 01             	and    $0x1,%eax
+  80530d:	48 85 c0             	test   %rax,%rax
+  805310:	74 21                	je     805333 <pageref+0x95>
+  805312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805316:	48 c1 e8 0c          	shr    $0xc,%rax
+  80531a:	48 89 c2             	mov    %rax,%rdx
+  80531d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805324:	01 00 00 
+  805327:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80532b:	83 e0 01             	and    $0x1,%eax
+  80532e:	48 85 c0             	test   %rax,%rax
+  805331:	75 07                	jne    80533a <pageref+0x9c>
+    return 0;
+  805333:	b8 00 00 00 00       	mov    $0x0,%eax
+  805338:	eb 53                	jmp    80538d <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  80533a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80533e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805342:	48 89 c2             	mov    %rax,%rdx
+  805345:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80534c:	01 00 00 
+  80534f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805353:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805357:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80535b:	83 e0 01             	and    $0x1,%eax
+  80535e:	48 85 c0             	test   %rax,%rax
+  805361:	75 07                	jne    80536a <pageref+0xcc>
+    return 0;
+  805363:	b8 00 00 00 00       	mov    $0x0,%eax
+  805368:	eb 23                	jmp    80538d <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80536a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80536e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805372:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805379:	00 00 00 
+  80537c:	48 c1 e0 04          	shl    $0x4,%rax
+  805380:	48 01 d0             	add    %rdx,%rax
+  805383:	48 83 c0 08          	add    $0x8,%rax
+  805387:	0f b7 00             	movzwl (%rax),%eax
+  80538a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80538d:	c9                   	leave
+  80538e:	c3                   	ret
+  80538f:	90                   	nop
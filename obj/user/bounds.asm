@@ -0,0 +1,8058 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 4b 00 00 00       	call   800077 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+//Test for UBSAN support - accessing array element with an out-of-borders index
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  //Defining a statically allocated array of 4 32-bit integers
+  int a[4] = {0};
+  800041:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800048:	00 
+  800049:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800050:	00 
+  //Trying to print the value of the fifth element of the array (which causes undefined behavior).
+  //The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+  //The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+  //which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile.
+  cprintf("%d\n", *(a + 5));
+  800051:	8b 45 04             	mov    0x4(%rbp),%eax
+  800054:	89 c6                	mov    %eax,%esi
+  800056:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  80005d:	00 00 00 
+  800060:	48 89 c7             	mov    %rax,%rdi
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	48 ba 23 02 80 00 00 	movabs $0x800223,%rdx
+  80006f:	00 00 00 
+  800072:	ff d2                	call   *%rdx
+}
+  800074:	90                   	nop
+  800075:	c9                   	leave
+  800076:	c3                   	ret
+
+0000000000800077 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800077:	55                   	push   %rbp
+  800078:	48 89 e5             	mov    %rsp,%rbp
+  80007b:	48 83 ec 20          	sub    $0x20,%rsp
+  80007f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800082:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800086:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80008d:	00 00 00 
+  800090:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800094:	eb 13                	jmp    8000a9 <libmain+0x32>
+    (*ctor)();
+  800096:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80009a:	48 8b 10             	mov    (%rax),%rdx
+  80009d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a2:	ff d2                	call   *%rdx
+    ctor++;
+  8000a4:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000a9:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000b0:	00 00 00 
+  8000b3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000b7:	72 dd                	jb     800096 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000bd:	7e 14                	jle    8000d3 <libmain+0x5c>
+    binaryname = argv[0];
+  8000bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000c3:	48 8b 00             	mov    (%rax),%rax
+  8000c6:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000cd:	00 00 00 
+  8000d0:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000da:	48 89 d6             	mov    %rdx,%rsi
+  8000dd:	89 c7                	mov    %eax,%edi
+  8000df:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000eb:	48 b8 fa 00 80 00 00 	movabs $0x8000fa,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+#endif
+}
+  8000f7:	90                   	nop
+  8000f8:	c9                   	leave
+  8000f9:	c3                   	ret
+
+00000000008000fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fa:	55                   	push   %rbp
+  8000fb:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000fe:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80010a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010f:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  800116:	00 00 00 
+  800119:	ff d0                	call   *%rax
+}
+  80011b:	90                   	nop
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	48 83 ec 10          	sub    $0x10,%rsp
+  800126:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800129:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80012d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800131:	8b 00                	mov    (%rax),%eax
+  800133:	8d 48 01             	lea    0x1(%rax),%ecx
+  800136:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80013a:	89 0a                	mov    %ecx,(%rdx)
+  80013c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80013f:	89 d1                	mov    %edx,%ecx
+  800141:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800145:	48 98                	cltq
+  800147:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80014b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80014f:	8b 00                	mov    (%rax),%eax
+  800151:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800156:	75 2c                	jne    800184 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800158:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80015c:	8b 00                	mov    (%rax),%eax
+  80015e:	48 98                	cltq
+  800160:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800164:	48 83 c2 08          	add    $0x8,%rdx
+  800168:	48 89 c6             	mov    %rax,%rsi
+  80016b:	48 89 d7             	mov    %rdx,%rdi
+  80016e:	48 b8 8a 1d 80 00 00 	movabs $0x801d8a,%rax
+  800175:	00 00 00 
+  800178:	ff d0                	call   *%rax
+    b->idx = 0;
+  80017a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80017e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800184:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800188:	8b 40 04             	mov    0x4(%rax),%eax
+  80018b:	8d 50 01             	lea    0x1(%rax),%edx
+  80018e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800192:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800195:	90                   	nop
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+
+0000000000800198 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800198:	55                   	push   %rbp
+  800199:	48 89 e5             	mov    %rsp,%rbp
+  80019c:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8001a3:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8001aa:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001b1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001b8:	00 00 00 
+  b.cnt = 0;
+  8001bb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001c2:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8001c5:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8001cc:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8001d3:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001da:	48 89 c6             	mov    %rax,%rsi
+  8001dd:	48 b8 1e 01 80 00 00 	movabs $0x80011e,%rax
+  8001e4:	00 00 00 
+  8001e7:	48 89 c7             	mov    %rax,%rdi
+  8001ea:	48 b8 7d 05 80 00 00 	movabs $0x80057d,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8001f6:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8001fc:	48 98                	cltq
+  8001fe:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800205:	48 83 c2 08          	add    $0x8,%rdx
+  800209:	48 89 c6             	mov    %rax,%rsi
+  80020c:	48 89 d7             	mov    %rdx,%rdi
+  80020f:	48 b8 8a 1d 80 00 00 	movabs $0x801d8a,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80021b:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80022e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800235:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80023c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800243:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80024a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800251:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800258:	84 c0                	test   %al,%al
+  80025a:	74 20                	je     80027c <cprintf+0x59>
+  80025c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800260:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800264:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800268:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80026c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800270:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800274:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800278:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80027c:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800283:	00 00 00 
+  800286:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80028d:	00 00 00 
+  800290:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800294:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80029b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002a2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8002a9:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002b0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002b7:	48 89 d6             	mov    %rdx,%rsi
+  8002ba:	48 89 c7             	mov    %rax,%rdi
+  8002bd:	48 b8 98 01 80 00 00 	movabs $0x800198,%rax
+  8002c4:	00 00 00 
+  8002c7:	ff d0                	call   *%rax
+  8002c9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8002cf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8002d5:	c9                   	leave
+  8002d6:	c3                   	ret
+
+00000000008002d7 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8002d7:	55                   	push   %rbp
+  8002d8:	48 89 e5             	mov    %rsp,%rbp
+  8002db:	48 83 ec 30          	sub    $0x30,%rsp
+  8002df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8002e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8002e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8002eb:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8002ee:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8002f2:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8002f6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002f9:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8002fd:	72 54                	jb     800353 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ff:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800302:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800305:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80030c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800311:	48 f7 f6             	div    %rsi
+  800314:	49 89 c2             	mov    %rax,%r10
+  800317:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80031a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80031d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800325:	41 89 c9             	mov    %ecx,%r9d
+  800328:	41 89 f8             	mov    %edi,%r8d
+  80032b:	89 d1                	mov    %edx,%ecx
+  80032d:	4c 89 d2             	mov    %r10,%rdx
+  800330:	48 89 c7             	mov    %rax,%rdi
+  800333:	48 b8 d7 02 80 00 00 	movabs $0x8002d7,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+  80033f:	eb 1c                	jmp    80035d <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800341:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800345:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800348:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80034c:	48 89 d6             	mov    %rdx,%rsi
+  80034f:	89 c7                	mov    %eax,%edi
+  800351:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800353:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800357:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80035b:	7f e4                	jg     800341 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80035d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800364:	ba 00 00 00 00       	mov    $0x0,%edx
+  800369:	48 f7 f1             	div    %rcx
+  80036c:	48 b8 30 52 80 00 00 	movabs $0x805230,%rax
+  800373:	00 00 00 
+  800376:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80037a:	0f be c0             	movsbl %al,%eax
+  80037d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800381:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800385:	48 89 d6             	mov    %rdx,%rsi
+  800388:	89 c7                	mov    %eax,%edi
+  80038a:	ff d1                	call   *%rcx
+}
+  80038c:	90                   	nop
+  80038d:	c9                   	leave
+  80038e:	c3                   	ret
+
+000000000080038f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80038f:	55                   	push   %rbp
+  800390:	48 89 e5             	mov    %rsp,%rbp
+  800393:	48 83 ec 10          	sub    $0x10,%rsp
+  800397:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80039b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80039e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8003a2:	7e 4b                	jle    8003ef <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8003a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003a8:	8b 00                	mov    (%rax),%eax
+  8003aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8003ad:	77 24                	ja     8003d3 <getuint+0x44>
+  8003af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003bb:	8b 00                	mov    (%rax),%eax
+  8003bd:	89 c0                	mov    %eax,%eax
+  8003bf:	48 01 d0             	add    %rdx,%rax
+  8003c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c6:	8b 12                	mov    (%rdx),%edx
+  8003c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8003cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003cf:	89 0a                	mov    %ecx,(%rdx)
+  8003d1:	eb 14                	jmp    8003e7 <getuint+0x58>
+  8003d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8003df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8003e7:	48 8b 00             	mov    (%rax),%rax
+  8003ea:	e9 95 00 00 00       	jmp    800484 <getuint+0xf5>
+  else if (lflag)
+  8003ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8003f3:	74 48                	je     80043d <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8003f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f9:	8b 00                	mov    (%rax),%eax
+  8003fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8003fe:	77 24                	ja     800424 <getuint+0x95>
+  800400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800404:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80040c:	8b 00                	mov    (%rax),%eax
+  80040e:	89 c0                	mov    %eax,%eax
+  800410:	48 01 d0             	add    %rdx,%rax
+  800413:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800417:	8b 12                	mov    (%rdx),%edx
+  800419:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80041c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800420:	89 0a                	mov    %ecx,(%rdx)
+  800422:	eb 14                	jmp    800438 <getuint+0xa9>
+  800424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800428:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80042c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800430:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800434:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800438:	48 8b 00             	mov    (%rax),%rax
+  80043b:	eb 47                	jmp    800484 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80043d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800441:	8b 00                	mov    (%rax),%eax
+  800443:	83 f8 2f             	cmp    $0x2f,%eax
+  800446:	77 24                	ja     80046c <getuint+0xdd>
+  800448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80044c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800454:	8b 00                	mov    (%rax),%eax
+  800456:	89 c0                	mov    %eax,%eax
+  800458:	48 01 d0             	add    %rdx,%rax
+  80045b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80045f:	8b 12                	mov    (%rdx),%edx
+  800461:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800464:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800468:	89 0a                	mov    %ecx,(%rdx)
+  80046a:	eb 14                	jmp    800480 <getuint+0xf1>
+  80046c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800470:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800474:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800478:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80047c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800480:	8b 00                	mov    (%rax),%eax
+  800482:	89 c0                	mov    %eax,%eax
+}
+  800484:	c9                   	leave
+  800485:	c3                   	ret
+
+0000000000800486 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800486:	55                   	push   %rbp
+  800487:	48 89 e5             	mov    %rsp,%rbp
+  80048a:	48 83 ec 10          	sub    $0x10,%rsp
+  80048e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800492:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800495:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800499:	7e 4b                	jle    8004e6 <getint+0x60>
+    return va_arg(*ap, long long);
+  80049b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80049f:	8b 00                	mov    (%rax),%eax
+  8004a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a4:	77 24                	ja     8004ca <getint+0x44>
+  8004a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004b2:	8b 00                	mov    (%rax),%eax
+  8004b4:	89 c0                	mov    %eax,%eax
+  8004b6:	48 01 d0             	add    %rdx,%rax
+  8004b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004bd:	8b 12                	mov    (%rdx),%edx
+  8004bf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004c6:	89 0a                	mov    %ecx,(%rdx)
+  8004c8:	eb 14                	jmp    8004de <getint+0x58>
+  8004ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004d2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004da:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004de:	48 8b 00             	mov    (%rax),%rax
+  8004e1:	e9 95 00 00 00       	jmp    80057b <getint+0xf5>
+  else if (lflag)
+  8004e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004ea:	74 48                	je     800534 <getint+0xae>
+    return va_arg(*ap, long);
+  8004ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f0:	8b 00                	mov    (%rax),%eax
+  8004f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f5:	77 24                	ja     80051b <getint+0x95>
+  8004f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800503:	8b 00                	mov    (%rax),%eax
+  800505:	89 c0                	mov    %eax,%eax
+  800507:	48 01 d0             	add    %rdx,%rax
+  80050a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80050e:	8b 12                	mov    (%rdx),%edx
+  800510:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800513:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800517:	89 0a                	mov    %ecx,(%rdx)
+  800519:	eb 14                	jmp    80052f <getint+0xa9>
+  80051b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80051f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800523:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800527:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80052b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80052f:	48 8b 00             	mov    (%rax),%rax
+  800532:	eb 47                	jmp    80057b <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800534:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800538:	8b 00                	mov    (%rax),%eax
+  80053a:	83 f8 2f             	cmp    $0x2f,%eax
+  80053d:	77 24                	ja     800563 <getint+0xdd>
+  80053f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800543:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054b:	8b 00                	mov    (%rax),%eax
+  80054d:	89 c0                	mov    %eax,%eax
+  80054f:	48 01 d0             	add    %rdx,%rax
+  800552:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800556:	8b 12                	mov    (%rdx),%edx
+  800558:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80055b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80055f:	89 0a                	mov    %ecx,(%rdx)
+  800561:	eb 14                	jmp    800577 <getint+0xf1>
+  800563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800567:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80056b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80056f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800573:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800577:	8b 00                	mov    (%rax),%eax
+  800579:	48 98                	cltq
+}
+  80057b:	c9                   	leave
+  80057c:	c3                   	ret
+
+000000000080057d <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80057d:	55                   	push   %rbp
+  80057e:	48 89 e5             	mov    %rsp,%rbp
+  800581:	41 54                	push   %r12
+  800583:	53                   	push   %rbx
+  800584:	48 83 ec 60          	sub    $0x60,%rsp
+  800588:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80058c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800590:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800594:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8005a0:	48 8b 06             	mov    (%rsi),%rax
+  8005a3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005a7:	48 89 01             	mov    %rax,(%rcx)
+  8005aa:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005ae:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005b2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005b6:	eb 17                	jmp    8005cf <vprintfmt+0x52>
+      if (ch == '\0')
+  8005b8:	85 db                	test   %ebx,%ebx
+  8005ba:	0f 84 bf 04 00 00    	je     800a7f <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005c0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005c4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8005c8:	48 89 c6             	mov    %rax,%rsi
+  8005cb:	89 df                	mov    %ebx,%edi
+  8005cd:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005cf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8005d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005d7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005db:	0f b6 00             	movzbl (%rax),%eax
+  8005de:	0f b6 d8             	movzbl %al,%ebx
+  8005e1:	83 fb 25             	cmp    $0x25,%ebx
+  8005e4:	75 d2                	jne    8005b8 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8005e6:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8005ea:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8005f1:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8005f8:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8005ff:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800606:	eb 04                	jmp    80060c <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800608:	90                   	nop
+  800609:	eb 01                	jmp    80060c <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80060b:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80060c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800610:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800614:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800618:	0f b6 00             	movzbl (%rax),%eax
+  80061b:	0f b6 d8             	movzbl %al,%ebx
+  80061e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800621:	83 f8 55             	cmp    $0x55,%eax
+  800624:	0f 87 22 04 00 00    	ja     800a4c <vprintfmt+0x4cf>
+  80062a:	89 c0                	mov    %eax,%eax
+  80062c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800633:	00 
+  800634:	48 b8 58 52 80 00 00 	movabs $0x805258,%rax
+  80063b:	00 00 00 
+  80063e:	48 01 d0             	add    %rdx,%rax
+  800641:	48 8b 00             	mov    (%rax),%rax
+  800644:	ff e0                	jmp    *%rax
+        padc = '-';
+  800646:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80064a:	eb c0                	jmp    80060c <vprintfmt+0x8f>
+        padc = '0';
+  80064c:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800650:	eb ba                	jmp    80060c <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800652:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800659:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80065c:	89 d0                	mov    %edx,%eax
+  80065e:	c1 e0 02             	shl    $0x2,%eax
+  800661:	01 d0                	add    %edx,%eax
+  800663:	01 c0                	add    %eax,%eax
+  800665:	01 d8                	add    %ebx,%eax
+  800667:	83 e8 30             	sub    $0x30,%eax
+  80066a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80066d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800671:	0f b6 00             	movzbl (%rax),%eax
+  800674:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800677:	83 fb 2f             	cmp    $0x2f,%ebx
+  80067a:	7e 60                	jle    8006dc <vprintfmt+0x15f>
+  80067c:	83 fb 39             	cmp    $0x39,%ebx
+  80067f:	7f 5b                	jg     8006dc <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800681:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800686:	eb d1                	jmp    800659 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068b:	83 f8 2f             	cmp    $0x2f,%eax
+  80068e:	77 17                	ja     8006a7 <vprintfmt+0x12a>
+  800690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800694:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800697:	89 d2                	mov    %edx,%edx
+  800699:	48 01 d0             	add    %rdx,%rax
+  80069c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80069f:	83 c2 08             	add    $0x8,%edx
+  8006a2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8006a5:	eb 0c                	jmp    8006b3 <vprintfmt+0x136>
+  8006a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8006ab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006b3:	8b 00                	mov    (%rax),%eax
+  8006b5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006b8:	eb 23                	jmp    8006dd <vprintfmt+0x160>
+        if (width < 0)
+  8006ba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006be:	0f 89 44 ff ff ff    	jns    800608 <vprintfmt+0x8b>
+          width = 0;
+  8006c4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8006cb:	e9 38 ff ff ff       	jmp    800608 <vprintfmt+0x8b>
+        altflag = 1;
+  8006d0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8006d7:	e9 30 ff ff ff       	jmp    80060c <vprintfmt+0x8f>
+        goto process_precision;
+  8006dc:	90                   	nop
+        if (width < 0)
+  8006dd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006e1:	0f 89 24 ff ff ff    	jns    80060b <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8006e7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8006ea:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8006ed:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8006f4:	e9 12 ff ff ff       	jmp    80060b <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8006f9:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8006fd:	e9 0a ff ff ff       	jmp    80060c <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800702:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800705:	83 f8 2f             	cmp    $0x2f,%eax
+  800708:	77 17                	ja     800721 <vprintfmt+0x1a4>
+  80070a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80070e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800711:	89 d2                	mov    %edx,%edx
+  800713:	48 01 d0             	add    %rdx,%rax
+  800716:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800719:	83 c2 08             	add    $0x8,%edx
+  80071c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80071f:	eb 0c                	jmp    80072d <vprintfmt+0x1b0>
+  800721:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800725:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800729:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80072d:	8b 00                	mov    (%rax),%eax
+  80072f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800733:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800737:	48 89 d6             	mov    %rdx,%rsi
+  80073a:	89 c7                	mov    %eax,%edi
+  80073c:	ff d1                	call   *%rcx
+        break;
+  80073e:	e9 37 03 00 00       	jmp    800a7a <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800743:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800746:	83 f8 2f             	cmp    $0x2f,%eax
+  800749:	77 17                	ja     800762 <vprintfmt+0x1e5>
+  80074b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80074f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800752:	89 d2                	mov    %edx,%edx
+  800754:	48 01 d0             	add    %rdx,%rax
+  800757:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80075a:	83 c2 08             	add    $0x8,%edx
+  80075d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800760:	eb 0c                	jmp    80076e <vprintfmt+0x1f1>
+  800762:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800766:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80076a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80076e:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800770:	85 db                	test   %ebx,%ebx
+  800772:	79 02                	jns    800776 <vprintfmt+0x1f9>
+          err = -err;
+  800774:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800776:	83 fb 15             	cmp    $0x15,%ebx
+  800779:	7f 16                	jg     800791 <vprintfmt+0x214>
+  80077b:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  800782:	00 00 00 
+  800785:	48 63 c3             	movslq %ebx,%rax
+  800788:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80078c:	4d 85 e4             	test   %r12,%r12
+  80078f:	75 2e                	jne    8007bf <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800791:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800795:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800799:	89 d9                	mov    %ebx,%ecx
+  80079b:	48 ba 41 52 80 00 00 	movabs $0x805241,%rdx
+  8007a2:	00 00 00 
+  8007a5:	48 89 c7             	mov    %rax,%rdi
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	49 b8 89 0a 80 00 00 	movabs $0x800a89,%r8
+  8007b4:	00 00 00 
+  8007b7:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007ba:	e9 bb 02 00 00       	jmp    800a7a <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007bf:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007c7:	4c 89 e1             	mov    %r12,%rcx
+  8007ca:	48 ba 4a 52 80 00 00 	movabs $0x80524a,%rdx
+  8007d1:	00 00 00 
+  8007d4:	48 89 c7             	mov    %rax,%rdi
+  8007d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007dc:	49 b8 89 0a 80 00 00 	movabs $0x800a89,%r8
+  8007e3:	00 00 00 
+  8007e6:	41 ff d0             	call   *%r8
+        break;
+  8007e9:	e9 8c 02 00 00       	jmp    800a7a <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8007ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f4:	77 17                	ja     80080d <vprintfmt+0x290>
+  8007f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007fa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007fd:	89 d2                	mov    %edx,%edx
+  8007ff:	48 01 d0             	add    %rdx,%rax
+  800802:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800805:	83 c2 08             	add    $0x8,%edx
+  800808:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80080b:	eb 0c                	jmp    800819 <vprintfmt+0x29c>
+  80080d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800811:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800815:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800819:	4c 8b 20             	mov    (%rax),%r12
+  80081c:	4d 85 e4             	test   %r12,%r12
+  80081f:	75 0a                	jne    80082b <vprintfmt+0x2ae>
+          p = "(null)";
+  800821:	49 bc 4d 52 80 00 00 	movabs $0x80524d,%r12
+  800828:	00 00 00 
+        if (width > 0 && padc != '-')
+  80082b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80082f:	7e 78                	jle    8008a9 <vprintfmt+0x32c>
+  800831:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800835:	74 72                	je     8008a9 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800837:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80083a:	48 98                	cltq
+  80083c:	48 89 c6             	mov    %rax,%rsi
+  80083f:	4c 89 e7             	mov    %r12,%rdi
+  800842:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  800849:	00 00 00 
+  80084c:	ff d0                	call   *%rax
+  80084e:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800851:	eb 17                	jmp    80086a <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800853:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800857:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80085b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80085f:	48 89 d6             	mov    %rdx,%rsi
+  800862:	89 c7                	mov    %eax,%edi
+  800864:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800866:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80086a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80086e:	7f e3                	jg     800853 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800870:	eb 37                	jmp    8008a9 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800872:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800876:	74 1e                	je     800896 <vprintfmt+0x319>
+  800878:	83 fb 1f             	cmp    $0x1f,%ebx
+  80087b:	7e 05                	jle    800882 <vprintfmt+0x305>
+  80087d:	83 fb 7e             	cmp    $0x7e,%ebx
+  800880:	7e 14                	jle    800896 <vprintfmt+0x319>
+            putch('?', putdat);
+  800882:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800886:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80088a:	48 89 c6             	mov    %rax,%rsi
+  80088d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800892:	ff d2                	call   *%rdx
+  800894:	eb 0f                	jmp    8008a5 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800896:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80089a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80089e:	48 89 c6             	mov    %rax,%rsi
+  8008a1:	89 df                	mov    %ebx,%edi
+  8008a3:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008a5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008a9:	4c 89 e0             	mov    %r12,%rax
+  8008ac:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008b0:	0f b6 00             	movzbl (%rax),%eax
+  8008b3:	0f be d8             	movsbl %al,%ebx
+  8008b6:	85 db                	test   %ebx,%ebx
+  8008b8:	74 28                	je     8008e2 <vprintfmt+0x365>
+  8008ba:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008be:	78 b2                	js     800872 <vprintfmt+0x2f5>
+  8008c0:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008c4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008c8:	79 a8                	jns    800872 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8008ca:	eb 16                	jmp    8008e2 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8008cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008d0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008d4:	48 89 c6             	mov    %rax,%rsi
+  8008d7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008dc:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8008de:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008e2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008e6:	7f e4                	jg     8008cc <vprintfmt+0x34f>
+        break;
+  8008e8:	e9 8d 01 00 00       	jmp    800a7a <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8008ed:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8008f0:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8008f4:	89 d6                	mov    %edx,%esi
+  8008f6:	48 89 c7             	mov    %rax,%rdi
+  8008f9:	48 b8 86 04 80 00 00 	movabs $0x800486,%rax
+  800900:	00 00 00 
+  800903:	ff d0                	call   *%rax
+  800905:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800909:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090d:	48 85 c0             	test   %rax,%rax
+  800910:	79 1d                	jns    80092f <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800912:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800916:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80091a:	48 89 c6             	mov    %rax,%rsi
+  80091d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800922:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800928:	48 f7 d8             	neg    %rax
+  80092b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80092f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800936:	e9 d2 00 00 00       	jmp    800a0d <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80093b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80093e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800942:	89 d6                	mov    %edx,%esi
+  800944:	48 89 c7             	mov    %rax,%rdi
+  800947:	48 b8 8f 03 80 00 00 	movabs $0x80038f,%rax
+  80094e:	00 00 00 
+  800951:	ff d0                	call   *%rax
+  800953:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800957:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80095e:	e9 aa 00 00 00       	jmp    800a0d <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800963:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800966:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80096a:	89 d6                	mov    %edx,%esi
+  80096c:	48 89 c7             	mov    %rax,%rdi
+  80096f:	48 b8 8f 03 80 00 00 	movabs $0x80038f,%rax
+  800976:	00 00 00 
+  800979:	ff d0                	call   *%rax
+  80097b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  80097f:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800986:	e9 82 00 00 00       	jmp    800a0d <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  80098b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80098f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800993:	48 89 c6             	mov    %rax,%rsi
+  800996:	bf 30 00 00 00       	mov    $0x30,%edi
+  80099b:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80099d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009a1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009a5:	48 89 c6             	mov    %rax,%rsi
+  8009a8:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009ad:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	77 17                	ja     8009ce <vprintfmt+0x451>
+  8009b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009bb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009be:	89 d2                	mov    %edx,%edx
+  8009c0:	48 01 d0             	add    %rdx,%rax
+  8009c3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009c6:	83 c2 08             	add    $0x8,%edx
+  8009c9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009cc:	eb 0c                	jmp    8009da <vprintfmt+0x45d>
+  8009ce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009d2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009d6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009da:	48 8b 00             	mov    (%rax),%rax
+  8009dd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009e1:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8009e8:	eb 23                	jmp    800a0d <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8009ea:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009ed:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009f1:	89 d6                	mov    %edx,%esi
+  8009f3:	48 89 c7             	mov    %rax,%rdi
+  8009f6:	48 b8 8f 03 80 00 00 	movabs $0x80038f,%rax
+  8009fd:	00 00 00 
+  800a00:	ff d0                	call   *%rax
+  800a02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a06:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a0d:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a12:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a15:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a20:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a24:	45 89 c1             	mov    %r8d,%r9d
+  800a27:	41 89 f8             	mov    %edi,%r8d
+  800a2a:	48 89 c7             	mov    %rax,%rdi
+  800a2d:	48 b8 d7 02 80 00 00 	movabs $0x8002d7,%rax
+  800a34:	00 00 00 
+  800a37:	ff d0                	call   *%rax
+        break;
+  800a39:	eb 3f                	jmp    800a7a <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a3f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a43:	48 89 c6             	mov    %rax,%rsi
+  800a46:	89 df                	mov    %ebx,%edi
+  800a48:	ff d2                	call   *%rdx
+        break;
+  800a4a:	eb 2e                	jmp    800a7a <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a50:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a54:	48 89 c6             	mov    %rax,%rsi
+  800a57:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a5c:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a5e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a63:	eb 05                	jmp    800a6a <vprintfmt+0x4ed>
+  800a65:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a6a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a6e:	48 83 e8 01          	sub    $0x1,%rax
+  800a72:	0f b6 00             	movzbl (%rax),%eax
+  800a75:	3c 25                	cmp    $0x25,%al
+  800a77:	75 ec                	jne    800a65 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800a79:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a7a:	e9 50 fb ff ff       	jmp    8005cf <vprintfmt+0x52>
+        return;
+  800a7f:	90                   	nop
+    }
+  }
+}
+  800a80:	48 83 c4 60          	add    $0x60,%rsp
+  800a84:	5b                   	pop    %rbx
+  800a85:	41 5c                	pop    %r12
+  800a87:	5d                   	pop    %rbp
+  800a88:	c3                   	ret
+
+0000000000800a89 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a89:	55                   	push   %rbp
+  800a8a:	48 89 e5             	mov    %rsp,%rbp
+  800a8d:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800a94:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a9b:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800aa2:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800aa9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ab0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ab7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800abe:	84 c0                	test   %al,%al
+  800ac0:	74 20                	je     800ae2 <printfmt+0x59>
+  800ac2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ac6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800aca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ace:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ad2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ad6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ada:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ade:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ae2:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ae9:	00 00 00 
+  800aec:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800af3:	00 00 00 
+  800af6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800afa:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b01:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b08:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b0f:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b16:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b1d:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b24:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b2b:	48 89 c7             	mov    %rax,%rdi
+  800b2e:	48 b8 7d 05 80 00 00 	movabs $0x80057d,%rax
+  800b35:	00 00 00 
+  800b38:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b3a:	90                   	nop
+  800b3b:	c9                   	leave
+  800b3c:	c3                   	ret
+
+0000000000800b3d <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b3d:	55                   	push   %rbp
+  800b3e:	48 89 e5             	mov    %rsp,%rbp
+  800b41:	48 83 ec 10          	sub    $0x10,%rsp
+  800b45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b50:	8b 40 10             	mov    0x10(%rax),%eax
+  800b53:	8d 50 01             	lea    0x1(%rax),%edx
+  800b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5a:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b61:	48 8b 10             	mov    (%rax),%rdx
+  800b64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b6c:	48 39 c2             	cmp    %rax,%rdx
+  800b6f:	73 17                	jae    800b88 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800b71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b75:	48 8b 00             	mov    (%rax),%rax
+  800b78:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800b7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b80:	48 89 0a             	mov    %rcx,(%rdx)
+  800b83:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b86:	88 10                	mov    %dl,(%rax)
+}
+  800b88:	90                   	nop
+  800b89:	c9                   	leave
+  800b8a:	c3                   	ret
+
+0000000000800b8b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800b8b:	55                   	push   %rbp
+  800b8c:	48 89 e5             	mov    %rsp,%rbp
+  800b8f:	48 83 ec 40          	sub    $0x40,%rsp
+  800b93:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b97:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b9e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ba2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800baa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800bad:	48 98                	cltq
+  800baf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800bb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb7:	48 01 d0             	add    %rdx,%rax
+  800bba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bbe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800bc5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bca:	74 06                	je     800bd2 <vsnprintf+0x47>
+  800bcc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bd0:	7f 07                	jg     800bd9 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800bd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd7:	eb 32                	jmp    800c0b <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800bd9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bdd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800be1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800be5:	48 89 c6             	mov    %rax,%rsi
+  800be8:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  800bef:	00 00 00 
+  800bf2:	48 89 c7             	mov    %rax,%rdi
+  800bf5:	48 b8 7d 05 80 00 00 	movabs $0x80057d,%rax
+  800bfc:	00 00 00 
+  800bff:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c05:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c08:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c0b:	c9                   	leave
+  800c0c:	c3                   	ret
+
+0000000000800c0d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c0d:	55                   	push   %rbp
+  800c0e:	48 89 e5             	mov    %rsp,%rbp
+  800c11:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c18:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c1f:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c25:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c2c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c33:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c3a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c41:	84 c0                	test   %al,%al
+  800c43:	74 20                	je     800c65 <snprintf+0x58>
+  800c45:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c49:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c4d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c51:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c55:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c59:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c5d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c61:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c65:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800c6c:	00 00 00 
+  800c6f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c76:	00 00 00 
+  800c79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c7d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c84:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c8b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c92:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800c99:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ca0:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ca6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800cad:	48 89 c7             	mov    %rax,%rdi
+  800cb0:	48 b8 8b 0b 80 00 00 	movabs $0x800b8b,%rax
+  800cb7:	00 00 00 
+  800cba:	ff d0                	call   *%rax
+  800cbc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cc2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+0000000000800cca <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800cca:	55                   	push   %rbp
+  800ccb:	48 89 e5             	mov    %rsp,%rbp
+  800cce:	53                   	push   %rbx
+  800ccf:	48 83 ec 38          	sub    $0x38,%rsp
+  800cd3:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800cd6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cda:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800cde:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ce2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800ce6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cee:	89 d1                	mov    %edx,%ecx
+  800cf0:	0f a2                	cpuid
+  800cf2:	89 de                	mov    %ebx,%esi
+  800cf4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800cf7:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800cfa:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800cfd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800d00:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d05:	74 09                	je     800d10 <cpuid+0x46>
+}
+  800d07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d0e:	89 10                	mov    %edx,(%rax)
+
+  800d10:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d15:	74 09                	je     800d20 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d1b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d1e:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d20:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d25:	74 09                	je     800d30 <cpuid+0x66>
+char *
+  800d27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d2b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d2e:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d30:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d35:	74 09                	je     800d40 <cpuid+0x76>
+  for (; *s; s++)
+  800d37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d3b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d3e:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d40:	90                   	nop
+  800d41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d45:	c9                   	leave
+  800d46:	c3                   	ret
+
+0000000000800d47 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d47:	55                   	push   %rbp
+  800d48:	48 89 e5             	mov    %rsp,%rbp
+  800d4b:	48 83 ec 18          	sub    $0x18,%rsp
+  800d4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d55:	89 c1                	mov    %eax,%ecx
+  800d57:	0f 01 d0             	xgetbv
+  800d5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d5d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d63:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800d66:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d6a:	48 09 d0             	or     %rdx,%rax
+#else
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+
+0000000000800d6f <string_cpu>:
+string_cpu(void) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800d77:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800d7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800d85:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d8c:	00 00 00 
+  800d8f:	8b 00                	mov    (%rax),%eax
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	78 11                	js     800da6 <string_cpu+0x37>
+    return string_features;
+  800d95:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d9c:	00 00 00 
+  800d9f:	8b 00                	mov    (%rax),%eax
+  800da1:	e9 df 00 00 00       	jmp    800e85 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800da6:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800daa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dba:	48 89 c6             	mov    %rax,%rsi
+  800dbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc2:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800dc9:	00 00 00 
+  800dcc:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800dce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800dd1:	83 f8 06             	cmp    $0x6,%eax
+  800dd4:	76 28                	jbe    800dfe <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800dd6:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800dda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800de0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de5:	48 89 c2             	mov    %rax,%rdx
+  800de8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ded:	bf 07 00 00 00       	mov    $0x7,%edi
+  800df2:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800dfe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e01:	25 00 02 00 00       	and    $0x200,%eax
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	74 04                	je     800e0e <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e0a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e0e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e18:	48 89 c1             	mov    %rax,%rcx
+  800e1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e20:	be 00 00 00 00       	mov    $0x0,%esi
+  800e25:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e2a:	48 b8 ca 0c 80 00 00 	movabs $0x800cca,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e36:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e39:	83 e0 20             	and    $0x20,%eax
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	74 2a                	je     800e6a <string_cpu+0xfb>
+  800e40:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e43:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e48:	85 c0                	test   %eax,%eax
+  800e4a:	74 1e                	je     800e6a <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e51:	48 b8 47 0d 80 00 00 	movabs $0x800d47,%rax
+  800e58:	00 00 00 
+  800e5b:	ff d0                	call   *%rax
+  800e5d:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e60:	48 83 f8 06          	cmp    $0x6,%rax
+  800e64:	75 04                	jne    800e6a <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800e66:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800e6a:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800e71:	00 00 00 
+  800e74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e77:	89 02                	mov    %eax,(%rdx)
+  800e79:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e80:	00 00 00 
+  800e83:	8b 00                	mov    (%rax),%eax
+}
+  800e85:	c9                   	leave
+  800e86:	c3                   	ret
+
+0000000000800e87 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800e87:	55                   	push   %rbp
+  800e88:	48 89 e5             	mov    %rsp,%rbp
+  800e8b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800e8f:	48 83 ec 60          	sub    $0x60,%rsp
+  800e93:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800e98:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800e9d:	83 e0 1f             	and    $0x1f,%eax
+  800ea0:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800ea4:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ea8:	48 f7 d8             	neg    %rax
+  800eab:	48 89 c2             	mov    %rax,%rdx
+  800eae:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800eb3:	48 01 d0             	add    %rdx,%rax
+  800eb6:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800ebb:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800ebf:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800ec5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800eca:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ece:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ed4:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ed8:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800edc:	89 c2                	mov    %eax,%edx
+  800ede:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ee2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800ee7:	89 c1                	mov    %eax,%ecx
+  800ee9:	d3 e6                	shl    %cl,%esi
+  800eeb:	89 f0                	mov    %esi,%eax
+  800eed:	21 d0                	and    %edx,%eax
+  800eef:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800ef3:	eb 21                	jmp    800f16 <strlen_avx2+0x8f>
+    p += 32;
+  800ef5:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800efb:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f00:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f04:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f0a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f0e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f12:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f16:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f1b:	74 d8                	je     800ef5 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f1d:	31 c0                	xor    %eax,%eax
+  800f1f:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f25:	48 63 d0             	movslq %eax,%rdx
+  800f28:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f2d:	48 01 d0             	add    %rdx,%rax
+  800f30:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f35:	c9                   	leave
+  800f36:	c3                   	ret
+
+0000000000800f37 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f37:	55                   	push   %rbp
+  800f38:	48 89 e5             	mov    %rsp,%rbp
+  800f3b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f3f:	48 83 ec 40          	sub    $0x40,%rsp
+  800f43:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f48:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f4d:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f52:	eb 77                	jmp    800fcb <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f54:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f59:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f5d:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f61:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800f66:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f6a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f6e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f72:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800f76:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800f7b:	74 3c                	je     800fb9 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800f7d:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800f81:	f7 d0                	not    %eax
+  800f83:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f87:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800f8b:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800f8f:	48 63 d0             	movslq %eax,%rdx
+  800f92:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f97:	48 01 d0             	add    %rdx,%rax
+  800f9a:	0f b6 00             	movzbl (%rax),%eax
+  800f9d:	0f b6 c0             	movzbl %al,%eax
+  800fa0:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800fa4:	48 63 ca             	movslq %edx,%rcx
+  800fa7:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fac:	48 01 ca             	add    %rcx,%rdx
+  800faf:	0f b6 12             	movzbl (%rdx),%edx
+  800fb2:	0f b6 d2             	movzbl %dl,%edx
+  800fb5:	29 d0                	sub    %edx,%eax
+  800fb7:	eb 6b                	jmp    801024 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fb9:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800fbf:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800fc5:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800fcb:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800fd1:	77 81                	ja     800f54 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800fd3:	eb 42                	jmp    801017 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800fd5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fda:	0f b6 10             	movzbl (%rax),%edx
+  800fdd:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fe2:	0f b6 00             	movzbl (%rax),%eax
+  800fe5:	38 c2                	cmp    %al,%dl
+  800fe7:	74 1c                	je     801005 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800fe9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fee:	0f b6 00             	movzbl (%rax),%eax
+  800ff1:	0f b6 c8             	movzbl %al,%ecx
+  800ff4:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800ff9:	0f b6 00             	movzbl (%rax),%eax
+  800ffc:	0f b6 d0             	movzbl %al,%edx
+  800fff:	89 c8                	mov    %ecx,%eax
+  801001:	29 d0                	sub    %edx,%eax
+  801003:	eb 1f                	jmp    801024 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801005:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80100b:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801011:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801017:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80101d:	75 b6                	jne    800fd5 <memcmp_avx2+0x9e>
+  return 0;
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801024:	c9                   	leave
+  801025:	c3                   	ret
+
+0000000000801026 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801026:	55                   	push   %rbp
+  801027:	48 89 e5             	mov    %rsp,%rbp
+  80102a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80102e:	48 83 ec 60          	sub    $0x60,%rsp
+  801032:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801037:	89 f0                	mov    %esi,%eax
+  801039:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80103e:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801042:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801047:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80104b:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801050:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801056:	eb 47                	jmp    80109f <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801058:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80105d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801061:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801065:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80106b:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80106f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801073:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801077:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80107c:	74 15                	je     801093 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80107e:	31 c0                	xor    %eax,%eax
+  801080:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801086:	48 63 d0             	movslq %eax,%rdx
+  801089:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80108e:	48 01 d0             	add    %rdx,%rax
+  801091:	eb 3d                	jmp    8010d0 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801093:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801099:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80109f:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8010a5:	77 b1                	ja     801058 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8010a7:	eb 0c                	jmp    8010b5 <memfind_avx2+0x8f>
+  8010a9:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010af:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010b5:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010bb:	74 0e                	je     8010cb <memfind_avx2+0xa5>
+  8010bd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010c2:	0f b6 00             	movzbl (%rax),%eax
+  8010c5:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8010c9:	75 de                	jne    8010a9 <memfind_avx2+0x83>
+  return s;
+  8010cb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8010d0:	c9                   	leave
+  8010d1:	c3                   	ret
+
+00000000008010d2 <strlen>:
+strlen(const char *s) {
+  8010d2:	55                   	push   %rbp
+  8010d3:	48 89 e5             	mov    %rsp,%rbp
+  8010d6:	48 83 ec 40          	sub    $0x40,%rsp
+  8010da:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8010de:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8010e2:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8010e6:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  8010ed:	00 00 00 
+  8010f0:	ff d0                	call   *%rax
+  8010f2:	83 e0 02             	and    $0x2,%eax
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	74 18                	je     801111 <strlen+0x3f>
+    return strlen_avx2(s);
+  8010f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010fd:	48 89 c7             	mov    %rax,%rdi
+  801100:	48 b8 87 0e 80 00 00 	movabs $0x800e87,%rax
+  801107:	00 00 00 
+  80110a:	ff d0                	call   *%rax
+  80110c:	e9 82 00 00 00       	jmp    801193 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801111:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801115:	83 e0 0f             	and    $0xf,%eax
+  801118:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80111b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80111e:	48 f7 d8             	neg    %rax
+  801121:	48 89 c2             	mov    %rax,%rdx
+  801124:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801128:	48 01 d0             	add    %rdx,%rax
+  80112b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80112f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801133:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801137:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80113c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801140:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801144:	89 c2                	mov    %eax,%edx
+  801146:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801149:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80114e:	89 c1                	mov    %eax,%ecx
+  801150:	d3 e6                	shl    %cl,%esi
+  801152:	89 f0                	mov    %esi,%eax
+  801154:	21 d0                	and    %edx,%eax
+  801156:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801159:	eb 1d                	jmp    801178 <strlen+0xa6>
+    p += 16;
+  80115b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801160:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801164:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801168:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80116d:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801171:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801175:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801178:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80117c:	74 dd                	je     80115b <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80117e:	31 c0                	xor    %eax,%eax
+  801180:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801185:	48 63 d0             	movslq %eax,%rdx
+  801188:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118c:	48 01 d0             	add    %rdx,%rax
+  80118f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801193:	c9                   	leave
+  801194:	c3                   	ret
+
+0000000000801195 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+  801199:	48 83 ec 20          	sub    $0x20,%rsp
+  80119d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011a5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011ac:	eb 0e                	jmp    8011bc <strnlen+0x27>
+    n++;
+  8011ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011b2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011b7:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011bc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011c1:	74 0b                	je     8011ce <strnlen+0x39>
+  8011c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c7:	0f b6 00             	movzbl (%rax),%eax
+  8011ca:	84 c0                	test   %al,%al
+  8011cc:	75 e0                	jne    8011ae <strnlen+0x19>
+  return n;
+  8011ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011d1:	c9                   	leave
+  8011d2:	c3                   	ret
+
+00000000008011d3 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8011d3:	55                   	push   %rbp
+  8011d4:	48 89 e5             	mov    %rsp,%rbp
+  8011d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8011db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8011e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8011eb:	90                   	nop
+  8011ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011f0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011f4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801200:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801204:	0f b6 12             	movzbl (%rdx),%edx
+  801207:	88 10                	mov    %dl,(%rax)
+  801209:	0f b6 00             	movzbl (%rax),%eax
+  80120c:	84 c0                	test   %al,%al
+  80120e:	75 dc                	jne    8011ec <strcpy+0x19>
+  return ret;
+  801210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+0000000000801216 <strcat>:
+strcat(char *dst, const char *src) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	48 83 ec 20          	sub    $0x20,%rsp
+  80121e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801222:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122a:	48 89 c7             	mov    %rax,%rdi
+  80122d:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  801234:	00 00 00 
+  801237:	ff d0                	call   *%rax
+  801239:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80123c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123f:	48 63 d0             	movslq %eax,%rdx
+  801242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801246:	48 01 c2             	add    %rax,%rdx
+  801249:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80124d:	48 89 c6             	mov    %rax,%rsi
+  801250:	48 89 d7             	mov    %rdx,%rdi
+  801253:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  80125a:	00 00 00 
+  80125d:	ff d0                	call   *%rax
+  return dst;
+  80125f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801263:	c9                   	leave
+  801264:	c3                   	ret
+
+0000000000801265 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	48 83 ec 28          	sub    $0x28,%rsp
+  80126d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801271:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801275:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801279:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801281:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801288:	00 
+  801289:	eb 2a                	jmp    8012b5 <strncpy+0x50>
+    *dst++ = *src;
+  80128b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801293:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801297:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80129b:	0f b6 12             	movzbl (%rdx),%edx
+  80129e:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8012a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012a4:	0f b6 00             	movzbl (%rax),%eax
+  8012a7:	84 c0                	test   %al,%al
+  8012a9:	74 05                	je     8012b0 <strncpy+0x4b>
+      src++;
+  8012ab:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012bd:	72 cc                	jb     80128b <strncpy+0x26>
+  return ret;
+  8012bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012c3:	c9                   	leave
+  8012c4:	c3                   	ret
+
+00000000008012c5 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8012c5:	55                   	push   %rbp
+  8012c6:	48 89 e5             	mov    %rsp,%rbp
+  8012c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8012cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012d5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8012d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8012e1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012e6:	74 3d                	je     801325 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8012e8:	eb 1d                	jmp    801307 <strlcpy+0x42>
+      *dst++ = *src++;
+  8012ea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012ee:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012fa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801302:	0f b6 12             	movzbl (%rdx),%edx
+  801305:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801307:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80130c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801311:	74 0b                	je     80131e <strlcpy+0x59>
+  801313:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801317:	0f b6 00             	movzbl (%rax),%eax
+  80131a:	84 c0                	test   %al,%al
+  80131c:	75 cc                	jne    8012ea <strlcpy+0x25>
+    *dst = '\0';
+  80131e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801322:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801329:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80132d:	c9                   	leave
+  80132e:	c3                   	ret
+
+000000000080132f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80132f:	55                   	push   %rbp
+  801330:	48 89 e5             	mov    %rsp,%rbp
+  801333:	48 83 ec 30          	sub    $0x30,%rsp
+  801337:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80133b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80133f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801343:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801347:	48 89 c7             	mov    %rax,%rdi
+  80134a:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  801351:	00 00 00 
+  801354:	ff d0                	call   *%rax
+  801356:	48 98                	cltq
+  801358:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80135c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801364:	48 89 d6             	mov    %rdx,%rsi
+  801367:	48 89 c7             	mov    %rax,%rdi
+  80136a:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  801371:	00 00 00 
+  801374:	ff d0                	call   *%rax
+  801376:	48 98                	cltq
+  801378:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80137c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801380:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801384:	75 10                	jne    801396 <strlcat+0x67>
+    return maxlen + srclen;
+  801386:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80138a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138e:	48 01 d0             	add    %rdx,%rax
+  801391:	e9 86 00 00 00       	jmp    80141c <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801396:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80139a:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80139e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8013a2:	73 2b                	jae    8013cf <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8013a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013ac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b4:	48 01 c1             	add    %rax,%rcx
+  8013b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013bb:	48 89 c6             	mov    %rax,%rsi
+  8013be:	48 89 cf             	mov    %rcx,%rdi
+  8013c1:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8013c8:	00 00 00 
+  8013cb:	ff d0                	call   *%rax
+  8013cd:	eb 42                	jmp    801411 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8013cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013d3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013d7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013df:	48 01 c1             	add    %rax,%rcx
+  8013e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013e6:	48 89 c6             	mov    %rax,%rsi
+  8013e9:	48 89 cf             	mov    %rcx,%rdi
+  8013ec:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8013f3:	00 00 00 
+  8013f6:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8013f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801400:	48 01 d0             	add    %rdx,%rax
+  801403:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801407:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140b:	48 01 d0             	add    %rdx,%rax
+  80140e:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801411:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801419:	48 01 d0             	add    %rdx,%rax
+}
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+
+000000000080141e <strcmp>:
+strcmp(const char *p, const char *q) {
+  80141e:	55                   	push   %rbp
+  80141f:	48 89 e5             	mov    %rsp,%rbp
+  801422:	48 83 ec 10          	sub    $0x10,%rsp
+  801426:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80142a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80142e:	eb 0a                	jmp    80143a <strcmp+0x1c>
+    p++, q++;
+  801430:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801435:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80143a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80143e:	0f b6 00             	movzbl (%rax),%eax
+  801441:	84 c0                	test   %al,%al
+  801443:	74 12                	je     801457 <strcmp+0x39>
+  801445:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801449:	0f b6 10             	movzbl (%rax),%edx
+  80144c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801450:	0f b6 00             	movzbl (%rax),%eax
+  801453:	38 c2                	cmp    %al,%dl
+  801455:	74 d9                	je     801430 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801457:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145b:	0f b6 00             	movzbl (%rax),%eax
+  80145e:	0f b6 d0             	movzbl %al,%edx
+  801461:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801465:	0f b6 00             	movzbl (%rax),%eax
+  801468:	0f b6 c0             	movzbl %al,%eax
+  80146b:	29 c2                	sub    %eax,%edx
+  80146d:	89 d0                	mov    %edx,%eax
+}
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+
+0000000000801471 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	48 83 ec 18          	sub    $0x18,%rsp
+  801479:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80147d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801481:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801485:	eb 0f                	jmp    801496 <strncmp+0x25>
+    n--, p++, q++;
+  801487:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80148c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801491:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801496:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80149b:	74 1d                	je     8014ba <strncmp+0x49>
+  80149d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a1:	0f b6 00             	movzbl (%rax),%eax
+  8014a4:	84 c0                	test   %al,%al
+  8014a6:	74 12                	je     8014ba <strncmp+0x49>
+  8014a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ac:	0f b6 10             	movzbl (%rax),%edx
+  8014af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b3:	0f b6 00             	movzbl (%rax),%eax
+  8014b6:	38 c2                	cmp    %al,%dl
+  8014b8:	74 cd                	je     801487 <strncmp+0x16>
+  if (n == 0)
+  8014ba:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014bf:	75 07                	jne    8014c8 <strncmp+0x57>
+    return 0;
+  8014c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c6:	eb 16                	jmp    8014de <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8014c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014cc:	0f b6 00             	movzbl (%rax),%eax
+  8014cf:	0f b6 d0             	movzbl %al,%edx
+  8014d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d6:	0f b6 00             	movzbl (%rax),%eax
+  8014d9:	0f b6 c0             	movzbl %al,%eax
+  8014dc:	29 c2                	sub    %eax,%edx
+}
+  8014de:	89 d0                	mov    %edx,%eax
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+00000000008014e2 <strchr>:
+strchr(const char *s, char c) {
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	48 83 ec 60          	sub    $0x60,%rsp
+  8014ea:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8014ee:	89 f0                	mov    %esi,%eax
+  8014f0:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8014f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014f7:	83 e0 0f             	and    $0xf,%eax
+  8014fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8014fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801500:	48 f7 d8             	neg    %rax
+  801503:	48 89 c2             	mov    %rax,%rdx
+  801506:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80150a:	48 01 d0             	add    %rdx,%rax
+  80150d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801511:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801515:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801519:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80151d:	66 0f 6e c0          	movd   %eax,%xmm0
+  801521:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801525:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801529:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80152e:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801532:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801536:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80153a:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80153e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801543:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801548:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80154c:	89 c2                	mov    %eax,%edx
+  80154e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801553:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801558:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80155c:	09 c2                	or     %eax,%edx
+  80155e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801561:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801566:	89 c1                	mov    %eax,%ecx
+  801568:	d3 e6                	shl    %cl,%esi
+  80156a:	89 f0                	mov    %esi,%eax
+  80156c:	21 d0                	and    %edx,%eax
+  80156e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801571:	eb 34                	jmp    8015a7 <strchr+0xc5>
+    p += 16;
+  801573:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801580:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801584:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801589:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80158e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801592:	89 c2                	mov    %eax,%edx
+  801594:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801599:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80159e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015a2:	09 d0                	or     %edx,%eax
+  8015a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015ab:	74 c6                	je     801573 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015ad:	31 c0                	xor    %eax,%eax
+  8015af:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015b4:	48 98                	cltq
+  8015b6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015be:	0f b6 00             	movzbl (%rax),%eax
+  8015c1:	84 c0                	test   %al,%al
+  8015c3:	74 06                	je     8015cb <strchr+0xe9>
+  8015c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c9:	eb 05                	jmp    8015d0 <strchr+0xee>
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+
+00000000008015d2 <strfind>:
+strfind(const char *s, char c) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8015da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015de:	89 f0                	mov    %esi,%eax
+  8015e0:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8015e3:	eb 11                	jmp    8015f6 <strfind+0x24>
+    if (*s == c)
+  8015e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e9:	0f b6 00             	movzbl (%rax),%eax
+  8015ec:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015ef:	74 12                	je     801603 <strfind+0x31>
+  for (; *s; s++)
+  8015f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fa:	0f b6 00             	movzbl (%rax),%eax
+  8015fd:	84 c0                	test   %al,%al
+  8015ff:	75 e4                	jne    8015e5 <strfind+0x13>
+  801601:	eb 01                	jmp    801604 <strfind+0x32>
+      break;
+  801603:	90                   	nop
+  return (char *)s;
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+
+000000000080160a <memset>:
+memset(void *v, int c, size_t n) {
+  80160a:	55                   	push   %rbp
+  80160b:	48 89 e5             	mov    %rsp,%rbp
+  80160e:	48 83 ec 38          	sub    $0x38,%rsp
+  801612:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801616:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801619:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80161d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801621:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801625:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80162a:	76 41                	jbe    80166d <memset+0x63>
+  80162c:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801633:	00 00 00 
+  801636:	ff d0                	call   *%rax
+  801638:	83 e0 01             	and    $0x1,%eax
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	74 2e                	je     80166d <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80163f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801642:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801646:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80164a:	48 89 ce             	mov    %rcx,%rsi
+  80164d:	48 89 f7             	mov    %rsi,%rdi
+  801650:	48 89 d1             	mov    %rdx,%rcx
+  801653:	fc                   	cld
+  801654:	f3 aa                	rep stos %al,%es:(%rdi)
+  801656:	48 89 ca             	mov    %rcx,%rdx
+  801659:	48 89 fe             	mov    %rdi,%rsi
+  80165c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801660:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801664:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801668:	e9 a7 00 00 00       	jmp    801714 <memset+0x10a>
+  if (n >= 8) {
+  80166d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801672:	0f 86 87 00 00 00    	jbe    8016ff <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801678:	eb 16                	jmp    801690 <memset+0x86>
+      *p++ = c;
+  80167a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801682:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801686:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801689:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80168b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801694:	83 e0 07             	and    $0x7,%eax
+  801697:	48 85 c0             	test   %rax,%rax
+  80169a:	75 de                	jne    80167a <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80169c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80169f:	0f b6 c0             	movzbl %al,%eax
+  8016a2:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016a9:	01 01 01 
+  8016ac:	48 0f af c2          	imul   %rdx,%rax
+  8016b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016b8:	48 c1 e8 03          	shr    $0x3,%rax
+  8016bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016cc:	48 89 ce             	mov    %rcx,%rsi
+  8016cf:	48 89 f7             	mov    %rsi,%rdi
+  8016d2:	48 89 d1             	mov    %rdx,%rcx
+  8016d5:	fc                   	cld
+  8016d6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016d9:	48 89 ca             	mov    %rcx,%rdx
+  8016dc:	48 89 fe             	mov    %rdi,%rsi
+  8016df:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8016e7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8016ec:	eb 11                	jmp    8016ff <memset+0xf5>
+    *p++ = c;
+  8016ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016f6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016fa:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016fd:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8016ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801703:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801707:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80170b:	48 85 c0             	test   %rax,%rax
+  80170e:	75 de                	jne    8016ee <memset+0xe4>
+  return v;
+  801710:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+0000000000801716 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+  80171a:	48 83 ec 38          	sub    $0x38,%rsp
+  80171e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801722:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801726:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80172a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80172e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801732:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801736:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80173a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801742:	0f 83 da 00 00 00    	jae    801822 <memmove+0x10c>
+  801748:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80174c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801750:	48 01 d0             	add    %rdx,%rax
+  801753:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801757:	0f 83 c5 00 00 00    	jae    801822 <memmove+0x10c>
+    s += n;
+  80175d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801761:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801765:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801769:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80176d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801772:	0f 86 94 00 00 00    	jbe    80180c <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801778:	eb 1c                	jmp    801796 <memmove+0x80>
+        *--d = *--s;
+  80177a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80177f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801788:	0f b6 10             	movzbl (%rax),%edx
+  80178b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801791:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801796:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80179a:	83 e0 07             	and    $0x7,%eax
+  80179d:	48 85 c0             	test   %rax,%rax
+  8017a0:	75 d8                	jne    80177a <memmove+0x64>
+      nq = n / 8;
+  8017a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a6:	48 c1 e8 03          	shr    $0x3,%rax
+  8017aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017ae:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017b3:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017b8:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c9:	48 89 cf             	mov    %rcx,%rdi
+  8017cc:	48 89 d6             	mov    %rdx,%rsi
+  8017cf:	48 89 c1             	mov    %rax,%rcx
+  8017d2:	fd                   	std
+  8017d3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017d6:	fc                   	cld
+  8017d7:	48 89 c8             	mov    %rcx,%rax
+  8017da:	48 89 f2             	mov    %rsi,%rdx
+  8017dd:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8017e1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017e5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8017e9:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8017ee:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8017f3:	eb 17                	jmp    80180c <memmove+0xf6>
+      *--d = *--s;
+  8017f5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017fa:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801803:	0f b6 10             	movzbl (%rax),%edx
+  801806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180a:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80180c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801810:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801814:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801818:	48 85 c0             	test   %rax,%rax
+  80181b:	75 d8                	jne    8017f5 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80181d:	e9 f4 00 00 00       	jmp    801916 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801822:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801827:	76 46                	jbe    80186f <memmove+0x159>
+  801829:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801830:	00 00 00 
+  801833:	ff d0                	call   *%rax
+  801835:	83 e0 01             	and    $0x1,%eax
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	74 33                	je     80186f <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80183c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801840:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801844:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801848:	48 89 cf             	mov    %rcx,%rdi
+  80184b:	48 89 d6             	mov    %rdx,%rsi
+  80184e:	48 89 c1             	mov    %rax,%rcx
+  801851:	fc                   	cld
+  801852:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801854:	48 89 c8             	mov    %rcx,%rax
+  801857:	48 89 f2             	mov    %rsi,%rdx
+  80185a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80185e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801862:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801866:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80186a:	e9 ab 00 00 00       	jmp    80191a <memmove+0x204>
+    if (n >= 8) {
+  80186f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801874:	0f 86 8b 00 00 00    	jbe    801905 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80187a:	eb 22                	jmp    80189e <memmove+0x188>
+        *d++ = *s++;
+  80187c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801880:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801884:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801888:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801890:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801894:	0f b6 12             	movzbl (%rdx),%edx
+  801897:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801899:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80189e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a2:	83 e0 07             	and    $0x7,%eax
+  8018a5:	48 85 c0             	test   %rax,%rax
+  8018a8:	75 d2                	jne    80187c <memmove+0x166>
+      nq = n / 8;
+  8018aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ae:	48 c1 e8 03          	shr    $0x3,%rax
+  8018b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018b6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c2:	48 89 cf             	mov    %rcx,%rdi
+  8018c5:	48 89 d6             	mov    %rdx,%rsi
+  8018c8:	48 89 c1             	mov    %rax,%rcx
+  8018cb:	fc                   	cld
+  8018cc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018cf:	48 89 c8             	mov    %rcx,%rax
+  8018d2:	48 89 f2             	mov    %rsi,%rdx
+  8018d5:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018d9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018dd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018e1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8018e6:	eb 1d                	jmp    801905 <memmove+0x1ef>
+      *d++ = *s++;
+  8018e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018ec:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018fc:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801900:	0f b6 12             	movzbl (%rdx),%edx
+  801903:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801905:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801909:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80190d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801911:	48 85 c0             	test   %rax,%rax
+  801914:	75 d2                	jne    8018e8 <memmove+0x1d2>
+  return dst;
+  801916:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80191a:	c9                   	leave
+  80191b:	c3                   	ret
+
+000000000080191c <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	48 83 ec 18          	sub    $0x18,%rsp
+  801924:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801928:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80192c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801930:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801934:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801938:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193c:	48 89 ce             	mov    %rcx,%rsi
+  80193f:	48 89 c7             	mov    %rax,%rdi
+  801942:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  801949:	00 00 00 
+  80194c:	ff d0                	call   *%rax
+}
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+
+0000000000801950 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	48 83 ec 40          	sub    $0x40,%rsp
+  801958:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80195c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801960:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801964:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801968:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80196c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801970:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801974:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801979:	0f 86 a7 00 00 00    	jbe    801a26 <memcmp+0xd6>
+  80197f:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+  80198b:	83 e0 02             	and    $0x2,%eax
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	0f 84 90 00 00 00    	je     801a26 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801996:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80199a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80199e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a2:	48 89 ce             	mov    %rcx,%rsi
+  8019a5:	48 89 c7             	mov    %rax,%rdi
+  8019a8:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  8019af:	00 00 00 
+  8019b2:	ff d0                	call   *%rax
+  8019b4:	e9 c2 00 00 00       	jmp    801a7b <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bd:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019c1:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8019c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c9:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019cd:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8019d1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8019d8:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8019df:	74 36                	je     801a17 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8019e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019e4:	f7 d0                	not    %eax
+  8019e6:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8019ea:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8019ed:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8019f0:	48 63 d0             	movslq %eax,%rdx
+  8019f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f7:	48 01 d0             	add    %rdx,%rax
+  8019fa:	0f b6 00             	movzbl (%rax),%eax
+  8019fd:	0f b6 c0             	movzbl %al,%eax
+  801a00:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801a03:	48 63 ca             	movslq %edx,%rcx
+  801a06:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a0a:	48 01 ca             	add    %rcx,%rdx
+  801a0d:	0f b6 12             	movzbl (%rdx),%edx
+  801a10:	0f b6 d2             	movzbl %dl,%edx
+  801a13:	29 d0                	sub    %edx,%eax
+  801a15:	eb 64                	jmp    801a7b <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a17:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a1c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a21:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a26:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a2b:	77 8c                	ja     8019b9 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a2d:	eb 36                	jmp    801a65 <memcmp+0x115>
+    if (*s1 != *s2)
+  801a2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a33:	0f b6 10             	movzbl (%rax),%edx
+  801a36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a3a:	0f b6 00             	movzbl (%rax),%eax
+  801a3d:	38 c2                	cmp    %al,%dl
+  801a3f:	74 1a                	je     801a5b <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a45:	0f b6 00             	movzbl (%rax),%eax
+  801a48:	0f b6 c8             	movzbl %al,%ecx
+  801a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a4f:	0f b6 00             	movzbl (%rax),%eax
+  801a52:	0f b6 d0             	movzbl %al,%edx
+  801a55:	89 c8                	mov    %ecx,%eax
+  801a57:	29 d0                	sub    %edx,%eax
+  801a59:	eb 20                	jmp    801a7b <memcmp+0x12b>
+    s1++, s2++;
+  801a5b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a60:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801a65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a69:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a71:	48 85 c0             	test   %rax,%rax
+  801a74:	75 b9                	jne    801a2f <memcmp+0xdf>
+  }
+
+  return 0;
+  801a76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+0000000000801a7d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+  801a81:	48 83 ec 50          	sub    $0x50,%rsp
+  801a85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801a89:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801a8c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801a90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a94:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a98:	48 01 d0             	add    %rdx,%rax
+  801a9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801a9f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801aa2:	66 0f 6e c0          	movd   %eax,%xmm0
+  801aa6:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801aaa:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801aae:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801ab3:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ab7:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801abc:	76 73                	jbe    801b31 <memfind+0xb4>
+  801abe:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801ac5:	00 00 00 
+  801ac8:	ff d0                	call   *%rax
+  801aca:	83 e0 02             	and    $0x2,%eax
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	74 60                	je     801b31 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801ad1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ad4:	0f b6 c8             	movzbl %al,%ecx
+  801ad7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801adb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801adf:	89 ce                	mov    %ecx,%esi
+  801ae1:	48 89 c7             	mov    %rax,%rdi
+  801ae4:	48 b8 26 10 80 00 00 	movabs $0x801026,%rax
+  801aeb:	00 00 00 
+  801aee:	ff d0                	call   *%rax
+  801af0:	eb 6c                	jmp    801b5e <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801af2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801af6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801afa:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801afe:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801b03:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b07:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b0b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b0e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b12:	74 13                	je     801b27 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b14:	31 c0                	xor    %eax,%eax
+  801b16:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b1b:	48 63 d0             	movslq %eax,%rdx
+  801b1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b22:	48 01 d0             	add    %rdx,%rax
+  801b25:	eb 37                	jmp    801b5e <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b27:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b2c:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b31:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b36:	77 ba                	ja     801af2 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b38:	eb 13                	jmp    801b4d <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3e:	0f b6 00             	movzbl (%rax),%eax
+  801b41:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b44:	38 d0                	cmp    %dl,%al
+  801b46:	74 11                	je     801b59 <memfind+0xdc>
+  for (; s < ends; s++)
+  801b48:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b51:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b55:	72 e3                	jb     801b3a <memfind+0xbd>
+  801b57:	eb 01                	jmp    801b5a <memfind+0xdd>
+      break;
+  801b59:	90                   	nop
+  return (void *)s;
+  801b5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+0000000000801b60 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b60:	55                   	push   %rbp
+  801b61:	48 89 e5             	mov    %rsp,%rbp
+  801b64:	48 83 ec 38          	sub    $0x38,%rsp
+  801b68:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b6c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b70:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801b73:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801b7a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b81:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801b82:	eb 05                	jmp    801b89 <strtol+0x29>
+    s++;
+  801b84:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801b89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8d:	0f b6 00             	movzbl (%rax),%eax
+  801b90:	3c 20                	cmp    $0x20,%al
+  801b92:	74 f0                	je     801b84 <strtol+0x24>
+  801b94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b98:	0f b6 00             	movzbl (%rax),%eax
+  801b9b:	3c 09                	cmp    $0x9,%al
+  801b9d:	74 e5                	je     801b84 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801b9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ba3:	0f b6 00             	movzbl (%rax),%eax
+  801ba6:	3c 2b                	cmp    $0x2b,%al
+  801ba8:	75 07                	jne    801bb1 <strtol+0x51>
+    s++;
+  801baa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801baf:	eb 17                	jmp    801bc8 <strtol+0x68>
+  else if (*s == '-')
+  801bb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb5:	0f b6 00             	movzbl (%rax),%eax
+  801bb8:	3c 2d                	cmp    $0x2d,%al
+  801bba:	75 0c                	jne    801bc8 <strtol+0x68>
+    s++, neg = 1;
+  801bbc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bc1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bc8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bcc:	74 06                	je     801bd4 <strtol+0x74>
+  801bce:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bd2:	75 28                	jne    801bfc <strtol+0x9c>
+  801bd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd8:	0f b6 00             	movzbl (%rax),%eax
+  801bdb:	3c 30                	cmp    $0x30,%al
+  801bdd:	75 1d                	jne    801bfc <strtol+0x9c>
+  801bdf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be3:	48 83 c0 01          	add    $0x1,%rax
+  801be7:	0f b6 00             	movzbl (%rax),%eax
+  801bea:	3c 78                	cmp    $0x78,%al
+  801bec:	75 0e                	jne    801bfc <strtol+0x9c>
+    s += 2, base = 16;
+  801bee:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bf3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bfa:	eb 2c                	jmp    801c28 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801bfc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c00:	75 19                	jne    801c1b <strtol+0xbb>
+  801c02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c06:	0f b6 00             	movzbl (%rax),%eax
+  801c09:	3c 30                	cmp    $0x30,%al
+  801c0b:	75 0e                	jne    801c1b <strtol+0xbb>
+    s++, base = 8;
+  801c0d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c12:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c19:	eb 0d                	jmp    801c28 <strtol+0xc8>
+  else if (base == 0)
+  801c1b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c1f:	75 07                	jne    801c28 <strtol+0xc8>
+    base = 10;
+  801c21:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2c:	0f b6 00             	movzbl (%rax),%eax
+  801c2f:	3c 2f                	cmp    $0x2f,%al
+  801c31:	7e 1d                	jle    801c50 <strtol+0xf0>
+  801c33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c37:	0f b6 00             	movzbl (%rax),%eax
+  801c3a:	3c 39                	cmp    $0x39,%al
+  801c3c:	7f 12                	jg     801c50 <strtol+0xf0>
+      dig = *s - '0';
+  801c3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c42:	0f b6 00             	movzbl (%rax),%eax
+  801c45:	0f be c0             	movsbl %al,%eax
+  801c48:	83 e8 30             	sub    $0x30,%eax
+  801c4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c4e:	eb 4e                	jmp    801c9e <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c54:	0f b6 00             	movzbl (%rax),%eax
+  801c57:	3c 60                	cmp    $0x60,%al
+  801c59:	7e 1d                	jle    801c78 <strtol+0x118>
+  801c5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5f:	0f b6 00             	movzbl (%rax),%eax
+  801c62:	3c 7a                	cmp    $0x7a,%al
+  801c64:	7f 12                	jg     801c78 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801c66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6a:	0f b6 00             	movzbl (%rax),%eax
+  801c6d:	0f be c0             	movsbl %al,%eax
+  801c70:	83 e8 57             	sub    $0x57,%eax
+  801c73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c76:	eb 26                	jmp    801c9e <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801c78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7c:	0f b6 00             	movzbl (%rax),%eax
+  801c7f:	3c 40                	cmp    $0x40,%al
+  801c81:	7e 47                	jle    801cca <strtol+0x16a>
+  801c83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c87:	0f b6 00             	movzbl (%rax),%eax
+  801c8a:	3c 5a                	cmp    $0x5a,%al
+  801c8c:	7f 3c                	jg     801cca <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801c8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c92:	0f b6 00             	movzbl (%rax),%eax
+  801c95:	0f be c0             	movsbl %al,%eax
+  801c98:	83 e8 37             	sub    $0x37,%eax
+  801c9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801c9e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ca1:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ca4:	7d 23                	jge    801cc9 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ca6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cae:	48 98                	cltq
+  801cb0:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cb5:	48 89 c2             	mov    %rax,%rdx
+  801cb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cbb:	48 98                	cltq
+  801cbd:	48 01 d0             	add    %rdx,%rax
+  801cc0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cc4:	e9 5f ff ff ff       	jmp    801c28 <strtol+0xc8>
+      break;
+  801cc9:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801cca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ccf:	74 0b                	je     801cdc <strtol+0x17c>
+    *endptr = (char *)s;
+  801cd1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cd9:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801cdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ce0:	74 09                	je     801ceb <strtol+0x18b>
+  801ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce6:	48 f7 d8             	neg    %rax
+  801ce9:	eb 04                	jmp    801cef <strtol+0x18f>
+  801ceb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cef:	c9                   	leave
+  801cf0:	c3                   	ret
+
+0000000000801cf1 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801cf1:	55                   	push   %rbp
+  801cf2:	48 89 e5             	mov    %rsp,%rbp
+  801cf5:	53                   	push   %rbx
+  801cf6:	48 83 ec 48          	sub    $0x48,%rsp
+  801cfa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cfe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d02:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d06:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d0a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d0e:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d16:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d1a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d1e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d22:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d26:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d2a:	4c 89 c3             	mov    %r8,%rbx
+  801d2d:	cd 30                	int    $0x30
+  801d2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d33:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d38:	74 46                	je     801d80 <syscall+0x8f>
+  801d3a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d3f:	7e 3f                	jle    801d80 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d49:	49 89 d0             	mov    %rdx,%r8
+  801d4c:	48 89 c1             	mov    %rax,%rcx
+  801d4f:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801d56:	00 00 00 
+  801d59:	48 89 c2             	mov    %rax,%rdx
+  801d5c:	be 22 00 00 00       	mov    $0x22,%esi
+  801d61:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801d68:	00 00 00 
+  801d6b:	48 89 c7             	mov    %rax,%rdi
+  801d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d73:	49 b9 31 4b 80 00 00 	movabs $0x804b31,%r9
+  801d7a:	00 00 00 
+  801d7d:	41 ff d1             	call   *%r9
+
+  return ret;
+  801d80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d88:	c9                   	leave
+  801d89:	c3                   	ret
+
+0000000000801d8a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d8a:	55                   	push   %rbp
+  801d8b:	48 89 e5             	mov    %rsp,%rbp
+  801d8e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d96:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da2:	48 83 ec 08          	sub    $0x8,%rsp
+  801da6:	6a 00                	push   $0x0
+  801da8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db4:	48 89 d1             	mov    %rdx,%rcx
+  801db7:	48 89 c2             	mov    %rax,%rdx
+  801dba:	be 00 00 00 00       	mov    $0x0,%esi
+  801dbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc4:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  801dd0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dd4:	90                   	nop
+  801dd5:	c9                   	leave
+  801dd6:	c3                   	ret
+
+0000000000801dd7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801dd7:	55                   	push   %rbp
+  801dd8:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ddb:	48 83 ec 08          	sub    $0x8,%rsp
+  801ddf:	6a 00                	push   $0x0
+  801de1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801df2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfc:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e01:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e11:	c9                   	leave
+  801e12:	c3                   	ret
+
+0000000000801e13 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e13:	55                   	push   %rbp
+  801e14:	48 89 e5             	mov    %rsp,%rbp
+  801e17:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e21:	48 98                	cltq
+  801e23:	48 83 ec 08          	sub    $0x8,%rsp
+  801e27:	6a 00                	push   $0x0
+  801e29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e3a:	48 89 c2             	mov    %rax,%rdx
+  801e3d:	be 01 00 00 00       	mov    $0x1,%esi
+  801e42:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e47:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e57:	c9                   	leave
+  801e58:	c3                   	ret
+
+0000000000801e59 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e59:	55                   	push   %rbp
+  801e5a:	48 89 e5             	mov    %rsp,%rbp
+  801e5d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e61:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e67:	48 98                	cltq
+  801e69:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6d:	6a 00                	push   $0x0
+  801e6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e80:	48 89 c2             	mov    %rax,%rdx
+  801e83:	be 00 00 00 00       	mov    $0x0,%esi
+  801e88:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e8d:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801e94:	00 00 00 
+  801e97:	ff d0                	call   *%rax
+  801e99:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e9d:	90                   	nop
+  801e9e:	c9                   	leave
+  801e9f:	c3                   	ret
+
+0000000000801ea0 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801ea0:	55                   	push   %rbp
+  801ea1:	48 89 e5             	mov    %rsp,%rbp
+  801ea4:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801eab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801eaf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eb2:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801eb5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eba:	cd 30                	int    $0x30
+  801ebc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ec0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801ec4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801ec9:	7e 3d                	jle    801f08 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801ecb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ecf:	49 89 c0             	mov    %rax,%r8
+  801ed2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ed7:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801ede:	00 00 00 
+  801ee1:	48 89 c2             	mov    %rax,%rdx
+  801ee4:	be 49 00 00 00       	mov    $0x49,%esi
+  801ee9:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801ef0:	00 00 00 
+  801ef3:	48 89 c7             	mov    %rax,%rdi
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	49 b9 31 4b 80 00 00 	movabs $0x804b31,%r9
+  801f02:	00 00 00 
+  801f05:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f08:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f0d:	75 13                	jne    801f22 <sys_env_wait+0x82>
+  801f0f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f14:	74 0c                	je     801f22 <sys_env_wait+0x82>
+    *status = st;
+  801f16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f1a:	89 c2                	mov    %eax,%edx
+  801f1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f20:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+0000000000801f28 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f28:	55                   	push   %rbp
+  801f29:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f2c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f30:	6a 00                	push   $0x0
+  801f32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f48:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f52:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+  801f5e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f62:	c9                   	leave
+  801f63:	c3                   	ret
+
+0000000000801f64 <sys_yield>:
+
+void
+sys_yield(void) {
+  801f64:	55                   	push   %rbp
+  801f65:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f68:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6c:	6a 00                	push   $0x0
+  801f6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f84:	be 00 00 00 00       	mov    $0x0,%esi
+  801f89:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f8e:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+  801f9a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f9e:	90                   	nop
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+0000000000801fa1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801fa1:	55                   	push   %rbp
+  801fa2:	48 89 e5             	mov    %rsp,%rbp
+  801fa5:	48 83 ec 20          	sub    $0x20,%rsp
+  801fa9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801fb0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fb3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fb6:	48 63 c8             	movslq %eax,%rcx
+  801fb9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fc0:	48 98                	cltq
+  801fc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc6:	6a 00                	push   $0x0
+  801fc8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fce:	49 89 c8             	mov    %rcx,%r8
+  801fd1:	48 89 d1             	mov    %rdx,%rcx
+  801fd4:	48 89 c2             	mov    %rax,%rdx
+  801fd7:	be 01 00 00 00       	mov    $0x1,%esi
+  801fdc:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fe1:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+  801fed:	48 83 c4 10          	add    $0x10,%rsp
+  801ff1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  801ff4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801ff7:	c9                   	leave
+  801ff8:	c3                   	ret
+
+0000000000801ff9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801ff9:	55                   	push   %rbp
+  801ffa:	48 89 e5             	mov    %rsp,%rbp
+  801ffd:	48 83 ec 20          	sub    $0x20,%rsp
+  802001:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802004:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802008:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80200b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80200f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802013:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802016:	48 63 c8             	movslq %eax,%rcx
+  802019:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80201d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802020:	48 63 f0             	movslq %eax,%rsi
+  802023:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802027:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80202a:	48 98                	cltq
+  80202c:	48 83 ec 08          	sub    $0x8,%rsp
+  802030:	51                   	push   %rcx
+  802031:	49 89 f9             	mov    %rdi,%r9
+  802034:	49 89 f0             	mov    %rsi,%r8
+  802037:	48 89 d1             	mov    %rdx,%rcx
+  80203a:	48 89 c2             	mov    %rax,%rdx
+  80203d:	be 01 00 00 00       	mov    $0x1,%esi
+  802042:	bf 07 00 00 00       	mov    $0x7,%edi
+  802047:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  80204e:	00 00 00 
+  802051:	ff d0                	call   *%rax
+  802053:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802057:	c9                   	leave
+  802058:	c3                   	ret
+
+0000000000802059 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802059:	55                   	push   %rbp
+  80205a:	48 89 e5             	mov    %rsp,%rbp
+  80205d:	48 83 ec 10          	sub    $0x10,%rsp
+  802061:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802064:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802068:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80206c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80206f:	48 98                	cltq
+  802071:	48 83 ec 08          	sub    $0x8,%rsp
+  802075:	6a 00                	push   $0x0
+  802077:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80207d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802083:	48 89 d1             	mov    %rdx,%rcx
+  802086:	48 89 c2             	mov    %rax,%rdx
+  802089:	be 01 00 00 00       	mov    $0x1,%esi
+  80208e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802093:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  80209a:	00 00 00 
+  80209d:	ff d0                	call   *%rax
+  80209f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+
+00000000008020a5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8020a5:	55                   	push   %rbp
+  8020a6:	48 89 e5             	mov    %rsp,%rbp
+  8020a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020b0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020b3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020b6:	48 63 d0             	movslq %eax,%rdx
+  8020b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020bc:	48 98                	cltq
+  8020be:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c2:	6a 00                	push   $0x0
+  8020c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d0:	48 89 d1             	mov    %rdx,%rcx
+  8020d3:	48 89 c2             	mov    %rax,%rdx
+  8020d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8020db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020e0:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+
+00000000008020f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020f2:	55                   	push   %rbp
+  8020f3:	48 89 e5             	mov    %rsp,%rbp
+  8020f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8020fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802101:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802105:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802108:	48 98                	cltq
+  80210a:	48 83 ec 08          	sub    $0x8,%rsp
+  80210e:	6a 00                	push   $0x0
+  802110:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802116:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80211c:	48 89 d1             	mov    %rdx,%rcx
+  80211f:	48 89 c2             	mov    %rax,%rdx
+  802122:	be 01 00 00 00       	mov    $0x1,%esi
+  802127:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80212c:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+  802138:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+000000000080213e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80213e:	55                   	push   %rbp
+  80213f:	48 89 e5             	mov    %rsp,%rbp
+  802142:	48 83 ec 10          	sub    $0x10,%rsp
+  802146:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802149:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80214d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802151:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802154:	48 98                	cltq
+  802156:	48 83 ec 08          	sub    $0x8,%rsp
+  80215a:	6a 00                	push   $0x0
+  80215c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802168:	48 89 d1             	mov    %rdx,%rcx
+  80216b:	48 89 c2             	mov    %rax,%rdx
+  80216e:	be 01 00 00 00       	mov    $0x1,%esi
+  802173:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802178:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+  802184:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802188:	c9                   	leave
+  802189:	c3                   	ret
+
+000000000080218a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80218a:	55                   	push   %rbp
+  80218b:	48 89 e5             	mov    %rsp,%rbp
+  80218e:	48 83 ec 20          	sub    $0x20,%rsp
+  802192:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802195:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802199:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80219d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8021a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021a3:	48 63 f0             	movslq %eax,%rsi
+  8021a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021b1:	48 98                	cltq
+  8021b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b7:	6a 00                	push   $0x0
+  8021b9:	49 89 f1             	mov    %rsi,%r9
+  8021bc:	49 89 c8             	mov    %rcx,%r8
+  8021bf:	48 89 d1             	mov    %rdx,%rcx
+  8021c2:	48 89 c2             	mov    %rax,%rdx
+  8021c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ca:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8021cf:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+  8021db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+00000000008021e1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8021e1:	55                   	push   %rbp
+  8021e2:	48 89 e5             	mov    %rsp,%rbp
+  8021e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8021ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f5:	6a 00                	push   $0x0
+  8021f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802203:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802208:	48 89 c2             	mov    %rax,%rdx
+  80220b:	be 01 00 00 00       	mov    $0x1,%esi
+  802210:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802215:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802225:	c9                   	leave
+  802226:	c3                   	ret
+
+0000000000802227 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802227:	55                   	push   %rbp
+  802228:	48 89 e5             	mov    %rsp,%rbp
+  80222b:	48 83 ec 10          	sub    $0x10,%rsp
+  80222f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802233:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802237:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80223b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80223f:	48 83 ec 08          	sub    $0x8,%rsp
+  802243:	6a 00                	push   $0x0
+  802245:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802251:	48 89 d1             	mov    %rdx,%rcx
+  802254:	48 89 c2             	mov    %rax,%rdx
+  802257:	be 01 00 00 00       	mov    $0x1,%esi
+  80225c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802261:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+  80226d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+0000000000802273 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802277:	48 83 ec 08          	sub    $0x8,%rsp
+  80227b:	6a 00                	push   $0x0
+  80227d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802283:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802289:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802293:	be 00 00 00 00       	mov    $0x0,%esi
+  802298:	bf 11 00 00 00       	mov    $0x11,%edi
+  80229d:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+00000000008022af <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d9:	48 89 d1             	mov    %rdx,%rcx
+  8022dc:	48 89 c2             	mov    %rax,%rdx
+  8022df:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e4:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022e9:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+  8022f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f9:	c9                   	leave
+  8022fa:	c3                   	ret
+
+00000000008022fb <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8022fb:	55                   	push   %rbp
+  8022fc:	48 89 e5             	mov    %rsp,%rbp
+  8022ff:	48 83 ec 20          	sub    $0x20,%rsp
+  802303:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802307:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80230b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80230e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802311:	48 63 c8             	movslq %eax,%rcx
+  802314:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231c:	48 83 ec 08          	sub    $0x8,%rsp
+  802320:	6a 00                	push   $0x0
+  802322:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802328:	49 89 c8             	mov    %rcx,%r8
+  80232b:	48 89 d1             	mov    %rdx,%rcx
+  80232e:	48 89 c2             	mov    %rax,%rdx
+  802331:	be 00 00 00 00       	mov    $0x0,%esi
+  802336:	bf 13 00 00 00       	mov    $0x13,%edi
+  80233b:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+000000000080234d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+  802351:	48 83 ec 20          	sub    $0x20,%rsp
+  802355:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802359:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80235c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802360:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802364:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802367:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80236b:	48 83 ec 08          	sub    $0x8,%rsp
+  80236f:	6a 00                	push   $0x0
+  802371:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802377:	49 89 c8             	mov    %rcx,%r8
+  80237a:	48 89 d1             	mov    %rdx,%rcx
+  80237d:	48 89 c2             	mov    %rax,%rdx
+  802380:	be 00 00 00 00       	mov    $0x0,%esi
+  802385:	bf 14 00 00 00       	mov    $0x14,%edi
+  80238a:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+  802396:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+000000000080239c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8023ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023ae:	48 63 d0             	movslq %eax,%rdx
+  8023b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b9:	6a 00                	push   $0x0
+  8023bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c7:	48 89 d1             	mov    %rdx,%rcx
+  8023ca:	48 89 c2             	mov    %rax,%rdx
+  8023cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d2:	bf 15 00 00 00       	mov    $0x15,%edi
+  8023d7:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8023de:	00 00 00 
+  8023e1:	ff d0                	call   *%rax
+  8023e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+00000000008023e9 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8023f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023f5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023f8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8023fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8023ff:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802403:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802406:	48 63 c8             	movslq %eax,%rcx
+  802409:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80240c:	48 63 d0             	movslq %eax,%rdx
+  80240f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802413:	48 83 ec 08          	sub    $0x8,%rsp
+  802417:	6a 00                	push   $0x0
+  802419:	49 89 f1             	mov    %rsi,%r9
+  80241c:	49 89 c8             	mov    %rcx,%r8
+  80241f:	48 89 d1             	mov    %rdx,%rcx
+  802422:	48 89 c2             	mov    %rax,%rdx
+  802425:	be 00 00 00 00       	mov    $0x0,%esi
+  80242a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80242f:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+  80243b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243f:	c9                   	leave
+  802440:	c3                   	ret
+
+0000000000802441 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802441:	55                   	push   %rbp
+  802442:	48 89 e5             	mov    %rsp,%rbp
+  802445:	48 83 ec 30          	sub    $0x30,%rsp
+  802449:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80244d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802451:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802455:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802459:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80245d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802461:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802465:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802469:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80246d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802471:	48 83 ec 08          	sub    $0x8,%rsp
+  802475:	51                   	push   %rcx
+  802476:	49 89 f9             	mov    %rdi,%r9
+  802479:	49 89 f0             	mov    %rsi,%r8
+  80247c:	48 89 d1             	mov    %rdx,%rcx
+  80247f:	48 89 c2             	mov    %rax,%rdx
+  802482:	be 00 00 00 00       	mov    $0x0,%esi
+  802487:	bf 17 00 00 00       	mov    $0x17,%edi
+  80248c:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+  802498:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249c:	c9                   	leave
+  80249d:	c3                   	ret
+
+000000000080249e <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80249e:	55                   	push   %rbp
+  80249f:	48 89 e5             	mov    %rsp,%rbp
+  8024a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8024a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ac:	48 98                	cltq
+  8024ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b2:	6a 00                	push   $0x0
+  8024b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c5:	48 89 c2             	mov    %rax,%rdx
+  8024c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cd:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024d2:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e2:	90                   	nop
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+00000000008024e5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8024ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024f4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024f8:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8024fb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024fe:	48 63 f0             	movslq %eax,%rsi
+  802501:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802505:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802509:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80250c:	48 98                	cltq
+  80250e:	48 83 ec 08          	sub    $0x8,%rsp
+  802512:	6a 00                	push   $0x0
+  802514:	49 89 f1             	mov    %rsi,%r9
+  802517:	49 89 c8             	mov    %rcx,%r8
+  80251a:	48 89 d1             	mov    %rdx,%rcx
+  80251d:	48 89 c2             	mov    %rax,%rdx
+  802520:	be 01 00 00 00       	mov    $0x1,%esi
+  802525:	bf 19 00 00 00       	mov    $0x19,%edi
+  80252a:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	48 83 c4 10          	add    $0x10,%rsp
+  80253a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80253d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+0000000000802542 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	48 83 ec 20          	sub    $0x20,%rsp
+  80254a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80254e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802552:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802555:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802558:	48 63 c8             	movslq %eax,%rcx
+  80255b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80255f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802563:	48 83 ec 08          	sub    $0x8,%rsp
+  802567:	6a 00                	push   $0x0
+  802569:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80256f:	49 89 c8             	mov    %rcx,%r8
+  802572:	48 89 d1             	mov    %rdx,%rcx
+  802575:	48 89 c2             	mov    %rax,%rdx
+  802578:	be 01 00 00 00       	mov    $0x1,%esi
+  80257d:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802582:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+  80258e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802592:	c9                   	leave
+  802593:	c3                   	ret
+
+0000000000802594 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802594:	55                   	push   %rbp
+  802595:	48 89 e5             	mov    %rsp,%rbp
+  802598:	48 83 ec 20          	sub    $0x20,%rsp
+  80259c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025a4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8025a8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b8:	6a 00                	push   $0x0
+  8025ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c0:	49 89 c8             	mov    %rcx,%r8
+  8025c3:	48 89 d1             	mov    %rdx,%rcx
+  8025c6:	48 89 c2             	mov    %rax,%rdx
+  8025c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025ce:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8025d3:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  8025da:	00 00 00 
+  8025dd:	ff d0                	call   *%rax
+  8025df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e3:	c9                   	leave
+  8025e4:	c3                   	ret
+
+00000000008025e5 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+  8025e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025f5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8025f8:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8025fc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802600:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802603:	48 63 c8             	movslq %eax,%rcx
+  802606:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80260a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260e:	48 83 ec 08          	sub    $0x8,%rsp
+  802612:	6a 00                	push   $0x0
+  802614:	49 89 f1             	mov    %rsi,%r9
+  802617:	49 89 c8             	mov    %rcx,%r8
+  80261a:	48 89 d1             	mov    %rdx,%rcx
+  80261d:	48 89 c2             	mov    %rax,%rdx
+  802620:	be 01 00 00 00       	mov    $0x1,%esi
+  802625:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80262a:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+  802636:	48 83 c4 10          	add    $0x10,%rsp
+  80263a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80263d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802640:	c9                   	leave
+  802641:	c3                   	ret
+
+0000000000802642 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802642:	55                   	push   %rbp
+  802643:	48 89 e5             	mov    %rsp,%rbp
+  802646:	48 83 ec 10          	sub    $0x10,%rsp
+  80264a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80264d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802650:	48 98                	cltq
+  802652:	48 83 ec 08          	sub    $0x8,%rsp
+  802656:	6a 00                	push   $0x0
+  802658:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802669:	48 89 c2             	mov    %rax,%rdx
+  80266c:	be 01 00 00 00       	mov    $0x1,%esi
+  802671:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802676:	48 b8 f1 1c 80 00 00 	movabs $0x801cf1,%rax
+  80267d:	00 00 00 
+  802680:	ff d0                	call   *%rax
+  802682:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+
+0000000000802688 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802688:	55                   	push   %rbp
+  802689:	48 89 e5             	mov    %rsp,%rbp
+  80268c:	48 83 ec 08          	sub    $0x8,%rsp
+  802690:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802694:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802698:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80269f:	ff ff ff 
+  8026a2:	48 01 d0             	add    %rdx,%rax
+  8026a5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+
+00000000008026ab <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8026ab:	55                   	push   %rbp
+  8026ac:	48 89 e5             	mov    %rsp,%rbp
+  8026af:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026bb:	48 89 c7             	mov    %rax,%rdi
+  8026be:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  8026c5:	00 00 00 
+  8026c8:	ff d0                	call   *%rax
+  8026ca:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8026d0:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8026d4:	c9                   	leave
+  8026d5:	c3                   	ret
+
+00000000008026d6 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8026d6:	55                   	push   %rbp
+  8026d7:	48 89 e5             	mov    %rsp,%rbp
+  8026da:	48 83 ec 18          	sub    $0x18,%rsp
+  8026de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8026e2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026e9:	e9 ae 00 00 00       	jmp    80279c <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8026ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026f1:	c1 e0 0c             	shl    $0xc,%eax
+  8026f4:	48 98                	cltq
+  8026f6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026fb:	48 01 d0             	add    %rdx,%rax
+  8026fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802702:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802706:	48 c1 e8 27          	shr    $0x27,%rax
+  80270a:	48 89 c2             	mov    %rax,%rdx
+  80270d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802714:	01 00 00 
+  802717:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80271b:	83 e0 01             	and    $0x1,%eax
+  80271e:	48 85 c0             	test   %rax,%rax
+  802721:	74 63                	je     802786 <fd_alloc+0xb0>
+  802723:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802727:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80272b:	48 89 c2             	mov    %rax,%rdx
+  80272e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802735:	01 00 00 
+  802738:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80273c:	83 e0 01             	and    $0x1,%eax
+  80273f:	48 85 c0             	test   %rax,%rax
+  802742:	74 42                	je     802786 <fd_alloc+0xb0>
+  802744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802748:	48 c1 e8 15          	shr    $0x15,%rax
+  80274c:	48 89 c2             	mov    %rax,%rdx
+  80274f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802756:	01 00 00 
+  802759:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80275d:	83 e0 01             	and    $0x1,%eax
+  802760:	48 85 c0             	test   %rax,%rax
+  802763:	74 21                	je     802786 <fd_alloc+0xb0>
+  802765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802769:	48 c1 e8 0c          	shr    $0xc,%rax
+  80276d:	48 89 c2             	mov    %rax,%rdx
+  802770:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802777:	01 00 00 
+  80277a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80277e:	83 e0 01             	and    $0x1,%eax
+  802781:	48 85 c0             	test   %rax,%rax
+  802784:	75 12                	jne    802798 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802786:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80278a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80278e:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+  802796:	eb 1e                	jmp    8027b6 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802798:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80279c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8027a0:	0f 8e 48 ff ff ff    	jle    8026ee <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8027a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027aa:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027b1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+
+00000000008027b8 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027b8:	55                   	push   %rbp
+  8027b9:	48 89 e5             	mov    %rsp,%rbp
+  8027bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8027c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8027c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027cb:	78 06                	js     8027d3 <fd_lookup+0x1b>
+  8027cd:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8027d1:	7e 0a                	jle    8027dd <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8027d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d8:	e9 af 00 00 00       	jmp    80288c <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8027dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027e0:	c1 e0 0c             	shl    $0xc,%eax
+  8027e3:	48 98                	cltq
+  8027e5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027ea:	48 01 d0             	add    %rdx,%rax
+  8027ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8027f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f5:	48 c1 e8 27          	shr    $0x27,%rax
+  8027f9:	48 89 c2             	mov    %rax,%rdx
+  8027fc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802803:	01 00 00 
+  802806:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80280a:	83 e0 01             	and    $0x1,%eax
+  80280d:	48 85 c0             	test   %rax,%rax
+  802810:	74 63                	je     802875 <fd_lookup+0xbd>
+  802812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802816:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80281a:	48 89 c2             	mov    %rax,%rdx
+  80281d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802824:	01 00 00 
+  802827:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80282b:	83 e0 01             	and    $0x1,%eax
+  80282e:	48 85 c0             	test   %rax,%rax
+  802831:	74 42                	je     802875 <fd_lookup+0xbd>
+  802833:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802837:	48 c1 e8 15          	shr    $0x15,%rax
+  80283b:	48 89 c2             	mov    %rax,%rdx
+  80283e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802845:	01 00 00 
+  802848:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80284c:	83 e0 01             	and    $0x1,%eax
+  80284f:	48 85 c0             	test   %rax,%rax
+  802852:	74 21                	je     802875 <fd_lookup+0xbd>
+  802854:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802858:	48 c1 e8 0c          	shr    $0xc,%rax
+  80285c:	48 89 c2             	mov    %rax,%rdx
+  80285f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802866:	01 00 00 
+  802869:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80286d:	83 e0 01             	and    $0x1,%eax
+  802870:	48 85 c0             	test   %rax,%rax
+  802873:	75 07                	jne    80287c <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802875:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287a:	eb 10                	jmp    80288c <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80287c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802880:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802884:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802887:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288c:	c9                   	leave
+  80288d:	c3                   	ret
+
+000000000080288e <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80288e:	55                   	push   %rbp
+  80288f:	48 89 e5             	mov    %rsp,%rbp
+  802892:	48 83 ec 30          	sub    $0x30,%rsp
+  802896:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80289a:	89 f0                	mov    %esi,%eax
+  80289c:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80289f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a3:	48 89 c7             	mov    %rax,%rdi
+  8028a6:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  8028ad:	00 00 00 
+  8028b0:	ff d0                	call   *%rax
+  8028b2:	89 c2                	mov    %eax,%edx
+  8028b4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028b8:	48 89 c6             	mov    %rax,%rsi
+  8028bb:	89 d7                	mov    %edx,%edi
+  8028bd:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+  8028c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028d0:	78 0a                	js     8028dc <fd_close+0x4e>
+  8028d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8028da:	74 12                	je     8028ee <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8028dc:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8028e0:	74 05                	je     8028e7 <fd_close+0x59>
+  8028e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028e5:	eb 70                	jmp    802957 <fd_close+0xc9>
+  8028e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ec:	eb 69                	jmp    802957 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028f2:	8b 00                	mov    (%rax),%eax
+  8028f4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028f8:	48 89 d6             	mov    %rdx,%rsi
+  8028fb:	89 c7                	mov    %eax,%edi
+  8028fd:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  802904:	00 00 00 
+  802907:	ff d0                	call   *%rax
+  802909:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80290c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802910:	78 2a                	js     80293c <fd_close+0xae>
+    if (dev->dev_close)
+  802912:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802916:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80291a:	48 85 c0             	test   %rax,%rax
+  80291d:	74 16                	je     802935 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80291f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802923:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802927:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80292b:	48 89 c7             	mov    %rax,%rdi
+  80292e:	ff d2                	call   *%rdx
+  802930:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802933:	eb 07                	jmp    80293c <fd_close+0xae>
+    else
+      r = 0;
+  802935:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80293c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802940:	48 89 c6             	mov    %rax,%rsi
+  802943:	bf 00 00 00 00       	mov    $0x0,%edi
+  802948:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  80294f:	00 00 00 
+  802952:	ff d0                	call   *%rax
+  return r;
+  802954:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802957:	c9                   	leave
+  802958:	c3                   	ret
+
+0000000000802959 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802959:	55                   	push   %rbp
+  80295a:	48 89 e5             	mov    %rsp,%rbp
+  80295d:	48 83 ec 20          	sub    $0x20,%rsp
+  802961:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802964:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802968:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80296f:	eb 3f                	jmp    8029b0 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802971:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802978:	00 00 00 
+  80297b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80297e:	48 98                	cltq
+  802980:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802984:	8b 00                	mov    (%rax),%eax
+  802986:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802989:	75 21                	jne    8029ac <dev_lookup+0x53>
+      *dev = devtab[i];
+  80298b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802992:	00 00 00 
+  802995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802998:	48 98                	cltq
+  80299a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80299e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029a2:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8029a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029aa:	eb 7f                	jmp    802a2b <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029b0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029b7:	00 00 00 
+  8029ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029bd:	48 98                	cltq
+  8029bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029c3:	48 85 c0             	test   %rax,%rax
+  8029c6:	75 a9                	jne    802971 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8029c8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8029cf:	00 00 00 
+  8029d2:	8b 40 04             	mov    0x4(%rax),%eax
+  8029d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029da:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029e1:	00 00 00 
+  8029e4:	48 98                	cltq
+  8029e6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029ed:	48 01 d0             	add    %rdx,%rax
+  8029f0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029f6:	8b 00                	mov    (%rax),%eax
+  8029f8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029fb:	89 c6                	mov    %eax,%esi
+  8029fd:	48 b8 38 55 80 00 00 	movabs $0x805538,%rax
+  802a04:	00 00 00 
+  802a07:	48 89 c7             	mov    %rax,%rdi
+  802a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0f:	48 b9 23 02 80 00 00 	movabs $0x800223,%rcx
+  802a16:	00 00 00 
+  802a19:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a1f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+0000000000802a2d <close>:
+
+int
+close(int fdnum) {
+  802a2d:	55                   	push   %rbp
+  802a2e:	48 89 e5             	mov    %rsp,%rbp
+  802a31:	48 83 ec 20          	sub    $0x20,%rsp
+  802a35:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a38:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a3f:	48 89 d6             	mov    %rdx,%rsi
+  802a42:	89 c7                	mov    %eax,%edi
+  802a44:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802a4b:	00 00 00 
+  802a4e:	ff d0                	call   *%rax
+  802a50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a57:	79 05                	jns    802a5e <close+0x31>
+    return r;
+  802a59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a5c:	eb 18                	jmp    802a76 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a62:	be 01 00 00 00       	mov    $0x1,%esi
+  802a67:	48 89 c7             	mov    %rax,%rdi
+  802a6a:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  802a71:	00 00 00 
+  802a74:	ff d0                	call   *%rax
+}
+  802a76:	c9                   	leave
+  802a77:	c3                   	ret
+
+0000000000802a78 <close_all>:
+
+void
+close_all(void) {
+  802a78:	55                   	push   %rbp
+  802a79:	48 89 e5             	mov    %rsp,%rbp
+  802a7c:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802a80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a87:	eb 15                	jmp    802a9e <close_all+0x26>
+    close(i);
+  802a89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a8c:	89 c7                	mov    %eax,%edi
+  802a8e:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802a9a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a9e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802aa2:	7e e5                	jle    802a89 <close_all+0x11>
+}
+  802aa4:	90                   	nop
+  802aa5:	90                   	nop
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+0000000000802aa8 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	48 83 ec 40          	sub    $0x40,%rsp
+  802ab0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802ab3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802ab6:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802aba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802abd:	48 89 d6             	mov    %rdx,%rsi
+  802ac0:	89 c7                	mov    %eax,%edi
+  802ac2:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ad1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ad5:	79 08                	jns    802adf <dup+0x37>
+    return r;
+  802ad7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ada:	e9 33 02 00 00       	jmp    802d12 <dup+0x26a>
+  close(newfdnum);
+  802adf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802ae2:	89 c7                	mov    %eax,%edi
+  802ae4:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802af0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802af3:	c1 e0 0c             	shl    $0xc,%eax
+  802af6:	48 98                	cltq
+  802af8:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802afd:	48 01 d0             	add    %rdx,%rax
+  802b00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802b04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b08:	48 89 c7             	mov    %rax,%rdi
+  802b0b:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  802b17:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1f:	48 89 c7             	mov    %rax,%rdi
+  802b22:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  802b29:	00 00 00 
+  802b2c:	ff d0                	call   *%rax
+  802b2e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b32:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b39:	00 
+  802b3a:	e9 19 01 00 00       	jmp    802c58 <dup+0x1b0>
+    off -= PGSIZE;
+  802b3f:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b46:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b4f:	48 01 d0             	add    %rdx,%rax
+  802b52:	48 c1 e8 27          	shr    $0x27,%rax
+  802b56:	48 89 c2             	mov    %rax,%rdx
+  802b59:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b60:	01 00 00 
+  802b63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b67:	83 e0 01             	and    $0x1,%eax
+  802b6a:	48 85 c0             	test   %rax,%rax
+  802b6d:	0f 84 e5 00 00 00    	je     802c58 <dup+0x1b0>
+  802b73:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b7b:	48 01 d0             	add    %rdx,%rax
+  802b7e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b82:	48 89 c2             	mov    %rax,%rdx
+  802b85:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b8c:	01 00 00 
+  802b8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b93:	83 e0 01             	and    $0x1,%eax
+  802b96:	48 85 c0             	test   %rax,%rax
+  802b99:	0f 84 b9 00 00 00    	je     802c58 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802b9f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba7:	48 01 d0             	add    %rdx,%rax
+  802baa:	48 c1 e8 15          	shr    $0x15,%rax
+  802bae:	48 89 c2             	mov    %rax,%rdx
+  802bb1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bb8:	01 00 00 
+  802bbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bbf:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bc2:	48 85 c0             	test   %rax,%rax
+  802bc5:	0f 84 8d 00 00 00    	je     802c58 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bcb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bd3:	48 01 d0             	add    %rdx,%rax
+  802bd6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bda:	48 89 c2             	mov    %rax,%rdx
+  802bdd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802be4:	01 00 00 
+  802be7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802beb:	83 e0 01             	and    $0x1,%eax
+  802bee:	48 85 c0             	test   %rax,%rax
+  802bf1:	74 65                	je     802c58 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802bf3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bf7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bfb:	48 01 d0             	add    %rdx,%rax
+  802bfe:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c02:	48 89 c2             	mov    %rax,%rdx
+  802c05:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c0c:	01 00 00 
+  802c0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c13:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c18:	89 c6                	mov    %eax,%esi
+  802c1a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c22:	48 01 c2             	add    %rax,%rdx
+  802c25:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c2d:	48 01 c8             	add    %rcx,%rax
+  802c30:	41 89 f0             	mov    %esi,%r8d
+  802c33:	48 89 d1             	mov    %rdx,%rcx
+  802c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3b:	48 89 c6             	mov    %rax,%rsi
+  802c3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c43:	48 b8 f9 1f 80 00 00 	movabs $0x801ff9,%rax
+  802c4a:	00 00 00 
+  802c4d:	ff d0                	call   *%rax
+  802c4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c52:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c56:	78 60                	js     802cb8 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c58:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c5d:	0f 85 dc fe ff ff    	jne    802b3f <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c67:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c6b:	48 89 c2             	mov    %rax,%rdx
+  802c6e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c75:	01 00 00 
+  802c78:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c7c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c81:	89 c1                	mov    %eax,%ecx
+  802c83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c8b:	41 89 c8             	mov    %ecx,%r8d
+  802c8e:	48 89 d1             	mov    %rdx,%rcx
+  802c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c96:	48 89 c6             	mov    %rax,%rsi
+  802c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9e:	48 b8 f9 1f 80 00 00 	movabs $0x801ff9,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb1:	78 08                	js     802cbb <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802cb3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cb6:	eb 5a                	jmp    802d12 <dup+0x26a>
+        goto err;
+  802cb8:	90                   	nop
+  802cb9:	eb 01                	jmp    802cbc <dup+0x214>
+    goto err;
+  802cbb:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cc0:	48 89 c6             	mov    %rax,%rsi
+  802cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc8:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cd4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802cdb:	00 
+  802cdc:	eb 27                	jmp    802d05 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802cde:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce6:	48 01 d0             	add    %rdx,%rax
+  802ce9:	48 89 c6             	mov    %rax,%rsi
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf1:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cfd:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802d04:	00 
+  802d05:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d0c:	00 
+  802d0d:	76 cf                	jbe    802cde <dup+0x236>
+  return r;
+  802d0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d12:	c9                   	leave
+  802d13:	c3                   	ret
+
+0000000000802d14 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	48 83 ec 40          	sub    $0x40,%rsp
+  802d1c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d1f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d23:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d27:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d2e:	48 89 d6             	mov    %rdx,%rsi
+  802d31:	89 c7                	mov    %eax,%edi
+  802d33:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d46:	78 24                	js     802d6c <read+0x58>
+  802d48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d4c:	8b 00                	mov    (%rax),%eax
+  802d4e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d52:	48 89 d6             	mov    %rdx,%rsi
+  802d55:	89 c7                	mov    %eax,%edi
+  802d57:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  802d5e:	00 00 00 
+  802d61:	ff d0                	call   *%rax
+  802d63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d6a:	79 0a                	jns    802d76 <read+0x62>
+    return r;
+  802d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d6f:	48 98                	cltq
+  802d71:	e9 9e 00 00 00       	jmp    802e14 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d7a:	8b 40 08             	mov    0x8(%rax),%eax
+  802d7d:	83 e0 03             	and    $0x3,%eax
+  802d80:	83 f8 01             	cmp    $0x1,%eax
+  802d83:	75 5c                	jne    802de1 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d85:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d8c:	00 00 00 
+  802d8f:	8b 40 04             	mov    0x4(%rax),%eax
+  802d92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d97:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d9e:	00 00 00 
+  802da1:	48 98                	cltq
+  802da3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802daa:	48 01 d0             	add    %rdx,%rax
+  802dad:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802db3:	8b 00                	mov    (%rax),%eax
+  802db5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db8:	89 c6                	mov    %eax,%esi
+  802dba:	48 b8 57 55 80 00 00 	movabs $0x805557,%rax
+  802dc1:	00 00 00 
+  802dc4:	48 89 c7             	mov    %rax,%rdi
+  802dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcc:	48 b9 23 02 80 00 00 	movabs $0x800223,%rcx
+  802dd3:	00 00 00 
+  802dd6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802dd8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ddf:	eb 33                	jmp    802e14 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802de1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802de5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802de9:	48 85 c0             	test   %rax,%rax
+  802dec:	75 09                	jne    802df7 <read+0xe3>
+    return -E_NOT_SUPP;
+  802dee:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802df5:	eb 1d                	jmp    802e14 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802df7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dfb:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e03:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e07:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e0b:	48 89 ce             	mov    %rcx,%rsi
+  802e0e:	48 89 c7             	mov    %rax,%rdi
+  802e11:	41 ff d0             	call   *%r8
+}
+  802e14:	c9                   	leave
+  802e15:	c3                   	ret
+
+0000000000802e16 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e16:	55                   	push   %rbp
+  802e17:	48 89 e5             	mov    %rsp,%rbp
+  802e1a:	48 83 ec 30          	sub    $0x30,%rsp
+  802e1e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e21:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e25:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e29:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e30:	eb 49                	jmp    802e7b <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e35:	48 98                	cltq
+  802e37:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e3b:	48 29 c2             	sub    %rax,%rdx
+  802e3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e41:	48 63 c8             	movslq %eax,%rcx
+  802e44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e48:	48 01 c1             	add    %rax,%rcx
+  802e4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e4e:	48 89 ce             	mov    %rcx,%rsi
+  802e51:	89 c7                	mov    %eax,%edi
+  802e53:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  802e5a:	00 00 00 
+  802e5d:	ff d0                	call   *%rax
+  802e5f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e62:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e66:	79 07                	jns    802e6f <readn+0x59>
+      return m;
+  802e68:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e6b:	48 98                	cltq
+  802e6d:	eb 1f                	jmp    802e8e <readn+0x78>
+    if (m == 0)
+  802e6f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e73:	74 13                	je     802e88 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802e75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e78:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e7e:	48 98                	cltq
+  802e80:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802e84:	72 ac                	jb     802e32 <readn+0x1c>
+  802e86:	eb 01                	jmp    802e89 <readn+0x73>
+      break;
+  802e88:	90                   	nop
+  }
+  return tot;
+  802e89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e8c:	48 98                	cltq
+}
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+0000000000802e90 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	48 83 ec 40          	sub    $0x40,%rsp
+  802e98:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e9b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e9f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ea3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ea7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802eaa:	48 89 d6             	mov    %rdx,%rsi
+  802ead:	89 c7                	mov    %eax,%edi
+  802eaf:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802eb6:	00 00 00 
+  802eb9:	ff d0                	call   *%rax
+  802ebb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ebe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ec2:	78 24                	js     802ee8 <write+0x58>
+  802ec4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ec8:	8b 00                	mov    (%rax),%eax
+  802eca:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ece:	48 89 d6             	mov    %rdx,%rsi
+  802ed1:	89 c7                	mov    %eax,%edi
+  802ed3:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  802eda:	00 00 00 
+  802edd:	ff d0                	call   *%rax
+  802edf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ee2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ee6:	79 0a                	jns    802ef2 <write+0x62>
+    return r;
+  802ee8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eeb:	48 98                	cltq
+  802eed:	e9 9d 00 00 00       	jmp    802f8f <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ef2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef6:	8b 40 08             	mov    0x8(%rax),%eax
+  802ef9:	83 e0 03             	and    $0x3,%eax
+  802efc:	85 c0                	test   %eax,%eax
+  802efe:	75 5c                	jne    802f5c <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f00:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f07:	00 00 00 
+  802f0a:	8b 40 04             	mov    0x4(%rax),%eax
+  802f0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f12:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f19:	00 00 00 
+  802f1c:	48 98                	cltq
+  802f1e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f25:	48 01 d0             	add    %rdx,%rax
+  802f28:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f2e:	8b 00                	mov    (%rax),%eax
+  802f30:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f33:	89 c6                	mov    %eax,%esi
+  802f35:	48 b8 73 55 80 00 00 	movabs $0x805573,%rax
+  802f3c:	00 00 00 
+  802f3f:	48 89 c7             	mov    %rax,%rdi
+  802f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f47:	48 b9 23 02 80 00 00 	movabs $0x800223,%rcx
+  802f4e:	00 00 00 
+  802f51:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f5a:	eb 33                	jmp    802f8f <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f60:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f64:	48 85 c0             	test   %rax,%rax
+  802f67:	75 09                	jne    802f72 <write+0xe2>
+    return -E_NOT_SUPP;
+  802f69:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f70:	eb 1d                	jmp    802f8f <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f76:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f7e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f82:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802f86:	48 89 ce             	mov    %rcx,%rsi
+  802f89:	48 89 c7             	mov    %rax,%rdi
+  802f8c:	41 ff d0             	call   *%r8
+}
+  802f8f:	c9                   	leave
+  802f90:	c3                   	ret
+
+0000000000802f91 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802f91:	55                   	push   %rbp
+  802f92:	48 89 e5             	mov    %rsp,%rbp
+  802f95:	48 83 ec 18          	sub    $0x18,%rsp
+  802f99:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f9c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f9f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fa3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fa6:	48 89 d6             	mov    %rdx,%rsi
+  802fa9:	89 c7                	mov    %eax,%edi
+  802fab:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802fb2:	00 00 00 
+  802fb5:	ff d0                	call   *%rax
+  802fb7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fbe:	79 05                	jns    802fc5 <seek+0x34>
+    return r;
+  802fc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fc3:	eb 0f                	jmp    802fd4 <seek+0x43>
+  fd->fd_offset = offset;
+  802fc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802fcc:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd4:	c9                   	leave
+  802fd5:	c3                   	ret
+
+0000000000802fd6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802fd6:	55                   	push   %rbp
+  802fd7:	48 89 e5             	mov    %rsp,%rbp
+  802fda:	48 83 ec 30          	sub    $0x30,%rsp
+  802fde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fe1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fe4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fe8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802feb:	48 89 d6             	mov    %rdx,%rsi
+  802fee:	89 c7                	mov    %eax,%edi
+  802ff0:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+  802ffc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803003:	78 24                	js     803029 <ftruncate+0x53>
+  803005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803009:	8b 00                	mov    (%rax),%eax
+  80300b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80300f:	48 89 d6             	mov    %rdx,%rsi
+  803012:	89 c7                	mov    %eax,%edi
+  803014:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  80301b:	00 00 00 
+  80301e:	ff d0                	call   *%rax
+  803020:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803023:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803027:	79 08                	jns    803031 <ftruncate+0x5b>
+    return r;
+  803029:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80302c:	e9 92 00 00 00       	jmp    8030c3 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803035:	8b 40 08             	mov    0x8(%rax),%eax
+  803038:	83 e0 03             	and    $0x3,%eax
+  80303b:	85 c0                	test   %eax,%eax
+  80303d:	75 5a                	jne    803099 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80303f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803046:	00 00 00 
+  803049:	8b 40 04             	mov    0x4(%rax),%eax
+  80304c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803051:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803058:	00 00 00 
+  80305b:	48 98                	cltq
+  80305d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803064:	48 01 d0             	add    %rdx,%rax
+  803067:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80306d:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80306f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803072:	89 c6                	mov    %eax,%esi
+  803074:	48 b8 90 55 80 00 00 	movabs $0x805590,%rax
+  80307b:	00 00 00 
+  80307e:	48 89 c7             	mov    %rax,%rdi
+  803081:	b8 00 00 00 00       	mov    $0x0,%eax
+  803086:	48 b9 23 02 80 00 00 	movabs $0x800223,%rcx
+  80308d:	00 00 00 
+  803090:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803092:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803097:	eb 2a                	jmp    8030c3 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803099:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8030a1:	48 85 c0             	test   %rax,%rax
+  8030a4:	75 07                	jne    8030ad <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8030a6:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8030ab:	eb 16                	jmp    8030c3 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b1:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030b9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030bc:	89 d6                	mov    %edx,%esi
+  8030be:	48 89 c7             	mov    %rax,%rdi
+  8030c1:	ff d1                	call   *%rcx
+}
+  8030c3:	c9                   	leave
+  8030c4:	c3                   	ret
+
+00000000008030c5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030c5:	55                   	push   %rbp
+  8030c6:	48 89 e5             	mov    %rsp,%rbp
+  8030c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8030cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030d0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030d4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030db:	48 89 d6             	mov    %rdx,%rsi
+  8030de:	89 c7                	mov    %eax,%edi
+  8030e0:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  8030e7:	00 00 00 
+  8030ea:	ff d0                	call   *%rax
+  8030ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030f3:	78 24                	js     803119 <fstat+0x54>
+  8030f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f9:	8b 00                	mov    (%rax),%eax
+  8030fb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030ff:	48 89 d6             	mov    %rdx,%rsi
+  803102:	89 c7                	mov    %eax,%edi
+  803104:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803113:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803117:	79 05                	jns    80311e <fstat+0x59>
+    return r;
+  803119:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80311c:	eb 5e                	jmp    80317c <fstat+0xb7>
+  if (!dev->dev_stat)
+  80311e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803122:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803126:	48 85 c0             	test   %rax,%rax
+  803129:	75 07                	jne    803132 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80312b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803130:	eb 4a                	jmp    80317c <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803132:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803136:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803139:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313d:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803144:	00 00 00 
+  stat->st_isdir   = 0;
+  803147:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80314b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803152:	00 00 00 
+  stat->st_dev     = dev;
+  803155:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803159:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80315d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803164:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803168:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80316c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803170:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803174:	48 89 d6             	mov    %rdx,%rsi
+  803177:	48 89 c7             	mov    %rax,%rdi
+  80317a:	ff d1                	call   *%rcx
+}
+  80317c:	c9                   	leave
+  80317d:	c3                   	ret
+
+000000000080317e <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80317e:	55                   	push   %rbp
+  80317f:	48 89 e5             	mov    %rsp,%rbp
+  803182:	48 83 ec 10          	sub    $0x10,%rsp
+  803186:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80318a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80318e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803192:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803198:	83 f8 20             	cmp    $0x20,%eax
+  80319b:	75 07                	jne    8031a4 <pollwait_key+0x26>
+    return -E_INVAL;
+  80319d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a2:	eb 5f                	jmp    803203 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8031a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031a8:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031b2:	48 63 d2             	movslq %edx,%rdx
+  8031b5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031b9:	48 01 c2             	add    %rax,%rdx
+  8031bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c0:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c7:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8031cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031d1:	8b 00                	mov    (%rax),%eax
+  8031d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d7:	48 63 c9             	movslq %ecx,%rcx
+  8031da:	48 c1 e1 04          	shl    $0x4,%rcx
+  8031de:	48 01 ca             	add    %rcx,%rdx
+  8031e1:	48 83 c2 08          	add    $0x8,%rdx
+  8031e5:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8031e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031eb:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8031f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f8:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8031fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803203:	c9                   	leave
+  803204:	c3                   	ret
+
+0000000000803205 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803205:	55                   	push   %rbp
+  803206:	48 89 e5             	mov    %rsp,%rbp
+  803209:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803210:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803217:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80321d:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803224:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80322b:	00 
+  int i, r, ready, ipc = 0;
+  80322c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803233:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80323a:	00 
+  80323b:	74 45                	je     803282 <poll+0x7d>
+  80323d:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803244:	ff 
+  803245:	74 3b                	je     803282 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803247:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  80324e:	00 00 00 
+  803251:	ff d0                	call   *%rax
+  803253:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803257:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325b:	48 f7 d0             	not    %rax
+  80325e:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803265:	73 10                	jae    803277 <poll+0x72>
+  803267:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80326b:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803272:	48 01 d0             	add    %rdx,%rax
+  803275:	eb 07                	jmp    80327e <poll+0x79>
+  803277:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80327e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803282:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803289:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803290:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803297:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80329e:	e9 46 02 00 00       	jmp    8034e9 <poll+0x2e4>
+      fds[i].revents = 0;
+  8032a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032a6:	48 63 d0             	movslq %eax,%rdx
+  8032a9:	48 89 d0             	mov    %rdx,%rax
+  8032ac:	48 01 c0             	add    %rax,%rax
+  8032af:	48 01 d0             	add    %rdx,%rax
+  8032b2:	48 c1 e0 02          	shl    $0x2,%rax
+  8032b6:	48 89 c2             	mov    %rax,%rdx
+  8032b9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032c0:	48 01 d0             	add    %rdx,%rax
+  8032c3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8032ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032cd:	48 63 d0             	movslq %eax,%rdx
+  8032d0:	48 89 d0             	mov    %rdx,%rax
+  8032d3:	48 01 c0             	add    %rax,%rax
+  8032d6:	48 01 d0             	add    %rdx,%rax
+  8032d9:	48 c1 e0 02          	shl    $0x2,%rax
+  8032dd:	48 89 c2             	mov    %rax,%rdx
+  8032e0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032e7:	48 01 d0             	add    %rdx,%rax
+  8032ea:	8b 00                	mov    (%rax),%eax
+  8032ec:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8032ef:	75 62                	jne    803353 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8032f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032f4:	48 63 d0             	movslq %eax,%rdx
+  8032f7:	48 89 d0             	mov    %rdx,%rax
+  8032fa:	48 01 c0             	add    %rax,%rax
+  8032fd:	48 01 d0             	add    %rdx,%rax
+  803300:	48 c1 e0 02          	shl    $0x2,%rax
+  803304:	48 89 c2             	mov    %rax,%rdx
+  803307:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80330e:	48 01 d0             	add    %rdx,%rax
+  803311:	8b 40 04             	mov    0x4(%rax),%eax
+  803314:	83 e0 01             	and    $0x1,%eax
+  803317:	85 c0                	test   %eax,%eax
+  803319:	0f 84 9b 01 00 00    	je     8034ba <poll+0x2b5>
+          fds[i].revents = ipc;
+  80331f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803322:	48 63 d0             	movslq %eax,%rdx
+  803325:	48 89 d0             	mov    %rdx,%rax
+  803328:	48 01 c0             	add    %rax,%rax
+  80332b:	48 01 d0             	add    %rdx,%rax
+  80332e:	48 c1 e0 02          	shl    $0x2,%rax
+  803332:	48 89 c2             	mov    %rax,%rdx
+  803335:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80333c:	48 01 c2             	add    %rax,%rdx
+  80333f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803342:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803345:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803348:	83 c8 04             	or     $0x4,%eax
+  80334b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80334e:	e9 67 01 00 00       	jmp    8034ba <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803353:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803356:	48 63 d0             	movslq %eax,%rdx
+  803359:	48 89 d0             	mov    %rdx,%rax
+  80335c:	48 01 c0             	add    %rax,%rax
+  80335f:	48 01 d0             	add    %rdx,%rax
+  803362:	48 c1 e0 02          	shl    $0x2,%rax
+  803366:	48 89 c2             	mov    %rax,%rdx
+  803369:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803370:	48 01 d0             	add    %rdx,%rax
+  803373:	8b 00                	mov    (%rax),%eax
+  803375:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80337c:	48 89 d6             	mov    %rdx,%rsi
+  80337f:	89 c7                	mov    %eax,%edi
+  803381:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  803388:	00 00 00 
+  80338b:	ff d0                	call   *%rax
+  80338d:	85 c0                	test   %eax,%eax
+  80338f:	78 25                	js     8033b6 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803391:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803398:	8b 00                	mov    (%rax),%eax
+  80339a:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8033a1:	48 89 d6             	mov    %rdx,%rsi
+  8033a4:	89 c7                	mov    %eax,%edi
+  8033a6:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	79 2c                	jns    8033e2 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033b9:	48 63 d0             	movslq %eax,%rdx
+  8033bc:	48 89 d0             	mov    %rdx,%rax
+  8033bf:	48 01 c0             	add    %rax,%rax
+  8033c2:	48 01 d0             	add    %rdx,%rax
+  8033c5:	48 c1 e0 02          	shl    $0x2,%rax
+  8033c9:	48 89 c2             	mov    %rax,%rdx
+  8033cc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033d3:	48 01 d0             	add    %rdx,%rax
+  8033d6:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8033dd:	e9 d8 00 00 00       	jmp    8034ba <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8033e2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033e9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8033ed:	48 85 c0             	test   %rax,%rax
+  8033f0:	74 7d                	je     80346f <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8033f2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033f9:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8033fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803400:	48 63 d0             	movslq %eax,%rdx
+  803403:	48 89 d0             	mov    %rdx,%rax
+  803406:	48 01 c0             	add    %rax,%rax
+  803409:	48 01 d0             	add    %rdx,%rax
+  80340c:	48 c1 e0 02          	shl    $0x2,%rax
+  803410:	48 89 c2             	mov    %rax,%rdx
+  803413:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80341a:	48 01 d0             	add    %rdx,%rax
+  80341d:	8b 48 04             	mov    0x4(%rax),%ecx
+  803420:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803427:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80342e:	89 ce                	mov    %ecx,%esi
+  803430:	48 89 c7             	mov    %rax,%rdi
+  803433:	41 ff d0             	call   *%r8
+  803436:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803439:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80343d:	79 08                	jns    803447 <poll+0x242>
+          return r;
+  80343f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803442:	e9 45 01 00 00       	jmp    80358c <poll+0x387>
+        fds[i].revents = r;
+  803447:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80344a:	48 63 d0             	movslq %eax,%rdx
+  80344d:	48 89 d0             	mov    %rdx,%rax
+  803450:	48 01 c0             	add    %rax,%rax
+  803453:	48 01 d0             	add    %rdx,%rax
+  803456:	48 c1 e0 02          	shl    $0x2,%rax
+  80345a:	48 89 c2             	mov    %rax,%rdx
+  80345d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803464:	48 01 c2             	add    %rax,%rdx
+  803467:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80346a:	89 42 08             	mov    %eax,0x8(%rdx)
+  80346d:	eb 4b                	jmp    8034ba <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80346f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803472:	48 63 d0             	movslq %eax,%rdx
+  803475:	48 89 d0             	mov    %rdx,%rax
+  803478:	48 01 c0             	add    %rax,%rax
+  80347b:	48 01 d0             	add    %rdx,%rax
+  80347e:	48 c1 e0 02          	shl    $0x2,%rax
+  803482:	48 89 c2             	mov    %rax,%rdx
+  803485:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80348c:	48 01 d0             	add    %rdx,%rax
+  80348f:	8b 48 04             	mov    0x4(%rax),%ecx
+  803492:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803495:	48 63 d0             	movslq %eax,%rdx
+  803498:	48 89 d0             	mov    %rdx,%rax
+  80349b:	48 01 c0             	add    %rax,%rax
+  80349e:	48 01 d0             	add    %rdx,%rax
+  8034a1:	48 c1 e0 02          	shl    $0x2,%rax
+  8034a5:	48 89 c2             	mov    %rax,%rdx
+  8034a8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034af:	48 01 d0             	add    %rdx,%rax
+  8034b2:	83 e1 03             	and    $0x3,%ecx
+  8034b5:	89 ca                	mov    %ecx,%edx
+  8034b7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034bd:	48 63 d0             	movslq %eax,%rdx
+  8034c0:	48 89 d0             	mov    %rdx,%rax
+  8034c3:	48 01 c0             	add    %rax,%rax
+  8034c6:	48 01 d0             	add    %rdx,%rax
+  8034c9:	48 c1 e0 02          	shl    $0x2,%rax
+  8034cd:	48 89 c2             	mov    %rax,%rdx
+  8034d0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034d7:	48 01 d0             	add    %rdx,%rax
+  8034da:	8b 40 08             	mov    0x8(%rax),%eax
+  8034dd:	85 c0                	test   %eax,%eax
+  8034df:	74 04                	je     8034e5 <poll+0x2e0>
+        ready++;
+  8034e1:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034e5:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8034e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034ec:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8034f2:	0f 8c ab fd ff ff    	jl     8032a3 <poll+0x9e>
+    }
+    if (ready)
+  8034f8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8034fc:	74 08                	je     803506 <poll+0x301>
+      return ready;
+  8034fe:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803501:	e9 86 00 00 00       	jmp    80358c <poll+0x387>
+
+    if (deadline) {
+  803506:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80350b:	74 30                	je     80353d <poll+0x338>
+      now     = vsys_clock_ns();
+  80350d:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  803514:	00 00 00 
+  803517:	ff d0                	call   *%rax
+  803519:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80351d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803521:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803525:	73 0a                	jae    803531 <poll+0x32c>
+  803527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80352b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80352f:	eb 05                	jmp    803536 <poll+0x331>
+  803531:	b8 00 00 00 00       	mov    $0x0,%eax
+  803536:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80353d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803540:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803543:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80354a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803551:	48 89 c7             	mov    %rax,%rdi
+  803554:	48 b8 e9 23 80 00 00 	movabs $0x8023e9,%rax
+  80355b:	00 00 00 
+  80355e:	ff d0                	call   *%rax
+  803560:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803563:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803567:	75 07                	jne    803570 <poll+0x36b>
+      return 0;
+  803569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356e:	eb 1c                	jmp    80358c <poll+0x387>
+    if (r < 0)
+  803570:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803574:	79 05                	jns    80357b <poll+0x376>
+      return r;
+  803576:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803579:	eb 11                	jmp    80358c <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80357b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80357e:	c1 f8 02             	sar    $0x2,%eax
+  803581:	83 e0 01             	and    $0x1,%eax
+  803584:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803587:	e9 f6 fc ff ff       	jmp    803282 <poll+0x7d>
+  }
+}
+  80358c:	c9                   	leave
+  80358d:	c3                   	ret
+
+000000000080358e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80358e:	55                   	push   %rbp
+  80358f:	48 89 e5             	mov    %rsp,%rbp
+  803592:	48 83 ec 20          	sub    $0x20,%rsp
+  803596:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80359a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80359e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a7:	48 89 c7             	mov    %rax,%rdi
+  8035aa:	48 b8 7c 36 80 00 00 	movabs $0x80367c,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+  8035b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035bd:	79 05                	jns    8035c4 <stat+0x36>
+    return fd;
+  8035bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c2:	eb 2f                	jmp    8035f3 <stat+0x65>
+  r = fstat(fd, stat);
+  8035c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035cb:	48 89 d6             	mov    %rdx,%rsi
+  8035ce:	89 c7                	mov    %eax,%edi
+  8035d0:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  8035d7:	00 00 00 
+  8035da:	ff d0                	call   *%rax
+  8035dc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8035df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035e2:	89 c7                	mov    %eax,%edi
+  8035e4:	48 b8 2d 2a 80 00 00 	movabs $0x802a2d,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+  return r;
+  8035f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035f3:	c9                   	leave
+  8035f4:	c3                   	ret
+
+00000000008035f5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8035f5:	55                   	push   %rbp
+  8035f6:	48 89 e5             	mov    %rsp,%rbp
+  8035f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8035fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803600:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803604:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80360b:	00 00 00 
+  80360e:	8b 00                	mov    (%rax),%eax
+  803610:	85 c0                	test   %eax,%eax
+  803612:	75 1d                	jne    803631 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803614:	bf 03 00 00 00       	mov    $0x3,%edi
+  803619:	48 b8 75 4e 80 00 00 	movabs $0x804e75,%rax
+  803620:	00 00 00 
+  803623:	ff d0                	call   *%rax
+  803625:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80362c:	00 00 00 
+  80362f:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803631:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803638:	00 00 00 
+  80363b:	8b 00                	mov    (%rax),%eax
+  80363d:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803640:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803645:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80364c:	00 00 00 
+  80364f:	89 c7                	mov    %eax,%edi
+  803651:	48 b8 c8 4d 80 00 00 	movabs $0x804dc8,%rax
+  803658:	00 00 00 
+  80365b:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80365d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803661:	ba 00 00 00 00       	mov    $0x0,%edx
+  803666:	48 89 c6             	mov    %rax,%rsi
+  803669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366e:	48 b8 4b 4c 80 00 00 	movabs $0x804c4b,%rax
+  803675:	00 00 00 
+  803678:	ff d0                	call   *%rax
+}
+  80367a:	c9                   	leave
+  80367b:	c3                   	ret
+
+000000000080367c <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80367c:	55                   	push   %rbp
+  80367d:	48 89 e5             	mov    %rsp,%rbp
+  803680:	48 83 ec 20          	sub    $0x20,%rsp
+  803684:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803688:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80368b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80368f:	48 89 c7             	mov    %rax,%rdi
+  803692:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  803699:	00 00 00 
+  80369c:	ff d0                	call   *%rax
+  80369e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8036a3:	7e 0a                	jle    8036af <open+0x33>
+    return -E_BAD_PATH;
+  8036a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036aa:	e9 a8 00 00 00       	jmp    803757 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036af:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036b3:	48 89 c7             	mov    %rax,%rdi
+  8036b6:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  8036bd:	00 00 00 
+  8036c0:	ff d0                	call   *%rax
+  8036c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036c9:	79 08                	jns    8036d3 <open+0x57>
+    return r;
+  8036cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036ce:	e9 84 00 00 00       	jmp    803757 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8036d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036d7:	48 89 c6             	mov    %rax,%rsi
+  8036da:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8036e1:	00 00 00 
+  8036e4:	48 89 c7             	mov    %rax,%rdi
+  8036e7:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  8036ee:	00 00 00 
+  8036f1:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8036f3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8036fa:	00 00 00 
+  8036fd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803700:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803706:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80370a:	48 89 c6             	mov    %rax,%rsi
+  80370d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803712:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+  80371e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803721:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803725:	79 1d                	jns    803744 <open+0xc8>
+    fd_close(fd, 0);
+  803727:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80372b:	be 00 00 00 00       	mov    $0x0,%esi
+  803730:	48 89 c7             	mov    %rax,%rdi
+  803733:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  80373a:	00 00 00 
+  80373d:	ff d0                	call   *%rax
+    return r;
+  80373f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803742:	eb 13                	jmp    803757 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803748:	48 89 c7             	mov    %rax,%rdi
+  80374b:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+}
+  803757:	c9                   	leave
+  803758:	c3                   	ret
+
+0000000000803759 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803759:	55                   	push   %rbp
+  80375a:	48 89 e5             	mov    %rsp,%rbp
+  80375d:	48 83 ec 10          	sub    $0x10,%rsp
+  803761:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803765:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803769:	8b 40 0c             	mov    0xc(%rax),%eax
+  80376c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803773:	00 00 00 
+  803776:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803778:	be 00 00 00 00       	mov    $0x0,%esi
+  80377d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803782:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+}
+  80378e:	c9                   	leave
+  80378f:	c3                   	ret
+
+0000000000803790 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803790:	55                   	push   %rbp
+  803791:	48 89 e5             	mov    %rsp,%rbp
+  803794:	48 83 ec 30          	sub    $0x30,%rsp
+  803798:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80379c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8037a0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8037a4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8037a9:	74 07                	je     8037b2 <devfile_read+0x22>
+  8037ab:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037b0:	75 0a                	jne    8037bc <devfile_read+0x2c>
+  return E_INVAL;
+  8037b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037b7:	e9 b4 00 00 00       	jmp    803870 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037bc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037c3:	00 
+  while (n) {
+  8037c4:	e9 98 00 00 00       	jmp    803861 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037cd:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037d0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037d7:	00 00 00 
+  8037da:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8037dc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037e3:	00 00 00 
+  8037e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037ea:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8037ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037f8:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803807:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80380b:	7f 13                	jg     803820 <devfile_read+0x90>
+      return res ? res : res0;
+  80380d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803811:	74 07                	je     80381a <devfile_read+0x8a>
+  803813:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803816:	48 98                	cltq
+  803818:	eb 56                	jmp    803870 <devfile_read+0xe0>
+  80381a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80381e:	eb 50                	jmp    803870 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803820:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803823:	48 63 d0             	movslq %eax,%rdx
+  803826:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80382a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803831:	00 00 00 
+  803834:	48 89 ce             	mov    %rcx,%rsi
+  803837:	48 89 c7             	mov    %rax,%rdi
+  80383a:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  803841:	00 00 00 
+  803844:	ff d0                	call   *%rax
+
+    buf += res;
+  803846:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803849:	48 98                	cltq
+  80384b:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80384f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803852:	48 98                	cltq
+  803854:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803858:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80385b:	48 98                	cltq
+  80385d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803861:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803866:	0f 85 5d ff ff ff    	jne    8037c9 <devfile_read+0x39>
+  }
+
+  return res0;
+  80386c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803870:	c9                   	leave
+  803871:	c3                   	ret
+
+0000000000803872 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803872:	55                   	push   %rbp
+  803873:	48 89 e5             	mov    %rsp,%rbp
+  803876:	48 83 ec 50          	sub    $0x50,%rsp
+  80387a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80387e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803882:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803886:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80388b:	74 07                	je     803894 <devfile_write+0x22>
+  80388d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803892:	75 0a                	jne    80389e <devfile_write+0x2c>
+  return E_INVAL;
+  803894:	b8 03 00 00 00       	mov    $0x3,%eax
+  803899:	e9 c9 00 00 00       	jmp    803967 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80389e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8038a5:	00 
+
+  while (n) {
+  8038a6:	e9 ad 00 00 00       	jmp    803958 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8038ab:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038af:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038b3:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038ba:	00 
+  8038bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c3:	48 39 c2             	cmp    %rax,%rdx
+  8038c6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038ca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8038ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038d6:	48 89 c6             	mov    %rax,%rsi
+  8038d9:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8038e0:	00 00 00 
+  8038e3:	48 89 c7             	mov    %rax,%rdi
+  8038e6:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803900:	00 00 00 
+  803903:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803905:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80390c:	00 00 00 
+  80390f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803913:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803917:	be 00 00 00 00       	mov    $0x0,%esi
+  80391c:	bf 04 00 00 00       	mov    $0x4,%edi
+  803921:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+  80392d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803930:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803934:	79 07                	jns    80393d <devfile_write+0xcb>
+      return res;
+  803936:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803939:	48 98                	cltq
+  80393b:	eb 2a                	jmp    803967 <devfile_write+0xf5>
+
+    buf += res;
+  80393d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803940:	48 98                	cltq
+  803942:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803946:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803949:	48 98                	cltq
+  80394b:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80394f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803952:	48 98                	cltq
+  803954:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803958:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80395d:	0f 85 48 ff ff ff    	jne    8038ab <devfile_write+0x39>
+  }
+
+  return res0;
+  803963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803967:	c9                   	leave
+  803968:	c3                   	ret
+
+0000000000803969 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	48 83 ec 20          	sub    $0x20,%rsp
+  803971:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803975:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80397d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803980:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803987:	00 00 00 
+  80398a:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80398c:	be 00 00 00 00       	mov    $0x0,%esi
+  803991:	bf 05 00 00 00       	mov    $0x5,%edi
+  803996:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  80399d:	00 00 00 
+  8039a0:	ff d0                	call   *%rax
+  8039a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039a9:	79 05                	jns    8039b0 <devfile_stat+0x47>
+    return r;
+  8039ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039ae:	eb 59                	jmp    803a09 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039b4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039bb:	00 00 00 
+  8039be:	48 89 d6             	mov    %rdx,%rsi
+  8039c1:	48 89 c7             	mov    %rax,%rdi
+  8039c4:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  8039cb:	00 00 00 
+  8039ce:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8039d0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039d7:	00 00 00 
+  8039da:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039e4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039ea:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039f1:	00 00 00 
+  8039f4:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039fe:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a09:	c9                   	leave
+  803a0a:	c3                   	ret
+
+0000000000803a0b <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a0b:	55                   	push   %rbp
+  803a0c:	48 89 e5             	mov    %rsp,%rbp
+  803a0f:	48 83 ec 10          	sub    $0x10,%rsp
+  803a13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a1e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a21:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a28:	00 00 00 
+  803a2b:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a2d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a34:	00 00 00 
+  803a37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a3a:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a3d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a42:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a47:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803a4e:	00 00 00 
+  803a51:	ff d0                	call   *%rax
+}
+  803a53:	c9                   	leave
+  803a54:	c3                   	ret
+
+0000000000803a55 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a55:	55                   	push   %rbp
+  803a56:	48 89 e5             	mov    %rsp,%rbp
+  803a59:	48 83 ec 18          	sub    $0x18,%rsp
+  803a5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a61:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a64:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803a68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a6b:	83 e0 03             	and    $0x3,%eax
+}
+  803a6e:	c9                   	leave
+  803a6f:	c3                   	ret
+
+0000000000803a70 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803a70:	55                   	push   %rbp
+  803a71:	48 89 e5             	mov    %rsp,%rbp
+  803a74:	48 83 ec 10          	sub    $0x10,%rsp
+  803a78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a80:	48 89 c7             	mov    %rax,%rdi
+  803a83:	48 b8 d2 10 80 00 00 	movabs $0x8010d2,%rax
+  803a8a:	00 00 00 
+  803a8d:	ff d0                	call   *%rax
+  803a8f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a94:	7e 07                	jle    803a9d <remove+0x2d>
+    return -E_BAD_PATH;
+  803a96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a9b:	eb 36                	jmp    803ad3 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803a9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa1:	48 89 c6             	mov    %rax,%rsi
+  803aa4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803aab:	00 00 00 
+  803aae:	48 89 c7             	mov    %rax,%rdi
+  803ab1:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803abd:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac2:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ac7:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+}
+  803ad3:	c9                   	leave
+  803ad4:	c3                   	ret
+
+0000000000803ad5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803ad5:	55                   	push   %rbp
+  803ad6:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803ad9:	be 00 00 00 00       	mov    $0x0,%esi
+  803ade:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ae3:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803aea:	00 00 00 
+  803aed:	ff d0                	call   *%rax
+}
+  803aef:	5d                   	pop    %rbp
+  803af0:	c3                   	ret
+
+0000000000803af1 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803af1:	55                   	push   %rbp
+  803af2:	48 89 e5             	mov    %rsp,%rbp
+  803af5:	48 83 ec 20          	sub    $0x20,%rsp
+  803af9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803afd:	be 00 00 00 00       	mov    $0x0,%esi
+  803b02:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b07:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803b0e:	00 00 00 
+  803b11:	ff d0                	call   *%rax
+  803b13:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b1a:	79 05                	jns    803b21 <fs_stats+0x30>
+    return r;
+  803b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b1f:	eb 2a                	jmp    803b4b <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b25:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b2a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b31:	00 00 00 
+  803b34:	48 89 ce             	mov    %rcx,%rsi
+  803b37:	48 89 c7             	mov    %rax,%rdi
+  803b3a:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+  return 0;
+  803b46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b4b:	c9                   	leave
+  803b4c:	c3                   	ret
+
+0000000000803b4d <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+  803b51:	48 83 ec 10          	sub    $0x10,%rsp
+  803b55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b58:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b5f:	00 00 00 
+  803b62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b65:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803b67:	be 00 00 00 00       	mov    $0x0,%esi
+  803b6c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b71:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+}
+  803b7d:	c9                   	leave
+  803b7e:	c3                   	ret
+
+0000000000803b7f <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803b7f:	55                   	push   %rbp
+  803b80:	48 89 e5             	mov    %rsp,%rbp
+  803b83:	48 83 ec 10          	sub    $0x10,%rsp
+  803b87:	89 f8                	mov    %edi,%eax
+  803b89:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803b8c:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803b90:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b97:	00 00 00 
+  803b9a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803b9c:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ba6:	48 b8 f5 35 80 00 00 	movabs $0x8035f5,%rax
+  803bad:	00 00 00 
+  803bb0:	ff d0                	call   *%rax
+}
+  803bb2:	c9                   	leave
+  803bb3:	c3                   	ret
+
+0000000000803bb4 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803bb4:	55                   	push   %rbp
+  803bb5:	48 89 e5             	mov    %rsp,%rbp
+  803bb8:	48 83 ec 10          	sub    $0x10,%rsp
+  803bbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bc4:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803bc9:	48 89 c7             	mov    %rax,%rdi
+  803bcc:	48 b8 da 3b 80 00 00 	movabs $0x803bda,%rax
+  803bd3:	00 00 00 
+  803bd6:	ff d0                	call   *%rax
+}
+  803bd8:	c9                   	leave
+  803bd9:	c3                   	ret
+
+0000000000803bda <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+  803bde:	48 83 ec 50          	sub    $0x50,%rsp
+  803be2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803be6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803bea:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803bf1:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803bf2:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803bf7:	74 0a                	je     803c03 <pipe_size+0x29>
+  803bf9:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803c00:	00 
+  803c01:	76 0a                	jbe    803c0d <pipe_size+0x33>
+    return -E_INVAL;
+  803c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c08:	e9 cc 02 00 00       	jmp    803ed9 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c0d:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c11:	48 89 c7             	mov    %rax,%rdi
+  803c14:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  803c1b:	00 00 00 
+  803c1e:	ff d0                	call   *%rax
+  803c20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c23:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c27:	0f 88 a8 02 00 00    	js     803ed5 <pipe_size+0x2fb>
+  803c2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c31:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c36:	48 89 c6             	mov    %rax,%rsi
+  803c39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c3e:	48 b8 a1 1f 80 00 00 	movabs $0x801fa1,%rax
+  803c45:	00 00 00 
+  803c48:	ff d0                	call   *%rax
+  803c4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c51:	0f 88 7e 02 00 00    	js     803ed5 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c57:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c5b:	48 89 c7             	mov    %rax,%rdi
+  803c5e:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+  803c6a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c6d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c71:	0f 88 43 02 00 00    	js     803eba <pipe_size+0x2e0>
+  803c77:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c7b:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c80:	48 89 c6             	mov    %rax,%rsi
+  803c83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c88:	48 b8 a1 1f 80 00 00 	movabs $0x801fa1,%rax
+  803c8f:	00 00 00 
+  803c92:	ff d0                	call   *%rax
+  803c94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c9b:	0f 88 19 02 00 00    	js     803eba <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803ca1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ca5:	48 89 c7             	mov    %rax,%rdi
+  803ca8:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  803caf:	00 00 00 
+  803cb2:	ff d0                	call   *%rax
+  803cb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cb8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cbf:	00 
+  803cc0:	e9 a2 00 00 00       	jmp    803d67 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cc9:	48 c1 e0 0c          	shl    $0xc,%rax
+  803ccd:	48 89 c2             	mov    %rax,%rdx
+  803cd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cd4:	48 01 d0             	add    %rdx,%rax
+  803cd7:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cdc:	48 89 c6             	mov    %rax,%rsi
+  803cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce4:	48 b8 a1 1f 80 00 00 	movabs $0x801fa1,%rax
+  803ceb:	00 00 00 
+  803cee:	ff d0                	call   *%rax
+  803cf0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cf3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cf7:	0f 88 37 01 00 00    	js     803e34 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803cfd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d01:	48 89 c7             	mov    %rax,%rdi
+  803d04:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  803d0b:	00 00 00 
+  803d0e:	ff d0                	call   *%rax
+  803d10:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d14:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d18:	48 01 c2             	add    %rax,%rdx
+  803d1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d23:	48 89 c1             	mov    %rax,%rcx
+  803d26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d2a:	48 01 c8             	add    %rcx,%rax
+  803d2d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d33:	48 89 d1             	mov    %rdx,%rcx
+  803d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d3b:	48 89 c6             	mov    %rax,%rsi
+  803d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d43:	48 b8 f9 1f 80 00 00 	movabs $0x801ff9,%rax
+  803d4a:	00 00 00 
+  803d4d:	ff d0                	call   *%rax
+  803d4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d52:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d56:	79 0a                	jns    803d62 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d58:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d5d:	e9 d3 00 00 00       	jmp    803e35 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d62:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803d67:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803d6e:	00 
+  803d6f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803d73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d77:	48 01 d0             	add    %rdx,%rax
+  803d7a:	48 83 c0 1f          	add    $0x1f,%rax
+  803d7e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803d82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d8b:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803d8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d93:	48 29 d0             	sub    %rdx,%rax
+  803d96:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d9a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803d9e:	0f 82 21 ff ff ff    	jb     803cc5 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803da4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803dac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803db0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803db4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803db8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dbc:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dc3:	00 00 00 
+  803dc6:	8b 12                	mov    (%rdx),%edx
+  803dc8:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803dca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dce:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803dd5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dd9:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803de0:	00 00 00 
+  803de3:	8b 12                	mov    (%rdx),%edx
+  803de5:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803de7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803deb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803df2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df6:	48 89 c7             	mov    %rax,%rdi
+  803df9:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+  803e05:	89 c2                	mov    %eax,%edx
+  803e07:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e0b:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e0d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e11:	48 89 c7             	mov    %rax,%rdi
+  803e14:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  803e1b:	00 00 00 
+  803e1e:	ff d0                	call   *%rax
+  803e20:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e24:	48 83 c2 04          	add    $0x4,%rdx
+  803e28:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2f:	e9 a5 00 00 00       	jmp    803ed9 <pipe_size+0x2ff>
+      goto err2;
+  803e34:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e35:	eb 58                	jmp    803e8f <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e3b:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e3f:	48 89 c2             	mov    %rax,%rdx
+  803e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e46:	48 01 d0             	add    %rdx,%rax
+  803e49:	48 89 c6             	mov    %rax,%rsi
+  803e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e51:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e61:	48 89 c7             	mov    %rax,%rdi
+  803e64:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  803e6b:	00 00 00 
+  803e6e:	ff d0                	call   *%rax
+  803e70:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e74:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e78:	48 01 d0             	add    %rdx,%rax
+  803e7b:	48 89 c6             	mov    %rax,%rsi
+  803e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e83:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803e8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e93:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e97:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803e9b:	48 85 c0             	test   %rax,%rax
+  803e9e:	75 97                	jne    803e37 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803ea0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ea4:	48 89 c6             	mov    %rax,%rsi
+  803ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eac:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	eb 01                	jmp    803ebb <pipe_size+0x2e1>
+    goto err1;
+  803eba:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803ebb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ebf:	48 89 c6             	mov    %rax,%rsi
+  803ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec7:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803ece:	00 00 00 
+  803ed1:	ff d0                	call   *%rax
+  803ed3:	eb 01                	jmp    803ed6 <pipe_size+0x2fc>
+    goto err;
+  803ed5:	90                   	nop
+err:
+  return r;
+  803ed6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ed9:	c9                   	leave
+  803eda:	c3                   	ret
+
+0000000000803edb <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803edb:	55                   	push   %rbp
+  803edc:	48 89 e5             	mov    %rsp,%rbp
+  803edf:	53                   	push   %rbx
+  803ee0:	48 83 ec 28          	sub    $0x28,%rsp
+  803ee4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ee8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803eec:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ef3:	00 00 00 
+  803ef6:	8b 40 04             	mov    0x4(%rax),%eax
+  803ef9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803efe:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f05:	00 00 00 
+  803f08:	48 98                	cltq
+  803f0a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f11:	48 01 d0             	add    %rdx,%rax
+  803f14:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f1a:	8b 00                	mov    (%rax),%eax
+  803f1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f23:	48 89 c7             	mov    %rax,%rdi
+  803f26:	48 b8 e6 4e 80 00 00 	movabs $0x804ee6,%rax
+  803f2d:	00 00 00 
+  803f30:	ff d0                	call   *%rax
+  803f32:	89 c3                	mov    %eax,%ebx
+  803f34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f38:	48 89 c7             	mov    %rax,%rdi
+  803f3b:	48 b8 e6 4e 80 00 00 	movabs $0x804ee6,%rax
+  803f42:	00 00 00 
+  803f45:	ff d0                	call   *%rax
+  803f47:	39 c3                	cmp    %eax,%ebx
+  803f49:	0f 94 c0             	sete   %al
+  803f4c:	0f b6 c0             	movzbl %al,%eax
+  803f4f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f52:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f59:	00 00 00 
+  803f5c:	8b 40 04             	mov    0x4(%rax),%eax
+  803f5f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f64:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f6b:	00 00 00 
+  803f6e:	48 98                	cltq
+  803f70:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f77:	48 01 d0             	add    %rdx,%rax
+  803f7a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f80:	8b 00                	mov    (%rax),%eax
+  803f82:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803f85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f88:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f8b:	75 05                	jne    803f92 <_pipeisclosed+0xb7>
+      return ret;
+  803f8d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f90:	eb 68                	jmp    803ffa <_pipeisclosed+0x11f>
+    if (n != nn)
+  803f92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f95:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f98:	0f 84 4e ff ff ff    	je     803eec <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803f9e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803fa5:	00 00 00 
+  803fa8:	8b 40 04             	mov    0x4(%rax),%eax
+  803fab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fb0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fb7:	00 00 00 
+  803fba:	48 98                	cltq
+  803fbc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fc3:	48 01 d0             	add    %rdx,%rax
+  803fc6:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fcc:	8b 10                	mov    (%rax),%edx
+  803fce:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803fd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fd4:	89 c6                	mov    %eax,%esi
+  803fd6:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  803fdd:	00 00 00 
+  803fe0:	48 89 c7             	mov    %rax,%rdi
+  803fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe8:	49 b8 23 02 80 00 00 	movabs $0x800223,%r8
+  803fef:	00 00 00 
+  803ff2:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803ff5:	e9 f2 fe ff ff       	jmp    803eec <_pipeisclosed+0x11>
+  }
+}
+  803ffa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ffe:	c9                   	leave
+  803fff:	c3                   	ret
+
+0000000000804000 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804000:	55                   	push   %rbp
+  804001:	48 89 e5             	mov    %rsp,%rbp
+  804004:	48 83 ec 30          	sub    $0x30,%rsp
+  804008:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80400b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80400f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804012:	48 89 d6             	mov    %rdx,%rsi
+  804015:	89 c7                	mov    %eax,%edi
+  804017:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  80401e:	00 00 00 
+  804021:	ff d0                	call   *%rax
+  804023:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804026:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80402a:	79 05                	jns    804031 <pipeisclosed+0x31>
+    return r;
+  80402c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80402f:	eb 31                	jmp    804062 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804035:	48 89 c7             	mov    %rax,%rdi
+  804038:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  80403f:	00 00 00 
+  804042:	ff d0                	call   *%rax
+  804044:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80404c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804050:	48 89 d6             	mov    %rdx,%rsi
+  804053:	48 89 c7             	mov    %rax,%rdi
+  804056:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+}
+  804062:	c9                   	leave
+  804063:	c3                   	ret
+
+0000000000804064 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804064:	55                   	push   %rbp
+  804065:	48 89 e5             	mov    %rsp,%rbp
+  804068:	48 83 ec 10          	sub    $0x10,%rsp
+  80406c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804070:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804074:	8b 40 18             	mov    0x18(%rax),%eax
+  804077:	8d 50 01             	lea    0x1(%rax),%edx
+  80407a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407e:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804085:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804088:	85 c0                	test   %eax,%eax
+  80408a:	74 27                	je     8040b3 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80408c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804090:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80409b:	48 83 c0 18          	add    $0x18,%rax
+  80409f:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8040a4:	48 89 c7             	mov    %rax,%rdi
+  8040a7:	48 b8 9c 23 80 00 00 	movabs $0x80239c,%rax
+  8040ae:	00 00 00 
+  8040b1:	ff d0                	call   *%rax
+  }
+}
+  8040b3:	90                   	nop
+  8040b4:	c9                   	leave
+  8040b5:	c3                   	ret
+
+00000000008040b6 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040b6:	55                   	push   %rbp
+  8040b7:	48 89 e5             	mov    %rsp,%rbp
+  8040ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8040be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040c2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8040c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8040d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040d4:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8040d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040db:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8040e2:	89 c6                	mov    %eax,%esi
+  8040e4:	48 89 cf             	mov    %rcx,%rdi
+  8040e7:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8040ee:	00 00 00 
+  8040f1:	ff d0                	call   *%rax
+}
+  8040f3:	90                   	nop
+  8040f4:	c9                   	leave
+  8040f5:	c3                   	ret
+
+00000000008040f6 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040f6:	55                   	push   %rbp
+  8040f7:	48 89 e5             	mov    %rsp,%rbp
+  8040fa:	48 83 ec 70          	sub    $0x70,%rsp
+  8040fe:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804102:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804106:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80410a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80410e:	48 89 c7             	mov    %rax,%rdi
+  804111:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  804118:	00 00 00 
+  80411b:	ff d0                	call   *%rax
+  80411d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804121:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804126:	75 0a                	jne    804132 <devpipe_read+0x3c>
+    return 0;
+  804128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412d:	e9 63 01 00 00       	jmp    804295 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804132:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804136:	8b 40 18             	mov    0x18(%rax),%eax
+  804139:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80413c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804140:	48 8b 10             	mov    (%rax),%rdx
+  804143:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804147:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80414b:	48 39 c2             	cmp    %rax,%rdx
+  80414e:	75 42                	jne    804192 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804150:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804154:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804158:	48 89 d6             	mov    %rdx,%rsi
+  80415b:	48 89 c7             	mov    %rax,%rdi
+  80415e:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  804165:	00 00 00 
+  804168:	ff d0                	call   *%rax
+  80416a:	85 c0                	test   %eax,%eax
+  80416c:	74 0a                	je     804178 <devpipe_read+0x82>
+      return 0;
+  80416e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804173:	e9 1d 01 00 00       	jmp    804295 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804178:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80417b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80417f:	89 d6                	mov    %edx,%esi
+  804181:	48 89 c7             	mov    %rax,%rdi
+  804184:	48 b8 b6 40 80 00 00 	movabs $0x8040b6,%rax
+  80418b:	00 00 00 
+  80418e:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804190:	eb a0                	jmp    804132 <devpipe_read+0x3c>
+      break;
+  804192:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804193:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804197:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80419b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80419f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8041a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041af:	48 8b 00             	mov    (%rax),%rax
+  8041b2:	48 29 c2             	sub    %rax,%rdx
+  8041b5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041c1:	48 39 c2             	cmp    %rax,%rdx
+  8041c4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041c8:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8041cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041d0:	48 8b 00             	mov    (%rax),%rax
+  8041d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041d7:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8041db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041e0:	48 f7 f1             	div    %rcx
+  8041e3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8041e7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041f3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041f7:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8041fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804203:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804207:	48 39 c2             	cmp    %rax,%rdx
+  80420a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80420e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804212:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804216:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80421a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80421e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804222:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422a:	48 89 ce             	mov    %rcx,%rsi
+  80422d:	48 89 c7             	mov    %rax,%rdi
+  804230:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  804237:	00 00 00 
+  80423a:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80423c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804240:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804244:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804248:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80424c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804250:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804254:	48 01 d1             	add    %rdx,%rcx
+  804257:	48 89 c2             	mov    %rax,%rdx
+  80425a:	48 89 cf             	mov    %rcx,%rdi
+  80425d:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  804264:	00 00 00 
+  804267:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804269:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80426d:	48 8b 10             	mov    (%rax),%rdx
+  804270:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804274:	48 01 c2             	add    %rax,%rdx
+  804277:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80427b:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80427e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804282:	48 89 c7             	mov    %rax,%rdi
+  804285:	48 b8 64 40 80 00 00 	movabs $0x804064,%rax
+  80428c:	00 00 00 
+  80428f:	ff d0                	call   *%rax
+  return n;
+  804291:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+
+0000000000804297 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804297:	55                   	push   %rbp
+  804298:	48 89 e5             	mov    %rsp,%rbp
+  80429b:	48 83 ec 70          	sub    $0x70,%rsp
+  80429f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8042a3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042a7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042af:	48 89 c7             	mov    %rax,%rdi
+  8042b2:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+  8042be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8042ca:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8042d1:	00 
+  8042d2:	e9 b8 01 00 00       	jmp    80448f <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8042d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042db:	8b 40 18             	mov    0x18(%rax),%eax
+  8042de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8042e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8042e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ed:	48 8b 00             	mov    (%rax),%rax
+  8042f0:	48 29 c2             	sub    %rax,%rdx
+  8042f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042fb:	48 39 c2             	cmp    %rax,%rdx
+  8042fe:	75 4d                	jne    80434d <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804300:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804304:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804308:	48 89 d6             	mov    %rdx,%rsi
+  80430b:	48 89 c7             	mov    %rax,%rdi
+  80430e:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  804315:	00 00 00 
+  804318:	ff d0                	call   *%rax
+  80431a:	85 c0                	test   %eax,%eax
+  80431c:	74 0a                	je     804328 <devpipe_write+0x91>
+        return 0;
+  80431e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804323:	e9 79 01 00 00       	jmp    8044a1 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804328:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80432b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432f:	89 d6                	mov    %edx,%esi
+  804331:	48 89 c7             	mov    %rax,%rdi
+  804334:	48 b8 b6 40 80 00 00 	movabs $0x8040b6,%rax
+  80433b:	00 00 00 
+  80433e:	ff d0                	call   *%rax
+      m = 0;
+  804340:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804347:	00 
+      continue;
+  804348:	e9 3a 01 00 00       	jmp    804487 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80434d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804351:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804355:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804365:	48 8b 08             	mov    (%rax),%rcx
+  804368:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80436c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804370:	48 29 c1             	sub    %rax,%rcx
+  804373:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804377:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80437b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80437f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804383:	48 39 c2             	cmp    %rax,%rdx
+  804386:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80438a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80438e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804392:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804396:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80439a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80439e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a3:	48 f7 f1             	div    %rcx
+  8043a6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8043aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043b6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043ba:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043be:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043c6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8043ca:	48 39 c2             	cmp    %rax,%rdx
+  8043cd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043d1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8043d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043d9:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8043dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043e1:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8043e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043e9:	48 01 d1             	add    %rdx,%rcx
+  8043ec:	48 89 c2             	mov    %rax,%rdx
+  8043ef:	48 89 cf             	mov    %rcx,%rdi
+  8043f2:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8043f9:	00 00 00 
+  8043fc:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8043fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804402:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804406:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80440a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80440e:	73 4d                	jae    80445d <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804410:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804414:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804418:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80441c:	48 29 c2             	sub    %rax,%rdx
+  80441f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804423:	48 01 c2             	add    %rax,%rdx
+  804426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80442a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80442e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804432:	48 89 c1             	mov    %rax,%rcx
+  804435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804439:	48 01 c1             	add    %rax,%rcx
+  80443c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804440:	48 01 c1             	add    %rax,%rcx
+  804443:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804447:	48 83 c0 20          	add    $0x20,%rax
+  80444b:	48 89 ce             	mov    %rcx,%rsi
+  80444e:	48 89 c7             	mov    %rax,%rdi
+  804451:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  804458:	00 00 00 
+  80445b:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80445d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804461:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804469:	48 01 c2             	add    %rax,%rdx
+  80446c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804470:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804478:	48 89 c7             	mov    %rax,%rdi
+  80447b:	48 b8 64 40 80 00 00 	movabs $0x804064,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804487:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80448b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80448f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804493:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804497:	0f 82 3a fe ff ff    	jb     8042d7 <devpipe_write+0x40>
+  }
+
+  return i;
+  80449d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8044a1:	c9                   	leave
+  8044a2:	c3                   	ret
+
+00000000008044a3 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8044a3:	55                   	push   %rbp
+  8044a4:	48 89 e5             	mov    %rsp,%rbp
+  8044a7:	48 83 ec 40          	sub    $0x40,%rsp
+  8044ab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044af:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044ba:	48 89 c7             	mov    %rax,%rdi
+  8044bd:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8044cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8044d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d8:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8044dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044e0:	48 89 d6             	mov    %rdx,%rsi
+  8044e3:	48 89 c7             	mov    %rax,%rdi
+  8044e6:	48 b8 7e 31 80 00 00 	movabs $0x80317e,%rax
+  8044ed:	00 00 00 
+  8044f0:	ff d0                	call   *%rax
+  8044f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f9:	79 08                	jns    804503 <devpipe_poll+0x60>
+    return r;
+  8044fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044fe:	e9 85 00 00 00       	jmp    804588 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804503:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804506:	83 e0 01             	and    $0x1,%eax
+  804509:	85 c0                	test   %eax,%eax
+  80450b:	74 18                	je     804525 <devpipe_poll+0x82>
+  80450d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804511:	48 8b 10             	mov    (%rax),%rdx
+  804514:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804518:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80451c:	48 39 c2             	cmp    %rax,%rdx
+  80451f:	74 04                	je     804525 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804521:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804525:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804528:	83 e0 02             	and    $0x2,%eax
+  80452b:	85 c0                	test   %eax,%eax
+  80452d:	74 23                	je     804552 <devpipe_poll+0xaf>
+  80452f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804533:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453b:	48 8b 00             	mov    (%rax),%rax
+  80453e:	48 29 c2             	sub    %rax,%rdx
+  804541:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804545:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804549:	48 39 c2             	cmp    %rax,%rdx
+  80454c:	73 04                	jae    804552 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80454e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804552:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804556:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80455a:	48 89 d6             	mov    %rdx,%rsi
+  80455d:	48 89 c7             	mov    %rax,%rdi
+  804560:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  804567:	00 00 00 
+  80456a:	ff d0                	call   *%rax
+  80456c:	85 c0                	test   %eax,%eax
+  80456e:	74 04                	je     804574 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804570:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804574:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804578:	75 0b                	jne    804585 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80457a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80457e:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804585:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804588:	c9                   	leave
+  804589:	c3                   	ret
+
+000000000080458a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80458a:	55                   	push   %rbp
+  80458b:	48 89 e5             	mov    %rsp,%rbp
+  80458e:	48 83 ec 20          	sub    $0x20,%rsp
+  804592:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804596:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80459a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80459e:	48 89 c7             	mov    %rax,%rdi
+  8045a1:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8045a8:	00 00 00 
+  8045ab:	ff d0                	call   *%rax
+  8045ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045b5:	48 ba f1 55 80 00 00 	movabs $0x8055f1,%rdx
+  8045bc:	00 00 00 
+  8045bf:	48 89 d6             	mov    %rdx,%rsi
+  8045c2:	48 89 c7             	mov    %rax,%rdi
+  8045c5:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  8045cc:	00 00 00 
+  8045cf:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8045d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045d9:	89 c1                	mov    %eax,%ecx
+  8045db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045df:	48 8b 00             	mov    (%rax),%rax
+  8045e2:	89 c2                	mov    %eax,%edx
+  8045e4:	89 c8                	mov    %ecx,%eax
+  8045e6:	29 d0                	sub    %edx,%eax
+  8045e8:	89 c2                	mov    %eax,%edx
+  8045ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ee:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8045f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8045ff:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804602:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804606:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  80460d:	00 00 00 
+  804610:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804617:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80461c:	c9                   	leave
+  80461d:	c3                   	ret
+
+000000000080461e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80461e:	55                   	push   %rbp
+  80461f:	48 89 e5             	mov    %rsp,%rbp
+  804622:	48 83 ec 40          	sub    $0x40,%rsp
+  804626:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80462a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80462e:	48 89 c7             	mov    %rax,%rdi
+  804631:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  804638:	00 00 00 
+  80463b:	ff d0                	call   *%rax
+  80463d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804641:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804648:	00 
+  804649:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80464d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804651:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804655:	48 01 d0             	add    %rdx,%rax
+  804658:	48 83 c0 1f          	add    $0x1f,%rax
+  80465c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804660:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804664:	ba 00 00 00 00       	mov    $0x0,%edx
+  804669:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80466d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804671:	48 29 d0             	sub    %rdx,%rax
+  804674:	48 c1 e8 0c          	shr    $0xc,%rax
+  804678:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80467c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804680:	48 89 c6             	mov    %rax,%rsi
+  804683:	bf 00 00 00 00       	mov    $0x0,%edi
+  804688:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  80468f:	00 00 00 
+  804692:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804694:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804698:	48 89 c7             	mov    %rax,%rdi
+  80469b:	48 b8 64 40 80 00 00 	movabs $0x804064,%rax
+  8046a2:	00 00 00 
+  8046a5:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046af:	eb 2f                	jmp    8046e0 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b5:	48 83 e8 01          	sub    $0x1,%rax
+  8046b9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046bd:	48 89 c2             	mov    %rax,%rdx
+  8046c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c4:	48 01 d0             	add    %rdx,%rax
+  8046c7:	48 89 c6             	mov    %rax,%rsi
+  8046ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046cf:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  8046d6:	00 00 00 
+  8046d9:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046db:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046e0:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8046e5:	77 ca                	ja     8046b1 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8046e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046eb:	48 89 c6             	mov    %rax,%rsi
+  8046ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046f3:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  8046fa:	00 00 00 
+  8046fd:	ff d0                	call   *%rax
+}
+  8046ff:	c9                   	leave
+  804700:	c3                   	ret
+
+0000000000804701 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804701:	55                   	push   %rbp
+  804702:	48 89 e5             	mov    %rsp,%rbp
+  804705:	48 83 ec 08          	sub    $0x8,%rsp
+  804709:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80470c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804710:	75 10                	jne    804722 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804712:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804719:	00 00 00 
+  80471c:	8b 00                	mov    (%rax),%eax
+  80471e:	48 98                	cltq
+  804720:	eb 05                	jmp    804727 <vsyscall+0x26>
+  }
+  return 0;
+  804722:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804727:	c9                   	leave
+  804728:	c3                   	ret
+
+0000000000804729 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804729:	55                   	push   %rbp
+  80472a:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80472d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804732:	48 b8 01 47 80 00 00 	movabs $0x804701,%rax
+  804739:	00 00 00 
+  80473c:	ff d0                	call   *%rax
+}
+  80473e:	5d                   	pop    %rbp
+  80473f:	c3                   	ret
+
+0000000000804740 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804740:	55                   	push   %rbp
+  804741:	48 89 e5             	mov    %rsp,%rbp
+  804744:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804748:	0f 31                	rdtsc
+  80474a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80474d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804750:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804753:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804756:	48 c1 e2 20          	shl    $0x20,%rdx
+  80475a:	48 09 d0             	or     %rdx,%rax
+  80475d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804761:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804765:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804769:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804770:	00 00 00 
+  804773:	8b 40 08             	mov    0x8(%rax),%eax
+  804776:	48 98                	cltq
+  804778:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80477c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804780:	ba 00 00 00 00       	mov    $0x0,%edx
+  804785:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804789:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804794:	ba 00 00 00 00       	mov    $0x0,%edx
+  804799:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80479d:	48 89 d0             	mov    %rdx,%rax
+  8047a0:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8047a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ac:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047b0:	48 01 c8             	add    %rcx,%rax
+}
+  8047b3:	c9                   	leave
+  8047b4:	c3                   	ret
+
+00000000008047b5 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047b5:	55                   	push   %rbp
+  8047b6:	48 89 e5             	mov    %rsp,%rbp
+  8047b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8047bd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047c3:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8047c6:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8047ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8047cf:	48 89 c7             	mov    %rax,%rdi
+  8047d2:	48 b8 8a 1d 80 00 00 	movabs $0x801d8a,%rax
+  8047d9:	00 00 00 
+  8047dc:	ff d0                	call   *%rax
+}
+  8047de:	90                   	nop
+  8047df:	c9                   	leave
+  8047e0:	c3                   	ret
+
+00000000008047e1 <getchar>:
+
+int
+getchar(void) {
+  8047e1:	55                   	push   %rbp
+  8047e2:	48 89 e5             	mov    %rsp,%rbp
+  8047e5:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8047e9:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8047ed:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047f2:	48 89 c6             	mov    %rax,%rsi
+  8047f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047fa:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  804801:	00 00 00 
+  804804:	ff d0                	call   *%rax
+  804806:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804809:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80480d:	79 05                	jns    804814 <getchar+0x33>
+    return r;
+  80480f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804812:	eb 14                	jmp    804828 <getchar+0x47>
+  if (r < 1)
+  804814:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804818:	7f 07                	jg     804821 <getchar+0x40>
+    return -E_EOF;
+  80481a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80481f:	eb 07                	jmp    804828 <getchar+0x47>
+  return c;
+  804821:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804825:	0f b6 c0             	movzbl %al,%eax
+}
+  804828:	c9                   	leave
+  804829:	c3                   	ret
+
+000000000080482a <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80482a:	55                   	push   %rbp
+  80482b:	48 89 e5             	mov    %rsp,%rbp
+  80482e:	48 83 ec 20          	sub    $0x20,%rsp
+  804832:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804835:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804839:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80483c:	48 89 d6             	mov    %rdx,%rsi
+  80483f:	89 c7                	mov    %eax,%edi
+  804841:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  804848:	00 00 00 
+  80484b:	ff d0                	call   *%rax
+  80484d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804850:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804854:	79 05                	jns    80485b <iscons+0x31>
+    return r;
+  804856:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804859:	eb 1a                	jmp    804875 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80485b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80485f:	8b 10                	mov    (%rax),%edx
+  804861:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804868:	00 00 00 
+  80486b:	8b 00                	mov    (%rax),%eax
+  80486d:	39 c2                	cmp    %eax,%edx
+  80486f:	0f 94 c0             	sete   %al
+  804872:	0f b6 c0             	movzbl %al,%eax
+}
+  804875:	c9                   	leave
+  804876:	c3                   	ret
+
+0000000000804877 <opencons>:
+
+int
+opencons(void) {
+  804877:	55                   	push   %rbp
+  804878:	48 89 e5             	mov    %rsp,%rbp
+  80487b:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80487f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804883:	48 89 c7             	mov    %rax,%rdi
+  804886:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  80488d:	00 00 00 
+  804890:	ff d0                	call   *%rax
+  804892:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804895:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804899:	79 05                	jns    8048a0 <opencons+0x29>
+    return r;
+  80489b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80489e:	eb 66                	jmp    804906 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8048a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048a4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048a9:	48 89 c6             	mov    %rax,%rsi
+  8048ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b1:	48 b8 a1 1f 80 00 00 	movabs $0x801fa1,%rax
+  8048b8:	00 00 00 
+  8048bb:	ff d0                	call   *%rax
+  8048bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048c4:	79 05                	jns    8048cb <opencons+0x54>
+    return r;
+  8048c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048c9:	eb 3b                	jmp    804906 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8048cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048cf:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8048d6:	00 00 00 
+  8048d9:	8b 12                	mov    (%rdx),%edx
+  8048db:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8048dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8048e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048ec:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8048f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f7:	48 89 c7             	mov    %rax,%rdi
+  8048fa:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  804901:	00 00 00 
+  804904:	ff d0                	call   *%rax
+}
+  804906:	c9                   	leave
+  804907:	c3                   	ret
+
+0000000000804908 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804908:	55                   	push   %rbp
+  804909:	48 89 e5             	mov    %rsp,%rbp
+  80490c:	48 83 ec 20          	sub    $0x20,%rsp
+  804910:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804913:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804916:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80491a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80491d:	48 89 d6             	mov    %rdx,%rsi
+  804920:	89 c7                	mov    %eax,%edi
+  804922:	48 b8 b8 27 80 00 00 	movabs $0x8027b8,%rax
+  804929:	00 00 00 
+  80492c:	ff d0                	call   *%rax
+  80492e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804931:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804935:	79 05                	jns    80493c <consmode+0x34>
+    return r;
+  804937:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80493a:	eb 34                	jmp    804970 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80493c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804940:	8b 10                	mov    (%rax),%edx
+  804942:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804949:	00 00 00 
+  80494c:	8b 00                	mov    (%rax),%eax
+  80494e:	39 c2                	cmp    %eax,%edx
+  804950:	74 07                	je     804959 <consmode+0x51>
+    return -E_INVAL;
+  804952:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804957:	eb 17                	jmp    804970 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804959:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80495d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804960:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804963:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804967:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80496a:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80496d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804970:	c9                   	leave
+  804971:	c3                   	ret
+
+0000000000804972 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804972:	55                   	push   %rbp
+  804973:	48 89 e5             	mov    %rsp,%rbp
+  804976:	48 83 ec 20          	sub    $0x20,%rsp
+  80497a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80497e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804982:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804986:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498a:	8b 50 0c             	mov    0xc(%rax),%edx
+  80498d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804991:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804995:	48 89 ce             	mov    %rcx,%rsi
+  804998:	48 89 c7             	mov    %rax,%rdi
+  80499b:	48 b8 fb 22 80 00 00 	movabs $0x8022fb,%rax
+  8049a2:	00 00 00 
+  8049a5:	ff d0                	call   *%rax
+  8049a7:	48 98                	cltq
+}
+  8049a9:	c9                   	leave
+  8049aa:	c3                   	ret
+
+00000000008049ab <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049ab:	55                   	push   %rbp
+  8049ac:	48 89 e5             	mov    %rsp,%rbp
+  8049af:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049b6:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049bd:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049c4:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8049cb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049d2:	eb 74                	jmp    804a48 <devcons_write+0x9d>
+    m = n - tot;
+  8049d4:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8049db:	89 c2                	mov    %eax,%edx
+  8049dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049e0:	29 c2                	sub    %eax,%edx
+  8049e2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8049e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049e8:	83 f8 7f             	cmp    $0x7f,%eax
+  8049eb:	76 07                	jbe    8049f4 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8049ed:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8049f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049f7:	48 63 d0             	movslq %eax,%rdx
+  8049fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049fd:	48 63 c8             	movslq %eax,%rcx
+  804a00:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804a07:	48 01 c1             	add    %rax,%rcx
+  804a0a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a11:	48 89 ce             	mov    %rcx,%rsi
+  804a14:	48 89 c7             	mov    %rax,%rdi
+  804a17:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  804a1e:	00 00 00 
+  804a21:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a23:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a26:	48 63 d0             	movslq %eax,%rdx
+  804a29:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a30:	48 89 d6             	mov    %rdx,%rsi
+  804a33:	48 89 c7             	mov    %rax,%rdi
+  804a36:	48 b8 8a 1d 80 00 00 	movabs $0x801d8a,%rax
+  804a3d:	00 00 00 
+  804a40:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a42:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a45:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a4b:	48 98                	cltq
+  804a4d:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a54:	0f 82 7a ff ff ff    	jb     8049d4 <devcons_write+0x29>
+  }
+  return tot;
+  804a5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a5d:	48 98                	cltq
+}
+  804a5f:	c9                   	leave
+  804a60:	c3                   	ret
+
+0000000000804a61 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a61:	55                   	push   %rbp
+  804a62:	48 89 e5             	mov    %rsp,%rbp
+  804a65:	48 83 ec 08          	sub    $0x8,%rsp
+  804a69:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a72:	c9                   	leave
+  804a73:	c3                   	ret
+
+0000000000804a74 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a74:	55                   	push   %rbp
+  804a75:	48 89 e5             	mov    %rsp,%rbp
+  804a78:	48 83 ec 10          	sub    $0x10,%rsp
+  804a7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a80:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a88:	48 ba fd 55 80 00 00 	movabs $0x8055fd,%rdx
+  804a8f:	00 00 00 
+  804a92:	48 89 d6             	mov    %rdx,%rsi
+  804a95:	48 89 c7             	mov    %rax,%rdi
+  804a98:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  804a9f:	00 00 00 
+  804aa2:	ff d0                	call   *%rax
+  return 0;
+  804aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804aa9:	c9                   	leave
+  804aaa:	c3                   	ret
+
+0000000000804aab <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aab:	55                   	push   %rbp
+  804aac:	48 89 e5             	mov    %rsp,%rbp
+  804aaf:	48 83 ec 30          	sub    $0x30,%rsp
+  804ab3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ab7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804aba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804abe:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804ac5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ac8:	83 e0 02             	and    $0x2,%eax
+  804acb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad2:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ad5:	83 f8 01             	cmp    $0x1,%eax
+  804ad8:	75 04                	jne    804ade <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804ada:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804ade:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ae1:	83 e0 01             	and    $0x1,%eax
+  804ae4:	85 c0                	test   %eax,%eax
+  804ae6:	74 44                	je     804b2c <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ae8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804af0:	89 c2                	mov    %eax,%edx
+  804af2:	be 00 00 00 00       	mov    $0x0,%esi
+  804af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afc:	48 b8 e9 23 80 00 00 	movabs $0x8023e9,%rax
+  804b03:	00 00 00 
+  804b06:	ff d0                	call   *%rax
+  804b08:	83 f8 01             	cmp    $0x1,%eax
+  804b0b:	75 06                	jne    804b13 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b0d:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b11:	eb 19                	jmp    804b2c <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b17:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b1d:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b20:	89 c2                	mov    %eax,%edx
+  804b22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b26:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b2f:	c9                   	leave
+  804b30:	c3                   	ret
+
+0000000000804b31 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b31:	55                   	push   %rbp
+  804b32:	48 89 e5             	mov    %rsp,%rbp
+  804b35:	53                   	push   %rbx
+  804b36:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b3d:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b44:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b4a:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b51:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b58:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b5f:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804b66:	84 c0                	test   %al,%al
+  804b68:	74 23                	je     804b8d <_panic+0x5c>
+  804b6a:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804b71:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804b75:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804b79:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804b7d:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804b81:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804b85:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804b89:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b8d:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804b94:	00 00 00 
+  804b97:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804b9e:	00 00 00 
+  804ba1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804ba5:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804bac:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804bb3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bba:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bc1:	00 00 00 
+  804bc4:	48 8b 18             	mov    (%rax),%rbx
+  804bc7:	48 b8 28 1f 80 00 00 	movabs $0x801f28,%rax
+  804bce:	00 00 00 
+  804bd1:	ff d0                	call   *%rax
+  804bd3:	89 c6                	mov    %eax,%esi
+  804bd5:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804bdb:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804be2:	41 89 d0             	mov    %edx,%r8d
+  804be5:	48 89 c1             	mov    %rax,%rcx
+  804be8:	48 89 da             	mov    %rbx,%rdx
+  804beb:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804bf2:	00 00 00 
+  804bf5:	48 89 c7             	mov    %rax,%rdi
+  804bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfd:	49 b9 23 02 80 00 00 	movabs $0x800223,%r9
+  804c04:	00 00 00 
+  804c07:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804c0a:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c11:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c18:	48 89 d6             	mov    %rdx,%rsi
+  804c1b:	48 89 c7             	mov    %rax,%rdi
+  804c1e:	48 b8 98 01 80 00 00 	movabs $0x800198,%rax
+  804c25:	00 00 00 
+  804c28:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c2a:	48 b8 2b 56 80 00 00 	movabs $0x80562b,%rax
+  804c31:	00 00 00 
+  804c34:	48 89 c7             	mov    %rax,%rdi
+  804c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3c:	48 ba 23 02 80 00 00 	movabs $0x800223,%rdx
+  804c43:	00 00 00 
+  804c46:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c48:	cc                   	int3
+  804c49:	eb fd                	jmp    804c48 <_panic+0x117>
+
+0000000000804c4b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c4b:	55                   	push   %rbp
+  804c4c:	48 89 e5             	mov    %rsp,%rbp
+  804c4f:	48 83 ec 20          	sub    $0x20,%rsp
+  804c53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c5b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c5f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c63:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c6b:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c72:	48 89 c7             	mov    %rax,%rdi
+  804c75:	48 b8 83 4c 80 00 00 	movabs $0x804c83,%rax
+  804c7c:	00 00 00 
+  804c7f:	ff d0                	call   *%rax
+}
+  804c81:	c9                   	leave
+  804c82:	c3                   	ret
+
+0000000000804c83 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c83:	55                   	push   %rbp
+  804c84:	48 89 e5             	mov    %rsp,%rbp
+  804c87:	48 83 ec 30          	sub    $0x30,%rsp
+  804c8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c8f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c93:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c97:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c9b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ca0:	75 0e                	jne    804cb0 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804ca2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ca9:	00 00 00 
+  804cac:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804cb0:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cb5:	75 18                	jne    804ccf <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cbb:	48 89 c7             	mov    %rax,%rdi
+  804cbe:	48 b8 e1 21 80 00 00 	movabs $0x8021e1,%rax
+  804cc5:	00 00 00 
+  804cc8:	ff d0                	call   *%rax
+  804cca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ccd:	eb 1d                	jmp    804cec <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804ccf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd7:	48 89 d6             	mov    %rdx,%rsi
+  804cda:	48 89 c7             	mov    %rax,%rdi
+  804cdd:	48 b8 27 22 80 00 00 	movabs $0x802227,%rax
+  804ce4:	00 00 00 
+  804ce7:	ff d0                	call   *%rax
+  804ce9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cf0:	79 2a                	jns    804d1c <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cf2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf7:	74 0a                	je     804d03 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cfd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804d03:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d08:	74 0a                	je     804d14 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d0e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d17:	e9 aa 00 00 00       	jmp    804dc6 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d1c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d21:	74 36                	je     804d59 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d23:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d2a:	00 00 00 
+  804d2d:	8b 40 04             	mov    0x4(%rax),%eax
+  804d30:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d35:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d3c:	00 00 00 
+  804d3f:	48 98                	cltq
+  804d41:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d48:	48 01 d0             	add    %rdx,%rax
+  804d4b:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d51:	8b 10                	mov    (%rax),%edx
+  804d53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d57:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d59:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d5e:	74 36                	je     804d96 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d60:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d67:	00 00 00 
+  804d6a:	8b 40 04             	mov    0x4(%rax),%eax
+  804d6d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d72:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d79:	00 00 00 
+  804d7c:	48 98                	cltq
+  804d7e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d85:	48 01 d0             	add    %rdx,%rax
+  804d88:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d8e:	8b 10                	mov    (%rax),%edx
+  804d90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d94:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d96:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d9d:	00 00 00 
+  804da0:	8b 40 04             	mov    0x4(%rax),%eax
+  804da3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804da8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804daf:	00 00 00 
+  804db2:	48 98                	cltq
+  804db4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dbb:	48 01 d0             	add    %rdx,%rax
+  804dbe:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dc4:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dc6:	c9                   	leave
+  804dc7:	c3                   	ret
+
+0000000000804dc8 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dc8:	55                   	push   %rbp
+  804dc9:	48 89 e5             	mov    %rsp,%rbp
+  804dcc:	48 83 ec 30          	sub    $0x30,%rsp
+  804dd0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dd3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dd6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dda:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804ddd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804de2:	75 5e                	jne    804e42 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804de4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804deb:	00 00 00 
+  804dee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804df2:	eb 4e                	jmp    804e42 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804df4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804df8:	79 3c                	jns    804e36 <ipc_send+0x6e>
+  804dfa:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dfe:	74 36                	je     804e36 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804e00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e03:	89 c1                	mov    %eax,%ecx
+  804e05:	48 b8 30 56 80 00 00 	movabs $0x805630,%rax
+  804e0c:	00 00 00 
+  804e0f:	48 89 c2             	mov    %rax,%rdx
+  804e12:	be 54 00 00 00       	mov    $0x54,%esi
+  804e17:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  804e1e:	00 00 00 
+  804e21:	48 89 c7             	mov    %rax,%rdi
+  804e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e29:	49 b8 31 4b 80 00 00 	movabs $0x804b31,%r8
+  804e30:	00 00 00 
+  804e33:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e36:	48 b8 64 1f 80 00 00 	movabs $0x801f64,%rax
+  804e3d:	00 00 00 
+  804e40:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e42:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e45:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e48:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e4f:	89 c7                	mov    %eax,%edi
+  804e51:	48 b8 8a 21 80 00 00 	movabs $0x80218a,%rax
+  804e58:	00 00 00 
+  804e5b:	ff d0                	call   *%rax
+  804e5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e60:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e64:	75 8e                	jne    804df4 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e66:	48 b8 64 1f 80 00 00 	movabs $0x801f64,%rax
+  804e6d:	00 00 00 
+  804e70:	ff d0                	call   *%rax
+}
+  804e72:	90                   	nop
+  804e73:	c9                   	leave
+  804e74:	c3                   	ret
+
+0000000000804e75 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e75:	55                   	push   %rbp
+  804e76:	48 89 e5             	mov    %rsp,%rbp
+  804e79:	48 83 ec 18          	sub    $0x18,%rsp
+  804e7d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e87:	eb 4d                	jmp    804ed6 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e89:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e90:	00 00 00 
+  804e93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e96:	48 98                	cltq
+  804e98:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e9f:	48 01 d0             	add    %rdx,%rax
+  804ea2:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ea8:	8b 00                	mov    (%rax),%eax
+  804eaa:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ead:	75 23                	jne    804ed2 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804eaf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eb6:	00 00 00 
+  804eb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ebc:	48 98                	cltq
+  804ebe:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ec5:	48 01 d0             	add    %rdx,%rax
+  804ec8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ece:	8b 00                	mov    (%rax),%eax
+  804ed0:	eb 12                	jmp    804ee4 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ed2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ed6:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804edd:	7e aa                	jle    804e89 <ipc_find_env+0x14>
+  return 0;
+  804edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ee4:	c9                   	leave
+  804ee5:	c3                   	ret
+
+0000000000804ee6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ee6:	55                   	push   %rbp
+  804ee7:	48 89 e5             	mov    %rsp,%rbp
+  804eea:	48 83 ec 18          	sub    $0x18,%rsp
+  804eee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ef2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef6:	48 c1 e8 27          	shr    $0x27,%rax
+  804efa:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804eff:	48 89 c2             	mov    %rax,%rdx
+  804f02:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f09:	01 00 00 
+  804f0c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f10:	83 e0 01             	and    $0x1,%eax
+  804f13:	48 85 c0             	test   %rax,%rax
+  804f16:	74 63                	je     804f7b <pageref+0x95>
+  804f18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f1c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f20:	48 89 c2             	mov    %rax,%rdx
+  804f23:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f2a:	01 00 00 
+  804f2d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f31:	83 e0 01             	and    $0x1,%eax
+  804f34:	48 85 c0             	test   %rax,%rax
+  804f37:	74 42                	je     804f7b <pageref+0x95>
+  804f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3d:	48 c1 e8 15          	shr    $0x15,%rax
+  804f41:	48 89 c2             	mov    %rax,%rdx
+  804f44:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f4b:	01 00 00 
+  804f4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f52:	83 e0 01             	and    $0x1,%eax
+  804f55:	48 85 c0             	test   %rax,%rax
+  804f58:	74 21                	je     804f7b <pageref+0x95>
+  804f5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f62:	48 89 c2             	mov    %rax,%rdx
+  804f65:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f6c:	01 00 00 
+  804f6f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f73:	83 e0 01             	and    $0x1,%eax
+  804f76:	48 85 c0             	test   %rax,%rax
+  804f79:	75 07                	jne    804f82 <pageref+0x9c>
+    return 0;
+  804f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f80:	eb 53                	jmp    804fd5 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f86:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f8a:	48 89 c2             	mov    %rax,%rdx
+  804f8d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f94:	01 00 00 
+  804f97:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa3:	83 e0 01             	and    $0x1,%eax
+  804fa6:	48 85 c0             	test   %rax,%rax
+  804fa9:	75 07                	jne    804fb2 <pageref+0xcc>
+    return 0;
+  804fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb0:	eb 23                	jmp    804fd5 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb6:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fba:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fc1:	00 00 00 
+  804fc4:	48 c1 e0 04          	shl    $0x4,%rax
+  804fc8:	48 01 d0             	add    %rdx,%rax
+  804fcb:	48 83 c0 08          	add    $0x8,%rax
+  804fcf:	0f b7 00             	movzwl (%rax),%eax
+  804fd2:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fd5:	c9                   	leave
+  804fd6:	c3                   	ret
+  804fd7:	90                   	nop
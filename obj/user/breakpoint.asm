@@ -0,0 +1,8040 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 19 00 00 00       	call   800045 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// program to cause a breakpoint trap
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  asm volatile("int $3");
+  800041:	cc                   	int3
+}
+  800042:	90                   	nop
+  800043:	c9                   	leave
+  800044:	c3                   	ret
+
+0000000000800045 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800045:	55                   	push   %rbp
+  800046:	48 89 e5             	mov    %rsp,%rbp
+  800049:	48 83 ec 20          	sub    $0x20,%rsp
+  80004d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800050:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800054:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80005b:	00 00 00 
+  80005e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800062:	eb 13                	jmp    800077 <libmain+0x32>
+    (*ctor)();
+  800064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800068:	48 8b 10             	mov    (%rax),%rdx
+  80006b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800070:	ff d2                	call   *%rdx
+    ctor++;
+  800072:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800077:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80007e:	00 00 00 
+  800081:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800085:	72 dd                	jb     800064 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800087:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80008b:	7e 14                	jle    8000a1 <libmain+0x5c>
+    binaryname = argv[0];
+  80008d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800091:	48 8b 00             	mov    (%rax),%rax
+  800094:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80009b:	00 00 00 
+  80009e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000a8:	48 89 d6             	mov    %rdx,%rsi
+  8000ab:	89 c7                	mov    %eax,%edi
+  8000ad:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000b4:	00 00 00 
+  8000b7:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000b9:	48 b8 c8 00 80 00 00 	movabs $0x8000c8,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+#endif
+}
+  8000c5:	90                   	nop
+  8000c6:	c9                   	leave
+  8000c7:	c3                   	ret
+
+00000000008000c8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000c8:	55                   	push   %rbp
+  8000c9:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000cc:	48 b8 73 0e 80 00 00 	movabs $0x800e73,%rax
+  8000d3:	00 00 00 
+  8000d6:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000dd:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+}
+  8000e9:	90                   	nop
+  8000ea:	5d                   	pop    %rbp
+  8000eb:	c3                   	ret
+
+00000000008000ec <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8000ec:	55                   	push   %rbp
+  8000ed:	48 89 e5             	mov    %rsp,%rbp
+  8000f0:	53                   	push   %rbx
+  8000f1:	48 83 ec 48          	sub    $0x48,%rsp
+  8000f5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8000f9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8000fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800101:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800105:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800109:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80010d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800111:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800115:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800119:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80011d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800121:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800125:	4c 89 c3             	mov    %r8,%rbx
+  800128:	cd 30                	int    $0x30
+  80012a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80012e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800133:	74 46                	je     80017b <syscall+0x8f>
+  800135:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80013a:	7e 3f                	jle    80017b <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80013c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800140:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800144:	49 89 d0             	mov    %rdx,%r8
+  800147:	48 89 c1             	mov    %rax,%rcx
+  80014a:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  800151:	00 00 00 
+  800154:	48 89 c2             	mov    %rax,%rdx
+  800157:	be 22 00 00 00       	mov    $0x22,%esi
+  80015c:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800163:	00 00 00 
+  800166:	48 89 c7             	mov    %rax,%rdi
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	49 b9 2c 2f 80 00 00 	movabs $0x802f2c,%r9
+  800175:	00 00 00 
+  800178:	41 ff d1             	call   *%r9
+
+  return ret;
+  80017b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80017f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800183:	c9                   	leave
+  800184:	c3                   	ret
+
+0000000000800185 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  800185:	55                   	push   %rbp
+  800186:	48 89 e5             	mov    %rsp,%rbp
+  800189:	48 83 ec 10          	sub    $0x10,%rsp
+  80018d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800191:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800195:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80019d:	48 83 ec 08          	sub    $0x8,%rsp
+  8001a1:	6a 00                	push   $0x0
+  8001a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001af:	48 89 d1             	mov    %rdx,%rcx
+  8001b2:	48 89 c2             	mov    %rax,%rdx
+  8001b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bf:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8001c6:	00 00 00 
+  8001c9:	ff d0                	call   *%rax
+  8001cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001cf:	90                   	nop
+  8001d0:	c9                   	leave
+  8001d1:	c3                   	ret
+
+00000000008001d2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001d2:	55                   	push   %rbp
+  8001d3:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001da:	6a 00                	push   $0x0
+  8001dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001fc:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	48 83 ec 10          	sub    $0x10,%rsp
+  800216:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800219:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80021c:	48 98                	cltq
+  80021e:	48 83 ec 08          	sub    $0x8,%rsp
+  800222:	6a 00                	push   $0x0
+  800224:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80022a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800235:	48 89 c2             	mov    %rax,%rdx
+  800238:	be 01 00 00 00       	mov    $0x1,%esi
+  80023d:	bf 03 00 00 00       	mov    $0x3,%edi
+  800242:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+  80024e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800252:	c9                   	leave
+  800253:	c3                   	ret
+
+0000000000800254 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800254:	55                   	push   %rbp
+  800255:	48 89 e5             	mov    %rsp,%rbp
+  800258:	48 83 ec 10          	sub    $0x10,%rsp
+  80025c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80025f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800262:	48 98                	cltq
+  800264:	48 83 ec 08          	sub    $0x8,%rsp
+  800268:	6a 00                	push   $0x0
+  80026a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800276:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80027b:	48 89 c2             	mov    %rax,%rdx
+  80027e:	be 00 00 00 00       	mov    $0x0,%esi
+  800283:	bf 04 00 00 00       	mov    $0x4,%edi
+  800288:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+  800294:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800298:	90                   	nop
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 20          	sub    $0x20,%rsp
+  8002a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ad:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002b0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002b5:	cd 30                	int    $0x30
+  8002b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002bb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002bf:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002c4:	7e 3d                	jle    800303 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002ca:	49 89 c0             	mov    %rax,%r8
+  8002cd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002d2:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002d9:	00 00 00 
+  8002dc:	48 89 c2             	mov    %rax,%rdx
+  8002df:	be 49 00 00 00       	mov    $0x49,%esi
+  8002e4:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  8002eb:	00 00 00 
+  8002ee:	48 89 c7             	mov    %rax,%rdi
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 b9 2c 2f 80 00 00 	movabs $0x802f2c,%r9
+  8002fd:	00 00 00 
+  800300:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800303:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800308:	75 13                	jne    80031d <sys_env_wait+0x82>
+  80030a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80030f:	74 0c                	je     80031d <sys_env_wait+0x82>
+    *status = st;
+  800311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800315:	89 c2                	mov    %eax,%edx
+  800317:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80031b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80031d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800321:	c9                   	leave
+  800322:	c3                   	ret
+
+0000000000800323 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800323:	55                   	push   %rbp
+  800324:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800327:	48 83 ec 08          	sub    $0x8,%rsp
+  80032b:	6a 00                	push   $0x0
+  80032d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800333:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800339:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80033e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800343:	be 00 00 00 00       	mov    $0x0,%esi
+  800348:	bf 02 00 00 00       	mov    $0x2,%edi
+  80034d:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800354:	00 00 00 
+  800357:	ff d0                	call   *%rax
+  800359:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+
+000000000080035f <sys_yield>:
+
+void
+sys_yield(void) {
+  80035f:	55                   	push   %rbp
+  800360:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800363:	48 83 ec 08          	sub    $0x8,%rsp
+  800367:	6a 00                	push   $0x0
+  800369:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80036f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800375:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037f:	be 00 00 00 00       	mov    $0x0,%esi
+  800384:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800389:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+  800395:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800399:	90                   	nop
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+
+000000000080039c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80039c:	55                   	push   %rbp
+  80039d:	48 89 e5             	mov    %rsp,%rbp
+  8003a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8003a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003ab:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003b1:	48 63 c8             	movslq %eax,%rcx
+  8003b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003bb:	48 98                	cltq
+  8003bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c1:	6a 00                	push   $0x0
+  8003c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003c9:	49 89 c8             	mov    %rcx,%r8
+  8003cc:	48 89 d1             	mov    %rdx,%rcx
+  8003cf:	48 89 c2             	mov    %rax,%rdx
+  8003d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003dc:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8003e3:	00 00 00 
+  8003e6:	ff d0                	call   *%rax
+  8003e8:	48 83 c4 10          	add    $0x10,%rsp
+  8003ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8003ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8003f2:	c9                   	leave
+  8003f3:	c3                   	ret
+
+00000000008003f4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8003f4:	55                   	push   %rbp
+  8003f5:	48 89 e5             	mov    %rsp,%rbp
+  8003f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8003fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8003ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800403:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800406:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80040a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80040e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800411:	48 63 c8             	movslq %eax,%rcx
+  800414:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800418:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80041b:	48 63 f0             	movslq %eax,%rsi
+  80041e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800422:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800425:	48 98                	cltq
+  800427:	48 83 ec 08          	sub    $0x8,%rsp
+  80042b:	51                   	push   %rcx
+  80042c:	49 89 f9             	mov    %rdi,%r9
+  80042f:	49 89 f0             	mov    %rsi,%r8
+  800432:	48 89 d1             	mov    %rdx,%rcx
+  800435:	48 89 c2             	mov    %rax,%rdx
+  800438:	be 01 00 00 00       	mov    $0x1,%esi
+  80043d:	bf 07 00 00 00       	mov    $0x7,%edi
+  800442:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800449:	00 00 00 
+  80044c:	ff d0                	call   *%rax
+  80044e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+
+0000000000800454 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800454:	55                   	push   %rbp
+  800455:	48 89 e5             	mov    %rsp,%rbp
+  800458:	48 83 ec 10          	sub    $0x10,%rsp
+  80045c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80045f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800463:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800467:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046a:	48 98                	cltq
+  80046c:	48 83 ec 08          	sub    $0x8,%rsp
+  800470:	6a 00                	push   $0x0
+  800472:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800478:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80047e:	48 89 d1             	mov    %rdx,%rcx
+  800481:	48 89 c2             	mov    %rax,%rdx
+  800484:	be 01 00 00 00       	mov    $0x1,%esi
+  800489:	bf 08 00 00 00       	mov    $0x8,%edi
+  80048e:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+  80049a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80049e:	c9                   	leave
+  80049f:	c3                   	ret
+
+00000000008004a0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8004a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004ab:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004b1:	48 63 d0             	movslq %eax,%rdx
+  8004b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004b7:	48 98                	cltq
+  8004b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004bd:	6a 00                	push   $0x0
+  8004bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004cb:	48 89 d1             	mov    %rdx,%rcx
+  8004ce:	48 89 c2             	mov    %rax,%rdx
+  8004d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8004d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004db:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8004e2:	00 00 00 
+  8004e5:	ff d0                	call   *%rax
+  8004e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004eb:	c9                   	leave
+  8004ec:	c3                   	ret
+
+00000000008004ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004ed:	55                   	push   %rbp
+  8004ee:	48 89 e5             	mov    %rsp,%rbp
+  8004f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8004f5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8004fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800500:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800503:	48 98                	cltq
+  800505:	48 83 ec 08          	sub    $0x8,%rsp
+  800509:	6a 00                	push   $0x0
+  80050b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800517:	48 89 d1             	mov    %rdx,%rcx
+  80051a:	48 89 c2             	mov    %rax,%rdx
+  80051d:	be 01 00 00 00       	mov    $0x1,%esi
+  800522:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800527:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80052e:	00 00 00 
+  800531:	ff d0                	call   *%rax
+  800533:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800537:	c9                   	leave
+  800538:	c3                   	ret
+
+0000000000800539 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800539:	55                   	push   %rbp
+  80053a:	48 89 e5             	mov    %rsp,%rbp
+  80053d:	48 83 ec 10          	sub    $0x10,%rsp
+  800541:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800544:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800548:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80054c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80054f:	48 98                	cltq
+  800551:	48 83 ec 08          	sub    $0x8,%rsp
+  800555:	6a 00                	push   $0x0
+  800557:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80055d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800563:	48 89 d1             	mov    %rdx,%rcx
+  800566:	48 89 c2             	mov    %rax,%rdx
+  800569:	be 01 00 00 00       	mov    $0x1,%esi
+  80056e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800573:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80057a:	00 00 00 
+  80057d:	ff d0                	call   *%rax
+  80057f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800583:	c9                   	leave
+  800584:	c3                   	ret
+
+0000000000800585 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  800585:	55                   	push   %rbp
+  800586:	48 89 e5             	mov    %rsp,%rbp
+  800589:	48 83 ec 20          	sub    $0x20,%rsp
+  80058d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800590:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800594:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800598:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80059b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80059e:	48 63 f0             	movslq %eax,%rsi
+  8005a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005ac:	48 98                	cltq
+  8005ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b2:	6a 00                	push   $0x0
+  8005b4:	49 89 f1             	mov    %rsi,%r9
+  8005b7:	49 89 c8             	mov    %rcx,%r8
+  8005ba:	48 89 d1             	mov    %rdx,%rcx
+  8005bd:	48 89 c2             	mov    %rax,%rdx
+  8005c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005ca:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8005d1:	00 00 00 
+  8005d4:	ff d0                	call   *%rax
+  8005d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005da:	c9                   	leave
+  8005db:	c3                   	ret
+
+00000000008005dc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005dc:	55                   	push   %rbp
+  8005dd:	48 89 e5             	mov    %rsp,%rbp
+  8005e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8005e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f0:	6a 00                	push   $0x0
+  8005f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800603:	48 89 c2             	mov    %rax,%rdx
+  800606:	be 01 00 00 00       	mov    $0x1,%esi
+  80060b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800610:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800617:	00 00 00 
+  80061a:	ff d0                	call   *%rax
+  80061c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800620:	c9                   	leave
+  800621:	c3                   	ret
+
+0000000000800622 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800622:	55                   	push   %rbp
+  800623:	48 89 e5             	mov    %rsp,%rbp
+  800626:	48 83 ec 10          	sub    $0x10,%rsp
+  80062a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80062e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800632:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800636:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80063a:	48 83 ec 08          	sub    $0x8,%rsp
+  80063e:	6a 00                	push   $0x0
+  800640:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80064c:	48 89 d1             	mov    %rdx,%rcx
+  80064f:	48 89 c2             	mov    %rax,%rdx
+  800652:	be 01 00 00 00       	mov    $0x1,%esi
+  800657:	bf 10 00 00 00       	mov    $0x10,%edi
+  80065c:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800663:	00 00 00 
+  800666:	ff d0                	call   *%rax
+  800668:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80066c:	c9                   	leave
+  80066d:	c3                   	ret
+
+000000000080066e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80066e:	55                   	push   %rbp
+  80066f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800672:	48 83 ec 08          	sub    $0x8,%rsp
+  800676:	6a 00                	push   $0x0
+  800678:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80067e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800684:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800689:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068e:	be 00 00 00 00       	mov    $0x0,%esi
+  800693:	bf 11 00 00 00       	mov    $0x11,%edi
+  800698:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80069f:	00 00 00 
+  8006a2:	ff d0                	call   *%rax
+  8006a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006a8:	c9                   	leave
+  8006a9:	c3                   	ret
+
+00000000008006aa <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006aa:	55                   	push   %rbp
+  8006ab:	48 89 e5             	mov    %rsp,%rbp
+  8006ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8006b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c6:	6a 00                	push   $0x0
+  8006c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006d4:	48 89 d1             	mov    %rdx,%rcx
+  8006d7:	48 89 c2             	mov    %rax,%rdx
+  8006da:	be 00 00 00 00       	mov    $0x0,%esi
+  8006df:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006e4:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8006eb:	00 00 00 
+  8006ee:	ff d0                	call   *%rax
+  8006f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006f4:	c9                   	leave
+  8006f5:	c3                   	ret
+
+00000000008006f6 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8006f6:	55                   	push   %rbp
+  8006f7:	48 89 e5             	mov    %rsp,%rbp
+  8006fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8006fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800702:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800706:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800709:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80070c:	48 63 c8             	movslq %eax,%rcx
+  80070f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800717:	48 83 ec 08          	sub    $0x8,%rsp
+  80071b:	6a 00                	push   $0x0
+  80071d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800723:	49 89 c8             	mov    %rcx,%r8
+  800726:	48 89 d1             	mov    %rdx,%rcx
+  800729:	48 89 c2             	mov    %rax,%rdx
+  80072c:	be 00 00 00 00       	mov    $0x0,%esi
+  800731:	bf 13 00 00 00       	mov    $0x13,%edi
+  800736:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80073d:	00 00 00 
+  800740:	ff d0                	call   *%rax
+  800742:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800746:	c9                   	leave
+  800747:	c3                   	ret
+
+0000000000800748 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800748:	55                   	push   %rbp
+  800749:	48 89 e5             	mov    %rsp,%rbp
+  80074c:	48 83 ec 20          	sub    $0x20,%rsp
+  800750:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800754:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800757:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80075b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80075f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800766:	48 83 ec 08          	sub    $0x8,%rsp
+  80076a:	6a 00                	push   $0x0
+  80076c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800772:	49 89 c8             	mov    %rcx,%r8
+  800775:	48 89 d1             	mov    %rdx,%rcx
+  800778:	48 89 c2             	mov    %rax,%rdx
+  80077b:	be 00 00 00 00       	mov    $0x0,%esi
+  800780:	bf 14 00 00 00       	mov    $0x14,%edi
+  800785:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80078c:	00 00 00 
+  80078f:	ff d0                	call   *%rax
+  800791:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800795:	c9                   	leave
+  800796:	c3                   	ret
+
+0000000000800797 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  800797:	55                   	push   %rbp
+  800798:	48 89 e5             	mov    %rsp,%rbp
+  80079b:	48 83 ec 10          	sub    $0x10,%rsp
+  80079f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007a3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007a9:	48 63 d0             	movslq %eax,%rdx
+  8007ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8007b4:	6a 00                	push   $0x0
+  8007b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007c2:	48 89 d1             	mov    %rdx,%rcx
+  8007c5:	48 89 c2             	mov    %rax,%rdx
+  8007c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8007cd:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007d2:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8007d9:	00 00 00 
+  8007dc:	ff d0                	call   *%rax
+  8007de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007e2:	c9                   	leave
+  8007e3:	c3                   	ret
+
+00000000008007e4 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007e4:	55                   	push   %rbp
+  8007e5:	48 89 e5             	mov    %rsp,%rbp
+  8007e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8007ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007f0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007f3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8007f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8007fa:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8007fe:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800801:	48 63 c8             	movslq %eax,%rcx
+  800804:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800807:	48 63 d0             	movslq %eax,%rdx
+  80080a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080e:	48 83 ec 08          	sub    $0x8,%rsp
+  800812:	6a 00                	push   $0x0
+  800814:	49 89 f1             	mov    %rsi,%r9
+  800817:	49 89 c8             	mov    %rcx,%r8
+  80081a:	48 89 d1             	mov    %rdx,%rcx
+  80081d:	48 89 c2             	mov    %rax,%rdx
+  800820:	be 00 00 00 00       	mov    $0x0,%esi
+  800825:	bf 16 00 00 00       	mov    $0x16,%edi
+  80082a:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800831:	00 00 00 
+  800834:	ff d0                	call   *%rax
+  800836:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+
+000000000080083c <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80083c:	55                   	push   %rbp
+  80083d:	48 89 e5             	mov    %rsp,%rbp
+  800840:	48 83 ec 30          	sub    $0x30,%rsp
+  800844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800848:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80084c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800850:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800854:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800858:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80085c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800860:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800864:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800868:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086c:	48 83 ec 08          	sub    $0x8,%rsp
+  800870:	51                   	push   %rcx
+  800871:	49 89 f9             	mov    %rdi,%r9
+  800874:	49 89 f0             	mov    %rsi,%r8
+  800877:	48 89 d1             	mov    %rdx,%rcx
+  80087a:	48 89 c2             	mov    %rax,%rdx
+  80087d:	be 00 00 00 00       	mov    $0x0,%esi
+  800882:	bf 17 00 00 00       	mov    $0x17,%edi
+  800887:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80088e:	00 00 00 
+  800891:	ff d0                	call   *%rax
+  800893:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+
+0000000000800899 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  800899:	55                   	push   %rbp
+  80089a:	48 89 e5             	mov    %rsp,%rbp
+  80089d:	48 83 ec 10          	sub    $0x10,%rsp
+  8008a1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008a7:	48 98                	cltq
+  8008a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ad:	6a 00                	push   $0x0
+  8008af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c0:	48 89 c2             	mov    %rax,%rdx
+  8008c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8008c8:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008cd:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8008d4:	00 00 00 
+  8008d7:	ff d0                	call   *%rax
+  8008d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008dd:	90                   	nop
+  8008de:	c9                   	leave
+  8008df:	c3                   	ret
+
+00000000008008e0 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008e0:	55                   	push   %rbp
+  8008e1:	48 89 e5             	mov    %rsp,%rbp
+  8008e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8008e8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008eb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008ef:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8008f3:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8008f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8008f9:	48 63 f0             	movslq %eax,%rsi
+  8008fc:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800900:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800904:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800907:	48 98                	cltq
+  800909:	48 83 ec 08          	sub    $0x8,%rsp
+  80090d:	6a 00                	push   $0x0
+  80090f:	49 89 f1             	mov    %rsi,%r9
+  800912:	49 89 c8             	mov    %rcx,%r8
+  800915:	48 89 d1             	mov    %rdx,%rcx
+  800918:	48 89 c2             	mov    %rax,%rdx
+  80091b:	be 01 00 00 00       	mov    $0x1,%esi
+  800920:	bf 19 00 00 00       	mov    $0x19,%edi
+  800925:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  80092c:	00 00 00 
+  80092f:	ff d0                	call   *%rax
+  800931:	48 83 c4 10          	add    $0x10,%rsp
+  800935:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800938:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+
+000000000080093d <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80093d:	55                   	push   %rbp
+  80093e:	48 89 e5             	mov    %rsp,%rbp
+  800941:	48 83 ec 20          	sub    $0x20,%rsp
+  800945:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800949:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80094d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800950:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800953:	48 63 c8             	movslq %eax,%rcx
+  800956:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80095a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80095e:	48 83 ec 08          	sub    $0x8,%rsp
+  800962:	6a 00                	push   $0x0
+  800964:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80096a:	49 89 c8             	mov    %rcx,%r8
+  80096d:	48 89 d1             	mov    %rdx,%rcx
+  800970:	48 89 c2             	mov    %rax,%rdx
+  800973:	be 01 00 00 00       	mov    $0x1,%esi
+  800978:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80097d:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800984:	00 00 00 
+  800987:	ff d0                	call   *%rax
+  800989:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+
+000000000080098f <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80098f:	55                   	push   %rbp
+  800990:	48 89 e5             	mov    %rsp,%rbp
+  800993:	48 83 ec 20          	sub    $0x20,%rsp
+  800997:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80099b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80099f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009a3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009af:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b3:	6a 00                	push   $0x0
+  8009b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009bb:	49 89 c8             	mov    %rcx,%r8
+  8009be:	48 89 d1             	mov    %rdx,%rcx
+  8009c1:	48 89 c2             	mov    %rax,%rdx
+  8009c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8009c9:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009ce:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  8009d5:	00 00 00 
+  8009d8:	ff d0                	call   *%rax
+  8009da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009de:	c9                   	leave
+  8009df:	c3                   	ret
+
+00000000008009e0 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009e0:	55                   	push   %rbp
+  8009e1:	48 89 e5             	mov    %rsp,%rbp
+  8009e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8009e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009f0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8009f3:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8009f7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8009fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8009fe:	48 63 c8             	movslq %eax,%rcx
+  800a01:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a09:	48 83 ec 08          	sub    $0x8,%rsp
+  800a0d:	6a 00                	push   $0x0
+  800a0f:	49 89 f1             	mov    %rsi,%r9
+  800a12:	49 89 c8             	mov    %rcx,%r8
+  800a15:	48 89 d1             	mov    %rdx,%rcx
+  800a18:	48 89 c2             	mov    %rax,%rdx
+  800a1b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a20:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a25:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800a2c:	00 00 00 
+  800a2f:	ff d0                	call   *%rax
+  800a31:	48 83 c4 10          	add    $0x10,%rsp
+  800a35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a3b:	c9                   	leave
+  800a3c:	c3                   	ret
+
+0000000000800a3d <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a3d:	55                   	push   %rbp
+  800a3e:	48 89 e5             	mov    %rsp,%rbp
+  800a41:	48 83 ec 10          	sub    $0x10,%rsp
+  800a45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a4b:	48 98                	cltq
+  800a4d:	48 83 ec 08          	sub    $0x8,%rsp
+  800a51:	6a 00                	push   $0x0
+  800a53:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a64:	48 89 c2             	mov    %rax,%rdx
+  800a67:	be 01 00 00 00       	mov    $0x1,%esi
+  800a6c:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a71:	48 b8 ec 00 80 00 00 	movabs $0x8000ec,%rax
+  800a78:	00 00 00 
+  800a7b:	ff d0                	call   *%rax
+  800a7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+0000000000800a83 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a83:	55                   	push   %rbp
+  800a84:	48 89 e5             	mov    %rsp,%rbp
+  800a87:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a93:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800a9a:	ff ff ff 
+  800a9d:	48 01 d0             	add    %rdx,%rax
+  800aa0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800aa4:	c9                   	leave
+  800aa5:	c3                   	ret
+
+0000000000800aa6 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800aa6:	55                   	push   %rbp
+  800aa7:	48 89 e5             	mov    %rsp,%rbp
+  800aaa:	48 83 ec 08          	sub    $0x8,%rsp
+  800aae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ab2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab6:	48 89 c7             	mov    %rax,%rdi
+  800ab9:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  800ac0:	00 00 00 
+  800ac3:	ff d0                	call   *%rax
+  800ac5:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800acb:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800acf:	c9                   	leave
+  800ad0:	c3                   	ret
+
+0000000000800ad1 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800ad1:	55                   	push   %rbp
+  800ad2:	48 89 e5             	mov    %rsp,%rbp
+  800ad5:	48 83 ec 18          	sub    $0x18,%rsp
+  800ad9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800add:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ae4:	e9 ae 00 00 00       	jmp    800b97 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800ae9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800aec:	c1 e0 0c             	shl    $0xc,%eax
+  800aef:	48 98                	cltq
+  800af1:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800af6:	48 01 d0             	add    %rdx,%rax
+  800af9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800afd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b01:	48 c1 e8 27          	shr    $0x27,%rax
+  800b05:	48 89 c2             	mov    %rax,%rdx
+  800b08:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b0f:	01 00 00 
+  800b12:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b16:	83 e0 01             	and    $0x1,%eax
+  800b19:	48 85 c0             	test   %rax,%rax
+  800b1c:	74 63                	je     800b81 <fd_alloc+0xb0>
+  800b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b22:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b26:	48 89 c2             	mov    %rax,%rdx
+  800b29:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b30:	01 00 00 
+  800b33:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b37:	83 e0 01             	and    $0x1,%eax
+  800b3a:	48 85 c0             	test   %rax,%rax
+  800b3d:	74 42                	je     800b81 <fd_alloc+0xb0>
+  800b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b43:	48 c1 e8 15          	shr    $0x15,%rax
+  800b47:	48 89 c2             	mov    %rax,%rdx
+  800b4a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b51:	01 00 00 
+  800b54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b58:	83 e0 01             	and    $0x1,%eax
+  800b5b:	48 85 c0             	test   %rax,%rax
+  800b5e:	74 21                	je     800b81 <fd_alloc+0xb0>
+  800b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b64:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b68:	48 89 c2             	mov    %rax,%rdx
+  800b6b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b72:	01 00 00 
+  800b75:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b79:	83 e0 01             	and    $0x1,%eax
+  800b7c:	48 85 c0             	test   %rax,%rax
+  800b7f:	75 12                	jne    800b93 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b85:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b89:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	eb 1e                	jmp    800bb1 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800b93:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800b97:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800b9b:	0f 8e 48 ff ff ff    	jle    800ae9 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bac:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bb1:	c9                   	leave
+  800bb2:	c3                   	ret
+
+0000000000800bb3 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bb3:	55                   	push   %rbp
+  800bb4:	48 89 e5             	mov    %rsp,%rbp
+  800bb7:	48 83 ec 20          	sub    $0x20,%rsp
+  800bbb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bbe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bc6:	78 06                	js     800bce <fd_lookup+0x1b>
+  800bc8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bcc:	7e 0a                	jle    800bd8 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd3:	e9 af 00 00 00       	jmp    800c87 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bdb:	c1 e0 0c             	shl    $0xc,%eax
+  800bde:	48 98                	cltq
+  800be0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800be5:	48 01 d0             	add    %rdx,%rax
+  800be8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bf0:	48 c1 e8 27          	shr    $0x27,%rax
+  800bf4:	48 89 c2             	mov    %rax,%rdx
+  800bf7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800bfe:	01 00 00 
+  800c01:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c05:	83 e0 01             	and    $0x1,%eax
+  800c08:	48 85 c0             	test   %rax,%rax
+  800c0b:	74 63                	je     800c70 <fd_lookup+0xbd>
+  800c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c11:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c15:	48 89 c2             	mov    %rax,%rdx
+  800c18:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c1f:	01 00 00 
+  800c22:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c26:	83 e0 01             	and    $0x1,%eax
+  800c29:	48 85 c0             	test   %rax,%rax
+  800c2c:	74 42                	je     800c70 <fd_lookup+0xbd>
+  800c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c32:	48 c1 e8 15          	shr    $0x15,%rax
+  800c36:	48 89 c2             	mov    %rax,%rdx
+  800c39:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c40:	01 00 00 
+  800c43:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c47:	83 e0 01             	and    $0x1,%eax
+  800c4a:	48 85 c0             	test   %rax,%rax
+  800c4d:	74 21                	je     800c70 <fd_lookup+0xbd>
+  800c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c53:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c57:	48 89 c2             	mov    %rax,%rdx
+  800c5a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c61:	01 00 00 
+  800c64:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c68:	83 e0 01             	and    $0x1,%eax
+  800c6b:	48 85 c0             	test   %rax,%rax
+  800c6e:	75 07                	jne    800c77 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c75:	eb 10                	jmp    800c87 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c7f:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c87:	c9                   	leave
+  800c88:	c3                   	ret
+
+0000000000800c89 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c89:	55                   	push   %rbp
+  800c8a:	48 89 e5             	mov    %rsp,%rbp
+  800c8d:	48 83 ec 30          	sub    $0x30,%rsp
+  800c91:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c95:	89 f0                	mov    %esi,%eax
+  800c97:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800c9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c9e:	48 89 c7             	mov    %rax,%rdi
+  800ca1:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  800ca8:	00 00 00 
+  800cab:	ff d0                	call   *%rax
+  800cad:	89 c2                	mov    %eax,%edx
+  800caf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cb3:	48 89 c6             	mov    %rax,%rsi
+  800cb6:	89 d7                	mov    %edx,%edi
+  800cb8:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  800cbf:	00 00 00 
+  800cc2:	ff d0                	call   *%rax
+  800cc4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800cc7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ccb:	78 0a                	js     800cd7 <fd_close+0x4e>
+  800ccd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cd1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cd5:	74 12                	je     800ce9 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cd7:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cdb:	74 05                	je     800ce2 <fd_close+0x59>
+  800cdd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ce0:	eb 70                	jmp    800d52 <fd_close+0xc9>
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	eb 69                	jmp    800d52 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800ce9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ced:	8b 00                	mov    (%rax),%eax
+  800cef:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800cf3:	48 89 d6             	mov    %rdx,%rsi
+  800cf6:	89 c7                	mov    %eax,%edi
+  800cf8:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  800cff:	00 00 00 
+  800d02:	ff d0                	call   *%rax
+  800d04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d0b:	78 2a                	js     800d37 <fd_close+0xae>
+    if (dev->dev_close)
+  800d0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d11:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d15:	48 85 c0             	test   %rax,%rax
+  800d18:	74 16                	je     800d30 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d26:	48 89 c7             	mov    %rax,%rdi
+  800d29:	ff d2                	call   *%rdx
+  800d2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d2e:	eb 07                	jmp    800d37 <fd_close+0xae>
+    else
+      r = 0;
+  800d30:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d3b:	48 89 c6             	mov    %rax,%rsi
+  800d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d43:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  800d4a:	00 00 00 
+  800d4d:	ff d0                	call   *%rax
+  return r;
+  800d4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d52:	c9                   	leave
+  800d53:	c3                   	ret
+
+0000000000800d54 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d54:	55                   	push   %rbp
+  800d55:	48 89 e5             	mov    %rsp,%rbp
+  800d58:	48 83 ec 20          	sub    $0x20,%rsp
+  800d5c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d5f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d63:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d6a:	eb 3f                	jmp    800dab <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d6c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d73:	00 00 00 
+  800d76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d79:	48 98                	cltq
+  800d7b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d7f:	8b 00                	mov    (%rax),%eax
+  800d81:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d84:	75 21                	jne    800da7 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d86:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d8d:	00 00 00 
+  800d90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d93:	48 98                	cltq
+  800d95:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800d99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d9d:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da5:	eb 7f                	jmp    800e26 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800da7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dab:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800db2:	00 00 00 
+  800db5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800db8:	48 98                	cltq
+  800dba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dbe:	48 85 c0             	test   %rax,%rax
+  800dc1:	75 a9                	jne    800d6c <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dc3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dca:	00 00 00 
+  800dcd:	8b 40 04             	mov    0x4(%rax),%eax
+  800dd0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dd5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800ddc:	00 00 00 
+  800ddf:	48 98                	cltq
+  800de1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800de8:	48 01 d0             	add    %rdx,%rax
+  800deb:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800df1:	8b 00                	mov    (%rax),%eax
+  800df3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800df6:	89 c6                	mov    %eax,%esi
+  800df8:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800dff:	00 00 00 
+  800e02:	48 89 c7             	mov    %rax,%rdi
+  800e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0a:	48 b9 4b 31 80 00 00 	movabs $0x80314b,%rcx
+  800e11:	00 00 00 
+  800e14:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e1a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e26:	c9                   	leave
+  800e27:	c3                   	ret
+
+0000000000800e28 <close>:
+
+int
+close(int fdnum) {
+  800e28:	55                   	push   %rbp
+  800e29:	48 89 e5             	mov    %rsp,%rbp
+  800e2c:	48 83 ec 20          	sub    $0x20,%rsp
+  800e30:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e33:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e3a:	48 89 d6             	mov    %rdx,%rsi
+  800e3d:	89 c7                	mov    %eax,%edi
+  800e3f:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  800e46:	00 00 00 
+  800e49:	ff d0                	call   *%rax
+  800e4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e52:	79 05                	jns    800e59 <close+0x31>
+    return r;
+  800e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e57:	eb 18                	jmp    800e71 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e5d:	be 01 00 00 00       	mov    $0x1,%esi
+  800e62:	48 89 c7             	mov    %rax,%rdi
+  800e65:	48 b8 89 0c 80 00 00 	movabs $0x800c89,%rax
+  800e6c:	00 00 00 
+  800e6f:	ff d0                	call   *%rax
+}
+  800e71:	c9                   	leave
+  800e72:	c3                   	ret
+
+0000000000800e73 <close_all>:
+
+void
+close_all(void) {
+  800e73:	55                   	push   %rbp
+  800e74:	48 89 e5             	mov    %rsp,%rbp
+  800e77:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e82:	eb 15                	jmp    800e99 <close_all+0x26>
+    close(i);
+  800e84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e87:	89 c7                	mov    %eax,%edi
+  800e89:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800e95:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e99:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800e9d:	7e e5                	jle    800e84 <close_all+0x11>
+}
+  800e9f:	90                   	nop
+  800ea0:	90                   	nop
+  800ea1:	c9                   	leave
+  800ea2:	c3                   	ret
+
+0000000000800ea3 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ea3:	55                   	push   %rbp
+  800ea4:	48 89 e5             	mov    %rsp,%rbp
+  800ea7:	48 83 ec 40          	sub    $0x40,%rsp
+  800eab:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800eae:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800eb1:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800eb5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800eb8:	48 89 d6             	mov    %rdx,%rsi
+  800ebb:	89 c7                	mov    %eax,%edi
+  800ebd:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  800ec4:	00 00 00 
+  800ec7:	ff d0                	call   *%rax
+  800ec9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ecc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ed0:	79 08                	jns    800eda <dup+0x37>
+    return r;
+  800ed2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ed5:	e9 33 02 00 00       	jmp    80110d <dup+0x26a>
+  close(newfdnum);
+  800eda:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800edd:	89 c7                	mov    %eax,%edi
+  800edf:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800eeb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800eee:	c1 e0 0c             	shl    $0xc,%eax
+  800ef1:	48 98                	cltq
+  800ef3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800ef8:	48 01 d0             	add    %rdx,%rax
+  800efb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800eff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f03:	48 89 c7             	mov    %rax,%rdi
+  800f06:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  800f0d:	00 00 00 
+  800f10:	ff d0                	call   *%rax
+  800f12:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f1a:	48 89 c7             	mov    %rax,%rdi
+  800f1d:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  800f24:	00 00 00 
+  800f27:	ff d0                	call   *%rax
+  800f29:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f2d:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f34:	00 
+  800f35:	e9 19 01 00 00       	jmp    801053 <dup+0x1b0>
+    off -= PGSIZE;
+  800f3a:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f41:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f42:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f4a:	48 01 d0             	add    %rdx,%rax
+  800f4d:	48 c1 e8 27          	shr    $0x27,%rax
+  800f51:	48 89 c2             	mov    %rax,%rdx
+  800f54:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f5b:	01 00 00 
+  800f5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f62:	83 e0 01             	and    $0x1,%eax
+  800f65:	48 85 c0             	test   %rax,%rax
+  800f68:	0f 84 e5 00 00 00    	je     801053 <dup+0x1b0>
+  800f6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f76:	48 01 d0             	add    %rdx,%rax
+  800f79:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f7d:	48 89 c2             	mov    %rax,%rdx
+  800f80:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f87:	01 00 00 
+  800f8a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f8e:	83 e0 01             	and    $0x1,%eax
+  800f91:	48 85 c0             	test   %rax,%rax
+  800f94:	0f 84 b9 00 00 00    	je     801053 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800f9a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa2:	48 01 d0             	add    %rdx,%rax
+  800fa5:	48 c1 e8 15          	shr    $0x15,%rax
+  800fa9:	48 89 c2             	mov    %rax,%rdx
+  800fac:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fb3:	01 00 00 
+  800fb6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fba:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fbd:	48 85 c0             	test   %rax,%rax
+  800fc0:	0f 84 8d 00 00 00    	je     801053 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fc6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fce:	48 01 d0             	add    %rdx,%rax
+  800fd1:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fd5:	48 89 c2             	mov    %rax,%rdx
+  800fd8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fdf:	01 00 00 
+  800fe2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fe6:	83 e0 01             	and    $0x1,%eax
+  800fe9:	48 85 c0             	test   %rax,%rax
+  800fec:	74 65                	je     801053 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800fee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ff6:	48 01 d0             	add    %rdx,%rax
+  800ff9:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ffd:	48 89 c2             	mov    %rax,%rdx
+  801000:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801007:	01 00 00 
+  80100a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80100e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801013:	89 c6                	mov    %eax,%esi
+  801015:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801019:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80101d:	48 01 c2             	add    %rax,%rdx
+  801020:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801028:	48 01 c8             	add    %rcx,%rax
+  80102b:	41 89 f0             	mov    %esi,%r8d
+  80102e:	48 89 d1             	mov    %rdx,%rcx
+  801031:	ba 00 00 00 00       	mov    $0x0,%edx
+  801036:	48 89 c6             	mov    %rax,%rsi
+  801039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103e:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  801045:	00 00 00 
+  801048:	ff d0                	call   *%rax
+  80104a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80104d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801051:	78 60                	js     8010b3 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801053:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801058:	0f 85 dc fe ff ff    	jne    800f3a <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80105e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801062:	48 c1 e8 0c          	shr    $0xc,%rax
+  801066:	48 89 c2             	mov    %rax,%rdx
+  801069:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801070:	01 00 00 
+  801073:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801077:	25 07 0e 00 00       	and    $0xe07,%eax
+  80107c:	89 c1                	mov    %eax,%ecx
+  80107e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801082:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801086:	41 89 c8             	mov    %ecx,%r8d
+  801089:	48 89 d1             	mov    %rdx,%rcx
+  80108c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801091:	48 89 c6             	mov    %rax,%rsi
+  801094:	bf 00 00 00 00       	mov    $0x0,%edi
+  801099:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  8010a0:	00 00 00 
+  8010a3:	ff d0                	call   *%rax
+  8010a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010ac:	78 08                	js     8010b6 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010ae:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010b1:	eb 5a                	jmp    80110d <dup+0x26a>
+        goto err;
+  8010b3:	90                   	nop
+  8010b4:	eb 01                	jmp    8010b7 <dup+0x214>
+    goto err;
+  8010b6:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010bb:	48 89 c6             	mov    %rax,%rsi
+  8010be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c3:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010cf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010d6:	00 
+  8010d7:	eb 27                	jmp    801100 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010d9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010e1:	48 01 d0             	add    %rdx,%rax
+  8010e4:	48 89 c6             	mov    %rax,%rsi
+  8010e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ec:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  8010f3:	00 00 00 
+  8010f6:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010f8:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8010ff:	00 
+  801100:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801107:	00 
+  801108:	76 cf                	jbe    8010d9 <dup+0x236>
+  return r;
+  80110a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80110d:	c9                   	leave
+  80110e:	c3                   	ret
+
+000000000080110f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80110f:	55                   	push   %rbp
+  801110:	48 89 e5             	mov    %rsp,%rbp
+  801113:	48 83 ec 40          	sub    $0x40,%rsp
+  801117:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80111a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80111e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801122:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801126:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801129:	48 89 d6             	mov    %rdx,%rsi
+  80112c:	89 c7                	mov    %eax,%edi
+  80112e:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+  80113a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80113d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801141:	78 24                	js     801167 <read+0x58>
+  801143:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801147:	8b 00                	mov    (%rax),%eax
+  801149:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80114d:	48 89 d6             	mov    %rdx,%rsi
+  801150:	89 c7                	mov    %eax,%edi
+  801152:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+  80115e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801161:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801165:	79 0a                	jns    801171 <read+0x62>
+    return r;
+  801167:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80116a:	48 98                	cltq
+  80116c:	e9 9e 00 00 00       	jmp    80120f <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801171:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801175:	8b 40 08             	mov    0x8(%rax),%eax
+  801178:	83 e0 03             	and    $0x3,%eax
+  80117b:	83 f8 01             	cmp    $0x1,%eax
+  80117e:	75 5c                	jne    8011dc <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801180:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801187:	00 00 00 
+  80118a:	8b 40 04             	mov    0x4(%rax),%eax
+  80118d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801192:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801199:	00 00 00 
+  80119c:	48 98                	cltq
+  80119e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011a5:	48 01 d0             	add    %rdx,%rax
+  8011a8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011ae:	8b 00                	mov    (%rax),%eax
+  8011b0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011b3:	89 c6                	mov    %eax,%esi
+  8011b5:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011bc:	00 00 00 
+  8011bf:	48 89 c7             	mov    %rax,%rdi
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c7:	48 b9 4b 31 80 00 00 	movabs $0x80314b,%rcx
+  8011ce:	00 00 00 
+  8011d1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011d3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011da:	eb 33                	jmp    80120f <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011e4:	48 85 c0             	test   %rax,%rax
+  8011e7:	75 09                	jne    8011f2 <read+0xe3>
+    return -E_NOT_SUPP;
+  8011e9:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8011f0:	eb 1d                	jmp    80120f <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8011f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011f6:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8011fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801202:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801206:	48 89 ce             	mov    %rcx,%rsi
+  801209:	48 89 c7             	mov    %rax,%rdi
+  80120c:	41 ff d0             	call   *%r8
+}
+  80120f:	c9                   	leave
+  801210:	c3                   	ret
+
+0000000000801211 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801211:	55                   	push   %rbp
+  801212:	48 89 e5             	mov    %rsp,%rbp
+  801215:	48 83 ec 30          	sub    $0x30,%rsp
+  801219:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80121c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801220:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801224:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80122b:	eb 49                	jmp    801276 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80122d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801230:	48 98                	cltq
+  801232:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801236:	48 29 c2             	sub    %rax,%rdx
+  801239:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123c:	48 63 c8             	movslq %eax,%rcx
+  80123f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801243:	48 01 c1             	add    %rax,%rcx
+  801246:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801249:	48 89 ce             	mov    %rcx,%rsi
+  80124c:	89 c7                	mov    %eax,%edi
+  80124e:	48 b8 0f 11 80 00 00 	movabs $0x80110f,%rax
+  801255:	00 00 00 
+  801258:	ff d0                	call   *%rax
+  80125a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80125d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801261:	79 07                	jns    80126a <readn+0x59>
+      return m;
+  801263:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801266:	48 98                	cltq
+  801268:	eb 1f                	jmp    801289 <readn+0x78>
+    if (m == 0)
+  80126a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80126e:	74 13                	je     801283 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801270:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801273:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801276:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801279:	48 98                	cltq
+  80127b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80127f:	72 ac                	jb     80122d <readn+0x1c>
+  801281:	eb 01                	jmp    801284 <readn+0x73>
+      break;
+  801283:	90                   	nop
+  }
+  return tot;
+  801284:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801287:	48 98                	cltq
+}
+  801289:	c9                   	leave
+  80128a:	c3                   	ret
+
+000000000080128b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80128b:	55                   	push   %rbp
+  80128c:	48 89 e5             	mov    %rsp,%rbp
+  80128f:	48 83 ec 40          	sub    $0x40,%rsp
+  801293:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801296:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80129a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80129e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012a5:	48 89 d6             	mov    %rdx,%rsi
+  8012a8:	89 c7                	mov    %eax,%edi
+  8012aa:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  8012b1:	00 00 00 
+  8012b4:	ff d0                	call   *%rax
+  8012b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012bd:	78 24                	js     8012e3 <write+0x58>
+  8012bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c3:	8b 00                	mov    (%rax),%eax
+  8012c5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012c9:	48 89 d6             	mov    %rdx,%rsi
+  8012cc:	89 c7                	mov    %eax,%edi
+  8012ce:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  8012d5:	00 00 00 
+  8012d8:	ff d0                	call   *%rax
+  8012da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012e1:	79 0a                	jns    8012ed <write+0x62>
+    return r;
+  8012e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012e6:	48 98                	cltq
+  8012e8:	e9 9d 00 00 00       	jmp    80138a <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f1:	8b 40 08             	mov    0x8(%rax),%eax
+  8012f4:	83 e0 03             	and    $0x3,%eax
+  8012f7:	85 c0                	test   %eax,%eax
+  8012f9:	75 5c                	jne    801357 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012fb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801302:	00 00 00 
+  801305:	8b 40 04             	mov    0x4(%rax),%eax
+  801308:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80130d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801314:	00 00 00 
+  801317:	48 98                	cltq
+  801319:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801320:	48 01 d0             	add    %rdx,%rax
+  801323:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801329:	8b 00                	mov    (%rax),%eax
+  80132b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80132e:	89 c6                	mov    %eax,%esi
+  801330:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  801337:	00 00 00 
+  80133a:	48 89 c7             	mov    %rax,%rdi
+  80133d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801342:	48 b9 4b 31 80 00 00 	movabs $0x80314b,%rcx
+  801349:	00 00 00 
+  80134c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80134e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801355:	eb 33                	jmp    80138a <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80135f:	48 85 c0             	test   %rax,%rax
+  801362:	75 09                	jne    80136d <write+0xe2>
+    return -E_NOT_SUPP;
+  801364:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80136b:	eb 1d                	jmp    80138a <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80136d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801371:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801375:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801379:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80137d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801381:	48 89 ce             	mov    %rcx,%rsi
+  801384:	48 89 c7             	mov    %rax,%rdi
+  801387:	41 ff d0             	call   *%r8
+}
+  80138a:	c9                   	leave
+  80138b:	c3                   	ret
+
+000000000080138c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+  801390:	48 83 ec 18          	sub    $0x18,%rsp
+  801394:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801397:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80139a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80139e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013a1:	48 89 d6             	mov    %rdx,%rsi
+  8013a4:	89 c7                	mov    %eax,%edi
+  8013a6:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  8013ad:	00 00 00 
+  8013b0:	ff d0                	call   *%rax
+  8013b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013b9:	79 05                	jns    8013c0 <seek+0x34>
+    return r;
+  8013bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013be:	eb 0f                	jmp    8013cf <seek+0x43>
+  fd->fd_offset = offset;
+  8013c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013c7:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cf:	c9                   	leave
+  8013d0:	c3                   	ret
+
+00000000008013d1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013d1:	55                   	push   %rbp
+  8013d2:	48 89 e5             	mov    %rsp,%rbp
+  8013d5:	48 83 ec 30          	sub    $0x30,%rsp
+  8013d9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013dc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013df:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013e6:	48 89 d6             	mov    %rdx,%rsi
+  8013e9:	89 c7                	mov    %eax,%edi
+  8013eb:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  8013f2:	00 00 00 
+  8013f5:	ff d0                	call   *%rax
+  8013f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013fe:	78 24                	js     801424 <ftruncate+0x53>
+  801400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801404:	8b 00                	mov    (%rax),%eax
+  801406:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80140a:	48 89 d6             	mov    %rdx,%rsi
+  80140d:	89 c7                	mov    %eax,%edi
+  80140f:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  801416:	00 00 00 
+  801419:	ff d0                	call   *%rax
+  80141b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80141e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801422:	79 08                	jns    80142c <ftruncate+0x5b>
+    return r;
+  801424:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801427:	e9 92 00 00 00       	jmp    8014be <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80142c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801430:	8b 40 08             	mov    0x8(%rax),%eax
+  801433:	83 e0 03             	and    $0x3,%eax
+  801436:	85 c0                	test   %eax,%eax
+  801438:	75 5a                	jne    801494 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80143a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801441:	00 00 00 
+  801444:	8b 40 04             	mov    0x4(%rax),%eax
+  801447:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80144c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801453:	00 00 00 
+  801456:	48 98                	cltq
+  801458:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80145f:	48 01 d0             	add    %rdx,%rax
+  801462:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801468:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80146a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80146d:	89 c6                	mov    %eax,%esi
+  80146f:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  801476:	00 00 00 
+  801479:	48 89 c7             	mov    %rax,%rdi
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801481:	48 b9 4b 31 80 00 00 	movabs $0x80314b,%rcx
+  801488:	00 00 00 
+  80148b:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80148d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801492:	eb 2a                	jmp    8014be <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801494:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801498:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80149c:	48 85 c0             	test   %rax,%rax
+  80149f:	75 07                	jne    8014a8 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014a1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014a6:	eb 16                	jmp    8014be <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ac:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014b7:	89 d6                	mov    %edx,%esi
+  8014b9:	48 89 c7             	mov    %rax,%rdi
+  8014bc:	ff d1                	call   *%rcx
+}
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	48 83 ec 30          	sub    $0x30,%rsp
+  8014c8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014cb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014cf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014d6:	48 89 d6             	mov    %rdx,%rsi
+  8014d9:	89 c7                	mov    %eax,%edi
+  8014db:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  8014e2:	00 00 00 
+  8014e5:	ff d0                	call   *%rax
+  8014e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014ee:	78 24                	js     801514 <fstat+0x54>
+  8014f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f4:	8b 00                	mov    (%rax),%eax
+  8014f6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8014fa:	48 89 d6             	mov    %rdx,%rsi
+  8014fd:	89 c7                	mov    %eax,%edi
+  8014ff:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  801506:	00 00 00 
+  801509:	ff d0                	call   *%rax
+  80150b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80150e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801512:	79 05                	jns    801519 <fstat+0x59>
+    return r;
+  801514:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801517:	eb 5e                	jmp    801577 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801519:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801521:	48 85 c0             	test   %rax,%rax
+  801524:	75 07                	jne    80152d <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801526:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80152b:	eb 4a                	jmp    801577 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80152d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801531:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801534:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801538:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80153f:	00 00 00 
+  stat->st_isdir   = 0;
+  801542:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801546:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80154d:	00 00 00 
+  stat->st_dev     = dev;
+  801550:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801554:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801558:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80155f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801563:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80156f:	48 89 d6             	mov    %rdx,%rsi
+  801572:	48 89 c7             	mov    %rax,%rdi
+  801575:	ff d1                	call   *%rcx
+}
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+
+0000000000801579 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801579:	55                   	push   %rbp
+  80157a:	48 89 e5             	mov    %rsp,%rbp
+  80157d:	48 83 ec 10          	sub    $0x10,%rsp
+  801581:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801585:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  801589:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158d:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801593:	83 f8 20             	cmp    $0x20,%eax
+  801596:	75 07                	jne    80159f <pollwait_key+0x26>
+    return -E_INVAL;
+  801598:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159d:	eb 5f                	jmp    8015fe <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80159f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a3:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ad:	48 63 d2             	movslq %edx,%rdx
+  8015b0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015b4:	48 01 c2             	add    %rax,%rdx
+  8015b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015bb:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c2:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015cc:	8b 00                	mov    (%rax),%eax
+  8015ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015d2:	48 63 c9             	movslq %ecx,%rcx
+  8015d5:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015d9:	48 01 ca             	add    %rcx,%rdx
+  8015dc:	48 83 c2 08          	add    $0x8,%rdx
+  8015e0:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e6:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015ec:	8d 50 01             	lea    0x1(%rax),%edx
+  8015ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f3:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015fe:	c9                   	leave
+  8015ff:	c3                   	ret
+
+0000000000801600 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801600:	55                   	push   %rbp
+  801601:	48 89 e5             	mov    %rsp,%rbp
+  801604:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80160b:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801612:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801618:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80161f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801626:	00 
+  int i, r, ready, ipc = 0;
+  801627:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80162e:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801635:	00 
+  801636:	74 45                	je     80167d <poll+0x7d>
+  801638:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80163f:	ff 
+  801640:	74 3b                	je     80167d <poll+0x7d>
+    now      = vsys_clock_ns();
+  801642:	48 b8 3b 2b 80 00 00 	movabs $0x802b3b,%rax
+  801649:	00 00 00 
+  80164c:	ff d0                	call   *%rax
+  80164e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801652:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801656:	48 f7 d0             	not    %rax
+  801659:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801660:	73 10                	jae    801672 <poll+0x72>
+  801662:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801666:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80166d:	48 01 d0             	add    %rdx,%rax
+  801670:	eb 07                	jmp    801679 <poll+0x79>
+  801672:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801679:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80167d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801684:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80168b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801692:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  801699:	e9 46 02 00 00       	jmp    8018e4 <poll+0x2e4>
+      fds[i].revents = 0;
+  80169e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016a1:	48 63 d0             	movslq %eax,%rdx
+  8016a4:	48 89 d0             	mov    %rdx,%rax
+  8016a7:	48 01 c0             	add    %rax,%rax
+  8016aa:	48 01 d0             	add    %rdx,%rax
+  8016ad:	48 c1 e0 02          	shl    $0x2,%rax
+  8016b1:	48 89 c2             	mov    %rax,%rdx
+  8016b4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016bb:	48 01 d0             	add    %rdx,%rax
+  8016be:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016c8:	48 63 d0             	movslq %eax,%rdx
+  8016cb:	48 89 d0             	mov    %rdx,%rax
+  8016ce:	48 01 c0             	add    %rax,%rax
+  8016d1:	48 01 d0             	add    %rdx,%rax
+  8016d4:	48 c1 e0 02          	shl    $0x2,%rax
+  8016d8:	48 89 c2             	mov    %rax,%rdx
+  8016db:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016e2:	48 01 d0             	add    %rdx,%rax
+  8016e5:	8b 00                	mov    (%rax),%eax
+  8016e7:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016ea:	75 62                	jne    80174e <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8016ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016ef:	48 63 d0             	movslq %eax,%rdx
+  8016f2:	48 89 d0             	mov    %rdx,%rax
+  8016f5:	48 01 c0             	add    %rax,%rax
+  8016f8:	48 01 d0             	add    %rdx,%rax
+  8016fb:	48 c1 e0 02          	shl    $0x2,%rax
+  8016ff:	48 89 c2             	mov    %rax,%rdx
+  801702:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801709:	48 01 d0             	add    %rdx,%rax
+  80170c:	8b 40 04             	mov    0x4(%rax),%eax
+  80170f:	83 e0 01             	and    $0x1,%eax
+  801712:	85 c0                	test   %eax,%eax
+  801714:	0f 84 9b 01 00 00    	je     8018b5 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80171a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80171d:	48 63 d0             	movslq %eax,%rdx
+  801720:	48 89 d0             	mov    %rdx,%rax
+  801723:	48 01 c0             	add    %rax,%rax
+  801726:	48 01 d0             	add    %rdx,%rax
+  801729:	48 c1 e0 02          	shl    $0x2,%rax
+  80172d:	48 89 c2             	mov    %rax,%rdx
+  801730:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801737:	48 01 c2             	add    %rax,%rdx
+  80173a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80173d:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801740:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801743:	83 c8 04             	or     $0x4,%eax
+  801746:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  801749:	e9 67 01 00 00       	jmp    8018b5 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80174e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801751:	48 63 d0             	movslq %eax,%rdx
+  801754:	48 89 d0             	mov    %rdx,%rax
+  801757:	48 01 c0             	add    %rax,%rax
+  80175a:	48 01 d0             	add    %rdx,%rax
+  80175d:	48 c1 e0 02          	shl    $0x2,%rax
+  801761:	48 89 c2             	mov    %rax,%rdx
+  801764:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80176b:	48 01 d0             	add    %rdx,%rax
+  80176e:	8b 00                	mov    (%rax),%eax
+  801770:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801777:	48 89 d6             	mov    %rdx,%rsi
+  80177a:	89 c7                	mov    %eax,%edi
+  80177c:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  801783:	00 00 00 
+  801786:	ff d0                	call   *%rax
+  801788:	85 c0                	test   %eax,%eax
+  80178a:	78 25                	js     8017b1 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80178c:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801793:	8b 00                	mov    (%rax),%eax
+  801795:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80179c:	48 89 d6             	mov    %rdx,%rsi
+  80179f:	89 c7                	mov    %eax,%edi
+  8017a1:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	79 2c                	jns    8017dd <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017b4:	48 63 d0             	movslq %eax,%rdx
+  8017b7:	48 89 d0             	mov    %rdx,%rax
+  8017ba:	48 01 c0             	add    %rax,%rax
+  8017bd:	48 01 d0             	add    %rdx,%rax
+  8017c0:	48 c1 e0 02          	shl    $0x2,%rax
+  8017c4:	48 89 c2             	mov    %rax,%rdx
+  8017c7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017ce:	48 01 d0             	add    %rdx,%rax
+  8017d1:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017d8:	e9 d8 00 00 00       	jmp    8018b5 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017dd:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017e4:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017e8:	48 85 c0             	test   %rax,%rax
+  8017eb:	74 7d                	je     80186a <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8017ed:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017f4:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8017f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017fb:	48 63 d0             	movslq %eax,%rdx
+  8017fe:	48 89 d0             	mov    %rdx,%rax
+  801801:	48 01 c0             	add    %rax,%rax
+  801804:	48 01 d0             	add    %rdx,%rax
+  801807:	48 c1 e0 02          	shl    $0x2,%rax
+  80180b:	48 89 c2             	mov    %rax,%rdx
+  80180e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801815:	48 01 d0             	add    %rdx,%rax
+  801818:	8b 48 04             	mov    0x4(%rax),%ecx
+  80181b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801822:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801829:	89 ce                	mov    %ecx,%esi
+  80182b:	48 89 c7             	mov    %rax,%rdi
+  80182e:	41 ff d0             	call   *%r8
+  801831:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801834:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801838:	79 08                	jns    801842 <poll+0x242>
+          return r;
+  80183a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80183d:	e9 45 01 00 00       	jmp    801987 <poll+0x387>
+        fds[i].revents = r;
+  801842:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801845:	48 63 d0             	movslq %eax,%rdx
+  801848:	48 89 d0             	mov    %rdx,%rax
+  80184b:	48 01 c0             	add    %rax,%rax
+  80184e:	48 01 d0             	add    %rdx,%rax
+  801851:	48 c1 e0 02          	shl    $0x2,%rax
+  801855:	48 89 c2             	mov    %rax,%rdx
+  801858:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80185f:	48 01 c2             	add    %rax,%rdx
+  801862:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801865:	89 42 08             	mov    %eax,0x8(%rdx)
+  801868:	eb 4b                	jmp    8018b5 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80186a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80186d:	48 63 d0             	movslq %eax,%rdx
+  801870:	48 89 d0             	mov    %rdx,%rax
+  801873:	48 01 c0             	add    %rax,%rax
+  801876:	48 01 d0             	add    %rdx,%rax
+  801879:	48 c1 e0 02          	shl    $0x2,%rax
+  80187d:	48 89 c2             	mov    %rax,%rdx
+  801880:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801887:	48 01 d0             	add    %rdx,%rax
+  80188a:	8b 48 04             	mov    0x4(%rax),%ecx
+  80188d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801890:	48 63 d0             	movslq %eax,%rdx
+  801893:	48 89 d0             	mov    %rdx,%rax
+  801896:	48 01 c0             	add    %rax,%rax
+  801899:	48 01 d0             	add    %rdx,%rax
+  80189c:	48 c1 e0 02          	shl    $0x2,%rax
+  8018a0:	48 89 c2             	mov    %rax,%rdx
+  8018a3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018aa:	48 01 d0             	add    %rdx,%rax
+  8018ad:	83 e1 03             	and    $0x3,%ecx
+  8018b0:	89 ca                	mov    %ecx,%edx
+  8018b2:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b8:	48 63 d0             	movslq %eax,%rdx
+  8018bb:	48 89 d0             	mov    %rdx,%rax
+  8018be:	48 01 c0             	add    %rax,%rax
+  8018c1:	48 01 d0             	add    %rdx,%rax
+  8018c4:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c8:	48 89 c2             	mov    %rax,%rdx
+  8018cb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018d2:	48 01 d0             	add    %rdx,%rax
+  8018d5:	8b 40 08             	mov    0x8(%rax),%eax
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	74 04                	je     8018e0 <poll+0x2e0>
+        ready++;
+  8018dc:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018e0:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018e7:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8018ed:	0f 8c ab fd ff ff    	jl     80169e <poll+0x9e>
+    }
+    if (ready)
+  8018f3:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8018f7:	74 08                	je     801901 <poll+0x301>
+      return ready;
+  8018f9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8018fc:	e9 86 00 00 00       	jmp    801987 <poll+0x387>
+
+    if (deadline) {
+  801901:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801906:	74 30                	je     801938 <poll+0x338>
+      now     = vsys_clock_ns();
+  801908:	48 b8 3b 2b 80 00 00 	movabs $0x802b3b,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801918:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80191c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801920:	73 0a                	jae    80192c <poll+0x32c>
+  801922:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801926:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80192a:	eb 05                	jmp    801931 <poll+0x331>
+  80192c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801931:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801938:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80193b:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80193e:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801945:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80194c:	48 89 c7             	mov    %rax,%rdi
+  80194f:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  801956:	00 00 00 
+  801959:	ff d0                	call   *%rax
+  80195b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80195e:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801962:	75 07                	jne    80196b <poll+0x36b>
+      return 0;
+  801964:	b8 00 00 00 00       	mov    $0x0,%eax
+  801969:	eb 1c                	jmp    801987 <poll+0x387>
+    if (r < 0)
+  80196b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80196f:	79 05                	jns    801976 <poll+0x376>
+      return r;
+  801971:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801974:	eb 11                	jmp    801987 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801976:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801979:	c1 f8 02             	sar    $0x2,%eax
+  80197c:	83 e0 01             	and    $0x1,%eax
+  80197f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801982:	e9 f6 fc ff ff       	jmp    80167d <poll+0x7d>
+  }
+}
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+
+0000000000801989 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	48 83 ec 20          	sub    $0x20,%rsp
+  801991:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801995:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  801999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80199d:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a2:	48 89 c7             	mov    %rax,%rdi
+  8019a5:	48 b8 77 1a 80 00 00 	movabs $0x801a77,%rax
+  8019ac:	00 00 00 
+  8019af:	ff d0                	call   *%rax
+  8019b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019b8:	79 05                	jns    8019bf <stat+0x36>
+    return fd;
+  8019ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019bd:	eb 2f                	jmp    8019ee <stat+0x65>
+  r = fstat(fd, stat);
+  8019bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019c6:	48 89 d6             	mov    %rdx,%rsi
+  8019c9:	89 c7                	mov    %eax,%edi
+  8019cb:	48 b8 c0 14 80 00 00 	movabs $0x8014c0,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019dd:	89 c7                	mov    %eax,%edi
+  8019df:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  8019e6:	00 00 00 
+  8019e9:	ff d0                	call   *%rax
+  return r;
+  8019eb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019ee:	c9                   	leave
+  8019ef:	c3                   	ret
+
+00000000008019f0 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019f0:	55                   	push   %rbp
+  8019f1:	48 89 e5             	mov    %rsp,%rbp
+  8019f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8019f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8019fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8019ff:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a06:	00 00 00 
+  801a09:	8b 00                	mov    (%rax),%eax
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	75 1d                	jne    801a2c <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a0f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a14:	48 b8 43 4e 80 00 00 	movabs $0x804e43,%rax
+  801a1b:	00 00 00 
+  801a1e:	ff d0                	call   *%rax
+  801a20:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a27:	00 00 00 
+  801a2a:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a2c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a33:	00 00 00 
+  801a36:	8b 00                	mov    (%rax),%eax
+  801a38:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a3b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a40:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a47:	00 00 00 
+  801a4a:	89 c7                	mov    %eax,%edi
+  801a4c:	48 b8 96 4d 80 00 00 	movabs $0x804d96,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a61:	48 89 c6             	mov    %rax,%rsi
+  801a64:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a69:	48 b8 19 4c 80 00 00 	movabs $0x804c19,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+}
+  801a75:	c9                   	leave
+  801a76:	c3                   	ret
+
+0000000000801a77 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a77:	55                   	push   %rbp
+  801a78:	48 89 e5             	mov    %rsp,%rbp
+  801a7b:	48 83 ec 20          	sub    $0x20,%rsp
+  801a7f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a83:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a8a:	48 89 c7             	mov    %rax,%rdi
+  801a8d:	48 b8 fa 3f 80 00 00 	movabs $0x803ffa,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+  801a99:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a9e:	7e 0a                	jle    801aaa <open+0x33>
+    return -E_BAD_PATH;
+  801aa0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa5:	e9 a8 00 00 00       	jmp    801b52 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801aaa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801aae:	48 89 c7             	mov    %rax,%rdi
+  801ab1:	48 b8 d1 0a 80 00 00 	movabs $0x800ad1,%rax
+  801ab8:	00 00 00 
+  801abb:	ff d0                	call   *%rax
+  801abd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ac0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ac4:	79 08                	jns    801ace <open+0x57>
+    return r;
+  801ac6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ac9:	e9 84 00 00 00       	jmp    801b52 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad2:	48 89 c6             	mov    %rax,%rsi
+  801ad5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801adc:	00 00 00 
+  801adf:	48 89 c7             	mov    %rax,%rdi
+  801ae2:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801aee:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801af5:	00 00 00 
+  801af8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801afb:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b05:	48 89 c6             	mov    %rax,%rsi
+  801b08:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b0d:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801b14:	00 00 00 
+  801b17:	ff d0                	call   *%rax
+  801b19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b20:	79 1d                	jns    801b3f <open+0xc8>
+    fd_close(fd, 0);
+  801b22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b26:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2b:	48 89 c7             	mov    %rax,%rdi
+  801b2e:	48 b8 89 0c 80 00 00 	movabs $0x800c89,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+    return r;
+  801b3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b3d:	eb 13                	jmp    801b52 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b43:	48 89 c7             	mov    %rax,%rdi
+  801b46:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+}
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+
+0000000000801b54 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b54:	55                   	push   %rbp
+  801b55:	48 89 e5             	mov    %rsp,%rbp
+  801b58:	48 83 ec 10          	sub    $0x10,%rsp
+  801b5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b64:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b67:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b6e:	00 00 00 
+  801b71:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b73:	be 00 00 00 00       	mov    $0x0,%esi
+  801b78:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b7d:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801b84:	00 00 00 
+  801b87:	ff d0                	call   *%rax
+}
+  801b89:	c9                   	leave
+  801b8a:	c3                   	ret
+
+0000000000801b8b <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b8b:	55                   	push   %rbp
+  801b8c:	48 89 e5             	mov    %rsp,%rbp
+  801b8f:	48 83 ec 30          	sub    $0x30,%rsp
+  801b93:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b97:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b9b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801b9f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ba4:	74 07                	je     801bad <devfile_read+0x22>
+  801ba6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bab:	75 0a                	jne    801bb7 <devfile_read+0x2c>
+  return E_INVAL;
+  801bad:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bb2:	e9 b4 00 00 00       	jmp    801c6b <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bb7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bbe:	00 
+  while (n) {
+  801bbf:	e9 98 00 00 00       	jmp    801c5c <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc8:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bcb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bd2:	00 00 00 
+  801bd5:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bd7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bde:	00 00 00 
+  801be1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be5:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801be9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bee:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bf3:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801bfa:	00 00 00 
+  801bfd:	ff d0                	call   *%rax
+  801bff:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c02:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c06:	7f 13                	jg     801c1b <devfile_read+0x90>
+      return res ? res : res0;
+  801c08:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c0c:	74 07                	je     801c15 <devfile_read+0x8a>
+  801c0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c11:	48 98                	cltq
+  801c13:	eb 56                	jmp    801c6b <devfile_read+0xe0>
+  801c15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c19:	eb 50                	jmp    801c6b <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c1b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c1e:	48 63 d0             	movslq %eax,%rdx
+  801c21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c25:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c2c:	00 00 00 
+  801c2f:	48 89 ce             	mov    %rcx,%rsi
+  801c32:	48 89 c7             	mov    %rax,%rdi
+  801c35:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+
+    buf += res;
+  801c41:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c44:	48 98                	cltq
+  801c46:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c4a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c4d:	48 98                	cltq
+  801c4f:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c53:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c56:	48 98                	cltq
+  801c58:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c5c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c61:	0f 85 5d ff ff ff    	jne    801bc4 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+
+0000000000801c6d <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c6d:	55                   	push   %rbp
+  801c6e:	48 89 e5             	mov    %rsp,%rbp
+  801c71:	48 83 ec 50          	sub    $0x50,%rsp
+  801c75:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c79:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c7d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c81:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c86:	74 07                	je     801c8f <devfile_write+0x22>
+  801c88:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c8d:	75 0a                	jne    801c99 <devfile_write+0x2c>
+  return E_INVAL;
+  801c8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c94:	e9 c9 00 00 00       	jmp    801d62 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801c99:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ca0:	00 
+
+  while (n) {
+  801ca1:	e9 ad 00 00 00       	jmp    801d53 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ca6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801caa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cae:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cb5:	00 
+  801cb6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cbe:	48 39 c2             	cmp    %rax,%rdx
+  801cc1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801cc5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cc9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ccd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cd1:	48 89 c6             	mov    %rax,%rsi
+  801cd4:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cdb:	00 00 00 
+  801cde:	48 89 c7             	mov    %rax,%rdi
+  801ce1:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  801ce8:	00 00 00 
+  801ceb:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ced:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf1:	8b 40 0c             	mov    0xc(%rax),%eax
+  801cf4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801cfb:	00 00 00 
+  801cfe:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d00:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d07:	00 00 00 
+  801d0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d0e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d12:	be 00 00 00 00       	mov    $0x0,%esi
+  801d17:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d1c:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801d23:	00 00 00 
+  801d26:	ff d0                	call   *%rax
+  801d28:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d2b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d2f:	79 07                	jns    801d38 <devfile_write+0xcb>
+      return res;
+  801d31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d34:	48 98                	cltq
+  801d36:	eb 2a                	jmp    801d62 <devfile_write+0xf5>
+
+    buf += res;
+  801d38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d3b:	48 98                	cltq
+  801d3d:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d44:	48 98                	cltq
+  801d46:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d4d:	48 98                	cltq
+  801d4f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d53:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d58:	0f 85 48 ff ff ff    	jne    801ca6 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d62:	c9                   	leave
+  801d63:	c3                   	ret
+
+0000000000801d64 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d64:	55                   	push   %rbp
+  801d65:	48 89 e5             	mov    %rsp,%rbp
+  801d68:	48 83 ec 20          	sub    $0x20,%rsp
+  801d6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d70:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d78:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d7b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d82:	00 00 00 
+  801d85:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d87:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8c:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d91:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801da0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801da4:	79 05                	jns    801dab <devfile_stat+0x47>
+    return r;
+  801da6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801da9:	eb 59                	jmp    801e04 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801daf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801db6:	00 00 00 
+  801db9:	48 89 d6             	mov    %rdx,%rsi
+  801dbc:	48 89 c7             	mov    %rax,%rdi
+  801dbf:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dcb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dd2:	00 00 00 
+  801dd5:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801ddb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ddf:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801de5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dec:	00 00 00 
+  801def:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801df5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df9:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801dff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+0000000000801e06 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e06:	55                   	push   %rbp
+  801e07:	48 89 e5             	mov    %rsp,%rbp
+  801e0a:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e12:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e19:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e1c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e23:	00 00 00 
+  801e26:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e28:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e2f:	00 00 00 
+  801e32:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e35:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e38:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e42:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801e49:	00 00 00 
+  801e4c:	ff d0                	call   *%rax
+}
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+
+0000000000801e50 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e50:	55                   	push   %rbp
+  801e51:	48 89 e5             	mov    %rsp,%rbp
+  801e54:	48 83 ec 18          	sub    $0x18,%rsp
+  801e58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e5c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e5f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e63:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e66:	83 e0 03             	and    $0x3,%eax
+}
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+
+0000000000801e6b <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e6b:	55                   	push   %rbp
+  801e6c:	48 89 e5             	mov    %rsp,%rbp
+  801e6f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7b:	48 89 c7             	mov    %rax,%rdi
+  801e7e:	48 b8 fa 3f 80 00 00 	movabs $0x803ffa,%rax
+  801e85:	00 00 00 
+  801e88:	ff d0                	call   *%rax
+  801e8a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e8f:	7e 07                	jle    801e98 <remove+0x2d>
+    return -E_BAD_PATH;
+  801e91:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e96:	eb 36                	jmp    801ece <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9c:	48 89 c6             	mov    %rax,%rsi
+  801e9f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ea6:	00 00 00 
+  801ea9:	48 89 c7             	mov    %rax,%rdi
+  801eac:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  801eb3:	00 00 00 
+  801eb6:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801eb8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebd:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ec2:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+}
+  801ece:	c9                   	leave
+  801ecf:	c3                   	ret
+
+0000000000801ed0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ed0:	55                   	push   %rbp
+  801ed1:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ed4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed9:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ede:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801ee5:	00 00 00 
+  801ee8:	ff d0                	call   *%rax
+}
+  801eea:	5d                   	pop    %rbp
+  801eeb:	c3                   	ret
+
+0000000000801eec <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801eec:	55                   	push   %rbp
+  801eed:	48 89 e5             	mov    %rsp,%rbp
+  801ef0:	48 83 ec 20          	sub    $0x20,%rsp
+  801ef4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801ef8:	be 00 00 00 00       	mov    $0x0,%esi
+  801efd:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f02:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+  801f0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f15:	79 05                	jns    801f1c <fs_stats+0x30>
+    return r;
+  801f17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f1a:	eb 2a                	jmp    801f46 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f20:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f25:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f2c:	00 00 00 
+  801f2f:	48 89 ce             	mov    %rcx,%rsi
+  801f32:	48 89 c7             	mov    %rax,%rdi
+  801f35:	48 b8 3e 46 80 00 00 	movabs $0x80463e,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+  return 0;
+  801f41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+
+0000000000801f48 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f48:	55                   	push   %rbp
+  801f49:	48 89 e5             	mov    %rsp,%rbp
+  801f4c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f50:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f53:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f5a:	00 00 00 
+  801f5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f60:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f62:	be 00 00 00 00       	mov    $0x0,%esi
+  801f67:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f6c:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+0000000000801f7a <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f82:	89 f8                	mov    %edi,%eax
+  801f84:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f87:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801f8b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f92:	00 00 00 
+  801f95:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801f97:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fa1:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+}
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+
+0000000000801faf <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801faf:	55                   	push   %rbp
+  801fb0:	48 89 e5             	mov    %rsp,%rbp
+  801fb3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fbf:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fc4:	48 89 c7             	mov    %rax,%rdi
+  801fc7:	48 b8 d5 1f 80 00 00 	movabs $0x801fd5,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+}
+  801fd3:	c9                   	leave
+  801fd4:	c3                   	ret
+
+0000000000801fd5 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fd5:	55                   	push   %rbp
+  801fd6:	48 89 e5             	mov    %rsp,%rbp
+  801fd9:	48 83 ec 50          	sub    $0x50,%rsp
+  801fdd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801fe1:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801fe5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801fec:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  801fed:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  801ff2:	74 0a                	je     801ffe <pipe_size+0x29>
+  801ff4:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  801ffb:	00 
+  801ffc:	76 0a                	jbe    802008 <pipe_size+0x33>
+    return -E_INVAL;
+  801ffe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802003:	e9 cc 02 00 00       	jmp    8022d4 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802008:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80200c:	48 89 c7             	mov    %rax,%rdi
+  80200f:	48 b8 d1 0a 80 00 00 	movabs $0x800ad1,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+  80201b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80201e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802022:	0f 88 a8 02 00 00    	js     8022d0 <pipe_size+0x2fb>
+  802028:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80202c:	ba 07 04 00 00       	mov    $0x407,%edx
+  802031:	48 89 c6             	mov    %rax,%rsi
+  802034:	bf 00 00 00 00       	mov    $0x0,%edi
+  802039:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+  802045:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802048:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80204c:	0f 88 7e 02 00 00    	js     8022d0 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802052:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802056:	48 89 c7             	mov    %rax,%rdi
+  802059:	48 b8 d1 0a 80 00 00 	movabs $0x800ad1,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802068:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80206c:	0f 88 43 02 00 00    	js     8022b5 <pipe_size+0x2e0>
+  802072:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802076:	ba 07 04 00 00       	mov    $0x407,%edx
+  80207b:	48 89 c6             	mov    %rax,%rsi
+  80207e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802083:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  80208a:	00 00 00 
+  80208d:	ff d0                	call   *%rax
+  80208f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802092:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802096:	0f 88 19 02 00 00    	js     8022b5 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80209c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a0:	48 89 c7             	mov    %rax,%rdi
+  8020a3:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020b3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020ba:	00 
+  8020bb:	e9 a2 00 00 00       	jmp    802162 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020c4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020c8:	48 89 c2             	mov    %rax,%rdx
+  8020cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020cf:	48 01 d0             	add    %rdx,%rax
+  8020d2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020d7:	48 89 c6             	mov    %rax,%rsi
+  8020da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020df:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020f2:	0f 88 37 01 00 00    	js     80222f <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8020f8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8020fc:	48 89 c7             	mov    %rax,%rdi
+  8020ff:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80210f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802113:	48 01 c2             	add    %rax,%rdx
+  802116:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80211a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80211e:	48 89 c1             	mov    %rax,%rcx
+  802121:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802125:	48 01 c8             	add    %rcx,%rax
+  802128:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80212e:	48 89 d1             	mov    %rdx,%rcx
+  802131:	ba 00 00 00 00       	mov    $0x0,%edx
+  802136:	48 89 c6             	mov    %rax,%rsi
+  802139:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213e:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+  80214a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80214d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802151:	79 0a                	jns    80215d <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802153:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802158:	e9 d3 00 00 00       	jmp    802230 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80215d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802162:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  802169:	00 
+  80216a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80216e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802172:	48 01 d0             	add    %rdx,%rax
+  802175:	48 83 c0 1f          	add    $0x1f,%rax
+  802179:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80217d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802181:	ba 00 00 00 00       	mov    $0x0,%edx
+  802186:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80218a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218e:	48 29 d0             	sub    %rdx,%rax
+  802191:	48 c1 e8 0c          	shr    $0xc,%rax
+  802195:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802199:	0f 82 21 ff ff ff    	jb     8020c0 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80219f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ab:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021af:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021b7:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021be:	00 00 00 
+  8021c1:	8b 12                	mov    (%rdx),%edx
+  8021c3:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d4:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021db:	00 00 00 
+  8021de:	8b 12                	mov    (%rdx),%edx
+  8021e0:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8021ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f1:	48 89 c7             	mov    %rax,%rdi
+  8021f4:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  8021fb:	00 00 00 
+  8021fe:	ff d0                	call   *%rax
+  802200:	89 c2                	mov    %eax,%edx
+  802202:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802206:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802208:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80220c:	48 89 c7             	mov    %rax,%rdi
+  80220f:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  802216:	00 00 00 
+  802219:	ff d0                	call   *%rax
+  80221b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80221f:	48 83 c2 04          	add    $0x4,%rdx
+  802223:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222a:	e9 a5 00 00 00       	jmp    8022d4 <pipe_size+0x2ff>
+      goto err2;
+  80222f:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802230:	eb 58                	jmp    80228a <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802232:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802236:	48 c1 e0 0c          	shl    $0xc,%rax
+  80223a:	48 89 c2             	mov    %rax,%rdx
+  80223d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802241:	48 01 d0             	add    %rdx,%rax
+  802244:	48 89 c6             	mov    %rax,%rsi
+  802247:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224c:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802258:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80225c:	48 89 c7             	mov    %rax,%rdi
+  80225f:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  802266:	00 00 00 
+  802269:	ff d0                	call   *%rax
+  80226b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80226f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802273:	48 01 d0             	add    %rdx,%rax
+  802276:	48 89 c6             	mov    %rax,%rsi
+  802279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227e:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80228a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80228e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802292:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802296:	48 85 c0             	test   %rax,%rax
+  802299:	75 97                	jne    802232 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  80229b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80229f:	48 89 c6             	mov    %rax,%rsi
+  8022a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a7:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+  8022b3:	eb 01                	jmp    8022b6 <pipe_size+0x2e1>
+    goto err1;
+  8022b5:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022ba:	48 89 c6             	mov    %rax,%rsi
+  8022bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c2:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+  8022ce:	eb 01                	jmp    8022d1 <pipe_size+0x2fc>
+    goto err;
+  8022d0:	90                   	nop
+err:
+  return r;
+  8022d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022d4:	c9                   	leave
+  8022d5:	c3                   	ret
+
+00000000008022d6 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022d6:	55                   	push   %rbp
+  8022d7:	48 89 e5             	mov    %rsp,%rbp
+  8022da:	53                   	push   %rbx
+  8022db:	48 83 ec 28          	sub    $0x28,%rsp
+  8022df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022e7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022ee:	00 00 00 
+  8022f1:	8b 40 04             	mov    0x4(%rax),%eax
+  8022f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022f9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802300:	00 00 00 
+  802303:	48 98                	cltq
+  802305:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80230c:	48 01 d0             	add    %rdx,%rax
+  80230f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802315:	8b 00                	mov    (%rax),%eax
+  802317:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80231a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80231e:	48 89 c7             	mov    %rax,%rdi
+  802321:	48 b8 b4 4e 80 00 00 	movabs $0x804eb4,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	89 c3                	mov    %eax,%ebx
+  80232f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802333:	48 89 c7             	mov    %rax,%rdi
+  802336:	48 b8 b4 4e 80 00 00 	movabs $0x804eb4,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+  802342:	39 c3                	cmp    %eax,%ebx
+  802344:	0f 94 c0             	sete   %al
+  802347:	0f b6 c0             	movzbl %al,%eax
+  80234a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80234d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802354:	00 00 00 
+  802357:	8b 40 04             	mov    0x4(%rax),%eax
+  80235a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80235f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802366:	00 00 00 
+  802369:	48 98                	cltq
+  80236b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802372:	48 01 d0             	add    %rdx,%rax
+  802375:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80237b:	8b 00                	mov    (%rax),%eax
+  80237d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  802380:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802383:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802386:	75 05                	jne    80238d <_pipeisclosed+0xb7>
+      return ret;
+  802388:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80238b:	eb 68                	jmp    8023f5 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80238d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802390:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802393:	0f 84 4e ff ff ff    	je     8022e7 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  802399:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023a0:	00 00 00 
+  8023a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8023a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023ab:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023b2:	00 00 00 
+  8023b5:	48 98                	cltq
+  8023b7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023be:	48 01 d0             	add    %rdx,%rax
+  8023c1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023c7:	8b 10                	mov    (%rax),%edx
+  8023c9:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023cf:	89 c6                	mov    %eax,%esi
+  8023d1:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023d8:	00 00 00 
+  8023db:	48 89 c7             	mov    %rax,%rdi
+  8023de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e3:	49 b8 4b 31 80 00 00 	movabs $0x80314b,%r8
+  8023ea:	00 00 00 
+  8023ed:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8023f0:	e9 f2 fe ff ff       	jmp    8022e7 <_pipeisclosed+0x11>
+  }
+}
+  8023f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+00000000008023fb <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	48 83 ec 30          	sub    $0x30,%rsp
+  802403:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802406:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80240a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80240d:	48 89 d6             	mov    %rdx,%rsi
+  802410:	89 c7                	mov    %eax,%edi
+  802412:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  802419:	00 00 00 
+  80241c:	ff d0                	call   *%rax
+  80241e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802421:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802425:	79 05                	jns    80242c <pipeisclosed+0x31>
+    return r;
+  802427:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80242a:	eb 31                	jmp    80245d <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80242c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802430:	48 89 c7             	mov    %rax,%rdi
+  802433:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802443:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802447:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80244b:	48 89 d6             	mov    %rdx,%rsi
+  80244e:	48 89 c7             	mov    %rax,%rdi
+  802451:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+}
+  80245d:	c9                   	leave
+  80245e:	c3                   	ret
+
+000000000080245f <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80245f:	55                   	push   %rbp
+  802460:	48 89 e5             	mov    %rsp,%rbp
+  802463:	48 83 ec 10          	sub    $0x10,%rsp
+  802467:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80246b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246f:	8b 40 18             	mov    0x18(%rax),%eax
+  802472:	8d 50 01             	lea    0x1(%rax),%edx
+  802475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802479:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80247c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802480:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802483:	85 c0                	test   %eax,%eax
+  802485:	74 27                	je     8024ae <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248b:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  802492:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802496:	48 83 c0 18          	add    $0x18,%rax
+  80249a:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80249f:	48 89 c7             	mov    %rax,%rdi
+  8024a2:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  }
+}
+  8024ae:	90                   	nop
+  8024af:	c9                   	leave
+  8024b0:	c3                   	ret
+
+00000000008024b1 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024b1:	55                   	push   %rbp
+  8024b2:	48 89 e5             	mov    %rsp,%rbp
+  8024b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024bd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c4:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024cf:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024d6:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024dd:	89 c6                	mov    %eax,%esi
+  8024df:	48 89 cf             	mov    %rcx,%rdi
+  8024e2:	48 b8 48 07 80 00 00 	movabs $0x800748,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+}
+  8024ee:	90                   	nop
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+00000000008024f1 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+  8024f5:	48 83 ec 70          	sub    $0x70,%rsp
+  8024f9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8024fd:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802501:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802505:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802509:	48 89 c7             	mov    %rax,%rdi
+  80250c:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  802513:	00 00 00 
+  802516:	ff d0                	call   *%rax
+  802518:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80251c:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802521:	75 0a                	jne    80252d <devpipe_read+0x3c>
+    return 0;
+  802523:	b8 00 00 00 00       	mov    $0x0,%eax
+  802528:	e9 63 01 00 00       	jmp    802690 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80252d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802531:	8b 40 18             	mov    0x18(%rax),%eax
+  802534:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802537:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253b:	48 8b 10             	mov    (%rax),%rdx
+  80253e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802542:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802546:	48 39 c2             	cmp    %rax,%rdx
+  802549:	75 42                	jne    80258d <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80254b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80254f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802553:	48 89 d6             	mov    %rdx,%rsi
+  802556:	48 89 c7             	mov    %rax,%rdi
+  802559:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	85 c0                	test   %eax,%eax
+  802567:	74 0a                	je     802573 <devpipe_read+0x82>
+      return 0;
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	e9 1d 01 00 00       	jmp    802690 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802573:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802576:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80257a:	89 d6                	mov    %edx,%esi
+  80257c:	48 89 c7             	mov    %rax,%rdi
+  80257f:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80258b:	eb a0                	jmp    80252d <devpipe_read+0x3c>
+      break;
+  80258d:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80258e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802592:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  802596:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80259a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80259e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025aa:	48 8b 00             	mov    (%rax),%rax
+  8025ad:	48 29 c2             	sub    %rax,%rdx
+  8025b0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025bc:	48 39 c2             	cmp    %rax,%rdx
+  8025bf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025c3:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025cb:	48 8b 00             	mov    (%rax),%rax
+  8025ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025db:	48 f7 f1             	div    %rcx
+  8025de:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025e2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ee:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025f2:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8025f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025fa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8025fe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802602:	48 39 c2             	cmp    %rax,%rdx
+  802605:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802609:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80260d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802611:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802615:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802619:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80261d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802621:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802625:	48 89 ce             	mov    %rcx,%rsi
+  802628:	48 89 c7             	mov    %rax,%rdi
+  80262b:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802637:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80263b:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80263f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802643:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802647:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80264b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80264f:	48 01 d1             	add    %rdx,%rcx
+  802652:	48 89 c2             	mov    %rax,%rdx
+  802655:	48 89 cf             	mov    %rcx,%rdi
+  802658:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802668:	48 8b 10             	mov    (%rax),%rdx
+  80266b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80266f:	48 01 c2             	add    %rax,%rdx
+  802672:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802676:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267d:	48 89 c7             	mov    %rax,%rdi
+  802680:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+  return n;
+  80268c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802690:	c9                   	leave
+  802691:	c3                   	ret
+
+0000000000802692 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802692:	55                   	push   %rbp
+  802693:	48 89 e5             	mov    %rsp,%rbp
+  802696:	48 83 ec 70          	sub    $0x70,%rsp
+  80269a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80269e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026a2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026a6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026aa:	48 89 c7             	mov    %rax,%rdi
+  8026ad:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  8026b4:	00 00 00 
+  8026b7:	ff d0                	call   *%rax
+  8026b9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026bd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026c5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026cc:	00 
+  8026cd:	e9 b8 01 00 00       	jmp    80288a <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026d6:	8b 40 18             	mov    0x18(%rax),%eax
+  8026d9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e8:	48 8b 00             	mov    (%rax),%rax
+  8026eb:	48 29 c2             	sub    %rax,%rdx
+  8026ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026f6:	48 39 c2             	cmp    %rax,%rdx
+  8026f9:	75 4d                	jne    802748 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8026fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8026ff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802703:	48 89 d6             	mov    %rdx,%rsi
+  802706:	48 89 c7             	mov    %rax,%rdi
+  802709:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	85 c0                	test   %eax,%eax
+  802717:	74 0a                	je     802723 <devpipe_write+0x91>
+        return 0;
+  802719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271e:	e9 79 01 00 00       	jmp    80289c <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802723:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80272a:	89 d6                	mov    %edx,%esi
+  80272c:	48 89 c7             	mov    %rax,%rdi
+  80272f:	48 b8 b1 24 80 00 00 	movabs $0x8024b1,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+      m = 0;
+  80273b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802742:	00 
+      continue;
+  802743:	e9 3a 01 00 00       	jmp    802882 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802748:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80274c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802750:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802754:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802758:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80275c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802760:	48 8b 08             	mov    (%rax),%rcx
+  802763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802767:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80276b:	48 29 c1             	sub    %rax,%rcx
+  80276e:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802772:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802776:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80277a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277e:	48 39 c2             	cmp    %rax,%rdx
+  802781:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802785:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  802789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80278d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802791:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802795:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	48 f7 f1             	div    %rcx
+  8027a1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027b5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027b9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027bd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027c5:	48 39 c2             	cmp    %rax,%rdx
+  8027c8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027cc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027d4:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027dc:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027e4:	48 01 d1             	add    %rdx,%rcx
+  8027e7:	48 89 c2             	mov    %rax,%rdx
+  8027ea:	48 89 cf             	mov    %rcx,%rdi
+  8027ed:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  8027f4:	00 00 00 
+  8027f7:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8027f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027fd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802801:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802805:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802809:	73 4d                	jae    802858 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80280b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80280f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802813:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802817:	48 29 c2             	sub    %rax,%rdx
+  80281a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80281e:	48 01 c2             	add    %rax,%rdx
+  802821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802825:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802829:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80282d:	48 89 c1             	mov    %rax,%rcx
+  802830:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802834:	48 01 c1             	add    %rax,%rcx
+  802837:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80283b:	48 01 c1             	add    %rax,%rcx
+  80283e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802842:	48 83 c0 20          	add    $0x20,%rax
+  802846:	48 89 ce             	mov    %rcx,%rsi
+  802849:	48 89 c7             	mov    %rax,%rdi
+  80284c:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802858:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80285c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802864:	48 01 c2             	add    %rax,%rdx
+  802867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80286b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80286f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802873:	48 89 c7             	mov    %rax,%rdi
+  802876:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  80287d:	00 00 00 
+  802880:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802882:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802886:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80288a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80288e:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802892:	0f 82 3a fe ff ff    	jb     8026d2 <devpipe_write+0x40>
+  }
+
+  return i;
+  802898:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80289c:	c9                   	leave
+  80289d:	c3                   	ret
+
+000000000080289e <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80289e:	55                   	push   %rbp
+  80289f:	48 89 e5             	mov    %rsp,%rbp
+  8028a2:	48 83 ec 40          	sub    $0x40,%rsp
+  8028a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028aa:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028ad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028b5:	48 89 c7             	mov    %rax,%rdi
+  8028b8:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  8028bf:	00 00 00 
+  8028c2:	ff d0                	call   *%rax
+  8028c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d3:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028db:	48 89 d6             	mov    %rdx,%rsi
+  8028de:	48 89 c7             	mov    %rax,%rdi
+  8028e1:	48 b8 79 15 80 00 00 	movabs $0x801579,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+  8028ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028f4:	79 08                	jns    8028fe <devpipe_poll+0x60>
+    return r;
+  8028f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028f9:	e9 85 00 00 00       	jmp    802983 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8028fe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802901:	83 e0 01             	and    $0x1,%eax
+  802904:	85 c0                	test   %eax,%eax
+  802906:	74 18                	je     802920 <devpipe_poll+0x82>
+  802908:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80290c:	48 8b 10             	mov    (%rax),%rdx
+  80290f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802913:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802917:	48 39 c2             	cmp    %rax,%rdx
+  80291a:	74 04                	je     802920 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80291c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802920:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802923:	83 e0 02             	and    $0x2,%eax
+  802926:	85 c0                	test   %eax,%eax
+  802928:	74 23                	je     80294d <devpipe_poll+0xaf>
+  80292a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80292e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802932:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802936:	48 8b 00             	mov    (%rax),%rax
+  802939:	48 29 c2             	sub    %rax,%rdx
+  80293c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802940:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802944:	48 39 c2             	cmp    %rax,%rdx
+  802947:	73 04                	jae    80294d <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802949:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80294d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802951:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802955:	48 89 d6             	mov    %rdx,%rsi
+  802958:	48 89 c7             	mov    %rax,%rdi
+  80295b:	48 b8 d6 22 80 00 00 	movabs $0x8022d6,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	85 c0                	test   %eax,%eax
+  802969:	74 04                	je     80296f <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80296b:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80296f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802973:	75 0b                	jne    802980 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802979:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+
+0000000000802985 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802985:	55                   	push   %rbp
+  802986:	48 89 e5             	mov    %rsp,%rbp
+  802989:	48 83 ec 20          	sub    $0x20,%rsp
+  80298d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802991:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802995:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802999:	48 89 c7             	mov    %rax,%rdi
+  80299c:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+  8029a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029b0:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029b7:	00 00 00 
+  8029ba:	48 89 d6             	mov    %rdx,%rsi
+  8029bd:	48 89 c7             	mov    %rax,%rdi
+  8029c0:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029d4:	89 c1                	mov    %eax,%ecx
+  8029d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029da:	48 8b 00             	mov    (%rax),%rax
+  8029dd:	89 c2                	mov    %eax,%edx
+  8029df:	89 c8                	mov    %ecx,%eax
+  8029e1:	29 d0                	sub    %edx,%eax
+  8029e3:	89 c2                	mov    %eax,%edx
+  8029e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029e9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8029ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8029fa:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8029fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a01:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a08:	00 00 00 
+  802a0b:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+
+0000000000802a19 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a19:	55                   	push   %rbp
+  802a1a:	48 89 e5             	mov    %rsp,%rbp
+  802a1d:	48 83 ec 40          	sub    $0x40,%rsp
+  802a21:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a29:	48 89 c7             	mov    %rax,%rdi
+  802a2c:	48 b8 a6 0a 80 00 00 	movabs $0x800aa6,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+  802a38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a3c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a43:	00 
+  802a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a48:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a50:	48 01 d0             	add    %rdx,%rax
+  802a53:	48 83 c0 1f          	add    $0x1f,%rax
+  802a57:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a64:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a6c:	48 29 d0             	sub    %rdx,%rax
+  802a6f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a73:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a7b:	48 89 c6             	mov    %rax,%rsi
+  802a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a83:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  802a8a:	00 00 00 
+  802a8d:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a93:	48 89 c7             	mov    %rax,%rdi
+  802a96:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802aa2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aa6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802aaa:	eb 2f                	jmp    802adb <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab0:	48 83 e8 01          	sub    $0x1,%rax
+  802ab4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ab8:	48 89 c2             	mov    %rax,%rdx
+  802abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802abf:	48 01 d0             	add    %rdx,%rax
+  802ac2:	48 89 c6             	mov    %rax,%rsi
+  802ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aca:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  802ad1:	00 00 00 
+  802ad4:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ad6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802adb:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802ae0:	77 ca                	ja     802aac <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802ae2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ae6:	48 89 c6             	mov    %rax,%rsi
+  802ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aee:	48 b8 54 04 80 00 00 	movabs $0x800454,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+}
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+0000000000802afc <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802afc:	55                   	push   %rbp
+  802afd:	48 89 e5             	mov    %rsp,%rbp
+  802b00:	48 83 ec 08          	sub    $0x8,%rsp
+  802b04:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b0b:	75 10                	jne    802b1d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b0d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b14:	00 00 00 
+  802b17:	8b 00                	mov    (%rax),%eax
+  802b19:	48 98                	cltq
+  802b1b:	eb 05                	jmp    802b22 <vsyscall+0x26>
+  }
+  return 0;
+  802b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b22:	c9                   	leave
+  802b23:	c3                   	ret
+
+0000000000802b24 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b24:	55                   	push   %rbp
+  802b25:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b2d:	48 b8 fc 2a 80 00 00 	movabs $0x802afc,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+}
+  802b39:	5d                   	pop    %rbp
+  802b3a:	c3                   	ret
+
+0000000000802b3b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b3b:	55                   	push   %rbp
+  802b3c:	48 89 e5             	mov    %rsp,%rbp
+  802b3f:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b43:	0f 31                	rdtsc
+  802b45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b48:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b51:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b55:	48 09 d0             	or     %rdx,%rax
+  802b58:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b60:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b64:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b6b:	00 00 00 
+  802b6e:	8b 40 08             	mov    0x8(%rax),%eax
+  802b71:	48 98                	cltq
+  802b73:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b80:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b84:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802b8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b94:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b98:	48 89 d0             	mov    %rdx,%rax
+  802b9b:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802ba2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bab:	48 01 c8             	add    %rcx,%rax
+}
+  802bae:	c9                   	leave
+  802baf:	c3                   	ret
+
+0000000000802bb0 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bb0:	55                   	push   %rbp
+  802bb1:	48 89 e5             	mov    %rsp,%rbp
+  802bb4:	48 83 ec 20          	sub    $0x20,%rsp
+  802bb8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bbe:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bc1:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bc5:	be 01 00 00 00       	mov    $0x1,%esi
+  802bca:	48 89 c7             	mov    %rax,%rdi
+  802bcd:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+}
+  802bd9:	90                   	nop
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+0000000000802bdc <getchar>:
+
+int
+getchar(void) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802be4:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802be8:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bed:	48 89 c6             	mov    %rax,%rsi
+  802bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf5:	48 b8 0f 11 80 00 00 	movabs $0x80110f,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c08:	79 05                	jns    802c0f <getchar+0x33>
+    return r;
+  802c0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c0d:	eb 14                	jmp    802c23 <getchar+0x47>
+  if (r < 1)
+  802c0f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c13:	7f 07                	jg     802c1c <getchar+0x40>
+    return -E_EOF;
+  802c15:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c1a:	eb 07                	jmp    802c23 <getchar+0x47>
+  return c;
+  802c1c:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c20:	0f b6 c0             	movzbl %al,%eax
+}
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+0000000000802c25 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	48 83 ec 20          	sub    $0x20,%rsp
+  802c2d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c30:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c37:	48 89 d6             	mov    %rdx,%rsi
+  802c3a:	89 c7                	mov    %eax,%edi
+  802c3c:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  802c43:	00 00 00 
+  802c46:	ff d0                	call   *%rax
+  802c48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c4f:	79 05                	jns    802c56 <iscons+0x31>
+    return r;
+  802c51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c54:	eb 1a                	jmp    802c70 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5a:	8b 10                	mov    (%rax),%edx
+  802c5c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c63:	00 00 00 
+  802c66:	8b 00                	mov    (%rax),%eax
+  802c68:	39 c2                	cmp    %eax,%edx
+  802c6a:	0f 94 c0             	sete   %al
+  802c6d:	0f b6 c0             	movzbl %al,%eax
+}
+  802c70:	c9                   	leave
+  802c71:	c3                   	ret
+
+0000000000802c72 <opencons>:
+
+int
+opencons(void) {
+  802c72:	55                   	push   %rbp
+  802c73:	48 89 e5             	mov    %rsp,%rbp
+  802c76:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c7a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c7e:	48 89 c7             	mov    %rax,%rdi
+  802c81:	48 b8 d1 0a 80 00 00 	movabs $0x800ad1,%rax
+  802c88:	00 00 00 
+  802c8b:	ff d0                	call   *%rax
+  802c8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c94:	79 05                	jns    802c9b <opencons+0x29>
+    return r;
+  802c96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c99:	eb 66                	jmp    802d01 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802c9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c9f:	ba 07 04 00 00       	mov    $0x407,%edx
+  802ca4:	48 89 c6             	mov    %rax,%rsi
+  802ca7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cac:	48 b8 9c 03 80 00 00 	movabs $0x80039c,%rax
+  802cb3:	00 00 00 
+  802cb6:	ff d0                	call   *%rax
+  802cb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cbf:	79 05                	jns    802cc6 <opencons+0x54>
+    return r;
+  802cc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc4:	eb 3b                	jmp    802d01 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802cc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cca:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cd1:	00 00 00 
+  802cd4:	8b 12                	mov    (%rdx),%edx
+  802cd6:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cdc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce7:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf2:	48 89 c7             	mov    %rax,%rdi
+  802cf5:	48 b8 83 0a 80 00 00 	movabs $0x800a83,%rax
+  802cfc:	00 00 00 
+  802cff:	ff d0                	call   *%rax
+}
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+0000000000802d03 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	48 83 ec 20          	sub    $0x20,%rsp
+  802d0b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d0e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d11:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d18:	48 89 d6             	mov    %rdx,%rsi
+  802d1b:	89 c7                	mov    %eax,%edi
+  802d1d:	48 b8 b3 0b 80 00 00 	movabs $0x800bb3,%rax
+  802d24:	00 00 00 
+  802d27:	ff d0                	call   *%rax
+  802d29:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d30:	79 05                	jns    802d37 <consmode+0x34>
+    return r;
+  802d32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d35:	eb 34                	jmp    802d6b <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3b:	8b 10                	mov    (%rax),%edx
+  802d3d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d44:	00 00 00 
+  802d47:	8b 00                	mov    (%rax),%eax
+  802d49:	39 c2                	cmp    %eax,%edx
+  802d4b:	74 07                	je     802d54 <consmode+0x51>
+    return -E_INVAL;
+  802d4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d52:	eb 17                	jmp    802d6b <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d58:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d62:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d65:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d6b:	c9                   	leave
+  802d6c:	c3                   	ret
+
+0000000000802d6d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d6d:	55                   	push   %rbp
+  802d6e:	48 89 e5             	mov    %rsp,%rbp
+  802d71:	48 83 ec 20          	sub    $0x20,%rsp
+  802d75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d7d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d85:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d88:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d90:	48 89 ce             	mov    %rcx,%rsi
+  802d93:	48 89 c7             	mov    %rax,%rdi
+  802d96:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+  802da2:	48 98                	cltq
+}
+  802da4:	c9                   	leave
+  802da5:	c3                   	ret
+
+0000000000802da6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802da6:	55                   	push   %rbp
+  802da7:	48 89 e5             	mov    %rsp,%rbp
+  802daa:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802db1:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802db8:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dbf:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802dc6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dcd:	eb 74                	jmp    802e43 <devcons_write+0x9d>
+    m = n - tot;
+  802dcf:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802dd6:	89 c2                	mov    %eax,%edx
+  802dd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ddb:	29 c2                	sub    %eax,%edx
+  802ddd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802de0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802de3:	83 f8 7f             	cmp    $0x7f,%eax
+  802de6:	76 07                	jbe    802def <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802de8:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802def:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802df2:	48 63 d0             	movslq %eax,%rdx
+  802df5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802df8:	48 63 c8             	movslq %eax,%rcx
+  802dfb:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e02:	48 01 c1             	add    %rax,%rcx
+  802e05:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e0c:	48 89 ce             	mov    %rcx,%rsi
+  802e0f:	48 89 c7             	mov    %rax,%rdi
+  802e12:	48 b8 3e 46 80 00 00 	movabs $0x80463e,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e1e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e21:	48 63 d0             	movslq %eax,%rdx
+  802e24:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e2b:	48 89 d6             	mov    %rdx,%rsi
+  802e2e:	48 89 c7             	mov    %rax,%rdi
+  802e31:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e3d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e40:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e46:	48 98                	cltq
+  802e48:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e4f:	0f 82 7a ff ff ff    	jb     802dcf <devcons_write+0x29>
+  }
+  return tot;
+  802e55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e58:	48 98                	cltq
+}
+  802e5a:	c9                   	leave
+  802e5b:	c3                   	ret
+
+0000000000802e5c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e5c:	55                   	push   %rbp
+  802e5d:	48 89 e5             	mov    %rsp,%rbp
+  802e60:	48 83 ec 08          	sub    $0x8,%rsp
+  802e64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e6d:	c9                   	leave
+  802e6e:	c3                   	ret
+
+0000000000802e6f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e6f:	55                   	push   %rbp
+  802e70:	48 89 e5             	mov    %rsp,%rbp
+  802e73:	48 83 ec 10          	sub    $0x10,%rsp
+  802e77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e83:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e8a:	00 00 00 
+  802e8d:	48 89 d6             	mov    %rdx,%rsi
+  802e90:	48 89 c7             	mov    %rax,%rdi
+  802e93:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  802e9a:	00 00 00 
+  802e9d:	ff d0                	call   *%rax
+  return 0;
+  802e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ea4:	c9                   	leave
+  802ea5:	c3                   	ret
+
+0000000000802ea6 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ea6:	55                   	push   %rbp
+  802ea7:	48 89 e5             	mov    %rsp,%rbp
+  802eaa:	48 83 ec 30          	sub    $0x30,%rsp
+  802eae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eb2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802eb5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802eb9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ec0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ec3:	83 e0 02             	and    $0x2,%eax
+  802ec6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ec9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ecd:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ed0:	83 f8 01             	cmp    $0x1,%eax
+  802ed3:	75 04                	jne    802ed9 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ed5:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ed9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802edc:	83 e0 01             	and    $0x1,%eax
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	74 44                	je     802f27 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802ee3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eeb:	89 c2                	mov    %eax,%edx
+  802eed:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef7:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  802efe:	00 00 00 
+  802f01:	ff d0                	call   *%rax
+  802f03:	83 f8 01             	cmp    $0x1,%eax
+  802f06:	75 06                	jne    802f0e <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f08:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f0c:	eb 19                	jmp    802f27 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f12:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f18:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f1b:	89 c2                	mov    %eax,%edx
+  802f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f21:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f27:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f2a:	c9                   	leave
+  802f2b:	c3                   	ret
+
+0000000000802f2c <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f2c:	55                   	push   %rbp
+  802f2d:	48 89 e5             	mov    %rsp,%rbp
+  802f30:	53                   	push   %rbx
+  802f31:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f38:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f3f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f45:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f4c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f53:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f5a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f61:	84 c0                	test   %al,%al
+  802f63:	74 23                	je     802f88 <_panic+0x5c>
+  802f65:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f6c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f70:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f74:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f78:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f7c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f80:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f84:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f88:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802f8f:	00 00 00 
+  802f92:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802f99:	00 00 00 
+  802f9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fa0:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fa7:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fae:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fb5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fbc:	00 00 00 
+  802fbf:	48 8b 18             	mov    (%rax),%rbx
+  802fc2:	48 b8 23 03 80 00 00 	movabs $0x800323,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+  802fce:	89 c6                	mov    %eax,%esi
+  802fd0:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802fd6:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802fdd:	41 89 d0             	mov    %edx,%r8d
+  802fe0:	48 89 c1             	mov    %rax,%rcx
+  802fe3:	48 89 da             	mov    %rbx,%rdx
+  802fe6:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  802fed:	00 00 00 
+  802ff0:	48 89 c7             	mov    %rax,%rdi
+  802ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff8:	49 b9 4b 31 80 00 00 	movabs $0x80314b,%r9
+  802fff:	00 00 00 
+  803002:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803005:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80300c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803013:	48 89 d6             	mov    %rdx,%rsi
+  803016:	48 89 c7             	mov    %rax,%rdi
+  803019:	48 b8 c0 30 80 00 00 	movabs $0x8030c0,%rax
+  803020:	00 00 00 
+  803023:	ff d0                	call   *%rax
+  cprintf("\n");
+  803025:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  80302c:	00 00 00 
+  80302f:	48 89 c7             	mov    %rax,%rdi
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+  803037:	48 ba 4b 31 80 00 00 	movabs $0x80314b,%rdx
+  80303e:	00 00 00 
+  803041:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803043:	cc                   	int3
+  803044:	eb fd                	jmp    803043 <_panic+0x117>
+
+0000000000803046 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803046:	55                   	push   %rbp
+  803047:	48 89 e5             	mov    %rsp,%rbp
+  80304a:	48 83 ec 10          	sub    $0x10,%rsp
+  80304e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803051:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803059:	8b 00                	mov    (%rax),%eax
+  80305b:	8d 48 01             	lea    0x1(%rax),%ecx
+  80305e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803062:	89 0a                	mov    %ecx,(%rdx)
+  803064:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803067:	89 d1                	mov    %edx,%ecx
+  803069:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80306d:	48 98                	cltq
+  80306f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803073:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803077:	8b 00                	mov    (%rax),%eax
+  803079:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80307e:	75 2c                	jne    8030ac <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  803080:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803084:	8b 00                	mov    (%rax),%eax
+  803086:	48 98                	cltq
+  803088:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80308c:	48 83 c2 08          	add    $0x8,%rdx
+  803090:	48 89 c6             	mov    %rax,%rsi
+  803093:	48 89 d7             	mov    %rdx,%rdi
+  803096:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b0:	8b 40 04             	mov    0x4(%rax),%eax
+  8030b3:	8d 50 01             	lea    0x1(%rax),%edx
+  8030b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ba:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030bd:	90                   	nop
+  8030be:	c9                   	leave
+  8030bf:	c3                   	ret
+
+00000000008030c0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030c0:	55                   	push   %rbp
+  8030c1:	48 89 e5             	mov    %rsp,%rbp
+  8030c4:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030cb:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030d2:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030d9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030e0:	00 00 00 
+  b.cnt = 0;
+  8030e3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030ea:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8030ed:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8030f4:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8030fb:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803102:	48 89 c6             	mov    %rax,%rsi
+  803105:	48 b8 46 30 80 00 00 	movabs $0x803046,%rax
+  80310c:	00 00 00 
+  80310f:	48 89 c7             	mov    %rax,%rdi
+  803112:	48 b8 a5 34 80 00 00 	movabs $0x8034a5,%rax
+  803119:	00 00 00 
+  80311c:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80311e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803124:	48 98                	cltq
+  803126:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80312d:	48 83 c2 08          	add    $0x8,%rdx
+  803131:	48 89 c6             	mov    %rax,%rsi
+  803134:	48 89 d7             	mov    %rdx,%rdi
+  803137:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803143:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  803149:	c9                   	leave
+  80314a:	c3                   	ret
+
+000000000080314b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80314b:	55                   	push   %rbp
+  80314c:	48 89 e5             	mov    %rsp,%rbp
+  80314f:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803156:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80315d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803164:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80316b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803172:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803179:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803180:	84 c0                	test   %al,%al
+  803182:	74 20                	je     8031a4 <cprintf+0x59>
+  803184:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803188:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80318c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803190:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803194:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803198:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80319c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031a0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031a4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031ab:	00 00 00 
+  8031ae:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031b5:	00 00 00 
+  8031b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031bc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031c3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031ca:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031d1:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031d8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031df:	48 89 d6             	mov    %rdx,%rsi
+  8031e2:	48 89 c7             	mov    %rax,%rdi
+  8031e5:	48 b8 c0 30 80 00 00 	movabs $0x8030c0,%rax
+  8031ec:	00 00 00 
+  8031ef:	ff d0                	call   *%rax
+  8031f1:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8031f7:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8031fd:	c9                   	leave
+  8031fe:	c3                   	ret
+
+00000000008031ff <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8031ff:	55                   	push   %rbp
+  803200:	48 89 e5             	mov    %rsp,%rbp
+  803203:	48 83 ec 30          	sub    $0x30,%rsp
+  803207:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80320b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80320f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803213:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803216:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80321a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80321e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803221:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803225:	72 54                	jb     80327b <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803227:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80322a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80322d:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803230:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803234:	ba 00 00 00 00       	mov    $0x0,%edx
+  803239:	48 f7 f6             	div    %rsi
+  80323c:	49 89 c2             	mov    %rax,%r10
+  80323f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803242:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803245:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80324d:	41 89 c9             	mov    %ecx,%r9d
+  803250:	41 89 f8             	mov    %edi,%r8d
+  803253:	89 d1                	mov    %edx,%ecx
+  803255:	4c 89 d2             	mov    %r10,%rdx
+  803258:	48 89 c7             	mov    %rax,%rdi
+  80325b:	48 b8 ff 31 80 00 00 	movabs $0x8031ff,%rax
+  803262:	00 00 00 
+  803265:	ff d0                	call   *%rax
+  803267:	eb 1c                	jmp    803285 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  803269:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80326d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803270:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803274:	48 89 d6             	mov    %rdx,%rsi
+  803277:	89 c7                	mov    %eax,%edi
+  803279:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80327b:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80327f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803283:	7f e4                	jg     803269 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  803285:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80328c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803291:	48 f7 f1             	div    %rcx
+  803294:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  80329b:	00 00 00 
+  80329e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032a2:	0f be c0             	movsbl %al,%eax
+  8032a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032a9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032ad:	48 89 d6             	mov    %rdx,%rsi
+  8032b0:	89 c7                	mov    %eax,%edi
+  8032b2:	ff d1                	call   *%rcx
+}
+  8032b4:	90                   	nop
+  8032b5:	c9                   	leave
+  8032b6:	c3                   	ret
+
+00000000008032b7 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032b7:	55                   	push   %rbp
+  8032b8:	48 89 e5             	mov    %rsp,%rbp
+  8032bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8032bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032c6:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032ca:	7e 4b                	jle    803317 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d0:	8b 00                	mov    (%rax),%eax
+  8032d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8032d5:	77 24                	ja     8032fb <getuint+0x44>
+  8032d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e3:	8b 00                	mov    (%rax),%eax
+  8032e5:	89 c0                	mov    %eax,%eax
+  8032e7:	48 01 d0             	add    %rdx,%rax
+  8032ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032ee:	8b 12                	mov    (%rdx),%edx
+  8032f0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8032f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f7:	89 0a                	mov    %ecx,(%rdx)
+  8032f9:	eb 14                	jmp    80330f <getuint+0x58>
+  8032fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803303:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803307:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80330f:	48 8b 00             	mov    (%rax),%rax
+  803312:	e9 95 00 00 00       	jmp    8033ac <getuint+0xf5>
+  else if (lflag)
+  803317:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80331b:	74 48                	je     803365 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80331d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803321:	8b 00                	mov    (%rax),%eax
+  803323:	83 f8 2f             	cmp    $0x2f,%eax
+  803326:	77 24                	ja     80334c <getuint+0x95>
+  803328:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80332c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803334:	8b 00                	mov    (%rax),%eax
+  803336:	89 c0                	mov    %eax,%eax
+  803338:	48 01 d0             	add    %rdx,%rax
+  80333b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80333f:	8b 12                	mov    (%rdx),%edx
+  803341:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803344:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803348:	89 0a                	mov    %ecx,(%rdx)
+  80334a:	eb 14                	jmp    803360 <getuint+0xa9>
+  80334c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803350:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803354:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803358:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803360:	48 8b 00             	mov    (%rax),%rax
+  803363:	eb 47                	jmp    8033ac <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803369:	8b 00                	mov    (%rax),%eax
+  80336b:	83 f8 2f             	cmp    $0x2f,%eax
+  80336e:	77 24                	ja     803394 <getuint+0xdd>
+  803370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803374:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803378:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80337c:	8b 00                	mov    (%rax),%eax
+  80337e:	89 c0                	mov    %eax,%eax
+  803380:	48 01 d0             	add    %rdx,%rax
+  803383:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803387:	8b 12                	mov    (%rdx),%edx
+  803389:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80338c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803390:	89 0a                	mov    %ecx,(%rdx)
+  803392:	eb 14                	jmp    8033a8 <getuint+0xf1>
+  803394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803398:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80339c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033a8:	8b 00                	mov    (%rax),%eax
+  8033aa:	89 c0                	mov    %eax,%eax
+}
+  8033ac:	c9                   	leave
+  8033ad:	c3                   	ret
+
+00000000008033ae <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033ae:	55                   	push   %rbp
+  8033af:	48 89 e5             	mov    %rsp,%rbp
+  8033b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8033b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033ba:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033bd:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033c1:	7e 4b                	jle    80340e <getint+0x60>
+    return va_arg(*ap, long long);
+  8033c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c7:	8b 00                	mov    (%rax),%eax
+  8033c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8033cc:	77 24                	ja     8033f2 <getint+0x44>
+  8033ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033da:	8b 00                	mov    (%rax),%eax
+  8033dc:	89 c0                	mov    %eax,%eax
+  8033de:	48 01 d0             	add    %rdx,%rax
+  8033e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033e5:	8b 12                	mov    (%rdx),%edx
+  8033e7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ee:	89 0a                	mov    %ecx,(%rdx)
+  8033f0:	eb 14                	jmp    803406 <getint+0x58>
+  8033f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033fa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803402:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803406:	48 8b 00             	mov    (%rax),%rax
+  803409:	e9 95 00 00 00       	jmp    8034a3 <getint+0xf5>
+  else if (lflag)
+  80340e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803412:	74 48                	je     80345c <getint+0xae>
+    return va_arg(*ap, long);
+  803414:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803418:	8b 00                	mov    (%rax),%eax
+  80341a:	83 f8 2f             	cmp    $0x2f,%eax
+  80341d:	77 24                	ja     803443 <getint+0x95>
+  80341f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803423:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803427:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80342b:	8b 00                	mov    (%rax),%eax
+  80342d:	89 c0                	mov    %eax,%eax
+  80342f:	48 01 d0             	add    %rdx,%rax
+  803432:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803436:	8b 12                	mov    (%rdx),%edx
+  803438:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80343b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80343f:	89 0a                	mov    %ecx,(%rdx)
+  803441:	eb 14                	jmp    803457 <getint+0xa9>
+  803443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803447:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80344b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80344f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803453:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803457:	48 8b 00             	mov    (%rax),%rax
+  80345a:	eb 47                	jmp    8034a3 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80345c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803460:	8b 00                	mov    (%rax),%eax
+  803462:	83 f8 2f             	cmp    $0x2f,%eax
+  803465:	77 24                	ja     80348b <getint+0xdd>
+  803467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80346f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803473:	8b 00                	mov    (%rax),%eax
+  803475:	89 c0                	mov    %eax,%eax
+  803477:	48 01 d0             	add    %rdx,%rax
+  80347a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80347e:	8b 12                	mov    (%rdx),%edx
+  803480:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803483:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803487:	89 0a                	mov    %ecx,(%rdx)
+  803489:	eb 14                	jmp    80349f <getint+0xf1>
+  80348b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803493:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803497:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80349f:	8b 00                	mov    (%rax),%eax
+  8034a1:	48 98                	cltq
+}
+  8034a3:	c9                   	leave
+  8034a4:	c3                   	ret
+
+00000000008034a5 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034a5:	55                   	push   %rbp
+  8034a6:	48 89 e5             	mov    %rsp,%rbp
+  8034a9:	41 54                	push   %r12
+  8034ab:	53                   	push   %rbx
+  8034ac:	48 83 ec 60          	sub    $0x60,%rsp
+  8034b0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034b4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034b8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034bc:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034c0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034c4:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034c8:	48 8b 06             	mov    (%rsi),%rax
+  8034cb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034cf:	48 89 01             	mov    %rax,(%rcx)
+  8034d2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034d6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034da:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034de:	eb 17                	jmp    8034f7 <vprintfmt+0x52>
+      if (ch == '\0')
+  8034e0:	85 db                	test   %ebx,%ebx
+  8034e2:	0f 84 bf 04 00 00    	je     8039a7 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034e8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034ec:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8034f0:	48 89 c6             	mov    %rax,%rsi
+  8034f3:	89 df                	mov    %ebx,%edi
+  8034f5:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034f7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8034fb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8034ff:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803503:	0f b6 00             	movzbl (%rax),%eax
+  803506:	0f b6 d8             	movzbl %al,%ebx
+  803509:	83 fb 25             	cmp    $0x25,%ebx
+  80350c:	75 d2                	jne    8034e0 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80350e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803512:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  803519:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803520:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803527:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80352e:	eb 04                	jmp    803534 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803530:	90                   	nop
+  803531:	eb 01                	jmp    803534 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803533:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803534:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803538:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80353c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803540:	0f b6 00             	movzbl (%rax),%eax
+  803543:	0f b6 d8             	movzbl %al,%ebx
+  803546:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  803549:	83 f8 55             	cmp    $0x55,%eax
+  80354c:	0f 87 22 04 00 00    	ja     803974 <vprintfmt+0x4cf>
+  803552:	89 c0                	mov    %eax,%eax
+  803554:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80355b:	00 
+  80355c:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  803563:	00 00 00 
+  803566:	48 01 d0             	add    %rdx,%rax
+  803569:	48 8b 00             	mov    (%rax),%rax
+  80356c:	ff e0                	jmp    *%rax
+        padc = '-';
+  80356e:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803572:	eb c0                	jmp    803534 <vprintfmt+0x8f>
+        padc = '0';
+  803574:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803578:	eb ba                	jmp    803534 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80357a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  803581:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803584:	89 d0                	mov    %edx,%eax
+  803586:	c1 e0 02             	shl    $0x2,%eax
+  803589:	01 d0                	add    %edx,%eax
+  80358b:	01 c0                	add    %eax,%eax
+  80358d:	01 d8                	add    %ebx,%eax
+  80358f:	83 e8 30             	sub    $0x30,%eax
+  803592:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  803595:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803599:	0f b6 00             	movzbl (%rax),%eax
+  80359c:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80359f:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035a2:	7e 60                	jle    803604 <vprintfmt+0x15f>
+  8035a4:	83 fb 39             	cmp    $0x39,%ebx
+  8035a7:	7f 5b                	jg     803604 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035a9:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035ae:	eb d1                	jmp    803581 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8035b6:	77 17                	ja     8035cf <vprintfmt+0x12a>
+  8035b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035bc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035bf:	89 d2                	mov    %edx,%edx
+  8035c1:	48 01 d0             	add    %rdx,%rax
+  8035c4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035c7:	83 c2 08             	add    $0x8,%edx
+  8035ca:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035cd:	eb 0c                	jmp    8035db <vprintfmt+0x136>
+  8035cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035d3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035d7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035db:	8b 00                	mov    (%rax),%eax
+  8035dd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035e0:	eb 23                	jmp    803605 <vprintfmt+0x160>
+        if (width < 0)
+  8035e2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035e6:	0f 89 44 ff ff ff    	jns    803530 <vprintfmt+0x8b>
+          width = 0;
+  8035ec:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8035f3:	e9 38 ff ff ff       	jmp    803530 <vprintfmt+0x8b>
+        altflag = 1;
+  8035f8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8035ff:	e9 30 ff ff ff       	jmp    803534 <vprintfmt+0x8f>
+        goto process_precision;
+  803604:	90                   	nop
+        if (width < 0)
+  803605:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803609:	0f 89 24 ff ff ff    	jns    803533 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80360f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803612:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803615:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80361c:	e9 12 ff ff ff       	jmp    803533 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803621:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803625:	e9 0a ff ff ff       	jmp    803534 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80362a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80362d:	83 f8 2f             	cmp    $0x2f,%eax
+  803630:	77 17                	ja     803649 <vprintfmt+0x1a4>
+  803632:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803636:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803639:	89 d2                	mov    %edx,%edx
+  80363b:	48 01 d0             	add    %rdx,%rax
+  80363e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803641:	83 c2 08             	add    $0x8,%edx
+  803644:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803647:	eb 0c                	jmp    803655 <vprintfmt+0x1b0>
+  803649:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80364d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803651:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803655:	8b 00                	mov    (%rax),%eax
+  803657:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80365b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80365f:	48 89 d6             	mov    %rdx,%rsi
+  803662:	89 c7                	mov    %eax,%edi
+  803664:	ff d1                	call   *%rcx
+        break;
+  803666:	e9 37 03 00 00       	jmp    8039a2 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80366b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80366e:	83 f8 2f             	cmp    $0x2f,%eax
+  803671:	77 17                	ja     80368a <vprintfmt+0x1e5>
+  803673:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803677:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80367a:	89 d2                	mov    %edx,%edx
+  80367c:	48 01 d0             	add    %rdx,%rax
+  80367f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803682:	83 c2 08             	add    $0x8,%edx
+  803685:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803688:	eb 0c                	jmp    803696 <vprintfmt+0x1f1>
+  80368a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80368e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803692:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803696:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  803698:	85 db                	test   %ebx,%ebx
+  80369a:	79 02                	jns    80369e <vprintfmt+0x1f9>
+          err = -err;
+  80369c:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80369e:	83 fb 15             	cmp    $0x15,%ebx
+  8036a1:	7f 16                	jg     8036b9 <vprintfmt+0x214>
+  8036a3:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036aa:	00 00 00 
+  8036ad:	48 63 c3             	movslq %ebx,%rax
+  8036b0:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036b4:	4d 85 e4             	test   %r12,%r12
+  8036b7:	75 2e                	jne    8036e7 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036b9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036c1:	89 d9                	mov    %ebx,%ecx
+  8036c3:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036ca:	00 00 00 
+  8036cd:	48 89 c7             	mov    %rax,%rdi
+  8036d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d5:	49 b8 b1 39 80 00 00 	movabs $0x8039b1,%r8
+  8036dc:	00 00 00 
+  8036df:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036e2:	e9 bb 02 00 00       	jmp    8039a2 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036e7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036ef:	4c 89 e1             	mov    %r12,%rcx
+  8036f2:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  8036f9:	00 00 00 
+  8036fc:	48 89 c7             	mov    %rax,%rdi
+  8036ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803704:	49 b8 b1 39 80 00 00 	movabs $0x8039b1,%r8
+  80370b:	00 00 00 
+  80370e:	41 ff d0             	call   *%r8
+        break;
+  803711:	e9 8c 02 00 00       	jmp    8039a2 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803716:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803719:	83 f8 2f             	cmp    $0x2f,%eax
+  80371c:	77 17                	ja     803735 <vprintfmt+0x290>
+  80371e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803722:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803725:	89 d2                	mov    %edx,%edx
+  803727:	48 01 d0             	add    %rdx,%rax
+  80372a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80372d:	83 c2 08             	add    $0x8,%edx
+  803730:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803733:	eb 0c                	jmp    803741 <vprintfmt+0x29c>
+  803735:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803739:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80373d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803741:	4c 8b 20             	mov    (%rax),%r12
+  803744:	4d 85 e4             	test   %r12,%r12
+  803747:	75 0a                	jne    803753 <vprintfmt+0x2ae>
+          p = "(null)";
+  803749:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  803750:	00 00 00 
+        if (width > 0 && padc != '-')
+  803753:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803757:	7e 78                	jle    8037d1 <vprintfmt+0x32c>
+  803759:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80375d:	74 72                	je     8037d1 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80375f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803762:	48 98                	cltq
+  803764:	48 89 c6             	mov    %rax,%rsi
+  803767:	4c 89 e7             	mov    %r12,%rdi
+  80376a:	48 b8 bd 40 80 00 00 	movabs $0x8040bd,%rax
+  803771:	00 00 00 
+  803774:	ff d0                	call   *%rax
+  803776:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803779:	eb 17                	jmp    803792 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80377b:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80377f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803783:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803787:	48 89 d6             	mov    %rdx,%rsi
+  80378a:	89 c7                	mov    %eax,%edi
+  80378c:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80378e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803792:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803796:	7f e3                	jg     80377b <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803798:	eb 37                	jmp    8037d1 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80379a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80379e:	74 1e                	je     8037be <vprintfmt+0x319>
+  8037a0:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037a3:	7e 05                	jle    8037aa <vprintfmt+0x305>
+  8037a5:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037a8:	7e 14                	jle    8037be <vprintfmt+0x319>
+            putch('?', putdat);
+  8037aa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037ae:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037b2:	48 89 c6             	mov    %rax,%rsi
+  8037b5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037ba:	ff d2                	call   *%rdx
+  8037bc:	eb 0f                	jmp    8037cd <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037c2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037c6:	48 89 c6             	mov    %rax,%rsi
+  8037c9:	89 df                	mov    %ebx,%edi
+  8037cb:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037cd:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037d1:	4c 89 e0             	mov    %r12,%rax
+  8037d4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037d8:	0f b6 00             	movzbl (%rax),%eax
+  8037db:	0f be d8             	movsbl %al,%ebx
+  8037de:	85 db                	test   %ebx,%ebx
+  8037e0:	74 28                	je     80380a <vprintfmt+0x365>
+  8037e2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037e6:	78 b2                	js     80379a <vprintfmt+0x2f5>
+  8037e8:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8037ec:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037f0:	79 a8                	jns    80379a <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8037f2:	eb 16                	jmp    80380a <vprintfmt+0x365>
+          putch(' ', putdat);
+  8037f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037f8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037fc:	48 89 c6             	mov    %rax,%rsi
+  8037ff:	bf 20 00 00 00       	mov    $0x20,%edi
+  803804:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803806:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80380a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80380e:	7f e4                	jg     8037f4 <vprintfmt+0x34f>
+        break;
+  803810:	e9 8d 01 00 00       	jmp    8039a2 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803815:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803818:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80381c:	89 d6                	mov    %edx,%esi
+  80381e:	48 89 c7             	mov    %rax,%rdi
+  803821:	48 b8 ae 33 80 00 00 	movabs $0x8033ae,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+  80382d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803831:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803835:	48 85 c0             	test   %rax,%rax
+  803838:	79 1d                	jns    803857 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80383a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80383e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803842:	48 89 c6             	mov    %rax,%rsi
+  803845:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80384a:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80384c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803850:	48 f7 d8             	neg    %rax
+  803853:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803857:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80385e:	e9 d2 00 00 00       	jmp    803935 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803863:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803866:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80386a:	89 d6                	mov    %edx,%esi
+  80386c:	48 89 c7             	mov    %rax,%rdi
+  80386f:	48 b8 b7 32 80 00 00 	movabs $0x8032b7,%rax
+  803876:	00 00 00 
+  803879:	ff d0                	call   *%rax
+  80387b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80387f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803886:	e9 aa 00 00 00       	jmp    803935 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80388b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80388e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803892:	89 d6                	mov    %edx,%esi
+  803894:	48 89 c7             	mov    %rax,%rdi
+  803897:	48 b8 b7 32 80 00 00 	movabs $0x8032b7,%rax
+  80389e:	00 00 00 
+  8038a1:	ff d0                	call   *%rax
+  8038a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038a7:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038ae:	e9 82 00 00 00       	jmp    803935 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038b7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038bb:	48 89 c6             	mov    %rax,%rsi
+  8038be:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038c3:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038c5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038c9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038cd:	48 89 c6             	mov    %rax,%rsi
+  8038d0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038d5:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038da:	83 f8 2f             	cmp    $0x2f,%eax
+  8038dd:	77 17                	ja     8038f6 <vprintfmt+0x451>
+  8038df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038e6:	89 d2                	mov    %edx,%edx
+  8038e8:	48 01 d0             	add    %rdx,%rax
+  8038eb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038ee:	83 c2 08             	add    $0x8,%edx
+  8038f1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8038f4:	eb 0c                	jmp    803902 <vprintfmt+0x45d>
+  8038f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038fa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8038fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803902:	48 8b 00             	mov    (%rax),%rax
+  803905:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803909:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803910:	eb 23                	jmp    803935 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803912:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803915:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803919:	89 d6                	mov    %edx,%esi
+  80391b:	48 89 c7             	mov    %rax,%rdi
+  80391e:	48 b8 b7 32 80 00 00 	movabs $0x8032b7,%rax
+  803925:	00 00 00 
+  803928:	ff d0                	call   *%rax
+  80392a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80392e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803935:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80393a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80393d:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803940:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803944:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803948:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80394c:	45 89 c1             	mov    %r8d,%r9d
+  80394f:	41 89 f8             	mov    %edi,%r8d
+  803952:	48 89 c7             	mov    %rax,%rdi
+  803955:	48 b8 ff 31 80 00 00 	movabs $0x8031ff,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+        break;
+  803961:	eb 3f                	jmp    8039a2 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803963:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803967:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80396b:	48 89 c6             	mov    %rax,%rsi
+  80396e:	89 df                	mov    %ebx,%edi
+  803970:	ff d2                	call   *%rdx
+        break;
+  803972:	eb 2e                	jmp    8039a2 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803974:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803978:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80397c:	48 89 c6             	mov    %rax,%rsi
+  80397f:	bf 25 00 00 00       	mov    $0x25,%edi
+  803984:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803986:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80398b:	eb 05                	jmp    803992 <vprintfmt+0x4ed>
+  80398d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803992:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803996:	48 83 e8 01          	sub    $0x1,%rax
+  80399a:	0f b6 00             	movzbl (%rax),%eax
+  80399d:	3c 25                	cmp    $0x25,%al
+  80399f:	75 ec                	jne    80398d <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039a1:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039a2:	e9 50 fb ff ff       	jmp    8034f7 <vprintfmt+0x52>
+        return;
+  8039a7:	90                   	nop
+    }
+  }
+}
+  8039a8:	48 83 c4 60          	add    $0x60,%rsp
+  8039ac:	5b                   	pop    %rbx
+  8039ad:	41 5c                	pop    %r12
+  8039af:	5d                   	pop    %rbp
+  8039b0:	c3                   	ret
+
+00000000008039b1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039b1:	55                   	push   %rbp
+  8039b2:	48 89 e5             	mov    %rsp,%rbp
+  8039b5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039bc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039c3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039ca:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039d1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039d8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039df:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039e6:	84 c0                	test   %al,%al
+  8039e8:	74 20                	je     803a0a <printfmt+0x59>
+  8039ea:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039ee:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8039f2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8039f6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8039fa:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8039fe:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a02:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a06:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a0a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a11:	00 00 00 
+  803a14:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a1b:	00 00 00 
+  803a1e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a22:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a29:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a30:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a37:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a3e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a45:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a4c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a53:	48 89 c7             	mov    %rax,%rdi
+  803a56:	48 b8 a5 34 80 00 00 	movabs $0x8034a5,%rax
+  803a5d:	00 00 00 
+  803a60:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a62:	90                   	nop
+  803a63:	c9                   	leave
+  803a64:	c3                   	ret
+
+0000000000803a65 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a65:	55                   	push   %rbp
+  803a66:	48 89 e5             	mov    %rsp,%rbp
+  803a69:	48 83 ec 10          	sub    $0x10,%rsp
+  803a6d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a78:	8b 40 10             	mov    0x10(%rax),%eax
+  803a7b:	8d 50 01             	lea    0x1(%rax),%edx
+  803a7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a82:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a89:	48 8b 10             	mov    (%rax),%rdx
+  803a8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a90:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803a94:	48 39 c2             	cmp    %rax,%rdx
+  803a97:	73 17                	jae    803ab0 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803a99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9d:	48 8b 00             	mov    (%rax),%rax
+  803aa0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803aa4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803aa8:	48 89 0a             	mov    %rcx,(%rdx)
+  803aab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803aae:	88 10                	mov    %dl,(%rax)
+}
+  803ab0:	90                   	nop
+  803ab1:	c9                   	leave
+  803ab2:	c3                   	ret
+
+0000000000803ab3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ab3:	55                   	push   %rbp
+  803ab4:	48 89 e5             	mov    %rsp,%rbp
+  803ab7:	48 83 ec 40          	sub    $0x40,%rsp
+  803abb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803abf:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ac2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ac6:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803aca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ace:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ad2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ad5:	48 98                	cltq
+  803ad7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803adb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803adf:	48 01 d0             	add    %rdx,%rax
+  803ae2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803ae6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803aed:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803af2:	74 06                	je     803afa <vsnprintf+0x47>
+  803af4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803af8:	7f 07                	jg     803b01 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803afa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803aff:	eb 32                	jmp    803b33 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b01:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b05:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b09:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b0d:	48 89 c6             	mov    %rax,%rsi
+  803b10:	48 b8 65 3a 80 00 00 	movabs $0x803a65,%rax
+  803b17:	00 00 00 
+  803b1a:	48 89 c7             	mov    %rax,%rdi
+  803b1d:	48 b8 a5 34 80 00 00 	movabs $0x8034a5,%rax
+  803b24:	00 00 00 
+  803b27:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b29:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b2d:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b30:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b33:	c9                   	leave
+  803b34:	c3                   	ret
+
+0000000000803b35 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b35:	55                   	push   %rbp
+  803b36:	48 89 e5             	mov    %rsp,%rbp
+  803b39:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b40:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b47:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b4d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b54:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b5b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b62:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b69:	84 c0                	test   %al,%al
+  803b6b:	74 20                	je     803b8d <snprintf+0x58>
+  803b6d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b71:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b75:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b79:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b7d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b81:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b85:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b89:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803b8d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803b94:	00 00 00 
+  803b97:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803b9e:	00 00 00 
+  803ba1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ba5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bac:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bb3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bba:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bc1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bc8:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bce:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bd5:	48 89 c7             	mov    %rax,%rdi
+  803bd8:	48 b8 b3 3a 80 00 00 	movabs $0x803ab3,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+  803be4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803bea:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803bf0:	c9                   	leave
+  803bf1:	c3                   	ret
+
+0000000000803bf2 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803bf2:	55                   	push   %rbp
+  803bf3:	48 89 e5             	mov    %rsp,%rbp
+  803bf6:	53                   	push   %rbx
+  803bf7:	48 83 ec 38          	sub    $0x38,%rsp
+  803bfb:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803bfe:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c02:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c06:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c0a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c0e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c11:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c16:	89 d1                	mov    %edx,%ecx
+  803c18:	0f a2                	cpuid
+  803c1a:	89 de                	mov    %ebx,%esi
+  803c1c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c1f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c22:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c25:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c2d:	74 09                	je     803c38 <cpuid+0x46>
+}
+  803c2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c33:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c36:	89 10                	mov    %edx,(%rax)
+
+  803c38:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c3d:	74 09                	je     803c48 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c43:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c46:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c48:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c4d:	74 09                	je     803c58 <cpuid+0x66>
+char *
+  803c4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c53:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c56:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c58:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c5d:	74 09                	je     803c68 <cpuid+0x76>
+  for (; *s; s++)
+  803c5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c63:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c66:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c68:	90                   	nop
+  803c69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c6d:	c9                   	leave
+  803c6e:	c3                   	ret
+
+0000000000803c6f <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c6f:	55                   	push   %rbp
+  803c70:	48 89 e5             	mov    %rsp,%rbp
+  803c73:	48 83 ec 18          	sub    $0x18,%rsp
+  803c77:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c7d:	89 c1                	mov    %eax,%ecx
+  803c7f:	0f 01 d0             	xgetbv
+  803c82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c85:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c8b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803c8e:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c92:	48 09 d0             	or     %rdx,%rax
+#else
+  803c95:	c9                   	leave
+  803c96:	c3                   	ret
+
+0000000000803c97 <string_cpu>:
+string_cpu(void) {
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803c9f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803ca6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cad:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cb4:	00 00 00 
+  803cb7:	8b 00                	mov    (%rax),%eax
+  803cb9:	85 c0                	test   %eax,%eax
+  803cbb:	78 11                	js     803cce <string_cpu+0x37>
+    return string_features;
+  803cbd:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cc4:	00 00 00 
+  803cc7:	8b 00                	mov    (%rax),%eax
+  803cc9:	e9 df 00 00 00       	jmp    803dad <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cce:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce2:	48 89 c6             	mov    %rax,%rsi
+  803ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cea:	48 b8 f2 3b 80 00 00 	movabs $0x803bf2,%rax
+  803cf1:	00 00 00 
+  803cf4:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803cf6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803cf9:	83 f8 06             	cmp    $0x6,%eax
+  803cfc:	76 28                	jbe    803d26 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803cfe:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d0d:	48 89 c2             	mov    %rax,%rdx
+  803d10:	be 00 00 00 00       	mov    $0x0,%esi
+  803d15:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d1a:	48 b8 f2 3b 80 00 00 	movabs $0x803bf2,%rax
+  803d21:	00 00 00 
+  803d24:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d26:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d29:	25 00 02 00 00       	and    $0x200,%eax
+  803d2e:	85 c0                	test   %eax,%eax
+  803d30:	74 04                	je     803d36 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d32:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d36:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d40:	48 89 c1             	mov    %rax,%rcx
+  803d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d48:	be 00 00 00 00       	mov    $0x0,%esi
+  803d4d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d52:	48 b8 f2 3b 80 00 00 	movabs $0x803bf2,%rax
+  803d59:	00 00 00 
+  803d5c:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d5e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d61:	83 e0 20             	and    $0x20,%eax
+  803d64:	85 c0                	test   %eax,%eax
+  803d66:	74 2a                	je     803d92 <string_cpu+0xfb>
+  803d68:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d6b:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d70:	85 c0                	test   %eax,%eax
+  803d72:	74 1e                	je     803d92 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d79:	48 b8 6f 3c 80 00 00 	movabs $0x803c6f,%rax
+  803d80:	00 00 00 
+  803d83:	ff d0                	call   *%rax
+  803d85:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d88:	48 83 f8 06          	cmp    $0x6,%rax
+  803d8c:	75 04                	jne    803d92 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803d8e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803d92:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803d99:	00 00 00 
+  803d9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d9f:	89 02                	mov    %eax,(%rdx)
+  803da1:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803da8:	00 00 00 
+  803dab:	8b 00                	mov    (%rax),%eax
+}
+  803dad:	c9                   	leave
+  803dae:	c3                   	ret
+
+0000000000803daf <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803daf:	55                   	push   %rbp
+  803db0:	48 89 e5             	mov    %rsp,%rbp
+  803db3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803db7:	48 83 ec 60          	sub    $0x60,%rsp
+  803dbb:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dc0:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dc5:	83 e0 1f             	and    $0x1f,%eax
+  803dc8:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803dcc:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803dd0:	48 f7 d8             	neg    %rax
+  803dd3:	48 89 c2             	mov    %rax,%rdx
+  803dd6:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803ddb:	48 01 d0             	add    %rdx,%rax
+  803dde:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803de3:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803de7:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803ded:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803df2:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803df6:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803dfc:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e00:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e04:	89 c2                	mov    %eax,%edx
+  803e06:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e0a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e0f:	89 c1                	mov    %eax,%ecx
+  803e11:	d3 e6                	shl    %cl,%esi
+  803e13:	89 f0                	mov    %esi,%eax
+  803e15:	21 d0                	and    %edx,%eax
+  803e17:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e1b:	eb 21                	jmp    803e3e <strlen_avx2+0x8f>
+    p += 32;
+  803e1d:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e23:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e28:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e2c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e32:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e36:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e3a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e3e:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e43:	74 d8                	je     803e1d <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e45:	31 c0                	xor    %eax,%eax
+  803e47:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e4d:	48 63 d0             	movslq %eax,%rdx
+  803e50:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e55:	48 01 d0             	add    %rdx,%rax
+  803e58:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e5d:	c9                   	leave
+  803e5e:	c3                   	ret
+
+0000000000803e5f <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e5f:	55                   	push   %rbp
+  803e60:	48 89 e5             	mov    %rsp,%rbp
+  803e63:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e67:	48 83 ec 40          	sub    $0x40,%rsp
+  803e6b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e70:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e75:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e7a:	eb 77                	jmp    803ef3 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e7c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e81:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e85:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e89:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803e8e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e92:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e96:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e9a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803e9e:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ea3:	74 3c                	je     803ee1 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803ea5:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803ea9:	f7 d0                	not    %eax
+  803eab:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803eaf:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803eb3:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803eb7:	48 63 d0             	movslq %eax,%rdx
+  803eba:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ebf:	48 01 d0             	add    %rdx,%rax
+  803ec2:	0f b6 00             	movzbl (%rax),%eax
+  803ec5:	0f b6 c0             	movzbl %al,%eax
+  803ec8:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ecc:	48 63 ca             	movslq %edx,%rcx
+  803ecf:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ed4:	48 01 ca             	add    %rcx,%rdx
+  803ed7:	0f b6 12             	movzbl (%rdx),%edx
+  803eda:	0f b6 d2             	movzbl %dl,%edx
+  803edd:	29 d0                	sub    %edx,%eax
+  803edf:	eb 6b                	jmp    803f4c <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ee1:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803ee7:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803eed:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803ef3:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803ef9:	77 81                	ja     803e7c <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803efb:	eb 42                	jmp    803f3f <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803efd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f02:	0f b6 10             	movzbl (%rax),%edx
+  803f05:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f0a:	0f b6 00             	movzbl (%rax),%eax
+  803f0d:	38 c2                	cmp    %al,%dl
+  803f0f:	74 1c                	je     803f2d <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f11:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f16:	0f b6 00             	movzbl (%rax),%eax
+  803f19:	0f b6 c8             	movzbl %al,%ecx
+  803f1c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f21:	0f b6 00             	movzbl (%rax),%eax
+  803f24:	0f b6 d0             	movzbl %al,%edx
+  803f27:	89 c8                	mov    %ecx,%eax
+  803f29:	29 d0                	sub    %edx,%eax
+  803f2b:	eb 1f                	jmp    803f4c <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f2d:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f33:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f39:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f3f:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f45:	75 b6                	jne    803efd <memcmp_avx2+0x9e>
+  return 0;
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f4c:	c9                   	leave
+  803f4d:	c3                   	ret
+
+0000000000803f4e <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f4e:	55                   	push   %rbp
+  803f4f:	48 89 e5             	mov    %rsp,%rbp
+  803f52:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f56:	48 83 ec 60          	sub    $0x60,%rsp
+  803f5a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f5f:	89 f0                	mov    %esi,%eax
+  803f61:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f66:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f6a:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f6f:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f73:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f78:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f7e:	eb 47                	jmp    803fc7 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f80:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f85:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f89:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f8d:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803f93:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803f97:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803f9b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803f9f:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fa4:	74 15                	je     803fbb <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fa6:	31 c0                	xor    %eax,%eax
+  803fa8:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fae:	48 63 d0             	movslq %eax,%rdx
+  803fb1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fb6:	48 01 d0             	add    %rdx,%rax
+  803fb9:	eb 3d                	jmp    803ff8 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fbb:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fc1:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fc7:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fcd:	77 b1                	ja     803f80 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fcf:	eb 0c                	jmp    803fdd <memfind_avx2+0x8f>
+  803fd1:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fd7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fdd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fe3:	74 0e                	je     803ff3 <memfind_avx2+0xa5>
+  803fe5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fea:	0f b6 00             	movzbl (%rax),%eax
+  803fed:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  803ff1:	75 de                	jne    803fd1 <memfind_avx2+0x83>
+  return s;
+  803ff3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  803ff8:	c9                   	leave
+  803ff9:	c3                   	ret
+
+0000000000803ffa <strlen>:
+strlen(const char *s) {
+  803ffa:	55                   	push   %rbp
+  803ffb:	48 89 e5             	mov    %rsp,%rbp
+  803ffe:	48 83 ec 40          	sub    $0x40,%rsp
+  804002:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804006:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80400a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80400e:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  804015:	00 00 00 
+  804018:	ff d0                	call   *%rax
+  80401a:	83 e0 02             	and    $0x2,%eax
+  80401d:	85 c0                	test   %eax,%eax
+  80401f:	74 18                	je     804039 <strlen+0x3f>
+    return strlen_avx2(s);
+  804021:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804025:	48 89 c7             	mov    %rax,%rdi
+  804028:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  80402f:	00 00 00 
+  804032:	ff d0                	call   *%rax
+  804034:	e9 82 00 00 00       	jmp    8040bb <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  804039:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80403d:	83 e0 0f             	and    $0xf,%eax
+  804040:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804043:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804046:	48 f7 d8             	neg    %rax
+  804049:	48 89 c2             	mov    %rax,%rdx
+  80404c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804050:	48 01 d0             	add    %rdx,%rax
+  804053:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804057:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80405b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80405f:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804064:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804068:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80406c:	89 c2                	mov    %eax,%edx
+  80406e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804071:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804076:	89 c1                	mov    %eax,%ecx
+  804078:	d3 e6                	shl    %cl,%esi
+  80407a:	89 f0                	mov    %esi,%eax
+  80407c:	21 d0                	and    %edx,%eax
+  80407e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804081:	eb 1d                	jmp    8040a0 <strlen+0xa6>
+    p += 16;
+  804083:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804088:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80408c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804090:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804095:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804099:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80409d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a4:	74 dd                	je     804083 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040a6:	31 c0                	xor    %eax,%eax
+  8040a8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040ad:	48 63 d0             	movslq %eax,%rdx
+  8040b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040b4:	48 01 d0             	add    %rdx,%rax
+  8040b7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040bb:	c9                   	leave
+  8040bc:	c3                   	ret
+
+00000000008040bd <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040bd:	55                   	push   %rbp
+  8040be:	48 89 e5             	mov    %rsp,%rbp
+  8040c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8040c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040d4:	eb 0e                	jmp    8040e4 <strnlen+0x27>
+    n++;
+  8040d6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040da:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040df:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040e4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040e9:	74 0b                	je     8040f6 <strnlen+0x39>
+  8040eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ef:	0f b6 00             	movzbl (%rax),%eax
+  8040f2:	84 c0                	test   %al,%al
+  8040f4:	75 e0                	jne    8040d6 <strnlen+0x19>
+  return n;
+  8040f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8040f9:	c9                   	leave
+  8040fa:	c3                   	ret
+
+00000000008040fb <strcpy>:
+strcpy(char *dst, const char *src) {
+  8040fb:	55                   	push   %rbp
+  8040fc:	48 89 e5             	mov    %rsp,%rbp
+  8040ff:	48 83 ec 20          	sub    $0x20,%rsp
+  804103:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804107:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80410b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80410f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804113:	90                   	nop
+  804114:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804118:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80411c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804124:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804128:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80412c:	0f b6 12             	movzbl (%rdx),%edx
+  80412f:	88 10                	mov    %dl,(%rax)
+  804131:	0f b6 00             	movzbl (%rax),%eax
+  804134:	84 c0                	test   %al,%al
+  804136:	75 dc                	jne    804114 <strcpy+0x19>
+  return ret;
+  804138:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80413c:	c9                   	leave
+  80413d:	c3                   	ret
+
+000000000080413e <strcat>:
+strcat(char *dst, const char *src) {
+  80413e:	55                   	push   %rbp
+  80413f:	48 89 e5             	mov    %rsp,%rbp
+  804142:	48 83 ec 20          	sub    $0x20,%rsp
+  804146:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80414a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80414e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804152:	48 89 c7             	mov    %rax,%rdi
+  804155:	48 b8 fa 3f 80 00 00 	movabs $0x803ffa,%rax
+  80415c:	00 00 00 
+  80415f:	ff d0                	call   *%rax
+  804161:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804164:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804167:	48 63 d0             	movslq %eax,%rdx
+  80416a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416e:	48 01 c2             	add    %rax,%rdx
+  804171:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804175:	48 89 c6             	mov    %rax,%rsi
+  804178:	48 89 d7             	mov    %rdx,%rdi
+  80417b:	48 b8 fb 40 80 00 00 	movabs $0x8040fb,%rax
+  804182:	00 00 00 
+  804185:	ff d0                	call   *%rax
+  return dst;
+  804187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80418b:	c9                   	leave
+  80418c:	c3                   	ret
+
+000000000080418d <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80418d:	55                   	push   %rbp
+  80418e:	48 89 e5             	mov    %rsp,%rbp
+  804191:	48 83 ec 28          	sub    $0x28,%rsp
+  804195:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804199:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80419d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041a9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041b0:	00 
+  8041b1:	eb 2a                	jmp    8041dd <strncpy+0x50>
+    *dst++ = *src;
+  8041b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041c3:	0f b6 12             	movzbl (%rdx),%edx
+  8041c6:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041cc:	0f b6 00             	movzbl (%rax),%eax
+  8041cf:	84 c0                	test   %al,%al
+  8041d1:	74 05                	je     8041d8 <strncpy+0x4b>
+      src++;
+  8041d3:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041d8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041e5:	72 cc                	jb     8041b3 <strncpy+0x26>
+  return ret;
+  8041e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8041eb:	c9                   	leave
+  8041ec:	c3                   	ret
+
+00000000008041ed <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8041ed:	55                   	push   %rbp
+  8041ee:	48 89 e5             	mov    %rsp,%rbp
+  8041f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8041f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804201:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804205:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804209:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80420e:	74 3d                	je     80424d <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804210:	eb 1d                	jmp    80422f <strlcpy+0x42>
+      *dst++ = *src++;
+  804212:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804216:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80421a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80421e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804222:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804226:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80422a:	0f b6 12             	movzbl (%rdx),%edx
+  80422d:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80422f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804234:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804239:	74 0b                	je     804246 <strlcpy+0x59>
+  80423b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80423f:	0f b6 00             	movzbl (%rax),%eax
+  804242:	84 c0                	test   %al,%al
+  804244:	75 cc                	jne    804212 <strlcpy+0x25>
+    *dst = '\0';
+  804246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80424a:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80424d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804251:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804255:	c9                   	leave
+  804256:	c3                   	ret
+
+0000000000804257 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804257:	55                   	push   %rbp
+  804258:	48 89 e5             	mov    %rsp,%rbp
+  80425b:	48 83 ec 30          	sub    $0x30,%rsp
+  80425f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804263:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804267:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80426b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80426f:	48 89 c7             	mov    %rax,%rdi
+  804272:	48 b8 fa 3f 80 00 00 	movabs $0x803ffa,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+  80427e:	48 98                	cltq
+  804280:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804284:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80428c:	48 89 d6             	mov    %rdx,%rsi
+  80428f:	48 89 c7             	mov    %rax,%rdi
+  804292:	48 b8 bd 40 80 00 00 	movabs $0x8040bd,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+  80429e:	48 98                	cltq
+  8042a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042a8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042ac:	75 10                	jne    8042be <strlcat+0x67>
+    return maxlen + srclen;
+  8042ae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042b6:	48 01 d0             	add    %rdx,%rax
+  8042b9:	e9 86 00 00 00       	jmp    804344 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042c2:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042c6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042ca:	73 2b                	jae    8042f7 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042dc:	48 01 c1             	add    %rax,%rcx
+  8042df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042e3:	48 89 c6             	mov    %rax,%rsi
+  8042e6:	48 89 cf             	mov    %rcx,%rdi
+  8042e9:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  8042f0:	00 00 00 
+  8042f3:	ff d0                	call   *%rax
+  8042f5:	eb 42                	jmp    804339 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8042f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042fb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8042ff:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804303:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804307:	48 01 c1             	add    %rax,%rcx
+  80430a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80430e:	48 89 c6             	mov    %rax,%rsi
+  804311:	48 89 cf             	mov    %rcx,%rdi
+  804314:	48 b8 44 48 80 00 00 	movabs $0x804844,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804320:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804324:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804328:	48 01 d0             	add    %rdx,%rax
+  80432b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80432f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804333:	48 01 d0             	add    %rdx,%rax
+  804336:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  804339:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80433d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804341:	48 01 d0             	add    %rdx,%rax
+}
+  804344:	c9                   	leave
+  804345:	c3                   	ret
+
+0000000000804346 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804346:	55                   	push   %rbp
+  804347:	48 89 e5             	mov    %rsp,%rbp
+  80434a:	48 83 ec 10          	sub    $0x10,%rsp
+  80434e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804352:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804356:	eb 0a                	jmp    804362 <strcmp+0x1c>
+    p++, q++;
+  804358:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80435d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804362:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804366:	0f b6 00             	movzbl (%rax),%eax
+  804369:	84 c0                	test   %al,%al
+  80436b:	74 12                	je     80437f <strcmp+0x39>
+  80436d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804371:	0f b6 10             	movzbl (%rax),%edx
+  804374:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804378:	0f b6 00             	movzbl (%rax),%eax
+  80437b:	38 c2                	cmp    %al,%dl
+  80437d:	74 d9                	je     804358 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80437f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804383:	0f b6 00             	movzbl (%rax),%eax
+  804386:	0f b6 d0             	movzbl %al,%edx
+  804389:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80438d:	0f b6 00             	movzbl (%rax),%eax
+  804390:	0f b6 c0             	movzbl %al,%eax
+  804393:	29 c2                	sub    %eax,%edx
+  804395:	89 d0                	mov    %edx,%eax
+}
+  804397:	c9                   	leave
+  804398:	c3                   	ret
+
+0000000000804399 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  804399:	55                   	push   %rbp
+  80439a:	48 89 e5             	mov    %rsp,%rbp
+  80439d:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043ad:	eb 0f                	jmp    8043be <strncmp+0x25>
+    n--, p++, q++;
+  8043af:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043b4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043b9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043be:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043c3:	74 1d                	je     8043e2 <strncmp+0x49>
+  8043c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043c9:	0f b6 00             	movzbl (%rax),%eax
+  8043cc:	84 c0                	test   %al,%al
+  8043ce:	74 12                	je     8043e2 <strncmp+0x49>
+  8043d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d4:	0f b6 10             	movzbl (%rax),%edx
+  8043d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043db:	0f b6 00             	movzbl (%rax),%eax
+  8043de:	38 c2                	cmp    %al,%dl
+  8043e0:	74 cd                	je     8043af <strncmp+0x16>
+  if (n == 0)
+  8043e2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043e7:	75 07                	jne    8043f0 <strncmp+0x57>
+    return 0;
+  8043e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ee:	eb 16                	jmp    804406 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8043f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f4:	0f b6 00             	movzbl (%rax),%eax
+  8043f7:	0f b6 d0             	movzbl %al,%edx
+  8043fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043fe:	0f b6 00             	movzbl (%rax),%eax
+  804401:	0f b6 c0             	movzbl %al,%eax
+  804404:	29 c2                	sub    %eax,%edx
+}
+  804406:	89 d0                	mov    %edx,%eax
+  804408:	c9                   	leave
+  804409:	c3                   	ret
+
+000000000080440a <strchr>:
+strchr(const char *s, char c) {
+  80440a:	55                   	push   %rbp
+  80440b:	48 89 e5             	mov    %rsp,%rbp
+  80440e:	48 83 ec 60          	sub    $0x60,%rsp
+  804412:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804416:	89 f0                	mov    %esi,%eax
+  804418:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80441b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80441f:	83 e0 0f             	and    $0xf,%eax
+  804422:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804425:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804428:	48 f7 d8             	neg    %rax
+  80442b:	48 89 c2             	mov    %rax,%rdx
+  80442e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804432:	48 01 d0             	add    %rdx,%rax
+  804435:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  804439:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80443d:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804441:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804445:	66 0f 6e c0          	movd   %eax,%xmm0
+  804449:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80444d:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804451:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804456:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80445a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80445e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804462:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804466:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80446b:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804470:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804474:	89 c2                	mov    %eax,%edx
+  804476:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80447b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804480:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804484:	09 c2                	or     %eax,%edx
+  804486:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804489:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80448e:	89 c1                	mov    %eax,%ecx
+  804490:	d3 e6                	shl    %cl,%esi
+  804492:	89 f0                	mov    %esi,%eax
+  804494:	21 d0                	and    %edx,%eax
+  804496:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804499:	eb 34                	jmp    8044cf <strchr+0xc5>
+    p += 16;
+  80449b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044a4:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044a8:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044ac:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044b1:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044b6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044ba:	89 c2                	mov    %eax,%edx
+  8044bc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c1:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044c6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044ca:	09 d0                	or     %edx,%eax
+  8044cc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044cf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044d3:	74 c6                	je     80449b <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044d5:	31 c0                	xor    %eax,%eax
+  8044d7:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044dc:	48 98                	cltq
+  8044de:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044e6:	0f b6 00             	movzbl (%rax),%eax
+  8044e9:	84 c0                	test   %al,%al
+  8044eb:	74 06                	je     8044f3 <strchr+0xe9>
+  8044ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f1:	eb 05                	jmp    8044f8 <strchr+0xee>
+  8044f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044f8:	c9                   	leave
+  8044f9:	c3                   	ret
+
+00000000008044fa <strfind>:
+strfind(const char *s, char c) {
+  8044fa:	55                   	push   %rbp
+  8044fb:	48 89 e5             	mov    %rsp,%rbp
+  8044fe:	48 83 ec 10          	sub    $0x10,%rsp
+  804502:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804506:	89 f0                	mov    %esi,%eax
+  804508:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80450b:	eb 11                	jmp    80451e <strfind+0x24>
+    if (*s == c)
+  80450d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804511:	0f b6 00             	movzbl (%rax),%eax
+  804514:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804517:	74 12                	je     80452b <strfind+0x31>
+  for (; *s; s++)
+  804519:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80451e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804522:	0f b6 00             	movzbl (%rax),%eax
+  804525:	84 c0                	test   %al,%al
+  804527:	75 e4                	jne    80450d <strfind+0x13>
+  804529:	eb 01                	jmp    80452c <strfind+0x32>
+      break;
+  80452b:	90                   	nop
+  return (char *)s;
+  80452c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804530:	c9                   	leave
+  804531:	c3                   	ret
+
+0000000000804532 <memset>:
+memset(void *v, int c, size_t n) {
+  804532:	55                   	push   %rbp
+  804533:	48 89 e5             	mov    %rsp,%rbp
+  804536:	48 83 ec 38          	sub    $0x38,%rsp
+  80453a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80453e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804541:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804545:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804549:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80454d:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804552:	76 41                	jbe    804595 <memset+0x63>
+  804554:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  80455b:	00 00 00 
+  80455e:	ff d0                	call   *%rax
+  804560:	83 e0 01             	and    $0x1,%eax
+  804563:	85 c0                	test   %eax,%eax
+  804565:	74 2e                	je     804595 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804567:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80456a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80456e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804572:	48 89 ce             	mov    %rcx,%rsi
+  804575:	48 89 f7             	mov    %rsi,%rdi
+  804578:	48 89 d1             	mov    %rdx,%rcx
+  80457b:	fc                   	cld
+  80457c:	f3 aa                	rep stos %al,%es:(%rdi)
+  80457e:	48 89 ca             	mov    %rcx,%rdx
+  804581:	48 89 fe             	mov    %rdi,%rsi
+  804584:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804588:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80458c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804590:	e9 a7 00 00 00       	jmp    80463c <memset+0x10a>
+  if (n >= 8) {
+  804595:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80459a:	0f 86 87 00 00 00    	jbe    804627 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045a0:	eb 16                	jmp    8045b8 <memset+0x86>
+      *p++ = c;
+  8045a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045aa:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045ae:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045b1:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045b3:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045bc:	83 e0 07             	and    $0x7,%eax
+  8045bf:	48 85 c0             	test   %rax,%rax
+  8045c2:	75 de                	jne    8045a2 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045c4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045c7:	0f b6 c0             	movzbl %al,%eax
+  8045ca:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045d1:	01 01 01 
+  8045d4:	48 0f af c2          	imul   %rdx,%rax
+  8045d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045e0:	48 c1 e8 03          	shr    $0x3,%rax
+  8045e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045ec:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045f4:	48 89 ce             	mov    %rcx,%rsi
+  8045f7:	48 89 f7             	mov    %rsi,%rdi
+  8045fa:	48 89 d1             	mov    %rdx,%rcx
+  8045fd:	fc                   	cld
+  8045fe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804601:	48 89 ca             	mov    %rcx,%rdx
+  804604:	48 89 fe             	mov    %rdi,%rsi
+  804607:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80460b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80460f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804614:	eb 11                	jmp    804627 <memset+0xf5>
+    *p++ = c;
+  804616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80461a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80461e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804622:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804625:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804627:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80462b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80462f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804633:	48 85 c0             	test   %rax,%rax
+  804636:	75 de                	jne    804616 <memset+0xe4>
+  return v;
+  804638:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80463c:	c9                   	leave
+  80463d:	c3                   	ret
+
+000000000080463e <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80463e:	55                   	push   %rbp
+  80463f:	48 89 e5             	mov    %rsp,%rbp
+  804642:	48 83 ec 38          	sub    $0x38,%rsp
+  804646:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80464a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80464e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804652:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804656:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80465a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80465e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804666:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80466a:	0f 83 da 00 00 00    	jae    80474a <memmove+0x10c>
+  804670:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804674:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804678:	48 01 d0             	add    %rdx,%rax
+  80467b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80467f:	0f 83 c5 00 00 00    	jae    80474a <memmove+0x10c>
+    s += n;
+  804685:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804689:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80468d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804691:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  804695:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80469a:	0f 86 94 00 00 00    	jbe    804734 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046a0:	eb 1c                	jmp    8046be <memmove+0x80>
+        *--d = *--s;
+  8046a2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046a7:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b0:	0f b6 10             	movzbl (%rax),%edx
+  8046b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046b7:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046b9:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c2:	83 e0 07             	and    $0x7,%eax
+  8046c5:	48 85 c0             	test   %rax,%rax
+  8046c8:	75 d8                	jne    8046a2 <memmove+0x64>
+      nq = n / 8;
+  8046ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ce:	48 c1 e8 03          	shr    $0x3,%rax
+  8046d2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046d6:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046db:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046e0:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046e5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f1:	48 89 cf             	mov    %rcx,%rdi
+  8046f4:	48 89 d6             	mov    %rdx,%rsi
+  8046f7:	48 89 c1             	mov    %rax,%rcx
+  8046fa:	fd                   	std
+  8046fb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8046fe:	fc                   	cld
+  8046ff:	48 89 c8             	mov    %rcx,%rax
+  804702:	48 89 f2             	mov    %rsi,%rdx
+  804705:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804709:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80470d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804711:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804716:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80471b:	eb 17                	jmp    804734 <memmove+0xf6>
+      *--d = *--s;
+  80471d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804722:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80472b:	0f b6 10             	movzbl (%rax),%edx
+  80472e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804732:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804734:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804738:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80473c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804740:	48 85 c0             	test   %rax,%rax
+  804743:	75 d8                	jne    80471d <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804745:	e9 f4 00 00 00       	jmp    80483e <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80474a:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80474f:	76 46                	jbe    804797 <memmove+0x159>
+  804751:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  804758:	00 00 00 
+  80475b:	ff d0                	call   *%rax
+  80475d:	83 e0 01             	and    $0x1,%eax
+  804760:	85 c0                	test   %eax,%eax
+  804762:	74 33                	je     804797 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804764:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804768:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80476c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804770:	48 89 cf             	mov    %rcx,%rdi
+  804773:	48 89 d6             	mov    %rdx,%rsi
+  804776:	48 89 c1             	mov    %rax,%rcx
+  804779:	fc                   	cld
+  80477a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80477c:	48 89 c8             	mov    %rcx,%rax
+  80477f:	48 89 f2             	mov    %rsi,%rdx
+  804782:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804786:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80478a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80478e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804792:	e9 ab 00 00 00       	jmp    804842 <memmove+0x204>
+    if (n >= 8) {
+  804797:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80479c:	0f 86 8b 00 00 00    	jbe    80482d <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047a2:	eb 22                	jmp    8047c6 <memmove+0x188>
+        *d++ = *s++;
+  8047a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047a8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047b8:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047bc:	0f b6 12             	movzbl (%rdx),%edx
+  8047bf:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047c1:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047ca:	83 e0 07             	and    $0x7,%eax
+  8047cd:	48 85 c0             	test   %rax,%rax
+  8047d0:	75 d2                	jne    8047a4 <memmove+0x166>
+      nq = n / 8;
+  8047d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047d6:	48 c1 e8 03          	shr    $0x3,%rax
+  8047da:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047de:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ea:	48 89 cf             	mov    %rcx,%rdi
+  8047ed:	48 89 d6             	mov    %rdx,%rsi
+  8047f0:	48 89 c1             	mov    %rax,%rcx
+  8047f3:	fc                   	cld
+  8047f4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8047f7:	48 89 c8             	mov    %rcx,%rax
+  8047fa:	48 89 f2             	mov    %rsi,%rdx
+  8047fd:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804801:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804805:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804809:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80480e:	eb 1d                	jmp    80482d <memmove+0x1ef>
+      *d++ = *s++;
+  804810:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804814:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804818:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80481c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804820:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804824:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804828:	0f b6 12             	movzbl (%rdx),%edx
+  80482b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80482d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804831:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804835:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804839:	48 85 c0             	test   %rax,%rax
+  80483c:	75 d2                	jne    804810 <memmove+0x1d2>
+  return dst;
+  80483e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804842:	c9                   	leave
+  804843:	c3                   	ret
+
+0000000000804844 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804844:	55                   	push   %rbp
+  804845:	48 89 e5             	mov    %rsp,%rbp
+  804848:	48 83 ec 18          	sub    $0x18,%rsp
+  80484c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804850:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804854:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804858:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80485c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804864:	48 89 ce             	mov    %rcx,%rsi
+  804867:	48 89 c7             	mov    %rax,%rdi
+  80486a:	48 b8 3e 46 80 00 00 	movabs $0x80463e,%rax
+  804871:	00 00 00 
+  804874:	ff d0                	call   *%rax
+}
+  804876:	c9                   	leave
+  804877:	c3                   	ret
+
+0000000000804878 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804878:	55                   	push   %rbp
+  804879:	48 89 e5             	mov    %rsp,%rbp
+  80487c:	48 83 ec 40          	sub    $0x40,%rsp
+  804880:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804884:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804888:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80488c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804890:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804894:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804898:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80489c:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048a1:	0f 86 a7 00 00 00    	jbe    80494e <memcmp+0xd6>
+  8048a7:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  8048ae:	00 00 00 
+  8048b1:	ff d0                	call   *%rax
+  8048b3:	83 e0 02             	and    $0x2,%eax
+  8048b6:	85 c0                	test   %eax,%eax
+  8048b8:	0f 84 90 00 00 00    	je     80494e <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ca:	48 89 ce             	mov    %rcx,%rsi
+  8048cd:	48 89 c7             	mov    %rax,%rdi
+  8048d0:	48 b8 5f 3e 80 00 00 	movabs $0x803e5f,%rax
+  8048d7:	00 00 00 
+  8048da:	ff d0                	call   *%rax
+  8048dc:	e9 c2 00 00 00       	jmp    8049a3 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048e5:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048e9:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8048ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f1:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048f5:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8048f9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8048fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804900:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804907:	74 36                	je     80493f <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804909:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80490c:	f7 d0                	not    %eax
+  80490e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804912:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804915:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804918:	48 63 d0             	movslq %eax,%rdx
+  80491b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80491f:	48 01 d0             	add    %rdx,%rax
+  804922:	0f b6 00             	movzbl (%rax),%eax
+  804925:	0f b6 c0             	movzbl %al,%eax
+  804928:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80492b:	48 63 ca             	movslq %edx,%rcx
+  80492e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804932:	48 01 ca             	add    %rcx,%rdx
+  804935:	0f b6 12             	movzbl (%rdx),%edx
+  804938:	0f b6 d2             	movzbl %dl,%edx
+  80493b:	29 d0                	sub    %edx,%eax
+  80493d:	eb 64                	jmp    8049a3 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80493f:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804944:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804949:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80494e:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804953:	77 8c                	ja     8048e1 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804955:	eb 36                	jmp    80498d <memcmp+0x115>
+    if (*s1 != *s2)
+  804957:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495b:	0f b6 10             	movzbl (%rax),%edx
+  80495e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804962:	0f b6 00             	movzbl (%rax),%eax
+  804965:	38 c2                	cmp    %al,%dl
+  804967:	74 1a                	je     804983 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80496d:	0f b6 00             	movzbl (%rax),%eax
+  804970:	0f b6 c8             	movzbl %al,%ecx
+  804973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804977:	0f b6 00             	movzbl (%rax),%eax
+  80497a:	0f b6 d0             	movzbl %al,%edx
+  80497d:	89 c8                	mov    %ecx,%eax
+  80497f:	29 d0                	sub    %edx,%eax
+  804981:	eb 20                	jmp    8049a3 <memcmp+0x12b>
+    s1++, s2++;
+  804983:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804988:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80498d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804991:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804995:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804999:	48 85 c0             	test   %rax,%rax
+  80499c:	75 b9                	jne    804957 <memcmp+0xdf>
+  }
+
+  return 0;
+  80499e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049a3:	c9                   	leave
+  8049a4:	c3                   	ret
+
+00000000008049a5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049a5:	55                   	push   %rbp
+  8049a6:	48 89 e5             	mov    %rsp,%rbp
+  8049a9:	48 83 ec 50          	sub    $0x50,%rsp
+  8049ad:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049b1:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049b4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049b8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049bc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049c0:	48 01 d0             	add    %rdx,%rax
+  8049c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049c7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049ca:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049ce:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049d2:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049d6:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049db:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049df:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049e4:	76 73                	jbe    804a59 <memfind+0xb4>
+  8049e6:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  8049ed:	00 00 00 
+  8049f0:	ff d0                	call   *%rax
+  8049f2:	83 e0 02             	and    $0x2,%eax
+  8049f5:	85 c0                	test   %eax,%eax
+  8049f7:	74 60                	je     804a59 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8049f9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049fc:	0f b6 c8             	movzbl %al,%ecx
+  8049ff:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a07:	89 ce                	mov    %ecx,%esi
+  804a09:	48 89 c7             	mov    %rax,%rdi
+  804a0c:	48 b8 4e 3f 80 00 00 	movabs $0x803f4e,%rax
+  804a13:	00 00 00 
+  804a16:	ff d0                	call   *%rax
+  804a18:	eb 6c                	jmp    804a86 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a22:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a26:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a2b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a2f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a33:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a36:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a3a:	74 13                	je     804a4f <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a3c:	31 c0                	xor    %eax,%eax
+  804a3e:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a43:	48 63 d0             	movslq %eax,%rdx
+  804a46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4a:	48 01 d0             	add    %rdx,%rax
+  804a4d:	eb 37                	jmp    804a86 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a4f:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a54:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a59:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a5e:	77 ba                	ja     804a1a <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a60:	eb 13                	jmp    804a75 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a66:	0f b6 00             	movzbl (%rax),%eax
+  804a69:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a6c:	38 d0                	cmp    %dl,%al
+  804a6e:	74 11                	je     804a81 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a70:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a79:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a7d:	72 e3                	jb     804a62 <memfind+0xbd>
+  804a7f:	eb 01                	jmp    804a82 <memfind+0xdd>
+      break;
+  804a81:	90                   	nop
+  return (void *)s;
+  804a82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a86:	c9                   	leave
+  804a87:	c3                   	ret
+
+0000000000804a88 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a88:	55                   	push   %rbp
+  804a89:	48 89 e5             	mov    %rsp,%rbp
+  804a8c:	48 83 ec 38          	sub    $0x38,%rsp
+  804a90:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a94:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a98:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804a9b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804aa2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804aa9:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804aaa:	eb 05                	jmp    804ab1 <strtol+0x29>
+    s++;
+  804aac:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ab1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ab5:	0f b6 00             	movzbl (%rax),%eax
+  804ab8:	3c 20                	cmp    $0x20,%al
+  804aba:	74 f0                	je     804aac <strtol+0x24>
+  804abc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac0:	0f b6 00             	movzbl (%rax),%eax
+  804ac3:	3c 09                	cmp    $0x9,%al
+  804ac5:	74 e5                	je     804aac <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ac7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acb:	0f b6 00             	movzbl (%rax),%eax
+  804ace:	3c 2b                	cmp    $0x2b,%al
+  804ad0:	75 07                	jne    804ad9 <strtol+0x51>
+    s++;
+  804ad2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ad7:	eb 17                	jmp    804af0 <strtol+0x68>
+  else if (*s == '-')
+  804ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804add:	0f b6 00             	movzbl (%rax),%eax
+  804ae0:	3c 2d                	cmp    $0x2d,%al
+  804ae2:	75 0c                	jne    804af0 <strtol+0x68>
+    s++, neg = 1;
+  804ae4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ae9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804af0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804af4:	74 06                	je     804afc <strtol+0x74>
+  804af6:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804afa:	75 28                	jne    804b24 <strtol+0x9c>
+  804afc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b00:	0f b6 00             	movzbl (%rax),%eax
+  804b03:	3c 30                	cmp    $0x30,%al
+  804b05:	75 1d                	jne    804b24 <strtol+0x9c>
+  804b07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0b:	48 83 c0 01          	add    $0x1,%rax
+  804b0f:	0f b6 00             	movzbl (%rax),%eax
+  804b12:	3c 78                	cmp    $0x78,%al
+  804b14:	75 0e                	jne    804b24 <strtol+0x9c>
+    s += 2, base = 16;
+  804b16:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b1b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b22:	eb 2c                	jmp    804b50 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b24:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b28:	75 19                	jne    804b43 <strtol+0xbb>
+  804b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2e:	0f b6 00             	movzbl (%rax),%eax
+  804b31:	3c 30                	cmp    $0x30,%al
+  804b33:	75 0e                	jne    804b43 <strtol+0xbb>
+    s++, base = 8;
+  804b35:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b3a:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b41:	eb 0d                	jmp    804b50 <strtol+0xc8>
+  else if (base == 0)
+  804b43:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b47:	75 07                	jne    804b50 <strtol+0xc8>
+    base = 10;
+  804b49:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b54:	0f b6 00             	movzbl (%rax),%eax
+  804b57:	3c 2f                	cmp    $0x2f,%al
+  804b59:	7e 1d                	jle    804b78 <strtol+0xf0>
+  804b5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b5f:	0f b6 00             	movzbl (%rax),%eax
+  804b62:	3c 39                	cmp    $0x39,%al
+  804b64:	7f 12                	jg     804b78 <strtol+0xf0>
+      dig = *s - '0';
+  804b66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6a:	0f b6 00             	movzbl (%rax),%eax
+  804b6d:	0f be c0             	movsbl %al,%eax
+  804b70:	83 e8 30             	sub    $0x30,%eax
+  804b73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b76:	eb 4e                	jmp    804bc6 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b7c:	0f b6 00             	movzbl (%rax),%eax
+  804b7f:	3c 60                	cmp    $0x60,%al
+  804b81:	7e 1d                	jle    804ba0 <strtol+0x118>
+  804b83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b87:	0f b6 00             	movzbl (%rax),%eax
+  804b8a:	3c 7a                	cmp    $0x7a,%al
+  804b8c:	7f 12                	jg     804ba0 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804b8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b92:	0f b6 00             	movzbl (%rax),%eax
+  804b95:	0f be c0             	movsbl %al,%eax
+  804b98:	83 e8 57             	sub    $0x57,%eax
+  804b9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b9e:	eb 26                	jmp    804bc6 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804ba0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba4:	0f b6 00             	movzbl (%rax),%eax
+  804ba7:	3c 40                	cmp    $0x40,%al
+  804ba9:	7e 47                	jle    804bf2 <strtol+0x16a>
+  804bab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804baf:	0f b6 00             	movzbl (%rax),%eax
+  804bb2:	3c 5a                	cmp    $0x5a,%al
+  804bb4:	7f 3c                	jg     804bf2 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bba:	0f b6 00             	movzbl (%rax),%eax
+  804bbd:	0f be c0             	movsbl %al,%eax
+  804bc0:	83 e8 37             	sub    $0x37,%eax
+  804bc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc9:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bcc:	7d 23                	jge    804bf1 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bce:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bd3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bd6:	48 98                	cltq
+  804bd8:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bdd:	48 89 c2             	mov    %rax,%rdx
+  804be0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be3:	48 98                	cltq
+  804be5:	48 01 d0             	add    %rdx,%rax
+  804be8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804bec:	e9 5f ff ff ff       	jmp    804b50 <strtol+0xc8>
+      break;
+  804bf1:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804bf2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804bf7:	74 0b                	je     804c04 <strtol+0x17c>
+    *endptr = (char *)s;
+  804bf9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bfd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c01:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c08:	74 09                	je     804c13 <strtol+0x18b>
+  804c0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c0e:	48 f7 d8             	neg    %rax
+  804c11:	eb 04                	jmp    804c17 <strtol+0x18f>
+  804c13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c17:	c9                   	leave
+  804c18:	c3                   	ret
+
+0000000000804c19 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c19:	55                   	push   %rbp
+  804c1a:	48 89 e5             	mov    %rsp,%rbp
+  804c1d:	48 83 ec 20          	sub    $0x20,%rsp
+  804c21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c25:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c29:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c2d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c31:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c39:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c40:	48 89 c7             	mov    %rax,%rdi
+  804c43:	48 b8 51 4c 80 00 00 	movabs $0x804c51,%rax
+  804c4a:	00 00 00 
+  804c4d:	ff d0                	call   *%rax
+}
+  804c4f:	c9                   	leave
+  804c50:	c3                   	ret
+
+0000000000804c51 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c51:	55                   	push   %rbp
+  804c52:	48 89 e5             	mov    %rsp,%rbp
+  804c55:	48 83 ec 30          	sub    $0x30,%rsp
+  804c59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c5d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c61:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c65:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c69:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c6e:	75 0e                	jne    804c7e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c70:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c77:	00 00 00 
+  804c7a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c7e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c83:	75 18                	jne    804c9d <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c89:	48 89 c7             	mov    %rax,%rdi
+  804c8c:	48 b8 dc 05 80 00 00 	movabs $0x8005dc,%rax
+  804c93:	00 00 00 
+  804c96:	ff d0                	call   *%rax
+  804c98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c9b:	eb 1d                	jmp    804cba <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804c9d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ca1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca5:	48 89 d6             	mov    %rdx,%rsi
+  804ca8:	48 89 c7             	mov    %rax,%rdi
+  804cab:	48 b8 22 06 80 00 00 	movabs $0x800622,%rax
+  804cb2:	00 00 00 
+  804cb5:	ff d0                	call   *%rax
+  804cb7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cbe:	79 2a                	jns    804cea <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cc0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cc5:	74 0a                	je     804cd1 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ccb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cd1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cd6:	74 0a                	je     804ce2 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cdc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804ce2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ce5:	e9 aa 00 00 00       	jmp    804d94 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804cea:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cef:	74 36                	je     804d27 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804cf1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804cf8:	00 00 00 
+  804cfb:	8b 40 04             	mov    0x4(%rax),%eax
+  804cfe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d03:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d0a:	00 00 00 
+  804d0d:	48 98                	cltq
+  804d0f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d16:	48 01 d0             	add    %rdx,%rax
+  804d19:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d1f:	8b 10                	mov    (%rax),%edx
+  804d21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d25:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d27:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d2c:	74 36                	je     804d64 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d2e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d35:	00 00 00 
+  804d38:	8b 40 04             	mov    0x4(%rax),%eax
+  804d3b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d40:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d47:	00 00 00 
+  804d4a:	48 98                	cltq
+  804d4c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d53:	48 01 d0             	add    %rdx,%rax
+  804d56:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d5c:	8b 10                	mov    (%rax),%edx
+  804d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d62:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d64:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d6b:	00 00 00 
+  804d6e:	8b 40 04             	mov    0x4(%rax),%eax
+  804d71:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d76:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d7d:	00 00 00 
+  804d80:	48 98                	cltq
+  804d82:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d89:	48 01 d0             	add    %rdx,%rax
+  804d8c:	48 05 20 01 00 00    	add    $0x120,%rax
+  804d92:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804d94:	c9                   	leave
+  804d95:	c3                   	ret
+
+0000000000804d96 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804d96:	55                   	push   %rbp
+  804d97:	48 89 e5             	mov    %rsp,%rbp
+  804d9a:	48 83 ec 30          	sub    $0x30,%rsp
+  804d9e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804da1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804da4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804da8:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dab:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804db0:	75 5e                	jne    804e10 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804db2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804db9:	00 00 00 
+  804dbc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dc0:	eb 4e                	jmp    804e10 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dc2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dc6:	79 3c                	jns    804e04 <ipc_send+0x6e>
+  804dc8:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dcc:	74 36                	je     804e04 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dd1:	89 c1                	mov    %eax,%ecx
+  804dd3:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804dda:	00 00 00 
+  804ddd:	48 89 c2             	mov    %rax,%rdx
+  804de0:	be 54 00 00 00       	mov    $0x54,%esi
+  804de5:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804dec:	00 00 00 
+  804def:	48 89 c7             	mov    %rax,%rdi
+  804df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df7:	49 b8 2c 2f 80 00 00 	movabs $0x802f2c,%r8
+  804dfe:	00 00 00 
+  804e01:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e04:	48 b8 5f 03 80 00 00 	movabs $0x80035f,%rax
+  804e0b:	00 00 00 
+  804e0e:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e10:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e13:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e16:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e1d:	89 c7                	mov    %eax,%edi
+  804e1f:	48 b8 85 05 80 00 00 	movabs $0x800585,%rax
+  804e26:	00 00 00 
+  804e29:	ff d0                	call   *%rax
+  804e2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e32:	75 8e                	jne    804dc2 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e34:	48 b8 5f 03 80 00 00 	movabs $0x80035f,%rax
+  804e3b:	00 00 00 
+  804e3e:	ff d0                	call   *%rax
+}
+  804e40:	90                   	nop
+  804e41:	c9                   	leave
+  804e42:	c3                   	ret
+
+0000000000804e43 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e43:	55                   	push   %rbp
+  804e44:	48 89 e5             	mov    %rsp,%rbp
+  804e47:	48 83 ec 18          	sub    $0x18,%rsp
+  804e4b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e4e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e55:	eb 4d                	jmp    804ea4 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e57:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e5e:	00 00 00 
+  804e61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e64:	48 98                	cltq
+  804e66:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e6d:	48 01 d0             	add    %rdx,%rax
+  804e70:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e76:	8b 00                	mov    (%rax),%eax
+  804e78:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e7b:	75 23                	jne    804ea0 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e7d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e84:	00 00 00 
+  804e87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e8a:	48 98                	cltq
+  804e8c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e93:	48 01 d0             	add    %rdx,%rax
+  804e96:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804e9c:	8b 00                	mov    (%rax),%eax
+  804e9e:	eb 12                	jmp    804eb2 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ea0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ea4:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804eab:	7e aa                	jle    804e57 <ipc_find_env+0x14>
+  return 0;
+  804ead:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eb2:	c9                   	leave
+  804eb3:	c3                   	ret
+
+0000000000804eb4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804eb4:	55                   	push   %rbp
+  804eb5:	48 89 e5             	mov    %rsp,%rbp
+  804eb8:	48 83 ec 18          	sub    $0x18,%rsp
+  804ebc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ec0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec4:	48 c1 e8 27          	shr    $0x27,%rax
+  804ec8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ecd:	48 89 c2             	mov    %rax,%rdx
+  804ed0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ed7:	01 00 00 
+  804eda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ede:	83 e0 01             	and    $0x1,%eax
+  804ee1:	48 85 c0             	test   %rax,%rax
+  804ee4:	74 63                	je     804f49 <pageref+0x95>
+  804ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eea:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804eee:	48 89 c2             	mov    %rax,%rdx
+  804ef1:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804ef8:	01 00 00 
+  804efb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804eff:	83 e0 01             	and    $0x1,%eax
+  804f02:	48 85 c0             	test   %rax,%rax
+  804f05:	74 42                	je     804f49 <pageref+0x95>
+  804f07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0b:	48 c1 e8 15          	shr    $0x15,%rax
+  804f0f:	48 89 c2             	mov    %rax,%rdx
+  804f12:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f19:	01 00 00 
+  804f1c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f20:	83 e0 01             	and    $0x1,%eax
+  804f23:	48 85 c0             	test   %rax,%rax
+  804f26:	74 21                	je     804f49 <pageref+0x95>
+  804f28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f30:	48 89 c2             	mov    %rax,%rdx
+  804f33:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f3a:	01 00 00 
+  804f3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f41:	83 e0 01             	and    $0x1,%eax
+  804f44:	48 85 c0             	test   %rax,%rax
+  804f47:	75 07                	jne    804f50 <pageref+0x9c>
+    return 0;
+  804f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f4e:	eb 53                	jmp    804fa3 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f54:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f58:	48 89 c2             	mov    %rax,%rdx
+  804f5b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f62:	01 00 00 
+  804f65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f69:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f71:	83 e0 01             	and    $0x1,%eax
+  804f74:	48 85 c0             	test   %rax,%rax
+  804f77:	75 07                	jne    804f80 <pageref+0xcc>
+    return 0;
+  804f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7e:	eb 23                	jmp    804fa3 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f84:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f88:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804f8f:	00 00 00 
+  804f92:	48 c1 e0 04          	shl    $0x4,%rax
+  804f96:	48 01 d0             	add    %rdx,%rax
+  804f99:	48 83 c0 08          	add    $0x8,%rax
+  804f9d:	0f b7 00             	movzwl (%rax),%eax
+  804fa0:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fa3:	c9                   	leave
+  804fa4:	c3                   	ret
+  804fa5:	0f 1f 00             	nopl   (%rax)
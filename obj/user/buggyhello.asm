@@ -0,0 +1,8044 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 2e 00 00 00       	call   80005a <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// kernel should destroy user environment in response
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  sys_cputs((char *)1, 1);
+  800041:	be 01 00 00 00       	mov    $0x1,%esi
+  800046:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004b:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  800052:	00 00 00 
+  800055:	ff d0                	call   *%rax
+}
+  800057:	90                   	nop
+  800058:	c9                   	leave
+  800059:	c3                   	ret
+
+000000000080005a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005a:	55                   	push   %rbp
+  80005b:	48 89 e5             	mov    %rsp,%rbp
+  80005e:	48 83 ec 20          	sub    $0x20,%rsp
+  800062:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800065:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800069:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800070:	00 00 00 
+  800073:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800077:	eb 13                	jmp    80008c <libmain+0x32>
+    (*ctor)();
+  800079:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80007d:	48 8b 10             	mov    (%rax),%rdx
+  800080:	b8 00 00 00 00       	mov    $0x0,%eax
+  800085:	ff d2                	call   *%rdx
+    ctor++;
+  800087:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80008c:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800093:	00 00 00 
+  800096:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80009a:	72 dd                	jb     800079 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80009c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a0:	7e 14                	jle    8000b6 <libmain+0x5c>
+    binaryname = argv[0];
+  8000a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000a6:	48 8b 00             	mov    (%rax),%rax
+  8000a9:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000bd:	48 89 d6             	mov    %rdx,%rsi
+  8000c0:	89 c7                	mov    %eax,%edi
+  8000c2:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000c9:	00 00 00 
+  8000cc:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000ce:	48 b8 dd 00 80 00 00 	movabs $0x8000dd,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+#endif
+}
+  8000da:	90                   	nop
+  8000db:	c9                   	leave
+  8000dc:	c3                   	ret
+
+00000000008000dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000dd:	55                   	push   %rbp
+  8000de:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000e1:	48 b8 88 0e 80 00 00 	movabs $0x800e88,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f2:	48 b8 69 02 80 00 00 	movabs $0x800269,%rax
+  8000f9:	00 00 00 
+  8000fc:	ff d0                	call   *%rax
+}
+  8000fe:	90                   	nop
+  8000ff:	5d                   	pop    %rbp
+  800100:	c3                   	ret
+
+0000000000800101 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  800101:	55                   	push   %rbp
+  800102:	48 89 e5             	mov    %rsp,%rbp
+  800105:	53                   	push   %rbx
+  800106:	48 83 ec 48          	sub    $0x48,%rsp
+  80010a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80010e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800112:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800116:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80011a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80011e:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800122:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800126:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80012a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80012e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800132:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800136:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80013a:	4c 89 c3             	mov    %r8,%rbx
+  80013d:	cd 30                	int    $0x30
+  80013f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  800143:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800148:	74 46                	je     800190 <syscall+0x8f>
+  80014a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80014f:	7e 3f                	jle    800190 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800151:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800159:	49 89 d0             	mov    %rdx,%r8
+  80015c:	48 89 c1             	mov    %rax,%rcx
+  80015f:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  800166:	00 00 00 
+  800169:	48 89 c2             	mov    %rax,%rdx
+  80016c:	be 22 00 00 00       	mov    $0x22,%esi
+  800171:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800178:	00 00 00 
+  80017b:	48 89 c7             	mov    %rax,%rdi
+  80017e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800183:	49 b9 41 2f 80 00 00 	movabs $0x802f41,%r9
+  80018a:	00 00 00 
+  80018d:	41 ff d1             	call   *%r9
+
+  return ret;
+  800190:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800194:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800198:	c9                   	leave
+  800199:	c3                   	ret
+
+000000000080019a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80019a:	55                   	push   %rbp
+  80019b:	48 89 e5             	mov    %rsp,%rbp
+  80019e:	48 83 ec 10          	sub    $0x10,%rsp
+  8001a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8001b6:	6a 00                	push   $0x0
+  8001b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001c4:	48 89 d1             	mov    %rdx,%rcx
+  8001c7:	48 89 c2             	mov    %rax,%rdx
+  8001ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8001cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d4:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+  8001e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001e4:	90                   	nop
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+
+00000000008001e7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001e7:	55                   	push   %rbp
+  8001e8:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800202:	ba 00 00 00 00       	mov    $0x0,%edx
+  800207:	be 00 00 00 00       	mov    $0x0,%esi
+  80020c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800211:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800218:	00 00 00 
+  80021b:	ff d0                	call   *%rax
+  80021d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	48 83 ec 10          	sub    $0x10,%rsp
+  80022b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80022e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800231:	48 98                	cltq
+  800233:	48 83 ec 08          	sub    $0x8,%rsp
+  800237:	6a 00                	push   $0x0
+  800239:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80023f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80024a:	48 89 c2             	mov    %rax,%rdx
+  80024d:	be 01 00 00 00       	mov    $0x1,%esi
+  800252:	bf 03 00 00 00       	mov    $0x3,%edi
+  800257:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  80025e:	00 00 00 
+  800261:	ff d0                	call   *%rax
+  800263:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800267:	c9                   	leave
+  800268:	c3                   	ret
+
+0000000000800269 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800269:	55                   	push   %rbp
+  80026a:	48 89 e5             	mov    %rsp,%rbp
+  80026d:	48 83 ec 10          	sub    $0x10,%rsp
+  800271:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800274:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800277:	48 98                	cltq
+  800279:	48 83 ec 08          	sub    $0x8,%rsp
+  80027d:	6a 00                	push   $0x0
+  80027f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80028b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800290:	48 89 c2             	mov    %rax,%rdx
+  800293:	be 00 00 00 00       	mov    $0x0,%esi
+  800298:	bf 04 00 00 00       	mov    $0x4,%edi
+  80029d:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8002a4:	00 00 00 
+  8002a7:	ff d0                	call   *%rax
+  8002a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002ad:	90                   	nop
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+00000000008002b0 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002b0:	55                   	push   %rbp
+  8002b1:	48 89 e5             	mov    %rsp,%rbp
+  8002b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8002b8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002c2:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002c5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002ca:	cd 30                	int    $0x30
+  8002cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002d0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002d4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002d9:	7e 3d                	jle    800318 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002df:	49 89 c0             	mov    %rax,%r8
+  8002e2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002e7:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002ee:	00 00 00 
+  8002f1:	48 89 c2             	mov    %rax,%rdx
+  8002f4:	be 49 00 00 00       	mov    $0x49,%esi
+  8002f9:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800300:	00 00 00 
+  800303:	48 89 c7             	mov    %rax,%rdi
+  800306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030b:	49 b9 41 2f 80 00 00 	movabs $0x802f41,%r9
+  800312:	00 00 00 
+  800315:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800318:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80031d:	75 13                	jne    800332 <sys_env_wait+0x82>
+  80031f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800324:	74 0c                	je     800332 <sys_env_wait+0x82>
+    *status = st;
+  800326:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80032a:	89 c2                	mov    %eax,%edx
+  80032c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800330:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800336:	c9                   	leave
+  800337:	c3                   	ret
+
+0000000000800338 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80033c:	48 83 ec 08          	sub    $0x8,%rsp
+  800340:	6a 00                	push   $0x0
+  800342:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800348:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80034e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800353:	ba 00 00 00 00       	mov    $0x0,%edx
+  800358:	be 00 00 00 00       	mov    $0x0,%esi
+  80035d:	bf 02 00 00 00       	mov    $0x2,%edi
+  800362:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800369:	00 00 00 
+  80036c:	ff d0                	call   *%rax
+  80036e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800372:	c9                   	leave
+  800373:	c3                   	ret
+
+0000000000800374 <sys_yield>:
+
+void
+sys_yield(void) {
+  800374:	55                   	push   %rbp
+  800375:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800378:	48 83 ec 08          	sub    $0x8,%rsp
+  80037c:	6a 00                	push   $0x0
+  80037e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80038a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80038f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800394:	be 00 00 00 00       	mov    $0x0,%esi
+  800399:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80039e:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8003a5:	00 00 00 
+  8003a8:	ff d0                	call   *%rax
+  8003aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003ae:	90                   	nop
+  8003af:	c9                   	leave
+  8003b0:	c3                   	ret
+
+00000000008003b1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003b1:	55                   	push   %rbp
+  8003b2:	48 89 e5             	mov    %rsp,%rbp
+  8003b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8003b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003c0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003c3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003c6:	48 63 c8             	movslq %eax,%rcx
+  8003c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003d0:	48 98                	cltq
+  8003d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d6:	6a 00                	push   $0x0
+  8003d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003de:	49 89 c8             	mov    %rcx,%r8
+  8003e1:	48 89 d1             	mov    %rdx,%rcx
+  8003e4:	48 89 c2             	mov    %rax,%rdx
+  8003e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ec:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003f1:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8003f8:	00 00 00 
+  8003fb:	ff d0                	call   *%rax
+  8003fd:	48 83 c4 10          	add    $0x10,%rsp
+  800401:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  800404:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+
+0000000000800409 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800409:	55                   	push   %rbp
+  80040a:	48 89 e5             	mov    %rsp,%rbp
+  80040d:	48 83 ec 20          	sub    $0x20,%rsp
+  800411:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800414:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800418:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80041b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800423:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800426:	48 63 c8             	movslq %eax,%rcx
+  800429:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80042d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800430:	48 63 f0             	movslq %eax,%rsi
+  800433:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800437:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80043a:	48 98                	cltq
+  80043c:	48 83 ec 08          	sub    $0x8,%rsp
+  800440:	51                   	push   %rcx
+  800441:	49 89 f9             	mov    %rdi,%r9
+  800444:	49 89 f0             	mov    %rsi,%r8
+  800447:	48 89 d1             	mov    %rdx,%rcx
+  80044a:	48 89 c2             	mov    %rax,%rdx
+  80044d:	be 01 00 00 00       	mov    $0x1,%esi
+  800452:	bf 07 00 00 00       	mov    $0x7,%edi
+  800457:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  80045e:	00 00 00 
+  800461:	ff d0                	call   *%rax
+  800463:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800467:	c9                   	leave
+  800468:	c3                   	ret
+
+0000000000800469 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800469:	55                   	push   %rbp
+  80046a:	48 89 e5             	mov    %rsp,%rbp
+  80046d:	48 83 ec 10          	sub    $0x10,%rsp
+  800471:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800474:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800478:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80047c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80047f:	48 98                	cltq
+  800481:	48 83 ec 08          	sub    $0x8,%rsp
+  800485:	6a 00                	push   $0x0
+  800487:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80048d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800493:	48 89 d1             	mov    %rdx,%rcx
+  800496:	48 89 c2             	mov    %rax,%rdx
+  800499:	be 01 00 00 00       	mov    $0x1,%esi
+  80049e:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004a3:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+  8004af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004b3:	c9                   	leave
+  8004b4:	c3                   	ret
+
+00000000008004b5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004b5:	55                   	push   %rbp
+  8004b6:	48 89 e5             	mov    %rsp,%rbp
+  8004b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8004bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004c0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004c6:	48 63 d0             	movslq %eax,%rdx
+  8004c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004cc:	48 98                	cltq
+  8004ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d2:	6a 00                	push   $0x0
+  8004d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004e0:	48 89 d1             	mov    %rdx,%rcx
+  8004e3:	48 89 c2             	mov    %rax,%rdx
+  8004e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8004eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004f0:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8004f7:	00 00 00 
+  8004fa:	ff d0                	call   *%rax
+  8004fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800500:	c9                   	leave
+  800501:	c3                   	ret
+
+0000000000800502 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800502:	55                   	push   %rbp
+  800503:	48 89 e5             	mov    %rsp,%rbp
+  800506:	48 83 ec 10          	sub    $0x10,%rsp
+  80050a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80050d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800511:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800515:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800518:	48 98                	cltq
+  80051a:	48 83 ec 08          	sub    $0x8,%rsp
+  80051e:	6a 00                	push   $0x0
+  800520:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80052c:	48 89 d1             	mov    %rdx,%rcx
+  80052f:	48 89 c2             	mov    %rax,%rdx
+  800532:	be 01 00 00 00       	mov    $0x1,%esi
+  800537:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80053c:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+  800548:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80054c:	c9                   	leave
+  80054d:	c3                   	ret
+
+000000000080054e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80054e:	55                   	push   %rbp
+  80054f:	48 89 e5             	mov    %rsp,%rbp
+  800552:	48 83 ec 10          	sub    $0x10,%rsp
+  800556:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800559:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80055d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800561:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800564:	48 98                	cltq
+  800566:	48 83 ec 08          	sub    $0x8,%rsp
+  80056a:	6a 00                	push   $0x0
+  80056c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800578:	48 89 d1             	mov    %rdx,%rcx
+  80057b:	48 89 c2             	mov    %rax,%rdx
+  80057e:	be 01 00 00 00       	mov    $0x1,%esi
+  800583:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800588:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  80058f:	00 00 00 
+  800592:	ff d0                	call   *%rax
+  800594:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800598:	c9                   	leave
+  800599:	c3                   	ret
+
+000000000080059a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80059a:	55                   	push   %rbp
+  80059b:	48 89 e5             	mov    %rsp,%rbp
+  80059e:	48 83 ec 20          	sub    $0x20,%rsp
+  8005a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005ad:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005b3:	48 63 f0             	movslq %eax,%rsi
+  8005b6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005c1:	48 98                	cltq
+  8005c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c7:	6a 00                	push   $0x0
+  8005c9:	49 89 f1             	mov    %rsi,%r9
+  8005cc:	49 89 c8             	mov    %rcx,%r8
+  8005cf:	48 89 d1             	mov    %rdx,%rcx
+  8005d2:	48 89 c2             	mov    %rax,%rdx
+  8005d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8005da:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005df:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8005e6:	00 00 00 
+  8005e9:	ff d0                	call   *%rax
+  8005eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005ef:	c9                   	leave
+  8005f0:	c3                   	ret
+
+00000000008005f1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005f1:	55                   	push   %rbp
+  8005f2:	48 89 e5             	mov    %rsp,%rbp
+  8005f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8005f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800601:	48 83 ec 08          	sub    $0x8,%rsp
+  800605:	6a 00                	push   $0x0
+  800607:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80060d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800613:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800618:	48 89 c2             	mov    %rax,%rdx
+  80061b:	be 01 00 00 00       	mov    $0x1,%esi
+  800620:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800625:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  80062c:	00 00 00 
+  80062f:	ff d0                	call   *%rax
+  800631:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800635:	c9                   	leave
+  800636:	c3                   	ret
+
+0000000000800637 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800637:	55                   	push   %rbp
+  800638:	48 89 e5             	mov    %rsp,%rbp
+  80063b:	48 83 ec 10          	sub    $0x10,%rsp
+  80063f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800643:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800647:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80064b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80064f:	48 83 ec 08          	sub    $0x8,%rsp
+  800653:	6a 00                	push   $0x0
+  800655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80065b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800661:	48 89 d1             	mov    %rdx,%rcx
+  800664:	48 89 c2             	mov    %rax,%rdx
+  800667:	be 01 00 00 00       	mov    $0x1,%esi
+  80066c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800671:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800678:	00 00 00 
+  80067b:	ff d0                	call   *%rax
+  80067d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800681:	c9                   	leave
+  800682:	c3                   	ret
+
+0000000000800683 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800683:	55                   	push   %rbp
+  800684:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800687:	48 83 ec 08          	sub    $0x8,%rsp
+  80068b:	6a 00                	push   $0x0
+  80068d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800693:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a8:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006ad:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8006b4:	00 00 00 
+  8006b7:	ff d0                	call   *%rax
+  8006b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006bd:	c9                   	leave
+  8006be:	c3                   	ret
+
+00000000008006bf <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8006c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006db:	6a 00                	push   $0x0
+  8006dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006e9:	48 89 d1             	mov    %rdx,%rcx
+  8006ec:	48 89 c2             	mov    %rax,%rdx
+  8006ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8006f4:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006f9:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800700:	00 00 00 
+  800703:	ff d0                	call   *%rax
+  800705:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800709:	c9                   	leave
+  80070a:	c3                   	ret
+
+000000000080070b <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80070b:	55                   	push   %rbp
+  80070c:	48 89 e5             	mov    %rsp,%rbp
+  80070f:	48 83 ec 20          	sub    $0x20,%rsp
+  800713:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800717:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80071b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80071e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800721:	48 63 c8             	movslq %eax,%rcx
+  800724:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80072c:	48 83 ec 08          	sub    $0x8,%rsp
+  800730:	6a 00                	push   $0x0
+  800732:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800738:	49 89 c8             	mov    %rcx,%r8
+  80073b:	48 89 d1             	mov    %rdx,%rcx
+  80073e:	48 89 c2             	mov    %rax,%rdx
+  800741:	be 00 00 00 00       	mov    $0x0,%esi
+  800746:	bf 13 00 00 00       	mov    $0x13,%edi
+  80074b:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800752:	00 00 00 
+  800755:	ff d0                	call   *%rax
+  800757:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80075b:	c9                   	leave
+  80075c:	c3                   	ret
+
+000000000080075d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80075d:	55                   	push   %rbp
+  80075e:	48 89 e5             	mov    %rsp,%rbp
+  800761:	48 83 ec 20          	sub    $0x20,%rsp
+  800765:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800769:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80076c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  800770:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800774:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800777:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80077b:	48 83 ec 08          	sub    $0x8,%rsp
+  80077f:	6a 00                	push   $0x0
+  800781:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800787:	49 89 c8             	mov    %rcx,%r8
+  80078a:	48 89 d1             	mov    %rdx,%rcx
+  80078d:	48 89 c2             	mov    %rax,%rdx
+  800790:	be 00 00 00 00       	mov    $0x0,%esi
+  800795:	bf 14 00 00 00       	mov    $0x14,%edi
+  80079a:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8007a1:	00 00 00 
+  8007a4:	ff d0                	call   *%rax
+  8007a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007aa:	c9                   	leave
+  8007ab:	c3                   	ret
+
+00000000008007ac <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007ac:	55                   	push   %rbp
+  8007ad:	48 89 e5             	mov    %rsp,%rbp
+  8007b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8007b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007b8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007be:	48 63 d0             	movslq %eax,%rdx
+  8007c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8007c9:	6a 00                	push   $0x0
+  8007cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007d7:	48 89 d1             	mov    %rdx,%rcx
+  8007da:	48 89 c2             	mov    %rax,%rdx
+  8007dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8007e2:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007e7:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8007ee:	00 00 00 
+  8007f1:	ff d0                	call   *%rax
+  8007f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007f7:	c9                   	leave
+  8007f8:	c3                   	ret
+
+00000000008007f9 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007f9:	55                   	push   %rbp
+  8007fa:	48 89 e5             	mov    %rsp,%rbp
+  8007fd:	48 83 ec 20          	sub    $0x20,%rsp
+  800801:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800805:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800808:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80080b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80080f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800813:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800816:	48 63 c8             	movslq %eax,%rcx
+  800819:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80081c:	48 63 d0             	movslq %eax,%rdx
+  80081f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800823:	48 83 ec 08          	sub    $0x8,%rsp
+  800827:	6a 00                	push   $0x0
+  800829:	49 89 f1             	mov    %rsi,%r9
+  80082c:	49 89 c8             	mov    %rcx,%r8
+  80082f:	48 89 d1             	mov    %rdx,%rcx
+  800832:	48 89 c2             	mov    %rax,%rdx
+  800835:	be 00 00 00 00       	mov    $0x0,%esi
+  80083a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80083f:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800846:	00 00 00 
+  800849:	ff d0                	call   *%rax
+  80084b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80084f:	c9                   	leave
+  800850:	c3                   	ret
+
+0000000000800851 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800851:	55                   	push   %rbp
+  800852:	48 89 e5             	mov    %rsp,%rbp
+  800855:	48 83 ec 30          	sub    $0x30,%rsp
+  800859:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80085d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800861:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800865:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800869:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80086d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800871:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800875:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800879:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80087d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800881:	48 83 ec 08          	sub    $0x8,%rsp
+  800885:	51                   	push   %rcx
+  800886:	49 89 f9             	mov    %rdi,%r9
+  800889:	49 89 f0             	mov    %rsi,%r8
+  80088c:	48 89 d1             	mov    %rdx,%rcx
+  80088f:	48 89 c2             	mov    %rax,%rdx
+  800892:	be 00 00 00 00       	mov    $0x0,%esi
+  800897:	bf 17 00 00 00       	mov    $0x17,%edi
+  80089c:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8008a3:	00 00 00 
+  8008a6:	ff d0                	call   *%rax
+  8008a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008ac:	c9                   	leave
+  8008ad:	c3                   	ret
+
+00000000008008ae <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008ae:	55                   	push   %rbp
+  8008af:	48 89 e5             	mov    %rsp,%rbp
+  8008b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8008b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008bc:	48 98                	cltq
+  8008be:	48 83 ec 08          	sub    $0x8,%rsp
+  8008c2:	6a 00                	push   $0x0
+  8008c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d5:	48 89 c2             	mov    %rax,%rdx
+  8008d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8008dd:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008e2:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8008e9:	00 00 00 
+  8008ec:	ff d0                	call   *%rax
+  8008ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008f2:	90                   	nop
+  8008f3:	c9                   	leave
+  8008f4:	c3                   	ret
+
+00000000008008f5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008f5:	55                   	push   %rbp
+  8008f6:	48 89 e5             	mov    %rsp,%rbp
+  8008f9:	48 83 ec 30          	sub    $0x30,%rsp
+  8008fd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800900:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800904:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800908:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80090b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80090e:	48 63 f0             	movslq %eax,%rsi
+  800911:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800915:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800919:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80091c:	48 98                	cltq
+  80091e:	48 83 ec 08          	sub    $0x8,%rsp
+  800922:	6a 00                	push   $0x0
+  800924:	49 89 f1             	mov    %rsi,%r9
+  800927:	49 89 c8             	mov    %rcx,%r8
+  80092a:	48 89 d1             	mov    %rdx,%rcx
+  80092d:	48 89 c2             	mov    %rax,%rdx
+  800930:	be 01 00 00 00       	mov    $0x1,%esi
+  800935:	bf 19 00 00 00       	mov    $0x19,%edi
+  80093a:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800941:	00 00 00 
+  800944:	ff d0                	call   *%rax
+  800946:	48 83 c4 10          	add    $0x10,%rsp
+  80094a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80094d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800950:	c9                   	leave
+  800951:	c3                   	ret
+
+0000000000800952 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  800952:	55                   	push   %rbp
+  800953:	48 89 e5             	mov    %rsp,%rbp
+  800956:	48 83 ec 20          	sub    $0x20,%rsp
+  80095a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80095e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800962:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800965:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800968:	48 63 c8             	movslq %eax,%rcx
+  80096b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80096f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800973:	48 83 ec 08          	sub    $0x8,%rsp
+  800977:	6a 00                	push   $0x0
+  800979:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80097f:	49 89 c8             	mov    %rcx,%r8
+  800982:	48 89 d1             	mov    %rdx,%rcx
+  800985:	48 89 c2             	mov    %rax,%rdx
+  800988:	be 01 00 00 00       	mov    $0x1,%esi
+  80098d:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  800992:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800999:	00 00 00 
+  80099c:	ff d0                	call   *%rax
+  80099e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009a2:	c9                   	leave
+  8009a3:	c3                   	ret
+
+00000000008009a4 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009a4:	55                   	push   %rbp
+  8009a5:	48 89 e5             	mov    %rsp,%rbp
+  8009a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8009ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009b8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c8:	6a 00                	push   $0x0
+  8009ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009d0:	49 89 c8             	mov    %rcx,%r8
+  8009d3:	48 89 d1             	mov    %rdx,%rcx
+  8009d6:	48 89 c2             	mov    %rax,%rdx
+  8009d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8009de:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009e3:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  8009ea:	00 00 00 
+  8009ed:	ff d0                	call   *%rax
+  8009ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009f3:	c9                   	leave
+  8009f4:	c3                   	ret
+
+00000000008009f5 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009f5:	55                   	push   %rbp
+  8009f6:	48 89 e5             	mov    %rsp,%rbp
+  8009f9:	48 83 ec 30          	sub    $0x30,%rsp
+  8009fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a01:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a05:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a08:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a0c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a10:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a13:	48 63 c8             	movslq %eax,%rcx
+  800a16:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a22:	6a 00                	push   $0x0
+  800a24:	49 89 f1             	mov    %rsi,%r9
+  800a27:	49 89 c8             	mov    %rcx,%r8
+  800a2a:	48 89 d1             	mov    %rdx,%rcx
+  800a2d:	48 89 c2             	mov    %rax,%rdx
+  800a30:	be 01 00 00 00       	mov    $0x1,%esi
+  800a35:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a3a:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800a41:	00 00 00 
+  800a44:	ff d0                	call   *%rax
+  800a46:	48 83 c4 10          	add    $0x10,%rsp
+  800a4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+
+0000000000800a52 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a52:	55                   	push   %rbp
+  800a53:	48 89 e5             	mov    %rsp,%rbp
+  800a56:	48 83 ec 10          	sub    $0x10,%rsp
+  800a5a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a60:	48 98                	cltq
+  800a62:	48 83 ec 08          	sub    $0x8,%rsp
+  800a66:	6a 00                	push   $0x0
+  800a68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a79:	48 89 c2             	mov    %rax,%rdx
+  800a7c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a81:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a86:	48 b8 01 01 80 00 00 	movabs $0x800101,%rax
+  800a8d:	00 00 00 
+  800a90:	ff d0                	call   *%rax
+  800a92:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a96:	c9                   	leave
+  800a97:	c3                   	ret
+
+0000000000800a98 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a98:	55                   	push   %rbp
+  800a99:	48 89 e5             	mov    %rsp,%rbp
+  800a9c:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800aa4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa8:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800aaf:	ff ff ff 
+  800ab2:	48 01 d0             	add    %rdx,%rax
+  800ab5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ab9:	c9                   	leave
+  800aba:	c3                   	ret
+
+0000000000800abb <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800abb:	55                   	push   %rbp
+  800abc:	48 89 e5             	mov    %rsp,%rbp
+  800abf:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800acb:	48 89 c7             	mov    %rax,%rdi
+  800ace:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  800ad5:	00 00 00 
+  800ad8:	ff d0                	call   *%rax
+  800ada:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800ae0:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800ae4:	c9                   	leave
+  800ae5:	c3                   	ret
+
+0000000000800ae6 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800ae6:	55                   	push   %rbp
+  800ae7:	48 89 e5             	mov    %rsp,%rbp
+  800aea:	48 83 ec 18          	sub    $0x18,%rsp
+  800aee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800af2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800af9:	e9 ae 00 00 00       	jmp    800bac <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800afe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b01:	c1 e0 0c             	shl    $0xc,%eax
+  800b04:	48 98                	cltq
+  800b06:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b0b:	48 01 d0             	add    %rdx,%rax
+  800b0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b16:	48 c1 e8 27          	shr    $0x27,%rax
+  800b1a:	48 89 c2             	mov    %rax,%rdx
+  800b1d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b24:	01 00 00 
+  800b27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b2b:	83 e0 01             	and    $0x1,%eax
+  800b2e:	48 85 c0             	test   %rax,%rax
+  800b31:	74 63                	je     800b96 <fd_alloc+0xb0>
+  800b33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b37:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b3b:	48 89 c2             	mov    %rax,%rdx
+  800b3e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b45:	01 00 00 
+  800b48:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b4c:	83 e0 01             	and    $0x1,%eax
+  800b4f:	48 85 c0             	test   %rax,%rax
+  800b52:	74 42                	je     800b96 <fd_alloc+0xb0>
+  800b54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b58:	48 c1 e8 15          	shr    $0x15,%rax
+  800b5c:	48 89 c2             	mov    %rax,%rdx
+  800b5f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b66:	01 00 00 
+  800b69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b6d:	83 e0 01             	and    $0x1,%eax
+  800b70:	48 85 c0             	test   %rax,%rax
+  800b73:	74 21                	je     800b96 <fd_alloc+0xb0>
+  800b75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b79:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b7d:	48 89 c2             	mov    %rax,%rdx
+  800b80:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b87:	01 00 00 
+  800b8a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b8e:	83 e0 01             	and    $0x1,%eax
+  800b91:	48 85 c0             	test   %rax,%rax
+  800b94:	75 12                	jne    800ba8 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b9e:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba6:	eb 1e                	jmp    800bc6 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800ba8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800bac:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800bb0:	0f 8e 48 ff ff ff    	jle    800afe <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bba:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bc1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bc6:	c9                   	leave
+  800bc7:	c3                   	ret
+
+0000000000800bc8 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bc8:	55                   	push   %rbp
+  800bc9:	48 89 e5             	mov    %rsp,%rbp
+  800bcc:	48 83 ec 20          	sub    $0x20,%rsp
+  800bd0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bd3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bd7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bdb:	78 06                	js     800be3 <fd_lookup+0x1b>
+  800bdd:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800be1:	7e 0a                	jle    800bed <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800be3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800be8:	e9 af 00 00 00       	jmp    800c9c <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bf0:	c1 e0 0c             	shl    $0xc,%eax
+  800bf3:	48 98                	cltq
+  800bf5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800bfa:	48 01 d0             	add    %rdx,%rax
+  800bfd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c05:	48 c1 e8 27          	shr    $0x27,%rax
+  800c09:	48 89 c2             	mov    %rax,%rdx
+  800c0c:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c13:	01 00 00 
+  800c16:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c1a:	83 e0 01             	and    $0x1,%eax
+  800c1d:	48 85 c0             	test   %rax,%rax
+  800c20:	74 63                	je     800c85 <fd_lookup+0xbd>
+  800c22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c26:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c2a:	48 89 c2             	mov    %rax,%rdx
+  800c2d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c34:	01 00 00 
+  800c37:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c3b:	83 e0 01             	and    $0x1,%eax
+  800c3e:	48 85 c0             	test   %rax,%rax
+  800c41:	74 42                	je     800c85 <fd_lookup+0xbd>
+  800c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c47:	48 c1 e8 15          	shr    $0x15,%rax
+  800c4b:	48 89 c2             	mov    %rax,%rdx
+  800c4e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c55:	01 00 00 
+  800c58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c5c:	83 e0 01             	and    $0x1,%eax
+  800c5f:	48 85 c0             	test   %rax,%rax
+  800c62:	74 21                	je     800c85 <fd_lookup+0xbd>
+  800c64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c68:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c6c:	48 89 c2             	mov    %rax,%rdx
+  800c6f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c76:	01 00 00 
+  800c79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c7d:	83 e0 01             	and    $0x1,%eax
+  800c80:	48 85 c0             	test   %rax,%rax
+  800c83:	75 07                	jne    800c8c <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c8a:	eb 10                	jmp    800c9c <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c94:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9c:	c9                   	leave
+  800c9d:	c3                   	ret
+
+0000000000800c9e <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c9e:	55                   	push   %rbp
+  800c9f:	48 89 e5             	mov    %rsp,%rbp
+  800ca2:	48 83 ec 30          	sub    $0x30,%rsp
+  800ca6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800caa:	89 f0                	mov    %esi,%eax
+  800cac:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800caf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cb3:	48 89 c7             	mov    %rax,%rdi
+  800cb6:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  800cbd:	00 00 00 
+  800cc0:	ff d0                	call   *%rax
+  800cc2:	89 c2                	mov    %eax,%edx
+  800cc4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cc8:	48 89 c6             	mov    %rax,%rsi
+  800ccb:	89 d7                	mov    %edx,%edi
+  800ccd:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  800cd4:	00 00 00 
+  800cd7:	ff d0                	call   *%rax
+  800cd9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800cdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ce0:	78 0a                	js     800cec <fd_close+0x4e>
+  800ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ce6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cea:	74 12                	je     800cfe <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cec:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cf0:	74 05                	je     800cf7 <fd_close+0x59>
+  800cf2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800cf5:	eb 70                	jmp    800d67 <fd_close+0xc9>
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	eb 69                	jmp    800d67 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d02:	8b 00                	mov    (%rax),%eax
+  800d04:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d08:	48 89 d6             	mov    %rdx,%rsi
+  800d0b:	89 c7                	mov    %eax,%edi
+  800d0d:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800d14:	00 00 00 
+  800d17:	ff d0                	call   *%rax
+  800d19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d20:	78 2a                	js     800d4c <fd_close+0xae>
+    if (dev->dev_close)
+  800d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d26:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d2a:	48 85 c0             	test   %rax,%rax
+  800d2d:	74 16                	je     800d45 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d33:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d3b:	48 89 c7             	mov    %rax,%rdi
+  800d3e:	ff d2                	call   *%rdx
+  800d40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d43:	eb 07                	jmp    800d4c <fd_close+0xae>
+    else
+      r = 0;
+  800d45:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d50:	48 89 c6             	mov    %rax,%rsi
+  800d53:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d58:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+  return r;
+  800d64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+0000000000800d69 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+  800d6d:	48 83 ec 20          	sub    $0x20,%rsp
+  800d71:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d74:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d78:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d7f:	eb 3f                	jmp    800dc0 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d81:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d88:	00 00 00 
+  800d8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d8e:	48 98                	cltq
+  800d90:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d94:	8b 00                	mov    (%rax),%eax
+  800d96:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d99:	75 21                	jne    800dbc <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d9b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800da2:	00 00 00 
+  800da5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800da8:	48 98                	cltq
+  800daa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800dae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800db2:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dba:	eb 7f                	jmp    800e3b <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800dbc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dc0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dc7:	00 00 00 
+  800dca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dcd:	48 98                	cltq
+  800dcf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dd3:	48 85 c0             	test   %rax,%rax
+  800dd6:	75 a9                	jne    800d81 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dd8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800ddf:	00 00 00 
+  800de2:	8b 40 04             	mov    0x4(%rax),%eax
+  800de5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800df1:	00 00 00 
+  800df4:	48 98                	cltq
+  800df6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800dfd:	48 01 d0             	add    %rdx,%rax
+  800e00:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e06:	8b 00                	mov    (%rax),%eax
+  800e08:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e0b:	89 c6                	mov    %eax,%esi
+  800e0d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800e14:	00 00 00 
+  800e17:	48 89 c7             	mov    %rax,%rdi
+  800e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1f:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  800e26:	00 00 00 
+  800e29:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e2f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e3b:	c9                   	leave
+  800e3c:	c3                   	ret
+
+0000000000800e3d <close>:
+
+int
+close(int fdnum) {
+  800e3d:	55                   	push   %rbp
+  800e3e:	48 89 e5             	mov    %rsp,%rbp
+  800e41:	48 83 ec 20          	sub    $0x20,%rsp
+  800e45:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e48:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e4f:	48 89 d6             	mov    %rdx,%rsi
+  800e52:	89 c7                	mov    %eax,%edi
+  800e54:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  800e5b:	00 00 00 
+  800e5e:	ff d0                	call   *%rax
+  800e60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e67:	79 05                	jns    800e6e <close+0x31>
+    return r;
+  800e69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e6c:	eb 18                	jmp    800e86 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e72:	be 01 00 00 00       	mov    $0x1,%esi
+  800e77:	48 89 c7             	mov    %rax,%rdi
+  800e7a:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+}
+  800e86:	c9                   	leave
+  800e87:	c3                   	ret
+
+0000000000800e88 <close_all>:
+
+void
+close_all(void) {
+  800e88:	55                   	push   %rbp
+  800e89:	48 89 e5             	mov    %rsp,%rbp
+  800e8c:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e90:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e97:	eb 15                	jmp    800eae <close_all+0x26>
+    close(i);
+  800e99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e9c:	89 c7                	mov    %eax,%edi
+  800e9e:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  800ea5:	00 00 00 
+  800ea8:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800eaa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800eae:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800eb2:	7e e5                	jle    800e99 <close_all+0x11>
+}
+  800eb4:	90                   	nop
+  800eb5:	90                   	nop
+  800eb6:	c9                   	leave
+  800eb7:	c3                   	ret
+
+0000000000800eb8 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800eb8:	55                   	push   %rbp
+  800eb9:	48 89 e5             	mov    %rsp,%rbp
+  800ebc:	48 83 ec 40          	sub    $0x40,%rsp
+  800ec0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ec3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ec6:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800eca:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ecd:	48 89 d6             	mov    %rdx,%rsi
+  800ed0:	89 c7                	mov    %eax,%edi
+  800ed2:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  800ed9:	00 00 00 
+  800edc:	ff d0                	call   *%rax
+  800ede:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ee1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ee5:	79 08                	jns    800eef <dup+0x37>
+    return r;
+  800ee7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800eea:	e9 33 02 00 00       	jmp    801122 <dup+0x26a>
+  close(newfdnum);
+  800eef:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ef2:	89 c7                	mov    %eax,%edi
+  800ef4:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  800efb:	00 00 00 
+  800efe:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f00:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f03:	c1 e0 0c             	shl    $0xc,%eax
+  800f06:	48 98                	cltq
+  800f08:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f0d:	48 01 d0             	add    %rdx,%rax
+  800f10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f18:	48 89 c7             	mov    %rax,%rdi
+  800f1b:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  800f22:	00 00 00 
+  800f25:	ff d0                	call   *%rax
+  800f27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f2f:	48 89 c7             	mov    %rax,%rdi
+  800f32:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  800f39:	00 00 00 
+  800f3c:	ff d0                	call   *%rax
+  800f3e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f42:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f49:	00 
+  800f4a:	e9 19 01 00 00       	jmp    801068 <dup+0x1b0>
+    off -= PGSIZE;
+  800f4f:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f56:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f57:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f5f:	48 01 d0             	add    %rdx,%rax
+  800f62:	48 c1 e8 27          	shr    $0x27,%rax
+  800f66:	48 89 c2             	mov    %rax,%rdx
+  800f69:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f70:	01 00 00 
+  800f73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f77:	83 e0 01             	and    $0x1,%eax
+  800f7a:	48 85 c0             	test   %rax,%rax
+  800f7d:	0f 84 e5 00 00 00    	je     801068 <dup+0x1b0>
+  800f83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f8b:	48 01 d0             	add    %rdx,%rax
+  800f8e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f92:	48 89 c2             	mov    %rax,%rdx
+  800f95:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f9c:	01 00 00 
+  800f9f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fa3:	83 e0 01             	and    $0x1,%eax
+  800fa6:	48 85 c0             	test   %rax,%rax
+  800fa9:	0f 84 b9 00 00 00    	je     801068 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800faf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb7:	48 01 d0             	add    %rdx,%rax
+  800fba:	48 c1 e8 15          	shr    $0x15,%rax
+  800fbe:	48 89 c2             	mov    %rax,%rdx
+  800fc1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fc8:	01 00 00 
+  800fcb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fcf:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fd2:	48 85 c0             	test   %rax,%rax
+  800fd5:	0f 84 8d 00 00 00    	je     801068 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fdb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe3:	48 01 d0             	add    %rdx,%rax
+  800fe6:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fea:	48 89 c2             	mov    %rax,%rdx
+  800fed:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800ff4:	01 00 00 
+  800ff7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ffb:	83 e0 01             	and    $0x1,%eax
+  800ffe:	48 85 c0             	test   %rax,%rax
+  801001:	74 65                	je     801068 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801003:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801007:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80100b:	48 01 d0             	add    %rdx,%rax
+  80100e:	48 c1 e8 0c          	shr    $0xc,%rax
+  801012:	48 89 c2             	mov    %rax,%rdx
+  801015:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80101c:	01 00 00 
+  80101f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801023:	25 07 0e 00 00       	and    $0xe07,%eax
+  801028:	89 c6                	mov    %eax,%esi
+  80102a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80102e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801032:	48 01 c2             	add    %rax,%rdx
+  801035:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801039:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103d:	48 01 c8             	add    %rcx,%rax
+  801040:	41 89 f0             	mov    %esi,%r8d
+  801043:	48 89 d1             	mov    %rdx,%rcx
+  801046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104b:	48 89 c6             	mov    %rax,%rsi
+  80104e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801053:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  80105a:	00 00 00 
+  80105d:	ff d0                	call   *%rax
+  80105f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801062:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801066:	78 60                	js     8010c8 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801068:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80106d:	0f 85 dc fe ff ff    	jne    800f4f <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801073:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801077:	48 c1 e8 0c          	shr    $0xc,%rax
+  80107b:	48 89 c2             	mov    %rax,%rdx
+  80107e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801085:	01 00 00 
+  801088:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80108c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801091:	89 c1                	mov    %eax,%ecx
+  801093:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801097:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80109b:	41 89 c8             	mov    %ecx,%r8d
+  80109e:	48 89 d1             	mov    %rdx,%rcx
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	48 89 c6             	mov    %rax,%rsi
+  8010a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ae:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+  8010ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010c1:	78 08                	js     8010cb <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010c3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010c6:	eb 5a                	jmp    801122 <dup+0x26a>
+        goto err;
+  8010c8:	90                   	nop
+  8010c9:	eb 01                	jmp    8010cc <dup+0x214>
+    goto err;
+  8010cb:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010d0:	48 89 c6             	mov    %rax,%rsi
+  8010d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d8:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8010df:	00 00 00 
+  8010e2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010e4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010eb:	00 
+  8010ec:	eb 27                	jmp    801115 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010ee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010f6:	48 01 d0             	add    %rdx,%rax
+  8010f9:	48 89 c6             	mov    %rax,%rsi
+  8010fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801101:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80110d:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801114:	00 
+  801115:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80111c:	00 
+  80111d:	76 cf                	jbe    8010ee <dup+0x236>
+  return r;
+  80111f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801122:	c9                   	leave
+  801123:	c3                   	ret
+
+0000000000801124 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801124:	55                   	push   %rbp
+  801125:	48 89 e5             	mov    %rsp,%rbp
+  801128:	48 83 ec 40          	sub    $0x40,%rsp
+  80112c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80112f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801133:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801137:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80113b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80113e:	48 89 d6             	mov    %rdx,%rsi
+  801141:	89 c7                	mov    %eax,%edi
+  801143:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+  80114f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801152:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801156:	78 24                	js     80117c <read+0x58>
+  801158:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80115c:	8b 00                	mov    (%rax),%eax
+  80115e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801162:	48 89 d6             	mov    %rdx,%rsi
+  801165:	89 c7                	mov    %eax,%edi
+  801167:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  80116e:	00 00 00 
+  801171:	ff d0                	call   *%rax
+  801173:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801176:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80117a:	79 0a                	jns    801186 <read+0x62>
+    return r;
+  80117c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80117f:	48 98                	cltq
+  801181:	e9 9e 00 00 00       	jmp    801224 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801186:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80118a:	8b 40 08             	mov    0x8(%rax),%eax
+  80118d:	83 e0 03             	and    $0x3,%eax
+  801190:	83 f8 01             	cmp    $0x1,%eax
+  801193:	75 5c                	jne    8011f1 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801195:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80119c:	00 00 00 
+  80119f:	8b 40 04             	mov    0x4(%rax),%eax
+  8011a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011a7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011ae:	00 00 00 
+  8011b1:	48 98                	cltq
+  8011b3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011ba:	48 01 d0             	add    %rdx,%rax
+  8011bd:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011c3:	8b 00                	mov    (%rax),%eax
+  8011c5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011c8:	89 c6                	mov    %eax,%esi
+  8011ca:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011d1:	00 00 00 
+  8011d4:	48 89 c7             	mov    %rax,%rdi
+  8011d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011dc:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  8011e3:	00 00 00 
+  8011e6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011ef:	eb 33                	jmp    801224 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011f5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011f9:	48 85 c0             	test   %rax,%rax
+  8011fc:	75 09                	jne    801207 <read+0xe3>
+    return -E_NOT_SUPP;
+  8011fe:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801205:	eb 1d                	jmp    801224 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801207:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80120b:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80120f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801213:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801217:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80121b:	48 89 ce             	mov    %rcx,%rsi
+  80121e:	48 89 c7             	mov    %rax,%rdi
+  801221:	41 ff d0             	call   *%r8
+}
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+0000000000801226 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	48 83 ec 30          	sub    $0x30,%rsp
+  80122e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801231:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801235:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801239:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801240:	eb 49                	jmp    80128b <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  801242:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801245:	48 98                	cltq
+  801247:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80124b:	48 29 c2             	sub    %rax,%rdx
+  80124e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801251:	48 63 c8             	movslq %eax,%rcx
+  801254:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801258:	48 01 c1             	add    %rax,%rcx
+  80125b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80125e:	48 89 ce             	mov    %rcx,%rsi
+  801261:	89 c7                	mov    %eax,%edi
+  801263:	48 b8 24 11 80 00 00 	movabs $0x801124,%rax
+  80126a:	00 00 00 
+  80126d:	ff d0                	call   *%rax
+  80126f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  801272:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801276:	79 07                	jns    80127f <readn+0x59>
+      return m;
+  801278:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80127b:	48 98                	cltq
+  80127d:	eb 1f                	jmp    80129e <readn+0x78>
+    if (m == 0)
+  80127f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801283:	74 13                	je     801298 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801285:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801288:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80128b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80128e:	48 98                	cltq
+  801290:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801294:	72 ac                	jb     801242 <readn+0x1c>
+  801296:	eb 01                	jmp    801299 <readn+0x73>
+      break;
+  801298:	90                   	nop
+  }
+  return tot;
+  801299:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80129c:	48 98                	cltq
+}
+  80129e:	c9                   	leave
+  80129f:	c3                   	ret
+
+00000000008012a0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012a0:	55                   	push   %rbp
+  8012a1:	48 89 e5             	mov    %rsp,%rbp
+  8012a4:	48 83 ec 40          	sub    $0x40,%rsp
+  8012a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012ab:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012b3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012ba:	48 89 d6             	mov    %rdx,%rsi
+  8012bd:	89 c7                	mov    %eax,%edi
+  8012bf:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  8012c6:	00 00 00 
+  8012c9:	ff d0                	call   *%rax
+  8012cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012d2:	78 24                	js     8012f8 <write+0x58>
+  8012d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d8:	8b 00                	mov    (%rax),%eax
+  8012da:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012de:	48 89 d6             	mov    %rdx,%rsi
+  8012e1:	89 c7                	mov    %eax,%edi
+  8012e3:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8012ea:	00 00 00 
+  8012ed:	ff d0                	call   *%rax
+  8012ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012f6:	79 0a                	jns    801302 <write+0x62>
+    return r;
+  8012f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012fb:	48 98                	cltq
+  8012fd:	e9 9d 00 00 00       	jmp    80139f <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801306:	8b 40 08             	mov    0x8(%rax),%eax
+  801309:	83 e0 03             	and    $0x3,%eax
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	75 5c                	jne    80136c <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801310:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801317:	00 00 00 
+  80131a:	8b 40 04             	mov    0x4(%rax),%eax
+  80131d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801322:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801329:	00 00 00 
+  80132c:	48 98                	cltq
+  80132e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801335:	48 01 d0             	add    %rdx,%rax
+  801338:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80133e:	8b 00                	mov    (%rax),%eax
+  801340:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801343:	89 c6                	mov    %eax,%esi
+  801345:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  80134c:	00 00 00 
+  80134f:	48 89 c7             	mov    %rax,%rdi
+  801352:	b8 00 00 00 00       	mov    $0x0,%eax
+  801357:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  80135e:	00 00 00 
+  801361:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801363:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80136a:	eb 33                	jmp    80139f <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80136c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801370:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801374:	48 85 c0             	test   %rax,%rax
+  801377:	75 09                	jne    801382 <write+0xe2>
+    return -E_NOT_SUPP;
+  801379:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801380:	eb 1d                	jmp    80139f <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  801382:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801386:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80138a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80138e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801392:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801396:	48 89 ce             	mov    %rcx,%rsi
+  801399:	48 89 c7             	mov    %rax,%rdi
+  80139c:	41 ff d0             	call   *%r8
+}
+  80139f:	c9                   	leave
+  8013a0:	c3                   	ret
+
+00000000008013a1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013a1:	55                   	push   %rbp
+  8013a2:	48 89 e5             	mov    %rsp,%rbp
+  8013a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8013a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013ac:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013af:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013b6:	48 89 d6             	mov    %rdx,%rsi
+  8013b9:	89 c7                	mov    %eax,%edi
+  8013bb:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  8013c2:	00 00 00 
+  8013c5:	ff d0                	call   *%rax
+  8013c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013ce:	79 05                	jns    8013d5 <seek+0x34>
+    return r;
+  8013d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013d3:	eb 0f                	jmp    8013e4 <seek+0x43>
+  fd->fd_offset = offset;
+  8013d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013dc:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e4:	c9                   	leave
+  8013e5:	c3                   	ret
+
+00000000008013e6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013e6:	55                   	push   %rbp
+  8013e7:	48 89 e5             	mov    %rsp,%rbp
+  8013ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8013ee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013f1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013f4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013fb:	48 89 d6             	mov    %rdx,%rsi
+  8013fe:	89 c7                	mov    %eax,%edi
+  801400:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  801407:	00 00 00 
+  80140a:	ff d0                	call   *%rax
+  80140c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80140f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801413:	78 24                	js     801439 <ftruncate+0x53>
+  801415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801419:	8b 00                	mov    (%rax),%eax
+  80141b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80141f:	48 89 d6             	mov    %rdx,%rsi
+  801422:	89 c7                	mov    %eax,%edi
+  801424:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  80142b:	00 00 00 
+  80142e:	ff d0                	call   *%rax
+  801430:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801433:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801437:	79 08                	jns    801441 <ftruncate+0x5b>
+    return r;
+  801439:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80143c:	e9 92 00 00 00       	jmp    8014d3 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801441:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801445:	8b 40 08             	mov    0x8(%rax),%eax
+  801448:	83 e0 03             	and    $0x3,%eax
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	75 5a                	jne    8014a9 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80144f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801456:	00 00 00 
+  801459:	8b 40 04             	mov    0x4(%rax),%eax
+  80145c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801461:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801468:	00 00 00 
+  80146b:	48 98                	cltq
+  80146d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801474:	48 01 d0             	add    %rdx,%rax
+  801477:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80147d:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80147f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801482:	89 c6                	mov    %eax,%esi
+  801484:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  80148b:	00 00 00 
+  80148e:	48 89 c7             	mov    %rax,%rdi
+  801491:	b8 00 00 00 00       	mov    $0x0,%eax
+  801496:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  80149d:	00 00 00 
+  8014a0:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a7:	eb 2a                	jmp    8014d3 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ad:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014b1:	48 85 c0             	test   %rax,%rax
+  8014b4:	75 07                	jne    8014bd <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014b6:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014bb:	eb 16                	jmp    8014d3 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c1:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014cc:	89 d6                	mov    %edx,%esi
+  8014ce:	48 89 c7             	mov    %rax,%rdi
+  8014d1:	ff d1                	call   *%rcx
+}
+  8014d3:	c9                   	leave
+  8014d4:	c3                   	ret
+
+00000000008014d5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014d5:	55                   	push   %rbp
+  8014d6:	48 89 e5             	mov    %rsp,%rbp
+  8014d9:	48 83 ec 30          	sub    $0x30,%rsp
+  8014dd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014e0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014eb:	48 89 d6             	mov    %rdx,%rsi
+  8014ee:	89 c7                	mov    %eax,%edi
+  8014f0:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  8014f7:	00 00 00 
+  8014fa:	ff d0                	call   *%rax
+  8014fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801503:	78 24                	js     801529 <fstat+0x54>
+  801505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801509:	8b 00                	mov    (%rax),%eax
+  80150b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80150f:	48 89 d6             	mov    %rdx,%rsi
+  801512:	89 c7                	mov    %eax,%edi
+  801514:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+  801520:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801523:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801527:	79 05                	jns    80152e <fstat+0x59>
+    return r;
+  801529:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80152c:	eb 5e                	jmp    80158c <fstat+0xb7>
+  if (!dev->dev_stat)
+  80152e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801532:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801536:	48 85 c0             	test   %rax,%rax
+  801539:	75 07                	jne    801542 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80153b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801540:	eb 4a                	jmp    80158c <fstat+0xb7>
+  stat->st_name[0] = 0;
+  801542:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801546:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801549:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80154d:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801554:	00 00 00 
+  stat->st_isdir   = 0;
+  801557:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80155b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  801562:	00 00 00 
+  stat->st_dev     = dev;
+  801565:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801569:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80156d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  801574:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801578:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80157c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801580:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801584:	48 89 d6             	mov    %rdx,%rsi
+  801587:	48 89 c7             	mov    %rax,%rdi
+  80158a:	ff d1                	call   *%rcx
+}
+  80158c:	c9                   	leave
+  80158d:	c3                   	ret
+
+000000000080158e <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+  801592:	48 83 ec 10          	sub    $0x10,%rsp
+  801596:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80159a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80159e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a2:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015a8:	83 f8 20             	cmp    $0x20,%eax
+  8015ab:	75 07                	jne    8015b4 <pollwait_key+0x26>
+    return -E_INVAL;
+  8015ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b2:	eb 5f                	jmp    801613 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b8:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c2:	48 63 d2             	movslq %edx,%rdx
+  8015c5:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015c9:	48 01 c2             	add    %rax,%rdx
+  8015cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d0:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d7:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e1:	8b 00                	mov    (%rax),%eax
+  8015e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015e7:	48 63 c9             	movslq %ecx,%rcx
+  8015ea:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015ee:	48 01 ca             	add    %rcx,%rdx
+  8015f1:	48 83 c2 08          	add    $0x8,%rdx
+  8015f5:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fb:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801601:	8d 50 01             	lea    0x1(%rax),%edx
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801608:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+
+0000000000801615 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801615:	55                   	push   %rbp
+  801616:	48 89 e5             	mov    %rsp,%rbp
+  801619:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801620:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801627:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80162d:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801634:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80163b:	00 
+  int i, r, ready, ipc = 0;
+  80163c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  801643:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80164a:	00 
+  80164b:	74 45                	je     801692 <poll+0x7d>
+  80164d:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801654:	ff 
+  801655:	74 3b                	je     801692 <poll+0x7d>
+    now      = vsys_clock_ns();
+  801657:	48 b8 50 2b 80 00 00 	movabs $0x802b50,%rax
+  80165e:	00 00 00 
+  801661:	ff d0                	call   *%rax
+  801663:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801667:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80166b:	48 f7 d0             	not    %rax
+  80166e:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801675:	73 10                	jae    801687 <poll+0x72>
+  801677:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80167b:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  801682:	48 01 d0             	add    %rdx,%rax
+  801685:	eb 07                	jmp    80168e <poll+0x79>
+  801687:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80168e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  801692:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801699:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016a0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016ae:	e9 46 02 00 00       	jmp    8018f9 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016b6:	48 63 d0             	movslq %eax,%rdx
+  8016b9:	48 89 d0             	mov    %rdx,%rax
+  8016bc:	48 01 c0             	add    %rax,%rax
+  8016bf:	48 01 d0             	add    %rdx,%rax
+  8016c2:	48 c1 e0 02          	shl    $0x2,%rax
+  8016c6:	48 89 c2             	mov    %rax,%rdx
+  8016c9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016d0:	48 01 d0             	add    %rdx,%rax
+  8016d3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016da:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016dd:	48 63 d0             	movslq %eax,%rdx
+  8016e0:	48 89 d0             	mov    %rdx,%rax
+  8016e3:	48 01 c0             	add    %rax,%rax
+  8016e6:	48 01 d0             	add    %rdx,%rax
+  8016e9:	48 c1 e0 02          	shl    $0x2,%rax
+  8016ed:	48 89 c2             	mov    %rax,%rdx
+  8016f0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016f7:	48 01 d0             	add    %rdx,%rax
+  8016fa:	8b 00                	mov    (%rax),%eax
+  8016fc:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016ff:	75 62                	jne    801763 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  801701:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801704:	48 63 d0             	movslq %eax,%rdx
+  801707:	48 89 d0             	mov    %rdx,%rax
+  80170a:	48 01 c0             	add    %rax,%rax
+  80170d:	48 01 d0             	add    %rdx,%rax
+  801710:	48 c1 e0 02          	shl    $0x2,%rax
+  801714:	48 89 c2             	mov    %rax,%rdx
+  801717:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80171e:	48 01 d0             	add    %rdx,%rax
+  801721:	8b 40 04             	mov    0x4(%rax),%eax
+  801724:	83 e0 01             	and    $0x1,%eax
+  801727:	85 c0                	test   %eax,%eax
+  801729:	0f 84 9b 01 00 00    	je     8018ca <poll+0x2b5>
+          fds[i].revents = ipc;
+  80172f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801732:	48 63 d0             	movslq %eax,%rdx
+  801735:	48 89 d0             	mov    %rdx,%rax
+  801738:	48 01 c0             	add    %rax,%rax
+  80173b:	48 01 d0             	add    %rdx,%rax
+  80173e:	48 c1 e0 02          	shl    $0x2,%rax
+  801742:	48 89 c2             	mov    %rax,%rdx
+  801745:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80174c:	48 01 c2             	add    %rax,%rdx
+  80174f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801752:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801755:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801758:	83 c8 04             	or     $0x4,%eax
+  80175b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80175e:	e9 67 01 00 00       	jmp    8018ca <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  801763:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801766:	48 63 d0             	movslq %eax,%rdx
+  801769:	48 89 d0             	mov    %rdx,%rax
+  80176c:	48 01 c0             	add    %rax,%rax
+  80176f:	48 01 d0             	add    %rdx,%rax
+  801772:	48 c1 e0 02          	shl    $0x2,%rax
+  801776:	48 89 c2             	mov    %rax,%rdx
+  801779:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801780:	48 01 d0             	add    %rdx,%rax
+  801783:	8b 00                	mov    (%rax),%eax
+  801785:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80178c:	48 89 d6             	mov    %rdx,%rsi
+  80178f:	89 c7                	mov    %eax,%edi
+  801791:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 25                	js     8017c6 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017a1:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017a8:	8b 00                	mov    (%rax),%eax
+  8017aa:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017b1:	48 89 d6             	mov    %rdx,%rsi
+  8017b4:	89 c7                	mov    %eax,%edi
+  8017b6:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017c2:	85 c0                	test   %eax,%eax
+  8017c4:	79 2c                	jns    8017f2 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017c9:	48 63 d0             	movslq %eax,%rdx
+  8017cc:	48 89 d0             	mov    %rdx,%rax
+  8017cf:	48 01 c0             	add    %rax,%rax
+  8017d2:	48 01 d0             	add    %rdx,%rax
+  8017d5:	48 c1 e0 02          	shl    $0x2,%rax
+  8017d9:	48 89 c2             	mov    %rax,%rdx
+  8017dc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017e3:	48 01 d0             	add    %rdx,%rax
+  8017e6:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017ed:	e9 d8 00 00 00       	jmp    8018ca <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017f2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017f9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017fd:	48 85 c0             	test   %rax,%rax
+  801800:	74 7d                	je     80187f <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  801802:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801809:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80180d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801810:	48 63 d0             	movslq %eax,%rdx
+  801813:	48 89 d0             	mov    %rdx,%rax
+  801816:	48 01 c0             	add    %rax,%rax
+  801819:	48 01 d0             	add    %rdx,%rax
+  80181c:	48 c1 e0 02          	shl    $0x2,%rax
+  801820:	48 89 c2             	mov    %rax,%rdx
+  801823:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80182a:	48 01 d0             	add    %rdx,%rax
+  80182d:	8b 48 04             	mov    0x4(%rax),%ecx
+  801830:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801837:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80183e:	89 ce                	mov    %ecx,%esi
+  801840:	48 89 c7             	mov    %rax,%rdi
+  801843:	41 ff d0             	call   *%r8
+  801846:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801849:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80184d:	79 08                	jns    801857 <poll+0x242>
+          return r;
+  80184f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801852:	e9 45 01 00 00       	jmp    80199c <poll+0x387>
+        fds[i].revents = r;
+  801857:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80185a:	48 63 d0             	movslq %eax,%rdx
+  80185d:	48 89 d0             	mov    %rdx,%rax
+  801860:	48 01 c0             	add    %rax,%rax
+  801863:	48 01 d0             	add    %rdx,%rax
+  801866:	48 c1 e0 02          	shl    $0x2,%rax
+  80186a:	48 89 c2             	mov    %rax,%rdx
+  80186d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801874:	48 01 c2             	add    %rax,%rdx
+  801877:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80187a:	89 42 08             	mov    %eax,0x8(%rdx)
+  80187d:	eb 4b                	jmp    8018ca <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80187f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801882:	48 63 d0             	movslq %eax,%rdx
+  801885:	48 89 d0             	mov    %rdx,%rax
+  801888:	48 01 c0             	add    %rax,%rax
+  80188b:	48 01 d0             	add    %rdx,%rax
+  80188e:	48 c1 e0 02          	shl    $0x2,%rax
+  801892:	48 89 c2             	mov    %rax,%rdx
+  801895:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80189c:	48 01 d0             	add    %rdx,%rax
+  80189f:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018a5:	48 63 d0             	movslq %eax,%rdx
+  8018a8:	48 89 d0             	mov    %rdx,%rax
+  8018ab:	48 01 c0             	add    %rax,%rax
+  8018ae:	48 01 d0             	add    %rdx,%rax
+  8018b1:	48 c1 e0 02          	shl    $0x2,%rax
+  8018b5:	48 89 c2             	mov    %rax,%rdx
+  8018b8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018bf:	48 01 d0             	add    %rdx,%rax
+  8018c2:	83 e1 03             	and    $0x3,%ecx
+  8018c5:	89 ca                	mov    %ecx,%edx
+  8018c7:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018cd:	48 63 d0             	movslq %eax,%rdx
+  8018d0:	48 89 d0             	mov    %rdx,%rax
+  8018d3:	48 01 c0             	add    %rax,%rax
+  8018d6:	48 01 d0             	add    %rdx,%rax
+  8018d9:	48 c1 e0 02          	shl    $0x2,%rax
+  8018dd:	48 89 c2             	mov    %rax,%rdx
+  8018e0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018e7:	48 01 d0             	add    %rdx,%rax
+  8018ea:	8b 40 08             	mov    0x8(%rax),%eax
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	74 04                	je     8018f5 <poll+0x2e0>
+        ready++;
+  8018f1:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018f5:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018fc:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  801902:	0f 8c ab fd ff ff    	jl     8016b3 <poll+0x9e>
+    }
+    if (ready)
+  801908:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80190c:	74 08                	je     801916 <poll+0x301>
+      return ready;
+  80190e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801911:	e9 86 00 00 00       	jmp    80199c <poll+0x387>
+
+    if (deadline) {
+  801916:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80191b:	74 30                	je     80194d <poll+0x338>
+      now     = vsys_clock_ns();
+  80191d:	48 b8 50 2b 80 00 00 	movabs $0x802b50,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+  801929:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80192d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801931:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801935:	73 0a                	jae    801941 <poll+0x32c>
+  801937:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80193f:	eb 05                	jmp    801946 <poll+0x331>
+  801941:	b8 00 00 00 00       	mov    $0x0,%eax
+  801946:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80194d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801950:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  801953:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80195a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  801961:	48 89 c7             	mov    %rax,%rdi
+  801964:	48 b8 f9 07 80 00 00 	movabs $0x8007f9,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+  801970:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  801973:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801977:	75 07                	jne    801980 <poll+0x36b>
+      return 0;
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	eb 1c                	jmp    80199c <poll+0x387>
+    if (r < 0)
+  801980:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801984:	79 05                	jns    80198b <poll+0x376>
+      return r;
+  801986:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801989:	eb 11                	jmp    80199c <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80198b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80198e:	c1 f8 02             	sar    $0x2,%eax
+  801991:	83 e0 01             	and    $0x1,%eax
+  801994:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801997:	e9 f6 fc ff ff       	jmp    801692 <poll+0x7d>
+  }
+}
+  80199c:	c9                   	leave
+  80199d:	c3                   	ret
+
+000000000080199e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8019a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b7:	48 89 c7             	mov    %rax,%rdi
+  8019ba:	48 b8 8c 1a 80 00 00 	movabs $0x801a8c,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+  8019c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019cd:	79 05                	jns    8019d4 <stat+0x36>
+    return fd;
+  8019cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019d2:	eb 2f                	jmp    801a03 <stat+0x65>
+  r = fstat(fd, stat);
+  8019d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019db:	48 89 d6             	mov    %rdx,%rsi
+  8019de:	89 c7                	mov    %eax,%edi
+  8019e0:	48 b8 d5 14 80 00 00 	movabs $0x8014d5,%rax
+  8019e7:	00 00 00 
+  8019ea:	ff d0                	call   *%rax
+  8019ec:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019f2:	89 c7                	mov    %eax,%edi
+  8019f4:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+  return r;
+  801a00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+
+0000000000801a05 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	48 83 ec 10          	sub    $0x10,%rsp
+  801a0d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a14:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a1b:	00 00 00 
+  801a1e:	8b 00                	mov    (%rax),%eax
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	75 1d                	jne    801a41 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a24:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a29:	48 b8 58 4e 80 00 00 	movabs $0x804e58,%rax
+  801a30:	00 00 00 
+  801a33:	ff d0                	call   *%rax
+  801a35:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a3c:	00 00 00 
+  801a3f:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a41:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a48:	00 00 00 
+  801a4b:	8b 00                	mov    (%rax),%eax
+  801a4d:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a50:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a55:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a5c:	00 00 00 
+  801a5f:	89 c7                	mov    %eax,%edi
+  801a61:	48 b8 ab 4d 80 00 00 	movabs $0x804dab,%rax
+  801a68:	00 00 00 
+  801a6b:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	48 89 c6             	mov    %rax,%rsi
+  801a79:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a7e:	48 b8 2e 4c 80 00 00 	movabs $0x804c2e,%rax
+  801a85:	00 00 00 
+  801a88:	ff d0                	call   *%rax
+}
+  801a8a:	c9                   	leave
+  801a8b:	c3                   	ret
+
+0000000000801a8c <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a8c:	55                   	push   %rbp
+  801a8d:	48 89 e5             	mov    %rsp,%rbp
+  801a90:	48 83 ec 20          	sub    $0x20,%rsp
+  801a94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a98:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a9f:	48 89 c7             	mov    %rax,%rdi
+  801aa2:	48 b8 0f 40 80 00 00 	movabs $0x80400f,%rax
+  801aa9:	00 00 00 
+  801aac:	ff d0                	call   *%rax
+  801aae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ab3:	7e 0a                	jle    801abf <open+0x33>
+    return -E_BAD_PATH;
+  801ab5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aba:	e9 a8 00 00 00       	jmp    801b67 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801abf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801ac3:	48 89 c7             	mov    %rax,%rdi
+  801ac6:	48 b8 e6 0a 80 00 00 	movabs $0x800ae6,%rax
+  801acd:	00 00 00 
+  801ad0:	ff d0                	call   *%rax
+  801ad2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ad5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ad9:	79 08                	jns    801ae3 <open+0x57>
+    return r;
+  801adb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ade:	e9 84 00 00 00       	jmp    801b67 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801ae3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ae7:	48 89 c6             	mov    %rax,%rsi
+  801aea:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801af1:	00 00 00 
+  801af4:	48 89 c7             	mov    %rax,%rdi
+  801af7:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b03:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b0a:	00 00 00 
+  801b0d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b10:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b1a:	48 89 c6             	mov    %rax,%rsi
+  801b1d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b22:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801b29:	00 00 00 
+  801b2c:	ff d0                	call   *%rax
+  801b2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b35:	79 1d                	jns    801b54 <open+0xc8>
+    fd_close(fd, 0);
+  801b37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b40:	48 89 c7             	mov    %rax,%rdi
+  801b43:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+    return r;
+  801b4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b52:	eb 13                	jmp    801b67 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b58:	48 89 c7             	mov    %rax,%rdi
+  801b5b:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  801b62:	00 00 00 
+  801b65:	ff d0                	call   *%rax
+}
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b79:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b7c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b83:	00 00 00 
+  801b86:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b88:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b92:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+}
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+
+0000000000801ba0 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801ba0:	55                   	push   %rbp
+  801ba1:	48 89 e5             	mov    %rsp,%rbp
+  801ba4:	48 83 ec 30          	sub    $0x30,%rsp
+  801ba8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bb0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801bb4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bb9:	74 07                	je     801bc2 <devfile_read+0x22>
+  801bbb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bc0:	75 0a                	jne    801bcc <devfile_read+0x2c>
+  return E_INVAL;
+  801bc2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bc7:	e9 b4 00 00 00       	jmp    801c80 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bcc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bd3:	00 
+  while (n) {
+  801bd4:	e9 98 00 00 00       	jmp    801c71 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bdd:	8b 40 0c             	mov    0xc(%rax),%eax
+  801be0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801be7:	00 00 00 
+  801bea:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bec:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bf3:	00 00 00 
+  801bf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bfa:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801bfe:	be 00 00 00 00       	mov    $0x0,%esi
+  801c03:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c08:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801c0f:	00 00 00 
+  801c12:	ff d0                	call   *%rax
+  801c14:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c17:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c1b:	7f 13                	jg     801c30 <devfile_read+0x90>
+      return res ? res : res0;
+  801c1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c21:	74 07                	je     801c2a <devfile_read+0x8a>
+  801c23:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c26:	48 98                	cltq
+  801c28:	eb 56                	jmp    801c80 <devfile_read+0xe0>
+  801c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c2e:	eb 50                	jmp    801c80 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c33:	48 63 d0             	movslq %eax,%rdx
+  801c36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c3a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c41:	00 00 00 
+  801c44:	48 89 ce             	mov    %rcx,%rsi
+  801c47:	48 89 c7             	mov    %rax,%rdi
+  801c4a:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  801c51:	00 00 00 
+  801c54:	ff d0                	call   *%rax
+
+    buf += res;
+  801c56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c59:	48 98                	cltq
+  801c5b:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c5f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c62:	48 98                	cltq
+  801c64:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c6b:	48 98                	cltq
+  801c6d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c71:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c76:	0f 85 5d ff ff ff    	jne    801bd9 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+0000000000801c82 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c82:	55                   	push   %rbp
+  801c83:	48 89 e5             	mov    %rsp,%rbp
+  801c86:	48 83 ec 50          	sub    $0x50,%rsp
+  801c8a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c8e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c92:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c96:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c9b:	74 07                	je     801ca4 <devfile_write+0x22>
+  801c9d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801ca2:	75 0a                	jne    801cae <devfile_write+0x2c>
+  return E_INVAL;
+  801ca4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ca9:	e9 c9 00 00 00       	jmp    801d77 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801cae:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801cb5:	00 
+
+  while (n) {
+  801cb6:	e9 ad 00 00 00       	jmp    801d68 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cbb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cbf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cc3:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cca:	00 
+  801ccb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cd3:	48 39 c2             	cmp    %rax,%rdx
+  801cd6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801cda:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cde:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ce2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801ce6:	48 89 c6             	mov    %rax,%rsi
+  801ce9:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cf0:	00 00 00 
+  801cf3:	48 89 c7             	mov    %rax,%rdi
+  801cf6:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d06:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d09:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d10:	00 00 00 
+  801d13:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d15:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d1c:	00 00 00 
+  801d1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d23:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d27:	be 00 00 00 00       	mov    $0x0,%esi
+  801d2c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d31:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801d38:	00 00 00 
+  801d3b:	ff d0                	call   *%rax
+  801d3d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d40:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d44:	79 07                	jns    801d4d <devfile_write+0xcb>
+      return res;
+  801d46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d49:	48 98                	cltq
+  801d4b:	eb 2a                	jmp    801d77 <devfile_write+0xf5>
+
+    buf += res;
+  801d4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d50:	48 98                	cltq
+  801d52:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d56:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d59:	48 98                	cltq
+  801d5b:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d62:	48 98                	cltq
+  801d64:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d68:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d6d:	0f 85 48 ff ff ff    	jne    801cbb <devfile_write+0x39>
+  }
+
+  return res0;
+  801d73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d77:	c9                   	leave
+  801d78:	c3                   	ret
+
+0000000000801d79 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	48 83 ec 20          	sub    $0x20,%rsp
+  801d81:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d85:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d8d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d90:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d97:	00 00 00 
+  801d9a:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d9c:	be 00 00 00 00       	mov    $0x0,%esi
+  801da1:	bf 05 00 00 00       	mov    $0x5,%edi
+  801da6:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801dad:	00 00 00 
+  801db0:	ff d0                	call   *%rax
+  801db2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801db5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801db9:	79 05                	jns    801dc0 <devfile_stat+0x47>
+    return r;
+  801dbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dbe:	eb 59                	jmp    801e19 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dc4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dcb:	00 00 00 
+  801dce:	48 89 d6             	mov    %rdx,%rsi
+  801dd1:	48 89 c7             	mov    %rax,%rdi
+  801dd4:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801de0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801de7:	00 00 00 
+  801dea:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801df0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dfa:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e01:	00 00 00 
+  801e04:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e0e:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e19:	c9                   	leave
+  801e1a:	c3                   	ret
+
+0000000000801e1b <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e1b:	55                   	push   %rbp
+  801e1c:	48 89 e5             	mov    %rsp,%rbp
+  801e1f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e27:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e2e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e31:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e38:	00 00 00 
+  801e3b:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e3d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e44:	00 00 00 
+  801e47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e4a:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e52:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e57:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+}
+  801e63:	c9                   	leave
+  801e64:	c3                   	ret
+
+0000000000801e65 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e65:	55                   	push   %rbp
+  801e66:	48 89 e5             	mov    %rsp,%rbp
+  801e69:	48 83 ec 18          	sub    $0x18,%rsp
+  801e6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e71:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e74:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e78:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e7b:	83 e0 03             	and    $0x3,%eax
+}
+  801e7e:	c9                   	leave
+  801e7f:	c3                   	ret
+
+0000000000801e80 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e80:	55                   	push   %rbp
+  801e81:	48 89 e5             	mov    %rsp,%rbp
+  801e84:	48 83 ec 10          	sub    $0x10,%rsp
+  801e88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e90:	48 89 c7             	mov    %rax,%rdi
+  801e93:	48 b8 0f 40 80 00 00 	movabs $0x80400f,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ea4:	7e 07                	jle    801ead <remove+0x2d>
+    return -E_BAD_PATH;
+  801ea6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eab:	eb 36                	jmp    801ee3 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801ead:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eb1:	48 89 c6             	mov    %rax,%rsi
+  801eb4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ebb:	00 00 00 
+  801ebe:	48 89 c7             	mov    %rax,%rdi
+  801ec1:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ecd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed2:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ed7:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801ede:	00 00 00 
+  801ee1:	ff d0                	call   *%rax
+}
+  801ee3:	c9                   	leave
+  801ee4:	c3                   	ret
+
+0000000000801ee5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ee5:	55                   	push   %rbp
+  801ee6:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ee9:	be 00 00 00 00       	mov    $0x0,%esi
+  801eee:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ef3:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+}
+  801eff:	5d                   	pop    %rbp
+  801f00:	c3                   	ret
+
+0000000000801f01 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	48 83 ec 20          	sub    $0x20,%rsp
+  801f09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f12:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f17:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801f1e:	00 00 00 
+  801f21:	ff d0                	call   *%rax
+  801f23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f2a:	79 05                	jns    801f31 <fs_stats+0x30>
+    return r;
+  801f2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f2f:	eb 2a                	jmp    801f5b <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f35:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f3a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f41:	00 00 00 
+  801f44:	48 89 ce             	mov    %rcx,%rsi
+  801f47:	48 89 c7             	mov    %rax,%rdi
+  801f4a:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  return 0;
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5b:	c9                   	leave
+  801f5c:	c3                   	ret
+
+0000000000801f5d <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f5d:	55                   	push   %rbp
+  801f5e:	48 89 e5             	mov    %rsp,%rbp
+  801f61:	48 83 ec 10          	sub    $0x10,%rsp
+  801f65:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f68:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f6f:	00 00 00 
+  801f72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f75:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f77:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f81:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+0000000000801f8f <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f8f:	55                   	push   %rbp
+  801f90:	48 89 e5             	mov    %rsp,%rbp
+  801f93:	48 83 ec 10          	sub    $0x10,%rsp
+  801f97:	89 f8                	mov    %edi,%eax
+  801f99:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f9c:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801fa0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fa7:	00 00 00 
+  801faa:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fac:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fb6:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801fbd:	00 00 00 
+  801fc0:	ff d0                	call   *%rax
+}
+  801fc2:	c9                   	leave
+  801fc3:	c3                   	ret
+
+0000000000801fc4 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fc4:	55                   	push   %rbp
+  801fc5:	48 89 e5             	mov    %rsp,%rbp
+  801fc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801fcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd4:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fd9:	48 89 c7             	mov    %rax,%rdi
+  801fdc:	48 b8 ea 1f 80 00 00 	movabs $0x801fea,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+}
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+
+0000000000801fea <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+  801fee:	48 83 ec 50          	sub    $0x50,%rsp
+  801ff2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801ff6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801ffa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802001:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  802002:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802007:	74 0a                	je     802013 <pipe_size+0x29>
+  802009:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802010:	00 
+  802011:	76 0a                	jbe    80201d <pipe_size+0x33>
+    return -E_INVAL;
+  802013:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802018:	e9 cc 02 00 00       	jmp    8022e9 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80201d:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802021:	48 89 c7             	mov    %rax,%rdi
+  802024:	48 b8 e6 0a 80 00 00 	movabs $0x800ae6,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+  802030:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802033:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802037:	0f 88 a8 02 00 00    	js     8022e5 <pipe_size+0x2fb>
+  80203d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802041:	ba 07 04 00 00       	mov    $0x407,%edx
+  802046:	48 89 c6             	mov    %rax,%rsi
+  802049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80204e:	48 b8 b1 03 80 00 00 	movabs $0x8003b1,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+  80205a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80205d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802061:	0f 88 7e 02 00 00    	js     8022e5 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802067:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80206b:	48 89 c7             	mov    %rax,%rdi
+  80206e:	48 b8 e6 0a 80 00 00 	movabs $0x800ae6,%rax
+  802075:	00 00 00 
+  802078:	ff d0                	call   *%rax
+  80207a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80207d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802081:	0f 88 43 02 00 00    	js     8022ca <pipe_size+0x2e0>
+  802087:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80208b:	ba 07 04 00 00       	mov    $0x407,%edx
+  802090:	48 89 c6             	mov    %rax,%rsi
+  802093:	bf 00 00 00 00       	mov    $0x0,%edi
+  802098:	48 b8 b1 03 80 00 00 	movabs $0x8003b1,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+  8020a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020ab:	0f 88 19 02 00 00    	js     8022ca <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b5:	48 89 c7             	mov    %rax,%rdi
+  8020b8:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+  8020c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020c8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020cf:	00 
+  8020d0:	e9 a2 00 00 00       	jmp    802177 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020d9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020dd:	48 89 c2             	mov    %rax,%rdx
+  8020e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e4:	48 01 d0             	add    %rdx,%rax
+  8020e7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020ec:	48 89 c6             	mov    %rax,%rsi
+  8020ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f4:	48 b8 b1 03 80 00 00 	movabs $0x8003b1,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802103:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802107:	0f 88 37 01 00 00    	js     802244 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80210d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802111:	48 89 c7             	mov    %rax,%rdi
+  802114:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802124:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802128:	48 01 c2             	add    %rax,%rdx
+  80212b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80212f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802133:	48 89 c1             	mov    %rax,%rcx
+  802136:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80213a:	48 01 c8             	add    %rcx,%rax
+  80213d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  802143:	48 89 d1             	mov    %rdx,%rcx
+  802146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214b:	48 89 c6             	mov    %rax,%rsi
+  80214e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802153:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+  80215f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802162:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802166:	79 0a                	jns    802172 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802168:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80216d:	e9 d3 00 00 00       	jmp    802245 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  802172:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802177:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80217e:	00 
+  80217f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802183:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802187:	48 01 d0             	add    %rdx,%rax
+  80218a:	48 83 c0 1f          	add    $0x1f,%rax
+  80218e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802192:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802196:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219b:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80219f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a3:	48 29 d0             	sub    %rdx,%rax
+  8021a6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021aa:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021ae:	0f 82 21 ff ff ff    	jb     8020d5 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021c0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021c4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021cc:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021d3:	00 00 00 
+  8021d6:	8b 12                	mov    (%rdx),%edx
+  8021d8:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021de:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021e5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e9:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021f0:	00 00 00 
+  8021f3:	8b 12                	mov    (%rdx),%edx
+  8021f5:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  802202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802206:	48 89 c7             	mov    %rax,%rdi
+  802209:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+  802215:	89 c2                	mov    %eax,%edx
+  802217:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80221b:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80221d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802221:	48 89 c7             	mov    %rax,%rdi
+  802224:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802234:	48 83 c2 04          	add    $0x4,%rdx
+  802238:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80223a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223f:	e9 a5 00 00 00       	jmp    8022e9 <pipe_size+0x2ff>
+      goto err2;
+  802244:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802245:	eb 58                	jmp    80229f <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802247:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80224b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80224f:	48 89 c2             	mov    %rax,%rdx
+  802252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802256:	48 01 d0             	add    %rdx,%rax
+  802259:	48 89 c6             	mov    %rax,%rsi
+  80225c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802261:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80226d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802271:	48 89 c7             	mov    %rax,%rdi
+  802274:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  80227b:	00 00 00 
+  80227e:	ff d0                	call   *%rax
+  802280:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802284:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802288:	48 01 d0             	add    %rdx,%rax
+  80228b:	48 89 c6             	mov    %rax,%rsi
+  80228e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802293:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80229f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022a3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022a7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022ab:	48 85 c0             	test   %rax,%rax
+  8022ae:	75 97                	jne    802247 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022b4:	48 89 c6             	mov    %rax,%rsi
+  8022b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022bc:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+  8022c8:	eb 01                	jmp    8022cb <pipe_size+0x2e1>
+    goto err1;
+  8022ca:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022cf:	48 89 c6             	mov    %rax,%rsi
+  8022d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d7:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+  8022e3:	eb 01                	jmp    8022e6 <pipe_size+0x2fc>
+    goto err;
+  8022e5:	90                   	nop
+err:
+  return r;
+  8022e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+
+00000000008022eb <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022eb:	55                   	push   %rbp
+  8022ec:	48 89 e5             	mov    %rsp,%rbp
+  8022ef:	53                   	push   %rbx
+  8022f0:	48 83 ec 28          	sub    $0x28,%rsp
+  8022f4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022fc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802303:	00 00 00 
+  802306:	8b 40 04             	mov    0x4(%rax),%eax
+  802309:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80230e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802315:	00 00 00 
+  802318:	48 98                	cltq
+  80231a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802321:	48 01 d0             	add    %rdx,%rax
+  802324:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80232a:	8b 00                	mov    (%rax),%eax
+  80232c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80232f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802333:	48 89 c7             	mov    %rax,%rdi
+  802336:	48 b8 c9 4e 80 00 00 	movabs $0x804ec9,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+  802342:	89 c3                	mov    %eax,%ebx
+  802344:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802348:	48 89 c7             	mov    %rax,%rdi
+  80234b:	48 b8 c9 4e 80 00 00 	movabs $0x804ec9,%rax
+  802352:	00 00 00 
+  802355:	ff d0                	call   *%rax
+  802357:	39 c3                	cmp    %eax,%ebx
+  802359:	0f 94 c0             	sete   %al
+  80235c:	0f b6 c0             	movzbl %al,%eax
+  80235f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  802362:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802369:	00 00 00 
+  80236c:	8b 40 04             	mov    0x4(%rax),%eax
+  80236f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802374:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80237b:	00 00 00 
+  80237e:	48 98                	cltq
+  802380:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802387:	48 01 d0             	add    %rdx,%rax
+  80238a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802390:	8b 00                	mov    (%rax),%eax
+  802392:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  802395:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802398:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80239b:	75 05                	jne    8023a2 <_pipeisclosed+0xb7>
+      return ret;
+  80239d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023a0:	eb 68                	jmp    80240a <_pipeisclosed+0x11f>
+    if (n != nn)
+  8023a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a5:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023a8:	0f 84 4e ff ff ff    	je     8022fc <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023ae:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023b5:	00 00 00 
+  8023b8:	8b 40 04             	mov    0x4(%rax),%eax
+  8023bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023c0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023c7:	00 00 00 
+  8023ca:	48 98                	cltq
+  8023cc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023d3:	48 01 d0             	add    %rdx,%rax
+  8023d6:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023dc:	8b 10                	mov    (%rax),%edx
+  8023de:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023e4:	89 c6                	mov    %eax,%esi
+  8023e6:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023ed:	00 00 00 
+  8023f0:	48 89 c7             	mov    %rax,%rdi
+  8023f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f8:	49 b8 60 31 80 00 00 	movabs $0x803160,%r8
+  8023ff:	00 00 00 
+  802402:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802405:	e9 f2 fe ff ff       	jmp    8022fc <_pipeisclosed+0x11>
+  }
+}
+  80240a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+0000000000802410 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 30          	sub    $0x30,%rsp
+  802418:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80241b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80241f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802422:	48 89 d6             	mov    %rdx,%rsi
+  802425:	89 c7                	mov    %eax,%edi
+  802427:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802436:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80243a:	79 05                	jns    802441 <pipeisclosed+0x31>
+    return r;
+  80243c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80243f:	eb 31                	jmp    802472 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  802441:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802445:	48 89 c7             	mov    %rax,%rdi
+  802448:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802458:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80245c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802460:	48 89 d6             	mov    %rdx,%rsi
+  802463:	48 89 c7             	mov    %rax,%rdi
+  802466:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80246d:	00 00 00 
+  802470:	ff d0                	call   *%rax
+}
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+
+0000000000802474 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+  802478:	48 83 ec 10          	sub    $0x10,%rsp
+  80247c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  802480:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802484:	8b 40 18             	mov    0x18(%rax),%eax
+  802487:	8d 50 01             	lea    0x1(%rax),%edx
+  80248a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248e:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  802491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802495:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	74 27                	je     8024c3 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80249c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ab:	48 83 c0 18          	add    $0x18,%rax
+  8024af:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024b4:	48 89 c7             	mov    %rax,%rdi
+  8024b7:	48 b8 ac 07 80 00 00 	movabs $0x8007ac,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  }
+}
+  8024c3:	90                   	nop
+  8024c4:	c9                   	leave
+  8024c5:	c3                   	ret
+
+00000000008024c6 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024c6:	55                   	push   %rbp
+  8024c7:	48 89 e5             	mov    %rsp,%rbp
+  8024ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e4:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024eb:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024f2:	89 c6                	mov    %eax,%esi
+  8024f4:	48 89 cf             	mov    %rcx,%rdi
+  8024f7:	48 b8 5d 07 80 00 00 	movabs $0x80075d,%rax
+  8024fe:	00 00 00 
+  802501:	ff d0                	call   *%rax
+}
+  802503:	90                   	nop
+  802504:	c9                   	leave
+  802505:	c3                   	ret
+
+0000000000802506 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	48 83 ec 70          	sub    $0x70,%rsp
+  80250e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802512:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802516:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80251a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80251e:	48 89 c7             	mov    %rax,%rdi
+  802521:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  802528:	00 00 00 
+  80252b:	ff d0                	call   *%rax
+  80252d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802531:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802536:	75 0a                	jne    802542 <devpipe_read+0x3c>
+    return 0;
+  802538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253d:	e9 63 01 00 00       	jmp    8026a5 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  802542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802546:	8b 40 18             	mov    0x18(%rax),%eax
+  802549:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80254c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802550:	48 8b 10             	mov    (%rax),%rdx
+  802553:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802557:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80255b:	48 39 c2             	cmp    %rax,%rdx
+  80255e:	75 42                	jne    8025a2 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  802560:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802564:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802568:	48 89 d6             	mov    %rdx,%rsi
+  80256b:	48 89 c7             	mov    %rax,%rdi
+  80256e:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	74 0a                	je     802588 <devpipe_read+0x82>
+      return 0;
+  80257e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802583:	e9 1d 01 00 00       	jmp    8026a5 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802588:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80258b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80258f:	89 d6                	mov    %edx,%esi
+  802591:	48 89 c7             	mov    %rax,%rdi
+  802594:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  80259b:	00 00 00 
+  80259e:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8025a0:	eb a0                	jmp    802542 <devpipe_read+0x3c>
+      break;
+  8025a2:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8025a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025a7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025ab:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bf:	48 8b 00             	mov    (%rax),%rax
+  8025c2:	48 29 c2             	sub    %rax,%rdx
+  8025c5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025d1:	48 39 c2             	cmp    %rax,%rdx
+  8025d4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025d8:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e0:	48 8b 00             	mov    (%rax),%rax
+  8025e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025e7:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f0:	48 f7 f1             	div    %rcx
+  8025f3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025f7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802603:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802607:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80260b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80260f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802613:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802617:	48 39 c2             	cmp    %rax,%rdx
+  80261a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80261e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802622:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802626:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80262a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80262e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  802632:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80263a:	48 89 ce             	mov    %rcx,%rsi
+  80263d:	48 89 c7             	mov    %rax,%rdi
+  802640:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80264c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802650:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802654:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802658:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80265c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802660:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802664:	48 01 d1             	add    %rdx,%rcx
+  802667:	48 89 c2             	mov    %rax,%rdx
+  80266a:	48 89 cf             	mov    %rcx,%rdi
+  80266d:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267d:	48 8b 10             	mov    (%rax),%rdx
+  802680:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802684:	48 01 c2             	add    %rax,%rdx
+  802687:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80268b:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80268e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802692:	48 89 c7             	mov    %rax,%rdi
+  802695:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+  return n;
+  8026a1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8026a5:	c9                   	leave
+  8026a6:	c3                   	ret
+
+00000000008026a7 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026a7:	55                   	push   %rbp
+  8026a8:	48 89 e5             	mov    %rsp,%rbp
+  8026ab:	48 83 ec 70          	sub    $0x70,%rsp
+  8026af:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026b3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026b7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026bb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026bf:	48 89 c7             	mov    %rax,%rdi
+  8026c2:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  8026c9:	00 00 00 
+  8026cc:	ff d0                	call   *%rax
+  8026ce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026d2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026da:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026e1:	00 
+  8026e2:	e9 b8 01 00 00       	jmp    80289f <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026eb:	8b 40 18             	mov    0x18(%rax),%eax
+  8026ee:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026fd:	48 8b 00             	mov    (%rax),%rax
+  802700:	48 29 c2             	sub    %rax,%rdx
+  802703:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802707:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80270b:	48 39 c2             	cmp    %rax,%rdx
+  80270e:	75 4d                	jne    80275d <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802710:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802714:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802718:	48 89 d6             	mov    %rdx,%rsi
+  80271b:	48 89 c7             	mov    %rax,%rdi
+  80271e:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802725:	00 00 00 
+  802728:	ff d0                	call   *%rax
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	74 0a                	je     802738 <devpipe_write+0x91>
+        return 0;
+  80272e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802733:	e9 79 01 00 00       	jmp    8028b1 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802738:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80273b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80273f:	89 d6                	mov    %edx,%esi
+  802741:	48 89 c7             	mov    %rax,%rdi
+  802744:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+      m = 0;
+  802750:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802757:	00 
+      continue;
+  802758:	e9 3a 01 00 00       	jmp    802897 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80275d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802761:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802765:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802771:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802775:	48 8b 08             	mov    (%rax),%rcx
+  802778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80277c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802780:	48 29 c1             	sub    %rax,%rcx
+  802783:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802787:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80278b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80278f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802793:	48 39 c2             	cmp    %rax,%rdx
+  802796:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80279a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80279e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027aa:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b3:	48 f7 f1             	div    %rcx
+  8027b6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027be:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027ca:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027ce:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027d2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027d6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027da:	48 39 c2             	cmp    %rax,%rdx
+  8027dd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027e1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027e9:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027f1:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027f9:	48 01 d1             	add    %rdx,%rcx
+  8027fc:	48 89 c2             	mov    %rax,%rdx
+  8027ff:	48 89 cf             	mov    %rcx,%rdi
+  802802:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  802809:	00 00 00 
+  80280c:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80280e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802812:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802816:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80281a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80281e:	73 4d                	jae    80286d <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802824:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802828:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80282c:	48 29 c2             	sub    %rax,%rdx
+  80282f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802833:	48 01 c2             	add    %rax,%rdx
+  802836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80283a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80283e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802842:	48 89 c1             	mov    %rax,%rcx
+  802845:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802849:	48 01 c1             	add    %rax,%rcx
+  80284c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802850:	48 01 c1             	add    %rax,%rcx
+  802853:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802857:	48 83 c0 20          	add    $0x20,%rax
+  80285b:	48 89 ce             	mov    %rcx,%rsi
+  80285e:	48 89 c7             	mov    %rax,%rdi
+  802861:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  802868:	00 00 00 
+  80286b:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80286d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802871:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802875:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802879:	48 01 c2             	add    %rax,%rdx
+  80287c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802880:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802884:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802888:	48 89 c7             	mov    %rax,%rdi
+  80288b:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802897:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80289b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80289f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a3:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028a7:	0f 82 3a fe ff ff    	jb     8026e7 <devpipe_write+0x40>
+  }
+
+  return i;
+  8028ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028b1:	c9                   	leave
+  8028b2:	c3                   	ret
+
+00000000008028b3 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028b3:	55                   	push   %rbp
+  8028b4:	48 89 e5             	mov    %rsp,%rbp
+  8028b7:	48 83 ec 40          	sub    $0x40,%rsp
+  8028bb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028bf:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028c2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028ca:	48 89 c7             	mov    %rax,%rdi
+  8028cd:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+  8028d9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028e8:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028f0:	48 89 d6             	mov    %rdx,%rsi
+  8028f3:	48 89 c7             	mov    %rax,%rdi
+  8028f6:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8028fd:	00 00 00 
+  802900:	ff d0                	call   *%rax
+  802902:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802905:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802909:	79 08                	jns    802913 <devpipe_poll+0x60>
+    return r;
+  80290b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80290e:	e9 85 00 00 00       	jmp    802998 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802913:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802916:	83 e0 01             	and    $0x1,%eax
+  802919:	85 c0                	test   %eax,%eax
+  80291b:	74 18                	je     802935 <devpipe_poll+0x82>
+  80291d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802921:	48 8b 10             	mov    (%rax),%rdx
+  802924:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802928:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80292c:	48 39 c2             	cmp    %rax,%rdx
+  80292f:	74 04                	je     802935 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802931:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802935:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802938:	83 e0 02             	and    $0x2,%eax
+  80293b:	85 c0                	test   %eax,%eax
+  80293d:	74 23                	je     802962 <devpipe_poll+0xaf>
+  80293f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802943:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294b:	48 8b 00             	mov    (%rax),%rax
+  80294e:	48 29 c2             	sub    %rax,%rdx
+  802951:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802955:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802959:	48 39 c2             	cmp    %rax,%rdx
+  80295c:	73 04                	jae    802962 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80295e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  802962:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802966:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80296a:	48 89 d6             	mov    %rdx,%rsi
+  80296d:	48 89 c7             	mov    %rax,%rdi
+  802970:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802977:	00 00 00 
+  80297a:	ff d0                	call   *%rax
+  80297c:	85 c0                	test   %eax,%eax
+  80297e:	74 04                	je     802984 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  802980:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802984:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802988:	75 0b                	jne    802995 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80298a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80298e:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+000000000080299a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	48 83 ec 20          	sub    $0x20,%rsp
+  8029a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029ae:	48 89 c7             	mov    %rax,%rdi
+  8029b1:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029c5:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029cc:	00 00 00 
+  8029cf:	48 89 d6             	mov    %rdx,%rsi
+  8029d2:	48 89 c7             	mov    %rax,%rdi
+  8029d5:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029e9:	89 c1                	mov    %eax,%ecx
+  8029eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ef:	48 8b 00             	mov    (%rax),%rax
+  8029f2:	89 c2                	mov    %eax,%edx
+  8029f4:	89 c8                	mov    %ecx,%eax
+  8029f6:	29 d0                	sub    %edx,%eax
+  8029f8:	89 c2                	mov    %eax,%edx
+  8029fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029fe:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a08:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a0f:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a16:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a1d:	00 00 00 
+  802a20:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+
+0000000000802a2e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	48 83 ec 40          	sub    $0x40,%rsp
+  802a36:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a3e:	48 89 c7             	mov    %rax,%rdi
+  802a41:	48 b8 bb 0a 80 00 00 	movabs $0x800abb,%rax
+  802a48:	00 00 00 
+  802a4b:	ff d0                	call   *%rax
+  802a4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a51:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a58:	00 
+  802a59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a5d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a65:	48 01 d0             	add    %rdx,%rax
+  802a68:	48 83 c0 1f          	add    $0x1f,%rax
+  802a6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a79:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a81:	48 29 d0             	sub    %rdx,%rax
+  802a84:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a88:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a90:	48 89 c6             	mov    %rax,%rsi
+  802a93:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a98:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  802a9f:	00 00 00 
+  802aa2:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802aa4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aa8:	48 89 c7             	mov    %rax,%rdi
+  802aab:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  802ab2:	00 00 00 
+  802ab5:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ab7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802abb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802abf:	eb 2f                	jmp    802af0 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802ac1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ac5:	48 83 e8 01          	sub    $0x1,%rax
+  802ac9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802acd:	48 89 c2             	mov    %rax,%rdx
+  802ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ad4:	48 01 d0             	add    %rdx,%rax
+  802ad7:	48 89 c6             	mov    %rax,%rsi
+  802ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  802adf:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  802ae6:	00 00 00 
+  802ae9:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802aeb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802af0:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802af5:	77 ca                	ja     802ac1 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802af7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802afb:	48 89 c6             	mov    %rax,%rsi
+  802afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b03:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  802b0a:	00 00 00 
+  802b0d:	ff d0                	call   *%rax
+}
+  802b0f:	c9                   	leave
+  802b10:	c3                   	ret
+
+0000000000802b11 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b11:	55                   	push   %rbp
+  802b12:	48 89 e5             	mov    %rsp,%rbp
+  802b15:	48 83 ec 08          	sub    $0x8,%rsp
+  802b19:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b20:	75 10                	jne    802b32 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b22:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b29:	00 00 00 
+  802b2c:	8b 00                	mov    (%rax),%eax
+  802b2e:	48 98                	cltq
+  802b30:	eb 05                	jmp    802b37 <vsyscall+0x26>
+  }
+  return 0;
+  802b32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b37:	c9                   	leave
+  802b38:	c3                   	ret
+
+0000000000802b39 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b39:	55                   	push   %rbp
+  802b3a:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b42:	48 b8 11 2b 80 00 00 	movabs $0x802b11,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+}
+  802b4e:	5d                   	pop    %rbp
+  802b4f:	c3                   	ret
+
+0000000000802b50 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b50:	55                   	push   %rbp
+  802b51:	48 89 e5             	mov    %rsp,%rbp
+  802b54:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b58:	0f 31                	rdtsc
+  802b5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b5d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b63:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b66:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b6a:	48 09 d0             	or     %rdx,%rax
+  802b6d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b79:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b80:	00 00 00 
+  802b83:	8b 40 08             	mov    0x8(%rax),%eax
+  802b86:	48 98                	cltq
+  802b88:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b95:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b99:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802ba0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba9:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bad:	48 89 d0             	mov    %rdx,%rax
+  802bb0:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bbc:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bc0:	48 01 c8             	add    %rcx,%rax
+}
+  802bc3:	c9                   	leave
+  802bc4:	c3                   	ret
+
+0000000000802bc5 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bc5:	55                   	push   %rbp
+  802bc6:	48 89 e5             	mov    %rsp,%rbp
+  802bc9:	48 83 ec 20          	sub    $0x20,%rsp
+  802bcd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bd3:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bd6:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bda:	be 01 00 00 00       	mov    $0x1,%esi
+  802bdf:	48 89 c7             	mov    %rax,%rdi
+  802be2:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+}
+  802bee:	90                   	nop
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+
+0000000000802bf1 <getchar>:
+
+int
+getchar(void) {
+  802bf1:	55                   	push   %rbp
+  802bf2:	48 89 e5             	mov    %rsp,%rbp
+  802bf5:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802bf9:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802bfd:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c02:	48 89 c6             	mov    %rax,%rsi
+  802c05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0a:	48 b8 24 11 80 00 00 	movabs $0x801124,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+  802c16:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c19:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c1d:	79 05                	jns    802c24 <getchar+0x33>
+    return r;
+  802c1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c22:	eb 14                	jmp    802c38 <getchar+0x47>
+  if (r < 1)
+  802c24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c28:	7f 07                	jg     802c31 <getchar+0x40>
+    return -E_EOF;
+  802c2a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c2f:	eb 07                	jmp    802c38 <getchar+0x47>
+  return c;
+  802c31:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c35:	0f b6 c0             	movzbl %al,%eax
+}
+  802c38:	c9                   	leave
+  802c39:	c3                   	ret
+
+0000000000802c3a <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c3a:	55                   	push   %rbp
+  802c3b:	48 89 e5             	mov    %rsp,%rbp
+  802c3e:	48 83 ec 20          	sub    $0x20,%rsp
+  802c42:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c45:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c4c:	48 89 d6             	mov    %rdx,%rsi
+  802c4f:	89 c7                	mov    %eax,%edi
+  802c51:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c60:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c64:	79 05                	jns    802c6b <iscons+0x31>
+    return r;
+  802c66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c69:	eb 1a                	jmp    802c85 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c6f:	8b 10                	mov    (%rax),%edx
+  802c71:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c78:	00 00 00 
+  802c7b:	8b 00                	mov    (%rax),%eax
+  802c7d:	39 c2                	cmp    %eax,%edx
+  802c7f:	0f 94 c0             	sete   %al
+  802c82:	0f b6 c0             	movzbl %al,%eax
+}
+  802c85:	c9                   	leave
+  802c86:	c3                   	ret
+
+0000000000802c87 <opencons>:
+
+int
+opencons(void) {
+  802c87:	55                   	push   %rbp
+  802c88:	48 89 e5             	mov    %rsp,%rbp
+  802c8b:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c8f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c93:	48 89 c7             	mov    %rax,%rdi
+  802c96:	48 b8 e6 0a 80 00 00 	movabs $0x800ae6,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+  802ca2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca9:	79 05                	jns    802cb0 <opencons+0x29>
+    return r;
+  802cab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cae:	eb 66                	jmp    802d16 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802cb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb4:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cb9:	48 89 c6             	mov    %rax,%rsi
+  802cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc1:	48 b8 b1 03 80 00 00 	movabs $0x8003b1,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  802ccd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cd4:	79 05                	jns    802cdb <opencons+0x54>
+    return r;
+  802cd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cd9:	eb 3b                	jmp    802d16 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cdf:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802ce6:	00 00 00 
+  802ce9:	8b 12                	mov    (%rdx),%edx
+  802ceb:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802ced:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802cf8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfc:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d07:	48 89 c7             	mov    %rax,%rdi
+  802d0a:	48 b8 98 0a 80 00 00 	movabs $0x800a98,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+}
+  802d16:	c9                   	leave
+  802d17:	c3                   	ret
+
+0000000000802d18 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d18:	55                   	push   %rbp
+  802d19:	48 89 e5             	mov    %rsp,%rbp
+  802d1c:	48 83 ec 20          	sub    $0x20,%rsp
+  802d20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d23:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d26:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d2d:	48 89 d6             	mov    %rdx,%rsi
+  802d30:	89 c7                	mov    %eax,%edi
+  802d32:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  802d39:	00 00 00 
+  802d3c:	ff d0                	call   *%rax
+  802d3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d45:	79 05                	jns    802d4c <consmode+0x34>
+    return r;
+  802d47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d4a:	eb 34                	jmp    802d80 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d50:	8b 10                	mov    (%rax),%edx
+  802d52:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d59:	00 00 00 
+  802d5c:	8b 00                	mov    (%rax),%eax
+  802d5e:	39 c2                	cmp    %eax,%edx
+  802d60:	74 07                	je     802d69 <consmode+0x51>
+    return -E_INVAL;
+  802d62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d67:	eb 17                	jmp    802d80 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d70:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d77:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d7a:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d80:	c9                   	leave
+  802d81:	c3                   	ret
+
+0000000000802d82 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d82:	55                   	push   %rbp
+  802d83:	48 89 e5             	mov    %rsp,%rbp
+  802d86:	48 83 ec 20          	sub    $0x20,%rsp
+  802d8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d8e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d92:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d9a:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d9d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da5:	48 89 ce             	mov    %rcx,%rsi
+  802da8:	48 89 c7             	mov    %rax,%rdi
+  802dab:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  802db2:	00 00 00 
+  802db5:	ff d0                	call   *%rax
+  802db7:	48 98                	cltq
+}
+  802db9:	c9                   	leave
+  802dba:	c3                   	ret
+
+0000000000802dbb <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dbb:	55                   	push   %rbp
+  802dbc:	48 89 e5             	mov    %rsp,%rbp
+  802dbf:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dc6:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dcd:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dd4:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802ddb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802de2:	eb 74                	jmp    802e58 <devcons_write+0x9d>
+    m = n - tot;
+  802de4:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802deb:	89 c2                	mov    %eax,%edx
+  802ded:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802df0:	29 c2                	sub    %eax,%edx
+  802df2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802df5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802df8:	83 f8 7f             	cmp    $0x7f,%eax
+  802dfb:	76 07                	jbe    802e04 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802dfd:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e04:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e07:	48 63 d0             	movslq %eax,%rdx
+  802e0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e0d:	48 63 c8             	movslq %eax,%rcx
+  802e10:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e17:	48 01 c1             	add    %rax,%rcx
+  802e1a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e21:	48 89 ce             	mov    %rcx,%rsi
+  802e24:	48 89 c7             	mov    %rax,%rdi
+  802e27:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  802e2e:	00 00 00 
+  802e31:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e33:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e36:	48 63 d0             	movslq %eax,%rdx
+  802e39:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e40:	48 89 d6             	mov    %rdx,%rsi
+  802e43:	48 89 c7             	mov    %rax,%rdi
+  802e46:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  802e4d:	00 00 00 
+  802e50:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e52:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e55:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e5b:	48 98                	cltq
+  802e5d:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e64:	0f 82 7a ff ff ff    	jb     802de4 <devcons_write+0x29>
+  }
+  return tot;
+  802e6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e6d:	48 98                	cltq
+}
+  802e6f:	c9                   	leave
+  802e70:	c3                   	ret
+
+0000000000802e71 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e71:	55                   	push   %rbp
+  802e72:	48 89 e5             	mov    %rsp,%rbp
+  802e75:	48 83 ec 08          	sub    $0x8,%rsp
+  802e79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+0000000000802e84 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	48 83 ec 10          	sub    $0x10,%rsp
+  802e8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e98:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e9f:	00 00 00 
+  802ea2:	48 89 d6             	mov    %rdx,%rsi
+  802ea5:	48 89 c7             	mov    %rax,%rdi
+  802ea8:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+  return 0;
+  802eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eb9:	c9                   	leave
+  802eba:	c3                   	ret
+
+0000000000802ebb <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ebb:	55                   	push   %rbp
+  802ebc:	48 89 e5             	mov    %rsp,%rbp
+  802ebf:	48 83 ec 30          	sub    $0x30,%rsp
+  802ec3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ec7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802eca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ece:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ed5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ed8:	83 e0 02             	and    $0x2,%eax
+  802edb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ee2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ee5:	83 f8 01             	cmp    $0x1,%eax
+  802ee8:	75 04                	jne    802eee <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802eea:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802eee:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ef1:	83 e0 01             	and    $0x1,%eax
+  802ef4:	85 c0                	test   %eax,%eax
+  802ef6:	74 44                	je     802f3c <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802ef8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802efb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f00:	89 c2                	mov    %eax,%edx
+  802f02:	be 00 00 00 00       	mov    $0x0,%esi
+  802f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0c:	48 b8 f9 07 80 00 00 	movabs $0x8007f9,%rax
+  802f13:	00 00 00 
+  802f16:	ff d0                	call   *%rax
+  802f18:	83 f8 01             	cmp    $0x1,%eax
+  802f1b:	75 06                	jne    802f23 <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f1d:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f21:	eb 19                	jmp    802f3c <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f27:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f2d:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f30:	89 c2                	mov    %eax,%edx
+  802f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f36:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f3c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f3f:	c9                   	leave
+  802f40:	c3                   	ret
+
+0000000000802f41 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f41:	55                   	push   %rbp
+  802f42:	48 89 e5             	mov    %rsp,%rbp
+  802f45:	53                   	push   %rbx
+  802f46:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f4d:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f54:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f5a:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f61:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f68:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f6f:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f76:	84 c0                	test   %al,%al
+  802f78:	74 23                	je     802f9d <_panic+0x5c>
+  802f7a:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f81:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f85:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f89:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f8d:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f91:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f95:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f99:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f9d:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802fa4:	00 00 00 
+  802fa7:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fae:	00 00 00 
+  802fb1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fb5:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fbc:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fc3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fca:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fd1:	00 00 00 
+  802fd4:	48 8b 18             	mov    (%rax),%rbx
+  802fd7:	48 b8 38 03 80 00 00 	movabs $0x800338,%rax
+  802fde:	00 00 00 
+  802fe1:	ff d0                	call   *%rax
+  802fe3:	89 c6                	mov    %eax,%esi
+  802fe5:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802feb:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802ff2:	41 89 d0             	mov    %edx,%r8d
+  802ff5:	48 89 c1             	mov    %rax,%rcx
+  802ff8:	48 89 da             	mov    %rbx,%rdx
+  802ffb:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  803002:	00 00 00 
+  803005:	48 89 c7             	mov    %rax,%rdi
+  803008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300d:	49 b9 60 31 80 00 00 	movabs $0x803160,%r9
+  803014:	00 00 00 
+  803017:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80301a:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803021:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803028:	48 89 d6             	mov    %rdx,%rsi
+  80302b:	48 89 c7             	mov    %rax,%rdi
+  80302e:	48 b8 d5 30 80 00 00 	movabs $0x8030d5,%rax
+  803035:	00 00 00 
+  803038:	ff d0                	call   *%rax
+  cprintf("\n");
+  80303a:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  803041:	00 00 00 
+  803044:	48 89 c7             	mov    %rax,%rdi
+  803047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304c:	48 ba 60 31 80 00 00 	movabs $0x803160,%rdx
+  803053:	00 00 00 
+  803056:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803058:	cc                   	int3
+  803059:	eb fd                	jmp    803058 <_panic+0x117>
+
+000000000080305b <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80305b:	55                   	push   %rbp
+  80305c:	48 89 e5             	mov    %rsp,%rbp
+  80305f:	48 83 ec 10          	sub    $0x10,%rsp
+  803063:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803066:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80306a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80306e:	8b 00                	mov    (%rax),%eax
+  803070:	8d 48 01             	lea    0x1(%rax),%ecx
+  803073:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803077:	89 0a                	mov    %ecx,(%rdx)
+  803079:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80307c:	89 d1                	mov    %edx,%ecx
+  80307e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803082:	48 98                	cltq
+  803084:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803088:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80308c:	8b 00                	mov    (%rax),%eax
+  80308e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803093:	75 2c                	jne    8030c1 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  803095:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803099:	8b 00                	mov    (%rax),%eax
+  80309b:	48 98                	cltq
+  80309d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030a1:	48 83 c2 08          	add    $0x8,%rdx
+  8030a5:	48 89 c6             	mov    %rax,%rsi
+  8030a8:	48 89 d7             	mov    %rdx,%rdi
+  8030ab:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c5:	8b 40 04             	mov    0x4(%rax),%eax
+  8030c8:	8d 50 01             	lea    0x1(%rax),%edx
+  8030cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030cf:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030d2:	90                   	nop
+  8030d3:	c9                   	leave
+  8030d4:	c3                   	ret
+
+00000000008030d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030d5:	55                   	push   %rbp
+  8030d6:	48 89 e5             	mov    %rsp,%rbp
+  8030d9:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030e0:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030e7:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030ee:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030f5:	00 00 00 
+  b.cnt = 0;
+  8030f8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030ff:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  803102:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803109:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803110:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803117:	48 89 c6             	mov    %rax,%rsi
+  80311a:	48 b8 5b 30 80 00 00 	movabs $0x80305b,%rax
+  803121:	00 00 00 
+  803124:	48 89 c7             	mov    %rax,%rdi
+  803127:	48 b8 ba 34 80 00 00 	movabs $0x8034ba,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  803133:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803139:	48 98                	cltq
+  80313b:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  803142:	48 83 c2 08          	add    $0x8,%rdx
+  803146:	48 89 c6             	mov    %rax,%rsi
+  803149:	48 89 d7             	mov    %rdx,%rdi
+  80314c:	48 b8 9a 01 80 00 00 	movabs $0x80019a,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803158:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+0000000000803160 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803160:	55                   	push   %rbp
+  803161:	48 89 e5             	mov    %rsp,%rbp
+  803164:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80316b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803172:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803179:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803180:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803187:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80318e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803195:	84 c0                	test   %al,%al
+  803197:	74 20                	je     8031b9 <cprintf+0x59>
+  803199:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80319d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8031a1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8031a5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031a9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031ad:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031b1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031b5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031b9:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031c0:	00 00 00 
+  8031c3:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031ca:	00 00 00 
+  8031cd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031d1:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031d8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031df:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031e6:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031ed:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031f4:	48 89 d6             	mov    %rdx,%rsi
+  8031f7:	48 89 c7             	mov    %rax,%rdi
+  8031fa:	48 b8 d5 30 80 00 00 	movabs $0x8030d5,%rax
+  803201:	00 00 00 
+  803204:	ff d0                	call   *%rax
+  803206:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80320c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803212:	c9                   	leave
+  803213:	c3                   	ret
+
+0000000000803214 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803214:	55                   	push   %rbp
+  803215:	48 89 e5             	mov    %rsp,%rbp
+  803218:	48 83 ec 30          	sub    $0x30,%rsp
+  80321c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803220:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803224:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803228:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80322b:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80322f:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  803233:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803236:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80323a:	72 54                	jb     803290 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80323c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80323f:	8d 78 ff             	lea    -0x1(%rax),%edi
+  803242:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803245:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324e:	48 f7 f6             	div    %rsi
+  803251:	49 89 c2             	mov    %rax,%r10
+  803254:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803257:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80325a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80325e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803262:	41 89 c9             	mov    %ecx,%r9d
+  803265:	41 89 f8             	mov    %edi,%r8d
+  803268:	89 d1                	mov    %edx,%ecx
+  80326a:	4c 89 d2             	mov    %r10,%rdx
+  80326d:	48 89 c7             	mov    %rax,%rdi
+  803270:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+  80327c:	eb 1c                	jmp    80329a <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80327e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803282:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803285:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803289:	48 89 d6             	mov    %rdx,%rsi
+  80328c:	89 c7                	mov    %eax,%edi
+  80328e:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803290:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  803294:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803298:	7f e4                	jg     80327e <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80329a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80329d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a6:	48 f7 f1             	div    %rcx
+  8032a9:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  8032b0:	00 00 00 
+  8032b3:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032b7:	0f be c0             	movsbl %al,%eax
+  8032ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032be:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032c2:	48 89 d6             	mov    %rdx,%rsi
+  8032c5:	89 c7                	mov    %eax,%edi
+  8032c7:	ff d1                	call   *%rcx
+}
+  8032c9:	90                   	nop
+  8032ca:	c9                   	leave
+  8032cb:	c3                   	ret
+
+00000000008032cc <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032cc:	55                   	push   %rbp
+  8032cd:	48 89 e5             	mov    %rsp,%rbp
+  8032d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8032d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032d8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032db:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032df:	7e 4b                	jle    80332c <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e5:	8b 00                	mov    (%rax),%eax
+  8032e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8032ea:	77 24                	ja     803310 <getuint+0x44>
+  8032ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f8:	8b 00                	mov    (%rax),%eax
+  8032fa:	89 c0                	mov    %eax,%eax
+  8032fc:	48 01 d0             	add    %rdx,%rax
+  8032ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803303:	8b 12                	mov    (%rdx),%edx
+  803305:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803308:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330c:	89 0a                	mov    %ecx,(%rdx)
+  80330e:	eb 14                	jmp    803324 <getuint+0x58>
+  803310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803314:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803318:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80331c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803320:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803324:	48 8b 00             	mov    (%rax),%rax
+  803327:	e9 95 00 00 00       	jmp    8033c1 <getuint+0xf5>
+  else if (lflag)
+  80332c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803330:	74 48                	je     80337a <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  803332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803336:	8b 00                	mov    (%rax),%eax
+  803338:	83 f8 2f             	cmp    $0x2f,%eax
+  80333b:	77 24                	ja     803361 <getuint+0x95>
+  80333d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803341:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803349:	8b 00                	mov    (%rax),%eax
+  80334b:	89 c0                	mov    %eax,%eax
+  80334d:	48 01 d0             	add    %rdx,%rax
+  803350:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803354:	8b 12                	mov    (%rdx),%edx
+  803356:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803359:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335d:	89 0a                	mov    %ecx,(%rdx)
+  80335f:	eb 14                	jmp    803375 <getuint+0xa9>
+  803361:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803365:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803369:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80336d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803371:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803375:	48 8b 00             	mov    (%rax),%rax
+  803378:	eb 47                	jmp    8033c1 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80337a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80337e:	8b 00                	mov    (%rax),%eax
+  803380:	83 f8 2f             	cmp    $0x2f,%eax
+  803383:	77 24                	ja     8033a9 <getuint+0xdd>
+  803385:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803389:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80338d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803391:	8b 00                	mov    (%rax),%eax
+  803393:	89 c0                	mov    %eax,%eax
+  803395:	48 01 d0             	add    %rdx,%rax
+  803398:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80339c:	8b 12                	mov    (%rdx),%edx
+  80339e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a5:	89 0a                	mov    %ecx,(%rdx)
+  8033a7:	eb 14                	jmp    8033bd <getuint+0xf1>
+  8033a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033b1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033bd:	8b 00                	mov    (%rax),%eax
+  8033bf:	89 c0                	mov    %eax,%eax
+}
+  8033c1:	c9                   	leave
+  8033c2:	c3                   	ret
+
+00000000008033c3 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033c3:	55                   	push   %rbp
+  8033c4:	48 89 e5             	mov    %rsp,%rbp
+  8033c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8033cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033cf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033d2:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033d6:	7e 4b                	jle    803423 <getint+0x60>
+    return va_arg(*ap, long long);
+  8033d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033dc:	8b 00                	mov    (%rax),%eax
+  8033de:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e1:	77 24                	ja     803407 <getint+0x44>
+  8033e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ef:	8b 00                	mov    (%rax),%eax
+  8033f1:	89 c0                	mov    %eax,%eax
+  8033f3:	48 01 d0             	add    %rdx,%rax
+  8033f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033fa:	8b 12                	mov    (%rdx),%edx
+  8033fc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803403:	89 0a                	mov    %ecx,(%rdx)
+  803405:	eb 14                	jmp    80341b <getint+0x58>
+  803407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80340f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803413:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803417:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80341b:	48 8b 00             	mov    (%rax),%rax
+  80341e:	e9 95 00 00 00       	jmp    8034b8 <getint+0xf5>
+  else if (lflag)
+  803423:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803427:	74 48                	je     803471 <getint+0xae>
+    return va_arg(*ap, long);
+  803429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80342d:	8b 00                	mov    (%rax),%eax
+  80342f:	83 f8 2f             	cmp    $0x2f,%eax
+  803432:	77 24                	ja     803458 <getint+0x95>
+  803434:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803438:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80343c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803440:	8b 00                	mov    (%rax),%eax
+  803442:	89 c0                	mov    %eax,%eax
+  803444:	48 01 d0             	add    %rdx,%rax
+  803447:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80344b:	8b 12                	mov    (%rdx),%edx
+  80344d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803450:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803454:	89 0a                	mov    %ecx,(%rdx)
+  803456:	eb 14                	jmp    80346c <getint+0xa9>
+  803458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803460:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803464:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803468:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80346c:	48 8b 00             	mov    (%rax),%rax
+  80346f:	eb 47                	jmp    8034b8 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  803471:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803475:	8b 00                	mov    (%rax),%eax
+  803477:	83 f8 2f             	cmp    $0x2f,%eax
+  80347a:	77 24                	ja     8034a0 <getint+0xdd>
+  80347c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803480:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803484:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803488:	8b 00                	mov    (%rax),%eax
+  80348a:	89 c0                	mov    %eax,%eax
+  80348c:	48 01 d0             	add    %rdx,%rax
+  80348f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803493:	8b 12                	mov    (%rdx),%edx
+  803495:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803498:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349c:	89 0a                	mov    %ecx,(%rdx)
+  80349e:	eb 14                	jmp    8034b4 <getint+0xf1>
+  8034a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034a8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034b0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034b4:	8b 00                	mov    (%rax),%eax
+  8034b6:	48 98                	cltq
+}
+  8034b8:	c9                   	leave
+  8034b9:	c3                   	ret
+
+00000000008034ba <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034ba:	55                   	push   %rbp
+  8034bb:	48 89 e5             	mov    %rsp,%rbp
+  8034be:	41 54                	push   %r12
+  8034c0:	53                   	push   %rbx
+  8034c1:	48 83 ec 60          	sub    $0x60,%rsp
+  8034c5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034c9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034cd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034d1:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034d5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034d9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034dd:	48 8b 06             	mov    (%rsi),%rax
+  8034e0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034e4:	48 89 01             	mov    %rax,(%rcx)
+  8034e7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034eb:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034ef:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034f3:	eb 17                	jmp    80350c <vprintfmt+0x52>
+      if (ch == '\0')
+  8034f5:	85 db                	test   %ebx,%ebx
+  8034f7:	0f 84 bf 04 00 00    	je     8039bc <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803501:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803505:	48 89 c6             	mov    %rax,%rsi
+  803508:	89 df                	mov    %ebx,%edi
+  80350a:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80350c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803510:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803514:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803518:	0f b6 00             	movzbl (%rax),%eax
+  80351b:	0f b6 d8             	movzbl %al,%ebx
+  80351e:	83 fb 25             	cmp    $0x25,%ebx
+  803521:	75 d2                	jne    8034f5 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803523:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803527:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80352e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803535:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80353c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  803543:	eb 04                	jmp    803549 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803545:	90                   	nop
+  803546:	eb 01                	jmp    803549 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803548:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803549:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80354d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803551:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803555:	0f b6 00             	movzbl (%rax),%eax
+  803558:	0f b6 d8             	movzbl %al,%ebx
+  80355b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80355e:	83 f8 55             	cmp    $0x55,%eax
+  803561:	0f 87 22 04 00 00    	ja     803989 <vprintfmt+0x4cf>
+  803567:	89 c0                	mov    %eax,%eax
+  803569:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803570:	00 
+  803571:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  803578:	00 00 00 
+  80357b:	48 01 d0             	add    %rdx,%rax
+  80357e:	48 8b 00             	mov    (%rax),%rax
+  803581:	ff e0                	jmp    *%rax
+        padc = '-';
+  803583:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803587:	eb c0                	jmp    803549 <vprintfmt+0x8f>
+        padc = '0';
+  803589:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80358d:	eb ba                	jmp    803549 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80358f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  803596:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803599:	89 d0                	mov    %edx,%eax
+  80359b:	c1 e0 02             	shl    $0x2,%eax
+  80359e:	01 d0                	add    %edx,%eax
+  8035a0:	01 c0                	add    %eax,%eax
+  8035a2:	01 d8                	add    %ebx,%eax
+  8035a4:	83 e8 30             	sub    $0x30,%eax
+  8035a7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035aa:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035ae:	0f b6 00             	movzbl (%rax),%eax
+  8035b1:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035b4:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035b7:	7e 60                	jle    803619 <vprintfmt+0x15f>
+  8035b9:	83 fb 39             	cmp    $0x39,%ebx
+  8035bc:	7f 5b                	jg     803619 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035be:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035c3:	eb d1                	jmp    803596 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8035cb:	77 17                	ja     8035e4 <vprintfmt+0x12a>
+  8035cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035d4:	89 d2                	mov    %edx,%edx
+  8035d6:	48 01 d0             	add    %rdx,%rax
+  8035d9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035dc:	83 c2 08             	add    $0x8,%edx
+  8035df:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035e2:	eb 0c                	jmp    8035f0 <vprintfmt+0x136>
+  8035e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035e8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035ec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035f0:	8b 00                	mov    (%rax),%eax
+  8035f2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035f5:	eb 23                	jmp    80361a <vprintfmt+0x160>
+        if (width < 0)
+  8035f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035fb:	0f 89 44 ff ff ff    	jns    803545 <vprintfmt+0x8b>
+          width = 0;
+  803601:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803608:	e9 38 ff ff ff       	jmp    803545 <vprintfmt+0x8b>
+        altflag = 1;
+  80360d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803614:	e9 30 ff ff ff       	jmp    803549 <vprintfmt+0x8f>
+        goto process_precision;
+  803619:	90                   	nop
+        if (width < 0)
+  80361a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80361e:	0f 89 24 ff ff ff    	jns    803548 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803624:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803627:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80362a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803631:	e9 12 ff ff ff       	jmp    803548 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803636:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80363a:	e9 0a ff ff ff       	jmp    803549 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80363f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803642:	83 f8 2f             	cmp    $0x2f,%eax
+  803645:	77 17                	ja     80365e <vprintfmt+0x1a4>
+  803647:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80364b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80364e:	89 d2                	mov    %edx,%edx
+  803650:	48 01 d0             	add    %rdx,%rax
+  803653:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803656:	83 c2 08             	add    $0x8,%edx
+  803659:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80365c:	eb 0c                	jmp    80366a <vprintfmt+0x1b0>
+  80365e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803662:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803666:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80366a:	8b 00                	mov    (%rax),%eax
+  80366c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803670:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803674:	48 89 d6             	mov    %rdx,%rsi
+  803677:	89 c7                	mov    %eax,%edi
+  803679:	ff d1                	call   *%rcx
+        break;
+  80367b:	e9 37 03 00 00       	jmp    8039b7 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  803680:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803683:	83 f8 2f             	cmp    $0x2f,%eax
+  803686:	77 17                	ja     80369f <vprintfmt+0x1e5>
+  803688:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80368c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80368f:	89 d2                	mov    %edx,%edx
+  803691:	48 01 d0             	add    %rdx,%rax
+  803694:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803697:	83 c2 08             	add    $0x8,%edx
+  80369a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80369d:	eb 0c                	jmp    8036ab <vprintfmt+0x1f1>
+  80369f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036a3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036a7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036ab:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036ad:	85 db                	test   %ebx,%ebx
+  8036af:	79 02                	jns    8036b3 <vprintfmt+0x1f9>
+          err = -err;
+  8036b1:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036b3:	83 fb 15             	cmp    $0x15,%ebx
+  8036b6:	7f 16                	jg     8036ce <vprintfmt+0x214>
+  8036b8:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036bf:	00 00 00 
+  8036c2:	48 63 c3             	movslq %ebx,%rax
+  8036c5:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036c9:	4d 85 e4             	test   %r12,%r12
+  8036cc:	75 2e                	jne    8036fc <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036ce:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036d6:	89 d9                	mov    %ebx,%ecx
+  8036d8:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036df:	00 00 00 
+  8036e2:	48 89 c7             	mov    %rax,%rdi
+  8036e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ea:	49 b8 c6 39 80 00 00 	movabs $0x8039c6,%r8
+  8036f1:	00 00 00 
+  8036f4:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036f7:	e9 bb 02 00 00       	jmp    8039b7 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036fc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803700:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803704:	4c 89 e1             	mov    %r12,%rcx
+  803707:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  80370e:	00 00 00 
+  803711:	48 89 c7             	mov    %rax,%rdi
+  803714:	b8 00 00 00 00       	mov    $0x0,%eax
+  803719:	49 b8 c6 39 80 00 00 	movabs $0x8039c6,%r8
+  803720:	00 00 00 
+  803723:	41 ff d0             	call   *%r8
+        break;
+  803726:	e9 8c 02 00 00       	jmp    8039b7 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80372b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80372e:	83 f8 2f             	cmp    $0x2f,%eax
+  803731:	77 17                	ja     80374a <vprintfmt+0x290>
+  803733:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803737:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80373a:	89 d2                	mov    %edx,%edx
+  80373c:	48 01 d0             	add    %rdx,%rax
+  80373f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803742:	83 c2 08             	add    $0x8,%edx
+  803745:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803748:	eb 0c                	jmp    803756 <vprintfmt+0x29c>
+  80374a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80374e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803752:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803756:	4c 8b 20             	mov    (%rax),%r12
+  803759:	4d 85 e4             	test   %r12,%r12
+  80375c:	75 0a                	jne    803768 <vprintfmt+0x2ae>
+          p = "(null)";
+  80375e:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  803765:	00 00 00 
+        if (width > 0 && padc != '-')
+  803768:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80376c:	7e 78                	jle    8037e6 <vprintfmt+0x32c>
+  80376e:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  803772:	74 72                	je     8037e6 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803774:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803777:	48 98                	cltq
+  803779:	48 89 c6             	mov    %rax,%rsi
+  80377c:	4c 89 e7             	mov    %r12,%rdi
+  80377f:	48 b8 d2 40 80 00 00 	movabs $0x8040d2,%rax
+  803786:	00 00 00 
+  803789:	ff d0                	call   *%rax
+  80378b:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80378e:	eb 17                	jmp    8037a7 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803790:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  803794:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803798:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80379c:	48 89 d6             	mov    %rdx,%rsi
+  80379f:	89 c7                	mov    %eax,%edi
+  8037a1:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037a3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037a7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037ab:	7f e3                	jg     803790 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037ad:	eb 37                	jmp    8037e6 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037af:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037b3:	74 1e                	je     8037d3 <vprintfmt+0x319>
+  8037b5:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037b8:	7e 05                	jle    8037bf <vprintfmt+0x305>
+  8037ba:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037bd:	7e 14                	jle    8037d3 <vprintfmt+0x319>
+            putch('?', putdat);
+  8037bf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037c3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037c7:	48 89 c6             	mov    %rax,%rsi
+  8037ca:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037cf:	ff d2                	call   *%rdx
+  8037d1:	eb 0f                	jmp    8037e2 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037d3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037d7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037db:	48 89 c6             	mov    %rax,%rsi
+  8037de:	89 df                	mov    %ebx,%edi
+  8037e0:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037e2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037e6:	4c 89 e0             	mov    %r12,%rax
+  8037e9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037ed:	0f b6 00             	movzbl (%rax),%eax
+  8037f0:	0f be d8             	movsbl %al,%ebx
+  8037f3:	85 db                	test   %ebx,%ebx
+  8037f5:	74 28                	je     80381f <vprintfmt+0x365>
+  8037f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037fb:	78 b2                	js     8037af <vprintfmt+0x2f5>
+  8037fd:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  803801:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803805:	79 a8                	jns    8037af <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803807:	eb 16                	jmp    80381f <vprintfmt+0x365>
+          putch(' ', putdat);
+  803809:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80380d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803811:	48 89 c6             	mov    %rax,%rsi
+  803814:	bf 20 00 00 00       	mov    $0x20,%edi
+  803819:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80381b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80381f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803823:	7f e4                	jg     803809 <vprintfmt+0x34f>
+        break;
+  803825:	e9 8d 01 00 00       	jmp    8039b7 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80382a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80382d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803831:	89 d6                	mov    %edx,%esi
+  803833:	48 89 c7             	mov    %rax,%rdi
+  803836:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+  803842:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803846:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80384a:	48 85 c0             	test   %rax,%rax
+  80384d:	79 1d                	jns    80386c <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80384f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803853:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803857:	48 89 c6             	mov    %rax,%rsi
+  80385a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80385f:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803861:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803865:	48 f7 d8             	neg    %rax
+  803868:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80386c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803873:	e9 d2 00 00 00       	jmp    80394a <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803878:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80387b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80387f:	89 d6                	mov    %edx,%esi
+  803881:	48 89 c7             	mov    %rax,%rdi
+  803884:	48 b8 cc 32 80 00 00 	movabs $0x8032cc,%rax
+  80388b:	00 00 00 
+  80388e:	ff d0                	call   *%rax
+  803890:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  803894:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80389b:	e9 aa 00 00 00       	jmp    80394a <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8038a0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038a3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038a7:	89 d6                	mov    %edx,%esi
+  8038a9:	48 89 c7             	mov    %rax,%rdi
+  8038ac:	48 b8 cc 32 80 00 00 	movabs $0x8032cc,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038bc:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038c3:	e9 82 00 00 00       	jmp    80394a <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038cc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038d0:	48 89 c6             	mov    %rax,%rsi
+  8038d3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038d8:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038de:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038e2:	48 89 c6             	mov    %rax,%rsi
+  8038e5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038ea:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8038f2:	77 17                	ja     80390b <vprintfmt+0x451>
+  8038f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038fb:	89 d2                	mov    %edx,%edx
+  8038fd:	48 01 d0             	add    %rdx,%rax
+  803900:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803903:	83 c2 08             	add    $0x8,%edx
+  803906:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803909:	eb 0c                	jmp    803917 <vprintfmt+0x45d>
+  80390b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80390f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803913:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803917:	48 8b 00             	mov    (%rax),%rax
+  80391a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80391e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803925:	eb 23                	jmp    80394a <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803927:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80392a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80392e:	89 d6                	mov    %edx,%esi
+  803930:	48 89 c7             	mov    %rax,%rdi
+  803933:	48 b8 cc 32 80 00 00 	movabs $0x8032cc,%rax
+  80393a:	00 00 00 
+  80393d:	ff d0                	call   *%rax
+  80393f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803943:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80394a:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80394f:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803952:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803955:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803959:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80395d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803961:	45 89 c1             	mov    %r8d,%r9d
+  803964:	41 89 f8             	mov    %edi,%r8d
+  803967:	48 89 c7             	mov    %rax,%rdi
+  80396a:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+        break;
+  803976:	eb 3f                	jmp    8039b7 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803978:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80397c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803980:	48 89 c6             	mov    %rax,%rsi
+  803983:	89 df                	mov    %ebx,%edi
+  803985:	ff d2                	call   *%rdx
+        break;
+  803987:	eb 2e                	jmp    8039b7 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803989:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80398d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803991:	48 89 c6             	mov    %rax,%rsi
+  803994:	bf 25 00 00 00       	mov    $0x25,%edi
+  803999:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  80399b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039a0:	eb 05                	jmp    8039a7 <vprintfmt+0x4ed>
+  8039a2:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039a7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039ab:	48 83 e8 01          	sub    $0x1,%rax
+  8039af:	0f b6 00             	movzbl (%rax),%eax
+  8039b2:	3c 25                	cmp    $0x25,%al
+  8039b4:	75 ec                	jne    8039a2 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039b6:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039b7:	e9 50 fb ff ff       	jmp    80350c <vprintfmt+0x52>
+        return;
+  8039bc:	90                   	nop
+    }
+  }
+}
+  8039bd:	48 83 c4 60          	add    $0x60,%rsp
+  8039c1:	5b                   	pop    %rbx
+  8039c2:	41 5c                	pop    %r12
+  8039c4:	5d                   	pop    %rbp
+  8039c5:	c3                   	ret
+
+00000000008039c6 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039c6:	55                   	push   %rbp
+  8039c7:	48 89 e5             	mov    %rsp,%rbp
+  8039ca:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039d1:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039d8:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039df:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039e6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039ed:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039f4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039fb:	84 c0                	test   %al,%al
+  8039fd:	74 20                	je     803a1f <printfmt+0x59>
+  8039ff:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a03:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a07:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a0b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a0f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a13:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a17:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a1b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a1f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a26:	00 00 00 
+  803a29:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a30:	00 00 00 
+  803a33:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a37:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a3e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a45:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a4c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a53:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a5a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a61:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a68:	48 89 c7             	mov    %rax,%rdi
+  803a6b:	48 b8 ba 34 80 00 00 	movabs $0x8034ba,%rax
+  803a72:	00 00 00 
+  803a75:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a77:	90                   	nop
+  803a78:	c9                   	leave
+  803a79:	c3                   	ret
+
+0000000000803a7a <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a7a:	55                   	push   %rbp
+  803a7b:	48 89 e5             	mov    %rsp,%rbp
+  803a7e:	48 83 ec 10          	sub    $0x10,%rsp
+  803a82:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a85:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8d:	8b 40 10             	mov    0x10(%rax),%eax
+  803a90:	8d 50 01             	lea    0x1(%rax),%edx
+  803a93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a97:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9e:	48 8b 10             	mov    (%rax),%rdx
+  803aa1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803aa9:	48 39 c2             	cmp    %rax,%rdx
+  803aac:	73 17                	jae    803ac5 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803aae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab2:	48 8b 00             	mov    (%rax),%rax
+  803ab5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ab9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803abd:	48 89 0a             	mov    %rcx,(%rdx)
+  803ac0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803ac3:	88 10                	mov    %dl,(%rax)
+}
+  803ac5:	90                   	nop
+  803ac6:	c9                   	leave
+  803ac7:	c3                   	ret
+
+0000000000803ac8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ac8:	55                   	push   %rbp
+  803ac9:	48 89 e5             	mov    %rsp,%rbp
+  803acc:	48 83 ec 40          	sub    $0x40,%rsp
+  803ad0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ad4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ad7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803adb:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803adf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ae7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803aea:	48 98                	cltq
+  803aec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803af0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803af4:	48 01 d0             	add    %rdx,%rax
+  803af7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803afb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b02:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b07:	74 06                	je     803b0f <vsnprintf+0x47>
+  803b09:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b0d:	7f 07                	jg     803b16 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b14:	eb 32                	jmp    803b48 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b16:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b1a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b1e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b22:	48 89 c6             	mov    %rax,%rsi
+  803b25:	48 b8 7a 3a 80 00 00 	movabs $0x803a7a,%rax
+  803b2c:	00 00 00 
+  803b2f:	48 89 c7             	mov    %rax,%rdi
+  803b32:	48 b8 ba 34 80 00 00 	movabs $0x8034ba,%rax
+  803b39:	00 00 00 
+  803b3c:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b42:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b45:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b48:	c9                   	leave
+  803b49:	c3                   	ret
+
+0000000000803b4a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b4a:	55                   	push   %rbp
+  803b4b:	48 89 e5             	mov    %rsp,%rbp
+  803b4e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b55:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b5c:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b62:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b69:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b70:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b77:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b7e:	84 c0                	test   %al,%al
+  803b80:	74 20                	je     803ba2 <snprintf+0x58>
+  803b82:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b86:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b8a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b8e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b92:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b96:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b9a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b9e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803ba2:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803ba9:	00 00 00 
+  803bac:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803bb3:	00 00 00 
+  803bb6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bba:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bc1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bc8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bcf:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bd6:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bdd:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803be3:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bea:	48 89 c7             	mov    %rax,%rdi
+  803bed:	48 b8 c8 3a 80 00 00 	movabs $0x803ac8,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+  803bf9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803bff:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c05:	c9                   	leave
+  803c06:	c3                   	ret
+
+0000000000803c07 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c07:	55                   	push   %rbp
+  803c08:	48 89 e5             	mov    %rsp,%rbp
+  803c0b:	53                   	push   %rbx
+  803c0c:	48 83 ec 38          	sub    $0x38,%rsp
+  803c10:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c13:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c17:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c1b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c1f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c23:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c26:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c2b:	89 d1                	mov    %edx,%ecx
+  803c2d:	0f a2                	cpuid
+  803c2f:	89 de                	mov    %ebx,%esi
+  803c31:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c34:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c37:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c3a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c3d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c42:	74 09                	je     803c4d <cpuid+0x46>
+}
+  803c44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c48:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c4b:	89 10                	mov    %edx,(%rax)
+
+  803c4d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c52:	74 09                	je     803c5d <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c58:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c5b:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c5d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c62:	74 09                	je     803c6d <cpuid+0x66>
+char *
+  803c64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c68:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c6b:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c6d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c72:	74 09                	je     803c7d <cpuid+0x76>
+  for (; *s; s++)
+  803c74:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c78:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c7b:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c7d:	90                   	nop
+  803c7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c82:	c9                   	leave
+  803c83:	c3                   	ret
+
+0000000000803c84 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c84:	55                   	push   %rbp
+  803c85:	48 89 e5             	mov    %rsp,%rbp
+  803c88:	48 83 ec 18          	sub    $0x18,%rsp
+  803c8c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c92:	89 c1                	mov    %eax,%ecx
+  803c94:	0f 01 d0             	xgetbv
+  803c97:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c9a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ca0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803ca3:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ca7:	48 09 d0             	or     %rdx,%rax
+#else
+  803caa:	c9                   	leave
+  803cab:	c3                   	ret
+
+0000000000803cac <string_cpu>:
+string_cpu(void) {
+  803cac:	55                   	push   %rbp
+  803cad:	48 89 e5             	mov    %rsp,%rbp
+  803cb0:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803cb4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cbb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cc2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cc9:	00 00 00 
+  803ccc:	8b 00                	mov    (%rax),%eax
+  803cce:	85 c0                	test   %eax,%eax
+  803cd0:	78 11                	js     803ce3 <string_cpu+0x37>
+    return string_features;
+  803cd2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cd9:	00 00 00 
+  803cdc:	8b 00                	mov    (%rax),%eax
+  803cde:	e9 df 00 00 00       	jmp    803dc2 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803ce3:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803ce7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ced:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cf7:	48 89 c6             	mov    %rax,%rsi
+  803cfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cff:	48 b8 07 3c 80 00 00 	movabs $0x803c07,%rax
+  803d06:	00 00 00 
+  803d09:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d0b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d0e:	83 f8 06             	cmp    $0x6,%eax
+  803d11:	76 28                	jbe    803d3b <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d13:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d22:	48 89 c2             	mov    %rax,%rdx
+  803d25:	be 00 00 00 00       	mov    $0x0,%esi
+  803d2a:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d2f:	48 b8 07 3c 80 00 00 	movabs $0x803c07,%rax
+  803d36:	00 00 00 
+  803d39:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d3e:	25 00 02 00 00       	and    $0x200,%eax
+  803d43:	85 c0                	test   %eax,%eax
+  803d45:	74 04                	je     803d4b <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d47:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d4b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d55:	48 89 c1             	mov    %rax,%rcx
+  803d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d62:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d67:	48 b8 07 3c 80 00 00 	movabs $0x803c07,%rax
+  803d6e:	00 00 00 
+  803d71:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d73:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d76:	83 e0 20             	and    $0x20,%eax
+  803d79:	85 c0                	test   %eax,%eax
+  803d7b:	74 2a                	je     803da7 <string_cpu+0xfb>
+  803d7d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d80:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	74 1e                	je     803da7 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d8e:	48 b8 84 3c 80 00 00 	movabs $0x803c84,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d9d:	48 83 f8 06          	cmp    $0x6,%rax
+  803da1:	75 04                	jne    803da7 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803da3:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803da7:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803dae:	00 00 00 
+  803db1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803db4:	89 02                	mov    %eax,(%rdx)
+  803db6:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dbd:	00 00 00 
+  803dc0:	8b 00                	mov    (%rax),%eax
+}
+  803dc2:	c9                   	leave
+  803dc3:	c3                   	ret
+
+0000000000803dc4 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803dc4:	55                   	push   %rbp
+  803dc5:	48 89 e5             	mov    %rsp,%rbp
+  803dc8:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dcc:	48 83 ec 60          	sub    $0x60,%rsp
+  803dd0:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dd5:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dda:	83 e0 1f             	and    $0x1f,%eax
+  803ddd:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803de1:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803de5:	48 f7 d8             	neg    %rax
+  803de8:	48 89 c2             	mov    %rax,%rdx
+  803deb:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803df0:	48 01 d0             	add    %rdx,%rax
+  803df3:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803df8:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803dfc:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e02:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e07:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e0b:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e11:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e15:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e19:	89 c2                	mov    %eax,%edx
+  803e1b:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e1f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e24:	89 c1                	mov    %eax,%ecx
+  803e26:	d3 e6                	shl    %cl,%esi
+  803e28:	89 f0                	mov    %esi,%eax
+  803e2a:	21 d0                	and    %edx,%eax
+  803e2c:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e30:	eb 21                	jmp    803e53 <strlen_avx2+0x8f>
+    p += 32;
+  803e32:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e38:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e3d:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e41:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e47:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e4b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e4f:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e53:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e58:	74 d8                	je     803e32 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e5a:	31 c0                	xor    %eax,%eax
+  803e5c:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e62:	48 63 d0             	movslq %eax,%rdx
+  803e65:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e6a:	48 01 d0             	add    %rdx,%rax
+  803e6d:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e72:	c9                   	leave
+  803e73:	c3                   	ret
+
+0000000000803e74 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e74:	55                   	push   %rbp
+  803e75:	48 89 e5             	mov    %rsp,%rbp
+  803e78:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e7c:	48 83 ec 40          	sub    $0x40,%rsp
+  803e80:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e85:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e8a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e8f:	eb 77                	jmp    803f08 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e91:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e96:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e9a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e9e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803ea3:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ea7:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803eab:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803eaf:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803eb3:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803eb8:	74 3c                	je     803ef6 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803eba:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803ebe:	f7 d0                	not    %eax
+  803ec0:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ec4:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ec8:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ecc:	48 63 d0             	movslq %eax,%rdx
+  803ecf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ed4:	48 01 d0             	add    %rdx,%rax
+  803ed7:	0f b6 00             	movzbl (%rax),%eax
+  803eda:	0f b6 c0             	movzbl %al,%eax
+  803edd:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ee1:	48 63 ca             	movslq %edx,%rcx
+  803ee4:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ee9:	48 01 ca             	add    %rcx,%rdx
+  803eec:	0f b6 12             	movzbl (%rdx),%edx
+  803eef:	0f b6 d2             	movzbl %dl,%edx
+  803ef2:	29 d0                	sub    %edx,%eax
+  803ef4:	eb 6b                	jmp    803f61 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ef6:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803efc:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f02:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f08:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f0e:	77 81                	ja     803e91 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f10:	eb 42                	jmp    803f54 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f12:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f17:	0f b6 10             	movzbl (%rax),%edx
+  803f1a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f1f:	0f b6 00             	movzbl (%rax),%eax
+  803f22:	38 c2                	cmp    %al,%dl
+  803f24:	74 1c                	je     803f42 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f26:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f2b:	0f b6 00             	movzbl (%rax),%eax
+  803f2e:	0f b6 c8             	movzbl %al,%ecx
+  803f31:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f36:	0f b6 00             	movzbl (%rax),%eax
+  803f39:	0f b6 d0             	movzbl %al,%edx
+  803f3c:	89 c8                	mov    %ecx,%eax
+  803f3e:	29 d0                	sub    %edx,%eax
+  803f40:	eb 1f                	jmp    803f61 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f42:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f48:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f4e:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f54:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f5a:	75 b6                	jne    803f12 <memcmp_avx2+0x9e>
+  return 0;
+  803f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f61:	c9                   	leave
+  803f62:	c3                   	ret
+
+0000000000803f63 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f63:	55                   	push   %rbp
+  803f64:	48 89 e5             	mov    %rsp,%rbp
+  803f67:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f6b:	48 83 ec 60          	sub    $0x60,%rsp
+  803f6f:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f74:	89 f0                	mov    %esi,%eax
+  803f76:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f7b:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f7f:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f84:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f88:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f8d:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f93:	eb 47                	jmp    803fdc <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f95:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f9a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f9e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803fa2:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fa8:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fac:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fb0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fb4:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fb9:	74 15                	je     803fd0 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fbb:	31 c0                	xor    %eax,%eax
+  803fbd:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fc3:	48 63 d0             	movslq %eax,%rdx
+  803fc6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fcb:	48 01 d0             	add    %rdx,%rax
+  803fce:	eb 3d                	jmp    80400d <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fd0:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fd6:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fdc:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fe2:	77 b1                	ja     803f95 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fe4:	eb 0c                	jmp    803ff2 <memfind_avx2+0x8f>
+  803fe6:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fec:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803ff2:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803ff8:	74 0e                	je     804008 <memfind_avx2+0xa5>
+  803ffa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fff:	0f b6 00             	movzbl (%rax),%eax
+  804002:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804006:	75 de                	jne    803fe6 <memfind_avx2+0x83>
+  return s;
+  804008:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80400d:	c9                   	leave
+  80400e:	c3                   	ret
+
+000000000080400f <strlen>:
+strlen(const char *s) {
+  80400f:	55                   	push   %rbp
+  804010:	48 89 e5             	mov    %rsp,%rbp
+  804013:	48 83 ec 40          	sub    $0x40,%rsp
+  804017:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80401b:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80401f:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804023:	48 b8 ac 3c 80 00 00 	movabs $0x803cac,%rax
+  80402a:	00 00 00 
+  80402d:	ff d0                	call   *%rax
+  80402f:	83 e0 02             	and    $0x2,%eax
+  804032:	85 c0                	test   %eax,%eax
+  804034:	74 18                	je     80404e <strlen+0x3f>
+    return strlen_avx2(s);
+  804036:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80403a:	48 89 c7             	mov    %rax,%rdi
+  80403d:	48 b8 c4 3d 80 00 00 	movabs $0x803dc4,%rax
+  804044:	00 00 00 
+  804047:	ff d0                	call   *%rax
+  804049:	e9 82 00 00 00       	jmp    8040d0 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80404e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804052:	83 e0 0f             	and    $0xf,%eax
+  804055:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804058:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80405b:	48 f7 d8             	neg    %rax
+  80405e:	48 89 c2             	mov    %rax,%rdx
+  804061:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804065:	48 01 d0             	add    %rdx,%rax
+  804068:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80406c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804070:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804074:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804079:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80407d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804081:	89 c2                	mov    %eax,%edx
+  804083:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804086:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80408b:	89 c1                	mov    %eax,%ecx
+  80408d:	d3 e6                	shl    %cl,%esi
+  80408f:	89 f0                	mov    %esi,%eax
+  804091:	21 d0                	and    %edx,%eax
+  804093:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804096:	eb 1d                	jmp    8040b5 <strlen+0xa6>
+    p += 16;
+  804098:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80409d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040a1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040a5:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040aa:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040ae:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040b9:	74 dd                	je     804098 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040bb:	31 c0                	xor    %eax,%eax
+  8040bd:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040c2:	48 63 d0             	movslq %eax,%rdx
+  8040c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040c9:	48 01 d0             	add    %rdx,%rax
+  8040cc:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040d0:	c9                   	leave
+  8040d1:	c3                   	ret
+
+00000000008040d2 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040d2:	55                   	push   %rbp
+  8040d3:	48 89 e5             	mov    %rsp,%rbp
+  8040d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8040da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040e2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040e9:	eb 0e                	jmp    8040f9 <strnlen+0x27>
+    n++;
+  8040eb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040ef:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040f4:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040f9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040fe:	74 0b                	je     80410b <strnlen+0x39>
+  804100:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804104:	0f b6 00             	movzbl (%rax),%eax
+  804107:	84 c0                	test   %al,%al
+  804109:	75 e0                	jne    8040eb <strnlen+0x19>
+  return n;
+  80410b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80410e:	c9                   	leave
+  80410f:	c3                   	ret
+
+0000000000804110 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804110:	55                   	push   %rbp
+  804111:	48 89 e5             	mov    %rsp,%rbp
+  804114:	48 83 ec 20          	sub    $0x20,%rsp
+  804118:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80411c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804124:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804128:	90                   	nop
+  804129:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80412d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804131:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804135:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804139:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80413d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804141:	0f b6 12             	movzbl (%rdx),%edx
+  804144:	88 10                	mov    %dl,(%rax)
+  804146:	0f b6 00             	movzbl (%rax),%eax
+  804149:	84 c0                	test   %al,%al
+  80414b:	75 dc                	jne    804129 <strcpy+0x19>
+  return ret;
+  80414d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804151:	c9                   	leave
+  804152:	c3                   	ret
+
+0000000000804153 <strcat>:
+strcat(char *dst, const char *src) {
+  804153:	55                   	push   %rbp
+  804154:	48 89 e5             	mov    %rsp,%rbp
+  804157:	48 83 ec 20          	sub    $0x20,%rsp
+  80415b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80415f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  804163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804167:	48 89 c7             	mov    %rax,%rdi
+  80416a:	48 b8 0f 40 80 00 00 	movabs $0x80400f,%rax
+  804171:	00 00 00 
+  804174:	ff d0                	call   *%rax
+  804176:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804179:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80417c:	48 63 d0             	movslq %eax,%rdx
+  80417f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804183:	48 01 c2             	add    %rax,%rdx
+  804186:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80418a:	48 89 c6             	mov    %rax,%rsi
+  80418d:	48 89 d7             	mov    %rdx,%rdi
+  804190:	48 b8 10 41 80 00 00 	movabs $0x804110,%rax
+  804197:	00 00 00 
+  80419a:	ff d0                	call   *%rax
+  return dst;
+  80419c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8041a0:	c9                   	leave
+  8041a1:	c3                   	ret
+
+00000000008041a2 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8041a2:	55                   	push   %rbp
+  8041a3:	48 89 e5             	mov    %rsp,%rbp
+  8041a6:	48 83 ec 28          	sub    $0x28,%rsp
+  8041aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041b2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041be:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041c5:	00 
+  8041c6:	eb 2a                	jmp    8041f2 <strncpy+0x50>
+    *dst++ = *src;
+  8041c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041d8:	0f b6 12             	movzbl (%rdx),%edx
+  8041db:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e1:	0f b6 00             	movzbl (%rax),%eax
+  8041e4:	84 c0                	test   %al,%al
+  8041e6:	74 05                	je     8041ed <strncpy+0x4b>
+      src++;
+  8041e8:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041ed:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041f6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041fa:	72 cc                	jb     8041c8 <strncpy+0x26>
+  return ret;
+  8041fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804200:	c9                   	leave
+  804201:	c3                   	ret
+
+0000000000804202 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  804202:	55                   	push   %rbp
+  804203:	48 89 e5             	mov    %rsp,%rbp
+  804206:	48 83 ec 28          	sub    $0x28,%rsp
+  80420a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80420e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804212:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80421e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804223:	74 3d                	je     804262 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804225:	eb 1d                	jmp    804244 <strlcpy+0x42>
+      *dst++ = *src++;
+  804227:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80422b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80422f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804233:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804237:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80423b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80423f:	0f b6 12             	movzbl (%rdx),%edx
+  804242:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804244:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804249:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80424e:	74 0b                	je     80425b <strlcpy+0x59>
+  804250:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804254:	0f b6 00             	movzbl (%rax),%eax
+  804257:	84 c0                	test   %al,%al
+  804259:	75 cc                	jne    804227 <strlcpy+0x25>
+    *dst = '\0';
+  80425b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80425f:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  804262:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804266:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80426a:	c9                   	leave
+  80426b:	c3                   	ret
+
+000000000080426c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80426c:	55                   	push   %rbp
+  80426d:	48 89 e5             	mov    %rsp,%rbp
+  804270:	48 83 ec 30          	sub    $0x30,%rsp
+  804274:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804278:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80427c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  804280:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804284:	48 89 c7             	mov    %rax,%rdi
+  804287:	48 b8 0f 40 80 00 00 	movabs $0x80400f,%rax
+  80428e:	00 00 00 
+  804291:	ff d0                	call   *%rax
+  804293:	48 98                	cltq
+  804295:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804299:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80429d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a1:	48 89 d6             	mov    %rdx,%rsi
+  8042a4:	48 89 c7             	mov    %rax,%rdi
+  8042a7:	48 b8 d2 40 80 00 00 	movabs $0x8040d2,%rax
+  8042ae:	00 00 00 
+  8042b1:	ff d0                	call   *%rax
+  8042b3:	48 98                	cltq
+  8042b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042bd:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042c1:	75 10                	jne    8042d3 <strlcat+0x67>
+    return maxlen + srclen;
+  8042c3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042cb:	48 01 d0             	add    %rdx,%rax
+  8042ce:	e9 86 00 00 00       	jmp    804359 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042d7:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042db:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042df:	73 2b                	jae    80430c <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042e5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042e9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f1:	48 01 c1             	add    %rax,%rcx
+  8042f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f8:	48 89 c6             	mov    %rax,%rsi
+  8042fb:	48 89 cf             	mov    %rcx,%rdi
+  8042fe:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+  80430a:	eb 42                	jmp    80434e <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80430c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804310:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804314:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80431c:	48 01 c1             	add    %rax,%rcx
+  80431f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804323:	48 89 c6             	mov    %rax,%rsi
+  804326:	48 89 cf             	mov    %rcx,%rdi
+  804329:	48 b8 59 48 80 00 00 	movabs $0x804859,%rax
+  804330:	00 00 00 
+  804333:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804335:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804339:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80433d:	48 01 d0             	add    %rdx,%rax
+  804340:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804344:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804348:	48 01 d0             	add    %rdx,%rax
+  80434b:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80434e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804352:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804356:	48 01 d0             	add    %rdx,%rax
+}
+  804359:	c9                   	leave
+  80435a:	c3                   	ret
+
+000000000080435b <strcmp>:
+strcmp(const char *p, const char *q) {
+  80435b:	55                   	push   %rbp
+  80435c:	48 89 e5             	mov    %rsp,%rbp
+  80435f:	48 83 ec 10          	sub    $0x10,%rsp
+  804363:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804367:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80436b:	eb 0a                	jmp    804377 <strcmp+0x1c>
+    p++, q++;
+  80436d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804372:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80437b:	0f b6 00             	movzbl (%rax),%eax
+  80437e:	84 c0                	test   %al,%al
+  804380:	74 12                	je     804394 <strcmp+0x39>
+  804382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804386:	0f b6 10             	movzbl (%rax),%edx
+  804389:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80438d:	0f b6 00             	movzbl (%rax),%eax
+  804390:	38 c2                	cmp    %al,%dl
+  804392:	74 d9                	je     80436d <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  804394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804398:	0f b6 00             	movzbl (%rax),%eax
+  80439b:	0f b6 d0             	movzbl %al,%edx
+  80439e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043a2:	0f b6 00             	movzbl (%rax),%eax
+  8043a5:	0f b6 c0             	movzbl %al,%eax
+  8043a8:	29 c2                	sub    %eax,%edx
+  8043aa:	89 d0                	mov    %edx,%eax
+}
+  8043ac:	c9                   	leave
+  8043ad:	c3                   	ret
+
+00000000008043ae <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+  8043b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8043b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043c2:	eb 0f                	jmp    8043d3 <strncmp+0x25>
+    n--, p++, q++;
+  8043c4:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043ce:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043d3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043d8:	74 1d                	je     8043f7 <strncmp+0x49>
+  8043da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043de:	0f b6 00             	movzbl (%rax),%eax
+  8043e1:	84 c0                	test   %al,%al
+  8043e3:	74 12                	je     8043f7 <strncmp+0x49>
+  8043e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e9:	0f b6 10             	movzbl (%rax),%edx
+  8043ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043f0:	0f b6 00             	movzbl (%rax),%eax
+  8043f3:	38 c2                	cmp    %al,%dl
+  8043f5:	74 cd                	je     8043c4 <strncmp+0x16>
+  if (n == 0)
+  8043f7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043fc:	75 07                	jne    804405 <strncmp+0x57>
+    return 0;
+  8043fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804403:	eb 16                	jmp    80441b <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804405:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804409:	0f b6 00             	movzbl (%rax),%eax
+  80440c:	0f b6 d0             	movzbl %al,%edx
+  80440f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804413:	0f b6 00             	movzbl (%rax),%eax
+  804416:	0f b6 c0             	movzbl %al,%eax
+  804419:	29 c2                	sub    %eax,%edx
+}
+  80441b:	89 d0                	mov    %edx,%eax
+  80441d:	c9                   	leave
+  80441e:	c3                   	ret
+
+000000000080441f <strchr>:
+strchr(const char *s, char c) {
+  80441f:	55                   	push   %rbp
+  804420:	48 89 e5             	mov    %rsp,%rbp
+  804423:	48 83 ec 60          	sub    $0x60,%rsp
+  804427:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80442b:	89 f0                	mov    %esi,%eax
+  80442d:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804430:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804434:	83 e0 0f             	and    $0xf,%eax
+  804437:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80443a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80443d:	48 f7 d8             	neg    %rax
+  804440:	48 89 c2             	mov    %rax,%rdx
+  804443:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804447:	48 01 d0             	add    %rdx,%rax
+  80444a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80444e:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804452:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804456:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80445a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80445e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804462:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804466:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80446b:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80446f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804473:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804477:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80447b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804480:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804485:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804489:	89 c2                	mov    %eax,%edx
+  80448b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804490:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804495:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804499:	09 c2                	or     %eax,%edx
+  80449b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80449e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8044a3:	89 c1                	mov    %eax,%ecx
+  8044a5:	d3 e6                	shl    %cl,%esi
+  8044a7:	89 f0                	mov    %esi,%eax
+  8044a9:	21 d0                	and    %edx,%eax
+  8044ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044ae:	eb 34                	jmp    8044e4 <strchr+0xc5>
+    p += 16;
+  8044b0:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044b9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044bd:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044c1:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c6:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044cb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044cf:	89 c2                	mov    %eax,%edx
+  8044d1:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044d6:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044db:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044df:	09 d0                	or     %edx,%eax
+  8044e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044e8:	74 c6                	je     8044b0 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044ea:	31 c0                	xor    %eax,%eax
+  8044ec:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044f1:	48 98                	cltq
+  8044f3:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044fb:	0f b6 00             	movzbl (%rax),%eax
+  8044fe:	84 c0                	test   %al,%al
+  804500:	74 06                	je     804508 <strchr+0xe9>
+  804502:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804506:	eb 05                	jmp    80450d <strchr+0xee>
+  804508:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80450d:	c9                   	leave
+  80450e:	c3                   	ret
+
+000000000080450f <strfind>:
+strfind(const char *s, char c) {
+  80450f:	55                   	push   %rbp
+  804510:	48 89 e5             	mov    %rsp,%rbp
+  804513:	48 83 ec 10          	sub    $0x10,%rsp
+  804517:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80451b:	89 f0                	mov    %esi,%eax
+  80451d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804520:	eb 11                	jmp    804533 <strfind+0x24>
+    if (*s == c)
+  804522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804526:	0f b6 00             	movzbl (%rax),%eax
+  804529:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80452c:	74 12                	je     804540 <strfind+0x31>
+  for (; *s; s++)
+  80452e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804533:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804537:	0f b6 00             	movzbl (%rax),%eax
+  80453a:	84 c0                	test   %al,%al
+  80453c:	75 e4                	jne    804522 <strfind+0x13>
+  80453e:	eb 01                	jmp    804541 <strfind+0x32>
+      break;
+  804540:	90                   	nop
+  return (char *)s;
+  804541:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804545:	c9                   	leave
+  804546:	c3                   	ret
+
+0000000000804547 <memset>:
+memset(void *v, int c, size_t n) {
+  804547:	55                   	push   %rbp
+  804548:	48 89 e5             	mov    %rsp,%rbp
+  80454b:	48 83 ec 38          	sub    $0x38,%rsp
+  80454f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804553:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804556:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80455a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80455e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804562:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804567:	76 41                	jbe    8045aa <memset+0x63>
+  804569:	48 b8 ac 3c 80 00 00 	movabs $0x803cac,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+  804575:	83 e0 01             	and    $0x1,%eax
+  804578:	85 c0                	test   %eax,%eax
+  80457a:	74 2e                	je     8045aa <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80457c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80457f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804583:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804587:	48 89 ce             	mov    %rcx,%rsi
+  80458a:	48 89 f7             	mov    %rsi,%rdi
+  80458d:	48 89 d1             	mov    %rdx,%rcx
+  804590:	fc                   	cld
+  804591:	f3 aa                	rep stos %al,%es:(%rdi)
+  804593:	48 89 ca             	mov    %rcx,%rdx
+  804596:	48 89 fe             	mov    %rdi,%rsi
+  804599:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80459d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8045a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045a5:	e9 a7 00 00 00       	jmp    804651 <memset+0x10a>
+  if (n >= 8) {
+  8045aa:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045af:	0f 86 87 00 00 00    	jbe    80463c <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045b5:	eb 16                	jmp    8045cd <memset+0x86>
+      *p++ = c;
+  8045b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045bf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045c3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045c6:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045c8:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d1:	83 e0 07             	and    $0x7,%eax
+  8045d4:	48 85 c0             	test   %rax,%rax
+  8045d7:	75 de                	jne    8045b7 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045d9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045dc:	0f b6 c0             	movzbl %al,%eax
+  8045df:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045e6:	01 01 01 
+  8045e9:	48 0f af c2          	imul   %rdx,%rax
+  8045ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045f5:	48 c1 e8 03          	shr    $0x3,%rax
+  8045f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804601:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804605:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804609:	48 89 ce             	mov    %rcx,%rsi
+  80460c:	48 89 f7             	mov    %rsi,%rdi
+  80460f:	48 89 d1             	mov    %rdx,%rcx
+  804612:	fc                   	cld
+  804613:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804616:	48 89 ca             	mov    %rcx,%rdx
+  804619:	48 89 fe             	mov    %rdi,%rsi
+  80461c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804620:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804624:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804629:	eb 11                	jmp    80463c <memset+0xf5>
+    *p++ = c;
+  80462b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80462f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804633:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804637:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80463a:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80463c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804640:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804644:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804648:	48 85 c0             	test   %rax,%rax
+  80464b:	75 de                	jne    80462b <memset+0xe4>
+  return v;
+  80464d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804651:	c9                   	leave
+  804652:	c3                   	ret
+
+0000000000804653 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  804653:	55                   	push   %rbp
+  804654:	48 89 e5             	mov    %rsp,%rbp
+  804657:	48 83 ec 38          	sub    $0x38,%rsp
+  80465b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80465f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804663:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804667:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80466b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80466f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804673:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80467b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80467f:	0f 83 da 00 00 00    	jae    80475f <memmove+0x10c>
+  804685:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804689:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80468d:	48 01 d0             	add    %rdx,%rax
+  804690:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804694:	0f 83 c5 00 00 00    	jae    80475f <memmove+0x10c>
+    s += n;
+  80469a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80469e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8046a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046aa:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046af:	0f 86 94 00 00 00    	jbe    804749 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046b5:	eb 1c                	jmp    8046d3 <memmove+0x80>
+        *--d = *--s;
+  8046b7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046bc:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c5:	0f b6 10             	movzbl (%rax),%edx
+  8046c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046cc:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046ce:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d7:	83 e0 07             	and    $0x7,%eax
+  8046da:	48 85 c0             	test   %rax,%rax
+  8046dd:	75 d8                	jne    8046b7 <memmove+0x64>
+      nq = n / 8;
+  8046df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046e3:	48 c1 e8 03          	shr    $0x3,%rax
+  8046e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046eb:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046f0:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046f5:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046fa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804706:	48 89 cf             	mov    %rcx,%rdi
+  804709:	48 89 d6             	mov    %rdx,%rsi
+  80470c:	48 89 c1             	mov    %rax,%rcx
+  80470f:	fd                   	std
+  804710:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804713:	fc                   	cld
+  804714:	48 89 c8             	mov    %rcx,%rax
+  804717:	48 89 f2             	mov    %rsi,%rdx
+  80471a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80471e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804722:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804726:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80472b:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804730:	eb 17                	jmp    804749 <memmove+0xf6>
+      *--d = *--s;
+  804732:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804737:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80473c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804740:	0f b6 10             	movzbl (%rax),%edx
+  804743:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804747:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804749:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80474d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804751:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804755:	48 85 c0             	test   %rax,%rax
+  804758:	75 d8                	jne    804732 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80475a:	e9 f4 00 00 00       	jmp    804853 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80475f:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804764:	76 46                	jbe    8047ac <memmove+0x159>
+  804766:	48 b8 ac 3c 80 00 00 	movabs $0x803cac,%rax
+  80476d:	00 00 00 
+  804770:	ff d0                	call   *%rax
+  804772:	83 e0 01             	and    $0x1,%eax
+  804775:	85 c0                	test   %eax,%eax
+  804777:	74 33                	je     8047ac <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804779:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80477d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804781:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804785:	48 89 cf             	mov    %rcx,%rdi
+  804788:	48 89 d6             	mov    %rdx,%rsi
+  80478b:	48 89 c1             	mov    %rax,%rcx
+  80478e:	fc                   	cld
+  80478f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804791:	48 89 c8             	mov    %rcx,%rax
+  804794:	48 89 f2             	mov    %rsi,%rdx
+  804797:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80479b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80479f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8047a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047a7:	e9 ab 00 00 00       	jmp    804857 <memmove+0x204>
+    if (n >= 8) {
+  8047ac:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047b1:	0f 86 8b 00 00 00    	jbe    804842 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047b7:	eb 22                	jmp    8047db <memmove+0x188>
+        *d++ = *s++;
+  8047b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047bd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047c9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047cd:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047d1:	0f b6 12             	movzbl (%rdx),%edx
+  8047d4:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047d6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047df:	83 e0 07             	and    $0x7,%eax
+  8047e2:	48 85 c0             	test   %rax,%rax
+  8047e5:	75 d2                	jne    8047b9 <memmove+0x166>
+      nq = n / 8;
+  8047e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047eb:	48 c1 e8 03          	shr    $0x3,%rax
+  8047ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047f3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ff:	48 89 cf             	mov    %rcx,%rdi
+  804802:	48 89 d6             	mov    %rdx,%rsi
+  804805:	48 89 c1             	mov    %rax,%rcx
+  804808:	fc                   	cld
+  804809:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80480c:	48 89 c8             	mov    %rcx,%rax
+  80480f:	48 89 f2             	mov    %rsi,%rdx
+  804812:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804816:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80481a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80481e:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804823:	eb 1d                	jmp    804842 <memmove+0x1ef>
+      *d++ = *s++;
+  804825:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804829:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80482d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804835:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804839:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80483d:	0f b6 12             	movzbl (%rdx),%edx
+  804840:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804842:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804846:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80484a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80484e:	48 85 c0             	test   %rax,%rax
+  804851:	75 d2                	jne    804825 <memmove+0x1d2>
+  return dst;
+  804853:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804857:	c9                   	leave
+  804858:	c3                   	ret
+
+0000000000804859 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804859:	55                   	push   %rbp
+  80485a:	48 89 e5             	mov    %rsp,%rbp
+  80485d:	48 83 ec 18          	sub    $0x18,%rsp
+  804861:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804865:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804869:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80486d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804871:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804879:	48 89 ce             	mov    %rcx,%rsi
+  80487c:	48 89 c7             	mov    %rax,%rdi
+  80487f:	48 b8 53 46 80 00 00 	movabs $0x804653,%rax
+  804886:	00 00 00 
+  804889:	ff d0                	call   *%rax
+}
+  80488b:	c9                   	leave
+  80488c:	c3                   	ret
+
+000000000080488d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80488d:	55                   	push   %rbp
+  80488e:	48 89 e5             	mov    %rsp,%rbp
+  804891:	48 83 ec 40          	sub    $0x40,%rsp
+  804895:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804899:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80489d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8048a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048b1:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048b6:	0f 86 a7 00 00 00    	jbe    804963 <memcmp+0xd6>
+  8048bc:	48 b8 ac 3c 80 00 00 	movabs $0x803cac,%rax
+  8048c3:	00 00 00 
+  8048c6:	ff d0                	call   *%rax
+  8048c8:	83 e0 02             	and    $0x2,%eax
+  8048cb:	85 c0                	test   %eax,%eax
+  8048cd:	0f 84 90 00 00 00    	je     804963 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048d3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048d7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048df:	48 89 ce             	mov    %rcx,%rsi
+  8048e2:	48 89 c7             	mov    %rax,%rdi
+  8048e5:	48 b8 74 3e 80 00 00 	movabs $0x803e74,%rax
+  8048ec:	00 00 00 
+  8048ef:	ff d0                	call   *%rax
+  8048f1:	e9 c2 00 00 00       	jmp    8049b8 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048fa:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048fe:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804902:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804906:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80490a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80490e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804912:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804915:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  80491c:	74 36                	je     804954 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80491e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804921:	f7 d0                	not    %eax
+  804923:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804927:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80492a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80492d:	48 63 d0             	movslq %eax,%rdx
+  804930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804934:	48 01 d0             	add    %rdx,%rax
+  804937:	0f b6 00             	movzbl (%rax),%eax
+  80493a:	0f b6 c0             	movzbl %al,%eax
+  80493d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804940:	48 63 ca             	movslq %edx,%rcx
+  804943:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804947:	48 01 ca             	add    %rcx,%rdx
+  80494a:	0f b6 12             	movzbl (%rdx),%edx
+  80494d:	0f b6 d2             	movzbl %dl,%edx
+  804950:	29 d0                	sub    %edx,%eax
+  804952:	eb 64                	jmp    8049b8 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804954:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804959:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80495e:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  804963:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804968:	77 8c                	ja     8048f6 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80496a:	eb 36                	jmp    8049a2 <memcmp+0x115>
+    if (*s1 != *s2)
+  80496c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804970:	0f b6 10             	movzbl (%rax),%edx
+  804973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804977:	0f b6 00             	movzbl (%rax),%eax
+  80497a:	38 c2                	cmp    %al,%dl
+  80497c:	74 1a                	je     804998 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80497e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804982:	0f b6 00             	movzbl (%rax),%eax
+  804985:	0f b6 c8             	movzbl %al,%ecx
+  804988:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80498c:	0f b6 00             	movzbl (%rax),%eax
+  80498f:	0f b6 d0             	movzbl %al,%edx
+  804992:	89 c8                	mov    %ecx,%eax
+  804994:	29 d0                	sub    %edx,%eax
+  804996:	eb 20                	jmp    8049b8 <memcmp+0x12b>
+    s1++, s2++;
+  804998:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80499d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8049a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049ae:	48 85 c0             	test   %rax,%rax
+  8049b1:	75 b9                	jne    80496c <memcmp+0xdf>
+  }
+
+  return 0;
+  8049b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049b8:	c9                   	leave
+  8049b9:	c3                   	ret
+
+00000000008049ba <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049ba:	55                   	push   %rbp
+  8049bb:	48 89 e5             	mov    %rsp,%rbp
+  8049be:	48 83 ec 50          	sub    $0x50,%rsp
+  8049c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049c6:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049c9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049cd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049d1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049d5:	48 01 d0             	add    %rdx,%rax
+  8049d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049dc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049df:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049e3:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049e7:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049eb:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049f0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049f4:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049f9:	76 73                	jbe    804a6e <memfind+0xb4>
+  8049fb:	48 b8 ac 3c 80 00 00 	movabs $0x803cac,%rax
+  804a02:	00 00 00 
+  804a05:	ff d0                	call   *%rax
+  804a07:	83 e0 02             	and    $0x2,%eax
+  804a0a:	85 c0                	test   %eax,%eax
+  804a0c:	74 60                	je     804a6e <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a0e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a11:	0f b6 c8             	movzbl %al,%ecx
+  804a14:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1c:	89 ce                	mov    %ecx,%esi
+  804a1e:	48 89 c7             	mov    %rax,%rdi
+  804a21:	48 b8 63 3f 80 00 00 	movabs $0x803f63,%rax
+  804a28:	00 00 00 
+  804a2b:	ff d0                	call   *%rax
+  804a2d:	eb 6c                	jmp    804a9b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a33:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a37:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a3b:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a40:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a44:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a48:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a4b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a4f:	74 13                	je     804a64 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a51:	31 c0                	xor    %eax,%eax
+  804a53:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a58:	48 63 d0             	movslq %eax,%rdx
+  804a5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a5f:	48 01 d0             	add    %rdx,%rax
+  804a62:	eb 37                	jmp    804a9b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a64:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a69:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a6e:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a73:	77 ba                	ja     804a2f <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a75:	eb 13                	jmp    804a8a <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a7b:	0f b6 00             	movzbl (%rax),%eax
+  804a7e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a81:	38 d0                	cmp    %dl,%al
+  804a83:	74 11                	je     804a96 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a85:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a8e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a92:	72 e3                	jb     804a77 <memfind+0xbd>
+  804a94:	eb 01                	jmp    804a97 <memfind+0xdd>
+      break;
+  804a96:	90                   	nop
+  return (void *)s;
+  804a97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a9b:	c9                   	leave
+  804a9c:	c3                   	ret
+
+0000000000804a9d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a9d:	55                   	push   %rbp
+  804a9e:	48 89 e5             	mov    %rsp,%rbp
+  804aa1:	48 83 ec 38          	sub    $0x38,%rsp
+  804aa5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804aa9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804aad:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804ab0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804ab7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804abe:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804abf:	eb 05                	jmp    804ac6 <strtol+0x29>
+    s++;
+  804ac1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ac6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aca:	0f b6 00             	movzbl (%rax),%eax
+  804acd:	3c 20                	cmp    $0x20,%al
+  804acf:	74 f0                	je     804ac1 <strtol+0x24>
+  804ad1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad5:	0f b6 00             	movzbl (%rax),%eax
+  804ad8:	3c 09                	cmp    $0x9,%al
+  804ada:	74 e5                	je     804ac1 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804adc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae0:	0f b6 00             	movzbl (%rax),%eax
+  804ae3:	3c 2b                	cmp    $0x2b,%al
+  804ae5:	75 07                	jne    804aee <strtol+0x51>
+    s++;
+  804ae7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804aec:	eb 17                	jmp    804b05 <strtol+0x68>
+  else if (*s == '-')
+  804aee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804af2:	0f b6 00             	movzbl (%rax),%eax
+  804af5:	3c 2d                	cmp    $0x2d,%al
+  804af7:	75 0c                	jne    804b05 <strtol+0x68>
+    s++, neg = 1;
+  804af9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804afe:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b05:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b09:	74 06                	je     804b11 <strtol+0x74>
+  804b0b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b0f:	75 28                	jne    804b39 <strtol+0x9c>
+  804b11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b15:	0f b6 00             	movzbl (%rax),%eax
+  804b18:	3c 30                	cmp    $0x30,%al
+  804b1a:	75 1d                	jne    804b39 <strtol+0x9c>
+  804b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b20:	48 83 c0 01          	add    $0x1,%rax
+  804b24:	0f b6 00             	movzbl (%rax),%eax
+  804b27:	3c 78                	cmp    $0x78,%al
+  804b29:	75 0e                	jne    804b39 <strtol+0x9c>
+    s += 2, base = 16;
+  804b2b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b30:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b37:	eb 2c                	jmp    804b65 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b39:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b3d:	75 19                	jne    804b58 <strtol+0xbb>
+  804b3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b43:	0f b6 00             	movzbl (%rax),%eax
+  804b46:	3c 30                	cmp    $0x30,%al
+  804b48:	75 0e                	jne    804b58 <strtol+0xbb>
+    s++, base = 8;
+  804b4a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b4f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b56:	eb 0d                	jmp    804b65 <strtol+0xc8>
+  else if (base == 0)
+  804b58:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b5c:	75 07                	jne    804b65 <strtol+0xc8>
+    base = 10;
+  804b5e:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b69:	0f b6 00             	movzbl (%rax),%eax
+  804b6c:	3c 2f                	cmp    $0x2f,%al
+  804b6e:	7e 1d                	jle    804b8d <strtol+0xf0>
+  804b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b74:	0f b6 00             	movzbl (%rax),%eax
+  804b77:	3c 39                	cmp    $0x39,%al
+  804b79:	7f 12                	jg     804b8d <strtol+0xf0>
+      dig = *s - '0';
+  804b7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b7f:	0f b6 00             	movzbl (%rax),%eax
+  804b82:	0f be c0             	movsbl %al,%eax
+  804b85:	83 e8 30             	sub    $0x30,%eax
+  804b88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b8b:	eb 4e                	jmp    804bdb <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b91:	0f b6 00             	movzbl (%rax),%eax
+  804b94:	3c 60                	cmp    $0x60,%al
+  804b96:	7e 1d                	jle    804bb5 <strtol+0x118>
+  804b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b9c:	0f b6 00             	movzbl (%rax),%eax
+  804b9f:	3c 7a                	cmp    $0x7a,%al
+  804ba1:	7f 12                	jg     804bb5 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804ba3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba7:	0f b6 00             	movzbl (%rax),%eax
+  804baa:	0f be c0             	movsbl %al,%eax
+  804bad:	83 e8 57             	sub    $0x57,%eax
+  804bb0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bb3:	eb 26                	jmp    804bdb <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb9:	0f b6 00             	movzbl (%rax),%eax
+  804bbc:	3c 40                	cmp    $0x40,%al
+  804bbe:	7e 47                	jle    804c07 <strtol+0x16a>
+  804bc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc4:	0f b6 00             	movzbl (%rax),%eax
+  804bc7:	3c 5a                	cmp    $0x5a,%al
+  804bc9:	7f 3c                	jg     804c07 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bcf:	0f b6 00             	movzbl (%rax),%eax
+  804bd2:	0f be c0             	movsbl %al,%eax
+  804bd5:	83 e8 37             	sub    $0x37,%eax
+  804bd8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bde:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804be1:	7d 23                	jge    804c06 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804be3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804be8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804beb:	48 98                	cltq
+  804bed:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bf2:	48 89 c2             	mov    %rax,%rdx
+  804bf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bf8:	48 98                	cltq
+  804bfa:	48 01 d0             	add    %rdx,%rax
+  804bfd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c01:	e9 5f ff ff ff       	jmp    804b65 <strtol+0xc8>
+      break;
+  804c06:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c07:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c0c:	74 0b                	je     804c19 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c12:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c16:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c19:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c1d:	74 09                	je     804c28 <strtol+0x18b>
+  804c1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c23:	48 f7 d8             	neg    %rax
+  804c26:	eb 04                	jmp    804c2c <strtol+0x18f>
+  804c28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c2c:	c9                   	leave
+  804c2d:	c3                   	ret
+
+0000000000804c2e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c2e:	55                   	push   %rbp
+  804c2f:	48 89 e5             	mov    %rsp,%rbp
+  804c32:	48 83 ec 20          	sub    $0x20,%rsp
+  804c36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c3e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c46:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c4e:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c55:	48 89 c7             	mov    %rax,%rdi
+  804c58:	48 b8 66 4c 80 00 00 	movabs $0x804c66,%rax
+  804c5f:	00 00 00 
+  804c62:	ff d0                	call   *%rax
+}
+  804c64:	c9                   	leave
+  804c65:	c3                   	ret
+
+0000000000804c66 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c66:	55                   	push   %rbp
+  804c67:	48 89 e5             	mov    %rsp,%rbp
+  804c6a:	48 83 ec 30          	sub    $0x30,%rsp
+  804c6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c72:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c76:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c7a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c7e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c83:	75 0e                	jne    804c93 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c85:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c8c:	00 00 00 
+  804c8f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c93:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c98:	75 18                	jne    804cb2 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c9e:	48 89 c7             	mov    %rax,%rdi
+  804ca1:	48 b8 f1 05 80 00 00 	movabs $0x8005f1,%rax
+  804ca8:	00 00 00 
+  804cab:	ff d0                	call   *%rax
+  804cad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cb0:	eb 1d                	jmp    804ccf <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cb2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cba:	48 89 d6             	mov    %rdx,%rsi
+  804cbd:	48 89 c7             	mov    %rax,%rdi
+  804cc0:	48 b8 37 06 80 00 00 	movabs $0x800637,%rax
+  804cc7:	00 00 00 
+  804cca:	ff d0                	call   *%rax
+  804ccc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804ccf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cd3:	79 2a                	jns    804cff <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cd5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cda:	74 0a                	je     804ce6 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ce0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804ce6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ceb:	74 0a                	je     804cf7 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804ced:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cf1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804cf7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cfa:	e9 aa 00 00 00       	jmp    804da9 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804cff:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d04:	74 36                	je     804d3c <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d06:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d0d:	00 00 00 
+  804d10:	8b 40 04             	mov    0x4(%rax),%eax
+  804d13:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d18:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d1f:	00 00 00 
+  804d22:	48 98                	cltq
+  804d24:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d2b:	48 01 d0             	add    %rdx,%rax
+  804d2e:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d34:	8b 10                	mov    (%rax),%edx
+  804d36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3a:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d3c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d41:	74 36                	je     804d79 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d43:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d4a:	00 00 00 
+  804d4d:	8b 40 04             	mov    0x4(%rax),%eax
+  804d50:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d55:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d5c:	00 00 00 
+  804d5f:	48 98                	cltq
+  804d61:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d68:	48 01 d0             	add    %rdx,%rax
+  804d6b:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d71:	8b 10                	mov    (%rax),%edx
+  804d73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d77:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d79:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d80:	00 00 00 
+  804d83:	8b 40 04             	mov    0x4(%rax),%eax
+  804d86:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d8b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d92:	00 00 00 
+  804d95:	48 98                	cltq
+  804d97:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d9e:	48 01 d0             	add    %rdx,%rax
+  804da1:	48 05 20 01 00 00    	add    $0x120,%rax
+  804da7:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804da9:	c9                   	leave
+  804daa:	c3                   	ret
+
+0000000000804dab <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dab:	55                   	push   %rbp
+  804dac:	48 89 e5             	mov    %rsp,%rbp
+  804daf:	48 83 ec 30          	sub    $0x30,%rsp
+  804db3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804db6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804db9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dbd:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dc0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dc5:	75 5e                	jne    804e25 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dc7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dce:	00 00 00 
+  804dd1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dd5:	eb 4e                	jmp    804e25 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dd7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ddb:	79 3c                	jns    804e19 <ipc_send+0x6e>
+  804ddd:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804de1:	74 36                	je     804e19 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804de3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804de6:	89 c1                	mov    %eax,%ecx
+  804de8:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804def:	00 00 00 
+  804df2:	48 89 c2             	mov    %rax,%rdx
+  804df5:	be 54 00 00 00       	mov    $0x54,%esi
+  804dfa:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804e01:	00 00 00 
+  804e04:	48 89 c7             	mov    %rax,%rdi
+  804e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e0c:	49 b8 41 2f 80 00 00 	movabs $0x802f41,%r8
+  804e13:	00 00 00 
+  804e16:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e19:	48 b8 74 03 80 00 00 	movabs $0x800374,%rax
+  804e20:	00 00 00 
+  804e23:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e25:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e28:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e2b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e32:	89 c7                	mov    %eax,%edi
+  804e34:	48 b8 9a 05 80 00 00 	movabs $0x80059a,%rax
+  804e3b:	00 00 00 
+  804e3e:	ff d0                	call   *%rax
+  804e40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e47:	75 8e                	jne    804dd7 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e49:	48 b8 74 03 80 00 00 	movabs $0x800374,%rax
+  804e50:	00 00 00 
+  804e53:	ff d0                	call   *%rax
+}
+  804e55:	90                   	nop
+  804e56:	c9                   	leave
+  804e57:	c3                   	ret
+
+0000000000804e58 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e58:	55                   	push   %rbp
+  804e59:	48 89 e5             	mov    %rsp,%rbp
+  804e5c:	48 83 ec 18          	sub    $0x18,%rsp
+  804e60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e63:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e6a:	eb 4d                	jmp    804eb9 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e6c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e73:	00 00 00 
+  804e76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e79:	48 98                	cltq
+  804e7b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e82:	48 01 d0             	add    %rdx,%rax
+  804e85:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e8b:	8b 00                	mov    (%rax),%eax
+  804e8d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e90:	75 23                	jne    804eb5 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e92:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e99:	00 00 00 
+  804e9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e9f:	48 98                	cltq
+  804ea1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ea8:	48 01 d0             	add    %rdx,%rax
+  804eab:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804eb1:	8b 00                	mov    (%rax),%eax
+  804eb3:	eb 12                	jmp    804ec7 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804eb5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804eb9:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ec0:	7e aa                	jle    804e6c <ipc_find_env+0x14>
+  return 0;
+  804ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ec7:	c9                   	leave
+  804ec8:	c3                   	ret
+
+0000000000804ec9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ec9:	55                   	push   %rbp
+  804eca:	48 89 e5             	mov    %rsp,%rbp
+  804ecd:	48 83 ec 18          	sub    $0x18,%rsp
+  804ed1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ed5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed9:	48 c1 e8 27          	shr    $0x27,%rax
+  804edd:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ee2:	48 89 c2             	mov    %rax,%rdx
+  804ee5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804eec:	01 00 00 
+  804eef:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ef3:	83 e0 01             	and    $0x1,%eax
+  804ef6:	48 85 c0             	test   %rax,%rax
+  804ef9:	74 63                	je     804f5e <pageref+0x95>
+  804efb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eff:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f03:	48 89 c2             	mov    %rax,%rdx
+  804f06:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f0d:	01 00 00 
+  804f10:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f14:	83 e0 01             	and    $0x1,%eax
+  804f17:	48 85 c0             	test   %rax,%rax
+  804f1a:	74 42                	je     804f5e <pageref+0x95>
+  804f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f20:	48 c1 e8 15          	shr    $0x15,%rax
+  804f24:	48 89 c2             	mov    %rax,%rdx
+  804f27:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f2e:	01 00 00 
+  804f31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f35:	83 e0 01             	and    $0x1,%eax
+  804f38:	48 85 c0             	test   %rax,%rax
+  804f3b:	74 21                	je     804f5e <pageref+0x95>
+  804f3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f41:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f45:	48 89 c2             	mov    %rax,%rdx
+  804f48:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f4f:	01 00 00 
+  804f52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f56:	83 e0 01             	and    $0x1,%eax
+  804f59:	48 85 c0             	test   %rax,%rax
+  804f5c:	75 07                	jne    804f65 <pageref+0x9c>
+    return 0;
+  804f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f63:	eb 53                	jmp    804fb8 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f69:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f6d:	48 89 c2             	mov    %rax,%rdx
+  804f70:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f77:	01 00 00 
+  804f7a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f86:	83 e0 01             	and    $0x1,%eax
+  804f89:	48 85 c0             	test   %rax,%rax
+  804f8c:	75 07                	jne    804f95 <pageref+0xcc>
+    return 0;
+  804f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f93:	eb 23                	jmp    804fb8 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f99:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f9d:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fa4:	00 00 00 
+  804fa7:	48 c1 e0 04          	shl    $0x4,%rax
+  804fab:	48 01 d0             	add    %rdx,%rax
+  804fae:	48 83 c0 08          	add    $0x8,%rax
+  804fb2:	0f b7 00             	movzwl (%rax),%eax
+  804fb5:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fb8:	c9                   	leave
+  804fb9:	c3                   	ret
+  804fba:	66 90                	xchg   %ax,%ax
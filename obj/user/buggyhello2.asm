@@ -0,0 +1,8047 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 39 00 00 00       	call   800065 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  sys_cputs(hello, 1024 * 1024);
+  800041:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800048:	00 00 00 
+  80004b:	48 8b 00             	mov    (%rax),%rax
+  80004e:	be 00 00 10 00       	mov    $0x100000,%esi
+  800053:	48 89 c7             	mov    %rax,%rdi
+  800056:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  80005d:	00 00 00 
+  800060:	ff d0                	call   *%rax
+}
+  800062:	90                   	nop
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+0000000000800065 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800065:	55                   	push   %rbp
+  800066:	48 89 e5             	mov    %rsp,%rbp
+  800069:	48 83 ec 20          	sub    $0x20,%rsp
+  80006d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800070:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800074:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80007b:	00 00 00 
+  80007e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800082:	eb 13                	jmp    800097 <libmain+0x32>
+    (*ctor)();
+  800084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800088:	48 8b 10             	mov    (%rax),%rdx
+  80008b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800090:	ff d2                	call   *%rdx
+    ctor++;
+  800092:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800097:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80009e:	00 00 00 
+  8000a1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000a5:	72 dd                	jb     800084 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000ab:	7e 14                	jle    8000c1 <libmain+0x5c>
+    binaryname = argv[0];
+  8000ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000b1:	48 8b 00             	mov    (%rax),%rax
+  8000b4:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  8000bb:	00 00 00 
+  8000be:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000c8:	48 89 d6             	mov    %rdx,%rsi
+  8000cb:	89 c7                	mov    %eax,%edi
+  8000cd:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000d4:	00 00 00 
+  8000d7:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000d9:	48 b8 e8 00 80 00 00 	movabs $0x8000e8,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+#endif
+}
+  8000e5:	90                   	nop
+  8000e6:	c9                   	leave
+  8000e7:	c3                   	ret
+
+00000000008000e8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e8:	55                   	push   %rbp
+  8000e9:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000ec:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fd:	48 b8 74 02 80 00 00 	movabs $0x800274,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+}
+  800109:	90                   	nop
+  80010a:	5d                   	pop    %rbp
+  80010b:	c3                   	ret
+
+000000000080010c <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80010c:	55                   	push   %rbp
+  80010d:	48 89 e5             	mov    %rsp,%rbp
+  800110:	53                   	push   %rbx
+  800111:	48 83 ec 48          	sub    $0x48,%rsp
+  800115:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800119:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80011d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800121:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800125:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800129:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80012d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800131:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800135:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800139:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80013d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800141:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800145:	4c 89 c3             	mov    %r8,%rbx
+  800148:	cd 30                	int    $0x30
+  80014a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80014e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800153:	74 46                	je     80019b <syscall+0x8f>
+  800155:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80015a:	7e 3f                	jle    80019b <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80015c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800160:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800164:	49 89 d0             	mov    %rdx,%r8
+  800167:	48 89 c1             	mov    %rax,%rcx
+  80016a:	48 b8 f8 4f 80 00 00 	movabs $0x804ff8,%rax
+  800171:	00 00 00 
+  800174:	48 89 c2             	mov    %rax,%rdx
+  800177:	be 22 00 00 00       	mov    $0x22,%esi
+  80017c:	48 b8 17 50 80 00 00 	movabs $0x805017,%rax
+  800183:	00 00 00 
+  800186:	48 89 c7             	mov    %rax,%rdi
+  800189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018e:	49 b9 4c 2f 80 00 00 	movabs $0x802f4c,%r9
+  800195:	00 00 00 
+  800198:	41 ff d1             	call   *%r9
+
+  return ret;
+  80019b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80019f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+
+00000000008001a5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001a5:	55                   	push   %rbp
+  8001a6:	48 89 e5             	mov    %rsp,%rbp
+  8001a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8001ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c1:	6a 00                	push   $0x0
+  8001c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001cf:	48 89 d1             	mov    %rdx,%rcx
+  8001d2:	48 89 c2             	mov    %rax,%rdx
+  8001d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8001da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001df:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+  8001eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001ef:	90                   	nop
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+00000000008001f2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001f2:	55                   	push   %rbp
+  8001f3:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800202:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800208:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80020d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800212:	be 00 00 00 00       	mov    $0x0,%esi
+  800217:	bf 01 00 00 00       	mov    $0x1,%edi
+  80021c:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800223:	00 00 00 
+  800226:	ff d0                	call   *%rax
+  800228:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+000000000080022e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	48 83 ec 10          	sub    $0x10,%rsp
+  800236:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800239:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80023c:	48 98                	cltq
+  80023e:	48 83 ec 08          	sub    $0x8,%rsp
+  800242:	6a 00                	push   $0x0
+  800244:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80024a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800255:	48 89 c2             	mov    %rax,%rdx
+  800258:	be 01 00 00 00       	mov    $0x1,%esi
+  80025d:	bf 03 00 00 00       	mov    $0x3,%edi
+  800262:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+  80026e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800272:	c9                   	leave
+  800273:	c3                   	ret
+
+0000000000800274 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800274:	55                   	push   %rbp
+  800275:	48 89 e5             	mov    %rsp,%rbp
+  800278:	48 83 ec 10          	sub    $0x10,%rsp
+  80027c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80027f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800282:	48 98                	cltq
+  800284:	48 83 ec 08          	sub    $0x8,%rsp
+  800288:	6a 00                	push   $0x0
+  80028a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800296:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80029b:	48 89 c2             	mov    %rax,%rdx
+  80029e:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002a8:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8002af:	00 00 00 
+  8002b2:	ff d0                	call   *%rax
+  8002b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002b8:	90                   	nop
+  8002b9:	c9                   	leave
+  8002ba:	c3                   	ret
+
+00000000008002bb <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002bb:	55                   	push   %rbp
+  8002bc:	48 89 e5             	mov    %rsp,%rbp
+  8002bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8002c3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002cd:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002d0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002d5:	cd 30                	int    $0x30
+  8002d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002db:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002e4:	7e 3d                	jle    800323 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002ea:	49 89 c0             	mov    %rax,%r8
+  8002ed:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002f2:	48 b8 f8 4f 80 00 00 	movabs $0x804ff8,%rax
+  8002f9:	00 00 00 
+  8002fc:	48 89 c2             	mov    %rax,%rdx
+  8002ff:	be 49 00 00 00       	mov    $0x49,%esi
+  800304:	48 b8 17 50 80 00 00 	movabs $0x805017,%rax
+  80030b:	00 00 00 
+  80030e:	48 89 c7             	mov    %rax,%rdi
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 4c 2f 80 00 00 	movabs $0x802f4c,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800323:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800328:	75 13                	jne    80033d <sys_env_wait+0x82>
+  80032a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80032f:	74 0c                	je     80033d <sys_env_wait+0x82>
+    *status = st;
+  800331:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800335:	89 c2                	mov    %eax,%edx
+  800337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80033b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80033d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800341:	c9                   	leave
+  800342:	c3                   	ret
+
+0000000000800343 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800347:	48 83 ec 08          	sub    $0x8,%rsp
+  80034b:	6a 00                	push   $0x0
+  80034d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800353:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800359:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80035e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800363:	be 00 00 00 00       	mov    $0x0,%esi
+  800368:	bf 02 00 00 00       	mov    $0x2,%edi
+  80036d:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800374:	00 00 00 
+  800377:	ff d0                	call   *%rax
+  800379:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+
+000000000080037f <sys_yield>:
+
+void
+sys_yield(void) {
+  80037f:	55                   	push   %rbp
+  800380:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800383:	48 83 ec 08          	sub    $0x8,%rsp
+  800387:	6a 00                	push   $0x0
+  800389:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80038f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800395:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80039a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039f:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003a9:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8003b0:	00 00 00 
+  8003b3:	ff d0                	call   *%rax
+  8003b5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003b9:	90                   	nop
+  8003ba:	c9                   	leave
+  8003bb:	c3                   	ret
+
+00000000008003bc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8003c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003cb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003d1:	48 63 c8             	movslq %eax,%rcx
+  8003d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003db:	48 98                	cltq
+  8003dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e1:	6a 00                	push   $0x0
+  8003e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003e9:	49 89 c8             	mov    %rcx,%r8
+  8003ec:	48 89 d1             	mov    %rdx,%rcx
+  8003ef:	48 89 c2             	mov    %rax,%rdx
+  8003f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003f7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003fc:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800403:	00 00 00 
+  800406:	ff d0                	call   *%rax
+  800408:	48 83 c4 10          	add    $0x10,%rsp
+  80040c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80040f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+
+0000000000800414 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800414:	55                   	push   %rbp
+  800415:	48 89 e5             	mov    %rsp,%rbp
+  800418:	48 83 ec 20          	sub    $0x20,%rsp
+  80041c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80041f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800423:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800426:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80042e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800431:	48 63 c8             	movslq %eax,%rcx
+  800434:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800438:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80043b:	48 63 f0             	movslq %eax,%rsi
+  80043e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800442:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800445:	48 98                	cltq
+  800447:	48 83 ec 08          	sub    $0x8,%rsp
+  80044b:	51                   	push   %rcx
+  80044c:	49 89 f9             	mov    %rdi,%r9
+  80044f:	49 89 f0             	mov    %rsi,%r8
+  800452:	48 89 d1             	mov    %rdx,%rcx
+  800455:	48 89 c2             	mov    %rax,%rdx
+  800458:	be 01 00 00 00       	mov    $0x1,%esi
+  80045d:	bf 07 00 00 00       	mov    $0x7,%edi
+  800462:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+  80046e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800472:	c9                   	leave
+  800473:	c3                   	ret
+
+0000000000800474 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800474:	55                   	push   %rbp
+  800475:	48 89 e5             	mov    %rsp,%rbp
+  800478:	48 83 ec 10          	sub    $0x10,%rsp
+  80047c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80047f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800483:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800487:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80048a:	48 98                	cltq
+  80048c:	48 83 ec 08          	sub    $0x8,%rsp
+  800490:	6a 00                	push   $0x0
+  800492:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80049e:	48 89 d1             	mov    %rdx,%rcx
+  8004a1:	48 89 c2             	mov    %rax,%rdx
+  8004a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8004a9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004ae:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8004b5:	00 00 00 
+  8004b8:	ff d0                	call   *%rax
+  8004ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004be:	c9                   	leave
+  8004bf:	c3                   	ret
+
+00000000008004c0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c0:	55                   	push   %rbp
+  8004c1:	48 89 e5             	mov    %rsp,%rbp
+  8004c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8004c8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004cb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004ce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004d1:	48 63 d0             	movslq %eax,%rdx
+  8004d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004d7:	48 98                	cltq
+  8004d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004dd:	6a 00                	push   $0x0
+  8004df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004eb:	48 89 d1             	mov    %rdx,%rcx
+  8004ee:	48 89 c2             	mov    %rax,%rdx
+  8004f1:	be 01 00 00 00       	mov    $0x1,%esi
+  8004f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004fb:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800502:	00 00 00 
+  800505:	ff d0                	call   *%rax
+  800507:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80050b:	c9                   	leave
+  80050c:	c3                   	ret
+
+000000000080050d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80050d:	55                   	push   %rbp
+  80050e:	48 89 e5             	mov    %rsp,%rbp
+  800511:	48 83 ec 10          	sub    $0x10,%rsp
+  800515:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800518:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80051c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800523:	48 98                	cltq
+  800525:	48 83 ec 08          	sub    $0x8,%rsp
+  800529:	6a 00                	push   $0x0
+  80052b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800531:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800537:	48 89 d1             	mov    %rdx,%rcx
+  80053a:	48 89 c2             	mov    %rax,%rdx
+  80053d:	be 01 00 00 00       	mov    $0x1,%esi
+  800542:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800547:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80054e:	00 00 00 
+  800551:	ff d0                	call   *%rax
+  800553:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+
+0000000000800559 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800559:	55                   	push   %rbp
+  80055a:	48 89 e5             	mov    %rsp,%rbp
+  80055d:	48 83 ec 10          	sub    $0x10,%rsp
+  800561:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800564:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800568:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80056c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80056f:	48 98                	cltq
+  800571:	48 83 ec 08          	sub    $0x8,%rsp
+  800575:	6a 00                	push   $0x0
+  800577:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80057d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800583:	48 89 d1             	mov    %rdx,%rcx
+  800586:	48 89 c2             	mov    %rax,%rdx
+  800589:	be 01 00 00 00       	mov    $0x1,%esi
+  80058e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800593:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80059a:	00 00 00 
+  80059d:	ff d0                	call   *%rax
+  80059f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005a3:	c9                   	leave
+  8005a4:	c3                   	ret
+
+00000000008005a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005a5:	55                   	push   %rbp
+  8005a6:	48 89 e5             	mov    %rsp,%rbp
+  8005a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8005ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005b8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005bb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005be:	48 63 f0             	movslq %eax,%rsi
+  8005c1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005cc:	48 98                	cltq
+  8005ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d2:	6a 00                	push   $0x0
+  8005d4:	49 89 f1             	mov    %rsi,%r9
+  8005d7:	49 89 c8             	mov    %rcx,%r8
+  8005da:	48 89 d1             	mov    %rdx,%rcx
+  8005dd:	48 89 c2             	mov    %rax,%rdx
+  8005e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005ea:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8005f1:	00 00 00 
+  8005f4:	ff d0                	call   *%rax
+  8005f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005fa:	c9                   	leave
+  8005fb:	c3                   	ret
+
+00000000008005fc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005fc:	55                   	push   %rbp
+  8005fd:	48 89 e5             	mov    %rsp,%rbp
+  800600:	48 83 ec 10          	sub    $0x10,%rsp
+  800604:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  800608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060c:	48 83 ec 08          	sub    $0x8,%rsp
+  800610:	6a 00                	push   $0x0
+  800612:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80061e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800623:	48 89 c2             	mov    %rax,%rdx
+  800626:	be 01 00 00 00       	mov    $0x1,%esi
+  80062b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800630:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+  80063c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800640:	c9                   	leave
+  800641:	c3                   	ret
+
+0000000000800642 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800642:	55                   	push   %rbp
+  800643:	48 89 e5             	mov    %rsp,%rbp
+  800646:	48 83 ec 10          	sub    $0x10,%rsp
+  80064a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80064e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800652:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800656:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80065a:	48 83 ec 08          	sub    $0x8,%rsp
+  80065e:	6a 00                	push   $0x0
+  800660:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800666:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80066c:	48 89 d1             	mov    %rdx,%rcx
+  80066f:	48 89 c2             	mov    %rax,%rdx
+  800672:	be 01 00 00 00       	mov    $0x1,%esi
+  800677:	bf 10 00 00 00       	mov    $0x10,%edi
+  80067c:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800683:	00 00 00 
+  800686:	ff d0                	call   *%rax
+  800688:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80068c:	c9                   	leave
+  80068d:	c3                   	ret
+
+000000000080068e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80068e:	55                   	push   %rbp
+  80068f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800692:	48 83 ec 08          	sub    $0x8,%rsp
+  800696:	6a 00                	push   $0x0
+  800698:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80069e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b3:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006b8:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+  8006c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006c8:	c9                   	leave
+  8006c9:	c3                   	ret
+
+00000000008006ca <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006ca:	55                   	push   %rbp
+  8006cb:	48 89 e5             	mov    %rsp,%rbp
+  8006ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8006d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006da:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e6:	6a 00                	push   $0x0
+  8006e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006f4:	48 89 d1             	mov    %rdx,%rcx
+  8006f7:	48 89 c2             	mov    %rax,%rdx
+  8006fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ff:	bf 12 00 00 00       	mov    $0x12,%edi
+  800704:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80070b:	00 00 00 
+  80070e:	ff d0                	call   *%rax
+  800710:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800714:	c9                   	leave
+  800715:	c3                   	ret
+
+0000000000800716 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800716:	55                   	push   %rbp
+  800717:	48 89 e5             	mov    %rsp,%rbp
+  80071a:	48 83 ec 20          	sub    $0x20,%rsp
+  80071e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800722:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800726:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800729:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80072c:	48 63 c8             	movslq %eax,%rcx
+  80072f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800737:	48 83 ec 08          	sub    $0x8,%rsp
+  80073b:	6a 00                	push   $0x0
+  80073d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800743:	49 89 c8             	mov    %rcx,%r8
+  800746:	48 89 d1             	mov    %rdx,%rcx
+  800749:	48 89 c2             	mov    %rax,%rdx
+  80074c:	be 00 00 00 00       	mov    $0x0,%esi
+  800751:	bf 13 00 00 00       	mov    $0x13,%edi
+  800756:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800766:	c9                   	leave
+  800767:	c3                   	ret
+
+0000000000800768 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800768:	55                   	push   %rbp
+  800769:	48 89 e5             	mov    %rsp,%rbp
+  80076c:	48 83 ec 20          	sub    $0x20,%rsp
+  800770:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800774:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800777:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80077b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80077f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800786:	48 83 ec 08          	sub    $0x8,%rsp
+  80078a:	6a 00                	push   $0x0
+  80078c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800792:	49 89 c8             	mov    %rcx,%r8
+  800795:	48 89 d1             	mov    %rdx,%rcx
+  800798:	48 89 c2             	mov    %rax,%rdx
+  80079b:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007a5:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8007ac:	00 00 00 
+  8007af:	ff d0                	call   *%rax
+  8007b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007b5:	c9                   	leave
+  8007b6:	c3                   	ret
+
+00000000008007b7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007b7:	55                   	push   %rbp
+  8007b8:	48 89 e5             	mov    %rsp,%rbp
+  8007bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8007bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007c9:	48 63 d0             	movslq %eax,%rdx
+  8007cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8007d4:	6a 00                	push   $0x0
+  8007d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007e2:	48 89 d1             	mov    %rdx,%rcx
+  8007e5:	48 89 c2             	mov    %rax,%rdx
+  8007e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ed:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007f2:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8007f9:	00 00 00 
+  8007fc:	ff d0                	call   *%rax
+  8007fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+
+0000000000800804 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  800804:	55                   	push   %rbp
+  800805:	48 89 e5             	mov    %rsp,%rbp
+  800808:	48 83 ec 20          	sub    $0x20,%rsp
+  80080c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800810:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800813:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800816:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80081a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80081e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800821:	48 63 c8             	movslq %eax,%rcx
+  800824:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800827:	48 63 d0             	movslq %eax,%rdx
+  80082a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082e:	48 83 ec 08          	sub    $0x8,%rsp
+  800832:	6a 00                	push   $0x0
+  800834:	49 89 f1             	mov    %rsi,%r9
+  800837:	49 89 c8             	mov    %rcx,%r8
+  80083a:	48 89 d1             	mov    %rdx,%rcx
+  80083d:	48 89 c2             	mov    %rax,%rdx
+  800840:	be 00 00 00 00       	mov    $0x0,%esi
+  800845:	bf 16 00 00 00       	mov    $0x16,%edi
+  80084a:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800851:	00 00 00 
+  800854:	ff d0                	call   *%rax
+  800856:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80085a:	c9                   	leave
+  80085b:	c3                   	ret
+
+000000000080085c <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80085c:	55                   	push   %rbp
+  80085d:	48 89 e5             	mov    %rsp,%rbp
+  800860:	48 83 ec 30          	sub    $0x30,%rsp
+  800864:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800868:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80086c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800870:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800874:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800878:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80087c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800880:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800884:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088c:	48 83 ec 08          	sub    $0x8,%rsp
+  800890:	51                   	push   %rcx
+  800891:	49 89 f9             	mov    %rdi,%r9
+  800894:	49 89 f0             	mov    %rsi,%r8
+  800897:	48 89 d1             	mov    %rdx,%rcx
+  80089a:	48 89 c2             	mov    %rax,%rdx
+  80089d:	be 00 00 00 00       	mov    $0x0,%esi
+  8008a2:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008a7:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8008ae:	00 00 00 
+  8008b1:	ff d0                	call   *%rax
+  8008b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008b7:	c9                   	leave
+  8008b8:	c3                   	ret
+
+00000000008008b9 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008b9:	55                   	push   %rbp
+  8008ba:	48 89 e5             	mov    %rsp,%rbp
+  8008bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8008c1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008c7:	48 98                	cltq
+  8008c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008cd:	6a 00                	push   $0x0
+  8008cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e0:	48 89 c2             	mov    %rax,%rdx
+  8008e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e8:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008ed:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8008f4:	00 00 00 
+  8008f7:	ff d0                	call   *%rax
+  8008f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008fd:	90                   	nop
+  8008fe:	c9                   	leave
+  8008ff:	c3                   	ret
+
+0000000000800900 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800900:	55                   	push   %rbp
+  800901:	48 89 e5             	mov    %rsp,%rbp
+  800904:	48 83 ec 30          	sub    $0x30,%rsp
+  800908:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80090b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80090f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800913:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800916:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800919:	48 63 f0             	movslq %eax,%rsi
+  80091c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800920:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800924:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800927:	48 98                	cltq
+  800929:	48 83 ec 08          	sub    $0x8,%rsp
+  80092d:	6a 00                	push   $0x0
+  80092f:	49 89 f1             	mov    %rsi,%r9
+  800932:	49 89 c8             	mov    %rcx,%r8
+  800935:	48 89 d1             	mov    %rdx,%rcx
+  800938:	48 89 c2             	mov    %rax,%rdx
+  80093b:	be 01 00 00 00       	mov    $0x1,%esi
+  800940:	bf 19 00 00 00       	mov    $0x19,%edi
+  800945:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  80094c:	00 00 00 
+  80094f:	ff d0                	call   *%rax
+  800951:	48 83 c4 10          	add    $0x10,%rsp
+  800955:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800958:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+000000000080095d <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80095d:	55                   	push   %rbp
+  80095e:	48 89 e5             	mov    %rsp,%rbp
+  800961:	48 83 ec 20          	sub    $0x20,%rsp
+  800965:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800969:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80096d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800970:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800973:	48 63 c8             	movslq %eax,%rcx
+  800976:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80097a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80097e:	48 83 ec 08          	sub    $0x8,%rsp
+  800982:	6a 00                	push   $0x0
+  800984:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80098a:	49 89 c8             	mov    %rcx,%r8
+  80098d:	48 89 d1             	mov    %rdx,%rcx
+  800990:	48 89 c2             	mov    %rax,%rdx
+  800993:	be 01 00 00 00       	mov    $0x1,%esi
+  800998:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80099d:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8009a4:	00 00 00 
+  8009a7:	ff d0                	call   *%rax
+  8009a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009ad:	c9                   	leave
+  8009ae:	c3                   	ret
+
+00000000008009af <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009af:	55                   	push   %rbp
+  8009b0:	48 89 e5             	mov    %rsp,%rbp
+  8009b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8009b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009c3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d3:	6a 00                	push   $0x0
+  8009d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009db:	49 89 c8             	mov    %rcx,%r8
+  8009de:	48 89 d1             	mov    %rdx,%rcx
+  8009e1:	48 89 c2             	mov    %rax,%rdx
+  8009e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8009e9:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009ee:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8009f5:	00 00 00 
+  8009f8:	ff d0                	call   *%rax
+  8009fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009fe:	c9                   	leave
+  8009ff:	c3                   	ret
+
+0000000000800a00 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a00:	55                   	push   %rbp
+  800a01:	48 89 e5             	mov    %rsp,%rbp
+  800a04:	48 83 ec 30          	sub    $0x30,%rsp
+  800a08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a0c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a10:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a13:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a17:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a1e:	48 63 c8             	movslq %eax,%rcx
+  800a21:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a29:	48 83 ec 08          	sub    $0x8,%rsp
+  800a2d:	6a 00                	push   $0x0
+  800a2f:	49 89 f1             	mov    %rsi,%r9
+  800a32:	49 89 c8             	mov    %rcx,%r8
+  800a35:	48 89 d1             	mov    %rdx,%rcx
+  800a38:	48 89 c2             	mov    %rax,%rdx
+  800a3b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a40:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a45:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800a4c:	00 00 00 
+  800a4f:	ff d0                	call   *%rax
+  800a51:	48 83 c4 10          	add    $0x10,%rsp
+  800a55:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a5b:	c9                   	leave
+  800a5c:	c3                   	ret
+
+0000000000800a5d <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a5d:	55                   	push   %rbp
+  800a5e:	48 89 e5             	mov    %rsp,%rbp
+  800a61:	48 83 ec 10          	sub    $0x10,%rsp
+  800a65:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a6b:	48 98                	cltq
+  800a6d:	48 83 ec 08          	sub    $0x8,%rsp
+  800a71:	6a 00                	push   $0x0
+  800a73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a84:	48 89 c2             	mov    %rax,%rdx
+  800a87:	be 01 00 00 00       	mov    $0x1,%esi
+  800a8c:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a91:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  800a98:	00 00 00 
+  800a9b:	ff d0                	call   *%rax
+  800a9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800aa1:	c9                   	leave
+  800aa2:	c3                   	ret
+
+0000000000800aa3 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800aa3:	55                   	push   %rbp
+  800aa4:	48 89 e5             	mov    %rsp,%rbp
+  800aa7:	48 83 ec 08          	sub    $0x8,%rsp
+  800aab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800aaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab3:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800aba:	ff ff ff 
+  800abd:	48 01 d0             	add    %rdx,%rax
+  800ac0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ac4:	c9                   	leave
+  800ac5:	c3                   	ret
+
+0000000000800ac6 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800ac6:	55                   	push   %rbp
+  800ac7:	48 89 e5             	mov    %rsp,%rbp
+  800aca:	48 83 ec 08          	sub    $0x8,%rsp
+  800ace:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ad2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ad6:	48 89 c7             	mov    %rax,%rdi
+  800ad9:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  800ae0:	00 00 00 
+  800ae3:	ff d0                	call   *%rax
+  800ae5:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800aeb:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800aef:	c9                   	leave
+  800af0:	c3                   	ret
+
+0000000000800af1 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800af1:	55                   	push   %rbp
+  800af2:	48 89 e5             	mov    %rsp,%rbp
+  800af5:	48 83 ec 18          	sub    $0x18,%rsp
+  800af9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800afd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b04:	e9 ae 00 00 00       	jmp    800bb7 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b0c:	c1 e0 0c             	shl    $0xc,%eax
+  800b0f:	48 98                	cltq
+  800b11:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b16:	48 01 d0             	add    %rdx,%rax
+  800b19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b21:	48 c1 e8 27          	shr    $0x27,%rax
+  800b25:	48 89 c2             	mov    %rax,%rdx
+  800b28:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b2f:	01 00 00 
+  800b32:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b36:	83 e0 01             	and    $0x1,%eax
+  800b39:	48 85 c0             	test   %rax,%rax
+  800b3c:	74 63                	je     800ba1 <fd_alloc+0xb0>
+  800b3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b42:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b46:	48 89 c2             	mov    %rax,%rdx
+  800b49:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b50:	01 00 00 
+  800b53:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b57:	83 e0 01             	and    $0x1,%eax
+  800b5a:	48 85 c0             	test   %rax,%rax
+  800b5d:	74 42                	je     800ba1 <fd_alloc+0xb0>
+  800b5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b63:	48 c1 e8 15          	shr    $0x15,%rax
+  800b67:	48 89 c2             	mov    %rax,%rdx
+  800b6a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b71:	01 00 00 
+  800b74:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b78:	83 e0 01             	and    $0x1,%eax
+  800b7b:	48 85 c0             	test   %rax,%rax
+  800b7e:	74 21                	je     800ba1 <fd_alloc+0xb0>
+  800b80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b84:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b88:	48 89 c2             	mov    %rax,%rdx
+  800b8b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b92:	01 00 00 
+  800b95:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b99:	83 e0 01             	and    $0x1,%eax
+  800b9c:	48 85 c0             	test   %rax,%rax
+  800b9f:	75 12                	jne    800bb3 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ba9:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb1:	eb 1e                	jmp    800bd1 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800bb3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800bb7:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800bbb:	0f 8e 48 ff ff ff    	jle    800b09 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bcc:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bd1:	c9                   	leave
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bd3:	55                   	push   %rbp
+  800bd4:	48 89 e5             	mov    %rsp,%rbp
+  800bd7:	48 83 ec 20          	sub    $0x20,%rsp
+  800bdb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bde:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800be2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800be6:	78 06                	js     800bee <fd_lookup+0x1b>
+  800be8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bec:	7e 0a                	jle    800bf8 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf3:	e9 af 00 00 00       	jmp    800ca7 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bf8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bfb:	c1 e0 0c             	shl    $0xc,%eax
+  800bfe:	48 98                	cltq
+  800c00:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c05:	48 01 d0             	add    %rdx,%rax
+  800c08:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c10:	48 c1 e8 27          	shr    $0x27,%rax
+  800c14:	48 89 c2             	mov    %rax,%rdx
+  800c17:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c1e:	01 00 00 
+  800c21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c25:	83 e0 01             	and    $0x1,%eax
+  800c28:	48 85 c0             	test   %rax,%rax
+  800c2b:	74 63                	je     800c90 <fd_lookup+0xbd>
+  800c2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c31:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c35:	48 89 c2             	mov    %rax,%rdx
+  800c38:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c3f:	01 00 00 
+  800c42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c46:	83 e0 01             	and    $0x1,%eax
+  800c49:	48 85 c0             	test   %rax,%rax
+  800c4c:	74 42                	je     800c90 <fd_lookup+0xbd>
+  800c4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c52:	48 c1 e8 15          	shr    $0x15,%rax
+  800c56:	48 89 c2             	mov    %rax,%rdx
+  800c59:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c60:	01 00 00 
+  800c63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c67:	83 e0 01             	and    $0x1,%eax
+  800c6a:	48 85 c0             	test   %rax,%rax
+  800c6d:	74 21                	je     800c90 <fd_lookup+0xbd>
+  800c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c73:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c77:	48 89 c2             	mov    %rax,%rdx
+  800c7a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c81:	01 00 00 
+  800c84:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c88:	83 e0 01             	and    $0x1,%eax
+  800c8b:	48 85 c0             	test   %rax,%rax
+  800c8e:	75 07                	jne    800c97 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c95:	eb 10                	jmp    800ca7 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c9f:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca7:	c9                   	leave
+  800ca8:	c3                   	ret
+
+0000000000800ca9 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800ca9:	55                   	push   %rbp
+  800caa:	48 89 e5             	mov    %rsp,%rbp
+  800cad:	48 83 ec 30          	sub    $0x30,%rsp
+  800cb1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800cb5:	89 f0                	mov    %esi,%eax
+  800cb7:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800cba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cbe:	48 89 c7             	mov    %rax,%rdi
+  800cc1:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  800cc8:	00 00 00 
+  800ccb:	ff d0                	call   *%rax
+  800ccd:	89 c2                	mov    %eax,%edx
+  800ccf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cd3:	48 89 c6             	mov    %rax,%rsi
+  800cd6:	89 d7                	mov    %edx,%edi
+  800cd8:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800cdf:	00 00 00 
+  800ce2:	ff d0                	call   *%rax
+  800ce4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ce7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ceb:	78 0a                	js     800cf7 <fd_close+0x4e>
+  800ced:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cf1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cf5:	74 12                	je     800d09 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cf7:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cfb:	74 05                	je     800d02 <fd_close+0x59>
+  800cfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d00:	eb 70                	jmp    800d72 <fd_close+0xc9>
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d07:	eb 69                	jmp    800d72 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0d:	8b 00                	mov    (%rax),%eax
+  800d0f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d13:	48 89 d6             	mov    %rdx,%rsi
+  800d16:	89 c7                	mov    %eax,%edi
+  800d18:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  800d1f:	00 00 00 
+  800d22:	ff d0                	call   *%rax
+  800d24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d2b:	78 2a                	js     800d57 <fd_close+0xae>
+    if (dev->dev_close)
+  800d2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d31:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d35:	48 85 c0             	test   %rax,%rax
+  800d38:	74 16                	je     800d50 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d3e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d46:	48 89 c7             	mov    %rax,%rdi
+  800d49:	ff d2                	call   *%rdx
+  800d4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d4e:	eb 07                	jmp    800d57 <fd_close+0xae>
+    else
+      r = 0;
+  800d50:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d5b:	48 89 c6             	mov    %rax,%rsi
+  800d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d63:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  800d6a:	00 00 00 
+  800d6d:	ff d0                	call   *%rax
+  return r;
+  800d6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d72:	c9                   	leave
+  800d73:	c3                   	ret
+
+0000000000800d74 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d74:	55                   	push   %rbp
+  800d75:	48 89 e5             	mov    %rsp,%rbp
+  800d78:	48 83 ec 20          	sub    $0x20,%rsp
+  800d7c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d7f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d8a:	eb 3f                	jmp    800dcb <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d8c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d93:	00 00 00 
+  800d96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d99:	48 98                	cltq
+  800d9b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d9f:	8b 00                	mov    (%rax),%eax
+  800da1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800da4:	75 21                	jne    800dc7 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800da6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dad:	00 00 00 
+  800db0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800db3:	48 98                	cltq
+  800db5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800db9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dbd:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc5:	eb 7f                	jmp    800e46 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800dc7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dcb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dd2:	00 00 00 
+  800dd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dd8:	48 98                	cltq
+  800dda:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dde:	48 85 c0             	test   %rax,%rax
+  800de1:	75 a9                	jne    800d8c <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800de3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dea:	00 00 00 
+  800ded:	8b 40 04             	mov    0x4(%rax),%eax
+  800df0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800df5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800dfc:	00 00 00 
+  800dff:	48 98                	cltq
+  800e01:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e08:	48 01 d0             	add    %rdx,%rax
+  800e0b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e11:	8b 00                	mov    (%rax),%eax
+  800e13:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e16:	89 c6                	mov    %eax,%esi
+  800e18:	48 b8 28 50 80 00 00 	movabs $0x805028,%rax
+  800e1f:	00 00 00 
+  800e22:	48 89 c7             	mov    %rax,%rdi
+  800e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2a:	48 b9 6b 31 80 00 00 	movabs $0x80316b,%rcx
+  800e31:	00 00 00 
+  800e34:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e3a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e46:	c9                   	leave
+  800e47:	c3                   	ret
+
+0000000000800e48 <close>:
+
+int
+close(int fdnum) {
+  800e48:	55                   	push   %rbp
+  800e49:	48 89 e5             	mov    %rsp,%rbp
+  800e4c:	48 83 ec 20          	sub    $0x20,%rsp
+  800e50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e53:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e5a:	48 89 d6             	mov    %rdx,%rsi
+  800e5d:	89 c7                	mov    %eax,%edi
+  800e5f:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800e66:	00 00 00 
+  800e69:	ff d0                	call   *%rax
+  800e6b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e6e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e72:	79 05                	jns    800e79 <close+0x31>
+    return r;
+  800e74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e77:	eb 18                	jmp    800e91 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e7d:	be 01 00 00 00       	mov    $0x1,%esi
+  800e82:	48 89 c7             	mov    %rax,%rdi
+  800e85:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  800e8c:	00 00 00 
+  800e8f:	ff d0                	call   *%rax
+}
+  800e91:	c9                   	leave
+  800e92:	c3                   	ret
+
+0000000000800e93 <close_all>:
+
+void
+close_all(void) {
+  800e93:	55                   	push   %rbp
+  800e94:	48 89 e5             	mov    %rsp,%rbp
+  800e97:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e9b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ea2:	eb 15                	jmp    800eb9 <close_all+0x26>
+    close(i);
+  800ea4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ea7:	89 c7                	mov    %eax,%edi
+  800ea9:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800eb5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800eb9:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ebd:	7e e5                	jle    800ea4 <close_all+0x11>
+}
+  800ebf:	90                   	nop
+  800ec0:	90                   	nop
+  800ec1:	c9                   	leave
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ec3:	55                   	push   %rbp
+  800ec4:	48 89 e5             	mov    %rsp,%rbp
+  800ec7:	48 83 ec 40          	sub    $0x40,%rsp
+  800ecb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ece:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ed1:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800ed5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ed8:	48 89 d6             	mov    %rdx,%rsi
+  800edb:	89 c7                	mov    %eax,%edi
+  800edd:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  800ee4:	00 00 00 
+  800ee7:	ff d0                	call   *%rax
+  800ee9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800eec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ef0:	79 08                	jns    800efa <dup+0x37>
+    return r;
+  800ef2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ef5:	e9 33 02 00 00       	jmp    80112d <dup+0x26a>
+  close(newfdnum);
+  800efa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efd:	89 c7                	mov    %eax,%edi
+  800eff:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  800f06:	00 00 00 
+  800f09:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f0b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f0e:	c1 e0 0c             	shl    $0xc,%eax
+  800f11:	48 98                	cltq
+  800f13:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f18:	48 01 d0             	add    %rdx,%rax
+  800f1b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f23:	48 89 c7             	mov    %rax,%rdi
+  800f26:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  800f2d:	00 00 00 
+  800f30:	ff d0                	call   *%rax
+  800f32:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f3a:	48 89 c7             	mov    %rax,%rdi
+  800f3d:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  800f44:	00 00 00 
+  800f47:	ff d0                	call   *%rax
+  800f49:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f4d:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f54:	00 
+  800f55:	e9 19 01 00 00       	jmp    801073 <dup+0x1b0>
+    off -= PGSIZE;
+  800f5a:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f61:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f62:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f6a:	48 01 d0             	add    %rdx,%rax
+  800f6d:	48 c1 e8 27          	shr    $0x27,%rax
+  800f71:	48 89 c2             	mov    %rax,%rdx
+  800f74:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f7b:	01 00 00 
+  800f7e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f82:	83 e0 01             	and    $0x1,%eax
+  800f85:	48 85 c0             	test   %rax,%rax
+  800f88:	0f 84 e5 00 00 00    	je     801073 <dup+0x1b0>
+  800f8e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f96:	48 01 d0             	add    %rdx,%rax
+  800f99:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f9d:	48 89 c2             	mov    %rax,%rdx
+  800fa0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800fa7:	01 00 00 
+  800faa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fae:	83 e0 01             	and    $0x1,%eax
+  800fb1:	48 85 c0             	test   %rax,%rax
+  800fb4:	0f 84 b9 00 00 00    	je     801073 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc2:	48 01 d0             	add    %rdx,%rax
+  800fc5:	48 c1 e8 15          	shr    $0x15,%rax
+  800fc9:	48 89 c2             	mov    %rax,%rdx
+  800fcc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fd3:	01 00 00 
+  800fd6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fda:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fdd:	48 85 c0             	test   %rax,%rax
+  800fe0:	0f 84 8d 00 00 00    	je     801073 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fe6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fee:	48 01 d0             	add    %rdx,%rax
+  800ff1:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ff5:	48 89 c2             	mov    %rax,%rdx
+  800ff8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fff:	01 00 00 
+  801002:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801006:	83 e0 01             	and    $0x1,%eax
+  801009:	48 85 c0             	test   %rax,%rax
+  80100c:	74 65                	je     801073 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80100e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801012:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801016:	48 01 d0             	add    %rdx,%rax
+  801019:	48 c1 e8 0c          	shr    $0xc,%rax
+  80101d:	48 89 c2             	mov    %rax,%rdx
+  801020:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801027:	01 00 00 
+  80102a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801033:	89 c6                	mov    %eax,%esi
+  801035:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801039:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103d:	48 01 c2             	add    %rax,%rdx
+  801040:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801044:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801048:	48 01 c8             	add    %rcx,%rax
+  80104b:	41 89 f0             	mov    %esi,%r8d
+  80104e:	48 89 d1             	mov    %rdx,%rcx
+  801051:	ba 00 00 00 00       	mov    $0x0,%edx
+  801056:	48 89 c6             	mov    %rax,%rsi
+  801059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105e:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  801065:	00 00 00 
+  801068:	ff d0                	call   *%rax
+  80106a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80106d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801071:	78 60                	js     8010d3 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801073:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801078:	0f 85 dc fe ff ff    	jne    800f5a <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80107e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801082:	48 c1 e8 0c          	shr    $0xc,%rax
+  801086:	48 89 c2             	mov    %rax,%rdx
+  801089:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801090:	01 00 00 
+  801093:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801097:	25 07 0e 00 00       	and    $0xe07,%eax
+  80109c:	89 c1                	mov    %eax,%ecx
+  80109e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010a6:	41 89 c8             	mov    %ecx,%r8d
+  8010a9:	48 89 d1             	mov    %rdx,%rcx
+  8010ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b1:	48 89 c6             	mov    %rax,%rsi
+  8010b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b9:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  8010c0:	00 00 00 
+  8010c3:	ff d0                	call   *%rax
+  8010c5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010c8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010cc:	78 08                	js     8010d6 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010ce:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010d1:	eb 5a                	jmp    80112d <dup+0x26a>
+        goto err;
+  8010d3:	90                   	nop
+  8010d4:	eb 01                	jmp    8010d7 <dup+0x214>
+    goto err;
+  8010d6:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010db:	48 89 c6             	mov    %rax,%rsi
+  8010de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e3:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  8010ea:	00 00 00 
+  8010ed:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010ef:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010f6:	00 
+  8010f7:	eb 27                	jmp    801120 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010f9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801101:	48 01 d0             	add    %rdx,%rax
+  801104:	48 89 c6             	mov    %rax,%rsi
+  801107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80110c:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  801113:	00 00 00 
+  801116:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801118:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80111f:	00 
+  801120:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801127:	00 
+  801128:	76 cf                	jbe    8010f9 <dup+0x236>
+  return r;
+  80112a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80112d:	c9                   	leave
+  80112e:	c3                   	ret
+
+000000000080112f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80112f:	55                   	push   %rbp
+  801130:	48 89 e5             	mov    %rsp,%rbp
+  801133:	48 83 ec 40          	sub    $0x40,%rsp
+  801137:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80113a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80113e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801142:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801146:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801149:	48 89 d6             	mov    %rdx,%rsi
+  80114c:	89 c7                	mov    %eax,%edi
+  80114e:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  801155:	00 00 00 
+  801158:	ff d0                	call   *%rax
+  80115a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80115d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801161:	78 24                	js     801187 <read+0x58>
+  801163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801167:	8b 00                	mov    (%rax),%eax
+  801169:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80116d:	48 89 d6             	mov    %rdx,%rsi
+  801170:	89 c7                	mov    %eax,%edi
+  801172:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+  80117e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801181:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801185:	79 0a                	jns    801191 <read+0x62>
+    return r;
+  801187:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80118a:	48 98                	cltq
+  80118c:	e9 9e 00 00 00       	jmp    80122f <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801191:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801195:	8b 40 08             	mov    0x8(%rax),%eax
+  801198:	83 e0 03             	and    $0x3,%eax
+  80119b:	83 f8 01             	cmp    $0x1,%eax
+  80119e:	75 5c                	jne    8011fc <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011a0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011a7:	00 00 00 
+  8011aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8011ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011b2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011b9:	00 00 00 
+  8011bc:	48 98                	cltq
+  8011be:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011c5:	48 01 d0             	add    %rdx,%rax
+  8011c8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011ce:	8b 00                	mov    (%rax),%eax
+  8011d0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011d3:	89 c6                	mov    %eax,%esi
+  8011d5:	48 b8 47 50 80 00 00 	movabs $0x805047,%rax
+  8011dc:	00 00 00 
+  8011df:	48 89 c7             	mov    %rax,%rdi
+  8011e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e7:	48 b9 6b 31 80 00 00 	movabs $0x80316b,%rcx
+  8011ee:	00 00 00 
+  8011f1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011f3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011fa:	eb 33                	jmp    80122f <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801200:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801204:	48 85 c0             	test   %rax,%rax
+  801207:	75 09                	jne    801212 <read+0xe3>
+    return -E_NOT_SUPP;
+  801209:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801210:	eb 1d                	jmp    80122f <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801212:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801216:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80121a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801222:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801226:	48 89 ce             	mov    %rcx,%rsi
+  801229:	48 89 c7             	mov    %rax,%rdi
+  80122c:	41 ff d0             	call   *%r8
+}
+  80122f:	c9                   	leave
+  801230:	c3                   	ret
+
+0000000000801231 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801231:	55                   	push   %rbp
+  801232:	48 89 e5             	mov    %rsp,%rbp
+  801235:	48 83 ec 30          	sub    $0x30,%rsp
+  801239:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80123c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801240:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801244:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80124b:	eb 49                	jmp    801296 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80124d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801250:	48 98                	cltq
+  801252:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801256:	48 29 c2             	sub    %rax,%rdx
+  801259:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80125c:	48 63 c8             	movslq %eax,%rcx
+  80125f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801263:	48 01 c1             	add    %rax,%rcx
+  801266:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801269:	48 89 ce             	mov    %rcx,%rsi
+  80126c:	89 c7                	mov    %eax,%edi
+  80126e:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  801275:	00 00 00 
+  801278:	ff d0                	call   *%rax
+  80127a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80127d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801281:	79 07                	jns    80128a <readn+0x59>
+      return m;
+  801283:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801286:	48 98                	cltq
+  801288:	eb 1f                	jmp    8012a9 <readn+0x78>
+    if (m == 0)
+  80128a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80128e:	74 13                	je     8012a3 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801290:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801293:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801299:	48 98                	cltq
+  80129b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80129f:	72 ac                	jb     80124d <readn+0x1c>
+  8012a1:	eb 01                	jmp    8012a4 <readn+0x73>
+      break;
+  8012a3:	90                   	nop
+  }
+  return tot;
+  8012a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012a7:	48 98                	cltq
+}
+  8012a9:	c9                   	leave
+  8012aa:	c3                   	ret
+
+00000000008012ab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012ab:	55                   	push   %rbp
+  8012ac:	48 89 e5             	mov    %rsp,%rbp
+  8012af:	48 83 ec 40          	sub    $0x40,%rsp
+  8012b3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012b6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012be:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012c5:	48 89 d6             	mov    %rdx,%rsi
+  8012c8:	89 c7                	mov    %eax,%edi
+  8012ca:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  8012d1:	00 00 00 
+  8012d4:	ff d0                	call   *%rax
+  8012d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012dd:	78 24                	js     801303 <write+0x58>
+  8012df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e3:	8b 00                	mov    (%rax),%eax
+  8012e5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012e9:	48 89 d6             	mov    %rdx,%rsi
+  8012ec:	89 c7                	mov    %eax,%edi
+  8012ee:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  8012f5:	00 00 00 
+  8012f8:	ff d0                	call   *%rax
+  8012fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801301:	79 0a                	jns    80130d <write+0x62>
+    return r;
+  801303:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801306:	48 98                	cltq
+  801308:	e9 9d 00 00 00       	jmp    8013aa <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80130d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801311:	8b 40 08             	mov    0x8(%rax),%eax
+  801314:	83 e0 03             	and    $0x3,%eax
+  801317:	85 c0                	test   %eax,%eax
+  801319:	75 5c                	jne    801377 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80131b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801322:	00 00 00 
+  801325:	8b 40 04             	mov    0x4(%rax),%eax
+  801328:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80132d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801334:	00 00 00 
+  801337:	48 98                	cltq
+  801339:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801340:	48 01 d0             	add    %rdx,%rax
+  801343:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801349:	8b 00                	mov    (%rax),%eax
+  80134b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80134e:	89 c6                	mov    %eax,%esi
+  801350:	48 b8 63 50 80 00 00 	movabs $0x805063,%rax
+  801357:	00 00 00 
+  80135a:	48 89 c7             	mov    %rax,%rdi
+  80135d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801362:	48 b9 6b 31 80 00 00 	movabs $0x80316b,%rcx
+  801369:	00 00 00 
+  80136c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80136e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801375:	eb 33                	jmp    8013aa <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801377:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80137f:	48 85 c0             	test   %rax,%rax
+  801382:	75 09                	jne    80138d <write+0xe2>
+    return -E_NOT_SUPP;
+  801384:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80138b:	eb 1d                	jmp    8013aa <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80138d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801391:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801395:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801399:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80139d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8013a1:	48 89 ce             	mov    %rcx,%rsi
+  8013a4:	48 89 c7             	mov    %rax,%rdi
+  8013a7:	41 ff d0             	call   *%r8
+}
+  8013aa:	c9                   	leave
+  8013ab:	c3                   	ret
+
+00000000008013ac <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+  8013b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8013b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013b7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ba:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013c1:	48 89 d6             	mov    %rdx,%rsi
+  8013c4:	89 c7                	mov    %eax,%edi
+  8013c6:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  8013cd:	00 00 00 
+  8013d0:	ff d0                	call   *%rax
+  8013d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013d9:	79 05                	jns    8013e0 <seek+0x34>
+    return r;
+  8013db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013de:	eb 0f                	jmp    8013ef <seek+0x43>
+  fd->fd_offset = offset;
+  8013e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013e7:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ef:	c9                   	leave
+  8013f0:	c3                   	ret
+
+00000000008013f1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013f1:	55                   	push   %rbp
+  8013f2:	48 89 e5             	mov    %rsp,%rbp
+  8013f5:	48 83 ec 30          	sub    $0x30,%rsp
+  8013f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013fc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013ff:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801403:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801406:	48 89 d6             	mov    %rdx,%rsi
+  801409:	89 c7                	mov    %eax,%edi
+  80140b:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+  801417:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80141a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80141e:	78 24                	js     801444 <ftruncate+0x53>
+  801420:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801424:	8b 00                	mov    (%rax),%eax
+  801426:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80142a:	48 89 d6             	mov    %rdx,%rsi
+  80142d:	89 c7                	mov    %eax,%edi
+  80142f:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  801436:	00 00 00 
+  801439:	ff d0                	call   *%rax
+  80143b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80143e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801442:	79 08                	jns    80144c <ftruncate+0x5b>
+    return r;
+  801444:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801447:	e9 92 00 00 00       	jmp    8014de <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80144c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801450:	8b 40 08             	mov    0x8(%rax),%eax
+  801453:	83 e0 03             	and    $0x3,%eax
+  801456:	85 c0                	test   %eax,%eax
+  801458:	75 5a                	jne    8014b4 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80145a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801461:	00 00 00 
+  801464:	8b 40 04             	mov    0x4(%rax),%eax
+  801467:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80146c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801473:	00 00 00 
+  801476:	48 98                	cltq
+  801478:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80147f:	48 01 d0             	add    %rdx,%rax
+  801482:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801488:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80148a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80148d:	89 c6                	mov    %eax,%esi
+  80148f:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  801496:	00 00 00 
+  801499:	48 89 c7             	mov    %rax,%rdi
+  80149c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a1:	48 b9 6b 31 80 00 00 	movabs $0x80316b,%rcx
+  8014a8:	00 00 00 
+  8014ab:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b2:	eb 2a                	jmp    8014de <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014bc:	48 85 c0             	test   %rax,%rax
+  8014bf:	75 07                	jne    8014c8 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014c1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014c6:	eb 16                	jmp    8014de <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014cc:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014d7:	89 d6                	mov    %edx,%esi
+  8014d9:	48 89 c7             	mov    %rax,%rdi
+  8014dc:	ff d1                	call   *%rcx
+}
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8014e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ef:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014f6:	48 89 d6             	mov    %rdx,%rsi
+  8014f9:	89 c7                	mov    %eax,%edi
+  8014fb:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  801502:	00 00 00 
+  801505:	ff d0                	call   *%rax
+  801507:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80150a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80150e:	78 24                	js     801534 <fstat+0x54>
+  801510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801514:	8b 00                	mov    (%rax),%eax
+  801516:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80151a:	48 89 d6             	mov    %rdx,%rsi
+  80151d:	89 c7                	mov    %eax,%edi
+  80151f:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  801526:	00 00 00 
+  801529:	ff d0                	call   *%rax
+  80152b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80152e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801532:	79 05                	jns    801539 <fstat+0x59>
+    return r;
+  801534:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801537:	eb 5e                	jmp    801597 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801541:	48 85 c0             	test   %rax,%rax
+  801544:	75 07                	jne    80154d <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801546:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80154b:	eb 4a                	jmp    801597 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80154d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801551:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801554:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801558:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80155f:	00 00 00 
+  stat->st_isdir   = 0;
+  801562:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801566:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80156d:	00 00 00 
+  stat->st_dev     = dev;
+  801570:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801574:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801578:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80157f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801583:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801587:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80158f:	48 89 d6             	mov    %rdx,%rsi
+  801592:	48 89 c7             	mov    %rax,%rdi
+  801595:	ff d1                	call   *%rcx
+}
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+0000000000801599 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	48 83 ec 10          	sub    $0x10,%rsp
+  8015a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ad:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015b3:	83 f8 20             	cmp    $0x20,%eax
+  8015b6:	75 07                	jne    8015bf <pollwait_key+0x26>
+    return -E_INVAL;
+  8015b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015bd:	eb 5f                	jmp    80161e <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c3:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015cd:	48 63 d2             	movslq %edx,%rdx
+  8015d0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015d4:	48 01 c2             	add    %rax,%rdx
+  8015d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015db:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e2:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ec:	8b 00                	mov    (%rax),%eax
+  8015ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015f2:	48 63 c9             	movslq %ecx,%rcx
+  8015f5:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015f9:	48 01 ca             	add    %rcx,%rdx
+  8015fc:	48 83 c2 08          	add    $0x8,%rdx
+  801600:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801606:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80160c:	8d 50 01             	lea    0x1(%rax),%edx
+  80160f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801613:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161e:	c9                   	leave
+  80161f:	c3                   	ret
+
+0000000000801620 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801620:	55                   	push   %rbp
+  801621:	48 89 e5             	mov    %rsp,%rbp
+  801624:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80162b:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801632:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801638:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80163f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801646:	00 
+  int i, r, ready, ipc = 0;
+  801647:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80164e:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801655:	00 
+  801656:	74 45                	je     80169d <poll+0x7d>
+  801658:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80165f:	ff 
+  801660:	74 3b                	je     80169d <poll+0x7d>
+    now      = vsys_clock_ns();
+  801662:	48 b8 5b 2b 80 00 00 	movabs $0x802b5b,%rax
+  801669:	00 00 00 
+  80166c:	ff d0                	call   *%rax
+  80166e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801676:	48 f7 d0             	not    %rax
+  801679:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801680:	73 10                	jae    801692 <poll+0x72>
+  801682:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801686:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80168d:	48 01 d0             	add    %rdx,%rax
+  801690:	eb 07                	jmp    801699 <poll+0x79>
+  801692:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801699:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80169d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016a4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016b2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016b9:	e9 46 02 00 00       	jmp    801904 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016c1:	48 63 d0             	movslq %eax,%rdx
+  8016c4:	48 89 d0             	mov    %rdx,%rax
+  8016c7:	48 01 c0             	add    %rax,%rax
+  8016ca:	48 01 d0             	add    %rdx,%rax
+  8016cd:	48 c1 e0 02          	shl    $0x2,%rax
+  8016d1:	48 89 c2             	mov    %rax,%rdx
+  8016d4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016db:	48 01 d0             	add    %rdx,%rax
+  8016de:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e8:	48 63 d0             	movslq %eax,%rdx
+  8016eb:	48 89 d0             	mov    %rdx,%rax
+  8016ee:	48 01 c0             	add    %rax,%rax
+  8016f1:	48 01 d0             	add    %rdx,%rax
+  8016f4:	48 c1 e0 02          	shl    $0x2,%rax
+  8016f8:	48 89 c2             	mov    %rax,%rdx
+  8016fb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801702:	48 01 d0             	add    %rdx,%rax
+  801705:	8b 00                	mov    (%rax),%eax
+  801707:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80170a:	75 62                	jne    80176e <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80170c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80170f:	48 63 d0             	movslq %eax,%rdx
+  801712:	48 89 d0             	mov    %rdx,%rax
+  801715:	48 01 c0             	add    %rax,%rax
+  801718:	48 01 d0             	add    %rdx,%rax
+  80171b:	48 c1 e0 02          	shl    $0x2,%rax
+  80171f:	48 89 c2             	mov    %rax,%rdx
+  801722:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801729:	48 01 d0             	add    %rdx,%rax
+  80172c:	8b 40 04             	mov    0x4(%rax),%eax
+  80172f:	83 e0 01             	and    $0x1,%eax
+  801732:	85 c0                	test   %eax,%eax
+  801734:	0f 84 9b 01 00 00    	je     8018d5 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80173a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173d:	48 63 d0             	movslq %eax,%rdx
+  801740:	48 89 d0             	mov    %rdx,%rax
+  801743:	48 01 c0             	add    %rax,%rax
+  801746:	48 01 d0             	add    %rdx,%rax
+  801749:	48 c1 e0 02          	shl    $0x2,%rax
+  80174d:	48 89 c2             	mov    %rax,%rdx
+  801750:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801757:	48 01 c2             	add    %rax,%rdx
+  80175a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80175d:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801760:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801763:	83 c8 04             	or     $0x4,%eax
+  801766:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  801769:	e9 67 01 00 00       	jmp    8018d5 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80176e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801771:	48 63 d0             	movslq %eax,%rdx
+  801774:	48 89 d0             	mov    %rdx,%rax
+  801777:	48 01 c0             	add    %rax,%rax
+  80177a:	48 01 d0             	add    %rdx,%rax
+  80177d:	48 c1 e0 02          	shl    $0x2,%rax
+  801781:	48 89 c2             	mov    %rax,%rdx
+  801784:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80178b:	48 01 d0             	add    %rdx,%rax
+  80178e:	8b 00                	mov    (%rax),%eax
+  801790:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801797:	48 89 d6             	mov    %rdx,%rsi
+  80179a:	89 c7                	mov    %eax,%edi
+  80179c:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  8017a3:	00 00 00 
+  8017a6:	ff d0                	call   *%rax
+  8017a8:	85 c0                	test   %eax,%eax
+  8017aa:	78 25                	js     8017d1 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017ac:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017b3:	8b 00                	mov    (%rax),%eax
+  8017b5:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017bc:	48 89 d6             	mov    %rdx,%rsi
+  8017bf:	89 c7                	mov    %eax,%edi
+  8017c1:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  8017c8:	00 00 00 
+  8017cb:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	79 2c                	jns    8017fd <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017d4:	48 63 d0             	movslq %eax,%rdx
+  8017d7:	48 89 d0             	mov    %rdx,%rax
+  8017da:	48 01 c0             	add    %rax,%rax
+  8017dd:	48 01 d0             	add    %rdx,%rax
+  8017e0:	48 c1 e0 02          	shl    $0x2,%rax
+  8017e4:	48 89 c2             	mov    %rax,%rdx
+  8017e7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017ee:	48 01 d0             	add    %rdx,%rax
+  8017f1:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017f8:	e9 d8 00 00 00       	jmp    8018d5 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017fd:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801804:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801808:	48 85 c0             	test   %rax,%rax
+  80180b:	74 7d                	je     80188a <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80180d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801814:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801818:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80181b:	48 63 d0             	movslq %eax,%rdx
+  80181e:	48 89 d0             	mov    %rdx,%rax
+  801821:	48 01 c0             	add    %rax,%rax
+  801824:	48 01 d0             	add    %rdx,%rax
+  801827:	48 c1 e0 02          	shl    $0x2,%rax
+  80182b:	48 89 c2             	mov    %rax,%rdx
+  80182e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801835:	48 01 d0             	add    %rdx,%rax
+  801838:	8b 48 04             	mov    0x4(%rax),%ecx
+  80183b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801842:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801849:	89 ce                	mov    %ecx,%esi
+  80184b:	48 89 c7             	mov    %rax,%rdi
+  80184e:	41 ff d0             	call   *%r8
+  801851:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801854:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801858:	79 08                	jns    801862 <poll+0x242>
+          return r;
+  80185a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80185d:	e9 45 01 00 00       	jmp    8019a7 <poll+0x387>
+        fds[i].revents = r;
+  801862:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801865:	48 63 d0             	movslq %eax,%rdx
+  801868:	48 89 d0             	mov    %rdx,%rax
+  80186b:	48 01 c0             	add    %rax,%rax
+  80186e:	48 01 d0             	add    %rdx,%rax
+  801871:	48 c1 e0 02          	shl    $0x2,%rax
+  801875:	48 89 c2             	mov    %rax,%rdx
+  801878:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80187f:	48 01 c2             	add    %rax,%rdx
+  801882:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801885:	89 42 08             	mov    %eax,0x8(%rdx)
+  801888:	eb 4b                	jmp    8018d5 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80188a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80188d:	48 63 d0             	movslq %eax,%rdx
+  801890:	48 89 d0             	mov    %rdx,%rax
+  801893:	48 01 c0             	add    %rax,%rax
+  801896:	48 01 d0             	add    %rdx,%rax
+  801899:	48 c1 e0 02          	shl    $0x2,%rax
+  80189d:	48 89 c2             	mov    %rax,%rdx
+  8018a0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018a7:	48 01 d0             	add    %rdx,%rax
+  8018aa:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b0:	48 63 d0             	movslq %eax,%rdx
+  8018b3:	48 89 d0             	mov    %rdx,%rax
+  8018b6:	48 01 c0             	add    %rax,%rax
+  8018b9:	48 01 d0             	add    %rdx,%rax
+  8018bc:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c0:	48 89 c2             	mov    %rax,%rdx
+  8018c3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018ca:	48 01 d0             	add    %rdx,%rax
+  8018cd:	83 e1 03             	and    $0x3,%ecx
+  8018d0:	89 ca                	mov    %ecx,%edx
+  8018d2:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d8:	48 63 d0             	movslq %eax,%rdx
+  8018db:	48 89 d0             	mov    %rdx,%rax
+  8018de:	48 01 c0             	add    %rax,%rax
+  8018e1:	48 01 d0             	add    %rdx,%rax
+  8018e4:	48 c1 e0 02          	shl    $0x2,%rax
+  8018e8:	48 89 c2             	mov    %rax,%rdx
+  8018eb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018f2:	48 01 d0             	add    %rdx,%rax
+  8018f5:	8b 40 08             	mov    0x8(%rax),%eax
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	74 04                	je     801900 <poll+0x2e0>
+        ready++;
+  8018fc:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801900:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801904:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801907:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80190d:	0f 8c ab fd ff ff    	jl     8016be <poll+0x9e>
+    }
+    if (ready)
+  801913:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801917:	74 08                	je     801921 <poll+0x301>
+      return ready;
+  801919:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80191c:	e9 86 00 00 00       	jmp    8019a7 <poll+0x387>
+
+    if (deadline) {
+  801921:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801926:	74 30                	je     801958 <poll+0x338>
+      now     = vsys_clock_ns();
+  801928:	48 b8 5b 2b 80 00 00 	movabs $0x802b5b,%rax
+  80192f:	00 00 00 
+  801932:	ff d0                	call   *%rax
+  801934:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801938:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80193c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801940:	73 0a                	jae    80194c <poll+0x32c>
+  801942:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801946:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80194a:	eb 05                	jmp    801951 <poll+0x331>
+  80194c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801951:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801958:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80195b:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80195e:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801965:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80196c:	48 89 c7             	mov    %rax,%rdi
+  80196f:	48 b8 04 08 80 00 00 	movabs $0x800804,%rax
+  801976:	00 00 00 
+  801979:	ff d0                	call   *%rax
+  80197b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80197e:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801982:	75 07                	jne    80198b <poll+0x36b>
+      return 0;
+  801984:	b8 00 00 00 00       	mov    $0x0,%eax
+  801989:	eb 1c                	jmp    8019a7 <poll+0x387>
+    if (r < 0)
+  80198b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80198f:	79 05                	jns    801996 <poll+0x376>
+      return r;
+  801991:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801994:	eb 11                	jmp    8019a7 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801996:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801999:	c1 f8 02             	sar    $0x2,%eax
+  80199c:	83 e0 01             	and    $0x1,%eax
+  80199f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8019a2:	e9 f6 fc ff ff       	jmp    80169d <poll+0x7d>
+  }
+}
+  8019a7:	c9                   	leave
+  8019a8:	c3                   	ret
+
+00000000008019a9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8019b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c2:	48 89 c7             	mov    %rax,%rdi
+  8019c5:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+  8019d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019d8:	79 05                	jns    8019df <stat+0x36>
+    return fd;
+  8019da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019dd:	eb 2f                	jmp    801a0e <stat+0x65>
+  r = fstat(fd, stat);
+  8019df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019e6:	48 89 d6             	mov    %rdx,%rsi
+  8019e9:	89 c7                	mov    %eax,%edi
+  8019eb:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  8019f2:	00 00 00 
+  8019f5:	ff d0                	call   *%rax
+  8019f7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019fd:	89 c7                	mov    %eax,%edi
+  8019ff:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  801a06:	00 00 00 
+  801a09:	ff d0                	call   *%rax
+  return r;
+  801a0b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a0e:	c9                   	leave
+  801a0f:	c3                   	ret
+
+0000000000801a10 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a10:	55                   	push   %rbp
+  801a11:	48 89 e5             	mov    %rsp,%rbp
+  801a14:	48 83 ec 10          	sub    $0x10,%rsp
+  801a18:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a1f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a26:	00 00 00 
+  801a29:	8b 00                	mov    (%rax),%eax
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	75 1d                	jne    801a4c <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a2f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a34:	48 b8 63 4e 80 00 00 	movabs $0x804e63,%rax
+  801a3b:	00 00 00 
+  801a3e:	ff d0                	call   *%rax
+  801a40:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a47:	00 00 00 
+  801a4a:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a4c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a53:	00 00 00 
+  801a56:	8b 00                	mov    (%rax),%eax
+  801a58:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a5b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a60:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a67:	00 00 00 
+  801a6a:	89 c7                	mov    %eax,%edi
+  801a6c:	48 b8 b6 4d 80 00 00 	movabs $0x804db6,%rax
+  801a73:	00 00 00 
+  801a76:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a81:	48 89 c6             	mov    %rax,%rsi
+  801a84:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a89:	48 b8 39 4c 80 00 00 	movabs $0x804c39,%rax
+  801a90:	00 00 00 
+  801a93:	ff d0                	call   *%rax
+}
+  801a95:	c9                   	leave
+  801a96:	c3                   	ret
+
+0000000000801a97 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a97:	55                   	push   %rbp
+  801a98:	48 89 e5             	mov    %rsp,%rbp
+  801a9b:	48 83 ec 20          	sub    $0x20,%rsp
+  801a9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aaa:	48 89 c7             	mov    %rax,%rdi
+  801aad:	48 b8 1a 40 80 00 00 	movabs $0x80401a,%rax
+  801ab4:	00 00 00 
+  801ab7:	ff d0                	call   *%rax
+  801ab9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801abe:	7e 0a                	jle    801aca <open+0x33>
+    return -E_BAD_PATH;
+  801ac0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac5:	e9 a8 00 00 00       	jmp    801b72 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801aca:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801ace:	48 89 c7             	mov    %rax,%rdi
+  801ad1:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  801ad8:	00 00 00 
+  801adb:	ff d0                	call   *%rax
+  801add:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ae0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ae4:	79 08                	jns    801aee <open+0x57>
+    return r;
+  801ae6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ae9:	e9 84 00 00 00       	jmp    801b72 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801aee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801af2:	48 89 c6             	mov    %rax,%rsi
+  801af5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801afc:	00 00 00 
+  801aff:	48 89 c7             	mov    %rax,%rdi
+  801b02:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  801b09:	00 00 00 
+  801b0c:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b0e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b15:	00 00 00 
+  801b18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b1b:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b25:	48 89 c6             	mov    %rax,%rsi
+  801b28:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b2d:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801b34:	00 00 00 
+  801b37:	ff d0                	call   *%rax
+  801b39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b40:	79 1d                	jns    801b5f <open+0xc8>
+    fd_close(fd, 0);
+  801b42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b46:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4b:	48 89 c7             	mov    %rax,%rdi
+  801b4e:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+    return r;
+  801b5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b5d:	eb 13                	jmp    801b72 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b63:	48 89 c7             	mov    %rax,%rdi
+  801b66:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  801b6d:	00 00 00 
+  801b70:	ff d0                	call   *%rax
+}
+  801b72:	c9                   	leave
+  801b73:	c3                   	ret
+
+0000000000801b74 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b74:	55                   	push   %rbp
+  801b75:	48 89 e5             	mov    %rsp,%rbp
+  801b78:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b84:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b87:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b8e:	00 00 00 
+  801b91:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b93:	be 00 00 00 00       	mov    $0x0,%esi
+  801b98:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b9d:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+}
+  801ba9:	c9                   	leave
+  801baa:	c3                   	ret
+
+0000000000801bab <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801bab:	55                   	push   %rbp
+  801bac:	48 89 e5             	mov    %rsp,%rbp
+  801baf:	48 83 ec 30          	sub    $0x30,%rsp
+  801bb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bb7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bbb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801bbf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bc4:	74 07                	je     801bcd <devfile_read+0x22>
+  801bc6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bcb:	75 0a                	jne    801bd7 <devfile_read+0x2c>
+  return E_INVAL;
+  801bcd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd2:	e9 b4 00 00 00       	jmp    801c8b <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bd7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bde:	00 
+  while (n) {
+  801bdf:	e9 98 00 00 00       	jmp    801c7c <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801be8:	8b 40 0c             	mov    0xc(%rax),%eax
+  801beb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bf2:	00 00 00 
+  801bf5:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bf7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bfe:	00 00 00 
+  801c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c05:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c09:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c13:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801c1a:	00 00 00 
+  801c1d:	ff d0                	call   *%rax
+  801c1f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c22:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c26:	7f 13                	jg     801c3b <devfile_read+0x90>
+      return res ? res : res0;
+  801c28:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c2c:	74 07                	je     801c35 <devfile_read+0x8a>
+  801c2e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c31:	48 98                	cltq
+  801c33:	eb 56                	jmp    801c8b <devfile_read+0xe0>
+  801c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c39:	eb 50                	jmp    801c8b <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c3e:	48 63 d0             	movslq %eax,%rdx
+  801c41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c45:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c4c:	00 00 00 
+  801c4f:	48 89 ce             	mov    %rcx,%rsi
+  801c52:	48 89 c7             	mov    %rax,%rdi
+  801c55:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+
+    buf += res;
+  801c61:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c64:	48 98                	cltq
+  801c66:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c6a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c6d:	48 98                	cltq
+  801c6f:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c73:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c76:	48 98                	cltq
+  801c78:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c7c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c81:	0f 85 5d ff ff ff    	jne    801be4 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+0000000000801c8d <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c8d:	55                   	push   %rbp
+  801c8e:	48 89 e5             	mov    %rsp,%rbp
+  801c91:	48 83 ec 50          	sub    $0x50,%rsp
+  801c95:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c99:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c9d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801ca1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ca6:	74 07                	je     801caf <devfile_write+0x22>
+  801ca8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801cad:	75 0a                	jne    801cb9 <devfile_write+0x2c>
+  return E_INVAL;
+  801caf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cb4:	e9 c9 00 00 00       	jmp    801d82 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801cb9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801cc0:	00 
+
+  while (n) {
+  801cc1:	e9 ad 00 00 00       	jmp    801d73 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cc6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cce:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cd5:	00 
+  801cd6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cde:	48 39 c2             	cmp    %rax,%rdx
+  801ce1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ce5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801ce9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ced:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cf1:	48 89 c6             	mov    %rax,%rsi
+  801cf4:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cfb:	00 00 00 
+  801cfe:	48 89 c7             	mov    %rax,%rdi
+  801d01:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d11:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d14:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d1b:	00 00 00 
+  801d1e:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d20:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d27:	00 00 00 
+  801d2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d2e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d32:	be 00 00 00 00       	mov    $0x0,%esi
+  801d37:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d3c:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d4b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d4f:	79 07                	jns    801d58 <devfile_write+0xcb>
+      return res;
+  801d51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d54:	48 98                	cltq
+  801d56:	eb 2a                	jmp    801d82 <devfile_write+0xf5>
+
+    buf += res;
+  801d58:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d5b:	48 98                	cltq
+  801d5d:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d64:	48 98                	cltq
+  801d66:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d6d:	48 98                	cltq
+  801d6f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d73:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d78:	0f 85 48 ff ff ff    	jne    801cc6 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+0000000000801d84 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	48 83 ec 20          	sub    $0x20,%rsp
+  801d8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d90:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d98:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d9b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801da2:	00 00 00 
+  801da5:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801da7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dac:	bf 05 00 00 00       	mov    $0x5,%edi
+  801db1:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801dc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dc4:	79 05                	jns    801dcb <devfile_stat+0x47>
+    return r;
+  801dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dc9:	eb 59                	jmp    801e24 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dcf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dd6:	00 00 00 
+  801dd9:	48 89 d6             	mov    %rdx,%rsi
+  801ddc:	48 89 c7             	mov    %rax,%rdi
+  801ddf:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801deb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801df2:	00 00 00 
+  801df5:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801dfb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dff:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e05:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e0c:	00 00 00 
+  801e0f:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e19:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+
+0000000000801e26 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e26:	55                   	push   %rbp
+  801e27:	48 89 e5             	mov    %rsp,%rbp
+  801e2a:	48 83 ec 10          	sub    $0x10,%rsp
+  801e2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e32:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e39:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e3c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e43:	00 00 00 
+  801e46:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e48:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e4f:	00 00 00 
+  801e52:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e55:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e58:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e62:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801e69:	00 00 00 
+  801e6c:	ff d0                	call   *%rax
+}
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+0000000000801e70 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e70:	55                   	push   %rbp
+  801e71:	48 89 e5             	mov    %rsp,%rbp
+  801e74:	48 83 ec 18          	sub    $0x18,%rsp
+  801e78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e7c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e7f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e86:	83 e0 03             	and    $0x3,%eax
+}
+  801e89:	c9                   	leave
+  801e8a:	c3                   	ret
+
+0000000000801e8b <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e8b:	55                   	push   %rbp
+  801e8c:	48 89 e5             	mov    %rsp,%rbp
+  801e8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9b:	48 89 c7             	mov    %rax,%rdi
+  801e9e:	48 b8 1a 40 80 00 00 	movabs $0x80401a,%rax
+  801ea5:	00 00 00 
+  801ea8:	ff d0                	call   *%rax
+  801eaa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eaf:	7e 07                	jle    801eb8 <remove+0x2d>
+    return -E_BAD_PATH;
+  801eb1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb6:	eb 36                	jmp    801eee <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801eb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ebc:	48 89 c6             	mov    %rax,%rsi
+  801ebf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ec6:	00 00 00 
+  801ec9:	48 89 c7             	mov    %rax,%rdi
+  801ecc:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ed8:	be 00 00 00 00       	mov    $0x0,%esi
+  801edd:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ee2:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+}
+  801eee:	c9                   	leave
+  801eef:	c3                   	ret
+
+0000000000801ef0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ef0:	55                   	push   %rbp
+  801ef1:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ef4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef9:	bf 08 00 00 00       	mov    $0x8,%edi
+  801efe:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801f05:	00 00 00 
+  801f08:	ff d0                	call   *%rax
+}
+  801f0a:	5d                   	pop    %rbp
+  801f0b:	c3                   	ret
+
+0000000000801f0c <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f0c:	55                   	push   %rbp
+  801f0d:	48 89 e5             	mov    %rsp,%rbp
+  801f10:	48 83 ec 20          	sub    $0x20,%rsp
+  801f14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f18:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1d:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f22:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801f29:	00 00 00 
+  801f2c:	ff d0                	call   *%rax
+  801f2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f35:	79 05                	jns    801f3c <fs_stats+0x30>
+    return r;
+  801f37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f3a:	eb 2a                	jmp    801f66 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f40:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f45:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f4c:	00 00 00 
+  801f4f:	48 89 ce             	mov    %rcx,%rsi
+  801f52:	48 89 c7             	mov    %rax,%rdi
+  801f55:	48 b8 5e 46 80 00 00 	movabs $0x80465e,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  return 0;
+  801f61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f66:	c9                   	leave
+  801f67:	c3                   	ret
+
+0000000000801f68 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+  801f6c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f70:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f73:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f7a:	00 00 00 
+  801f7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f80:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f82:	be 00 00 00 00       	mov    $0x0,%esi
+  801f87:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f8c:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801f93:	00 00 00 
+  801f96:	ff d0                	call   *%rax
+}
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+0000000000801f9a <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa2:	89 f8                	mov    %edi,%eax
+  801fa4:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801fa7:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801fab:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fb2:	00 00 00 
+  801fb5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fb7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fc1:	48 b8 10 1a 80 00 00 	movabs $0x801a10,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+}
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+0000000000801fcf <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fcf:	55                   	push   %rbp
+  801fd0:	48 89 e5             	mov    %rsp,%rbp
+  801fd3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fdf:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fe4:	48 89 c7             	mov    %rax,%rdi
+  801fe7:	48 b8 f5 1f 80 00 00 	movabs $0x801ff5,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+}
+  801ff3:	c9                   	leave
+  801ff4:	c3                   	ret
+
+0000000000801ff5 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+  801ff9:	48 83 ec 50          	sub    $0x50,%rsp
+  801ffd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802001:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  802005:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80200c:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80200d:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802012:	74 0a                	je     80201e <pipe_size+0x29>
+  802014:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80201b:	00 
+  80201c:	76 0a                	jbe    802028 <pipe_size+0x33>
+    return -E_INVAL;
+  80201e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802023:	e9 cc 02 00 00       	jmp    8022f4 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802028:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80202c:	48 89 c7             	mov    %rax,%rdi
+  80202f:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+  80203b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80203e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802042:	0f 88 a8 02 00 00    	js     8022f0 <pipe_size+0x2fb>
+  802048:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80204c:	ba 07 04 00 00       	mov    $0x407,%edx
+  802051:	48 89 c6             	mov    %rax,%rsi
+  802054:	bf 00 00 00 00       	mov    $0x0,%edi
+  802059:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802068:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80206c:	0f 88 7e 02 00 00    	js     8022f0 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802072:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802076:	48 89 c7             	mov    %rax,%rdi
+  802079:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+  802085:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802088:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80208c:	0f 88 43 02 00 00    	js     8022d5 <pipe_size+0x2e0>
+  802092:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802096:	ba 07 04 00 00       	mov    $0x407,%edx
+  80209b:	48 89 c6             	mov    %rax,%rsi
+  80209e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a3:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b6:	0f 88 19 02 00 00    	js     8022d5 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c0:	48 89 c7             	mov    %rax,%rdi
+  8020c3:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8020ca:	00 00 00 
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020d3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020da:	00 
+  8020db:	e9 a2 00 00 00       	jmp    802182 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020e4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020e8:	48 89 c2             	mov    %rax,%rdx
+  8020eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020ef:	48 01 d0             	add    %rdx,%rax
+  8020f2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020f7:	48 89 c6             	mov    %rax,%rsi
+  8020fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ff:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80210e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802112:	0f 88 37 01 00 00    	js     80224f <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802118:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80211c:	48 89 c7             	mov    %rax,%rdi
+  80211f:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  802126:	00 00 00 
+  802129:	ff d0                	call   *%rax
+  80212b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80212f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802133:	48 01 c2             	add    %rax,%rdx
+  802136:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80213a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80213e:	48 89 c1             	mov    %rax,%rcx
+  802141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802145:	48 01 c8             	add    %rcx,%rax
+  802148:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80214e:	48 89 d1             	mov    %rdx,%rcx
+  802151:	ba 00 00 00 00       	mov    $0x0,%edx
+  802156:	48 89 c6             	mov    %rax,%rsi
+  802159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215e:	48 b8 14 04 80 00 00 	movabs $0x800414,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+  80216a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80216d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802171:	79 0a                	jns    80217d <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802173:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802178:	e9 d3 00 00 00       	jmp    802250 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80217d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802182:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  802189:	00 
+  80218a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80218e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802192:	48 01 d0             	add    %rdx,%rax
+  802195:	48 83 c0 1f          	add    $0x1f,%rax
+  802199:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80219d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a6:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8021aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ae:	48 29 d0             	sub    %rdx,%rax
+  8021b1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021b5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021b9:	0f 82 21 ff ff ff    	jb     8020e0 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021cb:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021cf:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d7:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021de:	00 00 00 
+  8021e1:	8b 12                	mov    (%rdx),%edx
+  8021e3:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021e9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f4:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021fb:	00 00 00 
+  8021fe:	8b 12                	mov    (%rdx),%edx
+  802200:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  802202:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802206:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80220d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802211:	48 89 c7             	mov    %rax,%rdi
+  802214:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	89 c2                	mov    %eax,%edx
+  802222:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802226:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802228:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80222c:	48 89 c7             	mov    %rax,%rdi
+  80222f:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  802236:	00 00 00 
+  802239:	ff d0                	call   *%rax
+  80223b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80223f:	48 83 c2 04          	add    $0x4,%rdx
+  802243:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224a:	e9 a5 00 00 00       	jmp    8022f4 <pipe_size+0x2ff>
+      goto err2;
+  80224f:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802250:	eb 58                	jmp    8022aa <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802252:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802256:	48 c1 e0 0c          	shl    $0xc,%rax
+  80225a:	48 89 c2             	mov    %rax,%rdx
+  80225d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802261:	48 01 d0             	add    %rdx,%rax
+  802264:	48 89 c6             	mov    %rax,%rsi
+  802267:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226c:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  802273:	00 00 00 
+  802276:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802278:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80227c:	48 89 c7             	mov    %rax,%rdi
+  80227f:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  80228b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80228f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802293:	48 01 d0             	add    %rdx,%rax
+  802296:	48 89 c6             	mov    %rax,%rsi
+  802299:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229e:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  8022a5:	00 00 00 
+  8022a8:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8022aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ae:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022b2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022b6:	48 85 c0             	test   %rax,%rax
+  8022b9:	75 97                	jne    802252 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022bf:	48 89 c6             	mov    %rax,%rsi
+  8022c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c7:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+  8022d3:	eb 01                	jmp    8022d6 <pipe_size+0x2e1>
+    goto err1;
+  8022d5:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022da:	48 89 c6             	mov    %rax,%rsi
+  8022dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e2:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+  8022ee:	eb 01                	jmp    8022f1 <pipe_size+0x2fc>
+    goto err;
+  8022f0:	90                   	nop
+err:
+  return r;
+  8022f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+00000000008022f6 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	53                   	push   %rbx
+  8022fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8022ff:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802303:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  802307:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80230e:	00 00 00 
+  802311:	8b 40 04             	mov    0x4(%rax),%eax
+  802314:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802319:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802320:	00 00 00 
+  802323:	48 98                	cltq
+  802325:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80232c:	48 01 d0             	add    %rdx,%rax
+  80232f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802335:	8b 00                	mov    (%rax),%eax
+  802337:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80233a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80233e:	48 89 c7             	mov    %rax,%rdi
+  802341:	48 b8 d4 4e 80 00 00 	movabs $0x804ed4,%rax
+  802348:	00 00 00 
+  80234b:	ff d0                	call   *%rax
+  80234d:	89 c3                	mov    %eax,%ebx
+  80234f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802353:	48 89 c7             	mov    %rax,%rdi
+  802356:	48 b8 d4 4e 80 00 00 	movabs $0x804ed4,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+  802362:	39 c3                	cmp    %eax,%ebx
+  802364:	0f 94 c0             	sete   %al
+  802367:	0f b6 c0             	movzbl %al,%eax
+  80236a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80236d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802374:	00 00 00 
+  802377:	8b 40 04             	mov    0x4(%rax),%eax
+  80237a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80237f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802386:	00 00 00 
+  802389:	48 98                	cltq
+  80238b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802392:	48 01 d0             	add    %rdx,%rax
+  802395:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80239b:	8b 00                	mov    (%rax),%eax
+  80239d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8023a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a3:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023a6:	75 05                	jne    8023ad <_pipeisclosed+0xb7>
+      return ret;
+  8023a8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023ab:	eb 68                	jmp    802415 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8023ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023b0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023b3:	0f 84 4e ff ff ff    	je     802307 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023b9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023c0:	00 00 00 
+  8023c3:	8b 40 04             	mov    0x4(%rax),%eax
+  8023c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023cb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023d2:	00 00 00 
+  8023d5:	48 98                	cltq
+  8023d7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023de:	48 01 d0             	add    %rdx,%rax
+  8023e1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023e7:	8b 10                	mov    (%rax),%edx
+  8023e9:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ef:	89 c6                	mov    %eax,%esi
+  8023f1:	48 b8 b0 50 80 00 00 	movabs $0x8050b0,%rax
+  8023f8:	00 00 00 
+  8023fb:	48 89 c7             	mov    %rax,%rdi
+  8023fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802403:	49 b8 6b 31 80 00 00 	movabs $0x80316b,%r8
+  80240a:	00 00 00 
+  80240d:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802410:	e9 f2 fe ff ff       	jmp    802307 <_pipeisclosed+0x11>
+  }
+}
+  802415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802419:	c9                   	leave
+  80241a:	c3                   	ret
+
+000000000080241b <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80241b:	55                   	push   %rbp
+  80241c:	48 89 e5             	mov    %rsp,%rbp
+  80241f:	48 83 ec 30          	sub    $0x30,%rsp
+  802423:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802426:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80242a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80242d:	48 89 d6             	mov    %rdx,%rsi
+  802430:	89 c7                	mov    %eax,%edi
+  802432:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802441:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802445:	79 05                	jns    80244c <pipeisclosed+0x31>
+    return r;
+  802447:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80244a:	eb 31                	jmp    80247d <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80244c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802450:	48 89 c7             	mov    %rax,%rdi
+  802453:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+  80245f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802463:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802467:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80246b:	48 89 d6             	mov    %rdx,%rsi
+  80246e:	48 89 c7             	mov    %rax,%rdi
+  802471:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+}
+  80247d:	c9                   	leave
+  80247e:	c3                   	ret
+
+000000000080247f <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80247f:	55                   	push   %rbp
+  802480:	48 89 e5             	mov    %rsp,%rbp
+  802483:	48 83 ec 10          	sub    $0x10,%rsp
+  802487:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80248b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248f:	8b 40 18             	mov    0x18(%rax),%eax
+  802492:	8d 50 01             	lea    0x1(%rax),%edx
+  802495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802499:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80249c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a0:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	74 27                	je     8024ce <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8024a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ab:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b6:	48 83 c0 18          	add    $0x18,%rax
+  8024ba:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024bf:	48 89 c7             	mov    %rax,%rdi
+  8024c2:	48 b8 b7 07 80 00 00 	movabs $0x8007b7,%rax
+  8024c9:	00 00 00 
+  8024cc:	ff d0                	call   *%rax
+  }
+}
+  8024ce:	90                   	nop
+  8024cf:	c9                   	leave
+  8024d0:	c3                   	ret
+
+00000000008024d1 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024d1:	55                   	push   %rbp
+  8024d2:	48 89 e5             	mov    %rsp,%rbp
+  8024d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024dd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e4:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ef:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024f6:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024fd:	89 c6                	mov    %eax,%esi
+  8024ff:	48 89 cf             	mov    %rcx,%rdi
+  802502:	48 b8 68 07 80 00 00 	movabs $0x800768,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+}
+  80250e:	90                   	nop
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+
+0000000000802511 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802511:	55                   	push   %rbp
+  802512:	48 89 e5             	mov    %rsp,%rbp
+  802515:	48 83 ec 70          	sub    $0x70,%rsp
+  802519:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80251d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802521:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802525:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802529:	48 89 c7             	mov    %rax,%rdi
+  80252c:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  802533:	00 00 00 
+  802536:	ff d0                	call   *%rax
+  802538:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80253c:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802541:	75 0a                	jne    80254d <devpipe_read+0x3c>
+    return 0;
+  802543:	b8 00 00 00 00       	mov    $0x0,%eax
+  802548:	e9 63 01 00 00       	jmp    8026b0 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80254d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802551:	8b 40 18             	mov    0x18(%rax),%eax
+  802554:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255b:	48 8b 10             	mov    (%rax),%rdx
+  80255e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802562:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802566:	48 39 c2             	cmp    %rax,%rdx
+  802569:	75 42                	jne    8025ad <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80256b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80256f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802573:	48 89 d6             	mov    %rdx,%rsi
+  802576:	48 89 c7             	mov    %rax,%rdi
+  802579:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802580:	00 00 00 
+  802583:	ff d0                	call   *%rax
+  802585:	85 c0                	test   %eax,%eax
+  802587:	74 0a                	je     802593 <devpipe_read+0x82>
+      return 0;
+  802589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258e:	e9 1d 01 00 00       	jmp    8026b0 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802593:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80259a:	89 d6                	mov    %edx,%esi
+  80259c:	48 89 c7             	mov    %rax,%rdi
+  80259f:	48 b8 d1 24 80 00 00 	movabs $0x8024d1,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8025ab:	eb a0                	jmp    80254d <devpipe_read+0x3c>
+      break;
+  8025ad:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8025ae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025b6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ca:	48 8b 00             	mov    (%rax),%rax
+  8025cd:	48 29 c2             	sub    %rax,%rdx
+  8025d0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025dc:	48 39 c2             	cmp    %rax,%rdx
+  8025df:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025e3:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025eb:	48 8b 00             	mov    (%rax),%rax
+  8025ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025f2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fb:	48 f7 f1             	div    %rcx
+  8025fe:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  802602:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802606:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80260a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802612:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802616:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80261a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80261e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802622:	48 39 c2             	cmp    %rax,%rdx
+  802625:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802629:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80262d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802631:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802635:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802639:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80263d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802641:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802645:	48 89 ce             	mov    %rcx,%rsi
+  802648:	48 89 c7             	mov    %rax,%rdi
+  80264b:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802657:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80265b:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80265f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802663:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802667:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80266b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80266f:	48 01 d1             	add    %rdx,%rcx
+  802672:	48 89 c2             	mov    %rax,%rdx
+  802675:	48 89 cf             	mov    %rcx,%rdi
+  802678:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802684:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802688:	48 8b 10             	mov    (%rax),%rdx
+  80268b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80268f:	48 01 c2             	add    %rax,%rdx
+  802692:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802696:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269d:	48 89 c7             	mov    %rax,%rdi
+  8026a0:	48 b8 7f 24 80 00 00 	movabs $0x80247f,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  return n;
+  8026ac:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8026b0:	c9                   	leave
+  8026b1:	c3                   	ret
+
+00000000008026b2 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026b2:	55                   	push   %rbp
+  8026b3:	48 89 e5             	mov    %rsp,%rbp
+  8026b6:	48 83 ec 70          	sub    $0x70,%rsp
+  8026ba:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026be:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026c2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026c6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026ca:	48 89 c7             	mov    %rax,%rdi
+  8026cd:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+  8026d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026dd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026e1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026e5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026ec:	00 
+  8026ed:	e9 b8 01 00 00       	jmp    8028aa <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f6:	8b 40 18             	mov    0x18(%rax),%eax
+  8026f9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802700:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802708:	48 8b 00             	mov    (%rax),%rax
+  80270b:	48 29 c2             	sub    %rax,%rdx
+  80270e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802712:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802716:	48 39 c2             	cmp    %rax,%rdx
+  802719:	75 4d                	jne    802768 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80271b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80271f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802723:	48 89 d6             	mov    %rdx,%rsi
+  802726:	48 89 c7             	mov    %rax,%rdi
+  802729:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+  802735:	85 c0                	test   %eax,%eax
+  802737:	74 0a                	je     802743 <devpipe_write+0x91>
+        return 0;
+  802739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273e:	e9 79 01 00 00       	jmp    8028bc <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802743:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802746:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80274a:	89 d6                	mov    %edx,%esi
+  80274c:	48 89 c7             	mov    %rax,%rdi
+  80274f:	48 b8 d1 24 80 00 00 	movabs $0x8024d1,%rax
+  802756:	00 00 00 
+  802759:	ff d0                	call   *%rax
+      m = 0;
+  80275b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802762:	00 
+      continue;
+  802763:	e9 3a 01 00 00       	jmp    8028a2 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802768:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80276c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802770:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802778:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80277c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802780:	48 8b 08             	mov    (%rax),%rcx
+  802783:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802787:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80278b:	48 29 c1             	sub    %rax,%rcx
+  80278e:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802792:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802796:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80279a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80279e:	48 39 c2             	cmp    %rax,%rdx
+  8027a1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8027a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027b5:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027be:	48 f7 f1             	div    %rcx
+  8027c1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027c9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027d5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027d9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027dd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027e5:	48 39 c2             	cmp    %rax,%rdx
+  8027e8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027ec:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027f4:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027fc:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  802800:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802804:	48 01 d1             	add    %rdx,%rcx
+  802807:	48 89 c2             	mov    %rax,%rdx
+  80280a:	48 89 cf             	mov    %rcx,%rdi
+  80280d:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802819:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802821:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802825:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802829:	73 4d                	jae    802878 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80282b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802837:	48 29 c2             	sub    %rax,%rdx
+  80283a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80283e:	48 01 c2             	add    %rax,%rdx
+  802841:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802845:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802849:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80284d:	48 89 c1             	mov    %rax,%rcx
+  802850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802854:	48 01 c1             	add    %rax,%rcx
+  802857:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80285b:	48 01 c1             	add    %rax,%rcx
+  80285e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802862:	48 83 c0 20          	add    $0x20,%rax
+  802866:	48 89 ce             	mov    %rcx,%rsi
+  802869:	48 89 c7             	mov    %rax,%rdi
+  80286c:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802878:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802880:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802884:	48 01 c2             	add    %rax,%rdx
+  802887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80288b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80288f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802893:	48 89 c7             	mov    %rax,%rdi
+  802896:	48 b8 7f 24 80 00 00 	movabs $0x80247f,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8028a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028a6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8028aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ae:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028b2:	0f 82 3a fe ff ff    	jb     8026f2 <devpipe_write+0x40>
+  }
+
+  return i;
+  8028b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028bc:	c9                   	leave
+  8028bd:	c3                   	ret
+
+00000000008028be <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028be:	55                   	push   %rbp
+  8028bf:	48 89 e5             	mov    %rsp,%rbp
+  8028c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8028c6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028ca:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028d5:	48 89 c7             	mov    %rax,%rdi
+  8028d8:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f3:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028fb:	48 89 d6             	mov    %rdx,%rsi
+  8028fe:	48 89 c7             	mov    %rax,%rdi
+  802901:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  802908:	00 00 00 
+  80290b:	ff d0                	call   *%rax
+  80290d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802910:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802914:	79 08                	jns    80291e <devpipe_poll+0x60>
+    return r;
+  802916:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802919:	e9 85 00 00 00       	jmp    8029a3 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80291e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802921:	83 e0 01             	and    $0x1,%eax
+  802924:	85 c0                	test   %eax,%eax
+  802926:	74 18                	je     802940 <devpipe_poll+0x82>
+  802928:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80292c:	48 8b 10             	mov    (%rax),%rdx
+  80292f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802933:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802937:	48 39 c2             	cmp    %rax,%rdx
+  80293a:	74 04                	je     802940 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80293c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802940:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802943:	83 e0 02             	and    $0x2,%eax
+  802946:	85 c0                	test   %eax,%eax
+  802948:	74 23                	je     80296d <devpipe_poll+0xaf>
+  80294a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802952:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802956:	48 8b 00             	mov    (%rax),%rax
+  802959:	48 29 c2             	sub    %rax,%rdx
+  80295c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802960:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802964:	48 39 c2             	cmp    %rax,%rdx
+  802967:	73 04                	jae    80296d <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802969:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80296d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802971:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802975:	48 89 d6             	mov    %rdx,%rsi
+  802978:	48 89 c7             	mov    %rax,%rdi
+  80297b:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802982:	00 00 00 
+  802985:	ff d0                	call   *%rax
+  802987:	85 c0                	test   %eax,%eax
+  802989:	74 04                	je     80298f <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80298b:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80298f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802993:	75 0b                	jne    8029a0 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802995:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802999:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8029a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029a3:	c9                   	leave
+  8029a4:	c3                   	ret
+
+00000000008029a5 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029a5:	55                   	push   %rbp
+  8029a6:	48 89 e5             	mov    %rsp,%rbp
+  8029a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8029ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b9:	48 89 c7             	mov    %rax,%rdi
+  8029bc:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029d0:	48 ba e1 50 80 00 00 	movabs $0x8050e1,%rdx
+  8029d7:	00 00 00 
+  8029da:	48 89 d6             	mov    %rdx,%rsi
+  8029dd:	48 89 c7             	mov    %rax,%rdi
+  8029e0:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029f4:	89 c1                	mov    %eax,%ecx
+  8029f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029fa:	48 8b 00             	mov    (%rax),%rax
+  8029fd:	89 c2                	mov    %eax,%edx
+  8029ff:	89 c8                	mov    %ecx,%eax
+  802a01:	29 d0                	sub    %edx,%eax
+  802a03:	89 c2                	mov    %eax,%edx
+  802a05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a09:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a13:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a1a:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a21:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a28:	00 00 00 
+  802a2b:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+0000000000802a39 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	48 83 ec 40          	sub    $0x40,%rsp
+  802a41:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a49:	48 89 c7             	mov    %rax,%rdi
+  802a4c:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+  802a58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a5c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a63:	00 
+  802a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a68:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a70:	48 01 d0             	add    %rdx,%rax
+  802a73:	48 83 c0 1f          	add    $0x1f,%rax
+  802a77:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a84:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a8c:	48 29 d0             	sub    %rdx,%rax
+  802a8f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a93:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a9b:	48 89 c6             	mov    %rax,%rsi
+  802a9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa3:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802aaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab3:	48 89 c7             	mov    %rax,%rdi
+  802ab6:	48 b8 7f 24 80 00 00 	movabs $0x80247f,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ac2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ac6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802aca:	eb 2f                	jmp    802afb <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802acc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ad0:	48 83 e8 01          	sub    $0x1,%rax
+  802ad4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ad8:	48 89 c2             	mov    %rax,%rdx
+  802adb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802adf:	48 01 d0             	add    %rdx,%rax
+  802ae2:	48 89 c6             	mov    %rax,%rsi
+  802ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aea:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802af6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802afb:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802b00:	77 ca                	ja     802acc <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b06:	48 89 c6             	mov    %rax,%rsi
+  802b09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0e:	48 b8 74 04 80 00 00 	movabs $0x800474,%rax
+  802b15:	00 00 00 
+  802b18:	ff d0                	call   *%rax
+}
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+0000000000802b1c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b1c:	55                   	push   %rbp
+  802b1d:	48 89 e5             	mov    %rsp,%rbp
+  802b20:	48 83 ec 08          	sub    $0x8,%rsp
+  802b24:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b2b:	75 10                	jne    802b3d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b2d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b34:	00 00 00 
+  802b37:	8b 00                	mov    (%rax),%eax
+  802b39:	48 98                	cltq
+  802b3b:	eb 05                	jmp    802b42 <vsyscall+0x26>
+  }
+  return 0;
+  802b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b42:	c9                   	leave
+  802b43:	c3                   	ret
+
+0000000000802b44 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b44:	55                   	push   %rbp
+  802b45:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b48:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4d:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+}
+  802b59:	5d                   	pop    %rbp
+  802b5a:	c3                   	ret
+
+0000000000802b5b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b5b:	55                   	push   %rbp
+  802b5c:	48 89 e5             	mov    %rsp,%rbp
+  802b5f:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b63:	0f 31                	rdtsc
+  802b65:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b68:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b6e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b71:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b75:	48 09 d0             	or     %rdx,%rax
+  802b78:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b84:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b8b:	00 00 00 
+  802b8e:	8b 40 08             	mov    0x8(%rax),%eax
+  802b91:	48 98                	cltq
+  802b93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802ba4:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802bab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802baf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bb8:	48 89 d0             	mov    %rdx,%rax
+  802bbb:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bcb:	48 01 c8             	add    %rcx,%rax
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+0000000000802bd0 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bd0:	55                   	push   %rbp
+  802bd1:	48 89 e5             	mov    %rsp,%rbp
+  802bd4:	48 83 ec 20          	sub    $0x20,%rsp
+  802bd8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bde:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802be1:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802be5:	be 01 00 00 00       	mov    $0x1,%esi
+  802bea:	48 89 c7             	mov    %rax,%rdi
+  802bed:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  802bf4:	00 00 00 
+  802bf7:	ff d0                	call   *%rax
+}
+  802bf9:	90                   	nop
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+
+0000000000802bfc <getchar>:
+
+int
+getchar(void) {
+  802bfc:	55                   	push   %rbp
+  802bfd:	48 89 e5             	mov    %rsp,%rbp
+  802c00:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c04:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c08:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c0d:	48 89 c6             	mov    %rax,%rsi
+  802c10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c15:	48 b8 2f 11 80 00 00 	movabs $0x80112f,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+  802c21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c28:	79 05                	jns    802c2f <getchar+0x33>
+    return r;
+  802c2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c2d:	eb 14                	jmp    802c43 <getchar+0x47>
+  if (r < 1)
+  802c2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c33:	7f 07                	jg     802c3c <getchar+0x40>
+    return -E_EOF;
+  802c35:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c3a:	eb 07                	jmp    802c43 <getchar+0x47>
+  return c;
+  802c3c:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c40:	0f b6 c0             	movzbl %al,%eax
+}
+  802c43:	c9                   	leave
+  802c44:	c3                   	ret
+
+0000000000802c45 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c45:	55                   	push   %rbp
+  802c46:	48 89 e5             	mov    %rsp,%rbp
+  802c49:	48 83 ec 20          	sub    $0x20,%rsp
+  802c4d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c50:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c57:	48 89 d6             	mov    %rdx,%rsi
+  802c5a:	89 c7                	mov    %eax,%edi
+  802c5c:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802c63:	00 00 00 
+  802c66:	ff d0                	call   *%rax
+  802c68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c6f:	79 05                	jns    802c76 <iscons+0x31>
+    return r;
+  802c71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c74:	eb 1a                	jmp    802c90 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c7a:	8b 10                	mov    (%rax),%edx
+  802c7c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c83:	00 00 00 
+  802c86:	8b 00                	mov    (%rax),%eax
+  802c88:	39 c2                	cmp    %eax,%edx
+  802c8a:	0f 94 c0             	sete   %al
+  802c8d:	0f b6 c0             	movzbl %al,%eax
+}
+  802c90:	c9                   	leave
+  802c91:	c3                   	ret
+
+0000000000802c92 <opencons>:
+
+int
+opencons(void) {
+  802c92:	55                   	push   %rbp
+  802c93:	48 89 e5             	mov    %rsp,%rbp
+  802c96:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c9a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c9e:	48 89 c7             	mov    %rax,%rdi
+  802ca1:	48 b8 f1 0a 80 00 00 	movabs $0x800af1,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+  802cad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cb0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb4:	79 05                	jns    802cbb <opencons+0x29>
+    return r;
+  802cb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cb9:	eb 66                	jmp    802d21 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802cbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cbf:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cc4:	48 89 c6             	mov    %rax,%rsi
+  802cc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccc:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  802cd3:	00 00 00 
+  802cd6:	ff d0                	call   *%rax
+  802cd8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cdb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cdf:	79 05                	jns    802ce6 <opencons+0x54>
+    return r;
+  802ce1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce4:	eb 3b                	jmp    802d21 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cea:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cf1:	00 00 00 
+  802cf4:	8b 12                	mov    (%rdx),%edx
+  802cf6:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cf8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d07:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d12:	48 89 c7             	mov    %rax,%rdi
+  802d15:	48 b8 a3 0a 80 00 00 	movabs $0x800aa3,%rax
+  802d1c:	00 00 00 
+  802d1f:	ff d0                	call   *%rax
+}
+  802d21:	c9                   	leave
+  802d22:	c3                   	ret
+
+0000000000802d23 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d23:	55                   	push   %rbp
+  802d24:	48 89 e5             	mov    %rsp,%rbp
+  802d27:	48 83 ec 20          	sub    $0x20,%rsp
+  802d2b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d2e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d31:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d38:	48 89 d6             	mov    %rdx,%rsi
+  802d3b:	89 c7                	mov    %eax,%edi
+  802d3d:	48 b8 d3 0b 80 00 00 	movabs $0x800bd3,%rax
+  802d44:	00 00 00 
+  802d47:	ff d0                	call   *%rax
+  802d49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d50:	79 05                	jns    802d57 <consmode+0x34>
+    return r;
+  802d52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d55:	eb 34                	jmp    802d8b <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d5b:	8b 10                	mov    (%rax),%edx
+  802d5d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d64:	00 00 00 
+  802d67:	8b 00                	mov    (%rax),%eax
+  802d69:	39 c2                	cmp    %eax,%edx
+  802d6b:	74 07                	je     802d74 <consmode+0x51>
+    return -E_INVAL;
+  802d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d72:	eb 17                	jmp    802d8b <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d78:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d7b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d82:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d85:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d8b:	c9                   	leave
+  802d8c:	c3                   	ret
+
+0000000000802d8d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d8d:	55                   	push   %rbp
+  802d8e:	48 89 e5             	mov    %rsp,%rbp
+  802d91:	48 83 ec 20          	sub    $0x20,%rsp
+  802d95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802da1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802da5:	8b 50 0c             	mov    0xc(%rax),%edx
+  802da8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db0:	48 89 ce             	mov    %rcx,%rsi
+  802db3:	48 89 c7             	mov    %rax,%rdi
+  802db6:	48 b8 16 07 80 00 00 	movabs $0x800716,%rax
+  802dbd:	00 00 00 
+  802dc0:	ff d0                	call   *%rax
+  802dc2:	48 98                	cltq
+}
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+
+0000000000802dc6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dc6:	55                   	push   %rbp
+  802dc7:	48 89 e5             	mov    %rsp,%rbp
+  802dca:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dd1:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dd8:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802ddf:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802de6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ded:	eb 74                	jmp    802e63 <devcons_write+0x9d>
+    m = n - tot;
+  802def:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802df6:	89 c2                	mov    %eax,%edx
+  802df8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dfb:	29 c2                	sub    %eax,%edx
+  802dfd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802e00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e03:	83 f8 7f             	cmp    $0x7f,%eax
+  802e06:	76 07                	jbe    802e0f <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e08:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e0f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e12:	48 63 d0             	movslq %eax,%rdx
+  802e15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e18:	48 63 c8             	movslq %eax,%rcx
+  802e1b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e22:	48 01 c1             	add    %rax,%rcx
+  802e25:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e2c:	48 89 ce             	mov    %rcx,%rsi
+  802e2f:	48 89 c7             	mov    %rax,%rdi
+  802e32:	48 b8 5e 46 80 00 00 	movabs $0x80465e,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e41:	48 63 d0             	movslq %eax,%rdx
+  802e44:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e4b:	48 89 d6             	mov    %rdx,%rsi
+  802e4e:	48 89 c7             	mov    %rax,%rdi
+  802e51:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  802e58:	00 00 00 
+  802e5b:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e5d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e60:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e66:	48 98                	cltq
+  802e68:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e6f:	0f 82 7a ff ff ff    	jb     802def <devcons_write+0x29>
+  }
+  return tot;
+  802e75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e78:	48 98                	cltq
+}
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+0000000000802e7c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e7c:	55                   	push   %rbp
+  802e7d:	48 89 e5             	mov    %rsp,%rbp
+  802e80:	48 83 ec 08          	sub    $0x8,%rsp
+  802e84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e8d:	c9                   	leave
+  802e8e:	c3                   	ret
+
+0000000000802e8f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e8f:	55                   	push   %rbp
+  802e90:	48 89 e5             	mov    %rsp,%rbp
+  802e93:	48 83 ec 10          	sub    $0x10,%rsp
+  802e97:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e9b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea3:	48 ba ed 50 80 00 00 	movabs $0x8050ed,%rdx
+  802eaa:	00 00 00 
+  802ead:	48 89 d6             	mov    %rdx,%rsi
+  802eb0:	48 89 c7             	mov    %rax,%rdi
+  802eb3:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+  return 0;
+  802ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ec4:	c9                   	leave
+  802ec5:	c3                   	ret
+
+0000000000802ec6 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ec6:	55                   	push   %rbp
+  802ec7:	48 89 e5             	mov    %rsp,%rbp
+  802eca:	48 83 ec 30          	sub    $0x30,%rsp
+  802ece:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ed2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802ed5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ed9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ee0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ee3:	83 e0 02             	and    $0x2,%eax
+  802ee6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ee9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eed:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ef0:	83 f8 01             	cmp    $0x1,%eax
+  802ef3:	75 04                	jne    802ef9 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ef5:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ef9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802efc:	83 e0 01             	and    $0x1,%eax
+  802eff:	85 c0                	test   %eax,%eax
+  802f01:	74 44                	je     802f47 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f0b:	89 c2                	mov    %eax,%edx
+  802f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f17:	48 b8 04 08 80 00 00 	movabs $0x800804,%rax
+  802f1e:	00 00 00 
+  802f21:	ff d0                	call   *%rax
+  802f23:	83 f8 01             	cmp    $0x1,%eax
+  802f26:	75 06                	jne    802f2e <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f28:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f2c:	eb 19                	jmp    802f47 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f32:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f38:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f3b:	89 c2                	mov    %eax,%edx
+  802f3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f41:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f4a:	c9                   	leave
+  802f4b:	c3                   	ret
+
+0000000000802f4c <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f4c:	55                   	push   %rbp
+  802f4d:	48 89 e5             	mov    %rsp,%rbp
+  802f50:	53                   	push   %rbx
+  802f51:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f58:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f5f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f65:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f6c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f73:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f7a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f81:	84 c0                	test   %al,%al
+  802f83:	74 23                	je     802fa8 <_panic+0x5c>
+  802f85:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f8c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f90:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f94:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f98:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f9c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802fa0:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802fa4:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802fa8:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802faf:	00 00 00 
+  802fb2:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fb9:	00 00 00 
+  802fbc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fc0:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fc7:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fce:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fd5:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  802fdc:	00 00 00 
+  802fdf:	48 8b 18             	mov    (%rax),%rbx
+  802fe2:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  802fe9:	00 00 00 
+  802fec:	ff d0                	call   *%rax
+  802fee:	89 c6                	mov    %eax,%esi
+  802ff0:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802ff6:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802ffd:	41 89 d0             	mov    %edx,%r8d
+  803000:	48 89 c1             	mov    %rax,%rcx
+  803003:	48 89 da             	mov    %rbx,%rdx
+  803006:	48 b8 f8 50 80 00 00 	movabs $0x8050f8,%rax
+  80300d:	00 00 00 
+  803010:	48 89 c7             	mov    %rax,%rdi
+  803013:	b8 00 00 00 00       	mov    $0x0,%eax
+  803018:	49 b9 6b 31 80 00 00 	movabs $0x80316b,%r9
+  80301f:	00 00 00 
+  803022:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803025:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80302c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803033:	48 89 d6             	mov    %rdx,%rsi
+  803036:	48 89 c7             	mov    %rax,%rdi
+  803039:	48 b8 e0 30 80 00 00 	movabs $0x8030e0,%rax
+  803040:	00 00 00 
+  803043:	ff d0                	call   *%rax
+  cprintf("\n");
+  803045:	48 b8 1b 51 80 00 00 	movabs $0x80511b,%rax
+  80304c:	00 00 00 
+  80304f:	48 89 c7             	mov    %rax,%rdi
+  803052:	b8 00 00 00 00       	mov    $0x0,%eax
+  803057:	48 ba 6b 31 80 00 00 	movabs $0x80316b,%rdx
+  80305e:	00 00 00 
+  803061:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803063:	cc                   	int3
+  803064:	eb fd                	jmp    803063 <_panic+0x117>
+
+0000000000803066 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803066:	55                   	push   %rbp
+  803067:	48 89 e5             	mov    %rsp,%rbp
+  80306a:	48 83 ec 10          	sub    $0x10,%rsp
+  80306e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803071:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803079:	8b 00                	mov    (%rax),%eax
+  80307b:	8d 48 01             	lea    0x1(%rax),%ecx
+  80307e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803082:	89 0a                	mov    %ecx,(%rdx)
+  803084:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803087:	89 d1                	mov    %edx,%ecx
+  803089:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80308d:	48 98                	cltq
+  80308f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803093:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803097:	8b 00                	mov    (%rax),%eax
+  803099:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80309e:	75 2c                	jne    8030cc <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8030a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a4:	8b 00                	mov    (%rax),%eax
+  8030a6:	48 98                	cltq
+  8030a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030ac:	48 83 c2 08          	add    $0x8,%rdx
+  8030b0:	48 89 c6             	mov    %rax,%rsi
+  8030b3:	48 89 d7             	mov    %rdx,%rdi
+  8030b6:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d0:	8b 40 04             	mov    0x4(%rax),%eax
+  8030d3:	8d 50 01             	lea    0x1(%rax),%edx
+  8030d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030da:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030dd:	90                   	nop
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+
+00000000008030e0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030e0:	55                   	push   %rbp
+  8030e1:	48 89 e5             	mov    %rsp,%rbp
+  8030e4:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030eb:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030f2:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030f9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  803100:	00 00 00 
+  b.cnt = 0;
+  803103:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80310a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80310d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803114:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80311b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803122:	48 89 c6             	mov    %rax,%rsi
+  803125:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  80312c:	00 00 00 
+  80312f:	48 89 c7             	mov    %rax,%rdi
+  803132:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80313e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803144:	48 98                	cltq
+  803146:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80314d:	48 83 c2 08          	add    $0x8,%rdx
+  803151:	48 89 c6             	mov    %rax,%rsi
+  803154:	48 89 d7             	mov    %rdx,%rdi
+  803157:	48 b8 a5 01 80 00 00 	movabs $0x8001a5,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803163:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  803169:	c9                   	leave
+  80316a:	c3                   	ret
+
+000000000080316b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80316b:	55                   	push   %rbp
+  80316c:	48 89 e5             	mov    %rsp,%rbp
+  80316f:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803176:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80317d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803184:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80318b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803192:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803199:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8031a0:	84 c0                	test   %al,%al
+  8031a2:	74 20                	je     8031c4 <cprintf+0x59>
+  8031a4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8031a8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8031ac:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8031b0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031b4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031b8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031bc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031c0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031c4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031cb:	00 00 00 
+  8031ce:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031d5:	00 00 00 
+  8031d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031dc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031e3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031ea:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031f1:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031f8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031ff:	48 89 d6             	mov    %rdx,%rsi
+  803202:	48 89 c7             	mov    %rax,%rdi
+  803205:	48 b8 e0 30 80 00 00 	movabs $0x8030e0,%rax
+  80320c:	00 00 00 
+  80320f:	ff d0                	call   *%rax
+  803211:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803217:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+
+000000000080321f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80321f:	55                   	push   %rbp
+  803220:	48 89 e5             	mov    %rsp,%rbp
+  803223:	48 83 ec 30          	sub    $0x30,%rsp
+  803227:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80322b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80322f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803233:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803236:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80323a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80323e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803241:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803245:	72 54                	jb     80329b <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803247:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80324a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80324d:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803254:	ba 00 00 00 00       	mov    $0x0,%edx
+  803259:	48 f7 f6             	div    %rsi
+  80325c:	49 89 c2             	mov    %rax,%r10
+  80325f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803262:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803265:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803269:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80326d:	41 89 c9             	mov    %ecx,%r9d
+  803270:	41 89 f8             	mov    %edi,%r8d
+  803273:	89 d1                	mov    %edx,%ecx
+  803275:	4c 89 d2             	mov    %r10,%rdx
+  803278:	48 89 c7             	mov    %rax,%rdi
+  80327b:	48 b8 1f 32 80 00 00 	movabs $0x80321f,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	eb 1c                	jmp    8032a5 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  803289:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80328d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803290:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803294:	48 89 d6             	mov    %rdx,%rsi
+  803297:	89 c7                	mov    %eax,%edi
+  803299:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80329b:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80329f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8032a3:	7f e4                	jg     803289 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8032a5:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8032a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b1:	48 f7 f1             	div    %rcx
+  8032b4:	48 b8 50 53 80 00 00 	movabs $0x805350,%rax
+  8032bb:	00 00 00 
+  8032be:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032c2:	0f be c0             	movsbl %al,%eax
+  8032c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032c9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032cd:	48 89 d6             	mov    %rdx,%rsi
+  8032d0:	89 c7                	mov    %eax,%edi
+  8032d2:	ff d1                	call   *%rcx
+}
+  8032d4:	90                   	nop
+  8032d5:	c9                   	leave
+  8032d6:	c3                   	ret
+
+00000000008032d7 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032d7:	55                   	push   %rbp
+  8032d8:	48 89 e5             	mov    %rsp,%rbp
+  8032db:	48 83 ec 10          	sub    $0x10,%rsp
+  8032df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032e6:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032ea:	7e 4b                	jle    803337 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f0:	8b 00                	mov    (%rax),%eax
+  8032f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f5:	77 24                	ja     80331b <getuint+0x44>
+  8032f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803303:	8b 00                	mov    (%rax),%eax
+  803305:	89 c0                	mov    %eax,%eax
+  803307:	48 01 d0             	add    %rdx,%rax
+  80330a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330e:	8b 12                	mov    (%rdx),%edx
+  803310:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803317:	89 0a                	mov    %ecx,(%rdx)
+  803319:	eb 14                	jmp    80332f <getuint+0x58>
+  80331b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80331f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803323:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803327:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80332b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80332f:	48 8b 00             	mov    (%rax),%rax
+  803332:	e9 95 00 00 00       	jmp    8033cc <getuint+0xf5>
+  else if (lflag)
+  803337:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80333b:	74 48                	je     803385 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80333d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803341:	8b 00                	mov    (%rax),%eax
+  803343:	83 f8 2f             	cmp    $0x2f,%eax
+  803346:	77 24                	ja     80336c <getuint+0x95>
+  803348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80334c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803354:	8b 00                	mov    (%rax),%eax
+  803356:	89 c0                	mov    %eax,%eax
+  803358:	48 01 d0             	add    %rdx,%rax
+  80335b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335f:	8b 12                	mov    (%rdx),%edx
+  803361:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803364:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803368:	89 0a                	mov    %ecx,(%rdx)
+  80336a:	eb 14                	jmp    803380 <getuint+0xa9>
+  80336c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803370:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803374:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803378:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80337c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803380:	48 8b 00             	mov    (%rax),%rax
+  803383:	eb 47                	jmp    8033cc <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803385:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803389:	8b 00                	mov    (%rax),%eax
+  80338b:	83 f8 2f             	cmp    $0x2f,%eax
+  80338e:	77 24                	ja     8033b4 <getuint+0xdd>
+  803390:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803394:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339c:	8b 00                	mov    (%rax),%eax
+  80339e:	89 c0                	mov    %eax,%eax
+  8033a0:	48 01 d0             	add    %rdx,%rax
+  8033a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a7:	8b 12                	mov    (%rdx),%edx
+  8033a9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b0:	89 0a                	mov    %ecx,(%rdx)
+  8033b2:	eb 14                	jmp    8033c8 <getuint+0xf1>
+  8033b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033bc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033c8:	8b 00                	mov    (%rax),%eax
+  8033ca:	89 c0                	mov    %eax,%eax
+}
+  8033cc:	c9                   	leave
+  8033cd:	c3                   	ret
+
+00000000008033ce <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+  8033d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033da:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033dd:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033e1:	7e 4b                	jle    80342e <getint+0x60>
+    return va_arg(*ap, long long);
+  8033e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e7:	8b 00                	mov    (%rax),%eax
+  8033e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ec:	77 24                	ja     803412 <getint+0x44>
+  8033ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033fa:	8b 00                	mov    (%rax),%eax
+  8033fc:	89 c0                	mov    %eax,%eax
+  8033fe:	48 01 d0             	add    %rdx,%rax
+  803401:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803405:	8b 12                	mov    (%rdx),%edx
+  803407:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80340a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80340e:	89 0a                	mov    %ecx,(%rdx)
+  803410:	eb 14                	jmp    803426 <getint+0x58>
+  803412:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803416:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80341a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80341e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803422:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803426:	48 8b 00             	mov    (%rax),%rax
+  803429:	e9 95 00 00 00       	jmp    8034c3 <getint+0xf5>
+  else if (lflag)
+  80342e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803432:	74 48                	je     80347c <getint+0xae>
+    return va_arg(*ap, long);
+  803434:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803438:	8b 00                	mov    (%rax),%eax
+  80343a:	83 f8 2f             	cmp    $0x2f,%eax
+  80343d:	77 24                	ja     803463 <getint+0x95>
+  80343f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803443:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803447:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344b:	8b 00                	mov    (%rax),%eax
+  80344d:	89 c0                	mov    %eax,%eax
+  80344f:	48 01 d0             	add    %rdx,%rax
+  803452:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803456:	8b 12                	mov    (%rdx),%edx
+  803458:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80345b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80345f:	89 0a                	mov    %ecx,(%rdx)
+  803461:	eb 14                	jmp    803477 <getint+0xa9>
+  803463:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803467:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80346b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80346f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803473:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803477:	48 8b 00             	mov    (%rax),%rax
+  80347a:	eb 47                	jmp    8034c3 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80347c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803480:	8b 00                	mov    (%rax),%eax
+  803482:	83 f8 2f             	cmp    $0x2f,%eax
+  803485:	77 24                	ja     8034ab <getint+0xdd>
+  803487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80348f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803493:	8b 00                	mov    (%rax),%eax
+  803495:	89 c0                	mov    %eax,%eax
+  803497:	48 01 d0             	add    %rdx,%rax
+  80349a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349e:	8b 12                	mov    (%rdx),%edx
+  8034a0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034a7:	89 0a                	mov    %ecx,(%rdx)
+  8034a9:	eb 14                	jmp    8034bf <getint+0xf1>
+  8034ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034af:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034b3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034bb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034bf:	8b 00                	mov    (%rax),%eax
+  8034c1:	48 98                	cltq
+}
+  8034c3:	c9                   	leave
+  8034c4:	c3                   	ret
+
+00000000008034c5 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034c5:	55                   	push   %rbp
+  8034c6:	48 89 e5             	mov    %rsp,%rbp
+  8034c9:	41 54                	push   %r12
+  8034cb:	53                   	push   %rbx
+  8034cc:	48 83 ec 60          	sub    $0x60,%rsp
+  8034d0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034d4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034d8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034dc:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034e0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034e4:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034e8:	48 8b 06             	mov    (%rsi),%rax
+  8034eb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034ef:	48 89 01             	mov    %rax,(%rcx)
+  8034f2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034f6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034fa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034fe:	eb 17                	jmp    803517 <vprintfmt+0x52>
+      if (ch == '\0')
+  803500:	85 db                	test   %ebx,%ebx
+  803502:	0f 84 bf 04 00 00    	je     8039c7 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  803508:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80350c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803510:	48 89 c6             	mov    %rax,%rsi
+  803513:	89 df                	mov    %ebx,%edi
+  803515:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803517:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80351b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80351f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803523:	0f b6 00             	movzbl (%rax),%eax
+  803526:	0f b6 d8             	movzbl %al,%ebx
+  803529:	83 fb 25             	cmp    $0x25,%ebx
+  80352c:	75 d2                	jne    803500 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80352e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803532:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  803539:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803540:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803547:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80354e:	eb 04                	jmp    803554 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803550:	90                   	nop
+  803551:	eb 01                	jmp    803554 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803553:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803554:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803558:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80355c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803560:	0f b6 00             	movzbl (%rax),%eax
+  803563:	0f b6 d8             	movzbl %al,%ebx
+  803566:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  803569:	83 f8 55             	cmp    $0x55,%eax
+  80356c:	0f 87 22 04 00 00    	ja     803994 <vprintfmt+0x4cf>
+  803572:	89 c0                	mov    %eax,%eax
+  803574:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80357b:	00 
+  80357c:	48 b8 78 53 80 00 00 	movabs $0x805378,%rax
+  803583:	00 00 00 
+  803586:	48 01 d0             	add    %rdx,%rax
+  803589:	48 8b 00             	mov    (%rax),%rax
+  80358c:	ff e0                	jmp    *%rax
+        padc = '-';
+  80358e:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803592:	eb c0                	jmp    803554 <vprintfmt+0x8f>
+        padc = '0';
+  803594:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803598:	eb ba                	jmp    803554 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80359a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035a1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8035a4:	89 d0                	mov    %edx,%eax
+  8035a6:	c1 e0 02             	shl    $0x2,%eax
+  8035a9:	01 d0                	add    %edx,%eax
+  8035ab:	01 c0                	add    %eax,%eax
+  8035ad:	01 d8                	add    %ebx,%eax
+  8035af:	83 e8 30             	sub    $0x30,%eax
+  8035b2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035b5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035b9:	0f b6 00             	movzbl (%rax),%eax
+  8035bc:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035bf:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035c2:	7e 60                	jle    803624 <vprintfmt+0x15f>
+  8035c4:	83 fb 39             	cmp    $0x39,%ebx
+  8035c7:	7f 5b                	jg     803624 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035c9:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035ce:	eb d1                	jmp    8035a1 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d6:	77 17                	ja     8035ef <vprintfmt+0x12a>
+  8035d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035dc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035df:	89 d2                	mov    %edx,%edx
+  8035e1:	48 01 d0             	add    %rdx,%rax
+  8035e4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035e7:	83 c2 08             	add    $0x8,%edx
+  8035ea:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035ed:	eb 0c                	jmp    8035fb <vprintfmt+0x136>
+  8035ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035f3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035f7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035fb:	8b 00                	mov    (%rax),%eax
+  8035fd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  803600:	eb 23                	jmp    803625 <vprintfmt+0x160>
+        if (width < 0)
+  803602:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803606:	0f 89 44 ff ff ff    	jns    803550 <vprintfmt+0x8b>
+          width = 0;
+  80360c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803613:	e9 38 ff ff ff       	jmp    803550 <vprintfmt+0x8b>
+        altflag = 1;
+  803618:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80361f:	e9 30 ff ff ff       	jmp    803554 <vprintfmt+0x8f>
+        goto process_precision;
+  803624:	90                   	nop
+        if (width < 0)
+  803625:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803629:	0f 89 24 ff ff ff    	jns    803553 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80362f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803632:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803635:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80363c:	e9 12 ff ff ff       	jmp    803553 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803641:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803645:	e9 0a ff ff ff       	jmp    803554 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80364a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364d:	83 f8 2f             	cmp    $0x2f,%eax
+  803650:	77 17                	ja     803669 <vprintfmt+0x1a4>
+  803652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803656:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803659:	89 d2                	mov    %edx,%edx
+  80365b:	48 01 d0             	add    %rdx,%rax
+  80365e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803661:	83 c2 08             	add    $0x8,%edx
+  803664:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803667:	eb 0c                	jmp    803675 <vprintfmt+0x1b0>
+  803669:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80366d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803671:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803675:	8b 00                	mov    (%rax),%eax
+  803677:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80367b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80367f:	48 89 d6             	mov    %rdx,%rsi
+  803682:	89 c7                	mov    %eax,%edi
+  803684:	ff d1                	call   *%rcx
+        break;
+  803686:	e9 37 03 00 00       	jmp    8039c2 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80368b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80368e:	83 f8 2f             	cmp    $0x2f,%eax
+  803691:	77 17                	ja     8036aa <vprintfmt+0x1e5>
+  803693:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803697:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80369a:	89 d2                	mov    %edx,%edx
+  80369c:	48 01 d0             	add    %rdx,%rax
+  80369f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036a2:	83 c2 08             	add    $0x8,%edx
+  8036a5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036a8:	eb 0c                	jmp    8036b6 <vprintfmt+0x1f1>
+  8036aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036b2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036b6:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036b8:	85 db                	test   %ebx,%ebx
+  8036ba:	79 02                	jns    8036be <vprintfmt+0x1f9>
+          err = -err;
+  8036bc:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036be:	83 fb 15             	cmp    $0x15,%ebx
+  8036c1:	7f 16                	jg     8036d9 <vprintfmt+0x214>
+  8036c3:	48 ba a0 52 80 00 00 	movabs $0x8052a0,%rdx
+  8036ca:	00 00 00 
+  8036cd:	48 63 c3             	movslq %ebx,%rax
+  8036d0:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036d4:	4d 85 e4             	test   %r12,%r12
+  8036d7:	75 2e                	jne    803707 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036d9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036e1:	89 d9                	mov    %ebx,%ecx
+  8036e3:	48 ba 61 53 80 00 00 	movabs $0x805361,%rdx
+  8036ea:	00 00 00 
+  8036ed:	48 89 c7             	mov    %rax,%rdi
+  8036f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f5:	49 b8 d1 39 80 00 00 	movabs $0x8039d1,%r8
+  8036fc:	00 00 00 
+  8036ff:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803702:	e9 bb 02 00 00       	jmp    8039c2 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  803707:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80370b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80370f:	4c 89 e1             	mov    %r12,%rcx
+  803712:	48 ba 6a 53 80 00 00 	movabs $0x80536a,%rdx
+  803719:	00 00 00 
+  80371c:	48 89 c7             	mov    %rax,%rdi
+  80371f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803724:	49 b8 d1 39 80 00 00 	movabs $0x8039d1,%r8
+  80372b:	00 00 00 
+  80372e:	41 ff d0             	call   *%r8
+        break;
+  803731:	e9 8c 02 00 00       	jmp    8039c2 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803736:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803739:	83 f8 2f             	cmp    $0x2f,%eax
+  80373c:	77 17                	ja     803755 <vprintfmt+0x290>
+  80373e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803742:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803745:	89 d2                	mov    %edx,%edx
+  803747:	48 01 d0             	add    %rdx,%rax
+  80374a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80374d:	83 c2 08             	add    $0x8,%edx
+  803750:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803753:	eb 0c                	jmp    803761 <vprintfmt+0x29c>
+  803755:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803759:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80375d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803761:	4c 8b 20             	mov    (%rax),%r12
+  803764:	4d 85 e4             	test   %r12,%r12
+  803767:	75 0a                	jne    803773 <vprintfmt+0x2ae>
+          p = "(null)";
+  803769:	49 bc 6d 53 80 00 00 	movabs $0x80536d,%r12
+  803770:	00 00 00 
+        if (width > 0 && padc != '-')
+  803773:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803777:	7e 78                	jle    8037f1 <vprintfmt+0x32c>
+  803779:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80377d:	74 72                	je     8037f1 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80377f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803782:	48 98                	cltq
+  803784:	48 89 c6             	mov    %rax,%rsi
+  803787:	4c 89 e7             	mov    %r12,%rdi
+  80378a:	48 b8 dd 40 80 00 00 	movabs $0x8040dd,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+  803796:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803799:	eb 17                	jmp    8037b2 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80379b:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80379f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8037a3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8037a7:	48 89 d6             	mov    %rdx,%rsi
+  8037aa:	89 c7                	mov    %eax,%edi
+  8037ac:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037ae:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037b2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037b6:	7f e3                	jg     80379b <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037b8:	eb 37                	jmp    8037f1 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037ba:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037be:	74 1e                	je     8037de <vprintfmt+0x319>
+  8037c0:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037c3:	7e 05                	jle    8037ca <vprintfmt+0x305>
+  8037c5:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037c8:	7e 14                	jle    8037de <vprintfmt+0x319>
+            putch('?', putdat);
+  8037ca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037ce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037d2:	48 89 c6             	mov    %rax,%rsi
+  8037d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037da:	ff d2                	call   *%rdx
+  8037dc:	eb 0f                	jmp    8037ed <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037de:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037e2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037e6:	48 89 c6             	mov    %rax,%rsi
+  8037e9:	89 df                	mov    %ebx,%edi
+  8037eb:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037ed:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037f1:	4c 89 e0             	mov    %r12,%rax
+  8037f4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037f8:	0f b6 00             	movzbl (%rax),%eax
+  8037fb:	0f be d8             	movsbl %al,%ebx
+  8037fe:	85 db                	test   %ebx,%ebx
+  803800:	74 28                	je     80382a <vprintfmt+0x365>
+  803802:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803806:	78 b2                	js     8037ba <vprintfmt+0x2f5>
+  803808:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80380c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803810:	79 a8                	jns    8037ba <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803812:	eb 16                	jmp    80382a <vprintfmt+0x365>
+          putch(' ', putdat);
+  803814:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803818:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80381c:	48 89 c6             	mov    %rax,%rsi
+  80381f:	bf 20 00 00 00       	mov    $0x20,%edi
+  803824:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803826:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80382a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80382e:	7f e4                	jg     803814 <vprintfmt+0x34f>
+        break;
+  803830:	e9 8d 01 00 00       	jmp    8039c2 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803835:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803838:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80383c:	89 d6                	mov    %edx,%esi
+  80383e:	48 89 c7             	mov    %rax,%rdi
+  803841:	48 b8 ce 33 80 00 00 	movabs $0x8033ce,%rax
+  803848:	00 00 00 
+  80384b:	ff d0                	call   *%rax
+  80384d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803855:	48 85 c0             	test   %rax,%rax
+  803858:	79 1d                	jns    803877 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80385a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80385e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803862:	48 89 c6             	mov    %rax,%rsi
+  803865:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80386a:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80386c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803870:	48 f7 d8             	neg    %rax
+  803873:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803877:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80387e:	e9 d2 00 00 00       	jmp    803955 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803883:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803886:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80388a:	89 d6                	mov    %edx,%esi
+  80388c:	48 89 c7             	mov    %rax,%rdi
+  80388f:	48 b8 d7 32 80 00 00 	movabs $0x8032d7,%rax
+  803896:	00 00 00 
+  803899:	ff d0                	call   *%rax
+  80389b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80389f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038a6:	e9 aa 00 00 00       	jmp    803955 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8038ab:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038ae:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038b2:	89 d6                	mov    %edx,%esi
+  8038b4:	48 89 c7             	mov    %rax,%rdi
+  8038b7:	48 b8 d7 32 80 00 00 	movabs $0x8032d7,%rax
+  8038be:	00 00 00 
+  8038c1:	ff d0                	call   *%rax
+  8038c3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038c7:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038ce:	e9 82 00 00 00       	jmp    803955 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038d3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038d7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038db:	48 89 c6             	mov    %rax,%rsi
+  8038de:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038e3:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038e5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038e9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038ed:	48 89 c6             	mov    %rax,%rsi
+  8038f0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038f5:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8038fd:	77 17                	ja     803916 <vprintfmt+0x451>
+  8038ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803903:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803906:	89 d2                	mov    %edx,%edx
+  803908:	48 01 d0             	add    %rdx,%rax
+  80390b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80390e:	83 c2 08             	add    $0x8,%edx
+  803911:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803914:	eb 0c                	jmp    803922 <vprintfmt+0x45d>
+  803916:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80391a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80391e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803922:	48 8b 00             	mov    (%rax),%rax
+  803925:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803929:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803930:	eb 23                	jmp    803955 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803932:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803935:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803939:	89 d6                	mov    %edx,%esi
+  80393b:	48 89 c7             	mov    %rax,%rdi
+  80393e:	48 b8 d7 32 80 00 00 	movabs $0x8032d7,%rax
+  803945:	00 00 00 
+  803948:	ff d0                	call   *%rax
+  80394a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80394e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803955:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80395a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80395d:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803960:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803964:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803968:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80396c:	45 89 c1             	mov    %r8d,%r9d
+  80396f:	41 89 f8             	mov    %edi,%r8d
+  803972:	48 89 c7             	mov    %rax,%rdi
+  803975:	48 b8 1f 32 80 00 00 	movabs $0x80321f,%rax
+  80397c:	00 00 00 
+  80397f:	ff d0                	call   *%rax
+        break;
+  803981:	eb 3f                	jmp    8039c2 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803983:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803987:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80398b:	48 89 c6             	mov    %rax,%rsi
+  80398e:	89 df                	mov    %ebx,%edi
+  803990:	ff d2                	call   *%rdx
+        break;
+  803992:	eb 2e                	jmp    8039c2 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803994:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803998:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80399c:	48 89 c6             	mov    %rax,%rsi
+  80399f:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039a4:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8039a6:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039ab:	eb 05                	jmp    8039b2 <vprintfmt+0x4ed>
+  8039ad:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039b2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039b6:	48 83 e8 01          	sub    $0x1,%rax
+  8039ba:	0f b6 00             	movzbl (%rax),%eax
+  8039bd:	3c 25                	cmp    $0x25,%al
+  8039bf:	75 ec                	jne    8039ad <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039c1:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039c2:	e9 50 fb ff ff       	jmp    803517 <vprintfmt+0x52>
+        return;
+  8039c7:	90                   	nop
+    }
+  }
+}
+  8039c8:	48 83 c4 60          	add    $0x60,%rsp
+  8039cc:	5b                   	pop    %rbx
+  8039cd:	41 5c                	pop    %r12
+  8039cf:	5d                   	pop    %rbp
+  8039d0:	c3                   	ret
+
+00000000008039d1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039d1:	55                   	push   %rbp
+  8039d2:	48 89 e5             	mov    %rsp,%rbp
+  8039d5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039dc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039e3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039ea:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039f1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039f8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039ff:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a06:	84 c0                	test   %al,%al
+  803a08:	74 20                	je     803a2a <printfmt+0x59>
+  803a0a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a0e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a12:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a16:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a1a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a1e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a22:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a26:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a2a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a31:	00 00 00 
+  803a34:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a3b:	00 00 00 
+  803a3e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a42:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a49:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a50:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a57:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a5e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a65:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a6c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a73:	48 89 c7             	mov    %rax,%rdi
+  803a76:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  803a7d:	00 00 00 
+  803a80:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a82:	90                   	nop
+  803a83:	c9                   	leave
+  803a84:	c3                   	ret
+
+0000000000803a85 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a85:	55                   	push   %rbp
+  803a86:	48 89 e5             	mov    %rsp,%rbp
+  803a89:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a98:	8b 40 10             	mov    0x10(%rax),%eax
+  803a9b:	8d 50 01             	lea    0x1(%rax),%edx
+  803a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa2:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa9:	48 8b 10             	mov    (%rax),%rdx
+  803aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ab4:	48 39 c2             	cmp    %rax,%rdx
+  803ab7:	73 17                	jae    803ad0 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803abd:	48 8b 00             	mov    (%rax),%rax
+  803ac0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ac4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ac8:	48 89 0a             	mov    %rcx,(%rdx)
+  803acb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803ace:	88 10                	mov    %dl,(%rax)
+}
+  803ad0:	90                   	nop
+  803ad1:	c9                   	leave
+  803ad2:	c3                   	ret
+
+0000000000803ad3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ad3:	55                   	push   %rbp
+  803ad4:	48 89 e5             	mov    %rsp,%rbp
+  803ad7:	48 83 ec 40          	sub    $0x40,%rsp
+  803adb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803adf:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ae2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ae6:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803af2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803af5:	48 98                	cltq
+  803af7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803afb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aff:	48 01 d0             	add    %rdx,%rax
+  803b02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b06:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b0d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b12:	74 06                	je     803b1a <vsnprintf+0x47>
+  803b14:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b18:	7f 07                	jg     803b21 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b1f:	eb 32                	jmp    803b53 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b21:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b25:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b29:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b2d:	48 89 c6             	mov    %rax,%rsi
+  803b30:	48 b8 85 3a 80 00 00 	movabs $0x803a85,%rax
+  803b37:	00 00 00 
+  803b3a:	48 89 c7             	mov    %rax,%rdi
+  803b3d:	48 b8 c5 34 80 00 00 	movabs $0x8034c5,%rax
+  803b44:	00 00 00 
+  803b47:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b4d:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b50:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b53:	c9                   	leave
+  803b54:	c3                   	ret
+
+0000000000803b55 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b55:	55                   	push   %rbp
+  803b56:	48 89 e5             	mov    %rsp,%rbp
+  803b59:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b60:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b67:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b6d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b74:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b7b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b82:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b89:	84 c0                	test   %al,%al
+  803b8b:	74 20                	je     803bad <snprintf+0x58>
+  803b8d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b91:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b95:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b99:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b9d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803ba1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803ba5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803ba9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803bad:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803bb4:	00 00 00 
+  803bb7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803bbe:	00 00 00 
+  803bc1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bc5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bcc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bd3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bda:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803be1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803be8:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bee:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bf5:	48 89 c7             	mov    %rax,%rdi
+  803bf8:	48 b8 d3 3a 80 00 00 	movabs $0x803ad3,%rax
+  803bff:	00 00 00 
+  803c02:	ff d0                	call   *%rax
+  803c04:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c0a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c10:	c9                   	leave
+  803c11:	c3                   	ret
+
+0000000000803c12 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c12:	55                   	push   %rbp
+  803c13:	48 89 e5             	mov    %rsp,%rbp
+  803c16:	53                   	push   %rbx
+  803c17:	48 83 ec 38          	sub    $0x38,%rsp
+  803c1b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c1e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c22:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c26:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c2a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c2e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c36:	89 d1                	mov    %edx,%ecx
+  803c38:	0f a2                	cpuid
+  803c3a:	89 de                	mov    %ebx,%esi
+  803c3c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c3f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c42:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c45:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c48:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c4d:	74 09                	je     803c58 <cpuid+0x46>
+}
+  803c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c53:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c56:	89 10                	mov    %edx,(%rax)
+
+  803c58:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c5d:	74 09                	je     803c68 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c63:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c66:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c68:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c6d:	74 09                	je     803c78 <cpuid+0x66>
+char *
+  803c6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c73:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c76:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c78:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c7d:	74 09                	je     803c88 <cpuid+0x76>
+  for (; *s; s++)
+  803c7f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c83:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c86:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c88:	90                   	nop
+  803c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c8d:	c9                   	leave
+  803c8e:	c3                   	ret
+
+0000000000803c8f <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c8f:	55                   	push   %rbp
+  803c90:	48 89 e5             	mov    %rsp,%rbp
+  803c93:	48 83 ec 18          	sub    $0x18,%rsp
+  803c97:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c9d:	89 c1                	mov    %eax,%ecx
+  803c9f:	0f 01 d0             	xgetbv
+  803ca2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ca5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803ca8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cab:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803cae:	48 c1 e2 20          	shl    $0x20,%rdx
+  803cb2:	48 09 d0             	or     %rdx,%rax
+#else
+  803cb5:	c9                   	leave
+  803cb6:	c3                   	ret
+
+0000000000803cb7 <string_cpu>:
+string_cpu(void) {
+  803cb7:	55                   	push   %rbp
+  803cb8:	48 89 e5             	mov    %rsp,%rbp
+  803cbb:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803cbf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cc6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803ccd:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cd4:	00 00 00 
+  803cd7:	8b 00                	mov    (%rax),%eax
+  803cd9:	85 c0                	test   %eax,%eax
+  803cdb:	78 11                	js     803cee <string_cpu+0x37>
+    return string_features;
+  803cdd:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803ce4:	00 00 00 
+  803ce7:	8b 00                	mov    (%rax),%eax
+  803ce9:	e9 df 00 00 00       	jmp    803dcd <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cee:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cf2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d02:	48 89 c6             	mov    %rax,%rsi
+  803d05:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0a:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  803d11:	00 00 00 
+  803d14:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d16:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d19:	83 f8 06             	cmp    $0x6,%eax
+  803d1c:	76 28                	jbe    803d46 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d1e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d2d:	48 89 c2             	mov    %rax,%rdx
+  803d30:	be 00 00 00 00       	mov    $0x0,%esi
+  803d35:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d3a:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d46:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d49:	25 00 02 00 00       	and    $0x200,%eax
+  803d4e:	85 c0                	test   %eax,%eax
+  803d50:	74 04                	je     803d56 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d52:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d56:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d60:	48 89 c1             	mov    %rax,%rcx
+  803d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d68:	be 00 00 00 00       	mov    $0x0,%esi
+  803d6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d72:	48 b8 12 3c 80 00 00 	movabs $0x803c12,%rax
+  803d79:	00 00 00 
+  803d7c:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d7e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d81:	83 e0 20             	and    $0x20,%eax
+  803d84:	85 c0                	test   %eax,%eax
+  803d86:	74 2a                	je     803db2 <string_cpu+0xfb>
+  803d88:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d8b:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d90:	85 c0                	test   %eax,%eax
+  803d92:	74 1e                	je     803db2 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d94:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d99:	48 b8 8f 3c 80 00 00 	movabs $0x803c8f,%rax
+  803da0:	00 00 00 
+  803da3:	ff d0                	call   *%rax
+  803da5:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803da8:	48 83 f8 06          	cmp    $0x6,%rax
+  803dac:	75 04                	jne    803db2 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803dae:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803db2:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803db9:	00 00 00 
+  803dbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dbf:	89 02                	mov    %eax,(%rdx)
+  803dc1:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dc8:	00 00 00 
+  803dcb:	8b 00                	mov    (%rax),%eax
+}
+  803dcd:	c9                   	leave
+  803dce:	c3                   	ret
+
+0000000000803dcf <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803dcf:	55                   	push   %rbp
+  803dd0:	48 89 e5             	mov    %rsp,%rbp
+  803dd3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dd7:	48 83 ec 60          	sub    $0x60,%rsp
+  803ddb:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803de0:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803de5:	83 e0 1f             	and    $0x1f,%eax
+  803de8:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803dec:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803df0:	48 f7 d8             	neg    %rax
+  803df3:	48 89 c2             	mov    %rax,%rdx
+  803df6:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dfb:	48 01 d0             	add    %rdx,%rax
+  803dfe:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e03:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e07:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e0d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e12:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e16:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e1c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e20:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e24:	89 c2                	mov    %eax,%edx
+  803e26:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e2a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e2f:	89 c1                	mov    %eax,%ecx
+  803e31:	d3 e6                	shl    %cl,%esi
+  803e33:	89 f0                	mov    %esi,%eax
+  803e35:	21 d0                	and    %edx,%eax
+  803e37:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e3b:	eb 21                	jmp    803e5e <strlen_avx2+0x8f>
+    p += 32;
+  803e3d:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e43:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e48:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e4c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e52:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e56:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e5a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e5e:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e63:	74 d8                	je     803e3d <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e65:	31 c0                	xor    %eax,%eax
+  803e67:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e6d:	48 63 d0             	movslq %eax,%rdx
+  803e70:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e75:	48 01 d0             	add    %rdx,%rax
+  803e78:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e7d:	c9                   	leave
+  803e7e:	c3                   	ret
+
+0000000000803e7f <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e7f:	55                   	push   %rbp
+  803e80:	48 89 e5             	mov    %rsp,%rbp
+  803e83:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e87:	48 83 ec 40          	sub    $0x40,%rsp
+  803e8b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e90:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e95:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e9a:	eb 77                	jmp    803f13 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e9c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ea1:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ea5:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803ea9:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803eae:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803eb2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803eb6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803eba:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ebe:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ec3:	74 3c                	je     803f01 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803ec5:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803ec9:	f7 d0                	not    %eax
+  803ecb:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ecf:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ed3:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ed7:	48 63 d0             	movslq %eax,%rdx
+  803eda:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803edf:	48 01 d0             	add    %rdx,%rax
+  803ee2:	0f b6 00             	movzbl (%rax),%eax
+  803ee5:	0f b6 c0             	movzbl %al,%eax
+  803ee8:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803eec:	48 63 ca             	movslq %edx,%rcx
+  803eef:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ef4:	48 01 ca             	add    %rcx,%rdx
+  803ef7:	0f b6 12             	movzbl (%rdx),%edx
+  803efa:	0f b6 d2             	movzbl %dl,%edx
+  803efd:	29 d0                	sub    %edx,%eax
+  803eff:	eb 6b                	jmp    803f6c <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f01:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f07:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f0d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f13:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f19:	77 81                	ja     803e9c <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f1b:	eb 42                	jmp    803f5f <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f1d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f22:	0f b6 10             	movzbl (%rax),%edx
+  803f25:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f2a:	0f b6 00             	movzbl (%rax),%eax
+  803f2d:	38 c2                	cmp    %al,%dl
+  803f2f:	74 1c                	je     803f4d <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f31:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f36:	0f b6 00             	movzbl (%rax),%eax
+  803f39:	0f b6 c8             	movzbl %al,%ecx
+  803f3c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f41:	0f b6 00             	movzbl (%rax),%eax
+  803f44:	0f b6 d0             	movzbl %al,%edx
+  803f47:	89 c8                	mov    %ecx,%eax
+  803f49:	29 d0                	sub    %edx,%eax
+  803f4b:	eb 1f                	jmp    803f6c <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f4d:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f53:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f59:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f5f:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f65:	75 b6                	jne    803f1d <memcmp_avx2+0x9e>
+  return 0;
+  803f67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f6c:	c9                   	leave
+  803f6d:	c3                   	ret
+
+0000000000803f6e <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f6e:	55                   	push   %rbp
+  803f6f:	48 89 e5             	mov    %rsp,%rbp
+  803f72:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f76:	48 83 ec 60          	sub    $0x60,%rsp
+  803f7a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f7f:	89 f0                	mov    %esi,%eax
+  803f81:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f86:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f8a:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f8f:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f93:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f98:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f9e:	eb 47                	jmp    803fe7 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803fa0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fa5:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803fa9:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803fad:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fb3:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fb7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fbb:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fbf:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fc4:	74 15                	je     803fdb <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fc6:	31 c0                	xor    %eax,%eax
+  803fc8:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fce:	48 63 d0             	movslq %eax,%rdx
+  803fd1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fd6:	48 01 d0             	add    %rdx,%rax
+  803fd9:	eb 3d                	jmp    804018 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fdb:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fe1:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fe7:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fed:	77 b1                	ja     803fa0 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fef:	eb 0c                	jmp    803ffd <memfind_avx2+0x8f>
+  803ff1:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803ff7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803ffd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804003:	74 0e                	je     804013 <memfind_avx2+0xa5>
+  804005:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80400a:	0f b6 00             	movzbl (%rax),%eax
+  80400d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804011:	75 de                	jne    803ff1 <memfind_avx2+0x83>
+  return s;
+  804013:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804018:	c9                   	leave
+  804019:	c3                   	ret
+
+000000000080401a <strlen>:
+strlen(const char *s) {
+  80401a:	55                   	push   %rbp
+  80401b:	48 89 e5             	mov    %rsp,%rbp
+  80401e:	48 83 ec 40          	sub    $0x40,%rsp
+  804022:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804026:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80402a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80402e:	48 b8 b7 3c 80 00 00 	movabs $0x803cb7,%rax
+  804035:	00 00 00 
+  804038:	ff d0                	call   *%rax
+  80403a:	83 e0 02             	and    $0x2,%eax
+  80403d:	85 c0                	test   %eax,%eax
+  80403f:	74 18                	je     804059 <strlen+0x3f>
+    return strlen_avx2(s);
+  804041:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804045:	48 89 c7             	mov    %rax,%rdi
+  804048:	48 b8 cf 3d 80 00 00 	movabs $0x803dcf,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+  804054:	e9 82 00 00 00       	jmp    8040db <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  804059:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405d:	83 e0 0f             	and    $0xf,%eax
+  804060:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804063:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804066:	48 f7 d8             	neg    %rax
+  804069:	48 89 c2             	mov    %rax,%rdx
+  80406c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804070:	48 01 d0             	add    %rdx,%rax
+  804073:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804077:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80407b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80407f:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804084:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804088:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80408c:	89 c2                	mov    %eax,%edx
+  80408e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804091:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804096:	89 c1                	mov    %eax,%ecx
+  804098:	d3 e6                	shl    %cl,%esi
+  80409a:	89 f0                	mov    %esi,%eax
+  80409c:	21 d0                	and    %edx,%eax
+  80409e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040a1:	eb 1d                	jmp    8040c0 <strlen+0xa6>
+    p += 16;
+  8040a3:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8040a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040ac:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040b0:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040b5:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040b9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040c4:	74 dd                	je     8040a3 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040c6:	31 c0                	xor    %eax,%eax
+  8040c8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040cd:	48 63 d0             	movslq %eax,%rdx
+  8040d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d4:	48 01 d0             	add    %rdx,%rax
+  8040d7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040db:	c9                   	leave
+  8040dc:	c3                   	ret
+
+00000000008040dd <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040dd:	55                   	push   %rbp
+  8040de:	48 89 e5             	mov    %rsp,%rbp
+  8040e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8040e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040f4:	eb 0e                	jmp    804104 <strnlen+0x27>
+    n++;
+  8040f6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040fa:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040ff:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804104:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804109:	74 0b                	je     804116 <strnlen+0x39>
+  80410b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80410f:	0f b6 00             	movzbl (%rax),%eax
+  804112:	84 c0                	test   %al,%al
+  804114:	75 e0                	jne    8040f6 <strnlen+0x19>
+  return n;
+  804116:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804119:	c9                   	leave
+  80411a:	c3                   	ret
+
+000000000080411b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80411b:	55                   	push   %rbp
+  80411c:	48 89 e5             	mov    %rsp,%rbp
+  80411f:	48 83 ec 20          	sub    $0x20,%rsp
+  804123:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804127:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80412b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80412f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804133:	90                   	nop
+  804134:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804138:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80413c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804144:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804148:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80414c:	0f b6 12             	movzbl (%rdx),%edx
+  80414f:	88 10                	mov    %dl,(%rax)
+  804151:	0f b6 00             	movzbl (%rax),%eax
+  804154:	84 c0                	test   %al,%al
+  804156:	75 dc                	jne    804134 <strcpy+0x19>
+  return ret;
+  804158:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80415c:	c9                   	leave
+  80415d:	c3                   	ret
+
+000000000080415e <strcat>:
+strcat(char *dst, const char *src) {
+  80415e:	55                   	push   %rbp
+  80415f:	48 89 e5             	mov    %rsp,%rbp
+  804162:	48 83 ec 20          	sub    $0x20,%rsp
+  804166:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80416a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80416e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804172:	48 89 c7             	mov    %rax,%rdi
+  804175:	48 b8 1a 40 80 00 00 	movabs $0x80401a,%rax
+  80417c:	00 00 00 
+  80417f:	ff d0                	call   *%rax
+  804181:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804184:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804187:	48 63 d0             	movslq %eax,%rdx
+  80418a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418e:	48 01 c2             	add    %rax,%rdx
+  804191:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804195:	48 89 c6             	mov    %rax,%rsi
+  804198:	48 89 d7             	mov    %rdx,%rdi
+  80419b:	48 b8 1b 41 80 00 00 	movabs $0x80411b,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+  return dst;
+  8041a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8041ab:	c9                   	leave
+  8041ac:	c3                   	ret
+
+00000000008041ad <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8041ad:	55                   	push   %rbp
+  8041ae:	48 89 e5             	mov    %rsp,%rbp
+  8041b1:	48 83 ec 28          	sub    $0x28,%rsp
+  8041b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041c9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041d0:	00 
+  8041d1:	eb 2a                	jmp    8041fd <strncpy+0x50>
+    *dst++ = *src;
+  8041d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041db:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041e3:	0f b6 12             	movzbl (%rdx),%edx
+  8041e6:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ec:	0f b6 00             	movzbl (%rax),%eax
+  8041ef:	84 c0                	test   %al,%al
+  8041f1:	74 05                	je     8041f8 <strncpy+0x4b>
+      src++;
+  8041f3:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041f8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804201:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804205:	72 cc                	jb     8041d3 <strncpy+0x26>
+  return ret;
+  804207:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80420b:	c9                   	leave
+  80420c:	c3                   	ret
+
+000000000080420d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80420d:	55                   	push   %rbp
+  80420e:	48 89 e5             	mov    %rsp,%rbp
+  804211:	48 83 ec 28          	sub    $0x28,%rsp
+  804215:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804219:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80421d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804225:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804229:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80422e:	74 3d                	je     80426d <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804230:	eb 1d                	jmp    80424f <strlcpy+0x42>
+      *dst++ = *src++;
+  804232:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804236:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80423a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80423e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804242:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804246:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80424a:	0f b6 12             	movzbl (%rdx),%edx
+  80424d:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80424f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804254:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804259:	74 0b                	je     804266 <strlcpy+0x59>
+  80425b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80425f:	0f b6 00             	movzbl (%rax),%eax
+  804262:	84 c0                	test   %al,%al
+  804264:	75 cc                	jne    804232 <strlcpy+0x25>
+    *dst = '\0';
+  804266:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80426a:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80426d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804271:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804275:	c9                   	leave
+  804276:	c3                   	ret
+
+0000000000804277 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804277:	55                   	push   %rbp
+  804278:	48 89 e5             	mov    %rsp,%rbp
+  80427b:	48 83 ec 30          	sub    $0x30,%rsp
+  80427f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804283:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804287:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80428b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80428f:	48 89 c7             	mov    %rax,%rdi
+  804292:	48 b8 1a 40 80 00 00 	movabs $0x80401a,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+  80429e:	48 98                	cltq
+  8042a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8042a4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ac:	48 89 d6             	mov    %rdx,%rsi
+  8042af:	48 89 c7             	mov    %rax,%rdi
+  8042b2:	48 b8 dd 40 80 00 00 	movabs $0x8040dd,%rax
+  8042b9:	00 00 00 
+  8042bc:	ff d0                	call   *%rax
+  8042be:	48 98                	cltq
+  8042c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042c8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042cc:	75 10                	jne    8042de <strlcat+0x67>
+    return maxlen + srclen;
+  8042ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d6:	48 01 d0             	add    %rdx,%rax
+  8042d9:	e9 86 00 00 00       	jmp    804364 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042e2:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042e6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042ea:	73 2b                	jae    804317 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042f0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042f4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042fc:	48 01 c1             	add    %rax,%rcx
+  8042ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804303:	48 89 c6             	mov    %rax,%rsi
+  804306:	48 89 cf             	mov    %rcx,%rdi
+  804309:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+  804315:	eb 42                	jmp    804359 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804317:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80431b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80431f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804323:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804327:	48 01 c1             	add    %rax,%rcx
+  80432a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80432e:	48 89 c6             	mov    %rax,%rsi
+  804331:	48 89 cf             	mov    %rcx,%rdi
+  804334:	48 b8 64 48 80 00 00 	movabs $0x804864,%rax
+  80433b:	00 00 00 
+  80433e:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804340:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804344:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804348:	48 01 d0             	add    %rdx,%rax
+  80434b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80434f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804353:	48 01 d0             	add    %rdx,%rax
+  804356:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  804359:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80435d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804361:	48 01 d0             	add    %rdx,%rax
+}
+  804364:	c9                   	leave
+  804365:	c3                   	ret
+
+0000000000804366 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	48 83 ec 10          	sub    $0x10,%rsp
+  80436e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804372:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804376:	eb 0a                	jmp    804382 <strcmp+0x1c>
+    p++, q++;
+  804378:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80437d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804386:	0f b6 00             	movzbl (%rax),%eax
+  804389:	84 c0                	test   %al,%al
+  80438b:	74 12                	je     80439f <strcmp+0x39>
+  80438d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804391:	0f b6 10             	movzbl (%rax),%edx
+  804394:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804398:	0f b6 00             	movzbl (%rax),%eax
+  80439b:	38 c2                	cmp    %al,%dl
+  80439d:	74 d9                	je     804378 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80439f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043a3:	0f b6 00             	movzbl (%rax),%eax
+  8043a6:	0f b6 d0             	movzbl %al,%edx
+  8043a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ad:	0f b6 00             	movzbl (%rax),%eax
+  8043b0:	0f b6 c0             	movzbl %al,%eax
+  8043b3:	29 c2                	sub    %eax,%edx
+  8043b5:	89 d0                	mov    %edx,%eax
+}
+  8043b7:	c9                   	leave
+  8043b8:	c3                   	ret
+
+00000000008043b9 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043b9:	55                   	push   %rbp
+  8043ba:	48 89 e5             	mov    %rsp,%rbp
+  8043bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8043c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043c9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043cd:	eb 0f                	jmp    8043de <strncmp+0x25>
+    n--, p++, q++;
+  8043cf:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043d4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043d9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043de:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043e3:	74 1d                	je     804402 <strncmp+0x49>
+  8043e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e9:	0f b6 00             	movzbl (%rax),%eax
+  8043ec:	84 c0                	test   %al,%al
+  8043ee:	74 12                	je     804402 <strncmp+0x49>
+  8043f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f4:	0f b6 10             	movzbl (%rax),%edx
+  8043f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043fb:	0f b6 00             	movzbl (%rax),%eax
+  8043fe:	38 c2                	cmp    %al,%dl
+  804400:	74 cd                	je     8043cf <strncmp+0x16>
+  if (n == 0)
+  804402:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804407:	75 07                	jne    804410 <strncmp+0x57>
+    return 0;
+  804409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440e:	eb 16                	jmp    804426 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804414:	0f b6 00             	movzbl (%rax),%eax
+  804417:	0f b6 d0             	movzbl %al,%edx
+  80441a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441e:	0f b6 00             	movzbl (%rax),%eax
+  804421:	0f b6 c0             	movzbl %al,%eax
+  804424:	29 c2                	sub    %eax,%edx
+}
+  804426:	89 d0                	mov    %edx,%eax
+  804428:	c9                   	leave
+  804429:	c3                   	ret
+
+000000000080442a <strchr>:
+strchr(const char *s, char c) {
+  80442a:	55                   	push   %rbp
+  80442b:	48 89 e5             	mov    %rsp,%rbp
+  80442e:	48 83 ec 60          	sub    $0x60,%rsp
+  804432:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804436:	89 f0                	mov    %esi,%eax
+  804438:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80443b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80443f:	83 e0 0f             	and    $0xf,%eax
+  804442:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804445:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804448:	48 f7 d8             	neg    %rax
+  80444b:	48 89 c2             	mov    %rax,%rdx
+  80444e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804452:	48 01 d0             	add    %rdx,%rax
+  804455:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  804459:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80445d:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804461:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804465:	66 0f 6e c0          	movd   %eax,%xmm0
+  804469:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80446d:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804471:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804476:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80447a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80447e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804482:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804486:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80448b:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804490:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804494:	89 c2                	mov    %eax,%edx
+  804496:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80449b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044a0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044a4:	09 c2                	or     %eax,%edx
+  8044a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044a9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8044ae:	89 c1                	mov    %eax,%ecx
+  8044b0:	d3 e6                	shl    %cl,%esi
+  8044b2:	89 f0                	mov    %esi,%eax
+  8044b4:	21 d0                	and    %edx,%eax
+  8044b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044b9:	eb 34                	jmp    8044ef <strchr+0xc5>
+    p += 16;
+  8044bb:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044c4:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044c8:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044cc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044d1:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044d6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044da:	89 c2                	mov    %eax,%edx
+  8044dc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044e1:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044e6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044ea:	09 d0                	or     %edx,%eax
+  8044ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044f3:	74 c6                	je     8044bb <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044f5:	31 c0                	xor    %eax,%eax
+  8044f7:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044fc:	48 98                	cltq
+  8044fe:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  804502:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804506:	0f b6 00             	movzbl (%rax),%eax
+  804509:	84 c0                	test   %al,%al
+  80450b:	74 06                	je     804513 <strchr+0xe9>
+  80450d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804511:	eb 05                	jmp    804518 <strchr+0xee>
+  804513:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804518:	c9                   	leave
+  804519:	c3                   	ret
+
+000000000080451a <strfind>:
+strfind(const char *s, char c) {
+  80451a:	55                   	push   %rbp
+  80451b:	48 89 e5             	mov    %rsp,%rbp
+  80451e:	48 83 ec 10          	sub    $0x10,%rsp
+  804522:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804526:	89 f0                	mov    %esi,%eax
+  804528:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80452b:	eb 11                	jmp    80453e <strfind+0x24>
+    if (*s == c)
+  80452d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804531:	0f b6 00             	movzbl (%rax),%eax
+  804534:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804537:	74 12                	je     80454b <strfind+0x31>
+  for (; *s; s++)
+  804539:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80453e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804542:	0f b6 00             	movzbl (%rax),%eax
+  804545:	84 c0                	test   %al,%al
+  804547:	75 e4                	jne    80452d <strfind+0x13>
+  804549:	eb 01                	jmp    80454c <strfind+0x32>
+      break;
+  80454b:	90                   	nop
+  return (char *)s;
+  80454c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804550:	c9                   	leave
+  804551:	c3                   	ret
+
+0000000000804552 <memset>:
+memset(void *v, int c, size_t n) {
+  804552:	55                   	push   %rbp
+  804553:	48 89 e5             	mov    %rsp,%rbp
+  804556:	48 83 ec 38          	sub    $0x38,%rsp
+  80455a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80455e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804561:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804565:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804569:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80456d:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804572:	76 41                	jbe    8045b5 <memset+0x63>
+  804574:	48 b8 b7 3c 80 00 00 	movabs $0x803cb7,%rax
+  80457b:	00 00 00 
+  80457e:	ff d0                	call   *%rax
+  804580:	83 e0 01             	and    $0x1,%eax
+  804583:	85 c0                	test   %eax,%eax
+  804585:	74 2e                	je     8045b5 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804587:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80458a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80458e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804592:	48 89 ce             	mov    %rcx,%rsi
+  804595:	48 89 f7             	mov    %rsi,%rdi
+  804598:	48 89 d1             	mov    %rdx,%rcx
+  80459b:	fc                   	cld
+  80459c:	f3 aa                	rep stos %al,%es:(%rdi)
+  80459e:	48 89 ca             	mov    %rcx,%rdx
+  8045a1:	48 89 fe             	mov    %rdi,%rsi
+  8045a4:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8045a8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8045ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045b0:	e9 a7 00 00 00       	jmp    80465c <memset+0x10a>
+  if (n >= 8) {
+  8045b5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045ba:	0f 86 87 00 00 00    	jbe    804647 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045c0:	eb 16                	jmp    8045d8 <memset+0x86>
+      *p++ = c;
+  8045c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045ca:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045ce:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045d1:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045d3:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045dc:	83 e0 07             	and    $0x7,%eax
+  8045df:	48 85 c0             	test   %rax,%rax
+  8045e2:	75 de                	jne    8045c2 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045e4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045e7:	0f b6 c0             	movzbl %al,%eax
+  8045ea:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045f1:	01 01 01 
+  8045f4:	48 0f af c2          	imul   %rdx,%rax
+  8045f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804600:	48 c1 e8 03          	shr    $0x3,%rax
+  804604:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  804608:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80460c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804610:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804614:	48 89 ce             	mov    %rcx,%rsi
+  804617:	48 89 f7             	mov    %rsi,%rdi
+  80461a:	48 89 d1             	mov    %rdx,%rcx
+  80461d:	fc                   	cld
+  80461e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804621:	48 89 ca             	mov    %rcx,%rdx
+  804624:	48 89 fe             	mov    %rdi,%rsi
+  804627:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80462b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80462f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804634:	eb 11                	jmp    804647 <memset+0xf5>
+    *p++ = c;
+  804636:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80463a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80463e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804642:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804645:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804647:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80464b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80464f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804653:	48 85 c0             	test   %rax,%rax
+  804656:	75 de                	jne    804636 <memset+0xe4>
+  return v;
+  804658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80465c:	c9                   	leave
+  80465d:	c3                   	ret
+
+000000000080465e <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80465e:	55                   	push   %rbp
+  80465f:	48 89 e5             	mov    %rsp,%rbp
+  804662:	48 83 ec 38          	sub    $0x38,%rsp
+  804666:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80466a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80466e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804672:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804676:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80467a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80467e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804686:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80468a:	0f 83 da 00 00 00    	jae    80476a <memmove+0x10c>
+  804690:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804694:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804698:	48 01 d0             	add    %rdx,%rax
+  80469b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80469f:	0f 83 c5 00 00 00    	jae    80476a <memmove+0x10c>
+    s += n;
+  8046a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8046ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046b1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046b5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046ba:	0f 86 94 00 00 00    	jbe    804754 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046c0:	eb 1c                	jmp    8046de <memmove+0x80>
+        *--d = *--s;
+  8046c2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046c7:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046d0:	0f b6 10             	movzbl (%rax),%edx
+  8046d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d7:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046d9:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e2:	83 e0 07             	and    $0x7,%eax
+  8046e5:	48 85 c0             	test   %rax,%rax
+  8046e8:	75 d8                	jne    8046c2 <memmove+0x64>
+      nq = n / 8;
+  8046ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ee:	48 c1 e8 03          	shr    $0x3,%rax
+  8046f2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046f6:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046fb:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  804700:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  804705:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804709:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80470d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804711:	48 89 cf             	mov    %rcx,%rdi
+  804714:	48 89 d6             	mov    %rdx,%rsi
+  804717:	48 89 c1             	mov    %rax,%rcx
+  80471a:	fd                   	std
+  80471b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80471e:	fc                   	cld
+  80471f:	48 89 c8             	mov    %rcx,%rax
+  804722:	48 89 f2             	mov    %rsi,%rdx
+  804725:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804729:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80472d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804731:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804736:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80473b:	eb 17                	jmp    804754 <memmove+0xf6>
+      *--d = *--s;
+  80473d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804742:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80474b:	0f b6 10             	movzbl (%rax),%edx
+  80474e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804752:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804754:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804758:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80475c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804760:	48 85 c0             	test   %rax,%rax
+  804763:	75 d8                	jne    80473d <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804765:	e9 f4 00 00 00       	jmp    80485e <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80476a:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80476f:	76 46                	jbe    8047b7 <memmove+0x159>
+  804771:	48 b8 b7 3c 80 00 00 	movabs $0x803cb7,%rax
+  804778:	00 00 00 
+  80477b:	ff d0                	call   *%rax
+  80477d:	83 e0 01             	and    $0x1,%eax
+  804780:	85 c0                	test   %eax,%eax
+  804782:	74 33                	je     8047b7 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804784:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804788:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80478c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804790:	48 89 cf             	mov    %rcx,%rdi
+  804793:	48 89 d6             	mov    %rdx,%rsi
+  804796:	48 89 c1             	mov    %rax,%rcx
+  804799:	fc                   	cld
+  80479a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80479c:	48 89 c8             	mov    %rcx,%rax
+  80479f:	48 89 f2             	mov    %rsi,%rdx
+  8047a2:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8047a6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8047aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8047ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047b2:	e9 ab 00 00 00       	jmp    804862 <memmove+0x204>
+    if (n >= 8) {
+  8047b7:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047bc:	0f 86 8b 00 00 00    	jbe    80484d <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047c2:	eb 22                	jmp    8047e6 <memmove+0x188>
+        *d++ = *s++;
+  8047c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047c8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047d8:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047dc:	0f b6 12             	movzbl (%rdx),%edx
+  8047df:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047e1:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047ea:	83 e0 07             	and    $0x7,%eax
+  8047ed:	48 85 c0             	test   %rax,%rax
+  8047f0:	75 d2                	jne    8047c4 <memmove+0x166>
+      nq = n / 8;
+  8047f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047f6:	48 c1 e8 03          	shr    $0x3,%rax
+  8047fa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047fe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804802:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804806:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80480a:	48 89 cf             	mov    %rcx,%rdi
+  80480d:	48 89 d6             	mov    %rdx,%rsi
+  804810:	48 89 c1             	mov    %rax,%rcx
+  804813:	fc                   	cld
+  804814:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804817:	48 89 c8             	mov    %rcx,%rax
+  80481a:	48 89 f2             	mov    %rsi,%rdx
+  80481d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804821:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804825:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804829:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80482e:	eb 1d                	jmp    80484d <memmove+0x1ef>
+      *d++ = *s++;
+  804830:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804834:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804838:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80483c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804840:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804844:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804848:	0f b6 12             	movzbl (%rdx),%edx
+  80484b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80484d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804851:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804855:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804859:	48 85 c0             	test   %rax,%rax
+  80485c:	75 d2                	jne    804830 <memmove+0x1d2>
+  return dst;
+  80485e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804862:	c9                   	leave
+  804863:	c3                   	ret
+
+0000000000804864 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804864:	55                   	push   %rbp
+  804865:	48 89 e5             	mov    %rsp,%rbp
+  804868:	48 83 ec 18          	sub    $0x18,%rsp
+  80486c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804870:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804874:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804878:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80487c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804884:	48 89 ce             	mov    %rcx,%rsi
+  804887:	48 89 c7             	mov    %rax,%rdi
+  80488a:	48 b8 5e 46 80 00 00 	movabs $0x80465e,%rax
+  804891:	00 00 00 
+  804894:	ff d0                	call   *%rax
+}
+  804896:	c9                   	leave
+  804897:	c3                   	ret
+
+0000000000804898 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804898:	55                   	push   %rbp
+  804899:	48 89 e5             	mov    %rsp,%rbp
+  80489c:	48 83 ec 40          	sub    $0x40,%rsp
+  8048a0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048a4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048a8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8048ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048bc:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048c1:	0f 86 a7 00 00 00    	jbe    80496e <memcmp+0xd6>
+  8048c7:	48 b8 b7 3c 80 00 00 	movabs $0x803cb7,%rax
+  8048ce:	00 00 00 
+  8048d1:	ff d0                	call   *%rax
+  8048d3:	83 e0 02             	and    $0x2,%eax
+  8048d6:	85 c0                	test   %eax,%eax
+  8048d8:	0f 84 90 00 00 00    	je     80496e <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ea:	48 89 ce             	mov    %rcx,%rsi
+  8048ed:	48 89 c7             	mov    %rax,%rdi
+  8048f0:	48 b8 7f 3e 80 00 00 	movabs $0x803e7f,%rax
+  8048f7:	00 00 00 
+  8048fa:	ff d0                	call   *%rax
+  8048fc:	e9 c2 00 00 00       	jmp    8049c3 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  804901:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804905:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804909:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80490d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804911:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804915:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804919:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80491d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804920:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804927:	74 36                	je     80495f <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804929:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80492c:	f7 d0                	not    %eax
+  80492e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804932:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804935:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804938:	48 63 d0             	movslq %eax,%rdx
+  80493b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493f:	48 01 d0             	add    %rdx,%rax
+  804942:	0f b6 00             	movzbl (%rax),%eax
+  804945:	0f b6 c0             	movzbl %al,%eax
+  804948:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80494b:	48 63 ca             	movslq %edx,%rcx
+  80494e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804952:	48 01 ca             	add    %rcx,%rdx
+  804955:	0f b6 12             	movzbl (%rdx),%edx
+  804958:	0f b6 d2             	movzbl %dl,%edx
+  80495b:	29 d0                	sub    %edx,%eax
+  80495d:	eb 64                	jmp    8049c3 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80495f:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804964:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804969:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80496e:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804973:	77 8c                	ja     804901 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804975:	eb 36                	jmp    8049ad <memcmp+0x115>
+    if (*s1 != *s2)
+  804977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80497b:	0f b6 10             	movzbl (%rax),%edx
+  80497e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804982:	0f b6 00             	movzbl (%rax),%eax
+  804985:	38 c2                	cmp    %al,%dl
+  804987:	74 1a                	je     8049a3 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498d:	0f b6 00             	movzbl (%rax),%eax
+  804990:	0f b6 c8             	movzbl %al,%ecx
+  804993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804997:	0f b6 00             	movzbl (%rax),%eax
+  80499a:	0f b6 d0             	movzbl %al,%edx
+  80499d:	89 c8                	mov    %ecx,%eax
+  80499f:	29 d0                	sub    %edx,%eax
+  8049a1:	eb 20                	jmp    8049c3 <memcmp+0x12b>
+    s1++, s2++;
+  8049a3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8049a8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8049ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049b1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049b9:	48 85 c0             	test   %rax,%rax
+  8049bc:	75 b9                	jne    804977 <memcmp+0xdf>
+  }
+
+  return 0;
+  8049be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049c3:	c9                   	leave
+  8049c4:	c3                   	ret
+
+00000000008049c5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049c5:	55                   	push   %rbp
+  8049c6:	48 89 e5             	mov    %rsp,%rbp
+  8049c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8049cd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049d1:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049d4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049d8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049dc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049e0:	48 01 d0             	add    %rdx,%rax
+  8049e3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049e7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049ea:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049ee:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049f2:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049f6:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049fb:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049ff:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a04:	76 73                	jbe    804a79 <memfind+0xb4>
+  804a06:	48 b8 b7 3c 80 00 00 	movabs $0x803cb7,%rax
+  804a0d:	00 00 00 
+  804a10:	ff d0                	call   *%rax
+  804a12:	83 e0 02             	and    $0x2,%eax
+  804a15:	85 c0                	test   %eax,%eax
+  804a17:	74 60                	je     804a79 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a19:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a1c:	0f b6 c8             	movzbl %al,%ecx
+  804a1f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a27:	89 ce                	mov    %ecx,%esi
+  804a29:	48 89 c7             	mov    %rax,%rdi
+  804a2c:	48 b8 6e 3f 80 00 00 	movabs $0x803f6e,%rax
+  804a33:	00 00 00 
+  804a36:	ff d0                	call   *%rax
+  804a38:	eb 6c                	jmp    804aa6 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a3e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a42:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a46:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a4b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a4f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a53:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a56:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a5a:	74 13                	je     804a6f <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a5c:	31 c0                	xor    %eax,%eax
+  804a5e:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a63:	48 63 d0             	movslq %eax,%rdx
+  804a66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a6a:	48 01 d0             	add    %rdx,%rax
+  804a6d:	eb 37                	jmp    804aa6 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a6f:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a74:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a79:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a7e:	77 ba                	ja     804a3a <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a80:	eb 13                	jmp    804a95 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a86:	0f b6 00             	movzbl (%rax),%eax
+  804a89:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a8c:	38 d0                	cmp    %dl,%al
+  804a8e:	74 11                	je     804aa1 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a90:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a99:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a9d:	72 e3                	jb     804a82 <memfind+0xbd>
+  804a9f:	eb 01                	jmp    804aa2 <memfind+0xdd>
+      break;
+  804aa1:	90                   	nop
+  return (void *)s;
+  804aa2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804aa6:	c9                   	leave
+  804aa7:	c3                   	ret
+
+0000000000804aa8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804aa8:	55                   	push   %rbp
+  804aa9:	48 89 e5             	mov    %rsp,%rbp
+  804aac:	48 83 ec 38          	sub    $0x38,%rsp
+  804ab0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ab4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ab8:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804abb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804ac2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ac9:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804aca:	eb 05                	jmp    804ad1 <strtol+0x29>
+    s++;
+  804acc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ad1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad5:	0f b6 00             	movzbl (%rax),%eax
+  804ad8:	3c 20                	cmp    $0x20,%al
+  804ada:	74 f0                	je     804acc <strtol+0x24>
+  804adc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae0:	0f b6 00             	movzbl (%rax),%eax
+  804ae3:	3c 09                	cmp    $0x9,%al
+  804ae5:	74 e5                	je     804acc <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ae7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aeb:	0f b6 00             	movzbl (%rax),%eax
+  804aee:	3c 2b                	cmp    $0x2b,%al
+  804af0:	75 07                	jne    804af9 <strtol+0x51>
+    s++;
+  804af2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804af7:	eb 17                	jmp    804b10 <strtol+0x68>
+  else if (*s == '-')
+  804af9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804afd:	0f b6 00             	movzbl (%rax),%eax
+  804b00:	3c 2d                	cmp    $0x2d,%al
+  804b02:	75 0c                	jne    804b10 <strtol+0x68>
+    s++, neg = 1;
+  804b04:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b09:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b10:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b14:	74 06                	je     804b1c <strtol+0x74>
+  804b16:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b1a:	75 28                	jne    804b44 <strtol+0x9c>
+  804b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b20:	0f b6 00             	movzbl (%rax),%eax
+  804b23:	3c 30                	cmp    $0x30,%al
+  804b25:	75 1d                	jne    804b44 <strtol+0x9c>
+  804b27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2b:	48 83 c0 01          	add    $0x1,%rax
+  804b2f:	0f b6 00             	movzbl (%rax),%eax
+  804b32:	3c 78                	cmp    $0x78,%al
+  804b34:	75 0e                	jne    804b44 <strtol+0x9c>
+    s += 2, base = 16;
+  804b36:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b3b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b42:	eb 2c                	jmp    804b70 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b44:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b48:	75 19                	jne    804b63 <strtol+0xbb>
+  804b4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b4e:	0f b6 00             	movzbl (%rax),%eax
+  804b51:	3c 30                	cmp    $0x30,%al
+  804b53:	75 0e                	jne    804b63 <strtol+0xbb>
+    s++, base = 8;
+  804b55:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b5a:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b61:	eb 0d                	jmp    804b70 <strtol+0xc8>
+  else if (base == 0)
+  804b63:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b67:	75 07                	jne    804b70 <strtol+0xc8>
+    base = 10;
+  804b69:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b74:	0f b6 00             	movzbl (%rax),%eax
+  804b77:	3c 2f                	cmp    $0x2f,%al
+  804b79:	7e 1d                	jle    804b98 <strtol+0xf0>
+  804b7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b7f:	0f b6 00             	movzbl (%rax),%eax
+  804b82:	3c 39                	cmp    $0x39,%al
+  804b84:	7f 12                	jg     804b98 <strtol+0xf0>
+      dig = *s - '0';
+  804b86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8a:	0f b6 00             	movzbl (%rax),%eax
+  804b8d:	0f be c0             	movsbl %al,%eax
+  804b90:	83 e8 30             	sub    $0x30,%eax
+  804b93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b96:	eb 4e                	jmp    804be6 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b9c:	0f b6 00             	movzbl (%rax),%eax
+  804b9f:	3c 60                	cmp    $0x60,%al
+  804ba1:	7e 1d                	jle    804bc0 <strtol+0x118>
+  804ba3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba7:	0f b6 00             	movzbl (%rax),%eax
+  804baa:	3c 7a                	cmp    $0x7a,%al
+  804bac:	7f 12                	jg     804bc0 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804bae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb2:	0f b6 00             	movzbl (%rax),%eax
+  804bb5:	0f be c0             	movsbl %al,%eax
+  804bb8:	83 e8 57             	sub    $0x57,%eax
+  804bbb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbe:	eb 26                	jmp    804be6 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804bc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc4:	0f b6 00             	movzbl (%rax),%eax
+  804bc7:	3c 40                	cmp    $0x40,%al
+  804bc9:	7e 47                	jle    804c12 <strtol+0x16a>
+  804bcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bcf:	0f b6 00             	movzbl (%rax),%eax
+  804bd2:	3c 5a                	cmp    $0x5a,%al
+  804bd4:	7f 3c                	jg     804c12 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bda:	0f b6 00             	movzbl (%rax),%eax
+  804bdd:	0f be c0             	movsbl %al,%eax
+  804be0:	83 e8 37             	sub    $0x37,%eax
+  804be3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804be6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be9:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bec:	7d 23                	jge    804c11 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bee:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bf3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bf6:	48 98                	cltq
+  804bf8:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bfd:	48 89 c2             	mov    %rax,%rdx
+  804c00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c03:	48 98                	cltq
+  804c05:	48 01 d0             	add    %rdx,%rax
+  804c08:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c0c:	e9 5f ff ff ff       	jmp    804b70 <strtol+0xc8>
+      break;
+  804c11:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c17:	74 0b                	je     804c24 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c1d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c21:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c28:	74 09                	je     804c33 <strtol+0x18b>
+  804c2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c2e:	48 f7 d8             	neg    %rax
+  804c31:	eb 04                	jmp    804c37 <strtol+0x18f>
+  804c33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c37:	c9                   	leave
+  804c38:	c3                   	ret
+
+0000000000804c39 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c39:	55                   	push   %rbp
+  804c3a:	48 89 e5             	mov    %rsp,%rbp
+  804c3d:	48 83 ec 20          	sub    $0x20,%rsp
+  804c41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c51:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c59:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c60:	48 89 c7             	mov    %rax,%rdi
+  804c63:	48 b8 71 4c 80 00 00 	movabs $0x804c71,%rax
+  804c6a:	00 00 00 
+  804c6d:	ff d0                	call   *%rax
+}
+  804c6f:	c9                   	leave
+  804c70:	c3                   	ret
+
+0000000000804c71 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c71:	55                   	push   %rbp
+  804c72:	48 89 e5             	mov    %rsp,%rbp
+  804c75:	48 83 ec 30          	sub    $0x30,%rsp
+  804c79:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c7d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c81:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c85:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c89:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c8e:	75 0e                	jne    804c9e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c90:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c97:	00 00 00 
+  804c9a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c9e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804ca3:	75 18                	jne    804cbd <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804ca5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca9:	48 89 c7             	mov    %rax,%rdi
+  804cac:	48 b8 fc 05 80 00 00 	movabs $0x8005fc,%rax
+  804cb3:	00 00 00 
+  804cb6:	ff d0                	call   *%rax
+  804cb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cbb:	eb 1d                	jmp    804cda <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cbd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cc1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cc5:	48 89 d6             	mov    %rdx,%rsi
+  804cc8:	48 89 c7             	mov    %rax,%rdi
+  804ccb:	48 b8 42 06 80 00 00 	movabs $0x800642,%rax
+  804cd2:	00 00 00 
+  804cd5:	ff d0                	call   *%rax
+  804cd7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cda:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cde:	79 2a                	jns    804d0a <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804ce0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ce5:	74 0a                	je     804cf1 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ce7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ceb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cf1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cf6:	74 0a                	je     804d02 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cfc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d05:	e9 aa 00 00 00       	jmp    804db4 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d0a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d0f:	74 36                	je     804d47 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d11:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d18:	00 00 00 
+  804d1b:	8b 40 04             	mov    0x4(%rax),%eax
+  804d1e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d23:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d2a:	00 00 00 
+  804d2d:	48 98                	cltq
+  804d2f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d36:	48 01 d0             	add    %rdx,%rax
+  804d39:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d3f:	8b 10                	mov    (%rax),%edx
+  804d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d45:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d47:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d4c:	74 36                	je     804d84 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d4e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d55:	00 00 00 
+  804d58:	8b 40 04             	mov    0x4(%rax),%eax
+  804d5b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d60:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d67:	00 00 00 
+  804d6a:	48 98                	cltq
+  804d6c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d73:	48 01 d0             	add    %rdx,%rax
+  804d76:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d7c:	8b 10                	mov    (%rax),%edx
+  804d7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d82:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d84:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d8b:	00 00 00 
+  804d8e:	8b 40 04             	mov    0x4(%rax),%eax
+  804d91:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d96:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d9d:	00 00 00 
+  804da0:	48 98                	cltq
+  804da2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804da9:	48 01 d0             	add    %rdx,%rax
+  804dac:	48 05 20 01 00 00    	add    $0x120,%rax
+  804db2:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804db4:	c9                   	leave
+  804db5:	c3                   	ret
+
+0000000000804db6 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804db6:	55                   	push   %rbp
+  804db7:	48 89 e5             	mov    %rsp,%rbp
+  804dba:	48 83 ec 30          	sub    $0x30,%rsp
+  804dbe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dc1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dc4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dc8:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dcb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dd0:	75 5e                	jne    804e30 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dd2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dd9:	00 00 00 
+  804ddc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804de0:	eb 4e                	jmp    804e30 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804de2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804de6:	79 3c                	jns    804e24 <ipc_send+0x6e>
+  804de8:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dec:	74 36                	je     804e24 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804df1:	89 c1                	mov    %eax,%ecx
+  804df3:	48 b8 28 56 80 00 00 	movabs $0x805628,%rax
+  804dfa:	00 00 00 
+  804dfd:	48 89 c2             	mov    %rax,%rdx
+  804e00:	be 54 00 00 00       	mov    $0x54,%esi
+  804e05:	48 b8 4e 56 80 00 00 	movabs $0x80564e,%rax
+  804e0c:	00 00 00 
+  804e0f:	48 89 c7             	mov    %rax,%rdi
+  804e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e17:	49 b8 4c 2f 80 00 00 	movabs $0x802f4c,%r8
+  804e1e:	00 00 00 
+  804e21:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e24:	48 b8 7f 03 80 00 00 	movabs $0x80037f,%rax
+  804e2b:	00 00 00 
+  804e2e:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e30:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e33:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e36:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e3d:	89 c7                	mov    %eax,%edi
+  804e3f:	48 b8 a5 05 80 00 00 	movabs $0x8005a5,%rax
+  804e46:	00 00 00 
+  804e49:	ff d0                	call   *%rax
+  804e4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e52:	75 8e                	jne    804de2 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e54:	48 b8 7f 03 80 00 00 	movabs $0x80037f,%rax
+  804e5b:	00 00 00 
+  804e5e:	ff d0                	call   *%rax
+}
+  804e60:	90                   	nop
+  804e61:	c9                   	leave
+  804e62:	c3                   	ret
+
+0000000000804e63 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e63:	55                   	push   %rbp
+  804e64:	48 89 e5             	mov    %rsp,%rbp
+  804e67:	48 83 ec 18          	sub    $0x18,%rsp
+  804e6b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e6e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e75:	eb 4d                	jmp    804ec4 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e77:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e7e:	00 00 00 
+  804e81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e84:	48 98                	cltq
+  804e86:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e8d:	48 01 d0             	add    %rdx,%rax
+  804e90:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e96:	8b 00                	mov    (%rax),%eax
+  804e98:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e9b:	75 23                	jne    804ec0 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e9d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ea4:	00 00 00 
+  804ea7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eaa:	48 98                	cltq
+  804eac:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eb3:	48 01 d0             	add    %rdx,%rax
+  804eb6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ebc:	8b 00                	mov    (%rax),%eax
+  804ebe:	eb 12                	jmp    804ed2 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ec0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ec4:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ecb:	7e aa                	jle    804e77 <ipc_find_env+0x14>
+  return 0;
+  804ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed2:	c9                   	leave
+  804ed3:	c3                   	ret
+
+0000000000804ed4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ed4:	55                   	push   %rbp
+  804ed5:	48 89 e5             	mov    %rsp,%rbp
+  804ed8:	48 83 ec 18          	sub    $0x18,%rsp
+  804edc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ee0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee4:	48 c1 e8 27          	shr    $0x27,%rax
+  804ee8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804eed:	48 89 c2             	mov    %rax,%rdx
+  804ef0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ef7:	01 00 00 
+  804efa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804efe:	83 e0 01             	and    $0x1,%eax
+  804f01:	48 85 c0             	test   %rax,%rax
+  804f04:	74 63                	je     804f69 <pageref+0x95>
+  804f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f0e:	48 89 c2             	mov    %rax,%rdx
+  804f11:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f18:	01 00 00 
+  804f1b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f1f:	83 e0 01             	and    $0x1,%eax
+  804f22:	48 85 c0             	test   %rax,%rax
+  804f25:	74 42                	je     804f69 <pageref+0x95>
+  804f27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2b:	48 c1 e8 15          	shr    $0x15,%rax
+  804f2f:	48 89 c2             	mov    %rax,%rdx
+  804f32:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f39:	01 00 00 
+  804f3c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f40:	83 e0 01             	and    $0x1,%eax
+  804f43:	48 85 c0             	test   %rax,%rax
+  804f46:	74 21                	je     804f69 <pageref+0x95>
+  804f48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f4c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f50:	48 89 c2             	mov    %rax,%rdx
+  804f53:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f5a:	01 00 00 
+  804f5d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f61:	83 e0 01             	and    $0x1,%eax
+  804f64:	48 85 c0             	test   %rax,%rax
+  804f67:	75 07                	jne    804f70 <pageref+0x9c>
+    return 0;
+  804f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6e:	eb 53                	jmp    804fc3 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f74:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f78:	48 89 c2             	mov    %rax,%rdx
+  804f7b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f82:	01 00 00 
+  804f85:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f91:	83 e0 01             	and    $0x1,%eax
+  804f94:	48 85 c0             	test   %rax,%rax
+  804f97:	75 07                	jne    804fa0 <pageref+0xcc>
+    return 0;
+  804f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f9e:	eb 23                	jmp    804fc3 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa4:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fa8:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804faf:	00 00 00 
+  804fb2:	48 c1 e0 04          	shl    $0x4,%rax
+  804fb6:	48 01 d0             	add    %rdx,%rax
+  804fb9:	48 83 c0 08          	add    $0x8,%rax
+  804fbd:	0f b7 00             	movzwl (%rax),%eax
+  804fc0:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fc3:	c9                   	leave
+  804fc4:	c3                   	ret
+  804fc5:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,8475 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 20 02 00 00       	call   80024c <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <cat>:
+#include <inc/lib.h>
+
+char buf[8192];
+
+void
+cat(int f, char *s) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  long n;
+  int r;
+
+  while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  800041:	eb 71                	jmp    8000b4 <cat+0x82>
+    if ((r = write(1, buf, n)) != n)
+  800043:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800047:	48 89 c2             	mov    %rax,%rdx
+  80004a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800051:	00 00 00 
+  800054:	48 89 c6             	mov    %rax,%rsi
+  800057:	bf 01 00 00 00       	mov    $0x1,%edi
+  80005c:	48 b8 7f 31 80 00 00 	movabs $0x80317f,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+  800068:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80006b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80006e:	48 98                	cltq
+  800070:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800074:	74 3e                	je     8000b4 <cat+0x82>
+      panic("write error copying %s: %i", s, r);
+  800076:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800079:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80007d:	41 89 d0             	mov    %edx,%r8d
+  800080:	48 89 c1             	mov    %rax,%rcx
+  800083:	48 b8 e0 54 80 00 00 	movabs $0x8054e0,%rax
+  80008a:	00 00 00 
+  80008d:	48 89 c2             	mov    %rax,%rdx
+  800090:	be 0c 00 00 00       	mov    $0xc,%esi
+  800095:	48 b8 fb 54 80 00 00 	movabs $0x8054fb,%rax
+  80009c:	00 00 00 
+  80009f:	48 89 c7             	mov    %rax,%rdi
+  8000a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a7:	49 b9 f3 02 80 00 00 	movabs $0x8002f3,%r9
+  8000ae:	00 00 00 
+  8000b1:	41 ff d1             	call   *%r9
+  while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  8000b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000b7:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8000bc:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8000c3:	00 00 00 
+  8000c6:	48 89 ce             	mov    %rcx,%rsi
+  8000c9:	89 c7                	mov    %eax,%edi
+  8000cb:	48 b8 03 30 80 00 00 	movabs $0x803003,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+  8000d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8000db:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8000e0:	0f 8f 5d ff ff ff    	jg     800043 <cat+0x11>
+  if (n < 0)
+  8000e6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8000eb:	79 41                	jns    80012e <cat+0xfc>
+    panic("error reading %s: %i", s, (int)n);
+  8000ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000f1:	89 c2                	mov    %eax,%edx
+  8000f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000f7:	41 89 d0             	mov    %edx,%r8d
+  8000fa:	48 89 c1             	mov    %rax,%rcx
+  8000fd:	48 b8 06 55 80 00 00 	movabs $0x805506,%rax
+  800104:	00 00 00 
+  800107:	48 89 c2             	mov    %rax,%rdx
+  80010a:	be 0e 00 00 00       	mov    $0xe,%esi
+  80010f:	48 b8 fb 54 80 00 00 	movabs $0x8054fb,%rax
+  800116:	00 00 00 
+  800119:	48 89 c7             	mov    %rax,%rdi
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800121:	49 b9 f3 02 80 00 00 	movabs $0x8002f3,%r9
+  800128:	00 00 00 
+  80012b:	41 ff d1             	call   *%r9
+}
+  80012e:	90                   	nop
+  80012f:	c9                   	leave
+  800130:	c3                   	ret
+
+0000000000800131 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800131:	55                   	push   %rbp
+  800132:	48 89 e5             	mov    %rsp,%rbp
+  800135:	48 83 ec 20          	sub    $0x20,%rsp
+  800139:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80013c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int f, i;
+
+  binaryname = "cat";
+  800140:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800147:	00 00 00 
+  80014a:	48 b9 1b 55 80 00 00 	movabs $0x80551b,%rcx
+  800151:	00 00 00 
+  800154:	48 89 08             	mov    %rcx,(%rax)
+  if (argc == 1)
+  800157:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  80015b:	75 23                	jne    800180 <umain+0x4f>
+    cat(0, "<stdin>");
+  80015d:	48 b8 1f 55 80 00 00 	movabs $0x80551f,%rax
+  800164:	00 00 00 
+  800167:	48 89 c6             	mov    %rax,%rsi
+  80016a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016f:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800176:	00 00 00 
+  800179:	ff d0                	call   *%rax
+      else {
+        cat(f, argv[i]);
+        close(f);
+      }
+    }
+}
+  80017b:	e9 c9 00 00 00       	jmp    800249 <umain+0x118>
+    for (i = 1; i < argc; i++) {
+  800180:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  800187:	e9 b1 00 00 00       	jmp    80023d <umain+0x10c>
+      f = open(argv[i], O_RDONLY);
+  80018c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80018f:	48 98                	cltq
+  800191:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800198:	00 
+  800199:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80019d:	48 01 d0             	add    %rdx,%rax
+  8001a0:	48 8b 00             	mov    (%rax),%rax
+  8001a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a8:	48 89 c7             	mov    %rax,%rdi
+  8001ab:	48 b8 6b 39 80 00 00 	movabs $0x80396b,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      if (f < 0)
+  8001ba:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8001be:	79 3d                	jns    8001fd <umain+0xcc>
+        printf("can't open %s: %i\n", argv[i], f);
+  8001c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001c3:	48 98                	cltq
+  8001c5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8001cc:	00 
+  8001cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001d1:	48 01 d0             	add    %rdx,%rax
+  8001d4:	48 8b 00             	mov    (%rax),%rax
+  8001d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8001da:	48 89 c6             	mov    %rax,%rsi
+  8001dd:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  8001e4:	00 00 00 
+  8001e7:	48 89 c7             	mov    %rax,%rdi
+  8001ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ef:	48 b9 06 41 80 00 00 	movabs $0x804106,%rcx
+  8001f6:	00 00 00 
+  8001f9:	ff d1                	call   *%rcx
+  8001fb:	eb 3c                	jmp    800239 <umain+0x108>
+        cat(f, argv[i]);
+  8001fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800200:	48 98                	cltq
+  800202:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800209:	00 
+  80020a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80020e:	48 01 d0             	add    %rdx,%rax
+  800211:	48 8b 10             	mov    (%rax),%rdx
+  800214:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800217:	48 89 d6             	mov    %rdx,%rsi
+  80021a:	89 c7                	mov    %eax,%edi
+  80021c:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800223:	00 00 00 
+  800226:	ff d0                	call   *%rax
+        close(f);
+  800228:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80022b:	89 c7                	mov    %eax,%edi
+  80022d:	48 b8 1c 2d 80 00 00 	movabs $0x802d1c,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+    for (i = 1; i < argc; i++) {
+  800239:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80023d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800240:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  800243:	0f 8c 43 ff ff ff    	jl     80018c <umain+0x5b>
+}
+  800249:	90                   	nop
+  80024a:	c9                   	leave
+  80024b:	c3                   	ret
+
+000000000080024c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80024c:	55                   	push   %rbp
+  80024d:	48 89 e5             	mov    %rsp,%rbp
+  800250:	48 83 ec 20          	sub    $0x20,%rsp
+  800254:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800257:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80025b:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800262:	00 00 00 
+  800265:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800269:	eb 13                	jmp    80027e <libmain+0x32>
+    (*ctor)();
+  80026b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80026f:	48 8b 10             	mov    (%rax),%rdx
+  800272:	b8 00 00 00 00       	mov    $0x0,%eax
+  800277:	ff d2                	call   *%rdx
+    ctor++;
+  800279:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80027e:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800285:	00 00 00 
+  800288:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80028c:	72 dd                	jb     80026b <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80028e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800292:	7e 14                	jle    8002a8 <libmain+0x5c>
+    binaryname = argv[0];
+  800294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800298:	48 8b 00             	mov    (%rax),%rax
+  80029b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8002a2:	00 00 00 
+  8002a5:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8002a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002af:	48 89 d6             	mov    %rdx,%rsi
+  8002b2:	89 c7                	mov    %eax,%edi
+  8002b4:	48 b8 31 01 80 00 00 	movabs $0x800131,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8002c0:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  8002c7:	00 00 00 
+  8002ca:	ff d0                	call   *%rax
+#endif
+}
+  8002cc:	90                   	nop
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+
+00000000008002cf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002cf:	55                   	push   %rbp
+  8002d0:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8002d3:	48 b8 67 2d 80 00 00 	movabs $0x802d67,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8002df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002e4:	48 b8 48 21 80 00 00 	movabs $0x802148,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+}
+  8002f0:	90                   	nop
+  8002f1:	5d                   	pop    %rbp
+  8002f2:	c3                   	ret
+
+00000000008002f3 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002f3:	55                   	push   %rbp
+  8002f4:	48 89 e5             	mov    %rsp,%rbp
+  8002f7:	53                   	push   %rbx
+  8002f8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8002ff:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800306:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80030c:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800313:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80031a:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800321:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800328:	84 c0                	test   %al,%al
+  80032a:	74 23                	je     80034f <_panic+0x5c>
+  80032c:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800333:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800337:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80033b:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80033f:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800343:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800347:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80034b:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80034f:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800356:	00 00 00 
+  800359:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800360:	00 00 00 
+  800363:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800367:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80036e:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800375:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800383:	00 00 00 
+  800386:	48 8b 18             	mov    (%rax),%rbx
+  800389:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+  800395:	89 c6                	mov    %eax,%esi
+  800397:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80039d:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8003a4:	41 89 d0             	mov    %edx,%r8d
+  8003a7:	48 89 c1             	mov    %rax,%rcx
+  8003aa:	48 89 da             	mov    %rbx,%rdx
+  8003ad:	48 b8 48 55 80 00 00 	movabs $0x805548,%rax
+  8003b4:	00 00 00 
+  8003b7:	48 89 c7             	mov    %rax,%rdi
+  8003ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bf:	49 b9 12 05 80 00 00 	movabs $0x800512,%r9
+  8003c6:	00 00 00 
+  8003c9:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003cc:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8003d3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003da:	48 89 d6             	mov    %rdx,%rsi
+  8003dd:	48 89 c7             	mov    %rax,%rdi
+  8003e0:	48 b8 87 04 80 00 00 	movabs $0x800487,%rax
+  8003e7:	00 00 00 
+  8003ea:	ff d0                	call   *%rax
+  cprintf("\n");
+  8003ec:	48 b8 6b 55 80 00 00 	movabs $0x80556b,%rax
+  8003f3:	00 00 00 
+  8003f6:	48 89 c7             	mov    %rax,%rdi
+  8003f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fe:	48 ba 12 05 80 00 00 	movabs $0x800512,%rdx
+  800405:	00 00 00 
+  800408:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80040a:	cc                   	int3
+  80040b:	eb fd                	jmp    80040a <_panic+0x117>
+
+000000000080040d <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80040d:	55                   	push   %rbp
+  80040e:	48 89 e5             	mov    %rsp,%rbp
+  800411:	48 83 ec 10          	sub    $0x10,%rsp
+  800415:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800418:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80041c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800420:	8b 00                	mov    (%rax),%eax
+  800422:	8d 48 01             	lea    0x1(%rax),%ecx
+  800425:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800429:	89 0a                	mov    %ecx,(%rdx)
+  80042b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80042e:	89 d1                	mov    %edx,%ecx
+  800430:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800434:	48 98                	cltq
+  800436:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80043a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80043e:	8b 00                	mov    (%rax),%eax
+  800440:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800445:	75 2c                	jne    800473 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800447:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80044b:	8b 00                	mov    (%rax),%eax
+  80044d:	48 98                	cltq
+  80044f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800453:	48 83 c2 08          	add    $0x8,%rdx
+  800457:	48 89 c6             	mov    %rax,%rsi
+  80045a:	48 89 d7             	mov    %rdx,%rdi
+  80045d:	48 b8 79 20 80 00 00 	movabs $0x802079,%rax
+  800464:	00 00 00 
+  800467:	ff d0                	call   *%rax
+    b->idx = 0;
+  800469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80046d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800473:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800477:	8b 40 04             	mov    0x4(%rax),%eax
+  80047a:	8d 50 01             	lea    0x1(%rax),%edx
+  80047d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800481:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800484:	90                   	nop
+  800485:	c9                   	leave
+  800486:	c3                   	ret
+
+0000000000800487 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800492:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800499:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8004a0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8004a7:	00 00 00 
+  b.cnt = 0;
+  8004aa:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8004b1:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8004b4:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8004bb:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8004c2:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8004c9:	48 89 c6             	mov    %rax,%rsi
+  8004cc:	48 b8 0d 04 80 00 00 	movabs $0x80040d,%rax
+  8004d3:	00 00 00 
+  8004d6:	48 89 c7             	mov    %rax,%rdi
+  8004d9:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  8004e0:	00 00 00 
+  8004e3:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8004e5:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8004eb:	48 98                	cltq
+  8004ed:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8004f4:	48 83 c2 08          	add    $0x8,%rdx
+  8004f8:	48 89 c6             	mov    %rax,%rsi
+  8004fb:	48 89 d7             	mov    %rdx,%rdi
+  8004fe:	48 b8 79 20 80 00 00 	movabs $0x802079,%rax
+  800505:	00 00 00 
+  800508:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80050a:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800510:	c9                   	leave
+  800511:	c3                   	ret
+
+0000000000800512 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800512:	55                   	push   %rbp
+  800513:	48 89 e5             	mov    %rsp,%rbp
+  800516:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80051d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800524:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80052b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800532:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800539:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800540:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800547:	84 c0                	test   %al,%al
+  800549:	74 20                	je     80056b <cprintf+0x59>
+  80054b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80054f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800553:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800557:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80055b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80055f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800563:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800567:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80056b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800572:	00 00 00 
+  800575:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80057c:	00 00 00 
+  80057f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800583:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80058a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800591:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800598:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80059f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8005a6:	48 89 d6             	mov    %rdx,%rsi
+  8005a9:	48 89 c7             	mov    %rax,%rdi
+  8005ac:	48 b8 87 04 80 00 00 	movabs $0x800487,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+  8005b8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8005be:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005c4:	c9                   	leave
+  8005c5:	c3                   	ret
+
+00000000008005c6 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8005c6:	55                   	push   %rbp
+  8005c7:	48 89 e5             	mov    %rsp,%rbp
+  8005ca:	48 83 ec 30          	sub    $0x30,%rsp
+  8005ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005d6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005da:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8005dd:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8005e1:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8005e5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005e8:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8005ec:	72 54                	jb     800642 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005ee:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8005f1:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8005f4:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8005f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800600:	48 f7 f6             	div    %rsi
+  800603:	49 89 c2             	mov    %rax,%r10
+  800606:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800609:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80060c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800614:	41 89 c9             	mov    %ecx,%r9d
+  800617:	41 89 f8             	mov    %edi,%r8d
+  80061a:	89 d1                	mov    %edx,%ecx
+  80061c:	4c 89 d2             	mov    %r10,%rdx
+  80061f:	48 89 c7             	mov    %rax,%rdi
+  800622:	48 b8 c6 05 80 00 00 	movabs $0x8005c6,%rax
+  800629:	00 00 00 
+  80062c:	ff d0                	call   *%rax
+  80062e:	eb 1c                	jmp    80064c <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800630:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800634:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800637:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80063b:	48 89 d6             	mov    %rdx,%rsi
+  80063e:	89 c7                	mov    %eax,%edi
+  800640:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800642:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800646:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80064a:	7f e4                	jg     800630 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80064c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80064f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800653:	ba 00 00 00 00       	mov    $0x0,%edx
+  800658:	48 f7 f1             	div    %rcx
+  80065b:	48 b8 b0 57 80 00 00 	movabs $0x8057b0,%rax
+  800662:	00 00 00 
+  800665:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800669:	0f be c0             	movsbl %al,%eax
+  80066c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800670:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800674:	48 89 d6             	mov    %rdx,%rsi
+  800677:	89 c7                	mov    %eax,%edi
+  800679:	ff d1                	call   *%rcx
+}
+  80067b:	90                   	nop
+  80067c:	c9                   	leave
+  80067d:	c3                   	ret
+
+000000000080067e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80067e:	55                   	push   %rbp
+  80067f:	48 89 e5             	mov    %rsp,%rbp
+  800682:	48 83 ec 10          	sub    $0x10,%rsp
+  800686:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80068a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80068d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800691:	7e 4b                	jle    8006de <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800693:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800697:	8b 00                	mov    (%rax),%eax
+  800699:	83 f8 2f             	cmp    $0x2f,%eax
+  80069c:	77 24                	ja     8006c2 <getuint+0x44>
+  80069e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006aa:	8b 00                	mov    (%rax),%eax
+  8006ac:	89 c0                	mov    %eax,%eax
+  8006ae:	48 01 d0             	add    %rdx,%rax
+  8006b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006b5:	8b 12                	mov    (%rdx),%edx
+  8006b7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006be:	89 0a                	mov    %ecx,(%rdx)
+  8006c0:	eb 14                	jmp    8006d6 <getuint+0x58>
+  8006c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006ca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006d2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006d6:	48 8b 00             	mov    (%rax),%rax
+  8006d9:	e9 95 00 00 00       	jmp    800773 <getuint+0xf5>
+  else if (lflag)
+  8006de:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006e2:	74 48                	je     80072c <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8006e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006e8:	8b 00                	mov    (%rax),%eax
+  8006ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ed:	77 24                	ja     800713 <getuint+0x95>
+  8006ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fb:	8b 00                	mov    (%rax),%eax
+  8006fd:	89 c0                	mov    %eax,%eax
+  8006ff:	48 01 d0             	add    %rdx,%rax
+  800702:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800706:	8b 12                	mov    (%rdx),%edx
+  800708:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80070b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80070f:	89 0a                	mov    %ecx,(%rdx)
+  800711:	eb 14                	jmp    800727 <getuint+0xa9>
+  800713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800717:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80071b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80071f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800723:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800727:	48 8b 00             	mov    (%rax),%rax
+  80072a:	eb 47                	jmp    800773 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80072c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800730:	8b 00                	mov    (%rax),%eax
+  800732:	83 f8 2f             	cmp    $0x2f,%eax
+  800735:	77 24                	ja     80075b <getuint+0xdd>
+  800737:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80073b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80073f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800743:	8b 00                	mov    (%rax),%eax
+  800745:	89 c0                	mov    %eax,%eax
+  800747:	48 01 d0             	add    %rdx,%rax
+  80074a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80074e:	8b 12                	mov    (%rdx),%edx
+  800750:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800753:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800757:	89 0a                	mov    %ecx,(%rdx)
+  800759:	eb 14                	jmp    80076f <getuint+0xf1>
+  80075b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80075f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800763:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800767:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80076b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80076f:	8b 00                	mov    (%rax),%eax
+  800771:	89 c0                	mov    %eax,%eax
+}
+  800773:	c9                   	leave
+  800774:	c3                   	ret
+
+0000000000800775 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800775:	55                   	push   %rbp
+  800776:	48 89 e5             	mov    %rsp,%rbp
+  800779:	48 83 ec 10          	sub    $0x10,%rsp
+  80077d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800781:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800784:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800788:	7e 4b                	jle    8007d5 <getint+0x60>
+    return va_arg(*ap, long long);
+  80078a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078e:	8b 00                	mov    (%rax),%eax
+  800790:	83 f8 2f             	cmp    $0x2f,%eax
+  800793:	77 24                	ja     8007b9 <getint+0x44>
+  800795:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800799:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80079d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a1:	8b 00                	mov    (%rax),%eax
+  8007a3:	89 c0                	mov    %eax,%eax
+  8007a5:	48 01 d0             	add    %rdx,%rax
+  8007a8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ac:	8b 12                	mov    (%rdx),%edx
+  8007ae:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007b5:	89 0a                	mov    %ecx,(%rdx)
+  8007b7:	eb 14                	jmp    8007cd <getint+0x58>
+  8007b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007bd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007c9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007cd:	48 8b 00             	mov    (%rax),%rax
+  8007d0:	e9 95 00 00 00       	jmp    80086a <getint+0xf5>
+  else if (lflag)
+  8007d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007d9:	74 48                	je     800823 <getint+0xae>
+    return va_arg(*ap, long);
+  8007db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007df:	8b 00                	mov    (%rax),%eax
+  8007e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e4:	77 24                	ja     80080a <getint+0x95>
+  8007e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f2:	8b 00                	mov    (%rax),%eax
+  8007f4:	89 c0                	mov    %eax,%eax
+  8007f6:	48 01 d0             	add    %rdx,%rax
+  8007f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007fd:	8b 12                	mov    (%rdx),%edx
+  8007ff:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800802:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800806:	89 0a                	mov    %ecx,(%rdx)
+  800808:	eb 14                	jmp    80081e <getint+0xa9>
+  80080a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800812:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800816:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80081a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80081e:	48 8b 00             	mov    (%rax),%rax
+  800821:	eb 47                	jmp    80086a <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800823:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800827:	8b 00                	mov    (%rax),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	77 24                	ja     800852 <getint+0xdd>
+  80082e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800832:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083a:	8b 00                	mov    (%rax),%eax
+  80083c:	89 c0                	mov    %eax,%eax
+  80083e:	48 01 d0             	add    %rdx,%rax
+  800841:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800845:	8b 12                	mov    (%rdx),%edx
+  800847:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80084a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80084e:	89 0a                	mov    %ecx,(%rdx)
+  800850:	eb 14                	jmp    800866 <getint+0xf1>
+  800852:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800856:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80085a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80085e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800862:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800866:	8b 00                	mov    (%rax),%eax
+  800868:	48 98                	cltq
+}
+  80086a:	c9                   	leave
+  80086b:	c3                   	ret
+
+000000000080086c <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80086c:	55                   	push   %rbp
+  80086d:	48 89 e5             	mov    %rsp,%rbp
+  800870:	41 54                	push   %r12
+  800872:	53                   	push   %rbx
+  800873:	48 83 ec 60          	sub    $0x60,%rsp
+  800877:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80087b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80087f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800883:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800887:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80088b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80088f:	48 8b 06             	mov    (%rsi),%rax
+  800892:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800896:	48 89 01             	mov    %rax,(%rcx)
+  800899:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80089d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8008a1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8008a5:	eb 17                	jmp    8008be <vprintfmt+0x52>
+      if (ch == '\0')
+  8008a7:	85 db                	test   %ebx,%ebx
+  8008a9:	0f 84 bf 04 00 00    	je     800d6e <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8008af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008b3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008b7:	48 89 c6             	mov    %rax,%rsi
+  8008ba:	89 df                	mov    %ebx,%edi
+  8008bc:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8008be:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008c2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008c6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008ca:	0f b6 00             	movzbl (%rax),%eax
+  8008cd:	0f b6 d8             	movzbl %al,%ebx
+  8008d0:	83 fb 25             	cmp    $0x25,%ebx
+  8008d3:	75 d2                	jne    8008a7 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8008d5:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8008d9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8008e0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8008e7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8008ee:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8008f5:	eb 04                	jmp    8008fb <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8008f7:	90                   	nop
+  8008f8:	eb 01                	jmp    8008fb <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8008fa:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8008fb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800903:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800907:	0f b6 00             	movzbl (%rax),%eax
+  80090a:	0f b6 d8             	movzbl %al,%ebx
+  80090d:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800910:	83 f8 55             	cmp    $0x55,%eax
+  800913:	0f 87 22 04 00 00    	ja     800d3b <vprintfmt+0x4cf>
+  800919:	89 c0                	mov    %eax,%eax
+  80091b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800922:	00 
+  800923:	48 b8 d8 57 80 00 00 	movabs $0x8057d8,%rax
+  80092a:	00 00 00 
+  80092d:	48 01 d0             	add    %rdx,%rax
+  800930:	48 8b 00             	mov    (%rax),%rax
+  800933:	ff e0                	jmp    *%rax
+        padc = '-';
+  800935:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800939:	eb c0                	jmp    8008fb <vprintfmt+0x8f>
+        padc = '0';
+  80093b:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80093f:	eb ba                	jmp    8008fb <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800941:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800948:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80094b:	89 d0                	mov    %edx,%eax
+  80094d:	c1 e0 02             	shl    $0x2,%eax
+  800950:	01 d0                	add    %edx,%eax
+  800952:	01 c0                	add    %eax,%eax
+  800954:	01 d8                	add    %ebx,%eax
+  800956:	83 e8 30             	sub    $0x30,%eax
+  800959:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80095c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800960:	0f b6 00             	movzbl (%rax),%eax
+  800963:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800966:	83 fb 2f             	cmp    $0x2f,%ebx
+  800969:	7e 60                	jle    8009cb <vprintfmt+0x15f>
+  80096b:	83 fb 39             	cmp    $0x39,%ebx
+  80096e:	7f 5b                	jg     8009cb <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800970:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800975:	eb d1                	jmp    800948 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	77 17                	ja     800996 <vprintfmt+0x12a>
+  80097f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800983:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800986:	89 d2                	mov    %edx,%edx
+  800988:	48 01 d0             	add    %rdx,%rax
+  80098b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80098e:	83 c2 08             	add    $0x8,%edx
+  800991:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800994:	eb 0c                	jmp    8009a2 <vprintfmt+0x136>
+  800996:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80099a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80099e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009a2:	8b 00                	mov    (%rax),%eax
+  8009a4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8009a7:	eb 23                	jmp    8009cc <vprintfmt+0x160>
+        if (width < 0)
+  8009a9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009ad:	0f 89 44 ff ff ff    	jns    8008f7 <vprintfmt+0x8b>
+          width = 0;
+  8009b3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8009ba:	e9 38 ff ff ff       	jmp    8008f7 <vprintfmt+0x8b>
+        altflag = 1;
+  8009bf:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8009c6:	e9 30 ff ff ff       	jmp    8008fb <vprintfmt+0x8f>
+        goto process_precision;
+  8009cb:	90                   	nop
+        if (width < 0)
+  8009cc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009d0:	0f 89 24 ff ff ff    	jns    8008fa <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8009d6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009d9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8009dc:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8009e3:	e9 12 ff ff ff       	jmp    8008fa <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8009e8:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8009ec:	e9 0a ff ff ff       	jmp    8008fb <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8009f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f7:	77 17                	ja     800a10 <vprintfmt+0x1a4>
+  8009f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009fd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a00:	89 d2                	mov    %edx,%edx
+  800a02:	48 01 d0             	add    %rdx,%rax
+  800a05:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a08:	83 c2 08             	add    $0x8,%edx
+  800a0b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a0e:	eb 0c                	jmp    800a1c <vprintfmt+0x1b0>
+  800a10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a14:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a18:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a1c:	8b 00                	mov    (%rax),%eax
+  800a1e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a22:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a26:	48 89 d6             	mov    %rdx,%rsi
+  800a29:	89 c7                	mov    %eax,%edi
+  800a2b:	ff d1                	call   *%rcx
+        break;
+  800a2d:	e9 37 03 00 00       	jmp    800d69 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 17                	ja     800a51 <vprintfmt+0x1e5>
+  800a3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a3e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a41:	89 d2                	mov    %edx,%edx
+  800a43:	48 01 d0             	add    %rdx,%rax
+  800a46:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a49:	83 c2 08             	add    $0x8,%edx
+  800a4c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a4f:	eb 0c                	jmp    800a5d <vprintfmt+0x1f1>
+  800a51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a55:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a59:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a5d:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800a5f:	85 db                	test   %ebx,%ebx
+  800a61:	79 02                	jns    800a65 <vprintfmt+0x1f9>
+          err = -err;
+  800a63:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a65:	83 fb 15             	cmp    $0x15,%ebx
+  800a68:	7f 16                	jg     800a80 <vprintfmt+0x214>
+  800a6a:	48 ba 00 57 80 00 00 	movabs $0x805700,%rdx
+  800a71:	00 00 00 
+  800a74:	48 63 c3             	movslq %ebx,%rax
+  800a77:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a7b:	4d 85 e4             	test   %r12,%r12
+  800a7e:	75 2e                	jne    800aae <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800a80:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a84:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a88:	89 d9                	mov    %ebx,%ecx
+  800a8a:	48 ba c1 57 80 00 00 	movabs $0x8057c1,%rdx
+  800a91:	00 00 00 
+  800a94:	48 89 c7             	mov    %rax,%rdi
+  800a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9c:	49 b8 78 0d 80 00 00 	movabs $0x800d78,%r8
+  800aa3:	00 00 00 
+  800aa6:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800aa9:	e9 bb 02 00 00       	jmp    800d69 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800aae:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ab2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ab6:	4c 89 e1             	mov    %r12,%rcx
+  800ab9:	48 ba ca 57 80 00 00 	movabs $0x8057ca,%rdx
+  800ac0:	00 00 00 
+  800ac3:	48 89 c7             	mov    %rax,%rdi
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acb:	49 b8 78 0d 80 00 00 	movabs $0x800d78,%r8
+  800ad2:	00 00 00 
+  800ad5:	41 ff d0             	call   *%r8
+        break;
+  800ad8:	e9 8c 02 00 00       	jmp    800d69 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800add:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae3:	77 17                	ja     800afc <vprintfmt+0x290>
+  800ae5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ae9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aec:	89 d2                	mov    %edx,%edx
+  800aee:	48 01 d0             	add    %rdx,%rax
+  800af1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800af4:	83 c2 08             	add    $0x8,%edx
+  800af7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800afa:	eb 0c                	jmp    800b08 <vprintfmt+0x29c>
+  800afc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b00:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b08:	4c 8b 20             	mov    (%rax),%r12
+  800b0b:	4d 85 e4             	test   %r12,%r12
+  800b0e:	75 0a                	jne    800b1a <vprintfmt+0x2ae>
+          p = "(null)";
+  800b10:	49 bc cd 57 80 00 00 	movabs $0x8057cd,%r12
+  800b17:	00 00 00 
+        if (width > 0 && padc != '-')
+  800b1a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b1e:	7e 78                	jle    800b98 <vprintfmt+0x32c>
+  800b20:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800b24:	74 72                	je     800b98 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800b26:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b29:	48 98                	cltq
+  800b2b:	48 89 c6             	mov    %rax,%rsi
+  800b2e:	4c 89 e7             	mov    %r12,%rdi
+  800b31:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  800b38:	00 00 00 
+  800b3b:	ff d0                	call   *%rax
+  800b3d:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800b40:	eb 17                	jmp    800b59 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800b42:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800b46:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b4a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b4e:	48 89 d6             	mov    %rdx,%rsi
+  800b51:	89 c7                	mov    %eax,%edi
+  800b53:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800b55:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b59:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b5d:	7f e3                	jg     800b42 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b5f:	eb 37                	jmp    800b98 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800b61:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b65:	74 1e                	je     800b85 <vprintfmt+0x319>
+  800b67:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b6a:	7e 05                	jle    800b71 <vprintfmt+0x305>
+  800b6c:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b6f:	7e 14                	jle    800b85 <vprintfmt+0x319>
+            putch('?', putdat);
+  800b71:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b75:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b79:	48 89 c6             	mov    %rax,%rsi
+  800b7c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b81:	ff d2                	call   *%rdx
+  800b83:	eb 0f                	jmp    800b94 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800b85:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b89:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b8d:	48 89 c6             	mov    %rax,%rsi
+  800b90:	89 df                	mov    %ebx,%edi
+  800b92:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b94:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b98:	4c 89 e0             	mov    %r12,%rax
+  800b9b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b9f:	0f b6 00             	movzbl (%rax),%eax
+  800ba2:	0f be d8             	movsbl %al,%ebx
+  800ba5:	85 db                	test   %ebx,%ebx
+  800ba7:	74 28                	je     800bd1 <vprintfmt+0x365>
+  800ba9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800bad:	78 b2                	js     800b61 <vprintfmt+0x2f5>
+  800baf:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800bb3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800bb7:	79 a8                	jns    800b61 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800bb9:	eb 16                	jmp    800bd1 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800bbb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bbf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bc3:	48 89 c6             	mov    %rax,%rsi
+  800bc6:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bcb:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800bcd:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800bd1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bd5:	7f e4                	jg     800bbb <vprintfmt+0x34f>
+        break;
+  800bd7:	e9 8d 01 00 00       	jmp    800d69 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800bdc:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bdf:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800be3:	89 d6                	mov    %edx,%esi
+  800be5:	48 89 c7             	mov    %rax,%rdi
+  800be8:	48 b8 75 07 80 00 00 	movabs $0x800775,%rax
+  800bef:	00 00 00 
+  800bf2:	ff d0                	call   *%rax
+  800bf4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800bf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfc:	48 85 c0             	test   %rax,%rax
+  800bff:	79 1d                	jns    800c1e <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800c01:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c05:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c09:	48 89 c6             	mov    %rax,%rsi
+  800c0c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c11:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800c13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c17:	48 f7 d8             	neg    %rax
+  800c1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800c1e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800c25:	e9 d2 00 00 00       	jmp    800cfc <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800c2a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c2d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c31:	89 d6                	mov    %edx,%esi
+  800c33:	48 89 c7             	mov    %rax,%rdi
+  800c36:	48 b8 7e 06 80 00 00 	movabs $0x80067e,%rax
+  800c3d:	00 00 00 
+  800c40:	ff d0                	call   *%rax
+  800c42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800c46:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800c4d:	e9 aa 00 00 00       	jmp    800cfc <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800c52:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c55:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c59:	89 d6                	mov    %edx,%esi
+  800c5b:	48 89 c7             	mov    %rax,%rdi
+  800c5e:	48 b8 7e 06 80 00 00 	movabs $0x80067e,%rax
+  800c65:	00 00 00 
+  800c68:	ff d0                	call   *%rax
+  800c6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800c6e:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800c75:	e9 82 00 00 00       	jmp    800cfc <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800c7a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c7e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c82:	48 89 c6             	mov    %rax,%rsi
+  800c85:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c8a:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800c8c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c90:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c94:	48 89 c6             	mov    %rax,%rsi
+  800c97:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c9c:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	77 17                	ja     800cbd <vprintfmt+0x451>
+  800ca6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800caa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cad:	89 d2                	mov    %edx,%edx
+  800caf:	48 01 d0             	add    %rdx,%rax
+  800cb2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cb5:	83 c2 08             	add    $0x8,%edx
+  800cb8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cbb:	eb 0c                	jmp    800cc9 <vprintfmt+0x45d>
+  800cbd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cc5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cc9:	48 8b 00             	mov    (%rax),%rax
+  800ccc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800cd0:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800cd7:	eb 23                	jmp    800cfc <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800cd9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cdc:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ce0:	89 d6                	mov    %edx,%esi
+  800ce2:	48 89 c7             	mov    %rax,%rdi
+  800ce5:	48 b8 7e 06 80 00 00 	movabs $0x80067e,%rax
+  800cec:	00 00 00 
+  800cef:	ff d0                	call   *%rax
+  800cf1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800cf5:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800cfc:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800d01:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800d04:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800d07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d0b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d0f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d13:	45 89 c1             	mov    %r8d,%r9d
+  800d16:	41 89 f8             	mov    %edi,%r8d
+  800d19:	48 89 c7             	mov    %rax,%rdi
+  800d1c:	48 b8 c6 05 80 00 00 	movabs $0x8005c6,%rax
+  800d23:	00 00 00 
+  800d26:	ff d0                	call   *%rax
+        break;
+  800d28:	eb 3f                	jmp    800d69 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800d2a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d2e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d32:	48 89 c6             	mov    %rax,%rsi
+  800d35:	89 df                	mov    %ebx,%edi
+  800d37:	ff d2                	call   *%rdx
+        break;
+  800d39:	eb 2e                	jmp    800d69 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800d3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d3f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d43:	48 89 c6             	mov    %rax,%rsi
+  800d46:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d4b:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800d4d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d52:	eb 05                	jmp    800d59 <vprintfmt+0x4ed>
+  800d54:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d59:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d5d:	48 83 e8 01          	sub    $0x1,%rax
+  800d61:	0f b6 00             	movzbl (%rax),%eax
+  800d64:	3c 25                	cmp    $0x25,%al
+  800d66:	75 ec                	jne    800d54 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800d68:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800d69:	e9 50 fb ff ff       	jmp    8008be <vprintfmt+0x52>
+        return;
+  800d6e:	90                   	nop
+    }
+  }
+}
+  800d6f:	48 83 c4 60          	add    $0x60,%rsp
+  800d73:	5b                   	pop    %rbx
+  800d74:	41 5c                	pop    %r12
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+
+0000000000800d78 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800d78:	55                   	push   %rbp
+  800d79:	48 89 e5             	mov    %rsp,%rbp
+  800d7c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d83:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d8a:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800d91:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d98:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d9f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800da6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800dad:	84 c0                	test   %al,%al
+  800daf:	74 20                	je     800dd1 <printfmt+0x59>
+  800db1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800db5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800db9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800dbd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800dc1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800dc5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800dc9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800dcd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800dd1:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800dd8:	00 00 00 
+  800ddb:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800de2:	00 00 00 
+  800de5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800df0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800df7:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800dfe:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800e05:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e0c:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800e13:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e1a:	48 89 c7             	mov    %rax,%rdi
+  800e1d:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  800e24:	00 00 00 
+  800e27:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800e29:	90                   	nop
+  800e2a:	c9                   	leave
+  800e2b:	c3                   	ret
+
+0000000000800e2c <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800e2c:	55                   	push   %rbp
+  800e2d:	48 89 e5             	mov    %rsp,%rbp
+  800e30:	48 83 ec 10          	sub    $0x10,%rsp
+  800e34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800e37:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800e3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e3f:	8b 40 10             	mov    0x10(%rax),%eax
+  800e42:	8d 50 01             	lea    0x1(%rax),%edx
+  800e45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e49:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800e4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e50:	48 8b 10             	mov    (%rax),%rdx
+  800e53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e57:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e5b:	48 39 c2             	cmp    %rax,%rdx
+  800e5e:	73 17                	jae    800e77 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800e60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e64:	48 8b 00             	mov    (%rax),%rax
+  800e67:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e6f:	48 89 0a             	mov    %rcx,(%rdx)
+  800e72:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e75:	88 10                	mov    %dl,(%rax)
+}
+  800e77:	90                   	nop
+  800e78:	c9                   	leave
+  800e79:	c3                   	ret
+
+0000000000800e7a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800e7a:	55                   	push   %rbp
+  800e7b:	48 89 e5             	mov    %rsp,%rbp
+  800e7e:	48 83 ec 40          	sub    $0x40,%rsp
+  800e82:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800e86:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800e89:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800e8d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800e91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e95:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800e99:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800e9c:	48 98                	cltq
+  800e9e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ea6:	48 01 d0             	add    %rdx,%rax
+  800ea9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ead:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800eb4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800eb9:	74 06                	je     800ec1 <vsnprintf+0x47>
+  800ebb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ebf:	7f 07                	jg     800ec8 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800ec1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ec6:	eb 32                	jmp    800efa <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800ec8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800ecc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800ed0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800ed4:	48 89 c6             	mov    %rax,%rsi
+  800ed7:	48 b8 2c 0e 80 00 00 	movabs $0x800e2c,%rax
+  800ede:	00 00 00 
+  800ee1:	48 89 c7             	mov    %rax,%rdi
+  800ee4:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  800eeb:	00 00 00 
+  800eee:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800ef0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ef4:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800ef7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800efa:	c9                   	leave
+  800efb:	c3                   	ret
+
+0000000000800efc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800efc:	55                   	push   %rbp
+  800efd:	48 89 e5             	mov    %rsp,%rbp
+  800f00:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f07:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f0e:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800f14:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f1b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f22:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f29:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f30:	84 c0                	test   %al,%al
+  800f32:	74 20                	je     800f54 <snprintf+0x58>
+  800f34:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f38:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f3c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f40:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f44:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f48:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f4c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f50:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800f54:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f5b:	00 00 00 
+  800f5e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f65:	00 00 00 
+  800f68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f6c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f73:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f7a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800f81:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800f88:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f8f:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800f95:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f9c:	48 89 c7             	mov    %rax,%rdi
+  800f9f:	48 b8 7a 0e 80 00 00 	movabs $0x800e7a,%rax
+  800fa6:	00 00 00 
+  800fa9:	ff d0                	call   *%rax
+  800fab:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800fb1:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800fb7:	c9                   	leave
+  800fb8:	c3                   	ret
+
+0000000000800fb9 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800fb9:	55                   	push   %rbp
+  800fba:	48 89 e5             	mov    %rsp,%rbp
+  800fbd:	53                   	push   %rbx
+  800fbe:	48 83 ec 38          	sub    $0x38,%rsp
+  800fc2:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800fc5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800fc9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800fcd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fd1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800fd5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdd:	89 d1                	mov    %edx,%ecx
+  800fdf:	0f a2                	cpuid
+  800fe1:	89 de                	mov    %ebx,%esi
+  800fe3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800fe6:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800fe9:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800fec:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800fef:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ff4:	74 09                	je     800fff <cpuid+0x46>
+}
+  800ff6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ffa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ffd:	89 10                	mov    %edx,(%rax)
+
+  800fff:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801004:	74 09                	je     80100f <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801006:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80100a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80100d:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80100f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801014:	74 09                	je     80101f <cpuid+0x66>
+char *
+  801016:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80101a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80101d:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80101f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801024:	74 09                	je     80102f <cpuid+0x76>
+  for (; *s; s++)
+  801026:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80102a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80102d:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80102f:	90                   	nop
+  801030:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801034:	c9                   	leave
+  801035:	c3                   	ret
+
+0000000000801036 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801036:	55                   	push   %rbp
+  801037:	48 89 e5             	mov    %rsp,%rbp
+  80103a:	48 83 ec 18          	sub    $0x18,%rsp
+  80103e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801041:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801044:	89 c1                	mov    %eax,%ecx
+  801046:	0f 01 d0             	xgetbv
+  801049:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80104c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80104f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801052:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801055:	48 c1 e2 20          	shl    $0x20,%rdx
+  801059:	48 09 d0             	or     %rdx,%rax
+#else
+  80105c:	c9                   	leave
+  80105d:	c3                   	ret
+
+000000000080105e <string_cpu>:
+string_cpu(void) {
+  80105e:	55                   	push   %rbp
+  80105f:	48 89 e5             	mov    %rsp,%rbp
+  801062:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801066:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80106d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801074:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80107b:	00 00 00 
+  80107e:	8b 00                	mov    (%rax),%eax
+  801080:	85 c0                	test   %eax,%eax
+  801082:	78 11                	js     801095 <string_cpu+0x37>
+    return string_features;
+  801084:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80108b:	00 00 00 
+  80108e:	8b 00                	mov    (%rax),%eax
+  801090:	e9 df 00 00 00       	jmp    801174 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801095:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80109f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a9:	48 89 c6             	mov    %rax,%rsi
+  8010ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b1:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  8010b8:	00 00 00 
+  8010bb:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8010bd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8010c0:	83 f8 06             	cmp    $0x6,%eax
+  8010c3:	76 28                	jbe    8010ed <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8010c5:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8010c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d4:	48 89 c2             	mov    %rax,%rdx
+  8010d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dc:	bf 07 00 00 00       	mov    $0x7,%edi
+  8010e1:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  8010e8:	00 00 00 
+  8010eb:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8010ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8010f0:	25 00 02 00 00       	and    $0x200,%eax
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	74 04                	je     8010fd <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8010f9:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8010fd:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801101:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801107:	48 89 c1             	mov    %rax,%rcx
+  80110a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110f:	be 00 00 00 00       	mov    $0x0,%esi
+  801114:	bf 01 00 00 00       	mov    $0x1,%edi
+  801119:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  801120:	00 00 00 
+  801123:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801125:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801128:	83 e0 20             	and    $0x20,%eax
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	74 2a                	je     801159 <string_cpu+0xfb>
+  80112f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801132:	25 00 00 00 08       	and    $0x8000000,%eax
+  801137:	85 c0                	test   %eax,%eax
+  801139:	74 1e                	je     801159 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80113b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801140:	48 b8 36 10 80 00 00 	movabs $0x801036,%rax
+  801147:	00 00 00 
+  80114a:	ff d0                	call   *%rax
+  80114c:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80114f:	48 83 f8 06          	cmp    $0x6,%rax
+  801153:	75 04                	jne    801159 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801155:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801159:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  801160:	00 00 00 
+  801163:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801166:	89 02                	mov    %eax,(%rdx)
+  801168:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  80116f:	00 00 00 
+  801172:	8b 00                	mov    (%rax),%eax
+}
+  801174:	c9                   	leave
+  801175:	c3                   	ret
+
+0000000000801176 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801176:	55                   	push   %rbp
+  801177:	48 89 e5             	mov    %rsp,%rbp
+  80117a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80117e:	48 83 ec 60          	sub    $0x60,%rsp
+  801182:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801187:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80118c:	83 e0 1f             	and    $0x1f,%eax
+  80118f:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801193:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801197:	48 f7 d8             	neg    %rax
+  80119a:	48 89 c2             	mov    %rax,%rdx
+  80119d:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8011a2:	48 01 d0             	add    %rdx,%rax
+  8011a5:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8011aa:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8011ae:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8011b4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8011b9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8011bd:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8011c3:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8011c7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8011cb:	89 c2                	mov    %eax,%edx
+  8011cd:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8011d1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8011d6:	89 c1                	mov    %eax,%ecx
+  8011d8:	d3 e6                	shl    %cl,%esi
+  8011da:	89 f0                	mov    %esi,%eax
+  8011dc:	21 d0                	and    %edx,%eax
+  8011de:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8011e2:	eb 21                	jmp    801205 <strlen_avx2+0x8f>
+    p += 32;
+  8011e4:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8011ea:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8011ef:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8011f3:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8011f9:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8011fd:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801201:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801205:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80120a:	74 d8                	je     8011e4 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80120c:	31 c0                	xor    %eax,%eax
+  80120e:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801214:	48 63 d0             	movslq %eax,%rdx
+  801217:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80121c:	48 01 d0             	add    %rdx,%rax
+  80121f:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+0000000000801226 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80122e:	48 83 ec 40          	sub    $0x40,%rsp
+  801232:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801237:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80123c:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801241:	eb 77                	jmp    8012ba <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801243:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801248:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80124c:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801250:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801255:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801259:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80125d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801261:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801265:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80126a:	74 3c                	je     8012a8 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80126c:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801270:	f7 d0                	not    %eax
+  801272:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801276:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80127a:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80127e:	48 63 d0             	movslq %eax,%rdx
+  801281:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801286:	48 01 d0             	add    %rdx,%rax
+  801289:	0f b6 00             	movzbl (%rax),%eax
+  80128c:	0f b6 c0             	movzbl %al,%eax
+  80128f:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801293:	48 63 ca             	movslq %edx,%rcx
+  801296:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80129b:	48 01 ca             	add    %rcx,%rdx
+  80129e:	0f b6 12             	movzbl (%rdx),%edx
+  8012a1:	0f b6 d2             	movzbl %dl,%edx
+  8012a4:	29 d0                	sub    %edx,%eax
+  8012a6:	eb 6b                	jmp    801313 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8012a8:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8012ae:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8012b4:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8012ba:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8012c0:	77 81                	ja     801243 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8012c2:	eb 42                	jmp    801306 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8012c4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012c9:	0f b6 10             	movzbl (%rax),%edx
+  8012cc:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012d1:	0f b6 00             	movzbl (%rax),%eax
+  8012d4:	38 c2                	cmp    %al,%dl
+  8012d6:	74 1c                	je     8012f4 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8012d8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012dd:	0f b6 00             	movzbl (%rax),%eax
+  8012e0:	0f b6 c8             	movzbl %al,%ecx
+  8012e3:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012e8:	0f b6 00             	movzbl (%rax),%eax
+  8012eb:	0f b6 d0             	movzbl %al,%edx
+  8012ee:	89 c8                	mov    %ecx,%eax
+  8012f0:	29 d0                	sub    %edx,%eax
+  8012f2:	eb 1f                	jmp    801313 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8012f4:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8012fa:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801300:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801306:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80130c:	75 b6                	jne    8012c4 <memcmp_avx2+0x9e>
+  return 0;
+  80130e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+
+0000000000801315 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80131d:	48 83 ec 60          	sub    $0x60,%rsp
+  801321:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801326:	89 f0                	mov    %esi,%eax
+  801328:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80132d:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801331:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801336:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80133a:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80133f:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801345:	eb 47                	jmp    80138e <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801347:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80134c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801350:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801354:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80135a:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80135e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801362:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801366:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80136b:	74 15                	je     801382 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80136d:	31 c0                	xor    %eax,%eax
+  80136f:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801375:	48 63 d0             	movslq %eax,%rdx
+  801378:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80137d:	48 01 d0             	add    %rdx,%rax
+  801380:	eb 3d                	jmp    8013bf <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801382:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801388:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80138e:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801394:	77 b1                	ja     801347 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801396:	eb 0c                	jmp    8013a4 <memfind_avx2+0x8f>
+  801398:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80139e:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8013a4:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8013aa:	74 0e                	je     8013ba <memfind_avx2+0xa5>
+  8013ac:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013b1:	0f b6 00             	movzbl (%rax),%eax
+  8013b4:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8013b8:	75 de                	jne    801398 <memfind_avx2+0x83>
+  return s;
+  8013ba:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+
+00000000008013c1 <strlen>:
+strlen(const char *s) {
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	48 83 ec 40          	sub    $0x40,%rsp
+  8013c9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8013cd:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8013d1:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8013d5:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  8013dc:	00 00 00 
+  8013df:	ff d0                	call   *%rax
+  8013e1:	83 e0 02             	and    $0x2,%eax
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	74 18                	je     801400 <strlen+0x3f>
+    return strlen_avx2(s);
+  8013e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013ec:	48 89 c7             	mov    %rax,%rdi
+  8013ef:	48 b8 76 11 80 00 00 	movabs $0x801176,%rax
+  8013f6:	00 00 00 
+  8013f9:	ff d0                	call   *%rax
+  8013fb:	e9 82 00 00 00       	jmp    801482 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801400:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801404:	83 e0 0f             	and    $0xf,%eax
+  801407:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80140a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80140d:	48 f7 d8             	neg    %rax
+  801410:	48 89 c2             	mov    %rax,%rdx
+  801413:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801417:	48 01 d0             	add    %rdx,%rax
+  80141a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80141e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801422:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801426:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80142b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80142f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801433:	89 c2                	mov    %eax,%edx
+  801435:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801438:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80143d:	89 c1                	mov    %eax,%ecx
+  80143f:	d3 e6                	shl    %cl,%esi
+  801441:	89 f0                	mov    %esi,%eax
+  801443:	21 d0                	and    %edx,%eax
+  801445:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801448:	eb 1d                	jmp    801467 <strlen+0xa6>
+    p += 16;
+  80144a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80144f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801453:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801457:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80145c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801460:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801464:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801467:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80146b:	74 dd                	je     80144a <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80146d:	31 c0                	xor    %eax,%eax
+  80146f:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801474:	48 63 d0             	movslq %eax,%rdx
+  801477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80147b:	48 01 d0             	add    %rdx,%rax
+  80147e:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801482:	c9                   	leave
+  801483:	c3                   	ret
+
+0000000000801484 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801484:	55                   	push   %rbp
+  801485:	48 89 e5             	mov    %rsp,%rbp
+  801488:	48 83 ec 20          	sub    $0x20,%rsp
+  80148c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801490:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801494:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80149b:	eb 0e                	jmp    8014ab <strnlen+0x27>
+    n++;
+  80149d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014a1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014a6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8014ab:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8014b0:	74 0b                	je     8014bd <strnlen+0x39>
+  8014b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b6:	0f b6 00             	movzbl (%rax),%eax
+  8014b9:	84 c0                	test   %al,%al
+  8014bb:	75 e0                	jne    80149d <strnlen+0x19>
+  return n;
+  8014bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+
+00000000008014c2 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8014c2:	55                   	push   %rbp
+  8014c3:	48 89 e5             	mov    %rsp,%rbp
+  8014c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8014ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8014d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8014da:	90                   	nop
+  8014db:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014df:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014eb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014f3:	0f b6 12             	movzbl (%rdx),%edx
+  8014f6:	88 10                	mov    %dl,(%rax)
+  8014f8:	0f b6 00             	movzbl (%rax),%eax
+  8014fb:	84 c0                	test   %al,%al
+  8014fd:	75 dc                	jne    8014db <strcpy+0x19>
+  return ret;
+  8014ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801503:	c9                   	leave
+  801504:	c3                   	ret
+
+0000000000801505 <strcat>:
+strcat(char *dst, const char *src) {
+  801505:	55                   	push   %rbp
+  801506:	48 89 e5             	mov    %rsp,%rbp
+  801509:	48 83 ec 20          	sub    $0x20,%rsp
+  80150d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801511:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801515:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801519:	48 89 c7             	mov    %rax,%rdi
+  80151c:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  801523:	00 00 00 
+  801526:	ff d0                	call   *%rax
+  801528:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80152b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80152e:	48 63 d0             	movslq %eax,%rdx
+  801531:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801535:	48 01 c2             	add    %rax,%rdx
+  801538:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80153c:	48 89 c6             	mov    %rax,%rsi
+  80153f:	48 89 d7             	mov    %rdx,%rdi
+  801542:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  801549:	00 00 00 
+  80154c:	ff d0                	call   *%rax
+  return dst;
+  80154e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801552:	c9                   	leave
+  801553:	c3                   	ret
+
+0000000000801554 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801554:	55                   	push   %rbp
+  801555:	48 89 e5             	mov    %rsp,%rbp
+  801558:	48 83 ec 28          	sub    $0x28,%rsp
+  80155c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801560:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801564:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801570:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801577:	00 
+  801578:	eb 2a                	jmp    8015a4 <strncpy+0x50>
+    *dst++ = *src;
+  80157a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801582:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801586:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80158a:	0f b6 12             	movzbl (%rdx),%edx
+  80158d:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80158f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801593:	0f b6 00             	movzbl (%rax),%eax
+  801596:	84 c0                	test   %al,%al
+  801598:	74 05                	je     80159f <strncpy+0x4b>
+      src++;
+  80159a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80159f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015ac:	72 cc                	jb     80157a <strncpy+0x26>
+  return ret;
+  8015ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+
+00000000008015b4 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8015b4:	55                   	push   %rbp
+  8015b5:	48 89 e5             	mov    %rsp,%rbp
+  8015b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8015bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8015c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8015d0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8015d5:	74 3d                	je     801614 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8015d7:	eb 1d                	jmp    8015f6 <strlcpy+0x42>
+      *dst++ = *src++;
+  8015d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015dd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015e1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015ed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015f1:	0f b6 12             	movzbl (%rdx),%edx
+  8015f4:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8015f6:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8015fb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801600:	74 0b                	je     80160d <strlcpy+0x59>
+  801602:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801606:	0f b6 00             	movzbl (%rax),%eax
+  801609:	84 c0                	test   %al,%al
+  80160b:	75 cc                	jne    8015d9 <strlcpy+0x25>
+    *dst = '\0';
+  80160d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801611:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801614:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801618:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+000000000080161e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	48 83 ec 30          	sub    $0x30,%rsp
+  801626:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80162a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80162e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801632:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801636:	48 89 c7             	mov    %rax,%rdi
+  801639:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  801640:	00 00 00 
+  801643:	ff d0                	call   *%rax
+  801645:	48 98                	cltq
+  801647:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80164b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80164f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801653:	48 89 d6             	mov    %rdx,%rsi
+  801656:	48 89 c7             	mov    %rax,%rdi
+  801659:	48 b8 84 14 80 00 00 	movabs $0x801484,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+  801665:	48 98                	cltq
+  801667:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80166b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80166f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801673:	75 10                	jne    801685 <strlcat+0x67>
+    return maxlen + srclen;
+  801675:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167d:	48 01 d0             	add    %rdx,%rax
+  801680:	e9 86 00 00 00       	jmp    80170b <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801685:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801689:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80168d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801691:	73 2b                	jae    8016be <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801693:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801697:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80169b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80169f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016a3:	48 01 c1             	add    %rax,%rcx
+  8016a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016aa:	48 89 c6             	mov    %rax,%rsi
+  8016ad:	48 89 cf             	mov    %rcx,%rdi
+  8016b0:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  8016b7:	00 00 00 
+  8016ba:	ff d0                	call   *%rax
+  8016bc:	eb 42                	jmp    801700 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8016be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016c6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ce:	48 01 c1             	add    %rax,%rcx
+  8016d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016d5:	48 89 c6             	mov    %rax,%rsi
+  8016d8:	48 89 cf             	mov    %rcx,%rdi
+  8016db:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  8016e2:	00 00 00 
+  8016e5:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8016e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ef:	48 01 d0             	add    %rdx,%rax
+  8016f2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fa:	48 01 d0             	add    %rdx,%rax
+  8016fd:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801700:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801704:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801708:	48 01 d0             	add    %rdx,%rax
+}
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+000000000080170d <strcmp>:
+strcmp(const char *p, const char *q) {
+  80170d:	55                   	push   %rbp
+  80170e:	48 89 e5             	mov    %rsp,%rbp
+  801711:	48 83 ec 10          	sub    $0x10,%rsp
+  801715:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801719:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80171d:	eb 0a                	jmp    801729 <strcmp+0x1c>
+    p++, q++;
+  80171f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801724:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172d:	0f b6 00             	movzbl (%rax),%eax
+  801730:	84 c0                	test   %al,%al
+  801732:	74 12                	je     801746 <strcmp+0x39>
+  801734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801738:	0f b6 10             	movzbl (%rax),%edx
+  80173b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173f:	0f b6 00             	movzbl (%rax),%eax
+  801742:	38 c2                	cmp    %al,%dl
+  801744:	74 d9                	je     80171f <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801746:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174a:	0f b6 00             	movzbl (%rax),%eax
+  80174d:	0f b6 d0             	movzbl %al,%edx
+  801750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801754:	0f b6 00             	movzbl (%rax),%eax
+  801757:	0f b6 c0             	movzbl %al,%eax
+  80175a:	29 c2                	sub    %eax,%edx
+  80175c:	89 d0                	mov    %edx,%eax
+}
+  80175e:	c9                   	leave
+  80175f:	c3                   	ret
+
+0000000000801760 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801760:	55                   	push   %rbp
+  801761:	48 89 e5             	mov    %rsp,%rbp
+  801764:	48 83 ec 18          	sub    $0x18,%rsp
+  801768:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80176c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801770:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801774:	eb 0f                	jmp    801785 <strncmp+0x25>
+    n--, p++, q++;
+  801776:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80177b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801780:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801785:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80178a:	74 1d                	je     8017a9 <strncmp+0x49>
+  80178c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801790:	0f b6 00             	movzbl (%rax),%eax
+  801793:	84 c0                	test   %al,%al
+  801795:	74 12                	je     8017a9 <strncmp+0x49>
+  801797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179b:	0f b6 10             	movzbl (%rax),%edx
+  80179e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a2:	0f b6 00             	movzbl (%rax),%eax
+  8017a5:	38 c2                	cmp    %al,%dl
+  8017a7:	74 cd                	je     801776 <strncmp+0x16>
+  if (n == 0)
+  8017a9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017ae:	75 07                	jne    8017b7 <strncmp+0x57>
+    return 0;
+  8017b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b5:	eb 16                	jmp    8017cd <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8017b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bb:	0f b6 00             	movzbl (%rax),%eax
+  8017be:	0f b6 d0             	movzbl %al,%edx
+  8017c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c5:	0f b6 00             	movzbl (%rax),%eax
+  8017c8:	0f b6 c0             	movzbl %al,%eax
+  8017cb:	29 c2                	sub    %eax,%edx
+}
+  8017cd:	89 d0                	mov    %edx,%eax
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+
+00000000008017d1 <strchr>:
+strchr(const char *s, char c) {
+  8017d1:	55                   	push   %rbp
+  8017d2:	48 89 e5             	mov    %rsp,%rbp
+  8017d5:	48 83 ec 60          	sub    $0x60,%rsp
+  8017d9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8017dd:	89 f0                	mov    %esi,%eax
+  8017df:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8017e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8017e6:	83 e0 0f             	and    $0xf,%eax
+  8017e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8017ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017ef:	48 f7 d8             	neg    %rax
+  8017f2:	48 89 c2             	mov    %rax,%rdx
+  8017f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8017f9:	48 01 d0             	add    %rdx,%rax
+  8017fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801800:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801804:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801808:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80180c:	66 0f 6e c0          	movd   %eax,%xmm0
+  801810:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801814:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801818:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80181d:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801821:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801825:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801829:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80182d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801832:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801837:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80183b:	89 c2                	mov    %eax,%edx
+  80183d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801842:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801847:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80184b:	09 c2                	or     %eax,%edx
+  80184d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801850:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801855:	89 c1                	mov    %eax,%ecx
+  801857:	d3 e6                	shl    %cl,%esi
+  801859:	89 f0                	mov    %esi,%eax
+  80185b:	21 d0                	and    %edx,%eax
+  80185d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801860:	eb 34                	jmp    801896 <strchr+0xc5>
+    p += 16;
+  801862:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801867:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80186f:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801873:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801878:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80187d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801881:	89 c2                	mov    %eax,%edx
+  801883:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801888:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80188d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801891:	09 d0                	or     %edx,%eax
+  801893:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801896:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80189a:	74 c6                	je     801862 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80189c:	31 c0                	xor    %eax,%eax
+  80189e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8018a3:	48 98                	cltq
+  8018a5:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8018a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ad:	0f b6 00             	movzbl (%rax),%eax
+  8018b0:	84 c0                	test   %al,%al
+  8018b2:	74 06                	je     8018ba <strchr+0xe9>
+  8018b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b8:	eb 05                	jmp    8018bf <strchr+0xee>
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018bf:	c9                   	leave
+  8018c0:	c3                   	ret
+
+00000000008018c1 <strfind>:
+strfind(const char *s, char c) {
+  8018c1:	55                   	push   %rbp
+  8018c2:	48 89 e5             	mov    %rsp,%rbp
+  8018c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8018c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018cd:	89 f0                	mov    %esi,%eax
+  8018cf:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8018d2:	eb 11                	jmp    8018e5 <strfind+0x24>
+    if (*s == c)
+  8018d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d8:	0f b6 00             	movzbl (%rax),%eax
+  8018db:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018de:	74 12                	je     8018f2 <strfind+0x31>
+  for (; *s; s++)
+  8018e0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e9:	0f b6 00             	movzbl (%rax),%eax
+  8018ec:	84 c0                	test   %al,%al
+  8018ee:	75 e4                	jne    8018d4 <strfind+0x13>
+  8018f0:	eb 01                	jmp    8018f3 <strfind+0x32>
+      break;
+  8018f2:	90                   	nop
+  return (char *)s;
+  8018f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+
+00000000008018f9 <memset>:
+memset(void *v, int c, size_t n) {
+  8018f9:	55                   	push   %rbp
+  8018fa:	48 89 e5             	mov    %rsp,%rbp
+  8018fd:	48 83 ec 38          	sub    $0x38,%rsp
+  801901:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801905:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801908:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80190c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801910:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801914:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801919:	76 41                	jbe    80195c <memset+0x63>
+  80191b:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+  801927:	83 e0 01             	and    $0x1,%eax
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	74 2e                	je     80195c <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80192e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801931:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801935:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801939:	48 89 ce             	mov    %rcx,%rsi
+  80193c:	48 89 f7             	mov    %rsi,%rdi
+  80193f:	48 89 d1             	mov    %rdx,%rcx
+  801942:	fc                   	cld
+  801943:	f3 aa                	rep stos %al,%es:(%rdi)
+  801945:	48 89 ca             	mov    %rcx,%rdx
+  801948:	48 89 fe             	mov    %rdi,%rsi
+  80194b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80194f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801953:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801957:	e9 a7 00 00 00       	jmp    801a03 <memset+0x10a>
+  if (n >= 8) {
+  80195c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801961:	0f 86 87 00 00 00    	jbe    8019ee <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801967:	eb 16                	jmp    80197f <memset+0x86>
+      *p++ = c;
+  801969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80196d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801971:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801975:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801978:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80197a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80197f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801983:	83 e0 07             	and    $0x7,%eax
+  801986:	48 85 c0             	test   %rax,%rax
+  801989:	75 de                	jne    801969 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80198b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80198e:	0f b6 c0             	movzbl %al,%eax
+  801991:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801998:	01 01 01 
+  80199b:	48 0f af c2          	imul   %rdx,%rax
+  80199f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8019a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019a7:	48 c1 e8 03          	shr    $0x3,%rax
+  8019ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8019af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019b7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019bb:	48 89 ce             	mov    %rcx,%rsi
+  8019be:	48 89 f7             	mov    %rsi,%rdi
+  8019c1:	48 89 d1             	mov    %rdx,%rcx
+  8019c4:	fc                   	cld
+  8019c5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8019c8:	48 89 ca             	mov    %rcx,%rdx
+  8019cb:	48 89 fe             	mov    %rdi,%rsi
+  8019ce:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8019d2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8019d6:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8019db:	eb 11                	jmp    8019ee <memset+0xf5>
+    *p++ = c;
+  8019dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019e5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019e9:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019ec:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8019ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019f2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019fa:	48 85 c0             	test   %rax,%rax
+  8019fd:	75 de                	jne    8019dd <memset+0xe4>
+  return v;
+  8019ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a03:	c9                   	leave
+  801a04:	c3                   	ret
+
+0000000000801a05 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	48 83 ec 38          	sub    $0x38,%rsp
+  801a0d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a11:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a15:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801a19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a1d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801a21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a25:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801a29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a31:	0f 83 da 00 00 00    	jae    801b11 <memmove+0x10c>
+  801a37:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a3f:	48 01 d0             	add    %rdx,%rax
+  801a42:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a46:	0f 83 c5 00 00 00    	jae    801b11 <memmove+0x10c>
+    s += n;
+  801a4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a50:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801a54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a58:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801a5c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a61:	0f 86 94 00 00 00    	jbe    801afb <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801a67:	eb 1c                	jmp    801a85 <memmove+0x80>
+        *--d = *--s;
+  801a69:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801a6e:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801a73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a77:	0f b6 10             	movzbl (%rax),%edx
+  801a7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7e:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a80:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a89:	83 e0 07             	and    $0x7,%eax
+  801a8c:	48 85 c0             	test   %rax,%rax
+  801a8f:	75 d8                	jne    801a69 <memmove+0x64>
+      nq = n / 8;
+  801a91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a95:	48 c1 e8 03          	shr    $0x3,%rax
+  801a99:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801a9d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801aa2:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801aa7:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801aac:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ab0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ab4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab8:	48 89 cf             	mov    %rcx,%rdi
+  801abb:	48 89 d6             	mov    %rdx,%rsi
+  801abe:	48 89 c1             	mov    %rax,%rcx
+  801ac1:	fd                   	std
+  801ac2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ac5:	fc                   	cld
+  801ac6:	48 89 c8             	mov    %rcx,%rax
+  801ac9:	48 89 f2             	mov    %rsi,%rdx
+  801acc:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ad0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ad4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801ad8:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801add:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801ae2:	eb 17                	jmp    801afb <memmove+0xf6>
+      *--d = *--s;
+  801ae4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801ae9:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801aee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af2:	0f b6 10             	movzbl (%rax),%edx
+  801af5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801afb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aff:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b03:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b07:	48 85 c0             	test   %rax,%rax
+  801b0a:	75 d8                	jne    801ae4 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801b0c:	e9 f4 00 00 00       	jmp    801c05 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801b11:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801b16:	76 46                	jbe    801b5e <memmove+0x159>
+  801b18:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  801b1f:	00 00 00 
+  801b22:	ff d0                	call   *%rax
+  801b24:	83 e0 01             	and    $0x1,%eax
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	74 33                	je     801b5e <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801b2b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b37:	48 89 cf             	mov    %rcx,%rdi
+  801b3a:	48 89 d6             	mov    %rdx,%rsi
+  801b3d:	48 89 c1             	mov    %rax,%rcx
+  801b40:	fc                   	cld
+  801b41:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801b43:	48 89 c8             	mov    %rcx,%rax
+  801b46:	48 89 f2             	mov    %rsi,%rdx
+  801b49:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b4d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b51:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801b55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b59:	e9 ab 00 00 00       	jmp    801c09 <memmove+0x204>
+    if (n >= 8) {
+  801b5e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b63:	0f 86 8b 00 00 00    	jbe    801bf4 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801b69:	eb 22                	jmp    801b8d <memmove+0x188>
+        *d++ = *s++;
+  801b6b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b6f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b73:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801b77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b7f:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b83:	0f b6 12             	movzbl (%rdx),%edx
+  801b86:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b88:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b91:	83 e0 07             	and    $0x7,%eax
+  801b94:	48 85 c0             	test   %rax,%rax
+  801b97:	75 d2                	jne    801b6b <memmove+0x166>
+      nq = n / 8;
+  801b99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b9d:	48 c1 e8 03          	shr    $0x3,%rax
+  801ba1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801ba5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ba9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bb1:	48 89 cf             	mov    %rcx,%rdi
+  801bb4:	48 89 d6             	mov    %rdx,%rsi
+  801bb7:	48 89 c1             	mov    %rax,%rcx
+  801bba:	fc                   	cld
+  801bbb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801bbe:	48 89 c8             	mov    %rcx,%rax
+  801bc1:	48 89 f2             	mov    %rsi,%rdx
+  801bc4:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bc8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bcc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801bd0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801bd5:	eb 1d                	jmp    801bf4 <memmove+0x1ef>
+      *d++ = *s++;
+  801bd7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bdb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801bdf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801be3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801beb:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801bef:	0f b6 12             	movzbl (%rdx),%edx
+  801bf2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801bf4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bfc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c00:	48 85 c0             	test   %rax,%rax
+  801c03:	75 d2                	jne    801bd7 <memmove+0x1d2>
+  return dst;
+  801c05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801c09:	c9                   	leave
+  801c0a:	c3                   	ret
+
+0000000000801c0b <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c0b:	55                   	push   %rbp
+  801c0c:	48 89 e5             	mov    %rsp,%rbp
+  801c0f:	48 83 ec 18          	sub    $0x18,%rsp
+  801c13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c17:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c1b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801c1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c23:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c2b:	48 89 ce             	mov    %rcx,%rsi
+  801c2e:	48 89 c7             	mov    %rax,%rdi
+  801c31:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  801c38:	00 00 00 
+  801c3b:	ff d0                	call   *%rax
+}
+  801c3d:	c9                   	leave
+  801c3e:	c3                   	ret
+
+0000000000801c3f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	48 83 ec 40          	sub    $0x40,%rsp
+  801c47:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c4b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c4f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801c53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c57:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801c5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c5f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801c63:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801c68:	0f 86 a7 00 00 00    	jbe    801d15 <memcmp+0xd6>
+  801c6e:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  801c75:	00 00 00 
+  801c78:	ff d0                	call   *%rax
+  801c7a:	83 e0 02             	and    $0x2,%eax
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	0f 84 90 00 00 00    	je     801d15 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801c85:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c89:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c91:	48 89 ce             	mov    %rcx,%rsi
+  801c94:	48 89 c7             	mov    %rax,%rdi
+  801c97:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	e9 c2 00 00 00       	jmp    801d6a <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801ca8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cac:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cb0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801cb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cb8:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cbc:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801cc0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801cc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801cc7:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801cce:	74 36                	je     801d06 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801cd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cd3:	f7 d0                	not    %eax
+  801cd5:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801cd9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801cdc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801cdf:	48 63 d0             	movslq %eax,%rdx
+  801ce2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ce6:	48 01 d0             	add    %rdx,%rax
+  801ce9:	0f b6 00             	movzbl (%rax),%eax
+  801cec:	0f b6 c0             	movzbl %al,%eax
+  801cef:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801cf2:	48 63 ca             	movslq %edx,%rcx
+  801cf5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cf9:	48 01 ca             	add    %rcx,%rdx
+  801cfc:	0f b6 12             	movzbl (%rdx),%edx
+  801cff:	0f b6 d2             	movzbl %dl,%edx
+  801d02:	29 d0                	sub    %edx,%eax
+  801d04:	eb 64                	jmp    801d6a <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801d06:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801d0b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801d10:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801d15:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801d1a:	77 8c                	ja     801ca8 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801d1c:	eb 36                	jmp    801d54 <memcmp+0x115>
+    if (*s1 != *s2)
+  801d1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d22:	0f b6 10             	movzbl (%rax),%edx
+  801d25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d29:	0f b6 00             	movzbl (%rax),%eax
+  801d2c:	38 c2                	cmp    %al,%dl
+  801d2e:	74 1a                	je     801d4a <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d34:	0f b6 00             	movzbl (%rax),%eax
+  801d37:	0f b6 c8             	movzbl %al,%ecx
+  801d3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d3e:	0f b6 00             	movzbl (%rax),%eax
+  801d41:	0f b6 d0             	movzbl %al,%edx
+  801d44:	89 c8                	mov    %ecx,%eax
+  801d46:	29 d0                	sub    %edx,%eax
+  801d48:	eb 20                	jmp    801d6a <memcmp+0x12b>
+    s1++, s2++;
+  801d4a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801d4f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801d54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d58:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d5c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d60:	48 85 c0             	test   %rax,%rax
+  801d63:	75 b9                	jne    801d1e <memcmp+0xdf>
+  }
+
+  return 0;
+  801d65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+
+0000000000801d6c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801d6c:	55                   	push   %rbp
+  801d6d:	48 89 e5             	mov    %rsp,%rbp
+  801d70:	48 83 ec 50          	sub    $0x50,%rsp
+  801d74:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801d78:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801d7b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801d7f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d83:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801d87:	48 01 d0             	add    %rdx,%rax
+  801d8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801d8e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801d91:	66 0f 6e c0          	movd   %eax,%xmm0
+  801d95:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801d99:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801d9d:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801da2:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801da6:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801dab:	76 73                	jbe    801e20 <memfind+0xb4>
+  801dad:	48 b8 5e 10 80 00 00 	movabs $0x80105e,%rax
+  801db4:	00 00 00 
+  801db7:	ff d0                	call   *%rax
+  801db9:	83 e0 02             	and    $0x2,%eax
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	74 60                	je     801e20 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801dc0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801dc3:	0f b6 c8             	movzbl %al,%ecx
+  801dc6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801dca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dce:	89 ce                	mov    %ecx,%esi
+  801dd0:	48 89 c7             	mov    %rax,%rdi
+  801dd3:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  801dda:	00 00 00 
+  801ddd:	ff d0                	call   *%rax
+  801ddf:	eb 6c                	jmp    801e4d <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801de1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801de5:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801de9:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ded:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801df2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801df6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801dfa:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801dfd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801e01:	74 13                	je     801e16 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801e03:	31 c0                	xor    %eax,%eax
+  801e05:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801e0a:	48 63 d0             	movslq %eax,%rdx
+  801e0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e11:	48 01 d0             	add    %rdx,%rax
+  801e14:	eb 37                	jmp    801e4d <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801e16:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801e1b:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801e20:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801e25:	77 ba                	ja     801de1 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801e27:	eb 13                	jmp    801e3c <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801e29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2d:	0f b6 00             	movzbl (%rax),%eax
+  801e30:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801e33:	38 d0                	cmp    %dl,%al
+  801e35:	74 11                	je     801e48 <memfind+0xdc>
+  for (; s < ends; s++)
+  801e37:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e40:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801e44:	72 e3                	jb     801e29 <memfind+0xbd>
+  801e46:	eb 01                	jmp    801e49 <memfind+0xdd>
+      break;
+  801e48:	90                   	nop
+  return (void *)s;
+  801e49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+0000000000801e4f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+  801e53:	48 83 ec 38          	sub    $0x38,%rsp
+  801e57:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e5b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e5f:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801e62:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801e69:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801e70:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801e71:	eb 05                	jmp    801e78 <strtol+0x29>
+    s++;
+  801e73:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801e78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e7c:	0f b6 00             	movzbl (%rax),%eax
+  801e7f:	3c 20                	cmp    $0x20,%al
+  801e81:	74 f0                	je     801e73 <strtol+0x24>
+  801e83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e87:	0f b6 00             	movzbl (%rax),%eax
+  801e8a:	3c 09                	cmp    $0x9,%al
+  801e8c:	74 e5                	je     801e73 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801e8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e92:	0f b6 00             	movzbl (%rax),%eax
+  801e95:	3c 2b                	cmp    $0x2b,%al
+  801e97:	75 07                	jne    801ea0 <strtol+0x51>
+    s++;
+  801e99:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e9e:	eb 17                	jmp    801eb7 <strtol+0x68>
+  else if (*s == '-')
+  801ea0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea4:	0f b6 00             	movzbl (%rax),%eax
+  801ea7:	3c 2d                	cmp    $0x2d,%al
+  801ea9:	75 0c                	jne    801eb7 <strtol+0x68>
+    s++, neg = 1;
+  801eab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801eb0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801eb7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ebb:	74 06                	je     801ec3 <strtol+0x74>
+  801ebd:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ec1:	75 28                	jne    801eeb <strtol+0x9c>
+  801ec3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ec7:	0f b6 00             	movzbl (%rax),%eax
+  801eca:	3c 30                	cmp    $0x30,%al
+  801ecc:	75 1d                	jne    801eeb <strtol+0x9c>
+  801ece:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed2:	48 83 c0 01          	add    $0x1,%rax
+  801ed6:	0f b6 00             	movzbl (%rax),%eax
+  801ed9:	3c 78                	cmp    $0x78,%al
+  801edb:	75 0e                	jne    801eeb <strtol+0x9c>
+    s += 2, base = 16;
+  801edd:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801ee2:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ee9:	eb 2c                	jmp    801f17 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801eeb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801eef:	75 19                	jne    801f0a <strtol+0xbb>
+  801ef1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ef5:	0f b6 00             	movzbl (%rax),%eax
+  801ef8:	3c 30                	cmp    $0x30,%al
+  801efa:	75 0e                	jne    801f0a <strtol+0xbb>
+    s++, base = 8;
+  801efc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f01:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f08:	eb 0d                	jmp    801f17 <strtol+0xc8>
+  else if (base == 0)
+  801f0a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f0e:	75 07                	jne    801f17 <strtol+0xc8>
+    base = 10;
+  801f10:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801f17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f1b:	0f b6 00             	movzbl (%rax),%eax
+  801f1e:	3c 2f                	cmp    $0x2f,%al
+  801f20:	7e 1d                	jle    801f3f <strtol+0xf0>
+  801f22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f26:	0f b6 00             	movzbl (%rax),%eax
+  801f29:	3c 39                	cmp    $0x39,%al
+  801f2b:	7f 12                	jg     801f3f <strtol+0xf0>
+      dig = *s - '0';
+  801f2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f31:	0f b6 00             	movzbl (%rax),%eax
+  801f34:	0f be c0             	movsbl %al,%eax
+  801f37:	83 e8 30             	sub    $0x30,%eax
+  801f3a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f3d:	eb 4e                	jmp    801f8d <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801f3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f43:	0f b6 00             	movzbl (%rax),%eax
+  801f46:	3c 60                	cmp    $0x60,%al
+  801f48:	7e 1d                	jle    801f67 <strtol+0x118>
+  801f4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f4e:	0f b6 00             	movzbl (%rax),%eax
+  801f51:	3c 7a                	cmp    $0x7a,%al
+  801f53:	7f 12                	jg     801f67 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801f55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f59:	0f b6 00             	movzbl (%rax),%eax
+  801f5c:	0f be c0             	movsbl %al,%eax
+  801f5f:	83 e8 57             	sub    $0x57,%eax
+  801f62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f65:	eb 26                	jmp    801f8d <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801f67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f6b:	0f b6 00             	movzbl (%rax),%eax
+  801f6e:	3c 40                	cmp    $0x40,%al
+  801f70:	7e 47                	jle    801fb9 <strtol+0x16a>
+  801f72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f76:	0f b6 00             	movzbl (%rax),%eax
+  801f79:	3c 5a                	cmp    $0x5a,%al
+  801f7b:	7f 3c                	jg     801fb9 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801f7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f81:	0f b6 00             	movzbl (%rax),%eax
+  801f84:	0f be c0             	movsbl %al,%eax
+  801f87:	83 e8 37             	sub    $0x37,%eax
+  801f8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801f8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f90:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801f93:	7d 23                	jge    801fb8 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801f95:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f9a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801f9d:	48 98                	cltq
+  801f9f:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801fa4:	48 89 c2             	mov    %rax,%rdx
+  801fa7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801faa:	48 98                	cltq
+  801fac:	48 01 d0             	add    %rdx,%rax
+  801faf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801fb3:	e9 5f ff ff ff       	jmp    801f17 <strtol+0xc8>
+      break;
+  801fb8:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801fb9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801fbe:	74 0b                	je     801fcb <strtol+0x17c>
+    *endptr = (char *)s;
+  801fc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fc4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fc8:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801fcb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801fcf:	74 09                	je     801fda <strtol+0x18b>
+  801fd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fd5:	48 f7 d8             	neg    %rax
+  801fd8:	eb 04                	jmp    801fde <strtol+0x18f>
+  801fda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	53                   	push   %rbx
+  801fe5:	48 83 ec 48          	sub    $0x48,%rsp
+  801fe9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801fed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ff1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ff5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801ff9:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801ffd:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802001:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802005:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802009:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80200d:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802011:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802015:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802019:	4c 89 c3             	mov    %r8,%rbx
+  80201c:	cd 30                	int    $0x30
+  80201e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802022:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802027:	74 46                	je     80206f <syscall+0x8f>
+  802029:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80202e:	7e 3f                	jle    80206f <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802030:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802034:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802038:	49 89 d0             	mov    %rdx,%r8
+  80203b:	48 89 c1             	mov    %rax,%rcx
+  80203e:	48 b8 88 5a 80 00 00 	movabs $0x805a88,%rax
+  802045:	00 00 00 
+  802048:	48 89 c2             	mov    %rax,%rdx
+  80204b:	be 22 00 00 00       	mov    $0x22,%esi
+  802050:	48 b8 a7 5a 80 00 00 	movabs $0x805aa7,%rax
+  802057:	00 00 00 
+  80205a:	48 89 c7             	mov    %rax,%rdi
+  80205d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802062:	49 b9 f3 02 80 00 00 	movabs $0x8002f3,%r9
+  802069:	00 00 00 
+  80206c:	41 ff d1             	call   *%r9
+
+  return ret;
+  80206f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802073:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+
+0000000000802079 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802079:	55                   	push   %rbp
+  80207a:	48 89 e5             	mov    %rsp,%rbp
+  80207d:	48 83 ec 10          	sub    $0x10,%rsp
+  802081:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802085:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802089:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80208d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802091:	48 83 ec 08          	sub    $0x8,%rsp
+  802095:	6a 00                	push   $0x0
+  802097:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80209d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020a3:	48 89 d1             	mov    %rdx,%rcx
+  8020a6:	48 89 c2             	mov    %rax,%rdx
+  8020a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b3:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+  8020bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c3:	90                   	nop
+  8020c4:	c9                   	leave
+  8020c5:	c3                   	ret
+
+00000000008020c6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8020c6:	55                   	push   %rbp
+  8020c7:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ce:	6a 00                	push   $0x0
+  8020d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020eb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020f0:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+  8020fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802100:	c9                   	leave
+  802101:	c3                   	ret
+
+0000000000802102 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+  802106:	48 83 ec 10          	sub    $0x10,%rsp
+  80210a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80210d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802110:	48 98                	cltq
+  802112:	48 83 ec 08          	sub    $0x8,%rsp
+  802116:	6a 00                	push   $0x0
+  802118:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80211e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802124:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802129:	48 89 c2             	mov    %rax,%rdx
+  80212c:	be 01 00 00 00       	mov    $0x1,%esi
+  802131:	bf 03 00 00 00       	mov    $0x3,%edi
+  802136:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80213d:	00 00 00 
+  802140:	ff d0                	call   *%rax
+  802142:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+
+0000000000802148 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	48 83 ec 10          	sub    $0x10,%rsp
+  802150:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802153:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802156:	48 98                	cltq
+  802158:	48 83 ec 08          	sub    $0x8,%rsp
+  80215c:	6a 00                	push   $0x0
+  80215e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216f:	48 89 c2             	mov    %rax,%rdx
+  802172:	be 00 00 00 00       	mov    $0x0,%esi
+  802177:	bf 04 00 00 00       	mov    $0x4,%edi
+  80217c:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218c:	90                   	nop
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+000000000080218f <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80218f:	55                   	push   %rbp
+  802190:	48 89 e5             	mov    %rsp,%rbp
+  802193:	48 83 ec 20          	sub    $0x20,%rsp
+  802197:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80219a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80219e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021a1:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8021a4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021a9:	cd 30                	int    $0x30
+  8021ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8021af:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8021b3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8021b8:	7e 3d                	jle    8021f7 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8021ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021be:	49 89 c0             	mov    %rax,%r8
+  8021c1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8021c6:	48 b8 88 5a 80 00 00 	movabs $0x805a88,%rax
+  8021cd:	00 00 00 
+  8021d0:	48 89 c2             	mov    %rax,%rdx
+  8021d3:	be 49 00 00 00       	mov    $0x49,%esi
+  8021d8:	48 b8 a7 5a 80 00 00 	movabs $0x805aa7,%rax
+  8021df:	00 00 00 
+  8021e2:	48 89 c7             	mov    %rax,%rdi
+  8021e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ea:	49 b9 f3 02 80 00 00 	movabs $0x8002f3,%r9
+  8021f1:	00 00 00 
+  8021f4:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8021f7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8021fc:	75 13                	jne    802211 <sys_env_wait+0x82>
+  8021fe:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802203:	74 0c                	je     802211 <sys_env_wait+0x82>
+    *status = st;
+  802205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802209:	89 c2                	mov    %eax,%edx
+  80220b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80220f:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802215:	c9                   	leave
+  802216:	c3                   	ret
+
+0000000000802217 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80221b:	48 83 ec 08          	sub    $0x8,%rsp
+  80221f:	6a 00                	push   $0x0
+  802221:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802227:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802232:	ba 00 00 00 00       	mov    $0x0,%edx
+  802237:	be 00 00 00 00       	mov    $0x0,%esi
+  80223c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802241:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+  80224d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+0000000000802253 <sys_yield>:
+
+void
+sys_yield(void) {
+  802253:	55                   	push   %rbp
+  802254:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802257:	48 83 ec 08          	sub    $0x8,%rsp
+  80225b:	6a 00                	push   $0x0
+  80225d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802269:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80226e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802273:	be 00 00 00 00       	mov    $0x0,%esi
+  802278:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80227d:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802284:	00 00 00 
+  802287:	ff d0                	call   *%rax
+  802289:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228d:	90                   	nop
+  80228e:	c9                   	leave
+  80228f:	c3                   	ret
+
+0000000000802290 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802290:	55                   	push   %rbp
+  802291:	48 89 e5             	mov    %rsp,%rbp
+  802294:	48 83 ec 20          	sub    $0x20,%rsp
+  802298:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80229b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80229f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8022a2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022a5:	48 63 c8             	movslq %eax,%rcx
+  8022a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8022ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022af:	48 98                	cltq
+  8022b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b5:	6a 00                	push   $0x0
+  8022b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022bd:	49 89 c8             	mov    %rcx,%r8
+  8022c0:	48 89 d1             	mov    %rdx,%rcx
+  8022c3:	48 89 c2             	mov    %rax,%rdx
+  8022c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022d0:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+  8022e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8022e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022e6:	c9                   	leave
+  8022e7:	c3                   	ret
+
+00000000008022e8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8022e8:	55                   	push   %rbp
+  8022e9:	48 89 e5             	mov    %rsp,%rbp
+  8022ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8022f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8022fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022fe:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802302:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802305:	48 63 c8             	movslq %eax,%rcx
+  802308:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80230c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80230f:	48 63 f0             	movslq %eax,%rsi
+  802312:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802316:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802319:	48 98                	cltq
+  80231b:	48 83 ec 08          	sub    $0x8,%rsp
+  80231f:	51                   	push   %rcx
+  802320:	49 89 f9             	mov    %rdi,%r9
+  802323:	49 89 f0             	mov    %rsi,%r8
+  802326:	48 89 d1             	mov    %rdx,%rcx
+  802329:	48 89 c2             	mov    %rax,%rdx
+  80232c:	be 01 00 00 00       	mov    $0x1,%esi
+  802331:	bf 07 00 00 00       	mov    $0x7,%edi
+  802336:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+  802342:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+
+0000000000802348 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802348:	55                   	push   %rbp
+  802349:	48 89 e5             	mov    %rsp,%rbp
+  80234c:	48 83 ec 10          	sub    $0x10,%rsp
+  802350:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802353:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802357:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80235b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80235e:	48 98                	cltq
+  802360:	48 83 ec 08          	sub    $0x8,%rsp
+  802364:	6a 00                	push   $0x0
+  802366:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80236c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802372:	48 89 d1             	mov    %rdx,%rcx
+  802375:	48 89 c2             	mov    %rax,%rdx
+  802378:	be 01 00 00 00       	mov    $0x1,%esi
+  80237d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802382:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802389:	00 00 00 
+  80238c:	ff d0                	call   *%rax
+  80238e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+
+0000000000802394 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	48 83 ec 10          	sub    $0x10,%rsp
+  80239c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80239f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8023a2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023a5:	48 63 d0             	movslq %eax,%rdx
+  8023a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023ab:	48 98                	cltq
+  8023ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b1:	6a 00                	push   $0x0
+  8023b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023bf:	48 89 d1             	mov    %rdx,%rcx
+  8023c2:	48 89 c2             	mov    %rax,%rdx
+  8023c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8023cf:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+00000000008023e1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8023f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023f7:	48 98                	cltq
+  8023f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fd:	6a 00                	push   $0x0
+  8023ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80240b:	48 89 d1             	mov    %rdx,%rcx
+  80240e:	48 89 c2             	mov    %rax,%rdx
+  802411:	be 01 00 00 00       	mov    $0x1,%esi
+  802416:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80241b:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+  802427:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80242b:	c9                   	leave
+  80242c:	c3                   	ret
+
+000000000080242d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80242d:	55                   	push   %rbp
+  80242e:	48 89 e5             	mov    %rsp,%rbp
+  802431:	48 83 ec 10          	sub    $0x10,%rsp
+  802435:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802438:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80243c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802440:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802443:	48 98                	cltq
+  802445:	48 83 ec 08          	sub    $0x8,%rsp
+  802449:	6a 00                	push   $0x0
+  80244b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802451:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802457:	48 89 d1             	mov    %rdx,%rcx
+  80245a:	48 89 c2             	mov    %rax,%rdx
+  80245d:	be 01 00 00 00       	mov    $0x1,%esi
+  802462:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802467:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+  802473:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+0000000000802479 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802479:	55                   	push   %rbp
+  80247a:	48 89 e5             	mov    %rsp,%rbp
+  80247d:	48 83 ec 20          	sub    $0x20,%rsp
+  802481:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802484:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802488:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80248c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80248f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802492:	48 63 f0             	movslq %eax,%rsi
+  802495:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802499:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80249d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024a0:	48 98                	cltq
+  8024a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a6:	6a 00                	push   $0x0
+  8024a8:	49 89 f1             	mov    %rsi,%r9
+  8024ab:	49 89 c8             	mov    %rcx,%r8
+  8024ae:	48 89 d1             	mov    %rdx,%rcx
+  8024b1:	48 89 c2             	mov    %rax,%rdx
+  8024b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b9:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8024be:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+00000000008024d0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8024d0:	55                   	push   %rbp
+  8024d1:	48 89 e5             	mov    %rsp,%rbp
+  8024d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8024dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e4:	6a 00                	push   $0x0
+  8024e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f7:	48 89 c2             	mov    %rax,%rdx
+  8024fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ff:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802504:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+  802510:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802514:	c9                   	leave
+  802515:	c3                   	ret
+
+0000000000802516 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	48 83 ec 10          	sub    $0x10,%rsp
+  80251e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802522:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802526:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80252a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80252e:	48 83 ec 08          	sub    $0x8,%rsp
+  802532:	6a 00                	push   $0x0
+  802534:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80253a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802540:	48 89 d1             	mov    %rdx,%rcx
+  802543:	48 89 c2             	mov    %rax,%rdx
+  802546:	be 01 00 00 00       	mov    $0x1,%esi
+  80254b:	bf 10 00 00 00       	mov    $0x10,%edi
+  802550:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+  80255c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802560:	c9                   	leave
+  802561:	c3                   	ret
+
+0000000000802562 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802566:	48 83 ec 08          	sub    $0x8,%rsp
+  80256a:	6a 00                	push   $0x0
+  80256c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802582:	be 00 00 00 00       	mov    $0x0,%esi
+  802587:	bf 11 00 00 00       	mov    $0x11,%edi
+  80258c:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802593:	00 00 00 
+  802596:	ff d0                	call   *%rax
+  802598:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+000000000080259e <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8025ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ba:	6a 00                	push   $0x0
+  8025bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c8:	48 89 d1             	mov    %rdx,%rcx
+  8025cb:	48 89 c2             	mov    %rax,%rdx
+  8025ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d3:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025d8:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8025df:	00 00 00 
+  8025e2:	ff d0                	call   *%rax
+  8025e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e8:	c9                   	leave
+  8025e9:	c3                   	ret
+
+00000000008025ea <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8025ea:	55                   	push   %rbp
+  8025eb:	48 89 e5             	mov    %rsp,%rbp
+  8025ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025fa:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8025fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802600:	48 63 c8             	movslq %eax,%rcx
+  802603:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260b:	48 83 ec 08          	sub    $0x8,%rsp
+  80260f:	6a 00                	push   $0x0
+  802611:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802617:	49 89 c8             	mov    %rcx,%r8
+  80261a:	48 89 d1             	mov    %rdx,%rcx
+  80261d:	48 89 c2             	mov    %rax,%rdx
+  802620:	be 00 00 00 00       	mov    $0x0,%esi
+  802625:	bf 13 00 00 00       	mov    $0x13,%edi
+  80262a:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802631:	00 00 00 
+  802634:	ff d0                	call   *%rax
+  802636:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+000000000080263c <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	48 83 ec 20          	sub    $0x20,%rsp
+  802644:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802648:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80264b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80264f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802653:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802656:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80265a:	48 83 ec 08          	sub    $0x8,%rsp
+  80265e:	6a 00                	push   $0x0
+  802660:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802666:	49 89 c8             	mov    %rcx,%r8
+  802669:	48 89 d1             	mov    %rdx,%rcx
+  80266c:	48 89 c2             	mov    %rax,%rdx
+  80266f:	be 00 00 00 00       	mov    $0x0,%esi
+  802674:	bf 14 00 00 00       	mov    $0x14,%edi
+  802679:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802680:	00 00 00 
+  802683:	ff d0                	call   *%rax
+  802685:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+000000000080268b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	48 83 ec 10          	sub    $0x10,%rsp
+  802693:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802697:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  80269a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80269d:	48 63 d0             	movslq %eax,%rdx
+  8026a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a8:	6a 00                	push   $0x0
+  8026aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b6:	48 89 d1             	mov    %rdx,%rcx
+  8026b9:	48 89 c2             	mov    %rax,%rdx
+  8026bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c1:	bf 15 00 00 00       	mov    $0x15,%edi
+  8026c6:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+  8026d2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+00000000008026d8 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8026e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8026e7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8026ea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8026ee:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8026f2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8026f5:	48 63 c8             	movslq %eax,%rcx
+  8026f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8026fb:	48 63 d0             	movslq %eax,%rdx
+  8026fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802702:	48 83 ec 08          	sub    $0x8,%rsp
+  802706:	6a 00                	push   $0x0
+  802708:	49 89 f1             	mov    %rsi,%r9
+  80270b:	49 89 c8             	mov    %rcx,%r8
+  80270e:	48 89 d1             	mov    %rdx,%rcx
+  802711:	48 89 c2             	mov    %rax,%rdx
+  802714:	be 00 00 00 00       	mov    $0x0,%esi
+  802719:	bf 16 00 00 00       	mov    $0x16,%edi
+  80271e:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802725:	00 00 00 
+  802728:	ff d0                	call   *%rax
+  80272a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272e:	c9                   	leave
+  80272f:	c3                   	ret
+
+0000000000802730 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	48 83 ec 30          	sub    $0x30,%rsp
+  802738:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80273c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802740:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802744:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802748:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80274c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802750:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802754:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802758:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80275c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802760:	48 83 ec 08          	sub    $0x8,%rsp
+  802764:	51                   	push   %rcx
+  802765:	49 89 f9             	mov    %rdi,%r9
+  802768:	49 89 f0             	mov    %rsi,%r8
+  80276b:	48 89 d1             	mov    %rdx,%rcx
+  80276e:	48 89 c2             	mov    %rax,%rdx
+  802771:	be 00 00 00 00       	mov    $0x0,%esi
+  802776:	bf 17 00 00 00       	mov    $0x17,%edi
+  80277b:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+  802787:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278b:	c9                   	leave
+  80278c:	c3                   	ret
+
+000000000080278d <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80278d:	55                   	push   %rbp
+  80278e:	48 89 e5             	mov    %rsp,%rbp
+  802791:	48 83 ec 10          	sub    $0x10,%rsp
+  802795:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802798:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80279b:	48 98                	cltq
+  80279d:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b4:	48 89 c2             	mov    %rax,%rdx
+  8027b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bc:	bf 18 00 00 00       	mov    $0x18,%edi
+  8027c1:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8027c8:	00 00 00 
+  8027cb:	ff d0                	call   *%rax
+  8027cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d1:	90                   	nop
+  8027d2:	c9                   	leave
+  8027d3:	c3                   	ret
+
+00000000008027d4 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8027d4:	55                   	push   %rbp
+  8027d5:	48 89 e5             	mov    %rsp,%rbp
+  8027d8:	48 83 ec 30          	sub    $0x30,%rsp
+  8027dc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027e3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8027e7:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8027ea:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8027ed:	48 63 f0             	movslq %eax,%rsi
+  8027f0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8027f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8027f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027fb:	48 98                	cltq
+  8027fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802801:	6a 00                	push   $0x0
+  802803:	49 89 f1             	mov    %rsi,%r9
+  802806:	49 89 c8             	mov    %rcx,%r8
+  802809:	48 89 d1             	mov    %rdx,%rcx
+  80280c:	48 89 c2             	mov    %rax,%rdx
+  80280f:	be 01 00 00 00       	mov    $0x1,%esi
+  802814:	bf 19 00 00 00       	mov    $0x19,%edi
+  802819:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+  802825:	48 83 c4 10          	add    $0x10,%rsp
+  802829:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80282c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80282f:	c9                   	leave
+  802830:	c3                   	ret
+
+0000000000802831 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802831:	55                   	push   %rbp
+  802832:	48 89 e5             	mov    %rsp,%rbp
+  802835:	48 83 ec 20          	sub    $0x20,%rsp
+  802839:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80283d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802841:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802844:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802847:	48 63 c8             	movslq %eax,%rcx
+  80284a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80284e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802852:	48 83 ec 08          	sub    $0x8,%rsp
+  802856:	6a 00                	push   $0x0
+  802858:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80285e:	49 89 c8             	mov    %rcx,%r8
+  802861:	48 89 d1             	mov    %rdx,%rcx
+  802864:	48 89 c2             	mov    %rax,%rdx
+  802867:	be 01 00 00 00       	mov    $0x1,%esi
+  80286c:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802871:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+  80287d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802881:	c9                   	leave
+  802882:	c3                   	ret
+
+0000000000802883 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802883:	55                   	push   %rbp
+  802884:	48 89 e5             	mov    %rsp,%rbp
+  802887:	48 83 ec 20          	sub    $0x20,%rsp
+  80288b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80288f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802893:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802897:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80289b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80289f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a7:	6a 00                	push   $0x0
+  8028a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028af:	49 89 c8             	mov    %rcx,%r8
+  8028b2:	48 89 d1             	mov    %rdx,%rcx
+  8028b5:	48 89 c2             	mov    %rax,%rdx
+  8028b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028bd:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8028c2:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  8028c9:	00 00 00 
+  8028cc:	ff d0                	call   *%rax
+  8028ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d2:	c9                   	leave
+  8028d3:	c3                   	ret
+
+00000000008028d4 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8028d4:	55                   	push   %rbp
+  8028d5:	48 89 e5             	mov    %rsp,%rbp
+  8028d8:	48 83 ec 30          	sub    $0x30,%rsp
+  8028dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028e4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8028e7:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8028eb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8028f2:	48 63 c8             	movslq %eax,%rcx
+  8028f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8028f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802901:	6a 00                	push   $0x0
+  802903:	49 89 f1             	mov    %rsi,%r9
+  802906:	49 89 c8             	mov    %rcx,%r8
+  802909:	48 89 d1             	mov    %rdx,%rcx
+  80290c:	48 89 c2             	mov    %rax,%rdx
+  80290f:	be 01 00 00 00       	mov    $0x1,%esi
+  802914:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802919:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  802920:	00 00 00 
+  802923:	ff d0                	call   *%rax
+  802925:	48 83 c4 10          	add    $0x10,%rsp
+  802929:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80292c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+
+0000000000802931 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802931:	55                   	push   %rbp
+  802932:	48 89 e5             	mov    %rsp,%rbp
+  802935:	48 83 ec 10          	sub    $0x10,%rsp
+  802939:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80293c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80293f:	48 98                	cltq
+  802941:	48 83 ec 08          	sub    $0x8,%rsp
+  802945:	6a 00                	push   $0x0
+  802947:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80294d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802953:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802958:	48 89 c2             	mov    %rax,%rdx
+  80295b:	be 01 00 00 00       	mov    $0x1,%esi
+  802960:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802965:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+  802971:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+0000000000802977 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802977:	55                   	push   %rbp
+  802978:	48 89 e5             	mov    %rsp,%rbp
+  80297b:	48 83 ec 08          	sub    $0x8,%rsp
+  80297f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802987:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80298e:	ff ff ff 
+  802991:	48 01 d0             	add    %rdx,%rax
+  802994:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+000000000080299a <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  80299a:	55                   	push   %rbp
+  80299b:	48 89 e5             	mov    %rsp,%rbp
+  80299e:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8029a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029aa:	48 89 c7             	mov    %rax,%rdi
+  8029ad:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  8029b4:	00 00 00 
+  8029b7:	ff d0                	call   *%rax
+  8029b9:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8029bf:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+
+00000000008029c5 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+  8029c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8029cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8029d1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029d8:	e9 ae 00 00 00       	jmp    802a8b <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8029dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029e0:	c1 e0 0c             	shl    $0xc,%eax
+  8029e3:	48 98                	cltq
+  8029e5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8029ea:	48 01 d0             	add    %rdx,%rax
+  8029ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8029f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029f5:	48 c1 e8 27          	shr    $0x27,%rax
+  8029f9:	48 89 c2             	mov    %rax,%rdx
+  8029fc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a03:	01 00 00 
+  802a06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a0a:	83 e0 01             	and    $0x1,%eax
+  802a0d:	48 85 c0             	test   %rax,%rax
+  802a10:	74 63                	je     802a75 <fd_alloc+0xb0>
+  802a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a16:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a1a:	48 89 c2             	mov    %rax,%rdx
+  802a1d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802a24:	01 00 00 
+  802a27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a2b:	83 e0 01             	and    $0x1,%eax
+  802a2e:	48 85 c0             	test   %rax,%rax
+  802a31:	74 42                	je     802a75 <fd_alloc+0xb0>
+  802a33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a37:	48 c1 e8 15          	shr    $0x15,%rax
+  802a3b:	48 89 c2             	mov    %rax,%rdx
+  802a3e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802a45:	01 00 00 
+  802a48:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a4c:	83 e0 01             	and    $0x1,%eax
+  802a4f:	48 85 c0             	test   %rax,%rax
+  802a52:	74 21                	je     802a75 <fd_alloc+0xb0>
+  802a54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a58:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a5c:	48 89 c2             	mov    %rax,%rdx
+  802a5f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a66:	01 00 00 
+  802a69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a6d:	83 e0 01             	and    $0x1,%eax
+  802a70:	48 85 c0             	test   %rax,%rax
+  802a73:	75 12                	jne    802a87 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802a75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a7d:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a85:	eb 1e                	jmp    802aa5 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802a87:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a8b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a8f:	0f 8e 48 ff ff ff    	jle    8029dd <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802a95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a99:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802aa0:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802aa5:	c9                   	leave
+  802aa6:	c3                   	ret
+
+0000000000802aa7 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802aa7:	55                   	push   %rbp
+  802aa8:	48 89 e5             	mov    %rsp,%rbp
+  802aab:	48 83 ec 20          	sub    $0x20,%rsp
+  802aaf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ab2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802ab6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802aba:	78 06                	js     802ac2 <fd_lookup+0x1b>
+  802abc:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ac0:	7e 0a                	jle    802acc <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802ac2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac7:	e9 af 00 00 00       	jmp    802b7b <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802acc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802acf:	c1 e0 0c             	shl    $0xc,%eax
+  802ad2:	48 98                	cltq
+  802ad4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ad9:	48 01 d0             	add    %rdx,%rax
+  802adc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802ae0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ae4:	48 c1 e8 27          	shr    $0x27,%rax
+  802ae8:	48 89 c2             	mov    %rax,%rdx
+  802aeb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802af2:	01 00 00 
+  802af5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802af9:	83 e0 01             	and    $0x1,%eax
+  802afc:	48 85 c0             	test   %rax,%rax
+  802aff:	74 63                	je     802b64 <fd_lookup+0xbd>
+  802b01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b05:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b09:	48 89 c2             	mov    %rax,%rdx
+  802b0c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b13:	01 00 00 
+  802b16:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b1a:	83 e0 01             	and    $0x1,%eax
+  802b1d:	48 85 c0             	test   %rax,%rax
+  802b20:	74 42                	je     802b64 <fd_lookup+0xbd>
+  802b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b26:	48 c1 e8 15          	shr    $0x15,%rax
+  802b2a:	48 89 c2             	mov    %rax,%rdx
+  802b2d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b34:	01 00 00 
+  802b37:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b3b:	83 e0 01             	and    $0x1,%eax
+  802b3e:	48 85 c0             	test   %rax,%rax
+  802b41:	74 21                	je     802b64 <fd_lookup+0xbd>
+  802b43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b47:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b4b:	48 89 c2             	mov    %rax,%rdx
+  802b4e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b55:	01 00 00 
+  802b58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b5c:	83 e0 01             	and    $0x1,%eax
+  802b5f:	48 85 c0             	test   %rax,%rax
+  802b62:	75 07                	jne    802b6b <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b69:	eb 10                	jmp    802b7b <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802b6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b6f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b73:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802b76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b7b:	c9                   	leave
+  802b7c:	c3                   	ret
+
+0000000000802b7d <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802b7d:	55                   	push   %rbp
+  802b7e:	48 89 e5             	mov    %rsp,%rbp
+  802b81:	48 83 ec 30          	sub    $0x30,%rsp
+  802b85:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802b89:	89 f0                	mov    %esi,%eax
+  802b8b:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802b8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b92:	48 89 c7             	mov    %rax,%rdi
+  802b95:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  802b9c:	00 00 00 
+  802b9f:	ff d0                	call   *%rax
+  802ba1:	89 c2                	mov    %eax,%edx
+  802ba3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802ba7:	48 89 c6             	mov    %rax,%rsi
+  802baa:	89 d7                	mov    %edx,%edi
+  802bac:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  802bb3:	00 00 00 
+  802bb6:	ff d0                	call   *%rax
+  802bb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bbf:	78 0a                	js     802bcb <fd_close+0x4e>
+  802bc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bc5:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802bc9:	74 12                	je     802bdd <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802bcb:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802bcf:	74 05                	je     802bd6 <fd_close+0x59>
+  802bd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bd4:	eb 70                	jmp    802c46 <fd_close+0xc9>
+  802bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdb:	eb 69                	jmp    802c46 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802bdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802be1:	8b 00                	mov    (%rax),%eax
+  802be3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802be7:	48 89 d6             	mov    %rdx,%rsi
+  802bea:	89 c7                	mov    %eax,%edi
+  802bec:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  802bf3:	00 00 00 
+  802bf6:	ff d0                	call   *%rax
+  802bf8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bfb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bff:	78 2a                	js     802c2b <fd_close+0xae>
+    if (dev->dev_close)
+  802c01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c05:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c09:	48 85 c0             	test   %rax,%rax
+  802c0c:	74 16                	je     802c24 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802c0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c12:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c1a:	48 89 c7             	mov    %rax,%rdi
+  802c1d:	ff d2                	call   *%rdx
+  802c1f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c22:	eb 07                	jmp    802c2b <fd_close+0xae>
+    else
+      r = 0;
+  802c24:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802c2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c2f:	48 89 c6             	mov    %rax,%rsi
+  802c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c37:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+  return r;
+  802c43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+0000000000802c48 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+  802c4c:	48 83 ec 20          	sub    $0x20,%rsp
+  802c50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c53:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802c57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802c5e:	eb 3f                	jmp    802c9f <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802c60:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c67:	00 00 00 
+  802c6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c6d:	48 98                	cltq
+  802c6f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c73:	8b 00                	mov    (%rax),%eax
+  802c75:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802c78:	75 21                	jne    802c9b <dev_lookup+0x53>
+      *dev = devtab[i];
+  802c7a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c81:	00 00 00 
+  802c84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c87:	48 98                	cltq
+  802c89:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c91:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c99:	eb 7f                	jmp    802d1a <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802c9b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c9f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ca6:	00 00 00 
+  802ca9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cac:	48 98                	cltq
+  802cae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cb2:	48 85 c0             	test   %rax,%rax
+  802cb5:	75 a9                	jne    802c60 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802cb7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802cbe:	00 00 00 
+  802cc1:	8b 40 04             	mov    0x4(%rax),%eax
+  802cc4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cc9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802cd0:	00 00 00 
+  802cd3:	48 98                	cltq
+  802cd5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802cdc:	48 01 d0             	add    %rdx,%rax
+  802cdf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802ce5:	8b 00                	mov    (%rax),%eax
+  802ce7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802cea:	89 c6                	mov    %eax,%esi
+  802cec:	48 b8 b8 5a 80 00 00 	movabs $0x805ab8,%rax
+  802cf3:	00 00 00 
+  802cf6:	48 89 c7             	mov    %rax,%rdi
+  802cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfe:	48 b9 12 05 80 00 00 	movabs $0x800512,%rcx
+  802d05:	00 00 00 
+  802d08:	ff d1                	call   *%rcx
+  *dev = 0;
+  802d0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d0e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802d15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d1a:	c9                   	leave
+  802d1b:	c3                   	ret
+
+0000000000802d1c <close>:
+
+int
+close(int fdnum) {
+  802d1c:	55                   	push   %rbp
+  802d1d:	48 89 e5             	mov    %rsp,%rbp
+  802d20:	48 83 ec 20          	sub    $0x20,%rsp
+  802d24:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d27:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d2e:	48 89 d6             	mov    %rdx,%rsi
+  802d31:	89 c7                	mov    %eax,%edi
+  802d33:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d46:	79 05                	jns    802d4d <close+0x31>
+    return r;
+  802d48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d4b:	eb 18                	jmp    802d65 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d51:	be 01 00 00 00       	mov    $0x1,%esi
+  802d56:	48 89 c7             	mov    %rax,%rdi
+  802d59:	48 b8 7d 2b 80 00 00 	movabs $0x802b7d,%rax
+  802d60:	00 00 00 
+  802d63:	ff d0                	call   *%rax
+}
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+
+0000000000802d67 <close_all>:
+
+void
+close_all(void) {
+  802d67:	55                   	push   %rbp
+  802d68:	48 89 e5             	mov    %rsp,%rbp
+  802d6b:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802d6f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d76:	eb 15                	jmp    802d8d <close_all+0x26>
+    close(i);
+  802d78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d7b:	89 c7                	mov    %eax,%edi
+  802d7d:	48 b8 1c 2d 80 00 00 	movabs $0x802d1c,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802d89:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d8d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802d91:	7e e5                	jle    802d78 <close_all+0x11>
+}
+  802d93:	90                   	nop
+  802d94:	90                   	nop
+  802d95:	c9                   	leave
+  802d96:	c3                   	ret
+
+0000000000802d97 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802d97:	55                   	push   %rbp
+  802d98:	48 89 e5             	mov    %rsp,%rbp
+  802d9b:	48 83 ec 40          	sub    $0x40,%rsp
+  802d9f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802da2:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802da5:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802da9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802dac:	48 89 d6             	mov    %rdx,%rsi
+  802daf:	89 c7                	mov    %eax,%edi
+  802db1:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+  802dbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dc4:	79 08                	jns    802dce <dup+0x37>
+    return r;
+  802dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dc9:	e9 33 02 00 00       	jmp    803001 <dup+0x26a>
+  close(newfdnum);
+  802dce:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802dd1:	89 c7                	mov    %eax,%edi
+  802dd3:	48 b8 1c 2d 80 00 00 	movabs $0x802d1c,%rax
+  802dda:	00 00 00 
+  802ddd:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802ddf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802de2:	c1 e0 0c             	shl    $0xc,%eax
+  802de5:	48 98                	cltq
+  802de7:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802dec:	48 01 d0             	add    %rdx,%rax
+  802def:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802df3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802df7:	48 89 c7             	mov    %rax,%rdi
+  802dfa:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  802e01:	00 00 00 
+  802e04:	ff d0                	call   *%rax
+  802e06:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802e0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e0e:	48 89 c7             	mov    %rax,%rdi
+  802e11:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+  802e1d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802e21:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802e28:	00 
+  802e29:	e9 19 01 00 00       	jmp    802f47 <dup+0x1b0>
+    off -= PGSIZE;
+  802e2e:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802e35:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802e36:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e3e:	48 01 d0             	add    %rdx,%rax
+  802e41:	48 c1 e8 27          	shr    $0x27,%rax
+  802e45:	48 89 c2             	mov    %rax,%rdx
+  802e48:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802e4f:	01 00 00 
+  802e52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e56:	83 e0 01             	and    $0x1,%eax
+  802e59:	48 85 c0             	test   %rax,%rax
+  802e5c:	0f 84 e5 00 00 00    	je     802f47 <dup+0x1b0>
+  802e62:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e6a:	48 01 d0             	add    %rdx,%rax
+  802e6d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e71:	48 89 c2             	mov    %rax,%rdx
+  802e74:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802e7b:	01 00 00 
+  802e7e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e82:	83 e0 01             	and    $0x1,%eax
+  802e85:	48 85 c0             	test   %rax,%rax
+  802e88:	0f 84 b9 00 00 00    	je     802f47 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802e8e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e96:	48 01 d0             	add    %rdx,%rax
+  802e99:	48 c1 e8 15          	shr    $0x15,%rax
+  802e9d:	48 89 c2             	mov    %rax,%rdx
+  802ea0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ea7:	01 00 00 
+  802eaa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eae:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802eb1:	48 85 c0             	test   %rax,%rax
+  802eb4:	0f 84 8d 00 00 00    	je     802f47 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802eba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ebe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ec2:	48 01 d0             	add    %rdx,%rax
+  802ec5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ec9:	48 89 c2             	mov    %rax,%rdx
+  802ecc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ed3:	01 00 00 
+  802ed6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eda:	83 e0 01             	and    $0x1,%eax
+  802edd:	48 85 c0             	test   %rax,%rax
+  802ee0:	74 65                	je     802f47 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802ee2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ee6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eea:	48 01 d0             	add    %rdx,%rax
+  802eed:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef1:	48 89 c2             	mov    %rax,%rdx
+  802ef4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802efb:	01 00 00 
+  802efe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f02:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f07:	89 c6                	mov    %eax,%esi
+  802f09:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f11:	48 01 c2             	add    %rax,%rdx
+  802f14:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f1c:	48 01 c8             	add    %rcx,%rax
+  802f1f:	41 89 f0             	mov    %esi,%r8d
+  802f22:	48 89 d1             	mov    %rdx,%rcx
+  802f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2a:	48 89 c6             	mov    %rax,%rsi
+  802f2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f32:	48 b8 e8 22 80 00 00 	movabs $0x8022e8,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f45:	78 60                	js     802fa7 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802f47:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802f4c:	0f 85 dc fe ff ff    	jne    802e2e <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f56:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f5a:	48 89 c2             	mov    %rax,%rdx
+  802f5d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f64:	01 00 00 
+  802f67:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f6b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f70:	89 c1                	mov    %eax,%ecx
+  802f72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f7a:	41 89 c8             	mov    %ecx,%r8d
+  802f7d:	48 89 d1             	mov    %rdx,%rcx
+  802f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f85:	48 89 c6             	mov    %rax,%rsi
+  802f88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8d:	48 b8 e8 22 80 00 00 	movabs $0x8022e8,%rax
+  802f94:	00 00 00 
+  802f97:	ff d0                	call   *%rax
+  802f99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f9c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fa0:	78 08                	js     802faa <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802fa2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802fa5:	eb 5a                	jmp    803001 <dup+0x26a>
+        goto err;
+  802fa7:	90                   	nop
+  802fa8:	eb 01                	jmp    802fab <dup+0x214>
+    goto err;
+  802faa:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802fab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802faf:	48 89 c6             	mov    %rax,%rsi
+  802fb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb7:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802fc3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802fca:	00 
+  802fcb:	eb 27                	jmp    802ff4 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802fcd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd5:	48 01 d0             	add    %rdx,%rax
+  802fd8:	48 89 c6             	mov    %rax,%rsi
+  802fdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe0:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802fec:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802ff3:	00 
+  802ff4:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802ffb:	00 
+  802ffc:	76 cf                	jbe    802fcd <dup+0x236>
+  return r;
+  802ffe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803001:	c9                   	leave
+  803002:	c3                   	ret
+
+0000000000803003 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803003:	55                   	push   %rbp
+  803004:	48 89 e5             	mov    %rsp,%rbp
+  803007:	48 83 ec 40          	sub    $0x40,%rsp
+  80300b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80300e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803012:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803016:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80301a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80301d:	48 89 d6             	mov    %rdx,%rsi
+  803020:	89 c7                	mov    %eax,%edi
+  803022:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+  80302e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803031:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803035:	78 24                	js     80305b <read+0x58>
+  803037:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303b:	8b 00                	mov    (%rax),%eax
+  80303d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803041:	48 89 d6             	mov    %rdx,%rsi
+  803044:	89 c7                	mov    %eax,%edi
+  803046:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803055:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803059:	79 0a                	jns    803065 <read+0x62>
+    return r;
+  80305b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80305e:	48 98                	cltq
+  803060:	e9 9e 00 00 00       	jmp    803103 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803065:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803069:	8b 40 08             	mov    0x8(%rax),%eax
+  80306c:	83 e0 03             	and    $0x3,%eax
+  80306f:	83 f8 01             	cmp    $0x1,%eax
+  803072:	75 5c                	jne    8030d0 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803074:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80307b:	00 00 00 
+  80307e:	8b 40 04             	mov    0x4(%rax),%eax
+  803081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803086:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80308d:	00 00 00 
+  803090:	48 98                	cltq
+  803092:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803099:	48 01 d0             	add    %rdx,%rax
+  80309c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8030a2:	8b 00                	mov    (%rax),%eax
+  8030a4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030a7:	89 c6                	mov    %eax,%esi
+  8030a9:	48 b8 d7 5a 80 00 00 	movabs $0x805ad7,%rax
+  8030b0:	00 00 00 
+  8030b3:	48 89 c7             	mov    %rax,%rdi
+  8030b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bb:	48 b9 12 05 80 00 00 	movabs $0x800512,%rcx
+  8030c2:	00 00 00 
+  8030c5:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8030c7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8030ce:	eb 33                	jmp    803103 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8030d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030d8:	48 85 c0             	test   %rax,%rax
+  8030db:	75 09                	jne    8030e6 <read+0xe3>
+    return -E_NOT_SUPP;
+  8030dd:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8030e4:	eb 1d                	jmp    803103 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8030e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ea:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8030ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030f6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8030fa:	48 89 ce             	mov    %rcx,%rsi
+  8030fd:	48 89 c7             	mov    %rax,%rdi
+  803100:	41 ff d0             	call   *%r8
+}
+  803103:	c9                   	leave
+  803104:	c3                   	ret
+
+0000000000803105 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803105:	55                   	push   %rbp
+  803106:	48 89 e5             	mov    %rsp,%rbp
+  803109:	48 83 ec 30          	sub    $0x30,%rsp
+  80310d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803110:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803114:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803118:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80311f:	eb 49                	jmp    80316a <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803121:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803124:	48 98                	cltq
+  803126:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80312a:	48 29 c2             	sub    %rax,%rdx
+  80312d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803130:	48 63 c8             	movslq %eax,%rcx
+  803133:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803137:	48 01 c1             	add    %rax,%rcx
+  80313a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80313d:	48 89 ce             	mov    %rcx,%rsi
+  803140:	89 c7                	mov    %eax,%edi
+  803142:	48 b8 03 30 80 00 00 	movabs $0x803003,%rax
+  803149:	00 00 00 
+  80314c:	ff d0                	call   *%rax
+  80314e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803151:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803155:	79 07                	jns    80315e <readn+0x59>
+      return m;
+  803157:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80315a:	48 98                	cltq
+  80315c:	eb 1f                	jmp    80317d <readn+0x78>
+    if (m == 0)
+  80315e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803162:	74 13                	je     803177 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803164:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803167:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80316a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80316d:	48 98                	cltq
+  80316f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803173:	72 ac                	jb     803121 <readn+0x1c>
+  803175:	eb 01                	jmp    803178 <readn+0x73>
+      break;
+  803177:	90                   	nop
+  }
+  return tot;
+  803178:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80317b:	48 98                	cltq
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+000000000080317f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	48 83 ec 40          	sub    $0x40,%rsp
+  803187:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80318a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80318e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803192:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803196:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803199:	48 89 d6             	mov    %rdx,%rsi
+  80319c:	89 c7                	mov    %eax,%edi
+  80319e:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  8031a5:	00 00 00 
+  8031a8:	ff d0                	call   *%rax
+  8031aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031b1:	78 24                	js     8031d7 <write+0x58>
+  8031b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031b7:	8b 00                	mov    (%rax),%eax
+  8031b9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031bd:	48 89 d6             	mov    %rdx,%rsi
+  8031c0:	89 c7                	mov    %eax,%edi
+  8031c2:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  8031c9:	00 00 00 
+  8031cc:	ff d0                	call   *%rax
+  8031ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031d5:	79 0a                	jns    8031e1 <write+0x62>
+    return r;
+  8031d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031da:	48 98                	cltq
+  8031dc:	e9 9d 00 00 00       	jmp    80327e <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031e5:	8b 40 08             	mov    0x8(%rax),%eax
+  8031e8:	83 e0 03             	and    $0x3,%eax
+  8031eb:	85 c0                	test   %eax,%eax
+  8031ed:	75 5c                	jne    80324b <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031ef:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031f6:	00 00 00 
+  8031f9:	8b 40 04             	mov    0x4(%rax),%eax
+  8031fc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803201:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803208:	00 00 00 
+  80320b:	48 98                	cltq
+  80320d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803214:	48 01 d0             	add    %rdx,%rax
+  803217:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80321d:	8b 00                	mov    (%rax),%eax
+  80321f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803222:	89 c6                	mov    %eax,%esi
+  803224:	48 b8 f3 5a 80 00 00 	movabs $0x805af3,%rax
+  80322b:	00 00 00 
+  80322e:	48 89 c7             	mov    %rax,%rdi
+  803231:	b8 00 00 00 00       	mov    $0x0,%eax
+  803236:	48 b9 12 05 80 00 00 	movabs $0x800512,%rcx
+  80323d:	00 00 00 
+  803240:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803242:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803249:	eb 33                	jmp    80327e <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80324b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80324f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803253:	48 85 c0             	test   %rax,%rax
+  803256:	75 09                	jne    803261 <write+0xe2>
+    return -E_NOT_SUPP;
+  803258:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80325f:	eb 1d                	jmp    80327e <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803261:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803265:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803269:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80326d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803271:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803275:	48 89 ce             	mov    %rcx,%rsi
+  803278:	48 89 c7             	mov    %rax,%rdi
+  80327b:	41 ff d0             	call   *%r8
+}
+  80327e:	c9                   	leave
+  80327f:	c3                   	ret
+
+0000000000803280 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803280:	55                   	push   %rbp
+  803281:	48 89 e5             	mov    %rsp,%rbp
+  803284:	48 83 ec 18          	sub    $0x18,%rsp
+  803288:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80328b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80328e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803292:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803295:	48 89 d6             	mov    %rdx,%rsi
+  803298:	89 c7                	mov    %eax,%edi
+  80329a:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  8032a1:	00 00 00 
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032ad:	79 05                	jns    8032b4 <seek+0x34>
+    return r;
+  8032af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032b2:	eb 0f                	jmp    8032c3 <seek+0x43>
+  fd->fd_offset = offset;
+  8032b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8032bb:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8032be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c3:	c9                   	leave
+  8032c4:	c3                   	ret
+
+00000000008032c5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8032c5:	55                   	push   %rbp
+  8032c6:	48 89 e5             	mov    %rsp,%rbp
+  8032c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8032cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032d0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032d3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8032d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032da:	48 89 d6             	mov    %rdx,%rsi
+  8032dd:	89 c7                	mov    %eax,%edi
+  8032df:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  8032e6:	00 00 00 
+  8032e9:	ff d0                	call   *%rax
+  8032eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032f2:	78 24                	js     803318 <ftruncate+0x53>
+  8032f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f8:	8b 00                	mov    (%rax),%eax
+  8032fa:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032fe:	48 89 d6             	mov    %rdx,%rsi
+  803301:	89 c7                	mov    %eax,%edi
+  803303:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+  80330f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803312:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803316:	79 08                	jns    803320 <ftruncate+0x5b>
+    return r;
+  803318:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80331b:	e9 92 00 00 00       	jmp    8033b2 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803320:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803324:	8b 40 08             	mov    0x8(%rax),%eax
+  803327:	83 e0 03             	and    $0x3,%eax
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	75 5a                	jne    803388 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80332e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803335:	00 00 00 
+  803338:	8b 40 04             	mov    0x4(%rax),%eax
+  80333b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803340:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803347:	00 00 00 
+  80334a:	48 98                	cltq
+  80334c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803353:	48 01 d0             	add    %rdx,%rax
+  803356:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80335c:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80335e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803361:	89 c6                	mov    %eax,%esi
+  803363:	48 b8 10 5b 80 00 00 	movabs $0x805b10,%rax
+  80336a:	00 00 00 
+  80336d:	48 89 c7             	mov    %rax,%rdi
+  803370:	b8 00 00 00 00       	mov    $0x0,%eax
+  803375:	48 b9 12 05 80 00 00 	movabs $0x800512,%rcx
+  80337c:	00 00 00 
+  80337f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803381:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803386:	eb 2a                	jmp    8033b2 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803388:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80338c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803390:	48 85 c0             	test   %rax,%rax
+  803393:	75 07                	jne    80339c <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803395:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80339a:	eb 16                	jmp    8033b2 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80339c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033a0:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8033a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033a8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8033ab:	89 d6                	mov    %edx,%esi
+  8033ad:	48 89 c7             	mov    %rax,%rdi
+  8033b0:	ff d1                	call   *%rcx
+}
+  8033b2:	c9                   	leave
+  8033b3:	c3                   	ret
+
+00000000008033b4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033b4:	55                   	push   %rbp
+  8033b5:	48 89 e5             	mov    %rsp,%rbp
+  8033b8:	48 83 ec 30          	sub    $0x30,%rsp
+  8033bc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8033bf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033c3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8033c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033ca:	48 89 d6             	mov    %rdx,%rsi
+  8033cd:	89 c7                	mov    %eax,%edi
+  8033cf:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  8033d6:	00 00 00 
+  8033d9:	ff d0                	call   *%rax
+  8033db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033e2:	78 24                	js     803408 <fstat+0x54>
+  8033e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033e8:	8b 00                	mov    (%rax),%eax
+  8033ea:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033ee:	48 89 d6             	mov    %rdx,%rsi
+  8033f1:	89 c7                	mov    %eax,%edi
+  8033f3:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  8033fa:	00 00 00 
+  8033fd:	ff d0                	call   *%rax
+  8033ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803402:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803406:	79 05                	jns    80340d <fstat+0x59>
+    return r;
+  803408:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80340b:	eb 5e                	jmp    80346b <fstat+0xb7>
+  if (!dev->dev_stat)
+  80340d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803411:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803415:	48 85 c0             	test   %rax,%rax
+  803418:	75 07                	jne    803421 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80341a:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80341f:	eb 4a                	jmp    80346b <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803421:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803425:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803428:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80342c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803433:	00 00 00 
+  stat->st_isdir   = 0;
+  803436:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80343a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803441:	00 00 00 
+  stat->st_dev     = dev;
+  803444:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803448:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80344c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803453:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803457:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80345b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80345f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803463:	48 89 d6             	mov    %rdx,%rsi
+  803466:	48 89 c7             	mov    %rax,%rdi
+  803469:	ff d1                	call   *%rcx
+}
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+
+000000000080346d <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80346d:	55                   	push   %rbp
+  80346e:	48 89 e5             	mov    %rsp,%rbp
+  803471:	48 83 ec 10          	sub    $0x10,%rsp
+  803475:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803479:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80347d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803481:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803487:	83 f8 20             	cmp    $0x20,%eax
+  80348a:	75 07                	jne    803493 <pollwait_key+0x26>
+    return -E_INVAL;
+  80348c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803491:	eb 5f                	jmp    8034f2 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803493:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803497:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80349d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a1:	48 63 d2             	movslq %edx,%rdx
+  8034a4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034a8:	48 01 c2             	add    %rax,%rdx
+  8034ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034af:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8034b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b6:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8034bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034c0:	8b 00                	mov    (%rax),%eax
+  8034c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034c6:	48 63 c9             	movslq %ecx,%rcx
+  8034c9:	48 c1 e1 04          	shl    $0x4,%rcx
+  8034cd:	48 01 ca             	add    %rcx,%rdx
+  8034d0:	48 83 c2 08          	add    $0x8,%rdx
+  8034d4:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8034d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034da:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8034e0:	8d 50 01             	lea    0x1(%rax),%edx
+  8034e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e7:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8034ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f2:	c9                   	leave
+  8034f3:	c3                   	ret
+
+00000000008034f4 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8034f4:	55                   	push   %rbp
+  8034f5:	48 89 e5             	mov    %rsp,%rbp
+  8034f8:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8034ff:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803506:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80350c:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803513:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80351a:	00 
+  int i, r, ready, ipc = 0;
+  80351b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803522:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803529:	00 
+  80352a:	74 45                	je     803571 <poll+0x7d>
+  80352c:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803533:	ff 
+  803534:	74 3b                	je     803571 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803536:	48 b8 48 4d 80 00 00 	movabs $0x804d48,%rax
+  80353d:	00 00 00 
+  803540:	ff d0                	call   *%rax
+  803542:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803546:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80354a:	48 f7 d0             	not    %rax
+  80354d:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803554:	73 10                	jae    803566 <poll+0x72>
+  803556:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80355a:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803561:	48 01 d0             	add    %rdx,%rax
+  803564:	eb 07                	jmp    80356d <poll+0x79>
+  803566:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80356d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803571:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803578:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80357f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803586:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80358d:	e9 46 02 00 00       	jmp    8037d8 <poll+0x2e4>
+      fds[i].revents = 0;
+  803592:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803595:	48 63 d0             	movslq %eax,%rdx
+  803598:	48 89 d0             	mov    %rdx,%rax
+  80359b:	48 01 c0             	add    %rax,%rax
+  80359e:	48 01 d0             	add    %rdx,%rax
+  8035a1:	48 c1 e0 02          	shl    $0x2,%rax
+  8035a5:	48 89 c2             	mov    %rax,%rdx
+  8035a8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035af:	48 01 d0             	add    %rdx,%rax
+  8035b2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8035b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035bc:	48 63 d0             	movslq %eax,%rdx
+  8035bf:	48 89 d0             	mov    %rdx,%rax
+  8035c2:	48 01 c0             	add    %rax,%rax
+  8035c5:	48 01 d0             	add    %rdx,%rax
+  8035c8:	48 c1 e0 02          	shl    $0x2,%rax
+  8035cc:	48 89 c2             	mov    %rax,%rdx
+  8035cf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035d6:	48 01 d0             	add    %rdx,%rax
+  8035d9:	8b 00                	mov    (%rax),%eax
+  8035db:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8035de:	75 62                	jne    803642 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8035e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035e3:	48 63 d0             	movslq %eax,%rdx
+  8035e6:	48 89 d0             	mov    %rdx,%rax
+  8035e9:	48 01 c0             	add    %rax,%rax
+  8035ec:	48 01 d0             	add    %rdx,%rax
+  8035ef:	48 c1 e0 02          	shl    $0x2,%rax
+  8035f3:	48 89 c2             	mov    %rax,%rdx
+  8035f6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035fd:	48 01 d0             	add    %rdx,%rax
+  803600:	8b 40 04             	mov    0x4(%rax),%eax
+  803603:	83 e0 01             	and    $0x1,%eax
+  803606:	85 c0                	test   %eax,%eax
+  803608:	0f 84 9b 01 00 00    	je     8037a9 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80360e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803611:	48 63 d0             	movslq %eax,%rdx
+  803614:	48 89 d0             	mov    %rdx,%rax
+  803617:	48 01 c0             	add    %rax,%rax
+  80361a:	48 01 d0             	add    %rdx,%rax
+  80361d:	48 c1 e0 02          	shl    $0x2,%rax
+  803621:	48 89 c2             	mov    %rax,%rdx
+  803624:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80362b:	48 01 c2             	add    %rax,%rdx
+  80362e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803631:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803634:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803637:	83 c8 04             	or     $0x4,%eax
+  80363a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80363d:	e9 67 01 00 00       	jmp    8037a9 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803642:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803645:	48 63 d0             	movslq %eax,%rdx
+  803648:	48 89 d0             	mov    %rdx,%rax
+  80364b:	48 01 c0             	add    %rax,%rax
+  80364e:	48 01 d0             	add    %rdx,%rax
+  803651:	48 c1 e0 02          	shl    $0x2,%rax
+  803655:	48 89 c2             	mov    %rax,%rdx
+  803658:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80365f:	48 01 d0             	add    %rdx,%rax
+  803662:	8b 00                	mov    (%rax),%eax
+  803664:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80366b:	48 89 d6             	mov    %rdx,%rsi
+  80366e:	89 c7                	mov    %eax,%edi
+  803670:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  803677:	00 00 00 
+  80367a:	ff d0                	call   *%rax
+  80367c:	85 c0                	test   %eax,%eax
+  80367e:	78 25                	js     8036a5 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803680:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803687:	8b 00                	mov    (%rax),%eax
+  803689:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803690:	48 89 d6             	mov    %rdx,%rsi
+  803693:	89 c7                	mov    %eax,%edi
+  803695:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  80369c:	00 00 00 
+  80369f:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036a1:	85 c0                	test   %eax,%eax
+  8036a3:	79 2c                	jns    8036d1 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8036a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036a8:	48 63 d0             	movslq %eax,%rdx
+  8036ab:	48 89 d0             	mov    %rdx,%rax
+  8036ae:	48 01 c0             	add    %rax,%rax
+  8036b1:	48 01 d0             	add    %rdx,%rax
+  8036b4:	48 c1 e0 02          	shl    $0x2,%rax
+  8036b8:	48 89 c2             	mov    %rax,%rdx
+  8036bb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036c2:	48 01 d0             	add    %rdx,%rax
+  8036c5:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8036cc:	e9 d8 00 00 00       	jmp    8037a9 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8036d1:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8036d8:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8036dc:	48 85 c0             	test   %rax,%rax
+  8036df:	74 7d                	je     80375e <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8036e1:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8036e8:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8036ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036ef:	48 63 d0             	movslq %eax,%rdx
+  8036f2:	48 89 d0             	mov    %rdx,%rax
+  8036f5:	48 01 c0             	add    %rax,%rax
+  8036f8:	48 01 d0             	add    %rdx,%rax
+  8036fb:	48 c1 e0 02          	shl    $0x2,%rax
+  8036ff:	48 89 c2             	mov    %rax,%rdx
+  803702:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803709:	48 01 d0             	add    %rdx,%rax
+  80370c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80370f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803716:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80371d:	89 ce                	mov    %ecx,%esi
+  80371f:	48 89 c7             	mov    %rax,%rdi
+  803722:	41 ff d0             	call   *%r8
+  803725:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803728:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80372c:	79 08                	jns    803736 <poll+0x242>
+          return r;
+  80372e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803731:	e9 45 01 00 00       	jmp    80387b <poll+0x387>
+        fds[i].revents = r;
+  803736:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803739:	48 63 d0             	movslq %eax,%rdx
+  80373c:	48 89 d0             	mov    %rdx,%rax
+  80373f:	48 01 c0             	add    %rax,%rax
+  803742:	48 01 d0             	add    %rdx,%rax
+  803745:	48 c1 e0 02          	shl    $0x2,%rax
+  803749:	48 89 c2             	mov    %rax,%rdx
+  80374c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803753:	48 01 c2             	add    %rax,%rdx
+  803756:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803759:	89 42 08             	mov    %eax,0x8(%rdx)
+  80375c:	eb 4b                	jmp    8037a9 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80375e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803761:	48 63 d0             	movslq %eax,%rdx
+  803764:	48 89 d0             	mov    %rdx,%rax
+  803767:	48 01 c0             	add    %rax,%rax
+  80376a:	48 01 d0             	add    %rdx,%rax
+  80376d:	48 c1 e0 02          	shl    $0x2,%rax
+  803771:	48 89 c2             	mov    %rax,%rdx
+  803774:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80377b:	48 01 d0             	add    %rdx,%rax
+  80377e:	8b 48 04             	mov    0x4(%rax),%ecx
+  803781:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803784:	48 63 d0             	movslq %eax,%rdx
+  803787:	48 89 d0             	mov    %rdx,%rax
+  80378a:	48 01 c0             	add    %rax,%rax
+  80378d:	48 01 d0             	add    %rdx,%rax
+  803790:	48 c1 e0 02          	shl    $0x2,%rax
+  803794:	48 89 c2             	mov    %rax,%rdx
+  803797:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80379e:	48 01 d0             	add    %rdx,%rax
+  8037a1:	83 e1 03             	and    $0x3,%ecx
+  8037a4:	89 ca                	mov    %ecx,%edx
+  8037a6:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8037a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037ac:	48 63 d0             	movslq %eax,%rdx
+  8037af:	48 89 d0             	mov    %rdx,%rax
+  8037b2:	48 01 c0             	add    %rax,%rax
+  8037b5:	48 01 d0             	add    %rdx,%rax
+  8037b8:	48 c1 e0 02          	shl    $0x2,%rax
+  8037bc:	48 89 c2             	mov    %rax,%rdx
+  8037bf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037c6:	48 01 d0             	add    %rdx,%rax
+  8037c9:	8b 40 08             	mov    0x8(%rax),%eax
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	74 04                	je     8037d4 <poll+0x2e0>
+        ready++;
+  8037d0:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8037d4:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8037d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037db:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8037e1:	0f 8c ab fd ff ff    	jl     803592 <poll+0x9e>
+    }
+    if (ready)
+  8037e7:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8037eb:	74 08                	je     8037f5 <poll+0x301>
+      return ready;
+  8037ed:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8037f0:	e9 86 00 00 00       	jmp    80387b <poll+0x387>
+
+    if (deadline) {
+  8037f5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8037fa:	74 30                	je     80382c <poll+0x338>
+      now     = vsys_clock_ns();
+  8037fc:	48 b8 48 4d 80 00 00 	movabs $0x804d48,%rax
+  803803:	00 00 00 
+  803806:	ff d0                	call   *%rax
+  803808:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80380c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803810:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803814:	73 0a                	jae    803820 <poll+0x32c>
+  803816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80381a:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80381e:	eb 05                	jmp    803825 <poll+0x331>
+  803820:	b8 00 00 00 00       	mov    $0x0,%eax
+  803825:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80382c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80382f:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803832:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803839:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803840:	48 89 c7             	mov    %rax,%rdi
+  803843:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  80384a:	00 00 00 
+  80384d:	ff d0                	call   *%rax
+  80384f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803852:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803856:	75 07                	jne    80385f <poll+0x36b>
+      return 0;
+  803858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385d:	eb 1c                	jmp    80387b <poll+0x387>
+    if (r < 0)
+  80385f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803863:	79 05                	jns    80386a <poll+0x376>
+      return r;
+  803865:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803868:	eb 11                	jmp    80387b <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80386a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80386d:	c1 f8 02             	sar    $0x2,%eax
+  803870:	83 e0 01             	and    $0x1,%eax
+  803873:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803876:	e9 f6 fc ff ff       	jmp    803571 <poll+0x7d>
+  }
+}
+  80387b:	c9                   	leave
+  80387c:	c3                   	ret
+
+000000000080387d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80387d:	55                   	push   %rbp
+  80387e:	48 89 e5             	mov    %rsp,%rbp
+  803881:	48 83 ec 20          	sub    $0x20,%rsp
+  803885:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803889:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80388d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803891:	be 00 00 00 00       	mov    $0x0,%esi
+  803896:	48 89 c7             	mov    %rax,%rdi
+  803899:	48 b8 6b 39 80 00 00 	movabs $0x80396b,%rax
+  8038a0:	00 00 00 
+  8038a3:	ff d0                	call   *%rax
+  8038a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038ac:	79 05                	jns    8038b3 <stat+0x36>
+    return fd;
+  8038ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038b1:	eb 2f                	jmp    8038e2 <stat+0x65>
+  r = fstat(fd, stat);
+  8038b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038ba:	48 89 d6             	mov    %rdx,%rsi
+  8038bd:	89 c7                	mov    %eax,%edi
+  8038bf:	48 b8 b4 33 80 00 00 	movabs $0x8033b4,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+  8038cb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8038ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038d1:	89 c7                	mov    %eax,%edi
+  8038d3:	48 b8 1c 2d 80 00 00 	movabs $0x802d1c,%rax
+  8038da:	00 00 00 
+  8038dd:	ff d0                	call   *%rax
+  return r;
+  8038df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8038e2:	c9                   	leave
+  8038e3:	c3                   	ret
+
+00000000008038e4 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8038e4:	55                   	push   %rbp
+  8038e5:	48 89 e5             	mov    %rsp,%rbp
+  8038e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8038ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8038ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8038f3:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8038fa:	00 00 00 
+  8038fd:	8b 00                	mov    (%rax),%eax
+  8038ff:	85 c0                	test   %eax,%eax
+  803901:	75 1d                	jne    803920 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803903:	bf 03 00 00 00       	mov    $0x3,%edi
+  803908:	48 b8 63 53 80 00 00 	movabs $0x805363,%rax
+  80390f:	00 00 00 
+  803912:	ff d0                	call   *%rax
+  803914:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80391b:	00 00 00 
+  80391e:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803920:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803927:	00 00 00 
+  80392a:	8b 00                	mov    (%rax),%eax
+  80392c:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80392f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803934:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80393b:	00 00 00 
+  80393e:	89 c7                	mov    %eax,%edi
+  803940:	48 b8 b6 52 80 00 00 	movabs $0x8052b6,%rax
+  803947:	00 00 00 
+  80394a:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80394c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803950:	ba 00 00 00 00       	mov    $0x0,%edx
+  803955:	48 89 c6             	mov    %rax,%rsi
+  803958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80395d:	48 b8 39 51 80 00 00 	movabs $0x805139,%rax
+  803964:	00 00 00 
+  803967:	ff d0                	call   *%rax
+}
+  803969:	c9                   	leave
+  80396a:	c3                   	ret
+
+000000000080396b <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80396b:	55                   	push   %rbp
+  80396c:	48 89 e5             	mov    %rsp,%rbp
+  80396f:	48 83 ec 20          	sub    $0x20,%rsp
+  803973:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803977:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80397a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80397e:	48 89 c7             	mov    %rax,%rdi
+  803981:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+  80398d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803992:	7e 0a                	jle    80399e <open+0x33>
+    return -E_BAD_PATH;
+  803994:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803999:	e9 a8 00 00 00       	jmp    803a46 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80399e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8039a2:	48 89 c7             	mov    %rax,%rdi
+  8039a5:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  8039ac:	00 00 00 
+  8039af:	ff d0                	call   *%rax
+  8039b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039b8:	79 08                	jns    8039c2 <open+0x57>
+    return r;
+  8039ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039bd:	e9 84 00 00 00       	jmp    803a46 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8039c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c6:	48 89 c6             	mov    %rax,%rsi
+  8039c9:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8039d0:	00 00 00 
+  8039d3:	48 89 c7             	mov    %rax,%rdi
+  8039d6:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8039dd:	00 00 00 
+  8039e0:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8039e2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8039e9:	00 00 00 
+  8039ec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039ef:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8039f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039f9:	48 89 c6             	mov    %rax,%rsi
+  8039fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a01:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803a08:	00 00 00 
+  803a0b:	ff d0                	call   *%rax
+  803a0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a14:	79 1d                	jns    803a33 <open+0xc8>
+    fd_close(fd, 0);
+  803a16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a1a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a1f:	48 89 c7             	mov    %rax,%rdi
+  803a22:	48 b8 7d 2b 80 00 00 	movabs $0x802b7d,%rax
+  803a29:	00 00 00 
+  803a2c:	ff d0                	call   *%rax
+    return r;
+  803a2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a31:	eb 13                	jmp    803a46 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803a33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a37:	48 89 c7             	mov    %rax,%rdi
+  803a3a:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+}
+  803a46:	c9                   	leave
+  803a47:	c3                   	ret
+
+0000000000803a48 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803a48:	55                   	push   %rbp
+  803a49:	48 89 e5             	mov    %rsp,%rbp
+  803a4c:	48 83 ec 10          	sub    $0x10,%rsp
+  803a50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803a54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a58:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a5b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803a62:	00 00 00 
+  803a65:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803a67:	be 00 00 00 00       	mov    $0x0,%esi
+  803a6c:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a71:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+}
+  803a7d:	c9                   	leave
+  803a7e:	c3                   	ret
+
+0000000000803a7f <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a7f:	55                   	push   %rbp
+  803a80:	48 89 e5             	mov    %rsp,%rbp
+  803a83:	48 83 ec 30          	sub    $0x30,%rsp
+  803a87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a8b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a8f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803a93:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803a98:	74 07                	je     803aa1 <devfile_read+0x22>
+  803a9a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803a9f:	75 0a                	jne    803aab <devfile_read+0x2c>
+  return E_INVAL;
+  803aa1:	b8 03 00 00 00       	mov    $0x3,%eax
+  803aa6:	e9 b4 00 00 00       	jmp    803b5f <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803aab:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ab2:	00 
+  while (n) {
+  803ab3:	e9 98 00 00 00       	jmp    803b50 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abc:	8b 40 0c             	mov    0xc(%rax),%eax
+  803abf:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803ac6:	00 00 00 
+  803ac9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803acb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803ad2:	00 00 00 
+  803ad5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ad9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803add:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae2:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ae7:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+  803af3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803af6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803afa:	7f 13                	jg     803b0f <devfile_read+0x90>
+      return res ? res : res0;
+  803afc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b00:	74 07                	je     803b09 <devfile_read+0x8a>
+  803b02:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b05:	48 98                	cltq
+  803b07:	eb 56                	jmp    803b5f <devfile_read+0xe0>
+  803b09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b0d:	eb 50                	jmp    803b5f <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b0f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b12:	48 63 d0             	movslq %eax,%rdx
+  803b15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b19:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  803b20:	00 00 00 
+  803b23:	48 89 ce             	mov    %rcx,%rsi
+  803b26:	48 89 c7             	mov    %rax,%rdi
+  803b29:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  803b30:	00 00 00 
+  803b33:	ff d0                	call   *%rax
+
+    buf += res;
+  803b35:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b38:	48 98                	cltq
+  803b3a:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803b3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b41:	48 98                	cltq
+  803b43:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803b47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b4a:	48 98                	cltq
+  803b4c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803b50:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b55:	0f 85 5d ff ff ff    	jne    803ab8 <devfile_read+0x39>
+  }
+
+  return res0;
+  803b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803b5f:	c9                   	leave
+  803b60:	c3                   	ret
+
+0000000000803b61 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b61:	55                   	push   %rbp
+  803b62:	48 89 e5             	mov    %rsp,%rbp
+  803b65:	48 83 ec 50          	sub    $0x50,%rsp
+  803b69:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b6d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b71:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b75:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b7a:	74 07                	je     803b83 <devfile_write+0x22>
+  803b7c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803b81:	75 0a                	jne    803b8d <devfile_write+0x2c>
+  return E_INVAL;
+  803b83:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b88:	e9 c9 00 00 00       	jmp    803c56 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803b8d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b94:	00 
+
+  while (n) {
+  803b95:	e9 ad 00 00 00       	jmp    803c47 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803b9a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803b9e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803ba2:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803ba9:	00 
+  803baa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803bae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bb2:	48 39 c2             	cmp    %rax,%rdx
+  803bb5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803bb9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803bbd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803bc1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bc5:	48 89 c6             	mov    %rax,%rsi
+  803bc8:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  803bcf:	00 00 00 
+  803bd2:	48 89 c7             	mov    %rax,%rdi
+  803bd5:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  803bdc:	00 00 00 
+  803bdf:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803be5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803be8:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803bef:	00 00 00 
+  803bf2:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803bf4:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803bfb:	00 00 00 
+  803bfe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c02:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803c06:	be 00 00 00 00       	mov    $0x0,%esi
+  803c0b:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c10:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803c17:	00 00 00 
+  803c1a:	ff d0                	call   *%rax
+  803c1c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803c1f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c23:	79 07                	jns    803c2c <devfile_write+0xcb>
+      return res;
+  803c25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c28:	48 98                	cltq
+  803c2a:	eb 2a                	jmp    803c56 <devfile_write+0xf5>
+
+    buf += res;
+  803c2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c2f:	48 98                	cltq
+  803c31:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803c35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c38:	48 98                	cltq
+  803c3a:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803c3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c41:	48 98                	cltq
+  803c43:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803c47:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803c4c:	0f 85 48 ff ff ff    	jne    803b9a <devfile_write+0x39>
+  }
+
+  return res0;
+  803c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803c56:	c9                   	leave
+  803c57:	c3                   	ret
+
+0000000000803c58 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c58:	55                   	push   %rbp
+  803c59:	48 89 e5             	mov    %rsp,%rbp
+  803c5c:	48 83 ec 20          	sub    $0x20,%rsp
+  803c60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c64:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c6c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c6f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803c76:	00 00 00 
+  803c79:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803c7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c80:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c85:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+  803c91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c98:	79 05                	jns    803c9f <devfile_stat+0x47>
+    return r;
+  803c9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c9d:	eb 59                	jmp    803cf8 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ca3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803caa:	00 00 00 
+  803cad:	48 89 d6             	mov    %rdx,%rsi
+  803cb0:	48 89 c7             	mov    %rax,%rdi
+  803cb3:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803cbf:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803cc6:	00 00 00 
+  803cc9:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803ccf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cd3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803cd9:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803ce0:	00 00 00 
+  803ce3:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803ce9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ced:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cf8:	c9                   	leave
+  803cf9:	c3                   	ret
+
+0000000000803cfa <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803cfa:	55                   	push   %rbp
+  803cfb:	48 89 e5             	mov    %rsp,%rbp
+  803cfe:	48 83 ec 10          	sub    $0x10,%rsp
+  803d02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d06:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803d09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d0d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d10:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803d17:	00 00 00 
+  803d1a:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803d1c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803d23:	00 00 00 
+  803d26:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d29:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  803d31:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d36:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803d3d:	00 00 00 
+  803d40:	ff d0                	call   *%rax
+}
+  803d42:	c9                   	leave
+  803d43:	c3                   	ret
+
+0000000000803d44 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803d44:	55                   	push   %rbp
+  803d45:	48 89 e5             	mov    %rsp,%rbp
+  803d48:	48 83 ec 18          	sub    $0x18,%rsp
+  803d4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d50:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803d53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803d57:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d5a:	83 e0 03             	and    $0x3,%eax
+}
+  803d5d:	c9                   	leave
+  803d5e:	c3                   	ret
+
+0000000000803d5f <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803d5f:	55                   	push   %rbp
+  803d60:	48 89 e5             	mov    %rsp,%rbp
+  803d63:	48 83 ec 10          	sub    $0x10,%rsp
+  803d67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803d6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d6f:	48 89 c7             	mov    %rax,%rdi
+  803d72:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  803d79:	00 00 00 
+  803d7c:	ff d0                	call   *%rax
+  803d7e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d83:	7e 07                	jle    803d8c <remove+0x2d>
+    return -E_BAD_PATH;
+  803d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803d8a:	eb 36                	jmp    803dc2 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d90:	48 89 c6             	mov    %rax,%rsi
+  803d93:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803d9a:	00 00 00 
+  803d9d:	48 89 c7             	mov    %rax,%rdi
+  803da0:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  803da7:	00 00 00 
+  803daa:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803dac:	be 00 00 00 00       	mov    $0x0,%esi
+  803db1:	bf 07 00 00 00       	mov    $0x7,%edi
+  803db6:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+}
+  803dc2:	c9                   	leave
+  803dc3:	c3                   	ret
+
+0000000000803dc4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803dc4:	55                   	push   %rbp
+  803dc5:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  803dcd:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dd2:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803dd9:	00 00 00 
+  803ddc:	ff d0                	call   *%rax
+}
+  803dde:	5d                   	pop    %rbp
+  803ddf:	c3                   	ret
+
+0000000000803de0 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803de0:	55                   	push   %rbp
+  803de1:	48 89 e5             	mov    %rsp,%rbp
+  803de4:	48 83 ec 20          	sub    $0x20,%rsp
+  803de8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803dec:	be 00 00 00 00       	mov    $0x0,%esi
+  803df1:	bf 09 00 00 00       	mov    $0x9,%edi
+  803df6:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+  803e02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e05:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e09:	79 05                	jns    803e10 <fs_stats+0x30>
+    return r;
+  803e0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e0e:	eb 2a                	jmp    803e3a <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803e10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e14:	ba 68 00 00 00       	mov    $0x68,%edx
+  803e19:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  803e20:	00 00 00 
+  803e23:	48 89 ce             	mov    %rcx,%rsi
+  803e26:	48 89 c7             	mov    %rax,%rdi
+  803e29:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  803e30:	00 00 00 
+  803e33:	ff d0                	call   *%rax
+  return 0;
+  803e35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e3a:	c9                   	leave
+  803e3b:	c3                   	ret
+
+0000000000803e3c <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	48 83 ec 10          	sub    $0x10,%rsp
+  803e44:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803e47:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803e4e:	00 00 00 
+  803e51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e54:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803e56:	be 00 00 00 00       	mov    $0x0,%esi
+  803e5b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803e60:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803e67:	00 00 00 
+  803e6a:	ff d0                	call   *%rax
+}
+  803e6c:	c9                   	leave
+  803e6d:	c3                   	ret
+
+0000000000803e6e <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803e6e:	55                   	push   %rbp
+  803e6f:	48 89 e5             	mov    %rsp,%rbp
+  803e72:	48 83 ec 10          	sub    $0x10,%rsp
+  803e76:	89 f8                	mov    %edi,%eax
+  803e78:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803e7b:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803e7f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803e86:	00 00 00 
+  803e89:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803e8b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e90:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803e95:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803e9c:	00 00 00 
+  803e9f:	ff d0                	call   *%rax
+}
+  803ea1:	c9                   	leave
+  803ea2:	c3                   	ret
+
+0000000000803ea3 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  803ea3:	55                   	push   %rbp
+  803ea4:	48 89 e5             	mov    %rsp,%rbp
+  803ea7:	48 83 ec 20          	sub    $0x20,%rsp
+  803eab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  803eaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb3:	8b 40 10             	mov    0x10(%rax),%eax
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	7e 73                	jle    803f2d <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  803eba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ebe:	8b 40 04             	mov    0x4(%rax),%eax
+  803ec1:	48 63 d0             	movslq %eax,%rdx
+  803ec4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ec8:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  803ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ed0:	8b 00                	mov    (%rax),%eax
+  803ed2:	48 89 ce             	mov    %rcx,%rsi
+  803ed5:	89 c7                	mov    %eax,%edi
+  803ed7:	48 b8 7f 31 80 00 00 	movabs $0x80317f,%rax
+  803ede:	00 00 00 
+  803ee1:	ff d0                	call   *%rax
+  803ee3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  803ee7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803eec:	7e 17                	jle    803f05 <writebuf+0x62>
+      b->result += result;
+  803eee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ef2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803ef6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803efa:	48 01 c2             	add    %rax,%rdx
+  803efd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f01:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  803f05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f09:	8b 40 04             	mov    0x4(%rax),%eax
+  803f0c:	48 98                	cltq
+  803f0e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  803f12:	74 19                	je     803f2d <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  803f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f1d:	48 85 c0             	test   %rax,%rax
+  803f20:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803f24:	89 c2                	mov    %eax,%edx
+  803f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f2a:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  803f2d:	90                   	nop
+  803f2e:	c9                   	leave
+  803f2f:	c3                   	ret
+
+0000000000803f30 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  803f30:	55                   	push   %rbp
+  803f31:	48 89 e5             	mov    %rsp,%rbp
+  803f34:	48 83 ec 20          	sub    $0x20,%rsp
+  803f38:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f3b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  803f3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f43:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  803f47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f4b:	8b 40 04             	mov    0x4(%rax),%eax
+  803f4e:	8d 48 01             	lea    0x1(%rax),%ecx
+  803f51:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f55:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  803f58:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f5b:	89 d1                	mov    %edx,%ecx
+  803f5d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f61:	48 98                	cltq
+  803f63:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  803f67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f6b:	8b 40 04             	mov    0x4(%rax),%eax
+  803f6e:	3d 00 01 00 00       	cmp    $0x100,%eax
+  803f73:	75 1e                	jne    803f93 <putch+0x63>
+    writebuf(b);
+  803f75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f79:	48 89 c7             	mov    %rax,%rdi
+  803f7c:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  803f83:	00 00 00 
+  803f86:	ff d0                	call   *%rax
+    b->idx = 0;
+  803f88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f8c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  803f93:	90                   	nop
+  803f94:	c9                   	leave
+  803f95:	c3                   	ret
+
+0000000000803f96 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f96:	55                   	push   %rbp
+  803f97:	48 89 e5             	mov    %rsp,%rbp
+  803f9a:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  803fa1:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  803fa7:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  803fae:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  803fb5:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  803fbb:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  803fc1:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  803fc8:	00 00 00 
+  b.result = 0;
+  803fcb:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  803fd2:	00 00 00 00 
+  b.error  = 1;
+  803fd6:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  803fdd:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  803fe0:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  803fe7:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  803fee:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  803ff5:	48 89 c6             	mov    %rax,%rsi
+  803ff8:	48 b8 30 3f 80 00 00 	movabs $0x803f30,%rax
+  803fff:	00 00 00 
+  804002:	48 89 c7             	mov    %rax,%rdi
+  804005:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  80400c:	00 00 00 
+  80400f:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  804011:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804017:	85 c0                	test   %eax,%eax
+  804019:	7e 16                	jle    804031 <vfprintf+0x9b>
+    writebuf(&b);
+  80401b:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804022:	48 89 c7             	mov    %rax,%rdi
+  804025:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  80402c:	00 00 00 
+  80402f:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  804031:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804038:	48 85 c0             	test   %rax,%rax
+  80403b:	74 09                	je     804046 <vfprintf+0xb0>
+  80403d:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804044:	eb 06                	jmp    80404c <vfprintf+0xb6>
+  804046:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  80404c:	c9                   	leave
+  80404d:	c3                   	ret
+
+000000000080404e <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80404e:	55                   	push   %rbp
+  80404f:	48 89 e5             	mov    %rsp,%rbp
+  804052:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804059:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  80405f:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804066:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80406d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804074:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80407b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804082:	84 c0                	test   %al,%al
+  804084:	74 20                	je     8040a6 <fprintf+0x58>
+  804086:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80408a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80408e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804092:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804096:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80409a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80409e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8040a2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8040a6:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  8040ad:	00 00 00 
+  8040b0:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8040b7:	00 00 00 
+  8040ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8040be:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8040c5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8040cc:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  8040d3:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8040da:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8040e1:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8040e7:	48 89 ce             	mov    %rcx,%rsi
+  8040ea:	89 c7                	mov    %eax,%edi
+  8040ec:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  8040f3:	00 00 00 
+  8040f6:	ff d0                	call   *%rax
+  8040f8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8040fe:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804104:	c9                   	leave
+  804105:	c3                   	ret
+
+0000000000804106 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804106:	55                   	push   %rbp
+  804107:	48 89 e5             	mov    %rsp,%rbp
+  80410a:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804111:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804118:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80411f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804126:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80412d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804134:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80413b:	84 c0                	test   %al,%al
+  80413d:	74 20                	je     80415f <printf+0x59>
+  80413f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804143:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804147:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80414b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80414f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804153:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804157:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80415b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80415f:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804166:	00 00 00 
+  804169:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804170:	00 00 00 
+  804173:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804177:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80417e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804185:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  80418c:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804193:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80419a:	48 89 c6             	mov    %rax,%rsi
+  80419d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041a2:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  8041a9:	00 00 00 
+  8041ac:	ff d0                	call   *%rax
+  8041ae:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8041b4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8041ba:	c9                   	leave
+  8041bb:	c3                   	ret
+
+00000000008041bc <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8041bc:	55                   	push   %rbp
+  8041bd:	48 89 e5             	mov    %rsp,%rbp
+  8041c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8041c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8041c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041cc:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8041d1:	48 89 c7             	mov    %rax,%rdi
+  8041d4:	48 b8 e2 41 80 00 00 	movabs $0x8041e2,%rax
+  8041db:	00 00 00 
+  8041de:	ff d0                	call   *%rax
+}
+  8041e0:	c9                   	leave
+  8041e1:	c3                   	ret
+
+00000000008041e2 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8041e2:	55                   	push   %rbp
+  8041e3:	48 89 e5             	mov    %rsp,%rbp
+  8041e6:	48 83 ec 50          	sub    $0x50,%rsp
+  8041ea:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8041ee:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8041f2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8041f9:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8041fa:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8041ff:	74 0a                	je     80420b <pipe_size+0x29>
+  804201:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804208:	00 
+  804209:	76 0a                	jbe    804215 <pipe_size+0x33>
+    return -E_INVAL;
+  80420b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804210:	e9 cc 02 00 00       	jmp    8044e1 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804215:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804219:	48 89 c7             	mov    %rax,%rdi
+  80421c:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  804223:	00 00 00 
+  804226:	ff d0                	call   *%rax
+  804228:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80422b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80422f:	0f 88 a8 02 00 00    	js     8044dd <pipe_size+0x2fb>
+  804235:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804239:	ba 07 04 00 00       	mov    $0x407,%edx
+  80423e:	48 89 c6             	mov    %rax,%rsi
+  804241:	bf 00 00 00 00       	mov    $0x0,%edi
+  804246:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  80424d:	00 00 00 
+  804250:	ff d0                	call   *%rax
+  804252:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804255:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804259:	0f 88 7e 02 00 00    	js     8044dd <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80425f:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804263:	48 89 c7             	mov    %rax,%rdi
+  804266:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+  804272:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804275:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804279:	0f 88 43 02 00 00    	js     8044c2 <pipe_size+0x2e0>
+  80427f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804283:	ba 07 04 00 00       	mov    $0x407,%edx
+  804288:	48 89 c6             	mov    %rax,%rsi
+  80428b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804290:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  804297:	00 00 00 
+  80429a:	ff d0                	call   *%rax
+  80429c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80429f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042a3:	0f 88 19 02 00 00    	js     8044c2 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8042a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042ad:	48 89 c7             	mov    %rax,%rdi
+  8042b0:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  8042b7:	00 00 00 
+  8042ba:	ff d0                	call   *%rax
+  8042bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8042c0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8042c7:	00 
+  8042c8:	e9 a2 00 00 00       	jmp    80436f <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8042cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042d1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8042d5:	48 89 c2             	mov    %rax,%rdx
+  8042d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042dc:	48 01 d0             	add    %rdx,%rax
+  8042df:	ba 07 04 00 00       	mov    $0x407,%edx
+  8042e4:	48 89 c6             	mov    %rax,%rsi
+  8042e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ec:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  8042f3:	00 00 00 
+  8042f6:	ff d0                	call   *%rax
+  8042f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042ff:	0f 88 37 01 00 00    	js     80443c <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804305:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804309:	48 89 c7             	mov    %rax,%rdi
+  80430c:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804313:	00 00 00 
+  804316:	ff d0                	call   *%rax
+  804318:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80431c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804320:	48 01 c2             	add    %rax,%rdx
+  804323:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804327:	48 c1 e0 0c          	shl    $0xc,%rax
+  80432b:	48 89 c1             	mov    %rax,%rcx
+  80432e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804332:	48 01 c8             	add    %rcx,%rax
+  804335:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80433b:	48 89 d1             	mov    %rdx,%rcx
+  80433e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804343:	48 89 c6             	mov    %rax,%rsi
+  804346:	bf 00 00 00 00       	mov    $0x0,%edi
+  80434b:	48 b8 e8 22 80 00 00 	movabs $0x8022e8,%rax
+  804352:	00 00 00 
+  804355:	ff d0                	call   *%rax
+  804357:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80435a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80435e:	79 0a                	jns    80436a <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804360:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804365:	e9 d3 00 00 00       	jmp    80443d <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80436a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80436f:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804376:	00 
+  804377:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80437b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80437f:	48 01 d0             	add    %rdx,%rax
+  804382:	48 83 c0 1f          	add    $0x1f,%rax
+  804386:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80438a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80438e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804393:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804397:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80439b:	48 29 d0             	sub    %rdx,%rax
+  80439e:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043a2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8043a6:	0f 82 21 ff ff ff    	jb     8042cd <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8043ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043b0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8043b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043b8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8043bc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8043c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c4:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8043cb:	00 00 00 
+  8043ce:	8b 12                	mov    (%rdx),%edx
+  8043d0:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8043d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043d6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8043dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043e1:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8043e8:	00 00 00 
+  8043eb:	8b 12                	mov    (%rdx),%edx
+  8043ed:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8043ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043f3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8043fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043fe:	48 89 c7             	mov    %rax,%rdi
+  804401:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  804408:	00 00 00 
+  80440b:	ff d0                	call   *%rax
+  80440d:	89 c2                	mov    %eax,%edx
+  80440f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804413:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804415:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804419:	48 89 c7             	mov    %rax,%rdi
+  80441c:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+  804428:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80442c:	48 83 c2 04          	add    $0x4,%rdx
+  804430:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804432:	b8 00 00 00 00       	mov    $0x0,%eax
+  804437:	e9 a5 00 00 00       	jmp    8044e1 <pipe_size+0x2ff>
+      goto err2;
+  80443c:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80443d:	eb 58                	jmp    804497 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80443f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804443:	48 c1 e0 0c          	shl    $0xc,%rax
+  804447:	48 89 c2             	mov    %rax,%rdx
+  80444a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80444e:	48 01 d0             	add    %rdx,%rax
+  804451:	48 89 c6             	mov    %rax,%rsi
+  804454:	bf 00 00 00 00       	mov    $0x0,%edi
+  804459:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  804460:	00 00 00 
+  804463:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804465:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804469:	48 89 c7             	mov    %rax,%rdi
+  80446c:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804473:	00 00 00 
+  804476:	ff d0                	call   *%rax
+  804478:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80447c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804480:	48 01 d0             	add    %rdx,%rax
+  804483:	48 89 c6             	mov    %rax,%rsi
+  804486:	bf 00 00 00 00       	mov    $0x0,%edi
+  80448b:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  804492:	00 00 00 
+  804495:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804497:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80449b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80449f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8044a3:	48 85 c0             	test   %rax,%rax
+  8044a6:	75 97                	jne    80443f <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8044a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044ac:	48 89 c6             	mov    %rax,%rsi
+  8044af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044b4:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  8044bb:	00 00 00 
+  8044be:	ff d0                	call   *%rax
+  8044c0:	eb 01                	jmp    8044c3 <pipe_size+0x2e1>
+    goto err1;
+  8044c2:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8044c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044c7:	48 89 c6             	mov    %rax,%rsi
+  8044ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044cf:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+  8044db:	eb 01                	jmp    8044de <pipe_size+0x2fc>
+    goto err;
+  8044dd:	90                   	nop
+err:
+  return r;
+  8044de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8044e1:	c9                   	leave
+  8044e2:	c3                   	ret
+
+00000000008044e3 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8044e3:	55                   	push   %rbp
+  8044e4:	48 89 e5             	mov    %rsp,%rbp
+  8044e7:	53                   	push   %rbx
+  8044e8:	48 83 ec 28          	sub    $0x28,%rsp
+  8044ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044f0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8044f4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8044fb:	00 00 00 
+  8044fe:	8b 40 04             	mov    0x4(%rax),%eax
+  804501:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804506:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80450d:	00 00 00 
+  804510:	48 98                	cltq
+  804512:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804519:	48 01 d0             	add    %rdx,%rax
+  80451c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804522:	8b 00                	mov    (%rax),%eax
+  804524:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804527:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80452b:	48 89 c7             	mov    %rax,%rdi
+  80452e:	48 b8 d4 53 80 00 00 	movabs $0x8053d4,%rax
+  804535:	00 00 00 
+  804538:	ff d0                	call   *%rax
+  80453a:	89 c3                	mov    %eax,%ebx
+  80453c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804540:	48 89 c7             	mov    %rax,%rdi
+  804543:	48 b8 d4 53 80 00 00 	movabs $0x8053d4,%rax
+  80454a:	00 00 00 
+  80454d:	ff d0                	call   *%rax
+  80454f:	39 c3                	cmp    %eax,%ebx
+  804551:	0f 94 c0             	sete   %al
+  804554:	0f b6 c0             	movzbl %al,%eax
+  804557:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80455a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804561:	00 00 00 
+  804564:	8b 40 04             	mov    0x4(%rax),%eax
+  804567:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80456c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804573:	00 00 00 
+  804576:	48 98                	cltq
+  804578:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80457f:	48 01 d0             	add    %rdx,%rax
+  804582:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804588:	8b 00                	mov    (%rax),%eax
+  80458a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80458d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804590:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804593:	75 05                	jne    80459a <_pipeisclosed+0xb7>
+      return ret;
+  804595:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804598:	eb 68                	jmp    804602 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80459a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80459d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8045a0:	0f 84 4e ff ff ff    	je     8044f4 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8045a6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8045ad:	00 00 00 
+  8045b0:	8b 40 04             	mov    0x4(%rax),%eax
+  8045b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045b8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8045bf:	00 00 00 
+  8045c2:	48 98                	cltq
+  8045c4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8045cb:	48 01 d0             	add    %rdx,%rax
+  8045ce:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8045d4:	8b 10                	mov    (%rax),%edx
+  8045d6:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8045d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045dc:	89 c6                	mov    %eax,%esi
+  8045de:	48 b8 40 5b 80 00 00 	movabs $0x805b40,%rax
+  8045e5:	00 00 00 
+  8045e8:	48 89 c7             	mov    %rax,%rdi
+  8045eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045f0:	49 b8 12 05 80 00 00 	movabs $0x800512,%r8
+  8045f7:	00 00 00 
+  8045fa:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8045fd:	e9 f2 fe ff ff       	jmp    8044f4 <_pipeisclosed+0x11>
+  }
+}
+  804602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804606:	c9                   	leave
+  804607:	c3                   	ret
+
+0000000000804608 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804608:	55                   	push   %rbp
+  804609:	48 89 e5             	mov    %rsp,%rbp
+  80460c:	48 83 ec 30          	sub    $0x30,%rsp
+  804610:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804613:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804617:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80461a:	48 89 d6             	mov    %rdx,%rsi
+  80461d:	89 c7                	mov    %eax,%edi
+  80461f:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  804626:	00 00 00 
+  804629:	ff d0                	call   *%rax
+  80462b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80462e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804632:	79 05                	jns    804639 <pipeisclosed+0x31>
+    return r;
+  804634:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804637:	eb 31                	jmp    80466a <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804639:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80463d:	48 89 c7             	mov    %rax,%rdi
+  804640:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804647:	00 00 00 
+  80464a:	ff d0                	call   *%rax
+  80464c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804654:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804658:	48 89 d6             	mov    %rdx,%rsi
+  80465b:	48 89 c7             	mov    %rax,%rdi
+  80465e:	48 b8 e3 44 80 00 00 	movabs $0x8044e3,%rax
+  804665:	00 00 00 
+  804668:	ff d0                	call   *%rax
+}
+  80466a:	c9                   	leave
+  80466b:	c3                   	ret
+
+000000000080466c <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80466c:	55                   	push   %rbp
+  80466d:	48 89 e5             	mov    %rsp,%rbp
+  804670:	48 83 ec 10          	sub    $0x10,%rsp
+  804674:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804678:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80467c:	8b 40 18             	mov    0x18(%rax),%eax
+  80467f:	8d 50 01             	lea    0x1(%rax),%edx
+  804682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804686:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804689:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80468d:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804690:	85 c0                	test   %eax,%eax
+  804692:	74 27                	je     8046bb <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804694:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804698:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80469f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046a3:	48 83 c0 18          	add    $0x18,%rax
+  8046a7:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8046ac:	48 89 c7             	mov    %rax,%rdi
+  8046af:	48 b8 8b 26 80 00 00 	movabs $0x80268b,%rax
+  8046b6:	00 00 00 
+  8046b9:	ff d0                	call   *%rax
+  }
+}
+  8046bb:	90                   	nop
+  8046bc:	c9                   	leave
+  8046bd:	c3                   	ret
+
+00000000008046be <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8046be:	55                   	push   %rbp
+  8046bf:	48 89 e5             	mov    %rsp,%rbp
+  8046c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8046c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046ca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8046cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046d1:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8046d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046dc:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8046e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046e3:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8046ea:	89 c6                	mov    %eax,%esi
+  8046ec:	48 89 cf             	mov    %rcx,%rdi
+  8046ef:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8046f6:	00 00 00 
+  8046f9:	ff d0                	call   *%rax
+}
+  8046fb:	90                   	nop
+  8046fc:	c9                   	leave
+  8046fd:	c3                   	ret
+
+00000000008046fe <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046fe:	55                   	push   %rbp
+  8046ff:	48 89 e5             	mov    %rsp,%rbp
+  804702:	48 83 ec 70          	sub    $0x70,%rsp
+  804706:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80470a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80470e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804712:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804716:	48 89 c7             	mov    %rax,%rdi
+  804719:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804720:	00 00 00 
+  804723:	ff d0                	call   *%rax
+  804725:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804729:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80472e:	75 0a                	jne    80473a <devpipe_read+0x3c>
+    return 0;
+  804730:	b8 00 00 00 00       	mov    $0x0,%eax
+  804735:	e9 63 01 00 00       	jmp    80489d <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80473a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80473e:	8b 40 18             	mov    0x18(%rax),%eax
+  804741:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804744:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804748:	48 8b 10             	mov    (%rax),%rdx
+  80474b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80474f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804753:	48 39 c2             	cmp    %rax,%rdx
+  804756:	75 42                	jne    80479a <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804758:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80475c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804760:	48 89 d6             	mov    %rdx,%rsi
+  804763:	48 89 c7             	mov    %rax,%rdi
+  804766:	48 b8 e3 44 80 00 00 	movabs $0x8044e3,%rax
+  80476d:	00 00 00 
+  804770:	ff d0                	call   *%rax
+  804772:	85 c0                	test   %eax,%eax
+  804774:	74 0a                	je     804780 <devpipe_read+0x82>
+      return 0;
+  804776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477b:	e9 1d 01 00 00       	jmp    80489d <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804780:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804787:	89 d6                	mov    %edx,%esi
+  804789:	48 89 c7             	mov    %rax,%rdi
+  80478c:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  804793:	00 00 00 
+  804796:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804798:	eb a0                	jmp    80473a <devpipe_read+0x3c>
+      break;
+  80479a:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80479b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80479f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8047a3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8047a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8047ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047af:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047b7:	48 8b 00             	mov    (%rax),%rax
+  8047ba:	48 29 c2             	sub    %rax,%rdx
+  8047bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8047c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8047c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047c9:	48 39 c2             	cmp    %rax,%rdx
+  8047cc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8047d0:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8047d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047d8:	48 8b 00             	mov    (%rax),%rax
+  8047db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047df:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8047e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047e8:	48 f7 f1             	div    %rcx
+  8047eb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8047ef:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8047f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8047f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047fb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047ff:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804803:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804807:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80480b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80480f:	48 39 c2             	cmp    %rax,%rdx
+  804812:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804816:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80481a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80481e:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804822:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804826:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80482a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80482e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804832:	48 89 ce             	mov    %rcx,%rsi
+  804835:	48 89 c7             	mov    %rax,%rdi
+  804838:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  80483f:	00 00 00 
+  804842:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804844:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804848:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80484c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804850:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804854:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804858:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80485c:	48 01 d1             	add    %rdx,%rcx
+  80485f:	48 89 c2             	mov    %rax,%rdx
+  804862:	48 89 cf             	mov    %rcx,%rdi
+  804865:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  80486c:	00 00 00 
+  80486f:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804871:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804875:	48 8b 10             	mov    (%rax),%rdx
+  804878:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80487c:	48 01 c2             	add    %rax,%rdx
+  80487f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804883:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80488a:	48 89 c7             	mov    %rax,%rdi
+  80488d:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  804894:	00 00 00 
+  804897:	ff d0                	call   *%rax
+  return n;
+  804899:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80489d:	c9                   	leave
+  80489e:	c3                   	ret
+
+000000000080489f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80489f:	55                   	push   %rbp
+  8048a0:	48 89 e5             	mov    %rsp,%rbp
+  8048a3:	48 83 ec 70          	sub    $0x70,%rsp
+  8048a7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8048ab:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8048af:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8048b3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048b7:	48 89 c7             	mov    %rax,%rdi
+  8048ba:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  8048c1:	00 00 00 
+  8048c4:	ff d0                	call   *%rax
+  8048c6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8048ca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8048ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8048d2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8048d9:	00 
+  8048da:	e9 b8 01 00 00       	jmp    804a97 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8048df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e3:	8b 40 18             	mov    0x18(%rax),%eax
+  8048e6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8048e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048ed:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8048f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048f5:	48 8b 00             	mov    (%rax),%rax
+  8048f8:	48 29 c2             	sub    %rax,%rdx
+  8048fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048ff:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804903:	48 39 c2             	cmp    %rax,%rdx
+  804906:	75 4d                	jne    804955 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804908:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80490c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804910:	48 89 d6             	mov    %rdx,%rsi
+  804913:	48 89 c7             	mov    %rax,%rdi
+  804916:	48 b8 e3 44 80 00 00 	movabs $0x8044e3,%rax
+  80491d:	00 00 00 
+  804920:	ff d0                	call   *%rax
+  804922:	85 c0                	test   %eax,%eax
+  804924:	74 0a                	je     804930 <devpipe_write+0x91>
+        return 0;
+  804926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80492b:	e9 79 01 00 00       	jmp    804aa9 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804930:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804933:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804937:	89 d6                	mov    %edx,%esi
+  804939:	48 89 c7             	mov    %rax,%rdi
+  80493c:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  804943:	00 00 00 
+  804946:	ff d0                	call   *%rax
+      m = 0;
+  804948:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80494f:	00 
+      continue;
+  804950:	e9 3a 01 00 00       	jmp    804a8f <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804955:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804959:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80495d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804965:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80496d:	48 8b 08             	mov    (%rax),%rcx
+  804970:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804974:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804978:	48 29 c1             	sub    %rax,%rcx
+  80497b:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80497f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804983:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804987:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80498b:	48 39 c2             	cmp    %rax,%rdx
+  80498e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804992:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80499a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80499e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049a2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8049a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ab:	48 f7 f1             	div    %rcx
+  8049ae:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8049b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049b6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8049ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049be:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8049c2:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8049c6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8049ca:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8049ce:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8049d2:	48 39 c2             	cmp    %rax,%rdx
+  8049d5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8049d9:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8049dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049e1:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8049e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049e9:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8049ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049f1:	48 01 d1             	add    %rdx,%rcx
+  8049f4:	48 89 c2             	mov    %rax,%rdx
+  8049f7:	48 89 cf             	mov    %rcx,%rdi
+  8049fa:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  804a01:	00 00 00 
+  804a04:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804a06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a0a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a0e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a12:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804a16:	73 4d                	jae    804a65 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a1c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a24:	48 29 c2             	sub    %rax,%rdx
+  804a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a2b:	48 01 c2             	add    %rax,%rdx
+  804a2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a36:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a3a:	48 89 c1             	mov    %rax,%rcx
+  804a3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a41:	48 01 c1             	add    %rax,%rcx
+  804a44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a48:	48 01 c1             	add    %rax,%rcx
+  804a4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a4f:	48 83 c0 20          	add    $0x20,%rax
+  804a53:	48 89 ce             	mov    %rcx,%rsi
+  804a56:	48 89 c7             	mov    %rax,%rdi
+  804a59:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  804a60:	00 00 00 
+  804a63:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a69:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a71:	48 01 c2             	add    %rax,%rdx
+  804a74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a78:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804a7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a80:	48 89 c7             	mov    %rax,%rdi
+  804a83:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  804a8a:	00 00 00 
+  804a8d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a93:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804a97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a9b:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804a9f:	0f 82 3a fe ff ff    	jb     8048df <devpipe_write+0x40>
+  }
+
+  return i;
+  804aa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804aa9:	c9                   	leave
+  804aaa:	c3                   	ret
+
+0000000000804aab <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aab:	55                   	push   %rbp
+  804aac:	48 89 e5             	mov    %rsp,%rbp
+  804aaf:	48 83 ec 40          	sub    $0x40,%rsp
+  804ab3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ab7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804aba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804abe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac2:	48 89 c7             	mov    %rax,%rdi
+  804ac5:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804acc:	00 00 00 
+  804acf:	ff d0                	call   *%rax
+  804ad1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804ad5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804adc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ae0:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804ae4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ae8:	48 89 d6             	mov    %rdx,%rsi
+  804aeb:	48 89 c7             	mov    %rax,%rdi
+  804aee:	48 b8 6d 34 80 00 00 	movabs $0x80346d,%rax
+  804af5:	00 00 00 
+  804af8:	ff d0                	call   *%rax
+  804afa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804afd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b01:	79 08                	jns    804b0b <devpipe_poll+0x60>
+    return r;
+  804b03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b06:	e9 85 00 00 00       	jmp    804b90 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804b0b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b0e:	83 e0 01             	and    $0x1,%eax
+  804b11:	85 c0                	test   %eax,%eax
+  804b13:	74 18                	je     804b2d <devpipe_poll+0x82>
+  804b15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b19:	48 8b 10             	mov    (%rax),%rdx
+  804b1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b24:	48 39 c2             	cmp    %rax,%rdx
+  804b27:	74 04                	je     804b2d <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804b29:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804b2d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b30:	83 e0 02             	and    $0x2,%eax
+  804b33:	85 c0                	test   %eax,%eax
+  804b35:	74 23                	je     804b5a <devpipe_poll+0xaf>
+  804b37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b3b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b43:	48 8b 00             	mov    (%rax),%rax
+  804b46:	48 29 c2             	sub    %rax,%rdx
+  804b49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b4d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b51:	48 39 c2             	cmp    %rax,%rdx
+  804b54:	73 04                	jae    804b5a <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804b56:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804b5a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b62:	48 89 d6             	mov    %rdx,%rsi
+  804b65:	48 89 c7             	mov    %rax,%rdi
+  804b68:	48 b8 e3 44 80 00 00 	movabs $0x8044e3,%rax
+  804b6f:	00 00 00 
+  804b72:	ff d0                	call   *%rax
+  804b74:	85 c0                	test   %eax,%eax
+  804b76:	74 04                	je     804b7c <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804b78:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804b7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b80:	75 0b                	jne    804b8d <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b86:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804b8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b90:	c9                   	leave
+  804b91:	c3                   	ret
+
+0000000000804b92 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804b92:	55                   	push   %rbp
+  804b93:	48 89 e5             	mov    %rsp,%rbp
+  804b96:	48 83 ec 20          	sub    $0x20,%rsp
+  804b9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b9e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba6:	48 89 c7             	mov    %rax,%rdi
+  804ba9:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+  804bb5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804bb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bbd:	48 ba 71 5b 80 00 00 	movabs $0x805b71,%rdx
+  804bc4:	00 00 00 
+  804bc7:	48 89 d6             	mov    %rdx,%rsi
+  804bca:	48 89 c7             	mov    %rax,%rdi
+  804bcd:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  804bd4:	00 00 00 
+  804bd7:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804bd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bdd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804be1:	89 c1                	mov    %eax,%ecx
+  804be3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804be7:	48 8b 00             	mov    (%rax),%rax
+  804bea:	89 c2                	mov    %eax,%edx
+  804bec:	89 c8                	mov    %ecx,%eax
+  804bee:	29 d0                	sub    %edx,%eax
+  804bf0:	89 c2                	mov    %eax,%edx
+  804bf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bf6:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804bfc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c00:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804c07:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804c0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c0e:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804c15:	00 00 00 
+  804c18:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c24:	c9                   	leave
+  804c25:	c3                   	ret
+
+0000000000804c26 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804c26:	55                   	push   %rbp
+  804c27:	48 89 e5             	mov    %rsp,%rbp
+  804c2a:	48 83 ec 40          	sub    $0x40,%rsp
+  804c2e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c36:	48 89 c7             	mov    %rax,%rdi
+  804c39:	48 b8 9a 29 80 00 00 	movabs $0x80299a,%rax
+  804c40:	00 00 00 
+  804c43:	ff d0                	call   *%rax
+  804c45:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804c49:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804c50:	00 
+  804c51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c55:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c5d:	48 01 d0             	add    %rdx,%rax
+  804c60:	48 83 c0 1f          	add    $0x1f,%rax
+  804c64:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c71:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c79:	48 29 d0             	sub    %rdx,%rax
+  804c7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c80:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804c84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c88:	48 89 c6             	mov    %rax,%rsi
+  804c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c90:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  804c97:	00 00 00 
+  804c9a:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ca0:	48 89 c7             	mov    %rax,%rdi
+  804ca3:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  804caa:	00 00 00 
+  804cad:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804caf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cb3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804cb7:	eb 2f                	jmp    804ce8 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804cb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cbd:	48 83 e8 01          	sub    $0x1,%rax
+  804cc1:	48 c1 e0 0c          	shl    $0xc,%rax
+  804cc5:	48 89 c2             	mov    %rax,%rdx
+  804cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ccc:	48 01 d0             	add    %rdx,%rax
+  804ccf:	48 89 c6             	mov    %rax,%rsi
+  804cd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cd7:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  804cde:	00 00 00 
+  804ce1:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804ce3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804ce8:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804ced:	77 ca                	ja     804cb9 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804cef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cf3:	48 89 c6             	mov    %rax,%rsi
+  804cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cfb:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  804d02:	00 00 00 
+  804d05:	ff d0                	call   *%rax
+}
+  804d07:	c9                   	leave
+  804d08:	c3                   	ret
+
+0000000000804d09 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804d09:	55                   	push   %rbp
+  804d0a:	48 89 e5             	mov    %rsp,%rbp
+  804d0d:	48 83 ec 08          	sub    $0x8,%rsp
+  804d11:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804d14:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d18:	75 10                	jne    804d2a <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804d1a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d21:	00 00 00 
+  804d24:	8b 00                	mov    (%rax),%eax
+  804d26:	48 98                	cltq
+  804d28:	eb 05                	jmp    804d2f <vsyscall+0x26>
+  }
+  return 0;
+  804d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d2f:	c9                   	leave
+  804d30:	c3                   	ret
+
+0000000000804d31 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804d31:	55                   	push   %rbp
+  804d32:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d3a:	48 b8 09 4d 80 00 00 	movabs $0x804d09,%rax
+  804d41:	00 00 00 
+  804d44:	ff d0                	call   *%rax
+}
+  804d46:	5d                   	pop    %rbp
+  804d47:	c3                   	ret
+
+0000000000804d48 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804d48:	55                   	push   %rbp
+  804d49:	48 89 e5             	mov    %rsp,%rbp
+  804d4c:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804d50:	0f 31                	rdtsc
+  804d52:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d55:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804d58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d5b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d5e:	48 c1 e2 20          	shl    $0x20,%rdx
+  804d62:	48 09 d0             	or     %rdx,%rax
+  804d65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804d69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804d6d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d71:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d78:	00 00 00 
+  804d7b:	8b 40 08             	mov    0x8(%rax),%eax
+  804d7e:	48 98                	cltq
+  804d80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804d84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d88:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d8d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804d91:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804da1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804da5:	48 89 d0             	mov    %rdx,%rax
+  804da8:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804db4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804db8:	48 01 c8             	add    %rcx,%rax
+}
+  804dbb:	c9                   	leave
+  804dbc:	c3                   	ret
+
+0000000000804dbd <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804dbd:	55                   	push   %rbp
+  804dbe:	48 89 e5             	mov    %rsp,%rbp
+  804dc1:	48 83 ec 20          	sub    $0x20,%rsp
+  804dc5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804dc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dcb:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804dce:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804dd2:	be 01 00 00 00       	mov    $0x1,%esi
+  804dd7:	48 89 c7             	mov    %rax,%rdi
+  804dda:	48 b8 79 20 80 00 00 	movabs $0x802079,%rax
+  804de1:	00 00 00 
+  804de4:	ff d0                	call   *%rax
+}
+  804de6:	90                   	nop
+  804de7:	c9                   	leave
+  804de8:	c3                   	ret
+
+0000000000804de9 <getchar>:
+
+int
+getchar(void) {
+  804de9:	55                   	push   %rbp
+  804dea:	48 89 e5             	mov    %rsp,%rbp
+  804ded:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804df1:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804df5:	ba 01 00 00 00       	mov    $0x1,%edx
+  804dfa:	48 89 c6             	mov    %rax,%rsi
+  804dfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e02:	48 b8 03 30 80 00 00 	movabs $0x803003,%rax
+  804e09:	00 00 00 
+  804e0c:	ff d0                	call   *%rax
+  804e0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804e11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e15:	79 05                	jns    804e1c <getchar+0x33>
+    return r;
+  804e17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e1a:	eb 14                	jmp    804e30 <getchar+0x47>
+  if (r < 1)
+  804e1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e20:	7f 07                	jg     804e29 <getchar+0x40>
+    return -E_EOF;
+  804e22:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804e27:	eb 07                	jmp    804e30 <getchar+0x47>
+  return c;
+  804e29:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804e2d:	0f b6 c0             	movzbl %al,%eax
+}
+  804e30:	c9                   	leave
+  804e31:	c3                   	ret
+
+0000000000804e32 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804e32:	55                   	push   %rbp
+  804e33:	48 89 e5             	mov    %rsp,%rbp
+  804e36:	48 83 ec 20          	sub    $0x20,%rsp
+  804e3a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804e3d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804e41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e44:	48 89 d6             	mov    %rdx,%rsi
+  804e47:	89 c7                	mov    %eax,%edi
+  804e49:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  804e50:	00 00 00 
+  804e53:	ff d0                	call   *%rax
+  804e55:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e58:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e5c:	79 05                	jns    804e63 <iscons+0x31>
+    return r;
+  804e5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e61:	eb 1a                	jmp    804e7d <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804e63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e67:	8b 10                	mov    (%rax),%edx
+  804e69:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804e70:	00 00 00 
+  804e73:	8b 00                	mov    (%rax),%eax
+  804e75:	39 c2                	cmp    %eax,%edx
+  804e77:	0f 94 c0             	sete   %al
+  804e7a:	0f b6 c0             	movzbl %al,%eax
+}
+  804e7d:	c9                   	leave
+  804e7e:	c3                   	ret
+
+0000000000804e7f <opencons>:
+
+int
+opencons(void) {
+  804e7f:	55                   	push   %rbp
+  804e80:	48 89 e5             	mov    %rsp,%rbp
+  804e83:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804e87:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804e8b:	48 89 c7             	mov    %rax,%rdi
+  804e8e:	48 b8 c5 29 80 00 00 	movabs $0x8029c5,%rax
+  804e95:	00 00 00 
+  804e98:	ff d0                	call   *%rax
+  804e9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ea1:	79 05                	jns    804ea8 <opencons+0x29>
+    return r;
+  804ea3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ea6:	eb 66                	jmp    804f0e <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804ea8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804eac:	ba 07 04 00 00       	mov    $0x407,%edx
+  804eb1:	48 89 c6             	mov    %rax,%rsi
+  804eb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804eb9:	48 b8 90 22 80 00 00 	movabs $0x802290,%rax
+  804ec0:	00 00 00 
+  804ec3:	ff d0                	call   *%rax
+  804ec5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ec8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ecc:	79 05                	jns    804ed3 <opencons+0x54>
+    return r;
+  804ece:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ed1:	eb 3b                	jmp    804f0e <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804ed3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ed7:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804ede:	00 00 00 
+  804ee1:	8b 12                	mov    (%rdx),%edx
+  804ee3:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804ee5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ee9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804ef0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ef4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804efb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804eff:	48 89 c7             	mov    %rax,%rdi
+  804f02:	48 b8 77 29 80 00 00 	movabs $0x802977,%rax
+  804f09:	00 00 00 
+  804f0c:	ff d0                	call   *%rax
+}
+  804f0e:	c9                   	leave
+  804f0f:	c3                   	ret
+
+0000000000804f10 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804f10:	55                   	push   %rbp
+  804f11:	48 89 e5             	mov    %rsp,%rbp
+  804f14:	48 83 ec 20          	sub    $0x20,%rsp
+  804f18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f1b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804f1e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804f22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f25:	48 89 d6             	mov    %rdx,%rsi
+  804f28:	89 c7                	mov    %eax,%edi
+  804f2a:	48 b8 a7 2a 80 00 00 	movabs $0x802aa7,%rax
+  804f31:	00 00 00 
+  804f34:	ff d0                	call   *%rax
+  804f36:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f39:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f3d:	79 05                	jns    804f44 <consmode+0x34>
+    return r;
+  804f3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f42:	eb 34                	jmp    804f78 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804f44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f48:	8b 10                	mov    (%rax),%edx
+  804f4a:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804f51:	00 00 00 
+  804f54:	8b 00                	mov    (%rax),%eax
+  804f56:	39 c2                	cmp    %eax,%edx
+  804f58:	74 07                	je     804f61 <consmode+0x51>
+    return -E_INVAL;
+  804f5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804f5f:	eb 17                	jmp    804f78 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804f61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f65:	8b 40 0c             	mov    0xc(%rax),%eax
+  804f68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804f6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f6f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804f72:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804f75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804f78:	c9                   	leave
+  804f79:	c3                   	ret
+
+0000000000804f7a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f7a:	55                   	push   %rbp
+  804f7b:	48 89 e5             	mov    %rsp,%rbp
+  804f7e:	48 83 ec 20          	sub    $0x20,%rsp
+  804f82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f86:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804f8a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804f8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f92:	8b 50 0c             	mov    0xc(%rax),%edx
+  804f95:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804f99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f9d:	48 89 ce             	mov    %rcx,%rsi
+  804fa0:	48 89 c7             	mov    %rax,%rdi
+  804fa3:	48 b8 ea 25 80 00 00 	movabs $0x8025ea,%rax
+  804faa:	00 00 00 
+  804fad:	ff d0                	call   *%rax
+  804faf:	48 98                	cltq
+}
+  804fb1:	c9                   	leave
+  804fb2:	c3                   	ret
+
+0000000000804fb3 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804fb3:	55                   	push   %rbp
+  804fb4:	48 89 e5             	mov    %rsp,%rbp
+  804fb7:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804fbe:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804fc5:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804fcc:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804fd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804fda:	eb 74                	jmp    805050 <devcons_write+0x9d>
+    m = n - tot;
+  804fdc:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804fe3:	89 c2                	mov    %eax,%edx
+  804fe5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fe8:	29 c2                	sub    %eax,%edx
+  804fea:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804fed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804ff0:	83 f8 7f             	cmp    $0x7f,%eax
+  804ff3:	76 07                	jbe    804ffc <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804ff5:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804ffc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804fff:	48 63 d0             	movslq %eax,%rdx
+  805002:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805005:	48 63 c8             	movslq %eax,%rcx
+  805008:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  80500f:	48 01 c1             	add    %rax,%rcx
+  805012:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805019:	48 89 ce             	mov    %rcx,%rsi
+  80501c:	48 89 c7             	mov    %rax,%rdi
+  80501f:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  805026:	00 00 00 
+  805029:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80502b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80502e:	48 63 d0             	movslq %eax,%rdx
+  805031:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805038:	48 89 d6             	mov    %rdx,%rsi
+  80503b:	48 89 c7             	mov    %rax,%rdi
+  80503e:	48 b8 79 20 80 00 00 	movabs $0x802079,%rax
+  805045:	00 00 00 
+  805048:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80504a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80504d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805050:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805053:	48 98                	cltq
+  805055:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  80505c:	0f 82 7a ff ff ff    	jb     804fdc <devcons_write+0x29>
+  }
+  return tot;
+  805062:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805065:	48 98                	cltq
+}
+  805067:	c9                   	leave
+  805068:	c3                   	ret
+
+0000000000805069 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805069:	55                   	push   %rbp
+  80506a:	48 89 e5             	mov    %rsp,%rbp
+  80506d:	48 83 ec 08          	sub    $0x8,%rsp
+  805071:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805075:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80507a:	c9                   	leave
+  80507b:	c3                   	ret
+
+000000000080507c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80507c:	55                   	push   %rbp
+  80507d:	48 89 e5             	mov    %rsp,%rbp
+  805080:	48 83 ec 10          	sub    $0x10,%rsp
+  805084:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805088:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  80508c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805090:	48 ba 7d 5b 80 00 00 	movabs $0x805b7d,%rdx
+  805097:	00 00 00 
+  80509a:	48 89 d6             	mov    %rdx,%rsi
+  80509d:	48 89 c7             	mov    %rax,%rdi
+  8050a0:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8050a7:	00 00 00 
+  8050aa:	ff d0                	call   *%rax
+  return 0;
+  8050ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050b1:	c9                   	leave
+  8050b2:	c3                   	ret
+
+00000000008050b3 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8050b3:	55                   	push   %rbp
+  8050b4:	48 89 e5             	mov    %rsp,%rbp
+  8050b7:	48 83 ec 30          	sub    $0x30,%rsp
+  8050bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050bf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8050c2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8050c6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8050cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8050d0:	83 e0 02             	and    $0x2,%eax
+  8050d3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8050d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050da:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050dd:	83 f8 01             	cmp    $0x1,%eax
+  8050e0:	75 04                	jne    8050e6 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8050e2:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8050e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8050e9:	83 e0 01             	and    $0x1,%eax
+  8050ec:	85 c0                	test   %eax,%eax
+  8050ee:	74 44                	je     805134 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8050f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8050f8:	89 c2                	mov    %eax,%edx
+  8050fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8050ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805104:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  80510b:	00 00 00 
+  80510e:	ff d0                	call   *%rax
+  805110:	83 f8 01             	cmp    $0x1,%eax
+  805113:	75 06                	jne    80511b <devcons_poll+0x68>
+      revents |= POLLIN;
+  805115:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805119:	eb 19                	jmp    805134 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80511b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80511f:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805125:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805128:	89 c2                	mov    %eax,%edx
+  80512a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80512e:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805134:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805137:	c9                   	leave
+  805138:	c3                   	ret
+
+0000000000805139 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805139:	55                   	push   %rbp
+  80513a:	48 89 e5             	mov    %rsp,%rbp
+  80513d:	48 83 ec 20          	sub    $0x20,%rsp
+  805141:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805145:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805149:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80514d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805151:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805159:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805160:	48 89 c7             	mov    %rax,%rdi
+  805163:	48 b8 71 51 80 00 00 	movabs $0x805171,%rax
+  80516a:	00 00 00 
+  80516d:	ff d0                	call   *%rax
+}
+  80516f:	c9                   	leave
+  805170:	c3                   	ret
+
+0000000000805171 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805171:	55                   	push   %rbp
+  805172:	48 89 e5             	mov    %rsp,%rbp
+  805175:	48 83 ec 30          	sub    $0x30,%rsp
+  805179:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80517d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805181:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805185:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805189:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80518e:	75 0e                	jne    80519e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805190:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805197:	00 00 00 
+  80519a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80519e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8051a3:	75 18                	jne    8051bd <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8051a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a9:	48 89 c7             	mov    %rax,%rdi
+  8051ac:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  8051b3:	00 00 00 
+  8051b6:	ff d0                	call   *%rax
+  8051b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051bb:	eb 1d                	jmp    8051da <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8051bd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8051c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051c5:	48 89 d6             	mov    %rdx,%rsi
+  8051c8:	48 89 c7             	mov    %rax,%rdi
+  8051cb:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8051d2:	00 00 00 
+  8051d5:	ff d0                	call   *%rax
+  8051d7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8051da:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051de:	79 2a                	jns    80520a <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8051e0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8051e5:	74 0a                	je     8051f1 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8051e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051eb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8051f1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8051f6:	74 0a                	je     805202 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8051f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051fc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805202:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805205:	e9 aa 00 00 00       	jmp    8052b4 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80520a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80520f:	74 36                	je     805247 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805211:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805218:	00 00 00 
+  80521b:	8b 40 04             	mov    0x4(%rax),%eax
+  80521e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805223:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80522a:	00 00 00 
+  80522d:	48 98                	cltq
+  80522f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805236:	48 01 d0             	add    %rdx,%rax
+  805239:	48 05 24 01 00 00    	add    $0x124,%rax
+  80523f:	8b 10                	mov    (%rax),%edx
+  805241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805245:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805247:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80524c:	74 36                	je     805284 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80524e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805255:	00 00 00 
+  805258:	8b 40 04             	mov    0x4(%rax),%eax
+  80525b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805260:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805267:	00 00 00 
+  80526a:	48 98                	cltq
+  80526c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805273:	48 01 d0             	add    %rdx,%rax
+  805276:	48 05 28 01 00 00    	add    $0x128,%rax
+  80527c:	8b 10                	mov    (%rax),%edx
+  80527e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805282:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805284:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80528b:	00 00 00 
+  80528e:	8b 40 04             	mov    0x4(%rax),%eax
+  805291:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805296:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80529d:	00 00 00 
+  8052a0:	48 98                	cltq
+  8052a2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8052a9:	48 01 d0             	add    %rdx,%rax
+  8052ac:	48 05 20 01 00 00    	add    $0x120,%rax
+  8052b2:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8052b4:	c9                   	leave
+  8052b5:	c3                   	ret
+
+00000000008052b6 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8052b6:	55                   	push   %rbp
+  8052b7:	48 89 e5             	mov    %rsp,%rbp
+  8052ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8052be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8052c1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8052c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8052c8:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8052cb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8052d0:	75 5e                	jne    805330 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8052d2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8052d9:	00 00 00 
+  8052dc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8052e0:	eb 4e                	jmp    805330 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8052e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8052e6:	79 3c                	jns    805324 <ipc_send+0x6e>
+  8052e8:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8052ec:	74 36                	je     805324 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8052ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052f1:	89 c1                	mov    %eax,%ecx
+  8052f3:	48 b8 88 5b 80 00 00 	movabs $0x805b88,%rax
+  8052fa:	00 00 00 
+  8052fd:	48 89 c2             	mov    %rax,%rdx
+  805300:	be 54 00 00 00       	mov    $0x54,%esi
+  805305:	48 b8 ae 5b 80 00 00 	movabs $0x805bae,%rax
+  80530c:	00 00 00 
+  80530f:	48 89 c7             	mov    %rax,%rdi
+  805312:	b8 00 00 00 00       	mov    $0x0,%eax
+  805317:	49 b8 f3 02 80 00 00 	movabs $0x8002f3,%r8
+  80531e:	00 00 00 
+  805321:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805324:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  80532b:	00 00 00 
+  80532e:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805330:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805333:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805336:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80533a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80533d:	89 c7                	mov    %eax,%edi
+  80533f:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  805346:	00 00 00 
+  805349:	ff d0                	call   *%rax
+  80534b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80534e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805352:	75 8e                	jne    8052e2 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805354:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  80535b:	00 00 00 
+  80535e:	ff d0                	call   *%rax
+}
+  805360:	90                   	nop
+  805361:	c9                   	leave
+  805362:	c3                   	ret
+
+0000000000805363 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805363:	55                   	push   %rbp
+  805364:	48 89 e5             	mov    %rsp,%rbp
+  805367:	48 83 ec 18          	sub    $0x18,%rsp
+  80536b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  80536e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805375:	eb 4d                	jmp    8053c4 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805377:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80537e:	00 00 00 
+  805381:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805384:	48 98                	cltq
+  805386:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80538d:	48 01 d0             	add    %rdx,%rax
+  805390:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805396:	8b 00                	mov    (%rax),%eax
+  805398:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80539b:	75 23                	jne    8053c0 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80539d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8053a4:	00 00 00 
+  8053a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053aa:	48 98                	cltq
+  8053ac:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8053b3:	48 01 d0             	add    %rdx,%rax
+  8053b6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8053bc:	8b 00                	mov    (%rax),%eax
+  8053be:	eb 12                	jmp    8053d2 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8053c0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8053c4:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8053cb:	7e aa                	jle    805377 <ipc_find_env+0x14>
+  return 0;
+  8053cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053d2:	c9                   	leave
+  8053d3:	c3                   	ret
+
+00000000008053d4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8053d4:	55                   	push   %rbp
+  8053d5:	48 89 e5             	mov    %rsp,%rbp
+  8053d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8053dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8053e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053e4:	48 c1 e8 27          	shr    $0x27,%rax
+  8053e8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8053ed:	48 89 c2             	mov    %rax,%rdx
+  8053f0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8053f7:	01 00 00 
+  8053fa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8053fe:	83 e0 01             	and    $0x1,%eax
+  805401:	48 85 c0             	test   %rax,%rax
+  805404:	74 63                	je     805469 <pageref+0x95>
+  805406:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80540a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80540e:	48 89 c2             	mov    %rax,%rdx
+  805411:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805418:	01 00 00 
+  80541b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80541f:	83 e0 01             	and    $0x1,%eax
+  805422:	48 85 c0             	test   %rax,%rax
+  805425:	74 42                	je     805469 <pageref+0x95>
+  805427:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80542b:	48 c1 e8 15          	shr    $0x15,%rax
+  80542f:	48 89 c2             	mov    %rax,%rdx
+  805432:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805439:	01 00 00 
+  80543c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805440:	83 e0 01             	and    $0x1,%eax
+  805443:	48 85 c0             	test   %rax,%rax
+  805446:	74 21                	je     805469 <pageref+0x95>
+  805448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80544c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805450:	48 89 c2             	mov    %rax,%rdx
+  805453:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80545a:	01 00 00 
+  80545d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805461:	83 e0 01             	and    $0x1,%eax
+  805464:	48 85 c0             	test   %rax,%rax
+  805467:	75 07                	jne    805470 <pageref+0x9c>
+    return 0;
+  805469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80546e:	eb 53                	jmp    8054c3 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805470:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805474:	48 c1 e8 0c          	shr    $0xc,%rax
+  805478:	48 89 c2             	mov    %rax,%rdx
+  80547b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805482:	01 00 00 
+  805485:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805489:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  80548d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805491:	83 e0 01             	and    $0x1,%eax
+  805494:	48 85 c0             	test   %rax,%rax
+  805497:	75 07                	jne    8054a0 <pageref+0xcc>
+    return 0;
+  805499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80549e:	eb 23                	jmp    8054c3 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8054a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8054a8:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8054af:	00 00 00 
+  8054b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8054b6:	48 01 d0             	add    %rdx,%rax
+  8054b9:	48 83 c0 08          	add    $0x8,%rax
+  8054bd:	0f b7 00             	movzwl (%rax),%eax
+  8054c0:	0f b7 c0             	movzwl %ax,%eax
+}
+  8054c3:	c9                   	leave
+  8054c4:	c3                   	ret
+  8054c5:	0f 1f 00             	nopl   (%rax)
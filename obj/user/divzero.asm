@@ -0,0 +1,8052 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 4c 00 00 00       	call   800078 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800041:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800048:	00 00 00 
+  80004b:	8b 08                	mov    (%rax),%ecx
+  80004d:	b8 39 05 00 00       	mov    $0x539,%eax
+  800052:	99                   	cltd
+  800053:	f7 f9                	idiv   %ecx
+  800055:	89 c6                	mov    %eax,%esi
+  800057:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  80005e:	00 00 00 
+  800061:	48 89 c7             	mov    %rax,%rdi
+  800064:	b8 00 00 00 00       	mov    $0x0,%eax
+  800069:	48 ba 24 02 80 00 00 	movabs $0x800224,%rdx
+  800070:	00 00 00 
+  800073:	ff d2                	call   *%rdx
+}
+  800075:	90                   	nop
+  800076:	c9                   	leave
+  800077:	c3                   	ret
+
+0000000000800078 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800078:	55                   	push   %rbp
+  800079:	48 89 e5             	mov    %rsp,%rbp
+  80007c:	48 83 ec 20          	sub    $0x20,%rsp
+  800080:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800083:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800087:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80008e:	00 00 00 
+  800091:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800095:	eb 13                	jmp    8000aa <libmain+0x32>
+    (*ctor)();
+  800097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80009b:	48 8b 10             	mov    (%rax),%rdx
+  80009e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a3:	ff d2                	call   *%rdx
+    ctor++;
+  8000a5:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000aa:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000b1:	00 00 00 
+  8000b4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000b8:	72 dd                	jb     800097 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000be:	7e 14                	jle    8000d4 <libmain+0x5c>
+    binaryname = argv[0];
+  8000c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000c4:	48 8b 00             	mov    (%rax),%rax
+  8000c7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000ce:	00 00 00 
+  8000d1:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000db:	48 89 d6             	mov    %rdx,%rsi
+  8000de:	89 c7                	mov    %eax,%edi
+  8000e0:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000e7:	00 00 00 
+  8000ea:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000ec:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+#endif
+}
+  8000f8:	90                   	nop
+  8000f9:	c9                   	leave
+  8000fa:	c3                   	ret
+
+00000000008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000ff:	48 b8 79 2a 80 00 00 	movabs $0x802a79,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80010b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800110:	48 b8 5a 1e 80 00 00 	movabs $0x801e5a,%rax
+  800117:	00 00 00 
+  80011a:	ff d0                	call   *%rax
+}
+  80011c:	90                   	nop
+  80011d:	5d                   	pop    %rbp
+  80011e:	c3                   	ret
+
+000000000080011f <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80011f:	55                   	push   %rbp
+  800120:	48 89 e5             	mov    %rsp,%rbp
+  800123:	48 83 ec 10          	sub    $0x10,%rsp
+  800127:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80012a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80012e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800132:	8b 00                	mov    (%rax),%eax
+  800134:	8d 48 01             	lea    0x1(%rax),%ecx
+  800137:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80013b:	89 0a                	mov    %ecx,(%rdx)
+  80013d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800140:	89 d1                	mov    %edx,%ecx
+  800142:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800146:	48 98                	cltq
+  800148:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80014c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800150:	8b 00                	mov    (%rax),%eax
+  800152:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800157:	75 2c                	jne    800185 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800159:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80015d:	8b 00                	mov    (%rax),%eax
+  80015f:	48 98                	cltq
+  800161:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800165:	48 83 c2 08          	add    $0x8,%rdx
+  800169:	48 89 c6             	mov    %rax,%rsi
+  80016c:	48 89 d7             	mov    %rdx,%rdi
+  80016f:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  800176:	00 00 00 
+  800179:	ff d0                	call   *%rax
+    b->idx = 0;
+  80017b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80017f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800185:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800189:	8b 40 04             	mov    0x4(%rax),%eax
+  80018c:	8d 50 01             	lea    0x1(%rax),%edx
+  80018f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800193:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800196:	90                   	nop
+  800197:	c9                   	leave
+  800198:	c3                   	ret
+
+0000000000800199 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800199:	55                   	push   %rbp
+  80019a:	48 89 e5             	mov    %rsp,%rbp
+  80019d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8001a4:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8001ab:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001b9:	00 00 00 
+  b.cnt = 0;
+  8001bc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001c3:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8001c6:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8001cd:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8001d4:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001db:	48 89 c6             	mov    %rax,%rsi
+  8001de:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  8001e5:	00 00 00 
+  8001e8:	48 89 c7             	mov    %rax,%rdi
+  8001eb:	48 b8 7e 05 80 00 00 	movabs $0x80057e,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8001f7:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8001fd:	48 98                	cltq
+  8001ff:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800206:	48 83 c2 08          	add    $0x8,%rdx
+  80020a:	48 89 c6             	mov    %rax,%rsi
+  80020d:	48 89 d7             	mov    %rdx,%rdi
+  800210:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80021c:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800222:	c9                   	leave
+  800223:	c3                   	ret
+
+0000000000800224 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800224:	55                   	push   %rbp
+  800225:	48 89 e5             	mov    %rsp,%rbp
+  800228:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80022f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800236:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80023d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800244:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80024b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800252:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800259:	84 c0                	test   %al,%al
+  80025b:	74 20                	je     80027d <cprintf+0x59>
+  80025d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800261:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800265:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800269:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80026d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800271:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800275:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800279:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80027d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800284:	00 00 00 
+  800287:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80028e:	00 00 00 
+  800291:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800295:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80029c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002a3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8002aa:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002b1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002b8:	48 89 d6             	mov    %rdx,%rsi
+  8002bb:	48 89 c7             	mov    %rax,%rdi
+  8002be:	48 b8 99 01 80 00 00 	movabs $0x800199,%rax
+  8002c5:	00 00 00 
+  8002c8:	ff d0                	call   *%rax
+  8002ca:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8002d0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8002d6:	c9                   	leave
+  8002d7:	c3                   	ret
+
+00000000008002d8 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8002d8:	55                   	push   %rbp
+  8002d9:	48 89 e5             	mov    %rsp,%rbp
+  8002dc:	48 83 ec 30          	sub    $0x30,%rsp
+  8002e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8002e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8002e8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8002ec:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8002ef:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8002f3:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8002f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002fa:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8002fe:	72 54                	jb     800354 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800300:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800303:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800306:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80030d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800312:	48 f7 f6             	div    %rsi
+  800315:	49 89 c2             	mov    %rax,%r10
+  800318:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80031b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80031e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800326:	41 89 c9             	mov    %ecx,%r9d
+  800329:	41 89 f8             	mov    %edi,%r8d
+  80032c:	89 d1                	mov    %edx,%ecx
+  80032e:	4c 89 d2             	mov    %r10,%rdx
+  800331:	48 89 c7             	mov    %rax,%rdi
+  800334:	48 b8 d8 02 80 00 00 	movabs $0x8002d8,%rax
+  80033b:	00 00 00 
+  80033e:	ff d0                	call   *%rax
+  800340:	eb 1c                	jmp    80035e <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800342:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800346:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800349:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80034d:	48 89 d6             	mov    %rdx,%rsi
+  800350:	89 c7                	mov    %eax,%edi
+  800352:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800354:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800358:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80035c:	7f e4                	jg     800342 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80035e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036a:	48 f7 f1             	div    %rcx
+  80036d:	48 b8 30 52 80 00 00 	movabs $0x805230,%rax
+  800374:	00 00 00 
+  800377:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80037b:	0f be c0             	movsbl %al,%eax
+  80037e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800382:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800386:	48 89 d6             	mov    %rdx,%rsi
+  800389:	89 c7                	mov    %eax,%edi
+  80038b:	ff d1                	call   *%rcx
+}
+  80038d:	90                   	nop
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+0000000000800390 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+  800394:	48 83 ec 10          	sub    $0x10,%rsp
+  800398:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80039c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80039f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8003a3:	7e 4b                	jle    8003f0 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8003a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003a9:	8b 00                	mov    (%rax),%eax
+  8003ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8003ae:	77 24                	ja     8003d4 <getuint+0x44>
+  8003b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003b4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003bc:	8b 00                	mov    (%rax),%eax
+  8003be:	89 c0                	mov    %eax,%eax
+  8003c0:	48 01 d0             	add    %rdx,%rax
+  8003c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c7:	8b 12                	mov    (%rdx),%edx
+  8003c9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8003cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003d0:	89 0a                	mov    %ecx,(%rdx)
+  8003d2:	eb 14                	jmp    8003e8 <getuint+0x58>
+  8003d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003dc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8003e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003e4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8003e8:	48 8b 00             	mov    (%rax),%rax
+  8003eb:	e9 95 00 00 00       	jmp    800485 <getuint+0xf5>
+  else if (lflag)
+  8003f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8003f4:	74 48                	je     80043e <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8003f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003fa:	8b 00                	mov    (%rax),%eax
+  8003fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8003ff:	77 24                	ja     800425 <getuint+0x95>
+  800401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800405:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80040d:	8b 00                	mov    (%rax),%eax
+  80040f:	89 c0                	mov    %eax,%eax
+  800411:	48 01 d0             	add    %rdx,%rax
+  800414:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800418:	8b 12                	mov    (%rdx),%edx
+  80041a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80041d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800421:	89 0a                	mov    %ecx,(%rdx)
+  800423:	eb 14                	jmp    800439 <getuint+0xa9>
+  800425:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800429:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80042d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800431:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800435:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800439:	48 8b 00             	mov    (%rax),%rax
+  80043c:	eb 47                	jmp    800485 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80043e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800442:	8b 00                	mov    (%rax),%eax
+  800444:	83 f8 2f             	cmp    $0x2f,%eax
+  800447:	77 24                	ja     80046d <getuint+0xdd>
+  800449:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80044d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800455:	8b 00                	mov    (%rax),%eax
+  800457:	89 c0                	mov    %eax,%eax
+  800459:	48 01 d0             	add    %rdx,%rax
+  80045c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800460:	8b 12                	mov    (%rdx),%edx
+  800462:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800465:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800469:	89 0a                	mov    %ecx,(%rdx)
+  80046b:	eb 14                	jmp    800481 <getuint+0xf1>
+  80046d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800471:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800475:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800479:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80047d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800481:	8b 00                	mov    (%rax),%eax
+  800483:	89 c0                	mov    %eax,%eax
+}
+  800485:	c9                   	leave
+  800486:	c3                   	ret
+
+0000000000800487 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	48 83 ec 10          	sub    $0x10,%rsp
+  80048f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800493:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800496:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80049a:	7e 4b                	jle    8004e7 <getint+0x60>
+    return va_arg(*ap, long long);
+  80049c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a0:	8b 00                	mov    (%rax),%eax
+  8004a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a5:	77 24                	ja     8004cb <getint+0x44>
+  8004a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ab:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004b3:	8b 00                	mov    (%rax),%eax
+  8004b5:	89 c0                	mov    %eax,%eax
+  8004b7:	48 01 d0             	add    %rdx,%rax
+  8004ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004be:	8b 12                	mov    (%rdx),%edx
+  8004c0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004c7:	89 0a                	mov    %ecx,(%rdx)
+  8004c9:	eb 14                	jmp    8004df <getint+0x58>
+  8004cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004d3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004db:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004df:	48 8b 00             	mov    (%rax),%rax
+  8004e2:	e9 95 00 00 00       	jmp    80057c <getint+0xf5>
+  else if (lflag)
+  8004e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004eb:	74 48                	je     800535 <getint+0xae>
+    return va_arg(*ap, long);
+  8004ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f1:	8b 00                	mov    (%rax),%eax
+  8004f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f6:	77 24                	ja     80051c <getint+0x95>
+  8004f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004fc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800500:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800504:	8b 00                	mov    (%rax),%eax
+  800506:	89 c0                	mov    %eax,%eax
+  800508:	48 01 d0             	add    %rdx,%rax
+  80050b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80050f:	8b 12                	mov    (%rdx),%edx
+  800511:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800514:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800518:	89 0a                	mov    %ecx,(%rdx)
+  80051a:	eb 14                	jmp    800530 <getint+0xa9>
+  80051c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800520:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800524:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800528:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80052c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800530:	48 8b 00             	mov    (%rax),%rax
+  800533:	eb 47                	jmp    80057c <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800535:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800539:	8b 00                	mov    (%rax),%eax
+  80053b:	83 f8 2f             	cmp    $0x2f,%eax
+  80053e:	77 24                	ja     800564 <getint+0xdd>
+  800540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800544:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800548:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054c:	8b 00                	mov    (%rax),%eax
+  80054e:	89 c0                	mov    %eax,%eax
+  800550:	48 01 d0             	add    %rdx,%rax
+  800553:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800557:	8b 12                	mov    (%rdx),%edx
+  800559:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80055c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800560:	89 0a                	mov    %ecx,(%rdx)
+  800562:	eb 14                	jmp    800578 <getint+0xf1>
+  800564:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800568:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80056c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800570:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800574:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800578:	8b 00                	mov    (%rax),%eax
+  80057a:	48 98                	cltq
+}
+  80057c:	c9                   	leave
+  80057d:	c3                   	ret
+
+000000000080057e <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80057e:	55                   	push   %rbp
+  80057f:	48 89 e5             	mov    %rsp,%rbp
+  800582:	41 54                	push   %r12
+  800584:	53                   	push   %rbx
+  800585:	48 83 ec 60          	sub    $0x60,%rsp
+  800589:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80058d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800591:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800595:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800599:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8005a1:	48 8b 06             	mov    (%rsi),%rax
+  8005a4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005a8:	48 89 01             	mov    %rax,(%rcx)
+  8005ab:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005af:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005b3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005b7:	eb 17                	jmp    8005d0 <vprintfmt+0x52>
+      if (ch == '\0')
+  8005b9:	85 db                	test   %ebx,%ebx
+  8005bb:	0f 84 bf 04 00 00    	je     800a80 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005c1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005c5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8005c9:	48 89 c6             	mov    %rax,%rsi
+  8005cc:	89 df                	mov    %ebx,%edi
+  8005ce:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005d0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8005d4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005d8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005dc:	0f b6 00             	movzbl (%rax),%eax
+  8005df:	0f b6 d8             	movzbl %al,%ebx
+  8005e2:	83 fb 25             	cmp    $0x25,%ebx
+  8005e5:	75 d2                	jne    8005b9 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8005e7:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8005eb:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8005f2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8005f9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800600:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800607:	eb 04                	jmp    80060d <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800609:	90                   	nop
+  80060a:	eb 01                	jmp    80060d <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80060c:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80060d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800611:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800615:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800619:	0f b6 00             	movzbl (%rax),%eax
+  80061c:	0f b6 d8             	movzbl %al,%ebx
+  80061f:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800622:	83 f8 55             	cmp    $0x55,%eax
+  800625:	0f 87 22 04 00 00    	ja     800a4d <vprintfmt+0x4cf>
+  80062b:	89 c0                	mov    %eax,%eax
+  80062d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800634:	00 
+  800635:	48 b8 58 52 80 00 00 	movabs $0x805258,%rax
+  80063c:	00 00 00 
+  80063f:	48 01 d0             	add    %rdx,%rax
+  800642:	48 8b 00             	mov    (%rax),%rax
+  800645:	ff e0                	jmp    *%rax
+        padc = '-';
+  800647:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80064b:	eb c0                	jmp    80060d <vprintfmt+0x8f>
+        padc = '0';
+  80064d:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800651:	eb ba                	jmp    80060d <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800653:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80065a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80065d:	89 d0                	mov    %edx,%eax
+  80065f:	c1 e0 02             	shl    $0x2,%eax
+  800662:	01 d0                	add    %edx,%eax
+  800664:	01 c0                	add    %eax,%eax
+  800666:	01 d8                	add    %ebx,%eax
+  800668:	83 e8 30             	sub    $0x30,%eax
+  80066b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80066e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800672:	0f b6 00             	movzbl (%rax),%eax
+  800675:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800678:	83 fb 2f             	cmp    $0x2f,%ebx
+  80067b:	7e 60                	jle    8006dd <vprintfmt+0x15f>
+  80067d:	83 fb 39             	cmp    $0x39,%ebx
+  800680:	7f 5b                	jg     8006dd <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800682:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800687:	eb d1                	jmp    80065a <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800689:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068c:	83 f8 2f             	cmp    $0x2f,%eax
+  80068f:	77 17                	ja     8006a8 <vprintfmt+0x12a>
+  800691:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800695:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800698:	89 d2                	mov    %edx,%edx
+  80069a:	48 01 d0             	add    %rdx,%rax
+  80069d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8006a0:	83 c2 08             	add    $0x8,%edx
+  8006a3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8006a6:	eb 0c                	jmp    8006b4 <vprintfmt+0x136>
+  8006a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8006ac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006b0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006b4:	8b 00                	mov    (%rax),%eax
+  8006b6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006b9:	eb 23                	jmp    8006de <vprintfmt+0x160>
+        if (width < 0)
+  8006bb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006bf:	0f 89 44 ff ff ff    	jns    800609 <vprintfmt+0x8b>
+          width = 0;
+  8006c5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8006cc:	e9 38 ff ff ff       	jmp    800609 <vprintfmt+0x8b>
+        altflag = 1;
+  8006d1:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8006d8:	e9 30 ff ff ff       	jmp    80060d <vprintfmt+0x8f>
+        goto process_precision;
+  8006dd:	90                   	nop
+        if (width < 0)
+  8006de:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006e2:	0f 89 24 ff ff ff    	jns    80060c <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8006e8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8006eb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8006ee:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8006f5:	e9 12 ff ff ff       	jmp    80060c <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8006fa:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8006fe:	e9 0a ff ff ff       	jmp    80060d <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800703:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800706:	83 f8 2f             	cmp    $0x2f,%eax
+  800709:	77 17                	ja     800722 <vprintfmt+0x1a4>
+  80070b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80070f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800712:	89 d2                	mov    %edx,%edx
+  800714:	48 01 d0             	add    %rdx,%rax
+  800717:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80071a:	83 c2 08             	add    $0x8,%edx
+  80071d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800720:	eb 0c                	jmp    80072e <vprintfmt+0x1b0>
+  800722:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800726:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80072a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80072e:	8b 00                	mov    (%rax),%eax
+  800730:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800734:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800738:	48 89 d6             	mov    %rdx,%rsi
+  80073b:	89 c7                	mov    %eax,%edi
+  80073d:	ff d1                	call   *%rcx
+        break;
+  80073f:	e9 37 03 00 00       	jmp    800a7b <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800744:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800747:	83 f8 2f             	cmp    $0x2f,%eax
+  80074a:	77 17                	ja     800763 <vprintfmt+0x1e5>
+  80074c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800750:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800753:	89 d2                	mov    %edx,%edx
+  800755:	48 01 d0             	add    %rdx,%rax
+  800758:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80075b:	83 c2 08             	add    $0x8,%edx
+  80075e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800761:	eb 0c                	jmp    80076f <vprintfmt+0x1f1>
+  800763:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800767:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80076b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80076f:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800771:	85 db                	test   %ebx,%ebx
+  800773:	79 02                	jns    800777 <vprintfmt+0x1f9>
+          err = -err;
+  800775:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800777:	83 fb 15             	cmp    $0x15,%ebx
+  80077a:	7f 16                	jg     800792 <vprintfmt+0x214>
+  80077c:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  800783:	00 00 00 
+  800786:	48 63 c3             	movslq %ebx,%rax
+  800789:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80078d:	4d 85 e4             	test   %r12,%r12
+  800790:	75 2e                	jne    8007c0 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800792:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800796:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80079a:	89 d9                	mov    %ebx,%ecx
+  80079c:	48 ba 41 52 80 00 00 	movabs $0x805241,%rdx
+  8007a3:	00 00 00 
+  8007a6:	48 89 c7             	mov    %rax,%rdi
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	49 b8 8a 0a 80 00 00 	movabs $0x800a8a,%r8
+  8007b5:	00 00 00 
+  8007b8:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007bb:	e9 bb 02 00 00       	jmp    800a7b <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007c0:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007c4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007c8:	4c 89 e1             	mov    %r12,%rcx
+  8007cb:	48 ba 4a 52 80 00 00 	movabs $0x80524a,%rdx
+  8007d2:	00 00 00 
+  8007d5:	48 89 c7             	mov    %rax,%rdi
+  8007d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007dd:	49 b8 8a 0a 80 00 00 	movabs $0x800a8a,%r8
+  8007e4:	00 00 00 
+  8007e7:	41 ff d0             	call   *%r8
+        break;
+  8007ea:	e9 8c 02 00 00       	jmp    800a7b <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8007ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f5:	77 17                	ja     80080e <vprintfmt+0x290>
+  8007f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007fb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007fe:	89 d2                	mov    %edx,%edx
+  800800:	48 01 d0             	add    %rdx,%rax
+  800803:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800806:	83 c2 08             	add    $0x8,%edx
+  800809:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80080c:	eb 0c                	jmp    80081a <vprintfmt+0x29c>
+  80080e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800812:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800816:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80081a:	4c 8b 20             	mov    (%rax),%r12
+  80081d:	4d 85 e4             	test   %r12,%r12
+  800820:	75 0a                	jne    80082c <vprintfmt+0x2ae>
+          p = "(null)";
+  800822:	49 bc 4d 52 80 00 00 	movabs $0x80524d,%r12
+  800829:	00 00 00 
+        if (width > 0 && padc != '-')
+  80082c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800830:	7e 78                	jle    8008aa <vprintfmt+0x32c>
+  800832:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800836:	74 72                	je     8008aa <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800838:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80083b:	48 98                	cltq
+  80083d:	48 89 c6             	mov    %rax,%rsi
+  800840:	4c 89 e7             	mov    %r12,%rdi
+  800843:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  80084a:	00 00 00 
+  80084d:	ff d0                	call   *%rax
+  80084f:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800852:	eb 17                	jmp    80086b <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800854:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800858:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80085c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800860:	48 89 d6             	mov    %rdx,%rsi
+  800863:	89 c7                	mov    %eax,%edi
+  800865:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800867:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80086b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80086f:	7f e3                	jg     800854 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800871:	eb 37                	jmp    8008aa <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800873:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800877:	74 1e                	je     800897 <vprintfmt+0x319>
+  800879:	83 fb 1f             	cmp    $0x1f,%ebx
+  80087c:	7e 05                	jle    800883 <vprintfmt+0x305>
+  80087e:	83 fb 7e             	cmp    $0x7e,%ebx
+  800881:	7e 14                	jle    800897 <vprintfmt+0x319>
+            putch('?', putdat);
+  800883:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800887:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80088b:	48 89 c6             	mov    %rax,%rsi
+  80088e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800893:	ff d2                	call   *%rdx
+  800895:	eb 0f                	jmp    8008a6 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800897:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80089b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80089f:	48 89 c6             	mov    %rax,%rsi
+  8008a2:	89 df                	mov    %ebx,%edi
+  8008a4:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008a6:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008aa:	4c 89 e0             	mov    %r12,%rax
+  8008ad:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008b1:	0f b6 00             	movzbl (%rax),%eax
+  8008b4:	0f be d8             	movsbl %al,%ebx
+  8008b7:	85 db                	test   %ebx,%ebx
+  8008b9:	74 28                	je     8008e3 <vprintfmt+0x365>
+  8008bb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008bf:	78 b2                	js     800873 <vprintfmt+0x2f5>
+  8008c1:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008c5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008c9:	79 a8                	jns    800873 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8008cb:	eb 16                	jmp    8008e3 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8008cd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008d1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008d5:	48 89 c6             	mov    %rax,%rsi
+  8008d8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008dd:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8008df:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008e3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008e7:	7f e4                	jg     8008cd <vprintfmt+0x34f>
+        break;
+  8008e9:	e9 8d 01 00 00       	jmp    800a7b <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8008ee:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8008f1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8008f5:	89 d6                	mov    %edx,%esi
+  8008f7:	48 89 c7             	mov    %rax,%rdi
+  8008fa:	48 b8 87 04 80 00 00 	movabs $0x800487,%rax
+  800901:	00 00 00 
+  800904:	ff d0                	call   *%rax
+  800906:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80090a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090e:	48 85 c0             	test   %rax,%rax
+  800911:	79 1d                	jns    800930 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800913:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800917:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80091b:	48 89 c6             	mov    %rax,%rsi
+  80091e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800923:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800925:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800929:	48 f7 d8             	neg    %rax
+  80092c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800930:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800937:	e9 d2 00 00 00       	jmp    800a0e <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80093c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80093f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800943:	89 d6                	mov    %edx,%esi
+  800945:	48 89 c7             	mov    %rax,%rdi
+  800948:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  80094f:	00 00 00 
+  800952:	ff d0                	call   *%rax
+  800954:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800958:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80095f:	e9 aa 00 00 00       	jmp    800a0e <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800964:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800967:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80096b:	89 d6                	mov    %edx,%esi
+  80096d:	48 89 c7             	mov    %rax,%rdi
+  800970:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  800977:	00 00 00 
+  80097a:	ff d0                	call   *%rax
+  80097c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800980:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800987:	e9 82 00 00 00       	jmp    800a0e <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  80098c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800990:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800994:	48 89 c6             	mov    %rax,%rsi
+  800997:	bf 30 00 00 00       	mov    $0x30,%edi
+  80099c:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80099e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009a2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009a6:	48 89 c6             	mov    %rax,%rsi
+  8009a9:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009ae:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b6:	77 17                	ja     8009cf <vprintfmt+0x451>
+  8009b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009bc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009bf:	89 d2                	mov    %edx,%edx
+  8009c1:	48 01 d0             	add    %rdx,%rax
+  8009c4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009c7:	83 c2 08             	add    $0x8,%edx
+  8009ca:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009cd:	eb 0c                	jmp    8009db <vprintfmt+0x45d>
+  8009cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009d3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009d7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009db:	48 8b 00             	mov    (%rax),%rax
+  8009de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009e2:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8009e9:	eb 23                	jmp    800a0e <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8009eb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009ee:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009f2:	89 d6                	mov    %edx,%esi
+  8009f4:	48 89 c7             	mov    %rax,%rdi
+  8009f7:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  8009fe:	00 00 00 
+  800a01:	ff d0                	call   *%rax
+  800a03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a07:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a0e:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a13:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a16:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a25:	45 89 c1             	mov    %r8d,%r9d
+  800a28:	41 89 f8             	mov    %edi,%r8d
+  800a2b:	48 89 c7             	mov    %rax,%rdi
+  800a2e:	48 b8 d8 02 80 00 00 	movabs $0x8002d8,%rax
+  800a35:	00 00 00 
+  800a38:	ff d0                	call   *%rax
+        break;
+  800a3a:	eb 3f                	jmp    800a7b <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a44:	48 89 c6             	mov    %rax,%rsi
+  800a47:	89 df                	mov    %ebx,%edi
+  800a49:	ff d2                	call   *%rdx
+        break;
+  800a4b:	eb 2e                	jmp    800a7b <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a4d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a51:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a55:	48 89 c6             	mov    %rax,%rsi
+  800a58:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a5d:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a5f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a64:	eb 05                	jmp    800a6b <vprintfmt+0x4ed>
+  800a66:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a6b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a6f:	48 83 e8 01          	sub    $0x1,%rax
+  800a73:	0f b6 00             	movzbl (%rax),%eax
+  800a76:	3c 25                	cmp    $0x25,%al
+  800a78:	75 ec                	jne    800a66 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800a7a:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a7b:	e9 50 fb ff ff       	jmp    8005d0 <vprintfmt+0x52>
+        return;
+  800a80:	90                   	nop
+    }
+  }
+}
+  800a81:	48 83 c4 60          	add    $0x60,%rsp
+  800a85:	5b                   	pop    %rbx
+  800a86:	41 5c                	pop    %r12
+  800a88:	5d                   	pop    %rbp
+  800a89:	c3                   	ret
+
+0000000000800a8a <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a8a:	55                   	push   %rbp
+  800a8b:	48 89 e5             	mov    %rsp,%rbp
+  800a8e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800a95:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a9c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800aa3:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800aaa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ab1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ab8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800abf:	84 c0                	test   %al,%al
+  800ac1:	74 20                	je     800ae3 <printfmt+0x59>
+  800ac3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ac7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800acb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800acf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ad3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ad7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800adb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800adf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ae3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800aea:	00 00 00 
+  800aed:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800af4:	00 00 00 
+  800af7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800afb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b02:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b09:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b10:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b17:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b1e:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b25:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b2c:	48 89 c7             	mov    %rax,%rdi
+  800b2f:	48 b8 7e 05 80 00 00 	movabs $0x80057e,%rax
+  800b36:	00 00 00 
+  800b39:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b3b:	90                   	nop
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+
+0000000000800b3e <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b3e:	55                   	push   %rbp
+  800b3f:	48 89 e5             	mov    %rsp,%rbp
+  800b42:	48 83 ec 10          	sub    $0x10,%rsp
+  800b46:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b49:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b51:	8b 40 10             	mov    0x10(%rax),%eax
+  800b54:	8d 50 01             	lea    0x1(%rax),%edx
+  800b57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5b:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b62:	48 8b 10             	mov    (%rax),%rdx
+  800b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b69:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b6d:	48 39 c2             	cmp    %rax,%rdx
+  800b70:	73 17                	jae    800b89 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800b72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b76:	48 8b 00             	mov    (%rax),%rax
+  800b79:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800b7d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b81:	48 89 0a             	mov    %rcx,(%rdx)
+  800b84:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b87:	88 10                	mov    %dl,(%rax)
+}
+  800b89:	90                   	nop
+  800b8a:	c9                   	leave
+  800b8b:	c3                   	ret
+
+0000000000800b8c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800b8c:	55                   	push   %rbp
+  800b8d:	48 89 e5             	mov    %rsp,%rbp
+  800b90:	48 83 ec 40          	sub    $0x40,%rsp
+  800b94:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b98:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b9b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b9f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ba3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800bab:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800bae:	48 98                	cltq
+  800bb0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800bb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb8:	48 01 d0             	add    %rdx,%rax
+  800bbb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bbf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800bc6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bcb:	74 06                	je     800bd3 <vsnprintf+0x47>
+  800bcd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bd1:	7f 07                	jg     800bda <vsnprintf+0x4e>
+    return -E_INVAL;
+  800bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd8:	eb 32                	jmp    800c0c <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800bda:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bde:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800be2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800be6:	48 89 c6             	mov    %rax,%rsi
+  800be9:	48 b8 3e 0b 80 00 00 	movabs $0x800b3e,%rax
+  800bf0:	00 00 00 
+  800bf3:	48 89 c7             	mov    %rax,%rdi
+  800bf6:	48 b8 7e 05 80 00 00 	movabs $0x80057e,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c06:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c09:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c0c:	c9                   	leave
+  800c0d:	c3                   	ret
+
+0000000000800c0e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c0e:	55                   	push   %rbp
+  800c0f:	48 89 e5             	mov    %rsp,%rbp
+  800c12:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c19:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c20:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c26:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c2d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c34:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c3b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c42:	84 c0                	test   %al,%al
+  800c44:	74 20                	je     800c66 <snprintf+0x58>
+  800c46:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c4a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c4e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c52:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c56:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c5a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c5e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c62:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c66:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800c6d:	00 00 00 
+  800c70:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c77:	00 00 00 
+  800c7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c7e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c85:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c8c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c93:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800c9a:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ca1:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ca7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800cae:	48 89 c7             	mov    %rax,%rdi
+  800cb1:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  800cb8:	00 00 00 
+  800cbb:	ff d0                	call   *%rax
+  800cbd:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cc3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cc9:	c9                   	leave
+  800cca:	c3                   	ret
+
+0000000000800ccb <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800ccb:	55                   	push   %rbp
+  800ccc:	48 89 e5             	mov    %rsp,%rbp
+  800ccf:	53                   	push   %rbx
+  800cd0:	48 83 ec 38          	sub    $0x38,%rsp
+  800cd4:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800cd7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cdb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800cdf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ce3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800ce7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cef:	89 d1                	mov    %edx,%ecx
+  800cf1:	0f a2                	cpuid
+  800cf3:	89 de                	mov    %ebx,%esi
+  800cf5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800cf8:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800cfb:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800cfe:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800d01:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d06:	74 09                	je     800d11 <cpuid+0x46>
+}
+  800d08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d0f:	89 10                	mov    %edx,(%rax)
+
+  800d11:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d16:	74 09                	je     800d21 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d1c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d1f:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d21:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d26:	74 09                	je     800d31 <cpuid+0x66>
+char *
+  800d28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d2c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d2f:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d31:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d36:	74 09                	je     800d41 <cpuid+0x76>
+  for (; *s; s++)
+  800d38:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d3c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d3f:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d41:	90                   	nop
+  800d42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d46:	c9                   	leave
+  800d47:	c3                   	ret
+
+0000000000800d48 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d48:	55                   	push   %rbp
+  800d49:	48 89 e5             	mov    %rsp,%rbp
+  800d4c:	48 83 ec 18          	sub    $0x18,%rsp
+  800d50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d56:	89 c1                	mov    %eax,%ecx
+  800d58:	0f 01 d0             	xgetbv
+  800d5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d5e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d64:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800d67:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d6b:	48 09 d0             	or     %rdx,%rax
+#else
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+0000000000800d70 <string_cpu>:
+string_cpu(void) {
+  800d70:	55                   	push   %rbp
+  800d71:	48 89 e5             	mov    %rsp,%rbp
+  800d74:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800d78:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800d7f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800d86:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d8d:	00 00 00 
+  800d90:	8b 00                	mov    (%rax),%eax
+  800d92:	85 c0                	test   %eax,%eax
+  800d94:	78 11                	js     800da7 <string_cpu+0x37>
+    return string_features;
+  800d96:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d9d:	00 00 00 
+  800da0:	8b 00                	mov    (%rax),%eax
+  800da2:	e9 df 00 00 00       	jmp    800e86 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800da7:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800dab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbb:	48 89 c6             	mov    %rax,%rsi
+  800dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc3:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800dcf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800dd2:	83 f8 06             	cmp    $0x6,%eax
+  800dd5:	76 28                	jbe    800dff <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800dd7:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800ddb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800de1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de6:	48 89 c2             	mov    %rax,%rdx
+  800de9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dee:	bf 07 00 00 00       	mov    $0x7,%edi
+  800df3:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  800dfa:	00 00 00 
+  800dfd:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800dff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e02:	25 00 02 00 00       	and    $0x200,%eax
+  800e07:	85 c0                	test   %eax,%eax
+  800e09:	74 04                	je     800e0f <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e0b:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e0f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e19:	48 89 c1             	mov    %rax,%rcx
+  800e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e21:	be 00 00 00 00       	mov    $0x0,%esi
+  800e26:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e2b:	48 b8 cb 0c 80 00 00 	movabs $0x800ccb,%rax
+  800e32:	00 00 00 
+  800e35:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e3a:	83 e0 20             	and    $0x20,%eax
+  800e3d:	85 c0                	test   %eax,%eax
+  800e3f:	74 2a                	je     800e6b <string_cpu+0xfb>
+  800e41:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e44:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	74 1e                	je     800e6b <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e52:	48 b8 48 0d 80 00 00 	movabs $0x800d48,%rax
+  800e59:	00 00 00 
+  800e5c:	ff d0                	call   *%rax
+  800e5e:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e61:	48 83 f8 06          	cmp    $0x6,%rax
+  800e65:	75 04                	jne    800e6b <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800e67:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800e6b:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800e72:	00 00 00 
+  800e75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e78:	89 02                	mov    %eax,(%rdx)
+  800e7a:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e81:	00 00 00 
+  800e84:	8b 00                	mov    (%rax),%eax
+}
+  800e86:	c9                   	leave
+  800e87:	c3                   	ret
+
+0000000000800e88 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800e88:	55                   	push   %rbp
+  800e89:	48 89 e5             	mov    %rsp,%rbp
+  800e8c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800e90:	48 83 ec 60          	sub    $0x60,%rsp
+  800e94:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800e99:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800e9e:	83 e0 1f             	and    $0x1f,%eax
+  800ea1:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800ea5:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ea9:	48 f7 d8             	neg    %rax
+  800eac:	48 89 c2             	mov    %rax,%rdx
+  800eaf:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800eb4:	48 01 d0             	add    %rdx,%rax
+  800eb7:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800ebc:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800ec0:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800ec6:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ecb:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ecf:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ed5:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ed9:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800edd:	89 c2                	mov    %eax,%edx
+  800edf:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ee3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800ee8:	89 c1                	mov    %eax,%ecx
+  800eea:	d3 e6                	shl    %cl,%esi
+  800eec:	89 f0                	mov    %esi,%eax
+  800eee:	21 d0                	and    %edx,%eax
+  800ef0:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800ef4:	eb 21                	jmp    800f17 <strlen_avx2+0x8f>
+    p += 32;
+  800ef6:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800efc:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f01:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f05:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f0b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f0f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f13:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f17:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f1c:	74 d8                	je     800ef6 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f1e:	31 c0                	xor    %eax,%eax
+  800f20:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f26:	48 63 d0             	movslq %eax,%rdx
+  800f29:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f2e:	48 01 d0             	add    %rdx,%rax
+  800f31:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f36:	c9                   	leave
+  800f37:	c3                   	ret
+
+0000000000800f38 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f38:	55                   	push   %rbp
+  800f39:	48 89 e5             	mov    %rsp,%rbp
+  800f3c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f40:	48 83 ec 40          	sub    $0x40,%rsp
+  800f44:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f49:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f4e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f53:	eb 77                	jmp    800fcc <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f55:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f5a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f5e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f62:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800f67:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f6b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f6f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f73:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800f77:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800f7c:	74 3c                	je     800fba <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800f7e:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800f82:	f7 d0                	not    %eax
+  800f84:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f88:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800f8c:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800f90:	48 63 d0             	movslq %eax,%rdx
+  800f93:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f98:	48 01 d0             	add    %rdx,%rax
+  800f9b:	0f b6 00             	movzbl (%rax),%eax
+  800f9e:	0f b6 c0             	movzbl %al,%eax
+  800fa1:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800fa5:	48 63 ca             	movslq %edx,%rcx
+  800fa8:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fad:	48 01 ca             	add    %rcx,%rdx
+  800fb0:	0f b6 12             	movzbl (%rdx),%edx
+  800fb3:	0f b6 d2             	movzbl %dl,%edx
+  800fb6:	29 d0                	sub    %edx,%eax
+  800fb8:	eb 6b                	jmp    801025 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fba:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800fc0:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800fc6:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800fcc:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800fd2:	77 81                	ja     800f55 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800fd4:	eb 42                	jmp    801018 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800fd6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fdb:	0f b6 10             	movzbl (%rax),%edx
+  800fde:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fe3:	0f b6 00             	movzbl (%rax),%eax
+  800fe6:	38 c2                	cmp    %al,%dl
+  800fe8:	74 1c                	je     801006 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800fea:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fef:	0f b6 00             	movzbl (%rax),%eax
+  800ff2:	0f b6 c8             	movzbl %al,%ecx
+  800ff5:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800ffa:	0f b6 00             	movzbl (%rax),%eax
+  800ffd:	0f b6 d0             	movzbl %al,%edx
+  801000:	89 c8                	mov    %ecx,%eax
+  801002:	29 d0                	sub    %edx,%eax
+  801004:	eb 1f                	jmp    801025 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801006:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80100c:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801012:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801018:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80101e:	75 b6                	jne    800fd6 <memcmp_avx2+0x9e>
+  return 0;
+  801020:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801025:	c9                   	leave
+  801026:	c3                   	ret
+
+0000000000801027 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801027:	55                   	push   %rbp
+  801028:	48 89 e5             	mov    %rsp,%rbp
+  80102b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80102f:	48 83 ec 60          	sub    $0x60,%rsp
+  801033:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801038:	89 f0                	mov    %esi,%eax
+  80103a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80103f:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801043:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801048:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80104c:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801051:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801057:	eb 47                	jmp    8010a0 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801059:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80105e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801062:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801066:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80106c:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801070:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801074:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801078:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80107d:	74 15                	je     801094 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80107f:	31 c0                	xor    %eax,%eax
+  801081:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801087:	48 63 d0             	movslq %eax,%rdx
+  80108a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80108f:	48 01 d0             	add    %rdx,%rax
+  801092:	eb 3d                	jmp    8010d1 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801094:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80109a:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8010a0:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8010a6:	77 b1                	ja     801059 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8010a8:	eb 0c                	jmp    8010b6 <memfind_avx2+0x8f>
+  8010aa:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010b0:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010b6:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010bc:	74 0e                	je     8010cc <memfind_avx2+0xa5>
+  8010be:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010c3:	0f b6 00             	movzbl (%rax),%eax
+  8010c6:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8010ca:	75 de                	jne    8010aa <memfind_avx2+0x83>
+  return s;
+  8010cc:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8010d1:	c9                   	leave
+  8010d2:	c3                   	ret
+
+00000000008010d3 <strlen>:
+strlen(const char *s) {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+  8010d7:	48 83 ec 40          	sub    $0x40,%rsp
+  8010db:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8010df:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8010e3:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8010e7:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  8010ee:	00 00 00 
+  8010f1:	ff d0                	call   *%rax
+  8010f3:	83 e0 02             	and    $0x2,%eax
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	74 18                	je     801112 <strlen+0x3f>
+    return strlen_avx2(s);
+  8010fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	48 b8 88 0e 80 00 00 	movabs $0x800e88,%rax
+  801108:	00 00 00 
+  80110b:	ff d0                	call   *%rax
+  80110d:	e9 82 00 00 00       	jmp    801194 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801112:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801116:	83 e0 0f             	and    $0xf,%eax
+  801119:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80111c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80111f:	48 f7 d8             	neg    %rax
+  801122:	48 89 c2             	mov    %rax,%rdx
+  801125:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801129:	48 01 d0             	add    %rdx,%rax
+  80112c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801130:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801134:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801138:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80113d:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801141:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801145:	89 c2                	mov    %eax,%edx
+  801147:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80114a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80114f:	89 c1                	mov    %eax,%ecx
+  801151:	d3 e6                	shl    %cl,%esi
+  801153:	89 f0                	mov    %esi,%eax
+  801155:	21 d0                	and    %edx,%eax
+  801157:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80115a:	eb 1d                	jmp    801179 <strlen+0xa6>
+    p += 16;
+  80115c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801161:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801165:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801169:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80116e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801172:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801176:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801179:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80117d:	74 dd                	je     80115c <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80117f:	31 c0                	xor    %eax,%eax
+  801181:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801186:	48 63 d0             	movslq %eax,%rdx
+  801189:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118d:	48 01 d0             	add    %rdx,%rax
+  801190:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801194:	c9                   	leave
+  801195:	c3                   	ret
+
+0000000000801196 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801196:	55                   	push   %rbp
+  801197:	48 89 e5             	mov    %rsp,%rbp
+  80119a:	48 83 ec 20          	sub    $0x20,%rsp
+  80119e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011ad:	eb 0e                	jmp    8011bd <strnlen+0x27>
+    n++;
+  8011af:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011b3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011b8:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011bd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011c2:	74 0b                	je     8011cf <strnlen+0x39>
+  8011c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c8:	0f b6 00             	movzbl (%rax),%eax
+  8011cb:	84 c0                	test   %al,%al
+  8011cd:	75 e0                	jne    8011af <strnlen+0x19>
+  return n;
+  8011cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+00000000008011d4 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8011d4:	55                   	push   %rbp
+  8011d5:	48 89 e5             	mov    %rsp,%rbp
+  8011d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8011dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8011e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8011ec:	90                   	nop
+  8011ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801201:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801205:	0f b6 12             	movzbl (%rdx),%edx
+  801208:	88 10                	mov    %dl,(%rax)
+  80120a:	0f b6 00             	movzbl (%rax),%eax
+  80120d:	84 c0                	test   %al,%al
+  80120f:	75 dc                	jne    8011ed <strcpy+0x19>
+  return ret;
+  801211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801215:	c9                   	leave
+  801216:	c3                   	ret
+
+0000000000801217 <strcat>:
+strcat(char *dst, const char *src) {
+  801217:	55                   	push   %rbp
+  801218:	48 89 e5             	mov    %rsp,%rbp
+  80121b:	48 83 ec 20          	sub    $0x20,%rsp
+  80121f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801223:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122b:	48 89 c7             	mov    %rax,%rdi
+  80122e:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  801235:	00 00 00 
+  801238:	ff d0                	call   *%rax
+  80123a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80123d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801240:	48 63 d0             	movslq %eax,%rdx
+  801243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801247:	48 01 c2             	add    %rax,%rdx
+  80124a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80124e:	48 89 c6             	mov    %rax,%rsi
+  801251:	48 89 d7             	mov    %rdx,%rdi
+  801254:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  80125b:	00 00 00 
+  80125e:	ff d0                	call   *%rax
+  return dst;
+  801260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801264:	c9                   	leave
+  801265:	c3                   	ret
+
+0000000000801266 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+  80126a:	48 83 ec 28          	sub    $0x28,%rsp
+  80126e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801272:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801276:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80127a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801282:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801289:	00 
+  80128a:	eb 2a                	jmp    8012b6 <strncpy+0x50>
+    *dst++ = *src;
+  80128c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801290:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801294:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801298:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80129c:	0f b6 12             	movzbl (%rdx),%edx
+  80129f:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8012a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012a5:	0f b6 00             	movzbl (%rax),%eax
+  8012a8:	84 c0                	test   %al,%al
+  8012aa:	74 05                	je     8012b1 <strncpy+0x4b>
+      src++;
+  8012ac:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012b1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ba:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012be:	72 cc                	jb     80128c <strncpy+0x26>
+  return ret;
+  8012c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012c4:	c9                   	leave
+  8012c5:	c3                   	ret
+
+00000000008012c6 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8012c6:	55                   	push   %rbp
+  8012c7:	48 89 e5             	mov    %rsp,%rbp
+  8012ca:	48 83 ec 28          	sub    $0x28,%rsp
+  8012ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012d6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8012da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8012e2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012e7:	74 3d                	je     801326 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8012e9:	eb 1d                	jmp    801308 <strlcpy+0x42>
+      *dst++ = *src++;
+  8012eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012ef:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012f3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012fb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801303:	0f b6 12             	movzbl (%rdx),%edx
+  801306:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801308:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80130d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801312:	74 0b                	je     80131f <strlcpy+0x59>
+  801314:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801318:	0f b6 00             	movzbl (%rax),%eax
+  80131b:	84 c0                	test   %al,%al
+  80131d:	75 cc                	jne    8012eb <strlcpy+0x25>
+    *dst = '\0';
+  80131f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801323:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801326:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80132a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+
+0000000000801330 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801330:	55                   	push   %rbp
+  801331:	48 89 e5             	mov    %rsp,%rbp
+  801334:	48 83 ec 30          	sub    $0x30,%rsp
+  801338:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80133c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801340:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801344:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801348:	48 89 c7             	mov    %rax,%rdi
+  80134b:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  801352:	00 00 00 
+  801355:	ff d0                	call   *%rax
+  801357:	48 98                	cltq
+  801359:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80135d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801365:	48 89 d6             	mov    %rdx,%rsi
+  801368:	48 89 c7             	mov    %rax,%rdi
+  80136b:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  801372:	00 00 00 
+  801375:	ff d0                	call   *%rax
+  801377:	48 98                	cltq
+  801379:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80137d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801381:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801385:	75 10                	jne    801397 <strlcat+0x67>
+    return maxlen + srclen;
+  801387:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80138b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138f:	48 01 d0             	add    %rdx,%rax
+  801392:	e9 86 00 00 00       	jmp    80141d <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801397:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80139b:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80139f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8013a3:	73 2b                	jae    8013d0 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8013a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013ad:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b5:	48 01 c1             	add    %rax,%rcx
+  8013b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013bc:	48 89 c6             	mov    %rax,%rsi
+  8013bf:	48 89 cf             	mov    %rcx,%rdi
+  8013c2:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  8013c9:	00 00 00 
+  8013cc:	ff d0                	call   *%rax
+  8013ce:	eb 42                	jmp    801412 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8013d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013d4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013d8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e0:	48 01 c1             	add    %rax,%rcx
+  8013e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013e7:	48 89 c6             	mov    %rax,%rsi
+  8013ea:	48 89 cf             	mov    %rcx,%rdi
+  8013ed:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  8013f4:	00 00 00 
+  8013f7:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8013f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801401:	48 01 d0             	add    %rdx,%rax
+  801404:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140c:	48 01 d0             	add    %rdx,%rax
+  80140f:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801412:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801416:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80141a:	48 01 d0             	add    %rdx,%rax
+}
+  80141d:	c9                   	leave
+  80141e:	c3                   	ret
+
+000000000080141f <strcmp>:
+strcmp(const char *p, const char *q) {
+  80141f:	55                   	push   %rbp
+  801420:	48 89 e5             	mov    %rsp,%rbp
+  801423:	48 83 ec 10          	sub    $0x10,%rsp
+  801427:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80142b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80142f:	eb 0a                	jmp    80143b <strcmp+0x1c>
+    p++, q++;
+  801431:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801436:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80143b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80143f:	0f b6 00             	movzbl (%rax),%eax
+  801442:	84 c0                	test   %al,%al
+  801444:	74 12                	je     801458 <strcmp+0x39>
+  801446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144a:	0f b6 10             	movzbl (%rax),%edx
+  80144d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801451:	0f b6 00             	movzbl (%rax),%eax
+  801454:	38 c2                	cmp    %al,%dl
+  801456:	74 d9                	je     801431 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145c:	0f b6 00             	movzbl (%rax),%eax
+  80145f:	0f b6 d0             	movzbl %al,%edx
+  801462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801466:	0f b6 00             	movzbl (%rax),%eax
+  801469:	0f b6 c0             	movzbl %al,%eax
+  80146c:	29 c2                	sub    %eax,%edx
+  80146e:	89 d0                	mov    %edx,%eax
+}
+  801470:	c9                   	leave
+  801471:	c3                   	ret
+
+0000000000801472 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801472:	55                   	push   %rbp
+  801473:	48 89 e5             	mov    %rsp,%rbp
+  801476:	48 83 ec 18          	sub    $0x18,%rsp
+  80147a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80147e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801482:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801486:	eb 0f                	jmp    801497 <strncmp+0x25>
+    n--, p++, q++;
+  801488:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80148d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801492:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801497:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80149c:	74 1d                	je     8014bb <strncmp+0x49>
+  80149e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a2:	0f b6 00             	movzbl (%rax),%eax
+  8014a5:	84 c0                	test   %al,%al
+  8014a7:	74 12                	je     8014bb <strncmp+0x49>
+  8014a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ad:	0f b6 10             	movzbl (%rax),%edx
+  8014b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b4:	0f b6 00             	movzbl (%rax),%eax
+  8014b7:	38 c2                	cmp    %al,%dl
+  8014b9:	74 cd                	je     801488 <strncmp+0x16>
+  if (n == 0)
+  8014bb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014c0:	75 07                	jne    8014c9 <strncmp+0x57>
+    return 0;
+  8014c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c7:	eb 16                	jmp    8014df <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8014c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014cd:	0f b6 00             	movzbl (%rax),%eax
+  8014d0:	0f b6 d0             	movzbl %al,%edx
+  8014d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d7:	0f b6 00             	movzbl (%rax),%eax
+  8014da:	0f b6 c0             	movzbl %al,%eax
+  8014dd:	29 c2                	sub    %eax,%edx
+}
+  8014df:	89 d0                	mov    %edx,%eax
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+
+00000000008014e3 <strchr>:
+strchr(const char *s, char c) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	48 83 ec 60          	sub    $0x60,%rsp
+  8014eb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8014ef:	89 f0                	mov    %esi,%eax
+  8014f1:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8014f4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014f8:	83 e0 0f             	and    $0xf,%eax
+  8014fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8014fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801501:	48 f7 d8             	neg    %rax
+  801504:	48 89 c2             	mov    %rax,%rdx
+  801507:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80150b:	48 01 d0             	add    %rdx,%rax
+  80150e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801512:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801516:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80151a:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80151e:	66 0f 6e c0          	movd   %eax,%xmm0
+  801522:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801526:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80152a:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80152f:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801533:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801537:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80153b:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80153f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801544:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801549:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80154d:	89 c2                	mov    %eax,%edx
+  80154f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801554:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801559:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80155d:	09 c2                	or     %eax,%edx
+  80155f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801562:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801567:	89 c1                	mov    %eax,%ecx
+  801569:	d3 e6                	shl    %cl,%esi
+  80156b:	89 f0                	mov    %esi,%eax
+  80156d:	21 d0                	and    %edx,%eax
+  80156f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801572:	eb 34                	jmp    8015a8 <strchr+0xc5>
+    p += 16;
+  801574:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801581:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801585:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80158a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80158f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801593:	89 c2                	mov    %eax,%edx
+  801595:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80159a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80159f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015a3:	09 d0                	or     %edx,%eax
+  8015a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015ac:	74 c6                	je     801574 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015ae:	31 c0                	xor    %eax,%eax
+  8015b0:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015b5:	48 98                	cltq
+  8015b7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015bf:	0f b6 00             	movzbl (%rax),%eax
+  8015c2:	84 c0                	test   %al,%al
+  8015c4:	74 06                	je     8015cc <strchr+0xe9>
+  8015c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ca:	eb 05                	jmp    8015d1 <strchr+0xee>
+  8015cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+00000000008015d3 <strfind>:
+strfind(const char *s, char c) {
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8015db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015df:	89 f0                	mov    %esi,%eax
+  8015e1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8015e4:	eb 11                	jmp    8015f7 <strfind+0x24>
+    if (*s == c)
+  8015e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ea:	0f b6 00             	movzbl (%rax),%eax
+  8015ed:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015f0:	74 12                	je     801604 <strfind+0x31>
+  for (; *s; s++)
+  8015f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fb:	0f b6 00             	movzbl (%rax),%eax
+  8015fe:	84 c0                	test   %al,%al
+  801600:	75 e4                	jne    8015e6 <strfind+0x13>
+  801602:	eb 01                	jmp    801605 <strfind+0x32>
+      break;
+  801604:	90                   	nop
+  return (char *)s;
+  801605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801609:	c9                   	leave
+  80160a:	c3                   	ret
+
+000000000080160b <memset>:
+memset(void *v, int c, size_t n) {
+  80160b:	55                   	push   %rbp
+  80160c:	48 89 e5             	mov    %rsp,%rbp
+  80160f:	48 83 ec 38          	sub    $0x38,%rsp
+  801613:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801617:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80161a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80161e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801622:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801626:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80162b:	76 41                	jbe    80166e <memset+0x63>
+  80162d:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801634:	00 00 00 
+  801637:	ff d0                	call   *%rax
+  801639:	83 e0 01             	and    $0x1,%eax
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	74 2e                	je     80166e <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801640:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801643:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801647:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80164b:	48 89 ce             	mov    %rcx,%rsi
+  80164e:	48 89 f7             	mov    %rsi,%rdi
+  801651:	48 89 d1             	mov    %rdx,%rcx
+  801654:	fc                   	cld
+  801655:	f3 aa                	rep stos %al,%es:(%rdi)
+  801657:	48 89 ca             	mov    %rcx,%rdx
+  80165a:	48 89 fe             	mov    %rdi,%rsi
+  80165d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801661:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801665:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801669:	e9 a7 00 00 00       	jmp    801715 <memset+0x10a>
+  if (n >= 8) {
+  80166e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801673:	0f 86 87 00 00 00    	jbe    801700 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801679:	eb 16                	jmp    801691 <memset+0x86>
+      *p++ = c;
+  80167b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801683:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801687:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80168a:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80168c:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801691:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801695:	83 e0 07             	and    $0x7,%eax
+  801698:	48 85 c0             	test   %rax,%rax
+  80169b:	75 de                	jne    80167b <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80169d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016a0:	0f b6 c0             	movzbl %al,%eax
+  8016a3:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016aa:	01 01 01 
+  8016ad:	48 0f af c2          	imul   %rdx,%rax
+  8016b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016b9:	48 c1 e8 03          	shr    $0x3,%rax
+  8016bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016cd:	48 89 ce             	mov    %rcx,%rsi
+  8016d0:	48 89 f7             	mov    %rsi,%rdi
+  8016d3:	48 89 d1             	mov    %rdx,%rcx
+  8016d6:	fc                   	cld
+  8016d7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016da:	48 89 ca             	mov    %rcx,%rdx
+  8016dd:	48 89 fe             	mov    %rdi,%rsi
+  8016e0:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8016e8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8016ed:	eb 11                	jmp    801700 <memset+0xf5>
+    *p++ = c;
+  8016ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016f7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016fb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016fe:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801700:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801704:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801708:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80170c:	48 85 c0             	test   %rax,%rax
+  80170f:	75 de                	jne    8016ef <memset+0xe4>
+  return v;
+  801711:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+
+0000000000801717 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+  80171b:	48 83 ec 38          	sub    $0x38,%rsp
+  80171f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801723:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801727:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80172b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80172f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801733:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801737:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80173b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801743:	0f 83 da 00 00 00    	jae    801823 <memmove+0x10c>
+  801749:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80174d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801751:	48 01 d0             	add    %rdx,%rax
+  801754:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801758:	0f 83 c5 00 00 00    	jae    801823 <memmove+0x10c>
+    s += n;
+  80175e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801762:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801766:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80176e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801773:	0f 86 94 00 00 00    	jbe    80180d <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801779:	eb 1c                	jmp    801797 <memmove+0x80>
+        *--d = *--s;
+  80177b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801780:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801785:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801789:	0f b6 10             	movzbl (%rax),%edx
+  80178c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801790:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801792:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801797:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80179b:	83 e0 07             	and    $0x7,%eax
+  80179e:	48 85 c0             	test   %rax,%rax
+  8017a1:	75 d8                	jne    80177b <memmove+0x64>
+      nq = n / 8;
+  8017a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a7:	48 c1 e8 03          	shr    $0x3,%rax
+  8017ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017af:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017b4:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017b9:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017be:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ca:	48 89 cf             	mov    %rcx,%rdi
+  8017cd:	48 89 d6             	mov    %rdx,%rsi
+  8017d0:	48 89 c1             	mov    %rax,%rcx
+  8017d3:	fd                   	std
+  8017d4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017d7:	fc                   	cld
+  8017d8:	48 89 c8             	mov    %rcx,%rax
+  8017db:	48 89 f2             	mov    %rsi,%rdx
+  8017de:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8017e2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017e6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8017ea:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8017ef:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8017f4:	eb 17                	jmp    80180d <memmove+0xf6>
+      *--d = *--s;
+  8017f6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017fb:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801804:	0f b6 10             	movzbl (%rax),%edx
+  801807:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80180d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801811:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801815:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801819:	48 85 c0             	test   %rax,%rax
+  80181c:	75 d8                	jne    8017f6 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80181e:	e9 f4 00 00 00       	jmp    801917 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801823:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801828:	76 46                	jbe    801870 <memmove+0x159>
+  80182a:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801831:	00 00 00 
+  801834:	ff d0                	call   *%rax
+  801836:	83 e0 01             	and    $0x1,%eax
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	74 33                	je     801870 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80183d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801841:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801845:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801849:	48 89 cf             	mov    %rcx,%rdi
+  80184c:	48 89 d6             	mov    %rdx,%rsi
+  80184f:	48 89 c1             	mov    %rax,%rcx
+  801852:	fc                   	cld
+  801853:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801855:	48 89 c8             	mov    %rcx,%rax
+  801858:	48 89 f2             	mov    %rsi,%rdx
+  80185b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80185f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801863:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801867:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80186b:	e9 ab 00 00 00       	jmp    80191b <memmove+0x204>
+    if (n >= 8) {
+  801870:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801875:	0f 86 8b 00 00 00    	jbe    801906 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80187b:	eb 22                	jmp    80189f <memmove+0x188>
+        *d++ = *s++;
+  80187d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801881:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801885:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801889:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801891:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801895:	0f b6 12             	movzbl (%rdx),%edx
+  801898:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80189a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80189f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a3:	83 e0 07             	and    $0x7,%eax
+  8018a6:	48 85 c0             	test   %rax,%rax
+  8018a9:	75 d2                	jne    80187d <memmove+0x166>
+      nq = n / 8;
+  8018ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018af:	48 c1 e8 03          	shr    $0x3,%rax
+  8018b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c3:	48 89 cf             	mov    %rcx,%rdi
+  8018c6:	48 89 d6             	mov    %rdx,%rsi
+  8018c9:	48 89 c1             	mov    %rax,%rcx
+  8018cc:	fc                   	cld
+  8018cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018d0:	48 89 c8             	mov    %rcx,%rax
+  8018d3:	48 89 f2             	mov    %rsi,%rdx
+  8018d6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018da:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018e2:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8018e7:	eb 1d                	jmp    801906 <memmove+0x1ef>
+      *d++ = *s++;
+  8018e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018ed:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018fd:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801901:	0f b6 12             	movzbl (%rdx),%edx
+  801904:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801906:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80190e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801912:	48 85 c0             	test   %rax,%rax
+  801915:	75 d2                	jne    8018e9 <memmove+0x1d2>
+  return dst;
+  801917:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80191b:	c9                   	leave
+  80191c:	c3                   	ret
+
+000000000080191d <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	48 83 ec 18          	sub    $0x18,%rsp
+  801925:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801929:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80192d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801931:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801935:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801939:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193d:	48 89 ce             	mov    %rcx,%rsi
+  801940:	48 89 c7             	mov    %rax,%rdi
+  801943:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  80194a:	00 00 00 
+  80194d:	ff d0                	call   *%rax
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+
+0000000000801951 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801951:	55                   	push   %rbp
+  801952:	48 89 e5             	mov    %rsp,%rbp
+  801955:	48 83 ec 40          	sub    $0x40,%rsp
+  801959:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80195d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801961:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801965:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801969:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80196d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801971:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801975:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80197a:	0f 86 a7 00 00 00    	jbe    801a27 <memcmp+0xd6>
+  801980:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801987:	00 00 00 
+  80198a:	ff d0                	call   *%rax
+  80198c:	83 e0 02             	and    $0x2,%eax
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	0f 84 90 00 00 00    	je     801a27 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801997:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80199b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80199f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a3:	48 89 ce             	mov    %rcx,%rsi
+  8019a6:	48 89 c7             	mov    %rax,%rdi
+  8019a9:	48 b8 38 0f 80 00 00 	movabs $0x800f38,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+  8019b5:	e9 c2 00 00 00       	jmp    801a7c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019be:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019c2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8019c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ca:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019ce:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8019d2:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8019d9:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8019e0:	74 36                	je     801a18 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8019e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019e5:	f7 d0                	not    %eax
+  8019e7:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8019eb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8019ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8019f1:	48 63 d0             	movslq %eax,%rdx
+  8019f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f8:	48 01 d0             	add    %rdx,%rax
+  8019fb:	0f b6 00             	movzbl (%rax),%eax
+  8019fe:	0f b6 c0             	movzbl %al,%eax
+  801a01:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801a04:	48 63 ca             	movslq %edx,%rcx
+  801a07:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a0b:	48 01 ca             	add    %rcx,%rdx
+  801a0e:	0f b6 12             	movzbl (%rdx),%edx
+  801a11:	0f b6 d2             	movzbl %dl,%edx
+  801a14:	29 d0                	sub    %edx,%eax
+  801a16:	eb 64                	jmp    801a7c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a18:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a1d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a22:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a27:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a2c:	77 8c                	ja     8019ba <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a2e:	eb 36                	jmp    801a66 <memcmp+0x115>
+    if (*s1 != *s2)
+  801a30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a34:	0f b6 10             	movzbl (%rax),%edx
+  801a37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a3b:	0f b6 00             	movzbl (%rax),%eax
+  801a3e:	38 c2                	cmp    %al,%dl
+  801a40:	74 1a                	je     801a5c <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a46:	0f b6 00             	movzbl (%rax),%eax
+  801a49:	0f b6 c8             	movzbl %al,%ecx
+  801a4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a50:	0f b6 00             	movzbl (%rax),%eax
+  801a53:	0f b6 d0             	movzbl %al,%edx
+  801a56:	89 c8                	mov    %ecx,%eax
+  801a58:	29 d0                	sub    %edx,%eax
+  801a5a:	eb 20                	jmp    801a7c <memcmp+0x12b>
+    s1++, s2++;
+  801a5c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a61:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801a66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a6a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a6e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a72:	48 85 c0             	test   %rax,%rax
+  801a75:	75 b9                	jne    801a30 <memcmp+0xdf>
+  }
+
+  return 0;
+  801a77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+0000000000801a7e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801a7e:	55                   	push   %rbp
+  801a7f:	48 89 e5             	mov    %rsp,%rbp
+  801a82:	48 83 ec 50          	sub    $0x50,%rsp
+  801a86:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801a8a:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801a8d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801a91:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a95:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a99:	48 01 d0             	add    %rdx,%rax
+  801a9c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801aa0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801aa3:	66 0f 6e c0          	movd   %eax,%xmm0
+  801aa7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801aab:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801aaf:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801ab4:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ab8:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801abd:	76 73                	jbe    801b32 <memfind+0xb4>
+  801abf:	48 b8 70 0d 80 00 00 	movabs $0x800d70,%rax
+  801ac6:	00 00 00 
+  801ac9:	ff d0                	call   *%rax
+  801acb:	83 e0 02             	and    $0x2,%eax
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	74 60                	je     801b32 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801ad2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ad5:	0f b6 c8             	movzbl %al,%ecx
+  801ad8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801adc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ae0:	89 ce                	mov    %ecx,%esi
+  801ae2:	48 89 c7             	mov    %rax,%rdi
+  801ae5:	48 b8 27 10 80 00 00 	movabs $0x801027,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+  801af1:	eb 6c                	jmp    801b5f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801af3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801af7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801afb:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801aff:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801b04:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b08:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b0c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b0f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b13:	74 13                	je     801b28 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b15:	31 c0                	xor    %eax,%eax
+  801b17:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b1c:	48 63 d0             	movslq %eax,%rdx
+  801b1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b23:	48 01 d0             	add    %rdx,%rax
+  801b26:	eb 37                	jmp    801b5f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b28:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b2d:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b32:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b37:	77 ba                	ja     801af3 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b39:	eb 13                	jmp    801b4e <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3f:	0f b6 00             	movzbl (%rax),%eax
+  801b42:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b45:	38 d0                	cmp    %dl,%al
+  801b47:	74 11                	je     801b5a <memfind+0xdc>
+  for (; s < ends; s++)
+  801b49:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b52:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b56:	72 e3                	jb     801b3b <memfind+0xbd>
+  801b58:	eb 01                	jmp    801b5b <memfind+0xdd>
+      break;
+  801b5a:	90                   	nop
+  return (void *)s;
+  801b5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b5f:	c9                   	leave
+  801b60:	c3                   	ret
+
+0000000000801b61 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b61:	55                   	push   %rbp
+  801b62:	48 89 e5             	mov    %rsp,%rbp
+  801b65:	48 83 ec 38          	sub    $0x38,%rsp
+  801b69:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b6d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b71:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801b74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801b7b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b82:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801b83:	eb 05                	jmp    801b8a <strtol+0x29>
+    s++;
+  801b85:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801b8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8e:	0f b6 00             	movzbl (%rax),%eax
+  801b91:	3c 20                	cmp    $0x20,%al
+  801b93:	74 f0                	je     801b85 <strtol+0x24>
+  801b95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b99:	0f b6 00             	movzbl (%rax),%eax
+  801b9c:	3c 09                	cmp    $0x9,%al
+  801b9e:	74 e5                	je     801b85 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801ba0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ba4:	0f b6 00             	movzbl (%rax),%eax
+  801ba7:	3c 2b                	cmp    $0x2b,%al
+  801ba9:	75 07                	jne    801bb2 <strtol+0x51>
+    s++;
+  801bab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bb0:	eb 17                	jmp    801bc9 <strtol+0x68>
+  else if (*s == '-')
+  801bb2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb6:	0f b6 00             	movzbl (%rax),%eax
+  801bb9:	3c 2d                	cmp    $0x2d,%al
+  801bbb:	75 0c                	jne    801bc9 <strtol+0x68>
+    s++, neg = 1;
+  801bbd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bc2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bc9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bcd:	74 06                	je     801bd5 <strtol+0x74>
+  801bcf:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bd3:	75 28                	jne    801bfd <strtol+0x9c>
+  801bd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd9:	0f b6 00             	movzbl (%rax),%eax
+  801bdc:	3c 30                	cmp    $0x30,%al
+  801bde:	75 1d                	jne    801bfd <strtol+0x9c>
+  801be0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be4:	48 83 c0 01          	add    $0x1,%rax
+  801be8:	0f b6 00             	movzbl (%rax),%eax
+  801beb:	3c 78                	cmp    $0x78,%al
+  801bed:	75 0e                	jne    801bfd <strtol+0x9c>
+    s += 2, base = 16;
+  801bef:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bf4:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bfb:	eb 2c                	jmp    801c29 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801bfd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c01:	75 19                	jne    801c1c <strtol+0xbb>
+  801c03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c07:	0f b6 00             	movzbl (%rax),%eax
+  801c0a:	3c 30                	cmp    $0x30,%al
+  801c0c:	75 0e                	jne    801c1c <strtol+0xbb>
+    s++, base = 8;
+  801c0e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c13:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c1a:	eb 0d                	jmp    801c29 <strtol+0xc8>
+  else if (base == 0)
+  801c1c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c20:	75 07                	jne    801c29 <strtol+0xc8>
+    base = 10;
+  801c22:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2d:	0f b6 00             	movzbl (%rax),%eax
+  801c30:	3c 2f                	cmp    $0x2f,%al
+  801c32:	7e 1d                	jle    801c51 <strtol+0xf0>
+  801c34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c38:	0f b6 00             	movzbl (%rax),%eax
+  801c3b:	3c 39                	cmp    $0x39,%al
+  801c3d:	7f 12                	jg     801c51 <strtol+0xf0>
+      dig = *s - '0';
+  801c3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c43:	0f b6 00             	movzbl (%rax),%eax
+  801c46:	0f be c0             	movsbl %al,%eax
+  801c49:	83 e8 30             	sub    $0x30,%eax
+  801c4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c4f:	eb 4e                	jmp    801c9f <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c55:	0f b6 00             	movzbl (%rax),%eax
+  801c58:	3c 60                	cmp    $0x60,%al
+  801c5a:	7e 1d                	jle    801c79 <strtol+0x118>
+  801c5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c60:	0f b6 00             	movzbl (%rax),%eax
+  801c63:	3c 7a                	cmp    $0x7a,%al
+  801c65:	7f 12                	jg     801c79 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801c67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6b:	0f b6 00             	movzbl (%rax),%eax
+  801c6e:	0f be c0             	movsbl %al,%eax
+  801c71:	83 e8 57             	sub    $0x57,%eax
+  801c74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c77:	eb 26                	jmp    801c9f <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801c79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7d:	0f b6 00             	movzbl (%rax),%eax
+  801c80:	3c 40                	cmp    $0x40,%al
+  801c82:	7e 47                	jle    801ccb <strtol+0x16a>
+  801c84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c88:	0f b6 00             	movzbl (%rax),%eax
+  801c8b:	3c 5a                	cmp    $0x5a,%al
+  801c8d:	7f 3c                	jg     801ccb <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801c8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c93:	0f b6 00             	movzbl (%rax),%eax
+  801c96:	0f be c0             	movsbl %al,%eax
+  801c99:	83 e8 37             	sub    $0x37,%eax
+  801c9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801c9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ca2:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ca5:	7d 23                	jge    801cca <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ca7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cac:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801caf:	48 98                	cltq
+  801cb1:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cb6:	48 89 c2             	mov    %rax,%rdx
+  801cb9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cbc:	48 98                	cltq
+  801cbe:	48 01 d0             	add    %rdx,%rax
+  801cc1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cc5:	e9 5f ff ff ff       	jmp    801c29 <strtol+0xc8>
+      break;
+  801cca:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801ccb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cd0:	74 0b                	je     801cdd <strtol+0x17c>
+    *endptr = (char *)s;
+  801cd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cda:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801cdd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ce1:	74 09                	je     801cec <strtol+0x18b>
+  801ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce7:	48 f7 d8             	neg    %rax
+  801cea:	eb 04                	jmp    801cf0 <strtol+0x18f>
+  801cec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+
+0000000000801cf2 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801cf2:	55                   	push   %rbp
+  801cf3:	48 89 e5             	mov    %rsp,%rbp
+  801cf6:	53                   	push   %rbx
+  801cf7:	48 83 ec 48          	sub    $0x48,%rsp
+  801cfb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cff:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d03:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d07:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d0b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d0f:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d17:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d1b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d1f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d23:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d27:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d2b:	4c 89 c3             	mov    %r8,%rbx
+  801d2e:	cd 30                	int    $0x30
+  801d30:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d34:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d39:	74 46                	je     801d81 <syscall+0x8f>
+  801d3b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d40:	7e 3f                	jle    801d81 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4a:	49 89 d0             	mov    %rdx,%r8
+  801d4d:	48 89 c1             	mov    %rax,%rcx
+  801d50:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801d57:	00 00 00 
+  801d5a:	48 89 c2             	mov    %rax,%rdx
+  801d5d:	be 22 00 00 00       	mov    $0x22,%esi
+  801d62:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801d69:	00 00 00 
+  801d6c:	48 89 c7             	mov    %rax,%rdi
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d74:	49 b9 32 4b 80 00 00 	movabs $0x804b32,%r9
+  801d7b:	00 00 00 
+  801d7e:	41 ff d1             	call   *%r9
+
+  return ret;
+  801d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d89:	c9                   	leave
+  801d8a:	c3                   	ret
+
+0000000000801d8b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d97:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d9b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da3:	48 83 ec 08          	sub    $0x8,%rsp
+  801da7:	6a 00                	push   $0x0
+  801da9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801daf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db5:	48 89 d1             	mov    %rdx,%rcx
+  801db8:	48 89 c2             	mov    %rax,%rdx
+  801dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc5:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801dcc:	00 00 00 
+  801dcf:	ff d0                	call   *%rax
+  801dd1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dd5:	90                   	nop
+  801dd6:	c9                   	leave
+  801dd7:	c3                   	ret
+
+0000000000801dd8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ddc:	48 83 ec 08          	sub    $0x8,%rsp
+  801de0:	6a 00                	push   $0x0
+  801de2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfd:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e02:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801e09:	00 00 00 
+  801e0c:	ff d0                	call   *%rax
+  801e0e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e12:	c9                   	leave
+  801e13:	c3                   	ret
+
+0000000000801e14 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e14:	55                   	push   %rbp
+  801e15:	48 89 e5             	mov    %rsp,%rbp
+  801e18:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e22:	48 98                	cltq
+  801e24:	48 83 ec 08          	sub    $0x8,%rsp
+  801e28:	6a 00                	push   $0x0
+  801e2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e3b:	48 89 c2             	mov    %rax,%rdx
+  801e3e:	be 01 00 00 00       	mov    $0x1,%esi
+  801e43:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e48:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+0000000000801e5a <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e62:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e68:	48 98                	cltq
+  801e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6e:	6a 00                	push   $0x0
+  801e70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e81:	48 89 c2             	mov    %rax,%rdx
+  801e84:	be 00 00 00 00       	mov    $0x0,%esi
+  801e89:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e8e:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e9e:	90                   	nop
+  801e9f:	c9                   	leave
+  801ea0:	c3                   	ret
+
+0000000000801ea1 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801eac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801eb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eb3:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801eb6:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ebb:	cd 30                	int    $0x30
+  801ebd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ec1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801ec5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801eca:	7e 3d                	jle    801f09 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801ecc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ed0:	49 89 c0             	mov    %rax,%r8
+  801ed3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ed8:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801edf:	00 00 00 
+  801ee2:	48 89 c2             	mov    %rax,%rdx
+  801ee5:	be 49 00 00 00       	mov    $0x49,%esi
+  801eea:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801ef1:	00 00 00 
+  801ef4:	48 89 c7             	mov    %rax,%rdi
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efc:	49 b9 32 4b 80 00 00 	movabs $0x804b32,%r9
+  801f03:	00 00 00 
+  801f06:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f09:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f0e:	75 13                	jne    801f23 <sys_env_wait+0x82>
+  801f10:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f15:	74 0c                	je     801f23 <sys_env_wait+0x82>
+    *status = st;
+  801f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f1b:	89 c2                	mov    %eax,%edx
+  801f1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f21:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+0000000000801f29 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f29:	55                   	push   %rbp
+  801f2a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f2d:	48 83 ec 08          	sub    $0x8,%rsp
+  801f31:	6a 00                	push   $0x0
+  801f33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f49:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f53:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+  801f5f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f63:	c9                   	leave
+  801f64:	c3                   	ret
+
+0000000000801f65 <sys_yield>:
+
+void
+sys_yield(void) {
+  801f65:	55                   	push   %rbp
+  801f66:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f69:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6d:	6a 00                	push   $0x0
+  801f6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f85:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f8f:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801f96:	00 00 00 
+  801f99:	ff d0                	call   *%rax
+  801f9b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f9f:	90                   	nop
+  801fa0:	c9                   	leave
+  801fa1:	c3                   	ret
+
+0000000000801fa2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801fa2:	55                   	push   %rbp
+  801fa3:	48 89 e5             	mov    %rsp,%rbp
+  801fa6:	48 83 ec 20          	sub    $0x20,%rsp
+  801faa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801fb1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fb4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fb7:	48 63 c8             	movslq %eax,%rcx
+  801fba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fc1:	48 98                	cltq
+  801fc3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fcf:	49 89 c8             	mov    %rcx,%r8
+  801fd2:	48 89 d1             	mov    %rdx,%rcx
+  801fd5:	48 89 c2             	mov    %rax,%rdx
+  801fd8:	be 01 00 00 00       	mov    $0x1,%esi
+  801fdd:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fe2:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+  801fee:	48 83 c4 10          	add    $0x10,%rsp
+  801ff2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  801ff5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801ff8:	c9                   	leave
+  801ff9:	c3                   	ret
+
+0000000000801ffa <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	48 83 ec 20          	sub    $0x20,%rsp
+  802002:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802005:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802009:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80200c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802010:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802014:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802017:	48 63 c8             	movslq %eax,%rcx
+  80201a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80201e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802021:	48 63 f0             	movslq %eax,%rsi
+  802024:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802028:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80202b:	48 98                	cltq
+  80202d:	48 83 ec 08          	sub    $0x8,%rsp
+  802031:	51                   	push   %rcx
+  802032:	49 89 f9             	mov    %rdi,%r9
+  802035:	49 89 f0             	mov    %rsi,%r8
+  802038:	48 89 d1             	mov    %rdx,%rcx
+  80203b:	48 89 c2             	mov    %rax,%rdx
+  80203e:	be 01 00 00 00       	mov    $0x1,%esi
+  802043:	bf 07 00 00 00       	mov    $0x7,%edi
+  802048:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802058:	c9                   	leave
+  802059:	c3                   	ret
+
+000000000080205a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80205a:	55                   	push   %rbp
+  80205b:	48 89 e5             	mov    %rsp,%rbp
+  80205e:	48 83 ec 10          	sub    $0x10,%rsp
+  802062:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802065:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802069:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80206d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802070:	48 98                	cltq
+  802072:	48 83 ec 08          	sub    $0x8,%rsp
+  802076:	6a 00                	push   $0x0
+  802078:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80207e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802084:	48 89 d1             	mov    %rdx,%rcx
+  802087:	48 89 c2             	mov    %rax,%rdx
+  80208a:	be 01 00 00 00       	mov    $0x1,%esi
+  80208f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802094:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a4:	c9                   	leave
+  8020a5:	c3                   	ret
+
+00000000008020a6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8020a6:	55                   	push   %rbp
+  8020a7:	48 89 e5             	mov    %rsp,%rbp
+  8020aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020b1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020b4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020b7:	48 63 d0             	movslq %eax,%rdx
+  8020ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020bd:	48 98                	cltq
+  8020bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c3:	6a 00                	push   $0x0
+  8020c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d1:	48 89 d1             	mov    %rdx,%rcx
+  8020d4:	48 89 c2             	mov    %rax,%rdx
+  8020d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8020dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020e1:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+  8020ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f1:	c9                   	leave
+  8020f2:	c3                   	ret
+
+00000000008020f3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020f3:	55                   	push   %rbp
+  8020f4:	48 89 e5             	mov    %rsp,%rbp
+  8020f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020fb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802102:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802106:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802109:	48 98                	cltq
+  80210b:	48 83 ec 08          	sub    $0x8,%rsp
+  80210f:	6a 00                	push   $0x0
+  802111:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80211d:	48 89 d1             	mov    %rdx,%rcx
+  802120:	48 89 c2             	mov    %rax,%rdx
+  802123:	be 01 00 00 00       	mov    $0x1,%esi
+  802128:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80212d:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+  802139:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+
+000000000080213f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	48 83 ec 10          	sub    $0x10,%rsp
+  802147:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80214a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80214e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802152:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802155:	48 98                	cltq
+  802157:	48 83 ec 08          	sub    $0x8,%rsp
+  80215b:	6a 00                	push   $0x0
+  80215d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802163:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802169:	48 89 d1             	mov    %rdx,%rcx
+  80216c:	48 89 c2             	mov    %rax,%rdx
+  80216f:	be 01 00 00 00       	mov    $0x1,%esi
+  802174:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802179:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+  802185:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802189:	c9                   	leave
+  80218a:	c3                   	ret
+
+000000000080218b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80218b:	55                   	push   %rbp
+  80218c:	48 89 e5             	mov    %rsp,%rbp
+  80218f:	48 83 ec 20          	sub    $0x20,%rsp
+  802193:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802196:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80219a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80219e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8021a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021a4:	48 63 f0             	movslq %eax,%rsi
+  8021a7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021b2:	48 98                	cltq
+  8021b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b8:	6a 00                	push   $0x0
+  8021ba:	49 89 f1             	mov    %rsi,%r9
+  8021bd:	49 89 c8             	mov    %rcx,%r8
+  8021c0:	48 89 d1             	mov    %rdx,%rcx
+  8021c3:	48 89 c2             	mov    %rax,%rdx
+  8021c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cb:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8021d0:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8021d7:	00 00 00 
+  8021da:	ff d0                	call   *%rax
+  8021dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e0:	c9                   	leave
+  8021e1:	c3                   	ret
+
+00000000008021e2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8021e2:	55                   	push   %rbp
+  8021e3:	48 89 e5             	mov    %rsp,%rbp
+  8021e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8021ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f6:	6a 00                	push   $0x0
+  8021f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802204:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802209:	48 89 c2             	mov    %rax,%rdx
+  80220c:	be 01 00 00 00       	mov    $0x1,%esi
+  802211:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802216:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+  802222:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802226:	c9                   	leave
+  802227:	c3                   	ret
+
+0000000000802228 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802228:	55                   	push   %rbp
+  802229:	48 89 e5             	mov    %rsp,%rbp
+  80222c:	48 83 ec 10          	sub    $0x10,%rsp
+  802230:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802234:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802238:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80223c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802240:	48 83 ec 08          	sub    $0x8,%rsp
+  802244:	6a 00                	push   $0x0
+  802246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802252:	48 89 d1             	mov    %rdx,%rcx
+  802255:	48 89 c2             	mov    %rax,%rdx
+  802258:	be 01 00 00 00       	mov    $0x1,%esi
+  80225d:	bf 10 00 00 00       	mov    $0x10,%edi
+  802262:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802269:	00 00 00 
+  80226c:	ff d0                	call   *%rax
+  80226e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802272:	c9                   	leave
+  802273:	c3                   	ret
+
+0000000000802274 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802274:	55                   	push   %rbp
+  802275:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802278:	48 83 ec 08          	sub    $0x8,%rsp
+  80227c:	6a 00                	push   $0x0
+  80227e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802284:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802294:	be 00 00 00 00       	mov    $0x0,%esi
+  802299:	bf 11 00 00 00       	mov    $0x11,%edi
+  80229e:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8022a5:	00 00 00 
+  8022a8:	ff d0                	call   *%rax
+  8022aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ae:	c9                   	leave
+  8022af:	c3                   	ret
+
+00000000008022b0 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022b0:	55                   	push   %rbp
+  8022b1:	48 89 e5             	mov    %rsp,%rbp
+  8022b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cc:	6a 00                	push   $0x0
+  8022ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022da:	48 89 d1             	mov    %rdx,%rcx
+  8022dd:	48 89 c2             	mov    %rax,%rdx
+  8022e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e5:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022ea:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8022f1:	00 00 00 
+  8022f4:	ff d0                	call   *%rax
+  8022f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+
+00000000008022fc <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8022fc:	55                   	push   %rbp
+  8022fd:	48 89 e5             	mov    %rsp,%rbp
+  802300:	48 83 ec 20          	sub    $0x20,%rsp
+  802304:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802308:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80230c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80230f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802312:	48 63 c8             	movslq %eax,%rcx
+  802315:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802319:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231d:	48 83 ec 08          	sub    $0x8,%rsp
+  802321:	6a 00                	push   $0x0
+  802323:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802329:	49 89 c8             	mov    %rcx,%r8
+  80232c:	48 89 d1             	mov    %rdx,%rcx
+  80232f:	48 89 c2             	mov    %rax,%rdx
+  802332:	be 00 00 00 00       	mov    $0x0,%esi
+  802337:	bf 13 00 00 00       	mov    $0x13,%edi
+  80233c:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+  802348:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234c:	c9                   	leave
+  80234d:	c3                   	ret
+
+000000000080234e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	48 83 ec 20          	sub    $0x20,%rsp
+  802356:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80235a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80235d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802361:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802365:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80236c:	48 83 ec 08          	sub    $0x8,%rsp
+  802370:	6a 00                	push   $0x0
+  802372:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802378:	49 89 c8             	mov    %rcx,%r8
+  80237b:	48 89 d1             	mov    %rdx,%rcx
+  80237e:	48 89 c2             	mov    %rax,%rdx
+  802381:	be 00 00 00 00       	mov    $0x0,%esi
+  802386:	bf 14 00 00 00       	mov    $0x14,%edi
+  80238b:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+  802397:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80239b:	c9                   	leave
+  80239c:	c3                   	ret
+
+000000000080239d <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80239d:	55                   	push   %rbp
+  80239e:	48 89 e5             	mov    %rsp,%rbp
+  8023a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8023ac:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023af:	48 63 d0             	movslq %eax,%rdx
+  8023b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ba:	6a 00                	push   $0x0
+  8023bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c8:	48 89 d1             	mov    %rdx,%rcx
+  8023cb:	48 89 c2             	mov    %rax,%rdx
+  8023ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d3:	bf 15 00 00 00       	mov    $0x15,%edi
+  8023d8:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+  8023e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+00000000008023ea <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+  8023ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8023f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023f6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023f9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8023fc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802400:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802404:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802407:	48 63 c8             	movslq %eax,%rcx
+  80240a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80240d:	48 63 d0             	movslq %eax,%rdx
+  802410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802414:	48 83 ec 08          	sub    $0x8,%rsp
+  802418:	6a 00                	push   $0x0
+  80241a:	49 89 f1             	mov    %rsi,%r9
+  80241d:	49 89 c8             	mov    %rcx,%r8
+  802420:	48 89 d1             	mov    %rdx,%rcx
+  802423:	48 89 c2             	mov    %rax,%rdx
+  802426:	be 00 00 00 00       	mov    $0x0,%esi
+  80242b:	bf 16 00 00 00       	mov    $0x16,%edi
+  802430:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802440:	c9                   	leave
+  802441:	c3                   	ret
+
+0000000000802442 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802442:	55                   	push   %rbp
+  802443:	48 89 e5             	mov    %rsp,%rbp
+  802446:	48 83 ec 30          	sub    $0x30,%rsp
+  80244a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80244e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802452:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802456:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80245a:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80245e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802462:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802466:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80246a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80246e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802472:	48 83 ec 08          	sub    $0x8,%rsp
+  802476:	51                   	push   %rcx
+  802477:	49 89 f9             	mov    %rdi,%r9
+  80247a:	49 89 f0             	mov    %rsi,%r8
+  80247d:	48 89 d1             	mov    %rdx,%rcx
+  802480:	48 89 c2             	mov    %rax,%rdx
+  802483:	be 00 00 00 00       	mov    $0x0,%esi
+  802488:	bf 17 00 00 00       	mov    $0x17,%edi
+  80248d:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+  802499:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249d:	c9                   	leave
+  80249e:	c3                   	ret
+
+000000000080249f <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  8024a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8024aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ad:	48 98                	cltq
+  8024af:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b3:	6a 00                	push   $0x0
+  8024b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c6:	48 89 c2             	mov    %rax,%rdx
+  8024c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ce:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024d3:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+  8024df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e3:	90                   	nop
+  8024e4:	c9                   	leave
+  8024e5:	c3                   	ret
+
+00000000008024e6 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8024e6:	55                   	push   %rbp
+  8024e7:	48 89 e5             	mov    %rsp,%rbp
+  8024ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8024ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024f9:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8024fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024ff:	48 63 f0             	movslq %eax,%rsi
+  802502:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802506:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80250a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80250d:	48 98                	cltq
+  80250f:	48 83 ec 08          	sub    $0x8,%rsp
+  802513:	6a 00                	push   $0x0
+  802515:	49 89 f1             	mov    %rsi,%r9
+  802518:	49 89 c8             	mov    %rcx,%r8
+  80251b:	48 89 d1             	mov    %rdx,%rcx
+  80251e:	48 89 c2             	mov    %rax,%rdx
+  802521:	be 01 00 00 00       	mov    $0x1,%esi
+  802526:	bf 19 00 00 00       	mov    $0x19,%edi
+  80252b:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	48 83 c4 10          	add    $0x10,%rsp
+  80253b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80253e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802541:	c9                   	leave
+  802542:	c3                   	ret
+
+0000000000802543 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802543:	55                   	push   %rbp
+  802544:	48 89 e5             	mov    %rsp,%rbp
+  802547:	48 83 ec 20          	sub    $0x20,%rsp
+  80254b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80254f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802553:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802559:	48 63 c8             	movslq %eax,%rcx
+  80255c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802560:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802564:	48 83 ec 08          	sub    $0x8,%rsp
+  802568:	6a 00                	push   $0x0
+  80256a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802570:	49 89 c8             	mov    %rcx,%r8
+  802573:	48 89 d1             	mov    %rdx,%rcx
+  802576:	48 89 c2             	mov    %rax,%rdx
+  802579:	be 01 00 00 00       	mov    $0x1,%esi
+  80257e:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802583:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+  80258f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802593:	c9                   	leave
+  802594:	c3                   	ret
+
+0000000000802595 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802595:	55                   	push   %rbp
+  802596:	48 89 e5             	mov    %rsp,%rbp
+  802599:	48 83 ec 20          	sub    $0x20,%rsp
+  80259d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8025a9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025ad:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b9:	6a 00                	push   $0x0
+  8025bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c1:	49 89 c8             	mov    %rcx,%r8
+  8025c4:	48 89 d1             	mov    %rdx,%rcx
+  8025c7:	48 89 c2             	mov    %rax,%rdx
+  8025ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8025cf:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8025d4:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  8025db:	00 00 00 
+  8025de:	ff d0                	call   *%rax
+  8025e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+00000000008025e6 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8025e6:	55                   	push   %rbp
+  8025e7:	48 89 e5             	mov    %rsp,%rbp
+  8025ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025f6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8025f9:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8025fd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802601:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802604:	48 63 c8             	movslq %eax,%rcx
+  802607:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80260b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260f:	48 83 ec 08          	sub    $0x8,%rsp
+  802613:	6a 00                	push   $0x0
+  802615:	49 89 f1             	mov    %rsi,%r9
+  802618:	49 89 c8             	mov    %rcx,%r8
+  80261b:	48 89 d1             	mov    %rdx,%rcx
+  80261e:	48 89 c2             	mov    %rax,%rdx
+  802621:	be 01 00 00 00       	mov    $0x1,%esi
+  802626:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80262b:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  802637:	48 83 c4 10          	add    $0x10,%rsp
+  80263b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80263e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802641:	c9                   	leave
+  802642:	c3                   	ret
+
+0000000000802643 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802643:	55                   	push   %rbp
+  802644:	48 89 e5             	mov    %rsp,%rbp
+  802647:	48 83 ec 10          	sub    $0x10,%rsp
+  80264b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80264e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802651:	48 98                	cltq
+  802653:	48 83 ec 08          	sub    $0x8,%rsp
+  802657:	6a 00                	push   $0x0
+  802659:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266a:	48 89 c2             	mov    %rax,%rdx
+  80266d:	be 01 00 00 00       	mov    $0x1,%esi
+  802672:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802677:	48 b8 f2 1c 80 00 00 	movabs $0x801cf2,%rax
+  80267e:	00 00 00 
+  802681:	ff d0                	call   *%rax
+  802683:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802687:	c9                   	leave
+  802688:	c3                   	ret
+
+0000000000802689 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802689:	55                   	push   %rbp
+  80268a:	48 89 e5             	mov    %rsp,%rbp
+  80268d:	48 83 ec 08          	sub    $0x8,%rsp
+  802691:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802699:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8026a0:	ff ff ff 
+  8026a3:	48 01 d0             	add    %rdx,%rax
+  8026a6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026aa:	c9                   	leave
+  8026ab:	c3                   	ret
+
+00000000008026ac <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8026ac:	55                   	push   %rbp
+  8026ad:	48 89 e5             	mov    %rsp,%rbp
+  8026b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026bc:	48 89 c7             	mov    %rax,%rdi
+  8026bf:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+  8026cb:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8026d1:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+
+00000000008026d7 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8026d7:	55                   	push   %rbp
+  8026d8:	48 89 e5             	mov    %rsp,%rbp
+  8026db:	48 83 ec 18          	sub    $0x18,%rsp
+  8026df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8026e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026ea:	e9 ae 00 00 00       	jmp    80279d <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8026ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026f2:	c1 e0 0c             	shl    $0xc,%eax
+  8026f5:	48 98                	cltq
+  8026f7:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026fc:	48 01 d0             	add    %rdx,%rax
+  8026ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802707:	48 c1 e8 27          	shr    $0x27,%rax
+  80270b:	48 89 c2             	mov    %rax,%rdx
+  80270e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802715:	01 00 00 
+  802718:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80271c:	83 e0 01             	and    $0x1,%eax
+  80271f:	48 85 c0             	test   %rax,%rax
+  802722:	74 63                	je     802787 <fd_alloc+0xb0>
+  802724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802728:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80272c:	48 89 c2             	mov    %rax,%rdx
+  80272f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802736:	01 00 00 
+  802739:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80273d:	83 e0 01             	and    $0x1,%eax
+  802740:	48 85 c0             	test   %rax,%rax
+  802743:	74 42                	je     802787 <fd_alloc+0xb0>
+  802745:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802749:	48 c1 e8 15          	shr    $0x15,%rax
+  80274d:	48 89 c2             	mov    %rax,%rdx
+  802750:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802757:	01 00 00 
+  80275a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80275e:	83 e0 01             	and    $0x1,%eax
+  802761:	48 85 c0             	test   %rax,%rax
+  802764:	74 21                	je     802787 <fd_alloc+0xb0>
+  802766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80276a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80276e:	48 89 c2             	mov    %rax,%rdx
+  802771:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802778:	01 00 00 
+  80277b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80277f:	83 e0 01             	and    $0x1,%eax
+  802782:	48 85 c0             	test   %rax,%rax
+  802785:	75 12                	jne    802799 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80278b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80278f:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	eb 1e                	jmp    8027b7 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802799:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80279d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8027a1:	0f 8e 48 ff ff ff    	jle    8026ef <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8027a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ab:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027b2:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027b7:	c9                   	leave
+  8027b8:	c3                   	ret
+
+00000000008027b9 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027b9:	55                   	push   %rbp
+  8027ba:	48 89 e5             	mov    %rsp,%rbp
+  8027bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8027c1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027c4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8027c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027cc:	78 06                	js     8027d4 <fd_lookup+0x1b>
+  8027ce:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8027d2:	7e 0a                	jle    8027de <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8027d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d9:	e9 af 00 00 00       	jmp    80288d <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8027de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027e1:	c1 e0 0c             	shl    $0xc,%eax
+  8027e4:	48 98                	cltq
+  8027e6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027eb:	48 01 d0             	add    %rdx,%rax
+  8027ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8027f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f6:	48 c1 e8 27          	shr    $0x27,%rax
+  8027fa:	48 89 c2             	mov    %rax,%rdx
+  8027fd:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802804:	01 00 00 
+  802807:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80280b:	83 e0 01             	and    $0x1,%eax
+  80280e:	48 85 c0             	test   %rax,%rax
+  802811:	74 63                	je     802876 <fd_lookup+0xbd>
+  802813:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802817:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80281b:	48 89 c2             	mov    %rax,%rdx
+  80281e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802825:	01 00 00 
+  802828:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80282c:	83 e0 01             	and    $0x1,%eax
+  80282f:	48 85 c0             	test   %rax,%rax
+  802832:	74 42                	je     802876 <fd_lookup+0xbd>
+  802834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802838:	48 c1 e8 15          	shr    $0x15,%rax
+  80283c:	48 89 c2             	mov    %rax,%rdx
+  80283f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802846:	01 00 00 
+  802849:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80284d:	83 e0 01             	and    $0x1,%eax
+  802850:	48 85 c0             	test   %rax,%rax
+  802853:	74 21                	je     802876 <fd_lookup+0xbd>
+  802855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802859:	48 c1 e8 0c          	shr    $0xc,%rax
+  80285d:	48 89 c2             	mov    %rax,%rdx
+  802860:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802867:	01 00 00 
+  80286a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80286e:	83 e0 01             	and    $0x1,%eax
+  802871:	48 85 c0             	test   %rax,%rax
+  802874:	75 07                	jne    80287d <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802876:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80287b:	eb 10                	jmp    80288d <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80287d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802881:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802885:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288d:	c9                   	leave
+  80288e:	c3                   	ret
+
+000000000080288f <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80288f:	55                   	push   %rbp
+  802890:	48 89 e5             	mov    %rsp,%rbp
+  802893:	48 83 ec 30          	sub    $0x30,%rsp
+  802897:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80289b:	89 f0                	mov    %esi,%eax
+  80289d:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8028a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a4:	48 89 c7             	mov    %rax,%rdi
+  8028a7:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  8028ae:	00 00 00 
+  8028b1:	ff d0                	call   *%rax
+  8028b3:	89 c2                	mov    %eax,%edx
+  8028b5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028b9:	48 89 c6             	mov    %rax,%rsi
+  8028bc:	89 d7                	mov    %edx,%edi
+  8028be:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  8028c5:	00 00 00 
+  8028c8:	ff d0                	call   *%rax
+  8028ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028d1:	78 0a                	js     8028dd <fd_close+0x4e>
+  8028d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d7:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8028db:	74 12                	je     8028ef <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8028dd:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8028e1:	74 05                	je     8028e8 <fd_close+0x59>
+  8028e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028e6:	eb 70                	jmp    802958 <fd_close+0xc9>
+  8028e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ed:	eb 69                	jmp    802958 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028f3:	8b 00                	mov    (%rax),%eax
+  8028f5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028f9:	48 89 d6             	mov    %rdx,%rsi
+  8028fc:	89 c7                	mov    %eax,%edi
+  8028fe:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80290d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802911:	78 2a                	js     80293d <fd_close+0xae>
+    if (dev->dev_close)
+  802913:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802917:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80291b:	48 85 c0             	test   %rax,%rax
+  80291e:	74 16                	je     802936 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802920:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802924:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802928:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80292c:	48 89 c7             	mov    %rax,%rdi
+  80292f:	ff d2                	call   *%rdx
+  802931:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802934:	eb 07                	jmp    80293d <fd_close+0xae>
+    else
+      r = 0;
+  802936:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80293d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802941:	48 89 c6             	mov    %rax,%rsi
+  802944:	bf 00 00 00 00       	mov    $0x0,%edi
+  802949:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+  return r;
+  802955:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+000000000080295a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80295a:	55                   	push   %rbp
+  80295b:	48 89 e5             	mov    %rsp,%rbp
+  80295e:	48 83 ec 20          	sub    $0x20,%rsp
+  802962:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802965:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802969:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802970:	eb 3f                	jmp    8029b1 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802972:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802979:	00 00 00 
+  80297c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80297f:	48 98                	cltq
+  802981:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802985:	8b 00                	mov    (%rax),%eax
+  802987:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80298a:	75 21                	jne    8029ad <dev_lookup+0x53>
+      *dev = devtab[i];
+  80298c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802993:	00 00 00 
+  802996:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802999:	48 98                	cltq
+  80299b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80299f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029a3:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	eb 7f                	jmp    802a2c <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029ad:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029b1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029b8:	00 00 00 
+  8029bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029be:	48 98                	cltq
+  8029c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029c4:	48 85 c0             	test   %rax,%rax
+  8029c7:	75 a9                	jne    802972 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8029c9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8029d0:	00 00 00 
+  8029d3:	8b 40 04             	mov    0x4(%rax),%eax
+  8029d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029db:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029e2:	00 00 00 
+  8029e5:	48 98                	cltq
+  8029e7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029ee:	48 01 d0             	add    %rdx,%rax
+  8029f1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029f7:	8b 00                	mov    (%rax),%eax
+  8029f9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029fc:	89 c6                	mov    %eax,%esi
+  8029fe:	48 b8 38 55 80 00 00 	movabs $0x805538,%rax
+  802a05:	00 00 00 
+  802a08:	48 89 c7             	mov    %rax,%rdi
+  802a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a10:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  802a17:	00 00 00 
+  802a1a:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a20:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+
+0000000000802a2e <close>:
+
+int
+close(int fdnum) {
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	48 83 ec 20          	sub    $0x20,%rsp
+  802a36:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a39:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a40:	48 89 d6             	mov    %rdx,%rsi
+  802a43:	89 c7                	mov    %eax,%edi
+  802a45:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802a4c:	00 00 00 
+  802a4f:	ff d0                	call   *%rax
+  802a51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a58:	79 05                	jns    802a5f <close+0x31>
+    return r;
+  802a5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a5d:	eb 18                	jmp    802a77 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a63:	be 01 00 00 00       	mov    $0x1,%esi
+  802a68:	48 89 c7             	mov    %rax,%rdi
+  802a6b:	48 b8 8f 28 80 00 00 	movabs $0x80288f,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+0000000000802a79 <close_all>:
+
+void
+close_all(void) {
+  802a79:	55                   	push   %rbp
+  802a7a:	48 89 e5             	mov    %rsp,%rbp
+  802a7d:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802a81:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a88:	eb 15                	jmp    802a9f <close_all+0x26>
+    close(i);
+  802a8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a8d:	89 c7                	mov    %eax,%edi
+  802a8f:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802a9b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a9f:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802aa3:	7e e5                	jle    802a8a <close_all+0x11>
+}
+  802aa5:	90                   	nop
+  802aa6:	90                   	nop
+  802aa7:	c9                   	leave
+  802aa8:	c3                   	ret
+
+0000000000802aa9 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802aa9:	55                   	push   %rbp
+  802aaa:	48 89 e5             	mov    %rsp,%rbp
+  802aad:	48 83 ec 40          	sub    $0x40,%rsp
+  802ab1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802ab4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802ab7:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802abb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802abe:	48 89 d6             	mov    %rdx,%rsi
+  802ac1:	89 c7                	mov    %eax,%edi
+  802ac3:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802aca:	00 00 00 
+  802acd:	ff d0                	call   *%rax
+  802acf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ad2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ad6:	79 08                	jns    802ae0 <dup+0x37>
+    return r;
+  802ad8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802adb:	e9 33 02 00 00       	jmp    802d13 <dup+0x26a>
+  close(newfdnum);
+  802ae0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802ae3:	89 c7                	mov    %eax,%edi
+  802ae5:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802af1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802af4:	c1 e0 0c             	shl    $0xc,%eax
+  802af7:	48 98                	cltq
+  802af9:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802afe:	48 01 d0             	add    %rdx,%rax
+  802b01:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802b05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b09:	48 89 c7             	mov    %rax,%rdi
+  802b0c:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  802b13:	00 00 00 
+  802b16:	ff d0                	call   *%rax
+  802b18:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b20:	48 89 c7             	mov    %rax,%rdi
+  802b23:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  802b2a:	00 00 00 
+  802b2d:	ff d0                	call   *%rax
+  802b2f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b33:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b3a:	00 
+  802b3b:	e9 19 01 00 00       	jmp    802c59 <dup+0x1b0>
+    off -= PGSIZE;
+  802b40:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b47:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b48:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b50:	48 01 d0             	add    %rdx,%rax
+  802b53:	48 c1 e8 27          	shr    $0x27,%rax
+  802b57:	48 89 c2             	mov    %rax,%rdx
+  802b5a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b61:	01 00 00 
+  802b64:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b68:	83 e0 01             	and    $0x1,%eax
+  802b6b:	48 85 c0             	test   %rax,%rax
+  802b6e:	0f 84 e5 00 00 00    	je     802c59 <dup+0x1b0>
+  802b74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b7c:	48 01 d0             	add    %rdx,%rax
+  802b7f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b83:	48 89 c2             	mov    %rax,%rdx
+  802b86:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b8d:	01 00 00 
+  802b90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b94:	83 e0 01             	and    $0x1,%eax
+  802b97:	48 85 c0             	test   %rax,%rax
+  802b9a:	0f 84 b9 00 00 00    	je     802c59 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802ba0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba8:	48 01 d0             	add    %rdx,%rax
+  802bab:	48 c1 e8 15          	shr    $0x15,%rax
+  802baf:	48 89 c2             	mov    %rax,%rdx
+  802bb2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bb9:	01 00 00 
+  802bbc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc0:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bc3:	48 85 c0             	test   %rax,%rax
+  802bc6:	0f 84 8d 00 00 00    	je     802c59 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bcc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bd4:	48 01 d0             	add    %rdx,%rax
+  802bd7:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bdb:	48 89 c2             	mov    %rax,%rdx
+  802bde:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802be5:	01 00 00 
+  802be8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bec:	83 e0 01             	and    $0x1,%eax
+  802bef:	48 85 c0             	test   %rax,%rax
+  802bf2:	74 65                	je     802c59 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802bf4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bf8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bfc:	48 01 d0             	add    %rdx,%rax
+  802bff:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c03:	48 89 c2             	mov    %rax,%rdx
+  802c06:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c0d:	01 00 00 
+  802c10:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c14:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c19:	89 c6                	mov    %eax,%esi
+  802c1b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c23:	48 01 c2             	add    %rax,%rdx
+  802c26:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c2e:	48 01 c8             	add    %rcx,%rax
+  802c31:	41 89 f0             	mov    %esi,%r8d
+  802c34:	48 89 d1             	mov    %rdx,%rcx
+  802c37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3c:	48 89 c6             	mov    %rax,%rsi
+  802c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c44:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802c4b:	00 00 00 
+  802c4e:	ff d0                	call   *%rax
+  802c50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c57:	78 60                	js     802cb9 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c59:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c5e:	0f 85 dc fe ff ff    	jne    802b40 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c68:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c6c:	48 89 c2             	mov    %rax,%rdx
+  802c6f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c76:	01 00 00 
+  802c79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c7d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c82:	89 c1                	mov    %eax,%ecx
+  802c84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c88:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c8c:	41 89 c8             	mov    %ecx,%r8d
+  802c8f:	48 89 d1             	mov    %rdx,%rcx
+  802c92:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c97:	48 89 c6             	mov    %rax,%rsi
+  802c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9f:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802ca6:	00 00 00 
+  802ca9:	ff d0                	call   *%rax
+  802cab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb2:	78 08                	js     802cbc <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802cb4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cb7:	eb 5a                	jmp    802d13 <dup+0x26a>
+        goto err;
+  802cb9:	90                   	nop
+  802cba:	eb 01                	jmp    802cbd <dup+0x214>
+    goto err;
+  802cbc:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cc1:	48 89 c6             	mov    %rax,%rsi
+  802cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc9:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cd5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802cdc:	00 
+  802cdd:	eb 27                	jmp    802d06 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802cdf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce7:	48 01 d0             	add    %rdx,%rax
+  802cea:	48 89 c6             	mov    %rax,%rsi
+  802ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf2:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  802cf9:	00 00 00 
+  802cfc:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cfe:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802d05:	00 
+  802d06:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d0d:	00 
+  802d0e:	76 cf                	jbe    802cdf <dup+0x236>
+  return r;
+  802d10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d13:	c9                   	leave
+  802d14:	c3                   	ret
+
+0000000000802d15 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d15:	55                   	push   %rbp
+  802d16:	48 89 e5             	mov    %rsp,%rbp
+  802d19:	48 83 ec 40          	sub    $0x40,%rsp
+  802d1d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d20:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d24:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d28:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d2f:	48 89 d6             	mov    %rdx,%rsi
+  802d32:	89 c7                	mov    %eax,%edi
+  802d34:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802d3b:	00 00 00 
+  802d3e:	ff d0                	call   *%rax
+  802d40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d47:	78 24                	js     802d6d <read+0x58>
+  802d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d4d:	8b 00                	mov    (%rax),%eax
+  802d4f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d53:	48 89 d6             	mov    %rdx,%rsi
+  802d56:	89 c7                	mov    %eax,%edi
+  802d58:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+  802d64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d6b:	79 0a                	jns    802d77 <read+0x62>
+    return r;
+  802d6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d70:	48 98                	cltq
+  802d72:	e9 9e 00 00 00       	jmp    802e15 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d7b:	8b 40 08             	mov    0x8(%rax),%eax
+  802d7e:	83 e0 03             	and    $0x3,%eax
+  802d81:	83 f8 01             	cmp    $0x1,%eax
+  802d84:	75 5c                	jne    802de2 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d86:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d8d:	00 00 00 
+  802d90:	8b 40 04             	mov    0x4(%rax),%eax
+  802d93:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d98:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d9f:	00 00 00 
+  802da2:	48 98                	cltq
+  802da4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802dab:	48 01 d0             	add    %rdx,%rax
+  802dae:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802db4:	8b 00                	mov    (%rax),%eax
+  802db6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db9:	89 c6                	mov    %eax,%esi
+  802dbb:	48 b8 57 55 80 00 00 	movabs $0x805557,%rax
+  802dc2:	00 00 00 
+  802dc5:	48 89 c7             	mov    %rax,%rdi
+  802dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcd:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  802dd4:	00 00 00 
+  802dd7:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802dd9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802de0:	eb 33                	jmp    802e15 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802de2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802de6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802dea:	48 85 c0             	test   %rax,%rax
+  802ded:	75 09                	jne    802df8 <read+0xe3>
+    return -E_NOT_SUPP;
+  802def:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802df6:	eb 1d                	jmp    802e15 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802df8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dfc:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802e00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e04:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e08:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e0c:	48 89 ce             	mov    %rcx,%rsi
+  802e0f:	48 89 c7             	mov    %rax,%rdi
+  802e12:	41 ff d0             	call   *%r8
+}
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+
+0000000000802e17 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e17:	55                   	push   %rbp
+  802e18:	48 89 e5             	mov    %rsp,%rbp
+  802e1b:	48 83 ec 30          	sub    $0x30,%rsp
+  802e1f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e22:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e26:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e31:	eb 49                	jmp    802e7c <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e36:	48 98                	cltq
+  802e38:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e3c:	48 29 c2             	sub    %rax,%rdx
+  802e3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e42:	48 63 c8             	movslq %eax,%rcx
+  802e45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e49:	48 01 c1             	add    %rax,%rcx
+  802e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e4f:	48 89 ce             	mov    %rcx,%rsi
+  802e52:	89 c7                	mov    %eax,%edi
+  802e54:	48 b8 15 2d 80 00 00 	movabs $0x802d15,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e63:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e67:	79 07                	jns    802e70 <readn+0x59>
+      return m;
+  802e69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e6c:	48 98                	cltq
+  802e6e:	eb 1f                	jmp    802e8f <readn+0x78>
+    if (m == 0)
+  802e70:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e74:	74 13                	je     802e89 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802e76:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e79:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e7f:	48 98                	cltq
+  802e81:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802e85:	72 ac                	jb     802e33 <readn+0x1c>
+  802e87:	eb 01                	jmp    802e8a <readn+0x73>
+      break;
+  802e89:	90                   	nop
+  }
+  return tot;
+  802e8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e8d:	48 98                	cltq
+}
+  802e8f:	c9                   	leave
+  802e90:	c3                   	ret
+
+0000000000802e91 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e91:	55                   	push   %rbp
+  802e92:	48 89 e5             	mov    %rsp,%rbp
+  802e95:	48 83 ec 40          	sub    $0x40,%rsp
+  802e99:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e9c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ea0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ea4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ea8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802eab:	48 89 d6             	mov    %rdx,%rsi
+  802eae:	89 c7                	mov    %eax,%edi
+  802eb0:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ebf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ec3:	78 24                	js     802ee9 <write+0x58>
+  802ec5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ec9:	8b 00                	mov    (%rax),%eax
+  802ecb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ecf:	48 89 d6             	mov    %rdx,%rsi
+  802ed2:	89 c7                	mov    %eax,%edi
+  802ed4:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  802edb:	00 00 00 
+  802ede:	ff d0                	call   *%rax
+  802ee0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ee3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ee7:	79 0a                	jns    802ef3 <write+0x62>
+    return r;
+  802ee9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eec:	48 98                	cltq
+  802eee:	e9 9d 00 00 00       	jmp    802f90 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ef3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef7:	8b 40 08             	mov    0x8(%rax),%eax
+  802efa:	83 e0 03             	and    $0x3,%eax
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	75 5c                	jne    802f5d <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f01:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f08:	00 00 00 
+  802f0b:	8b 40 04             	mov    0x4(%rax),%eax
+  802f0e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f13:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f1a:	00 00 00 
+  802f1d:	48 98                	cltq
+  802f1f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f26:	48 01 d0             	add    %rdx,%rax
+  802f29:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f2f:	8b 00                	mov    (%rax),%eax
+  802f31:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f34:	89 c6                	mov    %eax,%esi
+  802f36:	48 b8 73 55 80 00 00 	movabs $0x805573,%rax
+  802f3d:	00 00 00 
+  802f40:	48 89 c7             	mov    %rax,%rdi
+  802f43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f48:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  802f4f:	00 00 00 
+  802f52:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f54:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f5b:	eb 33                	jmp    802f90 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f61:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f65:	48 85 c0             	test   %rax,%rax
+  802f68:	75 09                	jne    802f73 <write+0xe2>
+    return -E_NOT_SUPP;
+  802f6a:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f71:	eb 1d                	jmp    802f90 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f77:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f7f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f83:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802f87:	48 89 ce             	mov    %rcx,%rsi
+  802f8a:	48 89 c7             	mov    %rax,%rdi
+  802f8d:	41 ff d0             	call   *%r8
+}
+  802f90:	c9                   	leave
+  802f91:	c3                   	ret
+
+0000000000802f92 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802f92:	55                   	push   %rbp
+  802f93:	48 89 e5             	mov    %rsp,%rbp
+  802f96:	48 83 ec 18          	sub    $0x18,%rsp
+  802f9a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f9d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fa0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fa7:	48 89 d6             	mov    %rdx,%rsi
+  802faa:	89 c7                	mov    %eax,%edi
+  802fac:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+  802fb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fbf:	79 05                	jns    802fc6 <seek+0x34>
+    return r;
+  802fc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fc4:	eb 0f                	jmp    802fd5 <seek+0x43>
+  fd->fd_offset = offset;
+  802fc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802fcd:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+
+0000000000802fd7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802fd7:	55                   	push   %rbp
+  802fd8:	48 89 e5             	mov    %rsp,%rbp
+  802fdb:	48 83 ec 30          	sub    $0x30,%rsp
+  802fdf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fe2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fe5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fe9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fec:	48 89 d6             	mov    %rdx,%rsi
+  802fef:	89 c7                	mov    %eax,%edi
+  802ff1:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+  802ffd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803000:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803004:	78 24                	js     80302a <ftruncate+0x53>
+  803006:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300a:	8b 00                	mov    (%rax),%eax
+  80300c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803010:	48 89 d6             	mov    %rdx,%rsi
+  803013:	89 c7                	mov    %eax,%edi
+  803015:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+  803021:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803024:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803028:	79 08                	jns    803032 <ftruncate+0x5b>
+    return r;
+  80302a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80302d:	e9 92 00 00 00       	jmp    8030c4 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803032:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803036:	8b 40 08             	mov    0x8(%rax),%eax
+  803039:	83 e0 03             	and    $0x3,%eax
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	75 5a                	jne    80309a <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803040:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803047:	00 00 00 
+  80304a:	8b 40 04             	mov    0x4(%rax),%eax
+  80304d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803052:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803059:	00 00 00 
+  80305c:	48 98                	cltq
+  80305e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803065:	48 01 d0             	add    %rdx,%rax
+  803068:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80306e:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803070:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803073:	89 c6                	mov    %eax,%esi
+  803075:	48 b8 90 55 80 00 00 	movabs $0x805590,%rax
+  80307c:	00 00 00 
+  80307f:	48 89 c7             	mov    %rax,%rdi
+  803082:	b8 00 00 00 00       	mov    $0x0,%eax
+  803087:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  80308e:	00 00 00 
+  803091:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803093:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803098:	eb 2a                	jmp    8030c4 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80309a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8030a2:	48 85 c0             	test   %rax,%rax
+  8030a5:	75 07                	jne    8030ae <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8030a7:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8030ac:	eb 16                	jmp    8030c4 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b2:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ba:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030bd:	89 d6                	mov    %edx,%esi
+  8030bf:	48 89 c7             	mov    %rax,%rdi
+  8030c2:	ff d1                	call   *%rcx
+}
+  8030c4:	c9                   	leave
+  8030c5:	c3                   	ret
+
+00000000008030c6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030c6:	55                   	push   %rbp
+  8030c7:	48 89 e5             	mov    %rsp,%rbp
+  8030ca:	48 83 ec 30          	sub    $0x30,%rsp
+  8030ce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030d1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030d5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030dc:	48 89 d6             	mov    %rdx,%rsi
+  8030df:	89 c7                	mov    %eax,%edi
+  8030e1:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  8030e8:	00 00 00 
+  8030eb:	ff d0                	call   *%rax
+  8030ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030f4:	78 24                	js     80311a <fstat+0x54>
+  8030f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030fa:	8b 00                	mov    (%rax),%eax
+  8030fc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803100:	48 89 d6             	mov    %rdx,%rsi
+  803103:	89 c7                	mov    %eax,%edi
+  803105:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  80310c:	00 00 00 
+  80310f:	ff d0                	call   *%rax
+  803111:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803114:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803118:	79 05                	jns    80311f <fstat+0x59>
+    return r;
+  80311a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80311d:	eb 5e                	jmp    80317d <fstat+0xb7>
+  if (!dev->dev_stat)
+  80311f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803123:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803127:	48 85 c0             	test   %rax,%rax
+  80312a:	75 07                	jne    803133 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80312c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803131:	eb 4a                	jmp    80317d <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803133:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803137:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80313a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803145:	00 00 00 
+  stat->st_isdir   = 0;
+  803148:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80314c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803153:	00 00 00 
+  stat->st_dev     = dev;
+  803156:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80315a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80315e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803169:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80316d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803171:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803175:	48 89 d6             	mov    %rdx,%rsi
+  803178:	48 89 c7             	mov    %rax,%rdi
+  80317b:	ff d1                	call   *%rcx
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+000000000080317f <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	48 83 ec 10          	sub    $0x10,%rsp
+  803187:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80318b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80318f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803193:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803199:	83 f8 20             	cmp    $0x20,%eax
+  80319c:	75 07                	jne    8031a5 <pollwait_key+0x26>
+    return -E_INVAL;
+  80319e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a3:	eb 5f                	jmp    803204 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8031a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031a9:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031b3:	48 63 d2             	movslq %edx,%rdx
+  8031b6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031ba:	48 01 c2             	add    %rax,%rdx
+  8031bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c1:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c8:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8031ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031d2:	8b 00                	mov    (%rax),%eax
+  8031d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d8:	48 63 c9             	movslq %ecx,%rcx
+  8031db:	48 c1 e1 04          	shl    $0x4,%rcx
+  8031df:	48 01 ca             	add    %rcx,%rdx
+  8031e2:	48 83 c2 08          	add    $0x8,%rdx
+  8031e6:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8031e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ec:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8031f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f9:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8031ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803204:	c9                   	leave
+  803205:	c3                   	ret
+
+0000000000803206 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803206:	55                   	push   %rbp
+  803207:	48 89 e5             	mov    %rsp,%rbp
+  80320a:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803211:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803218:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80321e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803225:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80322c:	00 
+  int i, r, ready, ipc = 0;
+  80322d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803234:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80323b:	00 
+  80323c:	74 45                	je     803283 <poll+0x7d>
+  80323e:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803245:	ff 
+  803246:	74 3b                	je     803283 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803248:	48 b8 41 47 80 00 00 	movabs $0x804741,%rax
+  80324f:	00 00 00 
+  803252:	ff d0                	call   *%rax
+  803254:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803258:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325c:	48 f7 d0             	not    %rax
+  80325f:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803266:	73 10                	jae    803278 <poll+0x72>
+  803268:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80326c:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803273:	48 01 d0             	add    %rdx,%rax
+  803276:	eb 07                	jmp    80327f <poll+0x79>
+  803278:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80327f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803283:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80328a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803291:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803298:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80329f:	e9 46 02 00 00       	jmp    8034ea <poll+0x2e4>
+      fds[i].revents = 0;
+  8032a4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032a7:	48 63 d0             	movslq %eax,%rdx
+  8032aa:	48 89 d0             	mov    %rdx,%rax
+  8032ad:	48 01 c0             	add    %rax,%rax
+  8032b0:	48 01 d0             	add    %rdx,%rax
+  8032b3:	48 c1 e0 02          	shl    $0x2,%rax
+  8032b7:	48 89 c2             	mov    %rax,%rdx
+  8032ba:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032c1:	48 01 d0             	add    %rdx,%rax
+  8032c4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8032cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032ce:	48 63 d0             	movslq %eax,%rdx
+  8032d1:	48 89 d0             	mov    %rdx,%rax
+  8032d4:	48 01 c0             	add    %rax,%rax
+  8032d7:	48 01 d0             	add    %rdx,%rax
+  8032da:	48 c1 e0 02          	shl    $0x2,%rax
+  8032de:	48 89 c2             	mov    %rax,%rdx
+  8032e1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032e8:	48 01 d0             	add    %rdx,%rax
+  8032eb:	8b 00                	mov    (%rax),%eax
+  8032ed:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8032f0:	75 62                	jne    803354 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8032f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032f5:	48 63 d0             	movslq %eax,%rdx
+  8032f8:	48 89 d0             	mov    %rdx,%rax
+  8032fb:	48 01 c0             	add    %rax,%rax
+  8032fe:	48 01 d0             	add    %rdx,%rax
+  803301:	48 c1 e0 02          	shl    $0x2,%rax
+  803305:	48 89 c2             	mov    %rax,%rdx
+  803308:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80330f:	48 01 d0             	add    %rdx,%rax
+  803312:	8b 40 04             	mov    0x4(%rax),%eax
+  803315:	83 e0 01             	and    $0x1,%eax
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	0f 84 9b 01 00 00    	je     8034bb <poll+0x2b5>
+          fds[i].revents = ipc;
+  803320:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803323:	48 63 d0             	movslq %eax,%rdx
+  803326:	48 89 d0             	mov    %rdx,%rax
+  803329:	48 01 c0             	add    %rax,%rax
+  80332c:	48 01 d0             	add    %rdx,%rax
+  80332f:	48 c1 e0 02          	shl    $0x2,%rax
+  803333:	48 89 c2             	mov    %rax,%rdx
+  803336:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80333d:	48 01 c2             	add    %rax,%rdx
+  803340:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803343:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803346:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803349:	83 c8 04             	or     $0x4,%eax
+  80334c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80334f:	e9 67 01 00 00       	jmp    8034bb <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803354:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803357:	48 63 d0             	movslq %eax,%rdx
+  80335a:	48 89 d0             	mov    %rdx,%rax
+  80335d:	48 01 c0             	add    %rax,%rax
+  803360:	48 01 d0             	add    %rdx,%rax
+  803363:	48 c1 e0 02          	shl    $0x2,%rax
+  803367:	48 89 c2             	mov    %rax,%rdx
+  80336a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803371:	48 01 d0             	add    %rdx,%rax
+  803374:	8b 00                	mov    (%rax),%eax
+  803376:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80337d:	48 89 d6             	mov    %rdx,%rsi
+  803380:	89 c7                	mov    %eax,%edi
+  803382:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	78 25                	js     8033b7 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803392:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803399:	8b 00                	mov    (%rax),%eax
+  80339b:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8033a2:	48 89 d6             	mov    %rdx,%rsi
+  8033a5:	89 c7                	mov    %eax,%edi
+  8033a7:	48 b8 5a 29 80 00 00 	movabs $0x80295a,%rax
+  8033ae:	00 00 00 
+  8033b1:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	79 2c                	jns    8033e3 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033ba:	48 63 d0             	movslq %eax,%rdx
+  8033bd:	48 89 d0             	mov    %rdx,%rax
+  8033c0:	48 01 c0             	add    %rax,%rax
+  8033c3:	48 01 d0             	add    %rdx,%rax
+  8033c6:	48 c1 e0 02          	shl    $0x2,%rax
+  8033ca:	48 89 c2             	mov    %rax,%rdx
+  8033cd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033d4:	48 01 d0             	add    %rdx,%rax
+  8033d7:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8033de:	e9 d8 00 00 00       	jmp    8034bb <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8033e3:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033ea:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8033ee:	48 85 c0             	test   %rax,%rax
+  8033f1:	74 7d                	je     803470 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8033f3:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033fa:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8033fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803401:	48 63 d0             	movslq %eax,%rdx
+  803404:	48 89 d0             	mov    %rdx,%rax
+  803407:	48 01 c0             	add    %rax,%rax
+  80340a:	48 01 d0             	add    %rdx,%rax
+  80340d:	48 c1 e0 02          	shl    $0x2,%rax
+  803411:	48 89 c2             	mov    %rax,%rdx
+  803414:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80341b:	48 01 d0             	add    %rdx,%rax
+  80341e:	8b 48 04             	mov    0x4(%rax),%ecx
+  803421:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803428:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80342f:	89 ce                	mov    %ecx,%esi
+  803431:	48 89 c7             	mov    %rax,%rdi
+  803434:	41 ff d0             	call   *%r8
+  803437:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80343a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80343e:	79 08                	jns    803448 <poll+0x242>
+          return r;
+  803440:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803443:	e9 45 01 00 00       	jmp    80358d <poll+0x387>
+        fds[i].revents = r;
+  803448:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80344b:	48 63 d0             	movslq %eax,%rdx
+  80344e:	48 89 d0             	mov    %rdx,%rax
+  803451:	48 01 c0             	add    %rax,%rax
+  803454:	48 01 d0             	add    %rdx,%rax
+  803457:	48 c1 e0 02          	shl    $0x2,%rax
+  80345b:	48 89 c2             	mov    %rax,%rdx
+  80345e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803465:	48 01 c2             	add    %rax,%rdx
+  803468:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80346b:	89 42 08             	mov    %eax,0x8(%rdx)
+  80346e:	eb 4b                	jmp    8034bb <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803470:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803473:	48 63 d0             	movslq %eax,%rdx
+  803476:	48 89 d0             	mov    %rdx,%rax
+  803479:	48 01 c0             	add    %rax,%rax
+  80347c:	48 01 d0             	add    %rdx,%rax
+  80347f:	48 c1 e0 02          	shl    $0x2,%rax
+  803483:	48 89 c2             	mov    %rax,%rdx
+  803486:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80348d:	48 01 d0             	add    %rdx,%rax
+  803490:	8b 48 04             	mov    0x4(%rax),%ecx
+  803493:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803496:	48 63 d0             	movslq %eax,%rdx
+  803499:	48 89 d0             	mov    %rdx,%rax
+  80349c:	48 01 c0             	add    %rax,%rax
+  80349f:	48 01 d0             	add    %rdx,%rax
+  8034a2:	48 c1 e0 02          	shl    $0x2,%rax
+  8034a6:	48 89 c2             	mov    %rax,%rdx
+  8034a9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034b0:	48 01 d0             	add    %rdx,%rax
+  8034b3:	83 e1 03             	and    $0x3,%ecx
+  8034b6:	89 ca                	mov    %ecx,%edx
+  8034b8:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034be:	48 63 d0             	movslq %eax,%rdx
+  8034c1:	48 89 d0             	mov    %rdx,%rax
+  8034c4:	48 01 c0             	add    %rax,%rax
+  8034c7:	48 01 d0             	add    %rdx,%rax
+  8034ca:	48 c1 e0 02          	shl    $0x2,%rax
+  8034ce:	48 89 c2             	mov    %rax,%rdx
+  8034d1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034d8:	48 01 d0             	add    %rdx,%rax
+  8034db:	8b 40 08             	mov    0x8(%rax),%eax
+  8034de:	85 c0                	test   %eax,%eax
+  8034e0:	74 04                	je     8034e6 <poll+0x2e0>
+        ready++;
+  8034e2:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034e6:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8034ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034ed:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8034f3:	0f 8c ab fd ff ff    	jl     8032a4 <poll+0x9e>
+    }
+    if (ready)
+  8034f9:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8034fd:	74 08                	je     803507 <poll+0x301>
+      return ready;
+  8034ff:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803502:	e9 86 00 00 00       	jmp    80358d <poll+0x387>
+
+    if (deadline) {
+  803507:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80350c:	74 30                	je     80353e <poll+0x338>
+      now     = vsys_clock_ns();
+  80350e:	48 b8 41 47 80 00 00 	movabs $0x804741,%rax
+  803515:	00 00 00 
+  803518:	ff d0                	call   *%rax
+  80351a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80351e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803522:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803526:	73 0a                	jae    803532 <poll+0x32c>
+  803528:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80352c:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803530:	eb 05                	jmp    803537 <poll+0x331>
+  803532:	b8 00 00 00 00       	mov    $0x0,%eax
+  803537:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80353e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803541:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803544:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80354b:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803552:	48 89 c7             	mov    %rax,%rdi
+  803555:	48 b8 ea 23 80 00 00 	movabs $0x8023ea,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+  803561:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803564:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803568:	75 07                	jne    803571 <poll+0x36b>
+      return 0;
+  80356a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356f:	eb 1c                	jmp    80358d <poll+0x387>
+    if (r < 0)
+  803571:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803575:	79 05                	jns    80357c <poll+0x376>
+      return r;
+  803577:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80357a:	eb 11                	jmp    80358d <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80357c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80357f:	c1 f8 02             	sar    $0x2,%eax
+  803582:	83 e0 01             	and    $0x1,%eax
+  803585:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803588:	e9 f6 fc ff ff       	jmp    803283 <poll+0x7d>
+  }
+}
+  80358d:	c9                   	leave
+  80358e:	c3                   	ret
+
+000000000080358f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80358f:	55                   	push   %rbp
+  803590:	48 89 e5             	mov    %rsp,%rbp
+  803593:	48 83 ec 20          	sub    $0x20,%rsp
+  803597:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80359b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80359f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a8:	48 89 c7             	mov    %rax,%rdi
+  8035ab:	48 b8 7d 36 80 00 00 	movabs $0x80367d,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+  8035b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035be:	79 05                	jns    8035c5 <stat+0x36>
+    return fd;
+  8035c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c3:	eb 2f                	jmp    8035f4 <stat+0x65>
+  r = fstat(fd, stat);
+  8035c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035cc:	48 89 d6             	mov    %rdx,%rsi
+  8035cf:	89 c7                	mov    %eax,%edi
+  8035d1:	48 b8 c6 30 80 00 00 	movabs $0x8030c6,%rax
+  8035d8:	00 00 00 
+  8035db:	ff d0                	call   *%rax
+  8035dd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8035e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035e3:	89 c7                	mov    %eax,%edi
+  8035e5:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+  return r;
+  8035f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035f4:	c9                   	leave
+  8035f5:	c3                   	ret
+
+00000000008035f6 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8035f6:	55                   	push   %rbp
+  8035f7:	48 89 e5             	mov    %rsp,%rbp
+  8035fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8035fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803601:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803605:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80360c:	00 00 00 
+  80360f:	8b 00                	mov    (%rax),%eax
+  803611:	85 c0                	test   %eax,%eax
+  803613:	75 1d                	jne    803632 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803615:	bf 03 00 00 00       	mov    $0x3,%edi
+  80361a:	48 b8 76 4e 80 00 00 	movabs $0x804e76,%rax
+  803621:	00 00 00 
+  803624:	ff d0                	call   *%rax
+  803626:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80362d:	00 00 00 
+  803630:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803632:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803639:	00 00 00 
+  80363c:	8b 00                	mov    (%rax),%eax
+  80363e:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803641:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803646:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80364d:	00 00 00 
+  803650:	89 c7                	mov    %eax,%edi
+  803652:	48 b8 c9 4d 80 00 00 	movabs $0x804dc9,%rax
+  803659:	00 00 00 
+  80365c:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80365e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803662:	ba 00 00 00 00       	mov    $0x0,%edx
+  803667:	48 89 c6             	mov    %rax,%rsi
+  80366a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366f:	48 b8 4c 4c 80 00 00 	movabs $0x804c4c,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+}
+  80367b:	c9                   	leave
+  80367c:	c3                   	ret
+
+000000000080367d <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80367d:	55                   	push   %rbp
+  80367e:	48 89 e5             	mov    %rsp,%rbp
+  803681:	48 83 ec 20          	sub    $0x20,%rsp
+  803685:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803689:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80368c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803690:	48 89 c7             	mov    %rax,%rdi
+  803693:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  80369a:	00 00 00 
+  80369d:	ff d0                	call   *%rax
+  80369f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8036a4:	7e 0a                	jle    8036b0 <open+0x33>
+    return -E_BAD_PATH;
+  8036a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036ab:	e9 a8 00 00 00       	jmp    803758 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036b0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036b4:	48 89 c7             	mov    %rax,%rdi
+  8036b7:	48 b8 d7 26 80 00 00 	movabs $0x8026d7,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+  8036c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036ca:	79 08                	jns    8036d4 <open+0x57>
+    return r;
+  8036cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036cf:	e9 84 00 00 00       	jmp    803758 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8036d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036d8:	48 89 c6             	mov    %rax,%rsi
+  8036db:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8036e2:	00 00 00 
+  8036e5:	48 89 c7             	mov    %rax,%rdi
+  8036e8:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  8036ef:	00 00 00 
+  8036f2:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8036f4:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8036fb:	00 00 00 
+  8036fe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803701:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80370b:	48 89 c6             	mov    %rax,%rsi
+  80370e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803713:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+  80371f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803722:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803726:	79 1d                	jns    803745 <open+0xc8>
+    fd_close(fd, 0);
+  803728:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80372c:	be 00 00 00 00       	mov    $0x0,%esi
+  803731:	48 89 c7             	mov    %rax,%rdi
+  803734:	48 b8 8f 28 80 00 00 	movabs $0x80288f,%rax
+  80373b:	00 00 00 
+  80373e:	ff d0                	call   *%rax
+    return r;
+  803740:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803743:	eb 13                	jmp    803758 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803745:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803749:	48 89 c7             	mov    %rax,%rdi
+  80374c:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  803753:	00 00 00 
+  803756:	ff d0                	call   *%rax
+}
+  803758:	c9                   	leave
+  803759:	c3                   	ret
+
+000000000080375a <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80375a:	55                   	push   %rbp
+  80375b:	48 89 e5             	mov    %rsp,%rbp
+  80375e:	48 83 ec 10          	sub    $0x10,%rsp
+  803762:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803766:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80376a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80376d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803774:	00 00 00 
+  803777:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803779:	be 00 00 00 00       	mov    $0x0,%esi
+  80377e:	bf 06 00 00 00       	mov    $0x6,%edi
+  803783:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  80378a:	00 00 00 
+  80378d:	ff d0                	call   *%rax
+}
+  80378f:	c9                   	leave
+  803790:	c3                   	ret
+
+0000000000803791 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803791:	55                   	push   %rbp
+  803792:	48 89 e5             	mov    %rsp,%rbp
+  803795:	48 83 ec 30          	sub    $0x30,%rsp
+  803799:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80379d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8037a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8037a5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8037aa:	74 07                	je     8037b3 <devfile_read+0x22>
+  8037ac:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037b1:	75 0a                	jne    8037bd <devfile_read+0x2c>
+  return E_INVAL;
+  8037b3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037b8:	e9 b4 00 00 00       	jmp    803871 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037bd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037c4:	00 
+  while (n) {
+  8037c5:	e9 98 00 00 00       	jmp    803862 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037ce:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037d1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8037d8:	00 00 00 
+  8037db:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8037dd:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8037e4:	00 00 00 
+  8037e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037eb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8037ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037f9:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803800:	00 00 00 
+  803803:	ff d0                	call   *%rax
+  803805:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803808:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80380c:	7f 13                	jg     803821 <devfile_read+0x90>
+      return res ? res : res0;
+  80380e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803812:	74 07                	je     80381b <devfile_read+0x8a>
+  803814:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803817:	48 98                	cltq
+  803819:	eb 56                	jmp    803871 <devfile_read+0xe0>
+  80381b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80381f:	eb 50                	jmp    803871 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803821:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803824:	48 63 d0             	movslq %eax,%rdx
+  803827:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80382b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803832:	00 00 00 
+  803835:	48 89 ce             	mov    %rcx,%rsi
+  803838:	48 89 c7             	mov    %rax,%rdi
+  80383b:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+
+    buf += res;
+  803847:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384a:	48 98                	cltq
+  80384c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803850:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803853:	48 98                	cltq
+  803855:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803859:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80385c:	48 98                	cltq
+  80385e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803862:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803867:	0f 85 5d ff ff ff    	jne    8037ca <devfile_read+0x39>
+  }
+
+  return res0;
+  80386d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803871:	c9                   	leave
+  803872:	c3                   	ret
+
+0000000000803873 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803873:	55                   	push   %rbp
+  803874:	48 89 e5             	mov    %rsp,%rbp
+  803877:	48 83 ec 50          	sub    $0x50,%rsp
+  80387b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80387f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803883:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803887:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80388c:	74 07                	je     803895 <devfile_write+0x22>
+  80388e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803893:	75 0a                	jne    80389f <devfile_write+0x2c>
+  return E_INVAL;
+  803895:	b8 03 00 00 00       	mov    $0x3,%eax
+  80389a:	e9 c9 00 00 00       	jmp    803968 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80389f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8038a6:	00 
+
+  while (n) {
+  8038a7:	e9 ad 00 00 00       	jmp    803959 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8038ac:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038b4:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038bb:	00 
+  8038bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c4:	48 39 c2             	cmp    %rax,%rdx
+  8038c7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8038cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038d7:	48 89 c6             	mov    %rax,%rsi
+  8038da:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8038e1:	00 00 00 
+  8038e4:	48 89 c7             	mov    %rax,%rdi
+  8038e7:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  8038ee:	00 00 00 
+  8038f1:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038fa:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803901:	00 00 00 
+  803904:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803906:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80390d:	00 00 00 
+  803910:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803914:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803918:	be 00 00 00 00       	mov    $0x0,%esi
+  80391d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803922:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+  80392e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803931:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803935:	79 07                	jns    80393e <devfile_write+0xcb>
+      return res;
+  803937:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80393a:	48 98                	cltq
+  80393c:	eb 2a                	jmp    803968 <devfile_write+0xf5>
+
+    buf += res;
+  80393e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803941:	48 98                	cltq
+  803943:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803947:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80394a:	48 98                	cltq
+  80394c:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803950:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803953:	48 98                	cltq
+  803955:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803959:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80395e:	0f 85 48 ff ff ff    	jne    8038ac <devfile_write+0x39>
+  }
+
+  return res0;
+  803964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803968:	c9                   	leave
+  803969:	c3                   	ret
+
+000000000080396a <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80396a:	55                   	push   %rbp
+  80396b:	48 89 e5             	mov    %rsp,%rbp
+  80396e:	48 83 ec 20          	sub    $0x20,%rsp
+  803972:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803976:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80397a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80397e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803981:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803988:	00 00 00 
+  80398b:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80398d:	be 00 00 00 00       	mov    $0x0,%esi
+  803992:	bf 05 00 00 00       	mov    $0x5,%edi
+  803997:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039aa:	79 05                	jns    8039b1 <devfile_stat+0x47>
+    return r;
+  8039ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039af:	eb 59                	jmp    803a0a <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039b5:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039bc:	00 00 00 
+  8039bf:	48 89 d6             	mov    %rdx,%rsi
+  8039c2:	48 89 c7             	mov    %rax,%rdi
+  8039c5:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  8039cc:	00 00 00 
+  8039cf:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8039d1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039d8:	00 00 00 
+  8039db:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039e5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039eb:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039f2:	00 00 00 
+  8039f5:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ff:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803a05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a0a:	c9                   	leave
+  803a0b:	c3                   	ret
+
+0000000000803a0c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a0c:	55                   	push   %rbp
+  803a0d:	48 89 e5             	mov    %rsp,%rbp
+  803a10:	48 83 ec 10          	sub    $0x10,%rsp
+  803a14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a18:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a1f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a22:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a29:	00 00 00 
+  803a2c:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a2e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a35:	00 00 00 
+  803a38:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a3b:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a3e:	be 00 00 00 00       	mov    $0x0,%esi
+  803a43:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a48:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803a4f:	00 00 00 
+  803a52:	ff d0                	call   *%rax
+}
+  803a54:	c9                   	leave
+  803a55:	c3                   	ret
+
+0000000000803a56 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a56:	55                   	push   %rbp
+  803a57:	48 89 e5             	mov    %rsp,%rbp
+  803a5a:	48 83 ec 18          	sub    $0x18,%rsp
+  803a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a62:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a65:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803a69:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a6c:	83 e0 03             	and    $0x3,%eax
+}
+  803a6f:	c9                   	leave
+  803a70:	c3                   	ret
+
+0000000000803a71 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803a71:	55                   	push   %rbp
+  803a72:	48 89 e5             	mov    %rsp,%rbp
+  803a75:	48 83 ec 10          	sub    $0x10,%rsp
+  803a79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a81:	48 89 c7             	mov    %rax,%rdi
+  803a84:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  803a8b:	00 00 00 
+  803a8e:	ff d0                	call   *%rax
+  803a90:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a95:	7e 07                	jle    803a9e <remove+0x2d>
+    return -E_BAD_PATH;
+  803a97:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a9c:	eb 36                	jmp    803ad4 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa2:	48 89 c6             	mov    %rax,%rsi
+  803aa5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803aac:	00 00 00 
+  803aaf:	48 89 c7             	mov    %rax,%rdi
+  803ab2:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  803ab9:	00 00 00 
+  803abc:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803abe:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac3:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ac8:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803acf:	00 00 00 
+  803ad2:	ff d0                	call   *%rax
+}
+  803ad4:	c9                   	leave
+  803ad5:	c3                   	ret
+
+0000000000803ad6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803ad6:	55                   	push   %rbp
+  803ad7:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803ada:	be 00 00 00 00       	mov    $0x0,%esi
+  803adf:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ae4:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+}
+  803af0:	5d                   	pop    %rbp
+  803af1:	c3                   	ret
+
+0000000000803af2 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803af2:	55                   	push   %rbp
+  803af3:	48 89 e5             	mov    %rsp,%rbp
+  803af6:	48 83 ec 20          	sub    $0x20,%rsp
+  803afa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803afe:	be 00 00 00 00       	mov    $0x0,%esi
+  803b03:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b08:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803b0f:	00 00 00 
+  803b12:	ff d0                	call   *%rax
+  803b14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b1b:	79 05                	jns    803b22 <fs_stats+0x30>
+    return r;
+  803b1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b20:	eb 2a                	jmp    803b4c <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b26:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b2b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803b32:	00 00 00 
+  803b35:	48 89 ce             	mov    %rcx,%rsi
+  803b38:	48 89 c7             	mov    %rax,%rdi
+  803b3b:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+  return 0;
+  803b47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b4c:	c9                   	leave
+  803b4d:	c3                   	ret
+
+0000000000803b4e <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b4e:	55                   	push   %rbp
+  803b4f:	48 89 e5             	mov    %rsp,%rbp
+  803b52:	48 83 ec 10          	sub    $0x10,%rsp
+  803b56:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b59:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b60:	00 00 00 
+  803b63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b66:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803b68:	be 00 00 00 00       	mov    $0x0,%esi
+  803b6d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b72:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803b79:	00 00 00 
+  803b7c:	ff d0                	call   *%rax
+}
+  803b7e:	c9                   	leave
+  803b7f:	c3                   	ret
+
+0000000000803b80 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803b80:	55                   	push   %rbp
+  803b81:	48 89 e5             	mov    %rsp,%rbp
+  803b84:	48 83 ec 10          	sub    $0x10,%rsp
+  803b88:	89 f8                	mov    %edi,%eax
+  803b8a:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803b8d:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803b91:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b98:	00 00 00 
+  803b9b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803b9d:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ba7:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  803bae:	00 00 00 
+  803bb1:	ff d0                	call   *%rax
+}
+  803bb3:	c9                   	leave
+  803bb4:	c3                   	ret
+
+0000000000803bb5 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803bb5:	55                   	push   %rbp
+  803bb6:	48 89 e5             	mov    %rsp,%rbp
+  803bb9:	48 83 ec 10          	sub    $0x10,%rsp
+  803bbd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bc5:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803bca:	48 89 c7             	mov    %rax,%rdi
+  803bcd:	48 b8 db 3b 80 00 00 	movabs $0x803bdb,%rax
+  803bd4:	00 00 00 
+  803bd7:	ff d0                	call   *%rax
+}
+  803bd9:	c9                   	leave
+  803bda:	c3                   	ret
+
+0000000000803bdb <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803bdb:	55                   	push   %rbp
+  803bdc:	48 89 e5             	mov    %rsp,%rbp
+  803bdf:	48 83 ec 50          	sub    $0x50,%rsp
+  803be3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803be7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803beb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803bf2:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803bf3:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803bf8:	74 0a                	je     803c04 <pipe_size+0x29>
+  803bfa:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803c01:	00 
+  803c02:	76 0a                	jbe    803c0e <pipe_size+0x33>
+    return -E_INVAL;
+  803c04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c09:	e9 cc 02 00 00       	jmp    803eda <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c0e:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c12:	48 89 c7             	mov    %rax,%rdi
+  803c15:	48 b8 d7 26 80 00 00 	movabs $0x8026d7,%rax
+  803c1c:	00 00 00 
+  803c1f:	ff d0                	call   *%rax
+  803c21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c28:	0f 88 a8 02 00 00    	js     803ed6 <pipe_size+0x2fb>
+  803c2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c32:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c37:	48 89 c6             	mov    %rax,%rsi
+  803c3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c3f:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  803c46:	00 00 00 
+  803c49:	ff d0                	call   *%rax
+  803c4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c52:	0f 88 7e 02 00 00    	js     803ed6 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c58:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c5c:	48 89 c7             	mov    %rax,%rdi
+  803c5f:	48 b8 d7 26 80 00 00 	movabs $0x8026d7,%rax
+  803c66:	00 00 00 
+  803c69:	ff d0                	call   *%rax
+  803c6b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c6e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c72:	0f 88 43 02 00 00    	js     803ebb <pipe_size+0x2e0>
+  803c78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c7c:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c81:	48 89 c6             	mov    %rax,%rsi
+  803c84:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c89:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  803c90:	00 00 00 
+  803c93:	ff d0                	call   *%rax
+  803c95:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c98:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c9c:	0f 88 19 02 00 00    	js     803ebb <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803ca2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ca6:	48 89 c7             	mov    %rax,%rdi
+  803ca9:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cb9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cc0:	00 
+  803cc1:	e9 a2 00 00 00       	jmp    803d68 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cca:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cce:	48 89 c2             	mov    %rax,%rdx
+  803cd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cd5:	48 01 d0             	add    %rdx,%rax
+  803cd8:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cdd:	48 89 c6             	mov    %rax,%rsi
+  803ce0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce5:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  803cec:	00 00 00 
+  803cef:	ff d0                	call   *%rax
+  803cf1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cf4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cf8:	0f 88 37 01 00 00    	js     803e35 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803cfe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d02:	48 89 c7             	mov    %rax,%rdi
+  803d05:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  803d0c:	00 00 00 
+  803d0f:	ff d0                	call   *%rax
+  803d11:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d15:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d19:	48 01 c2             	add    %rax,%rdx
+  803d1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d20:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d24:	48 89 c1             	mov    %rax,%rcx
+  803d27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d2b:	48 01 c8             	add    %rcx,%rax
+  803d2e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d34:	48 89 d1             	mov    %rdx,%rcx
+  803d37:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d3c:	48 89 c6             	mov    %rax,%rsi
+  803d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d44:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+  803d50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d57:	79 0a                	jns    803d63 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d5e:	e9 d3 00 00 00       	jmp    803e36 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d63:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803d68:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803d6f:	00 
+  803d70:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803d74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d78:	48 01 d0             	add    %rdx,%rax
+  803d7b:	48 83 c0 1f          	add    $0x1f,%rax
+  803d7f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803d83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d87:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d8c:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803d90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d94:	48 29 d0             	sub    %rdx,%rax
+  803d97:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d9b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803d9f:	0f 82 21 ff ff ff    	jb     803cc6 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803da5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803dad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803db1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803db5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803db9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dbd:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dc4:	00 00 00 
+  803dc7:	8b 12                	mov    (%rdx),%edx
+  803dc9:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803dcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dcf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803dd6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dda:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803de1:	00 00 00 
+  803de4:	8b 12                	mov    (%rdx),%edx
+  803de6:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803de8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dec:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803df3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df7:	48 89 c7             	mov    %rax,%rdi
+  803dfa:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  803e01:	00 00 00 
+  803e04:	ff d0                	call   *%rax
+  803e06:	89 c2                	mov    %eax,%edx
+  803e08:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e0c:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e0e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e12:	48 89 c7             	mov    %rax,%rdi
+  803e15:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+  803e21:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e25:	48 83 c2 04          	add    $0x4,%rdx
+  803e29:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e30:	e9 a5 00 00 00       	jmp    803eda <pipe_size+0x2ff>
+      goto err2;
+  803e35:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e36:	eb 58                	jmp    803e90 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e3c:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e40:	48 89 c2             	mov    %rax,%rdx
+  803e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e47:	48 01 d0             	add    %rdx,%rax
+  803e4a:	48 89 c6             	mov    %rax,%rsi
+  803e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e52:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  803e59:	00 00 00 
+  803e5c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e62:	48 89 c7             	mov    %rax,%rdi
+  803e65:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  803e6c:	00 00 00 
+  803e6f:	ff d0                	call   *%rax
+  803e71:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e75:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e79:	48 01 d0             	add    %rdx,%rax
+  803e7c:	48 89 c6             	mov    %rax,%rsi
+  803e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e84:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  803e8b:	00 00 00 
+  803e8e:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803e90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e94:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e98:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803e9c:	48 85 c0             	test   %rax,%rax
+  803e9f:	75 97                	jne    803e38 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803ea1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ea5:	48 89 c6             	mov    %rax,%rsi
+  803ea8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ead:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  803eb4:	00 00 00 
+  803eb7:	ff d0                	call   *%rax
+  803eb9:	eb 01                	jmp    803ebc <pipe_size+0x2e1>
+    goto err1;
+  803ebb:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803ebc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ec0:	48 89 c6             	mov    %rax,%rsi
+  803ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec8:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  803ecf:	00 00 00 
+  803ed2:	ff d0                	call   *%rax
+  803ed4:	eb 01                	jmp    803ed7 <pipe_size+0x2fc>
+    goto err;
+  803ed6:	90                   	nop
+err:
+  return r;
+  803ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803eda:	c9                   	leave
+  803edb:	c3                   	ret
+
+0000000000803edc <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803edc:	55                   	push   %rbp
+  803edd:	48 89 e5             	mov    %rsp,%rbp
+  803ee0:	53                   	push   %rbx
+  803ee1:	48 83 ec 28          	sub    $0x28,%rsp
+  803ee5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ee9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803eed:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ef4:	00 00 00 
+  803ef7:	8b 40 04             	mov    0x4(%rax),%eax
+  803efa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803eff:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f06:	00 00 00 
+  803f09:	48 98                	cltq
+  803f0b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f12:	48 01 d0             	add    %rdx,%rax
+  803f15:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f1b:	8b 00                	mov    (%rax),%eax
+  803f1d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f24:	48 89 c7             	mov    %rax,%rdi
+  803f27:	48 b8 e7 4e 80 00 00 	movabs $0x804ee7,%rax
+  803f2e:	00 00 00 
+  803f31:	ff d0                	call   *%rax
+  803f33:	89 c3                	mov    %eax,%ebx
+  803f35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f39:	48 89 c7             	mov    %rax,%rdi
+  803f3c:	48 b8 e7 4e 80 00 00 	movabs $0x804ee7,%rax
+  803f43:	00 00 00 
+  803f46:	ff d0                	call   *%rax
+  803f48:	39 c3                	cmp    %eax,%ebx
+  803f4a:	0f 94 c0             	sete   %al
+  803f4d:	0f b6 c0             	movzbl %al,%eax
+  803f50:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f53:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f5a:	00 00 00 
+  803f5d:	8b 40 04             	mov    0x4(%rax),%eax
+  803f60:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f65:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f6c:	00 00 00 
+  803f6f:	48 98                	cltq
+  803f71:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f78:	48 01 d0             	add    %rdx,%rax
+  803f7b:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f81:	8b 00                	mov    (%rax),%eax
+  803f83:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803f86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f89:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f8c:	75 05                	jne    803f93 <_pipeisclosed+0xb7>
+      return ret;
+  803f8e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f91:	eb 68                	jmp    803ffb <_pipeisclosed+0x11f>
+    if (n != nn)
+  803f93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f96:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f99:	0f 84 4e ff ff ff    	je     803eed <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803f9f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803fa6:	00 00 00 
+  803fa9:	8b 40 04             	mov    0x4(%rax),%eax
+  803fac:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fb1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fb8:	00 00 00 
+  803fbb:	48 98                	cltq
+  803fbd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fc4:	48 01 d0             	add    %rdx,%rax
+  803fc7:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fcd:	8b 10                	mov    (%rax),%edx
+  803fcf:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803fd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fd5:	89 c6                	mov    %eax,%esi
+  803fd7:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  803fde:	00 00 00 
+  803fe1:	48 89 c7             	mov    %rax,%rdi
+  803fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe9:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  803ff0:	00 00 00 
+  803ff3:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803ff6:	e9 f2 fe ff ff       	jmp    803eed <_pipeisclosed+0x11>
+  }
+}
+  803ffb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803fff:	c9                   	leave
+  804000:	c3                   	ret
+
+0000000000804001 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804001:	55                   	push   %rbp
+  804002:	48 89 e5             	mov    %rsp,%rbp
+  804005:	48 83 ec 30          	sub    $0x30,%rsp
+  804009:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80400c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804010:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804013:	48 89 d6             	mov    %rdx,%rsi
+  804016:	89 c7                	mov    %eax,%edi
+  804018:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+  804024:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804027:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80402b:	79 05                	jns    804032 <pipeisclosed+0x31>
+    return r;
+  80402d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804030:	eb 31                	jmp    804063 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804032:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804036:	48 89 c7             	mov    %rax,%rdi
+  804039:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  804040:	00 00 00 
+  804043:	ff d0                	call   *%rax
+  804045:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804049:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80404d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804051:	48 89 d6             	mov    %rdx,%rsi
+  804054:	48 89 c7             	mov    %rax,%rdi
+  804057:	48 b8 dc 3e 80 00 00 	movabs $0x803edc,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+}
+  804063:	c9                   	leave
+  804064:	c3                   	ret
+
+0000000000804065 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804065:	55                   	push   %rbp
+  804066:	48 89 e5             	mov    %rsp,%rbp
+  804069:	48 83 ec 10          	sub    $0x10,%rsp
+  80406d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804071:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804075:	8b 40 18             	mov    0x18(%rax),%eax
+  804078:	8d 50 01             	lea    0x1(%rax),%edx
+  80407b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407f:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804086:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804089:	85 c0                	test   %eax,%eax
+  80408b:	74 27                	je     8040b4 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80408d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804091:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804098:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80409c:	48 83 c0 18          	add    $0x18,%rax
+  8040a0:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8040a5:	48 89 c7             	mov    %rax,%rdi
+  8040a8:	48 b8 9d 23 80 00 00 	movabs $0x80239d,%rax
+  8040af:	00 00 00 
+  8040b2:	ff d0                	call   *%rax
+  }
+}
+  8040b4:	90                   	nop
+  8040b5:	c9                   	leave
+  8040b6:	c3                   	ret
+
+00000000008040b7 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040b7:	55                   	push   %rbp
+  8040b8:	48 89 e5             	mov    %rsp,%rbp
+  8040bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8040bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8040c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040ca:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8040d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040d5:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8040d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040dc:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8040e3:	89 c6                	mov    %eax,%esi
+  8040e5:	48 89 cf             	mov    %rcx,%rdi
+  8040e8:	48 b8 4e 23 80 00 00 	movabs $0x80234e,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+}
+  8040f4:	90                   	nop
+  8040f5:	c9                   	leave
+  8040f6:	c3                   	ret
+
+00000000008040f7 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040f7:	55                   	push   %rbp
+  8040f8:	48 89 e5             	mov    %rsp,%rbp
+  8040fb:	48 83 ec 70          	sub    $0x70,%rsp
+  8040ff:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804103:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804107:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80410b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80410f:	48 89 c7             	mov    %rax,%rdi
+  804112:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  804119:	00 00 00 
+  80411c:	ff d0                	call   *%rax
+  80411e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804122:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804127:	75 0a                	jne    804133 <devpipe_read+0x3c>
+    return 0;
+  804129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80412e:	e9 63 01 00 00       	jmp    804296 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804133:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804137:	8b 40 18             	mov    0x18(%rax),%eax
+  80413a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80413d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804141:	48 8b 10             	mov    (%rax),%rdx
+  804144:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804148:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80414c:	48 39 c2             	cmp    %rax,%rdx
+  80414f:	75 42                	jne    804193 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804151:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804155:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804159:	48 89 d6             	mov    %rdx,%rsi
+  80415c:	48 89 c7             	mov    %rax,%rdi
+  80415f:	48 b8 dc 3e 80 00 00 	movabs $0x803edc,%rax
+  804166:	00 00 00 
+  804169:	ff d0                	call   *%rax
+  80416b:	85 c0                	test   %eax,%eax
+  80416d:	74 0a                	je     804179 <devpipe_read+0x82>
+      return 0;
+  80416f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804174:	e9 1d 01 00 00       	jmp    804296 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804179:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80417c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804180:	89 d6                	mov    %edx,%esi
+  804182:	48 89 c7             	mov    %rax,%rdi
+  804185:	48 b8 b7 40 80 00 00 	movabs $0x8040b7,%rax
+  80418c:	00 00 00 
+  80418f:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804191:	eb a0                	jmp    804133 <devpipe_read+0x3c>
+      break;
+  804193:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804194:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804198:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80419c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041a0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8041a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041b0:	48 8b 00             	mov    (%rax),%rax
+  8041b3:	48 29 c2             	sub    %rax,%rdx
+  8041b6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041c2:	48 39 c2             	cmp    %rax,%rdx
+  8041c5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041c9:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8041cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041d1:	48 8b 00             	mov    (%rax),%rax
+  8041d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041d8:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8041dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041e1:	48 f7 f1             	div    %rcx
+  8041e4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8041e8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041f4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041f8:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8041fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804200:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804204:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804208:	48 39 c2             	cmp    %rax,%rdx
+  80420b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80420f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804213:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804217:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80421b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80421f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804223:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422b:	48 89 ce             	mov    %rcx,%rsi
+  80422e:	48 89 c7             	mov    %rax,%rdi
+  804231:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  804238:	00 00 00 
+  80423b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80423d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804241:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804245:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804249:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80424d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804251:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804255:	48 01 d1             	add    %rdx,%rcx
+  804258:	48 89 c2             	mov    %rax,%rdx
+  80425b:	48 89 cf             	mov    %rcx,%rdi
+  80425e:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  804265:	00 00 00 
+  804268:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80426a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80426e:	48 8b 10             	mov    (%rax),%rdx
+  804271:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804275:	48 01 c2             	add    %rax,%rdx
+  804278:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80427c:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80427f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804283:	48 89 c7             	mov    %rax,%rdi
+  804286:	48 b8 65 40 80 00 00 	movabs $0x804065,%rax
+  80428d:	00 00 00 
+  804290:	ff d0                	call   *%rax
+  return n;
+  804292:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804296:	c9                   	leave
+  804297:	c3                   	ret
+
+0000000000804298 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804298:	55                   	push   %rbp
+  804299:	48 89 e5             	mov    %rsp,%rbp
+  80429c:	48 83 ec 70          	sub    $0x70,%rsp
+  8042a0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8042a4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042a8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042b0:	48 89 c7             	mov    %rax,%rdi
+  8042b3:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  8042ba:	00 00 00 
+  8042bd:	ff d0                	call   *%rax
+  8042bf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042c3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8042cb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8042d2:	00 
+  8042d3:	e9 b8 01 00 00       	jmp    804490 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8042d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042dc:	8b 40 18             	mov    0x18(%rax),%eax
+  8042df:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8042e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8042ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ee:	48 8b 00             	mov    (%rax),%rax
+  8042f1:	48 29 c2             	sub    %rax,%rdx
+  8042f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042fc:	48 39 c2             	cmp    %rax,%rdx
+  8042ff:	75 4d                	jne    80434e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804301:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804305:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804309:	48 89 d6             	mov    %rdx,%rsi
+  80430c:	48 89 c7             	mov    %rax,%rdi
+  80430f:	48 b8 dc 3e 80 00 00 	movabs $0x803edc,%rax
+  804316:	00 00 00 
+  804319:	ff d0                	call   *%rax
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	74 0a                	je     804329 <devpipe_write+0x91>
+        return 0;
+  80431f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804324:	e9 79 01 00 00       	jmp    8044a2 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804329:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80432c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804330:	89 d6                	mov    %edx,%esi
+  804332:	48 89 c7             	mov    %rax,%rdi
+  804335:	48 b8 b7 40 80 00 00 	movabs $0x8040b7,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+      m = 0;
+  804341:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804348:	00 
+      continue;
+  804349:	e9 3a 01 00 00       	jmp    804488 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80434e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804352:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804356:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80435a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804366:	48 8b 08             	mov    (%rax),%rcx
+  804369:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80436d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804371:	48 29 c1             	sub    %rax,%rcx
+  804374:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804378:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80437c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804380:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804384:	48 39 c2             	cmp    %rax,%rdx
+  804387:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80438b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80438f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804393:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804397:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80439b:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80439f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a4:	48 f7 f1             	div    %rcx
+  8043a7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8043ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043af:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043b7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043bb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043bf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043c3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043c7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8043cb:	48 39 c2             	cmp    %rax,%rdx
+  8043ce:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043d2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8043d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043da:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8043de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043e2:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8043e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043ea:	48 01 d1             	add    %rdx,%rcx
+  8043ed:	48 89 c2             	mov    %rax,%rdx
+  8043f0:	48 89 cf             	mov    %rcx,%rdi
+  8043f3:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  8043fa:	00 00 00 
+  8043fd:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8043ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804403:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804407:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80440b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80440f:	73 4d                	jae    80445e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804415:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804419:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80441d:	48 29 c2             	sub    %rax,%rdx
+  804420:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804424:	48 01 c2             	add    %rax,%rdx
+  804427:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80442b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80442f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804433:	48 89 c1             	mov    %rax,%rcx
+  804436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80443a:	48 01 c1             	add    %rax,%rcx
+  80443d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804441:	48 01 c1             	add    %rax,%rcx
+  804444:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804448:	48 83 c0 20          	add    $0x20,%rax
+  80444c:	48 89 ce             	mov    %rcx,%rsi
+  80444f:	48 89 c7             	mov    %rax,%rdi
+  804452:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  804459:	00 00 00 
+  80445c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80445e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804462:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804466:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80446a:	48 01 c2             	add    %rax,%rdx
+  80446d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804471:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804475:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804479:	48 89 c7             	mov    %rax,%rdi
+  80447c:	48 b8 65 40 80 00 00 	movabs $0x804065,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804488:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80448c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804494:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804498:	0f 82 3a fe ff ff    	jb     8042d8 <devpipe_write+0x40>
+  }
+
+  return i;
+  80449e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8044a2:	c9                   	leave
+  8044a3:	c3                   	ret
+
+00000000008044a4 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8044a4:	55                   	push   %rbp
+  8044a5:	48 89 e5             	mov    %rsp,%rbp
+  8044a8:	48 83 ec 40          	sub    $0x40,%rsp
+  8044ac:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044b0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044bb:	48 89 c7             	mov    %rax,%rdi
+  8044be:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+  8044ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8044ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8044d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d9:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8044dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044e1:	48 89 d6             	mov    %rdx,%rsi
+  8044e4:	48 89 c7             	mov    %rax,%rdi
+  8044e7:	48 b8 7f 31 80 00 00 	movabs $0x80317f,%rax
+  8044ee:	00 00 00 
+  8044f1:	ff d0                	call   *%rax
+  8044f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044fa:	79 08                	jns    804504 <devpipe_poll+0x60>
+    return r;
+  8044fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044ff:	e9 85 00 00 00       	jmp    804589 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804504:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804507:	83 e0 01             	and    $0x1,%eax
+  80450a:	85 c0                	test   %eax,%eax
+  80450c:	74 18                	je     804526 <devpipe_poll+0x82>
+  80450e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804512:	48 8b 10             	mov    (%rax),%rdx
+  804515:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804519:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80451d:	48 39 c2             	cmp    %rax,%rdx
+  804520:	74 04                	je     804526 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804522:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804526:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804529:	83 e0 02             	and    $0x2,%eax
+  80452c:	85 c0                	test   %eax,%eax
+  80452e:	74 23                	je     804553 <devpipe_poll+0xaf>
+  804530:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804534:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804538:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453c:	48 8b 00             	mov    (%rax),%rax
+  80453f:	48 29 c2             	sub    %rax,%rdx
+  804542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804546:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80454a:	48 39 c2             	cmp    %rax,%rdx
+  80454d:	73 04                	jae    804553 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80454f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804553:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804557:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80455b:	48 89 d6             	mov    %rdx,%rsi
+  80455e:	48 89 c7             	mov    %rax,%rdi
+  804561:	48 b8 dc 3e 80 00 00 	movabs $0x803edc,%rax
+  804568:	00 00 00 
+  80456b:	ff d0                	call   *%rax
+  80456d:	85 c0                	test   %eax,%eax
+  80456f:	74 04                	je     804575 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804571:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804575:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804579:	75 0b                	jne    804586 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80457b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80457f:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804586:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804589:	c9                   	leave
+  80458a:	c3                   	ret
+
+000000000080458b <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80458b:	55                   	push   %rbp
+  80458c:	48 89 e5             	mov    %rsp,%rbp
+  80458f:	48 83 ec 20          	sub    $0x20,%rsp
+  804593:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804597:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80459b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80459f:	48 89 c7             	mov    %rax,%rdi
+  8045a2:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  8045a9:	00 00 00 
+  8045ac:	ff d0                	call   *%rax
+  8045ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045b6:	48 ba f1 55 80 00 00 	movabs $0x8055f1,%rdx
+  8045bd:	00 00 00 
+  8045c0:	48 89 d6             	mov    %rdx,%rsi
+  8045c3:	48 89 c7             	mov    %rax,%rdi
+  8045c6:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  8045cd:	00 00 00 
+  8045d0:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8045d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045da:	89 c1                	mov    %eax,%ecx
+  8045dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045e0:	48 8b 00             	mov    (%rax),%rax
+  8045e3:	89 c2                	mov    %eax,%edx
+  8045e5:	89 c8                	mov    %ecx,%eax
+  8045e7:	29 d0                	sub    %edx,%eax
+  8045e9:	89 c2                	mov    %eax,%edx
+  8045eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ef:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8045f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804600:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804603:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804607:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  80460e:	00 00 00 
+  804611:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804618:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80461d:	c9                   	leave
+  80461e:	c3                   	ret
+
+000000000080461f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80461f:	55                   	push   %rbp
+  804620:	48 89 e5             	mov    %rsp,%rbp
+  804623:	48 83 ec 40          	sub    $0x40,%rsp
+  804627:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80462b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80462f:	48 89 c7             	mov    %rax,%rdi
+  804632:	48 b8 ac 26 80 00 00 	movabs $0x8026ac,%rax
+  804639:	00 00 00 
+  80463c:	ff d0                	call   *%rax
+  80463e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804642:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804649:	00 
+  80464a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80464e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804656:	48 01 d0             	add    %rdx,%rax
+  804659:	48 83 c0 1f          	add    $0x1f,%rax
+  80465d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466a:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80466e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804672:	48 29 d0             	sub    %rdx,%rax
+  804675:	48 c1 e8 0c          	shr    $0xc,%rax
+  804679:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80467d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804681:	48 89 c6             	mov    %rax,%rsi
+  804684:	bf 00 00 00 00       	mov    $0x0,%edi
+  804689:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  804690:	00 00 00 
+  804693:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804695:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804699:	48 89 c7             	mov    %rax,%rdi
+  80469c:	48 b8 65 40 80 00 00 	movabs $0x804065,%rax
+  8046a3:	00 00 00 
+  8046a6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046b0:	eb 2f                	jmp    8046e1 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b6:	48 83 e8 01          	sub    $0x1,%rax
+  8046ba:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046be:	48 89 c2             	mov    %rax,%rdx
+  8046c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c5:	48 01 d0             	add    %rdx,%rax
+  8046c8:	48 89 c6             	mov    %rax,%rsi
+  8046cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d0:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  8046d7:	00 00 00 
+  8046da:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046dc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046e1:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8046e6:	77 ca                	ja     8046b2 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8046e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046ec:	48 89 c6             	mov    %rax,%rsi
+  8046ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046f4:	48 b8 5a 20 80 00 00 	movabs $0x80205a,%rax
+  8046fb:	00 00 00 
+  8046fe:	ff d0                	call   *%rax
+}
+  804700:	c9                   	leave
+  804701:	c3                   	ret
+
+0000000000804702 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804702:	55                   	push   %rbp
+  804703:	48 89 e5             	mov    %rsp,%rbp
+  804706:	48 83 ec 08          	sub    $0x8,%rsp
+  80470a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80470d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804711:	75 10                	jne    804723 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804713:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80471a:	00 00 00 
+  80471d:	8b 00                	mov    (%rax),%eax
+  80471f:	48 98                	cltq
+  804721:	eb 05                	jmp    804728 <vsyscall+0x26>
+  }
+  return 0;
+  804723:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804728:	c9                   	leave
+  804729:	c3                   	ret
+
+000000000080472a <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80472a:	55                   	push   %rbp
+  80472b:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80472e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804733:	48 b8 02 47 80 00 00 	movabs $0x804702,%rax
+  80473a:	00 00 00 
+  80473d:	ff d0                	call   *%rax
+}
+  80473f:	5d                   	pop    %rbp
+  804740:	c3                   	ret
+
+0000000000804741 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804741:	55                   	push   %rbp
+  804742:	48 89 e5             	mov    %rsp,%rbp
+  804745:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804749:	0f 31                	rdtsc
+  80474b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80474e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804751:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804754:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804757:	48 c1 e2 20          	shl    $0x20,%rdx
+  80475b:	48 09 d0             	or     %rdx,%rax
+  80475e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804762:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804766:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80476a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804771:	00 00 00 
+  804774:	8b 40 08             	mov    0x8(%rax),%eax
+  804777:	48 98                	cltq
+  804779:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80477d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804781:	ba 00 00 00 00       	mov    $0x0,%edx
+  804786:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80478a:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804791:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804795:	ba 00 00 00 00       	mov    $0x0,%edx
+  80479a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80479e:	48 89 d0             	mov    %rdx,%rax
+  8047a1:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8047a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047ad:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047b1:	48 01 c8             	add    %rcx,%rax
+}
+  8047b4:	c9                   	leave
+  8047b5:	c3                   	ret
+
+00000000008047b6 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047b6:	55                   	push   %rbp
+  8047b7:	48 89 e5             	mov    %rsp,%rbp
+  8047ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8047be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047c4:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8047c7:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8047cb:	be 01 00 00 00       	mov    $0x1,%esi
+  8047d0:	48 89 c7             	mov    %rax,%rdi
+  8047d3:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  8047da:	00 00 00 
+  8047dd:	ff d0                	call   *%rax
+}
+  8047df:	90                   	nop
+  8047e0:	c9                   	leave
+  8047e1:	c3                   	ret
+
+00000000008047e2 <getchar>:
+
+int
+getchar(void) {
+  8047e2:	55                   	push   %rbp
+  8047e3:	48 89 e5             	mov    %rsp,%rbp
+  8047e6:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8047ea:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8047ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047f3:	48 89 c6             	mov    %rax,%rsi
+  8047f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047fb:	48 b8 15 2d 80 00 00 	movabs $0x802d15,%rax
+  804802:	00 00 00 
+  804805:	ff d0                	call   *%rax
+  804807:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  80480a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80480e:	79 05                	jns    804815 <getchar+0x33>
+    return r;
+  804810:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804813:	eb 14                	jmp    804829 <getchar+0x47>
+  if (r < 1)
+  804815:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804819:	7f 07                	jg     804822 <getchar+0x40>
+    return -E_EOF;
+  80481b:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804820:	eb 07                	jmp    804829 <getchar+0x47>
+  return c;
+  804822:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804826:	0f b6 c0             	movzbl %al,%eax
+}
+  804829:	c9                   	leave
+  80482a:	c3                   	ret
+
+000000000080482b <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80482b:	55                   	push   %rbp
+  80482c:	48 89 e5             	mov    %rsp,%rbp
+  80482f:	48 83 ec 20          	sub    $0x20,%rsp
+  804833:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804836:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80483a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80483d:	48 89 d6             	mov    %rdx,%rsi
+  804840:	89 c7                	mov    %eax,%edi
+  804842:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  804849:	00 00 00 
+  80484c:	ff d0                	call   *%rax
+  80484e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804851:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804855:	79 05                	jns    80485c <iscons+0x31>
+    return r;
+  804857:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80485a:	eb 1a                	jmp    804876 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80485c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804860:	8b 10                	mov    (%rax),%edx
+  804862:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804869:	00 00 00 
+  80486c:	8b 00                	mov    (%rax),%eax
+  80486e:	39 c2                	cmp    %eax,%edx
+  804870:	0f 94 c0             	sete   %al
+  804873:	0f b6 c0             	movzbl %al,%eax
+}
+  804876:	c9                   	leave
+  804877:	c3                   	ret
+
+0000000000804878 <opencons>:
+
+int
+opencons(void) {
+  804878:	55                   	push   %rbp
+  804879:	48 89 e5             	mov    %rsp,%rbp
+  80487c:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804880:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804884:	48 89 c7             	mov    %rax,%rdi
+  804887:	48 b8 d7 26 80 00 00 	movabs $0x8026d7,%rax
+  80488e:	00 00 00 
+  804891:	ff d0                	call   *%rax
+  804893:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804896:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80489a:	79 05                	jns    8048a1 <opencons+0x29>
+    return r;
+  80489c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80489f:	eb 66                	jmp    804907 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8048a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048a5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048aa:	48 89 c6             	mov    %rax,%rsi
+  8048ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b2:	48 b8 a2 1f 80 00 00 	movabs $0x801fa2,%rax
+  8048b9:	00 00 00 
+  8048bc:	ff d0                	call   *%rax
+  8048be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048c5:	79 05                	jns    8048cc <opencons+0x54>
+    return r;
+  8048c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048ca:	eb 3b                	jmp    804907 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8048cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d0:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8048d7:	00 00 00 
+  8048da:	8b 12                	mov    (%rdx),%edx
+  8048dc:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8048de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8048e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048ed:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8048f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f8:	48 89 c7             	mov    %rax,%rdi
+  8048fb:	48 b8 89 26 80 00 00 	movabs $0x802689,%rax
+  804902:	00 00 00 
+  804905:	ff d0                	call   *%rax
+}
+  804907:	c9                   	leave
+  804908:	c3                   	ret
+
+0000000000804909 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804909:	55                   	push   %rbp
+  80490a:	48 89 e5             	mov    %rsp,%rbp
+  80490d:	48 83 ec 20          	sub    $0x20,%rsp
+  804911:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804914:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804917:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80491b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80491e:	48 89 d6             	mov    %rdx,%rsi
+  804921:	89 c7                	mov    %eax,%edi
+  804923:	48 b8 b9 27 80 00 00 	movabs $0x8027b9,%rax
+  80492a:	00 00 00 
+  80492d:	ff d0                	call   *%rax
+  80492f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804932:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804936:	79 05                	jns    80493d <consmode+0x34>
+    return r;
+  804938:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80493b:	eb 34                	jmp    804971 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80493d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804941:	8b 10                	mov    (%rax),%edx
+  804943:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  80494a:	00 00 00 
+  80494d:	8b 00                	mov    (%rax),%eax
+  80494f:	39 c2                	cmp    %eax,%edx
+  804951:	74 07                	je     80495a <consmode+0x51>
+    return -E_INVAL;
+  804953:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804958:	eb 17                	jmp    804971 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80495a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80495e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804961:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804964:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804968:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80496b:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80496e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804971:	c9                   	leave
+  804972:	c3                   	ret
+
+0000000000804973 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804973:	55                   	push   %rbp
+  804974:	48 89 e5             	mov    %rsp,%rbp
+  804977:	48 83 ec 20          	sub    $0x20,%rsp
+  80497b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80497f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804983:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80498e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804996:	48 89 ce             	mov    %rcx,%rsi
+  804999:	48 89 c7             	mov    %rax,%rdi
+  80499c:	48 b8 fc 22 80 00 00 	movabs $0x8022fc,%rax
+  8049a3:	00 00 00 
+  8049a6:	ff d0                	call   *%rax
+  8049a8:	48 98                	cltq
+}
+  8049aa:	c9                   	leave
+  8049ab:	c3                   	ret
+
+00000000008049ac <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049ac:	55                   	push   %rbp
+  8049ad:	48 89 e5             	mov    %rsp,%rbp
+  8049b0:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049b7:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049be:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049c5:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8049cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049d3:	eb 74                	jmp    804a49 <devcons_write+0x9d>
+    m = n - tot;
+  8049d5:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8049dc:	89 c2                	mov    %eax,%edx
+  8049de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049e1:	29 c2                	sub    %eax,%edx
+  8049e3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8049e6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049e9:	83 f8 7f             	cmp    $0x7f,%eax
+  8049ec:	76 07                	jbe    8049f5 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8049ee:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8049f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049f8:	48 63 d0             	movslq %eax,%rdx
+  8049fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049fe:	48 63 c8             	movslq %eax,%rcx
+  804a01:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804a08:	48 01 c1             	add    %rax,%rcx
+  804a0b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a12:	48 89 ce             	mov    %rcx,%rsi
+  804a15:	48 89 c7             	mov    %rax,%rdi
+  804a18:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  804a1f:	00 00 00 
+  804a22:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a24:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a27:	48 63 d0             	movslq %eax,%rdx
+  804a2a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a31:	48 89 d6             	mov    %rdx,%rsi
+  804a34:	48 89 c7             	mov    %rax,%rdi
+  804a37:	48 b8 8b 1d 80 00 00 	movabs $0x801d8b,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a43:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a46:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a4c:	48 98                	cltq
+  804a4e:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a55:	0f 82 7a ff ff ff    	jb     8049d5 <devcons_write+0x29>
+  }
+  return tot;
+  804a5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a5e:	48 98                	cltq
+}
+  804a60:	c9                   	leave
+  804a61:	c3                   	ret
+
+0000000000804a62 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a62:	55                   	push   %rbp
+  804a63:	48 89 e5             	mov    %rsp,%rbp
+  804a66:	48 83 ec 08          	sub    $0x8,%rsp
+  804a6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a73:	c9                   	leave
+  804a74:	c3                   	ret
+
+0000000000804a75 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a75:	55                   	push   %rbp
+  804a76:	48 89 e5             	mov    %rsp,%rbp
+  804a79:	48 83 ec 10          	sub    $0x10,%rsp
+  804a7d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a81:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a89:	48 ba fd 55 80 00 00 	movabs $0x8055fd,%rdx
+  804a90:	00 00 00 
+  804a93:	48 89 d6             	mov    %rdx,%rsi
+  804a96:	48 89 c7             	mov    %rax,%rdi
+  804a99:	48 b8 d4 11 80 00 00 	movabs $0x8011d4,%rax
+  804aa0:	00 00 00 
+  804aa3:	ff d0                	call   *%rax
+  return 0;
+  804aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804aaa:	c9                   	leave
+  804aab:	c3                   	ret
+
+0000000000804aac <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aac:	55                   	push   %rbp
+  804aad:	48 89 e5             	mov    %rsp,%rbp
+  804ab0:	48 83 ec 30          	sub    $0x30,%rsp
+  804ab4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ab8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804abb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804abf:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804ac6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ac9:	83 e0 02             	and    $0x2,%eax
+  804acc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad3:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ad6:	83 f8 01             	cmp    $0x1,%eax
+  804ad9:	75 04                	jne    804adf <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804adb:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804adf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ae2:	83 e0 01             	and    $0x1,%eax
+  804ae5:	85 c0                	test   %eax,%eax
+  804ae7:	74 44                	je     804b2d <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ae9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804af1:	89 c2                	mov    %eax,%edx
+  804af3:	be 00 00 00 00       	mov    $0x0,%esi
+  804af8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afd:	48 b8 ea 23 80 00 00 	movabs $0x8023ea,%rax
+  804b04:	00 00 00 
+  804b07:	ff d0                	call   *%rax
+  804b09:	83 f8 01             	cmp    $0x1,%eax
+  804b0c:	75 06                	jne    804b14 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b0e:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b12:	eb 19                	jmp    804b2d <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b18:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b1e:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b21:	89 c2                	mov    %eax,%edx
+  804b23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b27:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b30:	c9                   	leave
+  804b31:	c3                   	ret
+
+0000000000804b32 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b32:	55                   	push   %rbp
+  804b33:	48 89 e5             	mov    %rsp,%rbp
+  804b36:	53                   	push   %rbx
+  804b37:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b3e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b45:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b4b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b52:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b59:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b60:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804b67:	84 c0                	test   %al,%al
+  804b69:	74 23                	je     804b8e <_panic+0x5c>
+  804b6b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804b72:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804b76:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804b7a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804b7e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804b82:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804b86:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804b8a:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b8e:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804b95:	00 00 00 
+  804b98:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804b9f:	00 00 00 
+  804ba2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804ba6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804bad:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804bb4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bbb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bc2:	00 00 00 
+  804bc5:	48 8b 18             	mov    (%rax),%rbx
+  804bc8:	48 b8 29 1f 80 00 00 	movabs $0x801f29,%rax
+  804bcf:	00 00 00 
+  804bd2:	ff d0                	call   *%rax
+  804bd4:	89 c6                	mov    %eax,%esi
+  804bd6:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804bdc:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804be3:	41 89 d0             	mov    %edx,%r8d
+  804be6:	48 89 c1             	mov    %rax,%rcx
+  804be9:	48 89 da             	mov    %rbx,%rdx
+  804bec:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804bf3:	00 00 00 
+  804bf6:	48 89 c7             	mov    %rax,%rdi
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfe:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  804c05:	00 00 00 
+  804c08:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804c0b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c12:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c19:	48 89 d6             	mov    %rdx,%rsi
+  804c1c:	48 89 c7             	mov    %rax,%rdi
+  804c1f:	48 b8 99 01 80 00 00 	movabs $0x800199,%rax
+  804c26:	00 00 00 
+  804c29:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c2b:	48 b8 2b 56 80 00 00 	movabs $0x80562b,%rax
+  804c32:	00 00 00 
+  804c35:	48 89 c7             	mov    %rax,%rdi
+  804c38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3d:	48 ba 24 02 80 00 00 	movabs $0x800224,%rdx
+  804c44:	00 00 00 
+  804c47:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c49:	cc                   	int3
+  804c4a:	eb fd                	jmp    804c49 <_panic+0x117>
+
+0000000000804c4c <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c4c:	55                   	push   %rbp
+  804c4d:	48 89 e5             	mov    %rsp,%rbp
+  804c50:	48 83 ec 20          	sub    $0x20,%rsp
+  804c54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c5c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c60:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c64:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c6c:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c73:	48 89 c7             	mov    %rax,%rdi
+  804c76:	48 b8 84 4c 80 00 00 	movabs $0x804c84,%rax
+  804c7d:	00 00 00 
+  804c80:	ff d0                	call   *%rax
+}
+  804c82:	c9                   	leave
+  804c83:	c3                   	ret
+
+0000000000804c84 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c84:	55                   	push   %rbp
+  804c85:	48 89 e5             	mov    %rsp,%rbp
+  804c88:	48 83 ec 30          	sub    $0x30,%rsp
+  804c8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c90:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c94:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c98:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c9c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ca1:	75 0e                	jne    804cb1 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804ca3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804caa:	00 00 00 
+  804cad:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804cb1:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cb6:	75 18                	jne    804cd0 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cbc:	48 89 c7             	mov    %rax,%rdi
+  804cbf:	48 b8 e2 21 80 00 00 	movabs $0x8021e2,%rax
+  804cc6:	00 00 00 
+  804cc9:	ff d0                	call   *%rax
+  804ccb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cce:	eb 1d                	jmp    804ced <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cd0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd8:	48 89 d6             	mov    %rdx,%rsi
+  804cdb:	48 89 c7             	mov    %rax,%rdi
+  804cde:	48 b8 28 22 80 00 00 	movabs $0x802228,%rax
+  804ce5:	00 00 00 
+  804ce8:	ff d0                	call   *%rax
+  804cea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804ced:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cf1:	79 2a                	jns    804d1d <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cf3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf8:	74 0a                	je     804d04 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cfe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804d04:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d09:	74 0a                	je     804d15 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d0f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d18:	e9 aa 00 00 00       	jmp    804dc7 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d1d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d22:	74 36                	je     804d5a <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d24:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d2b:	00 00 00 
+  804d2e:	8b 40 04             	mov    0x4(%rax),%eax
+  804d31:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d36:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d3d:	00 00 00 
+  804d40:	48 98                	cltq
+  804d42:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d49:	48 01 d0             	add    %rdx,%rax
+  804d4c:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d52:	8b 10                	mov    (%rax),%edx
+  804d54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d58:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d5a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d5f:	74 36                	je     804d97 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d61:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d68:	00 00 00 
+  804d6b:	8b 40 04             	mov    0x4(%rax),%eax
+  804d6e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d73:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d7a:	00 00 00 
+  804d7d:	48 98                	cltq
+  804d7f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d86:	48 01 d0             	add    %rdx,%rax
+  804d89:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d8f:	8b 10                	mov    (%rax),%edx
+  804d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d95:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d97:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d9e:	00 00 00 
+  804da1:	8b 40 04             	mov    0x4(%rax),%eax
+  804da4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804da9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804db0:	00 00 00 
+  804db3:	48 98                	cltq
+  804db5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dbc:	48 01 d0             	add    %rdx,%rax
+  804dbf:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dc5:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dc7:	c9                   	leave
+  804dc8:	c3                   	ret
+
+0000000000804dc9 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dc9:	55                   	push   %rbp
+  804dca:	48 89 e5             	mov    %rsp,%rbp
+  804dcd:	48 83 ec 30          	sub    $0x30,%rsp
+  804dd1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dd4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dd7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804ddb:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dde:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804de3:	75 5e                	jne    804e43 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804de5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dec:	00 00 00 
+  804def:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804df3:	eb 4e                	jmp    804e43 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804df5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804df9:	79 3c                	jns    804e37 <ipc_send+0x6e>
+  804dfb:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dff:	74 36                	je     804e37 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804e01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e04:	89 c1                	mov    %eax,%ecx
+  804e06:	48 b8 30 56 80 00 00 	movabs $0x805630,%rax
+  804e0d:	00 00 00 
+  804e10:	48 89 c2             	mov    %rax,%rdx
+  804e13:	be 54 00 00 00       	mov    $0x54,%esi
+  804e18:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  804e1f:	00 00 00 
+  804e22:	48 89 c7             	mov    %rax,%rdi
+  804e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e2a:	49 b8 32 4b 80 00 00 	movabs $0x804b32,%r8
+  804e31:	00 00 00 
+  804e34:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e37:	48 b8 65 1f 80 00 00 	movabs $0x801f65,%rax
+  804e3e:	00 00 00 
+  804e41:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e43:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e46:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e50:	89 c7                	mov    %eax,%edi
+  804e52:	48 b8 8b 21 80 00 00 	movabs $0x80218b,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+  804e5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e65:	75 8e                	jne    804df5 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e67:	48 b8 65 1f 80 00 00 	movabs $0x801f65,%rax
+  804e6e:	00 00 00 
+  804e71:	ff d0                	call   *%rax
+}
+  804e73:	90                   	nop
+  804e74:	c9                   	leave
+  804e75:	c3                   	ret
+
+0000000000804e76 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e76:	55                   	push   %rbp
+  804e77:	48 89 e5             	mov    %rsp,%rbp
+  804e7a:	48 83 ec 18          	sub    $0x18,%rsp
+  804e7e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e81:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e88:	eb 4d                	jmp    804ed7 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e8a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e91:	00 00 00 
+  804e94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e97:	48 98                	cltq
+  804e99:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ea0:	48 01 d0             	add    %rdx,%rax
+  804ea3:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ea9:	8b 00                	mov    (%rax),%eax
+  804eab:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804eae:	75 23                	jne    804ed3 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804eb0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eb7:	00 00 00 
+  804eba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ebd:	48 98                	cltq
+  804ebf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ec6:	48 01 d0             	add    %rdx,%rax
+  804ec9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ecf:	8b 00                	mov    (%rax),%eax
+  804ed1:	eb 12                	jmp    804ee5 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ed3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ed7:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ede:	7e aa                	jle    804e8a <ipc_find_env+0x14>
+  return 0;
+  804ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ee5:	c9                   	leave
+  804ee6:	c3                   	ret
+
+0000000000804ee7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ee7:	55                   	push   %rbp
+  804ee8:	48 89 e5             	mov    %rsp,%rbp
+  804eeb:	48 83 ec 18          	sub    $0x18,%rsp
+  804eef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ef3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef7:	48 c1 e8 27          	shr    $0x27,%rax
+  804efb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804f00:	48 89 c2             	mov    %rax,%rdx
+  804f03:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f0a:	01 00 00 
+  804f0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f11:	83 e0 01             	and    $0x1,%eax
+  804f14:	48 85 c0             	test   %rax,%rax
+  804f17:	74 63                	je     804f7c <pageref+0x95>
+  804f19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f1d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f21:	48 89 c2             	mov    %rax,%rdx
+  804f24:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f2b:	01 00 00 
+  804f2e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f32:	83 e0 01             	and    $0x1,%eax
+  804f35:	48 85 c0             	test   %rax,%rax
+  804f38:	74 42                	je     804f7c <pageref+0x95>
+  804f3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3e:	48 c1 e8 15          	shr    $0x15,%rax
+  804f42:	48 89 c2             	mov    %rax,%rdx
+  804f45:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f4c:	01 00 00 
+  804f4f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f53:	83 e0 01             	and    $0x1,%eax
+  804f56:	48 85 c0             	test   %rax,%rax
+  804f59:	74 21                	je     804f7c <pageref+0x95>
+  804f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f63:	48 89 c2             	mov    %rax,%rdx
+  804f66:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f6d:	01 00 00 
+  804f70:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f74:	83 e0 01             	and    $0x1,%eax
+  804f77:	48 85 c0             	test   %rax,%rax
+  804f7a:	75 07                	jne    804f83 <pageref+0x9c>
+    return 0;
+  804f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f81:	eb 53                	jmp    804fd6 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f87:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f8b:	48 89 c2             	mov    %rax,%rdx
+  804f8e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f95:	01 00 00 
+  804f98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f9c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804fa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa4:	83 e0 01             	and    $0x1,%eax
+  804fa7:	48 85 c0             	test   %rax,%rax
+  804faa:	75 07                	jne    804fb3 <pageref+0xcc>
+    return 0;
+  804fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb1:	eb 23                	jmp    804fd6 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb7:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fbb:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fc2:	00 00 00 
+  804fc5:	48 c1 e0 04          	shl    $0x4,%rax
+  804fc9:	48 01 d0             	add    %rdx,%rax
+  804fcc:	48 83 c0 08          	add    $0x8,%rax
+  804fd0:	0f b7 00             	movzwl (%rax),%eax
+  804fd3:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fd6:	c9                   	leave
+  804fd7:	c3                   	ret
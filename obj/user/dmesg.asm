@@ -0,0 +1,8339 @@
+
+obj/user/dmesg:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 89 00 00 00       	call   8000b5 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+
+// Big enough for the whole kernel log.
+static char buf[KLOG_BUFSIZE];
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n = sys_klog_read(buf, sizeof(buf));
+  800041:	be 00 40 00 00       	mov    $0x4000,%esi
+  800046:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80004d:	00 00 00 
+  800050:	48 89 c7             	mov    %rax,%rdi
+  800053:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  80005a:	00 00 00 
+  80005d:	ff d0                	call   *%rax
+  80005f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (n < 0) {
+  800062:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800066:	79 25                	jns    80008d <umain+0x5b>
+    printf("dmesg: %i\n", n);
+  800068:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80006b:	89 c6                	mov    %eax,%esi
+  80006d:	48 b8 40 53 80 00 00 	movabs $0x805340,%rax
+  800074:	00 00 00 
+  800077:	48 89 c7             	mov    %rax,%rdi
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	48 ba 82 22 80 00 00 	movabs $0x802282,%rdx
+  800086:	00 00 00 
+  800089:	ff d2                	call   *%rdx
+    return;
+  80008b:	eb 26                	jmp    8000b3 <umain+0x81>
+  }
+  write(1, buf, n);
+  80008d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800090:	48 98                	cltq
+  800092:	48 89 c2             	mov    %rax,%rdx
+  800095:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80009c:	00 00 00 
+  80009f:	48 89 c6             	mov    %rax,%rsi
+  8000a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000a7:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+}
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+00000000008000b5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000b5:	55                   	push   %rbp
+  8000b6:	48 89 e5             	mov    %rsp,%rbp
+  8000b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8000bd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8000c4:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000cb:	00 00 00 
+  8000ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000d2:	eb 13                	jmp    8000e7 <libmain+0x32>
+    (*ctor)();
+  8000d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000d8:	48 8b 10             	mov    (%rax),%rdx
+  8000db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e0:	ff d2                	call   *%rdx
+    ctor++;
+  8000e2:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000e7:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000ee:	00 00 00 
+  8000f1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000f5:	72 dd                	jb     8000d4 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000fb:	7e 14                	jle    800111 <libmain+0x5c>
+    binaryname = argv[0];
+  8000fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800101:	48 8b 00             	mov    (%rax),%rax
+  800104:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80010b:	00 00 00 
+  80010e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800111:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800115:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800118:	48 89 d6             	mov    %rdx,%rsi
+  80011b:	89 c7                	mov    %eax,%edi
+  80011d:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800129:	48 b8 38 01 80 00 00 	movabs $0x800138,%rax
+  800130:	00 00 00 
+  800133:	ff d0                	call   *%rax
+#endif
+}
+  800135:	90                   	nop
+  800136:	c9                   	leave
+  800137:	c3                   	ret
+
+0000000000800138 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800138:	55                   	push   %rbp
+  800139:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80013c:	48 b8 e3 0e 80 00 00 	movabs $0x800ee3,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014d:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  800154:	00 00 00 
+  800157:	ff d0                	call   *%rax
+}
+  800159:	90                   	nop
+  80015a:	5d                   	pop    %rbp
+  80015b:	c3                   	ret
+
+000000000080015c <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80015c:	55                   	push   %rbp
+  80015d:	48 89 e5             	mov    %rsp,%rbp
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 48          	sub    $0x48,%rsp
+  800165:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800169:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80016d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800171:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800175:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800179:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80017d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800181:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800185:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800189:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80018d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800191:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800195:	4c 89 c3             	mov    %r8,%rbx
+  800198:	cd 30                	int    $0x30
+  80019a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80019e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001a3:	74 46                	je     8001eb <syscall+0x8f>
+  8001a5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8001aa:	7e 3f                	jle    8001eb <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8001ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8001b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001b4:	49 89 d0             	mov    %rdx,%r8
+  8001b7:	48 89 c1             	mov    %rax,%rcx
+  8001ba:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  8001c1:	00 00 00 
+  8001c4:	48 89 c2             	mov    %rax,%rdx
+  8001c7:	be 22 00 00 00       	mov    $0x22,%esi
+  8001cc:	48 b8 77 53 80 00 00 	movabs $0x805377,%rax
+  8001d3:	00 00 00 
+  8001d6:	48 89 c7             	mov    %rax,%rdi
+  8001d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001de:	49 b9 b5 32 80 00 00 	movabs $0x8032b5,%r9
+  8001e5:	00 00 00 
+  8001e8:	41 ff d1             	call   *%r9
+
+  return ret;
+  8001eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8001ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f3:	c9                   	leave
+  8001f4:	c3                   	ret
+
+00000000008001f5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001f5:	55                   	push   %rbp
+  8001f6:	48 89 e5             	mov    %rsp,%rbp
+  8001f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8001fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800201:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800205:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80020d:	48 83 ec 08          	sub    $0x8,%rsp
+  800211:	6a 00                	push   $0x0
+  800213:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800219:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021f:	48 89 d1             	mov    %rdx,%rcx
+  800222:	48 89 c2             	mov    %rax,%rdx
+  800225:	be 00 00 00 00       	mov    $0x0,%esi
+  80022a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022f:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800236:	00 00 00 
+  800239:	ff d0                	call   *%rax
+  80023b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80023f:	90                   	nop
+  800240:	c9                   	leave
+  800241:	c3                   	ret
+
+0000000000800242 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800246:	48 83 ec 08          	sub    $0x8,%rsp
+  80024a:	6a 00                	push   $0x0
+  80024c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800252:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800258:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80025d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800262:	be 00 00 00 00       	mov    $0x0,%esi
+  800267:	bf 01 00 00 00       	mov    $0x1,%edi
+  80026c:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+  800278:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80027c:	c9                   	leave
+  80027d:	c3                   	ret
+
+000000000080027e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80027e:	55                   	push   %rbp
+  80027f:	48 89 e5             	mov    %rsp,%rbp
+  800282:	48 83 ec 10          	sub    $0x10,%rsp
+  800286:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800289:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80028c:	48 98                	cltq
+  80028e:	48 83 ec 08          	sub    $0x8,%rsp
+  800292:	6a 00                	push   $0x0
+  800294:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80029a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002a5:	48 89 c2             	mov    %rax,%rdx
+  8002a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ad:	bf 03 00 00 00       	mov    $0x3,%edi
+  8002b2:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+  8002be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+00000000008002c4 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8002c4:	55                   	push   %rbp
+  8002c5:	48 89 e5             	mov    %rsp,%rbp
+  8002c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8002cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8002cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d2:	48 98                	cltq
+  8002d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d8:	6a 00                	push   $0x0
+  8002da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8002e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002eb:	48 89 c2             	mov    %rax,%rdx
+  8002ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002f8:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+  800304:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800308:	90                   	nop
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+000000000080030b <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	48 83 ec 20          	sub    $0x20,%rsp
+  800313:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800316:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80031a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80031d:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  800320:	b8 05 00 00 00       	mov    $0x5,%eax
+  800325:	cd 30                	int    $0x30
+  800327:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80032b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80032f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800334:	7e 3d                	jle    800373 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  800336:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80033a:	49 89 c0             	mov    %rax,%r8
+  80033d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800342:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  800349:	00 00 00 
+  80034c:	48 89 c2             	mov    %rax,%rdx
+  80034f:	be 49 00 00 00       	mov    $0x49,%esi
+  800354:	48 b8 77 53 80 00 00 	movabs $0x805377,%rax
+  80035b:	00 00 00 
+  80035e:	48 89 c7             	mov    %rax,%rdi
+  800361:	b8 00 00 00 00       	mov    $0x0,%eax
+  800366:	49 b9 b5 32 80 00 00 	movabs $0x8032b5,%r9
+  80036d:	00 00 00 
+  800370:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800373:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800378:	75 13                	jne    80038d <sys_env_wait+0x82>
+  80037a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80037f:	74 0c                	je     80038d <sys_env_wait+0x82>
+    *status = st;
+  800381:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800385:	89 c2                	mov    %eax,%edx
+  800387:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80038b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80038d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+0000000000800393 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800393:	55                   	push   %rbp
+  800394:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800397:	48 83 ec 08          	sub    $0x8,%rsp
+  80039b:	6a 00                	push   $0x0
+  80039d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8003bd:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8003c4:	00 00 00 
+  8003c7:	ff d0                	call   *%rax
+  8003c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003cd:	c9                   	leave
+  8003ce:	c3                   	ret
+
+00000000008003cf <sys_yield>:
+
+void
+sys_yield(void) {
+  8003cf:	55                   	push   %rbp
+  8003d0:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8003d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d7:	6a 00                	push   $0x0
+  8003d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003f9:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+  800405:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800409:	90                   	nop
+  80040a:	c9                   	leave
+  80040b:	c3                   	ret
+
+000000000080040c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80040c:	55                   	push   %rbp
+  80040d:	48 89 e5             	mov    %rsp,%rbp
+  800410:	48 83 ec 20          	sub    $0x20,%rsp
+  800414:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800417:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80041b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80041e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800421:	48 63 c8             	movslq %eax,%rcx
+  800424:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800428:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80042b:	48 98                	cltq
+  80042d:	48 83 ec 08          	sub    $0x8,%rsp
+  800431:	6a 00                	push   $0x0
+  800433:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800439:	49 89 c8             	mov    %rcx,%r8
+  80043c:	48 89 d1             	mov    %rdx,%rcx
+  80043f:	48 89 c2             	mov    %rax,%rdx
+  800442:	be 01 00 00 00       	mov    $0x1,%esi
+  800447:	bf 06 00 00 00       	mov    $0x6,%edi
+  80044c:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800453:	00 00 00 
+  800456:	ff d0                	call   *%rax
+  800458:	48 83 c4 10          	add    $0x10,%rsp
+  80045c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80045f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+
+0000000000800464 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800464:	55                   	push   %rbp
+  800465:	48 89 e5             	mov    %rsp,%rbp
+  800468:	48 83 ec 20          	sub    $0x20,%rsp
+  80046c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80046f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800473:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800476:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80047a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80047e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800481:	48 63 c8             	movslq %eax,%rcx
+  800484:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800488:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80048b:	48 63 f0             	movslq %eax,%rsi
+  80048e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800492:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800495:	48 98                	cltq
+  800497:	48 83 ec 08          	sub    $0x8,%rsp
+  80049b:	51                   	push   %rcx
+  80049c:	49 89 f9             	mov    %rdi,%r9
+  80049f:	49 89 f0             	mov    %rsi,%r8
+  8004a2:	48 89 d1             	mov    %rdx,%rcx
+  8004a5:	48 89 c2             	mov    %rax,%rdx
+  8004a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ad:	bf 07 00 00 00       	mov    $0x7,%edi
+  8004b2:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8004b9:	00 00 00 
+  8004bc:	ff d0                	call   *%rax
+  8004be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004c2:	c9                   	leave
+  8004c3:	c3                   	ret
+
+00000000008004c4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8004c4:	55                   	push   %rbp
+  8004c5:	48 89 e5             	mov    %rsp,%rbp
+  8004c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8004cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8004d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004da:	48 98                	cltq
+  8004dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e0:	6a 00                	push   $0x0
+  8004e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004ee:	48 89 d1             	mov    %rdx,%rcx
+  8004f1:	48 89 c2             	mov    %rax,%rdx
+  8004f4:	be 01 00 00 00       	mov    $0x1,%esi
+  8004f9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004fe:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800505:	00 00 00 
+  800508:	ff d0                	call   *%rax
+  80050a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80050e:	c9                   	leave
+  80050f:	c3                   	ret
+
+0000000000800510 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	48 83 ec 10          	sub    $0x10,%rsp
+  800518:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80051b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80051e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800521:	48 63 d0             	movslq %eax,%rdx
+  800524:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800527:	48 98                	cltq
+  800529:	48 83 ec 08          	sub    $0x8,%rsp
+  80052d:	6a 00                	push   $0x0
+  80052f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053b:	48 89 d1             	mov    %rdx,%rcx
+  80053e:	48 89 c2             	mov    %rax,%rdx
+  800541:	be 01 00 00 00       	mov    $0x1,%esi
+  800546:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80054b:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800552:	00 00 00 
+  800555:	ff d0                	call   *%rax
+  800557:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80055b:	c9                   	leave
+  80055c:	c3                   	ret
+
+000000000080055d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	48 83 ec 10          	sub    $0x10,%rsp
+  800565:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800568:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80056c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800570:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800573:	48 98                	cltq
+  800575:	48 83 ec 08          	sub    $0x8,%rsp
+  800579:	6a 00                	push   $0x0
+  80057b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800587:	48 89 d1             	mov    %rdx,%rcx
+  80058a:	48 89 c2             	mov    %rax,%rdx
+  80058d:	be 01 00 00 00       	mov    $0x1,%esi
+  800592:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800597:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  80059e:	00 00 00 
+  8005a1:	ff d0                	call   *%rax
+  8005a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005a7:	c9                   	leave
+  8005a8:	c3                   	ret
+
+00000000008005a9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005a9:	55                   	push   %rbp
+  8005aa:	48 89 e5             	mov    %rsp,%rbp
+  8005ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8005b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8005b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005bf:	48 98                	cltq
+  8005c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c5:	6a 00                	push   $0x0
+  8005c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005d3:	48 89 d1             	mov    %rdx,%rcx
+  8005d6:	48 89 c2             	mov    %rax,%rdx
+  8005d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8005de:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8005e3:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8005ea:	00 00 00 
+  8005ed:	ff d0                	call   *%rax
+  8005ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005f3:	c9                   	leave
+  8005f4:	c3                   	ret
+
+00000000008005f5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005f5:	55                   	push   %rbp
+  8005f6:	48 89 e5             	mov    %rsp,%rbp
+  8005f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8005fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800600:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800604:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800608:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80060b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80060e:	48 63 f0             	movslq %eax,%rsi
+  800611:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800615:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800619:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80061c:	48 98                	cltq
+  80061e:	48 83 ec 08          	sub    $0x8,%rsp
+  800622:	6a 00                	push   $0x0
+  800624:	49 89 f1             	mov    %rsi,%r9
+  800627:	49 89 c8             	mov    %rcx,%r8
+  80062a:	48 89 d1             	mov    %rdx,%rcx
+  80062d:	48 89 c2             	mov    %rax,%rdx
+  800630:	be 00 00 00 00       	mov    $0x0,%esi
+  800635:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80063a:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800641:	00 00 00 
+  800644:	ff d0                	call   *%rax
+  800646:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80064a:	c9                   	leave
+  80064b:	c3                   	ret
+
+000000000080064c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80064c:	55                   	push   %rbp
+  80064d:	48 89 e5             	mov    %rsp,%rbp
+  800650:	48 83 ec 10          	sub    $0x10,%rsp
+  800654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  800658:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80065c:	48 83 ec 08          	sub    $0x8,%rsp
+  800660:	6a 00                	push   $0x0
+  800662:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800668:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80066e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800673:	48 89 c2             	mov    %rax,%rdx
+  800676:	be 01 00 00 00       	mov    $0x1,%esi
+  80067b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800680:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800687:	00 00 00 
+  80068a:	ff d0                	call   *%rax
+  80068c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800690:	c9                   	leave
+  800691:	c3                   	ret
+
+0000000000800692 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800692:	55                   	push   %rbp
+  800693:	48 89 e5             	mov    %rsp,%rbp
+  800696:	48 83 ec 10          	sub    $0x10,%rsp
+  80069a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80069e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8006a2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ae:	6a 00                	push   $0x0
+  8006b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006bc:	48 89 d1             	mov    %rdx,%rcx
+  8006bf:	48 89 c2             	mov    %rax,%rdx
+  8006c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8006c7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006cc:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8006d3:	00 00 00 
+  8006d6:	ff d0                	call   *%rax
+  8006d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006dc:	c9                   	leave
+  8006dd:	c3                   	ret
+
+00000000008006de <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006de:	55                   	push   %rbp
+  8006df:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8006e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e6:	6a 00                	push   $0x0
+  8006e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fe:	be 00 00 00 00       	mov    $0x0,%esi
+  800703:	bf 11 00 00 00       	mov    $0x11,%edi
+  800708:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  80070f:	00 00 00 
+  800712:	ff d0                	call   *%rax
+  800714:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+
+000000000080071a <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80071a:	55                   	push   %rbp
+  80071b:	48 89 e5             	mov    %rsp,%rbp
+  80071e:	48 83 ec 10          	sub    $0x10,%rsp
+  800722:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800726:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80072a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80072e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800732:	48 83 ec 08          	sub    $0x8,%rsp
+  800736:	6a 00                	push   $0x0
+  800738:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80073e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800744:	48 89 d1             	mov    %rdx,%rcx
+  800747:	48 89 c2             	mov    %rax,%rdx
+  80074a:	be 00 00 00 00       	mov    $0x0,%esi
+  80074f:	bf 12 00 00 00       	mov    $0x12,%edi
+  800754:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  80075b:	00 00 00 
+  80075e:	ff d0                	call   *%rax
+  800760:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+
+0000000000800766 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	48 83 ec 20          	sub    $0x20,%rsp
+  80076e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800772:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800776:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800779:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80077c:	48 63 c8             	movslq %eax,%rcx
+  80077f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800787:	48 83 ec 08          	sub    $0x8,%rsp
+  80078b:	6a 00                	push   $0x0
+  80078d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800793:	49 89 c8             	mov    %rcx,%r8
+  800796:	48 89 d1             	mov    %rdx,%rcx
+  800799:	48 89 c2             	mov    %rax,%rdx
+  80079c:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a1:	bf 13 00 00 00       	mov    $0x13,%edi
+  8007a6:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8007ad:	00 00 00 
+  8007b0:	ff d0                	call   *%rax
+  8007b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+00000000008007b8 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8007b8:	55                   	push   %rbp
+  8007b9:	48 89 e5             	mov    %rsp,%rbp
+  8007bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8007c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007c4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007c7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8007cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007cf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8007d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8007da:	6a 00                	push   $0x0
+  8007dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007e2:	49 89 c8             	mov    %rcx,%r8
+  8007e5:	48 89 d1             	mov    %rdx,%rcx
+  8007e8:	48 89 c2             	mov    %rax,%rdx
+  8007eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007f5:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8007fc:	00 00 00 
+  8007ff:	ff d0                	call   *%rax
+  800801:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800805:	c9                   	leave
+  800806:	c3                   	ret
+
+0000000000800807 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  800807:	55                   	push   %rbp
+  800808:	48 89 e5             	mov    %rsp,%rbp
+  80080b:	48 83 ec 10          	sub    $0x10,%rsp
+  80080f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800813:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  800816:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800819:	48 63 d0             	movslq %eax,%rdx
+  80081c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800820:	48 83 ec 08          	sub    $0x8,%rsp
+  800824:	6a 00                	push   $0x0
+  800826:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80082c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800832:	48 89 d1             	mov    %rdx,%rcx
+  800835:	48 89 c2             	mov    %rax,%rdx
+  800838:	be 00 00 00 00       	mov    $0x0,%esi
+  80083d:	bf 15 00 00 00       	mov    $0x15,%edi
+  800842:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800849:	00 00 00 
+  80084c:	ff d0                	call   *%rax
+  80084e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+0000000000800854 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  800854:	55                   	push   %rbp
+  800855:	48 89 e5             	mov    %rsp,%rbp
+  800858:	48 83 ec 20          	sub    $0x20,%rsp
+  80085c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800860:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800863:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800866:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80086a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80086e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800871:	48 63 c8             	movslq %eax,%rcx
+  800874:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800877:	48 63 d0             	movslq %eax,%rdx
+  80087a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087e:	48 83 ec 08          	sub    $0x8,%rsp
+  800882:	6a 00                	push   $0x0
+  800884:	49 89 f1             	mov    %rsi,%r9
+  800887:	49 89 c8             	mov    %rcx,%r8
+  80088a:	48 89 d1             	mov    %rdx,%rcx
+  80088d:	48 89 c2             	mov    %rax,%rdx
+  800890:	be 00 00 00 00       	mov    $0x0,%esi
+  800895:	bf 16 00 00 00       	mov    $0x16,%edi
+  80089a:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8008a1:	00 00 00 
+  8008a4:	ff d0                	call   *%rax
+  8008a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+
+00000000008008ac <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8008ac:	55                   	push   %rbp
+  8008ad:	48 89 e5             	mov    %rsp,%rbp
+  8008b0:	48 83 ec 30          	sub    $0x30,%rsp
+  8008b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008c0:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8008c4:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8008c8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008cc:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8008d0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8008d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e0:	51                   	push   %rcx
+  8008e1:	49 89 f9             	mov    %rdi,%r9
+  8008e4:	49 89 f0             	mov    %rsi,%r8
+  8008e7:	48 89 d1             	mov    %rdx,%rcx
+  8008ea:	48 89 c2             	mov    %rax,%rdx
+  8008ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f2:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008f7:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+  800903:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+0000000000800909 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  800909:	55                   	push   %rbp
+  80090a:	48 89 e5             	mov    %rsp,%rbp
+  80090d:	48 83 ec 10          	sub    $0x10,%rsp
+  800911:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  800914:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800917:	48 98                	cltq
+  800919:	48 83 ec 08          	sub    $0x8,%rsp
+  80091d:	6a 00                	push   $0x0
+  80091f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800925:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80092b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800930:	48 89 c2             	mov    %rax,%rdx
+  800933:	be 00 00 00 00       	mov    $0x0,%esi
+  800938:	bf 18 00 00 00       	mov    $0x18,%edi
+  80093d:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800944:	00 00 00 
+  800947:	ff d0                	call   *%rax
+  800949:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80094d:	90                   	nop
+  80094e:	c9                   	leave
+  80094f:	c3                   	ret
+
+0000000000800950 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800950:	55                   	push   %rbp
+  800951:	48 89 e5             	mov    %rsp,%rbp
+  800954:	48 83 ec 30          	sub    $0x30,%rsp
+  800958:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80095b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80095f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800963:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800966:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800969:	48 63 f0             	movslq %eax,%rsi
+  80096c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800970:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800974:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800977:	48 98                	cltq
+  800979:	48 83 ec 08          	sub    $0x8,%rsp
+  80097d:	6a 00                	push   $0x0
+  80097f:	49 89 f1             	mov    %rsi,%r9
+  800982:	49 89 c8             	mov    %rcx,%r8
+  800985:	48 89 d1             	mov    %rdx,%rcx
+  800988:	48 89 c2             	mov    %rax,%rdx
+  80098b:	be 01 00 00 00       	mov    $0x1,%esi
+  800990:	bf 19 00 00 00       	mov    $0x19,%edi
+  800995:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  80099c:	00 00 00 
+  80099f:	ff d0                	call   *%rax
+  8009a1:	48 83 c4 10          	add    $0x10,%rsp
+  8009a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8009a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8009ab:	c9                   	leave
+  8009ac:	c3                   	ret
+
+00000000008009ad <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8009ad:	55                   	push   %rbp
+  8009ae:	48 89 e5             	mov    %rsp,%rbp
+  8009b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8009b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009bd:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8009c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8009c3:	48 63 c8             	movslq %eax,%rcx
+  8009c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d2:	6a 00                	push   $0x0
+  8009d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009da:	49 89 c8             	mov    %rcx,%r8
+  8009dd:	48 89 d1             	mov    %rdx,%rcx
+  8009e0:	48 89 c2             	mov    %rax,%rdx
+  8009e3:	be 01 00 00 00       	mov    $0x1,%esi
+  8009e8:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8009ed:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  8009f4:	00 00 00 
+  8009f7:	ff d0                	call   *%rax
+  8009f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009fd:	c9                   	leave
+  8009fe:	c3                   	ret
+
+00000000008009ff <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009ff:	55                   	push   %rbp
+  800a00:	48 89 e5             	mov    %rsp,%rbp
+  800a03:	48 83 ec 20          	sub    $0x20,%rsp
+  800a07:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a0b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a0f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  800a13:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a17:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800a1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a23:	6a 00                	push   $0x0
+  800a25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a2b:	49 89 c8             	mov    %rcx,%r8
+  800a2e:	48 89 d1             	mov    %rdx,%rcx
+  800a31:	48 89 c2             	mov    %rax,%rdx
+  800a34:	be 01 00 00 00       	mov    $0x1,%esi
+  800a39:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  800a3e:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800a45:	00 00 00 
+  800a48:	ff d0                	call   *%rax
+  800a4a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+0000000000800a50 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a50:	55                   	push   %rbp
+  800a51:	48 89 e5             	mov    %rsp,%rbp
+  800a54:	48 83 ec 30          	sub    $0x30,%rsp
+  800a58:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a5c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a60:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a63:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a67:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a6e:	48 63 c8             	movslq %eax,%rcx
+  800a71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a79:	48 83 ec 08          	sub    $0x8,%rsp
+  800a7d:	6a 00                	push   $0x0
+  800a7f:	49 89 f1             	mov    %rsi,%r9
+  800a82:	49 89 c8             	mov    %rcx,%r8
+  800a85:	48 89 d1             	mov    %rdx,%rcx
+  800a88:	48 89 c2             	mov    %rax,%rdx
+  800a8b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a90:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a95:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800a9c:	00 00 00 
+  800a9f:	ff d0                	call   *%rax
+  800aa1:	48 83 c4 10          	add    $0x10,%rsp
+  800aa5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800aa8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+
+0000000000800aad <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800aad:	55                   	push   %rbp
+  800aae:	48 89 e5             	mov    %rsp,%rbp
+  800ab1:	48 83 ec 10          	sub    $0x10,%rsp
+  800ab5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800ab8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800abb:	48 98                	cltq
+  800abd:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac1:	6a 00                	push   $0x0
+  800ac3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ac9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800acf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad4:	48 89 c2             	mov    %rax,%rdx
+  800ad7:	be 01 00 00 00       	mov    $0x1,%esi
+  800adc:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800ae1:	48 b8 5c 01 80 00 00 	movabs $0x80015c,%rax
+  800ae8:	00 00 00 
+  800aeb:	ff d0                	call   *%rax
+  800aed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+0000000000800af3 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800af3:	55                   	push   %rbp
+  800af4:	48 89 e5             	mov    %rsp,%rbp
+  800af7:	48 83 ec 08          	sub    $0x8,%rsp
+  800afb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b03:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800b0a:	ff ff ff 
+  800b0d:	48 01 d0             	add    %rdx,%rax
+  800b10:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800b14:	c9                   	leave
+  800b15:	c3                   	ret
+
+0000000000800b16 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800b16:	55                   	push   %rbp
+  800b17:	48 89 e5             	mov    %rsp,%rbp
+  800b1a:	48 83 ec 08          	sub    $0x8,%rsp
+  800b1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b26:	48 89 c7             	mov    %rax,%rdi
+  800b29:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  800b30:	00 00 00 
+  800b33:	ff d0                	call   *%rax
+  800b35:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800b3b:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800b3f:	c9                   	leave
+  800b40:	c3                   	ret
+
+0000000000800b41 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800b41:	55                   	push   %rbp
+  800b42:	48 89 e5             	mov    %rsp,%rbp
+  800b45:	48 83 ec 18          	sub    $0x18,%rsp
+  800b49:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800b4d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b54:	e9 ae 00 00 00       	jmp    800c07 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b5c:	c1 e0 0c             	shl    $0xc,%eax
+  800b5f:	48 98                	cltq
+  800b61:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b66:	48 01 d0             	add    %rdx,%rax
+  800b69:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b71:	48 c1 e8 27          	shr    $0x27,%rax
+  800b75:	48 89 c2             	mov    %rax,%rdx
+  800b78:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b7f:	01 00 00 
+  800b82:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b86:	83 e0 01             	and    $0x1,%eax
+  800b89:	48 85 c0             	test   %rax,%rax
+  800b8c:	74 63                	je     800bf1 <fd_alloc+0xb0>
+  800b8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b92:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b96:	48 89 c2             	mov    %rax,%rdx
+  800b99:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800ba0:	01 00 00 
+  800ba3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ba7:	83 e0 01             	and    $0x1,%eax
+  800baa:	48 85 c0             	test   %rax,%rax
+  800bad:	74 42                	je     800bf1 <fd_alloc+0xb0>
+  800baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb3:	48 c1 e8 15          	shr    $0x15,%rax
+  800bb7:	48 89 c2             	mov    %rax,%rdx
+  800bba:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800bc1:	01 00 00 
+  800bc4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bc8:	83 e0 01             	and    $0x1,%eax
+  800bcb:	48 85 c0             	test   %rax,%rax
+  800bce:	74 21                	je     800bf1 <fd_alloc+0xb0>
+  800bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bd4:	48 c1 e8 0c          	shr    $0xc,%rax
+  800bd8:	48 89 c2             	mov    %rax,%rdx
+  800bdb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800be2:	01 00 00 
+  800be5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800be9:	83 e0 01             	and    $0x1,%eax
+  800bec:	48 85 c0             	test   %rax,%rax
+  800bef:	75 12                	jne    800c03 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800bf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800bf9:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c01:	eb 1e                	jmp    800c21 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800c03:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800c07:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800c0b:	0f 8e 48 ff ff ff    	jle    800b59 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800c11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c15:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800c1c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800c21:	c9                   	leave
+  800c22:	c3                   	ret
+
+0000000000800c23 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800c23:	55                   	push   %rbp
+  800c24:	48 89 e5             	mov    %rsp,%rbp
+  800c27:	48 83 ec 20          	sub    $0x20,%rsp
+  800c2b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800c2e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800c32:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800c36:	78 06                	js     800c3e <fd_lookup+0x1b>
+  800c38:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800c3c:	7e 0a                	jle    800c48 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c43:	e9 af 00 00 00       	jmp    800cf7 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800c48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c4b:	c1 e0 0c             	shl    $0xc,%eax
+  800c4e:	48 98                	cltq
+  800c50:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c55:	48 01 d0             	add    %rdx,%rax
+  800c58:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c60:	48 c1 e8 27          	shr    $0x27,%rax
+  800c64:	48 89 c2             	mov    %rax,%rdx
+  800c67:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c6e:	01 00 00 
+  800c71:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c75:	83 e0 01             	and    $0x1,%eax
+  800c78:	48 85 c0             	test   %rax,%rax
+  800c7b:	74 63                	je     800ce0 <fd_lookup+0xbd>
+  800c7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c81:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c85:	48 89 c2             	mov    %rax,%rdx
+  800c88:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c8f:	01 00 00 
+  800c92:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c96:	83 e0 01             	and    $0x1,%eax
+  800c99:	48 85 c0             	test   %rax,%rax
+  800c9c:	74 42                	je     800ce0 <fd_lookup+0xbd>
+  800c9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ca2:	48 c1 e8 15          	shr    $0x15,%rax
+  800ca6:	48 89 c2             	mov    %rax,%rdx
+  800ca9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800cb0:	01 00 00 
+  800cb3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cb7:	83 e0 01             	and    $0x1,%eax
+  800cba:	48 85 c0             	test   %rax,%rax
+  800cbd:	74 21                	je     800ce0 <fd_lookup+0xbd>
+  800cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cc3:	48 c1 e8 0c          	shr    $0xc,%rax
+  800cc7:	48 89 c2             	mov    %rax,%rdx
+  800cca:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800cd1:	01 00 00 
+  800cd4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cd8:	83 e0 01             	and    $0x1,%eax
+  800cdb:	48 85 c0             	test   %rax,%rax
+  800cde:	75 07                	jne    800ce7 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800ce0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce5:	eb 10                	jmp    800cf7 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800ce7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ceb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cef:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf7:	c9                   	leave
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800cf9:	55                   	push   %rbp
+  800cfa:	48 89 e5             	mov    %rsp,%rbp
+  800cfd:	48 83 ec 30          	sub    $0x30,%rsp
+  800d01:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d05:	89 f0                	mov    %esi,%eax
+  800d07:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0e:	48 89 c7             	mov    %rax,%rdi
+  800d11:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+  800d1d:	89 c2                	mov    %eax,%edx
+  800d1f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800d23:	48 89 c6             	mov    %rax,%rsi
+  800d26:	89 d7                	mov    %edx,%edi
+  800d28:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  800d2f:	00 00 00 
+  800d32:	ff d0                	call   *%rax
+  800d34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d3b:	78 0a                	js     800d47 <fd_close+0x4e>
+  800d3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d41:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800d45:	74 12                	je     800d59 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800d47:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800d4b:	74 05                	je     800d52 <fd_close+0x59>
+  800d4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d50:	eb 70                	jmp    800dc2 <fd_close+0xc9>
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	eb 69                	jmp    800dc2 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d5d:	8b 00                	mov    (%rax),%eax
+  800d5f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d63:	48 89 d6             	mov    %rdx,%rsi
+  800d66:	89 c7                	mov    %eax,%edi
+  800d68:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+  800d74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d77:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d7b:	78 2a                	js     800da7 <fd_close+0xae>
+    if (dev->dev_close)
+  800d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d81:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d85:	48 85 c0             	test   %rax,%rax
+  800d88:	74 16                	je     800da0 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d8e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d96:	48 89 c7             	mov    %rax,%rdi
+  800d99:	ff d2                	call   *%rdx
+  800d9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d9e:	eb 07                	jmp    800da7 <fd_close+0xae>
+    else
+      r = 0;
+  800da0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800da7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dab:	48 89 c6             	mov    %rax,%rsi
+  800dae:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db3:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+  return r;
+  800dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800dc2:	c9                   	leave
+  800dc3:	c3                   	ret
+
+0000000000800dc4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800dc4:	55                   	push   %rbp
+  800dc5:	48 89 e5             	mov    %rsp,%rbp
+  800dc8:	48 83 ec 20          	sub    $0x20,%rsp
+  800dcc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800dcf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800dd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800dda:	eb 3f                	jmp    800e1b <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800ddc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800de3:	00 00 00 
+  800de6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800de9:	48 98                	cltq
+  800deb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800def:	8b 00                	mov    (%rax),%eax
+  800df1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800df4:	75 21                	jne    800e17 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800df6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dfd:	00 00 00 
+  800e00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e03:	48 98                	cltq
+  800e05:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800e09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e0d:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e15:	eb 7f                	jmp    800e96 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800e17:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e1b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e22:	00 00 00 
+  800e25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e28:	48 98                	cltq
+  800e2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e2e:	48 85 c0             	test   %rax,%rax
+  800e31:	75 a9                	jne    800ddc <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e33:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800e3a:	00 00 00 
+  800e3d:	8b 40 04             	mov    0x4(%rax),%eax
+  800e40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e45:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800e4c:	00 00 00 
+  800e4f:	48 98                	cltq
+  800e51:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e58:	48 01 d0             	add    %rdx,%rax
+  800e5b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e61:	8b 00                	mov    (%rax),%eax
+  800e63:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e66:	89 c6                	mov    %eax,%esi
+  800e68:	48 b8 88 53 80 00 00 	movabs $0x805388,%rax
+  800e6f:	00 00 00 
+  800e72:	48 89 c7             	mov    %rax,%rdi
+  800e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7a:	48 b9 d4 34 80 00 00 	movabs $0x8034d4,%rcx
+  800e81:	00 00 00 
+  800e84:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e8a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e96:	c9                   	leave
+  800e97:	c3                   	ret
+
+0000000000800e98 <close>:
+
+int
+close(int fdnum) {
+  800e98:	55                   	push   %rbp
+  800e99:	48 89 e5             	mov    %rsp,%rbp
+  800e9c:	48 83 ec 20          	sub    $0x20,%rsp
+  800ea0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ea3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800ea7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800eaa:	48 89 d6             	mov    %rdx,%rsi
+  800ead:	89 c7                	mov    %eax,%edi
+  800eaf:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+  800ebb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ebe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ec2:	79 05                	jns    800ec9 <close+0x31>
+    return r;
+  800ec4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ec7:	eb 18                	jmp    800ee1 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800ec9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ecd:	be 01 00 00 00       	mov    $0x1,%esi
+  800ed2:	48 89 c7             	mov    %rax,%rdi
+  800ed5:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+}
+  800ee1:	c9                   	leave
+  800ee2:	c3                   	ret
+
+0000000000800ee3 <close_all>:
+
+void
+close_all(void) {
+  800ee3:	55                   	push   %rbp
+  800ee4:	48 89 e5             	mov    %rsp,%rbp
+  800ee7:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800eeb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ef2:	eb 15                	jmp    800f09 <close_all+0x26>
+    close(i);
+  800ef4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ef7:	89 c7                	mov    %eax,%edi
+  800ef9:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800f05:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800f09:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800f0d:	7e e5                	jle    800ef4 <close_all+0x11>
+}
+  800f0f:	90                   	nop
+  800f10:	90                   	nop
+  800f11:	c9                   	leave
+  800f12:	c3                   	ret
+
+0000000000800f13 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800f13:	55                   	push   %rbp
+  800f14:	48 89 e5             	mov    %rsp,%rbp
+  800f17:	48 83 ec 40          	sub    $0x40,%rsp
+  800f1b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800f1e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800f21:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800f25:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800f28:	48 89 d6             	mov    %rdx,%rsi
+  800f2b:	89 c7                	mov    %eax,%edi
+  800f2d:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  800f34:	00 00 00 
+  800f37:	ff d0                	call   *%rax
+  800f39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800f40:	79 08                	jns    800f4a <dup+0x37>
+    return r;
+  800f42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f45:	e9 33 02 00 00       	jmp    80117d <dup+0x26a>
+  close(newfdnum);
+  800f4a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f4d:	89 c7                	mov    %eax,%edi
+  800f4f:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f5b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f5e:	c1 e0 0c             	shl    $0xc,%eax
+  800f61:	48 98                	cltq
+  800f63:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f68:	48 01 d0             	add    %rdx,%rax
+  800f6b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f73:	48 89 c7             	mov    %rax,%rdi
+  800f76:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  800f7d:	00 00 00 
+  800f80:	ff d0                	call   *%rax
+  800f82:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f8a:	48 89 c7             	mov    %rax,%rdi
+  800f8d:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  800f94:	00 00 00 
+  800f97:	ff d0                	call   *%rax
+  800f99:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f9d:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800fa4:	00 
+  800fa5:	e9 19 01 00 00       	jmp    8010c3 <dup+0x1b0>
+    off -= PGSIZE;
+  800faa:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800fb1:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fb2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fba:	48 01 d0             	add    %rdx,%rax
+  800fbd:	48 c1 e8 27          	shr    $0x27,%rax
+  800fc1:	48 89 c2             	mov    %rax,%rdx
+  800fc4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800fcb:	01 00 00 
+  800fce:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fd2:	83 e0 01             	and    $0x1,%eax
+  800fd5:	48 85 c0             	test   %rax,%rax
+  800fd8:	0f 84 e5 00 00 00    	je     8010c3 <dup+0x1b0>
+  800fde:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fe2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe6:	48 01 d0             	add    %rdx,%rax
+  800fe9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800fed:	48 89 c2             	mov    %rax,%rdx
+  800ff0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800ff7:	01 00 00 
+  800ffa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ffe:	83 e0 01             	and    $0x1,%eax
+  801001:	48 85 c0             	test   %rax,%rax
+  801004:	0f 84 b9 00 00 00    	je     8010c3 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80100a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80100e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801012:	48 01 d0             	add    %rdx,%rax
+  801015:	48 c1 e8 15          	shr    $0x15,%rax
+  801019:	48 89 c2             	mov    %rax,%rdx
+  80101c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  801023:	01 00 00 
+  801026:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102a:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80102d:	48 85 c0             	test   %rax,%rax
+  801030:	0f 84 8d 00 00 00    	je     8010c3 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801036:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80103a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103e:	48 01 d0             	add    %rdx,%rax
+  801041:	48 c1 e8 0c          	shr    $0xc,%rax
+  801045:	48 89 c2             	mov    %rax,%rdx
+  801048:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80104f:	01 00 00 
+  801052:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801056:	83 e0 01             	and    $0x1,%eax
+  801059:	48 85 c0             	test   %rax,%rax
+  80105c:	74 65                	je     8010c3 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80105e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801062:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801066:	48 01 d0             	add    %rdx,%rax
+  801069:	48 c1 e8 0c          	shr    $0xc,%rax
+  80106d:	48 89 c2             	mov    %rax,%rdx
+  801070:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801077:	01 00 00 
+  80107a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80107e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801083:	89 c6                	mov    %eax,%esi
+  801085:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801089:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80108d:	48 01 c2             	add    %rax,%rdx
+  801090:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801094:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801098:	48 01 c8             	add    %rcx,%rax
+  80109b:	41 89 f0             	mov    %esi,%r8d
+  80109e:	48 89 d1             	mov    %rdx,%rcx
+  8010a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a6:	48 89 c6             	mov    %rax,%rsi
+  8010a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ae:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  8010b5:	00 00 00 
+  8010b8:	ff d0                	call   *%rax
+  8010ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010c1:	78 60                	js     801123 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8010c3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8010c8:	0f 85 dc fe ff ff    	jne    800faa <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010d2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8010d6:	48 89 c2             	mov    %rax,%rdx
+  8010d9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8010e0:	01 00 00 
+  8010e3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8010e7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010ec:	89 c1                	mov    %eax,%ecx
+  8010ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010f6:	41 89 c8             	mov    %ecx,%r8d
+  8010f9:	48 89 d1             	mov    %rdx,%rcx
+  8010fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801101:	48 89 c6             	mov    %rax,%rsi
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+  801109:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  801110:	00 00 00 
+  801113:	ff d0                	call   *%rax
+  801115:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801118:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80111c:	78 08                	js     801126 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80111e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801121:	eb 5a                	jmp    80117d <dup+0x26a>
+        goto err;
+  801123:	90                   	nop
+  801124:	eb 01                	jmp    801127 <dup+0x214>
+    goto err;
+  801126:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  801127:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80112b:	48 89 c6             	mov    %rax,%rsi
+  80112e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801133:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  80113a:	00 00 00 
+  80113d:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80113f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801146:	00 
+  801147:	eb 27                	jmp    801170 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  801149:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80114d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801151:	48 01 d0             	add    %rdx,%rax
+  801154:	48 89 c6             	mov    %rax,%rsi
+  801157:	bf 00 00 00 00       	mov    $0x0,%edi
+  80115c:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  801163:	00 00 00 
+  801166:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801168:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80116f:	00 
+  801170:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801177:	00 
+  801178:	76 cf                	jbe    801149 <dup+0x236>
+  return r;
+  80117a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80117d:	c9                   	leave
+  80117e:	c3                   	ret
+
+000000000080117f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80117f:	55                   	push   %rbp
+  801180:	48 89 e5             	mov    %rsp,%rbp
+  801183:	48 83 ec 40          	sub    $0x40,%rsp
+  801187:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80118a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80118e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801192:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801196:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801199:	48 89 d6             	mov    %rdx,%rsi
+  80119c:	89 c7                	mov    %eax,%edi
+  80119e:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  8011a5:	00 00 00 
+  8011a8:	ff d0                	call   *%rax
+  8011aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011b1:	78 24                	js     8011d7 <read+0x58>
+  8011b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b7:	8b 00                	mov    (%rax),%eax
+  8011b9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8011bd:	48 89 d6             	mov    %rdx,%rsi
+  8011c0:	89 c7                	mov    %eax,%edi
+  8011c2:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  8011c9:	00 00 00 
+  8011cc:	ff d0                	call   *%rax
+  8011ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011d5:	79 0a                	jns    8011e1 <read+0x62>
+    return r;
+  8011d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011da:	48 98                	cltq
+  8011dc:	e9 9e 00 00 00       	jmp    80127f <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e5:	8b 40 08             	mov    0x8(%rax),%eax
+  8011e8:	83 e0 03             	and    $0x3,%eax
+  8011eb:	83 f8 01             	cmp    $0x1,%eax
+  8011ee:	75 5c                	jne    80124c <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011f0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011f7:	00 00 00 
+  8011fa:	8b 40 04             	mov    0x4(%rax),%eax
+  8011fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801202:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801209:	00 00 00 
+  80120c:	48 98                	cltq
+  80120e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801215:	48 01 d0             	add    %rdx,%rax
+  801218:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80121e:	8b 00                	mov    (%rax),%eax
+  801220:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801223:	89 c6                	mov    %eax,%esi
+  801225:	48 b8 a7 53 80 00 00 	movabs $0x8053a7,%rax
+  80122c:	00 00 00 
+  80122f:	48 89 c7             	mov    %rax,%rdi
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+  801237:	48 b9 d4 34 80 00 00 	movabs $0x8034d4,%rcx
+  80123e:	00 00 00 
+  801241:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801243:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80124a:	eb 33                	jmp    80127f <read+0x100>
+  }
+  if (!dev->dev_read)
+  80124c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801250:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801254:	48 85 c0             	test   %rax,%rax
+  801257:	75 09                	jne    801262 <read+0xe3>
+    return -E_NOT_SUPP;
+  801259:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801260:	eb 1d                	jmp    80127f <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801262:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801266:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80126a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80126e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801272:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801276:	48 89 ce             	mov    %rcx,%rsi
+  801279:	48 89 c7             	mov    %rax,%rdi
+  80127c:	41 ff d0             	call   *%r8
+}
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+0000000000801281 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	48 83 ec 30          	sub    $0x30,%rsp
+  801289:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80128c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801290:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801294:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80129b:	eb 49                	jmp    8012e6 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80129d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012a0:	48 98                	cltq
+  8012a2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012a6:	48 29 c2             	sub    %rax,%rdx
+  8012a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ac:	48 63 c8             	movslq %eax,%rcx
+  8012af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012b3:	48 01 c1             	add    %rax,%rcx
+  8012b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012b9:	48 89 ce             	mov    %rcx,%rsi
+  8012bc:	89 c7                	mov    %eax,%edi
+  8012be:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8012c5:	00 00 00 
+  8012c8:	ff d0                	call   *%rax
+  8012ca:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8012cd:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012d1:	79 07                	jns    8012da <readn+0x59>
+      return m;
+  8012d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012d6:	48 98                	cltq
+  8012d8:	eb 1f                	jmp    8012f9 <readn+0x78>
+    if (m == 0)
+  8012da:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012de:	74 13                	je     8012f3 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8012e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012e3:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8012e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012e9:	48 98                	cltq
+  8012eb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012ef:	72 ac                	jb     80129d <readn+0x1c>
+  8012f1:	eb 01                	jmp    8012f4 <readn+0x73>
+      break;
+  8012f3:	90                   	nop
+  }
+  return tot;
+  8012f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012f7:	48 98                	cltq
+}
+  8012f9:	c9                   	leave
+  8012fa:	c3                   	ret
+
+00000000008012fb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012fb:	55                   	push   %rbp
+  8012fc:	48 89 e5             	mov    %rsp,%rbp
+  8012ff:	48 83 ec 40          	sub    $0x40,%rsp
+  801303:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801306:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80130a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80130e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801312:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801315:	48 89 d6             	mov    %rdx,%rsi
+  801318:	89 c7                	mov    %eax,%edi
+  80131a:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  801321:	00 00 00 
+  801324:	ff d0                	call   *%rax
+  801326:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801329:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80132d:	78 24                	js     801353 <write+0x58>
+  80132f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801333:	8b 00                	mov    (%rax),%eax
+  801335:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801339:	48 89 d6             	mov    %rdx,%rsi
+  80133c:	89 c7                	mov    %eax,%edi
+  80133e:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+  80134a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80134d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801351:	79 0a                	jns    80135d <write+0x62>
+    return r;
+  801353:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801356:	48 98                	cltq
+  801358:	e9 9d 00 00 00       	jmp    8013fa <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80135d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801361:	8b 40 08             	mov    0x8(%rax),%eax
+  801364:	83 e0 03             	and    $0x3,%eax
+  801367:	85 c0                	test   %eax,%eax
+  801369:	75 5c                	jne    8013c7 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80136b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801372:	00 00 00 
+  801375:	8b 40 04             	mov    0x4(%rax),%eax
+  801378:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80137d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801384:	00 00 00 
+  801387:	48 98                	cltq
+  801389:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801390:	48 01 d0             	add    %rdx,%rax
+  801393:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801399:	8b 00                	mov    (%rax),%eax
+  80139b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80139e:	89 c6                	mov    %eax,%esi
+  8013a0:	48 b8 c3 53 80 00 00 	movabs $0x8053c3,%rax
+  8013a7:	00 00 00 
+  8013aa:	48 89 c7             	mov    %rax,%rdi
+  8013ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b2:	48 b9 d4 34 80 00 00 	movabs $0x8034d4,%rcx
+  8013b9:	00 00 00 
+  8013bc:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8013be:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8013c5:	eb 33                	jmp    8013fa <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8013c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013cb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8013cf:	48 85 c0             	test   %rax,%rax
+  8013d2:	75 09                	jne    8013dd <write+0xe2>
+    return -E_NOT_SUPP;
+  8013d4:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8013db:	eb 1d                	jmp    8013fa <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8013dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e1:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8013e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8013ed:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8013f1:	48 89 ce             	mov    %rcx,%rsi
+  8013f4:	48 89 c7             	mov    %rax,%rdi
+  8013f7:	41 ff d0             	call   *%r8
+}
+  8013fa:	c9                   	leave
+  8013fb:	c3                   	ret
+
+00000000008013fc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013fc:	55                   	push   %rbp
+  8013fd:	48 89 e5             	mov    %rsp,%rbp
+  801400:	48 83 ec 18          	sub    $0x18,%rsp
+  801404:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801407:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80140e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801411:	48 89 d6             	mov    %rdx,%rsi
+  801414:	89 c7                	mov    %eax,%edi
+  801416:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  80141d:	00 00 00 
+  801420:	ff d0                	call   *%rax
+  801422:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801425:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801429:	79 05                	jns    801430 <seek+0x34>
+    return r;
+  80142b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80142e:	eb 0f                	jmp    80143f <seek+0x43>
+  fd->fd_offset = offset;
+  801430:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801434:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801437:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80143a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143f:	c9                   	leave
+  801440:	c3                   	ret
+
+0000000000801441 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801441:	55                   	push   %rbp
+  801442:	48 89 e5             	mov    %rsp,%rbp
+  801445:	48 83 ec 30          	sub    $0x30,%rsp
+  801449:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80144c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80144f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801453:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801456:	48 89 d6             	mov    %rdx,%rsi
+  801459:	89 c7                	mov    %eax,%edi
+  80145b:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  801462:	00 00 00 
+  801465:	ff d0                	call   *%rax
+  801467:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80146a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80146e:	78 24                	js     801494 <ftruncate+0x53>
+  801470:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801474:	8b 00                	mov    (%rax),%eax
+  801476:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80147a:	48 89 d6             	mov    %rdx,%rsi
+  80147d:	89 c7                	mov    %eax,%edi
+  80147f:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  801486:	00 00 00 
+  801489:	ff d0                	call   *%rax
+  80148b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80148e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801492:	79 08                	jns    80149c <ftruncate+0x5b>
+    return r;
+  801494:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801497:	e9 92 00 00 00       	jmp    80152e <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80149c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a0:	8b 40 08             	mov    0x8(%rax),%eax
+  8014a3:	83 e0 03             	and    $0x3,%eax
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	75 5a                	jne    801504 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8014aa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8014b1:	00 00 00 
+  8014b4:	8b 40 04             	mov    0x4(%rax),%eax
+  8014b7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014bc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8014c3:	00 00 00 
+  8014c6:	48 98                	cltq
+  8014c8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8014cf:	48 01 d0             	add    %rdx,%rax
+  8014d2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8014d8:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014da:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8014dd:	89 c6                	mov    %eax,%esi
+  8014df:	48 b8 e0 53 80 00 00 	movabs $0x8053e0,%rax
+  8014e6:	00 00 00 
+  8014e9:	48 89 c7             	mov    %rax,%rdi
+  8014ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f1:	48 b9 d4 34 80 00 00 	movabs $0x8034d4,%rcx
+  8014f8:	00 00 00 
+  8014fb:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801502:	eb 2a                	jmp    80152e <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801504:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801508:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80150c:	48 85 c0             	test   %rax,%rax
+  80150f:	75 07                	jne    801518 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  801511:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801516:	eb 16                	jmp    80152e <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  801518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  801520:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801524:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801527:	89 d6                	mov    %edx,%esi
+  801529:	48 89 c7             	mov    %rax,%rdi
+  80152c:	ff d1                	call   *%rcx
+}
+  80152e:	c9                   	leave
+  80152f:	c3                   	ret
+
+0000000000801530 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+  801534:	48 83 ec 30          	sub    $0x30,%rsp
+  801538:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80153b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80153f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801543:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801546:	48 89 d6             	mov    %rdx,%rsi
+  801549:	89 c7                	mov    %eax,%edi
+  80154b:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  801552:	00 00 00 
+  801555:	ff d0                	call   *%rax
+  801557:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80155a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80155e:	78 24                	js     801584 <fstat+0x54>
+  801560:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801564:	8b 00                	mov    (%rax),%eax
+  801566:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80156a:	48 89 d6             	mov    %rdx,%rsi
+  80156d:	89 c7                	mov    %eax,%edi
+  80156f:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+  80157b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80157e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801582:	79 05                	jns    801589 <fstat+0x59>
+    return r;
+  801584:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801587:	eb 5e                	jmp    8015e7 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801589:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80158d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801591:	48 85 c0             	test   %rax,%rax
+  801594:	75 07                	jne    80159d <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801596:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80159b:	eb 4a                	jmp    8015e7 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80159d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015a1:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8015a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015a8:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8015af:	00 00 00 
+  stat->st_isdir   = 0;
+  8015b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015b6:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8015bd:	00 00 00 
+  stat->st_dev     = dev;
+  8015c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015c8:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8015cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d3:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8015d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015db:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8015df:	48 89 d6             	mov    %rdx,%rsi
+  8015e2:	48 89 c7             	mov    %rax,%rdi
+  8015e5:	ff d1                	call   *%rcx
+}
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+
+00000000008015e9 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8015e9:	55                   	push   %rbp
+  8015ea:	48 89 e5             	mov    %rsp,%rbp
+  8015ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8015f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fd:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801603:	83 f8 20             	cmp    $0x20,%eax
+  801606:	75 07                	jne    80160f <pollwait_key+0x26>
+    return -E_INVAL;
+  801608:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80160d:	eb 5f                	jmp    80166e <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80160f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801613:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  801619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80161d:	48 63 d2             	movslq %edx,%rdx
+  801620:	48 c1 e2 04          	shl    $0x4,%rdx
+  801624:	48 01 c2             	add    %rax,%rdx
+  801627:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80162b:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80162e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801632:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  801638:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163c:	8b 00                	mov    (%rax),%eax
+  80163e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801642:	48 63 c9             	movslq %ecx,%rcx
+  801645:	48 c1 e1 04          	shl    $0x4,%rcx
+  801649:	48 01 ca             	add    %rcx,%rdx
+  80164c:	48 83 c2 08          	add    $0x8,%rdx
+  801650:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801652:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801656:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80165c:	8d 50 01             	lea    0x1(%rax),%edx
+  80165f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801663:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801669:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+
+0000000000801670 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801670:	55                   	push   %rbp
+  801671:	48 89 e5             	mov    %rsp,%rbp
+  801674:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80167b:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801682:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801688:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80168f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801696:	00 
+  int i, r, ready, ipc = 0;
+  801697:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80169e:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8016a5:	00 
+  8016a6:	74 45                	je     8016ed <poll+0x7d>
+  8016a8:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8016af:	ff 
+  8016b0:	74 3b                	je     8016ed <poll+0x7d>
+    now      = vsys_clock_ns();
+  8016b2:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  8016b9:	00 00 00 
+  8016bc:	ff d0                	call   *%rax
+  8016be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8016c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016c6:	48 f7 d0             	not    %rax
+  8016c9:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8016d0:	73 10                	jae    8016e2 <poll+0x72>
+  8016d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016d6:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8016dd:	48 01 d0             	add    %rdx,%rax
+  8016e0:	eb 07                	jmp    8016e9 <poll+0x79>
+  8016e2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8016e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8016ed:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016f4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016fb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801702:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  801709:	e9 46 02 00 00       	jmp    801954 <poll+0x2e4>
+      fds[i].revents = 0;
+  80170e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801711:	48 63 d0             	movslq %eax,%rdx
+  801714:	48 89 d0             	mov    %rdx,%rax
+  801717:	48 01 c0             	add    %rax,%rax
+  80171a:	48 01 d0             	add    %rdx,%rax
+  80171d:	48 c1 e0 02          	shl    $0x2,%rax
+  801721:	48 89 c2             	mov    %rax,%rdx
+  801724:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80172b:	48 01 d0             	add    %rdx,%rax
+  80172e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  801735:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801738:	48 63 d0             	movslq %eax,%rdx
+  80173b:	48 89 d0             	mov    %rdx,%rax
+  80173e:	48 01 c0             	add    %rax,%rax
+  801741:	48 01 d0             	add    %rdx,%rax
+  801744:	48 c1 e0 02          	shl    $0x2,%rax
+  801748:	48 89 c2             	mov    %rax,%rdx
+  80174b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801752:	48 01 d0             	add    %rdx,%rax
+  801755:	8b 00                	mov    (%rax),%eax
+  801757:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80175a:	75 62                	jne    8017be <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80175c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80175f:	48 63 d0             	movslq %eax,%rdx
+  801762:	48 89 d0             	mov    %rdx,%rax
+  801765:	48 01 c0             	add    %rax,%rax
+  801768:	48 01 d0             	add    %rdx,%rax
+  80176b:	48 c1 e0 02          	shl    $0x2,%rax
+  80176f:	48 89 c2             	mov    %rax,%rdx
+  801772:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801779:	48 01 d0             	add    %rdx,%rax
+  80177c:	8b 40 04             	mov    0x4(%rax),%eax
+  80177f:	83 e0 01             	and    $0x1,%eax
+  801782:	85 c0                	test   %eax,%eax
+  801784:	0f 84 9b 01 00 00    	je     801925 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80178a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80178d:	48 63 d0             	movslq %eax,%rdx
+  801790:	48 89 d0             	mov    %rdx,%rax
+  801793:	48 01 c0             	add    %rax,%rax
+  801796:	48 01 d0             	add    %rdx,%rax
+  801799:	48 c1 e0 02          	shl    $0x2,%rax
+  80179d:	48 89 c2             	mov    %rax,%rdx
+  8017a0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017a7:	48 01 c2             	add    %rax,%rdx
+  8017aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017ad:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8017b0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8017b3:	83 c8 04             	or     $0x4,%eax
+  8017b6:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8017b9:	e9 67 01 00 00       	jmp    801925 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017c1:	48 63 d0             	movslq %eax,%rdx
+  8017c4:	48 89 d0             	mov    %rdx,%rax
+  8017c7:	48 01 c0             	add    %rax,%rax
+  8017ca:	48 01 d0             	add    %rdx,%rax
+  8017cd:	48 c1 e0 02          	shl    $0x2,%rax
+  8017d1:	48 89 c2             	mov    %rax,%rdx
+  8017d4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017db:	48 01 d0             	add    %rdx,%rax
+  8017de:	8b 00                	mov    (%rax),%eax
+  8017e0:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8017e7:	48 89 d6             	mov    %rdx,%rsi
+  8017ea:	89 c7                	mov    %eax,%edi
+  8017ec:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  8017f3:	00 00 00 
+  8017f6:	ff d0                	call   *%rax
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 25                	js     801821 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017fc:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801803:	8b 00                	mov    (%rax),%eax
+  801805:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80180c:	48 89 d6             	mov    %rdx,%rsi
+  80180f:	89 c7                	mov    %eax,%edi
+  801811:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	79 2c                	jns    80184d <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  801821:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801824:	48 63 d0             	movslq %eax,%rdx
+  801827:	48 89 d0             	mov    %rdx,%rax
+  80182a:	48 01 c0             	add    %rax,%rax
+  80182d:	48 01 d0             	add    %rdx,%rax
+  801830:	48 c1 e0 02          	shl    $0x2,%rax
+  801834:	48 89 c2             	mov    %rax,%rdx
+  801837:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80183e:	48 01 d0             	add    %rdx,%rax
+  801841:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  801848:	e9 d8 00 00 00       	jmp    801925 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80184d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801854:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801858:	48 85 c0             	test   %rax,%rax
+  80185b:	74 7d                	je     8018da <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80185d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801864:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801868:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80186b:	48 63 d0             	movslq %eax,%rdx
+  80186e:	48 89 d0             	mov    %rdx,%rax
+  801871:	48 01 c0             	add    %rax,%rax
+  801874:	48 01 d0             	add    %rdx,%rax
+  801877:	48 c1 e0 02          	shl    $0x2,%rax
+  80187b:	48 89 c2             	mov    %rax,%rdx
+  80187e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801885:	48 01 d0             	add    %rdx,%rax
+  801888:	8b 48 04             	mov    0x4(%rax),%ecx
+  80188b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801892:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801899:	89 ce                	mov    %ecx,%esi
+  80189b:	48 89 c7             	mov    %rax,%rdi
+  80189e:	41 ff d0             	call   *%r8
+  8018a1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8018a4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8018a8:	79 08                	jns    8018b2 <poll+0x242>
+          return r;
+  8018aa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018ad:	e9 45 01 00 00       	jmp    8019f7 <poll+0x387>
+        fds[i].revents = r;
+  8018b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b5:	48 63 d0             	movslq %eax,%rdx
+  8018b8:	48 89 d0             	mov    %rdx,%rax
+  8018bb:	48 01 c0             	add    %rax,%rax
+  8018be:	48 01 d0             	add    %rdx,%rax
+  8018c1:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c5:	48 89 c2             	mov    %rax,%rdx
+  8018c8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018cf:	48 01 c2             	add    %rax,%rdx
+  8018d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018d5:	89 42 08             	mov    %eax,0x8(%rdx)
+  8018d8:	eb 4b                	jmp    801925 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8018da:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018dd:	48 63 d0             	movslq %eax,%rdx
+  8018e0:	48 89 d0             	mov    %rdx,%rax
+  8018e3:	48 01 c0             	add    %rax,%rax
+  8018e6:	48 01 d0             	add    %rdx,%rax
+  8018e9:	48 c1 e0 02          	shl    $0x2,%rax
+  8018ed:	48 89 c2             	mov    %rax,%rdx
+  8018f0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018f7:	48 01 d0             	add    %rdx,%rax
+  8018fa:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801900:	48 63 d0             	movslq %eax,%rdx
+  801903:	48 89 d0             	mov    %rdx,%rax
+  801906:	48 01 c0             	add    %rax,%rax
+  801909:	48 01 d0             	add    %rdx,%rax
+  80190c:	48 c1 e0 02          	shl    $0x2,%rax
+  801910:	48 89 c2             	mov    %rax,%rdx
+  801913:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80191a:	48 01 d0             	add    %rdx,%rax
+  80191d:	83 e1 03             	and    $0x3,%ecx
+  801920:	89 ca                	mov    %ecx,%edx
+  801922:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  801925:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801928:	48 63 d0             	movslq %eax,%rdx
+  80192b:	48 89 d0             	mov    %rdx,%rax
+  80192e:	48 01 c0             	add    %rax,%rax
+  801931:	48 01 d0             	add    %rdx,%rax
+  801934:	48 c1 e0 02          	shl    $0x2,%rax
+  801938:	48 89 c2             	mov    %rax,%rdx
+  80193b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801942:	48 01 d0             	add    %rdx,%rax
+  801945:	8b 40 08             	mov    0x8(%rax),%eax
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	74 04                	je     801950 <poll+0x2e0>
+        ready++;
+  80194c:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801950:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801954:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801957:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80195d:	0f 8c ab fd ff ff    	jl     80170e <poll+0x9e>
+    }
+    if (ready)
+  801963:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801967:	74 08                	je     801971 <poll+0x301>
+      return ready;
+  801969:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80196c:	e9 86 00 00 00       	jmp    8019f7 <poll+0x387>
+
+    if (deadline) {
+  801971:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801976:	74 30                	je     8019a8 <poll+0x338>
+      now     = vsys_clock_ns();
+  801978:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  80197f:	00 00 00 
+  801982:	ff d0                	call   *%rax
+  801984:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801988:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80198c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801990:	73 0a                	jae    80199c <poll+0x32c>
+  801992:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801996:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80199a:	eb 05                	jmp    8019a1 <poll+0x331>
+  80199c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a1:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8019a8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019ab:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8019ae:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8019b5:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8019bc:	48 89 c7             	mov    %rax,%rdi
+  8019bf:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+  8019cb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8019ce:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8019d2:	75 07                	jne    8019db <poll+0x36b>
+      return 0;
+  8019d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d9:	eb 1c                	jmp    8019f7 <poll+0x387>
+    if (r < 0)
+  8019db:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8019df:	79 05                	jns    8019e6 <poll+0x376>
+      return r;
+  8019e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019e4:	eb 11                	jmp    8019f7 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8019e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019e9:	c1 f8 02             	sar    $0x2,%eax
+  8019ec:	83 e0 01             	and    $0x1,%eax
+  8019ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8019f2:	e9 f6 fc ff ff       	jmp    8016ed <poll+0x7d>
+  }
+}
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+00000000008019f9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	48 83 ec 20          	sub    $0x20,%rsp
+  801a01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a05:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  801a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a12:	48 89 c7             	mov    %rax,%rdi
+  801a15:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+  801a21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801a24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a28:	79 05                	jns    801a2f <stat+0x36>
+    return fd;
+  801a2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a2d:	eb 2f                	jmp    801a5e <stat+0x65>
+  r = fstat(fd, stat);
+  801a2f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a36:	48 89 d6             	mov    %rdx,%rsi
+  801a39:	89 c7                	mov    %eax,%edi
+  801a3b:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  801a42:	00 00 00 
+  801a45:	ff d0                	call   *%rax
+  801a47:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  801a4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a4d:	89 c7                	mov    %eax,%edi
+  801a4f:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  801a56:	00 00 00 
+  801a59:	ff d0                	call   *%rax
+  return r;
+  801a5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+0000000000801a60 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a60:	55                   	push   %rbp
+  801a61:	48 89 e5             	mov    %rsp,%rbp
+  801a64:	48 83 ec 10          	sub    $0x10,%rsp
+  801a68:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a6f:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  801a76:	00 00 00 
+  801a79:	8b 00                	mov    (%rax),%eax
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	75 1d                	jne    801a9c <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a7f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a84:	48 b8 cc 51 80 00 00 	movabs $0x8051cc,%rax
+  801a8b:	00 00 00 
+  801a8e:	ff d0                	call   *%rax
+  801a90:	48 ba 00 c0 80 00 00 	movabs $0x80c000,%rdx
+  801a97:	00 00 00 
+  801a9a:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a9c:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  801aa3:	00 00 00 
+  801aa6:	8b 00                	mov    (%rax),%eax
+  801aa8:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801aab:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ab0:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801ab7:	00 00 00 
+  801aba:	89 c7                	mov    %eax,%edi
+  801abc:	48 b8 1f 51 80 00 00 	movabs $0x80511f,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801ac8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801acc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad1:	48 89 c6             	mov    %rax,%rsi
+  801ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad9:	48 b8 a2 4f 80 00 00 	movabs $0x804fa2,%rax
+  801ae0:	00 00 00 
+  801ae3:	ff d0                	call   *%rax
+}
+  801ae5:	c9                   	leave
+  801ae6:	c3                   	ret
+
+0000000000801ae7 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801ae7:	55                   	push   %rbp
+  801ae8:	48 89 e5             	mov    %rsp,%rbp
+  801aeb:	48 83 ec 20          	sub    $0x20,%rsp
+  801aef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801af3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801af6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801afa:	48 89 c7             	mov    %rax,%rdi
+  801afd:	48 b8 83 43 80 00 00 	movabs $0x804383,%rax
+  801b04:	00 00 00 
+  801b07:	ff d0                	call   *%rax
+  801b09:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b0e:	7e 0a                	jle    801b1a <open+0x33>
+    return -E_BAD_PATH;
+  801b10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b15:	e9 a8 00 00 00       	jmp    801bc2 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801b1a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801b1e:	48 89 c7             	mov    %rax,%rdi
+  801b21:	48 b8 41 0b 80 00 00 	movabs $0x800b41,%rax
+  801b28:	00 00 00 
+  801b2b:	ff d0                	call   *%rax
+  801b2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b34:	79 08                	jns    801b3e <open+0x57>
+    return r;
+  801b36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b39:	e9 84 00 00 00       	jmp    801bc2 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b42:	48 89 c6             	mov    %rax,%rsi
+  801b45:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  801b4c:	00 00 00 
+  801b4f:	48 89 c7             	mov    %rax,%rdi
+  801b52:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b5e:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801b65:	00 00 00 
+  801b68:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b6b:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b75:	48 89 c6             	mov    %rax,%rsi
+  801b78:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b7d:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801b84:	00 00 00 
+  801b87:	ff d0                	call   *%rax
+  801b89:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b90:	79 1d                	jns    801baf <open+0xc8>
+    fd_close(fd, 0);
+  801b92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b96:	be 00 00 00 00       	mov    $0x0,%esi
+  801b9b:	48 89 c7             	mov    %rax,%rdi
+  801b9e:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+    return r;
+  801baa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bad:	eb 13                	jmp    801bc2 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb3:	48 89 c7             	mov    %rax,%rdi
+  801bb6:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+}
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801bcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd4:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bd7:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801bde:	00 00 00 
+  801be1:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801be3:	be 00 00 00 00       	mov    $0x0,%esi
+  801be8:	bf 06 00 00 00       	mov    $0x6,%edi
+  801bed:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801bf4:	00 00 00 
+  801bf7:	ff d0                	call   *%rax
+}
+  801bf9:	c9                   	leave
+  801bfa:	c3                   	ret
+
+0000000000801bfb <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801bfb:	55                   	push   %rbp
+  801bfc:	48 89 e5             	mov    %rsp,%rbp
+  801bff:	48 83 ec 30          	sub    $0x30,%rsp
+  801c03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c07:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c0b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c0f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c14:	74 07                	je     801c1d <devfile_read+0x22>
+  801c16:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801c1b:	75 0a                	jne    801c27 <devfile_read+0x2c>
+  return E_INVAL;
+  801c1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c22:	e9 b4 00 00 00       	jmp    801cdb <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801c27:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801c2e:	00 
+  while (n) {
+  801c2f:	e9 98 00 00 00       	jmp    801ccc <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c38:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c3b:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801c42:	00 00 00 
+  801c45:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801c47:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801c4e:	00 00 00 
+  801c51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c55:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c59:	be 00 00 00 00       	mov    $0x0,%esi
+  801c5e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c63:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801c6a:	00 00 00 
+  801c6d:	ff d0                	call   *%rax
+  801c6f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c72:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c76:	7f 13                	jg     801c8b <devfile_read+0x90>
+      return res ? res : res0;
+  801c78:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c7c:	74 07                	je     801c85 <devfile_read+0x8a>
+  801c7e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c81:	48 98                	cltq
+  801c83:	eb 56                	jmp    801cdb <devfile_read+0xe0>
+  801c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c89:	eb 50                	jmp    801cdb <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c8b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c8e:	48 63 d0             	movslq %eax,%rdx
+  801c91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c95:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  801c9c:	00 00 00 
+  801c9f:	48 89 ce             	mov    %rcx,%rsi
+  801ca2:	48 89 c7             	mov    %rax,%rdi
+  801ca5:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+
+    buf += res;
+  801cb1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cb4:	48 98                	cltq
+  801cb6:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801cba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cbd:	48 98                	cltq
+  801cbf:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801cc3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cc6:	48 98                	cltq
+  801cc8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801ccc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cd1:	0f 85 5d ff ff ff    	jne    801c34 <devfile_read+0x39>
+  }
+
+  return res0;
+  801cd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+
+0000000000801cdd <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801cdd:	55                   	push   %rbp
+  801cde:	48 89 e5             	mov    %rsp,%rbp
+  801ce1:	48 83 ec 50          	sub    $0x50,%rsp
+  801ce5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ce9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801ced:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801cf1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801cf6:	74 07                	je     801cff <devfile_write+0x22>
+  801cf8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801cfd:	75 0a                	jne    801d09 <devfile_write+0x2c>
+  return E_INVAL;
+  801cff:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d04:	e9 c9 00 00 00       	jmp    801dd2 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801d09:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801d10:	00 
+
+  while (n) {
+  801d11:	e9 ad 00 00 00       	jmp    801dc3 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d16:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801d1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801d1e:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801d25:	00 
+  801d26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d2e:	48 39 c2             	cmp    %rax,%rdx
+  801d31:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801d35:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801d39:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801d3d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d41:	48 89 c6             	mov    %rax,%rsi
+  801d44:	48 b8 10 b0 80 00 00 	movabs $0x80b010,%rax
+  801d4b:	00 00 00 
+  801d4e:	48 89 c7             	mov    %rax,%rdi
+  801d51:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d61:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d64:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801d6b:	00 00 00 
+  801d6e:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d70:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801d77:	00 00 00 
+  801d7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d7e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d82:	be 00 00 00 00       	mov    $0x0,%esi
+  801d87:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d8c:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801d93:	00 00 00 
+  801d96:	ff d0                	call   *%rax
+  801d98:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d9b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d9f:	79 07                	jns    801da8 <devfile_write+0xcb>
+      return res;
+  801da1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801da4:	48 98                	cltq
+  801da6:	eb 2a                	jmp    801dd2 <devfile_write+0xf5>
+
+    buf += res;
+  801da8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dab:	48 98                	cltq
+  801dad:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801db1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801db4:	48 98                	cltq
+  801db6:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801dba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dbd:	48 98                	cltq
+  801dbf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801dc3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801dc8:	0f 85 48 ff ff ff    	jne    801d16 <devfile_write+0x39>
+  }
+
+  return res0;
+  801dce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801dd2:	c9                   	leave
+  801dd3:	c3                   	ret
+
+0000000000801dd4 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801dd4:	55                   	push   %rbp
+  801dd5:	48 89 e5             	mov    %rsp,%rbp
+  801dd8:	48 83 ec 20          	sub    $0x20,%rsp
+  801ddc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801de0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801de4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de8:	8b 40 0c             	mov    0xc(%rax),%eax
+  801deb:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801df2:	00 00 00 
+  801df5:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801df7:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfc:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e01:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801e08:	00 00 00 
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801e10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e14:	79 05                	jns    801e1b <devfile_stat+0x47>
+    return r;
+  801e16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e19:	eb 59                	jmp    801e74 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e1f:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801e26:	00 00 00 
+  801e29:	48 89 d6             	mov    %rdx,%rsi
+  801e2c:	48 89 c7             	mov    %rax,%rdi
+  801e2f:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801e3b:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  801e42:	00 00 00 
+  801e45:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801e4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e4f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e55:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  801e5c:	00 00 00 
+  801e5f:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e69:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e74:	c9                   	leave
+  801e75:	c3                   	ret
+
+0000000000801e76 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e76:	55                   	push   %rbp
+  801e77:	48 89 e5             	mov    %rsp,%rbp
+  801e7a:	48 83 ec 10          	sub    $0x10,%rsp
+  801e7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e82:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e89:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e8c:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801e93:	00 00 00 
+  801e96:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e98:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801e9f:	00 00 00 
+  801ea2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ea5:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ea8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ead:	bf 02 00 00 00       	mov    $0x2,%edi
+  801eb2:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+}
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ecc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801ecf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801ed3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ed6:	83 e0 03             	and    $0x3,%eax
+}
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+0000000000801edb <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801edb:	55                   	push   %rbp
+  801edc:	48 89 e5             	mov    %rsp,%rbp
+  801edf:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801ee7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eeb:	48 89 c7             	mov    %rax,%rdi
+  801eee:	48 b8 83 43 80 00 00 	movabs $0x804383,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+  801efa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eff:	7e 07                	jle    801f08 <remove+0x2d>
+    return -E_BAD_PATH;
+  801f01:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f06:	eb 36                	jmp    801f3e <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801f08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f0c:	48 89 c6             	mov    %rax,%rsi
+  801f0f:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  801f16:	00 00 00 
+  801f19:	48 89 c7             	mov    %rax,%rdi
+  801f1c:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  801f23:	00 00 00 
+  801f26:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801f28:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2d:	bf 07 00 00 00       	mov    $0x7,%edi
+  801f32:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801f39:	00 00 00 
+  801f3c:	ff d0                	call   *%rax
+}
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+
+0000000000801f40 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801f40:	55                   	push   %rbp
+  801f41:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f44:	be 00 00 00 00       	mov    $0x0,%esi
+  801f49:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f4e:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+}
+  801f5a:	5d                   	pop    %rbp
+  801f5b:	c3                   	ret
+
+0000000000801f5c <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	48 83 ec 20          	sub    $0x20,%rsp
+  801f64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f68:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6d:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f72:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801f79:	00 00 00 
+  801f7c:	ff d0                	call   *%rax
+  801f7e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f81:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f85:	79 05                	jns    801f8c <fs_stats+0x30>
+    return r;
+  801f87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f8a:	eb 2a                	jmp    801fb6 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f90:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f95:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  801f9c:	00 00 00 
+  801f9f:	48 89 ce             	mov    %rcx,%rsi
+  801fa2:	48 89 c7             	mov    %rax,%rdi
+  801fa5:	48 b8 c7 49 80 00 00 	movabs $0x8049c7,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+  return 0;
+  801fb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+
+0000000000801fb8 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801fb8:	55                   	push   %rbp
+  801fb9:	48 89 e5             	mov    %rsp,%rbp
+  801fbc:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801fc3:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  801fca:	00 00 00 
+  801fcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fd0:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801fdc:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+}
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+
+0000000000801fea <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+  801fee:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff2:	89 f8                	mov    %edi,%eax
+  801ff4:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801ff7:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801ffb:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  802002:	00 00 00 
+  802005:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  802007:	be 00 00 00 00       	mov    $0x0,%esi
+  80200c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802011:	48 b8 60 1a 80 00 00 	movabs $0x801a60,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+}
+  80201d:	c9                   	leave
+  80201e:	c3                   	ret
+
+000000000080201f <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	48 83 ec 20          	sub    $0x20,%rsp
+  802027:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  80202b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80202f:	8b 40 10             	mov    0x10(%rax),%eax
+  802032:	85 c0                	test   %eax,%eax
+  802034:	7e 73                	jle    8020a9 <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  802036:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80203a:	8b 40 04             	mov    0x4(%rax),%eax
+  80203d:	48 63 d0             	movslq %eax,%rdx
+  802040:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802044:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  802048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204c:	8b 00                	mov    (%rax),%eax
+  80204e:	48 89 ce             	mov    %rcx,%rsi
+  802051:	89 c7                	mov    %eax,%edi
+  802053:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+  80205f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  802063:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802068:	7e 17                	jle    802081 <writebuf+0x62>
+      b->result += result;
+  80206a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802076:	48 01 c2             	add    %rax,%rdx
+  802079:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80207d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  802081:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802085:	8b 40 04             	mov    0x4(%rax),%eax
+  802088:	48 98                	cltq
+  80208a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80208e:	74 19                	je     8020a9 <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  802090:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802094:	ba 00 00 00 00       	mov    $0x0,%edx
+  802099:	48 85 c0             	test   %rax,%rax
+  80209c:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8020a0:	89 c2                	mov    %eax,%edx
+  8020a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020a6:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  8020a9:	90                   	nop
+  8020aa:	c9                   	leave
+  8020ab:	c3                   	ret
+
+00000000008020ac <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  8020ac:	55                   	push   %rbp
+  8020ad:	48 89 e5             	mov    %rsp,%rbp
+  8020b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8020b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  8020bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  8020c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020c7:	8b 40 04             	mov    0x4(%rax),%eax
+  8020ca:	8d 48 01             	lea    0x1(%rax),%ecx
+  8020cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020d1:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  8020d4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8020d7:	89 d1                	mov    %edx,%ecx
+  8020d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020dd:	48 98                	cltq
+  8020df:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  8020e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8020ea:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8020ef:	75 1e                	jne    80210f <putch+0x63>
+    writebuf(b);
+  8020f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020f5:	48 89 c7             	mov    %rax,%rdi
+  8020f8:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+    b->idx = 0;
+  802104:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802108:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  80210f:	90                   	nop
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+0000000000802112 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80211d:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  802123:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  80212a:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  802131:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  802137:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  80213d:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  802144:	00 00 00 
+  b.result = 0;
+  802147:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  80214e:	00 00 00 00 
+  b.error  = 1;
+  802152:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  802159:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  80215c:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  802163:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  80216a:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  802171:	48 89 c6             	mov    %rax,%rsi
+  802174:	48 b8 ac 20 80 00 00 	movabs $0x8020ac,%rax
+  80217b:	00 00 00 
+  80217e:	48 89 c7             	mov    %rax,%rdi
+  802181:	48 b8 2e 38 80 00 00 	movabs $0x80382e,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  80218d:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  802193:	85 c0                	test   %eax,%eax
+  802195:	7e 16                	jle    8021ad <vfprintf+0x9b>
+    writebuf(&b);
+  802197:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80219e:	48 89 c7             	mov    %rax,%rdi
+  8021a1:	48 b8 1f 20 80 00 00 	movabs $0x80201f,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  8021ad:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8021b4:	48 85 c0             	test   %rax,%rax
+  8021b7:	74 09                	je     8021c2 <vfprintf+0xb0>
+  8021b9:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8021c0:	eb 06                	jmp    8021c8 <vfprintf+0xb6>
+  8021c2:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  8021c8:	c9                   	leave
+  8021c9:	c3                   	ret
+
+00000000008021ca <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8021ca:	55                   	push   %rbp
+  8021cb:	48 89 e5             	mov    %rsp,%rbp
+  8021ce:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8021d5:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  8021db:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8021e2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8021e9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8021f0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8021f7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8021fe:	84 c0                	test   %al,%al
+  802200:	74 20                	je     802222 <fprintf+0x58>
+  802202:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  802206:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80220a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80220e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  802212:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  802216:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80221a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80221e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802222:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  802229:	00 00 00 
+  80222c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  802233:	00 00 00 
+  802236:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80223a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  802241:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802248:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  80224f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  802256:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  80225d:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  802263:	48 89 ce             	mov    %rcx,%rsi
+  802266:	89 c7                	mov    %eax,%edi
+  802268:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+  802274:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80227a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+0000000000802282 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  802282:	55                   	push   %rbp
+  802283:	48 89 e5             	mov    %rsp,%rbp
+  802286:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80228d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  802294:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80229b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8022a2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8022a9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8022b0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8022b7:	84 c0                	test   %al,%al
+  8022b9:	74 20                	je     8022db <printf+0x59>
+  8022bb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8022bf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8022c3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8022c7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8022cb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8022cf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8022d3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8022d7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8022db:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8022e2:	00 00 00 
+  8022e5:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8022ec:	00 00 00 
+  8022ef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022f3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8022fa:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802301:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  802308:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80230f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  802316:	48 89 c6             	mov    %rax,%rsi
+  802319:	bf 01 00 00 00       	mov    $0x1,%edi
+  80231e:	48 b8 12 21 80 00 00 	movabs $0x802112,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  802330:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  802336:	c9                   	leave
+  802337:	c3                   	ret
+
+0000000000802338 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  802338:	55                   	push   %rbp
+  802339:	48 89 e5             	mov    %rsp,%rbp
+  80233c:	48 83 ec 10          	sub    $0x10,%rsp
+  802340:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  802344:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802348:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80234d:	48 89 c7             	mov    %rax,%rdi
+  802350:	48 b8 5e 23 80 00 00 	movabs $0x80235e,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+}
+  80235c:	c9                   	leave
+  80235d:	c3                   	ret
+
+000000000080235e <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  80235e:	55                   	push   %rbp
+  80235f:	48 89 e5             	mov    %rsp,%rbp
+  802362:	48 83 ec 50          	sub    $0x50,%rsp
+  802366:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80236a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  80236e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802375:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  802376:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80237b:	74 0a                	je     802387 <pipe_size+0x29>
+  80237d:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802384:	00 
+  802385:	76 0a                	jbe    802391 <pipe_size+0x33>
+    return -E_INVAL;
+  802387:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238c:	e9 cc 02 00 00       	jmp    80265d <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802391:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802395:	48 89 c7             	mov    %rax,%rdi
+  802398:	48 b8 41 0b 80 00 00 	movabs $0x800b41,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8023ab:	0f 88 a8 02 00 00    	js     802659 <pipe_size+0x2fb>
+  8023b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023b5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8023ba:	48 89 c6             	mov    %rax,%rsi
+  8023bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023c2:	48 b8 0c 04 80 00 00 	movabs $0x80040c,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+  8023ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8023d5:	0f 88 7e 02 00 00    	js     802659 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8023db:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8023df:	48 89 c7             	mov    %rax,%rdi
+  8023e2:	48 b8 41 0b 80 00 00 	movabs $0x800b41,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023f1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8023f5:	0f 88 43 02 00 00    	js     80263e <pipe_size+0x2e0>
+  8023fb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ff:	ba 07 04 00 00       	mov    $0x407,%edx
+  802404:	48 89 c6             	mov    %rax,%rsi
+  802407:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240c:	48 b8 0c 04 80 00 00 	movabs $0x80040c,%rax
+  802413:	00 00 00 
+  802416:	ff d0                	call   *%rax
+  802418:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80241b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80241f:	0f 88 19 02 00 00    	js     80263e <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  802425:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802429:	48 89 c7             	mov    %rax,%rdi
+  80242c:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  802433:	00 00 00 
+  802436:	ff d0                	call   *%rax
+  802438:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80243c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802443:	00 
+  802444:	e9 a2 00 00 00       	jmp    8024eb <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802449:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80244d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802451:	48 89 c2             	mov    %rax,%rdx
+  802454:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802458:	48 01 d0             	add    %rdx,%rax
+  80245b:	ba 07 04 00 00       	mov    $0x407,%edx
+  802460:	48 89 c6             	mov    %rax,%rsi
+  802463:	bf 00 00 00 00       	mov    $0x0,%edi
+  802468:	48 b8 0c 04 80 00 00 	movabs $0x80040c,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+  802474:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802477:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80247b:	0f 88 37 01 00 00    	js     8025b8 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802481:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802485:	48 89 c7             	mov    %rax,%rdi
+  802488:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+  802494:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802498:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80249c:	48 01 c2             	add    %rax,%rdx
+  80249f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024a3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024a7:	48 89 c1             	mov    %rax,%rcx
+  8024aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024ae:	48 01 c8             	add    %rcx,%rax
+  8024b1:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8024b7:	48 89 d1             	mov    %rdx,%rcx
+  8024ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bf:	48 89 c6             	mov    %rax,%rsi
+  8024c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c7:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024da:	79 0a                	jns    8024e6 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8024dc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8024e1:	e9 d3 00 00 00       	jmp    8025b9 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8024e6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8024eb:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8024f2:	00 
+  8024f3:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8024f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024fb:	48 01 d0             	add    %rdx,%rax
+  8024fe:	48 83 c0 1f          	add    $0x1f,%rax
+  802502:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802506:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80250a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250f:	48 f7 75 e0          	divq   -0x20(%rbp)
+  802513:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802517:	48 29 d0             	sub    %rdx,%rax
+  80251a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80251e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802522:	0f 82 21 ff ff ff    	jb     802449 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  802528:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80252c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  802530:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802534:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802538:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80253c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802540:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802547:	00 00 00 
+  80254a:	8b 12                	mov    (%rdx),%edx
+  80254c:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80254e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802552:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  802559:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80255d:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802564:	00 00 00 
+  802567:	8b 12                	mov    (%rdx),%edx
+  802569:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80256b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80256f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  802576:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80257a:	48 89 c7             	mov    %rax,%rdi
+  80257d:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+  802589:	89 c2                	mov    %eax,%edx
+  80258b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80258f:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802591:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802595:	48 89 c7             	mov    %rax,%rdi
+  802598:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8025a8:	48 83 c2 04          	add    $0x4,%rdx
+  8025ac:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8025ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b3:	e9 a5 00 00 00       	jmp    80265d <pipe_size+0x2ff>
+      goto err2;
+  8025b8:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8025b9:	eb 58                	jmp    802613 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8025bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025bf:	48 c1 e0 0c          	shl    $0xc,%rax
+  8025c3:	48 89 c2             	mov    %rax,%rdx
+  8025c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025ca:	48 01 d0             	add    %rdx,%rax
+  8025cd:	48 89 c6             	mov    %rax,%rsi
+  8025d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d5:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8025e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025e5:	48 89 c7             	mov    %rax,%rdi
+  8025e8:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+  8025f4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025f8:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8025fc:	48 01 d0             	add    %rdx,%rax
+  8025ff:	48 89 c6             	mov    %rax,%rsi
+  802602:	bf 00 00 00 00       	mov    $0x0,%edi
+  802607:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  80260e:	00 00 00 
+  802611:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  802613:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802617:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80261b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80261f:	48 85 c0             	test   %rax,%rax
+  802622:	75 97                	jne    8025bb <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  802624:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802628:	48 89 c6             	mov    %rax,%rsi
+  80262b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802630:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+  80263c:	eb 01                	jmp    80263f <pipe_size+0x2e1>
+    goto err1;
+  80263e:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80263f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802643:	48 89 c6             	mov    %rax,%rsi
+  802646:	bf 00 00 00 00       	mov    $0x0,%edi
+  80264b:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+  802657:	eb 01                	jmp    80265a <pipe_size+0x2fc>
+    goto err;
+  802659:	90                   	nop
+err:
+  return r;
+  80265a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80265d:	c9                   	leave
+  80265e:	c3                   	ret
+
+000000000080265f <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80265f:	55                   	push   %rbp
+  802660:	48 89 e5             	mov    %rsp,%rbp
+  802663:	53                   	push   %rbx
+  802664:	48 83 ec 28          	sub    $0x28,%rsp
+  802668:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80266c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  802670:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802677:	00 00 00 
+  80267a:	8b 40 04             	mov    0x4(%rax),%eax
+  80267d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802682:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802689:	00 00 00 
+  80268c:	48 98                	cltq
+  80268e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802695:	48 01 d0             	add    %rdx,%rax
+  802698:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80269e:	8b 00                	mov    (%rax),%eax
+  8026a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8026a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026a7:	48 89 c7             	mov    %rax,%rdi
+  8026aa:	48 b8 3d 52 80 00 00 	movabs $0x80523d,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+  8026b6:	89 c3                	mov    %eax,%ebx
+  8026b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026bc:	48 89 c7             	mov    %rax,%rdi
+  8026bf:	48 b8 3d 52 80 00 00 	movabs $0x80523d,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+  8026cb:	39 c3                	cmp    %eax,%ebx
+  8026cd:	0f 94 c0             	sete   %al
+  8026d0:	0f b6 c0             	movzbl %al,%eax
+  8026d3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8026d6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8026dd:	00 00 00 
+  8026e0:	8b 40 04             	mov    0x4(%rax),%eax
+  8026e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8026e8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8026ef:	00 00 00 
+  8026f2:	48 98                	cltq
+  8026f4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8026fb:	48 01 d0             	add    %rdx,%rax
+  8026fe:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802704:	8b 00                	mov    (%rax),%eax
+  802706:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  802709:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80270c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80270f:	75 05                	jne    802716 <_pipeisclosed+0xb7>
+      return ret;
+  802711:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802714:	eb 68                	jmp    80277e <_pipeisclosed+0x11f>
+    if (n != nn)
+  802716:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802719:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80271c:	0f 84 4e ff ff ff    	je     802670 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  802722:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802729:	00 00 00 
+  80272c:	8b 40 04             	mov    0x4(%rax),%eax
+  80272f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802734:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80273b:	00 00 00 
+  80273e:	48 98                	cltq
+  802740:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802747:	48 01 d0             	add    %rdx,%rax
+  80274a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802750:	8b 10                	mov    (%rax),%edx
+  802752:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  802755:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802758:	89 c6                	mov    %eax,%esi
+  80275a:	48 b8 10 54 80 00 00 	movabs $0x805410,%rax
+  802761:	00 00 00 
+  802764:	48 89 c7             	mov    %rax,%rdi
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276c:	49 b8 d4 34 80 00 00 	movabs $0x8034d4,%r8
+  802773:	00 00 00 
+  802776:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802779:	e9 f2 fe ff ff       	jmp    802670 <_pipeisclosed+0x11>
+  }
+}
+  80277e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802782:	c9                   	leave
+  802783:	c3                   	ret
+
+0000000000802784 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802784:	55                   	push   %rbp
+  802785:	48 89 e5             	mov    %rsp,%rbp
+  802788:	48 83 ec 30          	sub    $0x30,%rsp
+  80278c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80278f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802793:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802796:	48 89 d6             	mov    %rdx,%rsi
+  802799:	89 c7                	mov    %eax,%edi
+  80279b:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+  8027a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8027aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8027ae:	79 05                	jns    8027b5 <pipeisclosed+0x31>
+    return r;
+  8027b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027b3:	eb 31                	jmp    8027e6 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8027b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b9:	48 89 c7             	mov    %rax,%rdi
+  8027bc:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8027cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027d4:	48 89 d6             	mov    %rdx,%rsi
+  8027d7:	48 89 c7             	mov    %rax,%rdi
+  8027da:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+00000000008027e8 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8027f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f8:	8b 40 18             	mov    0x18(%rax),%eax
+  8027fb:	8d 50 01             	lea    0x1(%rax),%edx
+  8027fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802802:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  802805:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802809:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80280c:	85 c0                	test   %eax,%eax
+  80280e:	74 27                	je     802837 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802810:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802814:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80281b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80281f:	48 83 c0 18          	add    $0x18,%rax
+  802823:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  802828:	48 89 c7             	mov    %rax,%rdi
+  80282b:	48 b8 07 08 80 00 00 	movabs $0x800807,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+  }
+}
+  802837:	90                   	nop
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+
+000000000080283a <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80283a:	55                   	push   %rbp
+  80283b:	48 89 e5             	mov    %rsp,%rbp
+  80283e:	48 83 ec 10          	sub    $0x10,%rsp
+  802842:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802846:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  802849:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80284d:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  802854:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802858:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80285c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80285f:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  802866:	89 c6                	mov    %eax,%esi
+  802868:	48 89 cf             	mov    %rcx,%rdi
+  80286b:	48 b8 b8 07 80 00 00 	movabs $0x8007b8,%rax
+  802872:	00 00 00 
+  802875:	ff d0                	call   *%rax
+}
+  802877:	90                   	nop
+  802878:	c9                   	leave
+  802879:	c3                   	ret
+
+000000000080287a <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80287a:	55                   	push   %rbp
+  80287b:	48 89 e5             	mov    %rsp,%rbp
+  80287e:	48 83 ec 70          	sub    $0x70,%rsp
+  802882:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802886:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80288a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80288e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802892:	48 89 c7             	mov    %rax,%rdi
+  802895:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8028a5:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8028aa:	75 0a                	jne    8028b6 <devpipe_read+0x3c>
+    return 0;
+  8028ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b1:	e9 63 01 00 00       	jmp    802a19 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8028b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ba:	8b 40 18             	mov    0x18(%rax),%eax
+  8028bd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8028c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c4:	48 8b 10             	mov    (%rax),%rdx
+  8028c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028cf:	48 39 c2             	cmp    %rax,%rdx
+  8028d2:	75 42                	jne    802916 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8028d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8028dc:	48 89 d6             	mov    %rdx,%rsi
+  8028df:	48 89 c7             	mov    %rax,%rdi
+  8028e2:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	85 c0                	test   %eax,%eax
+  8028f0:	74 0a                	je     8028fc <devpipe_read+0x82>
+      return 0;
+  8028f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f7:	e9 1d 01 00 00       	jmp    802a19 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8028fc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8028ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802903:	89 d6                	mov    %edx,%esi
+  802905:	48 89 c7             	mov    %rax,%rdi
+  802908:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  802914:	eb a0                	jmp    8028b6 <devpipe_read+0x3c>
+      break;
+  802916:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  802917:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80291b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80291f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802923:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80292b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80292f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802933:	48 8b 00             	mov    (%rax),%rax
+  802936:	48 29 c2             	sub    %rax,%rdx
+  802939:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80293d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802941:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802945:	48 39 c2             	cmp    %rax,%rdx
+  802948:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80294c:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  802950:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802954:	48 8b 00             	mov    (%rax),%rax
+  802957:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80295b:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80295f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802964:	48 f7 f1             	div    %rcx
+  802967:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80296b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80296f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802977:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80297b:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80297f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802983:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802987:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80298b:	48 39 c2             	cmp    %rax,%rdx
+  80298e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802992:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802996:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80299a:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80299e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029a2:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8029a6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8029aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029ae:	48 89 ce             	mov    %rcx,%rsi
+  8029b1:	48 89 c7             	mov    %rax,%rdi
+  8029b4:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  8029bb:	00 00 00 
+  8029be:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8029c0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8029c4:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8029c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029cc:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8029d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029d4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8029d8:	48 01 d1             	add    %rdx,%rcx
+  8029db:	48 89 c2             	mov    %rax,%rdx
+  8029de:	48 89 cf             	mov    %rcx,%rdi
+  8029e1:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8029ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f1:	48 8b 10             	mov    (%rax),%rdx
+  8029f4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8029f8:	48 01 c2             	add    %rax,%rdx
+  8029fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ff:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802a02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a06:	48 89 c7             	mov    %rax,%rdi
+  802a09:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  802a10:	00 00 00 
+  802a13:	ff d0                	call   *%rax
+  return n;
+  802a15:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802a19:	c9                   	leave
+  802a1a:	c3                   	ret
+
+0000000000802a1b <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a1b:	55                   	push   %rbp
+  802a1c:	48 89 e5             	mov    %rsp,%rbp
+  802a1f:	48 83 ec 70          	sub    $0x70,%rsp
+  802a23:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a27:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802a2b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802a2f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a33:	48 89 c7             	mov    %rax,%rdi
+  802a36:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  802a3d:	00 00 00 
+  802a40:	ff d0                	call   *%rax
+  802a42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  802a46:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802a4a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  802a4e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802a55:	00 
+  802a56:	e9 b8 01 00 00       	jmp    802c13 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  802a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a5f:	8b 40 18             	mov    0x18(%rax),%eax
+  802a62:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  802a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a69:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a71:	48 8b 00             	mov    (%rax),%rax
+  802a74:	48 29 c2             	sub    %rax,%rdx
+  802a77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a7b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802a7f:	48 39 c2             	cmp    %rax,%rdx
+  802a82:	75 4d                	jne    802ad1 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802a84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a88:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a8c:	48 89 d6             	mov    %rdx,%rsi
+  802a8f:	48 89 c7             	mov    %rax,%rdi
+  802a92:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	74 0a                	je     802aac <devpipe_write+0x91>
+        return 0;
+  802aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa7:	e9 79 01 00 00       	jmp    802c25 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802aac:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab3:	89 d6                	mov    %edx,%esi
+  802ab5:	48 89 c7             	mov    %rax,%rdi
+  802ab8:	48 b8 3a 28 80 00 00 	movabs $0x80283a,%rax
+  802abf:	00 00 00 
+  802ac2:	ff d0                	call   *%rax
+      m = 0;
+  802ac4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802acb:	00 
+      continue;
+  802acc:	e9 3a 01 00 00       	jmp    802c0b <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802ad1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802ad5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802ad9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802add:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802ae5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae9:	48 8b 08             	mov    (%rax),%rcx
+  802aec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802af0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802af4:	48 29 c1             	sub    %rax,%rcx
+  802af7:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802afb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802aff:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b07:	48 39 c2             	cmp    %rax,%rdx
+  802b0a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802b0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  802b12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b1a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b1e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  802b22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b27:	48 f7 f1             	div    %rcx
+  802b2a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  802b2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b32:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802b36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b3a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802b3e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802b42:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802b46:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802b4a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b4e:	48 39 c2             	cmp    %rax,%rdx
+  802b51:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802b55:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b59:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b5d:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  802b61:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802b65:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  802b69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802b6d:	48 01 d1             	add    %rdx,%rcx
+  802b70:	48 89 c2             	mov    %rax,%rdx
+  802b73:	48 89 cf             	mov    %rcx,%rdi
+  802b76:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  802b7d:	00 00 00 
+  802b80:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802b82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b86:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802b8a:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802b8e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802b92:	73 4d                	jae    802be1 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b98:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ba0:	48 29 c2             	sub    %rax,%rdx
+  802ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba7:	48 01 c2             	add    %rax,%rdx
+  802baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802bb2:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802bb6:	48 89 c1             	mov    %rax,%rcx
+  802bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bbd:	48 01 c1             	add    %rax,%rcx
+  802bc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bc4:	48 01 c1             	add    %rax,%rcx
+  802bc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bcb:	48 83 c0 20          	add    $0x20,%rax
+  802bcf:	48 89 ce             	mov    %rcx,%rsi
+  802bd2:	48 89 c7             	mov    %rax,%rdi
+  802bd5:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  802bdc:	00 00 00 
+  802bdf:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802be5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802be9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bed:	48 01 c2             	add    %rax,%rdx
+  802bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bf4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802bf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bfc:	48 89 c7             	mov    %rax,%rdi
+  802bff:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  802c06:	00 00 00 
+  802c09:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802c0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c0f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  802c13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c17:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802c1b:	0f 82 3a fe ff ff    	jb     802a5b <devpipe_write+0x40>
+  }
+
+  return i;
+  802c21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+
+0000000000802c27 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802c27:	55                   	push   %rbp
+  802c28:	48 89 e5             	mov    %rsp,%rbp
+  802c2b:	48 83 ec 40          	sub    $0x40,%rsp
+  802c2f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c33:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  802c36:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c3e:	48 89 c7             	mov    %rax,%rdi
+  802c41:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  802c48:	00 00 00 
+  802c4b:	ff d0                	call   *%rax
+  802c4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  802c51:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  802c58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5c:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  802c60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c64:	48 89 d6             	mov    %rdx,%rsi
+  802c67:	48 89 c7             	mov    %rax,%rdi
+  802c6a:	48 b8 e9 15 80 00 00 	movabs $0x8015e9,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+  802c76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c7d:	79 08                	jns    802c87 <devpipe_poll+0x60>
+    return r;
+  802c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c82:	e9 85 00 00 00       	jmp    802d0c <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802c87:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802c8a:	83 e0 01             	and    $0x1,%eax
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	74 18                	je     802ca9 <devpipe_poll+0x82>
+  802c91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c95:	48 8b 10             	mov    (%rax),%rdx
+  802c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c9c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ca0:	48 39 c2             	cmp    %rax,%rdx
+  802ca3:	74 04                	je     802ca9 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802ca5:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802ca9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802cac:	83 e0 02             	and    $0x2,%eax
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	74 23                	je     802cd6 <devpipe_poll+0xaf>
+  802cb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802cbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cbf:	48 8b 00             	mov    (%rax),%rax
+  802cc2:	48 29 c2             	sub    %rax,%rdx
+  802cc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cc9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ccd:	48 39 c2             	cmp    %rax,%rdx
+  802cd0:	73 04                	jae    802cd6 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802cd2:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  802cd6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802cda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cde:	48 89 d6             	mov    %rdx,%rsi
+  802ce1:	48 89 c7             	mov    %rax,%rdi
+  802ce4:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  802ceb:	00 00 00 
+  802cee:	ff d0                	call   *%rax
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	74 04                	je     802cf8 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  802cf4:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802cf8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cfc:	75 0b                	jne    802d09 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802cfe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d02:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802d09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d0c:	c9                   	leave
+  802d0d:	c3                   	ret
+
+0000000000802d0e <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802d0e:	55                   	push   %rbp
+  802d0f:	48 89 e5             	mov    %rsp,%rbp
+  802d12:	48 83 ec 20          	sub    $0x20,%rsp
+  802d16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802d1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d22:	48 89 c7             	mov    %rax,%rdi
+  802d25:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+  802d31:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  802d35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d39:	48 ba 41 54 80 00 00 	movabs $0x805441,%rdx
+  802d40:	00 00 00 
+  802d43:	48 89 d6             	mov    %rdx,%rsi
+  802d46:	48 89 c7             	mov    %rax,%rdi
+  802d49:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  802d50:	00 00 00 
+  802d53:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  802d55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d5d:	89 c1                	mov    %eax,%ecx
+  802d5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d63:	48 8b 00             	mov    (%rax),%rax
+  802d66:	89 c2                	mov    %eax,%edx
+  802d68:	89 c8                	mov    %ecx,%eax
+  802d6a:	29 d0                	sub    %edx,%eax
+  802d6c:	89 c2                	mov    %eax,%edx
+  802d6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d72:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802d78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d7c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802d83:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802d86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d8a:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802d91:	00 00 00 
+  802d94:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da0:	c9                   	leave
+  802da1:	c3                   	ret
+
+0000000000802da2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802da2:	55                   	push   %rbp
+  802da3:	48 89 e5             	mov    %rsp,%rbp
+  802da6:	48 83 ec 40          	sub    $0x40,%rsp
+  802daa:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802dae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802db2:	48 89 c7             	mov    %rax,%rdi
+  802db5:	48 b8 16 0b 80 00 00 	movabs $0x800b16,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+  802dc1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802dc5:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802dcc:	00 
+  802dcd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802dd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dd9:	48 01 d0             	add    %rdx,%rax
+  802ddc:	48 83 c0 1f          	add    $0x1f,%rax
+  802de0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802de4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802de8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ded:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802df1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802df5:	48 29 d0             	sub    %rdx,%rax
+  802df8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802dfc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802e00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e04:	48 89 c6             	mov    %rax,%rsi
+  802e07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0c:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  802e13:	00 00 00 
+  802e16:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1c:	48 89 c7             	mov    %rax,%rdi
+  802e1f:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802e2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802e33:	eb 2f                	jmp    802e64 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802e35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e39:	48 83 e8 01          	sub    $0x1,%rax
+  802e3d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e41:	48 89 c2             	mov    %rax,%rdx
+  802e44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e48:	48 01 d0             	add    %rdx,%rax
+  802e4b:	48 89 c6             	mov    %rax,%rsi
+  802e4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e53:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  802e5a:	00 00 00 
+  802e5d:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802e5f:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802e64:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802e69:	77 ca                	ja     802e35 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802e6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e6f:	48 89 c6             	mov    %rax,%rsi
+  802e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e77:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  802e7e:	00 00 00 
+  802e81:	ff d0                	call   *%rax
+}
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+0000000000802e85 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802e90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e94:	75 10                	jne    802ea6 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802e96:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802e9d:	00 00 00 
+  802ea0:	8b 00                	mov    (%rax),%eax
+  802ea2:	48 98                	cltq
+  802ea4:	eb 05                	jmp    802eab <vsyscall+0x26>
+  }
+  return 0;
+  802ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+0000000000802ead <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802ead:	55                   	push   %rbp
+  802eae:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802eb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb6:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+}
+  802ec2:	5d                   	pop    %rbp
+  802ec3:	c3                   	ret
+
+0000000000802ec4 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802ec4:	55                   	push   %rbp
+  802ec5:	48 89 e5             	mov    %rsp,%rbp
+  802ec8:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802ecc:	0f 31                	rdtsc
+  802ece:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ed1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802ed4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ed7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802eda:	48 c1 e2 20          	shl    $0x20,%rdx
+  802ede:	48 09 d0             	or     %rdx,%rax
+  802ee1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802ee5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802ee9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802eed:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802ef4:	00 00 00 
+  802ef7:	8b 40 08             	mov    0x8(%rax),%eax
+  802efa:	48 98                	cltq
+  802efc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802f00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f09:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802f0d:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802f21:	48 89 d0             	mov    %rdx,%rax
+  802f24:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f30:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802f34:	48 01 c8             	add    %rcx,%rax
+}
+  802f37:	c9                   	leave
+  802f38:	c3                   	ret
+
+0000000000802f39 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802f39:	55                   	push   %rbp
+  802f3a:	48 89 e5             	mov    %rsp,%rbp
+  802f3d:	48 83 ec 20          	sub    $0x20,%rsp
+  802f41:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802f44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f47:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802f4a:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802f4e:	be 01 00 00 00       	mov    $0x1,%esi
+  802f53:	48 89 c7             	mov    %rax,%rdi
+  802f56:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  802f5d:	00 00 00 
+  802f60:	ff d0                	call   *%rax
+}
+  802f62:	90                   	nop
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+
+0000000000802f65 <getchar>:
+
+int
+getchar(void) {
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802f6d:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802f71:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f76:	48 89 c6             	mov    %rax,%rsi
+  802f79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7e:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  802f85:	00 00 00 
+  802f88:	ff d0                	call   *%rax
+  802f8a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802f8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f91:	79 05                	jns    802f98 <getchar+0x33>
+    return r;
+  802f93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f96:	eb 14                	jmp    802fac <getchar+0x47>
+  if (r < 1)
+  802f98:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f9c:	7f 07                	jg     802fa5 <getchar+0x40>
+    return -E_EOF;
+  802f9e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802fa3:	eb 07                	jmp    802fac <getchar+0x47>
+  return c;
+  802fa5:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802fa9:	0f b6 c0             	movzbl %al,%eax
+}
+  802fac:	c9                   	leave
+  802fad:	c3                   	ret
+
+0000000000802fae <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	48 83 ec 20          	sub    $0x20,%rsp
+  802fb6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fb9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fc0:	48 89 d6             	mov    %rdx,%rsi
+  802fc3:	89 c7                	mov    %eax,%edi
+  802fc5:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fd4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fd8:	79 05                	jns    802fdf <iscons+0x31>
+    return r;
+  802fda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fdd:	eb 1a                	jmp    802ff9 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802fdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fe3:	8b 10                	mov    (%rax),%edx
+  802fe5:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802fec:	00 00 00 
+  802fef:	8b 00                	mov    (%rax),%eax
+  802ff1:	39 c2                	cmp    %eax,%edx
+  802ff3:	0f 94 c0             	sete   %al
+  802ff6:	0f b6 c0             	movzbl %al,%eax
+}
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+
+0000000000802ffb <opencons>:
+
+int
+opencons(void) {
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803003:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803007:	48 89 c7             	mov    %rax,%rdi
+  80300a:	48 b8 41 0b 80 00 00 	movabs $0x800b41,%rax
+  803011:	00 00 00 
+  803014:	ff d0                	call   *%rax
+  803016:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803019:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80301d:	79 05                	jns    803024 <opencons+0x29>
+    return r;
+  80301f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803022:	eb 66                	jmp    80308a <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  803024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803028:	ba 07 04 00 00       	mov    $0x407,%edx
+  80302d:	48 89 c6             	mov    %rax,%rsi
+  803030:	bf 00 00 00 00       	mov    $0x0,%edi
+  803035:	48 b8 0c 04 80 00 00 	movabs $0x80040c,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+  803041:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803044:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803048:	79 05                	jns    80304f <opencons+0x54>
+    return r;
+  80304a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80304d:	eb 3b                	jmp    80308a <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  80304f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803053:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  80305a:	00 00 00 
+  80305d:	8b 12                	mov    (%rdx),%edx
+  80305f:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  803061:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803065:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  80306c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803070:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  803077:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80307b:	48 89 c7             	mov    %rax,%rdi
+  80307e:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  803085:	00 00 00 
+  803088:	ff d0                	call   *%rax
+}
+  80308a:	c9                   	leave
+  80308b:	c3                   	ret
+
+000000000080308c <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  80308c:	55                   	push   %rbp
+  80308d:	48 89 e5             	mov    %rsp,%rbp
+  803090:	48 83 ec 20          	sub    $0x20,%rsp
+  803094:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803097:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80309a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80309e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030a1:	48 89 d6             	mov    %rdx,%rsi
+  8030a4:	89 c7                	mov    %eax,%edi
+  8030a6:	48 b8 23 0c 80 00 00 	movabs $0x800c23,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+  8030b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030b9:	79 05                	jns    8030c0 <consmode+0x34>
+    return r;
+  8030bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030be:	eb 34                	jmp    8030f4 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8030c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c4:	8b 10                	mov    (%rax),%edx
+  8030c6:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  8030cd:	00 00 00 
+  8030d0:	8b 00                	mov    (%rax),%eax
+  8030d2:	39 c2                	cmp    %eax,%edx
+  8030d4:	74 07                	je     8030dd <consmode+0x51>
+    return -E_INVAL;
+  8030d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030db:	eb 17                	jmp    8030f4 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8030dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8030e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8030e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030eb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8030ee:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8030f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030f4:	c9                   	leave
+  8030f5:	c3                   	ret
+
+00000000008030f6 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8030f6:	55                   	push   %rbp
+  8030f7:	48 89 e5             	mov    %rsp,%rbp
+  8030fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8030fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803102:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803106:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80310a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80310e:	8b 50 0c             	mov    0xc(%rax),%edx
+  803111:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803115:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803119:	48 89 ce             	mov    %rcx,%rsi
+  80311c:	48 89 c7             	mov    %rax,%rdi
+  80311f:	48 b8 66 07 80 00 00 	movabs $0x800766,%rax
+  803126:	00 00 00 
+  803129:	ff d0                	call   *%rax
+  80312b:	48 98                	cltq
+}
+  80312d:	c9                   	leave
+  80312e:	c3                   	ret
+
+000000000080312f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80312f:	55                   	push   %rbp
+  803130:	48 89 e5             	mov    %rsp,%rbp
+  803133:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80313a:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  803141:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  803148:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  80314f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803156:	eb 74                	jmp    8031cc <devcons_write+0x9d>
+    m = n - tot;
+  803158:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80315f:	89 c2                	mov    %eax,%edx
+  803161:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803164:	29 c2                	sub    %eax,%edx
+  803166:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  803169:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80316c:	83 f8 7f             	cmp    $0x7f,%eax
+  80316f:	76 07                	jbe    803178 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  803171:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  803178:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80317b:	48 63 d0             	movslq %eax,%rdx
+  80317e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803181:	48 63 c8             	movslq %eax,%rcx
+  803184:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  80318b:	48 01 c1             	add    %rax,%rcx
+  80318e:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  803195:	48 89 ce             	mov    %rcx,%rsi
+  803198:	48 89 c7             	mov    %rax,%rdi
+  80319b:	48 b8 c7 49 80 00 00 	movabs $0x8049c7,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8031a7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031aa:	48 63 d0             	movslq %eax,%rdx
+  8031ad:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8031b4:	48 89 d6             	mov    %rdx,%rsi
+  8031b7:	48 89 c7             	mov    %rax,%rdi
+  8031ba:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  8031c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031c9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8031cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031cf:	48 98                	cltq
+  8031d1:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8031d8:	0f 82 7a ff ff ff    	jb     803158 <devcons_write+0x29>
+  }
+  return tot;
+  8031de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031e1:	48 98                	cltq
+}
+  8031e3:	c9                   	leave
+  8031e4:	c3                   	ret
+
+00000000008031e5 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8031e5:	55                   	push   %rbp
+  8031e6:	48 89 e5             	mov    %rsp,%rbp
+  8031e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8031f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031f6:	c9                   	leave
+  8031f7:	c3                   	ret
+
+00000000008031f8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031f8:	55                   	push   %rbp
+  8031f9:	48 89 e5             	mov    %rsp,%rbp
+  8031fc:	48 83 ec 10          	sub    $0x10,%rsp
+  803200:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803204:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  803208:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80320c:	48 ba 4d 54 80 00 00 	movabs $0x80544d,%rdx
+  803213:	00 00 00 
+  803216:	48 89 d6             	mov    %rdx,%rsi
+  803219:	48 89 c7             	mov    %rax,%rdi
+  80321c:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  803223:	00 00 00 
+  803226:	ff d0                	call   *%rax
+  return 0;
+  803228:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80322d:	c9                   	leave
+  80322e:	c3                   	ret
+
+000000000080322f <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80322f:	55                   	push   %rbp
+  803230:	48 89 e5             	mov    %rsp,%rbp
+  803233:	48 83 ec 30          	sub    $0x30,%rsp
+  803237:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80323b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80323e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  803242:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  803249:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80324c:	83 e0 02             	and    $0x2,%eax
+  80324f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  803252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803256:	8b 40 0c             	mov    0xc(%rax),%eax
+  803259:	83 f8 01             	cmp    $0x1,%eax
+  80325c:	75 04                	jne    803262 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  80325e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  803262:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803265:	83 e0 01             	and    $0x1,%eax
+  803268:	85 c0                	test   %eax,%eax
+  80326a:	74 44                	je     8032b0 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  80326c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80326f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803274:	89 c2                	mov    %eax,%edx
+  803276:	be 00 00 00 00       	mov    $0x0,%esi
+  80327b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803280:	48 b8 54 08 80 00 00 	movabs $0x800854,%rax
+  803287:	00 00 00 
+  80328a:	ff d0                	call   *%rax
+  80328c:	83 f8 01             	cmp    $0x1,%eax
+  80328f:	75 06                	jne    803297 <devcons_poll+0x68>
+      revents |= POLLIN;
+  803291:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  803295:	eb 19                	jmp    8032b0 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  803297:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80329b:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8032a1:	0b 45 fc             	or     -0x4(%rbp),%eax
+  8032a4:	89 c2                	mov    %eax,%edx
+  8032a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032aa:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  8032b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8032b3:	c9                   	leave
+  8032b4:	c3                   	ret
+
+00000000008032b5 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8032b5:	55                   	push   %rbp
+  8032b6:	48 89 e5             	mov    %rsp,%rbp
+  8032b9:	53                   	push   %rbx
+  8032ba:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8032c1:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8032c8:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8032ce:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8032d5:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8032dc:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8032e3:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8032ea:	84 c0                	test   %al,%al
+  8032ec:	74 23                	je     803311 <_panic+0x5c>
+  8032ee:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8032f5:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8032f9:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8032fd:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  803301:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  803305:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  803309:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80330d:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803311:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  803318:	00 00 00 
+  80331b:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  803322:	00 00 00 
+  803325:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803329:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  803330:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  803337:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80333e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803345:	00 00 00 
+  803348:	48 8b 18             	mov    (%rax),%rbx
+  80334b:	48 b8 93 03 80 00 00 	movabs $0x800393,%rax
+  803352:	00 00 00 
+  803355:	ff d0                	call   *%rax
+  803357:	89 c6                	mov    %eax,%esi
+  803359:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80335f:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  803366:	41 89 d0             	mov    %edx,%r8d
+  803369:	48 89 c1             	mov    %rax,%rcx
+  80336c:	48 89 da             	mov    %rbx,%rdx
+  80336f:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  803376:	00 00 00 
+  803379:	48 89 c7             	mov    %rax,%rdi
+  80337c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803381:	49 b9 d4 34 80 00 00 	movabs $0x8034d4,%r9
+  803388:	00 00 00 
+  80338b:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80338e:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803395:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80339c:	48 89 d6             	mov    %rdx,%rsi
+  80339f:	48 89 c7             	mov    %rax,%rdi
+  8033a2:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  8033a9:	00 00 00 
+  8033ac:	ff d0                	call   *%rax
+  cprintf("\n");
+  8033ae:	48 b8 7b 54 80 00 00 	movabs $0x80547b,%rax
+  8033b5:	00 00 00 
+  8033b8:	48 89 c7             	mov    %rax,%rdi
+  8033bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c0:	48 ba d4 34 80 00 00 	movabs $0x8034d4,%rdx
+  8033c7:	00 00 00 
+  8033ca:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8033cc:	cc                   	int3
+  8033cd:	eb fd                	jmp    8033cc <_panic+0x117>
+
+00000000008033cf <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8033cf:	55                   	push   %rbp
+  8033d0:	48 89 e5             	mov    %rsp,%rbp
+  8033d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8033da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8033de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033e2:	8b 00                	mov    (%rax),%eax
+  8033e4:	8d 48 01             	lea    0x1(%rax),%ecx
+  8033e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033eb:	89 0a                	mov    %ecx,(%rdx)
+  8033ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8033f0:	89 d1                	mov    %edx,%ecx
+  8033f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033f6:	48 98                	cltq
+  8033f8:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8033fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803400:	8b 00                	mov    (%rax),%eax
+  803402:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803407:	75 2c                	jne    803435 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  803409:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80340d:	8b 00                	mov    (%rax),%eax
+  80340f:	48 98                	cltq
+  803411:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803415:	48 83 c2 08          	add    $0x8,%rdx
+  803419:	48 89 c6             	mov    %rax,%rsi
+  80341c:	48 89 d7             	mov    %rdx,%rdi
+  80341f:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  803426:	00 00 00 
+  803429:	ff d0                	call   *%rax
+    b->idx = 0;
+  80342b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  803435:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803439:	8b 40 04             	mov    0x4(%rax),%eax
+  80343c:	8d 50 01             	lea    0x1(%rax),%edx
+  80343f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803443:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803446:	90                   	nop
+  803447:	c9                   	leave
+  803448:	c3                   	ret
+
+0000000000803449 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803449:	55                   	push   %rbp
+  80344a:	48 89 e5             	mov    %rsp,%rbp
+  80344d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803454:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  80345b:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  803462:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  803469:	00 00 00 
+  b.cnt = 0;
+  80346c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  803473:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  803476:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80347d:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803484:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80348b:	48 89 c6             	mov    %rax,%rsi
+  80348e:	48 b8 cf 33 80 00 00 	movabs $0x8033cf,%rax
+  803495:	00 00 00 
+  803498:	48 89 c7             	mov    %rax,%rdi
+  80349b:	48 b8 2e 38 80 00 00 	movabs $0x80382e,%rax
+  8034a2:	00 00 00 
+  8034a5:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8034a7:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8034ad:	48 98                	cltq
+  8034af:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8034b6:	48 83 c2 08          	add    $0x8,%rdx
+  8034ba:	48 89 c6             	mov    %rax,%rsi
+  8034bd:	48 89 d7             	mov    %rdx,%rdi
+  8034c0:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8034cc:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+
+00000000008034d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034d4:	55                   	push   %rbp
+  8034d5:	48 89 e5             	mov    %rsp,%rbp
+  8034d8:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8034df:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8034e6:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8034ed:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8034f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8034fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803502:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803509:	84 c0                	test   %al,%al
+  80350b:	74 20                	je     80352d <cprintf+0x59>
+  80350d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803511:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803515:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803519:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80351d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803521:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803525:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803529:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80352d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803534:	00 00 00 
+  803537:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80353e:	00 00 00 
+  803541:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803545:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80354c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803553:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80355a:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  803561:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803568:	48 89 d6             	mov    %rdx,%rsi
+  80356b:	48 89 c7             	mov    %rax,%rdi
+  80356e:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  803575:	00 00 00 
+  803578:	ff d0                	call   *%rax
+  80357a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803580:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+0000000000803588 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	48 83 ec 30          	sub    $0x30,%rsp
+  803590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803594:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803598:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80359c:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80359f:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8035a3:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8035a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8035aa:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8035ae:	72 54                	jb     803604 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8035b0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8035b3:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8035b6:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8035b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c2:	48 f7 f6             	div    %rsi
+  8035c5:	49 89 c2             	mov    %rax,%r10
+  8035c8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8035cb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8035ce:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8035d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035d6:	41 89 c9             	mov    %ecx,%r9d
+  8035d9:	41 89 f8             	mov    %edi,%r8d
+  8035dc:	89 d1                	mov    %edx,%ecx
+  8035de:	4c 89 d2             	mov    %r10,%rdx
+  8035e1:	48 89 c7             	mov    %rax,%rdi
+  8035e4:	48 b8 88 35 80 00 00 	movabs $0x803588,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+  8035f0:	eb 1c                	jmp    80360e <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8035f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035f9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8035fd:	48 89 d6             	mov    %rdx,%rsi
+  803600:	89 c7                	mov    %eax,%edi
+  803602:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803604:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  803608:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80360c:	7f e4                	jg     8035f2 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80360e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803611:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80361a:	48 f7 f1             	div    %rcx
+  80361d:	48 b8 b0 56 80 00 00 	movabs $0x8056b0,%rax
+  803624:	00 00 00 
+  803627:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80362b:	0f be c0             	movsbl %al,%eax
+  80362e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803632:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803636:	48 89 d6             	mov    %rdx,%rsi
+  803639:	89 c7                	mov    %eax,%edi
+  80363b:	ff d1                	call   *%rcx
+}
+  80363d:	90                   	nop
+  80363e:	c9                   	leave
+  80363f:	c3                   	ret
+
+0000000000803640 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	48 83 ec 10          	sub    $0x10,%rsp
+  803648:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80364c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80364f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  803653:	7e 4b                	jle    8036a0 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  803655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803659:	8b 00                	mov    (%rax),%eax
+  80365b:	83 f8 2f             	cmp    $0x2f,%eax
+  80365e:	77 24                	ja     803684 <getuint+0x44>
+  803660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803664:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80366c:	8b 00                	mov    (%rax),%eax
+  80366e:	89 c0                	mov    %eax,%eax
+  803670:	48 01 d0             	add    %rdx,%rax
+  803673:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803677:	8b 12                	mov    (%rdx),%edx
+  803679:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80367c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803680:	89 0a                	mov    %ecx,(%rdx)
+  803682:	eb 14                	jmp    803698 <getuint+0x58>
+  803684:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803688:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80368c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803690:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803694:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803698:	48 8b 00             	mov    (%rax),%rax
+  80369b:	e9 95 00 00 00       	jmp    803735 <getuint+0xf5>
+  else if (lflag)
+  8036a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8036a4:	74 48                	je     8036ee <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8036a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036aa:	8b 00                	mov    (%rax),%eax
+  8036ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8036af:	77 24                	ja     8036d5 <getuint+0x95>
+  8036b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036b5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8036b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036bd:	8b 00                	mov    (%rax),%eax
+  8036bf:	89 c0                	mov    %eax,%eax
+  8036c1:	48 01 d0             	add    %rdx,%rax
+  8036c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036c8:	8b 12                	mov    (%rdx),%edx
+  8036ca:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8036cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036d1:	89 0a                	mov    %ecx,(%rdx)
+  8036d3:	eb 14                	jmp    8036e9 <getuint+0xa9>
+  8036d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8036dd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8036e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036e5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8036e9:	48 8b 00             	mov    (%rax),%rax
+  8036ec:	eb 47                	jmp    803735 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8036ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036f2:	8b 00                	mov    (%rax),%eax
+  8036f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8036f7:	77 24                	ja     80371d <getuint+0xdd>
+  8036f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036fd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803705:	8b 00                	mov    (%rax),%eax
+  803707:	89 c0                	mov    %eax,%eax
+  803709:	48 01 d0             	add    %rdx,%rax
+  80370c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803710:	8b 12                	mov    (%rdx),%edx
+  803712:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803715:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803719:	89 0a                	mov    %ecx,(%rdx)
+  80371b:	eb 14                	jmp    803731 <getuint+0xf1>
+  80371d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803721:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803725:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803729:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80372d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803731:	8b 00                	mov    (%rax),%eax
+  803733:	89 c0                	mov    %eax,%eax
+}
+  803735:	c9                   	leave
+  803736:	c3                   	ret
+
+0000000000803737 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  803737:	55                   	push   %rbp
+  803738:	48 89 e5             	mov    %rsp,%rbp
+  80373b:	48 83 ec 10          	sub    $0x10,%rsp
+  80373f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803743:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  803746:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80374a:	7e 4b                	jle    803797 <getint+0x60>
+    return va_arg(*ap, long long);
+  80374c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803750:	8b 00                	mov    (%rax),%eax
+  803752:	83 f8 2f             	cmp    $0x2f,%eax
+  803755:	77 24                	ja     80377b <getint+0x44>
+  803757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80375b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80375f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803763:	8b 00                	mov    (%rax),%eax
+  803765:	89 c0                	mov    %eax,%eax
+  803767:	48 01 d0             	add    %rdx,%rax
+  80376a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80376e:	8b 12                	mov    (%rdx),%edx
+  803770:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803773:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803777:	89 0a                	mov    %ecx,(%rdx)
+  803779:	eb 14                	jmp    80378f <getint+0x58>
+  80377b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80377f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803783:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803787:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80378b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80378f:	48 8b 00             	mov    (%rax),%rax
+  803792:	e9 95 00 00 00       	jmp    80382c <getint+0xf5>
+  else if (lflag)
+  803797:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80379b:	74 48                	je     8037e5 <getint+0xae>
+    return va_arg(*ap, long);
+  80379d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037a1:	8b 00                	mov    (%rax),%eax
+  8037a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8037a6:	77 24                	ja     8037cc <getint+0x95>
+  8037a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8037b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037b4:	8b 00                	mov    (%rax),%eax
+  8037b6:	89 c0                	mov    %eax,%eax
+  8037b8:	48 01 d0             	add    %rdx,%rax
+  8037bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037bf:	8b 12                	mov    (%rdx),%edx
+  8037c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8037c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037c8:	89 0a                	mov    %ecx,(%rdx)
+  8037ca:	eb 14                	jmp    8037e0 <getint+0xa9>
+  8037cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8037d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8037d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8037e0:	48 8b 00             	mov    (%rax),%rax
+  8037e3:	eb 47                	jmp    80382c <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8037e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037e9:	8b 00                	mov    (%rax),%eax
+  8037eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8037ee:	77 24                	ja     803814 <getint+0xdd>
+  8037f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8037f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037fc:	8b 00                	mov    (%rax),%eax
+  8037fe:	89 c0                	mov    %eax,%eax
+  803800:	48 01 d0             	add    %rdx,%rax
+  803803:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803807:	8b 12                	mov    (%rdx),%edx
+  803809:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80380c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803810:	89 0a                	mov    %ecx,(%rdx)
+  803812:	eb 14                	jmp    803828 <getint+0xf1>
+  803814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803818:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80381c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803820:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803824:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803828:	8b 00                	mov    (%rax),%eax
+  80382a:	48 98                	cltq
+}
+  80382c:	c9                   	leave
+  80382d:	c3                   	ret
+
+000000000080382e <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80382e:	55                   	push   %rbp
+  80382f:	48 89 e5             	mov    %rsp,%rbp
+  803832:	41 54                	push   %r12
+  803834:	53                   	push   %rbx
+  803835:	48 83 ec 60          	sub    $0x60,%rsp
+  803839:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80383d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803841:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803845:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  803849:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80384d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  803851:	48 8b 06             	mov    (%rsi),%rax
+  803854:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803858:	48 89 01             	mov    %rax,(%rcx)
+  80385b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80385f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803863:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803867:	eb 17                	jmp    803880 <vprintfmt+0x52>
+      if (ch == '\0')
+  803869:	85 db                	test   %ebx,%ebx
+  80386b:	0f 84 bf 04 00 00    	je     803d30 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  803871:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803875:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803879:	48 89 c6             	mov    %rax,%rsi
+  80387c:	89 df                	mov    %ebx,%edi
+  80387e:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803880:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803884:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803888:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80388c:	0f b6 00             	movzbl (%rax),%eax
+  80388f:	0f b6 d8             	movzbl %al,%ebx
+  803892:	83 fb 25             	cmp    $0x25,%ebx
+  803895:	75 d2                	jne    803869 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803897:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  80389b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8038a2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8038a9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8038b0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8038b7:	eb 04                	jmp    8038bd <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8038b9:	90                   	nop
+  8038ba:	eb 01                	jmp    8038bd <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8038bc:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8038bd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8038c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8038c5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8038c9:	0f b6 00             	movzbl (%rax),%eax
+  8038cc:	0f b6 d8             	movzbl %al,%ebx
+  8038cf:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8038d2:	83 f8 55             	cmp    $0x55,%eax
+  8038d5:	0f 87 22 04 00 00    	ja     803cfd <vprintfmt+0x4cf>
+  8038db:	89 c0                	mov    %eax,%eax
+  8038dd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8038e4:	00 
+  8038e5:	48 b8 d8 56 80 00 00 	movabs $0x8056d8,%rax
+  8038ec:	00 00 00 
+  8038ef:	48 01 d0             	add    %rdx,%rax
+  8038f2:	48 8b 00             	mov    (%rax),%rax
+  8038f5:	ff e0                	jmp    *%rax
+        padc = '-';
+  8038f7:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8038fb:	eb c0                	jmp    8038bd <vprintfmt+0x8f>
+        padc = '0';
+  8038fd:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803901:	eb ba                	jmp    8038bd <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  803903:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80390a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80390d:	89 d0                	mov    %edx,%eax
+  80390f:	c1 e0 02             	shl    $0x2,%eax
+  803912:	01 d0                	add    %edx,%eax
+  803914:	01 c0                	add    %eax,%eax
+  803916:	01 d8                	add    %ebx,%eax
+  803918:	83 e8 30             	sub    $0x30,%eax
+  80391b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80391e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803922:	0f b6 00             	movzbl (%rax),%eax
+  803925:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  803928:	83 fb 2f             	cmp    $0x2f,%ebx
+  80392b:	7e 60                	jle    80398d <vprintfmt+0x15f>
+  80392d:	83 fb 39             	cmp    $0x39,%ebx
+  803930:	7f 5b                	jg     80398d <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  803932:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  803937:	eb d1                	jmp    80390a <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  803939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393c:	83 f8 2f             	cmp    $0x2f,%eax
+  80393f:	77 17                	ja     803958 <vprintfmt+0x12a>
+  803941:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803945:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803948:	89 d2                	mov    %edx,%edx
+  80394a:	48 01 d0             	add    %rdx,%rax
+  80394d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803950:	83 c2 08             	add    $0x8,%edx
+  803953:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803956:	eb 0c                	jmp    803964 <vprintfmt+0x136>
+  803958:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80395c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803960:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803964:	8b 00                	mov    (%rax),%eax
+  803966:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  803969:	eb 23                	jmp    80398e <vprintfmt+0x160>
+        if (width < 0)
+  80396b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80396f:	0f 89 44 ff ff ff    	jns    8038b9 <vprintfmt+0x8b>
+          width = 0;
+  803975:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  80397c:	e9 38 ff ff ff       	jmp    8038b9 <vprintfmt+0x8b>
+        altflag = 1;
+  803981:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803988:	e9 30 ff ff ff       	jmp    8038bd <vprintfmt+0x8f>
+        goto process_precision;
+  80398d:	90                   	nop
+        if (width < 0)
+  80398e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803992:	0f 89 24 ff ff ff    	jns    8038bc <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803998:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80399b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80399e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8039a5:	e9 12 ff ff ff       	jmp    8038bc <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8039aa:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8039ae:	e9 0a ff ff ff       	jmp    8038bd <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8039b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8039b9:	77 17                	ja     8039d2 <vprintfmt+0x1a4>
+  8039bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039bf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8039c2:	89 d2                	mov    %edx,%edx
+  8039c4:	48 01 d0             	add    %rdx,%rax
+  8039c7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8039ca:	83 c2 08             	add    $0x8,%edx
+  8039cd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8039d0:	eb 0c                	jmp    8039de <vprintfmt+0x1b0>
+  8039d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8039d6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8039da:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8039de:	8b 00                	mov    (%rax),%eax
+  8039e0:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8039e4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8039e8:	48 89 d6             	mov    %rdx,%rsi
+  8039eb:	89 c7                	mov    %eax,%edi
+  8039ed:	ff d1                	call   *%rcx
+        break;
+  8039ef:	e9 37 03 00 00       	jmp    803d2b <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8039f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8039fa:	77 17                	ja     803a13 <vprintfmt+0x1e5>
+  8039fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a00:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803a03:	89 d2                	mov    %edx,%edx
+  803a05:	48 01 d0             	add    %rdx,%rax
+  803a08:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803a0b:	83 c2 08             	add    $0x8,%edx
+  803a0e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803a11:	eb 0c                	jmp    803a1f <vprintfmt+0x1f1>
+  803a13:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a17:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803a1b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803a1f:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  803a21:	85 db                	test   %ebx,%ebx
+  803a23:	79 02                	jns    803a27 <vprintfmt+0x1f9>
+          err = -err;
+  803a25:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  803a27:	83 fb 15             	cmp    $0x15,%ebx
+  803a2a:	7f 16                	jg     803a42 <vprintfmt+0x214>
+  803a2c:	48 ba 00 56 80 00 00 	movabs $0x805600,%rdx
+  803a33:	00 00 00 
+  803a36:	48 63 c3             	movslq %ebx,%rax
+  803a39:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  803a3d:	4d 85 e4             	test   %r12,%r12
+  803a40:	75 2e                	jne    803a70 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  803a42:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803a46:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a4a:	89 d9                	mov    %ebx,%ecx
+  803a4c:	48 ba c1 56 80 00 00 	movabs $0x8056c1,%rdx
+  803a53:	00 00 00 
+  803a56:	48 89 c7             	mov    %rax,%rdi
+  803a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5e:	49 b8 3a 3d 80 00 00 	movabs $0x803d3a,%r8
+  803a65:	00 00 00 
+  803a68:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803a6b:	e9 bb 02 00 00       	jmp    803d2b <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  803a70:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803a74:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a78:	4c 89 e1             	mov    %r12,%rcx
+  803a7b:	48 ba ca 56 80 00 00 	movabs $0x8056ca,%rdx
+  803a82:	00 00 00 
+  803a85:	48 89 c7             	mov    %rax,%rdi
+  803a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8d:	49 b8 3a 3d 80 00 00 	movabs $0x803d3a,%r8
+  803a94:	00 00 00 
+  803a97:	41 ff d0             	call   *%r8
+        break;
+  803a9a:	e9 8c 02 00 00       	jmp    803d2b <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803a9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aa2:	83 f8 2f             	cmp    $0x2f,%eax
+  803aa5:	77 17                	ja     803abe <vprintfmt+0x290>
+  803aa7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aab:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803aae:	89 d2                	mov    %edx,%edx
+  803ab0:	48 01 d0             	add    %rdx,%rax
+  803ab3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803ab6:	83 c2 08             	add    $0x8,%edx
+  803ab9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803abc:	eb 0c                	jmp    803aca <vprintfmt+0x29c>
+  803abe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ac2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803ac6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803aca:	4c 8b 20             	mov    (%rax),%r12
+  803acd:	4d 85 e4             	test   %r12,%r12
+  803ad0:	75 0a                	jne    803adc <vprintfmt+0x2ae>
+          p = "(null)";
+  803ad2:	49 bc cd 56 80 00 00 	movabs $0x8056cd,%r12
+  803ad9:	00 00 00 
+        if (width > 0 && padc != '-')
+  803adc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803ae0:	7e 78                	jle    803b5a <vprintfmt+0x32c>
+  803ae2:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  803ae6:	74 72                	je     803b5a <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803ae8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803aeb:	48 98                	cltq
+  803aed:	48 89 c6             	mov    %rax,%rsi
+  803af0:	4c 89 e7             	mov    %r12,%rdi
+  803af3:	48 b8 46 44 80 00 00 	movabs $0x804446,%rax
+  803afa:	00 00 00 
+  803afd:	ff d0                	call   *%rax
+  803aff:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803b02:	eb 17                	jmp    803b1b <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803b04:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  803b08:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803b0c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803b10:	48 89 d6             	mov    %rdx,%rsi
+  803b13:	89 c7                	mov    %eax,%edi
+  803b15:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803b17:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803b1b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803b1f:	7f e3                	jg     803b04 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803b21:	eb 37                	jmp    803b5a <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  803b23:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b27:	74 1e                	je     803b47 <vprintfmt+0x319>
+  803b29:	83 fb 1f             	cmp    $0x1f,%ebx
+  803b2c:	7e 05                	jle    803b33 <vprintfmt+0x305>
+  803b2e:	83 fb 7e             	cmp    $0x7e,%ebx
+  803b31:	7e 14                	jle    803b47 <vprintfmt+0x319>
+            putch('?', putdat);
+  803b33:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b37:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803b3b:	48 89 c6             	mov    %rax,%rsi
+  803b3e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803b43:	ff d2                	call   *%rdx
+  803b45:	eb 0f                	jmp    803b56 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  803b47:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b4b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803b4f:	48 89 c6             	mov    %rax,%rsi
+  803b52:	89 df                	mov    %ebx,%edi
+  803b54:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803b56:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803b5a:	4c 89 e0             	mov    %r12,%rax
+  803b5d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803b61:	0f b6 00             	movzbl (%rax),%eax
+  803b64:	0f be d8             	movsbl %al,%ebx
+  803b67:	85 db                	test   %ebx,%ebx
+  803b69:	74 28                	je     803b93 <vprintfmt+0x365>
+  803b6b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803b6f:	78 b2                	js     803b23 <vprintfmt+0x2f5>
+  803b71:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  803b75:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803b79:	79 a8                	jns    803b23 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803b7b:	eb 16                	jmp    803b93 <vprintfmt+0x365>
+          putch(' ', putdat);
+  803b7d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b81:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803b85:	48 89 c6             	mov    %rax,%rsi
+  803b88:	bf 20 00 00 00       	mov    $0x20,%edi
+  803b8d:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803b8f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803b93:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803b97:	7f e4                	jg     803b7d <vprintfmt+0x34f>
+        break;
+  803b99:	e9 8d 01 00 00       	jmp    803d2b <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803b9e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803ba1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803ba5:	89 d6                	mov    %edx,%esi
+  803ba7:	48 89 c7             	mov    %rax,%rdi
+  803baa:	48 b8 37 37 80 00 00 	movabs $0x803737,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+  803bb6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803bba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bbe:	48 85 c0             	test   %rax,%rax
+  803bc1:	79 1d                	jns    803be0 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  803bc3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803bc7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803bcb:	48 89 c6             	mov    %rax,%rsi
+  803bce:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803bd3:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803bd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bd9:	48 f7 d8             	neg    %rax
+  803bdc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803be0:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803be7:	e9 d2 00 00 00       	jmp    803cbe <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803bec:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803bef:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803bf3:	89 d6                	mov    %edx,%esi
+  803bf5:	48 89 c7             	mov    %rax,%rdi
+  803bf8:	48 b8 40 36 80 00 00 	movabs $0x803640,%rax
+  803bff:	00 00 00 
+  803c02:	ff d0                	call   *%rax
+  803c04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  803c08:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803c0f:	e9 aa 00 00 00       	jmp    803cbe <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  803c14:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803c17:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803c1b:	89 d6                	mov    %edx,%esi
+  803c1d:	48 89 c7             	mov    %rax,%rdi
+  803c20:	48 b8 40 36 80 00 00 	movabs $0x803640,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+  803c2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  803c30:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  803c37:	e9 82 00 00 00       	jmp    803cbe <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  803c3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803c40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803c44:	48 89 c6             	mov    %rax,%rsi
+  803c47:	bf 30 00 00 00       	mov    $0x30,%edi
+  803c4c:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  803c4e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803c52:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803c56:	48 89 c6             	mov    %rax,%rsi
+  803c59:	bf 78 00 00 00       	mov    $0x78,%edi
+  803c5e:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  803c60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c63:	83 f8 2f             	cmp    $0x2f,%eax
+  803c66:	77 17                	ja     803c7f <vprintfmt+0x451>
+  803c68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c6c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803c6f:	89 d2                	mov    %edx,%edx
+  803c71:	48 01 d0             	add    %rdx,%rax
+  803c74:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803c77:	83 c2 08             	add    $0x8,%edx
+  803c7a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803c7d:	eb 0c                	jmp    803c8b <vprintfmt+0x45d>
+  803c7f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803c87:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803c8b:	48 8b 00             	mov    (%rax),%rax
+  803c8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803c92:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803c99:	eb 23                	jmp    803cbe <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803c9b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803c9e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803ca2:	89 d6                	mov    %edx,%esi
+  803ca4:	48 89 c7             	mov    %rax,%rdi
+  803ca7:	48 b8 40 36 80 00 00 	movabs $0x803640,%rax
+  803cae:	00 00 00 
+  803cb1:	ff d0                	call   *%rax
+  803cb3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803cb7:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803cbe:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  803cc3:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803cc6:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803cc9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803ccd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803cd1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cd5:	45 89 c1             	mov    %r8d,%r9d
+  803cd8:	41 89 f8             	mov    %edi,%r8d
+  803cdb:	48 89 c7             	mov    %rax,%rdi
+  803cde:	48 b8 88 35 80 00 00 	movabs $0x803588,%rax
+  803ce5:	00 00 00 
+  803ce8:	ff d0                	call   *%rax
+        break;
+  803cea:	eb 3f                	jmp    803d2b <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803cec:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803cf0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803cf4:	48 89 c6             	mov    %rax,%rsi
+  803cf7:	89 df                	mov    %ebx,%edi
+  803cf9:	ff d2                	call   *%rdx
+        break;
+  803cfb:	eb 2e                	jmp    803d2b <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803cfd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803d01:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803d05:	48 89 c6             	mov    %rax,%rsi
+  803d08:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d0d:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803d0f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803d14:	eb 05                	jmp    803d1b <vprintfmt+0x4ed>
+  803d16:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803d1b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803d1f:	48 83 e8 01          	sub    $0x1,%rax
+  803d23:	0f b6 00             	movzbl (%rax),%eax
+  803d26:	3c 25                	cmp    $0x25,%al
+  803d28:	75 ec                	jne    803d16 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  803d2a:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803d2b:	e9 50 fb ff ff       	jmp    803880 <vprintfmt+0x52>
+        return;
+  803d30:	90                   	nop
+    }
+  }
+}
+  803d31:	48 83 c4 60          	add    $0x60,%rsp
+  803d35:	5b                   	pop    %rbx
+  803d36:	41 5c                	pop    %r12
+  803d38:	5d                   	pop    %rbp
+  803d39:	c3                   	ret
+
+0000000000803d3a <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803d3a:	55                   	push   %rbp
+  803d3b:	48 89 e5             	mov    %rsp,%rbp
+  803d3e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803d45:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803d4c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  803d53:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803d5a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803d61:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803d68:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803d6f:	84 c0                	test   %al,%al
+  803d71:	74 20                	je     803d93 <printfmt+0x59>
+  803d73:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803d77:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803d7b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803d7f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803d83:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803d87:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803d8b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803d8f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803d93:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803d9a:	00 00 00 
+  803d9d:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803da4:	00 00 00 
+  803da7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803dab:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803db2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803db9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803dc0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803dc7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803dce:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803dd5:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803ddc:	48 89 c7             	mov    %rax,%rdi
+  803ddf:	48 b8 2e 38 80 00 00 	movabs $0x80382e,%rax
+  803de6:	00 00 00 
+  803de9:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803deb:	90                   	nop
+  803dec:	c9                   	leave
+  803ded:	c3                   	ret
+
+0000000000803dee <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803dee:	55                   	push   %rbp
+  803def:	48 89 e5             	mov    %rsp,%rbp
+  803df2:	48 83 ec 10          	sub    $0x10,%rsp
+  803df6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803df9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803dfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e01:	8b 40 10             	mov    0x10(%rax),%eax
+  803e04:	8d 50 01             	lea    0x1(%rax),%edx
+  803e07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e0b:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803e0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e12:	48 8b 10             	mov    (%rax),%rdx
+  803e15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e19:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803e1d:	48 39 c2             	cmp    %rax,%rdx
+  803e20:	73 17                	jae    803e39 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803e22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e26:	48 8b 00             	mov    (%rax),%rax
+  803e29:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803e2d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e31:	48 89 0a             	mov    %rcx,(%rdx)
+  803e34:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803e37:	88 10                	mov    %dl,(%rax)
+}
+  803e39:	90                   	nop
+  803e3a:	c9                   	leave
+  803e3b:	c3                   	ret
+
+0000000000803e3c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	48 83 ec 40          	sub    $0x40,%rsp
+  803e44:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803e48:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803e4b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803e4f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803e53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e57:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803e5b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803e5e:	48 98                	cltq
+  803e60:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e68:	48 01 d0             	add    %rdx,%rax
+  803e6b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803e6f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803e76:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803e7b:	74 06                	je     803e83 <vsnprintf+0x47>
+  803e7d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803e81:	7f 07                	jg     803e8a <vsnprintf+0x4e>
+    return -E_INVAL;
+  803e83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e88:	eb 32                	jmp    803ebc <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803e8a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e8e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803e92:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803e96:	48 89 c6             	mov    %rax,%rsi
+  803e99:	48 b8 ee 3d 80 00 00 	movabs $0x803dee,%rax
+  803ea0:	00 00 00 
+  803ea3:	48 89 c7             	mov    %rax,%rdi
+  803ea6:	48 b8 2e 38 80 00 00 	movabs $0x80382e,%rax
+  803ead:	00 00 00 
+  803eb0:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803eb2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803eb6:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803eb9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803ebc:	c9                   	leave
+  803ebd:	c3                   	ret
+
+0000000000803ebe <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803ebe:	55                   	push   %rbp
+  803ebf:	48 89 e5             	mov    %rsp,%rbp
+  803ec2:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803ec9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803ed0:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803ed6:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803edd:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803ee4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803eeb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803ef2:	84 c0                	test   %al,%al
+  803ef4:	74 20                	je     803f16 <snprintf+0x58>
+  803ef6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803efa:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803efe:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803f02:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803f06:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803f0a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803f0e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803f12:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803f16:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803f1d:	00 00 00 
+  803f20:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803f27:	00 00 00 
+  803f2a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f2e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803f35:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803f3c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803f43:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803f4a:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803f51:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803f57:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803f5e:	48 89 c7             	mov    %rax,%rdi
+  803f61:	48 b8 3c 3e 80 00 00 	movabs $0x803e3c,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+  803f6d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803f73:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803f79:	c9                   	leave
+  803f7a:	c3                   	ret
+
+0000000000803f7b <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803f7b:	55                   	push   %rbp
+  803f7c:	48 89 e5             	mov    %rsp,%rbp
+  803f7f:	53                   	push   %rbx
+  803f80:	48 83 ec 38          	sub    $0x38,%rsp
+  803f84:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803f87:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f8b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803f8f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f93:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803f97:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f9f:	89 d1                	mov    %edx,%ecx
+  803fa1:	0f a2                	cpuid
+  803fa3:	89 de                	mov    %ebx,%esi
+  803fa5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803fa8:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803fab:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803fae:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803fb1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803fb6:	74 09                	je     803fc1 <cpuid+0x46>
+}
+  803fb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fbc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803fbf:	89 10                	mov    %edx,(%rax)
+
+  803fc1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803fc6:	74 09                	je     803fd1 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803fc8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803fcc:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803fcf:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803fd1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803fd6:	74 09                	je     803fe1 <cpuid+0x66>
+char *
+  803fd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fdc:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803fdf:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803fe1:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803fe6:	74 09                	je     803ff1 <cpuid+0x76>
+  for (; *s; s++)
+  803fe8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fec:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803fef:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803ff1:	90                   	nop
+  803ff2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ff6:	c9                   	leave
+  803ff7:	c3                   	ret
+
+0000000000803ff8 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803ff8:	55                   	push   %rbp
+  803ff9:	48 89 e5             	mov    %rsp,%rbp
+  803ffc:	48 83 ec 18          	sub    $0x18,%rsp
+  804000:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  804003:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804006:	89 c1                	mov    %eax,%ecx
+  804008:	0f 01 d0             	xgetbv
+  80400b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80400e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  804011:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804014:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804017:	48 c1 e2 20          	shl    $0x20,%rdx
+  80401b:	48 09 d0             	or     %rdx,%rax
+#else
+  80401e:	c9                   	leave
+  80401f:	c3                   	ret
+
+0000000000804020 <string_cpu>:
+string_cpu(void) {
+  804020:	55                   	push   %rbp
+  804021:	48 89 e5             	mov    %rsp,%rbp
+  804024:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  804028:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80402f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  804036:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80403d:	00 00 00 
+  804040:	8b 00                	mov    (%rax),%eax
+  804042:	85 c0                	test   %eax,%eax
+  804044:	78 11                	js     804057 <string_cpu+0x37>
+    return string_features;
+  804046:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80404d:	00 00 00 
+  804050:	8b 00                	mov    (%rax),%eax
+  804052:	e9 df 00 00 00       	jmp    804136 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  804057:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80405b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80406b:	48 89 c6             	mov    %rax,%rsi
+  80406e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804073:	48 b8 7b 3f 80 00 00 	movabs $0x803f7b,%rax
+  80407a:	00 00 00 
+  80407d:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  80407f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804082:	83 f8 06             	cmp    $0x6,%eax
+  804085:	76 28                	jbe    8040af <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  804087:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80408b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804091:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804096:	48 89 c2             	mov    %rax,%rdx
+  804099:	be 00 00 00 00       	mov    $0x0,%esi
+  80409e:	bf 07 00 00 00       	mov    $0x7,%edi
+  8040a3:	48 b8 7b 3f 80 00 00 	movabs $0x803f7b,%rax
+  8040aa:	00 00 00 
+  8040ad:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8040af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b2:	25 00 02 00 00       	and    $0x200,%eax
+  8040b7:	85 c0                	test   %eax,%eax
+  8040b9:	74 04                	je     8040bf <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8040bb:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8040bf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8040c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8040c9:	48 89 c1             	mov    %rax,%rcx
+  8040cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8040d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8040db:	48 b8 7b 3f 80 00 00 	movabs $0x803f7b,%rax
+  8040e2:	00 00 00 
+  8040e5:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8040e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040ea:	83 e0 20             	and    $0x20,%eax
+  8040ed:	85 c0                	test   %eax,%eax
+  8040ef:	74 2a                	je     80411b <string_cpu+0xfb>
+  8040f1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8040f4:	25 00 00 00 08       	and    $0x8000000,%eax
+  8040f9:	85 c0                	test   %eax,%eax
+  8040fb:	74 1e                	je     80411b <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8040fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804102:	48 b8 f8 3f 80 00 00 	movabs $0x803ff8,%rax
+  804109:	00 00 00 
+  80410c:	ff d0                	call   *%rax
+  80410e:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  804111:	48 83 f8 06          	cmp    $0x6,%rax
+  804115:	75 04                	jne    80411b <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  804117:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80411b:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  804122:	00 00 00 
+  804125:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804128:	89 02                	mov    %eax,(%rdx)
+  80412a:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  804131:	00 00 00 
+  804134:	8b 00                	mov    (%rax),%eax
+}
+  804136:	c9                   	leave
+  804137:	c3                   	ret
+
+0000000000804138 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  804138:	55                   	push   %rbp
+  804139:	48 89 e5             	mov    %rsp,%rbp
+  80413c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  804140:	48 83 ec 60          	sub    $0x60,%rsp
+  804144:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  804149:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80414e:	83 e0 1f             	and    $0x1f,%eax
+  804151:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  804155:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  804159:	48 f7 d8             	neg    %rax
+  80415c:	48 89 c2             	mov    %rax,%rdx
+  80415f:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  804164:	48 01 d0             	add    %rdx,%rax
+  804167:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  80416c:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  804170:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  804176:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80417b:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80417f:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  804185:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  804189:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80418d:	89 c2                	mov    %eax,%edx
+  80418f:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  804193:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804198:	89 c1                	mov    %eax,%ecx
+  80419a:	d3 e6                	shl    %cl,%esi
+  80419c:	89 f0                	mov    %esi,%eax
+  80419e:	21 d0                	and    %edx,%eax
+  8041a0:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8041a4:	eb 21                	jmp    8041c7 <strlen_avx2+0x8f>
+    p += 32;
+  8041a6:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8041ac:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8041b1:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8041b5:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8041bb:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8041bf:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8041c3:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8041c7:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8041cc:	74 d8                	je     8041a6 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8041ce:	31 c0                	xor    %eax,%eax
+  8041d0:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8041d6:	48 63 d0             	movslq %eax,%rdx
+  8041d9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8041de:	48 01 d0             	add    %rdx,%rax
+  8041e1:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8041e6:	c9                   	leave
+  8041e7:	c3                   	ret
+
+00000000008041e8 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8041e8:	55                   	push   %rbp
+  8041e9:	48 89 e5             	mov    %rsp,%rbp
+  8041ec:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8041f0:	48 83 ec 40          	sub    $0x40,%rsp
+  8041f4:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8041f9:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8041fe:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  804203:	eb 77                	jmp    80427c <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  804205:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80420a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80420e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  804212:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  804217:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80421b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80421f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  804223:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  804227:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80422c:	74 3c                	je     80426a <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80422e:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  804232:	f7 d0                	not    %eax
+  804234:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804238:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80423c:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  804240:	48 63 d0             	movslq %eax,%rdx
+  804243:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804248:	48 01 d0             	add    %rdx,%rax
+  80424b:	0f b6 00             	movzbl (%rax),%eax
+  80424e:	0f b6 c0             	movzbl %al,%eax
+  804251:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  804255:	48 63 ca             	movslq %edx,%rcx
+  804258:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80425d:	48 01 ca             	add    %rcx,%rdx
+  804260:	0f b6 12             	movzbl (%rdx),%edx
+  804263:	0f b6 d2             	movzbl %dl,%edx
+  804266:	29 d0                	sub    %edx,%eax
+  804268:	eb 6b                	jmp    8042d5 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80426a:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  804270:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  804276:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80427c:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  804282:	77 81                	ja     804205 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  804284:	eb 42                	jmp    8042c8 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  804286:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80428b:	0f b6 10             	movzbl (%rax),%edx
+  80428e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  804293:	0f b6 00             	movzbl (%rax),%eax
+  804296:	38 c2                	cmp    %al,%dl
+  804298:	74 1c                	je     8042b6 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80429a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80429f:	0f b6 00             	movzbl (%rax),%eax
+  8042a2:	0f b6 c8             	movzbl %al,%ecx
+  8042a5:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8042aa:	0f b6 00             	movzbl (%rax),%eax
+  8042ad:	0f b6 d0             	movzbl %al,%edx
+  8042b0:	89 c8                	mov    %ecx,%eax
+  8042b2:	29 d0                	sub    %edx,%eax
+  8042b4:	eb 1f                	jmp    8042d5 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8042b6:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8042bc:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8042c2:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8042c8:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8042ce:	75 b6                	jne    804286 <memcmp_avx2+0x9e>
+  return 0;
+  8042d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042d5:	c9                   	leave
+  8042d6:	c3                   	ret
+
+00000000008042d7 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8042d7:	55                   	push   %rbp
+  8042d8:	48 89 e5             	mov    %rsp,%rbp
+  8042db:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8042df:	48 83 ec 60          	sub    $0x60,%rsp
+  8042e3:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8042e8:	89 f0                	mov    %esi,%eax
+  8042ea:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8042ef:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8042f3:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8042f8:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8042fc:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  804301:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  804307:	eb 47                	jmp    804350 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  804309:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80430e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  804312:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  804316:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80431c:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  804320:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  804324:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  804328:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80432d:	74 15                	je     804344 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80432f:	31 c0                	xor    %eax,%eax
+  804331:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  804337:	48 63 d0             	movslq %eax,%rdx
+  80433a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80433f:	48 01 d0             	add    %rdx,%rax
+  804342:	eb 3d                	jmp    804381 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  804344:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80434a:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  804350:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  804356:	77 b1                	ja     804309 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  804358:	eb 0c                	jmp    804366 <memfind_avx2+0x8f>
+  80435a:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  804360:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  804366:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80436c:	74 0e                	je     80437c <memfind_avx2+0xa5>
+  80436e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804373:	0f b6 00             	movzbl (%rax),%eax
+  804376:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80437a:	75 de                	jne    80435a <memfind_avx2+0x83>
+  return s;
+  80437c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804381:	c9                   	leave
+  804382:	c3                   	ret
+
+0000000000804383 <strlen>:
+strlen(const char *s) {
+  804383:	55                   	push   %rbp
+  804384:	48 89 e5             	mov    %rsp,%rbp
+  804387:	48 83 ec 40          	sub    $0x40,%rsp
+  80438b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80438f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804393:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804397:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  80439e:	00 00 00 
+  8043a1:	ff d0                	call   *%rax
+  8043a3:	83 e0 02             	and    $0x2,%eax
+  8043a6:	85 c0                	test   %eax,%eax
+  8043a8:	74 18                	je     8043c2 <strlen+0x3f>
+    return strlen_avx2(s);
+  8043aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043ae:	48 89 c7             	mov    %rax,%rdi
+  8043b1:	48 b8 38 41 80 00 00 	movabs $0x804138,%rax
+  8043b8:	00 00 00 
+  8043bb:	ff d0                	call   *%rax
+  8043bd:	e9 82 00 00 00       	jmp    804444 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8043c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c6:	83 e0 0f             	and    $0xf,%eax
+  8043c9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8043cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043cf:	48 f7 d8             	neg    %rax
+  8043d2:	48 89 c2             	mov    %rax,%rdx
+  8043d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043d9:	48 01 d0             	add    %rdx,%rax
+  8043dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8043e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e4:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8043e8:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8043ed:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8043f1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8043f5:	89 c2                	mov    %eax,%edx
+  8043f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043fa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8043ff:	89 c1                	mov    %eax,%ecx
+  804401:	d3 e6                	shl    %cl,%esi
+  804403:	89 f0                	mov    %esi,%eax
+  804405:	21 d0                	and    %edx,%eax
+  804407:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80440a:	eb 1d                	jmp    804429 <strlen+0xa6>
+    p += 16;
+  80440c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804411:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804415:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804419:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80441e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804422:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804426:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804429:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80442d:	74 dd                	je     80440c <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80442f:	31 c0                	xor    %eax,%eax
+  804431:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  804436:	48 63 d0             	movslq %eax,%rdx
+  804439:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80443d:	48 01 d0             	add    %rdx,%rax
+  804440:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  804444:	c9                   	leave
+  804445:	c3                   	ret
+
+0000000000804446 <strnlen>:
+strnlen(const char *s, size_t size) {
+  804446:	55                   	push   %rbp
+  804447:	48 89 e5             	mov    %rsp,%rbp
+  80444a:	48 83 ec 20          	sub    $0x20,%rsp
+  80444e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804452:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804456:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80445d:	eb 0e                	jmp    80446d <strnlen+0x27>
+    n++;
+  80445f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804463:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804468:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80446d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804472:	74 0b                	je     80447f <strnlen+0x39>
+  804474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804478:	0f b6 00             	movzbl (%rax),%eax
+  80447b:	84 c0                	test   %al,%al
+  80447d:	75 e0                	jne    80445f <strnlen+0x19>
+  return n;
+  80447f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804482:	c9                   	leave
+  804483:	c3                   	ret
+
+0000000000804484 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804484:	55                   	push   %rbp
+  804485:	48 89 e5             	mov    %rsp,%rbp
+  804488:	48 83 ec 20          	sub    $0x20,%rsp
+  80448c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804490:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804494:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804498:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80449c:	90                   	nop
+  80449d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044a1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8044a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8044a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ad:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8044b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044b5:	0f b6 12             	movzbl (%rdx),%edx
+  8044b8:	88 10                	mov    %dl,(%rax)
+  8044ba:	0f b6 00             	movzbl (%rax),%eax
+  8044bd:	84 c0                	test   %al,%al
+  8044bf:	75 dc                	jne    80449d <strcpy+0x19>
+  return ret;
+  8044c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8044c5:	c9                   	leave
+  8044c6:	c3                   	ret
+
+00000000008044c7 <strcat>:
+strcat(char *dst, const char *src) {
+  8044c7:	55                   	push   %rbp
+  8044c8:	48 89 e5             	mov    %rsp,%rbp
+  8044cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8044cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044d3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8044d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044db:	48 89 c7             	mov    %rax,%rdi
+  8044de:	48 b8 83 43 80 00 00 	movabs $0x804383,%rax
+  8044e5:	00 00 00 
+  8044e8:	ff d0                	call   *%rax
+  8044ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8044ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044f0:	48 63 d0             	movslq %eax,%rdx
+  8044f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044f7:	48 01 c2             	add    %rax,%rdx
+  8044fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044fe:	48 89 c6             	mov    %rax,%rsi
+  804501:	48 89 d7             	mov    %rdx,%rdi
+  804504:	48 b8 84 44 80 00 00 	movabs $0x804484,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+  return dst;
+  804510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804514:	c9                   	leave
+  804515:	c3                   	ret
+
+0000000000804516 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  804516:	55                   	push   %rbp
+  804517:	48 89 e5             	mov    %rsp,%rbp
+  80451a:	48 83 ec 28          	sub    $0x28,%rsp
+  80451e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804522:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804526:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80452a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80452e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  804532:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804539:	00 
+  80453a:	eb 2a                	jmp    804566 <strncpy+0x50>
+    *dst++ = *src;
+  80453c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804540:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804544:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804548:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80454c:	0f b6 12             	movzbl (%rdx),%edx
+  80454f:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  804551:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804555:	0f b6 00             	movzbl (%rax),%eax
+  804558:	84 c0                	test   %al,%al
+  80455a:	74 05                	je     804561 <strncpy+0x4b>
+      src++;
+  80455c:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  804561:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80456a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80456e:	72 cc                	jb     80453c <strncpy+0x26>
+  return ret;
+  804570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804574:	c9                   	leave
+  804575:	c3                   	ret
+
+0000000000804576 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  804576:	55                   	push   %rbp
+  804577:	48 89 e5             	mov    %rsp,%rbp
+  80457a:	48 83 ec 28          	sub    $0x28,%rsp
+  80457e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804582:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804586:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80458a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80458e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804592:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804597:	74 3d                	je     8045d6 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804599:	eb 1d                	jmp    8045b8 <strlcpy+0x42>
+      *dst++ = *src++;
+  80459b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80459f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8045a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8045a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045ab:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8045af:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8045b3:	0f b6 12             	movzbl (%rdx),%edx
+  8045b6:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8045b8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8045bd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8045c2:	74 0b                	je     8045cf <strlcpy+0x59>
+  8045c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045c8:	0f b6 00             	movzbl (%rax),%eax
+  8045cb:	84 c0                	test   %al,%al
+  8045cd:	75 cc                	jne    80459b <strlcpy+0x25>
+    *dst = '\0';
+  8045cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045d3:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8045d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045da:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8045de:	c9                   	leave
+  8045df:	c3                   	ret
+
+00000000008045e0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8045e0:	55                   	push   %rbp
+  8045e1:	48 89 e5             	mov    %rsp,%rbp
+  8045e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8045e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8045f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f8:	48 89 c7             	mov    %rax,%rdi
+  8045fb:	48 b8 83 43 80 00 00 	movabs $0x804383,%rax
+  804602:	00 00 00 
+  804605:	ff d0                	call   *%rax
+  804607:	48 98                	cltq
+  804609:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80460d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804611:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804615:	48 89 d6             	mov    %rdx,%rsi
+  804618:	48 89 c7             	mov    %rax,%rdi
+  80461b:	48 b8 46 44 80 00 00 	movabs $0x804446,%rax
+  804622:	00 00 00 
+  804625:	ff d0                	call   *%rax
+  804627:	48 98                	cltq
+  804629:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80462d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804631:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804635:	75 10                	jne    804647 <strlcat+0x67>
+    return maxlen + srclen;
+  804637:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80463b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80463f:	48 01 d0             	add    %rdx,%rax
+  804642:	e9 86 00 00 00       	jmp    8046cd <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  804647:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80464b:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80464f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804653:	73 2b                	jae    804680 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  804655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804659:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80465d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804661:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804665:	48 01 c1             	add    %rax,%rcx
+  804668:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80466c:	48 89 c6             	mov    %rax,%rsi
+  80466f:	48 89 cf             	mov    %rcx,%rdi
+  804672:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  804679:	00 00 00 
+  80467c:	ff d0                	call   *%rax
+  80467e:	eb 42                	jmp    8046c2 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804680:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804684:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804688:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80468c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804690:	48 01 c1             	add    %rax,%rcx
+  804693:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804697:	48 89 c6             	mov    %rax,%rsi
+  80469a:	48 89 cf             	mov    %rcx,%rdi
+  80469d:	48 b8 cd 4b 80 00 00 	movabs $0x804bcd,%rax
+  8046a4:	00 00 00 
+  8046a7:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8046a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8046ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046b1:	48 01 d0             	add    %rdx,%rax
+  8046b4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046bc:	48 01 d0             	add    %rdx,%rax
+  8046bf:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8046c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8046c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ca:	48 01 d0             	add    %rdx,%rax
+}
+  8046cd:	c9                   	leave
+  8046ce:	c3                   	ret
+
+00000000008046cf <strcmp>:
+strcmp(const char *p, const char *q) {
+  8046cf:	55                   	push   %rbp
+  8046d0:	48 89 e5             	mov    %rsp,%rbp
+  8046d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8046d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8046df:	eb 0a                	jmp    8046eb <strcmp+0x1c>
+    p++, q++;
+  8046e1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8046e6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8046eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ef:	0f b6 00             	movzbl (%rax),%eax
+  8046f2:	84 c0                	test   %al,%al
+  8046f4:	74 12                	je     804708 <strcmp+0x39>
+  8046f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046fa:	0f b6 10             	movzbl (%rax),%edx
+  8046fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804701:	0f b6 00             	movzbl (%rax),%eax
+  804704:	38 c2                	cmp    %al,%dl
+  804706:	74 d9                	je     8046e1 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  804708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80470c:	0f b6 00             	movzbl (%rax),%eax
+  80470f:	0f b6 d0             	movzbl %al,%edx
+  804712:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804716:	0f b6 00             	movzbl (%rax),%eax
+  804719:	0f b6 c0             	movzbl %al,%eax
+  80471c:	29 c2                	sub    %eax,%edx
+  80471e:	89 d0                	mov    %edx,%eax
+}
+  804720:	c9                   	leave
+  804721:	c3                   	ret
+
+0000000000804722 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  804722:	55                   	push   %rbp
+  804723:	48 89 e5             	mov    %rsp,%rbp
+  804726:	48 83 ec 18          	sub    $0x18,%rsp
+  80472a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80472e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804732:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  804736:	eb 0f                	jmp    804747 <strncmp+0x25>
+    n--, p++, q++;
+  804738:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80473d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804742:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  804747:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80474c:	74 1d                	je     80476b <strncmp+0x49>
+  80474e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804752:	0f b6 00             	movzbl (%rax),%eax
+  804755:	84 c0                	test   %al,%al
+  804757:	74 12                	je     80476b <strncmp+0x49>
+  804759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80475d:	0f b6 10             	movzbl (%rax),%edx
+  804760:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804764:	0f b6 00             	movzbl (%rax),%eax
+  804767:	38 c2                	cmp    %al,%dl
+  804769:	74 cd                	je     804738 <strncmp+0x16>
+  if (n == 0)
+  80476b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804770:	75 07                	jne    804779 <strncmp+0x57>
+    return 0;
+  804772:	ba 00 00 00 00       	mov    $0x0,%edx
+  804777:	eb 16                	jmp    80478f <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80477d:	0f b6 00             	movzbl (%rax),%eax
+  804780:	0f b6 d0             	movzbl %al,%edx
+  804783:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804787:	0f b6 00             	movzbl (%rax),%eax
+  80478a:	0f b6 c0             	movzbl %al,%eax
+  80478d:	29 c2                	sub    %eax,%edx
+}
+  80478f:	89 d0                	mov    %edx,%eax
+  804791:	c9                   	leave
+  804792:	c3                   	ret
+
+0000000000804793 <strchr>:
+strchr(const char *s, char c) {
+  804793:	55                   	push   %rbp
+  804794:	48 89 e5             	mov    %rsp,%rbp
+  804797:	48 83 ec 60          	sub    $0x60,%rsp
+  80479b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80479f:	89 f0                	mov    %esi,%eax
+  8047a1:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8047a4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047a8:	83 e0 0f             	and    $0xf,%eax
+  8047ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8047ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047b1:	48 f7 d8             	neg    %rax
+  8047b4:	48 89 c2             	mov    %rax,%rdx
+  8047b7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047bb:	48 01 d0             	add    %rdx,%rax
+  8047be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8047c2:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8047c6:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8047ca:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8047ce:	66 0f 6e c0          	movd   %eax,%xmm0
+  8047d2:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8047d6:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8047da:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8047df:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8047e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047e7:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8047eb:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8047ef:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8047f4:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8047f9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8047fd:	89 c2                	mov    %eax,%edx
+  8047ff:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804804:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804809:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80480d:	09 c2                	or     %eax,%edx
+  80480f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804812:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804817:	89 c1                	mov    %eax,%ecx
+  804819:	d3 e6                	shl    %cl,%esi
+  80481b:	89 f0                	mov    %esi,%eax
+  80481d:	21 d0                	and    %edx,%eax
+  80481f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804822:	eb 34                	jmp    804858 <strchr+0xc5>
+    p += 16;
+  804824:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  804829:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80482d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804831:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  804835:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80483a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80483f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804843:	89 c2                	mov    %eax,%edx
+  804845:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80484a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80484f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804853:	09 d0                	or     %edx,%eax
+  804855:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804858:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80485c:	74 c6                	je     804824 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80485e:	31 c0                	xor    %eax,%eax
+  804860:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  804865:	48 98                	cltq
+  804867:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  80486b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80486f:	0f b6 00             	movzbl (%rax),%eax
+  804872:	84 c0                	test   %al,%al
+  804874:	74 06                	je     80487c <strchr+0xe9>
+  804876:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80487a:	eb 05                	jmp    804881 <strchr+0xee>
+  80487c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804881:	c9                   	leave
+  804882:	c3                   	ret
+
+0000000000804883 <strfind>:
+strfind(const char *s, char c) {
+  804883:	55                   	push   %rbp
+  804884:	48 89 e5             	mov    %rsp,%rbp
+  804887:	48 83 ec 10          	sub    $0x10,%rsp
+  80488b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80488f:	89 f0                	mov    %esi,%eax
+  804891:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804894:	eb 11                	jmp    8048a7 <strfind+0x24>
+    if (*s == c)
+  804896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80489a:	0f b6 00             	movzbl (%rax),%eax
+  80489d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8048a0:	74 12                	je     8048b4 <strfind+0x31>
+  for (; *s; s++)
+  8048a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8048a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ab:	0f b6 00             	movzbl (%rax),%eax
+  8048ae:	84 c0                	test   %al,%al
+  8048b0:	75 e4                	jne    804896 <strfind+0x13>
+  8048b2:	eb 01                	jmp    8048b5 <strfind+0x32>
+      break;
+  8048b4:	90                   	nop
+  return (char *)s;
+  8048b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8048b9:	c9                   	leave
+  8048ba:	c3                   	ret
+
+00000000008048bb <memset>:
+memset(void *v, int c, size_t n) {
+  8048bb:	55                   	push   %rbp
+  8048bc:	48 89 e5             	mov    %rsp,%rbp
+  8048bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8048c3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048c7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8048ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8048ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8048d6:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8048db:	76 41                	jbe    80491e <memset+0x63>
+  8048dd:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  8048e4:	00 00 00 
+  8048e7:	ff d0                	call   *%rax
+  8048e9:	83 e0 01             	and    $0x1,%eax
+  8048ec:	85 c0                	test   %eax,%eax
+  8048ee:	74 2e                	je     80491e <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8048f0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048f3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8048f7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048fb:	48 89 ce             	mov    %rcx,%rsi
+  8048fe:	48 89 f7             	mov    %rsi,%rdi
+  804901:	48 89 d1             	mov    %rdx,%rcx
+  804904:	fc                   	cld
+  804905:	f3 aa                	rep stos %al,%es:(%rdi)
+  804907:	48 89 ca             	mov    %rcx,%rdx
+  80490a:	48 89 fe             	mov    %rdi,%rsi
+  80490d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804911:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  804915:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804919:	e9 a7 00 00 00       	jmp    8049c5 <memset+0x10a>
+  if (n >= 8) {
+  80491e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804923:	0f 86 87 00 00 00    	jbe    8049b0 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  804929:	eb 16                	jmp    804941 <memset+0x86>
+      *p++ = c;
+  80492b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80492f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804933:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804937:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80493a:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80493c:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804941:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804945:	83 e0 07             	and    $0x7,%eax
+  804948:	48 85 c0             	test   %rax,%rax
+  80494b:	75 de                	jne    80492b <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80494d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804950:	0f b6 c0             	movzbl %al,%eax
+  804953:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80495a:	01 01 01 
+  80495d:	48 0f af c2          	imul   %rdx,%rax
+  804961:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  804965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804969:	48 c1 e8 03          	shr    $0x3,%rax
+  80496d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  804971:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804975:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804979:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80497d:	48 89 ce             	mov    %rcx,%rsi
+  804980:	48 89 f7             	mov    %rsi,%rdi
+  804983:	48 89 d1             	mov    %rdx,%rcx
+  804986:	fc                   	cld
+  804987:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80498a:	48 89 ca             	mov    %rcx,%rdx
+  80498d:	48 89 fe             	mov    %rdi,%rsi
+  804990:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804994:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804998:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  80499d:	eb 11                	jmp    8049b0 <memset+0xf5>
+    *p++ = c;
+  80499f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8049a7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8049ab:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8049ae:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8049b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049b4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049b8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049bc:	48 85 c0             	test   %rax,%rax
+  8049bf:	75 de                	jne    80499f <memset+0xe4>
+  return v;
+  8049c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8049c5:	c9                   	leave
+  8049c6:	c3                   	ret
+
+00000000008049c7 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8049c7:	55                   	push   %rbp
+  8049c8:	48 89 e5             	mov    %rsp,%rbp
+  8049cb:	48 83 ec 38          	sub    $0x38,%rsp
+  8049cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8049d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8049d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8049db:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8049e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8049eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049ef:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8049f3:	0f 83 da 00 00 00    	jae    804ad3 <memmove+0x10c>
+  8049f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a01:	48 01 d0             	add    %rdx,%rax
+  804a04:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804a08:	0f 83 c5 00 00 00    	jae    804ad3 <memmove+0x10c>
+    s += n;
+  804a0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a12:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  804a16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  804a1e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804a23:	0f 86 94 00 00 00    	jbe    804abd <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  804a29:	eb 1c                	jmp    804a47 <memmove+0x80>
+        *--d = *--s;
+  804a2b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804a30:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804a35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a39:	0f b6 10             	movzbl (%rax),%edx
+  804a3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a40:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  804a42:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804a47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a4b:	83 e0 07             	and    $0x7,%eax
+  804a4e:	48 85 c0             	test   %rax,%rax
+  804a51:	75 d8                	jne    804a2b <memmove+0x64>
+      nq = n / 8;
+  804a53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a57:	48 c1 e8 03          	shr    $0x3,%rax
+  804a5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804a5f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  804a64:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  804a69:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  804a6e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804a72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a7a:	48 89 cf             	mov    %rcx,%rdi
+  804a7d:	48 89 d6             	mov    %rdx,%rsi
+  804a80:	48 89 c1             	mov    %rax,%rcx
+  804a83:	fd                   	std
+  804a84:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804a87:	fc                   	cld
+  804a88:	48 89 c8             	mov    %rcx,%rax
+  804a8b:	48 89 f2             	mov    %rsi,%rdx
+  804a8e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804a92:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804a96:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804a9a:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804a9f:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804aa4:	eb 17                	jmp    804abd <memmove+0xf6>
+      *--d = *--s;
+  804aa6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804aab:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ab4:	0f b6 10             	movzbl (%rax),%edx
+  804ab7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804abb:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804abd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ac1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804ac5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804ac9:	48 85 c0             	test   %rax,%rax
+  804acc:	75 d8                	jne    804aa6 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804ace:	e9 f4 00 00 00       	jmp    804bc7 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804ad3:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804ad8:	76 46                	jbe    804b20 <memmove+0x159>
+  804ada:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  804ae1:	00 00 00 
+  804ae4:	ff d0                	call   *%rax
+  804ae6:	83 e0 01             	and    $0x1,%eax
+  804ae9:	85 c0                	test   %eax,%eax
+  804aeb:	74 33                	je     804b20 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804aed:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804af1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804af5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804af9:	48 89 cf             	mov    %rcx,%rdi
+  804afc:	48 89 d6             	mov    %rdx,%rsi
+  804aff:	48 89 c1             	mov    %rax,%rcx
+  804b02:	fc                   	cld
+  804b03:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804b05:	48 89 c8             	mov    %rcx,%rax
+  804b08:	48 89 f2             	mov    %rsi,%rdx
+  804b0b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804b0f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804b13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  804b17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b1b:	e9 ab 00 00 00       	jmp    804bcb <memmove+0x204>
+    if (n >= 8) {
+  804b20:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804b25:	0f 86 8b 00 00 00    	jbe    804bb6 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  804b2b:	eb 22                	jmp    804b4f <memmove+0x188>
+        *d++ = *s++;
+  804b2d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b31:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804b35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804b39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b3d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804b41:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804b45:	0f b6 12             	movzbl (%rdx),%edx
+  804b48:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  804b4a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804b4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b53:	83 e0 07             	and    $0x7,%eax
+  804b56:	48 85 c0             	test   %rax,%rax
+  804b59:	75 d2                	jne    804b2d <memmove+0x166>
+      nq = n / 8;
+  804b5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b5f:	48 c1 e8 03          	shr    $0x3,%rax
+  804b63:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  804b67:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804b6b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b73:	48 89 cf             	mov    %rcx,%rdi
+  804b76:	48 89 d6             	mov    %rdx,%rsi
+  804b79:	48 89 c1             	mov    %rax,%rcx
+  804b7c:	fc                   	cld
+  804b7d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804b80:	48 89 c8             	mov    %rcx,%rax
+  804b83:	48 89 f2             	mov    %rsi,%rdx
+  804b86:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804b8a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804b8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804b92:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804b97:	eb 1d                	jmp    804bb6 <memmove+0x1ef>
+      *d++ = *s++;
+  804b99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b9d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804ba1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804ba5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ba9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804bad:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804bb1:	0f b6 12             	movzbl (%rdx),%edx
+  804bb4:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804bb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bba:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804bbe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804bc2:	48 85 c0             	test   %rax,%rax
+  804bc5:	75 d2                	jne    804b99 <memmove+0x1d2>
+  return dst;
+  804bc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804bcb:	c9                   	leave
+  804bcc:	c3                   	ret
+
+0000000000804bcd <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804bcd:	55                   	push   %rbp
+  804bce:	48 89 e5             	mov    %rsp,%rbp
+  804bd1:	48 83 ec 18          	sub    $0x18,%rsp
+  804bd5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bd9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804bdd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804be1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804be5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804be9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bed:	48 89 ce             	mov    %rcx,%rsi
+  804bf0:	48 89 c7             	mov    %rax,%rdi
+  804bf3:	48 b8 c7 49 80 00 00 	movabs $0x8049c7,%rax
+  804bfa:	00 00 00 
+  804bfd:	ff d0                	call   *%rax
+}
+  804bff:	c9                   	leave
+  804c00:	c3                   	ret
+
+0000000000804c01 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804c01:	55                   	push   %rbp
+  804c02:	48 89 e5             	mov    %rsp,%rbp
+  804c05:	48 83 ec 40          	sub    $0x40,%rsp
+  804c09:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804c0d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804c11:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  804c15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c19:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804c1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804c25:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  804c2a:	0f 86 a7 00 00 00    	jbe    804cd7 <memcmp+0xd6>
+  804c30:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  804c37:	00 00 00 
+  804c3a:	ff d0                	call   *%rax
+  804c3c:	83 e0 02             	and    $0x2,%eax
+  804c3f:	85 c0                	test   %eax,%eax
+  804c41:	0f 84 90 00 00 00    	je     804cd7 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  804c47:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c4b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c53:	48 89 ce             	mov    %rcx,%rsi
+  804c56:	48 89 c7             	mov    %rax,%rdi
+  804c59:	48 b8 e8 41 80 00 00 	movabs $0x8041e8,%rax
+  804c60:	00 00 00 
+  804c63:	ff d0                	call   *%rax
+  804c65:	e9 c2 00 00 00       	jmp    804d2c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  804c6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c6e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804c72:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804c76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c7a:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804c7e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804c82:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804c86:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804c89:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804c90:	74 36                	je     804cc8 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804c92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c95:	f7 d0                	not    %eax
+  804c97:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804c9b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804c9e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ca1:	48 63 d0             	movslq %eax,%rdx
+  804ca4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ca8:	48 01 d0             	add    %rdx,%rax
+  804cab:	0f b6 00             	movzbl (%rax),%eax
+  804cae:	0f b6 c0             	movzbl %al,%eax
+  804cb1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804cb4:	48 63 ca             	movslq %edx,%rcx
+  804cb7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804cbb:	48 01 ca             	add    %rcx,%rdx
+  804cbe:	0f b6 12             	movzbl (%rdx),%edx
+  804cc1:	0f b6 d2             	movzbl %dl,%edx
+  804cc4:	29 d0                	sub    %edx,%eax
+  804cc6:	eb 64                	jmp    804d2c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804cc8:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804ccd:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804cd2:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  804cd7:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804cdc:	77 8c                	ja     804c6a <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804cde:	eb 36                	jmp    804d16 <memcmp+0x115>
+    if (*s1 != *s2)
+  804ce0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce4:	0f b6 10             	movzbl (%rax),%edx
+  804ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ceb:	0f b6 00             	movzbl (%rax),%eax
+  804cee:	38 c2                	cmp    %al,%dl
+  804cf0:	74 1a                	je     804d0c <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804cf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cf6:	0f b6 00             	movzbl (%rax),%eax
+  804cf9:	0f b6 c8             	movzbl %al,%ecx
+  804cfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d00:	0f b6 00             	movzbl (%rax),%eax
+  804d03:	0f b6 d0             	movzbl %al,%edx
+  804d06:	89 c8                	mov    %ecx,%eax
+  804d08:	29 d0                	sub    %edx,%eax
+  804d0a:	eb 20                	jmp    804d2c <memcmp+0x12b>
+    s1++, s2++;
+  804d0c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804d11:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  804d16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d1a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804d1e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804d22:	48 85 c0             	test   %rax,%rax
+  804d25:	75 b9                	jne    804ce0 <memcmp+0xdf>
+  }
+
+  return 0;
+  804d27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d2c:	c9                   	leave
+  804d2d:	c3                   	ret
+
+0000000000804d2e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  804d2e:	55                   	push   %rbp
+  804d2f:	48 89 e5             	mov    %rsp,%rbp
+  804d32:	48 83 ec 50          	sub    $0x50,%rsp
+  804d36:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804d3a:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  804d3d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  804d41:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d45:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d49:	48 01 d0             	add    %rdx,%rax
+  804d4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  804d50:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804d53:	66 0f 6e c0          	movd   %eax,%xmm0
+  804d57:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804d5b:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804d5f:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804d64:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804d68:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804d6d:	76 73                	jbe    804de2 <memfind+0xb4>
+  804d6f:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  804d76:	00 00 00 
+  804d79:	ff d0                	call   *%rax
+  804d7b:	83 e0 02             	and    $0x2,%eax
+  804d7e:	85 c0                	test   %eax,%eax
+  804d80:	74 60                	je     804de2 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804d82:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804d85:	0f b6 c8             	movzbl %al,%ecx
+  804d88:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d90:	89 ce                	mov    %ecx,%esi
+  804d92:	48 89 c7             	mov    %rax,%rdi
+  804d95:	48 b8 d7 42 80 00 00 	movabs $0x8042d7,%rax
+  804d9c:	00 00 00 
+  804d9f:	ff d0                	call   *%rax
+  804da1:	eb 6c                	jmp    804e0f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804da3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804da7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804dab:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804daf:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804db4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804db8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804dbc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804dbf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804dc3:	74 13                	je     804dd8 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804dc5:	31 c0                	xor    %eax,%eax
+  804dc7:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804dcc:	48 63 d0             	movslq %eax,%rdx
+  804dcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dd3:	48 01 d0             	add    %rdx,%rax
+  804dd6:	eb 37                	jmp    804e0f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804dd8:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804ddd:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804de2:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804de7:	77 ba                	ja     804da3 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804de9:	eb 13                	jmp    804dfe <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804deb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804def:	0f b6 00             	movzbl (%rax),%eax
+  804df2:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804df5:	38 d0                	cmp    %dl,%al
+  804df7:	74 11                	je     804e0a <memfind+0xdc>
+  for (; s < ends; s++)
+  804df9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804dfe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e02:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804e06:	72 e3                	jb     804deb <memfind+0xbd>
+  804e08:	eb 01                	jmp    804e0b <memfind+0xdd>
+      break;
+  804e0a:	90                   	nop
+  return (void *)s;
+  804e0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804e0f:	c9                   	leave
+  804e10:	c3                   	ret
+
+0000000000804e11 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804e11:	55                   	push   %rbp
+  804e12:	48 89 e5             	mov    %rsp,%rbp
+  804e15:	48 83 ec 38          	sub    $0x38,%rsp
+  804e19:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804e1d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804e21:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804e24:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804e2b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804e32:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804e33:	eb 05                	jmp    804e3a <strtol+0x29>
+    s++;
+  804e35:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804e3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e3e:	0f b6 00             	movzbl (%rax),%eax
+  804e41:	3c 20                	cmp    $0x20,%al
+  804e43:	74 f0                	je     804e35 <strtol+0x24>
+  804e45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e49:	0f b6 00             	movzbl (%rax),%eax
+  804e4c:	3c 09                	cmp    $0x9,%al
+  804e4e:	74 e5                	je     804e35 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804e50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e54:	0f b6 00             	movzbl (%rax),%eax
+  804e57:	3c 2b                	cmp    $0x2b,%al
+  804e59:	75 07                	jne    804e62 <strtol+0x51>
+    s++;
+  804e5b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804e60:	eb 17                	jmp    804e79 <strtol+0x68>
+  else if (*s == '-')
+  804e62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e66:	0f b6 00             	movzbl (%rax),%eax
+  804e69:	3c 2d                	cmp    $0x2d,%al
+  804e6b:	75 0c                	jne    804e79 <strtol+0x68>
+    s++, neg = 1;
+  804e6d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804e72:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804e79:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804e7d:	74 06                	je     804e85 <strtol+0x74>
+  804e7f:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804e83:	75 28                	jne    804ead <strtol+0x9c>
+  804e85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e89:	0f b6 00             	movzbl (%rax),%eax
+  804e8c:	3c 30                	cmp    $0x30,%al
+  804e8e:	75 1d                	jne    804ead <strtol+0x9c>
+  804e90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e94:	48 83 c0 01          	add    $0x1,%rax
+  804e98:	0f b6 00             	movzbl (%rax),%eax
+  804e9b:	3c 78                	cmp    $0x78,%al
+  804e9d:	75 0e                	jne    804ead <strtol+0x9c>
+    s += 2, base = 16;
+  804e9f:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804ea4:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804eab:	eb 2c                	jmp    804ed9 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804ead:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804eb1:	75 19                	jne    804ecc <strtol+0xbb>
+  804eb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804eb7:	0f b6 00             	movzbl (%rax),%eax
+  804eba:	3c 30                	cmp    $0x30,%al
+  804ebc:	75 0e                	jne    804ecc <strtol+0xbb>
+    s++, base = 8;
+  804ebe:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ec3:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804eca:	eb 0d                	jmp    804ed9 <strtol+0xc8>
+  else if (base == 0)
+  804ecc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804ed0:	75 07                	jne    804ed9 <strtol+0xc8>
+    base = 10;
+  804ed2:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804ed9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804edd:	0f b6 00             	movzbl (%rax),%eax
+  804ee0:	3c 2f                	cmp    $0x2f,%al
+  804ee2:	7e 1d                	jle    804f01 <strtol+0xf0>
+  804ee4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ee8:	0f b6 00             	movzbl (%rax),%eax
+  804eeb:	3c 39                	cmp    $0x39,%al
+  804eed:	7f 12                	jg     804f01 <strtol+0xf0>
+      dig = *s - '0';
+  804eef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ef3:	0f b6 00             	movzbl (%rax),%eax
+  804ef6:	0f be c0             	movsbl %al,%eax
+  804ef9:	83 e8 30             	sub    $0x30,%eax
+  804efc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804eff:	eb 4e                	jmp    804f4f <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804f01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f05:	0f b6 00             	movzbl (%rax),%eax
+  804f08:	3c 60                	cmp    $0x60,%al
+  804f0a:	7e 1d                	jle    804f29 <strtol+0x118>
+  804f0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f10:	0f b6 00             	movzbl (%rax),%eax
+  804f13:	3c 7a                	cmp    $0x7a,%al
+  804f15:	7f 12                	jg     804f29 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804f17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f1b:	0f b6 00             	movzbl (%rax),%eax
+  804f1e:	0f be c0             	movsbl %al,%eax
+  804f21:	83 e8 57             	sub    $0x57,%eax
+  804f24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f27:	eb 26                	jmp    804f4f <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804f29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f2d:	0f b6 00             	movzbl (%rax),%eax
+  804f30:	3c 40                	cmp    $0x40,%al
+  804f32:	7e 47                	jle    804f7b <strtol+0x16a>
+  804f34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f38:	0f b6 00             	movzbl (%rax),%eax
+  804f3b:	3c 5a                	cmp    $0x5a,%al
+  804f3d:	7f 3c                	jg     804f7b <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804f3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f43:	0f b6 00             	movzbl (%rax),%eax
+  804f46:	0f be c0             	movsbl %al,%eax
+  804f49:	83 e8 37             	sub    $0x37,%eax
+  804f4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804f4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f52:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804f55:	7d 23                	jge    804f7a <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804f57:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804f5c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804f5f:	48 98                	cltq
+  804f61:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804f66:	48 89 c2             	mov    %rax,%rdx
+  804f69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f6c:	48 98                	cltq
+  804f6e:	48 01 d0             	add    %rdx,%rax
+  804f71:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804f75:	e9 5f ff ff ff       	jmp    804ed9 <strtol+0xc8>
+      break;
+  804f7a:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804f7b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804f80:	74 0b                	je     804f8d <strtol+0x17c>
+    *endptr = (char *)s;
+  804f82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f86:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f8a:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804f8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f91:	74 09                	je     804f9c <strtol+0x18b>
+  804f93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f97:	48 f7 d8             	neg    %rax
+  804f9a:	eb 04                	jmp    804fa0 <strtol+0x18f>
+  804f9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804fa0:	c9                   	leave
+  804fa1:	c3                   	ret
+
+0000000000804fa2 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804fa2:	55                   	push   %rbp
+  804fa3:	48 89 e5             	mov    %rsp,%rbp
+  804fa6:	48 83 ec 20          	sub    $0x20,%rsp
+  804faa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804fb2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804fb6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fba:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fc2:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804fc9:	48 89 c7             	mov    %rax,%rdi
+  804fcc:	48 b8 da 4f 80 00 00 	movabs $0x804fda,%rax
+  804fd3:	00 00 00 
+  804fd6:	ff d0                	call   *%rax
+}
+  804fd8:	c9                   	leave
+  804fd9:	c3                   	ret
+
+0000000000804fda <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804fda:	55                   	push   %rbp
+  804fdb:	48 89 e5             	mov    %rsp,%rbp
+  804fde:	48 83 ec 30          	sub    $0x30,%rsp
+  804fe2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804fe6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804fea:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804fee:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804ff2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ff7:	75 0e                	jne    805007 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804ff9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805000:	00 00 00 
+  805003:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805007:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80500c:	75 18                	jne    805026 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  80500e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805012:	48 89 c7             	mov    %rax,%rdi
+  805015:	48 b8 4c 06 80 00 00 	movabs $0x80064c,%rax
+  80501c:	00 00 00 
+  80501f:	ff d0                	call   *%rax
+  805021:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805024:	eb 1d                	jmp    805043 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805026:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80502a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80502e:	48 89 d6             	mov    %rdx,%rsi
+  805031:	48 89 c7             	mov    %rax,%rdi
+  805034:	48 b8 92 06 80 00 00 	movabs $0x800692,%rax
+  80503b:	00 00 00 
+  80503e:	ff d0                	call   *%rax
+  805040:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805043:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805047:	79 2a                	jns    805073 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805049:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80504e:	74 0a                	je     80505a <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805050:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805054:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  80505a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80505f:	74 0a                	je     80506b <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805061:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805065:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  80506b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80506e:	e9 aa 00 00 00       	jmp    80511d <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805073:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805078:	74 36                	je     8050b0 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  80507a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805081:	00 00 00 
+  805084:	8b 40 04             	mov    0x4(%rax),%eax
+  805087:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80508c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805093:	00 00 00 
+  805096:	48 98                	cltq
+  805098:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80509f:	48 01 d0             	add    %rdx,%rax
+  8050a2:	48 05 24 01 00 00    	add    $0x124,%rax
+  8050a8:	8b 10                	mov    (%rax),%edx
+  8050aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ae:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8050b0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8050b5:	74 36                	je     8050ed <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8050b7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8050be:	00 00 00 
+  8050c1:	8b 40 04             	mov    0x4(%rax),%eax
+  8050c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8050c9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050d0:	00 00 00 
+  8050d3:	48 98                	cltq
+  8050d5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8050dc:	48 01 d0             	add    %rdx,%rax
+  8050df:	48 05 28 01 00 00    	add    $0x128,%rax
+  8050e5:	8b 10                	mov    (%rax),%edx
+  8050e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050eb:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8050ed:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8050f4:	00 00 00 
+  8050f7:	8b 40 04             	mov    0x4(%rax),%eax
+  8050fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8050ff:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805106:	00 00 00 
+  805109:	48 98                	cltq
+  80510b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805112:	48 01 d0             	add    %rdx,%rax
+  805115:	48 05 20 01 00 00    	add    $0x120,%rax
+  80511b:	8b 00                	mov    (%rax),%eax
+  }
+}
+  80511d:	c9                   	leave
+  80511e:	c3                   	ret
+
+000000000080511f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80511f:	55                   	push   %rbp
+  805120:	48 89 e5             	mov    %rsp,%rbp
+  805123:	48 83 ec 30          	sub    $0x30,%rsp
+  805127:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80512a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80512d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805131:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805134:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805139:	75 5e                	jne    805199 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  80513b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805142:	00 00 00 
+  805145:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805149:	eb 4e                	jmp    805199 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  80514b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80514f:	79 3c                	jns    80518d <ipc_send+0x6e>
+  805151:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805155:	74 36                	je     80518d <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805157:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80515a:	89 c1                	mov    %eax,%ecx
+  80515c:	48 b8 88 59 80 00 00 	movabs $0x805988,%rax
+  805163:	00 00 00 
+  805166:	48 89 c2             	mov    %rax,%rdx
+  805169:	be 54 00 00 00       	mov    $0x54,%esi
+  80516e:	48 b8 ae 59 80 00 00 	movabs $0x8059ae,%rax
+  805175:	00 00 00 
+  805178:	48 89 c7             	mov    %rax,%rdi
+  80517b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805180:	49 b8 b5 32 80 00 00 	movabs $0x8032b5,%r8
+  805187:	00 00 00 
+  80518a:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  80518d:	48 b8 cf 03 80 00 00 	movabs $0x8003cf,%rax
+  805194:	00 00 00 
+  805197:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805199:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80519c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80519f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051a6:	89 c7                	mov    %eax,%edi
+  8051a8:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  8051af:	00 00 00 
+  8051b2:	ff d0                	call   *%rax
+  8051b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051bb:	75 8e                	jne    80514b <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8051bd:	48 b8 cf 03 80 00 00 	movabs $0x8003cf,%rax
+  8051c4:	00 00 00 
+  8051c7:	ff d0                	call   *%rax
+}
+  8051c9:	90                   	nop
+  8051ca:	c9                   	leave
+  8051cb:	c3                   	ret
+
+00000000008051cc <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8051cc:	55                   	push   %rbp
+  8051cd:	48 89 e5             	mov    %rsp,%rbp
+  8051d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8051d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8051d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8051de:	eb 4d                	jmp    80522d <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8051e0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8051e7:	00 00 00 
+  8051ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8051ed:	48 98                	cltq
+  8051ef:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8051f6:	48 01 d0             	add    %rdx,%rax
+  8051f9:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8051ff:	8b 00                	mov    (%rax),%eax
+  805201:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805204:	75 23                	jne    805229 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805206:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80520d:	00 00 00 
+  805210:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805213:	48 98                	cltq
+  805215:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80521c:	48 01 d0             	add    %rdx,%rax
+  80521f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805225:	8b 00                	mov    (%rax),%eax
+  805227:	eb 12                	jmp    80523b <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805229:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80522d:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805234:	7e aa                	jle    8051e0 <ipc_find_env+0x14>
+  return 0;
+  805236:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80523b:	c9                   	leave
+  80523c:	c3                   	ret
+
+000000000080523d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80523d:	55                   	push   %rbp
+  80523e:	48 89 e5             	mov    %rsp,%rbp
+  805241:	48 83 ec 18          	sub    $0x18,%rsp
+  805245:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805249:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80524d:	48 c1 e8 27          	shr    $0x27,%rax
+  805251:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805256:	48 89 c2             	mov    %rax,%rdx
+  805259:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805260:	01 00 00 
+  805263:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805267:	83 e0 01             	and    $0x1,%eax
+  80526a:	48 85 c0             	test   %rax,%rax
+  80526d:	74 63                	je     8052d2 <pageref+0x95>
+  80526f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805273:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805277:	48 89 c2             	mov    %rax,%rdx
+  80527a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805281:	01 00 00 
+  805284:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805288:	83 e0 01             	and    $0x1,%eax
+  80528b:	48 85 c0             	test   %rax,%rax
+  80528e:	74 42                	je     8052d2 <pageref+0x95>
+  805290:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805294:	48 c1 e8 15          	shr    $0x15,%rax
+  805298:	48 89 c2             	mov    %rax,%rdx
+  80529b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8052a2:	01 00 00 
+  8052a5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052a9:	83 e0 01             	and    $0x1,%eax
+  8052ac:	48 85 c0             	test   %rax,%rax
+  8052af:	74 21                	je     8052d2 <pageref+0x95>
+  8052b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052b9:	48 89 c2             	mov    %rax,%rdx
+  8052bc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8052c3:	01 00 00 
+  8052c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052ca:	83 e0 01             	and    $0x1,%eax
+  8052cd:	48 85 c0             	test   %rax,%rax
+  8052d0:	75 07                	jne    8052d9 <pageref+0x9c>
+    return 0;
+  8052d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d7:	eb 53                	jmp    80532c <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8052d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052dd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052e1:	48 89 c2             	mov    %rax,%rdx
+  8052e4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8052eb:	01 00 00 
+  8052ee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8052f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052fa:	83 e0 01             	and    $0x1,%eax
+  8052fd:	48 85 c0             	test   %rax,%rax
+  805300:	75 07                	jne    805309 <pageref+0xcc>
+    return 0;
+  805302:	b8 00 00 00 00       	mov    $0x0,%eax
+  805307:	eb 23                	jmp    80532c <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805309:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80530d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805311:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805318:	00 00 00 
+  80531b:	48 c1 e0 04          	shl    $0x4,%rax
+  80531f:	48 01 d0             	add    %rdx,%rax
+  805322:	48 83 c0 08          	add    $0x8,%rax
+  805326:	0f b7 00             	movzwl (%rax),%eax
+  805329:	0f b7 c0             	movzwl %ax,%eax
+}
+  80532c:	c9                   	leave
+  80532d:	c3                   	ret
+  80532e:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8312 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 08 03 00 00       	call   800334 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+envid_t dumbfork(void);
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  envid_t who;
+  int i;
+
+  // fork a child process
+  who = dumbfork();
+  800041:	48 b8 0a 02 80 00 00 	movabs $0x80020a,%rax
+  800048:	00 00 00 
+  80004b:	ff d0                	call   *%rax
+  80004d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  // print a message and yield to the other a few times
+  for (i = 0; i < (who ? 10 : 20); i++) {
+  800050:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800057:	eb 52                	jmp    8000ab <umain+0x79>
+    cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800059:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80005d:	74 0c                	je     80006b <umain+0x39>
+  80005f:	48 b8 a0 52 80 00 00 	movabs $0x8052a0,%rax
+  800066:	00 00 00 
+  800069:	eb 0a                	jmp    800075 <umain+0x43>
+  80006b:	48 b8 a7 52 80 00 00 	movabs $0x8052a7,%rax
+  800072:	00 00 00 
+  800075:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  800078:	48 89 c2             	mov    %rax,%rdx
+  80007b:	89 ce                	mov    %ecx,%esi
+  80007d:	48 b8 ad 52 80 00 00 	movabs $0x8052ad,%rax
+  800084:	00 00 00 
+  800087:	48 89 c7             	mov    %rax,%rdi
+  80008a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008f:	48 b9 fa 05 80 00 00 	movabs $0x8005fa,%rcx
+  800096:	00 00 00 
+  800099:	ff d1                	call   *%rcx
+    sys_yield();
+  80009b:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  8000a2:	00 00 00 
+  8000a5:	ff d0                	call   *%rax
+  for (i = 0; i < (who ? 10 : 20); i++) {
+  8000a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000ab:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000af:	74 07                	je     8000b8 <umain+0x86>
+  8000b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8000b6:	eb 05                	jmp    8000bd <umain+0x8b>
+  8000b8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8000bd:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+  8000c0:	7f 97                	jg     800059 <umain+0x27>
+  }
+}
+  8000c2:	90                   	nop
+  8000c3:	90                   	nop
+  8000c4:	c9                   	leave
+  8000c5:	c3                   	ret
+
+00000000008000c6 <duppage>:
+
+void
+duppage(envid_t dstenv, void *addr) {
+  8000c6:	55                   	push   %rbp
+  8000c7:	48 89 e5             	mov    %rsp,%rbp
+  8000ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8000ce:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  // This is NOT what you should do in your fork.
+  if ((r = sys_page_alloc(dstenv, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8000d5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8000d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000dc:	ba 07 00 00 00       	mov    $0x7,%edx
+  8000e1:	48 89 ce             	mov    %rcx,%rsi
+  8000e4:	89 c7                	mov    %eax,%edi
+  8000e6:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+  8000f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000f9:	79 36                	jns    800131 <duppage+0x6b>
+    panic("sys_page_alloc: %i", r);
+  8000fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000fe:	89 c1                	mov    %eax,%ecx
+  800100:	48 b8 bf 52 80 00 00 	movabs $0x8052bf,%rax
+  800107:	00 00 00 
+  80010a:	48 89 c2             	mov    %rax,%rdx
+  80010d:	be 1e 00 00 00       	mov    $0x1e,%esi
+  800112:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  800119:	00 00 00 
+  80011c:	48 89 c7             	mov    %rax,%rdi
+  80011f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800124:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  80012b:	00 00 00 
+  80012e:	41 ff d0             	call   *%r8
+  if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  800131:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800135:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800138:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80013e:	b9 00 00 40 00       	mov    $0x400000,%ecx
+  800143:	ba 00 00 00 00       	mov    $0x0,%edx
+  800148:	89 c7                	mov    %eax,%edi
+  80014a:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+  800156:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800159:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80015d:	79 36                	jns    800195 <duppage+0xcf>
+    panic("sys_page_map: %i", r);
+  80015f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800162:	89 c1                	mov    %eax,%ecx
+  800164:	48 b8 e2 52 80 00 00 	movabs $0x8052e2,%rax
+  80016b:	00 00 00 
+  80016e:	48 89 c2             	mov    %rax,%rdx
+  800171:	be 20 00 00 00       	mov    $0x20,%esi
+  800176:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  80017d:	00 00 00 
+  800180:	48 89 c7             	mov    %rax,%rdi
+  800183:	b8 00 00 00 00       	mov    $0x0,%eax
+  800188:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  80018f:	00 00 00 
+  800192:	41 ff d0             	call   *%r8
+  memmove(UTEMP, addr, PGSIZE);
+  800195:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800199:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80019e:	48 89 c6             	mov    %rax,%rsi
+  8001a1:	bf 00 00 40 00       	mov    $0x400000,%edi
+  8001a6:	48 b8 ed 1a 80 00 00 	movabs $0x801aed,%rax
+  8001ad:	00 00 00 
+  8001b0:	ff d0                	call   *%rax
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8001b2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8001b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bc:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+  8001c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8001cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001cf:	79 36                	jns    800207 <duppage+0x141>
+    panic("sys_page_unmap: %i", r);
+  8001d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001d4:	89 c1                	mov    %eax,%ecx
+  8001d6:	48 b8 f3 52 80 00 00 	movabs $0x8052f3,%rax
+  8001dd:	00 00 00 
+  8001e0:	48 89 c2             	mov    %rax,%rdx
+  8001e3:	be 23 00 00 00       	mov    $0x23,%esi
+  8001e8:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  8001ef:	00 00 00 
+  8001f2:	48 89 c7             	mov    %rax,%rdi
+  8001f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fa:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  800201:	00 00 00 
+  800204:	41 ff d0             	call   *%r8
+}
+  800207:	90                   	nop
+  800208:	c9                   	leave
+  800209:	c3                   	ret
+
+000000000080020a <dumbfork>:
+
+envid_t
+dumbfork(void) {
+  80020a:	55                   	push   %rbp
+  80020b:	48 89 e5             	mov    %rsp,%rbp
+  80020e:	48 83 ec 20          	sub    $0x20,%rsp
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  800212:	b8 09 00 00 00       	mov    $0x9,%eax
+  800217:	cd 30                	int    $0x30
+  800219:	89 45 e8             	mov    %eax,-0x18(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  80021c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  // Allocate a new child environment.
+  // The kernel will initialize it with a copy of our register state,
+  // so that the child will appear to have called sys_exofork() too -
+  // except that in the child, this "fake" call to sys_exofork()
+  // will return 0 instead of the envid of the child.
+  envid = sys_exofork();
+  80021f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (envid < 0)
+  800222:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800226:	79 36                	jns    80025e <dumbfork+0x54>
+    panic("sys_exofork: %i", envid);
+  800228:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80022b:	89 c1                	mov    %eax,%ecx
+  80022d:	48 b8 06 53 80 00 00 	movabs $0x805306,%rax
+  800234:	00 00 00 
+  800237:	48 89 c2             	mov    %rax,%rdx
+  80023a:	be 34 00 00 00       	mov    $0x34,%esi
+  80023f:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  800246:	00 00 00 
+  800249:	48 89 c7             	mov    %rax,%rdi
+  80024c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800251:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  800258:	00 00 00 
+  80025b:	41 ff d0             	call   *%r8
+  if (envid == 0) {
+  80025e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800262:	75 0a                	jne    80026e <dumbfork+0x64>
+    // We're the child.
+    // thisenv already refers to us: the kernel publishes the
+    // running env's id for it.
+    return 0;
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	e9 c4 00 00 00       	jmp    800332 <dumbfork+0x128>
+  }
+
+  // We're the parent.
+  // Eagerly copy our entire address space into the child.
+  // This is NOT what you should do in your fork implementation.
+  for (addr = (uint8_t *)UTEXT; addr < end; addr += PGSIZE)
+  80026e:	48 c7 45 e0 00 00 80 	movq   $0x800000,-0x20(%rbp)
+  800275:	00 
+  800276:	eb 26                	jmp    80029e <dumbfork+0x94>
+    duppage(envid, addr);
+  800278:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80027c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80027f:	48 89 d6             	mov    %rdx,%rsi
+  800282:	89 c7                	mov    %eax,%edi
+  800284:	48 b8 c6 00 80 00 00 	movabs $0x8000c6,%rax
+  80028b:	00 00 00 
+  80028e:	ff d0                	call   *%rax
+  for (addr = (uint8_t *)UTEXT; addr < end; addr += PGSIZE)
+  800290:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800294:	48 05 00 10 00 00    	add    $0x1000,%rax
+  80029a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80029e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8002a9:	00 00 00 
+  8002ac:	48 39 c2             	cmp    %rax,%rdx
+  8002af:	72 c7                	jb     800278 <dumbfork+0x6e>
+
+  // Also copy the stack we are currently running on.
+  duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  8002b1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8002b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8002b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002bd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8002c3:	48 89 c2             	mov    %rax,%rdx
+  8002c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002c9:	48 89 d6             	mov    %rdx,%rsi
+  8002cc:	89 c7                	mov    %eax,%edi
+  8002ce:	48 b8 c6 00 80 00 00 	movabs $0x8000c6,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+
+  // Start the child environment running
+  if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8002da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002dd:	be 02 00 00 00       	mov    $0x2,%esi
+  8002e2:	89 c7                	mov    %eax,%edi
+  8002e4:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+  8002f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8002f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8002f7:	79 36                	jns    80032f <dumbfork+0x125>
+    panic("sys_env_set_status: %i", r);
+  8002f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002fc:	89 c1                	mov    %eax,%ecx
+  8002fe:	48 b8 16 53 80 00 00 	movabs $0x805316,%rax
+  800305:	00 00 00 
+  800308:	48 89 c2             	mov    %rax,%rdx
+  80030b:	be 47 00 00 00       	mov    $0x47,%esi
+  800310:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  800317:	00 00 00 
+  80031a:	48 89 c7             	mov    %rax,%rdi
+  80031d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800322:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  800329:	00 00 00 
+  80032c:	41 ff d0             	call   *%r8
+
+  return envid;
+  80032f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+
+0000000000800334 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800334:	55                   	push   %rbp
+  800335:	48 89 e5             	mov    %rsp,%rbp
+  800338:	48 83 ec 20          	sub    $0x20,%rsp
+  80033c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80033f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800343:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80034a:	00 00 00 
+  80034d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800351:	eb 13                	jmp    800366 <libmain+0x32>
+    (*ctor)();
+  800353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800357:	48 8b 10             	mov    (%rax),%rdx
+  80035a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035f:	ff d2                	call   *%rdx
+    ctor++;
+  800361:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800366:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80036d:	00 00 00 
+  800370:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800374:	72 dd                	jb     800353 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800376:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80037a:	7e 14                	jle    800390 <libmain+0x5c>
+    binaryname = argv[0];
+  80037c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800380:	48 8b 00             	mov    (%rax),%rax
+  800383:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80038a:	00 00 00 
+  80038d:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800390:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800394:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800397:	48 89 d6             	mov    %rdx,%rsi
+  80039a:	89 c7                	mov    %eax,%edi
+  80039c:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003a3:	00 00 00 
+  8003a6:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8003a8:	48 b8 b7 03 80 00 00 	movabs $0x8003b7,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+#endif
+}
+  8003b4:	90                   	nop
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+00000000008003b7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8003bb:	48 b8 4f 2e 80 00 00 	movabs $0x802e4f,%rax
+  8003c2:	00 00 00 
+  8003c5:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8003c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003cc:	48 b8 30 22 80 00 00 	movabs $0x802230,%rax
+  8003d3:	00 00 00 
+  8003d6:	ff d0                	call   *%rax
+}
+  8003d8:	90                   	nop
+  8003d9:	5d                   	pop    %rbp
+  8003da:	c3                   	ret
+
+00000000008003db <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003db:	55                   	push   %rbp
+  8003dc:	48 89 e5             	mov    %rsp,%rbp
+  8003df:	53                   	push   %rbx
+  8003e0:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8003e7:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8003ee:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8003f4:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8003fb:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800402:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800409:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800410:	84 c0                	test   %al,%al
+  800412:	74 23                	je     800437 <_panic+0x5c>
+  800414:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80041b:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80041f:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800423:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800427:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80042b:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80042f:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800433:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800437:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80043e:	00 00 00 
+  800441:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800448:	00 00 00 
+  80044b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80044f:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800456:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80045d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800464:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80046b:	00 00 00 
+  80046e:	48 8b 18             	mov    (%rax),%rbx
+  800471:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  800478:	00 00 00 
+  80047b:	ff d0                	call   *%rax
+  80047d:	89 c6                	mov    %eax,%esi
+  80047f:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800485:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80048c:	41 89 d0             	mov    %edx,%r8d
+  80048f:	48 89 c1             	mov    %rax,%rcx
+  800492:	48 89 da             	mov    %rbx,%rdx
+  800495:	48 b8 38 53 80 00 00 	movabs $0x805338,%rax
+  80049c:	00 00 00 
+  80049f:	48 89 c7             	mov    %rax,%rdi
+  8004a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a7:	49 b9 fa 05 80 00 00 	movabs $0x8005fa,%r9
+  8004ae:	00 00 00 
+  8004b1:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004b4:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8004bb:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004c2:	48 89 d6             	mov    %rdx,%rsi
+  8004c5:	48 89 c7             	mov    %rax,%rdi
+  8004c8:	48 b8 6f 05 80 00 00 	movabs $0x80056f,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+  cprintf("\n");
+  8004d4:	48 b8 5b 53 80 00 00 	movabs $0x80535b,%rax
+  8004db:	00 00 00 
+  8004de:	48 89 c7             	mov    %rax,%rdi
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	48 ba fa 05 80 00 00 	movabs $0x8005fa,%rdx
+  8004ed:	00 00 00 
+  8004f0:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8004f2:	cc                   	int3
+  8004f3:	eb fd                	jmp    8004f2 <_panic+0x117>
+
+00000000008004f5 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8004f5:	55                   	push   %rbp
+  8004f6:	48 89 e5             	mov    %rsp,%rbp
+  8004f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8004fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800500:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800504:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800508:	8b 00                	mov    (%rax),%eax
+  80050a:	8d 48 01             	lea    0x1(%rax),%ecx
+  80050d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800511:	89 0a                	mov    %ecx,(%rdx)
+  800513:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800516:	89 d1                	mov    %edx,%ecx
+  800518:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80051c:	48 98                	cltq
+  80051e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800522:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800526:	8b 00                	mov    (%rax),%eax
+  800528:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80052d:	75 2c                	jne    80055b <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80052f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800533:	8b 00                	mov    (%rax),%eax
+  800535:	48 98                	cltq
+  800537:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80053b:	48 83 c2 08          	add    $0x8,%rdx
+  80053f:	48 89 c6             	mov    %rax,%rsi
+  800542:	48 89 d7             	mov    %rdx,%rdi
+  800545:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+    b->idx = 0;
+  800551:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800555:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80055b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80055f:	8b 40 04             	mov    0x4(%rax),%eax
+  800562:	8d 50 01             	lea    0x1(%rax),%edx
+  800565:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800569:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80056c:	90                   	nop
+  80056d:	c9                   	leave
+  80056e:	c3                   	ret
+
+000000000080056f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80056f:	55                   	push   %rbp
+  800570:	48 89 e5             	mov    %rsp,%rbp
+  800573:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80057a:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800581:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800588:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80058f:	00 00 00 
+  b.cnt = 0;
+  800592:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800599:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80059c:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8005a3:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8005aa:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8005b1:	48 89 c6             	mov    %rax,%rsi
+  8005b4:	48 b8 f5 04 80 00 00 	movabs $0x8004f5,%rax
+  8005bb:	00 00 00 
+  8005be:	48 89 c7             	mov    %rax,%rdi
+  8005c1:	48 b8 54 09 80 00 00 	movabs $0x800954,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8005cd:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8005d3:	48 98                	cltq
+  8005d5:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8005dc:	48 83 c2 08          	add    $0x8,%rdx
+  8005e0:	48 89 c6             	mov    %rax,%rsi
+  8005e3:	48 89 d7             	mov    %rdx,%rdi
+  8005e6:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  8005ed:	00 00 00 
+  8005f0:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8005f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+
+00000000008005fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800605:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80060c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800613:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80061a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800621:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800628:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80062f:	84 c0                	test   %al,%al
+  800631:	74 20                	je     800653 <cprintf+0x59>
+  800633:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800637:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80063b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80063f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800643:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800647:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80064b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80064f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800653:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80065a:	00 00 00 
+  80065d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800664:	00 00 00 
+  800667:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80066b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800672:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800679:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800680:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800687:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80068e:	48 89 d6             	mov    %rdx,%rsi
+  800691:	48 89 c7             	mov    %rax,%rdi
+  800694:	48 b8 6f 05 80 00 00 	movabs $0x80056f,%rax
+  80069b:	00 00 00 
+  80069e:	ff d0                	call   *%rax
+  8006a0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8006a6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006ac:	c9                   	leave
+  8006ad:	c3                   	ret
+
+00000000008006ae <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8006ae:	55                   	push   %rbp
+  8006af:	48 89 e5             	mov    %rsp,%rbp
+  8006b2:	48 83 ec 30          	sub    $0x30,%rsp
+  8006b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8006c2:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8006c5:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8006c9:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8006cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8006d0:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8006d4:	72 54                	jb     80072a <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006d6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8006d9:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006dc:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8006df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e8:	48 f7 f6             	div    %rsi
+  8006eb:	49 89 c2             	mov    %rax,%r10
+  8006ee:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8006f1:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8006f4:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8006f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fc:	41 89 c9             	mov    %ecx,%r9d
+  8006ff:	41 89 f8             	mov    %edi,%r8d
+  800702:	89 d1                	mov    %edx,%ecx
+  800704:	4c 89 d2             	mov    %r10,%rdx
+  800707:	48 89 c7             	mov    %rax,%rdi
+  80070a:	48 b8 ae 06 80 00 00 	movabs $0x8006ae,%rax
+  800711:	00 00 00 
+  800714:	ff d0                	call   *%rax
+  800716:	eb 1c                	jmp    800734 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800718:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80071c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80071f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800723:	48 89 d6             	mov    %rdx,%rsi
+  800726:	89 c7                	mov    %eax,%edi
+  800728:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80072a:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80072e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800732:	7f e4                	jg     800718 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800734:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800740:	48 f7 f1             	div    %rcx
+  800743:	48 b8 90 55 80 00 00 	movabs $0x805590,%rax
+  80074a:	00 00 00 
+  80074d:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800751:	0f be c0             	movsbl %al,%eax
+  800754:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800758:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80075c:	48 89 d6             	mov    %rdx,%rsi
+  80075f:	89 c7                	mov    %eax,%edi
+  800761:	ff d1                	call   *%rcx
+}
+  800763:	90                   	nop
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+
+0000000000800766 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	48 83 ec 10          	sub    $0x10,%rsp
+  80076e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800772:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800775:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800779:	7e 4b                	jle    8007c6 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80077b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80077f:	8b 00                	mov    (%rax),%eax
+  800781:	83 f8 2f             	cmp    $0x2f,%eax
+  800784:	77 24                	ja     8007aa <getuint+0x44>
+  800786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80078e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800792:	8b 00                	mov    (%rax),%eax
+  800794:	89 c0                	mov    %eax,%eax
+  800796:	48 01 d0             	add    %rdx,%rax
+  800799:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80079d:	8b 12                	mov    (%rdx),%edx
+  80079f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007a6:	89 0a                	mov    %ecx,(%rdx)
+  8007a8:	eb 14                	jmp    8007be <getuint+0x58>
+  8007aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007b2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ba:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007be:	48 8b 00             	mov    (%rax),%rax
+  8007c1:	e9 95 00 00 00       	jmp    80085b <getuint+0xf5>
+  else if (lflag)
+  8007c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007ca:	74 48                	je     800814 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8007cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d0:	8b 00                	mov    (%rax),%eax
+  8007d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d5:	77 24                	ja     8007fb <getuint+0x95>
+  8007d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e3:	8b 00                	mov    (%rax),%eax
+  8007e5:	89 c0                	mov    %eax,%eax
+  8007e7:	48 01 d0             	add    %rdx,%rax
+  8007ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ee:	8b 12                	mov    (%rdx),%edx
+  8007f0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007f7:	89 0a                	mov    %ecx,(%rdx)
+  8007f9:	eb 14                	jmp    80080f <getuint+0xa9>
+  8007fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800803:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800807:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80080b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80080f:	48 8b 00             	mov    (%rax),%rax
+  800812:	eb 47                	jmp    80085b <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800818:	8b 00                	mov    (%rax),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 24                	ja     800843 <getuint+0xdd>
+  80081f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800823:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082b:	8b 00                	mov    (%rax),%eax
+  80082d:	89 c0                	mov    %eax,%eax
+  80082f:	48 01 d0             	add    %rdx,%rax
+  800832:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800836:	8b 12                	mov    (%rdx),%edx
+  800838:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80083b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80083f:	89 0a                	mov    %ecx,(%rdx)
+  800841:	eb 14                	jmp    800857 <getuint+0xf1>
+  800843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800847:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80084b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80084f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800853:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800857:	8b 00                	mov    (%rax),%eax
+  800859:	89 c0                	mov    %eax,%eax
+}
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+
+000000000080085d <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80085d:	55                   	push   %rbp
+  80085e:	48 89 e5             	mov    %rsp,%rbp
+  800861:	48 83 ec 10          	sub    $0x10,%rsp
+  800865:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800869:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80086c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800870:	7e 4b                	jle    8008bd <getint+0x60>
+    return va_arg(*ap, long long);
+  800872:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800876:	8b 00                	mov    (%rax),%eax
+  800878:	83 f8 2f             	cmp    $0x2f,%eax
+  80087b:	77 24                	ja     8008a1 <getint+0x44>
+  80087d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800881:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800885:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800889:	8b 00                	mov    (%rax),%eax
+  80088b:	89 c0                	mov    %eax,%eax
+  80088d:	48 01 d0             	add    %rdx,%rax
+  800890:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800894:	8b 12                	mov    (%rdx),%edx
+  800896:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800899:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80089d:	89 0a                	mov    %ecx,(%rdx)
+  80089f:	eb 14                	jmp    8008b5 <getint+0x58>
+  8008a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008a9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008b5:	48 8b 00             	mov    (%rax),%rax
+  8008b8:	e9 95 00 00 00       	jmp    800952 <getint+0xf5>
+  else if (lflag)
+  8008bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008c1:	74 48                	je     80090b <getint+0xae>
+    return va_arg(*ap, long);
+  8008c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c7:	8b 00                	mov    (%rax),%eax
+  8008c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cc:	77 24                	ja     8008f2 <getint+0x95>
+  8008ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008da:	8b 00                	mov    (%rax),%eax
+  8008dc:	89 c0                	mov    %eax,%eax
+  8008de:	48 01 d0             	add    %rdx,%rax
+  8008e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e5:	8b 12                	mov    (%rdx),%edx
+  8008e7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ee:	89 0a                	mov    %ecx,(%rdx)
+  8008f0:	eb 14                	jmp    800906 <getint+0xa9>
+  8008f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008fa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800902:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800906:	48 8b 00             	mov    (%rax),%rax
+  800909:	eb 47                	jmp    800952 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80090b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80090f:	8b 00                	mov    (%rax),%eax
+  800911:	83 f8 2f             	cmp    $0x2f,%eax
+  800914:	77 24                	ja     80093a <getint+0xdd>
+  800916:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80091a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80091e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800922:	8b 00                	mov    (%rax),%eax
+  800924:	89 c0                	mov    %eax,%eax
+  800926:	48 01 d0             	add    %rdx,%rax
+  800929:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092d:	8b 12                	mov    (%rdx),%edx
+  80092f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800932:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800936:	89 0a                	mov    %ecx,(%rdx)
+  800938:	eb 14                	jmp    80094e <getint+0xf1>
+  80093a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80093e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800942:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800946:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80094a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80094e:	8b 00                	mov    (%rax),%eax
+  800950:	48 98                	cltq
+}
+  800952:	c9                   	leave
+  800953:	c3                   	ret
+
+0000000000800954 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800954:	55                   	push   %rbp
+  800955:	48 89 e5             	mov    %rsp,%rbp
+  800958:	41 54                	push   %r12
+  80095a:	53                   	push   %rbx
+  80095b:	48 83 ec 60          	sub    $0x60,%rsp
+  80095f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800963:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800967:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80096b:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80096f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800973:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800977:	48 8b 06             	mov    (%rsi),%rax
+  80097a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80097e:	48 89 01             	mov    %rax,(%rcx)
+  800981:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800985:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800989:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80098d:	eb 17                	jmp    8009a6 <vprintfmt+0x52>
+      if (ch == '\0')
+  80098f:	85 db                	test   %ebx,%ebx
+  800991:	0f 84 bf 04 00 00    	je     800e56 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800997:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80099b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80099f:	48 89 c6             	mov    %rax,%rsi
+  8009a2:	89 df                	mov    %ebx,%edi
+  8009a4:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8009a6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009ae:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009b2:	0f b6 00             	movzbl (%rax),%eax
+  8009b5:	0f b6 d8             	movzbl %al,%ebx
+  8009b8:	83 fb 25             	cmp    $0x25,%ebx
+  8009bb:	75 d2                	jne    80098f <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8009bd:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8009c1:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8009c8:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8009cf:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8009d6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8009dd:	eb 04                	jmp    8009e3 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8009df:	90                   	nop
+  8009e0:	eb 01                	jmp    8009e3 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8009e2:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8009e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009e7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009eb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009ef:	0f b6 00             	movzbl (%rax),%eax
+  8009f2:	0f b6 d8             	movzbl %al,%ebx
+  8009f5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8009f8:	83 f8 55             	cmp    $0x55,%eax
+  8009fb:	0f 87 22 04 00 00    	ja     800e23 <vprintfmt+0x4cf>
+  800a01:	89 c0                	mov    %eax,%eax
+  800a03:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a0a:	00 
+  800a0b:	48 b8 b8 55 80 00 00 	movabs $0x8055b8,%rax
+  800a12:	00 00 00 
+  800a15:	48 01 d0             	add    %rdx,%rax
+  800a18:	48 8b 00             	mov    (%rax),%rax
+  800a1b:	ff e0                	jmp    *%rax
+        padc = '-';
+  800a1d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a21:	eb c0                	jmp    8009e3 <vprintfmt+0x8f>
+        padc = '0';
+  800a23:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a27:	eb ba                	jmp    8009e3 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a29:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a30:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a33:	89 d0                	mov    %edx,%eax
+  800a35:	c1 e0 02             	shl    $0x2,%eax
+  800a38:	01 d0                	add    %edx,%eax
+  800a3a:	01 c0                	add    %eax,%eax
+  800a3c:	01 d8                	add    %ebx,%eax
+  800a3e:	83 e8 30             	sub    $0x30,%eax
+  800a41:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800a44:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a48:	0f b6 00             	movzbl (%rax),%eax
+  800a4b:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800a4e:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a51:	7e 60                	jle    800ab3 <vprintfmt+0x15f>
+  800a53:	83 fb 39             	cmp    $0x39,%ebx
+  800a56:	7f 5b                	jg     800ab3 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800a58:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a5d:	eb d1                	jmp    800a30 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 17                	ja     800a7e <vprintfmt+0x12a>
+  800a67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a6b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a6e:	89 d2                	mov    %edx,%edx
+  800a70:	48 01 d0             	add    %rdx,%rax
+  800a73:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a76:	83 c2 08             	add    $0x8,%edx
+  800a79:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a7c:	eb 0c                	jmp    800a8a <vprintfmt+0x136>
+  800a7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a82:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a86:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a8a:	8b 00                	mov    (%rax),%eax
+  800a8c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800a8f:	eb 23                	jmp    800ab4 <vprintfmt+0x160>
+        if (width < 0)
+  800a91:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a95:	0f 89 44 ff ff ff    	jns    8009df <vprintfmt+0x8b>
+          width = 0;
+  800a9b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800aa2:	e9 38 ff ff ff       	jmp    8009df <vprintfmt+0x8b>
+        altflag = 1;
+  800aa7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800aae:	e9 30 ff ff ff       	jmp    8009e3 <vprintfmt+0x8f>
+        goto process_precision;
+  800ab3:	90                   	nop
+        if (width < 0)
+  800ab4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ab8:	0f 89 24 ff ff ff    	jns    8009e2 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800abe:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ac1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ac4:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800acb:	e9 12 ff ff ff       	jmp    8009e2 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800ad0:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800ad4:	e9 0a ff ff ff       	jmp    8009e3 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800ad9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adc:	83 f8 2f             	cmp    $0x2f,%eax
+  800adf:	77 17                	ja     800af8 <vprintfmt+0x1a4>
+  800ae1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ae5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae8:	89 d2                	mov    %edx,%edx
+  800aea:	48 01 d0             	add    %rdx,%rax
+  800aed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800af0:	83 c2 08             	add    $0x8,%edx
+  800af3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800af6:	eb 0c                	jmp    800b04 <vprintfmt+0x1b0>
+  800af8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800afc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b00:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b04:	8b 00                	mov    (%rax),%eax
+  800b06:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b0a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b0e:	48 89 d6             	mov    %rdx,%rsi
+  800b11:	89 c7                	mov    %eax,%edi
+  800b13:	ff d1                	call   *%rcx
+        break;
+  800b15:	e9 37 03 00 00       	jmp    800e51 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800b1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b20:	77 17                	ja     800b39 <vprintfmt+0x1e5>
+  800b22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b26:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b29:	89 d2                	mov    %edx,%edx
+  800b2b:	48 01 d0             	add    %rdx,%rax
+  800b2e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b31:	83 c2 08             	add    $0x8,%edx
+  800b34:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b37:	eb 0c                	jmp    800b45 <vprintfmt+0x1f1>
+  800b39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b41:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b45:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800b47:	85 db                	test   %ebx,%ebx
+  800b49:	79 02                	jns    800b4d <vprintfmt+0x1f9>
+          err = -err;
+  800b4b:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b4d:	83 fb 15             	cmp    $0x15,%ebx
+  800b50:	7f 16                	jg     800b68 <vprintfmt+0x214>
+  800b52:	48 ba e0 54 80 00 00 	movabs $0x8054e0,%rdx
+  800b59:	00 00 00 
+  800b5c:	48 63 c3             	movslq %ebx,%rax
+  800b5f:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b63:	4d 85 e4             	test   %r12,%r12
+  800b66:	75 2e                	jne    800b96 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b68:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b6c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b70:	89 d9                	mov    %ebx,%ecx
+  800b72:	48 ba a1 55 80 00 00 	movabs $0x8055a1,%rdx
+  800b79:	00 00 00 
+  800b7c:	48 89 c7             	mov    %rax,%rdi
+  800b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b84:	49 b8 60 0e 80 00 00 	movabs $0x800e60,%r8
+  800b8b:	00 00 00 
+  800b8e:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800b91:	e9 bb 02 00 00       	jmp    800e51 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800b96:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b9e:	4c 89 e1             	mov    %r12,%rcx
+  800ba1:	48 ba aa 55 80 00 00 	movabs $0x8055aa,%rdx
+  800ba8:	00 00 00 
+  800bab:	48 89 c7             	mov    %rax,%rdi
+  800bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb3:	49 b8 60 0e 80 00 00 	movabs $0x800e60,%r8
+  800bba:	00 00 00 
+  800bbd:	41 ff d0             	call   *%r8
+        break;
+  800bc0:	e9 8c 02 00 00       	jmp    800e51 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800bc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bcb:	77 17                	ja     800be4 <vprintfmt+0x290>
+  800bcd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bd1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bd4:	89 d2                	mov    %edx,%edx
+  800bd6:	48 01 d0             	add    %rdx,%rax
+  800bd9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bdc:	83 c2 08             	add    $0x8,%edx
+  800bdf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800be2:	eb 0c                	jmp    800bf0 <vprintfmt+0x29c>
+  800be4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800be8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bf0:	4c 8b 20             	mov    (%rax),%r12
+  800bf3:	4d 85 e4             	test   %r12,%r12
+  800bf6:	75 0a                	jne    800c02 <vprintfmt+0x2ae>
+          p = "(null)";
+  800bf8:	49 bc ad 55 80 00 00 	movabs $0x8055ad,%r12
+  800bff:	00 00 00 
+        if (width > 0 && padc != '-')
+  800c02:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c06:	7e 78                	jle    800c80 <vprintfmt+0x32c>
+  800c08:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800c0c:	74 72                	je     800c80 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c0e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800c11:	48 98                	cltq
+  800c13:	48 89 c6             	mov    %rax,%rsi
+  800c16:	4c 89 e7             	mov    %r12,%rdi
+  800c19:	48 b8 6c 15 80 00 00 	movabs $0x80156c,%rax
+  800c20:	00 00 00 
+  800c23:	ff d0                	call   *%rax
+  800c25:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c28:	eb 17                	jmp    800c41 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c2a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c2e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c32:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c36:	48 89 d6             	mov    %rdx,%rsi
+  800c39:	89 c7                	mov    %eax,%edi
+  800c3b:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c3d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c41:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c45:	7f e3                	jg     800c2a <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c47:	eb 37                	jmp    800c80 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800c49:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c4d:	74 1e                	je     800c6d <vprintfmt+0x319>
+  800c4f:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c52:	7e 05                	jle    800c59 <vprintfmt+0x305>
+  800c54:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c57:	7e 14                	jle    800c6d <vprintfmt+0x319>
+            putch('?', putdat);
+  800c59:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c5d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c61:	48 89 c6             	mov    %rax,%rsi
+  800c64:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c69:	ff d2                	call   *%rdx
+  800c6b:	eb 0f                	jmp    800c7c <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800c6d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c71:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c75:	48 89 c6             	mov    %rax,%rsi
+  800c78:	89 df                	mov    %ebx,%edi
+  800c7a:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c7c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c80:	4c 89 e0             	mov    %r12,%rax
+  800c83:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c87:	0f b6 00             	movzbl (%rax),%eax
+  800c8a:	0f be d8             	movsbl %al,%ebx
+  800c8d:	85 db                	test   %ebx,%ebx
+  800c8f:	74 28                	je     800cb9 <vprintfmt+0x365>
+  800c91:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c95:	78 b2                	js     800c49 <vprintfmt+0x2f5>
+  800c97:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800c9b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c9f:	79 a8                	jns    800c49 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800ca1:	eb 16                	jmp    800cb9 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800ca3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ca7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cab:	48 89 c6             	mov    %rax,%rsi
+  800cae:	bf 20 00 00 00       	mov    $0x20,%edi
+  800cb3:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800cb5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cb9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cbd:	7f e4                	jg     800ca3 <vprintfmt+0x34f>
+        break;
+  800cbf:	e9 8d 01 00 00       	jmp    800e51 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800cc4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cc7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ccb:	89 d6                	mov    %edx,%esi
+  800ccd:	48 89 c7             	mov    %rax,%rdi
+  800cd0:	48 b8 5d 08 80 00 00 	movabs $0x80085d,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+  800cdc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800ce0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce4:	48 85 c0             	test   %rax,%rax
+  800ce7:	79 1d                	jns    800d06 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800ce9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ced:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cf1:	48 89 c6             	mov    %rax,%rsi
+  800cf4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cf9:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800cfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cff:	48 f7 d8             	neg    %rax
+  800d02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800d06:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d0d:	e9 d2 00 00 00       	jmp    800de4 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800d12:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d15:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d19:	89 d6                	mov    %edx,%esi
+  800d1b:	48 89 c7             	mov    %rax,%rdi
+  800d1e:	48 b8 66 07 80 00 00 	movabs $0x800766,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d2e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d35:	e9 aa 00 00 00       	jmp    800de4 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800d3a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d3d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d41:	89 d6                	mov    %edx,%esi
+  800d43:	48 89 c7             	mov    %rax,%rdi
+  800d46:	48 b8 66 07 80 00 00 	movabs $0x800766,%rax
+  800d4d:	00 00 00 
+  800d50:	ff d0                	call   *%rax
+  800d52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800d56:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d5d:	e9 82 00 00 00       	jmp    800de4 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d62:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d66:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d6a:	48 89 c6             	mov    %rax,%rsi
+  800d6d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d72:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800d74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d78:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d7c:	48 89 c6             	mov    %rax,%rsi
+  800d7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d84:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 17                	ja     800da5 <vprintfmt+0x451>
+  800d8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d92:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d95:	89 d2                	mov    %edx,%edx
+  800d97:	48 01 d0             	add    %rdx,%rax
+  800d9a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d9d:	83 c2 08             	add    $0x8,%edx
+  800da0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800da3:	eb 0c                	jmp    800db1 <vprintfmt+0x45d>
+  800da5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800da9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dad:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800db1:	48 8b 00             	mov    (%rax),%rax
+  800db4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800db8:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800dbf:	eb 23                	jmp    800de4 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800dc1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dc4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dc8:	89 d6                	mov    %edx,%esi
+  800dca:	48 89 c7             	mov    %rax,%rdi
+  800dcd:	48 b8 66 07 80 00 00 	movabs $0x800766,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+  800dd9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ddd:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800de4:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800de9:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800dec:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800def:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800df3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800df7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dfb:	45 89 c1             	mov    %r8d,%r9d
+  800dfe:	41 89 f8             	mov    %edi,%r8d
+  800e01:	48 89 c7             	mov    %rax,%rdi
+  800e04:	48 b8 ae 06 80 00 00 	movabs $0x8006ae,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+        break;
+  800e10:	eb 3f                	jmp    800e51 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800e12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e16:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e1a:	48 89 c6             	mov    %rax,%rsi
+  800e1d:	89 df                	mov    %ebx,%edi
+  800e1f:	ff d2                	call   *%rdx
+        break;
+  800e21:	eb 2e                	jmp    800e51 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e23:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e27:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e2b:	48 89 c6             	mov    %rax,%rsi
+  800e2e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e33:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800e35:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e3a:	eb 05                	jmp    800e41 <vprintfmt+0x4ed>
+  800e3c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e41:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e45:	48 83 e8 01          	sub    $0x1,%rax
+  800e49:	0f b6 00             	movzbl (%rax),%eax
+  800e4c:	3c 25                	cmp    $0x25,%al
+  800e4e:	75 ec                	jne    800e3c <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800e50:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800e51:	e9 50 fb ff ff       	jmp    8009a6 <vprintfmt+0x52>
+        return;
+  800e56:	90                   	nop
+    }
+  }
+}
+  800e57:	48 83 c4 60          	add    $0x60,%rsp
+  800e5b:	5b                   	pop    %rbx
+  800e5c:	41 5c                	pop    %r12
+  800e5e:	5d                   	pop    %rbp
+  800e5f:	c3                   	ret
+
+0000000000800e60 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e60:	55                   	push   %rbp
+  800e61:	48 89 e5             	mov    %rsp,%rbp
+  800e64:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e6b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e72:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e79:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e80:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e87:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e8e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e95:	84 c0                	test   %al,%al
+  800e97:	74 20                	je     800eb9 <printfmt+0x59>
+  800e99:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e9d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ea1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ea5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ea9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ead:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800eb1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800eb5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800eb9:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ec0:	00 00 00 
+  800ec3:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800eca:	00 00 00 
+  800ecd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ed1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ed8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800edf:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800ee6:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800eed:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ef4:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800efb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f02:	48 89 c7             	mov    %rax,%rdi
+  800f05:	48 b8 54 09 80 00 00 	movabs $0x800954,%rax
+  800f0c:	00 00 00 
+  800f0f:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800f11:	90                   	nop
+  800f12:	c9                   	leave
+  800f13:	c3                   	ret
+
+0000000000800f14 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800f14:	55                   	push   %rbp
+  800f15:	48 89 e5             	mov    %rsp,%rbp
+  800f18:	48 83 ec 10          	sub    $0x10,%rsp
+  800f1c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f1f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f27:	8b 40 10             	mov    0x10(%rax),%eax
+  800f2a:	8d 50 01             	lea    0x1(%rax),%edx
+  800f2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f31:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800f34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f38:	48 8b 10             	mov    (%rax),%rdx
+  800f3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f43:	48 39 c2             	cmp    %rax,%rdx
+  800f46:	73 17                	jae    800f5f <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800f48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f4c:	48 8b 00             	mov    (%rax),%rax
+  800f4f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f53:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f57:	48 89 0a             	mov    %rcx,(%rdx)
+  800f5a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f5d:	88 10                	mov    %dl,(%rax)
+}
+  800f5f:	90                   	nop
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+0000000000800f62 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f62:	55                   	push   %rbp
+  800f63:	48 89 e5             	mov    %rsp,%rbp
+  800f66:	48 83 ec 40          	sub    $0x40,%rsp
+  800f6a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800f6e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800f71:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f75:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f7d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f81:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f84:	48 98                	cltq
+  800f86:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f8e:	48 01 d0             	add    %rdx,%rax
+  800f91:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f95:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800f9c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800fa1:	74 06                	je     800fa9 <vsnprintf+0x47>
+  800fa3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800fa7:	7f 07                	jg     800fb0 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800fa9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fae:	eb 32                	jmp    800fe2 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800fb0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800fb4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800fb8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800fbc:	48 89 c6             	mov    %rax,%rsi
+  800fbf:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  800fc6:	00 00 00 
+  800fc9:	48 89 c7             	mov    %rax,%rdi
+  800fcc:	48 b8 54 09 80 00 00 	movabs $0x800954,%rax
+  800fd3:	00 00 00 
+  800fd6:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800fd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fdc:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800fdf:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800fe2:	c9                   	leave
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800fe4:	55                   	push   %rbp
+  800fe5:	48 89 e5             	mov    %rsp,%rbp
+  800fe8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800fef:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ff6:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800ffc:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801003:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80100a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801011:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801018:	84 c0                	test   %al,%al
+  80101a:	74 20                	je     80103c <snprintf+0x58>
+  80101c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801020:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801024:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801028:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80102c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801030:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801034:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801038:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80103c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801043:	00 00 00 
+  801046:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80104d:	00 00 00 
+  801050:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801054:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80105b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801062:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801069:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801070:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801077:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80107d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801084:	48 89 c7             	mov    %rax,%rdi
+  801087:	48 b8 62 0f 80 00 00 	movabs $0x800f62,%rax
+  80108e:	00 00 00 
+  801091:	ff d0                	call   *%rax
+  801093:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801099:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80109f:	c9                   	leave
+  8010a0:	c3                   	ret
+
+00000000008010a1 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8010a1:	55                   	push   %rbp
+  8010a2:	48 89 e5             	mov    %rsp,%rbp
+  8010a5:	53                   	push   %rbx
+  8010a6:	48 83 ec 38          	sub    $0x38,%rsp
+  8010aa:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8010ad:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010b1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8010b5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8010b9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8010bd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8010c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c5:	89 d1                	mov    %edx,%ecx
+  8010c7:	0f a2                	cpuid
+  8010c9:	89 de                	mov    %ebx,%esi
+  8010cb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8010ce:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8010d1:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8010d4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8010d7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010dc:	74 09                	je     8010e7 <cpuid+0x46>
+}
+  8010de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010e2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010e5:	89 10                	mov    %edx,(%rax)
+
+  8010e7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010ec:	74 09                	je     8010f7 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8010ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010f2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8010f5:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8010f7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010fc:	74 09                	je     801107 <cpuid+0x66>
+char *
+  8010fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801102:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801105:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801107:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80110c:	74 09                	je     801117 <cpuid+0x76>
+  for (; *s; s++)
+  80110e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801112:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801115:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801117:	90                   	nop
+  801118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	48 83 ec 18          	sub    $0x18,%rsp
+  801126:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80112c:	89 c1                	mov    %eax,%ecx
+  80112e:	0f 01 d0             	xgetbv
+  801131:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801134:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801137:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80113a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80113d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801141:	48 09 d0             	or     %rdx,%rax
+#else
+  801144:	c9                   	leave
+  801145:	c3                   	ret
+
+0000000000801146 <string_cpu>:
+string_cpu(void) {
+  801146:	55                   	push   %rbp
+  801147:	48 89 e5             	mov    %rsp,%rbp
+  80114a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80114e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801155:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80115c:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801163:	00 00 00 
+  801166:	8b 00                	mov    (%rax),%eax
+  801168:	85 c0                	test   %eax,%eax
+  80116a:	78 11                	js     80117d <string_cpu+0x37>
+    return string_features;
+  80116c:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801173:	00 00 00 
+  801176:	8b 00                	mov    (%rax),%eax
+  801178:	e9 df 00 00 00       	jmp    80125c <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80117d:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801181:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801187:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80118c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801191:	48 89 c6             	mov    %rax,%rsi
+  801194:	bf 00 00 00 00       	mov    $0x0,%edi
+  801199:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  8011a0:	00 00 00 
+  8011a3:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8011a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011a8:	83 f8 06             	cmp    $0x6,%eax
+  8011ab:	76 28                	jbe    8011d5 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8011ad:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8011b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011bc:	48 89 c2             	mov    %rax,%rdx
+  8011bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c4:	bf 07 00 00 00       	mov    $0x7,%edi
+  8011c9:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  8011d0:	00 00 00 
+  8011d3:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8011d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011d8:	25 00 02 00 00       	and    $0x200,%eax
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	74 04                	je     8011e5 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8011e1:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8011e5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8011e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ef:	48 89 c1             	mov    %rax,%rcx
+  8011f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  801201:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  801208:	00 00 00 
+  80120b:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80120d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801210:	83 e0 20             	and    $0x20,%eax
+  801213:	85 c0                	test   %eax,%eax
+  801215:	74 2a                	je     801241 <string_cpu+0xfb>
+  801217:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80121a:	25 00 00 00 08       	and    $0x8000000,%eax
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	74 1e                	je     801241 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801223:	bf 00 00 00 00       	mov    $0x0,%edi
+  801228:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  801234:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801237:	48 83 f8 06          	cmp    $0x6,%rax
+  80123b:	75 04                	jne    801241 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80123d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801241:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  801248:	00 00 00 
+  80124b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80124e:	89 02                	mov    %eax,(%rdx)
+  801250:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801257:	00 00 00 
+  80125a:	8b 00                	mov    (%rax),%eax
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+000000000080125e <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80125e:	55                   	push   %rbp
+  80125f:	48 89 e5             	mov    %rsp,%rbp
+  801262:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801266:	48 83 ec 60          	sub    $0x60,%rsp
+  80126a:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80126f:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801274:	83 e0 1f             	and    $0x1f,%eax
+  801277:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80127b:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80127f:	48 f7 d8             	neg    %rax
+  801282:	48 89 c2             	mov    %rax,%rdx
+  801285:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80128a:	48 01 d0             	add    %rdx,%rax
+  80128d:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801292:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801296:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80129c:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012a1:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012a5:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012ab:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012af:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012b3:	89 c2                	mov    %eax,%edx
+  8012b5:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012b9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8012be:	89 c1                	mov    %eax,%ecx
+  8012c0:	d3 e6                	shl    %cl,%esi
+  8012c2:	89 f0                	mov    %esi,%eax
+  8012c4:	21 d0                	and    %edx,%eax
+  8012c6:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012ca:	eb 21                	jmp    8012ed <strlen_avx2+0x8f>
+    p += 32;
+  8012cc:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8012d2:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012d7:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012db:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012e1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012e5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012e9:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012ed:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8012f2:	74 d8                	je     8012cc <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8012f4:	31 c0                	xor    %eax,%eax
+  8012f6:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8012fc:	48 63 d0             	movslq %eax,%rdx
+  8012ff:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801304:	48 01 d0             	add    %rdx,%rax
+  801307:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80130c:	c9                   	leave
+  80130d:	c3                   	ret
+
+000000000080130e <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+  801312:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801316:	48 83 ec 40          	sub    $0x40,%rsp
+  80131a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80131f:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801324:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801329:	eb 77                	jmp    8013a2 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80132b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801330:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801334:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801338:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80133d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801341:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801345:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801349:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80134d:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801352:	74 3c                	je     801390 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801354:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801358:	f7 d0                	not    %eax
+  80135a:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80135e:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801362:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801366:	48 63 d0             	movslq %eax,%rdx
+  801369:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80136e:	48 01 d0             	add    %rdx,%rax
+  801371:	0f b6 00             	movzbl (%rax),%eax
+  801374:	0f b6 c0             	movzbl %al,%eax
+  801377:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80137b:	48 63 ca             	movslq %edx,%rcx
+  80137e:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801383:	48 01 ca             	add    %rcx,%rdx
+  801386:	0f b6 12             	movzbl (%rdx),%edx
+  801389:	0f b6 d2             	movzbl %dl,%edx
+  80138c:	29 d0                	sub    %edx,%eax
+  80138e:	eb 6b                	jmp    8013fb <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801390:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801396:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80139c:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8013a2:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8013a8:	77 81                	ja     80132b <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8013aa:	eb 42                	jmp    8013ee <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8013ac:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013b1:	0f b6 10             	movzbl (%rax),%edx
+  8013b4:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013b9:	0f b6 00             	movzbl (%rax),%eax
+  8013bc:	38 c2                	cmp    %al,%dl
+  8013be:	74 1c                	je     8013dc <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8013c0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013c5:	0f b6 00             	movzbl (%rax),%eax
+  8013c8:	0f b6 c8             	movzbl %al,%ecx
+  8013cb:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013d0:	0f b6 00             	movzbl (%rax),%eax
+  8013d3:	0f b6 d0             	movzbl %al,%edx
+  8013d6:	89 c8                	mov    %ecx,%eax
+  8013d8:	29 d0                	sub    %edx,%eax
+  8013da:	eb 1f                	jmp    8013fb <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8013dc:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8013e2:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8013e8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8013ee:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8013f4:	75 b6                	jne    8013ac <memcmp_avx2+0x9e>
+  return 0;
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+
+00000000008013fd <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801405:	48 83 ec 60          	sub    $0x60,%rsp
+  801409:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80140e:	89 f0                	mov    %esi,%eax
+  801410:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801415:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801419:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80141e:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801422:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801427:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80142d:	eb 47                	jmp    801476 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80142f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801434:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801438:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80143c:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801442:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801446:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80144a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80144e:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801453:	74 15                	je     80146a <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801455:	31 c0                	xor    %eax,%eax
+  801457:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80145d:	48 63 d0             	movslq %eax,%rdx
+  801460:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801465:	48 01 d0             	add    %rdx,%rax
+  801468:	eb 3d                	jmp    8014a7 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80146a:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801470:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801476:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80147c:	77 b1                	ja     80142f <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80147e:	eb 0c                	jmp    80148c <memfind_avx2+0x8f>
+  801480:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801486:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80148c:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801492:	74 0e                	je     8014a2 <memfind_avx2+0xa5>
+  801494:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801499:	0f b6 00             	movzbl (%rax),%eax
+  80149c:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8014a0:	75 de                	jne    801480 <memfind_avx2+0x83>
+  return s;
+  8014a2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8014a7:	c9                   	leave
+  8014a8:	c3                   	ret
+
+00000000008014a9 <strlen>:
+strlen(const char *s) {
+  8014a9:	55                   	push   %rbp
+  8014aa:	48 89 e5             	mov    %rsp,%rbp
+  8014ad:	48 83 ec 40          	sub    $0x40,%rsp
+  8014b1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8014b5:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8014b9:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8014bd:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  8014c4:	00 00 00 
+  8014c7:	ff d0                	call   *%rax
+  8014c9:	83 e0 02             	and    $0x2,%eax
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	74 18                	je     8014e8 <strlen+0x3f>
+    return strlen_avx2(s);
+  8014d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014d4:	48 89 c7             	mov    %rax,%rdi
+  8014d7:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  8014de:	00 00 00 
+  8014e1:	ff d0                	call   *%rax
+  8014e3:	e9 82 00 00 00       	jmp    80156a <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8014e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ec:	83 e0 0f             	and    $0xf,%eax
+  8014ef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8014f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014f5:	48 f7 d8             	neg    %rax
+  8014f8:	48 89 c2             	mov    %rax,%rdx
+  8014fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ff:	48 01 d0             	add    %rdx,%rax
+  801502:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801506:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80150a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80150e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801513:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801517:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80151b:	89 c2                	mov    %eax,%edx
+  80151d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801525:	89 c1                	mov    %eax,%ecx
+  801527:	d3 e6                	shl    %cl,%esi
+  801529:	89 f0                	mov    %esi,%eax
+  80152b:	21 d0                	and    %edx,%eax
+  80152d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801530:	eb 1d                	jmp    80154f <strlen+0xa6>
+    p += 16;
+  801532:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80153f:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801544:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801548:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80154c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80154f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801553:	74 dd                	je     801532 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801555:	31 c0                	xor    %eax,%eax
+  801557:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80155c:	48 63 d0             	movslq %eax,%rdx
+  80155f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801563:	48 01 d0             	add    %rdx,%rax
+  801566:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80156a:	c9                   	leave
+  80156b:	c3                   	ret
+
+000000000080156c <strnlen>:
+strnlen(const char *s, size_t size) {
+  80156c:	55                   	push   %rbp
+  80156d:	48 89 e5             	mov    %rsp,%rbp
+  801570:	48 83 ec 20          	sub    $0x20,%rsp
+  801574:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801578:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80157c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801583:	eb 0e                	jmp    801593 <strnlen+0x27>
+    n++;
+  801585:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801589:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80158e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801593:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801598:	74 0b                	je     8015a5 <strnlen+0x39>
+  80159a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159e:	0f b6 00             	movzbl (%rax),%eax
+  8015a1:	84 c0                	test   %al,%al
+  8015a3:	75 e0                	jne    801585 <strnlen+0x19>
+  return n;
+  8015a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015a8:	c9                   	leave
+  8015a9:	c3                   	ret
+
+00000000008015aa <strcpy>:
+strcpy(char *dst, const char *src) {
+  8015aa:	55                   	push   %rbp
+  8015ab:	48 89 e5             	mov    %rsp,%rbp
+  8015ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8015b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8015ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8015c2:	90                   	nop
+  8015c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015db:	0f b6 12             	movzbl (%rdx),%edx
+  8015de:	88 10                	mov    %dl,(%rax)
+  8015e0:	0f b6 00             	movzbl (%rax),%eax
+  8015e3:	84 c0                	test   %al,%al
+  8015e5:	75 dc                	jne    8015c3 <strcpy+0x19>
+  return ret;
+  8015e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015eb:	c9                   	leave
+  8015ec:	c3                   	ret
+
+00000000008015ed <strcat>:
+strcat(char *dst, const char *src) {
+  8015ed:	55                   	push   %rbp
+  8015ee:	48 89 e5             	mov    %rsp,%rbp
+  8015f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8015f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8015fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801601:	48 89 c7             	mov    %rax,%rdi
+  801604:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  80160b:	00 00 00 
+  80160e:	ff d0                	call   *%rax
+  801610:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801613:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801616:	48 63 d0             	movslq %eax,%rdx
+  801619:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80161d:	48 01 c2             	add    %rax,%rdx
+  801620:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801624:	48 89 c6             	mov    %rax,%rsi
+  801627:	48 89 d7             	mov    %rdx,%rdi
+  80162a:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801631:	00 00 00 
+  801634:	ff d0                	call   *%rax
+  return dst;
+  801636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+
+000000000080163c <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80163c:	55                   	push   %rbp
+  80163d:	48 89 e5             	mov    %rsp,%rbp
+  801640:	48 83 ec 28          	sub    $0x28,%rsp
+  801644:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801648:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80164c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801654:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801658:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80165f:	00 
+  801660:	eb 2a                	jmp    80168c <strncpy+0x50>
+    *dst++ = *src;
+  801662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801666:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80166a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80166e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801672:	0f b6 12             	movzbl (%rdx),%edx
+  801675:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801677:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80167b:	0f b6 00             	movzbl (%rax),%eax
+  80167e:	84 c0                	test   %al,%al
+  801680:	74 05                	je     801687 <strncpy+0x4b>
+      src++;
+  801682:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801687:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80168c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801690:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801694:	72 cc                	jb     801662 <strncpy+0x26>
+  return ret;
+  801696:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80169a:	c9                   	leave
+  80169b:	c3                   	ret
+
+000000000080169c <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8016a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8016b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8016b8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016bd:	74 3d                	je     8016fc <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8016bf:	eb 1d                	jmp    8016de <strlcpy+0x42>
+      *dst++ = *src++;
+  8016c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016c5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016c9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016d1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016d9:	0f b6 12             	movzbl (%rdx),%edx
+  8016dc:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8016de:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016e8:	74 0b                	je     8016f5 <strlcpy+0x59>
+  8016ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ee:	0f b6 00             	movzbl (%rax),%eax
+  8016f1:	84 c0                	test   %al,%al
+  8016f3:	75 cc                	jne    8016c1 <strlcpy+0x25>
+    *dst = '\0';
+  8016f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f9:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8016fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801700:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+
+0000000000801706 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801706:	55                   	push   %rbp
+  801707:	48 89 e5             	mov    %rsp,%rbp
+  80170a:	48 83 ec 30          	sub    $0x30,%rsp
+  80170e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801712:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801716:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80171a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80171e:	48 89 c7             	mov    %rax,%rdi
+  801721:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+  80172d:	48 98                	cltq
+  80172f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801733:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173b:	48 89 d6             	mov    %rdx,%rsi
+  80173e:	48 89 c7             	mov    %rax,%rdi
+  801741:	48 b8 6c 15 80 00 00 	movabs $0x80156c,%rax
+  801748:	00 00 00 
+  80174b:	ff d0                	call   *%rax
+  80174d:	48 98                	cltq
+  80174f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801753:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801757:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80175b:	75 10                	jne    80176d <strlcat+0x67>
+    return maxlen + srclen;
+  80175d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801761:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801765:	48 01 d0             	add    %rdx,%rax
+  801768:	e9 86 00 00 00       	jmp    8017f3 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80176d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801771:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801775:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801779:	73 2b                	jae    8017a6 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80177b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80177f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801783:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801787:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178b:	48 01 c1             	add    %rax,%rcx
+  80178e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801792:	48 89 c6             	mov    %rax,%rsi
+  801795:	48 89 cf             	mov    %rcx,%rdi
+  801798:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  80179f:	00 00 00 
+  8017a2:	ff d0                	call   *%rax
+  8017a4:	eb 42                	jmp    8017e8 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8017a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017aa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017ae:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b6:	48 01 c1             	add    %rax,%rcx
+  8017b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017bd:	48 89 c6             	mov    %rax,%rsi
+  8017c0:	48 89 cf             	mov    %rcx,%rdi
+  8017c3:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8017cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d7:	48 01 d0             	add    %rdx,%rax
+  8017da:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e2:	48 01 d0             	add    %rdx,%rax
+  8017e5:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8017e8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f0:	48 01 d0             	add    %rdx,%rax
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+00000000008017f5 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8017fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801801:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801805:	eb 0a                	jmp    801811 <strcmp+0x1c>
+    p++, q++;
+  801807:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80180c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801815:	0f b6 00             	movzbl (%rax),%eax
+  801818:	84 c0                	test   %al,%al
+  80181a:	74 12                	je     80182e <strcmp+0x39>
+  80181c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801820:	0f b6 10             	movzbl (%rax),%edx
+  801823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801827:	0f b6 00             	movzbl (%rax),%eax
+  80182a:	38 c2                	cmp    %al,%dl
+  80182c:	74 d9                	je     801807 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80182e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801832:	0f b6 00             	movzbl (%rax),%eax
+  801835:	0f b6 d0             	movzbl %al,%edx
+  801838:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80183c:	0f b6 00             	movzbl (%rax),%eax
+  80183f:	0f b6 c0             	movzbl %al,%eax
+  801842:	29 c2                	sub    %eax,%edx
+  801844:	89 d0                	mov    %edx,%eax
+}
+  801846:	c9                   	leave
+  801847:	c3                   	ret
+
+0000000000801848 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801848:	55                   	push   %rbp
+  801849:	48 89 e5             	mov    %rsp,%rbp
+  80184c:	48 83 ec 18          	sub    $0x18,%rsp
+  801850:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801854:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801858:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80185c:	eb 0f                	jmp    80186d <strncmp+0x25>
+    n--, p++, q++;
+  80185e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801863:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801868:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80186d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801872:	74 1d                	je     801891 <strncmp+0x49>
+  801874:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801878:	0f b6 00             	movzbl (%rax),%eax
+  80187b:	84 c0                	test   %al,%al
+  80187d:	74 12                	je     801891 <strncmp+0x49>
+  80187f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801883:	0f b6 10             	movzbl (%rax),%edx
+  801886:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188a:	0f b6 00             	movzbl (%rax),%eax
+  80188d:	38 c2                	cmp    %al,%dl
+  80188f:	74 cd                	je     80185e <strncmp+0x16>
+  if (n == 0)
+  801891:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801896:	75 07                	jne    80189f <strncmp+0x57>
+    return 0;
+  801898:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189d:	eb 16                	jmp    8018b5 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80189f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a3:	0f b6 00             	movzbl (%rax),%eax
+  8018a6:	0f b6 d0             	movzbl %al,%edx
+  8018a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ad:	0f b6 00             	movzbl (%rax),%eax
+  8018b0:	0f b6 c0             	movzbl %al,%eax
+  8018b3:	29 c2                	sub    %eax,%edx
+}
+  8018b5:	89 d0                	mov    %edx,%eax
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+00000000008018b9 <strchr>:
+strchr(const char *s, char c) {
+  8018b9:	55                   	push   %rbp
+  8018ba:	48 89 e5             	mov    %rsp,%rbp
+  8018bd:	48 83 ec 60          	sub    $0x60,%rsp
+  8018c1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8018c5:	89 f0                	mov    %esi,%eax
+  8018c7:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8018ca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018ce:	83 e0 0f             	and    $0xf,%eax
+  8018d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8018d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018d7:	48 f7 d8             	neg    %rax
+  8018da:	48 89 c2             	mov    %rax,%rdx
+  8018dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018e1:	48 01 d0             	add    %rdx,%rax
+  8018e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8018e8:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8018ec:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8018f0:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8018f4:	66 0f 6e c0          	movd   %eax,%xmm0
+  8018f8:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8018fc:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801900:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801905:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801909:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80190d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801911:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801915:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80191a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80191f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801923:	89 c2                	mov    %eax,%edx
+  801925:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80192a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80192f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801933:	09 c2                	or     %eax,%edx
+  801935:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801938:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80193d:	89 c1                	mov    %eax,%ecx
+  80193f:	d3 e6                	shl    %cl,%esi
+  801941:	89 f0                	mov    %esi,%eax
+  801943:	21 d0                	and    %edx,%eax
+  801945:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801948:	eb 34                	jmp    80197e <strchr+0xc5>
+    p += 16;
+  80194a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80194f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801953:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801957:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80195b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801960:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801965:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801969:	89 c2                	mov    %eax,%edx
+  80196b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801970:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801975:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801979:	09 d0                	or     %edx,%eax
+  80197b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80197e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801982:	74 c6                	je     80194a <strchr+0x91>
+  p += __builtin_ctz(m);
+  801984:	31 c0                	xor    %eax,%eax
+  801986:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80198b:	48 98                	cltq
+  80198d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801991:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801995:	0f b6 00             	movzbl (%rax),%eax
+  801998:	84 c0                	test   %al,%al
+  80199a:	74 06                	je     8019a2 <strchr+0xe9>
+  80199c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a0:	eb 05                	jmp    8019a7 <strchr+0xee>
+  8019a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a7:	c9                   	leave
+  8019a8:	c3                   	ret
+
+00000000008019a9 <strfind>:
+strfind(const char *s, char c) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019b5:	89 f0                	mov    %esi,%eax
+  8019b7:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8019ba:	eb 11                	jmp    8019cd <strfind+0x24>
+    if (*s == c)
+  8019bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c0:	0f b6 00             	movzbl (%rax),%eax
+  8019c3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019c6:	74 12                	je     8019da <strfind+0x31>
+  for (; *s; s++)
+  8019c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d1:	0f b6 00             	movzbl (%rax),%eax
+  8019d4:	84 c0                	test   %al,%al
+  8019d6:	75 e4                	jne    8019bc <strfind+0x13>
+  8019d8:	eb 01                	jmp    8019db <strfind+0x32>
+      break;
+  8019da:	90                   	nop
+  return (char *)s;
+  8019db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019df:	c9                   	leave
+  8019e0:	c3                   	ret
+
+00000000008019e1 <memset>:
+memset(void *v, int c, size_t n) {
+  8019e1:	55                   	push   %rbp
+  8019e2:	48 89 e5             	mov    %rsp,%rbp
+  8019e5:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019ed:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8019f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8019f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019fc:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a01:	76 41                	jbe    801a44 <memset+0x63>
+  801a03:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+  801a0f:	83 e0 01             	and    $0x1,%eax
+  801a12:	85 c0                	test   %eax,%eax
+  801a14:	74 2e                	je     801a44 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801a16:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a19:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a1d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a21:	48 89 ce             	mov    %rcx,%rsi
+  801a24:	48 89 f7             	mov    %rsi,%rdi
+  801a27:	48 89 d1             	mov    %rdx,%rcx
+  801a2a:	fc                   	cld
+  801a2b:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a2d:	48 89 ca             	mov    %rcx,%rdx
+  801a30:	48 89 fe             	mov    %rdi,%rsi
+  801a33:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801a3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3f:	e9 a7 00 00 00       	jmp    801aeb <memset+0x10a>
+  if (n >= 8) {
+  801a44:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a49:	0f 86 87 00 00 00    	jbe    801ad6 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801a4f:	eb 16                	jmp    801a67 <memset+0x86>
+      *p++ = c;
+  801a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a55:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a59:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a5d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a60:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a62:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a6b:	83 e0 07             	and    $0x7,%eax
+  801a6e:	48 85 c0             	test   %rax,%rax
+  801a71:	75 de                	jne    801a51 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801a73:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a76:	0f b6 c0             	movzbl %al,%eax
+  801a79:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a80:	01 01 01 
+  801a83:	48 0f af c2          	imul   %rdx,%rax
+  801a87:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a8f:	48 c1 e8 03          	shr    $0x3,%rax
+  801a93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a9f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801aa3:	48 89 ce             	mov    %rcx,%rsi
+  801aa6:	48 89 f7             	mov    %rsi,%rdi
+  801aa9:	48 89 d1             	mov    %rdx,%rcx
+  801aac:	fc                   	cld
+  801aad:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ab0:	48 89 ca             	mov    %rcx,%rdx
+  801ab3:	48 89 fe             	mov    %rdi,%rsi
+  801ab6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801aba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801abe:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ac3:	eb 11                	jmp    801ad6 <memset+0xf5>
+    *p++ = c;
+  801ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801acd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ad1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801ad4:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801ad6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ada:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ade:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ae2:	48 85 c0             	test   %rax,%rax
+  801ae5:	75 de                	jne    801ac5 <memset+0xe4>
+  return v;
+  801ae7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801aeb:	c9                   	leave
+  801aec:	c3                   	ret
+
+0000000000801aed <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801aed:	55                   	push   %rbp
+  801aee:	48 89 e5             	mov    %rsp,%rbp
+  801af1:	48 83 ec 38          	sub    $0x38,%rsp
+  801af5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801af9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801afd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801b01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801b09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801b11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b15:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b19:	0f 83 da 00 00 00    	jae    801bf9 <memmove+0x10c>
+  801b1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b27:	48 01 d0             	add    %rdx,%rax
+  801b2a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b2e:	0f 83 c5 00 00 00    	jae    801bf9 <memmove+0x10c>
+    s += n;
+  801b34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b38:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801b3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b40:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801b44:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b49:	0f 86 94 00 00 00    	jbe    801be3 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801b4f:	eb 1c                	jmp    801b6d <memmove+0x80>
+        *--d = *--s;
+  801b51:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b56:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b5f:	0f b6 10             	movzbl (%rax),%edx
+  801b62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b66:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b68:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b71:	83 e0 07             	and    $0x7,%eax
+  801b74:	48 85 c0             	test   %rax,%rax
+  801b77:	75 d8                	jne    801b51 <memmove+0x64>
+      nq = n / 8;
+  801b79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b7d:	48 c1 e8 03          	shr    $0x3,%rax
+  801b81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b85:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b8a:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801b8f:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801b94:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b98:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ba0:	48 89 cf             	mov    %rcx,%rdi
+  801ba3:	48 89 d6             	mov    %rdx,%rsi
+  801ba6:	48 89 c1             	mov    %rax,%rcx
+  801ba9:	fd                   	std
+  801baa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801bad:	fc                   	cld
+  801bae:	48 89 c8             	mov    %rcx,%rax
+  801bb1:	48 89 f2             	mov    %rsi,%rdx
+  801bb4:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bb8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bbc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801bc0:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801bc5:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801bca:	eb 17                	jmp    801be3 <memmove+0xf6>
+      *--d = *--s;
+  801bcc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801bd1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bda:	0f b6 10             	movzbl (%rax),%edx
+  801bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801be3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801beb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bef:	48 85 c0             	test   %rax,%rax
+  801bf2:	75 d8                	jne    801bcc <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801bf4:	e9 f4 00 00 00       	jmp    801ced <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801bf9:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801bfe:	76 46                	jbe    801c46 <memmove+0x159>
+  801c00:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	83 e0 01             	and    $0x1,%eax
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	74 33                	je     801c46 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801c13:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1f:	48 89 cf             	mov    %rcx,%rdi
+  801c22:	48 89 d6             	mov    %rdx,%rsi
+  801c25:	48 89 c1             	mov    %rax,%rcx
+  801c28:	fc                   	cld
+  801c29:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c2b:	48 89 c8             	mov    %rcx,%rax
+  801c2e:	48 89 f2             	mov    %rsi,%rdx
+  801c31:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c35:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801c3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c41:	e9 ab 00 00 00       	jmp    801cf1 <memmove+0x204>
+    if (n >= 8) {
+  801c46:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c4b:	0f 86 8b 00 00 00    	jbe    801cdc <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801c51:	eb 22                	jmp    801c75 <memmove+0x188>
+        *d++ = *s++;
+  801c53:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c57:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c5b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c63:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c67:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c6b:	0f b6 12             	movzbl (%rdx),%edx
+  801c6e:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c70:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c79:	83 e0 07             	and    $0x7,%eax
+  801c7c:	48 85 c0             	test   %rax,%rax
+  801c7f:	75 d2                	jne    801c53 <memmove+0x166>
+      nq = n / 8;
+  801c81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c85:	48 c1 e8 03          	shr    $0x3,%rax
+  801c89:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c8d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c99:	48 89 cf             	mov    %rcx,%rdi
+  801c9c:	48 89 d6             	mov    %rdx,%rsi
+  801c9f:	48 89 c1             	mov    %rax,%rcx
+  801ca2:	fc                   	cld
+  801ca3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ca6:	48 89 c8             	mov    %rcx,%rax
+  801ca9:	48 89 f2             	mov    %rsi,%rdx
+  801cac:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801cb0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801cb8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801cbd:	eb 1d                	jmp    801cdc <memmove+0x1ef>
+      *d++ = *s++;
+  801cbf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cc3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ccf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cd3:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801cd7:	0f b6 12             	movzbl (%rdx),%edx
+  801cda:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801cdc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ce4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ce8:	48 85 c0             	test   %rax,%rax
+  801ceb:	75 d2                	jne    801cbf <memmove+0x1d2>
+  return dst;
+  801ced:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801cf1:	c9                   	leave
+  801cf2:	c3                   	ret
+
+0000000000801cf3 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801cf3:	55                   	push   %rbp
+  801cf4:	48 89 e5             	mov    %rsp,%rbp
+  801cf7:	48 83 ec 18          	sub    $0x18,%rsp
+  801cfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d03:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801d07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d0b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d13:	48 89 ce             	mov    %rcx,%rsi
+  801d16:	48 89 c7             	mov    %rax,%rdi
+  801d19:	48 b8 ed 1a 80 00 00 	movabs $0x801aed,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+}
+  801d25:	c9                   	leave
+  801d26:	c3                   	ret
+
+0000000000801d27 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d27:	55                   	push   %rbp
+  801d28:	48 89 e5             	mov    %rsp,%rbp
+  801d2b:	48 83 ec 40          	sub    $0x40,%rsp
+  801d2f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d33:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801d3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801d43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d4b:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801d50:	0f 86 a7 00 00 00    	jbe    801dfd <memcmp+0xd6>
+  801d56:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801d5d:	00 00 00 
+  801d60:	ff d0                	call   *%rax
+  801d62:	83 e0 02             	and    $0x2,%eax
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	0f 84 90 00 00 00    	je     801dfd <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801d6d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d71:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d79:	48 89 ce             	mov    %rcx,%rsi
+  801d7c:	48 89 c7             	mov    %rax,%rdi
+  801d7f:	48 b8 0e 13 80 00 00 	movabs $0x80130e,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+  801d8b:	e9 c2 00 00 00       	jmp    801e52 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d94:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d98:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801da0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801da4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801da8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801dac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801daf:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801db6:	74 36                	je     801dee <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801db8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dbb:	f7 d0                	not    %eax
+  801dbd:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801dc1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801dc4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801dc7:	48 63 d0             	movslq %eax,%rdx
+  801dca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dce:	48 01 d0             	add    %rdx,%rax
+  801dd1:	0f b6 00             	movzbl (%rax),%eax
+  801dd4:	0f b6 c0             	movzbl %al,%eax
+  801dd7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801dda:	48 63 ca             	movslq %edx,%rcx
+  801ddd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801de1:	48 01 ca             	add    %rcx,%rdx
+  801de4:	0f b6 12             	movzbl (%rdx),%edx
+  801de7:	0f b6 d2             	movzbl %dl,%edx
+  801dea:	29 d0                	sub    %edx,%eax
+  801dec:	eb 64                	jmp    801e52 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801dee:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801df3:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801df8:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801dfd:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801e02:	77 8c                	ja     801d90 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801e04:	eb 36                	jmp    801e3c <memcmp+0x115>
+    if (*s1 != *s2)
+  801e06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e0a:	0f b6 10             	movzbl (%rax),%edx
+  801e0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e11:	0f b6 00             	movzbl (%rax),%eax
+  801e14:	38 c2                	cmp    %al,%dl
+  801e16:	74 1a                	je     801e32 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1c:	0f b6 00             	movzbl (%rax),%eax
+  801e1f:	0f b6 c8             	movzbl %al,%ecx
+  801e22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e26:	0f b6 00             	movzbl (%rax),%eax
+  801e29:	0f b6 d0             	movzbl %al,%edx
+  801e2c:	89 c8                	mov    %ecx,%eax
+  801e2e:	29 d0                	sub    %edx,%eax
+  801e30:	eb 20                	jmp    801e52 <memcmp+0x12b>
+    s1++, s2++;
+  801e32:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e37:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e40:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e44:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e48:	48 85 c0             	test   %rax,%rax
+  801e4b:	75 b9                	jne    801e06 <memcmp+0xdf>
+  }
+
+  return 0;
+  801e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e52:	c9                   	leave
+  801e53:	c3                   	ret
+
+0000000000801e54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801e54:	55                   	push   %rbp
+  801e55:	48 89 e5             	mov    %rsp,%rbp
+  801e58:	48 83 ec 50          	sub    $0x50,%rsp
+  801e5c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e60:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e63:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e67:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e6b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801e6f:	48 01 d0             	add    %rdx,%rax
+  801e72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801e76:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e79:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e7d:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e81:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e85:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e8a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e8e:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801e93:	76 73                	jbe    801f08 <memfind+0xb4>
+  801e95:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801e9c:	00 00 00 
+  801e9f:	ff d0                	call   *%rax
+  801ea1:	83 e0 02             	and    $0x2,%eax
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	74 60                	je     801f08 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801ea8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801eab:	0f b6 c8             	movzbl %al,%ecx
+  801eae:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801eb2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eb6:	89 ce                	mov    %ecx,%esi
+  801eb8:	48 89 c7             	mov    %rax,%rdi
+  801ebb:	48 b8 fd 13 80 00 00 	movabs $0x8013fd,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  801ec7:	eb 6c                	jmp    801f35 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801ec9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecd:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ed1:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ed5:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801eda:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ede:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ee2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801ee5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801ee9:	74 13                	je     801efe <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801eeb:	31 c0                	xor    %eax,%eax
+  801eed:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801ef2:	48 63 d0             	movslq %eax,%rdx
+  801ef5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef9:	48 01 d0             	add    %rdx,%rax
+  801efc:	eb 37                	jmp    801f35 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801efe:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801f03:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801f08:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f0d:	77 ba                	ja     801ec9 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f0f:	eb 13                	jmp    801f24 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801f11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f15:	0f b6 00             	movzbl (%rax),%eax
+  801f18:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f1b:	38 d0                	cmp    %dl,%al
+  801f1d:	74 11                	je     801f30 <memfind+0xdc>
+  for (; s < ends; s++)
+  801f1f:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f28:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f2c:	72 e3                	jb     801f11 <memfind+0xbd>
+  801f2e:	eb 01                	jmp    801f31 <memfind+0xdd>
+      break;
+  801f30:	90                   	nop
+  return (void *)s;
+  801f31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+0000000000801f37 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f37:	55                   	push   %rbp
+  801f38:	48 89 e5             	mov    %rsp,%rbp
+  801f3b:	48 83 ec 38          	sub    $0x38,%rsp
+  801f3f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f43:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f47:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801f4a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801f51:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801f58:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f59:	eb 05                	jmp    801f60 <strtol+0x29>
+    s++;
+  801f5b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f64:	0f b6 00             	movzbl (%rax),%eax
+  801f67:	3c 20                	cmp    $0x20,%al
+  801f69:	74 f0                	je     801f5b <strtol+0x24>
+  801f6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f6f:	0f b6 00             	movzbl (%rax),%eax
+  801f72:	3c 09                	cmp    $0x9,%al
+  801f74:	74 e5                	je     801f5b <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801f76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f7a:	0f b6 00             	movzbl (%rax),%eax
+  801f7d:	3c 2b                	cmp    $0x2b,%al
+  801f7f:	75 07                	jne    801f88 <strtol+0x51>
+    s++;
+  801f81:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f86:	eb 17                	jmp    801f9f <strtol+0x68>
+  else if (*s == '-')
+  801f88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f8c:	0f b6 00             	movzbl (%rax),%eax
+  801f8f:	3c 2d                	cmp    $0x2d,%al
+  801f91:	75 0c                	jne    801f9f <strtol+0x68>
+    s++, neg = 1;
+  801f93:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f98:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f9f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fa3:	74 06                	je     801fab <strtol+0x74>
+  801fa5:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801fa9:	75 28                	jne    801fd3 <strtol+0x9c>
+  801fab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801faf:	0f b6 00             	movzbl (%rax),%eax
+  801fb2:	3c 30                	cmp    $0x30,%al
+  801fb4:	75 1d                	jne    801fd3 <strtol+0x9c>
+  801fb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fba:	48 83 c0 01          	add    $0x1,%rax
+  801fbe:	0f b6 00             	movzbl (%rax),%eax
+  801fc1:	3c 78                	cmp    $0x78,%al
+  801fc3:	75 0e                	jne    801fd3 <strtol+0x9c>
+    s += 2, base = 16;
+  801fc5:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801fca:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801fd1:	eb 2c                	jmp    801fff <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801fd3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fd7:	75 19                	jne    801ff2 <strtol+0xbb>
+  801fd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fdd:	0f b6 00             	movzbl (%rax),%eax
+  801fe0:	3c 30                	cmp    $0x30,%al
+  801fe2:	75 0e                	jne    801ff2 <strtol+0xbb>
+    s++, base = 8;
+  801fe4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fe9:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ff0:	eb 0d                	jmp    801fff <strtol+0xc8>
+  else if (base == 0)
+  801ff2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ff6:	75 07                	jne    801fff <strtol+0xc8>
+    base = 10;
+  801ff8:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801fff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802003:	0f b6 00             	movzbl (%rax),%eax
+  802006:	3c 2f                	cmp    $0x2f,%al
+  802008:	7e 1d                	jle    802027 <strtol+0xf0>
+  80200a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80200e:	0f b6 00             	movzbl (%rax),%eax
+  802011:	3c 39                	cmp    $0x39,%al
+  802013:	7f 12                	jg     802027 <strtol+0xf0>
+      dig = *s - '0';
+  802015:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802019:	0f b6 00             	movzbl (%rax),%eax
+  80201c:	0f be c0             	movsbl %al,%eax
+  80201f:	83 e8 30             	sub    $0x30,%eax
+  802022:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802025:	eb 4e                	jmp    802075 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802027:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80202b:	0f b6 00             	movzbl (%rax),%eax
+  80202e:	3c 60                	cmp    $0x60,%al
+  802030:	7e 1d                	jle    80204f <strtol+0x118>
+  802032:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802036:	0f b6 00             	movzbl (%rax),%eax
+  802039:	3c 7a                	cmp    $0x7a,%al
+  80203b:	7f 12                	jg     80204f <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80203d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802041:	0f b6 00             	movzbl (%rax),%eax
+  802044:	0f be c0             	movsbl %al,%eax
+  802047:	83 e8 57             	sub    $0x57,%eax
+  80204a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80204d:	eb 26                	jmp    802075 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80204f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802053:	0f b6 00             	movzbl (%rax),%eax
+  802056:	3c 40                	cmp    $0x40,%al
+  802058:	7e 47                	jle    8020a1 <strtol+0x16a>
+  80205a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80205e:	0f b6 00             	movzbl (%rax),%eax
+  802061:	3c 5a                	cmp    $0x5a,%al
+  802063:	7f 3c                	jg     8020a1 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802065:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802069:	0f b6 00             	movzbl (%rax),%eax
+  80206c:	0f be c0             	movsbl %al,%eax
+  80206f:	83 e8 37             	sub    $0x37,%eax
+  802072:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802075:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802078:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80207b:	7d 23                	jge    8020a0 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80207d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802082:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802085:	48 98                	cltq
+  802087:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80208c:	48 89 c2             	mov    %rax,%rdx
+  80208f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802092:	48 98                	cltq
+  802094:	48 01 d0             	add    %rdx,%rax
+  802097:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80209b:	e9 5f ff ff ff       	jmp    801fff <strtol+0xc8>
+      break;
+  8020a0:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8020a1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8020a6:	74 0b                	je     8020b3 <strtol+0x17c>
+    *endptr = (char *)s;
+  8020a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8020b0:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8020b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b7:	74 09                	je     8020c2 <strtol+0x18b>
+  8020b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020bd:	48 f7 d8             	neg    %rax
+  8020c0:	eb 04                	jmp    8020c6 <strtol+0x18f>
+  8020c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+
+00000000008020c8 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	53                   	push   %rbx
+  8020cd:	48 83 ec 48          	sub    $0x48,%rsp
+  8020d1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8020d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8020d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020dd:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8020e1:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8020e5:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8020e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ed:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020f1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020f5:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8020f9:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020fd:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802101:	4c 89 c3             	mov    %r8,%rbx
+  802104:	cd 30                	int    $0x30
+  802106:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80210a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80210f:	74 46                	je     802157 <syscall+0x8f>
+  802111:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802116:	7e 3f                	jle    802157 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802118:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80211c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802120:	49 89 d0             	mov    %rdx,%r8
+  802123:	48 89 c1             	mov    %rax,%rcx
+  802126:	48 b8 68 58 80 00 00 	movabs $0x805868,%rax
+  80212d:	00 00 00 
+  802130:	48 89 c2             	mov    %rax,%rdx
+  802133:	be 22 00 00 00       	mov    $0x22,%esi
+  802138:	48 b8 87 58 80 00 00 	movabs $0x805887,%rax
+  80213f:	00 00 00 
+  802142:	48 89 c7             	mov    %rax,%rdi
+  802145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214a:	49 b9 db 03 80 00 00 	movabs $0x8003db,%r9
+  802151:	00 00 00 
+  802154:	41 ff d1             	call   *%r9
+
+  return ret;
+  802157:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80215b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+0000000000802161 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802161:	55                   	push   %rbp
+  802162:	48 89 e5             	mov    %rsp,%rbp
+  802165:	48 83 ec 10          	sub    $0x10,%rsp
+  802169:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80216d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802171:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802179:	48 83 ec 08          	sub    $0x8,%rsp
+  80217d:	6a 00                	push   $0x0
+  80217f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80218b:	48 89 d1             	mov    %rdx,%rcx
+  80218e:	48 89 c2             	mov    %rax,%rdx
+  802191:	be 00 00 00 00       	mov    $0x0,%esi
+  802196:	bf 00 00 00 00       	mov    $0x0,%edi
+  80219b:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+  8021a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ab:	90                   	nop
+  8021ac:	c9                   	leave
+  8021ad:	c3                   	ret
+
+00000000008021ae <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8021ae:	55                   	push   %rbp
+  8021af:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b6:	6a 00                	push   $0x0
+  8021b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021d8:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e8:	c9                   	leave
+  8021e9:	c3                   	ret
+
+00000000008021ea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8021ea:	55                   	push   %rbp
+  8021eb:	48 89 e5             	mov    %rsp,%rbp
+  8021ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021f8:	48 98                	cltq
+  8021fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fe:	6a 00                	push   $0x0
+  802200:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802206:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80220c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802211:	48 89 c2             	mov    %rax,%rdx
+  802214:	be 01 00 00 00       	mov    $0x1,%esi
+  802219:	bf 03 00 00 00       	mov    $0x3,%edi
+  80221e:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+  80222a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+0000000000802230 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	48 83 ec 10          	sub    $0x10,%rsp
+  802238:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80223b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80223e:	48 98                	cltq
+  802240:	48 83 ec 08          	sub    $0x8,%rsp
+  802244:	6a 00                	push   $0x0
+  802246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802252:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802257:	48 89 c2             	mov    %rax,%rdx
+  80225a:	be 00 00 00 00       	mov    $0x0,%esi
+  80225f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802264:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802274:	90                   	nop
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+0000000000802277 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802277:	55                   	push   %rbp
+  802278:	48 89 e5             	mov    %rsp,%rbp
+  80227b:	48 83 ec 20          	sub    $0x20,%rsp
+  80227f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802282:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802286:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802289:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80228c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802291:	cd 30                	int    $0x30
+  802293:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802297:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80229b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022a0:	7e 3d                	jle    8022df <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8022a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a6:	49 89 c0             	mov    %rax,%r8
+  8022a9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8022ae:	48 b8 68 58 80 00 00 	movabs $0x805868,%rax
+  8022b5:	00 00 00 
+  8022b8:	48 89 c2             	mov    %rax,%rdx
+  8022bb:	be 49 00 00 00       	mov    $0x49,%esi
+  8022c0:	48 b8 87 58 80 00 00 	movabs $0x805887,%rax
+  8022c7:	00 00 00 
+  8022ca:	48 89 c7             	mov    %rax,%rdi
+  8022cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d2:	49 b9 db 03 80 00 00 	movabs $0x8003db,%r9
+  8022d9:	00 00 00 
+  8022dc:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8022df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022e4:	75 13                	jne    8022f9 <sys_env_wait+0x82>
+  8022e6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8022eb:	74 0c                	je     8022f9 <sys_env_wait+0x82>
+    *status = st;
+  8022ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022f1:	89 c2                	mov    %eax,%edx
+  8022f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022f7:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8022f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8022fd:	c9                   	leave
+  8022fe:	c3                   	ret
+
+00000000008022ff <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8022ff:	55                   	push   %rbp
+  802300:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802303:	48 83 ec 08          	sub    $0x8,%rsp
+  802307:	6a 00                	push   $0x0
+  802309:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80230f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802315:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80231a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80231f:	be 00 00 00 00       	mov    $0x0,%esi
+  802324:	bf 02 00 00 00       	mov    $0x2,%edi
+  802329:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802330:	00 00 00 
+  802333:	ff d0                	call   *%rax
+  802335:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+000000000080233b <sys_yield>:
+
+void
+sys_yield(void) {
+  80233b:	55                   	push   %rbp
+  80233c:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80233f:	48 83 ec 08          	sub    $0x8,%rsp
+  802343:	6a 00                	push   $0x0
+  802345:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80234b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802351:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235b:	be 00 00 00 00       	mov    $0x0,%esi
+  802360:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802365:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80236c:	00 00 00 
+  80236f:	ff d0                	call   *%rax
+  802371:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802375:	90                   	nop
+  802376:	c9                   	leave
+  802377:	c3                   	ret
+
+0000000000802378 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802378:	55                   	push   %rbp
+  802379:	48 89 e5             	mov    %rsp,%rbp
+  80237c:	48 83 ec 20          	sub    $0x20,%rsp
+  802380:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802383:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802387:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80238a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80238d:	48 63 c8             	movslq %eax,%rcx
+  802390:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802394:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802397:	48 98                	cltq
+  802399:	48 83 ec 08          	sub    $0x8,%rsp
+  80239d:	6a 00                	push   $0x0
+  80239f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a5:	49 89 c8             	mov    %rcx,%r8
+  8023a8:	48 89 d1             	mov    %rdx,%rcx
+  8023ab:	48 89 c2             	mov    %rax,%rdx
+  8023ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8023b3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023b8:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	48 83 c4 10          	add    $0x10,%rsp
+  8023c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8023cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8023ce:	c9                   	leave
+  8023cf:	c3                   	ret
+
+00000000008023d0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8023d0:	55                   	push   %rbp
+  8023d1:	48 89 e5             	mov    %rsp,%rbp
+  8023d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8023d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023df:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8023e2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023e6:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8023ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023ed:	48 63 c8             	movslq %eax,%rcx
+  8023f0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023f7:	48 63 f0             	movslq %eax,%rsi
+  8023fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802401:	48 98                	cltq
+  802403:	48 83 ec 08          	sub    $0x8,%rsp
+  802407:	51                   	push   %rcx
+  802408:	49 89 f9             	mov    %rdi,%r9
+  80240b:	49 89 f0             	mov    %rsi,%r8
+  80240e:	48 89 d1             	mov    %rdx,%rcx
+  802411:	48 89 c2             	mov    %rax,%rdx
+  802414:	be 01 00 00 00       	mov    $0x1,%esi
+  802419:	bf 07 00 00 00       	mov    $0x7,%edi
+  80241e:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802425:	00 00 00 
+  802428:	ff d0                	call   *%rax
+  80242a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+0000000000802430 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	48 83 ec 10          	sub    $0x10,%rsp
+  802438:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80243b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80243f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802443:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802446:	48 98                	cltq
+  802448:	48 83 ec 08          	sub    $0x8,%rsp
+  80244c:	6a 00                	push   $0x0
+  80244e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802454:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80245a:	48 89 d1             	mov    %rdx,%rcx
+  80245d:	48 89 c2             	mov    %rax,%rdx
+  802460:	be 01 00 00 00       	mov    $0x1,%esi
+  802465:	bf 08 00 00 00       	mov    $0x8,%edi
+  80246a:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+  802476:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+000000000080247c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	48 83 ec 10          	sub    $0x10,%rsp
+  802484:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802487:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80248a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80248d:	48 63 d0             	movslq %eax,%rdx
+  802490:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802493:	48 98                	cltq
+  802495:	48 83 ec 08          	sub    $0x8,%rsp
+  802499:	6a 00                	push   $0x0
+  80249b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a7:	48 89 d1             	mov    %rdx,%rcx
+  8024aa:	48 89 c2             	mov    %rax,%rdx
+  8024ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8024b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024b7:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+
+00000000008024c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8024c9:	55                   	push   %rbp
+  8024ca:	48 89 e5             	mov    %rsp,%rbp
+  8024cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8024d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024df:	48 98                	cltq
+  8024e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e5:	6a 00                	push   $0x0
+  8024e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024f3:	48 89 d1             	mov    %rdx,%rcx
+  8024f6:	48 89 c2             	mov    %rax,%rdx
+  8024f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8024fe:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802503:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80250a:	00 00 00 
+  80250d:	ff d0                	call   *%rax
+  80250f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802513:	c9                   	leave
+  802514:	c3                   	ret
+
+0000000000802515 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802515:	55                   	push   %rbp
+  802516:	48 89 e5             	mov    %rsp,%rbp
+  802519:	48 83 ec 10          	sub    $0x10,%rsp
+  80251d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802520:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802524:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802528:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80252b:	48 98                	cltq
+  80252d:	48 83 ec 08          	sub    $0x8,%rsp
+  802531:	6a 00                	push   $0x0
+  802533:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80253f:	48 89 d1             	mov    %rdx,%rcx
+  802542:	48 89 c2             	mov    %rax,%rdx
+  802545:	be 01 00 00 00       	mov    $0x1,%esi
+  80254a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80254f:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+  80255b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255f:	c9                   	leave
+  802560:	c3                   	ret
+
+0000000000802561 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802561:	55                   	push   %rbp
+  802562:	48 89 e5             	mov    %rsp,%rbp
+  802565:	48 83 ec 20          	sub    $0x20,%rsp
+  802569:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80256c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802570:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802574:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802577:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80257a:	48 63 f0             	movslq %eax,%rsi
+  80257d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802581:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802585:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802588:	48 98                	cltq
+  80258a:	48 83 ec 08          	sub    $0x8,%rsp
+  80258e:	6a 00                	push   $0x0
+  802590:	49 89 f1             	mov    %rsi,%r9
+  802593:	49 89 c8             	mov    %rcx,%r8
+  802596:	48 89 d1             	mov    %rdx,%rcx
+  802599:	48 89 c2             	mov    %rax,%rdx
+  80259c:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a1:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025a6:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8025ad:	00 00 00 
+  8025b0:	ff d0                	call   *%rax
+  8025b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b6:	c9                   	leave
+  8025b7:	c3                   	ret
+
+00000000008025b8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8025b8:	55                   	push   %rbp
+  8025b9:	48 89 e5             	mov    %rsp,%rbp
+  8025bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8025c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8025cc:	6a 00                	push   $0x0
+  8025ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025df:	48 89 c2             	mov    %rax,%rdx
+  8025e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8025e7:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025ec:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+  8025f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+
+00000000008025fe <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8025fe:	55                   	push   %rbp
+  8025ff:	48 89 e5             	mov    %rsp,%rbp
+  802602:	48 83 ec 10          	sub    $0x10,%rsp
+  802606:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80260a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80260e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802616:	48 83 ec 08          	sub    $0x8,%rsp
+  80261a:	6a 00                	push   $0x0
+  80261c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802628:	48 89 d1             	mov    %rdx,%rcx
+  80262b:	48 89 c2             	mov    %rax,%rdx
+  80262e:	be 01 00 00 00       	mov    $0x1,%esi
+  802633:	bf 10 00 00 00       	mov    $0x10,%edi
+  802638:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+  802644:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+
+000000000080264a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80264a:	55                   	push   %rbp
+  80264b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80264e:	48 83 ec 08          	sub    $0x8,%rsp
+  802652:	6a 00                	push   $0x0
+  802654:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266a:	be 00 00 00 00       	mov    $0x0,%esi
+  80266f:	bf 11 00 00 00       	mov    $0x11,%edi
+  802674:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80267b:	00 00 00 
+  80267e:	ff d0                	call   *%rax
+  802680:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	48 83 ec 10          	sub    $0x10,%rsp
+  80268e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802692:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802696:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80269a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269e:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a2:	6a 00                	push   $0x0
+  8026a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b0:	48 89 d1             	mov    %rdx,%rcx
+  8026b3:	48 89 c2             	mov    %rax,%rdx
+  8026b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026bb:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026c0:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+00000000008026d2 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8026da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026e2:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8026e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026e8:	48 63 c8             	movslq %eax,%rcx
+  8026eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f7:	6a 00                	push   $0x0
+  8026f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ff:	49 89 c8             	mov    %rcx,%r8
+  802702:	48 89 d1             	mov    %rdx,%rcx
+  802705:	48 89 c2             	mov    %rax,%rdx
+  802708:	be 00 00 00 00       	mov    $0x0,%esi
+  80270d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802712:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+  80271e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802722:	c9                   	leave
+  802723:	c3                   	ret
+
+0000000000802724 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802724:	55                   	push   %rbp
+  802725:	48 89 e5             	mov    %rsp,%rbp
+  802728:	48 83 ec 20          	sub    $0x20,%rsp
+  80272c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802730:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802733:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802737:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80273b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80273e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802742:	48 83 ec 08          	sub    $0x8,%rsp
+  802746:	6a 00                	push   $0x0
+  802748:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274e:	49 89 c8             	mov    %rcx,%r8
+  802751:	48 89 d1             	mov    %rdx,%rcx
+  802754:	48 89 c2             	mov    %rax,%rdx
+  802757:	be 00 00 00 00       	mov    $0x0,%esi
+  80275c:	bf 14 00 00 00       	mov    $0x14,%edi
+  802761:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802771:	c9                   	leave
+  802772:	c3                   	ret
+
+0000000000802773 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802773:	55                   	push   %rbp
+  802774:	48 89 e5             	mov    %rsp,%rbp
+  802777:	48 83 ec 10          	sub    $0x10,%rsp
+  80277b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80277f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802782:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802785:	48 63 d0             	movslq %eax,%rdx
+  802788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80278c:	48 83 ec 08          	sub    $0x8,%rsp
+  802790:	6a 00                	push   $0x0
+  802792:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80279e:	48 89 d1             	mov    %rdx,%rcx
+  8027a1:	48 89 c2             	mov    %rax,%rdx
+  8027a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a9:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027ae:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+  8027ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027be:	c9                   	leave
+  8027bf:	c3                   	ret
+
+00000000008027c0 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8027c0:	55                   	push   %rbp
+  8027c1:	48 89 e5             	mov    %rsp,%rbp
+  8027c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8027c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027cf:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8027d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8027d6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027da:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8027dd:	48 63 c8             	movslq %eax,%rcx
+  8027e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027e3:	48 63 d0             	movslq %eax,%rdx
+  8027e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	49 89 f1             	mov    %rsi,%r9
+  8027f3:	49 89 c8             	mov    %rcx,%r8
+  8027f6:	48 89 d1             	mov    %rdx,%rcx
+  8027f9:	48 89 c2             	mov    %rax,%rdx
+  8027fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802801:	bf 16 00 00 00       	mov    $0x16,%edi
+  802806:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802816:	c9                   	leave
+  802817:	c3                   	ret
+
+0000000000802818 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802818:	55                   	push   %rbp
+  802819:	48 89 e5             	mov    %rsp,%rbp
+  80281c:	48 83 ec 30          	sub    $0x30,%rsp
+  802820:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802824:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802828:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80282c:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802830:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802834:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802838:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80283c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802840:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802848:	48 83 ec 08          	sub    $0x8,%rsp
+  80284c:	51                   	push   %rcx
+  80284d:	49 89 f9             	mov    %rdi,%r9
+  802850:	49 89 f0             	mov    %rsi,%r8
+  802853:	48 89 d1             	mov    %rdx,%rcx
+  802856:	48 89 c2             	mov    %rax,%rdx
+  802859:	be 00 00 00 00       	mov    $0x0,%esi
+  80285e:	bf 17 00 00 00       	mov    $0x17,%edi
+  802863:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  80286a:	00 00 00 
+  80286d:	ff d0                	call   *%rax
+  80286f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+
+0000000000802875 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802875:	55                   	push   %rbp
+  802876:	48 89 e5             	mov    %rsp,%rbp
+  802879:	48 83 ec 10          	sub    $0x10,%rsp
+  80287d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802880:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802883:	48 98                	cltq
+  802885:	48 83 ec 08          	sub    $0x8,%rsp
+  802889:	6a 00                	push   $0x0
+  80288b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802891:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802897:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80289c:	48 89 c2             	mov    %rax,%rdx
+  80289f:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a4:	bf 18 00 00 00       	mov    $0x18,%edi
+  8028a9:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+  8028b5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028b9:	90                   	nop
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+00000000008028bc <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8028bc:	55                   	push   %rbp
+  8028bd:	48 89 e5             	mov    %rsp,%rbp
+  8028c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8028c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8028cf:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8028d2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8028d5:	48 63 f0             	movslq %eax,%rsi
+  8028d8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8028e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028e3:	48 98                	cltq
+  8028e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e9:	6a 00                	push   $0x0
+  8028eb:	49 89 f1             	mov    %rsi,%r9
+  8028ee:	49 89 c8             	mov    %rcx,%r8
+  8028f1:	48 89 d1             	mov    %rdx,%rcx
+  8028f4:	48 89 c2             	mov    %rax,%rdx
+  8028f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028fc:	bf 19 00 00 00       	mov    $0x19,%edi
+  802901:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802908:	00 00 00 
+  80290b:	ff d0                	call   *%rax
+  80290d:	48 83 c4 10          	add    $0x10,%rsp
+  802911:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802914:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802917:	c9                   	leave
+  802918:	c3                   	ret
+
+0000000000802919 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802919:	55                   	push   %rbp
+  80291a:	48 89 e5             	mov    %rsp,%rbp
+  80291d:	48 83 ec 20          	sub    $0x20,%rsp
+  802921:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802925:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802929:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80292c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80292f:	48 63 c8             	movslq %eax,%rcx
+  802932:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802936:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80293a:	48 83 ec 08          	sub    $0x8,%rsp
+  80293e:	6a 00                	push   $0x0
+  802940:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802946:	49 89 c8             	mov    %rcx,%r8
+  802949:	48 89 d1             	mov    %rdx,%rcx
+  80294c:	48 89 c2             	mov    %rax,%rdx
+  80294f:	be 01 00 00 00       	mov    $0x1,%esi
+  802954:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802959:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+  802965:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802969:	c9                   	leave
+  80296a:	c3                   	ret
+
+000000000080296b <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80296b:	55                   	push   %rbp
+  80296c:	48 89 e5             	mov    %rsp,%rbp
+  80296f:	48 83 ec 20          	sub    $0x20,%rsp
+  802973:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802977:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80297b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  80297f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802983:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80298b:	48 83 ec 08          	sub    $0x8,%rsp
+  80298f:	6a 00                	push   $0x0
+  802991:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802997:	49 89 c8             	mov    %rcx,%r8
+  80299a:	48 89 d1             	mov    %rdx,%rcx
+  80299d:	48 89 c2             	mov    %rax,%rdx
+  8029a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a5:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8029aa:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029ba:	c9                   	leave
+  8029bb:	c3                   	ret
+
+00000000008029bc <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8029bc:	55                   	push   %rbp
+  8029bd:	48 89 e5             	mov    %rsp,%rbp
+  8029c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8029c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029cc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8029cf:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8029d3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8029d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029da:	48 63 c8             	movslq %eax,%rcx
+  8029dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e9:	6a 00                	push   $0x0
+  8029eb:	49 89 f1             	mov    %rsi,%r9
+  8029ee:	49 89 c8             	mov    %rcx,%r8
+  8029f1:	48 89 d1             	mov    %rdx,%rcx
+  8029f4:	48 89 c2             	mov    %rax,%rdx
+  8029f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8029fc:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802a01:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	48 83 c4 10          	add    $0x10,%rsp
+  802a11:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+
+0000000000802a19 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802a19:	55                   	push   %rbp
+  802a1a:	48 89 e5             	mov    %rsp,%rbp
+  802a1d:	48 83 ec 10          	sub    $0x10,%rsp
+  802a21:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a27:	48 98                	cltq
+  802a29:	48 83 ec 08          	sub    $0x8,%rsp
+  802a2d:	6a 00                	push   $0x0
+  802a2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a40:	48 89 c2             	mov    %rax,%rdx
+  802a43:	be 01 00 00 00       	mov    $0x1,%esi
+  802a48:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802a4d:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802a54:	00 00 00 
+  802a57:	ff d0                	call   *%rax
+  802a59:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+0000000000802a5f <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802a5f:	55                   	push   %rbp
+  802a60:	48 89 e5             	mov    %rsp,%rbp
+  802a63:	48 83 ec 08          	sub    $0x8,%rsp
+  802a67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a6f:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802a76:	ff ff ff 
+  802a79:	48 01 d0             	add    %rdx,%rax
+  802a7c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a80:	c9                   	leave
+  802a81:	c3                   	ret
+
+0000000000802a82 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802a82:	55                   	push   %rbp
+  802a83:	48 89 e5             	mov    %rsp,%rbp
+  802a86:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a92:	48 89 c7             	mov    %rax,%rdi
+  802a95:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802a9c:	00 00 00 
+  802a9f:	ff d0                	call   *%rax
+  802aa1:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802aa7:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+0000000000802aad <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ab5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802ab9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ac0:	e9 ae 00 00 00       	jmp    802b73 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802ac5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ac8:	c1 e0 0c             	shl    $0xc,%eax
+  802acb:	48 98                	cltq
+  802acd:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ad2:	48 01 d0             	add    %rdx,%rax
+  802ad5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802ad9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802add:	48 c1 e8 27          	shr    $0x27,%rax
+  802ae1:	48 89 c2             	mov    %rax,%rdx
+  802ae4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802aeb:	01 00 00 
+  802aee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802af2:	83 e0 01             	and    $0x1,%eax
+  802af5:	48 85 c0             	test   %rax,%rax
+  802af8:	74 63                	je     802b5d <fd_alloc+0xb0>
+  802afa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802afe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b02:	48 89 c2             	mov    %rax,%rdx
+  802b05:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b0c:	01 00 00 
+  802b0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b13:	83 e0 01             	and    $0x1,%eax
+  802b16:	48 85 c0             	test   %rax,%rax
+  802b19:	74 42                	je     802b5d <fd_alloc+0xb0>
+  802b1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b1f:	48 c1 e8 15          	shr    $0x15,%rax
+  802b23:	48 89 c2             	mov    %rax,%rdx
+  802b26:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b2d:	01 00 00 
+  802b30:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b34:	83 e0 01             	and    $0x1,%eax
+  802b37:	48 85 c0             	test   %rax,%rax
+  802b3a:	74 21                	je     802b5d <fd_alloc+0xb0>
+  802b3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b40:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b44:	48 89 c2             	mov    %rax,%rdx
+  802b47:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b4e:	01 00 00 
+  802b51:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b55:	83 e0 01             	and    $0x1,%eax
+  802b58:	48 85 c0             	test   %rax,%rax
+  802b5b:	75 12                	jne    802b6f <fd_alloc+0xc2>
+      *fd_store = fd;
+  802b5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b61:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b65:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6d:	eb 1e                	jmp    802b8d <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802b6f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b73:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b77:	0f 8e 48 ff ff ff    	jle    802ac5 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802b7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b81:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b88:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+0000000000802b8f <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	48 83 ec 20          	sub    $0x20,%rsp
+  802b97:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b9a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ba2:	78 06                	js     802baa <fd_lookup+0x1b>
+  802ba4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ba8:	7e 0a                	jle    802bb4 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802baa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802baf:	e9 af 00 00 00       	jmp    802c63 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802bb4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bb7:	c1 e0 0c             	shl    $0xc,%eax
+  802bba:	48 98                	cltq
+  802bbc:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802bc1:	48 01 d0             	add    %rdx,%rax
+  802bc4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802bc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bcc:	48 c1 e8 27          	shr    $0x27,%rax
+  802bd0:	48 89 c2             	mov    %rax,%rdx
+  802bd3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802bda:	01 00 00 
+  802bdd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be1:	83 e0 01             	and    $0x1,%eax
+  802be4:	48 85 c0             	test   %rax,%rax
+  802be7:	74 63                	je     802c4c <fd_lookup+0xbd>
+  802be9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bed:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bf1:	48 89 c2             	mov    %rax,%rdx
+  802bf4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802bfb:	01 00 00 
+  802bfe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c02:	83 e0 01             	and    $0x1,%eax
+  802c05:	48 85 c0             	test   %rax,%rax
+  802c08:	74 42                	je     802c4c <fd_lookup+0xbd>
+  802c0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c0e:	48 c1 e8 15          	shr    $0x15,%rax
+  802c12:	48 89 c2             	mov    %rax,%rdx
+  802c15:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802c1c:	01 00 00 
+  802c1f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c23:	83 e0 01             	and    $0x1,%eax
+  802c26:	48 85 c0             	test   %rax,%rax
+  802c29:	74 21                	je     802c4c <fd_lookup+0xbd>
+  802c2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c2f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c33:	48 89 c2             	mov    %rax,%rdx
+  802c36:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c3d:	01 00 00 
+  802c40:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c44:	83 e0 01             	and    $0x1,%eax
+  802c47:	48 85 c0             	test   %rax,%rax
+  802c4a:	75 07                	jne    802c53 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802c4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c51:	eb 10                	jmp    802c63 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802c53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c57:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c5b:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c63:	c9                   	leave
+  802c64:	c3                   	ret
+
+0000000000802c65 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802c65:	55                   	push   %rbp
+  802c66:	48 89 e5             	mov    %rsp,%rbp
+  802c69:	48 83 ec 30          	sub    $0x30,%rsp
+  802c6d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c71:	89 f0                	mov    %esi,%eax
+  802c73:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802c76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c7a:	48 89 c7             	mov    %rax,%rdi
+  802c7d:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802c84:	00 00 00 
+  802c87:	ff d0                	call   *%rax
+  802c89:	89 c2                	mov    %eax,%edx
+  802c8b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c8f:	48 89 c6             	mov    %rax,%rsi
+  802c92:	89 d7                	mov    %edx,%edi
+  802c94:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+  802ca0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca7:	78 0a                	js     802cb3 <fd_close+0x4e>
+  802ca9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cad:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802cb1:	74 12                	je     802cc5 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802cb3:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802cb7:	74 05                	je     802cbe <fd_close+0x59>
+  802cb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cbc:	eb 70                	jmp    802d2e <fd_close+0xc9>
+  802cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc3:	eb 69                	jmp    802d2e <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cc9:	8b 00                	mov    (%rax),%eax
+  802ccb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ccf:	48 89 d6             	mov    %rdx,%rsi
+  802cd2:	89 c7                	mov    %eax,%edi
+  802cd4:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  802cdb:	00 00 00 
+  802cde:	ff d0                	call   *%rax
+  802ce0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ce3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ce7:	78 2a                	js     802d13 <fd_close+0xae>
+    if (dev->dev_close)
+  802ce9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ced:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802cf1:	48 85 c0             	test   %rax,%rax
+  802cf4:	74 16                	je     802d0c <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802cf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cfa:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802cfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d02:	48 89 c7             	mov    %rax,%rdi
+  802d05:	ff d2                	call   *%rdx
+  802d07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d0a:	eb 07                	jmp    802d13 <fd_close+0xae>
+    else
+      r = 0;
+  802d0c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d17:	48 89 c6             	mov    %rax,%rsi
+  802d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1f:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  802d26:	00 00 00 
+  802d29:	ff d0                	call   *%rax
+  return r;
+  802d2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d2e:	c9                   	leave
+  802d2f:	c3                   	ret
+
+0000000000802d30 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802d30:	55                   	push   %rbp
+  802d31:	48 89 e5             	mov    %rsp,%rbp
+  802d34:	48 83 ec 20          	sub    $0x20,%rsp
+  802d38:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d3b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802d3f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d46:	eb 3f                	jmp    802d87 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802d48:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d4f:	00 00 00 
+  802d52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d55:	48 98                	cltq
+  802d57:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d5b:	8b 00                	mov    (%rax),%eax
+  802d5d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802d60:	75 21                	jne    802d83 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802d62:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d69:	00 00 00 
+  802d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d6f:	48 98                	cltq
+  802d71:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d79:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d81:	eb 7f                	jmp    802e02 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802d83:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d87:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d8e:	00 00 00 
+  802d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d94:	48 98                	cltq
+  802d96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d9a:	48 85 c0             	test   %rax,%rax
+  802d9d:	75 a9                	jne    802d48 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d9f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802da6:	00 00 00 
+  802da9:	8b 40 04             	mov    0x4(%rax),%eax
+  802dac:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802db1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802db8:	00 00 00 
+  802dbb:	48 98                	cltq
+  802dbd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802dc4:	48 01 d0             	add    %rdx,%rax
+  802dc7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802dcd:	8b 00                	mov    (%rax),%eax
+  802dcf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802dd2:	89 c6                	mov    %eax,%esi
+  802dd4:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  802ddb:	00 00 00 
+  802dde:	48 89 c7             	mov    %rax,%rdi
+  802de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de6:	48 b9 fa 05 80 00 00 	movabs $0x8005fa,%rcx
+  802ded:	00 00 00 
+  802df0:	ff d1                	call   *%rcx
+  *dev = 0;
+  802df2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802df6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802dfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+
+0000000000802e04 <close>:
+
+int
+close(int fdnum) {
+  802e04:	55                   	push   %rbp
+  802e05:	48 89 e5             	mov    %rsp,%rbp
+  802e08:	48 83 ec 20          	sub    $0x20,%rsp
+  802e0c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e0f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802e13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e16:	48 89 d6             	mov    %rdx,%rsi
+  802e19:	89 c7                	mov    %eax,%edi
+  802e1b:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  802e22:	00 00 00 
+  802e25:	ff d0                	call   *%rax
+  802e27:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e2a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e2e:	79 05                	jns    802e35 <close+0x31>
+    return r;
+  802e30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e33:	eb 18                	jmp    802e4d <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802e35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e39:	be 01 00 00 00       	mov    $0x1,%esi
+  802e3e:	48 89 c7             	mov    %rax,%rdi
+  802e41:	48 b8 65 2c 80 00 00 	movabs $0x802c65,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+}
+  802e4d:	c9                   	leave
+  802e4e:	c3                   	ret
+
+0000000000802e4f <close_all>:
+
+void
+close_all(void) {
+  802e4f:	55                   	push   %rbp
+  802e50:	48 89 e5             	mov    %rsp,%rbp
+  802e53:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802e57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e5e:	eb 15                	jmp    802e75 <close_all+0x26>
+    close(i);
+  802e60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e63:	89 c7                	mov    %eax,%edi
+  802e65:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  802e6c:	00 00 00 
+  802e6f:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802e71:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802e75:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802e79:	7e e5                	jle    802e60 <close_all+0x11>
+}
+  802e7b:	90                   	nop
+  802e7c:	90                   	nop
+  802e7d:	c9                   	leave
+  802e7e:	c3                   	ret
+
+0000000000802e7f <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802e7f:	55                   	push   %rbp
+  802e80:	48 89 e5             	mov    %rsp,%rbp
+  802e83:	48 83 ec 40          	sub    $0x40,%rsp
+  802e87:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e8a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e8d:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e91:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e94:	48 89 d6             	mov    %rdx,%rsi
+  802e97:	89 c7                	mov    %eax,%edi
+  802e99:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  802ea0:	00 00 00 
+  802ea3:	ff d0                	call   *%rax
+  802ea5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ea8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eac:	79 08                	jns    802eb6 <dup+0x37>
+    return r;
+  802eae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eb1:	e9 33 02 00 00       	jmp    8030e9 <dup+0x26a>
+  close(newfdnum);
+  802eb6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802eb9:	89 c7                	mov    %eax,%edi
+  802ebb:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  802ec2:	00 00 00 
+  802ec5:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802ec7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802eca:	c1 e0 0c             	shl    $0xc,%eax
+  802ecd:	48 98                	cltq
+  802ecf:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ed4:	48 01 d0             	add    %rdx,%rax
+  802ed7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802edb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802edf:	48 89 c7             	mov    %rax,%rdi
+  802ee2:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+  802eee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802ef2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef6:	48 89 c7             	mov    %rax,%rdi
+  802ef9:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  802f00:	00 00 00 
+  802f03:	ff d0                	call   *%rax
+  802f05:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802f09:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802f10:	00 
+  802f11:	e9 19 01 00 00       	jmp    80302f <dup+0x1b0>
+    off -= PGSIZE;
+  802f16:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802f1d:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f1e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f26:	48 01 d0             	add    %rdx,%rax
+  802f29:	48 c1 e8 27          	shr    $0x27,%rax
+  802f2d:	48 89 c2             	mov    %rax,%rdx
+  802f30:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f37:	01 00 00 
+  802f3a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f3e:	83 e0 01             	and    $0x1,%eax
+  802f41:	48 85 c0             	test   %rax,%rax
+  802f44:	0f 84 e5 00 00 00    	je     80302f <dup+0x1b0>
+  802f4a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f52:	48 01 d0             	add    %rdx,%rax
+  802f55:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f59:	48 89 c2             	mov    %rax,%rdx
+  802f5c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f63:	01 00 00 
+  802f66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f6a:	83 e0 01             	and    $0x1,%eax
+  802f6d:	48 85 c0             	test   %rax,%rax
+  802f70:	0f 84 b9 00 00 00    	je     80302f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f76:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f7e:	48 01 d0             	add    %rdx,%rax
+  802f81:	48 c1 e8 15          	shr    $0x15,%rax
+  802f85:	48 89 c2             	mov    %rax,%rdx
+  802f88:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f8f:	01 00 00 
+  802f92:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f96:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f99:	48 85 c0             	test   %rax,%rax
+  802f9c:	0f 84 8d 00 00 00    	je     80302f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802fa2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802fa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802faa:	48 01 d0             	add    %rdx,%rax
+  802fad:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fb1:	48 89 c2             	mov    %rax,%rdx
+  802fb4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fbb:	01 00 00 
+  802fbe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fc2:	83 e0 01             	and    $0x1,%eax
+  802fc5:	48 85 c0             	test   %rax,%rax
+  802fc8:	74 65                	je     80302f <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802fca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802fce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd2:	48 01 d0             	add    %rdx,%rax
+  802fd5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fd9:	48 89 c2             	mov    %rax,%rdx
+  802fdc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fe3:	01 00 00 
+  802fe6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fea:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fef:	89 c6                	mov    %eax,%esi
+  802ff1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ff5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ff9:	48 01 c2             	add    %rax,%rdx
+  802ffc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803000:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803004:	48 01 c8             	add    %rcx,%rax
+  803007:	41 89 f0             	mov    %esi,%r8d
+  80300a:	48 89 d1             	mov    %rdx,%rcx
+  80300d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803012:	48 89 c6             	mov    %rax,%rsi
+  803015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80301a:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  803021:	00 00 00 
+  803024:	ff d0                	call   *%rax
+  803026:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803029:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80302d:	78 60                	js     80308f <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80302f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803034:	0f 85 dc fe ff ff    	jne    802f16 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80303a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80303e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803042:	48 89 c2             	mov    %rax,%rdx
+  803045:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80304c:	01 00 00 
+  80304f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803053:	25 07 0e 00 00       	and    $0xe07,%eax
+  803058:	89 c1                	mov    %eax,%ecx
+  80305a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80305e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803062:	41 89 c8             	mov    %ecx,%r8d
+  803065:	48 89 d1             	mov    %rdx,%rcx
+  803068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80306d:	48 89 c6             	mov    %rax,%rsi
+  803070:	bf 00 00 00 00       	mov    $0x0,%edi
+  803075:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+  803081:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803084:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803088:	78 08                	js     803092 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80308a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80308d:	eb 5a                	jmp    8030e9 <dup+0x26a>
+        goto err;
+  80308f:	90                   	nop
+  803090:	eb 01                	jmp    803093 <dup+0x214>
+    goto err;
+  803092:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803097:	48 89 c6             	mov    %rax,%rsi
+  80309a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80309f:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8030ab:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8030b2:	00 
+  8030b3:	eb 27                	jmp    8030dc <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8030b5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bd:	48 01 d0             	add    %rdx,%rax
+  8030c0:	48 89 c6             	mov    %rax,%rsi
+  8030c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c8:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  8030cf:	00 00 00 
+  8030d2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8030d4:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8030db:	00 
+  8030dc:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8030e3:	00 
+  8030e4:	76 cf                	jbe    8030b5 <dup+0x236>
+  return r;
+  8030e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030e9:	c9                   	leave
+  8030ea:	c3                   	ret
+
+00000000008030eb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030eb:	55                   	push   %rbp
+  8030ec:	48 89 e5             	mov    %rsp,%rbp
+  8030ef:	48 83 ec 40          	sub    $0x40,%rsp
+  8030f3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030f6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030fe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803102:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803105:	48 89 d6             	mov    %rdx,%rsi
+  803108:	89 c7                	mov    %eax,%edi
+  80310a:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  803111:	00 00 00 
+  803114:	ff d0                	call   *%rax
+  803116:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803119:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80311d:	78 24                	js     803143 <read+0x58>
+  80311f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803123:	8b 00                	mov    (%rax),%eax
+  803125:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803129:	48 89 d6             	mov    %rdx,%rsi
+  80312c:	89 c7                	mov    %eax,%edi
+  80312e:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+  80313a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80313d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803141:	79 0a                	jns    80314d <read+0x62>
+    return r;
+  803143:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803146:	48 98                	cltq
+  803148:	e9 9e 00 00 00       	jmp    8031eb <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80314d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803151:	8b 40 08             	mov    0x8(%rax),%eax
+  803154:	83 e0 03             	and    $0x3,%eax
+  803157:	83 f8 01             	cmp    $0x1,%eax
+  80315a:	75 5c                	jne    8031b8 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80315c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803163:	00 00 00 
+  803166:	8b 40 04             	mov    0x4(%rax),%eax
+  803169:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80316e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803175:	00 00 00 
+  803178:	48 98                	cltq
+  80317a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803181:	48 01 d0             	add    %rdx,%rax
+  803184:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80318a:	8b 00                	mov    (%rax),%eax
+  80318c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80318f:	89 c6                	mov    %eax,%esi
+  803191:	48 b8 b7 58 80 00 00 	movabs $0x8058b7,%rax
+  803198:	00 00 00 
+  80319b:	48 89 c7             	mov    %rax,%rdi
+  80319e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a3:	48 b9 fa 05 80 00 00 	movabs $0x8005fa,%rcx
+  8031aa:	00 00 00 
+  8031ad:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8031af:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031b6:	eb 33                	jmp    8031eb <read+0x100>
+  }
+  if (!dev->dev_read)
+  8031b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031bc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8031c0:	48 85 c0             	test   %rax,%rax
+  8031c3:	75 09                	jne    8031ce <read+0xe3>
+    return -E_NOT_SUPP;
+  8031c5:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8031cc:	eb 1d                	jmp    8031eb <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8031ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031d2:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8031d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031da:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031de:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031e2:	48 89 ce             	mov    %rcx,%rsi
+  8031e5:	48 89 c7             	mov    %rax,%rdi
+  8031e8:	41 ff d0             	call   *%r8
+}
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+
+00000000008031ed <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031ed:	55                   	push   %rbp
+  8031ee:	48 89 e5             	mov    %rsp,%rbp
+  8031f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8031f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8031fc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803200:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803207:	eb 49                	jmp    803252 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803209:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80320c:	48 98                	cltq
+  80320e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803212:	48 29 c2             	sub    %rax,%rdx
+  803215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803218:	48 63 c8             	movslq %eax,%rcx
+  80321b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80321f:	48 01 c1             	add    %rax,%rcx
+  803222:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803225:	48 89 ce             	mov    %rcx,%rsi
+  803228:	89 c7                	mov    %eax,%edi
+  80322a:	48 b8 eb 30 80 00 00 	movabs $0x8030eb,%rax
+  803231:	00 00 00 
+  803234:	ff d0                	call   *%rax
+  803236:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803239:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80323d:	79 07                	jns    803246 <readn+0x59>
+      return m;
+  80323f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803242:	48 98                	cltq
+  803244:	eb 1f                	jmp    803265 <readn+0x78>
+    if (m == 0)
+  803246:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80324a:	74 13                	je     80325f <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80324c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80324f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803252:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803255:	48 98                	cltq
+  803257:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80325b:	72 ac                	jb     803209 <readn+0x1c>
+  80325d:	eb 01                	jmp    803260 <readn+0x73>
+      break;
+  80325f:	90                   	nop
+  }
+  return tot;
+  803260:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803263:	48 98                	cltq
+}
+  803265:	c9                   	leave
+  803266:	c3                   	ret
+
+0000000000803267 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803267:	55                   	push   %rbp
+  803268:	48 89 e5             	mov    %rsp,%rbp
+  80326b:	48 83 ec 40          	sub    $0x40,%rsp
+  80326f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803272:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803276:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80327a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80327e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803281:	48 89 d6             	mov    %rdx,%rsi
+  803284:	89 c7                	mov    %eax,%edi
+  803286:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  80328d:	00 00 00 
+  803290:	ff d0                	call   *%rax
+  803292:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803295:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803299:	78 24                	js     8032bf <write+0x58>
+  80329b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329f:	8b 00                	mov    (%rax),%eax
+  8032a1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032a5:	48 89 d6             	mov    %rdx,%rsi
+  8032a8:	89 c7                	mov    %eax,%edi
+  8032aa:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+  8032b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032bd:	79 0a                	jns    8032c9 <write+0x62>
+    return r;
+  8032bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032c2:	48 98                	cltq
+  8032c4:	e9 9d 00 00 00       	jmp    803366 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032cd:	8b 40 08             	mov    0x8(%rax),%eax
+  8032d0:	83 e0 03             	and    $0x3,%eax
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	75 5c                	jne    803333 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032d7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8032de:	00 00 00 
+  8032e1:	8b 40 04             	mov    0x4(%rax),%eax
+  8032e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032e9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032f0:	00 00 00 
+  8032f3:	48 98                	cltq
+  8032f5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032fc:	48 01 d0             	add    %rdx,%rax
+  8032ff:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803305:	8b 00                	mov    (%rax),%eax
+  803307:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80330a:	89 c6                	mov    %eax,%esi
+  80330c:	48 b8 d3 58 80 00 00 	movabs $0x8058d3,%rax
+  803313:	00 00 00 
+  803316:	48 89 c7             	mov    %rax,%rdi
+  803319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331e:	48 b9 fa 05 80 00 00 	movabs $0x8005fa,%rcx
+  803325:	00 00 00 
+  803328:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80332a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803331:	eb 33                	jmp    803366 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803337:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80333b:	48 85 c0             	test   %rax,%rax
+  80333e:	75 09                	jne    803349 <write+0xe2>
+    return -E_NOT_SUPP;
+  803340:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803347:	eb 1d                	jmp    803366 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803349:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80334d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803355:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803359:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80335d:	48 89 ce             	mov    %rcx,%rsi
+  803360:	48 89 c7             	mov    %rax,%rdi
+  803363:	41 ff d0             	call   *%r8
+}
+  803366:	c9                   	leave
+  803367:	c3                   	ret
+
+0000000000803368 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803368:	55                   	push   %rbp
+  803369:	48 89 e5             	mov    %rsp,%rbp
+  80336c:	48 83 ec 18          	sub    $0x18,%rsp
+  803370:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803373:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803376:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80337a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80337d:	48 89 d6             	mov    %rdx,%rsi
+  803380:	89 c7                	mov    %eax,%edi
+  803382:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803391:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803395:	79 05                	jns    80339c <seek+0x34>
+    return r;
+  803397:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80339a:	eb 0f                	jmp    8033ab <seek+0x43>
+  fd->fd_offset = offset;
+  80339c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033a0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8033a3:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8033a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ab:	c9                   	leave
+  8033ac:	c3                   	ret
+
+00000000008033ad <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8033ad:	55                   	push   %rbp
+  8033ae:	48 89 e5             	mov    %rsp,%rbp
+  8033b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8033b5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8033b8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033bb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8033bf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033c2:	48 89 d6             	mov    %rdx,%rsi
+  8033c5:	89 c7                	mov    %eax,%edi
+  8033c7:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8033ce:	00 00 00 
+  8033d1:	ff d0                	call   *%rax
+  8033d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033da:	78 24                	js     803400 <ftruncate+0x53>
+  8033dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033e0:	8b 00                	mov    (%rax),%eax
+  8033e2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033e6:	48 89 d6             	mov    %rdx,%rsi
+  8033e9:	89 c7                	mov    %eax,%edi
+  8033eb:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  8033f2:	00 00 00 
+  8033f5:	ff d0                	call   *%rax
+  8033f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033fe:	79 08                	jns    803408 <ftruncate+0x5b>
+    return r;
+  803400:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803403:	e9 92 00 00 00       	jmp    80349a <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80340c:	8b 40 08             	mov    0x8(%rax),%eax
+  80340f:	83 e0 03             	and    $0x3,%eax
+  803412:	85 c0                	test   %eax,%eax
+  803414:	75 5a                	jne    803470 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803416:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80341d:	00 00 00 
+  803420:	8b 40 04             	mov    0x4(%rax),%eax
+  803423:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803428:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80342f:	00 00 00 
+  803432:	48 98                	cltq
+  803434:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80343b:	48 01 d0             	add    %rdx,%rax
+  80343e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803444:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803446:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803449:	89 c6                	mov    %eax,%esi
+  80344b:	48 b8 f0 58 80 00 00 	movabs $0x8058f0,%rax
+  803452:	00 00 00 
+  803455:	48 89 c7             	mov    %rax,%rdi
+  803458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345d:	48 b9 fa 05 80 00 00 	movabs $0x8005fa,%rcx
+  803464:	00 00 00 
+  803467:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803469:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80346e:	eb 2a                	jmp    80349a <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803470:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803474:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803478:	48 85 c0             	test   %rax,%rax
+  80347b:	75 07                	jne    803484 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80347d:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803482:	eb 16                	jmp    80349a <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803484:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803488:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80348c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803490:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803493:	89 d6                	mov    %edx,%esi
+  803495:	48 89 c7             	mov    %rax,%rdi
+  803498:	ff d1                	call   *%rcx
+}
+  80349a:	c9                   	leave
+  80349b:	c3                   	ret
+
+000000000080349c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80349c:	55                   	push   %rbp
+  80349d:	48 89 e5             	mov    %rsp,%rbp
+  8034a0:	48 83 ec 30          	sub    $0x30,%rsp
+  8034a4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8034a7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8034ab:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8034af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034b2:	48 89 d6             	mov    %rdx,%rsi
+  8034b5:	89 c7                	mov    %eax,%edi
+  8034b7:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+  8034c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034ca:	78 24                	js     8034f0 <fstat+0x54>
+  8034cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034d0:	8b 00                	mov    (%rax),%eax
+  8034d2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8034d6:	48 89 d6             	mov    %rdx,%rsi
+  8034d9:	89 c7                	mov    %eax,%edi
+  8034db:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034ee:	79 05                	jns    8034f5 <fstat+0x59>
+    return r;
+  8034f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034f3:	eb 5e                	jmp    803553 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8034f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034f9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034fd:	48 85 c0             	test   %rax,%rax
+  803500:	75 07                	jne    803509 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803502:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803507:	eb 4a                	jmp    803553 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803509:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80350d:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803510:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803514:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80351b:	00 00 00 
+  stat->st_isdir   = 0;
+  80351e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803522:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803529:	00 00 00 
+  stat->st_dev     = dev;
+  80352c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803530:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803534:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80353b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80353f:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803547:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80354b:	48 89 d6             	mov    %rdx,%rsi
+  80354e:	48 89 c7             	mov    %rax,%rdi
+  803551:	ff d1                	call   *%rcx
+}
+  803553:	c9                   	leave
+  803554:	c3                   	ret
+
+0000000000803555 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803555:	55                   	push   %rbp
+  803556:	48 89 e5             	mov    %rsp,%rbp
+  803559:	48 83 ec 10          	sub    $0x10,%rsp
+  80355d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803561:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803569:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80356f:	83 f8 20             	cmp    $0x20,%eax
+  803572:	75 07                	jne    80357b <pollwait_key+0x26>
+    return -E_INVAL;
+  803574:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803579:	eb 5f                	jmp    8035da <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80357b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80357f:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803589:	48 63 d2             	movslq %edx,%rdx
+  80358c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803590:	48 01 c2             	add    %rax,%rdx
+  803593:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803597:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80359a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80359e:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8035a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035a8:	8b 00                	mov    (%rax),%eax
+  8035aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035ae:	48 63 c9             	movslq %ecx,%rcx
+  8035b1:	48 c1 e1 04          	shl    $0x4,%rcx
+  8035b5:	48 01 ca             	add    %rcx,%rdx
+  8035b8:	48 83 c2 08          	add    $0x8,%rdx
+  8035bc:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8035be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035c2:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8035c8:	8d 50 01             	lea    0x1(%rax),%edx
+  8035cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035cf:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8035d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035da:	c9                   	leave
+  8035db:	c3                   	ret
+
+00000000008035dc <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8035dc:	55                   	push   %rbp
+  8035dd:	48 89 e5             	mov    %rsp,%rbp
+  8035e0:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8035e7:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8035ee:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8035f4:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8035fb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803602:	00 
+  int i, r, ready, ipc = 0;
+  803603:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80360a:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803611:	00 
+  803612:	74 45                	je     803659 <poll+0x7d>
+  803614:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80361b:	ff 
+  80361c:	74 3b                	je     803659 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80361e:	48 b8 17 4b 80 00 00 	movabs $0x804b17,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+  80362a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80362e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803632:	48 f7 d0             	not    %rax
+  803635:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80363c:	73 10                	jae    80364e <poll+0x72>
+  80363e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803642:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803649:	48 01 d0             	add    %rdx,%rax
+  80364c:	eb 07                	jmp    803655 <poll+0x79>
+  80364e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803655:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803659:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803660:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803667:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80366e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803675:	e9 46 02 00 00       	jmp    8038c0 <poll+0x2e4>
+      fds[i].revents = 0;
+  80367a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80367d:	48 63 d0             	movslq %eax,%rdx
+  803680:	48 89 d0             	mov    %rdx,%rax
+  803683:	48 01 c0             	add    %rax,%rax
+  803686:	48 01 d0             	add    %rdx,%rax
+  803689:	48 c1 e0 02          	shl    $0x2,%rax
+  80368d:	48 89 c2             	mov    %rax,%rdx
+  803690:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803697:	48 01 d0             	add    %rdx,%rax
+  80369a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8036a1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036a4:	48 63 d0             	movslq %eax,%rdx
+  8036a7:	48 89 d0             	mov    %rdx,%rax
+  8036aa:	48 01 c0             	add    %rax,%rax
+  8036ad:	48 01 d0             	add    %rdx,%rax
+  8036b0:	48 c1 e0 02          	shl    $0x2,%rax
+  8036b4:	48 89 c2             	mov    %rax,%rdx
+  8036b7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036be:	48 01 d0             	add    %rdx,%rax
+  8036c1:	8b 00                	mov    (%rax),%eax
+  8036c3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8036c6:	75 62                	jne    80372a <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8036c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036cb:	48 63 d0             	movslq %eax,%rdx
+  8036ce:	48 89 d0             	mov    %rdx,%rax
+  8036d1:	48 01 c0             	add    %rax,%rax
+  8036d4:	48 01 d0             	add    %rdx,%rax
+  8036d7:	48 c1 e0 02          	shl    $0x2,%rax
+  8036db:	48 89 c2             	mov    %rax,%rdx
+  8036de:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036e5:	48 01 d0             	add    %rdx,%rax
+  8036e8:	8b 40 04             	mov    0x4(%rax),%eax
+  8036eb:	83 e0 01             	and    $0x1,%eax
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	0f 84 9b 01 00 00    	je     803891 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8036f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036f9:	48 63 d0             	movslq %eax,%rdx
+  8036fc:	48 89 d0             	mov    %rdx,%rax
+  8036ff:	48 01 c0             	add    %rax,%rax
+  803702:	48 01 d0             	add    %rdx,%rax
+  803705:	48 c1 e0 02          	shl    $0x2,%rax
+  803709:	48 89 c2             	mov    %rax,%rdx
+  80370c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803713:	48 01 c2             	add    %rax,%rdx
+  803716:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803719:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80371c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80371f:	83 c8 04             	or     $0x4,%eax
+  803722:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803725:	e9 67 01 00 00       	jmp    803891 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80372a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80372d:	48 63 d0             	movslq %eax,%rdx
+  803730:	48 89 d0             	mov    %rdx,%rax
+  803733:	48 01 c0             	add    %rax,%rax
+  803736:	48 01 d0             	add    %rdx,%rax
+  803739:	48 c1 e0 02          	shl    $0x2,%rax
+  80373d:	48 89 c2             	mov    %rax,%rdx
+  803740:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803747:	48 01 d0             	add    %rdx,%rax
+  80374a:	8b 00                	mov    (%rax),%eax
+  80374c:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803753:	48 89 d6             	mov    %rdx,%rsi
+  803756:	89 c7                	mov    %eax,%edi
+  803758:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  80375f:	00 00 00 
+  803762:	ff d0                	call   *%rax
+  803764:	85 c0                	test   %eax,%eax
+  803766:	78 25                	js     80378d <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803768:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80376f:	8b 00                	mov    (%rax),%eax
+  803771:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803778:	48 89 d6             	mov    %rdx,%rsi
+  80377b:	89 c7                	mov    %eax,%edi
+  80377d:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  803784:	00 00 00 
+  803787:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	79 2c                	jns    8037b9 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80378d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803790:	48 63 d0             	movslq %eax,%rdx
+  803793:	48 89 d0             	mov    %rdx,%rax
+  803796:	48 01 c0             	add    %rax,%rax
+  803799:	48 01 d0             	add    %rdx,%rax
+  80379c:	48 c1 e0 02          	shl    $0x2,%rax
+  8037a0:	48 89 c2             	mov    %rax,%rdx
+  8037a3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037aa:	48 01 d0             	add    %rdx,%rax
+  8037ad:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8037b4:	e9 d8 00 00 00       	jmp    803891 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8037b9:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8037c0:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8037c4:	48 85 c0             	test   %rax,%rax
+  8037c7:	74 7d                	je     803846 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8037c9:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8037d0:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8037d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037d7:	48 63 d0             	movslq %eax,%rdx
+  8037da:	48 89 d0             	mov    %rdx,%rax
+  8037dd:	48 01 c0             	add    %rax,%rax
+  8037e0:	48 01 d0             	add    %rdx,%rax
+  8037e3:	48 c1 e0 02          	shl    $0x2,%rax
+  8037e7:	48 89 c2             	mov    %rax,%rdx
+  8037ea:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037f1:	48 01 d0             	add    %rdx,%rax
+  8037f4:	8b 48 04             	mov    0x4(%rax),%ecx
+  8037f7:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8037fe:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803805:	89 ce                	mov    %ecx,%esi
+  803807:	48 89 c7             	mov    %rax,%rdi
+  80380a:	41 ff d0             	call   *%r8
+  80380d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803810:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803814:	79 08                	jns    80381e <poll+0x242>
+          return r;
+  803816:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803819:	e9 45 01 00 00       	jmp    803963 <poll+0x387>
+        fds[i].revents = r;
+  80381e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803821:	48 63 d0             	movslq %eax,%rdx
+  803824:	48 89 d0             	mov    %rdx,%rax
+  803827:	48 01 c0             	add    %rax,%rax
+  80382a:	48 01 d0             	add    %rdx,%rax
+  80382d:	48 c1 e0 02          	shl    $0x2,%rax
+  803831:	48 89 c2             	mov    %rax,%rdx
+  803834:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80383b:	48 01 c2             	add    %rax,%rdx
+  80383e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803841:	89 42 08             	mov    %eax,0x8(%rdx)
+  803844:	eb 4b                	jmp    803891 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803846:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803849:	48 63 d0             	movslq %eax,%rdx
+  80384c:	48 89 d0             	mov    %rdx,%rax
+  80384f:	48 01 c0             	add    %rax,%rax
+  803852:	48 01 d0             	add    %rdx,%rax
+  803855:	48 c1 e0 02          	shl    $0x2,%rax
+  803859:	48 89 c2             	mov    %rax,%rdx
+  80385c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803863:	48 01 d0             	add    %rdx,%rax
+  803866:	8b 48 04             	mov    0x4(%rax),%ecx
+  803869:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80386c:	48 63 d0             	movslq %eax,%rdx
+  80386f:	48 89 d0             	mov    %rdx,%rax
+  803872:	48 01 c0             	add    %rax,%rax
+  803875:	48 01 d0             	add    %rdx,%rax
+  803878:	48 c1 e0 02          	shl    $0x2,%rax
+  80387c:	48 89 c2             	mov    %rax,%rdx
+  80387f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803886:	48 01 d0             	add    %rdx,%rax
+  803889:	83 e1 03             	and    $0x3,%ecx
+  80388c:	89 ca                	mov    %ecx,%edx
+  80388e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803891:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803894:	48 63 d0             	movslq %eax,%rdx
+  803897:	48 89 d0             	mov    %rdx,%rax
+  80389a:	48 01 c0             	add    %rax,%rax
+  80389d:	48 01 d0             	add    %rdx,%rax
+  8038a0:	48 c1 e0 02          	shl    $0x2,%rax
+  8038a4:	48 89 c2             	mov    %rax,%rdx
+  8038a7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038ae:	48 01 d0             	add    %rdx,%rax
+  8038b1:	8b 40 08             	mov    0x8(%rax),%eax
+  8038b4:	85 c0                	test   %eax,%eax
+  8038b6:	74 04                	je     8038bc <poll+0x2e0>
+        ready++;
+  8038b8:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8038bc:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8038c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038c3:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8038c9:	0f 8c ab fd ff ff    	jl     80367a <poll+0x9e>
+    }
+    if (ready)
+  8038cf:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8038d3:	74 08                	je     8038dd <poll+0x301>
+      return ready;
+  8038d5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8038d8:	e9 86 00 00 00       	jmp    803963 <poll+0x387>
+
+    if (deadline) {
+  8038dd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8038e2:	74 30                	je     803914 <poll+0x338>
+      now     = vsys_clock_ns();
+  8038e4:	48 b8 17 4b 80 00 00 	movabs $0x804b17,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+  8038f0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8038f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038f8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8038fc:	73 0a                	jae    803908 <poll+0x32c>
+  8038fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803902:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803906:	eb 05                	jmp    80390d <poll+0x331>
+  803908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390d:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803914:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803917:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80391a:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803921:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803928:	48 89 c7             	mov    %rax,%rdi
+  80392b:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+  803937:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80393a:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80393e:	75 07                	jne    803947 <poll+0x36b>
+      return 0;
+  803940:	b8 00 00 00 00       	mov    $0x0,%eax
+  803945:	eb 1c                	jmp    803963 <poll+0x387>
+    if (r < 0)
+  803947:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80394b:	79 05                	jns    803952 <poll+0x376>
+      return r;
+  80394d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803950:	eb 11                	jmp    803963 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803952:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803955:	c1 f8 02             	sar    $0x2,%eax
+  803958:	83 e0 01             	and    $0x1,%eax
+  80395b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80395e:	e9 f6 fc ff ff       	jmp    803659 <poll+0x7d>
+  }
+}
+  803963:	c9                   	leave
+  803964:	c3                   	ret
+
+0000000000803965 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803965:	55                   	push   %rbp
+  803966:	48 89 e5             	mov    %rsp,%rbp
+  803969:	48 83 ec 20          	sub    $0x20,%rsp
+  80396d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803971:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803975:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803979:	be 00 00 00 00       	mov    $0x0,%esi
+  80397e:	48 89 c7             	mov    %rax,%rdi
+  803981:	48 b8 53 3a 80 00 00 	movabs $0x803a53,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+  80398d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803990:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803994:	79 05                	jns    80399b <stat+0x36>
+    return fd;
+  803996:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803999:	eb 2f                	jmp    8039ca <stat+0x65>
+  r = fstat(fd, stat);
+  80399b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80399f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a2:	48 89 d6             	mov    %rdx,%rsi
+  8039a5:	89 c7                	mov    %eax,%edi
+  8039a7:	48 b8 9c 34 80 00 00 	movabs $0x80349c,%rax
+  8039ae:	00 00 00 
+  8039b1:	ff d0                	call   *%rax
+  8039b3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8039b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039b9:	89 c7                	mov    %eax,%edi
+  8039bb:	48 b8 04 2e 80 00 00 	movabs $0x802e04,%rax
+  8039c2:	00 00 00 
+  8039c5:	ff d0                	call   *%rax
+  return r;
+  8039c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8039ca:	c9                   	leave
+  8039cb:	c3                   	ret
+
+00000000008039cc <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8039cc:	55                   	push   %rbp
+  8039cd:	48 89 e5             	mov    %rsp,%rbp
+  8039d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8039d4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8039d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8039db:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039e2:	00 00 00 
+  8039e5:	8b 00                	mov    (%rax),%eax
+  8039e7:	85 c0                	test   %eax,%eax
+  8039e9:	75 1d                	jne    803a08 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039eb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039f0:	48 b8 32 51 80 00 00 	movabs $0x805132,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+  8039fc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a03:	00 00 00 
+  803a06:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803a08:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a0f:	00 00 00 
+  803a12:	8b 00                	mov    (%rax),%eax
+  803a14:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803a17:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803a1c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a23:	00 00 00 
+  803a26:	89 c7                	mov    %eax,%edi
+  803a28:	48 b8 85 50 80 00 00 	movabs $0x805085,%rax
+  803a2f:	00 00 00 
+  803a32:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803a34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a38:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3d:	48 89 c6             	mov    %rax,%rsi
+  803a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a45:	48 b8 08 4f 80 00 00 	movabs $0x804f08,%rax
+  803a4c:	00 00 00 
+  803a4f:	ff d0                	call   *%rax
+}
+  803a51:	c9                   	leave
+  803a52:	c3                   	ret
+
+0000000000803a53 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803a53:	55                   	push   %rbp
+  803a54:	48 89 e5             	mov    %rsp,%rbp
+  803a57:	48 83 ec 20          	sub    $0x20,%rsp
+  803a5b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a5f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a66:	48 89 c7             	mov    %rax,%rdi
+  803a69:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803a70:	00 00 00 
+  803a73:	ff d0                	call   *%rax
+  803a75:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a7a:	7e 0a                	jle    803a86 <open+0x33>
+    return -E_BAD_PATH;
+  803a7c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a81:	e9 a8 00 00 00       	jmp    803b2e <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a86:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a8a:	48 89 c7             	mov    %rax,%rdi
+  803a8d:	48 b8 ad 2a 80 00 00 	movabs $0x802aad,%rax
+  803a94:	00 00 00 
+  803a97:	ff d0                	call   *%rax
+  803a99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a9c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aa0:	79 08                	jns    803aaa <open+0x57>
+    return r;
+  803aa2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803aa5:	e9 84 00 00 00       	jmp    803b2e <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803aaa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aae:	48 89 c6             	mov    %rax,%rsi
+  803ab1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803ab8:	00 00 00 
+  803abb:	48 89 c7             	mov    %rax,%rdi
+  803abe:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  803ac5:	00 00 00 
+  803ac8:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803aca:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803ad1:	00 00 00 
+  803ad4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ad7:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803add:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ae1:	48 89 c6             	mov    %rax,%rsi
+  803ae4:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ae9:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803af0:	00 00 00 
+  803af3:	ff d0                	call   *%rax
+  803af5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803af8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803afc:	79 1d                	jns    803b1b <open+0xc8>
+    fd_close(fd, 0);
+  803afe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b02:	be 00 00 00 00       	mov    $0x0,%esi
+  803b07:	48 89 c7             	mov    %rax,%rdi
+  803b0a:	48 b8 65 2c 80 00 00 	movabs $0x802c65,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+    return r;
+  803b16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b19:	eb 13                	jmp    803b2e <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803b1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b1f:	48 89 c7             	mov    %rax,%rdi
+  803b22:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+}
+  803b2e:	c9                   	leave
+  803b2f:	c3                   	ret
+
+0000000000803b30 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803b30:	55                   	push   %rbp
+  803b31:	48 89 e5             	mov    %rsp,%rbp
+  803b34:	48 83 ec 10          	sub    $0x10,%rsp
+  803b38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803b3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b40:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b43:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b4a:	00 00 00 
+  803b4d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803b4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803b54:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b59:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+}
+  803b65:	c9                   	leave
+  803b66:	c3                   	ret
+
+0000000000803b67 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+  803b6b:	48 83 ec 30          	sub    $0x30,%rsp
+  803b6f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b73:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b77:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b7b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803b80:	74 07                	je     803b89 <devfile_read+0x22>
+  803b82:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b87:	75 0a                	jne    803b93 <devfile_read+0x2c>
+  return E_INVAL;
+  803b89:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b8e:	e9 b4 00 00 00       	jmp    803c47 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b93:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b9a:	00 
+  while (n) {
+  803b9b:	e9 98 00 00 00       	jmp    803c38 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ba0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ba4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ba7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803bae:	00 00 00 
+  803bb1:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803bb3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803bba:	00 00 00 
+  803bbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bc1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803bc5:	be 00 00 00 00       	mov    $0x0,%esi
+  803bca:	bf 03 00 00 00       	mov    $0x3,%edi
+  803bcf:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803bd6:	00 00 00 
+  803bd9:	ff d0                	call   *%rax
+  803bdb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803bde:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803be2:	7f 13                	jg     803bf7 <devfile_read+0x90>
+      return res ? res : res0;
+  803be4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803be8:	74 07                	je     803bf1 <devfile_read+0x8a>
+  803bea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bed:	48 98                	cltq
+  803bef:	eb 56                	jmp    803c47 <devfile_read+0xe0>
+  803bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bf5:	eb 50                	jmp    803c47 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803bf7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bfa:	48 63 d0             	movslq %eax,%rdx
+  803bfd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c01:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803c08:	00 00 00 
+  803c0b:	48 89 ce             	mov    %rcx,%rsi
+  803c0e:	48 89 c7             	mov    %rax,%rdi
+  803c11:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  803c18:	00 00 00 
+  803c1b:	ff d0                	call   *%rax
+
+    buf += res;
+  803c1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c20:	48 98                	cltq
+  803c22:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803c26:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c29:	48 98                	cltq
+  803c2b:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803c2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c32:	48 98                	cltq
+  803c34:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803c38:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c3d:	0f 85 5d ff ff ff    	jne    803ba0 <devfile_read+0x39>
+  }
+
+  return res0;
+  803c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803c47:	c9                   	leave
+  803c48:	c3                   	ret
+
+0000000000803c49 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803c49:	55                   	push   %rbp
+  803c4a:	48 89 e5             	mov    %rsp,%rbp
+  803c4d:	48 83 ec 50          	sub    $0x50,%rsp
+  803c51:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c55:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c59:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803c5d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c62:	74 07                	je     803c6b <devfile_write+0x22>
+  803c64:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c69:	75 0a                	jne    803c75 <devfile_write+0x2c>
+  return E_INVAL;
+  803c6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  803c70:	e9 c9 00 00 00       	jmp    803d3e <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803c75:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c7c:	00 
+
+  while (n) {
+  803c7d:	e9 ad 00 00 00       	jmp    803d2f <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803c82:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c86:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c8a:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c91:	00 
+  803c92:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c9a:	48 39 c2             	cmp    %rax,%rdx
+  803c9d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803ca1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803ca5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ca9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cad:	48 89 c6             	mov    %rax,%rsi
+  803cb0:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  803cb7:	00 00 00 
+  803cba:	48 89 c7             	mov    %rax,%rdi
+  803cbd:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  803cc4:	00 00 00 
+  803cc7:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803cc9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ccd:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cd0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803cd7:	00 00 00 
+  803cda:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803cdc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803ce3:	00 00 00 
+  803ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cea:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803cee:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf3:	bf 04 00 00 00       	mov    $0x4,%edi
+  803cf8:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803cff:	00 00 00 
+  803d02:	ff d0                	call   *%rax
+  803d04:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803d07:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d0b:	79 07                	jns    803d14 <devfile_write+0xcb>
+      return res;
+  803d0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d10:	48 98                	cltq
+  803d12:	eb 2a                	jmp    803d3e <devfile_write+0xf5>
+
+    buf += res;
+  803d14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d17:	48 98                	cltq
+  803d19:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803d1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d20:	48 98                	cltq
+  803d22:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803d26:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d29:	48 98                	cltq
+  803d2b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803d2f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803d34:	0f 85 48 ff ff ff    	jne    803c82 <devfile_write+0x39>
+  }
+
+  return res0;
+  803d3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803d3e:	c9                   	leave
+  803d3f:	c3                   	ret
+
+0000000000803d40 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803d40:	55                   	push   %rbp
+  803d41:	48 89 e5             	mov    %rsp,%rbp
+  803d44:	48 83 ec 20          	sub    $0x20,%rsp
+  803d48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d4c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803d50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d54:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d57:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d5e:	00 00 00 
+  803d61:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d63:	be 00 00 00 00       	mov    $0x0,%esi
+  803d68:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d6d:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803d74:	00 00 00 
+  803d77:	ff d0                	call   *%rax
+  803d79:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d80:	79 05                	jns    803d87 <devfile_stat+0x47>
+    return r;
+  803d82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d85:	eb 59                	jmp    803de0 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d8b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d92:	00 00 00 
+  803d95:	48 89 d6             	mov    %rdx,%rsi
+  803d98:	48 89 c7             	mov    %rax,%rdi
+  803d9b:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  803da2:	00 00 00 
+  803da5:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803da7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803dae:	00 00 00 
+  803db1:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803db7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dbb:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803dc1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803dc8:	00 00 00 
+  803dcb:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803dd1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dd5:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803de0:	c9                   	leave
+  803de1:	c3                   	ret
+
+0000000000803de2 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803de2:	55                   	push   %rbp
+  803de3:	48 89 e5             	mov    %rsp,%rbp
+  803de6:	48 83 ec 10          	sub    $0x10,%rsp
+  803dea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dee:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803df1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803df8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803dff:	00 00 00 
+  803e02:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803e04:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803e0b:	00 00 00 
+  803e0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e11:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803e14:	be 00 00 00 00       	mov    $0x0,%esi
+  803e19:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e1e:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803e25:	00 00 00 
+  803e28:	ff d0                	call   *%rax
+}
+  803e2a:	c9                   	leave
+  803e2b:	c3                   	ret
+
+0000000000803e2c <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	48 83 ec 18          	sub    $0x18,%rsp
+  803e34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e38:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803e3b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803e3f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e42:	83 e0 03             	and    $0x3,%eax
+}
+  803e45:	c9                   	leave
+  803e46:	c3                   	ret
+
+0000000000803e47 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803e47:	55                   	push   %rbp
+  803e48:	48 89 e5             	mov    %rsp,%rbp
+  803e4b:	48 83 ec 10          	sub    $0x10,%rsp
+  803e4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803e53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e57:	48 89 c7             	mov    %rax,%rdi
+  803e5a:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803e61:	00 00 00 
+  803e64:	ff d0                	call   *%rax
+  803e66:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e6b:	7e 07                	jle    803e74 <remove+0x2d>
+    return -E_BAD_PATH;
+  803e6d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803e72:	eb 36                	jmp    803eaa <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803e74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e78:	48 89 c6             	mov    %rax,%rsi
+  803e7b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803e82:	00 00 00 
+  803e85:	48 89 c7             	mov    %rax,%rdi
+  803e88:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  803e8f:	00 00 00 
+  803e92:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e94:	be 00 00 00 00       	mov    $0x0,%esi
+  803e99:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e9e:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803ea5:	00 00 00 
+  803ea8:	ff d0                	call   *%rax
+}
+  803eaa:	c9                   	leave
+  803eab:	c3                   	ret
+
+0000000000803eac <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803eac:	55                   	push   %rbp
+  803ead:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803eb0:	be 00 00 00 00       	mov    $0x0,%esi
+  803eb5:	bf 08 00 00 00       	mov    $0x8,%edi
+  803eba:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803ec1:	00 00 00 
+  803ec4:	ff d0                	call   *%rax
+}
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+
+0000000000803ec8 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803ec8:	55                   	push   %rbp
+  803ec9:	48 89 e5             	mov    %rsp,%rbp
+  803ecc:	48 83 ec 20          	sub    $0x20,%rsp
+  803ed0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803ed4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ed9:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ede:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803ee5:	00 00 00 
+  803ee8:	ff d0                	call   *%rax
+  803eea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803eed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ef1:	79 05                	jns    803ef8 <fs_stats+0x30>
+    return r;
+  803ef3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ef6:	eb 2a                	jmp    803f22 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803ef8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803efc:	ba 68 00 00 00       	mov    $0x68,%edx
+  803f01:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803f08:	00 00 00 
+  803f0b:	48 89 ce             	mov    %rcx,%rsi
+  803f0e:	48 89 c7             	mov    %rax,%rdi
+  803f11:	48 b8 ed 1a 80 00 00 	movabs $0x801aed,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+  return 0;
+  803f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f22:	c9                   	leave
+  803f23:	c3                   	ret
+
+0000000000803f24 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803f24:	55                   	push   %rbp
+  803f25:	48 89 e5             	mov    %rsp,%rbp
+  803f28:	48 83 ec 10          	sub    $0x10,%rsp
+  803f2c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803f2f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803f36:	00 00 00 
+  803f39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f3c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803f3e:	be 00 00 00 00       	mov    $0x0,%esi
+  803f43:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803f48:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803f4f:	00 00 00 
+  803f52:	ff d0                	call   *%rax
+}
+  803f54:	c9                   	leave
+  803f55:	c3                   	ret
+
+0000000000803f56 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803f56:	55                   	push   %rbp
+  803f57:	48 89 e5             	mov    %rsp,%rbp
+  803f5a:	48 83 ec 10          	sub    $0x10,%rsp
+  803f5e:	89 f8                	mov    %edi,%eax
+  803f60:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803f63:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803f67:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803f6e:	00 00 00 
+  803f71:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803f73:	be 00 00 00 00       	mov    $0x0,%esi
+  803f78:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803f7d:	48 b8 cc 39 80 00 00 	movabs $0x8039cc,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+}
+  803f89:	c9                   	leave
+  803f8a:	c3                   	ret
+
+0000000000803f8b <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803f8b:	55                   	push   %rbp
+  803f8c:	48 89 e5             	mov    %rsp,%rbp
+  803f8f:	48 83 ec 10          	sub    $0x10,%rsp
+  803f93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f9b:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803fa0:	48 89 c7             	mov    %rax,%rdi
+  803fa3:	48 b8 b1 3f 80 00 00 	movabs $0x803fb1,%rax
+  803faa:	00 00 00 
+  803fad:	ff d0                	call   *%rax
+}
+  803faf:	c9                   	leave
+  803fb0:	c3                   	ret
+
+0000000000803fb1 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803fb1:	55                   	push   %rbp
+  803fb2:	48 89 e5             	mov    %rsp,%rbp
+  803fb5:	48 83 ec 50          	sub    $0x50,%rsp
+  803fb9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803fbd:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803fc1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803fc8:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803fc9:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803fce:	74 0a                	je     803fda <pipe_size+0x29>
+  803fd0:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803fd7:	00 
+  803fd8:	76 0a                	jbe    803fe4 <pipe_size+0x33>
+    return -E_INVAL;
+  803fda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fdf:	e9 cc 02 00 00       	jmp    8042b0 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803fe4:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803fe8:	48 89 c7             	mov    %rax,%rdi
+  803feb:	48 b8 ad 2a 80 00 00 	movabs $0x802aad,%rax
+  803ff2:	00 00 00 
+  803ff5:	ff d0                	call   *%rax
+  803ff7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ffa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ffe:	0f 88 a8 02 00 00    	js     8042ac <pipe_size+0x2fb>
+  804004:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804008:	ba 07 04 00 00       	mov    $0x407,%edx
+  80400d:	48 89 c6             	mov    %rax,%rsi
+  804010:	bf 00 00 00 00       	mov    $0x0,%edi
+  804015:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  80401c:	00 00 00 
+  80401f:	ff d0                	call   *%rax
+  804021:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804024:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804028:	0f 88 7e 02 00 00    	js     8042ac <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80402e:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804032:	48 89 c7             	mov    %rax,%rdi
+  804035:	48 b8 ad 2a 80 00 00 	movabs $0x802aad,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+  804041:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804044:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804048:	0f 88 43 02 00 00    	js     804291 <pipe_size+0x2e0>
+  80404e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804052:	ba 07 04 00 00       	mov    $0x407,%edx
+  804057:	48 89 c6             	mov    %rax,%rsi
+  80405a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405f:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  804066:	00 00 00 
+  804069:	ff d0                	call   *%rax
+  80406b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80406e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804072:	0f 88 19 02 00 00    	js     804291 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80407c:	48 89 c7             	mov    %rax,%rdi
+  80407f:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  804086:	00 00 00 
+  804089:	ff d0                	call   *%rax
+  80408b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80408f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804096:	00 
+  804097:	e9 a2 00 00 00       	jmp    80413e <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80409c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040a0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8040a4:	48 89 c2             	mov    %rax,%rdx
+  8040a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ab:	48 01 d0             	add    %rdx,%rax
+  8040ae:	ba 07 04 00 00       	mov    $0x407,%edx
+  8040b3:	48 89 c6             	mov    %rax,%rsi
+  8040b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040bb:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  8040c2:	00 00 00 
+  8040c5:	ff d0                	call   *%rax
+  8040c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040ce:	0f 88 37 01 00 00    	js     80420b <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8040d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040d8:	48 89 c7             	mov    %rax,%rdi
+  8040db:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  8040e2:	00 00 00 
+  8040e5:	ff d0                	call   *%rax
+  8040e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040eb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8040ef:	48 01 c2             	add    %rax,%rdx
+  8040f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040f6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8040fa:	48 89 c1             	mov    %rax,%rcx
+  8040fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804101:	48 01 c8             	add    %rcx,%rax
+  804104:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80410a:	48 89 d1             	mov    %rdx,%rcx
+  80410d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804112:	48 89 c6             	mov    %rax,%rsi
+  804115:	bf 00 00 00 00       	mov    $0x0,%edi
+  80411a:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  804121:	00 00 00 
+  804124:	ff d0                	call   *%rax
+  804126:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804129:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80412d:	79 0a                	jns    804139 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80412f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804134:	e9 d3 00 00 00       	jmp    80420c <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804139:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80413e:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804145:	00 
+  804146:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80414a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80414e:	48 01 d0             	add    %rdx,%rax
+  804151:	48 83 c0 1f          	add    $0x1f,%rax
+  804155:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804159:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80415d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804162:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804166:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80416a:	48 29 d0             	sub    %rdx,%rax
+  80416d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804171:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804175:	0f 82 21 ff ff ff    	jb     80409c <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80417b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80417f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804183:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804187:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80418b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80418f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804193:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80419a:	00 00 00 
+  80419d:	8b 12                	mov    (%rdx),%edx
+  80419f:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8041a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041a5:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8041ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041b0:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8041b7:	00 00 00 
+  8041ba:	8b 12                	mov    (%rdx),%edx
+  8041bc:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8041be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041c2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8041c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041cd:	48 89 c7             	mov    %rax,%rdi
+  8041d0:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  8041d7:	00 00 00 
+  8041da:	ff d0                	call   *%rax
+  8041dc:	89 c2                	mov    %eax,%edx
+  8041de:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041e2:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8041e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041e8:	48 89 c7             	mov    %rax,%rdi
+  8041eb:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  8041f2:	00 00 00 
+  8041f5:	ff d0                	call   *%rax
+  8041f7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8041fb:	48 83 c2 04          	add    $0x4,%rdx
+  8041ff:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804201:	b8 00 00 00 00       	mov    $0x0,%eax
+  804206:	e9 a5 00 00 00       	jmp    8042b0 <pipe_size+0x2ff>
+      goto err2;
+  80420b:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80420c:	eb 58                	jmp    804266 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80420e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804212:	48 c1 e0 0c          	shl    $0xc,%rax
+  804216:	48 89 c2             	mov    %rax,%rdx
+  804219:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421d:	48 01 d0             	add    %rdx,%rax
+  804220:	48 89 c6             	mov    %rax,%rsi
+  804223:	bf 00 00 00 00       	mov    $0x0,%edi
+  804228:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  80422f:	00 00 00 
+  804232:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804234:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804238:	48 89 c7             	mov    %rax,%rdi
+  80423b:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  804242:	00 00 00 
+  804245:	ff d0                	call   *%rax
+  804247:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80424b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80424f:	48 01 d0             	add    %rdx,%rax
+  804252:	48 89 c6             	mov    %rax,%rsi
+  804255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80425a:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  804261:	00 00 00 
+  804264:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804266:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80426a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80426e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804272:	48 85 c0             	test   %rax,%rax
+  804275:	75 97                	jne    80420e <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804277:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80427b:	48 89 c6             	mov    %rax,%rsi
+  80427e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804283:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  80428a:	00 00 00 
+  80428d:	ff d0                	call   *%rax
+  80428f:	eb 01                	jmp    804292 <pipe_size+0x2e1>
+    goto err1;
+  804291:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804292:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804296:	48 89 c6             	mov    %rax,%rsi
+  804299:	bf 00 00 00 00       	mov    $0x0,%edi
+  80429e:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+  8042aa:	eb 01                	jmp    8042ad <pipe_size+0x2fc>
+    goto err;
+  8042ac:	90                   	nop
+err:
+  return r;
+  8042ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8042b0:	c9                   	leave
+  8042b1:	c3                   	ret
+
+00000000008042b2 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8042b2:	55                   	push   %rbp
+  8042b3:	48 89 e5             	mov    %rsp,%rbp
+  8042b6:	53                   	push   %rbx
+  8042b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8042bb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8042bf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8042c3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042ca:	00 00 00 
+  8042cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8042d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042d5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8042dc:	00 00 00 
+  8042df:	48 98                	cltq
+  8042e1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8042e8:	48 01 d0             	add    %rdx,%rax
+  8042eb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8042f1:	8b 00                	mov    (%rax),%eax
+  8042f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8042f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042fa:	48 89 c7             	mov    %rax,%rdi
+  8042fd:	48 b8 a3 51 80 00 00 	movabs $0x8051a3,%rax
+  804304:	00 00 00 
+  804307:	ff d0                	call   *%rax
+  804309:	89 c3                	mov    %eax,%ebx
+  80430b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80430f:	48 89 c7             	mov    %rax,%rdi
+  804312:	48 b8 a3 51 80 00 00 	movabs $0x8051a3,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+  80431e:	39 c3                	cmp    %eax,%ebx
+  804320:	0f 94 c0             	sete   %al
+  804323:	0f b6 c0             	movzbl %al,%eax
+  804326:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804329:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804330:	00 00 00 
+  804333:	8b 40 04             	mov    0x4(%rax),%eax
+  804336:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80433b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804342:	00 00 00 
+  804345:	48 98                	cltq
+  804347:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80434e:	48 01 d0             	add    %rdx,%rax
+  804351:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804357:	8b 00                	mov    (%rax),%eax
+  804359:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80435c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80435f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804362:	75 05                	jne    804369 <_pipeisclosed+0xb7>
+      return ret;
+  804364:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804367:	eb 68                	jmp    8043d1 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804369:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80436c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80436f:	0f 84 4e ff ff ff    	je     8042c3 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804375:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80437c:	00 00 00 
+  80437f:	8b 40 04             	mov    0x4(%rax),%eax
+  804382:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804387:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80438e:	00 00 00 
+  804391:	48 98                	cltq
+  804393:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80439a:	48 01 d0             	add    %rdx,%rax
+  80439d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8043a3:	8b 10                	mov    (%rax),%edx
+  8043a5:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8043a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043ab:	89 c6                	mov    %eax,%esi
+  8043ad:	48 b8 20 59 80 00 00 	movabs $0x805920,%rax
+  8043b4:	00 00 00 
+  8043b7:	48 89 c7             	mov    %rax,%rdi
+  8043ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bf:	49 b8 fa 05 80 00 00 	movabs $0x8005fa,%r8
+  8043c6:	00 00 00 
+  8043c9:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8043cc:	e9 f2 fe ff ff       	jmp    8042c3 <_pipeisclosed+0x11>
+  }
+}
+  8043d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043d5:	c9                   	leave
+  8043d6:	c3                   	ret
+
+00000000008043d7 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8043d7:	55                   	push   %rbp
+  8043d8:	48 89 e5             	mov    %rsp,%rbp
+  8043db:	48 83 ec 30          	sub    $0x30,%rsp
+  8043df:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8043e2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8043e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043e9:	48 89 d6             	mov    %rdx,%rsi
+  8043ec:	89 c7                	mov    %eax,%edi
+  8043ee:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  8043f5:	00 00 00 
+  8043f8:	ff d0                	call   *%rax
+  8043fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804401:	79 05                	jns    804408 <pipeisclosed+0x31>
+    return r;
+  804403:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804406:	eb 31                	jmp    804439 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80440c:	48 89 c7             	mov    %rax,%rdi
+  80440f:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+  80441b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80441f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804423:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804427:	48 89 d6             	mov    %rdx,%rsi
+  80442a:	48 89 c7             	mov    %rax,%rdi
+  80442d:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  804434:	00 00 00 
+  804437:	ff d0                	call   *%rax
+}
+  804439:	c9                   	leave
+  80443a:	c3                   	ret
+
+000000000080443b <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80443b:	55                   	push   %rbp
+  80443c:	48 89 e5             	mov    %rsp,%rbp
+  80443f:	48 83 ec 10          	sub    $0x10,%rsp
+  804443:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804447:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80444b:	8b 40 18             	mov    0x18(%rax),%eax
+  80444e:	8d 50 01             	lea    0x1(%rax),%edx
+  804451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804455:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80445c:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80445f:	85 c0                	test   %eax,%eax
+  804461:	74 27                	je     80448a <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804463:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804467:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80446e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804472:	48 83 c0 18          	add    $0x18,%rax
+  804476:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80447b:	48 89 c7             	mov    %rax,%rdi
+  80447e:	48 b8 73 27 80 00 00 	movabs $0x802773,%rax
+  804485:	00 00 00 
+  804488:	ff d0                	call   *%rax
+  }
+}
+  80448a:	90                   	nop
+  80448b:	c9                   	leave
+  80448c:	c3                   	ret
+
+000000000080448d <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80448d:	55                   	push   %rbp
+  80448e:	48 89 e5             	mov    %rsp,%rbp
+  804491:	48 83 ec 10          	sub    $0x10,%rsp
+  804495:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804499:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80449c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044a0:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8044a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044ab:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8044af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044b2:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8044b9:	89 c6                	mov    %eax,%esi
+  8044bb:	48 89 cf             	mov    %rcx,%rdi
+  8044be:	48 b8 24 27 80 00 00 	movabs $0x802724,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+}
+  8044ca:	90                   	nop
+  8044cb:	c9                   	leave
+  8044cc:	c3                   	ret
+
+00000000008044cd <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044cd:	55                   	push   %rbp
+  8044ce:	48 89 e5             	mov    %rsp,%rbp
+  8044d1:	48 83 ec 70          	sub    $0x70,%rsp
+  8044d5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8044d9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8044dd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8044e1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044e5:	48 89 c7             	mov    %rax,%rdi
+  8044e8:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+  8044f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8044f8:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8044fd:	75 0a                	jne    804509 <devpipe_read+0x3c>
+    return 0;
+  8044ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804504:	e9 63 01 00 00       	jmp    80466c <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804509:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80450d:	8b 40 18             	mov    0x18(%rax),%eax
+  804510:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804513:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804517:	48 8b 10             	mov    (%rax),%rdx
+  80451a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80451e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804522:	48 39 c2             	cmp    %rax,%rdx
+  804525:	75 42                	jne    804569 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804527:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80452b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80452f:	48 89 d6             	mov    %rdx,%rsi
+  804532:	48 89 c7             	mov    %rax,%rdi
+  804535:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  80453c:	00 00 00 
+  80453f:	ff d0                	call   *%rax
+  804541:	85 c0                	test   %eax,%eax
+  804543:	74 0a                	je     80454f <devpipe_read+0x82>
+      return 0;
+  804545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80454a:	e9 1d 01 00 00       	jmp    80466c <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80454f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804552:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804556:	89 d6                	mov    %edx,%esi
+  804558:	48 89 c7             	mov    %rax,%rdi
+  80455b:	48 b8 8d 44 80 00 00 	movabs $0x80448d,%rax
+  804562:	00 00 00 
+  804565:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804567:	eb a0                	jmp    804509 <devpipe_read+0x3c>
+      break;
+  804569:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80456a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80456e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804572:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804576:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80457a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80457e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804586:	48 8b 00             	mov    (%rax),%rax
+  804589:	48 29 c2             	sub    %rax,%rdx
+  80458c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804590:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804594:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804598:	48 39 c2             	cmp    %rax,%rdx
+  80459b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80459f:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8045a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a7:	48 8b 00             	mov    (%rax),%rax
+  8045aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045ae:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8045b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b7:	48 f7 f1             	div    %rcx
+  8045ba:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8045be:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8045c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ca:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045ce:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8045d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045d6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045de:	48 39 c2             	cmp    %rax,%rdx
+  8045e1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8045e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8045e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ed:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8045f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045f5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8045f9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804601:	48 89 ce             	mov    %rcx,%rsi
+  804604:	48 89 c7             	mov    %rax,%rdi
+  804607:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  80460e:	00 00 00 
+  804611:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804613:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804617:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80461b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80461f:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804623:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804627:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80462b:	48 01 d1             	add    %rdx,%rcx
+  80462e:	48 89 c2             	mov    %rax,%rdx
+  804631:	48 89 cf             	mov    %rcx,%rdi
+  804634:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  80463b:	00 00 00 
+  80463e:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804644:	48 8b 10             	mov    (%rax),%rdx
+  804647:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80464b:	48 01 c2             	add    %rax,%rdx
+  80464e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804652:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804659:	48 89 c7             	mov    %rax,%rdi
+  80465c:	48 b8 3b 44 80 00 00 	movabs $0x80443b,%rax
+  804663:	00 00 00 
+  804666:	ff d0                	call   *%rax
+  return n;
+  804668:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80466c:	c9                   	leave
+  80466d:	c3                   	ret
+
+000000000080466e <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80466e:	55                   	push   %rbp
+  80466f:	48 89 e5             	mov    %rsp,%rbp
+  804672:	48 83 ec 70          	sub    $0x70,%rsp
+  804676:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80467a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80467e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804682:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804686:	48 89 c7             	mov    %rax,%rdi
+  804689:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  804690:	00 00 00 
+  804693:	ff d0                	call   *%rax
+  804695:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804699:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80469d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8046a1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8046a8:	00 
+  8046a9:	e9 b8 01 00 00       	jmp    804866 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8046ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b2:	8b 40 18             	mov    0x18(%rax),%eax
+  8046b5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8046b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046bc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8046c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046c4:	48 8b 00             	mov    (%rax),%rax
+  8046c7:	48 29 c2             	sub    %rax,%rdx
+  8046ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8046d2:	48 39 c2             	cmp    %rax,%rdx
+  8046d5:	75 4d                	jne    804724 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8046d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046db:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8046df:	48 89 d6             	mov    %rdx,%rsi
+  8046e2:	48 89 c7             	mov    %rax,%rdi
+  8046e5:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  8046ec:	00 00 00 
+  8046ef:	ff d0                	call   *%rax
+  8046f1:	85 c0                	test   %eax,%eax
+  8046f3:	74 0a                	je     8046ff <devpipe_write+0x91>
+        return 0;
+  8046f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fa:	e9 79 01 00 00       	jmp    804878 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8046ff:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804706:	89 d6                	mov    %edx,%esi
+  804708:	48 89 c7             	mov    %rax,%rdi
+  80470b:	48 b8 8d 44 80 00 00 	movabs $0x80448d,%rax
+  804712:	00 00 00 
+  804715:	ff d0                	call   *%rax
+      m = 0;
+  804717:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80471e:	00 
+      continue;
+  80471f:	e9 3a 01 00 00       	jmp    80485e <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804724:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804728:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80472c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804734:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804738:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80473c:	48 8b 08             	mov    (%rax),%rcx
+  80473f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804743:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804747:	48 29 c1             	sub    %rax,%rcx
+  80474a:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80474e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804752:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804756:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80475a:	48 39 c2             	cmp    %rax,%rdx
+  80475d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804761:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804765:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804769:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80476d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804771:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804775:	ba 00 00 00 00       	mov    $0x0,%edx
+  80477a:	48 f7 f1             	div    %rcx
+  80477d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804785:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80478d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804791:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804795:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804799:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80479d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047a1:	48 39 c2             	cmp    %rax,%rdx
+  8047a4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8047a8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8047ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047b0:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8047b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047b8:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8047bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8047c0:	48 01 d1             	add    %rdx,%rcx
+  8047c3:	48 89 c2             	mov    %rax,%rdx
+  8047c6:	48 89 cf             	mov    %rcx,%rdi
+  8047c9:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  8047d0:	00 00 00 
+  8047d3:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8047d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047d9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047dd:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8047e1:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8047e5:	73 4d                	jae    804834 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8047e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047eb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8047f3:	48 29 c2             	sub    %rax,%rdx
+  8047f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047fa:	48 01 c2             	add    %rax,%rdx
+  8047fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804801:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804805:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804809:	48 89 c1             	mov    %rax,%rcx
+  80480c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804810:	48 01 c1             	add    %rax,%rcx
+  804813:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804817:	48 01 c1             	add    %rax,%rcx
+  80481a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80481e:	48 83 c0 20          	add    $0x20,%rax
+  804822:	48 89 ce             	mov    %rcx,%rsi
+  804825:	48 89 c7             	mov    %rax,%rdi
+  804828:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  80482f:	00 00 00 
+  804832:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804838:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80483c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804840:	48 01 c2             	add    %rax,%rdx
+  804843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804847:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80484b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80484f:	48 89 c7             	mov    %rax,%rdi
+  804852:	48 b8 3b 44 80 00 00 	movabs $0x80443b,%rax
+  804859:	00 00 00 
+  80485c:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80485e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804862:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80486a:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80486e:	0f 82 3a fe ff ff    	jb     8046ae <devpipe_write+0x40>
+  }
+
+  return i;
+  804874:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804878:	c9                   	leave
+  804879:	c3                   	ret
+
+000000000080487a <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80487a:	55                   	push   %rbp
+  80487b:	48 89 e5             	mov    %rsp,%rbp
+  80487e:	48 83 ec 40          	sub    $0x40,%rsp
+  804882:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804886:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804889:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80488d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804891:	48 89 c7             	mov    %rax,%rdi
+  804894:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  80489b:	00 00 00 
+  80489e:	ff d0                	call   *%rax
+  8048a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8048a4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8048ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048af:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8048b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048b7:	48 89 d6             	mov    %rdx,%rsi
+  8048ba:	48 89 c7             	mov    %rax,%rdi
+  8048bd:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  8048c4:	00 00 00 
+  8048c7:	ff d0                	call   *%rax
+  8048c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048d0:	79 08                	jns    8048da <devpipe_poll+0x60>
+    return r;
+  8048d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d5:	e9 85 00 00 00       	jmp    80495f <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8048da:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048dd:	83 e0 01             	and    $0x1,%eax
+  8048e0:	85 c0                	test   %eax,%eax
+  8048e2:	74 18                	je     8048fc <devpipe_poll+0x82>
+  8048e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e8:	48 8b 10             	mov    (%rax),%rdx
+  8048eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048ef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8048f3:	48 39 c2             	cmp    %rax,%rdx
+  8048f6:	74 04                	je     8048fc <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8048f8:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8048fc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048ff:	83 e0 02             	and    $0x2,%eax
+  804902:	85 c0                	test   %eax,%eax
+  804904:	74 23                	je     804929 <devpipe_poll+0xaf>
+  804906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80490a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80490e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804912:	48 8b 00             	mov    (%rax),%rax
+  804915:	48 29 c2             	sub    %rax,%rdx
+  804918:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80491c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804920:	48 39 c2             	cmp    %rax,%rdx
+  804923:	73 04                	jae    804929 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804925:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804929:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80492d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804931:	48 89 d6             	mov    %rdx,%rsi
+  804934:	48 89 c7             	mov    %rax,%rdi
+  804937:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  80493e:	00 00 00 
+  804941:	ff d0                	call   *%rax
+  804943:	85 c0                	test   %eax,%eax
+  804945:	74 04                	je     80494b <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804947:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80494b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80494f:	75 0b                	jne    80495c <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804951:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804955:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80495c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80495f:	c9                   	leave
+  804960:	c3                   	ret
+
+0000000000804961 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804961:	55                   	push   %rbp
+  804962:	48 89 e5             	mov    %rsp,%rbp
+  804965:	48 83 ec 20          	sub    $0x20,%rsp
+  804969:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80496d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804975:	48 89 c7             	mov    %rax,%rdi
+  804978:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  80497f:	00 00 00 
+  804982:	ff d0                	call   *%rax
+  804984:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804988:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80498c:	48 ba 51 59 80 00 00 	movabs $0x805951,%rdx
+  804993:	00 00 00 
+  804996:	48 89 d6             	mov    %rdx,%rsi
+  804999:	48 89 c7             	mov    %rax,%rdi
+  80499c:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  8049a3:	00 00 00 
+  8049a6:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8049a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049b0:	89 c1                	mov    %eax,%ecx
+  8049b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049b6:	48 8b 00             	mov    (%rax),%rax
+  8049b9:	89 c2                	mov    %eax,%edx
+  8049bb:	89 c8                	mov    %ecx,%eax
+  8049bd:	29 d0                	sub    %edx,%eax
+  8049bf:	89 c2                	mov    %eax,%edx
+  8049c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8049cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049cf:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8049d6:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8049d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049dd:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  8049e4:	00 00 00 
+  8049e7:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8049ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f3:	c9                   	leave
+  8049f4:	c3                   	ret
+
+00000000008049f5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8049f5:	55                   	push   %rbp
+  8049f6:	48 89 e5             	mov    %rsp,%rbp
+  8049f9:	48 83 ec 40          	sub    $0x40,%rsp
+  8049fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804a01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a05:	48 89 c7             	mov    %rax,%rdi
+  804a08:	48 b8 82 2a 80 00 00 	movabs $0x802a82,%rax
+  804a0f:	00 00 00 
+  804a12:	ff d0                	call   *%rax
+  804a14:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804a18:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804a1f:	00 
+  804a20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a24:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804a28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a2c:	48 01 d0             	add    %rdx,%rax
+  804a2f:	48 83 c0 1f          	add    $0x1f,%rax
+  804a33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804a37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a40:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804a44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a48:	48 29 d0             	sub    %rdx,%rax
+  804a4b:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a4f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804a53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a57:	48 89 c6             	mov    %rax,%rsi
+  804a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a5f:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  804a66:	00 00 00 
+  804a69:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804a6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a6f:	48 89 c7             	mov    %rax,%rdi
+  804a72:	48 b8 3b 44 80 00 00 	movabs $0x80443b,%rax
+  804a79:	00 00 00 
+  804a7c:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a82:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804a86:	eb 2f                	jmp    804ab7 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804a88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a8c:	48 83 e8 01          	sub    $0x1,%rax
+  804a90:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a94:	48 89 c2             	mov    %rax,%rdx
+  804a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a9b:	48 01 d0             	add    %rdx,%rax
+  804a9e:	48 89 c6             	mov    %rax,%rsi
+  804aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa6:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  804aad:	00 00 00 
+  804ab0:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804ab2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804ab7:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804abc:	77 ca                	ja     804a88 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804abe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ac2:	48 89 c6             	mov    %rax,%rsi
+  804ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aca:	48 b8 30 24 80 00 00 	movabs $0x802430,%rax
+  804ad1:	00 00 00 
+  804ad4:	ff d0                	call   *%rax
+}
+  804ad6:	c9                   	leave
+  804ad7:	c3                   	ret
+
+0000000000804ad8 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804ad8:	55                   	push   %rbp
+  804ad9:	48 89 e5             	mov    %rsp,%rbp
+  804adc:	48 83 ec 08          	sub    $0x8,%rsp
+  804ae0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804ae3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ae7:	75 10                	jne    804af9 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804ae9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804af0:	00 00 00 
+  804af3:	8b 00                	mov    (%rax),%eax
+  804af5:	48 98                	cltq
+  804af7:	eb 05                	jmp    804afe <vsyscall+0x26>
+  }
+  return 0;
+  804af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804afe:	c9                   	leave
+  804aff:	c3                   	ret
+
+0000000000804b00 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804b00:	55                   	push   %rbp
+  804b01:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804b04:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b09:	48 b8 d8 4a 80 00 00 	movabs $0x804ad8,%rax
+  804b10:	00 00 00 
+  804b13:	ff d0                	call   *%rax
+}
+  804b15:	5d                   	pop    %rbp
+  804b16:	c3                   	ret
+
+0000000000804b17 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804b17:	55                   	push   %rbp
+  804b18:	48 89 e5             	mov    %rsp,%rbp
+  804b1b:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804b1f:	0f 31                	rdtsc
+  804b21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b24:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804b27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b2a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b2d:	48 c1 e2 20          	shl    $0x20,%rdx
+  804b31:	48 09 d0             	or     %rdx,%rax
+  804b34:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804b38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804b3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804b40:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b47:	00 00 00 
+  804b4a:	8b 40 08             	mov    0x8(%rax),%eax
+  804b4d:	48 98                	cltq
+  804b4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804b53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b5c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b60:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b70:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b74:	48 89 d0             	mov    %rdx,%rax
+  804b77:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b83:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b87:	48 01 c8             	add    %rcx,%rax
+}
+  804b8a:	c9                   	leave
+  804b8b:	c3                   	ret
+
+0000000000804b8c <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804b8c:	55                   	push   %rbp
+  804b8d:	48 89 e5             	mov    %rsp,%rbp
+  804b90:	48 83 ec 20          	sub    $0x20,%rsp
+  804b94:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804b97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b9a:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804b9d:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804ba1:	be 01 00 00 00       	mov    $0x1,%esi
+  804ba6:	48 89 c7             	mov    %rax,%rdi
+  804ba9:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+}
+  804bb5:	90                   	nop
+  804bb6:	c9                   	leave
+  804bb7:	c3                   	ret
+
+0000000000804bb8 <getchar>:
+
+int
+getchar(void) {
+  804bb8:	55                   	push   %rbp
+  804bb9:	48 89 e5             	mov    %rsp,%rbp
+  804bbc:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804bc0:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804bc4:	ba 01 00 00 00       	mov    $0x1,%edx
+  804bc9:	48 89 c6             	mov    %rax,%rsi
+  804bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bd1:	48 b8 eb 30 80 00 00 	movabs $0x8030eb,%rax
+  804bd8:	00 00 00 
+  804bdb:	ff d0                	call   *%rax
+  804bdd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804be0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804be4:	79 05                	jns    804beb <getchar+0x33>
+    return r;
+  804be6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804be9:	eb 14                	jmp    804bff <getchar+0x47>
+  if (r < 1)
+  804beb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bef:	7f 07                	jg     804bf8 <getchar+0x40>
+    return -E_EOF;
+  804bf1:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804bf6:	eb 07                	jmp    804bff <getchar+0x47>
+  return c;
+  804bf8:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804bfc:	0f b6 c0             	movzbl %al,%eax
+}
+  804bff:	c9                   	leave
+  804c00:	c3                   	ret
+
+0000000000804c01 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804c01:	55                   	push   %rbp
+  804c02:	48 89 e5             	mov    %rsp,%rbp
+  804c05:	48 83 ec 20          	sub    $0x20,%rsp
+  804c09:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c0c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804c10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c13:	48 89 d6             	mov    %rdx,%rsi
+  804c16:	89 c7                	mov    %eax,%edi
+  804c18:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  804c1f:	00 00 00 
+  804c22:	ff d0                	call   *%rax
+  804c24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c2b:	79 05                	jns    804c32 <iscons+0x31>
+    return r;
+  804c2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c30:	eb 1a                	jmp    804c4c <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c36:	8b 10                	mov    (%rax),%edx
+  804c38:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804c3f:	00 00 00 
+  804c42:	8b 00                	mov    (%rax),%eax
+  804c44:	39 c2                	cmp    %eax,%edx
+  804c46:	0f 94 c0             	sete   %al
+  804c49:	0f b6 c0             	movzbl %al,%eax
+}
+  804c4c:	c9                   	leave
+  804c4d:	c3                   	ret
+
+0000000000804c4e <opencons>:
+
+int
+opencons(void) {
+  804c4e:	55                   	push   %rbp
+  804c4f:	48 89 e5             	mov    %rsp,%rbp
+  804c52:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804c56:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804c5a:	48 89 c7             	mov    %rax,%rdi
+  804c5d:	48 b8 ad 2a 80 00 00 	movabs $0x802aad,%rax
+  804c64:	00 00 00 
+  804c67:	ff d0                	call   *%rax
+  804c69:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c6c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c70:	79 05                	jns    804c77 <opencons+0x29>
+    return r;
+  804c72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c75:	eb 66                	jmp    804cdd <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804c77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c7b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c80:	48 89 c6             	mov    %rax,%rsi
+  804c83:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c88:	48 b8 78 23 80 00 00 	movabs $0x802378,%rax
+  804c8f:	00 00 00 
+  804c92:	ff d0                	call   *%rax
+  804c94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c9b:	79 05                	jns    804ca2 <opencons+0x54>
+    return r;
+  804c9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ca0:	eb 3b                	jmp    804cdd <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804ca2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ca6:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804cad:	00 00 00 
+  804cb0:	8b 12                	mov    (%rdx),%edx
+  804cb2:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804cb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cb8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804cbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cc3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804cca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cce:	48 89 c7             	mov    %rax,%rdi
+  804cd1:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  804cd8:	00 00 00 
+  804cdb:	ff d0                	call   *%rax
+}
+  804cdd:	c9                   	leave
+  804cde:	c3                   	ret
+
+0000000000804cdf <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804cdf:	55                   	push   %rbp
+  804ce0:	48 89 e5             	mov    %rsp,%rbp
+  804ce3:	48 83 ec 20          	sub    $0x20,%rsp
+  804ce7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804cea:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ced:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804cf1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cf4:	48 89 d6             	mov    %rdx,%rsi
+  804cf7:	89 c7                	mov    %eax,%edi
+  804cf9:	48 b8 8f 2b 80 00 00 	movabs $0x802b8f,%rax
+  804d00:	00 00 00 
+  804d03:	ff d0                	call   *%rax
+  804d05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d0c:	79 05                	jns    804d13 <consmode+0x34>
+    return r;
+  804d0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d11:	eb 34                	jmp    804d47 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804d13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d17:	8b 10                	mov    (%rax),%edx
+  804d19:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804d20:	00 00 00 
+  804d23:	8b 00                	mov    (%rax),%eax
+  804d25:	39 c2                	cmp    %eax,%edx
+  804d27:	74 07                	je     804d30 <consmode+0x51>
+    return -E_INVAL;
+  804d29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d2e:	eb 17                	jmp    804d47 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804d30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d34:	8b 40 0c             	mov    0xc(%rax),%eax
+  804d37:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804d3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d3e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d41:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804d44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d47:	c9                   	leave
+  804d48:	c3                   	ret
+
+0000000000804d49 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d49:	55                   	push   %rbp
+  804d4a:	48 89 e5             	mov    %rsp,%rbp
+  804d4d:	48 83 ec 20          	sub    $0x20,%rsp
+  804d51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d55:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d59:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804d5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d61:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d64:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d6c:	48 89 ce             	mov    %rcx,%rsi
+  804d6f:	48 89 c7             	mov    %rax,%rdi
+  804d72:	48 b8 d2 26 80 00 00 	movabs $0x8026d2,%rax
+  804d79:	00 00 00 
+  804d7c:	ff d0                	call   *%rax
+  804d7e:	48 98                	cltq
+}
+  804d80:	c9                   	leave
+  804d81:	c3                   	ret
+
+0000000000804d82 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d82:	55                   	push   %rbp
+  804d83:	48 89 e5             	mov    %rsp,%rbp
+  804d86:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804d8d:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804d94:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804d9b:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804da2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804da9:	eb 74                	jmp    804e1f <devcons_write+0x9d>
+    m = n - tot;
+  804dab:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804db2:	89 c2                	mov    %eax,%edx
+  804db4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804db7:	29 c2                	sub    %eax,%edx
+  804db9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804dbc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dbf:	83 f8 7f             	cmp    $0x7f,%eax
+  804dc2:	76 07                	jbe    804dcb <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804dc4:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804dcb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dce:	48 63 d0             	movslq %eax,%rdx
+  804dd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dd4:	48 63 c8             	movslq %eax,%rcx
+  804dd7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804dde:	48 01 c1             	add    %rax,%rcx
+  804de1:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804de8:	48 89 ce             	mov    %rcx,%rsi
+  804deb:	48 89 c7             	mov    %rax,%rdi
+  804dee:	48 b8 ed 1a 80 00 00 	movabs $0x801aed,%rax
+  804df5:	00 00 00 
+  804df8:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804dfa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dfd:	48 63 d0             	movslq %eax,%rdx
+  804e00:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804e07:	48 89 d6             	mov    %rdx,%rsi
+  804e0a:	48 89 c7             	mov    %rax,%rdi
+  804e0d:	48 b8 61 21 80 00 00 	movabs $0x802161,%rax
+  804e14:	00 00 00 
+  804e17:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804e19:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804e1c:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804e1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e22:	48 98                	cltq
+  804e24:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804e2b:	0f 82 7a ff ff ff    	jb     804dab <devcons_write+0x29>
+  }
+  return tot;
+  804e31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e34:	48 98                	cltq
+}
+  804e36:	c9                   	leave
+  804e37:	c3                   	ret
+
+0000000000804e38 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804e38:	55                   	push   %rbp
+  804e39:	48 89 e5             	mov    %rsp,%rbp
+  804e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  804e40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e49:	c9                   	leave
+  804e4a:	c3                   	ret
+
+0000000000804e4b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e4b:	55                   	push   %rbp
+  804e4c:	48 89 e5             	mov    %rsp,%rbp
+  804e4f:	48 83 ec 10          	sub    $0x10,%rsp
+  804e53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804e5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e5f:	48 ba 5d 59 80 00 00 	movabs $0x80595d,%rdx
+  804e66:	00 00 00 
+  804e69:	48 89 d6             	mov    %rdx,%rsi
+  804e6c:	48 89 c7             	mov    %rax,%rdi
+  804e6f:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  804e76:	00 00 00 
+  804e79:	ff d0                	call   *%rax
+  return 0;
+  804e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e80:	c9                   	leave
+  804e81:	c3                   	ret
+
+0000000000804e82 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804e82:	55                   	push   %rbp
+  804e83:	48 89 e5             	mov    %rsp,%rbp
+  804e86:	48 83 ec 30          	sub    $0x30,%rsp
+  804e8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e8e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804e91:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804e95:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804e9c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e9f:	83 e0 02             	and    $0x2,%eax
+  804ea2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804ea5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea9:	8b 40 0c             	mov    0xc(%rax),%eax
+  804eac:	83 f8 01             	cmp    $0x1,%eax
+  804eaf:	75 04                	jne    804eb5 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804eb1:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804eb5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804eb8:	83 e0 01             	and    $0x1,%eax
+  804ebb:	85 c0                	test   %eax,%eax
+  804ebd:	74 44                	je     804f03 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ebf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ec2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ec7:	89 c2                	mov    %eax,%edx
+  804ec9:	be 00 00 00 00       	mov    $0x0,%esi
+  804ece:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ed3:	48 b8 c0 27 80 00 00 	movabs $0x8027c0,%rax
+  804eda:	00 00 00 
+  804edd:	ff d0                	call   *%rax
+  804edf:	83 f8 01             	cmp    $0x1,%eax
+  804ee2:	75 06                	jne    804eea <devcons_poll+0x68>
+      revents |= POLLIN;
+  804ee4:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804ee8:	eb 19                	jmp    804f03 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804eea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804eee:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804ef4:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804ef7:	89 c2                	mov    %eax,%edx
+  804ef9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804efd:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804f03:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804f06:	c9                   	leave
+  804f07:	c3                   	ret
+
+0000000000804f08 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804f08:	55                   	push   %rbp
+  804f09:	48 89 e5             	mov    %rsp,%rbp
+  804f0c:	48 83 ec 20          	sub    $0x20,%rsp
+  804f10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804f18:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804f1c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f20:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804f24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f28:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804f2f:	48 89 c7             	mov    %rax,%rdi
+  804f32:	48 b8 40 4f 80 00 00 	movabs $0x804f40,%rax
+  804f39:	00 00 00 
+  804f3c:	ff d0                	call   *%rax
+}
+  804f3e:	c9                   	leave
+  804f3f:	c3                   	ret
+
+0000000000804f40 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804f40:	55                   	push   %rbp
+  804f41:	48 89 e5             	mov    %rsp,%rbp
+  804f44:	48 83 ec 30          	sub    $0x30,%rsp
+  804f48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804f4c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f50:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804f54:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804f58:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804f5d:	75 0e                	jne    804f6d <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804f5f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804f66:	00 00 00 
+  804f69:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804f6d:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804f72:	75 18                	jne    804f8c <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804f74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f78:	48 89 c7             	mov    %rax,%rdi
+  804f7b:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  804f82:	00 00 00 
+  804f85:	ff d0                	call   *%rax
+  804f87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f8a:	eb 1d                	jmp    804fa9 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804f8c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f94:	48 89 d6             	mov    %rdx,%rsi
+  804f97:	48 89 c7             	mov    %rax,%rdi
+  804f9a:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  804fa1:	00 00 00 
+  804fa4:	ff d0                	call   *%rax
+  804fa6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804fa9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fad:	79 2a                	jns    804fd9 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804faf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804fb4:	74 0a                	je     804fc0 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804fb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fba:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804fc0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804fc5:	74 0a                	je     804fd1 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804fc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fcb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804fd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fd4:	e9 aa 00 00 00       	jmp    805083 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804fd9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804fde:	74 36                	je     805016 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804fe0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fe7:	00 00 00 
+  804fea:	8b 40 04             	mov    0x4(%rax),%eax
+  804fed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ff2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ff9:	00 00 00 
+  804ffc:	48 98                	cltq
+  804ffe:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805005:	48 01 d0             	add    %rdx,%rax
+  805008:	48 05 24 01 00 00    	add    $0x124,%rax
+  80500e:	8b 10                	mov    (%rax),%edx
+  805010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805014:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805016:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80501b:	74 36                	je     805053 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80501d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805024:	00 00 00 
+  805027:	8b 40 04             	mov    0x4(%rax),%eax
+  80502a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80502f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805036:	00 00 00 
+  805039:	48 98                	cltq
+  80503b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805042:	48 01 d0             	add    %rdx,%rax
+  805045:	48 05 28 01 00 00    	add    $0x128,%rax
+  80504b:	8b 10                	mov    (%rax),%edx
+  80504d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805051:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805053:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80505a:	00 00 00 
+  80505d:	8b 40 04             	mov    0x4(%rax),%eax
+  805060:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805065:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80506c:	00 00 00 
+  80506f:	48 98                	cltq
+  805071:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805078:	48 01 d0             	add    %rdx,%rax
+  80507b:	48 05 20 01 00 00    	add    $0x120,%rax
+  805081:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805083:	c9                   	leave
+  805084:	c3                   	ret
+
+0000000000805085 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805085:	55                   	push   %rbp
+  805086:	48 89 e5             	mov    %rsp,%rbp
+  805089:	48 83 ec 30          	sub    $0x30,%rsp
+  80508d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805090:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805093:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805097:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80509a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80509f:	75 5e                	jne    8050ff <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8050a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8050a8:	00 00 00 
+  8050ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8050af:	eb 4e                	jmp    8050ff <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8050b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050b5:	79 3c                	jns    8050f3 <ipc_send+0x6e>
+  8050b7:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8050bb:	74 36                	je     8050f3 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8050bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050c0:	89 c1                	mov    %eax,%ecx
+  8050c2:	48 b8 68 59 80 00 00 	movabs $0x805968,%rax
+  8050c9:	00 00 00 
+  8050cc:	48 89 c2             	mov    %rax,%rdx
+  8050cf:	be 54 00 00 00       	mov    $0x54,%esi
+  8050d4:	48 b8 8e 59 80 00 00 	movabs $0x80598e,%rax
+  8050db:	00 00 00 
+  8050de:	48 89 c7             	mov    %rax,%rdi
+  8050e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e6:	49 b8 db 03 80 00 00 	movabs $0x8003db,%r8
+  8050ed:	00 00 00 
+  8050f0:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8050f3:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  8050fa:	00 00 00 
+  8050fd:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8050ff:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805102:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805105:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805109:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80510c:	89 c7                	mov    %eax,%edi
+  80510e:	48 b8 61 25 80 00 00 	movabs $0x802561,%rax
+  805115:	00 00 00 
+  805118:	ff d0                	call   *%rax
+  80511a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80511d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805121:	75 8e                	jne    8050b1 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805123:	48 b8 3b 23 80 00 00 	movabs $0x80233b,%rax
+  80512a:	00 00 00 
+  80512d:	ff d0                	call   *%rax
+}
+  80512f:	90                   	nop
+  805130:	c9                   	leave
+  805131:	c3                   	ret
+
+0000000000805132 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805132:	55                   	push   %rbp
+  805133:	48 89 e5             	mov    %rsp,%rbp
+  805136:	48 83 ec 18          	sub    $0x18,%rsp
+  80513a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  80513d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805144:	eb 4d                	jmp    805193 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805146:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80514d:	00 00 00 
+  805150:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805153:	48 98                	cltq
+  805155:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80515c:	48 01 d0             	add    %rdx,%rax
+  80515f:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805165:	8b 00                	mov    (%rax),%eax
+  805167:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80516a:	75 23                	jne    80518f <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80516c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805173:	00 00 00 
+  805176:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805179:	48 98                	cltq
+  80517b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805182:	48 01 d0             	add    %rdx,%rax
+  805185:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80518b:	8b 00                	mov    (%rax),%eax
+  80518d:	eb 12                	jmp    8051a1 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80518f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805193:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80519a:	7e aa                	jle    805146 <ipc_find_env+0x14>
+  return 0;
+  80519c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051a1:	c9                   	leave
+  8051a2:	c3                   	ret
+
+00000000008051a3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8051a3:	55                   	push   %rbp
+  8051a4:	48 89 e5             	mov    %rsp,%rbp
+  8051a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8051ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8051af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051b3:	48 c1 e8 27          	shr    $0x27,%rax
+  8051b7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8051bc:	48 89 c2             	mov    %rax,%rdx
+  8051bf:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8051c6:	01 00 00 
+  8051c9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051cd:	83 e0 01             	and    $0x1,%eax
+  8051d0:	48 85 c0             	test   %rax,%rax
+  8051d3:	74 63                	je     805238 <pageref+0x95>
+  8051d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8051dd:	48 89 c2             	mov    %rax,%rdx
+  8051e0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8051e7:	01 00 00 
+  8051ea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051ee:	83 e0 01             	and    $0x1,%eax
+  8051f1:	48 85 c0             	test   %rax,%rax
+  8051f4:	74 42                	je     805238 <pageref+0x95>
+  8051f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051fa:	48 c1 e8 15          	shr    $0x15,%rax
+  8051fe:	48 89 c2             	mov    %rax,%rdx
+  805201:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805208:	01 00 00 
+  80520b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80520f:	83 e0 01             	and    $0x1,%eax
+  805212:	48 85 c0             	test   %rax,%rax
+  805215:	74 21                	je     805238 <pageref+0x95>
+  805217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80521b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80521f:	48 89 c2             	mov    %rax,%rdx
+  805222:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805229:	01 00 00 
+  80522c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805230:	83 e0 01             	and    $0x1,%eax
+  805233:	48 85 c0             	test   %rax,%rax
+  805236:	75 07                	jne    80523f <pageref+0x9c>
+    return 0;
+  805238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80523d:	eb 53                	jmp    805292 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  80523f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805243:	48 c1 e8 0c          	shr    $0xc,%rax
+  805247:	48 89 c2             	mov    %rax,%rdx
+  80524a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805251:	01 00 00 
+  805254:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805258:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  80525c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805260:	83 e0 01             	and    $0x1,%eax
+  805263:	48 85 c0             	test   %rax,%rax
+  805266:	75 07                	jne    80526f <pageref+0xcc>
+    return 0;
+  805268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526d:	eb 23                	jmp    805292 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80526f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805273:	48 c1 e8 0c          	shr    $0xc,%rax
+  805277:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80527e:	00 00 00 
+  805281:	48 c1 e0 04          	shl    $0x4,%rax
+  805285:	48 01 d0             	add    %rdx,%rax
+  805288:	48 83 c0 08          	add    $0x8,%rax
+  80528c:	0f b7 00             	movzwl (%rax),%eax
+  80528f:	0f b7 c0             	movzwl %ax,%eax
+}
+  805292:	c9                   	leave
+  805293:	c3                   	ret
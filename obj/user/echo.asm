@@ -0,0 +1,8120 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 22 01 00 00       	call   80014e <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, nflag;
+
+  nflag = 0;
+  800041:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800048:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  80004c:	7e 3b                	jle    800089 <umain+0x57>
+  80004e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800052:	48 83 c0 08          	add    $0x8,%rax
+  800056:	48 8b 00             	mov    (%rax),%rax
+  800059:	48 ba c0 50 80 00 00 	movabs $0x8050c0,%rdx
+  800060:	00 00 00 
+  800063:	48 89 d6             	mov    %rdx,%rsi
+  800066:	48 89 c7             	mov    %rax,%rdi
+  800069:	48 b8 49 09 80 00 00 	movabs $0x800949,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	85 c0                	test   %eax,%eax
+  800077:	75 10                	jne    800089 <umain+0x57>
+    nflag = 1;
+  800079:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    argc--;
+  800080:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+    argv++;
+  800084:	48 83 45 e0 08       	addq   $0x8,-0x20(%rbp)
+  }
+  for (i = 1; i < argc; i++) {
+  800089:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  800090:	e9 81 00 00 00       	jmp    800116 <umain+0xe4>
+    if (i > 1)
+  800095:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+  800099:	7e 23                	jle    8000be <umain+0x8c>
+      write(1, " ", 1);
+  80009b:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000a0:	48 b8 c3 50 80 00 00 	movabs $0x8050c3,%rax
+  8000a7:	00 00 00 
+  8000aa:	48 89 c6             	mov    %rax,%rsi
+  8000ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000b2:	48 b8 bb 23 80 00 00 	movabs $0x8023bb,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+    write(1, argv[i], strlen(argv[i]));
+  8000be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c1:	48 98                	cltq
+  8000c3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8000ca:	00 
+  8000cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000cf:	48 01 d0             	add    %rdx,%rax
+  8000d2:	48 8b 00             	mov    (%rax),%rax
+  8000d5:	48 89 c7             	mov    %rax,%rdi
+  8000d8:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	48 63 d0             	movslq %eax,%rdx
+  8000e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000ea:	48 98                	cltq
+  8000ec:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8000f3:	00 
+  8000f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000f8:	48 01 c8             	add    %rcx,%rax
+  8000fb:	48 8b 00             	mov    (%rax),%rax
+  8000fe:	48 89 c6             	mov    %rax,%rsi
+  800101:	bf 01 00 00 00       	mov    $0x1,%edi
+  800106:	48 b8 bb 23 80 00 00 	movabs $0x8023bb,%rax
+  80010d:	00 00 00 
+  800110:	ff d0                	call   *%rax
+  for (i = 1; i < argc; i++) {
+  800112:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800116:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800119:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  80011c:	0f 8c 73 ff ff ff    	jl     800095 <umain+0x63>
+  }
+  if (!nflag)
+  800122:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800126:	75 23                	jne    80014b <umain+0x119>
+    write(1, "\n", 1);
+  800128:	ba 01 00 00 00       	mov    $0x1,%edx
+  80012d:	48 b8 c5 50 80 00 00 	movabs $0x8050c5,%rax
+  800134:	00 00 00 
+  800137:	48 89 c6             	mov    %rax,%rsi
+  80013a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80013f:	48 b8 bb 23 80 00 00 	movabs $0x8023bb,%rax
+  800146:	00 00 00 
+  800149:	ff d0                	call   *%rax
+}
+  80014b:	90                   	nop
+  80014c:	c9                   	leave
+  80014d:	c3                   	ret
+
+000000000080014e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80014e:	55                   	push   %rbp
+  80014f:	48 89 e5             	mov    %rsp,%rbp
+  800152:	48 83 ec 20          	sub    $0x20,%rsp
+  800156:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800159:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80015d:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800164:	00 00 00 
+  800167:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80016b:	eb 13                	jmp    800180 <libmain+0x32>
+    (*ctor)();
+  80016d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800171:	48 8b 10             	mov    (%rax),%rdx
+  800174:	b8 00 00 00 00       	mov    $0x0,%eax
+  800179:	ff d2                	call   *%rdx
+    ctor++;
+  80017b:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800180:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800187:	00 00 00 
+  80018a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80018e:	72 dd                	jb     80016d <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800190:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800194:	7e 14                	jle    8001aa <libmain+0x5c>
+    binaryname = argv[0];
+  800196:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80019a:	48 8b 00             	mov    (%rax),%rax
+  80019d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8001a4:	00 00 00 
+  8001a7:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001b1:	48 89 d6             	mov    %rdx,%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001c2:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+#endif
+}
+  8001ce:	90                   	nop
+  8001cf:	c9                   	leave
+  8001d0:	c3                   	ret
+
+00000000008001d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d1:	55                   	push   %rbp
+  8001d2:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001d5:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e6:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  8001ed:	00 00 00 
+  8001f0:	ff d0                	call   *%rax
+}
+  8001f2:	90                   	nop
+  8001f3:	5d                   	pop    %rbp
+  8001f4:	c3                   	ret
+
+00000000008001f5 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8001f5:	55                   	push   %rbp
+  8001f6:	48 89 e5             	mov    %rsp,%rbp
+  8001f9:	53                   	push   %rbx
+  8001fa:	48 83 ec 38          	sub    $0x38,%rsp
+  8001fe:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800201:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800205:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800209:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80020d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800211:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800214:	ba 00 00 00 00       	mov    $0x0,%edx
+  800219:	89 d1                	mov    %edx,%ecx
+  80021b:	0f a2                	cpuid
+  80021d:	89 de                	mov    %ebx,%esi
+  80021f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800222:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800225:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800228:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  80022b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800230:	74 09                	je     80023b <cpuid+0x46>
+}
+  800232:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800236:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800239:	89 10                	mov    %edx,(%rax)
+
+  80023b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800240:	74 09                	je     80024b <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800242:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800246:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800249:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80024b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800250:	74 09                	je     80025b <cpuid+0x66>
+char *
+  800252:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800256:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800259:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80025b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800260:	74 09                	je     80026b <cpuid+0x76>
+  for (; *s; s++)
+  800262:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800266:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800269:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80026b:	90                   	nop
+  80026c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+0000000000800272 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800272:	55                   	push   %rbp
+  800273:	48 89 e5             	mov    %rsp,%rbp
+  800276:	48 83 ec 18          	sub    $0x18,%rsp
+  80027a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80027d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800280:	89 c1                	mov    %eax,%ecx
+  800282:	0f 01 d0             	xgetbv
+  800285:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800288:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80028b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80028e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800291:	48 c1 e2 20          	shl    $0x20,%rdx
+  800295:	48 09 d0             	or     %rdx,%rax
+#else
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+000000000080029a <string_cpu>:
+string_cpu(void) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+  80029e:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8002a2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8002a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8002b0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8002b7:	00 00 00 
+  8002ba:	8b 00                	mov    (%rax),%eax
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	78 11                	js     8002d1 <string_cpu+0x37>
+    return string_features;
+  8002c0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8002c7:	00 00 00 
+  8002ca:	8b 00                	mov    (%rax),%eax
+  8002cc:	e9 df 00 00 00       	jmp    8003b0 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8002d1:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8002d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e5:	48 89 c6             	mov    %rax,%rsi
+  8002e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ed:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  8002f4:	00 00 00 
+  8002f7:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8002f9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002fc:	83 f8 06             	cmp    $0x6,%eax
+  8002ff:	76 28                	jbe    800329 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800301:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800305:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80030b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800310:	48 89 c2             	mov    %rax,%rdx
+  800313:	be 00 00 00 00       	mov    $0x0,%esi
+  800318:	bf 07 00 00 00       	mov    $0x7,%edi
+  80031d:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800329:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80032c:	25 00 02 00 00       	and    $0x200,%eax
+  800331:	85 c0                	test   %eax,%eax
+  800333:	74 04                	je     800339 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800335:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800339:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80033d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800343:	48 89 c1             	mov    %rax,%rcx
+  800346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034b:	be 00 00 00 00       	mov    $0x0,%esi
+  800350:	bf 01 00 00 00       	mov    $0x1,%edi
+  800355:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  80035c:	00 00 00 
+  80035f:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800361:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800364:	83 e0 20             	and    $0x20,%eax
+  800367:	85 c0                	test   %eax,%eax
+  800369:	74 2a                	je     800395 <string_cpu+0xfb>
+  80036b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80036e:	25 00 00 00 08       	and    $0x8000000,%eax
+  800373:	85 c0                	test   %eax,%eax
+  800375:	74 1e                	je     800395 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80037c:	48 b8 72 02 80 00 00 	movabs $0x800272,%rax
+  800383:	00 00 00 
+  800386:	ff d0                	call   *%rax
+  800388:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80038b:	48 83 f8 06          	cmp    $0x6,%rax
+  80038f:	75 04                	jne    800395 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800391:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800395:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  80039c:	00 00 00 
+  80039f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003a2:	89 02                	mov    %eax,(%rdx)
+  8003a4:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8003ab:	00 00 00 
+  8003ae:	8b 00                	mov    (%rax),%eax
+}
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+00000000008003b2 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8003ba:	48 83 ec 60          	sub    $0x60,%rsp
+  8003be:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8003c3:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8003c8:	83 e0 1f             	and    $0x1f,%eax
+  8003cb:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8003cf:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8003d3:	48 f7 d8             	neg    %rax
+  8003d6:	48 89 c2             	mov    %rax,%rdx
+  8003d9:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8003de:	48 01 d0             	add    %rdx,%rax
+  8003e1:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8003e6:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8003ea:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8003f0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8003f5:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8003f9:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8003ff:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800403:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800407:	89 c2                	mov    %eax,%edx
+  800409:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80040d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800412:	89 c1                	mov    %eax,%ecx
+  800414:	d3 e6                	shl    %cl,%esi
+  800416:	89 f0                	mov    %esi,%eax
+  800418:	21 d0                	and    %edx,%eax
+  80041a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80041e:	eb 21                	jmp    800441 <strlen_avx2+0x8f>
+    p += 32;
+  800420:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800426:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80042b:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80042f:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800435:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800439:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80043d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800441:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800446:	74 d8                	je     800420 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800448:	31 c0                	xor    %eax,%eax
+  80044a:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800450:	48 63 d0             	movslq %eax,%rdx
+  800453:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800458:	48 01 d0             	add    %rdx,%rax
+  80045b:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800460:	c9                   	leave
+  800461:	c3                   	ret
+
+0000000000800462 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800462:	55                   	push   %rbp
+  800463:	48 89 e5             	mov    %rsp,%rbp
+  800466:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80046a:	48 83 ec 40          	sub    $0x40,%rsp
+  80046e:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800473:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800478:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80047d:	eb 77                	jmp    8004f6 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80047f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800484:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800488:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80048c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800491:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800495:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800499:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80049d:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8004a1:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8004a6:	74 3c                	je     8004e4 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8004a8:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8004ac:	f7 d0                	not    %eax
+  8004ae:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8004b2:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8004b6:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8004ba:	48 63 d0             	movslq %eax,%rdx
+  8004bd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8004c2:	48 01 d0             	add    %rdx,%rax
+  8004c5:	0f b6 00             	movzbl (%rax),%eax
+  8004c8:	0f b6 c0             	movzbl %al,%eax
+  8004cb:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8004cf:	48 63 ca             	movslq %edx,%rcx
+  8004d2:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8004d7:	48 01 ca             	add    %rcx,%rdx
+  8004da:	0f b6 12             	movzbl (%rdx),%edx
+  8004dd:	0f b6 d2             	movzbl %dl,%edx
+  8004e0:	29 d0                	sub    %edx,%eax
+  8004e2:	eb 6b                	jmp    80054f <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8004e4:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8004ea:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8004f0:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8004f6:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8004fc:	77 81                	ja     80047f <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8004fe:	eb 42                	jmp    800542 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800500:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800505:	0f b6 10             	movzbl (%rax),%edx
+  800508:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80050d:	0f b6 00             	movzbl (%rax),%eax
+  800510:	38 c2                	cmp    %al,%dl
+  800512:	74 1c                	je     800530 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800514:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800519:	0f b6 00             	movzbl (%rax),%eax
+  80051c:	0f b6 c8             	movzbl %al,%ecx
+  80051f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800524:	0f b6 00             	movzbl (%rax),%eax
+  800527:	0f b6 d0             	movzbl %al,%edx
+  80052a:	89 c8                	mov    %ecx,%eax
+  80052c:	29 d0                	sub    %edx,%eax
+  80052e:	eb 1f                	jmp    80054f <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  800530:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  800536:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80053c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  800542:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  800548:	75 b6                	jne    800500 <memcmp_avx2+0x9e>
+  return 0;
+  80054a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80054f:	c9                   	leave
+  800550:	c3                   	ret
+
+0000000000800551 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800559:	48 83 ec 60          	sub    $0x60,%rsp
+  80055d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800562:	89 f0                	mov    %esi,%eax
+  800564:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  800569:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80056d:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  800572:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  800576:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80057b:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  800581:	eb 47                	jmp    8005ca <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  800583:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800588:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80058c:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800590:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  800596:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80059a:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80059e:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8005a2:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8005a7:	74 15                	je     8005be <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8005a9:	31 c0                	xor    %eax,%eax
+  8005ab:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8005b1:	48 63 d0             	movslq %eax,%rdx
+  8005b4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8005b9:	48 01 d0             	add    %rdx,%rax
+  8005bc:	eb 3d                	jmp    8005fb <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8005be:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8005c4:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8005ca:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8005d0:	77 b1                	ja     800583 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8005d2:	eb 0c                	jmp    8005e0 <memfind_avx2+0x8f>
+  8005d4:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8005da:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8005e0:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8005e6:	74 0e                	je     8005f6 <memfind_avx2+0xa5>
+  8005e8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8005ed:	0f b6 00             	movzbl (%rax),%eax
+  8005f0:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8005f4:	75 de                	jne    8005d4 <memfind_avx2+0x83>
+  return s;
+  8005f6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8005fb:	c9                   	leave
+  8005fc:	c3                   	ret
+
+00000000008005fd <strlen>:
+strlen(const char *s) {
+  8005fd:	55                   	push   %rbp
+  8005fe:	48 89 e5             	mov    %rsp,%rbp
+  800601:	48 83 ec 40          	sub    $0x40,%rsp
+  800605:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  800609:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80060d:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  800611:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800618:	00 00 00 
+  80061b:	ff d0                	call   *%rax
+  80061d:	83 e0 02             	and    $0x2,%eax
+  800620:	85 c0                	test   %eax,%eax
+  800622:	74 18                	je     80063c <strlen+0x3f>
+    return strlen_avx2(s);
+  800624:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800628:	48 89 c7             	mov    %rax,%rdi
+  80062b:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  800632:	00 00 00 
+  800635:	ff d0                	call   *%rax
+  800637:	e9 82 00 00 00       	jmp    8006be <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80063c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800640:	83 e0 0f             	and    $0xf,%eax
+  800643:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  800646:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800649:	48 f7 d8             	neg    %rax
+  80064c:	48 89 c2             	mov    %rax,%rdx
+  80064f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800653:	48 01 d0             	add    %rdx,%rax
+  800656:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80065a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80065e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800662:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  800667:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80066b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800674:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800679:	89 c1                	mov    %eax,%ecx
+  80067b:	d3 e6                	shl    %cl,%esi
+  80067d:	89 f0                	mov    %esi,%eax
+  80067f:	21 d0                	and    %edx,%eax
+  800681:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800684:	eb 1d                	jmp    8006a3 <strlen+0xa6>
+    p += 16;
+  800686:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80068b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80068f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800693:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  800698:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80069c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8006a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8006a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8006a7:	74 dd                	je     800686 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8006a9:	31 c0                	xor    %eax,%eax
+  8006ab:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8006b0:	48 63 d0             	movslq %eax,%rdx
+  8006b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006b7:	48 01 d0             	add    %rdx,%rax
+  8006ba:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8006be:	c9                   	leave
+  8006bf:	c3                   	ret
+
+00000000008006c0 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8006c0:	55                   	push   %rbp
+  8006c1:	48 89 e5             	mov    %rsp,%rbp
+  8006c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8006c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8006d7:	eb 0e                	jmp    8006e7 <strnlen+0x27>
+    n++;
+  8006d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8006dd:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8006e2:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8006e7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8006ec:	74 0b                	je     8006f9 <strnlen+0x39>
+  8006ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f2:	0f b6 00             	movzbl (%rax),%eax
+  8006f5:	84 c0                	test   %al,%al
+  8006f7:	75 e0                	jne    8006d9 <strnlen+0x19>
+  return n;
+  8006f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+00000000008006fe <strcpy>:
+strcpy(char *dst, const char *src) {
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	48 83 ec 20          	sub    $0x20,%rsp
+  800706:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80070a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80070e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800712:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  800716:	90                   	nop
+  800717:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80071b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80071f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800723:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800727:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80072b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80072f:	0f b6 12             	movzbl (%rdx),%edx
+  800732:	88 10                	mov    %dl,(%rax)
+  800734:	0f b6 00             	movzbl (%rax),%eax
+  800737:	84 c0                	test   %al,%al
+  800739:	75 dc                	jne    800717 <strcpy+0x19>
+  return ret;
+  80073b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80073f:	c9                   	leave
+  800740:	c3                   	ret
+
+0000000000800741 <strcat>:
+strcat(char *dst, const char *src) {
+  800741:	55                   	push   %rbp
+  800742:	48 89 e5             	mov    %rsp,%rbp
+  800745:	48 83 ec 20          	sub    $0x20,%rsp
+  800749:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80074d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  800751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800755:	48 89 c7             	mov    %rax,%rdi
+  800758:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  80075f:	00 00 00 
+  800762:	ff d0                	call   *%rax
+  800764:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  800767:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80076a:	48 63 d0             	movslq %eax,%rdx
+  80076d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800771:	48 01 c2             	add    %rax,%rdx
+  800774:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800778:	48 89 c6             	mov    %rax,%rsi
+  80077b:	48 89 d7             	mov    %rdx,%rdi
+  80077e:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  800785:	00 00 00 
+  800788:	ff d0                	call   *%rax
+  return dst;
+  80078a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80078e:	c9                   	leave
+  80078f:	c3                   	ret
+
+0000000000800790 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  800790:	55                   	push   %rbp
+  800791:	48 89 e5             	mov    %rsp,%rbp
+  800794:	48 83 ec 28          	sub    $0x28,%rsp
+  800798:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80079c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8007a0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8007a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8007ac:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8007b3:	00 
+  8007b4:	eb 2a                	jmp    8007e0 <strncpy+0x50>
+    *dst++ = *src;
+  8007b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8007c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007c6:	0f b6 12             	movzbl (%rdx),%edx
+  8007c9:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8007cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007cf:	0f b6 00             	movzbl (%rax),%eax
+  8007d2:	84 c0                	test   %al,%al
+  8007d4:	74 05                	je     8007db <strncpy+0x4b>
+      src++;
+  8007d6:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8007db:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8007e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e4:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8007e8:	72 cc                	jb     8007b6 <strncpy+0x26>
+  return ret;
+  8007ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8007ee:	c9                   	leave
+  8007ef:	c3                   	ret
+
+00000000008007f0 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8007f0:	55                   	push   %rbp
+  8007f1:	48 89 e5             	mov    %rsp,%rbp
+  8007f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8007f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800800:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  800804:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800808:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80080c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800811:	74 3d                	je     800850 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  800813:	eb 1d                	jmp    800832 <strlcpy+0x42>
+      *dst++ = *src++;
+  800815:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800819:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80081d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800825:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800829:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80082d:	0f b6 12             	movzbl (%rdx),%edx
+  800830:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  800832:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  800837:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80083c:	74 0b                	je     800849 <strlcpy+0x59>
+  80083e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800842:	0f b6 00             	movzbl (%rax),%eax
+  800845:	84 c0                	test   %al,%al
+  800847:	75 cc                	jne    800815 <strlcpy+0x25>
+    *dst = '\0';
+  800849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084d:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  800850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800854:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  800858:	c9                   	leave
+  800859:	c3                   	ret
+
+000000000080085a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+  80085e:	48 83 ec 30          	sub    $0x30,%rsp
+  800862:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800866:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80086a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80086e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800872:	48 89 c7             	mov    %rax,%rdi
+  800875:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+  800881:	48 98                	cltq
+  800883:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  800887:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80088b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80088f:	48 89 d6             	mov    %rdx,%rsi
+  800892:	48 89 c7             	mov    %rax,%rdi
+  800895:	48 b8 c0 06 80 00 00 	movabs $0x8006c0,%rax
+  80089c:	00 00 00 
+  80089f:	ff d0                	call   *%rax
+  8008a1:	48 98                	cltq
+  8008a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8008a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008ab:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8008af:	75 10                	jne    8008c1 <strlcat+0x67>
+    return maxlen + srclen;
+  8008b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8008b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b9:	48 01 d0             	add    %rdx,%rax
+  8008bc:	e9 86 00 00 00       	jmp    800947 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8008c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008c5:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8008c9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8008cd:	73 2b                	jae    8008fa <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8008cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008d7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008df:	48 01 c1             	add    %rax,%rcx
+  8008e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008e6:	48 89 c6             	mov    %rax,%rsi
+  8008e9:	48 89 cf             	mov    %rcx,%rdi
+  8008ec:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  8008f3:	00 00 00 
+  8008f6:	ff d0                	call   *%rax
+  8008f8:	eb 42                	jmp    80093c <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8008fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008fe:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800902:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80090a:	48 01 c1             	add    %rax,%rcx
+  80090d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800911:	48 89 c6             	mov    %rax,%rsi
+  800914:	48 89 cf             	mov    %rcx,%rdi
+  800917:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  800923:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800927:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80092b:	48 01 d0             	add    %rdx,%rax
+  80092e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800932:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800936:	48 01 d0             	add    %rdx,%rax
+  800939:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80093c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800944:	48 01 d0             	add    %rdx,%rax
+}
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+0000000000800949 <strcmp>:
+strcmp(const char *p, const char *q) {
+  800949:	55                   	push   %rbp
+  80094a:	48 89 e5             	mov    %rsp,%rbp
+  80094d:	48 83 ec 10          	sub    $0x10,%rsp
+  800951:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800955:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  800959:	eb 0a                	jmp    800965 <strcmp+0x1c>
+    p++, q++;
+  80095b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800960:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  800965:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800969:	0f b6 00             	movzbl (%rax),%eax
+  80096c:	84 c0                	test   %al,%al
+  80096e:	74 12                	je     800982 <strcmp+0x39>
+  800970:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800974:	0f b6 10             	movzbl (%rax),%edx
+  800977:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80097b:	0f b6 00             	movzbl (%rax),%eax
+  80097e:	38 c2                	cmp    %al,%dl
+  800980:	74 d9                	je     80095b <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800986:	0f b6 00             	movzbl (%rax),%eax
+  800989:	0f b6 d0             	movzbl %al,%edx
+  80098c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800990:	0f b6 00             	movzbl (%rax),%eax
+  800993:	0f b6 c0             	movzbl %al,%eax
+  800996:	29 c2                	sub    %eax,%edx
+  800998:	89 d0                	mov    %edx,%eax
+}
+  80099a:	c9                   	leave
+  80099b:	c3                   	ret
+
+000000000080099c <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80099c:	55                   	push   %rbp
+  80099d:	48 89 e5             	mov    %rsp,%rbp
+  8009a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8009a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8009b0:	eb 0f                	jmp    8009c1 <strncmp+0x25>
+    n--, p++, q++;
+  8009b2:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8009b7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8009bc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8009c1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8009c6:	74 1d                	je     8009e5 <strncmp+0x49>
+  8009c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cc:	0f b6 00             	movzbl (%rax),%eax
+  8009cf:	84 c0                	test   %al,%al
+  8009d1:	74 12                	je     8009e5 <strncmp+0x49>
+  8009d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d7:	0f b6 10             	movzbl (%rax),%edx
+  8009da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009de:	0f b6 00             	movzbl (%rax),%eax
+  8009e1:	38 c2                	cmp    %al,%dl
+  8009e3:	74 cd                	je     8009b2 <strncmp+0x16>
+  if (n == 0)
+  8009e5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8009ea:	75 07                	jne    8009f3 <strncmp+0x57>
+    return 0;
+  8009ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f1:	eb 16                	jmp    800a09 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8009f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f7:	0f b6 00             	movzbl (%rax),%eax
+  8009fa:	0f b6 d0             	movzbl %al,%edx
+  8009fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a01:	0f b6 00             	movzbl (%rax),%eax
+  800a04:	0f b6 c0             	movzbl %al,%eax
+  800a07:	29 c2                	sub    %eax,%edx
+}
+  800a09:	89 d0                	mov    %edx,%eax
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+
+0000000000800a0d <strchr>:
+strchr(const char *s, char c) {
+  800a0d:	55                   	push   %rbp
+  800a0e:	48 89 e5             	mov    %rsp,%rbp
+  800a11:	48 83 ec 60          	sub    $0x60,%rsp
+  800a15:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800a19:	89 f0                	mov    %esi,%eax
+  800a1b:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  800a1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a22:	83 e0 0f             	and    $0xf,%eax
+  800a25:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  800a28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800a2b:	48 f7 d8             	neg    %rax
+  800a2e:	48 89 c2             	mov    %rax,%rdx
+  800a31:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a35:	48 01 d0             	add    %rdx,%rax
+  800a38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  800a3c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  800a40:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  800a44:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  800a48:	66 0f 6e c0          	movd   %eax,%xmm0
+  800a4c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  800a50:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  800a54:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  800a59:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  800a5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a61:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800a65:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  800a69:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800a6e:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  800a73:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800a77:	89 c2                	mov    %eax,%edx
+  800a79:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800a7e:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  800a83:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800a87:	09 c2                	or     %eax,%edx
+  800a89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800a8c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800a91:	89 c1                	mov    %eax,%ecx
+  800a93:	d3 e6                	shl    %cl,%esi
+  800a95:	89 f0                	mov    %esi,%eax
+  800a97:	21 d0                	and    %edx,%eax
+  800a99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800a9c:	eb 34                	jmp    800ad2 <strchr+0xc5>
+    p += 16;
+  800a9e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  800aa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800aa7:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800aab:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  800aaf:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800ab4:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  800ab9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800abd:	89 c2                	mov    %eax,%edx
+  800abf:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800ac4:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  800ac9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800acd:	09 d0                	or     %edx,%eax
+  800acf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800ad2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ad6:	74 c6                	je     800a9e <strchr+0x91>
+  p += __builtin_ctz(m);
+  800ad8:	31 c0                	xor    %eax,%eax
+  800ada:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  800adf:	48 98                	cltq
+  800ae1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  800ae5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ae9:	0f b6 00             	movzbl (%rax),%eax
+  800aec:	84 c0                	test   %al,%al
+  800aee:	74 06                	je     800af6 <strchr+0xe9>
+  800af0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800af4:	eb 05                	jmp    800afb <strchr+0xee>
+  800af6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afb:	c9                   	leave
+  800afc:	c3                   	ret
+
+0000000000800afd <strfind>:
+strfind(const char *s, char c) {
+  800afd:	55                   	push   %rbp
+  800afe:	48 89 e5             	mov    %rsp,%rbp
+  800b01:	48 83 ec 10          	sub    $0x10,%rsp
+  800b05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b09:	89 f0                	mov    %esi,%eax
+  800b0b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  800b0e:	eb 11                	jmp    800b21 <strfind+0x24>
+    if (*s == c)
+  800b10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b14:	0f b6 00             	movzbl (%rax),%eax
+  800b17:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  800b1a:	74 12                	je     800b2e <strfind+0x31>
+  for (; *s; s++)
+  800b1c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800b21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b25:	0f b6 00             	movzbl (%rax),%eax
+  800b28:	84 c0                	test   %al,%al
+  800b2a:	75 e4                	jne    800b10 <strfind+0x13>
+  800b2c:	eb 01                	jmp    800b2f <strfind+0x32>
+      break;
+  800b2e:	90                   	nop
+  return (char *)s;
+  800b2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b33:	c9                   	leave
+  800b34:	c3                   	ret
+
+0000000000800b35 <memset>:
+memset(void *v, int c, size_t n) {
+  800b35:	55                   	push   %rbp
+  800b36:	48 89 e5             	mov    %rsp,%rbp
+  800b39:	48 83 ec 38          	sub    $0x38,%rsp
+  800b3d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b41:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b44:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  800b48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  800b50:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  800b55:	76 41                	jbe    800b98 <memset+0x63>
+  800b57:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800b5e:	00 00 00 
+  800b61:	ff d0                	call   *%rax
+  800b63:	83 e0 01             	and    $0x1,%eax
+  800b66:	85 c0                	test   %eax,%eax
+  800b68:	74 2e                	je     800b98 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  800b6a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800b6d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800b71:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800b75:	48 89 ce             	mov    %rcx,%rsi
+  800b78:	48 89 f7             	mov    %rsi,%rdi
+  800b7b:	48 89 d1             	mov    %rdx,%rcx
+  800b7e:	fc                   	cld
+  800b7f:	f3 aa                	rep stos %al,%es:(%rdi)
+  800b81:	48 89 ca             	mov    %rcx,%rdx
+  800b84:	48 89 fe             	mov    %rdi,%rsi
+  800b87:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  800b8b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  800b8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b93:	e9 a7 00 00 00       	jmp    800c3f <memset+0x10a>
+  if (n >= 8) {
+  800b98:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  800b9d:	0f 86 87 00 00 00    	jbe    800c2a <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  800ba3:	eb 16                	jmp    800bbb <memset+0x86>
+      *p++ = c;
+  800ba5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ba9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bad:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800bb1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800bb4:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  800bb6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  800bbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bbf:	83 e0 07             	and    $0x7,%eax
+  800bc2:	48 85 c0             	test   %rax,%rax
+  800bc5:	75 de                	jne    800ba5 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  800bc7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800bca:	0f b6 c0             	movzbl %al,%eax
+  800bcd:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  800bd4:	01 01 01 
+  800bd7:	48 0f af c2          	imul   %rdx,%rax
+  800bdb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  800bdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800be3:	48 c1 e8 03          	shr    $0x3,%rax
+  800be7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  800beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bef:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800bf3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bf7:	48 89 ce             	mov    %rcx,%rsi
+  800bfa:	48 89 f7             	mov    %rsi,%rdi
+  800bfd:	48 89 d1             	mov    %rdx,%rcx
+  800c00:	fc                   	cld
+  800c01:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  800c04:	48 89 ca             	mov    %rcx,%rdx
+  800c07:	48 89 fe             	mov    %rdi,%rsi
+  800c0a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  800c0e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  800c12:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  800c17:	eb 11                	jmp    800c2a <memset+0xf5>
+    *p++ = c;
+  800c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c1d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c21:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800c25:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800c28:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  800c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c2e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c32:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c36:	48 85 c0             	test   %rax,%rax
+  800c39:	75 de                	jne    800c19 <memset+0xe4>
+  return v;
+  800c3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  800c3f:	c9                   	leave
+  800c40:	c3                   	ret
+
+0000000000800c41 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  800c41:	55                   	push   %rbp
+  800c42:	48 89 e5             	mov    %rsp,%rbp
+  800c45:	48 83 ec 38          	sub    $0x38,%rsp
+  800c49:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c4d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800c51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  800c55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c59:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  800c5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c61:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  800c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c69:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800c6d:	0f 83 da 00 00 00    	jae    800d4d <memmove+0x10c>
+  800c73:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c7b:	48 01 d0             	add    %rdx,%rax
+  800c7e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  800c82:	0f 83 c5 00 00 00    	jae    800d4d <memmove+0x10c>
+    s += n;
+  800c88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c8c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  800c90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c94:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  800c98:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  800c9d:	0f 86 94 00 00 00    	jbe    800d37 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  800ca3:	eb 1c                	jmp    800cc1 <memmove+0x80>
+        *--d = *--s;
+  800ca5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  800caa:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  800caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cb3:	0f b6 10             	movzbl (%rax),%edx
+  800cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cba:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  800cbc:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  800cc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cc5:	83 e0 07             	and    $0x7,%eax
+  800cc8:	48 85 c0             	test   %rax,%rax
+  800ccb:	75 d8                	jne    800ca5 <memmove+0x64>
+      nq = n / 8;
+  800ccd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cd1:	48 c1 e8 03          	shr    $0x3,%rax
+  800cd5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  800cd9:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  800cde:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  800ce3:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  800ce8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800cec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf4:	48 89 cf             	mov    %rcx,%rdi
+  800cf7:	48 89 d6             	mov    %rdx,%rsi
+  800cfa:	48 89 c1             	mov    %rax,%rcx
+  800cfd:	fd                   	std
+  800cfe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d01:	fc                   	cld
+  800d02:	48 89 c8             	mov    %rcx,%rax
+  800d05:	48 89 f2             	mov    %rsi,%rdx
+  800d08:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  800d0c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800d10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  800d14:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  800d19:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  800d1e:	eb 17                	jmp    800d37 <memmove+0xf6>
+      *--d = *--s;
+  800d20:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  800d25:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  800d2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d2e:	0f b6 10             	movzbl (%rax),%edx
+  800d31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d35:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  800d37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d3b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d3f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d43:	48 85 c0             	test   %rax,%rax
+  800d46:	75 d8                	jne    800d20 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  800d48:	e9 f4 00 00 00       	jmp    800e41 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  800d4d:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  800d52:	76 46                	jbe    800d9a <memmove+0x159>
+  800d54:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+  800d60:	83 e0 01             	and    $0x1,%eax
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	74 33                	je     800d9a <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  800d67:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800d6b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d73:	48 89 cf             	mov    %rcx,%rdi
+  800d76:	48 89 d6             	mov    %rdx,%rsi
+  800d79:	48 89 c1             	mov    %rax,%rcx
+  800d7c:	fc                   	cld
+  800d7d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d7f:	48 89 c8             	mov    %rcx,%rax
+  800d82:	48 89 f2             	mov    %rsi,%rdx
+  800d85:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  800d89:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800d8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  800d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d95:	e9 ab 00 00 00       	jmp    800e45 <memmove+0x204>
+    if (n >= 8) {
+  800d9a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  800d9f:	0f 86 8b 00 00 00    	jbe    800e30 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  800da5:	eb 22                	jmp    800dc9 <memmove+0x188>
+        *d++ = *s++;
+  800da7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dab:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800daf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800db3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800db7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800dbb:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  800dbf:	0f b6 12             	movzbl (%rdx),%edx
+  800dc2:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  800dc4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  800dc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dcd:	83 e0 07             	and    $0x7,%eax
+  800dd0:	48 85 c0             	test   %rax,%rax
+  800dd3:	75 d2                	jne    800da7 <memmove+0x166>
+      nq = n / 8;
+  800dd5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dd9:	48 c1 e8 03          	shr    $0x3,%rax
+  800ddd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  800de1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800de5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800de9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ded:	48 89 cf             	mov    %rcx,%rdi
+  800df0:	48 89 d6             	mov    %rdx,%rsi
+  800df3:	48 89 c1             	mov    %rax,%rcx
+  800df6:	fc                   	cld
+  800df7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dfa:	48 89 c8             	mov    %rcx,%rax
+  800dfd:	48 89 f2             	mov    %rsi,%rdx
+  800e00:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  800e04:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800e08:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  800e0c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  800e11:	eb 1d                	jmp    800e30 <memmove+0x1ef>
+      *d++ = *s++;
+  800e13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e17:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800e1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800e1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e23:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e27:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  800e2b:	0f b6 12             	movzbl (%rdx),%edx
+  800e2e:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  800e30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e34:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e38:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800e3c:	48 85 c0             	test   %rax,%rax
+  800e3f:	75 d2                	jne    800e13 <memmove+0x1d2>
+  return dst;
+  800e41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  800e45:	c9                   	leave
+  800e46:	c3                   	ret
+
+0000000000800e47 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e47:	55                   	push   %rbp
+  800e48:	48 89 e5             	mov    %rsp,%rbp
+  800e4b:	48 83 ec 18          	sub    $0x18,%rsp
+  800e4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800e53:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800e57:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  800e5b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e5f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800e63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e67:	48 89 ce             	mov    %rcx,%rsi
+  800e6a:	48 89 c7             	mov    %rax,%rdi
+  800e6d:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+}
+  800e79:	c9                   	leave
+  800e7a:	c3                   	ret
+
+0000000000800e7b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  800e7b:	55                   	push   %rbp
+  800e7c:	48 89 e5             	mov    %rsp,%rbp
+  800e7f:	48 83 ec 40          	sub    $0x40,%rsp
+  800e83:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800e87:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800e8b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  800e8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e93:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  800e97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  800e9f:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  800ea4:	0f 86 a7 00 00 00    	jbe    800f51 <memcmp+0xd6>
+  800eaa:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+  800eb6:	83 e0 02             	and    $0x2,%eax
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	0f 84 90 00 00 00    	je     800f51 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  800ec1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800ec5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ecd:	48 89 ce             	mov    %rcx,%rsi
+  800ed0:	48 89 c7             	mov    %rax,%rdi
+  800ed3:	48 b8 62 04 80 00 00 	movabs $0x800462,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+  800edf:	e9 c2 00 00 00       	jmp    800fa6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  800ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ee8:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  800eec:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  800ef0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ef4:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  800ef8:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  800efc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800f00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  800f03:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  800f0a:	74 36                	je     800f42 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  800f0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f0f:	f7 d0                	not    %eax
+  800f11:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f15:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  800f18:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800f1b:	48 63 d0             	movslq %eax,%rdx
+  800f1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f22:	48 01 d0             	add    %rdx,%rax
+  800f25:	0f b6 00             	movzbl (%rax),%eax
+  800f28:	0f b6 c0             	movzbl %al,%eax
+  800f2b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f2e:	48 63 ca             	movslq %edx,%rcx
+  800f31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f35:	48 01 ca             	add    %rcx,%rdx
+  800f38:	0f b6 12             	movzbl (%rdx),%edx
+  800f3b:	0f b6 d2             	movzbl %dl,%edx
+  800f3e:	29 d0                	sub    %edx,%eax
+  800f40:	eb 64                	jmp    800fa6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  800f42:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  800f47:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  800f4c:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  800f51:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  800f56:	77 8c                	ja     800ee4 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  800f58:	eb 36                	jmp    800f90 <memcmp+0x115>
+    if (*s1 != *s2)
+  800f5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f5e:	0f b6 10             	movzbl (%rax),%edx
+  800f61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f65:	0f b6 00             	movzbl (%rax),%eax
+  800f68:	38 c2                	cmp    %al,%dl
+  800f6a:	74 1a                	je     800f86 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  800f6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f70:	0f b6 00             	movzbl (%rax),%eax
+  800f73:	0f b6 c8             	movzbl %al,%ecx
+  800f76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f7a:	0f b6 00             	movzbl (%rax),%eax
+  800f7d:	0f b6 d0             	movzbl %al,%edx
+  800f80:	89 c8                	mov    %ecx,%eax
+  800f82:	29 d0                	sub    %edx,%eax
+  800f84:	eb 20                	jmp    800fa6 <memcmp+0x12b>
+    s1++, s2++;
+  800f86:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800f8b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  800f90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f94:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f98:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 b9                	jne    800f5a <memcmp+0xdf>
+  }
+
+  return 0;
+  800fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa6:	c9                   	leave
+  800fa7:	c3                   	ret
+
+0000000000800fa8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  800fa8:	55                   	push   %rbp
+  800fa9:	48 89 e5             	mov    %rsp,%rbp
+  800fac:	48 83 ec 50          	sub    $0x50,%rsp
+  800fb0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800fb4:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  800fb7:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  800fbb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800fbf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800fc3:	48 01 d0             	add    %rdx,%rax
+  800fc6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  800fca:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800fcd:	66 0f 6e c0          	movd   %eax,%xmm0
+  800fd1:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  800fd5:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  800fd9:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  800fde:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  800fe2:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  800fe7:	76 73                	jbe    80105c <memfind+0xb4>
+  800fe9:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800ff0:	00 00 00 
+  800ff3:	ff d0                	call   *%rax
+  800ff5:	83 e0 02             	and    $0x2,%eax
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	74 60                	je     80105c <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  800ffc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800fff:	0f b6 c8             	movzbl %al,%ecx
+  801002:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801006:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100a:	89 ce                	mov    %ecx,%esi
+  80100c:	48 89 c7             	mov    %rax,%rdi
+  80100f:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  801016:	00 00 00 
+  801019:	ff d0                	call   *%rax
+  80101b:	eb 6c                	jmp    801089 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  80101d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801021:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801025:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801029:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  80102e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801032:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801036:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801039:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80103d:	74 13                	je     801052 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  80103f:	31 c0                	xor    %eax,%eax
+  801041:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801046:	48 63 d0             	movslq %eax,%rdx
+  801049:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80104d:	48 01 d0             	add    %rdx,%rax
+  801050:	eb 37                	jmp    801089 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801052:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801057:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  80105c:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801061:	77 ba                	ja     80101d <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801063:	eb 13                	jmp    801078 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801065:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801069:	0f b6 00             	movzbl (%rax),%eax
+  80106c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80106f:	38 d0                	cmp    %dl,%al
+  801071:	74 11                	je     801084 <memfind+0xdc>
+  for (; s < ends; s++)
+  801073:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80107c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801080:	72 e3                	jb     801065 <memfind+0xbd>
+  801082:	eb 01                	jmp    801085 <memfind+0xdd>
+      break;
+  801084:	90                   	nop
+  return (void *)s;
+  801085:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801089:	c9                   	leave
+  80108a:	c3                   	ret
+
+000000000080108b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80108b:	55                   	push   %rbp
+  80108c:	48 89 e5             	mov    %rsp,%rbp
+  80108f:	48 83 ec 38          	sub    $0x38,%rsp
+  801093:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801097:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80109b:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  80109e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  8010a5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010ac:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8010ad:	eb 05                	jmp    8010b4 <strtol+0x29>
+    s++;
+  8010af:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  8010b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010b8:	0f b6 00             	movzbl (%rax),%eax
+  8010bb:	3c 20                	cmp    $0x20,%al
+  8010bd:	74 f0                	je     8010af <strtol+0x24>
+  8010bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010c3:	0f b6 00             	movzbl (%rax),%eax
+  8010c6:	3c 09                	cmp    $0x9,%al
+  8010c8:	74 e5                	je     8010af <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8010ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010ce:	0f b6 00             	movzbl (%rax),%eax
+  8010d1:	3c 2b                	cmp    $0x2b,%al
+  8010d3:	75 07                	jne    8010dc <strtol+0x51>
+    s++;
+  8010d5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8010da:	eb 17                	jmp    8010f3 <strtol+0x68>
+  else if (*s == '-')
+  8010dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010e0:	0f b6 00             	movzbl (%rax),%eax
+  8010e3:	3c 2d                	cmp    $0x2d,%al
+  8010e5:	75 0c                	jne    8010f3 <strtol+0x68>
+    s++, neg = 1;
+  8010e7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8010ec:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010f3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8010f7:	74 06                	je     8010ff <strtol+0x74>
+  8010f9:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8010fd:	75 28                	jne    801127 <strtol+0x9c>
+  8010ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801103:	0f b6 00             	movzbl (%rax),%eax
+  801106:	3c 30                	cmp    $0x30,%al
+  801108:	75 1d                	jne    801127 <strtol+0x9c>
+  80110a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80110e:	48 83 c0 01          	add    $0x1,%rax
+  801112:	0f b6 00             	movzbl (%rax),%eax
+  801115:	3c 78                	cmp    $0x78,%al
+  801117:	75 0e                	jne    801127 <strtol+0x9c>
+    s += 2, base = 16;
+  801119:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80111e:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801125:	eb 2c                	jmp    801153 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801127:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80112b:	75 19                	jne    801146 <strtol+0xbb>
+  80112d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801131:	0f b6 00             	movzbl (%rax),%eax
+  801134:	3c 30                	cmp    $0x30,%al
+  801136:	75 0e                	jne    801146 <strtol+0xbb>
+    s++, base = 8;
+  801138:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80113d:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801144:	eb 0d                	jmp    801153 <strtol+0xc8>
+  else if (base == 0)
+  801146:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80114a:	75 07                	jne    801153 <strtol+0xc8>
+    base = 10;
+  80114c:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801157:	0f b6 00             	movzbl (%rax),%eax
+  80115a:	3c 2f                	cmp    $0x2f,%al
+  80115c:	7e 1d                	jle    80117b <strtol+0xf0>
+  80115e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801162:	0f b6 00             	movzbl (%rax),%eax
+  801165:	3c 39                	cmp    $0x39,%al
+  801167:	7f 12                	jg     80117b <strtol+0xf0>
+      dig = *s - '0';
+  801169:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80116d:	0f b6 00             	movzbl (%rax),%eax
+  801170:	0f be c0             	movsbl %al,%eax
+  801173:	83 e8 30             	sub    $0x30,%eax
+  801176:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801179:	eb 4e                	jmp    8011c9 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80117b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80117f:	0f b6 00             	movzbl (%rax),%eax
+  801182:	3c 60                	cmp    $0x60,%al
+  801184:	7e 1d                	jle    8011a3 <strtol+0x118>
+  801186:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80118a:	0f b6 00             	movzbl (%rax),%eax
+  80118d:	3c 7a                	cmp    $0x7a,%al
+  80118f:	7f 12                	jg     8011a3 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801191:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801195:	0f b6 00             	movzbl (%rax),%eax
+  801198:	0f be c0             	movsbl %al,%eax
+  80119b:	83 e8 57             	sub    $0x57,%eax
+  80119e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8011a1:	eb 26                	jmp    8011c9 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8011a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011a7:	0f b6 00             	movzbl (%rax),%eax
+  8011aa:	3c 40                	cmp    $0x40,%al
+  8011ac:	7e 47                	jle    8011f5 <strtol+0x16a>
+  8011ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011b2:	0f b6 00             	movzbl (%rax),%eax
+  8011b5:	3c 5a                	cmp    $0x5a,%al
+  8011b7:	7f 3c                	jg     8011f5 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8011b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011bd:	0f b6 00             	movzbl (%rax),%eax
+  8011c0:	0f be c0             	movsbl %al,%eax
+  8011c3:	83 e8 37             	sub    $0x37,%eax
+  8011c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8011c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011cc:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8011cf:	7d 23                	jge    8011f4 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8011d1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8011d6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8011d9:	48 98                	cltq
+  8011db:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8011e0:	48 89 c2             	mov    %rax,%rdx
+  8011e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011e6:	48 98                	cltq
+  8011e8:	48 01 d0             	add    %rdx,%rax
+  8011eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8011ef:	e9 5f ff ff ff       	jmp    801153 <strtol+0xc8>
+      break;
+  8011f4:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8011f5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8011fa:	74 0b                	je     801207 <strtol+0x17c>
+    *endptr = (char *)s;
+  8011fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801200:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801204:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801207:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80120b:	74 09                	je     801216 <strtol+0x18b>
+  80120d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801211:	48 f7 d8             	neg    %rax
+  801214:	eb 04                	jmp    80121a <strtol+0x18f>
+  801216:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80121a:	c9                   	leave
+  80121b:	c3                   	ret
+
+000000000080121c <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+  801220:	53                   	push   %rbx
+  801221:	48 83 ec 48          	sub    $0x48,%rsp
+  801225:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801229:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80122d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801231:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801235:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801239:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80123d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801241:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801245:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801249:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80124d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801251:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801255:	4c 89 c3             	mov    %r8,%rbx
+  801258:	cd 30                	int    $0x30
+  80125a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80125e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801263:	74 46                	je     8012ab <syscall+0x8f>
+  801265:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80126a:	7e 3f                	jle    8012ab <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80126c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801270:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801274:	49 89 d0             	mov    %rdx,%r8
+  801277:	48 89 c1             	mov    %rax,%rcx
+  80127a:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  801281:	00 00 00 
+  801284:	48 89 c2             	mov    %rax,%rdx
+  801287:	be 22 00 00 00       	mov    $0x22,%esi
+  80128c:	48 b8 f7 50 80 00 00 	movabs $0x8050f7,%rax
+  801293:	00 00 00 
+  801296:	48 89 c7             	mov    %rax,%rdi
+  801299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129e:	49 b9 5c 40 80 00 00 	movabs $0x80405c,%r9
+  8012a5:	00 00 00 
+  8012a8:	41 ff d1             	call   *%r9
+
+  return ret;
+  8012ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8012af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b3:	c9                   	leave
+  8012b4:	c3                   	ret
+
+00000000008012b5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+  8012b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8012bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8012c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d1:	6a 00                	push   $0x0
+  8012d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8012d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012df:	48 89 d1             	mov    %rdx,%rcx
+  8012e2:	48 89 c2             	mov    %rax,%rdx
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ef:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+  8012fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8012ff:	90                   	nop
+  801300:	c9                   	leave
+  801301:	c3                   	ret
+
+0000000000801302 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801302:	55                   	push   %rbp
+  801303:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801306:	48 83 ec 08          	sub    $0x8,%rsp
+  80130a:	6a 00                	push   $0x0
+  80130c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801318:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80131d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801322:	be 00 00 00 00       	mov    $0x0,%esi
+  801327:	bf 01 00 00 00       	mov    $0x1,%edi
+  80132c:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801333:	00 00 00 
+  801336:	ff d0                	call   *%rax
+  801338:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80133c:	c9                   	leave
+  80133d:	c3                   	ret
+
+000000000080133e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80133e:	55                   	push   %rbp
+  80133f:	48 89 e5             	mov    %rsp,%rbp
+  801342:	48 83 ec 10          	sub    $0x10,%rsp
+  801346:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801349:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80134c:	48 98                	cltq
+  80134e:	48 83 ec 08          	sub    $0x8,%rsp
+  801352:	6a 00                	push   $0x0
+  801354:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801365:	48 89 c2             	mov    %rax,%rdx
+  801368:	be 01 00 00 00       	mov    $0x1,%esi
+  80136d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801372:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801379:	00 00 00 
+  80137c:	ff d0                	call   *%rax
+  80137e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+
+0000000000801384 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	48 83 ec 10          	sub    $0x10,%rsp
+  80138c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80138f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801392:	48 98                	cltq
+  801394:	48 83 ec 08          	sub    $0x8,%rsp
+  801398:	6a 00                	push   $0x0
+  80139a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8013a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ab:	48 89 c2             	mov    %rax,%rdx
+  8013ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8013b8:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8013bf:	00 00 00 
+  8013c2:	ff d0                	call   *%rax
+  8013c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8013c8:	90                   	nop
+  8013c9:	c9                   	leave
+  8013ca:	c3                   	ret
+
+00000000008013cb <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8013cb:	55                   	push   %rbp
+  8013cc:	48 89 e5             	mov    %rsp,%rbp
+  8013cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8013d3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8013da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013dd:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8013e0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013e5:	cd 30                	int    $0x30
+  8013e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8013eb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8013ef:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8013f4:	7e 3d                	jle    801433 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8013f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013fa:	49 89 c0             	mov    %rax,%r8
+  8013fd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801402:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  801409:	00 00 00 
+  80140c:	48 89 c2             	mov    %rax,%rdx
+  80140f:	be 49 00 00 00       	mov    $0x49,%esi
+  801414:	48 b8 f7 50 80 00 00 	movabs $0x8050f7,%rax
+  80141b:	00 00 00 
+  80141e:	48 89 c7             	mov    %rax,%rdi
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 5c 40 80 00 00 	movabs $0x80405c,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801433:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801438:	75 13                	jne    80144d <sys_env_wait+0x82>
+  80143a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80143f:	74 0c                	je     80144d <sys_env_wait+0x82>
+    *status = st;
+  801441:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801445:	89 c2                	mov    %eax,%edx
+  801447:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80144b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80144d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801451:	c9                   	leave
+  801452:	c3                   	ret
+
+0000000000801453 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801453:	55                   	push   %rbp
+  801454:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801457:	48 83 ec 08          	sub    $0x8,%rsp
+  80145b:	6a 00                	push   $0x0
+  80145d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801469:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801473:	be 00 00 00 00       	mov    $0x0,%esi
+  801478:	bf 02 00 00 00       	mov    $0x2,%edi
+  80147d:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801484:	00 00 00 
+  801487:	ff d0                	call   *%rax
+  801489:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80148d:	c9                   	leave
+  80148e:	c3                   	ret
+
+000000000080148f <sys_yield>:
+
+void
+sys_yield(void) {
+  80148f:	55                   	push   %rbp
+  801490:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801493:	48 83 ec 08          	sub    $0x8,%rsp
+  801497:	6a 00                	push   $0x0
+  801499:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80149f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014af:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8014b9:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8014c0:	00 00 00 
+  8014c3:	ff d0                	call   *%rax
+  8014c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8014c9:	90                   	nop
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+
+00000000008014cc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8014cc:	55                   	push   %rbp
+  8014cd:	48 89 e5             	mov    %rsp,%rbp
+  8014d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8014d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8014d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014db:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8014de:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8014e1:	48 63 c8             	movslq %eax,%rcx
+  8014e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8014eb:	48 98                	cltq
+  8014ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f1:	6a 00                	push   $0x0
+  8014f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8014f9:	49 89 c8             	mov    %rcx,%r8
+  8014fc:	48 89 d1             	mov    %rdx,%rcx
+  8014ff:	48 89 c2             	mov    %rax,%rdx
+  801502:	be 01 00 00 00       	mov    $0x1,%esi
+  801507:	bf 06 00 00 00       	mov    $0x6,%edi
+  80150c:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	48 83 c4 10          	add    $0x10,%rsp
+  80151c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80151f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801522:	c9                   	leave
+  801523:	c3                   	ret
+
+0000000000801524 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801524:	55                   	push   %rbp
+  801525:	48 89 e5             	mov    %rsp,%rbp
+  801528:	48 83 ec 20          	sub    $0x20,%rsp
+  80152c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80152f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801533:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80153a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80153e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801541:	48 63 c8             	movslq %eax,%rcx
+  801544:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801548:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80154b:	48 63 f0             	movslq %eax,%rsi
+  80154e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801552:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801555:	48 98                	cltq
+  801557:	48 83 ec 08          	sub    $0x8,%rsp
+  80155b:	51                   	push   %rcx
+  80155c:	49 89 f9             	mov    %rdi,%r9
+  80155f:	49 89 f0             	mov    %rsi,%r8
+  801562:	48 89 d1             	mov    %rdx,%rcx
+  801565:	48 89 c2             	mov    %rax,%rdx
+  801568:	be 01 00 00 00       	mov    $0x1,%esi
+  80156d:	bf 07 00 00 00       	mov    $0x7,%edi
+  801572:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801579:	00 00 00 
+  80157c:	ff d0                	call   *%rax
+  80157e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801582:	c9                   	leave
+  801583:	c3                   	ret
+
+0000000000801584 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  801584:	55                   	push   %rbp
+  801585:	48 89 e5             	mov    %rsp,%rbp
+  801588:	48 83 ec 10          	sub    $0x10,%rsp
+  80158c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80158f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  801593:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801597:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80159a:	48 98                	cltq
+  80159c:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a0:	6a 00                	push   $0x0
+  8015a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8015a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ae:	48 89 d1             	mov    %rdx,%rcx
+  8015b1:	48 89 c2             	mov    %rax,%rdx
+  8015b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8015b9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8015be:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8015c5:	00 00 00 
+  8015c8:	ff d0                	call   *%rax
+  8015ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8015ce:	c9                   	leave
+  8015cf:	c3                   	ret
+
+00000000008015d0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8015d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8015db:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8015de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8015e1:	48 63 d0             	movslq %eax,%rdx
+  8015e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8015e7:	48 98                	cltq
+  8015e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ed:	6a 00                	push   $0x0
+  8015ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fb:	48 89 d1             	mov    %rdx,%rcx
+  8015fe:	48 89 c2             	mov    %rax,%rdx
+  801601:	be 01 00 00 00       	mov    $0x1,%esi
+  801606:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80160b:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801612:	00 00 00 
+  801615:	ff d0                	call   *%rax
+  801617:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+
+000000000080161d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	48 83 ec 10          	sub    $0x10,%rsp
+  801625:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801628:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80162c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801630:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801633:	48 98                	cltq
+  801635:	48 83 ec 08          	sub    $0x8,%rsp
+  801639:	6a 00                	push   $0x0
+  80163b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801641:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801647:	48 89 d1             	mov    %rdx,%rcx
+  80164a:	48 89 c2             	mov    %rax,%rdx
+  80164d:	be 01 00 00 00       	mov    $0x1,%esi
+  801652:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801657:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  80165e:	00 00 00 
+  801661:	ff d0                	call   *%rax
+  801663:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801667:	c9                   	leave
+  801668:	c3                   	ret
+
+0000000000801669 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	48 83 ec 10          	sub    $0x10,%rsp
+  801671:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801674:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801678:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80167c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80167f:	48 98                	cltq
+  801681:	48 83 ec 08          	sub    $0x8,%rsp
+  801685:	6a 00                	push   $0x0
+  801687:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80168d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801693:	48 89 d1             	mov    %rdx,%rcx
+  801696:	48 89 c2             	mov    %rax,%rdx
+  801699:	be 01 00 00 00       	mov    $0x1,%esi
+  80169e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8016a3:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8016aa:	00 00 00 
+  8016ad:	ff d0                	call   *%rax
+  8016af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8016b3:	c9                   	leave
+  8016b4:	c3                   	ret
+
+00000000008016b5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8016b5:	55                   	push   %rbp
+  8016b6:	48 89 e5             	mov    %rsp,%rbp
+  8016b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8016bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8016c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016c4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016c8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8016cb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8016ce:	48 63 f0             	movslq %eax,%rsi
+  8016d1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016dc:	48 98                	cltq
+  8016de:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e2:	6a 00                	push   $0x0
+  8016e4:	49 89 f1             	mov    %rsi,%r9
+  8016e7:	49 89 c8             	mov    %rcx,%r8
+  8016ea:	48 89 d1             	mov    %rdx,%rcx
+  8016ed:	48 89 c2             	mov    %rax,%rdx
+  8016f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8016fa:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801701:	00 00 00 
+  801704:	ff d0                	call   *%rax
+  801706:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80170a:	c9                   	leave
+  80170b:	c3                   	ret
+
+000000000080170c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	48 83 ec 10          	sub    $0x10,%rsp
+  801714:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171c:	48 83 ec 08          	sub    $0x8,%rsp
+  801720:	6a 00                	push   $0x0
+  801722:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801728:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80172e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801733:	48 89 c2             	mov    %rax,%rdx
+  801736:	be 01 00 00 00       	mov    $0x1,%esi
+  80173b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801740:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801747:	00 00 00 
+  80174a:	ff d0                	call   *%rax
+  80174c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801750:	c9                   	leave
+  801751:	c3                   	ret
+
+0000000000801752 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	48 83 ec 10          	sub    $0x10,%rsp
+  80175a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80175e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  801762:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801766:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176a:	48 83 ec 08          	sub    $0x8,%rsp
+  80176e:	6a 00                	push   $0x0
+  801770:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801776:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80177c:	48 89 d1             	mov    %rdx,%rcx
+  80177f:	48 89 c2             	mov    %rax,%rdx
+  801782:	be 01 00 00 00       	mov    $0x1,%esi
+  801787:	bf 10 00 00 00       	mov    $0x10,%edi
+  80178c:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801793:	00 00 00 
+  801796:	ff d0                	call   *%rax
+  801798:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80179c:	c9                   	leave
+  80179d:	c3                   	ret
+
+000000000080179e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8017a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a6:	6a 00                	push   $0x0
+  8017a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8017ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017be:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c3:	bf 11 00 00 00       	mov    $0x11,%edi
+  8017c8:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8017cf:	00 00 00 
+  8017d2:	ff d0                	call   *%rax
+  8017d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8017d8:	c9                   	leave
+  8017d9:	c3                   	ret
+
+00000000008017da <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	48 83 ec 10          	sub    $0x10,%rsp
+  8017e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8017ea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f6:	6a 00                	push   $0x0
+  8017f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8017fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801804:	48 89 d1             	mov    %rdx,%rcx
+  801807:	48 89 c2             	mov    %rax,%rdx
+  80180a:	be 00 00 00 00       	mov    $0x0,%esi
+  80180f:	bf 12 00 00 00       	mov    $0x12,%edi
+  801814:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  80181b:	00 00 00 
+  80181e:	ff d0                	call   *%rax
+  801820:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+0000000000801826 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  801826:	55                   	push   %rbp
+  801827:	48 89 e5             	mov    %rsp,%rbp
+  80182a:	48 83 ec 20          	sub    $0x20,%rsp
+  80182e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801832:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801836:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  801839:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80183c:	48 63 c8             	movslq %eax,%rcx
+  80183f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801847:	48 83 ec 08          	sub    $0x8,%rsp
+  80184b:	6a 00                	push   $0x0
+  80184d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801853:	49 89 c8             	mov    %rcx,%r8
+  801856:	48 89 d1             	mov    %rdx,%rcx
+  801859:	48 89 c2             	mov    %rax,%rdx
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	bf 13 00 00 00       	mov    $0x13,%edi
+  801866:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+  801872:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801876:	c9                   	leave
+  801877:	c3                   	ret
+
+0000000000801878 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  801878:	55                   	push   %rbp
+  801879:	48 89 e5             	mov    %rsp,%rbp
+  80187c:	48 83 ec 20          	sub    $0x20,%rsp
+  801880:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801884:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801887:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80188b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80188f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801896:	48 83 ec 08          	sub    $0x8,%rsp
+  80189a:	6a 00                	push   $0x0
+  80189c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8018a2:	49 89 c8             	mov    %rcx,%r8
+  8018a5:	48 89 d1             	mov    %rdx,%rcx
+  8018a8:	48 89 c2             	mov    %rax,%rdx
+  8018ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8018b0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8018b5:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8018bc:	00 00 00 
+  8018bf:	ff d0                	call   *%rax
+  8018c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8018c5:	c9                   	leave
+  8018c6:	c3                   	ret
+
+00000000008018c7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8018c7:	55                   	push   %rbp
+  8018c8:	48 89 e5             	mov    %rsp,%rbp
+  8018cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8018cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018d3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8018d6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d9:	48 63 d0             	movslq %eax,%rdx
+  8018dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8018e4:	6a 00                	push   $0x0
+  8018e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8018ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f2:	48 89 d1             	mov    %rdx,%rcx
+  8018f5:	48 89 c2             	mov    %rax,%rdx
+  8018f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018fd:	bf 15 00 00 00       	mov    $0x15,%edi
+  801902:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+  80190e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+0000000000801914 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	48 83 ec 20          	sub    $0x20,%rsp
+  80191c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801920:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801923:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  801926:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80192a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80192e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801931:	48 63 c8             	movslq %eax,%rcx
+  801934:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801937:	48 63 d0             	movslq %eax,%rdx
+  80193a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193e:	48 83 ec 08          	sub    $0x8,%rsp
+  801942:	6a 00                	push   $0x0
+  801944:	49 89 f1             	mov    %rsi,%r9
+  801947:	49 89 c8             	mov    %rcx,%r8
+  80194a:	48 89 d1             	mov    %rdx,%rcx
+  80194d:	48 89 c2             	mov    %rax,%rdx
+  801950:	be 00 00 00 00       	mov    $0x0,%esi
+  801955:	bf 16 00 00 00       	mov    $0x16,%edi
+  80195a:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80196a:	c9                   	leave
+  80196b:	c3                   	ret
+
+000000000080196c <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80196c:	55                   	push   %rbp
+  80196d:	48 89 e5             	mov    %rsp,%rbp
+  801970:	48 83 ec 30          	sub    $0x30,%rsp
+  801974:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801978:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80197c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801980:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801984:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  801988:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80198c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801990:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801994:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199c:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a0:	51                   	push   %rcx
+  8019a1:	49 89 f9             	mov    %rdi,%r9
+  8019a4:	49 89 f0             	mov    %rsi,%r8
+  8019a7:	48 89 d1             	mov    %rdx,%rcx
+  8019aa:	48 89 c2             	mov    %rax,%rdx
+  8019ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b2:	bf 17 00 00 00       	mov    $0x17,%edi
+  8019b7:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  8019be:	00 00 00 
+  8019c1:	ff d0                	call   *%rax
+  8019c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8019c7:	c9                   	leave
+  8019c8:	c3                   	ret
+
+00000000008019c9 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8019c9:	55                   	push   %rbp
+  8019ca:	48 89 e5             	mov    %rsp,%rbp
+  8019cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8019d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8019d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019d7:	48 98                	cltq
+  8019d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8019dd:	6a 00                	push   $0x0
+  8019df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8019e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019f0:	48 89 c2             	mov    %rax,%rdx
+  8019f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f8:	bf 18 00 00 00       	mov    $0x18,%edi
+  8019fd:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801a04:	00 00 00 
+  801a07:	ff d0                	call   *%rax
+  801a09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801a0d:	90                   	nop
+  801a0e:	c9                   	leave
+  801a0f:	c3                   	ret
+
+0000000000801a10 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  801a10:	55                   	push   %rbp
+  801a11:	48 89 e5             	mov    %rsp,%rbp
+  801a14:	48 83 ec 30          	sub    $0x30,%rsp
+  801a18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801a1b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a1f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a23:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  801a26:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801a29:	48 63 f0             	movslq %eax,%rsi
+  801a2c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a30:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a37:	48 98                	cltq
+  801a39:	48 83 ec 08          	sub    $0x8,%rsp
+  801a3d:	6a 00                	push   $0x0
+  801a3f:	49 89 f1             	mov    %rsi,%r9
+  801a42:	49 89 c8             	mov    %rcx,%r8
+  801a45:	48 89 d1             	mov    %rdx,%rcx
+  801a48:	48 89 c2             	mov    %rax,%rdx
+  801a4b:	be 01 00 00 00       	mov    $0x1,%esi
+  801a50:	bf 19 00 00 00       	mov    $0x19,%edi
+  801a55:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+  801a61:	48 83 c4 10          	add    $0x10,%rsp
+  801a65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  801a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+
+0000000000801a6d <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  801a6d:	55                   	push   %rbp
+  801a6e:	48 89 e5             	mov    %rsp,%rbp
+  801a71:	48 83 ec 20          	sub    $0x20,%rsp
+  801a75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a7d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  801a80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a83:	48 63 c8             	movslq %eax,%rcx
+  801a86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801a92:	6a 00                	push   $0x0
+  801a94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a9a:	49 89 c8             	mov    %rcx,%r8
+  801a9d:	48 89 d1             	mov    %rdx,%rcx
+  801aa0:	48 89 c2             	mov    %rax,%rdx
+  801aa3:	be 01 00 00 00       	mov    $0x1,%esi
+  801aa8:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  801aad:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801ab4:	00 00 00 
+  801ab7:	ff d0                	call   *%rax
+  801ab9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+
+0000000000801abf <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+  801ac3:	48 83 ec 20          	sub    $0x20,%rsp
+  801ac7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801acb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801acf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  801ad3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ad7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801adb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801adf:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae3:	6a 00                	push   $0x0
+  801ae5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801aeb:	49 89 c8             	mov    %rcx,%r8
+  801aee:	48 89 d1             	mov    %rdx,%rcx
+  801af1:	48 89 c2             	mov    %rax,%rdx
+  801af4:	be 01 00 00 00       	mov    $0x1,%esi
+  801af9:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  801afe:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+  801b0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+0000000000801b10 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  801b10:	55                   	push   %rbp
+  801b11:	48 89 e5             	mov    %rsp,%rbp
+  801b14:	48 83 ec 30          	sub    $0x30,%rsp
+  801b18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b1c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b20:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  801b23:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  801b27:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801b2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b2e:	48 63 c8             	movslq %eax,%rcx
+  801b31:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801b35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b39:	48 83 ec 08          	sub    $0x8,%rsp
+  801b3d:	6a 00                	push   $0x0
+  801b3f:	49 89 f1             	mov    %rsi,%r9
+  801b42:	49 89 c8             	mov    %rcx,%r8
+  801b45:	48 89 d1             	mov    %rdx,%rcx
+  801b48:	48 89 c2             	mov    %rax,%rdx
+  801b4b:	be 01 00 00 00       	mov    $0x1,%esi
+  801b50:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  801b55:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+  801b61:	48 83 c4 10          	add    $0x10,%rsp
+  801b65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  801b68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801b6b:	c9                   	leave
+  801b6c:	c3                   	ret
+
+0000000000801b6d <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  801b6d:	55                   	push   %rbp
+  801b6e:	48 89 e5             	mov    %rsp,%rbp
+  801b71:	48 83 ec 10          	sub    $0x10,%rsp
+  801b75:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  801b78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b7b:	48 98                	cltq
+  801b7d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b81:	6a 00                	push   $0x0
+  801b83:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b94:	48 89 c2             	mov    %rax,%rdx
+  801b97:	be 01 00 00 00       	mov    $0x1,%esi
+  801b9c:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  801ba1:	48 b8 1c 12 80 00 00 	movabs $0x80121c,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+
+0000000000801bb3 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  801bb3:	55                   	push   %rbp
+  801bb4:	48 89 e5             	mov    %rsp,%rbp
+  801bb7:	48 83 ec 08          	sub    $0x8,%rsp
+  801bbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801bbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc3:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  801bca:	ff ff ff 
+  801bcd:	48 01 d0             	add    %rdx,%rax
+  801bd0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801bd4:	c9                   	leave
+  801bd5:	c3                   	ret
+
+0000000000801bd6 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  801bd6:	55                   	push   %rbp
+  801bd7:	48 89 e5             	mov    %rsp,%rbp
+  801bda:	48 83 ec 08          	sub    $0x8,%rsp
+  801bde:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  801be2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801be6:	48 89 c7             	mov    %rax,%rdi
+  801be9:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+  801bf5:	48 05 01 68 00 00    	add    $0x6801,%rax
+  801bfb:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+
+0000000000801c01 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  801c01:	55                   	push   %rbp
+  801c02:	48 89 e5             	mov    %rsp,%rbp
+  801c05:	48 83 ec 18          	sub    $0x18,%rsp
+  801c09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801c0d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801c14:	e9 ae 00 00 00       	jmp    801cc7 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  801c19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c1c:	c1 e0 0c             	shl    $0xc,%eax
+  801c1f:	48 98                	cltq
+  801c21:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  801c26:	48 01 d0             	add    %rdx,%rax
+  801c29:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c31:	48 c1 e8 27          	shr    $0x27,%rax
+  801c35:	48 89 c2             	mov    %rax,%rdx
+  801c38:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  801c3f:	01 00 00 
+  801c42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801c46:	83 e0 01             	and    $0x1,%eax
+  801c49:	48 85 c0             	test   %rax,%rax
+  801c4c:	74 63                	je     801cb1 <fd_alloc+0xb0>
+  801c4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c52:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801c56:	48 89 c2             	mov    %rax,%rdx
+  801c59:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  801c60:	01 00 00 
+  801c63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801c67:	83 e0 01             	and    $0x1,%eax
+  801c6a:	48 85 c0             	test   %rax,%rax
+  801c6d:	74 42                	je     801cb1 <fd_alloc+0xb0>
+  801c6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c73:	48 c1 e8 15          	shr    $0x15,%rax
+  801c77:	48 89 c2             	mov    %rax,%rdx
+  801c7a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  801c81:	01 00 00 
+  801c84:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801c88:	83 e0 01             	and    $0x1,%eax
+  801c8b:	48 85 c0             	test   %rax,%rax
+  801c8e:	74 21                	je     801cb1 <fd_alloc+0xb0>
+  801c90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c94:	48 c1 e8 0c          	shr    $0xc,%rax
+  801c98:	48 89 c2             	mov    %rax,%rdx
+  801c9b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801ca2:	01 00 00 
+  801ca5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801ca9:	83 e0 01             	and    $0x1,%eax
+  801cac:	48 85 c0             	test   %rax,%rax
+  801caf:	75 12                	jne    801cc3 <fd_alloc+0xc2>
+      *fd_store = fd;
+  801cb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cb5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cb9:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  801cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc1:	eb 1e                	jmp    801ce1 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  801cc3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801cc7:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  801ccb:	0f 8e 48 ff ff ff    	jle    801c19 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  801cd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cd5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  801cdc:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  801ce1:	c9                   	leave
+  801ce2:	c3                   	ret
+
+0000000000801ce3 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ce3:	55                   	push   %rbp
+  801ce4:	48 89 e5             	mov    %rsp,%rbp
+  801ce7:	48 83 ec 20          	sub    $0x20,%rsp
+  801ceb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801cee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801cf2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801cf6:	78 06                	js     801cfe <fd_lookup+0x1b>
+  801cf8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  801cfc:	7e 0a                	jle    801d08 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  801cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d03:	e9 af 00 00 00       	jmp    801db7 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  801d08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d0b:	c1 e0 0c             	shl    $0xc,%eax
+  801d0e:	48 98                	cltq
+  801d10:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  801d15:	48 01 d0             	add    %rdx,%rax
+  801d18:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801d1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d20:	48 c1 e8 27          	shr    $0x27,%rax
+  801d24:	48 89 c2             	mov    %rax,%rdx
+  801d27:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  801d2e:	01 00 00 
+  801d31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d35:	83 e0 01             	and    $0x1,%eax
+  801d38:	48 85 c0             	test   %rax,%rax
+  801d3b:	74 63                	je     801da0 <fd_lookup+0xbd>
+  801d3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d41:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801d45:	48 89 c2             	mov    %rax,%rdx
+  801d48:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  801d4f:	01 00 00 
+  801d52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d56:	83 e0 01             	and    $0x1,%eax
+  801d59:	48 85 c0             	test   %rax,%rax
+  801d5c:	74 42                	je     801da0 <fd_lookup+0xbd>
+  801d5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d62:	48 c1 e8 15          	shr    $0x15,%rax
+  801d66:	48 89 c2             	mov    %rax,%rdx
+  801d69:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  801d70:	01 00 00 
+  801d73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d77:	83 e0 01             	and    $0x1,%eax
+  801d7a:	48 85 c0             	test   %rax,%rax
+  801d7d:	74 21                	je     801da0 <fd_lookup+0xbd>
+  801d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d83:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d87:	48 89 c2             	mov    %rax,%rdx
+  801d8a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801d91:	01 00 00 
+  801d94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d98:	83 e0 01             	and    $0x1,%eax
+  801d9b:	48 85 c0             	test   %rax,%rax
+  801d9e:	75 07                	jne    801da7 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  801da0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801da5:	eb 10                	jmp    801db7 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  801da7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801daf:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  801db2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db7:	c9                   	leave
+  801db8:	c3                   	ret
+
+0000000000801db9 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  801db9:	55                   	push   %rbp
+  801dba:	48 89 e5             	mov    %rsp,%rbp
+  801dbd:	48 83 ec 30          	sub    $0x30,%rsp
+  801dc1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dc5:	89 f0                	mov    %esi,%eax
+  801dc7:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  801dca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dce:	48 89 c7             	mov    %rax,%rdi
+  801dd1:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  801dd8:	00 00 00 
+  801ddb:	ff d0                	call   *%rax
+  801ddd:	89 c2                	mov    %eax,%edx
+  801ddf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801de3:	48 89 c6             	mov    %rax,%rsi
+  801de6:	89 d7                	mov    %edx,%edi
+  801de8:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+  801df4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801df7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dfb:	78 0a                	js     801e07 <fd_close+0x4e>
+  801dfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e01:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  801e05:	74 12                	je     801e19 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  801e07:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  801e0b:	74 05                	je     801e12 <fd_close+0x59>
+  801e0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e10:	eb 70                	jmp    801e82 <fd_close+0xc9>
+  801e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e17:	eb 69                	jmp    801e82 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e1d:	8b 00                	mov    (%rax),%eax
+  801e1f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e23:	48 89 d6             	mov    %rdx,%rsi
+  801e26:	89 c7                	mov    %eax,%edi
+  801e28:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+  801e34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801e37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e3b:	78 2a                	js     801e67 <fd_close+0xae>
+    if (dev->dev_close)
+  801e3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e41:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e45:	48 85 c0             	test   %rax,%rax
+  801e48:	74 16                	je     801e60 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  801e4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e4e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  801e52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e56:	48 89 c7             	mov    %rax,%rdi
+  801e59:	ff d2                	call   *%rdx
+  801e5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801e5e:	eb 07                	jmp    801e67 <fd_close+0xae>
+    else
+      r = 0;
+  801e60:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  801e67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6b:	48 89 c6             	mov    %rax,%rsi
+  801e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e73:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+  return r;
+  801e7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801e82:	c9                   	leave
+  801e83:	c3                   	ret
+
+0000000000801e84 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801e84:	55                   	push   %rbp
+  801e85:	48 89 e5             	mov    %rsp,%rbp
+  801e88:	48 83 ec 20          	sub    $0x20,%rsp
+  801e8c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801e8f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  801e93:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801e9a:	eb 3f                	jmp    801edb <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  801e9c:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801ea3:	00 00 00 
+  801ea6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ea9:	48 98                	cltq
+  801eab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801eaf:	8b 00                	mov    (%rax),%eax
+  801eb1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  801eb4:	75 21                	jne    801ed7 <dev_lookup+0x53>
+      *dev = devtab[i];
+  801eb6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801ebd:	00 00 00 
+  801ec0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ec3:	48 98                	cltq
+  801ec5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ec9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ecd:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  801ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed5:	eb 7f                	jmp    801f56 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  801ed7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801edb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  801ee2:	00 00 00 
+  801ee5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ee8:	48 98                	cltq
+  801eea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801eee:	48 85 c0             	test   %rax,%rax
+  801ef1:	75 a9                	jne    801e9c <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ef3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801efa:	00 00 00 
+  801efd:	8b 40 04             	mov    0x4(%rax),%eax
+  801f00:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f05:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801f0c:	00 00 00 
+  801f0f:	48 98                	cltq
+  801f11:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801f18:	48 01 d0             	add    %rdx,%rax
+  801f1b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801f21:	8b 00                	mov    (%rax),%eax
+  801f23:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801f26:	89 c6                	mov    %eax,%esi
+  801f28:	48 b8 08 51 80 00 00 	movabs $0x805108,%rax
+  801f2f:	00 00 00 
+  801f32:	48 89 c7             	mov    %rax,%rdi
+  801f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3a:	48 b9 7b 42 80 00 00 	movabs $0x80427b,%rcx
+  801f41:	00 00 00 
+  801f44:	ff d1                	call   *%rcx
+  *dev = 0;
+  801f46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f4a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  801f51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+0000000000801f58 <close>:
+
+int
+close(int fdnum) {
+  801f58:	55                   	push   %rbp
+  801f59:	48 89 e5             	mov    %rsp,%rbp
+  801f5c:	48 83 ec 20          	sub    $0x20,%rsp
+  801f60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f63:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801f67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f6a:	48 89 d6             	mov    %rdx,%rsi
+  801f6d:	89 c7                	mov    %eax,%edi
+  801f6f:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+  801f7b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f7e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f82:	79 05                	jns    801f89 <close+0x31>
+    return r;
+  801f84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f87:	eb 18                	jmp    801fa1 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  801f89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f8d:	be 01 00 00 00       	mov    $0x1,%esi
+  801f92:	48 89 c7             	mov    %rax,%rdi
+  801f95:	48 b8 b9 1d 80 00 00 	movabs $0x801db9,%rax
+  801f9c:	00 00 00 
+  801f9f:	ff d0                	call   *%rax
+}
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+0000000000801fa3 <close_all>:
+
+void
+close_all(void) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  801fab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801fb2:	eb 15                	jmp    801fc9 <close_all+0x26>
+    close(i);
+  801fb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fb7:	89 c7                	mov    %eax,%edi
+  801fb9:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  801fc0:	00 00 00 
+  801fc3:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  801fc5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  801fc9:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  801fcd:	7e e5                	jle    801fb4 <close_all+0x11>
+}
+  801fcf:	90                   	nop
+  801fd0:	90                   	nop
+  801fd1:	c9                   	leave
+  801fd2:	c3                   	ret
+
+0000000000801fd3 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+  801fd7:	48 83 ec 40          	sub    $0x40,%rsp
+  801fdb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801fde:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801fe1:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801fe5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801fe8:	48 89 d6             	mov    %rdx,%rsi
+  801feb:	89 c7                	mov    %eax,%edi
+  801fed:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ffc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802000:	79 08                	jns    80200a <dup+0x37>
+    return r;
+  802002:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802005:	e9 33 02 00 00       	jmp    80223d <dup+0x26a>
+  close(newfdnum);
+  80200a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80200d:	89 c7                	mov    %eax,%edi
+  80200f:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  80201b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80201e:	c1 e0 0c             	shl    $0xc,%eax
+  802021:	48 98                	cltq
+  802023:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802028:	48 01 d0             	add    %rdx,%rax
+  80202b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80202f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802033:	48 89 c7             	mov    %rax,%rdi
+  802036:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  80203d:	00 00 00 
+  802040:	ff d0                	call   *%rax
+  802042:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802046:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204a:	48 89 c7             	mov    %rax,%rdi
+  80204d:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  802054:	00 00 00 
+  802057:	ff d0                	call   *%rax
+  802059:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  80205d:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802064:	00 
+  802065:	e9 19 01 00 00       	jmp    802183 <dup+0x1b0>
+    off -= PGSIZE;
+  80206a:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802071:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802072:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802076:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80207a:	48 01 d0             	add    %rdx,%rax
+  80207d:	48 c1 e8 27          	shr    $0x27,%rax
+  802081:	48 89 c2             	mov    %rax,%rdx
+  802084:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80208b:	01 00 00 
+  80208e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802092:	83 e0 01             	and    $0x1,%eax
+  802095:	48 85 c0             	test   %rax,%rax
+  802098:	0f 84 e5 00 00 00    	je     802183 <dup+0x1b0>
+  80209e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020a6:	48 01 d0             	add    %rdx,%rax
+  8020a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8020ad:	48 89 c2             	mov    %rax,%rdx
+  8020b0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8020b7:	01 00 00 
+  8020ba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8020be:	83 e0 01             	and    $0x1,%eax
+  8020c1:	48 85 c0             	test   %rax,%rax
+  8020c4:	0f 84 b9 00 00 00    	je     802183 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8020ca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020d2:	48 01 d0             	add    %rdx,%rax
+  8020d5:	48 c1 e8 15          	shr    $0x15,%rax
+  8020d9:	48 89 c2             	mov    %rax,%rdx
+  8020dc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8020e3:	01 00 00 
+  8020e6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8020ea:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8020ed:	48 85 c0             	test   %rax,%rax
+  8020f0:	0f 84 8d 00 00 00    	je     802183 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8020f6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020fe:	48 01 d0             	add    %rdx,%rax
+  802101:	48 c1 e8 0c          	shr    $0xc,%rax
+  802105:	48 89 c2             	mov    %rax,%rdx
+  802108:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80210f:	01 00 00 
+  802112:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802116:	83 e0 01             	and    $0x1,%eax
+  802119:	48 85 c0             	test   %rax,%rax
+  80211c:	74 65                	je     802183 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80211e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802122:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802126:	48 01 d0             	add    %rdx,%rax
+  802129:	48 c1 e8 0c          	shr    $0xc,%rax
+  80212d:	48 89 c2             	mov    %rax,%rdx
+  802130:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802137:	01 00 00 
+  80213a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80213e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802143:	89 c6                	mov    %eax,%esi
+  802145:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802149:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80214d:	48 01 c2             	add    %rax,%rdx
+  802150:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802154:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802158:	48 01 c8             	add    %rcx,%rax
+  80215b:	41 89 f0             	mov    %esi,%r8d
+  80215e:	48 89 d1             	mov    %rdx,%rcx
+  802161:	ba 00 00 00 00       	mov    $0x0,%edx
+  802166:	48 89 c6             	mov    %rax,%rsi
+  802169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216e:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80217d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802181:	78 60                	js     8021e3 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802183:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802188:	0f 85 dc fe ff ff    	jne    80206a <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80218e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802192:	48 c1 e8 0c          	shr    $0xc,%rax
+  802196:	48 89 c2             	mov    %rax,%rdx
+  802199:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8021a0:	01 00 00 
+  8021a3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8021a7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021ac:	89 c1                	mov    %eax,%ecx
+  8021ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021b6:	41 89 c8             	mov    %ecx,%r8d
+  8021b9:	48 89 d1             	mov    %rdx,%rcx
+  8021bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c1:	48 89 c6             	mov    %rax,%rsi
+  8021c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c9:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+  8021d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8021d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021dc:	78 08                	js     8021e6 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8021de:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8021e1:	eb 5a                	jmp    80223d <dup+0x26a>
+        goto err;
+  8021e3:	90                   	nop
+  8021e4:	eb 01                	jmp    8021e7 <dup+0x214>
+    goto err;
+  8021e6:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8021e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021eb:	48 89 c6             	mov    %rax,%rsi
+  8021ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f3:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8021fa:	00 00 00 
+  8021fd:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8021ff:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802206:	00 
+  802207:	eb 27                	jmp    802230 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802209:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80220d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802211:	48 01 d0             	add    %rdx,%rax
+  802214:	48 89 c6             	mov    %rax,%rsi
+  802217:	bf 00 00 00 00       	mov    $0x0,%edi
+  80221c:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  802223:	00 00 00 
+  802226:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802228:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80222f:	00 
+  802230:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802237:	00 
+  802238:	76 cf                	jbe    802209 <dup+0x236>
+  return r;
+  80223a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+
+000000000080223f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80223f:	55                   	push   %rbp
+  802240:	48 89 e5             	mov    %rsp,%rbp
+  802243:	48 83 ec 40          	sub    $0x40,%rsp
+  802247:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80224a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80224e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802252:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802256:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802259:	48 89 d6             	mov    %rdx,%rsi
+  80225c:	89 c7                	mov    %eax,%edi
+  80225e:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  802265:	00 00 00 
+  802268:	ff d0                	call   *%rax
+  80226a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80226d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802271:	78 24                	js     802297 <read+0x58>
+  802273:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802277:	8b 00                	mov    (%rax),%eax
+  802279:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80227d:	48 89 d6             	mov    %rdx,%rsi
+  802280:	89 c7                	mov    %eax,%edi
+  802282:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  802289:	00 00 00 
+  80228c:	ff d0                	call   *%rax
+  80228e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802291:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802295:	79 0a                	jns    8022a1 <read+0x62>
+    return r;
+  802297:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80229a:	48 98                	cltq
+  80229c:	e9 9e 00 00 00       	jmp    80233f <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8022a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022a5:	8b 40 08             	mov    0x8(%rax),%eax
+  8022a8:	83 e0 03             	and    $0x3,%eax
+  8022ab:	83 f8 01             	cmp    $0x1,%eax
+  8022ae:	75 5c                	jne    80230c <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022b0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022b7:	00 00 00 
+  8022ba:	8b 40 04             	mov    0x4(%rax),%eax
+  8022bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022c2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8022c9:	00 00 00 
+  8022cc:	48 98                	cltq
+  8022ce:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8022d5:	48 01 d0             	add    %rdx,%rax
+  8022d8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8022de:	8b 00                	mov    (%rax),%eax
+  8022e0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8022e3:	89 c6                	mov    %eax,%esi
+  8022e5:	48 b8 27 51 80 00 00 	movabs $0x805127,%rax
+  8022ec:	00 00 00 
+  8022ef:	48 89 c7             	mov    %rax,%rdi
+  8022f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f7:	48 b9 7b 42 80 00 00 	movabs $0x80427b,%rcx
+  8022fe:	00 00 00 
+  802301:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802303:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80230a:	eb 33                	jmp    80233f <read+0x100>
+  }
+  if (!dev->dev_read)
+  80230c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802310:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802314:	48 85 c0             	test   %rax,%rax
+  802317:	75 09                	jne    802322 <read+0xe3>
+    return -E_NOT_SUPP;
+  802319:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802320:	eb 1d                	jmp    80233f <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802326:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80232a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80232e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802332:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802336:	48 89 ce             	mov    %rcx,%rsi
+  802339:	48 89 c7             	mov    %rax,%rdi
+  80233c:	41 ff d0             	call   *%r8
+}
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+
+0000000000802341 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	48 83 ec 30          	sub    $0x30,%rsp
+  802349:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80234c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802350:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802354:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80235b:	eb 49                	jmp    8023a6 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80235d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802360:	48 98                	cltq
+  802362:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802366:	48 29 c2             	sub    %rax,%rdx
+  802369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80236c:	48 63 c8             	movslq %eax,%rcx
+  80236f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802373:	48 01 c1             	add    %rax,%rcx
+  802376:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802379:	48 89 ce             	mov    %rcx,%rsi
+  80237c:	89 c7                	mov    %eax,%edi
+  80237e:	48 b8 3f 22 80 00 00 	movabs $0x80223f,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80238d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802391:	79 07                	jns    80239a <readn+0x59>
+      return m;
+  802393:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802396:	48 98                	cltq
+  802398:	eb 1f                	jmp    8023b9 <readn+0x78>
+    if (m == 0)
+  80239a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80239e:	74 13                	je     8023b3 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8023a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023a3:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8023a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023a9:	48 98                	cltq
+  8023ab:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8023af:	72 ac                	jb     80235d <readn+0x1c>
+  8023b1:	eb 01                	jmp    8023b4 <readn+0x73>
+      break;
+  8023b3:	90                   	nop
+  }
+  return tot;
+  8023b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023b7:	48 98                	cltq
+}
+  8023b9:	c9                   	leave
+  8023ba:	c3                   	ret
+
+00000000008023bb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8023bb:	55                   	push   %rbp
+  8023bc:	48 89 e5             	mov    %rsp,%rbp
+  8023bf:	48 83 ec 40          	sub    $0x40,%rsp
+  8023c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8023c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8023ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023ce:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8023d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8023d5:	48 89 d6             	mov    %rdx,%rsi
+  8023d8:	89 c7                	mov    %eax,%edi
+  8023da:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8023e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8023ed:	78 24                	js     802413 <write+0x58>
+  8023ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023f3:	8b 00                	mov    (%rax),%eax
+  8023f5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8023f9:	48 89 d6             	mov    %rdx,%rsi
+  8023fc:	89 c7                	mov    %eax,%edi
+  8023fe:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  802405:	00 00 00 
+  802408:	ff d0                	call   *%rax
+  80240a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80240d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802411:	79 0a                	jns    80241d <write+0x62>
+    return r;
+  802413:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802416:	48 98                	cltq
+  802418:	e9 9d 00 00 00       	jmp    8024ba <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80241d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802421:	8b 40 08             	mov    0x8(%rax),%eax
+  802424:	83 e0 03             	and    $0x3,%eax
+  802427:	85 c0                	test   %eax,%eax
+  802429:	75 5c                	jne    802487 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80242b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802432:	00 00 00 
+  802435:	8b 40 04             	mov    0x4(%rax),%eax
+  802438:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80243d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802444:	00 00 00 
+  802447:	48 98                	cltq
+  802449:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802450:	48 01 d0             	add    %rdx,%rax
+  802453:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802459:	8b 00                	mov    (%rax),%eax
+  80245b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80245e:	89 c6                	mov    %eax,%esi
+  802460:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  802467:	00 00 00 
+  80246a:	48 89 c7             	mov    %rax,%rdi
+  80246d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802472:	48 b9 7b 42 80 00 00 	movabs $0x80427b,%rcx
+  802479:	00 00 00 
+  80247c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80247e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802485:	eb 33                	jmp    8024ba <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802487:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80248b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80248f:	48 85 c0             	test   %rax,%rax
+  802492:	75 09                	jne    80249d <write+0xe2>
+    return -E_NOT_SUPP;
+  802494:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80249b:	eb 1d                	jmp    8024ba <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80249d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024a1:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8024a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024a9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8024ad:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8024b1:	48 89 ce             	mov    %rcx,%rsi
+  8024b4:	48 89 c7             	mov    %rax,%rdi
+  8024b7:	41 ff d0             	call   *%r8
+}
+  8024ba:	c9                   	leave
+  8024bb:	c3                   	ret
+
+00000000008024bc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8024bc:	55                   	push   %rbp
+  8024bd:	48 89 e5             	mov    %rsp,%rbp
+  8024c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024c7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024ca:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8024ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024d1:	48 89 d6             	mov    %rdx,%rsi
+  8024d4:	89 c7                	mov    %eax,%edi
+  8024d6:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024e5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024e9:	79 05                	jns    8024f0 <seek+0x34>
+    return r;
+  8024eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ee:	eb 0f                	jmp    8024ff <seek+0x43>
+  fd->fd_offset = offset;
+  8024f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024f4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8024f7:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8024fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+0000000000802501 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+  802505:	48 83 ec 30          	sub    $0x30,%rsp
+  802509:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80250c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80250f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802513:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802516:	48 89 d6             	mov    %rdx,%rsi
+  802519:	89 c7                	mov    %eax,%edi
+  80251b:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+  802527:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80252a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80252e:	78 24                	js     802554 <ftruncate+0x53>
+  802530:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802534:	8b 00                	mov    (%rax),%eax
+  802536:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80253a:	48 89 d6             	mov    %rdx,%rsi
+  80253d:	89 c7                	mov    %eax,%edi
+  80253f:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+  80254b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80254e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802552:	79 08                	jns    80255c <ftruncate+0x5b>
+    return r;
+  802554:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802557:	e9 92 00 00 00       	jmp    8025ee <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80255c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802560:	8b 40 08             	mov    0x8(%rax),%eax
+  802563:	83 e0 03             	and    $0x3,%eax
+  802566:	85 c0                	test   %eax,%eax
+  802568:	75 5a                	jne    8025c4 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80256a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802571:	00 00 00 
+  802574:	8b 40 04             	mov    0x4(%rax),%eax
+  802577:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80257c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802583:	00 00 00 
+  802586:	48 98                	cltq
+  802588:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80258f:	48 01 d0             	add    %rdx,%rax
+  802592:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802598:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80259a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80259d:	89 c6                	mov    %eax,%esi
+  80259f:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8025a6:	00 00 00 
+  8025a9:	48 89 c7             	mov    %rax,%rdi
+  8025ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b1:	48 b9 7b 42 80 00 00 	movabs $0x80427b,%rcx
+  8025b8:	00 00 00 
+  8025bb:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8025bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025c2:	eb 2a                	jmp    8025ee <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8025c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025c8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8025cc:	48 85 c0             	test   %rax,%rax
+  8025cf:	75 07                	jne    8025d8 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8025d1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8025d6:	eb 16                	jmp    8025ee <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8025d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025dc:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8025e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025e4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8025e7:	89 d6                	mov    %edx,%esi
+  8025e9:	48 89 c7             	mov    %rax,%rdi
+  8025ec:	ff d1                	call   *%rcx
+}
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+
+00000000008025f0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8025f0:	55                   	push   %rbp
+  8025f1:	48 89 e5             	mov    %rsp,%rbp
+  8025f4:	48 83 ec 30          	sub    $0x30,%rsp
+  8025f8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8025fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025ff:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802603:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802606:	48 89 d6             	mov    %rdx,%rsi
+  802609:	89 c7                	mov    %eax,%edi
+  80260b:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+  802617:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80261a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80261e:	78 24                	js     802644 <fstat+0x54>
+  802620:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802624:	8b 00                	mov    (%rax),%eax
+  802626:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80262a:	48 89 d6             	mov    %rdx,%rsi
+  80262d:	89 c7                	mov    %eax,%edi
+  80262f:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+  80263b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80263e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802642:	79 05                	jns    802649 <fstat+0x59>
+    return r;
+  802644:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802647:	eb 5e                	jmp    8026a7 <fstat+0xb7>
+  if (!dev->dev_stat)
+  802649:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80264d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802651:	48 85 c0             	test   %rax,%rax
+  802654:	75 07                	jne    80265d <fstat+0x6d>
+    return -E_NOT_SUPP;
+  802656:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80265b:	eb 4a                	jmp    8026a7 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80265d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802661:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  802664:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802668:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80266f:	00 00 00 
+  stat->st_isdir   = 0;
+  802672:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802676:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80267d:	00 00 00 
+  stat->st_dev     = dev;
+  802680:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802684:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802688:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80268f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802693:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  802697:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80269b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80269f:	48 89 d6             	mov    %rdx,%rsi
+  8026a2:	48 89 c7             	mov    %rax,%rdi
+  8026a5:	ff d1                	call   *%rcx
+}
+  8026a7:	c9                   	leave
+  8026a8:	c3                   	ret
+
+00000000008026a9 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+  8026ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8026b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8026b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026bd:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8026c3:	83 f8 20             	cmp    $0x20,%eax
+  8026c6:	75 07                	jne    8026cf <pollwait_key+0x26>
+    return -E_INVAL;
+  8026c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026cd:	eb 5f                	jmp    80272e <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8026cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d3:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8026d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026dd:	48 63 d2             	movslq %edx,%rdx
+  8026e0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8026e4:	48 01 c2             	add    %rax,%rdx
+  8026e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026eb:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8026ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f2:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8026f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026fc:	8b 00                	mov    (%rax),%eax
+  8026fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802702:	48 63 c9             	movslq %ecx,%rcx
+  802705:	48 c1 e1 04          	shl    $0x4,%rcx
+  802709:	48 01 ca             	add    %rcx,%rdx
+  80270c:	48 83 c2 08          	add    $0x8,%rdx
+  802710:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  802712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802716:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80271c:	8d 50 01             	lea    0x1(%rax),%edx
+  80271f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802723:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  802729:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272e:	c9                   	leave
+  80272f:	c3                   	ret
+
+0000000000802730 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80273b:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  802742:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  802748:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80274f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802756:	00 
+  int i, r, ready, ipc = 0;
+  802757:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80275e:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  802765:	00 
+  802766:	74 45                	je     8027ad <poll+0x7d>
+  802768:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80276f:	ff 
+  802770:	74 3b                	je     8027ad <poll+0x7d>
+    now      = vsys_clock_ns();
+  802772:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+  80277e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  802782:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802786:	48 f7 d0             	not    %rax
+  802789:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  802790:	73 10                	jae    8027a2 <poll+0x72>
+  802792:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802796:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80279d:	48 01 d0             	add    %rdx,%rax
+  8027a0:	eb 07                	jmp    8027a9 <poll+0x79>
+  8027a2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8027a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8027ad:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8027b4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8027bb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8027c2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8027c9:	e9 46 02 00 00       	jmp    802a14 <poll+0x2e4>
+      fds[i].revents = 0;
+  8027ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027d1:	48 63 d0             	movslq %eax,%rdx
+  8027d4:	48 89 d0             	mov    %rdx,%rax
+  8027d7:	48 01 c0             	add    %rax,%rax
+  8027da:	48 01 d0             	add    %rdx,%rax
+  8027dd:	48 c1 e0 02          	shl    $0x2,%rax
+  8027e1:	48 89 c2             	mov    %rax,%rdx
+  8027e4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8027eb:	48 01 d0             	add    %rdx,%rax
+  8027ee:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8027f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027f8:	48 63 d0             	movslq %eax,%rdx
+  8027fb:	48 89 d0             	mov    %rdx,%rax
+  8027fe:	48 01 c0             	add    %rax,%rax
+  802801:	48 01 d0             	add    %rdx,%rax
+  802804:	48 c1 e0 02          	shl    $0x2,%rax
+  802808:	48 89 c2             	mov    %rax,%rdx
+  80280b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802812:	48 01 d0             	add    %rdx,%rax
+  802815:	8b 00                	mov    (%rax),%eax
+  802817:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80281a:	75 62                	jne    80287e <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80281c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80281f:	48 63 d0             	movslq %eax,%rdx
+  802822:	48 89 d0             	mov    %rdx,%rax
+  802825:	48 01 c0             	add    %rax,%rax
+  802828:	48 01 d0             	add    %rdx,%rax
+  80282b:	48 c1 e0 02          	shl    $0x2,%rax
+  80282f:	48 89 c2             	mov    %rax,%rdx
+  802832:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802839:	48 01 d0             	add    %rdx,%rax
+  80283c:	8b 40 04             	mov    0x4(%rax),%eax
+  80283f:	83 e0 01             	and    $0x1,%eax
+  802842:	85 c0                	test   %eax,%eax
+  802844:	0f 84 9b 01 00 00    	je     8029e5 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80284a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80284d:	48 63 d0             	movslq %eax,%rdx
+  802850:	48 89 d0             	mov    %rdx,%rax
+  802853:	48 01 c0             	add    %rax,%rax
+  802856:	48 01 d0             	add    %rdx,%rax
+  802859:	48 c1 e0 02          	shl    $0x2,%rax
+  80285d:	48 89 c2             	mov    %rax,%rdx
+  802860:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802867:	48 01 c2             	add    %rax,%rdx
+  80286a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80286d:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  802870:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802873:	83 c8 04             	or     $0x4,%eax
+  802876:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  802879:	e9 67 01 00 00       	jmp    8029e5 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80287e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802881:	48 63 d0             	movslq %eax,%rdx
+  802884:	48 89 d0             	mov    %rdx,%rax
+  802887:	48 01 c0             	add    %rax,%rax
+  80288a:	48 01 d0             	add    %rdx,%rax
+  80288d:	48 c1 e0 02          	shl    $0x2,%rax
+  802891:	48 89 c2             	mov    %rax,%rdx
+  802894:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80289b:	48 01 d0             	add    %rdx,%rax
+  80289e:	8b 00                	mov    (%rax),%eax
+  8028a0:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8028a7:	48 89 d6             	mov    %rdx,%rsi
+  8028aa:	89 c7                	mov    %eax,%edi
+  8028ac:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	78 25                	js     8028e1 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8028bc:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8028c3:	8b 00                	mov    (%rax),%eax
+  8028c5:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8028cc:	48 89 d6             	mov    %rdx,%rsi
+  8028cf:	89 c7                	mov    %eax,%edi
+  8028d1:	48 b8 84 1e 80 00 00 	movabs $0x801e84,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	79 2c                	jns    80290d <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8028e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8028e4:	48 63 d0             	movslq %eax,%rdx
+  8028e7:	48 89 d0             	mov    %rdx,%rax
+  8028ea:	48 01 c0             	add    %rax,%rax
+  8028ed:	48 01 d0             	add    %rdx,%rax
+  8028f0:	48 c1 e0 02          	shl    $0x2,%rax
+  8028f4:	48 89 c2             	mov    %rax,%rdx
+  8028f7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8028fe:	48 01 d0             	add    %rdx,%rax
+  802901:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  802908:	e9 d8 00 00 00       	jmp    8029e5 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80290d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  802914:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802918:	48 85 c0             	test   %rax,%rax
+  80291b:	74 7d                	je     80299a <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80291d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  802924:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  802928:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80292b:	48 63 d0             	movslq %eax,%rdx
+  80292e:	48 89 d0             	mov    %rdx,%rax
+  802931:	48 01 c0             	add    %rax,%rax
+  802934:	48 01 d0             	add    %rdx,%rax
+  802937:	48 c1 e0 02          	shl    $0x2,%rax
+  80293b:	48 89 c2             	mov    %rax,%rdx
+  80293e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802945:	48 01 d0             	add    %rdx,%rax
+  802948:	8b 48 04             	mov    0x4(%rax),%ecx
+  80294b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  802952:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  802959:	89 ce                	mov    %ecx,%esi
+  80295b:	48 89 c7             	mov    %rax,%rdi
+  80295e:	41 ff d0             	call   *%r8
+  802961:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802964:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802968:	79 08                	jns    802972 <poll+0x242>
+          return r;
+  80296a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80296d:	e9 45 01 00 00       	jmp    802ab7 <poll+0x387>
+        fds[i].revents = r;
+  802972:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802975:	48 63 d0             	movslq %eax,%rdx
+  802978:	48 89 d0             	mov    %rdx,%rax
+  80297b:	48 01 c0             	add    %rax,%rax
+  80297e:	48 01 d0             	add    %rdx,%rax
+  802981:	48 c1 e0 02          	shl    $0x2,%rax
+  802985:	48 89 c2             	mov    %rax,%rdx
+  802988:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80298f:	48 01 c2             	add    %rax,%rdx
+  802992:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802995:	89 42 08             	mov    %eax,0x8(%rdx)
+  802998:	eb 4b                	jmp    8029e5 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80299a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80299d:	48 63 d0             	movslq %eax,%rdx
+  8029a0:	48 89 d0             	mov    %rdx,%rax
+  8029a3:	48 01 c0             	add    %rax,%rax
+  8029a6:	48 01 d0             	add    %rdx,%rax
+  8029a9:	48 c1 e0 02          	shl    $0x2,%rax
+  8029ad:	48 89 c2             	mov    %rax,%rdx
+  8029b0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8029b7:	48 01 d0             	add    %rdx,%rax
+  8029ba:	8b 48 04             	mov    0x4(%rax),%ecx
+  8029bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029c0:	48 63 d0             	movslq %eax,%rdx
+  8029c3:	48 89 d0             	mov    %rdx,%rax
+  8029c6:	48 01 c0             	add    %rax,%rax
+  8029c9:	48 01 d0             	add    %rdx,%rax
+  8029cc:	48 c1 e0 02          	shl    $0x2,%rax
+  8029d0:	48 89 c2             	mov    %rax,%rdx
+  8029d3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8029da:	48 01 d0             	add    %rdx,%rax
+  8029dd:	83 e1 03             	and    $0x3,%ecx
+  8029e0:	89 ca                	mov    %ecx,%edx
+  8029e2:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8029e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029e8:	48 63 d0             	movslq %eax,%rdx
+  8029eb:	48 89 d0             	mov    %rdx,%rax
+  8029ee:	48 01 c0             	add    %rax,%rax
+  8029f1:	48 01 d0             	add    %rdx,%rax
+  8029f4:	48 c1 e0 02          	shl    $0x2,%rax
+  8029f8:	48 89 c2             	mov    %rax,%rdx
+  8029fb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802a02:	48 01 d0             	add    %rdx,%rax
+  802a05:	8b 40 08             	mov    0x8(%rax),%eax
+  802a08:	85 c0                	test   %eax,%eax
+  802a0a:	74 04                	je     802a10 <poll+0x2e0>
+        ready++;
+  802a0c:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  802a10:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  802a14:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a17:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  802a1d:	0f 8c ab fd ff ff    	jl     8027ce <poll+0x9e>
+    }
+    if (ready)
+  802a23:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  802a27:	74 08                	je     802a31 <poll+0x301>
+      return ready;
+  802a29:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802a2c:	e9 86 00 00 00       	jmp    802ab7 <poll+0x387>
+
+    if (deadline) {
+  802a31:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802a36:	74 30                	je     802a68 <poll+0x338>
+      now     = vsys_clock_ns();
+  802a38:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  802a48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a4c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802a50:	73 0a                	jae    802a5c <poll+0x32c>
+  802a52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a56:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  802a5a:	eb 05                	jmp    802a61 <poll+0x331>
+  802a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a61:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  802a68:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802a6b:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  802a6e:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  802a75:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  802a7c:	48 89 c7             	mov    %rax,%rdi
+  802a7f:	48 b8 14 19 80 00 00 	movabs $0x801914,%rax
+  802a86:	00 00 00 
+  802a89:	ff d0                	call   *%rax
+  802a8b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  802a8e:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  802a92:	75 07                	jne    802a9b <poll+0x36b>
+      return 0;
+  802a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a99:	eb 1c                	jmp    802ab7 <poll+0x387>
+    if (r < 0)
+  802a9b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802a9f:	79 05                	jns    802aa6 <poll+0x376>
+      return r;
+  802aa1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802aa4:	eb 11                	jmp    802ab7 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  802aa6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802aa9:	c1 f8 02             	sar    $0x2,%eax
+  802aac:	83 e0 01             	and    $0x1,%eax
+  802aaf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  802ab2:	e9 f6 fc ff ff       	jmp    8027ad <poll+0x7d>
+  }
+}
+  802ab7:	c9                   	leave
+  802ab8:	c3                   	ret
+
+0000000000802ab9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802ab9:	55                   	push   %rbp
+  802aba:	48 89 e5             	mov    %rsp,%rbp
+  802abd:	48 83 ec 20          	sub    $0x20,%rsp
+  802ac1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ac5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  802ac9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802acd:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad2:	48 89 c7             	mov    %rax,%rdi
+  802ad5:	48 b8 a7 2b 80 00 00 	movabs $0x802ba7,%rax
+  802adc:	00 00 00 
+  802adf:	ff d0                	call   *%rax
+  802ae1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ae4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ae8:	79 05                	jns    802aef <stat+0x36>
+    return fd;
+  802aea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aed:	eb 2f                	jmp    802b1e <stat+0x65>
+  r = fstat(fd, stat);
+  802aef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802af6:	48 89 d6             	mov    %rdx,%rsi
+  802af9:	89 c7                	mov    %eax,%edi
+  802afb:	48 b8 f0 25 80 00 00 	movabs $0x8025f0,%rax
+  802b02:	00 00 00 
+  802b05:	ff d0                	call   *%rax
+  802b07:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  802b0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b0d:	89 c7                	mov    %eax,%edi
+  802b0f:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+  return r;
+  802b1b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802b1e:	c9                   	leave
+  802b1f:	c3                   	ret
+
+0000000000802b20 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  802b20:	55                   	push   %rbp
+  802b21:	48 89 e5             	mov    %rsp,%rbp
+  802b24:	48 83 ec 10          	sub    $0x10,%rsp
+  802b28:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  802b2f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802b36:	00 00 00 
+  802b39:	8b 00                	mov    (%rax),%eax
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	75 1d                	jne    802b5c <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  802b3f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b44:	48 b8 4c 4f 80 00 00 	movabs $0x804f4c,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+  802b50:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  802b57:	00 00 00 
+  802b5a:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802b5c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802b63:	00 00 00 
+  802b66:	8b 00                	mov    (%rax),%eax
+  802b68:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  802b6b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802b70:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802b77:	00 00 00 
+  802b7a:	89 c7                	mov    %eax,%edi
+  802b7c:	48 b8 9f 4e 80 00 00 	movabs $0x804e9f,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  802b88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b91:	48 89 c6             	mov    %rax,%rsi
+  802b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b99:	48 b8 22 4d 80 00 00 	movabs $0x804d22,%rax
+  802ba0:	00 00 00 
+  802ba3:	ff d0                	call   *%rax
+}
+  802ba5:	c9                   	leave
+  802ba6:	c3                   	ret
+
+0000000000802ba7 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  802ba7:	55                   	push   %rbp
+  802ba8:	48 89 e5             	mov    %rsp,%rbp
+  802bab:	48 83 ec 20          	sub    $0x20,%rsp
+  802baf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802bb3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  802bb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bba:	48 89 c7             	mov    %rax,%rdi
+  802bbd:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  802bc4:	00 00 00 
+  802bc7:	ff d0                	call   *%rax
+  802bc9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802bce:	7e 0a                	jle    802bda <open+0x33>
+    return -E_BAD_PATH;
+  802bd0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bd5:	e9 a8 00 00 00       	jmp    802c82 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802bda:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802bde:	48 89 c7             	mov    %rax,%rdi
+  802be1:	48 b8 01 1c 80 00 00 	movabs $0x801c01,%rax
+  802be8:	00 00 00 
+  802beb:	ff d0                	call   *%rax
+  802bed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bf0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bf4:	79 08                	jns    802bfe <open+0x57>
+    return r;
+  802bf6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bf9:	e9 84 00 00 00       	jmp    802c82 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  802bfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c02:	48 89 c6             	mov    %rax,%rsi
+  802c05:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802c0c:	00 00 00 
+  802c0f:	48 89 c7             	mov    %rax,%rdi
+  802c12:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  802c19:	00 00 00 
+  802c1c:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  802c1e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802c25:	00 00 00 
+  802c28:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c2b:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802c31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c35:	48 89 c6             	mov    %rax,%rsi
+  802c38:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c3d:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802c44:	00 00 00 
+  802c47:	ff d0                	call   *%rax
+  802c49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c50:	79 1d                	jns    802c6f <open+0xc8>
+    fd_close(fd, 0);
+  802c52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c56:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5b:	48 89 c7             	mov    %rax,%rdi
+  802c5e:	48 b8 b9 1d 80 00 00 	movabs $0x801db9,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+    return r;
+  802c6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c6d:	eb 13                	jmp    802c82 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  802c6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c73:	48 89 c7             	mov    %rax,%rdi
+  802c76:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  802c7d:	00 00 00 
+  802c80:	ff d0                	call   *%rax
+}
+  802c82:	c9                   	leave
+  802c83:	c3                   	ret
+
+0000000000802c84 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  802c84:	55                   	push   %rbp
+  802c85:	48 89 e5             	mov    %rsp,%rbp
+  802c88:	48 83 ec 10          	sub    $0x10,%rsp
+  802c8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c94:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c97:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802c9e:	00 00 00 
+  802ca1:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  802ca3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca8:	bf 06 00 00 00       	mov    $0x6,%edi
+  802cad:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+}
+  802cb9:	c9                   	leave
+  802cba:	c3                   	ret
+
+0000000000802cbb <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802cbb:	55                   	push   %rbp
+  802cbc:	48 89 e5             	mov    %rsp,%rbp
+  802cbf:	48 83 ec 30          	sub    $0x30,%rsp
+  802cc3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802cc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802ccb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  802ccf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802cd4:	74 07                	je     802cdd <devfile_read+0x22>
+  802cd6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802cdb:	75 0a                	jne    802ce7 <devfile_read+0x2c>
+  return E_INVAL;
+  802cdd:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ce2:	e9 b4 00 00 00       	jmp    802d9b <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  802ce7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802cee:	00 
+  while (n) {
+  802cef:	e9 98 00 00 00       	jmp    802d8c <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf8:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cfb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802d02:	00 00 00 
+  802d05:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  802d07:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802d0e:	00 00 00 
+  802d11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d15:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  802d19:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d23:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802d2a:	00 00 00 
+  802d2d:	ff d0                	call   *%rax
+  802d2f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  802d32:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802d36:	7f 13                	jg     802d4b <devfile_read+0x90>
+      return res ? res : res0;
+  802d38:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802d3c:	74 07                	je     802d45 <devfile_read+0x8a>
+  802d3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d41:	48 98                	cltq
+  802d43:	eb 56                	jmp    802d9b <devfile_read+0xe0>
+  802d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d49:	eb 50                	jmp    802d9b <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802d4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d4e:	48 63 d0             	movslq %eax,%rdx
+  802d51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d55:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  802d5c:	00 00 00 
+  802d5f:	48 89 ce             	mov    %rcx,%rsi
+  802d62:	48 89 c7             	mov    %rax,%rdi
+  802d65:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  802d6c:	00 00 00 
+  802d6f:	ff d0                	call   *%rax
+
+    buf += res;
+  802d71:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d74:	48 98                	cltq
+  802d76:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  802d7a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d7d:	48 98                	cltq
+  802d7f:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  802d83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d86:	48 98                	cltq
+  802d88:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  802d8c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802d91:	0f 85 5d ff ff ff    	jne    802cf4 <devfile_read+0x39>
+  }
+
+  return res0;
+  802d97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  802d9b:	c9                   	leave
+  802d9c:	c3                   	ret
+
+0000000000802d9d <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d9d:	55                   	push   %rbp
+  802d9e:	48 89 e5             	mov    %rsp,%rbp
+  802da1:	48 83 ec 50          	sub    $0x50,%rsp
+  802da5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802da9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802dad:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  802db1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802db6:	74 07                	je     802dbf <devfile_write+0x22>
+  802db8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  802dbd:	75 0a                	jne    802dc9 <devfile_write+0x2c>
+  return E_INVAL;
+  802dbf:	b8 03 00 00 00       	mov    $0x3,%eax
+  802dc4:	e9 c9 00 00 00       	jmp    802e92 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  802dc9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802dd0:	00 
+
+  while (n) {
+  802dd1:	e9 ad 00 00 00       	jmp    802e83 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802dd6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802dda:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802dde:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  802de5:	00 
+  802de6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dee:	48 39 c2             	cmp    %rax,%rdx
+  802df1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802df5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  802df9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802dfd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e01:	48 89 c6             	mov    %rax,%rsi
+  802e04:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  802e0b:	00 00 00 
+  802e0e:	48 89 c7             	mov    %rax,%rdi
+  802e11:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802e1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e21:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e24:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802e2b:	00 00 00 
+  802e2e:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  802e30:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802e37:	00 00 00 
+  802e3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e3e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  802e42:	be 00 00 00 00       	mov    $0x0,%esi
+  802e47:	bf 04 00 00 00       	mov    $0x4,%edi
+  802e4c:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+  802e58:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  802e5b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802e5f:	79 07                	jns    802e68 <devfile_write+0xcb>
+      return res;
+  802e61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e64:	48 98                	cltq
+  802e66:	eb 2a                	jmp    802e92 <devfile_write+0xf5>
+
+    buf += res;
+  802e68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e6b:	48 98                	cltq
+  802e6d:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  802e71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e74:	48 98                	cltq
+  802e76:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  802e7a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e7d:	48 98                	cltq
+  802e7f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  802e83:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  802e88:	0f 85 48 ff ff ff    	jne    802dd6 <devfile_write+0x39>
+  }
+
+  return res0;
+  802e8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  802e92:	c9                   	leave
+  802e93:	c3                   	ret
+
+0000000000802e94 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e94:	55                   	push   %rbp
+  802e95:	48 89 e5             	mov    %rsp,%rbp
+  802e98:	48 83 ec 20          	sub    $0x20,%rsp
+  802e9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ea0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ea4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ea8:	8b 40 0c             	mov    0xc(%rax),%eax
+  802eab:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802eb2:	00 00 00 
+  802eb5:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802eb7:	be 00 00 00 00       	mov    $0x0,%esi
+  802ebc:	bf 05 00 00 00       	mov    $0x5,%edi
+  802ec1:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ed0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ed4:	79 05                	jns    802edb <devfile_stat+0x47>
+    return r;
+  802ed6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ed9:	eb 59                	jmp    802f34 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802edb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802edf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802ee6:	00 00 00 
+  802ee9:	48 89 d6             	mov    %rdx,%rsi
+  802eec:	48 89 c7             	mov    %rax,%rdi
+  802eef:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  802efb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f02:	00 00 00 
+  802f05:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  802f0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f0f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f15:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f1c:	00 00 00 
+  802f1f:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  802f25:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f29:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  802f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f34:	c9                   	leave
+  802f35:	c3                   	ret
+
+0000000000802f36 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f36:	55                   	push   %rbp
+  802f37:	48 89 e5             	mov    %rsp,%rbp
+  802f3a:	48 83 ec 10          	sub    $0x10,%rsp
+  802f3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f42:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f49:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802f53:	00 00 00 
+  802f56:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  802f58:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802f5f:	00 00 00 
+  802f62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802f65:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  802f68:	be 00 00 00 00       	mov    $0x0,%esi
+  802f6d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f72:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802f79:	00 00 00 
+  802f7c:	ff d0                	call   *%rax
+}
+  802f7e:	c9                   	leave
+  802f7f:	c3                   	ret
+
+0000000000802f80 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802f80:	55                   	push   %rbp
+  802f81:	48 89 e5             	mov    %rsp,%rbp
+  802f84:	48 83 ec 18          	sub    $0x18,%rsp
+  802f88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f8c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802f8f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  802f93:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802f96:	83 e0 03             	and    $0x3,%eax
+}
+  802f99:	c9                   	leave
+  802f9a:	c3                   	ret
+
+0000000000802f9b <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  802f9b:	55                   	push   %rbp
+  802f9c:	48 89 e5             	mov    %rsp,%rbp
+  802f9f:	48 83 ec 10          	sub    $0x10,%rsp
+  802fa3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  802fa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fab:	48 89 c7             	mov    %rax,%rdi
+  802fae:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+  802fba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802fbf:	7e 07                	jle    802fc8 <remove+0x2d>
+    return -E_BAD_PATH;
+  802fc1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802fc6:	eb 36                	jmp    802ffe <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  802fc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fcc:	48 89 c6             	mov    %rax,%rsi
+  802fcf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802fd6:	00 00 00 
+  802fd9:	48 89 c7             	mov    %rax,%rdi
+  802fdc:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  802fe3:	00 00 00 
+  802fe6:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  802fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fed:	bf 07 00 00 00       	mov    $0x7,%edi
+  802ff2:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  802ff9:	00 00 00 
+  802ffc:	ff d0                	call   *%rax
+}
+  802ffe:	c9                   	leave
+  802fff:	c3                   	ret
+
+0000000000803000 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803000:	55                   	push   %rbp
+  803001:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803004:	be 00 00 00 00       	mov    $0x0,%esi
+  803009:	bf 08 00 00 00       	mov    $0x8,%edi
+  80300e:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+}
+  80301a:	5d                   	pop    %rbp
+  80301b:	c3                   	ret
+
+000000000080301c <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  80301c:	55                   	push   %rbp
+  80301d:	48 89 e5             	mov    %rsp,%rbp
+  803020:	48 83 ec 20          	sub    $0x20,%rsp
+  803024:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803028:	be 00 00 00 00       	mov    $0x0,%esi
+  80302d:	bf 09 00 00 00       	mov    $0x9,%edi
+  803032:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  803039:	00 00 00 
+  80303c:	ff d0                	call   *%rax
+  80303e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803041:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803045:	79 05                	jns    80304c <fs_stats+0x30>
+    return r;
+  803047:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80304a:	eb 2a                	jmp    803076 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  80304c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803050:	ba 68 00 00 00       	mov    $0x68,%edx
+  803055:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80305c:	00 00 00 
+  80305f:	48 89 ce             	mov    %rcx,%rsi
+  803062:	48 89 c7             	mov    %rax,%rdi
+  803065:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  80306c:	00 00 00 
+  80306f:	ff d0                	call   *%rax
+  return 0;
+  803071:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+0000000000803078 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803078:	55                   	push   %rbp
+  803079:	48 89 e5             	mov    %rsp,%rbp
+  80307c:	48 83 ec 10          	sub    $0x10,%rsp
+  803080:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803083:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80308a:	00 00 00 
+  80308d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803090:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803092:	be 00 00 00 00       	mov    $0x0,%esi
+  803097:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80309c:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+}
+  8030a8:	c9                   	leave
+  8030a9:	c3                   	ret
+
+00000000008030aa <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8030b2:	89 f8                	mov    %edi,%eax
+  8030b4:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8030b7:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8030bb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8030c2:	00 00 00 
+  8030c5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8030c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8030d1:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+}
+  8030dd:	c9                   	leave
+  8030de:	c3                   	ret
+
+00000000008030df <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8030df:	55                   	push   %rbp
+  8030e0:	48 89 e5             	mov    %rsp,%rbp
+  8030e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8030e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8030eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030ef:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8030f4:	48 89 c7             	mov    %rax,%rdi
+  8030f7:	48 b8 05 31 80 00 00 	movabs $0x803105,%rax
+  8030fe:	00 00 00 
+  803101:	ff d0                	call   *%rax
+}
+  803103:	c9                   	leave
+  803104:	c3                   	ret
+
+0000000000803105 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803105:	55                   	push   %rbp
+  803106:	48 89 e5             	mov    %rsp,%rbp
+  803109:	48 83 ec 50          	sub    $0x50,%rsp
+  80310d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803111:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803115:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80311c:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80311d:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803122:	74 0a                	je     80312e <pipe_size+0x29>
+  803124:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80312b:	00 
+  80312c:	76 0a                	jbe    803138 <pipe_size+0x33>
+    return -E_INVAL;
+  80312e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803133:	e9 cc 02 00 00       	jmp    803404 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803138:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80313c:	48 89 c7             	mov    %rax,%rdi
+  80313f:	48 b8 01 1c 80 00 00 	movabs $0x801c01,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80314e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803152:	0f 88 a8 02 00 00    	js     803400 <pipe_size+0x2fb>
+  803158:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80315c:	ba 07 04 00 00       	mov    $0x407,%edx
+  803161:	48 89 c6             	mov    %rax,%rsi
+  803164:	bf 00 00 00 00       	mov    $0x0,%edi
+  803169:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803178:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80317c:	0f 88 7e 02 00 00    	js     803400 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803182:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803186:	48 89 c7             	mov    %rax,%rdi
+  803189:	48 b8 01 1c 80 00 00 	movabs $0x801c01,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  803195:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803198:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80319c:	0f 88 43 02 00 00    	js     8033e5 <pipe_size+0x2e0>
+  8031a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8031a6:	ba 07 04 00 00       	mov    $0x407,%edx
+  8031ab:	48 89 c6             	mov    %rax,%rsi
+  8031ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031b3:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+  8031bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031c6:	0f 88 19 02 00 00    	js     8033e5 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8031cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d0:	48 89 c7             	mov    %rax,%rdi
+  8031d3:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+  8031df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8031e3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8031ea:	00 
+  8031eb:	e9 a2 00 00 00       	jmp    803292 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8031f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031f4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031f8:	48 89 c2             	mov    %rax,%rdx
+  8031fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ff:	48 01 d0             	add    %rdx,%rax
+  803202:	ba 07 04 00 00       	mov    $0x407,%edx
+  803207:	48 89 c6             	mov    %rax,%rsi
+  80320a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320f:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  803216:	00 00 00 
+  803219:	ff d0                	call   *%rax
+  80321b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80321e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803222:	0f 88 37 01 00 00    	js     80335f <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803228:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80322c:	48 89 c7             	mov    %rax,%rdi
+  80322f:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  803236:	00 00 00 
+  803239:	ff d0                	call   *%rax
+  80323b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80323f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803243:	48 01 c2             	add    %rax,%rdx
+  803246:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80324a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80324e:	48 89 c1             	mov    %rax,%rcx
+  803251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803255:	48 01 c8             	add    %rcx,%rax
+  803258:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80325e:	48 89 d1             	mov    %rdx,%rcx
+  803261:	ba 00 00 00 00       	mov    $0x0,%edx
+  803266:	48 89 c6             	mov    %rax,%rsi
+  803269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326e:	48 b8 24 15 80 00 00 	movabs $0x801524,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+  80327a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80327d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803281:	79 0a                	jns    80328d <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803283:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803288:	e9 d3 00 00 00       	jmp    803360 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80328d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803292:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803299:	00 
+  80329a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80329e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032a2:	48 01 d0             	add    %rdx,%rax
+  8032a5:	48 83 c0 1f          	add    $0x1f,%rax
+  8032a9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8032ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b6:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8032ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032be:	48 29 d0             	sub    %rdx,%rax
+  8032c1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032c5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8032c9:	0f 82 21 ff ff ff    	jb     8031f0 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8032cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032d3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8032d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032db:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8032df:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8032e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032e7:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8032ee:	00 00 00 
+  8032f1:	8b 12                	mov    (%rdx),%edx
+  8032f3:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8032f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032f9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803300:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803304:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80330b:	00 00 00 
+  80330e:	8b 12                	mov    (%rdx),%edx
+  803310:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803312:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803316:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80331d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803321:	48 89 c7             	mov    %rax,%rdi
+  803324:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  80332b:	00 00 00 
+  80332e:	ff d0                	call   *%rax
+  803330:	89 c2                	mov    %eax,%edx
+  803332:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803336:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803338:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80333c:	48 89 c7             	mov    %rax,%rdi
+  80333f:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  803346:	00 00 00 
+  803349:	ff d0                	call   *%rax
+  80334b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80334f:	48 83 c2 04          	add    $0x4,%rdx
+  803353:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335a:	e9 a5 00 00 00       	jmp    803404 <pipe_size+0x2ff>
+      goto err2;
+  80335f:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803360:	eb 58                	jmp    8033ba <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803366:	48 c1 e0 0c          	shl    $0xc,%rax
+  80336a:	48 89 c2             	mov    %rax,%rdx
+  80336d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803371:	48 01 d0             	add    %rdx,%rax
+  803374:	48 89 c6             	mov    %rax,%rsi
+  803377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337c:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  803383:	00 00 00 
+  803386:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803388:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80338c:	48 89 c7             	mov    %rax,%rdi
+  80338f:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+  80339b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80339f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8033a3:	48 01 d0             	add    %rdx,%rax
+  8033a6:	48 89 c6             	mov    %rax,%rsi
+  8033a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ae:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8033b5:	00 00 00 
+  8033b8:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8033ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033be:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8033c2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8033c6:	48 85 c0             	test   %rax,%rax
+  8033c9:	75 97                	jne    803362 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8033cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033cf:	48 89 c6             	mov    %rax,%rsi
+  8033d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033d7:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8033de:	00 00 00 
+  8033e1:	ff d0                	call   *%rax
+  8033e3:	eb 01                	jmp    8033e6 <pipe_size+0x2e1>
+    goto err1;
+  8033e5:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8033e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033ea:	48 89 c6             	mov    %rax,%rsi
+  8033ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f2:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8033f9:	00 00 00 
+  8033fc:	ff d0                	call   *%rax
+  8033fe:	eb 01                	jmp    803401 <pipe_size+0x2fc>
+    goto err;
+  803400:	90                   	nop
+err:
+  return r;
+  803401:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803404:	c9                   	leave
+  803405:	c3                   	ret
+
+0000000000803406 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803406:	55                   	push   %rbp
+  803407:	48 89 e5             	mov    %rsp,%rbp
+  80340a:	53                   	push   %rbx
+  80340b:	48 83 ec 28          	sub    $0x28,%rsp
+  80340f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803413:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803417:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80341e:	00 00 00 
+  803421:	8b 40 04             	mov    0x4(%rax),%eax
+  803424:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803429:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803430:	00 00 00 
+  803433:	48 98                	cltq
+  803435:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80343c:	48 01 d0             	add    %rdx,%rax
+  80343f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803445:	8b 00                	mov    (%rax),%eax
+  803447:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80344a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80344e:	48 89 c7             	mov    %rax,%rdi
+  803451:	48 b8 bd 4f 80 00 00 	movabs $0x804fbd,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+  80345d:	89 c3                	mov    %eax,%ebx
+  80345f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803463:	48 89 c7             	mov    %rax,%rdi
+  803466:	48 b8 bd 4f 80 00 00 	movabs $0x804fbd,%rax
+  80346d:	00 00 00 
+  803470:	ff d0                	call   *%rax
+  803472:	39 c3                	cmp    %eax,%ebx
+  803474:	0f 94 c0             	sete   %al
+  803477:	0f b6 c0             	movzbl %al,%eax
+  80347a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80347d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803484:	00 00 00 
+  803487:	8b 40 04             	mov    0x4(%rax),%eax
+  80348a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80348f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803496:	00 00 00 
+  803499:	48 98                	cltq
+  80349b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8034a2:	48 01 d0             	add    %rdx,%rax
+  8034a5:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8034ab:	8b 00                	mov    (%rax),%eax
+  8034ad:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8034b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034b3:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8034b6:	75 05                	jne    8034bd <_pipeisclosed+0xb7>
+      return ret;
+  8034b8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8034bb:	eb 68                	jmp    803525 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8034bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034c0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8034c3:	0f 84 4e ff ff ff    	je     803417 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8034c9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8034d0:	00 00 00 
+  8034d3:	8b 40 04             	mov    0x4(%rax),%eax
+  8034d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034db:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8034e2:	00 00 00 
+  8034e5:	48 98                	cltq
+  8034e7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8034ee:	48 01 d0             	add    %rdx,%rax
+  8034f1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8034f7:	8b 10                	mov    (%rax),%edx
+  8034f9:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8034fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034ff:	89 c6                	mov    %eax,%esi
+  803501:	48 b8 90 51 80 00 00 	movabs $0x805190,%rax
+  803508:	00 00 00 
+  80350b:	48 89 c7             	mov    %rax,%rdi
+  80350e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803513:	49 b8 7b 42 80 00 00 	movabs $0x80427b,%r8
+  80351a:	00 00 00 
+  80351d:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803520:	e9 f2 fe ff ff       	jmp    803417 <_pipeisclosed+0x11>
+  }
+}
+  803525:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803529:	c9                   	leave
+  80352a:	c3                   	ret
+
+000000000080352b <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80352b:	55                   	push   %rbp
+  80352c:	48 89 e5             	mov    %rsp,%rbp
+  80352f:	48 83 ec 30          	sub    $0x30,%rsp
+  803533:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803536:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80353a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80353d:	48 89 d6             	mov    %rdx,%rsi
+  803540:	89 c7                	mov    %eax,%edi
+  803542:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  803549:	00 00 00 
+  80354c:	ff d0                	call   *%rax
+  80354e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803551:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803555:	79 05                	jns    80355c <pipeisclosed+0x31>
+    return r;
+  803557:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80355a:	eb 31                	jmp    80358d <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80355c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803560:	48 89 c7             	mov    %rax,%rdi
+  803563:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+  80356f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  803573:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803577:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80357b:	48 89 d6             	mov    %rdx,%rsi
+  80357e:	48 89 c7             	mov    %rax,%rdi
+  803581:	48 b8 06 34 80 00 00 	movabs $0x803406,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+}
+  80358d:	c9                   	leave
+  80358e:	c3                   	ret
+
+000000000080358f <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80358f:	55                   	push   %rbp
+  803590:	48 89 e5             	mov    %rsp,%rbp
+  803593:	48 83 ec 10          	sub    $0x10,%rsp
+  803597:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80359b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80359f:	8b 40 18             	mov    0x18(%rax),%eax
+  8035a2:	8d 50 01             	lea    0x1(%rax),%edx
+  8035a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035a9:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8035ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035b0:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8035b3:	85 c0                	test   %eax,%eax
+  8035b5:	74 27                	je     8035de <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8035b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035bb:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8035c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035c6:	48 83 c0 18          	add    $0x18,%rax
+  8035ca:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8035cf:	48 89 c7             	mov    %rax,%rdi
+  8035d2:	48 b8 c7 18 80 00 00 	movabs $0x8018c7,%rax
+  8035d9:	00 00 00 
+  8035dc:	ff d0                	call   *%rax
+  }
+}
+  8035de:	90                   	nop
+  8035df:	c9                   	leave
+  8035e0:	c3                   	ret
+
+00000000008035e1 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8035e1:	55                   	push   %rbp
+  8035e2:	48 89 e5             	mov    %rsp,%rbp
+  8035e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8035e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8035ed:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8035f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035f4:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8035fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035ff:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  803603:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803606:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80360d:	89 c6                	mov    %eax,%esi
+  80360f:	48 89 cf             	mov    %rcx,%rdi
+  803612:	48 b8 78 18 80 00 00 	movabs $0x801878,%rax
+  803619:	00 00 00 
+  80361c:	ff d0                	call   *%rax
+}
+  80361e:	90                   	nop
+  80361f:	c9                   	leave
+  803620:	c3                   	ret
+
+0000000000803621 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803621:	55                   	push   %rbp
+  803622:	48 89 e5             	mov    %rsp,%rbp
+  803625:	48 83 ec 70          	sub    $0x70,%rsp
+  803629:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80362d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803631:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  803635:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803639:	48 89 c7             	mov    %rax,%rdi
+  80363c:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80364c:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  803651:	75 0a                	jne    80365d <devpipe_read+0x3c>
+    return 0;
+  803653:	b8 00 00 00 00       	mov    $0x0,%eax
+  803658:	e9 63 01 00 00       	jmp    8037c0 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80365d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803661:	8b 40 18             	mov    0x18(%rax),%eax
+  803664:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  803667:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80366b:	48 8b 10             	mov    (%rax),%rdx
+  80366e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803672:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803676:	48 39 c2             	cmp    %rax,%rdx
+  803679:	75 42                	jne    8036bd <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80367b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80367f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803683:	48 89 d6             	mov    %rdx,%rsi
+  803686:	48 89 c7             	mov    %rax,%rdi
+  803689:	48 b8 06 34 80 00 00 	movabs $0x803406,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+  803695:	85 c0                	test   %eax,%eax
+  803697:	74 0a                	je     8036a3 <devpipe_read+0x82>
+      return 0;
+  803699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369e:	e9 1d 01 00 00       	jmp    8037c0 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8036a3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8036a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036aa:	89 d6                	mov    %edx,%esi
+  8036ac:	48 89 c7             	mov    %rax,%rdi
+  8036af:	48 b8 e1 35 80 00 00 	movabs $0x8035e1,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8036bb:	eb a0                	jmp    80365d <devpipe_read+0x3c>
+      break;
+  8036bd:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8036be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8036c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8036c6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8036ca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036d2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8036d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036da:	48 8b 00             	mov    (%rax),%rax
+  8036dd:	48 29 c2             	sub    %rax,%rdx
+  8036e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8036e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036ec:	48 39 c2             	cmp    %rax,%rdx
+  8036ef:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8036f3:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8036f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036fb:	48 8b 00             	mov    (%rax),%rax
+  8036fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803702:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  803706:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370b:	48 f7 f1             	div    %rcx
+  80370e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  803712:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803716:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80371a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80371e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803722:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  803726:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80372a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80372e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803732:	48 39 c2             	cmp    %rax,%rdx
+  803735:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803739:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80373d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803741:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  803745:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803749:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80374d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803755:	48 89 ce             	mov    %rcx,%rsi
+  803758:	48 89 c7             	mov    %rax,%rdi
+  80375b:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  803762:	00 00 00 
+  803765:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  803767:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80376b:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80376f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803773:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  803777:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80377b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80377f:	48 01 d1             	add    %rdx,%rcx
+  803782:	48 89 c2             	mov    %rax,%rdx
+  803785:	48 89 cf             	mov    %rcx,%rdi
+  803788:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  80378f:	00 00 00 
+  803792:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  803794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803798:	48 8b 10             	mov    (%rax),%rdx
+  80379b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80379f:	48 01 c2             	add    %rax,%rdx
+  8037a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037a6:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8037a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ad:	48 89 c7             	mov    %rax,%rdi
+  8037b0:	48 b8 8f 35 80 00 00 	movabs $0x80358f,%rax
+  8037b7:	00 00 00 
+  8037ba:	ff d0                	call   *%rax
+  return n;
+  8037bc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8037c0:	c9                   	leave
+  8037c1:	c3                   	ret
+
+00000000008037c2 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8037c2:	55                   	push   %rbp
+  8037c3:	48 89 e5             	mov    %rsp,%rbp
+  8037c6:	48 83 ec 70          	sub    $0x70,%rsp
+  8037ca:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8037ce:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8037d2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8037d6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8037da:	48 89 c7             	mov    %rax,%rdi
+  8037dd:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  8037e4:	00 00 00 
+  8037e7:	ff d0                	call   *%rax
+  8037e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8037ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8037f5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037fc:	00 
+  8037fd:	e9 b8 01 00 00       	jmp    8039ba <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  803802:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803806:	8b 40 18             	mov    0x18(%rax),%eax
+  803809:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80380c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803810:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803814:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803818:	48 8b 00             	mov    (%rax),%rax
+  80381b:	48 29 c2             	sub    %rax,%rdx
+  80381e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803822:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803826:	48 39 c2             	cmp    %rax,%rdx
+  803829:	75 4d                	jne    803878 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80382b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80382f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803833:	48 89 d6             	mov    %rdx,%rsi
+  803836:	48 89 c7             	mov    %rax,%rdi
+  803839:	48 b8 06 34 80 00 00 	movabs $0x803406,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+  803845:	85 c0                	test   %eax,%eax
+  803847:	74 0a                	je     803853 <devpipe_write+0x91>
+        return 0;
+  803849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384e:	e9 79 01 00 00       	jmp    8039cc <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  803853:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80385a:	89 d6                	mov    %edx,%esi
+  80385c:	48 89 c7             	mov    %rax,%rdi
+  80385f:	48 b8 e1 35 80 00 00 	movabs $0x8035e1,%rax
+  803866:	00 00 00 
+  803869:	ff d0                	call   *%rax
+      m = 0;
+  80386b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803872:	00 
+      continue;
+  803873:	e9 3a 01 00 00       	jmp    8039b2 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  803878:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80387c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  803880:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803884:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803888:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80388c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803890:	48 8b 08             	mov    (%rax),%rcx
+  803893:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803897:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80389b:	48 29 c1             	sub    %rax,%rcx
+  80389e:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8038a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038a6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8038aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ae:	48 39 c2             	cmp    %rax,%rdx
+  8038b1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8038b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038bd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8038c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038c5:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8038c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038ce:	48 f7 f1             	div    %rcx
+  8038d1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8038d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8038dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8038e5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8038e9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8038ed:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8038f1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8038f5:	48 39 c2             	cmp    %rax,%rdx
+  8038f8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038fc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803900:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803904:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  803908:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80390c:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  803910:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803914:	48 01 d1             	add    %rdx,%rcx
+  803917:	48 89 c2             	mov    %rax,%rdx
+  80391a:	48 89 cf             	mov    %rcx,%rdi
+  80391d:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  803924:	00 00 00 
+  803927:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  803929:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80392d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803931:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  803935:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  803939:	73 4d                	jae    803988 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80393b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80393f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803943:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803947:	48 29 c2             	sub    %rax,%rdx
+  80394a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80394e:	48 01 c2             	add    %rax,%rdx
+  803951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803955:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803959:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80395d:	48 89 c1             	mov    %rax,%rcx
+  803960:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803964:	48 01 c1             	add    %rax,%rcx
+  803967:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80396b:	48 01 c1             	add    %rax,%rcx
+  80396e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803972:	48 83 c0 20          	add    $0x20,%rax
+  803976:	48 89 ce             	mov    %rcx,%rsi
+  803979:	48 89 c7             	mov    %rax,%rdi
+  80397c:	48 b8 47 0e 80 00 00 	movabs $0x800e47,%rax
+  803983:	00 00 00 
+  803986:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  803988:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80398c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803994:	48 01 c2             	add    %rax,%rdx
+  803997:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80399b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80399f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039a3:	48 89 c7             	mov    %rax,%rdi
+  8039a6:	48 b8 8f 35 80 00 00 	movabs $0x80358f,%rax
+  8039ad:	00 00 00 
+  8039b0:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8039b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039b6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8039ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039be:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8039c2:	0f 82 3a fe ff ff    	jb     803802 <devpipe_write+0x40>
+  }
+
+  return i;
+  8039c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8039cc:	c9                   	leave
+  8039cd:	c3                   	ret
+
+00000000008039ce <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	48 83 ec 40          	sub    $0x40,%rsp
+  8039d6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8039da:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8039dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039e5:	48 89 c7             	mov    %rax,%rdi
+  8039e8:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+  8039f4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8039f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8039ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a03:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  803a07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a0b:	48 89 d6             	mov    %rdx,%rsi
+  803a0e:	48 89 c7             	mov    %rax,%rdi
+  803a11:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+  803a1d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a20:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a24:	79 08                	jns    803a2e <devpipe_poll+0x60>
+    return r;
+  803a26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a29:	e9 85 00 00 00       	jmp    803ab3 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  803a2e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803a31:	83 e0 01             	and    $0x1,%eax
+  803a34:	85 c0                	test   %eax,%eax
+  803a36:	74 18                	je     803a50 <devpipe_poll+0x82>
+  803a38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a3c:	48 8b 10             	mov    (%rax),%rdx
+  803a3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a43:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803a47:	48 39 c2             	cmp    %rax,%rdx
+  803a4a:	74 04                	je     803a50 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  803a4c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  803a50:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803a53:	83 e0 02             	and    $0x2,%eax
+  803a56:	85 c0                	test   %eax,%eax
+  803a58:	74 23                	je     803a7d <devpipe_poll+0xaf>
+  803a5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a5e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803a62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a66:	48 8b 00             	mov    (%rax),%rax
+  803a69:	48 29 c2             	sub    %rax,%rdx
+  803a6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a70:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803a74:	48 39 c2             	cmp    %rax,%rdx
+  803a77:	73 04                	jae    803a7d <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  803a79:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  803a7d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a85:	48 89 d6             	mov    %rdx,%rsi
+  803a88:	48 89 c7             	mov    %rax,%rdi
+  803a8b:	48 b8 06 34 80 00 00 	movabs $0x803406,%rax
+  803a92:	00 00 00 
+  803a95:	ff d0                	call   *%rax
+  803a97:	85 c0                	test   %eax,%eax
+  803a99:	74 04                	je     803a9f <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  803a9b:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  803a9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aa3:	75 0b                	jne    803ab0 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  803aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  803ab0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ab3:	c9                   	leave
+  803ab4:	c3                   	ret
+
+0000000000803ab5 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803ab5:	55                   	push   %rbp
+  803ab6:	48 89 e5             	mov    %rsp,%rbp
+  803ab9:	48 83 ec 20          	sub    $0x20,%rsp
+  803abd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ac1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ac5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ac9:	48 89 c7             	mov    %rax,%rdi
+  803acc:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  803ad3:	00 00 00 
+  803ad6:	ff d0                	call   *%rax
+  803ad8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  803adc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ae0:	48 ba c1 51 80 00 00 	movabs $0x8051c1,%rdx
+  803ae7:	00 00 00 
+  803aea:	48 89 d6             	mov    %rdx,%rsi
+  803aed:	48 89 c7             	mov    %rax,%rdi
+  803af0:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  803af7:	00 00 00 
+  803afa:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  803afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b00:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b04:	89 c1                	mov    %eax,%ecx
+  803b06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b0a:	48 8b 00             	mov    (%rax),%rax
+  803b0d:	89 c2                	mov    %eax,%edx
+  803b0f:	89 c8                	mov    %ecx,%eax
+  803b11:	29 d0                	sub    %edx,%eax
+  803b13:	89 c2                	mov    %eax,%edx
+  803b15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b19:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  803b1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b23:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803b2a:	00 00 00 
+  stat->st_dev   = &devpipe;
+  803b2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b31:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  803b38:	00 00 00 
+  803b3b:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b47:	c9                   	leave
+  803b48:	c3                   	ret
+
+0000000000803b49 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b49:	55                   	push   %rbp
+  803b4a:	48 89 e5             	mov    %rsp,%rbp
+  803b4d:	48 83 ec 40          	sub    $0x40,%rsp
+  803b51:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b59:	48 89 c7             	mov    %rax,%rdi
+  803b5c:	48 b8 d6 1b 80 00 00 	movabs $0x801bd6,%rax
+  803b63:	00 00 00 
+  803b66:	ff d0                	call   *%rax
+  803b68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  803b6c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  803b73:	00 
+  803b74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b78:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b80:	48 01 d0             	add    %rdx,%rax
+  803b83:	48 83 c0 1f          	add    $0x1f,%rax
+  803b87:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803b8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b94:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803b98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b9c:	48 29 d0             	sub    %rdx,%rax
+  803b9f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ba3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  803ba7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bab:	48 89 c6             	mov    %rax,%rsi
+  803bae:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb3:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  803bba:	00 00 00 
+  803bbd:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  803bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bc3:	48 89 c7             	mov    %rax,%rdi
+  803bc6:	48 b8 8f 35 80 00 00 	movabs $0x80358f,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  803bd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bd6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  803bda:	eb 2f                	jmp    803c0b <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  803bdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803be0:	48 83 e8 01          	sub    $0x1,%rax
+  803be4:	48 c1 e0 0c          	shl    $0xc,%rax
+  803be8:	48 89 c2             	mov    %rax,%rdx
+  803beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bef:	48 01 d0             	add    %rdx,%rax
+  803bf2:	48 89 c6             	mov    %rax,%rsi
+  803bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bfa:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  803c06:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  803c0b:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  803c10:	77 ca                	ja     803bdc <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  803c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c16:	48 89 c6             	mov    %rax,%rsi
+  803c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1e:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+}
+  803c2a:	c9                   	leave
+  803c2b:	c3                   	ret
+
+0000000000803c2c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  803c2c:	55                   	push   %rbp
+  803c2d:	48 89 e5             	mov    %rsp,%rbp
+  803c30:	48 83 ec 08          	sub    $0x8,%rsp
+  803c34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  803c37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c3b:	75 10                	jne    803c4d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  803c3d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c44:	00 00 00 
+  803c47:	8b 00                	mov    (%rax),%eax
+  803c49:	48 98                	cltq
+  803c4b:	eb 05                	jmp    803c52 <vsyscall+0x26>
+  }
+  return 0;
+  803c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c52:	c9                   	leave
+  803c53:	c3                   	ret
+
+0000000000803c54 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  803c54:	55                   	push   %rbp
+  803c55:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  803c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c5d:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  803c64:	00 00 00 
+  803c67:	ff d0                	call   *%rax
+}
+  803c69:	5d                   	pop    %rbp
+  803c6a:	c3                   	ret
+
+0000000000803c6b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  803c6b:	55                   	push   %rbp
+  803c6c:	48 89 e5             	mov    %rsp,%rbp
+  803c6f:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  803c73:	0f 31                	rdtsc
+  803c75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c78:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  803c7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c7e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c81:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c85:	48 09 d0             	or     %rdx,%rax
+  803c88:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  803c8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  803c90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  803c94:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c9b:	00 00 00 
+  803c9e:	8b 40 08             	mov    0x8(%rax),%eax
+  803ca1:	48 98                	cltq
+  803ca3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  803ca7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  803cb4:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  803cbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cc4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  803cc8:	48 89 d0             	mov    %rdx,%rax
+  803ccb:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  803cd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  803cdb:	48 01 c8             	add    %rcx,%rax
+}
+  803cde:	c9                   	leave
+  803cdf:	c3                   	ret
+
+0000000000803ce0 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  803ce0:	55                   	push   %rbp
+  803ce1:	48 89 e5             	mov    %rsp,%rbp
+  803ce4:	48 83 ec 20          	sub    $0x20,%rsp
+  803ce8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  803ceb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cee:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  803cf1:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  803cf5:	be 01 00 00 00       	mov    $0x1,%esi
+  803cfa:	48 89 c7             	mov    %rax,%rdi
+  803cfd:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  803d04:	00 00 00 
+  803d07:	ff d0                	call   *%rax
+}
+  803d09:	90                   	nop
+  803d0a:	c9                   	leave
+  803d0b:	c3                   	ret
+
+0000000000803d0c <getchar>:
+
+int
+getchar(void) {
+  803d0c:	55                   	push   %rbp
+  803d0d:	48 89 e5             	mov    %rsp,%rbp
+  803d10:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  803d14:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  803d18:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d1d:	48 89 c6             	mov    %rax,%rsi
+  803d20:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d25:	48 b8 3f 22 80 00 00 	movabs $0x80223f,%rax
+  803d2c:	00 00 00 
+  803d2f:	ff d0                	call   *%rax
+  803d31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  803d34:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d38:	79 05                	jns    803d3f <getchar+0x33>
+    return r;
+  803d3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d3d:	eb 14                	jmp    803d53 <getchar+0x47>
+  if (r < 1)
+  803d3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d43:	7f 07                	jg     803d4c <getchar+0x40>
+    return -E_EOF;
+  803d45:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  803d4a:	eb 07                	jmp    803d53 <getchar+0x47>
+  return c;
+  803d4c:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  803d50:	0f b6 c0             	movzbl %al,%eax
+}
+  803d53:	c9                   	leave
+  803d54:	c3                   	ret
+
+0000000000803d55 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  803d55:	55                   	push   %rbp
+  803d56:	48 89 e5             	mov    %rsp,%rbp
+  803d59:	48 83 ec 20          	sub    $0x20,%rsp
+  803d5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d60:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d67:	48 89 d6             	mov    %rdx,%rsi
+  803d6a:	89 c7                	mov    %eax,%edi
+  803d6c:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+  803d78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d7f:	79 05                	jns    803d86 <iscons+0x31>
+    return r;
+  803d81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d84:	eb 1a                	jmp    803da0 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  803d86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d8a:	8b 10                	mov    (%rax),%edx
+  803d8c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  803d93:	00 00 00 
+  803d96:	8b 00                	mov    (%rax),%eax
+  803d98:	39 c2                	cmp    %eax,%edx
+  803d9a:	0f 94 c0             	sete   %al
+  803d9d:	0f b6 c0             	movzbl %al,%eax
+}
+  803da0:	c9                   	leave
+  803da1:	c3                   	ret
+
+0000000000803da2 <opencons>:
+
+int
+opencons(void) {
+  803da2:	55                   	push   %rbp
+  803da3:	48 89 e5             	mov    %rsp,%rbp
+  803da6:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803daa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803dae:	48 89 c7             	mov    %rax,%rdi
+  803db1:	48 b8 01 1c 80 00 00 	movabs $0x801c01,%rax
+  803db8:	00 00 00 
+  803dbb:	ff d0                	call   *%rax
+  803dbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dc4:	79 05                	jns    803dcb <opencons+0x29>
+    return r;
+  803dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dc9:	eb 66                	jmp    803e31 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  803dcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dcf:	ba 07 04 00 00       	mov    $0x407,%edx
+  803dd4:	48 89 c6             	mov    %rax,%rsi
+  803dd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddc:	48 b8 cc 14 80 00 00 	movabs $0x8014cc,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+  803de8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803deb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803def:	79 05                	jns    803df6 <opencons+0x54>
+    return r;
+  803df1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803df4:	eb 3b                	jmp    803e31 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  803df6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dfa:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  803e01:	00 00 00 
+  803e04:	8b 12                	mov    (%rdx),%edx
+  803e06:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  803e08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  803e13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e17:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  803e1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e22:	48 89 c7             	mov    %rax,%rdi
+  803e25:	48 b8 b3 1b 80 00 00 	movabs $0x801bb3,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+}
+  803e31:	c9                   	leave
+  803e32:	c3                   	ret
+
+0000000000803e33 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  803e33:	55                   	push   %rbp
+  803e34:	48 89 e5             	mov    %rsp,%rbp
+  803e37:	48 83 ec 20          	sub    $0x20,%rsp
+  803e3b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e3e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e41:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e48:	48 89 d6             	mov    %rdx,%rsi
+  803e4b:	89 c7                	mov    %eax,%edi
+  803e4d:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  803e54:	00 00 00 
+  803e57:	ff d0                	call   *%rax
+  803e59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e60:	79 05                	jns    803e67 <consmode+0x34>
+    return r;
+  803e62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e65:	eb 34                	jmp    803e9b <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  803e67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e6b:	8b 10                	mov    (%rax),%edx
+  803e6d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  803e74:	00 00 00 
+  803e77:	8b 00                	mov    (%rax),%eax
+  803e79:	39 c2                	cmp    %eax,%edx
+  803e7b:	74 07                	je     803e84 <consmode+0x51>
+    return -E_INVAL;
+  803e7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e82:	eb 17                	jmp    803e9b <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  803e84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e88:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  803e8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e92:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803e95:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  803e98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803e9b:	c9                   	leave
+  803e9c:	c3                   	ret
+
+0000000000803e9d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e9d:	55                   	push   %rbp
+  803e9e:	48 89 e5             	mov    %rsp,%rbp
+  803ea1:	48 83 ec 20          	sub    $0x20,%rsp
+  803ea5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ea9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803ead:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  803eb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803eb5:	8b 50 0c             	mov    0xc(%rax),%edx
+  803eb8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803ebc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ec0:	48 89 ce             	mov    %rcx,%rsi
+  803ec3:	48 89 c7             	mov    %rax,%rdi
+  803ec6:	48 b8 26 18 80 00 00 	movabs $0x801826,%rax
+  803ecd:	00 00 00 
+  803ed0:	ff d0                	call   *%rax
+  803ed2:	48 98                	cltq
+}
+  803ed4:	c9                   	leave
+  803ed5:	c3                   	ret
+
+0000000000803ed6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+  803eda:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  803ee1:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  803ee8:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  803eef:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  803ef6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803efd:	eb 74                	jmp    803f73 <devcons_write+0x9d>
+    m = n - tot;
+  803eff:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  803f06:	89 c2                	mov    %eax,%edx
+  803f08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f0b:	29 c2                	sub    %eax,%edx
+  803f0d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  803f10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803f13:	83 f8 7f             	cmp    $0x7f,%eax
+  803f16:	76 07                	jbe    803f1f <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  803f18:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  803f1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803f22:	48 63 d0             	movslq %eax,%rdx
+  803f25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f28:	48 63 c8             	movslq %eax,%rcx
+  803f2b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  803f32:	48 01 c1             	add    %rax,%rcx
+  803f35:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  803f3c:	48 89 ce             	mov    %rcx,%rsi
+  803f3f:	48 89 c7             	mov    %rax,%rdi
+  803f42:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  803f49:	00 00 00 
+  803f4c:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  803f4e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803f51:	48 63 d0             	movslq %eax,%rdx
+  803f54:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  803f5b:	48 89 d6             	mov    %rdx,%rsi
+  803f5e:	48 89 c7             	mov    %rax,%rdi
+  803f61:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  803f6d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803f70:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803f73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f76:	48 98                	cltq
+  803f78:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  803f7f:	0f 82 7a ff ff ff    	jb     803eff <devcons_write+0x29>
+  }
+  return tot;
+  803f85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f88:	48 98                	cltq
+}
+  803f8a:	c9                   	leave
+  803f8b:	c3                   	ret
+
+0000000000803f8c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  803f8c:	55                   	push   %rbp
+  803f8d:	48 89 e5             	mov    %rsp,%rbp
+  803f90:	48 83 ec 08          	sub    $0x8,%rsp
+  803f94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  803f98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f9d:	c9                   	leave
+  803f9e:	c3                   	ret
+
+0000000000803f9f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f9f:	55                   	push   %rbp
+  803fa0:	48 89 e5             	mov    %rsp,%rbp
+  803fa3:	48 83 ec 10          	sub    $0x10,%rsp
+  803fa7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803fab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  803faf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fb3:	48 ba cd 51 80 00 00 	movabs $0x8051cd,%rdx
+  803fba:	00 00 00 
+  803fbd:	48 89 d6             	mov    %rdx,%rsi
+  803fc0:	48 89 c7             	mov    %rax,%rdi
+  803fc3:	48 b8 fe 06 80 00 00 	movabs $0x8006fe,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+  return 0;
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fd4:	c9                   	leave
+  803fd5:	c3                   	ret
+
+0000000000803fd6 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803fd6:	55                   	push   %rbp
+  803fd7:	48 89 e5             	mov    %rsp,%rbp
+  803fda:	48 83 ec 30          	sub    $0x30,%rsp
+  803fde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803fe2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  803fe5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  803fe9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  803ff0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ff3:	83 e0 02             	and    $0x2,%eax
+  803ff6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  803ff9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ffd:	8b 40 0c             	mov    0xc(%rax),%eax
+  804000:	83 f8 01             	cmp    $0x1,%eax
+  804003:	75 04                	jne    804009 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804005:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804009:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80400c:	83 e0 01             	and    $0x1,%eax
+  80400f:	85 c0                	test   %eax,%eax
+  804011:	74 44                	je     804057 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804013:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804016:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80401b:	89 c2                	mov    %eax,%edx
+  80401d:	be 00 00 00 00       	mov    $0x0,%esi
+  804022:	bf 00 00 00 00       	mov    $0x0,%edi
+  804027:	48 b8 14 19 80 00 00 	movabs $0x801914,%rax
+  80402e:	00 00 00 
+  804031:	ff d0                	call   *%rax
+  804033:	83 f8 01             	cmp    $0x1,%eax
+  804036:	75 06                	jne    80403e <devcons_poll+0x68>
+      revents |= POLLIN;
+  804038:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80403c:	eb 19                	jmp    804057 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80403e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804042:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804048:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80404b:	89 c2                	mov    %eax,%edx
+  80404d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804051:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804057:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80405a:	c9                   	leave
+  80405b:	c3                   	ret
+
+000000000080405c <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80405c:	55                   	push   %rbp
+  80405d:	48 89 e5             	mov    %rsp,%rbp
+  804060:	53                   	push   %rbx
+  804061:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804068:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80406f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804075:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80407c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804083:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80408a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804091:	84 c0                	test   %al,%al
+  804093:	74 23                	je     8040b8 <_panic+0x5c>
+  804095:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80409c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8040a0:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8040a4:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8040a8:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8040ac:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8040b0:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8040b4:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8040b8:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8040bf:	00 00 00 
+  8040c2:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8040c9:	00 00 00 
+  8040cc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8040d0:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8040d7:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8040de:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8040e5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8040ec:	00 00 00 
+  8040ef:	48 8b 18             	mov    (%rax),%rbx
+  8040f2:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+  8040fe:	89 c6                	mov    %eax,%esi
+  804100:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804106:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80410d:	41 89 d0             	mov    %edx,%r8d
+  804110:	48 89 c1             	mov    %rax,%rcx
+  804113:	48 89 da             	mov    %rbx,%rdx
+  804116:	48 b8 d8 51 80 00 00 	movabs $0x8051d8,%rax
+  80411d:	00 00 00 
+  804120:	48 89 c7             	mov    %rax,%rdi
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+  804128:	49 b9 7b 42 80 00 00 	movabs $0x80427b,%r9
+  80412f:	00 00 00 
+  804132:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804135:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80413c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804143:	48 89 d6             	mov    %rdx,%rsi
+  804146:	48 89 c7             	mov    %rax,%rdi
+  804149:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  804150:	00 00 00 
+  804153:	ff d0                	call   *%rax
+  cprintf("\n");
+  804155:	48 b8 fb 51 80 00 00 	movabs $0x8051fb,%rax
+  80415c:	00 00 00 
+  80415f:	48 89 c7             	mov    %rax,%rdi
+  804162:	b8 00 00 00 00       	mov    $0x0,%eax
+  804167:	48 ba 7b 42 80 00 00 	movabs $0x80427b,%rdx
+  80416e:	00 00 00 
+  804171:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804173:	cc                   	int3
+  804174:	eb fd                	jmp    804173 <_panic+0x117>
+
+0000000000804176 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  804176:	55                   	push   %rbp
+  804177:	48 89 e5             	mov    %rsp,%rbp
+  80417a:	48 83 ec 10          	sub    $0x10,%rsp
+  80417e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804181:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  804185:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804189:	8b 00                	mov    (%rax),%eax
+  80418b:	8d 48 01             	lea    0x1(%rax),%ecx
+  80418e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804192:	89 0a                	mov    %ecx,(%rdx)
+  804194:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804197:	89 d1                	mov    %edx,%ecx
+  804199:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80419d:	48 98                	cltq
+  80419f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8041a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041a7:	8b 00                	mov    (%rax),%eax
+  8041a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8041ae:	75 2c                	jne    8041dc <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8041b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041b4:	8b 00                	mov    (%rax),%eax
+  8041b6:	48 98                	cltq
+  8041b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8041bc:	48 83 c2 08          	add    $0x8,%rdx
+  8041c0:	48 89 c6             	mov    %rax,%rsi
+  8041c3:	48 89 d7             	mov    %rdx,%rdi
+  8041c6:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  8041cd:	00 00 00 
+  8041d0:	ff d0                	call   *%rax
+    b->idx = 0;
+  8041d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041d6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8041dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041e0:	8b 40 04             	mov    0x4(%rax),%eax
+  8041e3:	8d 50 01             	lea    0x1(%rax),%edx
+  8041e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041ea:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8041ed:	90                   	nop
+  8041ee:	c9                   	leave
+  8041ef:	c3                   	ret
+
+00000000008041f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8041f0:	55                   	push   %rbp
+  8041f1:	48 89 e5             	mov    %rsp,%rbp
+  8041f4:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8041fb:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  804202:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  804209:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  804210:	00 00 00 
+  b.cnt = 0;
+  804213:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80421a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80421d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  804224:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80422b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  804232:	48 89 c6             	mov    %rax,%rsi
+  804235:	48 b8 76 41 80 00 00 	movabs $0x804176,%rax
+  80423c:	00 00 00 
+  80423f:	48 89 c7             	mov    %rax,%rdi
+  804242:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  804249:	00 00 00 
+  80424c:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80424e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  804254:	48 98                	cltq
+  804256:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80425d:	48 83 c2 08          	add    $0x8,%rdx
+  804261:	48 89 c6             	mov    %rax,%rsi
+  804264:	48 89 d7             	mov    %rdx,%rdi
+  804267:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  80426e:	00 00 00 
+  804271:	ff d0                	call   *%rax
+
+  return b.cnt;
+  804273:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  804279:	c9                   	leave
+  80427a:	c3                   	ret
+
+000000000080427b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80427b:	55                   	push   %rbp
+  80427c:	48 89 e5             	mov    %rsp,%rbp
+  80427f:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804286:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80428d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804294:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80429b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8042a2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8042a9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8042b0:	84 c0                	test   %al,%al
+  8042b2:	74 20                	je     8042d4 <cprintf+0x59>
+  8042b4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8042b8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8042bc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8042c0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8042c4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8042c8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8042cc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8042d0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8042d4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8042db:	00 00 00 
+  8042de:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8042e5:	00 00 00 
+  8042e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042ec:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8042f3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8042fa:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  804301:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804308:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80430f:	48 89 d6             	mov    %rdx,%rsi
+  804312:	48 89 c7             	mov    %rax,%rdi
+  804315:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  80431c:	00 00 00 
+  80431f:	ff d0                	call   *%rax
+  804321:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804327:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80432d:	c9                   	leave
+  80432e:	c3                   	ret
+
+000000000080432f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80432f:	55                   	push   %rbp
+  804330:	48 89 e5             	mov    %rsp,%rbp
+  804333:	48 83 ec 30          	sub    $0x30,%rsp
+  804337:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80433b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80433f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804343:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  804346:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80434a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80434e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804351:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  804355:	72 54                	jb     8043ab <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  804357:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80435a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80435d:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  804360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804364:	ba 00 00 00 00       	mov    $0x0,%edx
+  804369:	48 f7 f6             	div    %rsi
+  80436c:	49 89 c2             	mov    %rax,%r10
+  80436f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804372:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804375:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804379:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80437d:	41 89 c9             	mov    %ecx,%r9d
+  804380:	41 89 f8             	mov    %edi,%r8d
+  804383:	89 d1                	mov    %edx,%ecx
+  804385:	4c 89 d2             	mov    %r10,%rdx
+  804388:	48 89 c7             	mov    %rax,%rdi
+  80438b:	48 b8 2f 43 80 00 00 	movabs $0x80432f,%rax
+  804392:	00 00 00 
+  804395:	ff d0                	call   *%rax
+  804397:	eb 1c                	jmp    8043b5 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  804399:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80439d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043a0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8043a4:	48 89 d6             	mov    %rdx,%rsi
+  8043a7:	89 c7                	mov    %eax,%edi
+  8043a9:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8043ab:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8043af:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8043b3:	7f e4                	jg     804399 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8043b5:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8043b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043c1:	48 f7 f1             	div    %rcx
+  8043c4:	48 b8 30 54 80 00 00 	movabs $0x805430,%rax
+  8043cb:	00 00 00 
+  8043ce:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8043d2:	0f be c0             	movsbl %al,%eax
+  8043d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043d9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8043dd:	48 89 d6             	mov    %rdx,%rsi
+  8043e0:	89 c7                	mov    %eax,%edi
+  8043e2:	ff d1                	call   *%rcx
+}
+  8043e4:	90                   	nop
+  8043e5:	c9                   	leave
+  8043e6:	c3                   	ret
+
+00000000008043e7 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8043e7:	55                   	push   %rbp
+  8043e8:	48 89 e5             	mov    %rsp,%rbp
+  8043eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8043ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8043f6:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8043fa:	7e 4b                	jle    804447 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8043fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804400:	8b 00                	mov    (%rax),%eax
+  804402:	83 f8 2f             	cmp    $0x2f,%eax
+  804405:	77 24                	ja     80442b <getuint+0x44>
+  804407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80440b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80440f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804413:	8b 00                	mov    (%rax),%eax
+  804415:	89 c0                	mov    %eax,%eax
+  804417:	48 01 d0             	add    %rdx,%rax
+  80441a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80441e:	8b 12                	mov    (%rdx),%edx
+  804420:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804423:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804427:	89 0a                	mov    %ecx,(%rdx)
+  804429:	eb 14                	jmp    80443f <getuint+0x58>
+  80442b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80442f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804433:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804437:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80443b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80443f:	48 8b 00             	mov    (%rax),%rax
+  804442:	e9 95 00 00 00       	jmp    8044dc <getuint+0xf5>
+  else if (lflag)
+  804447:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80444b:	74 48                	je     804495 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80444d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804451:	8b 00                	mov    (%rax),%eax
+  804453:	83 f8 2f             	cmp    $0x2f,%eax
+  804456:	77 24                	ja     80447c <getuint+0x95>
+  804458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80445c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804460:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804464:	8b 00                	mov    (%rax),%eax
+  804466:	89 c0                	mov    %eax,%eax
+  804468:	48 01 d0             	add    %rdx,%rax
+  80446b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80446f:	8b 12                	mov    (%rdx),%edx
+  804471:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804474:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804478:	89 0a                	mov    %ecx,(%rdx)
+  80447a:	eb 14                	jmp    804490 <getuint+0xa9>
+  80447c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804480:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804484:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804488:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80448c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804490:	48 8b 00             	mov    (%rax),%rax
+  804493:	eb 47                	jmp    8044dc <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  804495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804499:	8b 00                	mov    (%rax),%eax
+  80449b:	83 f8 2f             	cmp    $0x2f,%eax
+  80449e:	77 24                	ja     8044c4 <getuint+0xdd>
+  8044a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044a4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8044a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044ac:	8b 00                	mov    (%rax),%eax
+  8044ae:	89 c0                	mov    %eax,%eax
+  8044b0:	48 01 d0             	add    %rdx,%rax
+  8044b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b7:	8b 12                	mov    (%rdx),%edx
+  8044b9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8044bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044c0:	89 0a                	mov    %ecx,(%rdx)
+  8044c2:	eb 14                	jmp    8044d8 <getuint+0xf1>
+  8044c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044c8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044cc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8044d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044d4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8044d8:	8b 00                	mov    (%rax),%eax
+  8044da:	89 c0                	mov    %eax,%eax
+}
+  8044dc:	c9                   	leave
+  8044dd:	c3                   	ret
+
+00000000008044de <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8044de:	55                   	push   %rbp
+  8044df:	48 89 e5             	mov    %rsp,%rbp
+  8044e2:	48 83 ec 10          	sub    $0x10,%rsp
+  8044e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8044ea:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8044ed:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8044f1:	7e 4b                	jle    80453e <getint+0x60>
+    return va_arg(*ap, long long);
+  8044f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044f7:	8b 00                	mov    (%rax),%eax
+  8044f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8044fc:	77 24                	ja     804522 <getint+0x44>
+  8044fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804502:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804506:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80450a:	8b 00                	mov    (%rax),%eax
+  80450c:	89 c0                	mov    %eax,%eax
+  80450e:	48 01 d0             	add    %rdx,%rax
+  804511:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804515:	8b 12                	mov    (%rdx),%edx
+  804517:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80451a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80451e:	89 0a                	mov    %ecx,(%rdx)
+  804520:	eb 14                	jmp    804536 <getint+0x58>
+  804522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804526:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80452a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80452e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804532:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804536:	48 8b 00             	mov    (%rax),%rax
+  804539:	e9 95 00 00 00       	jmp    8045d3 <getint+0xf5>
+  else if (lflag)
+  80453e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804542:	74 48                	je     80458c <getint+0xae>
+    return va_arg(*ap, long);
+  804544:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804548:	8b 00                	mov    (%rax),%eax
+  80454a:	83 f8 2f             	cmp    $0x2f,%eax
+  80454d:	77 24                	ja     804573 <getint+0x95>
+  80454f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804553:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80455b:	8b 00                	mov    (%rax),%eax
+  80455d:	89 c0                	mov    %eax,%eax
+  80455f:	48 01 d0             	add    %rdx,%rax
+  804562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804566:	8b 12                	mov    (%rdx),%edx
+  804568:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80456b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80456f:	89 0a                	mov    %ecx,(%rdx)
+  804571:	eb 14                	jmp    804587 <getint+0xa9>
+  804573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804577:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80457b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80457f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804583:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804587:	48 8b 00             	mov    (%rax),%rax
+  80458a:	eb 47                	jmp    8045d3 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80458c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804590:	8b 00                	mov    (%rax),%eax
+  804592:	83 f8 2f             	cmp    $0x2f,%eax
+  804595:	77 24                	ja     8045bb <getint+0xdd>
+  804597:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80459b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80459f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a3:	8b 00                	mov    (%rax),%eax
+  8045a5:	89 c0                	mov    %eax,%eax
+  8045a7:	48 01 d0             	add    %rdx,%rax
+  8045aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045ae:	8b 12                	mov    (%rdx),%edx
+  8045b0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8045b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045b7:	89 0a                	mov    %ecx,(%rdx)
+  8045b9:	eb 14                	jmp    8045cf <getint+0xf1>
+  8045bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045c3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8045c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045cb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8045cf:	8b 00                	mov    (%rax),%eax
+  8045d1:	48 98                	cltq
+}
+  8045d3:	c9                   	leave
+  8045d4:	c3                   	ret
+
+00000000008045d5 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8045d5:	55                   	push   %rbp
+  8045d6:	48 89 e5             	mov    %rsp,%rbp
+  8045d9:	41 54                	push   %r12
+  8045db:	53                   	push   %rbx
+  8045dc:	48 83 ec 60          	sub    $0x60,%rsp
+  8045e0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8045e4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8045e8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8045ec:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8045f0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8045f4:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8045f8:	48 8b 06             	mov    (%rsi),%rax
+  8045fb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8045ff:	48 89 01             	mov    %rax,(%rcx)
+  804602:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804606:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80460a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80460e:	eb 17                	jmp    804627 <vprintfmt+0x52>
+      if (ch == '\0')
+  804610:	85 db                	test   %ebx,%ebx
+  804612:	0f 84 bf 04 00 00    	je     804ad7 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  804618:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80461c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804620:	48 89 c6             	mov    %rax,%rsi
+  804623:	89 df                	mov    %ebx,%edi
+  804625:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  804627:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80462b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80462f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  804633:	0f b6 00             	movzbl (%rax),%eax
+  804636:	0f b6 d8             	movzbl %al,%ebx
+  804639:	83 fb 25             	cmp    $0x25,%ebx
+  80463c:	75 d2                	jne    804610 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80463e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  804642:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  804649:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  804650:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  804657:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80465e:	eb 04                	jmp    804664 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  804660:	90                   	nop
+  804661:	eb 01                	jmp    804664 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  804663:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  804664:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804668:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80466c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  804670:	0f b6 00             	movzbl (%rax),%eax
+  804673:	0f b6 d8             	movzbl %al,%ebx
+  804676:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  804679:	83 f8 55             	cmp    $0x55,%eax
+  80467c:	0f 87 22 04 00 00    	ja     804aa4 <vprintfmt+0x4cf>
+  804682:	89 c0                	mov    %eax,%eax
+  804684:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80468b:	00 
+  80468c:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  804693:	00 00 00 
+  804696:	48 01 d0             	add    %rdx,%rax
+  804699:	48 8b 00             	mov    (%rax),%rax
+  80469c:	ff e0                	jmp    *%rax
+        padc = '-';
+  80469e:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8046a2:	eb c0                	jmp    804664 <vprintfmt+0x8f>
+        padc = '0';
+  8046a4:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8046a8:	eb ba                	jmp    804664 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8046aa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8046b1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8046b4:	89 d0                	mov    %edx,%eax
+  8046b6:	c1 e0 02             	shl    $0x2,%eax
+  8046b9:	01 d0                	add    %edx,%eax
+  8046bb:	01 c0                	add    %eax,%eax
+  8046bd:	01 d8                	add    %ebx,%eax
+  8046bf:	83 e8 30             	sub    $0x30,%eax
+  8046c2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8046c5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046c9:	0f b6 00             	movzbl (%rax),%eax
+  8046cc:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8046cf:	83 fb 2f             	cmp    $0x2f,%ebx
+  8046d2:	7e 60                	jle    804734 <vprintfmt+0x15f>
+  8046d4:	83 fb 39             	cmp    $0x39,%ebx
+  8046d7:	7f 5b                	jg     804734 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8046d9:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8046de:	eb d1                	jmp    8046b1 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8046e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8046e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8046e6:	77 17                	ja     8046ff <vprintfmt+0x12a>
+  8046e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ec:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8046ef:	89 d2                	mov    %edx,%edx
+  8046f1:	48 01 d0             	add    %rdx,%rax
+  8046f4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8046f7:	83 c2 08             	add    $0x8,%edx
+  8046fa:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8046fd:	eb 0c                	jmp    80470b <vprintfmt+0x136>
+  8046ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804703:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804707:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80470b:	8b 00                	mov    (%rax),%eax
+  80470d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  804710:	eb 23                	jmp    804735 <vprintfmt+0x160>
+        if (width < 0)
+  804712:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804716:	0f 89 44 ff ff ff    	jns    804660 <vprintfmt+0x8b>
+          width = 0;
+  80471c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  804723:	e9 38 ff ff ff       	jmp    804660 <vprintfmt+0x8b>
+        altflag = 1;
+  804728:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80472f:	e9 30 ff ff ff       	jmp    804664 <vprintfmt+0x8f>
+        goto process_precision;
+  804734:	90                   	nop
+        if (width < 0)
+  804735:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804739:	0f 89 24 ff ff ff    	jns    804663 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80473f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804742:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804745:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80474c:	e9 12 ff ff ff       	jmp    804663 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  804751:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  804755:	e9 0a ff ff ff       	jmp    804664 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80475a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80475d:	83 f8 2f             	cmp    $0x2f,%eax
+  804760:	77 17                	ja     804779 <vprintfmt+0x1a4>
+  804762:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804766:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804769:	89 d2                	mov    %edx,%edx
+  80476b:	48 01 d0             	add    %rdx,%rax
+  80476e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804771:	83 c2 08             	add    $0x8,%edx
+  804774:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804777:	eb 0c                	jmp    804785 <vprintfmt+0x1b0>
+  804779:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80477d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804781:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804785:	8b 00                	mov    (%rax),%eax
+  804787:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80478b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80478f:	48 89 d6             	mov    %rdx,%rsi
+  804792:	89 c7                	mov    %eax,%edi
+  804794:	ff d1                	call   *%rcx
+        break;
+  804796:	e9 37 03 00 00       	jmp    804ad2 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80479b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80479e:	83 f8 2f             	cmp    $0x2f,%eax
+  8047a1:	77 17                	ja     8047ba <vprintfmt+0x1e5>
+  8047a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047a7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8047aa:	89 d2                	mov    %edx,%edx
+  8047ac:	48 01 d0             	add    %rdx,%rax
+  8047af:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8047b2:	83 c2 08             	add    $0x8,%edx
+  8047b5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8047b8:	eb 0c                	jmp    8047c6 <vprintfmt+0x1f1>
+  8047ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047be:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8047c2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8047c6:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8047c8:	85 db                	test   %ebx,%ebx
+  8047ca:	79 02                	jns    8047ce <vprintfmt+0x1f9>
+          err = -err;
+  8047cc:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8047ce:	83 fb 15             	cmp    $0x15,%ebx
+  8047d1:	7f 16                	jg     8047e9 <vprintfmt+0x214>
+  8047d3:	48 ba 80 53 80 00 00 	movabs $0x805380,%rdx
+  8047da:	00 00 00 
+  8047dd:	48 63 c3             	movslq %ebx,%rax
+  8047e0:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8047e4:	4d 85 e4             	test   %r12,%r12
+  8047e7:	75 2e                	jne    804817 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8047e9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8047ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047f1:	89 d9                	mov    %ebx,%ecx
+  8047f3:	48 ba 41 54 80 00 00 	movabs $0x805441,%rdx
+  8047fa:	00 00 00 
+  8047fd:	48 89 c7             	mov    %rax,%rdi
+  804800:	b8 00 00 00 00       	mov    $0x0,%eax
+  804805:	49 b8 e1 4a 80 00 00 	movabs $0x804ae1,%r8
+  80480c:	00 00 00 
+  80480f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  804812:	e9 bb 02 00 00       	jmp    804ad2 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  804817:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80481b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80481f:	4c 89 e1             	mov    %r12,%rcx
+  804822:	48 ba 4a 54 80 00 00 	movabs $0x80544a,%rdx
+  804829:	00 00 00 
+  80482c:	48 89 c7             	mov    %rax,%rdi
+  80482f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804834:	49 b8 e1 4a 80 00 00 	movabs $0x804ae1,%r8
+  80483b:	00 00 00 
+  80483e:	41 ff d0             	call   *%r8
+        break;
+  804841:	e9 8c 02 00 00       	jmp    804ad2 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  804846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804849:	83 f8 2f             	cmp    $0x2f,%eax
+  80484c:	77 17                	ja     804865 <vprintfmt+0x290>
+  80484e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804852:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804855:	89 d2                	mov    %edx,%edx
+  804857:	48 01 d0             	add    %rdx,%rax
+  80485a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80485d:	83 c2 08             	add    $0x8,%edx
+  804860:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804863:	eb 0c                	jmp    804871 <vprintfmt+0x29c>
+  804865:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804869:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80486d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804871:	4c 8b 20             	mov    (%rax),%r12
+  804874:	4d 85 e4             	test   %r12,%r12
+  804877:	75 0a                	jne    804883 <vprintfmt+0x2ae>
+          p = "(null)";
+  804879:	49 bc 4d 54 80 00 00 	movabs $0x80544d,%r12
+  804880:	00 00 00 
+        if (width > 0 && padc != '-')
+  804883:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804887:	7e 78                	jle    804901 <vprintfmt+0x32c>
+  804889:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80488d:	74 72                	je     804901 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80488f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804892:	48 98                	cltq
+  804894:	48 89 c6             	mov    %rax,%rsi
+  804897:	4c 89 e7             	mov    %r12,%rdi
+  80489a:	48 b8 c0 06 80 00 00 	movabs $0x8006c0,%rax
+  8048a1:	00 00 00 
+  8048a4:	ff d0                	call   *%rax
+  8048a6:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8048a9:	eb 17                	jmp    8048c2 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8048ab:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8048af:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8048b3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8048b7:	48 89 d6             	mov    %rdx,%rsi
+  8048ba:	89 c7                	mov    %eax,%edi
+  8048bc:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8048be:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8048c2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8048c6:	7f e3                	jg     8048ab <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8048c8:	eb 37                	jmp    804901 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8048ca:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8048ce:	74 1e                	je     8048ee <vprintfmt+0x319>
+  8048d0:	83 fb 1f             	cmp    $0x1f,%ebx
+  8048d3:	7e 05                	jle    8048da <vprintfmt+0x305>
+  8048d5:	83 fb 7e             	cmp    $0x7e,%ebx
+  8048d8:	7e 14                	jle    8048ee <vprintfmt+0x319>
+            putch('?', putdat);
+  8048da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8048de:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8048e2:	48 89 c6             	mov    %rax,%rsi
+  8048e5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8048ea:	ff d2                	call   *%rdx
+  8048ec:	eb 0f                	jmp    8048fd <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8048ee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8048f2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8048f6:	48 89 c6             	mov    %rax,%rsi
+  8048f9:	89 df                	mov    %ebx,%edi
+  8048fb:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8048fd:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  804901:	4c 89 e0             	mov    %r12,%rax
+  804904:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  804908:	0f b6 00             	movzbl (%rax),%eax
+  80490b:	0f be d8             	movsbl %al,%ebx
+  80490e:	85 db                	test   %ebx,%ebx
+  804910:	74 28                	je     80493a <vprintfmt+0x365>
+  804912:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804916:	78 b2                	js     8048ca <vprintfmt+0x2f5>
+  804918:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80491c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804920:	79 a8                	jns    8048ca <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  804922:	eb 16                	jmp    80493a <vprintfmt+0x365>
+          putch(' ', putdat);
+  804924:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804928:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80492c:	48 89 c6             	mov    %rax,%rsi
+  80492f:	bf 20 00 00 00       	mov    $0x20,%edi
+  804934:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  804936:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80493a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80493e:	7f e4                	jg     804924 <vprintfmt+0x34f>
+        break;
+  804940:	e9 8d 01 00 00       	jmp    804ad2 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  804945:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  804948:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80494c:	89 d6                	mov    %edx,%esi
+  80494e:	48 89 c7             	mov    %rax,%rdi
+  804951:	48 b8 de 44 80 00 00 	movabs $0x8044de,%rax
+  804958:	00 00 00 
+  80495b:	ff d0                	call   *%rax
+  80495d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  804961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804965:	48 85 c0             	test   %rax,%rax
+  804968:	79 1d                	jns    804987 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80496a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80496e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804972:	48 89 c6             	mov    %rax,%rsi
+  804975:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80497a:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80497c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804980:	48 f7 d8             	neg    %rax
+  804983:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  804987:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80498e:	e9 d2 00 00 00       	jmp    804a65 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  804993:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  804996:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80499a:	89 d6                	mov    %edx,%esi
+  80499c:	48 89 c7             	mov    %rax,%rdi
+  80499f:	48 b8 e7 43 80 00 00 	movabs $0x8043e7,%rax
+  8049a6:	00 00 00 
+  8049a9:	ff d0                	call   *%rax
+  8049ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8049af:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8049b6:	e9 aa 00 00 00       	jmp    804a65 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8049bb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8049be:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8049c2:	89 d6                	mov    %edx,%esi
+  8049c4:	48 89 c7             	mov    %rax,%rdi
+  8049c7:	48 b8 e7 43 80 00 00 	movabs $0x8043e7,%rax
+  8049ce:	00 00 00 
+  8049d1:	ff d0                	call   *%rax
+  8049d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8049d7:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8049de:	e9 82 00 00 00       	jmp    804a65 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8049e3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8049e7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8049eb:	48 89 c6             	mov    %rax,%rsi
+  8049ee:	bf 30 00 00 00       	mov    $0x30,%edi
+  8049f3:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8049f5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8049f9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8049fd:	48 89 c6             	mov    %rax,%rsi
+  804a00:	bf 78 00 00 00       	mov    $0x78,%edi
+  804a05:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  804a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  804a0d:	77 17                	ja     804a26 <vprintfmt+0x451>
+  804a0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a13:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804a16:	89 d2                	mov    %edx,%edx
+  804a18:	48 01 d0             	add    %rdx,%rax
+  804a1b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804a1e:	83 c2 08             	add    $0x8,%edx
+  804a21:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804a24:	eb 0c                	jmp    804a32 <vprintfmt+0x45d>
+  804a26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a2a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804a2e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804a32:	48 8b 00             	mov    (%rax),%rax
+  804a35:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  804a39:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  804a40:	eb 23                	jmp    804a65 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  804a42:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  804a45:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  804a49:	89 d6                	mov    %edx,%esi
+  804a4b:	48 89 c7             	mov    %rax,%rdi
+  804a4e:	48 b8 e7 43 80 00 00 	movabs $0x8043e7,%rax
+  804a55:	00 00 00 
+  804a58:	ff d0                	call   *%rax
+  804a5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  804a5e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  804a65:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  804a6a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  804a6d:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  804a70:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a74:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  804a78:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a7c:	45 89 c1             	mov    %r8d,%r9d
+  804a7f:	41 89 f8             	mov    %edi,%r8d
+  804a82:	48 89 c7             	mov    %rax,%rdi
+  804a85:	48 b8 2f 43 80 00 00 	movabs $0x80432f,%rax
+  804a8c:	00 00 00 
+  804a8f:	ff d0                	call   *%rax
+        break;
+  804a91:	eb 3f                	jmp    804ad2 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  804a93:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804a97:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804a9b:	48 89 c6             	mov    %rax,%rsi
+  804a9e:	89 df                	mov    %ebx,%edi
+  804aa0:	ff d2                	call   *%rdx
+        break;
+  804aa2:	eb 2e                	jmp    804ad2 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  804aa4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804aa8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804aac:	48 89 c6             	mov    %rax,%rsi
+  804aaf:	bf 25 00 00 00       	mov    $0x25,%edi
+  804ab4:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  804ab6:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  804abb:	eb 05                	jmp    804ac2 <vprintfmt+0x4ed>
+  804abd:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  804ac2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ac6:	48 83 e8 01          	sub    $0x1,%rax
+  804aca:	0f b6 00             	movzbl (%rax),%eax
+  804acd:	3c 25                	cmp    $0x25,%al
+  804acf:	75 ec                	jne    804abd <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  804ad1:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  804ad2:	e9 50 fb ff ff       	jmp    804627 <vprintfmt+0x52>
+        return;
+  804ad7:	90                   	nop
+    }
+  }
+}
+  804ad8:	48 83 c4 60          	add    $0x60,%rsp
+  804adc:	5b                   	pop    %rbx
+  804add:	41 5c                	pop    %r12
+  804adf:	5d                   	pop    %rbp
+  804ae0:	c3                   	ret
+
+0000000000804ae1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  804ae1:	55                   	push   %rbp
+  804ae2:	48 89 e5             	mov    %rsp,%rbp
+  804ae5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  804aec:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804af3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804afa:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  804b01:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804b08:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804b0f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804b16:	84 c0                	test   %al,%al
+  804b18:	74 20                	je     804b3a <printfmt+0x59>
+  804b1a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804b1e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804b22:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804b26:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804b2a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804b2e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804b32:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804b36:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b3a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  804b41:	00 00 00 
+  804b44:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  804b4b:	00 00 00 
+  804b4e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b52:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  804b59:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804b60:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  804b67:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  804b6e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804b75:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  804b7c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804b83:	48 89 c7             	mov    %rax,%rdi
+  804b86:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  804b8d:	00 00 00 
+  804b90:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  804b92:	90                   	nop
+  804b93:	c9                   	leave
+  804b94:	c3                   	ret
+
+0000000000804b95 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  804b95:	55                   	push   %rbp
+  804b96:	48 89 e5             	mov    %rsp,%rbp
+  804b99:	48 83 ec 10          	sub    $0x10,%rsp
+  804b9d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804ba0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  804ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ba8:	8b 40 10             	mov    0x10(%rax),%eax
+  804bab:	8d 50 01             	lea    0x1(%rax),%edx
+  804bae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bb2:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  804bb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bb9:	48 8b 10             	mov    (%rax),%rdx
+  804bbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bc0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bc4:	48 39 c2             	cmp    %rax,%rdx
+  804bc7:	73 17                	jae    804be0 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  804bc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bcd:	48 8b 00             	mov    (%rax),%rax
+  804bd0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804bd4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bd8:	48 89 0a             	mov    %rcx,(%rdx)
+  804bdb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804bde:	88 10                	mov    %dl,(%rax)
+}
+  804be0:	90                   	nop
+  804be1:	c9                   	leave
+  804be2:	c3                   	ret
+
+0000000000804be3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  804be3:	55                   	push   %rbp
+  804be4:	48 89 e5             	mov    %rsp,%rbp
+  804be7:	48 83 ec 40          	sub    $0x40,%rsp
+  804beb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804bef:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804bf2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804bf6:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  804bfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bfe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c02:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c05:	48 98                	cltq
+  804c07:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804c0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c0f:	48 01 d0             	add    %rdx,%rax
+  804c12:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  804c16:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  804c1d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804c22:	74 06                	je     804c2a <vsnprintf+0x47>
+  804c24:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  804c28:	7f 07                	jg     804c31 <vsnprintf+0x4e>
+    return -E_INVAL;
+  804c2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804c2f:	eb 32                	jmp    804c63 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  804c31:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804c35:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c39:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c3d:	48 89 c6             	mov    %rax,%rsi
+  804c40:	48 b8 95 4b 80 00 00 	movabs $0x804b95,%rax
+  804c47:	00 00 00 
+  804c4a:	48 89 c7             	mov    %rax,%rdi
+  804c4d:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  804c54:	00 00 00 
+  804c57:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  804c59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c5d:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  804c60:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  804c63:	c9                   	leave
+  804c64:	c3                   	ret
+
+0000000000804c65 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  804c65:	55                   	push   %rbp
+  804c66:	48 89 e5             	mov    %rsp,%rbp
+  804c69:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  804c70:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804c77:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  804c7d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  804c84:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804c8b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804c92:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804c99:	84 c0                	test   %al,%al
+  804c9b:	74 20                	je     804cbd <snprintf+0x58>
+  804c9d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804ca1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804ca5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804ca9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804cad:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804cb1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804cb5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804cb9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  804cbd:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  804cc4:	00 00 00 
+  804cc7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804cce:	00 00 00 
+  804cd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804cd5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804cdc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804ce3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  804cea:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  804cf1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804cf8:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  804cfe:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804d05:	48 89 c7             	mov    %rax,%rdi
+  804d08:	48 b8 e3 4b 80 00 00 	movabs $0x804be3,%rax
+  804d0f:	00 00 00 
+  804d12:	ff d0                	call   *%rax
+  804d14:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  804d1a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804d20:	c9                   	leave
+  804d21:	c3                   	ret
+
+0000000000804d22 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804d22:	55                   	push   %rbp
+  804d23:	48 89 e5             	mov    %rsp,%rbp
+  804d26:	48 83 ec 20          	sub    $0x20,%rsp
+  804d2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d32:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804d36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d3a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804d3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d42:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804d49:	48 89 c7             	mov    %rax,%rdi
+  804d4c:	48 b8 5a 4d 80 00 00 	movabs $0x804d5a,%rax
+  804d53:	00 00 00 
+  804d56:	ff d0                	call   *%rax
+}
+  804d58:	c9                   	leave
+  804d59:	c3                   	ret
+
+0000000000804d5a <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804d5a:	55                   	push   %rbp
+  804d5b:	48 89 e5             	mov    %rsp,%rbp
+  804d5e:	48 83 ec 30          	sub    $0x30,%rsp
+  804d62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d66:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d6a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804d6e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804d72:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804d77:	75 0e                	jne    804d87 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804d79:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d80:	00 00 00 
+  804d83:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804d87:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804d8c:	75 18                	jne    804da6 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804d8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d92:	48 89 c7             	mov    %rax,%rdi
+  804d95:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  804d9c:	00 00 00 
+  804d9f:	ff d0                	call   *%rax
+  804da1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804da4:	eb 1d                	jmp    804dc3 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804da6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804daa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dae:	48 89 d6             	mov    %rdx,%rsi
+  804db1:	48 89 c7             	mov    %rax,%rdi
+  804db4:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  804dbb:	00 00 00 
+  804dbe:	ff d0                	call   *%rax
+  804dc0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804dc3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dc7:	79 2a                	jns    804df3 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804dc9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804dce:	74 0a                	je     804dda <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dd4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804dda:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ddf:	74 0a                	je     804deb <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804de1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804de5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dee:	e9 aa 00 00 00       	jmp    804e9d <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804df3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804df8:	74 36                	je     804e30 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804dfa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e01:	00 00 00 
+  804e04:	8b 40 04             	mov    0x4(%rax),%eax
+  804e07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e13:	00 00 00 
+  804e16:	48 98                	cltq
+  804e18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e1f:	48 01 d0             	add    %rdx,%rax
+  804e22:	48 05 24 01 00 00    	add    $0x124,%rax
+  804e28:	8b 10                	mov    (%rax),%edx
+  804e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e2e:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804e30:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e35:	74 36                	je     804e6d <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804e37:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e3e:	00 00 00 
+  804e41:	8b 40 04             	mov    0x4(%rax),%eax
+  804e44:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e49:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e50:	00 00 00 
+  804e53:	48 98                	cltq
+  804e55:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e5c:	48 01 d0             	add    %rdx,%rax
+  804e5f:	48 05 28 01 00 00    	add    $0x128,%rax
+  804e65:	8b 10                	mov    (%rax),%edx
+  804e67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e6b:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804e6d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e74:	00 00 00 
+  804e77:	8b 40 04             	mov    0x4(%rax),%eax
+  804e7a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e7f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e86:	00 00 00 
+  804e89:	48 98                	cltq
+  804e8b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e92:	48 01 d0             	add    %rdx,%rax
+  804e95:	48 05 20 01 00 00    	add    $0x120,%rax
+  804e9b:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804e9d:	c9                   	leave
+  804e9e:	c3                   	ret
+
+0000000000804e9f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804e9f:	55                   	push   %rbp
+  804ea0:	48 89 e5             	mov    %rsp,%rbp
+  804ea3:	48 83 ec 30          	sub    $0x30,%rsp
+  804ea7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804eaa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804ead:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804eb1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804eb4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804eb9:	75 5e                	jne    804f19 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804ebb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ec2:	00 00 00 
+  804ec5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804ec9:	eb 4e                	jmp    804f19 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804ecb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ecf:	79 3c                	jns    804f0d <ipc_send+0x6e>
+  804ed1:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804ed5:	74 36                	je     804f0d <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eda:	89 c1                	mov    %eax,%ecx
+  804edc:	48 b8 08 57 80 00 00 	movabs $0x805708,%rax
+  804ee3:	00 00 00 
+  804ee6:	48 89 c2             	mov    %rax,%rdx
+  804ee9:	be 54 00 00 00       	mov    $0x54,%esi
+  804eee:	48 b8 2e 57 80 00 00 	movabs $0x80572e,%rax
+  804ef5:	00 00 00 
+  804ef8:	48 89 c7             	mov    %rax,%rdi
+  804efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f00:	49 b8 5c 40 80 00 00 	movabs $0x80405c,%r8
+  804f07:	00 00 00 
+  804f0a:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804f0d:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  804f14:	00 00 00 
+  804f17:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f19:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804f1c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804f1f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f26:	89 c7                	mov    %eax,%edi
+  804f28:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  804f2f:	00 00 00 
+  804f32:	ff d0                	call   *%rax
+  804f34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f3b:	75 8e                	jne    804ecb <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804f3d:	48 b8 8f 14 80 00 00 	movabs $0x80148f,%rax
+  804f44:	00 00 00 
+  804f47:	ff d0                	call   *%rax
+}
+  804f49:	90                   	nop
+  804f4a:	c9                   	leave
+  804f4b:	c3                   	ret
+
+0000000000804f4c <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804f4c:	55                   	push   %rbp
+  804f4d:	48 89 e5             	mov    %rsp,%rbp
+  804f50:	48 83 ec 18          	sub    $0x18,%rsp
+  804f54:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804f57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804f5e:	eb 4d                	jmp    804fad <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804f60:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f67:	00 00 00 
+  804f6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f6d:	48 98                	cltq
+  804f6f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f76:	48 01 d0             	add    %rdx,%rax
+  804f79:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804f7f:	8b 00                	mov    (%rax),%eax
+  804f81:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804f84:	75 23                	jne    804fa9 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804f86:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f8d:	00 00 00 
+  804f90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f93:	48 98                	cltq
+  804f95:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f9c:	48 01 d0             	add    %rdx,%rax
+  804f9f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804fa5:	8b 00                	mov    (%rax),%eax
+  804fa7:	eb 12                	jmp    804fbb <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804fa9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804fad:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804fb4:	7e aa                	jle    804f60 <ipc_find_env+0x14>
+  return 0;
+  804fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fbb:	c9                   	leave
+  804fbc:	c3                   	ret
+
+0000000000804fbd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804fbd:	55                   	push   %rbp
+  804fbe:	48 89 e5             	mov    %rsp,%rbp
+  804fc1:	48 83 ec 18          	sub    $0x18,%rsp
+  804fc5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcd:	48 c1 e8 27          	shr    $0x27,%rax
+  804fd1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804fd6:	48 89 c2             	mov    %rax,%rdx
+  804fd9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804fe0:	01 00 00 
+  804fe3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fe7:	83 e0 01             	and    $0x1,%eax
+  804fea:	48 85 c0             	test   %rax,%rax
+  804fed:	74 63                	je     805052 <pageref+0x95>
+  804fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804ff7:	48 89 c2             	mov    %rax,%rdx
+  804ffa:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805001:	01 00 00 
+  805004:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805008:	83 e0 01             	and    $0x1,%eax
+  80500b:	48 85 c0             	test   %rax,%rax
+  80500e:	74 42                	je     805052 <pageref+0x95>
+  805010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805014:	48 c1 e8 15          	shr    $0x15,%rax
+  805018:	48 89 c2             	mov    %rax,%rdx
+  80501b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805022:	01 00 00 
+  805025:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805029:	83 e0 01             	and    $0x1,%eax
+  80502c:	48 85 c0             	test   %rax,%rax
+  80502f:	74 21                	je     805052 <pageref+0x95>
+  805031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805035:	48 c1 e8 0c          	shr    $0xc,%rax
+  805039:	48 89 c2             	mov    %rax,%rdx
+  80503c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805043:	01 00 00 
+  805046:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80504a:	83 e0 01             	and    $0x1,%eax
+  80504d:	48 85 c0             	test   %rax,%rax
+  805050:	75 07                	jne    805059 <pageref+0x9c>
+    return 0;
+  805052:	b8 00 00 00 00       	mov    $0x0,%eax
+  805057:	eb 53                	jmp    8050ac <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805059:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80505d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805061:	48 89 c2             	mov    %rax,%rdx
+  805064:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80506b:	01 00 00 
+  80506e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805072:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805076:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80507a:	83 e0 01             	and    $0x1,%eax
+  80507d:	48 85 c0             	test   %rax,%rax
+  805080:	75 07                	jne    805089 <pageref+0xcc>
+    return 0;
+  805082:	b8 00 00 00 00       	mov    $0x0,%eax
+  805087:	eb 23                	jmp    8050ac <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805089:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80508d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805091:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805098:	00 00 00 
+  80509b:	48 c1 e0 04          	shl    $0x4,%rax
+  80509f:	48 01 d0             	add    %rdx,%rax
+  8050a2:	48 83 c0 08          	add    $0x8,%rax
+  8050a6:	0f b7 00             	movzwl (%rax),%eax
+  8050a9:	0f b7 c0             	movzwl %ax,%eax
+}
+  8050ac:	c9                   	leave
+  8050ad:	c3                   	ret
+  8050ae:	66 90                	xchg   %ax,%ax
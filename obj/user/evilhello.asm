@@ -0,0 +1,8047 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 36 00 00 00       	call   800062 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// kernel should destroy user environment in response
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  // try to print the kernel entry point as a string!  mua ha ha!
+  sys_cputs((char *)0x804020000c, 100);
+  800041:	be 64 00 00 00       	mov    $0x64,%esi
+  800046:	48 b8 0c 00 20 40 80 	movabs $0x804020000c,%rax
+  80004d:	00 00 00 
+  800050:	48 89 c7             	mov    %rax,%rdi
+  800053:	48 b8 a2 01 80 00 00 	movabs $0x8001a2,%rax
+  80005a:	00 00 00 
+  80005d:	ff d0                	call   *%rax
+}
+  80005f:	90                   	nop
+  800060:	c9                   	leave
+  800061:	c3                   	ret
+
+0000000000800062 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800062:	55                   	push   %rbp
+  800063:	48 89 e5             	mov    %rsp,%rbp
+  800066:	48 83 ec 20          	sub    $0x20,%rsp
+  80006a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80006d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800071:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800078:	00 00 00 
+  80007b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80007f:	eb 13                	jmp    800094 <libmain+0x32>
+    (*ctor)();
+  800081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800085:	48 8b 10             	mov    (%rax),%rdx
+  800088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008d:	ff d2                	call   *%rdx
+    ctor++;
+  80008f:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800094:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80009b:	00 00 00 
+  80009e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000a2:	72 dd                	jb     800081 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a8:	7e 14                	jle    8000be <libmain+0x5c>
+    binaryname = argv[0];
+  8000aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000ae:	48 8b 00             	mov    (%rax),%rax
+  8000b1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000b8:	00 00 00 
+  8000bb:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000c5:	48 89 d6             	mov    %rdx,%rsi
+  8000c8:	89 c7                	mov    %eax,%edi
+  8000ca:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000d6:	48 b8 e5 00 80 00 00 	movabs $0x8000e5,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+#endif
+}
+  8000e2:	90                   	nop
+  8000e3:	c9                   	leave
+  8000e4:	c3                   	ret
+
+00000000008000e5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000e9:	48 b8 90 0e 80 00 00 	movabs $0x800e90,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fa:	48 b8 71 02 80 00 00 	movabs $0x800271,%rax
+  800101:	00 00 00 
+  800104:	ff d0                	call   *%rax
+}
+  800106:	90                   	nop
+  800107:	5d                   	pop    %rbp
+  800108:	c3                   	ret
+
+0000000000800109 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  800109:	55                   	push   %rbp
+  80010a:	48 89 e5             	mov    %rsp,%rbp
+  80010d:	53                   	push   %rbx
+  80010e:	48 83 ec 48          	sub    $0x48,%rsp
+  800112:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800116:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80011a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80011e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800122:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800126:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80012a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80012e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800132:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800136:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80013a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80013e:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800142:	4c 89 c3             	mov    %r8,%rbx
+  800145:	cd 30                	int    $0x30
+  800147:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80014b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800150:	74 46                	je     800198 <syscall+0x8f>
+  800152:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800157:	7e 3f                	jle    800198 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800159:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80015d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800161:	49 89 d0             	mov    %rdx,%r8
+  800164:	48 89 c1             	mov    %rax,%rcx
+  800167:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  80016e:	00 00 00 
+  800171:	48 89 c2             	mov    %rax,%rdx
+  800174:	be 22 00 00 00       	mov    $0x22,%esi
+  800179:	48 b8 0f 50 80 00 00 	movabs $0x80500f,%rax
+  800180:	00 00 00 
+  800183:	48 89 c7             	mov    %rax,%rdi
+  800186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018b:	49 b9 49 2f 80 00 00 	movabs $0x802f49,%r9
+  800192:	00 00 00 
+  800195:	41 ff d1             	call   *%r9
+
+  return ret;
+  800198:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80019c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a0:	c9                   	leave
+  8001a1:	c3                   	ret
+
+00000000008001a2 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001a2:	55                   	push   %rbp
+  8001a3:	48 89 e5             	mov    %rsp,%rbp
+  8001a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8001aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8001be:	6a 00                	push   $0x0
+  8001c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001cc:	48 89 d1             	mov    %rdx,%rcx
+  8001cf:	48 89 c2             	mov    %rax,%rdx
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001dc:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+  8001e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001ec:	90                   	nop
+  8001ed:	c9                   	leave
+  8001ee:	c3                   	ret
+
+00000000008001ef <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001ef:	55                   	push   %rbp
+  8001f0:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8001f7:	6a 00                	push   $0x0
+  8001f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800205:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80020a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020f:	be 00 00 00 00       	mov    $0x0,%esi
+  800214:	bf 01 00 00 00       	mov    $0x1,%edi
+  800219:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800220:	00 00 00 
+  800223:	ff d0                	call   *%rax
+  800225:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800229:	c9                   	leave
+  80022a:	c3                   	ret
+
+000000000080022b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80022b:	55                   	push   %rbp
+  80022c:	48 89 e5             	mov    %rsp,%rbp
+  80022f:	48 83 ec 10          	sub    $0x10,%rsp
+  800233:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800236:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800239:	48 98                	cltq
+  80023b:	48 83 ec 08          	sub    $0x8,%rsp
+  80023f:	6a 00                	push   $0x0
+  800241:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80024d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800252:	48 89 c2             	mov    %rax,%rdx
+  800255:	be 01 00 00 00       	mov    $0x1,%esi
+  80025a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80025f:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800266:	00 00 00 
+  800269:	ff d0                	call   *%rax
+  80026b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80026f:	c9                   	leave
+  800270:	c3                   	ret
+
+0000000000800271 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800271:	55                   	push   %rbp
+  800272:	48 89 e5             	mov    %rsp,%rbp
+  800275:	48 83 ec 10          	sub    $0x10,%rsp
+  800279:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80027c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80027f:	48 98                	cltq
+  800281:	48 83 ec 08          	sub    $0x8,%rsp
+  800285:	6a 00                	push   $0x0
+  800287:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80028d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800293:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800298:	48 89 c2             	mov    %rax,%rdx
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002a5:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8002ac:	00 00 00 
+  8002af:	ff d0                	call   *%rax
+  8002b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002b5:	90                   	nop
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+00000000008002b8 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002b8:	55                   	push   %rbp
+  8002b9:	48 89 e5             	mov    %rsp,%rbp
+  8002bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8002c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ca:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002cd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002d2:	cd 30                	int    $0x30
+  8002d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002d8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002e1:	7e 3d                	jle    800320 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002e7:	49 89 c0             	mov    %rax,%r8
+  8002ea:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002ef:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  8002f6:	00 00 00 
+  8002f9:	48 89 c2             	mov    %rax,%rdx
+  8002fc:	be 49 00 00 00       	mov    $0x49,%esi
+  800301:	48 b8 0f 50 80 00 00 	movabs $0x80500f,%rax
+  800308:	00 00 00 
+  80030b:	48 89 c7             	mov    %rax,%rdi
+  80030e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800313:	49 b9 49 2f 80 00 00 	movabs $0x802f49,%r9
+  80031a:	00 00 00 
+  80031d:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800320:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800325:	75 13                	jne    80033a <sys_env_wait+0x82>
+  800327:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80032c:	74 0c                	je     80033a <sys_env_wait+0x82>
+    *status = st;
+  80032e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800332:	89 c2                	mov    %eax,%edx
+  800334:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800338:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80033a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80033e:	c9                   	leave
+  80033f:	c3                   	ret
+
+0000000000800340 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800344:	48 83 ec 08          	sub    $0x8,%rsp
+  800348:	6a 00                	push   $0x0
+  80034a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800350:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800356:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80035b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800360:	be 00 00 00 00       	mov    $0x0,%esi
+  800365:	bf 02 00 00 00       	mov    $0x2,%edi
+  80036a:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+  800376:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80037a:	c9                   	leave
+  80037b:	c3                   	ret
+
+000000000080037c <sys_yield>:
+
+void
+sys_yield(void) {
+  80037c:	55                   	push   %rbp
+  80037d:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800380:	48 83 ec 08          	sub    $0x8,%rsp
+  800384:	6a 00                	push   $0x0
+  800386:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80038c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800392:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003a6:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+  8003b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003b6:	90                   	nop
+  8003b7:	c9                   	leave
+  8003b8:	c3                   	ret
+
+00000000008003b9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8003c1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003c4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003c8:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003cb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003ce:	48 63 c8             	movslq %eax,%rcx
+  8003d1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003d8:	48 98                	cltq
+  8003da:	48 83 ec 08          	sub    $0x8,%rsp
+  8003de:	6a 00                	push   $0x0
+  8003e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003e6:	49 89 c8             	mov    %rcx,%r8
+  8003e9:	48 89 d1             	mov    %rdx,%rcx
+  8003ec:	48 89 c2             	mov    %rax,%rdx
+  8003ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8003f4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003f9:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+  800405:	48 83 c4 10          	add    $0x10,%rsp
+  800409:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80040c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+0000000000800411 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800411:	55                   	push   %rbp
+  800412:	48 89 e5             	mov    %rsp,%rbp
+  800415:	48 83 ec 20          	sub    $0x20,%rsp
+  800419:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80041c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800420:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800423:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800427:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80042b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80042e:	48 63 c8             	movslq %eax,%rcx
+  800431:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800435:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800438:	48 63 f0             	movslq %eax,%rsi
+  80043b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80043f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800442:	48 98                	cltq
+  800444:	48 83 ec 08          	sub    $0x8,%rsp
+  800448:	51                   	push   %rcx
+  800449:	49 89 f9             	mov    %rdi,%r9
+  80044c:	49 89 f0             	mov    %rsi,%r8
+  80044f:	48 89 d1             	mov    %rdx,%rcx
+  800452:	48 89 c2             	mov    %rax,%rdx
+  800455:	be 01 00 00 00       	mov    $0x1,%esi
+  80045a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80045f:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800466:	00 00 00 
+  800469:	ff d0                	call   *%rax
+  80046b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80046f:	c9                   	leave
+  800470:	c3                   	ret
+
+0000000000800471 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800471:	55                   	push   %rbp
+  800472:	48 89 e5             	mov    %rsp,%rbp
+  800475:	48 83 ec 10          	sub    $0x10,%rsp
+  800479:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80047c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800480:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800484:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800487:	48 98                	cltq
+  800489:	48 83 ec 08          	sub    $0x8,%rsp
+  80048d:	6a 00                	push   $0x0
+  80048f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800495:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80049b:	48 89 d1             	mov    %rdx,%rcx
+  80049e:	48 89 c2             	mov    %rax,%rdx
+  8004a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8004a6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004ab:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8004b2:	00 00 00 
+  8004b5:	ff d0                	call   *%rax
+  8004b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004bb:	c9                   	leave
+  8004bc:	c3                   	ret
+
+00000000008004bd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004bd:	55                   	push   %rbp
+  8004be:	48 89 e5             	mov    %rsp,%rbp
+  8004c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8004c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004c8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004cb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004ce:	48 63 d0             	movslq %eax,%rdx
+  8004d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004d4:	48 98                	cltq
+  8004d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8004da:	6a 00                	push   $0x0
+  8004dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004e8:	48 89 d1             	mov    %rdx,%rcx
+  8004eb:	48 89 c2             	mov    %rax,%rdx
+  8004ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8004f3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004f8:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+  800504:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800508:	c9                   	leave
+  800509:	c3                   	ret
+
+000000000080050a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80050a:	55                   	push   %rbp
+  80050b:	48 89 e5             	mov    %rsp,%rbp
+  80050e:	48 83 ec 10          	sub    $0x10,%rsp
+  800512:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800515:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800519:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80051d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800520:	48 98                	cltq
+  800522:	48 83 ec 08          	sub    $0x8,%rsp
+  800526:	6a 00                	push   $0x0
+  800528:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80052e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800534:	48 89 d1             	mov    %rdx,%rcx
+  800537:	48 89 c2             	mov    %rax,%rdx
+  80053a:	be 01 00 00 00       	mov    $0x1,%esi
+  80053f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800544:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  80054b:	00 00 00 
+  80054e:	ff d0                	call   *%rax
+  800550:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800554:	c9                   	leave
+  800555:	c3                   	ret
+
+0000000000800556 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800556:	55                   	push   %rbp
+  800557:	48 89 e5             	mov    %rsp,%rbp
+  80055a:	48 83 ec 10          	sub    $0x10,%rsp
+  80055e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800561:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800565:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800569:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80056c:	48 98                	cltq
+  80056e:	48 83 ec 08          	sub    $0x8,%rsp
+  800572:	6a 00                	push   $0x0
+  800574:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80057a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800580:	48 89 d1             	mov    %rdx,%rcx
+  800583:	48 89 c2             	mov    %rax,%rdx
+  800586:	be 01 00 00 00       	mov    $0x1,%esi
+  80058b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800590:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800597:	00 00 00 
+  80059a:	ff d0                	call   *%rax
+  80059c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005a0:	c9                   	leave
+  8005a1:	c3                   	ret
+
+00000000008005a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005a2:	55                   	push   %rbp
+  8005a3:	48 89 e5             	mov    %rsp,%rbp
+  8005a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8005aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005b5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005b8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005bb:	48 63 f0             	movslq %eax,%rsi
+  8005be:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005c9:	48 98                	cltq
+  8005cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cf:	6a 00                	push   $0x0
+  8005d1:	49 89 f1             	mov    %rsi,%r9
+  8005d4:	49 89 c8             	mov    %rcx,%r8
+  8005d7:	48 89 d1             	mov    %rdx,%rcx
+  8005da:	48 89 c2             	mov    %rax,%rdx
+  8005dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e2:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005e7:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8005ee:	00 00 00 
+  8005f1:	ff d0                	call   *%rax
+  8005f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005f7:	c9                   	leave
+  8005f8:	c3                   	ret
+
+00000000008005f9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005f9:	55                   	push   %rbp
+  8005fa:	48 89 e5             	mov    %rsp,%rbp
+  8005fd:	48 83 ec 10          	sub    $0x10,%rsp
+  800601:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  800605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800609:	48 83 ec 08          	sub    $0x8,%rsp
+  80060d:	6a 00                	push   $0x0
+  80060f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80061b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800620:	48 89 c2             	mov    %rax,%rdx
+  800623:	be 01 00 00 00       	mov    $0x1,%esi
+  800628:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80062d:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800634:	00 00 00 
+  800637:	ff d0                	call   *%rax
+  800639:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80063d:	c9                   	leave
+  80063e:	c3                   	ret
+
+000000000080063f <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80063f:	55                   	push   %rbp
+  800640:	48 89 e5             	mov    %rsp,%rbp
+  800643:	48 83 ec 10          	sub    $0x10,%rsp
+  800647:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80064b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80064f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800657:	48 83 ec 08          	sub    $0x8,%rsp
+  80065b:	6a 00                	push   $0x0
+  80065d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800669:	48 89 d1             	mov    %rdx,%rcx
+  80066c:	48 89 c2             	mov    %rax,%rdx
+  80066f:	be 01 00 00 00       	mov    $0x1,%esi
+  800674:	bf 10 00 00 00       	mov    $0x10,%edi
+  800679:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800680:	00 00 00 
+  800683:	ff d0                	call   *%rax
+  800685:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800689:	c9                   	leave
+  80068a:	c3                   	ret
+
+000000000080068b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80068b:	55                   	push   %rbp
+  80068c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80068f:	48 83 ec 08          	sub    $0x8,%rsp
+  800693:	6a 00                	push   $0x0
+  800695:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80069b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b0:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006b5:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8006bc:	00 00 00 
+  8006bf:	ff d0                	call   *%rax
+  8006c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006c5:	c9                   	leave
+  8006c6:	c3                   	ret
+
+00000000008006c7 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006c7:	55                   	push   %rbp
+  8006c8:	48 89 e5             	mov    %rsp,%rbp
+  8006cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8006cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006df:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e3:	6a 00                	push   $0x0
+  8006e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006f1:	48 89 d1             	mov    %rdx,%rcx
+  8006f4:	48 89 c2             	mov    %rax,%rdx
+  8006f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fc:	bf 12 00 00 00       	mov    $0x12,%edi
+  800701:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800708:	00 00 00 
+  80070b:	ff d0                	call   *%rax
+  80070d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800711:	c9                   	leave
+  800712:	c3                   	ret
+
+0000000000800713 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800713:	55                   	push   %rbp
+  800714:	48 89 e5             	mov    %rsp,%rbp
+  800717:	48 83 ec 20          	sub    $0x20,%rsp
+  80071b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80071f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800723:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800726:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800729:	48 63 c8             	movslq %eax,%rcx
+  80072c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800730:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800734:	48 83 ec 08          	sub    $0x8,%rsp
+  800738:	6a 00                	push   $0x0
+  80073a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800740:	49 89 c8             	mov    %rcx,%r8
+  800743:	48 89 d1             	mov    %rdx,%rcx
+  800746:	48 89 c2             	mov    %rax,%rdx
+  800749:	be 00 00 00 00       	mov    $0x0,%esi
+  80074e:	bf 13 00 00 00       	mov    $0x13,%edi
+  800753:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  80075a:	00 00 00 
+  80075d:	ff d0                	call   *%rax
+  80075f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+
+0000000000800765 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800765:	55                   	push   %rbp
+  800766:	48 89 e5             	mov    %rsp,%rbp
+  800769:	48 83 ec 20          	sub    $0x20,%rsp
+  80076d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800771:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800774:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  800778:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80077c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80077f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800783:	48 83 ec 08          	sub    $0x8,%rsp
+  800787:	6a 00                	push   $0x0
+  800789:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80078f:	49 89 c8             	mov    %rcx,%r8
+  800792:	48 89 d1             	mov    %rdx,%rcx
+  800795:	48 89 c2             	mov    %rax,%rdx
+  800798:	be 00 00 00 00       	mov    $0x0,%esi
+  80079d:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007a2:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8007a9:	00 00 00 
+  8007ac:	ff d0                	call   *%rax
+  8007ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007b2:	c9                   	leave
+  8007b3:	c3                   	ret
+
+00000000008007b4 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007b4:	55                   	push   %rbp
+  8007b5:	48 89 e5             	mov    %rsp,%rbp
+  8007b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8007bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007c0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007c6:	48 63 d0             	movslq %eax,%rdx
+  8007c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8007d1:	6a 00                	push   $0x0
+  8007d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007df:	48 89 d1             	mov    %rdx,%rcx
+  8007e2:	48 89 c2             	mov    %rax,%rdx
+  8007e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ea:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007ef:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8007f6:	00 00 00 
+  8007f9:	ff d0                	call   *%rax
+  8007fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007ff:	c9                   	leave
+  800800:	c3                   	ret
+
+0000000000800801 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  800801:	55                   	push   %rbp
+  800802:	48 89 e5             	mov    %rsp,%rbp
+  800805:	48 83 ec 20          	sub    $0x20,%rsp
+  800809:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80080d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800810:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800813:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  800817:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80081b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80081e:	48 63 c8             	movslq %eax,%rcx
+  800821:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800824:	48 63 d0             	movslq %eax,%rdx
+  800827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082b:	48 83 ec 08          	sub    $0x8,%rsp
+  80082f:	6a 00                	push   $0x0
+  800831:	49 89 f1             	mov    %rsi,%r9
+  800834:	49 89 c8             	mov    %rcx,%r8
+  800837:	48 89 d1             	mov    %rdx,%rcx
+  80083a:	48 89 c2             	mov    %rax,%rdx
+  80083d:	be 00 00 00 00       	mov    $0x0,%esi
+  800842:	bf 16 00 00 00       	mov    $0x16,%edi
+  800847:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  80084e:	00 00 00 
+  800851:	ff d0                	call   *%rax
+  800853:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+0000000000800859 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800859:	55                   	push   %rbp
+  80085a:	48 89 e5             	mov    %rsp,%rbp
+  80085d:	48 83 ec 30          	sub    $0x30,%rsp
+  800861:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800865:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800869:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80086d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800871:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800875:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800879:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80087d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800881:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800885:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800889:	48 83 ec 08          	sub    $0x8,%rsp
+  80088d:	51                   	push   %rcx
+  80088e:	49 89 f9             	mov    %rdi,%r9
+  800891:	49 89 f0             	mov    %rsi,%r8
+  800894:	48 89 d1             	mov    %rdx,%rcx
+  800897:	48 89 c2             	mov    %rax,%rdx
+  80089a:	be 00 00 00 00       	mov    $0x0,%esi
+  80089f:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008a4:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8008ab:	00 00 00 
+  8008ae:	ff d0                	call   *%rax
+  8008b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008b4:	c9                   	leave
+  8008b5:	c3                   	ret
+
+00000000008008b6 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008b6:	55                   	push   %rbp
+  8008b7:	48 89 e5             	mov    %rsp,%rbp
+  8008ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8008be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008c4:	48 98                	cltq
+  8008c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ca:	6a 00                	push   $0x0
+  8008cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008dd:	48 89 c2             	mov    %rax,%rdx
+  8008e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e5:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008ea:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8008f1:	00 00 00 
+  8008f4:	ff d0                	call   *%rax
+  8008f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008fa:	90                   	nop
+  8008fb:	c9                   	leave
+  8008fc:	c3                   	ret
+
+00000000008008fd <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008fd:	55                   	push   %rbp
+  8008fe:	48 89 e5             	mov    %rsp,%rbp
+  800901:	48 83 ec 30          	sub    $0x30,%rsp
+  800905:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800908:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80090c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800910:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800913:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800916:	48 63 f0             	movslq %eax,%rsi
+  800919:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80091d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800921:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800924:	48 98                	cltq
+  800926:	48 83 ec 08          	sub    $0x8,%rsp
+  80092a:	6a 00                	push   $0x0
+  80092c:	49 89 f1             	mov    %rsi,%r9
+  80092f:	49 89 c8             	mov    %rcx,%r8
+  800932:	48 89 d1             	mov    %rdx,%rcx
+  800935:	48 89 c2             	mov    %rax,%rdx
+  800938:	be 01 00 00 00       	mov    $0x1,%esi
+  80093d:	bf 19 00 00 00       	mov    $0x19,%edi
+  800942:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800949:	00 00 00 
+  80094c:	ff d0                	call   *%rax
+  80094e:	48 83 c4 10          	add    $0x10,%rsp
+  800952:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800955:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800958:	c9                   	leave
+  800959:	c3                   	ret
+
+000000000080095a <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80095a:	55                   	push   %rbp
+  80095b:	48 89 e5             	mov    %rsp,%rbp
+  80095e:	48 83 ec 20          	sub    $0x20,%rsp
+  800962:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800966:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80096a:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80096d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800970:	48 63 c8             	movslq %eax,%rcx
+  800973:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80097b:	48 83 ec 08          	sub    $0x8,%rsp
+  80097f:	6a 00                	push   $0x0
+  800981:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800987:	49 89 c8             	mov    %rcx,%r8
+  80098a:	48 89 d1             	mov    %rdx,%rcx
+  80098d:	48 89 c2             	mov    %rax,%rdx
+  800990:	be 01 00 00 00       	mov    $0x1,%esi
+  800995:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80099a:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+  8009a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009aa:	c9                   	leave
+  8009ab:	c3                   	ret
+
+00000000008009ac <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009ac:	55                   	push   %rbp
+  8009ad:	48 89 e5             	mov    %rsp,%rbp
+  8009b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8009b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009c0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d0:	6a 00                	push   $0x0
+  8009d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009d8:	49 89 c8             	mov    %rcx,%r8
+  8009db:	48 89 d1             	mov    %rdx,%rcx
+  8009de:	48 89 c2             	mov    %rax,%rdx
+  8009e1:	be 01 00 00 00       	mov    $0x1,%esi
+  8009e6:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009eb:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8009f2:	00 00 00 
+  8009f5:	ff d0                	call   *%rax
+  8009f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009fb:	c9                   	leave
+  8009fc:	c3                   	ret
+
+00000000008009fd <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009fd:	55                   	push   %rbp
+  8009fe:	48 89 e5             	mov    %rsp,%rbp
+  800a01:	48 83 ec 30          	sub    $0x30,%rsp
+  800a05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a09:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a0d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a10:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a14:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a1b:	48 63 c8             	movslq %eax,%rcx
+  800a1e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a26:	48 83 ec 08          	sub    $0x8,%rsp
+  800a2a:	6a 00                	push   $0x0
+  800a2c:	49 89 f1             	mov    %rsi,%r9
+  800a2f:	49 89 c8             	mov    %rcx,%r8
+  800a32:	48 89 d1             	mov    %rdx,%rcx
+  800a35:	48 89 c2             	mov    %rax,%rdx
+  800a38:	be 01 00 00 00       	mov    $0x1,%esi
+  800a3d:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a42:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800a49:	00 00 00 
+  800a4c:	ff d0                	call   *%rax
+  800a4e:	48 83 c4 10          	add    $0x10,%rsp
+  800a52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a58:	c9                   	leave
+  800a59:	c3                   	ret
+
+0000000000800a5a <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a5a:	55                   	push   %rbp
+  800a5b:	48 89 e5             	mov    %rsp,%rbp
+  800a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  800a62:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a68:	48 98                	cltq
+  800a6a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a6e:	6a 00                	push   $0x0
+  800a70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a81:	48 89 c2             	mov    %rax,%rdx
+  800a84:	be 01 00 00 00       	mov    $0x1,%esi
+  800a89:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a8e:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  800a95:	00 00 00 
+  800a98:	ff d0                	call   *%rax
+  800a9a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a9e:	c9                   	leave
+  800a9f:	c3                   	ret
+
+0000000000800aa0 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800aa0:	55                   	push   %rbp
+  800aa1:	48 89 e5             	mov    %rsp,%rbp
+  800aa4:	48 83 ec 08          	sub    $0x8,%rsp
+  800aa8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab0:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800ab7:	ff ff ff 
+  800aba:	48 01 d0             	add    %rdx,%rax
+  800abd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ac1:	c9                   	leave
+  800ac2:	c3                   	ret
+
+0000000000800ac3 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800ac3:	55                   	push   %rbp
+  800ac4:	48 89 e5             	mov    %rsp,%rbp
+  800ac7:	48 83 ec 08          	sub    $0x8,%rsp
+  800acb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800acf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ad3:	48 89 c7             	mov    %rax,%rdi
+  800ad6:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  800add:	00 00 00 
+  800ae0:	ff d0                	call   *%rax
+  800ae2:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800ae8:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800aec:	c9                   	leave
+  800aed:	c3                   	ret
+
+0000000000800aee <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800aee:	55                   	push   %rbp
+  800aef:	48 89 e5             	mov    %rsp,%rbp
+  800af2:	48 83 ec 18          	sub    $0x18,%rsp
+  800af6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800afa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b01:	e9 ae 00 00 00       	jmp    800bb4 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b09:	c1 e0 0c             	shl    $0xc,%eax
+  800b0c:	48 98                	cltq
+  800b0e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b13:	48 01 d0             	add    %rdx,%rax
+  800b16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b1e:	48 c1 e8 27          	shr    $0x27,%rax
+  800b22:	48 89 c2             	mov    %rax,%rdx
+  800b25:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b2c:	01 00 00 
+  800b2f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b33:	83 e0 01             	and    $0x1,%eax
+  800b36:	48 85 c0             	test   %rax,%rax
+  800b39:	74 63                	je     800b9e <fd_alloc+0xb0>
+  800b3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b3f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b43:	48 89 c2             	mov    %rax,%rdx
+  800b46:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b4d:	01 00 00 
+  800b50:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b54:	83 e0 01             	and    $0x1,%eax
+  800b57:	48 85 c0             	test   %rax,%rax
+  800b5a:	74 42                	je     800b9e <fd_alloc+0xb0>
+  800b5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b60:	48 c1 e8 15          	shr    $0x15,%rax
+  800b64:	48 89 c2             	mov    %rax,%rdx
+  800b67:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b6e:	01 00 00 
+  800b71:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b75:	83 e0 01             	and    $0x1,%eax
+  800b78:	48 85 c0             	test   %rax,%rax
+  800b7b:	74 21                	je     800b9e <fd_alloc+0xb0>
+  800b7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b81:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b85:	48 89 c2             	mov    %rax,%rdx
+  800b88:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b8f:	01 00 00 
+  800b92:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b96:	83 e0 01             	and    $0x1,%eax
+  800b99:	48 85 c0             	test   %rax,%rax
+  800b9c:	75 12                	jne    800bb0 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ba6:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bae:	eb 1e                	jmp    800bce <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800bb0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800bb4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800bb8:	0f 8e 48 ff ff ff    	jle    800b06 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bc9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bce:	c9                   	leave
+  800bcf:	c3                   	ret
+
+0000000000800bd0 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	48 83 ec 20          	sub    $0x20,%rsp
+  800bd8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bdb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bdf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800be3:	78 06                	js     800beb <fd_lookup+0x1b>
+  800be5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800be9:	7e 0a                	jle    800bf5 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800beb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf0:	e9 af 00 00 00       	jmp    800ca4 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bf8:	c1 e0 0c             	shl    $0xc,%eax
+  800bfb:	48 98                	cltq
+  800bfd:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c02:	48 01 d0             	add    %rdx,%rax
+  800c05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c0d:	48 c1 e8 27          	shr    $0x27,%rax
+  800c11:	48 89 c2             	mov    %rax,%rdx
+  800c14:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c1b:	01 00 00 
+  800c1e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c22:	83 e0 01             	and    $0x1,%eax
+  800c25:	48 85 c0             	test   %rax,%rax
+  800c28:	74 63                	je     800c8d <fd_lookup+0xbd>
+  800c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c2e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c32:	48 89 c2             	mov    %rax,%rdx
+  800c35:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c3c:	01 00 00 
+  800c3f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c43:	83 e0 01             	and    $0x1,%eax
+  800c46:	48 85 c0             	test   %rax,%rax
+  800c49:	74 42                	je     800c8d <fd_lookup+0xbd>
+  800c4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c4f:	48 c1 e8 15          	shr    $0x15,%rax
+  800c53:	48 89 c2             	mov    %rax,%rdx
+  800c56:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c5d:	01 00 00 
+  800c60:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c64:	83 e0 01             	and    $0x1,%eax
+  800c67:	48 85 c0             	test   %rax,%rax
+  800c6a:	74 21                	je     800c8d <fd_lookup+0xbd>
+  800c6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c70:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c74:	48 89 c2             	mov    %rax,%rdx
+  800c77:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c7e:	01 00 00 
+  800c81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c85:	83 e0 01             	and    $0x1,%eax
+  800c88:	48 85 c0             	test   %rax,%rax
+  800c8b:	75 07                	jne    800c94 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c92:	eb 10                	jmp    800ca4 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c98:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c9c:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca4:	c9                   	leave
+  800ca5:	c3                   	ret
+
+0000000000800ca6 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800ca6:	55                   	push   %rbp
+  800ca7:	48 89 e5             	mov    %rsp,%rbp
+  800caa:	48 83 ec 30          	sub    $0x30,%rsp
+  800cae:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800cb2:	89 f0                	mov    %esi,%eax
+  800cb4:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800cb7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cbb:	48 89 c7             	mov    %rax,%rdi
+  800cbe:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  800cc5:	00 00 00 
+  800cc8:	ff d0                	call   *%rax
+  800cca:	89 c2                	mov    %eax,%edx
+  800ccc:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cd0:	48 89 c6             	mov    %rax,%rsi
+  800cd3:	89 d7                	mov    %edx,%edi
+  800cd5:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800cdc:	00 00 00 
+  800cdf:	ff d0                	call   *%rax
+  800ce1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ce4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ce8:	78 0a                	js     800cf4 <fd_close+0x4e>
+  800cea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cee:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cf2:	74 12                	je     800d06 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cf4:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cf8:	74 05                	je     800cff <fd_close+0x59>
+  800cfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800cfd:	eb 70                	jmp    800d6f <fd_close+0xc9>
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d04:	eb 69                	jmp    800d6f <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0a:	8b 00                	mov    (%rax),%eax
+  800d0c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d10:	48 89 d6             	mov    %rdx,%rsi
+  800d13:	89 c7                	mov    %eax,%edi
+  800d15:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  800d1c:	00 00 00 
+  800d1f:	ff d0                	call   *%rax
+  800d21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d28:	78 2a                	js     800d54 <fd_close+0xae>
+    if (dev->dev_close)
+  800d2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d32:	48 85 c0             	test   %rax,%rax
+  800d35:	74 16                	je     800d4d <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d3b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d43:	48 89 c7             	mov    %rax,%rdi
+  800d46:	ff d2                	call   *%rdx
+  800d48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d4b:	eb 07                	jmp    800d54 <fd_close+0xae>
+    else
+      r = 0;
+  800d4d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d58:	48 89 c6             	mov    %rax,%rsi
+  800d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d60:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  800d67:	00 00 00 
+  800d6a:	ff d0                	call   *%rax
+  return r;
+  800d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d6f:	c9                   	leave
+  800d70:	c3                   	ret
+
+0000000000800d71 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d71:	55                   	push   %rbp
+  800d72:	48 89 e5             	mov    %rsp,%rbp
+  800d75:	48 83 ec 20          	sub    $0x20,%rsp
+  800d79:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d7c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d87:	eb 3f                	jmp    800dc8 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d89:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d90:	00 00 00 
+  800d93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d96:	48 98                	cltq
+  800d98:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d9c:	8b 00                	mov    (%rax),%eax
+  800d9e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800da1:	75 21                	jne    800dc4 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800da3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800daa:	00 00 00 
+  800dad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800db0:	48 98                	cltq
+  800db2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800db6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dba:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc2:	eb 7f                	jmp    800e43 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800dc4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dc8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dcf:	00 00 00 
+  800dd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dd5:	48 98                	cltq
+  800dd7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ddb:	48 85 c0             	test   %rax,%rax
+  800dde:	75 a9                	jne    800d89 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800de0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800de7:	00 00 00 
+  800dea:	8b 40 04             	mov    0x4(%rax),%eax
+  800ded:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800df2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800df9:	00 00 00 
+  800dfc:	48 98                	cltq
+  800dfe:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e05:	48 01 d0             	add    %rdx,%rax
+  800e08:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e0e:	8b 00                	mov    (%rax),%eax
+  800e10:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e13:	89 c6                	mov    %eax,%esi
+  800e15:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  800e1c:	00 00 00 
+  800e1f:	48 89 c7             	mov    %rax,%rdi
+  800e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e27:	48 b9 68 31 80 00 00 	movabs $0x803168,%rcx
+  800e2e:	00 00 00 
+  800e31:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e37:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e43:	c9                   	leave
+  800e44:	c3                   	ret
+
+0000000000800e45 <close>:
+
+int
+close(int fdnum) {
+  800e45:	55                   	push   %rbp
+  800e46:	48 89 e5             	mov    %rsp,%rbp
+  800e49:	48 83 ec 20          	sub    $0x20,%rsp
+  800e4d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e50:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e57:	48 89 d6             	mov    %rdx,%rsi
+  800e5a:	89 c7                	mov    %eax,%edi
+  800e5c:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+  800e68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e6f:	79 05                	jns    800e76 <close+0x31>
+    return r;
+  800e71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e74:	eb 18                	jmp    800e8e <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e7a:	be 01 00 00 00       	mov    $0x1,%esi
+  800e7f:	48 89 c7             	mov    %rax,%rdi
+  800e82:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+}
+  800e8e:	c9                   	leave
+  800e8f:	c3                   	ret
+
+0000000000800e90 <close_all>:
+
+void
+close_all(void) {
+  800e90:	55                   	push   %rbp
+  800e91:	48 89 e5             	mov    %rsp,%rbp
+  800e94:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e98:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e9f:	eb 15                	jmp    800eb6 <close_all+0x26>
+    close(i);
+  800ea1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ea4:	89 c7                	mov    %eax,%edi
+  800ea6:	48 b8 45 0e 80 00 00 	movabs $0x800e45,%rax
+  800ead:	00 00 00 
+  800eb0:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800eb2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800eb6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800eba:	7e e5                	jle    800ea1 <close_all+0x11>
+}
+  800ebc:	90                   	nop
+  800ebd:	90                   	nop
+  800ebe:	c9                   	leave
+  800ebf:	c3                   	ret
+
+0000000000800ec0 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ec0:	55                   	push   %rbp
+  800ec1:	48 89 e5             	mov    %rsp,%rbp
+  800ec4:	48 83 ec 40          	sub    $0x40,%rsp
+  800ec8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ecb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ece:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800ed2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ed5:	48 89 d6             	mov    %rdx,%rsi
+  800ed8:	89 c7                	mov    %eax,%edi
+  800eda:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+  800ee6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ee9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800eed:	79 08                	jns    800ef7 <dup+0x37>
+    return r;
+  800eef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ef2:	e9 33 02 00 00       	jmp    80112a <dup+0x26a>
+  close(newfdnum);
+  800ef7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efa:	89 c7                	mov    %eax,%edi
+  800efc:	48 b8 45 0e 80 00 00 	movabs $0x800e45,%rax
+  800f03:	00 00 00 
+  800f06:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f08:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f0b:	c1 e0 0c             	shl    $0xc,%eax
+  800f0e:	48 98                	cltq
+  800f10:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f15:	48 01 d0             	add    %rdx,%rax
+  800f18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f20:	48 89 c7             	mov    %rax,%rdi
+  800f23:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  800f2a:	00 00 00 
+  800f2d:	ff d0                	call   *%rax
+  800f2f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f37:	48 89 c7             	mov    %rax,%rdi
+  800f3a:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+  800f46:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f4a:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f51:	00 
+  800f52:	e9 19 01 00 00       	jmp    801070 <dup+0x1b0>
+    off -= PGSIZE;
+  800f57:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f5e:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f5f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f67:	48 01 d0             	add    %rdx,%rax
+  800f6a:	48 c1 e8 27          	shr    $0x27,%rax
+  800f6e:	48 89 c2             	mov    %rax,%rdx
+  800f71:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f78:	01 00 00 
+  800f7b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f7f:	83 e0 01             	and    $0x1,%eax
+  800f82:	48 85 c0             	test   %rax,%rax
+  800f85:	0f 84 e5 00 00 00    	je     801070 <dup+0x1b0>
+  800f8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f93:	48 01 d0             	add    %rdx,%rax
+  800f96:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f9a:	48 89 c2             	mov    %rax,%rdx
+  800f9d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800fa4:	01 00 00 
+  800fa7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fab:	83 e0 01             	and    $0x1,%eax
+  800fae:	48 85 c0             	test   %rax,%rax
+  800fb1:	0f 84 b9 00 00 00    	je     801070 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fb7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fbf:	48 01 d0             	add    %rdx,%rax
+  800fc2:	48 c1 e8 15          	shr    $0x15,%rax
+  800fc6:	48 89 c2             	mov    %rax,%rdx
+  800fc9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fd0:	01 00 00 
+  800fd3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fd7:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fda:	48 85 c0             	test   %rax,%rax
+  800fdd:	0f 84 8d 00 00 00    	je     801070 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fe3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fe7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800feb:	48 01 d0             	add    %rdx,%rax
+  800fee:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ff2:	48 89 c2             	mov    %rax,%rdx
+  800ff5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800ffc:	01 00 00 
+  800fff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801003:	83 e0 01             	and    $0x1,%eax
+  801006:	48 85 c0             	test   %rax,%rax
+  801009:	74 65                	je     801070 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80100b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80100f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801013:	48 01 d0             	add    %rdx,%rax
+  801016:	48 c1 e8 0c          	shr    $0xc,%rax
+  80101a:	48 89 c2             	mov    %rax,%rdx
+  80101d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801024:	01 00 00 
+  801027:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801030:	89 c6                	mov    %eax,%esi
+  801032:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801036:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103a:	48 01 c2             	add    %rax,%rdx
+  80103d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801041:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801045:	48 01 c8             	add    %rcx,%rax
+  801048:	41 89 f0             	mov    %esi,%r8d
+  80104b:	48 89 d1             	mov    %rdx,%rcx
+  80104e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801053:	48 89 c6             	mov    %rax,%rsi
+  801056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105b:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+  801067:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80106a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80106e:	78 60                	js     8010d0 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801070:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801075:	0f 85 dc fe ff ff    	jne    800f57 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80107b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80107f:	48 c1 e8 0c          	shr    $0xc,%rax
+  801083:	48 89 c2             	mov    %rax,%rdx
+  801086:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80108d:	01 00 00 
+  801090:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801094:	25 07 0e 00 00       	and    $0xe07,%eax
+  801099:	89 c1                	mov    %eax,%ecx
+  80109b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80109f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010a3:	41 89 c8             	mov    %ecx,%r8d
+  8010a6:	48 89 d1             	mov    %rdx,%rcx
+  8010a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ae:	48 89 c6             	mov    %rax,%rsi
+  8010b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b6:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  8010bd:	00 00 00 
+  8010c0:	ff d0                	call   *%rax
+  8010c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010c9:	78 08                	js     8010d3 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010cb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010ce:	eb 5a                	jmp    80112a <dup+0x26a>
+        goto err;
+  8010d0:	90                   	nop
+  8010d1:	eb 01                	jmp    8010d4 <dup+0x214>
+    goto err;
+  8010d3:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010d8:	48 89 c6             	mov    %rax,%rsi
+  8010db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e0:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  8010e7:	00 00 00 
+  8010ea:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010ec:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010f3:	00 
+  8010f4:	eb 27                	jmp    80111d <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010fe:	48 01 d0             	add    %rdx,%rax
+  801101:	48 89 c6             	mov    %rax,%rsi
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+  801109:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  801110:	00 00 00 
+  801113:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801115:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80111c:	00 
+  80111d:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801124:	00 
+  801125:	76 cf                	jbe    8010f6 <dup+0x236>
+  return r;
+  801127:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+000000000080112c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80112c:	55                   	push   %rbp
+  80112d:	48 89 e5             	mov    %rsp,%rbp
+  801130:	48 83 ec 40          	sub    $0x40,%rsp
+  801134:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801137:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80113b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80113f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801143:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801146:	48 89 d6             	mov    %rdx,%rsi
+  801149:	89 c7                	mov    %eax,%edi
+  80114b:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  801152:	00 00 00 
+  801155:	ff d0                	call   *%rax
+  801157:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80115a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80115e:	78 24                	js     801184 <read+0x58>
+  801160:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801164:	8b 00                	mov    (%rax),%eax
+  801166:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80116a:	48 89 d6             	mov    %rdx,%rsi
+  80116d:	89 c7                	mov    %eax,%edi
+  80116f:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  801176:	00 00 00 
+  801179:	ff d0                	call   *%rax
+  80117b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80117e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801182:	79 0a                	jns    80118e <read+0x62>
+    return r;
+  801184:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801187:	48 98                	cltq
+  801189:	e9 9e 00 00 00       	jmp    80122c <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80118e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801192:	8b 40 08             	mov    0x8(%rax),%eax
+  801195:	83 e0 03             	and    $0x3,%eax
+  801198:	83 f8 01             	cmp    $0x1,%eax
+  80119b:	75 5c                	jne    8011f9 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80119d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011a4:	00 00 00 
+  8011a7:	8b 40 04             	mov    0x4(%rax),%eax
+  8011aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011af:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011b6:	00 00 00 
+  8011b9:	48 98                	cltq
+  8011bb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011c2:	48 01 d0             	add    %rdx,%rax
+  8011c5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011cb:	8b 00                	mov    (%rax),%eax
+  8011cd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011d0:	89 c6                	mov    %eax,%esi
+  8011d2:	48 b8 3f 50 80 00 00 	movabs $0x80503f,%rax
+  8011d9:	00 00 00 
+  8011dc:	48 89 c7             	mov    %rax,%rdi
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	48 b9 68 31 80 00 00 	movabs $0x803168,%rcx
+  8011eb:	00 00 00 
+  8011ee:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011f0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011f7:	eb 33                	jmp    80122c <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011fd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801201:	48 85 c0             	test   %rax,%rax
+  801204:	75 09                	jne    80120f <read+0xe3>
+    return -E_NOT_SUPP;
+  801206:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80120d:	eb 1d                	jmp    80122c <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80120f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801213:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80121f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801223:	48 89 ce             	mov    %rcx,%rsi
+  801226:	48 89 c7             	mov    %rax,%rdi
+  801229:	41 ff d0             	call   *%r8
+}
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+000000000080122e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80122e:	55                   	push   %rbp
+  80122f:	48 89 e5             	mov    %rsp,%rbp
+  801232:	48 83 ec 30          	sub    $0x30,%rsp
+  801236:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801239:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80123d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801241:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801248:	eb 49                	jmp    801293 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80124a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80124d:	48 98                	cltq
+  80124f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801253:	48 29 c2             	sub    %rax,%rdx
+  801256:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801259:	48 63 c8             	movslq %eax,%rcx
+  80125c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801260:	48 01 c1             	add    %rax,%rcx
+  801263:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801266:	48 89 ce             	mov    %rcx,%rsi
+  801269:	89 c7                	mov    %eax,%edi
+  80126b:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  801272:	00 00 00 
+  801275:	ff d0                	call   *%rax
+  801277:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80127a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80127e:	79 07                	jns    801287 <readn+0x59>
+      return m;
+  801280:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801283:	48 98                	cltq
+  801285:	eb 1f                	jmp    8012a6 <readn+0x78>
+    if (m == 0)
+  801287:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80128b:	74 13                	je     8012a0 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80128d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801290:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801293:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801296:	48 98                	cltq
+  801298:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80129c:	72 ac                	jb     80124a <readn+0x1c>
+  80129e:	eb 01                	jmp    8012a1 <readn+0x73>
+      break;
+  8012a0:	90                   	nop
+  }
+  return tot;
+  8012a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012a4:	48 98                	cltq
+}
+  8012a6:	c9                   	leave
+  8012a7:	c3                   	ret
+
+00000000008012a8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012a8:	55                   	push   %rbp
+  8012a9:	48 89 e5             	mov    %rsp,%rbp
+  8012ac:	48 83 ec 40          	sub    $0x40,%rsp
+  8012b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012bb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012bf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012c2:	48 89 d6             	mov    %rdx,%rsi
+  8012c5:	89 c7                	mov    %eax,%edi
+  8012c7:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  8012ce:	00 00 00 
+  8012d1:	ff d0                	call   *%rax
+  8012d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012da:	78 24                	js     801300 <write+0x58>
+  8012dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e0:	8b 00                	mov    (%rax),%eax
+  8012e2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012e6:	48 89 d6             	mov    %rdx,%rsi
+  8012e9:	89 c7                	mov    %eax,%edi
+  8012eb:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  8012f2:	00 00 00 
+  8012f5:	ff d0                	call   *%rax
+  8012f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012fe:	79 0a                	jns    80130a <write+0x62>
+    return r;
+  801300:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801303:	48 98                	cltq
+  801305:	e9 9d 00 00 00       	jmp    8013a7 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80130a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130e:	8b 40 08             	mov    0x8(%rax),%eax
+  801311:	83 e0 03             	and    $0x3,%eax
+  801314:	85 c0                	test   %eax,%eax
+  801316:	75 5c                	jne    801374 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801318:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80131f:	00 00 00 
+  801322:	8b 40 04             	mov    0x4(%rax),%eax
+  801325:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80132a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801331:	00 00 00 
+  801334:	48 98                	cltq
+  801336:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80133d:	48 01 d0             	add    %rdx,%rax
+  801340:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801346:	8b 00                	mov    (%rax),%eax
+  801348:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80134b:	89 c6                	mov    %eax,%esi
+  80134d:	48 b8 5b 50 80 00 00 	movabs $0x80505b,%rax
+  801354:	00 00 00 
+  801357:	48 89 c7             	mov    %rax,%rdi
+  80135a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135f:	48 b9 68 31 80 00 00 	movabs $0x803168,%rcx
+  801366:	00 00 00 
+  801369:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80136b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801372:	eb 33                	jmp    8013a7 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801374:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801378:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80137c:	48 85 c0             	test   %rax,%rax
+  80137f:	75 09                	jne    80138a <write+0xe2>
+    return -E_NOT_SUPP;
+  801381:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801388:	eb 1d                	jmp    8013a7 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80138a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80138e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801392:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801396:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80139a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80139e:	48 89 ce             	mov    %rcx,%rsi
+  8013a1:	48 89 c7             	mov    %rax,%rdi
+  8013a4:	41 ff d0             	call   *%r8
+}
+  8013a7:	c9                   	leave
+  8013a8:	c3                   	ret
+
+00000000008013a9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013a9:	55                   	push   %rbp
+  8013aa:	48 89 e5             	mov    %rsp,%rbp
+  8013ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8013b1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013b4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013b7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013be:	48 89 d6             	mov    %rdx,%rsi
+  8013c1:	89 c7                	mov    %eax,%edi
+  8013c3:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  8013ca:	00 00 00 
+  8013cd:	ff d0                	call   *%rax
+  8013cf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013d2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013d6:	79 05                	jns    8013dd <seek+0x34>
+    return r;
+  8013d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013db:	eb 0f                	jmp    8013ec <seek+0x43>
+  fd->fd_offset = offset;
+  8013dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013e4:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+
+00000000008013ee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+  8013f2:	48 83 ec 30          	sub    $0x30,%rsp
+  8013f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013f9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013fc:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801400:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801403:	48 89 d6             	mov    %rdx,%rsi
+  801406:	89 c7                	mov    %eax,%edi
+  801408:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  80140f:	00 00 00 
+  801412:	ff d0                	call   *%rax
+  801414:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801417:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80141b:	78 24                	js     801441 <ftruncate+0x53>
+  80141d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801421:	8b 00                	mov    (%rax),%eax
+  801423:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801427:	48 89 d6             	mov    %rdx,%rsi
+  80142a:	89 c7                	mov    %eax,%edi
+  80142c:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  801433:	00 00 00 
+  801436:	ff d0                	call   *%rax
+  801438:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80143b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80143f:	79 08                	jns    801449 <ftruncate+0x5b>
+    return r;
+  801441:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801444:	e9 92 00 00 00       	jmp    8014db <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801449:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80144d:	8b 40 08             	mov    0x8(%rax),%eax
+  801450:	83 e0 03             	and    $0x3,%eax
+  801453:	85 c0                	test   %eax,%eax
+  801455:	75 5a                	jne    8014b1 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  801457:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80145e:	00 00 00 
+  801461:	8b 40 04             	mov    0x4(%rax),%eax
+  801464:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801469:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801470:	00 00 00 
+  801473:	48 98                	cltq
+  801475:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80147c:	48 01 d0             	add    %rdx,%rax
+  80147f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801485:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801487:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80148a:	89 c6                	mov    %eax,%esi
+  80148c:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  801493:	00 00 00 
+  801496:	48 89 c7             	mov    %rax,%rdi
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	48 b9 68 31 80 00 00 	movabs $0x803168,%rcx
+  8014a5:	00 00 00 
+  8014a8:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014af:	eb 2a                	jmp    8014db <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014b9:	48 85 c0             	test   %rax,%rax
+  8014bc:	75 07                	jne    8014c5 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014be:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014c3:	eb 16                	jmp    8014db <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c9:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014d4:	89 d6                	mov    %edx,%esi
+  8014d6:	48 89 c7             	mov    %rax,%rdi
+  8014d9:	ff d1                	call   *%rcx
+}
+  8014db:	c9                   	leave
+  8014dc:	c3                   	ret
+
+00000000008014dd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014dd:	55                   	push   %rbp
+  8014de:	48 89 e5             	mov    %rsp,%rbp
+  8014e1:	48 83 ec 30          	sub    $0x30,%rsp
+  8014e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ec:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014f3:	48 89 d6             	mov    %rdx,%rsi
+  8014f6:	89 c7                	mov    %eax,%edi
+  8014f8:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  8014ff:	00 00 00 
+  801502:	ff d0                	call   *%rax
+  801504:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801507:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80150b:	78 24                	js     801531 <fstat+0x54>
+  80150d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801511:	8b 00                	mov    (%rax),%eax
+  801513:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801517:	48 89 d6             	mov    %rdx,%rsi
+  80151a:	89 c7                	mov    %eax,%edi
+  80151c:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  801523:	00 00 00 
+  801526:	ff d0                	call   *%rax
+  801528:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80152b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80152f:	79 05                	jns    801536 <fstat+0x59>
+    return r;
+  801531:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801534:	eb 5e                	jmp    801594 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801536:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80153e:	48 85 c0             	test   %rax,%rax
+  801541:	75 07                	jne    80154a <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801543:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801548:	eb 4a                	jmp    801594 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80154a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80154e:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801551:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801555:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80155c:	00 00 00 
+  stat->st_isdir   = 0;
+  80155f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801563:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80156a:	00 00 00 
+  stat->st_dev     = dev;
+  80156d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801571:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801575:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80157c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801580:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801584:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801588:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80158c:	48 89 d6             	mov    %rdx,%rsi
+  80158f:	48 89 c7             	mov    %rax,%rdi
+  801592:	ff d1                	call   *%rcx
+}
+  801594:	c9                   	leave
+  801595:	c3                   	ret
+
+0000000000801596 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801596:	55                   	push   %rbp
+  801597:	48 89 e5             	mov    %rsp,%rbp
+  80159a:	48 83 ec 10          	sub    $0x10,%rsp
+  80159e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015aa:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015b0:	83 f8 20             	cmp    $0x20,%eax
+  8015b3:	75 07                	jne    8015bc <pollwait_key+0x26>
+    return -E_INVAL;
+  8015b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ba:	eb 5f                	jmp    80161b <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c0:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ca:	48 63 d2             	movslq %edx,%rdx
+  8015cd:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015d1:	48 01 c2             	add    %rax,%rdx
+  8015d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d8:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015df:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e9:	8b 00                	mov    (%rax),%eax
+  8015eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015ef:	48 63 c9             	movslq %ecx,%rcx
+  8015f2:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015f6:	48 01 ca             	add    %rcx,%rdx
+  8015f9:	48 83 c2 08          	add    $0x8,%rdx
+  8015fd:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801603:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801609:	8d 50 01             	lea    0x1(%rax),%edx
+  80160c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801610:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801616:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+
+000000000080161d <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801628:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80162f:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801635:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80163c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801643:	00 
+  int i, r, ready, ipc = 0;
+  801644:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80164b:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801652:	00 
+  801653:	74 45                	je     80169a <poll+0x7d>
+  801655:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80165c:	ff 
+  80165d:	74 3b                	je     80169a <poll+0x7d>
+    now      = vsys_clock_ns();
+  80165f:	48 b8 58 2b 80 00 00 	movabs $0x802b58,%rax
+  801666:	00 00 00 
+  801669:	ff d0                	call   *%rax
+  80166b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80166f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801673:	48 f7 d0             	not    %rax
+  801676:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80167d:	73 10                	jae    80168f <poll+0x72>
+  80167f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801683:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80168a:	48 01 d0             	add    %rdx,%rax
+  80168d:	eb 07                	jmp    801696 <poll+0x79>
+  80168f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801696:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80169a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016a1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016a8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016b6:	e9 46 02 00 00       	jmp    801901 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016be:	48 63 d0             	movslq %eax,%rdx
+  8016c1:	48 89 d0             	mov    %rdx,%rax
+  8016c4:	48 01 c0             	add    %rax,%rax
+  8016c7:	48 01 d0             	add    %rdx,%rax
+  8016ca:	48 c1 e0 02          	shl    $0x2,%rax
+  8016ce:	48 89 c2             	mov    %rax,%rdx
+  8016d1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016d8:	48 01 d0             	add    %rdx,%rax
+  8016db:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e5:	48 63 d0             	movslq %eax,%rdx
+  8016e8:	48 89 d0             	mov    %rdx,%rax
+  8016eb:	48 01 c0             	add    %rax,%rax
+  8016ee:	48 01 d0             	add    %rdx,%rax
+  8016f1:	48 c1 e0 02          	shl    $0x2,%rax
+  8016f5:	48 89 c2             	mov    %rax,%rdx
+  8016f8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016ff:	48 01 d0             	add    %rdx,%rax
+  801702:	8b 00                	mov    (%rax),%eax
+  801704:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801707:	75 62                	jne    80176b <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  801709:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80170c:	48 63 d0             	movslq %eax,%rdx
+  80170f:	48 89 d0             	mov    %rdx,%rax
+  801712:	48 01 c0             	add    %rax,%rax
+  801715:	48 01 d0             	add    %rdx,%rax
+  801718:	48 c1 e0 02          	shl    $0x2,%rax
+  80171c:	48 89 c2             	mov    %rax,%rdx
+  80171f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801726:	48 01 d0             	add    %rdx,%rax
+  801729:	8b 40 04             	mov    0x4(%rax),%eax
+  80172c:	83 e0 01             	and    $0x1,%eax
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	0f 84 9b 01 00 00    	je     8018d2 <poll+0x2b5>
+          fds[i].revents = ipc;
+  801737:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173a:	48 63 d0             	movslq %eax,%rdx
+  80173d:	48 89 d0             	mov    %rdx,%rax
+  801740:	48 01 c0             	add    %rax,%rax
+  801743:	48 01 d0             	add    %rdx,%rax
+  801746:	48 c1 e0 02          	shl    $0x2,%rax
+  80174a:	48 89 c2             	mov    %rax,%rdx
+  80174d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801754:	48 01 c2             	add    %rax,%rdx
+  801757:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80175a:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80175d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801760:	83 c8 04             	or     $0x4,%eax
+  801763:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  801766:	e9 67 01 00 00       	jmp    8018d2 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80176b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80176e:	48 63 d0             	movslq %eax,%rdx
+  801771:	48 89 d0             	mov    %rdx,%rax
+  801774:	48 01 c0             	add    %rax,%rax
+  801777:	48 01 d0             	add    %rdx,%rax
+  80177a:	48 c1 e0 02          	shl    $0x2,%rax
+  80177e:	48 89 c2             	mov    %rax,%rdx
+  801781:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801788:	48 01 d0             	add    %rdx,%rax
+  80178b:	8b 00                	mov    (%rax),%eax
+  80178d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801794:	48 89 d6             	mov    %rdx,%rsi
+  801797:	89 c7                	mov    %eax,%edi
+  801799:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  8017a0:	00 00 00 
+  8017a3:	ff d0                	call   *%rax
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 25                	js     8017ce <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017a9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017b0:	8b 00                	mov    (%rax),%eax
+  8017b2:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017b9:	48 89 d6             	mov    %rdx,%rsi
+  8017bc:	89 c7                	mov    %eax,%edi
+  8017be:	48 b8 71 0d 80 00 00 	movabs $0x800d71,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	79 2c                	jns    8017fa <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017d1:	48 63 d0             	movslq %eax,%rdx
+  8017d4:	48 89 d0             	mov    %rdx,%rax
+  8017d7:	48 01 c0             	add    %rax,%rax
+  8017da:	48 01 d0             	add    %rdx,%rax
+  8017dd:	48 c1 e0 02          	shl    $0x2,%rax
+  8017e1:	48 89 c2             	mov    %rax,%rdx
+  8017e4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017eb:	48 01 d0             	add    %rdx,%rax
+  8017ee:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017f5:	e9 d8 00 00 00       	jmp    8018d2 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017fa:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801801:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801805:	48 85 c0             	test   %rax,%rax
+  801808:	74 7d                	je     801887 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80180a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801811:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801815:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801818:	48 63 d0             	movslq %eax,%rdx
+  80181b:	48 89 d0             	mov    %rdx,%rax
+  80181e:	48 01 c0             	add    %rax,%rax
+  801821:	48 01 d0             	add    %rdx,%rax
+  801824:	48 c1 e0 02          	shl    $0x2,%rax
+  801828:	48 89 c2             	mov    %rax,%rdx
+  80182b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801832:	48 01 d0             	add    %rdx,%rax
+  801835:	8b 48 04             	mov    0x4(%rax),%ecx
+  801838:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80183f:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801846:	89 ce                	mov    %ecx,%esi
+  801848:	48 89 c7             	mov    %rax,%rdi
+  80184b:	41 ff d0             	call   *%r8
+  80184e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801851:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801855:	79 08                	jns    80185f <poll+0x242>
+          return r;
+  801857:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80185a:	e9 45 01 00 00       	jmp    8019a4 <poll+0x387>
+        fds[i].revents = r;
+  80185f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801862:	48 63 d0             	movslq %eax,%rdx
+  801865:	48 89 d0             	mov    %rdx,%rax
+  801868:	48 01 c0             	add    %rax,%rax
+  80186b:	48 01 d0             	add    %rdx,%rax
+  80186e:	48 c1 e0 02          	shl    $0x2,%rax
+  801872:	48 89 c2             	mov    %rax,%rdx
+  801875:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80187c:	48 01 c2             	add    %rax,%rdx
+  80187f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801882:	89 42 08             	mov    %eax,0x8(%rdx)
+  801885:	eb 4b                	jmp    8018d2 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  801887:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80188a:	48 63 d0             	movslq %eax,%rdx
+  80188d:	48 89 d0             	mov    %rdx,%rax
+  801890:	48 01 c0             	add    %rax,%rax
+  801893:	48 01 d0             	add    %rdx,%rax
+  801896:	48 c1 e0 02          	shl    $0x2,%rax
+  80189a:	48 89 c2             	mov    %rax,%rdx
+  80189d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018a4:	48 01 d0             	add    %rdx,%rax
+  8018a7:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ad:	48 63 d0             	movslq %eax,%rdx
+  8018b0:	48 89 d0             	mov    %rdx,%rax
+  8018b3:	48 01 c0             	add    %rax,%rax
+  8018b6:	48 01 d0             	add    %rdx,%rax
+  8018b9:	48 c1 e0 02          	shl    $0x2,%rax
+  8018bd:	48 89 c2             	mov    %rax,%rdx
+  8018c0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018c7:	48 01 d0             	add    %rdx,%rax
+  8018ca:	83 e1 03             	and    $0x3,%ecx
+  8018cd:	89 ca                	mov    %ecx,%edx
+  8018cf:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d5:	48 63 d0             	movslq %eax,%rdx
+  8018d8:	48 89 d0             	mov    %rdx,%rax
+  8018db:	48 01 c0             	add    %rax,%rax
+  8018de:	48 01 d0             	add    %rdx,%rax
+  8018e1:	48 c1 e0 02          	shl    $0x2,%rax
+  8018e5:	48 89 c2             	mov    %rax,%rdx
+  8018e8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018ef:	48 01 d0             	add    %rdx,%rax
+  8018f2:	8b 40 08             	mov    0x8(%rax),%eax
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	74 04                	je     8018fd <poll+0x2e0>
+        ready++;
+  8018f9:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018fd:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801901:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801904:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80190a:	0f 8c ab fd ff ff    	jl     8016bb <poll+0x9e>
+    }
+    if (ready)
+  801910:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801914:	74 08                	je     80191e <poll+0x301>
+      return ready;
+  801916:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801919:	e9 86 00 00 00       	jmp    8019a4 <poll+0x387>
+
+    if (deadline) {
+  80191e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801923:	74 30                	je     801955 <poll+0x338>
+      now     = vsys_clock_ns();
+  801925:	48 b8 58 2b 80 00 00 	movabs $0x802b58,%rax
+  80192c:	00 00 00 
+  80192f:	ff d0                	call   *%rax
+  801931:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801935:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801939:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80193d:	73 0a                	jae    801949 <poll+0x32c>
+  80193f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801943:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801947:	eb 05                	jmp    80194e <poll+0x331>
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194e:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801955:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801958:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80195b:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801962:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  801969:	48 89 c7             	mov    %rax,%rdi
+  80196c:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  801973:	00 00 00 
+  801976:	ff d0                	call   *%rax
+  801978:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80197b:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80197f:	75 07                	jne    801988 <poll+0x36b>
+      return 0;
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+  801986:	eb 1c                	jmp    8019a4 <poll+0x387>
+    if (r < 0)
+  801988:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80198c:	79 05                	jns    801993 <poll+0x376>
+      return r;
+  80198e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801991:	eb 11                	jmp    8019a4 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801993:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801996:	c1 f8 02             	sar    $0x2,%eax
+  801999:	83 e0 01             	and    $0x1,%eax
+  80199c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80199f:	e9 f6 fc ff ff       	jmp    80169a <poll+0x7d>
+  }
+}
+  8019a4:	c9                   	leave
+  8019a5:	c3                   	ret
+
+00000000008019a6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+  8019aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8019ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8019bf:	48 89 c7             	mov    %rax,%rdi
+  8019c2:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  8019c9:	00 00 00 
+  8019cc:	ff d0                	call   *%rax
+  8019ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019d5:	79 05                	jns    8019dc <stat+0x36>
+    return fd;
+  8019d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019da:	eb 2f                	jmp    801a0b <stat+0x65>
+  r = fstat(fd, stat);
+  8019dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019e3:	48 89 d6             	mov    %rdx,%rsi
+  8019e6:	89 c7                	mov    %eax,%edi
+  8019e8:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019fa:	89 c7                	mov    %eax,%edi
+  8019fc:	48 b8 45 0e 80 00 00 	movabs $0x800e45,%rax
+  801a03:	00 00 00 
+  801a06:	ff d0                	call   *%rax
+  return r;
+  801a08:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a0b:	c9                   	leave
+  801a0c:	c3                   	ret
+
+0000000000801a0d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a0d:	55                   	push   %rbp
+  801a0e:	48 89 e5             	mov    %rsp,%rbp
+  801a11:	48 83 ec 10          	sub    $0x10,%rsp
+  801a15:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a18:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a1c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a23:	00 00 00 
+  801a26:	8b 00                	mov    (%rax),%eax
+  801a28:	85 c0                	test   %eax,%eax
+  801a2a:	75 1d                	jne    801a49 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a2c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a31:	48 b8 60 4e 80 00 00 	movabs $0x804e60,%rax
+  801a38:	00 00 00 
+  801a3b:	ff d0                	call   *%rax
+  801a3d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a44:	00 00 00 
+  801a47:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a49:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a50:	00 00 00 
+  801a53:	8b 00                	mov    (%rax),%eax
+  801a55:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a58:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a5d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a64:	00 00 00 
+  801a67:	89 c7                	mov    %eax,%edi
+  801a69:	48 b8 b3 4d 80 00 00 	movabs $0x804db3,%rax
+  801a70:	00 00 00 
+  801a73:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7e:	48 89 c6             	mov    %rax,%rsi
+  801a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a86:	48 b8 36 4c 80 00 00 	movabs $0x804c36,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+}
+  801a92:	c9                   	leave
+  801a93:	c3                   	ret
+
+0000000000801a94 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a94:	55                   	push   %rbp
+  801a95:	48 89 e5             	mov    %rsp,%rbp
+  801a98:	48 83 ec 20          	sub    $0x20,%rsp
+  801a9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aa7:	48 89 c7             	mov    %rax,%rdi
+  801aaa:	48 b8 17 40 80 00 00 	movabs $0x804017,%rax
+  801ab1:	00 00 00 
+  801ab4:	ff d0                	call   *%rax
+  801ab6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801abb:	7e 0a                	jle    801ac7 <open+0x33>
+    return -E_BAD_PATH;
+  801abd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac2:	e9 a8 00 00 00       	jmp    801b6f <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801ac7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801acb:	48 89 c7             	mov    %rax,%rdi
+  801ace:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+  801ada:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801add:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ae1:	79 08                	jns    801aeb <open+0x57>
+    return r;
+  801ae3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ae6:	e9 84 00 00 00       	jmp    801b6f <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801aeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aef:	48 89 c6             	mov    %rax,%rsi
+  801af2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801af9:	00 00 00 
+  801afc:	48 89 c7             	mov    %rax,%rdi
+  801aff:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b0b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b12:	00 00 00 
+  801b15:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b18:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b22:	48 89 c6             	mov    %rax,%rsi
+  801b25:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b2a:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b39:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b3d:	79 1d                	jns    801b5c <open+0xc8>
+    fd_close(fd, 0);
+  801b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b43:	be 00 00 00 00       	mov    $0x0,%esi
+  801b48:	48 89 c7             	mov    %rax,%rdi
+  801b4b:	48 b8 a6 0c 80 00 00 	movabs $0x800ca6,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+    return r;
+  801b57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b5a:	eb 13                	jmp    801b6f <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b60:	48 89 c7             	mov    %rax,%rdi
+  801b63:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+}
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+0000000000801b71 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	48 83 ec 10          	sub    $0x10,%rsp
+  801b79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b81:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b84:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b8b:	00 00 00 
+  801b8e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b90:	be 00 00 00 00       	mov    $0x0,%esi
+  801b95:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b9a:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+}
+  801ba6:	c9                   	leave
+  801ba7:	c3                   	ret
+
+0000000000801ba8 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801ba8:	55                   	push   %rbp
+  801ba9:	48 89 e5             	mov    %rsp,%rbp
+  801bac:	48 83 ec 30          	sub    $0x30,%rsp
+  801bb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bb4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bb8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801bbc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bc1:	74 07                	je     801bca <devfile_read+0x22>
+  801bc3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bc8:	75 0a                	jne    801bd4 <devfile_read+0x2c>
+  return E_INVAL;
+  801bca:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bcf:	e9 b4 00 00 00       	jmp    801c88 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bd4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bdb:	00 
+  while (n) {
+  801bdc:	e9 98 00 00 00       	jmp    801c79 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801be5:	8b 40 0c             	mov    0xc(%rax),%eax
+  801be8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bef:	00 00 00 
+  801bf2:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bf4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bfb:	00 00 00 
+  801bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c02:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c06:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c10:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+  801c1c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c1f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c23:	7f 13                	jg     801c38 <devfile_read+0x90>
+      return res ? res : res0;
+  801c25:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c29:	74 07                	je     801c32 <devfile_read+0x8a>
+  801c2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c2e:	48 98                	cltq
+  801c30:	eb 56                	jmp    801c88 <devfile_read+0xe0>
+  801c32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c36:	eb 50                	jmp    801c88 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c38:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c3b:	48 63 d0             	movslq %eax,%rdx
+  801c3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c42:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c49:	00 00 00 
+  801c4c:	48 89 ce             	mov    %rcx,%rsi
+  801c4f:	48 89 c7             	mov    %rax,%rdi
+  801c52:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+
+    buf += res;
+  801c5e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c61:	48 98                	cltq
+  801c63:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c67:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c6a:	48 98                	cltq
+  801c6c:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c70:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c73:	48 98                	cltq
+  801c75:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c79:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c7e:	0f 85 5d ff ff ff    	jne    801be1 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c88:	c9                   	leave
+  801c89:	c3                   	ret
+
+0000000000801c8a <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c8a:	55                   	push   %rbp
+  801c8b:	48 89 e5             	mov    %rsp,%rbp
+  801c8e:	48 83 ec 50          	sub    $0x50,%rsp
+  801c92:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c96:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c9a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c9e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ca3:	74 07                	je     801cac <devfile_write+0x22>
+  801ca5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801caa:	75 0a                	jne    801cb6 <devfile_write+0x2c>
+  return E_INVAL;
+  801cac:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cb1:	e9 c9 00 00 00       	jmp    801d7f <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801cb6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801cbd:	00 
+
+  while (n) {
+  801cbe:	e9 ad 00 00 00       	jmp    801d70 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cc3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801ccb:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cd2:	00 
+  801cd3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cdb:	48 39 c2             	cmp    %rax,%rdx
+  801cde:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ce2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801ce6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cee:	48 89 c6             	mov    %rax,%rsi
+  801cf1:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cf8:	00 00 00 
+  801cfb:	48 89 c7             	mov    %rax,%rdi
+  801cfe:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d0e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d11:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d18:	00 00 00 
+  801d1b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d1d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d24:	00 00 00 
+  801d27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d2b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d34:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d39:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+  801d45:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d48:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d4c:	79 07                	jns    801d55 <devfile_write+0xcb>
+      return res;
+  801d4e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d51:	48 98                	cltq
+  801d53:	eb 2a                	jmp    801d7f <devfile_write+0xf5>
+
+    buf += res;
+  801d55:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d58:	48 98                	cltq
+  801d5a:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d61:	48 98                	cltq
+  801d63:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d67:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d6a:	48 98                	cltq
+  801d6c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d70:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d75:	0f 85 48 ff ff ff    	jne    801cc3 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d7f:	c9                   	leave
+  801d80:	c3                   	ret
+
+0000000000801d81 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d81:	55                   	push   %rbp
+  801d82:	48 89 e5             	mov    %rsp,%rbp
+  801d85:	48 83 ec 20          	sub    $0x20,%rsp
+  801d89:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d8d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d95:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d98:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d9f:	00 00 00 
+  801da2:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801da4:	be 00 00 00 00       	mov    $0x0,%esi
+  801da9:	bf 05 00 00 00       	mov    $0x5,%edi
+  801dae:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801db5:	00 00 00 
+  801db8:	ff d0                	call   *%rax
+  801dba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801dbd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dc1:	79 05                	jns    801dc8 <devfile_stat+0x47>
+    return r;
+  801dc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dc6:	eb 59                	jmp    801e21 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dc8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dcc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dd3:	00 00 00 
+  801dd6:	48 89 d6             	mov    %rdx,%rsi
+  801dd9:	48 89 c7             	mov    %rax,%rdi
+  801ddc:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801de8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801def:	00 00 00 
+  801df2:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801df8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dfc:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e02:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e09:	00 00 00 
+  801e0c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e16:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+0000000000801e23 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e23:	55                   	push   %rbp
+  801e24:	48 89 e5             	mov    %rsp,%rbp
+  801e27:	48 83 ec 10          	sub    $0x10,%rsp
+  801e2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e2f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e36:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e39:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e40:	00 00 00 
+  801e43:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e45:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e4c:	00 00 00 
+  801e4f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e52:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e55:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5a:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e5f:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801e66:	00 00 00 
+  801e69:	ff d0                	call   *%rax
+}
+  801e6b:	c9                   	leave
+  801e6c:	c3                   	ret
+
+0000000000801e6d <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e6d:	55                   	push   %rbp
+  801e6e:	48 89 e5             	mov    %rsp,%rbp
+  801e71:	48 83 ec 18          	sub    $0x18,%rsp
+  801e75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e79:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e7c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e83:	83 e0 03             	and    $0x3,%eax
+}
+  801e86:	c9                   	leave
+  801e87:	c3                   	ret
+
+0000000000801e88 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+  801e8c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e98:	48 89 c7             	mov    %rax,%rdi
+  801e9b:	48 b8 17 40 80 00 00 	movabs $0x804017,%rax
+  801ea2:	00 00 00 
+  801ea5:	ff d0                	call   *%rax
+  801ea7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eac:	7e 07                	jle    801eb5 <remove+0x2d>
+    return -E_BAD_PATH;
+  801eae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb3:	eb 36                	jmp    801eeb <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801eb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eb9:	48 89 c6             	mov    %rax,%rsi
+  801ebc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ec3:	00 00 00 
+  801ec6:	48 89 c7             	mov    %rax,%rdi
+  801ec9:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eda:	bf 07 00 00 00       	mov    $0x7,%edi
+  801edf:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801ee6:	00 00 00 
+  801ee9:	ff d0                	call   *%rax
+}
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+0000000000801eed <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ef1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef6:	bf 08 00 00 00       	mov    $0x8,%edi
+  801efb:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801f02:	00 00 00 
+  801f05:	ff d0                	call   *%rax
+}
+  801f07:	5d                   	pop    %rbp
+  801f08:	c3                   	ret
+
+0000000000801f09 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f09:	55                   	push   %rbp
+  801f0a:	48 89 e5             	mov    %rsp,%rbp
+  801f0d:	48 83 ec 20          	sub    $0x20,%rsp
+  801f11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f15:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1a:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f1f:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801f26:	00 00 00 
+  801f29:	ff d0                	call   *%rax
+  801f2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f32:	79 05                	jns    801f39 <fs_stats+0x30>
+    return r;
+  801f34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f37:	eb 2a                	jmp    801f63 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f3d:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f42:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f49:	00 00 00 
+  801f4c:	48 89 ce             	mov    %rcx,%rsi
+  801f4f:	48 89 c7             	mov    %rax,%rdi
+  801f52:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+  return 0;
+  801f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f63:	c9                   	leave
+  801f64:	c3                   	ret
+
+0000000000801f65 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f65:	55                   	push   %rbp
+  801f66:	48 89 e5             	mov    %rsp,%rbp
+  801f69:	48 83 ec 10          	sub    $0x10,%rsp
+  801f6d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f70:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f77:	00 00 00 
+  801f7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f7d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f7f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f84:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f89:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+
+0000000000801f97 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f97:	55                   	push   %rbp
+  801f98:	48 89 e5             	mov    %rsp,%rbp
+  801f9b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f9f:	89 f8                	mov    %edi,%eax
+  801fa1:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801fa4:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801fa8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801faf:	00 00 00 
+  801fb2:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fbe:	48 b8 0d 1a 80 00 00 	movabs $0x801a0d,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+}
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+
+0000000000801fcc <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fdc:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fe1:	48 89 c7             	mov    %rax,%rdi
+  801fe4:	48 b8 f2 1f 80 00 00 	movabs $0x801ff2,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+0000000000801ff2 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801ff2:	55                   	push   %rbp
+  801ff3:	48 89 e5             	mov    %rsp,%rbp
+  801ff6:	48 83 ec 50          	sub    $0x50,%rsp
+  801ffa:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801ffe:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  802002:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802009:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80200a:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80200f:	74 0a                	je     80201b <pipe_size+0x29>
+  802011:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802018:	00 
+  802019:	76 0a                	jbe    802025 <pipe_size+0x33>
+    return -E_INVAL;
+  80201b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802020:	e9 cc 02 00 00       	jmp    8022f1 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802025:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802029:	48 89 c7             	mov    %rax,%rdi
+  80202c:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802033:	00 00 00 
+  802036:	ff d0                	call   *%rax
+  802038:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80203b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80203f:	0f 88 a8 02 00 00    	js     8022ed <pipe_size+0x2fb>
+  802045:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802049:	ba 07 04 00 00       	mov    $0x407,%edx
+  80204e:	48 89 c6             	mov    %rax,%rsi
+  802051:	bf 00 00 00 00       	mov    $0x0,%edi
+  802056:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+  802062:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802065:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802069:	0f 88 7e 02 00 00    	js     8022ed <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80206f:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802073:	48 89 c7             	mov    %rax,%rdi
+  802076:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802085:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802089:	0f 88 43 02 00 00    	js     8022d2 <pipe_size+0x2e0>
+  80208f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802093:	ba 07 04 00 00       	mov    $0x407,%edx
+  802098:	48 89 c6             	mov    %rax,%rsi
+  80209b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a0:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  8020a7:	00 00 00 
+  8020aa:	ff d0                	call   *%rax
+  8020ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b3:	0f 88 19 02 00 00    	js     8022d2 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020bd:	48 89 c7             	mov    %rax,%rdi
+  8020c0:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020d0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020d7:	00 
+  8020d8:	e9 a2 00 00 00       	jmp    80217f <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020e1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020e5:	48 89 c2             	mov    %rax,%rdx
+  8020e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020ec:	48 01 d0             	add    %rdx,%rax
+  8020ef:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020f4:	48 89 c6             	mov    %rax,%rsi
+  8020f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fc:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  802103:	00 00 00 
+  802106:	ff d0                	call   *%rax
+  802108:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80210b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80210f:	0f 88 37 01 00 00    	js     80224c <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802115:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802119:	48 89 c7             	mov    %rax,%rdi
+  80211c:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80212c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802130:	48 01 c2             	add    %rax,%rdx
+  802133:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802137:	48 c1 e0 0c          	shl    $0xc,%rax
+  80213b:	48 89 c1             	mov    %rax,%rcx
+  80213e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802142:	48 01 c8             	add    %rcx,%rax
+  802145:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80214b:	48 89 d1             	mov    %rdx,%rcx
+  80214e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802153:	48 89 c6             	mov    %rax,%rsi
+  802156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215b:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80216a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80216e:	79 0a                	jns    80217a <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802170:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802175:	e9 d3 00 00 00       	jmp    80224d <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80217a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80217f:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  802186:	00 
+  802187:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80218b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80218f:	48 01 d0             	add    %rdx,%rax
+  802192:	48 83 c0 1f          	add    $0x1f,%rax
+  802196:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80219a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80219e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a3:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8021a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ab:	48 29 d0             	sub    %rdx,%rax
+  8021ae:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021b2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021b6:	0f 82 21 ff ff ff    	jb     8020dd <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021c8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021cc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d4:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021db:	00 00 00 
+  8021de:	8b 12                	mov    (%rdx),%edx
+  8021e0:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021e6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f1:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021f8:	00 00 00 
+  8021fb:	8b 12                	mov    (%rdx),%edx
+  8021fd:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802203:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80220a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80220e:	48 89 c7             	mov    %rax,%rdi
+  802211:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+  80221d:	89 c2                	mov    %eax,%edx
+  80221f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802223:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802225:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802229:	48 89 c7             	mov    %rax,%rdi
+  80222c:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+  802238:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80223c:	48 83 c2 04          	add    $0x4,%rdx
+  802240:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802242:	b8 00 00 00 00       	mov    $0x0,%eax
+  802247:	e9 a5 00 00 00       	jmp    8022f1 <pipe_size+0x2ff>
+      goto err2;
+  80224c:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80224d:	eb 58                	jmp    8022a7 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80224f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802253:	48 c1 e0 0c          	shl    $0xc,%rax
+  802257:	48 89 c2             	mov    %rax,%rdx
+  80225a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80225e:	48 01 d0             	add    %rdx,%rax
+  802261:	48 89 c6             	mov    %rax,%rsi
+  802264:	bf 00 00 00 00       	mov    $0x0,%edi
+  802269:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802275:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802279:	48 89 c7             	mov    %rax,%rdi
+  80227c:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  802283:	00 00 00 
+  802286:	ff d0                	call   *%rax
+  802288:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80228c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802290:	48 01 d0             	add    %rdx,%rax
+  802293:	48 89 c6             	mov    %rax,%rsi
+  802296:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229b:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  8022a2:	00 00 00 
+  8022a5:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8022a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ab:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022af:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022b3:	48 85 c0             	test   %rax,%rax
+  8022b6:	75 97                	jne    80224f <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022bc:	48 89 c6             	mov    %rax,%rsi
+  8022bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c4:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+  8022d0:	eb 01                	jmp    8022d3 <pipe_size+0x2e1>
+    goto err1;
+  8022d2:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022d7:	48 89 c6             	mov    %rax,%rsi
+  8022da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022df:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+  8022eb:	eb 01                	jmp    8022ee <pipe_size+0x2fc>
+    goto err;
+  8022ed:	90                   	nop
+err:
+  return r;
+  8022ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022f1:	c9                   	leave
+  8022f2:	c3                   	ret
+
+00000000008022f3 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022f3:	55                   	push   %rbp
+  8022f4:	48 89 e5             	mov    %rsp,%rbp
+  8022f7:	53                   	push   %rbx
+  8022f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8022fc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802300:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  802304:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80230b:	00 00 00 
+  80230e:	8b 40 04             	mov    0x4(%rax),%eax
+  802311:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802316:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80231d:	00 00 00 
+  802320:	48 98                	cltq
+  802322:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802329:	48 01 d0             	add    %rdx,%rax
+  80232c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802332:	8b 00                	mov    (%rax),%eax
+  802334:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  802337:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80233b:	48 89 c7             	mov    %rax,%rdi
+  80233e:	48 b8 d1 4e 80 00 00 	movabs $0x804ed1,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802350:	48 89 c7             	mov    %rax,%rdi
+  802353:	48 b8 d1 4e 80 00 00 	movabs $0x804ed1,%rax
+  80235a:	00 00 00 
+  80235d:	ff d0                	call   *%rax
+  80235f:	39 c3                	cmp    %eax,%ebx
+  802361:	0f 94 c0             	sete   %al
+  802364:	0f b6 c0             	movzbl %al,%eax
+  802367:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80236a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802371:	00 00 00 
+  802374:	8b 40 04             	mov    0x4(%rax),%eax
+  802377:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80237c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802383:	00 00 00 
+  802386:	48 98                	cltq
+  802388:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80238f:	48 01 d0             	add    %rdx,%rax
+  802392:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802398:	8b 00                	mov    (%rax),%eax
+  80239a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80239d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023a3:	75 05                	jne    8023aa <_pipeisclosed+0xb7>
+      return ret;
+  8023a5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023a8:	eb 68                	jmp    802412 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8023aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ad:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023b0:	0f 84 4e ff ff ff    	je     802304 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023b6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023bd:	00 00 00 
+  8023c0:	8b 40 04             	mov    0x4(%rax),%eax
+  8023c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023c8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023cf:	00 00 00 
+  8023d2:	48 98                	cltq
+  8023d4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023db:	48 01 d0             	add    %rdx,%rax
+  8023de:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023e4:	8b 10                	mov    (%rax),%edx
+  8023e6:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ec:	89 c6                	mov    %eax,%esi
+  8023ee:	48 b8 a8 50 80 00 00 	movabs $0x8050a8,%rax
+  8023f5:	00 00 00 
+  8023f8:	48 89 c7             	mov    %rax,%rdi
+  8023fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802400:	49 b8 68 31 80 00 00 	movabs $0x803168,%r8
+  802407:	00 00 00 
+  80240a:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80240d:	e9 f2 fe ff ff       	jmp    802304 <_pipeisclosed+0x11>
+  }
+}
+  802412:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802416:	c9                   	leave
+  802417:	c3                   	ret
+
+0000000000802418 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802418:	55                   	push   %rbp
+  802419:	48 89 e5             	mov    %rsp,%rbp
+  80241c:	48 83 ec 30          	sub    $0x30,%rsp
+  802420:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802423:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802427:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80242a:	48 89 d6             	mov    %rdx,%rsi
+  80242d:	89 c7                	mov    %eax,%edi
+  80242f:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+  80243b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80243e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802442:	79 05                	jns    802449 <pipeisclosed+0x31>
+    return r;
+  802444:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802447:	eb 31                	jmp    80247a <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  802449:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244d:	48 89 c7             	mov    %rax,%rdi
+  802450:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+  80245c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802464:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802468:	48 89 d6             	mov    %rdx,%rsi
+  80246b:	48 89 c7             	mov    %rax,%rdi
+  80246e:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+000000000080247c <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	48 83 ec 10          	sub    $0x10,%rsp
+  802484:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  802488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248c:	8b 40 18             	mov    0x18(%rax),%eax
+  80248f:	8d 50 01             	lea    0x1(%rax),%edx
+  802492:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802496:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  802499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249d:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8024a0:	85 c0                	test   %eax,%eax
+  8024a2:	74 27                	je     8024cb <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8024a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b3:	48 83 c0 18          	add    $0x18,%rax
+  8024b7:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024bc:	48 89 c7             	mov    %rax,%rdi
+  8024bf:	48 b8 b4 07 80 00 00 	movabs $0x8007b4,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  }
+}
+  8024cb:	90                   	nop
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+00000000008024ce <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024ce:	55                   	push   %rbp
+  8024cf:	48 89 e5             	mov    %rsp,%rbp
+  8024d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024da:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e1:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ec:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024f3:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024fa:	89 c6                	mov    %eax,%esi
+  8024fc:	48 89 cf             	mov    %rcx,%rdi
+  8024ff:	48 b8 65 07 80 00 00 	movabs $0x800765,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+}
+  80250b:	90                   	nop
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+000000000080250e <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80250e:	55                   	push   %rbp
+  80250f:	48 89 e5             	mov    %rsp,%rbp
+  802512:	48 83 ec 70          	sub    $0x70,%rsp
+  802516:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80251a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80251e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802522:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802526:	48 89 c7             	mov    %rax,%rdi
+  802529:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802539:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80253e:	75 0a                	jne    80254a <devpipe_read+0x3c>
+    return 0;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+  802545:	e9 63 01 00 00       	jmp    8026ad <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80254a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254e:	8b 40 18             	mov    0x18(%rax),%eax
+  802551:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802558:	48 8b 10             	mov    (%rax),%rdx
+  80255b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802563:	48 39 c2             	cmp    %rax,%rdx
+  802566:	75 42                	jne    8025aa <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  802568:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80256c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802570:	48 89 d6             	mov    %rdx,%rsi
+  802573:	48 89 c7             	mov    %rax,%rdi
+  802576:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	85 c0                	test   %eax,%eax
+  802584:	74 0a                	je     802590 <devpipe_read+0x82>
+      return 0;
+  802586:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258b:	e9 1d 01 00 00       	jmp    8026ad <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802590:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802597:	89 d6                	mov    %edx,%esi
+  802599:	48 89 c7             	mov    %rax,%rdi
+  80259c:	48 b8 ce 24 80 00 00 	movabs $0x8024ce,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8025a8:	eb a0                	jmp    80254a <devpipe_read+0x3c>
+      break;
+  8025aa:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8025ab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025af:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025b3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025b7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bf:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c7:	48 8b 00             	mov    (%rax),%rax
+  8025ca:	48 29 c2             	sub    %rax,%rdx
+  8025cd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025d1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025d9:	48 39 c2             	cmp    %rax,%rdx
+  8025dc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025e0:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e8:	48 8b 00             	mov    (%rax),%rax
+  8025eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025ef:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f8:	48 f7 f1             	div    %rcx
+  8025fb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025ff:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802603:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80260f:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802613:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802617:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80261b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80261f:	48 39 c2             	cmp    %rax,%rdx
+  802622:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802626:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80262a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80262e:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802632:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802636:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80263a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80263e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802642:	48 89 ce             	mov    %rcx,%rsi
+  802645:	48 89 c7             	mov    %rax,%rdi
+  802648:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802654:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802658:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80265c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802660:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802664:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802668:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80266c:	48 01 d1             	add    %rdx,%rcx
+  80266f:	48 89 c2             	mov    %rax,%rdx
+  802672:	48 89 cf             	mov    %rcx,%rdi
+  802675:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802685:	48 8b 10             	mov    (%rax),%rdx
+  802688:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80268c:	48 01 c2             	add    %rax,%rdx
+  80268f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802693:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269a:	48 89 c7             	mov    %rax,%rdi
+  80269d:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  8026a4:	00 00 00 
+  8026a7:	ff d0                	call   *%rax
+  return n;
+  8026a9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8026ad:	c9                   	leave
+  8026ae:	c3                   	ret
+
+00000000008026af <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026af:	55                   	push   %rbp
+  8026b0:	48 89 e5             	mov    %rsp,%rbp
+  8026b3:	48 83 ec 70          	sub    $0x70,%rsp
+  8026b7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026bb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026bf:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026c7:	48 89 c7             	mov    %rax,%rdi
+  8026ca:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026de:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026e2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026e9:	00 
+  8026ea:	e9 b8 01 00 00       	jmp    8028a7 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f3:	8b 40 18             	mov    0x18(%rax),%eax
+  8026f6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026fd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802701:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802705:	48 8b 00             	mov    (%rax),%rax
+  802708:	48 29 c2             	sub    %rax,%rdx
+  80270b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80270f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802713:	48 39 c2             	cmp    %rax,%rdx
+  802716:	75 4d                	jne    802765 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802718:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80271c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802720:	48 89 d6             	mov    %rdx,%rsi
+  802723:	48 89 c7             	mov    %rax,%rdi
+  802726:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+  802732:	85 c0                	test   %eax,%eax
+  802734:	74 0a                	je     802740 <devpipe_write+0x91>
+        return 0;
+  802736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273b:	e9 79 01 00 00       	jmp    8028b9 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802740:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802743:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802747:	89 d6                	mov    %edx,%esi
+  802749:	48 89 c7             	mov    %rax,%rdi
+  80274c:	48 b8 ce 24 80 00 00 	movabs $0x8024ce,%rax
+  802753:	00 00 00 
+  802756:	ff d0                	call   *%rax
+      m = 0;
+  802758:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80275f:	00 
+      continue;
+  802760:	e9 3a 01 00 00       	jmp    80289f <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802765:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802769:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80276d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802771:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802775:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80277d:	48 8b 08             	mov    (%rax),%rcx
+  802780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802784:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802788:	48 29 c1             	sub    %rax,%rcx
+  80278b:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80278f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802793:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802797:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80279b:	48 39 c2             	cmp    %rax,%rdx
+  80279e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8027a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027b2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bb:	48 f7 f1             	div    %rcx
+  8027be:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027c6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027d2:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027d6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027da:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027e2:	48 39 c2             	cmp    %rax,%rdx
+  8027e5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027e9:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027f1:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027f9:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802801:	48 01 d1             	add    %rdx,%rcx
+  802804:	48 89 c2             	mov    %rax,%rdx
+  802807:	48 89 cf             	mov    %rcx,%rdi
+  80280a:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  802811:	00 00 00 
+  802814:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802816:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80281e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802822:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802826:	73 4d                	jae    802875 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802830:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802834:	48 29 c2             	sub    %rax,%rdx
+  802837:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80283b:	48 01 c2             	add    %rax,%rdx
+  80283e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802842:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802846:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80284a:	48 89 c1             	mov    %rax,%rcx
+  80284d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802851:	48 01 c1             	add    %rax,%rcx
+  802854:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802858:	48 01 c1             	add    %rax,%rcx
+  80285b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80285f:	48 83 c0 20          	add    $0x20,%rax
+  802863:	48 89 ce             	mov    %rcx,%rsi
+  802866:	48 89 c7             	mov    %rax,%rdi
+  802869:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  802870:	00 00 00 
+  802873:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802875:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802879:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80287d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802881:	48 01 c2             	add    %rax,%rdx
+  802884:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802888:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80288c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802890:	48 89 c7             	mov    %rax,%rdi
+  802893:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  80289a:	00 00 00 
+  80289d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80289f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028a3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8028a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ab:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028af:	0f 82 3a fe ff ff    	jb     8026ef <devpipe_write+0x40>
+  }
+
+  return i;
+  8028b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028b9:	c9                   	leave
+  8028ba:	c3                   	ret
+
+00000000008028bb <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028bb:	55                   	push   %rbp
+  8028bc:	48 89 e5             	mov    %rsp,%rbp
+  8028bf:	48 83 ec 40          	sub    $0x40,%rsp
+  8028c3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028c7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028d2:	48 89 c7             	mov    %rax,%rdi
+  8028d5:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  8028dc:	00 00 00 
+  8028df:	ff d0                	call   *%rax
+  8028e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f0:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028f8:	48 89 d6             	mov    %rdx,%rsi
+  8028fb:	48 89 c7             	mov    %rax,%rdi
+  8028fe:	48 b8 96 15 80 00 00 	movabs $0x801596,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80290d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802911:	79 08                	jns    80291b <devpipe_poll+0x60>
+    return r;
+  802913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802916:	e9 85 00 00 00       	jmp    8029a0 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80291b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80291e:	83 e0 01             	and    $0x1,%eax
+  802921:	85 c0                	test   %eax,%eax
+  802923:	74 18                	je     80293d <devpipe_poll+0x82>
+  802925:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802929:	48 8b 10             	mov    (%rax),%rdx
+  80292c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802930:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802934:	48 39 c2             	cmp    %rax,%rdx
+  802937:	74 04                	je     80293d <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802939:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80293d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802940:	83 e0 02             	and    $0x2,%eax
+  802943:	85 c0                	test   %eax,%eax
+  802945:	74 23                	je     80296a <devpipe_poll+0xaf>
+  802947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80294f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802953:	48 8b 00             	mov    (%rax),%rax
+  802956:	48 29 c2             	sub    %rax,%rdx
+  802959:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80295d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802961:	48 39 c2             	cmp    %rax,%rdx
+  802964:	73 04                	jae    80296a <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802966:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80296a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80296e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802972:	48 89 d6             	mov    %rdx,%rsi
+  802975:	48 89 c7             	mov    %rax,%rdi
+  802978:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  80297f:	00 00 00 
+  802982:	ff d0                	call   *%rax
+  802984:	85 c0                	test   %eax,%eax
+  802986:	74 04                	je     80298c <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  802988:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80298c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802990:	75 0b                	jne    80299d <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802996:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80299d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+00000000008029a2 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029a2:	55                   	push   %rbp
+  8029a3:	48 89 e5             	mov    %rsp,%rbp
+  8029a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8029aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b6:	48 89 c7             	mov    %rax,%rdi
+  8029b9:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  8029c0:	00 00 00 
+  8029c3:	ff d0                	call   *%rax
+  8029c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029cd:	48 ba d9 50 80 00 00 	movabs $0x8050d9,%rdx
+  8029d4:	00 00 00 
+  8029d7:	48 89 d6             	mov    %rdx,%rsi
+  8029da:	48 89 c7             	mov    %rax,%rdi
+  8029dd:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029f1:	89 c1                	mov    %eax,%ecx
+  8029f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f7:	48 8b 00             	mov    (%rax),%rax
+  8029fa:	89 c2                	mov    %eax,%edx
+  8029fc:	89 c8                	mov    %ecx,%eax
+  8029fe:	29 d0                	sub    %edx,%eax
+  802a00:	89 c2                	mov    %eax,%edx
+  802a02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a06:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a10:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a17:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a1e:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a25:	00 00 00 
+  802a28:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a34:	c9                   	leave
+  802a35:	c3                   	ret
+
+0000000000802a36 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a36:	55                   	push   %rbp
+  802a37:	48 89 e5             	mov    %rsp,%rbp
+  802a3a:	48 83 ec 40          	sub    $0x40,%rsp
+  802a3e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a46:	48 89 c7             	mov    %rax,%rdi
+  802a49:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  802a50:	00 00 00 
+  802a53:	ff d0                	call   *%rax
+  802a55:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a59:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a60:	00 
+  802a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a65:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a6d:	48 01 d0             	add    %rdx,%rax
+  802a70:	48 83 c0 1f          	add    $0x1f,%rax
+  802a74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a81:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a89:	48 29 d0             	sub    %rdx,%rax
+  802a8c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a90:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a98:	48 89 c6             	mov    %rax,%rsi
+  802a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa0:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  802aa7:	00 00 00 
+  802aaa:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab0:	48 89 c7             	mov    %rax,%rdi
+  802ab3:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  802aba:	00 00 00 
+  802abd:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802abf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ac3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802ac7:	eb 2f                	jmp    802af8 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802ac9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802acd:	48 83 e8 01          	sub    $0x1,%rax
+  802ad1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ad5:	48 89 c2             	mov    %rax,%rdx
+  802ad8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802adc:	48 01 d0             	add    %rdx,%rax
+  802adf:	48 89 c6             	mov    %rax,%rsi
+  802ae2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ae7:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802af3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802af8:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802afd:	77 ca                	ja     802ac9 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802aff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b03:	48 89 c6             	mov    %rax,%rsi
+  802b06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0b:	48 b8 71 04 80 00 00 	movabs $0x800471,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+}
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+0000000000802b19 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b19:	55                   	push   %rbp
+  802b1a:	48 89 e5             	mov    %rsp,%rbp
+  802b1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b21:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b28:	75 10                	jne    802b3a <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b2a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b31:	00 00 00 
+  802b34:	8b 00                	mov    (%rax),%eax
+  802b36:	48 98                	cltq
+  802b38:	eb 05                	jmp    802b3f <vsyscall+0x26>
+  }
+  return 0;
+  802b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3f:	c9                   	leave
+  802b40:	c3                   	ret
+
+0000000000802b41 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b41:	55                   	push   %rbp
+  802b42:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b45:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4a:	48 b8 19 2b 80 00 00 	movabs $0x802b19,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+}
+  802b56:	5d                   	pop    %rbp
+  802b57:	c3                   	ret
+
+0000000000802b58 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b58:	55                   	push   %rbp
+  802b59:	48 89 e5             	mov    %rsp,%rbp
+  802b5c:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b60:	0f 31                	rdtsc
+  802b62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b65:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b6b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b6e:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b72:	48 09 d0             	or     %rdx,%rax
+  802b75:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b81:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b88:	00 00 00 
+  802b8b:	8b 40 08             	mov    0x8(%rax),%eax
+  802b8e:	48 98                	cltq
+  802b90:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b9d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802ba1:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802ba8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bac:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bb5:	48 89 d0             	mov    %rdx,%rax
+  802bb8:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bc8:	48 01 c8             	add    %rcx,%rax
+}
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+0000000000802bcd <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bcd:	55                   	push   %rbp
+  802bce:	48 89 e5             	mov    %rsp,%rbp
+  802bd1:	48 83 ec 20          	sub    $0x20,%rsp
+  802bd5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bdb:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bde:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802be2:	be 01 00 00 00       	mov    $0x1,%esi
+  802be7:	48 89 c7             	mov    %rax,%rdi
+  802bea:	48 b8 a2 01 80 00 00 	movabs $0x8001a2,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+}
+  802bf6:	90                   	nop
+  802bf7:	c9                   	leave
+  802bf8:	c3                   	ret
+
+0000000000802bf9 <getchar>:
+
+int
+getchar(void) {
+  802bf9:	55                   	push   %rbp
+  802bfa:	48 89 e5             	mov    %rsp,%rbp
+  802bfd:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c01:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c05:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c0a:	48 89 c6             	mov    %rax,%rsi
+  802c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c12:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  802c19:	00 00 00 
+  802c1c:	ff d0                	call   *%rax
+  802c1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c25:	79 05                	jns    802c2c <getchar+0x33>
+    return r;
+  802c27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c2a:	eb 14                	jmp    802c40 <getchar+0x47>
+  if (r < 1)
+  802c2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c30:	7f 07                	jg     802c39 <getchar+0x40>
+    return -E_EOF;
+  802c32:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c37:	eb 07                	jmp    802c40 <getchar+0x47>
+  return c;
+  802c39:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c3d:	0f b6 c0             	movzbl %al,%eax
+}
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+
+0000000000802c42 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c42:	55                   	push   %rbp
+  802c43:	48 89 e5             	mov    %rsp,%rbp
+  802c46:	48 83 ec 20          	sub    $0x20,%rsp
+  802c4a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c4d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c54:	48 89 d6             	mov    %rdx,%rsi
+  802c57:	89 c7                	mov    %eax,%edi
+  802c59:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+  802c65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c6c:	79 05                	jns    802c73 <iscons+0x31>
+    return r;
+  802c6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c71:	eb 1a                	jmp    802c8d <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c77:	8b 10                	mov    (%rax),%edx
+  802c79:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c80:	00 00 00 
+  802c83:	8b 00                	mov    (%rax),%eax
+  802c85:	39 c2                	cmp    %eax,%edx
+  802c87:	0f 94 c0             	sete   %al
+  802c8a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+
+0000000000802c8f <opencons>:
+
+int
+opencons(void) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c97:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c9b:	48 89 c7             	mov    %rax,%rdi
+  802c9e:	48 b8 ee 0a 80 00 00 	movabs $0x800aee,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb1:	79 05                	jns    802cb8 <opencons+0x29>
+    return r;
+  802cb3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cb6:	eb 66                	jmp    802d1e <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802cb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cbc:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cc1:	48 89 c6             	mov    %rax,%rsi
+  802cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc9:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+  802cd5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cd8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cdc:	79 05                	jns    802ce3 <opencons+0x54>
+    return r;
+  802cde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce1:	eb 3b                	jmp    802d1e <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802ce3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce7:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cee:	00 00 00 
+  802cf1:	8b 12                	mov    (%rdx),%edx
+  802cf3:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cf5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d04:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d0f:	48 89 c7             	mov    %rax,%rdi
+  802d12:	48 b8 a0 0a 80 00 00 	movabs $0x800aa0,%rax
+  802d19:	00 00 00 
+  802d1c:	ff d0                	call   *%rax
+}
+  802d1e:	c9                   	leave
+  802d1f:	c3                   	ret
+
+0000000000802d20 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d20:	55                   	push   %rbp
+  802d21:	48 89 e5             	mov    %rsp,%rbp
+  802d24:	48 83 ec 20          	sub    $0x20,%rsp
+  802d28:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d2b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d2e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d35:	48 89 d6             	mov    %rdx,%rsi
+  802d38:	89 c7                	mov    %eax,%edi
+  802d3a:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d49:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d4d:	79 05                	jns    802d54 <consmode+0x34>
+    return r;
+  802d4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d52:	eb 34                	jmp    802d88 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d58:	8b 10                	mov    (%rax),%edx
+  802d5a:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d61:	00 00 00 
+  802d64:	8b 00                	mov    (%rax),%eax
+  802d66:	39 c2                	cmp    %eax,%edx
+  802d68:	74 07                	je     802d71 <consmode+0x51>
+    return -E_INVAL;
+  802d6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6f:	eb 17                	jmp    802d88 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d75:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d7f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d82:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+
+0000000000802d8a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d8a:	55                   	push   %rbp
+  802d8b:	48 89 e5             	mov    %rsp,%rbp
+  802d8e:	48 83 ec 20          	sub    $0x20,%rsp
+  802d92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d96:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d9a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802da2:	8b 50 0c             	mov    0xc(%rax),%edx
+  802da5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802da9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dad:	48 89 ce             	mov    %rcx,%rsi
+  802db0:	48 89 c7             	mov    %rax,%rdi
+  802db3:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+  802dbf:	48 98                	cltq
+}
+  802dc1:	c9                   	leave
+  802dc2:	c3                   	ret
+
+0000000000802dc3 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dc3:	55                   	push   %rbp
+  802dc4:	48 89 e5             	mov    %rsp,%rbp
+  802dc7:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dce:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dd5:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802ddc:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802de3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dea:	eb 74                	jmp    802e60 <devcons_write+0x9d>
+    m = n - tot;
+  802dec:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802df3:	89 c2                	mov    %eax,%edx
+  802df5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802df8:	29 c2                	sub    %eax,%edx
+  802dfa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802dfd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e00:	83 f8 7f             	cmp    $0x7f,%eax
+  802e03:	76 07                	jbe    802e0c <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e05:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e0c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e0f:	48 63 d0             	movslq %eax,%rdx
+  802e12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e15:	48 63 c8             	movslq %eax,%rcx
+  802e18:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e1f:	48 01 c1             	add    %rax,%rcx
+  802e22:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e29:	48 89 ce             	mov    %rcx,%rsi
+  802e2c:	48 89 c7             	mov    %rax,%rdi
+  802e2f:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  802e36:	00 00 00 
+  802e39:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e3b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e3e:	48 63 d0             	movslq %eax,%rdx
+  802e41:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e48:	48 89 d6             	mov    %rdx,%rsi
+  802e4b:	48 89 c7             	mov    %rax,%rdi
+  802e4e:	48 b8 a2 01 80 00 00 	movabs $0x8001a2,%rax
+  802e55:	00 00 00 
+  802e58:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e5a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e5d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e63:	48 98                	cltq
+  802e65:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e6c:	0f 82 7a ff ff ff    	jb     802dec <devcons_write+0x29>
+  }
+  return tot;
+  802e72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e75:	48 98                	cltq
+}
+  802e77:	c9                   	leave
+  802e78:	c3                   	ret
+
+0000000000802e79 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e79:	55                   	push   %rbp
+  802e7a:	48 89 e5             	mov    %rsp,%rbp
+  802e7d:	48 83 ec 08          	sub    $0x8,%rsp
+  802e81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e8a:	c9                   	leave
+  802e8b:	c3                   	ret
+
+0000000000802e8c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e8c:	55                   	push   %rbp
+  802e8d:	48 89 e5             	mov    %rsp,%rbp
+  802e90:	48 83 ec 10          	sub    $0x10,%rsp
+  802e94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea0:	48 ba e5 50 80 00 00 	movabs $0x8050e5,%rdx
+  802ea7:	00 00 00 
+  802eaa:	48 89 d6             	mov    %rdx,%rsi
+  802ead:	48 89 c7             	mov    %rax,%rdi
+  802eb0:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  return 0;
+  802ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ec1:	c9                   	leave
+  802ec2:	c3                   	ret
+
+0000000000802ec3 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	48 83 ec 30          	sub    $0x30,%rsp
+  802ecb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ecf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802ed2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ed6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802edd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ee0:	83 e0 02             	and    $0x2,%eax
+  802ee3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eea:	8b 40 0c             	mov    0xc(%rax),%eax
+  802eed:	83 f8 01             	cmp    $0x1,%eax
+  802ef0:	75 04                	jne    802ef6 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ef2:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ef6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ef9:	83 e0 01             	and    $0x1,%eax
+  802efc:	85 c0                	test   %eax,%eax
+  802efe:	74 44                	je     802f44 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f08:	89 c2                	mov    %eax,%edx
+  802f0a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f14:	48 b8 01 08 80 00 00 	movabs $0x800801,%rax
+  802f1b:	00 00 00 
+  802f1e:	ff d0                	call   *%rax
+  802f20:	83 f8 01             	cmp    $0x1,%eax
+  802f23:	75 06                	jne    802f2b <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f25:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f29:	eb 19                	jmp    802f44 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f2f:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f35:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f38:	89 c2                	mov    %eax,%edx
+  802f3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f3e:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+
+0000000000802f49 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+  802f4d:	53                   	push   %rbx
+  802f4e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f55:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f5c:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f62:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f69:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f70:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f77:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f7e:	84 c0                	test   %al,%al
+  802f80:	74 23                	je     802fa5 <_panic+0x5c>
+  802f82:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f89:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f8d:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f91:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f95:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f99:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f9d:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802fa1:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802fa5:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802fac:	00 00 00 
+  802faf:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fb6:	00 00 00 
+  802fb9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fbd:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fc4:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fcb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fd2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fd9:	00 00 00 
+  802fdc:	48 8b 18             	mov    (%rax),%rbx
+  802fdf:	48 b8 40 03 80 00 00 	movabs $0x800340,%rax
+  802fe6:	00 00 00 
+  802fe9:	ff d0                	call   *%rax
+  802feb:	89 c6                	mov    %eax,%esi
+  802fed:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802ff3:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802ffa:	41 89 d0             	mov    %edx,%r8d
+  802ffd:	48 89 c1             	mov    %rax,%rcx
+  803000:	48 89 da             	mov    %rbx,%rdx
+  803003:	48 b8 f0 50 80 00 00 	movabs $0x8050f0,%rax
+  80300a:	00 00 00 
+  80300d:	48 89 c7             	mov    %rax,%rdi
+  803010:	b8 00 00 00 00       	mov    $0x0,%eax
+  803015:	49 b9 68 31 80 00 00 	movabs $0x803168,%r9
+  80301c:	00 00 00 
+  80301f:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803022:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803029:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803030:	48 89 d6             	mov    %rdx,%rsi
+  803033:	48 89 c7             	mov    %rax,%rdi
+  803036:	48 b8 dd 30 80 00 00 	movabs $0x8030dd,%rax
+  80303d:	00 00 00 
+  803040:	ff d0                	call   *%rax
+  cprintf("\n");
+  803042:	48 b8 13 51 80 00 00 	movabs $0x805113,%rax
+  803049:	00 00 00 
+  80304c:	48 89 c7             	mov    %rax,%rdi
+  80304f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803054:	48 ba 68 31 80 00 00 	movabs $0x803168,%rdx
+  80305b:	00 00 00 
+  80305e:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803060:	cc                   	int3
+  803061:	eb fd                	jmp    803060 <_panic+0x117>
+
+0000000000803063 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803063:	55                   	push   %rbp
+  803064:	48 89 e5             	mov    %rsp,%rbp
+  803067:	48 83 ec 10          	sub    $0x10,%rsp
+  80306b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80306e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803076:	8b 00                	mov    (%rax),%eax
+  803078:	8d 48 01             	lea    0x1(%rax),%ecx
+  80307b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80307f:	89 0a                	mov    %ecx,(%rdx)
+  803081:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803084:	89 d1                	mov    %edx,%ecx
+  803086:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80308a:	48 98                	cltq
+  80308c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803090:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803094:	8b 00                	mov    (%rax),%eax
+  803096:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80309b:	75 2c                	jne    8030c9 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80309d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a1:	8b 00                	mov    (%rax),%eax
+  8030a3:	48 98                	cltq
+  8030a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030a9:	48 83 c2 08          	add    $0x8,%rdx
+  8030ad:	48 89 c6             	mov    %rax,%rsi
+  8030b0:	48 89 d7             	mov    %rdx,%rdi
+  8030b3:	48 b8 a2 01 80 00 00 	movabs $0x8001a2,%rax
+  8030ba:	00 00 00 
+  8030bd:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8030d0:	8d 50 01             	lea    0x1(%rax),%edx
+  8030d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d7:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030da:	90                   	nop
+  8030db:	c9                   	leave
+  8030dc:	c3                   	ret
+
+00000000008030dd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030dd:	55                   	push   %rbp
+  8030de:	48 89 e5             	mov    %rsp,%rbp
+  8030e1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030e8:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030ef:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030f6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030fd:	00 00 00 
+  b.cnt = 0;
+  803100:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  803107:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80310a:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803111:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803118:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80311f:	48 89 c6             	mov    %rax,%rsi
+  803122:	48 b8 63 30 80 00 00 	movabs $0x803063,%rax
+  803129:	00 00 00 
+  80312c:	48 89 c7             	mov    %rax,%rdi
+  80312f:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  803136:	00 00 00 
+  803139:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80313b:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803141:	48 98                	cltq
+  803143:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80314a:	48 83 c2 08          	add    $0x8,%rdx
+  80314e:	48 89 c6             	mov    %rax,%rsi
+  803151:	48 89 d7             	mov    %rdx,%rdi
+  803154:	48 b8 a2 01 80 00 00 	movabs $0x8001a2,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803160:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+0000000000803168 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803168:	55                   	push   %rbp
+  803169:	48 89 e5             	mov    %rsp,%rbp
+  80316c:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803173:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80317a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803181:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803188:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80318f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803196:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80319d:	84 c0                	test   %al,%al
+  80319f:	74 20                	je     8031c1 <cprintf+0x59>
+  8031a1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8031a5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8031a9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8031ad:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031b1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031b5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031b9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031bd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031c1:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031c8:	00 00 00 
+  8031cb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031d2:	00 00 00 
+  8031d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031d9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031e0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031e7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031ee:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031f5:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031fc:	48 89 d6             	mov    %rdx,%rsi
+  8031ff:	48 89 c7             	mov    %rax,%rdi
+  803202:	48 b8 dd 30 80 00 00 	movabs $0x8030dd,%rax
+  803209:	00 00 00 
+  80320c:	ff d0                	call   *%rax
+  80320e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803214:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80321a:	c9                   	leave
+  80321b:	c3                   	ret
+
+000000000080321c <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80321c:	55                   	push   %rbp
+  80321d:	48 89 e5             	mov    %rsp,%rbp
+  803220:	48 83 ec 30          	sub    $0x30,%rsp
+  803224:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803228:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80322c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803230:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803233:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  803237:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80323b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80323e:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803242:	72 54                	jb     803298 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803244:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803247:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80324a:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80324d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803251:	ba 00 00 00 00       	mov    $0x0,%edx
+  803256:	48 f7 f6             	div    %rsi
+  803259:	49 89 c2             	mov    %rax,%r10
+  80325c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80325f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803262:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803266:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80326a:	41 89 c9             	mov    %ecx,%r9d
+  80326d:	41 89 f8             	mov    %edi,%r8d
+  803270:	89 d1                	mov    %edx,%ecx
+  803272:	4c 89 d2             	mov    %r10,%rdx
+  803275:	48 89 c7             	mov    %rax,%rdi
+  803278:	48 b8 1c 32 80 00 00 	movabs $0x80321c,%rax
+  80327f:	00 00 00 
+  803282:	ff d0                	call   *%rax
+  803284:	eb 1c                	jmp    8032a2 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  803286:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80328a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80328d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803291:	48 89 d6             	mov    %rdx,%rsi
+  803294:	89 c7                	mov    %eax,%edi
+  803296:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803298:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80329c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8032a0:	7f e4                	jg     803286 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8032a2:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8032a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ae:	48 f7 f1             	div    %rcx
+  8032b1:	48 b8 50 53 80 00 00 	movabs $0x805350,%rax
+  8032b8:	00 00 00 
+  8032bb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032bf:	0f be c0             	movsbl %al,%eax
+  8032c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032c6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032ca:	48 89 d6             	mov    %rdx,%rsi
+  8032cd:	89 c7                	mov    %eax,%edi
+  8032cf:	ff d1                	call   *%rcx
+}
+  8032d1:	90                   	nop
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+00000000008032d4 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8032dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032e0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032e3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032e7:	7e 4b                	jle    803334 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032ed:	8b 00                	mov    (%rax),%eax
+  8032ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f2:	77 24                	ja     803318 <getuint+0x44>
+  8032f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803300:	8b 00                	mov    (%rax),%eax
+  803302:	89 c0                	mov    %eax,%eax
+  803304:	48 01 d0             	add    %rdx,%rax
+  803307:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330b:	8b 12                	mov    (%rdx),%edx
+  80330d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803310:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803314:	89 0a                	mov    %ecx,(%rdx)
+  803316:	eb 14                	jmp    80332c <getuint+0x58>
+  803318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80331c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803320:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803324:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803328:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80332c:	48 8b 00             	mov    (%rax),%rax
+  80332f:	e9 95 00 00 00       	jmp    8033c9 <getuint+0xf5>
+  else if (lflag)
+  803334:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803338:	74 48                	je     803382 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80333a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80333e:	8b 00                	mov    (%rax),%eax
+  803340:	83 f8 2f             	cmp    $0x2f,%eax
+  803343:	77 24                	ja     803369 <getuint+0x95>
+  803345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803349:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80334d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803351:	8b 00                	mov    (%rax),%eax
+  803353:	89 c0                	mov    %eax,%eax
+  803355:	48 01 d0             	add    %rdx,%rax
+  803358:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335c:	8b 12                	mov    (%rdx),%edx
+  80335e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803365:	89 0a                	mov    %ecx,(%rdx)
+  803367:	eb 14                	jmp    80337d <getuint+0xa9>
+  803369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803371:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803375:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803379:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80337d:	48 8b 00             	mov    (%rax),%rax
+  803380:	eb 47                	jmp    8033c9 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803386:	8b 00                	mov    (%rax),%eax
+  803388:	83 f8 2f             	cmp    $0x2f,%eax
+  80338b:	77 24                	ja     8033b1 <getuint+0xdd>
+  80338d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803391:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803395:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803399:	8b 00                	mov    (%rax),%eax
+  80339b:	89 c0                	mov    %eax,%eax
+  80339d:	48 01 d0             	add    %rdx,%rax
+  8033a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a4:	8b 12                	mov    (%rdx),%edx
+  8033a6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ad:	89 0a                	mov    %ecx,(%rdx)
+  8033af:	eb 14                	jmp    8033c5 <getuint+0xf1>
+  8033b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033b9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033c5:	8b 00                	mov    (%rax),%eax
+  8033c7:	89 c0                	mov    %eax,%eax
+}
+  8033c9:	c9                   	leave
+  8033ca:	c3                   	ret
+
+00000000008033cb <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033cb:	55                   	push   %rbp
+  8033cc:	48 89 e5             	mov    %rsp,%rbp
+  8033cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033d7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033da:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033de:	7e 4b                	jle    80342b <getint+0x60>
+    return va_arg(*ap, long long);
+  8033e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e4:	8b 00                	mov    (%rax),%eax
+  8033e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e9:	77 24                	ja     80340f <getint+0x44>
+  8033eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f7:	8b 00                	mov    (%rax),%eax
+  8033f9:	89 c0                	mov    %eax,%eax
+  8033fb:	48 01 d0             	add    %rdx,%rax
+  8033fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803402:	8b 12                	mov    (%rdx),%edx
+  803404:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803407:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80340b:	89 0a                	mov    %ecx,(%rdx)
+  80340d:	eb 14                	jmp    803423 <getint+0x58>
+  80340f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803413:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803417:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80341b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80341f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803423:	48 8b 00             	mov    (%rax),%rax
+  803426:	e9 95 00 00 00       	jmp    8034c0 <getint+0xf5>
+  else if (lflag)
+  80342b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80342f:	74 48                	je     803479 <getint+0xae>
+    return va_arg(*ap, long);
+  803431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803435:	8b 00                	mov    (%rax),%eax
+  803437:	83 f8 2f             	cmp    $0x2f,%eax
+  80343a:	77 24                	ja     803460 <getint+0x95>
+  80343c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803440:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803448:	8b 00                	mov    (%rax),%eax
+  80344a:	89 c0                	mov    %eax,%eax
+  80344c:	48 01 d0             	add    %rdx,%rax
+  80344f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803453:	8b 12                	mov    (%rdx),%edx
+  803455:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803458:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80345c:	89 0a                	mov    %ecx,(%rdx)
+  80345e:	eb 14                	jmp    803474 <getint+0xa9>
+  803460:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803464:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803468:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80346c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803470:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803474:	48 8b 00             	mov    (%rax),%rax
+  803477:	eb 47                	jmp    8034c0 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  803479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347d:	8b 00                	mov    (%rax),%eax
+  80347f:	83 f8 2f             	cmp    $0x2f,%eax
+  803482:	77 24                	ja     8034a8 <getint+0xdd>
+  803484:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803488:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80348c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803490:	8b 00                	mov    (%rax),%eax
+  803492:	89 c0                	mov    %eax,%eax
+  803494:	48 01 d0             	add    %rdx,%rax
+  803497:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349b:	8b 12                	mov    (%rdx),%edx
+  80349d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034a4:	89 0a                	mov    %ecx,(%rdx)
+  8034a6:	eb 14                	jmp    8034bc <getint+0xf1>
+  8034a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034b0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034b8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034bc:	8b 00                	mov    (%rax),%eax
+  8034be:	48 98                	cltq
+}
+  8034c0:	c9                   	leave
+  8034c1:	c3                   	ret
+
+00000000008034c2 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034c2:	55                   	push   %rbp
+  8034c3:	48 89 e5             	mov    %rsp,%rbp
+  8034c6:	41 54                	push   %r12
+  8034c8:	53                   	push   %rbx
+  8034c9:	48 83 ec 60          	sub    $0x60,%rsp
+  8034cd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034d1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034d5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034d9:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034dd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034e1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034e5:	48 8b 06             	mov    (%rsi),%rax
+  8034e8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034ec:	48 89 01             	mov    %rax,(%rcx)
+  8034ef:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034f3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034f7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034fb:	eb 17                	jmp    803514 <vprintfmt+0x52>
+      if (ch == '\0')
+  8034fd:	85 db                	test   %ebx,%ebx
+  8034ff:	0f 84 bf 04 00 00    	je     8039c4 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  803505:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803509:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80350d:	48 89 c6             	mov    %rax,%rsi
+  803510:	89 df                	mov    %ebx,%edi
+  803512:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803514:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803518:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80351c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803520:	0f b6 00             	movzbl (%rax),%eax
+  803523:	0f b6 d8             	movzbl %al,%ebx
+  803526:	83 fb 25             	cmp    $0x25,%ebx
+  803529:	75 d2                	jne    8034fd <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80352b:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  80352f:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  803536:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80353d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803544:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80354b:	eb 04                	jmp    803551 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80354d:	90                   	nop
+  80354e:	eb 01                	jmp    803551 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803550:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803551:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803555:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803559:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80355d:	0f b6 00             	movzbl (%rax),%eax
+  803560:	0f b6 d8             	movzbl %al,%ebx
+  803563:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  803566:	83 f8 55             	cmp    $0x55,%eax
+  803569:	0f 87 22 04 00 00    	ja     803991 <vprintfmt+0x4cf>
+  80356f:	89 c0                	mov    %eax,%eax
+  803571:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803578:	00 
+  803579:	48 b8 78 53 80 00 00 	movabs $0x805378,%rax
+  803580:	00 00 00 
+  803583:	48 01 d0             	add    %rdx,%rax
+  803586:	48 8b 00             	mov    (%rax),%rax
+  803589:	ff e0                	jmp    *%rax
+        padc = '-';
+  80358b:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80358f:	eb c0                	jmp    803551 <vprintfmt+0x8f>
+        padc = '0';
+  803591:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803595:	eb ba                	jmp    803551 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  803597:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80359e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8035a1:	89 d0                	mov    %edx,%eax
+  8035a3:	c1 e0 02             	shl    $0x2,%eax
+  8035a6:	01 d0                	add    %edx,%eax
+  8035a8:	01 c0                	add    %eax,%eax
+  8035aa:	01 d8                	add    %ebx,%eax
+  8035ac:	83 e8 30             	sub    $0x30,%eax
+  8035af:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035b2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035b6:	0f b6 00             	movzbl (%rax),%eax
+  8035b9:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035bc:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035bf:	7e 60                	jle    803621 <vprintfmt+0x15f>
+  8035c1:	83 fb 39             	cmp    $0x39,%ebx
+  8035c4:	7f 5b                	jg     803621 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035c6:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035cb:	eb d1                	jmp    80359e <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d3:	77 17                	ja     8035ec <vprintfmt+0x12a>
+  8035d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035dc:	89 d2                	mov    %edx,%edx
+  8035de:	48 01 d0             	add    %rdx,%rax
+  8035e1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035e4:	83 c2 08             	add    $0x8,%edx
+  8035e7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035ea:	eb 0c                	jmp    8035f8 <vprintfmt+0x136>
+  8035ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035f0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035f4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035f8:	8b 00                	mov    (%rax),%eax
+  8035fa:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035fd:	eb 23                	jmp    803622 <vprintfmt+0x160>
+        if (width < 0)
+  8035ff:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803603:	0f 89 44 ff ff ff    	jns    80354d <vprintfmt+0x8b>
+          width = 0;
+  803609:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803610:	e9 38 ff ff ff       	jmp    80354d <vprintfmt+0x8b>
+        altflag = 1;
+  803615:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80361c:	e9 30 ff ff ff       	jmp    803551 <vprintfmt+0x8f>
+        goto process_precision;
+  803621:	90                   	nop
+        if (width < 0)
+  803622:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803626:	0f 89 24 ff ff ff    	jns    803550 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80362c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80362f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803632:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803639:	e9 12 ff ff ff       	jmp    803550 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80363e:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803642:	e9 0a ff ff ff       	jmp    803551 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  803647:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364a:	83 f8 2f             	cmp    $0x2f,%eax
+  80364d:	77 17                	ja     803666 <vprintfmt+0x1a4>
+  80364f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803653:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803656:	89 d2                	mov    %edx,%edx
+  803658:	48 01 d0             	add    %rdx,%rax
+  80365b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80365e:	83 c2 08             	add    $0x8,%edx
+  803661:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803664:	eb 0c                	jmp    803672 <vprintfmt+0x1b0>
+  803666:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80366a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80366e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803672:	8b 00                	mov    (%rax),%eax
+  803674:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803678:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80367c:	48 89 d6             	mov    %rdx,%rsi
+  80367f:	89 c7                	mov    %eax,%edi
+  803681:	ff d1                	call   *%rcx
+        break;
+  803683:	e9 37 03 00 00       	jmp    8039bf <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  803688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80368b:	83 f8 2f             	cmp    $0x2f,%eax
+  80368e:	77 17                	ja     8036a7 <vprintfmt+0x1e5>
+  803690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803694:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803697:	89 d2                	mov    %edx,%edx
+  803699:	48 01 d0             	add    %rdx,%rax
+  80369c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80369f:	83 c2 08             	add    $0x8,%edx
+  8036a2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036a5:	eb 0c                	jmp    8036b3 <vprintfmt+0x1f1>
+  8036a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036ab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036b3:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036b5:	85 db                	test   %ebx,%ebx
+  8036b7:	79 02                	jns    8036bb <vprintfmt+0x1f9>
+          err = -err;
+  8036b9:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036bb:	83 fb 15             	cmp    $0x15,%ebx
+  8036be:	7f 16                	jg     8036d6 <vprintfmt+0x214>
+  8036c0:	48 ba a0 52 80 00 00 	movabs $0x8052a0,%rdx
+  8036c7:	00 00 00 
+  8036ca:	48 63 c3             	movslq %ebx,%rax
+  8036cd:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036d1:	4d 85 e4             	test   %r12,%r12
+  8036d4:	75 2e                	jne    803704 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036d6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036da:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036de:	89 d9                	mov    %ebx,%ecx
+  8036e0:	48 ba 61 53 80 00 00 	movabs $0x805361,%rdx
+  8036e7:	00 00 00 
+  8036ea:	48 89 c7             	mov    %rax,%rdi
+  8036ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f2:	49 b8 ce 39 80 00 00 	movabs $0x8039ce,%r8
+  8036f9:	00 00 00 
+  8036fc:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036ff:	e9 bb 02 00 00       	jmp    8039bf <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  803704:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803708:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80370c:	4c 89 e1             	mov    %r12,%rcx
+  80370f:	48 ba 6a 53 80 00 00 	movabs $0x80536a,%rdx
+  803716:	00 00 00 
+  803719:	48 89 c7             	mov    %rax,%rdi
+  80371c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803721:	49 b8 ce 39 80 00 00 	movabs $0x8039ce,%r8
+  803728:	00 00 00 
+  80372b:	41 ff d0             	call   *%r8
+        break;
+  80372e:	e9 8c 02 00 00       	jmp    8039bf <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803733:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803736:	83 f8 2f             	cmp    $0x2f,%eax
+  803739:	77 17                	ja     803752 <vprintfmt+0x290>
+  80373b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80373f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803742:	89 d2                	mov    %edx,%edx
+  803744:	48 01 d0             	add    %rdx,%rax
+  803747:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80374a:	83 c2 08             	add    $0x8,%edx
+  80374d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803750:	eb 0c                	jmp    80375e <vprintfmt+0x29c>
+  803752:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803756:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80375a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80375e:	4c 8b 20             	mov    (%rax),%r12
+  803761:	4d 85 e4             	test   %r12,%r12
+  803764:	75 0a                	jne    803770 <vprintfmt+0x2ae>
+          p = "(null)";
+  803766:	49 bc 6d 53 80 00 00 	movabs $0x80536d,%r12
+  80376d:	00 00 00 
+        if (width > 0 && padc != '-')
+  803770:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803774:	7e 78                	jle    8037ee <vprintfmt+0x32c>
+  803776:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80377a:	74 72                	je     8037ee <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80377c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80377f:	48 98                	cltq
+  803781:	48 89 c6             	mov    %rax,%rsi
+  803784:	4c 89 e7             	mov    %r12,%rdi
+  803787:	48 b8 da 40 80 00 00 	movabs $0x8040da,%rax
+  80378e:	00 00 00 
+  803791:	ff d0                	call   *%rax
+  803793:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803796:	eb 17                	jmp    8037af <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803798:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80379c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8037a0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8037a4:	48 89 d6             	mov    %rdx,%rsi
+  8037a7:	89 c7                	mov    %eax,%edi
+  8037a9:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037ab:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037af:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037b3:	7f e3                	jg     803798 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037b5:	eb 37                	jmp    8037ee <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037b7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037bb:	74 1e                	je     8037db <vprintfmt+0x319>
+  8037bd:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037c0:	7e 05                	jle    8037c7 <vprintfmt+0x305>
+  8037c2:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037c5:	7e 14                	jle    8037db <vprintfmt+0x319>
+            putch('?', putdat);
+  8037c7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037cb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037cf:	48 89 c6             	mov    %rax,%rsi
+  8037d2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037d7:	ff d2                	call   *%rdx
+  8037d9:	eb 0f                	jmp    8037ea <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037db:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037df:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037e3:	48 89 c6             	mov    %rax,%rsi
+  8037e6:	89 df                	mov    %ebx,%edi
+  8037e8:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037ea:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037ee:	4c 89 e0             	mov    %r12,%rax
+  8037f1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037f5:	0f b6 00             	movzbl (%rax),%eax
+  8037f8:	0f be d8             	movsbl %al,%ebx
+  8037fb:	85 db                	test   %ebx,%ebx
+  8037fd:	74 28                	je     803827 <vprintfmt+0x365>
+  8037ff:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803803:	78 b2                	js     8037b7 <vprintfmt+0x2f5>
+  803805:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  803809:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80380d:	79 a8                	jns    8037b7 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  80380f:	eb 16                	jmp    803827 <vprintfmt+0x365>
+          putch(' ', putdat);
+  803811:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803815:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803819:	48 89 c6             	mov    %rax,%rsi
+  80381c:	bf 20 00 00 00       	mov    $0x20,%edi
+  803821:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803823:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803827:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80382b:	7f e4                	jg     803811 <vprintfmt+0x34f>
+        break;
+  80382d:	e9 8d 01 00 00       	jmp    8039bf <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803832:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803835:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803839:	89 d6                	mov    %edx,%esi
+  80383b:	48 89 c7             	mov    %rax,%rdi
+  80383e:	48 b8 cb 33 80 00 00 	movabs $0x8033cb,%rax
+  803845:	00 00 00 
+  803848:	ff d0                	call   *%rax
+  80384a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80384e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803852:	48 85 c0             	test   %rax,%rax
+  803855:	79 1d                	jns    803874 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  803857:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80385b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80385f:	48 89 c6             	mov    %rax,%rsi
+  803862:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803867:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803869:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80386d:	48 f7 d8             	neg    %rax
+  803870:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803874:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80387b:	e9 d2 00 00 00       	jmp    803952 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803880:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803883:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803887:	89 d6                	mov    %edx,%esi
+  803889:	48 89 c7             	mov    %rax,%rdi
+  80388c:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+  803898:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80389c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038a3:	e9 aa 00 00 00       	jmp    803952 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8038a8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038ab:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038af:	89 d6                	mov    %edx,%esi
+  8038b1:	48 89 c7             	mov    %rax,%rdi
+  8038b4:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+  8038c0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038c4:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038cb:	e9 82 00 00 00       	jmp    803952 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038d0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038d4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038d8:	48 89 c6             	mov    %rax,%rsi
+  8038db:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038e0:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038e2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038e6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038ea:	48 89 c6             	mov    %rax,%rsi
+  8038ed:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038f2:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8038fa:	77 17                	ja     803913 <vprintfmt+0x451>
+  8038fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803900:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803903:	89 d2                	mov    %edx,%edx
+  803905:	48 01 d0             	add    %rdx,%rax
+  803908:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80390b:	83 c2 08             	add    $0x8,%edx
+  80390e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803911:	eb 0c                	jmp    80391f <vprintfmt+0x45d>
+  803913:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803917:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80391b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80391f:	48 8b 00             	mov    (%rax),%rax
+  803922:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803926:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80392d:	eb 23                	jmp    803952 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  80392f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803932:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803936:	89 d6                	mov    %edx,%esi
+  803938:	48 89 c7             	mov    %rax,%rdi
+  80393b:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+  803947:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80394b:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803952:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  803957:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80395a:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80395d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803961:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803965:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803969:	45 89 c1             	mov    %r8d,%r9d
+  80396c:	41 89 f8             	mov    %edi,%r8d
+  80396f:	48 89 c7             	mov    %rax,%rdi
+  803972:	48 b8 1c 32 80 00 00 	movabs $0x80321c,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+        break;
+  80397e:	eb 3f                	jmp    8039bf <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803980:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803984:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803988:	48 89 c6             	mov    %rax,%rsi
+  80398b:	89 df                	mov    %ebx,%edi
+  80398d:	ff d2                	call   *%rdx
+        break;
+  80398f:	eb 2e                	jmp    8039bf <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803991:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803995:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803999:	48 89 c6             	mov    %rax,%rsi
+  80399c:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039a1:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8039a3:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039a8:	eb 05                	jmp    8039af <vprintfmt+0x4ed>
+  8039aa:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039af:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039b3:	48 83 e8 01          	sub    $0x1,%rax
+  8039b7:	0f b6 00             	movzbl (%rax),%eax
+  8039ba:	3c 25                	cmp    $0x25,%al
+  8039bc:	75 ec                	jne    8039aa <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039be:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039bf:	e9 50 fb ff ff       	jmp    803514 <vprintfmt+0x52>
+        return;
+  8039c4:	90                   	nop
+    }
+  }
+}
+  8039c5:	48 83 c4 60          	add    $0x60,%rsp
+  8039c9:	5b                   	pop    %rbx
+  8039ca:	41 5c                	pop    %r12
+  8039cc:	5d                   	pop    %rbp
+  8039cd:	c3                   	ret
+
+00000000008039ce <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039d9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039e0:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039e7:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039ee:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039f5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039fc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a03:	84 c0                	test   %al,%al
+  803a05:	74 20                	je     803a27 <printfmt+0x59>
+  803a07:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a0b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a0f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a13:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a17:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a1b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a1f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a23:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a27:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a2e:	00 00 00 
+  803a31:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a38:	00 00 00 
+  803a3b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a3f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a46:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a4d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a54:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a5b:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a62:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a69:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a70:	48 89 c7             	mov    %rax,%rdi
+  803a73:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  803a7a:	00 00 00 
+  803a7d:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a7f:	90                   	nop
+  803a80:	c9                   	leave
+  803a81:	c3                   	ret
+
+0000000000803a82 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a82:	55                   	push   %rbp
+  803a83:	48 89 e5             	mov    %rsp,%rbp
+  803a86:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a8d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a95:	8b 40 10             	mov    0x10(%rax),%eax
+  803a98:	8d 50 01             	lea    0x1(%rax),%edx
+  803a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9f:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa6:	48 8b 10             	mov    (%rax),%rdx
+  803aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ab1:	48 39 c2             	cmp    %rax,%rdx
+  803ab4:	73 17                	jae    803acd <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803ab6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aba:	48 8b 00             	mov    (%rax),%rax
+  803abd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ac1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ac5:	48 89 0a             	mov    %rcx,(%rdx)
+  803ac8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803acb:	88 10                	mov    %dl,(%rax)
+}
+  803acd:	90                   	nop
+  803ace:	c9                   	leave
+  803acf:	c3                   	ret
+
+0000000000803ad0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ad0:	55                   	push   %rbp
+  803ad1:	48 89 e5             	mov    %rsp,%rbp
+  803ad4:	48 83 ec 40          	sub    $0x40,%rsp
+  803ad8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803adc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803adf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ae3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803ae7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aeb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803aef:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803af2:	48 98                	cltq
+  803af4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803af8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803afc:	48 01 d0             	add    %rdx,%rax
+  803aff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b03:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b0a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b0f:	74 06                	je     803b17 <vsnprintf+0x47>
+  803b11:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b15:	7f 07                	jg     803b1e <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b1c:	eb 32                	jmp    803b50 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b1e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b22:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b26:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b2a:	48 89 c6             	mov    %rax,%rsi
+  803b2d:	48 b8 82 3a 80 00 00 	movabs $0x803a82,%rax
+  803b34:	00 00 00 
+  803b37:	48 89 c7             	mov    %rax,%rdi
+  803b3a:	48 b8 c2 34 80 00 00 	movabs $0x8034c2,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b4a:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b4d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b50:	c9                   	leave
+  803b51:	c3                   	ret
+
+0000000000803b52 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b52:	55                   	push   %rbp
+  803b53:	48 89 e5             	mov    %rsp,%rbp
+  803b56:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b5d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b64:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b6a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b71:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b78:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b7f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b86:	84 c0                	test   %al,%al
+  803b88:	74 20                	je     803baa <snprintf+0x58>
+  803b8a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b8e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b92:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b96:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b9a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b9e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803ba2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803ba6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803baa:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803bb1:	00 00 00 
+  803bb4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803bbb:	00 00 00 
+  803bbe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bc2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bc9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bd0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bd7:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bde:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803be5:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803beb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bf2:	48 89 c7             	mov    %rax,%rdi
+  803bf5:	48 b8 d0 3a 80 00 00 	movabs $0x803ad0,%rax
+  803bfc:	00 00 00 
+  803bff:	ff d0                	call   *%rax
+  803c01:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c07:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c0d:	c9                   	leave
+  803c0e:	c3                   	ret
+
+0000000000803c0f <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c0f:	55                   	push   %rbp
+  803c10:	48 89 e5             	mov    %rsp,%rbp
+  803c13:	53                   	push   %rbx
+  803c14:	48 83 ec 38          	sub    $0x38,%rsp
+  803c18:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c1b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c1f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c23:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c27:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c2b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c33:	89 d1                	mov    %edx,%ecx
+  803c35:	0f a2                	cpuid
+  803c37:	89 de                	mov    %ebx,%esi
+  803c39:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c3c:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c3f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c42:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c45:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c4a:	74 09                	je     803c55 <cpuid+0x46>
+}
+  803c4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c50:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c53:	89 10                	mov    %edx,(%rax)
+
+  803c55:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c5a:	74 09                	je     803c65 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c60:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c63:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c65:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c6a:	74 09                	je     803c75 <cpuid+0x66>
+char *
+  803c6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c70:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c73:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c75:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c7a:	74 09                	je     803c85 <cpuid+0x76>
+  for (; *s; s++)
+  803c7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c80:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c83:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c85:	90                   	nop
+  803c86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c8a:	c9                   	leave
+  803c8b:	c3                   	ret
+
+0000000000803c8c <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c8c:	55                   	push   %rbp
+  803c8d:	48 89 e5             	mov    %rsp,%rbp
+  803c90:	48 83 ec 18          	sub    $0x18,%rsp
+  803c94:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c9a:	89 c1                	mov    %eax,%ecx
+  803c9c:	0f 01 d0             	xgetbv
+  803c9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ca2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803ca5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ca8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803cab:	48 c1 e2 20          	shl    $0x20,%rdx
+  803caf:	48 09 d0             	or     %rdx,%rax
+#else
+  803cb2:	c9                   	leave
+  803cb3:	c3                   	ret
+
+0000000000803cb4 <string_cpu>:
+string_cpu(void) {
+  803cb4:	55                   	push   %rbp
+  803cb5:	48 89 e5             	mov    %rsp,%rbp
+  803cb8:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803cbc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cc3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cca:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cd1:	00 00 00 
+  803cd4:	8b 00                	mov    (%rax),%eax
+  803cd6:	85 c0                	test   %eax,%eax
+  803cd8:	78 11                	js     803ceb <string_cpu+0x37>
+    return string_features;
+  803cda:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803ce1:	00 00 00 
+  803ce4:	8b 00                	mov    (%rax),%eax
+  803ce6:	e9 df 00 00 00       	jmp    803dca <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803ceb:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cff:	48 89 c6             	mov    %rax,%rsi
+  803d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d07:	48 b8 0f 3c 80 00 00 	movabs $0x803c0f,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d13:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d16:	83 f8 06             	cmp    $0x6,%eax
+  803d19:	76 28                	jbe    803d43 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d1b:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d2a:	48 89 c2             	mov    %rax,%rdx
+  803d2d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d32:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d37:	48 b8 0f 3c 80 00 00 	movabs $0x803c0f,%rax
+  803d3e:	00 00 00 
+  803d41:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d43:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d46:	25 00 02 00 00       	and    $0x200,%eax
+  803d4b:	85 c0                	test   %eax,%eax
+  803d4d:	74 04                	je     803d53 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d4f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d53:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d5d:	48 89 c1             	mov    %rax,%rcx
+  803d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d65:	be 00 00 00 00       	mov    $0x0,%esi
+  803d6a:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d6f:	48 b8 0f 3c 80 00 00 	movabs $0x803c0f,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d7b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d7e:	83 e0 20             	and    $0x20,%eax
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	74 2a                	je     803daf <string_cpu+0xfb>
+  803d85:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d88:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d8d:	85 c0                	test   %eax,%eax
+  803d8f:	74 1e                	je     803daf <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d96:	48 b8 8c 3c 80 00 00 	movabs $0x803c8c,%rax
+  803d9d:	00 00 00 
+  803da0:	ff d0                	call   *%rax
+  803da2:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803da5:	48 83 f8 06          	cmp    $0x6,%rax
+  803da9:	75 04                	jne    803daf <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803dab:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803daf:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803db6:	00 00 00 
+  803db9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dbc:	89 02                	mov    %eax,(%rdx)
+  803dbe:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dc5:	00 00 00 
+  803dc8:	8b 00                	mov    (%rax),%eax
+}
+  803dca:	c9                   	leave
+  803dcb:	c3                   	ret
+
+0000000000803dcc <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803dcc:	55                   	push   %rbp
+  803dcd:	48 89 e5             	mov    %rsp,%rbp
+  803dd0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dd4:	48 83 ec 60          	sub    $0x60,%rsp
+  803dd8:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803ddd:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803de2:	83 e0 1f             	and    $0x1f,%eax
+  803de5:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803de9:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803ded:	48 f7 d8             	neg    %rax
+  803df0:	48 89 c2             	mov    %rax,%rdx
+  803df3:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803df8:	48 01 d0             	add    %rdx,%rax
+  803dfb:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e00:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e04:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e0a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e0f:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e13:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e19:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e1d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e21:	89 c2                	mov    %eax,%edx
+  803e23:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e27:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e2c:	89 c1                	mov    %eax,%ecx
+  803e2e:	d3 e6                	shl    %cl,%esi
+  803e30:	89 f0                	mov    %esi,%eax
+  803e32:	21 d0                	and    %edx,%eax
+  803e34:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e38:	eb 21                	jmp    803e5b <strlen_avx2+0x8f>
+    p += 32;
+  803e3a:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e40:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e45:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e49:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e4f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e53:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e57:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e5b:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e60:	74 d8                	je     803e3a <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e62:	31 c0                	xor    %eax,%eax
+  803e64:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e6a:	48 63 d0             	movslq %eax,%rdx
+  803e6d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e72:	48 01 d0             	add    %rdx,%rax
+  803e75:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e7a:	c9                   	leave
+  803e7b:	c3                   	ret
+
+0000000000803e7c <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e7c:	55                   	push   %rbp
+  803e7d:	48 89 e5             	mov    %rsp,%rbp
+  803e80:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e84:	48 83 ec 40          	sub    $0x40,%rsp
+  803e88:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e8d:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e92:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e97:	eb 77                	jmp    803f10 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e99:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e9e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ea2:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803ea6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803eab:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803eaf:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803eb3:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803eb7:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ebb:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ec0:	74 3c                	je     803efe <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803ec2:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803ec6:	f7 d0                	not    %eax
+  803ec8:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ecc:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ed0:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ed4:	48 63 d0             	movslq %eax,%rdx
+  803ed7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803edc:	48 01 d0             	add    %rdx,%rax
+  803edf:	0f b6 00             	movzbl (%rax),%eax
+  803ee2:	0f b6 c0             	movzbl %al,%eax
+  803ee5:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ee9:	48 63 ca             	movslq %edx,%rcx
+  803eec:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ef1:	48 01 ca             	add    %rcx,%rdx
+  803ef4:	0f b6 12             	movzbl (%rdx),%edx
+  803ef7:	0f b6 d2             	movzbl %dl,%edx
+  803efa:	29 d0                	sub    %edx,%eax
+  803efc:	eb 6b                	jmp    803f69 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803efe:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f04:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f0a:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f10:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f16:	77 81                	ja     803e99 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f18:	eb 42                	jmp    803f5c <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f1a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f1f:	0f b6 10             	movzbl (%rax),%edx
+  803f22:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f27:	0f b6 00             	movzbl (%rax),%eax
+  803f2a:	38 c2                	cmp    %al,%dl
+  803f2c:	74 1c                	je     803f4a <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f2e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f33:	0f b6 00             	movzbl (%rax),%eax
+  803f36:	0f b6 c8             	movzbl %al,%ecx
+  803f39:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f3e:	0f b6 00             	movzbl (%rax),%eax
+  803f41:	0f b6 d0             	movzbl %al,%edx
+  803f44:	89 c8                	mov    %ecx,%eax
+  803f46:	29 d0                	sub    %edx,%eax
+  803f48:	eb 1f                	jmp    803f69 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f4a:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f50:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f56:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f5c:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f62:	75 b6                	jne    803f1a <memcmp_avx2+0x9e>
+  return 0;
+  803f64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f69:	c9                   	leave
+  803f6a:	c3                   	ret
+
+0000000000803f6b <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f6b:	55                   	push   %rbp
+  803f6c:	48 89 e5             	mov    %rsp,%rbp
+  803f6f:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f73:	48 83 ec 60          	sub    $0x60,%rsp
+  803f77:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f7c:	89 f0                	mov    %esi,%eax
+  803f7e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f83:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f87:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f8c:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f90:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f95:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f9b:	eb 47                	jmp    803fe4 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f9d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fa2:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803fa6:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803faa:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fb0:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fb4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fb8:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fbc:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fc1:	74 15                	je     803fd8 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fc3:	31 c0                	xor    %eax,%eax
+  803fc5:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fcb:	48 63 d0             	movslq %eax,%rdx
+  803fce:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fd3:	48 01 d0             	add    %rdx,%rax
+  803fd6:	eb 3d                	jmp    804015 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fd8:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fde:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fe4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fea:	77 b1                	ja     803f9d <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fec:	eb 0c                	jmp    803ffa <memfind_avx2+0x8f>
+  803fee:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803ff4:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803ffa:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804000:	74 0e                	je     804010 <memfind_avx2+0xa5>
+  804002:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804007:	0f b6 00             	movzbl (%rax),%eax
+  80400a:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80400e:	75 de                	jne    803fee <memfind_avx2+0x83>
+  return s;
+  804010:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804015:	c9                   	leave
+  804016:	c3                   	ret
+
+0000000000804017 <strlen>:
+strlen(const char *s) {
+  804017:	55                   	push   %rbp
+  804018:	48 89 e5             	mov    %rsp,%rbp
+  80401b:	48 83 ec 40          	sub    $0x40,%rsp
+  80401f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804023:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804027:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80402b:	48 b8 b4 3c 80 00 00 	movabs $0x803cb4,%rax
+  804032:	00 00 00 
+  804035:	ff d0                	call   *%rax
+  804037:	83 e0 02             	and    $0x2,%eax
+  80403a:	85 c0                	test   %eax,%eax
+  80403c:	74 18                	je     804056 <strlen+0x3f>
+    return strlen_avx2(s);
+  80403e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804042:	48 89 c7             	mov    %rax,%rdi
+  804045:	48 b8 cc 3d 80 00 00 	movabs $0x803dcc,%rax
+  80404c:	00 00 00 
+  80404f:	ff d0                	call   *%rax
+  804051:	e9 82 00 00 00       	jmp    8040d8 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  804056:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405a:	83 e0 0f             	and    $0xf,%eax
+  80405d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804060:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804063:	48 f7 d8             	neg    %rax
+  804066:	48 89 c2             	mov    %rax,%rdx
+  804069:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80406d:	48 01 d0             	add    %rdx,%rax
+  804070:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804074:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804078:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80407c:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804081:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804085:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804089:	89 c2                	mov    %eax,%edx
+  80408b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80408e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804093:	89 c1                	mov    %eax,%ecx
+  804095:	d3 e6                	shl    %cl,%esi
+  804097:	89 f0                	mov    %esi,%eax
+  804099:	21 d0                	and    %edx,%eax
+  80409b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80409e:	eb 1d                	jmp    8040bd <strlen+0xa6>
+    p += 16;
+  8040a0:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8040a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040a9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040ad:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040b2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040b6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040c1:	74 dd                	je     8040a0 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040c3:	31 c0                	xor    %eax,%eax
+  8040c5:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040ca:	48 63 d0             	movslq %eax,%rdx
+  8040cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d1:	48 01 d0             	add    %rdx,%rax
+  8040d4:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040d8:	c9                   	leave
+  8040d9:	c3                   	ret
+
+00000000008040da <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040da:	55                   	push   %rbp
+  8040db:	48 89 e5             	mov    %rsp,%rbp
+  8040de:	48 83 ec 20          	sub    $0x20,%rsp
+  8040e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040e6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040ea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040f1:	eb 0e                	jmp    804101 <strnlen+0x27>
+    n++;
+  8040f3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040f7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040fc:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804101:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804106:	74 0b                	je     804113 <strnlen+0x39>
+  804108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80410c:	0f b6 00             	movzbl (%rax),%eax
+  80410f:	84 c0                	test   %al,%al
+  804111:	75 e0                	jne    8040f3 <strnlen+0x19>
+  return n;
+  804113:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804116:	c9                   	leave
+  804117:	c3                   	ret
+
+0000000000804118 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804118:	55                   	push   %rbp
+  804119:	48 89 e5             	mov    %rsp,%rbp
+  80411c:	48 83 ec 20          	sub    $0x20,%rsp
+  804120:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804124:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804128:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80412c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804130:	90                   	nop
+  804131:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804135:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804139:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80413d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804141:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804145:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804149:	0f b6 12             	movzbl (%rdx),%edx
+  80414c:	88 10                	mov    %dl,(%rax)
+  80414e:	0f b6 00             	movzbl (%rax),%eax
+  804151:	84 c0                	test   %al,%al
+  804153:	75 dc                	jne    804131 <strcpy+0x19>
+  return ret;
+  804155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804159:	c9                   	leave
+  80415a:	c3                   	ret
+
+000000000080415b <strcat>:
+strcat(char *dst, const char *src) {
+  80415b:	55                   	push   %rbp
+  80415c:	48 89 e5             	mov    %rsp,%rbp
+  80415f:	48 83 ec 20          	sub    $0x20,%rsp
+  804163:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804167:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80416b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416f:	48 89 c7             	mov    %rax,%rdi
+  804172:	48 b8 17 40 80 00 00 	movabs $0x804017,%rax
+  804179:	00 00 00 
+  80417c:	ff d0                	call   *%rax
+  80417e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804181:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804184:	48 63 d0             	movslq %eax,%rdx
+  804187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418b:	48 01 c2             	add    %rax,%rdx
+  80418e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804192:	48 89 c6             	mov    %rax,%rsi
+  804195:	48 89 d7             	mov    %rdx,%rdi
+  804198:	48 b8 18 41 80 00 00 	movabs $0x804118,%rax
+  80419f:	00 00 00 
+  8041a2:	ff d0                	call   *%rax
+  return dst;
+  8041a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8041a8:	c9                   	leave
+  8041a9:	c3                   	ret
+
+00000000008041aa <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8041aa:	55                   	push   %rbp
+  8041ab:	48 89 e5             	mov    %rsp,%rbp
+  8041ae:	48 83 ec 28          	sub    $0x28,%rsp
+  8041b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041ba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041c6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041cd:	00 
+  8041ce:	eb 2a                	jmp    8041fa <strncpy+0x50>
+    *dst++ = *src;
+  8041d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041d8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041e0:	0f b6 12             	movzbl (%rdx),%edx
+  8041e3:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e9:	0f b6 00             	movzbl (%rax),%eax
+  8041ec:	84 c0                	test   %al,%al
+  8041ee:	74 05                	je     8041f5 <strncpy+0x4b>
+      src++;
+  8041f0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041f5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041fe:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804202:	72 cc                	jb     8041d0 <strncpy+0x26>
+  return ret;
+  804204:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804208:	c9                   	leave
+  804209:	c3                   	ret
+
+000000000080420a <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80420a:	55                   	push   %rbp
+  80420b:	48 89 e5             	mov    %rsp,%rbp
+  80420e:	48 83 ec 28          	sub    $0x28,%rsp
+  804212:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804216:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80421a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80421e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804222:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804226:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80422b:	74 3d                	je     80426a <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80422d:	eb 1d                	jmp    80424c <strlcpy+0x42>
+      *dst++ = *src++;
+  80422f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804233:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804237:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80423b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80423f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804243:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804247:	0f b6 12             	movzbl (%rdx),%edx
+  80424a:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80424c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804251:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804256:	74 0b                	je     804263 <strlcpy+0x59>
+  804258:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80425c:	0f b6 00             	movzbl (%rax),%eax
+  80425f:	84 c0                	test   %al,%al
+  804261:	75 cc                	jne    80422f <strlcpy+0x25>
+    *dst = '\0';
+  804263:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804267:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80426a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80426e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804272:	c9                   	leave
+  804273:	c3                   	ret
+
+0000000000804274 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804274:	55                   	push   %rbp
+  804275:	48 89 e5             	mov    %rsp,%rbp
+  804278:	48 83 ec 30          	sub    $0x30,%rsp
+  80427c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804280:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804284:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  804288:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80428c:	48 89 c7             	mov    %rax,%rdi
+  80428f:	48 b8 17 40 80 00 00 	movabs $0x804017,%rax
+  804296:	00 00 00 
+  804299:	ff d0                	call   *%rax
+  80429b:	48 98                	cltq
+  80429d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8042a1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a9:	48 89 d6             	mov    %rdx,%rsi
+  8042ac:	48 89 c7             	mov    %rax,%rdi
+  8042af:	48 b8 da 40 80 00 00 	movabs $0x8040da,%rax
+  8042b6:	00 00 00 
+  8042b9:	ff d0                	call   *%rax
+  8042bb:	48 98                	cltq
+  8042bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042c5:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042c9:	75 10                	jne    8042db <strlcat+0x67>
+    return maxlen + srclen;
+  8042cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d3:	48 01 d0             	add    %rdx,%rax
+  8042d6:	e9 86 00 00 00       	jmp    804361 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042df:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042e3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042e7:	73 2b                	jae    804314 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042f1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f9:	48 01 c1             	add    %rax,%rcx
+  8042fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804300:	48 89 c6             	mov    %rax,%rsi
+  804303:	48 89 cf             	mov    %rcx,%rdi
+  804306:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  80430d:	00 00 00 
+  804310:	ff d0                	call   *%rax
+  804312:	eb 42                	jmp    804356 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804314:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804318:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80431c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804320:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804324:	48 01 c1             	add    %rax,%rcx
+  804327:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80432b:	48 89 c6             	mov    %rax,%rsi
+  80432e:	48 89 cf             	mov    %rcx,%rdi
+  804331:	48 b8 61 48 80 00 00 	movabs $0x804861,%rax
+  804338:	00 00 00 
+  80433b:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80433d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804341:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804345:	48 01 d0             	add    %rdx,%rax
+  804348:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80434c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804350:	48 01 d0             	add    %rdx,%rax
+  804353:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  804356:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80435a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435e:	48 01 d0             	add    %rdx,%rax
+}
+  804361:	c9                   	leave
+  804362:	c3                   	ret
+
+0000000000804363 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804363:	55                   	push   %rbp
+  804364:	48 89 e5             	mov    %rsp,%rbp
+  804367:	48 83 ec 10          	sub    $0x10,%rsp
+  80436b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80436f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804373:	eb 0a                	jmp    80437f <strcmp+0x1c>
+    p++, q++;
+  804375:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80437a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80437f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804383:	0f b6 00             	movzbl (%rax),%eax
+  804386:	84 c0                	test   %al,%al
+  804388:	74 12                	je     80439c <strcmp+0x39>
+  80438a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80438e:	0f b6 10             	movzbl (%rax),%edx
+  804391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804395:	0f b6 00             	movzbl (%rax),%eax
+  804398:	38 c2                	cmp    %al,%dl
+  80439a:	74 d9                	je     804375 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80439c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043a0:	0f b6 00             	movzbl (%rax),%eax
+  8043a3:	0f b6 d0             	movzbl %al,%edx
+  8043a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043aa:	0f b6 00             	movzbl (%rax),%eax
+  8043ad:	0f b6 c0             	movzbl %al,%eax
+  8043b0:	29 c2                	sub    %eax,%edx
+  8043b2:	89 d0                	mov    %edx,%eax
+}
+  8043b4:	c9                   	leave
+  8043b5:	c3                   	ret
+
+00000000008043b6 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043b6:	55                   	push   %rbp
+  8043b7:	48 89 e5             	mov    %rsp,%rbp
+  8043ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8043be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043c6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043ca:	eb 0f                	jmp    8043db <strncmp+0x25>
+    n--, p++, q++;
+  8043cc:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043d1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043d6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043db:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043e0:	74 1d                	je     8043ff <strncmp+0x49>
+  8043e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e6:	0f b6 00             	movzbl (%rax),%eax
+  8043e9:	84 c0                	test   %al,%al
+  8043eb:	74 12                	je     8043ff <strncmp+0x49>
+  8043ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f1:	0f b6 10             	movzbl (%rax),%edx
+  8043f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043f8:	0f b6 00             	movzbl (%rax),%eax
+  8043fb:	38 c2                	cmp    %al,%dl
+  8043fd:	74 cd                	je     8043cc <strncmp+0x16>
+  if (n == 0)
+  8043ff:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804404:	75 07                	jne    80440d <strncmp+0x57>
+    return 0;
+  804406:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440b:	eb 16                	jmp    804423 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80440d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804411:	0f b6 00             	movzbl (%rax),%eax
+  804414:	0f b6 d0             	movzbl %al,%edx
+  804417:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441b:	0f b6 00             	movzbl (%rax),%eax
+  80441e:	0f b6 c0             	movzbl %al,%eax
+  804421:	29 c2                	sub    %eax,%edx
+}
+  804423:	89 d0                	mov    %edx,%eax
+  804425:	c9                   	leave
+  804426:	c3                   	ret
+
+0000000000804427 <strchr>:
+strchr(const char *s, char c) {
+  804427:	55                   	push   %rbp
+  804428:	48 89 e5             	mov    %rsp,%rbp
+  80442b:	48 83 ec 60          	sub    $0x60,%rsp
+  80442f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804433:	89 f0                	mov    %esi,%eax
+  804435:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804438:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80443c:	83 e0 0f             	and    $0xf,%eax
+  80443f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804442:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804445:	48 f7 d8             	neg    %rax
+  804448:	48 89 c2             	mov    %rax,%rdx
+  80444b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80444f:	48 01 d0             	add    %rdx,%rax
+  804452:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  804456:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80445a:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80445e:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804462:	66 0f 6e c0          	movd   %eax,%xmm0
+  804466:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80446a:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80446e:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804473:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  804477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80447b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80447f:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804483:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804488:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80448d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804491:	89 c2                	mov    %eax,%edx
+  804493:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804498:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80449d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044a1:	09 c2                	or     %eax,%edx
+  8044a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044a6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8044ab:	89 c1                	mov    %eax,%ecx
+  8044ad:	d3 e6                	shl    %cl,%esi
+  8044af:	89 f0                	mov    %esi,%eax
+  8044b1:	21 d0                	and    %edx,%eax
+  8044b3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044b6:	eb 34                	jmp    8044ec <strchr+0xc5>
+    p += 16;
+  8044b8:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044c1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044c5:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044c9:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044ce:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044d3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044d7:	89 c2                	mov    %eax,%edx
+  8044d9:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044de:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044e3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044e7:	09 d0                	or     %edx,%eax
+  8044e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044f0:	74 c6                	je     8044b8 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044f2:	31 c0                	xor    %eax,%eax
+  8044f4:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044f9:	48 98                	cltq
+  8044fb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804503:	0f b6 00             	movzbl (%rax),%eax
+  804506:	84 c0                	test   %al,%al
+  804508:	74 06                	je     804510 <strchr+0xe9>
+  80450a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80450e:	eb 05                	jmp    804515 <strchr+0xee>
+  804510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804515:	c9                   	leave
+  804516:	c3                   	ret
+
+0000000000804517 <strfind>:
+strfind(const char *s, char c) {
+  804517:	55                   	push   %rbp
+  804518:	48 89 e5             	mov    %rsp,%rbp
+  80451b:	48 83 ec 10          	sub    $0x10,%rsp
+  80451f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804523:	89 f0                	mov    %esi,%eax
+  804525:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804528:	eb 11                	jmp    80453b <strfind+0x24>
+    if (*s == c)
+  80452a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80452e:	0f b6 00             	movzbl (%rax),%eax
+  804531:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804534:	74 12                	je     804548 <strfind+0x31>
+  for (; *s; s++)
+  804536:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80453b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80453f:	0f b6 00             	movzbl (%rax),%eax
+  804542:	84 c0                	test   %al,%al
+  804544:	75 e4                	jne    80452a <strfind+0x13>
+  804546:	eb 01                	jmp    804549 <strfind+0x32>
+      break;
+  804548:	90                   	nop
+  return (char *)s;
+  804549:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80454d:	c9                   	leave
+  80454e:	c3                   	ret
+
+000000000080454f <memset>:
+memset(void *v, int c, size_t n) {
+  80454f:	55                   	push   %rbp
+  804550:	48 89 e5             	mov    %rsp,%rbp
+  804553:	48 83 ec 38          	sub    $0x38,%rsp
+  804557:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80455b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80455e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804562:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804566:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80456a:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80456f:	76 41                	jbe    8045b2 <memset+0x63>
+  804571:	48 b8 b4 3c 80 00 00 	movabs $0x803cb4,%rax
+  804578:	00 00 00 
+  80457b:	ff d0                	call   *%rax
+  80457d:	83 e0 01             	and    $0x1,%eax
+  804580:	85 c0                	test   %eax,%eax
+  804582:	74 2e                	je     8045b2 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804584:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804587:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80458b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80458f:	48 89 ce             	mov    %rcx,%rsi
+  804592:	48 89 f7             	mov    %rsi,%rdi
+  804595:	48 89 d1             	mov    %rdx,%rcx
+  804598:	fc                   	cld
+  804599:	f3 aa                	rep stos %al,%es:(%rdi)
+  80459b:	48 89 ca             	mov    %rcx,%rdx
+  80459e:	48 89 fe             	mov    %rdi,%rsi
+  8045a1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8045a5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8045a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045ad:	e9 a7 00 00 00       	jmp    804659 <memset+0x10a>
+  if (n >= 8) {
+  8045b2:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045b7:	0f 86 87 00 00 00    	jbe    804644 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045bd:	eb 16                	jmp    8045d5 <memset+0x86>
+      *p++ = c;
+  8045bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045c7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045cb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045ce:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045d0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d9:	83 e0 07             	and    $0x7,%eax
+  8045dc:	48 85 c0             	test   %rax,%rax
+  8045df:	75 de                	jne    8045bf <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045e1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045e4:	0f b6 c0             	movzbl %al,%eax
+  8045e7:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045ee:	01 01 01 
+  8045f1:	48 0f af c2          	imul   %rdx,%rax
+  8045f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045fd:	48 c1 e8 03          	shr    $0x3,%rax
+  804601:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  804605:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804609:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80460d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804611:	48 89 ce             	mov    %rcx,%rsi
+  804614:	48 89 f7             	mov    %rsi,%rdi
+  804617:	48 89 d1             	mov    %rdx,%rcx
+  80461a:	fc                   	cld
+  80461b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80461e:	48 89 ca             	mov    %rcx,%rdx
+  804621:	48 89 fe             	mov    %rdi,%rsi
+  804624:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804628:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80462c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804631:	eb 11                	jmp    804644 <memset+0xf5>
+    *p++ = c;
+  804633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804637:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80463b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80463f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804642:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804644:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804648:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80464c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804650:	48 85 c0             	test   %rax,%rax
+  804653:	75 de                	jne    804633 <memset+0xe4>
+  return v;
+  804655:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804659:	c9                   	leave
+  80465a:	c3                   	ret
+
+000000000080465b <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80465b:	55                   	push   %rbp
+  80465c:	48 89 e5             	mov    %rsp,%rbp
+  80465f:	48 83 ec 38          	sub    $0x38,%rsp
+  804663:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804667:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80466b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80466f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804673:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  804677:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80467b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80467f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804683:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804687:	0f 83 da 00 00 00    	jae    804767 <memmove+0x10c>
+  80468d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804691:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804695:	48 01 d0             	add    %rdx,%rax
+  804698:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80469c:	0f 83 c5 00 00 00    	jae    804767 <memmove+0x10c>
+    s += n;
+  8046a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8046aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ae:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046b2:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046b7:	0f 86 94 00 00 00    	jbe    804751 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046bd:	eb 1c                	jmp    8046db <memmove+0x80>
+        *--d = *--s;
+  8046bf:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046c4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046cd:	0f b6 10             	movzbl (%rax),%edx
+  8046d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d4:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046d6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046df:	83 e0 07             	and    $0x7,%eax
+  8046e2:	48 85 c0             	test   %rax,%rax
+  8046e5:	75 d8                	jne    8046bf <memmove+0x64>
+      nq = n / 8;
+  8046e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046eb:	48 c1 e8 03          	shr    $0x3,%rax
+  8046ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046f3:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046f8:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046fd:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  804702:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804706:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80470a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80470e:	48 89 cf             	mov    %rcx,%rdi
+  804711:	48 89 d6             	mov    %rdx,%rsi
+  804714:	48 89 c1             	mov    %rax,%rcx
+  804717:	fd                   	std
+  804718:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80471b:	fc                   	cld
+  80471c:	48 89 c8             	mov    %rcx,%rax
+  80471f:	48 89 f2             	mov    %rsi,%rdx
+  804722:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804726:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80472a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80472e:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804733:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804738:	eb 17                	jmp    804751 <memmove+0xf6>
+      *--d = *--s;
+  80473a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80473f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804744:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804748:	0f b6 10             	movzbl (%rax),%edx
+  80474b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80474f:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804751:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804755:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804759:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80475d:	48 85 c0             	test   %rax,%rax
+  804760:	75 d8                	jne    80473a <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804762:	e9 f4 00 00 00       	jmp    80485b <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804767:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80476c:	76 46                	jbe    8047b4 <memmove+0x159>
+  80476e:	48 b8 b4 3c 80 00 00 	movabs $0x803cb4,%rax
+  804775:	00 00 00 
+  804778:	ff d0                	call   *%rax
+  80477a:	83 e0 01             	and    $0x1,%eax
+  80477d:	85 c0                	test   %eax,%eax
+  80477f:	74 33                	je     8047b4 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804781:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804785:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804789:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80478d:	48 89 cf             	mov    %rcx,%rdi
+  804790:	48 89 d6             	mov    %rdx,%rsi
+  804793:	48 89 c1             	mov    %rax,%rcx
+  804796:	fc                   	cld
+  804797:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804799:	48 89 c8             	mov    %rcx,%rax
+  80479c:	48 89 f2             	mov    %rsi,%rdx
+  80479f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8047a3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8047a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8047ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047af:	e9 ab 00 00 00       	jmp    80485f <memmove+0x204>
+    if (n >= 8) {
+  8047b4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047b9:	0f 86 8b 00 00 00    	jbe    80484a <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047bf:	eb 22                	jmp    8047e3 <memmove+0x188>
+        *d++ = *s++;
+  8047c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047c5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047d5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047d9:	0f b6 12             	movzbl (%rdx),%edx
+  8047dc:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047de:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047e7:	83 e0 07             	and    $0x7,%eax
+  8047ea:	48 85 c0             	test   %rax,%rax
+  8047ed:	75 d2                	jne    8047c1 <memmove+0x166>
+      nq = n / 8;
+  8047ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047f3:	48 c1 e8 03          	shr    $0x3,%rax
+  8047f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047fb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804803:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804807:	48 89 cf             	mov    %rcx,%rdi
+  80480a:	48 89 d6             	mov    %rdx,%rsi
+  80480d:	48 89 c1             	mov    %rax,%rcx
+  804810:	fc                   	cld
+  804811:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804814:	48 89 c8             	mov    %rcx,%rax
+  804817:	48 89 f2             	mov    %rsi,%rdx
+  80481a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80481e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804822:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804826:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80482b:	eb 1d                	jmp    80484a <memmove+0x1ef>
+      *d++ = *s++;
+  80482d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804831:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804835:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80483d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804841:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804845:	0f b6 12             	movzbl (%rdx),%edx
+  804848:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80484a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80484e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804852:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804856:	48 85 c0             	test   %rax,%rax
+  804859:	75 d2                	jne    80482d <memmove+0x1d2>
+  return dst;
+  80485b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80485f:	c9                   	leave
+  804860:	c3                   	ret
+
+0000000000804861 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804861:	55                   	push   %rbp
+  804862:	48 89 e5             	mov    %rsp,%rbp
+  804865:	48 83 ec 18          	sub    $0x18,%rsp
+  804869:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80486d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804871:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804875:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804879:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80487d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804881:	48 89 ce             	mov    %rcx,%rsi
+  804884:	48 89 c7             	mov    %rax,%rdi
+  804887:	48 b8 5b 46 80 00 00 	movabs $0x80465b,%rax
+  80488e:	00 00 00 
+  804891:	ff d0                	call   *%rax
+}
+  804893:	c9                   	leave
+  804894:	c3                   	ret
+
+0000000000804895 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804895:	55                   	push   %rbp
+  804896:	48 89 e5             	mov    %rsp,%rbp
+  804899:	48 83 ec 40          	sub    $0x40,%rsp
+  80489d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048a1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048a5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8048a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048b9:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048be:	0f 86 a7 00 00 00    	jbe    80496b <memcmp+0xd6>
+  8048c4:	48 b8 b4 3c 80 00 00 	movabs $0x803cb4,%rax
+  8048cb:	00 00 00 
+  8048ce:	ff d0                	call   *%rax
+  8048d0:	83 e0 02             	and    $0x2,%eax
+  8048d3:	85 c0                	test   %eax,%eax
+  8048d5:	0f 84 90 00 00 00    	je     80496b <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048db:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048df:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048e7:	48 89 ce             	mov    %rcx,%rsi
+  8048ea:	48 89 c7             	mov    %rax,%rdi
+  8048ed:	48 b8 7c 3e 80 00 00 	movabs $0x803e7c,%rax
+  8048f4:	00 00 00 
+  8048f7:	ff d0                	call   *%rax
+  8048f9:	e9 c2 00 00 00       	jmp    8049c0 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804902:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804906:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80490a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80490e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804912:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804916:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80491a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80491d:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804924:	74 36                	je     80495c <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804926:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804929:	f7 d0                	not    %eax
+  80492b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80492f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804932:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804935:	48 63 d0             	movslq %eax,%rdx
+  804938:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493c:	48 01 d0             	add    %rdx,%rax
+  80493f:	0f b6 00             	movzbl (%rax),%eax
+  804942:	0f b6 c0             	movzbl %al,%eax
+  804945:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804948:	48 63 ca             	movslq %edx,%rcx
+  80494b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80494f:	48 01 ca             	add    %rcx,%rdx
+  804952:	0f b6 12             	movzbl (%rdx),%edx
+  804955:	0f b6 d2             	movzbl %dl,%edx
+  804958:	29 d0                	sub    %edx,%eax
+  80495a:	eb 64                	jmp    8049c0 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80495c:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804961:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804966:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80496b:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804970:	77 8c                	ja     8048fe <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804972:	eb 36                	jmp    8049aa <memcmp+0x115>
+    if (*s1 != *s2)
+  804974:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804978:	0f b6 10             	movzbl (%rax),%edx
+  80497b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497f:	0f b6 00             	movzbl (%rax),%eax
+  804982:	38 c2                	cmp    %al,%dl
+  804984:	74 1a                	je     8049a0 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804986:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498a:	0f b6 00             	movzbl (%rax),%eax
+  80498d:	0f b6 c8             	movzbl %al,%ecx
+  804990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804994:	0f b6 00             	movzbl (%rax),%eax
+  804997:	0f b6 d0             	movzbl %al,%edx
+  80499a:	89 c8                	mov    %ecx,%eax
+  80499c:	29 d0                	sub    %edx,%eax
+  80499e:	eb 20                	jmp    8049c0 <memcmp+0x12b>
+    s1++, s2++;
+  8049a0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8049a5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8049aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049ae:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049b6:	48 85 c0             	test   %rax,%rax
+  8049b9:	75 b9                	jne    804974 <memcmp+0xdf>
+  }
+
+  return 0;
+  8049bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049c0:	c9                   	leave
+  8049c1:	c3                   	ret
+
+00000000008049c2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049c2:	55                   	push   %rbp
+  8049c3:	48 89 e5             	mov    %rsp,%rbp
+  8049c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8049ca:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049ce:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049d1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049d5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049d9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049dd:	48 01 d0             	add    %rdx,%rax
+  8049e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049e4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049e7:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049eb:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049ef:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049f3:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049f8:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049fc:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a01:	76 73                	jbe    804a76 <memfind+0xb4>
+  804a03:	48 b8 b4 3c 80 00 00 	movabs $0x803cb4,%rax
+  804a0a:	00 00 00 
+  804a0d:	ff d0                	call   *%rax
+  804a0f:	83 e0 02             	and    $0x2,%eax
+  804a12:	85 c0                	test   %eax,%eax
+  804a14:	74 60                	je     804a76 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a16:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a19:	0f b6 c8             	movzbl %al,%ecx
+  804a1c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a24:	89 ce                	mov    %ecx,%esi
+  804a26:	48 89 c7             	mov    %rax,%rdi
+  804a29:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  804a30:	00 00 00 
+  804a33:	ff d0                	call   *%rax
+  804a35:	eb 6c                	jmp    804aa3 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a3b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a3f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a43:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a48:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a4c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a50:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a53:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a57:	74 13                	je     804a6c <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a59:	31 c0                	xor    %eax,%eax
+  804a5b:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a60:	48 63 d0             	movslq %eax,%rdx
+  804a63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a67:	48 01 d0             	add    %rdx,%rax
+  804a6a:	eb 37                	jmp    804aa3 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a6c:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a71:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a76:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a7b:	77 ba                	ja     804a37 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a7d:	eb 13                	jmp    804a92 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a83:	0f b6 00             	movzbl (%rax),%eax
+  804a86:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a89:	38 d0                	cmp    %dl,%al
+  804a8b:	74 11                	je     804a9e <memfind+0xdc>
+  for (; s < ends; s++)
+  804a8d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a96:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a9a:	72 e3                	jb     804a7f <memfind+0xbd>
+  804a9c:	eb 01                	jmp    804a9f <memfind+0xdd>
+      break;
+  804a9e:	90                   	nop
+  return (void *)s;
+  804a9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804aa3:	c9                   	leave
+  804aa4:	c3                   	ret
+
+0000000000804aa5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804aa5:	55                   	push   %rbp
+  804aa6:	48 89 e5             	mov    %rsp,%rbp
+  804aa9:	48 83 ec 38          	sub    $0x38,%rsp
+  804aad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ab1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ab5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804ab8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804abf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ac6:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804ac7:	eb 05                	jmp    804ace <strtol+0x29>
+    s++;
+  804ac9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ace:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad2:	0f b6 00             	movzbl (%rax),%eax
+  804ad5:	3c 20                	cmp    $0x20,%al
+  804ad7:	74 f0                	je     804ac9 <strtol+0x24>
+  804ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804add:	0f b6 00             	movzbl (%rax),%eax
+  804ae0:	3c 09                	cmp    $0x9,%al
+  804ae2:	74 e5                	je     804ac9 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ae4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae8:	0f b6 00             	movzbl (%rax),%eax
+  804aeb:	3c 2b                	cmp    $0x2b,%al
+  804aed:	75 07                	jne    804af6 <strtol+0x51>
+    s++;
+  804aef:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804af4:	eb 17                	jmp    804b0d <strtol+0x68>
+  else if (*s == '-')
+  804af6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804afa:	0f b6 00             	movzbl (%rax),%eax
+  804afd:	3c 2d                	cmp    $0x2d,%al
+  804aff:	75 0c                	jne    804b0d <strtol+0x68>
+    s++, neg = 1;
+  804b01:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b06:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b0d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b11:	74 06                	je     804b19 <strtol+0x74>
+  804b13:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b17:	75 28                	jne    804b41 <strtol+0x9c>
+  804b19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b1d:	0f b6 00             	movzbl (%rax),%eax
+  804b20:	3c 30                	cmp    $0x30,%al
+  804b22:	75 1d                	jne    804b41 <strtol+0x9c>
+  804b24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b28:	48 83 c0 01          	add    $0x1,%rax
+  804b2c:	0f b6 00             	movzbl (%rax),%eax
+  804b2f:	3c 78                	cmp    $0x78,%al
+  804b31:	75 0e                	jne    804b41 <strtol+0x9c>
+    s += 2, base = 16;
+  804b33:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b38:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b3f:	eb 2c                	jmp    804b6d <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b41:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b45:	75 19                	jne    804b60 <strtol+0xbb>
+  804b47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b4b:	0f b6 00             	movzbl (%rax),%eax
+  804b4e:	3c 30                	cmp    $0x30,%al
+  804b50:	75 0e                	jne    804b60 <strtol+0xbb>
+    s++, base = 8;
+  804b52:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b57:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b5e:	eb 0d                	jmp    804b6d <strtol+0xc8>
+  else if (base == 0)
+  804b60:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b64:	75 07                	jne    804b6d <strtol+0xc8>
+    base = 10;
+  804b66:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b71:	0f b6 00             	movzbl (%rax),%eax
+  804b74:	3c 2f                	cmp    $0x2f,%al
+  804b76:	7e 1d                	jle    804b95 <strtol+0xf0>
+  804b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b7c:	0f b6 00             	movzbl (%rax),%eax
+  804b7f:	3c 39                	cmp    $0x39,%al
+  804b81:	7f 12                	jg     804b95 <strtol+0xf0>
+      dig = *s - '0';
+  804b83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b87:	0f b6 00             	movzbl (%rax),%eax
+  804b8a:	0f be c0             	movsbl %al,%eax
+  804b8d:	83 e8 30             	sub    $0x30,%eax
+  804b90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b93:	eb 4e                	jmp    804be3 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b99:	0f b6 00             	movzbl (%rax),%eax
+  804b9c:	3c 60                	cmp    $0x60,%al
+  804b9e:	7e 1d                	jle    804bbd <strtol+0x118>
+  804ba0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba4:	0f b6 00             	movzbl (%rax),%eax
+  804ba7:	3c 7a                	cmp    $0x7a,%al
+  804ba9:	7f 12                	jg     804bbd <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804bab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804baf:	0f b6 00             	movzbl (%rax),%eax
+  804bb2:	0f be c0             	movsbl %al,%eax
+  804bb5:	83 e8 57             	sub    $0x57,%eax
+  804bb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbb:	eb 26                	jmp    804be3 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804bbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc1:	0f b6 00             	movzbl (%rax),%eax
+  804bc4:	3c 40                	cmp    $0x40,%al
+  804bc6:	7e 47                	jle    804c0f <strtol+0x16a>
+  804bc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bcc:	0f b6 00             	movzbl (%rax),%eax
+  804bcf:	3c 5a                	cmp    $0x5a,%al
+  804bd1:	7f 3c                	jg     804c0f <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bd7:	0f b6 00             	movzbl (%rax),%eax
+  804bda:	0f be c0             	movsbl %al,%eax
+  804bdd:	83 e8 37             	sub    $0x37,%eax
+  804be0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804be3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804be9:	7d 23                	jge    804c0e <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804beb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bf0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bf3:	48 98                	cltq
+  804bf5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bfa:	48 89 c2             	mov    %rax,%rdx
+  804bfd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c00:	48 98                	cltq
+  804c02:	48 01 d0             	add    %rdx,%rax
+  804c05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c09:	e9 5f ff ff ff       	jmp    804b6d <strtol+0xc8>
+      break;
+  804c0e:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c0f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c14:	74 0b                	je     804c21 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c1a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c1e:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c25:	74 09                	je     804c30 <strtol+0x18b>
+  804c27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c2b:	48 f7 d8             	neg    %rax
+  804c2e:	eb 04                	jmp    804c34 <strtol+0x18f>
+  804c30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c34:	c9                   	leave
+  804c35:	c3                   	ret
+
+0000000000804c36 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c36:	55                   	push   %rbp
+  804c37:	48 89 e5             	mov    %rsp,%rbp
+  804c3a:	48 83 ec 20          	sub    $0x20,%rsp
+  804c3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c46:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c4e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c56:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c5d:	48 89 c7             	mov    %rax,%rdi
+  804c60:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  804c67:	00 00 00 
+  804c6a:	ff d0                	call   *%rax
+}
+  804c6c:	c9                   	leave
+  804c6d:	c3                   	ret
+
+0000000000804c6e <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c6e:	55                   	push   %rbp
+  804c6f:	48 89 e5             	mov    %rsp,%rbp
+  804c72:	48 83 ec 30          	sub    $0x30,%rsp
+  804c76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c7a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c7e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c82:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c86:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c8b:	75 0e                	jne    804c9b <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c8d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c94:	00 00 00 
+  804c97:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c9b:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804ca0:	75 18                	jne    804cba <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804ca2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca6:	48 89 c7             	mov    %rax,%rdi
+  804ca9:	48 b8 f9 05 80 00 00 	movabs $0x8005f9,%rax
+  804cb0:	00 00 00 
+  804cb3:	ff d0                	call   *%rax
+  804cb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cb8:	eb 1d                	jmp    804cd7 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cba:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cbe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cc2:	48 89 d6             	mov    %rdx,%rsi
+  804cc5:	48 89 c7             	mov    %rax,%rdi
+  804cc8:	48 b8 3f 06 80 00 00 	movabs $0x80063f,%rax
+  804ccf:	00 00 00 
+  804cd2:	ff d0                	call   *%rax
+  804cd4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cd7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cdb:	79 2a                	jns    804d07 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cdd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ce2:	74 0a                	je     804cee <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ce4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ce8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cee:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cf3:	74 0a                	je     804cff <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cf5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cf9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d02:	e9 aa 00 00 00       	jmp    804db1 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d07:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d0c:	74 36                	je     804d44 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d0e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d15:	00 00 00 
+  804d18:	8b 40 04             	mov    0x4(%rax),%eax
+  804d1b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d20:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d27:	00 00 00 
+  804d2a:	48 98                	cltq
+  804d2c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d33:	48 01 d0             	add    %rdx,%rax
+  804d36:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d3c:	8b 10                	mov    (%rax),%edx
+  804d3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d42:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d44:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d49:	74 36                	je     804d81 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d4b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d52:	00 00 00 
+  804d55:	8b 40 04             	mov    0x4(%rax),%eax
+  804d58:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d5d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d64:	00 00 00 
+  804d67:	48 98                	cltq
+  804d69:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d70:	48 01 d0             	add    %rdx,%rax
+  804d73:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d79:	8b 10                	mov    (%rax),%edx
+  804d7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d7f:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d81:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d88:	00 00 00 
+  804d8b:	8b 40 04             	mov    0x4(%rax),%eax
+  804d8e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d93:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d9a:	00 00 00 
+  804d9d:	48 98                	cltq
+  804d9f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804da6:	48 01 d0             	add    %rdx,%rax
+  804da9:	48 05 20 01 00 00    	add    $0x120,%rax
+  804daf:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804db1:	c9                   	leave
+  804db2:	c3                   	ret
+
+0000000000804db3 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804db3:	55                   	push   %rbp
+  804db4:	48 89 e5             	mov    %rsp,%rbp
+  804db7:	48 83 ec 30          	sub    $0x30,%rsp
+  804dbb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dbe:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dc1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dc5:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dc8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dcd:	75 5e                	jne    804e2d <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dcf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dd6:	00 00 00 
+  804dd9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804ddd:	eb 4e                	jmp    804e2d <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804ddf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804de3:	79 3c                	jns    804e21 <ipc_send+0x6e>
+  804de5:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804de9:	74 36                	je     804e21 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dee:	89 c1                	mov    %eax,%ecx
+  804df0:	48 b8 28 56 80 00 00 	movabs $0x805628,%rax
+  804df7:	00 00 00 
+  804dfa:	48 89 c2             	mov    %rax,%rdx
+  804dfd:	be 54 00 00 00       	mov    $0x54,%esi
+  804e02:	48 b8 4e 56 80 00 00 	movabs $0x80564e,%rax
+  804e09:	00 00 00 
+  804e0c:	48 89 c7             	mov    %rax,%rdi
+  804e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e14:	49 b8 49 2f 80 00 00 	movabs $0x802f49,%r8
+  804e1b:	00 00 00 
+  804e1e:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e21:	48 b8 7c 03 80 00 00 	movabs $0x80037c,%rax
+  804e28:	00 00 00 
+  804e2b:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e2d:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e30:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e33:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e3a:	89 c7                	mov    %eax,%edi
+  804e3c:	48 b8 a2 05 80 00 00 	movabs $0x8005a2,%rax
+  804e43:	00 00 00 
+  804e46:	ff d0                	call   *%rax
+  804e48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e4f:	75 8e                	jne    804ddf <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e51:	48 b8 7c 03 80 00 00 	movabs $0x80037c,%rax
+  804e58:	00 00 00 
+  804e5b:	ff d0                	call   *%rax
+}
+  804e5d:	90                   	nop
+  804e5e:	c9                   	leave
+  804e5f:	c3                   	ret
+
+0000000000804e60 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e60:	55                   	push   %rbp
+  804e61:	48 89 e5             	mov    %rsp,%rbp
+  804e64:	48 83 ec 18          	sub    $0x18,%rsp
+  804e68:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e72:	eb 4d                	jmp    804ec1 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e74:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e7b:	00 00 00 
+  804e7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e81:	48 98                	cltq
+  804e83:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e8a:	48 01 d0             	add    %rdx,%rax
+  804e8d:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e93:	8b 00                	mov    (%rax),%eax
+  804e95:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e98:	75 23                	jne    804ebd <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e9a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ea1:	00 00 00 
+  804ea4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ea7:	48 98                	cltq
+  804ea9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eb0:	48 01 d0             	add    %rdx,%rax
+  804eb3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804eb9:	8b 00                	mov    (%rax),%eax
+  804ebb:	eb 12                	jmp    804ecf <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ebd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ec1:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ec8:	7e aa                	jle    804e74 <ipc_find_env+0x14>
+  return 0;
+  804eca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ecf:	c9                   	leave
+  804ed0:	c3                   	ret
+
+0000000000804ed1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ed1:	55                   	push   %rbp
+  804ed2:	48 89 e5             	mov    %rsp,%rbp
+  804ed5:	48 83 ec 18          	sub    $0x18,%rsp
+  804ed9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804edd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee1:	48 c1 e8 27          	shr    $0x27,%rax
+  804ee5:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804eea:	48 89 c2             	mov    %rax,%rdx
+  804eed:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ef4:	01 00 00 
+  804ef7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804efb:	83 e0 01             	and    $0x1,%eax
+  804efe:	48 85 c0             	test   %rax,%rax
+  804f01:	74 63                	je     804f66 <pageref+0x95>
+  804f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f07:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f0b:	48 89 c2             	mov    %rax,%rdx
+  804f0e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f15:	01 00 00 
+  804f18:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f1c:	83 e0 01             	and    $0x1,%eax
+  804f1f:	48 85 c0             	test   %rax,%rax
+  804f22:	74 42                	je     804f66 <pageref+0x95>
+  804f24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f28:	48 c1 e8 15          	shr    $0x15,%rax
+  804f2c:	48 89 c2             	mov    %rax,%rdx
+  804f2f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f36:	01 00 00 
+  804f39:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f3d:	83 e0 01             	and    $0x1,%eax
+  804f40:	48 85 c0             	test   %rax,%rax
+  804f43:	74 21                	je     804f66 <pageref+0x95>
+  804f45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f49:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f4d:	48 89 c2             	mov    %rax,%rdx
+  804f50:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f57:	01 00 00 
+  804f5a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f5e:	83 e0 01             	and    $0x1,%eax
+  804f61:	48 85 c0             	test   %rax,%rax
+  804f64:	75 07                	jne    804f6d <pageref+0x9c>
+    return 0;
+  804f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6b:	eb 53                	jmp    804fc0 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f71:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f75:	48 89 c2             	mov    %rax,%rdx
+  804f78:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f7f:	01 00 00 
+  804f82:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f86:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f8e:	83 e0 01             	and    $0x1,%eax
+  804f91:	48 85 c0             	test   %rax,%rax
+  804f94:	75 07                	jne    804f9d <pageref+0xcc>
+    return 0;
+  804f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f9b:	eb 23                	jmp    804fc0 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa1:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fa5:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fac:	00 00 00 
+  804faf:	48 c1 e0 04          	shl    $0x4,%rax
+  804fb3:	48 01 d0             	add    %rdx,%rax
+  804fb6:	48 83 c0 08          	add    $0x8,%rax
+  804fba:	0f b7 00             	movzwl (%rax),%eax
+  804fbd:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fc0:	c9                   	leave
+  804fc1:	c3                   	ret
+  804fc2:	66 90                	xchg   %ax,%ax
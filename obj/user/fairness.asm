@@ -0,0 +1,8107 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 03 01 00 00       	call   80012f <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// (user/idle is env 0).
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  envid_t who, id;
+
+  id = sys_getenvid();
+  800041:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  800048:	00 00 00 
+  80004b:	ff d0                	call   *%rax
+  80004d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (thisenv == &envs[1]) {
+  800050:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800057:	00 00 00 
+  80005a:	8b 40 04             	mov    0x4(%rax),%eax
+  80005d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800062:	48 98                	cltq
+  800064:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80006b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800072:	00 00 00 
+  800075:	48 01 c2             	add    %rax,%rdx
+  800078:	48 b8 68 e2 22 3c 80 	movabs $0x803c22e268,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	75 46                	jne    8000cd <umain+0x9b>
+    while (1) {
+      ipc_recv(&who, 0, 0);
+  800087:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80008b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800090:	be 00 00 00 00       	mov    $0x0,%esi
+  800095:	48 89 c7             	mov    %rax,%rdi
+  800098:	48 b8 40 27 80 00 00 	movabs $0x802740,%rax
+  80009f:	00 00 00 
+  8000a2:	ff d0                	call   *%rax
+      cprintf("%x recv from %x\n", id, who);
+  8000a4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8000a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000aa:	89 c6                	mov    %eax,%esi
+  8000ac:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8000b3:	00 00 00 
+  8000b6:	48 89 c7             	mov    %rax,%rdi
+  8000b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000be:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  8000c5:	00 00 00 
+  8000c8:	ff d1                	call   *%rcx
+      ipc_recv(&who, 0, 0);
+  8000ca:	90                   	nop
+  8000cb:	eb ba                	jmp    800087 <umain+0x55>
+    }
+  } else {
+    cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  8000cd:	48 b8 00 e0 22 3c 80 	movabs $0x803c22e000,%rax
+  8000d4:	00 00 00 
+  8000d7:	8b 90 30 03 00 00    	mov    0x330(%rax),%edx
+  8000dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000e0:	89 c6                	mov    %eax,%esi
+  8000e2:	48 b8 b1 50 80 00 00 	movabs $0x8050b1,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 89 c7             	mov    %rax,%rdi
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  8000fb:	00 00 00 
+  8000fe:	ff d1                	call   *%rcx
+    while (1)
+      ipc_send(envs[1].env_id, 0, 0, 0);
+  800100:	48 b8 00 e0 22 3c 80 	movabs $0x803c22e000,%rax
+  800107:	00 00 00 
+  80010a:	8b 80 30 03 00 00    	mov    0x330(%rax),%eax
+  800110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011a:	be 00 00 00 00       	mov    $0x0,%esi
+  80011f:	89 c7                	mov    %eax,%edi
+  800121:	48 b8 bd 28 80 00 00 	movabs $0x8028bd,%rax
+  800128:	00 00 00 
+  80012b:	ff d0                	call   *%rax
+  80012d:	eb d1                	jmp    800100 <umain+0xce>
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	48 83 ec 20          	sub    $0x20,%rsp
+  800137:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80013a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80013e:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800145:	00 00 00 
+  800148:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80014c:	eb 13                	jmp    800161 <libmain+0x32>
+    (*ctor)();
+  80014e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800152:	48 8b 10             	mov    (%rax),%rdx
+  800155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015a:	ff d2                	call   *%rdx
+    ctor++;
+  80015c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800161:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800168:	00 00 00 
+  80016b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80016f:	72 dd                	jb     80014e <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800171:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800175:	7e 14                	jle    80018b <libmain+0x5c>
+    binaryname = argv[0];
+  800177:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80017b:	48 8b 00             	mov    (%rax),%rax
+  80017e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800185:	00 00 00 
+  800188:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80018b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80018f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800192:	48 89 d6             	mov    %rdx,%rsi
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001a3:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  8001aa:	00 00 00 
+  8001ad:	ff d0                	call   *%rax
+#endif
+}
+  8001af:	90                   	nop
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+
+00000000008001b2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b2:	55                   	push   %rbp
+  8001b3:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001b6:	48 b8 cb 2d 80 00 00 	movabs $0x802dcb,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c7:	48 b8 11 1f 80 00 00 	movabs $0x801f11,%rax
+  8001ce:	00 00 00 
+  8001d1:	ff d0                	call   *%rax
+}
+  8001d3:	90                   	nop
+  8001d4:	5d                   	pop    %rbp
+  8001d5:	c3                   	ret
+
+00000000008001d6 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+  8001da:	48 83 ec 10          	sub    $0x10,%rsp
+  8001de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8001e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e9:	8b 00                	mov    (%rax),%eax
+  8001eb:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001f2:	89 0a                	mov    %ecx,(%rdx)
+  8001f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001f7:	89 d1                	mov    %edx,%ecx
+  8001f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001fd:	48 98                	cltq
+  8001ff:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800203:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800207:	8b 00                	mov    (%rax),%eax
+  800209:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80020e:	75 2c                	jne    80023c <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800210:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800214:	8b 00                	mov    (%rax),%eax
+  800216:	48 98                	cltq
+  800218:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80021c:	48 83 c2 08          	add    $0x8,%rdx
+  800220:	48 89 c6             	mov    %rax,%rsi
+  800223:	48 89 d7             	mov    %rdx,%rdi
+  800226:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  80022d:	00 00 00 
+  800230:	ff d0                	call   *%rax
+    b->idx = 0;
+  800232:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800236:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80023c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800240:	8b 40 04             	mov    0x4(%rax),%eax
+  800243:	8d 50 01             	lea    0x1(%rax),%edx
+  800246:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80024d:	90                   	nop
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+0000000000800250 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80025b:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800262:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800269:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800270:	00 00 00 
+  b.cnt = 0;
+  800273:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80027a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80027d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800284:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80028b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800292:	48 89 c6             	mov    %rax,%rsi
+  800295:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  80029c:	00 00 00 
+  80029f:	48 89 c7             	mov    %rax,%rdi
+  8002a2:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  8002a9:	00 00 00 
+  8002ac:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8002ae:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002b4:	48 98                	cltq
+  8002b6:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002bd:	48 83 c2 08          	add    $0x8,%rdx
+  8002c1:	48 89 c6             	mov    %rax,%rsi
+  8002c4:	48 89 d7             	mov    %rdx,%rdi
+  8002c7:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8002d3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002d9:	c9                   	leave
+  8002da:	c3                   	ret
+
+00000000008002db <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002db:	55                   	push   %rbp
+  8002dc:	48 89 e5             	mov    %rsp,%rbp
+  8002df:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8002e6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8002ed:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8002f4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8002fb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800302:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800309:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800310:	84 c0                	test   %al,%al
+  800312:	74 20                	je     800334 <cprintf+0x59>
+  800314:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800318:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80031c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800320:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800324:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800328:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80032c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800330:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800334:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80033b:	00 00 00 
+  80033e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800345:	00 00 00 
+  800348:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80034c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800353:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80035a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800361:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800368:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80036f:	48 89 d6             	mov    %rdx,%rsi
+  800372:	48 89 c7             	mov    %rax,%rdi
+  800375:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800387:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80038d:	c9                   	leave
+  80038e:	c3                   	ret
+
+000000000080038f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80038f:	55                   	push   %rbp
+  800390:	48 89 e5             	mov    %rsp,%rbp
+  800393:	48 83 ec 30          	sub    $0x30,%rsp
+  800397:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80039b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80039f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003a3:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003a6:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003aa:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8003ae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003b1:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003b5:	72 54                	jb     80040b <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003b7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003ba:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003bd:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c9:	48 f7 f6             	div    %rsi
+  8003cc:	49 89 c2             	mov    %rax,%r10
+  8003cf:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003d2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003d5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8003d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003dd:	41 89 c9             	mov    %ecx,%r9d
+  8003e0:	41 89 f8             	mov    %edi,%r8d
+  8003e3:	89 d1                	mov    %edx,%ecx
+  8003e5:	4c 89 d2             	mov    %r10,%rdx
+  8003e8:	48 89 c7             	mov    %rax,%rdi
+  8003eb:	48 b8 8f 03 80 00 00 	movabs $0x80038f,%rax
+  8003f2:	00 00 00 
+  8003f5:	ff d0                	call   *%rax
+  8003f7:	eb 1c                	jmp    800415 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800400:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800404:	48 89 d6             	mov    %rdx,%rsi
+  800407:	89 c7                	mov    %eax,%edi
+  800409:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80040b:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80040f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800413:	7f e4                	jg     8003f9 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800415:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800418:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80041c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800421:	48 f7 f1             	div    %rcx
+  800424:	48 b8 10 53 80 00 00 	movabs $0x805310,%rax
+  80042b:	00 00 00 
+  80042e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800432:	0f be c0             	movsbl %al,%eax
+  800435:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800439:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80043d:	48 89 d6             	mov    %rdx,%rsi
+  800440:	89 c7                	mov    %eax,%edi
+  800442:	ff d1                	call   *%rcx
+}
+  800444:	90                   	nop
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+0000000000800447 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	48 83 ec 10          	sub    $0x10,%rsp
+  80044f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800453:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800456:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80045a:	7e 4b                	jle    8004a7 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80045c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800460:	8b 00                	mov    (%rax),%eax
+  800462:	83 f8 2f             	cmp    $0x2f,%eax
+  800465:	77 24                	ja     80048b <getuint+0x44>
+  800467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80046b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80046f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800473:	8b 00                	mov    (%rax),%eax
+  800475:	89 c0                	mov    %eax,%eax
+  800477:	48 01 d0             	add    %rdx,%rax
+  80047a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80047e:	8b 12                	mov    (%rdx),%edx
+  800480:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800483:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800487:	89 0a                	mov    %ecx,(%rdx)
+  800489:	eb 14                	jmp    80049f <getuint+0x58>
+  80048b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80048f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800493:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800497:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80049b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80049f:	48 8b 00             	mov    (%rax),%rax
+  8004a2:	e9 95 00 00 00       	jmp    80053c <getuint+0xf5>
+  else if (lflag)
+  8004a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004ab:	74 48                	je     8004f5 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8004ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004b1:	8b 00                	mov    (%rax),%eax
+  8004b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b6:	77 24                	ja     8004dc <getuint+0x95>
+  8004b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004bc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c4:	8b 00                	mov    (%rax),%eax
+  8004c6:	89 c0                	mov    %eax,%eax
+  8004c8:	48 01 d0             	add    %rdx,%rax
+  8004cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004cf:	8b 12                	mov    (%rdx),%edx
+  8004d1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004d8:	89 0a                	mov    %ecx,(%rdx)
+  8004da:	eb 14                	jmp    8004f0 <getuint+0xa9>
+  8004dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004e4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ec:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004f0:	48 8b 00             	mov    (%rax),%rax
+  8004f3:	eb 47                	jmp    80053c <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8004f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f9:	8b 00                	mov    (%rax),%eax
+  8004fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8004fe:	77 24                	ja     800524 <getuint+0xdd>
+  800500:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800504:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800508:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80050c:	8b 00                	mov    (%rax),%eax
+  80050e:	89 c0                	mov    %eax,%eax
+  800510:	48 01 d0             	add    %rdx,%rax
+  800513:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800517:	8b 12                	mov    (%rdx),%edx
+  800519:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80051c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800520:	89 0a                	mov    %ecx,(%rdx)
+  800522:	eb 14                	jmp    800538 <getuint+0xf1>
+  800524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800528:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80052c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800530:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800534:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800538:	8b 00                	mov    (%rax),%eax
+  80053a:	89 c0                	mov    %eax,%eax
+}
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+000000000080053e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+  800542:	48 83 ec 10          	sub    $0x10,%rsp
+  800546:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80054a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80054d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800551:	7e 4b                	jle    80059e <getint+0x60>
+    return va_arg(*ap, long long);
+  800553:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800557:	8b 00                	mov    (%rax),%eax
+  800559:	83 f8 2f             	cmp    $0x2f,%eax
+  80055c:	77 24                	ja     800582 <getint+0x44>
+  80055e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800562:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80056a:	8b 00                	mov    (%rax),%eax
+  80056c:	89 c0                	mov    %eax,%eax
+  80056e:	48 01 d0             	add    %rdx,%rax
+  800571:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800575:	8b 12                	mov    (%rdx),%edx
+  800577:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80057a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80057e:	89 0a                	mov    %ecx,(%rdx)
+  800580:	eb 14                	jmp    800596 <getint+0x58>
+  800582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800586:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80058a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80058e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800592:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800596:	48 8b 00             	mov    (%rax),%rax
+  800599:	e9 95 00 00 00       	jmp    800633 <getint+0xf5>
+  else if (lflag)
+  80059e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005a2:	74 48                	je     8005ec <getint+0xae>
+    return va_arg(*ap, long);
+  8005a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a8:	8b 00                	mov    (%rax),%eax
+  8005aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ad:	77 24                	ja     8005d3 <getint+0x95>
+  8005af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005bb:	8b 00                	mov    (%rax),%eax
+  8005bd:	89 c0                	mov    %eax,%eax
+  8005bf:	48 01 d0             	add    %rdx,%rax
+  8005c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c6:	8b 12                	mov    (%rdx),%edx
+  8005c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005cf:	89 0a                	mov    %ecx,(%rdx)
+  8005d1:	eb 14                	jmp    8005e7 <getint+0xa9>
+  8005d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005e7:	48 8b 00             	mov    (%rax),%rax
+  8005ea:	eb 47                	jmp    800633 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8005ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f0:	8b 00                	mov    (%rax),%eax
+  8005f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f5:	77 24                	ja     80061b <getint+0xdd>
+  8005f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800603:	8b 00                	mov    (%rax),%eax
+  800605:	89 c0                	mov    %eax,%eax
+  800607:	48 01 d0             	add    %rdx,%rax
+  80060a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80060e:	8b 12                	mov    (%rdx),%edx
+  800610:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800613:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800617:	89 0a                	mov    %ecx,(%rdx)
+  800619:	eb 14                	jmp    80062f <getint+0xf1>
+  80061b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80061f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800623:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800627:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80062b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80062f:	8b 00                	mov    (%rax),%eax
+  800631:	48 98                	cltq
+}
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+0000000000800635 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800635:	55                   	push   %rbp
+  800636:	48 89 e5             	mov    %rsp,%rbp
+  800639:	41 54                	push   %r12
+  80063b:	53                   	push   %rbx
+  80063c:	48 83 ec 60          	sub    $0x60,%rsp
+  800640:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800644:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800648:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80064c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800650:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800654:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800658:	48 8b 06             	mov    (%rsi),%rax
+  80065b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80065f:	48 89 01             	mov    %rax,(%rcx)
+  800662:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800666:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80066a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80066e:	eb 17                	jmp    800687 <vprintfmt+0x52>
+      if (ch == '\0')
+  800670:	85 db                	test   %ebx,%ebx
+  800672:	0f 84 bf 04 00 00    	je     800b37 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800678:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80067c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800680:	48 89 c6             	mov    %rax,%rsi
+  800683:	89 df                	mov    %ebx,%edi
+  800685:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800687:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80068b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80068f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800693:	0f b6 00             	movzbl (%rax),%eax
+  800696:	0f b6 d8             	movzbl %al,%ebx
+  800699:	83 fb 25             	cmp    $0x25,%ebx
+  80069c:	75 d2                	jne    800670 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80069e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8006a2:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8006a9:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8006b0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8006b7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8006be:	eb 04                	jmp    8006c4 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8006c0:	90                   	nop
+  8006c1:	eb 01                	jmp    8006c4 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8006c3:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8006c4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006cc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006d0:	0f b6 00             	movzbl (%rax),%eax
+  8006d3:	0f b6 d8             	movzbl %al,%ebx
+  8006d6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8006d9:	83 f8 55             	cmp    $0x55,%eax
+  8006dc:	0f 87 22 04 00 00    	ja     800b04 <vprintfmt+0x4cf>
+  8006e2:	89 c0                	mov    %eax,%eax
+  8006e4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8006eb:	00 
+  8006ec:	48 b8 38 53 80 00 00 	movabs $0x805338,%rax
+  8006f3:	00 00 00 
+  8006f6:	48 01 d0             	add    %rdx,%rax
+  8006f9:	48 8b 00             	mov    (%rax),%rax
+  8006fc:	ff e0                	jmp    *%rax
+        padc = '-';
+  8006fe:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800702:	eb c0                	jmp    8006c4 <vprintfmt+0x8f>
+        padc = '0';
+  800704:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800708:	eb ba                	jmp    8006c4 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80070a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800711:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800714:	89 d0                	mov    %edx,%eax
+  800716:	c1 e0 02             	shl    $0x2,%eax
+  800719:	01 d0                	add    %edx,%eax
+  80071b:	01 c0                	add    %eax,%eax
+  80071d:	01 d8                	add    %ebx,%eax
+  80071f:	83 e8 30             	sub    $0x30,%eax
+  800722:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800725:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800729:	0f b6 00             	movzbl (%rax),%eax
+  80072c:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80072f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800732:	7e 60                	jle    800794 <vprintfmt+0x15f>
+  800734:	83 fb 39             	cmp    $0x39,%ebx
+  800737:	7f 5b                	jg     800794 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800739:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80073e:	eb d1                	jmp    800711 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	77 17                	ja     80075f <vprintfmt+0x12a>
+  800748:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80074c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80074f:	89 d2                	mov    %edx,%edx
+  800751:	48 01 d0             	add    %rdx,%rax
+  800754:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800757:	83 c2 08             	add    $0x8,%edx
+  80075a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80075d:	eb 0c                	jmp    80076b <vprintfmt+0x136>
+  80075f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800763:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800767:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80076b:	8b 00                	mov    (%rax),%eax
+  80076d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800770:	eb 23                	jmp    800795 <vprintfmt+0x160>
+        if (width < 0)
+  800772:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800776:	0f 89 44 ff ff ff    	jns    8006c0 <vprintfmt+0x8b>
+          width = 0;
+  80077c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800783:	e9 38 ff ff ff       	jmp    8006c0 <vprintfmt+0x8b>
+        altflag = 1;
+  800788:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80078f:	e9 30 ff ff ff       	jmp    8006c4 <vprintfmt+0x8f>
+        goto process_precision;
+  800794:	90                   	nop
+        if (width < 0)
+  800795:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800799:	0f 89 24 ff ff ff    	jns    8006c3 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80079f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007a2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007a5:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8007ac:	e9 12 ff ff ff       	jmp    8006c3 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8007b1:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8007b5:	e9 0a ff ff ff       	jmp    8006c4 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 17                	ja     8007d9 <vprintfmt+0x1a4>
+  8007c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007c9:	89 d2                	mov    %edx,%edx
+  8007cb:	48 01 d0             	add    %rdx,%rax
+  8007ce:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007d1:	83 c2 08             	add    $0x8,%edx
+  8007d4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007d7:	eb 0c                	jmp    8007e5 <vprintfmt+0x1b0>
+  8007d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007dd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007e1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007e5:	8b 00                	mov    (%rax),%eax
+  8007e7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8007eb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8007ef:	48 89 d6             	mov    %rdx,%rsi
+  8007f2:	89 c7                	mov    %eax,%edi
+  8007f4:	ff d1                	call   *%rcx
+        break;
+  8007f6:	e9 37 03 00 00       	jmp    800b32 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8007fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800801:	77 17                	ja     80081a <vprintfmt+0x1e5>
+  800803:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800807:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80080a:	89 d2                	mov    %edx,%edx
+  80080c:	48 01 d0             	add    %rdx,%rax
+  80080f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800812:	83 c2 08             	add    $0x8,%edx
+  800815:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800818:	eb 0c                	jmp    800826 <vprintfmt+0x1f1>
+  80081a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80081e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800822:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800826:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800828:	85 db                	test   %ebx,%ebx
+  80082a:	79 02                	jns    80082e <vprintfmt+0x1f9>
+          err = -err;
+  80082c:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80082e:	83 fb 15             	cmp    $0x15,%ebx
+  800831:	7f 16                	jg     800849 <vprintfmt+0x214>
+  800833:	48 ba 60 52 80 00 00 	movabs $0x805260,%rdx
+  80083a:	00 00 00 
+  80083d:	48 63 c3             	movslq %ebx,%rax
+  800840:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800844:	4d 85 e4             	test   %r12,%r12
+  800847:	75 2e                	jne    800877 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800849:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80084d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800851:	89 d9                	mov    %ebx,%ecx
+  800853:	48 ba 21 53 80 00 00 	movabs $0x805321,%rdx
+  80085a:	00 00 00 
+  80085d:	48 89 c7             	mov    %rax,%rdi
+  800860:	b8 00 00 00 00       	mov    $0x0,%eax
+  800865:	49 b8 41 0b 80 00 00 	movabs $0x800b41,%r8
+  80086c:	00 00 00 
+  80086f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800872:	e9 bb 02 00 00       	jmp    800b32 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800877:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80087b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80087f:	4c 89 e1             	mov    %r12,%rcx
+  800882:	48 ba 2a 53 80 00 00 	movabs $0x80532a,%rdx
+  800889:	00 00 00 
+  80088c:	48 89 c7             	mov    %rax,%rdi
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	49 b8 41 0b 80 00 00 	movabs $0x800b41,%r8
+  80089b:	00 00 00 
+  80089e:	41 ff d0             	call   *%r8
+        break;
+  8008a1:	e9 8c 02 00 00       	jmp    800b32 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8008a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ac:	77 17                	ja     8008c5 <vprintfmt+0x290>
+  8008ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008b2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008b5:	89 d2                	mov    %edx,%edx
+  8008b7:	48 01 d0             	add    %rdx,%rax
+  8008ba:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008bd:	83 c2 08             	add    $0x8,%edx
+  8008c0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008c3:	eb 0c                	jmp    8008d1 <vprintfmt+0x29c>
+  8008c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008c9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008cd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008d1:	4c 8b 20             	mov    (%rax),%r12
+  8008d4:	4d 85 e4             	test   %r12,%r12
+  8008d7:	75 0a                	jne    8008e3 <vprintfmt+0x2ae>
+          p = "(null)";
+  8008d9:	49 bc 2d 53 80 00 00 	movabs $0x80532d,%r12
+  8008e0:	00 00 00 
+        if (width > 0 && padc != '-')
+  8008e3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008e7:	7e 78                	jle    800961 <vprintfmt+0x32c>
+  8008e9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8008ed:	74 72                	je     800961 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8008ef:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8008f2:	48 98                	cltq
+  8008f4:	48 89 c6             	mov    %rax,%rsi
+  8008f7:	4c 89 e7             	mov    %r12,%rdi
+  8008fa:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  800901:	00 00 00 
+  800904:	ff d0                	call   *%rax
+  800906:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800909:	eb 17                	jmp    800922 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80090b:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80090f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800913:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800917:	48 89 d6             	mov    %rdx,%rsi
+  80091a:	89 c7                	mov    %eax,%edi
+  80091c:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80091e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800922:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800926:	7f e3                	jg     80090b <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800928:	eb 37                	jmp    800961 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80092a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80092e:	74 1e                	je     80094e <vprintfmt+0x319>
+  800930:	83 fb 1f             	cmp    $0x1f,%ebx
+  800933:	7e 05                	jle    80093a <vprintfmt+0x305>
+  800935:	83 fb 7e             	cmp    $0x7e,%ebx
+  800938:	7e 14                	jle    80094e <vprintfmt+0x319>
+            putch('?', putdat);
+  80093a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80093e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800942:	48 89 c6             	mov    %rax,%rsi
+  800945:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80094a:	ff d2                	call   *%rdx
+  80094c:	eb 0f                	jmp    80095d <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80094e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800952:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800956:	48 89 c6             	mov    %rax,%rsi
+  800959:	89 df                	mov    %ebx,%edi
+  80095b:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80095d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800961:	4c 89 e0             	mov    %r12,%rax
+  800964:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800968:	0f b6 00             	movzbl (%rax),%eax
+  80096b:	0f be d8             	movsbl %al,%ebx
+  80096e:	85 db                	test   %ebx,%ebx
+  800970:	74 28                	je     80099a <vprintfmt+0x365>
+  800972:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800976:	78 b2                	js     80092a <vprintfmt+0x2f5>
+  800978:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80097c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800980:	79 a8                	jns    80092a <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800982:	eb 16                	jmp    80099a <vprintfmt+0x365>
+          putch(' ', putdat);
+  800984:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800988:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80098c:	48 89 c6             	mov    %rax,%rsi
+  80098f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800994:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800996:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80099a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80099e:	7f e4                	jg     800984 <vprintfmt+0x34f>
+        break;
+  8009a0:	e9 8d 01 00 00       	jmp    800b32 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8009a5:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009a8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009ac:	89 d6                	mov    %edx,%esi
+  8009ae:	48 89 c7             	mov    %rax,%rdi
+  8009b1:	48 b8 3e 05 80 00 00 	movabs $0x80053e,%rax
+  8009b8:	00 00 00 
+  8009bb:	ff d0                	call   *%rax
+  8009bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8009c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c5:	48 85 c0             	test   %rax,%rax
+  8009c8:	79 1d                	jns    8009e7 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8009ca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009d2:	48 89 c6             	mov    %rax,%rsi
+  8009d5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009da:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8009dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e0:	48 f7 d8             	neg    %rax
+  8009e3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8009e7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8009ee:	e9 d2 00 00 00       	jmp    800ac5 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  8009f3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009f6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009fa:	89 d6                	mov    %edx,%esi
+  8009fc:	48 89 c7             	mov    %rax,%rdi
+  8009ff:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800a06:	00 00 00 
+  800a09:	ff d0                	call   *%rax
+  800a0b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a0f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a16:	e9 aa 00 00 00       	jmp    800ac5 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800a1b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a1e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a22:	89 d6                	mov    %edx,%esi
+  800a24:	48 89 c7             	mov    %rax,%rdi
+  800a27:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800a2e:	00 00 00 
+  800a31:	ff d0                	call   *%rax
+  800a33:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800a37:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800a3e:	e9 82 00 00 00       	jmp    800ac5 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800a43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a47:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a4b:	48 89 c6             	mov    %rax,%rsi
+  800a4e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a53:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800a55:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a59:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a5d:	48 89 c6             	mov    %rax,%rsi
+  800a60:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a65:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6d:	77 17                	ja     800a86 <vprintfmt+0x451>
+  800a6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a73:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a76:	89 d2                	mov    %edx,%edx
+  800a78:	48 01 d0             	add    %rdx,%rax
+  800a7b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a7e:	83 c2 08             	add    $0x8,%edx
+  800a81:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a84:	eb 0c                	jmp    800a92 <vprintfmt+0x45d>
+  800a86:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a8a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a8e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a92:	48 8b 00             	mov    (%rax),%rax
+  800a95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a99:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800aa0:	eb 23                	jmp    800ac5 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800aa2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800aa5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800aa9:	89 d6                	mov    %edx,%esi
+  800aab:	48 89 c7             	mov    %rax,%rdi
+  800aae:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+  800aba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800abe:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800ac5:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800aca:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800acd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ad0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ad8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800adc:	45 89 c1             	mov    %r8d,%r9d
+  800adf:	41 89 f8             	mov    %edi,%r8d
+  800ae2:	48 89 c7             	mov    %rax,%rdi
+  800ae5:	48 b8 8f 03 80 00 00 	movabs $0x80038f,%rax
+  800aec:	00 00 00 
+  800aef:	ff d0                	call   *%rax
+        break;
+  800af1:	eb 3f                	jmp    800b32 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800af3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800af7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800afb:	48 89 c6             	mov    %rax,%rsi
+  800afe:	89 df                	mov    %ebx,%edi
+  800b00:	ff d2                	call   *%rdx
+        break;
+  800b02:	eb 2e                	jmp    800b32 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b04:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b08:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b0c:	48 89 c6             	mov    %rax,%rsi
+  800b0f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b14:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800b16:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b1b:	eb 05                	jmp    800b22 <vprintfmt+0x4ed>
+  800b1d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b22:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b26:	48 83 e8 01          	sub    $0x1,%rax
+  800b2a:	0f b6 00             	movzbl (%rax),%eax
+  800b2d:	3c 25                	cmp    $0x25,%al
+  800b2f:	75 ec                	jne    800b1d <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800b31:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b32:	e9 50 fb ff ff       	jmp    800687 <vprintfmt+0x52>
+        return;
+  800b37:	90                   	nop
+    }
+  }
+}
+  800b38:	48 83 c4 60          	add    $0x60,%rsp
+  800b3c:	5b                   	pop    %rbx
+  800b3d:	41 5c                	pop    %r12
+  800b3f:	5d                   	pop    %rbp
+  800b40:	c3                   	ret
+
+0000000000800b41 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800b41:	55                   	push   %rbp
+  800b42:	48 89 e5             	mov    %rsp,%rbp
+  800b45:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b4c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b53:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b5a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b61:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b68:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b6f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b76:	84 c0                	test   %al,%al
+  800b78:	74 20                	je     800b9a <printfmt+0x59>
+  800b7a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b7e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b82:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b86:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b8a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b8e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b92:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b96:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800b9a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ba1:	00 00 00 
+  800ba4:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bab:	00 00 00 
+  800bae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bb9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bc0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800bc7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800bce:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800bd5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800bdc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800be3:	48 89 c7             	mov    %rax,%rdi
+  800be6:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  800bed:	00 00 00 
+  800bf0:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800bf2:	90                   	nop
+  800bf3:	c9                   	leave
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800bf5:	55                   	push   %rbp
+  800bf6:	48 89 e5             	mov    %rsp,%rbp
+  800bf9:	48 83 ec 10          	sub    $0x10,%rsp
+  800bfd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c08:	8b 40 10             	mov    0x10(%rax),%eax
+  800c0b:	8d 50 01             	lea    0x1(%rax),%edx
+  800c0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c12:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800c15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c19:	48 8b 10             	mov    (%rax),%rdx
+  800c1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c24:	48 39 c2             	cmp    %rax,%rdx
+  800c27:	73 17                	jae    800c40 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800c29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2d:	48 8b 00             	mov    (%rax),%rax
+  800c30:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c34:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c38:	48 89 0a             	mov    %rcx,(%rdx)
+  800c3b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c3e:	88 10                	mov    %dl,(%rax)
+}
+  800c40:	90                   	nop
+  800c41:	c9                   	leave
+  800c42:	c3                   	ret
+
+0000000000800c43 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800c43:	55                   	push   %rbp
+  800c44:	48 89 e5             	mov    %rsp,%rbp
+  800c47:	48 83 ec 40          	sub    $0x40,%rsp
+  800c4b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c4f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800c52:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c56:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c5e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c62:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c65:	48 98                	cltq
+  800c67:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c6f:	48 01 d0             	add    %rdx,%rax
+  800c72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c76:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800c7d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c82:	74 06                	je     800c8a <vsnprintf+0x47>
+  800c84:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c88:	7f 07                	jg     800c91 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800c8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c8f:	eb 32                	jmp    800cc3 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800c91:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800c95:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800c99:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800c9d:	48 89 c6             	mov    %rax,%rsi
+  800ca0:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800ca7:	00 00 00 
+  800caa:	48 89 c7             	mov    %rax,%rdi
+  800cad:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800cb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cbd:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800cc0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800cc5:	55                   	push   %rbp
+  800cc6:	48 89 e5             	mov    %rsp,%rbp
+  800cc9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800cd0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800cd7:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800cdd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ce4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ceb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800cf2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cf9:	84 c0                	test   %al,%al
+  800cfb:	74 20                	je     800d1d <snprintf+0x58>
+  800cfd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d01:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d05:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d09:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d0d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d11:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d15:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d19:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d1d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d24:	00 00 00 
+  800d27:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d2e:	00 00 00 
+  800d31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d35:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d3c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d43:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d4a:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800d51:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d58:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d5e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d65:	48 89 c7             	mov    %rax,%rdi
+  800d68:	48 b8 43 0c 80 00 00 	movabs $0x800c43,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+  800d74:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800d7a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800d80:	c9                   	leave
+  800d81:	c3                   	ret
+
+0000000000800d82 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800d82:	55                   	push   %rbp
+  800d83:	48 89 e5             	mov    %rsp,%rbp
+  800d86:	53                   	push   %rbx
+  800d87:	48 83 ec 38          	sub    $0x38,%rsp
+  800d8b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800d8e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800d92:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800d96:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800d9a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800d9e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	89 d1                	mov    %edx,%ecx
+  800da8:	0f a2                	cpuid
+  800daa:	89 de                	mov    %ebx,%esi
+  800dac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800daf:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800db2:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800db5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800db8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800dbd:	74 09                	je     800dc8 <cpuid+0x46>
+}
+  800dbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dc3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800dc6:	89 10                	mov    %edx,(%rax)
+
+  800dc8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800dcd:	74 09                	je     800dd8 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800dcf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dd3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800dd6:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800dd8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ddd:	74 09                	je     800de8 <cpuid+0x66>
+char *
+  800ddf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800de3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800de6:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800de8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800ded:	74 09                	je     800df8 <cpuid+0x76>
+  for (; *s; s++)
+  800def:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800df3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800df6:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800df8:	90                   	nop
+  800df9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dfd:	c9                   	leave
+  800dfe:	c3                   	ret
+
+0000000000800dff <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800dff:	55                   	push   %rbp
+  800e00:	48 89 e5             	mov    %rsp,%rbp
+  800e03:	48 83 ec 18          	sub    $0x18,%rsp
+  800e07:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e0d:	89 c1                	mov    %eax,%ecx
+  800e0f:	0f 01 d0             	xgetbv
+  800e12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e15:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800e18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e1b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800e1e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800e22:	48 09 d0             	or     %rdx,%rax
+#else
+  800e25:	c9                   	leave
+  800e26:	c3                   	ret
+
+0000000000800e27 <string_cpu>:
+string_cpu(void) {
+  800e27:	55                   	push   %rbp
+  800e28:	48 89 e5             	mov    %rsp,%rbp
+  800e2b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800e2f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800e36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800e3d:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e44:	00 00 00 
+  800e47:	8b 00                	mov    (%rax),%eax
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	78 11                	js     800e5e <string_cpu+0x37>
+    return string_features;
+  800e4d:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e54:	00 00 00 
+  800e57:	8b 00                	mov    (%rax),%eax
+  800e59:	e9 df 00 00 00       	jmp    800f3d <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e5e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e72:	48 89 c6             	mov    %rax,%rsi
+  800e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e7a:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800e86:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e89:	83 f8 06             	cmp    $0x6,%eax
+  800e8c:	76 28                	jbe    800eb6 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800e8e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800e92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9d:	48 89 c2             	mov    %rax,%rdx
+  800ea0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea5:	bf 07 00 00 00       	mov    $0x7,%edi
+  800eaa:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800eb6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800eb9:	25 00 02 00 00       	and    $0x200,%eax
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	74 04                	je     800ec6 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800ec2:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800ec6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800eca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ed0:	48 89 c1             	mov    %rax,%rcx
+  800ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed8:	be 00 00 00 00       	mov    $0x0,%esi
+  800edd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ee2:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800ee9:	00 00 00 
+  800eec:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800eee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800ef1:	83 e0 20             	and    $0x20,%eax
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	74 2a                	je     800f22 <string_cpu+0xfb>
+  800ef8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800efb:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f00:	85 c0                	test   %eax,%eax
+  800f02:	74 1e                	je     800f22 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f09:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800f10:	00 00 00 
+  800f13:	ff d0                	call   *%rax
+  800f15:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f18:	48 83 f8 06          	cmp    $0x6,%rax
+  800f1c:	75 04                	jne    800f22 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800f1e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800f22:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800f29:	00 00 00 
+  800f2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f2f:	89 02                	mov    %eax,(%rdx)
+  800f31:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800f38:	00 00 00 
+  800f3b:	8b 00                	mov    (%rax),%eax
+}
+  800f3d:	c9                   	leave
+  800f3e:	c3                   	ret
+
+0000000000800f3f <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800f3f:	55                   	push   %rbp
+  800f40:	48 89 e5             	mov    %rsp,%rbp
+  800f43:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f47:	48 83 ec 60          	sub    $0x60,%rsp
+  800f4b:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800f50:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f55:	83 e0 1f             	and    $0x1f,%eax
+  800f58:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f5c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f60:	48 f7 d8             	neg    %rax
+  800f63:	48 89 c2             	mov    %rax,%rdx
+  800f66:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f6b:	48 01 d0             	add    %rdx,%rax
+  800f6e:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800f73:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800f77:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800f7d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f82:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f86:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f8c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f90:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f94:	89 c2                	mov    %eax,%edx
+  800f96:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f9a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800f9f:	89 c1                	mov    %eax,%ecx
+  800fa1:	d3 e6                	shl    %cl,%esi
+  800fa3:	89 f0                	mov    %esi,%eax
+  800fa5:	21 d0                	and    %edx,%eax
+  800fa7:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fab:	eb 21                	jmp    800fce <strlen_avx2+0x8f>
+    p += 32;
+  800fad:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800fb3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fb8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fbc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fc2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fc6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fca:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fce:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800fd3:	74 d8                	je     800fad <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800fd5:	31 c0                	xor    %eax,%eax
+  800fd7:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800fdd:	48 63 d0             	movslq %eax,%rdx
+  800fe0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fe5:	48 01 d0             	add    %rdx,%rax
+  800fe8:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800fed:	c9                   	leave
+  800fee:	c3                   	ret
+
+0000000000800fef <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800fef:	55                   	push   %rbp
+  800ff0:	48 89 e5             	mov    %rsp,%rbp
+  800ff3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800ff7:	48 83 ec 40          	sub    $0x40,%rsp
+  800ffb:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801000:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801005:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80100a:	eb 77                	jmp    801083 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80100c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801011:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801015:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801019:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80101e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801022:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801026:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80102a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80102e:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801033:	74 3c                	je     801071 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801035:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801039:	f7 d0                	not    %eax
+  80103b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80103f:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801043:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801047:	48 63 d0             	movslq %eax,%rdx
+  80104a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80104f:	48 01 d0             	add    %rdx,%rax
+  801052:	0f b6 00             	movzbl (%rax),%eax
+  801055:	0f b6 c0             	movzbl %al,%eax
+  801058:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80105c:	48 63 ca             	movslq %edx,%rcx
+  80105f:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801064:	48 01 ca             	add    %rcx,%rdx
+  801067:	0f b6 12             	movzbl (%rdx),%edx
+  80106a:	0f b6 d2             	movzbl %dl,%edx
+  80106d:	29 d0                	sub    %edx,%eax
+  80106f:	eb 6b                	jmp    8010dc <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801071:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801077:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80107d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801083:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801089:	77 81                	ja     80100c <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80108b:	eb 42                	jmp    8010cf <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80108d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801092:	0f b6 10             	movzbl (%rax),%edx
+  801095:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80109a:	0f b6 00             	movzbl (%rax),%eax
+  80109d:	38 c2                	cmp    %al,%dl
+  80109f:	74 1c                	je     8010bd <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8010a1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010a6:	0f b6 00             	movzbl (%rax),%eax
+  8010a9:	0f b6 c8             	movzbl %al,%ecx
+  8010ac:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010b1:	0f b6 00             	movzbl (%rax),%eax
+  8010b4:	0f b6 d0             	movzbl %al,%edx
+  8010b7:	89 c8                	mov    %ecx,%eax
+  8010b9:	29 d0                	sub    %edx,%eax
+  8010bb:	eb 1f                	jmp    8010dc <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8010bd:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010c3:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8010c9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010cf:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010d5:	75 b6                	jne    80108d <memcmp_avx2+0x9e>
+  return 0;
+  8010d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010dc:	c9                   	leave
+  8010dd:	c3                   	ret
+
+00000000008010de <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8010de:	55                   	push   %rbp
+  8010df:	48 89 e5             	mov    %rsp,%rbp
+  8010e2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010e6:	48 83 ec 60          	sub    $0x60,%rsp
+  8010ea:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8010ef:	89 f0                	mov    %esi,%eax
+  8010f1:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8010f6:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8010fa:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8010ff:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801103:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801108:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80110e:	eb 47                	jmp    801157 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801110:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801115:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801119:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80111d:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801123:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801127:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80112b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80112f:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801134:	74 15                	je     80114b <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801136:	31 c0                	xor    %eax,%eax
+  801138:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80113e:	48 63 d0             	movslq %eax,%rdx
+  801141:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801146:	48 01 d0             	add    %rdx,%rax
+  801149:	eb 3d                	jmp    801188 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80114b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801151:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801157:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80115d:	77 b1                	ja     801110 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80115f:	eb 0c                	jmp    80116d <memfind_avx2+0x8f>
+  801161:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801167:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80116d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801173:	74 0e                	je     801183 <memfind_avx2+0xa5>
+  801175:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80117a:	0f b6 00             	movzbl (%rax),%eax
+  80117d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801181:	75 de                	jne    801161 <memfind_avx2+0x83>
+  return s;
+  801183:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801188:	c9                   	leave
+  801189:	c3                   	ret
+
+000000000080118a <strlen>:
+strlen(const char *s) {
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	48 83 ec 40          	sub    $0x40,%rsp
+  801192:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801196:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80119a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80119e:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  8011a5:	00 00 00 
+  8011a8:	ff d0                	call   *%rax
+  8011aa:	83 e0 02             	and    $0x2,%eax
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	74 18                	je     8011c9 <strlen+0x3f>
+    return strlen_avx2(s);
+  8011b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011b5:	48 89 c7             	mov    %rax,%rdi
+  8011b8:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  8011bf:	00 00 00 
+  8011c2:	ff d0                	call   *%rax
+  8011c4:	e9 82 00 00 00       	jmp    80124b <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8011c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011cd:	83 e0 0f             	and    $0xf,%eax
+  8011d0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8011d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011d6:	48 f7 d8             	neg    %rax
+  8011d9:	48 89 c2             	mov    %rax,%rdx
+  8011dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011e0:	48 01 d0             	add    %rdx,%rax
+  8011e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8011e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011eb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8011ef:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8011f4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8011f8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8011fc:	89 c2                	mov    %eax,%edx
+  8011fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801201:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801206:	89 c1                	mov    %eax,%ecx
+  801208:	d3 e6                	shl    %cl,%esi
+  80120a:	89 f0                	mov    %esi,%eax
+  80120c:	21 d0                	and    %edx,%eax
+  80120e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801211:	eb 1d                	jmp    801230 <strlen+0xa6>
+    p += 16;
+  801213:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801218:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80121c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801220:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801225:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801229:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80122d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801230:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801234:	74 dd                	je     801213 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801236:	31 c0                	xor    %eax,%eax
+  801238:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80123d:	48 63 d0             	movslq %eax,%rdx
+  801240:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801244:	48 01 d0             	add    %rdx,%rax
+  801247:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+
+000000000080124d <strnlen>:
+strnlen(const char *s, size_t size) {
+  80124d:	55                   	push   %rbp
+  80124e:	48 89 e5             	mov    %rsp,%rbp
+  801251:	48 83 ec 20          	sub    $0x20,%rsp
+  801255:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801259:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80125d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801264:	eb 0e                	jmp    801274 <strnlen+0x27>
+    n++;
+  801266:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80126a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80126f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801274:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801279:	74 0b                	je     801286 <strnlen+0x39>
+  80127b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127f:	0f b6 00             	movzbl (%rax),%eax
+  801282:	84 c0                	test   %al,%al
+  801284:	75 e0                	jne    801266 <strnlen+0x19>
+  return n;
+  801286:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801289:	c9                   	leave
+  80128a:	c3                   	ret
+
+000000000080128b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80128b:	55                   	push   %rbp
+  80128c:	48 89 e5             	mov    %rsp,%rbp
+  80128f:	48 83 ec 20          	sub    $0x20,%rsp
+  801293:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801297:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80129b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80129f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8012a3:	90                   	nop
+  8012a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012a8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012ac:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012bc:	0f b6 12             	movzbl (%rdx),%edx
+  8012bf:	88 10                	mov    %dl,(%rax)
+  8012c1:	0f b6 00             	movzbl (%rax),%eax
+  8012c4:	84 c0                	test   %al,%al
+  8012c6:	75 dc                	jne    8012a4 <strcpy+0x19>
+  return ret;
+  8012c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012cc:	c9                   	leave
+  8012cd:	c3                   	ret
+
+00000000008012ce <strcat>:
+strcat(char *dst, const char *src) {
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+  8012d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8012d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8012de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e2:	48 89 c7             	mov    %rax,%rdi
+  8012e5:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+  8012f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8012f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012f7:	48 63 d0             	movslq %eax,%rdx
+  8012fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012fe:	48 01 c2             	add    %rax,%rdx
+  801301:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801305:	48 89 c6             	mov    %rax,%rsi
+  801308:	48 89 d7             	mov    %rdx,%rdi
+  80130b:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801312:	00 00 00 
+  801315:	ff d0                	call   *%rax
+  return dst;
+  801317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+
+000000000080131d <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80131d:	55                   	push   %rbp
+  80131e:	48 89 e5             	mov    %rsp,%rbp
+  801321:	48 83 ec 28          	sub    $0x28,%rsp
+  801325:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801329:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80132d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801331:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801335:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801339:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801340:	00 
+  801341:	eb 2a                	jmp    80136d <strncpy+0x50>
+    *dst++ = *src;
+  801343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801347:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80134b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80134f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801353:	0f b6 12             	movzbl (%rdx),%edx
+  801356:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801358:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80135c:	0f b6 00             	movzbl (%rax),%eax
+  80135f:	84 c0                	test   %al,%al
+  801361:	74 05                	je     801368 <strncpy+0x4b>
+      src++;
+  801363:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801368:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80136d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801371:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801375:	72 cc                	jb     801343 <strncpy+0x26>
+  return ret;
+  801377:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80137b:	c9                   	leave
+  80137c:	c3                   	ret
+
+000000000080137d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	48 83 ec 28          	sub    $0x28,%rsp
+  801385:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801389:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80138d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801391:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801395:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801399:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80139e:	74 3d                	je     8013dd <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8013a0:	eb 1d                	jmp    8013bf <strlcpy+0x42>
+      *dst++ = *src++;
+  8013a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013a6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013ba:	0f b6 12             	movzbl (%rdx),%edx
+  8013bd:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8013bf:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013c4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013c9:	74 0b                	je     8013d6 <strlcpy+0x59>
+  8013cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013cf:	0f b6 00             	movzbl (%rax),%eax
+  8013d2:	84 c0                	test   %al,%al
+  8013d4:	75 cc                	jne    8013a2 <strlcpy+0x25>
+    *dst = '\0';
+  8013d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013da:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8013dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8013e5:	c9                   	leave
+  8013e6:	c3                   	ret
+
+00000000008013e7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8013ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8013fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013ff:	48 89 c7             	mov    %rax,%rdi
+  801402:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  801409:	00 00 00 
+  80140c:	ff d0                	call   *%rax
+  80140e:	48 98                	cltq
+  801410:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801414:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801418:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80141c:	48 89 d6             	mov    %rdx,%rsi
+  80141f:	48 89 c7             	mov    %rax,%rdi
+  801422:	48 b8 4d 12 80 00 00 	movabs $0x80124d,%rax
+  801429:	00 00 00 
+  80142c:	ff d0                	call   *%rax
+  80142e:	48 98                	cltq
+  801430:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801434:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801438:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80143c:	75 10                	jne    80144e <strlcat+0x67>
+    return maxlen + srclen;
+  80143e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801446:	48 01 d0             	add    %rdx,%rax
+  801449:	e9 86 00 00 00       	jmp    8014d4 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80144e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801452:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801456:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80145a:	73 2b                	jae    801487 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80145c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801460:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801464:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80146c:	48 01 c1             	add    %rax,%rcx
+  80146f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801473:	48 89 c6             	mov    %rax,%rsi
+  801476:	48 89 cf             	mov    %rcx,%rdi
+  801479:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  801480:	00 00 00 
+  801483:	ff d0                	call   *%rax
+  801485:	eb 42                	jmp    8014c9 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801487:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80148b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80148f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801493:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801497:	48 01 c1             	add    %rax,%rcx
+  80149a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149e:	48 89 c6             	mov    %rax,%rsi
+  8014a1:	48 89 cf             	mov    %rcx,%rdi
+  8014a4:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  8014ab:	00 00 00 
+  8014ae:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8014b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014b8:	48 01 d0             	add    %rdx,%rax
+  8014bb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c3:	48 01 d0             	add    %rdx,%rax
+  8014c6:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8014c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d1:	48 01 d0             	add    %rdx,%rax
+}
+  8014d4:	c9                   	leave
+  8014d5:	c3                   	ret
+
+00000000008014d6 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8014d6:	55                   	push   %rbp
+  8014d7:	48 89 e5             	mov    %rsp,%rbp
+  8014da:	48 83 ec 10          	sub    $0x10,%rsp
+  8014de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8014e6:	eb 0a                	jmp    8014f2 <strcmp+0x1c>
+    p++, q++;
+  8014e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014ed:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8014f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f6:	0f b6 00             	movzbl (%rax),%eax
+  8014f9:	84 c0                	test   %al,%al
+  8014fb:	74 12                	je     80150f <strcmp+0x39>
+  8014fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801501:	0f b6 10             	movzbl (%rax),%edx
+  801504:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801508:	0f b6 00             	movzbl (%rax),%eax
+  80150b:	38 c2                	cmp    %al,%dl
+  80150d:	74 d9                	je     8014e8 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80150f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801513:	0f b6 00             	movzbl (%rax),%eax
+  801516:	0f b6 d0             	movzbl %al,%edx
+  801519:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151d:	0f b6 00             	movzbl (%rax),%eax
+  801520:	0f b6 c0             	movzbl %al,%eax
+  801523:	29 c2                	sub    %eax,%edx
+  801525:	89 d0                	mov    %edx,%eax
+}
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+0000000000801529 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	48 83 ec 18          	sub    $0x18,%rsp
+  801531:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801535:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801539:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80153d:	eb 0f                	jmp    80154e <strncmp+0x25>
+    n--, p++, q++;
+  80153f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801544:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801549:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80154e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801553:	74 1d                	je     801572 <strncmp+0x49>
+  801555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801559:	0f b6 00             	movzbl (%rax),%eax
+  80155c:	84 c0                	test   %al,%al
+  80155e:	74 12                	je     801572 <strncmp+0x49>
+  801560:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801564:	0f b6 10             	movzbl (%rax),%edx
+  801567:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80156b:	0f b6 00             	movzbl (%rax),%eax
+  80156e:	38 c2                	cmp    %al,%dl
+  801570:	74 cd                	je     80153f <strncmp+0x16>
+  if (n == 0)
+  801572:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801577:	75 07                	jne    801580 <strncmp+0x57>
+    return 0;
+  801579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157e:	eb 16                	jmp    801596 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801584:	0f b6 00             	movzbl (%rax),%eax
+  801587:	0f b6 d0             	movzbl %al,%edx
+  80158a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80158e:	0f b6 00             	movzbl (%rax),%eax
+  801591:	0f b6 c0             	movzbl %al,%eax
+  801594:	29 c2                	sub    %eax,%edx
+}
+  801596:	89 d0                	mov    %edx,%eax
+  801598:	c9                   	leave
+  801599:	c3                   	ret
+
+000000000080159a <strchr>:
+strchr(const char *s, char c) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	48 83 ec 60          	sub    $0x60,%rsp
+  8015a2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8015a6:	89 f0                	mov    %esi,%eax
+  8015a8:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8015ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015af:	83 e0 0f             	and    $0xf,%eax
+  8015b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8015b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015b8:	48 f7 d8             	neg    %rax
+  8015bb:	48 89 c2             	mov    %rax,%rdx
+  8015be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015c2:	48 01 d0             	add    %rdx,%rax
+  8015c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8015c9:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015cd:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8015d1:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8015d5:	66 0f 6e c0          	movd   %eax,%xmm0
+  8015d9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8015dd:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8015e1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8015e6:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8015ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ee:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015f2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8015f6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015fb:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801600:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801604:	89 c2                	mov    %eax,%edx
+  801606:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80160b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801610:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801614:	09 c2                	or     %eax,%edx
+  801616:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801619:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80161e:	89 c1                	mov    %eax,%ecx
+  801620:	d3 e6                	shl    %cl,%esi
+  801622:	89 f0                	mov    %esi,%eax
+  801624:	21 d0                	and    %edx,%eax
+  801626:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801629:	eb 34                	jmp    80165f <strchr+0xc5>
+    p += 16;
+  80162b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801630:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801634:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801638:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80163c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801641:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801646:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80164a:	89 c2                	mov    %eax,%edx
+  80164c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801651:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801656:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80165a:	09 d0                	or     %edx,%eax
+  80165c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80165f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801663:	74 c6                	je     80162b <strchr+0x91>
+  p += __builtin_ctz(m);
+  801665:	31 c0                	xor    %eax,%eax
+  801667:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80166c:	48 98                	cltq
+  80166e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801672:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801676:	0f b6 00             	movzbl (%rax),%eax
+  801679:	84 c0                	test   %al,%al
+  80167b:	74 06                	je     801683 <strchr+0xe9>
+  80167d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801681:	eb 05                	jmp    801688 <strchr+0xee>
+  801683:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801688:	c9                   	leave
+  801689:	c3                   	ret
+
+000000000080168a <strfind>:
+strfind(const char *s, char c) {
+  80168a:	55                   	push   %rbp
+  80168b:	48 89 e5             	mov    %rsp,%rbp
+  80168e:	48 83 ec 10          	sub    $0x10,%rsp
+  801692:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801696:	89 f0                	mov    %esi,%eax
+  801698:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80169b:	eb 11                	jmp    8016ae <strfind+0x24>
+    if (*s == c)
+  80169d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a1:	0f b6 00             	movzbl (%rax),%eax
+  8016a4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016a7:	74 12                	je     8016bb <strfind+0x31>
+  for (; *s; s++)
+  8016a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b2:	0f b6 00             	movzbl (%rax),%eax
+  8016b5:	84 c0                	test   %al,%al
+  8016b7:	75 e4                	jne    80169d <strfind+0x13>
+  8016b9:	eb 01                	jmp    8016bc <strfind+0x32>
+      break;
+  8016bb:	90                   	nop
+  return (char *)s;
+  8016bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+
+00000000008016c2 <memset>:
+memset(void *v, int c, size_t n) {
+  8016c2:	55                   	push   %rbp
+  8016c3:	48 89 e5             	mov    %rsp,%rbp
+  8016c6:	48 83 ec 38          	sub    $0x38,%rsp
+  8016ca:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8016ce:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8016d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8016d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8016dd:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8016e2:	76 41                	jbe    801725 <memset+0x63>
+  8016e4:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  8016eb:	00 00 00 
+  8016ee:	ff d0                	call   *%rax
+  8016f0:	83 e0 01             	and    $0x1,%eax
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	74 2e                	je     801725 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8016f7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801702:	48 89 ce             	mov    %rcx,%rsi
+  801705:	48 89 f7             	mov    %rsi,%rdi
+  801708:	48 89 d1             	mov    %rdx,%rcx
+  80170b:	fc                   	cld
+  80170c:	f3 aa                	rep stos %al,%es:(%rdi)
+  80170e:	48 89 ca             	mov    %rcx,%rdx
+  801711:	48 89 fe             	mov    %rdi,%rsi
+  801714:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801718:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80171c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801720:	e9 a7 00 00 00       	jmp    8017cc <memset+0x10a>
+  if (n >= 8) {
+  801725:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80172a:	0f 86 87 00 00 00    	jbe    8017b7 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801730:	eb 16                	jmp    801748 <memset+0x86>
+      *p++ = c;
+  801732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801736:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80173a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80173e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801741:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801743:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801748:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174c:	83 e0 07             	and    $0x7,%eax
+  80174f:	48 85 c0             	test   %rax,%rax
+  801752:	75 de                	jne    801732 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801754:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801757:	0f b6 c0             	movzbl %al,%eax
+  80175a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801761:	01 01 01 
+  801764:	48 0f af c2          	imul   %rdx,%rax
+  801768:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80176c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801770:	48 c1 e8 03          	shr    $0x3,%rax
+  801774:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801780:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801784:	48 89 ce             	mov    %rcx,%rsi
+  801787:	48 89 f7             	mov    %rsi,%rdi
+  80178a:	48 89 d1             	mov    %rdx,%rcx
+  80178d:	fc                   	cld
+  80178e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801791:	48 89 ca             	mov    %rcx,%rdx
+  801794:	48 89 fe             	mov    %rdi,%rsi
+  801797:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80179b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80179f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8017a4:	eb 11                	jmp    8017b7 <memset+0xf5>
+    *p++ = c;
+  8017a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017ae:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017b2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017b5:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8017b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017bb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017c3:	48 85 c0             	test   %rax,%rax
+  8017c6:	75 de                	jne    8017a6 <memset+0xe4>
+  return v;
+  8017c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+00000000008017ce <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8017d6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017da:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8017e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8017ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8017f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017fa:	0f 83 da 00 00 00    	jae    8018da <memmove+0x10c>
+  801800:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801804:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801808:	48 01 d0             	add    %rdx,%rax
+  80180b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80180f:	0f 83 c5 00 00 00    	jae    8018da <memmove+0x10c>
+    s += n;
+  801815:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801819:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80181d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801821:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801825:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80182a:	0f 86 94 00 00 00    	jbe    8018c4 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801830:	eb 1c                	jmp    80184e <memmove+0x80>
+        *--d = *--s;
+  801832:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801837:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80183c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801840:	0f b6 10             	movzbl (%rax),%edx
+  801843:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801847:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801849:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80184e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801852:	83 e0 07             	and    $0x7,%eax
+  801855:	48 85 c0             	test   %rax,%rax
+  801858:	75 d8                	jne    801832 <memmove+0x64>
+      nq = n / 8;
+  80185a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80185e:	48 c1 e8 03          	shr    $0x3,%rax
+  801862:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801866:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  80186b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801870:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801875:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801879:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80187d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801881:	48 89 cf             	mov    %rcx,%rdi
+  801884:	48 89 d6             	mov    %rdx,%rsi
+  801887:	48 89 c1             	mov    %rax,%rcx
+  80188a:	fd                   	std
+  80188b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80188e:	fc                   	cld
+  80188f:	48 89 c8             	mov    %rcx,%rax
+  801892:	48 89 f2             	mov    %rsi,%rdx
+  801895:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801899:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80189d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8018a1:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8018a6:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8018ab:	eb 17                	jmp    8018c4 <memmove+0xf6>
+      *--d = *--s;
+  8018ad:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018b2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018bb:	0f b6 10             	movzbl (%rax),%edx
+  8018be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018c8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018d0:	48 85 c0             	test   %rax,%rax
+  8018d3:	75 d8                	jne    8018ad <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8018d5:	e9 f4 00 00 00       	jmp    8019ce <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8018da:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8018df:	76 46                	jbe    801927 <memmove+0x159>
+  8018e1:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+  8018ed:	83 e0 01             	and    $0x1,%eax
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	74 33                	je     801927 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8018f4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801900:	48 89 cf             	mov    %rcx,%rdi
+  801903:	48 89 d6             	mov    %rdx,%rsi
+  801906:	48 89 c1             	mov    %rax,%rcx
+  801909:	fc                   	cld
+  80190a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80190c:	48 89 c8             	mov    %rcx,%rax
+  80190f:	48 89 f2             	mov    %rsi,%rdx
+  801912:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801916:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80191a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80191e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801922:	e9 ab 00 00 00       	jmp    8019d2 <memmove+0x204>
+    if (n >= 8) {
+  801927:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80192c:	0f 86 8b 00 00 00    	jbe    8019bd <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801932:	eb 22                	jmp    801956 <memmove+0x188>
+        *d++ = *s++;
+  801934:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801938:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80193c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801940:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801944:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801948:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80194c:	0f b6 12             	movzbl (%rdx),%edx
+  80194f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801951:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195a:	83 e0 07             	and    $0x7,%eax
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	75 d2                	jne    801934 <memmove+0x166>
+      nq = n / 8;
+  801962:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801966:	48 c1 e8 03          	shr    $0x3,%rax
+  80196a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80196e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801972:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80197a:	48 89 cf             	mov    %rcx,%rdi
+  80197d:	48 89 d6             	mov    %rdx,%rsi
+  801980:	48 89 c1             	mov    %rax,%rcx
+  801983:	fc                   	cld
+  801984:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801987:	48 89 c8             	mov    %rcx,%rax
+  80198a:	48 89 f2             	mov    %rsi,%rdx
+  80198d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801991:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801995:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801999:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80199e:	eb 1d                	jmp    8019bd <memmove+0x1ef>
+      *d++ = *s++;
+  8019a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019a4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019b4:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019b8:	0f b6 12             	movzbl (%rdx),%edx
+  8019bb:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019c1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019c9:	48 85 c0             	test   %rax,%rax
+  8019cc:	75 d2                	jne    8019a0 <memmove+0x1d2>
+  return dst;
+  8019ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+
+00000000008019d4 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8019dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8019e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f4:	48 89 ce             	mov    %rcx,%rsi
+  8019f7:	48 89 c7             	mov    %rax,%rdi
+  8019fa:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  801a01:	00 00 00 
+  801a04:	ff d0                	call   *%rax
+}
+  801a06:	c9                   	leave
+  801a07:	c3                   	ret
+
+0000000000801a08 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a08:	55                   	push   %rbp
+  801a09:	48 89 e5             	mov    %rsp,%rbp
+  801a0c:	48 83 ec 40          	sub    $0x40,%rsp
+  801a10:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a14:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a18:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801a1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801a24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a28:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801a2c:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801a31:	0f 86 a7 00 00 00    	jbe    801ade <memcmp+0xd6>
+  801a37:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  801a3e:	00 00 00 
+  801a41:	ff d0                	call   *%rax
+  801a43:	83 e0 02             	and    $0x2,%eax
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	0f 84 90 00 00 00    	je     801ade <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801a4e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a52:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a5a:	48 89 ce             	mov    %rcx,%rsi
+  801a5d:	48 89 c7             	mov    %rax,%rdi
+  801a60:	48 b8 ef 0f 80 00 00 	movabs $0x800fef,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+  801a6c:	e9 c2 00 00 00       	jmp    801b33 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801a71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a75:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a79:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a81:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a85:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801a89:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a8d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801a90:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801a97:	74 36                	je     801acf <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801a99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a9c:	f7 d0                	not    %eax
+  801a9e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801aa2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801aa5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801aa8:	48 63 d0             	movslq %eax,%rdx
+  801aab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aaf:	48 01 d0             	add    %rdx,%rax
+  801ab2:	0f b6 00             	movzbl (%rax),%eax
+  801ab5:	0f b6 c0             	movzbl %al,%eax
+  801ab8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801abb:	48 63 ca             	movslq %edx,%rcx
+  801abe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ac2:	48 01 ca             	add    %rcx,%rdx
+  801ac5:	0f b6 12             	movzbl (%rdx),%edx
+  801ac8:	0f b6 d2             	movzbl %dl,%edx
+  801acb:	29 d0                	sub    %edx,%eax
+  801acd:	eb 64                	jmp    801b33 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801acf:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ad4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801ad9:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801ade:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801ae3:	77 8c                	ja     801a71 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801ae5:	eb 36                	jmp    801b1d <memcmp+0x115>
+    if (*s1 != *s2)
+  801ae7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aeb:	0f b6 10             	movzbl (%rax),%edx
+  801aee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af2:	0f b6 00             	movzbl (%rax),%eax
+  801af5:	38 c2                	cmp    %al,%dl
+  801af7:	74 1a                	je     801b13 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afd:	0f b6 00             	movzbl (%rax),%eax
+  801b00:	0f b6 c8             	movzbl %al,%ecx
+  801b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b07:	0f b6 00             	movzbl (%rax),%eax
+  801b0a:	0f b6 d0             	movzbl %al,%edx
+  801b0d:	89 c8                	mov    %ecx,%eax
+  801b0f:	29 d0                	sub    %edx,%eax
+  801b11:	eb 20                	jmp    801b33 <memcmp+0x12b>
+    s1++, s2++;
+  801b13:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b18:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801b1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b21:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b25:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b29:	48 85 c0             	test   %rax,%rax
+  801b2c:	75 b9                	jne    801ae7 <memcmp+0xdf>
+  }
+
+  return 0;
+  801b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b33:	c9                   	leave
+  801b34:	c3                   	ret
+
+0000000000801b35 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801b35:	55                   	push   %rbp
+  801b36:	48 89 e5             	mov    %rsp,%rbp
+  801b39:	48 83 ec 50          	sub    $0x50,%rsp
+  801b3d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b41:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801b44:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801b48:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b4c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b50:	48 01 d0             	add    %rdx,%rax
+  801b53:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801b57:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b5a:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b5e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b62:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b66:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b6b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b6f:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801b74:	76 73                	jbe    801be9 <memfind+0xb4>
+  801b76:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+  801b82:	83 e0 02             	and    $0x2,%eax
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	74 60                	je     801be9 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801b89:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b8c:	0f b6 c8             	movzbl %al,%ecx
+  801b8f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b97:	89 ce                	mov    %ecx,%esi
+  801b99:	48 89 c7             	mov    %rax,%rdi
+  801b9c:	48 b8 de 10 80 00 00 	movabs $0x8010de,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	eb 6c                	jmp    801c16 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801baa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bae:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bb2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bb6:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801bbb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bbf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bc3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bc6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801bca:	74 13                	je     801bdf <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801bcc:	31 c0                	xor    %eax,%eax
+  801bce:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801bd3:	48 63 d0             	movslq %eax,%rdx
+  801bd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bda:	48 01 d0             	add    %rdx,%rax
+  801bdd:	eb 37                	jmp    801c16 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801bdf:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801be4:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801be9:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801bee:	77 ba                	ja     801baa <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801bf0:	eb 13                	jmp    801c05 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801bf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf6:	0f b6 00             	movzbl (%rax),%eax
+  801bf9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801bfc:	38 d0                	cmp    %dl,%al
+  801bfe:	74 11                	je     801c11 <memfind+0xdc>
+  for (; s < ends; s++)
+  801c00:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c09:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c0d:	72 e3                	jb     801bf2 <memfind+0xbd>
+  801c0f:	eb 01                	jmp    801c12 <memfind+0xdd>
+      break;
+  801c11:	90                   	nop
+  return (void *)s;
+  801c12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c16:	c9                   	leave
+  801c17:	c3                   	ret
+
+0000000000801c18 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801c18:	55                   	push   %rbp
+  801c19:	48 89 e5             	mov    %rsp,%rbp
+  801c1c:	48 83 ec 38          	sub    $0x38,%rsp
+  801c20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c24:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c28:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801c2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801c32:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c39:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801c3a:	eb 05                	jmp    801c41 <strtol+0x29>
+    s++;
+  801c3c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801c41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c45:	0f b6 00             	movzbl (%rax),%eax
+  801c48:	3c 20                	cmp    $0x20,%al
+  801c4a:	74 f0                	je     801c3c <strtol+0x24>
+  801c4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c50:	0f b6 00             	movzbl (%rax),%eax
+  801c53:	3c 09                	cmp    $0x9,%al
+  801c55:	74 e5                	je     801c3c <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801c57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5b:	0f b6 00             	movzbl (%rax),%eax
+  801c5e:	3c 2b                	cmp    $0x2b,%al
+  801c60:	75 07                	jne    801c69 <strtol+0x51>
+    s++;
+  801c62:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c67:	eb 17                	jmp    801c80 <strtol+0x68>
+  else if (*s == '-')
+  801c69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6d:	0f b6 00             	movzbl (%rax),%eax
+  801c70:	3c 2d                	cmp    $0x2d,%al
+  801c72:	75 0c                	jne    801c80 <strtol+0x68>
+    s++, neg = 1;
+  801c74:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c79:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c80:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c84:	74 06                	je     801c8c <strtol+0x74>
+  801c86:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c8a:	75 28                	jne    801cb4 <strtol+0x9c>
+  801c8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c90:	0f b6 00             	movzbl (%rax),%eax
+  801c93:	3c 30                	cmp    $0x30,%al
+  801c95:	75 1d                	jne    801cb4 <strtol+0x9c>
+  801c97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9b:	48 83 c0 01          	add    $0x1,%rax
+  801c9f:	0f b6 00             	movzbl (%rax),%eax
+  801ca2:	3c 78                	cmp    $0x78,%al
+  801ca4:	75 0e                	jne    801cb4 <strtol+0x9c>
+    s += 2, base = 16;
+  801ca6:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cab:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cb2:	eb 2c                	jmp    801ce0 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801cb4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cb8:	75 19                	jne    801cd3 <strtol+0xbb>
+  801cba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cbe:	0f b6 00             	movzbl (%rax),%eax
+  801cc1:	3c 30                	cmp    $0x30,%al
+  801cc3:	75 0e                	jne    801cd3 <strtol+0xbb>
+    s++, base = 8;
+  801cc5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cca:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801cd1:	eb 0d                	jmp    801ce0 <strtol+0xc8>
+  else if (base == 0)
+  801cd3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cd7:	75 07                	jne    801ce0 <strtol+0xc8>
+    base = 10;
+  801cd9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801ce0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce4:	0f b6 00             	movzbl (%rax),%eax
+  801ce7:	3c 2f                	cmp    $0x2f,%al
+  801ce9:	7e 1d                	jle    801d08 <strtol+0xf0>
+  801ceb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cef:	0f b6 00             	movzbl (%rax),%eax
+  801cf2:	3c 39                	cmp    $0x39,%al
+  801cf4:	7f 12                	jg     801d08 <strtol+0xf0>
+      dig = *s - '0';
+  801cf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfa:	0f b6 00             	movzbl (%rax),%eax
+  801cfd:	0f be c0             	movsbl %al,%eax
+  801d00:	83 e8 30             	sub    $0x30,%eax
+  801d03:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d06:	eb 4e                	jmp    801d56 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0c:	0f b6 00             	movzbl (%rax),%eax
+  801d0f:	3c 60                	cmp    $0x60,%al
+  801d11:	7e 1d                	jle    801d30 <strtol+0x118>
+  801d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d17:	0f b6 00             	movzbl (%rax),%eax
+  801d1a:	3c 7a                	cmp    $0x7a,%al
+  801d1c:	7f 12                	jg     801d30 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801d1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d22:	0f b6 00             	movzbl (%rax),%eax
+  801d25:	0f be c0             	movsbl %al,%eax
+  801d28:	83 e8 57             	sub    $0x57,%eax
+  801d2b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d2e:	eb 26                	jmp    801d56 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801d30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d34:	0f b6 00             	movzbl (%rax),%eax
+  801d37:	3c 40                	cmp    $0x40,%al
+  801d39:	7e 47                	jle    801d82 <strtol+0x16a>
+  801d3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3f:	0f b6 00             	movzbl (%rax),%eax
+  801d42:	3c 5a                	cmp    $0x5a,%al
+  801d44:	7f 3c                	jg     801d82 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801d46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4a:	0f b6 00             	movzbl (%rax),%eax
+  801d4d:	0f be c0             	movsbl %al,%eax
+  801d50:	83 e8 37             	sub    $0x37,%eax
+  801d53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801d56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d59:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d5c:	7d 23                	jge    801d81 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d5e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d63:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d66:	48 98                	cltq
+  801d68:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d6d:	48 89 c2             	mov    %rax,%rdx
+  801d70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d73:	48 98                	cltq
+  801d75:	48 01 d0             	add    %rdx,%rax
+  801d78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801d7c:	e9 5f ff ff ff       	jmp    801ce0 <strtol+0xc8>
+      break;
+  801d81:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801d82:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d87:	74 0b                	je     801d94 <strtol+0x17c>
+    *endptr = (char *)s;
+  801d89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d8d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d91:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801d94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d98:	74 09                	je     801da3 <strtol+0x18b>
+  801d9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d9e:	48 f7 d8             	neg    %rax
+  801da1:	eb 04                	jmp    801da7 <strtol+0x18f>
+  801da3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801da7:	c9                   	leave
+  801da8:	c3                   	ret
+
+0000000000801da9 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	53                   	push   %rbx
+  801dae:	48 83 ec 48          	sub    $0x48,%rsp
+  801db2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801db6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dbe:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801dc2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801dc6:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801dca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dce:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801dd2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801dd6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801dda:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801dde:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801de2:	4c 89 c3             	mov    %r8,%rbx
+  801de5:	cd 30                	int    $0x30
+  801de7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801deb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801df0:	74 46                	je     801e38 <syscall+0x8f>
+  801df2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801df7:	7e 3f                	jle    801e38 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801df9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dfd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e01:	49 89 d0             	mov    %rdx,%r8
+  801e04:	48 89 c1             	mov    %rax,%rcx
+  801e07:	48 b8 e8 55 80 00 00 	movabs $0x8055e8,%rax
+  801e0e:	00 00 00 
+  801e11:	48 89 c2             	mov    %rax,%rdx
+  801e14:	be 22 00 00 00       	mov    $0x22,%esi
+  801e19:	48 b8 07 56 80 00 00 	movabs $0x805607,%rax
+  801e20:	00 00 00 
+  801e23:	48 89 c7             	mov    %rax,%rdi
+  801e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2b:	49 b9 84 4e 80 00 00 	movabs $0x804e84,%r9
+  801e32:	00 00 00 
+  801e35:	41 ff d1             	call   *%r9
+
+  return ret;
+  801e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e40:	c9                   	leave
+  801e41:	c3                   	ret
+
+0000000000801e42 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e42:	55                   	push   %rbp
+  801e43:	48 89 e5             	mov    %rsp,%rbp
+  801e46:	48 83 ec 10          	sub    $0x10,%rsp
+  801e4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e5a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5e:	6a 00                	push   $0x0
+  801e60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e6c:	48 89 d1             	mov    %rdx,%rcx
+  801e6f:	48 89 c2             	mov    %rax,%rdx
+  801e72:	be 00 00 00 00       	mov    $0x0,%esi
+  801e77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e7c:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801e83:	00 00 00 
+  801e86:	ff d0                	call   *%rax
+  801e88:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e8c:	90                   	nop
+  801e8d:	c9                   	leave
+  801e8e:	c3                   	ret
+
+0000000000801e8f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e93:	48 83 ec 08          	sub    $0x8,%rsp
+  801e97:	6a 00                	push   $0x0
+  801e99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ea5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb4:	bf 01 00 00 00       	mov    $0x1,%edi
+  801eb9:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+  801ec5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec9:	c9                   	leave
+  801eca:	c3                   	ret
+
+0000000000801ecb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ecb:	55                   	push   %rbp
+  801ecc:	48 89 e5             	mov    %rsp,%rbp
+  801ecf:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801ed6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ed9:	48 98                	cltq
+  801edb:	48 83 ec 08          	sub    $0x8,%rsp
+  801edf:	6a 00                	push   $0x0
+  801ee1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ee7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ef2:	48 89 c2             	mov    %rax,%rdx
+  801ef5:	be 01 00 00 00       	mov    $0x1,%esi
+  801efa:	bf 03 00 00 00       	mov    $0x3,%edi
+  801eff:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801f06:	00 00 00 
+  801f09:	ff d0                	call   *%rax
+  801f0b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f0f:	c9                   	leave
+  801f10:	c3                   	ret
+
+0000000000801f11 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f11:	55                   	push   %rbp
+  801f12:	48 89 e5             	mov    %rsp,%rbp
+  801f15:	48 83 ec 10          	sub    $0x10,%rsp
+  801f19:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801f1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f1f:	48 98                	cltq
+  801f21:	48 83 ec 08          	sub    $0x8,%rsp
+  801f25:	6a 00                	push   $0x0
+  801f27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f38:	48 89 c2             	mov    %rax,%rdx
+  801f3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f40:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f45:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+  801f51:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f55:	90                   	nop
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+0000000000801f58 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801f58:	55                   	push   %rbp
+  801f59:	48 89 e5             	mov    %rsp,%rbp
+  801f5c:	48 83 ec 20          	sub    $0x20,%rsp
+  801f60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f6a:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801f6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f72:	cd 30                	int    $0x30
+  801f74:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f78:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801f7c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f81:	7e 3d                	jle    801fc0 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801f83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f87:	49 89 c0             	mov    %rax,%r8
+  801f8a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f8f:	48 b8 e8 55 80 00 00 	movabs $0x8055e8,%rax
+  801f96:	00 00 00 
+  801f99:	48 89 c2             	mov    %rax,%rdx
+  801f9c:	be 49 00 00 00       	mov    $0x49,%esi
+  801fa1:	48 b8 07 56 80 00 00 	movabs $0x805607,%rax
+  801fa8:	00 00 00 
+  801fab:	48 89 c7             	mov    %rax,%rdi
+  801fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb3:	49 b9 84 4e 80 00 00 	movabs $0x804e84,%r9
+  801fba:	00 00 00 
+  801fbd:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801fc0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fc5:	75 13                	jne    801fda <sys_env_wait+0x82>
+  801fc7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801fcc:	74 0c                	je     801fda <sys_env_wait+0x82>
+    *status = st;
+  801fce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fd2:	89 c2                	mov    %eax,%edx
+  801fd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fd8:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801fda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801fe4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe8:	6a 00                	push   $0x0
+  801fea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ff0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ff6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ffb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802000:	be 00 00 00 00       	mov    $0x0,%esi
+  802005:	bf 02 00 00 00       	mov    $0x2,%edi
+  80200a:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80201a:	c9                   	leave
+  80201b:	c3                   	ret
+
+000000000080201c <sys_yield>:
+
+void
+sys_yield(void) {
+  80201c:	55                   	push   %rbp
+  80201d:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802020:	48 83 ec 08          	sub    $0x8,%rsp
+  802024:	6a 00                	push   $0x0
+  802026:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80202c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802032:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802037:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203c:	be 00 00 00 00       	mov    $0x0,%esi
+  802041:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802046:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  80204d:	00 00 00 
+  802050:	ff d0                	call   *%rax
+  802052:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802056:	90                   	nop
+  802057:	c9                   	leave
+  802058:	c3                   	ret
+
+0000000000802059 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802059:	55                   	push   %rbp
+  80205a:	48 89 e5             	mov    %rsp,%rbp
+  80205d:	48 83 ec 20          	sub    $0x20,%rsp
+  802061:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802064:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802068:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80206b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80206e:	48 63 c8             	movslq %eax,%rcx
+  802071:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802075:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802078:	48 98                	cltq
+  80207a:	48 83 ec 08          	sub    $0x8,%rsp
+  80207e:	6a 00                	push   $0x0
+  802080:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802086:	49 89 c8             	mov    %rcx,%r8
+  802089:	48 89 d1             	mov    %rdx,%rcx
+  80208c:	48 89 c2             	mov    %rax,%rdx
+  80208f:	be 01 00 00 00       	mov    $0x1,%esi
+  802094:	bf 06 00 00 00       	mov    $0x6,%edi
+  802099:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	48 83 c4 10          	add    $0x10,%rsp
+  8020a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8020ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020af:	c9                   	leave
+  8020b0:	c3                   	ret
+
+00000000008020b1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8020b1:	55                   	push   %rbp
+  8020b2:	48 89 e5             	mov    %rsp,%rbp
+  8020b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8020b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020c0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020c7:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8020cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8020ce:	48 63 c8             	movslq %eax,%rcx
+  8020d1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020d8:	48 63 f0             	movslq %eax,%rsi
+  8020db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020e2:	48 98                	cltq
+  8020e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e8:	51                   	push   %rcx
+  8020e9:	49 89 f9             	mov    %rdi,%r9
+  8020ec:	49 89 f0             	mov    %rsi,%r8
+  8020ef:	48 89 d1             	mov    %rdx,%rcx
+  8020f2:	48 89 c2             	mov    %rax,%rdx
+  8020f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8020fa:	bf 07 00 00 00       	mov    $0x7,%edi
+  8020ff:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+
+0000000000802111 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802111:	55                   	push   %rbp
+  802112:	48 89 e5             	mov    %rsp,%rbp
+  802115:	48 83 ec 10          	sub    $0x10,%rsp
+  802119:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80211c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802120:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802124:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802127:	48 98                	cltq
+  802129:	48 83 ec 08          	sub    $0x8,%rsp
+  80212d:	6a 00                	push   $0x0
+  80212f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80213b:	48 89 d1             	mov    %rdx,%rcx
+  80213e:	48 89 c2             	mov    %rax,%rdx
+  802141:	be 01 00 00 00       	mov    $0x1,%esi
+  802146:	bf 08 00 00 00       	mov    $0x8,%edi
+  80214b:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802152:	00 00 00 
+  802155:	ff d0                	call   *%rax
+  802157:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+
+000000000080215d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80215d:	55                   	push   %rbp
+  80215e:	48 89 e5             	mov    %rsp,%rbp
+  802161:	48 83 ec 10          	sub    $0x10,%rsp
+  802165:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802168:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80216b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80216e:	48 63 d0             	movslq %eax,%rdx
+  802171:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802174:	48 98                	cltq
+  802176:	48 83 ec 08          	sub    $0x8,%rsp
+  80217a:	6a 00                	push   $0x0
+  80217c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802182:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802188:	48 89 d1             	mov    %rdx,%rcx
+  80218b:	48 89 c2             	mov    %rax,%rdx
+  80218e:	be 01 00 00 00       	mov    $0x1,%esi
+  802193:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802198:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  80219f:	00 00 00 
+  8021a2:	ff d0                	call   *%rax
+  8021a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a8:	c9                   	leave
+  8021a9:	c3                   	ret
+
+00000000008021aa <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8021aa:	55                   	push   %rbp
+  8021ab:	48 89 e5             	mov    %rsp,%rbp
+  8021ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8021b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8021b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021c0:	48 98                	cltq
+  8021c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c6:	6a 00                	push   $0x0
+  8021c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d4:	48 89 d1             	mov    %rdx,%rcx
+  8021d7:	48 89 c2             	mov    %rax,%rdx
+  8021da:	be 01 00 00 00       	mov    $0x1,%esi
+  8021df:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021e4:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+  8021f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+00000000008021f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8021f6:	55                   	push   %rbp
+  8021f7:	48 89 e5             	mov    %rsp,%rbp
+  8021fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802201:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802205:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802209:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80220c:	48 98                	cltq
+  80220e:	48 83 ec 08          	sub    $0x8,%rsp
+  802212:	6a 00                	push   $0x0
+  802214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80221a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802220:	48 89 d1             	mov    %rdx,%rcx
+  802223:	48 89 c2             	mov    %rax,%rdx
+  802226:	be 01 00 00 00       	mov    $0x1,%esi
+  80222b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802230:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+0000000000802242 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802242:	55                   	push   %rbp
+  802243:	48 89 e5             	mov    %rsp,%rbp
+  802246:	48 83 ec 20          	sub    $0x20,%rsp
+  80224a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80224d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802251:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802255:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802258:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80225b:	48 63 f0             	movslq %eax,%rsi
+  80225e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802262:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802266:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802269:	48 98                	cltq
+  80226b:	48 83 ec 08          	sub    $0x8,%rsp
+  80226f:	6a 00                	push   $0x0
+  802271:	49 89 f1             	mov    %rsi,%r9
+  802274:	49 89 c8             	mov    %rcx,%r8
+  802277:	48 89 d1             	mov    %rdx,%rcx
+  80227a:	48 89 c2             	mov    %rax,%rdx
+  80227d:	be 00 00 00 00       	mov    $0x0,%esi
+  802282:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802287:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  80228e:	00 00 00 
+  802291:	ff d0                	call   *%rax
+  802293:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802297:	c9                   	leave
+  802298:	c3                   	ret
+
+0000000000802299 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802299:	55                   	push   %rbp
+  80229a:	48 89 e5             	mov    %rsp,%rbp
+  80229d:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8022a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ad:	6a 00                	push   $0x0
+  8022af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c0:	48 89 c2             	mov    %rax,%rdx
+  8022c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022c8:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8022cd:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8022d4:	00 00 00 
+  8022d7:	ff d0                	call   *%rax
+  8022d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+00000000008022df <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8022ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802309:	48 89 d1             	mov    %rdx,%rcx
+  80230c:	48 89 c2             	mov    %rax,%rdx
+  80230f:	be 01 00 00 00       	mov    $0x1,%esi
+  802314:	bf 10 00 00 00       	mov    $0x10,%edi
+  802319:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802329:	c9                   	leave
+  80232a:	c3                   	ret
+
+000000000080232b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80232b:	55                   	push   %rbp
+  80232c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80232f:	48 83 ec 08          	sub    $0x8,%rsp
+  802333:	6a 00                	push   $0x0
+  802335:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80233b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802341:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234b:	be 00 00 00 00       	mov    $0x0,%esi
+  802350:	bf 11 00 00 00       	mov    $0x11,%edi
+  802355:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802365:	c9                   	leave
+  802366:	c3                   	ret
+
+0000000000802367 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802367:	55                   	push   %rbp
+  802368:	48 89 e5             	mov    %rsp,%rbp
+  80236b:	48 83 ec 10          	sub    $0x10,%rsp
+  80236f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802373:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802377:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80237b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80237f:	48 83 ec 08          	sub    $0x8,%rsp
+  802383:	6a 00                	push   $0x0
+  802385:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80238b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802391:	48 89 d1             	mov    %rdx,%rcx
+  802394:	48 89 c2             	mov    %rax,%rdx
+  802397:	be 00 00 00 00       	mov    $0x0,%esi
+  80239c:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023a1:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8023a8:	00 00 00 
+  8023ab:	ff d0                	call   *%rax
+  8023ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b1:	c9                   	leave
+  8023b2:	c3                   	ret
+
+00000000008023b3 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8023b3:	55                   	push   %rbp
+  8023b4:	48 89 e5             	mov    %rsp,%rbp
+  8023b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8023bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023c3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8023c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023c9:	48 63 c8             	movslq %eax,%rcx
+  8023cc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d8:	6a 00                	push   $0x0
+  8023da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023e0:	49 89 c8             	mov    %rcx,%r8
+  8023e3:	48 89 d1             	mov    %rdx,%rcx
+  8023e6:	48 89 c2             	mov    %rax,%rdx
+  8023e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ee:	bf 13 00 00 00       	mov    $0x13,%edi
+  8023f3:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8023fa:	00 00 00 
+  8023fd:	ff d0                	call   *%rax
+  8023ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802403:	c9                   	leave
+  802404:	c3                   	ret
+
+0000000000802405 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802405:	55                   	push   %rbp
+  802406:	48 89 e5             	mov    %rsp,%rbp
+  802409:	48 83 ec 20          	sub    $0x20,%rsp
+  80240d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802411:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802414:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802418:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80241c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80241f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802423:	48 83 ec 08          	sub    $0x8,%rsp
+  802427:	6a 00                	push   $0x0
+  802429:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80242f:	49 89 c8             	mov    %rcx,%r8
+  802432:	48 89 d1             	mov    %rdx,%rcx
+  802435:	48 89 c2             	mov    %rax,%rdx
+  802438:	be 00 00 00 00       	mov    $0x0,%esi
+  80243d:	bf 14 00 00 00       	mov    $0x14,%edi
+  802442:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802452:	c9                   	leave
+  802453:	c3                   	ret
+
+0000000000802454 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+  802458:	48 83 ec 10          	sub    $0x10,%rsp
+  80245c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802460:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802463:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802466:	48 63 d0             	movslq %eax,%rdx
+  802469:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246d:	48 83 ec 08          	sub    $0x8,%rsp
+  802471:	6a 00                	push   $0x0
+  802473:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802479:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247f:	48 89 d1             	mov    %rdx,%rcx
+  802482:	48 89 c2             	mov    %rax,%rdx
+  802485:	be 00 00 00 00       	mov    $0x0,%esi
+  80248a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80248f:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802496:	00 00 00 
+  802499:	ff d0                	call   *%rax
+  80249b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249f:	c9                   	leave
+  8024a0:	c3                   	ret
+
+00000000008024a1 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+  8024a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8024a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024ad:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024b0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8024b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8024b7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024bb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8024be:	48 63 c8             	movslq %eax,%rcx
+  8024c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024c4:	48 63 d0             	movslq %eax,%rdx
+  8024c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cf:	6a 00                	push   $0x0
+  8024d1:	49 89 f1             	mov    %rsi,%r9
+  8024d4:	49 89 c8             	mov    %rcx,%r8
+  8024d7:	48 89 d1             	mov    %rdx,%rcx
+  8024da:	48 89 c2             	mov    %rax,%rdx
+  8024dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8024e7:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+  8024f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+
+00000000008024f9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+  8024fd:	48 83 ec 30          	sub    $0x30,%rsp
+  802501:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802505:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802509:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80250d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802511:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802515:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802519:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80251d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802521:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802525:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802529:	48 83 ec 08          	sub    $0x8,%rsp
+  80252d:	51                   	push   %rcx
+  80252e:	49 89 f9             	mov    %rdi,%r9
+  802531:	49 89 f0             	mov    %rsi,%r8
+  802534:	48 89 d1             	mov    %rdx,%rcx
+  802537:	48 89 c2             	mov    %rax,%rdx
+  80253a:	be 00 00 00 00       	mov    $0x0,%esi
+  80253f:	bf 17 00 00 00       	mov    $0x17,%edi
+  802544:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+
+0000000000802556 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	48 83 ec 10          	sub    $0x10,%rsp
+  80255e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802561:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802564:	48 98                	cltq
+  802566:	48 83 ec 08          	sub    $0x8,%rsp
+  80256a:	6a 00                	push   $0x0
+  80256c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257d:	48 89 c2             	mov    %rax,%rdx
+  802580:	be 00 00 00 00       	mov    $0x0,%esi
+  802585:	bf 18 00 00 00       	mov    $0x18,%edi
+  80258a:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259a:	90                   	nop
+  80259b:	c9                   	leave
+  80259c:	c3                   	ret
+
+000000000080259d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80259d:	55                   	push   %rbp
+  80259e:	48 89 e5             	mov    %rsp,%rbp
+  8025a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8025a5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025b0:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8025b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025b6:	48 63 f0             	movslq %eax,%rsi
+  8025b9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025c4:	48 98                	cltq
+  8025c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	49 89 f1             	mov    %rsi,%r9
+  8025cf:	49 89 c8             	mov    %rcx,%r8
+  8025d2:	48 89 d1             	mov    %rdx,%rcx
+  8025d5:	48 89 c2             	mov    %rax,%rdx
+  8025d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8025dd:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025e2:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8025e9:	00 00 00 
+  8025ec:	ff d0                	call   *%rax
+  8025ee:	48 83 c4 10          	add    $0x10,%rsp
+  8025f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8025f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8025f8:	c9                   	leave
+  8025f9:	c3                   	ret
+
+00000000008025fa <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+  8025fe:	48 83 ec 20          	sub    $0x20,%rsp
+  802602:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802606:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80260a:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80260d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802610:	48 63 c8             	movslq %eax,%rcx
+  802613:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261b:	48 83 ec 08          	sub    $0x8,%rsp
+  80261f:	6a 00                	push   $0x0
+  802621:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802627:	49 89 c8             	mov    %rcx,%r8
+  80262a:	48 89 d1             	mov    %rdx,%rcx
+  80262d:	48 89 c2             	mov    %rax,%rdx
+  802630:	be 01 00 00 00       	mov    $0x1,%esi
+  802635:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80263a:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  802646:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80264a:	c9                   	leave
+  80264b:	c3                   	ret
+
+000000000080264c <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80264c:	55                   	push   %rbp
+  80264d:	48 89 e5             	mov    %rsp,%rbp
+  802650:	48 83 ec 20          	sub    $0x20,%rsp
+  802654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802658:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80265c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802660:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802664:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80266c:	48 83 ec 08          	sub    $0x8,%rsp
+  802670:	6a 00                	push   $0x0
+  802672:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802678:	49 89 c8             	mov    %rcx,%r8
+  80267b:	48 89 d1             	mov    %rdx,%rcx
+  80267e:	48 89 c2             	mov    %rax,%rdx
+  802681:	be 01 00 00 00       	mov    $0x1,%esi
+  802686:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80268b:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+  802697:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+000000000080269d <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  80269d:	55                   	push   %rbp
+  80269e:	48 89 e5             	mov    %rsp,%rbp
+  8026a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8026a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8026a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026ad:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8026b0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8026b4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026bb:	48 63 c8             	movslq %eax,%rcx
+  8026be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	49 89 f1             	mov    %rsi,%r9
+  8026cf:	49 89 c8             	mov    %rcx,%r8
+  8026d2:	48 89 d1             	mov    %rdx,%rcx
+  8026d5:	48 89 c2             	mov    %rax,%rdx
+  8026d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8026dd:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8026e2:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  8026e9:	00 00 00 
+  8026ec:	ff d0                	call   *%rax
+  8026ee:	48 83 c4 10          	add    $0x10,%rsp
+  8026f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8026f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+00000000008026fa <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802702:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802705:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802708:	48 98                	cltq
+  80270a:	48 83 ec 08          	sub    $0x8,%rsp
+  80270e:	6a 00                	push   $0x0
+  802710:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802721:	48 89 c2             	mov    %rax,%rdx
+  802724:	be 01 00 00 00       	mov    $0x1,%esi
+  802729:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80272e:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802735:	00 00 00 
+  802738:	ff d0                	call   *%rax
+  80273a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80273e:	c9                   	leave
+  80273f:	c3                   	ret
+
+0000000000802740 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	48 83 ec 20          	sub    $0x20,%rsp
+  802748:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80274c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802750:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  802754:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802758:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80275c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802760:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  802767:	48 89 c7             	mov    %rax,%rdi
+  80276a:	48 b8 78 27 80 00 00 	movabs $0x802778,%rax
+  802771:	00 00 00 
+  802774:	ff d0                	call   *%rax
+}
+  802776:	c9                   	leave
+  802777:	c3                   	ret
+
+0000000000802778 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  802778:	55                   	push   %rbp
+  802779:	48 89 e5             	mov    %rsp,%rbp
+  80277c:	48 83 ec 30          	sub    $0x30,%rsp
+  802780:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802784:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802788:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80278c:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  802790:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802795:	75 0e                	jne    8027a5 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  802797:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80279e:	00 00 00 
+  8027a1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8027a5:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8027aa:	75 18                	jne    8027c4 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8027ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027b0:	48 89 c7             	mov    %rax,%rdi
+  8027b3:	48 b8 99 22 80 00 00 	movabs $0x802299,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8027c2:	eb 1d                	jmp    8027e1 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8027c4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027cc:	48 89 d6             	mov    %rdx,%rsi
+  8027cf:	48 89 c7             	mov    %rax,%rdi
+  8027d2:	48 b8 df 22 80 00 00 	movabs $0x8022df,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+  8027de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8027e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8027e5:	79 2a                	jns    802811 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8027e7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8027ec:	74 0a                	je     8027f8 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8027ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8027f8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8027fd:	74 0a                	je     802809 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8027ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802803:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  802809:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80280c:	e9 aa 00 00 00       	jmp    8028bb <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  802811:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802816:	74 36                	je     80284e <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  802818:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80281f:	00 00 00 
+  802822:	8b 40 04             	mov    0x4(%rax),%eax
+  802825:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80282a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802831:	00 00 00 
+  802834:	48 98                	cltq
+  802836:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80283d:	48 01 d0             	add    %rdx,%rax
+  802840:	48 05 24 01 00 00    	add    $0x124,%rax
+  802846:	8b 10                	mov    (%rax),%edx
+  802848:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284c:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80284e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802853:	74 36                	je     80288b <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  802855:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80285c:	00 00 00 
+  80285f:	8b 40 04             	mov    0x4(%rax),%eax
+  802862:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802867:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80286e:	00 00 00 
+  802871:	48 98                	cltq
+  802873:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80287a:	48 01 d0             	add    %rdx,%rax
+  80287d:	48 05 28 01 00 00    	add    $0x128,%rax
+  802883:	8b 10                	mov    (%rax),%edx
+  802885:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802889:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80288b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802892:	00 00 00 
+  802895:	8b 40 04             	mov    0x4(%rax),%eax
+  802898:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80289d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8028a4:	00 00 00 
+  8028a7:	48 98                	cltq
+  8028a9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8028b0:	48 01 d0             	add    %rdx,%rax
+  8028b3:	48 05 20 01 00 00    	add    $0x120,%rax
+  8028b9:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8028bb:	c9                   	leave
+  8028bc:	c3                   	ret
+
+00000000008028bd <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8028bd:	55                   	push   %rbp
+  8028be:	48 89 e5             	mov    %rsp,%rbp
+  8028c1:	48 83 ec 30          	sub    $0x30,%rsp
+  8028c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028c8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8028cb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8028cf:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8028d2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8028d7:	75 5e                	jne    802937 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8028d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8028e0:	00 00 00 
+  8028e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8028e7:	eb 4e                	jmp    802937 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8028e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028ed:	79 3c                	jns    80292b <ipc_send+0x6e>
+  8028ef:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8028f3:	74 36                	je     80292b <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8028f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028f8:	89 c1                	mov    %eax,%ecx
+  8028fa:	48 b8 18 56 80 00 00 	movabs $0x805618,%rax
+  802901:	00 00 00 
+  802904:	48 89 c2             	mov    %rax,%rdx
+  802907:	be 54 00 00 00       	mov    $0x54,%esi
+  80290c:	48 b8 3e 56 80 00 00 	movabs $0x80563e,%rax
+  802913:	00 00 00 
+  802916:	48 89 c7             	mov    %rax,%rdi
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	49 b8 84 4e 80 00 00 	movabs $0x804e84,%r8
+  802925:	00 00 00 
+  802928:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  80292b:	48 b8 1c 20 80 00 00 	movabs $0x80201c,%rax
+  802932:	00 00 00 
+  802935:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  802937:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80293a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80293d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802941:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802944:	89 c7                	mov    %eax,%edi
+  802946:	48 b8 42 22 80 00 00 	movabs $0x802242,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802955:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802959:	75 8e                	jne    8028e9 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  80295b:	48 b8 1c 20 80 00 00 	movabs $0x80201c,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+}
+  802967:	90                   	nop
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+000000000080296a <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	48 83 ec 18          	sub    $0x18,%rsp
+  802972:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  802975:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80297c:	eb 4d                	jmp    8029cb <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80297e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802985:	00 00 00 
+  802988:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80298b:	48 98                	cltq
+  80298d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802994:	48 01 d0             	add    %rdx,%rax
+  802997:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  80299d:	8b 00                	mov    (%rax),%eax
+  80299f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8029a2:	75 23                	jne    8029c7 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8029a4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029ab:	00 00 00 
+  8029ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b1:	48 98                	cltq
+  8029b3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029ba:	48 01 d0             	add    %rdx,%rax
+  8029bd:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029c3:	8b 00                	mov    (%rax),%eax
+  8029c5:	eb 12                	jmp    8029d9 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8029c7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029cb:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8029d2:	7e aa                	jle    80297e <ipc_find_env+0x14>
+  return 0;
+  8029d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d9:	c9                   	leave
+  8029da:	c3                   	ret
+
+00000000008029db <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8029db:	55                   	push   %rbp
+  8029dc:	48 89 e5             	mov    %rsp,%rbp
+  8029df:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8029e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029eb:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8029f2:	ff ff ff 
+  8029f5:	48 01 d0             	add    %rdx,%rax
+  8029f8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8029fc:	c9                   	leave
+  8029fd:	c3                   	ret
+
+00000000008029fe <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8029fe:	55                   	push   %rbp
+  8029ff:	48 89 e5             	mov    %rsp,%rbp
+  802a02:	48 83 ec 08          	sub    $0x8,%rsp
+  802a06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a0e:	48 89 c7             	mov    %rax,%rdi
+  802a11:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+  802a1d:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802a23:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802a27:	c9                   	leave
+  802a28:	c3                   	ret
+
+0000000000802a29 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802a29:	55                   	push   %rbp
+  802a2a:	48 89 e5             	mov    %rsp,%rbp
+  802a2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802a31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802a35:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a3c:	e9 ae 00 00 00       	jmp    802aef <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802a41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a44:	c1 e0 0c             	shl    $0xc,%eax
+  802a47:	48 98                	cltq
+  802a49:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a4e:	48 01 d0             	add    %rdx,%rax
+  802a51:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a59:	48 c1 e8 27          	shr    $0x27,%rax
+  802a5d:	48 89 c2             	mov    %rax,%rdx
+  802a60:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a67:	01 00 00 
+  802a6a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a6e:	83 e0 01             	and    $0x1,%eax
+  802a71:	48 85 c0             	test   %rax,%rax
+  802a74:	74 63                	je     802ad9 <fd_alloc+0xb0>
+  802a76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a7a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a7e:	48 89 c2             	mov    %rax,%rdx
+  802a81:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802a88:	01 00 00 
+  802a8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a8f:	83 e0 01             	and    $0x1,%eax
+  802a92:	48 85 c0             	test   %rax,%rax
+  802a95:	74 42                	je     802ad9 <fd_alloc+0xb0>
+  802a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a9b:	48 c1 e8 15          	shr    $0x15,%rax
+  802a9f:	48 89 c2             	mov    %rax,%rdx
+  802aa2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802aa9:	01 00 00 
+  802aac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ab0:	83 e0 01             	and    $0x1,%eax
+  802ab3:	48 85 c0             	test   %rax,%rax
+  802ab6:	74 21                	je     802ad9 <fd_alloc+0xb0>
+  802ab8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802abc:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ac0:	48 89 c2             	mov    %rax,%rdx
+  802ac3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802aca:	01 00 00 
+  802acd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ad1:	83 e0 01             	and    $0x1,%eax
+  802ad4:	48 85 c0             	test   %rax,%rax
+  802ad7:	75 12                	jne    802aeb <fd_alloc+0xc2>
+      *fd_store = fd;
+  802ad9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802add:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ae1:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	eb 1e                	jmp    802b09 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802aeb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802aef:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802af3:	0f 8e 48 ff ff ff    	jle    802a41 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802afd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b04:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+0000000000802b0b <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b0b:	55                   	push   %rbp
+  802b0c:	48 89 e5             	mov    %rsp,%rbp
+  802b0f:	48 83 ec 20          	sub    $0x20,%rsp
+  802b13:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b16:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b1e:	78 06                	js     802b26 <fd_lookup+0x1b>
+  802b20:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b24:	7e 0a                	jle    802b30 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b2b:	e9 af 00 00 00       	jmp    802bdf <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802b30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b33:	c1 e0 0c             	shl    $0xc,%eax
+  802b36:	48 98                	cltq
+  802b38:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b3d:	48 01 d0             	add    %rdx,%rax
+  802b40:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b48:	48 c1 e8 27          	shr    $0x27,%rax
+  802b4c:	48 89 c2             	mov    %rax,%rdx
+  802b4f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b56:	01 00 00 
+  802b59:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b5d:	83 e0 01             	and    $0x1,%eax
+  802b60:	48 85 c0             	test   %rax,%rax
+  802b63:	74 63                	je     802bc8 <fd_lookup+0xbd>
+  802b65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b69:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b6d:	48 89 c2             	mov    %rax,%rdx
+  802b70:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b77:	01 00 00 
+  802b7a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b7e:	83 e0 01             	and    $0x1,%eax
+  802b81:	48 85 c0             	test   %rax,%rax
+  802b84:	74 42                	je     802bc8 <fd_lookup+0xbd>
+  802b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b8a:	48 c1 e8 15          	shr    $0x15,%rax
+  802b8e:	48 89 c2             	mov    %rax,%rdx
+  802b91:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b98:	01 00 00 
+  802b9b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b9f:	83 e0 01             	and    $0x1,%eax
+  802ba2:	48 85 c0             	test   %rax,%rax
+  802ba5:	74 21                	je     802bc8 <fd_lookup+0xbd>
+  802ba7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bab:	48 c1 e8 0c          	shr    $0xc,%rax
+  802baf:	48 89 c2             	mov    %rax,%rdx
+  802bb2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bb9:	01 00 00 
+  802bbc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc0:	83 e0 01             	and    $0x1,%eax
+  802bc3:	48 85 c0             	test   %rax,%rax
+  802bc6:	75 07                	jne    802bcf <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802bc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bcd:	eb 10                	jmp    802bdf <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802bcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bd3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bd7:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802bda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+0000000000802be1 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802be1:	55                   	push   %rbp
+  802be2:	48 89 e5             	mov    %rsp,%rbp
+  802be5:	48 83 ec 30          	sub    $0x30,%rsp
+  802be9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802bed:	89 f0                	mov    %esi,%eax
+  802bef:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802bf2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bf6:	48 89 c7             	mov    %rax,%rdi
+  802bf9:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+  802c05:	89 c2                	mov    %eax,%edx
+  802c07:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c0b:	48 89 c6             	mov    %rax,%rsi
+  802c0e:	89 d7                	mov    %edx,%edi
+  802c10:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+  802c1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c23:	78 0a                	js     802c2f <fd_close+0x4e>
+  802c25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c29:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802c2d:	74 12                	je     802c41 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802c2f:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802c33:	74 05                	je     802c3a <fd_close+0x59>
+  802c35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c38:	eb 70                	jmp    802caa <fd_close+0xc9>
+  802c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3f:	eb 69                	jmp    802caa <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c45:	8b 00                	mov    (%rax),%eax
+  802c47:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c4b:	48 89 d6             	mov    %rdx,%rsi
+  802c4e:	89 c7                	mov    %eax,%edi
+  802c50:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  802c57:	00 00 00 
+  802c5a:	ff d0                	call   *%rax
+  802c5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c63:	78 2a                	js     802c8f <fd_close+0xae>
+    if (dev->dev_close)
+  802c65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c69:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c6d:	48 85 c0             	test   %rax,%rax
+  802c70:	74 16                	je     802c88 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802c72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c76:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c7e:	48 89 c7             	mov    %rax,%rdi
+  802c81:	ff d2                	call   *%rdx
+  802c83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c86:	eb 07                	jmp    802c8f <fd_close+0xae>
+    else
+      r = 0;
+  802c88:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802c8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c93:	48 89 c6             	mov    %rax,%rsi
+  802c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9b:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+  return r;
+  802ca7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802caa:	c9                   	leave
+  802cab:	c3                   	ret
+
+0000000000802cac <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802cac:	55                   	push   %rbp
+  802cad:	48 89 e5             	mov    %rsp,%rbp
+  802cb0:	48 83 ec 20          	sub    $0x20,%rsp
+  802cb4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cb7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802cbb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802cc2:	eb 3f                	jmp    802d03 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802cc4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ccb:	00 00 00 
+  802cce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cd1:	48 98                	cltq
+  802cd3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cd7:	8b 00                	mov    (%rax),%eax
+  802cd9:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802cdc:	75 21                	jne    802cff <dev_lookup+0x53>
+      *dev = devtab[i];
+  802cde:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ce5:	00 00 00 
+  802ce8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ceb:	48 98                	cltq
+  802ced:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cf1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cf5:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfd:	eb 7f                	jmp    802d7e <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802cff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d03:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d0a:	00 00 00 
+  802d0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d10:	48 98                	cltq
+  802d12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d16:	48 85 c0             	test   %rax,%rax
+  802d19:	75 a9                	jne    802cc4 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d1b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d22:	00 00 00 
+  802d25:	8b 40 04             	mov    0x4(%rax),%eax
+  802d28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d2d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d34:	00 00 00 
+  802d37:	48 98                	cltq
+  802d39:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802d40:	48 01 d0             	add    %rdx,%rax
+  802d43:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802d49:	8b 00                	mov    (%rax),%eax
+  802d4b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d4e:	89 c6                	mov    %eax,%esi
+  802d50:	48 b8 48 56 80 00 00 	movabs $0x805648,%rax
+  802d57:	00 00 00 
+  802d5a:	48 89 c7             	mov    %rax,%rdi
+  802d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d62:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  802d69:	00 00 00 
+  802d6c:	ff d1                	call   *%rcx
+  *dev = 0;
+  802d6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d72:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802d79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+0000000000802d80 <close>:
+
+int
+close(int fdnum) {
+  802d80:	55                   	push   %rbp
+  802d81:	48 89 e5             	mov    %rsp,%rbp
+  802d84:	48 83 ec 20          	sub    $0x20,%rsp
+  802d88:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d8b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d92:	48 89 d6             	mov    %rdx,%rsi
+  802d95:	89 c7                	mov    %eax,%edi
+  802d97:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+  802da3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802da6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802daa:	79 05                	jns    802db1 <close+0x31>
+    return r;
+  802dac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802daf:	eb 18                	jmp    802dc9 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802db1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db5:	be 01 00 00 00       	mov    $0x1,%esi
+  802dba:	48 89 c7             	mov    %rax,%rdi
+  802dbd:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  802dc4:	00 00 00 
+  802dc7:	ff d0                	call   *%rax
+}
+  802dc9:	c9                   	leave
+  802dca:	c3                   	ret
+
+0000000000802dcb <close_all>:
+
+void
+close_all(void) {
+  802dcb:	55                   	push   %rbp
+  802dcc:	48 89 e5             	mov    %rsp,%rbp
+  802dcf:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802dd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dda:	eb 15                	jmp    802df1 <close_all+0x26>
+    close(i);
+  802ddc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ddf:	89 c7                	mov    %eax,%edi
+  802de1:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802de8:	00 00 00 
+  802deb:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802ded:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802df1:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802df5:	7e e5                	jle    802ddc <close_all+0x11>
+}
+  802df7:	90                   	nop
+  802df8:	90                   	nop
+  802df9:	c9                   	leave
+  802dfa:	c3                   	ret
+
+0000000000802dfb <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802dfb:	55                   	push   %rbp
+  802dfc:	48 89 e5             	mov    %rsp,%rbp
+  802dff:	48 83 ec 40          	sub    $0x40,%rsp
+  802e03:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e06:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e09:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e0d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e10:	48 89 d6             	mov    %rdx,%rsi
+  802e13:	89 c7                	mov    %eax,%edi
+  802e15:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  802e1c:	00 00 00 
+  802e1f:	ff d0                	call   *%rax
+  802e21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e28:	79 08                	jns    802e32 <dup+0x37>
+    return r;
+  802e2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e2d:	e9 33 02 00 00       	jmp    803065 <dup+0x26a>
+  close(newfdnum);
+  802e32:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e35:	89 c7                	mov    %eax,%edi
+  802e37:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802e43:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e46:	c1 e0 0c             	shl    $0xc,%eax
+  802e49:	48 98                	cltq
+  802e4b:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802e50:	48 01 d0             	add    %rdx,%rax
+  802e53:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802e57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e5b:	48 89 c7             	mov    %rax,%rdi
+  802e5e:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+  802e6a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e72:	48 89 c7             	mov    %rax,%rdi
+  802e75:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  802e7c:	00 00 00 
+  802e7f:	ff d0                	call   *%rax
+  802e81:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802e85:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802e8c:	00 
+  802e8d:	e9 19 01 00 00       	jmp    802fab <dup+0x1b0>
+    off -= PGSIZE;
+  802e92:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802e99:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802e9a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea2:	48 01 d0             	add    %rdx,%rax
+  802ea5:	48 c1 e8 27          	shr    $0x27,%rax
+  802ea9:	48 89 c2             	mov    %rax,%rdx
+  802eac:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802eb3:	01 00 00 
+  802eb6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eba:	83 e0 01             	and    $0x1,%eax
+  802ebd:	48 85 c0             	test   %rax,%rax
+  802ec0:	0f 84 e5 00 00 00    	je     802fab <dup+0x1b0>
+  802ec6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ece:	48 01 d0             	add    %rdx,%rax
+  802ed1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ed5:	48 89 c2             	mov    %rax,%rdx
+  802ed8:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802edf:	01 00 00 
+  802ee2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ee6:	83 e0 01             	and    $0x1,%eax
+  802ee9:	48 85 c0             	test   %rax,%rax
+  802eec:	0f 84 b9 00 00 00    	je     802fab <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802ef2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ef6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802efa:	48 01 d0             	add    %rdx,%rax
+  802efd:	48 c1 e8 15          	shr    $0x15,%rax
+  802f01:	48 89 c2             	mov    %rax,%rdx
+  802f04:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f0b:	01 00 00 
+  802f0e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f12:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f15:	48 85 c0             	test   %rax,%rax
+  802f18:	0f 84 8d 00 00 00    	je     802fab <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f1e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f26:	48 01 d0             	add    %rdx,%rax
+  802f29:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f2d:	48 89 c2             	mov    %rax,%rdx
+  802f30:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f37:	01 00 00 
+  802f3a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f3e:	83 e0 01             	and    $0x1,%eax
+  802f41:	48 85 c0             	test   %rax,%rax
+  802f44:	74 65                	je     802fab <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802f46:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f4e:	48 01 d0             	add    %rdx,%rax
+  802f51:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f55:	48 89 c2             	mov    %rax,%rdx
+  802f58:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f5f:	01 00 00 
+  802f62:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f66:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f6b:	89 c6                	mov    %eax,%esi
+  802f6d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f75:	48 01 c2             	add    %rax,%rdx
+  802f78:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f80:	48 01 c8             	add    %rcx,%rax
+  802f83:	41 89 f0             	mov    %esi,%r8d
+  802f86:	48 89 d1             	mov    %rdx,%rcx
+  802f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f8e:	48 89 c6             	mov    %rax,%rsi
+  802f91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f96:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  802f9d:	00 00 00 
+  802fa0:	ff d0                	call   *%rax
+  802fa2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fa5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fa9:	78 60                	js     80300b <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802fab:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802fb0:	0f 85 dc fe ff ff    	jne    802e92 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802fb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fba:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fbe:	48 89 c2             	mov    %rax,%rdx
+  802fc1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fc8:	01 00 00 
+  802fcb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fcf:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fd4:	89 c1                	mov    %eax,%ecx
+  802fd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fda:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fde:	41 89 c8             	mov    %ecx,%r8d
+  802fe1:	48 89 d1             	mov    %rdx,%rcx
+  802fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe9:	48 89 c6             	mov    %rax,%rsi
+  802fec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff1:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  802ff8:	00 00 00 
+  802ffb:	ff d0                	call   *%rax
+  802ffd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803000:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803004:	78 08                	js     80300e <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803006:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803009:	eb 5a                	jmp    803065 <dup+0x26a>
+        goto err;
+  80300b:	90                   	nop
+  80300c:	eb 01                	jmp    80300f <dup+0x214>
+    goto err;
+  80300e:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80300f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803013:	48 89 c6             	mov    %rax,%rsi
+  803016:	bf 00 00 00 00       	mov    $0x0,%edi
+  80301b:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803027:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80302e:	00 
+  80302f:	eb 27                	jmp    803058 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803031:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803035:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803039:	48 01 d0             	add    %rdx,%rax
+  80303c:	48 89 c6             	mov    %rax,%rsi
+  80303f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803044:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803050:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803057:	00 
+  803058:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80305f:	00 
+  803060:	76 cf                	jbe    803031 <dup+0x236>
+  return r;
+  803062:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803065:	c9                   	leave
+  803066:	c3                   	ret
+
+0000000000803067 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803067:	55                   	push   %rbp
+  803068:	48 89 e5             	mov    %rsp,%rbp
+  80306b:	48 83 ec 40          	sub    $0x40,%rsp
+  80306f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803072:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803076:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80307a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80307e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803081:	48 89 d6             	mov    %rdx,%rsi
+  803084:	89 c7                	mov    %eax,%edi
+  803086:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  80308d:	00 00 00 
+  803090:	ff d0                	call   *%rax
+  803092:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803095:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803099:	78 24                	js     8030bf <read+0x58>
+  80309b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80309f:	8b 00                	mov    (%rax),%eax
+  8030a1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030a5:	48 89 d6             	mov    %rdx,%rsi
+  8030a8:	89 c7                	mov    %eax,%edi
+  8030aa:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  8030b1:	00 00 00 
+  8030b4:	ff d0                	call   *%rax
+  8030b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030bd:	79 0a                	jns    8030c9 <read+0x62>
+    return r;
+  8030bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030c2:	48 98                	cltq
+  8030c4:	e9 9e 00 00 00       	jmp    803167 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8030c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030cd:	8b 40 08             	mov    0x8(%rax),%eax
+  8030d0:	83 e0 03             	and    $0x3,%eax
+  8030d3:	83 f8 01             	cmp    $0x1,%eax
+  8030d6:	75 5c                	jne    803134 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030d8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030df:	00 00 00 
+  8030e2:	8b 40 04             	mov    0x4(%rax),%eax
+  8030e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030ea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030f1:	00 00 00 
+  8030f4:	48 98                	cltq
+  8030f6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8030fd:	48 01 d0             	add    %rdx,%rax
+  803100:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803106:	8b 00                	mov    (%rax),%eax
+  803108:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80310b:	89 c6                	mov    %eax,%esi
+  80310d:	48 b8 67 56 80 00 00 	movabs $0x805667,%rax
+  803114:	00 00 00 
+  803117:	48 89 c7             	mov    %rax,%rdi
+  80311a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311f:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  803126:	00 00 00 
+  803129:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80312b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803132:	eb 33                	jmp    803167 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803134:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803138:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80313c:	48 85 c0             	test   %rax,%rax
+  80313f:	75 09                	jne    80314a <read+0xe3>
+    return -E_NOT_SUPP;
+  803141:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803148:	eb 1d                	jmp    803167 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80314a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80314e:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803156:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80315a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80315e:	48 89 ce             	mov    %rcx,%rsi
+  803161:	48 89 c7             	mov    %rax,%rdi
+  803164:	41 ff d0             	call   *%r8
+}
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+
+0000000000803169 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803169:	55                   	push   %rbp
+  80316a:	48 89 e5             	mov    %rsp,%rbp
+  80316d:	48 83 ec 30          	sub    $0x30,%rsp
+  803171:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803174:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803178:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80317c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803183:	eb 49                	jmp    8031ce <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803188:	48 98                	cltq
+  80318a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80318e:	48 29 c2             	sub    %rax,%rdx
+  803191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803194:	48 63 c8             	movslq %eax,%rcx
+  803197:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80319b:	48 01 c1             	add    %rax,%rcx
+  80319e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031a1:	48 89 ce             	mov    %rcx,%rsi
+  8031a4:	89 c7                	mov    %eax,%edi
+  8031a6:	48 b8 67 30 80 00 00 	movabs $0x803067,%rax
+  8031ad:	00 00 00 
+  8031b0:	ff d0                	call   *%rax
+  8031b2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8031b5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031b9:	79 07                	jns    8031c2 <readn+0x59>
+      return m;
+  8031bb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031be:	48 98                	cltq
+  8031c0:	eb 1f                	jmp    8031e1 <readn+0x78>
+    if (m == 0)
+  8031c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031c6:	74 13                	je     8031db <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8031c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031cb:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8031ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031d1:	48 98                	cltq
+  8031d3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8031d7:	72 ac                	jb     803185 <readn+0x1c>
+  8031d9:	eb 01                	jmp    8031dc <readn+0x73>
+      break;
+  8031db:	90                   	nop
+  }
+  return tot;
+  8031dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031df:	48 98                	cltq
+}
+  8031e1:	c9                   	leave
+  8031e2:	c3                   	ret
+
+00000000008031e3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8031e3:	55                   	push   %rbp
+  8031e4:	48 89 e5             	mov    %rsp,%rbp
+  8031e7:	48 83 ec 40          	sub    $0x40,%rsp
+  8031eb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031ee:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8031f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031f6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031fd:	48 89 d6             	mov    %rdx,%rsi
+  803200:	89 c7                	mov    %eax,%edi
+  803202:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  803209:	00 00 00 
+  80320c:	ff d0                	call   *%rax
+  80320e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803211:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803215:	78 24                	js     80323b <write+0x58>
+  803217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80321b:	8b 00                	mov    (%rax),%eax
+  80321d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803221:	48 89 d6             	mov    %rdx,%rsi
+  803224:	89 c7                	mov    %eax,%edi
+  803226:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  80322d:	00 00 00 
+  803230:	ff d0                	call   *%rax
+  803232:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803235:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803239:	79 0a                	jns    803245 <write+0x62>
+    return r;
+  80323b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80323e:	48 98                	cltq
+  803240:	e9 9d 00 00 00       	jmp    8032e2 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803245:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803249:	8b 40 08             	mov    0x8(%rax),%eax
+  80324c:	83 e0 03             	and    $0x3,%eax
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	75 5c                	jne    8032af <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803253:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80325a:	00 00 00 
+  80325d:	8b 40 04             	mov    0x4(%rax),%eax
+  803260:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803265:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80326c:	00 00 00 
+  80326f:	48 98                	cltq
+  803271:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803278:	48 01 d0             	add    %rdx,%rax
+  80327b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803281:	8b 00                	mov    (%rax),%eax
+  803283:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803286:	89 c6                	mov    %eax,%esi
+  803288:	48 b8 83 56 80 00 00 	movabs $0x805683,%rax
+  80328f:	00 00 00 
+  803292:	48 89 c7             	mov    %rax,%rdi
+  803295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80329a:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  8032a1:	00 00 00 
+  8032a4:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8032a6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ad:	eb 33                	jmp    8032e2 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8032af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032b7:	48 85 c0             	test   %rax,%rax
+  8032ba:	75 09                	jne    8032c5 <write+0xe2>
+    return -E_NOT_SUPP;
+  8032bc:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8032c3:	eb 1d                	jmp    8032e2 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8032c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032c9:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8032cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8032d5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8032d9:	48 89 ce             	mov    %rcx,%rsi
+  8032dc:	48 89 c7             	mov    %rax,%rdi
+  8032df:	41 ff d0             	call   *%r8
+}
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+00000000008032e4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032ec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032ef:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032f9:	48 89 d6             	mov    %rdx,%rsi
+  8032fc:	89 c7                	mov    %eax,%edi
+  8032fe:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  803305:	00 00 00 
+  803308:	ff d0                	call   *%rax
+  80330a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80330d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803311:	79 05                	jns    803318 <seek+0x34>
+    return r;
+  803313:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803316:	eb 0f                	jmp    803327 <seek+0x43>
+  fd->fd_offset = offset;
+  803318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80331c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80331f:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803327:	c9                   	leave
+  803328:	c3                   	ret
+
+0000000000803329 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803329:	55                   	push   %rbp
+  80332a:	48 89 e5             	mov    %rsp,%rbp
+  80332d:	48 83 ec 30          	sub    $0x30,%rsp
+  803331:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803334:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803337:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80333b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80333e:	48 89 d6             	mov    %rdx,%rsi
+  803341:	89 c7                	mov    %eax,%edi
+  803343:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+  80334f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803352:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803356:	78 24                	js     80337c <ftruncate+0x53>
+  803358:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80335c:	8b 00                	mov    (%rax),%eax
+  80335e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803362:	48 89 d6             	mov    %rdx,%rsi
+  803365:	89 c7                	mov    %eax,%edi
+  803367:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+  803373:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803376:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80337a:	79 08                	jns    803384 <ftruncate+0x5b>
+    return r;
+  80337c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80337f:	e9 92 00 00 00       	jmp    803416 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803388:	8b 40 08             	mov    0x8(%rax),%eax
+  80338b:	83 e0 03             	and    $0x3,%eax
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	75 5a                	jne    8033ec <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803392:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803399:	00 00 00 
+  80339c:	8b 40 04             	mov    0x4(%rax),%eax
+  80339f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033a4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033ab:	00 00 00 
+  8033ae:	48 98                	cltq
+  8033b0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033b7:	48 01 d0             	add    %rdx,%rax
+  8033ba:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033c0:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033c5:	89 c6                	mov    %eax,%esi
+  8033c7:	48 b8 a0 56 80 00 00 	movabs $0x8056a0,%rax
+  8033ce:	00 00 00 
+  8033d1:	48 89 c7             	mov    %rax,%rdi
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d9:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  8033e0:	00 00 00 
+  8033e3:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8033e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ea:	eb 2a                	jmp    803416 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8033ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033f0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033f4:	48 85 c0             	test   %rax,%rax
+  8033f7:	75 07                	jne    803400 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8033f9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8033fe:	eb 16                	jmp    803416 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803400:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803404:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80340c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80340f:	89 d6                	mov    %edx,%esi
+  803411:	48 89 c7             	mov    %rax,%rdi
+  803414:	ff d1                	call   *%rcx
+}
+  803416:	c9                   	leave
+  803417:	c3                   	ret
+
+0000000000803418 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803418:	55                   	push   %rbp
+  803419:	48 89 e5             	mov    %rsp,%rbp
+  80341c:	48 83 ec 30          	sub    $0x30,%rsp
+  803420:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803423:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803427:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80342b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80342e:	48 89 d6             	mov    %rdx,%rsi
+  803431:	89 c7                	mov    %eax,%edi
+  803433:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  80343a:	00 00 00 
+  80343d:	ff d0                	call   *%rax
+  80343f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803442:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803446:	78 24                	js     80346c <fstat+0x54>
+  803448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344c:	8b 00                	mov    (%rax),%eax
+  80344e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803452:	48 89 d6             	mov    %rdx,%rsi
+  803455:	89 c7                	mov    %eax,%edi
+  803457:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  80345e:	00 00 00 
+  803461:	ff d0                	call   *%rax
+  803463:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803466:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80346a:	79 05                	jns    803471 <fstat+0x59>
+    return r;
+  80346c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80346f:	eb 5e                	jmp    8034cf <fstat+0xb7>
+  if (!dev->dev_stat)
+  803471:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803475:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803479:	48 85 c0             	test   %rax,%rax
+  80347c:	75 07                	jne    803485 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80347e:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803483:	eb 4a                	jmp    8034cf <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803485:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803489:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80348c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803490:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803497:	00 00 00 
+  stat->st_isdir   = 0;
+  80349a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80349e:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034a5:	00 00 00 
+  stat->st_dev     = dev;
+  8034a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8034ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034b0:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8034b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034bb:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034c3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034c7:	48 89 d6             	mov    %rdx,%rsi
+  8034ca:	48 89 c7             	mov    %rax,%rdi
+  8034cd:	ff d1                	call   *%rcx
+}
+  8034cf:	c9                   	leave
+  8034d0:	c3                   	ret
+
+00000000008034d1 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8034d1:	55                   	push   %rbp
+  8034d2:	48 89 e5             	mov    %rsp,%rbp
+  8034d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8034d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8034dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8034e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e5:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8034eb:	83 f8 20             	cmp    $0x20,%eax
+  8034ee:	75 07                	jne    8034f7 <pollwait_key+0x26>
+    return -E_INVAL;
+  8034f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034f5:	eb 5f                	jmp    803556 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8034f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034fb:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803501:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803505:	48 63 d2             	movslq %edx,%rdx
+  803508:	48 c1 e2 04          	shl    $0x4,%rdx
+  80350c:	48 01 c2             	add    %rax,%rdx
+  80350f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803513:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803516:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80351a:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803520:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803524:	8b 00                	mov    (%rax),%eax
+  803526:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80352a:	48 63 c9             	movslq %ecx,%rcx
+  80352d:	48 c1 e1 04          	shl    $0x4,%rcx
+  803531:	48 01 ca             	add    %rcx,%rdx
+  803534:	48 83 c2 08          	add    $0x8,%rdx
+  803538:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80353a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80353e:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803544:	8d 50 01             	lea    0x1(%rax),%edx
+  803547:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80354b:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803556:	c9                   	leave
+  803557:	c3                   	ret
+
+0000000000803558 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803558:	55                   	push   %rbp
+  803559:	48 89 e5             	mov    %rsp,%rbp
+  80355c:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803563:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80356a:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803570:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803577:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80357e:	00 
+  int i, r, ready, ipc = 0;
+  80357f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803586:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80358d:	00 
+  80358e:	74 45                	je     8035d5 <poll+0x7d>
+  803590:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803597:	ff 
+  803598:	74 3b                	je     8035d5 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80359a:	48 b8 93 4a 80 00 00 	movabs $0x804a93,%rax
+  8035a1:	00 00 00 
+  8035a4:	ff d0                	call   *%rax
+  8035a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8035aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ae:	48 f7 d0             	not    %rax
+  8035b1:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8035b8:	73 10                	jae    8035ca <poll+0x72>
+  8035ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035be:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8035c5:	48 01 d0             	add    %rdx,%rax
+  8035c8:	eb 07                	jmp    8035d1 <poll+0x79>
+  8035ca:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8035d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8035d5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8035dc:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8035e3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8035ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8035f1:	e9 46 02 00 00       	jmp    80383c <poll+0x2e4>
+      fds[i].revents = 0;
+  8035f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035f9:	48 63 d0             	movslq %eax,%rdx
+  8035fc:	48 89 d0             	mov    %rdx,%rax
+  8035ff:	48 01 c0             	add    %rax,%rax
+  803602:	48 01 d0             	add    %rdx,%rax
+  803605:	48 c1 e0 02          	shl    $0x2,%rax
+  803609:	48 89 c2             	mov    %rax,%rdx
+  80360c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803613:	48 01 d0             	add    %rdx,%rax
+  803616:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80361d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803620:	48 63 d0             	movslq %eax,%rdx
+  803623:	48 89 d0             	mov    %rdx,%rax
+  803626:	48 01 c0             	add    %rax,%rax
+  803629:	48 01 d0             	add    %rdx,%rax
+  80362c:	48 c1 e0 02          	shl    $0x2,%rax
+  803630:	48 89 c2             	mov    %rax,%rdx
+  803633:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80363a:	48 01 d0             	add    %rdx,%rax
+  80363d:	8b 00                	mov    (%rax),%eax
+  80363f:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803642:	75 62                	jne    8036a6 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803644:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803647:	48 63 d0             	movslq %eax,%rdx
+  80364a:	48 89 d0             	mov    %rdx,%rax
+  80364d:	48 01 c0             	add    %rax,%rax
+  803650:	48 01 d0             	add    %rdx,%rax
+  803653:	48 c1 e0 02          	shl    $0x2,%rax
+  803657:	48 89 c2             	mov    %rax,%rdx
+  80365a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803661:	48 01 d0             	add    %rdx,%rax
+  803664:	8b 40 04             	mov    0x4(%rax),%eax
+  803667:	83 e0 01             	and    $0x1,%eax
+  80366a:	85 c0                	test   %eax,%eax
+  80366c:	0f 84 9b 01 00 00    	je     80380d <poll+0x2b5>
+          fds[i].revents = ipc;
+  803672:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803675:	48 63 d0             	movslq %eax,%rdx
+  803678:	48 89 d0             	mov    %rdx,%rax
+  80367b:	48 01 c0             	add    %rax,%rax
+  80367e:	48 01 d0             	add    %rdx,%rax
+  803681:	48 c1 e0 02          	shl    $0x2,%rax
+  803685:	48 89 c2             	mov    %rax,%rdx
+  803688:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80368f:	48 01 c2             	add    %rax,%rdx
+  803692:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803695:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803698:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80369b:	83 c8 04             	or     $0x4,%eax
+  80369e:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8036a1:	e9 67 01 00 00       	jmp    80380d <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036a9:	48 63 d0             	movslq %eax,%rdx
+  8036ac:	48 89 d0             	mov    %rdx,%rax
+  8036af:	48 01 c0             	add    %rax,%rax
+  8036b2:	48 01 d0             	add    %rdx,%rax
+  8036b5:	48 c1 e0 02          	shl    $0x2,%rax
+  8036b9:	48 89 c2             	mov    %rax,%rdx
+  8036bc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036c3:	48 01 d0             	add    %rdx,%rax
+  8036c6:	8b 00                	mov    (%rax),%eax
+  8036c8:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8036cf:	48 89 d6             	mov    %rdx,%rsi
+  8036d2:	89 c7                	mov    %eax,%edi
+  8036d4:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  8036db:	00 00 00 
+  8036de:	ff d0                	call   *%rax
+  8036e0:	85 c0                	test   %eax,%eax
+  8036e2:	78 25                	js     803709 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8036e4:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8036eb:	8b 00                	mov    (%rax),%eax
+  8036ed:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8036f4:	48 89 d6             	mov    %rdx,%rsi
+  8036f7:	89 c7                	mov    %eax,%edi
+  8036f9:	48 b8 ac 2c 80 00 00 	movabs $0x802cac,%rax
+  803700:	00 00 00 
+  803703:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803705:	85 c0                	test   %eax,%eax
+  803707:	79 2c                	jns    803735 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803709:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80370c:	48 63 d0             	movslq %eax,%rdx
+  80370f:	48 89 d0             	mov    %rdx,%rax
+  803712:	48 01 c0             	add    %rax,%rax
+  803715:	48 01 d0             	add    %rdx,%rax
+  803718:	48 c1 e0 02          	shl    $0x2,%rax
+  80371c:	48 89 c2             	mov    %rax,%rdx
+  80371f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803726:	48 01 d0             	add    %rdx,%rax
+  803729:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803730:	e9 d8 00 00 00       	jmp    80380d <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803735:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80373c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803740:	48 85 c0             	test   %rax,%rax
+  803743:	74 7d                	je     8037c2 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803745:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80374c:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803750:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803753:	48 63 d0             	movslq %eax,%rdx
+  803756:	48 89 d0             	mov    %rdx,%rax
+  803759:	48 01 c0             	add    %rax,%rax
+  80375c:	48 01 d0             	add    %rdx,%rax
+  80375f:	48 c1 e0 02          	shl    $0x2,%rax
+  803763:	48 89 c2             	mov    %rax,%rdx
+  803766:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80376d:	48 01 d0             	add    %rdx,%rax
+  803770:	8b 48 04             	mov    0x4(%rax),%ecx
+  803773:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80377a:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803781:	89 ce                	mov    %ecx,%esi
+  803783:	48 89 c7             	mov    %rax,%rdi
+  803786:	41 ff d0             	call   *%r8
+  803789:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80378c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803790:	79 08                	jns    80379a <poll+0x242>
+          return r;
+  803792:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803795:	e9 45 01 00 00       	jmp    8038df <poll+0x387>
+        fds[i].revents = r;
+  80379a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80379d:	48 63 d0             	movslq %eax,%rdx
+  8037a0:	48 89 d0             	mov    %rdx,%rax
+  8037a3:	48 01 c0             	add    %rax,%rax
+  8037a6:	48 01 d0             	add    %rdx,%rax
+  8037a9:	48 c1 e0 02          	shl    $0x2,%rax
+  8037ad:	48 89 c2             	mov    %rax,%rdx
+  8037b0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037b7:	48 01 c2             	add    %rax,%rdx
+  8037ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037bd:	89 42 08             	mov    %eax,0x8(%rdx)
+  8037c0:	eb 4b                	jmp    80380d <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8037c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037c5:	48 63 d0             	movslq %eax,%rdx
+  8037c8:	48 89 d0             	mov    %rdx,%rax
+  8037cb:	48 01 c0             	add    %rax,%rax
+  8037ce:	48 01 d0             	add    %rdx,%rax
+  8037d1:	48 c1 e0 02          	shl    $0x2,%rax
+  8037d5:	48 89 c2             	mov    %rax,%rdx
+  8037d8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037df:	48 01 d0             	add    %rdx,%rax
+  8037e2:	8b 48 04             	mov    0x4(%rax),%ecx
+  8037e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037e8:	48 63 d0             	movslq %eax,%rdx
+  8037eb:	48 89 d0             	mov    %rdx,%rax
+  8037ee:	48 01 c0             	add    %rax,%rax
+  8037f1:	48 01 d0             	add    %rdx,%rax
+  8037f4:	48 c1 e0 02          	shl    $0x2,%rax
+  8037f8:	48 89 c2             	mov    %rax,%rdx
+  8037fb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803802:	48 01 d0             	add    %rdx,%rax
+  803805:	83 e1 03             	and    $0x3,%ecx
+  803808:	89 ca                	mov    %ecx,%edx
+  80380a:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80380d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803810:	48 63 d0             	movslq %eax,%rdx
+  803813:	48 89 d0             	mov    %rdx,%rax
+  803816:	48 01 c0             	add    %rax,%rax
+  803819:	48 01 d0             	add    %rdx,%rax
+  80381c:	48 c1 e0 02          	shl    $0x2,%rax
+  803820:	48 89 c2             	mov    %rax,%rdx
+  803823:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80382a:	48 01 d0             	add    %rdx,%rax
+  80382d:	8b 40 08             	mov    0x8(%rax),%eax
+  803830:	85 c0                	test   %eax,%eax
+  803832:	74 04                	je     803838 <poll+0x2e0>
+        ready++;
+  803834:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803838:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80383c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80383f:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803845:	0f 8c ab fd ff ff    	jl     8035f6 <poll+0x9e>
+    }
+    if (ready)
+  80384b:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80384f:	74 08                	je     803859 <poll+0x301>
+      return ready;
+  803851:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803854:	e9 86 00 00 00       	jmp    8038df <poll+0x387>
+
+    if (deadline) {
+  803859:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80385e:	74 30                	je     803890 <poll+0x338>
+      now     = vsys_clock_ns();
+  803860:	48 b8 93 4a 80 00 00 	movabs $0x804a93,%rax
+  803867:	00 00 00 
+  80386a:	ff d0                	call   *%rax
+  80386c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803870:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803874:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803878:	73 0a                	jae    803884 <poll+0x32c>
+  80387a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80387e:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803882:	eb 05                	jmp    803889 <poll+0x331>
+  803884:	b8 00 00 00 00       	mov    $0x0,%eax
+  803889:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803890:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803893:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803896:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80389d:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8038a4:	48 89 c7             	mov    %rax,%rdi
+  8038a7:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  8038ae:	00 00 00 
+  8038b1:	ff d0                	call   *%rax
+  8038b3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8038b6:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8038ba:	75 07                	jne    8038c3 <poll+0x36b>
+      return 0;
+  8038bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c1:	eb 1c                	jmp    8038df <poll+0x387>
+    if (r < 0)
+  8038c3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038c7:	79 05                	jns    8038ce <poll+0x376>
+      return r;
+  8038c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038cc:	eb 11                	jmp    8038df <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8038ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038d1:	c1 f8 02             	sar    $0x2,%eax
+  8038d4:	83 e0 01             	and    $0x1,%eax
+  8038d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8038da:	e9 f6 fc ff ff       	jmp    8035d5 <poll+0x7d>
+  }
+}
+  8038df:	c9                   	leave
+  8038e0:	c3                   	ret
+
+00000000008038e1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8038e1:	55                   	push   %rbp
+  8038e2:	48 89 e5             	mov    %rsp,%rbp
+  8038e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8038e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8038ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8038f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8038fa:	48 89 c7             	mov    %rax,%rdi
+  8038fd:	48 b8 cf 39 80 00 00 	movabs $0x8039cf,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+  803909:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80390c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803910:	79 05                	jns    803917 <stat+0x36>
+    return fd;
+  803912:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803915:	eb 2f                	jmp    803946 <stat+0x65>
+  r = fstat(fd, stat);
+  803917:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80391b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80391e:	48 89 d6             	mov    %rdx,%rsi
+  803921:	89 c7                	mov    %eax,%edi
+  803923:	48 b8 18 34 80 00 00 	movabs $0x803418,%rax
+  80392a:	00 00 00 
+  80392d:	ff d0                	call   *%rax
+  80392f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803932:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803935:	89 c7                	mov    %eax,%edi
+  803937:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80393e:	00 00 00 
+  803941:	ff d0                	call   *%rax
+  return r;
+  803943:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803946:	c9                   	leave
+  803947:	c3                   	ret
+
+0000000000803948 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803948:	55                   	push   %rbp
+  803949:	48 89 e5             	mov    %rsp,%rbp
+  80394c:	48 83 ec 10          	sub    $0x10,%rsp
+  803950:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803953:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803957:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80395e:	00 00 00 
+  803961:	8b 00                	mov    (%rax),%eax
+  803963:	85 c0                	test   %eax,%eax
+  803965:	75 1d                	jne    803984 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803967:	bf 03 00 00 00       	mov    $0x3,%edi
+  80396c:	48 b8 6a 29 80 00 00 	movabs $0x80296a,%rax
+  803973:	00 00 00 
+  803976:	ff d0                	call   *%rax
+  803978:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80397f:	00 00 00 
+  803982:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803984:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80398b:	00 00 00 
+  80398e:	8b 00                	mov    (%rax),%eax
+  803990:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803993:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803998:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80399f:	00 00 00 
+  8039a2:	89 c7                	mov    %eax,%edi
+  8039a4:	48 b8 bd 28 80 00 00 	movabs $0x8028bd,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8039b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039b9:	48 89 c6             	mov    %rax,%rsi
+  8039bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c1:	48 b8 40 27 80 00 00 	movabs $0x802740,%rax
+  8039c8:	00 00 00 
+  8039cb:	ff d0                	call   *%rax
+}
+  8039cd:	c9                   	leave
+  8039ce:	c3                   	ret
+
+00000000008039cf <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8039cf:	55                   	push   %rbp
+  8039d0:	48 89 e5             	mov    %rsp,%rbp
+  8039d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8039d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039db:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8039de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039e2:	48 89 c7             	mov    %rax,%rdi
+  8039e5:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+  8039f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8039f6:	7e 0a                	jle    803a02 <open+0x33>
+    return -E_BAD_PATH;
+  8039f8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8039fd:	e9 a8 00 00 00       	jmp    803aaa <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a02:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a06:	48 89 c7             	mov    %rax,%rdi
+  803a09:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a18:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a1c:	79 08                	jns    803a26 <open+0x57>
+    return r;
+  803a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a21:	e9 84 00 00 00       	jmp    803aaa <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a2a:	48 89 c6             	mov    %rax,%rsi
+  803a2d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803a34:	00 00 00 
+  803a37:	48 89 c7             	mov    %rax,%rdi
+  803a3a:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803a41:	00 00 00 
+  803a44:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803a46:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a4d:	00 00 00 
+  803a50:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a53:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a5d:	48 89 c6             	mov    %rax,%rsi
+  803a60:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a65:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803a6c:	00 00 00 
+  803a6f:	ff d0                	call   *%rax
+  803a71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a74:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a78:	79 1d                	jns    803a97 <open+0xc8>
+    fd_close(fd, 0);
+  803a7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a7e:	be 00 00 00 00       	mov    $0x0,%esi
+  803a83:	48 89 c7             	mov    %rax,%rdi
+  803a86:	48 b8 e1 2b 80 00 00 	movabs $0x802be1,%rax
+  803a8d:	00 00 00 
+  803a90:	ff d0                	call   *%rax
+    return r;
+  803a92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a95:	eb 13                	jmp    803aaa <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9b:	48 89 c7             	mov    %rax,%rdi
+  803a9e:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  803aa5:	00 00 00 
+  803aa8:	ff d0                	call   *%rax
+}
+  803aaa:	c9                   	leave
+  803aab:	c3                   	ret
+
+0000000000803aac <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803aac:	55                   	push   %rbp
+  803aad:	48 89 e5             	mov    %rsp,%rbp
+  803ab0:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803ab8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803abc:	8b 40 0c             	mov    0xc(%rax),%eax
+  803abf:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803ac6:	00 00 00 
+  803ac9:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803acb:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad0:	bf 06 00 00 00       	mov    $0x6,%edi
+  803ad5:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803adc:	00 00 00 
+  803adf:	ff d0                	call   *%rax
+}
+  803ae1:	c9                   	leave
+  803ae2:	c3                   	ret
+
+0000000000803ae3 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803ae3:	55                   	push   %rbp
+  803ae4:	48 89 e5             	mov    %rsp,%rbp
+  803ae7:	48 83 ec 30          	sub    $0x30,%rsp
+  803aeb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803aef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803af3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803af7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803afc:	74 07                	je     803b05 <devfile_read+0x22>
+  803afe:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b03:	75 0a                	jne    803b0f <devfile_read+0x2c>
+  return E_INVAL;
+  803b05:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b0a:	e9 b4 00 00 00       	jmp    803bc3 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b0f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b16:	00 
+  while (n) {
+  803b17:	e9 98 00 00 00       	jmp    803bb4 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b20:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b23:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b2a:	00 00 00 
+  803b2d:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803b2f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b36:	00 00 00 
+  803b39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b3d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803b41:	be 00 00 00 00       	mov    $0x0,%esi
+  803b46:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b4b:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803b52:	00 00 00 
+  803b55:	ff d0                	call   *%rax
+  803b57:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803b5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b5e:	7f 13                	jg     803b73 <devfile_read+0x90>
+      return res ? res : res0;
+  803b60:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b64:	74 07                	je     803b6d <devfile_read+0x8a>
+  803b66:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b69:	48 98                	cltq
+  803b6b:	eb 56                	jmp    803bc3 <devfile_read+0xe0>
+  803b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b71:	eb 50                	jmp    803bc3 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b73:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b76:	48 63 d0             	movslq %eax,%rdx
+  803b79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b7d:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b84:	00 00 00 
+  803b87:	48 89 ce             	mov    %rcx,%rsi
+  803b8a:	48 89 c7             	mov    %rax,%rdi
+  803b8d:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  803b94:	00 00 00 
+  803b97:	ff d0                	call   *%rax
+
+    buf += res;
+  803b99:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b9c:	48 98                	cltq
+  803b9e:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803ba2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba5:	48 98                	cltq
+  803ba7:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803bab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bae:	48 98                	cltq
+  803bb0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803bb4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803bb9:	0f 85 5d ff ff ff    	jne    803b1c <devfile_read+0x39>
+  }
+
+  return res0;
+  803bbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803bc3:	c9                   	leave
+  803bc4:	c3                   	ret
+
+0000000000803bc5 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bc5:	55                   	push   %rbp
+  803bc6:	48 89 e5             	mov    %rsp,%rbp
+  803bc9:	48 83 ec 50          	sub    $0x50,%rsp
+  803bcd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803bd1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803bd5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803bd9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803bde:	74 07                	je     803be7 <devfile_write+0x22>
+  803be0:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803be5:	75 0a                	jne    803bf1 <devfile_write+0x2c>
+  return E_INVAL;
+  803be7:	b8 03 00 00 00       	mov    $0x3,%eax
+  803bec:	e9 c9 00 00 00       	jmp    803cba <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803bf1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803bf8:	00 
+
+  while (n) {
+  803bf9:	e9 ad 00 00 00       	jmp    803cab <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803bfe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c06:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c0d:	00 
+  803c0e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c16:	48 39 c2             	cmp    %rax,%rdx
+  803c19:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803c1d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803c21:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c25:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c29:	48 89 c6             	mov    %rax,%rsi
+  803c2c:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  803c33:	00 00 00 
+  803c36:	48 89 c7             	mov    %rax,%rdi
+  803c39:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  803c40:	00 00 00 
+  803c43:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c49:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c53:	00 00 00 
+  803c56:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803c58:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c5f:	00 00 00 
+  803c62:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c66:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803c6a:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6f:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c74:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803c7b:	00 00 00 
+  803c7e:	ff d0                	call   *%rax
+  803c80:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803c83:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c87:	79 07                	jns    803c90 <devfile_write+0xcb>
+      return res;
+  803c89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c8c:	48 98                	cltq
+  803c8e:	eb 2a                	jmp    803cba <devfile_write+0xf5>
+
+    buf += res;
+  803c90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c93:	48 98                	cltq
+  803c95:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803c99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c9c:	48 98                	cltq
+  803c9e:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803ca2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ca5:	48 98                	cltq
+  803ca7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803cab:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803cb0:	0f 85 48 ff ff ff    	jne    803bfe <devfile_write+0x39>
+  }
+
+  return res0;
+  803cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803cba:	c9                   	leave
+  803cbb:	c3                   	ret
+
+0000000000803cbc <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803cbc:	55                   	push   %rbp
+  803cbd:	48 89 e5             	mov    %rsp,%rbp
+  803cc0:	48 83 ec 20          	sub    $0x20,%rsp
+  803cc4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803ccc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cd0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cd3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803cda:	00 00 00 
+  803cdd:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803cdf:	be 00 00 00 00       	mov    $0x0,%esi
+  803ce4:	bf 05 00 00 00       	mov    $0x5,%edi
+  803ce9:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803cf0:	00 00 00 
+  803cf3:	ff d0                	call   *%rax
+  803cf5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cf8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cfc:	79 05                	jns    803d03 <devfile_stat+0x47>
+    return r;
+  803cfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d01:	eb 59                	jmp    803d5c <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d07:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d0e:	00 00 00 
+  803d11:	48 89 d6             	mov    %rdx,%rsi
+  803d14:	48 89 c7             	mov    %rax,%rdi
+  803d17:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803d23:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803d2a:	00 00 00 
+  803d2d:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803d33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d37:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d3d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803d44:	00 00 00 
+  803d47:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803d4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d51:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d5c:	c9                   	leave
+  803d5d:	c3                   	ret
+
+0000000000803d5e <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d5e:	55                   	push   %rbp
+  803d5f:	48 89 e5             	mov    %rsp,%rbp
+  803d62:	48 83 ec 10          	sub    $0x10,%rsp
+  803d66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d6a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d71:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d74:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d7b:	00 00 00 
+  803d7e:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803d80:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d87:	00 00 00 
+  803d8a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d8d:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803d90:	be 00 00 00 00       	mov    $0x0,%esi
+  803d95:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d9a:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+}
+  803da6:	c9                   	leave
+  803da7:	c3                   	ret
+
+0000000000803da8 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803da8:	55                   	push   %rbp
+  803da9:	48 89 e5             	mov    %rsp,%rbp
+  803dac:	48 83 ec 18          	sub    $0x18,%rsp
+  803db0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803db4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803db7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803dbb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dbe:	83 e0 03             	and    $0x3,%eax
+}
+  803dc1:	c9                   	leave
+  803dc2:	c3                   	ret
+
+0000000000803dc3 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803dc3:	55                   	push   %rbp
+  803dc4:	48 89 e5             	mov    %rsp,%rbp
+  803dc7:	48 83 ec 10          	sub    $0x10,%rsp
+  803dcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803dcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dd3:	48 89 c7             	mov    %rax,%rdi
+  803dd6:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+  803de2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803de7:	7e 07                	jle    803df0 <remove+0x2d>
+    return -E_BAD_PATH;
+  803de9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803dee:	eb 36                	jmp    803e26 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803df0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df4:	48 89 c6             	mov    %rax,%rsi
+  803df7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803dfe:	00 00 00 
+  803e01:	48 89 c7             	mov    %rax,%rdi
+  803e04:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803e0b:	00 00 00 
+  803e0e:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e10:	be 00 00 00 00       	mov    $0x0,%esi
+  803e15:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e1a:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803e21:	00 00 00 
+  803e24:	ff d0                	call   *%rax
+}
+  803e26:	c9                   	leave
+  803e27:	c3                   	ret
+
+0000000000803e28 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803e28:	55                   	push   %rbp
+  803e29:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803e2c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e31:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e36:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803e3d:	00 00 00 
+  803e40:	ff d0                	call   *%rax
+}
+  803e42:	5d                   	pop    %rbp
+  803e43:	c3                   	ret
+
+0000000000803e44 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803e44:	55                   	push   %rbp
+  803e45:	48 89 e5             	mov    %rsp,%rbp
+  803e48:	48 83 ec 20          	sub    $0x20,%rsp
+  803e4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803e50:	be 00 00 00 00       	mov    $0x0,%esi
+  803e55:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e5a:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803e61:	00 00 00 
+  803e64:	ff d0                	call   *%rax
+  803e66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e69:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e6d:	79 05                	jns    803e74 <fs_stats+0x30>
+    return r;
+  803e6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e72:	eb 2a                	jmp    803e9e <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803e74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e78:	ba 68 00 00 00       	mov    $0x68,%edx
+  803e7d:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803e84:	00 00 00 
+  803e87:	48 89 ce             	mov    %rcx,%rsi
+  803e8a:	48 89 c7             	mov    %rax,%rdi
+  803e8d:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+  return 0;
+  803e99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9e:	c9                   	leave
+  803e9f:	c3                   	ret
+
+0000000000803ea0 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803ea0:	55                   	push   %rbp
+  803ea1:	48 89 e5             	mov    %rsp,%rbp
+  803ea4:	48 83 ec 10          	sub    $0x10,%rsp
+  803ea8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803eab:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803eb2:	00 00 00 
+  803eb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eb8:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803eba:	be 00 00 00 00       	mov    $0x0,%esi
+  803ebf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803ec4:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+}
+  803ed0:	c9                   	leave
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	48 83 ec 10          	sub    $0x10,%rsp
+  803eda:	89 f8                	mov    %edi,%eax
+  803edc:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803edf:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803ee3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803eea:	00 00 00 
+  803eed:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803eef:	be 00 00 00 00       	mov    $0x0,%esi
+  803ef4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ef9:	48 b8 48 39 80 00 00 	movabs $0x803948,%rax
+  803f00:	00 00 00 
+  803f03:	ff d0                	call   *%rax
+}
+  803f05:	c9                   	leave
+  803f06:	c3                   	ret
+
+0000000000803f07 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803f07:	55                   	push   %rbp
+  803f08:	48 89 e5             	mov    %rsp,%rbp
+  803f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  803f0f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803f13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f17:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803f1c:	48 89 c7             	mov    %rax,%rdi
+  803f1f:	48 b8 2d 3f 80 00 00 	movabs $0x803f2d,%rax
+  803f26:	00 00 00 
+  803f29:	ff d0                	call   *%rax
+}
+  803f2b:	c9                   	leave
+  803f2c:	c3                   	ret
+
+0000000000803f2d <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803f2d:	55                   	push   %rbp
+  803f2e:	48 89 e5             	mov    %rsp,%rbp
+  803f31:	48 83 ec 50          	sub    $0x50,%rsp
+  803f35:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803f39:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803f3d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803f44:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803f45:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803f4a:	74 0a                	je     803f56 <pipe_size+0x29>
+  803f4c:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803f53:	00 
+  803f54:	76 0a                	jbe    803f60 <pipe_size+0x33>
+    return -E_INVAL;
+  803f56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f5b:	e9 cc 02 00 00       	jmp    80422c <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803f60:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803f64:	48 89 c7             	mov    %rax,%rdi
+  803f67:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  803f6e:	00 00 00 
+  803f71:	ff d0                	call   *%rax
+  803f73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f7a:	0f 88 a8 02 00 00    	js     804228 <pipe_size+0x2fb>
+  803f80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f84:	ba 07 04 00 00       	mov    $0x407,%edx
+  803f89:	48 89 c6             	mov    %rax,%rsi
+  803f8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f91:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803f98:	00 00 00 
+  803f9b:	ff d0                	call   *%rax
+  803f9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fa0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fa4:	0f 88 7e 02 00 00    	js     804228 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803faa:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803fae:	48 89 c7             	mov    %rax,%rdi
+  803fb1:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  803fb8:	00 00 00 
+  803fbb:	ff d0                	call   *%rax
+  803fbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fc4:	0f 88 43 02 00 00    	js     80420d <pipe_size+0x2e0>
+  803fca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fce:	ba 07 04 00 00       	mov    $0x407,%edx
+  803fd3:	48 89 c6             	mov    %rax,%rsi
+  803fd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fdb:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  803fe2:	00 00 00 
+  803fe5:	ff d0                	call   *%rax
+  803fe7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fee:	0f 88 19 02 00 00    	js     80420d <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803ff4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ff8:	48 89 c7             	mov    %rax,%rdi
+  803ffb:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  804002:	00 00 00 
+  804005:	ff d0                	call   *%rax
+  804007:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80400b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804012:	00 
+  804013:	e9 a2 00 00 00       	jmp    8040ba <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804018:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80401c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804020:	48 89 c2             	mov    %rax,%rdx
+  804023:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804027:	48 01 d0             	add    %rdx,%rax
+  80402a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80402f:	48 89 c6             	mov    %rax,%rsi
+  804032:	bf 00 00 00 00       	mov    $0x0,%edi
+  804037:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+  804043:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804046:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80404a:	0f 88 37 01 00 00    	js     804187 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804050:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804054:	48 89 c7             	mov    %rax,%rdi
+  804057:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+  804063:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804067:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80406b:	48 01 c2             	add    %rax,%rdx
+  80406e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804072:	48 c1 e0 0c          	shl    $0xc,%rax
+  804076:	48 89 c1             	mov    %rax,%rcx
+  804079:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80407d:	48 01 c8             	add    %rcx,%rax
+  804080:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804086:	48 89 d1             	mov    %rdx,%rcx
+  804089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408e:	48 89 c6             	mov    %rax,%rsi
+  804091:	bf 00 00 00 00       	mov    $0x0,%edi
+  804096:	48 b8 b1 20 80 00 00 	movabs $0x8020b1,%rax
+  80409d:	00 00 00 
+  8040a0:	ff d0                	call   *%rax
+  8040a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a9:	79 0a                	jns    8040b5 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8040ab:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8040b0:	e9 d3 00 00 00       	jmp    804188 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8040b5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8040ba:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8040c1:	00 
+  8040c2:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8040c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040ca:	48 01 d0             	add    %rdx,%rax
+  8040cd:	48 83 c0 1f          	add    $0x1f,%rax
+  8040d1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8040d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040de:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8040e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e6:	48 29 d0             	sub    %rdx,%rax
+  8040e9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040ed:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8040f1:	0f 82 21 ff ff ff    	jb     804018 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8040f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040fb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8040ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804103:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804107:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80410b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80410f:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804116:	00 00 00 
+  804119:	8b 12                	mov    (%rdx),%edx
+  80411b:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80411d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804121:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804128:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80412c:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804133:	00 00 00 
+  804136:	8b 12                	mov    (%rdx),%edx
+  804138:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80413a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80413e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804145:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804149:	48 89 c7             	mov    %rax,%rdi
+  80414c:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  804153:	00 00 00 
+  804156:	ff d0                	call   *%rax
+  804158:	89 c2                	mov    %eax,%edx
+  80415a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80415e:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804160:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804164:	48 89 c7             	mov    %rax,%rdi
+  804167:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  80416e:	00 00 00 
+  804171:	ff d0                	call   *%rax
+  804173:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804177:	48 83 c2 04          	add    $0x4,%rdx
+  80417b:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80417d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804182:	e9 a5 00 00 00       	jmp    80422c <pipe_size+0x2ff>
+      goto err2;
+  804187:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804188:	eb 58                	jmp    8041e2 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80418a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80418e:	48 c1 e0 0c          	shl    $0xc,%rax
+  804192:	48 89 c2             	mov    %rax,%rdx
+  804195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804199:	48 01 d0             	add    %rdx,%rax
+  80419c:	48 89 c6             	mov    %rax,%rsi
+  80419f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041a4:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8041ab:	00 00 00 
+  8041ae:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8041b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041b4:	48 89 c7             	mov    %rax,%rdi
+  8041b7:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  8041be:	00 00 00 
+  8041c1:	ff d0                	call   *%rax
+  8041c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8041c7:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8041cb:	48 01 d0             	add    %rdx,%rax
+  8041ce:	48 89 c6             	mov    %rax,%rsi
+  8041d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d6:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8041dd:	00 00 00 
+  8041e0:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8041e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041e6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8041ea:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8041ee:	48 85 c0             	test   %rax,%rax
+  8041f1:	75 97                	jne    80418a <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8041f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041f7:	48 89 c6             	mov    %rax,%rsi
+  8041fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ff:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  804206:	00 00 00 
+  804209:	ff d0                	call   *%rax
+  80420b:	eb 01                	jmp    80420e <pipe_size+0x2e1>
+    goto err1;
+  80420d:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80420e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804212:	48 89 c6             	mov    %rax,%rsi
+  804215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80421a:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+  804226:	eb 01                	jmp    804229 <pipe_size+0x2fc>
+    goto err;
+  804228:	90                   	nop
+err:
+  return r;
+  804229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80422c:	c9                   	leave
+  80422d:	c3                   	ret
+
+000000000080422e <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80422e:	55                   	push   %rbp
+  80422f:	48 89 e5             	mov    %rsp,%rbp
+  804232:	53                   	push   %rbx
+  804233:	48 83 ec 28          	sub    $0x28,%rsp
+  804237:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80423b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80423f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804246:	00 00 00 
+  804249:	8b 40 04             	mov    0x4(%rax),%eax
+  80424c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804251:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804258:	00 00 00 
+  80425b:	48 98                	cltq
+  80425d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804264:	48 01 d0             	add    %rdx,%rax
+  804267:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80426d:	8b 00                	mov    (%rax),%eax
+  80426f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804272:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804276:	48 89 c7             	mov    %rax,%rdi
+  804279:	48 b8 9e 4f 80 00 00 	movabs $0x804f9e,%rax
+  804280:	00 00 00 
+  804283:	ff d0                	call   *%rax
+  804285:	89 c3                	mov    %eax,%ebx
+  804287:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80428b:	48 89 c7             	mov    %rax,%rdi
+  80428e:	48 b8 9e 4f 80 00 00 	movabs $0x804f9e,%rax
+  804295:	00 00 00 
+  804298:	ff d0                	call   *%rax
+  80429a:	39 c3                	cmp    %eax,%ebx
+  80429c:	0f 94 c0             	sete   %al
+  80429f:	0f b6 c0             	movzbl %al,%eax
+  8042a2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8042a5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042ac:	00 00 00 
+  8042af:	8b 40 04             	mov    0x4(%rax),%eax
+  8042b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042b7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8042be:	00 00 00 
+  8042c1:	48 98                	cltq
+  8042c3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8042ca:	48 01 d0             	add    %rdx,%rax
+  8042cd:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8042d3:	8b 00                	mov    (%rax),%eax
+  8042d5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8042d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042db:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8042de:	75 05                	jne    8042e5 <_pipeisclosed+0xb7>
+      return ret;
+  8042e0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8042e3:	eb 68                	jmp    80434d <_pipeisclosed+0x11f>
+    if (n != nn)
+  8042e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042e8:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8042eb:	0f 84 4e ff ff ff    	je     80423f <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8042f1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042f8:	00 00 00 
+  8042fb:	8b 40 04             	mov    0x4(%rax),%eax
+  8042fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804303:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80430a:	00 00 00 
+  80430d:	48 98                	cltq
+  80430f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804316:	48 01 d0             	add    %rdx,%rax
+  804319:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80431f:	8b 10                	mov    (%rax),%edx
+  804321:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804324:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804327:	89 c6                	mov    %eax,%esi
+  804329:	48 b8 d0 56 80 00 00 	movabs $0x8056d0,%rax
+  804330:	00 00 00 
+  804333:	48 89 c7             	mov    %rax,%rdi
+  804336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433b:	49 b8 db 02 80 00 00 	movabs $0x8002db,%r8
+  804342:	00 00 00 
+  804345:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804348:	e9 f2 fe ff ff       	jmp    80423f <_pipeisclosed+0x11>
+  }
+}
+  80434d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804351:	c9                   	leave
+  804352:	c3                   	ret
+
+0000000000804353 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804353:	55                   	push   %rbp
+  804354:	48 89 e5             	mov    %rsp,%rbp
+  804357:	48 83 ec 30          	sub    $0x30,%rsp
+  80435b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80435e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804362:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804365:	48 89 d6             	mov    %rdx,%rsi
+  804368:	89 c7                	mov    %eax,%edi
+  80436a:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  804371:	00 00 00 
+  804374:	ff d0                	call   *%rax
+  804376:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804379:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80437d:	79 05                	jns    804384 <pipeisclosed+0x31>
+    return r;
+  80437f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804382:	eb 31                	jmp    8043b5 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804388:	48 89 c7             	mov    %rax,%rdi
+  80438b:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  804392:	00 00 00 
+  804395:	ff d0                	call   *%rax
+  804397:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80439b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80439f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043a3:	48 89 d6             	mov    %rdx,%rsi
+  8043a6:	48 89 c7             	mov    %rax,%rdi
+  8043a9:	48 b8 2e 42 80 00 00 	movabs $0x80422e,%rax
+  8043b0:	00 00 00 
+  8043b3:	ff d0                	call   *%rax
+}
+  8043b5:	c9                   	leave
+  8043b6:	c3                   	ret
+
+00000000008043b7 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8043b7:	55                   	push   %rbp
+  8043b8:	48 89 e5             	mov    %rsp,%rbp
+  8043bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8043bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8043c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043c7:	8b 40 18             	mov    0x18(%rax),%eax
+  8043ca:	8d 50 01             	lea    0x1(%rax),%edx
+  8043cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d1:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8043d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d8:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8043db:	85 c0                	test   %eax,%eax
+  8043dd:	74 27                	je     804406 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8043df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e3:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8043ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ee:	48 83 c0 18          	add    $0x18,%rax
+  8043f2:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8043f7:	48 89 c7             	mov    %rax,%rdi
+  8043fa:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  804401:	00 00 00 
+  804404:	ff d0                	call   *%rax
+  }
+}
+  804406:	90                   	nop
+  804407:	c9                   	leave
+  804408:	c3                   	ret
+
+0000000000804409 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804409:	55                   	push   %rbp
+  80440a:	48 89 e5             	mov    %rsp,%rbp
+  80440d:	48 83 ec 10          	sub    $0x10,%rsp
+  804411:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804415:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804418:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80441c:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804423:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804427:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80442b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80442e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804435:	89 c6                	mov    %eax,%esi
+  804437:	48 89 cf             	mov    %rcx,%rdi
+  80443a:	48 b8 05 24 80 00 00 	movabs $0x802405,%rax
+  804441:	00 00 00 
+  804444:	ff d0                	call   *%rax
+}
+  804446:	90                   	nop
+  804447:	c9                   	leave
+  804448:	c3                   	ret
+
+0000000000804449 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804449:	55                   	push   %rbp
+  80444a:	48 89 e5             	mov    %rsp,%rbp
+  80444d:	48 83 ec 70          	sub    $0x70,%rsp
+  804451:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804455:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804459:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80445d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804461:	48 89 c7             	mov    %rax,%rdi
+  804464:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  80446b:	00 00 00 
+  80446e:	ff d0                	call   *%rax
+  804470:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804474:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804479:	75 0a                	jne    804485 <devpipe_read+0x3c>
+    return 0;
+  80447b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804480:	e9 63 01 00 00       	jmp    8045e8 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804485:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804489:	8b 40 18             	mov    0x18(%rax),%eax
+  80448c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80448f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804493:	48 8b 10             	mov    (%rax),%rdx
+  804496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80449a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80449e:	48 39 c2             	cmp    %rax,%rdx
+  8044a1:	75 42                	jne    8044e5 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8044a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044ab:	48 89 d6             	mov    %rdx,%rsi
+  8044ae:	48 89 c7             	mov    %rax,%rdi
+  8044b1:	48 b8 2e 42 80 00 00 	movabs $0x80422e,%rax
+  8044b8:	00 00 00 
+  8044bb:	ff d0                	call   *%rax
+  8044bd:	85 c0                	test   %eax,%eax
+  8044bf:	74 0a                	je     8044cb <devpipe_read+0x82>
+      return 0;
+  8044c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c6:	e9 1d 01 00 00       	jmp    8045e8 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8044cb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8044ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044d2:	89 d6                	mov    %edx,%esi
+  8044d4:	48 89 c7             	mov    %rax,%rdi
+  8044d7:	48 b8 09 44 80 00 00 	movabs $0x804409,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8044e3:	eb a0                	jmp    804485 <devpipe_read+0x3c>
+      break;
+  8044e5:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8044e6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8044ea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8044ee:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8044f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8044f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044fa:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8044fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804502:	48 8b 00             	mov    (%rax),%rax
+  804505:	48 29 c2             	sub    %rax,%rdx
+  804508:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80450c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804510:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804514:	48 39 c2             	cmp    %rax,%rdx
+  804517:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80451b:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80451f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804523:	48 8b 00             	mov    (%rax),%rax
+  804526:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80452a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80452e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804533:	48 f7 f1             	div    %rcx
+  804536:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80453a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80453e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804546:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80454a:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80454e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804552:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804556:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80455a:	48 39 c2             	cmp    %rax,%rdx
+  80455d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804561:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804569:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80456d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804571:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804575:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804579:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80457d:	48 89 ce             	mov    %rcx,%rsi
+  804580:	48 89 c7             	mov    %rax,%rdi
+  804583:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  80458a:	00 00 00 
+  80458d:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80458f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804593:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804597:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80459b:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80459f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8045a3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045a7:	48 01 d1             	add    %rdx,%rcx
+  8045aa:	48 89 c2             	mov    %rax,%rdx
+  8045ad:	48 89 cf             	mov    %rcx,%rdi
+  8045b0:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  8045b7:	00 00 00 
+  8045ba:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8045bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c0:	48 8b 10             	mov    (%rax),%rdx
+  8045c3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045c7:	48 01 c2             	add    %rax,%rdx
+  8045ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ce:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8045d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d5:	48 89 c7             	mov    %rax,%rdi
+  8045d8:	48 b8 b7 43 80 00 00 	movabs $0x8043b7,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+  return n;
+  8045e4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8045e8:	c9                   	leave
+  8045e9:	c3                   	ret
+
+00000000008045ea <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8045ea:	55                   	push   %rbp
+  8045eb:	48 89 e5             	mov    %rsp,%rbp
+  8045ee:	48 83 ec 70          	sub    $0x70,%rsp
+  8045f2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8045f6:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8045fa:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8045fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804602:	48 89 c7             	mov    %rax,%rdi
+  804605:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  80460c:	00 00 00 
+  80460f:	ff d0                	call   *%rax
+  804611:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804615:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804619:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80461d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804624:	00 
+  804625:	e9 b8 01 00 00       	jmp    8047e2 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80462a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80462e:	8b 40 18             	mov    0x18(%rax),%eax
+  804631:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804638:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80463c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804640:	48 8b 00             	mov    (%rax),%rax
+  804643:	48 29 c2             	sub    %rax,%rdx
+  804646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80464e:	48 39 c2             	cmp    %rax,%rdx
+  804651:	75 4d                	jne    8046a0 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804653:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804657:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80465b:	48 89 d6             	mov    %rdx,%rsi
+  80465e:	48 89 c7             	mov    %rax,%rdi
+  804661:	48 b8 2e 42 80 00 00 	movabs $0x80422e,%rax
+  804668:	00 00 00 
+  80466b:	ff d0                	call   *%rax
+  80466d:	85 c0                	test   %eax,%eax
+  80466f:	74 0a                	je     80467b <devpipe_write+0x91>
+        return 0;
+  804671:	b8 00 00 00 00       	mov    $0x0,%eax
+  804676:	e9 79 01 00 00       	jmp    8047f4 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80467b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80467e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804682:	89 d6                	mov    %edx,%esi
+  804684:	48 89 c7             	mov    %rax,%rdi
+  804687:	48 b8 09 44 80 00 00 	movabs $0x804409,%rax
+  80468e:	00 00 00 
+  804691:	ff d0                	call   *%rax
+      m = 0;
+  804693:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80469a:	00 
+      continue;
+  80469b:	e9 3a 01 00 00       	jmp    8047da <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8046a0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046a4:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8046a8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8046ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8046b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b8:	48 8b 08             	mov    (%rax),%rcx
+  8046bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046c3:	48 29 c1             	sub    %rax,%rcx
+  8046c6:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8046ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8046ce:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8046d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046d6:	48 39 c2             	cmp    %rax,%rdx
+  8046d9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8046dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8046e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046ed:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8046f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f6:	48 f7 f1             	div    %rcx
+  8046f9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8046fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804701:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804705:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804709:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80470d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804711:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804715:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804719:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80471d:	48 39 c2             	cmp    %rax,%rdx
+  804720:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804724:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804728:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80472c:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804730:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804734:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804738:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80473c:	48 01 d1             	add    %rdx,%rcx
+  80473f:	48 89 c2             	mov    %rax,%rdx
+  804742:	48 89 cf             	mov    %rcx,%rdi
+  804745:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  80474c:	00 00 00 
+  80474f:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804755:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804759:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80475d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804761:	73 4d                	jae    8047b0 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804767:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80476b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80476f:	48 29 c2             	sub    %rax,%rdx
+  804772:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804776:	48 01 c2             	add    %rax,%rdx
+  804779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80477d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804781:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804785:	48 89 c1             	mov    %rax,%rcx
+  804788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80478c:	48 01 c1             	add    %rax,%rcx
+  80478f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804793:	48 01 c1             	add    %rax,%rcx
+  804796:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80479a:	48 83 c0 20          	add    $0x20,%rax
+  80479e:	48 89 ce             	mov    %rcx,%rsi
+  8047a1:	48 89 c7             	mov    %rax,%rdi
+  8047a4:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  8047ab:	00 00 00 
+  8047ae:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8047b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047b4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047bc:	48 01 c2             	add    %rax,%rdx
+  8047bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047c3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8047c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047cb:	48 89 c7             	mov    %rax,%rdi
+  8047ce:	48 b8 b7 43 80 00 00 	movabs $0x8043b7,%rax
+  8047d5:	00 00 00 
+  8047d8:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8047da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047de:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8047e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047e6:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8047ea:	0f 82 3a fe ff ff    	jb     80462a <devpipe_write+0x40>
+  }
+
+  return i;
+  8047f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8047f4:	c9                   	leave
+  8047f5:	c3                   	ret
+
+00000000008047f6 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8047f6:	55                   	push   %rbp
+  8047f7:	48 89 e5             	mov    %rsp,%rbp
+  8047fa:	48 83 ec 40          	sub    $0x40,%rsp
+  8047fe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804802:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804805:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804809:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80480d:	48 89 c7             	mov    %rax,%rdi
+  804810:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  804817:	00 00 00 
+  80481a:	ff d0                	call   *%rax
+  80481c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804820:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804827:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80482b:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80482f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804833:	48 89 d6             	mov    %rdx,%rsi
+  804836:	48 89 c7             	mov    %rax,%rdi
+  804839:	48 b8 d1 34 80 00 00 	movabs $0x8034d1,%rax
+  804840:	00 00 00 
+  804843:	ff d0                	call   *%rax
+  804845:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804848:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80484c:	79 08                	jns    804856 <devpipe_poll+0x60>
+    return r;
+  80484e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804851:	e9 85 00 00 00       	jmp    8048db <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804856:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804859:	83 e0 01             	and    $0x1,%eax
+  80485c:	85 c0                	test   %eax,%eax
+  80485e:	74 18                	je     804878 <devpipe_poll+0x82>
+  804860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804864:	48 8b 10             	mov    (%rax),%rdx
+  804867:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80486b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80486f:	48 39 c2             	cmp    %rax,%rdx
+  804872:	74 04                	je     804878 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804874:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804878:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80487b:	83 e0 02             	and    $0x2,%eax
+  80487e:	85 c0                	test   %eax,%eax
+  804880:	74 23                	je     8048a5 <devpipe_poll+0xaf>
+  804882:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804886:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80488a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80488e:	48 8b 00             	mov    (%rax),%rax
+  804891:	48 29 c2             	sub    %rax,%rdx
+  804894:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804898:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80489c:	48 39 c2             	cmp    %rax,%rdx
+  80489f:	73 04                	jae    8048a5 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8048a1:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8048a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ad:	48 89 d6             	mov    %rdx,%rsi
+  8048b0:	48 89 c7             	mov    %rax,%rdi
+  8048b3:	48 b8 2e 42 80 00 00 	movabs $0x80422e,%rax
+  8048ba:	00 00 00 
+  8048bd:	ff d0                	call   *%rax
+  8048bf:	85 c0                	test   %eax,%eax
+  8048c1:	74 04                	je     8048c7 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8048c3:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8048c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048cb:	75 0b                	jne    8048d8 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8048cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d1:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8048d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8048db:	c9                   	leave
+  8048dc:	c3                   	ret
+
+00000000008048dd <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8048dd:	55                   	push   %rbp
+  8048de:	48 89 e5             	mov    %rsp,%rbp
+  8048e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8048e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8048ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048f1:	48 89 c7             	mov    %rax,%rdi
+  8048f4:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  8048fb:	00 00 00 
+  8048fe:	ff d0                	call   *%rax
+  804900:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804904:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804908:	48 ba 01 57 80 00 00 	movabs $0x805701,%rdx
+  80490f:	00 00 00 
+  804912:	48 89 d6             	mov    %rdx,%rsi
+  804915:	48 89 c7             	mov    %rax,%rdi
+  804918:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  80491f:	00 00 00 
+  804922:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804924:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804928:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80492c:	89 c1                	mov    %eax,%ecx
+  80492e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804932:	48 8b 00             	mov    (%rax),%rax
+  804935:	89 c2                	mov    %eax,%edx
+  804937:	89 c8                	mov    %ecx,%eax
+  804939:	29 d0                	sub    %edx,%eax
+  80493b:	89 c2                	mov    %eax,%edx
+  80493d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804941:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804947:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80494b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804952:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804955:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804959:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804960:	00 00 00 
+  804963:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80496a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80496f:	c9                   	leave
+  804970:	c3                   	ret
+
+0000000000804971 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804971:	55                   	push   %rbp
+  804972:	48 89 e5             	mov    %rsp,%rbp
+  804975:	48 83 ec 40          	sub    $0x40,%rsp
+  804979:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80497d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804981:	48 89 c7             	mov    %rax,%rdi
+  804984:	48 b8 fe 29 80 00 00 	movabs $0x8029fe,%rax
+  80498b:	00 00 00 
+  80498e:	ff d0                	call   *%rax
+  804990:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804994:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80499b:	00 
+  80499c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049a0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049a8:	48 01 d0             	add    %rdx,%rax
+  8049ab:	48 83 c0 1f          	add    $0x1f,%rax
+  8049af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8049b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049bc:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8049c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c4:	48 29 d0             	sub    %rdx,%rax
+  8049c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049cb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8049cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049d3:	48 89 c6             	mov    %rax,%rsi
+  8049d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049db:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8049e2:	00 00 00 
+  8049e5:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8049e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049eb:	48 89 c7             	mov    %rax,%rdi
+  8049ee:	48 b8 b7 43 80 00 00 	movabs $0x8043b7,%rax
+  8049f5:	00 00 00 
+  8049f8:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8049fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804a02:	eb 2f                	jmp    804a33 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804a04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a08:	48 83 e8 01          	sub    $0x1,%rax
+  804a0c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a10:	48 89 c2             	mov    %rax,%rdx
+  804a13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a17:	48 01 d0             	add    %rdx,%rax
+  804a1a:	48 89 c6             	mov    %rax,%rsi
+  804a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a22:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  804a29:	00 00 00 
+  804a2c:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a2e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804a33:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804a38:	77 ca                	ja     804a04 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804a3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a3e:	48 89 c6             	mov    %rax,%rsi
+  804a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a46:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  804a4d:	00 00 00 
+  804a50:	ff d0                	call   *%rax
+}
+  804a52:	c9                   	leave
+  804a53:	c3                   	ret
+
+0000000000804a54 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804a54:	55                   	push   %rbp
+  804a55:	48 89 e5             	mov    %rsp,%rbp
+  804a58:	48 83 ec 08          	sub    $0x8,%rsp
+  804a5c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804a5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a63:	75 10                	jne    804a75 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804a65:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a6c:	00 00 00 
+  804a6f:	8b 00                	mov    (%rax),%eax
+  804a71:	48 98                	cltq
+  804a73:	eb 05                	jmp    804a7a <vsyscall+0x26>
+  }
+  return 0;
+  804a75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a7a:	c9                   	leave
+  804a7b:	c3                   	ret
+
+0000000000804a7c <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804a7c:	55                   	push   %rbp
+  804a7d:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804a80:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a85:	48 b8 54 4a 80 00 00 	movabs $0x804a54,%rax
+  804a8c:	00 00 00 
+  804a8f:	ff d0                	call   *%rax
+}
+  804a91:	5d                   	pop    %rbp
+  804a92:	c3                   	ret
+
+0000000000804a93 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804a93:	55                   	push   %rbp
+  804a94:	48 89 e5             	mov    %rsp,%rbp
+  804a97:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804a9b:	0f 31                	rdtsc
+  804a9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aa0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804aa3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aa6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804aa9:	48 c1 e2 20          	shl    $0x20,%rdx
+  804aad:	48 09 d0             	or     %rdx,%rax
+  804ab0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804ab4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804ab8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804abc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ac3:	00 00 00 
+  804ac6:	8b 40 08             	mov    0x8(%rax),%eax
+  804ac9:	48 98                	cltq
+  804acb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804acf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ad8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804adc:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804aec:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804af0:	48 89 d0             	mov    %rdx,%rax
+  804af3:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804afa:	ba 00 00 00 00       	mov    $0x0,%edx
+  804aff:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b03:	48 01 c8             	add    %rcx,%rax
+}
+  804b06:	c9                   	leave
+  804b07:	c3                   	ret
+
+0000000000804b08 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804b08:	55                   	push   %rbp
+  804b09:	48 89 e5             	mov    %rsp,%rbp
+  804b0c:	48 83 ec 20          	sub    $0x20,%rsp
+  804b10:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804b13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b16:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804b19:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804b1d:	be 01 00 00 00       	mov    $0x1,%esi
+  804b22:	48 89 c7             	mov    %rax,%rdi
+  804b25:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  804b2c:	00 00 00 
+  804b2f:	ff d0                	call   *%rax
+}
+  804b31:	90                   	nop
+  804b32:	c9                   	leave
+  804b33:	c3                   	ret
+
+0000000000804b34 <getchar>:
+
+int
+getchar(void) {
+  804b34:	55                   	push   %rbp
+  804b35:	48 89 e5             	mov    %rsp,%rbp
+  804b38:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804b3c:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804b40:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b45:	48 89 c6             	mov    %rax,%rsi
+  804b48:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b4d:	48 b8 67 30 80 00 00 	movabs $0x803067,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+  804b59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804b5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b60:	79 05                	jns    804b67 <getchar+0x33>
+    return r;
+  804b62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b65:	eb 14                	jmp    804b7b <getchar+0x47>
+  if (r < 1)
+  804b67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b6b:	7f 07                	jg     804b74 <getchar+0x40>
+    return -E_EOF;
+  804b6d:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804b72:	eb 07                	jmp    804b7b <getchar+0x47>
+  return c;
+  804b74:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804b78:	0f b6 c0             	movzbl %al,%eax
+}
+  804b7b:	c9                   	leave
+  804b7c:	c3                   	ret
+
+0000000000804b7d <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804b7d:	55                   	push   %rbp
+  804b7e:	48 89 e5             	mov    %rsp,%rbp
+  804b81:	48 83 ec 20          	sub    $0x20,%rsp
+  804b85:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b88:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804b8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b8f:	48 89 d6             	mov    %rdx,%rsi
+  804b92:	89 c7                	mov    %eax,%edi
+  804b94:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  804b9b:	00 00 00 
+  804b9e:	ff d0                	call   *%rax
+  804ba0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ba3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ba7:	79 05                	jns    804bae <iscons+0x31>
+    return r;
+  804ba9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bac:	eb 1a                	jmp    804bc8 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804bae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bb2:	8b 10                	mov    (%rax),%edx
+  804bb4:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804bbb:	00 00 00 
+  804bbe:	8b 00                	mov    (%rax),%eax
+  804bc0:	39 c2                	cmp    %eax,%edx
+  804bc2:	0f 94 c0             	sete   %al
+  804bc5:	0f b6 c0             	movzbl %al,%eax
+}
+  804bc8:	c9                   	leave
+  804bc9:	c3                   	ret
+
+0000000000804bca <opencons>:
+
+int
+opencons(void) {
+  804bca:	55                   	push   %rbp
+  804bcb:	48 89 e5             	mov    %rsp,%rbp
+  804bce:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804bd2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804bd6:	48 89 c7             	mov    %rax,%rdi
+  804bd9:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804be0:	00 00 00 
+  804be3:	ff d0                	call   *%rax
+  804be5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804be8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bec:	79 05                	jns    804bf3 <opencons+0x29>
+    return r;
+  804bee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bf1:	eb 66                	jmp    804c59 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804bf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bf7:	ba 07 04 00 00       	mov    $0x407,%edx
+  804bfc:	48 89 c6             	mov    %rax,%rsi
+  804bff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c04:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  804c0b:	00 00 00 
+  804c0e:	ff d0                	call   *%rax
+  804c10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c17:	79 05                	jns    804c1e <opencons+0x54>
+    return r;
+  804c19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c1c:	eb 3b                	jmp    804c59 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c22:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804c29:	00 00 00 
+  804c2c:	8b 12                	mov    (%rdx),%edx
+  804c2e:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804c30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c34:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c3f:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804c46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c4a:	48 89 c7             	mov    %rax,%rdi
+  804c4d:	48 b8 db 29 80 00 00 	movabs $0x8029db,%rax
+  804c54:	00 00 00 
+  804c57:	ff d0                	call   *%rax
+}
+  804c59:	c9                   	leave
+  804c5a:	c3                   	ret
+
+0000000000804c5b <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804c5b:	55                   	push   %rbp
+  804c5c:	48 89 e5             	mov    %rsp,%rbp
+  804c5f:	48 83 ec 20          	sub    $0x20,%rsp
+  804c63:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c66:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c69:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804c6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c70:	48 89 d6             	mov    %rdx,%rsi
+  804c73:	89 c7                	mov    %eax,%edi
+  804c75:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  804c7c:	00 00 00 
+  804c7f:	ff d0                	call   *%rax
+  804c81:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c84:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c88:	79 05                	jns    804c8f <consmode+0x34>
+    return r;
+  804c8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c8d:	eb 34                	jmp    804cc3 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804c8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c93:	8b 10                	mov    (%rax),%edx
+  804c95:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804c9c:	00 00 00 
+  804c9f:	8b 00                	mov    (%rax),%eax
+  804ca1:	39 c2                	cmp    %eax,%edx
+  804ca3:	74 07                	je     804cac <consmode+0x51>
+    return -E_INVAL;
+  804ca5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804caa:	eb 17                	jmp    804cc3 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cb0:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cb3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cba:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804cbd:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804cc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804cc3:	c9                   	leave
+  804cc4:	c3                   	ret
+
+0000000000804cc5 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804cc5:	55                   	push   %rbp
+  804cc6:	48 89 e5             	mov    %rsp,%rbp
+  804cc9:	48 83 ec 20          	sub    $0x20,%rsp
+  804ccd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804cd5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cdd:	8b 50 0c             	mov    0xc(%rax),%edx
+  804ce0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ce8:	48 89 ce             	mov    %rcx,%rsi
+  804ceb:	48 89 c7             	mov    %rax,%rdi
+  804cee:	48 b8 b3 23 80 00 00 	movabs $0x8023b3,%rax
+  804cf5:	00 00 00 
+  804cf8:	ff d0                	call   *%rax
+  804cfa:	48 98                	cltq
+}
+  804cfc:	c9                   	leave
+  804cfd:	c3                   	ret
+
+0000000000804cfe <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804cfe:	55                   	push   %rbp
+  804cff:	48 89 e5             	mov    %rsp,%rbp
+  804d02:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804d09:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804d10:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804d17:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804d1e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d25:	eb 74                	jmp    804d9b <devcons_write+0x9d>
+    m = n - tot;
+  804d27:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804d2e:	89 c2                	mov    %eax,%edx
+  804d30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d33:	29 c2                	sub    %eax,%edx
+  804d35:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804d38:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d3b:	83 f8 7f             	cmp    $0x7f,%eax
+  804d3e:	76 07                	jbe    804d47 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804d40:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804d47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d4a:	48 63 d0             	movslq %eax,%rdx
+  804d4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d50:	48 63 c8             	movslq %eax,%rcx
+  804d53:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804d5a:	48 01 c1             	add    %rax,%rcx
+  804d5d:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804d64:	48 89 ce             	mov    %rcx,%rsi
+  804d67:	48 89 c7             	mov    %rax,%rdi
+  804d6a:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  804d71:	00 00 00 
+  804d74:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804d76:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d79:	48 63 d0             	movslq %eax,%rdx
+  804d7c:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804d83:	48 89 d6             	mov    %rdx,%rsi
+  804d86:	48 89 c7             	mov    %rax,%rdi
+  804d89:	48 b8 42 1e 80 00 00 	movabs $0x801e42,%rax
+  804d90:	00 00 00 
+  804d93:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804d95:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d98:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804d9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d9e:	48 98                	cltq
+  804da0:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804da7:	0f 82 7a ff ff ff    	jb     804d27 <devcons_write+0x29>
+  }
+  return tot;
+  804dad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804db0:	48 98                	cltq
+}
+  804db2:	c9                   	leave
+  804db3:	c3                   	ret
+
+0000000000804db4 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804db4:	55                   	push   %rbp
+  804db5:	48 89 e5             	mov    %rsp,%rbp
+  804db8:	48 83 ec 08          	sub    $0x8,%rsp
+  804dbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dc5:	c9                   	leave
+  804dc6:	c3                   	ret
+
+0000000000804dc7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dc7:	55                   	push   %rbp
+  804dc8:	48 89 e5             	mov    %rsp,%rbp
+  804dcb:	48 83 ec 10          	sub    $0x10,%rsp
+  804dcf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804dd3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804dd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ddb:	48 ba 0d 57 80 00 00 	movabs $0x80570d,%rdx
+  804de2:	00 00 00 
+  804de5:	48 89 d6             	mov    %rdx,%rsi
+  804de8:	48 89 c7             	mov    %rax,%rdi
+  804deb:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  804df2:	00 00 00 
+  804df5:	ff d0                	call   *%rax
+  return 0;
+  804df7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dfc:	c9                   	leave
+  804dfd:	c3                   	ret
+
+0000000000804dfe <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804dfe:	55                   	push   %rbp
+  804dff:	48 89 e5             	mov    %rsp,%rbp
+  804e02:	48 83 ec 30          	sub    $0x30,%rsp
+  804e06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e0a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804e0d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804e11:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804e18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e1b:	83 e0 02             	and    $0x2,%eax
+  804e1e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804e21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e25:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e28:	83 f8 01             	cmp    $0x1,%eax
+  804e2b:	75 04                	jne    804e31 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804e2d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804e31:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e34:	83 e0 01             	and    $0x1,%eax
+  804e37:	85 c0                	test   %eax,%eax
+  804e39:	74 44                	je     804e7f <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804e3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e43:	89 c2                	mov    %eax,%edx
+  804e45:	be 00 00 00 00       	mov    $0x0,%esi
+  804e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e4f:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  804e56:	00 00 00 
+  804e59:	ff d0                	call   *%rax
+  804e5b:	83 f8 01             	cmp    $0x1,%eax
+  804e5e:	75 06                	jne    804e66 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804e60:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804e64:	eb 19                	jmp    804e7f <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804e66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e6a:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804e70:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804e73:	89 c2                	mov    %eax,%edx
+  804e75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e79:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804e7f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804e82:	c9                   	leave
+  804e83:	c3                   	ret
+
+0000000000804e84 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804e84:	55                   	push   %rbp
+  804e85:	48 89 e5             	mov    %rsp,%rbp
+  804e88:	53                   	push   %rbx
+  804e89:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804e90:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804e97:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804e9d:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804ea4:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804eab:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804eb2:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804eb9:	84 c0                	test   %al,%al
+  804ebb:	74 23                	je     804ee0 <_panic+0x5c>
+  804ebd:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804ec4:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804ec8:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804ecc:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804ed0:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804ed4:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804ed8:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804edc:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804ee0:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804ee7:	00 00 00 
+  804eea:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804ef1:	00 00 00 
+  804ef4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804ef8:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804eff:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804f06:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804f0d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804f14:	00 00 00 
+  804f17:	48 8b 18             	mov    (%rax),%rbx
+  804f1a:	48 b8 e0 1f 80 00 00 	movabs $0x801fe0,%rax
+  804f21:	00 00 00 
+  804f24:	ff d0                	call   *%rax
+  804f26:	89 c6                	mov    %eax,%esi
+  804f28:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804f2e:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804f35:	41 89 d0             	mov    %edx,%r8d
+  804f38:	48 89 c1             	mov    %rax,%rcx
+  804f3b:	48 89 da             	mov    %rbx,%rdx
+  804f3e:	48 b8 18 57 80 00 00 	movabs $0x805718,%rax
+  804f45:	00 00 00 
+  804f48:	48 89 c7             	mov    %rax,%rdi
+  804f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f50:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  804f57:	00 00 00 
+  804f5a:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804f5d:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804f64:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804f6b:	48 89 d6             	mov    %rdx,%rsi
+  804f6e:	48 89 c7             	mov    %rax,%rdi
+  804f71:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  804f78:	00 00 00 
+  804f7b:	ff d0                	call   *%rax
+  cprintf("\n");
+  804f7d:	48 b8 3b 57 80 00 00 	movabs $0x80573b,%rax
+  804f84:	00 00 00 
+  804f87:	48 89 c7             	mov    %rax,%rdi
+  804f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8f:	48 ba db 02 80 00 00 	movabs $0x8002db,%rdx
+  804f96:	00 00 00 
+  804f99:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804f9b:	cc                   	int3
+  804f9c:	eb fd                	jmp    804f9b <_panic+0x117>
+
+0000000000804f9e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804f9e:	55                   	push   %rbp
+  804f9f:	48 89 e5             	mov    %rsp,%rbp
+  804fa2:	48 83 ec 18          	sub    $0x18,%rsp
+  804fa6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fae:	48 c1 e8 27          	shr    $0x27,%rax
+  804fb2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804fb7:	48 89 c2             	mov    %rax,%rdx
+  804fba:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804fc1:	01 00 00 
+  804fc4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fc8:	83 e0 01             	and    $0x1,%eax
+  804fcb:	48 85 c0             	test   %rax,%rax
+  804fce:	74 63                	je     805033 <pageref+0x95>
+  804fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804fd8:	48 89 c2             	mov    %rax,%rdx
+  804fdb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804fe2:	01 00 00 
+  804fe5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fe9:	83 e0 01             	and    $0x1,%eax
+  804fec:	48 85 c0             	test   %rax,%rax
+  804fef:	74 42                	je     805033 <pageref+0x95>
+  804ff1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff5:	48 c1 e8 15          	shr    $0x15,%rax
+  804ff9:	48 89 c2             	mov    %rax,%rdx
+  804ffc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805003:	01 00 00 
+  805006:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80500a:	83 e0 01             	and    $0x1,%eax
+  80500d:	48 85 c0             	test   %rax,%rax
+  805010:	74 21                	je     805033 <pageref+0x95>
+  805012:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805016:	48 c1 e8 0c          	shr    $0xc,%rax
+  80501a:	48 89 c2             	mov    %rax,%rdx
+  80501d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805024:	01 00 00 
+  805027:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80502b:	83 e0 01             	and    $0x1,%eax
+  80502e:	48 85 c0             	test   %rax,%rax
+  805031:	75 07                	jne    80503a <pageref+0x9c>
+    return 0;
+  805033:	b8 00 00 00 00       	mov    $0x0,%eax
+  805038:	eb 53                	jmp    80508d <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  80503a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80503e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805042:	48 89 c2             	mov    %rax,%rdx
+  805045:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80504c:	01 00 00 
+  80504f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805053:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805057:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80505b:	83 e0 01             	and    $0x1,%eax
+  80505e:	48 85 c0             	test   %rax,%rax
+  805061:	75 07                	jne    80506a <pageref+0xcc>
+    return 0;
+  805063:	b8 00 00 00 00       	mov    $0x0,%eax
+  805068:	eb 23                	jmp    80508d <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80506a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80506e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805072:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805079:	00 00 00 
+  80507c:	48 c1 e0 04          	shl    $0x4,%rax
+  805080:	48 01 d0             	add    %rdx,%rax
+  805083:	48 83 c0 08          	add    $0x8,%rax
+  805087:	0f b7 00             	movzwl (%rax),%eax
+  80508a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80508d:	c9                   	leave
+  80508e:	c3                   	ret
+  80508f:	90                   	nop
@@ -0,0 +1,8337 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 5d 01 00 00       	call   800189 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <handler>:
+// test user-level fault handler -- alloc pages to fix faults
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  80003a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int r;
+  void *addr = (void *)utf->utf_fault_va;
+  80003e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800042:	48 8b 00             	mov    (%rax),%rax
+  800045:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  cprintf("fault %lx\n", (unsigned long)addr);
+  800049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80004d:	48 89 c6             	mov    %rax,%rsi
+  800050:	48 b8 60 52 80 00 00 	movabs $0x805260,%rax
+  800057:	00 00 00 
+  80005a:	48 89 c7             	mov    %rax,%rdi
+  80005d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800062:	48 ba 4f 04 80 00 00 	movabs $0x80044f,%rdx
+  800069:	00 00 00 
+  80006c:	ff d2                	call   *%rdx
+  if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80006e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800072:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800076:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80007a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800080:	ba 07 00 00 00       	mov    $0x7,%edx
+  800085:	48 89 c6             	mov    %rax,%rsi
+  800088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008d:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  800094:	00 00 00 
+  800097:	ff d0                	call   *%rax
+  800099:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80009c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a0:	79 3e                	jns    8000e0 <handler+0xae>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+    panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000a6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000a9:	41 89 d0             	mov    %edx,%r8d
+  8000ac:	48 89 c1             	mov    %rax,%rcx
+  8000af:	48 b8 70 52 80 00 00 	movabs $0x805270,%rax
+  8000b6:	00 00 00 
+  8000b9:	48 89 c2             	mov    %rax,%rdx
+  8000bc:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000c1:	48 b8 9c 52 80 00 00 	movabs $0x80529c,%rax
+  8000c8:	00 00 00 
+  8000cb:	48 89 c7             	mov    %rax,%rdi
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	49 b9 30 02 80 00 00 	movabs $0x800230,%r9
+  8000da:	00 00 00 
+  8000dd:	41 ff d1             	call   *%r9
+  snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  8000e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8000e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000e8:	48 89 d1             	mov    %rdx,%rcx
+  8000eb:	48 ba b0 52 80 00 00 	movabs $0x8052b0,%rdx
+  8000f2:	00 00 00 
+  8000f5:	be 64 00 00 00       	mov    $0x64,%esi
+  8000fa:	48 89 c7             	mov    %rax,%rdi
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	49 b8 39 0e 80 00 00 	movabs $0x800e39,%r8
+  800109:	00 00 00 
+  80010c:	41 ff d0             	call   *%r8
+}
+  80010f:	90                   	nop
+  800110:	c9                   	leave
+  800111:	c3                   	ret
+
+0000000000800112 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	48 83 ec 10          	sub    $0x10,%rsp
+  80011a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80011d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  set_pgfault_handler(handler);
+  800121:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800128:	00 00 00 
+  80012b:	48 89 c7             	mov    %rax,%rdi
+  80012e:	48 b8 b4 28 80 00 00 	movabs $0x8028b4,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+  cprintf("%s\n", (char *)0xBeefDead);
+  80013a:	b8 ad de ef be       	mov    $0xbeefdead,%eax
+  80013f:	48 89 c6             	mov    %rax,%rsi
+  800142:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  800149:	00 00 00 
+  80014c:	48 89 c7             	mov    %rax,%rdi
+  80014f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800154:	48 ba 4f 04 80 00 00 	movabs $0x80044f,%rdx
+  80015b:	00 00 00 
+  80015e:	ff d2                	call   *%rdx
+  cprintf("%s\n", (char *)0xCafeBffe);
+  800160:	b8 fe bf fe ca       	mov    $0xcafebffe,%eax
+  800165:	48 89 c6             	mov    %rax,%rsi
+  800168:	48 b8 d2 52 80 00 00 	movabs $0x8052d2,%rax
+  80016f:	00 00 00 
+  800172:	48 89 c7             	mov    %rax,%rdi
+  800175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017a:	48 ba 4f 04 80 00 00 	movabs $0x80044f,%rdx
+  800181:	00 00 00 
+  800184:	ff d2                	call   *%rdx
+}
+  800186:	90                   	nop
+  800187:	c9                   	leave
+  800188:	c3                   	ret
+
+0000000000800189 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800189:	55                   	push   %rbp
+  80018a:	48 89 e5             	mov    %rsp,%rbp
+  80018d:	48 83 ec 20          	sub    $0x20,%rsp
+  800191:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800194:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800198:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80019f:	00 00 00 
+  8001a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001a6:	eb 13                	jmp    8001bb <libmain+0x32>
+    (*ctor)();
+  8001a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001ac:	48 8b 10             	mov    (%rax),%rdx
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	ff d2                	call   *%rdx
+    ctor++;
+  8001b6:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001bb:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8001c2:	00 00 00 
+  8001c5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8001c9:	72 dd                	jb     8001a8 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001cf:	7e 14                	jle    8001e5 <libmain+0x5c>
+    binaryname = argv[0];
+  8001d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001d5:	48 8b 00             	mov    (%rax),%rax
+  8001d8:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8001df:	00 00 00 
+  8001e2:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001ec:	48 89 d6             	mov    %rdx,%rsi
+  8001ef:	89 c7                	mov    %eax,%edi
+  8001f1:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001fd:	48 b8 0c 02 80 00 00 	movabs $0x80020c,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+#endif
+}
+  800209:	90                   	nop
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+000000000080020c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800210:	48 b8 0a 2e 80 00 00 	movabs $0x802e0a,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80021c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800221:	48 b8 85 20 80 00 00 	movabs $0x802085,%rax
+  800228:	00 00 00 
+  80022b:	ff d0                	call   *%rax
+}
+  80022d:	90                   	nop
+  80022e:	5d                   	pop    %rbp
+  80022f:	c3                   	ret
+
+0000000000800230 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800230:	55                   	push   %rbp
+  800231:	48 89 e5             	mov    %rsp,%rbp
+  800234:	53                   	push   %rbx
+  800235:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80023c:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800243:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800249:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800250:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800257:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80025e:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800265:	84 c0                	test   %al,%al
+  800267:	74 23                	je     80028c <_panic+0x5c>
+  800269:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800270:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800274:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800278:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80027c:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800280:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800284:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800288:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80028c:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800293:	00 00 00 
+  800296:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80029d:	00 00 00 
+  8002a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a4:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8002ab:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8002b2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002b9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002c0:	00 00 00 
+  8002c3:	48 8b 18             	mov    (%rax),%rbx
+  8002c6:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+  8002d2:	89 c6                	mov    %eax,%esi
+  8002d4:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8002da:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8002e1:	41 89 d0             	mov    %edx,%r8d
+  8002e4:	48 89 c1             	mov    %rax,%rcx
+  8002e7:	48 89 da             	mov    %rbx,%rdx
+  8002ea:	48 b8 e0 52 80 00 00 	movabs $0x8052e0,%rax
+  8002f1:	00 00 00 
+  8002f4:	48 89 c7             	mov    %rax,%rdi
+  8002f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fc:	49 b9 4f 04 80 00 00 	movabs $0x80044f,%r9
+  800303:	00 00 00 
+  800306:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800309:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800310:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800317:	48 89 d6             	mov    %rdx,%rsi
+  80031a:	48 89 c7             	mov    %rax,%rdi
+  80031d:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+  cprintf("\n");
+  800329:	48 b8 03 53 80 00 00 	movabs $0x805303,%rax
+  800330:	00 00 00 
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	48 ba 4f 04 80 00 00 	movabs $0x80044f,%rdx
+  800342:	00 00 00 
+  800345:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800347:	cc                   	int3
+  800348:	eb fd                	jmp    800347 <_panic+0x117>
+
+000000000080034a <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80034a:	55                   	push   %rbp
+  80034b:	48 89 e5             	mov    %rsp,%rbp
+  80034e:	48 83 ec 10          	sub    $0x10,%rsp
+  800352:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800355:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80035d:	8b 00                	mov    (%rax),%eax
+  80035f:	8d 48 01             	lea    0x1(%rax),%ecx
+  800362:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800366:	89 0a                	mov    %ecx,(%rdx)
+  800368:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80036b:	89 d1                	mov    %edx,%ecx
+  80036d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800371:	48 98                	cltq
+  800373:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800377:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80037b:	8b 00                	mov    (%rax),%eax
+  80037d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800382:	75 2c                	jne    8003b0 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800384:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800388:	8b 00                	mov    (%rax),%eax
+  80038a:	48 98                	cltq
+  80038c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800390:	48 83 c2 08          	add    $0x8,%rdx
+  800394:	48 89 c6             	mov    %rax,%rsi
+  800397:	48 89 d7             	mov    %rdx,%rdi
+  80039a:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+    b->idx = 0;
+  8003a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003aa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8003b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003b4:	8b 40 04             	mov    0x4(%rax),%eax
+  8003b7:	8d 50 01             	lea    0x1(%rax),%edx
+  8003ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003be:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003c1:	90                   	nop
+  8003c2:	c9                   	leave
+  8003c3:	c3                   	ret
+
+00000000008003c4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003c4:	55                   	push   %rbp
+  8003c5:	48 89 e5             	mov    %rsp,%rbp
+  8003c8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8003cf:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8003d6:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8003dd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003e4:	00 00 00 
+  b.cnt = 0;
+  8003e7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003ee:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8003f1:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8003f8:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8003ff:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800406:	48 89 c6             	mov    %rax,%rsi
+  800409:	48 b8 4a 03 80 00 00 	movabs $0x80034a,%rax
+  800410:	00 00 00 
+  800413:	48 89 c7             	mov    %rax,%rdi
+  800416:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800422:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800428:	48 98                	cltq
+  80042a:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800431:	48 83 c2 08          	add    $0x8,%rdx
+  800435:	48 89 c6             	mov    %rax,%rsi
+  800438:	48 89 d7             	mov    %rdx,%rdi
+  80043b:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  800442:	00 00 00 
+  800445:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800447:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80044d:	c9                   	leave
+  80044e:	c3                   	ret
+
+000000000080044f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80044f:	55                   	push   %rbp
+  800450:	48 89 e5             	mov    %rsp,%rbp
+  800453:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80045a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800461:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800468:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80046f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800476:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80047d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800484:	84 c0                	test   %al,%al
+  800486:	74 20                	je     8004a8 <cprintf+0x59>
+  800488:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80048c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800490:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800494:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800498:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80049c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004a0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004a4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004a8:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004af:	00 00 00 
+  8004b2:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004b9:	00 00 00 
+  8004bc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004c0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8004c7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004ce:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8004d5:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8004dc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8004e3:	48 89 d6             	mov    %rdx,%rsi
+  8004e6:	48 89 c7             	mov    %rax,%rdi
+  8004e9:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8004fb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800501:	c9                   	leave
+  800502:	c3                   	ret
+
+0000000000800503 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800503:	55                   	push   %rbp
+  800504:	48 89 e5             	mov    %rsp,%rbp
+  800507:	48 83 ec 30          	sub    $0x30,%rsp
+  80050b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80050f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800513:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800517:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80051a:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80051e:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800522:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800525:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800529:	72 54                	jb     80057f <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80052b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80052e:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800531:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800534:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800538:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053d:	48 f7 f6             	div    %rsi
+  800540:	49 89 c2             	mov    %rax,%r10
+  800543:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800546:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800549:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80054d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800551:	41 89 c9             	mov    %ecx,%r9d
+  800554:	41 89 f8             	mov    %edi,%r8d
+  800557:	89 d1                	mov    %edx,%ecx
+  800559:	4c 89 d2             	mov    %r10,%rdx
+  80055c:	48 89 c7             	mov    %rax,%rdi
+  80055f:	48 b8 03 05 80 00 00 	movabs $0x800503,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+  80056b:	eb 1c                	jmp    800589 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80056d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800571:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800574:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800578:	48 89 d6             	mov    %rdx,%rsi
+  80057b:	89 c7                	mov    %eax,%edi
+  80057d:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80057f:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800583:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800587:	7f e4                	jg     80056d <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800589:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80058c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800590:	ba 00 00 00 00       	mov    $0x0,%edx
+  800595:	48 f7 f1             	div    %rcx
+  800598:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  80059f:	00 00 00 
+  8005a2:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8005a6:	0f be c0             	movsbl %al,%eax
+  8005a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ad:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005b1:	48 89 d6             	mov    %rdx,%rsi
+  8005b4:	89 c7                	mov    %eax,%edi
+  8005b6:	ff d1                	call   *%rcx
+}
+  8005b8:	90                   	nop
+  8005b9:	c9                   	leave
+  8005ba:	c3                   	ret
+
+00000000008005bb <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8005bb:	55                   	push   %rbp
+  8005bc:	48 89 e5             	mov    %rsp,%rbp
+  8005bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8005c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005c7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8005ca:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8005ce:	7e 4b                	jle    80061b <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8005d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d4:	8b 00                	mov    (%rax),%eax
+  8005d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d9:	77 24                	ja     8005ff <getuint+0x44>
+  8005db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005df:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e7:	8b 00                	mov    (%rax),%eax
+  8005e9:	89 c0                	mov    %eax,%eax
+  8005eb:	48 01 d0             	add    %rdx,%rax
+  8005ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005f2:	8b 12                	mov    (%rdx),%edx
+  8005f4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005fb:	89 0a                	mov    %ecx,(%rdx)
+  8005fd:	eb 14                	jmp    800613 <getuint+0x58>
+  8005ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800603:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800607:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80060b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80060f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800613:	48 8b 00             	mov    (%rax),%rax
+  800616:	e9 95 00 00 00       	jmp    8006b0 <getuint+0xf5>
+  else if (lflag)
+  80061b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80061f:	74 48                	je     800669 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800625:	8b 00                	mov    (%rax),%eax
+  800627:	83 f8 2f             	cmp    $0x2f,%eax
+  80062a:	77 24                	ja     800650 <getuint+0x95>
+  80062c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800630:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800638:	8b 00                	mov    (%rax),%eax
+  80063a:	89 c0                	mov    %eax,%eax
+  80063c:	48 01 d0             	add    %rdx,%rax
+  80063f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800643:	8b 12                	mov    (%rdx),%edx
+  800645:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800648:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80064c:	89 0a                	mov    %ecx,(%rdx)
+  80064e:	eb 14                	jmp    800664 <getuint+0xa9>
+  800650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800654:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800658:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80065c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800660:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800664:	48 8b 00             	mov    (%rax),%rax
+  800667:	eb 47                	jmp    8006b0 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80066d:	8b 00                	mov    (%rax),%eax
+  80066f:	83 f8 2f             	cmp    $0x2f,%eax
+  800672:	77 24                	ja     800698 <getuint+0xdd>
+  800674:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800678:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80067c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800680:	8b 00                	mov    (%rax),%eax
+  800682:	89 c0                	mov    %eax,%eax
+  800684:	48 01 d0             	add    %rdx,%rax
+  800687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068b:	8b 12                	mov    (%rdx),%edx
+  80068d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800690:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800694:	89 0a                	mov    %ecx,(%rdx)
+  800696:	eb 14                	jmp    8006ac <getuint+0xf1>
+  800698:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80069c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006a0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006a8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006ac:	8b 00                	mov    (%rax),%eax
+  8006ae:	89 c0                	mov    %eax,%eax
+}
+  8006b0:	c9                   	leave
+  8006b1:	c3                   	ret
+
+00000000008006b2 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8006b2:	55                   	push   %rbp
+  8006b3:	48 89 e5             	mov    %rsp,%rbp
+  8006b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8006ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006be:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8006c1:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8006c5:	7e 4b                	jle    800712 <getint+0x60>
+    return va_arg(*ap, long long);
+  8006c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006cb:	8b 00                	mov    (%rax),%eax
+  8006cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d0:	77 24                	ja     8006f6 <getint+0x44>
+  8006d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006d6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006de:	8b 00                	mov    (%rax),%eax
+  8006e0:	89 c0                	mov    %eax,%eax
+  8006e2:	48 01 d0             	add    %rdx,%rax
+  8006e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e9:	8b 12                	mov    (%rdx),%edx
+  8006eb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006f2:	89 0a                	mov    %ecx,(%rdx)
+  8006f4:	eb 14                	jmp    80070a <getint+0x58>
+  8006f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006fe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800702:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800706:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80070a:	48 8b 00             	mov    (%rax),%rax
+  80070d:	e9 95 00 00 00       	jmp    8007a7 <getint+0xf5>
+  else if (lflag)
+  800712:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800716:	74 48                	je     800760 <getint+0xae>
+    return va_arg(*ap, long);
+  800718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80071c:	8b 00                	mov    (%rax),%eax
+  80071e:	83 f8 2f             	cmp    $0x2f,%eax
+  800721:	77 24                	ja     800747 <getint+0x95>
+  800723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800727:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80072b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80072f:	8b 00                	mov    (%rax),%eax
+  800731:	89 c0                	mov    %eax,%eax
+  800733:	48 01 d0             	add    %rdx,%rax
+  800736:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80073a:	8b 12                	mov    (%rdx),%edx
+  80073c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80073f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800743:	89 0a                	mov    %ecx,(%rdx)
+  800745:	eb 14                	jmp    80075b <getint+0xa9>
+  800747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80074f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800753:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800757:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80075b:	48 8b 00             	mov    (%rax),%rax
+  80075e:	eb 47                	jmp    8007a7 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800764:	8b 00                	mov    (%rax),%eax
+  800766:	83 f8 2f             	cmp    $0x2f,%eax
+  800769:	77 24                	ja     80078f <getint+0xdd>
+  80076b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80076f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800777:	8b 00                	mov    (%rax),%eax
+  800779:	89 c0                	mov    %eax,%eax
+  80077b:	48 01 d0             	add    %rdx,%rax
+  80077e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800782:	8b 12                	mov    (%rdx),%edx
+  800784:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800787:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80078b:	89 0a                	mov    %ecx,(%rdx)
+  80078d:	eb 14                	jmp    8007a3 <getint+0xf1>
+  80078f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800793:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800797:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80079b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80079f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007a3:	8b 00                	mov    (%rax),%eax
+  8007a5:	48 98                	cltq
+}
+  8007a7:	c9                   	leave
+  8007a8:	c3                   	ret
+
+00000000008007a9 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8007a9:	55                   	push   %rbp
+  8007aa:	48 89 e5             	mov    %rsp,%rbp
+  8007ad:	41 54                	push   %r12
+  8007af:	53                   	push   %rbx
+  8007b0:	48 83 ec 60          	sub    $0x60,%rsp
+  8007b4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8007b8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8007bc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007c0:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8007c4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007c8:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8007cc:	48 8b 06             	mov    (%rsi),%rax
+  8007cf:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007d3:	48 89 01             	mov    %rax,(%rcx)
+  8007d6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007da:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007de:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007e2:	eb 17                	jmp    8007fb <vprintfmt+0x52>
+      if (ch == '\0')
+  8007e4:	85 db                	test   %ebx,%ebx
+  8007e6:	0f 84 bf 04 00 00    	je     800cab <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8007ec:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007f0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8007f4:	48 89 c6             	mov    %rax,%rsi
+  8007f7:	89 df                	mov    %ebx,%edi
+  8007f9:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007fb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800803:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800807:	0f b6 00             	movzbl (%rax),%eax
+  80080a:	0f b6 d8             	movzbl %al,%ebx
+  80080d:	83 fb 25             	cmp    $0x25,%ebx
+  800810:	75 d2                	jne    8007e4 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800812:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800816:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80081d:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800824:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80082b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800832:	eb 04                	jmp    800838 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800834:	90                   	nop
+  800835:	eb 01                	jmp    800838 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800837:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800838:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80083c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800840:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800844:	0f b6 00             	movzbl (%rax),%eax
+  800847:	0f b6 d8             	movzbl %al,%ebx
+  80084a:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80084d:	83 f8 55             	cmp    $0x55,%eax
+  800850:	0f 87 22 04 00 00    	ja     800c78 <vprintfmt+0x4cf>
+  800856:	89 c0                	mov    %eax,%eax
+  800858:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80085f:	00 
+  800860:	48 b8 78 55 80 00 00 	movabs $0x805578,%rax
+  800867:	00 00 00 
+  80086a:	48 01 d0             	add    %rdx,%rax
+  80086d:	48 8b 00             	mov    (%rax),%rax
+  800870:	ff e0                	jmp    *%rax
+        padc = '-';
+  800872:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800876:	eb c0                	jmp    800838 <vprintfmt+0x8f>
+        padc = '0';
+  800878:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80087c:	eb ba                	jmp    800838 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80087e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800885:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800888:	89 d0                	mov    %edx,%eax
+  80088a:	c1 e0 02             	shl    $0x2,%eax
+  80088d:	01 d0                	add    %edx,%eax
+  80088f:	01 c0                	add    %eax,%eax
+  800891:	01 d8                	add    %ebx,%eax
+  800893:	83 e8 30             	sub    $0x30,%eax
+  800896:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800899:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80089d:	0f b6 00             	movzbl (%rax),%eax
+  8008a0:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8008a3:	83 fb 2f             	cmp    $0x2f,%ebx
+  8008a6:	7e 60                	jle    800908 <vprintfmt+0x15f>
+  8008a8:	83 fb 39             	cmp    $0x39,%ebx
+  8008ab:	7f 5b                	jg     800908 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8008ad:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8008b2:	eb d1                	jmp    800885 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	77 17                	ja     8008d3 <vprintfmt+0x12a>
+  8008bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008c0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008c3:	89 d2                	mov    %edx,%edx
+  8008c5:	48 01 d0             	add    %rdx,%rax
+  8008c8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008cb:	83 c2 08             	add    $0x8,%edx
+  8008ce:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008d1:	eb 0c                	jmp    8008df <vprintfmt+0x136>
+  8008d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008d7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008db:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008df:	8b 00                	mov    (%rax),%eax
+  8008e1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8008e4:	eb 23                	jmp    800909 <vprintfmt+0x160>
+        if (width < 0)
+  8008e6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008ea:	0f 89 44 ff ff ff    	jns    800834 <vprintfmt+0x8b>
+          width = 0;
+  8008f0:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8008f7:	e9 38 ff ff ff       	jmp    800834 <vprintfmt+0x8b>
+        altflag = 1;
+  8008fc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800903:	e9 30 ff ff ff       	jmp    800838 <vprintfmt+0x8f>
+        goto process_precision;
+  800908:	90                   	nop
+        if (width < 0)
+  800909:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80090d:	0f 89 24 ff ff ff    	jns    800837 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800913:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800916:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800919:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800920:	e9 12 ff ff ff       	jmp    800837 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800925:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800929:	e9 0a ff ff ff       	jmp    800838 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80092e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800931:	83 f8 2f             	cmp    $0x2f,%eax
+  800934:	77 17                	ja     80094d <vprintfmt+0x1a4>
+  800936:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80093a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80093d:	89 d2                	mov    %edx,%edx
+  80093f:	48 01 d0             	add    %rdx,%rax
+  800942:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800945:	83 c2 08             	add    $0x8,%edx
+  800948:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80094b:	eb 0c                	jmp    800959 <vprintfmt+0x1b0>
+  80094d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800951:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800955:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800959:	8b 00                	mov    (%rax),%eax
+  80095b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80095f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800963:	48 89 d6             	mov    %rdx,%rsi
+  800966:	89 c7                	mov    %eax,%edi
+  800968:	ff d1                	call   *%rcx
+        break;
+  80096a:	e9 37 03 00 00       	jmp    800ca6 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80096f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800972:	83 f8 2f             	cmp    $0x2f,%eax
+  800975:	77 17                	ja     80098e <vprintfmt+0x1e5>
+  800977:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80097b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80097e:	89 d2                	mov    %edx,%edx
+  800980:	48 01 d0             	add    %rdx,%rax
+  800983:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800986:	83 c2 08             	add    $0x8,%edx
+  800989:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80098c:	eb 0c                	jmp    80099a <vprintfmt+0x1f1>
+  80098e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800992:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800996:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80099a:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80099c:	85 db                	test   %ebx,%ebx
+  80099e:	79 02                	jns    8009a2 <vprintfmt+0x1f9>
+          err = -err;
+  8009a0:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009a2:	83 fb 15             	cmp    $0x15,%ebx
+  8009a5:	7f 16                	jg     8009bd <vprintfmt+0x214>
+  8009a7:	48 ba a0 54 80 00 00 	movabs $0x8054a0,%rdx
+  8009ae:	00 00 00 
+  8009b1:	48 63 c3             	movslq %ebx,%rax
+  8009b4:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8009b8:	4d 85 e4             	test   %r12,%r12
+  8009bb:	75 2e                	jne    8009eb <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8009bd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009c1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009c5:	89 d9                	mov    %ebx,%ecx
+  8009c7:	48 ba 61 55 80 00 00 	movabs $0x805561,%rdx
+  8009ce:	00 00 00 
+  8009d1:	48 89 c7             	mov    %rax,%rdi
+  8009d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d9:	49 b8 b5 0c 80 00 00 	movabs $0x800cb5,%r8
+  8009e0:	00 00 00 
+  8009e3:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8009e6:	e9 bb 02 00 00       	jmp    800ca6 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8009eb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009ef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009f3:	4c 89 e1             	mov    %r12,%rcx
+  8009f6:	48 ba 6a 55 80 00 00 	movabs $0x80556a,%rdx
+  8009fd:	00 00 00 
+  800a00:	48 89 c7             	mov    %rax,%rdi
+  800a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a08:	49 b8 b5 0c 80 00 00 	movabs $0x800cb5,%r8
+  800a0f:	00 00 00 
+  800a12:	41 ff d0             	call   *%r8
+        break;
+  800a15:	e9 8c 02 00 00       	jmp    800ca6 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 17                	ja     800a39 <vprintfmt+0x290>
+  800a22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a26:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a29:	89 d2                	mov    %edx,%edx
+  800a2b:	48 01 d0             	add    %rdx,%rax
+  800a2e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a31:	83 c2 08             	add    $0x8,%edx
+  800a34:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a37:	eb 0c                	jmp    800a45 <vprintfmt+0x29c>
+  800a39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a41:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a45:	4c 8b 20             	mov    (%rax),%r12
+  800a48:	4d 85 e4             	test   %r12,%r12
+  800a4b:	75 0a                	jne    800a57 <vprintfmt+0x2ae>
+          p = "(null)";
+  800a4d:	49 bc 6d 55 80 00 00 	movabs $0x80556d,%r12
+  800a54:	00 00 00 
+        if (width > 0 && padc != '-')
+  800a57:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a5b:	7e 78                	jle    800ad5 <vprintfmt+0x32c>
+  800a5d:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a61:	74 72                	je     800ad5 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a63:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a66:	48 98                	cltq
+  800a68:	48 89 c6             	mov    %rax,%rsi
+  800a6b:	4c 89 e7             	mov    %r12,%rdi
+  800a6e:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  800a75:	00 00 00 
+  800a78:	ff d0                	call   *%rax
+  800a7a:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a7d:	eb 17                	jmp    800a96 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800a7f:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a83:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a87:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a8b:	48 89 d6             	mov    %rdx,%rsi
+  800a8e:	89 c7                	mov    %eax,%edi
+  800a90:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a92:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a96:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a9a:	7f e3                	jg     800a7f <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a9c:	eb 37                	jmp    800ad5 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800a9e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800aa2:	74 1e                	je     800ac2 <vprintfmt+0x319>
+  800aa4:	83 fb 1f             	cmp    $0x1f,%ebx
+  800aa7:	7e 05                	jle    800aae <vprintfmt+0x305>
+  800aa9:	83 fb 7e             	cmp    $0x7e,%ebx
+  800aac:	7e 14                	jle    800ac2 <vprintfmt+0x319>
+            putch('?', putdat);
+  800aae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ab2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ab6:	48 89 c6             	mov    %rax,%rsi
+  800ab9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800abe:	ff d2                	call   *%rdx
+  800ac0:	eb 0f                	jmp    800ad1 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800ac2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ac6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aca:	48 89 c6             	mov    %rax,%rsi
+  800acd:	89 df                	mov    %ebx,%edi
+  800acf:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ad1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ad5:	4c 89 e0             	mov    %r12,%rax
+  800ad8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800adc:	0f b6 00             	movzbl (%rax),%eax
+  800adf:	0f be d8             	movsbl %al,%ebx
+  800ae2:	85 db                	test   %ebx,%ebx
+  800ae4:	74 28                	je     800b0e <vprintfmt+0x365>
+  800ae6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800aea:	78 b2                	js     800a9e <vprintfmt+0x2f5>
+  800aec:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800af0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800af4:	79 a8                	jns    800a9e <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800af6:	eb 16                	jmp    800b0e <vprintfmt+0x365>
+          putch(' ', putdat);
+  800af8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800afc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b00:	48 89 c6             	mov    %rax,%rsi
+  800b03:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b08:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800b0a:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b0e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b12:	7f e4                	jg     800af8 <vprintfmt+0x34f>
+        break;
+  800b14:	e9 8d 01 00 00       	jmp    800ca6 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800b19:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b1c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b20:	89 d6                	mov    %edx,%esi
+  800b22:	48 89 c7             	mov    %rax,%rdi
+  800b25:	48 b8 b2 06 80 00 00 	movabs $0x8006b2,%rax
+  800b2c:	00 00 00 
+  800b2f:	ff d0                	call   *%rax
+  800b31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800b35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b39:	48 85 c0             	test   %rax,%rax
+  800b3c:	79 1d                	jns    800b5b <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800b3e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b42:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b46:	48 89 c6             	mov    %rax,%rsi
+  800b49:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b4e:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b54:	48 f7 d8             	neg    %rax
+  800b57:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800b5b:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b62:	e9 d2 00 00 00       	jmp    800c39 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b67:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b6a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b6e:	89 d6                	mov    %edx,%esi
+  800b70:	48 89 c7             	mov    %rax,%rdi
+  800b73:	48 b8 bb 05 80 00 00 	movabs $0x8005bb,%rax
+  800b7a:	00 00 00 
+  800b7d:	ff d0                	call   *%rax
+  800b7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800b83:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b8a:	e9 aa 00 00 00       	jmp    800c39 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800b8f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b92:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b96:	89 d6                	mov    %edx,%esi
+  800b98:	48 89 c7             	mov    %rax,%rdi
+  800b9b:	48 b8 bb 05 80 00 00 	movabs $0x8005bb,%rax
+  800ba2:	00 00 00 
+  800ba5:	ff d0                	call   *%rax
+  800ba7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800bab:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800bb2:	e9 82 00 00 00       	jmp    800c39 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800bb7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bbb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bbf:	48 89 c6             	mov    %rax,%rsi
+  800bc2:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bc7:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800bc9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bcd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bd1:	48 89 c6             	mov    %rax,%rsi
+  800bd4:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bd9:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800bdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	77 17                	ja     800bfa <vprintfmt+0x451>
+  800be3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800be7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bea:	89 d2                	mov    %edx,%edx
+  800bec:	48 01 d0             	add    %rdx,%rax
+  800bef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bf2:	83 c2 08             	add    $0x8,%edx
+  800bf5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bf8:	eb 0c                	jmp    800c06 <vprintfmt+0x45d>
+  800bfa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bfe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c02:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c06:	48 8b 00             	mov    (%rax),%rax
+  800c09:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c0d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800c14:	eb 23                	jmp    800c39 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800c16:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c19:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c1d:	89 d6                	mov    %edx,%esi
+  800c1f:	48 89 c7             	mov    %rax,%rdi
+  800c22:	48 b8 bb 05 80 00 00 	movabs $0x8005bb,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+  800c2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c32:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800c39:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c3e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c41:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c44:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c48:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c4c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c50:	45 89 c1             	mov    %r8d,%r9d
+  800c53:	41 89 f8             	mov    %edi,%r8d
+  800c56:	48 89 c7             	mov    %rax,%rdi
+  800c59:	48 b8 03 05 80 00 00 	movabs $0x800503,%rax
+  800c60:	00 00 00 
+  800c63:	ff d0                	call   *%rax
+        break;
+  800c65:	eb 3f                	jmp    800ca6 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c67:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c6b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c6f:	48 89 c6             	mov    %rax,%rsi
+  800c72:	89 df                	mov    %ebx,%edi
+  800c74:	ff d2                	call   *%rdx
+        break;
+  800c76:	eb 2e                	jmp    800ca6 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800c78:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c7c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c80:	48 89 c6             	mov    %rax,%rsi
+  800c83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c88:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800c8a:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c8f:	eb 05                	jmp    800c96 <vprintfmt+0x4ed>
+  800c91:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c96:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c9a:	48 83 e8 01          	sub    $0x1,%rax
+  800c9e:	0f b6 00             	movzbl (%rax),%eax
+  800ca1:	3c 25                	cmp    $0x25,%al
+  800ca3:	75 ec                	jne    800c91 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800ca5:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ca6:	e9 50 fb ff ff       	jmp    8007fb <vprintfmt+0x52>
+        return;
+  800cab:	90                   	nop
+    }
+  }
+}
+  800cac:	48 83 c4 60          	add    $0x60,%rsp
+  800cb0:	5b                   	pop    %rbx
+  800cb1:	41 5c                	pop    %r12
+  800cb3:	5d                   	pop    %rbp
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800cb5:	55                   	push   %rbp
+  800cb6:	48 89 e5             	mov    %rsp,%rbp
+  800cb9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800cc0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800cc7:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800cce:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800cd5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800cdc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ce3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cea:	84 c0                	test   %al,%al
+  800cec:	74 20                	je     800d0e <printfmt+0x59>
+  800cee:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800cf2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800cf6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800cfa:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800cfe:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d02:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d06:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d0a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800d0e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d15:	00 00 00 
+  800d18:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d1f:	00 00 00 
+  800d22:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d26:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d2d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d34:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800d3b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d42:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d49:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d50:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d57:	48 89 c7             	mov    %rax,%rdi
+  800d5a:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  800d61:	00 00 00 
+  800d64:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d66:	90                   	nop
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+0000000000800d69 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+  800d6d:	48 83 ec 10          	sub    $0x10,%rsp
+  800d71:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800d78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d7c:	8b 40 10             	mov    0x10(%rax),%eax
+  800d7f:	8d 50 01             	lea    0x1(%rax),%edx
+  800d82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d86:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800d89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d8d:	48 8b 10             	mov    (%rax),%rdx
+  800d90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d94:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d98:	48 39 c2             	cmp    %rax,%rdx
+  800d9b:	73 17                	jae    800db4 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800d9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800da1:	48 8b 00             	mov    (%rax),%rax
+  800da4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800da8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800dac:	48 89 0a             	mov    %rcx,(%rdx)
+  800daf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800db2:	88 10                	mov    %dl,(%rax)
+}
+  800db4:	90                   	nop
+  800db5:	c9                   	leave
+  800db6:	c3                   	ret
+
+0000000000800db7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800db7:	55                   	push   %rbp
+  800db8:	48 89 e5             	mov    %rsp,%rbp
+  800dbb:	48 83 ec 40          	sub    $0x40,%rsp
+  800dbf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800dc3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800dc6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800dca:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800dce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dd2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800dd6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800dd9:	48 98                	cltq
+  800ddb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800ddf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800de3:	48 01 d0             	add    %rdx,%rax
+  800de6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800dea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800df1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800df6:	74 06                	je     800dfe <vsnprintf+0x47>
+  800df8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800dfc:	7f 07                	jg     800e05 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800dfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e03:	eb 32                	jmp    800e37 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800e05:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800e09:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800e0d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800e11:	48 89 c6             	mov    %rax,%rsi
+  800e14:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800e1b:	00 00 00 
+  800e1e:	48 89 c7             	mov    %rax,%rdi
+  800e21:	48 b8 a9 07 80 00 00 	movabs $0x8007a9,%rax
+  800e28:	00 00 00 
+  800e2b:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800e2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e31:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800e34:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800e37:	c9                   	leave
+  800e38:	c3                   	ret
+
+0000000000800e39 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800e39:	55                   	push   %rbp
+  800e3a:	48 89 e5             	mov    %rsp,%rbp
+  800e3d:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e44:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e4b:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800e51:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e58:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e5f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e66:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e6d:	84 c0                	test   %al,%al
+  800e6f:	74 20                	je     800e91 <snprintf+0x58>
+  800e71:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e75:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e79:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e7d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e81:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e85:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e89:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e8d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800e91:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e98:	00 00 00 
+  800e9b:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ea2:	00 00 00 
+  800ea5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ea9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800eb0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800eb7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800ebe:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800ec5:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ecc:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ed2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ed9:	48 89 c7             	mov    %rax,%rdi
+  800edc:	48 b8 b7 0d 80 00 00 	movabs $0x800db7,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+  800ee8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800eee:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ef4:	c9                   	leave
+  800ef5:	c3                   	ret
+
+0000000000800ef6 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800ef6:	55                   	push   %rbp
+  800ef7:	48 89 e5             	mov    %rsp,%rbp
+  800efa:	53                   	push   %rbx
+  800efb:	48 83 ec 38          	sub    $0x38,%rsp
+  800eff:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f02:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f06:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800f0a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800f0e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800f12:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1a:	89 d1                	mov    %edx,%ecx
+  800f1c:	0f a2                	cpuid
+  800f1e:	89 de                	mov    %ebx,%esi
+  800f20:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f23:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f26:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f29:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800f2c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f31:	74 09                	je     800f3c <cpuid+0x46>
+}
+  800f33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f37:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f3a:	89 10                	mov    %edx,(%rax)
+
+  800f3c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f41:	74 09                	je     800f4c <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800f43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f47:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f4a:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800f4c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f51:	74 09                	je     800f5c <cpuid+0x66>
+char *
+  800f53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f57:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f5a:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800f5c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f61:	74 09                	je     800f6c <cpuid+0x76>
+  for (; *s; s++)
+  800f63:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f67:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f6a:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f6c:	90                   	nop
+  800f6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f71:	c9                   	leave
+  800f72:	c3                   	ret
+
+0000000000800f73 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	48 83 ec 18          	sub    $0x18,%rsp
+  800f7b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800f7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f81:	89 c1                	mov    %eax,%ecx
+  800f83:	0f 01 d0             	xgetbv
+  800f86:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f89:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800f8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f8f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800f92:	48 c1 e2 20          	shl    $0x20,%rdx
+  800f96:	48 09 d0             	or     %rdx,%rax
+#else
+  800f99:	c9                   	leave
+  800f9a:	c3                   	ret
+
+0000000000800f9b <string_cpu>:
+string_cpu(void) {
+  800f9b:	55                   	push   %rbp
+  800f9c:	48 89 e5             	mov    %rsp,%rbp
+  800f9f:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800fa3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800faa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800fb1:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fb8:	00 00 00 
+  800fbb:	8b 00                	mov    (%rax),%eax
+  800fbd:	85 c0                	test   %eax,%eax
+  800fbf:	78 11                	js     800fd2 <string_cpu+0x37>
+    return string_features;
+  800fc1:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fc8:	00 00 00 
+  800fcb:	8b 00                	mov    (%rax),%eax
+  800fcd:	e9 df 00 00 00       	jmp    8010b1 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800fd2:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800fd6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe6:	48 89 c6             	mov    %rax,%rsi
+  800fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fee:	48 b8 f6 0e 80 00 00 	movabs $0x800ef6,%rax
+  800ff5:	00 00 00 
+  800ff8:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800ffa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800ffd:	83 f8 06             	cmp    $0x6,%eax
+  801000:	76 28                	jbe    80102a <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801002:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801006:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80100c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801011:	48 89 c2             	mov    %rax,%rdx
+  801014:	be 00 00 00 00       	mov    $0x0,%esi
+  801019:	bf 07 00 00 00       	mov    $0x7,%edi
+  80101e:	48 b8 f6 0e 80 00 00 	movabs $0x800ef6,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80102a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80102d:	25 00 02 00 00       	and    $0x200,%eax
+  801032:	85 c0                	test   %eax,%eax
+  801034:	74 04                	je     80103a <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801036:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80103a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80103e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801044:	48 89 c1             	mov    %rax,%rcx
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	be 00 00 00 00       	mov    $0x0,%esi
+  801051:	bf 01 00 00 00       	mov    $0x1,%edi
+  801056:	48 b8 f6 0e 80 00 00 	movabs $0x800ef6,%rax
+  80105d:	00 00 00 
+  801060:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801062:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801065:	83 e0 20             	and    $0x20,%eax
+  801068:	85 c0                	test   %eax,%eax
+  80106a:	74 2a                	je     801096 <string_cpu+0xfb>
+  80106c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80106f:	25 00 00 00 08       	and    $0x8000000,%eax
+  801074:	85 c0                	test   %eax,%eax
+  801076:	74 1e                	je     801096 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801078:	bf 00 00 00 00       	mov    $0x0,%edi
+  80107d:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  801084:	00 00 00 
+  801087:	ff d0                	call   *%rax
+  801089:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80108c:	48 83 f8 06          	cmp    $0x6,%rax
+  801090:	75 04                	jne    801096 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801092:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801096:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  80109d:	00 00 00 
+  8010a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010a3:	89 02                	mov    %eax,(%rdx)
+  8010a5:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8010ac:	00 00 00 
+  8010af:	8b 00                	mov    (%rax),%eax
+}
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+
+00000000008010b3 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+  8010b7:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010bb:	48 83 ec 60          	sub    $0x60,%rsp
+  8010bf:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8010c4:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010c9:	83 e0 1f             	and    $0x1f,%eax
+  8010cc:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8010d0:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010d4:	48 f7 d8             	neg    %rax
+  8010d7:	48 89 c2             	mov    %rax,%rdx
+  8010da:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010df:	48 01 d0             	add    %rdx,%rax
+  8010e2:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8010e7:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8010eb:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8010f1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010f6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010fa:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801100:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801104:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801108:	89 c2                	mov    %eax,%edx
+  80110a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80110e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801113:	89 c1                	mov    %eax,%ecx
+  801115:	d3 e6                	shl    %cl,%esi
+  801117:	89 f0                	mov    %esi,%eax
+  801119:	21 d0                	and    %edx,%eax
+  80111b:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80111f:	eb 21                	jmp    801142 <strlen_avx2+0x8f>
+    p += 32;
+  801121:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801127:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80112c:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801130:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801136:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80113a:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80113e:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801142:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801147:	74 d8                	je     801121 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801149:	31 c0                	xor    %eax,%eax
+  80114b:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801151:	48 63 d0             	movslq %eax,%rdx
+  801154:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801159:	48 01 d0             	add    %rdx,%rax
+  80115c:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801161:	c9                   	leave
+  801162:	c3                   	ret
+
+0000000000801163 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801163:	55                   	push   %rbp
+  801164:	48 89 e5             	mov    %rsp,%rbp
+  801167:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80116b:	48 83 ec 40          	sub    $0x40,%rsp
+  80116f:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801174:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801179:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80117e:	eb 77                	jmp    8011f7 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801180:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801185:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801189:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80118d:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801192:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801196:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80119a:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80119e:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8011a2:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8011a7:	74 3c                	je     8011e5 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8011a9:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8011ad:	f7 d0                	not    %eax
+  8011af:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8011b3:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8011b7:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8011bb:	48 63 d0             	movslq %eax,%rdx
+  8011be:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011c3:	48 01 d0             	add    %rdx,%rax
+  8011c6:	0f b6 00             	movzbl (%rax),%eax
+  8011c9:	0f b6 c0             	movzbl %al,%eax
+  8011cc:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8011d0:	48 63 ca             	movslq %edx,%rcx
+  8011d3:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8011d8:	48 01 ca             	add    %rcx,%rdx
+  8011db:	0f b6 12             	movzbl (%rdx),%edx
+  8011de:	0f b6 d2             	movzbl %dl,%edx
+  8011e1:	29 d0                	sub    %edx,%eax
+  8011e3:	eb 6b                	jmp    801250 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8011e5:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8011eb:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8011f1:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8011f7:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8011fd:	77 81                	ja     801180 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8011ff:	eb 42                	jmp    801243 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801201:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801206:	0f b6 10             	movzbl (%rax),%edx
+  801209:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80120e:	0f b6 00             	movzbl (%rax),%eax
+  801211:	38 c2                	cmp    %al,%dl
+  801213:	74 1c                	je     801231 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801215:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80121a:	0f b6 00             	movzbl (%rax),%eax
+  80121d:	0f b6 c8             	movzbl %al,%ecx
+  801220:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801225:	0f b6 00             	movzbl (%rax),%eax
+  801228:	0f b6 d0             	movzbl %al,%edx
+  80122b:	89 c8                	mov    %ecx,%eax
+  80122d:	29 d0                	sub    %edx,%eax
+  80122f:	eb 1f                	jmp    801250 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801231:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801237:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80123d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801243:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801249:	75 b6                	jne    801201 <memcmp_avx2+0x9e>
+  return 0;
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801250:	c9                   	leave
+  801251:	c3                   	ret
+
+0000000000801252 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801252:	55                   	push   %rbp
+  801253:	48 89 e5             	mov    %rsp,%rbp
+  801256:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80125a:	48 83 ec 60          	sub    $0x60,%rsp
+  80125e:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801263:	89 f0                	mov    %esi,%eax
+  801265:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80126a:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80126e:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801273:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801277:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80127c:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801282:	eb 47                	jmp    8012cb <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801284:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801289:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80128d:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801291:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801297:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80129b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80129f:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8012a3:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8012a8:	74 15                	je     8012bf <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8012aa:	31 c0                	xor    %eax,%eax
+  8012ac:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8012b2:	48 63 d0             	movslq %eax,%rdx
+  8012b5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012ba:	48 01 d0             	add    %rdx,%rax
+  8012bd:	eb 3d                	jmp    8012fc <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8012bf:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8012c5:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8012cb:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8012d1:	77 b1                	ja     801284 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8012d3:	eb 0c                	jmp    8012e1 <memfind_avx2+0x8f>
+  8012d5:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8012db:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8012e1:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8012e7:	74 0e                	je     8012f7 <memfind_avx2+0xa5>
+  8012e9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012ee:	0f b6 00             	movzbl (%rax),%eax
+  8012f1:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8012f5:	75 de                	jne    8012d5 <memfind_avx2+0x83>
+  return s;
+  8012f7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+
+00000000008012fe <strlen>:
+strlen(const char *s) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+  801302:	48 83 ec 40          	sub    $0x40,%rsp
+  801306:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80130a:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80130e:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801312:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  801319:	00 00 00 
+  80131c:	ff d0                	call   *%rax
+  80131e:	83 e0 02             	and    $0x2,%eax
+  801321:	85 c0                	test   %eax,%eax
+  801323:	74 18                	je     80133d <strlen+0x3f>
+    return strlen_avx2(s);
+  801325:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801329:	48 89 c7             	mov    %rax,%rdi
+  80132c:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  801333:	00 00 00 
+  801336:	ff d0                	call   *%rax
+  801338:	e9 82 00 00 00       	jmp    8013bf <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80133d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801341:	83 e0 0f             	and    $0xf,%eax
+  801344:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801347:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80134a:	48 f7 d8             	neg    %rax
+  80134d:	48 89 c2             	mov    %rax,%rdx
+  801350:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801354:	48 01 d0             	add    %rdx,%rax
+  801357:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80135b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801363:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801368:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80136c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801370:	89 c2                	mov    %eax,%edx
+  801372:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801375:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80137a:	89 c1                	mov    %eax,%ecx
+  80137c:	d3 e6                	shl    %cl,%esi
+  80137e:	89 f0                	mov    %esi,%eax
+  801380:	21 d0                	and    %edx,%eax
+  801382:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801385:	eb 1d                	jmp    8013a4 <strlen+0xa6>
+    p += 16;
+  801387:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80138c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801390:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801394:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801399:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80139d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8013a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8013a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013a8:	74 dd                	je     801387 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8013aa:	31 c0                	xor    %eax,%eax
+  8013ac:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8013b1:	48 63 d0             	movslq %eax,%rdx
+  8013b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b8:	48 01 d0             	add    %rdx,%rax
+  8013bb:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+
+00000000008013c1 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8013c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013cd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013d1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013d8:	eb 0e                	jmp    8013e8 <strnlen+0x27>
+    n++;
+  8013da:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013de:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013e3:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013e8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013ed:	74 0b                	je     8013fa <strnlen+0x39>
+  8013ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f3:	0f b6 00             	movzbl (%rax),%eax
+  8013f6:	84 c0                	test   %al,%al
+  8013f8:	75 e0                	jne    8013da <strnlen+0x19>
+  return n;
+  8013fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+
+00000000008013ff <strcpy>:
+strcpy(char *dst, const char *src) {
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	48 83 ec 20          	sub    $0x20,%rsp
+  801407:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80140b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80140f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801413:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801417:	90                   	nop
+  801418:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80141c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801420:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801424:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801428:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80142c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801430:	0f b6 12             	movzbl (%rdx),%edx
+  801433:	88 10                	mov    %dl,(%rax)
+  801435:	0f b6 00             	movzbl (%rax),%eax
+  801438:	84 c0                	test   %al,%al
+  80143a:	75 dc                	jne    801418 <strcpy+0x19>
+  return ret;
+  80143c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+
+0000000000801442 <strcat>:
+strcat(char *dst, const char *src) {
+  801442:	55                   	push   %rbp
+  801443:	48 89 e5             	mov    %rsp,%rbp
+  801446:	48 83 ec 20          	sub    $0x20,%rsp
+  80144a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80144e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801452:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801456:	48 89 c7             	mov    %rax,%rdi
+  801459:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801460:	00 00 00 
+  801463:	ff d0                	call   *%rax
+  801465:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801468:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80146b:	48 63 d0             	movslq %eax,%rdx
+  80146e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801472:	48 01 c2             	add    %rax,%rdx
+  801475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801479:	48 89 c6             	mov    %rax,%rsi
+  80147c:	48 89 d7             	mov    %rdx,%rdi
+  80147f:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  801486:	00 00 00 
+  801489:	ff d0                	call   *%rax
+  return dst;
+  80148b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+
+0000000000801491 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801491:	55                   	push   %rbp
+  801492:	48 89 e5             	mov    %rsp,%rbp
+  801495:	48 83 ec 28          	sub    $0x28,%rsp
+  801499:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80149d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8014a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8014ad:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014b4:	00 
+  8014b5:	eb 2a                	jmp    8014e1 <strncpy+0x50>
+    *dst++ = *src;
+  8014b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014c7:	0f b6 12             	movzbl (%rdx),%edx
+  8014ca:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8014cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014d0:	0f b6 00             	movzbl (%rax),%eax
+  8014d3:	84 c0                	test   %al,%al
+  8014d5:	74 05                	je     8014dc <strncpy+0x4b>
+      src++;
+  8014d7:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8014dc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e5:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014e9:	72 cc                	jb     8014b7 <strncpy+0x26>
+  return ret;
+  8014eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014ef:	c9                   	leave
+  8014f0:	c3                   	ret
+
+00000000008014f1 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8014f1:	55                   	push   %rbp
+  8014f2:	48 89 e5             	mov    %rsp,%rbp
+  8014f5:	48 83 ec 28          	sub    $0x28,%rsp
+  8014f9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801501:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801509:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80150d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801512:	74 3d                	je     801551 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801514:	eb 1d                	jmp    801533 <strlcpy+0x42>
+      *dst++ = *src++;
+  801516:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80151a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80151e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801522:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801526:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80152a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80152e:	0f b6 12             	movzbl (%rdx),%edx
+  801531:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801533:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801538:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80153d:	74 0b                	je     80154a <strlcpy+0x59>
+  80153f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801543:	0f b6 00             	movzbl (%rax),%eax
+  801546:	84 c0                	test   %al,%al
+  801548:	75 cc                	jne    801516 <strlcpy+0x25>
+    *dst = '\0';
+  80154a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80154e:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801551:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801555:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801559:	c9                   	leave
+  80155a:	c3                   	ret
+
+000000000080155b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80155b:	55                   	push   %rbp
+  80155c:	48 89 e5             	mov    %rsp,%rbp
+  80155f:	48 83 ec 30          	sub    $0x30,%rsp
+  801563:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801567:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80156b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80156f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801573:	48 89 c7             	mov    %rax,%rdi
+  801576:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  80157d:	00 00 00 
+  801580:	ff d0                	call   *%rax
+  801582:	48 98                	cltq
+  801584:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801588:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80158c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801590:	48 89 d6             	mov    %rdx,%rsi
+  801593:	48 89 c7             	mov    %rax,%rdi
+  801596:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  80159d:	00 00 00 
+  8015a0:	ff d0                	call   *%rax
+  8015a2:	48 98                	cltq
+  8015a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8015a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ac:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015b0:	75 10                	jne    8015c2 <strlcat+0x67>
+    return maxlen + srclen;
+  8015b2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ba:	48 01 d0             	add    %rdx,%rax
+  8015bd:	e9 86 00 00 00       	jmp    801648 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8015c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015c6:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8015ca:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015ce:	73 2b                	jae    8015fb <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8015d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015d8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e0:	48 01 c1             	add    %rax,%rcx
+  8015e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015e7:	48 89 c6             	mov    %rax,%rsi
+  8015ea:	48 89 cf             	mov    %rcx,%rdi
+  8015ed:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8015f4:	00 00 00 
+  8015f7:	ff d0                	call   *%rax
+  8015f9:	eb 42                	jmp    80163d <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8015fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015ff:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801603:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801607:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160b:	48 01 c1             	add    %rax,%rcx
+  80160e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801612:	48 89 c6             	mov    %rax,%rsi
+  801615:	48 89 cf             	mov    %rcx,%rdi
+  801618:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  80161f:	00 00 00 
+  801622:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801624:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801628:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80162c:	48 01 d0             	add    %rdx,%rax
+  80162f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801637:	48 01 d0             	add    %rdx,%rax
+  80163a:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80163d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801645:	48 01 d0             	add    %rdx,%rax
+}
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+
+000000000080164a <strcmp>:
+strcmp(const char *p, const char *q) {
+  80164a:	55                   	push   %rbp
+  80164b:	48 89 e5             	mov    %rsp,%rbp
+  80164e:	48 83 ec 10          	sub    $0x10,%rsp
+  801652:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801656:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80165a:	eb 0a                	jmp    801666 <strcmp+0x1c>
+    p++, q++;
+  80165c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801661:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166a:	0f b6 00             	movzbl (%rax),%eax
+  80166d:	84 c0                	test   %al,%al
+  80166f:	74 12                	je     801683 <strcmp+0x39>
+  801671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801675:	0f b6 10             	movzbl (%rax),%edx
+  801678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167c:	0f b6 00             	movzbl (%rax),%eax
+  80167f:	38 c2                	cmp    %al,%dl
+  801681:	74 d9                	je     80165c <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801683:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801687:	0f b6 00             	movzbl (%rax),%eax
+  80168a:	0f b6 d0             	movzbl %al,%edx
+  80168d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801691:	0f b6 00             	movzbl (%rax),%eax
+  801694:	0f b6 c0             	movzbl %al,%eax
+  801697:	29 c2                	sub    %eax,%edx
+  801699:	89 d0                	mov    %edx,%eax
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+
+000000000080169d <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016b1:	eb 0f                	jmp    8016c2 <strncmp+0x25>
+    n--, p++, q++;
+  8016b3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8016b8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016bd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016c2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016c7:	74 1d                	je     8016e6 <strncmp+0x49>
+  8016c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016cd:	0f b6 00             	movzbl (%rax),%eax
+  8016d0:	84 c0                	test   %al,%al
+  8016d2:	74 12                	je     8016e6 <strncmp+0x49>
+  8016d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d8:	0f b6 10             	movzbl (%rax),%edx
+  8016db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016df:	0f b6 00             	movzbl (%rax),%eax
+  8016e2:	38 c2                	cmp    %al,%dl
+  8016e4:	74 cd                	je     8016b3 <strncmp+0x16>
+  if (n == 0)
+  8016e6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016eb:	75 07                	jne    8016f4 <strncmp+0x57>
+    return 0;
+  8016ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f2:	eb 16                	jmp    80170a <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f8:	0f b6 00             	movzbl (%rax),%eax
+  8016fb:	0f b6 d0             	movzbl %al,%edx
+  8016fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801702:	0f b6 00             	movzbl (%rax),%eax
+  801705:	0f b6 c0             	movzbl %al,%eax
+  801708:	29 c2                	sub    %eax,%edx
+}
+  80170a:	89 d0                	mov    %edx,%eax
+  80170c:	c9                   	leave
+  80170d:	c3                   	ret
+
+000000000080170e <strchr>:
+strchr(const char *s, char c) {
+  80170e:	55                   	push   %rbp
+  80170f:	48 89 e5             	mov    %rsp,%rbp
+  801712:	48 83 ec 60          	sub    $0x60,%rsp
+  801716:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80171a:	89 f0                	mov    %esi,%eax
+  80171c:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80171f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801723:	83 e0 0f             	and    $0xf,%eax
+  801726:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801729:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80172c:	48 f7 d8             	neg    %rax
+  80172f:	48 89 c2             	mov    %rax,%rdx
+  801732:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801736:	48 01 d0             	add    %rdx,%rax
+  801739:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80173d:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801741:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801745:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801749:	66 0f 6e c0          	movd   %eax,%xmm0
+  80174d:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801751:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801755:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80175a:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80175e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801762:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801766:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80176a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80176f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801774:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801778:	89 c2                	mov    %eax,%edx
+  80177a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80177f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801784:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801788:	09 c2                	or     %eax,%edx
+  80178a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80178d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801792:	89 c1                	mov    %eax,%ecx
+  801794:	d3 e6                	shl    %cl,%esi
+  801796:	89 f0                	mov    %esi,%eax
+  801798:	21 d0                	and    %edx,%eax
+  80179a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80179d:	eb 34                	jmp    8017d3 <strchr+0xc5>
+    p += 16;
+  80179f:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8017a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a8:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8017ac:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8017b0:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017b5:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8017ba:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017be:	89 c2                	mov    %eax,%edx
+  8017c0:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017c5:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8017ca:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017ce:	09 d0                	or     %edx,%eax
+  8017d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017d7:	74 c6                	je     80179f <strchr+0x91>
+  p += __builtin_ctz(m);
+  8017d9:	31 c0                	xor    %eax,%eax
+  8017db:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8017e0:	48 98                	cltq
+  8017e2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8017e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ea:	0f b6 00             	movzbl (%rax),%eax
+  8017ed:	84 c0                	test   %al,%al
+  8017ef:	74 06                	je     8017f7 <strchr+0xe9>
+  8017f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f5:	eb 05                	jmp    8017fc <strchr+0xee>
+  8017f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017fc:	c9                   	leave
+  8017fd:	c3                   	ret
+
+00000000008017fe <strfind>:
+strfind(const char *s, char c) {
+  8017fe:	55                   	push   %rbp
+  8017ff:	48 89 e5             	mov    %rsp,%rbp
+  801802:	48 83 ec 10          	sub    $0x10,%rsp
+  801806:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80180a:	89 f0                	mov    %esi,%eax
+  80180c:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80180f:	eb 11                	jmp    801822 <strfind+0x24>
+    if (*s == c)
+  801811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801815:	0f b6 00             	movzbl (%rax),%eax
+  801818:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80181b:	74 12                	je     80182f <strfind+0x31>
+  for (; *s; s++)
+  80181d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801822:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801826:	0f b6 00             	movzbl (%rax),%eax
+  801829:	84 c0                	test   %al,%al
+  80182b:	75 e4                	jne    801811 <strfind+0x13>
+  80182d:	eb 01                	jmp    801830 <strfind+0x32>
+      break;
+  80182f:	90                   	nop
+  return (char *)s;
+  801830:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801834:	c9                   	leave
+  801835:	c3                   	ret
+
+0000000000801836 <memset>:
+memset(void *v, int c, size_t n) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	48 83 ec 38          	sub    $0x38,%rsp
+  80183e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801842:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801845:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801849:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801851:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801856:	76 41                	jbe    801899 <memset+0x63>
+  801858:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+  801864:	83 e0 01             	and    $0x1,%eax
+  801867:	85 c0                	test   %eax,%eax
+  801869:	74 2e                	je     801899 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80186b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80186e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801872:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801876:	48 89 ce             	mov    %rcx,%rsi
+  801879:	48 89 f7             	mov    %rsi,%rdi
+  80187c:	48 89 d1             	mov    %rdx,%rcx
+  80187f:	fc                   	cld
+  801880:	f3 aa                	rep stos %al,%es:(%rdi)
+  801882:	48 89 ca             	mov    %rcx,%rdx
+  801885:	48 89 fe             	mov    %rdi,%rsi
+  801888:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80188c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801890:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801894:	e9 a7 00 00 00       	jmp    801940 <memset+0x10a>
+  if (n >= 8) {
+  801899:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80189e:	0f 86 87 00 00 00    	jbe    80192b <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8018a4:	eb 16                	jmp    8018bc <memset+0x86>
+      *p++ = c;
+  8018a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018ae:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018b2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018b5:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8018b7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c0:	83 e0 07             	and    $0x7,%eax
+  8018c3:	48 85 c0             	test   %rax,%rax
+  8018c6:	75 de                	jne    8018a6 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8018c8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8018cb:	0f b6 c0             	movzbl %al,%eax
+  8018ce:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8018d5:	01 01 01 
+  8018d8:	48 0f af c2          	imul   %rdx,%rax
+  8018dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8018e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e4:	48 c1 e8 03          	shr    $0x3,%rax
+  8018e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8018ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018f8:	48 89 ce             	mov    %rcx,%rsi
+  8018fb:	48 89 f7             	mov    %rsi,%rdi
+  8018fe:	48 89 d1             	mov    %rdx,%rcx
+  801901:	fc                   	cld
+  801902:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801905:	48 89 ca             	mov    %rcx,%rdx
+  801908:	48 89 fe             	mov    %rdi,%rsi
+  80190b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80190f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801913:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801918:	eb 11                	jmp    80192b <memset+0xf5>
+    *p++ = c;
+  80191a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80191e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801922:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801926:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801929:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80192b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801933:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801937:	48 85 c0             	test   %rax,%rax
+  80193a:	75 de                	jne    80191a <memset+0xe4>
+  return v;
+  80193c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801940:	c9                   	leave
+  801941:	c3                   	ret
+
+0000000000801942 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801942:	55                   	push   %rbp
+  801943:	48 89 e5             	mov    %rsp,%rbp
+  801946:	48 83 ec 38          	sub    $0x38,%rsp
+  80194a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80194e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801952:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801956:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80195a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801966:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80196a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80196e:	0f 83 da 00 00 00    	jae    801a4e <memmove+0x10c>
+  801974:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801978:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80197c:	48 01 d0             	add    %rdx,%rax
+  80197f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801983:	0f 83 c5 00 00 00    	jae    801a4e <memmove+0x10c>
+    s += n;
+  801989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801991:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801995:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801999:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80199e:	0f 86 94 00 00 00    	jbe    801a38 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8019a4:	eb 1c                	jmp    8019c2 <memmove+0x80>
+        *--d = *--s;
+  8019a6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019ab:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b4:	0f b6 10             	movzbl (%rax),%edx
+  8019b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019bb:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8019bd:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8019c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c6:	83 e0 07             	and    $0x7,%eax
+  8019c9:	48 85 c0             	test   %rax,%rax
+  8019cc:	75 d8                	jne    8019a6 <memmove+0x64>
+      nq = n / 8;
+  8019ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019d2:	48 c1 e8 03          	shr    $0x3,%rax
+  8019d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019da:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8019df:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8019e4:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8019e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019f5:	48 89 cf             	mov    %rcx,%rdi
+  8019f8:	48 89 d6             	mov    %rdx,%rsi
+  8019fb:	48 89 c1             	mov    %rax,%rcx
+  8019fe:	fd                   	std
+  8019ff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a02:	fc                   	cld
+  801a03:	48 89 c8             	mov    %rcx,%rax
+  801a06:	48 89 f2             	mov    %rsi,%rdx
+  801a09:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a0d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801a15:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801a1a:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801a1f:	eb 17                	jmp    801a38 <memmove+0xf6>
+      *--d = *--s;
+  801a21:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801a26:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801a2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2f:	0f b6 10             	movzbl (%rax),%edx
+  801a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a36:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a3c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a40:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a44:	48 85 c0             	test   %rax,%rax
+  801a47:	75 d8                	jne    801a21 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801a49:	e9 f4 00 00 00       	jmp    801b42 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a4e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a53:	76 46                	jbe    801a9b <memmove+0x159>
+  801a55:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+  801a61:	83 e0 01             	and    $0x1,%eax
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	74 33                	je     801a9b <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a68:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a6c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a74:	48 89 cf             	mov    %rcx,%rdi
+  801a77:	48 89 d6             	mov    %rdx,%rsi
+  801a7a:	48 89 c1             	mov    %rax,%rcx
+  801a7d:	fc                   	cld
+  801a7e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a80:	48 89 c8             	mov    %rcx,%rax
+  801a83:	48 89 f2             	mov    %rsi,%rdx
+  801a86:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a8a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801a92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a96:	e9 ab 00 00 00       	jmp    801b46 <memmove+0x204>
+    if (n >= 8) {
+  801a9b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801aa0:	0f 86 8b 00 00 00    	jbe    801b31 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801aa6:	eb 22                	jmp    801aca <memmove+0x188>
+        *d++ = *s++;
+  801aa8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aac:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ab0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ab4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801abc:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ac0:	0f b6 12             	movzbl (%rdx),%edx
+  801ac3:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801ac5:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801aca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ace:	83 e0 07             	and    $0x7,%eax
+  801ad1:	48 85 c0             	test   %rax,%rax
+  801ad4:	75 d2                	jne    801aa8 <memmove+0x166>
+      nq = n / 8;
+  801ad6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ada:	48 c1 e8 03          	shr    $0x3,%rax
+  801ade:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801ae2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ae6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aee:	48 89 cf             	mov    %rcx,%rdi
+  801af1:	48 89 d6             	mov    %rdx,%rsi
+  801af4:	48 89 c1             	mov    %rax,%rcx
+  801af7:	fc                   	cld
+  801af8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801afb:	48 89 c8             	mov    %rcx,%rax
+  801afe:	48 89 f2             	mov    %rsi,%rdx
+  801b01:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b05:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b09:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b0d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801b12:	eb 1d                	jmp    801b31 <memmove+0x1ef>
+      *d++ = *s++;
+  801b14:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b18:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801b20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b24:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b28:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b2c:	0f b6 12             	movzbl (%rdx),%edx
+  801b2f:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b35:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b39:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b3d:	48 85 c0             	test   %rax,%rax
+  801b40:	75 d2                	jne    801b14 <memmove+0x1d2>
+  return dst;
+  801b42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b46:	c9                   	leave
+  801b47:	c3                   	ret
+
+0000000000801b48 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801b48:	55                   	push   %rbp
+  801b49:	48 89 e5             	mov    %rsp,%rbp
+  801b4c:	48 83 ec 18          	sub    $0x18,%rsp
+  801b50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b54:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b58:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801b5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b60:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b68:	48 89 ce             	mov    %rcx,%rsi
+  801b6b:	48 89 c7             	mov    %rax,%rdi
+  801b6e:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  801b75:	00 00 00 
+  801b78:	ff d0                	call   *%rax
+}
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+0000000000801b7c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+  801b80:	48 83 ec 40          	sub    $0x40,%rsp
+  801b84:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b88:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b8c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801b90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801b98:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ba0:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801ba5:	0f 86 a7 00 00 00    	jbe    801c52 <memcmp+0xd6>
+  801bab:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  801bb2:	00 00 00 
+  801bb5:	ff d0                	call   *%rax
+  801bb7:	83 e0 02             	and    $0x2,%eax
+  801bba:	85 c0                	test   %eax,%eax
+  801bbc:	0f 84 90 00 00 00    	je     801c52 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801bc2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bc6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bce:	48 89 ce             	mov    %rcx,%rsi
+  801bd1:	48 89 c7             	mov    %rax,%rdi
+  801bd4:	48 b8 63 11 80 00 00 	movabs $0x801163,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	e9 c2 00 00 00       	jmp    801ca7 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801be5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801be9:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bed:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf5:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bf9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bfd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801c01:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801c04:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801c0b:	74 36                	je     801c43 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c10:	f7 d0                	not    %eax
+  801c12:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801c16:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801c19:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801c1c:	48 63 d0             	movslq %eax,%rdx
+  801c1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c23:	48 01 d0             	add    %rdx,%rax
+  801c26:	0f b6 00             	movzbl (%rax),%eax
+  801c29:	0f b6 c0             	movzbl %al,%eax
+  801c2c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801c2f:	48 63 ca             	movslq %edx,%rcx
+  801c32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c36:	48 01 ca             	add    %rcx,%rdx
+  801c39:	0f b6 12             	movzbl (%rdx),%edx
+  801c3c:	0f b6 d2             	movzbl %dl,%edx
+  801c3f:	29 d0                	sub    %edx,%eax
+  801c41:	eb 64                	jmp    801ca7 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801c43:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801c48:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801c4d:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801c52:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801c57:	77 8c                	ja     801be5 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801c59:	eb 36                	jmp    801c91 <memcmp+0x115>
+    if (*s1 != *s2)
+  801c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5f:	0f b6 10             	movzbl (%rax),%edx
+  801c62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c66:	0f b6 00             	movzbl (%rax),%eax
+  801c69:	38 c2                	cmp    %al,%dl
+  801c6b:	74 1a                	je     801c87 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c71:	0f b6 00             	movzbl (%rax),%eax
+  801c74:	0f b6 c8             	movzbl %al,%ecx
+  801c77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c7b:	0f b6 00             	movzbl (%rax),%eax
+  801c7e:	0f b6 d0             	movzbl %al,%edx
+  801c81:	89 c8                	mov    %ecx,%eax
+  801c83:	29 d0                	sub    %edx,%eax
+  801c85:	eb 20                	jmp    801ca7 <memcmp+0x12b>
+    s1++, s2++;
+  801c87:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c8c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801c91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c95:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c99:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c9d:	48 85 c0             	test   %rax,%rax
+  801ca0:	75 b9                	jne    801c5b <memcmp+0xdf>
+  }
+
+  return 0;
+  801ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca7:	c9                   	leave
+  801ca8:	c3                   	ret
+
+0000000000801ca9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	48 83 ec 50          	sub    $0x50,%rsp
+  801cb1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801cb5:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801cb8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801cbc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801cc0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cc4:	48 01 d0             	add    %rdx,%rax
+  801cc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801ccb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801cce:	66 0f 6e c0          	movd   %eax,%xmm0
+  801cd2:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801cd6:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801cda:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801cdf:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ce3:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ce8:	76 73                	jbe    801d5d <memfind+0xb4>
+  801cea:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+  801cf6:	83 e0 02             	and    $0x2,%eax
+  801cf9:	85 c0                	test   %eax,%eax
+  801cfb:	74 60                	je     801d5d <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801cfd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801d00:	0f b6 c8             	movzbl %al,%ecx
+  801d03:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801d07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d0b:	89 ce                	mov    %ecx,%esi
+  801d0d:	48 89 c7             	mov    %rax,%rdi
+  801d10:	48 b8 52 12 80 00 00 	movabs $0x801252,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+  801d1c:	eb 6c                	jmp    801d8a <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801d1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d22:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d26:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d2a:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801d2f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d33:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d37:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d3a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d3e:	74 13                	je     801d53 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801d40:	31 c0                	xor    %eax,%eax
+  801d42:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801d47:	48 63 d0             	movslq %eax,%rdx
+  801d4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4e:	48 01 d0             	add    %rdx,%rax
+  801d51:	eb 37                	jmp    801d8a <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801d53:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801d58:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801d5d:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d62:	77 ba                	ja     801d1e <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d64:	eb 13                	jmp    801d79 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d6a:	0f b6 00             	movzbl (%rax),%eax
+  801d6d:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d70:	38 d0                	cmp    %dl,%al
+  801d72:	74 11                	je     801d85 <memfind+0xdc>
+  for (; s < ends; s++)
+  801d74:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801d79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d7d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d81:	72 e3                	jb     801d66 <memfind+0xbd>
+  801d83:	eb 01                	jmp    801d86 <memfind+0xdd>
+      break;
+  801d85:	90                   	nop
+  return (void *)s;
+  801d86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+0000000000801d8c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d8c:	55                   	push   %rbp
+  801d8d:	48 89 e5             	mov    %rsp,%rbp
+  801d90:	48 83 ec 38          	sub    $0x38,%rsp
+  801d94:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d98:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d9c:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801d9f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801da6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801dad:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801dae:	eb 05                	jmp    801db5 <strtol+0x29>
+    s++;
+  801db0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801db5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db9:	0f b6 00             	movzbl (%rax),%eax
+  801dbc:	3c 20                	cmp    $0x20,%al
+  801dbe:	74 f0                	je     801db0 <strtol+0x24>
+  801dc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc4:	0f b6 00             	movzbl (%rax),%eax
+  801dc7:	3c 09                	cmp    $0x9,%al
+  801dc9:	74 e5                	je     801db0 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801dcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dcf:	0f b6 00             	movzbl (%rax),%eax
+  801dd2:	3c 2b                	cmp    $0x2b,%al
+  801dd4:	75 07                	jne    801ddd <strtol+0x51>
+    s++;
+  801dd6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ddb:	eb 17                	jmp    801df4 <strtol+0x68>
+  else if (*s == '-')
+  801ddd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de1:	0f b6 00             	movzbl (%rax),%eax
+  801de4:	3c 2d                	cmp    $0x2d,%al
+  801de6:	75 0c                	jne    801df4 <strtol+0x68>
+    s++, neg = 1;
+  801de8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ded:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801df4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801df8:	74 06                	je     801e00 <strtol+0x74>
+  801dfa:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801dfe:	75 28                	jne    801e28 <strtol+0x9c>
+  801e00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e04:	0f b6 00             	movzbl (%rax),%eax
+  801e07:	3c 30                	cmp    $0x30,%al
+  801e09:	75 1d                	jne    801e28 <strtol+0x9c>
+  801e0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e0f:	48 83 c0 01          	add    $0x1,%rax
+  801e13:	0f b6 00             	movzbl (%rax),%eax
+  801e16:	3c 78                	cmp    $0x78,%al
+  801e18:	75 0e                	jne    801e28 <strtol+0x9c>
+    s += 2, base = 16;
+  801e1a:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801e1f:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801e26:	eb 2c                	jmp    801e54 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801e28:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e2c:	75 19                	jne    801e47 <strtol+0xbb>
+  801e2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e32:	0f b6 00             	movzbl (%rax),%eax
+  801e35:	3c 30                	cmp    $0x30,%al
+  801e37:	75 0e                	jne    801e47 <strtol+0xbb>
+    s++, base = 8;
+  801e39:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e3e:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801e45:	eb 0d                	jmp    801e54 <strtol+0xc8>
+  else if (base == 0)
+  801e47:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e4b:	75 07                	jne    801e54 <strtol+0xc8>
+    base = 10;
+  801e4d:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801e54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e58:	0f b6 00             	movzbl (%rax),%eax
+  801e5b:	3c 2f                	cmp    $0x2f,%al
+  801e5d:	7e 1d                	jle    801e7c <strtol+0xf0>
+  801e5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e63:	0f b6 00             	movzbl (%rax),%eax
+  801e66:	3c 39                	cmp    $0x39,%al
+  801e68:	7f 12                	jg     801e7c <strtol+0xf0>
+      dig = *s - '0';
+  801e6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6e:	0f b6 00             	movzbl (%rax),%eax
+  801e71:	0f be c0             	movsbl %al,%eax
+  801e74:	83 e8 30             	sub    $0x30,%eax
+  801e77:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e7a:	eb 4e                	jmp    801eca <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801e7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e80:	0f b6 00             	movzbl (%rax),%eax
+  801e83:	3c 60                	cmp    $0x60,%al
+  801e85:	7e 1d                	jle    801ea4 <strtol+0x118>
+  801e87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e8b:	0f b6 00             	movzbl (%rax),%eax
+  801e8e:	3c 7a                	cmp    $0x7a,%al
+  801e90:	7f 12                	jg     801ea4 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801e92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e96:	0f b6 00             	movzbl (%rax),%eax
+  801e99:	0f be c0             	movsbl %al,%eax
+  801e9c:	83 e8 57             	sub    $0x57,%eax
+  801e9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ea2:	eb 26                	jmp    801eca <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801ea4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea8:	0f b6 00             	movzbl (%rax),%eax
+  801eab:	3c 40                	cmp    $0x40,%al
+  801ead:	7e 47                	jle    801ef6 <strtol+0x16a>
+  801eaf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eb3:	0f b6 00             	movzbl (%rax),%eax
+  801eb6:	3c 5a                	cmp    $0x5a,%al
+  801eb8:	7f 3c                	jg     801ef6 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801eba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ebe:	0f b6 00             	movzbl (%rax),%eax
+  801ec1:	0f be c0             	movsbl %al,%eax
+  801ec4:	83 e8 37             	sub    $0x37,%eax
+  801ec7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801eca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ecd:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ed0:	7d 23                	jge    801ef5 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ed2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ed7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801eda:	48 98                	cltq
+  801edc:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801ee1:	48 89 c2             	mov    %rax,%rdx
+  801ee4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ee7:	48 98                	cltq
+  801ee9:	48 01 d0             	add    %rdx,%rax
+  801eec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801ef0:	e9 5f ff ff ff       	jmp    801e54 <strtol+0xc8>
+      break;
+  801ef5:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801ef6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801efb:	74 0b                	je     801f08 <strtol+0x17c>
+    *endptr = (char *)s;
+  801efd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f01:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801f05:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801f08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f0c:	74 09                	je     801f17 <strtol+0x18b>
+  801f0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f12:	48 f7 d8             	neg    %rax
+  801f15:	eb 04                	jmp    801f1b <strtol+0x18f>
+  801f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801f1b:	c9                   	leave
+  801f1c:	c3                   	ret
+
+0000000000801f1d <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801f1d:	55                   	push   %rbp
+  801f1e:	48 89 e5             	mov    %rsp,%rbp
+  801f21:	53                   	push   %rbx
+  801f22:	48 83 ec 48          	sub    $0x48,%rsp
+  801f26:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f2a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f2e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f32:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801f36:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801f3a:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f42:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f46:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f4a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801f4e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f52:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f56:	4c 89 c3             	mov    %r8,%rbx
+  801f59:	cd 30                	int    $0x30
+  801f5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f5f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f64:	74 46                	je     801fac <syscall+0x8f>
+  801f66:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f6b:	7e 3f                	jle    801fac <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f6d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f75:	49 89 d0             	mov    %rdx,%r8
+  801f78:	48 89 c1             	mov    %rax,%rcx
+  801f7b:	48 b8 28 58 80 00 00 	movabs $0x805828,%rax
+  801f82:	00 00 00 
+  801f85:	48 89 c2             	mov    %rax,%rdx
+  801f88:	be 22 00 00 00       	mov    $0x22,%esi
+  801f8d:	48 b8 47 58 80 00 00 	movabs $0x805847,%rax
+  801f94:	00 00 00 
+  801f97:	48 89 c7             	mov    %rax,%rdi
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9f:	49 b9 30 02 80 00 00 	movabs $0x800230,%r9
+  801fa6:	00 00 00 
+  801fa9:	41 ff d1             	call   *%r9
+
+  return ret;
+  801fac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801fb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+0000000000801fb6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+  801fba:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fc2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801fc6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fce:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd2:	6a 00                	push   $0x0
+  801fd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe0:	48 89 d1             	mov    %rdx,%rcx
+  801fe3:	48 89 c2             	mov    %rax,%rdx
+  801fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  801feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ff0:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+  801ffc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802000:	90                   	nop
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+
+0000000000802003 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802003:	55                   	push   %rbp
+  802004:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802007:	48 83 ec 08          	sub    $0x8,%rsp
+  80200b:	6a 00                	push   $0x0
+  80200d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802013:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80201e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802023:	be 00 00 00 00       	mov    $0x0,%esi
+  802028:	bf 01 00 00 00       	mov    $0x1,%edi
+  80202d:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+000000000080203f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80203f:	55                   	push   %rbp
+  802040:	48 89 e5             	mov    %rsp,%rbp
+  802043:	48 83 ec 10          	sub    $0x10,%rsp
+  802047:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80204a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80204d:	48 98                	cltq
+  80204f:	48 83 ec 08          	sub    $0x8,%rsp
+  802053:	6a 00                	push   $0x0
+  802055:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80205b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802066:	48 89 c2             	mov    %rax,%rdx
+  802069:	be 01 00 00 00       	mov    $0x1,%esi
+  80206e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802073:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80207a:	00 00 00 
+  80207d:	ff d0                	call   *%rax
+  80207f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+
+0000000000802085 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802085:	55                   	push   %rbp
+  802086:	48 89 e5             	mov    %rsp,%rbp
+  802089:	48 83 ec 10          	sub    $0x10,%rsp
+  80208d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802090:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802093:	48 98                	cltq
+  802095:	48 83 ec 08          	sub    $0x8,%rsp
+  802099:	6a 00                	push   $0x0
+  80209b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ac:	48 89 c2             	mov    %rax,%rdx
+  8020af:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020b9:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c9:	90                   	nop
+  8020ca:	c9                   	leave
+  8020cb:	c3                   	ret
+
+00000000008020cc <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8020cc:	55                   	push   %rbp
+  8020cd:	48 89 e5             	mov    %rsp,%rbp
+  8020d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8020d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8020db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020de:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8020e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020e6:	cd 30                	int    $0x30
+  8020e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8020ec:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8020f0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8020f5:	7e 3d                	jle    802134 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8020f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020fb:	49 89 c0             	mov    %rax,%r8
+  8020fe:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802103:	48 b8 28 58 80 00 00 	movabs $0x805828,%rax
+  80210a:	00 00 00 
+  80210d:	48 89 c2             	mov    %rax,%rdx
+  802110:	be 49 00 00 00       	mov    $0x49,%esi
+  802115:	48 b8 47 58 80 00 00 	movabs $0x805847,%rax
+  80211c:	00 00 00 
+  80211f:	48 89 c7             	mov    %rax,%rdi
+  802122:	b8 00 00 00 00       	mov    $0x0,%eax
+  802127:	49 b9 30 02 80 00 00 	movabs $0x800230,%r9
+  80212e:	00 00 00 
+  802131:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802134:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802139:	75 13                	jne    80214e <sys_env_wait+0x82>
+  80213b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802140:	74 0c                	je     80214e <sys_env_wait+0x82>
+    *status = st;
+  802142:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80214c:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80214e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+
+0000000000802154 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802158:	48 83 ec 08          	sub    $0x8,%rsp
+  80215c:	6a 00                	push   $0x0
+  80215e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802164:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802174:	be 00 00 00 00       	mov    $0x0,%esi
+  802179:	bf 02 00 00 00       	mov    $0x2,%edi
+  80217e:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+0000000000802190 <sys_yield>:
+
+void
+sys_yield(void) {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802194:	48 83 ec 08          	sub    $0x8,%rsp
+  802198:	6a 00                	push   $0x0
+  80219a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b5:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021ba:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8021c1:	00 00 00 
+  8021c4:	ff d0                	call   *%rax
+  8021c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ca:	90                   	nop
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+00000000008021cd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8021d5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8021d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021dc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8021df:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8021e2:	48 63 c8             	movslq %eax,%rcx
+  8021e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8021e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021ec:	48 98                	cltq
+  8021ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f2:	6a 00                	push   $0x0
+  8021f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021fa:	49 89 c8             	mov    %rcx,%r8
+  8021fd:	48 89 d1             	mov    %rdx,%rcx
+  802200:	48 89 c2             	mov    %rax,%rdx
+  802203:	be 01 00 00 00       	mov    $0x1,%esi
+  802208:	bf 06 00 00 00       	mov    $0x6,%edi
+  80220d:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802214:	00 00 00 
+  802217:	ff d0                	call   *%rax
+  802219:	48 83 c4 10          	add    $0x10,%rsp
+  80221d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+
+0000000000802225 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+  802229:	48 83 ec 20          	sub    $0x20,%rsp
+  80222d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802230:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802234:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802237:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80223b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80223f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802242:	48 63 c8             	movslq %eax,%rcx
+  802245:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802249:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80224c:	48 63 f0             	movslq %eax,%rsi
+  80224f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802253:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802256:	48 98                	cltq
+  802258:	48 83 ec 08          	sub    $0x8,%rsp
+  80225c:	51                   	push   %rcx
+  80225d:	49 89 f9             	mov    %rdi,%r9
+  802260:	49 89 f0             	mov    %rsi,%r8
+  802263:	48 89 d1             	mov    %rdx,%rcx
+  802266:	48 89 c2             	mov    %rax,%rdx
+  802269:	be 01 00 00 00       	mov    $0x1,%esi
+  80226e:	bf 07 00 00 00       	mov    $0x7,%edi
+  802273:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80227a:	00 00 00 
+  80227d:	ff d0                	call   *%rax
+  80227f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+0000000000802285 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	48 83 ec 10          	sub    $0x10,%rsp
+  80228d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802290:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802294:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802298:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80229b:	48 98                	cltq
+  80229d:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a1:	6a 00                	push   $0x0
+  8022a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022af:	48 89 d1             	mov    %rdx,%rcx
+  8022b2:	48 89 c2             	mov    %rax,%rdx
+  8022b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ba:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022bf:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+  8022cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+
+00000000008022d1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8022d1:	55                   	push   %rbp
+  8022d2:	48 89 e5             	mov    %rsp,%rbp
+  8022d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022dc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022e2:	48 63 d0             	movslq %eax,%rdx
+  8022e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022e8:	48 98                	cltq
+  8022ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ee:	6a 00                	push   $0x0
+  8022f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022fc:	48 89 d1             	mov    %rdx,%rcx
+  8022ff:	48 89 c2             	mov    %rax,%rdx
+  802302:	be 01 00 00 00       	mov    $0x1,%esi
+  802307:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80230c:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  802318:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+000000000080231e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+  802322:	48 83 ec 10          	sub    $0x10,%rsp
+  802326:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802329:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80232d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802331:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802334:	48 98                	cltq
+  802336:	48 83 ec 08          	sub    $0x8,%rsp
+  80233a:	6a 00                	push   $0x0
+  80233c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802348:	48 89 d1             	mov    %rdx,%rcx
+  80234b:	48 89 c2             	mov    %rax,%rdx
+  80234e:	be 01 00 00 00       	mov    $0x1,%esi
+  802353:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802358:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802368:	c9                   	leave
+  802369:	c3                   	ret
+
+000000000080236a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+  80236e:	48 83 ec 10          	sub    $0x10,%rsp
+  802372:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802375:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802379:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80237d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802380:	48 98                	cltq
+  802382:	48 83 ec 08          	sub    $0x8,%rsp
+  802386:	6a 00                	push   $0x0
+  802388:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80238e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802394:	48 89 d1             	mov    %rdx,%rcx
+  802397:	48 89 c2             	mov    %rax,%rdx
+  80239a:	be 01 00 00 00       	mov    $0x1,%esi
+  80239f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023a4:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+  8023b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+00000000008023b6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8023b6:	55                   	push   %rbp
+  8023b7:	48 89 e5             	mov    %rsp,%rbp
+  8023ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8023be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023c9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8023cc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023cf:	48 63 f0             	movslq %eax,%rsi
+  8023d2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023dd:	48 98                	cltq
+  8023df:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e3:	6a 00                	push   $0x0
+  8023e5:	49 89 f1             	mov    %rsi,%r9
+  8023e8:	49 89 c8             	mov    %rcx,%r8
+  8023eb:	48 89 d1             	mov    %rdx,%rcx
+  8023ee:	48 89 c2             	mov    %rax,%rdx
+  8023f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f6:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8023fb:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+  802407:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+000000000080240d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80240d:	55                   	push   %rbp
+  80240e:	48 89 e5             	mov    %rsp,%rbp
+  802411:	48 83 ec 10          	sub    $0x10,%rsp
+  802415:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802419:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80241d:	48 83 ec 08          	sub    $0x8,%rsp
+  802421:	6a 00                	push   $0x0
+  802423:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802434:	48 89 c2             	mov    %rax,%rdx
+  802437:	be 01 00 00 00       	mov    $0x1,%esi
+  80243c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802441:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+  80244d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802451:	c9                   	leave
+  802452:	c3                   	ret
+
+0000000000802453 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802453:	55                   	push   %rbp
+  802454:	48 89 e5             	mov    %rsp,%rbp
+  802457:	48 83 ec 10          	sub    $0x10,%rsp
+  80245b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80245f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802463:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246b:	48 83 ec 08          	sub    $0x8,%rsp
+  80246f:	6a 00                	push   $0x0
+  802471:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802477:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247d:	48 89 d1             	mov    %rdx,%rcx
+  802480:	48 89 c2             	mov    %rax,%rdx
+  802483:	be 01 00 00 00       	mov    $0x1,%esi
+  802488:	bf 10 00 00 00       	mov    $0x10,%edi
+  80248d:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+  802499:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249d:	c9                   	leave
+  80249e:	c3                   	ret
+
+000000000080249f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8024a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c4:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024c9:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d9:	c9                   	leave
+  8024da:	c3                   	ret
+
+00000000008024db <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8024db:	55                   	push   %rbp
+  8024dc:	48 89 e5             	mov    %rsp,%rbp
+  8024df:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8024eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f7:	6a 00                	push   $0x0
+  8024f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802505:	48 89 d1             	mov    %rdx,%rcx
+  802508:	48 89 c2             	mov    %rax,%rdx
+  80250b:	be 00 00 00 00       	mov    $0x0,%esi
+  802510:	bf 12 00 00 00       	mov    $0x12,%edi
+  802515:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+  802521:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802525:	c9                   	leave
+  802526:	c3                   	ret
+
+0000000000802527 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	48 83 ec 20          	sub    $0x20,%rsp
+  80252f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802533:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802537:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80253a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80253d:	48 63 c8             	movslq %eax,%rcx
+  802540:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802544:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802548:	48 83 ec 08          	sub    $0x8,%rsp
+  80254c:	6a 00                	push   $0x0
+  80254e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802554:	49 89 c8             	mov    %rcx,%r8
+  802557:	48 89 d1             	mov    %rdx,%rcx
+  80255a:	48 89 c2             	mov    %rax,%rdx
+  80255d:	be 00 00 00 00       	mov    $0x0,%esi
+  802562:	bf 13 00 00 00       	mov    $0x13,%edi
+  802567:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80256e:	00 00 00 
+  802571:	ff d0                	call   *%rax
+  802573:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+
+0000000000802579 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802579:	55                   	push   %rbp
+  80257a:	48 89 e5             	mov    %rsp,%rbp
+  80257d:	48 83 ec 20          	sub    $0x20,%rsp
+  802581:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802585:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802588:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80258c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802590:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802597:	48 83 ec 08          	sub    $0x8,%rsp
+  80259b:	6a 00                	push   $0x0
+  80259d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025a3:	49 89 c8             	mov    %rcx,%r8
+  8025a6:	48 89 d1             	mov    %rdx,%rcx
+  8025a9:	48 89 c2             	mov    %rax,%rdx
+  8025ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b1:	bf 14 00 00 00       	mov    $0x14,%edi
+  8025b6:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8025bd:	00 00 00 
+  8025c0:	ff d0                	call   *%rax
+  8025c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c6:	c9                   	leave
+  8025c7:	c3                   	ret
+
+00000000008025c8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8025c8:	55                   	push   %rbp
+  8025c9:	48 89 e5             	mov    %rsp,%rbp
+  8025cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025d4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8025d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025da:	48 63 d0             	movslq %eax,%rdx
+  8025dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e5:	6a 00                	push   $0x0
+  8025e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025f3:	48 89 d1             	mov    %rdx,%rcx
+  8025f6:	48 89 c2             	mov    %rax,%rdx
+  8025f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025fe:	bf 15 00 00 00       	mov    $0x15,%edi
+  802603:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+  80260f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802613:	c9                   	leave
+  802614:	c3                   	ret
+
+0000000000802615 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802615:	55                   	push   %rbp
+  802616:	48 89 e5             	mov    %rsp,%rbp
+  802619:	48 83 ec 20          	sub    $0x20,%rsp
+  80261d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802621:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802624:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802627:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80262b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80262f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802632:	48 63 c8             	movslq %eax,%rcx
+  802635:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802638:	48 63 d0             	movslq %eax,%rdx
+  80263b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80263f:	48 83 ec 08          	sub    $0x8,%rsp
+  802643:	6a 00                	push   $0x0
+  802645:	49 89 f1             	mov    %rsi,%r9
+  802648:	49 89 c8             	mov    %rcx,%r8
+  80264b:	48 89 d1             	mov    %rdx,%rcx
+  80264e:	48 89 c2             	mov    %rax,%rdx
+  802651:	be 00 00 00 00       	mov    $0x0,%esi
+  802656:	bf 16 00 00 00       	mov    $0x16,%edi
+  80265b:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+  802667:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80266b:	c9                   	leave
+  80266c:	c3                   	ret
+
+000000000080266d <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80266d:	55                   	push   %rbp
+  80266e:	48 89 e5             	mov    %rsp,%rbp
+  802671:	48 83 ec 30          	sub    $0x30,%rsp
+  802675:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802679:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80267d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802681:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802685:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802689:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80268d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802691:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802695:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269d:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a1:	51                   	push   %rcx
+  8026a2:	49 89 f9             	mov    %rdi,%r9
+  8026a5:	49 89 f0             	mov    %rsi,%r8
+  8026a8:	48 89 d1             	mov    %rdx,%rcx
+  8026ab:	48 89 c2             	mov    %rax,%rdx
+  8026ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b3:	bf 17 00 00 00       	mov    $0x17,%edi
+  8026b8:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8026bf:	00 00 00 
+  8026c2:	ff d0                	call   *%rax
+  8026c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+
+00000000008026ca <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8026d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026d8:	48 98                	cltq
+  8026da:	48 83 ec 08          	sub    $0x8,%rsp
+  8026de:	6a 00                	push   $0x0
+  8026e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026f1:	48 89 c2             	mov    %rax,%rdx
+  8026f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f9:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026fe:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802705:	00 00 00 
+  802708:	ff d0                	call   *%rax
+  80270a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80270e:	90                   	nop
+  80270f:	c9                   	leave
+  802710:	c3                   	ret
+
+0000000000802711 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+  802715:	48 83 ec 30          	sub    $0x30,%rsp
+  802719:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80271c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802720:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802724:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802727:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80272a:	48 63 f0             	movslq %eax,%rsi
+  80272d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802731:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802735:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802738:	48 98                	cltq
+  80273a:	48 83 ec 08          	sub    $0x8,%rsp
+  80273e:	6a 00                	push   $0x0
+  802740:	49 89 f1             	mov    %rsi,%r9
+  802743:	49 89 c8             	mov    %rcx,%r8
+  802746:	48 89 d1             	mov    %rdx,%rcx
+  802749:	48 89 c2             	mov    %rax,%rdx
+  80274c:	be 01 00 00 00       	mov    $0x1,%esi
+  802751:	bf 19 00 00 00       	mov    $0x19,%edi
+  802756:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80275d:	00 00 00 
+  802760:	ff d0                	call   *%rax
+  802762:	48 83 c4 10          	add    $0x10,%rsp
+  802766:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802769:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+000000000080276e <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 20          	sub    $0x20,%rsp
+  802776:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80277a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80277e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802781:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802784:	48 63 c8             	movslq %eax,%rcx
+  802787:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80278b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80278f:	48 83 ec 08          	sub    $0x8,%rsp
+  802793:	6a 00                	push   $0x0
+  802795:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80279b:	49 89 c8             	mov    %rcx,%r8
+  80279e:	48 89 d1             	mov    %rdx,%rcx
+  8027a1:	48 89 c2             	mov    %rax,%rdx
+  8027a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8027a9:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8027ae:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+  8027ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027be:	c9                   	leave
+  8027bf:	c3                   	ret
+
+00000000008027c0 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8027c0:	55                   	push   %rbp
+  8027c1:	48 89 e5             	mov    %rsp,%rbp
+  8027c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8027c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8027d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e4:	6a 00                	push   $0x0
+  8027e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ec:	49 89 c8             	mov    %rcx,%r8
+  8027ef:	48 89 d1             	mov    %rdx,%rcx
+  8027f2:	48 89 c2             	mov    %rax,%rdx
+  8027f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8027fa:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8027ff:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  802806:	00 00 00 
+  802809:	ff d0                	call   *%rax
+  80280b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80280f:	c9                   	leave
+  802810:	c3                   	ret
+
+0000000000802811 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802811:	55                   	push   %rbp
+  802812:	48 89 e5             	mov    %rsp,%rbp
+  802815:	48 83 ec 30          	sub    $0x30,%rsp
+  802819:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80281d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802821:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802824:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802828:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80282c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80282f:	48 63 c8             	movslq %eax,%rcx
+  802832:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80283a:	48 83 ec 08          	sub    $0x8,%rsp
+  80283e:	6a 00                	push   $0x0
+  802840:	49 89 f1             	mov    %rsi,%r9
+  802843:	49 89 c8             	mov    %rcx,%r8
+  802846:	48 89 d1             	mov    %rdx,%rcx
+  802849:	48 89 c2             	mov    %rax,%rdx
+  80284c:	be 01 00 00 00       	mov    $0x1,%esi
+  802851:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802856:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	48 83 c4 10          	add    $0x10,%rsp
+  802866:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802869:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80286c:	c9                   	leave
+  80286d:	c3                   	ret
+
+000000000080286e <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80286e:	55                   	push   %rbp
+  80286f:	48 89 e5             	mov    %rsp,%rbp
+  802872:	48 83 ec 10          	sub    $0x10,%rsp
+  802876:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802879:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80287c:	48 98                	cltq
+  80287e:	48 83 ec 08          	sub    $0x8,%rsp
+  802882:	6a 00                	push   $0x0
+  802884:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80288a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802890:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802895:	48 89 c2             	mov    %rax,%rdx
+  802898:	be 01 00 00 00       	mov    $0x1,%esi
+  80289d:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8028a2:	48 b8 1d 1f 80 00 00 	movabs $0x801f1d,%rax
+  8028a9:	00 00 00 
+  8028ac:	ff d0                	call   *%rax
+  8028ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028b2:	c9                   	leave
+  8028b3:	c3                   	ret
+
+00000000008028b4 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8028b4:	55                   	push   %rbp
+  8028b5:	48 89 e5             	mov    %rsp,%rbp
+  8028b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8028bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  8028c0:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+  8028cc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  8028cf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8028d6:	00 00 00 
+  8028d9:	48 8b 00             	mov    (%rax),%rax
+  8028dc:	48 85 c0             	test   %rax,%rax
+  8028df:	75 62                	jne    802943 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  8028e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028e4:	ba 07 00 00 00       	mov    $0x7,%edx
+  8028e9:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8028f0:	00 00 00 
+  8028f3:	48 89 ce             	mov    %rcx,%rsi
+  8028f6:	89 c7                	mov    %eax,%edi
+  8028f8:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  8028ff:	00 00 00 
+  802902:	ff d0                	call   *%rax
+  802904:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  802907:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80290b:	79 36                	jns    802943 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  80290d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802910:	89 c1                	mov    %eax,%ecx
+  802912:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  802919:	00 00 00 
+  80291c:	48 89 c2             	mov    %rax,%rdx
+  80291f:	be 23 00 00 00       	mov    $0x23,%esi
+  802924:	48 b8 6d 58 80 00 00 	movabs $0x80586d,%rax
+  80292b:	00 00 00 
+  80292e:	48 89 c7             	mov    %rax,%rdi
+  802931:	b8 00 00 00 00       	mov    $0x0,%eax
+  802936:	49 b8 30 02 80 00 00 	movabs $0x800230,%r8
+  80293d:	00 00 00 
+  802940:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802943:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80294a:	00 00 00 
+  80294d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802951:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  802954:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802957:	48 ba b4 29 80 00 00 	movabs $0x8029b4,%rdx
+  80295e:	00 00 00 
+  802961:	48 89 d6             	mov    %rdx,%rsi
+  802964:	89 c7                	mov    %eax,%edi
+  802966:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  802975:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802979:	79 36                	jns    8029b1 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  80297b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80297e:	89 c1                	mov    %eax,%ecx
+  802980:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  802987:	00 00 00 
+  80298a:	48 89 c2             	mov    %rax,%rdx
+  80298d:	be 2b 00 00 00       	mov    $0x2b,%esi
+  802992:	48 b8 6d 58 80 00 00 	movabs $0x80586d,%rax
+  802999:	00 00 00 
+  80299c:	48 89 c7             	mov    %rax,%rdi
+  80299f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a4:	49 b8 30 02 80 00 00 	movabs $0x800230,%r8
+  8029ab:	00 00 00 
+  8029ae:	41 ff d0             	call   *%r8
+}
+  8029b1:	90                   	nop
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+00000000008029b4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  8029b4:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  8029b7:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  8029ba:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  8029c1:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  8029c5:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  8029ca:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  8029d1:	00 00 00 
+	call *%rax
+  8029d4:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8029d6:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8029db:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8029de:	41 5f                	pop    %r15
+	popq %r15
+  8029e0:	41 5f                	pop    %r15
+	popq %r15
+  8029e2:	41 5f                	pop    %r15
+	popq %r14
+  8029e4:	41 5e                	pop    %r14
+	popq %r13
+  8029e6:	41 5d                	pop    %r13
+	popq %r12
+  8029e8:	41 5c                	pop    %r12
+	popq %r11
+  8029ea:	41 5b                	pop    %r11
+	popq %r10
+  8029ec:	41 5a                	pop    %r10
+	popq %r9
+  8029ee:	41 59                	pop    %r9
+	popq %r8
+  8029f0:	41 58                	pop    %r8
+	popq %rsi
+  8029f2:	5e                   	pop    %rsi
+	popq %rdi
+  8029f3:	5f                   	pop    %rdi
+	popq %rbp
+  8029f4:	5d                   	pop    %rbp
+	popq %rdx
+  8029f5:	5a                   	pop    %rdx
+	popq %rcx
+  8029f6:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8029f7:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8029fc:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  802a01:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  802a05:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  802a08:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  802a0d:	5b                   	pop    %rbx
+	popq %rax
+  802a0e:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  802a0f:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  802a13:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  802a14:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  802a19:	c3                   	ret
+
+0000000000802a1a <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802a26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a2a:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802a31:	ff ff ff 
+  802a34:	48 01 d0             	add    %rdx,%rax
+  802a37:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a3b:	c9                   	leave
+  802a3c:	c3                   	ret
+
+0000000000802a3d <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802a3d:	55                   	push   %rbp
+  802a3e:	48 89 e5             	mov    %rsp,%rbp
+  802a41:	48 83 ec 08          	sub    $0x8,%rsp
+  802a45:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a4d:	48 89 c7             	mov    %rax,%rdi
+  802a50:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+  802a5c:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802a62:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802a66:	c9                   	leave
+  802a67:	c3                   	ret
+
+0000000000802a68 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802a68:	55                   	push   %rbp
+  802a69:	48 89 e5             	mov    %rsp,%rbp
+  802a6c:	48 83 ec 18          	sub    $0x18,%rsp
+  802a70:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802a74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a7b:	e9 ae 00 00 00       	jmp    802b2e <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802a80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a83:	c1 e0 0c             	shl    $0xc,%eax
+  802a86:	48 98                	cltq
+  802a88:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a8d:	48 01 d0             	add    %rdx,%rax
+  802a90:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a98:	48 c1 e8 27          	shr    $0x27,%rax
+  802a9c:	48 89 c2             	mov    %rax,%rdx
+  802a9f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802aa6:	01 00 00 
+  802aa9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aad:	83 e0 01             	and    $0x1,%eax
+  802ab0:	48 85 c0             	test   %rax,%rax
+  802ab3:	74 63                	je     802b18 <fd_alloc+0xb0>
+  802ab5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802abd:	48 89 c2             	mov    %rax,%rdx
+  802ac0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802ac7:	01 00 00 
+  802aca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ace:	83 e0 01             	and    $0x1,%eax
+  802ad1:	48 85 c0             	test   %rax,%rax
+  802ad4:	74 42                	je     802b18 <fd_alloc+0xb0>
+  802ad6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ada:	48 c1 e8 15          	shr    $0x15,%rax
+  802ade:	48 89 c2             	mov    %rax,%rdx
+  802ae1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ae8:	01 00 00 
+  802aeb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aef:	83 e0 01             	and    $0x1,%eax
+  802af2:	48 85 c0             	test   %rax,%rax
+  802af5:	74 21                	je     802b18 <fd_alloc+0xb0>
+  802af7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802afb:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aff:	48 89 c2             	mov    %rax,%rdx
+  802b02:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b09:	01 00 00 
+  802b0c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b10:	83 e0 01             	and    $0x1,%eax
+  802b13:	48 85 c0             	test   %rax,%rax
+  802b16:	75 12                	jne    802b2a <fd_alloc+0xc2>
+      *fd_store = fd;
+  802b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b20:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	eb 1e                	jmp    802b48 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802b2a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b2e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b32:	0f 8e 48 ff ff ff    	jle    802a80 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b3c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b43:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+0000000000802b4a <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	48 83 ec 20          	sub    $0x20,%rsp
+  802b52:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b55:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b59:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b5d:	78 06                	js     802b65 <fd_lookup+0x1b>
+  802b5f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b63:	7e 0a                	jle    802b6f <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6a:	e9 af 00 00 00       	jmp    802c1e <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802b6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b72:	c1 e0 0c             	shl    $0xc,%eax
+  802b75:	48 98                	cltq
+  802b77:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b7c:	48 01 d0             	add    %rdx,%rax
+  802b7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b87:	48 c1 e8 27          	shr    $0x27,%rax
+  802b8b:	48 89 c2             	mov    %rax,%rdx
+  802b8e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b95:	01 00 00 
+  802b98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b9c:	83 e0 01             	and    $0x1,%eax
+  802b9f:	48 85 c0             	test   %rax,%rax
+  802ba2:	74 63                	je     802c07 <fd_lookup+0xbd>
+  802ba4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ba8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bac:	48 89 c2             	mov    %rax,%rdx
+  802baf:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802bb6:	01 00 00 
+  802bb9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bbd:	83 e0 01             	and    $0x1,%eax
+  802bc0:	48 85 c0             	test   %rax,%rax
+  802bc3:	74 42                	je     802c07 <fd_lookup+0xbd>
+  802bc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bc9:	48 c1 e8 15          	shr    $0x15,%rax
+  802bcd:	48 89 c2             	mov    %rax,%rdx
+  802bd0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bd7:	01 00 00 
+  802bda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bde:	83 e0 01             	and    $0x1,%eax
+  802be1:	48 85 c0             	test   %rax,%rax
+  802be4:	74 21                	je     802c07 <fd_lookup+0xbd>
+  802be6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bea:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bee:	48 89 c2             	mov    %rax,%rdx
+  802bf1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bf8:	01 00 00 
+  802bfb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bff:	83 e0 01             	and    $0x1,%eax
+  802c02:	48 85 c0             	test   %rax,%rax
+  802c05:	75 07                	jne    802c0e <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802c07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c0c:	eb 10                	jmp    802c1e <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802c0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c16:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802c19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c1e:	c9                   	leave
+  802c1f:	c3                   	ret
+
+0000000000802c20 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802c20:	55                   	push   %rbp
+  802c21:	48 89 e5             	mov    %rsp,%rbp
+  802c24:	48 83 ec 30          	sub    $0x30,%rsp
+  802c28:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c2c:	89 f0                	mov    %esi,%eax
+  802c2e:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802c31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c35:	48 89 c7             	mov    %rax,%rdi
+  802c38:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+  802c44:	89 c2                	mov    %eax,%edx
+  802c46:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c4a:	48 89 c6             	mov    %rax,%rsi
+  802c4d:	89 d7                	mov    %edx,%edi
+  802c4f:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  802c56:	00 00 00 
+  802c59:	ff d0                	call   *%rax
+  802c5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c62:	78 0a                	js     802c6e <fd_close+0x4e>
+  802c64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c68:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802c6c:	74 12                	je     802c80 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802c6e:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802c72:	74 05                	je     802c79 <fd_close+0x59>
+  802c74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c77:	eb 70                	jmp    802ce9 <fd_close+0xc9>
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7e:	eb 69                	jmp    802ce9 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c84:	8b 00                	mov    (%rax),%eax
+  802c86:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c8a:	48 89 d6             	mov    %rdx,%rsi
+  802c8d:	89 c7                	mov    %eax,%edi
+  802c8f:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  802c96:	00 00 00 
+  802c99:	ff d0                	call   *%rax
+  802c9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca2:	78 2a                	js     802cce <fd_close+0xae>
+    if (dev->dev_close)
+  802ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802cac:	48 85 c0             	test   %rax,%rax
+  802caf:	74 16                	je     802cc7 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802cb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb5:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802cb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cbd:	48 89 c7             	mov    %rax,%rdi
+  802cc0:	ff d2                	call   *%rdx
+  802cc2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc5:	eb 07                	jmp    802cce <fd_close+0xae>
+    else
+      r = 0;
+  802cc7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802cce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cd2:	48 89 c6             	mov    %rax,%rsi
+  802cd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cda:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  802ce1:	00 00 00 
+  802ce4:	ff d0                	call   *%rax
+  return r;
+  802ce6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ce9:	c9                   	leave
+  802cea:	c3                   	ret
+
+0000000000802ceb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802ceb:	55                   	push   %rbp
+  802cec:	48 89 e5             	mov    %rsp,%rbp
+  802cef:	48 83 ec 20          	sub    $0x20,%rsp
+  802cf3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cf6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802cfa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d01:	eb 3f                	jmp    802d42 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802d03:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d0a:	00 00 00 
+  802d0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d10:	48 98                	cltq
+  802d12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d16:	8b 00                	mov    (%rax),%eax
+  802d18:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802d1b:	75 21                	jne    802d3e <dev_lookup+0x53>
+      *dev = devtab[i];
+  802d1d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d24:	00 00 00 
+  802d27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d2a:	48 98                	cltq
+  802d2c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d34:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3c:	eb 7f                	jmp    802dbd <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802d3e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d42:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d49:	00 00 00 
+  802d4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d4f:	48 98                	cltq
+  802d51:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d55:	48 85 c0             	test   %rax,%rax
+  802d58:	75 a9                	jne    802d03 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d5a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d61:	00 00 00 
+  802d64:	8b 40 04             	mov    0x4(%rax),%eax
+  802d67:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d6c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d73:	00 00 00 
+  802d76:	48 98                	cltq
+  802d78:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802d7f:	48 01 d0             	add    %rdx,%rax
+  802d82:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802d88:	8b 00                	mov    (%rax),%eax
+  802d8a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d8d:	89 c6                	mov    %eax,%esi
+  802d8f:	48 b8 80 58 80 00 00 	movabs $0x805880,%rax
+  802d96:	00 00 00 
+  802d99:	48 89 c7             	mov    %rax,%rdi
+  802d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da1:	48 b9 4f 04 80 00 00 	movabs $0x80044f,%rcx
+  802da8:	00 00 00 
+  802dab:	ff d1                	call   *%rcx
+  *dev = 0;
+  802dad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802db1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802db8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+
+0000000000802dbf <close>:
+
+int
+close(int fdnum) {
+  802dbf:	55                   	push   %rbp
+  802dc0:	48 89 e5             	mov    %rsp,%rbp
+  802dc3:	48 83 ec 20          	sub    $0x20,%rsp
+  802dc7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dca:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802dce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dd1:	48 89 d6             	mov    %rdx,%rsi
+  802dd4:	89 c7                	mov    %eax,%edi
+  802dd6:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+  802de2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802de5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802de9:	79 05                	jns    802df0 <close+0x31>
+    return r;
+  802deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dee:	eb 18                	jmp    802e08 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802df0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df4:	be 01 00 00 00       	mov    $0x1,%esi
+  802df9:	48 89 c7             	mov    %rax,%rdi
+  802dfc:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  802e03:	00 00 00 
+  802e06:	ff d0                	call   *%rax
+}
+  802e08:	c9                   	leave
+  802e09:	c3                   	ret
+
+0000000000802e0a <close_all>:
+
+void
+close_all(void) {
+  802e0a:	55                   	push   %rbp
+  802e0b:	48 89 e5             	mov    %rsp,%rbp
+  802e0e:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802e12:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e19:	eb 15                	jmp    802e30 <close_all+0x26>
+    close(i);
+  802e1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e1e:	89 c7                	mov    %eax,%edi
+  802e20:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802e2c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802e30:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802e34:	7e e5                	jle    802e1b <close_all+0x11>
+}
+  802e36:	90                   	nop
+  802e37:	90                   	nop
+  802e38:	c9                   	leave
+  802e39:	c3                   	ret
+
+0000000000802e3a <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802e3a:	55                   	push   %rbp
+  802e3b:	48 89 e5             	mov    %rsp,%rbp
+  802e3e:	48 83 ec 40          	sub    $0x40,%rsp
+  802e42:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e45:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e48:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e4c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e4f:	48 89 d6             	mov    %rdx,%rsi
+  802e52:	89 c7                	mov    %eax,%edi
+  802e54:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e67:	79 08                	jns    802e71 <dup+0x37>
+    return r;
+  802e69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e6c:	e9 33 02 00 00       	jmp    8030a4 <dup+0x26a>
+  close(newfdnum);
+  802e71:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e74:	89 c7                	mov    %eax,%edi
+  802e76:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  802e7d:	00 00 00 
+  802e80:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802e82:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e85:	c1 e0 0c             	shl    $0xc,%eax
+  802e88:	48 98                	cltq
+  802e8a:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802e8f:	48 01 d0             	add    %rdx,%rax
+  802e92:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802e96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e9a:	48 89 c7             	mov    %rax,%rdi
+  802e9d:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+  802ea9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802ead:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eb1:	48 89 c7             	mov    %rax,%rdi
+  802eb4:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  802ebb:	00 00 00 
+  802ebe:	ff d0                	call   *%rax
+  802ec0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802ec4:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802ecb:	00 
+  802ecc:	e9 19 01 00 00       	jmp    802fea <dup+0x1b0>
+    off -= PGSIZE;
+  802ed1:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802ed8:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ed9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802edd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ee1:	48 01 d0             	add    %rdx,%rax
+  802ee4:	48 c1 e8 27          	shr    $0x27,%rax
+  802ee8:	48 89 c2             	mov    %rax,%rdx
+  802eeb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ef2:	01 00 00 
+  802ef5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ef9:	83 e0 01             	and    $0x1,%eax
+  802efc:	48 85 c0             	test   %rax,%rax
+  802eff:	0f 84 e5 00 00 00    	je     802fea <dup+0x1b0>
+  802f05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f0d:	48 01 d0             	add    %rdx,%rax
+  802f10:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f14:	48 89 c2             	mov    %rax,%rdx
+  802f17:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f1e:	01 00 00 
+  802f21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f25:	83 e0 01             	and    $0x1,%eax
+  802f28:	48 85 c0             	test   %rax,%rax
+  802f2b:	0f 84 b9 00 00 00    	je     802fea <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f31:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f39:	48 01 d0             	add    %rdx,%rax
+  802f3c:	48 c1 e8 15          	shr    $0x15,%rax
+  802f40:	48 89 c2             	mov    %rax,%rdx
+  802f43:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f4a:	01 00 00 
+  802f4d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f51:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f54:	48 85 c0             	test   %rax,%rax
+  802f57:	0f 84 8d 00 00 00    	je     802fea <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f5d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f65:	48 01 d0             	add    %rdx,%rax
+  802f68:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f6c:	48 89 c2             	mov    %rax,%rdx
+  802f6f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f76:	01 00 00 
+  802f79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f7d:	83 e0 01             	and    $0x1,%eax
+  802f80:	48 85 c0             	test   %rax,%rax
+  802f83:	74 65                	je     802fea <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802f85:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f8d:	48 01 d0             	add    %rdx,%rax
+  802f90:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f94:	48 89 c2             	mov    %rax,%rdx
+  802f97:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f9e:	01 00 00 
+  802fa1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa5:	25 07 0e 00 00       	and    $0xe07,%eax
+  802faa:	89 c6                	mov    %eax,%esi
+  802fac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb4:	48 01 c2             	add    %rax,%rdx
+  802fb7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802fbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fbf:	48 01 c8             	add    %rcx,%rax
+  802fc2:	41 89 f0             	mov    %esi,%r8d
+  802fc5:	48 89 d1             	mov    %rdx,%rcx
+  802fc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fcd:	48 89 c6             	mov    %rax,%rsi
+  802fd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd5:	48 b8 25 22 80 00 00 	movabs $0x802225,%rax
+  802fdc:	00 00 00 
+  802fdf:	ff d0                	call   *%rax
+  802fe1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fe4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fe8:	78 60                	js     80304a <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802fea:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802fef:	0f 85 dc fe ff ff    	jne    802ed1 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ff9:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ffd:	48 89 c2             	mov    %rax,%rdx
+  803000:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803007:	01 00 00 
+  80300a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80300e:	25 07 0e 00 00       	and    $0xe07,%eax
+  803013:	89 c1                	mov    %eax,%ecx
+  803015:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803019:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80301d:	41 89 c8             	mov    %ecx,%r8d
+  803020:	48 89 d1             	mov    %rdx,%rcx
+  803023:	ba 00 00 00 00       	mov    $0x0,%edx
+  803028:	48 89 c6             	mov    %rax,%rsi
+  80302b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803030:	48 b8 25 22 80 00 00 	movabs $0x802225,%rax
+  803037:	00 00 00 
+  80303a:	ff d0                	call   *%rax
+  80303c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80303f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803043:	78 08                	js     80304d <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803045:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803048:	eb 5a                	jmp    8030a4 <dup+0x26a>
+        goto err;
+  80304a:	90                   	nop
+  80304b:	eb 01                	jmp    80304e <dup+0x214>
+    goto err;
+  80304d:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80304e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803052:	48 89 c6             	mov    %rax,%rsi
+  803055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305a:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803066:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80306d:	00 
+  80306e:	eb 27                	jmp    803097 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803070:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803074:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803078:	48 01 d0             	add    %rdx,%rax
+  80307b:	48 89 c6             	mov    %rax,%rsi
+  80307e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803083:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  80308a:	00 00 00 
+  80308d:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80308f:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803096:	00 
+  803097:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80309e:	00 
+  80309f:	76 cf                	jbe    803070 <dup+0x236>
+  return r;
+  8030a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030a4:	c9                   	leave
+  8030a5:	c3                   	ret
+
+00000000008030a6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8030a6:	55                   	push   %rbp
+  8030a7:	48 89 e5             	mov    %rsp,%rbp
+  8030aa:	48 83 ec 40          	sub    $0x40,%rsp
+  8030ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030b1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030b9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030c0:	48 89 d6             	mov    %rdx,%rsi
+  8030c3:	89 c7                	mov    %eax,%edi
+  8030c5:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+  8030d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030d8:	78 24                	js     8030fe <read+0x58>
+  8030da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030de:	8b 00                	mov    (%rax),%eax
+  8030e0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030e4:	48 89 d6             	mov    %rdx,%rsi
+  8030e7:	89 c7                	mov    %eax,%edi
+  8030e9:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  8030f0:	00 00 00 
+  8030f3:	ff d0                	call   *%rax
+  8030f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030fc:	79 0a                	jns    803108 <read+0x62>
+    return r;
+  8030fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803101:	48 98                	cltq
+  803103:	e9 9e 00 00 00       	jmp    8031a6 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80310c:	8b 40 08             	mov    0x8(%rax),%eax
+  80310f:	83 e0 03             	and    $0x3,%eax
+  803112:	83 f8 01             	cmp    $0x1,%eax
+  803115:	75 5c                	jne    803173 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803117:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80311e:	00 00 00 
+  803121:	8b 40 04             	mov    0x4(%rax),%eax
+  803124:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803129:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803130:	00 00 00 
+  803133:	48 98                	cltq
+  803135:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80313c:	48 01 d0             	add    %rdx,%rax
+  80313f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803145:	8b 00                	mov    (%rax),%eax
+  803147:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80314a:	89 c6                	mov    %eax,%esi
+  80314c:	48 b8 9f 58 80 00 00 	movabs $0x80589f,%rax
+  803153:	00 00 00 
+  803156:	48 89 c7             	mov    %rax,%rdi
+  803159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315e:	48 b9 4f 04 80 00 00 	movabs $0x80044f,%rcx
+  803165:	00 00 00 
+  803168:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80316a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803171:	eb 33                	jmp    8031a6 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803173:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803177:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80317b:	48 85 c0             	test   %rax,%rax
+  80317e:	75 09                	jne    803189 <read+0xe3>
+    return -E_NOT_SUPP;
+  803180:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803187:	eb 1d                	jmp    8031a6 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803189:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80318d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803191:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803195:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803199:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80319d:	48 89 ce             	mov    %rcx,%rsi
+  8031a0:	48 89 c7             	mov    %rax,%rdi
+  8031a3:	41 ff d0             	call   *%r8
+}
+  8031a6:	c9                   	leave
+  8031a7:	c3                   	ret
+
+00000000008031a8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031a8:	55                   	push   %rbp
+  8031a9:	48 89 e5             	mov    %rsp,%rbp
+  8031ac:	48 83 ec 30          	sub    $0x30,%rsp
+  8031b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8031b7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8031bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8031c2:	eb 49                	jmp    80320d <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8031c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031c7:	48 98                	cltq
+  8031c9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031cd:	48 29 c2             	sub    %rax,%rdx
+  8031d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031d3:	48 63 c8             	movslq %eax,%rcx
+  8031d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031da:	48 01 c1             	add    %rax,%rcx
+  8031dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031e0:	48 89 ce             	mov    %rcx,%rsi
+  8031e3:	89 c7                	mov    %eax,%edi
+  8031e5:	48 b8 a6 30 80 00 00 	movabs $0x8030a6,%rax
+  8031ec:	00 00 00 
+  8031ef:	ff d0                	call   *%rax
+  8031f1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8031f4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031f8:	79 07                	jns    803201 <readn+0x59>
+      return m;
+  8031fa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031fd:	48 98                	cltq
+  8031ff:	eb 1f                	jmp    803220 <readn+0x78>
+    if (m == 0)
+  803201:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803205:	74 13                	je     80321a <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803207:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80320a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80320d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803210:	48 98                	cltq
+  803212:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803216:	72 ac                	jb     8031c4 <readn+0x1c>
+  803218:	eb 01                	jmp    80321b <readn+0x73>
+      break;
+  80321a:	90                   	nop
+  }
+  return tot;
+  80321b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80321e:	48 98                	cltq
+}
+  803220:	c9                   	leave
+  803221:	c3                   	ret
+
+0000000000803222 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803222:	55                   	push   %rbp
+  803223:	48 89 e5             	mov    %rsp,%rbp
+  803226:	48 83 ec 40          	sub    $0x40,%rsp
+  80322a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80322d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803231:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803235:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803239:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80323c:	48 89 d6             	mov    %rdx,%rsi
+  80323f:	89 c7                	mov    %eax,%edi
+  803241:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+  80324d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803250:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803254:	78 24                	js     80327a <write+0x58>
+  803256:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80325a:	8b 00                	mov    (%rax),%eax
+  80325c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803260:	48 89 d6             	mov    %rdx,%rsi
+  803263:	89 c7                	mov    %eax,%edi
+  803265:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+  803271:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803274:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803278:	79 0a                	jns    803284 <write+0x62>
+    return r;
+  80327a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80327d:	48 98                	cltq
+  80327f:	e9 9d 00 00 00       	jmp    803321 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803284:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803288:	8b 40 08             	mov    0x8(%rax),%eax
+  80328b:	83 e0 03             	and    $0x3,%eax
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	75 5c                	jne    8032ee <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803292:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803299:	00 00 00 
+  80329c:	8b 40 04             	mov    0x4(%rax),%eax
+  80329f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032a4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032ab:	00 00 00 
+  8032ae:	48 98                	cltq
+  8032b0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032b7:	48 01 d0             	add    %rdx,%rax
+  8032ba:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032c0:	8b 00                	mov    (%rax),%eax
+  8032c2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8032c5:	89 c6                	mov    %eax,%esi
+  8032c7:	48 b8 bb 58 80 00 00 	movabs $0x8058bb,%rax
+  8032ce:	00 00 00 
+  8032d1:	48 89 c7             	mov    %rax,%rdi
+  8032d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d9:	48 b9 4f 04 80 00 00 	movabs $0x80044f,%rcx
+  8032e0:	00 00 00 
+  8032e3:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8032e5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032ec:	eb 33                	jmp    803321 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8032ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032f2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032f6:	48 85 c0             	test   %rax,%rax
+  8032f9:	75 09                	jne    803304 <write+0xe2>
+    return -E_NOT_SUPP;
+  8032fb:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803302:	eb 1d                	jmp    803321 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803304:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803308:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80330c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803310:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803314:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803318:	48 89 ce             	mov    %rcx,%rsi
+  80331b:	48 89 c7             	mov    %rax,%rdi
+  80331e:	41 ff d0             	call   *%r8
+}
+  803321:	c9                   	leave
+  803322:	c3                   	ret
+
+0000000000803323 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803323:	55                   	push   %rbp
+  803324:	48 89 e5             	mov    %rsp,%rbp
+  803327:	48 83 ec 18          	sub    $0x18,%rsp
+  80332b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80332e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803331:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803335:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803338:	48 89 d6             	mov    %rdx,%rsi
+  80333b:	89 c7                	mov    %eax,%edi
+  80333d:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+  803349:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80334c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803350:	79 05                	jns    803357 <seek+0x34>
+    return r;
+  803352:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803355:	eb 0f                	jmp    803366 <seek+0x43>
+  fd->fd_offset = offset;
+  803357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80335b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80335e:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803366:	c9                   	leave
+  803367:	c3                   	ret
+
+0000000000803368 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803368:	55                   	push   %rbp
+  803369:	48 89 e5             	mov    %rsp,%rbp
+  80336c:	48 83 ec 30          	sub    $0x30,%rsp
+  803370:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803373:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803376:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80337a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80337d:	48 89 d6             	mov    %rdx,%rsi
+  803380:	89 c7                	mov    %eax,%edi
+  803382:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803391:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803395:	78 24                	js     8033bb <ftruncate+0x53>
+  803397:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80339b:	8b 00                	mov    (%rax),%eax
+  80339d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033a1:	48 89 d6             	mov    %rdx,%rsi
+  8033a4:	89 c7                	mov    %eax,%edi
+  8033a6:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+  8033b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033b9:	79 08                	jns    8033c3 <ftruncate+0x5b>
+    return r;
+  8033bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033be:	e9 92 00 00 00       	jmp    803455 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033c7:	8b 40 08             	mov    0x8(%rax),%eax
+  8033ca:	83 e0 03             	and    $0x3,%eax
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	75 5a                	jne    80342b <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8033d1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033d8:	00 00 00 
+  8033db:	8b 40 04             	mov    0x4(%rax),%eax
+  8033de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033e3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033ea:	00 00 00 
+  8033ed:	48 98                	cltq
+  8033ef:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033f6:	48 01 d0             	add    %rdx,%rax
+  8033f9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033ff:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803401:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803404:	89 c6                	mov    %eax,%esi
+  803406:	48 b8 d8 58 80 00 00 	movabs $0x8058d8,%rax
+  80340d:	00 00 00 
+  803410:	48 89 c7             	mov    %rax,%rdi
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+  803418:	48 b9 4f 04 80 00 00 	movabs $0x80044f,%rcx
+  80341f:	00 00 00 
+  803422:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803424:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803429:	eb 2a                	jmp    803455 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80342b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803433:	48 85 c0             	test   %rax,%rax
+  803436:	75 07                	jne    80343f <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803438:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80343d:	eb 16                	jmp    803455 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80343f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803443:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803447:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80344e:	89 d6                	mov    %edx,%esi
+  803450:	48 89 c7             	mov    %rax,%rdi
+  803453:	ff d1                	call   *%rcx
+}
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+
+0000000000803457 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803457:	55                   	push   %rbp
+  803458:	48 89 e5             	mov    %rsp,%rbp
+  80345b:	48 83 ec 30          	sub    $0x30,%rsp
+  80345f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803462:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803466:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80346a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80346d:	48 89 d6             	mov    %rdx,%rsi
+  803470:	89 c7                	mov    %eax,%edi
+  803472:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  803479:	00 00 00 
+  80347c:	ff d0                	call   *%rax
+  80347e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803481:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803485:	78 24                	js     8034ab <fstat+0x54>
+  803487:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80348b:	8b 00                	mov    (%rax),%eax
+  80348d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803491:	48 89 d6             	mov    %rdx,%rsi
+  803494:	89 c7                	mov    %eax,%edi
+  803496:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+  8034a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034a9:	79 05                	jns    8034b0 <fstat+0x59>
+    return r;
+  8034ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034ae:	eb 5e                	jmp    80350e <fstat+0xb7>
+  if (!dev->dev_stat)
+  8034b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034b4:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034b8:	48 85 c0             	test   %rax,%rax
+  8034bb:	75 07                	jne    8034c4 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8034bd:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8034c2:	eb 4a                	jmp    80350e <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8034c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034c8:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8034cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034cf:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034d6:	00 00 00 
+  stat->st_isdir   = 0;
+  8034d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034dd:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034e4:	00 00 00 
+  stat->st_dev     = dev;
+  8034e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8034eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034ef:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8034f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034fa:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803502:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803506:	48 89 d6             	mov    %rdx,%rsi
+  803509:	48 89 c7             	mov    %rax,%rdi
+  80350c:	ff d1                	call   *%rcx
+}
+  80350e:	c9                   	leave
+  80350f:	c3                   	ret
+
+0000000000803510 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803510:	55                   	push   %rbp
+  803511:	48 89 e5             	mov    %rsp,%rbp
+  803514:	48 83 ec 10          	sub    $0x10,%rsp
+  803518:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80351c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803520:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803524:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80352a:	83 f8 20             	cmp    $0x20,%eax
+  80352d:	75 07                	jne    803536 <pollwait_key+0x26>
+    return -E_INVAL;
+  80352f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803534:	eb 5f                	jmp    803595 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803536:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80353a:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803544:	48 63 d2             	movslq %edx,%rdx
+  803547:	48 c1 e2 04          	shl    $0x4,%rdx
+  80354b:	48 01 c2             	add    %rax,%rdx
+  80354e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803552:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803559:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80355f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803563:	8b 00                	mov    (%rax),%eax
+  803565:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803569:	48 63 c9             	movslq %ecx,%rcx
+  80356c:	48 c1 e1 04          	shl    $0x4,%rcx
+  803570:	48 01 ca             	add    %rcx,%rdx
+  803573:	48 83 c2 08          	add    $0x8,%rdx
+  803577:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803579:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80357d:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803583:	8d 50 01             	lea    0x1(%rax),%edx
+  803586:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80358a:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803595:	c9                   	leave
+  803596:	c3                   	ret
+
+0000000000803597 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803597:	55                   	push   %rbp
+  803598:	48 89 e5             	mov    %rsp,%rbp
+  80359b:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8035a2:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8035a9:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8035af:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8035b6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8035bd:	00 
+  int i, r, ready, ipc = 0;
+  8035be:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8035c5:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8035cc:	00 
+  8035cd:	74 45                	je     803614 <poll+0x7d>
+  8035cf:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8035d6:	ff 
+  8035d7:	74 3b                	je     803614 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8035d9:	48 b8 d2 4a 80 00 00 	movabs $0x804ad2,%rax
+  8035e0:	00 00 00 
+  8035e3:	ff d0                	call   *%rax
+  8035e5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8035e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ed:	48 f7 d0             	not    %rax
+  8035f0:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8035f7:	73 10                	jae    803609 <poll+0x72>
+  8035f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035fd:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803604:	48 01 d0             	add    %rdx,%rax
+  803607:	eb 07                	jmp    803610 <poll+0x79>
+  803609:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803610:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803614:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80361b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803622:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803629:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803630:	e9 46 02 00 00       	jmp    80387b <poll+0x2e4>
+      fds[i].revents = 0;
+  803635:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803638:	48 63 d0             	movslq %eax,%rdx
+  80363b:	48 89 d0             	mov    %rdx,%rax
+  80363e:	48 01 c0             	add    %rax,%rax
+  803641:	48 01 d0             	add    %rdx,%rax
+  803644:	48 c1 e0 02          	shl    $0x2,%rax
+  803648:	48 89 c2             	mov    %rax,%rdx
+  80364b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803652:	48 01 d0             	add    %rdx,%rax
+  803655:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80365c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80365f:	48 63 d0             	movslq %eax,%rdx
+  803662:	48 89 d0             	mov    %rdx,%rax
+  803665:	48 01 c0             	add    %rax,%rax
+  803668:	48 01 d0             	add    %rdx,%rax
+  80366b:	48 c1 e0 02          	shl    $0x2,%rax
+  80366f:	48 89 c2             	mov    %rax,%rdx
+  803672:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803679:	48 01 d0             	add    %rdx,%rax
+  80367c:	8b 00                	mov    (%rax),%eax
+  80367e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803681:	75 62                	jne    8036e5 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803683:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803686:	48 63 d0             	movslq %eax,%rdx
+  803689:	48 89 d0             	mov    %rdx,%rax
+  80368c:	48 01 c0             	add    %rax,%rax
+  80368f:	48 01 d0             	add    %rdx,%rax
+  803692:	48 c1 e0 02          	shl    $0x2,%rax
+  803696:	48 89 c2             	mov    %rax,%rdx
+  803699:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036a0:	48 01 d0             	add    %rdx,%rax
+  8036a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8036a6:	83 e0 01             	and    $0x1,%eax
+  8036a9:	85 c0                	test   %eax,%eax
+  8036ab:	0f 84 9b 01 00 00    	je     80384c <poll+0x2b5>
+          fds[i].revents = ipc;
+  8036b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036b4:	48 63 d0             	movslq %eax,%rdx
+  8036b7:	48 89 d0             	mov    %rdx,%rax
+  8036ba:	48 01 c0             	add    %rax,%rax
+  8036bd:	48 01 d0             	add    %rdx,%rax
+  8036c0:	48 c1 e0 02          	shl    $0x2,%rax
+  8036c4:	48 89 c2             	mov    %rax,%rdx
+  8036c7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036ce:	48 01 c2             	add    %rax,%rdx
+  8036d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036d4:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8036d7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8036da:	83 c8 04             	or     $0x4,%eax
+  8036dd:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8036e0:	e9 67 01 00 00       	jmp    80384c <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036e8:	48 63 d0             	movslq %eax,%rdx
+  8036eb:	48 89 d0             	mov    %rdx,%rax
+  8036ee:	48 01 c0             	add    %rax,%rax
+  8036f1:	48 01 d0             	add    %rdx,%rax
+  8036f4:	48 c1 e0 02          	shl    $0x2,%rax
+  8036f8:	48 89 c2             	mov    %rax,%rdx
+  8036fb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803702:	48 01 d0             	add    %rdx,%rax
+  803705:	8b 00                	mov    (%rax),%eax
+  803707:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80370e:	48 89 d6             	mov    %rdx,%rsi
+  803711:	89 c7                	mov    %eax,%edi
+  803713:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	78 25                	js     803748 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803723:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80372a:	8b 00                	mov    (%rax),%eax
+  80372c:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803733:	48 89 d6             	mov    %rdx,%rsi
+  803736:	89 c7                	mov    %eax,%edi
+  803738:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803744:	85 c0                	test   %eax,%eax
+  803746:	79 2c                	jns    803774 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803748:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80374b:	48 63 d0             	movslq %eax,%rdx
+  80374e:	48 89 d0             	mov    %rdx,%rax
+  803751:	48 01 c0             	add    %rax,%rax
+  803754:	48 01 d0             	add    %rdx,%rax
+  803757:	48 c1 e0 02          	shl    $0x2,%rax
+  80375b:	48 89 c2             	mov    %rax,%rdx
+  80375e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803765:	48 01 d0             	add    %rdx,%rax
+  803768:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80376f:	e9 d8 00 00 00       	jmp    80384c <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803774:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80377b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80377f:	48 85 c0             	test   %rax,%rax
+  803782:	74 7d                	je     803801 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803784:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80378b:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80378f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803792:	48 63 d0             	movslq %eax,%rdx
+  803795:	48 89 d0             	mov    %rdx,%rax
+  803798:	48 01 c0             	add    %rax,%rax
+  80379b:	48 01 d0             	add    %rdx,%rax
+  80379e:	48 c1 e0 02          	shl    $0x2,%rax
+  8037a2:	48 89 c2             	mov    %rax,%rdx
+  8037a5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037ac:	48 01 d0             	add    %rdx,%rax
+  8037af:	8b 48 04             	mov    0x4(%rax),%ecx
+  8037b2:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8037b9:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8037c0:	89 ce                	mov    %ecx,%esi
+  8037c2:	48 89 c7             	mov    %rax,%rdi
+  8037c5:	41 ff d0             	call   *%r8
+  8037c8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8037cb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037cf:	79 08                	jns    8037d9 <poll+0x242>
+          return r;
+  8037d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037d4:	e9 45 01 00 00       	jmp    80391e <poll+0x387>
+        fds[i].revents = r;
+  8037d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037dc:	48 63 d0             	movslq %eax,%rdx
+  8037df:	48 89 d0             	mov    %rdx,%rax
+  8037e2:	48 01 c0             	add    %rax,%rax
+  8037e5:	48 01 d0             	add    %rdx,%rax
+  8037e8:	48 c1 e0 02          	shl    $0x2,%rax
+  8037ec:	48 89 c2             	mov    %rax,%rdx
+  8037ef:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037f6:	48 01 c2             	add    %rax,%rdx
+  8037f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037fc:	89 42 08             	mov    %eax,0x8(%rdx)
+  8037ff:	eb 4b                	jmp    80384c <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803801:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803804:	48 63 d0             	movslq %eax,%rdx
+  803807:	48 89 d0             	mov    %rdx,%rax
+  80380a:	48 01 c0             	add    %rax,%rax
+  80380d:	48 01 d0             	add    %rdx,%rax
+  803810:	48 c1 e0 02          	shl    $0x2,%rax
+  803814:	48 89 c2             	mov    %rax,%rdx
+  803817:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80381e:	48 01 d0             	add    %rdx,%rax
+  803821:	8b 48 04             	mov    0x4(%rax),%ecx
+  803824:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803827:	48 63 d0             	movslq %eax,%rdx
+  80382a:	48 89 d0             	mov    %rdx,%rax
+  80382d:	48 01 c0             	add    %rax,%rax
+  803830:	48 01 d0             	add    %rdx,%rax
+  803833:	48 c1 e0 02          	shl    $0x2,%rax
+  803837:	48 89 c2             	mov    %rax,%rdx
+  80383a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803841:	48 01 d0             	add    %rdx,%rax
+  803844:	83 e1 03             	and    $0x3,%ecx
+  803847:	89 ca                	mov    %ecx,%edx
+  803849:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80384c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384f:	48 63 d0             	movslq %eax,%rdx
+  803852:	48 89 d0             	mov    %rdx,%rax
+  803855:	48 01 c0             	add    %rax,%rax
+  803858:	48 01 d0             	add    %rdx,%rax
+  80385b:	48 c1 e0 02          	shl    $0x2,%rax
+  80385f:	48 89 c2             	mov    %rax,%rdx
+  803862:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803869:	48 01 d0             	add    %rdx,%rax
+  80386c:	8b 40 08             	mov    0x8(%rax),%eax
+  80386f:	85 c0                	test   %eax,%eax
+  803871:	74 04                	je     803877 <poll+0x2e0>
+        ready++;
+  803873:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803877:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80387b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80387e:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803884:	0f 8c ab fd ff ff    	jl     803635 <poll+0x9e>
+    }
+    if (ready)
+  80388a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80388e:	74 08                	je     803898 <poll+0x301>
+      return ready;
+  803890:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803893:	e9 86 00 00 00       	jmp    80391e <poll+0x387>
+
+    if (deadline) {
+  803898:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80389d:	74 30                	je     8038cf <poll+0x338>
+      now     = vsys_clock_ns();
+  80389f:	48 b8 d2 4a 80 00 00 	movabs $0x804ad2,%rax
+  8038a6:	00 00 00 
+  8038a9:	ff d0                	call   *%rax
+  8038ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8038af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038b3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8038b7:	73 0a                	jae    8038c3 <poll+0x32c>
+  8038b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038bd:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8038c1:	eb 05                	jmp    8038c8 <poll+0x331>
+  8038c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c8:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8038cf:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8038d2:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8038d5:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8038dc:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8038e3:	48 89 c7             	mov    %rax,%rdi
+  8038e6:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+  8038f2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8038f5:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8038f9:	75 07                	jne    803902 <poll+0x36b>
+      return 0;
+  8038fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803900:	eb 1c                	jmp    80391e <poll+0x387>
+    if (r < 0)
+  803902:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803906:	79 05                	jns    80390d <poll+0x376>
+      return r;
+  803908:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80390b:	eb 11                	jmp    80391e <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80390d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803910:	c1 f8 02             	sar    $0x2,%eax
+  803913:	83 e0 01             	and    $0x1,%eax
+  803916:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803919:	e9 f6 fc ff ff       	jmp    803614 <poll+0x7d>
+  }
+}
+  80391e:	c9                   	leave
+  80391f:	c3                   	ret
+
+0000000000803920 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+  803924:	48 83 ec 20          	sub    $0x20,%rsp
+  803928:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80392c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803934:	be 00 00 00 00       	mov    $0x0,%esi
+  803939:	48 89 c7             	mov    %rax,%rdi
+  80393c:	48 b8 0e 3a 80 00 00 	movabs $0x803a0e,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+  803948:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80394b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80394f:	79 05                	jns    803956 <stat+0x36>
+    return fd;
+  803951:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803954:	eb 2f                	jmp    803985 <stat+0x65>
+  r = fstat(fd, stat);
+  803956:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80395a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80395d:	48 89 d6             	mov    %rdx,%rsi
+  803960:	89 c7                	mov    %eax,%edi
+  803962:	48 b8 57 34 80 00 00 	movabs $0x803457,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+  80396e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803971:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803974:	89 c7                	mov    %eax,%edi
+  803976:	48 b8 bf 2d 80 00 00 	movabs $0x802dbf,%rax
+  80397d:	00 00 00 
+  803980:	ff d0                	call   *%rax
+  return r;
+  803982:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803985:	c9                   	leave
+  803986:	c3                   	ret
+
+0000000000803987 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803987:	55                   	push   %rbp
+  803988:	48 89 e5             	mov    %rsp,%rbp
+  80398b:	48 83 ec 10          	sub    $0x10,%rsp
+  80398f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803992:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803996:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80399d:	00 00 00 
+  8039a0:	8b 00                	mov    (%rax),%eax
+  8039a2:	85 c0                	test   %eax,%eax
+  8039a4:	75 1d                	jne    8039c3 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039a6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039ab:	48 b8 ed 50 80 00 00 	movabs $0x8050ed,%rax
+  8039b2:	00 00 00 
+  8039b5:	ff d0                	call   *%rax
+  8039b7:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8039be:	00 00 00 
+  8039c1:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8039c3:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8039ca:	00 00 00 
+  8039cd:	8b 00                	mov    (%rax),%eax
+  8039cf:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8039d2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039d7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039de:	00 00 00 
+  8039e1:	89 c7                	mov    %eax,%edi
+  8039e3:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  8039ea:	00 00 00 
+  8039ed:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8039ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039f8:	48 89 c6             	mov    %rax,%rsi
+  8039fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a00:	48 b8 c3 4e 80 00 00 	movabs $0x804ec3,%rax
+  803a07:	00 00 00 
+  803a0a:	ff d0                	call   *%rax
+}
+  803a0c:	c9                   	leave
+  803a0d:	c3                   	ret
+
+0000000000803a0e <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803a0e:	55                   	push   %rbp
+  803a0f:	48 89 e5             	mov    %rsp,%rbp
+  803a12:	48 83 ec 20          	sub    $0x20,%rsp
+  803a16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a1a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803a1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a21:	48 89 c7             	mov    %rax,%rdi
+  803a24:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803a2b:	00 00 00 
+  803a2e:	ff d0                	call   *%rax
+  803a30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a35:	7e 0a                	jle    803a41 <open+0x33>
+    return -E_BAD_PATH;
+  803a37:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a3c:	e9 a8 00 00 00       	jmp    803ae9 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a41:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a45:	48 89 c7             	mov    %rax,%rdi
+  803a48:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  803a4f:	00 00 00 
+  803a52:	ff d0                	call   *%rax
+  803a54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a5b:	79 08                	jns    803a65 <open+0x57>
+    return r;
+  803a5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a60:	e9 84 00 00 00       	jmp    803ae9 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a69:	48 89 c6             	mov    %rax,%rsi
+  803a6c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a73:	00 00 00 
+  803a76:	48 89 c7             	mov    %rax,%rdi
+  803a79:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803a85:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a8c:	00 00 00 
+  803a8f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a92:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9c:	48 89 c6             	mov    %rax,%rsi
+  803a9f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803aa4:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803aab:	00 00 00 
+  803aae:	ff d0                	call   *%rax
+  803ab0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ab3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ab7:	79 1d                	jns    803ad6 <open+0xc8>
+    fd_close(fd, 0);
+  803ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803abd:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac2:	48 89 c7             	mov    %rax,%rdi
+  803ac5:	48 b8 20 2c 80 00 00 	movabs $0x802c20,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+    return r;
+  803ad1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ad4:	eb 13                	jmp    803ae9 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803ad6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ada:	48 89 c7             	mov    %rax,%rdi
+  803add:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+}
+  803ae9:	c9                   	leave
+  803aea:	c3                   	ret
+
+0000000000803aeb <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803aeb:	55                   	push   %rbp
+  803aec:	48 89 e5             	mov    %rsp,%rbp
+  803aef:	48 83 ec 10          	sub    $0x10,%rsp
+  803af3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803afb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803afe:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b05:	00 00 00 
+  803b08:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  803b0f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b14:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803b1b:	00 00 00 
+  803b1e:	ff d0                	call   *%rax
+}
+  803b20:	c9                   	leave
+  803b21:	c3                   	ret
+
+0000000000803b22 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b22:	55                   	push   %rbp
+  803b23:	48 89 e5             	mov    %rsp,%rbp
+  803b26:	48 83 ec 30          	sub    $0x30,%rsp
+  803b2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b2e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b32:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b36:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803b3b:	74 07                	je     803b44 <devfile_read+0x22>
+  803b3d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b42:	75 0a                	jne    803b4e <devfile_read+0x2c>
+  return E_INVAL;
+  803b44:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b49:	e9 b4 00 00 00       	jmp    803c02 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b4e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b55:	00 
+  while (n) {
+  803b56:	e9 98 00 00 00       	jmp    803bf3 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803b5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b5f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b62:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b69:	00 00 00 
+  803b6c:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803b6e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b75:	00 00 00 
+  803b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b7c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803b80:	be 00 00 00 00       	mov    $0x0,%esi
+  803b85:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b8a:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+  803b96:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803b99:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b9d:	7f 13                	jg     803bb2 <devfile_read+0x90>
+      return res ? res : res0;
+  803b9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803ba3:	74 07                	je     803bac <devfile_read+0x8a>
+  803ba5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba8:	48 98                	cltq
+  803baa:	eb 56                	jmp    803c02 <devfile_read+0xe0>
+  803bac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bb0:	eb 50                	jmp    803c02 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803bb2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bb5:	48 63 d0             	movslq %eax,%rdx
+  803bb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bbc:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803bc3:	00 00 00 
+  803bc6:	48 89 ce             	mov    %rcx,%rsi
+  803bc9:	48 89 c7             	mov    %rax,%rdi
+  803bcc:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  803bd3:	00 00 00 
+  803bd6:	ff d0                	call   *%rax
+
+    buf += res;
+  803bd8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bdb:	48 98                	cltq
+  803bdd:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803be1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803be4:	48 98                	cltq
+  803be6:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803bea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bed:	48 98                	cltq
+  803bef:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803bf3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803bf8:	0f 85 5d ff ff ff    	jne    803b5b <devfile_read+0x39>
+  }
+
+  return res0;
+  803bfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803c02:	c9                   	leave
+  803c03:	c3                   	ret
+
+0000000000803c04 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803c04:	55                   	push   %rbp
+  803c05:	48 89 e5             	mov    %rsp,%rbp
+  803c08:	48 83 ec 50          	sub    $0x50,%rsp
+  803c0c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c10:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c14:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803c18:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c1d:	74 07                	je     803c26 <devfile_write+0x22>
+  803c1f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c24:	75 0a                	jne    803c30 <devfile_write+0x2c>
+  return E_INVAL;
+  803c26:	b8 03 00 00 00       	mov    $0x3,%eax
+  803c2b:	e9 c9 00 00 00       	jmp    803cf9 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803c30:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c37:	00 
+
+  while (n) {
+  803c38:	e9 ad 00 00 00       	jmp    803cea <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803c3d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c41:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c45:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c4c:	00 
+  803c4d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c55:	48 39 c2             	cmp    %rax,%rdx
+  803c58:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803c5c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803c60:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c64:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c68:	48 89 c6             	mov    %rax,%rsi
+  803c6b:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803c72:	00 00 00 
+  803c75:	48 89 c7             	mov    %rax,%rdi
+  803c78:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  803c7f:	00 00 00 
+  803c82:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c88:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c8b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c92:	00 00 00 
+  803c95:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803c97:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c9e:	00 00 00 
+  803ca1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ca5:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803ca9:	be 00 00 00 00       	mov    $0x0,%esi
+  803cae:	bf 04 00 00 00       	mov    $0x4,%edi
+  803cb3:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803cba:	00 00 00 
+  803cbd:	ff d0                	call   *%rax
+  803cbf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803cc2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803cc6:	79 07                	jns    803ccf <devfile_write+0xcb>
+      return res;
+  803cc8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ccb:	48 98                	cltq
+  803ccd:	eb 2a                	jmp    803cf9 <devfile_write+0xf5>
+
+    buf += res;
+  803ccf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cd2:	48 98                	cltq
+  803cd4:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803cd8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cdb:	48 98                	cltq
+  803cdd:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803ce1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ce4:	48 98                	cltq
+  803ce6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803cea:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803cef:	0f 85 48 ff ff ff    	jne    803c3d <devfile_write+0x39>
+  }
+
+  return res0;
+  803cf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803cf9:	c9                   	leave
+  803cfa:	c3                   	ret
+
+0000000000803cfb <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803cfb:	55                   	push   %rbp
+  803cfc:	48 89 e5             	mov    %rsp,%rbp
+  803cff:	48 83 ec 20          	sub    $0x20,%rsp
+  803d03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d07:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d0f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d12:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d19:	00 00 00 
+  803d1c:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d23:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d28:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803d2f:	00 00 00 
+  803d32:	ff d0                	call   *%rax
+  803d34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d3b:	79 05                	jns    803d42 <devfile_stat+0x47>
+    return r;
+  803d3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d40:	eb 59                	jmp    803d9b <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d46:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d4d:	00 00 00 
+  803d50:	48 89 d6             	mov    %rdx,%rsi
+  803d53:	48 89 c7             	mov    %rax,%rdi
+  803d56:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  803d5d:	00 00 00 
+  803d60:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803d62:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d69:	00 00 00 
+  803d6c:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803d72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d76:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d7c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d83:	00 00 00 
+  803d86:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803d8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d90:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803d96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d9b:	c9                   	leave
+  803d9c:	c3                   	ret
+
+0000000000803d9d <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d9d:	55                   	push   %rbp
+  803d9e:	48 89 e5             	mov    %rsp,%rbp
+  803da1:	48 83 ec 10          	sub    $0x10,%rsp
+  803da5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803da9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803db3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803dba:	00 00 00 
+  803dbd:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803dbf:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803dc6:	00 00 00 
+  803dc9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dcc:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  803dd4:	bf 02 00 00 00       	mov    $0x2,%edi
+  803dd9:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+}
+  803de5:	c9                   	leave
+  803de6:	c3                   	ret
+
+0000000000803de7 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803de7:	55                   	push   %rbp
+  803de8:	48 89 e5             	mov    %rsp,%rbp
+  803deb:	48 83 ec 18          	sub    $0x18,%rsp
+  803def:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803df3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803df6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803dfa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dfd:	83 e0 03             	and    $0x3,%eax
+}
+  803e00:	c9                   	leave
+  803e01:	c3                   	ret
+
+0000000000803e02 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803e02:	55                   	push   %rbp
+  803e03:	48 89 e5             	mov    %rsp,%rbp
+  803e06:	48 83 ec 10          	sub    $0x10,%rsp
+  803e0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803e0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e12:	48 89 c7             	mov    %rax,%rdi
+  803e15:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+  803e21:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e26:	7e 07                	jle    803e2f <remove+0x2d>
+    return -E_BAD_PATH;
+  803e28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803e2d:	eb 36                	jmp    803e65 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803e2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e33:	48 89 c6             	mov    %rax,%rsi
+  803e36:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803e3d:	00 00 00 
+  803e40:	48 89 c7             	mov    %rax,%rdi
+  803e43:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  803e4a:	00 00 00 
+  803e4d:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e54:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e59:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+}
+  803e65:	c9                   	leave
+  803e66:	c3                   	ret
+
+0000000000803e67 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803e67:	55                   	push   %rbp
+  803e68:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803e6b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e70:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e75:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803e7c:	00 00 00 
+  803e7f:	ff d0                	call   *%rax
+}
+  803e81:	5d                   	pop    %rbp
+  803e82:	c3                   	ret
+
+0000000000803e83 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803e83:	55                   	push   %rbp
+  803e84:	48 89 e5             	mov    %rsp,%rbp
+  803e87:	48 83 ec 20          	sub    $0x20,%rsp
+  803e8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803e8f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e94:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e99:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803ea0:	00 00 00 
+  803ea3:	ff d0                	call   *%rax
+  803ea5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ea8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803eac:	79 05                	jns    803eb3 <fs_stats+0x30>
+    return r;
+  803eae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eb1:	eb 2a                	jmp    803edd <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803eb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb7:	ba 68 00 00 00       	mov    $0x68,%edx
+  803ebc:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803ec3:	00 00 00 
+  803ec6:	48 89 ce             	mov    %rcx,%rsi
+  803ec9:	48 89 c7             	mov    %rax,%rdi
+  803ecc:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  803ed3:	00 00 00 
+  803ed6:	ff d0                	call   *%rax
+  return 0;
+  803ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803edd:	c9                   	leave
+  803ede:	c3                   	ret
+
+0000000000803edf <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803edf:	55                   	push   %rbp
+  803ee0:	48 89 e5             	mov    %rsp,%rbp
+  803ee3:	48 83 ec 10          	sub    $0x10,%rsp
+  803ee7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803eea:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ef1:	00 00 00 
+  803ef4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ef7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803ef9:	be 00 00 00 00       	mov    $0x0,%esi
+  803efe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803f03:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803f0a:	00 00 00 
+  803f0d:	ff d0                	call   *%rax
+}
+  803f0f:	c9                   	leave
+  803f10:	c3                   	ret
+
+0000000000803f11 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803f11:	55                   	push   %rbp
+  803f12:	48 89 e5             	mov    %rsp,%rbp
+  803f15:	48 83 ec 10          	sub    $0x10,%rsp
+  803f19:	89 f8                	mov    %edi,%eax
+  803f1b:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803f1e:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803f22:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f29:	00 00 00 
+  803f2c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  803f33:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803f38:	48 b8 87 39 80 00 00 	movabs $0x803987,%rax
+  803f3f:	00 00 00 
+  803f42:	ff d0                	call   *%rax
+}
+  803f44:	c9                   	leave
+  803f45:	c3                   	ret
+
+0000000000803f46 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803f46:	55                   	push   %rbp
+  803f47:	48 89 e5             	mov    %rsp,%rbp
+  803f4a:	48 83 ec 10          	sub    $0x10,%rsp
+  803f4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803f52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f56:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803f5b:	48 89 c7             	mov    %rax,%rdi
+  803f5e:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  803f65:	00 00 00 
+  803f68:	ff d0                	call   *%rax
+}
+  803f6a:	c9                   	leave
+  803f6b:	c3                   	ret
+
+0000000000803f6c <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803f6c:	55                   	push   %rbp
+  803f6d:	48 89 e5             	mov    %rsp,%rbp
+  803f70:	48 83 ec 50          	sub    $0x50,%rsp
+  803f74:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803f78:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803f7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803f83:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803f84:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803f89:	74 0a                	je     803f95 <pipe_size+0x29>
+  803f8b:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803f92:	00 
+  803f93:	76 0a                	jbe    803f9f <pipe_size+0x33>
+    return -E_INVAL;
+  803f95:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f9a:	e9 cc 02 00 00       	jmp    80426b <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803f9f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803fa3:	48 89 c7             	mov    %rax,%rdi
+  803fa6:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  803fad:	00 00 00 
+  803fb0:	ff d0                	call   *%rax
+  803fb2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fb5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fb9:	0f 88 a8 02 00 00    	js     804267 <pipe_size+0x2fb>
+  803fbf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fc3:	ba 07 04 00 00       	mov    $0x407,%edx
+  803fc8:	48 89 c6             	mov    %rax,%rsi
+  803fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd0:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  803fd7:	00 00 00 
+  803fda:	ff d0                	call   *%rax
+  803fdc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fdf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fe3:	0f 88 7e 02 00 00    	js     804267 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803fe9:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803fed:	48 89 c7             	mov    %rax,%rdi
+  803ff0:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+  803ffc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804003:	0f 88 43 02 00 00    	js     80424c <pipe_size+0x2e0>
+  804009:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80400d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804012:	48 89 c6             	mov    %rax,%rsi
+  804015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80401a:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  804021:	00 00 00 
+  804024:	ff d0                	call   *%rax
+  804026:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804029:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80402d:	0f 88 19 02 00 00    	js     80424c <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804033:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804037:	48 89 c7             	mov    %rax,%rdi
+  80403a:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+  804046:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80404a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804051:	00 
+  804052:	e9 a2 00 00 00       	jmp    8040f9 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804057:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80405b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80405f:	48 89 c2             	mov    %rax,%rdx
+  804062:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804066:	48 01 d0             	add    %rdx,%rax
+  804069:	ba 07 04 00 00       	mov    $0x407,%edx
+  80406e:	48 89 c6             	mov    %rax,%rsi
+  804071:	bf 00 00 00 00       	mov    $0x0,%edi
+  804076:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  80407d:	00 00 00 
+  804080:	ff d0                	call   *%rax
+  804082:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804085:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804089:	0f 88 37 01 00 00    	js     8041c6 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80408f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804093:	48 89 c7             	mov    %rax,%rdi
+  804096:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  80409d:	00 00 00 
+  8040a0:	ff d0                	call   *%rax
+  8040a2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040a6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8040aa:	48 01 c2             	add    %rax,%rdx
+  8040ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040b1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8040b5:	48 89 c1             	mov    %rax,%rcx
+  8040b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040bc:	48 01 c8             	add    %rcx,%rax
+  8040bf:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8040c5:	48 89 d1             	mov    %rdx,%rcx
+  8040c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040cd:	48 89 c6             	mov    %rax,%rsi
+  8040d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d5:	48 b8 25 22 80 00 00 	movabs $0x802225,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+  8040e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040e8:	79 0a                	jns    8040f4 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8040ea:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8040ef:	e9 d3 00 00 00       	jmp    8041c7 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8040f4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8040f9:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804100:	00 
+  804101:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804105:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804109:	48 01 d0             	add    %rdx,%rax
+  80410c:	48 83 c0 1f          	add    $0x1f,%rax
+  804110:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804114:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411d:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804121:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804125:	48 29 d0             	sub    %rdx,%rax
+  804128:	48 c1 e8 0c          	shr    $0xc,%rax
+  80412c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804130:	0f 82 21 ff ff ff    	jb     804057 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804136:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80413a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80413e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804142:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804146:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80414a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80414e:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804155:	00 00 00 
+  804158:	8b 12                	mov    (%rdx),%edx
+  80415a:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80415c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804160:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804167:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80416b:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804172:	00 00 00 
+  804175:	8b 12                	mov    (%rdx),%edx
+  804177:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804179:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80417d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804184:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804188:	48 89 c7             	mov    %rax,%rdi
+  80418b:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  804192:	00 00 00 
+  804195:	ff d0                	call   *%rax
+  804197:	89 c2                	mov    %eax,%edx
+  804199:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80419d:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80419f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041a3:	48 89 c7             	mov    %rax,%rdi
+  8041a6:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  8041ad:	00 00 00 
+  8041b0:	ff d0                	call   *%rax
+  8041b2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8041b6:	48 83 c2 04          	add    $0x4,%rdx
+  8041ba:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8041bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c1:	e9 a5 00 00 00       	jmp    80426b <pipe_size+0x2ff>
+      goto err2;
+  8041c6:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8041c7:	eb 58                	jmp    804221 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8041c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041cd:	48 c1 e0 0c          	shl    $0xc,%rax
+  8041d1:	48 89 c2             	mov    %rax,%rdx
+  8041d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d8:	48 01 d0             	add    %rdx,%rax
+  8041db:	48 89 c6             	mov    %rax,%rsi
+  8041de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041e3:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8041ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041f3:	48 89 c7             	mov    %rax,%rdi
+  8041f6:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  8041fd:	00 00 00 
+  804200:	ff d0                	call   *%rax
+  804202:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804206:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80420a:	48 01 d0             	add    %rdx,%rax
+  80420d:	48 89 c6             	mov    %rax,%rsi
+  804210:	bf 00 00 00 00       	mov    $0x0,%edi
+  804215:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  80421c:	00 00 00 
+  80421f:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804221:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804225:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804229:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80422d:	48 85 c0             	test   %rax,%rax
+  804230:	75 97                	jne    8041c9 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804232:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804236:	48 89 c6             	mov    %rax,%rsi
+  804239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423e:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  804245:	00 00 00 
+  804248:	ff d0                	call   *%rax
+  80424a:	eb 01                	jmp    80424d <pipe_size+0x2e1>
+    goto err1;
+  80424c:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80424d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804251:	48 89 c6             	mov    %rax,%rsi
+  804254:	bf 00 00 00 00       	mov    $0x0,%edi
+  804259:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  804260:	00 00 00 
+  804263:	ff d0                	call   *%rax
+  804265:	eb 01                	jmp    804268 <pipe_size+0x2fc>
+    goto err;
+  804267:	90                   	nop
+err:
+  return r;
+  804268:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80426b:	c9                   	leave
+  80426c:	c3                   	ret
+
+000000000080426d <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	53                   	push   %rbx
+  804272:	48 83 ec 28          	sub    $0x28,%rsp
+  804276:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80427a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80427e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804285:	00 00 00 
+  804288:	8b 40 04             	mov    0x4(%rax),%eax
+  80428b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804290:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804297:	00 00 00 
+  80429a:	48 98                	cltq
+  80429c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8042a3:	48 01 d0             	add    %rdx,%rax
+  8042a6:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8042ac:	8b 00                	mov    (%rax),%eax
+  8042ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8042b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042b5:	48 89 c7             	mov    %rax,%rdi
+  8042b8:	48 b8 5e 51 80 00 00 	movabs $0x80515e,%rax
+  8042bf:	00 00 00 
+  8042c2:	ff d0                	call   *%rax
+  8042c4:	89 c3                	mov    %eax,%ebx
+  8042c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042ca:	48 89 c7             	mov    %rax,%rdi
+  8042cd:	48 b8 5e 51 80 00 00 	movabs $0x80515e,%rax
+  8042d4:	00 00 00 
+  8042d7:	ff d0                	call   *%rax
+  8042d9:	39 c3                	cmp    %eax,%ebx
+  8042db:	0f 94 c0             	sete   %al
+  8042de:	0f b6 c0             	movzbl %al,%eax
+  8042e1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8042e4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042eb:	00 00 00 
+  8042ee:	8b 40 04             	mov    0x4(%rax),%eax
+  8042f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042f6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8042fd:	00 00 00 
+  804300:	48 98                	cltq
+  804302:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804309:	48 01 d0             	add    %rdx,%rax
+  80430c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804312:	8b 00                	mov    (%rax),%eax
+  804314:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804317:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80431a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80431d:	75 05                	jne    804324 <_pipeisclosed+0xb7>
+      return ret;
+  80431f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804322:	eb 68                	jmp    80438c <_pipeisclosed+0x11f>
+    if (n != nn)
+  804324:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804327:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80432a:	0f 84 4e ff ff ff    	je     80427e <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804330:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804337:	00 00 00 
+  80433a:	8b 40 04             	mov    0x4(%rax),%eax
+  80433d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804342:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804349:	00 00 00 
+  80434c:	48 98                	cltq
+  80434e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804355:	48 01 d0             	add    %rdx,%rax
+  804358:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80435e:	8b 10                	mov    (%rax),%edx
+  804360:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804363:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804366:	89 c6                	mov    %eax,%esi
+  804368:	48 b8 08 59 80 00 00 	movabs $0x805908,%rax
+  80436f:	00 00 00 
+  804372:	48 89 c7             	mov    %rax,%rdi
+  804375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437a:	49 b8 4f 04 80 00 00 	movabs $0x80044f,%r8
+  804381:	00 00 00 
+  804384:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804387:	e9 f2 fe ff ff       	jmp    80427e <_pipeisclosed+0x11>
+  }
+}
+  80438c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804390:	c9                   	leave
+  804391:	c3                   	ret
+
+0000000000804392 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804392:	55                   	push   %rbp
+  804393:	48 89 e5             	mov    %rsp,%rbp
+  804396:	48 83 ec 30          	sub    $0x30,%rsp
+  80439a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80439d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8043a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043a4:	48 89 d6             	mov    %rdx,%rsi
+  8043a7:	89 c7                	mov    %eax,%edi
+  8043a9:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  8043b0:	00 00 00 
+  8043b3:	ff d0                	call   *%rax
+  8043b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043bc:	79 05                	jns    8043c3 <pipeisclosed+0x31>
+    return r;
+  8043be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043c1:	eb 31                	jmp    8043f4 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8043c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043c7:	48 89 c7             	mov    %rax,%rdi
+  8043ca:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  8043d1:	00 00 00 
+  8043d4:	ff d0                	call   *%rax
+  8043d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8043da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043e2:	48 89 d6             	mov    %rdx,%rsi
+  8043e5:	48 89 c7             	mov    %rax,%rdi
+  8043e8:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+}
+  8043f4:	c9                   	leave
+  8043f5:	c3                   	ret
+
+00000000008043f6 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8043f6:	55                   	push   %rbp
+  8043f7:	48 89 e5             	mov    %rsp,%rbp
+  8043fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8043fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804402:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804406:	8b 40 18             	mov    0x18(%rax),%eax
+  804409:	8d 50 01             	lea    0x1(%rax),%edx
+  80440c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804410:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804417:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80441a:	85 c0                	test   %eax,%eax
+  80441c:	74 27                	je     804445 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80441e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804422:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80442d:	48 83 c0 18          	add    $0x18,%rax
+  804431:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804436:	48 89 c7             	mov    %rax,%rdi
+  804439:	48 b8 c8 25 80 00 00 	movabs $0x8025c8,%rax
+  804440:	00 00 00 
+  804443:	ff d0                	call   *%rax
+  }
+}
+  804445:	90                   	nop
+  804446:	c9                   	leave
+  804447:	c3                   	ret
+
+0000000000804448 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804448:	55                   	push   %rbp
+  804449:	48 89 e5             	mov    %rsp,%rbp
+  80444c:	48 83 ec 10          	sub    $0x10,%rsp
+  804450:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804454:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804457:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80445b:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804462:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804466:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80446a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80446d:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804474:	89 c6                	mov    %eax,%esi
+  804476:	48 89 cf             	mov    %rcx,%rdi
+  804479:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+}
+  804485:	90                   	nop
+  804486:	c9                   	leave
+  804487:	c3                   	ret
+
+0000000000804488 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804488:	55                   	push   %rbp
+  804489:	48 89 e5             	mov    %rsp,%rbp
+  80448c:	48 83 ec 70          	sub    $0x70,%rsp
+  804490:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804494:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804498:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80449c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044a0:	48 89 c7             	mov    %rax,%rdi
+  8044a3:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  8044aa:	00 00 00 
+  8044ad:	ff d0                	call   *%rax
+  8044af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8044b3:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8044b8:	75 0a                	jne    8044c4 <devpipe_read+0x3c>
+    return 0;
+  8044ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044bf:	e9 63 01 00 00       	jmp    804627 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8044c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044c8:	8b 40 18             	mov    0x18(%rax),%eax
+  8044cb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8044ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044d2:	48 8b 10             	mov    (%rax),%rdx
+  8044d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044dd:	48 39 c2             	cmp    %rax,%rdx
+  8044e0:	75 42                	jne    804524 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8044e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044ea:	48 89 d6             	mov    %rdx,%rsi
+  8044ed:	48 89 c7             	mov    %rax,%rdi
+  8044f0:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  8044f7:	00 00 00 
+  8044fa:	ff d0                	call   *%rax
+  8044fc:	85 c0                	test   %eax,%eax
+  8044fe:	74 0a                	je     80450a <devpipe_read+0x82>
+      return 0;
+  804500:	b8 00 00 00 00       	mov    $0x0,%eax
+  804505:	e9 1d 01 00 00       	jmp    804627 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80450a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80450d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804511:	89 d6                	mov    %edx,%esi
+  804513:	48 89 c7             	mov    %rax,%rdi
+  804516:	48 b8 48 44 80 00 00 	movabs $0x804448,%rax
+  80451d:	00 00 00 
+  804520:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804522:	eb a0                	jmp    8044c4 <devpipe_read+0x3c>
+      break;
+  804524:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804525:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804529:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80452d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804531:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804535:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804539:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80453d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804541:	48 8b 00             	mov    (%rax),%rax
+  804544:	48 29 c2             	sub    %rax,%rdx
+  804547:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80454b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80454f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804553:	48 39 c2             	cmp    %rax,%rdx
+  804556:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80455a:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80455e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804562:	48 8b 00             	mov    (%rax),%rax
+  804565:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804569:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80456d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804572:	48 f7 f1             	div    %rcx
+  804575:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804579:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80457d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804581:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804585:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804589:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80458d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804591:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804595:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804599:	48 39 c2             	cmp    %rax,%rdx
+  80459c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8045a0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8045a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a8:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8045ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045b0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8045b4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045bc:	48 89 ce             	mov    %rcx,%rsi
+  8045bf:	48 89 c7             	mov    %rax,%rdi
+  8045c2:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8045c9:	00 00 00 
+  8045cc:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8045ce:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045d2:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8045d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045da:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8045de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8045e2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045e6:	48 01 d1             	add    %rdx,%rcx
+  8045e9:	48 89 c2             	mov    %rax,%rdx
+  8045ec:	48 89 cf             	mov    %rcx,%rdi
+  8045ef:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8045f6:	00 00 00 
+  8045f9:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8045fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ff:	48 8b 10             	mov    (%rax),%rdx
+  804602:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804606:	48 01 c2             	add    %rax,%rdx
+  804609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80460d:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804614:	48 89 c7             	mov    %rax,%rdi
+  804617:	48 b8 f6 43 80 00 00 	movabs $0x8043f6,%rax
+  80461e:	00 00 00 
+  804621:	ff d0                	call   *%rax
+  return n;
+  804623:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804627:	c9                   	leave
+  804628:	c3                   	ret
+
+0000000000804629 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804629:	55                   	push   %rbp
+  80462a:	48 89 e5             	mov    %rsp,%rbp
+  80462d:	48 83 ec 70          	sub    $0x70,%rsp
+  804631:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804635:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804639:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80463d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804641:	48 89 c7             	mov    %rax,%rdi
+  804644:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  80464b:	00 00 00 
+  80464e:	ff d0                	call   *%rax
+  804650:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804654:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804658:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80465c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804663:	00 
+  804664:	e9 b8 01 00 00       	jmp    804821 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80466d:	8b 40 18             	mov    0x18(%rax),%eax
+  804670:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804673:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804677:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80467b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80467f:	48 8b 00             	mov    (%rax),%rax
+  804682:	48 29 c2             	sub    %rax,%rdx
+  804685:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804689:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80468d:	48 39 c2             	cmp    %rax,%rdx
+  804690:	75 4d                	jne    8046df <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804692:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804696:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80469a:	48 89 d6             	mov    %rdx,%rsi
+  80469d:	48 89 c7             	mov    %rax,%rdi
+  8046a0:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  8046a7:	00 00 00 
+  8046aa:	ff d0                	call   *%rax
+  8046ac:	85 c0                	test   %eax,%eax
+  8046ae:	74 0a                	je     8046ba <devpipe_write+0x91>
+        return 0;
+  8046b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b5:	e9 79 01 00 00       	jmp    804833 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8046ba:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8046bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046c1:	89 d6                	mov    %edx,%esi
+  8046c3:	48 89 c7             	mov    %rax,%rdi
+  8046c6:	48 b8 48 44 80 00 00 	movabs $0x804448,%rax
+  8046cd:	00 00 00 
+  8046d0:	ff d0                	call   *%rax
+      m = 0;
+  8046d2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8046d9:	00 
+      continue;
+  8046da:	e9 3a 01 00 00       	jmp    804819 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8046df:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046e3:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8046e7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8046eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8046f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f7:	48 8b 08             	mov    (%rax),%rcx
+  8046fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804702:	48 29 c1             	sub    %rax,%rcx
+  804705:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804709:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80470d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804711:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804715:	48 39 c2             	cmp    %rax,%rdx
+  804718:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80471c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804728:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80472c:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804730:	ba 00 00 00 00       	mov    $0x0,%edx
+  804735:	48 f7 f1             	div    %rcx
+  804738:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  80473c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804740:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804748:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80474c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804750:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804754:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804758:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80475c:	48 39 c2             	cmp    %rax,%rdx
+  80475f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804763:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804767:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80476b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80476f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804773:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804777:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80477b:	48 01 d1             	add    %rdx,%rcx
+  80477e:	48 89 c2             	mov    %rax,%rdx
+  804781:	48 89 cf             	mov    %rcx,%rdi
+  804784:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  80478b:	00 00 00 
+  80478e:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804794:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804798:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80479c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8047a0:	73 4d                	jae    8047ef <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8047a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047a6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8047ae:	48 29 c2             	sub    %rax,%rdx
+  8047b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b5:	48 01 c2             	add    %rax,%rdx
+  8047b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047bc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047c0:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8047c4:	48 89 c1             	mov    %rax,%rcx
+  8047c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047cb:	48 01 c1             	add    %rax,%rcx
+  8047ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047d2:	48 01 c1             	add    %rax,%rcx
+  8047d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047d9:	48 83 c0 20          	add    $0x20,%rax
+  8047dd:	48 89 ce             	mov    %rcx,%rsi
+  8047e0:	48 89 c7             	mov    %rax,%rdi
+  8047e3:	48 b8 48 1b 80 00 00 	movabs $0x801b48,%rax
+  8047ea:	00 00 00 
+  8047ed:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8047ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047fb:	48 01 c2             	add    %rax,%rdx
+  8047fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804802:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804806:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80480a:	48 89 c7             	mov    %rax,%rdi
+  80480d:	48 b8 f6 43 80 00 00 	movabs $0x8043f6,%rax
+  804814:	00 00 00 
+  804817:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804819:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80481d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804825:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804829:	0f 82 3a fe ff ff    	jb     804669 <devpipe_write+0x40>
+  }
+
+  return i;
+  80482f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804833:	c9                   	leave
+  804834:	c3                   	ret
+
+0000000000804835 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804835:	55                   	push   %rbp
+  804836:	48 89 e5             	mov    %rsp,%rbp
+  804839:	48 83 ec 40          	sub    $0x40,%rsp
+  80483d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804841:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804844:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80484c:	48 89 c7             	mov    %rax,%rdi
+  80484f:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  804856:	00 00 00 
+  804859:	ff d0                	call   *%rax
+  80485b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80485f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80486a:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80486e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804872:	48 89 d6             	mov    %rdx,%rsi
+  804875:	48 89 c7             	mov    %rax,%rdi
+  804878:	48 b8 10 35 80 00 00 	movabs $0x803510,%rax
+  80487f:	00 00 00 
+  804882:	ff d0                	call   *%rax
+  804884:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804887:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80488b:	79 08                	jns    804895 <devpipe_poll+0x60>
+    return r;
+  80488d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804890:	e9 85 00 00 00       	jmp    80491a <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804895:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804898:	83 e0 01             	and    $0x1,%eax
+  80489b:	85 c0                	test   %eax,%eax
+  80489d:	74 18                	je     8048b7 <devpipe_poll+0x82>
+  80489f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048a3:	48 8b 10             	mov    (%rax),%rdx
+  8048a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8048ae:	48 39 c2             	cmp    %rax,%rdx
+  8048b1:	74 04                	je     8048b7 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8048b3:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8048b7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8048ba:	83 e0 02             	and    $0x2,%eax
+  8048bd:	85 c0                	test   %eax,%eax
+  8048bf:	74 23                	je     8048e4 <devpipe_poll+0xaf>
+  8048c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8048c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048cd:	48 8b 00             	mov    (%rax),%rax
+  8048d0:	48 29 c2             	sub    %rax,%rdx
+  8048d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048db:	48 39 c2             	cmp    %rax,%rdx
+  8048de:	73 04                	jae    8048e4 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8048e0:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8048e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ec:	48 89 d6             	mov    %rdx,%rsi
+  8048ef:	48 89 c7             	mov    %rax,%rdi
+  8048f2:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  8048f9:	00 00 00 
+  8048fc:	ff d0                	call   *%rax
+  8048fe:	85 c0                	test   %eax,%eax
+  804900:	74 04                	je     804906 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804902:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804906:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80490a:	75 0b                	jne    804917 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80490c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804910:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804917:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80491a:	c9                   	leave
+  80491b:	c3                   	ret
+
+000000000080491c <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80491c:	55                   	push   %rbp
+  80491d:	48 89 e5             	mov    %rsp,%rbp
+  804920:	48 83 ec 20          	sub    $0x20,%rsp
+  804924:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804928:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80492c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804930:	48 89 c7             	mov    %rax,%rdi
+  804933:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  80493a:	00 00 00 
+  80493d:	ff d0                	call   *%rax
+  80493f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804943:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804947:	48 ba 39 59 80 00 00 	movabs $0x805939,%rdx
+  80494e:	00 00 00 
+  804951:	48 89 d6             	mov    %rdx,%rsi
+  804954:	48 89 c7             	mov    %rax,%rdi
+  804957:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  80495e:	00 00 00 
+  804961:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804967:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80496b:	89 c1                	mov    %eax,%ecx
+  80496d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804971:	48 8b 00             	mov    (%rax),%rax
+  804974:	89 c2                	mov    %eax,%edx
+  804976:	89 c8                	mov    %ecx,%eax
+  804978:	29 d0                	sub    %edx,%eax
+  80497a:	89 c2                	mov    %eax,%edx
+  80497c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804980:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804986:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80498a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804991:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804998:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  80499f:	00 00 00 
+  8049a2:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8049a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049ae:	c9                   	leave
+  8049af:	c3                   	ret
+
+00000000008049b0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8049b0:	55                   	push   %rbp
+  8049b1:	48 89 e5             	mov    %rsp,%rbp
+  8049b4:	48 83 ec 40          	sub    $0x40,%rsp
+  8049b8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8049bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049c0:	48 89 c7             	mov    %rax,%rdi
+  8049c3:	48 b8 3d 2a 80 00 00 	movabs $0x802a3d,%rax
+  8049ca:	00 00 00 
+  8049cd:	ff d0                	call   *%rax
+  8049cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8049d3:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8049da:	00 
+  8049db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049df:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049e7:	48 01 d0             	add    %rdx,%rax
+  8049ea:	48 83 c0 1f          	add    $0x1f,%rax
+  8049ee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8049f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049fb:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8049ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a03:	48 29 d0             	sub    %rdx,%rax
+  804a06:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a0a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804a0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a12:	48 89 c6             	mov    %rax,%rsi
+  804a15:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a1a:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  804a21:	00 00 00 
+  804a24:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a2a:	48 89 c7             	mov    %rax,%rdi
+  804a2d:	48 b8 f6 43 80 00 00 	movabs $0x8043f6,%rax
+  804a34:	00 00 00 
+  804a37:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804a41:	eb 2f                	jmp    804a72 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804a43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a47:	48 83 e8 01          	sub    $0x1,%rax
+  804a4b:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a4f:	48 89 c2             	mov    %rax,%rdx
+  804a52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a56:	48 01 d0             	add    %rdx,%rax
+  804a59:	48 89 c6             	mov    %rax,%rsi
+  804a5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a61:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  804a68:	00 00 00 
+  804a6b:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a6d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804a72:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804a77:	77 ca                	ja     804a43 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a7d:	48 89 c6             	mov    %rax,%rsi
+  804a80:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a85:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  804a8c:	00 00 00 
+  804a8f:	ff d0                	call   *%rax
+}
+  804a91:	c9                   	leave
+  804a92:	c3                   	ret
+
+0000000000804a93 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804a93:	55                   	push   %rbp
+  804a94:	48 89 e5             	mov    %rsp,%rbp
+  804a97:	48 83 ec 08          	sub    $0x8,%rsp
+  804a9b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804a9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804aa2:	75 10                	jne    804ab4 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804aa4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804aab:	00 00 00 
+  804aae:	8b 00                	mov    (%rax),%eax
+  804ab0:	48 98                	cltq
+  804ab2:	eb 05                	jmp    804ab9 <vsyscall+0x26>
+  }
+  return 0;
+  804ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ab9:	c9                   	leave
+  804aba:	c3                   	ret
+
+0000000000804abb <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804abb:	55                   	push   %rbp
+  804abc:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804abf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ac4:	48 b8 93 4a 80 00 00 	movabs $0x804a93,%rax
+  804acb:	00 00 00 
+  804ace:	ff d0                	call   *%rax
+}
+  804ad0:	5d                   	pop    %rbp
+  804ad1:	c3                   	ret
+
+0000000000804ad2 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804ad2:	55                   	push   %rbp
+  804ad3:	48 89 e5             	mov    %rsp,%rbp
+  804ad6:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804ada:	0f 31                	rdtsc
+  804adc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804adf:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804ae2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ae5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ae8:	48 c1 e2 20          	shl    $0x20,%rdx
+  804aec:	48 09 d0             	or     %rdx,%rax
+  804aef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804af3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804af7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804afb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b02:	00 00 00 
+  804b05:	8b 40 08             	mov    0x8(%rax),%eax
+  804b08:	48 98                	cltq
+  804b0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b17:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b1b:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b26:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b2b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b2f:	48 89 d0             	mov    %rdx,%rax
+  804b32:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b3e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b42:	48 01 c8             	add    %rcx,%rax
+}
+  804b45:	c9                   	leave
+  804b46:	c3                   	ret
+
+0000000000804b47 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804b47:	55                   	push   %rbp
+  804b48:	48 89 e5             	mov    %rsp,%rbp
+  804b4b:	48 83 ec 20          	sub    $0x20,%rsp
+  804b4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804b52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b55:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804b58:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804b5c:	be 01 00 00 00       	mov    $0x1,%esi
+  804b61:	48 89 c7             	mov    %rax,%rdi
+  804b64:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  804b6b:	00 00 00 
+  804b6e:	ff d0                	call   *%rax
+}
+  804b70:	90                   	nop
+  804b71:	c9                   	leave
+  804b72:	c3                   	ret
+
+0000000000804b73 <getchar>:
+
+int
+getchar(void) {
+  804b73:	55                   	push   %rbp
+  804b74:	48 89 e5             	mov    %rsp,%rbp
+  804b77:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804b7b:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804b7f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b84:	48 89 c6             	mov    %rax,%rsi
+  804b87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b8c:	48 b8 a6 30 80 00 00 	movabs $0x8030a6,%rax
+  804b93:	00 00 00 
+  804b96:	ff d0                	call   *%rax
+  804b98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804b9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b9f:	79 05                	jns    804ba6 <getchar+0x33>
+    return r;
+  804ba1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ba4:	eb 14                	jmp    804bba <getchar+0x47>
+  if (r < 1)
+  804ba6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804baa:	7f 07                	jg     804bb3 <getchar+0x40>
+    return -E_EOF;
+  804bac:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804bb1:	eb 07                	jmp    804bba <getchar+0x47>
+  return c;
+  804bb3:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804bb7:	0f b6 c0             	movzbl %al,%eax
+}
+  804bba:	c9                   	leave
+  804bbb:	c3                   	ret
+
+0000000000804bbc <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804bbc:	55                   	push   %rbp
+  804bbd:	48 89 e5             	mov    %rsp,%rbp
+  804bc0:	48 83 ec 20          	sub    $0x20,%rsp
+  804bc4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bc7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bce:	48 89 d6             	mov    %rdx,%rsi
+  804bd1:	89 c7                	mov    %eax,%edi
+  804bd3:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  804bda:	00 00 00 
+  804bdd:	ff d0                	call   *%rax
+  804bdf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804be2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804be6:	79 05                	jns    804bed <iscons+0x31>
+    return r;
+  804be8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804beb:	eb 1a                	jmp    804c07 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804bed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bf1:	8b 10                	mov    (%rax),%edx
+  804bf3:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804bfa:	00 00 00 
+  804bfd:	8b 00                	mov    (%rax),%eax
+  804bff:	39 c2                	cmp    %eax,%edx
+  804c01:	0f 94 c0             	sete   %al
+  804c04:	0f b6 c0             	movzbl %al,%eax
+}
+  804c07:	c9                   	leave
+  804c08:	c3                   	ret
+
+0000000000804c09 <opencons>:
+
+int
+opencons(void) {
+  804c09:	55                   	push   %rbp
+  804c0a:	48 89 e5             	mov    %rsp,%rbp
+  804c0d:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804c11:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804c15:	48 89 c7             	mov    %rax,%rdi
+  804c18:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  804c1f:	00 00 00 
+  804c22:	ff d0                	call   *%rax
+  804c24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c2b:	79 05                	jns    804c32 <opencons+0x29>
+    return r;
+  804c2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c30:	eb 66                	jmp    804c98 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c36:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c3b:	48 89 c6             	mov    %rax,%rsi
+  804c3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c43:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  804c4a:	00 00 00 
+  804c4d:	ff d0                	call   *%rax
+  804c4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c52:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c56:	79 05                	jns    804c5d <opencons+0x54>
+    return r;
+  804c58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c5b:	eb 3b                	jmp    804c98 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804c5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c61:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804c68:	00 00 00 
+  804c6b:	8b 12                	mov    (%rdx),%edx
+  804c6d:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804c6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c73:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804c7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c7e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804c85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c89:	48 89 c7             	mov    %rax,%rdi
+  804c8c:	48 b8 1a 2a 80 00 00 	movabs $0x802a1a,%rax
+  804c93:	00 00 00 
+  804c96:	ff d0                	call   *%rax
+}
+  804c98:	c9                   	leave
+  804c99:	c3                   	ret
+
+0000000000804c9a <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804c9a:	55                   	push   %rbp
+  804c9b:	48 89 e5             	mov    %rsp,%rbp
+  804c9e:	48 83 ec 20          	sub    $0x20,%rsp
+  804ca2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ca5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ca8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804cac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804caf:	48 89 d6             	mov    %rdx,%rsi
+  804cb2:	89 c7                	mov    %eax,%edi
+  804cb4:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  804cbb:	00 00 00 
+  804cbe:	ff d0                	call   *%rax
+  804cc0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cc3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cc7:	79 05                	jns    804cce <consmode+0x34>
+    return r;
+  804cc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ccc:	eb 34                	jmp    804d02 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804cce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cd2:	8b 10                	mov    (%rax),%edx
+  804cd4:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804cdb:	00 00 00 
+  804cde:	8b 00                	mov    (%rax),%eax
+  804ce0:	39 c2                	cmp    %eax,%edx
+  804ce2:	74 07                	je     804ceb <consmode+0x51>
+    return -E_INVAL;
+  804ce4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804ce9:	eb 17                	jmp    804d02 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804ceb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cef:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cf2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804cf5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cf9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804cfc:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d02:	c9                   	leave
+  804d03:	c3                   	ret
+
+0000000000804d04 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d04:	55                   	push   %rbp
+  804d05:	48 89 e5             	mov    %rsp,%rbp
+  804d08:	48 83 ec 20          	sub    $0x20,%rsp
+  804d0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d14:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804d18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d1c:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d1f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d27:	48 89 ce             	mov    %rcx,%rsi
+  804d2a:	48 89 c7             	mov    %rax,%rdi
+  804d2d:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  804d34:	00 00 00 
+  804d37:	ff d0                	call   *%rax
+  804d39:	48 98                	cltq
+}
+  804d3b:	c9                   	leave
+  804d3c:	c3                   	ret
+
+0000000000804d3d <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d3d:	55                   	push   %rbp
+  804d3e:	48 89 e5             	mov    %rsp,%rbp
+  804d41:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804d48:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804d4f:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804d56:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804d5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d64:	eb 74                	jmp    804dda <devcons_write+0x9d>
+    m = n - tot;
+  804d66:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804d6d:	89 c2                	mov    %eax,%edx
+  804d6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d72:	29 c2                	sub    %eax,%edx
+  804d74:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804d77:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d7a:	83 f8 7f             	cmp    $0x7f,%eax
+  804d7d:	76 07                	jbe    804d86 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804d7f:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804d86:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d89:	48 63 d0             	movslq %eax,%rdx
+  804d8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d8f:	48 63 c8             	movslq %eax,%rcx
+  804d92:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804d99:	48 01 c1             	add    %rax,%rcx
+  804d9c:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804da3:	48 89 ce             	mov    %rcx,%rsi
+  804da6:	48 89 c7             	mov    %rax,%rdi
+  804da9:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  804db0:	00 00 00 
+  804db3:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804db5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804db8:	48 63 d0             	movslq %eax,%rdx
+  804dbb:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804dc2:	48 89 d6             	mov    %rdx,%rsi
+  804dc5:	48 89 c7             	mov    %rax,%rdi
+  804dc8:	48 b8 b6 1f 80 00 00 	movabs $0x801fb6,%rax
+  804dcf:	00 00 00 
+  804dd2:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804dd4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804dd7:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804dda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ddd:	48 98                	cltq
+  804ddf:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804de6:	0f 82 7a ff ff ff    	jb     804d66 <devcons_write+0x29>
+  }
+  return tot;
+  804dec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804def:	48 98                	cltq
+}
+  804df1:	c9                   	leave
+  804df2:	c3                   	ret
+
+0000000000804df3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804df3:	55                   	push   %rbp
+  804df4:	48 89 e5             	mov    %rsp,%rbp
+  804df7:	48 83 ec 08          	sub    $0x8,%rsp
+  804dfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804dff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e04:	c9                   	leave
+  804e05:	c3                   	ret
+
+0000000000804e06 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e06:	55                   	push   %rbp
+  804e07:	48 89 e5             	mov    %rsp,%rbp
+  804e0a:	48 83 ec 10          	sub    $0x10,%rsp
+  804e0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e12:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804e16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e1a:	48 ba 45 59 80 00 00 	movabs $0x805945,%rdx
+  804e21:	00 00 00 
+  804e24:	48 89 d6             	mov    %rdx,%rsi
+  804e27:	48 89 c7             	mov    %rax,%rdi
+  804e2a:	48 b8 ff 13 80 00 00 	movabs $0x8013ff,%rax
+  804e31:	00 00 00 
+  804e34:	ff d0                	call   *%rax
+  return 0;
+  804e36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e3b:	c9                   	leave
+  804e3c:	c3                   	ret
+
+0000000000804e3d <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804e3d:	55                   	push   %rbp
+  804e3e:	48 89 e5             	mov    %rsp,%rbp
+  804e41:	48 83 ec 30          	sub    $0x30,%rsp
+  804e45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e49:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804e4c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804e50:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804e57:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e5a:	83 e0 02             	and    $0x2,%eax
+  804e5d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804e60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e64:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e67:	83 f8 01             	cmp    $0x1,%eax
+  804e6a:	75 04                	jne    804e70 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804e6c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804e70:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e73:	83 e0 01             	and    $0x1,%eax
+  804e76:	85 c0                	test   %eax,%eax
+  804e78:	74 44                	je     804ebe <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804e7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e82:	89 c2                	mov    %eax,%edx
+  804e84:	be 00 00 00 00       	mov    $0x0,%esi
+  804e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e8e:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  804e95:	00 00 00 
+  804e98:	ff d0                	call   *%rax
+  804e9a:	83 f8 01             	cmp    $0x1,%eax
+  804e9d:	75 06                	jne    804ea5 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804e9f:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804ea3:	eb 19                	jmp    804ebe <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804ea5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ea9:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804eaf:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804eb2:	89 c2                	mov    %eax,%edx
+  804eb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804eb8:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804ebe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804ec1:	c9                   	leave
+  804ec2:	c3                   	ret
+
+0000000000804ec3 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804ec3:	55                   	push   %rbp
+  804ec4:	48 89 e5             	mov    %rsp,%rbp
+  804ec7:	48 83 ec 20          	sub    $0x20,%rsp
+  804ecb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804ecf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804ed3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804ed7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804edb:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804edf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ee3:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804eea:	48 89 c7             	mov    %rax,%rdi
+  804eed:	48 b8 fb 4e 80 00 00 	movabs $0x804efb,%rax
+  804ef4:	00 00 00 
+  804ef7:	ff d0                	call   *%rax
+}
+  804ef9:	c9                   	leave
+  804efa:	c3                   	ret
+
+0000000000804efb <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804efb:	55                   	push   %rbp
+  804efc:	48 89 e5             	mov    %rsp,%rbp
+  804eff:	48 83 ec 30          	sub    $0x30,%rsp
+  804f03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804f07:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f0b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804f0f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804f13:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804f18:	75 0e                	jne    804f28 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804f1a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804f21:	00 00 00 
+  804f24:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804f28:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804f2d:	75 18                	jne    804f47 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804f2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f33:	48 89 c7             	mov    %rax,%rdi
+  804f36:	48 b8 0d 24 80 00 00 	movabs $0x80240d,%rax
+  804f3d:	00 00 00 
+  804f40:	ff d0                	call   *%rax
+  804f42:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f45:	eb 1d                	jmp    804f64 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804f47:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f4f:	48 89 d6             	mov    %rdx,%rsi
+  804f52:	48 89 c7             	mov    %rax,%rdi
+  804f55:	48 b8 53 24 80 00 00 	movabs $0x802453,%rax
+  804f5c:	00 00 00 
+  804f5f:	ff d0                	call   *%rax
+  804f61:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804f64:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f68:	79 2a                	jns    804f94 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804f6a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f6f:	74 0a                	je     804f7b <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804f71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f75:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804f7b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804f80:	74 0a                	je     804f8c <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804f82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f86:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804f8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f8f:	e9 aa 00 00 00       	jmp    80503e <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804f94:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f99:	74 36                	je     804fd1 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804f9b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fa2:	00 00 00 
+  804fa5:	8b 40 04             	mov    0x4(%rax),%eax
+  804fa8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804fad:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fb4:	00 00 00 
+  804fb7:	48 98                	cltq
+  804fb9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804fc0:	48 01 d0             	add    %rdx,%rax
+  804fc3:	48 05 24 01 00 00    	add    $0x124,%rax
+  804fc9:	8b 10                	mov    (%rax),%edx
+  804fcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcf:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804fd1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804fd6:	74 36                	je     80500e <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804fd8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fdf:	00 00 00 
+  804fe2:	8b 40 04             	mov    0x4(%rax),%eax
+  804fe5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804fea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ff1:	00 00 00 
+  804ff4:	48 98                	cltq
+  804ff6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ffd:	48 01 d0             	add    %rdx,%rax
+  805000:	48 05 28 01 00 00    	add    $0x128,%rax
+  805006:	8b 10                	mov    (%rax),%edx
+  805008:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80500c:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80500e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805015:	00 00 00 
+  805018:	8b 40 04             	mov    0x4(%rax),%eax
+  80501b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805020:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805027:	00 00 00 
+  80502a:	48 98                	cltq
+  80502c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805033:	48 01 d0             	add    %rdx,%rax
+  805036:	48 05 20 01 00 00    	add    $0x120,%rax
+  80503c:	8b 00                	mov    (%rax),%eax
+  }
+}
+  80503e:	c9                   	leave
+  80503f:	c3                   	ret
+
+0000000000805040 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805040:	55                   	push   %rbp
+  805041:	48 89 e5             	mov    %rsp,%rbp
+  805044:	48 83 ec 30          	sub    $0x30,%rsp
+  805048:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80504b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80504e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805052:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805055:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80505a:	75 5e                	jne    8050ba <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  80505c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805063:	00 00 00 
+  805066:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80506a:	eb 4e                	jmp    8050ba <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  80506c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805070:	79 3c                	jns    8050ae <ipc_send+0x6e>
+  805072:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805076:	74 36                	je     8050ae <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805078:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80507b:	89 c1                	mov    %eax,%ecx
+  80507d:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  805084:	00 00 00 
+  805087:	48 89 c2             	mov    %rax,%rdx
+  80508a:	be 54 00 00 00       	mov    $0x54,%esi
+  80508f:	48 b8 76 59 80 00 00 	movabs $0x805976,%rax
+  805096:	00 00 00 
+  805099:	48 89 c7             	mov    %rax,%rdi
+  80509c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050a1:	49 b8 30 02 80 00 00 	movabs $0x800230,%r8
+  8050a8:	00 00 00 
+  8050ab:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8050ae:	48 b8 90 21 80 00 00 	movabs $0x802190,%rax
+  8050b5:	00 00 00 
+  8050b8:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8050ba:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8050bd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8050c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050c7:	89 c7                	mov    %eax,%edi
+  8050c9:	48 b8 b6 23 80 00 00 	movabs $0x8023b6,%rax
+  8050d0:	00 00 00 
+  8050d3:	ff d0                	call   *%rax
+  8050d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8050d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050dc:	75 8e                	jne    80506c <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8050de:	48 b8 90 21 80 00 00 	movabs $0x802190,%rax
+  8050e5:	00 00 00 
+  8050e8:	ff d0                	call   *%rax
+}
+  8050ea:	90                   	nop
+  8050eb:	c9                   	leave
+  8050ec:	c3                   	ret
+
+00000000008050ed <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8050ed:	55                   	push   %rbp
+  8050ee:	48 89 e5             	mov    %rsp,%rbp
+  8050f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8050f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8050f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8050ff:	eb 4d                	jmp    80514e <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805101:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805108:	00 00 00 
+  80510b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80510e:	48 98                	cltq
+  805110:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805117:	48 01 d0             	add    %rdx,%rax
+  80511a:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805120:	8b 00                	mov    (%rax),%eax
+  805122:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805125:	75 23                	jne    80514a <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805127:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80512e:	00 00 00 
+  805131:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805134:	48 98                	cltq
+  805136:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80513d:	48 01 d0             	add    %rdx,%rax
+  805140:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805146:	8b 00                	mov    (%rax),%eax
+  805148:	eb 12                	jmp    80515c <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80514a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80514e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805155:	7e aa                	jle    805101 <ipc_find_env+0x14>
+  return 0;
+  805157:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80515c:	c9                   	leave
+  80515d:	c3                   	ret
+
+000000000080515e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80515e:	55                   	push   %rbp
+  80515f:	48 89 e5             	mov    %rsp,%rbp
+  805162:	48 83 ec 18          	sub    $0x18,%rsp
+  805166:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80516a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80516e:	48 c1 e8 27          	shr    $0x27,%rax
+  805172:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805177:	48 89 c2             	mov    %rax,%rdx
+  80517a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805181:	01 00 00 
+  805184:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805188:	83 e0 01             	and    $0x1,%eax
+  80518b:	48 85 c0             	test   %rax,%rax
+  80518e:	74 63                	je     8051f3 <pageref+0x95>
+  805190:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805194:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805198:	48 89 c2             	mov    %rax,%rdx
+  80519b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8051a2:	01 00 00 
+  8051a5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051a9:	83 e0 01             	and    $0x1,%eax
+  8051ac:	48 85 c0             	test   %rax,%rax
+  8051af:	74 42                	je     8051f3 <pageref+0x95>
+  8051b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8051b9:	48 89 c2             	mov    %rax,%rdx
+  8051bc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8051c3:	01 00 00 
+  8051c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051ca:	83 e0 01             	and    $0x1,%eax
+  8051cd:	48 85 c0             	test   %rax,%rax
+  8051d0:	74 21                	je     8051f3 <pageref+0x95>
+  8051d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051da:	48 89 c2             	mov    %rax,%rdx
+  8051dd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8051e4:	01 00 00 
+  8051e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051eb:	83 e0 01             	and    $0x1,%eax
+  8051ee:	48 85 c0             	test   %rax,%rax
+  8051f1:	75 07                	jne    8051fa <pageref+0x9c>
+    return 0;
+  8051f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f8:	eb 53                	jmp    80524d <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8051fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  805202:	48 89 c2             	mov    %rax,%rdx
+  805205:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80520c:	01 00 00 
+  80520f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805213:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80521b:	83 e0 01             	and    $0x1,%eax
+  80521e:	48 85 c0             	test   %rax,%rax
+  805221:	75 07                	jne    80522a <pageref+0xcc>
+    return 0;
+  805223:	b8 00 00 00 00       	mov    $0x0,%eax
+  805228:	eb 23                	jmp    80524d <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80522a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80522e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805232:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805239:	00 00 00 
+  80523c:	48 c1 e0 04          	shl    $0x4,%rax
+  805240:	48 01 d0             	add    %rdx,%rax
+  805243:	48 83 c0 08          	add    $0x8,%rax
+  805247:	0f b7 00             	movzwl (%rax),%eax
+  80524a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80524d:	c9                   	leave
+  80524e:	c3                   	ret
+  80524f:	90                   	nop
@@ -0,0 +1,8323 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 2a 01 00 00       	call   800156 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <handler>:
+// doesn't work because we sys_cputs instead of cprintf (exercise: why?)
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  80003a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int r;
+  void *addr = (void *)utf->utf_fault_va;
+  80003e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800042:	48 8b 00             	mov    (%rax),%rax
+  800045:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  cprintf("fault %lx\n", (unsigned long)addr);
+  800049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80004d:	48 89 c6             	mov    %rax,%rsi
+  800050:	48 b8 20 52 80 00 00 	movabs $0x805220,%rax
+  800057:	00 00 00 
+  80005a:	48 89 c7             	mov    %rax,%rdi
+  80005d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800062:	48 ba 1c 04 80 00 00 	movabs $0x80041c,%rdx
+  800069:	00 00 00 
+  80006c:	ff d2                	call   *%rdx
+  if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80006e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800072:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800076:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80007a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800080:	ba 07 00 00 00       	mov    $0x7,%edx
+  800085:	48 89 c6             	mov    %rax,%rsi
+  800088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008d:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  800094:	00 00 00 
+  800097:	ff d0                	call   *%rax
+  800099:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80009c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a0:	79 3e                	jns    8000e0 <handler+0xae>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+    panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000a6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000a9:	41 89 d0             	mov    %edx,%r8d
+  8000ac:	48 89 c1             	mov    %rax,%rcx
+  8000af:	48 b8 30 52 80 00 00 	movabs $0x805230,%rax
+  8000b6:	00 00 00 
+  8000b9:	48 89 c2             	mov    %rax,%rdx
+  8000bc:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000c1:	48 b8 5c 52 80 00 00 	movabs $0x80525c,%rax
+  8000c8:	00 00 00 
+  8000cb:	48 89 c7             	mov    %rax,%rdi
+  8000ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d3:	49 b9 fd 01 80 00 00 	movabs $0x8001fd,%r9
+  8000da:	00 00 00 
+  8000dd:	41 ff d1             	call   *%r9
+  snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  8000e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8000e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000e8:	48 89 d1             	mov    %rdx,%rcx
+  8000eb:	48 ba 78 52 80 00 00 	movabs $0x805278,%rdx
+  8000f2:	00 00 00 
+  8000f5:	be 64 00 00 00       	mov    $0x64,%esi
+  8000fa:	48 89 c7             	mov    %rax,%rdi
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	49 b8 06 0e 80 00 00 	movabs $0x800e06,%r8
+  800109:	00 00 00 
+  80010c:	41 ff d0             	call   *%r8
+}
+  80010f:	90                   	nop
+  800110:	c9                   	leave
+  800111:	c3                   	ret
+
+0000000000800112 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	48 83 ec 10          	sub    $0x10,%rsp
+  80011a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80011d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  set_pgfault_handler(handler);
+  800121:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800128:	00 00 00 
+  80012b:	48 89 c7             	mov    %rax,%rdi
+  80012e:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+  sys_cputs((char *)0xDEADBEEF, 4);
+  80013a:	be 04 00 00 00       	mov    $0x4,%esi
+  80013f:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  800144:	48 89 c7             	mov    %rax,%rdi
+  800147:	48 b8 83 1f 80 00 00 	movabs $0x801f83,%rax
+  80014e:	00 00 00 
+  800151:	ff d0                	call   *%rax
+}
+  800153:	90                   	nop
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+0000000000800156 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	48 83 ec 20          	sub    $0x20,%rsp
+  80015e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800161:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800165:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80016c:	00 00 00 
+  80016f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800173:	eb 13                	jmp    800188 <libmain+0x32>
+    (*ctor)();
+  800175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800179:	48 8b 10             	mov    (%rax),%rdx
+  80017c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800181:	ff d2                	call   *%rdx
+    ctor++;
+  800183:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800188:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80018f:	00 00 00 
+  800192:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800196:	72 dd                	jb     800175 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800198:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80019c:	7e 14                	jle    8001b2 <libmain+0x5c>
+    binaryname = argv[0];
+  80019e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001a2:	48 8b 00             	mov    (%rax),%rax
+  8001a5:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8001ac:	00 00 00 
+  8001af:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001b9:	48 89 d6             	mov    %rdx,%rsi
+  8001bc:	89 c7                	mov    %eax,%edi
+  8001be:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001ca:	48 b8 d9 01 80 00 00 	movabs $0x8001d9,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+#endif
+}
+  8001d6:	90                   	nop
+  8001d7:	c9                   	leave
+  8001d8:	c3                   	ret
+
+00000000008001d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001dd:	48 b8 d7 2d 80 00 00 	movabs $0x802dd7,%rax
+  8001e4:	00 00 00 
+  8001e7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ee:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  8001f5:	00 00 00 
+  8001f8:	ff d0                	call   *%rax
+}
+  8001fa:	90                   	nop
+  8001fb:	5d                   	pop    %rbp
+  8001fc:	c3                   	ret
+
+00000000008001fd <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001fd:	55                   	push   %rbp
+  8001fe:	48 89 e5             	mov    %rsp,%rbp
+  800201:	53                   	push   %rbx
+  800202:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800209:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800210:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800216:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80021d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800224:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80022b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800232:	84 c0                	test   %al,%al
+  800234:	74 23                	je     800259 <_panic+0x5c>
+  800236:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80023d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800241:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800245:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800249:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80024d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800251:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800255:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800259:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800260:	00 00 00 
+  800263:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80026a:	00 00 00 
+  80026d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800271:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800278:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80027f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800286:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80028d:	00 00 00 
+  800290:	48 8b 18             	mov    (%rax),%rbx
+  800293:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+  80029f:	89 c6                	mov    %eax,%esi
+  8002a1:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8002a7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8002ae:	41 89 d0             	mov    %edx,%r8d
+  8002b1:	48 89 c1             	mov    %rax,%rcx
+  8002b4:	48 89 da             	mov    %rbx,%rdx
+  8002b7:	48 b8 a8 52 80 00 00 	movabs $0x8052a8,%rax
+  8002be:	00 00 00 
+  8002c1:	48 89 c7             	mov    %rax,%rdi
+  8002c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c9:	49 b9 1c 04 80 00 00 	movabs $0x80041c,%r9
+  8002d0:	00 00 00 
+  8002d3:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8002d6:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8002dd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8002e4:	48 89 d6             	mov    %rdx,%rsi
+  8002e7:	48 89 c7             	mov    %rax,%rdi
+  8002ea:	48 b8 91 03 80 00 00 	movabs $0x800391,%rax
+  8002f1:	00 00 00 
+  8002f4:	ff d0                	call   *%rax
+  cprintf("\n");
+  8002f6:	48 b8 cb 52 80 00 00 	movabs $0x8052cb,%rax
+  8002fd:	00 00 00 
+  800300:	48 89 c7             	mov    %rax,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	48 ba 1c 04 80 00 00 	movabs $0x80041c,%rdx
+  80030f:	00 00 00 
+  800312:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800314:	cc                   	int3
+  800315:	eb fd                	jmp    800314 <_panic+0x117>
+
+0000000000800317 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800317:	55                   	push   %rbp
+  800318:	48 89 e5             	mov    %rsp,%rbp
+  80031b:	48 83 ec 10          	sub    $0x10,%rsp
+  80031f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800322:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800326:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80032a:	8b 00                	mov    (%rax),%eax
+  80032c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80032f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800333:	89 0a                	mov    %ecx,(%rdx)
+  800335:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800338:	89 d1                	mov    %edx,%ecx
+  80033a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80033e:	48 98                	cltq
+  800340:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800344:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800348:	8b 00                	mov    (%rax),%eax
+  80034a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80034f:	75 2c                	jne    80037d <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800355:	8b 00                	mov    (%rax),%eax
+  800357:	48 98                	cltq
+  800359:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80035d:	48 83 c2 08          	add    $0x8,%rdx
+  800361:	48 89 c6             	mov    %rax,%rsi
+  800364:	48 89 d7             	mov    %rdx,%rdi
+  800367:	48 b8 83 1f 80 00 00 	movabs $0x801f83,%rax
+  80036e:	00 00 00 
+  800371:	ff d0                	call   *%rax
+    b->idx = 0;
+  800373:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800377:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80037d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800381:	8b 40 04             	mov    0x4(%rax),%eax
+  800384:	8d 50 01             	lea    0x1(%rax),%edx
+  800387:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80038b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80038e:	90                   	nop
+  80038f:	c9                   	leave
+  800390:	c3                   	ret
+
+0000000000800391 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800391:	55                   	push   %rbp
+  800392:	48 89 e5             	mov    %rsp,%rbp
+  800395:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80039c:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8003a3:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8003aa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003b1:	00 00 00 
+  b.cnt = 0;
+  8003b4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003bb:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8003be:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8003c5:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8003cc:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8003d3:	48 89 c6             	mov    %rax,%rsi
+  8003d6:	48 b8 17 03 80 00 00 	movabs $0x800317,%rax
+  8003dd:	00 00 00 
+  8003e0:	48 89 c7             	mov    %rax,%rdi
+  8003e3:	48 b8 76 07 80 00 00 	movabs $0x800776,%rax
+  8003ea:	00 00 00 
+  8003ed:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8003ef:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8003f5:	48 98                	cltq
+  8003f7:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8003fe:	48 83 c2 08          	add    $0x8,%rdx
+  800402:	48 89 c6             	mov    %rax,%rsi
+  800405:	48 89 d7             	mov    %rdx,%rdi
+  800408:	48 b8 83 1f 80 00 00 	movabs $0x801f83,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800414:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80041a:	c9                   	leave
+  80041b:	c3                   	ret
+
+000000000080041c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800427:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80042e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800435:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80043c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800443:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80044a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800451:	84 c0                	test   %al,%al
+  800453:	74 20                	je     800475 <cprintf+0x59>
+  800455:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800459:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80045d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800461:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800465:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800469:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80046d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800471:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800475:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80047c:	00 00 00 
+  80047f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800486:	00 00 00 
+  800489:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800494:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80049b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8004a2:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8004a9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8004b0:	48 89 d6             	mov    %rdx,%rsi
+  8004b3:	48 89 c7             	mov    %rax,%rdi
+  8004b6:	48 b8 91 03 80 00 00 	movabs $0x800391,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+  8004c2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8004c8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004ce:	c9                   	leave
+  8004cf:	c3                   	ret
+
+00000000008004d0 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8004d0:	55                   	push   %rbp
+  8004d1:	48 89 e5             	mov    %rsp,%rbp
+  8004d4:	48 83 ec 30          	sub    $0x30,%rsp
+  8004d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8004e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8004e4:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8004e7:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8004eb:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8004ef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004f2:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8004f6:	72 54                	jb     80054c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004f8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004fb:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8004fe:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800501:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050a:	48 f7 f6             	div    %rsi
+  80050d:	49 89 c2             	mov    %rax,%r10
+  800510:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800513:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800516:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80051a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80051e:	41 89 c9             	mov    %ecx,%r9d
+  800521:	41 89 f8             	mov    %edi,%r8d
+  800524:	89 d1                	mov    %edx,%ecx
+  800526:	4c 89 d2             	mov    %r10,%rdx
+  800529:	48 89 c7             	mov    %rax,%rdi
+  80052c:	48 b8 d0 04 80 00 00 	movabs $0x8004d0,%rax
+  800533:	00 00 00 
+  800536:	ff d0                	call   *%rax
+  800538:	eb 1c                	jmp    800556 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80053a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80053e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800541:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800545:	48 89 d6             	mov    %rdx,%rsi
+  800548:	89 c7                	mov    %eax,%edi
+  80054a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80054c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800550:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800554:	7f e4                	jg     80053a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800556:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80055d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800562:	48 f7 f1             	div    %rcx
+  800565:	48 b8 10 55 80 00 00 	movabs $0x805510,%rax
+  80056c:	00 00 00 
+  80056f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800573:	0f be c0             	movsbl %al,%eax
+  800576:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80057a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80057e:	48 89 d6             	mov    %rdx,%rsi
+  800581:	89 c7                	mov    %eax,%edi
+  800583:	ff d1                	call   *%rcx
+}
+  800585:	90                   	nop
+  800586:	c9                   	leave
+  800587:	c3                   	ret
+
+0000000000800588 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800588:	55                   	push   %rbp
+  800589:	48 89 e5             	mov    %rsp,%rbp
+  80058c:	48 83 ec 10          	sub    $0x10,%rsp
+  800590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800594:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800597:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80059b:	7e 4b                	jle    8005e8 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80059d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a1:	8b 00                	mov    (%rax),%eax
+  8005a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005a6:	77 24                	ja     8005cc <getuint+0x44>
+  8005a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b4:	8b 00                	mov    (%rax),%eax
+  8005b6:	89 c0                	mov    %eax,%eax
+  8005b8:	48 01 d0             	add    %rdx,%rax
+  8005bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005bf:	8b 12                	mov    (%rdx),%edx
+  8005c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c8:	89 0a                	mov    %ecx,(%rdx)
+  8005ca:	eb 14                	jmp    8005e0 <getuint+0x58>
+  8005cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005e0:	48 8b 00             	mov    (%rax),%rax
+  8005e3:	e9 95 00 00 00       	jmp    80067d <getuint+0xf5>
+  else if (lflag)
+  8005e8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005ec:	74 48                	je     800636 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8005ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f2:	8b 00                	mov    (%rax),%eax
+  8005f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f7:	77 24                	ja     80061d <getuint+0x95>
+  8005f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800601:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800605:	8b 00                	mov    (%rax),%eax
+  800607:	89 c0                	mov    %eax,%eax
+  800609:	48 01 d0             	add    %rdx,%rax
+  80060c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800610:	8b 12                	mov    (%rdx),%edx
+  800612:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800615:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800619:	89 0a                	mov    %ecx,(%rdx)
+  80061b:	eb 14                	jmp    800631 <getuint+0xa9>
+  80061d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800621:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800625:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800629:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80062d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800631:	48 8b 00             	mov    (%rax),%rax
+  800634:	eb 47                	jmp    80067d <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800636:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80063a:	8b 00                	mov    (%rax),%eax
+  80063c:	83 f8 2f             	cmp    $0x2f,%eax
+  80063f:	77 24                	ja     800665 <getuint+0xdd>
+  800641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800645:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800649:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80064d:	8b 00                	mov    (%rax),%eax
+  80064f:	89 c0                	mov    %eax,%eax
+  800651:	48 01 d0             	add    %rdx,%rax
+  800654:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800658:	8b 12                	mov    (%rdx),%edx
+  80065a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80065d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800661:	89 0a                	mov    %ecx,(%rdx)
+  800663:	eb 14                	jmp    800679 <getuint+0xf1>
+  800665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800669:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80066d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800671:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800675:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800679:	8b 00                	mov    (%rax),%eax
+  80067b:	89 c0                	mov    %eax,%eax
+}
+  80067d:	c9                   	leave
+  80067e:	c3                   	ret
+
+000000000080067f <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80067f:	55                   	push   %rbp
+  800680:	48 89 e5             	mov    %rsp,%rbp
+  800683:	48 83 ec 10          	sub    $0x10,%rsp
+  800687:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80068b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80068e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800692:	7e 4b                	jle    8006df <getint+0x60>
+    return va_arg(*ap, long long);
+  800694:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800698:	8b 00                	mov    (%rax),%eax
+  80069a:	83 f8 2f             	cmp    $0x2f,%eax
+  80069d:	77 24                	ja     8006c3 <getint+0x44>
+  80069f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ab:	8b 00                	mov    (%rax),%eax
+  8006ad:	89 c0                	mov    %eax,%eax
+  8006af:	48 01 d0             	add    %rdx,%rax
+  8006b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006b6:	8b 12                	mov    (%rdx),%edx
+  8006b8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006bf:	89 0a                	mov    %ecx,(%rdx)
+  8006c1:	eb 14                	jmp    8006d7 <getint+0x58>
+  8006c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006cb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006d3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006d7:	48 8b 00             	mov    (%rax),%rax
+  8006da:	e9 95 00 00 00       	jmp    800774 <getint+0xf5>
+  else if (lflag)
+  8006df:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006e3:	74 48                	je     80072d <getint+0xae>
+    return va_arg(*ap, long);
+  8006e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006e9:	8b 00                	mov    (%rax),%eax
+  8006eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ee:	77 24                	ja     800714 <getint+0x95>
+  8006f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fc:	8b 00                	mov    (%rax),%eax
+  8006fe:	89 c0                	mov    %eax,%eax
+  800700:	48 01 d0             	add    %rdx,%rax
+  800703:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800707:	8b 12                	mov    (%rdx),%edx
+  800709:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80070c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800710:	89 0a                	mov    %ecx,(%rdx)
+  800712:	eb 14                	jmp    800728 <getint+0xa9>
+  800714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800718:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80071c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800720:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800724:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800728:	48 8b 00             	mov    (%rax),%rax
+  80072b:	eb 47                	jmp    800774 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80072d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800731:	8b 00                	mov    (%rax),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 24                	ja     80075c <getint+0xdd>
+  800738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80073c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800744:	8b 00                	mov    (%rax),%eax
+  800746:	89 c0                	mov    %eax,%eax
+  800748:	48 01 d0             	add    %rdx,%rax
+  80074b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80074f:	8b 12                	mov    (%rdx),%edx
+  800751:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800754:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800758:	89 0a                	mov    %ecx,(%rdx)
+  80075a:	eb 14                	jmp    800770 <getint+0xf1>
+  80075c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800760:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800764:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800768:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80076c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800770:	8b 00                	mov    (%rax),%eax
+  800772:	48 98                	cltq
+}
+  800774:	c9                   	leave
+  800775:	c3                   	ret
+
+0000000000800776 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800776:	55                   	push   %rbp
+  800777:	48 89 e5             	mov    %rsp,%rbp
+  80077a:	41 54                	push   %r12
+  80077c:	53                   	push   %rbx
+  80077d:	48 83 ec 60          	sub    $0x60,%rsp
+  800781:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800785:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800789:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80078d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800791:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800795:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800799:	48 8b 06             	mov    (%rsi),%rax
+  80079c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007a0:	48 89 01             	mov    %rax,(%rcx)
+  8007a3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007a7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007ab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007af:	eb 17                	jmp    8007c8 <vprintfmt+0x52>
+      if (ch == '\0')
+  8007b1:	85 db                	test   %ebx,%ebx
+  8007b3:	0f 84 bf 04 00 00    	je     800c78 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8007b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007bd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8007c1:	48 89 c6             	mov    %rax,%rsi
+  8007c4:	89 df                	mov    %ebx,%edi
+  8007c6:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007c8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007d0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007d4:	0f b6 00             	movzbl (%rax),%eax
+  8007d7:	0f b6 d8             	movzbl %al,%ebx
+  8007da:	83 fb 25             	cmp    $0x25,%ebx
+  8007dd:	75 d2                	jne    8007b1 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8007df:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8007e3:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8007ea:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8007f1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8007f8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8007ff:	eb 04                	jmp    800805 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800801:	90                   	nop
+  800802:	eb 01                	jmp    800805 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800804:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800805:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800809:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80080d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800811:	0f b6 00             	movzbl (%rax),%eax
+  800814:	0f b6 d8             	movzbl %al,%ebx
+  800817:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80081a:	83 f8 55             	cmp    $0x55,%eax
+  80081d:	0f 87 22 04 00 00    	ja     800c45 <vprintfmt+0x4cf>
+  800823:	89 c0                	mov    %eax,%eax
+  800825:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80082c:	00 
+  80082d:	48 b8 38 55 80 00 00 	movabs $0x805538,%rax
+  800834:	00 00 00 
+  800837:	48 01 d0             	add    %rdx,%rax
+  80083a:	48 8b 00             	mov    (%rax),%rax
+  80083d:	ff e0                	jmp    *%rax
+        padc = '-';
+  80083f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800843:	eb c0                	jmp    800805 <vprintfmt+0x8f>
+        padc = '0';
+  800845:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800849:	eb ba                	jmp    800805 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80084b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800852:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800855:	89 d0                	mov    %edx,%eax
+  800857:	c1 e0 02             	shl    $0x2,%eax
+  80085a:	01 d0                	add    %edx,%eax
+  80085c:	01 c0                	add    %eax,%eax
+  80085e:	01 d8                	add    %ebx,%eax
+  800860:	83 e8 30             	sub    $0x30,%eax
+  800863:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800866:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80086a:	0f b6 00             	movzbl (%rax),%eax
+  80086d:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800870:	83 fb 2f             	cmp    $0x2f,%ebx
+  800873:	7e 60                	jle    8008d5 <vprintfmt+0x15f>
+  800875:	83 fb 39             	cmp    $0x39,%ebx
+  800878:	7f 5b                	jg     8008d5 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80087a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80087f:	eb d1                	jmp    800852 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	77 17                	ja     8008a0 <vprintfmt+0x12a>
+  800889:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80088d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800890:	89 d2                	mov    %edx,%edx
+  800892:	48 01 d0             	add    %rdx,%rax
+  800895:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800898:	83 c2 08             	add    $0x8,%edx
+  80089b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80089e:	eb 0c                	jmp    8008ac <vprintfmt+0x136>
+  8008a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008a8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008ac:	8b 00                	mov    (%rax),%eax
+  8008ae:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8008b1:	eb 23                	jmp    8008d6 <vprintfmt+0x160>
+        if (width < 0)
+  8008b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008b7:	0f 89 44 ff ff ff    	jns    800801 <vprintfmt+0x8b>
+          width = 0;
+  8008bd:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8008c4:	e9 38 ff ff ff       	jmp    800801 <vprintfmt+0x8b>
+        altflag = 1;
+  8008c9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8008d0:	e9 30 ff ff ff       	jmp    800805 <vprintfmt+0x8f>
+        goto process_precision;
+  8008d5:	90                   	nop
+        if (width < 0)
+  8008d6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008da:	0f 89 24 ff ff ff    	jns    800804 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8008e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8008e3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8008e6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8008ed:	e9 12 ff ff ff       	jmp    800804 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8008f2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8008f6:	e9 0a ff ff ff       	jmp    800805 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 17                	ja     80091a <vprintfmt+0x1a4>
+  800903:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800907:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80090a:	89 d2                	mov    %edx,%edx
+  80090c:	48 01 d0             	add    %rdx,%rax
+  80090f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800912:	83 c2 08             	add    $0x8,%edx
+  800915:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800918:	eb 0c                	jmp    800926 <vprintfmt+0x1b0>
+  80091a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80091e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800922:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800926:	8b 00                	mov    (%rax),%eax
+  800928:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80092c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800930:	48 89 d6             	mov    %rdx,%rsi
+  800933:	89 c7                	mov    %eax,%edi
+  800935:	ff d1                	call   *%rcx
+        break;
+  800937:	e9 37 03 00 00       	jmp    800c73 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80093c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093f:	83 f8 2f             	cmp    $0x2f,%eax
+  800942:	77 17                	ja     80095b <vprintfmt+0x1e5>
+  800944:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800948:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80094b:	89 d2                	mov    %edx,%edx
+  80094d:	48 01 d0             	add    %rdx,%rax
+  800950:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800953:	83 c2 08             	add    $0x8,%edx
+  800956:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800959:	eb 0c                	jmp    800967 <vprintfmt+0x1f1>
+  80095b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80095f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800963:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800967:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800969:	85 db                	test   %ebx,%ebx
+  80096b:	79 02                	jns    80096f <vprintfmt+0x1f9>
+          err = -err;
+  80096d:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80096f:	83 fb 15             	cmp    $0x15,%ebx
+  800972:	7f 16                	jg     80098a <vprintfmt+0x214>
+  800974:	48 ba 60 54 80 00 00 	movabs $0x805460,%rdx
+  80097b:	00 00 00 
+  80097e:	48 63 c3             	movslq %ebx,%rax
+  800981:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800985:	4d 85 e4             	test   %r12,%r12
+  800988:	75 2e                	jne    8009b8 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80098a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80098e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800992:	89 d9                	mov    %ebx,%ecx
+  800994:	48 ba 21 55 80 00 00 	movabs $0x805521,%rdx
+  80099b:	00 00 00 
+  80099e:	48 89 c7             	mov    %rax,%rdi
+  8009a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a6:	49 b8 82 0c 80 00 00 	movabs $0x800c82,%r8
+  8009ad:	00 00 00 
+  8009b0:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8009b3:	e9 bb 02 00 00       	jmp    800c73 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8009b8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009c0:	4c 89 e1             	mov    %r12,%rcx
+  8009c3:	48 ba 2a 55 80 00 00 	movabs $0x80552a,%rdx
+  8009ca:	00 00 00 
+  8009cd:	48 89 c7             	mov    %rax,%rdi
+  8009d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d5:	49 b8 82 0c 80 00 00 	movabs $0x800c82,%r8
+  8009dc:	00 00 00 
+  8009df:	41 ff d0             	call   *%r8
+        break;
+  8009e2:	e9 8c 02 00 00       	jmp    800c73 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8009e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ed:	77 17                	ja     800a06 <vprintfmt+0x290>
+  8009ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009f6:	89 d2                	mov    %edx,%edx
+  8009f8:	48 01 d0             	add    %rdx,%rax
+  8009fb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009fe:	83 c2 08             	add    $0x8,%edx
+  800a01:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a04:	eb 0c                	jmp    800a12 <vprintfmt+0x29c>
+  800a06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a0a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a0e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a12:	4c 8b 20             	mov    (%rax),%r12
+  800a15:	4d 85 e4             	test   %r12,%r12
+  800a18:	75 0a                	jne    800a24 <vprintfmt+0x2ae>
+          p = "(null)";
+  800a1a:	49 bc 2d 55 80 00 00 	movabs $0x80552d,%r12
+  800a21:	00 00 00 
+        if (width > 0 && padc != '-')
+  800a24:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a28:	7e 78                	jle    800aa2 <vprintfmt+0x32c>
+  800a2a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a2e:	74 72                	je     800aa2 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a30:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a33:	48 98                	cltq
+  800a35:	48 89 c6             	mov    %rax,%rsi
+  800a38:	4c 89 e7             	mov    %r12,%rdi
+  800a3b:	48 b8 8e 13 80 00 00 	movabs $0x80138e,%rax
+  800a42:	00 00 00 
+  800a45:	ff d0                	call   *%rax
+  800a47:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a4a:	eb 17                	jmp    800a63 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800a4c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a50:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a54:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a58:	48 89 d6             	mov    %rdx,%rsi
+  800a5b:	89 c7                	mov    %eax,%edi
+  800a5d:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a5f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a63:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a67:	7f e3                	jg     800a4c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a69:	eb 37                	jmp    800aa2 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800a6b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800a6f:	74 1e                	je     800a8f <vprintfmt+0x319>
+  800a71:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a74:	7e 05                	jle    800a7b <vprintfmt+0x305>
+  800a76:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a79:	7e 14                	jle    800a8f <vprintfmt+0x319>
+            putch('?', putdat);
+  800a7b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a7f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a83:	48 89 c6             	mov    %rax,%rsi
+  800a86:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a8b:	ff d2                	call   *%rdx
+  800a8d:	eb 0f                	jmp    800a9e <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800a8f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a93:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a97:	48 89 c6             	mov    %rax,%rsi
+  800a9a:	89 df                	mov    %ebx,%edi
+  800a9c:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a9e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800aa2:	4c 89 e0             	mov    %r12,%rax
+  800aa5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800aa9:	0f b6 00             	movzbl (%rax),%eax
+  800aac:	0f be d8             	movsbl %al,%ebx
+  800aaf:	85 db                	test   %ebx,%ebx
+  800ab1:	74 28                	je     800adb <vprintfmt+0x365>
+  800ab3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ab7:	78 b2                	js     800a6b <vprintfmt+0x2f5>
+  800ab9:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800abd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ac1:	79 a8                	jns    800a6b <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800ac3:	eb 16                	jmp    800adb <vprintfmt+0x365>
+          putch(' ', putdat);
+  800ac5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ac9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800acd:	48 89 c6             	mov    %rax,%rsi
+  800ad0:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ad5:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ad7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800adb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800adf:	7f e4                	jg     800ac5 <vprintfmt+0x34f>
+        break;
+  800ae1:	e9 8d 01 00 00       	jmp    800c73 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800ae6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ae9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800aed:	89 d6                	mov    %edx,%esi
+  800aef:	48 89 c7             	mov    %rax,%rdi
+  800af2:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+  800afe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800b02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b06:	48 85 c0             	test   %rax,%rax
+  800b09:	79 1d                	jns    800b28 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800b0b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b0f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b13:	48 89 c6             	mov    %rax,%rsi
+  800b16:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b1b:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800b1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b21:	48 f7 d8             	neg    %rax
+  800b24:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800b28:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b2f:	e9 d2 00 00 00       	jmp    800c06 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b34:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b37:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b3b:	89 d6                	mov    %edx,%esi
+  800b3d:	48 89 c7             	mov    %rax,%rdi
+  800b40:	48 b8 88 05 80 00 00 	movabs $0x800588,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+  800b4c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800b50:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b57:	e9 aa 00 00 00       	jmp    800c06 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800b5c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b5f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b63:	89 d6                	mov    %edx,%esi
+  800b65:	48 89 c7             	mov    %rax,%rdi
+  800b68:	48 b8 88 05 80 00 00 	movabs $0x800588,%rax
+  800b6f:	00 00 00 
+  800b72:	ff d0                	call   *%rax
+  800b74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800b78:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800b7f:	e9 82 00 00 00       	jmp    800c06 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800b84:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b88:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b8c:	48 89 c6             	mov    %rax,%rsi
+  800b8f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b94:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800b96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b9a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b9e:	48 89 c6             	mov    %rax,%rsi
+  800ba1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ba6:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800ba8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bab:	83 f8 2f             	cmp    $0x2f,%eax
+  800bae:	77 17                	ja     800bc7 <vprintfmt+0x451>
+  800bb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bb4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bb7:	89 d2                	mov    %edx,%edx
+  800bb9:	48 01 d0             	add    %rdx,%rax
+  800bbc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bbf:	83 c2 08             	add    $0x8,%edx
+  800bc2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bc5:	eb 0c                	jmp    800bd3 <vprintfmt+0x45d>
+  800bc7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bcb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bcf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bd3:	48 8b 00             	mov    (%rax),%rax
+  800bd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800bda:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800be1:	eb 23                	jmp    800c06 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800be3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800be6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bea:	89 d6                	mov    %edx,%esi
+  800bec:	48 89 c7             	mov    %rax,%rdi
+  800bef:	48 b8 88 05 80 00 00 	movabs $0x800588,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+  800bfb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800bff:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800c06:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c0b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c0e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c15:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c19:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c1d:	45 89 c1             	mov    %r8d,%r9d
+  800c20:	41 89 f8             	mov    %edi,%r8d
+  800c23:	48 89 c7             	mov    %rax,%rdi
+  800c26:	48 b8 d0 04 80 00 00 	movabs $0x8004d0,%rax
+  800c2d:	00 00 00 
+  800c30:	ff d0                	call   *%rax
+        break;
+  800c32:	eb 3f                	jmp    800c73 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c34:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c38:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c3c:	48 89 c6             	mov    %rax,%rsi
+  800c3f:	89 df                	mov    %ebx,%edi
+  800c41:	ff d2                	call   *%rdx
+        break;
+  800c43:	eb 2e                	jmp    800c73 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800c45:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c49:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c4d:	48 89 c6             	mov    %rax,%rsi
+  800c50:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c55:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800c57:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c5c:	eb 05                	jmp    800c63 <vprintfmt+0x4ed>
+  800c5e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c63:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c67:	48 83 e8 01          	sub    $0x1,%rax
+  800c6b:	0f b6 00             	movzbl (%rax),%eax
+  800c6e:	3c 25                	cmp    $0x25,%al
+  800c70:	75 ec                	jne    800c5e <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800c72:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c73:	e9 50 fb ff ff       	jmp    8007c8 <vprintfmt+0x52>
+        return;
+  800c78:	90                   	nop
+    }
+  }
+}
+  800c79:	48 83 c4 60          	add    $0x60,%rsp
+  800c7d:	5b                   	pop    %rbx
+  800c7e:	41 5c                	pop    %r12
+  800c80:	5d                   	pop    %rbp
+  800c81:	c3                   	ret
+
+0000000000800c82 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c82:	55                   	push   %rbp
+  800c83:	48 89 e5             	mov    %rsp,%rbp
+  800c86:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c8d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c94:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c9b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ca2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ca9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800cb0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cb7:	84 c0                	test   %al,%al
+  800cb9:	74 20                	je     800cdb <printfmt+0x59>
+  800cbb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800cbf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800cc3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800cc7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ccb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ccf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800cd3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cd7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800cdb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ce2:	00 00 00 
+  800ce5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800cec:	00 00 00 
+  800cef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800cfa:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d01:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800d08:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d0f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d16:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d1d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d24:	48 89 c7             	mov    %rax,%rdi
+  800d27:	48 b8 76 07 80 00 00 	movabs $0x800776,%rax
+  800d2e:	00 00 00 
+  800d31:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d33:	90                   	nop
+  800d34:	c9                   	leave
+  800d35:	c3                   	ret
+
+0000000000800d36 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d36:	55                   	push   %rbp
+  800d37:	48 89 e5             	mov    %rsp,%rbp
+  800d3a:	48 83 ec 10          	sub    $0x10,%rsp
+  800d3e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d41:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800d45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d49:	8b 40 10             	mov    0x10(%rax),%eax
+  800d4c:	8d 50 01             	lea    0x1(%rax),%edx
+  800d4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d53:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d5a:	48 8b 10             	mov    (%rax),%rdx
+  800d5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d65:	48 39 c2             	cmp    %rax,%rdx
+  800d68:	73 17                	jae    800d81 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800d6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d6e:	48 8b 00             	mov    (%rax),%rax
+  800d71:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d79:	48 89 0a             	mov    %rcx,(%rdx)
+  800d7c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d7f:	88 10                	mov    %dl,(%rax)
+}
+  800d81:	90                   	nop
+  800d82:	c9                   	leave
+  800d83:	c3                   	ret
+
+0000000000800d84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800d84:	55                   	push   %rbp
+  800d85:	48 89 e5             	mov    %rsp,%rbp
+  800d88:	48 83 ec 40          	sub    $0x40,%rsp
+  800d8c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d90:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800d93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d97:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d9f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800da3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800da6:	48 98                	cltq
+  800da8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800dac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800db0:	48 01 d0             	add    %rdx,%rax
+  800db3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800db7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800dbe:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800dc3:	74 06                	je     800dcb <vsnprintf+0x47>
+  800dc5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800dc9:	7f 07                	jg     800dd2 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800dcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dd0:	eb 32                	jmp    800e04 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800dd2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800dd6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800dda:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800dde:	48 89 c6             	mov    %rax,%rsi
+  800de1:	48 b8 36 0d 80 00 00 	movabs $0x800d36,%rax
+  800de8:	00 00 00 
+  800deb:	48 89 c7             	mov    %rax,%rdi
+  800dee:	48 b8 76 07 80 00 00 	movabs $0x800776,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800dfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dfe:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800e01:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800e04:	c9                   	leave
+  800e05:	c3                   	ret
+
+0000000000800e06 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800e06:	55                   	push   %rbp
+  800e07:	48 89 e5             	mov    %rsp,%rbp
+  800e0a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e11:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e18:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800e1e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e25:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e2c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e33:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e3a:	84 c0                	test   %al,%al
+  800e3c:	74 20                	je     800e5e <snprintf+0x58>
+  800e3e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e42:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e46:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e4a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e4e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e52:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e56:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e5a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800e5e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e65:	00 00 00 
+  800e68:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e6f:	00 00 00 
+  800e72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e76:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e7d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e84:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800e8b:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800e92:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e99:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800e9f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ea6:	48 89 c7             	mov    %rax,%rdi
+  800ea9:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+  800eb5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800ebb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ec1:	c9                   	leave
+  800ec2:	c3                   	ret
+
+0000000000800ec3 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800ec3:	55                   	push   %rbp
+  800ec4:	48 89 e5             	mov    %rsp,%rbp
+  800ec7:	53                   	push   %rbx
+  800ec8:	48 83 ec 38          	sub    $0x38,%rsp
+  800ecc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ecf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ed3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ed7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800edb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800edf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ee2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee7:	89 d1                	mov    %edx,%ecx
+  800ee9:	0f a2                	cpuid
+  800eeb:	89 de                	mov    %ebx,%esi
+  800eed:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ef0:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ef3:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ef6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ef9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800efe:	74 09                	je     800f09 <cpuid+0x46>
+}
+  800f00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f04:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f07:	89 10                	mov    %edx,(%rax)
+
+  800f09:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f0e:	74 09                	je     800f19 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800f10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f14:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f17:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800f19:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f1e:	74 09                	je     800f29 <cpuid+0x66>
+char *
+  800f20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f24:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f27:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800f29:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f2e:	74 09                	je     800f39 <cpuid+0x76>
+  for (; *s; s++)
+  800f30:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f34:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f37:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f39:	90                   	nop
+  800f3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3e:	c9                   	leave
+  800f3f:	c3                   	ret
+
+0000000000800f40 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800f40:	55                   	push   %rbp
+  800f41:	48 89 e5             	mov    %rsp,%rbp
+  800f44:	48 83 ec 18          	sub    $0x18,%rsp
+  800f48:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800f4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f4e:	89 c1                	mov    %eax,%ecx
+  800f50:	0f 01 d0             	xgetbv
+  800f53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f56:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800f59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f5c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800f5f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800f63:	48 09 d0             	or     %rdx,%rax
+#else
+  800f66:	c9                   	leave
+  800f67:	c3                   	ret
+
+0000000000800f68 <string_cpu>:
+string_cpu(void) {
+  800f68:	55                   	push   %rbp
+  800f69:	48 89 e5             	mov    %rsp,%rbp
+  800f6c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800f70:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800f77:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800f7e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800f85:	00 00 00 
+  800f88:	8b 00                	mov    (%rax),%eax
+  800f8a:	85 c0                	test   %eax,%eax
+  800f8c:	78 11                	js     800f9f <string_cpu+0x37>
+    return string_features;
+  800f8e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800f95:	00 00 00 
+  800f98:	8b 00                	mov    (%rax),%eax
+  800f9a:	e9 df 00 00 00       	jmp    80107e <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800f9f:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800fa3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fa9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb3:	48 89 c6             	mov    %rax,%rsi
+  800fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fbb:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800fc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800fca:	83 f8 06             	cmp    $0x6,%eax
+  800fcd:	76 28                	jbe    800ff7 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800fcf:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800fd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fde:	48 89 c2             	mov    %rax,%rdx
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	bf 07 00 00 00       	mov    $0x7,%edi
+  800feb:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  800ff2:	00 00 00 
+  800ff5:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800ff7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800ffa:	25 00 02 00 00       	and    $0x200,%eax
+  800fff:	85 c0                	test   %eax,%eax
+  801001:	74 04                	je     801007 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801003:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801007:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80100b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801011:	48 89 c1             	mov    %rax,%rcx
+  801014:	ba 00 00 00 00       	mov    $0x0,%edx
+  801019:	be 00 00 00 00       	mov    $0x0,%esi
+  80101e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801023:	48 b8 c3 0e 80 00 00 	movabs $0x800ec3,%rax
+  80102a:	00 00 00 
+  80102d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80102f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801032:	83 e0 20             	and    $0x20,%eax
+  801035:	85 c0                	test   %eax,%eax
+  801037:	74 2a                	je     801063 <string_cpu+0xfb>
+  801039:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80103c:	25 00 00 00 08       	and    $0x8000000,%eax
+  801041:	85 c0                	test   %eax,%eax
+  801043:	74 1e                	je     801063 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801045:	bf 00 00 00 00       	mov    $0x0,%edi
+  80104a:	48 b8 40 0f 80 00 00 	movabs $0x800f40,%rax
+  801051:	00 00 00 
+  801054:	ff d0                	call   *%rax
+  801056:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801059:	48 83 f8 06          	cmp    $0x6,%rax
+  80105d:	75 04                	jne    801063 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80105f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801063:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  80106a:	00 00 00 
+  80106d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801070:	89 02                	mov    %eax,(%rdx)
+  801072:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  801079:	00 00 00 
+  80107c:	8b 00                	mov    (%rax),%eax
+}
+  80107e:	c9                   	leave
+  80107f:	c3                   	ret
+
+0000000000801080 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801080:	55                   	push   %rbp
+  801081:	48 89 e5             	mov    %rsp,%rbp
+  801084:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801088:	48 83 ec 60          	sub    $0x60,%rsp
+  80108c:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801091:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801096:	83 e0 1f             	and    $0x1f,%eax
+  801099:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80109d:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010a1:	48 f7 d8             	neg    %rax
+  8010a4:	48 89 c2             	mov    %rax,%rdx
+  8010a7:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010ac:	48 01 d0             	add    %rdx,%rax
+  8010af:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8010b4:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8010b8:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8010be:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010c3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010c7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8010cd:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010d1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010d5:	89 c2                	mov    %eax,%edx
+  8010d7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010db:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8010e0:	89 c1                	mov    %eax,%ecx
+  8010e2:	d3 e6                	shl    %cl,%esi
+  8010e4:	89 f0                	mov    %esi,%eax
+  8010e6:	21 d0                	and    %edx,%eax
+  8010e8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8010ec:	eb 21                	jmp    80110f <strlen_avx2+0x8f>
+    p += 32;
+  8010ee:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8010f4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010f9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010fd:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801103:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801107:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80110b:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80110f:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801114:	74 d8                	je     8010ee <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801116:	31 c0                	xor    %eax,%eax
+  801118:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80111e:	48 63 d0             	movslq %eax,%rdx
+  801121:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801126:	48 01 d0             	add    %rdx,%rax
+  801129:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801138:	48 83 ec 40          	sub    $0x40,%rsp
+  80113c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801141:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801146:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80114b:	eb 77                	jmp    8011c4 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80114d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801152:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801156:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80115a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80115f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801163:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801167:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80116b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80116f:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801174:	74 3c                	je     8011b2 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801176:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80117a:	f7 d0                	not    %eax
+  80117c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801180:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801184:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801188:	48 63 d0             	movslq %eax,%rdx
+  80118b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801190:	48 01 d0             	add    %rdx,%rax
+  801193:	0f b6 00             	movzbl (%rax),%eax
+  801196:	0f b6 c0             	movzbl %al,%eax
+  801199:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80119d:	48 63 ca             	movslq %edx,%rcx
+  8011a0:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8011a5:	48 01 ca             	add    %rcx,%rdx
+  8011a8:	0f b6 12             	movzbl (%rdx),%edx
+  8011ab:	0f b6 d2             	movzbl %dl,%edx
+  8011ae:	29 d0                	sub    %edx,%eax
+  8011b0:	eb 6b                	jmp    80121d <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8011b2:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8011b8:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8011be:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8011c4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8011ca:	77 81                	ja     80114d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8011cc:	eb 42                	jmp    801210 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8011ce:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011d3:	0f b6 10             	movzbl (%rax),%edx
+  8011d6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011db:	0f b6 00             	movzbl (%rax),%eax
+  8011de:	38 c2                	cmp    %al,%dl
+  8011e0:	74 1c                	je     8011fe <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8011e2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011e7:	0f b6 00             	movzbl (%rax),%eax
+  8011ea:	0f b6 c8             	movzbl %al,%ecx
+  8011ed:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011f2:	0f b6 00             	movzbl (%rax),%eax
+  8011f5:	0f b6 d0             	movzbl %al,%edx
+  8011f8:	89 c8                	mov    %ecx,%eax
+  8011fa:	29 d0                	sub    %edx,%eax
+  8011fc:	eb 1f                	jmp    80121d <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8011fe:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801204:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80120a:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801210:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801216:	75 b6                	jne    8011ce <memcmp_avx2+0x9e>
+  return 0;
+  801218:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121d:	c9                   	leave
+  80121e:	c3                   	ret
+
+000000000080121f <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80121f:	55                   	push   %rbp
+  801220:	48 89 e5             	mov    %rsp,%rbp
+  801223:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801227:	48 83 ec 60          	sub    $0x60,%rsp
+  80122b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801230:	89 f0                	mov    %esi,%eax
+  801232:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801237:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80123b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801240:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801244:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801249:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80124f:	eb 47                	jmp    801298 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801251:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801256:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80125a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80125e:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801264:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801268:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80126c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801270:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801275:	74 15                	je     80128c <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801277:	31 c0                	xor    %eax,%eax
+  801279:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80127f:	48 63 d0             	movslq %eax,%rdx
+  801282:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801287:	48 01 d0             	add    %rdx,%rax
+  80128a:	eb 3d                	jmp    8012c9 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80128c:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801292:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801298:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80129e:	77 b1                	ja     801251 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8012a0:	eb 0c                	jmp    8012ae <memfind_avx2+0x8f>
+  8012a2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8012a8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8012ae:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8012b4:	74 0e                	je     8012c4 <memfind_avx2+0xa5>
+  8012b6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012bb:	0f b6 00             	movzbl (%rax),%eax
+  8012be:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8012c2:	75 de                	jne    8012a2 <memfind_avx2+0x83>
+  return s;
+  8012c4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+00000000008012cb <strlen>:
+strlen(const char *s) {
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	48 83 ec 40          	sub    $0x40,%rsp
+  8012d3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8012d7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8012db:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8012df:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  8012e6:	00 00 00 
+  8012e9:	ff d0                	call   *%rax
+  8012eb:	83 e0 02             	and    $0x2,%eax
+  8012ee:	85 c0                	test   %eax,%eax
+  8012f0:	74 18                	je     80130a <strlen+0x3f>
+    return strlen_avx2(s);
+  8012f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012f6:	48 89 c7             	mov    %rax,%rdi
+  8012f9:	48 b8 80 10 80 00 00 	movabs $0x801080,%rax
+  801300:	00 00 00 
+  801303:	ff d0                	call   *%rax
+  801305:	e9 82 00 00 00       	jmp    80138c <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80130a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80130e:	83 e0 0f             	and    $0xf,%eax
+  801311:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801314:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801317:	48 f7 d8             	neg    %rax
+  80131a:	48 89 c2             	mov    %rax,%rdx
+  80131d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801321:	48 01 d0             	add    %rdx,%rax
+  801324:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801328:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80132c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801330:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801335:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801339:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80133d:	89 c2                	mov    %eax,%edx
+  80133f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801342:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801347:	89 c1                	mov    %eax,%ecx
+  801349:	d3 e6                	shl    %cl,%esi
+  80134b:	89 f0                	mov    %esi,%eax
+  80134d:	21 d0                	and    %edx,%eax
+  80134f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801352:	eb 1d                	jmp    801371 <strlen+0xa6>
+    p += 16;
+  801354:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801361:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801366:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80136a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80136e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801371:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801375:	74 dd                	je     801354 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801377:	31 c0                	xor    %eax,%eax
+  801379:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80137e:	48 63 d0             	movslq %eax,%rdx
+  801381:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801385:	48 01 d0             	add    %rdx,%rax
+  801388:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+
+000000000080138e <strnlen>:
+strnlen(const char *s, size_t size) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	48 83 ec 20          	sub    $0x20,%rsp
+  801396:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80139a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80139e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013a5:	eb 0e                	jmp    8013b5 <strnlen+0x27>
+    n++;
+  8013a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013ab:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013b0:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013b5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013ba:	74 0b                	je     8013c7 <strnlen+0x39>
+  8013bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c0:	0f b6 00             	movzbl (%rax),%eax
+  8013c3:	84 c0                	test   %al,%al
+  8013c5:	75 e0                	jne    8013a7 <strnlen+0x19>
+  return n;
+  8013c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013ca:	c9                   	leave
+  8013cb:	c3                   	ret
+
+00000000008013cc <strcpy>:
+strcpy(char *dst, const char *src) {
+  8013cc:	55                   	push   %rbp
+  8013cd:	48 89 e5             	mov    %rsp,%rbp
+  8013d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8013d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8013dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8013e4:	90                   	nop
+  8013e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013e9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013fd:	0f b6 12             	movzbl (%rdx),%edx
+  801400:	88 10                	mov    %dl,(%rax)
+  801402:	0f b6 00             	movzbl (%rax),%eax
+  801405:	84 c0                	test   %al,%al
+  801407:	75 dc                	jne    8013e5 <strcpy+0x19>
+  return ret;
+  801409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80140d:	c9                   	leave
+  80140e:	c3                   	ret
+
+000000000080140f <strcat>:
+strcat(char *dst, const char *src) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+  801413:	48 83 ec 20          	sub    $0x20,%rsp
+  801417:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80141b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80141f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801423:	48 89 c7             	mov    %rax,%rdi
+  801426:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  80142d:	00 00 00 
+  801430:	ff d0                	call   *%rax
+  801432:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801435:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801438:	48 63 d0             	movslq %eax,%rdx
+  80143b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143f:	48 01 c2             	add    %rax,%rdx
+  801442:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801446:	48 89 c6             	mov    %rax,%rsi
+  801449:	48 89 d7             	mov    %rdx,%rdi
+  80144c:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  801453:	00 00 00 
+  801456:	ff d0                	call   *%rax
+  return dst;
+  801458:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+
+000000000080145e <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80145e:	55                   	push   %rbp
+  80145f:	48 89 e5             	mov    %rsp,%rbp
+  801462:	48 83 ec 28          	sub    $0x28,%rsp
+  801466:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80146a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80146e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801472:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801476:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80147a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801481:	00 
+  801482:	eb 2a                	jmp    8014ae <strncpy+0x50>
+    *dst++ = *src;
+  801484:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801488:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80148c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801490:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801494:	0f b6 12             	movzbl (%rdx),%edx
+  801497:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801499:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149d:	0f b6 00             	movzbl (%rax),%eax
+  8014a0:	84 c0                	test   %al,%al
+  8014a2:	74 05                	je     8014a9 <strncpy+0x4b>
+      src++;
+  8014a4:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8014a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014b6:	72 cc                	jb     801484 <strncpy+0x26>
+  return ret;
+  8014b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014bc:	c9                   	leave
+  8014bd:	c3                   	ret
+
+00000000008014be <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8014be:	55                   	push   %rbp
+  8014bf:	48 89 e5             	mov    %rsp,%rbp
+  8014c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8014c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014ce:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8014d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8014da:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014df:	74 3d                	je     80151e <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8014e1:	eb 1d                	jmp    801500 <strlcpy+0x42>
+      *dst++ = *src++;
+  8014e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014e7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014eb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014fb:	0f b6 12             	movzbl (%rdx),%edx
+  8014fe:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801500:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801505:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80150a:	74 0b                	je     801517 <strlcpy+0x59>
+  80150c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801510:	0f b6 00             	movzbl (%rax),%eax
+  801513:	84 c0                	test   %al,%al
+  801515:	75 cc                	jne    8014e3 <strlcpy+0x25>
+    *dst = '\0';
+  801517:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80151b:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80151e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801522:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+
+0000000000801528 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801528:	55                   	push   %rbp
+  801529:	48 89 e5             	mov    %rsp,%rbp
+  80152c:	48 83 ec 30          	sub    $0x30,%rsp
+  801530:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801534:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801538:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80153c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801540:	48 89 c7             	mov    %rax,%rdi
+  801543:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  80154a:	00 00 00 
+  80154d:	ff d0                	call   *%rax
+  80154f:	48 98                	cltq
+  801551:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801555:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155d:	48 89 d6             	mov    %rdx,%rsi
+  801560:	48 89 c7             	mov    %rax,%rdi
+  801563:	48 b8 8e 13 80 00 00 	movabs $0x80138e,%rax
+  80156a:	00 00 00 
+  80156d:	ff d0                	call   *%rax
+  80156f:	48 98                	cltq
+  801571:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801575:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801579:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80157d:	75 10                	jne    80158f <strlcat+0x67>
+    return maxlen + srclen;
+  80157f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801583:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801587:	48 01 d0             	add    %rdx,%rax
+  80158a:	e9 86 00 00 00       	jmp    801615 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80158f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801593:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801597:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80159b:	73 2b                	jae    8015c8 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80159d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ad:	48 01 c1             	add    %rax,%rcx
+  8015b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b4:	48 89 c6             	mov    %rax,%rsi
+  8015b7:	48 89 cf             	mov    %rcx,%rdi
+  8015ba:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  8015c1:	00 00 00 
+  8015c4:	ff d0                	call   *%rax
+  8015c6:	eb 42                	jmp    80160a <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8015c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015cc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d8:	48 01 c1             	add    %rax,%rcx
+  8015db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015df:	48 89 c6             	mov    %rax,%rsi
+  8015e2:	48 89 cf             	mov    %rcx,%rdi
+  8015e5:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  8015ec:	00 00 00 
+  8015ef:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8015f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f9:	48 01 d0             	add    %rdx,%rax
+  8015fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801604:	48 01 d0             	add    %rdx,%rax
+  801607:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80160a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80160e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801612:	48 01 d0             	add    %rdx,%rax
+}
+  801615:	c9                   	leave
+  801616:	c3                   	ret
+
+0000000000801617 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801617:	55                   	push   %rbp
+  801618:	48 89 e5             	mov    %rsp,%rbp
+  80161b:	48 83 ec 10          	sub    $0x10,%rsp
+  80161f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801623:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801627:	eb 0a                	jmp    801633 <strcmp+0x1c>
+    p++, q++;
+  801629:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80162e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801637:	0f b6 00             	movzbl (%rax),%eax
+  80163a:	84 c0                	test   %al,%al
+  80163c:	74 12                	je     801650 <strcmp+0x39>
+  80163e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801642:	0f b6 10             	movzbl (%rax),%edx
+  801645:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801649:	0f b6 00             	movzbl (%rax),%eax
+  80164c:	38 c2                	cmp    %al,%dl
+  80164e:	74 d9                	je     801629 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801654:	0f b6 00             	movzbl (%rax),%eax
+  801657:	0f b6 d0             	movzbl %al,%edx
+  80165a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80165e:	0f b6 00             	movzbl (%rax),%eax
+  801661:	0f b6 c0             	movzbl %al,%eax
+  801664:	29 c2                	sub    %eax,%edx
+  801666:	89 d0                	mov    %edx,%eax
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+000000000080166a <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+  80166e:	48 83 ec 18          	sub    $0x18,%rsp
+  801672:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801676:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80167a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80167e:	eb 0f                	jmp    80168f <strncmp+0x25>
+    n--, p++, q++;
+  801680:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801685:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80168a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80168f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801694:	74 1d                	je     8016b3 <strncmp+0x49>
+  801696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80169a:	0f b6 00             	movzbl (%rax),%eax
+  80169d:	84 c0                	test   %al,%al
+  80169f:	74 12                	je     8016b3 <strncmp+0x49>
+  8016a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a5:	0f b6 10             	movzbl (%rax),%edx
+  8016a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ac:	0f b6 00             	movzbl (%rax),%eax
+  8016af:	38 c2                	cmp    %al,%dl
+  8016b1:	74 cd                	je     801680 <strncmp+0x16>
+  if (n == 0)
+  8016b3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016b8:	75 07                	jne    8016c1 <strncmp+0x57>
+    return 0;
+  8016ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016bf:	eb 16                	jmp    8016d7 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c5:	0f b6 00             	movzbl (%rax),%eax
+  8016c8:	0f b6 d0             	movzbl %al,%edx
+  8016cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016cf:	0f b6 00             	movzbl (%rax),%eax
+  8016d2:	0f b6 c0             	movzbl %al,%eax
+  8016d5:	29 c2                	sub    %eax,%edx
+}
+  8016d7:	89 d0                	mov    %edx,%eax
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+00000000008016db <strchr>:
+strchr(const char *s, char c) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	48 83 ec 60          	sub    $0x60,%rsp
+  8016e3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8016e7:	89 f0                	mov    %esi,%eax
+  8016e9:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8016ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016f0:	83 e0 0f             	and    $0xf,%eax
+  8016f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8016f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8016f9:	48 f7 d8             	neg    %rax
+  8016fc:	48 89 c2             	mov    %rax,%rdx
+  8016ff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801703:	48 01 d0             	add    %rdx,%rax
+  801706:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80170a:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80170e:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801712:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801716:	66 0f 6e c0          	movd   %eax,%xmm0
+  80171a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80171e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801722:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801727:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80172b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801733:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801737:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80173c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801741:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801745:	89 c2                	mov    %eax,%edx
+  801747:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80174c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801751:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801755:	09 c2                	or     %eax,%edx
+  801757:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80175a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80175f:	89 c1                	mov    %eax,%ecx
+  801761:	d3 e6                	shl    %cl,%esi
+  801763:	89 f0                	mov    %esi,%eax
+  801765:	21 d0                	and    %edx,%eax
+  801767:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80176a:	eb 34                	jmp    8017a0 <strchr+0xc5>
+    p += 16;
+  80176c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801771:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801775:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801779:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80177d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801782:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801787:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80178b:	89 c2                	mov    %eax,%edx
+  80178d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801792:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801797:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80179b:	09 d0                	or     %edx,%eax
+  80179d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017a4:	74 c6                	je     80176c <strchr+0x91>
+  p += __builtin_ctz(m);
+  8017a6:	31 c0                	xor    %eax,%eax
+  8017a8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8017ad:	48 98                	cltq
+  8017af:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8017b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b7:	0f b6 00             	movzbl (%rax),%eax
+  8017ba:	84 c0                	test   %al,%al
+  8017bc:	74 06                	je     8017c4 <strchr+0xe9>
+  8017be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c2:	eb 05                	jmp    8017c9 <strchr+0xee>
+  8017c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+
+00000000008017cb <strfind>:
+strfind(const char *s, char c) {
+  8017cb:	55                   	push   %rbp
+  8017cc:	48 89 e5             	mov    %rsp,%rbp
+  8017cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8017d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017d7:	89 f0                	mov    %esi,%eax
+  8017d9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8017dc:	eb 11                	jmp    8017ef <strfind+0x24>
+    if (*s == c)
+  8017de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e2:	0f b6 00             	movzbl (%rax),%eax
+  8017e5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017e8:	74 12                	je     8017fc <strfind+0x31>
+  for (; *s; s++)
+  8017ea:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f3:	0f b6 00             	movzbl (%rax),%eax
+  8017f6:	84 c0                	test   %al,%al
+  8017f8:	75 e4                	jne    8017de <strfind+0x13>
+  8017fa:	eb 01                	jmp    8017fd <strfind+0x32>
+      break;
+  8017fc:	90                   	nop
+  return (char *)s;
+  8017fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801801:	c9                   	leave
+  801802:	c3                   	ret
+
+0000000000801803 <memset>:
+memset(void *v, int c, size_t n) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	48 83 ec 38          	sub    $0x38,%rsp
+  80180b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80180f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801812:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801816:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80181e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801823:	76 41                	jbe    801866 <memset+0x63>
+  801825:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  80182c:	00 00 00 
+  80182f:	ff d0                	call   *%rax
+  801831:	83 e0 01             	and    $0x1,%eax
+  801834:	85 c0                	test   %eax,%eax
+  801836:	74 2e                	je     801866 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801838:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80183b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80183f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801843:	48 89 ce             	mov    %rcx,%rsi
+  801846:	48 89 f7             	mov    %rsi,%rdi
+  801849:	48 89 d1             	mov    %rdx,%rcx
+  80184c:	fc                   	cld
+  80184d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80184f:	48 89 ca             	mov    %rcx,%rdx
+  801852:	48 89 fe             	mov    %rdi,%rsi
+  801855:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801859:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80185d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801861:	e9 a7 00 00 00       	jmp    80190d <memset+0x10a>
+  if (n >= 8) {
+  801866:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80186b:	0f 86 87 00 00 00    	jbe    8018f8 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801871:	eb 16                	jmp    801889 <memset+0x86>
+      *p++ = c;
+  801873:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801877:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80187b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80187f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801882:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801884:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801889:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188d:	83 e0 07             	and    $0x7,%eax
+  801890:	48 85 c0             	test   %rax,%rax
+  801893:	75 de                	jne    801873 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801895:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801898:	0f b6 c0             	movzbl %al,%eax
+  80189b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8018a2:	01 01 01 
+  8018a5:	48 0f af c2          	imul   %rdx,%rax
+  8018a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8018ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018b1:	48 c1 e8 03          	shr    $0x3,%rax
+  8018b5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8018b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018bd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c5:	48 89 ce             	mov    %rcx,%rsi
+  8018c8:	48 89 f7             	mov    %rsi,%rdi
+  8018cb:	48 89 d1             	mov    %rdx,%rcx
+  8018ce:	fc                   	cld
+  8018cf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8018d2:	48 89 ca             	mov    %rcx,%rdx
+  8018d5:	48 89 fe             	mov    %rdi,%rsi
+  8018d8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8018dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8018e0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8018e5:	eb 11                	jmp    8018f8 <memset+0xf5>
+    *p++ = c;
+  8018e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018ef:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018f3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018f6:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8018f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801900:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801904:	48 85 c0             	test   %rax,%rax
+  801907:	75 de                	jne    8018e7 <memset+0xe4>
+  return v;
+  801909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+000000000080190f <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80190f:	55                   	push   %rbp
+  801910:	48 89 e5             	mov    %rsp,%rbp
+  801913:	48 83 ec 38          	sub    $0x38,%rsp
+  801917:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80191b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80191f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801923:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801927:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80192b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801933:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801937:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80193b:	0f 83 da 00 00 00    	jae    801a1b <memmove+0x10c>
+  801941:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801945:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801949:	48 01 d0             	add    %rdx,%rax
+  80194c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801950:	0f 83 c5 00 00 00    	jae    801a1b <memmove+0x10c>
+    s += n;
+  801956:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80195a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80195e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801962:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801966:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80196b:	0f 86 94 00 00 00    	jbe    801a05 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801971:	eb 1c                	jmp    80198f <memmove+0x80>
+        *--d = *--s;
+  801973:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801978:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80197d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801981:	0f b6 10             	movzbl (%rax),%edx
+  801984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801988:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80198a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80198f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801993:	83 e0 07             	and    $0x7,%eax
+  801996:	48 85 c0             	test   %rax,%rax
+  801999:	75 d8                	jne    801973 <memmove+0x64>
+      nq = n / 8;
+  80199b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80199f:	48 c1 e8 03          	shr    $0x3,%rax
+  8019a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019a7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8019ac:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8019b1:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8019b6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c2:	48 89 cf             	mov    %rcx,%rdi
+  8019c5:	48 89 d6             	mov    %rdx,%rsi
+  8019c8:	48 89 c1             	mov    %rax,%rcx
+  8019cb:	fd                   	std
+  8019cc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019cf:	fc                   	cld
+  8019d0:	48 89 c8             	mov    %rcx,%rax
+  8019d3:	48 89 f2             	mov    %rsi,%rdx
+  8019d6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019da:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8019e2:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8019e7:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8019ec:	eb 17                	jmp    801a05 <memmove+0xf6>
+      *--d = *--s;
+  8019ee:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019f3:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019fc:	0f b6 10             	movzbl (%rax),%edx
+  8019ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a03:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a09:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a0d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a11:	48 85 c0             	test   %rax,%rax
+  801a14:	75 d8                	jne    8019ee <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801a16:	e9 f4 00 00 00       	jmp    801b0f <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a1b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a20:	76 46                	jbe    801a68 <memmove+0x159>
+  801a22:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	83 e0 01             	and    $0x1,%eax
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	74 33                	je     801a68 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a35:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a41:	48 89 cf             	mov    %rcx,%rdi
+  801a44:	48 89 d6             	mov    %rdx,%rsi
+  801a47:	48 89 c1             	mov    %rax,%rcx
+  801a4a:	fc                   	cld
+  801a4b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a4d:	48 89 c8             	mov    %rcx,%rax
+  801a50:	48 89 f2             	mov    %rsi,%rdx
+  801a53:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a57:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a5b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801a5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a63:	e9 ab 00 00 00       	jmp    801b13 <memmove+0x204>
+    if (n >= 8) {
+  801a68:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a6d:	0f 86 8b 00 00 00    	jbe    801afe <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801a73:	eb 22                	jmp    801a97 <memmove+0x188>
+        *d++ = *s++;
+  801a75:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a79:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a85:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a89:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801a8d:	0f b6 12             	movzbl (%rdx),%edx
+  801a90:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a92:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9b:	83 e0 07             	and    $0x7,%eax
+  801a9e:	48 85 c0             	test   %rax,%rax
+  801aa1:	75 d2                	jne    801a75 <memmove+0x166>
+      nq = n / 8;
+  801aa3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa7:	48 c1 e8 03          	shr    $0x3,%rax
+  801aab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801aaf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ab3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801abb:	48 89 cf             	mov    %rcx,%rdi
+  801abe:	48 89 d6             	mov    %rdx,%rsi
+  801ac1:	48 89 c1             	mov    %rax,%rcx
+  801ac4:	fc                   	cld
+  801ac5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ac8:	48 89 c8             	mov    %rcx,%rax
+  801acb:	48 89 f2             	mov    %rsi,%rdx
+  801ace:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ad2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ad6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801ada:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801adf:	eb 1d                	jmp    801afe <memmove+0x1ef>
+      *d++ = *s++;
+  801ae1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ae5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ae9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801aed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801af5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801af9:	0f b6 12             	movzbl (%rdx),%edx
+  801afc:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801afe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b02:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b06:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b0a:	48 85 c0             	test   %rax,%rax
+  801b0d:	75 d2                	jne    801ae1 <memmove+0x1d2>
+  return dst;
+  801b0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b13:	c9                   	leave
+  801b14:	c3                   	ret
+
+0000000000801b15 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801b15:	55                   	push   %rbp
+  801b16:	48 89 e5             	mov    %rsp,%rbp
+  801b19:	48 83 ec 18          	sub    $0x18,%rsp
+  801b1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b25:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801b29:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b2d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b35:	48 89 ce             	mov    %rcx,%rsi
+  801b38:	48 89 c7             	mov    %rax,%rdi
+  801b3b:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  801b42:	00 00 00 
+  801b45:	ff d0                	call   *%rax
+}
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+
+0000000000801b49 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	48 83 ec 40          	sub    $0x40,%rsp
+  801b51:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b55:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801b5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b61:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801b65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b69:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b6d:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801b72:	0f 86 a7 00 00 00    	jbe    801c1f <memcmp+0xd6>
+  801b78:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  801b7f:	00 00 00 
+  801b82:	ff d0                	call   *%rax
+  801b84:	83 e0 02             	and    $0x2,%eax
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	0f 84 90 00 00 00    	je     801c1f <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801b8f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b93:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b9b:	48 89 ce             	mov    %rcx,%rsi
+  801b9e:	48 89 c7             	mov    %rax,%rdi
+  801ba1:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+  801bad:	e9 c2 00 00 00       	jmp    801c74 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801bb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bb6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bba:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bc6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bca:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801bd1:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801bd8:	74 36                	je     801c10 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801bda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bdd:	f7 d0                	not    %eax
+  801bdf:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801be3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801be6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801be9:	48 63 d0             	movslq %eax,%rdx
+  801bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf0:	48 01 d0             	add    %rdx,%rax
+  801bf3:	0f b6 00             	movzbl (%rax),%eax
+  801bf6:	0f b6 c0             	movzbl %al,%eax
+  801bf9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801bfc:	48 63 ca             	movslq %edx,%rcx
+  801bff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c03:	48 01 ca             	add    %rcx,%rdx
+  801c06:	0f b6 12             	movzbl (%rdx),%edx
+  801c09:	0f b6 d2             	movzbl %dl,%edx
+  801c0c:	29 d0                	sub    %edx,%eax
+  801c0e:	eb 64                	jmp    801c74 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801c10:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801c15:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801c1a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801c1f:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801c24:	77 8c                	ja     801bb2 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801c26:	eb 36                	jmp    801c5e <memcmp+0x115>
+    if (*s1 != *s2)
+  801c28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c2c:	0f b6 10             	movzbl (%rax),%edx
+  801c2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c33:	0f b6 00             	movzbl (%rax),%eax
+  801c36:	38 c2                	cmp    %al,%dl
+  801c38:	74 1a                	je     801c54 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3e:	0f b6 00             	movzbl (%rax),%eax
+  801c41:	0f b6 c8             	movzbl %al,%ecx
+  801c44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c48:	0f b6 00             	movzbl (%rax),%eax
+  801c4b:	0f b6 d0             	movzbl %al,%edx
+  801c4e:	89 c8                	mov    %ecx,%eax
+  801c50:	29 d0                	sub    %edx,%eax
+  801c52:	eb 20                	jmp    801c74 <memcmp+0x12b>
+    s1++, s2++;
+  801c54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801c5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c62:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c66:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c6a:	48 85 c0             	test   %rax,%rax
+  801c6d:	75 b9                	jne    801c28 <memcmp+0xdf>
+  }
+
+  return 0;
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+0000000000801c76 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	48 83 ec 50          	sub    $0x50,%rsp
+  801c7e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c82:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801c85:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801c89:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c8d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801c91:	48 01 d0             	add    %rdx,%rax
+  801c94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801c98:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801c9b:	66 0f 6e c0          	movd   %eax,%xmm0
+  801c9f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801ca3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801ca7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801cac:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801cb0:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801cb5:	76 73                	jbe    801d2a <memfind+0xb4>
+  801cb7:	48 b8 68 0f 80 00 00 	movabs $0x800f68,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	83 e0 02             	and    $0x2,%eax
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	74 60                	je     801d2a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801cca:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ccd:	0f b6 c8             	movzbl %al,%ecx
+  801cd0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801cd4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cd8:	89 ce                	mov    %ecx,%esi
+  801cda:	48 89 c7             	mov    %rax,%rdi
+  801cdd:	48 b8 1f 12 80 00 00 	movabs $0x80121f,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	eb 6c                	jmp    801d57 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801ceb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cef:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cf3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801cf7:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801cfc:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d00:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d04:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d07:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d0b:	74 13                	je     801d20 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801d0d:	31 c0                	xor    %eax,%eax
+  801d0f:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801d14:	48 63 d0             	movslq %eax,%rdx
+  801d17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1b:	48 01 d0             	add    %rdx,%rax
+  801d1e:	eb 37                	jmp    801d57 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801d20:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801d25:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801d2a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d2f:	77 ba                	ja     801ceb <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d31:	eb 13                	jmp    801d46 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d37:	0f b6 00             	movzbl (%rax),%eax
+  801d3a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d3d:	38 d0                	cmp    %dl,%al
+  801d3f:	74 11                	je     801d52 <memfind+0xdc>
+  for (; s < ends; s++)
+  801d41:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801d46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d4e:	72 e3                	jb     801d33 <memfind+0xbd>
+  801d50:	eb 01                	jmp    801d53 <memfind+0xdd>
+      break;
+  801d52:	90                   	nop
+  return (void *)s;
+  801d53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+0000000000801d59 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d59:	55                   	push   %rbp
+  801d5a:	48 89 e5             	mov    %rsp,%rbp
+  801d5d:	48 83 ec 38          	sub    $0x38,%rsp
+  801d61:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d65:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d69:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801d6c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801d73:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d7a:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801d7b:	eb 05                	jmp    801d82 <strtol+0x29>
+    s++;
+  801d7d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801d82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d86:	0f b6 00             	movzbl (%rax),%eax
+  801d89:	3c 20                	cmp    $0x20,%al
+  801d8b:	74 f0                	je     801d7d <strtol+0x24>
+  801d8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d91:	0f b6 00             	movzbl (%rax),%eax
+  801d94:	3c 09                	cmp    $0x9,%al
+  801d96:	74 e5                	je     801d7d <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801d98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d9c:	0f b6 00             	movzbl (%rax),%eax
+  801d9f:	3c 2b                	cmp    $0x2b,%al
+  801da1:	75 07                	jne    801daa <strtol+0x51>
+    s++;
+  801da3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801da8:	eb 17                	jmp    801dc1 <strtol+0x68>
+  else if (*s == '-')
+  801daa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dae:	0f b6 00             	movzbl (%rax),%eax
+  801db1:	3c 2d                	cmp    $0x2d,%al
+  801db3:	75 0c                	jne    801dc1 <strtol+0x68>
+    s++, neg = 1;
+  801db5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801dba:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801dc1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dc5:	74 06                	je     801dcd <strtol+0x74>
+  801dc7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801dcb:	75 28                	jne    801df5 <strtol+0x9c>
+  801dcd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd1:	0f b6 00             	movzbl (%rax),%eax
+  801dd4:	3c 30                	cmp    $0x30,%al
+  801dd6:	75 1d                	jne    801df5 <strtol+0x9c>
+  801dd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ddc:	48 83 c0 01          	add    $0x1,%rax
+  801de0:	0f b6 00             	movzbl (%rax),%eax
+  801de3:	3c 78                	cmp    $0x78,%al
+  801de5:	75 0e                	jne    801df5 <strtol+0x9c>
+    s += 2, base = 16;
+  801de7:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801dec:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801df3:	eb 2c                	jmp    801e21 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801df5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801df9:	75 19                	jne    801e14 <strtol+0xbb>
+  801dfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dff:	0f b6 00             	movzbl (%rax),%eax
+  801e02:	3c 30                	cmp    $0x30,%al
+  801e04:	75 0e                	jne    801e14 <strtol+0xbb>
+    s++, base = 8;
+  801e06:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e0b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801e12:	eb 0d                	jmp    801e21 <strtol+0xc8>
+  else if (base == 0)
+  801e14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e18:	75 07                	jne    801e21 <strtol+0xc8>
+    base = 10;
+  801e1a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801e21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e25:	0f b6 00             	movzbl (%rax),%eax
+  801e28:	3c 2f                	cmp    $0x2f,%al
+  801e2a:	7e 1d                	jle    801e49 <strtol+0xf0>
+  801e2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e30:	0f b6 00             	movzbl (%rax),%eax
+  801e33:	3c 39                	cmp    $0x39,%al
+  801e35:	7f 12                	jg     801e49 <strtol+0xf0>
+      dig = *s - '0';
+  801e37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3b:	0f b6 00             	movzbl (%rax),%eax
+  801e3e:	0f be c0             	movsbl %al,%eax
+  801e41:	83 e8 30             	sub    $0x30,%eax
+  801e44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e47:	eb 4e                	jmp    801e97 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801e49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e4d:	0f b6 00             	movzbl (%rax),%eax
+  801e50:	3c 60                	cmp    $0x60,%al
+  801e52:	7e 1d                	jle    801e71 <strtol+0x118>
+  801e54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e58:	0f b6 00             	movzbl (%rax),%eax
+  801e5b:	3c 7a                	cmp    $0x7a,%al
+  801e5d:	7f 12                	jg     801e71 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801e5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e63:	0f b6 00             	movzbl (%rax),%eax
+  801e66:	0f be c0             	movsbl %al,%eax
+  801e69:	83 e8 57             	sub    $0x57,%eax
+  801e6c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e6f:	eb 26                	jmp    801e97 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801e71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e75:	0f b6 00             	movzbl (%rax),%eax
+  801e78:	3c 40                	cmp    $0x40,%al
+  801e7a:	7e 47                	jle    801ec3 <strtol+0x16a>
+  801e7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e80:	0f b6 00             	movzbl (%rax),%eax
+  801e83:	3c 5a                	cmp    $0x5a,%al
+  801e85:	7f 3c                	jg     801ec3 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801e87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e8b:	0f b6 00             	movzbl (%rax),%eax
+  801e8e:	0f be c0             	movsbl %al,%eax
+  801e91:	83 e8 37             	sub    $0x37,%eax
+  801e94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801e97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e9a:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e9d:	7d 23                	jge    801ec2 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801e9f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ea4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ea7:	48 98                	cltq
+  801ea9:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801eae:	48 89 c2             	mov    %rax,%rdx
+  801eb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eb4:	48 98                	cltq
+  801eb6:	48 01 d0             	add    %rdx,%rax
+  801eb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801ebd:	e9 5f ff ff ff       	jmp    801e21 <strtol+0xc8>
+      break;
+  801ec2:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801ec3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ec8:	74 0b                	je     801ed5 <strtol+0x17c>
+    *endptr = (char *)s;
+  801eca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ece:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ed2:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801ed5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ed9:	74 09                	je     801ee4 <strtol+0x18b>
+  801edb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801edf:	48 f7 d8             	neg    %rax
+  801ee2:	eb 04                	jmp    801ee8 <strtol+0x18f>
+  801ee4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+
+0000000000801eea <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801eea:	55                   	push   %rbp
+  801eeb:	48 89 e5             	mov    %rsp,%rbp
+  801eee:	53                   	push   %rbx
+  801eef:	48 83 ec 48          	sub    $0x48,%rsp
+  801ef3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ef7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801efb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801eff:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801f03:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801f07:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801f0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f13:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f17:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801f1b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f1f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f23:	4c 89 c3             	mov    %r8,%rbx
+  801f26:	cd 30                	int    $0x30
+  801f28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f2c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f31:	74 46                	je     801f79 <syscall+0x8f>
+  801f33:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f38:	7e 3f                	jle    801f79 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f42:	49 89 d0             	mov    %rdx,%r8
+  801f45:	48 89 c1             	mov    %rax,%rcx
+  801f48:	48 b8 e8 57 80 00 00 	movabs $0x8057e8,%rax
+  801f4f:	00 00 00 
+  801f52:	48 89 c2             	mov    %rax,%rdx
+  801f55:	be 22 00 00 00       	mov    $0x22,%esi
+  801f5a:	48 b8 07 58 80 00 00 	movabs $0x805807,%rax
+  801f61:	00 00 00 
+  801f64:	48 89 c7             	mov    %rax,%rdi
+  801f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6c:	49 b9 fd 01 80 00 00 	movabs $0x8001fd,%r9
+  801f73:	00 00 00 
+  801f76:	41 ff d1             	call   *%r9
+
+  return ret;
+  801f79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f81:	c9                   	leave
+  801f82:	c3                   	ret
+
+0000000000801f83 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801f83:	55                   	push   %rbp
+  801f84:	48 89 e5             	mov    %rsp,%rbp
+  801f87:	48 83 ec 10          	sub    $0x10,%rsp
+  801f8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f8f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f93:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fad:	48 89 d1             	mov    %rdx,%rcx
+  801fb0:	48 89 c2             	mov    %rax,%rdx
+  801fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fbd:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  801fc4:	00 00 00 
+  801fc7:	ff d0                	call   *%rax
+  801fc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fcd:	90                   	nop
+  801fce:	c9                   	leave
+  801fcf:	c3                   	ret
+
+0000000000801fd0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801fd0:	55                   	push   %rbp
+  801fd1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801fd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd8:	6a 00                	push   $0x0
+  801fda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801feb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ffa:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+  802006:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+
+000000000080200c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+  802010:	48 83 ec 10          	sub    $0x10,%rsp
+  802014:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802017:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80201a:	48 98                	cltq
+  80201c:	48 83 ec 08          	sub    $0x8,%rsp
+  802020:	6a 00                	push   $0x0
+  802022:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802028:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80202e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802033:	48 89 c2             	mov    %rax,%rdx
+  802036:	be 01 00 00 00       	mov    $0x1,%esi
+  80203b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802040:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+
+0000000000802052 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	48 83 ec 10          	sub    $0x10,%rsp
+  80205a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80205d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802060:	48 98                	cltq
+  802062:	48 83 ec 08          	sub    $0x8,%rsp
+  802066:	6a 00                	push   $0x0
+  802068:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80206e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802074:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802079:	48 89 c2             	mov    %rax,%rdx
+  80207c:	be 00 00 00 00       	mov    $0x0,%esi
+  802081:	bf 04 00 00 00       	mov    $0x4,%edi
+  802086:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+  802092:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802096:	90                   	nop
+  802097:	c9                   	leave
+  802098:	c3                   	ret
+
+0000000000802099 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802099:	55                   	push   %rbp
+  80209a:	48 89 e5             	mov    %rsp,%rbp
+  80209d:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8020a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020ab:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8020ae:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020b3:	cd 30                	int    $0x30
+  8020b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8020b9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8020bd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8020c2:	7e 3d                	jle    802101 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8020c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020c8:	49 89 c0             	mov    %rax,%r8
+  8020cb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8020d0:	48 b8 e8 57 80 00 00 	movabs $0x8057e8,%rax
+  8020d7:	00 00 00 
+  8020da:	48 89 c2             	mov    %rax,%rdx
+  8020dd:	be 49 00 00 00       	mov    $0x49,%esi
+  8020e2:	48 b8 07 58 80 00 00 	movabs $0x805807,%rax
+  8020e9:	00 00 00 
+  8020ec:	48 89 c7             	mov    %rax,%rdi
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	49 b9 fd 01 80 00 00 	movabs $0x8001fd,%r9
+  8020fb:	00 00 00 
+  8020fe:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802101:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802106:	75 13                	jne    80211b <sys_env_wait+0x82>
+  802108:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80210d:	74 0c                	je     80211b <sys_env_wait+0x82>
+    *status = st;
+  80210f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802113:	89 c2                	mov    %eax,%edx
+  802115:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802119:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80211b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+
+0000000000802121 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802125:	48 83 ec 08          	sub    $0x8,%rsp
+  802129:	6a 00                	push   $0x0
+  80212b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80213c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802141:	be 00 00 00 00       	mov    $0x0,%esi
+  802146:	bf 02 00 00 00       	mov    $0x2,%edi
+  80214b:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802152:	00 00 00 
+  802155:	ff d0                	call   *%rax
+  802157:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+
+000000000080215d <sys_yield>:
+
+void
+sys_yield(void) {
+  80215d:	55                   	push   %rbp
+  80215e:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802161:	48 83 ec 08          	sub    $0x8,%rsp
+  802165:	6a 00                	push   $0x0
+  802167:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802173:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217d:	be 00 00 00 00       	mov    $0x0,%esi
+  802182:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802187:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+  802193:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802197:	90                   	nop
+  802198:	c9                   	leave
+  802199:	c3                   	ret
+
+000000000080219a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80219a:	55                   	push   %rbp
+  80219b:	48 89 e5             	mov    %rsp,%rbp
+  80219e:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8021a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021a9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8021ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8021af:	48 63 c8             	movslq %eax,%rcx
+  8021b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8021b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021b9:	48 98                	cltq
+  8021bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8021bf:	6a 00                	push   $0x0
+  8021c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c7:	49 89 c8             	mov    %rcx,%r8
+  8021ca:	48 89 d1             	mov    %rdx,%rcx
+  8021cd:	48 89 c2             	mov    %rax,%rdx
+  8021d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021da:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8021e1:	00 00 00 
+  8021e4:	ff d0                	call   *%rax
+  8021e6:	48 83 c4 10          	add    $0x10,%rsp
+  8021ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8021ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+00000000008021f2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8021f2:	55                   	push   %rbp
+  8021f3:	48 89 e5             	mov    %rsp,%rbp
+  8021f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8021fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802201:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802204:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802208:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80220c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80220f:	48 63 c8             	movslq %eax,%rcx
+  802212:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802216:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802219:	48 63 f0             	movslq %eax,%rsi
+  80221c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802223:	48 98                	cltq
+  802225:	48 83 ec 08          	sub    $0x8,%rsp
+  802229:	51                   	push   %rcx
+  80222a:	49 89 f9             	mov    %rdi,%r9
+  80222d:	49 89 f0             	mov    %rsi,%r8
+  802230:	48 89 d1             	mov    %rdx,%rcx
+  802233:	48 89 c2             	mov    %rax,%rdx
+  802236:	be 01 00 00 00       	mov    $0x1,%esi
+  80223b:	bf 07 00 00 00       	mov    $0x7,%edi
+  802240:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+0000000000802252 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	48 83 ec 10          	sub    $0x10,%rsp
+  80225a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80225d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802261:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802265:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802268:	48 98                	cltq
+  80226a:	48 83 ec 08          	sub    $0x8,%rsp
+  80226e:	6a 00                	push   $0x0
+  802270:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802276:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80227c:	48 89 d1             	mov    %rdx,%rcx
+  80227f:	48 89 c2             	mov    %rax,%rdx
+  802282:	be 01 00 00 00       	mov    $0x1,%esi
+  802287:	bf 08 00 00 00       	mov    $0x8,%edi
+  80228c:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+  802298:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+000000000080229e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80229e:	55                   	push   %rbp
+  80229f:	48 89 e5             	mov    %rsp,%rbp
+  8022a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022a9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022af:	48 63 d0             	movslq %eax,%rdx
+  8022b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022b5:	48 98                	cltq
+  8022b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022bb:	6a 00                	push   $0x0
+  8022bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022c9:	48 89 d1             	mov    %rdx,%rcx
+  8022cc:	48 89 c2             	mov    %rax,%rdx
+  8022cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8022d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022d9:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8022e0:	00 00 00 
+  8022e3:	ff d0                	call   *%rax
+  8022e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+
+00000000008022eb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8022eb:	55                   	push   %rbp
+  8022ec:	48 89 e5             	mov    %rsp,%rbp
+  8022ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8022fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802301:	48 98                	cltq
+  802303:	48 83 ec 08          	sub    $0x8,%rsp
+  802307:	6a 00                	push   $0x0
+  802309:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80230f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802315:	48 89 d1             	mov    %rdx,%rcx
+  802318:	48 89 c2             	mov    %rax,%rdx
+  80231b:	be 01 00 00 00       	mov    $0x1,%esi
+  802320:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802325:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+  802331:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802335:	c9                   	leave
+  802336:	c3                   	ret
+
+0000000000802337 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	48 83 ec 10          	sub    $0x10,%rsp
+  80233f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802342:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802346:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80234a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80234d:	48 98                	cltq
+  80234f:	48 83 ec 08          	sub    $0x8,%rsp
+  802353:	6a 00                	push   $0x0
+  802355:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80235b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802361:	48 89 d1             	mov    %rdx,%rcx
+  802364:	48 89 c2             	mov    %rax,%rdx
+  802367:	be 01 00 00 00       	mov    $0x1,%esi
+  80236c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802371:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802378:	00 00 00 
+  80237b:	ff d0                	call   *%rax
+  80237d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802381:	c9                   	leave
+  802382:	c3                   	ret
+
+0000000000802383 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	48 83 ec 20          	sub    $0x20,%rsp
+  80238b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80238e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802392:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802396:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802399:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80239c:	48 63 f0             	movslq %eax,%rsi
+  80239f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023aa:	48 98                	cltq
+  8023ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b0:	6a 00                	push   $0x0
+  8023b2:	49 89 f1             	mov    %rsi,%r9
+  8023b5:	49 89 c8             	mov    %rcx,%r8
+  8023b8:	48 89 d1             	mov    %rdx,%rcx
+  8023bb:	48 89 c2             	mov    %rax,%rdx
+  8023be:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8023c8:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d8:	c9                   	leave
+  8023d9:	c3                   	ret
+
+00000000008023da <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8023e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ee:	6a 00                	push   $0x0
+  8023f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802401:	48 89 c2             	mov    %rax,%rdx
+  802404:	be 01 00 00 00       	mov    $0x1,%esi
+  802409:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80240e:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+  80241a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80241e:	c9                   	leave
+  80241f:	c3                   	ret
+
+0000000000802420 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802420:	55                   	push   %rbp
+  802421:	48 89 e5             	mov    %rsp,%rbp
+  802424:	48 83 ec 10          	sub    $0x10,%rsp
+  802428:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80242c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802430:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802434:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802438:	48 83 ec 08          	sub    $0x8,%rsp
+  80243c:	6a 00                	push   $0x0
+  80243e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802444:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80244a:	48 89 d1             	mov    %rdx,%rcx
+  80244d:	48 89 c2             	mov    %rax,%rdx
+  802450:	be 01 00 00 00       	mov    $0x1,%esi
+  802455:	bf 10 00 00 00       	mov    $0x10,%edi
+  80245a:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+  802466:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+000000000080246c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802470:	48 83 ec 08          	sub    $0x8,%rsp
+  802474:	6a 00                	push   $0x0
+  802476:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80247c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248c:	be 00 00 00 00       	mov    $0x0,%esi
+  802491:	bf 11 00 00 00       	mov    $0x11,%edi
+  802496:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80249d:	00 00 00 
+  8024a0:	ff d0                	call   *%rax
+  8024a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a6:	c9                   	leave
+  8024a7:	c3                   	ret
+
+00000000008024a8 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8024a8:	55                   	push   %rbp
+  8024a9:	48 89 e5             	mov    %rsp,%rbp
+  8024ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8024b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c4:	6a 00                	push   $0x0
+  8024c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024d2:	48 89 d1             	mov    %rdx,%rcx
+  8024d5:	48 89 c2             	mov    %rax,%rdx
+  8024d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024dd:	bf 12 00 00 00       	mov    $0x12,%edi
+  8024e2:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8024e9:	00 00 00 
+  8024ec:	ff d0                	call   *%rax
+  8024ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f2:	c9                   	leave
+  8024f3:	c3                   	ret
+
+00000000008024f4 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8024f4:	55                   	push   %rbp
+  8024f5:	48 89 e5             	mov    %rsp,%rbp
+  8024f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8024fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802500:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802504:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802507:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80250a:	48 63 c8             	movslq %eax,%rcx
+  80250d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802515:	48 83 ec 08          	sub    $0x8,%rsp
+  802519:	6a 00                	push   $0x0
+  80251b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802521:	49 89 c8             	mov    %rcx,%r8
+  802524:	48 89 d1             	mov    %rdx,%rcx
+  802527:	48 89 c2             	mov    %rax,%rdx
+  80252a:	be 00 00 00 00       	mov    $0x0,%esi
+  80252f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802534:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802544:	c9                   	leave
+  802545:	c3                   	ret
+
+0000000000802546 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802546:	55                   	push   %rbp
+  802547:	48 89 e5             	mov    %rsp,%rbp
+  80254a:	48 83 ec 20          	sub    $0x20,%rsp
+  80254e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802552:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802555:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802559:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80255d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802560:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802564:	48 83 ec 08          	sub    $0x8,%rsp
+  802568:	6a 00                	push   $0x0
+  80256a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802570:	49 89 c8             	mov    %rcx,%r8
+  802573:	48 89 d1             	mov    %rdx,%rcx
+  802576:	48 89 c2             	mov    %rax,%rdx
+  802579:	be 00 00 00 00       	mov    $0x0,%esi
+  80257e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802583:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80258a:	00 00 00 
+  80258d:	ff d0                	call   *%rax
+  80258f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802593:	c9                   	leave
+  802594:	c3                   	ret
+
+0000000000802595 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802595:	55                   	push   %rbp
+  802596:	48 89 e5             	mov    %rsp,%rbp
+  802599:	48 83 ec 10          	sub    $0x10,%rsp
+  80259d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8025a4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025a7:	48 63 d0             	movslq %eax,%rdx
+  8025aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b2:	6a 00                	push   $0x0
+  8025b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c0:	48 89 d1             	mov    %rdx,%rcx
+  8025c3:	48 89 c2             	mov    %rax,%rdx
+  8025c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cb:	bf 15 00 00 00       	mov    $0x15,%edi
+  8025d0:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+  8025dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e0:	c9                   	leave
+  8025e1:	c3                   	ret
+
+00000000008025e2 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8025e2:	55                   	push   %rbp
+  8025e3:	48 89 e5             	mov    %rsp,%rbp
+  8025e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8025ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025ee:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8025f1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8025f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8025f8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025fc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8025ff:	48 63 c8             	movslq %eax,%rcx
+  802602:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802605:	48 63 d0             	movslq %eax,%rdx
+  802608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260c:	48 83 ec 08          	sub    $0x8,%rsp
+  802610:	6a 00                	push   $0x0
+  802612:	49 89 f1             	mov    %rsi,%r9
+  802615:	49 89 c8             	mov    %rcx,%r8
+  802618:	48 89 d1             	mov    %rdx,%rcx
+  80261b:	48 89 c2             	mov    %rax,%rdx
+  80261e:	be 00 00 00 00       	mov    $0x0,%esi
+  802623:	bf 16 00 00 00       	mov    $0x16,%edi
+  802628:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80262f:	00 00 00 
+  802632:	ff d0                	call   *%rax
+  802634:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802638:	c9                   	leave
+  802639:	c3                   	ret
+
+000000000080263a <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80263a:	55                   	push   %rbp
+  80263b:	48 89 e5             	mov    %rsp,%rbp
+  80263e:	48 83 ec 30          	sub    $0x30,%rsp
+  802642:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802646:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80264a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80264e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802652:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802656:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80265a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80265e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802662:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80266a:	48 83 ec 08          	sub    $0x8,%rsp
+  80266e:	51                   	push   %rcx
+  80266f:	49 89 f9             	mov    %rdi,%r9
+  802672:	49 89 f0             	mov    %rsi,%r8
+  802675:	48 89 d1             	mov    %rdx,%rcx
+  802678:	48 89 c2             	mov    %rax,%rdx
+  80267b:	be 00 00 00 00       	mov    $0x0,%esi
+  802680:	bf 17 00 00 00       	mov    $0x17,%edi
+  802685:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80268c:	00 00 00 
+  80268f:	ff d0                	call   *%rax
+  802691:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+
+0000000000802697 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+  80269b:	48 83 ec 10          	sub    $0x10,%rsp
+  80269f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8026a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026a5:	48 98                	cltq
+  8026a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ab:	6a 00                	push   $0x0
+  8026ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026be:	48 89 c2             	mov    %rax,%rdx
+  8026c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026cb:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026db:	90                   	nop
+  8026dc:	c9                   	leave
+  8026dd:	c3                   	ret
+
+00000000008026de <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8026de:	55                   	push   %rbp
+  8026df:	48 89 e5             	mov    %rsp,%rbp
+  8026e2:	48 83 ec 30          	sub    $0x30,%rsp
+  8026e6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026ed:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8026f1:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8026f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026f7:	48 63 f0             	movslq %eax,%rsi
+  8026fa:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802702:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802705:	48 98                	cltq
+  802707:	48 83 ec 08          	sub    $0x8,%rsp
+  80270b:	6a 00                	push   $0x0
+  80270d:	49 89 f1             	mov    %rsi,%r9
+  802710:	49 89 c8             	mov    %rcx,%r8
+  802713:	48 89 d1             	mov    %rdx,%rcx
+  802716:	48 89 c2             	mov    %rax,%rdx
+  802719:	be 01 00 00 00       	mov    $0x1,%esi
+  80271e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802723:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80272a:	00 00 00 
+  80272d:	ff d0                	call   *%rax
+  80272f:	48 83 c4 10          	add    $0x10,%rsp
+  802733:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802736:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+000000000080273b <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	48 83 ec 20          	sub    $0x20,%rsp
+  802743:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802747:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80274e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802751:	48 63 c8             	movslq %eax,%rcx
+  802754:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80275c:	48 83 ec 08          	sub    $0x8,%rsp
+  802760:	6a 00                	push   $0x0
+  802762:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802768:	49 89 c8             	mov    %rcx,%r8
+  80276b:	48 89 d1             	mov    %rdx,%rcx
+  80276e:	48 89 c2             	mov    %rax,%rdx
+  802771:	be 01 00 00 00       	mov    $0x1,%esi
+  802776:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80277b:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+  802787:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278b:	c9                   	leave
+  80278c:	c3                   	ret
+
+000000000080278d <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80278d:	55                   	push   %rbp
+  80278e:	48 89 e5             	mov    %rsp,%rbp
+  802791:	48 83 ec 20          	sub    $0x20,%rsp
+  802795:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802799:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80279d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8027a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b1:	6a 00                	push   $0x0
+  8027b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b9:	49 89 c8             	mov    %rcx,%r8
+  8027bc:	48 89 d1             	mov    %rdx,%rcx
+  8027bf:	48 89 c2             	mov    %rax,%rdx
+  8027c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8027c7:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8027cc:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+  8027d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+
+00000000008027de <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8027de:	55                   	push   %rbp
+  8027df:	48 89 e5             	mov    %rsp,%rbp
+  8027e2:	48 83 ec 30          	sub    $0x30,%rsp
+  8027e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8027ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027ee:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8027f1:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8027f5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027fc:	48 63 c8             	movslq %eax,%rcx
+  8027ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802803:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802807:	48 83 ec 08          	sub    $0x8,%rsp
+  80280b:	6a 00                	push   $0x0
+  80280d:	49 89 f1             	mov    %rsi,%r9
+  802810:	49 89 c8             	mov    %rcx,%r8
+  802813:	48 89 d1             	mov    %rdx,%rcx
+  802816:	48 89 c2             	mov    %rax,%rdx
+  802819:	be 01 00 00 00       	mov    $0x1,%esi
+  80281e:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802823:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	48 83 c4 10          	add    $0x10,%rsp
+  802833:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802836:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802839:	c9                   	leave
+  80283a:	c3                   	ret
+
+000000000080283b <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80283b:	55                   	push   %rbp
+  80283c:	48 89 e5             	mov    %rsp,%rbp
+  80283f:	48 83 ec 10          	sub    $0x10,%rsp
+  802843:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802846:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802849:	48 98                	cltq
+  80284b:	48 83 ec 08          	sub    $0x8,%rsp
+  80284f:	6a 00                	push   $0x0
+  802851:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802857:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80285d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802862:	48 89 c2             	mov    %rax,%rdx
+  802865:	be 01 00 00 00       	mov    $0x1,%esi
+  80286a:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80286f:	48 b8 ea 1e 80 00 00 	movabs $0x801eea,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+  80287b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80287f:	c9                   	leave
+  802880:	c3                   	ret
+
+0000000000802881 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	48 83 ec 20          	sub    $0x20,%rsp
+  802889:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80288d:	48 b8 21 21 80 00 00 	movabs $0x802121,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+  802899:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  80289c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8028a3:	00 00 00 
+  8028a6:	48 8b 00             	mov    (%rax),%rax
+  8028a9:	48 85 c0             	test   %rax,%rax
+  8028ac:	75 62                	jne    802910 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  8028ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028b1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8028b6:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8028bd:	00 00 00 
+  8028c0:	48 89 ce             	mov    %rcx,%rsi
+  8028c3:	89 c7                	mov    %eax,%edi
+  8028c5:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+  8028d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8028d4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8028d8:	79 36                	jns    802910 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8028da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8028dd:	89 c1                	mov    %eax,%ecx
+  8028df:	48 b8 15 58 80 00 00 	movabs $0x805815,%rax
+  8028e6:	00 00 00 
+  8028e9:	48 89 c2             	mov    %rax,%rdx
+  8028ec:	be 23 00 00 00       	mov    $0x23,%esi
+  8028f1:	48 b8 2d 58 80 00 00 	movabs $0x80582d,%rax
+  8028f8:	00 00 00 
+  8028fb:	48 89 c7             	mov    %rax,%rdi
+  8028fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802903:	49 b8 fd 01 80 00 00 	movabs $0x8001fd,%r8
+  80290a:	00 00 00 
+  80290d:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802910:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802917:	00 00 00 
+  80291a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291e:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  802921:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802924:	48 ba 81 29 80 00 00 	movabs $0x802981,%rdx
+  80292b:	00 00 00 
+  80292e:	48 89 d6             	mov    %rdx,%rsi
+  802931:	89 c7                	mov    %eax,%edi
+  802933:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  80293a:	00 00 00 
+  80293d:	ff d0                	call   *%rax
+  80293f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  802942:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802946:	79 36                	jns    80297e <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  802948:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80294b:	89 c1                	mov    %eax,%ecx
+  80294d:	48 b8 15 58 80 00 00 	movabs $0x805815,%rax
+  802954:	00 00 00 
+  802957:	48 89 c2             	mov    %rax,%rdx
+  80295a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80295f:	48 b8 2d 58 80 00 00 	movabs $0x80582d,%rax
+  802966:	00 00 00 
+  802969:	48 89 c7             	mov    %rax,%rdi
+  80296c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802971:	49 b8 fd 01 80 00 00 	movabs $0x8001fd,%r8
+  802978:	00 00 00 
+  80297b:	41 ff d0             	call   *%r8
+}
+  80297e:	90                   	nop
+  80297f:	c9                   	leave
+  802980:	c3                   	ret
+
+0000000000802981 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  802981:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  802984:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  802987:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  80298e:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  802992:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  802997:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  80299e:	00 00 00 
+	call *%rax
+  8029a1:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8029a3:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8029a8:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8029ab:	41 5f                	pop    %r15
+	popq %r15
+  8029ad:	41 5f                	pop    %r15
+	popq %r15
+  8029af:	41 5f                	pop    %r15
+	popq %r14
+  8029b1:	41 5e                	pop    %r14
+	popq %r13
+  8029b3:	41 5d                	pop    %r13
+	popq %r12
+  8029b5:	41 5c                	pop    %r12
+	popq %r11
+  8029b7:	41 5b                	pop    %r11
+	popq %r10
+  8029b9:	41 5a                	pop    %r10
+	popq %r9
+  8029bb:	41 59                	pop    %r9
+	popq %r8
+  8029bd:	41 58                	pop    %r8
+	popq %rsi
+  8029bf:	5e                   	pop    %rsi
+	popq %rdi
+  8029c0:	5f                   	pop    %rdi
+	popq %rbp
+  8029c1:	5d                   	pop    %rbp
+	popq %rdx
+  8029c2:	5a                   	pop    %rdx
+	popq %rcx
+  8029c3:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8029c4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8029c9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8029ce:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8029d2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8029d5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8029da:	5b                   	pop    %rbx
+	popq %rax
+  8029db:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8029dc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8029e0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8029e1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8029e6:	c3                   	ret
+
+00000000008029e7 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8029e7:	55                   	push   %rbp
+  8029e8:	48 89 e5             	mov    %rsp,%rbp
+  8029eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8029f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f7:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8029fe:	ff ff ff 
+  802a01:	48 01 d0             	add    %rdx,%rax
+  802a04:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+
+0000000000802a0a <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802a0a:	55                   	push   %rbp
+  802a0b:	48 89 e5             	mov    %rsp,%rbp
+  802a0e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a1a:	48 89 c7             	mov    %rax,%rdi
+  802a1d:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802a24:	00 00 00 
+  802a27:	ff d0                	call   *%rax
+  802a29:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802a2f:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+
+0000000000802a35 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	48 83 ec 18          	sub    $0x18,%rsp
+  802a3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802a41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a48:	e9 ae 00 00 00       	jmp    802afb <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802a4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a50:	c1 e0 0c             	shl    $0xc,%eax
+  802a53:	48 98                	cltq
+  802a55:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a5a:	48 01 d0             	add    %rdx,%rax
+  802a5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a65:	48 c1 e8 27          	shr    $0x27,%rax
+  802a69:	48 89 c2             	mov    %rax,%rdx
+  802a6c:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a73:	01 00 00 
+  802a76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a7a:	83 e0 01             	and    $0x1,%eax
+  802a7d:	48 85 c0             	test   %rax,%rax
+  802a80:	74 63                	je     802ae5 <fd_alloc+0xb0>
+  802a82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a86:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a8a:	48 89 c2             	mov    %rax,%rdx
+  802a8d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802a94:	01 00 00 
+  802a97:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a9b:	83 e0 01             	and    $0x1,%eax
+  802a9e:	48 85 c0             	test   %rax,%rax
+  802aa1:	74 42                	je     802ae5 <fd_alloc+0xb0>
+  802aa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aa7:	48 c1 e8 15          	shr    $0x15,%rax
+  802aab:	48 89 c2             	mov    %rax,%rdx
+  802aae:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ab5:	01 00 00 
+  802ab8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802abc:	83 e0 01             	and    $0x1,%eax
+  802abf:	48 85 c0             	test   %rax,%rax
+  802ac2:	74 21                	je     802ae5 <fd_alloc+0xb0>
+  802ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802acc:	48 89 c2             	mov    %rax,%rdx
+  802acf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ad6:	01 00 00 
+  802ad9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802add:	83 e0 01             	and    $0x1,%eax
+  802ae0:	48 85 c0             	test   %rax,%rax
+  802ae3:	75 12                	jne    802af7 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802ae5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802aed:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af5:	eb 1e                	jmp    802b15 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802af7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802afb:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802aff:	0f 8e 48 ff ff ff    	jle    802a4d <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802b05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b09:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b10:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+0000000000802b17 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b17:	55                   	push   %rbp
+  802b18:	48 89 e5             	mov    %rsp,%rbp
+  802b1b:	48 83 ec 20          	sub    $0x20,%rsp
+  802b1f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b22:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b2a:	78 06                	js     802b32 <fd_lookup+0x1b>
+  802b2c:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b30:	7e 0a                	jle    802b3c <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b37:	e9 af 00 00 00       	jmp    802beb <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802b3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b3f:	c1 e0 0c             	shl    $0xc,%eax
+  802b42:	48 98                	cltq
+  802b44:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b49:	48 01 d0             	add    %rdx,%rax
+  802b4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b54:	48 c1 e8 27          	shr    $0x27,%rax
+  802b58:	48 89 c2             	mov    %rax,%rdx
+  802b5b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b62:	01 00 00 
+  802b65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b69:	83 e0 01             	and    $0x1,%eax
+  802b6c:	48 85 c0             	test   %rax,%rax
+  802b6f:	74 63                	je     802bd4 <fd_lookup+0xbd>
+  802b71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b75:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b79:	48 89 c2             	mov    %rax,%rdx
+  802b7c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b83:	01 00 00 
+  802b86:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b8a:	83 e0 01             	and    $0x1,%eax
+  802b8d:	48 85 c0             	test   %rax,%rax
+  802b90:	74 42                	je     802bd4 <fd_lookup+0xbd>
+  802b92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b96:	48 c1 e8 15          	shr    $0x15,%rax
+  802b9a:	48 89 c2             	mov    %rax,%rdx
+  802b9d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ba4:	01 00 00 
+  802ba7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bab:	83 e0 01             	and    $0x1,%eax
+  802bae:	48 85 c0             	test   %rax,%rax
+  802bb1:	74 21                	je     802bd4 <fd_lookup+0xbd>
+  802bb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb7:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bbb:	48 89 c2             	mov    %rax,%rdx
+  802bbe:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bc5:	01 00 00 
+  802bc8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bcc:	83 e0 01             	and    $0x1,%eax
+  802bcf:	48 85 c0             	test   %rax,%rax
+  802bd2:	75 07                	jne    802bdb <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802bd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd9:	eb 10                	jmp    802beb <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802bdb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bdf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802be3:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+
+0000000000802bed <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802bed:	55                   	push   %rbp
+  802bee:	48 89 e5             	mov    %rsp,%rbp
+  802bf1:	48 83 ec 30          	sub    $0x30,%rsp
+  802bf5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802bf9:	89 f0                	mov    %esi,%eax
+  802bfb:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c02:	48 89 c7             	mov    %rax,%rdi
+  802c05:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802c0c:	00 00 00 
+  802c0f:	ff d0                	call   *%rax
+  802c11:	89 c2                	mov    %eax,%edx
+  802c13:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c17:	48 89 c6             	mov    %rax,%rsi
+  802c1a:	89 d7                	mov    %edx,%edi
+  802c1c:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  802c23:	00 00 00 
+  802c26:	ff d0                	call   *%rax
+  802c28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c2f:	78 0a                	js     802c3b <fd_close+0x4e>
+  802c31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c35:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802c39:	74 12                	je     802c4d <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802c3b:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802c3f:	74 05                	je     802c46 <fd_close+0x59>
+  802c41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c44:	eb 70                	jmp    802cb6 <fd_close+0xc9>
+  802c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4b:	eb 69                	jmp    802cb6 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c51:	8b 00                	mov    (%rax),%eax
+  802c53:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c57:	48 89 d6             	mov    %rdx,%rsi
+  802c5a:	89 c7                	mov    %eax,%edi
+  802c5c:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  802c63:	00 00 00 
+  802c66:	ff d0                	call   *%rax
+  802c68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c6f:	78 2a                	js     802c9b <fd_close+0xae>
+    if (dev->dev_close)
+  802c71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c75:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c79:	48 85 c0             	test   %rax,%rax
+  802c7c:	74 16                	je     802c94 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802c7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c82:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c8a:	48 89 c7             	mov    %rax,%rdi
+  802c8d:	ff d2                	call   *%rdx
+  802c8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c92:	eb 07                	jmp    802c9b <fd_close+0xae>
+    else
+      r = 0;
+  802c94:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802c9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c9f:	48 89 c6             	mov    %rax,%rsi
+  802ca2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca7:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  802cae:	00 00 00 
+  802cb1:	ff d0                	call   *%rax
+  return r;
+  802cb3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+
+0000000000802cb8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802cb8:	55                   	push   %rbp
+  802cb9:	48 89 e5             	mov    %rsp,%rbp
+  802cbc:	48 83 ec 20          	sub    $0x20,%rsp
+  802cc0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cc3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802cc7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802cce:	eb 3f                	jmp    802d0f <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802cd0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cd7:	00 00 00 
+  802cda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cdd:	48 98                	cltq
+  802cdf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ce3:	8b 00                	mov    (%rax),%eax
+  802ce5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802ce8:	75 21                	jne    802d0b <dev_lookup+0x53>
+      *dev = devtab[i];
+  802cea:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cf1:	00 00 00 
+  802cf4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cf7:	48 98                	cltq
+  802cf9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cfd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d01:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d09:	eb 7f                	jmp    802d8a <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802d0b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d0f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d16:	00 00 00 
+  802d19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d1c:	48 98                	cltq
+  802d1e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d22:	48 85 c0             	test   %rax,%rax
+  802d25:	75 a9                	jne    802cd0 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d27:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d2e:	00 00 00 
+  802d31:	8b 40 04             	mov    0x4(%rax),%eax
+  802d34:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d39:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d40:	00 00 00 
+  802d43:	48 98                	cltq
+  802d45:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802d4c:	48 01 d0             	add    %rdx,%rax
+  802d4f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802d55:	8b 00                	mov    (%rax),%eax
+  802d57:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d5a:	89 c6                	mov    %eax,%esi
+  802d5c:	48 b8 40 58 80 00 00 	movabs $0x805840,%rax
+  802d63:	00 00 00 
+  802d66:	48 89 c7             	mov    %rax,%rdi
+  802d69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6e:	48 b9 1c 04 80 00 00 	movabs $0x80041c,%rcx
+  802d75:	00 00 00 
+  802d78:	ff d1                	call   *%rcx
+  *dev = 0;
+  802d7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d7e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802d85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d8a:	c9                   	leave
+  802d8b:	c3                   	ret
+
+0000000000802d8c <close>:
+
+int
+close(int fdnum) {
+  802d8c:	55                   	push   %rbp
+  802d8d:	48 89 e5             	mov    %rsp,%rbp
+  802d90:	48 83 ec 20          	sub    $0x20,%rsp
+  802d94:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d97:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d9e:	48 89 d6             	mov    %rdx,%rsi
+  802da1:	89 c7                	mov    %eax,%edi
+  802da3:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  802daa:	00 00 00 
+  802dad:	ff d0                	call   *%rax
+  802daf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802db2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802db6:	79 05                	jns    802dbd <close+0x31>
+    return r;
+  802db8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dbb:	eb 18                	jmp    802dd5 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802dbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc1:	be 01 00 00 00       	mov    $0x1,%esi
+  802dc6:	48 89 c7             	mov    %rax,%rdi
+  802dc9:	48 b8 ed 2b 80 00 00 	movabs $0x802bed,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+}
+  802dd5:	c9                   	leave
+  802dd6:	c3                   	ret
+
+0000000000802dd7 <close_all>:
+
+void
+close_all(void) {
+  802dd7:	55                   	push   %rbp
+  802dd8:	48 89 e5             	mov    %rsp,%rbp
+  802ddb:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802ddf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802de6:	eb 15                	jmp    802dfd <close_all+0x26>
+    close(i);
+  802de8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802deb:	89 c7                	mov    %eax,%edi
+  802ded:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802df9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802dfd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802e01:	7e e5                	jle    802de8 <close_all+0x11>
+}
+  802e03:	90                   	nop
+  802e04:	90                   	nop
+  802e05:	c9                   	leave
+  802e06:	c3                   	ret
+
+0000000000802e07 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802e07:	55                   	push   %rbp
+  802e08:	48 89 e5             	mov    %rsp,%rbp
+  802e0b:	48 83 ec 40          	sub    $0x40,%rsp
+  802e0f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e12:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e15:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e19:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e1c:	48 89 d6             	mov    %rdx,%rsi
+  802e1f:	89 c7                	mov    %eax,%edi
+  802e21:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  802e28:	00 00 00 
+  802e2b:	ff d0                	call   *%rax
+  802e2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e34:	79 08                	jns    802e3e <dup+0x37>
+    return r;
+  802e36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e39:	e9 33 02 00 00       	jmp    803071 <dup+0x26a>
+  close(newfdnum);
+  802e3e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e41:	89 c7                	mov    %eax,%edi
+  802e43:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802e4f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e52:	c1 e0 0c             	shl    $0xc,%eax
+  802e55:	48 98                	cltq
+  802e57:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802e5c:	48 01 d0             	add    %rdx,%rax
+  802e5f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802e63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e67:	48 89 c7             	mov    %rax,%rdi
+  802e6a:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e7e:	48 89 c7             	mov    %rax,%rdi
+  802e81:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+  802e8d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802e91:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802e98:	00 
+  802e99:	e9 19 01 00 00       	jmp    802fb7 <dup+0x1b0>
+    off -= PGSIZE;
+  802e9e:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802ea5:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ea6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802eaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eae:	48 01 d0             	add    %rdx,%rax
+  802eb1:	48 c1 e8 27          	shr    $0x27,%rax
+  802eb5:	48 89 c2             	mov    %rax,%rdx
+  802eb8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ebf:	01 00 00 
+  802ec2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ec6:	83 e0 01             	and    $0x1,%eax
+  802ec9:	48 85 c0             	test   %rax,%rax
+  802ecc:	0f 84 e5 00 00 00    	je     802fb7 <dup+0x1b0>
+  802ed2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ed6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eda:	48 01 d0             	add    %rdx,%rax
+  802edd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ee1:	48 89 c2             	mov    %rax,%rdx
+  802ee4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802eeb:	01 00 00 
+  802eee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ef2:	83 e0 01             	and    $0x1,%eax
+  802ef5:	48 85 c0             	test   %rax,%rax
+  802ef8:	0f 84 b9 00 00 00    	je     802fb7 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802efe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f06:	48 01 d0             	add    %rdx,%rax
+  802f09:	48 c1 e8 15          	shr    $0x15,%rax
+  802f0d:	48 89 c2             	mov    %rax,%rdx
+  802f10:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f17:	01 00 00 
+  802f1a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f1e:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f21:	48 85 c0             	test   %rax,%rax
+  802f24:	0f 84 8d 00 00 00    	je     802fb7 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f2a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f32:	48 01 d0             	add    %rdx,%rax
+  802f35:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f39:	48 89 c2             	mov    %rax,%rdx
+  802f3c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f43:	01 00 00 
+  802f46:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f4a:	83 e0 01             	and    $0x1,%eax
+  802f4d:	48 85 c0             	test   %rax,%rax
+  802f50:	74 65                	je     802fb7 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802f52:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f5a:	48 01 d0             	add    %rdx,%rax
+  802f5d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f61:	48 89 c2             	mov    %rax,%rdx
+  802f64:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f6b:	01 00 00 
+  802f6e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f72:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f77:	89 c6                	mov    %eax,%esi
+  802f79:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f81:	48 01 c2             	add    %rax,%rdx
+  802f84:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f8c:	48 01 c8             	add    %rcx,%rax
+  802f8f:	41 89 f0             	mov    %esi,%r8d
+  802f92:	48 89 d1             	mov    %rdx,%rcx
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	48 89 c6             	mov    %rax,%rsi
+  802f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa2:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  802fa9:	00 00 00 
+  802fac:	ff d0                	call   *%rax
+  802fae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fb5:	78 60                	js     803017 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802fb7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802fbc:	0f 85 dc fe ff ff    	jne    802e9e <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802fc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fc6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fca:	48 89 c2             	mov    %rax,%rdx
+  802fcd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fd4:	01 00 00 
+  802fd7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fdb:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fe0:	89 c1                	mov    %eax,%ecx
+  802fe2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fe6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fea:	41 89 c8             	mov    %ecx,%r8d
+  802fed:	48 89 d1             	mov    %rdx,%rcx
+  802ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff5:	48 89 c6             	mov    %rax,%rsi
+  802ff8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffd:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  803004:	00 00 00 
+  803007:	ff d0                	call   *%rax
+  803009:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80300c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803010:	78 08                	js     80301a <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803012:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803015:	eb 5a                	jmp    803071 <dup+0x26a>
+        goto err;
+  803017:	90                   	nop
+  803018:	eb 01                	jmp    80301b <dup+0x214>
+    goto err;
+  80301a:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80301b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80301f:	48 89 c6             	mov    %rax,%rsi
+  803022:	bf 00 00 00 00       	mov    $0x0,%edi
+  803027:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  80302e:	00 00 00 
+  803031:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803033:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80303a:	00 
+  80303b:	eb 27                	jmp    803064 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80303d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803041:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803045:	48 01 d0             	add    %rdx,%rax
+  803048:	48 89 c6             	mov    %rax,%rsi
+  80304b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803050:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80305c:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803063:	00 
+  803064:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80306b:	00 
+  80306c:	76 cf                	jbe    80303d <dup+0x236>
+  return r;
+  80306e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803071:	c9                   	leave
+  803072:	c3                   	ret
+
+0000000000803073 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803073:	55                   	push   %rbp
+  803074:	48 89 e5             	mov    %rsp,%rbp
+  803077:	48 83 ec 40          	sub    $0x40,%rsp
+  80307b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80307e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803082:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803086:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80308a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80308d:	48 89 d6             	mov    %rdx,%rsi
+  803090:	89 c7                	mov    %eax,%edi
+  803092:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  803099:	00 00 00 
+  80309c:	ff d0                	call   *%rax
+  80309e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030a5:	78 24                	js     8030cb <read+0x58>
+  8030a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ab:	8b 00                	mov    (%rax),%eax
+  8030ad:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030b1:	48 89 d6             	mov    %rdx,%rsi
+  8030b4:	89 c7                	mov    %eax,%edi
+  8030b6:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030c9:	79 0a                	jns    8030d5 <read+0x62>
+    return r;
+  8030cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ce:	48 98                	cltq
+  8030d0:	e9 9e 00 00 00       	jmp    803173 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8030d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030d9:	8b 40 08             	mov    0x8(%rax),%eax
+  8030dc:	83 e0 03             	and    $0x3,%eax
+  8030df:	83 f8 01             	cmp    $0x1,%eax
+  8030e2:	75 5c                	jne    803140 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030e4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030eb:	00 00 00 
+  8030ee:	8b 40 04             	mov    0x4(%rax),%eax
+  8030f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030f6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030fd:	00 00 00 
+  803100:	48 98                	cltq
+  803102:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803109:	48 01 d0             	add    %rdx,%rax
+  80310c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803112:	8b 00                	mov    (%rax),%eax
+  803114:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803117:	89 c6                	mov    %eax,%esi
+  803119:	48 b8 5f 58 80 00 00 	movabs $0x80585f,%rax
+  803120:	00 00 00 
+  803123:	48 89 c7             	mov    %rax,%rdi
+  803126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312b:	48 b9 1c 04 80 00 00 	movabs $0x80041c,%rcx
+  803132:	00 00 00 
+  803135:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803137:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80313e:	eb 33                	jmp    803173 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803140:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803144:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803148:	48 85 c0             	test   %rax,%rax
+  80314b:	75 09                	jne    803156 <read+0xe3>
+    return -E_NOT_SUPP;
+  80314d:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803154:	eb 1d                	jmp    803173 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803156:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80315a:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80315e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803162:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803166:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80316a:	48 89 ce             	mov    %rcx,%rsi
+  80316d:	48 89 c7             	mov    %rax,%rdi
+  803170:	41 ff d0             	call   *%r8
+}
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+
+0000000000803175 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803175:	55                   	push   %rbp
+  803176:	48 89 e5             	mov    %rsp,%rbp
+  803179:	48 83 ec 30          	sub    $0x30,%rsp
+  80317d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803180:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803184:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803188:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80318f:	eb 49                	jmp    8031da <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803194:	48 98                	cltq
+  803196:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80319a:	48 29 c2             	sub    %rax,%rdx
+  80319d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031a0:	48 63 c8             	movslq %eax,%rcx
+  8031a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031a7:	48 01 c1             	add    %rax,%rcx
+  8031aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031ad:	48 89 ce             	mov    %rcx,%rsi
+  8031b0:	89 c7                	mov    %eax,%edi
+  8031b2:	48 b8 73 30 80 00 00 	movabs $0x803073,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+  8031be:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8031c1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031c5:	79 07                	jns    8031ce <readn+0x59>
+      return m;
+  8031c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031ca:	48 98                	cltq
+  8031cc:	eb 1f                	jmp    8031ed <readn+0x78>
+    if (m == 0)
+  8031ce:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031d2:	74 13                	je     8031e7 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8031d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031d7:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8031da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031dd:	48 98                	cltq
+  8031df:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8031e3:	72 ac                	jb     803191 <readn+0x1c>
+  8031e5:	eb 01                	jmp    8031e8 <readn+0x73>
+      break;
+  8031e7:	90                   	nop
+  }
+  return tot;
+  8031e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031eb:	48 98                	cltq
+}
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+
+00000000008031ef <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8031ef:	55                   	push   %rbp
+  8031f0:	48 89 e5             	mov    %rsp,%rbp
+  8031f3:	48 83 ec 40          	sub    $0x40,%rsp
+  8031f7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031fa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8031fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803202:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803206:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803209:	48 89 d6             	mov    %rdx,%rsi
+  80320c:	89 c7                	mov    %eax,%edi
+  80320e:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80321d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803221:	78 24                	js     803247 <write+0x58>
+  803223:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803227:	8b 00                	mov    (%rax),%eax
+  803229:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80322d:	48 89 d6             	mov    %rdx,%rsi
+  803230:	89 c7                	mov    %eax,%edi
+  803232:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+  80323e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803241:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803245:	79 0a                	jns    803251 <write+0x62>
+    return r;
+  803247:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80324a:	48 98                	cltq
+  80324c:	e9 9d 00 00 00       	jmp    8032ee <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803255:	8b 40 08             	mov    0x8(%rax),%eax
+  803258:	83 e0 03             	and    $0x3,%eax
+  80325b:	85 c0                	test   %eax,%eax
+  80325d:	75 5c                	jne    8032bb <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80325f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803266:	00 00 00 
+  803269:	8b 40 04             	mov    0x4(%rax),%eax
+  80326c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803271:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803278:	00 00 00 
+  80327b:	48 98                	cltq
+  80327d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803284:	48 01 d0             	add    %rdx,%rax
+  803287:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80328d:	8b 00                	mov    (%rax),%eax
+  80328f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803292:	89 c6                	mov    %eax,%esi
+  803294:	48 b8 7b 58 80 00 00 	movabs $0x80587b,%rax
+  80329b:	00 00 00 
+  80329e:	48 89 c7             	mov    %rax,%rdi
+  8032a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a6:	48 b9 1c 04 80 00 00 	movabs $0x80041c,%rcx
+  8032ad:	00 00 00 
+  8032b0:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8032b2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032b9:	eb 33                	jmp    8032ee <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8032bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032bf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032c3:	48 85 c0             	test   %rax,%rax
+  8032c6:	75 09                	jne    8032d1 <write+0xe2>
+    return -E_NOT_SUPP;
+  8032c8:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8032cf:	eb 1d                	jmp    8032ee <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8032d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032d5:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8032d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032dd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8032e1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8032e5:	48 89 ce             	mov    %rcx,%rsi
+  8032e8:	48 89 c7             	mov    %rax,%rdi
+  8032eb:	41 ff d0             	call   *%r8
+}
+  8032ee:	c9                   	leave
+  8032ef:	c3                   	ret
+
+00000000008032f0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032fb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032fe:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803302:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803305:	48 89 d6             	mov    %rdx,%rsi
+  803308:	89 c7                	mov    %eax,%edi
+  80330a:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  803311:	00 00 00 
+  803314:	ff d0                	call   *%rax
+  803316:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803319:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80331d:	79 05                	jns    803324 <seek+0x34>
+    return r;
+  80331f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803322:	eb 0f                	jmp    803333 <seek+0x43>
+  fd->fd_offset = offset;
+  803324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803328:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80332b:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80332e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803333:	c9                   	leave
+  803334:	c3                   	ret
+
+0000000000803335 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803335:	55                   	push   %rbp
+  803336:	48 89 e5             	mov    %rsp,%rbp
+  803339:	48 83 ec 30          	sub    $0x30,%rsp
+  80333d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803340:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803343:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803347:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80334a:	48 89 d6             	mov    %rdx,%rsi
+  80334d:	89 c7                	mov    %eax,%edi
+  80334f:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+  80335b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80335e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803362:	78 24                	js     803388 <ftruncate+0x53>
+  803364:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803368:	8b 00                	mov    (%rax),%eax
+  80336a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80336e:	48 89 d6             	mov    %rdx,%rsi
+  803371:	89 c7                	mov    %eax,%edi
+  803373:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  80337a:	00 00 00 
+  80337d:	ff d0                	call   *%rax
+  80337f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803382:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803386:	79 08                	jns    803390 <ftruncate+0x5b>
+    return r;
+  803388:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80338b:	e9 92 00 00 00       	jmp    803422 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803394:	8b 40 08             	mov    0x8(%rax),%eax
+  803397:	83 e0 03             	and    $0x3,%eax
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	75 5a                	jne    8033f8 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80339e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033a5:	00 00 00 
+  8033a8:	8b 40 04             	mov    0x4(%rax),%eax
+  8033ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033b0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033b7:	00 00 00 
+  8033ba:	48 98                	cltq
+  8033bc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033c3:	48 01 d0             	add    %rdx,%rax
+  8033c6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033cc:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033ce:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033d1:	89 c6                	mov    %eax,%esi
+  8033d3:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  8033da:	00 00 00 
+  8033dd:	48 89 c7             	mov    %rax,%rdi
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	48 b9 1c 04 80 00 00 	movabs $0x80041c,%rcx
+  8033ec:	00 00 00 
+  8033ef:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8033f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f6:	eb 2a                	jmp    803422 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8033f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033fc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803400:	48 85 c0             	test   %rax,%rax
+  803403:	75 07                	jne    80340c <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803405:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80340a:	eb 16                	jmp    803422 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80340c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803410:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803414:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803418:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80341b:	89 d6                	mov    %edx,%esi
+  80341d:	48 89 c7             	mov    %rax,%rdi
+  803420:	ff d1                	call   *%rcx
+}
+  803422:	c9                   	leave
+  803423:	c3                   	ret
+
+0000000000803424 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803424:	55                   	push   %rbp
+  803425:	48 89 e5             	mov    %rsp,%rbp
+  803428:	48 83 ec 30          	sub    $0x30,%rsp
+  80342c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80342f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803433:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803437:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80343a:	48 89 d6             	mov    %rdx,%rsi
+  80343d:	89 c7                	mov    %eax,%edi
+  80343f:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  803446:	00 00 00 
+  803449:	ff d0                	call   *%rax
+  80344b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80344e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803452:	78 24                	js     803478 <fstat+0x54>
+  803454:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803458:	8b 00                	mov    (%rax),%eax
+  80345a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80345e:	48 89 d6             	mov    %rdx,%rsi
+  803461:	89 c7                	mov    %eax,%edi
+  803463:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  80346a:	00 00 00 
+  80346d:	ff d0                	call   *%rax
+  80346f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803472:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803476:	79 05                	jns    80347d <fstat+0x59>
+    return r;
+  803478:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80347b:	eb 5e                	jmp    8034db <fstat+0xb7>
+  if (!dev->dev_stat)
+  80347d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803481:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803485:	48 85 c0             	test   %rax,%rax
+  803488:	75 07                	jne    803491 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80348a:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80348f:	eb 4a                	jmp    8034db <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803491:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803495:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803498:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80349c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034a3:	00 00 00 
+  stat->st_isdir   = 0;
+  8034a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034aa:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034b1:	00 00 00 
+  stat->st_dev     = dev;
+  8034b4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8034b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034bc:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8034c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034c7:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034cf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034d3:	48 89 d6             	mov    %rdx,%rsi
+  8034d6:	48 89 c7             	mov    %rax,%rdi
+  8034d9:	ff d1                	call   *%rcx
+}
+  8034db:	c9                   	leave
+  8034dc:	c3                   	ret
+
+00000000008034dd <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8034dd:	55                   	push   %rbp
+  8034de:	48 89 e5             	mov    %rsp,%rbp
+  8034e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8034e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8034e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8034ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034f1:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8034f7:	83 f8 20             	cmp    $0x20,%eax
+  8034fa:	75 07                	jne    803503 <pollwait_key+0x26>
+    return -E_INVAL;
+  8034fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803501:	eb 5f                	jmp    803562 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803507:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80350d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803511:	48 63 d2             	movslq %edx,%rdx
+  803514:	48 c1 e2 04          	shl    $0x4,%rdx
+  803518:	48 01 c2             	add    %rax,%rdx
+  80351b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80351f:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803526:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80352c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803530:	8b 00                	mov    (%rax),%eax
+  803532:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803536:	48 63 c9             	movslq %ecx,%rcx
+  803539:	48 c1 e1 04          	shl    $0x4,%rcx
+  80353d:	48 01 ca             	add    %rcx,%rdx
+  803540:	48 83 c2 08          	add    $0x8,%rdx
+  803544:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803546:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80354a:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803550:	8d 50 01             	lea    0x1(%rax),%edx
+  803553:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803557:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80355d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803562:	c9                   	leave
+  803563:	c3                   	ret
+
+0000000000803564 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803564:	55                   	push   %rbp
+  803565:	48 89 e5             	mov    %rsp,%rbp
+  803568:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80356f:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803576:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80357c:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803583:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80358a:	00 
+  int i, r, ready, ipc = 0;
+  80358b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803592:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803599:	00 
+  80359a:	74 45                	je     8035e1 <poll+0x7d>
+  80359c:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8035a3:	ff 
+  8035a4:	74 3b                	je     8035e1 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8035a6:	48 b8 9f 4a 80 00 00 	movabs $0x804a9f,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+  8035b2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8035b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ba:	48 f7 d0             	not    %rax
+  8035bd:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8035c4:	73 10                	jae    8035d6 <poll+0x72>
+  8035c6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035ca:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8035d1:	48 01 d0             	add    %rdx,%rax
+  8035d4:	eb 07                	jmp    8035dd <poll+0x79>
+  8035d6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8035dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8035e1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8035e8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8035ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8035f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8035fd:	e9 46 02 00 00       	jmp    803848 <poll+0x2e4>
+      fds[i].revents = 0;
+  803602:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803605:	48 63 d0             	movslq %eax,%rdx
+  803608:	48 89 d0             	mov    %rdx,%rax
+  80360b:	48 01 c0             	add    %rax,%rax
+  80360e:	48 01 d0             	add    %rdx,%rax
+  803611:	48 c1 e0 02          	shl    $0x2,%rax
+  803615:	48 89 c2             	mov    %rax,%rdx
+  803618:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80361f:	48 01 d0             	add    %rdx,%rax
+  803622:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803629:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80362c:	48 63 d0             	movslq %eax,%rdx
+  80362f:	48 89 d0             	mov    %rdx,%rax
+  803632:	48 01 c0             	add    %rax,%rax
+  803635:	48 01 d0             	add    %rdx,%rax
+  803638:	48 c1 e0 02          	shl    $0x2,%rax
+  80363c:	48 89 c2             	mov    %rax,%rdx
+  80363f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803646:	48 01 d0             	add    %rdx,%rax
+  803649:	8b 00                	mov    (%rax),%eax
+  80364b:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80364e:	75 62                	jne    8036b2 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803650:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803653:	48 63 d0             	movslq %eax,%rdx
+  803656:	48 89 d0             	mov    %rdx,%rax
+  803659:	48 01 c0             	add    %rax,%rax
+  80365c:	48 01 d0             	add    %rdx,%rax
+  80365f:	48 c1 e0 02          	shl    $0x2,%rax
+  803663:	48 89 c2             	mov    %rax,%rdx
+  803666:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80366d:	48 01 d0             	add    %rdx,%rax
+  803670:	8b 40 04             	mov    0x4(%rax),%eax
+  803673:	83 e0 01             	and    $0x1,%eax
+  803676:	85 c0                	test   %eax,%eax
+  803678:	0f 84 9b 01 00 00    	je     803819 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80367e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803681:	48 63 d0             	movslq %eax,%rdx
+  803684:	48 89 d0             	mov    %rdx,%rax
+  803687:	48 01 c0             	add    %rax,%rax
+  80368a:	48 01 d0             	add    %rdx,%rax
+  80368d:	48 c1 e0 02          	shl    $0x2,%rax
+  803691:	48 89 c2             	mov    %rax,%rdx
+  803694:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80369b:	48 01 c2             	add    %rax,%rdx
+  80369e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036a1:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8036a4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8036a7:	83 c8 04             	or     $0x4,%eax
+  8036aa:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8036ad:	e9 67 01 00 00       	jmp    803819 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036b5:	48 63 d0             	movslq %eax,%rdx
+  8036b8:	48 89 d0             	mov    %rdx,%rax
+  8036bb:	48 01 c0             	add    %rax,%rax
+  8036be:	48 01 d0             	add    %rdx,%rax
+  8036c1:	48 c1 e0 02          	shl    $0x2,%rax
+  8036c5:	48 89 c2             	mov    %rax,%rdx
+  8036c8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036cf:	48 01 d0             	add    %rdx,%rax
+  8036d2:	8b 00                	mov    (%rax),%eax
+  8036d4:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8036db:	48 89 d6             	mov    %rdx,%rsi
+  8036de:	89 c7                	mov    %eax,%edi
+  8036e0:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  8036e7:	00 00 00 
+  8036ea:	ff d0                	call   *%rax
+  8036ec:	85 c0                	test   %eax,%eax
+  8036ee:	78 25                	js     803715 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8036f0:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8036f7:	8b 00                	mov    (%rax),%eax
+  8036f9:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803700:	48 89 d6             	mov    %rdx,%rsi
+  803703:	89 c7                	mov    %eax,%edi
+  803705:	48 b8 b8 2c 80 00 00 	movabs $0x802cb8,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803711:	85 c0                	test   %eax,%eax
+  803713:	79 2c                	jns    803741 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803715:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803718:	48 63 d0             	movslq %eax,%rdx
+  80371b:	48 89 d0             	mov    %rdx,%rax
+  80371e:	48 01 c0             	add    %rax,%rax
+  803721:	48 01 d0             	add    %rdx,%rax
+  803724:	48 c1 e0 02          	shl    $0x2,%rax
+  803728:	48 89 c2             	mov    %rax,%rdx
+  80372b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803732:	48 01 d0             	add    %rdx,%rax
+  803735:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80373c:	e9 d8 00 00 00       	jmp    803819 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803741:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803748:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80374c:	48 85 c0             	test   %rax,%rax
+  80374f:	74 7d                	je     8037ce <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803751:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803758:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80375c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80375f:	48 63 d0             	movslq %eax,%rdx
+  803762:	48 89 d0             	mov    %rdx,%rax
+  803765:	48 01 c0             	add    %rax,%rax
+  803768:	48 01 d0             	add    %rdx,%rax
+  80376b:	48 c1 e0 02          	shl    $0x2,%rax
+  80376f:	48 89 c2             	mov    %rax,%rdx
+  803772:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803779:	48 01 d0             	add    %rdx,%rax
+  80377c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80377f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803786:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80378d:	89 ce                	mov    %ecx,%esi
+  80378f:	48 89 c7             	mov    %rax,%rdi
+  803792:	41 ff d0             	call   *%r8
+  803795:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803798:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80379c:	79 08                	jns    8037a6 <poll+0x242>
+          return r;
+  80379e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037a1:	e9 45 01 00 00       	jmp    8038eb <poll+0x387>
+        fds[i].revents = r;
+  8037a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037a9:	48 63 d0             	movslq %eax,%rdx
+  8037ac:	48 89 d0             	mov    %rdx,%rax
+  8037af:	48 01 c0             	add    %rax,%rax
+  8037b2:	48 01 d0             	add    %rdx,%rax
+  8037b5:	48 c1 e0 02          	shl    $0x2,%rax
+  8037b9:	48 89 c2             	mov    %rax,%rdx
+  8037bc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037c3:	48 01 c2             	add    %rax,%rdx
+  8037c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037c9:	89 42 08             	mov    %eax,0x8(%rdx)
+  8037cc:	eb 4b                	jmp    803819 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8037ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037d1:	48 63 d0             	movslq %eax,%rdx
+  8037d4:	48 89 d0             	mov    %rdx,%rax
+  8037d7:	48 01 c0             	add    %rax,%rax
+  8037da:	48 01 d0             	add    %rdx,%rax
+  8037dd:	48 c1 e0 02          	shl    $0x2,%rax
+  8037e1:	48 89 c2             	mov    %rax,%rdx
+  8037e4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037eb:	48 01 d0             	add    %rdx,%rax
+  8037ee:	8b 48 04             	mov    0x4(%rax),%ecx
+  8037f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037f4:	48 63 d0             	movslq %eax,%rdx
+  8037f7:	48 89 d0             	mov    %rdx,%rax
+  8037fa:	48 01 c0             	add    %rax,%rax
+  8037fd:	48 01 d0             	add    %rdx,%rax
+  803800:	48 c1 e0 02          	shl    $0x2,%rax
+  803804:	48 89 c2             	mov    %rax,%rdx
+  803807:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80380e:	48 01 d0             	add    %rdx,%rax
+  803811:	83 e1 03             	and    $0x3,%ecx
+  803814:	89 ca                	mov    %ecx,%edx
+  803816:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803819:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80381c:	48 63 d0             	movslq %eax,%rdx
+  80381f:	48 89 d0             	mov    %rdx,%rax
+  803822:	48 01 c0             	add    %rax,%rax
+  803825:	48 01 d0             	add    %rdx,%rax
+  803828:	48 c1 e0 02          	shl    $0x2,%rax
+  80382c:	48 89 c2             	mov    %rax,%rdx
+  80382f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803836:	48 01 d0             	add    %rdx,%rax
+  803839:	8b 40 08             	mov    0x8(%rax),%eax
+  80383c:	85 c0                	test   %eax,%eax
+  80383e:	74 04                	je     803844 <poll+0x2e0>
+        ready++;
+  803840:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803844:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803848:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384b:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803851:	0f 8c ab fd ff ff    	jl     803602 <poll+0x9e>
+    }
+    if (ready)
+  803857:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80385b:	74 08                	je     803865 <poll+0x301>
+      return ready;
+  80385d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803860:	e9 86 00 00 00       	jmp    8038eb <poll+0x387>
+
+    if (deadline) {
+  803865:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80386a:	74 30                	je     80389c <poll+0x338>
+      now     = vsys_clock_ns();
+  80386c:	48 b8 9f 4a 80 00 00 	movabs $0x804a9f,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+  803878:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80387c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803880:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803884:	73 0a                	jae    803890 <poll+0x32c>
+  803886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80388a:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80388e:	eb 05                	jmp    803895 <poll+0x331>
+  803890:	b8 00 00 00 00       	mov    $0x0,%eax
+  803895:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80389c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80389f:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8038a2:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8038a9:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8038b0:	48 89 c7             	mov    %rax,%rdi
+  8038b3:	48 b8 e2 25 80 00 00 	movabs $0x8025e2,%rax
+  8038ba:	00 00 00 
+  8038bd:	ff d0                	call   *%rax
+  8038bf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8038c2:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8038c6:	75 07                	jne    8038cf <poll+0x36b>
+      return 0;
+  8038c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cd:	eb 1c                	jmp    8038eb <poll+0x387>
+    if (r < 0)
+  8038cf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038d3:	79 05                	jns    8038da <poll+0x376>
+      return r;
+  8038d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038d8:	eb 11                	jmp    8038eb <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8038da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038dd:	c1 f8 02             	sar    $0x2,%eax
+  8038e0:	83 e0 01             	and    $0x1,%eax
+  8038e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8038e6:	e9 f6 fc ff ff       	jmp    8035e1 <poll+0x7d>
+  }
+}
+  8038eb:	c9                   	leave
+  8038ec:	c3                   	ret
+
+00000000008038ed <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8038ed:	55                   	push   %rbp
+  8038ee:	48 89 e5             	mov    %rsp,%rbp
+  8038f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8038f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8038f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8038fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803901:	be 00 00 00 00       	mov    $0x0,%esi
+  803906:	48 89 c7             	mov    %rax,%rdi
+  803909:	48 b8 db 39 80 00 00 	movabs $0x8039db,%rax
+  803910:	00 00 00 
+  803913:	ff d0                	call   *%rax
+  803915:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803918:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80391c:	79 05                	jns    803923 <stat+0x36>
+    return fd;
+  80391e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803921:	eb 2f                	jmp    803952 <stat+0x65>
+  r = fstat(fd, stat);
+  803923:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803927:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80392a:	48 89 d6             	mov    %rdx,%rsi
+  80392d:	89 c7                	mov    %eax,%edi
+  80392f:	48 b8 24 34 80 00 00 	movabs $0x803424,%rax
+  803936:	00 00 00 
+  803939:	ff d0                	call   *%rax
+  80393b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80393e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803941:	89 c7                	mov    %eax,%edi
+  803943:	48 b8 8c 2d 80 00 00 	movabs $0x802d8c,%rax
+  80394a:	00 00 00 
+  80394d:	ff d0                	call   *%rax
+  return r;
+  80394f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803952:	c9                   	leave
+  803953:	c3                   	ret
+
+0000000000803954 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803954:	55                   	push   %rbp
+  803955:	48 89 e5             	mov    %rsp,%rbp
+  803958:	48 83 ec 10          	sub    $0x10,%rsp
+  80395c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80395f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803963:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80396a:	00 00 00 
+  80396d:	8b 00                	mov    (%rax),%eax
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	75 1d                	jne    803990 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803973:	bf 03 00 00 00       	mov    $0x3,%edi
+  803978:	48 b8 ba 50 80 00 00 	movabs $0x8050ba,%rax
+  80397f:	00 00 00 
+  803982:	ff d0                	call   *%rax
+  803984:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80398b:	00 00 00 
+  80398e:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803990:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803997:	00 00 00 
+  80399a:	8b 00                	mov    (%rax),%eax
+  80399c:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80399f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039a4:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039ab:	00 00 00 
+  8039ae:	89 c7                	mov    %eax,%edi
+  8039b0:	48 b8 0d 50 80 00 00 	movabs $0x80500d,%rax
+  8039b7:	00 00 00 
+  8039ba:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8039bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c5:	48 89 c6             	mov    %rax,%rsi
+  8039c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039cd:	48 b8 90 4e 80 00 00 	movabs $0x804e90,%rax
+  8039d4:	00 00 00 
+  8039d7:	ff d0                	call   *%rax
+}
+  8039d9:	c9                   	leave
+  8039da:	c3                   	ret
+
+00000000008039db <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8039db:	55                   	push   %rbp
+  8039dc:	48 89 e5             	mov    %rsp,%rbp
+  8039df:	48 83 ec 20          	sub    $0x20,%rsp
+  8039e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039e7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8039ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ee:	48 89 c7             	mov    %rax,%rdi
+  8039f1:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  8039f8:	00 00 00 
+  8039fb:	ff d0                	call   *%rax
+  8039fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a02:	7e 0a                	jle    803a0e <open+0x33>
+    return -E_BAD_PATH;
+  803a04:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a09:	e9 a8 00 00 00       	jmp    803ab6 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a0e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a12:	48 89 c7             	mov    %rax,%rdi
+  803a15:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  803a1c:	00 00 00 
+  803a1f:	ff d0                	call   *%rax
+  803a21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a28:	79 08                	jns    803a32 <open+0x57>
+    return r;
+  803a2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a2d:	e9 84 00 00 00       	jmp    803ab6 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803a32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a36:	48 89 c6             	mov    %rax,%rsi
+  803a39:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a40:	00 00 00 
+  803a43:	48 89 c7             	mov    %rax,%rdi
+  803a46:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  803a4d:	00 00 00 
+  803a50:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803a52:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a59:	00 00 00 
+  803a5c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a5f:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a69:	48 89 c6             	mov    %rax,%rsi
+  803a6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a71:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+  803a7d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a80:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a84:	79 1d                	jns    803aa3 <open+0xc8>
+    fd_close(fd, 0);
+  803a86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a8f:	48 89 c7             	mov    %rax,%rdi
+  803a92:	48 b8 ed 2b 80 00 00 	movabs $0x802bed,%rax
+  803a99:	00 00 00 
+  803a9c:	ff d0                	call   *%rax
+    return r;
+  803a9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803aa1:	eb 13                	jmp    803ab6 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803aa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa7:	48 89 c7             	mov    %rax,%rdi
+  803aaa:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  803ab1:	00 00 00 
+  803ab4:	ff d0                	call   *%rax
+}
+  803ab6:	c9                   	leave
+  803ab7:	c3                   	ret
+
+0000000000803ab8 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803ab8:	55                   	push   %rbp
+  803ab9:	48 89 e5             	mov    %rsp,%rbp
+  803abc:	48 83 ec 10          	sub    $0x10,%rsp
+  803ac0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ac8:	8b 40 0c             	mov    0xc(%rax),%eax
+  803acb:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ad2:	00 00 00 
+  803ad5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803ad7:	be 00 00 00 00       	mov    $0x0,%esi
+  803adc:	bf 06 00 00 00       	mov    $0x6,%edi
+  803ae1:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803ae8:	00 00 00 
+  803aeb:	ff d0                	call   *%rax
+}
+  803aed:	c9                   	leave
+  803aee:	c3                   	ret
+
+0000000000803aef <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803aef:	55                   	push   %rbp
+  803af0:	48 89 e5             	mov    %rsp,%rbp
+  803af3:	48 83 ec 30          	sub    $0x30,%rsp
+  803af7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803afb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803aff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b03:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803b08:	74 07                	je     803b11 <devfile_read+0x22>
+  803b0a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b0f:	75 0a                	jne    803b1b <devfile_read+0x2c>
+  return E_INVAL;
+  803b11:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b16:	e9 b4 00 00 00       	jmp    803bcf <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b1b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b22:	00 
+  while (n) {
+  803b23:	e9 98 00 00 00       	jmp    803bc0 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803b28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b2c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b2f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b36:	00 00 00 
+  803b39:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803b3b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b42:	00 00 00 
+  803b45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b49:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803b4d:	be 00 00 00 00       	mov    $0x0,%esi
+  803b52:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b57:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803b5e:	00 00 00 
+  803b61:	ff d0                	call   *%rax
+  803b63:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803b66:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b6a:	7f 13                	jg     803b7f <devfile_read+0x90>
+      return res ? res : res0;
+  803b6c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b70:	74 07                	je     803b79 <devfile_read+0x8a>
+  803b72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b75:	48 98                	cltq
+  803b77:	eb 56                	jmp    803bcf <devfile_read+0xe0>
+  803b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b7d:	eb 50                	jmp    803bcf <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b7f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b82:	48 63 d0             	movslq %eax,%rdx
+  803b85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b89:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803b90:	00 00 00 
+  803b93:	48 89 ce             	mov    %rcx,%rsi
+  803b96:	48 89 c7             	mov    %rax,%rdi
+  803b99:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  803ba0:	00 00 00 
+  803ba3:	ff d0                	call   *%rax
+
+    buf += res;
+  803ba5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba8:	48 98                	cltq
+  803baa:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803bae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bb1:	48 98                	cltq
+  803bb3:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803bb7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bba:	48 98                	cltq
+  803bbc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803bc0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803bc5:	0f 85 5d ff ff ff    	jne    803b28 <devfile_read+0x39>
+  }
+
+  return res0;
+  803bcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803bcf:	c9                   	leave
+  803bd0:	c3                   	ret
+
+0000000000803bd1 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bd1:	55                   	push   %rbp
+  803bd2:	48 89 e5             	mov    %rsp,%rbp
+  803bd5:	48 83 ec 50          	sub    $0x50,%rsp
+  803bd9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803bdd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803be1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803be5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803bea:	74 07                	je     803bf3 <devfile_write+0x22>
+  803bec:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803bf1:	75 0a                	jne    803bfd <devfile_write+0x2c>
+  return E_INVAL;
+  803bf3:	b8 03 00 00 00       	mov    $0x3,%eax
+  803bf8:	e9 c9 00 00 00       	jmp    803cc6 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803bfd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c04:	00 
+
+  while (n) {
+  803c05:	e9 ad 00 00 00       	jmp    803cb7 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803c0a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c12:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c19:	00 
+  803c1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c22:	48 39 c2             	cmp    %rax,%rdx
+  803c25:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803c29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803c2d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c35:	48 89 c6             	mov    %rax,%rsi
+  803c38:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803c3f:	00 00 00 
+  803c42:	48 89 c7             	mov    %rax,%rdi
+  803c45:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  803c4c:	00 00 00 
+  803c4f:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c55:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c58:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c5f:	00 00 00 
+  803c62:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803c64:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c6b:	00 00 00 
+  803c6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c72:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803c76:	be 00 00 00 00       	mov    $0x0,%esi
+  803c7b:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c80:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+  803c8c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803c8f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c93:	79 07                	jns    803c9c <devfile_write+0xcb>
+      return res;
+  803c95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c98:	48 98                	cltq
+  803c9a:	eb 2a                	jmp    803cc6 <devfile_write+0xf5>
+
+    buf += res;
+  803c9c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c9f:	48 98                	cltq
+  803ca1:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803ca5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ca8:	48 98                	cltq
+  803caa:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803cae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cb1:	48 98                	cltq
+  803cb3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803cb7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803cbc:	0f 85 48 ff ff ff    	jne    803c0a <devfile_write+0x39>
+  }
+
+  return res0;
+  803cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803cc6:	c9                   	leave
+  803cc7:	c3                   	ret
+
+0000000000803cc8 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803cc8:	55                   	push   %rbp
+  803cc9:	48 89 e5             	mov    %rsp,%rbp
+  803ccc:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cd4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803cd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cdc:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cdf:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ce6:	00 00 00 
+  803ce9:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803ceb:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf0:	bf 05 00 00 00       	mov    $0x5,%edi
+  803cf5:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803cfc:	00 00 00 
+  803cff:	ff d0                	call   *%rax
+  803d01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d08:	79 05                	jns    803d0f <devfile_stat+0x47>
+    return r;
+  803d0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d0d:	eb 59                	jmp    803d68 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d13:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d1a:	00 00 00 
+  803d1d:	48 89 d6             	mov    %rdx,%rsi
+  803d20:	48 89 c7             	mov    %rax,%rdi
+  803d23:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  803d2a:	00 00 00 
+  803d2d:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803d2f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d36:	00 00 00 
+  803d39:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803d3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d43:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d49:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d50:	00 00 00 
+  803d53:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803d59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d5d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803d63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d68:	c9                   	leave
+  803d69:	c3                   	ret
+
+0000000000803d6a <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d6a:	55                   	push   %rbp
+  803d6b:	48 89 e5             	mov    %rsp,%rbp
+  803d6e:	48 83 ec 10          	sub    $0x10,%rsp
+  803d72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d76:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803d79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d7d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d80:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d87:	00 00 00 
+  803d8a:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803d8c:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d93:	00 00 00 
+  803d96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d99:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803d9c:	be 00 00 00 00       	mov    $0x0,%esi
+  803da1:	bf 02 00 00 00       	mov    $0x2,%edi
+  803da6:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803dad:	00 00 00 
+  803db0:	ff d0                	call   *%rax
+}
+  803db2:	c9                   	leave
+  803db3:	c3                   	ret
+
+0000000000803db4 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803db4:	55                   	push   %rbp
+  803db5:	48 89 e5             	mov    %rsp,%rbp
+  803db8:	48 83 ec 18          	sub    $0x18,%rsp
+  803dbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dc0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803dc3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803dc7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dca:	83 e0 03             	and    $0x3,%eax
+}
+  803dcd:	c9                   	leave
+  803dce:	c3                   	ret
+
+0000000000803dcf <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803dcf:	55                   	push   %rbp
+  803dd0:	48 89 e5             	mov    %rsp,%rbp
+  803dd3:	48 83 ec 10          	sub    $0x10,%rsp
+  803dd7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803ddb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ddf:	48 89 c7             	mov    %rax,%rdi
+  803de2:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  803de9:	00 00 00 
+  803dec:	ff d0                	call   *%rax
+  803dee:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803df3:	7e 07                	jle    803dfc <remove+0x2d>
+    return -E_BAD_PATH;
+  803df5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803dfa:	eb 36                	jmp    803e32 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803dfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e00:	48 89 c6             	mov    %rax,%rsi
+  803e03:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803e0a:	00 00 00 
+  803e0d:	48 89 c7             	mov    %rax,%rdi
+  803e10:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e1c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e21:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e26:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+}
+  803e32:	c9                   	leave
+  803e33:	c3                   	ret
+
+0000000000803e34 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803e34:	55                   	push   %rbp
+  803e35:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803e38:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e42:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803e49:	00 00 00 
+  803e4c:	ff d0                	call   *%rax
+}
+  803e4e:	5d                   	pop    %rbp
+  803e4f:	c3                   	ret
+
+0000000000803e50 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803e50:	55                   	push   %rbp
+  803e51:	48 89 e5             	mov    %rsp,%rbp
+  803e54:	48 83 ec 20          	sub    $0x20,%rsp
+  803e58:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e61:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e66:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+  803e72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e79:	79 05                	jns    803e80 <fs_stats+0x30>
+    return r;
+  803e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e7e:	eb 2a                	jmp    803eaa <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803e80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e84:	ba 68 00 00 00       	mov    $0x68,%edx
+  803e89:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803e90:	00 00 00 
+  803e93:	48 89 ce             	mov    %rcx,%rsi
+  803e96:	48 89 c7             	mov    %rax,%rdi
+  803e99:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  803ea0:	00 00 00 
+  803ea3:	ff d0                	call   *%rax
+  return 0;
+  803ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eaa:	c9                   	leave
+  803eab:	c3                   	ret
+
+0000000000803eac <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803eac:	55                   	push   %rbp
+  803ead:	48 89 e5             	mov    %rsp,%rbp
+  803eb0:	48 83 ec 10          	sub    $0x10,%rsp
+  803eb4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803eb7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ebe:	00 00 00 
+  803ec1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ec4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  803ecb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803ed0:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803ed7:	00 00 00 
+  803eda:	ff d0                	call   *%rax
+}
+  803edc:	c9                   	leave
+  803edd:	c3                   	ret
+
+0000000000803ede <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803ede:	55                   	push   %rbp
+  803edf:	48 89 e5             	mov    %rsp,%rbp
+  803ee2:	48 83 ec 10          	sub    $0x10,%rsp
+  803ee6:	89 f8                	mov    %edi,%eax
+  803ee8:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803eeb:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803eef:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ef6:	00 00 00 
+  803ef9:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803efb:	be 00 00 00 00       	mov    $0x0,%esi
+  803f00:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803f05:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  803f0c:	00 00 00 
+  803f0f:	ff d0                	call   *%rax
+}
+  803f11:	c9                   	leave
+  803f12:	c3                   	ret
+
+0000000000803f13 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803f13:	55                   	push   %rbp
+  803f14:	48 89 e5             	mov    %rsp,%rbp
+  803f17:	48 83 ec 10          	sub    $0x10,%rsp
+  803f1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803f1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f23:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803f28:	48 89 c7             	mov    %rax,%rdi
+  803f2b:	48 b8 39 3f 80 00 00 	movabs $0x803f39,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+}
+  803f37:	c9                   	leave
+  803f38:	c3                   	ret
+
+0000000000803f39 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803f39:	55                   	push   %rbp
+  803f3a:	48 89 e5             	mov    %rsp,%rbp
+  803f3d:	48 83 ec 50          	sub    $0x50,%rsp
+  803f41:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803f45:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803f49:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803f50:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803f51:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803f56:	74 0a                	je     803f62 <pipe_size+0x29>
+  803f58:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803f5f:	00 
+  803f60:	76 0a                	jbe    803f6c <pipe_size+0x33>
+    return -E_INVAL;
+  803f62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f67:	e9 cc 02 00 00       	jmp    804238 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803f6c:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803f70:	48 89 c7             	mov    %rax,%rdi
+  803f73:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+  803f7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f86:	0f 88 a8 02 00 00    	js     804234 <pipe_size+0x2fb>
+  803f8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f90:	ba 07 04 00 00       	mov    $0x407,%edx
+  803f95:	48 89 c6             	mov    %rax,%rsi
+  803f98:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f9d:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  803fa4:	00 00 00 
+  803fa7:	ff d0                	call   *%rax
+  803fa9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fb0:	0f 88 7e 02 00 00    	js     804234 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803fb6:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803fba:	48 89 c7             	mov    %rax,%rdi
+  803fbd:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  803fc4:	00 00 00 
+  803fc7:	ff d0                	call   *%rax
+  803fc9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fcc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fd0:	0f 88 43 02 00 00    	js     804219 <pipe_size+0x2e0>
+  803fd6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fda:	ba 07 04 00 00       	mov    $0x407,%edx
+  803fdf:	48 89 c6             	mov    %rax,%rsi
+  803fe2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe7:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  803fee:	00 00 00 
+  803ff1:	ff d0                	call   *%rax
+  803ff3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ff6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ffa:	0f 88 19 02 00 00    	js     804219 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804000:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804004:	48 89 c7             	mov    %rax,%rdi
+  804007:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  80400e:	00 00 00 
+  804011:	ff d0                	call   *%rax
+  804013:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804017:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80401e:	00 
+  80401f:	e9 a2 00 00 00       	jmp    8040c6 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804028:	48 c1 e0 0c          	shl    $0xc,%rax
+  80402c:	48 89 c2             	mov    %rax,%rdx
+  80402f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804033:	48 01 d0             	add    %rdx,%rax
+  804036:	ba 07 04 00 00       	mov    $0x407,%edx
+  80403b:	48 89 c6             	mov    %rax,%rsi
+  80403e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804043:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  80404a:	00 00 00 
+  80404d:	ff d0                	call   *%rax
+  80404f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804052:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804056:	0f 88 37 01 00 00    	js     804193 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80405c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804060:	48 89 c7             	mov    %rax,%rdi
+  804063:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  80406a:	00 00 00 
+  80406d:	ff d0                	call   *%rax
+  80406f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804073:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804077:	48 01 c2             	add    %rax,%rdx
+  80407a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80407e:	48 c1 e0 0c          	shl    $0xc,%rax
+  804082:	48 89 c1             	mov    %rax,%rcx
+  804085:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804089:	48 01 c8             	add    %rcx,%rax
+  80408c:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804092:	48 89 d1             	mov    %rdx,%rcx
+  804095:	ba 00 00 00 00       	mov    $0x0,%edx
+  80409a:	48 89 c6             	mov    %rax,%rsi
+  80409d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a2:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+  8040ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040b5:	79 0a                	jns    8040c1 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8040b7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8040bc:	e9 d3 00 00 00       	jmp    804194 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8040c1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8040c6:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8040cd:	00 
+  8040ce:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8040d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040d6:	48 01 d0             	add    %rdx,%rax
+  8040d9:	48 83 c0 1f          	add    $0x1f,%rax
+  8040dd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8040e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040ea:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8040ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040f2:	48 29 d0             	sub    %rdx,%rax
+  8040f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040f9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8040fd:	0f 82 21 ff ff ff    	jb     804024 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804107:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80410b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80410f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804113:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804117:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80411b:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804122:	00 00 00 
+  804125:	8b 12                	mov    (%rdx),%edx
+  804127:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804129:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80412d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804134:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804138:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80413f:	00 00 00 
+  804142:	8b 12                	mov    (%rdx),%edx
+  804144:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804146:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80414a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804151:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804155:	48 89 c7             	mov    %rax,%rdi
+  804158:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  80415f:	00 00 00 
+  804162:	ff d0                	call   *%rax
+  804164:	89 c2                	mov    %eax,%edx
+  804166:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80416a:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80416c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804170:	48 89 c7             	mov    %rax,%rdi
+  804173:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  80417a:	00 00 00 
+  80417d:	ff d0                	call   *%rax
+  80417f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804183:	48 83 c2 04          	add    $0x4,%rdx
+  804187:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80418e:	e9 a5 00 00 00       	jmp    804238 <pipe_size+0x2ff>
+      goto err2;
+  804193:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804194:	eb 58                	jmp    8041ee <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804196:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80419a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80419e:	48 89 c2             	mov    %rax,%rdx
+  8041a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a5:	48 01 d0             	add    %rdx,%rax
+  8041a8:	48 89 c6             	mov    %rax,%rsi
+  8041ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b0:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  8041b7:	00 00 00 
+  8041ba:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8041bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041c0:	48 89 c7             	mov    %rax,%rdi
+  8041c3:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+  8041cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8041d3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8041d7:	48 01 d0             	add    %rdx,%rax
+  8041da:	48 89 c6             	mov    %rax,%rsi
+  8041dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041e2:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8041ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041f2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8041f6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8041fa:	48 85 c0             	test   %rax,%rax
+  8041fd:	75 97                	jne    804196 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8041ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804203:	48 89 c6             	mov    %rax,%rsi
+  804206:	bf 00 00 00 00       	mov    $0x0,%edi
+  80420b:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  804212:	00 00 00 
+  804215:	ff d0                	call   *%rax
+  804217:	eb 01                	jmp    80421a <pipe_size+0x2e1>
+    goto err1;
+  804219:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80421a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80421e:	48 89 c6             	mov    %rax,%rsi
+  804221:	bf 00 00 00 00       	mov    $0x0,%edi
+  804226:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  80422d:	00 00 00 
+  804230:	ff d0                	call   *%rax
+  804232:	eb 01                	jmp    804235 <pipe_size+0x2fc>
+    goto err;
+  804234:	90                   	nop
+err:
+  return r;
+  804235:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804238:	c9                   	leave
+  804239:	c3                   	ret
+
+000000000080423a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80423a:	55                   	push   %rbp
+  80423b:	48 89 e5             	mov    %rsp,%rbp
+  80423e:	53                   	push   %rbx
+  80423f:	48 83 ec 28          	sub    $0x28,%rsp
+  804243:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804247:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80424b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804252:	00 00 00 
+  804255:	8b 40 04             	mov    0x4(%rax),%eax
+  804258:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80425d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804264:	00 00 00 
+  804267:	48 98                	cltq
+  804269:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804270:	48 01 d0             	add    %rdx,%rax
+  804273:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804279:	8b 00                	mov    (%rax),%eax
+  80427b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80427e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804282:	48 89 c7             	mov    %rax,%rdi
+  804285:	48 b8 2b 51 80 00 00 	movabs $0x80512b,%rax
+  80428c:	00 00 00 
+  80428f:	ff d0                	call   *%rax
+  804291:	89 c3                	mov    %eax,%ebx
+  804293:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804297:	48 89 c7             	mov    %rax,%rdi
+  80429a:	48 b8 2b 51 80 00 00 	movabs $0x80512b,%rax
+  8042a1:	00 00 00 
+  8042a4:	ff d0                	call   *%rax
+  8042a6:	39 c3                	cmp    %eax,%ebx
+  8042a8:	0f 94 c0             	sete   %al
+  8042ab:	0f b6 c0             	movzbl %al,%eax
+  8042ae:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8042b1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8042b8:	00 00 00 
+  8042bb:	8b 40 04             	mov    0x4(%rax),%eax
+  8042be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8042c3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8042ca:	00 00 00 
+  8042cd:	48 98                	cltq
+  8042cf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8042d6:	48 01 d0             	add    %rdx,%rax
+  8042d9:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8042df:	8b 00                	mov    (%rax),%eax
+  8042e1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8042e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042e7:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8042ea:	75 05                	jne    8042f1 <_pipeisclosed+0xb7>
+      return ret;
+  8042ec:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8042ef:	eb 68                	jmp    804359 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8042f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042f4:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8042f7:	0f 84 4e ff ff ff    	je     80424b <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8042fd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804304:	00 00 00 
+  804307:	8b 40 04             	mov    0x4(%rax),%eax
+  80430a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80430f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804316:	00 00 00 
+  804319:	48 98                	cltq
+  80431b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804322:	48 01 d0             	add    %rdx,%rax
+  804325:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80432b:	8b 10                	mov    (%rax),%edx
+  80432d:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804330:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804333:	89 c6                	mov    %eax,%esi
+  804335:	48 b8 c8 58 80 00 00 	movabs $0x8058c8,%rax
+  80433c:	00 00 00 
+  80433f:	48 89 c7             	mov    %rax,%rdi
+  804342:	b8 00 00 00 00       	mov    $0x0,%eax
+  804347:	49 b8 1c 04 80 00 00 	movabs $0x80041c,%r8
+  80434e:	00 00 00 
+  804351:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804354:	e9 f2 fe ff ff       	jmp    80424b <_pipeisclosed+0x11>
+  }
+}
+  804359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80435d:	c9                   	leave
+  80435e:	c3                   	ret
+
+000000000080435f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80435f:	55                   	push   %rbp
+  804360:	48 89 e5             	mov    %rsp,%rbp
+  804363:	48 83 ec 30          	sub    $0x30,%rsp
+  804367:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80436a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80436e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804371:	48 89 d6             	mov    %rdx,%rsi
+  804374:	89 c7                	mov    %eax,%edi
+  804376:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  80437d:	00 00 00 
+  804380:	ff d0                	call   *%rax
+  804382:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804385:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804389:	79 05                	jns    804390 <pipeisclosed+0x31>
+    return r;
+  80438b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80438e:	eb 31                	jmp    8043c1 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804394:	48 89 c7             	mov    %rax,%rdi
+  804397:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  80439e:	00 00 00 
+  8043a1:	ff d0                	call   *%rax
+  8043a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8043a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043af:	48 89 d6             	mov    %rdx,%rsi
+  8043b2:	48 89 c7             	mov    %rax,%rdi
+  8043b5:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  8043bc:	00 00 00 
+  8043bf:	ff d0                	call   *%rax
+}
+  8043c1:	c9                   	leave
+  8043c2:	c3                   	ret
+
+00000000008043c3 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8043c3:	55                   	push   %rbp
+  8043c4:	48 89 e5             	mov    %rsp,%rbp
+  8043c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8043cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8043cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d3:	8b 40 18             	mov    0x18(%rax),%eax
+  8043d6:	8d 50 01             	lea    0x1(%rax),%edx
+  8043d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043dd:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8043e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e4:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8043e7:	85 c0                	test   %eax,%eax
+  8043e9:	74 27                	je     804412 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8043eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ef:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8043f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043fa:	48 83 c0 18          	add    $0x18,%rax
+  8043fe:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804403:	48 89 c7             	mov    %rax,%rdi
+  804406:	48 b8 95 25 80 00 00 	movabs $0x802595,%rax
+  80440d:	00 00 00 
+  804410:	ff d0                	call   *%rax
+  }
+}
+  804412:	90                   	nop
+  804413:	c9                   	leave
+  804414:	c3                   	ret
+
+0000000000804415 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804415:	55                   	push   %rbp
+  804416:	48 89 e5             	mov    %rsp,%rbp
+  804419:	48 83 ec 10          	sub    $0x10,%rsp
+  80441d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804421:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804428:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80442f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804433:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804437:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80443a:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804441:	89 c6                	mov    %eax,%esi
+  804443:	48 89 cf             	mov    %rcx,%rdi
+  804446:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  80444d:	00 00 00 
+  804450:	ff d0                	call   *%rax
+}
+  804452:	90                   	nop
+  804453:	c9                   	leave
+  804454:	c3                   	ret
+
+0000000000804455 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804455:	55                   	push   %rbp
+  804456:	48 89 e5             	mov    %rsp,%rbp
+  804459:	48 83 ec 70          	sub    $0x70,%rsp
+  80445d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804461:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804465:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804469:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80446d:	48 89 c7             	mov    %rax,%rdi
+  804470:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804477:	00 00 00 
+  80447a:	ff d0                	call   *%rax
+  80447c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804480:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804485:	75 0a                	jne    804491 <devpipe_read+0x3c>
+    return 0;
+  804487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448c:	e9 63 01 00 00       	jmp    8045f4 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804495:	8b 40 18             	mov    0x18(%rax),%eax
+  804498:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80449b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80449f:	48 8b 10             	mov    (%rax),%rdx
+  8044a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8044aa:	48 39 c2             	cmp    %rax,%rdx
+  8044ad:	75 42                	jne    8044f1 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8044af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044b7:	48 89 d6             	mov    %rdx,%rsi
+  8044ba:	48 89 c7             	mov    %rax,%rdi
+  8044bd:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	85 c0                	test   %eax,%eax
+  8044cb:	74 0a                	je     8044d7 <devpipe_read+0x82>
+      return 0;
+  8044cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d2:	e9 1d 01 00 00       	jmp    8045f4 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8044d7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8044da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044de:	89 d6                	mov    %edx,%esi
+  8044e0:	48 89 c7             	mov    %rax,%rdi
+  8044e3:	48 b8 15 44 80 00 00 	movabs $0x804415,%rax
+  8044ea:	00 00 00 
+  8044ed:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8044ef:	eb a0                	jmp    804491 <devpipe_read+0x3c>
+      break;
+  8044f1:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8044f2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8044f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8044fa:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8044fe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804506:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80450a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80450e:	48 8b 00             	mov    (%rax),%rax
+  804511:	48 29 c2             	sub    %rax,%rdx
+  804514:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804518:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80451c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804520:	48 39 c2             	cmp    %rax,%rdx
+  804523:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804527:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80452b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80452f:	48 8b 00             	mov    (%rax),%rax
+  804532:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804536:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80453a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80453f:	48 f7 f1             	div    %rcx
+  804542:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804546:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80454a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80454e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804552:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804556:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80455a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80455e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804562:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804566:	48 39 c2             	cmp    %rax,%rdx
+  804569:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80456d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804571:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804575:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804579:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80457d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804581:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804585:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804589:	48 89 ce             	mov    %rcx,%rsi
+  80458c:	48 89 c7             	mov    %rax,%rdi
+  80458f:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  804596:	00 00 00 
+  804599:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80459b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80459f:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8045a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045a7:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8045ab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8045af:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045b3:	48 01 d1             	add    %rdx,%rcx
+  8045b6:	48 89 c2             	mov    %rax,%rdx
+  8045b9:	48 89 cf             	mov    %rcx,%rdi
+  8045bc:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  8045c3:	00 00 00 
+  8045c6:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8045c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045cc:	48 8b 10             	mov    (%rax),%rdx
+  8045cf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045d3:	48 01 c2             	add    %rax,%rdx
+  8045d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045da:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8045dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045e1:	48 89 c7             	mov    %rax,%rdi
+  8045e4:	48 b8 c3 43 80 00 00 	movabs $0x8043c3,%rax
+  8045eb:	00 00 00 
+  8045ee:	ff d0                	call   *%rax
+  return n;
+  8045f0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8045f4:	c9                   	leave
+  8045f5:	c3                   	ret
+
+00000000008045f6 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	48 83 ec 70          	sub    $0x70,%rsp
+  8045fe:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804602:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804606:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80460a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80460e:	48 89 c7             	mov    %rax,%rdi
+  804611:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804618:	00 00 00 
+  80461b:	ff d0                	call   *%rax
+  80461d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804621:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804625:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804629:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804630:	00 
+  804631:	e9 b8 01 00 00       	jmp    8047ee <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80463a:	8b 40 18             	mov    0x18(%rax),%eax
+  80463d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804640:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804644:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464c:	48 8b 00             	mov    (%rax),%rax
+  80464f:	48 29 c2             	sub    %rax,%rdx
+  804652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804656:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80465a:	48 39 c2             	cmp    %rax,%rdx
+  80465d:	75 4d                	jne    8046ac <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80465f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804663:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804667:	48 89 d6             	mov    %rdx,%rsi
+  80466a:	48 89 c7             	mov    %rax,%rdi
+  80466d:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  804674:	00 00 00 
+  804677:	ff d0                	call   *%rax
+  804679:	85 c0                	test   %eax,%eax
+  80467b:	74 0a                	je     804687 <devpipe_write+0x91>
+        return 0;
+  80467d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804682:	e9 79 01 00 00       	jmp    804800 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804687:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80468a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80468e:	89 d6                	mov    %edx,%esi
+  804690:	48 89 c7             	mov    %rax,%rdi
+  804693:	48 b8 15 44 80 00 00 	movabs $0x804415,%rax
+  80469a:	00 00 00 
+  80469d:	ff d0                	call   *%rax
+      m = 0;
+  80469f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8046a6:	00 
+      continue;
+  8046a7:	e9 3a 01 00 00       	jmp    8047e6 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8046ac:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046b0:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8046b4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8046b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046bc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8046c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046c4:	48 8b 08             	mov    (%rax),%rcx
+  8046c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046cf:	48 29 c1             	sub    %rax,%rcx
+  8046d2:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8046d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8046da:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8046de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046e2:	48 39 c2             	cmp    %rax,%rdx
+  8046e5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8046e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8046ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046f9:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8046fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804702:	48 f7 f1             	div    %rcx
+  804705:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804709:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80470d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804715:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804719:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80471d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804721:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804725:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804729:	48 39 c2             	cmp    %rax,%rdx
+  80472c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804730:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804734:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804738:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80473c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804740:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804744:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804748:	48 01 d1             	add    %rdx,%rcx
+  80474b:	48 89 c2             	mov    %rax,%rdx
+  80474e:	48 89 cf             	mov    %rcx,%rdi
+  804751:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  804758:	00 00 00 
+  80475b:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80475d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804761:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804765:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804769:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80476d:	73 4d                	jae    8047bc <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80476f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804773:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804777:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80477b:	48 29 c2             	sub    %rax,%rdx
+  80477e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804782:	48 01 c2             	add    %rax,%rdx
+  804785:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804789:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80478d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804791:	48 89 c1             	mov    %rax,%rcx
+  804794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804798:	48 01 c1             	add    %rax,%rcx
+  80479b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80479f:	48 01 c1             	add    %rax,%rcx
+  8047a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047a6:	48 83 c0 20          	add    $0x20,%rax
+  8047aa:	48 89 ce             	mov    %rcx,%rsi
+  8047ad:	48 89 c7             	mov    %rax,%rdi
+  8047b0:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  8047b7:	00 00 00 
+  8047ba:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8047bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047c0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047c8:	48 01 c2             	add    %rax,%rdx
+  8047cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047cf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8047d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047d7:	48 89 c7             	mov    %rax,%rdi
+  8047da:	48 b8 c3 43 80 00 00 	movabs $0x8043c3,%rax
+  8047e1:	00 00 00 
+  8047e4:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8047e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047ea:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8047ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047f2:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8047f6:	0f 82 3a fe ff ff    	jb     804636 <devpipe_write+0x40>
+  }
+
+  return i;
+  8047fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804800:	c9                   	leave
+  804801:	c3                   	ret
+
+0000000000804802 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804802:	55                   	push   %rbp
+  804803:	48 89 e5             	mov    %rsp,%rbp
+  804806:	48 83 ec 40          	sub    $0x40,%rsp
+  80480a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80480e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804811:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804815:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804819:	48 89 c7             	mov    %rax,%rdi
+  80481c:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804823:	00 00 00 
+  804826:	ff d0                	call   *%rax
+  804828:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80482c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804833:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804837:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80483b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80483f:	48 89 d6             	mov    %rdx,%rsi
+  804842:	48 89 c7             	mov    %rax,%rdi
+  804845:	48 b8 dd 34 80 00 00 	movabs $0x8034dd,%rax
+  80484c:	00 00 00 
+  80484f:	ff d0                	call   *%rax
+  804851:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804854:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804858:	79 08                	jns    804862 <devpipe_poll+0x60>
+    return r;
+  80485a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80485d:	e9 85 00 00 00       	jmp    8048e7 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804862:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804865:	83 e0 01             	and    $0x1,%eax
+  804868:	85 c0                	test   %eax,%eax
+  80486a:	74 18                	je     804884 <devpipe_poll+0x82>
+  80486c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804870:	48 8b 10             	mov    (%rax),%rdx
+  804873:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804877:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80487b:	48 39 c2             	cmp    %rax,%rdx
+  80487e:	74 04                	je     804884 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804880:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804884:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804887:	83 e0 02             	and    $0x2,%eax
+  80488a:	85 c0                	test   %eax,%eax
+  80488c:	74 23                	je     8048b1 <devpipe_poll+0xaf>
+  80488e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804892:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804896:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80489a:	48 8b 00             	mov    (%rax),%rax
+  80489d:	48 29 c2             	sub    %rax,%rdx
+  8048a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048a4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048a8:	48 39 c2             	cmp    %rax,%rdx
+  8048ab:	73 04                	jae    8048b1 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8048ad:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8048b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048b9:	48 89 d6             	mov    %rdx,%rsi
+  8048bc:	48 89 c7             	mov    %rax,%rdi
+  8048bf:	48 b8 3a 42 80 00 00 	movabs $0x80423a,%rax
+  8048c6:	00 00 00 
+  8048c9:	ff d0                	call   *%rax
+  8048cb:	85 c0                	test   %eax,%eax
+  8048cd:	74 04                	je     8048d3 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8048cf:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8048d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d7:	75 0b                	jne    8048e4 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8048d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048dd:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8048e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8048e7:	c9                   	leave
+  8048e8:	c3                   	ret
+
+00000000008048e9 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8048e9:	55                   	push   %rbp
+  8048ea:	48 89 e5             	mov    %rsp,%rbp
+  8048ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8048f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8048f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048fd:	48 89 c7             	mov    %rax,%rdi
+  804900:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804907:	00 00 00 
+  80490a:	ff d0                	call   *%rax
+  80490c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804910:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804914:	48 ba f9 58 80 00 00 	movabs $0x8058f9,%rdx
+  80491b:	00 00 00 
+  80491e:	48 89 d6             	mov    %rdx,%rsi
+  804921:	48 89 c7             	mov    %rax,%rdi
+  804924:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  80492b:	00 00 00 
+  80492e:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804934:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804938:	89 c1                	mov    %eax,%ecx
+  80493a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493e:	48 8b 00             	mov    (%rax),%rax
+  804941:	89 c2                	mov    %eax,%edx
+  804943:	89 c8                	mov    %ecx,%eax
+  804945:	29 d0                	sub    %edx,%eax
+  804947:	89 c2                	mov    %eax,%edx
+  804949:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80494d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804953:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804957:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80495e:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804961:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804965:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  80496c:	00 00 00 
+  80496f:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804976:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80497b:	c9                   	leave
+  80497c:	c3                   	ret
+
+000000000080497d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80497d:	55                   	push   %rbp
+  80497e:	48 89 e5             	mov    %rsp,%rbp
+  804981:	48 83 ec 40          	sub    $0x40,%rsp
+  804985:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80498d:	48 89 c7             	mov    %rax,%rdi
+  804990:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804997:	00 00 00 
+  80499a:	ff d0                	call   *%rax
+  80499c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8049a0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8049a7:	00 
+  8049a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049b4:	48 01 d0             	add    %rdx,%rax
+  8049b7:	48 83 c0 1f          	add    $0x1f,%rax
+  8049bb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8049bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049c8:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8049cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d0:	48 29 d0             	sub    %rdx,%rax
+  8049d3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049d7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8049db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049df:	48 89 c6             	mov    %rax,%rsi
+  8049e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e7:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  8049ee:	00 00 00 
+  8049f1:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8049f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f7:	48 89 c7             	mov    %rax,%rdi
+  8049fa:	48 b8 c3 43 80 00 00 	movabs $0x8043c3,%rax
+  804a01:	00 00 00 
+  804a04:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804a0e:	eb 2f                	jmp    804a3f <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804a10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a14:	48 83 e8 01          	sub    $0x1,%rax
+  804a18:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a1c:	48 89 c2             	mov    %rax,%rdx
+  804a1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a23:	48 01 d0             	add    %rdx,%rax
+  804a26:	48 89 c6             	mov    %rax,%rsi
+  804a29:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a2e:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  804a35:	00 00 00 
+  804a38:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804a3a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804a3f:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804a44:	77 ca                	ja     804a10 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804a46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a4a:	48 89 c6             	mov    %rax,%rsi
+  804a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a52:	48 b8 52 22 80 00 00 	movabs $0x802252,%rax
+  804a59:	00 00 00 
+  804a5c:	ff d0                	call   *%rax
+}
+  804a5e:	c9                   	leave
+  804a5f:	c3                   	ret
+
+0000000000804a60 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804a60:	55                   	push   %rbp
+  804a61:	48 89 e5             	mov    %rsp,%rbp
+  804a64:	48 83 ec 08          	sub    $0x8,%rsp
+  804a68:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804a6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a6f:	75 10                	jne    804a81 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804a71:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a78:	00 00 00 
+  804a7b:	8b 00                	mov    (%rax),%eax
+  804a7d:	48 98                	cltq
+  804a7f:	eb 05                	jmp    804a86 <vsyscall+0x26>
+  }
+  return 0;
+  804a81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a86:	c9                   	leave
+  804a87:	c3                   	ret
+
+0000000000804a88 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804a88:	55                   	push   %rbp
+  804a89:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804a8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a91:	48 b8 60 4a 80 00 00 	movabs $0x804a60,%rax
+  804a98:	00 00 00 
+  804a9b:	ff d0                	call   *%rax
+}
+  804a9d:	5d                   	pop    %rbp
+  804a9e:	c3                   	ret
+
+0000000000804a9f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804a9f:	55                   	push   %rbp
+  804aa0:	48 89 e5             	mov    %rsp,%rbp
+  804aa3:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804aa7:	0f 31                	rdtsc
+  804aa9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aac:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804aaf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ab2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ab5:	48 c1 e2 20          	shl    $0x20,%rdx
+  804ab9:	48 09 d0             	or     %rdx,%rax
+  804abc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804ac0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804ac4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804ac8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804acf:	00 00 00 
+  804ad2:	8b 40 08             	mov    0x8(%rax),%eax
+  804ad5:	48 98                	cltq
+  804ad7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804adb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804adf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ae4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804ae8:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804af8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804afc:	48 89 d0             	mov    %rdx,%rax
+  804aff:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b0b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804b0f:	48 01 c8             	add    %rcx,%rax
+}
+  804b12:	c9                   	leave
+  804b13:	c3                   	ret
+
+0000000000804b14 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804b14:	55                   	push   %rbp
+  804b15:	48 89 e5             	mov    %rsp,%rbp
+  804b18:	48 83 ec 20          	sub    $0x20,%rsp
+  804b1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804b1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b22:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804b25:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804b29:	be 01 00 00 00       	mov    $0x1,%esi
+  804b2e:	48 89 c7             	mov    %rax,%rdi
+  804b31:	48 b8 83 1f 80 00 00 	movabs $0x801f83,%rax
+  804b38:	00 00 00 
+  804b3b:	ff d0                	call   *%rax
+}
+  804b3d:	90                   	nop
+  804b3e:	c9                   	leave
+  804b3f:	c3                   	ret
+
+0000000000804b40 <getchar>:
+
+int
+getchar(void) {
+  804b40:	55                   	push   %rbp
+  804b41:	48 89 e5             	mov    %rsp,%rbp
+  804b44:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804b48:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804b4c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b51:	48 89 c6             	mov    %rax,%rsi
+  804b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b59:	48 b8 73 30 80 00 00 	movabs $0x803073,%rax
+  804b60:	00 00 00 
+  804b63:	ff d0                	call   *%rax
+  804b65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804b68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b6c:	79 05                	jns    804b73 <getchar+0x33>
+    return r;
+  804b6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b71:	eb 14                	jmp    804b87 <getchar+0x47>
+  if (r < 1)
+  804b73:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b77:	7f 07                	jg     804b80 <getchar+0x40>
+    return -E_EOF;
+  804b79:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804b7e:	eb 07                	jmp    804b87 <getchar+0x47>
+  return c;
+  804b80:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804b84:	0f b6 c0             	movzbl %al,%eax
+}
+  804b87:	c9                   	leave
+  804b88:	c3                   	ret
+
+0000000000804b89 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804b89:	55                   	push   %rbp
+  804b8a:	48 89 e5             	mov    %rsp,%rbp
+  804b8d:	48 83 ec 20          	sub    $0x20,%rsp
+  804b91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b94:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804b98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b9b:	48 89 d6             	mov    %rdx,%rsi
+  804b9e:	89 c7                	mov    %eax,%edi
+  804ba0:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  804ba7:	00 00 00 
+  804baa:	ff d0                	call   *%rax
+  804bac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804baf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bb3:	79 05                	jns    804bba <iscons+0x31>
+    return r;
+  804bb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bb8:	eb 1a                	jmp    804bd4 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804bba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bbe:	8b 10                	mov    (%rax),%edx
+  804bc0:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804bc7:	00 00 00 
+  804bca:	8b 00                	mov    (%rax),%eax
+  804bcc:	39 c2                	cmp    %eax,%edx
+  804bce:	0f 94 c0             	sete   %al
+  804bd1:	0f b6 c0             	movzbl %al,%eax
+}
+  804bd4:	c9                   	leave
+  804bd5:	c3                   	ret
+
+0000000000804bd6 <opencons>:
+
+int
+opencons(void) {
+  804bd6:	55                   	push   %rbp
+  804bd7:	48 89 e5             	mov    %rsp,%rbp
+  804bda:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804bde:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804be2:	48 89 c7             	mov    %rax,%rdi
+  804be5:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  804bec:	00 00 00 
+  804bef:	ff d0                	call   *%rax
+  804bf1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bf4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bf8:	79 05                	jns    804bff <opencons+0x29>
+    return r;
+  804bfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bfd:	eb 66                	jmp    804c65 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804bff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c03:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c08:	48 89 c6             	mov    %rax,%rsi
+  804c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c10:	48 b8 9a 21 80 00 00 	movabs $0x80219a,%rax
+  804c17:	00 00 00 
+  804c1a:	ff d0                	call   *%rax
+  804c1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c23:	79 05                	jns    804c2a <opencons+0x54>
+    return r;
+  804c25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c28:	eb 3b                	jmp    804c65 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804c2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c2e:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804c35:	00 00 00 
+  804c38:	8b 12                	mov    (%rdx),%edx
+  804c3a:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804c3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c40:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804c47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c4b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804c52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c56:	48 89 c7             	mov    %rax,%rdi
+  804c59:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  804c60:	00 00 00 
+  804c63:	ff d0                	call   *%rax
+}
+  804c65:	c9                   	leave
+  804c66:	c3                   	ret
+
+0000000000804c67 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804c67:	55                   	push   %rbp
+  804c68:	48 89 e5             	mov    %rsp,%rbp
+  804c6b:	48 83 ec 20          	sub    $0x20,%rsp
+  804c6f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c72:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c75:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804c79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c7c:	48 89 d6             	mov    %rdx,%rsi
+  804c7f:	89 c7                	mov    %eax,%edi
+  804c81:	48 b8 17 2b 80 00 00 	movabs $0x802b17,%rax
+  804c88:	00 00 00 
+  804c8b:	ff d0                	call   *%rax
+  804c8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c94:	79 05                	jns    804c9b <consmode+0x34>
+    return r;
+  804c96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c99:	eb 34                	jmp    804ccf <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804c9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c9f:	8b 10                	mov    (%rax),%edx
+  804ca1:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804ca8:	00 00 00 
+  804cab:	8b 00                	mov    (%rax),%eax
+  804cad:	39 c2                	cmp    %eax,%edx
+  804caf:	74 07                	je     804cb8 <consmode+0x51>
+    return -E_INVAL;
+  804cb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804cb6:	eb 17                	jmp    804ccf <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804cb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cbc:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cbf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804cc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cc6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804cc9:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804ccc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804ccf:	c9                   	leave
+  804cd0:	c3                   	ret
+
+0000000000804cd1 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804cd1:	55                   	push   %rbp
+  804cd2:	48 89 e5             	mov    %rsp,%rbp
+  804cd5:	48 83 ec 20          	sub    $0x20,%rsp
+  804cd9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cdd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804ce1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804ce5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce9:	8b 50 0c             	mov    0xc(%rax),%edx
+  804cec:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804cf0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cf4:	48 89 ce             	mov    %rcx,%rsi
+  804cf7:	48 89 c7             	mov    %rax,%rdi
+  804cfa:	48 b8 f4 24 80 00 00 	movabs $0x8024f4,%rax
+  804d01:	00 00 00 
+  804d04:	ff d0                	call   *%rax
+  804d06:	48 98                	cltq
+}
+  804d08:	c9                   	leave
+  804d09:	c3                   	ret
+
+0000000000804d0a <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d0a:	55                   	push   %rbp
+  804d0b:	48 89 e5             	mov    %rsp,%rbp
+  804d0e:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804d15:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804d1c:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804d23:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804d2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d31:	eb 74                	jmp    804da7 <devcons_write+0x9d>
+    m = n - tot;
+  804d33:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804d3a:	89 c2                	mov    %eax,%edx
+  804d3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d3f:	29 c2                	sub    %eax,%edx
+  804d41:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804d44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d47:	83 f8 7f             	cmp    $0x7f,%eax
+  804d4a:	76 07                	jbe    804d53 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804d4c:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804d53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d56:	48 63 d0             	movslq %eax,%rdx
+  804d59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d5c:	48 63 c8             	movslq %eax,%rcx
+  804d5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804d66:	48 01 c1             	add    %rax,%rcx
+  804d69:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804d70:	48 89 ce             	mov    %rcx,%rsi
+  804d73:	48 89 c7             	mov    %rax,%rdi
+  804d76:	48 b8 0f 19 80 00 00 	movabs $0x80190f,%rax
+  804d7d:	00 00 00 
+  804d80:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804d82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d85:	48 63 d0             	movslq %eax,%rdx
+  804d88:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804d8f:	48 89 d6             	mov    %rdx,%rsi
+  804d92:	48 89 c7             	mov    %rax,%rdi
+  804d95:	48 b8 83 1f 80 00 00 	movabs $0x801f83,%rax
+  804d9c:	00 00 00 
+  804d9f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804da1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804da4:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804da7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804daa:	48 98                	cltq
+  804dac:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804db3:	0f 82 7a ff ff ff    	jb     804d33 <devcons_write+0x29>
+  }
+  return tot;
+  804db9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dbc:	48 98                	cltq
+}
+  804dbe:	c9                   	leave
+  804dbf:	c3                   	ret
+
+0000000000804dc0 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804dc0:	55                   	push   %rbp
+  804dc1:	48 89 e5             	mov    %rsp,%rbp
+  804dc4:	48 83 ec 08          	sub    $0x8,%rsp
+  804dc8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dd1:	c9                   	leave
+  804dd2:	c3                   	ret
+
+0000000000804dd3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dd3:	55                   	push   %rbp
+  804dd4:	48 89 e5             	mov    %rsp,%rbp
+  804dd7:	48 83 ec 10          	sub    $0x10,%rsp
+  804ddb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804ddf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804de3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804de7:	48 ba 05 59 80 00 00 	movabs $0x805905,%rdx
+  804dee:	00 00 00 
+  804df1:	48 89 d6             	mov    %rdx,%rsi
+  804df4:	48 89 c7             	mov    %rax,%rdi
+  804df7:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  804dfe:	00 00 00 
+  804e01:	ff d0                	call   *%rax
+  return 0;
+  804e03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e08:	c9                   	leave
+  804e09:	c3                   	ret
+
+0000000000804e0a <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804e0a:	55                   	push   %rbp
+  804e0b:	48 89 e5             	mov    %rsp,%rbp
+  804e0e:	48 83 ec 30          	sub    $0x30,%rsp
+  804e12:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e16:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804e19:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804e1d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804e24:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e27:	83 e0 02             	and    $0x2,%eax
+  804e2a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804e2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e31:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e34:	83 f8 01             	cmp    $0x1,%eax
+  804e37:	75 04                	jne    804e3d <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804e39:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804e3d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e40:	83 e0 01             	and    $0x1,%eax
+  804e43:	85 c0                	test   %eax,%eax
+  804e45:	74 44                	je     804e8b <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804e47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e4f:	89 c2                	mov    %eax,%edx
+  804e51:	be 00 00 00 00       	mov    $0x0,%esi
+  804e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e5b:	48 b8 e2 25 80 00 00 	movabs $0x8025e2,%rax
+  804e62:	00 00 00 
+  804e65:	ff d0                	call   *%rax
+  804e67:	83 f8 01             	cmp    $0x1,%eax
+  804e6a:	75 06                	jne    804e72 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804e6c:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804e70:	eb 19                	jmp    804e8b <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804e72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e76:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804e7c:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804e7f:	89 c2                	mov    %eax,%edx
+  804e81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e85:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804e8b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804e8e:	c9                   	leave
+  804e8f:	c3                   	ret
+
+0000000000804e90 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804e90:	55                   	push   %rbp
+  804e91:	48 89 e5             	mov    %rsp,%rbp
+  804e94:	48 83 ec 20          	sub    $0x20,%rsp
+  804e98:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e9c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804ea0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804ea4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ea8:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804eac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eb0:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804eb7:	48 89 c7             	mov    %rax,%rdi
+  804eba:	48 b8 c8 4e 80 00 00 	movabs $0x804ec8,%rax
+  804ec1:	00 00 00 
+  804ec4:	ff d0                	call   *%rax
+}
+  804ec6:	c9                   	leave
+  804ec7:	c3                   	ret
+
+0000000000804ec8 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804ec8:	55                   	push   %rbp
+  804ec9:	48 89 e5             	mov    %rsp,%rbp
+  804ecc:	48 83 ec 30          	sub    $0x30,%rsp
+  804ed0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ed4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804ed8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804edc:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804ee0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ee5:	75 0e                	jne    804ef5 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804ee7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804eee:	00 00 00 
+  804ef1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804ef5:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804efa:	75 18                	jne    804f14 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804efc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f00:	48 89 c7             	mov    %rax,%rdi
+  804f03:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  804f0a:	00 00 00 
+  804f0d:	ff d0                	call   *%rax
+  804f0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f12:	eb 1d                	jmp    804f31 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804f14:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f1c:	48 89 d6             	mov    %rdx,%rsi
+  804f1f:	48 89 c7             	mov    %rax,%rdi
+  804f22:	48 b8 20 24 80 00 00 	movabs $0x802420,%rax
+  804f29:	00 00 00 
+  804f2c:	ff d0                	call   *%rax
+  804f2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804f31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f35:	79 2a                	jns    804f61 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804f37:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f3c:	74 0a                	je     804f48 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f42:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804f48:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804f4d:	74 0a                	je     804f59 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804f4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f53:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804f59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f5c:	e9 aa 00 00 00       	jmp    80500b <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804f61:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f66:	74 36                	je     804f9e <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804f68:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f6f:	00 00 00 
+  804f72:	8b 40 04             	mov    0x4(%rax),%eax
+  804f75:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f7a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f81:	00 00 00 
+  804f84:	48 98                	cltq
+  804f86:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f8d:	48 01 d0             	add    %rdx,%rax
+  804f90:	48 05 24 01 00 00    	add    $0x124,%rax
+  804f96:	8b 10                	mov    (%rax),%edx
+  804f98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f9c:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804f9e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804fa3:	74 36                	je     804fdb <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804fa5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fac:	00 00 00 
+  804faf:	8b 40 04             	mov    0x4(%rax),%eax
+  804fb2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804fb7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fbe:	00 00 00 
+  804fc1:	48 98                	cltq
+  804fc3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804fca:	48 01 d0             	add    %rdx,%rax
+  804fcd:	48 05 28 01 00 00    	add    $0x128,%rax
+  804fd3:	8b 10                	mov    (%rax),%edx
+  804fd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fd9:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804fdb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fe2:	00 00 00 
+  804fe5:	8b 40 04             	mov    0x4(%rax),%eax
+  804fe8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804fed:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ff4:	00 00 00 
+  804ff7:	48 98                	cltq
+  804ff9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805000:	48 01 d0             	add    %rdx,%rax
+  805003:	48 05 20 01 00 00    	add    $0x120,%rax
+  805009:	8b 00                	mov    (%rax),%eax
+  }
+}
+  80500b:	c9                   	leave
+  80500c:	c3                   	ret
+
+000000000080500d <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  80500d:	55                   	push   %rbp
+  80500e:	48 89 e5             	mov    %rsp,%rbp
+  805011:	48 83 ec 30          	sub    $0x30,%rsp
+  805015:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805018:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80501b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80501f:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805022:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805027:	75 5e                	jne    805087 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805029:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805030:	00 00 00 
+  805033:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805037:	eb 4e                	jmp    805087 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805039:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80503d:	79 3c                	jns    80507b <ipc_send+0x6e>
+  80503f:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805043:	74 36                	je     80507b <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805045:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805048:	89 c1                	mov    %eax,%ecx
+  80504a:	48 b8 10 59 80 00 00 	movabs $0x805910,%rax
+  805051:	00 00 00 
+  805054:	48 89 c2             	mov    %rax,%rdx
+  805057:	be 54 00 00 00       	mov    $0x54,%esi
+  80505c:	48 b8 36 59 80 00 00 	movabs $0x805936,%rax
+  805063:	00 00 00 
+  805066:	48 89 c7             	mov    %rax,%rdi
+  805069:	b8 00 00 00 00       	mov    $0x0,%eax
+  80506e:	49 b8 fd 01 80 00 00 	movabs $0x8001fd,%r8
+  805075:	00 00 00 
+  805078:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  80507b:	48 b8 5d 21 80 00 00 	movabs $0x80215d,%rax
+  805082:	00 00 00 
+  805085:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805087:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80508a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80508d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805091:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805094:	89 c7                	mov    %eax,%edi
+  805096:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  80509d:	00 00 00 
+  8050a0:	ff d0                	call   *%rax
+  8050a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8050a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050a9:	75 8e                	jne    805039 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8050ab:	48 b8 5d 21 80 00 00 	movabs $0x80215d,%rax
+  8050b2:	00 00 00 
+  8050b5:	ff d0                	call   *%rax
+}
+  8050b7:	90                   	nop
+  8050b8:	c9                   	leave
+  8050b9:	c3                   	ret
+
+00000000008050ba <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8050ba:	55                   	push   %rbp
+  8050bb:	48 89 e5             	mov    %rsp,%rbp
+  8050be:	48 83 ec 18          	sub    $0x18,%rsp
+  8050c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8050c5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8050cc:	eb 4d                	jmp    80511b <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8050ce:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050d5:	00 00 00 
+  8050d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050db:	48 98                	cltq
+  8050dd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8050e4:	48 01 d0             	add    %rdx,%rax
+  8050e7:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8050ed:	8b 00                	mov    (%rax),%eax
+  8050ef:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8050f2:	75 23                	jne    805117 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8050f4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050fb:	00 00 00 
+  8050fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805101:	48 98                	cltq
+  805103:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80510a:	48 01 d0             	add    %rdx,%rax
+  80510d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805113:	8b 00                	mov    (%rax),%eax
+  805115:	eb 12                	jmp    805129 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805117:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80511b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805122:	7e aa                	jle    8050ce <ipc_find_env+0x14>
+  return 0;
+  805124:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805129:	c9                   	leave
+  80512a:	c3                   	ret
+
+000000000080512b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80512b:	55                   	push   %rbp
+  80512c:	48 89 e5             	mov    %rsp,%rbp
+  80512f:	48 83 ec 18          	sub    $0x18,%rsp
+  805133:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80513b:	48 c1 e8 27          	shr    $0x27,%rax
+  80513f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805144:	48 89 c2             	mov    %rax,%rdx
+  805147:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80514e:	01 00 00 
+  805151:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805155:	83 e0 01             	and    $0x1,%eax
+  805158:	48 85 c0             	test   %rax,%rax
+  80515b:	74 63                	je     8051c0 <pageref+0x95>
+  80515d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805161:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805165:	48 89 c2             	mov    %rax,%rdx
+  805168:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80516f:	01 00 00 
+  805172:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805176:	83 e0 01             	and    $0x1,%eax
+  805179:	48 85 c0             	test   %rax,%rax
+  80517c:	74 42                	je     8051c0 <pageref+0x95>
+  80517e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805182:	48 c1 e8 15          	shr    $0x15,%rax
+  805186:	48 89 c2             	mov    %rax,%rdx
+  805189:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805190:	01 00 00 
+  805193:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805197:	83 e0 01             	and    $0x1,%eax
+  80519a:	48 85 c0             	test   %rax,%rax
+  80519d:	74 21                	je     8051c0 <pageref+0x95>
+  80519f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051a7:	48 89 c2             	mov    %rax,%rdx
+  8051aa:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8051b1:	01 00 00 
+  8051b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051b8:	83 e0 01             	and    $0x1,%eax
+  8051bb:	48 85 c0             	test   %rax,%rax
+  8051be:	75 07                	jne    8051c7 <pageref+0x9c>
+    return 0;
+  8051c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c5:	eb 53                	jmp    80521a <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8051c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051cb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051cf:	48 89 c2             	mov    %rax,%rdx
+  8051d2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8051d9:	01 00 00 
+  8051dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8051e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8051e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e8:	83 e0 01             	and    $0x1,%eax
+  8051eb:	48 85 c0             	test   %rax,%rax
+  8051ee:	75 07                	jne    8051f7 <pageref+0xcc>
+    return 0;
+  8051f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f5:	eb 23                	jmp    80521a <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8051f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051fb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051ff:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805206:	00 00 00 
+  805209:	48 c1 e0 04          	shl    $0x4,%rax
+  80520d:	48 01 d0             	add    %rdx,%rax
+  805210:	48 83 c0 08          	add    $0x8,%rax
+  805214:	0f b7 00             	movzwl (%rax),%eax
+  805217:	0f b7 c0             	movzwl %ax,%eax
+}
+  80521a:	c9                   	leave
+  80521b:	c3                   	ret
@@ -0,0 +1,8290 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 aa 00 00 00       	call   8000d6 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <handler>:
+// test user-level fault handler -- just exit when we fault
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  void *addr   = (void *)utf->utf_fault_va;
+  80003e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800042:	48 8b 00             	mov    (%rax),%rax
+  800045:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  800049:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80004d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800051:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  cprintf("i faulted at va %lx, err %x\n",
+  800055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800059:	83 e0 07             	and    $0x7,%eax
+  80005c:	89 c2                	mov    %eax,%edx
+  80005e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800062:	48 89 c6             	mov    %rax,%rsi
+  800065:	48 b8 a0 51 80 00 00 	movabs $0x8051a0,%rax
+  80006c:	00 00 00 
+  80006f:	48 89 c7             	mov    %rax,%rdi
+  800072:	b8 00 00 00 00       	mov    $0x0,%eax
+  800077:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  80007e:	00 00 00 
+  800081:	ff d1                	call   *%rcx
+          (unsigned long)addr, (unsigned)(err & 7));
+  sys_env_destroy(sys_getenvid());
+  800083:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  80008a:	00 00 00 
+  80008d:	ff d0                	call   *%rax
+  80008f:	89 c7                	mov    %eax,%edi
+  800091:	48 b8 72 1e 80 00 00 	movabs $0x801e72,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+}
+  80009d:	90                   	nop
+  80009e:	c9                   	leave
+  80009f:	c3                   	ret
+
+00000000008000a0 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000a0:	55                   	push   %rbp
+  8000a1:	48 89 e5             	mov    %rsp,%rbp
+  8000a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8000a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8000ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  set_pgfault_handler(handler);
+  8000af:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000b6:	00 00 00 
+  8000b9:	48 89 c7             	mov    %rax,%rdi
+  8000bc:	48 b8 e7 26 80 00 00 	movabs $0x8026e7,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+  *(volatile int *)0xDeadBeef = 0;
+  8000c8:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  8000cd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8000d3:	90                   	nop
+  8000d4:	c9                   	leave
+  8000d5:	c3                   	ret
+
+00000000008000d6 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000d6:	55                   	push   %rbp
+  8000d7:	48 89 e5             	mov    %rsp,%rbp
+  8000da:	48 83 ec 20          	sub    $0x20,%rsp
+  8000de:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8000e5:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000ec:	00 00 00 
+  8000ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000f3:	eb 13                	jmp    800108 <libmain+0x32>
+    (*ctor)();
+  8000f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000f9:	48 8b 10             	mov    (%rax),%rdx
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	ff d2                	call   *%rdx
+    ctor++;
+  800103:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800108:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80010f:	00 00 00 
+  800112:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800116:	72 dd                	jb     8000f5 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800118:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80011c:	7e 14                	jle    800132 <libmain+0x5c>
+    binaryname = argv[0];
+  80011e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800122:	48 8b 00             	mov    (%rax),%rax
+  800125:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80012c:	00 00 00 
+  80012f:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800132:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800136:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800139:	48 89 d6             	mov    %rdx,%rsi
+  80013c:	89 c7                	mov    %eax,%edi
+  80013e:	48 b8 a0 00 80 00 00 	movabs $0x8000a0,%rax
+  800145:	00 00 00 
+  800148:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80014a:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+#endif
+}
+  800156:	90                   	nop
+  800157:	c9                   	leave
+  800158:	c3                   	ret
+
+0000000000800159 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800159:	55                   	push   %rbp
+  80015a:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80015d:	48 b8 3d 2c 80 00 00 	movabs $0x802c3d,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800169:	bf 00 00 00 00       	mov    $0x0,%edi
+  80016e:	48 b8 b8 1e 80 00 00 	movabs $0x801eb8,%rax
+  800175:	00 00 00 
+  800178:	ff d0                	call   *%rax
+}
+  80017a:	90                   	nop
+  80017b:	5d                   	pop    %rbp
+  80017c:	c3                   	ret
+
+000000000080017d <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80017d:	55                   	push   %rbp
+  80017e:	48 89 e5             	mov    %rsp,%rbp
+  800181:	48 83 ec 10          	sub    $0x10,%rsp
+  800185:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800188:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80018c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800190:	8b 00                	mov    (%rax),%eax
+  800192:	8d 48 01             	lea    0x1(%rax),%ecx
+  800195:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800199:	89 0a                	mov    %ecx,(%rdx)
+  80019b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80019e:	89 d1                	mov    %edx,%ecx
+  8001a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001a4:	48 98                	cltq
+  8001a6:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8001aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ae:	8b 00                	mov    (%rax),%eax
+  8001b0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b5:	75 2c                	jne    8001e3 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8001b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001bb:	8b 00                	mov    (%rax),%eax
+  8001bd:	48 98                	cltq
+  8001bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001c3:	48 83 c2 08          	add    $0x8,%rdx
+  8001c7:	48 89 c6             	mov    %rax,%rsi
+  8001ca:	48 89 d7             	mov    %rdx,%rdi
+  8001cd:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+    b->idx = 0;
+  8001d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001dd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8001e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8001ea:	8d 50 01             	lea    0x1(%rax),%edx
+  8001ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001f1:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8001f4:	90                   	nop
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+00000000008001f7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001f7:	55                   	push   %rbp
+  8001f8:	48 89 e5             	mov    %rsp,%rbp
+  8001fb:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800202:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800209:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800210:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800217:	00 00 00 
+  b.cnt = 0;
+  80021a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800221:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800224:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80022b:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800232:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800239:	48 89 c6             	mov    %rax,%rsi
+  80023c:	48 b8 7d 01 80 00 00 	movabs $0x80017d,%rax
+  800243:	00 00 00 
+  800246:	48 89 c7             	mov    %rax,%rdi
+  800249:	48 b8 dc 05 80 00 00 	movabs $0x8005dc,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800255:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80025b:	48 98                	cltq
+  80025d:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800264:	48 83 c2 08          	add    $0x8,%rdx
+  800268:	48 89 c6             	mov    %rax,%rsi
+  80026b:	48 89 d7             	mov    %rdx,%rdi
+  80026e:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  800275:	00 00 00 
+  800278:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80027a:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+0000000000800282 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800282:	55                   	push   %rbp
+  800283:	48 89 e5             	mov    %rsp,%rbp
+  800286:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80028d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800294:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80029b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8002a2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8002a9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8002b0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8002b7:	84 c0                	test   %al,%al
+  8002b9:	74 20                	je     8002db <cprintf+0x59>
+  8002bb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8002bf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8002c3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002c7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002cb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002cf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8002d3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8002d7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002db:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8002e2:	00 00 00 
+  8002e5:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8002ec:	00 00 00 
+  8002ef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8002fa:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800301:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800308:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80030f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800316:	48 89 d6             	mov    %rdx,%rsi
+  800319:	48 89 c7             	mov    %rax,%rdi
+  80031c:	48 b8 f7 01 80 00 00 	movabs $0x8001f7,%rax
+  800323:	00 00 00 
+  800326:	ff d0                	call   *%rax
+  800328:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80032e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+
+0000000000800336 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800336:	55                   	push   %rbp
+  800337:	48 89 e5             	mov    %rsp,%rbp
+  80033a:	48 83 ec 30          	sub    $0x30,%rsp
+  80033e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800342:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800346:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80034a:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80034d:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800351:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800355:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800358:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80035c:	72 54                	jb     8003b2 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80035e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800361:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800364:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800367:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80036b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800370:	48 f7 f6             	div    %rsi
+  800373:	49 89 c2             	mov    %rax,%r10
+  800376:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800379:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80037c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800380:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800384:	41 89 c9             	mov    %ecx,%r9d
+  800387:	41 89 f8             	mov    %edi,%r8d
+  80038a:	89 d1                	mov    %edx,%ecx
+  80038c:	4c 89 d2             	mov    %r10,%rdx
+  80038f:	48 89 c7             	mov    %rax,%rdi
+  800392:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+  80039e:	eb 1c                	jmp    8003bc <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003a7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8003ab:	48 89 d6             	mov    %rdx,%rsi
+  8003ae:	89 c7                	mov    %eax,%edi
+  8003b0:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8003b2:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8003b6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8003ba:	7f e4                	jg     8003a0 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8003bc:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8003bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c8:	48 f7 f1             	div    %rcx
+  8003cb:	48 b8 10 54 80 00 00 	movabs $0x805410,%rax
+  8003d2:	00 00 00 
+  8003d5:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8003d9:	0f be c0             	movsbl %al,%eax
+  8003dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003e0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8003e4:	48 89 d6             	mov    %rdx,%rsi
+  8003e7:	89 c7                	mov    %eax,%edi
+  8003e9:	ff d1                	call   *%rcx
+}
+  8003eb:	90                   	nop
+  8003ec:	c9                   	leave
+  8003ed:	c3                   	ret
+
+00000000008003ee <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8003ee:	55                   	push   %rbp
+  8003ef:	48 89 e5             	mov    %rsp,%rbp
+  8003f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8003f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8003fd:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800401:	7e 4b                	jle    80044e <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800407:	8b 00                	mov    (%rax),%eax
+  800409:	83 f8 2f             	cmp    $0x2f,%eax
+  80040c:	77 24                	ja     800432 <getuint+0x44>
+  80040e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800412:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800416:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80041a:	8b 00                	mov    (%rax),%eax
+  80041c:	89 c0                	mov    %eax,%eax
+  80041e:	48 01 d0             	add    %rdx,%rax
+  800421:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800425:	8b 12                	mov    (%rdx),%edx
+  800427:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80042a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80042e:	89 0a                	mov    %ecx,(%rdx)
+  800430:	eb 14                	jmp    800446 <getuint+0x58>
+  800432:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800436:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80043a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80043e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800442:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800446:	48 8b 00             	mov    (%rax),%rax
+  800449:	e9 95 00 00 00       	jmp    8004e3 <getuint+0xf5>
+  else if (lflag)
+  80044e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800452:	74 48                	je     80049c <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800458:	8b 00                	mov    (%rax),%eax
+  80045a:	83 f8 2f             	cmp    $0x2f,%eax
+  80045d:	77 24                	ja     800483 <getuint+0x95>
+  80045f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800463:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80046b:	8b 00                	mov    (%rax),%eax
+  80046d:	89 c0                	mov    %eax,%eax
+  80046f:	48 01 d0             	add    %rdx,%rax
+  800472:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800476:	8b 12                	mov    (%rdx),%edx
+  800478:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80047b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80047f:	89 0a                	mov    %ecx,(%rdx)
+  800481:	eb 14                	jmp    800497 <getuint+0xa9>
+  800483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800487:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80048b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80048f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800493:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800497:	48 8b 00             	mov    (%rax),%rax
+  80049a:	eb 47                	jmp    8004e3 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80049c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a0:	8b 00                	mov    (%rax),%eax
+  8004a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a5:	77 24                	ja     8004cb <getuint+0xdd>
+  8004a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ab:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004b3:	8b 00                	mov    (%rax),%eax
+  8004b5:	89 c0                	mov    %eax,%eax
+  8004b7:	48 01 d0             	add    %rdx,%rax
+  8004ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004be:	8b 12                	mov    (%rdx),%edx
+  8004c0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004c7:	89 0a                	mov    %ecx,(%rdx)
+  8004c9:	eb 14                	jmp    8004df <getuint+0xf1>
+  8004cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004d3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004db:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004df:	8b 00                	mov    (%rax),%eax
+  8004e1:	89 c0                	mov    %eax,%eax
+}
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004f1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8004f4:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8004f8:	7e 4b                	jle    800545 <getint+0x60>
+    return va_arg(*ap, long long);
+  8004fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004fe:	8b 00                	mov    (%rax),%eax
+  800500:	83 f8 2f             	cmp    $0x2f,%eax
+  800503:	77 24                	ja     800529 <getint+0x44>
+  800505:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800509:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80050d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800511:	8b 00                	mov    (%rax),%eax
+  800513:	89 c0                	mov    %eax,%eax
+  800515:	48 01 d0             	add    %rdx,%rax
+  800518:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80051c:	8b 12                	mov    (%rdx),%edx
+  80051e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800521:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800525:	89 0a                	mov    %ecx,(%rdx)
+  800527:	eb 14                	jmp    80053d <getint+0x58>
+  800529:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80052d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800531:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800535:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800539:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80053d:	48 8b 00             	mov    (%rax),%rax
+  800540:	e9 95 00 00 00       	jmp    8005da <getint+0xf5>
+  else if (lflag)
+  800545:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800549:	74 48                	je     800593 <getint+0xae>
+    return va_arg(*ap, long);
+  80054b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054f:	8b 00                	mov    (%rax),%eax
+  800551:	83 f8 2f             	cmp    $0x2f,%eax
+  800554:	77 24                	ja     80057a <getint+0x95>
+  800556:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80055a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80055e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800562:	8b 00                	mov    (%rax),%eax
+  800564:	89 c0                	mov    %eax,%eax
+  800566:	48 01 d0             	add    %rdx,%rax
+  800569:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80056d:	8b 12                	mov    (%rdx),%edx
+  80056f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800572:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800576:	89 0a                	mov    %ecx,(%rdx)
+  800578:	eb 14                	jmp    80058e <getint+0xa9>
+  80057a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80057e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800582:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800586:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80058a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80058e:	48 8b 00             	mov    (%rax),%rax
+  800591:	eb 47                	jmp    8005da <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800597:	8b 00                	mov    (%rax),%eax
+  800599:	83 f8 2f             	cmp    $0x2f,%eax
+  80059c:	77 24                	ja     8005c2 <getint+0xdd>
+  80059e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005aa:	8b 00                	mov    (%rax),%eax
+  8005ac:	89 c0                	mov    %eax,%eax
+  8005ae:	48 01 d0             	add    %rdx,%rax
+  8005b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005b5:	8b 12                	mov    (%rdx),%edx
+  8005b7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005be:	89 0a                	mov    %ecx,(%rdx)
+  8005c0:	eb 14                	jmp    8005d6 <getint+0xf1>
+  8005c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005ca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005d2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005d6:	8b 00                	mov    (%rax),%eax
+  8005d8:	48 98                	cltq
+}
+  8005da:	c9                   	leave
+  8005db:	c3                   	ret
+
+00000000008005dc <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8005dc:	55                   	push   %rbp
+  8005dd:	48 89 e5             	mov    %rsp,%rbp
+  8005e0:	41 54                	push   %r12
+  8005e2:	53                   	push   %rbx
+  8005e3:	48 83 ec 60          	sub    $0x60,%rsp
+  8005e7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8005eb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8005ef:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005f3:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8005f7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005fb:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8005ff:	48 8b 06             	mov    (%rsi),%rax
+  800602:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800606:	48 89 01             	mov    %rax,(%rcx)
+  800609:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80060d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800611:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800615:	eb 17                	jmp    80062e <vprintfmt+0x52>
+      if (ch == '\0')
+  800617:	85 db                	test   %ebx,%ebx
+  800619:	0f 84 bf 04 00 00    	je     800ade <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80061f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800623:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800627:	48 89 c6             	mov    %rax,%rsi
+  80062a:	89 df                	mov    %ebx,%edi
+  80062c:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80062e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800632:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800636:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80063a:	0f b6 00             	movzbl (%rax),%eax
+  80063d:	0f b6 d8             	movzbl %al,%ebx
+  800640:	83 fb 25             	cmp    $0x25,%ebx
+  800643:	75 d2                	jne    800617 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800645:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800649:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800650:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800657:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80065e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800665:	eb 04                	jmp    80066b <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800667:	90                   	nop
+  800668:	eb 01                	jmp    80066b <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80066a:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80066b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80066f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800673:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800677:	0f b6 00             	movzbl (%rax),%eax
+  80067a:	0f b6 d8             	movzbl %al,%ebx
+  80067d:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800680:	83 f8 55             	cmp    $0x55,%eax
+  800683:	0f 87 22 04 00 00    	ja     800aab <vprintfmt+0x4cf>
+  800689:	89 c0                	mov    %eax,%eax
+  80068b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800692:	00 
+  800693:	48 b8 38 54 80 00 00 	movabs $0x805438,%rax
+  80069a:	00 00 00 
+  80069d:	48 01 d0             	add    %rdx,%rax
+  8006a0:	48 8b 00             	mov    (%rax),%rax
+  8006a3:	ff e0                	jmp    *%rax
+        padc = '-';
+  8006a5:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8006a9:	eb c0                	jmp    80066b <vprintfmt+0x8f>
+        padc = '0';
+  8006ab:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8006af:	eb ba                	jmp    80066b <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8006b1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8006b8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8006bb:	89 d0                	mov    %edx,%eax
+  8006bd:	c1 e0 02             	shl    $0x2,%eax
+  8006c0:	01 d0                	add    %edx,%eax
+  8006c2:	01 c0                	add    %eax,%eax
+  8006c4:	01 d8                	add    %ebx,%eax
+  8006c6:	83 e8 30             	sub    $0x30,%eax
+  8006c9:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8006cc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006d0:	0f b6 00             	movzbl (%rax),%eax
+  8006d3:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8006d6:	83 fb 2f             	cmp    $0x2f,%ebx
+  8006d9:	7e 60                	jle    80073b <vprintfmt+0x15f>
+  8006db:	83 fb 39             	cmp    $0x39,%ebx
+  8006de:	7f 5b                	jg     80073b <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8006e0:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8006e5:	eb d1                	jmp    8006b8 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8006e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ed:	77 17                	ja     800706 <vprintfmt+0x12a>
+  8006ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006f3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8006f6:	89 d2                	mov    %edx,%edx
+  8006f8:	48 01 d0             	add    %rdx,%rax
+  8006fb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8006fe:	83 c2 08             	add    $0x8,%edx
+  800701:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800704:	eb 0c                	jmp    800712 <vprintfmt+0x136>
+  800706:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80070a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80070e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800712:	8b 00                	mov    (%rax),%eax
+  800714:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800717:	eb 23                	jmp    80073c <vprintfmt+0x160>
+        if (width < 0)
+  800719:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80071d:	0f 89 44 ff ff ff    	jns    800667 <vprintfmt+0x8b>
+          width = 0;
+  800723:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  80072a:	e9 38 ff ff ff       	jmp    800667 <vprintfmt+0x8b>
+        altflag = 1;
+  80072f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800736:	e9 30 ff ff ff       	jmp    80066b <vprintfmt+0x8f>
+        goto process_precision;
+  80073b:	90                   	nop
+        if (width < 0)
+  80073c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800740:	0f 89 24 ff ff ff    	jns    80066a <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800746:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800749:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80074c:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800753:	e9 12 ff ff ff       	jmp    80066a <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800758:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80075c:	e9 0a ff ff ff       	jmp    80066b <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800761:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800764:	83 f8 2f             	cmp    $0x2f,%eax
+  800767:	77 17                	ja     800780 <vprintfmt+0x1a4>
+  800769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80076d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800770:	89 d2                	mov    %edx,%edx
+  800772:	48 01 d0             	add    %rdx,%rax
+  800775:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800778:	83 c2 08             	add    $0x8,%edx
+  80077b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80077e:	eb 0c                	jmp    80078c <vprintfmt+0x1b0>
+  800780:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800784:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800788:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80078c:	8b 00                	mov    (%rax),%eax
+  80078e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800792:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800796:	48 89 d6             	mov    %rdx,%rsi
+  800799:	89 c7                	mov    %eax,%edi
+  80079b:	ff d1                	call   *%rcx
+        break;
+  80079d:	e9 37 03 00 00       	jmp    800ad9 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 17                	ja     8007c1 <vprintfmt+0x1e5>
+  8007aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007ae:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007b1:	89 d2                	mov    %edx,%edx
+  8007b3:	48 01 d0             	add    %rdx,%rax
+  8007b6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007b9:	83 c2 08             	add    $0x8,%edx
+  8007bc:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007bf:	eb 0c                	jmp    8007cd <vprintfmt+0x1f1>
+  8007c1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007c5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007c9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007cd:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8007cf:	85 db                	test   %ebx,%ebx
+  8007d1:	79 02                	jns    8007d5 <vprintfmt+0x1f9>
+          err = -err;
+  8007d3:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007d5:	83 fb 15             	cmp    $0x15,%ebx
+  8007d8:	7f 16                	jg     8007f0 <vprintfmt+0x214>
+  8007da:	48 ba 60 53 80 00 00 	movabs $0x805360,%rdx
+  8007e1:	00 00 00 
+  8007e4:	48 63 c3             	movslq %ebx,%rax
+  8007e7:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8007eb:	4d 85 e4             	test   %r12,%r12
+  8007ee:	75 2e                	jne    80081e <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8007f0:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007f4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007f8:	89 d9                	mov    %ebx,%ecx
+  8007fa:	48 ba 21 54 80 00 00 	movabs $0x805421,%rdx
+  800801:	00 00 00 
+  800804:	48 89 c7             	mov    %rax,%rdi
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	49 b8 e8 0a 80 00 00 	movabs $0x800ae8,%r8
+  800813:	00 00 00 
+  800816:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800819:	e9 bb 02 00 00       	jmp    800ad9 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80081e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800822:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800826:	4c 89 e1             	mov    %r12,%rcx
+  800829:	48 ba 2a 54 80 00 00 	movabs $0x80542a,%rdx
+  800830:	00 00 00 
+  800833:	48 89 c7             	mov    %rax,%rdi
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	49 b8 e8 0a 80 00 00 	movabs $0x800ae8,%r8
+  800842:	00 00 00 
+  800845:	41 ff d0             	call   *%r8
+        break;
+  800848:	e9 8c 02 00 00       	jmp    800ad9 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 17                	ja     80086c <vprintfmt+0x290>
+  800855:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800859:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80085c:	89 d2                	mov    %edx,%edx
+  80085e:	48 01 d0             	add    %rdx,%rax
+  800861:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800864:	83 c2 08             	add    $0x8,%edx
+  800867:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80086a:	eb 0c                	jmp    800878 <vprintfmt+0x29c>
+  80086c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800870:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800874:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800878:	4c 8b 20             	mov    (%rax),%r12
+  80087b:	4d 85 e4             	test   %r12,%r12
+  80087e:	75 0a                	jne    80088a <vprintfmt+0x2ae>
+          p = "(null)";
+  800880:	49 bc 2d 54 80 00 00 	movabs $0x80542d,%r12
+  800887:	00 00 00 
+        if (width > 0 && padc != '-')
+  80088a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80088e:	7e 78                	jle    800908 <vprintfmt+0x32c>
+  800890:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800894:	74 72                	je     800908 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800896:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800899:	48 98                	cltq
+  80089b:	48 89 c6             	mov    %rax,%rsi
+  80089e:	4c 89 e7             	mov    %r12,%rdi
+  8008a1:	48 b8 f4 11 80 00 00 	movabs $0x8011f4,%rax
+  8008a8:	00 00 00 
+  8008ab:	ff d0                	call   *%rax
+  8008ad:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8008b0:	eb 17                	jmp    8008c9 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8008b2:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8008b6:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8008ba:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8008be:	48 89 d6             	mov    %rdx,%rsi
+  8008c1:	89 c7                	mov    %eax,%edi
+  8008c3:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8008c5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008c9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008cd:	7f e3                	jg     8008b2 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008cf:	eb 37                	jmp    800908 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8008d1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8008d5:	74 1e                	je     8008f5 <vprintfmt+0x319>
+  8008d7:	83 fb 1f             	cmp    $0x1f,%ebx
+  8008da:	7e 05                	jle    8008e1 <vprintfmt+0x305>
+  8008dc:	83 fb 7e             	cmp    $0x7e,%ebx
+  8008df:	7e 14                	jle    8008f5 <vprintfmt+0x319>
+            putch('?', putdat);
+  8008e1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008e5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008e9:	48 89 c6             	mov    %rax,%rsi
+  8008ec:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008f1:	ff d2                	call   *%rdx
+  8008f3:	eb 0f                	jmp    800904 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8008f5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008f9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008fd:	48 89 c6             	mov    %rax,%rsi
+  800900:	89 df                	mov    %ebx,%edi
+  800902:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800904:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800908:	4c 89 e0             	mov    %r12,%rax
+  80090b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80090f:	0f b6 00             	movzbl (%rax),%eax
+  800912:	0f be d8             	movsbl %al,%ebx
+  800915:	85 db                	test   %ebx,%ebx
+  800917:	74 28                	je     800941 <vprintfmt+0x365>
+  800919:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80091d:	78 b2                	js     8008d1 <vprintfmt+0x2f5>
+  80091f:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800923:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800927:	79 a8                	jns    8008d1 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800929:	eb 16                	jmp    800941 <vprintfmt+0x365>
+          putch(' ', putdat);
+  80092b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80092f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800933:	48 89 c6             	mov    %rax,%rsi
+  800936:	bf 20 00 00 00       	mov    $0x20,%edi
+  80093b:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80093d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800941:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800945:	7f e4                	jg     80092b <vprintfmt+0x34f>
+        break;
+  800947:	e9 8d 01 00 00       	jmp    800ad9 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80094c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80094f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800953:	89 d6                	mov    %edx,%esi
+  800955:	48 89 c7             	mov    %rax,%rdi
+  800958:	48 b8 e5 04 80 00 00 	movabs $0x8004e5,%rax
+  80095f:	00 00 00 
+  800962:	ff d0                	call   *%rax
+  800964:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800968:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096c:	48 85 c0             	test   %rax,%rax
+  80096f:	79 1d                	jns    80098e <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800971:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800975:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800979:	48 89 c6             	mov    %rax,%rsi
+  80097c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800981:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800983:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800987:	48 f7 d8             	neg    %rax
+  80098a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80098e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800995:	e9 d2 00 00 00       	jmp    800a6c <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80099a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80099d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009a1:	89 d6                	mov    %edx,%esi
+  8009a3:	48 89 c7             	mov    %rax,%rdi
+  8009a6:	48 b8 ee 03 80 00 00 	movabs $0x8003ee,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+  8009b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8009b6:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8009bd:	e9 aa 00 00 00       	jmp    800a6c <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8009c2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009c5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009c9:	89 d6                	mov    %edx,%esi
+  8009cb:	48 89 c7             	mov    %rax,%rdi
+  8009ce:	48 b8 ee 03 80 00 00 	movabs $0x8003ee,%rax
+  8009d5:	00 00 00 
+  8009d8:	ff d0                	call   *%rax
+  8009da:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8009de:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8009e5:	e9 82 00 00 00       	jmp    800a6c <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8009ea:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ee:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009f2:	48 89 c6             	mov    %rax,%rsi
+  8009f5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009fa:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8009fc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a00:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a04:	48 89 c6             	mov    %rax,%rsi
+  800a07:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a0c:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 17                	ja     800a2d <vprintfmt+0x451>
+  800a16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a1a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a1d:	89 d2                	mov    %edx,%edx
+  800a1f:	48 01 d0             	add    %rdx,%rax
+  800a22:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a25:	83 c2 08             	add    $0x8,%edx
+  800a28:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a2b:	eb 0c                	jmp    800a39 <vprintfmt+0x45d>
+  800a2d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a31:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a35:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a39:	48 8b 00             	mov    (%rax),%rax
+  800a3c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a40:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800a47:	eb 23                	jmp    800a6c <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800a49:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a4c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a50:	89 d6                	mov    %edx,%esi
+  800a52:	48 89 c7             	mov    %rax,%rdi
+  800a55:	48 b8 ee 03 80 00 00 	movabs $0x8003ee,%rax
+  800a5c:	00 00 00 
+  800a5f:	ff d0                	call   *%rax
+  800a61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a65:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a6c:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a71:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a74:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a7b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a7f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a83:	45 89 c1             	mov    %r8d,%r9d
+  800a86:	41 89 f8             	mov    %edi,%r8d
+  800a89:	48 89 c7             	mov    %rax,%rdi
+  800a8c:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  800a93:	00 00 00 
+  800a96:	ff d0                	call   *%rax
+        break;
+  800a98:	eb 3f                	jmp    800ad9 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a9a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aa2:	48 89 c6             	mov    %rax,%rsi
+  800aa5:	89 df                	mov    %ebx,%edi
+  800aa7:	ff d2                	call   *%rdx
+        break;
+  800aa9:	eb 2e                	jmp    800ad9 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800aab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800aaf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ab3:	48 89 c6             	mov    %rax,%rsi
+  800ab6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800abb:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800abd:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ac2:	eb 05                	jmp    800ac9 <vprintfmt+0x4ed>
+  800ac4:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ac9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800acd:	48 83 e8 01          	sub    $0x1,%rax
+  800ad1:	0f b6 00             	movzbl (%rax),%eax
+  800ad4:	3c 25                	cmp    $0x25,%al
+  800ad6:	75 ec                	jne    800ac4 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800ad8:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ad9:	e9 50 fb ff ff       	jmp    80062e <vprintfmt+0x52>
+        return;
+  800ade:	90                   	nop
+    }
+  }
+}
+  800adf:	48 83 c4 60          	add    $0x60,%rsp
+  800ae3:	5b                   	pop    %rbx
+  800ae4:	41 5c                	pop    %r12
+  800ae6:	5d                   	pop    %rbp
+  800ae7:	c3                   	ret
+
+0000000000800ae8 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ae8:	55                   	push   %rbp
+  800ae9:	48 89 e5             	mov    %rsp,%rbp
+  800aec:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800af3:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800afa:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b01:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b08:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b0f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b16:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b1d:	84 c0                	test   %al,%al
+  800b1f:	74 20                	je     800b41 <printfmt+0x59>
+  800b21:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b25:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b29:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b2d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b31:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b35:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b39:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b3d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800b41:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800b48:	00 00 00 
+  800b4b:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800b52:	00 00 00 
+  800b55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b59:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b60:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b67:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b6e:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b75:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b7c:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b83:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b8a:	48 89 c7             	mov    %rax,%rdi
+  800b8d:	48 b8 dc 05 80 00 00 	movabs $0x8005dc,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b99:	90                   	nop
+  800b9a:	c9                   	leave
+  800b9b:	c3                   	ret
+
+0000000000800b9c <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b9c:	55                   	push   %rbp
+  800b9d:	48 89 e5             	mov    %rsp,%rbp
+  800ba0:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ba7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800bab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800baf:	8b 40 10             	mov    0x10(%rax),%eax
+  800bb2:	8d 50 01             	lea    0x1(%rax),%edx
+  800bb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb9:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800bbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bc0:	48 8b 10             	mov    (%rax),%rdx
+  800bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bcb:	48 39 c2             	cmp    %rax,%rdx
+  800bce:	73 17                	jae    800be7 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bd4:	48 8b 00             	mov    (%rax),%rax
+  800bd7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800bdb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800bdf:	48 89 0a             	mov    %rcx,(%rdx)
+  800be2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800be5:	88 10                	mov    %dl,(%rax)
+}
+  800be7:	90                   	nop
+  800be8:	c9                   	leave
+  800be9:	c3                   	ret
+
+0000000000800bea <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800bea:	55                   	push   %rbp
+  800beb:	48 89 e5             	mov    %rsp,%rbp
+  800bee:	48 83 ec 40          	sub    $0x40,%rsp
+  800bf2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800bf6:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800bf9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800bfd:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c05:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c09:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c0c:	48 98                	cltq
+  800c0e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c16:	48 01 d0             	add    %rdx,%rax
+  800c19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c1d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800c24:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c29:	74 06                	je     800c31 <vsnprintf+0x47>
+  800c2b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c2f:	7f 07                	jg     800c38 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800c31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c36:	eb 32                	jmp    800c6a <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800c38:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800c3c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800c40:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800c44:	48 89 c6             	mov    %rax,%rsi
+  800c47:	48 b8 9c 0b 80 00 00 	movabs $0x800b9c,%rax
+  800c4e:	00 00 00 
+  800c51:	48 89 c7             	mov    %rax,%rdi
+  800c54:	48 b8 dc 05 80 00 00 	movabs $0x8005dc,%rax
+  800c5b:	00 00 00 
+  800c5e:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c64:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c67:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c6a:	c9                   	leave
+  800c6b:	c3                   	ret
+
+0000000000800c6c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c6c:	55                   	push   %rbp
+  800c6d:	48 89 e5             	mov    %rsp,%rbp
+  800c70:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c77:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c7e:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c84:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c8b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c92:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c99:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ca0:	84 c0                	test   %al,%al
+  800ca2:	74 20                	je     800cc4 <snprintf+0x58>
+  800ca4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ca8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800cac:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800cb0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800cb4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800cb8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800cbc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cc0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800cc4:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800ccb:	00 00 00 
+  800cce:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800cd5:	00 00 00 
+  800cd8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cdc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800ce3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800cea:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800cf1:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800cf8:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800cff:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d05:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d0c:	48 89 c7             	mov    %rax,%rdi
+  800d0f:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  800d16:	00 00 00 
+  800d19:	ff d0                	call   *%rax
+  800d1b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800d21:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800d27:	c9                   	leave
+  800d28:	c3                   	ret
+
+0000000000800d29 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800d29:	55                   	push   %rbp
+  800d2a:	48 89 e5             	mov    %rsp,%rbp
+  800d2d:	53                   	push   %rbx
+  800d2e:	48 83 ec 38          	sub    $0x38,%rsp
+  800d32:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800d35:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800d39:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800d3d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800d41:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800d45:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4d:	89 d1                	mov    %edx,%ecx
+  800d4f:	0f a2                	cpuid
+  800d51:	89 de                	mov    %ebx,%esi
+  800d53:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800d56:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800d59:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800d5c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800d5f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d64:	74 09                	je     800d6f <cpuid+0x46>
+}
+  800d66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d6a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d6d:	89 10                	mov    %edx,(%rax)
+
+  800d6f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d74:	74 09                	je     800d7f <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d7a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d7d:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d7f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d84:	74 09                	je     800d8f <cpuid+0x66>
+char *
+  800d86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d8a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d8d:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d8f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d94:	74 09                	je     800d9f <cpuid+0x76>
+  for (; *s; s++)
+  800d96:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d9a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d9d:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d9f:	90                   	nop
+  800da0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800da4:	c9                   	leave
+  800da5:	c3                   	ret
+
+0000000000800da6 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800da6:	55                   	push   %rbp
+  800da7:	48 89 e5             	mov    %rsp,%rbp
+  800daa:	48 83 ec 18          	sub    $0x18,%rsp
+  800dae:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800db1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800db4:	89 c1                	mov    %eax,%ecx
+  800db6:	0f 01 d0             	xgetbv
+  800db9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800dbc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dc2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800dc5:	48 c1 e2 20          	shl    $0x20,%rdx
+  800dc9:	48 09 d0             	or     %rdx,%rax
+#else
+  800dcc:	c9                   	leave
+  800dcd:	c3                   	ret
+
+0000000000800dce <string_cpu>:
+string_cpu(void) {
+  800dce:	55                   	push   %rbp
+  800dcf:	48 89 e5             	mov    %rsp,%rbp
+  800dd2:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800dd6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800ddd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800de4:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800deb:	00 00 00 
+  800dee:	8b 00                	mov    (%rax),%eax
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	78 11                	js     800e05 <string_cpu+0x37>
+    return string_features;
+  800df4:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800dfb:	00 00 00 
+  800dfe:	8b 00                	mov    (%rax),%eax
+  800e00:	e9 df 00 00 00       	jmp    800ee4 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e05:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e19:	48 89 c6             	mov    %rax,%rsi
+  800e1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e21:	48 b8 29 0d 80 00 00 	movabs $0x800d29,%rax
+  800e28:	00 00 00 
+  800e2b:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800e2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e30:	83 f8 06             	cmp    $0x6,%eax
+  800e33:	76 28                	jbe    800e5d <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800e35:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800e39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e44:	48 89 c2             	mov    %rax,%rdx
+  800e47:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4c:	bf 07 00 00 00       	mov    $0x7,%edi
+  800e51:	48 b8 29 0d 80 00 00 	movabs $0x800d29,%rax
+  800e58:	00 00 00 
+  800e5b:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800e5d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e60:	25 00 02 00 00       	and    $0x200,%eax
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	74 04                	je     800e6d <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e69:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e6d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e77:	48 89 c1             	mov    %rax,%rcx
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e84:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e89:	48 b8 29 0d 80 00 00 	movabs $0x800d29,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e95:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e98:	83 e0 20             	and    $0x20,%eax
+  800e9b:	85 c0                	test   %eax,%eax
+  800e9d:	74 2a                	je     800ec9 <string_cpu+0xfb>
+  800e9f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800ea2:	25 00 00 00 08       	and    $0x8000000,%eax
+  800ea7:	85 c0                	test   %eax,%eax
+  800ea9:	74 1e                	je     800ec9 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800eab:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb0:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  800eb7:	00 00 00 
+  800eba:	ff d0                	call   *%rax
+  800ebc:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800ebf:	48 83 f8 06          	cmp    $0x6,%rax
+  800ec3:	75 04                	jne    800ec9 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800ec5:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800ec9:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800ed0:	00 00 00 
+  800ed3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ed6:	89 02                	mov    %eax,(%rdx)
+  800ed8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800edf:	00 00 00 
+  800ee2:	8b 00                	mov    (%rax),%eax
+}
+  800ee4:	c9                   	leave
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800ee6:	55                   	push   %rbp
+  800ee7:	48 89 e5             	mov    %rsp,%rbp
+  800eea:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800eee:	48 83 ec 60          	sub    $0x60,%rsp
+  800ef2:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800ef7:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800efc:	83 e0 1f             	and    $0x1f,%eax
+  800eff:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f03:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f07:	48 f7 d8             	neg    %rax
+  800f0a:	48 89 c2             	mov    %rax,%rdx
+  800f0d:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f12:	48 01 d0             	add    %rdx,%rax
+  800f15:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800f1a:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800f1e:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800f24:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f29:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f2d:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f33:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f37:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f3b:	89 c2                	mov    %eax,%edx
+  800f3d:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f41:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800f46:	89 c1                	mov    %eax,%ecx
+  800f48:	d3 e6                	shl    %cl,%esi
+  800f4a:	89 f0                	mov    %esi,%eax
+  800f4c:	21 d0                	and    %edx,%eax
+  800f4e:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f52:	eb 21                	jmp    800f75 <strlen_avx2+0x8f>
+    p += 32;
+  800f54:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800f5a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f5f:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f63:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f69:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f6d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f71:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f75:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f7a:	74 d8                	je     800f54 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f7c:	31 c0                	xor    %eax,%eax
+  800f7e:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f84:	48 63 d0             	movslq %eax,%rdx
+  800f87:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f8c:	48 01 d0             	add    %rdx,%rax
+  800f8f:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f94:	c9                   	leave
+  800f95:	c3                   	ret
+
+0000000000800f96 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f96:	55                   	push   %rbp
+  800f97:	48 89 e5             	mov    %rsp,%rbp
+  800f9a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f9e:	48 83 ec 40          	sub    $0x40,%rsp
+  800fa2:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800fa7:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800fac:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fb1:	eb 77                	jmp    80102a <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800fb3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fb8:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800fbc:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800fc0:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fc5:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800fc9:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fcd:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fd1:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800fd5:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800fda:	74 3c                	je     801018 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800fdc:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800fe0:	f7 d0                	not    %eax
+  800fe2:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800fe6:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800fea:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800fee:	48 63 d0             	movslq %eax,%rdx
+  800ff1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800ff6:	48 01 d0             	add    %rdx,%rax
+  800ff9:	0f b6 00             	movzbl (%rax),%eax
+  800ffc:	0f b6 c0             	movzbl %al,%eax
+  800fff:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801003:	48 63 ca             	movslq %edx,%rcx
+  801006:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80100b:	48 01 ca             	add    %rcx,%rdx
+  80100e:	0f b6 12             	movzbl (%rdx),%edx
+  801011:	0f b6 d2             	movzbl %dl,%edx
+  801014:	29 d0                	sub    %edx,%eax
+  801016:	eb 6b                	jmp    801083 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801018:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80101e:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801024:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80102a:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801030:	77 81                	ja     800fb3 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801032:	eb 42                	jmp    801076 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801034:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801039:	0f b6 10             	movzbl (%rax),%edx
+  80103c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801041:	0f b6 00             	movzbl (%rax),%eax
+  801044:	38 c2                	cmp    %al,%dl
+  801046:	74 1c                	je     801064 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801048:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80104d:	0f b6 00             	movzbl (%rax),%eax
+  801050:	0f b6 c8             	movzbl %al,%ecx
+  801053:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801058:	0f b6 00             	movzbl (%rax),%eax
+  80105b:	0f b6 d0             	movzbl %al,%edx
+  80105e:	89 c8                	mov    %ecx,%eax
+  801060:	29 d0                	sub    %edx,%eax
+  801062:	eb 1f                	jmp    801083 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801064:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80106a:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801070:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801076:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80107c:	75 b6                	jne    801034 <memcmp_avx2+0x9e>
+  return 0;
+  80107e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801083:	c9                   	leave
+  801084:	c3                   	ret
+
+0000000000801085 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801085:	55                   	push   %rbp
+  801086:	48 89 e5             	mov    %rsp,%rbp
+  801089:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80108d:	48 83 ec 60          	sub    $0x60,%rsp
+  801091:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801096:	89 f0                	mov    %esi,%eax
+  801098:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80109d:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8010a1:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8010a6:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8010aa:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8010af:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8010b5:	eb 47                	jmp    8010fe <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8010b7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010bc:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8010c0:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8010c4:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8010ca:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8010ce:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010d2:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8010d6:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8010db:	74 15                	je     8010f2 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8010dd:	31 c0                	xor    %eax,%eax
+  8010df:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8010e5:	48 63 d0             	movslq %eax,%rdx
+  8010e8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010ed:	48 01 d0             	add    %rdx,%rax
+  8010f0:	eb 3d                	jmp    80112f <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8010f2:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8010f8:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8010fe:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801104:	77 b1                	ja     8010b7 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801106:	eb 0c                	jmp    801114 <memfind_avx2+0x8f>
+  801108:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80110e:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801114:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80111a:	74 0e                	je     80112a <memfind_avx2+0xa5>
+  80111c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801121:	0f b6 00             	movzbl (%rax),%eax
+  801124:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801128:	75 de                	jne    801108 <memfind_avx2+0x83>
+  return s;
+  80112a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80112f:	c9                   	leave
+  801130:	c3                   	ret
+
+0000000000801131 <strlen>:
+strlen(const char *s) {
+  801131:	55                   	push   %rbp
+  801132:	48 89 e5             	mov    %rsp,%rbp
+  801135:	48 83 ec 40          	sub    $0x40,%rsp
+  801139:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80113d:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801141:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801145:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  80114c:	00 00 00 
+  80114f:	ff d0                	call   *%rax
+  801151:	83 e0 02             	and    $0x2,%eax
+  801154:	85 c0                	test   %eax,%eax
+  801156:	74 18                	je     801170 <strlen+0x3f>
+    return strlen_avx2(s);
+  801158:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80115c:	48 89 c7             	mov    %rax,%rdi
+  80115f:	48 b8 e6 0e 80 00 00 	movabs $0x800ee6,%rax
+  801166:	00 00 00 
+  801169:	ff d0                	call   *%rax
+  80116b:	e9 82 00 00 00       	jmp    8011f2 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801170:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801174:	83 e0 0f             	and    $0xf,%eax
+  801177:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80117a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80117d:	48 f7 d8             	neg    %rax
+  801180:	48 89 c2             	mov    %rax,%rdx
+  801183:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801187:	48 01 d0             	add    %rdx,%rax
+  80118a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80118e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801192:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801196:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80119b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80119f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8011a3:	89 c2                	mov    %eax,%edx
+  8011a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8011ad:	89 c1                	mov    %eax,%ecx
+  8011af:	d3 e6                	shl    %cl,%esi
+  8011b1:	89 f0                	mov    %esi,%eax
+  8011b3:	21 d0                	and    %edx,%eax
+  8011b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8011b8:	eb 1d                	jmp    8011d7 <strlen+0xa6>
+    p += 16;
+  8011ba:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8011bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011c3:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8011c7:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8011cc:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8011d0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8011d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8011d7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011db:	74 dd                	je     8011ba <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8011dd:	31 c0                	xor    %eax,%eax
+  8011df:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8011e4:	48 63 d0             	movslq %eax,%rdx
+  8011e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011eb:	48 01 d0             	add    %rdx,%rax
+  8011ee:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8011f2:	c9                   	leave
+  8011f3:	c3                   	ret
+
+00000000008011f4 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8011f4:	55                   	push   %rbp
+  8011f5:	48 89 e5             	mov    %rsp,%rbp
+  8011f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8011fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801200:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801204:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80120b:	eb 0e                	jmp    80121b <strnlen+0x27>
+    n++;
+  80120d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801211:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801216:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80121b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801220:	74 0b                	je     80122d <strnlen+0x39>
+  801222:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801226:	0f b6 00             	movzbl (%rax),%eax
+  801229:	84 c0                	test   %al,%al
+  80122b:	75 e0                	jne    80120d <strnlen+0x19>
+  return n;
+  80122d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	48 83 ec 20          	sub    $0x20,%rsp
+  80123a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80123e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801246:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80124a:	90                   	nop
+  80124b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80124f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801253:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80125b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80125f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801263:	0f b6 12             	movzbl (%rdx),%edx
+  801266:	88 10                	mov    %dl,(%rax)
+  801268:	0f b6 00             	movzbl (%rax),%eax
+  80126b:	84 c0                	test   %al,%al
+  80126d:	75 dc                	jne    80124b <strcpy+0x19>
+  return ret;
+  80126f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801273:	c9                   	leave
+  801274:	c3                   	ret
+
+0000000000801275 <strcat>:
+strcat(char *dst, const char *src) {
+  801275:	55                   	push   %rbp
+  801276:	48 89 e5             	mov    %rsp,%rbp
+  801279:	48 83 ec 20          	sub    $0x20,%rsp
+  80127d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801281:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801285:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801289:	48 89 c7             	mov    %rax,%rdi
+  80128c:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  801293:	00 00 00 
+  801296:	ff d0                	call   *%rax
+  801298:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80129b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80129e:	48 63 d0             	movslq %eax,%rdx
+  8012a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a5:	48 01 c2             	add    %rax,%rdx
+  8012a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012ac:	48 89 c6             	mov    %rax,%rsi
+  8012af:	48 89 d7             	mov    %rdx,%rdi
+  8012b2:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  8012b9:	00 00 00 
+  8012bc:	ff d0                	call   *%rax
+  return dst;
+  8012be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8012c2:	c9                   	leave
+  8012c3:	c3                   	ret
+
+00000000008012c4 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8012c4:	55                   	push   %rbp
+  8012c5:	48 89 e5             	mov    %rsp,%rbp
+  8012c8:	48 83 ec 28          	sub    $0x28,%rsp
+  8012cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012d4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8012d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8012e0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8012e7:	00 
+  8012e8:	eb 2a                	jmp    801314 <strncpy+0x50>
+    *dst++ = *src;
+  8012ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8012f2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012f6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012fa:	0f b6 12             	movzbl (%rdx),%edx
+  8012fd:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8012ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801303:	0f b6 00             	movzbl (%rax),%eax
+  801306:	84 c0                	test   %al,%al
+  801308:	74 05                	je     80130f <strncpy+0x4b>
+      src++;
+  80130a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80130f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801314:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801318:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80131c:	72 cc                	jb     8012ea <strncpy+0x26>
+  return ret;
+  80131e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+
+0000000000801324 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801324:	55                   	push   %rbp
+  801325:	48 89 e5             	mov    %rsp,%rbp
+  801328:	48 83 ec 28          	sub    $0x28,%rsp
+  80132c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801330:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801334:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801338:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80133c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801340:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801345:	74 3d                	je     801384 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801347:	eb 1d                	jmp    801366 <strlcpy+0x42>
+      *dst++ = *src++;
+  801349:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80134d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801351:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801355:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801359:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80135d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801361:	0f b6 12             	movzbl (%rdx),%edx
+  801364:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801366:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80136b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801370:	74 0b                	je     80137d <strlcpy+0x59>
+  801372:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801376:	0f b6 00             	movzbl (%rax),%eax
+  801379:	84 c0                	test   %al,%al
+  80137b:	75 cc                	jne    801349 <strlcpy+0x25>
+    *dst = '\0';
+  80137d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801381:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801388:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+
+000000000080138e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	48 83 ec 30          	sub    $0x30,%rsp
+  801396:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80139a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80139e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8013a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013a6:	48 89 c7             	mov    %rax,%rdi
+  8013a9:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  8013b0:	00 00 00 
+  8013b3:	ff d0                	call   *%rax
+  8013b5:	48 98                	cltq
+  8013b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8013bb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8013bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c3:	48 89 d6             	mov    %rdx,%rsi
+  8013c6:	48 89 c7             	mov    %rax,%rdi
+  8013c9:	48 b8 f4 11 80 00 00 	movabs $0x8011f4,%rax
+  8013d0:	00 00 00 
+  8013d3:	ff d0                	call   *%rax
+  8013d5:	48 98                	cltq
+  8013d7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8013db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013df:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013e3:	75 10                	jne    8013f5 <strlcat+0x67>
+    return maxlen + srclen;
+  8013e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8013e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013ed:	48 01 d0             	add    %rdx,%rax
+  8013f0:	e9 86 00 00 00       	jmp    80147b <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8013f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013f9:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8013fd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801401:	73 2b                	jae    80142e <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801407:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80140b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80140f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801413:	48 01 c1             	add    %rax,%rcx
+  801416:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80141a:	48 89 c6             	mov    %rax,%rsi
+  80141d:	48 89 cf             	mov    %rcx,%rdi
+  801420:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  801427:	00 00 00 
+  80142a:	ff d0                	call   *%rax
+  80142c:	eb 42                	jmp    801470 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80142e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801432:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801436:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80143a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80143e:	48 01 c1             	add    %rax,%rcx
+  801441:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801445:	48 89 c6             	mov    %rax,%rsi
+  801448:	48 89 cf             	mov    %rcx,%rdi
+  80144b:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  801452:	00 00 00 
+  801455:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801457:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80145b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80145f:	48 01 d0             	add    %rdx,%rax
+  801462:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801466:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80146a:	48 01 d0             	add    %rdx,%rax
+  80146d:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801470:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801478:	48 01 d0             	add    %rdx,%rax
+}
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+
+000000000080147d <strcmp>:
+strcmp(const char *p, const char *q) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	48 83 ec 10          	sub    $0x10,%rsp
+  801485:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801489:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80148d:	eb 0a                	jmp    801499 <strcmp+0x1c>
+    p++, q++;
+  80148f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801494:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80149d:	0f b6 00             	movzbl (%rax),%eax
+  8014a0:	84 c0                	test   %al,%al
+  8014a2:	74 12                	je     8014b6 <strcmp+0x39>
+  8014a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a8:	0f b6 10             	movzbl (%rax),%edx
+  8014ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014af:	0f b6 00             	movzbl (%rax),%eax
+  8014b2:	38 c2                	cmp    %al,%dl
+  8014b4:	74 d9                	je     80148f <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8014b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ba:	0f b6 00             	movzbl (%rax),%eax
+  8014bd:	0f b6 d0             	movzbl %al,%edx
+  8014c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c4:	0f b6 00             	movzbl (%rax),%eax
+  8014c7:	0f b6 c0             	movzbl %al,%eax
+  8014ca:	29 c2                	sub    %eax,%edx
+  8014cc:	89 d0                	mov    %edx,%eax
+}
+  8014ce:	c9                   	leave
+  8014cf:	c3                   	ret
+
+00000000008014d0 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8014d0:	55                   	push   %rbp
+  8014d1:	48 89 e5             	mov    %rsp,%rbp
+  8014d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8014d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8014e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8014e4:	eb 0f                	jmp    8014f5 <strncmp+0x25>
+    n--, p++, q++;
+  8014e6:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014eb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014f0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8014f5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014fa:	74 1d                	je     801519 <strncmp+0x49>
+  8014fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801500:	0f b6 00             	movzbl (%rax),%eax
+  801503:	84 c0                	test   %al,%al
+  801505:	74 12                	je     801519 <strncmp+0x49>
+  801507:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150b:	0f b6 10             	movzbl (%rax),%edx
+  80150e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801512:	0f b6 00             	movzbl (%rax),%eax
+  801515:	38 c2                	cmp    %al,%dl
+  801517:	74 cd                	je     8014e6 <strncmp+0x16>
+  if (n == 0)
+  801519:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80151e:	75 07                	jne    801527 <strncmp+0x57>
+    return 0;
+  801520:	ba 00 00 00 00       	mov    $0x0,%edx
+  801525:	eb 16                	jmp    80153d <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80152b:	0f b6 00             	movzbl (%rax),%eax
+  80152e:	0f b6 d0             	movzbl %al,%edx
+  801531:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801535:	0f b6 00             	movzbl (%rax),%eax
+  801538:	0f b6 c0             	movzbl %al,%eax
+  80153b:	29 c2                	sub    %eax,%edx
+}
+  80153d:	89 d0                	mov    %edx,%eax
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+
+0000000000801541 <strchr>:
+strchr(const char *s, char c) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	48 83 ec 60          	sub    $0x60,%rsp
+  801549:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80154d:	89 f0                	mov    %esi,%eax
+  80154f:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801552:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801556:	83 e0 0f             	and    $0xf,%eax
+  801559:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80155c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80155f:	48 f7 d8             	neg    %rax
+  801562:	48 89 c2             	mov    %rax,%rdx
+  801565:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801569:	48 01 d0             	add    %rdx,%rax
+  80156c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801570:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801574:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801578:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80157c:	66 0f 6e c0          	movd   %eax,%xmm0
+  801580:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801584:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801588:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80158d:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801591:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801595:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801599:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80159d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015a2:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8015a7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015ab:	89 c2                	mov    %eax,%edx
+  8015ad:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015b2:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8015b7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015bb:	09 c2                	or     %eax,%edx
+  8015bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8015c5:	89 c1                	mov    %eax,%ecx
+  8015c7:	d3 e6                	shl    %cl,%esi
+  8015c9:	89 f0                	mov    %esi,%eax
+  8015cb:	21 d0                	and    %edx,%eax
+  8015cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015d0:	eb 34                	jmp    801606 <strchr+0xc5>
+    p += 16;
+  8015d2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8015d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015db:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015df:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8015e3:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015e8:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8015ed:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015f1:	89 c2                	mov    %eax,%edx
+  8015f3:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015f8:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8015fd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801601:	09 d0                	or     %edx,%eax
+  801603:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801606:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80160a:	74 c6                	je     8015d2 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80160c:	31 c0                	xor    %eax,%eax
+  80160e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801613:	48 98                	cltq
+  801615:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801619:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161d:	0f b6 00             	movzbl (%rax),%eax
+  801620:	84 c0                	test   %al,%al
+  801622:	74 06                	je     80162a <strchr+0xe9>
+  801624:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801628:	eb 05                	jmp    80162f <strchr+0xee>
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+
+0000000000801631 <strfind>:
+strfind(const char *s, char c) {
+  801631:	55                   	push   %rbp
+  801632:	48 89 e5             	mov    %rsp,%rbp
+  801635:	48 83 ec 10          	sub    $0x10,%rsp
+  801639:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80163d:	89 f0                	mov    %esi,%eax
+  80163f:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801642:	eb 11                	jmp    801655 <strfind+0x24>
+    if (*s == c)
+  801644:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801648:	0f b6 00             	movzbl (%rax),%eax
+  80164b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80164e:	74 12                	je     801662 <strfind+0x31>
+  for (; *s; s++)
+  801650:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801659:	0f b6 00             	movzbl (%rax),%eax
+  80165c:	84 c0                	test   %al,%al
+  80165e:	75 e4                	jne    801644 <strfind+0x13>
+  801660:	eb 01                	jmp    801663 <strfind+0x32>
+      break;
+  801662:	90                   	nop
+  return (char *)s;
+  801663:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801667:	c9                   	leave
+  801668:	c3                   	ret
+
+0000000000801669 <memset>:
+memset(void *v, int c, size_t n) {
+  801669:	55                   	push   %rbp
+  80166a:	48 89 e5             	mov    %rsp,%rbp
+  80166d:	48 83 ec 38          	sub    $0x38,%rsp
+  801671:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801675:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801678:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80167c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801680:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801684:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801689:	76 41                	jbe    8016cc <memset+0x63>
+  80168b:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  801692:	00 00 00 
+  801695:	ff d0                	call   *%rax
+  801697:	83 e0 01             	and    $0x1,%eax
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	74 2e                	je     8016cc <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80169e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016a1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016a5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8016a9:	48 89 ce             	mov    %rcx,%rsi
+  8016ac:	48 89 f7             	mov    %rsi,%rdi
+  8016af:	48 89 d1             	mov    %rdx,%rcx
+  8016b2:	fc                   	cld
+  8016b3:	f3 aa                	rep stos %al,%es:(%rdi)
+  8016b5:	48 89 ca             	mov    %rcx,%rdx
+  8016b8:	48 89 fe             	mov    %rdi,%rsi
+  8016bb:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8016c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c7:	e9 a7 00 00 00       	jmp    801773 <memset+0x10a>
+  if (n >= 8) {
+  8016cc:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8016d1:	0f 86 87 00 00 00    	jbe    80175e <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8016d7:	eb 16                	jmp    8016ef <memset+0x86>
+      *p++ = c;
+  8016d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016e1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016e5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016e8:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8016ea:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8016ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f3:	83 e0 07             	and    $0x7,%eax
+  8016f6:	48 85 c0             	test   %rax,%rax
+  8016f9:	75 de                	jne    8016d9 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8016fb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016fe:	0f b6 c0             	movzbl %al,%eax
+  801701:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801708:	01 01 01 
+  80170b:	48 0f af c2          	imul   %rdx,%rax
+  80170f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801713:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801717:	48 c1 e8 03          	shr    $0x3,%rax
+  80171b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80171f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801723:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801727:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80172b:	48 89 ce             	mov    %rcx,%rsi
+  80172e:	48 89 f7             	mov    %rsi,%rdi
+  801731:	48 89 d1             	mov    %rdx,%rcx
+  801734:	fc                   	cld
+  801735:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801738:	48 89 ca             	mov    %rcx,%rdx
+  80173b:	48 89 fe             	mov    %rdi,%rsi
+  80173e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801742:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801746:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  80174b:	eb 11                	jmp    80175e <memset+0xf5>
+    *p++ = c;
+  80174d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801751:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801755:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801759:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80175c:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80175e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801762:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801766:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80176a:	48 85 c0             	test   %rax,%rax
+  80176d:	75 de                	jne    80174d <memset+0xe4>
+  return v;
+  80176f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+
+0000000000801775 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801775:	55                   	push   %rbp
+  801776:	48 89 e5             	mov    %rsp,%rbp
+  801779:	48 83 ec 38          	sub    $0x38,%rsp
+  80177d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801781:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801785:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801789:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80178d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801791:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801795:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017a1:	0f 83 da 00 00 00    	jae    801881 <memmove+0x10c>
+  8017a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017af:	48 01 d0             	add    %rdx,%rax
+  8017b2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017b6:	0f 83 c5 00 00 00    	jae    801881 <memmove+0x10c>
+    s += n;
+  8017bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017c0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8017c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017c8:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8017cc:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8017d1:	0f 86 94 00 00 00    	jbe    80186b <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8017d7:	eb 1c                	jmp    8017f5 <memmove+0x80>
+        *--d = *--s;
+  8017d9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017de:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e7:	0f b6 10             	movzbl (%rax),%edx
+  8017ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ee:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8017f0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8017f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f9:	83 e0 07             	and    $0x7,%eax
+  8017fc:	48 85 c0             	test   %rax,%rax
+  8017ff:	75 d8                	jne    8017d9 <memmove+0x64>
+      nq = n / 8;
+  801801:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801805:	48 c1 e8 03          	shr    $0x3,%rax
+  801809:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80180d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801812:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801817:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80181c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801820:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801828:	48 89 cf             	mov    %rcx,%rdi
+  80182b:	48 89 d6             	mov    %rdx,%rsi
+  80182e:	48 89 c1             	mov    %rax,%rcx
+  801831:	fd                   	std
+  801832:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801835:	fc                   	cld
+  801836:	48 89 c8             	mov    %rcx,%rax
+  801839:	48 89 f2             	mov    %rsi,%rdx
+  80183c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801840:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801844:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801848:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80184d:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801852:	eb 17                	jmp    80186b <memmove+0xf6>
+      *--d = *--s;
+  801854:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801859:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80185e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801862:	0f b6 10             	movzbl (%rax),%edx
+  801865:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801869:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80186b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80186f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801873:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801877:	48 85 c0             	test   %rax,%rax
+  80187a:	75 d8                	jne    801854 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80187c:	e9 f4 00 00 00       	jmp    801975 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801881:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801886:	76 46                	jbe    8018ce <memmove+0x159>
+  801888:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  80188f:	00 00 00 
+  801892:	ff d0                	call   *%rax
+  801894:	83 e0 01             	and    $0x1,%eax
+  801897:	85 c0                	test   %eax,%eax
+  801899:	74 33                	je     8018ce <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80189b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80189f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a7:	48 89 cf             	mov    %rcx,%rdi
+  8018aa:	48 89 d6             	mov    %rdx,%rsi
+  8018ad:	48 89 c1             	mov    %rax,%rcx
+  8018b0:	fc                   	cld
+  8018b1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8018b3:	48 89 c8             	mov    %rcx,%rax
+  8018b6:	48 89 f2             	mov    %rsi,%rdx
+  8018b9:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018bd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8018c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c9:	e9 ab 00 00 00       	jmp    801979 <memmove+0x204>
+    if (n >= 8) {
+  8018ce:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8018d3:	0f 86 8b 00 00 00    	jbe    801964 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8018d9:	eb 22                	jmp    8018fd <memmove+0x188>
+        *d++ = *s++;
+  8018db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018df:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018e3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018eb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018ef:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8018f3:	0f b6 12             	movzbl (%rdx),%edx
+  8018f6:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8018f8:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801901:	83 e0 07             	and    $0x7,%eax
+  801904:	48 85 c0             	test   %rax,%rax
+  801907:	75 d2                	jne    8018db <memmove+0x166>
+      nq = n / 8;
+  801909:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190d:	48 c1 e8 03          	shr    $0x3,%rax
+  801911:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801915:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801919:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80191d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801921:	48 89 cf             	mov    %rcx,%rdi
+  801924:	48 89 d6             	mov    %rdx,%rsi
+  801927:	48 89 c1             	mov    %rax,%rcx
+  80192a:	fc                   	cld
+  80192b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80192e:	48 89 c8             	mov    %rcx,%rax
+  801931:	48 89 f2             	mov    %rsi,%rdx
+  801934:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801938:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80193c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801940:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801945:	eb 1d                	jmp    801964 <memmove+0x1ef>
+      *d++ = *s++;
+  801947:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80194b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80194f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801953:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801957:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80195b:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80195f:	0f b6 12             	movzbl (%rdx),%edx
+  801962:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801964:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801968:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80196c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801970:	48 85 c0             	test   %rax,%rax
+  801973:	75 d2                	jne    801947 <memmove+0x1d2>
+  return dst;
+  801975:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801979:	c9                   	leave
+  80197a:	c3                   	ret
+
+000000000080197b <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80197b:	55                   	push   %rbp
+  80197c:	48 89 e5             	mov    %rsp,%rbp
+  80197f:	48 83 ec 18          	sub    $0x18,%rsp
+  801983:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801987:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80198b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80198f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801993:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199b:	48 89 ce             	mov    %rcx,%rsi
+  80199e:	48 89 c7             	mov    %rax,%rdi
+  8019a1:	48 b8 75 17 80 00 00 	movabs $0x801775,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+}
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+
+00000000008019af <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  8019af:	55                   	push   %rbp
+  8019b0:	48 89 e5             	mov    %rsp,%rbp
+  8019b3:	48 83 ec 40          	sub    $0x40,%rsp
+  8019b7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019bb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8019bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8019c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8019cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8019d3:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8019d8:	0f 86 a7 00 00 00    	jbe    801a85 <memcmp+0xd6>
+  8019de:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+  8019ea:	83 e0 02             	and    $0x2,%eax
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	0f 84 90 00 00 00    	je     801a85 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8019f5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8019f9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a01:	48 89 ce             	mov    %rcx,%rsi
+  801a04:	48 89 c7             	mov    %rax,%rdi
+  801a07:	48 b8 96 0f 80 00 00 	movabs $0x800f96,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+  801a13:	e9 c2 00 00 00       	jmp    801ada <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801a18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a1c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a20:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801a24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a28:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a2c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801a30:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a34:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801a37:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801a3e:	74 36                	je     801a76 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801a40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a43:	f7 d0                	not    %eax
+  801a45:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801a49:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801a4c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801a4f:	48 63 d0             	movslq %eax,%rdx
+  801a52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a56:	48 01 d0             	add    %rdx,%rax
+  801a59:	0f b6 00             	movzbl (%rax),%eax
+  801a5c:	0f b6 c0             	movzbl %al,%eax
+  801a5f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801a62:	48 63 ca             	movslq %edx,%rcx
+  801a65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a69:	48 01 ca             	add    %rcx,%rdx
+  801a6c:	0f b6 12             	movzbl (%rdx),%edx
+  801a6f:	0f b6 d2             	movzbl %dl,%edx
+  801a72:	29 d0                	sub    %edx,%eax
+  801a74:	eb 64                	jmp    801ada <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a76:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a7b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a80:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a85:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a8a:	77 8c                	ja     801a18 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a8c:	eb 36                	jmp    801ac4 <memcmp+0x115>
+    if (*s1 != *s2)
+  801a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a92:	0f b6 10             	movzbl (%rax),%edx
+  801a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a99:	0f b6 00             	movzbl (%rax),%eax
+  801a9c:	38 c2                	cmp    %al,%dl
+  801a9e:	74 1a                	je     801aba <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa4:	0f b6 00             	movzbl (%rax),%eax
+  801aa7:	0f b6 c8             	movzbl %al,%ecx
+  801aaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aae:	0f b6 00             	movzbl (%rax),%eax
+  801ab1:	0f b6 d0             	movzbl %al,%edx
+  801ab4:	89 c8                	mov    %ecx,%eax
+  801ab6:	29 d0                	sub    %edx,%eax
+  801ab8:	eb 20                	jmp    801ada <memcmp+0x12b>
+    s1++, s2++;
+  801aba:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801abf:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801ac4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ac8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801acc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ad0:	48 85 c0             	test   %rax,%rax
+  801ad3:	75 b9                	jne    801a8e <memcmp+0xdf>
+  }
+
+  return 0;
+  801ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ada:	c9                   	leave
+  801adb:	c3                   	ret
+
+0000000000801adc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801adc:	55                   	push   %rbp
+  801add:	48 89 e5             	mov    %rsp,%rbp
+  801ae0:	48 83 ec 50          	sub    $0x50,%rsp
+  801ae4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ae8:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801aeb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801aef:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801af3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801af7:	48 01 d0             	add    %rdx,%rax
+  801afa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801afe:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b01:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b05:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b09:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b0d:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b12:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b16:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801b1b:	76 73                	jbe    801b90 <memfind+0xb4>
+  801b1d:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+  801b29:	83 e0 02             	and    $0x2,%eax
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	74 60                	je     801b90 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801b30:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b33:	0f b6 c8             	movzbl %al,%ecx
+  801b36:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b3e:	89 ce                	mov    %ecx,%esi
+  801b40:	48 89 c7             	mov    %rax,%rdi
+  801b43:	48 b8 85 10 80 00 00 	movabs $0x801085,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+  801b4f:	eb 6c                	jmp    801bbd <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801b51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b55:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b59:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801b5d:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801b62:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b66:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b6a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b6d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b71:	74 13                	je     801b86 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b73:	31 c0                	xor    %eax,%eax
+  801b75:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b7a:	48 63 d0             	movslq %eax,%rdx
+  801b7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b81:	48 01 d0             	add    %rdx,%rax
+  801b84:	eb 37                	jmp    801bbd <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b86:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b8b:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b90:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b95:	77 ba                	ja     801b51 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b97:	eb 13                	jmp    801bac <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b9d:	0f b6 00             	movzbl (%rax),%eax
+  801ba0:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801ba3:	38 d0                	cmp    %dl,%al
+  801ba5:	74 11                	je     801bb8 <memfind+0xdc>
+  for (; s < ends; s++)
+  801ba7:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801bac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb0:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801bb4:	72 e3                	jb     801b99 <memfind+0xbd>
+  801bb6:	eb 01                	jmp    801bb9 <memfind+0xdd>
+      break;
+  801bb8:	90                   	nop
+  return (void *)s;
+  801bb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+0000000000801bbf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801bbf:	55                   	push   %rbp
+  801bc0:	48 89 e5             	mov    %rsp,%rbp
+  801bc3:	48 83 ec 38          	sub    $0x38,%rsp
+  801bc7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bcb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bcf:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801bd2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801bd9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801be0:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801be1:	eb 05                	jmp    801be8 <strtol+0x29>
+    s++;
+  801be3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801be8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bec:	0f b6 00             	movzbl (%rax),%eax
+  801bef:	3c 20                	cmp    $0x20,%al
+  801bf1:	74 f0                	je     801be3 <strtol+0x24>
+  801bf3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf7:	0f b6 00             	movzbl (%rax),%eax
+  801bfa:	3c 09                	cmp    $0x9,%al
+  801bfc:	74 e5                	je     801be3 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c02:	0f b6 00             	movzbl (%rax),%eax
+  801c05:	3c 2b                	cmp    $0x2b,%al
+  801c07:	75 07                	jne    801c10 <strtol+0x51>
+    s++;
+  801c09:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c0e:	eb 17                	jmp    801c27 <strtol+0x68>
+  else if (*s == '-')
+  801c10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c14:	0f b6 00             	movzbl (%rax),%eax
+  801c17:	3c 2d                	cmp    $0x2d,%al
+  801c19:	75 0c                	jne    801c27 <strtol+0x68>
+    s++, neg = 1;
+  801c1b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c20:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c27:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c2b:	74 06                	je     801c33 <strtol+0x74>
+  801c2d:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c31:	75 28                	jne    801c5b <strtol+0x9c>
+  801c33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c37:	0f b6 00             	movzbl (%rax),%eax
+  801c3a:	3c 30                	cmp    $0x30,%al
+  801c3c:	75 1d                	jne    801c5b <strtol+0x9c>
+  801c3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c42:	48 83 c0 01          	add    $0x1,%rax
+  801c46:	0f b6 00             	movzbl (%rax),%eax
+  801c49:	3c 78                	cmp    $0x78,%al
+  801c4b:	75 0e                	jne    801c5b <strtol+0x9c>
+    s += 2, base = 16;
+  801c4d:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c52:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c59:	eb 2c                	jmp    801c87 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801c5b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c5f:	75 19                	jne    801c7a <strtol+0xbb>
+  801c61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c65:	0f b6 00             	movzbl (%rax),%eax
+  801c68:	3c 30                	cmp    $0x30,%al
+  801c6a:	75 0e                	jne    801c7a <strtol+0xbb>
+    s++, base = 8;
+  801c6c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c71:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c78:	eb 0d                	jmp    801c87 <strtol+0xc8>
+  else if (base == 0)
+  801c7a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c7e:	75 07                	jne    801c87 <strtol+0xc8>
+    base = 10;
+  801c80:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8b:	0f b6 00             	movzbl (%rax),%eax
+  801c8e:	3c 2f                	cmp    $0x2f,%al
+  801c90:	7e 1d                	jle    801caf <strtol+0xf0>
+  801c92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c96:	0f b6 00             	movzbl (%rax),%eax
+  801c99:	3c 39                	cmp    $0x39,%al
+  801c9b:	7f 12                	jg     801caf <strtol+0xf0>
+      dig = *s - '0';
+  801c9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca1:	0f b6 00             	movzbl (%rax),%eax
+  801ca4:	0f be c0             	movsbl %al,%eax
+  801ca7:	83 e8 30             	sub    $0x30,%eax
+  801caa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cad:	eb 4e                	jmp    801cfd <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801caf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb3:	0f b6 00             	movzbl (%rax),%eax
+  801cb6:	3c 60                	cmp    $0x60,%al
+  801cb8:	7e 1d                	jle    801cd7 <strtol+0x118>
+  801cba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cbe:	0f b6 00             	movzbl (%rax),%eax
+  801cc1:	3c 7a                	cmp    $0x7a,%al
+  801cc3:	7f 12                	jg     801cd7 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc9:	0f b6 00             	movzbl (%rax),%eax
+  801ccc:	0f be c0             	movsbl %al,%eax
+  801ccf:	83 e8 57             	sub    $0x57,%eax
+  801cd2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cd5:	eb 26                	jmp    801cfd <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801cd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cdb:	0f b6 00             	movzbl (%rax),%eax
+  801cde:	3c 40                	cmp    $0x40,%al
+  801ce0:	7e 47                	jle    801d29 <strtol+0x16a>
+  801ce2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce6:	0f b6 00             	movzbl (%rax),%eax
+  801ce9:	3c 5a                	cmp    $0x5a,%al
+  801ceb:	7f 3c                	jg     801d29 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801ced:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf1:	0f b6 00             	movzbl (%rax),%eax
+  801cf4:	0f be c0             	movsbl %al,%eax
+  801cf7:	83 e8 37             	sub    $0x37,%eax
+  801cfa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801cfd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d00:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d03:	7d 23                	jge    801d28 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d05:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d0a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d0d:	48 98                	cltq
+  801d0f:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d14:	48 89 c2             	mov    %rax,%rdx
+  801d17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d1a:	48 98                	cltq
+  801d1c:	48 01 d0             	add    %rdx,%rax
+  801d1f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801d23:	e9 5f ff ff ff       	jmp    801c87 <strtol+0xc8>
+      break;
+  801d28:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801d29:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d2e:	74 0b                	je     801d3b <strtol+0x17c>
+    *endptr = (char *)s;
+  801d30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d34:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d38:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801d3b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d3f:	74 09                	je     801d4a <strtol+0x18b>
+  801d41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d45:	48 f7 d8             	neg    %rax
+  801d48:	eb 04                	jmp    801d4e <strtol+0x18f>
+  801d4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d4e:	c9                   	leave
+  801d4f:	c3                   	ret
+
+0000000000801d50 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801d50:	55                   	push   %rbp
+  801d51:	48 89 e5             	mov    %rsp,%rbp
+  801d54:	53                   	push   %rbx
+  801d55:	48 83 ec 48          	sub    $0x48,%rsp
+  801d59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d5d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d61:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d65:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d69:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d6d:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d75:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d79:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d7d:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d81:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d85:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d89:	4c 89 c3             	mov    %r8,%rbx
+  801d8c:	cd 30                	int    $0x30
+  801d8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d92:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d97:	74 46                	je     801ddf <syscall+0x8f>
+  801d99:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d9e:	7e 3f                	jle    801ddf <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801da0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801da4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da8:	49 89 d0             	mov    %rdx,%r8
+  801dab:	48 89 c1             	mov    %rax,%rcx
+  801dae:	48 b8 e8 56 80 00 00 	movabs $0x8056e8,%rax
+  801db5:	00 00 00 
+  801db8:	48 89 c2             	mov    %rax,%rdx
+  801dbb:	be 22 00 00 00       	mov    $0x22,%esi
+  801dc0:	48 b8 07 57 80 00 00 	movabs $0x805707,%rax
+  801dc7:	00 00 00 
+  801dca:	48 89 c7             	mov    %rax,%rdi
+  801dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd2:	49 b9 f6 4c 80 00 00 	movabs $0x804cf6,%r9
+  801dd9:	00 00 00 
+  801ddc:	41 ff d1             	call   *%r9
+
+  return ret;
+  801ddf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801de3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801de7:	c9                   	leave
+  801de8:	c3                   	ret
+
+0000000000801de9 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801de9:	55                   	push   %rbp
+  801dea:	48 89 e5             	mov    %rsp,%rbp
+  801ded:	48 83 ec 10          	sub    $0x10,%rsp
+  801df1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801df5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801df9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e01:	48 83 ec 08          	sub    $0x8,%rsp
+  801e05:	6a 00                	push   $0x0
+  801e07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e0d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e13:	48 89 d1             	mov    %rdx,%rcx
+  801e16:	48 89 c2             	mov    %rax,%rdx
+  801e19:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e23:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801e2a:	00 00 00 
+  801e2d:	ff d0                	call   *%rax
+  801e2f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e33:	90                   	nop
+  801e34:	c9                   	leave
+  801e35:	c3                   	ret
+
+0000000000801e36 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e3a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e3e:	6a 00                	push   $0x0
+  801e40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e56:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e60:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+  801e6c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+0000000000801e72 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	48 83 ec 10          	sub    $0x10,%rsp
+  801e7a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e80:	48 98                	cltq
+  801e82:	48 83 ec 08          	sub    $0x8,%rsp
+  801e86:	6a 00                	push   $0x0
+  801e88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e8e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e99:	48 89 c2             	mov    %rax,%rdx
+  801e9c:	be 01 00 00 00       	mov    $0x1,%esi
+  801ea1:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ea6:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+  801eb2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eb6:	c9                   	leave
+  801eb7:	c3                   	ret
+
+0000000000801eb8 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801eb8:	55                   	push   %rbp
+  801eb9:	48 89 e5             	mov    %rsp,%rbp
+  801ebc:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801ec3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ec6:	48 98                	cltq
+  801ec8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecc:	6a 00                	push   $0x0
+  801ece:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ed4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801edf:	48 89 c2             	mov    %rax,%rdx
+  801ee2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee7:	bf 04 00 00 00       	mov    $0x4,%edi
+  801eec:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+  801ef8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801efc:	90                   	nop
+  801efd:	c9                   	leave
+  801efe:	c3                   	ret
+
+0000000000801eff <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801eff:	55                   	push   %rbp
+  801f00:	48 89 e5             	mov    %rsp,%rbp
+  801f03:	48 83 ec 20          	sub    $0x20,%rsp
+  801f07:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f11:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801f14:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f19:	cd 30                	int    $0x30
+  801f1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f1f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801f23:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f28:	7e 3d                	jle    801f67 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f2e:	49 89 c0             	mov    %rax,%r8
+  801f31:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f36:	48 b8 e8 56 80 00 00 	movabs $0x8056e8,%rax
+  801f3d:	00 00 00 
+  801f40:	48 89 c2             	mov    %rax,%rdx
+  801f43:	be 49 00 00 00       	mov    $0x49,%esi
+  801f48:	48 b8 07 57 80 00 00 	movabs $0x805707,%rax
+  801f4f:	00 00 00 
+  801f52:	48 89 c7             	mov    %rax,%rdi
+  801f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5a:	49 b9 f6 4c 80 00 00 	movabs $0x804cf6,%r9
+  801f61:	00 00 00 
+  801f64:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f67:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f6c:	75 13                	jne    801f81 <sys_env_wait+0x82>
+  801f6e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f73:	74 0c                	je     801f81 <sys_env_wait+0x82>
+    *status = st;
+  801f75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f79:	89 c2                	mov    %eax,%edx
+  801f7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f7f:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+
+0000000000801f87 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f87:	55                   	push   %rbp
+  801f88:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f8b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8f:	6a 00                	push   $0x0
+  801f91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fac:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fb1:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+  801fbd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fc1:	c9                   	leave
+  801fc2:	c3                   	ret
+
+0000000000801fc3 <sys_yield>:
+
+void
+sys_yield(void) {
+  801fc3:	55                   	push   %rbp
+  801fc4:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801fc7:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcb:	6a 00                	push   $0x0
+  801fcd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801fed:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ffd:	90                   	nop
+  801ffe:	c9                   	leave
+  801fff:	c3                   	ret
+
+0000000000802000 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802000:	55                   	push   %rbp
+  802001:	48 89 e5             	mov    %rsp,%rbp
+  802004:	48 83 ec 20          	sub    $0x20,%rsp
+  802008:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80200b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80200f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802012:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802015:	48 63 c8             	movslq %eax,%rcx
+  802018:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80201c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80201f:	48 98                	cltq
+  802021:	48 83 ec 08          	sub    $0x8,%rsp
+  802025:	6a 00                	push   $0x0
+  802027:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80202d:	49 89 c8             	mov    %rcx,%r8
+  802030:	48 89 d1             	mov    %rdx,%rcx
+  802033:	48 89 c2             	mov    %rax,%rdx
+  802036:	be 01 00 00 00       	mov    $0x1,%esi
+  80203b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802040:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	48 83 c4 10          	add    $0x10,%rsp
+  802050:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802053:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802056:	c9                   	leave
+  802057:	c3                   	ret
+
+0000000000802058 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	48 83 ec 20          	sub    $0x20,%rsp
+  802060:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802063:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802067:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80206a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80206e:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802072:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802075:	48 63 c8             	movslq %eax,%rcx
+  802078:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80207c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80207f:	48 63 f0             	movslq %eax,%rsi
+  802082:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802086:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802089:	48 98                	cltq
+  80208b:	48 83 ec 08          	sub    $0x8,%rsp
+  80208f:	51                   	push   %rcx
+  802090:	49 89 f9             	mov    %rdi,%r9
+  802093:	49 89 f0             	mov    %rsi,%r8
+  802096:	48 89 d1             	mov    %rdx,%rcx
+  802099:	48 89 c2             	mov    %rax,%rdx
+  80209c:	be 01 00 00 00       	mov    $0x1,%esi
+  8020a1:	bf 07 00 00 00       	mov    $0x7,%edi
+  8020a6:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b6:	c9                   	leave
+  8020b7:	c3                   	ret
+
+00000000008020b8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8020b8:	55                   	push   %rbp
+  8020b9:	48 89 e5             	mov    %rsp,%rbp
+  8020bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8020c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8020c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020ce:	48 98                	cltq
+  8020d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d4:	6a 00                	push   $0x0
+  8020d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020e2:	48 89 d1             	mov    %rdx,%rcx
+  8020e5:	48 89 c2             	mov    %rax,%rdx
+  8020e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ed:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020f2:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8020f9:	00 00 00 
+  8020fc:	ff d0                	call   *%rax
+  8020fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+0000000000802104 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802104:	55                   	push   %rbp
+  802105:	48 89 e5             	mov    %rsp,%rbp
+  802108:	48 83 ec 10          	sub    $0x10,%rsp
+  80210c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80210f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802112:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802115:	48 63 d0             	movslq %eax,%rdx
+  802118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80211b:	48 98                	cltq
+  80211d:	48 83 ec 08          	sub    $0x8,%rsp
+  802121:	6a 00                	push   $0x0
+  802123:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802129:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80212f:	48 89 d1             	mov    %rdx,%rcx
+  802132:	48 89 c2             	mov    %rax,%rdx
+  802135:	be 01 00 00 00       	mov    $0x1,%esi
+  80213a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80213f:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+  80214b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+0000000000802151 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802151:	55                   	push   %rbp
+  802152:	48 89 e5             	mov    %rsp,%rbp
+  802155:	48 83 ec 10          	sub    $0x10,%rsp
+  802159:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80215c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802160:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802164:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802167:	48 98                	cltq
+  802169:	48 83 ec 08          	sub    $0x8,%rsp
+  80216d:	6a 00                	push   $0x0
+  80216f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217b:	48 89 d1             	mov    %rdx,%rcx
+  80217e:	48 89 c2             	mov    %rax,%rdx
+  802181:	be 01 00 00 00       	mov    $0x1,%esi
+  802186:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80218b:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802192:	00 00 00 
+  802195:	ff d0                	call   *%rax
+  802197:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+000000000080219d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8021ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021b3:	48 98                	cltq
+  8021b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b9:	6a 00                	push   $0x0
+  8021bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c7:	48 89 d1             	mov    %rdx,%rcx
+  8021ca:	48 89 c2             	mov    %rax,%rdx
+  8021cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d2:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021d7:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e7:	c9                   	leave
+  8021e8:	c3                   	ret
+
+00000000008021e9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8021e9:	55                   	push   %rbp
+  8021ea:	48 89 e5             	mov    %rsp,%rbp
+  8021ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8021f1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021fc:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8021ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802202:	48 63 f0             	movslq %eax,%rsi
+  802205:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802209:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80220d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802210:	48 98                	cltq
+  802212:	48 83 ec 08          	sub    $0x8,%rsp
+  802216:	6a 00                	push   $0x0
+  802218:	49 89 f1             	mov    %rsi,%r9
+  80221b:	49 89 c8             	mov    %rcx,%r8
+  80221e:	48 89 d1             	mov    %rdx,%rcx
+  802221:	48 89 c2             	mov    %rax,%rdx
+  802224:	be 00 00 00 00       	mov    $0x0,%esi
+  802229:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80222e:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+  80223a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+
+0000000000802240 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	48 83 ec 10          	sub    $0x10,%rsp
+  802248:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802250:	48 83 ec 08          	sub    $0x8,%rsp
+  802254:	6a 00                	push   $0x0
+  802256:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80225c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802262:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802267:	48 89 c2             	mov    %rax,%rdx
+  80226a:	be 01 00 00 00       	mov    $0x1,%esi
+  80226f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802274:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  80227b:	00 00 00 
+  80227e:	ff d0                	call   *%rax
+  802280:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+0000000000802286 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  80228a:	48 83 ec 10          	sub    $0x10,%rsp
+  80228e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802292:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802296:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80229a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80229e:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a2:	6a 00                	push   $0x0
+  8022a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022b0:	48 89 d1             	mov    %rdx,%rcx
+  8022b3:	48 89 c2             	mov    %rax,%rdx
+  8022b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8022bb:	bf 10 00 00 00       	mov    $0x10,%edi
+  8022c0:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8022c7:	00 00 00 
+  8022ca:	ff d0                	call   *%rax
+  8022cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022d0:	c9                   	leave
+  8022d1:	c3                   	ret
+
+00000000008022d2 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8022d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022da:	6a 00                	push   $0x0
+  8022dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f7:	bf 11 00 00 00       	mov    $0x11,%edi
+  8022fc:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+
+000000000080230e <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80230e:	55                   	push   %rbp
+  80230f:	48 89 e5             	mov    %rsp,%rbp
+  802312:	48 83 ec 10          	sub    $0x10,%rsp
+  802316:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80231a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80231e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802326:	48 83 ec 08          	sub    $0x8,%rsp
+  80232a:	6a 00                	push   $0x0
+  80232c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802332:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802338:	48 89 d1             	mov    %rdx,%rcx
+  80233b:	48 89 c2             	mov    %rax,%rdx
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	bf 12 00 00 00       	mov    $0x12,%edi
+  802348:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802358:	c9                   	leave
+  802359:	c3                   	ret
+
+000000000080235a <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80235a:	55                   	push   %rbp
+  80235b:	48 89 e5             	mov    %rsp,%rbp
+  80235e:	48 83 ec 20          	sub    $0x20,%rsp
+  802362:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802366:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80236a:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80236d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802370:	48 63 c8             	movslq %eax,%rcx
+  802373:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80237b:	48 83 ec 08          	sub    $0x8,%rsp
+  80237f:	6a 00                	push   $0x0
+  802381:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802387:	49 89 c8             	mov    %rcx,%r8
+  80238a:	48 89 d1             	mov    %rdx,%rcx
+  80238d:	48 89 c2             	mov    %rax,%rdx
+  802390:	be 00 00 00 00       	mov    $0x0,%esi
+  802395:	bf 13 00 00 00       	mov    $0x13,%edi
+  80239a:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023aa:	c9                   	leave
+  8023ab:	c3                   	ret
+
+00000000008023ac <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8023ac:	55                   	push   %rbp
+  8023ad:	48 89 e5             	mov    %rsp,%rbp
+  8023b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8023b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023b8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8023bf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023c3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8023c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ce:	6a 00                	push   $0x0
+  8023d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023d6:	49 89 c8             	mov    %rcx,%r8
+  8023d9:	48 89 d1             	mov    %rdx,%rcx
+  8023dc:	48 89 c2             	mov    %rax,%rdx
+  8023df:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e4:	bf 14 00 00 00       	mov    $0x14,%edi
+  8023e9:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8023f0:	00 00 00 
+  8023f3:	ff d0                	call   *%rax
+  8023f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+00000000008023fb <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	48 83 ec 10          	sub    $0x10,%rsp
+  802403:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802407:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  80240a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80240d:	48 63 d0             	movslq %eax,%rdx
+  802410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802414:	48 83 ec 08          	sub    $0x8,%rsp
+  802418:	6a 00                	push   $0x0
+  80241a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802426:	48 89 d1             	mov    %rdx,%rcx
+  802429:	48 89 c2             	mov    %rax,%rdx
+  80242c:	be 00 00 00 00       	mov    $0x0,%esi
+  802431:	bf 15 00 00 00       	mov    $0x15,%edi
+  802436:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+
+0000000000802448 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802448:	55                   	push   %rbp
+  802449:	48 89 e5             	mov    %rsp,%rbp
+  80244c:	48 83 ec 20          	sub    $0x20,%rsp
+  802450:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802454:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802457:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80245a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80245e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802462:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802465:	48 63 c8             	movslq %eax,%rcx
+  802468:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80246b:	48 63 d0             	movslq %eax,%rdx
+  80246e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802472:	48 83 ec 08          	sub    $0x8,%rsp
+  802476:	6a 00                	push   $0x0
+  802478:	49 89 f1             	mov    %rsi,%r9
+  80247b:	49 89 c8             	mov    %rcx,%r8
+  80247e:	48 89 d1             	mov    %rdx,%rcx
+  802481:	48 89 c2             	mov    %rax,%rdx
+  802484:	be 00 00 00 00       	mov    $0x0,%esi
+  802489:	bf 16 00 00 00       	mov    $0x16,%edi
+  80248e:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+  80249a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249e:	c9                   	leave
+  80249f:	c3                   	ret
+
+00000000008024a0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+  8024a4:	48 83 ec 30          	sub    $0x30,%rsp
+  8024a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024b0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024b4:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8024b8:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8024bc:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8024c0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8024c4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d4:	51                   	push   %rcx
+  8024d5:	49 89 f9             	mov    %rdi,%r9
+  8024d8:	49 89 f0             	mov    %rsi,%r8
+  8024db:	48 89 d1             	mov    %rdx,%rcx
+  8024de:	48 89 c2             	mov    %rax,%rdx
+  8024e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e6:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024eb:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+
+00000000008024fd <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8024fd:	55                   	push   %rbp
+  8024fe:	48 89 e5             	mov    %rsp,%rbp
+  802501:	48 83 ec 10          	sub    $0x10,%rsp
+  802505:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802508:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80250b:	48 98                	cltq
+  80250d:	48 83 ec 08          	sub    $0x8,%rsp
+  802511:	6a 00                	push   $0x0
+  802513:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802519:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80251f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802524:	48 89 c2             	mov    %rax,%rdx
+  802527:	be 00 00 00 00       	mov    $0x0,%esi
+  80252c:	bf 18 00 00 00       	mov    $0x18,%edi
+  802531:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+  80253d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802541:	90                   	nop
+  802542:	c9                   	leave
+  802543:	c3                   	ret
+
+0000000000802544 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802544:	55                   	push   %rbp
+  802545:	48 89 e5             	mov    %rsp,%rbp
+  802548:	48 83 ec 30          	sub    $0x30,%rsp
+  80254c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80254f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802553:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802557:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80255a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80255d:	48 63 f0             	movslq %eax,%rsi
+  802560:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802564:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802568:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80256b:	48 98                	cltq
+  80256d:	48 83 ec 08          	sub    $0x8,%rsp
+  802571:	6a 00                	push   $0x0
+  802573:	49 89 f1             	mov    %rsi,%r9
+  802576:	49 89 c8             	mov    %rcx,%r8
+  802579:	48 89 d1             	mov    %rdx,%rcx
+  80257c:	48 89 c2             	mov    %rax,%rdx
+  80257f:	be 01 00 00 00       	mov    $0x1,%esi
+  802584:	bf 19 00 00 00       	mov    $0x19,%edi
+  802589:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802590:	00 00 00 
+  802593:	ff d0                	call   *%rax
+  802595:	48 83 c4 10          	add    $0x10,%rsp
+  802599:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80259c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80259f:	c9                   	leave
+  8025a0:	c3                   	ret
+
+00000000008025a1 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8025a1:	55                   	push   %rbp
+  8025a2:	48 89 e5             	mov    %rsp,%rbp
+  8025a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8025a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025b1:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8025b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025b7:	48 63 c8             	movslq %eax,%rcx
+  8025ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c6:	6a 00                	push   $0x0
+  8025c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ce:	49 89 c8             	mov    %rcx,%r8
+  8025d1:	48 89 d1             	mov    %rdx,%rcx
+  8025d4:	48 89 c2             	mov    %rax,%rdx
+  8025d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8025dc:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8025e1:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+  8025ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+
+00000000008025f3 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8025f3:	55                   	push   %rbp
+  8025f4:	48 89 e5             	mov    %rsp,%rbp
+  8025f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8025fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802603:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802607:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80260b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80260f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802613:	48 83 ec 08          	sub    $0x8,%rsp
+  802617:	6a 00                	push   $0x0
+  802619:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80261f:	49 89 c8             	mov    %rcx,%r8
+  802622:	48 89 d1             	mov    %rdx,%rcx
+  802625:	48 89 c2             	mov    %rax,%rdx
+  802628:	be 01 00 00 00       	mov    $0x1,%esi
+  80262d:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802632:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+  802648:	48 83 ec 30          	sub    $0x30,%rsp
+  80264c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802650:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802654:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802657:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  80265b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80265f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802662:	48 63 c8             	movslq %eax,%rcx
+  802665:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80266d:	48 83 ec 08          	sub    $0x8,%rsp
+  802671:	6a 00                	push   $0x0
+  802673:	49 89 f1             	mov    %rsi,%r9
+  802676:	49 89 c8             	mov    %rcx,%r8
+  802679:	48 89 d1             	mov    %rdx,%rcx
+  80267c:	48 89 c2             	mov    %rax,%rdx
+  80267f:	be 01 00 00 00       	mov    $0x1,%esi
+  802684:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802689:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+  802695:	48 83 c4 10          	add    $0x10,%rsp
+  802699:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80269c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+00000000008026a1 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+  8026a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8026ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026af:	48 98                	cltq
+  8026b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b5:	6a 00                	push   $0x0
+  8026b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c8:	48 89 c2             	mov    %rax,%rdx
+  8026cb:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d0:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8026d5:	48 b8 50 1d 80 00 00 	movabs $0x801d50,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+  8026e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+
+00000000008026e7 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8026ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  8026f3:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  802702:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802709:	00 00 00 
+  80270c:	48 8b 00             	mov    (%rax),%rax
+  80270f:	48 85 c0             	test   %rax,%rax
+  802712:	75 62                	jne    802776 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  802714:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802717:	ba 07 00 00 00       	mov    $0x7,%edx
+  80271c:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802723:	00 00 00 
+  802726:	48 89 ce             	mov    %rcx,%rsi
+  802729:	89 c7                	mov    %eax,%edi
+  80272b:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+  802737:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  80273a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80273e:	79 36                	jns    802776 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  802740:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802743:	89 c1                	mov    %eax,%ecx
+  802745:	48 b8 15 57 80 00 00 	movabs $0x805715,%rax
+  80274c:	00 00 00 
+  80274f:	48 89 c2             	mov    %rax,%rdx
+  802752:	be 23 00 00 00       	mov    $0x23,%esi
+  802757:	48 b8 2d 57 80 00 00 	movabs $0x80572d,%rax
+  80275e:	00 00 00 
+  802761:	48 89 c7             	mov    %rax,%rdi
+  802764:	b8 00 00 00 00       	mov    $0x0,%eax
+  802769:	49 b8 f6 4c 80 00 00 	movabs $0x804cf6,%r8
+  802770:	00 00 00 
+  802773:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802776:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80277d:	00 00 00 
+  802780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802784:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  802787:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80278a:	48 ba e7 27 80 00 00 	movabs $0x8027e7,%rdx
+  802791:	00 00 00 
+  802794:	48 89 d6             	mov    %rdx,%rsi
+  802797:	89 c7                	mov    %eax,%edi
+  802799:	48 b8 9d 21 80 00 00 	movabs $0x80219d,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  8027a8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8027ac:	79 36                	jns    8027e4 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  8027ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8027b1:	89 c1                	mov    %eax,%ecx
+  8027b3:	48 b8 15 57 80 00 00 	movabs $0x805715,%rax
+  8027ba:	00 00 00 
+  8027bd:	48 89 c2             	mov    %rax,%rdx
+  8027c0:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8027c5:	48 b8 2d 57 80 00 00 	movabs $0x80572d,%rax
+  8027cc:	00 00 00 
+  8027cf:	48 89 c7             	mov    %rax,%rdi
+  8027d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d7:	49 b8 f6 4c 80 00 00 	movabs $0x804cf6,%r8
+  8027de:	00 00 00 
+  8027e1:	41 ff d0             	call   *%r8
+}
+  8027e4:	90                   	nop
+  8027e5:	c9                   	leave
+  8027e6:	c3                   	ret
+
+00000000008027e7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  8027e7:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  8027ea:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  8027ed:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  8027f4:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  8027f8:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  8027fd:	48 a1 00 70 80 00 00 	movabs 0x807000,%rax
+  802804:	00 00 00 
+	call *%rax
+  802807:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  802809:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  80280e:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  802811:	41 5f                	pop    %r15
+	popq %r15
+  802813:	41 5f                	pop    %r15
+	popq %r15
+  802815:	41 5f                	pop    %r15
+	popq %r14
+  802817:	41 5e                	pop    %r14
+	popq %r13
+  802819:	41 5d                	pop    %r13
+	popq %r12
+  80281b:	41 5c                	pop    %r12
+	popq %r11
+  80281d:	41 5b                	pop    %r11
+	popq %r10
+  80281f:	41 5a                	pop    %r10
+	popq %r9
+  802821:	41 59                	pop    %r9
+	popq %r8
+  802823:	41 58                	pop    %r8
+	popq %rsi
+  802825:	5e                   	pop    %rsi
+	popq %rdi
+  802826:	5f                   	pop    %rdi
+	popq %rbp
+  802827:	5d                   	pop    %rbp
+	popq %rdx
+  802828:	5a                   	pop    %rdx
+	popq %rcx
+  802829:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  80282a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80282f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  802834:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  802838:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80283b:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  802840:	5b                   	pop    %rbx
+	popq %rax
+  802841:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  802842:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  802846:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  802847:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  80284c:	c3                   	ret
+
+000000000080284d <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80284d:	55                   	push   %rbp
+  80284e:	48 89 e5             	mov    %rsp,%rbp
+  802851:	48 83 ec 08          	sub    $0x8,%rsp
+  802855:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802859:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80285d:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802864:	ff ff ff 
+  802867:	48 01 d0             	add    %rdx,%rax
+  80286a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80286e:	c9                   	leave
+  80286f:	c3                   	ret
+
+0000000000802870 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802870:	55                   	push   %rbp
+  802871:	48 89 e5             	mov    %rsp,%rbp
+  802874:	48 83 ec 08          	sub    $0x8,%rsp
+  802878:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80287c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802880:	48 89 c7             	mov    %rax,%rdi
+  802883:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  80288a:	00 00 00 
+  80288d:	ff d0                	call   *%rax
+  80288f:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802895:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802899:	c9                   	leave
+  80289a:	c3                   	ret
+
+000000000080289b <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80289b:	55                   	push   %rbp
+  80289c:	48 89 e5             	mov    %rsp,%rbp
+  80289f:	48 83 ec 18          	sub    $0x18,%rsp
+  8028a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8028a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8028ae:	e9 ae 00 00 00       	jmp    802961 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8028b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028b6:	c1 e0 0c             	shl    $0xc,%eax
+  8028b9:	48 98                	cltq
+  8028bb:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8028c0:	48 01 d0             	add    %rdx,%rax
+  8028c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8028c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028cb:	48 c1 e8 27          	shr    $0x27,%rax
+  8028cf:	48 89 c2             	mov    %rax,%rdx
+  8028d2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8028d9:	01 00 00 
+  8028dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028e0:	83 e0 01             	and    $0x1,%eax
+  8028e3:	48 85 c0             	test   %rax,%rax
+  8028e6:	74 63                	je     80294b <fd_alloc+0xb0>
+  8028e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028f0:	48 89 c2             	mov    %rax,%rdx
+  8028f3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8028fa:	01 00 00 
+  8028fd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802901:	83 e0 01             	and    $0x1,%eax
+  802904:	48 85 c0             	test   %rax,%rax
+  802907:	74 42                	je     80294b <fd_alloc+0xb0>
+  802909:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80290d:	48 c1 e8 15          	shr    $0x15,%rax
+  802911:	48 89 c2             	mov    %rax,%rdx
+  802914:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80291b:	01 00 00 
+  80291e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802922:	83 e0 01             	and    $0x1,%eax
+  802925:	48 85 c0             	test   %rax,%rax
+  802928:	74 21                	je     80294b <fd_alloc+0xb0>
+  80292a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80292e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802932:	48 89 c2             	mov    %rax,%rdx
+  802935:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80293c:	01 00 00 
+  80293f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802943:	83 e0 01             	and    $0x1,%eax
+  802946:	48 85 c0             	test   %rax,%rax
+  802949:	75 12                	jne    80295d <fd_alloc+0xc2>
+      *fd_store = fd;
+  80294b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80294f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802953:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295b:	eb 1e                	jmp    80297b <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80295d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802961:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802965:	0f 8e 48 ff ff ff    	jle    8028b3 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80296b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80296f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802976:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+000000000080297d <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	48 83 ec 20          	sub    $0x20,%rsp
+  802985:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802988:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80298c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802990:	78 06                	js     802998 <fd_lookup+0x1b>
+  802992:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802996:	7e 0a                	jle    8029a2 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802998:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80299d:	e9 af 00 00 00       	jmp    802a51 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8029a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029a5:	c1 e0 0c             	shl    $0xc,%eax
+  8029a8:	48 98                	cltq
+  8029aa:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8029af:	48 01 d0             	add    %rdx,%rax
+  8029b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8029b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ba:	48 c1 e8 27          	shr    $0x27,%rax
+  8029be:	48 89 c2             	mov    %rax,%rdx
+  8029c1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8029c8:	01 00 00 
+  8029cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029cf:	83 e0 01             	and    $0x1,%eax
+  8029d2:	48 85 c0             	test   %rax,%rax
+  8029d5:	74 63                	je     802a3a <fd_lookup+0xbd>
+  8029d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029db:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029df:	48 89 c2             	mov    %rax,%rdx
+  8029e2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8029e9:	01 00 00 
+  8029ec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029f0:	83 e0 01             	and    $0x1,%eax
+  8029f3:	48 85 c0             	test   %rax,%rax
+  8029f6:	74 42                	je     802a3a <fd_lookup+0xbd>
+  8029f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029fc:	48 c1 e8 15          	shr    $0x15,%rax
+  802a00:	48 89 c2             	mov    %rax,%rdx
+  802a03:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802a0a:	01 00 00 
+  802a0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a11:	83 e0 01             	and    $0x1,%eax
+  802a14:	48 85 c0             	test   %rax,%rax
+  802a17:	74 21                	je     802a3a <fd_lookup+0xbd>
+  802a19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a1d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a21:	48 89 c2             	mov    %rax,%rdx
+  802a24:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a2b:	01 00 00 
+  802a2e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a32:	83 e0 01             	and    $0x1,%eax
+  802a35:	48 85 c0             	test   %rax,%rax
+  802a38:	75 07                	jne    802a41 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802a3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a3f:	eb 10                	jmp    802a51 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802a41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a49:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+0000000000802a53 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+  802a57:	48 83 ec 30          	sub    $0x30,%rsp
+  802a5b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a5f:	89 f0                	mov    %esi,%eax
+  802a61:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802a64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a68:	48 89 c7             	mov    %rax,%rdi
+  802a6b:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+  802a77:	89 c2                	mov    %eax,%edx
+  802a79:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802a7d:	48 89 c6             	mov    %rax,%rsi
+  802a80:	89 d7                	mov    %edx,%edi
+  802a82:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+  802a8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a95:	78 0a                	js     802aa1 <fd_close+0x4e>
+  802a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a9b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802a9f:	74 12                	je     802ab3 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802aa1:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802aa5:	74 05                	je     802aac <fd_close+0x59>
+  802aa7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aaa:	eb 70                	jmp    802b1c <fd_close+0xc9>
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab1:	eb 69                	jmp    802b1c <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ab3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab7:	8b 00                	mov    (%rax),%eax
+  802ab9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802abd:	48 89 d6             	mov    %rdx,%rsi
+  802ac0:	89 c7                	mov    %eax,%edi
+  802ac2:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ad1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ad5:	78 2a                	js     802b01 <fd_close+0xae>
+    if (dev->dev_close)
+  802ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802adb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802adf:	48 85 c0             	test   %rax,%rax
+  802ae2:	74 16                	je     802afa <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802ae4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802aec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802af0:	48 89 c7             	mov    %rax,%rdi
+  802af3:	ff d2                	call   *%rdx
+  802af5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802af8:	eb 07                	jmp    802b01 <fd_close+0xae>
+    else
+      r = 0;
+  802afa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802b01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b05:	48 89 c6             	mov    %rax,%rsi
+  802b08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0d:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  return r;
+  802b19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b1c:	c9                   	leave
+  802b1d:	c3                   	ret
+
+0000000000802b1e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802b1e:	55                   	push   %rbp
+  802b1f:	48 89 e5             	mov    %rsp,%rbp
+  802b22:	48 83 ec 20          	sub    $0x20,%rsp
+  802b26:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b29:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802b2d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b34:	eb 3f                	jmp    802b75 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802b36:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b3d:	00 00 00 
+  802b40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b43:	48 98                	cltq
+  802b45:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b49:	8b 00                	mov    (%rax),%eax
+  802b4b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802b4e:	75 21                	jne    802b71 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802b50:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b57:	00 00 00 
+  802b5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b5d:	48 98                	cltq
+  802b5f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b67:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6f:	eb 7f                	jmp    802bf0 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802b71:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b75:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802b7c:	00 00 00 
+  802b7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b82:	48 98                	cltq
+  802b84:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b88:	48 85 c0             	test   %rax,%rax
+  802b8b:	75 a9                	jne    802b36 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802b8d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b94:	00 00 00 
+  802b97:	8b 40 04             	mov    0x4(%rax),%eax
+  802b9a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b9f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802ba6:	00 00 00 
+  802ba9:	48 98                	cltq
+  802bab:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802bb2:	48 01 d0             	add    %rdx,%rax
+  802bb5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802bbb:	8b 00                	mov    (%rax),%eax
+  802bbd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802bc0:	89 c6                	mov    %eax,%esi
+  802bc2:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  802bc9:	00 00 00 
+  802bcc:	48 89 c7             	mov    %rax,%rdi
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  802bdb:	00 00 00 
+  802bde:	ff d1                	call   *%rcx
+  *dev = 0;
+  802be0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802be4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802beb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bf0:	c9                   	leave
+  802bf1:	c3                   	ret
+
+0000000000802bf2 <close>:
+
+int
+close(int fdnum) {
+  802bf2:	55                   	push   %rbp
+  802bf3:	48 89 e5             	mov    %rsp,%rbp
+  802bf6:	48 83 ec 20          	sub    $0x20,%rsp
+  802bfa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bfd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c04:	48 89 d6             	mov    %rdx,%rsi
+  802c07:	89 c7                	mov    %eax,%edi
+  802c09:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+  802c15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c18:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c1c:	79 05                	jns    802c23 <close+0x31>
+    return r;
+  802c1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c21:	eb 18                	jmp    802c3b <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c27:	be 01 00 00 00       	mov    $0x1,%esi
+  802c2c:	48 89 c7             	mov    %rax,%rdi
+  802c2f:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+}
+  802c3b:	c9                   	leave
+  802c3c:	c3                   	ret
+
+0000000000802c3d <close_all>:
+
+void
+close_all(void) {
+  802c3d:	55                   	push   %rbp
+  802c3e:	48 89 e5             	mov    %rsp,%rbp
+  802c41:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802c45:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802c4c:	eb 15                	jmp    802c63 <close_all+0x26>
+    close(i);
+  802c4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c51:	89 c7                	mov    %eax,%edi
+  802c53:	48 b8 f2 2b 80 00 00 	movabs $0x802bf2,%rax
+  802c5a:	00 00 00 
+  802c5d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802c5f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c63:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802c67:	7e e5                	jle    802c4e <close_all+0x11>
+}
+  802c69:	90                   	nop
+  802c6a:	90                   	nop
+  802c6b:	c9                   	leave
+  802c6c:	c3                   	ret
+
+0000000000802c6d <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802c6d:	55                   	push   %rbp
+  802c6e:	48 89 e5             	mov    %rsp,%rbp
+  802c71:	48 83 ec 40          	sub    $0x40,%rsp
+  802c75:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802c78:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802c7b:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802c7f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c82:	48 89 d6             	mov    %rdx,%rsi
+  802c85:	89 c7                	mov    %eax,%edi
+  802c87:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  802c8e:	00 00 00 
+  802c91:	ff d0                	call   *%rax
+  802c93:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c96:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c9a:	79 08                	jns    802ca4 <dup+0x37>
+    return r;
+  802c9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9f:	e9 33 02 00 00       	jmp    802ed7 <dup+0x26a>
+  close(newfdnum);
+  802ca4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802ca7:	89 c7                	mov    %eax,%edi
+  802ca9:	48 b8 f2 2b 80 00 00 	movabs $0x802bf2,%rax
+  802cb0:	00 00 00 
+  802cb3:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802cb5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cb8:	c1 e0 0c             	shl    $0xc,%eax
+  802cbb:	48 98                	cltq
+  802cbd:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802cc2:	48 01 d0             	add    %rdx,%rax
+  802cc5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802cc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ccd:	48 89 c7             	mov    %rax,%rdi
+  802cd0:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+  802cdc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802ce0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ce4:	48 89 c7             	mov    %rax,%rdi
+  802ce7:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  802cee:	00 00 00 
+  802cf1:	ff d0                	call   *%rax
+  802cf3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802cf7:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802cfe:	00 
+  802cff:	e9 19 01 00 00       	jmp    802e1d <dup+0x1b0>
+    off -= PGSIZE;
+  802d04:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802d0b:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802d0c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d14:	48 01 d0             	add    %rdx,%rax
+  802d17:	48 c1 e8 27          	shr    $0x27,%rax
+  802d1b:	48 89 c2             	mov    %rax,%rdx
+  802d1e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d25:	01 00 00 
+  802d28:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d2c:	83 e0 01             	and    $0x1,%eax
+  802d2f:	48 85 c0             	test   %rax,%rax
+  802d32:	0f 84 e5 00 00 00    	je     802e1d <dup+0x1b0>
+  802d38:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d40:	48 01 d0             	add    %rdx,%rax
+  802d43:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d47:	48 89 c2             	mov    %rax,%rdx
+  802d4a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802d51:	01 00 00 
+  802d54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d58:	83 e0 01             	and    $0x1,%eax
+  802d5b:	48 85 c0             	test   %rax,%rax
+  802d5e:	0f 84 b9 00 00 00    	je     802e1d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802d64:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6c:	48 01 d0             	add    %rdx,%rax
+  802d6f:	48 c1 e8 15          	shr    $0x15,%rax
+  802d73:	48 89 c2             	mov    %rax,%rdx
+  802d76:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802d7d:	01 00 00 
+  802d80:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d84:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802d87:	48 85 c0             	test   %rax,%rax
+  802d8a:	0f 84 8d 00 00 00    	je     802e1d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802d90:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d98:	48 01 d0             	add    %rdx,%rax
+  802d9b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d9f:	48 89 c2             	mov    %rax,%rdx
+  802da2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802da9:	01 00 00 
+  802dac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802db0:	83 e0 01             	and    $0x1,%eax
+  802db3:	48 85 c0             	test   %rax,%rax
+  802db6:	74 65                	je     802e1d <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802db8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802dbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc0:	48 01 d0             	add    %rdx,%rax
+  802dc3:	48 c1 e8 0c          	shr    $0xc,%rax
+  802dc7:	48 89 c2             	mov    %rax,%rdx
+  802dca:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dd1:	01 00 00 
+  802dd4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dd8:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ddd:	89 c6                	mov    %eax,%esi
+  802ddf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802de3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802de7:	48 01 c2             	add    %rax,%rdx
+  802dea:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802dee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df2:	48 01 c8             	add    %rcx,%rax
+  802df5:	41 89 f0             	mov    %esi,%r8d
+  802df8:	48 89 d1             	mov    %rdx,%rcx
+  802dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e00:	48 89 c6             	mov    %rax,%rsi
+  802e03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e08:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  802e0f:	00 00 00 
+  802e12:	ff d0                	call   *%rax
+  802e14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e1b:	78 60                	js     802e7d <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802e1d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802e22:	0f 85 dc fe ff ff    	jne    802d04 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802e28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e2c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e30:	48 89 c2             	mov    %rax,%rdx
+  802e33:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e3a:	01 00 00 
+  802e3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e41:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e46:	89 c1                	mov    %eax,%ecx
+  802e48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e4c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802e50:	41 89 c8             	mov    %ecx,%r8d
+  802e53:	48 89 d1             	mov    %rdx,%rcx
+  802e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5b:	48 89 c6             	mov    %rax,%rsi
+  802e5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e63:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e72:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e76:	78 08                	js     802e80 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802e78:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e7b:	eb 5a                	jmp    802ed7 <dup+0x26a>
+        goto err;
+  802e7d:	90                   	nop
+  802e7e:	eb 01                	jmp    802e81 <dup+0x214>
+    goto err;
+  802e80:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e85:	48 89 c6             	mov    %rax,%rsi
+  802e88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8d:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802e99:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ea0:	00 
+  802ea1:	eb 27                	jmp    802eca <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802ea3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ea7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eab:	48 01 d0             	add    %rdx,%rax
+  802eae:	48 89 c6             	mov    %rax,%rsi
+  802eb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb6:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802ec2:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802ec9:	00 
+  802eca:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802ed1:	00 
+  802ed2:	76 cf                	jbe    802ea3 <dup+0x236>
+  return r;
+  802ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ed7:	c9                   	leave
+  802ed8:	c3                   	ret
+
+0000000000802ed9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802ed9:	55                   	push   %rbp
+  802eda:	48 89 e5             	mov    %rsp,%rbp
+  802edd:	48 83 ec 40          	sub    $0x40,%rsp
+  802ee1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ee4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ee8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802eec:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ef0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ef3:	48 89 d6             	mov    %rdx,%rsi
+  802ef6:	89 c7                	mov    %eax,%edi
+  802ef8:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+  802f04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f0b:	78 24                	js     802f31 <read+0x58>
+  802f0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f11:	8b 00                	mov    (%rax),%eax
+  802f13:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f17:	48 89 d6             	mov    %rdx,%rsi
+  802f1a:	89 c7                	mov    %eax,%edi
+  802f1c:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+  802f28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f2f:	79 0a                	jns    802f3b <read+0x62>
+    return r;
+  802f31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f34:	48 98                	cltq
+  802f36:	e9 9e 00 00 00       	jmp    802fd9 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802f3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f3f:	8b 40 08             	mov    0x8(%rax),%eax
+  802f42:	83 e0 03             	and    $0x3,%eax
+  802f45:	83 f8 01             	cmp    $0x1,%eax
+  802f48:	75 5c                	jne    802fa6 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f4a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f51:	00 00 00 
+  802f54:	8b 40 04             	mov    0x4(%rax),%eax
+  802f57:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f5c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f63:	00 00 00 
+  802f66:	48 98                	cltq
+  802f68:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f6f:	48 01 d0             	add    %rdx,%rax
+  802f72:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f78:	8b 00                	mov    (%rax),%eax
+  802f7a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f7d:	89 c6                	mov    %eax,%esi
+  802f7f:	48 b8 5f 57 80 00 00 	movabs $0x80575f,%rax
+  802f86:	00 00 00 
+  802f89:	48 89 c7             	mov    %rax,%rdi
+  802f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f91:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  802f98:	00 00 00 
+  802f9b:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f9d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802fa4:	eb 33                	jmp    802fd9 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802fa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802faa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802fae:	48 85 c0             	test   %rax,%rax
+  802fb1:	75 09                	jne    802fbc <read+0xe3>
+    return -E_NOT_SUPP;
+  802fb3:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802fba:	eb 1d                	jmp    802fd9 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802fbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc0:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802fc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fc8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fcc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802fd0:	48 89 ce             	mov    %rcx,%rsi
+  802fd3:	48 89 c7             	mov    %rax,%rdi
+  802fd6:	41 ff d0             	call   *%r8
+}
+  802fd9:	c9                   	leave
+  802fda:	c3                   	ret
+
+0000000000802fdb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802fdb:	55                   	push   %rbp
+  802fdc:	48 89 e5             	mov    %rsp,%rbp
+  802fdf:	48 83 ec 30          	sub    $0x30,%rsp
+  802fe3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fe6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802fea:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802fee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ff5:	eb 49                	jmp    803040 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802ff7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ffa:	48 98                	cltq
+  802ffc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803000:	48 29 c2             	sub    %rax,%rdx
+  803003:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803006:	48 63 c8             	movslq %eax,%rcx
+  803009:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80300d:	48 01 c1             	add    %rax,%rcx
+  803010:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803013:	48 89 ce             	mov    %rcx,%rsi
+  803016:	89 c7                	mov    %eax,%edi
+  803018:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+  803024:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803027:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80302b:	79 07                	jns    803034 <readn+0x59>
+      return m;
+  80302d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803030:	48 98                	cltq
+  803032:	eb 1f                	jmp    803053 <readn+0x78>
+    if (m == 0)
+  803034:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803038:	74 13                	je     80304d <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80303a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80303d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803040:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803043:	48 98                	cltq
+  803045:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803049:	72 ac                	jb     802ff7 <readn+0x1c>
+  80304b:	eb 01                	jmp    80304e <readn+0x73>
+      break;
+  80304d:	90                   	nop
+  }
+  return tot;
+  80304e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803051:	48 98                	cltq
+}
+  803053:	c9                   	leave
+  803054:	c3                   	ret
+
+0000000000803055 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	48 83 ec 40          	sub    $0x40,%rsp
+  80305d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803060:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803064:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803068:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80306c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80306f:	48 89 d6             	mov    %rdx,%rsi
+  803072:	89 c7                	mov    %eax,%edi
+  803074:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+  803080:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803083:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803087:	78 24                	js     8030ad <write+0x58>
+  803089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80308d:	8b 00                	mov    (%rax),%eax
+  80308f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803093:	48 89 d6             	mov    %rdx,%rsi
+  803096:	89 c7                	mov    %eax,%edi
+  803098:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  80309f:	00 00 00 
+  8030a2:	ff d0                	call   *%rax
+  8030a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030ab:	79 0a                	jns    8030b7 <write+0x62>
+    return r;
+  8030ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030b0:	48 98                	cltq
+  8030b2:	e9 9d 00 00 00       	jmp    803154 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8030b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030bb:	8b 40 08             	mov    0x8(%rax),%eax
+  8030be:	83 e0 03             	and    $0x3,%eax
+  8030c1:	85 c0                	test   %eax,%eax
+  8030c3:	75 5c                	jne    803121 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030c5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030cc:	00 00 00 
+  8030cf:	8b 40 04             	mov    0x4(%rax),%eax
+  8030d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030de:	00 00 00 
+  8030e1:	48 98                	cltq
+  8030e3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8030ea:	48 01 d0             	add    %rdx,%rax
+  8030ed:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8030f3:	8b 00                	mov    (%rax),%eax
+  8030f5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030f8:	89 c6                	mov    %eax,%esi
+  8030fa:	48 b8 7b 57 80 00 00 	movabs $0x80577b,%rax
+  803101:	00 00 00 
+  803104:	48 89 c7             	mov    %rax,%rdi
+  803107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310c:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  803113:	00 00 00 
+  803116:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803118:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80311f:	eb 33                	jmp    803154 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803121:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803125:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803129:	48 85 c0             	test   %rax,%rax
+  80312c:	75 09                	jne    803137 <write+0xe2>
+    return -E_NOT_SUPP;
+  80312e:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803135:	eb 1d                	jmp    803154 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80313b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80313f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803143:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803147:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80314b:	48 89 ce             	mov    %rcx,%rsi
+  80314e:	48 89 c7             	mov    %rax,%rdi
+  803151:	41 ff d0             	call   *%r8
+}
+  803154:	c9                   	leave
+  803155:	c3                   	ret
+
+0000000000803156 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803156:	55                   	push   %rbp
+  803157:	48 89 e5             	mov    %rsp,%rbp
+  80315a:	48 83 ec 18          	sub    $0x18,%rsp
+  80315e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803161:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803164:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803168:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316b:	48 89 d6             	mov    %rdx,%rsi
+  80316e:	89 c7                	mov    %eax,%edi
+  803170:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  803177:	00 00 00 
+  80317a:	ff d0                	call   *%rax
+  80317c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80317f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803183:	79 05                	jns    80318a <seek+0x34>
+    return r;
+  803185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803188:	eb 0f                	jmp    803199 <seek+0x43>
+  fd->fd_offset = offset;
+  80318a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80318e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803191:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803199:	c9                   	leave
+  80319a:	c3                   	ret
+
+000000000080319b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80319b:	55                   	push   %rbp
+  80319c:	48 89 e5             	mov    %rsp,%rbp
+  80319f:	48 83 ec 30          	sub    $0x30,%rsp
+  8031a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031a6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031a9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031b0:	48 89 d6             	mov    %rdx,%rsi
+  8031b3:	89 c7                	mov    %eax,%edi
+  8031b5:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  8031bc:	00 00 00 
+  8031bf:	ff d0                	call   *%rax
+  8031c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031c8:	78 24                	js     8031ee <ftruncate+0x53>
+  8031ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ce:	8b 00                	mov    (%rax),%eax
+  8031d0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031d4:	48 89 d6             	mov    %rdx,%rsi
+  8031d7:	89 c7                	mov    %eax,%edi
+  8031d9:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+  8031e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ec:	79 08                	jns    8031f6 <ftruncate+0x5b>
+    return r;
+  8031ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031f1:	e9 92 00 00 00       	jmp    803288 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031fa:	8b 40 08             	mov    0x8(%rax),%eax
+  8031fd:	83 e0 03             	and    $0x3,%eax
+  803200:	85 c0                	test   %eax,%eax
+  803202:	75 5a                	jne    80325e <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803204:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80320b:	00 00 00 
+  80320e:	8b 40 04             	mov    0x4(%rax),%eax
+  803211:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803216:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80321d:	00 00 00 
+  803220:	48 98                	cltq
+  803222:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803229:	48 01 d0             	add    %rdx,%rax
+  80322c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803232:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803234:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803237:	89 c6                	mov    %eax,%esi
+  803239:	48 b8 98 57 80 00 00 	movabs $0x805798,%rax
+  803240:	00 00 00 
+  803243:	48 89 c7             	mov    %rax,%rdi
+  803246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324b:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  803252:	00 00 00 
+  803255:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803257:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80325c:	eb 2a                	jmp    803288 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80325e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803262:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803266:	48 85 c0             	test   %rax,%rax
+  803269:	75 07                	jne    803272 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80326b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803270:	eb 16                	jmp    803288 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803272:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803276:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80327a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80327e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803281:	89 d6                	mov    %edx,%esi
+  803283:	48 89 c7             	mov    %rax,%rdi
+  803286:	ff d1                	call   *%rcx
+}
+  803288:	c9                   	leave
+  803289:	c3                   	ret
+
+000000000080328a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80328a:	55                   	push   %rbp
+  80328b:	48 89 e5             	mov    %rsp,%rbp
+  80328e:	48 83 ec 30          	sub    $0x30,%rsp
+  803292:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803295:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803299:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80329d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032a0:	48 89 d6             	mov    %rdx,%rsi
+  8032a3:	89 c7                	mov    %eax,%edi
+  8032a5:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  8032ac:	00 00 00 
+  8032af:	ff d0                	call   *%rax
+  8032b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032b8:	78 24                	js     8032de <fstat+0x54>
+  8032ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032be:	8b 00                	mov    (%rax),%eax
+  8032c0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032c4:	48 89 d6             	mov    %rdx,%rsi
+  8032c7:	89 c7                	mov    %eax,%edi
+  8032c9:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+  8032d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032dc:	79 05                	jns    8032e3 <fstat+0x59>
+    return r;
+  8032de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032e1:	eb 5e                	jmp    803341 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8032e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032e7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032eb:	48 85 c0             	test   %rax,%rax
+  8032ee:	75 07                	jne    8032f7 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8032f0:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8032f5:	eb 4a                	jmp    803341 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8032f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032fb:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8032fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803302:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803309:	00 00 00 
+  stat->st_isdir   = 0;
+  80330c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803310:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803317:	00 00 00 
+  stat->st_dev     = dev;
+  80331a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80331e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803322:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803329:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80332d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803331:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803335:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803339:	48 89 d6             	mov    %rdx,%rsi
+  80333c:	48 89 c7             	mov    %rax,%rdi
+  80333f:	ff d1                	call   *%rcx
+}
+  803341:	c9                   	leave
+  803342:	c3                   	ret
+
+0000000000803343 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803343:	55                   	push   %rbp
+  803344:	48 89 e5             	mov    %rsp,%rbp
+  803347:	48 83 ec 10          	sub    $0x10,%rsp
+  80334b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80334f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803357:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80335d:	83 f8 20             	cmp    $0x20,%eax
+  803360:	75 07                	jne    803369 <pollwait_key+0x26>
+    return -E_INVAL;
+  803362:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803367:	eb 5f                	jmp    8033c8 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336d:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803373:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803377:	48 63 d2             	movslq %edx,%rdx
+  80337a:	48 c1 e2 04          	shl    $0x4,%rdx
+  80337e:	48 01 c2             	add    %rax,%rdx
+  803381:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803385:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338c:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803392:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803396:	8b 00                	mov    (%rax),%eax
+  803398:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80339c:	48 63 c9             	movslq %ecx,%rcx
+  80339f:	48 c1 e1 04          	shl    $0x4,%rcx
+  8033a3:	48 01 ca             	add    %rcx,%rdx
+  8033a6:	48 83 c2 08          	add    $0x8,%rdx
+  8033aa:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8033ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033b0:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8033b6:	8d 50 01             	lea    0x1(%rax),%edx
+  8033b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033bd:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8033c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+00000000008033ca <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8033ca:	55                   	push   %rbp
+  8033cb:	48 89 e5             	mov    %rsp,%rbp
+  8033ce:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8033d5:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8033dc:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8033e2:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8033e9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8033f0:	00 
+  int i, r, ready, ipc = 0;
+  8033f1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8033f8:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8033ff:	00 
+  803400:	74 45                	je     803447 <poll+0x7d>
+  803402:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803409:	ff 
+  80340a:	74 3b                	je     803447 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80340c:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+  803418:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80341c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803420:	48 f7 d0             	not    %rax
+  803423:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80342a:	73 10                	jae    80343c <poll+0x72>
+  80342c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803430:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803437:	48 01 d0             	add    %rdx,%rax
+  80343a:	eb 07                	jmp    803443 <poll+0x79>
+  80343c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803443:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803447:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80344e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803455:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80345c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803463:	e9 46 02 00 00       	jmp    8036ae <poll+0x2e4>
+      fds[i].revents = 0;
+  803468:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80346b:	48 63 d0             	movslq %eax,%rdx
+  80346e:	48 89 d0             	mov    %rdx,%rax
+  803471:	48 01 c0             	add    %rax,%rax
+  803474:	48 01 d0             	add    %rdx,%rax
+  803477:	48 c1 e0 02          	shl    $0x2,%rax
+  80347b:	48 89 c2             	mov    %rax,%rdx
+  80347e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803485:	48 01 d0             	add    %rdx,%rax
+  803488:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80348f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803492:	48 63 d0             	movslq %eax,%rdx
+  803495:	48 89 d0             	mov    %rdx,%rax
+  803498:	48 01 c0             	add    %rax,%rax
+  80349b:	48 01 d0             	add    %rdx,%rax
+  80349e:	48 c1 e0 02          	shl    $0x2,%rax
+  8034a2:	48 89 c2             	mov    %rax,%rdx
+  8034a5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034ac:	48 01 d0             	add    %rdx,%rax
+  8034af:	8b 00                	mov    (%rax),%eax
+  8034b1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8034b4:	75 62                	jne    803518 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8034b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034b9:	48 63 d0             	movslq %eax,%rdx
+  8034bc:	48 89 d0             	mov    %rdx,%rax
+  8034bf:	48 01 c0             	add    %rax,%rax
+  8034c2:	48 01 d0             	add    %rdx,%rax
+  8034c5:	48 c1 e0 02          	shl    $0x2,%rax
+  8034c9:	48 89 c2             	mov    %rax,%rdx
+  8034cc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034d3:	48 01 d0             	add    %rdx,%rax
+  8034d6:	8b 40 04             	mov    0x4(%rax),%eax
+  8034d9:	83 e0 01             	and    $0x1,%eax
+  8034dc:	85 c0                	test   %eax,%eax
+  8034de:	0f 84 9b 01 00 00    	je     80367f <poll+0x2b5>
+          fds[i].revents = ipc;
+  8034e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034e7:	48 63 d0             	movslq %eax,%rdx
+  8034ea:	48 89 d0             	mov    %rdx,%rax
+  8034ed:	48 01 c0             	add    %rax,%rax
+  8034f0:	48 01 d0             	add    %rdx,%rax
+  8034f3:	48 c1 e0 02          	shl    $0x2,%rax
+  8034f7:	48 89 c2             	mov    %rax,%rdx
+  8034fa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803501:	48 01 c2             	add    %rax,%rdx
+  803504:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803507:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80350a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80350d:	83 c8 04             	or     $0x4,%eax
+  803510:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803513:	e9 67 01 00 00       	jmp    80367f <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803518:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80351b:	48 63 d0             	movslq %eax,%rdx
+  80351e:	48 89 d0             	mov    %rdx,%rax
+  803521:	48 01 c0             	add    %rax,%rax
+  803524:	48 01 d0             	add    %rdx,%rax
+  803527:	48 c1 e0 02          	shl    $0x2,%rax
+  80352b:	48 89 c2             	mov    %rax,%rdx
+  80352e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803535:	48 01 d0             	add    %rdx,%rax
+  803538:	8b 00                	mov    (%rax),%eax
+  80353a:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803541:	48 89 d6             	mov    %rdx,%rsi
+  803544:	89 c7                	mov    %eax,%edi
+  803546:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  80354d:	00 00 00 
+  803550:	ff d0                	call   *%rax
+  803552:	85 c0                	test   %eax,%eax
+  803554:	78 25                	js     80357b <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803556:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80355d:	8b 00                	mov    (%rax),%eax
+  80355f:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803566:	48 89 d6             	mov    %rdx,%rsi
+  803569:	89 c7                	mov    %eax,%edi
+  80356b:	48 b8 1e 2b 80 00 00 	movabs $0x802b1e,%rax
+  803572:	00 00 00 
+  803575:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803577:	85 c0                	test   %eax,%eax
+  803579:	79 2c                	jns    8035a7 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80357b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80357e:	48 63 d0             	movslq %eax,%rdx
+  803581:	48 89 d0             	mov    %rdx,%rax
+  803584:	48 01 c0             	add    %rax,%rax
+  803587:	48 01 d0             	add    %rdx,%rax
+  80358a:	48 c1 e0 02          	shl    $0x2,%rax
+  80358e:	48 89 c2             	mov    %rax,%rdx
+  803591:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803598:	48 01 d0             	add    %rdx,%rax
+  80359b:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8035a2:	e9 d8 00 00 00       	jmp    80367f <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8035a7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8035ae:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8035b2:	48 85 c0             	test   %rax,%rax
+  8035b5:	74 7d                	je     803634 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8035b7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8035be:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8035c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035c5:	48 63 d0             	movslq %eax,%rdx
+  8035c8:	48 89 d0             	mov    %rdx,%rax
+  8035cb:	48 01 c0             	add    %rax,%rax
+  8035ce:	48 01 d0             	add    %rdx,%rax
+  8035d1:	48 c1 e0 02          	shl    $0x2,%rax
+  8035d5:	48 89 c2             	mov    %rax,%rdx
+  8035d8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035df:	48 01 d0             	add    %rdx,%rax
+  8035e2:	8b 48 04             	mov    0x4(%rax),%ecx
+  8035e5:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8035ec:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8035f3:	89 ce                	mov    %ecx,%esi
+  8035f5:	48 89 c7             	mov    %rax,%rdi
+  8035f8:	41 ff d0             	call   *%r8
+  8035fb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8035fe:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803602:	79 08                	jns    80360c <poll+0x242>
+          return r;
+  803604:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803607:	e9 45 01 00 00       	jmp    803751 <poll+0x387>
+        fds[i].revents = r;
+  80360c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80360f:	48 63 d0             	movslq %eax,%rdx
+  803612:	48 89 d0             	mov    %rdx,%rax
+  803615:	48 01 c0             	add    %rax,%rax
+  803618:	48 01 d0             	add    %rdx,%rax
+  80361b:	48 c1 e0 02          	shl    $0x2,%rax
+  80361f:	48 89 c2             	mov    %rax,%rdx
+  803622:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803629:	48 01 c2             	add    %rax,%rdx
+  80362c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80362f:	89 42 08             	mov    %eax,0x8(%rdx)
+  803632:	eb 4b                	jmp    80367f <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803634:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803637:	48 63 d0             	movslq %eax,%rdx
+  80363a:	48 89 d0             	mov    %rdx,%rax
+  80363d:	48 01 c0             	add    %rax,%rax
+  803640:	48 01 d0             	add    %rdx,%rax
+  803643:	48 c1 e0 02          	shl    $0x2,%rax
+  803647:	48 89 c2             	mov    %rax,%rdx
+  80364a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803651:	48 01 d0             	add    %rdx,%rax
+  803654:	8b 48 04             	mov    0x4(%rax),%ecx
+  803657:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80365a:	48 63 d0             	movslq %eax,%rdx
+  80365d:	48 89 d0             	mov    %rdx,%rax
+  803660:	48 01 c0             	add    %rax,%rax
+  803663:	48 01 d0             	add    %rdx,%rax
+  803666:	48 c1 e0 02          	shl    $0x2,%rax
+  80366a:	48 89 c2             	mov    %rax,%rdx
+  80366d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803674:	48 01 d0             	add    %rdx,%rax
+  803677:	83 e1 03             	and    $0x3,%ecx
+  80367a:	89 ca                	mov    %ecx,%edx
+  80367c:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80367f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803682:	48 63 d0             	movslq %eax,%rdx
+  803685:	48 89 d0             	mov    %rdx,%rax
+  803688:	48 01 c0             	add    %rax,%rax
+  80368b:	48 01 d0             	add    %rdx,%rax
+  80368e:	48 c1 e0 02          	shl    $0x2,%rax
+  803692:	48 89 c2             	mov    %rax,%rdx
+  803695:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80369c:	48 01 d0             	add    %rdx,%rax
+  80369f:	8b 40 08             	mov    0x8(%rax),%eax
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	74 04                	je     8036aa <poll+0x2e0>
+        ready++;
+  8036a6:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8036aa:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8036ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036b1:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8036b7:	0f 8c ab fd ff ff    	jl     803468 <poll+0x9e>
+    }
+    if (ready)
+  8036bd:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8036c1:	74 08                	je     8036cb <poll+0x301>
+      return ready;
+  8036c3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8036c6:	e9 86 00 00 00       	jmp    803751 <poll+0x387>
+
+    if (deadline) {
+  8036cb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8036d0:	74 30                	je     803702 <poll+0x338>
+      now     = vsys_clock_ns();
+  8036d2:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  8036d9:	00 00 00 
+  8036dc:	ff d0                	call   *%rax
+  8036de:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8036e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8036ea:	73 0a                	jae    8036f6 <poll+0x32c>
+  8036ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036f0:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8036f4:	eb 05                	jmp    8036fb <poll+0x331>
+  8036f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fb:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803702:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803705:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803708:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80370f:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803716:	48 89 c7             	mov    %rax,%rdi
+  803719:	48 b8 48 24 80 00 00 	movabs $0x802448,%rax
+  803720:	00 00 00 
+  803723:	ff d0                	call   *%rax
+  803725:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803728:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80372c:	75 07                	jne    803735 <poll+0x36b>
+      return 0;
+  80372e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803733:	eb 1c                	jmp    803751 <poll+0x387>
+    if (r < 0)
+  803735:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803739:	79 05                	jns    803740 <poll+0x376>
+      return r;
+  80373b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80373e:	eb 11                	jmp    803751 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803740:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803743:	c1 f8 02             	sar    $0x2,%eax
+  803746:	83 e0 01             	and    $0x1,%eax
+  803749:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80374c:	e9 f6 fc ff ff       	jmp    803447 <poll+0x7d>
+  }
+}
+  803751:	c9                   	leave
+  803752:	c3                   	ret
+
+0000000000803753 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	48 83 ec 20          	sub    $0x20,%rsp
+  80375b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80375f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803767:	be 00 00 00 00       	mov    $0x0,%esi
+  80376c:	48 89 c7             	mov    %rax,%rdi
+  80376f:	48 b8 41 38 80 00 00 	movabs $0x803841,%rax
+  803776:	00 00 00 
+  803779:	ff d0                	call   *%rax
+  80377b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80377e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803782:	79 05                	jns    803789 <stat+0x36>
+    return fd;
+  803784:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803787:	eb 2f                	jmp    8037b8 <stat+0x65>
+  r = fstat(fd, stat);
+  803789:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80378d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803790:	48 89 d6             	mov    %rdx,%rsi
+  803793:	89 c7                	mov    %eax,%edi
+  803795:	48 b8 8a 32 80 00 00 	movabs $0x80328a,%rax
+  80379c:	00 00 00 
+  80379f:	ff d0                	call   *%rax
+  8037a1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8037a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037a7:	89 c7                	mov    %eax,%edi
+  8037a9:	48 b8 f2 2b 80 00 00 	movabs $0x802bf2,%rax
+  8037b0:	00 00 00 
+  8037b3:	ff d0                	call   *%rax
+  return r;
+  8037b5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8037b8:	c9                   	leave
+  8037b9:	c3                   	ret
+
+00000000008037ba <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8037ba:	55                   	push   %rbp
+  8037bb:	48 89 e5             	mov    %rsp,%rbp
+  8037be:	48 83 ec 10          	sub    $0x10,%rsp
+  8037c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8037c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8037c9:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8037d0:	00 00 00 
+  8037d3:	8b 00                	mov    (%rax),%eax
+  8037d5:	85 c0                	test   %eax,%eax
+  8037d7:	75 1d                	jne    8037f6 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8037d9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037de:	48 b8 3a 50 80 00 00 	movabs $0x80503a,%rax
+  8037e5:	00 00 00 
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8037f1:	00 00 00 
+  8037f4:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8037f6:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8037fd:	00 00 00 
+  803800:	8b 00                	mov    (%rax),%eax
+  803802:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803805:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80380a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803811:	00 00 00 
+  803814:	89 c7                	mov    %eax,%edi
+  803816:	48 b8 8d 4f 80 00 00 	movabs $0x804f8d,%rax
+  80381d:	00 00 00 
+  803820:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803822:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80382b:	48 89 c6             	mov    %rax,%rsi
+  80382e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803833:	48 b8 10 4e 80 00 00 	movabs $0x804e10,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+}
+  80383f:	c9                   	leave
+  803840:	c3                   	ret
+
+0000000000803841 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803841:	55                   	push   %rbp
+  803842:	48 89 e5             	mov    %rsp,%rbp
+  803845:	48 83 ec 20          	sub    $0x20,%rsp
+  803849:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80384d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803854:	48 89 c7             	mov    %rax,%rdi
+  803857:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  80385e:	00 00 00 
+  803861:	ff d0                	call   *%rax
+  803863:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803868:	7e 0a                	jle    803874 <open+0x33>
+    return -E_BAD_PATH;
+  80386a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80386f:	e9 a8 00 00 00       	jmp    80391c <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803874:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803878:	48 89 c7             	mov    %rax,%rdi
+  80387b:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  803882:	00 00 00 
+  803885:	ff d0                	call   *%rax
+  803887:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80388a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80388e:	79 08                	jns    803898 <open+0x57>
+    return r;
+  803890:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803893:	e9 84 00 00 00       	jmp    80391c <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803898:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80389c:	48 89 c6             	mov    %rax,%rsi
+  80389f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8038a6:	00 00 00 
+  8038a9:	48 89 c7             	mov    %rax,%rdi
+  8038ac:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  8038b3:	00 00 00 
+  8038b6:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8038b8:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8038bf:	00 00 00 
+  8038c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038c5:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8038cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038cf:	48 89 c6             	mov    %rax,%rsi
+  8038d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038d7:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  8038de:	00 00 00 
+  8038e1:	ff d0                	call   *%rax
+  8038e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038ea:	79 1d                	jns    803909 <open+0xc8>
+    fd_close(fd, 0);
+  8038ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8038f5:	48 89 c7             	mov    %rax,%rdi
+  8038f8:	48 b8 53 2a 80 00 00 	movabs $0x802a53,%rax
+  8038ff:	00 00 00 
+  803902:	ff d0                	call   *%rax
+    return r;
+  803904:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803907:	eb 13                	jmp    80391c <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803909:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80390d:	48 89 c7             	mov    %rax,%rdi
+  803910:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	c9                   	leave
+  80391d:	c3                   	ret
+
+000000000080391e <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80391e:	55                   	push   %rbp
+  80391f:	48 89 e5             	mov    %rsp,%rbp
+  803922:	48 83 ec 10          	sub    $0x10,%rsp
+  803926:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80392a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80392e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803931:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803938:	00 00 00 
+  80393b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80393d:	be 00 00 00 00       	mov    $0x0,%esi
+  803942:	bf 06 00 00 00       	mov    $0x6,%edi
+  803947:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  80394e:	00 00 00 
+  803951:	ff d0                	call   *%rax
+}
+  803953:	c9                   	leave
+  803954:	c3                   	ret
+
+0000000000803955 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803955:	55                   	push   %rbp
+  803956:	48 89 e5             	mov    %rsp,%rbp
+  803959:	48 83 ec 30          	sub    $0x30,%rsp
+  80395d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803961:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803965:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803969:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80396e:	74 07                	je     803977 <devfile_read+0x22>
+  803970:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803975:	75 0a                	jne    803981 <devfile_read+0x2c>
+  return E_INVAL;
+  803977:	b8 03 00 00 00       	mov    $0x3,%eax
+  80397c:	e9 b4 00 00 00       	jmp    803a35 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803981:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803988:	00 
+  while (n) {
+  803989:	e9 98 00 00 00       	jmp    803a26 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80398e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803992:	8b 40 0c             	mov    0xc(%rax),%eax
+  803995:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80399c:	00 00 00 
+  80399f:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8039a1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039a8:	00 00 00 
+  8039ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039af:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8039b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8039b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039bd:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  8039c9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8039cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8039d0:	7f 13                	jg     8039e5 <devfile_read+0x90>
+      return res ? res : res0;
+  8039d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8039d6:	74 07                	je     8039df <devfile_read+0x8a>
+  8039d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039db:	48 98                	cltq
+  8039dd:	eb 56                	jmp    803a35 <devfile_read+0xe0>
+  8039df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039e3:	eb 50                	jmp    803a35 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8039e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039e8:	48 63 d0             	movslq %eax,%rdx
+  8039eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ef:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8039f6:	00 00 00 
+  8039f9:	48 89 ce             	mov    %rcx,%rsi
+  8039fc:	48 89 c7             	mov    %rax,%rdi
+  8039ff:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  803a06:	00 00 00 
+  803a09:	ff d0                	call   *%rax
+
+    buf += res;
+  803a0b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a0e:	48 98                	cltq
+  803a10:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803a14:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a17:	48 98                	cltq
+  803a19:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803a1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a20:	48 98                	cltq
+  803a22:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803a26:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803a2b:	0f 85 5d ff ff ff    	jne    80398e <devfile_read+0x39>
+  }
+
+  return res0;
+  803a31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803a35:	c9                   	leave
+  803a36:	c3                   	ret
+
+0000000000803a37 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803a37:	55                   	push   %rbp
+  803a38:	48 89 e5             	mov    %rsp,%rbp
+  803a3b:	48 83 ec 50          	sub    $0x50,%rsp
+  803a3f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a43:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a47:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803a4b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803a50:	74 07                	je     803a59 <devfile_write+0x22>
+  803a52:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803a57:	75 0a                	jne    803a63 <devfile_write+0x2c>
+  return E_INVAL;
+  803a59:	b8 03 00 00 00       	mov    $0x3,%eax
+  803a5e:	e9 c9 00 00 00       	jmp    803b2c <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803a63:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a6a:	00 
+
+  while (n) {
+  803a6b:	e9 ad 00 00 00       	jmp    803b1d <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803a70:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803a78:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803a7f:	00 
+  803a80:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a88:	48 39 c2             	cmp    %rax,%rdx
+  803a8b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a8f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803a93:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a97:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a9b:	48 89 c6             	mov    %rax,%rsi
+  803a9e:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803aa5:	00 00 00 
+  803aa8:	48 89 c7             	mov    %rax,%rdi
+  803aab:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  803ab2:	00 00 00 
+  803ab5:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803ab7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803abb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803abe:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ac5:	00 00 00 
+  803ac8:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803aca:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ad1:	00 00 00 
+  803ad4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ad8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803adc:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae1:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ae6:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+  803af2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803af5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803af9:	79 07                	jns    803b02 <devfile_write+0xcb>
+      return res;
+  803afb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803afe:	48 98                	cltq
+  803b00:	eb 2a                	jmp    803b2c <devfile_write+0xf5>
+
+    buf += res;
+  803b02:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b05:	48 98                	cltq
+  803b07:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803b0b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b0e:	48 98                	cltq
+  803b10:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803b14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b17:	48 98                	cltq
+  803b19:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803b1d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803b22:	0f 85 48 ff ff ff    	jne    803a70 <devfile_write+0x39>
+  }
+
+  return res0;
+  803b28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803b2c:	c9                   	leave
+  803b2d:	c3                   	ret
+
+0000000000803b2e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803b2e:	55                   	push   %rbp
+  803b2f:	48 89 e5             	mov    %rsp,%rbp
+  803b32:	48 83 ec 20          	sub    $0x20,%rsp
+  803b36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b3a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b42:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b45:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b4c:	00 00 00 
+  803b4f:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803b51:	be 00 00 00 00       	mov    $0x0,%esi
+  803b56:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b5b:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+  803b67:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b6a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b6e:	79 05                	jns    803b75 <devfile_stat+0x47>
+    return r;
+  803b70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b73:	eb 59                	jmp    803bce <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b79:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b80:	00 00 00 
+  803b83:	48 89 d6             	mov    %rdx,%rsi
+  803b86:	48 89 c7             	mov    %rax,%rdi
+  803b89:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  803b90:	00 00 00 
+  803b93:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803b95:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803b9c:	00 00 00 
+  803b9f:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803ba5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ba9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803baf:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803bb6:	00 00 00 
+  803bb9:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803bbf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bc3:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bce:	c9                   	leave
+  803bcf:	c3                   	ret
+
+0000000000803bd0 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	48 83 ec 10          	sub    $0x10,%rsp
+  803bd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803bdc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803bdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803be3:	8b 40 0c             	mov    0xc(%rax),%eax
+  803be6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bed:	00 00 00 
+  803bf0:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803bf2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bf9:	00 00 00 
+  803bfc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bff:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803c02:	be 00 00 00 00       	mov    $0x0,%esi
+  803c07:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c0c:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+}
+  803c18:	c9                   	leave
+  803c19:	c3                   	ret
+
+0000000000803c1a <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803c1a:	55                   	push   %rbp
+  803c1b:	48 89 e5             	mov    %rsp,%rbp
+  803c1e:	48 83 ec 18          	sub    $0x18,%rsp
+  803c22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c26:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803c29:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803c2d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c30:	83 e0 03             	and    $0x3,%eax
+}
+  803c33:	c9                   	leave
+  803c34:	c3                   	ret
+
+0000000000803c35 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	48 83 ec 10          	sub    $0x10,%rsp
+  803c3d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803c41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c45:	48 89 c7             	mov    %rax,%rdi
+  803c48:	48 b8 31 11 80 00 00 	movabs $0x801131,%rax
+  803c4f:	00 00 00 
+  803c52:	ff d0                	call   *%rax
+  803c54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803c59:	7e 07                	jle    803c62 <remove+0x2d>
+    return -E_BAD_PATH;
+  803c5b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803c60:	eb 36                	jmp    803c98 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803c62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c66:	48 89 c6             	mov    %rax,%rsi
+  803c69:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803c70:	00 00 00 
+  803c73:	48 89 c7             	mov    %rax,%rdi
+  803c76:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  803c7d:	00 00 00 
+  803c80:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803c82:	be 00 00 00 00       	mov    $0x0,%esi
+  803c87:	bf 07 00 00 00       	mov    $0x7,%edi
+  803c8c:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+}
+  803c98:	c9                   	leave
+  803c99:	c3                   	ret
+
+0000000000803c9a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803c9e:	be 00 00 00 00       	mov    $0x0,%esi
+  803ca3:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ca8:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803caf:	00 00 00 
+  803cb2:	ff d0                	call   *%rax
+}
+  803cb4:	5d                   	pop    %rbp
+  803cb5:	c3                   	ret
+
+0000000000803cb6 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803cb6:	55                   	push   %rbp
+  803cb7:	48 89 e5             	mov    %rsp,%rbp
+  803cba:	48 83 ec 20          	sub    $0x20,%rsp
+  803cbe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  803cc7:	bf 09 00 00 00       	mov    $0x9,%edi
+  803ccc:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+  803cd8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cdb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cdf:	79 05                	jns    803ce6 <fs_stats+0x30>
+    return r;
+  803ce1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ce4:	eb 2a                	jmp    803d10 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803ce6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cea:	ba 68 00 00 00       	mov    $0x68,%edx
+  803cef:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803cf6:	00 00 00 
+  803cf9:	48 89 ce             	mov    %rcx,%rsi
+  803cfc:	48 89 c7             	mov    %rax,%rdi
+  803cff:	48 b8 75 17 80 00 00 	movabs $0x801775,%rax
+  803d06:	00 00 00 
+  803d09:	ff d0                	call   *%rax
+  return 0;
+  803d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d10:	c9                   	leave
+  803d11:	c3                   	ret
+
+0000000000803d12 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803d12:	55                   	push   %rbp
+  803d13:	48 89 e5             	mov    %rsp,%rbp
+  803d16:	48 83 ec 10          	sub    $0x10,%rsp
+  803d1a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803d1d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d24:	00 00 00 
+  803d27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d2a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  803d31:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d36:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803d3d:	00 00 00 
+  803d40:	ff d0                	call   *%rax
+}
+  803d42:	c9                   	leave
+  803d43:	c3                   	ret
+
+0000000000803d44 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803d44:	55                   	push   %rbp
+  803d45:	48 89 e5             	mov    %rsp,%rbp
+  803d48:	48 83 ec 10          	sub    $0x10,%rsp
+  803d4c:	89 f8                	mov    %edi,%eax
+  803d4e:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803d51:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803d55:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d5c:	00 00 00 
+  803d5f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803d61:	be 00 00 00 00       	mov    $0x0,%esi
+  803d66:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803d6b:	48 b8 ba 37 80 00 00 	movabs $0x8037ba,%rax
+  803d72:	00 00 00 
+  803d75:	ff d0                	call   *%rax
+}
+  803d77:	c9                   	leave
+  803d78:	c3                   	ret
+
+0000000000803d79 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803d79:	55                   	push   %rbp
+  803d7a:	48 89 e5             	mov    %rsp,%rbp
+  803d7d:	48 83 ec 10          	sub    $0x10,%rsp
+  803d81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803d85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d89:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803d8e:	48 89 c7             	mov    %rax,%rdi
+  803d91:	48 b8 9f 3d 80 00 00 	movabs $0x803d9f,%rax
+  803d98:	00 00 00 
+  803d9b:	ff d0                	call   *%rax
+}
+  803d9d:	c9                   	leave
+  803d9e:	c3                   	ret
+
+0000000000803d9f <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803d9f:	55                   	push   %rbp
+  803da0:	48 89 e5             	mov    %rsp,%rbp
+  803da3:	48 83 ec 50          	sub    $0x50,%rsp
+  803da7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803dab:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803daf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803db6:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803db7:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803dbc:	74 0a                	je     803dc8 <pipe_size+0x29>
+  803dbe:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803dc5:	00 
+  803dc6:	76 0a                	jbe    803dd2 <pipe_size+0x33>
+    return -E_INVAL;
+  803dc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803dcd:	e9 cc 02 00 00       	jmp    80409e <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803dd2:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803dd6:	48 89 c7             	mov    %rax,%rdi
+  803dd9:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+  803de5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803de8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dec:	0f 88 a8 02 00 00    	js     80409a <pipe_size+0x2fb>
+  803df2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df6:	ba 07 04 00 00       	mov    $0x407,%edx
+  803dfb:	48 89 c6             	mov    %rax,%rsi
+  803dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e03:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  803e0a:	00 00 00 
+  803e0d:	ff d0                	call   *%rax
+  803e0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e16:	0f 88 7e 02 00 00    	js     80409a <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803e1c:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803e20:	48 89 c7             	mov    %rax,%rdi
+  803e23:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  803e2a:	00 00 00 
+  803e2d:	ff d0                	call   *%rax
+  803e2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e36:	0f 88 43 02 00 00    	js     80407f <pipe_size+0x2e0>
+  803e3c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e40:	ba 07 04 00 00       	mov    $0x407,%edx
+  803e45:	48 89 c6             	mov    %rax,%rsi
+  803e48:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4d:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  803e54:	00 00 00 
+  803e57:	ff d0                	call   *%rax
+  803e59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e60:	0f 88 19 02 00 00    	js     80407f <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803e66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e6a:	48 89 c7             	mov    %rax,%rdi
+  803e6d:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  803e74:	00 00 00 
+  803e77:	ff d0                	call   *%rax
+  803e79:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803e7d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803e84:	00 
+  803e85:	e9 a2 00 00 00       	jmp    803f2c <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803e8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e8e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e92:	48 89 c2             	mov    %rax,%rdx
+  803e95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e99:	48 01 d0             	add    %rdx,%rax
+  803e9c:	ba 07 04 00 00       	mov    $0x407,%edx
+  803ea1:	48 89 c6             	mov    %rax,%rsi
+  803ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea9:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  803eb0:	00 00 00 
+  803eb3:	ff d0                	call   *%rax
+  803eb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803eb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ebc:	0f 88 37 01 00 00    	js     803ff9 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803ec2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ec6:	48 89 c7             	mov    %rax,%rdi
+  803ec9:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  803ed0:	00 00 00 
+  803ed3:	ff d0                	call   *%rax
+  803ed5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ed9:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803edd:	48 01 c2             	add    %rax,%rdx
+  803ee0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ee4:	48 c1 e0 0c          	shl    $0xc,%rax
+  803ee8:	48 89 c1             	mov    %rax,%rcx
+  803eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eef:	48 01 c8             	add    %rcx,%rax
+  803ef2:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803ef8:	48 89 d1             	mov    %rdx,%rcx
+  803efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f00:	48 89 c6             	mov    %rax,%rsi
+  803f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f08:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  803f0f:	00 00 00 
+  803f12:	ff d0                	call   *%rax
+  803f14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f1b:	79 0a                	jns    803f27 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803f1d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803f22:	e9 d3 00 00 00       	jmp    803ffa <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803f27:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803f2c:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803f33:	00 
+  803f34:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803f38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f3c:	48 01 d0             	add    %rdx,%rax
+  803f3f:	48 83 c0 1f          	add    $0x1f,%rax
+  803f43:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803f47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f50:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803f54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f58:	48 29 d0             	sub    %rdx,%rax
+  803f5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f5f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803f63:	0f 82 21 ff ff ff    	jb     803e8a <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803f69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f6d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803f71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f75:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803f79:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803f7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f81:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803f88:	00 00 00 
+  803f8b:	8b 12                	mov    (%rdx),%edx
+  803f8d:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803f8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f93:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803f9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f9e:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803fa5:	00 00 00 
+  803fa8:	8b 12                	mov    (%rdx),%edx
+  803faa:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803fac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fb0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803fb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fbb:	48 89 c7             	mov    %rax,%rdi
+  803fbe:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  803fc5:	00 00 00 
+  803fc8:	ff d0                	call   *%rax
+  803fca:	89 c2                	mov    %eax,%edx
+  803fcc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803fd0:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803fd2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fd6:	48 89 c7             	mov    %rax,%rdi
+  803fd9:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  803fe0:	00 00 00 
+  803fe3:	ff d0                	call   *%rax
+  803fe5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803fe9:	48 83 c2 04          	add    $0x4,%rdx
+  803fed:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff4:	e9 a5 00 00 00       	jmp    80409e <pipe_size+0x2ff>
+      goto err2;
+  803ff9:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803ffa:	eb 58                	jmp    804054 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803ffc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804000:	48 c1 e0 0c          	shl    $0xc,%rax
+  804004:	48 89 c2             	mov    %rax,%rdx
+  804007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80400b:	48 01 d0             	add    %rdx,%rax
+  80400e:	48 89 c6             	mov    %rax,%rsi
+  804011:	bf 00 00 00 00       	mov    $0x0,%edi
+  804016:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  80401d:	00 00 00 
+  804020:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804022:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804026:	48 89 c7             	mov    %rax,%rdi
+  804029:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  804030:	00 00 00 
+  804033:	ff d0                	call   *%rax
+  804035:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804039:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80403d:	48 01 d0             	add    %rdx,%rax
+  804040:	48 89 c6             	mov    %rax,%rsi
+  804043:	bf 00 00 00 00       	mov    $0x0,%edi
+  804048:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804054:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804058:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80405c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804060:	48 85 c0             	test   %rax,%rax
+  804063:	75 97                	jne    803ffc <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804065:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804069:	48 89 c6             	mov    %rax,%rsi
+  80406c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804071:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  804078:	00 00 00 
+  80407b:	ff d0                	call   *%rax
+  80407d:	eb 01                	jmp    804080 <pipe_size+0x2e1>
+    goto err1;
+  80407f:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804080:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804084:	48 89 c6             	mov    %rax,%rsi
+  804087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408c:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+  804098:	eb 01                	jmp    80409b <pipe_size+0x2fc>
+    goto err;
+  80409a:	90                   	nop
+err:
+  return r;
+  80409b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80409e:	c9                   	leave
+  80409f:	c3                   	ret
+
+00000000008040a0 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8040a0:	55                   	push   %rbp
+  8040a1:	48 89 e5             	mov    %rsp,%rbp
+  8040a4:	53                   	push   %rbx
+  8040a5:	48 83 ec 28          	sub    $0x28,%rsp
+  8040a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040ad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8040b1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8040b8:	00 00 00 
+  8040bb:	8b 40 04             	mov    0x4(%rax),%eax
+  8040be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040c3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8040ca:	00 00 00 
+  8040cd:	48 98                	cltq
+  8040cf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8040d6:	48 01 d0             	add    %rdx,%rax
+  8040d9:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8040df:	8b 00                	mov    (%rax),%eax
+  8040e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8040e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e8:	48 89 c7             	mov    %rax,%rdi
+  8040eb:	48 b8 ab 50 80 00 00 	movabs $0x8050ab,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+  8040f7:	89 c3                	mov    %eax,%ebx
+  8040f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040fd:	48 89 c7             	mov    %rax,%rdi
+  804100:	48 b8 ab 50 80 00 00 	movabs $0x8050ab,%rax
+  804107:	00 00 00 
+  80410a:	ff d0                	call   *%rax
+  80410c:	39 c3                	cmp    %eax,%ebx
+  80410e:	0f 94 c0             	sete   %al
+  804111:	0f b6 c0             	movzbl %al,%eax
+  804114:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804117:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80411e:	00 00 00 
+  804121:	8b 40 04             	mov    0x4(%rax),%eax
+  804124:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804129:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804130:	00 00 00 
+  804133:	48 98                	cltq
+  804135:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80413c:	48 01 d0             	add    %rdx,%rax
+  80413f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804145:	8b 00                	mov    (%rax),%eax
+  804147:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80414a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80414d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804150:	75 05                	jne    804157 <_pipeisclosed+0xb7>
+      return ret;
+  804152:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804155:	eb 68                	jmp    8041bf <_pipeisclosed+0x11f>
+    if (n != nn)
+  804157:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80415d:	0f 84 4e ff ff ff    	je     8040b1 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804163:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80416a:	00 00 00 
+  80416d:	8b 40 04             	mov    0x4(%rax),%eax
+  804170:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804175:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80417c:	00 00 00 
+  80417f:	48 98                	cltq
+  804181:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804188:	48 01 d0             	add    %rdx,%rax
+  80418b:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804191:	8b 10                	mov    (%rax),%edx
+  804193:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804196:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804199:	89 c6                	mov    %eax,%esi
+  80419b:	48 b8 c8 57 80 00 00 	movabs $0x8057c8,%rax
+  8041a2:	00 00 00 
+  8041a5:	48 89 c7             	mov    %rax,%rdi
+  8041a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ad:	49 b8 82 02 80 00 00 	movabs $0x800282,%r8
+  8041b4:	00 00 00 
+  8041b7:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8041ba:	e9 f2 fe ff ff       	jmp    8040b1 <_pipeisclosed+0x11>
+  }
+}
+  8041bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041c3:	c9                   	leave
+  8041c4:	c3                   	ret
+
+00000000008041c5 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8041c5:	55                   	push   %rbp
+  8041c6:	48 89 e5             	mov    %rsp,%rbp
+  8041c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8041cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041d0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8041d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041d7:	48 89 d6             	mov    %rdx,%rsi
+  8041da:	89 c7                	mov    %eax,%edi
+  8041dc:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  8041e3:	00 00 00 
+  8041e6:	ff d0                	call   *%rax
+  8041e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041ef:	79 05                	jns    8041f6 <pipeisclosed+0x31>
+    return r;
+  8041f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041f4:	eb 31                	jmp    804227 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8041f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041fa:	48 89 c7             	mov    %rax,%rdi
+  8041fd:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  804204:	00 00 00 
+  804207:	ff d0                	call   *%rax
+  804209:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80420d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804211:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804215:	48 89 d6             	mov    %rdx,%rsi
+  804218:	48 89 c7             	mov    %rax,%rdi
+  80421b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  804222:	00 00 00 
+  804225:	ff d0                	call   *%rax
+}
+  804227:	c9                   	leave
+  804228:	c3                   	ret
+
+0000000000804229 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804229:	55                   	push   %rbp
+  80422a:	48 89 e5             	mov    %rsp,%rbp
+  80422d:	48 83 ec 10          	sub    $0x10,%rsp
+  804231:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804235:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804239:	8b 40 18             	mov    0x18(%rax),%eax
+  80423c:	8d 50 01             	lea    0x1(%rax),%edx
+  80423f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804243:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804246:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80424a:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80424d:	85 c0                	test   %eax,%eax
+  80424f:	74 27                	je     804278 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804251:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804255:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80425c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804260:	48 83 c0 18          	add    $0x18,%rax
+  804264:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804269:	48 89 c7             	mov    %rax,%rdi
+  80426c:	48 b8 fb 23 80 00 00 	movabs $0x8023fb,%rax
+  804273:	00 00 00 
+  804276:	ff d0                	call   *%rax
+  }
+}
+  804278:	90                   	nop
+  804279:	c9                   	leave
+  80427a:	c3                   	ret
+
+000000000080427b <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80427b:	55                   	push   %rbp
+  80427c:	48 89 e5             	mov    %rsp,%rbp
+  80427f:	48 83 ec 10          	sub    $0x10,%rsp
+  804283:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804287:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80428a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80428e:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804295:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804299:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80429d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042a0:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8042a7:	89 c6                	mov    %eax,%esi
+  8042a9:	48 89 cf             	mov    %rcx,%rdi
+  8042ac:	48 b8 ac 23 80 00 00 	movabs $0x8023ac,%rax
+  8042b3:	00 00 00 
+  8042b6:	ff d0                	call   *%rax
+}
+  8042b8:	90                   	nop
+  8042b9:	c9                   	leave
+  8042ba:	c3                   	ret
+
+00000000008042bb <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042bb:	55                   	push   %rbp
+  8042bc:	48 89 e5             	mov    %rsp,%rbp
+  8042bf:	48 83 ec 70          	sub    $0x70,%rsp
+  8042c3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8042c7:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042cb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042cf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042d3:	48 89 c7             	mov    %rax,%rdi
+  8042d6:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+  8042e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8042e6:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8042eb:	75 0a                	jne    8042f7 <devpipe_read+0x3c>
+    return 0;
+  8042ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f2:	e9 63 01 00 00       	jmp    80445a <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8042f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042fb:	8b 40 18             	mov    0x18(%rax),%eax
+  8042fe:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804301:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804305:	48 8b 10             	mov    (%rax),%rdx
+  804308:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80430c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804310:	48 39 c2             	cmp    %rax,%rdx
+  804313:	75 42                	jne    804357 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804315:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804319:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80431d:	48 89 d6             	mov    %rdx,%rsi
+  804320:	48 89 c7             	mov    %rax,%rdi
+  804323:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  80432a:	00 00 00 
+  80432d:	ff d0                	call   *%rax
+  80432f:	85 c0                	test   %eax,%eax
+  804331:	74 0a                	je     80433d <devpipe_read+0x82>
+      return 0;
+  804333:	b8 00 00 00 00       	mov    $0x0,%eax
+  804338:	e9 1d 01 00 00       	jmp    80445a <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80433d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804344:	89 d6                	mov    %edx,%esi
+  804346:	48 89 c7             	mov    %rax,%rdi
+  804349:	48 b8 7b 42 80 00 00 	movabs $0x80427b,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804355:	eb a0                	jmp    8042f7 <devpipe_read+0x3c>
+      break;
+  804357:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804358:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80435c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804360:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804364:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80436c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804374:	48 8b 00             	mov    (%rax),%rax
+  804377:	48 29 c2             	sub    %rax,%rdx
+  80437a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80437e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804382:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804386:	48 39 c2             	cmp    %rax,%rdx
+  804389:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80438d:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804395:	48 8b 00             	mov    (%rax),%rax
+  804398:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80439c:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8043a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a5:	48 f7 f1             	div    %rcx
+  8043a8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8043ac:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8043b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043b8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043bc:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8043c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8043c8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043cc:	48 39 c2             	cmp    %rax,%rdx
+  8043cf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043d3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8043d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043db:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8043df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043e3:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8043e7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ef:	48 89 ce             	mov    %rcx,%rsi
+  8043f2:	48 89 c7             	mov    %rax,%rdi
+  8043f5:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  8043fc:	00 00 00 
+  8043ff:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804401:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804405:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804409:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80440d:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804411:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804415:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804419:	48 01 d1             	add    %rdx,%rcx
+  80441c:	48 89 c2             	mov    %rax,%rdx
+  80441f:	48 89 cf             	mov    %rcx,%rdi
+  804422:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  804429:	00 00 00 
+  80442c:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80442e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804432:	48 8b 10             	mov    (%rax),%rdx
+  804435:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804439:	48 01 c2             	add    %rax,%rdx
+  80443c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804440:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804447:	48 89 c7             	mov    %rax,%rdi
+  80444a:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  804451:	00 00 00 
+  804454:	ff d0                	call   *%rax
+  return n;
+  804456:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80445a:	c9                   	leave
+  80445b:	c3                   	ret
+
+000000000080445c <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80445c:	55                   	push   %rbp
+  80445d:	48 89 e5             	mov    %rsp,%rbp
+  804460:	48 83 ec 70          	sub    $0x70,%rsp
+  804464:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804468:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80446c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804470:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804474:	48 89 c7             	mov    %rax,%rdi
+  804477:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  80447e:	00 00 00 
+  804481:	ff d0                	call   *%rax
+  804483:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804487:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80448b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80448f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804496:	00 
+  804497:	e9 b8 01 00 00       	jmp    804654 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80449c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044a0:	8b 40 18             	mov    0x18(%rax),%eax
+  8044a3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8044a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044aa:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8044ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044b2:	48 8b 00             	mov    (%rax),%rax
+  8044b5:	48 29 c2             	sub    %rax,%rdx
+  8044b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044bc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8044c0:	48 39 c2             	cmp    %rax,%rdx
+  8044c3:	75 4d                	jne    804512 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8044c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044c9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044cd:	48 89 d6             	mov    %rdx,%rsi
+  8044d0:	48 89 c7             	mov    %rax,%rdi
+  8044d3:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8044da:	00 00 00 
+  8044dd:	ff d0                	call   *%rax
+  8044df:	85 c0                	test   %eax,%eax
+  8044e1:	74 0a                	je     8044ed <devpipe_write+0x91>
+        return 0;
+  8044e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e8:	e9 79 01 00 00       	jmp    804666 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8044ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8044f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044f4:	89 d6                	mov    %edx,%esi
+  8044f6:	48 89 c7             	mov    %rax,%rdi
+  8044f9:	48 b8 7b 42 80 00 00 	movabs $0x80427b,%rax
+  804500:	00 00 00 
+  804503:	ff d0                	call   *%rax
+      m = 0;
+  804505:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80450c:	00 
+      continue;
+  80450d:	e9 3a 01 00 00       	jmp    80464c <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804512:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804516:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80451a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80451e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804522:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804526:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80452a:	48 8b 08             	mov    (%rax),%rcx
+  80452d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804531:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804535:	48 29 c1             	sub    %rax,%rcx
+  804538:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80453c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804540:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804544:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804548:	48 39 c2             	cmp    %rax,%rdx
+  80454b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80454f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804557:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80455b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80455f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804563:	ba 00 00 00 00       	mov    $0x0,%edx
+  804568:	48 f7 f1             	div    %rcx
+  80456b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  80456f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804573:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804577:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80457b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80457f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804583:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804587:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80458b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80458f:	48 39 c2             	cmp    %rax,%rdx
+  804592:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804596:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80459a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80459e:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8045a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045a6:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8045aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045ae:	48 01 d1             	add    %rdx,%rcx
+  8045b1:	48 89 c2             	mov    %rax,%rdx
+  8045b4:	48 89 cf             	mov    %rcx,%rdi
+  8045b7:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  8045be:	00 00 00 
+  8045c1:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8045c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045cb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8045cf:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8045d3:	73 4d                	jae    804622 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8045d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045d9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045e1:	48 29 c2             	sub    %rax,%rdx
+  8045e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045e8:	48 01 c2             	add    %rax,%rdx
+  8045eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045ef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045f3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8045f7:	48 89 c1             	mov    %rax,%rcx
+  8045fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045fe:	48 01 c1             	add    %rax,%rcx
+  804601:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804605:	48 01 c1             	add    %rax,%rcx
+  804608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80460c:	48 83 c0 20          	add    $0x20,%rax
+  804610:	48 89 ce             	mov    %rcx,%rsi
+  804613:	48 89 c7             	mov    %rax,%rdi
+  804616:	48 b8 7b 19 80 00 00 	movabs $0x80197b,%rax
+  80461d:	00 00 00 
+  804620:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804622:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804626:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80462a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80462e:	48 01 c2             	add    %rax,%rdx
+  804631:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804635:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804639:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80463d:	48 89 c7             	mov    %rax,%rdi
+  804640:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  804647:	00 00 00 
+  80464a:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80464c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804650:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804658:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80465c:	0f 82 3a fe ff ff    	jb     80449c <devpipe_write+0x40>
+  }
+
+  return i;
+  804662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804666:	c9                   	leave
+  804667:	c3                   	ret
+
+0000000000804668 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804668:	55                   	push   %rbp
+  804669:	48 89 e5             	mov    %rsp,%rbp
+  80466c:	48 83 ec 40          	sub    $0x40,%rsp
+  804670:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804674:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804677:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80467b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80467f:	48 89 c7             	mov    %rax,%rdi
+  804682:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  804689:	00 00 00 
+  80468c:	ff d0                	call   *%rax
+  80468e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804692:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804699:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80469d:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8046a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a5:	48 89 d6             	mov    %rdx,%rsi
+  8046a8:	48 89 c7             	mov    %rax,%rdi
+  8046ab:	48 b8 43 33 80 00 00 	movabs $0x803343,%rax
+  8046b2:	00 00 00 
+  8046b5:	ff d0                	call   *%rax
+  8046b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046be:	79 08                	jns    8046c8 <devpipe_poll+0x60>
+    return r;
+  8046c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c3:	e9 85 00 00 00       	jmp    80474d <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8046c8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8046cb:	83 e0 01             	and    $0x1,%eax
+  8046ce:	85 c0                	test   %eax,%eax
+  8046d0:	74 18                	je     8046ea <devpipe_poll+0x82>
+  8046d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d6:	48 8b 10             	mov    (%rax),%rdx
+  8046d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046e1:	48 39 c2             	cmp    %rax,%rdx
+  8046e4:	74 04                	je     8046ea <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8046e6:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8046ea:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8046ed:	83 e0 02             	and    $0x2,%eax
+  8046f0:	85 c0                	test   %eax,%eax
+  8046f2:	74 23                	je     804717 <devpipe_poll+0xaf>
+  8046f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046f8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8046fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804700:	48 8b 00             	mov    (%rax),%rax
+  804703:	48 29 c2             	sub    %rax,%rdx
+  804706:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80470a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80470e:	48 39 c2             	cmp    %rax,%rdx
+  804711:	73 04                	jae    804717 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804713:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804717:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80471b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80471f:	48 89 d6             	mov    %rdx,%rsi
+  804722:	48 89 c7             	mov    %rax,%rdi
+  804725:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  80472c:	00 00 00 
+  80472f:	ff d0                	call   *%rax
+  804731:	85 c0                	test   %eax,%eax
+  804733:	74 04                	je     804739 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804735:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804739:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80473d:	75 0b                	jne    80474a <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80473f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804743:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80474a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80474d:	c9                   	leave
+  80474e:	c3                   	ret
+
+000000000080474f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80474f:	55                   	push   %rbp
+  804750:	48 89 e5             	mov    %rsp,%rbp
+  804753:	48 83 ec 20          	sub    $0x20,%rsp
+  804757:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80475b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80475f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804763:	48 89 c7             	mov    %rax,%rdi
+  804766:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  80476d:	00 00 00 
+  804770:	ff d0                	call   *%rax
+  804772:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804776:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80477a:	48 ba f9 57 80 00 00 	movabs $0x8057f9,%rdx
+  804781:	00 00 00 
+  804784:	48 89 d6             	mov    %rdx,%rsi
+  804787:	48 89 c7             	mov    %rax,%rdi
+  80478a:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  804791:	00 00 00 
+  804794:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804796:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80479a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80479e:	89 c1                	mov    %eax,%ecx
+  8047a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047a4:	48 8b 00             	mov    (%rax),%rax
+  8047a7:	89 c2                	mov    %eax,%edx
+  8047a9:	89 c8                	mov    %ecx,%eax
+  8047ab:	29 d0                	sub    %edx,%eax
+  8047ad:	89 c2                	mov    %eax,%edx
+  8047af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047b3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8047b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047bd:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8047c4:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8047c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047cb:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  8047d2:	00 00 00 
+  8047d5:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8047dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047e1:	c9                   	leave
+  8047e2:	c3                   	ret
+
+00000000008047e3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8047e3:	55                   	push   %rbp
+  8047e4:	48 89 e5             	mov    %rsp,%rbp
+  8047e7:	48 83 ec 40          	sub    $0x40,%rsp
+  8047eb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8047ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047f3:	48 89 c7             	mov    %rax,%rdi
+  8047f6:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  8047fd:	00 00 00 
+  804800:	ff d0                	call   *%rax
+  804802:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804806:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80480d:	00 
+  80480e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804812:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804816:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80481a:	48 01 d0             	add    %rdx,%rax
+  80481d:	48 83 c0 1f          	add    $0x1f,%rax
+  804821:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804825:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80482e:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804832:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804836:	48 29 d0             	sub    %rdx,%rax
+  804839:	48 c1 e8 0c          	shr    $0xc,%rax
+  80483d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804841:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804845:	48 89 c6             	mov    %rax,%rsi
+  804848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80484d:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  804854:	00 00 00 
+  804857:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804859:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80485d:	48 89 c7             	mov    %rax,%rdi
+  804860:	48 b8 29 42 80 00 00 	movabs $0x804229,%rax
+  804867:	00 00 00 
+  80486a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80486c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804870:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804874:	eb 2f                	jmp    8048a5 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804876:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80487a:	48 83 e8 01          	sub    $0x1,%rax
+  80487e:	48 c1 e0 0c          	shl    $0xc,%rax
+  804882:	48 89 c2             	mov    %rax,%rdx
+  804885:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804889:	48 01 d0             	add    %rdx,%rax
+  80488c:	48 89 c6             	mov    %rax,%rsi
+  80488f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804894:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  80489b:	00 00 00 
+  80489e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8048a0:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8048a5:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8048aa:	77 ca                	ja     804876 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8048ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048b0:	48 89 c6             	mov    %rax,%rsi
+  8048b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b8:	48 b8 b8 20 80 00 00 	movabs $0x8020b8,%rax
+  8048bf:	00 00 00 
+  8048c2:	ff d0                	call   *%rax
+}
+  8048c4:	c9                   	leave
+  8048c5:	c3                   	ret
+
+00000000008048c6 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8048c6:	55                   	push   %rbp
+  8048c7:	48 89 e5             	mov    %rsp,%rbp
+  8048ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8048ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8048d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d5:	75 10                	jne    8048e7 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8048d7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8048de:	00 00 00 
+  8048e1:	8b 00                	mov    (%rax),%eax
+  8048e3:	48 98                	cltq
+  8048e5:	eb 05                	jmp    8048ec <vsyscall+0x26>
+  }
+  return 0;
+  8048e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048ec:	c9                   	leave
+  8048ed:	c3                   	ret
+
+00000000008048ee <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8048ee:	55                   	push   %rbp
+  8048ef:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8048f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f7:	48 b8 c6 48 80 00 00 	movabs $0x8048c6,%rax
+  8048fe:	00 00 00 
+  804901:	ff d0                	call   *%rax
+}
+  804903:	5d                   	pop    %rbp
+  804904:	c3                   	ret
+
+0000000000804905 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804905:	55                   	push   %rbp
+  804906:	48 89 e5             	mov    %rsp,%rbp
+  804909:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80490d:	0f 31                	rdtsc
+  80490f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804912:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804915:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804918:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80491b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80491f:	48 09 d0             	or     %rdx,%rax
+  804922:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804926:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80492a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80492e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804935:	00 00 00 
+  804938:	8b 40 08             	mov    0x8(%rax),%eax
+  80493b:	48 98                	cltq
+  80493d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804941:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80494a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80494e:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804955:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804959:	ba 00 00 00 00       	mov    $0x0,%edx
+  80495e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804962:	48 89 d0             	mov    %rdx,%rax
+  804965:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80496c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804971:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804975:	48 01 c8             	add    %rcx,%rax
+}
+  804978:	c9                   	leave
+  804979:	c3                   	ret
+
+000000000080497a <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80497a:	55                   	push   %rbp
+  80497b:	48 89 e5             	mov    %rsp,%rbp
+  80497e:	48 83 ec 20          	sub    $0x20,%rsp
+  804982:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804985:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804988:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  80498b:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  80498f:	be 01 00 00 00       	mov    $0x1,%esi
+  804994:	48 89 c7             	mov    %rax,%rdi
+  804997:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  80499e:	00 00 00 
+  8049a1:	ff d0                	call   *%rax
+}
+  8049a3:	90                   	nop
+  8049a4:	c9                   	leave
+  8049a5:	c3                   	ret
+
+00000000008049a6 <getchar>:
+
+int
+getchar(void) {
+  8049a6:	55                   	push   %rbp
+  8049a7:	48 89 e5             	mov    %rsp,%rbp
+  8049aa:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8049ae:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8049b2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8049b7:	48 89 c6             	mov    %rax,%rsi
+  8049ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049bf:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  8049c6:	00 00 00 
+  8049c9:	ff d0                	call   *%rax
+  8049cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8049ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049d2:	79 05                	jns    8049d9 <getchar+0x33>
+    return r;
+  8049d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049d7:	eb 14                	jmp    8049ed <getchar+0x47>
+  if (r < 1)
+  8049d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049dd:	7f 07                	jg     8049e6 <getchar+0x40>
+    return -E_EOF;
+  8049df:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8049e4:	eb 07                	jmp    8049ed <getchar+0x47>
+  return c;
+  8049e6:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8049ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8049ed:	c9                   	leave
+  8049ee:	c3                   	ret
+
+00000000008049ef <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8049ef:	55                   	push   %rbp
+  8049f0:	48 89 e5             	mov    %rsp,%rbp
+  8049f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8049f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8049fa:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8049fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a01:	48 89 d6             	mov    %rdx,%rsi
+  804a04:	89 c7                	mov    %eax,%edi
+  804a06:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  804a0d:	00 00 00 
+  804a10:	ff d0                	call   *%rax
+  804a12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a15:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a19:	79 05                	jns    804a20 <iscons+0x31>
+    return r;
+  804a1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a1e:	eb 1a                	jmp    804a3a <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804a20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a24:	8b 10                	mov    (%rax),%edx
+  804a26:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804a2d:	00 00 00 
+  804a30:	8b 00                	mov    (%rax),%eax
+  804a32:	39 c2                	cmp    %eax,%edx
+  804a34:	0f 94 c0             	sete   %al
+  804a37:	0f b6 c0             	movzbl %al,%eax
+}
+  804a3a:	c9                   	leave
+  804a3b:	c3                   	ret
+
+0000000000804a3c <opencons>:
+
+int
+opencons(void) {
+  804a3c:	55                   	push   %rbp
+  804a3d:	48 89 e5             	mov    %rsp,%rbp
+  804a40:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804a44:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804a48:	48 89 c7             	mov    %rax,%rdi
+  804a4b:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  804a52:	00 00 00 
+  804a55:	ff d0                	call   *%rax
+  804a57:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a5a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a5e:	79 05                	jns    804a65 <opencons+0x29>
+    return r;
+  804a60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a63:	eb 66                	jmp    804acb <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804a65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a69:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a6e:	48 89 c6             	mov    %rax,%rsi
+  804a71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a76:	48 b8 00 20 80 00 00 	movabs $0x802000,%rax
+  804a7d:	00 00 00 
+  804a80:	ff d0                	call   *%rax
+  804a82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a85:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a89:	79 05                	jns    804a90 <opencons+0x54>
+    return r;
+  804a8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a8e:	eb 3b                	jmp    804acb <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a94:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804a9b:	00 00 00 
+  804a9e:	8b 12                	mov    (%rdx),%edx
+  804aa0:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aa6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804aad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ab1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804ab8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804abc:	48 89 c7             	mov    %rax,%rdi
+  804abf:	48 b8 4d 28 80 00 00 	movabs $0x80284d,%rax
+  804ac6:	00 00 00 
+  804ac9:	ff d0                	call   *%rax
+}
+  804acb:	c9                   	leave
+  804acc:	c3                   	ret
+
+0000000000804acd <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804acd:	55                   	push   %rbp
+  804ace:	48 89 e5             	mov    %rsp,%rbp
+  804ad1:	48 83 ec 20          	sub    $0x20,%rsp
+  804ad5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ad8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804adb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804adf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ae2:	48 89 d6             	mov    %rdx,%rsi
+  804ae5:	89 c7                	mov    %eax,%edi
+  804ae7:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  804aee:	00 00 00 
+  804af1:	ff d0                	call   *%rax
+  804af3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804af6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804afa:	79 05                	jns    804b01 <consmode+0x34>
+    return r;
+  804afc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804aff:	eb 34                	jmp    804b35 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b05:	8b 10                	mov    (%rax),%edx
+  804b07:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804b0e:	00 00 00 
+  804b11:	8b 00                	mov    (%rax),%eax
+  804b13:	39 c2                	cmp    %eax,%edx
+  804b15:	74 07                	je     804b1e <consmode+0x51>
+    return -E_INVAL;
+  804b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b1c:	eb 17                	jmp    804b35 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b22:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804b28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b2c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b2f:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804b32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b35:	c9                   	leave
+  804b36:	c3                   	ret
+
+0000000000804b37 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804b37:	55                   	push   %rbp
+  804b38:	48 89 e5             	mov    %rsp,%rbp
+  804b3b:	48 83 ec 20          	sub    $0x20,%rsp
+  804b3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804b43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804b47:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804b4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b4f:	8b 50 0c             	mov    0xc(%rax),%edx
+  804b52:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b5a:	48 89 ce             	mov    %rcx,%rsi
+  804b5d:	48 89 c7             	mov    %rax,%rdi
+  804b60:	48 b8 5a 23 80 00 00 	movabs $0x80235a,%rax
+  804b67:	00 00 00 
+  804b6a:	ff d0                	call   *%rax
+  804b6c:	48 98                	cltq
+}
+  804b6e:	c9                   	leave
+  804b6f:	c3                   	ret
+
+0000000000804b70 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804b70:	55                   	push   %rbp
+  804b71:	48 89 e5             	mov    %rsp,%rbp
+  804b74:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804b7b:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804b82:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804b89:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804b90:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804b97:	eb 74                	jmp    804c0d <devcons_write+0x9d>
+    m = n - tot;
+  804b99:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804ba0:	89 c2                	mov    %eax,%edx
+  804ba2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ba5:	29 c2                	sub    %eax,%edx
+  804ba7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804baa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804bad:	83 f8 7f             	cmp    $0x7f,%eax
+  804bb0:	76 07                	jbe    804bb9 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804bb2:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804bb9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804bbc:	48 63 d0             	movslq %eax,%rdx
+  804bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bc2:	48 63 c8             	movslq %eax,%rcx
+  804bc5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804bcc:	48 01 c1             	add    %rax,%rcx
+  804bcf:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804bd6:	48 89 ce             	mov    %rcx,%rsi
+  804bd9:	48 89 c7             	mov    %rax,%rdi
+  804bdc:	48 b8 75 17 80 00 00 	movabs $0x801775,%rax
+  804be3:	00 00 00 
+  804be6:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804be8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804beb:	48 63 d0             	movslq %eax,%rdx
+  804bee:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804bf5:	48 89 d6             	mov    %rdx,%rsi
+  804bf8:	48 89 c7             	mov    %rax,%rdi
+  804bfb:	48 b8 e9 1d 80 00 00 	movabs $0x801de9,%rax
+  804c02:	00 00 00 
+  804c05:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804c07:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804c0a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804c0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c10:	48 98                	cltq
+  804c12:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804c19:	0f 82 7a ff ff ff    	jb     804b99 <devcons_write+0x29>
+  }
+  return tot;
+  804c1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c22:	48 98                	cltq
+}
+  804c24:	c9                   	leave
+  804c25:	c3                   	ret
+
+0000000000804c26 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804c26:	55                   	push   %rbp
+  804c27:	48 89 e5             	mov    %rsp,%rbp
+  804c2a:	48 83 ec 08          	sub    $0x8,%rsp
+  804c2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c37:	c9                   	leave
+  804c38:	c3                   	ret
+
+0000000000804c39 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804c39:	55                   	push   %rbp
+  804c3a:	48 89 e5             	mov    %rsp,%rbp
+  804c3d:	48 83 ec 10          	sub    $0x10,%rsp
+  804c41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c4d:	48 ba 05 58 80 00 00 	movabs $0x805805,%rdx
+  804c54:	00 00 00 
+  804c57:	48 89 d6             	mov    %rdx,%rsi
+  804c5a:	48 89 c7             	mov    %rax,%rdi
+  804c5d:	48 b8 32 12 80 00 00 	movabs $0x801232,%rax
+  804c64:	00 00 00 
+  804c67:	ff d0                	call   *%rax
+  return 0;
+  804c69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c6e:	c9                   	leave
+  804c6f:	c3                   	ret
+
+0000000000804c70 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804c70:	55                   	push   %rbp
+  804c71:	48 89 e5             	mov    %rsp,%rbp
+  804c74:	48 83 ec 30          	sub    $0x30,%rsp
+  804c78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c7c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804c7f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804c83:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804c8a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c8d:	83 e0 02             	and    $0x2,%eax
+  804c90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804c93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c97:	8b 40 0c             	mov    0xc(%rax),%eax
+  804c9a:	83 f8 01             	cmp    $0x1,%eax
+  804c9d:	75 04                	jne    804ca3 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804c9f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804ca3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ca6:	83 e0 01             	and    $0x1,%eax
+  804ca9:	85 c0                	test   %eax,%eax
+  804cab:	74 44                	je     804cf1 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804cad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804cb5:	89 c2                	mov    %eax,%edx
+  804cb7:	be 00 00 00 00       	mov    $0x0,%esi
+  804cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cc1:	48 b8 48 24 80 00 00 	movabs $0x802448,%rax
+  804cc8:	00 00 00 
+  804ccb:	ff d0                	call   *%rax
+  804ccd:	83 f8 01             	cmp    $0x1,%eax
+  804cd0:	75 06                	jne    804cd8 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804cd2:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804cd6:	eb 19                	jmp    804cf1 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804cd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cdc:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804ce2:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804ce5:	89 c2                	mov    %eax,%edx
+  804ce7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ceb:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804cf1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804cf4:	c9                   	leave
+  804cf5:	c3                   	ret
+
+0000000000804cf6 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804cf6:	55                   	push   %rbp
+  804cf7:	48 89 e5             	mov    %rsp,%rbp
+  804cfa:	53                   	push   %rbx
+  804cfb:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804d02:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804d09:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804d0f:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804d16:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804d1d:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804d24:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804d2b:	84 c0                	test   %al,%al
+  804d2d:	74 23                	je     804d52 <_panic+0x5c>
+  804d2f:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804d36:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804d3a:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804d3e:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804d42:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804d46:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804d4a:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804d4e:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804d52:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804d59:	00 00 00 
+  804d5c:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804d63:	00 00 00 
+  804d66:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d6a:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804d71:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804d78:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804d7f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804d86:	00 00 00 
+  804d89:	48 8b 18             	mov    (%rax),%rbx
+  804d8c:	48 b8 87 1f 80 00 00 	movabs $0x801f87,%rax
+  804d93:	00 00 00 
+  804d96:	ff d0                	call   *%rax
+  804d98:	89 c6                	mov    %eax,%esi
+  804d9a:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804da0:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804da7:	41 89 d0             	mov    %edx,%r8d
+  804daa:	48 89 c1             	mov    %rax,%rcx
+  804dad:	48 89 da             	mov    %rbx,%rdx
+  804db0:	48 b8 10 58 80 00 00 	movabs $0x805810,%rax
+  804db7:	00 00 00 
+  804dba:	48 89 c7             	mov    %rax,%rdi
+  804dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc2:	49 b9 82 02 80 00 00 	movabs $0x800282,%r9
+  804dc9:	00 00 00 
+  804dcc:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804dcf:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804dd6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804ddd:	48 89 d6             	mov    %rdx,%rsi
+  804de0:	48 89 c7             	mov    %rax,%rdi
+  804de3:	48 b8 f7 01 80 00 00 	movabs $0x8001f7,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+  cprintf("\n");
+  804def:	48 b8 33 58 80 00 00 	movabs $0x805833,%rax
+  804df6:	00 00 00 
+  804df9:	48 89 c7             	mov    %rax,%rdi
+  804dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e01:	48 ba 82 02 80 00 00 	movabs $0x800282,%rdx
+  804e08:	00 00 00 
+  804e0b:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804e0d:	cc                   	int3
+  804e0e:	eb fd                	jmp    804e0d <_panic+0x117>
+
+0000000000804e10 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804e10:	55                   	push   %rbp
+  804e11:	48 89 e5             	mov    %rsp,%rbp
+  804e14:	48 83 ec 20          	sub    $0x20,%rsp
+  804e18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804e20:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804e24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e28:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804e2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e30:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804e37:	48 89 c7             	mov    %rax,%rdi
+  804e3a:	48 b8 48 4e 80 00 00 	movabs $0x804e48,%rax
+  804e41:	00 00 00 
+  804e44:	ff d0                	call   *%rax
+}
+  804e46:	c9                   	leave
+  804e47:	c3                   	ret
+
+0000000000804e48 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804e48:	55                   	push   %rbp
+  804e49:	48 89 e5             	mov    %rsp,%rbp
+  804e4c:	48 83 ec 30          	sub    $0x30,%rsp
+  804e50:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e54:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804e58:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804e5c:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804e60:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804e65:	75 0e                	jne    804e75 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804e67:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e6e:	00 00 00 
+  804e71:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804e75:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804e7a:	75 18                	jne    804e94 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804e7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e80:	48 89 c7             	mov    %rax,%rdi
+  804e83:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  804e8a:	00 00 00 
+  804e8d:	ff d0                	call   *%rax
+  804e8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e92:	eb 1d                	jmp    804eb1 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804e94:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e9c:	48 89 d6             	mov    %rdx,%rsi
+  804e9f:	48 89 c7             	mov    %rax,%rdi
+  804ea2:	48 b8 86 22 80 00 00 	movabs $0x802286,%rax
+  804ea9:	00 00 00 
+  804eac:	ff d0                	call   *%rax
+  804eae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804eb1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804eb5:	79 2a                	jns    804ee1 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804eb7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ebc:	74 0a                	je     804ec8 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ebe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804ec8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ecd:	74 0a                	je     804ed9 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804ecf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ed3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804ed9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804edc:	e9 aa 00 00 00       	jmp    804f8b <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804ee1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ee6:	74 36                	je     804f1e <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804ee8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804eef:	00 00 00 
+  804ef2:	8b 40 04             	mov    0x4(%rax),%eax
+  804ef5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804efa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f01:	00 00 00 
+  804f04:	48 98                	cltq
+  804f06:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f0d:	48 01 d0             	add    %rdx,%rax
+  804f10:	48 05 24 01 00 00    	add    $0x124,%rax
+  804f16:	8b 10                	mov    (%rax),%edx
+  804f18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f1c:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804f1e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804f23:	74 36                	je     804f5b <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804f25:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f2c:	00 00 00 
+  804f2f:	8b 40 04             	mov    0x4(%rax),%eax
+  804f32:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f37:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f3e:	00 00 00 
+  804f41:	48 98                	cltq
+  804f43:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f4a:	48 01 d0             	add    %rdx,%rax
+  804f4d:	48 05 28 01 00 00    	add    $0x128,%rax
+  804f53:	8b 10                	mov    (%rax),%edx
+  804f55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f59:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804f5b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f62:	00 00 00 
+  804f65:	8b 40 04             	mov    0x4(%rax),%eax
+  804f68:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f6d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f74:	00 00 00 
+  804f77:	48 98                	cltq
+  804f79:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f80:	48 01 d0             	add    %rdx,%rax
+  804f83:	48 05 20 01 00 00    	add    $0x120,%rax
+  804f89:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804f8b:	c9                   	leave
+  804f8c:	c3                   	ret
+
+0000000000804f8d <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804f8d:	55                   	push   %rbp
+  804f8e:	48 89 e5             	mov    %rsp,%rbp
+  804f91:	48 83 ec 30          	sub    $0x30,%rsp
+  804f95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f98:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804f9b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804f9f:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804fa2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804fa7:	75 5e                	jne    805007 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804fa9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804fb0:	00 00 00 
+  804fb3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804fb7:	eb 4e                	jmp    805007 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804fb9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fbd:	79 3c                	jns    804ffb <ipc_send+0x6e>
+  804fbf:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804fc3:	74 36                	je     804ffb <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804fc5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fc8:	89 c1                	mov    %eax,%ecx
+  804fca:	48 b8 38 58 80 00 00 	movabs $0x805838,%rax
+  804fd1:	00 00 00 
+  804fd4:	48 89 c2             	mov    %rax,%rdx
+  804fd7:	be 54 00 00 00       	mov    $0x54,%esi
+  804fdc:	48 b8 5e 58 80 00 00 	movabs $0x80585e,%rax
+  804fe3:	00 00 00 
+  804fe6:	48 89 c7             	mov    %rax,%rdi
+  804fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fee:	49 b8 f6 4c 80 00 00 	movabs $0x804cf6,%r8
+  804ff5:	00 00 00 
+  804ff8:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804ffb:	48 b8 c3 1f 80 00 00 	movabs $0x801fc3,%rax
+  805002:	00 00 00 
+  805005:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805007:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80500a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80500d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805011:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805014:	89 c7                	mov    %eax,%edi
+  805016:	48 b8 e9 21 80 00 00 	movabs $0x8021e9,%rax
+  80501d:	00 00 00 
+  805020:	ff d0                	call   *%rax
+  805022:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805025:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805029:	75 8e                	jne    804fb9 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  80502b:	48 b8 c3 1f 80 00 00 	movabs $0x801fc3,%rax
+  805032:	00 00 00 
+  805035:	ff d0                	call   *%rax
+}
+  805037:	90                   	nop
+  805038:	c9                   	leave
+  805039:	c3                   	ret
+
+000000000080503a <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80503a:	55                   	push   %rbp
+  80503b:	48 89 e5             	mov    %rsp,%rbp
+  80503e:	48 83 ec 18          	sub    $0x18,%rsp
+  805042:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805045:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80504c:	eb 4d                	jmp    80509b <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80504e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805055:	00 00 00 
+  805058:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80505b:	48 98                	cltq
+  80505d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805064:	48 01 d0             	add    %rdx,%rax
+  805067:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  80506d:	8b 00                	mov    (%rax),%eax
+  80506f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805072:	75 23                	jne    805097 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805074:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80507b:	00 00 00 
+  80507e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805081:	48 98                	cltq
+  805083:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80508a:	48 01 d0             	add    %rdx,%rax
+  80508d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805093:	8b 00                	mov    (%rax),%eax
+  805095:	eb 12                	jmp    8050a9 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805097:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80509b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8050a2:	7e aa                	jle    80504e <ipc_find_env+0x14>
+  return 0;
+  8050a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050a9:	c9                   	leave
+  8050aa:	c3                   	ret
+
+00000000008050ab <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8050ab:	55                   	push   %rbp
+  8050ac:	48 89 e5             	mov    %rsp,%rbp
+  8050af:	48 83 ec 18          	sub    $0x18,%rsp
+  8050b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8050b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050bb:	48 c1 e8 27          	shr    $0x27,%rax
+  8050bf:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8050c4:	48 89 c2             	mov    %rax,%rdx
+  8050c7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8050ce:	01 00 00 
+  8050d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050d5:	83 e0 01             	and    $0x1,%eax
+  8050d8:	48 85 c0             	test   %rax,%rax
+  8050db:	74 63                	je     805140 <pageref+0x95>
+  8050dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050e1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8050e5:	48 89 c2             	mov    %rax,%rdx
+  8050e8:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8050ef:	01 00 00 
+  8050f2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050f6:	83 e0 01             	and    $0x1,%eax
+  8050f9:	48 85 c0             	test   %rax,%rax
+  8050fc:	74 42                	je     805140 <pageref+0x95>
+  8050fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805102:	48 c1 e8 15          	shr    $0x15,%rax
+  805106:	48 89 c2             	mov    %rax,%rdx
+  805109:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805110:	01 00 00 
+  805113:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805117:	83 e0 01             	and    $0x1,%eax
+  80511a:	48 85 c0             	test   %rax,%rax
+  80511d:	74 21                	je     805140 <pageref+0x95>
+  80511f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805123:	48 c1 e8 0c          	shr    $0xc,%rax
+  805127:	48 89 c2             	mov    %rax,%rdx
+  80512a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805131:	01 00 00 
+  805134:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805138:	83 e0 01             	and    $0x1,%eax
+  80513b:	48 85 c0             	test   %rax,%rax
+  80513e:	75 07                	jne    805147 <pageref+0x9c>
+    return 0;
+  805140:	b8 00 00 00 00       	mov    $0x0,%eax
+  805145:	eb 53                	jmp    80519a <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80514b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80514f:	48 89 c2             	mov    %rax,%rdx
+  805152:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805159:	01 00 00 
+  80515c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805160:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805164:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805168:	83 e0 01             	and    $0x1,%eax
+  80516b:	48 85 c0             	test   %rax,%rax
+  80516e:	75 07                	jne    805177 <pageref+0xcc>
+    return 0;
+  805170:	b8 00 00 00 00       	mov    $0x0,%eax
+  805175:	eb 23                	jmp    80519a <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805177:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80517b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80517f:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805186:	00 00 00 
+  805189:	48 c1 e0 04          	shl    $0x4,%rax
+  80518d:	48 01 d0             	add    %rdx,%rax
+  805190:	48 83 c0 08          	add    $0x8,%rax
+  805194:	0f b7 00             	movzwl (%rax),%eax
+  805197:	0f b7 c0             	movzwl %ax,%eax
+}
+  80519a:	c9                   	leave
+  80519b:	c3                   	ret
@@ -0,0 +1,8057 @@
+
+obj/user/faultevilhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 5f 00 00 00       	call   80008b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// test evil pointer for user-level fault handler
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  sys_page_alloc(0, (void *)(UXSTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W);
+  800041:	ba 07 00 00 00       	mov    $0x7,%edx
+  800046:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  80004d:	00 00 00 
+  800050:	48 89 c6             	mov    %rax,%rsi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 e2 03 80 00 00 	movabs $0x8003e2,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  sys_env_set_pgfault_upcall(0, (void *)0xF0100020);
+  800064:	b8 20 00 10 f0       	mov    $0xf0100020,%eax
+  800069:	48 89 c6             	mov    %rax,%rsi
+  80006c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800071:	48 b8 7f 05 80 00 00 	movabs $0x80057f,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  *(volatile int *)0 = 0;
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800088:	90                   	nop
+  800089:	c9                   	leave
+  80008a:	c3                   	ret
+
+000000000080008b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80008b:	55                   	push   %rbp
+  80008c:	48 89 e5             	mov    %rsp,%rbp
+  80008f:	48 83 ec 20          	sub    $0x20,%rsp
+  800093:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800096:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80009a:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000a1:	00 00 00 
+  8000a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000a8:	eb 13                	jmp    8000bd <libmain+0x32>
+    (*ctor)();
+  8000aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000ae:	48 8b 10             	mov    (%rax),%rdx
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	ff d2                	call   *%rdx
+    ctor++;
+  8000b8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000bd:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000c4:	00 00 00 
+  8000c7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000cb:	72 dd                	jb     8000aa <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000d1:	7e 14                	jle    8000e7 <libmain+0x5c>
+    binaryname = argv[0];
+  8000d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000d7:	48 8b 00             	mov    (%rax),%rax
+  8000da:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000e1:	00 00 00 
+  8000e4:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ee:	48 89 d6             	mov    %rdx,%rsi
+  8000f1:	89 c7                	mov    %eax,%edi
+  8000f3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000ff:	48 b8 0e 01 80 00 00 	movabs $0x80010e,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+#endif
+}
+  80010b:	90                   	nop
+  80010c:	c9                   	leave
+  80010d:	c3                   	ret
+
+000000000080010e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80010e:	55                   	push   %rbp
+  80010f:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800112:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  800119:	00 00 00 
+  80011c:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80011e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800123:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+}
+  80012f:	90                   	nop
+  800130:	5d                   	pop    %rbp
+  800131:	c3                   	ret
+
+0000000000800132 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  800132:	55                   	push   %rbp
+  800133:	48 89 e5             	mov    %rsp,%rbp
+  800136:	53                   	push   %rbx
+  800137:	48 83 ec 48          	sub    $0x48,%rsp
+  80013b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80013f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800143:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800147:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80014b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80014f:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800157:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80015b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80015f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800163:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800167:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80016b:	4c 89 c3             	mov    %r8,%rbx
+  80016e:	cd 30                	int    $0x30
+  800170:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  800174:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800179:	74 46                	je     8001c1 <syscall+0x8f>
+  80017b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800180:	7e 3f                	jle    8001c1 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800182:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800186:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80018a:	49 89 d0             	mov    %rdx,%r8
+  80018d:	48 89 c1             	mov    %rax,%rcx
+  800190:	48 b8 10 50 80 00 00 	movabs $0x805010,%rax
+  800197:	00 00 00 
+  80019a:	48 89 c2             	mov    %rax,%rdx
+  80019d:	be 22 00 00 00       	mov    $0x22,%esi
+  8001a2:	48 b8 2f 50 80 00 00 	movabs $0x80502f,%rax
+  8001a9:	00 00 00 
+  8001ac:	48 89 c7             	mov    %rax,%rdi
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	49 b9 72 2f 80 00 00 	movabs $0x802f72,%r9
+  8001bb:	00 00 00 
+  8001be:	41 ff d1             	call   *%r9
+
+  return ret;
+  8001c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8001c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+00000000008001cb <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8001d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8001e7:	6a 00                	push   $0x0
+  8001e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f5:	48 89 d1             	mov    %rdx,%rcx
+  8001f8:	48 89 c2             	mov    %rax,%rdx
+  8001fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800200:	bf 00 00 00 00       	mov    $0x0,%edi
+  800205:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+  800211:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800215:	90                   	nop
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+
+0000000000800218 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800218:	55                   	push   %rbp
+  800219:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80021c:	48 83 ec 08          	sub    $0x8,%rsp
+  800220:	6a 00                	push   $0x0
+  800222:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80022e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800233:	ba 00 00 00 00       	mov    $0x0,%edx
+  800238:	be 00 00 00 00       	mov    $0x0,%esi
+  80023d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800242:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+  80024e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800252:	c9                   	leave
+  800253:	c3                   	ret
+
+0000000000800254 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800254:	55                   	push   %rbp
+  800255:	48 89 e5             	mov    %rsp,%rbp
+  800258:	48 83 ec 10          	sub    $0x10,%rsp
+  80025c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80025f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800262:	48 98                	cltq
+  800264:	48 83 ec 08          	sub    $0x8,%rsp
+  800268:	6a 00                	push   $0x0
+  80026a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800276:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80027b:	48 89 c2             	mov    %rax,%rdx
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 03 00 00 00       	mov    $0x3,%edi
+  800288:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+  800294:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+000000000080029a <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+  80029e:	48 83 ec 10          	sub    $0x10,%rsp
+  8002a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8002a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002a8:	48 98                	cltq
+  8002aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ae:	6a 00                	push   $0x0
+  8002b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8002b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002c1:	48 89 c2             	mov    %rax,%rdx
+  8002c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002ce:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+  8002da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002de:	90                   	nop
+  8002df:	c9                   	leave
+  8002e0:	c3                   	ret
+
+00000000008002e1 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002e1:	55                   	push   %rbp
+  8002e2:	48 89 e5             	mov    %rsp,%rbp
+  8002e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8002e9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002f3:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002f6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002fb:	cd 30                	int    $0x30
+  8002fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800301:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  800305:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80030a:	7e 3d                	jle    800349 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80030c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800310:	49 89 c0             	mov    %rax,%r8
+  800313:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800318:	48 b8 10 50 80 00 00 	movabs $0x805010,%rax
+  80031f:	00 00 00 
+  800322:	48 89 c2             	mov    %rax,%rdx
+  800325:	be 49 00 00 00       	mov    $0x49,%esi
+  80032a:	48 b8 2f 50 80 00 00 	movabs $0x80502f,%rax
+  800331:	00 00 00 
+  800334:	48 89 c7             	mov    %rax,%rdi
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	49 b9 72 2f 80 00 00 	movabs $0x802f72,%r9
+  800343:	00 00 00 
+  800346:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800349:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80034e:	75 13                	jne    800363 <sys_env_wait+0x82>
+  800350:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800355:	74 0c                	je     800363 <sys_env_wait+0x82>
+    *status = st;
+  800357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80035b:	89 c2                	mov    %eax,%edx
+  80035d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800361:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800363:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+0000000000800369 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800369:	55                   	push   %rbp
+  80036a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80036d:	48 83 ec 08          	sub    $0x8,%rsp
+  800371:	6a 00                	push   $0x0
+  800373:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800379:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80037f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800384:	ba 00 00 00 00       	mov    $0x0,%edx
+  800389:	be 00 00 00 00       	mov    $0x0,%esi
+  80038e:	bf 02 00 00 00       	mov    $0x2,%edi
+  800393:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80039a:	00 00 00 
+  80039d:	ff d0                	call   *%rax
+  80039f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+
+00000000008003a5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8003a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ad:	6a 00                	push   $0x0
+  8003af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ca:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003cf:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8003d6:	00 00 00 
+  8003d9:	ff d0                	call   *%rax
+  8003db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003df:	90                   	nop
+  8003e0:	c9                   	leave
+  8003e1:	c3                   	ret
+
+00000000008003e2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003e2:	55                   	push   %rbp
+  8003e3:	48 89 e5             	mov    %rsp,%rbp
+  8003e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8003ea:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003f1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003f7:	48 63 c8             	movslq %eax,%rcx
+  8003fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800401:	48 98                	cltq
+  800403:	48 83 ec 08          	sub    $0x8,%rsp
+  800407:	6a 00                	push   $0x0
+  800409:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80040f:	49 89 c8             	mov    %rcx,%r8
+  800412:	48 89 d1             	mov    %rdx,%rcx
+  800415:	48 89 c2             	mov    %rax,%rdx
+  800418:	be 01 00 00 00       	mov    $0x1,%esi
+  80041d:	bf 06 00 00 00       	mov    $0x6,%edi
+  800422:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800429:	00 00 00 
+  80042c:	ff d0                	call   *%rax
+  80042e:	48 83 c4 10          	add    $0x10,%rsp
+  800432:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  800435:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800438:	c9                   	leave
+  800439:	c3                   	ret
+
+000000000080043a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	48 83 ec 20          	sub    $0x20,%rsp
+  800442:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800445:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800449:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80044c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800450:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800454:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800457:	48 63 c8             	movslq %eax,%rcx
+  80045a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80045e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800461:	48 63 f0             	movslq %eax,%rsi
+  800464:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800468:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046b:	48 98                	cltq
+  80046d:	48 83 ec 08          	sub    $0x8,%rsp
+  800471:	51                   	push   %rcx
+  800472:	49 89 f9             	mov    %rdi,%r9
+  800475:	49 89 f0             	mov    %rsi,%r8
+  800478:	48 89 d1             	mov    %rdx,%rcx
+  80047b:	48 89 c2             	mov    %rax,%rdx
+  80047e:	be 01 00 00 00       	mov    $0x1,%esi
+  800483:	bf 07 00 00 00       	mov    $0x7,%edi
+  800488:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80048f:	00 00 00 
+  800492:	ff d0                	call   *%rax
+  800494:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+
+000000000080049a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80049a:	55                   	push   %rbp
+  80049b:	48 89 e5             	mov    %rsp,%rbp
+  80049e:	48 83 ec 10          	sub    $0x10,%rsp
+  8004a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8004a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004b0:	48 98                	cltq
+  8004b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8004b6:	6a 00                	push   $0x0
+  8004b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004c4:	48 89 d1             	mov    %rdx,%rcx
+  8004c7:	48 89 c2             	mov    %rax,%rdx
+  8004ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8004cf:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004d4:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+  8004e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004e4:	c9                   	leave
+  8004e5:	c3                   	ret
+
+00000000008004e6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004e6:	55                   	push   %rbp
+  8004e7:	48 89 e5             	mov    %rsp,%rbp
+  8004ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004f1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004f7:	48 63 d0             	movslq %eax,%rdx
+  8004fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004fd:	48 98                	cltq
+  8004ff:	48 83 ec 08          	sub    $0x8,%rsp
+  800503:	6a 00                	push   $0x0
+  800505:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80050b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800511:	48 89 d1             	mov    %rdx,%rcx
+  800514:	48 89 c2             	mov    %rax,%rdx
+  800517:	be 01 00 00 00       	mov    $0x1,%esi
+  80051c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800521:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800528:	00 00 00 
+  80052b:	ff d0                	call   *%rax
+  80052d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800531:	c9                   	leave
+  800532:	c3                   	ret
+
+0000000000800533 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800533:	55                   	push   %rbp
+  800534:	48 89 e5             	mov    %rsp,%rbp
+  800537:	48 83 ec 10          	sub    $0x10,%rsp
+  80053b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80053e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800542:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800546:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800549:	48 98                	cltq
+  80054b:	48 83 ec 08          	sub    $0x8,%rsp
+  80054f:	6a 00                	push   $0x0
+  800551:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800557:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80055d:	48 89 d1             	mov    %rdx,%rcx
+  800560:	48 89 c2             	mov    %rax,%rdx
+  800563:	be 01 00 00 00       	mov    $0x1,%esi
+  800568:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80056d:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+  800579:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80057d:	c9                   	leave
+  80057e:	c3                   	ret
+
+000000000080057f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80057f:	55                   	push   %rbp
+  800580:	48 89 e5             	mov    %rsp,%rbp
+  800583:	48 83 ec 10          	sub    $0x10,%rsp
+  800587:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80058a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80058e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800592:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800595:	48 98                	cltq
+  800597:	48 83 ec 08          	sub    $0x8,%rsp
+  80059b:	6a 00                	push   $0x0
+  80059d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005a9:	48 89 d1             	mov    %rdx,%rcx
+  8005ac:	48 89 c2             	mov    %rax,%rdx
+  8005af:	be 01 00 00 00       	mov    $0x1,%esi
+  8005b4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8005b9:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8005c0:	00 00 00 
+  8005c3:	ff d0                	call   *%rax
+  8005c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+
+00000000008005cb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005cb:	55                   	push   %rbp
+  8005cc:	48 89 e5             	mov    %rsp,%rbp
+  8005cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8005d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005de:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005e4:	48 63 f0             	movslq %eax,%rsi
+  8005e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005f2:	48 98                	cltq
+  8005f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f8:	6a 00                	push   $0x0
+  8005fa:	49 89 f1             	mov    %rsi,%r9
+  8005fd:	49 89 c8             	mov    %rcx,%r8
+  800600:	48 89 d1             	mov    %rdx,%rcx
+  800603:	48 89 c2             	mov    %rax,%rdx
+  800606:	be 00 00 00 00       	mov    $0x0,%esi
+  80060b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  800610:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800617:	00 00 00 
+  80061a:	ff d0                	call   *%rax
+  80061c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800620:	c9                   	leave
+  800621:	c3                   	ret
+
+0000000000800622 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800622:	55                   	push   %rbp
+  800623:	48 89 e5             	mov    %rsp,%rbp
+  800626:	48 83 ec 10          	sub    $0x10,%rsp
+  80062a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80062e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800632:	48 83 ec 08          	sub    $0x8,%rsp
+  800636:	6a 00                	push   $0x0
+  800638:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80063e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800644:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800649:	48 89 c2             	mov    %rax,%rdx
+  80064c:	be 01 00 00 00       	mov    $0x1,%esi
+  800651:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800656:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80065d:	00 00 00 
+  800660:	ff d0                	call   *%rax
+  800662:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800666:	c9                   	leave
+  800667:	c3                   	ret
+
+0000000000800668 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800668:	55                   	push   %rbp
+  800669:	48 89 e5             	mov    %rsp,%rbp
+  80066c:	48 83 ec 10          	sub    $0x10,%rsp
+  800670:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800674:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800678:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80067c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800680:	48 83 ec 08          	sub    $0x8,%rsp
+  800684:	6a 00                	push   $0x0
+  800686:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80068c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800692:	48 89 d1             	mov    %rdx,%rcx
+  800695:	48 89 c2             	mov    %rax,%rdx
+  800698:	be 01 00 00 00       	mov    $0x1,%esi
+  80069d:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006a2:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8006a9:	00 00 00 
+  8006ac:	ff d0                	call   *%rax
+  8006ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006b2:	c9                   	leave
+  8006b3:	c3                   	ret
+
+00000000008006b4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006b4:	55                   	push   %rbp
+  8006b5:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8006b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8006bc:	6a 00                	push   $0x0
+  8006be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006d9:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006de:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8006e5:	00 00 00 
+  8006e8:	ff d0                	call   *%rax
+  8006ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006ee:	c9                   	leave
+  8006ef:	c3                   	ret
+
+00000000008006f0 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006f0:	55                   	push   %rbp
+  8006f1:	48 89 e5             	mov    %rsp,%rbp
+  8006f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8006f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  800700:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800704:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800708:	48 83 ec 08          	sub    $0x8,%rsp
+  80070c:	6a 00                	push   $0x0
+  80070e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800714:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80071a:	48 89 d1             	mov    %rdx,%rcx
+  80071d:	48 89 c2             	mov    %rax,%rdx
+  800720:	be 00 00 00 00       	mov    $0x0,%esi
+  800725:	bf 12 00 00 00       	mov    $0x12,%edi
+  80072a:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800731:	00 00 00 
+  800734:	ff d0                	call   *%rax
+  800736:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80073a:	c9                   	leave
+  80073b:	c3                   	ret
+
+000000000080073c <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+  800740:	48 83 ec 20          	sub    $0x20,%rsp
+  800744:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800748:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80074c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80074f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800752:	48 63 c8             	movslq %eax,%rcx
+  800755:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80075d:	48 83 ec 08          	sub    $0x8,%rsp
+  800761:	6a 00                	push   $0x0
+  800763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800769:	49 89 c8             	mov    %rcx,%r8
+  80076c:	48 89 d1             	mov    %rdx,%rcx
+  80076f:	48 89 c2             	mov    %rax,%rdx
+  800772:	be 00 00 00 00       	mov    $0x0,%esi
+  800777:	bf 13 00 00 00       	mov    $0x13,%edi
+  80077c:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800783:	00 00 00 
+  800786:	ff d0                	call   *%rax
+  800788:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+000000000080078e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80078e:	55                   	push   %rbp
+  80078f:	48 89 e5             	mov    %rsp,%rbp
+  800792:	48 83 ec 20          	sub    $0x20,%rsp
+  800796:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80079a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80079d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8007a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007a5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8007a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8007b0:	6a 00                	push   $0x0
+  8007b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007b8:	49 89 c8             	mov    %rcx,%r8
+  8007bb:	48 89 d1             	mov    %rdx,%rcx
+  8007be:	48 89 c2             	mov    %rax,%rdx
+  8007c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007c6:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007cb:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8007d2:	00 00 00 
+  8007d5:	ff d0                	call   *%rax
+  8007d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007db:	c9                   	leave
+  8007dc:	c3                   	ret
+
+00000000008007dd <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007dd:	55                   	push   %rbp
+  8007de:	48 89 e5             	mov    %rsp,%rbp
+  8007e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8007e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007e9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007ef:	48 63 d0             	movslq %eax,%rdx
+  8007f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8007fa:	6a 00                	push   $0x0
+  8007fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800802:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800808:	48 89 d1             	mov    %rdx,%rcx
+  80080b:	48 89 c2             	mov    %rax,%rdx
+  80080e:	be 00 00 00 00       	mov    $0x0,%esi
+  800813:	bf 15 00 00 00       	mov    $0x15,%edi
+  800818:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80081f:	00 00 00 
+  800822:	ff d0                	call   *%rax
+  800824:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800828:	c9                   	leave
+  800829:	c3                   	ret
+
+000000000080082a <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80082a:	55                   	push   %rbp
+  80082b:	48 89 e5             	mov    %rsp,%rbp
+  80082e:	48 83 ec 20          	sub    $0x20,%rsp
+  800832:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800836:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800839:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80083c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  800840:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800844:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800847:	48 63 c8             	movslq %eax,%rcx
+  80084a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80084d:	48 63 d0             	movslq %eax,%rdx
+  800850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800854:	48 83 ec 08          	sub    $0x8,%rsp
+  800858:	6a 00                	push   $0x0
+  80085a:	49 89 f1             	mov    %rsi,%r9
+  80085d:	49 89 c8             	mov    %rcx,%r8
+  800860:	48 89 d1             	mov    %rdx,%rcx
+  800863:	48 89 c2             	mov    %rax,%rdx
+  800866:	be 00 00 00 00       	mov    $0x0,%esi
+  80086b:	bf 16 00 00 00       	mov    $0x16,%edi
+  800870:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800877:	00 00 00 
+  80087a:	ff d0                	call   *%rax
+  80087c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800880:	c9                   	leave
+  800881:	c3                   	ret
+
+0000000000800882 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800882:	55                   	push   %rbp
+  800883:	48 89 e5             	mov    %rsp,%rbp
+  800886:	48 83 ec 30          	sub    $0x30,%rsp
+  80088a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80088e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800892:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800896:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80089a:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80089e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008a2:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8008a6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8008ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b6:	51                   	push   %rcx
+  8008b7:	49 89 f9             	mov    %rdi,%r9
+  8008ba:	49 89 f0             	mov    %rsi,%r8
+  8008bd:	48 89 d1             	mov    %rdx,%rcx
+  8008c0:	48 89 c2             	mov    %rax,%rdx
+  8008c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8008c8:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008cd:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8008d4:	00 00 00 
+  8008d7:	ff d0                	call   *%rax
+  8008d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008dd:	c9                   	leave
+  8008de:	c3                   	ret
+
+00000000008008df <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008df:	55                   	push   %rbp
+  8008e0:	48 89 e5             	mov    %rsp,%rbp
+  8008e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8008e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008ed:	48 98                	cltq
+  8008ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8008f3:	6a 00                	push   $0x0
+  8008f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800906:	48 89 c2             	mov    %rax,%rdx
+  800909:	be 00 00 00 00       	mov    $0x0,%esi
+  80090e:	bf 18 00 00 00       	mov    $0x18,%edi
+  800913:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  80091a:	00 00 00 
+  80091d:	ff d0                	call   *%rax
+  80091f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800923:	90                   	nop
+  800924:	c9                   	leave
+  800925:	c3                   	ret
+
+0000000000800926 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800926:	55                   	push   %rbp
+  800927:	48 89 e5             	mov    %rsp,%rbp
+  80092a:	48 83 ec 30          	sub    $0x30,%rsp
+  80092e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800931:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800935:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800939:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80093c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80093f:	48 63 f0             	movslq %eax,%rsi
+  800942:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800946:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80094a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80094d:	48 98                	cltq
+  80094f:	48 83 ec 08          	sub    $0x8,%rsp
+  800953:	6a 00                	push   $0x0
+  800955:	49 89 f1             	mov    %rsi,%r9
+  800958:	49 89 c8             	mov    %rcx,%r8
+  80095b:	48 89 d1             	mov    %rdx,%rcx
+  80095e:	48 89 c2             	mov    %rax,%rdx
+  800961:	be 01 00 00 00       	mov    $0x1,%esi
+  800966:	bf 19 00 00 00       	mov    $0x19,%edi
+  80096b:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800972:	00 00 00 
+  800975:	ff d0                	call   *%rax
+  800977:	48 83 c4 10          	add    $0x10,%rsp
+  80097b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80097e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800981:	c9                   	leave
+  800982:	c3                   	ret
+
+0000000000800983 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  800983:	55                   	push   %rbp
+  800984:	48 89 e5             	mov    %rsp,%rbp
+  800987:	48 83 ec 20          	sub    $0x20,%rsp
+  80098b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80098f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800993:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800996:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800999:	48 63 c8             	movslq %eax,%rcx
+  80099c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8009a8:	6a 00                	push   $0x0
+  8009aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009b0:	49 89 c8             	mov    %rcx,%r8
+  8009b3:	48 89 d1             	mov    %rdx,%rcx
+  8009b6:	48 89 c2             	mov    %rax,%rdx
+  8009b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8009be:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8009c3:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  8009ca:	00 00 00 
+  8009cd:	ff d0                	call   *%rax
+  8009cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+
+00000000008009d5 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009d5:	55                   	push   %rbp
+  8009d6:	48 89 e5             	mov    %rsp,%rbp
+  8009d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8009dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009e9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8009f9:	6a 00                	push   $0x0
+  8009fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a01:	49 89 c8             	mov    %rcx,%r8
+  800a04:	48 89 d1             	mov    %rdx,%rcx
+  800a07:	48 89 c2             	mov    %rax,%rdx
+  800a0a:	be 01 00 00 00       	mov    $0x1,%esi
+  800a0f:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  800a14:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800a1b:	00 00 00 
+  800a1e:	ff d0                	call   *%rax
+  800a20:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a24:	c9                   	leave
+  800a25:	c3                   	ret
+
+0000000000800a26 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a26:	55                   	push   %rbp
+  800a27:	48 89 e5             	mov    %rsp,%rbp
+  800a2a:	48 83 ec 30          	sub    $0x30,%rsp
+  800a2e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a32:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a36:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a39:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a3d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a44:	48 63 c8             	movslq %eax,%rcx
+  800a47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a4f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a53:	6a 00                	push   $0x0
+  800a55:	49 89 f1             	mov    %rsi,%r9
+  800a58:	49 89 c8             	mov    %rcx,%r8
+  800a5b:	48 89 d1             	mov    %rdx,%rcx
+  800a5e:	48 89 c2             	mov    %rax,%rdx
+  800a61:	be 01 00 00 00       	mov    $0x1,%esi
+  800a66:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a6b:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800a72:	00 00 00 
+  800a75:	ff d0                	call   *%rax
+  800a77:	48 83 c4 10          	add    $0x10,%rsp
+  800a7b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+0000000000800a83 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a83:	55                   	push   %rbp
+  800a84:	48 89 e5             	mov    %rsp,%rbp
+  800a87:	48 83 ec 10          	sub    $0x10,%rsp
+  800a8b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a91:	48 98                	cltq
+  800a93:	48 83 ec 08          	sub    $0x8,%rsp
+  800a97:	6a 00                	push   $0x0
+  800a99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aaa:	48 89 c2             	mov    %rax,%rdx
+  800aad:	be 01 00 00 00       	mov    $0x1,%esi
+  800ab2:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800ab7:	48 b8 32 01 80 00 00 	movabs $0x800132,%rax
+  800abe:	00 00 00 
+  800ac1:	ff d0                	call   *%rax
+  800ac3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ac7:	c9                   	leave
+  800ac8:	c3                   	ret
+
+0000000000800ac9 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800ac9:	55                   	push   %rbp
+  800aca:	48 89 e5             	mov    %rsp,%rbp
+  800acd:	48 83 ec 08          	sub    $0x8,%rsp
+  800ad1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800ad5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ad9:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800ae0:	ff ff ff 
+  800ae3:	48 01 d0             	add    %rdx,%rax
+  800ae6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800aea:	c9                   	leave
+  800aeb:	c3                   	ret
+
+0000000000800aec <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800aec:	55                   	push   %rbp
+  800aed:	48 89 e5             	mov    %rsp,%rbp
+  800af0:	48 83 ec 08          	sub    $0x8,%rsp
+  800af4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800af8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800afc:	48 89 c7             	mov    %rax,%rdi
+  800aff:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  800b06:	00 00 00 
+  800b09:	ff d0                	call   *%rax
+  800b0b:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800b11:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800b15:	c9                   	leave
+  800b16:	c3                   	ret
+
+0000000000800b17 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800b17:	55                   	push   %rbp
+  800b18:	48 89 e5             	mov    %rsp,%rbp
+  800b1b:	48 83 ec 18          	sub    $0x18,%rsp
+  800b1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800b23:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b2a:	e9 ae 00 00 00       	jmp    800bdd <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b32:	c1 e0 0c             	shl    $0xc,%eax
+  800b35:	48 98                	cltq
+  800b37:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b3c:	48 01 d0             	add    %rdx,%rax
+  800b3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b47:	48 c1 e8 27          	shr    $0x27,%rax
+  800b4b:	48 89 c2             	mov    %rax,%rdx
+  800b4e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b55:	01 00 00 
+  800b58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b5c:	83 e0 01             	and    $0x1,%eax
+  800b5f:	48 85 c0             	test   %rax,%rax
+  800b62:	74 63                	je     800bc7 <fd_alloc+0xb0>
+  800b64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b68:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b6c:	48 89 c2             	mov    %rax,%rdx
+  800b6f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b76:	01 00 00 
+  800b79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b7d:	83 e0 01             	and    $0x1,%eax
+  800b80:	48 85 c0             	test   %rax,%rax
+  800b83:	74 42                	je     800bc7 <fd_alloc+0xb0>
+  800b85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b89:	48 c1 e8 15          	shr    $0x15,%rax
+  800b8d:	48 89 c2             	mov    %rax,%rdx
+  800b90:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b97:	01 00 00 
+  800b9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b9e:	83 e0 01             	and    $0x1,%eax
+  800ba1:	48 85 c0             	test   %rax,%rax
+  800ba4:	74 21                	je     800bc7 <fd_alloc+0xb0>
+  800ba6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800baa:	48 c1 e8 0c          	shr    $0xc,%rax
+  800bae:	48 89 c2             	mov    %rax,%rdx
+  800bb1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800bb8:	01 00 00 
+  800bbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bbf:	83 e0 01             	and    $0x1,%eax
+  800bc2:	48 85 c0             	test   %rax,%rax
+  800bc5:	75 12                	jne    800bd9 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800bc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bcb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800bcf:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd7:	eb 1e                	jmp    800bf7 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800bd9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800bdd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800be1:	0f 8e 48 ff ff ff    	jle    800b2f <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800be7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800beb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bf2:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bf7:	c9                   	leave
+  800bf8:	c3                   	ret
+
+0000000000800bf9 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bf9:	55                   	push   %rbp
+  800bfa:	48 89 e5             	mov    %rsp,%rbp
+  800bfd:	48 83 ec 20          	sub    $0x20,%rsp
+  800c01:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800c04:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800c08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800c0c:	78 06                	js     800c14 <fd_lookup+0x1b>
+  800c0e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800c12:	7e 0a                	jle    800c1e <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c19:	e9 af 00 00 00       	jmp    800ccd <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800c1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c21:	c1 e0 0c             	shl    $0xc,%eax
+  800c24:	48 98                	cltq
+  800c26:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c2b:	48 01 d0             	add    %rdx,%rax
+  800c2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c36:	48 c1 e8 27          	shr    $0x27,%rax
+  800c3a:	48 89 c2             	mov    %rax,%rdx
+  800c3d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c44:	01 00 00 
+  800c47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c4b:	83 e0 01             	and    $0x1,%eax
+  800c4e:	48 85 c0             	test   %rax,%rax
+  800c51:	74 63                	je     800cb6 <fd_lookup+0xbd>
+  800c53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c57:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c5b:	48 89 c2             	mov    %rax,%rdx
+  800c5e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c65:	01 00 00 
+  800c68:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c6c:	83 e0 01             	and    $0x1,%eax
+  800c6f:	48 85 c0             	test   %rax,%rax
+  800c72:	74 42                	je     800cb6 <fd_lookup+0xbd>
+  800c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c78:	48 c1 e8 15          	shr    $0x15,%rax
+  800c7c:	48 89 c2             	mov    %rax,%rdx
+  800c7f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c86:	01 00 00 
+  800c89:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c8d:	83 e0 01             	and    $0x1,%eax
+  800c90:	48 85 c0             	test   %rax,%rax
+  800c93:	74 21                	je     800cb6 <fd_lookup+0xbd>
+  800c95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c99:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c9d:	48 89 c2             	mov    %rax,%rdx
+  800ca0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800ca7:	01 00 00 
+  800caa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cae:	83 e0 01             	and    $0x1,%eax
+  800cb1:	48 85 c0             	test   %rax,%rax
+  800cb4:	75 07                	jne    800cbd <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800cb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cbb:	eb 10                	jmp    800ccd <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800cbd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cc1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cc5:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ccd:	c9                   	leave
+  800cce:	c3                   	ret
+
+0000000000800ccf <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800ccf:	55                   	push   %rbp
+  800cd0:	48 89 e5             	mov    %rsp,%rbp
+  800cd3:	48 83 ec 30          	sub    $0x30,%rsp
+  800cd7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800cdb:	89 f0                	mov    %esi,%eax
+  800cdd:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800ce0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ce4:	48 89 c7             	mov    %rax,%rdi
+  800ce7:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  800cee:	00 00 00 
+  800cf1:	ff d0                	call   *%rax
+  800cf3:	89 c2                	mov    %eax,%edx
+  800cf5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cf9:	48 89 c6             	mov    %rax,%rsi
+  800cfc:	89 d7                	mov    %edx,%edi
+  800cfe:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  800d05:	00 00 00 
+  800d08:	ff d0                	call   *%rax
+  800d0a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d0d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d11:	78 0a                	js     800d1d <fd_close+0x4e>
+  800d13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d17:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800d1b:	74 12                	je     800d2f <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800d1d:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800d21:	74 05                	je     800d28 <fd_close+0x59>
+  800d23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d26:	eb 70                	jmp    800d98 <fd_close+0xc9>
+  800d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2d:	eb 69                	jmp    800d98 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d33:	8b 00                	mov    (%rax),%eax
+  800d35:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d39:	48 89 d6             	mov    %rdx,%rsi
+  800d3c:	89 c7                	mov    %eax,%edi
+  800d3e:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  800d45:	00 00 00 
+  800d48:	ff d0                	call   *%rax
+  800d4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d51:	78 2a                	js     800d7d <fd_close+0xae>
+    if (dev->dev_close)
+  800d53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d57:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d5b:	48 85 c0             	test   %rax,%rax
+  800d5e:	74 16                	je     800d76 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d64:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d6c:	48 89 c7             	mov    %rax,%rdi
+  800d6f:	ff d2                	call   *%rdx
+  800d71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d74:	eb 07                	jmp    800d7d <fd_close+0xae>
+    else
+      r = 0;
+  800d76:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d81:	48 89 c6             	mov    %rax,%rsi
+  800d84:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d89:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+  return r;
+  800d95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d98:	c9                   	leave
+  800d99:	c3                   	ret
+
+0000000000800d9a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d9a:	55                   	push   %rbp
+  800d9b:	48 89 e5             	mov    %rsp,%rbp
+  800d9e:	48 83 ec 20          	sub    $0x20,%rsp
+  800da2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800da5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800da9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800db0:	eb 3f                	jmp    800df1 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800db2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800db9:	00 00 00 
+  800dbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dbf:	48 98                	cltq
+  800dc1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dc5:	8b 00                	mov    (%rax),%eax
+  800dc7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800dca:	75 21                	jne    800ded <dev_lookup+0x53>
+      *dev = devtab[i];
+  800dcc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dd3:	00 00 00 
+  800dd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dd9:	48 98                	cltq
+  800ddb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800ddf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800de3:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800deb:	eb 7f                	jmp    800e6c <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800ded:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800df1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800df8:	00 00 00 
+  800dfb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dfe:	48 98                	cltq
+  800e00:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e04:	48 85 c0             	test   %rax,%rax
+  800e07:	75 a9                	jne    800db2 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e09:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800e10:	00 00 00 
+  800e13:	8b 40 04             	mov    0x4(%rax),%eax
+  800e16:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e1b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800e22:	00 00 00 
+  800e25:	48 98                	cltq
+  800e27:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e2e:	48 01 d0             	add    %rdx,%rax
+  800e31:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e37:	8b 00                	mov    (%rax),%eax
+  800e39:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e3c:	89 c6                	mov    %eax,%esi
+  800e3e:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  800e45:	00 00 00 
+  800e48:	48 89 c7             	mov    %rax,%rdi
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e50:	48 b9 91 31 80 00 00 	movabs $0x803191,%rcx
+  800e57:	00 00 00 
+  800e5a:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e60:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e6c:	c9                   	leave
+  800e6d:	c3                   	ret
+
+0000000000800e6e <close>:
+
+int
+close(int fdnum) {
+  800e6e:	55                   	push   %rbp
+  800e6f:	48 89 e5             	mov    %rsp,%rbp
+  800e72:	48 83 ec 20          	sub    $0x20,%rsp
+  800e76:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e79:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e80:	48 89 d6             	mov    %rdx,%rsi
+  800e83:	89 c7                	mov    %eax,%edi
+  800e85:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  800e8c:	00 00 00 
+  800e8f:	ff d0                	call   *%rax
+  800e91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e98:	79 05                	jns    800e9f <close+0x31>
+    return r;
+  800e9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e9d:	eb 18                	jmp    800eb7 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ea3:	be 01 00 00 00       	mov    $0x1,%esi
+  800ea8:	48 89 c7             	mov    %rax,%rdi
+  800eab:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+}
+  800eb7:	c9                   	leave
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <close_all>:
+
+void
+close_all(void) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+  800ebd:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800ec1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ec8:	eb 15                	jmp    800edf <close_all+0x26>
+    close(i);
+  800eca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ecd:	89 c7                	mov    %eax,%edi
+  800ecf:	48 b8 6e 0e 80 00 00 	movabs $0x800e6e,%rax
+  800ed6:	00 00 00 
+  800ed9:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800edb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800edf:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ee3:	7e e5                	jle    800eca <close_all+0x11>
+}
+  800ee5:	90                   	nop
+  800ee6:	90                   	nop
+  800ee7:	c9                   	leave
+  800ee8:	c3                   	ret
+
+0000000000800ee9 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ee9:	55                   	push   %rbp
+  800eea:	48 89 e5             	mov    %rsp,%rbp
+  800eed:	48 83 ec 40          	sub    $0x40,%rsp
+  800ef1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ef4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ef7:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800efb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800efe:	48 89 d6             	mov    %rdx,%rsi
+  800f01:	89 c7                	mov    %eax,%edi
+  800f03:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+  800f0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800f16:	79 08                	jns    800f20 <dup+0x37>
+    return r;
+  800f18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f1b:	e9 33 02 00 00       	jmp    801153 <dup+0x26a>
+  close(newfdnum);
+  800f20:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f23:	89 c7                	mov    %eax,%edi
+  800f25:	48 b8 6e 0e 80 00 00 	movabs $0x800e6e,%rax
+  800f2c:	00 00 00 
+  800f2f:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f31:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f34:	c1 e0 0c             	shl    $0xc,%eax
+  800f37:	48 98                	cltq
+  800f39:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f3e:	48 01 d0             	add    %rdx,%rax
+  800f41:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f49:	48 89 c7             	mov    %rax,%rdi
+  800f4c:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  800f53:	00 00 00 
+  800f56:	ff d0                	call   *%rax
+  800f58:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f60:	48 89 c7             	mov    %rax,%rdi
+  800f63:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  800f6a:	00 00 00 
+  800f6d:	ff d0                	call   *%rax
+  800f6f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f73:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f7a:	00 
+  800f7b:	e9 19 01 00 00       	jmp    801099 <dup+0x1b0>
+    off -= PGSIZE;
+  800f80:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f87:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f88:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f90:	48 01 d0             	add    %rdx,%rax
+  800f93:	48 c1 e8 27          	shr    $0x27,%rax
+  800f97:	48 89 c2             	mov    %rax,%rdx
+  800f9a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800fa1:	01 00 00 
+  800fa4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fa8:	83 e0 01             	and    $0x1,%eax
+  800fab:	48 85 c0             	test   %rax,%rax
+  800fae:	0f 84 e5 00 00 00    	je     801099 <dup+0x1b0>
+  800fb4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fbc:	48 01 d0             	add    %rdx,%rax
+  800fbf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800fc3:	48 89 c2             	mov    %rax,%rdx
+  800fc6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800fcd:	01 00 00 
+  800fd0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fd4:	83 e0 01             	and    $0x1,%eax
+  800fd7:	48 85 c0             	test   %rax,%rax
+  800fda:	0f 84 b9 00 00 00    	je     801099 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fe0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fe4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe8:	48 01 d0             	add    %rdx,%rax
+  800feb:	48 c1 e8 15          	shr    $0x15,%rax
+  800fef:	48 89 c2             	mov    %rax,%rdx
+  800ff2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800ff9:	01 00 00 
+  800ffc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801000:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  801003:	48 85 c0             	test   %rax,%rax
+  801006:	0f 84 8d 00 00 00    	je     801099 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80100c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801010:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801014:	48 01 d0             	add    %rdx,%rax
+  801017:	48 c1 e8 0c          	shr    $0xc,%rax
+  80101b:	48 89 c2             	mov    %rax,%rdx
+  80101e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801025:	01 00 00 
+  801028:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102c:	83 e0 01             	and    $0x1,%eax
+  80102f:	48 85 c0             	test   %rax,%rax
+  801032:	74 65                	je     801099 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801034:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801038:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103c:	48 01 d0             	add    %rdx,%rax
+  80103f:	48 c1 e8 0c          	shr    $0xc,%rax
+  801043:	48 89 c2             	mov    %rax,%rdx
+  801046:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80104d:	01 00 00 
+  801050:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801054:	25 07 0e 00 00       	and    $0xe07,%eax
+  801059:	89 c6                	mov    %eax,%esi
+  80105b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80105f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801063:	48 01 c2             	add    %rax,%rdx
+  801066:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80106a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80106e:	48 01 c8             	add    %rcx,%rax
+  801071:	41 89 f0             	mov    %esi,%r8d
+  801074:	48 89 d1             	mov    %rdx,%rcx
+  801077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80107c:	48 89 c6             	mov    %rax,%rsi
+  80107f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801084:	48 b8 3a 04 80 00 00 	movabs $0x80043a,%rax
+  80108b:	00 00 00 
+  80108e:	ff d0                	call   *%rax
+  801090:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801093:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801097:	78 60                	js     8010f9 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801099:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80109e:	0f 85 dc fe ff ff    	jne    800f80 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8010ac:	48 89 c2             	mov    %rax,%rdx
+  8010af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8010b6:	01 00 00 
+  8010b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8010bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010c2:	89 c1                	mov    %eax,%ecx
+  8010c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010cc:	41 89 c8             	mov    %ecx,%r8d
+  8010cf:	48 89 d1             	mov    %rdx,%rcx
+  8010d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d7:	48 89 c6             	mov    %rax,%rsi
+  8010da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010df:	48 b8 3a 04 80 00 00 	movabs $0x80043a,%rax
+  8010e6:	00 00 00 
+  8010e9:	ff d0                	call   *%rax
+  8010eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010f2:	78 08                	js     8010fc <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010f4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010f7:	eb 5a                	jmp    801153 <dup+0x26a>
+        goto err;
+  8010f9:	90                   	nop
+  8010fa:	eb 01                	jmp    8010fd <dup+0x214>
+    goto err;
+  8010fc:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801101:	48 89 c6             	mov    %rax,%rsi
+  801104:	bf 00 00 00 00       	mov    $0x0,%edi
+  801109:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  801110:	00 00 00 
+  801113:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801115:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80111c:	00 
+  80111d:	eb 27                	jmp    801146 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80111f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801123:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801127:	48 01 d0             	add    %rdx,%rax
+  80112a:	48 89 c6             	mov    %rax,%rsi
+  80112d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801132:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80113e:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801145:	00 
+  801146:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80114d:	00 
+  80114e:	76 cf                	jbe    80111f <dup+0x236>
+  return r;
+  801150:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	48 83 ec 40          	sub    $0x40,%rsp
+  80115d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801160:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801164:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801168:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80116c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80116f:	48 89 d6             	mov    %rdx,%rsi
+  801172:	89 c7                	mov    %eax,%edi
+  801174:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  80117b:	00 00 00 
+  80117e:	ff d0                	call   *%rax
+  801180:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801183:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801187:	78 24                	js     8011ad <read+0x58>
+  801189:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80118d:	8b 00                	mov    (%rax),%eax
+  80118f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801193:	48 89 d6             	mov    %rdx,%rsi
+  801196:	89 c7                	mov    %eax,%edi
+  801198:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  80119f:	00 00 00 
+  8011a2:	ff d0                	call   *%rax
+  8011a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011ab:	79 0a                	jns    8011b7 <read+0x62>
+    return r;
+  8011ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011b0:	48 98                	cltq
+  8011b2:	e9 9e 00 00 00       	jmp    801255 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011bb:	8b 40 08             	mov    0x8(%rax),%eax
+  8011be:	83 e0 03             	and    $0x3,%eax
+  8011c1:	83 f8 01             	cmp    $0x1,%eax
+  8011c4:	75 5c                	jne    801222 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011c6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011cd:	00 00 00 
+  8011d0:	8b 40 04             	mov    0x4(%rax),%eax
+  8011d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011d8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011df:	00 00 00 
+  8011e2:	48 98                	cltq
+  8011e4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011eb:	48 01 d0             	add    %rdx,%rax
+  8011ee:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011f4:	8b 00                	mov    (%rax),%eax
+  8011f6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011f9:	89 c6                	mov    %eax,%esi
+  8011fb:	48 b8 5f 50 80 00 00 	movabs $0x80505f,%rax
+  801202:	00 00 00 
+  801205:	48 89 c7             	mov    %rax,%rdi
+  801208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120d:	48 b9 91 31 80 00 00 	movabs $0x803191,%rcx
+  801214:	00 00 00 
+  801217:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801219:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801220:	eb 33                	jmp    801255 <read+0x100>
+  }
+  if (!dev->dev_read)
+  801222:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801226:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80122a:	48 85 c0             	test   %rax,%rax
+  80122d:	75 09                	jne    801238 <read+0xe3>
+    return -E_NOT_SUPP;
+  80122f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801236:	eb 1d                	jmp    801255 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801238:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80123c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801240:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801244:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801248:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80124c:	48 89 ce             	mov    %rcx,%rsi
+  80124f:	48 89 c7             	mov    %rax,%rdi
+  801252:	41 ff d0             	call   *%r8
+}
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+
+0000000000801257 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801257:	55                   	push   %rbp
+  801258:	48 89 e5             	mov    %rsp,%rbp
+  80125b:	48 83 ec 30          	sub    $0x30,%rsp
+  80125f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801262:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801266:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80126a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801271:	eb 49                	jmp    8012bc <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  801273:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801276:	48 98                	cltq
+  801278:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80127c:	48 29 c2             	sub    %rax,%rdx
+  80127f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801282:	48 63 c8             	movslq %eax,%rcx
+  801285:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801289:	48 01 c1             	add    %rax,%rcx
+  80128c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80128f:	48 89 ce             	mov    %rcx,%rsi
+  801292:	89 c7                	mov    %eax,%edi
+  801294:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  80129b:	00 00 00 
+  80129e:	ff d0                	call   *%rax
+  8012a0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8012a3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012a7:	79 07                	jns    8012b0 <readn+0x59>
+      return m;
+  8012a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012ac:	48 98                	cltq
+  8012ae:	eb 1f                	jmp    8012cf <readn+0x78>
+    if (m == 0)
+  8012b0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012b4:	74 13                	je     8012c9 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8012b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012b9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8012bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012bf:	48 98                	cltq
+  8012c1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012c5:	72 ac                	jb     801273 <readn+0x1c>
+  8012c7:	eb 01                	jmp    8012ca <readn+0x73>
+      break;
+  8012c9:	90                   	nop
+  }
+  return tot;
+  8012ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012cd:	48 98                	cltq
+}
+  8012cf:	c9                   	leave
+  8012d0:	c3                   	ret
+
+00000000008012d1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+  8012d5:	48 83 ec 40          	sub    $0x40,%rsp
+  8012d9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012eb:	48 89 d6             	mov    %rdx,%rsi
+  8012ee:	89 c7                	mov    %eax,%edi
+  8012f0:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  8012f7:	00 00 00 
+  8012fa:	ff d0                	call   *%rax
+  8012fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801303:	78 24                	js     801329 <write+0x58>
+  801305:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801309:	8b 00                	mov    (%rax),%eax
+  80130b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80130f:	48 89 d6             	mov    %rdx,%rsi
+  801312:	89 c7                	mov    %eax,%edi
+  801314:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  80131b:	00 00 00 
+  80131e:	ff d0                	call   *%rax
+  801320:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801323:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801327:	79 0a                	jns    801333 <write+0x62>
+    return r;
+  801329:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80132c:	48 98                	cltq
+  80132e:	e9 9d 00 00 00       	jmp    8013d0 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801333:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801337:	8b 40 08             	mov    0x8(%rax),%eax
+  80133a:	83 e0 03             	and    $0x3,%eax
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	75 5c                	jne    80139d <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801341:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801348:	00 00 00 
+  80134b:	8b 40 04             	mov    0x4(%rax),%eax
+  80134e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801353:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80135a:	00 00 00 
+  80135d:	48 98                	cltq
+  80135f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801366:	48 01 d0             	add    %rdx,%rax
+  801369:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80136f:	8b 00                	mov    (%rax),%eax
+  801371:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801374:	89 c6                	mov    %eax,%esi
+  801376:	48 b8 7b 50 80 00 00 	movabs $0x80507b,%rax
+  80137d:	00 00 00 
+  801380:	48 89 c7             	mov    %rax,%rdi
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+  801388:	48 b9 91 31 80 00 00 	movabs $0x803191,%rcx
+  80138f:	00 00 00 
+  801392:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801394:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80139b:	eb 33                	jmp    8013d0 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80139d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8013a5:	48 85 c0             	test   %rax,%rax
+  8013a8:	75 09                	jne    8013b3 <write+0xe2>
+    return -E_NOT_SUPP;
+  8013aa:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8013b1:	eb 1d                	jmp    8013d0 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8013b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b7:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8013bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013bf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8013c3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8013c7:	48 89 ce             	mov    %rcx,%rsi
+  8013ca:	48 89 c7             	mov    %rax,%rdi
+  8013cd:	41 ff d0             	call   *%r8
+}
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+
+00000000008013d2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8013da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013dd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013e0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013e7:	48 89 d6             	mov    %rdx,%rsi
+  8013ea:	89 c7                	mov    %eax,%edi
+  8013ec:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  8013f3:	00 00 00 
+  8013f6:	ff d0                	call   *%rax
+  8013f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013ff:	79 05                	jns    801406 <seek+0x34>
+    return r;
+  801401:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801404:	eb 0f                	jmp    801415 <seek+0x43>
+  fd->fd_offset = offset;
+  801406:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80140a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80140d:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+
+0000000000801417 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801417:	55                   	push   %rbp
+  801418:	48 89 e5             	mov    %rsp,%rbp
+  80141b:	48 83 ec 30          	sub    $0x30,%rsp
+  80141f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801422:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801425:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801429:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80142c:	48 89 d6             	mov    %rdx,%rsi
+  80142f:	89 c7                	mov    %eax,%edi
+  801431:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  801438:	00 00 00 
+  80143b:	ff d0                	call   *%rax
+  80143d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801440:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801444:	78 24                	js     80146a <ftruncate+0x53>
+  801446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80144a:	8b 00                	mov    (%rax),%eax
+  80144c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801450:	48 89 d6             	mov    %rdx,%rsi
+  801453:	89 c7                	mov    %eax,%edi
+  801455:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  80145c:	00 00 00 
+  80145f:	ff d0                	call   *%rax
+  801461:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801464:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801468:	79 08                	jns    801472 <ftruncate+0x5b>
+    return r;
+  80146a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80146d:	e9 92 00 00 00       	jmp    801504 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801472:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801476:	8b 40 08             	mov    0x8(%rax),%eax
+  801479:	83 e0 03             	and    $0x3,%eax
+  80147c:	85 c0                	test   %eax,%eax
+  80147e:	75 5a                	jne    8014da <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  801480:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801487:	00 00 00 
+  80148a:	8b 40 04             	mov    0x4(%rax),%eax
+  80148d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801492:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801499:	00 00 00 
+  80149c:	48 98                	cltq
+  80149e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8014a5:	48 01 d0             	add    %rdx,%rax
+  8014a8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8014ae:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014b0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8014b3:	89 c6                	mov    %eax,%esi
+  8014b5:	48 b8 98 50 80 00 00 	movabs $0x805098,%rax
+  8014bc:	00 00 00 
+  8014bf:	48 89 c7             	mov    %rax,%rdi
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c7:	48 b9 91 31 80 00 00 	movabs $0x803191,%rcx
+  8014ce:	00 00 00 
+  8014d1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d8:	eb 2a                	jmp    801504 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014de:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014e2:	48 85 c0             	test   %rax,%rax
+  8014e5:	75 07                	jne    8014ee <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014e7:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014ec:	eb 16                	jmp    801504 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014f2:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014fd:	89 d6                	mov    %edx,%esi
+  8014ff:	48 89 c7             	mov    %rax,%rdi
+  801502:	ff d1                	call   *%rcx
+}
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+0000000000801506 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	48 83 ec 30          	sub    $0x30,%rsp
+  80150e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801511:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801515:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801519:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80151c:	48 89 d6             	mov    %rdx,%rsi
+  80151f:	89 c7                	mov    %eax,%edi
+  801521:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  801528:	00 00 00 
+  80152b:	ff d0                	call   *%rax
+  80152d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801530:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801534:	78 24                	js     80155a <fstat+0x54>
+  801536:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153a:	8b 00                	mov    (%rax),%eax
+  80153c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801540:	48 89 d6             	mov    %rdx,%rsi
+  801543:	89 c7                	mov    %eax,%edi
+  801545:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801554:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801558:	79 05                	jns    80155f <fstat+0x59>
+    return r;
+  80155a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80155d:	eb 5e                	jmp    8015bd <fstat+0xb7>
+  if (!dev->dev_stat)
+  80155f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801563:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801567:	48 85 c0             	test   %rax,%rax
+  80156a:	75 07                	jne    801573 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80156c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801571:	eb 4a                	jmp    8015bd <fstat+0xb7>
+  stat->st_name[0] = 0;
+  801573:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801577:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80157a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80157e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801585:	00 00 00 
+  stat->st_isdir   = 0;
+  801588:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80158c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  801593:	00 00 00 
+  stat->st_dev     = dev;
+  801596:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80159a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80159e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8015a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a9:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8015ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8015b5:	48 89 d6             	mov    %rdx,%rsi
+  8015b8:	48 89 c7             	mov    %rax,%rdi
+  8015bb:	ff d1                	call   *%rcx
+}
+  8015bd:	c9                   	leave
+  8015be:	c3                   	ret
+
+00000000008015bf <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8015bf:	55                   	push   %rbp
+  8015c0:	48 89 e5             	mov    %rsp,%rbp
+  8015c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8015c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d3:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015d9:	83 f8 20             	cmp    $0x20,%eax
+  8015dc:	75 07                	jne    8015e5 <pollwait_key+0x26>
+    return -E_INVAL;
+  8015de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e3:	eb 5f                	jmp    801644 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e9:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f3:	48 63 d2             	movslq %edx,%rdx
+  8015f6:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015fa:	48 01 c2             	add    %rax,%rdx
+  8015fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801601:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801608:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801612:	8b 00                	mov    (%rax),%eax
+  801614:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801618:	48 63 c9             	movslq %ecx,%rcx
+  80161b:	48 c1 e1 04          	shl    $0x4,%rcx
+  80161f:	48 01 ca             	add    %rcx,%rdx
+  801622:	48 83 c2 08          	add    $0x8,%rdx
+  801626:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801628:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80162c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801632:	8d 50 01             	lea    0x1(%rax),%edx
+  801635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801639:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801644:	c9                   	leave
+  801645:	c3                   	ret
+
+0000000000801646 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801646:	55                   	push   %rbp
+  801647:	48 89 e5             	mov    %rsp,%rbp
+  80164a:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801651:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801658:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80165e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801665:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80166c:	00 
+  int i, r, ready, ipc = 0;
+  80166d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  801674:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80167b:	00 
+  80167c:	74 45                	je     8016c3 <poll+0x7d>
+  80167e:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801685:	ff 
+  801686:	74 3b                	je     8016c3 <poll+0x7d>
+    now      = vsys_clock_ns();
+  801688:	48 b8 81 2b 80 00 00 	movabs $0x802b81,%rax
+  80168f:	00 00 00 
+  801692:	ff d0                	call   *%rax
+  801694:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801698:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80169c:	48 f7 d0             	not    %rax
+  80169f:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8016a6:	73 10                	jae    8016b8 <poll+0x72>
+  8016a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016ac:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8016b3:	48 01 d0             	add    %rdx,%rax
+  8016b6:	eb 07                	jmp    8016bf <poll+0x79>
+  8016b8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8016bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8016c3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016ca:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016d1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016d8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016df:	e9 46 02 00 00       	jmp    80192a <poll+0x2e4>
+      fds[i].revents = 0;
+  8016e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e7:	48 63 d0             	movslq %eax,%rdx
+  8016ea:	48 89 d0             	mov    %rdx,%rax
+  8016ed:	48 01 c0             	add    %rax,%rax
+  8016f0:	48 01 d0             	add    %rdx,%rax
+  8016f3:	48 c1 e0 02          	shl    $0x2,%rax
+  8016f7:	48 89 c2             	mov    %rax,%rdx
+  8016fa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801701:	48 01 d0             	add    %rdx,%rax
+  801704:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80170b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80170e:	48 63 d0             	movslq %eax,%rdx
+  801711:	48 89 d0             	mov    %rdx,%rax
+  801714:	48 01 c0             	add    %rax,%rax
+  801717:	48 01 d0             	add    %rdx,%rax
+  80171a:	48 c1 e0 02          	shl    $0x2,%rax
+  80171e:	48 89 c2             	mov    %rax,%rdx
+  801721:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801728:	48 01 d0             	add    %rdx,%rax
+  80172b:	8b 00                	mov    (%rax),%eax
+  80172d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801730:	75 62                	jne    801794 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  801732:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801735:	48 63 d0             	movslq %eax,%rdx
+  801738:	48 89 d0             	mov    %rdx,%rax
+  80173b:	48 01 c0             	add    %rax,%rax
+  80173e:	48 01 d0             	add    %rdx,%rax
+  801741:	48 c1 e0 02          	shl    $0x2,%rax
+  801745:	48 89 c2             	mov    %rax,%rdx
+  801748:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80174f:	48 01 d0             	add    %rdx,%rax
+  801752:	8b 40 04             	mov    0x4(%rax),%eax
+  801755:	83 e0 01             	and    $0x1,%eax
+  801758:	85 c0                	test   %eax,%eax
+  80175a:	0f 84 9b 01 00 00    	je     8018fb <poll+0x2b5>
+          fds[i].revents = ipc;
+  801760:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801763:	48 63 d0             	movslq %eax,%rdx
+  801766:	48 89 d0             	mov    %rdx,%rax
+  801769:	48 01 c0             	add    %rax,%rax
+  80176c:	48 01 d0             	add    %rdx,%rax
+  80176f:	48 c1 e0 02          	shl    $0x2,%rax
+  801773:	48 89 c2             	mov    %rax,%rdx
+  801776:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80177d:	48 01 c2             	add    %rax,%rdx
+  801780:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801783:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801786:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801789:	83 c8 04             	or     $0x4,%eax
+  80178c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80178f:	e9 67 01 00 00       	jmp    8018fb <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  801794:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801797:	48 63 d0             	movslq %eax,%rdx
+  80179a:	48 89 d0             	mov    %rdx,%rax
+  80179d:	48 01 c0             	add    %rax,%rax
+  8017a0:	48 01 d0             	add    %rdx,%rax
+  8017a3:	48 c1 e0 02          	shl    $0x2,%rax
+  8017a7:	48 89 c2             	mov    %rax,%rdx
+  8017aa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017b1:	48 01 d0             	add    %rdx,%rax
+  8017b4:	8b 00                	mov    (%rax),%eax
+  8017b6:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8017bd:	48 89 d6             	mov    %rdx,%rsi
+  8017c0:	89 c7                	mov    %eax,%edi
+  8017c2:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	78 25                	js     8017f7 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017d2:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017d9:	8b 00                	mov    (%rax),%eax
+  8017db:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017e2:	48 89 d6             	mov    %rdx,%rsi
+  8017e5:	89 c7                	mov    %eax,%edi
+  8017e7:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	79 2c                	jns    801823 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017fa:	48 63 d0             	movslq %eax,%rdx
+  8017fd:	48 89 d0             	mov    %rdx,%rax
+  801800:	48 01 c0             	add    %rax,%rax
+  801803:	48 01 d0             	add    %rdx,%rax
+  801806:	48 c1 e0 02          	shl    $0x2,%rax
+  80180a:	48 89 c2             	mov    %rax,%rdx
+  80180d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801814:	48 01 d0             	add    %rdx,%rax
+  801817:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80181e:	e9 d8 00 00 00       	jmp    8018fb <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  801823:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80182a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80182e:	48 85 c0             	test   %rax,%rax
+  801831:	74 7d                	je     8018b0 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  801833:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80183a:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80183e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801841:	48 63 d0             	movslq %eax,%rdx
+  801844:	48 89 d0             	mov    %rdx,%rax
+  801847:	48 01 c0             	add    %rax,%rax
+  80184a:	48 01 d0             	add    %rdx,%rax
+  80184d:	48 c1 e0 02          	shl    $0x2,%rax
+  801851:	48 89 c2             	mov    %rax,%rdx
+  801854:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80185b:	48 01 d0             	add    %rdx,%rax
+  80185e:	8b 48 04             	mov    0x4(%rax),%ecx
+  801861:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801868:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80186f:	89 ce                	mov    %ecx,%esi
+  801871:	48 89 c7             	mov    %rax,%rdi
+  801874:	41 ff d0             	call   *%r8
+  801877:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80187a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80187e:	79 08                	jns    801888 <poll+0x242>
+          return r;
+  801880:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801883:	e9 45 01 00 00       	jmp    8019cd <poll+0x387>
+        fds[i].revents = r;
+  801888:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80188b:	48 63 d0             	movslq %eax,%rdx
+  80188e:	48 89 d0             	mov    %rdx,%rax
+  801891:	48 01 c0             	add    %rax,%rax
+  801894:	48 01 d0             	add    %rdx,%rax
+  801897:	48 c1 e0 02          	shl    $0x2,%rax
+  80189b:	48 89 c2             	mov    %rax,%rdx
+  80189e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018a5:	48 01 c2             	add    %rax,%rdx
+  8018a8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018ab:	89 42 08             	mov    %eax,0x8(%rdx)
+  8018ae:	eb 4b                	jmp    8018fb <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8018b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b3:	48 63 d0             	movslq %eax,%rdx
+  8018b6:	48 89 d0             	mov    %rdx,%rax
+  8018b9:	48 01 c0             	add    %rax,%rax
+  8018bc:	48 01 d0             	add    %rdx,%rax
+  8018bf:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c3:	48 89 c2             	mov    %rax,%rdx
+  8018c6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018cd:	48 01 d0             	add    %rdx,%rax
+  8018d0:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d6:	48 63 d0             	movslq %eax,%rdx
+  8018d9:	48 89 d0             	mov    %rdx,%rax
+  8018dc:	48 01 c0             	add    %rax,%rax
+  8018df:	48 01 d0             	add    %rdx,%rax
+  8018e2:	48 c1 e0 02          	shl    $0x2,%rax
+  8018e6:	48 89 c2             	mov    %rax,%rdx
+  8018e9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018f0:	48 01 d0             	add    %rdx,%rax
+  8018f3:	83 e1 03             	and    $0x3,%ecx
+  8018f6:	89 ca                	mov    %ecx,%edx
+  8018f8:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018fe:	48 63 d0             	movslq %eax,%rdx
+  801901:	48 89 d0             	mov    %rdx,%rax
+  801904:	48 01 c0             	add    %rax,%rax
+  801907:	48 01 d0             	add    %rdx,%rax
+  80190a:	48 c1 e0 02          	shl    $0x2,%rax
+  80190e:	48 89 c2             	mov    %rax,%rdx
+  801911:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801918:	48 01 d0             	add    %rdx,%rax
+  80191b:	8b 40 08             	mov    0x8(%rax),%eax
+  80191e:	85 c0                	test   %eax,%eax
+  801920:	74 04                	je     801926 <poll+0x2e0>
+        ready++;
+  801922:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801926:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80192a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80192d:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  801933:	0f 8c ab fd ff ff    	jl     8016e4 <poll+0x9e>
+    }
+    if (ready)
+  801939:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80193d:	74 08                	je     801947 <poll+0x301>
+      return ready;
+  80193f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801942:	e9 86 00 00 00       	jmp    8019cd <poll+0x387>
+
+    if (deadline) {
+  801947:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80194c:	74 30                	je     80197e <poll+0x338>
+      now     = vsys_clock_ns();
+  80194e:	48 b8 81 2b 80 00 00 	movabs $0x802b81,%rax
+  801955:	00 00 00 
+  801958:	ff d0                	call   *%rax
+  80195a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80195e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801962:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801966:	73 0a                	jae    801972 <poll+0x32c>
+  801968:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80196c:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801970:	eb 05                	jmp    801977 <poll+0x331>
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80197e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801981:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  801984:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80198b:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  801992:	48 89 c7             	mov    %rax,%rdi
+  801995:	48 b8 2a 08 80 00 00 	movabs $0x80082a,%rax
+  80199c:	00 00 00 
+  80199f:	ff d0                	call   *%rax
+  8019a1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8019a4:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8019a8:	75 07                	jne    8019b1 <poll+0x36b>
+      return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019af:	eb 1c                	jmp    8019cd <poll+0x387>
+    if (r < 0)
+  8019b1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8019b5:	79 05                	jns    8019bc <poll+0x376>
+      return r;
+  8019b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019ba:	eb 11                	jmp    8019cd <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8019bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019bf:	c1 f8 02             	sar    $0x2,%eax
+  8019c2:	83 e0 01             	and    $0x1,%eax
+  8019c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8019c8:	e9 f6 fc ff ff       	jmp    8016c3 <poll+0x7d>
+  }
+}
+  8019cd:	c9                   	leave
+  8019ce:	c3                   	ret
+
+00000000008019cf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019cf:	55                   	push   %rbp
+  8019d0:	48 89 e5             	mov    %rsp,%rbp
+  8019d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8019d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e8:	48 89 c7             	mov    %rax,%rdi
+  8019eb:	48 b8 bd 1a 80 00 00 	movabs $0x801abd,%rax
+  8019f2:	00 00 00 
+  8019f5:	ff d0                	call   *%rax
+  8019f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019fe:	79 05                	jns    801a05 <stat+0x36>
+    return fd;
+  801a00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a03:	eb 2f                	jmp    801a34 <stat+0x65>
+  r = fstat(fd, stat);
+  801a05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a0c:	48 89 d6             	mov    %rdx,%rsi
+  801a0f:	89 c7                	mov    %eax,%edi
+  801a11:	48 b8 06 15 80 00 00 	movabs $0x801506,%rax
+  801a18:	00 00 00 
+  801a1b:	ff d0                	call   *%rax
+  801a1d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  801a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a23:	89 c7                	mov    %eax,%edi
+  801a25:	48 b8 6e 0e 80 00 00 	movabs $0x800e6e,%rax
+  801a2c:	00 00 00 
+  801a2f:	ff d0                	call   *%rax
+  return r;
+  801a31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a34:	c9                   	leave
+  801a35:	c3                   	ret
+
+0000000000801a36 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a36:	55                   	push   %rbp
+  801a37:	48 89 e5             	mov    %rsp,%rbp
+  801a3a:	48 83 ec 10          	sub    $0x10,%rsp
+  801a3e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a41:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a45:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a4c:	00 00 00 
+  801a4f:	8b 00                	mov    (%rax),%eax
+  801a51:	85 c0                	test   %eax,%eax
+  801a53:	75 1d                	jne    801a72 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a55:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a5a:	48 b8 89 4e 80 00 00 	movabs $0x804e89,%rax
+  801a61:	00 00 00 
+  801a64:	ff d0                	call   *%rax
+  801a66:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a6d:	00 00 00 
+  801a70:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a72:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a79:	00 00 00 
+  801a7c:	8b 00                	mov    (%rax),%eax
+  801a7e:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a81:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a86:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a8d:	00 00 00 
+  801a90:	89 c7                	mov    %eax,%edi
+  801a92:	48 b8 dc 4d 80 00 00 	movabs $0x804ddc,%rax
+  801a99:	00 00 00 
+  801a9c:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa7:	48 89 c6             	mov    %rax,%rsi
+  801aaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aaf:	48 b8 5f 4c 80 00 00 	movabs $0x804c5f,%rax
+  801ab6:	00 00 00 
+  801ab9:	ff d0                	call   *%rax
+}
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+0000000000801abd <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801abd:	55                   	push   %rbp
+  801abe:	48 89 e5             	mov    %rsp,%rbp
+  801ac1:	48 83 ec 20          	sub    $0x20,%rsp
+  801ac5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ac9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad0:	48 89 c7             	mov    %rax,%rdi
+  801ad3:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  801ada:	00 00 00 
+  801add:	ff d0                	call   *%rax
+  801adf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ae4:	7e 0a                	jle    801af0 <open+0x33>
+    return -E_BAD_PATH;
+  801ae6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aeb:	e9 a8 00 00 00       	jmp    801b98 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801af0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801af4:	48 89 c7             	mov    %rax,%rdi
+  801af7:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+  801b03:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b06:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b0a:	79 08                	jns    801b14 <open+0x57>
+    return r;
+  801b0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b0f:	e9 84 00 00 00       	jmp    801b98 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b18:	48 89 c6             	mov    %rax,%rsi
+  801b1b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801b22:	00 00 00 
+  801b25:	48 89 c7             	mov    %rax,%rdi
+  801b28:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b34:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b3b:	00 00 00 
+  801b3e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b41:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4b:	48 89 c6             	mov    %rax,%rsi
+  801b4e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b53:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b66:	79 1d                	jns    801b85 <open+0xc8>
+    fd_close(fd, 0);
+  801b68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b6c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b71:	48 89 c7             	mov    %rax,%rdi
+  801b74:	48 b8 cf 0c 80 00 00 	movabs $0x800ccf,%rax
+  801b7b:	00 00 00 
+  801b7e:	ff d0                	call   *%rax
+    return r;
+  801b80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b83:	eb 13                	jmp    801b98 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b89:	48 89 c7             	mov    %rax,%rdi
+  801b8c:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  801b93:	00 00 00 
+  801b96:	ff d0                	call   *%rax
+}
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+0000000000801b9a <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	48 83 ec 10          	sub    $0x10,%rsp
+  801ba2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801baa:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bad:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bb4:	00 00 00 
+  801bb7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801bb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bbe:	bf 06 00 00 00       	mov    $0x6,%edi
+  801bc3:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801bca:	00 00 00 
+  801bcd:	ff d0                	call   *%rax
+}
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+
+0000000000801bd1 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801bd1:	55                   	push   %rbp
+  801bd2:	48 89 e5             	mov    %rsp,%rbp
+  801bd5:	48 83 ec 30          	sub    $0x30,%rsp
+  801bd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bdd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801be1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801be5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bea:	74 07                	je     801bf3 <devfile_read+0x22>
+  801bec:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bf1:	75 0a                	jne    801bfd <devfile_read+0x2c>
+  return E_INVAL;
+  801bf3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bf8:	e9 b4 00 00 00       	jmp    801cb1 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bfd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801c04:	00 
+  while (n) {
+  801c05:	e9 98 00 00 00       	jmp    801ca2 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c0e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c11:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c18:	00 00 00 
+  801c1b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801c1d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c24:	00 00 00 
+  801c27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c2f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c34:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c39:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801c40:	00 00 00 
+  801c43:	ff d0                	call   *%rax
+  801c45:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c48:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c4c:	7f 13                	jg     801c61 <devfile_read+0x90>
+      return res ? res : res0;
+  801c4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c52:	74 07                	je     801c5b <devfile_read+0x8a>
+  801c54:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c57:	48 98                	cltq
+  801c59:	eb 56                	jmp    801cb1 <devfile_read+0xe0>
+  801c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5f:	eb 50                	jmp    801cb1 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c61:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c64:	48 63 d0             	movslq %eax,%rdx
+  801c67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c6b:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c72:	00 00 00 
+  801c75:	48 89 ce             	mov    %rcx,%rsi
+  801c78:	48 89 c7             	mov    %rax,%rdi
+  801c7b:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+
+    buf += res;
+  801c87:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c8a:	48 98                	cltq
+  801c8c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c93:	48 98                	cltq
+  801c95:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c99:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c9c:	48 98                	cltq
+  801c9e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801ca2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801ca7:	0f 85 5d ff ff ff    	jne    801c0a <devfile_read+0x39>
+  }
+
+  return res0;
+  801cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801cb1:	c9                   	leave
+  801cb2:	c3                   	ret
+
+0000000000801cb3 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801cb3:	55                   	push   %rbp
+  801cb4:	48 89 e5             	mov    %rsp,%rbp
+  801cb7:	48 83 ec 50          	sub    $0x50,%rsp
+  801cbb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801cbf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801cc3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801cc7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ccc:	74 07                	je     801cd5 <devfile_write+0x22>
+  801cce:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801cd3:	75 0a                	jne    801cdf <devfile_write+0x2c>
+  return E_INVAL;
+  801cd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cda:	e9 c9 00 00 00       	jmp    801da8 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801cdf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ce6:	00 
+
+  while (n) {
+  801ce7:	e9 ad 00 00 00       	jmp    801d99 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cec:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cf0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cf4:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cfb:	00 
+  801cfc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d04:	48 39 c2             	cmp    %rax,%rdx
+  801d07:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801d0b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801d0f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801d13:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d17:	48 89 c6             	mov    %rax,%rsi
+  801d1a:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801d21:	00 00 00 
+  801d24:	48 89 c7             	mov    %rax,%rdi
+  801d27:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d37:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d3a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d41:	00 00 00 
+  801d44:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d46:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d4d:	00 00 00 
+  801d50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d54:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d58:	be 00 00 00 00       	mov    $0x0,%esi
+  801d5d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d62:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801d69:	00 00 00 
+  801d6c:	ff d0                	call   *%rax
+  801d6e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d71:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d75:	79 07                	jns    801d7e <devfile_write+0xcb>
+      return res;
+  801d77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d7a:	48 98                	cltq
+  801d7c:	eb 2a                	jmp    801da8 <devfile_write+0xf5>
+
+    buf += res;
+  801d7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d81:	48 98                	cltq
+  801d83:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d8a:	48 98                	cltq
+  801d8c:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d93:	48 98                	cltq
+  801d95:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d99:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d9e:	0f 85 48 ff ff ff    	jne    801cec <devfile_write+0x39>
+  }
+
+  return res0;
+  801da4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801da8:	c9                   	leave
+  801da9:	c3                   	ret
+
+0000000000801daa <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801daa:	55                   	push   %rbp
+  801dab:	48 89 e5             	mov    %rsp,%rbp
+  801dae:	48 83 ec 20          	sub    $0x20,%rsp
+  801db2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801db6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dbe:	8b 40 0c             	mov    0xc(%rax),%eax
+  801dc1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dc8:	00 00 00 
+  801dcb:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dcd:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd2:	bf 05 00 00 00       	mov    $0x5,%edi
+  801dd7:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+  801de3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801de6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dea:	79 05                	jns    801df1 <devfile_stat+0x47>
+    return r;
+  801dec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801def:	eb 59                	jmp    801e4a <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801df1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dfc:	00 00 00 
+  801dff:	48 89 d6             	mov    %rdx,%rsi
+  801e02:	48 89 c7             	mov    %rax,%rdi
+  801e05:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801e11:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e18:	00 00 00 
+  801e1b:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801e21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e25:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e2b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e32:	00 00 00 
+  801e35:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e3f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e4a:	c9                   	leave
+  801e4b:	c3                   	ret
+
+0000000000801e4c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+  801e50:	48 83 ec 10          	sub    $0x10,%rsp
+  801e54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e58:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e5f:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e62:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e69:	00 00 00 
+  801e6c:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e6e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e75:	00 00 00 
+  801e78:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e7b:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e83:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e88:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+}
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+
+0000000000801e96 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e96:	55                   	push   %rbp
+  801e97:	48 89 e5             	mov    %rsp,%rbp
+  801e9a:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ea2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801ea5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801ea9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801eac:	83 e0 03             	and    $0x3,%eax
+}
+  801eaf:	c9                   	leave
+  801eb0:	c3                   	ret
+
+0000000000801eb1 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801eb1:	55                   	push   %rbp
+  801eb2:	48 89 e5             	mov    %rsp,%rbp
+  801eb5:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801ebd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec1:	48 89 c7             	mov    %rax,%rdi
+  801ec4:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+  801ed0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ed5:	7e 07                	jle    801ede <remove+0x2d>
+    return -E_BAD_PATH;
+  801ed7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801edc:	eb 36                	jmp    801f14 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801ede:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ee2:	48 89 c6             	mov    %rax,%rsi
+  801ee5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801eec:	00 00 00 
+  801eef:	48 89 c7             	mov    %rax,%rdi
+  801ef2:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801efe:	be 00 00 00 00       	mov    $0x0,%esi
+  801f03:	bf 07 00 00 00       	mov    $0x7,%edi
+  801f08:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+}
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+
+0000000000801f16 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f1a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f24:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801f2b:	00 00 00 
+  801f2e:	ff d0                	call   *%rax
+}
+  801f30:	5d                   	pop    %rbp
+  801f31:	c3                   	ret
+
+0000000000801f32 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f32:	55                   	push   %rbp
+  801f33:	48 89 e5             	mov    %rsp,%rbp
+  801f36:	48 83 ec 20          	sub    $0x20,%rsp
+  801f3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f3e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f43:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f48:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801f4f:	00 00 00 
+  801f52:	ff d0                	call   *%rax
+  801f54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f5b:	79 05                	jns    801f62 <fs_stats+0x30>
+    return r;
+  801f5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f60:	eb 2a                	jmp    801f8c <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f66:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f6b:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f72:	00 00 00 
+  801f75:	48 89 ce             	mov    %rcx,%rsi
+  801f78:	48 89 c7             	mov    %rax,%rdi
+  801f7b:	48 b8 84 46 80 00 00 	movabs $0x804684,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  return 0;
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8c:	c9                   	leave
+  801f8d:	c3                   	ret
+
+0000000000801f8e <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f8e:	55                   	push   %rbp
+  801f8f:	48 89 e5             	mov    %rsp,%rbp
+  801f92:	48 83 ec 10          	sub    $0x10,%rsp
+  801f96:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f99:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fa0:	00 00 00 
+  801fa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fa6:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  801fad:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801fb2:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801fb9:	00 00 00 
+  801fbc:	ff d0                	call   *%rax
+}
+  801fbe:	c9                   	leave
+  801fbf:	c3                   	ret
+
+0000000000801fc0 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801fc0:	55                   	push   %rbp
+  801fc1:	48 89 e5             	mov    %rsp,%rbp
+  801fc4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc8:	89 f8                	mov    %edi,%eax
+  801fca:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801fcd:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801fd1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fd8:	00 00 00 
+  801fdb:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fdd:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fe7:	48 b8 36 1a 80 00 00 	movabs $0x801a36,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+}
+  801ff3:	c9                   	leave
+  801ff4:	c3                   	ret
+
+0000000000801ff5 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+  801ff9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ffd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  802001:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802005:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80200a:	48 89 c7             	mov    %rax,%rdi
+  80200d:	48 b8 1b 20 80 00 00 	movabs $0x80201b,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+}
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+
+000000000080201b <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+  80201f:	48 83 ec 50          	sub    $0x50,%rsp
+  802023:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802027:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  80202b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802032:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  802033:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802038:	74 0a                	je     802044 <pipe_size+0x29>
+  80203a:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802041:	00 
+  802042:	76 0a                	jbe    80204e <pipe_size+0x33>
+    return -E_INVAL;
+  802044:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802049:	e9 cc 02 00 00       	jmp    80231a <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80204e:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802052:	48 89 c7             	mov    %rax,%rdi
+  802055:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+  802061:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802064:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802068:	0f 88 a8 02 00 00    	js     802316 <pipe_size+0x2fb>
+  80206e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802072:	ba 07 04 00 00       	mov    $0x407,%edx
+  802077:	48 89 c6             	mov    %rax,%rsi
+  80207a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207f:	48 b8 e2 03 80 00 00 	movabs $0x8003e2,%rax
+  802086:	00 00 00 
+  802089:	ff d0                	call   *%rax
+  80208b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80208e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802092:	0f 88 7e 02 00 00    	js     802316 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802098:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80209c:	48 89 c7             	mov    %rax,%rdi
+  80209f:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+  8020ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b2:	0f 88 43 02 00 00    	js     8022fb <pipe_size+0x2e0>
+  8020b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8020bc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020c1:	48 89 c6             	mov    %rax,%rsi
+  8020c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c9:	48 b8 e2 03 80 00 00 	movabs $0x8003e2,%rax
+  8020d0:	00 00 00 
+  8020d3:	ff d0                	call   *%rax
+  8020d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020dc:	0f 88 19 02 00 00    	js     8022fb <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020e6:	48 89 c7             	mov    %rax,%rdi
+  8020e9:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+  8020f5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020f9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802100:	00 
+  802101:	e9 a2 00 00 00       	jmp    8021a8 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802106:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80210a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80210e:	48 89 c2             	mov    %rax,%rdx
+  802111:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802115:	48 01 d0             	add    %rdx,%rax
+  802118:	ba 07 04 00 00       	mov    $0x407,%edx
+  80211d:	48 89 c6             	mov    %rax,%rsi
+  802120:	bf 00 00 00 00       	mov    $0x0,%edi
+  802125:	48 b8 e2 03 80 00 00 	movabs $0x8003e2,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802134:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802138:	0f 88 37 01 00 00    	js     802275 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80213e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802142:	48 89 c7             	mov    %rax,%rdi
+  802145:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+  802151:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802155:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802159:	48 01 c2             	add    %rax,%rdx
+  80215c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802160:	48 c1 e0 0c          	shl    $0xc,%rax
+  802164:	48 89 c1             	mov    %rax,%rcx
+  802167:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80216b:	48 01 c8             	add    %rcx,%rax
+  80216e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  802174:	48 89 d1             	mov    %rdx,%rcx
+  802177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217c:	48 89 c6             	mov    %rax,%rsi
+  80217f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802184:	48 b8 3a 04 80 00 00 	movabs $0x80043a,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+  802190:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802193:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802197:	79 0a                	jns    8021a3 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802199:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80219e:	e9 d3 00 00 00       	jmp    802276 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8021a3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8021a8:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8021af:	00 
+  8021b0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021b8:	48 01 d0             	add    %rdx,%rax
+  8021bb:	48 83 c0 1f          	add    $0x1f,%rax
+  8021bf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8021c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cc:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8021d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d4:	48 29 d0             	sub    %rdx,%rax
+  8021d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021db:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021df:	0f 82 21 ff ff ff    	jb     802106 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021f1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021f5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021fd:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802204:	00 00 00 
+  802207:	8b 12                	mov    (%rdx),%edx
+  802209:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80220b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80220f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  802216:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80221a:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802221:	00 00 00 
+  802224:	8b 12                	mov    (%rdx),%edx
+  802226:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  802228:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80222c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  802233:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802237:	48 89 c7             	mov    %rax,%rdi
+  80223a:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+  802246:	89 c2                	mov    %eax,%edx
+  802248:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80224c:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80224e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802252:	48 89 c7             	mov    %rax,%rdi
+  802255:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802265:	48 83 c2 04          	add    $0x4,%rdx
+  802269:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80226b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802270:	e9 a5 00 00 00       	jmp    80231a <pipe_size+0x2ff>
+      goto err2;
+  802275:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802276:	eb 58                	jmp    8022d0 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802278:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80227c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802280:	48 89 c2             	mov    %rax,%rdx
+  802283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802287:	48 01 d0             	add    %rdx,%rax
+  80228a:	48 89 c6             	mov    %rax,%rsi
+  80228d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802292:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  802299:	00 00 00 
+  80229c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80229e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a2:	48 89 c7             	mov    %rax,%rdi
+  8022a5:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  8022ac:	00 00 00 
+  8022af:	ff d0                	call   *%rax
+  8022b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022b5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8022b9:	48 01 d0             	add    %rdx,%rax
+  8022bc:	48 89 c6             	mov    %rax,%rsi
+  8022bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c4:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  8022cb:	00 00 00 
+  8022ce:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8022d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022d4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022d8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022dc:	48 85 c0             	test   %rax,%rax
+  8022df:	75 97                	jne    802278 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022e5:	48 89 c6             	mov    %rax,%rsi
+  8022e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ed:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	eb 01                	jmp    8022fc <pipe_size+0x2e1>
+    goto err1;
+  8022fb:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802300:	48 89 c6             	mov    %rax,%rsi
+  802303:	bf 00 00 00 00       	mov    $0x0,%edi
+  802308:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	eb 01                	jmp    802317 <pipe_size+0x2fc>
+    goto err;
+  802316:	90                   	nop
+err:
+  return r;
+  802317:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80231a:	c9                   	leave
+  80231b:	c3                   	ret
+
+000000000080231c <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80231c:	55                   	push   %rbp
+  80231d:	48 89 e5             	mov    %rsp,%rbp
+  802320:	53                   	push   %rbx
+  802321:	48 83 ec 28          	sub    $0x28,%rsp
+  802325:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802329:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80232d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802334:	00 00 00 
+  802337:	8b 40 04             	mov    0x4(%rax),%eax
+  80233a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80233f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802346:	00 00 00 
+  802349:	48 98                	cltq
+  80234b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802352:	48 01 d0             	add    %rdx,%rax
+  802355:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80235b:	8b 00                	mov    (%rax),%eax
+  80235d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  802360:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802364:	48 89 c7             	mov    %rax,%rdi
+  802367:	48 b8 fa 4e 80 00 00 	movabs $0x804efa,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+  802373:	89 c3                	mov    %eax,%ebx
+  802375:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802379:	48 89 c7             	mov    %rax,%rdi
+  80237c:	48 b8 fa 4e 80 00 00 	movabs $0x804efa,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+  802388:	39 c3                	cmp    %eax,%ebx
+  80238a:	0f 94 c0             	sete   %al
+  80238d:	0f b6 c0             	movzbl %al,%eax
+  802390:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  802393:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80239a:	00 00 00 
+  80239d:	8b 40 04             	mov    0x4(%rax),%eax
+  8023a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023a5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023ac:	00 00 00 
+  8023af:	48 98                	cltq
+  8023b1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023b8:	48 01 d0             	add    %rdx,%rax
+  8023bb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023c1:	8b 00                	mov    (%rax),%eax
+  8023c3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8023c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023c9:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023cc:	75 05                	jne    8023d3 <_pipeisclosed+0xb7>
+      return ret;
+  8023ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023d1:	eb 68                	jmp    80243b <_pipeisclosed+0x11f>
+    if (n != nn)
+  8023d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023d6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023d9:	0f 84 4e ff ff ff    	je     80232d <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023df:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023e6:	00 00 00 
+  8023e9:	8b 40 04             	mov    0x4(%rax),%eax
+  8023ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023f1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023f8:	00 00 00 
+  8023fb:	48 98                	cltq
+  8023fd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802404:	48 01 d0             	add    %rdx,%rax
+  802407:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80240d:	8b 10                	mov    (%rax),%edx
+  80240f:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  802412:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802415:	89 c6                	mov    %eax,%esi
+  802417:	48 b8 c8 50 80 00 00 	movabs $0x8050c8,%rax
+  80241e:	00 00 00 
+  802421:	48 89 c7             	mov    %rax,%rdi
+  802424:	b8 00 00 00 00       	mov    $0x0,%eax
+  802429:	49 b8 91 31 80 00 00 	movabs $0x803191,%r8
+  802430:	00 00 00 
+  802433:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802436:	e9 f2 fe ff ff       	jmp    80232d <_pipeisclosed+0x11>
+  }
+}
+  80243b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80243f:	c9                   	leave
+  802440:	c3                   	ret
+
+0000000000802441 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802441:	55                   	push   %rbp
+  802442:	48 89 e5             	mov    %rsp,%rbp
+  802445:	48 83 ec 30          	sub    $0x30,%rsp
+  802449:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80244c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802450:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802453:	48 89 d6             	mov    %rdx,%rsi
+  802456:	89 c7                	mov    %eax,%edi
+  802458:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+  802464:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802467:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80246b:	79 05                	jns    802472 <pipeisclosed+0x31>
+    return r;
+  80246d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802470:	eb 31                	jmp    8024a3 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  802472:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802476:	48 89 c7             	mov    %rax,%rdi
+  802479:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+  802485:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802489:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80248d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802491:	48 89 d6             	mov    %rdx,%rsi
+  802494:	48 89 c7             	mov    %rax,%rdi
+  802497:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+}
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+00000000008024a5 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8024b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b5:	8b 40 18             	mov    0x18(%rax),%eax
+  8024b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8024bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024bf:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8024c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c6:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	74 27                	je     8024f4 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8024cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d1:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024dc:	48 83 c0 18          	add    $0x18,%rax
+  8024e0:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024e5:	48 89 c7             	mov    %rax,%rdi
+  8024e8:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  8024ef:	00 00 00 
+  8024f2:	ff d0                	call   *%rax
+  }
+}
+  8024f4:	90                   	nop
+  8024f5:	c9                   	leave
+  8024f6:	c3                   	ret
+
+00000000008024f7 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024f7:	55                   	push   %rbp
+  8024f8:	48 89 e5             	mov    %rsp,%rbp
+  8024fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802503:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  802506:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80250a:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  802511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802515:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  802519:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80251c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  802523:	89 c6                	mov    %eax,%esi
+  802525:	48 89 cf             	mov    %rcx,%rdi
+  802528:	48 b8 8e 07 80 00 00 	movabs $0x80078e,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+}
+  802534:	90                   	nop
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+0000000000802537 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802537:	55                   	push   %rbp
+  802538:	48 89 e5             	mov    %rsp,%rbp
+  80253b:	48 83 ec 70          	sub    $0x70,%rsp
+  80253f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802543:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802547:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80254b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80254f:	48 89 c7             	mov    %rax,%rdi
+  802552:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+  80255e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802562:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802567:	75 0a                	jne    802573 <devpipe_read+0x3c>
+    return 0;
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	e9 63 01 00 00       	jmp    8026d6 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  802573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802577:	8b 40 18             	mov    0x18(%rax),%eax
+  80257a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80257d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802581:	48 8b 10             	mov    (%rax),%rdx
+  802584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802588:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80258c:	48 39 c2             	cmp    %rax,%rdx
+  80258f:	75 42                	jne    8025d3 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  802591:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802595:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802599:	48 89 d6             	mov    %rdx,%rsi
+  80259c:	48 89 c7             	mov    %rax,%rdi
+  80259f:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	74 0a                	je     8025b9 <devpipe_read+0x82>
+      return 0;
+  8025af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b4:	e9 1d 01 00 00       	jmp    8026d6 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8025b9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8025bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c0:	89 d6                	mov    %edx,%esi
+  8025c2:	48 89 c7             	mov    %rax,%rdi
+  8025c5:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8025d1:	eb a0                	jmp    802573 <devpipe_read+0x3c>
+      break;
+  8025d3:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8025d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025dc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025f0:	48 8b 00             	mov    (%rax),%rax
+  8025f3:	48 29 c2             	sub    %rax,%rdx
+  8025f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802602:	48 39 c2             	cmp    %rax,%rdx
+  802605:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802609:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80260d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802611:	48 8b 00             	mov    (%rax),%rax
+  802614:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802618:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80261c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802621:	48 f7 f1             	div    %rcx
+  802624:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  802628:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80262c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802630:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802634:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802638:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80263c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802640:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802644:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802648:	48 39 c2             	cmp    %rax,%rdx
+  80264b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80264f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802657:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80265b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80265f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  802663:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802667:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80266b:	48 89 ce             	mov    %rcx,%rsi
+  80266e:	48 89 c7             	mov    %rax,%rdi
+  802671:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  802678:	00 00 00 
+  80267b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80267d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802681:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802685:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802689:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80268d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802691:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802695:	48 01 d1             	add    %rdx,%rcx
+  802698:	48 89 c2             	mov    %rax,%rdx
+  80269b:	48 89 cf             	mov    %rcx,%rdi
+  80269e:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  8026a5:	00 00 00 
+  8026a8:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8026aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026ae:	48 8b 10             	mov    (%rax),%rdx
+  8026b1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8026b5:	48 01 c2             	add    %rax,%rdx
+  8026b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026bc:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8026bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026c3:	48 89 c7             	mov    %rax,%rdi
+  8026c6:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+  return n;
+  8026d2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+00000000008026d8 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+  8026dc:	48 83 ec 70          	sub    $0x70,%rsp
+  8026e0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026e4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026e8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026f0:	48 89 c7             	mov    %rax,%rdi
+  8026f3:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+  8026ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  802703:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802707:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80270b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802712:	00 
+  802713:	e9 b8 01 00 00       	jmp    8028d0 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  802718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80271c:	8b 40 18             	mov    0x18(%rax),%eax
+  80271f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  802722:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802726:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80272a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80272e:	48 8b 00             	mov    (%rax),%rax
+  802731:	48 29 c2             	sub    %rax,%rdx
+  802734:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802738:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80273c:	48 39 c2             	cmp    %rax,%rdx
+  80273f:	75 4d                	jne    80278e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802741:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802745:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802749:	48 89 d6             	mov    %rdx,%rsi
+  80274c:	48 89 c7             	mov    %rax,%rdi
+  80274f:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  802756:	00 00 00 
+  802759:	ff d0                	call   *%rax
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	74 0a                	je     802769 <devpipe_write+0x91>
+        return 0;
+  80275f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802764:	e9 79 01 00 00       	jmp    8028e2 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802769:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80276c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802770:	89 d6                	mov    %edx,%esi
+  802772:	48 89 c7             	mov    %rax,%rdi
+  802775:	48 b8 f7 24 80 00 00 	movabs $0x8024f7,%rax
+  80277c:	00 00 00 
+  80277f:	ff d0                	call   *%rax
+      m = 0;
+  802781:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802788:	00 
+      continue;
+  802789:	e9 3a 01 00 00       	jmp    8028c8 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80278e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802792:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802796:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80279a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80279e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8027a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a6:	48 8b 08             	mov    (%rax),%rcx
+  8027a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027b1:	48 29 c1             	sub    %rax,%rcx
+  8027b4:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8027b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8027bc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027c4:	48 39 c2             	cmp    %rax,%rdx
+  8027c7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027cb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8027cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027db:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e4:	48 f7 f1             	div    %rcx
+  8027e7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027ef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027fb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027ff:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802803:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802807:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80280b:	48 39 c2             	cmp    %rax,%rdx
+  80280e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802812:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802816:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80281a:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80281e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802822:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  802826:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80282a:	48 01 d1             	add    %rdx,%rcx
+  80282d:	48 89 c2             	mov    %rax,%rdx
+  802830:	48 89 cf             	mov    %rcx,%rdi
+  802833:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  80283a:	00 00 00 
+  80283d:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80283f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802843:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802847:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80284b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80284f:	73 4d                	jae    80289e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802855:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80285d:	48 29 c2             	sub    %rax,%rdx
+  802860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802864:	48 01 c2             	add    %rax,%rdx
+  802867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80286b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80286f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802873:	48 89 c1             	mov    %rax,%rcx
+  802876:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80287a:	48 01 c1             	add    %rax,%rcx
+  80287d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802881:	48 01 c1             	add    %rax,%rcx
+  802884:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802888:	48 83 c0 20          	add    $0x20,%rax
+  80288c:	48 89 ce             	mov    %rcx,%rsi
+  80288f:	48 89 c7             	mov    %rax,%rdi
+  802892:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80289e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028a2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8028a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028aa:	48 01 c2             	add    %rax,%rdx
+  8028ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028b1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8028b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028b9:	48 89 c7             	mov    %rax,%rdi
+  8028bc:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8028c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028cc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8028d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028d4:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028d8:	0f 82 3a fe ff ff    	jb     802718 <devpipe_write+0x40>
+  }
+
+  return i;
+  8028de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028e2:	c9                   	leave
+  8028e3:	c3                   	ret
+
+00000000008028e4 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028e4:	55                   	push   %rbp
+  8028e5:	48 89 e5             	mov    %rsp,%rbp
+  8028e8:	48 83 ec 40          	sub    $0x40,%rsp
+  8028ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028f0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028fb:	48 89 c7             	mov    %rax,%rdi
+  8028fe:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80290e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  802915:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802919:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80291d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802921:	48 89 d6             	mov    %rdx,%rsi
+  802924:	48 89 c7             	mov    %rax,%rdi
+  802927:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  80292e:	00 00 00 
+  802931:	ff d0                	call   *%rax
+  802933:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802936:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80293a:	79 08                	jns    802944 <devpipe_poll+0x60>
+    return r;
+  80293c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80293f:	e9 85 00 00 00       	jmp    8029c9 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802944:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802947:	83 e0 01             	and    $0x1,%eax
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	74 18                	je     802966 <devpipe_poll+0x82>
+  80294e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802952:	48 8b 10             	mov    (%rax),%rdx
+  802955:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802959:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80295d:	48 39 c2             	cmp    %rax,%rdx
+  802960:	74 04                	je     802966 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802962:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802966:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802969:	83 e0 02             	and    $0x2,%eax
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	74 23                	je     802993 <devpipe_poll+0xaf>
+  802970:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802974:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80297c:	48 8b 00             	mov    (%rax),%rax
+  80297f:	48 29 c2             	sub    %rax,%rdx
+  802982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802986:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80298a:	48 39 c2             	cmp    %rax,%rdx
+  80298d:	73 04                	jae    802993 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80298f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  802993:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802997:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80299b:	48 89 d6             	mov    %rdx,%rsi
+  80299e:	48 89 c7             	mov    %rax,%rdi
+  8029a1:	48 b8 1c 23 80 00 00 	movabs $0x80231c,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+  8029ad:	85 c0                	test   %eax,%eax
+  8029af:	74 04                	je     8029b5 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8029b1:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8029b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029b9:	75 0b                	jne    8029c6 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8029bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029bf:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8029c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029c9:	c9                   	leave
+  8029ca:	c3                   	ret
+
+00000000008029cb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029cb:	55                   	push   %rbp
+  8029cc:	48 89 e5             	mov    %rsp,%rbp
+  8029cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8029d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029df:	48 89 c7             	mov    %rax,%rdi
+  8029e2:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  8029e9:	00 00 00 
+  8029ec:	ff d0                	call   *%rax
+  8029ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f6:	48 ba f9 50 80 00 00 	movabs $0x8050f9,%rdx
+  8029fd:	00 00 00 
+  802a00:	48 89 d6             	mov    %rdx,%rsi
+  802a03:	48 89 c7             	mov    %rax,%rdi
+  802a06:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  802a0d:	00 00 00 
+  802a10:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  802a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a1a:	89 c1                	mov    %eax,%ecx
+  802a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a20:	48 8b 00             	mov    (%rax),%rax
+  802a23:	89 c2                	mov    %eax,%edx
+  802a25:	89 c8                	mov    %ecx,%eax
+  802a27:	29 d0                	sub    %edx,%eax
+  802a29:	89 c2                	mov    %eax,%edx
+  802a2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a2f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a39:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a40:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a47:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a4e:	00 00 00 
+  802a51:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+0000000000802a5f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a5f:	55                   	push   %rbp
+  802a60:	48 89 e5             	mov    %rsp,%rbp
+  802a63:	48 83 ec 40          	sub    $0x40,%rsp
+  802a67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a6f:	48 89 c7             	mov    %rax,%rdi
+  802a72:	48 b8 ec 0a 80 00 00 	movabs $0x800aec,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+  802a7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a82:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a89:	00 
+  802a8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a8e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a96:	48 01 d0             	add    %rdx,%rax
+  802a99:	48 83 c0 1f          	add    $0x1f,%rax
+  802a9d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802aa1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802aa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aaa:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802aae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ab2:	48 29 d0             	sub    %rdx,%rax
+  802ab5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ab9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802abd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ac1:	48 89 c6             	mov    %rax,%rsi
+  802ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac9:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802ad5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ad9:	48 89 c7             	mov    %rax,%rdi
+  802adc:	48 b8 a5 24 80 00 00 	movabs $0x8024a5,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ae8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802af0:	eb 2f                	jmp    802b21 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802af2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802af6:	48 83 e8 01          	sub    $0x1,%rax
+  802afa:	48 c1 e0 0c          	shl    $0xc,%rax
+  802afe:	48 89 c2             	mov    %rax,%rdx
+  802b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b05:	48 01 d0             	add    %rdx,%rax
+  802b08:	48 89 c6             	mov    %rax,%rsi
+  802b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b10:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  802b17:	00 00 00 
+  802b1a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802b1c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802b21:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802b26:	77 ca                	ja     802af2 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802b28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b2c:	48 89 c6             	mov    %rax,%rsi
+  802b2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b34:	48 b8 9a 04 80 00 00 	movabs $0x80049a,%rax
+  802b3b:	00 00 00 
+  802b3e:	ff d0                	call   *%rax
+}
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+
+0000000000802b42 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b42:	55                   	push   %rbp
+  802b43:	48 89 e5             	mov    %rsp,%rbp
+  802b46:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b51:	75 10                	jne    802b63 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b53:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b5a:	00 00 00 
+  802b5d:	8b 00                	mov    (%rax),%eax
+  802b5f:	48 98                	cltq
+  802b61:	eb 05                	jmp    802b68 <vsyscall+0x26>
+  }
+  return 0;
+  802b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+
+0000000000802b6a <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b6a:	55                   	push   %rbp
+  802b6b:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b73:	48 b8 42 2b 80 00 00 	movabs $0x802b42,%rax
+  802b7a:	00 00 00 
+  802b7d:	ff d0                	call   *%rax
+}
+  802b7f:	5d                   	pop    %rbp
+  802b80:	c3                   	ret
+
+0000000000802b81 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b81:	55                   	push   %rbp
+  802b82:	48 89 e5             	mov    %rsp,%rbp
+  802b85:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b89:	0f 31                	rdtsc
+  802b8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b8e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b94:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b97:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b9b:	48 09 d0             	or     %rdx,%rax
+  802b9e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802ba2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802ba6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802baa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802bb1:	00 00 00 
+  802bb4:	8b 40 08             	mov    0x8(%rax),%eax
+  802bb7:	48 98                	cltq
+  802bb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802bbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc6:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bca:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802bd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bda:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bde:	48 89 d0             	mov    %rdx,%rax
+  802be1:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bed:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bf1:	48 01 c8             	add    %rcx,%rax
+}
+  802bf4:	c9                   	leave
+  802bf5:	c3                   	ret
+
+0000000000802bf6 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bf6:	55                   	push   %rbp
+  802bf7:	48 89 e5             	mov    %rsp,%rbp
+  802bfa:	48 83 ec 20          	sub    $0x20,%rsp
+  802bfe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c04:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802c07:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802c0b:	be 01 00 00 00       	mov    $0x1,%esi
+  802c10:	48 89 c7             	mov    %rax,%rdi
+  802c13:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+}
+  802c1f:	90                   	nop
+  802c20:	c9                   	leave
+  802c21:	c3                   	ret
+
+0000000000802c22 <getchar>:
+
+int
+getchar(void) {
+  802c22:	55                   	push   %rbp
+  802c23:	48 89 e5             	mov    %rsp,%rbp
+  802c26:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c2a:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c2e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c33:	48 89 c6             	mov    %rax,%rsi
+  802c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3b:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+  802c47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c4e:	79 05                	jns    802c55 <getchar+0x33>
+    return r;
+  802c50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c53:	eb 14                	jmp    802c69 <getchar+0x47>
+  if (r < 1)
+  802c55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c59:	7f 07                	jg     802c62 <getchar+0x40>
+    return -E_EOF;
+  802c5b:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c60:	eb 07                	jmp    802c69 <getchar+0x47>
+  return c;
+  802c62:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c66:	0f b6 c0             	movzbl %al,%eax
+}
+  802c69:	c9                   	leave
+  802c6a:	c3                   	ret
+
+0000000000802c6b <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c6b:	55                   	push   %rbp
+  802c6c:	48 89 e5             	mov    %rsp,%rbp
+  802c6f:	48 83 ec 20          	sub    $0x20,%rsp
+  802c73:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c76:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7d:	48 89 d6             	mov    %rdx,%rsi
+  802c80:	89 c7                	mov    %eax,%edi
+  802c82:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+  802c8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c95:	79 05                	jns    802c9c <iscons+0x31>
+    return r;
+  802c97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9a:	eb 1a                	jmp    802cb6 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca0:	8b 10                	mov    (%rax),%edx
+  802ca2:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802ca9:	00 00 00 
+  802cac:	8b 00                	mov    (%rax),%eax
+  802cae:	39 c2                	cmp    %eax,%edx
+  802cb0:	0f 94 c0             	sete   %al
+  802cb3:	0f b6 c0             	movzbl %al,%eax
+}
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+
+0000000000802cb8 <opencons>:
+
+int
+opencons(void) {
+  802cb8:	55                   	push   %rbp
+  802cb9:	48 89 e5             	mov    %rsp,%rbp
+  802cbc:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802cc0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802cc4:	48 89 c7             	mov    %rax,%rdi
+  802cc7:	48 b8 17 0b 80 00 00 	movabs $0x800b17,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+  802cd3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cd6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cda:	79 05                	jns    802ce1 <opencons+0x29>
+    return r;
+  802cdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cdf:	eb 66                	jmp    802d47 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce5:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cea:	48 89 c6             	mov    %rax,%rsi
+  802ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf2:	48 b8 e2 03 80 00 00 	movabs $0x8003e2,%rax
+  802cf9:	00 00 00 
+  802cfc:	ff d0                	call   *%rax
+  802cfe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d05:	79 05                	jns    802d0c <opencons+0x54>
+    return r;
+  802d07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d0a:	eb 3b                	jmp    802d47 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802d0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d10:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802d17:	00 00 00 
+  802d1a:	8b 12                	mov    (%rdx),%edx
+  802d1c:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802d1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d22:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d2d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d38:	48 89 c7             	mov    %rax,%rdi
+  802d3b:	48 b8 c9 0a 80 00 00 	movabs $0x800ac9,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+}
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+
+0000000000802d49 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	48 83 ec 20          	sub    $0x20,%rsp
+  802d51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d54:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d57:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d5e:	48 89 d6             	mov    %rdx,%rsi
+  802d61:	89 c7                	mov    %eax,%edi
+  802d63:	48 b8 f9 0b 80 00 00 	movabs $0x800bf9,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+  802d6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d72:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d76:	79 05                	jns    802d7d <consmode+0x34>
+    return r;
+  802d78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d7b:	eb 34                	jmp    802db1 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d81:	8b 10                	mov    (%rax),%edx
+  802d83:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d8a:	00 00 00 
+  802d8d:	8b 00                	mov    (%rax),%eax
+  802d8f:	39 c2                	cmp    %eax,%edx
+  802d91:	74 07                	je     802d9a <consmode+0x51>
+    return -E_INVAL;
+  802d93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d98:	eb 17                	jmp    802db1 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d9e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802da1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802da4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802dab:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802dae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802db1:	c9                   	leave
+  802db2:	c3                   	ret
+
+0000000000802db3 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802db3:	55                   	push   %rbp
+  802db4:	48 89 e5             	mov    %rsp,%rbp
+  802db7:	48 83 ec 20          	sub    $0x20,%rsp
+  802dbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802dbf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802dc3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802dc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dcb:	8b 50 0c             	mov    0xc(%rax),%edx
+  802dce:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802dd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd6:	48 89 ce             	mov    %rcx,%rsi
+  802dd9:	48 89 c7             	mov    %rax,%rdi
+  802ddc:	48 b8 3c 07 80 00 00 	movabs $0x80073c,%rax
+  802de3:	00 00 00 
+  802de6:	ff d0                	call   *%rax
+  802de8:	48 98                	cltq
+}
+  802dea:	c9                   	leave
+  802deb:	c3                   	ret
+
+0000000000802dec <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802df7:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dfe:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802e05:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802e0c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e13:	eb 74                	jmp    802e89 <devcons_write+0x9d>
+    m = n - tot;
+  802e15:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802e1c:	89 c2                	mov    %eax,%edx
+  802e1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e21:	29 c2                	sub    %eax,%edx
+  802e23:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802e26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e29:	83 f8 7f             	cmp    $0x7f,%eax
+  802e2c:	76 07                	jbe    802e35 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e2e:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e35:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e38:	48 63 d0             	movslq %eax,%rdx
+  802e3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e3e:	48 63 c8             	movslq %eax,%rcx
+  802e41:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e48:	48 01 c1             	add    %rax,%rcx
+  802e4b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e52:	48 89 ce             	mov    %rcx,%rsi
+  802e55:	48 89 c7             	mov    %rax,%rdi
+  802e58:	48 b8 84 46 80 00 00 	movabs $0x804684,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e64:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e67:	48 63 d0             	movslq %eax,%rdx
+  802e6a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e71:	48 89 d6             	mov    %rdx,%rsi
+  802e74:	48 89 c7             	mov    %rax,%rdi
+  802e77:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  802e7e:	00 00 00 
+  802e81:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e83:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e86:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e8c:	48 98                	cltq
+  802e8e:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e95:	0f 82 7a ff ff ff    	jb     802e15 <devcons_write+0x29>
+  }
+  return tot;
+  802e9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e9e:	48 98                	cltq
+}
+  802ea0:	c9                   	leave
+  802ea1:	c3                   	ret
+
+0000000000802ea2 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802ea2:	55                   	push   %rbp
+  802ea3:	48 89 e5             	mov    %rsp,%rbp
+  802ea6:	48 83 ec 08          	sub    $0x8,%rsp
+  802eaa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eb3:	c9                   	leave
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802eb5:	55                   	push   %rbp
+  802eb6:	48 89 e5             	mov    %rsp,%rbp
+  802eb9:	48 83 ec 10          	sub    $0x10,%rsp
+  802ebd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ec1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802ec5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ec9:	48 ba 05 51 80 00 00 	movabs $0x805105,%rdx
+  802ed0:	00 00 00 
+  802ed3:	48 89 d6             	mov    %rdx,%rsi
+  802ed6:	48 89 c7             	mov    %rax,%rdi
+  802ed9:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+  return 0;
+  802ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eea:	c9                   	leave
+  802eeb:	c3                   	ret
+
+0000000000802eec <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	48 83 ec 30          	sub    $0x30,%rsp
+  802ef4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ef8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802efb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802eff:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802f06:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f09:	83 e0 02             	and    $0x2,%eax
+  802f0c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802f0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f13:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f16:	83 f8 01             	cmp    $0x1,%eax
+  802f19:	75 04                	jne    802f1f <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802f1b:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802f1f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f22:	83 e0 01             	and    $0x1,%eax
+  802f25:	85 c0                	test   %eax,%eax
+  802f27:	74 44                	je     802f6d <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f31:	89 c2                	mov    %eax,%edx
+  802f33:	be 00 00 00 00       	mov    $0x0,%esi
+  802f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3d:	48 b8 2a 08 80 00 00 	movabs $0x80082a,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+  802f49:	83 f8 01             	cmp    $0x1,%eax
+  802f4c:	75 06                	jne    802f54 <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f4e:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f52:	eb 19                	jmp    802f6d <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f58:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f5e:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f61:	89 c2                	mov    %eax,%edx
+  802f63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f67:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f6d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f70:	c9                   	leave
+  802f71:	c3                   	ret
+
+0000000000802f72 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	53                   	push   %rbx
+  802f77:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f7e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f85:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f8b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f92:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f99:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802fa0:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802fa7:	84 c0                	test   %al,%al
+  802fa9:	74 23                	je     802fce <_panic+0x5c>
+  802fab:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802fb2:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802fb6:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802fba:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802fbe:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802fc2:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802fc6:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802fca:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802fce:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802fd5:	00 00 00 
+  802fd8:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fdf:	00 00 00 
+  802fe2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fe6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fed:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802ff4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ffb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803002:	00 00 00 
+  803005:	48 8b 18             	mov    (%rax),%rbx
+  803008:	48 b8 69 03 80 00 00 	movabs $0x800369,%rax
+  80300f:	00 00 00 
+  803012:	ff d0                	call   *%rax
+  803014:	89 c6                	mov    %eax,%esi
+  803016:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80301c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  803023:	41 89 d0             	mov    %edx,%r8d
+  803026:	48 89 c1             	mov    %rax,%rcx
+  803029:	48 89 da             	mov    %rbx,%rdx
+  80302c:	48 b8 10 51 80 00 00 	movabs $0x805110,%rax
+  803033:	00 00 00 
+  803036:	48 89 c7             	mov    %rax,%rdi
+  803039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303e:	49 b9 91 31 80 00 00 	movabs $0x803191,%r9
+  803045:	00 00 00 
+  803048:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80304b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803052:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803059:	48 89 d6             	mov    %rdx,%rsi
+  80305c:	48 89 c7             	mov    %rax,%rdi
+  80305f:	48 b8 06 31 80 00 00 	movabs $0x803106,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+  cprintf("\n");
+  80306b:	48 b8 33 51 80 00 00 	movabs $0x805133,%rax
+  803072:	00 00 00 
+  803075:	48 89 c7             	mov    %rax,%rdi
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307d:	48 ba 91 31 80 00 00 	movabs $0x803191,%rdx
+  803084:	00 00 00 
+  803087:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803089:	cc                   	int3
+  80308a:	eb fd                	jmp    803089 <_panic+0x117>
+
+000000000080308c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80308c:	55                   	push   %rbp
+  80308d:	48 89 e5             	mov    %rsp,%rbp
+  803090:	48 83 ec 10          	sub    $0x10,%rsp
+  803094:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803097:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80309b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309f:	8b 00                	mov    (%rax),%eax
+  8030a1:	8d 48 01             	lea    0x1(%rax),%ecx
+  8030a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030a8:	89 0a                	mov    %ecx,(%rdx)
+  8030aa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030ad:	89 d1                	mov    %edx,%ecx
+  8030af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030b3:	48 98                	cltq
+  8030b5:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8030b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bd:	8b 00                	mov    (%rax),%eax
+  8030bf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8030c4:	75 2c                	jne    8030f2 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8030c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ca:	8b 00                	mov    (%rax),%eax
+  8030cc:	48 98                	cltq
+  8030ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030d2:	48 83 c2 08          	add    $0x8,%rdx
+  8030d6:	48 89 c6             	mov    %rax,%rsi
+  8030d9:	48 89 d7             	mov    %rdx,%rdi
+  8030dc:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ec:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030f6:	8b 40 04             	mov    0x4(%rax),%eax
+  8030f9:	8d 50 01             	lea    0x1(%rax),%edx
+  8030fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803100:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803103:	90                   	nop
+  803104:	c9                   	leave
+  803105:	c3                   	ret
+
+0000000000803106 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803106:	55                   	push   %rbp
+  803107:	48 89 e5             	mov    %rsp,%rbp
+  80310a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803111:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  803118:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80311f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  803126:	00 00 00 
+  b.cnt = 0;
+  803129:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  803130:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  803133:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80313a:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803141:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803148:	48 89 c6             	mov    %rax,%rsi
+  80314b:	48 b8 8c 30 80 00 00 	movabs $0x80308c,%rax
+  803152:	00 00 00 
+  803155:	48 89 c7             	mov    %rax,%rdi
+  803158:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  80315f:	00 00 00 
+  803162:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  803164:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80316a:	48 98                	cltq
+  80316c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  803173:	48 83 c2 08          	add    $0x8,%rdx
+  803177:	48 89 c6             	mov    %rax,%rsi
+  80317a:	48 89 d7             	mov    %rdx,%rdi
+  80317d:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803189:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80318f:	c9                   	leave
+  803190:	c3                   	ret
+
+0000000000803191 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803191:	55                   	push   %rbp
+  803192:	48 89 e5             	mov    %rsp,%rbp
+  803195:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80319c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8031a3:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8031aa:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8031b1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8031b8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8031bf:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8031c6:	84 c0                	test   %al,%al
+  8031c8:	74 20                	je     8031ea <cprintf+0x59>
+  8031ca:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8031ce:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8031d2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8031d6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031da:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031de:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031e2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031e6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031ea:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031f1:	00 00 00 
+  8031f4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031fb:	00 00 00 
+  8031fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803202:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803209:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803210:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  803217:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80321e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803225:	48 89 d6             	mov    %rdx,%rsi
+  803228:	48 89 c7             	mov    %rax,%rdi
+  80322b:	48 b8 06 31 80 00 00 	movabs $0x803106,%rax
+  803232:	00 00 00 
+  803235:	ff d0                	call   *%rax
+  803237:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80323d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803243:	c9                   	leave
+  803244:	c3                   	ret
+
+0000000000803245 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803245:	55                   	push   %rbp
+  803246:	48 89 e5             	mov    %rsp,%rbp
+  803249:	48 83 ec 30          	sub    $0x30,%rsp
+  80324d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803251:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803255:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803259:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80325c:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  803260:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  803264:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803267:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80326b:	72 54                	jb     8032c1 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80326d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803270:	8d 78 ff             	lea    -0x1(%rax),%edi
+  803273:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80327a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327f:	48 f7 f6             	div    %rsi
+  803282:	49 89 c2             	mov    %rax,%r10
+  803285:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803288:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80328b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80328f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803293:	41 89 c9             	mov    %ecx,%r9d
+  803296:	41 89 f8             	mov    %edi,%r8d
+  803299:	89 d1                	mov    %edx,%ecx
+  80329b:	4c 89 d2             	mov    %r10,%rdx
+  80329e:	48 89 c7             	mov    %rax,%rdi
+  8032a1:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+  8032ad:	eb 1c                	jmp    8032cb <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8032af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032b6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032ba:	48 89 d6             	mov    %rdx,%rsi
+  8032bd:	89 c7                	mov    %eax,%edi
+  8032bf:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8032c1:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8032c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8032c9:	7f e4                	jg     8032af <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8032cb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8032ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d7:	48 f7 f1             	div    %rcx
+  8032da:	48 b8 70 53 80 00 00 	movabs $0x805370,%rax
+  8032e1:	00 00 00 
+  8032e4:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032e8:	0f be c0             	movsbl %al,%eax
+  8032eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ef:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032f3:	48 89 d6             	mov    %rdx,%rsi
+  8032f6:	89 c7                	mov    %eax,%edi
+  8032f8:	ff d1                	call   *%rcx
+}
+  8032fa:	90                   	nop
+  8032fb:	c9                   	leave
+  8032fc:	c3                   	ret
+
+00000000008032fd <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032fd:	55                   	push   %rbp
+  8032fe:	48 89 e5             	mov    %rsp,%rbp
+  803301:	48 83 ec 10          	sub    $0x10,%rsp
+  803305:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803309:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80330c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  803310:	7e 4b                	jle    80335d <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  803312:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803316:	8b 00                	mov    (%rax),%eax
+  803318:	83 f8 2f             	cmp    $0x2f,%eax
+  80331b:	77 24                	ja     803341 <getuint+0x44>
+  80331d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803321:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803325:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803329:	8b 00                	mov    (%rax),%eax
+  80332b:	89 c0                	mov    %eax,%eax
+  80332d:	48 01 d0             	add    %rdx,%rax
+  803330:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803334:	8b 12                	mov    (%rdx),%edx
+  803336:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803339:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80333d:	89 0a                	mov    %ecx,(%rdx)
+  80333f:	eb 14                	jmp    803355 <getuint+0x58>
+  803341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803345:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803349:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80334d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803351:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803355:	48 8b 00             	mov    (%rax),%rax
+  803358:	e9 95 00 00 00       	jmp    8033f2 <getuint+0xf5>
+  else if (lflag)
+  80335d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803361:	74 48                	je     8033ab <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  803363:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803367:	8b 00                	mov    (%rax),%eax
+  803369:	83 f8 2f             	cmp    $0x2f,%eax
+  80336c:	77 24                	ja     803392 <getuint+0x95>
+  80336e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803372:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803376:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80337a:	8b 00                	mov    (%rax),%eax
+  80337c:	89 c0                	mov    %eax,%eax
+  80337e:	48 01 d0             	add    %rdx,%rax
+  803381:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803385:	8b 12                	mov    (%rdx),%edx
+  803387:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80338a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80338e:	89 0a                	mov    %ecx,(%rdx)
+  803390:	eb 14                	jmp    8033a6 <getuint+0xa9>
+  803392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803396:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80339a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80339e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033a6:	48 8b 00             	mov    (%rax),%rax
+  8033a9:	eb 47                	jmp    8033f2 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8033ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033af:	8b 00                	mov    (%rax),%eax
+  8033b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033b4:	77 24                	ja     8033da <getuint+0xdd>
+  8033b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ba:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c2:	8b 00                	mov    (%rax),%eax
+  8033c4:	89 c0                	mov    %eax,%eax
+  8033c6:	48 01 d0             	add    %rdx,%rax
+  8033c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033cd:	8b 12                	mov    (%rdx),%edx
+  8033cf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033d6:	89 0a                	mov    %ecx,(%rdx)
+  8033d8:	eb 14                	jmp    8033ee <getuint+0xf1>
+  8033da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033de:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033e2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ea:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033ee:	8b 00                	mov    (%rax),%eax
+  8033f0:	89 c0                	mov    %eax,%eax
+}
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+
+00000000008033f4 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033f4:	55                   	push   %rbp
+  8033f5:	48 89 e5             	mov    %rsp,%rbp
+  8033f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8033fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803400:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  803403:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  803407:	7e 4b                	jle    803454 <getint+0x60>
+    return va_arg(*ap, long long);
+  803409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340d:	8b 00                	mov    (%rax),%eax
+  80340f:	83 f8 2f             	cmp    $0x2f,%eax
+  803412:	77 24                	ja     803438 <getint+0x44>
+  803414:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803418:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80341c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803420:	8b 00                	mov    (%rax),%eax
+  803422:	89 c0                	mov    %eax,%eax
+  803424:	48 01 d0             	add    %rdx,%rax
+  803427:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80342b:	8b 12                	mov    (%rdx),%edx
+  80342d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803430:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803434:	89 0a                	mov    %ecx,(%rdx)
+  803436:	eb 14                	jmp    80344c <getint+0x58>
+  803438:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803440:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803444:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803448:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80344c:	48 8b 00             	mov    (%rax),%rax
+  80344f:	e9 95 00 00 00       	jmp    8034e9 <getint+0xf5>
+  else if (lflag)
+  803454:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803458:	74 48                	je     8034a2 <getint+0xae>
+    return va_arg(*ap, long);
+  80345a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345e:	8b 00                	mov    (%rax),%eax
+  803460:	83 f8 2f             	cmp    $0x2f,%eax
+  803463:	77 24                	ja     803489 <getint+0x95>
+  803465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803469:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80346d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803471:	8b 00                	mov    (%rax),%eax
+  803473:	89 c0                	mov    %eax,%eax
+  803475:	48 01 d0             	add    %rdx,%rax
+  803478:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80347c:	8b 12                	mov    (%rdx),%edx
+  80347e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803481:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803485:	89 0a                	mov    %ecx,(%rdx)
+  803487:	eb 14                	jmp    80349d <getint+0xa9>
+  803489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803491:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803495:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803499:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80349d:	48 8b 00             	mov    (%rax),%rax
+  8034a0:	eb 47                	jmp    8034e9 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8034a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a6:	8b 00                	mov    (%rax),%eax
+  8034a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ab:	77 24                	ja     8034d1 <getint+0xdd>
+  8034ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b9:	8b 00                	mov    (%rax),%eax
+  8034bb:	89 c0                	mov    %eax,%eax
+  8034bd:	48 01 d0             	add    %rdx,%rax
+  8034c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034c4:	8b 12                	mov    (%rdx),%edx
+  8034c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034cd:	89 0a                	mov    %ecx,(%rdx)
+  8034cf:	eb 14                	jmp    8034e5 <getint+0xf1>
+  8034d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034d9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034e1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034e5:	8b 00                	mov    (%rax),%eax
+  8034e7:	48 98                	cltq
+}
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+00000000008034eb <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+  8034ef:	41 54                	push   %r12
+  8034f1:	53                   	push   %rbx
+  8034f2:	48 83 ec 60          	sub    $0x60,%rsp
+  8034f6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034fa:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034fe:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803502:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  803506:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80350a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80350e:	48 8b 06             	mov    (%rsi),%rax
+  803511:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803515:	48 89 01             	mov    %rax,(%rcx)
+  803518:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80351c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803520:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803524:	eb 17                	jmp    80353d <vprintfmt+0x52>
+      if (ch == '\0')
+  803526:	85 db                	test   %ebx,%ebx
+  803528:	0f 84 bf 04 00 00    	je     8039ed <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80352e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803532:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803536:	48 89 c6             	mov    %rax,%rsi
+  803539:	89 df                	mov    %ebx,%edi
+  80353b:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80353d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803541:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803545:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803549:	0f b6 00             	movzbl (%rax),%eax
+  80354c:	0f b6 d8             	movzbl %al,%ebx
+  80354f:	83 fb 25             	cmp    $0x25,%ebx
+  803552:	75 d2                	jne    803526 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803554:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803558:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80355f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803566:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80356d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  803574:	eb 04                	jmp    80357a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803576:	90                   	nop
+  803577:	eb 01                	jmp    80357a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803579:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80357a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80357e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803582:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803586:	0f b6 00             	movzbl (%rax),%eax
+  803589:	0f b6 d8             	movzbl %al,%ebx
+  80358c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80358f:	83 f8 55             	cmp    $0x55,%eax
+  803592:	0f 87 22 04 00 00    	ja     8039ba <vprintfmt+0x4cf>
+  803598:	89 c0                	mov    %eax,%eax
+  80359a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8035a1:	00 
+  8035a2:	48 b8 98 53 80 00 00 	movabs $0x805398,%rax
+  8035a9:	00 00 00 
+  8035ac:	48 01 d0             	add    %rdx,%rax
+  8035af:	48 8b 00             	mov    (%rax),%rax
+  8035b2:	ff e0                	jmp    *%rax
+        padc = '-';
+  8035b4:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8035b8:	eb c0                	jmp    80357a <vprintfmt+0x8f>
+        padc = '0';
+  8035ba:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8035be:	eb ba                	jmp    80357a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8035c0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035c7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8035ca:	89 d0                	mov    %edx,%eax
+  8035cc:	c1 e0 02             	shl    $0x2,%eax
+  8035cf:	01 d0                	add    %edx,%eax
+  8035d1:	01 c0                	add    %eax,%eax
+  8035d3:	01 d8                	add    %ebx,%eax
+  8035d5:	83 e8 30             	sub    $0x30,%eax
+  8035d8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035db:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035df:	0f b6 00             	movzbl (%rax),%eax
+  8035e2:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035e5:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035e8:	7e 60                	jle    80364a <vprintfmt+0x15f>
+  8035ea:	83 fb 39             	cmp    $0x39,%ebx
+  8035ed:	7f 5b                	jg     80364a <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035ef:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035f4:	eb d1                	jmp    8035c7 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8035fc:	77 17                	ja     803615 <vprintfmt+0x12a>
+  8035fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803602:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803605:	89 d2                	mov    %edx,%edx
+  803607:	48 01 d0             	add    %rdx,%rax
+  80360a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80360d:	83 c2 08             	add    $0x8,%edx
+  803610:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803613:	eb 0c                	jmp    803621 <vprintfmt+0x136>
+  803615:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803619:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80361d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803621:	8b 00                	mov    (%rax),%eax
+  803623:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  803626:	eb 23                	jmp    80364b <vprintfmt+0x160>
+        if (width < 0)
+  803628:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80362c:	0f 89 44 ff ff ff    	jns    803576 <vprintfmt+0x8b>
+          width = 0;
+  803632:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803639:	e9 38 ff ff ff       	jmp    803576 <vprintfmt+0x8b>
+        altflag = 1;
+  80363e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803645:	e9 30 ff ff ff       	jmp    80357a <vprintfmt+0x8f>
+        goto process_precision;
+  80364a:	90                   	nop
+        if (width < 0)
+  80364b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80364f:	0f 89 24 ff ff ff    	jns    803579 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803655:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803658:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80365b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803662:	e9 12 ff ff ff       	jmp    803579 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803667:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80366b:	e9 0a ff ff ff       	jmp    80357a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  803670:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803673:	83 f8 2f             	cmp    $0x2f,%eax
+  803676:	77 17                	ja     80368f <vprintfmt+0x1a4>
+  803678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80367c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80367f:	89 d2                	mov    %edx,%edx
+  803681:	48 01 d0             	add    %rdx,%rax
+  803684:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803687:	83 c2 08             	add    $0x8,%edx
+  80368a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80368d:	eb 0c                	jmp    80369b <vprintfmt+0x1b0>
+  80368f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803693:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803697:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80369b:	8b 00                	mov    (%rax),%eax
+  80369d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8036a1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8036a5:	48 89 d6             	mov    %rdx,%rsi
+  8036a8:	89 c7                	mov    %eax,%edi
+  8036aa:	ff d1                	call   *%rcx
+        break;
+  8036ac:	e9 37 03 00 00       	jmp    8039e8 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8036b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b7:	77 17                	ja     8036d0 <vprintfmt+0x1e5>
+  8036b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036bd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036c0:	89 d2                	mov    %edx,%edx
+  8036c2:	48 01 d0             	add    %rdx,%rax
+  8036c5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036c8:	83 c2 08             	add    $0x8,%edx
+  8036cb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036ce:	eb 0c                	jmp    8036dc <vprintfmt+0x1f1>
+  8036d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036d8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036dc:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036de:	85 db                	test   %ebx,%ebx
+  8036e0:	79 02                	jns    8036e4 <vprintfmt+0x1f9>
+          err = -err;
+  8036e2:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036e4:	83 fb 15             	cmp    $0x15,%ebx
+  8036e7:	7f 16                	jg     8036ff <vprintfmt+0x214>
+  8036e9:	48 ba c0 52 80 00 00 	movabs $0x8052c0,%rdx
+  8036f0:	00 00 00 
+  8036f3:	48 63 c3             	movslq %ebx,%rax
+  8036f6:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036fa:	4d 85 e4             	test   %r12,%r12
+  8036fd:	75 2e                	jne    80372d <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036ff:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803703:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803707:	89 d9                	mov    %ebx,%ecx
+  803709:	48 ba 81 53 80 00 00 	movabs $0x805381,%rdx
+  803710:	00 00 00 
+  803713:	48 89 c7             	mov    %rax,%rdi
+  803716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371b:	49 b8 f7 39 80 00 00 	movabs $0x8039f7,%r8
+  803722:	00 00 00 
+  803725:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803728:	e9 bb 02 00 00       	jmp    8039e8 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80372d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803731:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803735:	4c 89 e1             	mov    %r12,%rcx
+  803738:	48 ba 8a 53 80 00 00 	movabs $0x80538a,%rdx
+  80373f:	00 00 00 
+  803742:	48 89 c7             	mov    %rax,%rdi
+  803745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374a:	49 b8 f7 39 80 00 00 	movabs $0x8039f7,%r8
+  803751:	00 00 00 
+  803754:	41 ff d0             	call   *%r8
+        break;
+  803757:	e9 8c 02 00 00       	jmp    8039e8 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80375c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80375f:	83 f8 2f             	cmp    $0x2f,%eax
+  803762:	77 17                	ja     80377b <vprintfmt+0x290>
+  803764:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803768:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80376b:	89 d2                	mov    %edx,%edx
+  80376d:	48 01 d0             	add    %rdx,%rax
+  803770:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803773:	83 c2 08             	add    $0x8,%edx
+  803776:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803779:	eb 0c                	jmp    803787 <vprintfmt+0x29c>
+  80377b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80377f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803783:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803787:	4c 8b 20             	mov    (%rax),%r12
+  80378a:	4d 85 e4             	test   %r12,%r12
+  80378d:	75 0a                	jne    803799 <vprintfmt+0x2ae>
+          p = "(null)";
+  80378f:	49 bc 8d 53 80 00 00 	movabs $0x80538d,%r12
+  803796:	00 00 00 
+        if (width > 0 && padc != '-')
+  803799:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80379d:	7e 78                	jle    803817 <vprintfmt+0x32c>
+  80379f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8037a3:	74 72                	je     803817 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037a5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8037a8:	48 98                	cltq
+  8037aa:	48 89 c6             	mov    %rax,%rsi
+  8037ad:	4c 89 e7             	mov    %r12,%rdi
+  8037b0:	48 b8 03 41 80 00 00 	movabs $0x804103,%rax
+  8037b7:	00 00 00 
+  8037ba:	ff d0                	call   *%rax
+  8037bc:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8037bf:	eb 17                	jmp    8037d8 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8037c1:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8037c5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8037c9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8037cd:	48 89 d6             	mov    %rdx,%rsi
+  8037d0:	89 c7                	mov    %eax,%edi
+  8037d2:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037d4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037d8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037dc:	7f e3                	jg     8037c1 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037de:	eb 37                	jmp    803817 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037e0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037e4:	74 1e                	je     803804 <vprintfmt+0x319>
+  8037e6:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037e9:	7e 05                	jle    8037f0 <vprintfmt+0x305>
+  8037eb:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037ee:	7e 14                	jle    803804 <vprintfmt+0x319>
+            putch('?', putdat);
+  8037f0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037f4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037f8:	48 89 c6             	mov    %rax,%rsi
+  8037fb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803800:	ff d2                	call   *%rdx
+  803802:	eb 0f                	jmp    803813 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  803804:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803808:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80380c:	48 89 c6             	mov    %rax,%rsi
+  80380f:	89 df                	mov    %ebx,%edi
+  803811:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803813:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803817:	4c 89 e0             	mov    %r12,%rax
+  80381a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80381e:	0f b6 00             	movzbl (%rax),%eax
+  803821:	0f be d8             	movsbl %al,%ebx
+  803824:	85 db                	test   %ebx,%ebx
+  803826:	74 28                	je     803850 <vprintfmt+0x365>
+  803828:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80382c:	78 b2                	js     8037e0 <vprintfmt+0x2f5>
+  80382e:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  803832:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803836:	79 a8                	jns    8037e0 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803838:	eb 16                	jmp    803850 <vprintfmt+0x365>
+          putch(' ', putdat);
+  80383a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80383e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803842:	48 89 c6             	mov    %rax,%rsi
+  803845:	bf 20 00 00 00       	mov    $0x20,%edi
+  80384a:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80384c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803850:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803854:	7f e4                	jg     80383a <vprintfmt+0x34f>
+        break;
+  803856:	e9 8d 01 00 00       	jmp    8039e8 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80385b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80385e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803862:	89 d6                	mov    %edx,%esi
+  803864:	48 89 c7             	mov    %rax,%rdi
+  803867:	48 b8 f4 33 80 00 00 	movabs $0x8033f4,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+  803873:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803877:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80387b:	48 85 c0             	test   %rax,%rax
+  80387e:	79 1d                	jns    80389d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  803880:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803884:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803888:	48 89 c6             	mov    %rax,%rsi
+  80388b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803890:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803892:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803896:	48 f7 d8             	neg    %rax
+  803899:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80389d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038a4:	e9 d2 00 00 00       	jmp    80397b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  8038a9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038ac:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038b0:	89 d6                	mov    %edx,%esi
+  8038b2:	48 89 c7             	mov    %rax,%rdi
+  8038b5:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  8038bc:	00 00 00 
+  8038bf:	ff d0                	call   *%rax
+  8038c1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8038c5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038cc:	e9 aa 00 00 00       	jmp    80397b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8038d1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038d4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038d8:	89 d6                	mov    %edx,%esi
+  8038da:	48 89 c7             	mov    %rax,%rdi
+  8038dd:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  8038e4:	00 00 00 
+  8038e7:	ff d0                	call   *%rax
+  8038e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038ed:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038f4:	e9 82 00 00 00       	jmp    80397b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038f9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038fd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803901:	48 89 c6             	mov    %rax,%rsi
+  803904:	bf 30 00 00 00       	mov    $0x30,%edi
+  803909:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80390b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80390f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803913:	48 89 c6             	mov    %rax,%rsi
+  803916:	bf 78 00 00 00       	mov    $0x78,%edi
+  80391b:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  80391d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803920:	83 f8 2f             	cmp    $0x2f,%eax
+  803923:	77 17                	ja     80393c <vprintfmt+0x451>
+  803925:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803929:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80392c:	89 d2                	mov    %edx,%edx
+  80392e:	48 01 d0             	add    %rdx,%rax
+  803931:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803934:	83 c2 08             	add    $0x8,%edx
+  803937:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80393a:	eb 0c                	jmp    803948 <vprintfmt+0x45d>
+  80393c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803940:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803944:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803948:	48 8b 00             	mov    (%rax),%rax
+  80394b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80394f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803956:	eb 23                	jmp    80397b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803958:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80395b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80395f:	89 d6                	mov    %edx,%esi
+  803961:	48 89 c7             	mov    %rax,%rdi
+  803964:	48 b8 fd 32 80 00 00 	movabs $0x8032fd,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+  803970:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803974:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80397b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  803980:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803983:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803986:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80398a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80398e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803992:	45 89 c1             	mov    %r8d,%r9d
+  803995:	41 89 f8             	mov    %edi,%r8d
+  803998:	48 89 c7             	mov    %rax,%rdi
+  80399b:	48 b8 45 32 80 00 00 	movabs $0x803245,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+        break;
+  8039a7:	eb 3f                	jmp    8039e8 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  8039a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039ad:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8039b1:	48 89 c6             	mov    %rax,%rsi
+  8039b4:	89 df                	mov    %ebx,%edi
+  8039b6:	ff d2                	call   *%rdx
+        break;
+  8039b8:	eb 2e                	jmp    8039e8 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  8039ba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039be:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8039c2:	48 89 c6             	mov    %rax,%rsi
+  8039c5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039ca:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8039cc:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039d1:	eb 05                	jmp    8039d8 <vprintfmt+0x4ed>
+  8039d3:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039d8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039dc:	48 83 e8 01          	sub    $0x1,%rax
+  8039e0:	0f b6 00             	movzbl (%rax),%eax
+  8039e3:	3c 25                	cmp    $0x25,%al
+  8039e5:	75 ec                	jne    8039d3 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039e7:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039e8:	e9 50 fb ff ff       	jmp    80353d <vprintfmt+0x52>
+        return;
+  8039ed:	90                   	nop
+    }
+  }
+}
+  8039ee:	48 83 c4 60          	add    $0x60,%rsp
+  8039f2:	5b                   	pop    %rbx
+  8039f3:	41 5c                	pop    %r12
+  8039f5:	5d                   	pop    %rbp
+  8039f6:	c3                   	ret
+
+00000000008039f7 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039f7:	55                   	push   %rbp
+  8039f8:	48 89 e5             	mov    %rsp,%rbp
+  8039fb:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803a02:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803a09:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  803a10:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803a17:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803a1e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803a25:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a2c:	84 c0                	test   %al,%al
+  803a2e:	74 20                	je     803a50 <printfmt+0x59>
+  803a30:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a34:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a38:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a3c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a40:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a44:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a48:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a4c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a50:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a57:	00 00 00 
+  803a5a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a61:	00 00 00 
+  803a64:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a68:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a6f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a76:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a7d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a84:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a8b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a92:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a99:	48 89 c7             	mov    %rax,%rdi
+  803a9c:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  803aa3:	00 00 00 
+  803aa6:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803aa8:	90                   	nop
+  803aa9:	c9                   	leave
+  803aaa:	c3                   	ret
+
+0000000000803aab <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803aab:	55                   	push   %rbp
+  803aac:	48 89 e5             	mov    %rsp,%rbp
+  803aaf:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803ab6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803aba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803abe:	8b 40 10             	mov    0x10(%rax),%eax
+  803ac1:	8d 50 01             	lea    0x1(%rax),%edx
+  803ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ac8:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803acb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803acf:	48 8b 10             	mov    (%rax),%rdx
+  803ad2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ad6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ada:	48 39 c2             	cmp    %rax,%rdx
+  803add:	73 17                	jae    803af6 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803adf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ae3:	48 8b 00             	mov    (%rax),%rax
+  803ae6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803aea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803aee:	48 89 0a             	mov    %rcx,(%rdx)
+  803af1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803af4:	88 10                	mov    %dl,(%rax)
+}
+  803af6:	90                   	nop
+  803af7:	c9                   	leave
+  803af8:	c3                   	ret
+
+0000000000803af9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803af9:	55                   	push   %rbp
+  803afa:	48 89 e5             	mov    %rsp,%rbp
+  803afd:	48 83 ec 40          	sub    $0x40,%rsp
+  803b01:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b05:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803b08:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803b0c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803b10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b14:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803b18:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803b1b:	48 98                	cltq
+  803b1d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803b21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b25:	48 01 d0             	add    %rdx,%rax
+  803b28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b2c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b33:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b38:	74 06                	je     803b40 <vsnprintf+0x47>
+  803b3a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b3e:	7f 07                	jg     803b47 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b45:	eb 32                	jmp    803b79 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b47:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b4b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b4f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b53:	48 89 c6             	mov    %rax,%rsi
+  803b56:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803b5d:	00 00 00 
+  803b60:	48 89 c7             	mov    %rax,%rdi
+  803b63:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  803b6a:	00 00 00 
+  803b6d:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b73:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b76:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b79:	c9                   	leave
+  803b7a:	c3                   	ret
+
+0000000000803b7b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b7b:	55                   	push   %rbp
+  803b7c:	48 89 e5             	mov    %rsp,%rbp
+  803b7f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b86:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b8d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b93:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b9a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803ba1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803ba8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803baf:	84 c0                	test   %al,%al
+  803bb1:	74 20                	je     803bd3 <snprintf+0x58>
+  803bb3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803bb7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803bbb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803bbf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803bc3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803bc7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803bcb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803bcf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803bd3:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803bda:	00 00 00 
+  803bdd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803be4:	00 00 00 
+  803be7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803beb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bf2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bf9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803c00:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803c07:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803c0e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803c14:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803c1b:	48 89 c7             	mov    %rax,%rdi
+  803c1e:	48 b8 f9 3a 80 00 00 	movabs $0x803af9,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+  803c2a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c30:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c36:	c9                   	leave
+  803c37:	c3                   	ret
+
+0000000000803c38 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c38:	55                   	push   %rbp
+  803c39:	48 89 e5             	mov    %rsp,%rbp
+  803c3c:	53                   	push   %rbx
+  803c3d:	48 83 ec 38          	sub    $0x38,%rsp
+  803c41:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c44:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c48:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c4c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c50:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c54:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c5c:	89 d1                	mov    %edx,%ecx
+  803c5e:	0f a2                	cpuid
+  803c60:	89 de                	mov    %ebx,%esi
+  803c62:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c65:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c68:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c6b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c6e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c73:	74 09                	je     803c7e <cpuid+0x46>
+}
+  803c75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c79:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c7c:	89 10                	mov    %edx,(%rax)
+
+  803c7e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c83:	74 09                	je     803c8e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c89:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c8c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c8e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c93:	74 09                	je     803c9e <cpuid+0x66>
+char *
+  803c95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c99:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c9c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c9e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803ca3:	74 09                	je     803cae <cpuid+0x76>
+  for (; *s; s++)
+  803ca5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ca9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803cac:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803cae:	90                   	nop
+  803caf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cb3:	c9                   	leave
+  803cb4:	c3                   	ret
+
+0000000000803cb5 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803cb5:	55                   	push   %rbp
+  803cb6:	48 89 e5             	mov    %rsp,%rbp
+  803cb9:	48 83 ec 18          	sub    $0x18,%rsp
+  803cbd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cc3:	89 c1                	mov    %eax,%ecx
+  803cc5:	0f 01 d0             	xgetbv
+  803cc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ccb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803cce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cd1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803cd4:	48 c1 e2 20          	shl    $0x20,%rdx
+  803cd8:	48 09 d0             	or     %rdx,%rax
+#else
+  803cdb:	c9                   	leave
+  803cdc:	c3                   	ret
+
+0000000000803cdd <string_cpu>:
+string_cpu(void) {
+  803cdd:	55                   	push   %rbp
+  803cde:	48 89 e5             	mov    %rsp,%rbp
+  803ce1:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803ce5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cf3:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cfa:	00 00 00 
+  803cfd:	8b 00                	mov    (%rax),%eax
+  803cff:	85 c0                	test   %eax,%eax
+  803d01:	78 11                	js     803d14 <string_cpu+0x37>
+    return string_features;
+  803d03:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803d0a:	00 00 00 
+  803d0d:	8b 00                	mov    (%rax),%eax
+  803d0f:	e9 df 00 00 00       	jmp    803df3 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803d14:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803d18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d28:	48 89 c6             	mov    %rax,%rsi
+  803d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d30:	48 b8 38 3c 80 00 00 	movabs $0x803c38,%rax
+  803d37:	00 00 00 
+  803d3a:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d3c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d3f:	83 f8 06             	cmp    $0x6,%eax
+  803d42:	76 28                	jbe    803d6c <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d44:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d48:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d53:	48 89 c2             	mov    %rax,%rdx
+  803d56:	be 00 00 00 00       	mov    $0x0,%esi
+  803d5b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d60:	48 b8 38 3c 80 00 00 	movabs $0x803c38,%rax
+  803d67:	00 00 00 
+  803d6a:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d6f:	25 00 02 00 00       	and    $0x200,%eax
+  803d74:	85 c0                	test   %eax,%eax
+  803d76:	74 04                	je     803d7c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d78:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d7c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d86:	48 89 c1             	mov    %rax,%rcx
+  803d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d93:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d98:	48 b8 38 3c 80 00 00 	movabs $0x803c38,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803da4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803da7:	83 e0 20             	and    $0x20,%eax
+  803daa:	85 c0                	test   %eax,%eax
+  803dac:	74 2a                	je     803dd8 <string_cpu+0xfb>
+  803dae:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803db1:	25 00 00 00 08       	and    $0x8000000,%eax
+  803db6:	85 c0                	test   %eax,%eax
+  803db8:	74 1e                	je     803dd8 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbf:	48 b8 b5 3c 80 00 00 	movabs $0x803cb5,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+  803dcb:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803dce:	48 83 f8 06          	cmp    $0x6,%rax
+  803dd2:	75 04                	jne    803dd8 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803dd4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803dd8:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803ddf:	00 00 00 
+  803de2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803de5:	89 02                	mov    %eax,(%rdx)
+  803de7:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dee:	00 00 00 
+  803df1:	8b 00                	mov    (%rax),%eax
+}
+  803df3:	c9                   	leave
+  803df4:	c3                   	ret
+
+0000000000803df5 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803df5:	55                   	push   %rbp
+  803df6:	48 89 e5             	mov    %rsp,%rbp
+  803df9:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dfd:	48 83 ec 60          	sub    $0x60,%rsp
+  803e01:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803e06:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e0b:	83 e0 1f             	and    $0x1f,%eax
+  803e0e:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803e12:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e16:	48 f7 d8             	neg    %rax
+  803e19:	48 89 c2             	mov    %rax,%rdx
+  803e1c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e21:	48 01 d0             	add    %rdx,%rax
+  803e24:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e29:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e2d:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e33:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e38:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e3c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e42:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e46:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e4a:	89 c2                	mov    %eax,%edx
+  803e4c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e50:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e55:	89 c1                	mov    %eax,%ecx
+  803e57:	d3 e6                	shl    %cl,%esi
+  803e59:	89 f0                	mov    %esi,%eax
+  803e5b:	21 d0                	and    %edx,%eax
+  803e5d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e61:	eb 21                	jmp    803e84 <strlen_avx2+0x8f>
+    p += 32;
+  803e63:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e69:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e6e:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e72:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e78:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e7c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e80:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e84:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e89:	74 d8                	je     803e63 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e8b:	31 c0                	xor    %eax,%eax
+  803e8d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e93:	48 63 d0             	movslq %eax,%rdx
+  803e96:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e9b:	48 01 d0             	add    %rdx,%rax
+  803e9e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803ea3:	c9                   	leave
+  803ea4:	c3                   	ret
+
+0000000000803ea5 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803ea5:	55                   	push   %rbp
+  803ea6:	48 89 e5             	mov    %rsp,%rbp
+  803ea9:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803ead:	48 83 ec 40          	sub    $0x40,%rsp
+  803eb1:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803eb6:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803ebb:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ec0:	eb 77                	jmp    803f39 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803ec2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ec7:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ecb:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803ecf:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803ed4:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ed8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803edc:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803ee0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ee4:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ee9:	74 3c                	je     803f27 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803eeb:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eef:	f7 d0                	not    %eax
+  803ef1:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ef5:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ef9:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803efd:	48 63 d0             	movslq %eax,%rdx
+  803f00:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f05:	48 01 d0             	add    %rdx,%rax
+  803f08:	0f b6 00             	movzbl (%rax),%eax
+  803f0b:	0f b6 c0             	movzbl %al,%eax
+  803f0e:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803f12:	48 63 ca             	movslq %edx,%rcx
+  803f15:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803f1a:	48 01 ca             	add    %rcx,%rdx
+  803f1d:	0f b6 12             	movzbl (%rdx),%edx
+  803f20:	0f b6 d2             	movzbl %dl,%edx
+  803f23:	29 d0                	sub    %edx,%eax
+  803f25:	eb 6b                	jmp    803f92 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f27:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f2d:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f33:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f39:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f3f:	77 81                	ja     803ec2 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f41:	eb 42                	jmp    803f85 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f43:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f48:	0f b6 10             	movzbl (%rax),%edx
+  803f4b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f50:	0f b6 00             	movzbl (%rax),%eax
+  803f53:	38 c2                	cmp    %al,%dl
+  803f55:	74 1c                	je     803f73 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f57:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f5c:	0f b6 00             	movzbl (%rax),%eax
+  803f5f:	0f b6 c8             	movzbl %al,%ecx
+  803f62:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f67:	0f b6 00             	movzbl (%rax),%eax
+  803f6a:	0f b6 d0             	movzbl %al,%edx
+  803f6d:	89 c8                	mov    %ecx,%eax
+  803f6f:	29 d0                	sub    %edx,%eax
+  803f71:	eb 1f                	jmp    803f92 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f73:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f79:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f7f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f85:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f8b:	75 b6                	jne    803f43 <memcmp_avx2+0x9e>
+  return 0;
+  803f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f92:	c9                   	leave
+  803f93:	c3                   	ret
+
+0000000000803f94 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f94:	55                   	push   %rbp
+  803f95:	48 89 e5             	mov    %rsp,%rbp
+  803f98:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f9c:	48 83 ec 60          	sub    $0x60,%rsp
+  803fa0:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803fa5:	89 f0                	mov    %esi,%eax
+  803fa7:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803fac:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803fb0:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803fb5:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803fb9:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803fbe:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803fc4:	eb 47                	jmp    80400d <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803fc6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fcb:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803fcf:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803fd3:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fd9:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fdd:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fe1:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fe5:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fea:	74 15                	je     804001 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fec:	31 c0                	xor    %eax,%eax
+  803fee:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803ff4:	48 63 d0             	movslq %eax,%rdx
+  803ff7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ffc:	48 01 d0             	add    %rdx,%rax
+  803fff:	eb 3d                	jmp    80403e <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  804001:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  804007:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80400d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  804013:	77 b1                	ja     803fc6 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  804015:	eb 0c                	jmp    804023 <memfind_avx2+0x8f>
+  804017:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80401d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  804023:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804029:	74 0e                	je     804039 <memfind_avx2+0xa5>
+  80402b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804030:	0f b6 00             	movzbl (%rax),%eax
+  804033:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804037:	75 de                	jne    804017 <memfind_avx2+0x83>
+  return s;
+  804039:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80403e:	c9                   	leave
+  80403f:	c3                   	ret
+
+0000000000804040 <strlen>:
+strlen(const char *s) {
+  804040:	55                   	push   %rbp
+  804041:	48 89 e5             	mov    %rsp,%rbp
+  804044:	48 83 ec 40          	sub    $0x40,%rsp
+  804048:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80404c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804050:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804054:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  80405b:	00 00 00 
+  80405e:	ff d0                	call   *%rax
+  804060:	83 e0 02             	and    $0x2,%eax
+  804063:	85 c0                	test   %eax,%eax
+  804065:	74 18                	je     80407f <strlen+0x3f>
+    return strlen_avx2(s);
+  804067:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80406b:	48 89 c7             	mov    %rax,%rdi
+  80406e:	48 b8 f5 3d 80 00 00 	movabs $0x803df5,%rax
+  804075:	00 00 00 
+  804078:	ff d0                	call   *%rax
+  80407a:	e9 82 00 00 00       	jmp    804101 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80407f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804083:	83 e0 0f             	and    $0xf,%eax
+  804086:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804089:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80408c:	48 f7 d8             	neg    %rax
+  80408f:	48 89 c2             	mov    %rax,%rdx
+  804092:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804096:	48 01 d0             	add    %rdx,%rax
+  804099:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80409d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040a1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040a5:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040aa:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040ae:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040b2:	89 c2                	mov    %eax,%edx
+  8040b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8040bc:	89 c1                	mov    %eax,%ecx
+  8040be:	d3 e6                	shl    %cl,%esi
+  8040c0:	89 f0                	mov    %esi,%eax
+  8040c2:	21 d0                	and    %edx,%eax
+  8040c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040c7:	eb 1d                	jmp    8040e6 <strlen+0xa6>
+    p += 16;
+  8040c9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8040ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d2:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040d6:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040db:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040df:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040ea:	74 dd                	je     8040c9 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040ec:	31 c0                	xor    %eax,%eax
+  8040ee:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040f3:	48 63 d0             	movslq %eax,%rdx
+  8040f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040fa:	48 01 d0             	add    %rdx,%rax
+  8040fd:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  804101:	c9                   	leave
+  804102:	c3                   	ret
+
+0000000000804103 <strnlen>:
+strnlen(const char *s, size_t size) {
+  804103:	55                   	push   %rbp
+  804104:	48 89 e5             	mov    %rsp,%rbp
+  804107:	48 83 ec 20          	sub    $0x20,%rsp
+  80410b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80410f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804113:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80411a:	eb 0e                	jmp    80412a <strnlen+0x27>
+    n++;
+  80411c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804120:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804125:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80412a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80412f:	74 0b                	je     80413c <strnlen+0x39>
+  804131:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804135:	0f b6 00             	movzbl (%rax),%eax
+  804138:	84 c0                	test   %al,%al
+  80413a:	75 e0                	jne    80411c <strnlen+0x19>
+  return n;
+  80413c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80413f:	c9                   	leave
+  804140:	c3                   	ret
+
+0000000000804141 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804141:	55                   	push   %rbp
+  804142:	48 89 e5             	mov    %rsp,%rbp
+  804145:	48 83 ec 20          	sub    $0x20,%rsp
+  804149:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80414d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804151:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804155:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804159:	90                   	nop
+  80415a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80415e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804162:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80416e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804172:	0f b6 12             	movzbl (%rdx),%edx
+  804175:	88 10                	mov    %dl,(%rax)
+  804177:	0f b6 00             	movzbl (%rax),%eax
+  80417a:	84 c0                	test   %al,%al
+  80417c:	75 dc                	jne    80415a <strcpy+0x19>
+  return ret;
+  80417e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804182:	c9                   	leave
+  804183:	c3                   	ret
+
+0000000000804184 <strcat>:
+strcat(char *dst, const char *src) {
+  804184:	55                   	push   %rbp
+  804185:	48 89 e5             	mov    %rsp,%rbp
+  804188:	48 83 ec 20          	sub    $0x20,%rsp
+  80418c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804190:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  804194:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804198:	48 89 c7             	mov    %rax,%rdi
+  80419b:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+  8041a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8041aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041ad:	48 63 d0             	movslq %eax,%rdx
+  8041b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b4:	48 01 c2             	add    %rax,%rdx
+  8041b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041bb:	48 89 c6             	mov    %rax,%rsi
+  8041be:	48 89 d7             	mov    %rdx,%rdi
+  8041c1:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  8041c8:	00 00 00 
+  8041cb:	ff d0                	call   *%rax
+  return dst;
+  8041cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8041d1:	c9                   	leave
+  8041d2:	c3                   	ret
+
+00000000008041d3 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8041d3:	55                   	push   %rbp
+  8041d4:	48 89 e5             	mov    %rsp,%rbp
+  8041d7:	48 83 ec 28          	sub    $0x28,%rsp
+  8041db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041e3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041ef:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041f6:	00 
+  8041f7:	eb 2a                	jmp    804223 <strncpy+0x50>
+    *dst++ = *src;
+  8041f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041fd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804201:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804205:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804209:	0f b6 12             	movzbl (%rdx),%edx
+  80420c:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80420e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804212:	0f b6 00             	movzbl (%rax),%eax
+  804215:	84 c0                	test   %al,%al
+  804217:	74 05                	je     80421e <strncpy+0x4b>
+      src++;
+  804219:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80421e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804223:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804227:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80422b:	72 cc                	jb     8041f9 <strncpy+0x26>
+  return ret;
+  80422d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804231:	c9                   	leave
+  804232:	c3                   	ret
+
+0000000000804233 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  804233:	55                   	push   %rbp
+  804234:	48 89 e5             	mov    %rsp,%rbp
+  804237:	48 83 ec 28          	sub    $0x28,%rsp
+  80423b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80423f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804243:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804247:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80424b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80424f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804254:	74 3d                	je     804293 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804256:	eb 1d                	jmp    804275 <strlcpy+0x42>
+      *dst++ = *src++;
+  804258:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80425c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804260:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804264:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804268:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80426c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804270:	0f b6 12             	movzbl (%rdx),%edx
+  804273:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804275:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80427a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80427f:	74 0b                	je     80428c <strlcpy+0x59>
+  804281:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804285:	0f b6 00             	movzbl (%rax),%eax
+  804288:	84 c0                	test   %al,%al
+  80428a:	75 cc                	jne    804258 <strlcpy+0x25>
+    *dst = '\0';
+  80428c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804290:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  804293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804297:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80429b:	c9                   	leave
+  80429c:	c3                   	ret
+
+000000000080429d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80429d:	55                   	push   %rbp
+  80429e:	48 89 e5             	mov    %rsp,%rbp
+  8042a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8042a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042ad:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8042b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042b5:	48 89 c7             	mov    %rax,%rdi
+  8042b8:	48 b8 40 40 80 00 00 	movabs $0x804040,%rax
+  8042bf:	00 00 00 
+  8042c2:	ff d0                	call   *%rax
+  8042c4:	48 98                	cltq
+  8042c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8042ca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d2:	48 89 d6             	mov    %rdx,%rsi
+  8042d5:	48 89 c7             	mov    %rax,%rdi
+  8042d8:	48 b8 03 41 80 00 00 	movabs $0x804103,%rax
+  8042df:	00 00 00 
+  8042e2:	ff d0                	call   *%rax
+  8042e4:	48 98                	cltq
+  8042e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042ee:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042f2:	75 10                	jne    804304 <strlcat+0x67>
+    return maxlen + srclen;
+  8042f4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042fc:	48 01 d0             	add    %rdx,%rax
+  8042ff:	e9 86 00 00 00       	jmp    80438a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  804304:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804308:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80430c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804310:	73 2b                	jae    80433d <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  804312:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804316:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80431a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80431e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804322:	48 01 c1             	add    %rax,%rcx
+  804325:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804329:	48 89 c6             	mov    %rax,%rsi
+  80432c:	48 89 cf             	mov    %rcx,%rdi
+  80432f:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+  80433b:	eb 42                	jmp    80437f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80433d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804341:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804345:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804349:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80434d:	48 01 c1             	add    %rax,%rcx
+  804350:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804354:	48 89 c6             	mov    %rax,%rsi
+  804357:	48 89 cf             	mov    %rcx,%rdi
+  80435a:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  804361:	00 00 00 
+  804364:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804366:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80436a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80436e:	48 01 d0             	add    %rdx,%rax
+  804371:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804375:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804379:	48 01 d0             	add    %rdx,%rax
+  80437c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80437f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804387:	48 01 d0             	add    %rdx,%rax
+}
+  80438a:	c9                   	leave
+  80438b:	c3                   	ret
+
+000000000080438c <strcmp>:
+strcmp(const char *p, const char *q) {
+  80438c:	55                   	push   %rbp
+  80438d:	48 89 e5             	mov    %rsp,%rbp
+  804390:	48 83 ec 10          	sub    $0x10,%rsp
+  804394:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804398:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80439c:	eb 0a                	jmp    8043a8 <strcmp+0x1c>
+    p++, q++;
+  80439e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043a3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8043a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ac:	0f b6 00             	movzbl (%rax),%eax
+  8043af:	84 c0                	test   %al,%al
+  8043b1:	74 12                	je     8043c5 <strcmp+0x39>
+  8043b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043b7:	0f b6 10             	movzbl (%rax),%edx
+  8043ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043be:	0f b6 00             	movzbl (%rax),%eax
+  8043c1:	38 c2                	cmp    %al,%dl
+  8043c3:	74 d9                	je     80439e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8043c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043c9:	0f b6 00             	movzbl (%rax),%eax
+  8043cc:	0f b6 d0             	movzbl %al,%edx
+  8043cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043d3:	0f b6 00             	movzbl (%rax),%eax
+  8043d6:	0f b6 c0             	movzbl %al,%eax
+  8043d9:	29 c2                	sub    %eax,%edx
+  8043db:	89 d0                	mov    %edx,%eax
+}
+  8043dd:	c9                   	leave
+  8043de:	c3                   	ret
+
+00000000008043df <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043df:	55                   	push   %rbp
+  8043e0:	48 89 e5             	mov    %rsp,%rbp
+  8043e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8043e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043ef:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043f3:	eb 0f                	jmp    804404 <strncmp+0x25>
+    n--, p++, q++;
+  8043f5:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043fa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043ff:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  804404:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804409:	74 1d                	je     804428 <strncmp+0x49>
+  80440b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80440f:	0f b6 00             	movzbl (%rax),%eax
+  804412:	84 c0                	test   %al,%al
+  804414:	74 12                	je     804428 <strncmp+0x49>
+  804416:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80441a:	0f b6 10             	movzbl (%rax),%edx
+  80441d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804421:	0f b6 00             	movzbl (%rax),%eax
+  804424:	38 c2                	cmp    %al,%dl
+  804426:	74 cd                	je     8043f5 <strncmp+0x16>
+  if (n == 0)
+  804428:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80442d:	75 07                	jne    804436 <strncmp+0x57>
+    return 0;
+  80442f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804434:	eb 16                	jmp    80444c <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80443a:	0f b6 00             	movzbl (%rax),%eax
+  80443d:	0f b6 d0             	movzbl %al,%edx
+  804440:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804444:	0f b6 00             	movzbl (%rax),%eax
+  804447:	0f b6 c0             	movzbl %al,%eax
+  80444a:	29 c2                	sub    %eax,%edx
+}
+  80444c:	89 d0                	mov    %edx,%eax
+  80444e:	c9                   	leave
+  80444f:	c3                   	ret
+
+0000000000804450 <strchr>:
+strchr(const char *s, char c) {
+  804450:	55                   	push   %rbp
+  804451:	48 89 e5             	mov    %rsp,%rbp
+  804454:	48 83 ec 60          	sub    $0x60,%rsp
+  804458:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80445c:	89 f0                	mov    %esi,%eax
+  80445e:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804461:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804465:	83 e0 0f             	and    $0xf,%eax
+  804468:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80446b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80446e:	48 f7 d8             	neg    %rax
+  804471:	48 89 c2             	mov    %rax,%rdx
+  804474:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804478:	48 01 d0             	add    %rdx,%rax
+  80447b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80447f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804483:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804487:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80448b:	66 0f 6e c0          	movd   %eax,%xmm0
+  80448f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804493:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804497:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80449c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8044a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044a4:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044a8:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8044ac:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044b1:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044b6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044ba:	89 c2                	mov    %eax,%edx
+  8044bc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c1:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044c6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044ca:	09 c2                	or     %eax,%edx
+  8044cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044cf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8044d4:	89 c1                	mov    %eax,%ecx
+  8044d6:	d3 e6                	shl    %cl,%esi
+  8044d8:	89 f0                	mov    %esi,%eax
+  8044da:	21 d0                	and    %edx,%eax
+  8044dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044df:	eb 34                	jmp    804515 <strchr+0xc5>
+    p += 16;
+  8044e1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044ea:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044ee:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044f2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044f7:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044fc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804500:	89 c2                	mov    %eax,%edx
+  804502:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804507:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80450c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804510:	09 d0                	or     %edx,%eax
+  804512:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804515:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804519:	74 c6                	je     8044e1 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80451b:	31 c0                	xor    %eax,%eax
+  80451d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  804522:	48 98                	cltq
+  804524:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  804528:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80452c:	0f b6 00             	movzbl (%rax),%eax
+  80452f:	84 c0                	test   %al,%al
+  804531:	74 06                	je     804539 <strchr+0xe9>
+  804533:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804537:	eb 05                	jmp    80453e <strchr+0xee>
+  804539:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80453e:	c9                   	leave
+  80453f:	c3                   	ret
+
+0000000000804540 <strfind>:
+strfind(const char *s, char c) {
+  804540:	55                   	push   %rbp
+  804541:	48 89 e5             	mov    %rsp,%rbp
+  804544:	48 83 ec 10          	sub    $0x10,%rsp
+  804548:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80454c:	89 f0                	mov    %esi,%eax
+  80454e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804551:	eb 11                	jmp    804564 <strfind+0x24>
+    if (*s == c)
+  804553:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804557:	0f b6 00             	movzbl (%rax),%eax
+  80455a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80455d:	74 12                	je     804571 <strfind+0x31>
+  for (; *s; s++)
+  80455f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804564:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804568:	0f b6 00             	movzbl (%rax),%eax
+  80456b:	84 c0                	test   %al,%al
+  80456d:	75 e4                	jne    804553 <strfind+0x13>
+  80456f:	eb 01                	jmp    804572 <strfind+0x32>
+      break;
+  804571:	90                   	nop
+  return (char *)s;
+  804572:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804576:	c9                   	leave
+  804577:	c3                   	ret
+
+0000000000804578 <memset>:
+memset(void *v, int c, size_t n) {
+  804578:	55                   	push   %rbp
+  804579:	48 89 e5             	mov    %rsp,%rbp
+  80457c:	48 83 ec 38          	sub    $0x38,%rsp
+  804580:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804584:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804587:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80458b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80458f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804593:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804598:	76 41                	jbe    8045db <memset+0x63>
+  80459a:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  8045a1:	00 00 00 
+  8045a4:	ff d0                	call   *%rax
+  8045a6:	83 e0 01             	and    $0x1,%eax
+  8045a9:	85 c0                	test   %eax,%eax
+  8045ab:	74 2e                	je     8045db <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8045ad:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045b0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045b8:	48 89 ce             	mov    %rcx,%rsi
+  8045bb:	48 89 f7             	mov    %rsi,%rdi
+  8045be:	48 89 d1             	mov    %rdx,%rcx
+  8045c1:	fc                   	cld
+  8045c2:	f3 aa                	rep stos %al,%es:(%rdi)
+  8045c4:	48 89 ca             	mov    %rcx,%rdx
+  8045c7:	48 89 fe             	mov    %rdi,%rsi
+  8045ca:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8045ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8045d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045d6:	e9 a7 00 00 00       	jmp    804682 <memset+0x10a>
+  if (n >= 8) {
+  8045db:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045e0:	0f 86 87 00 00 00    	jbe    80466d <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045e6:	eb 16                	jmp    8045fe <memset+0x86>
+      *p++ = c;
+  8045e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045f0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045f4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045f7:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045f9:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804602:	83 e0 07             	and    $0x7,%eax
+  804605:	48 85 c0             	test   %rax,%rax
+  804608:	75 de                	jne    8045e8 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80460a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80460d:	0f b6 c0             	movzbl %al,%eax
+  804610:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  804617:	01 01 01 
+  80461a:	48 0f af c2          	imul   %rdx,%rax
+  80461e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  804622:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804626:	48 c1 e8 03          	shr    $0x3,%rax
+  80462a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80462e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804632:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804636:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80463a:	48 89 ce             	mov    %rcx,%rsi
+  80463d:	48 89 f7             	mov    %rsi,%rdi
+  804640:	48 89 d1             	mov    %rdx,%rcx
+  804643:	fc                   	cld
+  804644:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804647:	48 89 ca             	mov    %rcx,%rdx
+  80464a:	48 89 fe             	mov    %rdi,%rsi
+  80464d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804651:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804655:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  80465a:	eb 11                	jmp    80466d <memset+0xf5>
+    *p++ = c;
+  80465c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804660:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804664:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804668:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80466b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80466d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804671:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804675:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804679:	48 85 c0             	test   %rax,%rax
+  80467c:	75 de                	jne    80465c <memset+0xe4>
+  return v;
+  80467e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804682:	c9                   	leave
+  804683:	c3                   	ret
+
+0000000000804684 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  804684:	55                   	push   %rbp
+  804685:	48 89 e5             	mov    %rsp,%rbp
+  804688:	48 83 ec 38          	sub    $0x38,%rsp
+  80468c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804690:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804694:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804698:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80469c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8046a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8046a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ac:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8046b0:	0f 83 da 00 00 00    	jae    804790 <memmove+0x10c>
+  8046b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046be:	48 01 d0             	add    %rdx,%rax
+  8046c1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8046c5:	0f 83 c5 00 00 00    	jae    804790 <memmove+0x10c>
+    s += n;
+  8046cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046cf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8046d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046d7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046db:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046e0:	0f 86 94 00 00 00    	jbe    80477a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046e6:	eb 1c                	jmp    804704 <memmove+0x80>
+        *--d = *--s;
+  8046e8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046ed:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046f6:	0f b6 10             	movzbl (%rax),%edx
+  8046f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046fd:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046ff:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804704:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804708:	83 e0 07             	and    $0x7,%eax
+  80470b:	48 85 c0             	test   %rax,%rax
+  80470e:	75 d8                	jne    8046e8 <memmove+0x64>
+      nq = n / 8;
+  804710:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804714:	48 c1 e8 03          	shr    $0x3,%rax
+  804718:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80471c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  804721:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  804726:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80472b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80472f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804733:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804737:	48 89 cf             	mov    %rcx,%rdi
+  80473a:	48 89 d6             	mov    %rdx,%rsi
+  80473d:	48 89 c1             	mov    %rax,%rcx
+  804740:	fd                   	std
+  804741:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804744:	fc                   	cld
+  804745:	48 89 c8             	mov    %rcx,%rax
+  804748:	48 89 f2             	mov    %rsi,%rdx
+  80474b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80474f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804753:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804757:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80475c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804761:	eb 17                	jmp    80477a <memmove+0xf6>
+      *--d = *--s;
+  804763:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804768:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80476d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804771:	0f b6 10             	movzbl (%rax),%edx
+  804774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804778:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80477a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80477e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804782:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804786:	48 85 c0             	test   %rax,%rax
+  804789:	75 d8                	jne    804763 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80478b:	e9 f4 00 00 00       	jmp    804884 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804790:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804795:	76 46                	jbe    8047dd <memmove+0x159>
+  804797:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  80479e:	00 00 00 
+  8047a1:	ff d0                	call   *%rax
+  8047a3:	83 e0 01             	and    $0x1,%eax
+  8047a6:	85 c0                	test   %eax,%eax
+  8047a8:	74 33                	je     8047dd <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8047aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047b6:	48 89 cf             	mov    %rcx,%rdi
+  8047b9:	48 89 d6             	mov    %rdx,%rsi
+  8047bc:	48 89 c1             	mov    %rax,%rcx
+  8047bf:	fc                   	cld
+  8047c0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8047c2:	48 89 c8             	mov    %rcx,%rax
+  8047c5:	48 89 f2             	mov    %rsi,%rdx
+  8047c8:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8047cc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8047d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8047d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047d8:	e9 ab 00 00 00       	jmp    804888 <memmove+0x204>
+    if (n >= 8) {
+  8047dd:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047e2:	0f 86 8b 00 00 00    	jbe    804873 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047e8:	eb 22                	jmp    80480c <memmove+0x188>
+        *d++ = *s++;
+  8047ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047ee:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047fa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047fe:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804802:	0f b6 12             	movzbl (%rdx),%edx
+  804805:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  804807:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80480c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804810:	83 e0 07             	and    $0x7,%eax
+  804813:	48 85 c0             	test   %rax,%rax
+  804816:	75 d2                	jne    8047ea <memmove+0x166>
+      nq = n / 8;
+  804818:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80481c:	48 c1 e8 03          	shr    $0x3,%rax
+  804820:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  804824:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804828:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80482c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804830:	48 89 cf             	mov    %rcx,%rdi
+  804833:	48 89 d6             	mov    %rdx,%rsi
+  804836:	48 89 c1             	mov    %rax,%rcx
+  804839:	fc                   	cld
+  80483a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80483d:	48 89 c8             	mov    %rcx,%rax
+  804840:	48 89 f2             	mov    %rsi,%rdx
+  804843:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804847:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80484b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80484f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804854:	eb 1d                	jmp    804873 <memmove+0x1ef>
+      *d++ = *s++;
+  804856:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80485a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80485e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804862:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804866:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80486a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80486e:	0f b6 12             	movzbl (%rdx),%edx
+  804871:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804873:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804877:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80487b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80487f:	48 85 c0             	test   %rax,%rax
+  804882:	75 d2                	jne    804856 <memmove+0x1d2>
+  return dst;
+  804884:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804888:	c9                   	leave
+  804889:	c3                   	ret
+
+000000000080488a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80488a:	55                   	push   %rbp
+  80488b:	48 89 e5             	mov    %rsp,%rbp
+  80488e:	48 83 ec 18          	sub    $0x18,%rsp
+  804892:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804896:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80489a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80489e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048a2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048aa:	48 89 ce             	mov    %rcx,%rsi
+  8048ad:	48 89 c7             	mov    %rax,%rdi
+  8048b0:	48 b8 84 46 80 00 00 	movabs $0x804684,%rax
+  8048b7:	00 00 00 
+  8048ba:	ff d0                	call   *%rax
+}
+  8048bc:	c9                   	leave
+  8048bd:	c3                   	ret
+
+00000000008048be <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  8048be:	55                   	push   %rbp
+  8048bf:	48 89 e5             	mov    %rsp,%rbp
+  8048c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8048c6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048ca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8048d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048e2:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048e7:	0f 86 a7 00 00 00    	jbe    804994 <memcmp+0xd6>
+  8048ed:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  8048f4:	00 00 00 
+  8048f7:	ff d0                	call   *%rax
+  8048f9:	83 e0 02             	and    $0x2,%eax
+  8048fc:	85 c0                	test   %eax,%eax
+  8048fe:	0f 84 90 00 00 00    	je     804994 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  804904:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804908:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80490c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804910:	48 89 ce             	mov    %rcx,%rsi
+  804913:	48 89 c7             	mov    %rax,%rdi
+  804916:	48 b8 a5 3e 80 00 00 	movabs $0x803ea5,%rax
+  80491d:	00 00 00 
+  804920:	ff d0                	call   *%rax
+  804922:	e9 c2 00 00 00       	jmp    8049e9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  804927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80492b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80492f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804933:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804937:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80493b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80493f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804943:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804946:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  80494d:	74 36                	je     804985 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80494f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804952:	f7 d0                	not    %eax
+  804954:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804958:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80495b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80495e:	48 63 d0             	movslq %eax,%rdx
+  804961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804965:	48 01 d0             	add    %rdx,%rax
+  804968:	0f b6 00             	movzbl (%rax),%eax
+  80496b:	0f b6 c0             	movzbl %al,%eax
+  80496e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804971:	48 63 ca             	movslq %edx,%rcx
+  804974:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804978:	48 01 ca             	add    %rcx,%rdx
+  80497b:	0f b6 12             	movzbl (%rdx),%edx
+  80497e:	0f b6 d2             	movzbl %dl,%edx
+  804981:	29 d0                	sub    %edx,%eax
+  804983:	eb 64                	jmp    8049e9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804985:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  80498a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80498f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  804994:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804999:	77 8c                	ja     804927 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80499b:	eb 36                	jmp    8049d3 <memcmp+0x115>
+    if (*s1 != *s2)
+  80499d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049a1:	0f b6 10             	movzbl (%rax),%edx
+  8049a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049a8:	0f b6 00             	movzbl (%rax),%eax
+  8049ab:	38 c2                	cmp    %al,%dl
+  8049ad:	74 1a                	je     8049c9 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  8049af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049b3:	0f b6 00             	movzbl (%rax),%eax
+  8049b6:	0f b6 c8             	movzbl %al,%ecx
+  8049b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049bd:	0f b6 00             	movzbl (%rax),%eax
+  8049c0:	0f b6 d0             	movzbl %al,%edx
+  8049c3:	89 c8                	mov    %ecx,%eax
+  8049c5:	29 d0                	sub    %edx,%eax
+  8049c7:	eb 20                	jmp    8049e9 <memcmp+0x12b>
+    s1++, s2++;
+  8049c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8049ce:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8049d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049d7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049df:	48 85 c0             	test   %rax,%rax
+  8049e2:	75 b9                	jne    80499d <memcmp+0xdf>
+  }
+
+  return 0;
+  8049e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049e9:	c9                   	leave
+  8049ea:	c3                   	ret
+
+00000000008049eb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049eb:	55                   	push   %rbp
+  8049ec:	48 89 e5             	mov    %rsp,%rbp
+  8049ef:	48 83 ec 50          	sub    $0x50,%rsp
+  8049f3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049f7:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049fa:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a02:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a06:	48 01 d0             	add    %rdx,%rax
+  804a09:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  804a0d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a10:	66 0f 6e c0          	movd   %eax,%xmm0
+  804a14:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804a18:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804a1c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804a21:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804a25:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a2a:	76 73                	jbe    804a9f <memfind+0xb4>
+  804a2c:	48 b8 dd 3c 80 00 00 	movabs $0x803cdd,%rax
+  804a33:	00 00 00 
+  804a36:	ff d0                	call   *%rax
+  804a38:	83 e0 02             	and    $0x2,%eax
+  804a3b:	85 c0                	test   %eax,%eax
+  804a3d:	74 60                	je     804a9f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a3f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a42:	0f b6 c8             	movzbl %al,%ecx
+  804a45:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4d:	89 ce                	mov    %ecx,%esi
+  804a4f:	48 89 c7             	mov    %rax,%rdi
+  804a52:	48 b8 94 3f 80 00 00 	movabs $0x803f94,%rax
+  804a59:	00 00 00 
+  804a5c:	ff d0                	call   *%rax
+  804a5e:	eb 6c                	jmp    804acc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a64:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a68:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a6c:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a71:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a75:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a79:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a7c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a80:	74 13                	je     804a95 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a82:	31 c0                	xor    %eax,%eax
+  804a84:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a89:	48 63 d0             	movslq %eax,%rdx
+  804a8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a90:	48 01 d0             	add    %rdx,%rax
+  804a93:	eb 37                	jmp    804acc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a95:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a9a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a9f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804aa4:	77 ba                	ja     804a60 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804aa6:	eb 13                	jmp    804abb <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804aa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aac:	0f b6 00             	movzbl (%rax),%eax
+  804aaf:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804ab2:	38 d0                	cmp    %dl,%al
+  804ab4:	74 11                	je     804ac7 <memfind+0xdc>
+  for (; s < ends; s++)
+  804ab6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804abb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804abf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804ac3:	72 e3                	jb     804aa8 <memfind+0xbd>
+  804ac5:	eb 01                	jmp    804ac8 <memfind+0xdd>
+      break;
+  804ac7:	90                   	nop
+  return (void *)s;
+  804ac8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804acc:	c9                   	leave
+  804acd:	c3                   	ret
+
+0000000000804ace <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804ace:	55                   	push   %rbp
+  804acf:	48 89 e5             	mov    %rsp,%rbp
+  804ad2:	48 83 ec 38          	sub    $0x38,%rsp
+  804ad6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ada:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ade:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804ae1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804ae8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804aef:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804af0:	eb 05                	jmp    804af7 <strtol+0x29>
+    s++;
+  804af2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804af7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804afb:	0f b6 00             	movzbl (%rax),%eax
+  804afe:	3c 20                	cmp    $0x20,%al
+  804b00:	74 f0                	je     804af2 <strtol+0x24>
+  804b02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b06:	0f b6 00             	movzbl (%rax),%eax
+  804b09:	3c 09                	cmp    $0x9,%al
+  804b0b:	74 e5                	je     804af2 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804b0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b11:	0f b6 00             	movzbl (%rax),%eax
+  804b14:	3c 2b                	cmp    $0x2b,%al
+  804b16:	75 07                	jne    804b1f <strtol+0x51>
+    s++;
+  804b18:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b1d:	eb 17                	jmp    804b36 <strtol+0x68>
+  else if (*s == '-')
+  804b1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b23:	0f b6 00             	movzbl (%rax),%eax
+  804b26:	3c 2d                	cmp    $0x2d,%al
+  804b28:	75 0c                	jne    804b36 <strtol+0x68>
+    s++, neg = 1;
+  804b2a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b2f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b36:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b3a:	74 06                	je     804b42 <strtol+0x74>
+  804b3c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b40:	75 28                	jne    804b6a <strtol+0x9c>
+  804b42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b46:	0f b6 00             	movzbl (%rax),%eax
+  804b49:	3c 30                	cmp    $0x30,%al
+  804b4b:	75 1d                	jne    804b6a <strtol+0x9c>
+  804b4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b51:	48 83 c0 01          	add    $0x1,%rax
+  804b55:	0f b6 00             	movzbl (%rax),%eax
+  804b58:	3c 78                	cmp    $0x78,%al
+  804b5a:	75 0e                	jne    804b6a <strtol+0x9c>
+    s += 2, base = 16;
+  804b5c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b61:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b68:	eb 2c                	jmp    804b96 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b6a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b6e:	75 19                	jne    804b89 <strtol+0xbb>
+  804b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b74:	0f b6 00             	movzbl (%rax),%eax
+  804b77:	3c 30                	cmp    $0x30,%al
+  804b79:	75 0e                	jne    804b89 <strtol+0xbb>
+    s++, base = 8;
+  804b7b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b80:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b87:	eb 0d                	jmp    804b96 <strtol+0xc8>
+  else if (base == 0)
+  804b89:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b8d:	75 07                	jne    804b96 <strtol+0xc8>
+    base = 10;
+  804b8f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b9a:	0f b6 00             	movzbl (%rax),%eax
+  804b9d:	3c 2f                	cmp    $0x2f,%al
+  804b9f:	7e 1d                	jle    804bbe <strtol+0xf0>
+  804ba1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba5:	0f b6 00             	movzbl (%rax),%eax
+  804ba8:	3c 39                	cmp    $0x39,%al
+  804baa:	7f 12                	jg     804bbe <strtol+0xf0>
+      dig = *s - '0';
+  804bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb0:	0f b6 00             	movzbl (%rax),%eax
+  804bb3:	0f be c0             	movsbl %al,%eax
+  804bb6:	83 e8 30             	sub    $0x30,%eax
+  804bb9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbc:	eb 4e                	jmp    804c0c <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804bbe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc2:	0f b6 00             	movzbl (%rax),%eax
+  804bc5:	3c 60                	cmp    $0x60,%al
+  804bc7:	7e 1d                	jle    804be6 <strtol+0x118>
+  804bc9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bcd:	0f b6 00             	movzbl (%rax),%eax
+  804bd0:	3c 7a                	cmp    $0x7a,%al
+  804bd2:	7f 12                	jg     804be6 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804bd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bd8:	0f b6 00             	movzbl (%rax),%eax
+  804bdb:	0f be c0             	movsbl %al,%eax
+  804bde:	83 e8 57             	sub    $0x57,%eax
+  804be1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804be4:	eb 26                	jmp    804c0c <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804be6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bea:	0f b6 00             	movzbl (%rax),%eax
+  804bed:	3c 40                	cmp    $0x40,%al
+  804bef:	7e 47                	jle    804c38 <strtol+0x16a>
+  804bf1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf5:	0f b6 00             	movzbl (%rax),%eax
+  804bf8:	3c 5a                	cmp    $0x5a,%al
+  804bfa:	7f 3c                	jg     804c38 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bfc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c00:	0f b6 00             	movzbl (%rax),%eax
+  804c03:	0f be c0             	movsbl %al,%eax
+  804c06:	83 e8 37             	sub    $0x37,%eax
+  804c09:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804c0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c0f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804c12:	7d 23                	jge    804c37 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804c14:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804c19:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c1c:	48 98                	cltq
+  804c1e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804c23:	48 89 c2             	mov    %rax,%rdx
+  804c26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c29:	48 98                	cltq
+  804c2b:	48 01 d0             	add    %rdx,%rax
+  804c2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c32:	e9 5f ff ff ff       	jmp    804b96 <strtol+0xc8>
+      break;
+  804c37:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c38:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c3d:	74 0b                	je     804c4a <strtol+0x17c>
+    *endptr = (char *)s;
+  804c3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c43:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c47:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c4e:	74 09                	je     804c59 <strtol+0x18b>
+  804c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c54:	48 f7 d8             	neg    %rax
+  804c57:	eb 04                	jmp    804c5d <strtol+0x18f>
+  804c59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c5d:	c9                   	leave
+  804c5e:	c3                   	ret
+
+0000000000804c5f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c5f:	55                   	push   %rbp
+  804c60:	48 89 e5             	mov    %rsp,%rbp
+  804c63:	48 83 ec 20          	sub    $0x20,%rsp
+  804c67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c6f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c73:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c77:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c7f:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c86:	48 89 c7             	mov    %rax,%rdi
+  804c89:	48 b8 97 4c 80 00 00 	movabs $0x804c97,%rax
+  804c90:	00 00 00 
+  804c93:	ff d0                	call   *%rax
+}
+  804c95:	c9                   	leave
+  804c96:	c3                   	ret
+
+0000000000804c97 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c97:	55                   	push   %rbp
+  804c98:	48 89 e5             	mov    %rsp,%rbp
+  804c9b:	48 83 ec 30          	sub    $0x30,%rsp
+  804c9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ca3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804ca7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804cab:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804caf:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804cb4:	75 0e                	jne    804cc4 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804cb6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804cbd:	00 00 00 
+  804cc0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804cc4:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cc9:	75 18                	jne    804ce3 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804ccb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ccf:	48 89 c7             	mov    %rax,%rdi
+  804cd2:	48 b8 22 06 80 00 00 	movabs $0x800622,%rax
+  804cd9:	00 00 00 
+  804cdc:	ff d0                	call   *%rax
+  804cde:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ce1:	eb 1d                	jmp    804d00 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804ce3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ce7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ceb:	48 89 d6             	mov    %rdx,%rsi
+  804cee:	48 89 c7             	mov    %rax,%rdi
+  804cf1:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  804cf8:	00 00 00 
+  804cfb:	ff d0                	call   *%rax
+  804cfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804d00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d04:	79 2a                	jns    804d30 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804d06:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d0b:	74 0a                	je     804d17 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804d0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d11:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804d17:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d1c:	74 0a                	je     804d28 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d22:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d2b:	e9 aa 00 00 00       	jmp    804dda <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d30:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d35:	74 36                	je     804d6d <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d37:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d3e:	00 00 00 
+  804d41:	8b 40 04             	mov    0x4(%rax),%eax
+  804d44:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d49:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d50:	00 00 00 
+  804d53:	48 98                	cltq
+  804d55:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d5c:	48 01 d0             	add    %rdx,%rax
+  804d5f:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d65:	8b 10                	mov    (%rax),%edx
+  804d67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d6b:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d6d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d72:	74 36                	je     804daa <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d74:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d7b:	00 00 00 
+  804d7e:	8b 40 04             	mov    0x4(%rax),%eax
+  804d81:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d86:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d8d:	00 00 00 
+  804d90:	48 98                	cltq
+  804d92:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d99:	48 01 d0             	add    %rdx,%rax
+  804d9c:	48 05 28 01 00 00    	add    $0x128,%rax
+  804da2:	8b 10                	mov    (%rax),%edx
+  804da4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804da8:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804daa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804db1:	00 00 00 
+  804db4:	8b 40 04             	mov    0x4(%rax),%eax
+  804db7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804dbc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804dc3:	00 00 00 
+  804dc6:	48 98                	cltq
+  804dc8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dcf:	48 01 d0             	add    %rdx,%rax
+  804dd2:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dd8:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dda:	c9                   	leave
+  804ddb:	c3                   	ret
+
+0000000000804ddc <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804ddc:	55                   	push   %rbp
+  804ddd:	48 89 e5             	mov    %rsp,%rbp
+  804de0:	48 83 ec 30          	sub    $0x30,%rsp
+  804de4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804de7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dea:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dee:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804df1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804df6:	75 5e                	jne    804e56 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804df8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dff:	00 00 00 
+  804e02:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e06:	eb 4e                	jmp    804e56 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804e08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e0c:	79 3c                	jns    804e4a <ipc_send+0x6e>
+  804e0e:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804e12:	74 36                	je     804e4a <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804e14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e17:	89 c1                	mov    %eax,%ecx
+  804e19:	48 b8 48 56 80 00 00 	movabs $0x805648,%rax
+  804e20:	00 00 00 
+  804e23:	48 89 c2             	mov    %rax,%rdx
+  804e26:	be 54 00 00 00       	mov    $0x54,%esi
+  804e2b:	48 b8 6e 56 80 00 00 	movabs $0x80566e,%rax
+  804e32:	00 00 00 
+  804e35:	48 89 c7             	mov    %rax,%rdi
+  804e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e3d:	49 b8 72 2f 80 00 00 	movabs $0x802f72,%r8
+  804e44:	00 00 00 
+  804e47:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e4a:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  804e51:	00 00 00 
+  804e54:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e56:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e59:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e5c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e63:	89 c7                	mov    %eax,%edi
+  804e65:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  804e6c:	00 00 00 
+  804e6f:	ff d0                	call   *%rax
+  804e71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e74:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e78:	75 8e                	jne    804e08 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e7a:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  804e81:	00 00 00 
+  804e84:	ff d0                	call   *%rax
+}
+  804e86:	90                   	nop
+  804e87:	c9                   	leave
+  804e88:	c3                   	ret
+
+0000000000804e89 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e89:	55                   	push   %rbp
+  804e8a:	48 89 e5             	mov    %rsp,%rbp
+  804e8d:	48 83 ec 18          	sub    $0x18,%rsp
+  804e91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e94:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e9b:	eb 4d                	jmp    804eea <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e9d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ea4:	00 00 00 
+  804ea7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eaa:	48 98                	cltq
+  804eac:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eb3:	48 01 d0             	add    %rdx,%rax
+  804eb6:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ebc:	8b 00                	mov    (%rax),%eax
+  804ebe:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ec1:	75 23                	jne    804ee6 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804ec3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eca:	00 00 00 
+  804ecd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ed0:	48 98                	cltq
+  804ed2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ed9:	48 01 d0             	add    %rdx,%rax
+  804edc:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ee2:	8b 00                	mov    (%rax),%eax
+  804ee4:	eb 12                	jmp    804ef8 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ee6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804eea:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ef1:	7e aa                	jle    804e9d <ipc_find_env+0x14>
+  return 0;
+  804ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ef8:	c9                   	leave
+  804ef9:	c3                   	ret
+
+0000000000804efa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804efa:	55                   	push   %rbp
+  804efb:	48 89 e5             	mov    %rsp,%rbp
+  804efe:	48 83 ec 18          	sub    $0x18,%rsp
+  804f02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0a:	48 c1 e8 27          	shr    $0x27,%rax
+  804f0e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804f13:	48 89 c2             	mov    %rax,%rdx
+  804f16:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f1d:	01 00 00 
+  804f20:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f24:	83 e0 01             	and    $0x1,%eax
+  804f27:	48 85 c0             	test   %rax,%rax
+  804f2a:	74 63                	je     804f8f <pageref+0x95>
+  804f2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f30:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f34:	48 89 c2             	mov    %rax,%rdx
+  804f37:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f3e:	01 00 00 
+  804f41:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f45:	83 e0 01             	and    $0x1,%eax
+  804f48:	48 85 c0             	test   %rax,%rax
+  804f4b:	74 42                	je     804f8f <pageref+0x95>
+  804f4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f51:	48 c1 e8 15          	shr    $0x15,%rax
+  804f55:	48 89 c2             	mov    %rax,%rdx
+  804f58:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f5f:	01 00 00 
+  804f62:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f66:	83 e0 01             	and    $0x1,%eax
+  804f69:	48 85 c0             	test   %rax,%rax
+  804f6c:	74 21                	je     804f8f <pageref+0x95>
+  804f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f72:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f76:	48 89 c2             	mov    %rax,%rdx
+  804f79:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f80:	01 00 00 
+  804f83:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f87:	83 e0 01             	and    $0x1,%eax
+  804f8a:	48 85 c0             	test   %rax,%rax
+  804f8d:	75 07                	jne    804f96 <pageref+0x9c>
+    return 0;
+  804f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f94:	eb 53                	jmp    804fe9 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f9a:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f9e:	48 89 c2             	mov    %rax,%rdx
+  804fa1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804fa8:	01 00 00 
+  804fab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804faf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb7:	83 e0 01             	and    $0x1,%eax
+  804fba:	48 85 c0             	test   %rax,%rax
+  804fbd:	75 07                	jne    804fc6 <pageref+0xcc>
+    return 0;
+  804fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fc4:	eb 23                	jmp    804fe9 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fca:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fce:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fd5:	00 00 00 
+  804fd8:	48 c1 e0 04          	shl    $0x4,%rax
+  804fdc:	48 01 d0             	add    %rdx,%rax
+  804fdf:	48 83 c0 08          	add    $0x8,%rax
+  804fe3:	0f b7 00             	movzwl (%rax),%eax
+  804fe6:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fe9:	c9                   	leave
+  804fea:	c3                   	ret
+  804feb:	90                   	nop
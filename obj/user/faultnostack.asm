@@ -0,0 +1,8249 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 41 00 00 00       	call   80006d <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800041:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c6             	mov    %rax,%rsi
+  80004e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800053:	48 b8 61 05 80 00 00 	movabs $0x800561,%rax
+  80005a:	00 00 00 
+  80005d:	ff d0                	call   *%rax
+  *(volatile int *)0 = 0;
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800064:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80006a:	90                   	nop
+  80006b:	c9                   	leave
+  80006c:	c3                   	ret
+
+000000000080006d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80006d:	55                   	push   %rbp
+  80006e:	48 89 e5             	mov    %rsp,%rbp
+  800071:	48 83 ec 20          	sub    $0x20,%rsp
+  800075:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800078:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80007c:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800083:	00 00 00 
+  800086:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80008a:	eb 13                	jmp    80009f <libmain+0x32>
+    (*ctor)();
+  80008c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800090:	48 8b 10             	mov    (%rax),%rdx
+  800093:	b8 00 00 00 00       	mov    $0x0,%eax
+  800098:	ff d2                	call   *%rdx
+    ctor++;
+  80009a:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80009f:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000a6:	00 00 00 
+  8000a9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000ad:	72 dd                	jb     80008c <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000b3:	7e 14                	jle    8000c9 <libmain+0x5c>
+    binaryname = argv[0];
+  8000b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000b9:	48 8b 00             	mov    (%rax),%rax
+  8000bc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000c3:	00 00 00 
+  8000c6:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000d0:	48 89 d6             	mov    %rdx,%rsi
+  8000d3:	89 c7                	mov    %eax,%edi
+  8000d5:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000e1:	48 b8 f0 00 80 00 00 	movabs $0x8000f0,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+#endif
+}
+  8000ed:	90                   	nop
+  8000ee:	c9                   	leave
+  8000ef:	c3                   	ret
+
+00000000008000f0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f0:	55                   	push   %rbp
+  8000f1:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000f4:	48 b8 01 0f 80 00 00 	movabs $0x800f01,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800100:	bf 00 00 00 00       	mov    $0x0,%edi
+  800105:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+}
+  800111:	90                   	nop
+  800112:	5d                   	pop    %rbp
+  800113:	c3                   	ret
+
+0000000000800114 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  800114:	55                   	push   %rbp
+  800115:	48 89 e5             	mov    %rsp,%rbp
+  800118:	53                   	push   %rbx
+  800119:	48 83 ec 48          	sub    $0x48,%rsp
+  80011d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800121:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800125:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800129:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80012d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800131:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800135:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800139:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80013d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800141:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800145:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800149:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80014d:	4c 89 c3             	mov    %r8,%rbx
+  800150:	cd 30                	int    $0x30
+  800152:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  800156:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80015b:	74 46                	je     8001a3 <syscall+0x8f>
+  80015d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800162:	7e 3f                	jle    8001a3 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800164:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800168:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80016c:	49 89 d0             	mov    %rdx,%r8
+  80016f:	48 89 c1             	mov    %rax,%rcx
+  800172:	48 b8 50 51 80 00 00 	movabs $0x805150,%rax
+  800179:	00 00 00 
+  80017c:	48 89 c2             	mov    %rax,%rdx
+  80017f:	be 22 00 00 00       	mov    $0x22,%esi
+  800184:	48 b8 6f 51 80 00 00 	movabs $0x80516f,%rax
+  80018b:	00 00 00 
+  80018e:	48 89 c7             	mov    %rax,%rdi
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	49 b9 ba 2f 80 00 00 	movabs $0x802fba,%r9
+  80019d:	00 00 00 
+  8001a0:	41 ff d1             	call   *%r9
+
+  return ret;
+  8001a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8001a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ab:	c9                   	leave
+  8001ac:	c3                   	ret
+
+00000000008001ad <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001ad:	55                   	push   %rbp
+  8001ae:	48 89 e5             	mov    %rsp,%rbp
+  8001b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8001b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c9:	6a 00                	push   $0x0
+  8001cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001d7:	48 89 d1             	mov    %rdx,%rcx
+  8001da:	48 89 c2             	mov    %rax,%rdx
+  8001dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e7:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8001ee:	00 00 00 
+  8001f1:	ff d0                	call   *%rax
+  8001f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001f7:	90                   	nop
+  8001f8:	c9                   	leave
+  8001f9:	c3                   	ret
+
+00000000008001fa <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800202:	6a 00                	push   $0x0
+  800204:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80020a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800215:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021a:	be 00 00 00 00       	mov    $0x0,%esi
+  80021f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800224:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+  800230:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800234:	c9                   	leave
+  800235:	c3                   	ret
+
+0000000000800236 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800236:	55                   	push   %rbp
+  800237:	48 89 e5             	mov    %rsp,%rbp
+  80023a:	48 83 ec 10          	sub    $0x10,%rsp
+  80023e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800241:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800244:	48 98                	cltq
+  800246:	48 83 ec 08          	sub    $0x8,%rsp
+  80024a:	6a 00                	push   $0x0
+  80024c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800252:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800258:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80025d:	48 89 c2             	mov    %rax,%rdx
+  800260:	be 01 00 00 00       	mov    $0x1,%esi
+  800265:	bf 03 00 00 00       	mov    $0x3,%edi
+  80026a:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+  800276:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+000000000080027c <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	48 83 ec 10          	sub    $0x10,%rsp
+  800284:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80028a:	48 98                	cltq
+  80028c:	48 83 ec 08          	sub    $0x8,%rsp
+  800290:	6a 00                	push   $0x0
+  800292:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80029e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002a3:	48 89 c2             	mov    %rax,%rdx
+  8002a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ab:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002b0:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+  8002bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002c0:	90                   	nop
+  8002c1:	c9                   	leave
+  8002c2:	c3                   	ret
+
+00000000008002c3 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002c3:	55                   	push   %rbp
+  8002c4:	48 89 e5             	mov    %rsp,%rbp
+  8002c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8002cb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002d5:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002d8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002dd:	cd 30                	int    $0x30
+  8002df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002e3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002e7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002ec:	7e 3d                	jle    80032b <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002f2:	49 89 c0             	mov    %rax,%r8
+  8002f5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002fa:	48 b8 50 51 80 00 00 	movabs $0x805150,%rax
+  800301:	00 00 00 
+  800304:	48 89 c2             	mov    %rax,%rdx
+  800307:	be 49 00 00 00       	mov    $0x49,%esi
+  80030c:	48 b8 6f 51 80 00 00 	movabs $0x80516f,%rax
+  800313:	00 00 00 
+  800316:	48 89 c7             	mov    %rax,%rdi
+  800319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031e:	49 b9 ba 2f 80 00 00 	movabs $0x802fba,%r9
+  800325:	00 00 00 
+  800328:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80032b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800330:	75 13                	jne    800345 <sys_env_wait+0x82>
+  800332:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800337:	74 0c                	je     800345 <sys_env_wait+0x82>
+    *status = st;
+  800339:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80033d:	89 c2                	mov    %eax,%edx
+  80033f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800343:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+000000000080034b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80034f:	48 83 ec 08          	sub    $0x8,%rsp
+  800353:	6a 00                	push   $0x0
+  800355:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80035b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800361:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800366:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036b:	be 00 00 00 00       	mov    $0x0,%esi
+  800370:	bf 02 00 00 00       	mov    $0x2,%edi
+  800375:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+
+0000000000800387 <sys_yield>:
+
+void
+sys_yield(void) {
+  800387:	55                   	push   %rbp
+  800388:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80038b:	48 83 ec 08          	sub    $0x8,%rsp
+  80038f:	6a 00                	push   $0x0
+  800391:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800397:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80039d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ac:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003b1:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8003b8:	00 00 00 
+  8003bb:	ff d0                	call   *%rax
+  8003bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003c1:	90                   	nop
+  8003c2:	c9                   	leave
+  8003c3:	c3                   	ret
+
+00000000008003c4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003c4:	55                   	push   %rbp
+  8003c5:	48 89 e5             	mov    %rsp,%rbp
+  8003c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8003cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003d3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003d6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003d9:	48 63 c8             	movslq %eax,%rcx
+  8003dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003e3:	48 98                	cltq
+  8003e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e9:	6a 00                	push   $0x0
+  8003eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003f1:	49 89 c8             	mov    %rcx,%r8
+  8003f4:	48 89 d1             	mov    %rdx,%rcx
+  8003f7:	48 89 c2             	mov    %rax,%rdx
+  8003fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ff:	bf 06 00 00 00       	mov    $0x6,%edi
+  800404:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80040b:	00 00 00 
+  80040e:	ff d0                	call   *%rax
+  800410:	48 83 c4 10          	add    $0x10,%rsp
+  800414:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  800417:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80041a:	c9                   	leave
+  80041b:	c3                   	ret
+
+000000000080041c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 83 ec 20          	sub    $0x20,%rsp
+  800424:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800427:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80042b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80042e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800432:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800436:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800439:	48 63 c8             	movslq %eax,%rcx
+  80043c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800440:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800443:	48 63 f0             	movslq %eax,%rsi
+  800446:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80044a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80044d:	48 98                	cltq
+  80044f:	48 83 ec 08          	sub    $0x8,%rsp
+  800453:	51                   	push   %rcx
+  800454:	49 89 f9             	mov    %rdi,%r9
+  800457:	49 89 f0             	mov    %rsi,%r8
+  80045a:	48 89 d1             	mov    %rdx,%rcx
+  80045d:	48 89 c2             	mov    %rax,%rdx
+  800460:	be 01 00 00 00       	mov    $0x1,%esi
+  800465:	bf 07 00 00 00       	mov    $0x7,%edi
+  80046a:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800471:	00 00 00 
+  800474:	ff d0                	call   *%rax
+  800476:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+000000000080047c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80047c:	55                   	push   %rbp
+  80047d:	48 89 e5             	mov    %rsp,%rbp
+  800480:	48 83 ec 10          	sub    $0x10,%rsp
+  800484:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800487:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80048b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80048f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800492:	48 98                	cltq
+  800494:	48 83 ec 08          	sub    $0x8,%rsp
+  800498:	6a 00                	push   $0x0
+  80049a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004a6:	48 89 d1             	mov    %rdx,%rcx
+  8004a9:	48 89 c2             	mov    %rax,%rdx
+  8004ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8004b1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004b6:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+  8004c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004c6:	c9                   	leave
+  8004c7:	c3                   	ret
+
+00000000008004c8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8004d0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004d3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004d6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004d9:	48 63 d0             	movslq %eax,%rdx
+  8004dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004df:	48 98                	cltq
+  8004e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e5:	6a 00                	push   $0x0
+  8004e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004f3:	48 89 d1             	mov    %rdx,%rcx
+  8004f6:	48 89 c2             	mov    %rax,%rdx
+  8004f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8004fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800503:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80050a:	00 00 00 
+  80050d:	ff d0                	call   *%rax
+  80050f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800513:	c9                   	leave
+  800514:	c3                   	ret
+
+0000000000800515 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800515:	55                   	push   %rbp
+  800516:	48 89 e5             	mov    %rsp,%rbp
+  800519:	48 83 ec 10          	sub    $0x10,%rsp
+  80051d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800520:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800524:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800528:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80052b:	48 98                	cltq
+  80052d:	48 83 ec 08          	sub    $0x8,%rsp
+  800531:	6a 00                	push   $0x0
+  800533:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053f:	48 89 d1             	mov    %rdx,%rcx
+  800542:	48 89 c2             	mov    %rax,%rdx
+  800545:	be 01 00 00 00       	mov    $0x1,%esi
+  80054a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80054f:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800556:	00 00 00 
+  800559:	ff d0                	call   *%rax
+  80055b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80055f:	c9                   	leave
+  800560:	c3                   	ret
+
+0000000000800561 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800561:	55                   	push   %rbp
+  800562:	48 89 e5             	mov    %rsp,%rbp
+  800565:	48 83 ec 10          	sub    $0x10,%rsp
+  800569:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80056c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800570:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800574:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800577:	48 98                	cltq
+  800579:	48 83 ec 08          	sub    $0x8,%rsp
+  80057d:	6a 00                	push   $0x0
+  80057f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800585:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80058b:	48 89 d1             	mov    %rdx,%rcx
+  80058e:	48 89 c2             	mov    %rax,%rdx
+  800591:	be 01 00 00 00       	mov    $0x1,%esi
+  800596:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80059b:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8005a2:	00 00 00 
+  8005a5:	ff d0                	call   *%rax
+  8005a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+
+00000000008005ad <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005ad:	55                   	push   %rbp
+  8005ae:	48 89 e5             	mov    %rsp,%rbp
+  8005b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8005b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005c0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005c6:	48 63 f0             	movslq %eax,%rsi
+  8005c9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005d4:	48 98                	cltq
+  8005d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8005da:	6a 00                	push   $0x0
+  8005dc:	49 89 f1             	mov    %rsi,%r9
+  8005df:	49 89 c8             	mov    %rcx,%r8
+  8005e2:	48 89 d1             	mov    %rdx,%rcx
+  8005e5:	48 89 c2             	mov    %rax,%rdx
+  8005e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ed:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005f2:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8005f9:	00 00 00 
+  8005fc:	ff d0                	call   *%rax
+  8005fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800602:	c9                   	leave
+  800603:	c3                   	ret
+
+0000000000800604 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800604:	55                   	push   %rbp
+  800605:	48 89 e5             	mov    %rsp,%rbp
+  800608:	48 83 ec 10          	sub    $0x10,%rsp
+  80060c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  800610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800614:	48 83 ec 08          	sub    $0x8,%rsp
+  800618:	6a 00                	push   $0x0
+  80061a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062b:	48 89 c2             	mov    %rax,%rdx
+  80062e:	be 01 00 00 00       	mov    $0x1,%esi
+  800633:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800638:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80063f:	00 00 00 
+  800642:	ff d0                	call   *%rax
+  800644:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800648:	c9                   	leave
+  800649:	c3                   	ret
+
+000000000080064a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80064a:	55                   	push   %rbp
+  80064b:	48 89 e5             	mov    %rsp,%rbp
+  80064e:	48 83 ec 10          	sub    $0x10,%rsp
+  800652:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800656:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80065a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80065e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800662:	48 83 ec 08          	sub    $0x8,%rsp
+  800666:	6a 00                	push   $0x0
+  800668:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80066e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800674:	48 89 d1             	mov    %rdx,%rcx
+  800677:	48 89 c2             	mov    %rax,%rdx
+  80067a:	be 01 00 00 00       	mov    $0x1,%esi
+  80067f:	bf 10 00 00 00       	mov    $0x10,%edi
+  800684:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  80068b:	00 00 00 
+  80068e:	ff d0                	call   *%rax
+  800690:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800694:	c9                   	leave
+  800695:	c3                   	ret
+
+0000000000800696 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800696:	55                   	push   %rbp
+  800697:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80069a:	48 83 ec 08          	sub    $0x8,%rsp
+  80069e:	6a 00                	push   $0x0
+  8006a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006bb:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006c0:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8006c7:	00 00 00 
+  8006ca:	ff d0                	call   *%rax
+  8006cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006d0:	c9                   	leave
+  8006d1:	c3                   	ret
+
+00000000008006d2 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006d2:	55                   	push   %rbp
+  8006d3:	48 89 e5             	mov    %rsp,%rbp
+  8006d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8006da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006e2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ee:	6a 00                	push   $0x0
+  8006f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006fc:	48 89 d1             	mov    %rdx,%rcx
+  8006ff:	48 89 c2             	mov    %rax,%rdx
+  800702:	be 00 00 00 00       	mov    $0x0,%esi
+  800707:	bf 12 00 00 00       	mov    $0x12,%edi
+  80070c:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800713:	00 00 00 
+  800716:	ff d0                	call   *%rax
+  800718:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80071c:	c9                   	leave
+  80071d:	c3                   	ret
+
+000000000080071e <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80071e:	55                   	push   %rbp
+  80071f:	48 89 e5             	mov    %rsp,%rbp
+  800722:	48 83 ec 20          	sub    $0x20,%rsp
+  800726:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80072a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80072e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800731:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800734:	48 63 c8             	movslq %eax,%rcx
+  800737:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80073b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80073f:	48 83 ec 08          	sub    $0x8,%rsp
+  800743:	6a 00                	push   $0x0
+  800745:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80074b:	49 89 c8             	mov    %rcx,%r8
+  80074e:	48 89 d1             	mov    %rdx,%rcx
+  800751:	48 89 c2             	mov    %rax,%rdx
+  800754:	be 00 00 00 00       	mov    $0x0,%esi
+  800759:	bf 13 00 00 00       	mov    $0x13,%edi
+  80075e:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800765:	00 00 00 
+  800768:	ff d0                	call   *%rax
+  80076a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80076e:	c9                   	leave
+  80076f:	c3                   	ret
+
+0000000000800770 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800770:	55                   	push   %rbp
+  800771:	48 89 e5             	mov    %rsp,%rbp
+  800774:	48 83 ec 20          	sub    $0x20,%rsp
+  800778:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80077c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80077f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  800783:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800787:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80078a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078e:	48 83 ec 08          	sub    $0x8,%rsp
+  800792:	6a 00                	push   $0x0
+  800794:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80079a:	49 89 c8             	mov    %rcx,%r8
+  80079d:	48 89 d1             	mov    %rdx,%rcx
+  8007a0:	48 89 c2             	mov    %rax,%rdx
+  8007a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a8:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007ad:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8007b4:	00 00 00 
+  8007b7:	ff d0                	call   *%rax
+  8007b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007bd:	c9                   	leave
+  8007be:	c3                   	ret
+
+00000000008007bf <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007bf:	55                   	push   %rbp
+  8007c0:	48 89 e5             	mov    %rsp,%rbp
+  8007c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8007c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007cb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007d1:	48 63 d0             	movslq %eax,%rdx
+  8007d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8007dc:	6a 00                	push   $0x0
+  8007de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007ea:	48 89 d1             	mov    %rdx,%rcx
+  8007ed:	48 89 c2             	mov    %rax,%rdx
+  8007f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f5:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007fa:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800801:	00 00 00 
+  800804:	ff d0                	call   *%rax
+  800806:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80080a:	c9                   	leave
+  80080b:	c3                   	ret
+
+000000000080080c <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80080c:	55                   	push   %rbp
+  80080d:	48 89 e5             	mov    %rsp,%rbp
+  800810:	48 83 ec 20          	sub    $0x20,%rsp
+  800814:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800818:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80081b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80081e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  800822:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800826:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800829:	48 63 c8             	movslq %eax,%rcx
+  80082c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80082f:	48 63 d0             	movslq %eax,%rdx
+  800832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800836:	48 83 ec 08          	sub    $0x8,%rsp
+  80083a:	6a 00                	push   $0x0
+  80083c:	49 89 f1             	mov    %rsi,%r9
+  80083f:	49 89 c8             	mov    %rcx,%r8
+  800842:	48 89 d1             	mov    %rdx,%rcx
+  800845:	48 89 c2             	mov    %rax,%rdx
+  800848:	be 00 00 00 00       	mov    $0x0,%esi
+  80084d:	bf 16 00 00 00       	mov    $0x16,%edi
+  800852:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800859:	00 00 00 
+  80085c:	ff d0                	call   *%rax
+  80085e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800862:	c9                   	leave
+  800863:	c3                   	ret
+
+0000000000800864 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800864:	55                   	push   %rbp
+  800865:	48 89 e5             	mov    %rsp,%rbp
+  800868:	48 83 ec 30          	sub    $0x30,%rsp
+  80086c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800870:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800874:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800878:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80087c:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800880:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800884:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800888:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80088c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800890:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800894:	48 83 ec 08          	sub    $0x8,%rsp
+  800898:	51                   	push   %rcx
+  800899:	49 89 f9             	mov    %rdi,%r9
+  80089c:	49 89 f0             	mov    %rsi,%r8
+  80089f:	48 89 d1             	mov    %rdx,%rcx
+  8008a2:	48 89 c2             	mov    %rax,%rdx
+  8008a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8008aa:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008af:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8008b6:	00 00 00 
+  8008b9:	ff d0                	call   *%rax
+  8008bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008bf:	c9                   	leave
+  8008c0:	c3                   	ret
+
+00000000008008c1 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008c1:	55                   	push   %rbp
+  8008c2:	48 89 e5             	mov    %rsp,%rbp
+  8008c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8008c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008cf:	48 98                	cltq
+  8008d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8008d5:	6a 00                	push   $0x0
+  8008d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e8:	48 89 c2             	mov    %rax,%rdx
+  8008eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f0:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008f5:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8008fc:	00 00 00 
+  8008ff:	ff d0                	call   *%rax
+  800901:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800905:	90                   	nop
+  800906:	c9                   	leave
+  800907:	c3                   	ret
+
+0000000000800908 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800908:	55                   	push   %rbp
+  800909:	48 89 e5             	mov    %rsp,%rbp
+  80090c:	48 83 ec 30          	sub    $0x30,%rsp
+  800910:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800913:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800917:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80091b:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80091e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800921:	48 63 f0             	movslq %eax,%rsi
+  800924:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800928:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80092c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80092f:	48 98                	cltq
+  800931:	48 83 ec 08          	sub    $0x8,%rsp
+  800935:	6a 00                	push   $0x0
+  800937:	49 89 f1             	mov    %rsi,%r9
+  80093a:	49 89 c8             	mov    %rcx,%r8
+  80093d:	48 89 d1             	mov    %rdx,%rcx
+  800940:	48 89 c2             	mov    %rax,%rdx
+  800943:	be 01 00 00 00       	mov    $0x1,%esi
+  800948:	bf 19 00 00 00       	mov    $0x19,%edi
+  80094d:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800954:	00 00 00 
+  800957:	ff d0                	call   *%rax
+  800959:	48 83 c4 10          	add    $0x10,%rsp
+  80095d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800960:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800963:	c9                   	leave
+  800964:	c3                   	ret
+
+0000000000800965 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  800965:	55                   	push   %rbp
+  800966:	48 89 e5             	mov    %rsp,%rbp
+  800969:	48 83 ec 20          	sub    $0x20,%rsp
+  80096d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800971:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800975:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800978:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80097b:	48 63 c8             	movslq %eax,%rcx
+  80097e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800986:	48 83 ec 08          	sub    $0x8,%rsp
+  80098a:	6a 00                	push   $0x0
+  80098c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800992:	49 89 c8             	mov    %rcx,%r8
+  800995:	48 89 d1             	mov    %rdx,%rcx
+  800998:	48 89 c2             	mov    %rax,%rdx
+  80099b:	be 01 00 00 00       	mov    $0x1,%esi
+  8009a0:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8009a5:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8009ac:	00 00 00 
+  8009af:	ff d0                	call   *%rax
+  8009b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009b5:	c9                   	leave
+  8009b6:	c3                   	ret
+
+00000000008009b7 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009b7:	55                   	push   %rbp
+  8009b8:	48 89 e5             	mov    %rsp,%rbp
+  8009bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8009bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009c7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8009db:	6a 00                	push   $0x0
+  8009dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009e3:	49 89 c8             	mov    %rcx,%r8
+  8009e6:	48 89 d1             	mov    %rdx,%rcx
+  8009e9:	48 89 c2             	mov    %rax,%rdx
+  8009ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8009f1:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009f6:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  8009fd:	00 00 00 
+  800a00:	ff d0                	call   *%rax
+  800a02:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a06:	c9                   	leave
+  800a07:	c3                   	ret
+
+0000000000800a08 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a08:	55                   	push   %rbp
+  800a09:	48 89 e5             	mov    %rsp,%rbp
+  800a0c:	48 83 ec 30          	sub    $0x30,%rsp
+  800a10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a14:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a18:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a1b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a1f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a26:	48 63 c8             	movslq %eax,%rcx
+  800a29:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a31:	48 83 ec 08          	sub    $0x8,%rsp
+  800a35:	6a 00                	push   $0x0
+  800a37:	49 89 f1             	mov    %rsi,%r9
+  800a3a:	49 89 c8             	mov    %rcx,%r8
+  800a3d:	48 89 d1             	mov    %rdx,%rcx
+  800a40:	48 89 c2             	mov    %rax,%rdx
+  800a43:	be 01 00 00 00       	mov    $0x1,%esi
+  800a48:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a4d:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800a54:	00 00 00 
+  800a57:	ff d0                	call   *%rax
+  800a59:	48 83 c4 10          	add    $0x10,%rsp
+  800a5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+0000000000800a65 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a65:	55                   	push   %rbp
+  800a66:	48 89 e5             	mov    %rsp,%rbp
+  800a69:	48 83 ec 10          	sub    $0x10,%rsp
+  800a6d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a73:	48 98                	cltq
+  800a75:	48 83 ec 08          	sub    $0x8,%rsp
+  800a79:	6a 00                	push   $0x0
+  800a7b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8c:	48 89 c2             	mov    %rax,%rdx
+  800a8f:	be 01 00 00 00       	mov    $0x1,%esi
+  800a94:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a99:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800aa0:	00 00 00 
+  800aa3:	ff d0                	call   *%rax
+  800aa5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  800aab:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  800aae:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  800ab1:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  800ab8:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  800abc:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  800ac1:	48 a1 08 80 80 00 00 	movabs 0x808008,%rax
+  800ac8:	00 00 00 
+	call *%rax
+  800acb:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  800acd:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  800ad2:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  800ad5:	41 5f                	pop    %r15
+	popq %r15
+  800ad7:	41 5f                	pop    %r15
+	popq %r15
+  800ad9:	41 5f                	pop    %r15
+	popq %r14
+  800adb:	41 5e                	pop    %r14
+	popq %r13
+  800add:	41 5d                	pop    %r13
+	popq %r12
+  800adf:	41 5c                	pop    %r12
+	popq %r11
+  800ae1:	41 5b                	pop    %r11
+	popq %r10
+  800ae3:	41 5a                	pop    %r10
+	popq %r9
+  800ae5:	41 59                	pop    %r9
+	popq %r8
+  800ae7:	41 58                	pop    %r8
+	popq %rsi
+  800ae9:	5e                   	pop    %rsi
+	popq %rdi
+  800aea:	5f                   	pop    %rdi
+	popq %rbp
+  800aeb:	5d                   	pop    %rbp
+	popq %rdx
+  800aec:	5a                   	pop    %rdx
+	popq %rcx
+  800aed:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  800aee:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  800af3:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  800af8:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  800afc:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  800aff:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  800b04:	5b                   	pop    %rbx
+	popq %rax
+  800b05:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  800b06:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  800b0a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  800b0b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  800b10:	c3                   	ret
+
+0000000000800b11 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800b11:	55                   	push   %rbp
+  800b12:	48 89 e5             	mov    %rsp,%rbp
+  800b15:	48 83 ec 08          	sub    $0x8,%rsp
+  800b19:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b21:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800b28:	ff ff ff 
+  800b2b:	48 01 d0             	add    %rdx,%rax
+  800b2e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800b32:	c9                   	leave
+  800b33:	c3                   	ret
+
+0000000000800b34 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800b34:	55                   	push   %rbp
+  800b35:	48 89 e5             	mov    %rsp,%rbp
+  800b38:	48 83 ec 08          	sub    $0x8,%rsp
+  800b3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800b40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b44:	48 89 c7             	mov    %rax,%rdi
+  800b47:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+  800b53:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800b59:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+
+0000000000800b5f <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800b5f:	55                   	push   %rbp
+  800b60:	48 89 e5             	mov    %rsp,%rbp
+  800b63:	48 83 ec 18          	sub    $0x18,%rsp
+  800b67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800b6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b72:	e9 ae 00 00 00       	jmp    800c25 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b7a:	c1 e0 0c             	shl    $0xc,%eax
+  800b7d:	48 98                	cltq
+  800b7f:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b84:	48 01 d0             	add    %rdx,%rax
+  800b87:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b8f:	48 c1 e8 27          	shr    $0x27,%rax
+  800b93:	48 89 c2             	mov    %rax,%rdx
+  800b96:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b9d:	01 00 00 
+  800ba0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ba4:	83 e0 01             	and    $0x1,%eax
+  800ba7:	48 85 c0             	test   %rax,%rax
+  800baa:	74 63                	je     800c0f <fd_alloc+0xb0>
+  800bac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800bb4:	48 89 c2             	mov    %rax,%rdx
+  800bb7:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800bbe:	01 00 00 
+  800bc1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bc5:	83 e0 01             	and    $0x1,%eax
+  800bc8:	48 85 c0             	test   %rax,%rax
+  800bcb:	74 42                	je     800c0f <fd_alloc+0xb0>
+  800bcd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bd1:	48 c1 e8 15          	shr    $0x15,%rax
+  800bd5:	48 89 c2             	mov    %rax,%rdx
+  800bd8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800bdf:	01 00 00 
+  800be2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800be6:	83 e0 01             	and    $0x1,%eax
+  800be9:	48 85 c0             	test   %rax,%rax
+  800bec:	74 21                	je     800c0f <fd_alloc+0xb0>
+  800bee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bf2:	48 c1 e8 0c          	shr    $0xc,%rax
+  800bf6:	48 89 c2             	mov    %rax,%rdx
+  800bf9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c00:	01 00 00 
+  800c03:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c07:	83 e0 01             	and    $0x1,%eax
+  800c0a:	48 85 c0             	test   %rax,%rax
+  800c0d:	75 12                	jne    800c21 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800c0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c13:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c17:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	eb 1e                	jmp    800c3f <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800c21:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800c25:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800c29:	0f 8e 48 ff ff ff    	jle    800b77 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800c2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c33:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800c3a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800c3f:	c9                   	leave
+  800c40:	c3                   	ret
+
+0000000000800c41 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800c41:	55                   	push   %rbp
+  800c42:	48 89 e5             	mov    %rsp,%rbp
+  800c45:	48 83 ec 20          	sub    $0x20,%rsp
+  800c49:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800c4c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800c50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800c54:	78 06                	js     800c5c <fd_lookup+0x1b>
+  800c56:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800c5a:	7e 0a                	jle    800c66 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c61:	e9 af 00 00 00       	jmp    800d15 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800c66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c69:	c1 e0 0c             	shl    $0xc,%eax
+  800c6c:	48 98                	cltq
+  800c6e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c73:	48 01 d0             	add    %rdx,%rax
+  800c76:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c7e:	48 c1 e8 27          	shr    $0x27,%rax
+  800c82:	48 89 c2             	mov    %rax,%rdx
+  800c85:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c8c:	01 00 00 
+  800c8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c93:	83 e0 01             	and    $0x1,%eax
+  800c96:	48 85 c0             	test   %rax,%rax
+  800c99:	74 63                	je     800cfe <fd_lookup+0xbd>
+  800c9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c9f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800ca3:	48 89 c2             	mov    %rax,%rdx
+  800ca6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800cad:	01 00 00 
+  800cb0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cb4:	83 e0 01             	and    $0x1,%eax
+  800cb7:	48 85 c0             	test   %rax,%rax
+  800cba:	74 42                	je     800cfe <fd_lookup+0xbd>
+  800cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cc0:	48 c1 e8 15          	shr    $0x15,%rax
+  800cc4:	48 89 c2             	mov    %rax,%rdx
+  800cc7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800cce:	01 00 00 
+  800cd1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cd5:	83 e0 01             	and    $0x1,%eax
+  800cd8:	48 85 c0             	test   %rax,%rax
+  800cdb:	74 21                	je     800cfe <fd_lookup+0xbd>
+  800cdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ce1:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ce5:	48 89 c2             	mov    %rax,%rdx
+  800ce8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800cef:	01 00 00 
+  800cf2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cf6:	83 e0 01             	and    $0x1,%eax
+  800cf9:	48 85 c0             	test   %rax,%rax
+  800cfc:	75 07                	jne    800d05 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800cfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d03:	eb 10                	jmp    800d15 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800d05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d0d:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d15:	c9                   	leave
+  800d16:	c3                   	ret
+
+0000000000800d17 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800d17:	55                   	push   %rbp
+  800d18:	48 89 e5             	mov    %rsp,%rbp
+  800d1b:	48 83 ec 30          	sub    $0x30,%rsp
+  800d1f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d23:	89 f0                	mov    %esi,%eax
+  800d25:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800d28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d2c:	48 89 c7             	mov    %rax,%rdi
+  800d2f:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  800d36:	00 00 00 
+  800d39:	ff d0                	call   *%rax
+  800d3b:	89 c2                	mov    %eax,%edx
+  800d3d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800d41:	48 89 c6             	mov    %rax,%rsi
+  800d44:	89 d7                	mov    %edx,%edi
+  800d46:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  800d4d:	00 00 00 
+  800d50:	ff d0                	call   *%rax
+  800d52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d59:	78 0a                	js     800d65 <fd_close+0x4e>
+  800d5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d5f:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800d63:	74 12                	je     800d77 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800d65:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800d69:	74 05                	je     800d70 <fd_close+0x59>
+  800d6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d6e:	eb 70                	jmp    800de0 <fd_close+0xc9>
+  800d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d75:	eb 69                	jmp    800de0 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d7b:	8b 00                	mov    (%rax),%eax
+  800d7d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d81:	48 89 d6             	mov    %rdx,%rsi
+  800d84:	89 c7                	mov    %eax,%edi
+  800d86:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  800d8d:	00 00 00 
+  800d90:	ff d0                	call   *%rax
+  800d92:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d99:	78 2a                	js     800dc5 <fd_close+0xae>
+    if (dev->dev_close)
+  800d9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d9f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800da3:	48 85 c0             	test   %rax,%rax
+  800da6:	74 16                	je     800dbe <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800da8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dac:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800db0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800db4:	48 89 c7             	mov    %rax,%rdi
+  800db7:	ff d2                	call   *%rdx
+  800db9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800dbc:	eb 07                	jmp    800dc5 <fd_close+0xae>
+    else
+      r = 0;
+  800dbe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800dc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dc9:	48 89 c6             	mov    %rax,%rsi
+  800dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd1:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800dd8:	00 00 00 
+  800ddb:	ff d0                	call   *%rax
+  return r;
+  800ddd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800de0:	c9                   	leave
+  800de1:	c3                   	ret
+
+0000000000800de2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800de2:	55                   	push   %rbp
+  800de3:	48 89 e5             	mov    %rsp,%rbp
+  800de6:	48 83 ec 20          	sub    $0x20,%rsp
+  800dea:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800ded:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800df1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800df8:	eb 3f                	jmp    800e39 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800dfa:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e01:	00 00 00 
+  800e04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e07:	48 98                	cltq
+  800e09:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e0d:	8b 00                	mov    (%rax),%eax
+  800e0f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800e12:	75 21                	jne    800e35 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800e14:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e1b:	00 00 00 
+  800e1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e21:	48 98                	cltq
+  800e23:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800e27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e2b:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e33:	eb 7f                	jmp    800eb4 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800e35:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e39:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e40:	00 00 00 
+  800e43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e46:	48 98                	cltq
+  800e48:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e4c:	48 85 c0             	test   %rax,%rax
+  800e4f:	75 a9                	jne    800dfa <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e51:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800e58:	00 00 00 
+  800e5b:	8b 40 04             	mov    0x4(%rax),%eax
+  800e5e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e63:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800e6a:	00 00 00 
+  800e6d:	48 98                	cltq
+  800e6f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e76:	48 01 d0             	add    %rdx,%rax
+  800e79:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e7f:	8b 00                	mov    (%rax),%eax
+  800e81:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e84:	89 c6                	mov    %eax,%esi
+  800e86:	48 b8 80 51 80 00 00 	movabs $0x805180,%rax
+  800e8d:	00 00 00 
+  800e90:	48 89 c7             	mov    %rax,%rdi
+  800e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e98:	48 b9 d9 31 80 00 00 	movabs $0x8031d9,%rcx
+  800e9f:	00 00 00 
+  800ea2:	ff d1                	call   *%rcx
+  *dev = 0;
+  800ea4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ea8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800eaf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800eb4:	c9                   	leave
+  800eb5:	c3                   	ret
+
+0000000000800eb6 <close>:
+
+int
+close(int fdnum) {
+  800eb6:	55                   	push   %rbp
+  800eb7:	48 89 e5             	mov    %rsp,%rbp
+  800eba:	48 83 ec 20          	sub    $0x20,%rsp
+  800ebe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ec1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800ec5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800ec8:	48 89 d6             	mov    %rdx,%rsi
+  800ecb:	89 c7                	mov    %eax,%edi
+  800ecd:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+  800ed9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800edc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ee0:	79 05                	jns    800ee7 <close+0x31>
+    return r;
+  800ee2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ee5:	eb 18                	jmp    800eff <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800ee7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eeb:	be 01 00 00 00       	mov    $0x1,%esi
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	48 b8 17 0d 80 00 00 	movabs $0x800d17,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+}
+  800eff:	c9                   	leave
+  800f00:	c3                   	ret
+
+0000000000800f01 <close_all>:
+
+void
+close_all(void) {
+  800f01:	55                   	push   %rbp
+  800f02:	48 89 e5             	mov    %rsp,%rbp
+  800f05:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800f09:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800f10:	eb 15                	jmp    800f27 <close_all+0x26>
+    close(i);
+  800f12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f15:	89 c7                	mov    %eax,%edi
+  800f17:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800f23:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800f27:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800f2b:	7e e5                	jle    800f12 <close_all+0x11>
+}
+  800f2d:	90                   	nop
+  800f2e:	90                   	nop
+  800f2f:	c9                   	leave
+  800f30:	c3                   	ret
+
+0000000000800f31 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800f31:	55                   	push   %rbp
+  800f32:	48 89 e5             	mov    %rsp,%rbp
+  800f35:	48 83 ec 40          	sub    $0x40,%rsp
+  800f39:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800f3c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800f3f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800f43:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800f46:	48 89 d6             	mov    %rdx,%rsi
+  800f49:	89 c7                	mov    %eax,%edi
+  800f4b:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  800f52:	00 00 00 
+  800f55:	ff d0                	call   *%rax
+  800f57:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f5a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800f5e:	79 08                	jns    800f68 <dup+0x37>
+    return r;
+  800f60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f63:	e9 33 02 00 00       	jmp    80119b <dup+0x26a>
+  close(newfdnum);
+  800f68:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f6b:	89 c7                	mov    %eax,%edi
+  800f6d:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f79:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f7c:	c1 e0 0c             	shl    $0xc,%eax
+  800f7f:	48 98                	cltq
+  800f81:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f86:	48 01 d0             	add    %rdx,%rax
+  800f89:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f91:	48 89 c7             	mov    %rax,%rdi
+  800f94:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  800f9b:	00 00 00 
+  800f9e:	ff d0                	call   *%rax
+  800fa0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800fa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fa8:	48 89 c7             	mov    %rax,%rdi
+  800fab:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  800fb2:	00 00 00 
+  800fb5:	ff d0                	call   *%rax
+  800fb7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800fbb:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800fc2:	00 
+  800fc3:	e9 19 01 00 00       	jmp    8010e1 <dup+0x1b0>
+    off -= PGSIZE;
+  800fc8:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800fcf:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fd0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd8:	48 01 d0             	add    %rdx,%rax
+  800fdb:	48 c1 e8 27          	shr    $0x27,%rax
+  800fdf:	48 89 c2             	mov    %rax,%rdx
+  800fe2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800fe9:	01 00 00 
+  800fec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ff0:	83 e0 01             	and    $0x1,%eax
+  800ff3:	48 85 c0             	test   %rax,%rax
+  800ff6:	0f 84 e5 00 00 00    	je     8010e1 <dup+0x1b0>
+  800ffc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801000:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801004:	48 01 d0             	add    %rdx,%rax
+  801007:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80100b:	48 89 c2             	mov    %rax,%rdx
+  80100e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  801015:	01 00 00 
+  801018:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80101c:	83 e0 01             	and    $0x1,%eax
+  80101f:	48 85 c0             	test   %rax,%rax
+  801022:	0f 84 b9 00 00 00    	je     8010e1 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801028:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80102c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801030:	48 01 d0             	add    %rdx,%rax
+  801033:	48 c1 e8 15          	shr    $0x15,%rax
+  801037:	48 89 c2             	mov    %rax,%rdx
+  80103a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  801041:	01 00 00 
+  801044:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801048:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80104b:	48 85 c0             	test   %rax,%rax
+  80104e:	0f 84 8d 00 00 00    	je     8010e1 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801054:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801058:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80105c:	48 01 d0             	add    %rdx,%rax
+  80105f:	48 c1 e8 0c          	shr    $0xc,%rax
+  801063:	48 89 c2             	mov    %rax,%rdx
+  801066:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80106d:	01 00 00 
+  801070:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801074:	83 e0 01             	and    $0x1,%eax
+  801077:	48 85 c0             	test   %rax,%rax
+  80107a:	74 65                	je     8010e1 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80107c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801080:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801084:	48 01 d0             	add    %rdx,%rax
+  801087:	48 c1 e8 0c          	shr    $0xc,%rax
+  80108b:	48 89 c2             	mov    %rax,%rdx
+  80108e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801095:	01 00 00 
+  801098:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80109c:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010a1:	89 c6                	mov    %eax,%esi
+  8010a3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010ab:	48 01 c2             	add    %rax,%rdx
+  8010ae:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8010b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010b6:	48 01 c8             	add    %rcx,%rax
+  8010b9:	41 89 f0             	mov    %esi,%r8d
+  8010bc:	48 89 d1             	mov    %rdx,%rcx
+  8010bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c4:	48 89 c6             	mov    %rax,%rsi
+  8010c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010cc:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+  8010d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010df:	78 60                	js     801141 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8010e1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8010e6:	0f 85 dc fe ff ff    	jne    800fc8 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010f0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8010f4:	48 89 c2             	mov    %rax,%rdx
+  8010f7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8010fe:	01 00 00 
+  801101:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801105:	25 07 0e 00 00       	and    $0xe07,%eax
+  80110a:	89 c1                	mov    %eax,%ecx
+  80110c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801110:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801114:	41 89 c8             	mov    %ecx,%r8d
+  801117:	48 89 d1             	mov    %rdx,%rcx
+  80111a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111f:	48 89 c6             	mov    %rax,%rsi
+  801122:	bf 00 00 00 00       	mov    $0x0,%edi
+  801127:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+  801133:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801136:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80113a:	78 08                	js     801144 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80113c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80113f:	eb 5a                	jmp    80119b <dup+0x26a>
+        goto err;
+  801141:	90                   	nop
+  801142:	eb 01                	jmp    801145 <dup+0x214>
+    goto err;
+  801144:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  801145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801149:	48 89 c6             	mov    %rax,%rsi
+  80114c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801151:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  801158:	00 00 00 
+  80115b:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80115d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801164:	00 
+  801165:	eb 27                	jmp    80118e <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  801167:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80116b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116f:	48 01 d0             	add    %rdx,%rax
+  801172:	48 89 c6             	mov    %rax,%rsi
+  801175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117a:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801186:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80118d:	00 
+  80118e:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801195:	00 
+  801196:	76 cf                	jbe    801167 <dup+0x236>
+  return r;
+  801198:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80119b:	c9                   	leave
+  80119c:	c3                   	ret
+
+000000000080119d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	48 83 ec 40          	sub    $0x40,%rsp
+  8011a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8011a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8011ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8011b0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8011b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011b7:	48 89 d6             	mov    %rdx,%rsi
+  8011ba:	89 c7                	mov    %eax,%edi
+  8011bc:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  8011c3:	00 00 00 
+  8011c6:	ff d0                	call   *%rax
+  8011c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011cf:	78 24                	js     8011f5 <read+0x58>
+  8011d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011d5:	8b 00                	mov    (%rax),%eax
+  8011d7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8011db:	48 89 d6             	mov    %rdx,%rsi
+  8011de:	89 c7                	mov    %eax,%edi
+  8011e0:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  8011e7:	00 00 00 
+  8011ea:	ff d0                	call   *%rax
+  8011ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011f3:	79 0a                	jns    8011ff <read+0x62>
+    return r;
+  8011f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011f8:	48 98                	cltq
+  8011fa:	e9 9e 00 00 00       	jmp    80129d <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801203:	8b 40 08             	mov    0x8(%rax),%eax
+  801206:	83 e0 03             	and    $0x3,%eax
+  801209:	83 f8 01             	cmp    $0x1,%eax
+  80120c:	75 5c                	jne    80126a <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80120e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801215:	00 00 00 
+  801218:	8b 40 04             	mov    0x4(%rax),%eax
+  80121b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801220:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801227:	00 00 00 
+  80122a:	48 98                	cltq
+  80122c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801233:	48 01 d0             	add    %rdx,%rax
+  801236:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80123c:	8b 00                	mov    (%rax),%eax
+  80123e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801241:	89 c6                	mov    %eax,%esi
+  801243:	48 b8 9f 51 80 00 00 	movabs $0x80519f,%rax
+  80124a:	00 00 00 
+  80124d:	48 89 c7             	mov    %rax,%rdi
+  801250:	b8 00 00 00 00       	mov    $0x0,%eax
+  801255:	48 b9 d9 31 80 00 00 	movabs $0x8031d9,%rcx
+  80125c:	00 00 00 
+  80125f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801261:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801268:	eb 33                	jmp    80129d <read+0x100>
+  }
+  if (!dev->dev_read)
+  80126a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80126e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801272:	48 85 c0             	test   %rax,%rax
+  801275:	75 09                	jne    801280 <read+0xe3>
+    return -E_NOT_SUPP;
+  801277:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80127e:	eb 1d                	jmp    80129d <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801280:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801284:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801290:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801294:	48 89 ce             	mov    %rcx,%rsi
+  801297:	48 89 c7             	mov    %rax,%rdi
+  80129a:	41 ff d0             	call   *%r8
+}
+  80129d:	c9                   	leave
+  80129e:	c3                   	ret
+
+000000000080129f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80129f:	55                   	push   %rbp
+  8012a0:	48 89 e5             	mov    %rsp,%rbp
+  8012a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8012a7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8012aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012ae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8012b2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8012b9:	eb 49                	jmp    801304 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8012bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012be:	48 98                	cltq
+  8012c0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012c4:	48 29 c2             	sub    %rax,%rdx
+  8012c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ca:	48 63 c8             	movslq %eax,%rcx
+  8012cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012d1:	48 01 c1             	add    %rax,%rcx
+  8012d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012d7:	48 89 ce             	mov    %rcx,%rsi
+  8012da:	89 c7                	mov    %eax,%edi
+  8012dc:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  8012e3:	00 00 00 
+  8012e6:	ff d0                	call   *%rax
+  8012e8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8012eb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012ef:	79 07                	jns    8012f8 <readn+0x59>
+      return m;
+  8012f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012f4:	48 98                	cltq
+  8012f6:	eb 1f                	jmp    801317 <readn+0x78>
+    if (m == 0)
+  8012f8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012fc:	74 13                	je     801311 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8012fe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801301:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801304:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801307:	48 98                	cltq
+  801309:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80130d:	72 ac                	jb     8012bb <readn+0x1c>
+  80130f:	eb 01                	jmp    801312 <readn+0x73>
+      break;
+  801311:	90                   	nop
+  }
+  return tot;
+  801312:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801315:	48 98                	cltq
+}
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+
+0000000000801319 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801319:	55                   	push   %rbp
+  80131a:	48 89 e5             	mov    %rsp,%rbp
+  80131d:	48 83 ec 40          	sub    $0x40,%rsp
+  801321:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801324:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801328:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80132c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801330:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801333:	48 89 d6             	mov    %rdx,%rsi
+  801336:	89 c7                	mov    %eax,%edi
+  801338:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  80133f:	00 00 00 
+  801342:	ff d0                	call   *%rax
+  801344:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801347:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80134b:	78 24                	js     801371 <write+0x58>
+  80134d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801351:	8b 00                	mov    (%rax),%eax
+  801353:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801357:	48 89 d6             	mov    %rdx,%rsi
+  80135a:	89 c7                	mov    %eax,%edi
+  80135c:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  801363:	00 00 00 
+  801366:	ff d0                	call   *%rax
+  801368:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80136b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80136f:	79 0a                	jns    80137b <write+0x62>
+    return r;
+  801371:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801374:	48 98                	cltq
+  801376:	e9 9d 00 00 00       	jmp    801418 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80137b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137f:	8b 40 08             	mov    0x8(%rax),%eax
+  801382:	83 e0 03             	and    $0x3,%eax
+  801385:	85 c0                	test   %eax,%eax
+  801387:	75 5c                	jne    8013e5 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801389:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801390:	00 00 00 
+  801393:	8b 40 04             	mov    0x4(%rax),%eax
+  801396:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80139b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8013a2:	00 00 00 
+  8013a5:	48 98                	cltq
+  8013a7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8013ae:	48 01 d0             	add    %rdx,%rax
+  8013b1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8013b7:	8b 00                	mov    (%rax),%eax
+  8013b9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8013bc:	89 c6                	mov    %eax,%esi
+  8013be:	48 b8 bb 51 80 00 00 	movabs $0x8051bb,%rax
+  8013c5:	00 00 00 
+  8013c8:	48 89 c7             	mov    %rax,%rdi
+  8013cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d0:	48 b9 d9 31 80 00 00 	movabs $0x8031d9,%rcx
+  8013d7:	00 00 00 
+  8013da:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8013dc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8013e3:	eb 33                	jmp    801418 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8013e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8013ed:	48 85 c0             	test   %rax,%rax
+  8013f0:	75 09                	jne    8013fb <write+0xe2>
+    return -E_NOT_SUPP;
+  8013f2:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8013f9:	eb 1d                	jmp    801418 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8013fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ff:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801403:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801407:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80140b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80140f:	48 89 ce             	mov    %rcx,%rsi
+  801412:	48 89 c7             	mov    %rax,%rdi
+  801415:	41 ff d0             	call   *%r8
+}
+  801418:	c9                   	leave
+  801419:	c3                   	ret
+
+000000000080141a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+  80141e:	48 83 ec 18          	sub    $0x18,%rsp
+  801422:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801425:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801428:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80142c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80142f:	48 89 d6             	mov    %rdx,%rsi
+  801432:	89 c7                	mov    %eax,%edi
+  801434:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  80143b:	00 00 00 
+  80143e:	ff d0                	call   *%rax
+  801440:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801443:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801447:	79 05                	jns    80144e <seek+0x34>
+    return r;
+  801449:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80144c:	eb 0f                	jmp    80145d <seek+0x43>
+  fd->fd_offset = offset;
+  80144e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801452:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801455:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80145d:	c9                   	leave
+  80145e:	c3                   	ret
+
+000000000080145f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	48 83 ec 30          	sub    $0x30,%rsp
+  801467:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80146a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80146d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801471:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801474:	48 89 d6             	mov    %rdx,%rsi
+  801477:	89 c7                	mov    %eax,%edi
+  801479:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  801480:	00 00 00 
+  801483:	ff d0                	call   *%rax
+  801485:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801488:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80148c:	78 24                	js     8014b2 <ftruncate+0x53>
+  80148e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801492:	8b 00                	mov    (%rax),%eax
+  801494:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801498:	48 89 d6             	mov    %rdx,%rsi
+  80149b:	89 c7                	mov    %eax,%edi
+  80149d:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  8014a4:	00 00 00 
+  8014a7:	ff d0                	call   *%rax
+  8014a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014b0:	79 08                	jns    8014ba <ftruncate+0x5b>
+    return r;
+  8014b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8014b5:	e9 92 00 00 00       	jmp    80154c <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014be:	8b 40 08             	mov    0x8(%rax),%eax
+  8014c1:	83 e0 03             	and    $0x3,%eax
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	75 5a                	jne    801522 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8014c8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8014cf:	00 00 00 
+  8014d2:	8b 40 04             	mov    0x4(%rax),%eax
+  8014d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014da:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8014e1:	00 00 00 
+  8014e4:	48 98                	cltq
+  8014e6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8014ed:	48 01 d0             	add    %rdx,%rax
+  8014f0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8014f6:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014f8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8014fb:	89 c6                	mov    %eax,%esi
+  8014fd:	48 b8 d8 51 80 00 00 	movabs $0x8051d8,%rax
+  801504:	00 00 00 
+  801507:	48 89 c7             	mov    %rax,%rdi
+  80150a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150f:	48 b9 d9 31 80 00 00 	movabs $0x8031d9,%rcx
+  801516:	00 00 00 
+  801519:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80151b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801520:	eb 2a                	jmp    80154c <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801522:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801526:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80152a:	48 85 c0             	test   %rax,%rax
+  80152d:	75 07                	jne    801536 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80152f:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801534:	eb 16                	jmp    80154c <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  801536:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80153e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801542:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801545:	89 d6                	mov    %edx,%esi
+  801547:	48 89 c7             	mov    %rax,%rdi
+  80154a:	ff d1                	call   *%rcx
+}
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+
+000000000080154e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80154e:	55                   	push   %rbp
+  80154f:	48 89 e5             	mov    %rsp,%rbp
+  801552:	48 83 ec 30          	sub    $0x30,%rsp
+  801556:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801559:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801561:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801564:	48 89 d6             	mov    %rdx,%rsi
+  801567:	89 c7                	mov    %eax,%edi
+  801569:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  801570:	00 00 00 
+  801573:	ff d0                	call   *%rax
+  801575:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801578:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80157c:	78 24                	js     8015a2 <fstat+0x54>
+  80157e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801582:	8b 00                	mov    (%rax),%eax
+  801584:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801588:	48 89 d6             	mov    %rdx,%rsi
+  80158b:	89 c7                	mov    %eax,%edi
+  80158d:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  801594:	00 00 00 
+  801597:	ff d0                	call   *%rax
+  801599:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80159c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015a0:	79 05                	jns    8015a7 <fstat+0x59>
+    return r;
+  8015a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8015a5:	eb 5e                	jmp    801605 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8015a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ab:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8015af:	48 85 c0             	test   %rax,%rax
+  8015b2:	75 07                	jne    8015bb <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8015b4:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8015b9:	eb 4a                	jmp    801605 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8015bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015bf:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8015c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015c6:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8015cd:	00 00 00 
+  stat->st_isdir   = 0;
+  8015d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015d4:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8015db:	00 00 00 
+  stat->st_dev     = dev;
+  8015de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015e6:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8015ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f1:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8015f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8015fd:	48 89 d6             	mov    %rdx,%rsi
+  801600:	48 89 c7             	mov    %rax,%rdi
+  801603:	ff d1                	call   *%rcx
+}
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+
+0000000000801607 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801607:	55                   	push   %rbp
+  801608:	48 89 e5             	mov    %rsp,%rbp
+  80160b:	48 83 ec 10          	sub    $0x10,%rsp
+  80160f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801613:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  801617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80161b:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801621:	83 f8 20             	cmp    $0x20,%eax
+  801624:	75 07                	jne    80162d <pollwait_key+0x26>
+    return -E_INVAL;
+  801626:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162b:	eb 5f                	jmp    80168c <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80162d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801631:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  801637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80163b:	48 63 d2             	movslq %edx,%rdx
+  80163e:	48 c1 e2 04          	shl    $0x4,%rdx
+  801642:	48 01 c2             	add    %rax,%rdx
+  801645:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801649:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80164c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801650:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  801656:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80165a:	8b 00                	mov    (%rax),%eax
+  80165c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801660:	48 63 c9             	movslq %ecx,%rcx
+  801663:	48 c1 e1 04          	shl    $0x4,%rcx
+  801667:	48 01 ca             	add    %rcx,%rdx
+  80166a:	48 83 c2 08          	add    $0x8,%rdx
+  80166e:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801670:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801674:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80167a:	8d 50 01             	lea    0x1(%rax),%edx
+  80167d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801681:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801687:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168c:	c9                   	leave
+  80168d:	c3                   	ret
+
+000000000080168e <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80168e:	55                   	push   %rbp
+  80168f:	48 89 e5             	mov    %rsp,%rbp
+  801692:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801699:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8016a0:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8016a6:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8016ad:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8016b4:	00 
+  int i, r, ready, ipc = 0;
+  8016b5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8016bc:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8016c3:	00 
+  8016c4:	74 45                	je     80170b <poll+0x7d>
+  8016c6:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8016cd:	ff 
+  8016ce:	74 3b                	je     80170b <poll+0x7d>
+    now      = vsys_clock_ns();
+  8016d0:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+  8016dc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8016e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e4:	48 f7 d0             	not    %rax
+  8016e7:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8016ee:	73 10                	jae    801700 <poll+0x72>
+  8016f0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016f4:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8016fb:	48 01 d0             	add    %rdx,%rax
+  8016fe:	eb 07                	jmp    801707 <poll+0x79>
+  801700:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801707:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80170b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801712:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  801719:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801720:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  801727:	e9 46 02 00 00       	jmp    801972 <poll+0x2e4>
+      fds[i].revents = 0;
+  80172c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80172f:	48 63 d0             	movslq %eax,%rdx
+  801732:	48 89 d0             	mov    %rdx,%rax
+  801735:	48 01 c0             	add    %rax,%rax
+  801738:	48 01 d0             	add    %rdx,%rax
+  80173b:	48 c1 e0 02          	shl    $0x2,%rax
+  80173f:	48 89 c2             	mov    %rax,%rdx
+  801742:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801749:	48 01 d0             	add    %rdx,%rax
+  80174c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  801753:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801756:	48 63 d0             	movslq %eax,%rdx
+  801759:	48 89 d0             	mov    %rdx,%rax
+  80175c:	48 01 c0             	add    %rax,%rax
+  80175f:	48 01 d0             	add    %rdx,%rax
+  801762:	48 c1 e0 02          	shl    $0x2,%rax
+  801766:	48 89 c2             	mov    %rax,%rdx
+  801769:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801770:	48 01 d0             	add    %rdx,%rax
+  801773:	8b 00                	mov    (%rax),%eax
+  801775:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  801778:	75 62                	jne    8017dc <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80177a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80177d:	48 63 d0             	movslq %eax,%rdx
+  801780:	48 89 d0             	mov    %rdx,%rax
+  801783:	48 01 c0             	add    %rax,%rax
+  801786:	48 01 d0             	add    %rdx,%rax
+  801789:	48 c1 e0 02          	shl    $0x2,%rax
+  80178d:	48 89 c2             	mov    %rax,%rdx
+  801790:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801797:	48 01 d0             	add    %rdx,%rax
+  80179a:	8b 40 04             	mov    0x4(%rax),%eax
+  80179d:	83 e0 01             	and    $0x1,%eax
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	0f 84 9b 01 00 00    	je     801943 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8017a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017ab:	48 63 d0             	movslq %eax,%rdx
+  8017ae:	48 89 d0             	mov    %rdx,%rax
+  8017b1:	48 01 c0             	add    %rax,%rax
+  8017b4:	48 01 d0             	add    %rdx,%rax
+  8017b7:	48 c1 e0 02          	shl    $0x2,%rax
+  8017bb:	48 89 c2             	mov    %rax,%rdx
+  8017be:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017c5:	48 01 c2             	add    %rax,%rdx
+  8017c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017cb:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8017ce:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8017d1:	83 c8 04             	or     $0x4,%eax
+  8017d4:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8017d7:	e9 67 01 00 00       	jmp    801943 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017df:	48 63 d0             	movslq %eax,%rdx
+  8017e2:	48 89 d0             	mov    %rdx,%rax
+  8017e5:	48 01 c0             	add    %rax,%rax
+  8017e8:	48 01 d0             	add    %rdx,%rax
+  8017eb:	48 c1 e0 02          	shl    $0x2,%rax
+  8017ef:	48 89 c2             	mov    %rax,%rdx
+  8017f2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017f9:	48 01 d0             	add    %rdx,%rax
+  8017fc:	8b 00                	mov    (%rax),%eax
+  8017fe:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801805:	48 89 d6             	mov    %rdx,%rsi
+  801808:	89 c7                	mov    %eax,%edi
+  80180a:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  801811:	00 00 00 
+  801814:	ff d0                	call   *%rax
+  801816:	85 c0                	test   %eax,%eax
+  801818:	78 25                	js     80183f <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80181a:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801821:	8b 00                	mov    (%rax),%eax
+  801823:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80182a:	48 89 d6             	mov    %rdx,%rsi
+  80182d:	89 c7                	mov    %eax,%edi
+  80182f:	48 b8 e2 0d 80 00 00 	movabs $0x800de2,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	79 2c                	jns    80186b <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80183f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801842:	48 63 d0             	movslq %eax,%rdx
+  801845:	48 89 d0             	mov    %rdx,%rax
+  801848:	48 01 c0             	add    %rax,%rax
+  80184b:	48 01 d0             	add    %rdx,%rax
+  80184e:	48 c1 e0 02          	shl    $0x2,%rax
+  801852:	48 89 c2             	mov    %rax,%rdx
+  801855:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80185c:	48 01 d0             	add    %rdx,%rax
+  80185f:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  801866:	e9 d8 00 00 00       	jmp    801943 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80186b:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801872:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801876:	48 85 c0             	test   %rax,%rax
+  801879:	74 7d                	je     8018f8 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80187b:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801882:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801886:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801889:	48 63 d0             	movslq %eax,%rdx
+  80188c:	48 89 d0             	mov    %rdx,%rax
+  80188f:	48 01 c0             	add    %rax,%rax
+  801892:	48 01 d0             	add    %rdx,%rax
+  801895:	48 c1 e0 02          	shl    $0x2,%rax
+  801899:	48 89 c2             	mov    %rax,%rdx
+  80189c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018a3:	48 01 d0             	add    %rdx,%rax
+  8018a6:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018a9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8018b0:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8018b7:	89 ce                	mov    %ecx,%esi
+  8018b9:	48 89 c7             	mov    %rax,%rdi
+  8018bc:	41 ff d0             	call   *%r8
+  8018bf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8018c2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8018c6:	79 08                	jns    8018d0 <poll+0x242>
+          return r;
+  8018c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018cb:	e9 45 01 00 00       	jmp    801a15 <poll+0x387>
+        fds[i].revents = r;
+  8018d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d3:	48 63 d0             	movslq %eax,%rdx
+  8018d6:	48 89 d0             	mov    %rdx,%rax
+  8018d9:	48 01 c0             	add    %rax,%rax
+  8018dc:	48 01 d0             	add    %rdx,%rax
+  8018df:	48 c1 e0 02          	shl    $0x2,%rax
+  8018e3:	48 89 c2             	mov    %rax,%rdx
+  8018e6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018ed:	48 01 c2             	add    %rax,%rdx
+  8018f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018f3:	89 42 08             	mov    %eax,0x8(%rdx)
+  8018f6:	eb 4b                	jmp    801943 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8018f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018fb:	48 63 d0             	movslq %eax,%rdx
+  8018fe:	48 89 d0             	mov    %rdx,%rax
+  801901:	48 01 c0             	add    %rax,%rax
+  801904:	48 01 d0             	add    %rdx,%rax
+  801907:	48 c1 e0 02          	shl    $0x2,%rax
+  80190b:	48 89 c2             	mov    %rax,%rdx
+  80190e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801915:	48 01 d0             	add    %rdx,%rax
+  801918:	8b 48 04             	mov    0x4(%rax),%ecx
+  80191b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80191e:	48 63 d0             	movslq %eax,%rdx
+  801921:	48 89 d0             	mov    %rdx,%rax
+  801924:	48 01 c0             	add    %rax,%rax
+  801927:	48 01 d0             	add    %rdx,%rax
+  80192a:	48 c1 e0 02          	shl    $0x2,%rax
+  80192e:	48 89 c2             	mov    %rax,%rdx
+  801931:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801938:	48 01 d0             	add    %rdx,%rax
+  80193b:	83 e1 03             	and    $0x3,%ecx
+  80193e:	89 ca                	mov    %ecx,%edx
+  801940:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  801943:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801946:	48 63 d0             	movslq %eax,%rdx
+  801949:	48 89 d0             	mov    %rdx,%rax
+  80194c:	48 01 c0             	add    %rax,%rax
+  80194f:	48 01 d0             	add    %rdx,%rax
+  801952:	48 c1 e0 02          	shl    $0x2,%rax
+  801956:	48 89 c2             	mov    %rax,%rdx
+  801959:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801960:	48 01 d0             	add    %rdx,%rax
+  801963:	8b 40 08             	mov    0x8(%rax),%eax
+  801966:	85 c0                	test   %eax,%eax
+  801968:	74 04                	je     80196e <poll+0x2e0>
+        ready++;
+  80196a:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80196e:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801972:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801975:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80197b:	0f 8c ab fd ff ff    	jl     80172c <poll+0x9e>
+    }
+    if (ready)
+  801981:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801985:	74 08                	je     80198f <poll+0x301>
+      return ready;
+  801987:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80198a:	e9 86 00 00 00       	jmp    801a15 <poll+0x387>
+
+    if (deadline) {
+  80198f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801994:	74 30                	je     8019c6 <poll+0x338>
+      now     = vsys_clock_ns();
+  801996:	48 b8 c9 2b 80 00 00 	movabs $0x802bc9,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+  8019a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8019a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019aa:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019ae:	73 0a                	jae    8019ba <poll+0x32c>
+  8019b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b4:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8019b8:	eb 05                	jmp    8019bf <poll+0x331>
+  8019ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bf:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8019c6:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019c9:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8019cc:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8019d3:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8019da:	48 89 c7             	mov    %rax,%rdi
+  8019dd:	48 b8 0c 08 80 00 00 	movabs $0x80080c,%rax
+  8019e4:	00 00 00 
+  8019e7:	ff d0                	call   *%rax
+  8019e9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8019ec:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8019f0:	75 07                	jne    8019f9 <poll+0x36b>
+      return 0;
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f7:	eb 1c                	jmp    801a15 <poll+0x387>
+    if (r < 0)
+  8019f9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8019fd:	79 05                	jns    801a04 <poll+0x376>
+      return r;
+  8019ff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a02:	eb 11                	jmp    801a15 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801a04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a07:	c1 f8 02             	sar    $0x2,%eax
+  801a0a:	83 e0 01             	and    $0x1,%eax
+  801a0d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801a10:	e9 f6 fc ff ff       	jmp    80170b <poll+0x7d>
+  }
+}
+  801a15:	c9                   	leave
+  801a16:	c3                   	ret
+
+0000000000801a17 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	48 83 ec 20          	sub    $0x20,%rsp
+  801a1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  801a27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a30:	48 89 c7             	mov    %rax,%rdi
+  801a33:	48 b8 05 1b 80 00 00 	movabs $0x801b05,%rax
+  801a3a:	00 00 00 
+  801a3d:	ff d0                	call   *%rax
+  801a3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801a42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a46:	79 05                	jns    801a4d <stat+0x36>
+    return fd;
+  801a48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a4b:	eb 2f                	jmp    801a7c <stat+0x65>
+  r = fstat(fd, stat);
+  801a4d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a54:	48 89 d6             	mov    %rdx,%rsi
+  801a57:	89 c7                	mov    %eax,%edi
+  801a59:	48 b8 4e 15 80 00 00 	movabs $0x80154e,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+  801a65:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  801a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a6b:	89 c7                	mov    %eax,%edi
+  801a6d:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  801a74:	00 00 00 
+  801a77:	ff d0                	call   *%rax
+  return r;
+  801a79:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a7c:	c9                   	leave
+  801a7d:	c3                   	ret
+
+0000000000801a7e <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a7e:	55                   	push   %rbp
+  801a7f:	48 89 e5             	mov    %rsp,%rbp
+  801a82:	48 83 ec 10          	sub    $0x10,%rsp
+  801a86:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a89:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a8d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a94:	00 00 00 
+  801a97:	8b 00                	mov    (%rax),%eax
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	75 1d                	jne    801aba <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a9d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801aa2:	48 b8 d1 4f 80 00 00 	movabs $0x804fd1,%rax
+  801aa9:	00 00 00 
+  801aac:	ff d0                	call   *%rax
+  801aae:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801ab5:	00 00 00 
+  801ab8:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801aba:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801ac1:	00 00 00 
+  801ac4:	8b 00                	mov    (%rax),%eax
+  801ac6:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801ac9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ace:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801ad5:	00 00 00 
+  801ad8:	89 c7                	mov    %eax,%edi
+  801ada:	48 b8 24 4f 80 00 00 	movabs $0x804f24,%rax
+  801ae1:	00 00 00 
+  801ae4:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801ae6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aef:	48 89 c6             	mov    %rax,%rsi
+  801af2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801af7:	48 b8 a7 4d 80 00 00 	movabs $0x804da7,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+}
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+
+0000000000801b05 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801b05:	55                   	push   %rbp
+  801b06:	48 89 e5             	mov    %rsp,%rbp
+  801b09:	48 83 ec 20          	sub    $0x20,%rsp
+  801b0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b11:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b18:	48 89 c7             	mov    %rax,%rdi
+  801b1b:	48 b8 88 40 80 00 00 	movabs $0x804088,%rax
+  801b22:	00 00 00 
+  801b25:	ff d0                	call   *%rax
+  801b27:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b2c:	7e 0a                	jle    801b38 <open+0x33>
+    return -E_BAD_PATH;
+  801b2e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b33:	e9 a8 00 00 00       	jmp    801be0 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801b38:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801b3c:	48 89 c7             	mov    %rax,%rdi
+  801b3f:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+  801b4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b52:	79 08                	jns    801b5c <open+0x57>
+    return r;
+  801b54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b57:	e9 84 00 00 00       	jmp    801be0 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801b5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b60:	48 89 c6             	mov    %rax,%rsi
+  801b63:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801b6a:	00 00 00 
+  801b6d:	48 89 c7             	mov    %rax,%rdi
+  801b70:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  801b77:	00 00 00 
+  801b7a:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b7c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b83:	00 00 00 
+  801b86:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b89:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b93:	48 89 c6             	mov    %rax,%rsi
+  801b96:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b9b:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801ba2:	00 00 00 
+  801ba5:	ff d0                	call   *%rax
+  801ba7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801baa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bae:	79 1d                	jns    801bcd <open+0xc8>
+    fd_close(fd, 0);
+  801bb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bb9:	48 89 c7             	mov    %rax,%rdi
+  801bbc:	48 b8 17 0d 80 00 00 	movabs $0x800d17,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+    return r;
+  801bc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bcb:	eb 13                	jmp    801be0 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801bcd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bd1:	48 89 c7             	mov    %rax,%rdi
+  801bd4:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+}
+  801be0:	c9                   	leave
+  801be1:	c3                   	ret
+
+0000000000801be2 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801be2:	55                   	push   %rbp
+  801be3:	48 89 e5             	mov    %rsp,%rbp
+  801be6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf2:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bf5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bfc:	00 00 00 
+  801bff:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801c01:	be 00 00 00 00       	mov    $0x0,%esi
+  801c06:	bf 06 00 00 00       	mov    $0x6,%edi
+  801c0b:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+}
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+0000000000801c19 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	48 83 ec 30          	sub    $0x30,%rsp
+  801c21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c25:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c29:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c2d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c32:	74 07                	je     801c3b <devfile_read+0x22>
+  801c34:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801c39:	75 0a                	jne    801c45 <devfile_read+0x2c>
+  return E_INVAL;
+  801c3b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c40:	e9 b4 00 00 00       	jmp    801cf9 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801c45:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801c4c:	00 
+  while (n) {
+  801c4d:	e9 98 00 00 00       	jmp    801cea <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c56:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c59:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c60:	00 00 00 
+  801c63:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801c65:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c6c:	00 00 00 
+  801c6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c73:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c77:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c81:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+  801c8d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c90:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c94:	7f 13                	jg     801ca9 <devfile_read+0x90>
+      return res ? res : res0;
+  801c96:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c9a:	74 07                	je     801ca3 <devfile_read+0x8a>
+  801c9c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c9f:	48 98                	cltq
+  801ca1:	eb 56                	jmp    801cf9 <devfile_read+0xe0>
+  801ca3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca7:	eb 50                	jmp    801cf9 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801ca9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cac:	48 63 d0             	movslq %eax,%rdx
+  801caf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cb3:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801cba:	00 00 00 
+  801cbd:	48 89 ce             	mov    %rcx,%rsi
+  801cc0:	48 89 c7             	mov    %rax,%rdi
+  801cc3:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+
+    buf += res;
+  801ccf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cd2:	48 98                	cltq
+  801cd4:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801cd8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cdb:	48 98                	cltq
+  801cdd:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801ce1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ce4:	48 98                	cltq
+  801ce6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801cea:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cef:	0f 85 5d ff ff ff    	jne    801c52 <devfile_read+0x39>
+  }
+
+  return res0;
+  801cf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801cf9:	c9                   	leave
+  801cfa:	c3                   	ret
+
+0000000000801cfb <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801cfb:	55                   	push   %rbp
+  801cfc:	48 89 e5             	mov    %rsp,%rbp
+  801cff:	48 83 ec 50          	sub    $0x50,%rsp
+  801d03:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801d07:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801d0b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801d0f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d14:	74 07                	je     801d1d <devfile_write+0x22>
+  801d16:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801d1b:	75 0a                	jne    801d27 <devfile_write+0x2c>
+  return E_INVAL;
+  801d1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d22:	e9 c9 00 00 00       	jmp    801df0 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801d27:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801d2e:	00 
+
+  while (n) {
+  801d2f:	e9 ad 00 00 00       	jmp    801de1 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d34:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801d38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801d3c:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801d43:	00 
+  801d44:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d4c:	48 39 c2             	cmp    %rax,%rdx
+  801d4f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801d53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801d57:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801d5b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d5f:	48 89 c6             	mov    %rax,%rsi
+  801d62:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801d69:	00 00 00 
+  801d6c:	48 89 c7             	mov    %rax,%rdi
+  801d6f:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  801d76:	00 00 00 
+  801d79:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d7f:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d82:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d89:	00 00 00 
+  801d8c:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d8e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d95:	00 00 00 
+  801d98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d9c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801da0:	be 00 00 00 00       	mov    $0x0,%esi
+  801da5:	bf 04 00 00 00       	mov    $0x4,%edi
+  801daa:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+  801db6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801db9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801dbd:	79 07                	jns    801dc6 <devfile_write+0xcb>
+      return res;
+  801dbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dc2:	48 98                	cltq
+  801dc4:	eb 2a                	jmp    801df0 <devfile_write+0xf5>
+
+    buf += res;
+  801dc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dc9:	48 98                	cltq
+  801dcb:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801dcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dd2:	48 98                	cltq
+  801dd4:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801dd8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ddb:	48 98                	cltq
+  801ddd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801de1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801de6:	0f 85 48 ff ff ff    	jne    801d34 <devfile_write+0x39>
+  }
+
+  return res0;
+  801dec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801df0:	c9                   	leave
+  801df1:	c3                   	ret
+
+0000000000801df2 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801df2:	55                   	push   %rbp
+  801df3:	48 89 e5             	mov    %rsp,%rbp
+  801df6:	48 83 ec 20          	sub    $0x20,%rsp
+  801dfa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801dfe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e06:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e09:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e10:	00 00 00 
+  801e13:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e15:	be 00 00 00 00       	mov    $0x0,%esi
+  801e1a:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e1f:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801e26:	00 00 00 
+  801e29:	ff d0                	call   *%rax
+  801e2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801e2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e32:	79 05                	jns    801e39 <devfile_stat+0x47>
+    return r;
+  801e34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e37:	eb 59                	jmp    801e92 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e3d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e44:	00 00 00 
+  801e47:	48 89 d6             	mov    %rdx,%rsi
+  801e4a:	48 89 c7             	mov    %rax,%rdi
+  801e4d:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  801e54:	00 00 00 
+  801e57:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801e59:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e60:	00 00 00 
+  801e63:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801e69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e6d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e73:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e7a:	00 00 00 
+  801e7d:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e87:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+0000000000801e94 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ea0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ea3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ea7:	8b 40 0c             	mov    0xc(%rax),%eax
+  801eaa:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801eb1:	00 00 00 
+  801eb4:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801eb6:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801ebd:	00 00 00 
+  801ec0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ec3:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ec6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecb:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ed0:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801ed7:	00 00 00 
+  801eda:	ff d0                	call   *%rax
+}
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+
+0000000000801ede <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801eea:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801eed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801ef1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ef4:	83 e0 03             	and    $0x3,%eax
+}
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+
+0000000000801ef9 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801ef9:	55                   	push   %rbp
+  801efa:	48 89 e5             	mov    %rsp,%rbp
+  801efd:	48 83 ec 10          	sub    $0x10,%rsp
+  801f01:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801f05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f09:	48 89 c7             	mov    %rax,%rdi
+  801f0c:	48 b8 88 40 80 00 00 	movabs $0x804088,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f1d:	7e 07                	jle    801f26 <remove+0x2d>
+    return -E_BAD_PATH;
+  801f1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f24:	eb 36                	jmp    801f5c <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801f26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f2a:	48 89 c6             	mov    %rax,%rsi
+  801f2d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f34:	00 00 00 
+  801f37:	48 89 c7             	mov    %rax,%rdi
+  801f3a:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  801f41:	00 00 00 
+  801f44:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801f46:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4b:	bf 07 00 00 00       	mov    $0x7,%edi
+  801f50:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801f57:	00 00 00 
+  801f5a:	ff d0                	call   *%rax
+}
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+0000000000801f5e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801f5e:	55                   	push   %rbp
+  801f5f:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f62:	be 00 00 00 00       	mov    $0x0,%esi
+  801f67:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f6c:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+}
+  801f78:	5d                   	pop    %rbp
+  801f79:	c3                   	ret
+
+0000000000801f7a <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	48 83 ec 20          	sub    $0x20,%rsp
+  801f82:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f86:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8b:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f90:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801fa3:	79 05                	jns    801faa <fs_stats+0x30>
+    return r;
+  801fa5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fa8:	eb 2a                	jmp    801fd4 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fae:	ba 68 00 00 00       	mov    $0x68,%edx
+  801fb3:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801fba:	00 00 00 
+  801fbd:	48 89 ce             	mov    %rcx,%rsi
+  801fc0:	48 89 c7             	mov    %rax,%rdi
+  801fc3:	48 b8 cc 46 80 00 00 	movabs $0x8046cc,%rax
+  801fca:	00 00 00 
+  801fcd:	ff d0                	call   *%rax
+  return 0;
+  801fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fd4:	c9                   	leave
+  801fd5:	c3                   	ret
+
+0000000000801fd6 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801fd6:	55                   	push   %rbp
+  801fd7:	48 89 e5             	mov    %rsp,%rbp
+  801fda:	48 83 ec 10          	sub    $0x10,%rsp
+  801fde:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801fe1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fe8:	00 00 00 
+  801feb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fee:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801ffa:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+}
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+
+0000000000802008 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  802008:	55                   	push   %rbp
+  802009:	48 89 e5             	mov    %rsp,%rbp
+  80200c:	48 83 ec 10          	sub    $0x10,%rsp
+  802010:	89 f8                	mov    %edi,%eax
+  802012:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  802015:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  802019:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802020:	00 00 00 
+  802023:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  802025:	be 00 00 00 00       	mov    $0x0,%esi
+  80202a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80202f:	48 b8 7e 1a 80 00 00 	movabs $0x801a7e,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+}
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+000000000080203d <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80203d:	55                   	push   %rbp
+  80203e:	48 89 e5             	mov    %rsp,%rbp
+  802041:	48 83 ec 10          	sub    $0x10,%rsp
+  802045:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  802049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80204d:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  802052:	48 89 c7             	mov    %rax,%rdi
+  802055:	48 b8 63 20 80 00 00 	movabs $0x802063,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+}
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+
+0000000000802063 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	48 83 ec 50          	sub    $0x50,%rsp
+  80206b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80206f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  802073:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80207a:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80207b:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802080:	74 0a                	je     80208c <pipe_size+0x29>
+  802082:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802089:	00 
+  80208a:	76 0a                	jbe    802096 <pipe_size+0x33>
+    return -E_INVAL;
+  80208c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802091:	e9 cc 02 00 00       	jmp    802362 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802096:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80209a:	48 89 c7             	mov    %rax,%rdi
+  80209d:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b0:	0f 88 a8 02 00 00    	js     80235e <pipe_size+0x2fb>
+  8020b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ba:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020bf:	48 89 c6             	mov    %rax,%rsi
+  8020c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c7:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+  8020d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020da:	0f 88 7e 02 00 00    	js     80235e <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020e0:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8020e4:	48 89 c7             	mov    %rax,%rdi
+  8020e7:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+  8020f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020fa:	0f 88 43 02 00 00    	js     802343 <pipe_size+0x2e0>
+  802100:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802104:	ba 07 04 00 00       	mov    $0x407,%edx
+  802109:	48 89 c6             	mov    %rax,%rsi
+  80210c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802111:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+  80211d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802120:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802124:	0f 88 19 02 00 00    	js     802343 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80212a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80212e:	48 89 c7             	mov    %rax,%rdi
+  802131:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  802141:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802148:	00 
+  802149:	e9 a2 00 00 00       	jmp    8021f0 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80214e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802152:	48 c1 e0 0c          	shl    $0xc,%rax
+  802156:	48 89 c2             	mov    %rax,%rdx
+  802159:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80215d:	48 01 d0             	add    %rdx,%rax
+  802160:	ba 07 04 00 00       	mov    $0x407,%edx
+  802165:	48 89 c6             	mov    %rax,%rsi
+  802168:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216d:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+  802179:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80217c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802180:	0f 88 37 01 00 00    	js     8022bd <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802186:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80218a:	48 89 c7             	mov    %rax,%rdi
+  80218d:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802194:	00 00 00 
+  802197:	ff d0                	call   *%rax
+  802199:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80219d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8021a1:	48 01 c2             	add    %rax,%rdx
+  8021a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021a8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8021ac:	48 89 c1             	mov    %rax,%rcx
+  8021af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b3:	48 01 c8             	add    %rcx,%rax
+  8021b6:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8021bc:	48 89 d1             	mov    %rdx,%rcx
+  8021bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c4:	48 89 c6             	mov    %rax,%rsi
+  8021c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021cc:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8021db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021df:	79 0a                	jns    8021eb <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8021e1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8021e6:	e9 d3 00 00 00       	jmp    8022be <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8021eb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8021f0:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8021f7:	00 
+  8021f8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802200:	48 01 d0             	add    %rdx,%rax
+  802203:	48 83 c0 1f          	add    $0x1f,%rax
+  802207:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80220b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80220f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802214:	48 f7 75 e0          	divq   -0x20(%rbp)
+  802218:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80221c:	48 29 d0             	sub    %rdx,%rax
+  80221f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802223:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802227:	0f 82 21 ff ff ff    	jb     80214e <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80222d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802231:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  802235:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802239:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80223d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  802241:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802245:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80224c:	00 00 00 
+  80224f:	8b 12                	mov    (%rdx),%edx
+  802251:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  802253:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802257:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80225e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802262:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802269:	00 00 00 
+  80226c:	8b 12                	mov    (%rdx),%edx
+  80226e:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  802270:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802274:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80227b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80227f:	48 89 c7             	mov    %rax,%rdi
+  802282:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  802289:	00 00 00 
+  80228c:	ff d0                	call   *%rax
+  80228e:	89 c2                	mov    %eax,%edx
+  802290:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802294:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802296:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80229a:	48 89 c7             	mov    %rax,%rdi
+  80229d:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8022ad:	48 83 c2 04          	add    $0x4,%rdx
+  8022b1:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8022b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b8:	e9 a5 00 00 00       	jmp    802362 <pipe_size+0x2ff>
+      goto err2;
+  8022bd:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8022be:	eb 58                	jmp    802318 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8022c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022c4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022c8:	48 89 c2             	mov    %rax,%rdx
+  8022cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022cf:	48 01 d0             	add    %rdx,%rax
+  8022d2:	48 89 c6             	mov    %rax,%rsi
+  8022d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022da:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  8022e1:	00 00 00 
+  8022e4:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8022e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ea:	48 89 c7             	mov    %rax,%rdi
+  8022ed:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  8022f4:	00 00 00 
+  8022f7:	ff d0                	call   *%rax
+  8022f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022fd:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802301:	48 01 d0             	add    %rdx,%rax
+  802304:	48 89 c6             	mov    %rax,%rsi
+  802307:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230c:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  802318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80231c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802320:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802324:	48 85 c0             	test   %rax,%rax
+  802327:	75 97                	jne    8022c0 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  802329:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80232d:	48 89 c6             	mov    %rax,%rsi
+  802330:	bf 00 00 00 00       	mov    $0x0,%edi
+  802335:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+  802341:	eb 01                	jmp    802344 <pipe_size+0x2e1>
+    goto err1;
+  802343:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  802344:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802348:	48 89 c6             	mov    %rax,%rsi
+  80234b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802350:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	eb 01                	jmp    80235f <pipe_size+0x2fc>
+    goto err;
+  80235e:	90                   	nop
+err:
+  return r;
+  80235f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802362:	c9                   	leave
+  802363:	c3                   	ret
+
+0000000000802364 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802364:	55                   	push   %rbp
+  802365:	48 89 e5             	mov    %rsp,%rbp
+  802368:	53                   	push   %rbx
+  802369:	48 83 ec 28          	sub    $0x28,%rsp
+  80236d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802371:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  802375:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80237c:	00 00 00 
+  80237f:	8b 40 04             	mov    0x4(%rax),%eax
+  802382:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802387:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80238e:	00 00 00 
+  802391:	48 98                	cltq
+  802393:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80239a:	48 01 d0             	add    %rdx,%rax
+  80239d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023a3:	8b 00                	mov    (%rax),%eax
+  8023a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8023a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ac:	48 89 c7             	mov    %rax,%rdi
+  8023af:	48 b8 42 50 80 00 00 	movabs $0x805042,%rax
+  8023b6:	00 00 00 
+  8023b9:	ff d0                	call   *%rax
+  8023bb:	89 c3                	mov    %eax,%ebx
+  8023bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023c1:	48 89 c7             	mov    %rax,%rdi
+  8023c4:	48 b8 42 50 80 00 00 	movabs $0x805042,%rax
+  8023cb:	00 00 00 
+  8023ce:	ff d0                	call   *%rax
+  8023d0:	39 c3                	cmp    %eax,%ebx
+  8023d2:	0f 94 c0             	sete   %al
+  8023d5:	0f b6 c0             	movzbl %al,%eax
+  8023d8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8023db:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023e2:	00 00 00 
+  8023e5:	8b 40 04             	mov    0x4(%rax),%eax
+  8023e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023ed:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023f4:	00 00 00 
+  8023f7:	48 98                	cltq
+  8023f9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802400:	48 01 d0             	add    %rdx,%rax
+  802403:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802409:	8b 00                	mov    (%rax),%eax
+  80240b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80240e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802411:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802414:	75 05                	jne    80241b <_pipeisclosed+0xb7>
+      return ret;
+  802416:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802419:	eb 68                	jmp    802483 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80241b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80241e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802421:	0f 84 4e ff ff ff    	je     802375 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  802427:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80242e:	00 00 00 
+  802431:	8b 40 04             	mov    0x4(%rax),%eax
+  802434:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802439:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802440:	00 00 00 
+  802443:	48 98                	cltq
+  802445:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80244c:	48 01 d0             	add    %rdx,%rax
+  80244f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802455:	8b 10                	mov    (%rax),%edx
+  802457:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80245a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80245d:	89 c6                	mov    %eax,%esi
+  80245f:	48 b8 08 52 80 00 00 	movabs $0x805208,%rax
+  802466:	00 00 00 
+  802469:	48 89 c7             	mov    %rax,%rdi
+  80246c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802471:	49 b8 d9 31 80 00 00 	movabs $0x8031d9,%r8
+  802478:	00 00 00 
+  80247b:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80247e:	e9 f2 fe ff ff       	jmp    802375 <_pipeisclosed+0x11>
+  }
+}
+  802483:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802487:	c9                   	leave
+  802488:	c3                   	ret
+
+0000000000802489 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802489:	55                   	push   %rbp
+  80248a:	48 89 e5             	mov    %rsp,%rbp
+  80248d:	48 83 ec 30          	sub    $0x30,%rsp
+  802491:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802494:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802498:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80249b:	48 89 d6             	mov    %rdx,%rsi
+  80249e:	89 c7                	mov    %eax,%edi
+  8024a0:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+  8024ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024b3:	79 05                	jns    8024ba <pipeisclosed+0x31>
+    return r;
+  8024b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024b8:	eb 31                	jmp    8024eb <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8024ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024be:	48 89 c7             	mov    %rax,%rdi
+  8024c1:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  8024c8:	00 00 00 
+  8024cb:	ff d0                	call   *%rax
+  8024cd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8024d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024d9:	48 89 d6             	mov    %rdx,%rsi
+  8024dc:	48 89 c7             	mov    %rax,%rdi
+  8024df:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+}
+  8024eb:	c9                   	leave
+  8024ec:	c3                   	ret
+
+00000000008024ed <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8024ed:	55                   	push   %rbp
+  8024ee:	48 89 e5             	mov    %rsp,%rbp
+  8024f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8024f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024fd:	8b 40 18             	mov    0x18(%rax),%eax
+  802500:	8d 50 01             	lea    0x1(%rax),%edx
+  802503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802507:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80250a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80250e:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802511:	85 c0                	test   %eax,%eax
+  802513:	74 27                	je     80253c <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802515:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802519:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  802520:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802524:	48 83 c0 18          	add    $0x18,%rax
+  802528:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80252d:	48 89 c7             	mov    %rax,%rdi
+  802530:	48 b8 bf 07 80 00 00 	movabs $0x8007bf,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  }
+}
+  80253c:	90                   	nop
+  80253d:	c9                   	leave
+  80253e:	c3                   	ret
+
+000000000080253f <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+  802543:	48 83 ec 10          	sub    $0x10,%rsp
+  802547:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80254b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80254e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802552:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  802559:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255d:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  802561:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802564:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80256b:	89 c6                	mov    %eax,%esi
+  80256d:	48 89 cf             	mov    %rcx,%rdi
+  802570:	48 b8 70 07 80 00 00 	movabs $0x800770,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+}
+  80257c:	90                   	nop
+  80257d:	c9                   	leave
+  80257e:	c3                   	ret
+
+000000000080257f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80257f:	55                   	push   %rbp
+  802580:	48 89 e5             	mov    %rsp,%rbp
+  802583:	48 83 ec 70          	sub    $0x70,%rsp
+  802587:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80258b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80258f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802593:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802597:	48 89 c7             	mov    %rax,%rdi
+  80259a:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+  8025a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8025aa:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8025af:	75 0a                	jne    8025bb <devpipe_read+0x3c>
+    return 0;
+  8025b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b6:	e9 63 01 00 00       	jmp    80271e <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8025bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bf:	8b 40 18             	mov    0x18(%rax),%eax
+  8025c2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8025c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c9:	48 8b 10             	mov    (%rax),%rdx
+  8025cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025d4:	48 39 c2             	cmp    %rax,%rdx
+  8025d7:	75 42                	jne    80261b <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8025d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8025e1:	48 89 d6             	mov    %rdx,%rsi
+  8025e4:	48 89 c7             	mov    %rax,%rdi
+  8025e7:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	74 0a                	je     802601 <devpipe_read+0x82>
+      return 0;
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	e9 1d 01 00 00       	jmp    80271e <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802601:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802608:	89 d6                	mov    %edx,%esi
+  80260a:	48 89 c7             	mov    %rax,%rdi
+  80260d:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  802614:	00 00 00 
+  802617:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  802619:	eb a0                	jmp    8025bb <devpipe_read+0x3c>
+      break;
+  80261b:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80261c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802620:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  802624:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802628:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80262c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802630:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802638:	48 8b 00             	mov    (%rax),%rax
+  80263b:	48 29 c2             	sub    %rax,%rdx
+  80263e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802642:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802646:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80264a:	48 39 c2             	cmp    %rax,%rdx
+  80264d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802651:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  802655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802659:	48 8b 00             	mov    (%rax),%rax
+  80265c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802660:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  802664:	ba 00 00 00 00       	mov    $0x0,%edx
+  802669:	48 f7 f1             	div    %rcx
+  80266c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  802670:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802674:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802678:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802680:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802684:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802688:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80268c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802690:	48 39 c2             	cmp    %rax,%rdx
+  802693:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802697:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80269b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8026a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026a7:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8026ab:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8026af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026b3:	48 89 ce             	mov    %rcx,%rsi
+  8026b6:	48 89 c7             	mov    %rax,%rdi
+  8026b9:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8026c5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8026c9:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8026cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026d1:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8026d5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026d9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8026dd:	48 01 d1             	add    %rdx,%rcx
+  8026e0:	48 89 c2             	mov    %rax,%rdx
+  8026e3:	48 89 cf             	mov    %rcx,%rdi
+  8026e6:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  8026ed:	00 00 00 
+  8026f0:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8026f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f6:	48 8b 10             	mov    (%rax),%rdx
+  8026f9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8026fd:	48 01 c2             	add    %rax,%rdx
+  802700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802704:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802707:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80270b:	48 89 c7             	mov    %rax,%rdi
+  80270e:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  802715:	00 00 00 
+  802718:	ff d0                	call   *%rax
+  return n;
+  80271a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80271e:	c9                   	leave
+  80271f:	c3                   	ret
+
+0000000000802720 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	48 83 ec 70          	sub    $0x70,%rsp
+  802728:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80272c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802730:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802734:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802738:	48 89 c7             	mov    %rax,%rdi
+  80273b:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802742:	00 00 00 
+  802745:	ff d0                	call   *%rax
+  802747:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80274b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80274f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  802753:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80275a:	00 
+  80275b:	e9 b8 01 00 00       	jmp    802918 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  802760:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802764:	8b 40 18             	mov    0x18(%rax),%eax
+  802767:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80276a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802776:	48 8b 00             	mov    (%rax),%rax
+  802779:	48 29 c2             	sub    %rax,%rdx
+  80277c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802780:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802784:	48 39 c2             	cmp    %rax,%rdx
+  802787:	75 4d                	jne    8027d6 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802789:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80278d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802791:	48 89 d6             	mov    %rdx,%rsi
+  802794:	48 89 c7             	mov    %rax,%rdi
+  802797:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	85 c0                	test   %eax,%eax
+  8027a5:	74 0a                	je     8027b1 <devpipe_write+0x91>
+        return 0;
+  8027a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ac:	e9 79 01 00 00       	jmp    80292a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8027b1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8027b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b8:	89 d6                	mov    %edx,%esi
+  8027ba:	48 89 c7             	mov    %rax,%rdi
+  8027bd:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+      m = 0;
+  8027c9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027d0:	00 
+      continue;
+  8027d1:	e9 3a 01 00 00       	jmp    802910 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8027d6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8027da:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8027de:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8027e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027e6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8027ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ee:	48 8b 08             	mov    (%rax),%rcx
+  8027f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027f9:	48 29 c1             	sub    %rax,%rcx
+  8027fc:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802800:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802804:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802808:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80280c:	48 39 c2             	cmp    %rax,%rdx
+  80280f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802813:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  802817:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80281f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802823:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  802827:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282c:	48 f7 f1             	div    %rcx
+  80282f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  802833:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802837:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80283b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80283f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802843:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802847:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80284b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80284f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802853:	48 39 c2             	cmp    %rax,%rdx
+  802856:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80285a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80285e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802862:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  802866:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80286a:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80286e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802872:	48 01 d1             	add    %rdx,%rcx
+  802875:	48 89 c2             	mov    %rax,%rdx
+  802878:	48 89 cf             	mov    %rcx,%rdi
+  80287b:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80288b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80288f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802893:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802897:	73 4d                	jae    8028e6 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80289d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028a5:	48 29 c2             	sub    %rax,%rdx
+  8028a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ac:	48 01 c2             	add    %rax,%rdx
+  8028af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028b3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028b7:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8028bb:	48 89 c1             	mov    %rax,%rcx
+  8028be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c2:	48 01 c1             	add    %rax,%rcx
+  8028c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028c9:	48 01 c1             	add    %rax,%rcx
+  8028cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028d0:	48 83 c0 20          	add    $0x20,%rax
+  8028d4:	48 89 ce             	mov    %rcx,%rsi
+  8028d7:	48 89 c7             	mov    %rax,%rdi
+  8028da:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  8028e1:	00 00 00 
+  8028e4:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8028e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028ea:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8028ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f2:	48 01 c2             	add    %rax,%rdx
+  8028f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028f9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8028fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802901:	48 89 c7             	mov    %rax,%rdi
+  802904:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802910:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802914:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  802918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80291c:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802920:	0f 82 3a fe ff ff    	jb     802760 <devpipe_write+0x40>
+  }
+
+  return i;
+  802926:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80292a:	c9                   	leave
+  80292b:	c3                   	ret
+
+000000000080292c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80292c:	55                   	push   %rbp
+  80292d:	48 89 e5             	mov    %rsp,%rbp
+  802930:	48 83 ec 40          	sub    $0x40,%rsp
+  802934:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802938:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80293b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80293f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802943:	48 89 c7             	mov    %rax,%rdi
+  802946:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  802956:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80295d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802961:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  802965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802969:	48 89 d6             	mov    %rdx,%rsi
+  80296c:	48 89 c7             	mov    %rax,%rdi
+  80296f:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+  80297b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80297e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802982:	79 08                	jns    80298c <devpipe_poll+0x60>
+    return r;
+  802984:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802987:	e9 85 00 00 00       	jmp    802a11 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80298c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80298f:	83 e0 01             	and    $0x1,%eax
+  802992:	85 c0                	test   %eax,%eax
+  802994:	74 18                	je     8029ae <devpipe_poll+0x82>
+  802996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80299a:	48 8b 10             	mov    (%rax),%rdx
+  80299d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029a1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029a5:	48 39 c2             	cmp    %rax,%rdx
+  8029a8:	74 04                	je     8029ae <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8029aa:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8029ae:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8029b1:	83 e0 02             	and    $0x2,%eax
+  8029b4:	85 c0                	test   %eax,%eax
+  8029b6:	74 23                	je     8029db <devpipe_poll+0xaf>
+  8029b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029bc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8029c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029c4:	48 8b 00             	mov    (%rax),%rax
+  8029c7:	48 29 c2             	sub    %rax,%rdx
+  8029ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8029d2:	48 39 c2             	cmp    %rax,%rdx
+  8029d5:	73 04                	jae    8029db <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8029d7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8029db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029e3:	48 89 d6             	mov    %rdx,%rsi
+  8029e6:	48 89 c7             	mov    %rax,%rdi
+  8029e9:	48 b8 64 23 80 00 00 	movabs $0x802364,%rax
+  8029f0:	00 00 00 
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	74 04                	je     8029fd <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8029f9:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8029fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a01:	75 0b                	jne    802a0e <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802a03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a07:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802a0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a11:	c9                   	leave
+  802a12:	c3                   	ret
+
+0000000000802a13 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802a13:	55                   	push   %rbp
+  802a14:	48 89 e5             	mov    %rsp,%rbp
+  802a17:	48 83 ec 20          	sub    $0x20,%rsp
+  802a1b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a1f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a27:	48 89 c7             	mov    %rax,%rdi
+  802a2a:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+  802a36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  802a3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a3e:	48 ba 39 52 80 00 00 	movabs $0x805239,%rdx
+  802a45:	00 00 00 
+  802a48:	48 89 d6             	mov    %rdx,%rsi
+  802a4b:	48 89 c7             	mov    %rax,%rdi
+  802a4e:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  802a55:	00 00 00 
+  802a58:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  802a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a5e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a62:	89 c1                	mov    %eax,%ecx
+  802a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a68:	48 8b 00             	mov    (%rax),%rax
+  802a6b:	89 c2                	mov    %eax,%edx
+  802a6d:	89 c8                	mov    %ecx,%eax
+  802a6f:	29 d0                	sub    %edx,%eax
+  802a71:	89 c2                	mov    %eax,%edx
+  802a73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a77:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a81:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a88:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a8f:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a96:	00 00 00 
+  802a99:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aa5:	c9                   	leave
+  802aa6:	c3                   	ret
+
+0000000000802aa7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802aa7:	55                   	push   %rbp
+  802aa8:	48 89 e5             	mov    %rsp,%rbp
+  802aab:	48 83 ec 40          	sub    $0x40,%rsp
+  802aaf:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab7:	48 89 c7             	mov    %rax,%rdi
+  802aba:	48 b8 34 0b 80 00 00 	movabs $0x800b34,%rax
+  802ac1:	00 00 00 
+  802ac4:	ff d0                	call   *%rax
+  802ac6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802aca:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802ad1:	00 
+  802ad2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ad6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ade:	48 01 d0             	add    %rdx,%rax
+  802ae1:	48 83 c0 1f          	add    $0x1f,%rax
+  802ae5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ae9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802af6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802afa:	48 29 d0             	sub    %rdx,%rax
+  802afd:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b01:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b09:	48 89 c6             	mov    %rax,%rsi
+  802b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b11:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802b1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b21:	48 89 c7             	mov    %rax,%rdi
+  802b24:	48 b8 ed 24 80 00 00 	movabs $0x8024ed,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802b30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b34:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b38:	eb 2f                	jmp    802b69 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802b3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b3e:	48 83 e8 01          	sub    $0x1,%rax
+  802b42:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b46:	48 89 c2             	mov    %rax,%rdx
+  802b49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b4d:	48 01 d0             	add    %rdx,%rax
+  802b50:	48 89 c6             	mov    %rax,%rsi
+  802b53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b58:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  802b5f:	00 00 00 
+  802b62:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802b64:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802b69:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802b6e:	77 ca                	ja     802b3a <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802b70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b74:	48 89 c6             	mov    %rax,%rsi
+  802b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7c:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+0000000000802b8a <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b8a:	55                   	push   %rbp
+  802b8b:	48 89 e5             	mov    %rsp,%rbp
+  802b8e:	48 83 ec 08          	sub    $0x8,%rsp
+  802b92:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b99:	75 10                	jne    802bab <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b9b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802ba2:	00 00 00 
+  802ba5:	8b 00                	mov    (%rax),%eax
+  802ba7:	48 98                	cltq
+  802ba9:	eb 05                	jmp    802bb0 <vsyscall+0x26>
+  }
+  return 0;
+  802bab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bb0:	c9                   	leave
+  802bb1:	c3                   	ret
+
+0000000000802bb2 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbb:	48 b8 8a 2b 80 00 00 	movabs $0x802b8a,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+}
+  802bc7:	5d                   	pop    %rbp
+  802bc8:	c3                   	ret
+
+0000000000802bc9 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+  802bcd:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802bd1:	0f 31                	rdtsc
+  802bd3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bd6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802bd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bdc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802bdf:	48 c1 e2 20          	shl    $0x20,%rdx
+  802be3:	48 09 d0             	or     %rdx,%rax
+  802be6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802bea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802bee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802bf2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802bf9:	00 00 00 
+  802bfc:	8b 40 08             	mov    0x8(%rax),%eax
+  802bff:	48 98                	cltq
+  802c01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802c05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c0e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802c12:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c22:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802c26:	48 89 d0             	mov    %rdx,%rax
+  802c29:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802c30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c35:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802c39:	48 01 c8             	add    %rcx,%rax
+}
+  802c3c:	c9                   	leave
+  802c3d:	c3                   	ret
+
+0000000000802c3e <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802c3e:	55                   	push   %rbp
+  802c3f:	48 89 e5             	mov    %rsp,%rbp
+  802c42:	48 83 ec 20          	sub    $0x20,%rsp
+  802c46:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802c49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c4c:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802c4f:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802c53:	be 01 00 00 00       	mov    $0x1,%esi
+  802c58:	48 89 c7             	mov    %rax,%rdi
+  802c5b:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+}
+  802c67:	90                   	nop
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+
+0000000000802c6a <getchar>:
+
+int
+getchar(void) {
+  802c6a:	55                   	push   %rbp
+  802c6b:	48 89 e5             	mov    %rsp,%rbp
+  802c6e:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c72:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c76:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c7b:	48 89 c6             	mov    %rax,%rsi
+  802c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c83:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  802c8a:	00 00 00 
+  802c8d:	ff d0                	call   *%rax
+  802c8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c96:	79 05                	jns    802c9d <getchar+0x33>
+    return r;
+  802c98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9b:	eb 14                	jmp    802cb1 <getchar+0x47>
+  if (r < 1)
+  802c9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca1:	7f 07                	jg     802caa <getchar+0x40>
+    return -E_EOF;
+  802ca3:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802ca8:	eb 07                	jmp    802cb1 <getchar+0x47>
+  return c;
+  802caa:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802cae:	0f b6 c0             	movzbl %al,%eax
+}
+  802cb1:	c9                   	leave
+  802cb2:	c3                   	ret
+
+0000000000802cb3 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+  802cb7:	48 83 ec 20          	sub    $0x20,%rsp
+  802cbb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cbe:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802cc2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cc5:	48 89 d6             	mov    %rdx,%rsi
+  802cc8:	89 c7                	mov    %eax,%edi
+  802cca:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cd9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cdd:	79 05                	jns    802ce4 <iscons+0x31>
+    return r;
+  802cdf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce2:	eb 1a                	jmp    802cfe <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce8:	8b 10                	mov    (%rax),%edx
+  802cea:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802cf1:	00 00 00 
+  802cf4:	8b 00                	mov    (%rax),%eax
+  802cf6:	39 c2                	cmp    %eax,%edx
+  802cf8:	0f 94 c0             	sete   %al
+  802cfb:	0f b6 c0             	movzbl %al,%eax
+}
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+0000000000802d00 <opencons>:
+
+int
+opencons(void) {
+  802d00:	55                   	push   %rbp
+  802d01:	48 89 e5             	mov    %rsp,%rbp
+  802d04:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802d08:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802d0c:	48 89 c7             	mov    %rax,%rdi
+  802d0f:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  802d16:	00 00 00 
+  802d19:	ff d0                	call   *%rax
+  802d1b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d1e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d22:	79 05                	jns    802d29 <opencons+0x29>
+    return r;
+  802d24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d27:	eb 66                	jmp    802d8f <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802d29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d2d:	ba 07 04 00 00       	mov    $0x407,%edx
+  802d32:	48 89 c6             	mov    %rax,%rsi
+  802d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3a:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  802d41:	00 00 00 
+  802d44:	ff d0                	call   *%rax
+  802d46:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d49:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d4d:	79 05                	jns    802d54 <opencons+0x54>
+    return r;
+  802d4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d52:	eb 3b                	jmp    802d8f <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d58:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802d5f:	00 00 00 
+  802d62:	8b 12                	mov    (%rdx),%edx
+  802d64:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d75:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d80:	48 89 c7             	mov    %rax,%rdi
+  802d83:	48 b8 11 0b 80 00 00 	movabs $0x800b11,%rax
+  802d8a:	00 00 00 
+  802d8d:	ff d0                	call   *%rax
+}
+  802d8f:	c9                   	leave
+  802d90:	c3                   	ret
+
+0000000000802d91 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d91:	55                   	push   %rbp
+  802d92:	48 89 e5             	mov    %rsp,%rbp
+  802d95:	48 83 ec 20          	sub    $0x20,%rsp
+  802d99:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d9c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d9f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802da3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da6:	48 89 d6             	mov    %rdx,%rsi
+  802da9:	89 c7                	mov    %eax,%edi
+  802dab:	48 b8 41 0c 80 00 00 	movabs $0x800c41,%rax
+  802db2:	00 00 00 
+  802db5:	ff d0                	call   *%rax
+  802db7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dbe:	79 05                	jns    802dc5 <consmode+0x34>
+    return r;
+  802dc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dc3:	eb 34                	jmp    802df9 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802dc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc9:	8b 10                	mov    (%rax),%edx
+  802dcb:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802dd2:	00 00 00 
+  802dd5:	8b 00                	mov    (%rax),%eax
+  802dd7:	39 c2                	cmp    %eax,%edx
+  802dd9:	74 07                	je     802de2 <consmode+0x51>
+    return -E_INVAL;
+  802ddb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802de0:	eb 17                	jmp    802df9 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802de2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802de6:	8b 40 0c             	mov    0xc(%rax),%eax
+  802de9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802dec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802df3:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802df6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802df9:	c9                   	leave
+  802dfa:	c3                   	ret
+
+0000000000802dfb <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dfb:	55                   	push   %rbp
+  802dfc:	48 89 e5             	mov    %rsp,%rbp
+  802dff:	48 83 ec 20          	sub    $0x20,%rsp
+  802e03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e0b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802e0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e13:	8b 50 0c             	mov    0xc(%rax),%edx
+  802e16:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1e:	48 89 ce             	mov    %rcx,%rsi
+  802e21:	48 89 c7             	mov    %rax,%rdi
+  802e24:	48 b8 1e 07 80 00 00 	movabs $0x80071e,%rax
+  802e2b:	00 00 00 
+  802e2e:	ff d0                	call   *%rax
+  802e30:	48 98                	cltq
+}
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+0000000000802e34 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+  802e38:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802e3f:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802e46:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802e4d:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802e54:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e5b:	eb 74                	jmp    802ed1 <devcons_write+0x9d>
+    m = n - tot;
+  802e5d:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802e64:	89 c2                	mov    %eax,%edx
+  802e66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e69:	29 c2                	sub    %eax,%edx
+  802e6b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802e6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e71:	83 f8 7f             	cmp    $0x7f,%eax
+  802e74:	76 07                	jbe    802e7d <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e76:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e7d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e80:	48 63 d0             	movslq %eax,%rdx
+  802e83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e86:	48 63 c8             	movslq %eax,%rcx
+  802e89:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e90:	48 01 c1             	add    %rax,%rcx
+  802e93:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e9a:	48 89 ce             	mov    %rcx,%rsi
+  802e9d:	48 89 c7             	mov    %rax,%rdi
+  802ea0:	48 b8 cc 46 80 00 00 	movabs $0x8046cc,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802eac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802eaf:	48 63 d0             	movslq %eax,%rdx
+  802eb2:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802eb9:	48 89 d6             	mov    %rdx,%rsi
+  802ebc:	48 89 c7             	mov    %rax,%rdi
+  802ebf:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802ecb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802ece:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802ed1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ed4:	48 98                	cltq
+  802ed6:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802edd:	0f 82 7a ff ff ff    	jb     802e5d <devcons_write+0x29>
+  }
+  return tot;
+  802ee3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee6:	48 98                	cltq
+}
+  802ee8:	c9                   	leave
+  802ee9:	c3                   	ret
+
+0000000000802eea <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802efb:	c9                   	leave
+  802efc:	c3                   	ret
+
+0000000000802efd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802efd:	55                   	push   %rbp
+  802efe:	48 89 e5             	mov    %rsp,%rbp
+  802f01:	48 83 ec 10          	sub    $0x10,%rsp
+  802f05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f09:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f11:	48 ba 45 52 80 00 00 	movabs $0x805245,%rdx
+  802f18:	00 00 00 
+  802f1b:	48 89 d6             	mov    %rdx,%rsi
+  802f1e:	48 89 c7             	mov    %rax,%rdi
+  802f21:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  802f28:	00 00 00 
+  802f2b:	ff d0                	call   *%rax
+  return 0;
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f32:	c9                   	leave
+  802f33:	c3                   	ret
+
+0000000000802f34 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802f34:	55                   	push   %rbp
+  802f35:	48 89 e5             	mov    %rsp,%rbp
+  802f38:	48 83 ec 30          	sub    $0x30,%rsp
+  802f3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f40:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802f43:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802f47:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802f4e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f51:	83 e0 02             	and    $0x2,%eax
+  802f54:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802f57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f5b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f5e:	83 f8 01             	cmp    $0x1,%eax
+  802f61:	75 04                	jne    802f67 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802f63:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802f67:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f6a:	83 e0 01             	and    $0x1,%eax
+  802f6d:	85 c0                	test   %eax,%eax
+  802f6f:	74 44                	je     802fb5 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f79:	89 c2                	mov    %eax,%edx
+  802f7b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f85:	48 b8 0c 08 80 00 00 	movabs $0x80080c,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	83 f8 01             	cmp    $0x1,%eax
+  802f94:	75 06                	jne    802f9c <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f96:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f9a:	eb 19                	jmp    802fb5 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fa0:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802fa6:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802fa9:	89 c2                	mov    %eax,%edx
+  802fab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802faf:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802fb5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802fb8:	c9                   	leave
+  802fb9:	c3                   	ret
+
+0000000000802fba <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+  802fbe:	53                   	push   %rbx
+  802fbf:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802fc6:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802fcd:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802fd3:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802fda:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802fe1:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802fe8:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802fef:	84 c0                	test   %al,%al
+  802ff1:	74 23                	je     803016 <_panic+0x5c>
+  802ff3:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802ffa:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802ffe:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  803002:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  803006:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80300a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80300e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  803012:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803016:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80301d:	00 00 00 
+  803020:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  803027:	00 00 00 
+  80302a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80302e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  803035:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80303c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  803043:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80304a:	00 00 00 
+  80304d:	48 8b 18             	mov    (%rax),%rbx
+  803050:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+  80305c:	89 c6                	mov    %eax,%esi
+  80305e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  803064:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80306b:	41 89 d0             	mov    %edx,%r8d
+  80306e:	48 89 c1             	mov    %rax,%rcx
+  803071:	48 89 da             	mov    %rbx,%rdx
+  803074:	48 b8 50 52 80 00 00 	movabs $0x805250,%rax
+  80307b:	00 00 00 
+  80307e:	48 89 c7             	mov    %rax,%rdi
+  803081:	b8 00 00 00 00       	mov    $0x0,%eax
+  803086:	49 b9 d9 31 80 00 00 	movabs $0x8031d9,%r9
+  80308d:	00 00 00 
+  803090:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803093:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80309a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8030a1:	48 89 d6             	mov    %rdx,%rsi
+  8030a4:	48 89 c7             	mov    %rax,%rdi
+  8030a7:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  8030ae:	00 00 00 
+  8030b1:	ff d0                	call   *%rax
+  cprintf("\n");
+  8030b3:	48 b8 73 52 80 00 00 	movabs $0x805273,%rax
+  8030ba:	00 00 00 
+  8030bd:	48 89 c7             	mov    %rax,%rdi
+  8030c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c5:	48 ba d9 31 80 00 00 	movabs $0x8031d9,%rdx
+  8030cc:	00 00 00 
+  8030cf:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8030d1:	cc                   	int3
+  8030d2:	eb fd                	jmp    8030d1 <_panic+0x117>
+
+00000000008030d4 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8030d4:	55                   	push   %rbp
+  8030d5:	48 89 e5             	mov    %rsp,%rbp
+  8030d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8030dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8030e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e7:	8b 00                	mov    (%rax),%eax
+  8030e9:	8d 48 01             	lea    0x1(%rax),%ecx
+  8030ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030f0:	89 0a                	mov    %ecx,(%rdx)
+  8030f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030f5:	89 d1                	mov    %edx,%ecx
+  8030f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030fb:	48 98                	cltq
+  8030fd:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803101:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803105:	8b 00                	mov    (%rax),%eax
+  803107:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80310c:	75 2c                	jne    80313a <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80310e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803112:	8b 00                	mov    (%rax),%eax
+  803114:	48 98                	cltq
+  803116:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80311a:	48 83 c2 08          	add    $0x8,%rdx
+  80311e:	48 89 c6             	mov    %rax,%rsi
+  803121:	48 89 d7             	mov    %rdx,%rdi
+  803124:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  80312b:	00 00 00 
+  80312e:	ff d0                	call   *%rax
+    b->idx = 0;
+  803130:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803134:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80313a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80313e:	8b 40 04             	mov    0x4(%rax),%eax
+  803141:	8d 50 01             	lea    0x1(%rax),%edx
+  803144:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803148:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80314b:	90                   	nop
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+
+000000000080314e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80314e:	55                   	push   %rbp
+  80314f:	48 89 e5             	mov    %rsp,%rbp
+  803152:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803159:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  803160:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  803167:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80316e:	00 00 00 
+  b.cnt = 0;
+  803171:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  803178:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80317b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803182:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803189:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803190:	48 89 c6             	mov    %rax,%rsi
+  803193:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  80319a:	00 00 00 
+  80319d:	48 89 c7             	mov    %rax,%rdi
+  8031a0:	48 b8 33 35 80 00 00 	movabs $0x803533,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8031ac:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8031b2:	48 98                	cltq
+  8031b4:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8031bb:	48 83 c2 08          	add    $0x8,%rdx
+  8031bf:	48 89 c6             	mov    %rax,%rsi
+  8031c2:	48 89 d7             	mov    %rdx,%rdi
+  8031c5:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8031d1:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8031d7:	c9                   	leave
+  8031d8:	c3                   	ret
+
+00000000008031d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8031d9:	55                   	push   %rbp
+  8031da:	48 89 e5             	mov    %rsp,%rbp
+  8031dd:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8031e4:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8031eb:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8031f2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8031f9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803200:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803207:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80320e:	84 c0                	test   %al,%al
+  803210:	74 20                	je     803232 <cprintf+0x59>
+  803212:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803216:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80321a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80321e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803222:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803226:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80322a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80322e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  803232:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803239:	00 00 00 
+  80323c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803243:	00 00 00 
+  803246:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80324a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803251:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803258:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80325f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  803266:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80326d:	48 89 d6             	mov    %rdx,%rsi
+  803270:	48 89 c7             	mov    %rax,%rdi
+  803273:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  80327a:	00 00 00 
+  80327d:	ff d0                	call   *%rax
+  80327f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803285:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+
+000000000080328d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80328d:	55                   	push   %rbp
+  80328e:	48 89 e5             	mov    %rsp,%rbp
+  803291:	48 83 ec 30          	sub    $0x30,%rsp
+  803295:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803299:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80329d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8032a1:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8032a4:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8032a8:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8032ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032af:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8032b3:	72 54                	jb     803309 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8032b5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8032b8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8032bb:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8032be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c7:	48 f7 f6             	div    %rsi
+  8032ca:	49 89 c2             	mov    %rax,%r10
+  8032cd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8032d0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8032d3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8032d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032db:	41 89 c9             	mov    %ecx,%r9d
+  8032de:	41 89 f8             	mov    %edi,%r8d
+  8032e1:	89 d1                	mov    %edx,%ecx
+  8032e3:	4c 89 d2             	mov    %r10,%rdx
+  8032e6:	48 89 c7             	mov    %rax,%rdi
+  8032e9:	48 b8 8d 32 80 00 00 	movabs $0x80328d,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+  8032f5:	eb 1c                	jmp    803313 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8032f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032fe:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803302:	48 89 d6             	mov    %rdx,%rsi
+  803305:	89 c7                	mov    %eax,%edi
+  803307:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803309:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80330d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803311:	7f e4                	jg     8032f7 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  803313:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803316:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80331f:	48 f7 f1             	div    %rcx
+  803322:	48 b8 b0 54 80 00 00 	movabs $0x8054b0,%rax
+  803329:	00 00 00 
+  80332c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  803330:	0f be c0             	movsbl %al,%eax
+  803333:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803337:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80333b:	48 89 d6             	mov    %rdx,%rsi
+  80333e:	89 c7                	mov    %eax,%edi
+  803340:	ff d1                	call   *%rcx
+}
+  803342:	90                   	nop
+  803343:	c9                   	leave
+  803344:	c3                   	ret
+
+0000000000803345 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  803345:	55                   	push   %rbp
+  803346:	48 89 e5             	mov    %rsp,%rbp
+  803349:	48 83 ec 10          	sub    $0x10,%rsp
+  80334d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803351:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  803354:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  803358:	7e 4b                	jle    8033a5 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80335a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80335e:	8b 00                	mov    (%rax),%eax
+  803360:	83 f8 2f             	cmp    $0x2f,%eax
+  803363:	77 24                	ja     803389 <getuint+0x44>
+  803365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803369:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80336d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803371:	8b 00                	mov    (%rax),%eax
+  803373:	89 c0                	mov    %eax,%eax
+  803375:	48 01 d0             	add    %rdx,%rax
+  803378:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80337c:	8b 12                	mov    (%rdx),%edx
+  80337e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803381:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803385:	89 0a                	mov    %ecx,(%rdx)
+  803387:	eb 14                	jmp    80339d <getuint+0x58>
+  803389:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803391:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803395:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803399:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80339d:	48 8b 00             	mov    (%rax),%rax
+  8033a0:	e9 95 00 00 00       	jmp    80343a <getuint+0xf5>
+  else if (lflag)
+  8033a5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8033a9:	74 48                	je     8033f3 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8033ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033af:	8b 00                	mov    (%rax),%eax
+  8033b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8033b4:	77 24                	ja     8033da <getuint+0x95>
+  8033b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ba:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c2:	8b 00                	mov    (%rax),%eax
+  8033c4:	89 c0                	mov    %eax,%eax
+  8033c6:	48 01 d0             	add    %rdx,%rax
+  8033c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033cd:	8b 12                	mov    (%rdx),%edx
+  8033cf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033d6:	89 0a                	mov    %ecx,(%rdx)
+  8033d8:	eb 14                	jmp    8033ee <getuint+0xa9>
+  8033da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033de:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033e2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ea:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033ee:	48 8b 00             	mov    (%rax),%rax
+  8033f1:	eb 47                	jmp    80343a <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8033f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f7:	8b 00                	mov    (%rax),%eax
+  8033f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8033fc:	77 24                	ja     803422 <getuint+0xdd>
+  8033fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803402:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803406:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340a:	8b 00                	mov    (%rax),%eax
+  80340c:	89 c0                	mov    %eax,%eax
+  80340e:	48 01 d0             	add    %rdx,%rax
+  803411:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803415:	8b 12                	mov    (%rdx),%edx
+  803417:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80341a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80341e:	89 0a                	mov    %ecx,(%rdx)
+  803420:	eb 14                	jmp    803436 <getuint+0xf1>
+  803422:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803426:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80342a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80342e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803432:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803436:	8b 00                	mov    (%rax),%eax
+  803438:	89 c0                	mov    %eax,%eax
+}
+  80343a:	c9                   	leave
+  80343b:	c3                   	ret
+
+000000000080343c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80343c:	55                   	push   %rbp
+  80343d:	48 89 e5             	mov    %rsp,%rbp
+  803440:	48 83 ec 10          	sub    $0x10,%rsp
+  803444:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803448:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80344b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80344f:	7e 4b                	jle    80349c <getint+0x60>
+    return va_arg(*ap, long long);
+  803451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803455:	8b 00                	mov    (%rax),%eax
+  803457:	83 f8 2f             	cmp    $0x2f,%eax
+  80345a:	77 24                	ja     803480 <getint+0x44>
+  80345c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803460:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803468:	8b 00                	mov    (%rax),%eax
+  80346a:	89 c0                	mov    %eax,%eax
+  80346c:	48 01 d0             	add    %rdx,%rax
+  80346f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803473:	8b 12                	mov    (%rdx),%edx
+  803475:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803478:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80347c:	89 0a                	mov    %ecx,(%rdx)
+  80347e:	eb 14                	jmp    803494 <getint+0x58>
+  803480:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803484:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803488:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80348c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803490:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803494:	48 8b 00             	mov    (%rax),%rax
+  803497:	e9 95 00 00 00       	jmp    803531 <getint+0xf5>
+  else if (lflag)
+  80349c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8034a0:	74 48                	je     8034ea <getint+0xae>
+    return va_arg(*ap, long);
+  8034a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a6:	8b 00                	mov    (%rax),%eax
+  8034a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8034ab:	77 24                	ja     8034d1 <getint+0x95>
+  8034ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b9:	8b 00                	mov    (%rax),%eax
+  8034bb:	89 c0                	mov    %eax,%eax
+  8034bd:	48 01 d0             	add    %rdx,%rax
+  8034c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034c4:	8b 12                	mov    (%rdx),%edx
+  8034c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034cd:	89 0a                	mov    %ecx,(%rdx)
+  8034cf:	eb 14                	jmp    8034e5 <getint+0xa9>
+  8034d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034d9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034e1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034e5:	48 8b 00             	mov    (%rax),%rax
+  8034e8:	eb 47                	jmp    803531 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8034ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ee:	8b 00                	mov    (%rax),%eax
+  8034f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8034f3:	77 24                	ja     803519 <getint+0xdd>
+  8034f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034f9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803501:	8b 00                	mov    (%rax),%eax
+  803503:	89 c0                	mov    %eax,%eax
+  803505:	48 01 d0             	add    %rdx,%rax
+  803508:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80350c:	8b 12                	mov    (%rdx),%edx
+  80350e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803511:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803515:	89 0a                	mov    %ecx,(%rdx)
+  803517:	eb 14                	jmp    80352d <getint+0xf1>
+  803519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80351d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803521:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803525:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803529:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80352d:	8b 00                	mov    (%rax),%eax
+  80352f:	48 98                	cltq
+}
+  803531:	c9                   	leave
+  803532:	c3                   	ret
+
+0000000000803533 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  803533:	55                   	push   %rbp
+  803534:	48 89 e5             	mov    %rsp,%rbp
+  803537:	41 54                	push   %r12
+  803539:	53                   	push   %rbx
+  80353a:	48 83 ec 60          	sub    $0x60,%rsp
+  80353e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803542:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803546:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80354a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80354e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803552:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  803556:	48 8b 06             	mov    (%rsi),%rax
+  803559:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80355d:	48 89 01             	mov    %rax,(%rcx)
+  803560:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  803564:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803568:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80356c:	eb 17                	jmp    803585 <vprintfmt+0x52>
+      if (ch == '\0')
+  80356e:	85 db                	test   %ebx,%ebx
+  803570:	0f 84 bf 04 00 00    	je     803a35 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  803576:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80357a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80357e:	48 89 c6             	mov    %rax,%rsi
+  803581:	89 df                	mov    %ebx,%edi
+  803583:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803585:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803589:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80358d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803591:	0f b6 00             	movzbl (%rax),%eax
+  803594:	0f b6 d8             	movzbl %al,%ebx
+  803597:	83 fb 25             	cmp    $0x25,%ebx
+  80359a:	75 d2                	jne    80356e <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80359c:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8035a0:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8035a7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8035ae:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8035b5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8035bc:	eb 04                	jmp    8035c2 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8035be:	90                   	nop
+  8035bf:	eb 01                	jmp    8035c2 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8035c1:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8035c2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035c6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035ca:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8035ce:	0f b6 00             	movzbl (%rax),%eax
+  8035d1:	0f b6 d8             	movzbl %al,%ebx
+  8035d4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8035d7:	83 f8 55             	cmp    $0x55,%eax
+  8035da:	0f 87 22 04 00 00    	ja     803a02 <vprintfmt+0x4cf>
+  8035e0:	89 c0                	mov    %eax,%eax
+  8035e2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8035e9:	00 
+  8035ea:	48 b8 d8 54 80 00 00 	movabs $0x8054d8,%rax
+  8035f1:	00 00 00 
+  8035f4:	48 01 d0             	add    %rdx,%rax
+  8035f7:	48 8b 00             	mov    (%rax),%rax
+  8035fa:	ff e0                	jmp    *%rax
+        padc = '-';
+  8035fc:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803600:	eb c0                	jmp    8035c2 <vprintfmt+0x8f>
+        padc = '0';
+  803602:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803606:	eb ba                	jmp    8035c2 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  803608:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80360f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803612:	89 d0                	mov    %edx,%eax
+  803614:	c1 e0 02             	shl    $0x2,%eax
+  803617:	01 d0                	add    %edx,%eax
+  803619:	01 c0                	add    %eax,%eax
+  80361b:	01 d8                	add    %ebx,%eax
+  80361d:	83 e8 30             	sub    $0x30,%eax
+  803620:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  803623:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803627:	0f b6 00             	movzbl (%rax),%eax
+  80362a:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80362d:	83 fb 2f             	cmp    $0x2f,%ebx
+  803630:	7e 60                	jle    803692 <vprintfmt+0x15f>
+  803632:	83 fb 39             	cmp    $0x39,%ebx
+  803635:	7f 5b                	jg     803692 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  803637:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80363c:	eb d1                	jmp    80360f <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  80363e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803641:	83 f8 2f             	cmp    $0x2f,%eax
+  803644:	77 17                	ja     80365d <vprintfmt+0x12a>
+  803646:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80364a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80364d:	89 d2                	mov    %edx,%edx
+  80364f:	48 01 d0             	add    %rdx,%rax
+  803652:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803655:	83 c2 08             	add    $0x8,%edx
+  803658:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80365b:	eb 0c                	jmp    803669 <vprintfmt+0x136>
+  80365d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803661:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803665:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803669:	8b 00                	mov    (%rax),%eax
+  80366b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  80366e:	eb 23                	jmp    803693 <vprintfmt+0x160>
+        if (width < 0)
+  803670:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803674:	0f 89 44 ff ff ff    	jns    8035be <vprintfmt+0x8b>
+          width = 0;
+  80367a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803681:	e9 38 ff ff ff       	jmp    8035be <vprintfmt+0x8b>
+        altflag = 1;
+  803686:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80368d:	e9 30 ff ff ff       	jmp    8035c2 <vprintfmt+0x8f>
+        goto process_precision;
+  803692:	90                   	nop
+        if (width < 0)
+  803693:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803697:	0f 89 24 ff ff ff    	jns    8035c1 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80369d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8036a0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8036a3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8036aa:	e9 12 ff ff ff       	jmp    8035c1 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8036af:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8036b3:	e9 0a ff ff ff       	jmp    8035c2 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8036b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8036be:	77 17                	ja     8036d7 <vprintfmt+0x1a4>
+  8036c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036c4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036c7:	89 d2                	mov    %edx,%edx
+  8036c9:	48 01 d0             	add    %rdx,%rax
+  8036cc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036cf:	83 c2 08             	add    $0x8,%edx
+  8036d2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036d5:	eb 0c                	jmp    8036e3 <vprintfmt+0x1b0>
+  8036d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036db:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036df:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036e3:	8b 00                	mov    (%rax),%eax
+  8036e5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8036e9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8036ed:	48 89 d6             	mov    %rdx,%rsi
+  8036f0:	89 c7                	mov    %eax,%edi
+  8036f2:	ff d1                	call   *%rcx
+        break;
+  8036f4:	e9 37 03 00 00       	jmp    803a30 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8036f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8036ff:	77 17                	ja     803718 <vprintfmt+0x1e5>
+  803701:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803705:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803708:	89 d2                	mov    %edx,%edx
+  80370a:	48 01 d0             	add    %rdx,%rax
+  80370d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803710:	83 c2 08             	add    $0x8,%edx
+  803713:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803716:	eb 0c                	jmp    803724 <vprintfmt+0x1f1>
+  803718:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80371c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803720:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803724:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  803726:	85 db                	test   %ebx,%ebx
+  803728:	79 02                	jns    80372c <vprintfmt+0x1f9>
+          err = -err;
+  80372a:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80372c:	83 fb 15             	cmp    $0x15,%ebx
+  80372f:	7f 16                	jg     803747 <vprintfmt+0x214>
+  803731:	48 ba 00 54 80 00 00 	movabs $0x805400,%rdx
+  803738:	00 00 00 
+  80373b:	48 63 c3             	movslq %ebx,%rax
+  80373e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  803742:	4d 85 e4             	test   %r12,%r12
+  803745:	75 2e                	jne    803775 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  803747:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80374b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80374f:	89 d9                	mov    %ebx,%ecx
+  803751:	48 ba c1 54 80 00 00 	movabs $0x8054c1,%rdx
+  803758:	00 00 00 
+  80375b:	48 89 c7             	mov    %rax,%rdi
+  80375e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803763:	49 b8 3f 3a 80 00 00 	movabs $0x803a3f,%r8
+  80376a:	00 00 00 
+  80376d:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803770:	e9 bb 02 00 00       	jmp    803a30 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  803775:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803779:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80377d:	4c 89 e1             	mov    %r12,%rcx
+  803780:	48 ba ca 54 80 00 00 	movabs $0x8054ca,%rdx
+  803787:	00 00 00 
+  80378a:	48 89 c7             	mov    %rax,%rdi
+  80378d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803792:	49 b8 3f 3a 80 00 00 	movabs $0x803a3f,%r8
+  803799:	00 00 00 
+  80379c:	41 ff d0             	call   *%r8
+        break;
+  80379f:	e9 8c 02 00 00       	jmp    803a30 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8037a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8037aa:	77 17                	ja     8037c3 <vprintfmt+0x290>
+  8037ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037b0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8037b3:	89 d2                	mov    %edx,%edx
+  8037b5:	48 01 d0             	add    %rdx,%rax
+  8037b8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8037bb:	83 c2 08             	add    $0x8,%edx
+  8037be:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8037c1:	eb 0c                	jmp    8037cf <vprintfmt+0x29c>
+  8037c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8037c7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8037cb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8037cf:	4c 8b 20             	mov    (%rax),%r12
+  8037d2:	4d 85 e4             	test   %r12,%r12
+  8037d5:	75 0a                	jne    8037e1 <vprintfmt+0x2ae>
+          p = "(null)";
+  8037d7:	49 bc cd 54 80 00 00 	movabs $0x8054cd,%r12
+  8037de:	00 00 00 
+        if (width > 0 && padc != '-')
+  8037e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037e5:	7e 78                	jle    80385f <vprintfmt+0x32c>
+  8037e7:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8037eb:	74 72                	je     80385f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037ed:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8037f0:	48 98                	cltq
+  8037f2:	48 89 c6             	mov    %rax,%rsi
+  8037f5:	4c 89 e7             	mov    %r12,%rdi
+  8037f8:	48 b8 4b 41 80 00 00 	movabs $0x80414b,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803807:	eb 17                	jmp    803820 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803809:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80380d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803811:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803815:	48 89 d6             	mov    %rdx,%rsi
+  803818:	89 c7                	mov    %eax,%edi
+  80381a:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80381c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803820:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803824:	7f e3                	jg     803809 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803826:	eb 37                	jmp    80385f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  803828:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80382c:	74 1e                	je     80384c <vprintfmt+0x319>
+  80382e:	83 fb 1f             	cmp    $0x1f,%ebx
+  803831:	7e 05                	jle    803838 <vprintfmt+0x305>
+  803833:	83 fb 7e             	cmp    $0x7e,%ebx
+  803836:	7e 14                	jle    80384c <vprintfmt+0x319>
+            putch('?', putdat);
+  803838:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80383c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803840:	48 89 c6             	mov    %rax,%rsi
+  803843:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803848:	ff d2                	call   *%rdx
+  80384a:	eb 0f                	jmp    80385b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80384c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803850:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803854:	48 89 c6             	mov    %rax,%rsi
+  803857:	89 df                	mov    %ebx,%edi
+  803859:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80385b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80385f:	4c 89 e0             	mov    %r12,%rax
+  803862:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803866:	0f b6 00             	movzbl (%rax),%eax
+  803869:	0f be d8             	movsbl %al,%ebx
+  80386c:	85 db                	test   %ebx,%ebx
+  80386e:	74 28                	je     803898 <vprintfmt+0x365>
+  803870:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803874:	78 b2                	js     803828 <vprintfmt+0x2f5>
+  803876:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80387a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80387e:	79 a8                	jns    803828 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803880:	eb 16                	jmp    803898 <vprintfmt+0x365>
+          putch(' ', putdat);
+  803882:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803886:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80388a:	48 89 c6             	mov    %rax,%rsi
+  80388d:	bf 20 00 00 00       	mov    $0x20,%edi
+  803892:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803894:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803898:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80389c:	7f e4                	jg     803882 <vprintfmt+0x34f>
+        break;
+  80389e:	e9 8d 01 00 00       	jmp    803a30 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8038a3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038a6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038aa:	89 d6                	mov    %edx,%esi
+  8038ac:	48 89 c7             	mov    %rax,%rdi
+  8038af:	48 b8 3c 34 80 00 00 	movabs $0x80343c,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+  8038bb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8038bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c3:	48 85 c0             	test   %rax,%rax
+  8038c6:	79 1d                	jns    8038e5 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8038c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038cc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038d0:	48 89 c6             	mov    %rax,%rsi
+  8038d3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8038d8:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8038da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038de:	48 f7 d8             	neg    %rax
+  8038e1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8038e5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038ec:	e9 d2 00 00 00       	jmp    8039c3 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  8038f1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038f4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038f8:	89 d6                	mov    %edx,%esi
+  8038fa:	48 89 c7             	mov    %rax,%rdi
+  8038fd:	48 b8 45 33 80 00 00 	movabs $0x803345,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+  803909:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80390d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803914:	e9 aa 00 00 00       	jmp    8039c3 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  803919:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80391c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803920:	89 d6                	mov    %edx,%esi
+  803922:	48 89 c7             	mov    %rax,%rdi
+  803925:	48 b8 45 33 80 00 00 	movabs $0x803345,%rax
+  80392c:	00 00 00 
+  80392f:	ff d0                	call   *%rax
+  803931:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  803935:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80393c:	e9 82 00 00 00       	jmp    8039c3 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  803941:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803945:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803949:	48 89 c6             	mov    %rax,%rsi
+  80394c:	bf 30 00 00 00       	mov    $0x30,%edi
+  803951:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  803953:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803957:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80395b:	48 89 c6             	mov    %rax,%rsi
+  80395e:	bf 78 00 00 00       	mov    $0x78,%edi
+  803963:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  803965:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803968:	83 f8 2f             	cmp    $0x2f,%eax
+  80396b:	77 17                	ja     803984 <vprintfmt+0x451>
+  80396d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803971:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803974:	89 d2                	mov    %edx,%edx
+  803976:	48 01 d0             	add    %rdx,%rax
+  803979:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80397c:	83 c2 08             	add    $0x8,%edx
+  80397f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803982:	eb 0c                	jmp    803990 <vprintfmt+0x45d>
+  803984:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803988:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80398c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803990:	48 8b 00             	mov    (%rax),%rax
+  803993:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803997:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80399e:	eb 23                	jmp    8039c3 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8039a0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8039a3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8039a7:	89 d6                	mov    %edx,%esi
+  8039a9:	48 89 c7             	mov    %rax,%rdi
+  8039ac:	48 b8 45 33 80 00 00 	movabs $0x803345,%rax
+  8039b3:	00 00 00 
+  8039b6:	ff d0                	call   *%rax
+  8039b8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8039bc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8039c3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8039c8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8039cb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8039ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8039d2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8039d6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039da:	45 89 c1             	mov    %r8d,%r9d
+  8039dd:	41 89 f8             	mov    %edi,%r8d
+  8039e0:	48 89 c7             	mov    %rax,%rdi
+  8039e3:	48 b8 8d 32 80 00 00 	movabs $0x80328d,%rax
+  8039ea:	00 00 00 
+  8039ed:	ff d0                	call   *%rax
+        break;
+  8039ef:	eb 3f                	jmp    803a30 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  8039f1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039f5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8039f9:	48 89 c6             	mov    %rax,%rsi
+  8039fc:	89 df                	mov    %ebx,%edi
+  8039fe:	ff d2                	call   *%rdx
+        break;
+  803a00:	eb 2e                	jmp    803a30 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803a02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803a06:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803a0a:	48 89 c6             	mov    %rax,%rsi
+  803a0d:	bf 25 00 00 00       	mov    $0x25,%edi
+  803a12:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803a14:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803a19:	eb 05                	jmp    803a20 <vprintfmt+0x4ed>
+  803a1b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803a20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803a24:	48 83 e8 01          	sub    $0x1,%rax
+  803a28:	0f b6 00             	movzbl (%rax),%eax
+  803a2b:	3c 25                	cmp    $0x25,%al
+  803a2d:	75 ec                	jne    803a1b <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  803a2f:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803a30:	e9 50 fb ff ff       	jmp    803585 <vprintfmt+0x52>
+        return;
+  803a35:	90                   	nop
+    }
+  }
+}
+  803a36:	48 83 c4 60          	add    $0x60,%rsp
+  803a3a:	5b                   	pop    %rbx
+  803a3b:	41 5c                	pop    %r12
+  803a3d:	5d                   	pop    %rbp
+  803a3e:	c3                   	ret
+
+0000000000803a3f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803a3f:	55                   	push   %rbp
+  803a40:	48 89 e5             	mov    %rsp,%rbp
+  803a43:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803a4a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803a51:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  803a58:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803a5f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803a66:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803a6d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a74:	84 c0                	test   %al,%al
+  803a76:	74 20                	je     803a98 <printfmt+0x59>
+  803a78:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a7c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a80:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a84:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a88:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a8c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a90:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a94:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a98:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a9f:	00 00 00 
+  803aa2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803aa9:	00 00 00 
+  803aac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ab0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803ab7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803abe:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803ac5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803acc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803ad3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803ada:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803ae1:	48 89 c7             	mov    %rax,%rdi
+  803ae4:	48 b8 33 35 80 00 00 	movabs $0x803533,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803af0:	90                   	nop
+  803af1:	c9                   	leave
+  803af2:	c3                   	ret
+
+0000000000803af3 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803af3:	55                   	push   %rbp
+  803af4:	48 89 e5             	mov    %rsp,%rbp
+  803af7:	48 83 ec 10          	sub    $0x10,%rsp
+  803afb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803afe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b06:	8b 40 10             	mov    0x10(%rax),%eax
+  803b09:	8d 50 01             	lea    0x1(%rax),%edx
+  803b0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b10:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803b13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b17:	48 8b 10             	mov    (%rax),%rdx
+  803b1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b22:	48 39 c2             	cmp    %rax,%rdx
+  803b25:	73 17                	jae    803b3e <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b2b:	48 8b 00             	mov    (%rax),%rax
+  803b2e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803b32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b36:	48 89 0a             	mov    %rcx,(%rdx)
+  803b39:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b3c:	88 10                	mov    %dl,(%rax)
+}
+  803b3e:	90                   	nop
+  803b3f:	c9                   	leave
+  803b40:	c3                   	ret
+
+0000000000803b41 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803b41:	55                   	push   %rbp
+  803b42:	48 89 e5             	mov    %rsp,%rbp
+  803b45:	48 83 ec 40          	sub    $0x40,%rsp
+  803b49:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b4d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803b50:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803b54:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803b58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b5c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803b60:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803b63:	48 98                	cltq
+  803b65:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803b69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b6d:	48 01 d0             	add    %rdx,%rax
+  803b70:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b74:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b7b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b80:	74 06                	je     803b88 <vsnprintf+0x47>
+  803b82:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b86:	7f 07                	jg     803b8f <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b8d:	eb 32                	jmp    803bc1 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b8f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b93:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b97:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b9b:	48 89 c6             	mov    %rax,%rsi
+  803b9e:	48 b8 f3 3a 80 00 00 	movabs $0x803af3,%rax
+  803ba5:	00 00 00 
+  803ba8:	48 89 c7             	mov    %rax,%rdi
+  803bab:	48 b8 33 35 80 00 00 	movabs $0x803533,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803bb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bbb:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803bbe:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803bc1:	c9                   	leave
+  803bc2:	c3                   	ret
+
+0000000000803bc3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803bc3:	55                   	push   %rbp
+  803bc4:	48 89 e5             	mov    %rsp,%rbp
+  803bc7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803bce:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803bd5:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803bdb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803be2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803be9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803bf0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803bf7:	84 c0                	test   %al,%al
+  803bf9:	74 20                	je     803c1b <snprintf+0x58>
+  803bfb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803bff:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803c03:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803c07:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803c0b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803c0f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803c13:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803c17:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803c1b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803c22:	00 00 00 
+  803c25:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803c2c:	00 00 00 
+  803c2f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c33:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803c3a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803c41:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803c48:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803c4f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803c56:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803c5c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803c63:	48 89 c7             	mov    %rax,%rdi
+  803c66:	48 b8 41 3b 80 00 00 	movabs $0x803b41,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c78:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c7e:	c9                   	leave
+  803c7f:	c3                   	ret
+
+0000000000803c80 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c80:	55                   	push   %rbp
+  803c81:	48 89 e5             	mov    %rsp,%rbp
+  803c84:	53                   	push   %rbx
+  803c85:	48 83 ec 38          	sub    $0x38,%rsp
+  803c89:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c8c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c90:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c94:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c98:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c9c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ca4:	89 d1                	mov    %edx,%ecx
+  803ca6:	0f a2                	cpuid
+  803ca8:	89 de                	mov    %ebx,%esi
+  803caa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803cad:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803cb0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803cb3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803cb6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803cbb:	74 09                	je     803cc6 <cpuid+0x46>
+}
+  803cbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cc1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803cc4:	89 10                	mov    %edx,(%rax)
+
+  803cc6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803ccb:	74 09                	je     803cd6 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803ccd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cd1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803cd4:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803cd6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803cdb:	74 09                	je     803ce6 <cpuid+0x66>
+char *
+  803cdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ce1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803ce4:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803ce6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803ceb:	74 09                	je     803cf6 <cpuid+0x76>
+  for (; *s; s++)
+  803ced:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803cf4:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803cf6:	90                   	nop
+  803cf7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cfb:	c9                   	leave
+  803cfc:	c3                   	ret
+
+0000000000803cfd <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803cfd:	55                   	push   %rbp
+  803cfe:	48 89 e5             	mov    %rsp,%rbp
+  803d01:	48 83 ec 18          	sub    $0x18,%rsp
+  803d05:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803d08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d0b:	89 c1                	mov    %eax,%ecx
+  803d0d:	0f 01 d0             	xgetbv
+  803d10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d13:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803d16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d19:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803d1c:	48 c1 e2 20          	shl    $0x20,%rdx
+  803d20:	48 09 d0             	or     %rdx,%rax
+#else
+  803d23:	c9                   	leave
+  803d24:	c3                   	ret
+
+0000000000803d25 <string_cpu>:
+string_cpu(void) {
+  803d25:	55                   	push   %rbp
+  803d26:	48 89 e5             	mov    %rsp,%rbp
+  803d29:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803d2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803d34:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803d3b:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803d42:	00 00 00 
+  803d45:	8b 00                	mov    (%rax),%eax
+  803d47:	85 c0                	test   %eax,%eax
+  803d49:	78 11                	js     803d5c <string_cpu+0x37>
+    return string_features;
+  803d4b:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803d52:	00 00 00 
+  803d55:	8b 00                	mov    (%rax),%eax
+  803d57:	e9 df 00 00 00       	jmp    803e3b <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803d5c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803d60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d70:	48 89 c6             	mov    %rax,%rsi
+  803d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d78:	48 b8 80 3c 80 00 00 	movabs $0x803c80,%rax
+  803d7f:	00 00 00 
+  803d82:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d84:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d87:	83 f8 06             	cmp    $0x6,%eax
+  803d8a:	76 28                	jbe    803db4 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d8c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d9b:	48 89 c2             	mov    %rax,%rdx
+  803d9e:	be 00 00 00 00       	mov    $0x0,%esi
+  803da3:	bf 07 00 00 00       	mov    $0x7,%edi
+  803da8:	48 b8 80 3c 80 00 00 	movabs $0x803c80,%rax
+  803daf:	00 00 00 
+  803db2:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803db4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803db7:	25 00 02 00 00       	and    $0x200,%eax
+  803dbc:	85 c0                	test   %eax,%eax
+  803dbe:	74 04                	je     803dc4 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803dc0:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803dc4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803dc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803dce:	48 89 c1             	mov    %rax,%rcx
+  803dd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd6:	be 00 00 00 00       	mov    $0x0,%esi
+  803ddb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803de0:	48 b8 80 3c 80 00 00 	movabs $0x803c80,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803dec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803def:	83 e0 20             	and    $0x20,%eax
+  803df2:	85 c0                	test   %eax,%eax
+  803df4:	74 2a                	je     803e20 <string_cpu+0xfb>
+  803df6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803df9:	25 00 00 00 08       	and    $0x8000000,%eax
+  803dfe:	85 c0                	test   %eax,%eax
+  803e00:	74 1e                	je     803e20 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e07:	48 b8 fd 3c 80 00 00 	movabs $0x803cfd,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  803e13:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803e16:	48 83 f8 06          	cmp    $0x6,%rax
+  803e1a:	75 04                	jne    803e20 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803e1c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803e20:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803e27:	00 00 00 
+  803e2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e2d:	89 02                	mov    %eax,(%rdx)
+  803e2f:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803e36:	00 00 00 
+  803e39:	8b 00                	mov    (%rax),%eax
+}
+  803e3b:	c9                   	leave
+  803e3c:	c3                   	ret
+
+0000000000803e3d <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803e3d:	55                   	push   %rbp
+  803e3e:	48 89 e5             	mov    %rsp,%rbp
+  803e41:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e45:	48 83 ec 60          	sub    $0x60,%rsp
+  803e49:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803e4e:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e53:	83 e0 1f             	and    $0x1f,%eax
+  803e56:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803e5a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e5e:	48 f7 d8             	neg    %rax
+  803e61:	48 89 c2             	mov    %rax,%rdx
+  803e64:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e69:	48 01 d0             	add    %rdx,%rax
+  803e6c:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e71:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e75:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e7b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e80:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e84:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e8a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e8e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e92:	89 c2                	mov    %eax,%edx
+  803e94:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e98:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e9d:	89 c1                	mov    %eax,%ecx
+  803e9f:	d3 e6                	shl    %cl,%esi
+  803ea1:	89 f0                	mov    %esi,%eax
+  803ea3:	21 d0                	and    %edx,%eax
+  803ea5:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803ea9:	eb 21                	jmp    803ecc <strlen_avx2+0x8f>
+    p += 32;
+  803eab:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803eb1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803eb6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803eba:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803ec0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803ec4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803ec8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803ecc:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803ed1:	74 d8                	je     803eab <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803ed3:	31 c0                	xor    %eax,%eax
+  803ed5:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803edb:	48 63 d0             	movslq %eax,%rdx
+  803ede:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803ee3:	48 01 d0             	add    %rdx,%rax
+  803ee6:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803eeb:	c9                   	leave
+  803eec:	c3                   	ret
+
+0000000000803eed <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803eed:	55                   	push   %rbp
+  803eee:	48 89 e5             	mov    %rsp,%rbp
+  803ef1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803ef5:	48 83 ec 40          	sub    $0x40,%rsp
+  803ef9:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803efe:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803f03:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f08:	eb 77                	jmp    803f81 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803f0a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f0f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f13:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f17:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f1c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f20:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803f24:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803f28:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803f2c:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803f31:	74 3c                	je     803f6f <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803f33:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803f37:	f7 d0                	not    %eax
+  803f39:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803f3d:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803f41:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803f45:	48 63 d0             	movslq %eax,%rdx
+  803f48:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f4d:	48 01 d0             	add    %rdx,%rax
+  803f50:	0f b6 00             	movzbl (%rax),%eax
+  803f53:	0f b6 c0             	movzbl %al,%eax
+  803f56:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803f5a:	48 63 ca             	movslq %edx,%rcx
+  803f5d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803f62:	48 01 ca             	add    %rcx,%rdx
+  803f65:	0f b6 12             	movzbl (%rdx),%edx
+  803f68:	0f b6 d2             	movzbl %dl,%edx
+  803f6b:	29 d0                	sub    %edx,%eax
+  803f6d:	eb 6b                	jmp    803fda <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f6f:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f75:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f7b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f81:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f87:	77 81                	ja     803f0a <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f89:	eb 42                	jmp    803fcd <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f8b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f90:	0f b6 10             	movzbl (%rax),%edx
+  803f93:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f98:	0f b6 00             	movzbl (%rax),%eax
+  803f9b:	38 c2                	cmp    %al,%dl
+  803f9d:	74 1c                	je     803fbb <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f9f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fa4:	0f b6 00             	movzbl (%rax),%eax
+  803fa7:	0f b6 c8             	movzbl %al,%ecx
+  803faa:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803faf:	0f b6 00             	movzbl (%rax),%eax
+  803fb2:	0f b6 d0             	movzbl %al,%edx
+  803fb5:	89 c8                	mov    %ecx,%eax
+  803fb7:	29 d0                	sub    %edx,%eax
+  803fb9:	eb 1f                	jmp    803fda <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803fbb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fc1:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803fc7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fcd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fd3:	75 b6                	jne    803f8b <memcmp_avx2+0x9e>
+  return 0;
+  803fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+
+0000000000803fdc <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+  803fe0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803fe4:	48 83 ec 60          	sub    $0x60,%rsp
+  803fe8:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803fed:	89 f0                	mov    %esi,%eax
+  803fef:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803ff4:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803ff8:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803ffd:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  804001:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  804006:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80400c:	eb 47                	jmp    804055 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80400e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804013:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  804017:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80401b:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  804021:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  804025:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  804029:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80402d:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  804032:	74 15                	je     804049 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  804034:	31 c0                	xor    %eax,%eax
+  804036:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80403c:	48 63 d0             	movslq %eax,%rdx
+  80403f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804044:	48 01 d0             	add    %rdx,%rax
+  804047:	eb 3d                	jmp    804086 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  804049:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80404f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  804055:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80405b:	77 b1                	ja     80400e <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80405d:	eb 0c                	jmp    80406b <memfind_avx2+0x8f>
+  80405f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  804065:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80406b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804071:	74 0e                	je     804081 <memfind_avx2+0xa5>
+  804073:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  804078:	0f b6 00             	movzbl (%rax),%eax
+  80407b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80407f:	75 de                	jne    80405f <memfind_avx2+0x83>
+  return s;
+  804081:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804086:	c9                   	leave
+  804087:	c3                   	ret
+
+0000000000804088 <strlen>:
+strlen(const char *s) {
+  804088:	55                   	push   %rbp
+  804089:	48 89 e5             	mov    %rsp,%rbp
+  80408c:	48 83 ec 40          	sub    $0x40,%rsp
+  804090:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804094:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804098:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80409c:	48 b8 25 3d 80 00 00 	movabs $0x803d25,%rax
+  8040a3:	00 00 00 
+  8040a6:	ff d0                	call   *%rax
+  8040a8:	83 e0 02             	and    $0x2,%eax
+  8040ab:	85 c0                	test   %eax,%eax
+  8040ad:	74 18                	je     8040c7 <strlen+0x3f>
+    return strlen_avx2(s);
+  8040af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b3:	48 89 c7             	mov    %rax,%rdi
+  8040b6:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  8040bd:	00 00 00 
+  8040c0:	ff d0                	call   *%rax
+  8040c2:	e9 82 00 00 00       	jmp    804149 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8040c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040cb:	83 e0 0f             	and    $0xf,%eax
+  8040ce:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8040d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040d4:	48 f7 d8             	neg    %rax
+  8040d7:	48 89 c2             	mov    %rax,%rdx
+  8040da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040de:	48 01 d0             	add    %rdx,%rax
+  8040e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8040e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040e9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040ed:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040f2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040f6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040fa:	89 c2                	mov    %eax,%edx
+  8040fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040ff:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804104:	89 c1                	mov    %eax,%ecx
+  804106:	d3 e6                	shl    %cl,%esi
+  804108:	89 f0                	mov    %esi,%eax
+  80410a:	21 d0                	and    %edx,%eax
+  80410c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80410f:	eb 1d                	jmp    80412e <strlen+0xa6>
+    p += 16;
+  804111:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804116:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80411a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80411e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804123:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804127:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80412b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80412e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804132:	74 dd                	je     804111 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  804134:	31 c0                	xor    %eax,%eax
+  804136:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80413b:	48 63 d0             	movslq %eax,%rdx
+  80413e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804142:	48 01 d0             	add    %rdx,%rax
+  804145:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  804149:	c9                   	leave
+  80414a:	c3                   	ret
+
+000000000080414b <strnlen>:
+strnlen(const char *s, size_t size) {
+  80414b:	55                   	push   %rbp
+  80414c:	48 89 e5             	mov    %rsp,%rbp
+  80414f:	48 83 ec 20          	sub    $0x20,%rsp
+  804153:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804157:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80415b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804162:	eb 0e                	jmp    804172 <strnlen+0x27>
+    n++;
+  804164:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804168:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80416d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804172:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804177:	74 0b                	je     804184 <strnlen+0x39>
+  804179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80417d:	0f b6 00             	movzbl (%rax),%eax
+  804180:	84 c0                	test   %al,%al
+  804182:	75 e0                	jne    804164 <strnlen+0x19>
+  return n;
+  804184:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804187:	c9                   	leave
+  804188:	c3                   	ret
+
+0000000000804189 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804189:	55                   	push   %rbp
+  80418a:	48 89 e5             	mov    %rsp,%rbp
+  80418d:	48 83 ec 20          	sub    $0x20,%rsp
+  804191:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804195:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804199:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80419d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8041a1:	90                   	nop
+  8041a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041a6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8041aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8041ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8041b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041ba:	0f b6 12             	movzbl (%rdx),%edx
+  8041bd:	88 10                	mov    %dl,(%rax)
+  8041bf:	0f b6 00             	movzbl (%rax),%eax
+  8041c2:	84 c0                	test   %al,%al
+  8041c4:	75 dc                	jne    8041a2 <strcpy+0x19>
+  return ret;
+  8041c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8041ca:	c9                   	leave
+  8041cb:	c3                   	ret
+
+00000000008041cc <strcat>:
+strcat(char *dst, const char *src) {
+  8041cc:	55                   	push   %rbp
+  8041cd:	48 89 e5             	mov    %rsp,%rbp
+  8041d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8041dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e0:	48 89 c7             	mov    %rax,%rdi
+  8041e3:	48 b8 88 40 80 00 00 	movabs $0x804088,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+  8041ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8041f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041f5:	48 63 d0             	movslq %eax,%rdx
+  8041f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041fc:	48 01 c2             	add    %rax,%rdx
+  8041ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804203:	48 89 c6             	mov    %rax,%rsi
+  804206:	48 89 d7             	mov    %rdx,%rdi
+  804209:	48 b8 89 41 80 00 00 	movabs $0x804189,%rax
+  804210:	00 00 00 
+  804213:	ff d0                	call   *%rax
+  return dst;
+  804215:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804219:	c9                   	leave
+  80421a:	c3                   	ret
+
+000000000080421b <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80421b:	55                   	push   %rbp
+  80421c:	48 89 e5             	mov    %rsp,%rbp
+  80421f:	48 83 ec 28          	sub    $0x28,%rsp
+  804223:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804227:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80422b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80422f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804233:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  804237:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80423e:	00 
+  80423f:	eb 2a                	jmp    80426b <strncpy+0x50>
+    *dst++ = *src;
+  804241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804245:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804249:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80424d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804251:	0f b6 12             	movzbl (%rdx),%edx
+  804254:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  804256:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80425a:	0f b6 00             	movzbl (%rax),%eax
+  80425d:	84 c0                	test   %al,%al
+  80425f:	74 05                	je     804266 <strncpy+0x4b>
+      src++;
+  804261:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  804266:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80426b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80426f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804273:	72 cc                	jb     804241 <strncpy+0x26>
+  return ret;
+  804275:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804279:	c9                   	leave
+  80427a:	c3                   	ret
+
+000000000080427b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80427b:	55                   	push   %rbp
+  80427c:	48 89 e5             	mov    %rsp,%rbp
+  80427f:	48 83 ec 28          	sub    $0x28,%rsp
+  804283:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804287:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80428b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80428f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804293:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804297:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80429c:	74 3d                	je     8042db <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80429e:	eb 1d                	jmp    8042bd <strlcpy+0x42>
+      *dst++ = *src++;
+  8042a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8042a4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8042ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042b0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8042b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042b8:	0f b6 12             	movzbl (%rdx),%edx
+  8042bb:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8042bd:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8042c2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8042c7:	74 0b                	je     8042d4 <strlcpy+0x59>
+  8042c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042cd:	0f b6 00             	movzbl (%rax),%eax
+  8042d0:	84 c0                	test   %al,%al
+  8042d2:	75 cc                	jne    8042a0 <strlcpy+0x25>
+    *dst = '\0';
+  8042d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d8:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8042db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042df:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8042e3:	c9                   	leave
+  8042e4:	c3                   	ret
+
+00000000008042e5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8042e5:	55                   	push   %rbp
+  8042e6:	48 89 e5             	mov    %rsp,%rbp
+  8042e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8042ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8042f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042fd:	48 89 c7             	mov    %rax,%rdi
+  804300:	48 b8 88 40 80 00 00 	movabs $0x804088,%rax
+  804307:	00 00 00 
+  80430a:	ff d0                	call   *%rax
+  80430c:	48 98                	cltq
+  80430e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804312:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804316:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80431a:	48 89 d6             	mov    %rdx,%rsi
+  80431d:	48 89 c7             	mov    %rax,%rdi
+  804320:	48 b8 4b 41 80 00 00 	movabs $0x80414b,%rax
+  804327:	00 00 00 
+  80432a:	ff d0                	call   *%rax
+  80432c:	48 98                	cltq
+  80432e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  804332:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804336:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80433a:	75 10                	jne    80434c <strlcat+0x67>
+    return maxlen + srclen;
+  80433c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804344:	48 01 d0             	add    %rdx,%rax
+  804347:	e9 86 00 00 00       	jmp    8043d2 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80434c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804350:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  804354:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804358:	73 2b                	jae    804385 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80435a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804362:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804366:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80436a:	48 01 c1             	add    %rax,%rcx
+  80436d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804371:	48 89 c6             	mov    %rax,%rsi
+  804374:	48 89 cf             	mov    %rcx,%rdi
+  804377:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  80437e:	00 00 00 
+  804381:	ff d0                	call   *%rax
+  804383:	eb 42                	jmp    8043c7 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804385:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804389:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80438d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804395:	48 01 c1             	add    %rax,%rcx
+  804398:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80439c:	48 89 c6             	mov    %rax,%rsi
+  80439f:	48 89 cf             	mov    %rcx,%rdi
+  8043a2:	48 b8 d2 48 80 00 00 	movabs $0x8048d2,%rax
+  8043a9:	00 00 00 
+  8043ac:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8043ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043b6:	48 01 d0             	add    %rdx,%rax
+  8043b9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8043bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043c1:	48 01 d0             	add    %rdx,%rax
+  8043c4:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8043c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043cf:	48 01 d0             	add    %rdx,%rax
+}
+  8043d2:	c9                   	leave
+  8043d3:	c3                   	ret
+
+00000000008043d4 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8043d4:	55                   	push   %rbp
+  8043d5:	48 89 e5             	mov    %rsp,%rbp
+  8043d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8043dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8043e4:	eb 0a                	jmp    8043f0 <strcmp+0x1c>
+    p++, q++;
+  8043e6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043eb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8043f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f4:	0f b6 00             	movzbl (%rax),%eax
+  8043f7:	84 c0                	test   %al,%al
+  8043f9:	74 12                	je     80440d <strcmp+0x39>
+  8043fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ff:	0f b6 10             	movzbl (%rax),%edx
+  804402:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804406:	0f b6 00             	movzbl (%rax),%eax
+  804409:	38 c2                	cmp    %al,%dl
+  80440b:	74 d9                	je     8043e6 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80440d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804411:	0f b6 00             	movzbl (%rax),%eax
+  804414:	0f b6 d0             	movzbl %al,%edx
+  804417:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441b:	0f b6 00             	movzbl (%rax),%eax
+  80441e:	0f b6 c0             	movzbl %al,%eax
+  804421:	29 c2                	sub    %eax,%edx
+  804423:	89 d0                	mov    %edx,%eax
+}
+  804425:	c9                   	leave
+  804426:	c3                   	ret
+
+0000000000804427 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  804427:	55                   	push   %rbp
+  804428:	48 89 e5             	mov    %rsp,%rbp
+  80442b:	48 83 ec 18          	sub    $0x18,%rsp
+  80442f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804433:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804437:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80443b:	eb 0f                	jmp    80444c <strncmp+0x25>
+    n--, p++, q++;
+  80443d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  804442:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804447:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80444c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804451:	74 1d                	je     804470 <strncmp+0x49>
+  804453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804457:	0f b6 00             	movzbl (%rax),%eax
+  80445a:	84 c0                	test   %al,%al
+  80445c:	74 12                	je     804470 <strncmp+0x49>
+  80445e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804462:	0f b6 10             	movzbl (%rax),%edx
+  804465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804469:	0f b6 00             	movzbl (%rax),%eax
+  80446c:	38 c2                	cmp    %al,%dl
+  80446e:	74 cd                	je     80443d <strncmp+0x16>
+  if (n == 0)
+  804470:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804475:	75 07                	jne    80447e <strncmp+0x57>
+    return 0;
+  804477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80447c:	eb 16                	jmp    804494 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80447e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804482:	0f b6 00             	movzbl (%rax),%eax
+  804485:	0f b6 d0             	movzbl %al,%edx
+  804488:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80448c:	0f b6 00             	movzbl (%rax),%eax
+  80448f:	0f b6 c0             	movzbl %al,%eax
+  804492:	29 c2                	sub    %eax,%edx
+}
+  804494:	89 d0                	mov    %edx,%eax
+  804496:	c9                   	leave
+  804497:	c3                   	ret
+
+0000000000804498 <strchr>:
+strchr(const char *s, char c) {
+  804498:	55                   	push   %rbp
+  804499:	48 89 e5             	mov    %rsp,%rbp
+  80449c:	48 83 ec 60          	sub    $0x60,%rsp
+  8044a0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8044a4:	89 f0                	mov    %esi,%eax
+  8044a6:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8044a9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044ad:	83 e0 0f             	and    $0xf,%eax
+  8044b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8044b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b6:	48 f7 d8             	neg    %rax
+  8044b9:	48 89 c2             	mov    %rax,%rdx
+  8044bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044c0:	48 01 d0             	add    %rdx,%rax
+  8044c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8044c7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8044cb:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8044cf:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8044d3:	66 0f 6e c0          	movd   %eax,%xmm0
+  8044d7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8044db:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8044df:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8044e4:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8044e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044ec:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044f0:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8044f4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044f9:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044fe:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804502:	89 c2                	mov    %eax,%edx
+  804504:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804509:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80450e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804512:	09 c2                	or     %eax,%edx
+  804514:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804517:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80451c:	89 c1                	mov    %eax,%ecx
+  80451e:	d3 e6                	shl    %cl,%esi
+  804520:	89 f0                	mov    %esi,%eax
+  804522:	21 d0                	and    %edx,%eax
+  804524:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804527:	eb 34                	jmp    80455d <strchr+0xc5>
+    p += 16;
+  804529:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80452e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804532:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804536:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80453a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80453f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804544:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804548:	89 c2                	mov    %eax,%edx
+  80454a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80454f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804554:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804558:	09 d0                	or     %edx,%eax
+  80455a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80455d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804561:	74 c6                	je     804529 <strchr+0x91>
+  p += __builtin_ctz(m);
+  804563:	31 c0                	xor    %eax,%eax
+  804565:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80456a:	48 98                	cltq
+  80456c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  804570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804574:	0f b6 00             	movzbl (%rax),%eax
+  804577:	84 c0                	test   %al,%al
+  804579:	74 06                	je     804581 <strchr+0xe9>
+  80457b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80457f:	eb 05                	jmp    804586 <strchr+0xee>
+  804581:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804586:	c9                   	leave
+  804587:	c3                   	ret
+
+0000000000804588 <strfind>:
+strfind(const char *s, char c) {
+  804588:	55                   	push   %rbp
+  804589:	48 89 e5             	mov    %rsp,%rbp
+  80458c:	48 83 ec 10          	sub    $0x10,%rsp
+  804590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804594:	89 f0                	mov    %esi,%eax
+  804596:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804599:	eb 11                	jmp    8045ac <strfind+0x24>
+    if (*s == c)
+  80459b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80459f:	0f b6 00             	movzbl (%rax),%eax
+  8045a2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8045a5:	74 12                	je     8045b9 <strfind+0x31>
+  for (; *s; s++)
+  8045a7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8045ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045b0:	0f b6 00             	movzbl (%rax),%eax
+  8045b3:	84 c0                	test   %al,%al
+  8045b5:	75 e4                	jne    80459b <strfind+0x13>
+  8045b7:	eb 01                	jmp    8045ba <strfind+0x32>
+      break;
+  8045b9:	90                   	nop
+  return (char *)s;
+  8045ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8045be:	c9                   	leave
+  8045bf:	c3                   	ret
+
+00000000008045c0 <memset>:
+memset(void *v, int c, size_t n) {
+  8045c0:	55                   	push   %rbp
+  8045c1:	48 89 e5             	mov    %rsp,%rbp
+  8045c4:	48 83 ec 38          	sub    $0x38,%rsp
+  8045c8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8045cc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8045cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8045d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8045db:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8045e0:	76 41                	jbe    804623 <memset+0x63>
+  8045e2:	48 b8 25 3d 80 00 00 	movabs $0x803d25,%rax
+  8045e9:	00 00 00 
+  8045ec:	ff d0                	call   *%rax
+  8045ee:	83 e0 01             	and    $0x1,%eax
+  8045f1:	85 c0                	test   %eax,%eax
+  8045f3:	74 2e                	je     804623 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8045f5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045f8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804600:	48 89 ce             	mov    %rcx,%rsi
+  804603:	48 89 f7             	mov    %rsi,%rdi
+  804606:	48 89 d1             	mov    %rdx,%rcx
+  804609:	fc                   	cld
+  80460a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80460c:	48 89 ca             	mov    %rcx,%rdx
+  80460f:	48 89 fe             	mov    %rdi,%rsi
+  804612:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804616:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80461a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80461e:	e9 a7 00 00 00       	jmp    8046ca <memset+0x10a>
+  if (n >= 8) {
+  804623:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804628:	0f 86 87 00 00 00    	jbe    8046b5 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  80462e:	eb 16                	jmp    804646 <memset+0x86>
+      *p++ = c;
+  804630:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804634:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804638:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80463c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80463f:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  804641:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804646:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80464a:	83 e0 07             	and    $0x7,%eax
+  80464d:	48 85 c0             	test   %rax,%rax
+  804650:	75 de                	jne    804630 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  804652:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804655:	0f b6 c0             	movzbl %al,%eax
+  804658:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80465f:	01 01 01 
+  804662:	48 0f af c2          	imul   %rdx,%rax
+  804666:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80466a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80466e:	48 c1 e8 03          	shr    $0x3,%rax
+  804672:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  804676:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80467a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80467e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804682:	48 89 ce             	mov    %rcx,%rsi
+  804685:	48 89 f7             	mov    %rsi,%rdi
+  804688:	48 89 d1             	mov    %rdx,%rcx
+  80468b:	fc                   	cld
+  80468c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80468f:	48 89 ca             	mov    %rcx,%rdx
+  804692:	48 89 fe             	mov    %rdi,%rsi
+  804695:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804699:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80469d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8046a2:	eb 11                	jmp    8046b5 <memset+0xf5>
+    *p++ = c;
+  8046a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8046ac:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8046b0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8046b3:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8046b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046b9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8046c1:	48 85 c0             	test   %rax,%rax
+  8046c4:	75 de                	jne    8046a4 <memset+0xe4>
+  return v;
+  8046c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8046ca:	c9                   	leave
+  8046cb:	c3                   	ret
+
+00000000008046cc <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8046cc:	55                   	push   %rbp
+  8046cd:	48 89 e5             	mov    %rsp,%rbp
+  8046d0:	48 83 ec 38          	sub    $0x38,%rsp
+  8046d4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8046d8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8046e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8046e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8046f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046f4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8046f8:	0f 83 da 00 00 00    	jae    8047d8 <memmove+0x10c>
+  8046fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804702:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804706:	48 01 d0             	add    %rdx,%rax
+  804709:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80470d:	0f 83 c5 00 00 00    	jae    8047d8 <memmove+0x10c>
+    s += n;
+  804713:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804717:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80471b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80471f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  804723:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804728:	0f 86 94 00 00 00    	jbe    8047c2 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80472e:	eb 1c                	jmp    80474c <memmove+0x80>
+        *--d = *--s;
+  804730:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804735:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80473a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80473e:	0f b6 10             	movzbl (%rax),%edx
+  804741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804745:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  804747:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80474c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804750:	83 e0 07             	and    $0x7,%eax
+  804753:	48 85 c0             	test   %rax,%rax
+  804756:	75 d8                	jne    804730 <memmove+0x64>
+      nq = n / 8;
+  804758:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80475c:	48 c1 e8 03          	shr    $0x3,%rax
+  804760:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804764:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  804769:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  80476e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  804773:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804777:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80477b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80477f:	48 89 cf             	mov    %rcx,%rdi
+  804782:	48 89 d6             	mov    %rdx,%rsi
+  804785:	48 89 c1             	mov    %rax,%rcx
+  804788:	fd                   	std
+  804789:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80478c:	fc                   	cld
+  80478d:	48 89 c8             	mov    %rcx,%rax
+  804790:	48 89 f2             	mov    %rsi,%rdx
+  804793:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804797:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80479b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80479f:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8047a4:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8047a9:	eb 17                	jmp    8047c2 <memmove+0xf6>
+      *--d = *--s;
+  8047ab:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8047b0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8047b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047b9:	0f b6 10             	movzbl (%rax),%edx
+  8047bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047c0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8047c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047c6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8047ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8047ce:	48 85 c0             	test   %rax,%rax
+  8047d1:	75 d8                	jne    8047ab <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8047d3:	e9 f4 00 00 00       	jmp    8048cc <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8047d8:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8047dd:	76 46                	jbe    804825 <memmove+0x159>
+  8047df:	48 b8 25 3d 80 00 00 	movabs $0x803d25,%rax
+  8047e6:	00 00 00 
+  8047e9:	ff d0                	call   *%rax
+  8047eb:	83 e0 01             	and    $0x1,%eax
+  8047ee:	85 c0                	test   %eax,%eax
+  8047f0:	74 33                	je     804825 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8047f2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047fe:	48 89 cf             	mov    %rcx,%rdi
+  804801:	48 89 d6             	mov    %rdx,%rsi
+  804804:	48 89 c1             	mov    %rax,%rcx
+  804807:	fc                   	cld
+  804808:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80480a:	48 89 c8             	mov    %rcx,%rax
+  80480d:	48 89 f2             	mov    %rsi,%rdx
+  804810:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804814:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804818:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80481c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804820:	e9 ab 00 00 00       	jmp    8048d0 <memmove+0x204>
+    if (n >= 8) {
+  804825:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80482a:	0f 86 8b 00 00 00    	jbe    8048bb <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  804830:	eb 22                	jmp    804854 <memmove+0x188>
+        *d++ = *s++;
+  804832:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804836:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80483a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80483e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804842:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804846:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80484a:	0f b6 12             	movzbl (%rdx),%edx
+  80484d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80484f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804854:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804858:	83 e0 07             	and    $0x7,%eax
+  80485b:	48 85 c0             	test   %rax,%rax
+  80485e:	75 d2                	jne    804832 <memmove+0x166>
+      nq = n / 8;
+  804860:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804864:	48 c1 e8 03          	shr    $0x3,%rax
+  804868:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80486c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804870:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804874:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804878:	48 89 cf             	mov    %rcx,%rdi
+  80487b:	48 89 d6             	mov    %rdx,%rsi
+  80487e:	48 89 c1             	mov    %rax,%rcx
+  804881:	fc                   	cld
+  804882:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804885:	48 89 c8             	mov    %rcx,%rax
+  804888:	48 89 f2             	mov    %rsi,%rdx
+  80488b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80488f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804893:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804897:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80489c:	eb 1d                	jmp    8048bb <memmove+0x1ef>
+      *d++ = *s++;
+  80489e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048a2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8048a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8048aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048ae:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8048b2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8048b6:	0f b6 12             	movzbl (%rdx),%edx
+  8048b9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8048bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048bf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8048c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8048c7:	48 85 c0             	test   %rax,%rax
+  8048ca:	75 d2                	jne    80489e <memmove+0x1d2>
+  return dst;
+  8048cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8048d0:	c9                   	leave
+  8048d1:	c3                   	ret
+
+00000000008048d2 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8048d2:	55                   	push   %rbp
+  8048d3:	48 89 e5             	mov    %rsp,%rbp
+  8048d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8048da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8048de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8048e2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8048e6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048ea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048f2:	48 89 ce             	mov    %rcx,%rsi
+  8048f5:	48 89 c7             	mov    %rax,%rdi
+  8048f8:	48 b8 cc 46 80 00 00 	movabs $0x8046cc,%rax
+  8048ff:	00 00 00 
+  804902:	ff d0                	call   *%rax
+}
+  804904:	c9                   	leave
+  804905:	c3                   	ret
+
+0000000000804906 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804906:	55                   	push   %rbp
+  804907:	48 89 e5             	mov    %rsp,%rbp
+  80490a:	48 83 ec 40          	sub    $0x40,%rsp
+  80490e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804912:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804916:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80491a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80491e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804922:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804926:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80492a:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80492f:	0f 86 a7 00 00 00    	jbe    8049dc <memcmp+0xd6>
+  804935:	48 b8 25 3d 80 00 00 	movabs $0x803d25,%rax
+  80493c:	00 00 00 
+  80493f:	ff d0                	call   *%rax
+  804941:	83 e0 02             	and    $0x2,%eax
+  804944:	85 c0                	test   %eax,%eax
+  804946:	0f 84 90 00 00 00    	je     8049dc <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80494c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804950:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804954:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804958:	48 89 ce             	mov    %rcx,%rsi
+  80495b:	48 89 c7             	mov    %rax,%rdi
+  80495e:	48 b8 ed 3e 80 00 00 	movabs $0x803eed,%rax
+  804965:	00 00 00 
+  804968:	ff d0                	call   *%rax
+  80496a:	e9 c2 00 00 00       	jmp    804a31 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  80496f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804973:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804977:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80497b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804983:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804987:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80498b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80498e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804995:	74 36                	je     8049cd <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804997:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80499a:	f7 d0                	not    %eax
+  80499c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8049a0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8049a3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8049a6:	48 63 d0             	movslq %eax,%rdx
+  8049a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049ad:	48 01 d0             	add    %rdx,%rax
+  8049b0:	0f b6 00             	movzbl (%rax),%eax
+  8049b3:	0f b6 c0             	movzbl %al,%eax
+  8049b6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049b9:	48 63 ca             	movslq %edx,%rcx
+  8049bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049c0:	48 01 ca             	add    %rcx,%rdx
+  8049c3:	0f b6 12             	movzbl (%rdx),%edx
+  8049c6:	0f b6 d2             	movzbl %dl,%edx
+  8049c9:	29 d0                	sub    %edx,%eax
+  8049cb:	eb 64                	jmp    804a31 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8049cd:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8049d2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8049d7:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  8049dc:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  8049e1:	77 8c                	ja     80496f <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  8049e3:	eb 36                	jmp    804a1b <memcmp+0x115>
+    if (*s1 != *s2)
+  8049e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049e9:	0f b6 10             	movzbl (%rax),%edx
+  8049ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f0:	0f b6 00             	movzbl (%rax),%eax
+  8049f3:	38 c2                	cmp    %al,%dl
+  8049f5:	74 1a                	je     804a11 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  8049f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049fb:	0f b6 00             	movzbl (%rax),%eax
+  8049fe:	0f b6 c8             	movzbl %al,%ecx
+  804a01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a05:	0f b6 00             	movzbl (%rax),%eax
+  804a08:	0f b6 d0             	movzbl %al,%edx
+  804a0b:	89 c8                	mov    %ecx,%eax
+  804a0d:	29 d0                	sub    %edx,%eax
+  804a0f:	eb 20                	jmp    804a31 <memcmp+0x12b>
+    s1++, s2++;
+  804a11:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804a16:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  804a1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a23:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804a27:	48 85 c0             	test   %rax,%rax
+  804a2a:	75 b9                	jne    8049e5 <memcmp+0xdf>
+  }
+
+  return 0;
+  804a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a31:	c9                   	leave
+  804a32:	c3                   	ret
+
+0000000000804a33 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+  804a37:	48 83 ec 50          	sub    $0x50,%rsp
+  804a3b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804a3f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  804a42:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  804a46:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a4a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a4e:	48 01 d0             	add    %rdx,%rax
+  804a51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  804a55:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a58:	66 0f 6e c0          	movd   %eax,%xmm0
+  804a5c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804a60:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804a64:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804a69:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804a6d:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a72:	76 73                	jbe    804ae7 <memfind+0xb4>
+  804a74:	48 b8 25 3d 80 00 00 	movabs $0x803d25,%rax
+  804a7b:	00 00 00 
+  804a7e:	ff d0                	call   *%rax
+  804a80:	83 e0 02             	and    $0x2,%eax
+  804a83:	85 c0                	test   %eax,%eax
+  804a85:	74 60                	je     804ae7 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a87:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a8a:	0f b6 c8             	movzbl %al,%ecx
+  804a8d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a95:	89 ce                	mov    %ecx,%esi
+  804a97:	48 89 c7             	mov    %rax,%rdi
+  804a9a:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  804aa1:	00 00 00 
+  804aa4:	ff d0                	call   *%rax
+  804aa6:	eb 6c                	jmp    804b14 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804aa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aac:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804ab0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804ab4:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804ab9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804abd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804ac1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804ac4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804ac8:	74 13                	je     804add <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804aca:	31 c0                	xor    %eax,%eax
+  804acc:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804ad1:	48 63 d0             	movslq %eax,%rdx
+  804ad4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad8:	48 01 d0             	add    %rdx,%rax
+  804adb:	eb 37                	jmp    804b14 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804add:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804ae2:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804ae7:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804aec:	77 ba                	ja     804aa8 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804aee:	eb 13                	jmp    804b03 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804af0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804af4:	0f b6 00             	movzbl (%rax),%eax
+  804af7:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804afa:	38 d0                	cmp    %dl,%al
+  804afc:	74 11                	je     804b0f <memfind+0xdc>
+  for (; s < ends; s++)
+  804afe:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b07:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804b0b:	72 e3                	jb     804af0 <memfind+0xbd>
+  804b0d:	eb 01                	jmp    804b10 <memfind+0xdd>
+      break;
+  804b0f:	90                   	nop
+  return (void *)s;
+  804b10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804b14:	c9                   	leave
+  804b15:	c3                   	ret
+
+0000000000804b16 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804b16:	55                   	push   %rbp
+  804b17:	48 89 e5             	mov    %rsp,%rbp
+  804b1a:	48 83 ec 38          	sub    $0x38,%rsp
+  804b1e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b22:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b26:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804b29:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804b30:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804b37:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804b38:	eb 05                	jmp    804b3f <strtol+0x29>
+    s++;
+  804b3a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804b3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b43:	0f b6 00             	movzbl (%rax),%eax
+  804b46:	3c 20                	cmp    $0x20,%al
+  804b48:	74 f0                	je     804b3a <strtol+0x24>
+  804b4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b4e:	0f b6 00             	movzbl (%rax),%eax
+  804b51:	3c 09                	cmp    $0x9,%al
+  804b53:	74 e5                	je     804b3a <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804b55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b59:	0f b6 00             	movzbl (%rax),%eax
+  804b5c:	3c 2b                	cmp    $0x2b,%al
+  804b5e:	75 07                	jne    804b67 <strtol+0x51>
+    s++;
+  804b60:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b65:	eb 17                	jmp    804b7e <strtol+0x68>
+  else if (*s == '-')
+  804b67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6b:	0f b6 00             	movzbl (%rax),%eax
+  804b6e:	3c 2d                	cmp    $0x2d,%al
+  804b70:	75 0c                	jne    804b7e <strtol+0x68>
+    s++, neg = 1;
+  804b72:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b77:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b7e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b82:	74 06                	je     804b8a <strtol+0x74>
+  804b84:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b88:	75 28                	jne    804bb2 <strtol+0x9c>
+  804b8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8e:	0f b6 00             	movzbl (%rax),%eax
+  804b91:	3c 30                	cmp    $0x30,%al
+  804b93:	75 1d                	jne    804bb2 <strtol+0x9c>
+  804b95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b99:	48 83 c0 01          	add    $0x1,%rax
+  804b9d:	0f b6 00             	movzbl (%rax),%eax
+  804ba0:	3c 78                	cmp    $0x78,%al
+  804ba2:	75 0e                	jne    804bb2 <strtol+0x9c>
+    s += 2, base = 16;
+  804ba4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804ba9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804bb0:	eb 2c                	jmp    804bde <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804bb2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804bb6:	75 19                	jne    804bd1 <strtol+0xbb>
+  804bb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bbc:	0f b6 00             	movzbl (%rax),%eax
+  804bbf:	3c 30                	cmp    $0x30,%al
+  804bc1:	75 0e                	jne    804bd1 <strtol+0xbb>
+    s++, base = 8;
+  804bc3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bc8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804bcf:	eb 0d                	jmp    804bde <strtol+0xc8>
+  else if (base == 0)
+  804bd1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804bd5:	75 07                	jne    804bde <strtol+0xc8>
+    base = 10;
+  804bd7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804bde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804be2:	0f b6 00             	movzbl (%rax),%eax
+  804be5:	3c 2f                	cmp    $0x2f,%al
+  804be7:	7e 1d                	jle    804c06 <strtol+0xf0>
+  804be9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bed:	0f b6 00             	movzbl (%rax),%eax
+  804bf0:	3c 39                	cmp    $0x39,%al
+  804bf2:	7f 12                	jg     804c06 <strtol+0xf0>
+      dig = *s - '0';
+  804bf4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf8:	0f b6 00             	movzbl (%rax),%eax
+  804bfb:	0f be c0             	movsbl %al,%eax
+  804bfe:	83 e8 30             	sub    $0x30,%eax
+  804c01:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c04:	eb 4e                	jmp    804c54 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804c06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c0a:	0f b6 00             	movzbl (%rax),%eax
+  804c0d:	3c 60                	cmp    $0x60,%al
+  804c0f:	7e 1d                	jle    804c2e <strtol+0x118>
+  804c11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c15:	0f b6 00             	movzbl (%rax),%eax
+  804c18:	3c 7a                	cmp    $0x7a,%al
+  804c1a:	7f 12                	jg     804c2e <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804c1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c20:	0f b6 00             	movzbl (%rax),%eax
+  804c23:	0f be c0             	movsbl %al,%eax
+  804c26:	83 e8 57             	sub    $0x57,%eax
+  804c29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c2c:	eb 26                	jmp    804c54 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804c2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c32:	0f b6 00             	movzbl (%rax),%eax
+  804c35:	3c 40                	cmp    $0x40,%al
+  804c37:	7e 47                	jle    804c80 <strtol+0x16a>
+  804c39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c3d:	0f b6 00             	movzbl (%rax),%eax
+  804c40:	3c 5a                	cmp    $0x5a,%al
+  804c42:	7f 3c                	jg     804c80 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804c44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c48:	0f b6 00             	movzbl (%rax),%eax
+  804c4b:	0f be c0             	movsbl %al,%eax
+  804c4e:	83 e8 37             	sub    $0x37,%eax
+  804c51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c57:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804c5a:	7d 23                	jge    804c7f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804c5c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804c61:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c64:	48 98                	cltq
+  804c66:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804c6b:	48 89 c2             	mov    %rax,%rdx
+  804c6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c71:	48 98                	cltq
+  804c73:	48 01 d0             	add    %rdx,%rax
+  804c76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c7a:	e9 5f ff ff ff       	jmp    804bde <strtol+0xc8>
+      break;
+  804c7f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c80:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c85:	74 0b                	je     804c92 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c8b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c8f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c96:	74 09                	je     804ca1 <strtol+0x18b>
+  804c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c9c:	48 f7 d8             	neg    %rax
+  804c9f:	eb 04                	jmp    804ca5 <strtol+0x18f>
+  804ca1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804ca5:	c9                   	leave
+  804ca6:	c3                   	ret
+
+0000000000804ca7 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  804ca7:	55                   	push   %rbp
+  804ca8:	48 89 e5             	mov    %rsp,%rbp
+  804cab:	48 83 ec 20          	sub    $0x20,%rsp
+  804caf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  804cb3:	48 b8 4b 03 80 00 00 	movabs $0x80034b,%rax
+  804cba:	00 00 00 
+  804cbd:	ff d0                	call   *%rax
+  804cbf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  804cc2:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  804cc9:	00 00 00 
+  804ccc:	48 8b 00             	mov    (%rax),%rax
+  804ccf:	48 85 c0             	test   %rax,%rax
+  804cd2:	75 62                	jne    804d36 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  804cd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cd7:	ba 07 00 00 00       	mov    $0x7,%edx
+  804cdc:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  804ce3:	00 00 00 
+  804ce6:	48 89 ce             	mov    %rcx,%rsi
+  804ce9:	89 c7                	mov    %eax,%edi
+  804ceb:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  804cf2:	00 00 00 
+  804cf5:	ff d0                	call   *%rax
+  804cf7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  804cfa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804cfe:	79 36                	jns    804d36 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  804d00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d03:	89 c1                	mov    %eax,%ecx
+  804d05:	48 b8 88 57 80 00 00 	movabs $0x805788,%rax
+  804d0c:	00 00 00 
+  804d0f:	48 89 c2             	mov    %rax,%rdx
+  804d12:	be 23 00 00 00       	mov    $0x23,%esi
+  804d17:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  804d1e:	00 00 00 
+  804d21:	48 89 c7             	mov    %rax,%rdi
+  804d24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d29:	49 b8 ba 2f 80 00 00 	movabs $0x802fba,%r8
+  804d30:	00 00 00 
+  804d33:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  804d36:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  804d3d:	00 00 00 
+  804d40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d44:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  804d47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d4a:	48 ba ab 0a 80 00 00 	movabs $0x800aab,%rdx
+  804d51:	00 00 00 
+  804d54:	48 89 d6             	mov    %rdx,%rsi
+  804d57:	89 c7                	mov    %eax,%edi
+  804d59:	48 b8 61 05 80 00 00 	movabs $0x800561,%rax
+  804d60:	00 00 00 
+  804d63:	ff d0                	call   *%rax
+  804d65:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  804d68:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804d6c:	79 36                	jns    804da4 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  804d6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804d71:	89 c1                	mov    %eax,%ecx
+  804d73:	48 b8 88 57 80 00 00 	movabs $0x805788,%rax
+  804d7a:	00 00 00 
+  804d7d:	48 89 c2             	mov    %rax,%rdx
+  804d80:	be 2b 00 00 00       	mov    $0x2b,%esi
+  804d85:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  804d8c:	00 00 00 
+  804d8f:	48 89 c7             	mov    %rax,%rdi
+  804d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d97:	49 b8 ba 2f 80 00 00 	movabs $0x802fba,%r8
+  804d9e:	00 00 00 
+  804da1:	41 ff d0             	call   *%r8
+}
+  804da4:	90                   	nop
+  804da5:	c9                   	leave
+  804da6:	c3                   	ret
+
+0000000000804da7 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804da7:	55                   	push   %rbp
+  804da8:	48 89 e5             	mov    %rsp,%rbp
+  804dab:	48 83 ec 20          	sub    $0x20,%rsp
+  804daf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804db3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804db7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804dbb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dbf:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc7:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804dce:	48 89 c7             	mov    %rax,%rdi
+  804dd1:	48 b8 df 4d 80 00 00 	movabs $0x804ddf,%rax
+  804dd8:	00 00 00 
+  804ddb:	ff d0                	call   *%rax
+}
+  804ddd:	c9                   	leave
+  804dde:	c3                   	ret
+
+0000000000804ddf <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804ddf:	55                   	push   %rbp
+  804de0:	48 89 e5             	mov    %rsp,%rbp
+  804de3:	48 83 ec 30          	sub    $0x30,%rsp
+  804de7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804deb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804def:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804df3:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804df7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dfc:	75 0e                	jne    804e0c <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804dfe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e05:	00 00 00 
+  804e08:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804e0c:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804e11:	75 18                	jne    804e2b <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804e13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e17:	48 89 c7             	mov    %rax,%rdi
+  804e1a:	48 b8 04 06 80 00 00 	movabs $0x800604,%rax
+  804e21:	00 00 00 
+  804e24:	ff d0                	call   *%rax
+  804e26:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e29:	eb 1d                	jmp    804e48 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804e2b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e33:	48 89 d6             	mov    %rdx,%rsi
+  804e36:	48 89 c7             	mov    %rax,%rdi
+  804e39:	48 b8 4a 06 80 00 00 	movabs $0x80064a,%rax
+  804e40:	00 00 00 
+  804e43:	ff d0                	call   *%rax
+  804e45:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804e48:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e4c:	79 2a                	jns    804e78 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804e4e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e53:	74 0a                	je     804e5f <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e59:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804e5f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e64:	74 0a                	je     804e70 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804e66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e6a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804e70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e73:	e9 aa 00 00 00       	jmp    804f22 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804e78:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e7d:	74 36                	je     804eb5 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804e7f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e86:	00 00 00 
+  804e89:	8b 40 04             	mov    0x4(%rax),%eax
+  804e8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e91:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e98:	00 00 00 
+  804e9b:	48 98                	cltq
+  804e9d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ea4:	48 01 d0             	add    %rdx,%rax
+  804ea7:	48 05 24 01 00 00    	add    $0x124,%rax
+  804ead:	8b 10                	mov    (%rax),%edx
+  804eaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb3:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804eb5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804eba:	74 36                	je     804ef2 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804ebc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ec3:	00 00 00 
+  804ec6:	8b 40 04             	mov    0x4(%rax),%eax
+  804ec9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ece:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ed5:	00 00 00 
+  804ed8:	48 98                	cltq
+  804eda:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ee1:	48 01 d0             	add    %rdx,%rax
+  804ee4:	48 05 28 01 00 00    	add    $0x128,%rax
+  804eea:	8b 10                	mov    (%rax),%edx
+  804eec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ef0:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804ef2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ef9:	00 00 00 
+  804efc:	8b 40 04             	mov    0x4(%rax),%eax
+  804eff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f04:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f0b:	00 00 00 
+  804f0e:	48 98                	cltq
+  804f10:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f17:	48 01 d0             	add    %rdx,%rax
+  804f1a:	48 05 20 01 00 00    	add    $0x120,%rax
+  804f20:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804f22:	c9                   	leave
+  804f23:	c3                   	ret
+
+0000000000804f24 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804f24:	55                   	push   %rbp
+  804f25:	48 89 e5             	mov    %rsp,%rbp
+  804f28:	48 83 ec 30          	sub    $0x30,%rsp
+  804f2c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f2f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804f32:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804f36:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804f39:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804f3e:	75 5e                	jne    804f9e <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804f40:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804f47:	00 00 00 
+  804f4a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f4e:	eb 4e                	jmp    804f9e <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804f50:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f54:	79 3c                	jns    804f92 <ipc_send+0x6e>
+  804f56:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804f5a:	74 36                	je     804f92 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804f5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f5f:	89 c1                	mov    %eax,%ecx
+  804f61:	48 b8 b0 57 80 00 00 	movabs $0x8057b0,%rax
+  804f68:	00 00 00 
+  804f6b:	48 89 c2             	mov    %rax,%rdx
+  804f6e:	be 54 00 00 00       	mov    $0x54,%esi
+  804f73:	48 b8 d6 57 80 00 00 	movabs $0x8057d6,%rax
+  804f7a:	00 00 00 
+  804f7d:	48 89 c7             	mov    %rax,%rdi
+  804f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f85:	49 b8 ba 2f 80 00 00 	movabs $0x802fba,%r8
+  804f8c:	00 00 00 
+  804f8f:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804f92:	48 b8 87 03 80 00 00 	movabs $0x800387,%rax
+  804f99:	00 00 00 
+  804f9c:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f9e:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804fa1:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804fa4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fa8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fab:	89 c7                	mov    %eax,%edi
+  804fad:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  804fb4:	00 00 00 
+  804fb7:	ff d0                	call   *%rax
+  804fb9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804fbc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fc0:	75 8e                	jne    804f50 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804fc2:	48 b8 87 03 80 00 00 	movabs $0x800387,%rax
+  804fc9:	00 00 00 
+  804fcc:	ff d0                	call   *%rax
+}
+  804fce:	90                   	nop
+  804fcf:	c9                   	leave
+  804fd0:	c3                   	ret
+
+0000000000804fd1 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804fd1:	55                   	push   %rbp
+  804fd2:	48 89 e5             	mov    %rsp,%rbp
+  804fd5:	48 83 ec 18          	sub    $0x18,%rsp
+  804fd9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804fdc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804fe3:	eb 4d                	jmp    805032 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804fe5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fec:	00 00 00 
+  804fef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ff2:	48 98                	cltq
+  804ff4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ffb:	48 01 d0             	add    %rdx,%rax
+  804ffe:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805004:	8b 00                	mov    (%rax),%eax
+  805006:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805009:	75 23                	jne    80502e <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80500b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805012:	00 00 00 
+  805015:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805018:	48 98                	cltq
+  80501a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805021:	48 01 d0             	add    %rdx,%rax
+  805024:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80502a:	8b 00                	mov    (%rax),%eax
+  80502c:	eb 12                	jmp    805040 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80502e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805032:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805039:	7e aa                	jle    804fe5 <ipc_find_env+0x14>
+  return 0;
+  80503b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805040:	c9                   	leave
+  805041:	c3                   	ret
+
+0000000000805042 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805042:	55                   	push   %rbp
+  805043:	48 89 e5             	mov    %rsp,%rbp
+  805046:	48 83 ec 18          	sub    $0x18,%rsp
+  80504a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80504e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805052:	48 c1 e8 27          	shr    $0x27,%rax
+  805056:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80505b:	48 89 c2             	mov    %rax,%rdx
+  80505e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805065:	01 00 00 
+  805068:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80506c:	83 e0 01             	and    $0x1,%eax
+  80506f:	48 85 c0             	test   %rax,%rax
+  805072:	74 63                	je     8050d7 <pageref+0x95>
+  805074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805078:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80507c:	48 89 c2             	mov    %rax,%rdx
+  80507f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805086:	01 00 00 
+  805089:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80508d:	83 e0 01             	and    $0x1,%eax
+  805090:	48 85 c0             	test   %rax,%rax
+  805093:	74 42                	je     8050d7 <pageref+0x95>
+  805095:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805099:	48 c1 e8 15          	shr    $0x15,%rax
+  80509d:	48 89 c2             	mov    %rax,%rdx
+  8050a0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8050a7:	01 00 00 
+  8050aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050ae:	83 e0 01             	and    $0x1,%eax
+  8050b1:	48 85 c0             	test   %rax,%rax
+  8050b4:	74 21                	je     8050d7 <pageref+0x95>
+  8050b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050be:	48 89 c2             	mov    %rax,%rdx
+  8050c1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050c8:	01 00 00 
+  8050cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050cf:	83 e0 01             	and    $0x1,%eax
+  8050d2:	48 85 c0             	test   %rax,%rax
+  8050d5:	75 07                	jne    8050de <pageref+0x9c>
+    return 0;
+  8050d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050dc:	eb 53                	jmp    805131 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8050de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050e2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050e6:	48 89 c2             	mov    %rax,%rdx
+  8050e9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050f0:	01 00 00 
+  8050f3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8050fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ff:	83 e0 01             	and    $0x1,%eax
+  805102:	48 85 c0             	test   %rax,%rax
+  805105:	75 07                	jne    80510e <pageref+0xcc>
+    return 0;
+  805107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80510c:	eb 23                	jmp    805131 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80510e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805112:	48 c1 e8 0c          	shr    $0xc,%rax
+  805116:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80511d:	00 00 00 
+  805120:	48 c1 e0 04          	shl    $0x4,%rax
+  805124:	48 01 d0             	add    %rdx,%rax
+  805127:	48 83 c0 08          	add    $0x8,%rax
+  80512b:	0f b7 00             	movzwl (%rax),%eax
+  80512e:	0f b7 c0             	movzwl %ax,%eax
+}
+  805131:	c9                   	leave
+  805132:	c3                   	ret
+  805133:	90                   	nop
@@ -0,0 +1,8049 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 3f 00 00 00       	call   80006b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// buggy program - faults with a read from location zero
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800041:	b8 00 00 00 00       	mov    $0x0,%eax
+  800046:	8b 00                	mov    (%rax),%eax
+  800048:	89 c6                	mov    %eax,%esi
+  80004a:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  800051:	00 00 00 
+  800054:	48 89 c7             	mov    %rax,%rdi
+  800057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005c:	48 ba 17 02 80 00 00 	movabs $0x800217,%rdx
+  800063:	00 00 00 
+  800066:	ff d2                	call   *%rdx
+}
+  800068:	90                   	nop
+  800069:	c9                   	leave
+  80006a:	c3                   	ret
+
+000000000080006b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80006b:	55                   	push   %rbp
+  80006c:	48 89 e5             	mov    %rsp,%rbp
+  80006f:	48 83 ec 20          	sub    $0x20,%rsp
+  800073:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800076:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80007a:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800081:	00 00 00 
+  800084:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800088:	eb 13                	jmp    80009d <libmain+0x32>
+    (*ctor)();
+  80008a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80008e:	48 8b 10             	mov    (%rax),%rdx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff d2                	call   *%rdx
+    ctor++;
+  800098:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80009d:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000a4:	00 00 00 
+  8000a7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000ab:	72 dd                	jb     80008a <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000b1:	7e 14                	jle    8000c7 <libmain+0x5c>
+    binaryname = argv[0];
+  8000b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000b7:	48 8b 00             	mov    (%rax),%rax
+  8000ba:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000c1:	00 00 00 
+  8000c4:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ce:	48 89 d6             	mov    %rdx,%rsi
+  8000d1:	89 c7                	mov    %eax,%edi
+  8000d3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000df:	48 b8 ee 00 80 00 00 	movabs $0x8000ee,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	90                   	nop
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+
+00000000008000ee <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ee:	55                   	push   %rbp
+  8000ef:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000f2:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  8000f9:	00 00 00 
+  8000fc:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800103:	48 b8 4d 1e 80 00 00 	movabs $0x801e4d,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+}
+  80010f:	90                   	nop
+  800110:	5d                   	pop    %rbp
+  800111:	c3                   	ret
+
+0000000000800112 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	48 83 ec 10          	sub    $0x10,%rsp
+  80011a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80011d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800121:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800125:	8b 00                	mov    (%rax),%eax
+  800127:	8d 48 01             	lea    0x1(%rax),%ecx
+  80012a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80012e:	89 0a                	mov    %ecx,(%rdx)
+  800130:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800133:	89 d1                	mov    %edx,%ecx
+  800135:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800139:	48 98                	cltq
+  80013b:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80013f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800143:	8b 00                	mov    (%rax),%eax
+  800145:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014a:	75 2c                	jne    800178 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80014c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800150:	8b 00                	mov    (%rax),%eax
+  800152:	48 98                	cltq
+  800154:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800158:	48 83 c2 08          	add    $0x8,%rdx
+  80015c:	48 89 c6             	mov    %rax,%rsi
+  80015f:	48 89 d7             	mov    %rdx,%rdi
+  800162:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+    b->idx = 0;
+  80016e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800172:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800178:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80017c:	8b 40 04             	mov    0x4(%rax),%eax
+  80017f:	8d 50 01             	lea    0x1(%rax),%edx
+  800182:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800186:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800189:	90                   	nop
+  80018a:	c9                   	leave
+  80018b:	c3                   	ret
+
+000000000080018c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80018c:	55                   	push   %rbp
+  80018d:	48 89 e5             	mov    %rsp,%rbp
+  800190:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800197:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  80019e:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001a5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001ac:	00 00 00 
+  b.cnt = 0;
+  8001af:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001b6:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8001b9:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8001c0:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8001c7:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001ce:	48 89 c6             	mov    %rax,%rsi
+  8001d1:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  8001d8:	00 00 00 
+  8001db:	48 89 c7             	mov    %rax,%rdi
+  8001de:	48 b8 71 05 80 00 00 	movabs $0x800571,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8001ea:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8001f0:	48 98                	cltq
+  8001f2:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8001f9:	48 83 c2 08          	add    $0x8,%rdx
+  8001fd:	48 89 c6             	mov    %rax,%rsi
+  800200:	48 89 d7             	mov    %rdx,%rdi
+  800203:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  80020a:	00 00 00 
+  80020d:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80020f:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+
+0000000000800217 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+  80021b:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800222:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800229:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800230:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800237:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80023e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800245:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80024c:	84 c0                	test   %al,%al
+  80024e:	74 20                	je     800270 <cprintf+0x59>
+  800250:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800254:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800258:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80025c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800260:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800264:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800268:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80026c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800270:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800277:	00 00 00 
+  80027a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800281:	00 00 00 
+  800284:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800288:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80028f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800296:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80029d:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002a4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002ab:	48 89 d6             	mov    %rdx,%rsi
+  8002ae:	48 89 c7             	mov    %rax,%rdi
+  8002b1:	48 b8 8c 01 80 00 00 	movabs $0x80018c,%rax
+  8002b8:	00 00 00 
+  8002bb:	ff d0                	call   *%rax
+  8002bd:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8002c3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8002c9:	c9                   	leave
+  8002ca:	c3                   	ret
+
+00000000008002cb <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8002cb:	55                   	push   %rbp
+  8002cc:	48 89 e5             	mov    %rsp,%rbp
+  8002cf:	48 83 ec 30          	sub    $0x30,%rsp
+  8002d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8002d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8002db:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8002df:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8002e2:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8002e6:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8002ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002ed:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8002f1:	72 54                	jb     800347 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002f6:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8002f9:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8002fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800300:	ba 00 00 00 00       	mov    $0x0,%edx
+  800305:	48 f7 f6             	div    %rsi
+  800308:	49 89 c2             	mov    %rax,%r10
+  80030b:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80030e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800311:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800319:	41 89 c9             	mov    %ecx,%r9d
+  80031c:	41 89 f8             	mov    %edi,%r8d
+  80031f:	89 d1                	mov    %edx,%ecx
+  800321:	4c 89 d2             	mov    %r10,%rdx
+  800324:	48 89 c7             	mov    %rax,%rdi
+  800327:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  80032e:	00 00 00 
+  800331:	ff d0                	call   *%rax
+  800333:	eb 1c                	jmp    800351 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800335:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800339:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80033c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800340:	48 89 d6             	mov    %rdx,%rsi
+  800343:	89 c7                	mov    %eax,%edi
+  800345:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800347:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80034b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80034f:	7f e4                	jg     800335 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800351:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800354:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800358:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035d:	48 f7 f1             	div    %rcx
+  800360:	48 b8 50 52 80 00 00 	movabs $0x805250,%rax
+  800367:	00 00 00 
+  80036a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80036e:	0f be c0             	movsbl %al,%eax
+  800371:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800375:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800379:	48 89 d6             	mov    %rdx,%rsi
+  80037c:	89 c7                	mov    %eax,%edi
+  80037e:	ff d1                	call   *%rcx
+}
+  800380:	90                   	nop
+  800381:	c9                   	leave
+  800382:	c3                   	ret
+
+0000000000800383 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800383:	55                   	push   %rbp
+  800384:	48 89 e5             	mov    %rsp,%rbp
+  800387:	48 83 ec 10          	sub    $0x10,%rsp
+  80038b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80038f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800392:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800396:	7e 4b                	jle    8003e3 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80039c:	8b 00                	mov    (%rax),%eax
+  80039e:	83 f8 2f             	cmp    $0x2f,%eax
+  8003a1:	77 24                	ja     8003c7 <getuint+0x44>
+  8003a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003a7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003af:	8b 00                	mov    (%rax),%eax
+  8003b1:	89 c0                	mov    %eax,%eax
+  8003b3:	48 01 d0             	add    %rdx,%rax
+  8003b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003ba:	8b 12                	mov    (%rdx),%edx
+  8003bc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8003bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c3:	89 0a                	mov    %ecx,(%rdx)
+  8003c5:	eb 14                	jmp    8003db <getuint+0x58>
+  8003c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003cf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8003d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003d7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8003db:	48 8b 00             	mov    (%rax),%rax
+  8003de:	e9 95 00 00 00       	jmp    800478 <getuint+0xf5>
+  else if (lflag)
+  8003e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8003e7:	74 48                	je     800431 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8003e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003ed:	8b 00                	mov    (%rax),%eax
+  8003ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f2:	77 24                	ja     800418 <getuint+0x95>
+  8003f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800400:	8b 00                	mov    (%rax),%eax
+  800402:	89 c0                	mov    %eax,%eax
+  800404:	48 01 d0             	add    %rdx,%rax
+  800407:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80040b:	8b 12                	mov    (%rdx),%edx
+  80040d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800410:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800414:	89 0a                	mov    %ecx,(%rdx)
+  800416:	eb 14                	jmp    80042c <getuint+0xa9>
+  800418:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80041c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800420:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800424:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800428:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80042c:	48 8b 00             	mov    (%rax),%rax
+  80042f:	eb 47                	jmp    800478 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800435:	8b 00                	mov    (%rax),%eax
+  800437:	83 f8 2f             	cmp    $0x2f,%eax
+  80043a:	77 24                	ja     800460 <getuint+0xdd>
+  80043c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800440:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800448:	8b 00                	mov    (%rax),%eax
+  80044a:	89 c0                	mov    %eax,%eax
+  80044c:	48 01 d0             	add    %rdx,%rax
+  80044f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800453:	8b 12                	mov    (%rdx),%edx
+  800455:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800458:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80045c:	89 0a                	mov    %ecx,(%rdx)
+  80045e:	eb 14                	jmp    800474 <getuint+0xf1>
+  800460:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800464:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800468:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80046c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800470:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800474:	8b 00                	mov    (%rax),%eax
+  800476:	89 c0                	mov    %eax,%eax
+}
+  800478:	c9                   	leave
+  800479:	c3                   	ret
+
+000000000080047a <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80047a:	55                   	push   %rbp
+  80047b:	48 89 e5             	mov    %rsp,%rbp
+  80047e:	48 83 ec 10          	sub    $0x10,%rsp
+  800482:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800486:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800489:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80048d:	7e 4b                	jle    8004da <getint+0x60>
+    return va_arg(*ap, long long);
+  80048f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800493:	8b 00                	mov    (%rax),%eax
+  800495:	83 f8 2f             	cmp    $0x2f,%eax
+  800498:	77 24                	ja     8004be <getint+0x44>
+  80049a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80049e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a6:	8b 00                	mov    (%rax),%eax
+  8004a8:	89 c0                	mov    %eax,%eax
+  8004aa:	48 01 d0             	add    %rdx,%rax
+  8004ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b1:	8b 12                	mov    (%rdx),%edx
+  8004b3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ba:	89 0a                	mov    %ecx,(%rdx)
+  8004bc:	eb 14                	jmp    8004d2 <getint+0x58>
+  8004be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004c6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004d2:	48 8b 00             	mov    (%rax),%rax
+  8004d5:	e9 95 00 00 00       	jmp    80056f <getint+0xf5>
+  else if (lflag)
+  8004da:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004de:	74 48                	je     800528 <getint+0xae>
+    return va_arg(*ap, long);
+  8004e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e4:	8b 00                	mov    (%rax),%eax
+  8004e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e9:	77 24                	ja     80050f <getint+0x95>
+  8004eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f7:	8b 00                	mov    (%rax),%eax
+  8004f9:	89 c0                	mov    %eax,%eax
+  8004fb:	48 01 d0             	add    %rdx,%rax
+  8004fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800502:	8b 12                	mov    (%rdx),%edx
+  800504:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800507:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80050b:	89 0a                	mov    %ecx,(%rdx)
+  80050d:	eb 14                	jmp    800523 <getint+0xa9>
+  80050f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800513:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800517:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80051b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80051f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800523:	48 8b 00             	mov    (%rax),%rax
+  800526:	eb 47                	jmp    80056f <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800528:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80052c:	8b 00                	mov    (%rax),%eax
+  80052e:	83 f8 2f             	cmp    $0x2f,%eax
+  800531:	77 24                	ja     800557 <getint+0xdd>
+  800533:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800537:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80053b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053f:	8b 00                	mov    (%rax),%eax
+  800541:	89 c0                	mov    %eax,%eax
+  800543:	48 01 d0             	add    %rdx,%rax
+  800546:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80054a:	8b 12                	mov    (%rdx),%edx
+  80054c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80054f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800553:	89 0a                	mov    %ecx,(%rdx)
+  800555:	eb 14                	jmp    80056b <getint+0xf1>
+  800557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80055b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80055f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800563:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800567:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80056b:	8b 00                	mov    (%rax),%eax
+  80056d:	48 98                	cltq
+}
+  80056f:	c9                   	leave
+  800570:	c3                   	ret
+
+0000000000800571 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800571:	55                   	push   %rbp
+  800572:	48 89 e5             	mov    %rsp,%rbp
+  800575:	41 54                	push   %r12
+  800577:	53                   	push   %rbx
+  800578:	48 83 ec 60          	sub    $0x60,%rsp
+  80057c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800580:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800584:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800588:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80058c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800590:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800594:	48 8b 06             	mov    (%rsi),%rax
+  800597:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80059b:	48 89 01             	mov    %rax,(%rcx)
+  80059e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005a2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005a6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005aa:	eb 17                	jmp    8005c3 <vprintfmt+0x52>
+      if (ch == '\0')
+  8005ac:	85 db                	test   %ebx,%ebx
+  8005ae:	0f 84 bf 04 00 00    	je     800a73 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005b4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005b8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8005bc:	48 89 c6             	mov    %rax,%rsi
+  8005bf:	89 df                	mov    %ebx,%edi
+  8005c1:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005c3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8005c7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005cb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005cf:	0f b6 00             	movzbl (%rax),%eax
+  8005d2:	0f b6 d8             	movzbl %al,%ebx
+  8005d5:	83 fb 25             	cmp    $0x25,%ebx
+  8005d8:	75 d2                	jne    8005ac <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8005da:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8005de:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8005e5:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8005ec:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8005f3:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8005fa:	eb 04                	jmp    800600 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8005fc:	90                   	nop
+  8005fd:	eb 01                	jmp    800600 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8005ff:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800600:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800604:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800608:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80060c:	0f b6 00             	movzbl (%rax),%eax
+  80060f:	0f b6 d8             	movzbl %al,%ebx
+  800612:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800615:	83 f8 55             	cmp    $0x55,%eax
+  800618:	0f 87 22 04 00 00    	ja     800a40 <vprintfmt+0x4cf>
+  80061e:	89 c0                	mov    %eax,%eax
+  800620:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800627:	00 
+  800628:	48 b8 78 52 80 00 00 	movabs $0x805278,%rax
+  80062f:	00 00 00 
+  800632:	48 01 d0             	add    %rdx,%rax
+  800635:	48 8b 00             	mov    (%rax),%rax
+  800638:	ff e0                	jmp    *%rax
+        padc = '-';
+  80063a:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80063e:	eb c0                	jmp    800600 <vprintfmt+0x8f>
+        padc = '0';
+  800640:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800644:	eb ba                	jmp    800600 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800646:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80064d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800650:	89 d0                	mov    %edx,%eax
+  800652:	c1 e0 02             	shl    $0x2,%eax
+  800655:	01 d0                	add    %edx,%eax
+  800657:	01 c0                	add    %eax,%eax
+  800659:	01 d8                	add    %ebx,%eax
+  80065b:	83 e8 30             	sub    $0x30,%eax
+  80065e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800661:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800665:	0f b6 00             	movzbl (%rax),%eax
+  800668:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80066b:	83 fb 2f             	cmp    $0x2f,%ebx
+  80066e:	7e 60                	jle    8006d0 <vprintfmt+0x15f>
+  800670:	83 fb 39             	cmp    $0x39,%ebx
+  800673:	7f 5b                	jg     8006d0 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800675:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80067a:	eb d1                	jmp    80064d <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  80067c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80067f:	83 f8 2f             	cmp    $0x2f,%eax
+  800682:	77 17                	ja     80069b <vprintfmt+0x12a>
+  800684:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800688:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80068b:	89 d2                	mov    %edx,%edx
+  80068d:	48 01 d0             	add    %rdx,%rax
+  800690:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800693:	83 c2 08             	add    $0x8,%edx
+  800696:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800699:	eb 0c                	jmp    8006a7 <vprintfmt+0x136>
+  80069b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80069f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006a3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006a7:	8b 00                	mov    (%rax),%eax
+  8006a9:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006ac:	eb 23                	jmp    8006d1 <vprintfmt+0x160>
+        if (width < 0)
+  8006ae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006b2:	0f 89 44 ff ff ff    	jns    8005fc <vprintfmt+0x8b>
+          width = 0;
+  8006b8:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8006bf:	e9 38 ff ff ff       	jmp    8005fc <vprintfmt+0x8b>
+        altflag = 1;
+  8006c4:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8006cb:	e9 30 ff ff ff       	jmp    800600 <vprintfmt+0x8f>
+        goto process_precision;
+  8006d0:	90                   	nop
+        if (width < 0)
+  8006d1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006d5:	0f 89 24 ff ff ff    	jns    8005ff <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8006db:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8006de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8006e1:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8006e8:	e9 12 ff ff ff       	jmp    8005ff <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8006ed:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8006f1:	e9 0a ff ff ff       	jmp    800600 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8006f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fc:	77 17                	ja     800715 <vprintfmt+0x1a4>
+  8006fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800702:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800705:	89 d2                	mov    %edx,%edx
+  800707:	48 01 d0             	add    %rdx,%rax
+  80070a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80070d:	83 c2 08             	add    $0x8,%edx
+  800710:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800713:	eb 0c                	jmp    800721 <vprintfmt+0x1b0>
+  800715:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800719:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80071d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800721:	8b 00                	mov    (%rax),%eax
+  800723:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800727:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80072b:	48 89 d6             	mov    %rdx,%rsi
+  80072e:	89 c7                	mov    %eax,%edi
+  800730:	ff d1                	call   *%rcx
+        break;
+  800732:	e9 37 03 00 00       	jmp    800a6e <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073a:	83 f8 2f             	cmp    $0x2f,%eax
+  80073d:	77 17                	ja     800756 <vprintfmt+0x1e5>
+  80073f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800743:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800746:	89 d2                	mov    %edx,%edx
+  800748:	48 01 d0             	add    %rdx,%rax
+  80074b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80074e:	83 c2 08             	add    $0x8,%edx
+  800751:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800754:	eb 0c                	jmp    800762 <vprintfmt+0x1f1>
+  800756:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80075a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80075e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800762:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800764:	85 db                	test   %ebx,%ebx
+  800766:	79 02                	jns    80076a <vprintfmt+0x1f9>
+          err = -err;
+  800768:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80076a:	83 fb 15             	cmp    $0x15,%ebx
+  80076d:	7f 16                	jg     800785 <vprintfmt+0x214>
+  80076f:	48 ba a0 51 80 00 00 	movabs $0x8051a0,%rdx
+  800776:	00 00 00 
+  800779:	48 63 c3             	movslq %ebx,%rax
+  80077c:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800780:	4d 85 e4             	test   %r12,%r12
+  800783:	75 2e                	jne    8007b3 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800785:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800789:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80078d:	89 d9                	mov    %ebx,%ecx
+  80078f:	48 ba 61 52 80 00 00 	movabs $0x805261,%rdx
+  800796:	00 00 00 
+  800799:	48 89 c7             	mov    %rax,%rdi
+  80079c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a1:	49 b8 7d 0a 80 00 00 	movabs $0x800a7d,%r8
+  8007a8:	00 00 00 
+  8007ab:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007ae:	e9 bb 02 00 00       	jmp    800a6e <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007b3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007b7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007bb:	4c 89 e1             	mov    %r12,%rcx
+  8007be:	48 ba 6a 52 80 00 00 	movabs $0x80526a,%rdx
+  8007c5:	00 00 00 
+  8007c8:	48 89 c7             	mov    %rax,%rdi
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	49 b8 7d 0a 80 00 00 	movabs $0x800a7d,%r8
+  8007d7:	00 00 00 
+  8007da:	41 ff d0             	call   *%r8
+        break;
+  8007dd:	e9 8c 02 00 00       	jmp    800a6e <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8007e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e8:	77 17                	ja     800801 <vprintfmt+0x290>
+  8007ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007ee:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f1:	89 d2                	mov    %edx,%edx
+  8007f3:	48 01 d0             	add    %rdx,%rax
+  8007f6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f9:	83 c2 08             	add    $0x8,%edx
+  8007fc:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007ff:	eb 0c                	jmp    80080d <vprintfmt+0x29c>
+  800801:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800805:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800809:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80080d:	4c 8b 20             	mov    (%rax),%r12
+  800810:	4d 85 e4             	test   %r12,%r12
+  800813:	75 0a                	jne    80081f <vprintfmt+0x2ae>
+          p = "(null)";
+  800815:	49 bc 6d 52 80 00 00 	movabs $0x80526d,%r12
+  80081c:	00 00 00 
+        if (width > 0 && padc != '-')
+  80081f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800823:	7e 78                	jle    80089d <vprintfmt+0x32c>
+  800825:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800829:	74 72                	je     80089d <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80082b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80082e:	48 98                	cltq
+  800830:	48 89 c6             	mov    %rax,%rsi
+  800833:	4c 89 e7             	mov    %r12,%rdi
+  800836:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  80083d:	00 00 00 
+  800840:	ff d0                	call   *%rax
+  800842:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800845:	eb 17                	jmp    80085e <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800847:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80084b:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80084f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800853:	48 89 d6             	mov    %rdx,%rsi
+  800856:	89 c7                	mov    %eax,%edi
+  800858:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80085a:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80085e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800862:	7f e3                	jg     800847 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800864:	eb 37                	jmp    80089d <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800866:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80086a:	74 1e                	je     80088a <vprintfmt+0x319>
+  80086c:	83 fb 1f             	cmp    $0x1f,%ebx
+  80086f:	7e 05                	jle    800876 <vprintfmt+0x305>
+  800871:	83 fb 7e             	cmp    $0x7e,%ebx
+  800874:	7e 14                	jle    80088a <vprintfmt+0x319>
+            putch('?', putdat);
+  800876:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80087a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80087e:	48 89 c6             	mov    %rax,%rsi
+  800881:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800886:	ff d2                	call   *%rdx
+  800888:	eb 0f                	jmp    800899 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80088a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80088e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800892:	48 89 c6             	mov    %rax,%rsi
+  800895:	89 df                	mov    %ebx,%edi
+  800897:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800899:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80089d:	4c 89 e0             	mov    %r12,%rax
+  8008a0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a4:	0f b6 00             	movzbl (%rax),%eax
+  8008a7:	0f be d8             	movsbl %al,%ebx
+  8008aa:	85 db                	test   %ebx,%ebx
+  8008ac:	74 28                	je     8008d6 <vprintfmt+0x365>
+  8008ae:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008b2:	78 b2                	js     800866 <vprintfmt+0x2f5>
+  8008b4:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008b8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008bc:	79 a8                	jns    800866 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8008be:	eb 16                	jmp    8008d6 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8008c0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008c4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008c8:	48 89 c6             	mov    %rax,%rsi
+  8008cb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d0:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8008d2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008d6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008da:	7f e4                	jg     8008c0 <vprintfmt+0x34f>
+        break;
+  8008dc:	e9 8d 01 00 00       	jmp    800a6e <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8008e1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8008e4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8008e8:	89 d6                	mov    %edx,%esi
+  8008ea:	48 89 c7             	mov    %rax,%rdi
+  8008ed:	48 b8 7a 04 80 00 00 	movabs $0x80047a,%rax
+  8008f4:	00 00 00 
+  8008f7:	ff d0                	call   *%rax
+  8008f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8008fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800901:	48 85 c0             	test   %rax,%rax
+  800904:	79 1d                	jns    800923 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800906:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80090a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80090e:	48 89 c6             	mov    %rax,%rsi
+  800911:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800916:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80091c:	48 f7 d8             	neg    %rax
+  80091f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800923:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80092a:	e9 d2 00 00 00       	jmp    800a01 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80092f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800932:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800936:	89 d6                	mov    %edx,%esi
+  800938:	48 89 c7             	mov    %rax,%rdi
+  80093b:	48 b8 83 03 80 00 00 	movabs $0x800383,%rax
+  800942:	00 00 00 
+  800945:	ff d0                	call   *%rax
+  800947:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80094b:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800952:	e9 aa 00 00 00       	jmp    800a01 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800957:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80095a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80095e:	89 d6                	mov    %edx,%esi
+  800960:	48 89 c7             	mov    %rax,%rdi
+  800963:	48 b8 83 03 80 00 00 	movabs $0x800383,%rax
+  80096a:	00 00 00 
+  80096d:	ff d0                	call   *%rax
+  80096f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800973:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80097a:	e9 82 00 00 00       	jmp    800a01 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  80097f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800983:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800987:	48 89 c6             	mov    %rax,%rsi
+  80098a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80098f:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800991:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800995:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800999:	48 89 c6             	mov    %rax,%rsi
+  80099c:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a1:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a9:	77 17                	ja     8009c2 <vprintfmt+0x451>
+  8009ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009af:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009b2:	89 d2                	mov    %edx,%edx
+  8009b4:	48 01 d0             	add    %rdx,%rax
+  8009b7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ba:	83 c2 08             	add    $0x8,%edx
+  8009bd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009c0:	eb 0c                	jmp    8009ce <vprintfmt+0x45d>
+  8009c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009c6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009ca:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009ce:	48 8b 00             	mov    (%rax),%rax
+  8009d1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009d5:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8009dc:	eb 23                	jmp    800a01 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8009de:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009e1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009e5:	89 d6                	mov    %edx,%esi
+  8009e7:	48 89 c7             	mov    %rax,%rdi
+  8009ea:	48 b8 83 03 80 00 00 	movabs $0x800383,%rax
+  8009f1:	00 00 00 
+  8009f4:	ff d0                	call   *%rax
+  8009f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009fa:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a01:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a06:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a09:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a0c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a10:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a14:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a18:	45 89 c1             	mov    %r8d,%r9d
+  800a1b:	41 89 f8             	mov    %edi,%r8d
+  800a1e:	48 89 c7             	mov    %rax,%rdi
+  800a21:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  800a28:	00 00 00 
+  800a2b:	ff d0                	call   *%rax
+        break;
+  800a2d:	eb 3f                	jmp    800a6e <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a2f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a33:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a37:	48 89 c6             	mov    %rax,%rsi
+  800a3a:	89 df                	mov    %ebx,%edi
+  800a3c:	ff d2                	call   *%rdx
+        break;
+  800a3e:	eb 2e                	jmp    800a6e <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a40:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a44:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a48:	48 89 c6             	mov    %rax,%rsi
+  800a4b:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a50:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a52:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a57:	eb 05                	jmp    800a5e <vprintfmt+0x4ed>
+  800a59:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a5e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a62:	48 83 e8 01          	sub    $0x1,%rax
+  800a66:	0f b6 00             	movzbl (%rax),%eax
+  800a69:	3c 25                	cmp    $0x25,%al
+  800a6b:	75 ec                	jne    800a59 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800a6d:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a6e:	e9 50 fb ff ff       	jmp    8005c3 <vprintfmt+0x52>
+        return;
+  800a73:	90                   	nop
+    }
+  }
+}
+  800a74:	48 83 c4 60          	add    $0x60,%rsp
+  800a78:	5b                   	pop    %rbx
+  800a79:	41 5c                	pop    %r12
+  800a7b:	5d                   	pop    %rbp
+  800a7c:	c3                   	ret
+
+0000000000800a7d <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a7d:	55                   	push   %rbp
+  800a7e:	48 89 e5             	mov    %rsp,%rbp
+  800a81:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800a88:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a8f:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800a96:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800a9d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800aa4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800aab:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ab2:	84 c0                	test   %al,%al
+  800ab4:	74 20                	je     800ad6 <printfmt+0x59>
+  800ab6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800aba:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800abe:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ac2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ac6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800aca:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ace:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ad2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ad6:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800add:	00 00 00 
+  800ae0:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800ae7:	00 00 00 
+  800aea:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aee:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800af5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800afc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b03:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b0a:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b11:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b18:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b1f:	48 89 c7             	mov    %rax,%rdi
+  800b22:	48 b8 71 05 80 00 00 	movabs $0x800571,%rax
+  800b29:	00 00 00 
+  800b2c:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b2e:	90                   	nop
+  800b2f:	c9                   	leave
+  800b30:	c3                   	ret
+
+0000000000800b31 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b31:	55                   	push   %rbp
+  800b32:	48 89 e5             	mov    %rsp,%rbp
+  800b35:	48 83 ec 10          	sub    $0x10,%rsp
+  800b39:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b3c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b44:	8b 40 10             	mov    0x10(%rax),%eax
+  800b47:	8d 50 01             	lea    0x1(%rax),%edx
+  800b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b4e:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b55:	48 8b 10             	mov    (%rax),%rdx
+  800b58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b60:	48 39 c2             	cmp    %rax,%rdx
+  800b63:	73 17                	jae    800b7c <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b69:	48 8b 00             	mov    (%rax),%rax
+  800b6c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800b70:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b74:	48 89 0a             	mov    %rcx,(%rdx)
+  800b77:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b7a:	88 10                	mov    %dl,(%rax)
+}
+  800b7c:	90                   	nop
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+0000000000800b7f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800b7f:	55                   	push   %rbp
+  800b80:	48 89 e5             	mov    %rsp,%rbp
+  800b83:	48 83 ec 40          	sub    $0x40,%rsp
+  800b87:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b8b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b8e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b92:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800b96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b9a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800b9e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800ba1:	48 98                	cltq
+  800ba3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800ba7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bab:	48 01 d0             	add    %rdx,%rax
+  800bae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bb2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800bb9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bbe:	74 06                	je     800bc6 <vsnprintf+0x47>
+  800bc0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bc4:	7f 07                	jg     800bcd <vsnprintf+0x4e>
+    return -E_INVAL;
+  800bc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bcb:	eb 32                	jmp    800bff <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800bcd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bd1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800bd5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800bd9:	48 89 c6             	mov    %rax,%rsi
+  800bdc:	48 b8 31 0b 80 00 00 	movabs $0x800b31,%rax
+  800be3:	00 00 00 
+  800be6:	48 89 c7             	mov    %rax,%rdi
+  800be9:	48 b8 71 05 80 00 00 	movabs $0x800571,%rax
+  800bf0:	00 00 00 
+  800bf3:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800bf5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bf9:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800bfc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800bff:	c9                   	leave
+  800c00:	c3                   	ret
+
+0000000000800c01 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c01:	55                   	push   %rbp
+  800c02:	48 89 e5             	mov    %rsp,%rbp
+  800c05:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c0c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c13:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c19:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c20:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c27:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c2e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c35:	84 c0                	test   %al,%al
+  800c37:	74 20                	je     800c59 <snprintf+0x58>
+  800c39:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c3d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c41:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c45:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c49:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c4d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c51:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c55:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c59:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800c60:	00 00 00 
+  800c63:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c6a:	00 00 00 
+  800c6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c71:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c78:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c7f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c86:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800c8d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c94:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800c9a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ca1:	48 89 c7             	mov    %rax,%rdi
+  800ca4:	48 b8 7f 0b 80 00 00 	movabs $0x800b7f,%rax
+  800cab:	00 00 00 
+  800cae:	ff d0                	call   *%rax
+  800cb0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cb6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+
+0000000000800cbe <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800cbe:	55                   	push   %rbp
+  800cbf:	48 89 e5             	mov    %rsp,%rbp
+  800cc2:	53                   	push   %rbx
+  800cc3:	48 83 ec 38          	sub    $0x38,%rsp
+  800cc7:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800cca:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cce:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800cd2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800cd6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800cda:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	89 d1                	mov    %edx,%ecx
+  800ce4:	0f a2                	cpuid
+  800ce6:	89 de                	mov    %ebx,%esi
+  800ce8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ceb:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800cee:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800cf1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800cf4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800cf9:	74 09                	je     800d04 <cpuid+0x46>
+}
+  800cfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cff:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d02:	89 10                	mov    %edx,(%rax)
+
+  800d04:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d09:	74 09                	je     800d14 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d12:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d14:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d19:	74 09                	je     800d24 <cpuid+0x66>
+char *
+  800d1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d1f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d22:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d24:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d29:	74 09                	je     800d34 <cpuid+0x76>
+  for (; *s; s++)
+  800d2b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d2f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d32:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d34:	90                   	nop
+  800d35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d39:	c9                   	leave
+  800d3a:	c3                   	ret
+
+0000000000800d3b <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d3b:	55                   	push   %rbp
+  800d3c:	48 89 e5             	mov    %rsp,%rbp
+  800d3f:	48 83 ec 18          	sub    $0x18,%rsp
+  800d43:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d49:	89 c1                	mov    %eax,%ecx
+  800d4b:	0f 01 d0             	xgetbv
+  800d4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d51:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d57:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800d5a:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d5e:	48 09 d0             	or     %rdx,%rax
+#else
+  800d61:	c9                   	leave
+  800d62:	c3                   	ret
+
+0000000000800d63 <string_cpu>:
+string_cpu(void) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800d6b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800d72:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800d79:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d80:	00 00 00 
+  800d83:	8b 00                	mov    (%rax),%eax
+  800d85:	85 c0                	test   %eax,%eax
+  800d87:	78 11                	js     800d9a <string_cpu+0x37>
+    return string_features;
+  800d89:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d90:	00 00 00 
+  800d93:	8b 00                	mov    (%rax),%eax
+  800d95:	e9 df 00 00 00       	jmp    800e79 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800d9a:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800d9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800da4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dae:	48 89 c6             	mov    %rax,%rsi
+  800db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db6:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  800dbd:	00 00 00 
+  800dc0:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800dc2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800dc5:	83 f8 06             	cmp    $0x6,%eax
+  800dc8:	76 28                	jbe    800df2 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800dca:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800dce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd9:	48 89 c2             	mov    %rax,%rdx
+  800ddc:	be 00 00 00 00       	mov    $0x0,%esi
+  800de1:	bf 07 00 00 00       	mov    $0x7,%edi
+  800de6:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  800ded:	00 00 00 
+  800df0:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800df2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800df5:	25 00 02 00 00       	and    $0x200,%eax
+  800dfa:	85 c0                	test   %eax,%eax
+  800dfc:	74 04                	je     800e02 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800dfe:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e02:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e06:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e0c:	48 89 c1             	mov    %rax,%rcx
+  800e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e14:	be 00 00 00 00       	mov    $0x0,%esi
+  800e19:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e1e:	48 b8 be 0c 80 00 00 	movabs $0x800cbe,%rax
+  800e25:	00 00 00 
+  800e28:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e2a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e2d:	83 e0 20             	and    $0x20,%eax
+  800e30:	85 c0                	test   %eax,%eax
+  800e32:	74 2a                	je     800e5e <string_cpu+0xfb>
+  800e34:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e37:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	74 1e                	je     800e5e <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e45:	48 b8 3b 0d 80 00 00 	movabs $0x800d3b,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+  800e51:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e54:	48 83 f8 06          	cmp    $0x6,%rax
+  800e58:	75 04                	jne    800e5e <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800e5a:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800e5e:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800e65:	00 00 00 
+  800e68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e6b:	89 02                	mov    %eax,(%rdx)
+  800e6d:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e74:	00 00 00 
+  800e77:	8b 00                	mov    (%rax),%eax
+}
+  800e79:	c9                   	leave
+  800e7a:	c3                   	ret
+
+0000000000800e7b <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800e7b:	55                   	push   %rbp
+  800e7c:	48 89 e5             	mov    %rsp,%rbp
+  800e7f:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800e83:	48 83 ec 60          	sub    $0x60,%rsp
+  800e87:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800e8c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800e91:	83 e0 1f             	and    $0x1f,%eax
+  800e94:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800e98:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800e9c:	48 f7 d8             	neg    %rax
+  800e9f:	48 89 c2             	mov    %rax,%rdx
+  800ea2:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800ea7:	48 01 d0             	add    %rdx,%rax
+  800eaa:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800eaf:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800eb3:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800eb9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ebe:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ec2:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ec8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ecc:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800ed0:	89 c2                	mov    %eax,%edx
+  800ed2:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ed6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800edb:	89 c1                	mov    %eax,%ecx
+  800edd:	d3 e6                	shl    %cl,%esi
+  800edf:	89 f0                	mov    %esi,%eax
+  800ee1:	21 d0                	and    %edx,%eax
+  800ee3:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800ee7:	eb 21                	jmp    800f0a <strlen_avx2+0x8f>
+    p += 32;
+  800ee9:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800eef:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ef4:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ef8:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800efe:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f02:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f06:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f0a:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f0f:	74 d8                	je     800ee9 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f11:	31 c0                	xor    %eax,%eax
+  800f13:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f19:	48 63 d0             	movslq %eax,%rdx
+  800f1c:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f21:	48 01 d0             	add    %rdx,%rax
+  800f24:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f29:	c9                   	leave
+  800f2a:	c3                   	ret
+
+0000000000800f2b <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f2b:	55                   	push   %rbp
+  800f2c:	48 89 e5             	mov    %rsp,%rbp
+  800f2f:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f33:	48 83 ec 40          	sub    $0x40,%rsp
+  800f37:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f3c:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f41:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f46:	eb 77                	jmp    800fbf <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f48:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f4d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f51:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f55:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800f5a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f5e:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f62:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f66:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800f6a:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800f6f:	74 3c                	je     800fad <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800f71:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800f75:	f7 d0                	not    %eax
+  800f77:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f7b:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800f7f:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800f83:	48 63 d0             	movslq %eax,%rdx
+  800f86:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f8b:	48 01 d0             	add    %rdx,%rax
+  800f8e:	0f b6 00             	movzbl (%rax),%eax
+  800f91:	0f b6 c0             	movzbl %al,%eax
+  800f94:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800f98:	48 63 ca             	movslq %edx,%rcx
+  800f9b:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fa0:	48 01 ca             	add    %rcx,%rdx
+  800fa3:	0f b6 12             	movzbl (%rdx),%edx
+  800fa6:	0f b6 d2             	movzbl %dl,%edx
+  800fa9:	29 d0                	sub    %edx,%eax
+  800fab:	eb 6b                	jmp    801018 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fad:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800fb3:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800fb9:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800fbf:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800fc5:	77 81                	ja     800f48 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800fc7:	eb 42                	jmp    80100b <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800fc9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fce:	0f b6 10             	movzbl (%rax),%edx
+  800fd1:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fd6:	0f b6 00             	movzbl (%rax),%eax
+  800fd9:	38 c2                	cmp    %al,%dl
+  800fdb:	74 1c                	je     800ff9 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800fdd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fe2:	0f b6 00             	movzbl (%rax),%eax
+  800fe5:	0f b6 c8             	movzbl %al,%ecx
+  800fe8:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fed:	0f b6 00             	movzbl (%rax),%eax
+  800ff0:	0f b6 d0             	movzbl %al,%edx
+  800ff3:	89 c8                	mov    %ecx,%eax
+  800ff5:	29 d0                	sub    %edx,%eax
+  800ff7:	eb 1f                	jmp    801018 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  800ff9:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  800fff:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801005:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80100b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801011:	75 b6                	jne    800fc9 <memcmp_avx2+0x9e>
+  return 0;
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801018:	c9                   	leave
+  801019:	c3                   	ret
+
+000000000080101a <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80101a:	55                   	push   %rbp
+  80101b:	48 89 e5             	mov    %rsp,%rbp
+  80101e:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801022:	48 83 ec 60          	sub    $0x60,%rsp
+  801026:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80102b:	89 f0                	mov    %esi,%eax
+  80102d:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801032:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801036:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80103b:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80103f:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801044:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80104a:	eb 47                	jmp    801093 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80104c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801051:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801055:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801059:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80105f:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801063:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801067:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80106b:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801070:	74 15                	je     801087 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801072:	31 c0                	xor    %eax,%eax
+  801074:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80107a:	48 63 d0             	movslq %eax,%rdx
+  80107d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801082:	48 01 d0             	add    %rdx,%rax
+  801085:	eb 3d                	jmp    8010c4 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801087:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80108d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801093:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801099:	77 b1                	ja     80104c <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80109b:	eb 0c                	jmp    8010a9 <memfind_avx2+0x8f>
+  80109d:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010a3:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010a9:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010af:	74 0e                	je     8010bf <memfind_avx2+0xa5>
+  8010b1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010b6:	0f b6 00             	movzbl (%rax),%eax
+  8010b9:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8010bd:	75 de                	jne    80109d <memfind_avx2+0x83>
+  return s;
+  8010bf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8010c4:	c9                   	leave
+  8010c5:	c3                   	ret
+
+00000000008010c6 <strlen>:
+strlen(const char *s) {
+  8010c6:	55                   	push   %rbp
+  8010c7:	48 89 e5             	mov    %rsp,%rbp
+  8010ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8010ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8010d2:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8010d6:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8010da:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  8010e1:	00 00 00 
+  8010e4:	ff d0                	call   *%rax
+  8010e6:	83 e0 02             	and    $0x2,%eax
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	74 18                	je     801105 <strlen+0x3f>
+    return strlen_avx2(s);
+  8010ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010f1:	48 89 c7             	mov    %rax,%rdi
+  8010f4:	48 b8 7b 0e 80 00 00 	movabs $0x800e7b,%rax
+  8010fb:	00 00 00 
+  8010fe:	ff d0                	call   *%rax
+  801100:	e9 82 00 00 00       	jmp    801187 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801105:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801109:	83 e0 0f             	and    $0xf,%eax
+  80110c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80110f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801112:	48 f7 d8             	neg    %rax
+  801115:	48 89 c2             	mov    %rax,%rdx
+  801118:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80111c:	48 01 d0             	add    %rdx,%rax
+  80111f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801123:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801127:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80112b:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801130:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801134:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801138:	89 c2                	mov    %eax,%edx
+  80113a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80113d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801142:	89 c1                	mov    %eax,%ecx
+  801144:	d3 e6                	shl    %cl,%esi
+  801146:	89 f0                	mov    %esi,%eax
+  801148:	21 d0                	and    %edx,%eax
+  80114a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80114d:	eb 1d                	jmp    80116c <strlen+0xa6>
+    p += 16;
+  80114f:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801154:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801158:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80115c:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801161:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801165:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801169:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80116c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801170:	74 dd                	je     80114f <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801172:	31 c0                	xor    %eax,%eax
+  801174:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801179:	48 63 d0             	movslq %eax,%rdx
+  80117c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801180:	48 01 d0             	add    %rdx,%rax
+  801183:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+
+0000000000801189 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	48 83 ec 20          	sub    $0x20,%rsp
+  801191:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801195:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801199:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011a0:	eb 0e                	jmp    8011b0 <strnlen+0x27>
+    n++;
+  8011a2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011a6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011ab:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011b0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011b5:	74 0b                	je     8011c2 <strnlen+0x39>
+  8011b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011bb:	0f b6 00             	movzbl (%rax),%eax
+  8011be:	84 c0                	test   %al,%al
+  8011c0:	75 e0                	jne    8011a2 <strnlen+0x19>
+  return n;
+  8011c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011c5:	c9                   	leave
+  8011c6:	c3                   	ret
+
+00000000008011c7 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8011c7:	55                   	push   %rbp
+  8011c8:	48 89 e5             	mov    %rsp,%rbp
+  8011cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8011cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011d3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8011d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8011df:	90                   	nop
+  8011e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011e4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011f8:	0f b6 12             	movzbl (%rdx),%edx
+  8011fb:	88 10                	mov    %dl,(%rax)
+  8011fd:	0f b6 00             	movzbl (%rax),%eax
+  801200:	84 c0                	test   %al,%al
+  801202:	75 dc                	jne    8011e0 <strcpy+0x19>
+  return ret;
+  801204:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+000000000080120a <strcat>:
+strcat(char *dst, const char *src) {
+  80120a:	55                   	push   %rbp
+  80120b:	48 89 e5             	mov    %rsp,%rbp
+  80120e:	48 83 ec 20          	sub    $0x20,%rsp
+  801212:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801216:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80121a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121e:	48 89 c7             	mov    %rax,%rdi
+  801221:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  801228:	00 00 00 
+  80122b:	ff d0                	call   *%rax
+  80122d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801230:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801233:	48 63 d0             	movslq %eax,%rdx
+  801236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80123a:	48 01 c2             	add    %rax,%rdx
+  80123d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801241:	48 89 c6             	mov    %rax,%rsi
+  801244:	48 89 d7             	mov    %rdx,%rdi
+  801247:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  80124e:	00 00 00 
+  801251:	ff d0                	call   *%rax
+  return dst;
+  801253:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801257:	c9                   	leave
+  801258:	c3                   	ret
+
+0000000000801259 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801259:	55                   	push   %rbp
+  80125a:	48 89 e5             	mov    %rsp,%rbp
+  80125d:	48 83 ec 28          	sub    $0x28,%rsp
+  801261:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801265:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801269:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80126d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801271:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801275:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80127c:	00 
+  80127d:	eb 2a                	jmp    8012a9 <strncpy+0x50>
+    *dst++ = *src;
+  80127f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801283:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801287:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80128b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80128f:	0f b6 12             	movzbl (%rdx),%edx
+  801292:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801298:	0f b6 00             	movzbl (%rax),%eax
+  80129b:	84 c0                	test   %al,%al
+  80129d:	74 05                	je     8012a4 <strncpy+0x4b>
+      src++;
+  80129f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012a4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ad:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012b1:	72 cc                	jb     80127f <strncpy+0x26>
+  return ret;
+  8012b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+
+00000000008012b9 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8012b9:	55                   	push   %rbp
+  8012ba:	48 89 e5             	mov    %rsp,%rbp
+  8012bd:	48 83 ec 28          	sub    $0x28,%rsp
+  8012c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012c9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8012cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8012d5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012da:	74 3d                	je     801319 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8012dc:	eb 1d                	jmp    8012fb <strlcpy+0x42>
+      *dst++ = *src++;
+  8012de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012e2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ee:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012f6:	0f b6 12             	movzbl (%rdx),%edx
+  8012f9:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8012fb:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801300:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801305:	74 0b                	je     801312 <strlcpy+0x59>
+  801307:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80130b:	0f b6 00             	movzbl (%rax),%eax
+  80130e:	84 c0                	test   %al,%al
+  801310:	75 cc                	jne    8012de <strlcpy+0x25>
+    *dst = '\0';
+  801312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801316:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+
+0000000000801323 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801323:	55                   	push   %rbp
+  801324:	48 89 e5             	mov    %rsp,%rbp
+  801327:	48 83 ec 30          	sub    $0x30,%rsp
+  80132b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80132f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801333:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80133b:	48 89 c7             	mov    %rax,%rdi
+  80133e:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+  80134a:	48 98                	cltq
+  80134c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801350:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801354:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801358:	48 89 d6             	mov    %rdx,%rsi
+  80135b:	48 89 c7             	mov    %rax,%rdi
+  80135e:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  801365:	00 00 00 
+  801368:	ff d0                	call   *%rax
+  80136a:	48 98                	cltq
+  80136c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801370:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801374:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801378:	75 10                	jne    80138a <strlcat+0x67>
+    return maxlen + srclen;
+  80137a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80137e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801382:	48 01 d0             	add    %rdx,%rax
+  801385:	e9 86 00 00 00       	jmp    801410 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80138a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80138e:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801392:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801396:	73 2b                	jae    8013c3 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80139c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013a0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a8:	48 01 c1             	add    %rax,%rcx
+  8013ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013af:	48 89 c6             	mov    %rax,%rsi
+  8013b2:	48 89 cf             	mov    %rcx,%rdi
+  8013b5:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  8013bc:	00 00 00 
+  8013bf:	ff d0                	call   *%rax
+  8013c1:	eb 42                	jmp    801405 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8013c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013c7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d3:	48 01 c1             	add    %rax,%rcx
+  8013d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013da:	48 89 c6             	mov    %rax,%rsi
+  8013dd:	48 89 cf             	mov    %rcx,%rdi
+  8013e0:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  8013e7:	00 00 00 
+  8013ea:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8013ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013f4:	48 01 d0             	add    %rdx,%rax
+  8013f7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ff:	48 01 d0             	add    %rdx,%rax
+  801402:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801405:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80140d:	48 01 d0             	add    %rdx,%rax
+}
+  801410:	c9                   	leave
+  801411:	c3                   	ret
+
+0000000000801412 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801412:	55                   	push   %rbp
+  801413:	48 89 e5             	mov    %rsp,%rbp
+  801416:	48 83 ec 10          	sub    $0x10,%rsp
+  80141a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80141e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801422:	eb 0a                	jmp    80142e <strcmp+0x1c>
+    p++, q++;
+  801424:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801429:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80142e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801432:	0f b6 00             	movzbl (%rax),%eax
+  801435:	84 c0                	test   %al,%al
+  801437:	74 12                	je     80144b <strcmp+0x39>
+  801439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80143d:	0f b6 10             	movzbl (%rax),%edx
+  801440:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801444:	0f b6 00             	movzbl (%rax),%eax
+  801447:	38 c2                	cmp    %al,%dl
+  801449:	74 d9                	je     801424 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80144b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144f:	0f b6 00             	movzbl (%rax),%eax
+  801452:	0f b6 d0             	movzbl %al,%edx
+  801455:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801459:	0f b6 00             	movzbl (%rax),%eax
+  80145c:	0f b6 c0             	movzbl %al,%eax
+  80145f:	29 c2                	sub    %eax,%edx
+  801461:	89 d0                	mov    %edx,%eax
+}
+  801463:	c9                   	leave
+  801464:	c3                   	ret
+
+0000000000801465 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801465:	55                   	push   %rbp
+  801466:	48 89 e5             	mov    %rsp,%rbp
+  801469:	48 83 ec 18          	sub    $0x18,%rsp
+  80146d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801471:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801475:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801479:	eb 0f                	jmp    80148a <strncmp+0x25>
+    n--, p++, q++;
+  80147b:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801480:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801485:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80148a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80148f:	74 1d                	je     8014ae <strncmp+0x49>
+  801491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801495:	0f b6 00             	movzbl (%rax),%eax
+  801498:	84 c0                	test   %al,%al
+  80149a:	74 12                	je     8014ae <strncmp+0x49>
+  80149c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a0:	0f b6 10             	movzbl (%rax),%edx
+  8014a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a7:	0f b6 00             	movzbl (%rax),%eax
+  8014aa:	38 c2                	cmp    %al,%dl
+  8014ac:	74 cd                	je     80147b <strncmp+0x16>
+  if (n == 0)
+  8014ae:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014b3:	75 07                	jne    8014bc <strncmp+0x57>
+    return 0;
+  8014b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ba:	eb 16                	jmp    8014d2 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8014bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c0:	0f b6 00             	movzbl (%rax),%eax
+  8014c3:	0f b6 d0             	movzbl %al,%edx
+  8014c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ca:	0f b6 00             	movzbl (%rax),%eax
+  8014cd:	0f b6 c0             	movzbl %al,%eax
+  8014d0:	29 c2                	sub    %eax,%edx
+}
+  8014d2:	89 d0                	mov    %edx,%eax
+  8014d4:	c9                   	leave
+  8014d5:	c3                   	ret
+
+00000000008014d6 <strchr>:
+strchr(const char *s, char c) {
+  8014d6:	55                   	push   %rbp
+  8014d7:	48 89 e5             	mov    %rsp,%rbp
+  8014da:	48 83 ec 60          	sub    $0x60,%rsp
+  8014de:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8014e2:	89 f0                	mov    %esi,%eax
+  8014e4:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8014e7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014eb:	83 e0 0f             	and    $0xf,%eax
+  8014ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8014f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8014f4:	48 f7 d8             	neg    %rax
+  8014f7:	48 89 c2             	mov    %rax,%rdx
+  8014fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014fe:	48 01 d0             	add    %rdx,%rax
+  801501:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801505:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801509:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80150d:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801511:	66 0f 6e c0          	movd   %eax,%xmm0
+  801515:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801519:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80151d:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801522:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801526:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80152e:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801532:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801537:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80153c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801540:	89 c2                	mov    %eax,%edx
+  801542:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801547:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80154c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801550:	09 c2                	or     %eax,%edx
+  801552:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801555:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80155a:	89 c1                	mov    %eax,%ecx
+  80155c:	d3 e6                	shl    %cl,%esi
+  80155e:	89 f0                	mov    %esi,%eax
+  801560:	21 d0                	and    %edx,%eax
+  801562:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801565:	eb 34                	jmp    80159b <strchr+0xc5>
+    p += 16;
+  801567:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80156c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801570:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801574:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801578:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80157d:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801582:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801586:	89 c2                	mov    %eax,%edx
+  801588:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80158d:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801592:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801596:	09 d0                	or     %edx,%eax
+  801598:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80159b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80159f:	74 c6                	je     801567 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015a1:	31 c0                	xor    %eax,%eax
+  8015a3:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015a8:	48 98                	cltq
+  8015aa:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b2:	0f b6 00             	movzbl (%rax),%eax
+  8015b5:	84 c0                	test   %al,%al
+  8015b7:	74 06                	je     8015bf <strchr+0xe9>
+  8015b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015bd:	eb 05                	jmp    8015c4 <strchr+0xee>
+  8015bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c4:	c9                   	leave
+  8015c5:	c3                   	ret
+
+00000000008015c6 <strfind>:
+strfind(const char *s, char c) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8015ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d2:	89 f0                	mov    %esi,%eax
+  8015d4:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8015d7:	eb 11                	jmp    8015ea <strfind+0x24>
+    if (*s == c)
+  8015d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015dd:	0f b6 00             	movzbl (%rax),%eax
+  8015e0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015e3:	74 12                	je     8015f7 <strfind+0x31>
+  for (; *s; s++)
+  8015e5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ee:	0f b6 00             	movzbl (%rax),%eax
+  8015f1:	84 c0                	test   %al,%al
+  8015f3:	75 e4                	jne    8015d9 <strfind+0x13>
+  8015f5:	eb 01                	jmp    8015f8 <strfind+0x32>
+      break;
+  8015f7:	90                   	nop
+  return (char *)s;
+  8015f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015fc:	c9                   	leave
+  8015fd:	c3                   	ret
+
+00000000008015fe <memset>:
+memset(void *v, int c, size_t n) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	48 83 ec 38          	sub    $0x38,%rsp
+  801606:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80160a:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80160d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801611:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801615:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801619:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80161e:	76 41                	jbe    801661 <memset+0x63>
+  801620:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+  80162c:	83 e0 01             	and    $0x1,%eax
+  80162f:	85 c0                	test   %eax,%eax
+  801631:	74 2e                	je     801661 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801633:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801636:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80163a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80163e:	48 89 ce             	mov    %rcx,%rsi
+  801641:	48 89 f7             	mov    %rsi,%rdi
+  801644:	48 89 d1             	mov    %rdx,%rcx
+  801647:	fc                   	cld
+  801648:	f3 aa                	rep stos %al,%es:(%rdi)
+  80164a:	48 89 ca             	mov    %rcx,%rdx
+  80164d:	48 89 fe             	mov    %rdi,%rsi
+  801650:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801654:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165c:	e9 a7 00 00 00       	jmp    801708 <memset+0x10a>
+  if (n >= 8) {
+  801661:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801666:	0f 86 87 00 00 00    	jbe    8016f3 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  80166c:	eb 16                	jmp    801684 <memset+0x86>
+      *p++ = c;
+  80166e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801672:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801676:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80167a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80167d:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80167f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801684:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801688:	83 e0 07             	and    $0x7,%eax
+  80168b:	48 85 c0             	test   %rax,%rax
+  80168e:	75 de                	jne    80166e <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801690:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801693:	0f b6 c0             	movzbl %al,%eax
+  801696:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80169d:	01 01 01 
+  8016a0:	48 0f af c2          	imul   %rdx,%rax
+  8016a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016ac:	48 c1 e8 03          	shr    $0x3,%rax
+  8016b0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016c0:	48 89 ce             	mov    %rcx,%rsi
+  8016c3:	48 89 f7             	mov    %rsi,%rdi
+  8016c6:	48 89 d1             	mov    %rdx,%rcx
+  8016c9:	fc                   	cld
+  8016ca:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016cd:	48 89 ca             	mov    %rcx,%rdx
+  8016d0:	48 89 fe             	mov    %rdi,%rsi
+  8016d3:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016d7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8016db:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8016e0:	eb 11                	jmp    8016f3 <memset+0xf5>
+    *p++ = c;
+  8016e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016ea:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016ee:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016f1:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8016f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016fb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016ff:	48 85 c0             	test   %rax,%rax
+  801702:	75 de                	jne    8016e2 <memset+0xe4>
+  return v;
+  801704:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+000000000080170a <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	48 83 ec 38          	sub    $0x38,%rsp
+  801712:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801716:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80171a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80171e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801722:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801726:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80172a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80172e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801732:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801736:	0f 83 da 00 00 00    	jae    801816 <memmove+0x10c>
+  80173c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801740:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801744:	48 01 d0             	add    %rdx,%rax
+  801747:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80174b:	0f 83 c5 00 00 00    	jae    801816 <memmove+0x10c>
+    s += n;
+  801751:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801755:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801759:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801761:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801766:	0f 86 94 00 00 00    	jbe    801800 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80176c:	eb 1c                	jmp    80178a <memmove+0x80>
+        *--d = *--s;
+  80176e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801773:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80177c:	0f b6 10             	movzbl (%rax),%edx
+  80177f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801783:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801785:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80178a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178e:	83 e0 07             	and    $0x7,%eax
+  801791:	48 85 c0             	test   %rax,%rax
+  801794:	75 d8                	jne    80176e <memmove+0x64>
+      nq = n / 8;
+  801796:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80179a:	48 c1 e8 03          	shr    $0x3,%rax
+  80179e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017a2:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017a7:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017ac:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017b1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017bd:	48 89 cf             	mov    %rcx,%rdi
+  8017c0:	48 89 d6             	mov    %rdx,%rsi
+  8017c3:	48 89 c1             	mov    %rax,%rcx
+  8017c6:	fd                   	std
+  8017c7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017ca:	fc                   	cld
+  8017cb:	48 89 c8             	mov    %rcx,%rax
+  8017ce:	48 89 f2             	mov    %rsi,%rdx
+  8017d1:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8017d5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8017dd:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8017e2:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8017e7:	eb 17                	jmp    801800 <memmove+0xf6>
+      *--d = *--s;
+  8017e9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017ee:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f7:	0f b6 10             	movzbl (%rax),%edx
+  8017fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017fe:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801800:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801804:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801808:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80180c:	48 85 c0             	test   %rax,%rax
+  80180f:	75 d8                	jne    8017e9 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801811:	e9 f4 00 00 00       	jmp    80190a <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801816:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80181b:	76 46                	jbe    801863 <memmove+0x159>
+  80181d:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801824:	00 00 00 
+  801827:	ff d0                	call   *%rax
+  801829:	83 e0 01             	and    $0x1,%eax
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	74 33                	je     801863 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801830:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801834:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801838:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80183c:	48 89 cf             	mov    %rcx,%rdi
+  80183f:	48 89 d6             	mov    %rdx,%rsi
+  801842:	48 89 c1             	mov    %rax,%rcx
+  801845:	fc                   	cld
+  801846:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801848:	48 89 c8             	mov    %rcx,%rax
+  80184b:	48 89 f2             	mov    %rsi,%rdx
+  80184e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801852:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801856:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80185a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185e:	e9 ab 00 00 00       	jmp    80190e <memmove+0x204>
+    if (n >= 8) {
+  801863:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801868:	0f 86 8b 00 00 00    	jbe    8018f9 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80186e:	eb 22                	jmp    801892 <memmove+0x188>
+        *d++ = *s++;
+  801870:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801874:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801878:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80187c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801880:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801884:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801888:	0f b6 12             	movzbl (%rdx),%edx
+  80188b:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80188d:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801892:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801896:	83 e0 07             	and    $0x7,%eax
+  801899:	48 85 c0             	test   %rax,%rax
+  80189c:	75 d2                	jne    801870 <memmove+0x166>
+      nq = n / 8;
+  80189e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a2:	48 c1 e8 03          	shr    $0x3,%rax
+  8018a6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b6:	48 89 cf             	mov    %rcx,%rdi
+  8018b9:	48 89 d6             	mov    %rdx,%rsi
+  8018bc:	48 89 c1             	mov    %rax,%rcx
+  8018bf:	fc                   	cld
+  8018c0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018c3:	48 89 c8             	mov    %rcx,%rax
+  8018c6:	48 89 f2             	mov    %rsi,%rdx
+  8018c9:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018cd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018d1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018d5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8018da:	eb 1d                	jmp    8018f9 <memmove+0x1ef>
+      *d++ = *s++;
+  8018dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018f0:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8018f4:	0f b6 12             	movzbl (%rdx),%edx
+  8018f7:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801901:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801905:	48 85 c0             	test   %rax,%rax
+  801908:	75 d2                	jne    8018dc <memmove+0x1d2>
+  return dst;
+  80190a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+0000000000801910 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	48 83 ec 18          	sub    $0x18,%rsp
+  801918:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80191c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801920:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801924:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801928:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80192c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801930:	48 89 ce             	mov    %rcx,%rsi
+  801933:	48 89 c7             	mov    %rax,%rdi
+  801936:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  80193d:	00 00 00 
+  801940:	ff d0                	call   *%rax
+}
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+0000000000801944 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	48 83 ec 40          	sub    $0x40,%rsp
+  80194c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801950:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801954:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801958:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801960:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801964:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801968:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80196d:	0f 86 a7 00 00 00    	jbe    801a1a <memcmp+0xd6>
+  801973:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+  80197f:	83 e0 02             	and    $0x2,%eax
+  801982:	85 c0                	test   %eax,%eax
+  801984:	0f 84 90 00 00 00    	je     801a1a <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80198a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80198e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801992:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801996:	48 89 ce             	mov    %rcx,%rsi
+  801999:	48 89 c7             	mov    %rax,%rdi
+  80199c:	48 b8 2b 0f 80 00 00 	movabs $0x800f2b,%rax
+  8019a3:	00 00 00 
+  8019a6:	ff d0                	call   *%rax
+  8019a8:	e9 c2 00 00 00       	jmp    801a6f <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b1:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019b5:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8019b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019bd:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019c1:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8019c5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8019cc:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8019d3:	74 36                	je     801a0b <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8019d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019d8:	f7 d0                	not    %eax
+  8019da:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8019de:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8019e1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8019e4:	48 63 d0             	movslq %eax,%rdx
+  8019e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019eb:	48 01 d0             	add    %rdx,%rax
+  8019ee:	0f b6 00             	movzbl (%rax),%eax
+  8019f1:	0f b6 c0             	movzbl %al,%eax
+  8019f4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8019f7:	48 63 ca             	movslq %edx,%rcx
+  8019fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019fe:	48 01 ca             	add    %rcx,%rdx
+  801a01:	0f b6 12             	movzbl (%rdx),%edx
+  801a04:	0f b6 d2             	movzbl %dl,%edx
+  801a07:	29 d0                	sub    %edx,%eax
+  801a09:	eb 64                	jmp    801a6f <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a0b:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a10:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a15:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a1a:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a1f:	77 8c                	ja     8019ad <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a21:	eb 36                	jmp    801a59 <memcmp+0x115>
+    if (*s1 != *s2)
+  801a23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a27:	0f b6 10             	movzbl (%rax),%edx
+  801a2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2e:	0f b6 00             	movzbl (%rax),%eax
+  801a31:	38 c2                	cmp    %al,%dl
+  801a33:	74 1a                	je     801a4f <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a39:	0f b6 00             	movzbl (%rax),%eax
+  801a3c:	0f b6 c8             	movzbl %al,%ecx
+  801a3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a43:	0f b6 00             	movzbl (%rax),%eax
+  801a46:	0f b6 d0             	movzbl %al,%edx
+  801a49:	89 c8                	mov    %ecx,%eax
+  801a4b:	29 d0                	sub    %edx,%eax
+  801a4d:	eb 20                	jmp    801a6f <memcmp+0x12b>
+    s1++, s2++;
+  801a4f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a54:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801a59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a5d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a61:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a65:	48 85 c0             	test   %rax,%rax
+  801a68:	75 b9                	jne    801a23 <memcmp+0xdf>
+  }
+
+  return 0;
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a6f:	c9                   	leave
+  801a70:	c3                   	ret
+
+0000000000801a71 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	48 83 ec 50          	sub    $0x50,%rsp
+  801a79:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801a7d:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801a80:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801a84:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a88:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a8c:	48 01 d0             	add    %rdx,%rax
+  801a8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801a93:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801a96:	66 0f 6e c0          	movd   %eax,%xmm0
+  801a9a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801a9e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801aa2:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801aa7:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801aab:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ab0:	76 73                	jbe    801b25 <memfind+0xb4>
+  801ab2:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801ab9:	00 00 00 
+  801abc:	ff d0                	call   *%rax
+  801abe:	83 e0 02             	and    $0x2,%eax
+  801ac1:	85 c0                	test   %eax,%eax
+  801ac3:	74 60                	je     801b25 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801ac5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ac8:	0f b6 c8             	movzbl %al,%ecx
+  801acb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801acf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ad3:	89 ce                	mov    %ecx,%esi
+  801ad5:	48 89 c7             	mov    %rax,%rdi
+  801ad8:	48 b8 1a 10 80 00 00 	movabs $0x80101a,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	eb 6c                	jmp    801b52 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801ae6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aea:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801aee:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801af2:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801af7:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801afb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801aff:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b02:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b06:	74 13                	je     801b1b <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b08:	31 c0                	xor    %eax,%eax
+  801b0a:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b0f:	48 63 d0             	movslq %eax,%rdx
+  801b12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b16:	48 01 d0             	add    %rdx,%rax
+  801b19:	eb 37                	jmp    801b52 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b1b:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b20:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b25:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b2a:	77 ba                	ja     801ae6 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b2c:	eb 13                	jmp    801b41 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b32:	0f b6 00             	movzbl (%rax),%eax
+  801b35:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b38:	38 d0                	cmp    %dl,%al
+  801b3a:	74 11                	je     801b4d <memfind+0xdc>
+  for (; s < ends; s++)
+  801b3c:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b45:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b49:	72 e3                	jb     801b2e <memfind+0xbd>
+  801b4b:	eb 01                	jmp    801b4e <memfind+0xdd>
+      break;
+  801b4d:	90                   	nop
+  return (void *)s;
+  801b4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b52:	c9                   	leave
+  801b53:	c3                   	ret
+
+0000000000801b54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b54:	55                   	push   %rbp
+  801b55:	48 89 e5             	mov    %rsp,%rbp
+  801b58:	48 83 ec 38          	sub    $0x38,%rsp
+  801b5c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b60:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b64:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801b67:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801b6e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b75:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801b76:	eb 05                	jmp    801b7d <strtol+0x29>
+    s++;
+  801b78:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801b7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b81:	0f b6 00             	movzbl (%rax),%eax
+  801b84:	3c 20                	cmp    $0x20,%al
+  801b86:	74 f0                	je     801b78 <strtol+0x24>
+  801b88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8c:	0f b6 00             	movzbl (%rax),%eax
+  801b8f:	3c 09                	cmp    $0x9,%al
+  801b91:	74 e5                	je     801b78 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801b93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b97:	0f b6 00             	movzbl (%rax),%eax
+  801b9a:	3c 2b                	cmp    $0x2b,%al
+  801b9c:	75 07                	jne    801ba5 <strtol+0x51>
+    s++;
+  801b9e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ba3:	eb 17                	jmp    801bbc <strtol+0x68>
+  else if (*s == '-')
+  801ba5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ba9:	0f b6 00             	movzbl (%rax),%eax
+  801bac:	3c 2d                	cmp    $0x2d,%al
+  801bae:	75 0c                	jne    801bbc <strtol+0x68>
+    s++, neg = 1;
+  801bb0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bb5:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bbc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bc0:	74 06                	je     801bc8 <strtol+0x74>
+  801bc2:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bc6:	75 28                	jne    801bf0 <strtol+0x9c>
+  801bc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bcc:	0f b6 00             	movzbl (%rax),%eax
+  801bcf:	3c 30                	cmp    $0x30,%al
+  801bd1:	75 1d                	jne    801bf0 <strtol+0x9c>
+  801bd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd7:	48 83 c0 01          	add    $0x1,%rax
+  801bdb:	0f b6 00             	movzbl (%rax),%eax
+  801bde:	3c 78                	cmp    $0x78,%al
+  801be0:	75 0e                	jne    801bf0 <strtol+0x9c>
+    s += 2, base = 16;
+  801be2:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801be7:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bee:	eb 2c                	jmp    801c1c <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801bf0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bf4:	75 19                	jne    801c0f <strtol+0xbb>
+  801bf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bfa:	0f b6 00             	movzbl (%rax),%eax
+  801bfd:	3c 30                	cmp    $0x30,%al
+  801bff:	75 0e                	jne    801c0f <strtol+0xbb>
+    s++, base = 8;
+  801c01:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c06:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c0d:	eb 0d                	jmp    801c1c <strtol+0xc8>
+  else if (base == 0)
+  801c0f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c13:	75 07                	jne    801c1c <strtol+0xc8>
+    base = 10;
+  801c15:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c20:	0f b6 00             	movzbl (%rax),%eax
+  801c23:	3c 2f                	cmp    $0x2f,%al
+  801c25:	7e 1d                	jle    801c44 <strtol+0xf0>
+  801c27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2b:	0f b6 00             	movzbl (%rax),%eax
+  801c2e:	3c 39                	cmp    $0x39,%al
+  801c30:	7f 12                	jg     801c44 <strtol+0xf0>
+      dig = *s - '0';
+  801c32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c36:	0f b6 00             	movzbl (%rax),%eax
+  801c39:	0f be c0             	movsbl %al,%eax
+  801c3c:	83 e8 30             	sub    $0x30,%eax
+  801c3f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c42:	eb 4e                	jmp    801c92 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c48:	0f b6 00             	movzbl (%rax),%eax
+  801c4b:	3c 60                	cmp    $0x60,%al
+  801c4d:	7e 1d                	jle    801c6c <strtol+0x118>
+  801c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c53:	0f b6 00             	movzbl (%rax),%eax
+  801c56:	3c 7a                	cmp    $0x7a,%al
+  801c58:	7f 12                	jg     801c6c <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801c5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5e:	0f b6 00             	movzbl (%rax),%eax
+  801c61:	0f be c0             	movsbl %al,%eax
+  801c64:	83 e8 57             	sub    $0x57,%eax
+  801c67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c6a:	eb 26                	jmp    801c92 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801c6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c70:	0f b6 00             	movzbl (%rax),%eax
+  801c73:	3c 40                	cmp    $0x40,%al
+  801c75:	7e 47                	jle    801cbe <strtol+0x16a>
+  801c77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7b:	0f b6 00             	movzbl (%rax),%eax
+  801c7e:	3c 5a                	cmp    $0x5a,%al
+  801c80:	7f 3c                	jg     801cbe <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801c82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c86:	0f b6 00             	movzbl (%rax),%eax
+  801c89:	0f be c0             	movsbl %al,%eax
+  801c8c:	83 e8 37             	sub    $0x37,%eax
+  801c8f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801c92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c95:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c98:	7d 23                	jge    801cbd <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801c9a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c9f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ca2:	48 98                	cltq
+  801ca4:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801ca9:	48 89 c2             	mov    %rax,%rdx
+  801cac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801caf:	48 98                	cltq
+  801cb1:	48 01 d0             	add    %rdx,%rax
+  801cb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cb8:	e9 5f ff ff ff       	jmp    801c1c <strtol+0xc8>
+      break;
+  801cbd:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801cbe:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cc3:	74 0b                	je     801cd0 <strtol+0x17c>
+    *endptr = (char *)s;
+  801cc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cc9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ccd:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801cd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cd4:	74 09                	je     801cdf <strtol+0x18b>
+  801cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cda:	48 f7 d8             	neg    %rax
+  801cdd:	eb 04                	jmp    801ce3 <strtol+0x18f>
+  801cdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ce3:	c9                   	leave
+  801ce4:	c3                   	ret
+
+0000000000801ce5 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801ce5:	55                   	push   %rbp
+  801ce6:	48 89 e5             	mov    %rsp,%rbp
+  801ce9:	53                   	push   %rbx
+  801cea:	48 83 ec 48          	sub    $0x48,%rsp
+  801cee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cf2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cf6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cfa:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801cfe:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d02:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d0e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d12:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d16:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d1a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d1e:	4c 89 c3             	mov    %r8,%rbx
+  801d21:	cd 30                	int    $0x30
+  801d23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d27:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d2c:	74 46                	je     801d74 <syscall+0x8f>
+  801d2e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d33:	7e 3f                	jle    801d74 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d35:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3d:	49 89 d0             	mov    %rdx,%r8
+  801d40:	48 89 c1             	mov    %rax,%rcx
+  801d43:	48 b8 28 55 80 00 00 	movabs $0x805528,%rax
+  801d4a:	00 00 00 
+  801d4d:	48 89 c2             	mov    %rax,%rdx
+  801d50:	be 22 00 00 00       	mov    $0x22,%esi
+  801d55:	48 b8 47 55 80 00 00 	movabs $0x805547,%rax
+  801d5c:	00 00 00 
+  801d5f:	48 89 c7             	mov    %rax,%rdi
+  801d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d67:	49 b9 25 4b 80 00 00 	movabs $0x804b25,%r9
+  801d6e:	00 00 00 
+  801d71:	41 ff d1             	call   *%r9
+
+  return ret;
+  801d74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d7c:	c9                   	leave
+  801d7d:	c3                   	ret
+
+0000000000801d7e <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	48 83 ec 10          	sub    $0x10,%rsp
+  801d86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d8a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d8e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d96:	48 83 ec 08          	sub    $0x8,%rsp
+  801d9a:	6a 00                	push   $0x0
+  801d9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801da2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801da8:	48 89 d1             	mov    %rdx,%rcx
+  801dab:	48 89 c2             	mov    %rax,%rdx
+  801dae:	be 00 00 00 00       	mov    $0x0,%esi
+  801db3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db8:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801dbf:	00 00 00 
+  801dc2:	ff d0                	call   *%rax
+  801dc4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dc8:	90                   	nop
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+0000000000801dcb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801dcb:	55                   	push   %rbp
+  801dcc:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801dcf:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd3:	6a 00                	push   $0x0
+  801dd5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ddb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801deb:	be 00 00 00 00       	mov    $0x0,%esi
+  801df0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801df5:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+  801e01:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+0000000000801e07 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e15:	48 98                	cltq
+  801e17:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1b:	6a 00                	push   $0x0
+  801e1d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2e:	48 89 c2             	mov    %rax,%rdx
+  801e31:	be 01 00 00 00       	mov    $0x1,%esi
+  801e36:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e3b:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+  801e47:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e4b:	c9                   	leave
+  801e4c:	c3                   	ret
+
+0000000000801e4d <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e4d:	55                   	push   %rbp
+  801e4e:	48 89 e5             	mov    %rsp,%rbp
+  801e51:	48 83 ec 10          	sub    $0x10,%rsp
+  801e55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e5b:	48 98                	cltq
+  801e5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e61:	6a 00                	push   $0x0
+  801e63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e74:	48 89 c2             	mov    %rax,%rdx
+  801e77:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e81:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e91:	90                   	nop
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+0000000000801e94 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	48 83 ec 20          	sub    $0x20,%rsp
+  801e9c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801e9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801ea3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ea6:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801ea9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eae:	cd 30                	int    $0x30
+  801eb0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801eb4:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801eb8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801ebd:	7e 3d                	jle    801efc <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801ebf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec3:	49 89 c0             	mov    %rax,%r8
+  801ec6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ecb:	48 b8 28 55 80 00 00 	movabs $0x805528,%rax
+  801ed2:	00 00 00 
+  801ed5:	48 89 c2             	mov    %rax,%rdx
+  801ed8:	be 49 00 00 00       	mov    $0x49,%esi
+  801edd:	48 b8 47 55 80 00 00 	movabs $0x805547,%rax
+  801ee4:	00 00 00 
+  801ee7:	48 89 c7             	mov    %rax,%rdi
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eef:	49 b9 25 4b 80 00 00 	movabs $0x804b25,%r9
+  801ef6:	00 00 00 
+  801ef9:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801efc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f01:	75 13                	jne    801f16 <sys_env_wait+0x82>
+  801f03:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f08:	74 0c                	je     801f16 <sys_env_wait+0x82>
+    *status = st;
+  801f0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f0e:	89 c2                	mov    %eax,%edx
+  801f10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f14:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f1a:	c9                   	leave
+  801f1b:	c3                   	ret
+
+0000000000801f1c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f1c:	55                   	push   %rbp
+  801f1d:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f20:	48 83 ec 08          	sub    $0x8,%rsp
+  801f24:	6a 00                	push   $0x0
+  801f26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f41:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f46:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+0000000000801f58 <sys_yield>:
+
+void
+sys_yield(void) {
+  801f58:	55                   	push   %rbp
+  801f59:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f5c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f60:	6a 00                	push   $0x0
+  801f62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f78:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f82:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f92:	90                   	nop
+  801f93:	c9                   	leave
+  801f94:	c3                   	ret
+
+0000000000801f95 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801f95:	55                   	push   %rbp
+  801f96:	48 89 e5             	mov    %rsp,%rbp
+  801f99:	48 83 ec 20          	sub    $0x20,%rsp
+  801f9d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fa0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801fa4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fa7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801faa:	48 63 c8             	movslq %eax,%rcx
+  801fad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fb4:	48 98                	cltq
+  801fb6:	48 83 ec 08          	sub    $0x8,%rsp
+  801fba:	6a 00                	push   $0x0
+  801fbc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fc2:	49 89 c8             	mov    %rcx,%r8
+  801fc5:	48 89 d1             	mov    %rdx,%rcx
+  801fc8:	48 89 c2             	mov    %rax,%rdx
+  801fcb:	be 01 00 00 00       	mov    $0x1,%esi
+  801fd0:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fd5:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	48 83 c4 10          	add    $0x10,%rsp
+  801fe5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  801fe8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801feb:	c9                   	leave
+  801fec:	c3                   	ret
+
+0000000000801fed <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801fed:	55                   	push   %rbp
+  801fee:	48 89 e5             	mov    %rsp,%rbp
+  801ff1:	48 83 ec 20          	sub    $0x20,%rsp
+  801ff5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ffc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801fff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802003:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802007:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80200a:	48 63 c8             	movslq %eax,%rcx
+  80200d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802011:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802014:	48 63 f0             	movslq %eax,%rsi
+  802017:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80201b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80201e:	48 98                	cltq
+  802020:	48 83 ec 08          	sub    $0x8,%rsp
+  802024:	51                   	push   %rcx
+  802025:	49 89 f9             	mov    %rdi,%r9
+  802028:	49 89 f0             	mov    %rsi,%r8
+  80202b:	48 89 d1             	mov    %rdx,%rcx
+  80202e:	48 89 c2             	mov    %rax,%rdx
+  802031:	be 01 00 00 00       	mov    $0x1,%esi
+  802036:	bf 07 00 00 00       	mov    $0x7,%edi
+  80203b:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+000000000080204d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80204d:	55                   	push   %rbp
+  80204e:	48 89 e5             	mov    %rsp,%rbp
+  802051:	48 83 ec 10          	sub    $0x10,%rsp
+  802055:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802058:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80205c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802060:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802063:	48 98                	cltq
+  802065:	48 83 ec 08          	sub    $0x8,%rsp
+  802069:	6a 00                	push   $0x0
+  80206b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802077:	48 89 d1             	mov    %rdx,%rcx
+  80207a:	48 89 c2             	mov    %rax,%rdx
+  80207d:	be 01 00 00 00       	mov    $0x1,%esi
+  802082:	bf 08 00 00 00       	mov    $0x8,%edi
+  802087:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+  802093:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802097:	c9                   	leave
+  802098:	c3                   	ret
+
+0000000000802099 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802099:	55                   	push   %rbp
+  80209a:	48 89 e5             	mov    %rsp,%rbp
+  80209d:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020a4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020a7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020aa:	48 63 d0             	movslq %eax,%rdx
+  8020ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b0:	48 98                	cltq
+  8020b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c4:	48 89 d1             	mov    %rdx,%rcx
+  8020c7:	48 89 c2             	mov    %rax,%rdx
+  8020ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8020cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020d4:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+
+00000000008020e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8020f5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020fc:	48 98                	cltq
+  8020fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802102:	6a 00                	push   $0x0
+  802104:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802110:	48 89 d1             	mov    %rdx,%rcx
+  802113:	48 89 c2             	mov    %rax,%rdx
+  802116:	be 01 00 00 00       	mov    $0x1,%esi
+  80211b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802120:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+  80212c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+
+0000000000802132 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802132:	55                   	push   %rbp
+  802133:	48 89 e5             	mov    %rsp,%rbp
+  802136:	48 83 ec 10          	sub    $0x10,%rsp
+  80213a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80213d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802141:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802145:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802148:	48 98                	cltq
+  80214a:	48 83 ec 08          	sub    $0x8,%rsp
+  80214e:	6a 00                	push   $0x0
+  802150:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802156:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80215c:	48 89 d1             	mov    %rdx,%rcx
+  80215f:	48 89 c2             	mov    %rax,%rdx
+  802162:	be 01 00 00 00       	mov    $0x1,%esi
+  802167:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80216c:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802173:	00 00 00 
+  802176:	ff d0                	call   *%rax
+  802178:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80217c:	c9                   	leave
+  80217d:	c3                   	ret
+
+000000000080217e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	48 83 ec 20          	sub    $0x20,%rsp
+  802186:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802189:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80218d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802191:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802194:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802197:	48 63 f0             	movslq %eax,%rsi
+  80219a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80219e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021a5:	48 98                	cltq
+  8021a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ab:	6a 00                	push   $0x0
+  8021ad:	49 89 f1             	mov    %rsi,%r9
+  8021b0:	49 89 c8             	mov    %rcx,%r8
+  8021b3:	48 89 d1             	mov    %rdx,%rcx
+  8021b6:	48 89 c2             	mov    %rax,%rdx
+  8021b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021be:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8021c3:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+  8021cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d3:	c9                   	leave
+  8021d4:	c3                   	ret
+
+00000000008021d5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8021dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8021e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e9:	6a 00                	push   $0x0
+  8021eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021fc:	48 89 c2             	mov    %rax,%rdx
+  8021ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802204:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802209:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+  802215:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+
+000000000080221b <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80221b:	55                   	push   %rbp
+  80221c:	48 89 e5             	mov    %rsp,%rbp
+  80221f:	48 83 ec 10          	sub    $0x10,%rsp
+  802223:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802227:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80222b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80222f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802233:	48 83 ec 08          	sub    $0x8,%rsp
+  802237:	6a 00                	push   $0x0
+  802239:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80223f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802245:	48 89 d1             	mov    %rdx,%rcx
+  802248:	48 89 c2             	mov    %rax,%rdx
+  80224b:	be 01 00 00 00       	mov    $0x1,%esi
+  802250:	bf 10 00 00 00       	mov    $0x10,%edi
+  802255:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+
+0000000000802267 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80226b:	48 83 ec 08          	sub    $0x8,%rsp
+  80226f:	6a 00                	push   $0x0
+  802271:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802277:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80227d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802282:	ba 00 00 00 00       	mov    $0x0,%edx
+  802287:	be 00 00 00 00       	mov    $0x0,%esi
+  80228c:	bf 11 00 00 00       	mov    $0x11,%edi
+  802291:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802298:	00 00 00 
+  80229b:	ff d0                	call   *%rax
+  80229d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a1:	c9                   	leave
+  8022a2:	c3                   	ret
+
+00000000008022a3 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022a3:	55                   	push   %rbp
+  8022a4:	48 89 e5             	mov    %rsp,%rbp
+  8022a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8022bf:	6a 00                	push   $0x0
+  8022c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022cd:	48 89 d1             	mov    %rdx,%rcx
+  8022d0:	48 89 c2             	mov    %rax,%rdx
+  8022d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d8:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022dd:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8022e4:	00 00 00 
+  8022e7:	ff d0                	call   *%rax
+  8022e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ed:	c9                   	leave
+  8022ee:	c3                   	ret
+
+00000000008022ef <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8022ef:	55                   	push   %rbp
+  8022f0:	48 89 e5             	mov    %rsp,%rbp
+  8022f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8022f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022ff:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802302:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802305:	48 63 c8             	movslq %eax,%rcx
+  802308:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80230c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802310:	48 83 ec 08          	sub    $0x8,%rsp
+  802314:	6a 00                	push   $0x0
+  802316:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80231c:	49 89 c8             	mov    %rcx,%r8
+  80231f:	48 89 d1             	mov    %rdx,%rcx
+  802322:	48 89 c2             	mov    %rax,%rdx
+  802325:	be 00 00 00 00       	mov    $0x0,%esi
+  80232a:	bf 13 00 00 00       	mov    $0x13,%edi
+  80232f:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+  80233b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+
+0000000000802341 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	48 83 ec 20          	sub    $0x20,%rsp
+  802349:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80234d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802350:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802354:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802358:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80235b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80235f:	48 83 ec 08          	sub    $0x8,%rsp
+  802363:	6a 00                	push   $0x0
+  802365:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80236b:	49 89 c8             	mov    %rcx,%r8
+  80236e:	48 89 d1             	mov    %rdx,%rcx
+  802371:	48 89 c2             	mov    %rax,%rdx
+  802374:	be 00 00 00 00       	mov    $0x0,%esi
+  802379:	bf 14 00 00 00       	mov    $0x14,%edi
+  80237e:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+
+0000000000802390 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+  802394:	48 83 ec 10          	sub    $0x10,%rsp
+  802398:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80239c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  80239f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023a2:	48 63 d0             	movslq %eax,%rdx
+  8023a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ad:	6a 00                	push   $0x0
+  8023af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023bb:	48 89 d1             	mov    %rdx,%rcx
+  8023be:	48 89 c2             	mov    %rax,%rdx
+  8023c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c6:	bf 15 00 00 00       	mov    $0x15,%edi
+  8023cb:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8023d2:	00 00 00 
+  8023d5:	ff d0                	call   *%rax
+  8023d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023db:	c9                   	leave
+  8023dc:	c3                   	ret
+
+00000000008023dd <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8023dd:	55                   	push   %rbp
+  8023de:	48 89 e5             	mov    %rsp,%rbp
+  8023e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8023e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023e9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023ec:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8023ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8023f3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023f7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8023fa:	48 63 c8             	movslq %eax,%rcx
+  8023fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802400:	48 63 d0             	movslq %eax,%rdx
+  802403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802407:	48 83 ec 08          	sub    $0x8,%rsp
+  80240b:	6a 00                	push   $0x0
+  80240d:	49 89 f1             	mov    %rsi,%r9
+  802410:	49 89 c8             	mov    %rcx,%r8
+  802413:	48 89 d1             	mov    %rdx,%rcx
+  802416:	48 89 c2             	mov    %rax,%rdx
+  802419:	be 00 00 00 00       	mov    $0x0,%esi
+  80241e:	bf 16 00 00 00       	mov    $0x16,%edi
+  802423:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+  80242f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+
+0000000000802435 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	48 83 ec 30          	sub    $0x30,%rsp
+  80243d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802441:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802445:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802449:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80244d:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802451:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802455:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802459:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80245d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802465:	48 83 ec 08          	sub    $0x8,%rsp
+  802469:	51                   	push   %rcx
+  80246a:	49 89 f9             	mov    %rdi,%r9
+  80246d:	49 89 f0             	mov    %rsi,%r8
+  802470:	48 89 d1             	mov    %rdx,%rcx
+  802473:	48 89 c2             	mov    %rax,%rdx
+  802476:	be 00 00 00 00       	mov    $0x0,%esi
+  80247b:	bf 17 00 00 00       	mov    $0x17,%edi
+  802480:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+  80248c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802490:	c9                   	leave
+  802491:	c3                   	ret
+
+0000000000802492 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802492:	55                   	push   %rbp
+  802493:	48 89 e5             	mov    %rsp,%rbp
+  802496:	48 83 ec 10          	sub    $0x10,%rsp
+  80249a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80249d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024a0:	48 98                	cltq
+  8024a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a6:	6a 00                	push   $0x0
+  8024a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024b9:	48 89 c2             	mov    %rax,%rdx
+  8024bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c1:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024c6:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+  8024d2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d6:	90                   	nop
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+00000000008024d9 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+  8024dd:	48 83 ec 30          	sub    $0x30,%rsp
+  8024e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024e8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024ec:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8024ef:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024f2:	48 63 f0             	movslq %eax,%rsi
+  8024f5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8024f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8024fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802500:	48 98                	cltq
+  802502:	48 83 ec 08          	sub    $0x8,%rsp
+  802506:	6a 00                	push   $0x0
+  802508:	49 89 f1             	mov    %rsi,%r9
+  80250b:	49 89 c8             	mov    %rcx,%r8
+  80250e:	48 89 d1             	mov    %rdx,%rcx
+  802511:	48 89 c2             	mov    %rax,%rdx
+  802514:	be 01 00 00 00       	mov    $0x1,%esi
+  802519:	bf 19 00 00 00       	mov    $0x19,%edi
+  80251e:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+  80252a:	48 83 c4 10          	add    $0x10,%rsp
+  80252e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802531:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802534:	c9                   	leave
+  802535:	c3                   	ret
+
+0000000000802536 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802536:	55                   	push   %rbp
+  802537:	48 89 e5             	mov    %rsp,%rbp
+  80253a:	48 83 ec 20          	sub    $0x20,%rsp
+  80253e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802542:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802546:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802549:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80254c:	48 63 c8             	movslq %eax,%rcx
+  80254f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802553:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802557:	48 83 ec 08          	sub    $0x8,%rsp
+  80255b:	6a 00                	push   $0x0
+  80255d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802563:	49 89 c8             	mov    %rcx,%r8
+  802566:	48 89 d1             	mov    %rdx,%rcx
+  802569:	48 89 c2             	mov    %rax,%rdx
+  80256c:	be 01 00 00 00       	mov    $0x1,%esi
+  802571:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802576:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802586:	c9                   	leave
+  802587:	c3                   	ret
+
+0000000000802588 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	48 83 ec 20          	sub    $0x20,%rsp
+  802590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802594:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802598:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  80259c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ac:	6a 00                	push   $0x0
+  8025ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b4:	49 89 c8             	mov    %rcx,%r8
+  8025b7:	48 89 d1             	mov    %rdx,%rcx
+  8025ba:	48 89 c2             	mov    %rax,%rdx
+  8025bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c2:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8025c7:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+  8025d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025d7:	c9                   	leave
+  8025d8:	c3                   	ret
+
+00000000008025d9 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8025d9:	55                   	push   %rbp
+  8025da:	48 89 e5             	mov    %rsp,%rbp
+  8025dd:	48 83 ec 30          	sub    $0x30,%rsp
+  8025e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025e9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8025ec:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8025f0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8025f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025f7:	48 63 c8             	movslq %eax,%rcx
+  8025fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802602:	48 83 ec 08          	sub    $0x8,%rsp
+  802606:	6a 00                	push   $0x0
+  802608:	49 89 f1             	mov    %rsi,%r9
+  80260b:	49 89 c8             	mov    %rcx,%r8
+  80260e:	48 89 d1             	mov    %rdx,%rcx
+  802611:	48 89 c2             	mov    %rax,%rdx
+  802614:	be 01 00 00 00       	mov    $0x1,%esi
+  802619:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80261e:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+  80262a:	48 83 c4 10          	add    $0x10,%rsp
+  80262e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802631:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802634:	c9                   	leave
+  802635:	c3                   	ret
+
+0000000000802636 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802636:	55                   	push   %rbp
+  802637:	48 89 e5             	mov    %rsp,%rbp
+  80263a:	48 83 ec 10          	sub    $0x10,%rsp
+  80263e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802641:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802644:	48 98                	cltq
+  802646:	48 83 ec 08          	sub    $0x8,%rsp
+  80264a:	6a 00                	push   $0x0
+  80264c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802652:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802658:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80265d:	48 89 c2             	mov    %rax,%rdx
+  802660:	be 01 00 00 00       	mov    $0x1,%esi
+  802665:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80266a:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+  802676:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	48 83 ec 08          	sub    $0x8,%rsp
+  802684:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802688:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80268c:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802693:	ff ff ff 
+  802696:	48 01 d0             	add    %rdx,%rax
+  802699:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80269d:	c9                   	leave
+  80269e:	c3                   	ret
+
+000000000080269f <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  80269f:	55                   	push   %rbp
+  8026a0:	48 89 e5             	mov    %rsp,%rbp
+  8026a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026af:	48 89 c7             	mov    %rax,%rdi
+  8026b2:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  8026b9:	00 00 00 
+  8026bc:	ff d0                	call   *%rax
+  8026be:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8026c4:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8026c8:	c9                   	leave
+  8026c9:	c3                   	ret
+
+00000000008026ca <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8026d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026dd:	e9 ae 00 00 00       	jmp    802790 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8026e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026e5:	c1 e0 0c             	shl    $0xc,%eax
+  8026e8:	48 98                	cltq
+  8026ea:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026ef:	48 01 d0             	add    %rdx,%rax
+  8026f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8026f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8026fe:	48 89 c2             	mov    %rax,%rdx
+  802701:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802708:	01 00 00 
+  80270b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80270f:	83 e0 01             	and    $0x1,%eax
+  802712:	48 85 c0             	test   %rax,%rax
+  802715:	74 63                	je     80277a <fd_alloc+0xb0>
+  802717:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80271b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80271f:	48 89 c2             	mov    %rax,%rdx
+  802722:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802729:	01 00 00 
+  80272c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802730:	83 e0 01             	and    $0x1,%eax
+  802733:	48 85 c0             	test   %rax,%rax
+  802736:	74 42                	je     80277a <fd_alloc+0xb0>
+  802738:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80273c:	48 c1 e8 15          	shr    $0x15,%rax
+  802740:	48 89 c2             	mov    %rax,%rdx
+  802743:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80274a:	01 00 00 
+  80274d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802751:	83 e0 01             	and    $0x1,%eax
+  802754:	48 85 c0             	test   %rax,%rax
+  802757:	74 21                	je     80277a <fd_alloc+0xb0>
+  802759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80275d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802761:	48 89 c2             	mov    %rax,%rdx
+  802764:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80276b:	01 00 00 
+  80276e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802772:	83 e0 01             	and    $0x1,%eax
+  802775:	48 85 c0             	test   %rax,%rax
+  802778:	75 12                	jne    80278c <fd_alloc+0xc2>
+      *fd_store = fd;
+  80277a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80277e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802782:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278a:	eb 1e                	jmp    8027aa <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80278c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802790:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802794:	0f 8e 48 ff ff ff    	jle    8026e2 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80279a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80279e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027a5:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027aa:	c9                   	leave
+  8027ab:	c3                   	ret
+
+00000000008027ac <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027ac:	55                   	push   %rbp
+  8027ad:	48 89 e5             	mov    %rsp,%rbp
+  8027b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8027b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8027bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027bf:	78 06                	js     8027c7 <fd_lookup+0x1b>
+  8027c1:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8027c5:	7e 0a                	jle    8027d1 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8027c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027cc:	e9 af 00 00 00       	jmp    802880 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8027d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027d4:	c1 e0 0c             	shl    $0xc,%eax
+  8027d7:	48 98                	cltq
+  8027d9:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027de:	48 01 d0             	add    %rdx,%rax
+  8027e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8027e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027e9:	48 c1 e8 27          	shr    $0x27,%rax
+  8027ed:	48 89 c2             	mov    %rax,%rdx
+  8027f0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027f7:	01 00 00 
+  8027fa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027fe:	83 e0 01             	and    $0x1,%eax
+  802801:	48 85 c0             	test   %rax,%rax
+  802804:	74 63                	je     802869 <fd_lookup+0xbd>
+  802806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80280a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80280e:	48 89 c2             	mov    %rax,%rdx
+  802811:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802818:	01 00 00 
+  80281b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80281f:	83 e0 01             	and    $0x1,%eax
+  802822:	48 85 c0             	test   %rax,%rax
+  802825:	74 42                	je     802869 <fd_lookup+0xbd>
+  802827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80282b:	48 c1 e8 15          	shr    $0x15,%rax
+  80282f:	48 89 c2             	mov    %rax,%rdx
+  802832:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802839:	01 00 00 
+  80283c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802840:	83 e0 01             	and    $0x1,%eax
+  802843:	48 85 c0             	test   %rax,%rax
+  802846:	74 21                	je     802869 <fd_lookup+0xbd>
+  802848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80284c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802850:	48 89 c2             	mov    %rax,%rdx
+  802853:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80285a:	01 00 00 
+  80285d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802861:	83 e0 01             	and    $0x1,%eax
+  802864:	48 85 c0             	test   %rax,%rax
+  802867:	75 07                	jne    802870 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802869:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80286e:	eb 10                	jmp    802880 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802870:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802874:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802878:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80287b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+0000000000802882 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	48 83 ec 30          	sub    $0x30,%rsp
+  80288a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80288e:	89 f0                	mov    %esi,%eax
+  802890:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802893:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802897:	48 89 c7             	mov    %rax,%rdi
+  80289a:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	89 c2                	mov    %eax,%edx
+  8028a8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028ac:	48 89 c6             	mov    %rax,%rsi
+  8028af:	89 d7                	mov    %edx,%edi
+  8028b1:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028c4:	78 0a                	js     8028d0 <fd_close+0x4e>
+  8028c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ca:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8028ce:	74 12                	je     8028e2 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8028d0:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8028d4:	74 05                	je     8028db <fd_close+0x59>
+  8028d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028d9:	eb 70                	jmp    80294b <fd_close+0xc9>
+  8028db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e0:	eb 69                	jmp    80294b <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028e6:	8b 00                	mov    (%rax),%eax
+  8028e8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028ec:	48 89 d6             	mov    %rdx,%rsi
+  8028ef:	89 c7                	mov    %eax,%edi
+  8028f1:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+  8028fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802900:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802904:	78 2a                	js     802930 <fd_close+0xae>
+    if (dev->dev_close)
+  802906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80290a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80290e:	48 85 c0             	test   %rax,%rax
+  802911:	74 16                	je     802929 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802913:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802917:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80291b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80291f:	48 89 c7             	mov    %rax,%rdi
+  802922:	ff d2                	call   *%rdx
+  802924:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802927:	eb 07                	jmp    802930 <fd_close+0xae>
+    else
+      r = 0;
+  802929:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802930:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802934:	48 89 c6             	mov    %rax,%rsi
+  802937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293c:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+  return r;
+  802948:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80294b:	c9                   	leave
+  80294c:	c3                   	ret
+
+000000000080294d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80294d:	55                   	push   %rbp
+  80294e:	48 89 e5             	mov    %rsp,%rbp
+  802951:	48 83 ec 20          	sub    $0x20,%rsp
+  802955:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802958:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  80295c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802963:	eb 3f                	jmp    8029a4 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802965:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80296c:	00 00 00 
+  80296f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802972:	48 98                	cltq
+  802974:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802978:	8b 00                	mov    (%rax),%eax
+  80297a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80297d:	75 21                	jne    8029a0 <dev_lookup+0x53>
+      *dev = devtab[i];
+  80297f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802986:	00 00 00 
+  802989:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80298c:	48 98                	cltq
+  80298e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802992:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802996:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299e:	eb 7f                	jmp    802a1f <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029a0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029a4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029ab:	00 00 00 
+  8029ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b1:	48 98                	cltq
+  8029b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029b7:	48 85 c0             	test   %rax,%rax
+  8029ba:	75 a9                	jne    802965 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8029bc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8029c3:	00 00 00 
+  8029c6:	8b 40 04             	mov    0x4(%rax),%eax
+  8029c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029ce:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029d5:	00 00 00 
+  8029d8:	48 98                	cltq
+  8029da:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029e1:	48 01 d0             	add    %rdx,%rax
+  8029e4:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029ea:	8b 00                	mov    (%rax),%eax
+  8029ec:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029ef:	89 c6                	mov    %eax,%esi
+  8029f1:	48 b8 58 55 80 00 00 	movabs $0x805558,%rax
+  8029f8:	00 00 00 
+  8029fb:	48 89 c7             	mov    %rax,%rdi
+  8029fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a03:	48 b9 17 02 80 00 00 	movabs $0x800217,%rcx
+  802a0a:	00 00 00 
+  802a0d:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a13:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+0000000000802a21 <close>:
+
+int
+close(int fdnum) {
+  802a21:	55                   	push   %rbp
+  802a22:	48 89 e5             	mov    %rsp,%rbp
+  802a25:	48 83 ec 20          	sub    $0x20,%rsp
+  802a29:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a2c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a33:	48 89 d6             	mov    %rdx,%rsi
+  802a36:	89 c7                	mov    %eax,%edi
+  802a38:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a4b:	79 05                	jns    802a52 <close+0x31>
+    return r;
+  802a4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a50:	eb 18                	jmp    802a6a <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a56:	be 01 00 00 00       	mov    $0x1,%esi
+  802a5b:	48 89 c7             	mov    %rax,%rdi
+  802a5e:	48 b8 82 28 80 00 00 	movabs $0x802882,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+0000000000802a6c <close_all>:
+
+void
+close_all(void) {
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+  802a70:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802a74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a7b:	eb 15                	jmp    802a92 <close_all+0x26>
+    close(i);
+  802a7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a80:	89 c7                	mov    %eax,%edi
+  802a82:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802a8e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a92:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a96:	7e e5                	jle    802a7d <close_all+0x11>
+}
+  802a98:	90                   	nop
+  802a99:	90                   	nop
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+
+0000000000802a9c <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+  802aa0:	48 83 ec 40          	sub    $0x40,%rsp
+  802aa4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802aa7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802aaa:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802aae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ab1:	48 89 d6             	mov    %rdx,%rsi
+  802ab4:	89 c7                	mov    %eax,%edi
+  802ab6:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+  802ac2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ac5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ac9:	79 08                	jns    802ad3 <dup+0x37>
+    return r;
+  802acb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ace:	e9 33 02 00 00       	jmp    802d06 <dup+0x26a>
+  close(newfdnum);
+  802ad3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802ad6:	89 c7                	mov    %eax,%edi
+  802ad8:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802ae4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802ae7:	c1 e0 0c             	shl    $0xc,%eax
+  802aea:	48 98                	cltq
+  802aec:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802af1:	48 01 d0             	add    %rdx,%rax
+  802af4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802af8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802afc:	48 89 c7             	mov    %rax,%rdi
+  802aff:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  802b06:	00 00 00 
+  802b09:	ff d0                	call   *%rax
+  802b0b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b13:	48 89 c7             	mov    %rax,%rdi
+  802b16:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  802b1d:	00 00 00 
+  802b20:	ff d0                	call   *%rax
+  802b22:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b26:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b2d:	00 
+  802b2e:	e9 19 01 00 00       	jmp    802c4c <dup+0x1b0>
+    off -= PGSIZE;
+  802b33:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b3a:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b3b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b43:	48 01 d0             	add    %rdx,%rax
+  802b46:	48 c1 e8 27          	shr    $0x27,%rax
+  802b4a:	48 89 c2             	mov    %rax,%rdx
+  802b4d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b54:	01 00 00 
+  802b57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b5b:	83 e0 01             	and    $0x1,%eax
+  802b5e:	48 85 c0             	test   %rax,%rax
+  802b61:	0f 84 e5 00 00 00    	je     802c4c <dup+0x1b0>
+  802b67:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b6f:	48 01 d0             	add    %rdx,%rax
+  802b72:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b76:	48 89 c2             	mov    %rax,%rdx
+  802b79:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b80:	01 00 00 
+  802b83:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b87:	83 e0 01             	and    $0x1,%eax
+  802b8a:	48 85 c0             	test   %rax,%rax
+  802b8d:	0f 84 b9 00 00 00    	je     802c4c <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802b93:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b9b:	48 01 d0             	add    %rdx,%rax
+  802b9e:	48 c1 e8 15          	shr    $0x15,%rax
+  802ba2:	48 89 c2             	mov    %rax,%rdx
+  802ba5:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bac:	01 00 00 
+  802baf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bb3:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bb6:	48 85 c0             	test   %rax,%rax
+  802bb9:	0f 84 8d 00 00 00    	je     802c4c <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bbf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bc7:	48 01 d0             	add    %rdx,%rax
+  802bca:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bce:	48 89 c2             	mov    %rax,%rdx
+  802bd1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bd8:	01 00 00 
+  802bdb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bdf:	83 e0 01             	and    $0x1,%eax
+  802be2:	48 85 c0             	test   %rax,%rax
+  802be5:	74 65                	je     802c4c <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802be7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bef:	48 01 d0             	add    %rdx,%rax
+  802bf2:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bf6:	48 89 c2             	mov    %rax,%rdx
+  802bf9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c00:	01 00 00 
+  802c03:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c07:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c0c:	89 c6                	mov    %eax,%esi
+  802c0e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c16:	48 01 c2             	add    %rax,%rdx
+  802c19:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c21:	48 01 c8             	add    %rcx,%rax
+  802c24:	41 89 f0             	mov    %esi,%r8d
+  802c27:	48 89 d1             	mov    %rdx,%rcx
+  802c2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c2f:	48 89 c6             	mov    %rax,%rsi
+  802c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c37:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+  802c43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c4a:	78 60                	js     802cac <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c4c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c51:	0f 85 dc fe ff ff    	jne    802b33 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c5f:	48 89 c2             	mov    %rax,%rdx
+  802c62:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c69:	01 00 00 
+  802c6c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c70:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c75:	89 c1                	mov    %eax,%ecx
+  802c77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c7f:	41 89 c8             	mov    %ecx,%r8d
+  802c82:	48 89 d1             	mov    %rdx,%rcx
+  802c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8a:	48 89 c6             	mov    %rax,%rsi
+  802c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c92:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca5:	78 08                	js     802caf <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802ca7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802caa:	eb 5a                	jmp    802d06 <dup+0x26a>
+        goto err;
+  802cac:	90                   	nop
+  802cad:	eb 01                	jmp    802cb0 <dup+0x214>
+    goto err;
+  802caf:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb4:	48 89 c6             	mov    %rax,%rsi
+  802cb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cbc:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cc8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ccf:	00 
+  802cd0:	eb 27                	jmp    802cf9 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802cd2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cda:	48 01 d0             	add    %rdx,%rax
+  802cdd:	48 89 c6             	mov    %rax,%rsi
+  802ce0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce5:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cf1:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802cf8:	00 
+  802cf9:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d00:	00 
+  802d01:	76 cf                	jbe    802cd2 <dup+0x236>
+  return r;
+  802d03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d06:	c9                   	leave
+  802d07:	c3                   	ret
+
+0000000000802d08 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d08:	55                   	push   %rbp
+  802d09:	48 89 e5             	mov    %rsp,%rbp
+  802d0c:	48 83 ec 40          	sub    $0x40,%rsp
+  802d10:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d13:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d17:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d1b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d22:	48 89 d6             	mov    %rdx,%rsi
+  802d25:	89 c7                	mov    %eax,%edi
+  802d27:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802d2e:	00 00 00 
+  802d31:	ff d0                	call   *%rax
+  802d33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d36:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d3a:	78 24                	js     802d60 <read+0x58>
+  802d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d40:	8b 00                	mov    (%rax),%eax
+  802d42:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d46:	48 89 d6             	mov    %rdx,%rsi
+  802d49:	89 c7                	mov    %eax,%edi
+  802d4b:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+  802d57:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d5a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d5e:	79 0a                	jns    802d6a <read+0x62>
+    return r;
+  802d60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d63:	48 98                	cltq
+  802d65:	e9 9e 00 00 00       	jmp    802e08 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d6e:	8b 40 08             	mov    0x8(%rax),%eax
+  802d71:	83 e0 03             	and    $0x3,%eax
+  802d74:	83 f8 01             	cmp    $0x1,%eax
+  802d77:	75 5c                	jne    802dd5 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d79:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d80:	00 00 00 
+  802d83:	8b 40 04             	mov    0x4(%rax),%eax
+  802d86:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d8b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d92:	00 00 00 
+  802d95:	48 98                	cltq
+  802d97:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802d9e:	48 01 d0             	add    %rdx,%rax
+  802da1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802da7:	8b 00                	mov    (%rax),%eax
+  802da9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802dac:	89 c6                	mov    %eax,%esi
+  802dae:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  802db5:	00 00 00 
+  802db8:	48 89 c7             	mov    %rax,%rdi
+  802dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc0:	48 b9 17 02 80 00 00 	movabs $0x800217,%rcx
+  802dc7:	00 00 00 
+  802dca:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802dcc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dd3:	eb 33                	jmp    802e08 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802dd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ddd:	48 85 c0             	test   %rax,%rax
+  802de0:	75 09                	jne    802deb <read+0xe3>
+    return -E_NOT_SUPP;
+  802de2:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802de9:	eb 1d                	jmp    802e08 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802deb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802def:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802df3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802df7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802dfb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802dff:	48 89 ce             	mov    %rcx,%rsi
+  802e02:	48 89 c7             	mov    %rax,%rdi
+  802e05:	41 ff d0             	call   *%r8
+}
+  802e08:	c9                   	leave
+  802e09:	c3                   	ret
+
+0000000000802e0a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e0a:	55                   	push   %rbp
+  802e0b:	48 89 e5             	mov    %rsp,%rbp
+  802e0e:	48 83 ec 30          	sub    $0x30,%rsp
+  802e12:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e15:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e19:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e1d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e24:	eb 49                	jmp    802e6f <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e29:	48 98                	cltq
+  802e2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e2f:	48 29 c2             	sub    %rax,%rdx
+  802e32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e35:	48 63 c8             	movslq %eax,%rcx
+  802e38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e3c:	48 01 c1             	add    %rax,%rcx
+  802e3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e42:	48 89 ce             	mov    %rcx,%rsi
+  802e45:	89 c7                	mov    %eax,%edi
+  802e47:	48 b8 08 2d 80 00 00 	movabs $0x802d08,%rax
+  802e4e:	00 00 00 
+  802e51:	ff d0                	call   *%rax
+  802e53:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e56:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e5a:	79 07                	jns    802e63 <readn+0x59>
+      return m;
+  802e5c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e5f:	48 98                	cltq
+  802e61:	eb 1f                	jmp    802e82 <readn+0x78>
+    if (m == 0)
+  802e63:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e67:	74 13                	je     802e7c <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802e69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e6c:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e72:	48 98                	cltq
+  802e74:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802e78:	72 ac                	jb     802e26 <readn+0x1c>
+  802e7a:	eb 01                	jmp    802e7d <readn+0x73>
+      break;
+  802e7c:	90                   	nop
+  }
+  return tot;
+  802e7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e80:	48 98                	cltq
+}
+  802e82:	c9                   	leave
+  802e83:	c3                   	ret
+
+0000000000802e84 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	48 83 ec 40          	sub    $0x40,%rsp
+  802e8c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e8f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e97:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802e9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e9e:	48 89 d6             	mov    %rdx,%rsi
+  802ea1:	89 c7                	mov    %eax,%edi
+  802ea3:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802eaa:	00 00 00 
+  802ead:	ff d0                	call   *%rax
+  802eaf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802eb2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eb6:	78 24                	js     802edc <write+0x58>
+  802eb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ebc:	8b 00                	mov    (%rax),%eax
+  802ebe:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ec2:	48 89 d6             	mov    %rdx,%rsi
+  802ec5:	89 c7                	mov    %eax,%edi
+  802ec7:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+  802ed3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ed6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eda:	79 0a                	jns    802ee6 <write+0x62>
+    return r;
+  802edc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802edf:	48 98                	cltq
+  802ee1:	e9 9d 00 00 00       	jmp    802f83 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eea:	8b 40 08             	mov    0x8(%rax),%eax
+  802eed:	83 e0 03             	and    $0x3,%eax
+  802ef0:	85 c0                	test   %eax,%eax
+  802ef2:	75 5c                	jne    802f50 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802ef4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802efb:	00 00 00 
+  802efe:	8b 40 04             	mov    0x4(%rax),%eax
+  802f01:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f06:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f0d:	00 00 00 
+  802f10:	48 98                	cltq
+  802f12:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f19:	48 01 d0             	add    %rdx,%rax
+  802f1c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f22:	8b 00                	mov    (%rax),%eax
+  802f24:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f27:	89 c6                	mov    %eax,%esi
+  802f29:	48 b8 93 55 80 00 00 	movabs $0x805593,%rax
+  802f30:	00 00 00 
+  802f33:	48 89 c7             	mov    %rax,%rdi
+  802f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3b:	48 b9 17 02 80 00 00 	movabs $0x800217,%rcx
+  802f42:	00 00 00 
+  802f45:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f47:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f4e:	eb 33                	jmp    802f83 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f54:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f58:	48 85 c0             	test   %rax,%rax
+  802f5b:	75 09                	jne    802f66 <write+0xe2>
+    return -E_NOT_SUPP;
+  802f5d:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f64:	eb 1d                	jmp    802f83 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802f66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f6a:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f72:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f76:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802f7a:	48 89 ce             	mov    %rcx,%rsi
+  802f7d:	48 89 c7             	mov    %rax,%rdi
+  802f80:	41 ff d0             	call   *%r8
+}
+  802f83:	c9                   	leave
+  802f84:	c3                   	ret
+
+0000000000802f85 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802f85:	55                   	push   %rbp
+  802f86:	48 89 e5             	mov    %rsp,%rbp
+  802f89:	48 83 ec 18          	sub    $0x18,%rsp
+  802f8d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f90:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f93:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f9a:	48 89 d6             	mov    %rdx,%rsi
+  802f9d:	89 c7                	mov    %eax,%edi
+  802f9f:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802fa6:	00 00 00 
+  802fa9:	ff d0                	call   *%rax
+  802fab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fb2:	79 05                	jns    802fb9 <seek+0x34>
+    return r;
+  802fb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fb7:	eb 0f                	jmp    802fc8 <seek+0x43>
+  fd->fd_offset = offset;
+  802fb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fbd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802fc0:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fc8:	c9                   	leave
+  802fc9:	c3                   	ret
+
+0000000000802fca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802fca:	55                   	push   %rbp
+  802fcb:	48 89 e5             	mov    %rsp,%rbp
+  802fce:	48 83 ec 30          	sub    $0x30,%rsp
+  802fd2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fd5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fd8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fdc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fdf:	48 89 d6             	mov    %rdx,%rsi
+  802fe2:	89 c7                	mov    %eax,%edi
+  802fe4:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  802feb:	00 00 00 
+  802fee:	ff d0                	call   *%rax
+  802ff0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ff7:	78 24                	js     80301d <ftruncate+0x53>
+  802ff9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ffd:	8b 00                	mov    (%rax),%eax
+  802fff:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803003:	48 89 d6             	mov    %rdx,%rsi
+  803006:	89 c7                	mov    %eax,%edi
+  803008:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  80300f:	00 00 00 
+  803012:	ff d0                	call   *%rax
+  803014:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803017:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80301b:	79 08                	jns    803025 <ftruncate+0x5b>
+    return r;
+  80301d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803020:	e9 92 00 00 00       	jmp    8030b7 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803025:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803029:	8b 40 08             	mov    0x8(%rax),%eax
+  80302c:	83 e0 03             	and    $0x3,%eax
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	75 5a                	jne    80308d <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803033:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80303a:	00 00 00 
+  80303d:	8b 40 04             	mov    0x4(%rax),%eax
+  803040:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803045:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80304c:	00 00 00 
+  80304f:	48 98                	cltq
+  803051:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803058:	48 01 d0             	add    %rdx,%rax
+  80305b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803061:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803063:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803066:	89 c6                	mov    %eax,%esi
+  803068:	48 b8 b0 55 80 00 00 	movabs $0x8055b0,%rax
+  80306f:	00 00 00 
+  803072:	48 89 c7             	mov    %rax,%rdi
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307a:	48 b9 17 02 80 00 00 	movabs $0x800217,%rcx
+  803081:	00 00 00 
+  803084:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803086:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80308b:	eb 2a                	jmp    8030b7 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80308d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803091:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803095:	48 85 c0             	test   %rax,%rax
+  803098:	75 07                	jne    8030a1 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80309a:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80309f:	eb 16                	jmp    8030b7 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ad:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030b0:	89 d6                	mov    %edx,%esi
+  8030b2:	48 89 c7             	mov    %rax,%rdi
+  8030b5:	ff d1                	call   *%rcx
+}
+  8030b7:	c9                   	leave
+  8030b8:	c3                   	ret
+
+00000000008030b9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030b9:	55                   	push   %rbp
+  8030ba:	48 89 e5             	mov    %rsp,%rbp
+  8030bd:	48 83 ec 30          	sub    $0x30,%rsp
+  8030c1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030c8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030cf:	48 89 d6             	mov    %rdx,%rsi
+  8030d2:	89 c7                	mov    %eax,%edi
+  8030d4:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030e7:	78 24                	js     80310d <fstat+0x54>
+  8030e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ed:	8b 00                	mov    (%rax),%eax
+  8030ef:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030f3:	48 89 d6             	mov    %rdx,%rsi
+  8030f6:	89 c7                	mov    %eax,%edi
+  8030f8:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  8030ff:	00 00 00 
+  803102:	ff d0                	call   *%rax
+  803104:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803107:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80310b:	79 05                	jns    803112 <fstat+0x59>
+    return r;
+  80310d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803110:	eb 5e                	jmp    803170 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803112:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803116:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80311a:	48 85 c0             	test   %rax,%rax
+  80311d:	75 07                	jne    803126 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80311f:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803124:	eb 4a                	jmp    803170 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803126:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80312a:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80312d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803131:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803138:	00 00 00 
+  stat->st_isdir   = 0;
+  80313b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313f:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803146:	00 00 00 
+  stat->st_dev     = dev;
+  803149:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80314d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803151:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803158:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80315c:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803160:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803164:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803168:	48 89 d6             	mov    %rdx,%rsi
+  80316b:	48 89 c7             	mov    %rax,%rdi
+  80316e:	ff d1                	call   *%rcx
+}
+  803170:	c9                   	leave
+  803171:	c3                   	ret
+
+0000000000803172 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803172:	55                   	push   %rbp
+  803173:	48 89 e5             	mov    %rsp,%rbp
+  803176:	48 83 ec 10          	sub    $0x10,%rsp
+  80317a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80317e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803186:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80318c:	83 f8 20             	cmp    $0x20,%eax
+  80318f:	75 07                	jne    803198 <pollwait_key+0x26>
+    return -E_INVAL;
+  803191:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803196:	eb 5f                	jmp    8031f7 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803198:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80319c:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031a6:	48 63 d2             	movslq %edx,%rdx
+  8031a9:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031ad:	48 01 c2             	add    %rax,%rdx
+  8031b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b4:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031bb:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8031c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c5:	8b 00                	mov    (%rax),%eax
+  8031c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031cb:	48 63 c9             	movslq %ecx,%rcx
+  8031ce:	48 c1 e1 04          	shl    $0x4,%rcx
+  8031d2:	48 01 ca             	add    %rcx,%rdx
+  8031d5:	48 83 c2 08          	add    $0x8,%rdx
+  8031d9:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8031db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031df:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031e5:	8d 50 01             	lea    0x1(%rax),%edx
+  8031e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ec:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8031f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031f7:	c9                   	leave
+  8031f8:	c3                   	ret
+
+00000000008031f9 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8031f9:	55                   	push   %rbp
+  8031fa:	48 89 e5             	mov    %rsp,%rbp
+  8031fd:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803204:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80320b:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803211:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803218:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80321f:	00 
+  int i, r, ready, ipc = 0;
+  803220:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803227:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80322e:	00 
+  80322f:	74 45                	je     803276 <poll+0x7d>
+  803231:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803238:	ff 
+  803239:	74 3b                	je     803276 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80323b:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+  803247:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80324b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80324f:	48 f7 d0             	not    %rax
+  803252:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803259:	73 10                	jae    80326b <poll+0x72>
+  80325b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80325f:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803266:	48 01 d0             	add    %rdx,%rax
+  803269:	eb 07                	jmp    803272 <poll+0x79>
+  80326b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803272:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803276:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80327d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803284:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80328b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803292:	e9 46 02 00 00       	jmp    8034dd <poll+0x2e4>
+      fds[i].revents = 0;
+  803297:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80329a:	48 63 d0             	movslq %eax,%rdx
+  80329d:	48 89 d0             	mov    %rdx,%rax
+  8032a0:	48 01 c0             	add    %rax,%rax
+  8032a3:	48 01 d0             	add    %rdx,%rax
+  8032a6:	48 c1 e0 02          	shl    $0x2,%rax
+  8032aa:	48 89 c2             	mov    %rax,%rdx
+  8032ad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032b4:	48 01 d0             	add    %rdx,%rax
+  8032b7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8032be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032c1:	48 63 d0             	movslq %eax,%rdx
+  8032c4:	48 89 d0             	mov    %rdx,%rax
+  8032c7:	48 01 c0             	add    %rax,%rax
+  8032ca:	48 01 d0             	add    %rdx,%rax
+  8032cd:	48 c1 e0 02          	shl    $0x2,%rax
+  8032d1:	48 89 c2             	mov    %rax,%rdx
+  8032d4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032db:	48 01 d0             	add    %rdx,%rax
+  8032de:	8b 00                	mov    (%rax),%eax
+  8032e0:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8032e3:	75 62                	jne    803347 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8032e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032e8:	48 63 d0             	movslq %eax,%rdx
+  8032eb:	48 89 d0             	mov    %rdx,%rax
+  8032ee:	48 01 c0             	add    %rax,%rax
+  8032f1:	48 01 d0             	add    %rdx,%rax
+  8032f4:	48 c1 e0 02          	shl    $0x2,%rax
+  8032f8:	48 89 c2             	mov    %rax,%rdx
+  8032fb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803302:	48 01 d0             	add    %rdx,%rax
+  803305:	8b 40 04             	mov    0x4(%rax),%eax
+  803308:	83 e0 01             	and    $0x1,%eax
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	0f 84 9b 01 00 00    	je     8034ae <poll+0x2b5>
+          fds[i].revents = ipc;
+  803313:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803316:	48 63 d0             	movslq %eax,%rdx
+  803319:	48 89 d0             	mov    %rdx,%rax
+  80331c:	48 01 c0             	add    %rax,%rax
+  80331f:	48 01 d0             	add    %rdx,%rax
+  803322:	48 c1 e0 02          	shl    $0x2,%rax
+  803326:	48 89 c2             	mov    %rax,%rdx
+  803329:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803330:	48 01 c2             	add    %rax,%rdx
+  803333:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803336:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803339:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80333c:	83 c8 04             	or     $0x4,%eax
+  80333f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803342:	e9 67 01 00 00       	jmp    8034ae <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803347:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80334a:	48 63 d0             	movslq %eax,%rdx
+  80334d:	48 89 d0             	mov    %rdx,%rax
+  803350:	48 01 c0             	add    %rax,%rax
+  803353:	48 01 d0             	add    %rdx,%rax
+  803356:	48 c1 e0 02          	shl    $0x2,%rax
+  80335a:	48 89 c2             	mov    %rax,%rdx
+  80335d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803364:	48 01 d0             	add    %rdx,%rax
+  803367:	8b 00                	mov    (%rax),%eax
+  803369:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803370:	48 89 d6             	mov    %rdx,%rsi
+  803373:	89 c7                	mov    %eax,%edi
+  803375:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+  803381:	85 c0                	test   %eax,%eax
+  803383:	78 25                	js     8033aa <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803385:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80338c:	8b 00                	mov    (%rax),%eax
+  80338e:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803395:	48 89 d6             	mov    %rdx,%rsi
+  803398:	89 c7                	mov    %eax,%edi
+  80339a:	48 b8 4d 29 80 00 00 	movabs $0x80294d,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	79 2c                	jns    8033d6 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033ad:	48 63 d0             	movslq %eax,%rdx
+  8033b0:	48 89 d0             	mov    %rdx,%rax
+  8033b3:	48 01 c0             	add    %rax,%rax
+  8033b6:	48 01 d0             	add    %rdx,%rax
+  8033b9:	48 c1 e0 02          	shl    $0x2,%rax
+  8033bd:	48 89 c2             	mov    %rax,%rdx
+  8033c0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033c7:	48 01 d0             	add    %rdx,%rax
+  8033ca:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8033d1:	e9 d8 00 00 00       	jmp    8034ae <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8033d6:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033dd:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8033e1:	48 85 c0             	test   %rax,%rax
+  8033e4:	74 7d                	je     803463 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8033e6:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033ed:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8033f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033f4:	48 63 d0             	movslq %eax,%rdx
+  8033f7:	48 89 d0             	mov    %rdx,%rax
+  8033fa:	48 01 c0             	add    %rax,%rax
+  8033fd:	48 01 d0             	add    %rdx,%rax
+  803400:	48 c1 e0 02          	shl    $0x2,%rax
+  803404:	48 89 c2             	mov    %rax,%rdx
+  803407:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80340e:	48 01 d0             	add    %rdx,%rax
+  803411:	8b 48 04             	mov    0x4(%rax),%ecx
+  803414:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80341b:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803422:	89 ce                	mov    %ecx,%esi
+  803424:	48 89 c7             	mov    %rax,%rdi
+  803427:	41 ff d0             	call   *%r8
+  80342a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80342d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803431:	79 08                	jns    80343b <poll+0x242>
+          return r;
+  803433:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803436:	e9 45 01 00 00       	jmp    803580 <poll+0x387>
+        fds[i].revents = r;
+  80343b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80343e:	48 63 d0             	movslq %eax,%rdx
+  803441:	48 89 d0             	mov    %rdx,%rax
+  803444:	48 01 c0             	add    %rax,%rax
+  803447:	48 01 d0             	add    %rdx,%rax
+  80344a:	48 c1 e0 02          	shl    $0x2,%rax
+  80344e:	48 89 c2             	mov    %rax,%rdx
+  803451:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803458:	48 01 c2             	add    %rax,%rdx
+  80345b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80345e:	89 42 08             	mov    %eax,0x8(%rdx)
+  803461:	eb 4b                	jmp    8034ae <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803463:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803466:	48 63 d0             	movslq %eax,%rdx
+  803469:	48 89 d0             	mov    %rdx,%rax
+  80346c:	48 01 c0             	add    %rax,%rax
+  80346f:	48 01 d0             	add    %rdx,%rax
+  803472:	48 c1 e0 02          	shl    $0x2,%rax
+  803476:	48 89 c2             	mov    %rax,%rdx
+  803479:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803480:	48 01 d0             	add    %rdx,%rax
+  803483:	8b 48 04             	mov    0x4(%rax),%ecx
+  803486:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803489:	48 63 d0             	movslq %eax,%rdx
+  80348c:	48 89 d0             	mov    %rdx,%rax
+  80348f:	48 01 c0             	add    %rax,%rax
+  803492:	48 01 d0             	add    %rdx,%rax
+  803495:	48 c1 e0 02          	shl    $0x2,%rax
+  803499:	48 89 c2             	mov    %rax,%rdx
+  80349c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034a3:	48 01 d0             	add    %rdx,%rax
+  8034a6:	83 e1 03             	and    $0x3,%ecx
+  8034a9:	89 ca                	mov    %ecx,%edx
+  8034ab:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034b1:	48 63 d0             	movslq %eax,%rdx
+  8034b4:	48 89 d0             	mov    %rdx,%rax
+  8034b7:	48 01 c0             	add    %rax,%rax
+  8034ba:	48 01 d0             	add    %rdx,%rax
+  8034bd:	48 c1 e0 02          	shl    $0x2,%rax
+  8034c1:	48 89 c2             	mov    %rax,%rdx
+  8034c4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034cb:	48 01 d0             	add    %rdx,%rax
+  8034ce:	8b 40 08             	mov    0x8(%rax),%eax
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	74 04                	je     8034d9 <poll+0x2e0>
+        ready++;
+  8034d5:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034d9:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8034dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034e0:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8034e6:	0f 8c ab fd ff ff    	jl     803297 <poll+0x9e>
+    }
+    if (ready)
+  8034ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8034f0:	74 08                	je     8034fa <poll+0x301>
+      return ready;
+  8034f2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8034f5:	e9 86 00 00 00       	jmp    803580 <poll+0x387>
+
+    if (deadline) {
+  8034fa:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8034ff:	74 30                	je     803531 <poll+0x338>
+      now     = vsys_clock_ns();
+  803501:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  803508:	00 00 00 
+  80350b:	ff d0                	call   *%rax
+  80350d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803511:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803515:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803519:	73 0a                	jae    803525 <poll+0x32c>
+  80351b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80351f:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803523:	eb 05                	jmp    80352a <poll+0x331>
+  803525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352a:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803531:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803534:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803537:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80353e:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803545:	48 89 c7             	mov    %rax,%rdi
+  803548:	48 b8 dd 23 80 00 00 	movabs $0x8023dd,%rax
+  80354f:	00 00 00 
+  803552:	ff d0                	call   *%rax
+  803554:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803557:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80355b:	75 07                	jne    803564 <poll+0x36b>
+      return 0;
+  80355d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803562:	eb 1c                	jmp    803580 <poll+0x387>
+    if (r < 0)
+  803564:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803568:	79 05                	jns    80356f <poll+0x376>
+      return r;
+  80356a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80356d:	eb 11                	jmp    803580 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80356f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803572:	c1 f8 02             	sar    $0x2,%eax
+  803575:	83 e0 01             	and    $0x1,%eax
+  803578:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80357b:	e9 f6 fc ff ff       	jmp    803276 <poll+0x7d>
+  }
+}
+  803580:	c9                   	leave
+  803581:	c3                   	ret
+
+0000000000803582 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803582:	55                   	push   %rbp
+  803583:	48 89 e5             	mov    %rsp,%rbp
+  803586:	48 83 ec 20          	sub    $0x20,%rsp
+  80358a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80358e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803592:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803596:	be 00 00 00 00       	mov    $0x0,%esi
+  80359b:	48 89 c7             	mov    %rax,%rdi
+  80359e:	48 b8 70 36 80 00 00 	movabs $0x803670,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+  8035aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035b1:	79 05                	jns    8035b8 <stat+0x36>
+    return fd;
+  8035b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035b6:	eb 2f                	jmp    8035e7 <stat+0x65>
+  r = fstat(fd, stat);
+  8035b8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035bf:	48 89 d6             	mov    %rdx,%rsi
+  8035c2:	89 c7                	mov    %eax,%edi
+  8035c4:	48 b8 b9 30 80 00 00 	movabs $0x8030b9,%rax
+  8035cb:	00 00 00 
+  8035ce:	ff d0                	call   *%rax
+  8035d0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8035d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035d6:	89 c7                	mov    %eax,%edi
+  8035d8:	48 b8 21 2a 80 00 00 	movabs $0x802a21,%rax
+  8035df:	00 00 00 
+  8035e2:	ff d0                	call   *%rax
+  return r;
+  8035e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+
+00000000008035e9 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8035f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8035f8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8035ff:	00 00 00 
+  803602:	8b 00                	mov    (%rax),%eax
+  803604:	85 c0                	test   %eax,%eax
+  803606:	75 1d                	jne    803625 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803608:	bf 03 00 00 00       	mov    $0x3,%edi
+  80360d:	48 b8 69 4e 80 00 00 	movabs $0x804e69,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+  803619:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803620:	00 00 00 
+  803623:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803625:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80362c:	00 00 00 
+  80362f:	8b 00                	mov    (%rax),%eax
+  803631:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803634:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803639:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803640:	00 00 00 
+  803643:	89 c7                	mov    %eax,%edi
+  803645:	48 b8 bc 4d 80 00 00 	movabs $0x804dbc,%rax
+  80364c:	00 00 00 
+  80364f:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803651:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80365a:	48 89 c6             	mov    %rax,%rsi
+  80365d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803662:	48 b8 3f 4c 80 00 00 	movabs $0x804c3f,%rax
+  803669:	00 00 00 
+  80366c:	ff d0                	call   *%rax
+}
+  80366e:	c9                   	leave
+  80366f:	c3                   	ret
+
+0000000000803670 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803670:	55                   	push   %rbp
+  803671:	48 89 e5             	mov    %rsp,%rbp
+  803674:	48 83 ec 20          	sub    $0x20,%rsp
+  803678:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80367c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80367f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803683:	48 89 c7             	mov    %rax,%rdi
+  803686:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  80368d:	00 00 00 
+  803690:	ff d0                	call   *%rax
+  803692:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803697:	7e 0a                	jle    8036a3 <open+0x33>
+    return -E_BAD_PATH;
+  803699:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80369e:	e9 a8 00 00 00       	jmp    80374b <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036a3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036a7:	48 89 c7             	mov    %rax,%rdi
+  8036aa:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  8036b1:	00 00 00 
+  8036b4:	ff d0                	call   *%rax
+  8036b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036bd:	79 08                	jns    8036c7 <open+0x57>
+    return r;
+  8036bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c2:	e9 84 00 00 00       	jmp    80374b <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8036c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036cb:	48 89 c6             	mov    %rax,%rsi
+  8036ce:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8036d5:	00 00 00 
+  8036d8:	48 89 c7             	mov    %rax,%rdi
+  8036db:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8036e2:	00 00 00 
+  8036e5:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8036e7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8036ee:	00 00 00 
+  8036f1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036f4:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8036fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036fe:	48 89 c6             	mov    %rax,%rsi
+  803701:	bf 01 00 00 00       	mov    $0x1,%edi
+  803706:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  80370d:	00 00 00 
+  803710:	ff d0                	call   *%rax
+  803712:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803715:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803719:	79 1d                	jns    803738 <open+0xc8>
+    fd_close(fd, 0);
+  80371b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80371f:	be 00 00 00 00       	mov    $0x0,%esi
+  803724:	48 89 c7             	mov    %rax,%rdi
+  803727:	48 b8 82 28 80 00 00 	movabs $0x802882,%rax
+  80372e:	00 00 00 
+  803731:	ff d0                	call   *%rax
+    return r;
+  803733:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803736:	eb 13                	jmp    80374b <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803738:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80373c:	48 89 c7             	mov    %rax,%rdi
+  80373f:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  803746:	00 00 00 
+  803749:	ff d0                	call   *%rax
+}
+  80374b:	c9                   	leave
+  80374c:	c3                   	ret
+
+000000000080374d <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80374d:	55                   	push   %rbp
+  80374e:	48 89 e5             	mov    %rsp,%rbp
+  803751:	48 83 ec 10          	sub    $0x10,%rsp
+  803755:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80375d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803760:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803767:	00 00 00 
+  80376a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80376c:	be 00 00 00 00       	mov    $0x0,%esi
+  803771:	bf 06 00 00 00       	mov    $0x6,%edi
+  803776:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+}
+  803782:	c9                   	leave
+  803783:	c3                   	ret
+
+0000000000803784 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803784:	55                   	push   %rbp
+  803785:	48 89 e5             	mov    %rsp,%rbp
+  803788:	48 83 ec 30          	sub    $0x30,%rsp
+  80378c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803790:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803794:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803798:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80379d:	74 07                	je     8037a6 <devfile_read+0x22>
+  80379f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037a4:	75 0a                	jne    8037b0 <devfile_read+0x2c>
+  return E_INVAL;
+  8037a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037ab:	e9 b4 00 00 00       	jmp    803864 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037b0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037b7:	00 
+  while (n) {
+  8037b8:	e9 98 00 00 00       	jmp    803855 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037c1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037c4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037cb:	00 00 00 
+  8037ce:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8037d0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037d7:	00 00 00 
+  8037da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037de:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8037e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8037e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037ec:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+  8037f8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8037fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8037ff:	7f 13                	jg     803814 <devfile_read+0x90>
+      return res ? res : res0;
+  803801:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803805:	74 07                	je     80380e <devfile_read+0x8a>
+  803807:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80380a:	48 98                	cltq
+  80380c:	eb 56                	jmp    803864 <devfile_read+0xe0>
+  80380e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803812:	eb 50                	jmp    803864 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803814:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803817:	48 63 d0             	movslq %eax,%rdx
+  80381a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80381e:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803825:	00 00 00 
+  803828:	48 89 ce             	mov    %rcx,%rsi
+  80382b:	48 89 c7             	mov    %rax,%rdi
+  80382e:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  803835:	00 00 00 
+  803838:	ff d0                	call   *%rax
+
+    buf += res;
+  80383a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80383d:	48 98                	cltq
+  80383f:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803843:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803846:	48 98                	cltq
+  803848:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  80384c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384f:	48 98                	cltq
+  803851:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803855:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80385a:	0f 85 5d ff ff ff    	jne    8037bd <devfile_read+0x39>
+  }
+
+  return res0;
+  803860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803864:	c9                   	leave
+  803865:	c3                   	ret
+
+0000000000803866 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803866:	55                   	push   %rbp
+  803867:	48 89 e5             	mov    %rsp,%rbp
+  80386a:	48 83 ec 50          	sub    $0x50,%rsp
+  80386e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803872:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803876:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80387a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80387f:	74 07                	je     803888 <devfile_write+0x22>
+  803881:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803886:	75 0a                	jne    803892 <devfile_write+0x2c>
+  return E_INVAL;
+  803888:	b8 03 00 00 00       	mov    $0x3,%eax
+  80388d:	e9 c9 00 00 00       	jmp    80395b <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803892:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803899:	00 
+
+  while (n) {
+  80389a:	e9 ad 00 00 00       	jmp    80394c <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80389f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038a7:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038ae:	00 
+  8038af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038b7:	48 39 c2             	cmp    %rax,%rdx
+  8038ba:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8038c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038ca:	48 89 c6             	mov    %rax,%rsi
+  8038cd:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8038d4:	00 00 00 
+  8038d7:	48 89 c7             	mov    %rax,%rdi
+  8038da:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  8038e1:	00 00 00 
+  8038e4:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ea:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038ed:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8038f4:	00 00 00 
+  8038f7:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8038f9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803900:	00 00 00 
+  803903:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803907:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  80390b:	be 00 00 00 00       	mov    $0x0,%esi
+  803910:	bf 04 00 00 00       	mov    $0x4,%edi
+  803915:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  80391c:	00 00 00 
+  80391f:	ff d0                	call   *%rax
+  803921:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803924:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803928:	79 07                	jns    803931 <devfile_write+0xcb>
+      return res;
+  80392a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80392d:	48 98                	cltq
+  80392f:	eb 2a                	jmp    80395b <devfile_write+0xf5>
+
+    buf += res;
+  803931:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803934:	48 98                	cltq
+  803936:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80393a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80393d:	48 98                	cltq
+  80393f:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803943:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803946:	48 98                	cltq
+  803948:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80394c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803951:	0f 85 48 ff ff ff    	jne    80389f <devfile_write+0x39>
+  }
+
+  return res0;
+  803957:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80395b:	c9                   	leave
+  80395c:	c3                   	ret
+
+000000000080395d <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80395d:	55                   	push   %rbp
+  80395e:	48 89 e5             	mov    %rsp,%rbp
+  803961:	48 83 ec 20          	sub    $0x20,%rsp
+  803965:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803969:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80396d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803971:	8b 40 0c             	mov    0xc(%rax),%eax
+  803974:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80397b:	00 00 00 
+  80397e:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803980:	be 00 00 00 00       	mov    $0x0,%esi
+  803985:	bf 05 00 00 00       	mov    $0x5,%edi
+  80398a:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803999:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80399d:	79 05                	jns    8039a4 <devfile_stat+0x47>
+    return r;
+  80399f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a2:	eb 59                	jmp    8039fd <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039af:	00 00 00 
+  8039b2:	48 89 d6             	mov    %rdx,%rsi
+  8039b5:	48 89 c7             	mov    %rax,%rdi
+  8039b8:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8039bf:	00 00 00 
+  8039c2:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8039c4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039cb:	00 00 00 
+  8039ce:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039de:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039e5:	00 00 00 
+  8039e8:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f2:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039fd:	c9                   	leave
+  8039fe:	c3                   	ret
+
+00000000008039ff <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8039ff:	55                   	push   %rbp
+  803a00:	48 89 e5             	mov    %rsp,%rbp
+  803a03:	48 83 ec 10          	sub    $0x10,%rsp
+  803a07:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a0b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a12:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a15:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a1c:	00 00 00 
+  803a1f:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a21:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a28:	00 00 00 
+  803a2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a2e:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a31:	be 00 00 00 00       	mov    $0x0,%esi
+  803a36:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a3b:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+}
+  803a47:	c9                   	leave
+  803a48:	c3                   	ret
+
+0000000000803a49 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a49:	55                   	push   %rbp
+  803a4a:	48 89 e5             	mov    %rsp,%rbp
+  803a4d:	48 83 ec 18          	sub    $0x18,%rsp
+  803a51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a55:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a58:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803a5c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a5f:	83 e0 03             	and    $0x3,%eax
+}
+  803a62:	c9                   	leave
+  803a63:	c3                   	ret
+
+0000000000803a64 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803a64:	55                   	push   %rbp
+  803a65:	48 89 e5             	mov    %rsp,%rbp
+  803a68:	48 83 ec 10          	sub    $0x10,%rsp
+  803a6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803a70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a74:	48 89 c7             	mov    %rax,%rdi
+  803a77:	48 b8 c6 10 80 00 00 	movabs $0x8010c6,%rax
+  803a7e:	00 00 00 
+  803a81:	ff d0                	call   *%rax
+  803a83:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a88:	7e 07                	jle    803a91 <remove+0x2d>
+    return -E_BAD_PATH;
+  803a8a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a8f:	eb 36                	jmp    803ac7 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803a91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a95:	48 89 c6             	mov    %rax,%rsi
+  803a98:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803a9f:	00 00 00 
+  803aa2:	48 89 c7             	mov    %rax,%rdi
+  803aa5:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  803aac:	00 00 00 
+  803aaf:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803ab1:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab6:	bf 07 00 00 00       	mov    $0x7,%edi
+  803abb:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803ac2:	00 00 00 
+  803ac5:	ff d0                	call   *%rax
+}
+  803ac7:	c9                   	leave
+  803ac8:	c3                   	ret
+
+0000000000803ac9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803ac9:	55                   	push   %rbp
+  803aca:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803acd:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad2:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ad7:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803ade:	00 00 00 
+  803ae1:	ff d0                	call   *%rax
+}
+  803ae3:	5d                   	pop    %rbp
+  803ae4:	c3                   	ret
+
+0000000000803ae5 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803ae5:	55                   	push   %rbp
+  803ae6:	48 89 e5             	mov    %rsp,%rbp
+  803ae9:	48 83 ec 20          	sub    $0x20,%rsp
+  803aed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803af1:	be 00 00 00 00       	mov    $0x0,%esi
+  803af6:	bf 09 00 00 00       	mov    $0x9,%edi
+  803afb:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803b02:	00 00 00 
+  803b05:	ff d0                	call   *%rax
+  803b07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b0a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b0e:	79 05                	jns    803b15 <fs_stats+0x30>
+    return r;
+  803b10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b13:	eb 2a                	jmp    803b3f <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b19:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b1e:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b25:	00 00 00 
+  803b28:	48 89 ce             	mov    %rcx,%rsi
+  803b2b:	48 89 c7             	mov    %rax,%rdi
+  803b2e:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+  return 0;
+  803b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b3f:	c9                   	leave
+  803b40:	c3                   	ret
+
+0000000000803b41 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b41:	55                   	push   %rbp
+  803b42:	48 89 e5             	mov    %rsp,%rbp
+  803b45:	48 83 ec 10          	sub    $0x10,%rsp
+  803b49:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b53:	00 00 00 
+  803b56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b59:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803b5b:	be 00 00 00 00       	mov    $0x0,%esi
+  803b60:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b65:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803b6c:	00 00 00 
+  803b6f:	ff d0                	call   *%rax
+}
+  803b71:	c9                   	leave
+  803b72:	c3                   	ret
+
+0000000000803b73 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803b73:	55                   	push   %rbp
+  803b74:	48 89 e5             	mov    %rsp,%rbp
+  803b77:	48 83 ec 10          	sub    $0x10,%rsp
+  803b7b:	89 f8                	mov    %edi,%eax
+  803b7d:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803b80:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803b84:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b8b:	00 00 00 
+  803b8e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803b90:	be 00 00 00 00       	mov    $0x0,%esi
+  803b95:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803b9a:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+}
+  803ba6:	c9                   	leave
+  803ba7:	c3                   	ret
+
+0000000000803ba8 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803ba8:	55                   	push   %rbp
+  803ba9:	48 89 e5             	mov    %rsp,%rbp
+  803bac:	48 83 ec 10          	sub    $0x10,%rsp
+  803bb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bb8:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803bbd:	48 89 c7             	mov    %rax,%rdi
+  803bc0:	48 b8 ce 3b 80 00 00 	movabs $0x803bce,%rax
+  803bc7:	00 00 00 
+  803bca:	ff d0                	call   *%rax
+}
+  803bcc:	c9                   	leave
+  803bcd:	c3                   	ret
+
+0000000000803bce <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803bce:	55                   	push   %rbp
+  803bcf:	48 89 e5             	mov    %rsp,%rbp
+  803bd2:	48 83 ec 50          	sub    $0x50,%rsp
+  803bd6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803bda:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803bde:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803be5:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803be6:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803beb:	74 0a                	je     803bf7 <pipe_size+0x29>
+  803bed:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803bf4:	00 
+  803bf5:	76 0a                	jbe    803c01 <pipe_size+0x33>
+    return -E_INVAL;
+  803bf7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bfc:	e9 cc 02 00 00       	jmp    803ecd <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c01:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c05:	48 89 c7             	mov    %rax,%rdi
+  803c08:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+  803c14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c1b:	0f 88 a8 02 00 00    	js     803ec9 <pipe_size+0x2fb>
+  803c21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c25:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c2a:	48 89 c6             	mov    %rax,%rsi
+  803c2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c32:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+  803c3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c45:	0f 88 7e 02 00 00    	js     803ec9 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c4b:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c4f:	48 89 c7             	mov    %rax,%rdi
+  803c52:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  803c59:	00 00 00 
+  803c5c:	ff d0                	call   *%rax
+  803c5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c65:	0f 88 43 02 00 00    	js     803eae <pipe_size+0x2e0>
+  803c6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c6f:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c74:	48 89 c6             	mov    %rax,%rsi
+  803c77:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7c:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+  803c88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c8f:	0f 88 19 02 00 00    	js     803eae <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803c95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c99:	48 89 c7             	mov    %rax,%rdi
+  803c9c:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  803ca3:	00 00 00 
+  803ca6:	ff d0                	call   *%rax
+  803ca8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cac:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cb3:	00 
+  803cb4:	e9 a2 00 00 00       	jmp    803d5b <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cbd:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cc1:	48 89 c2             	mov    %rax,%rdx
+  803cc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc8:	48 01 d0             	add    %rdx,%rax
+  803ccb:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cd0:	48 89 c6             	mov    %rax,%rsi
+  803cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd8:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ce7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ceb:	0f 88 37 01 00 00    	js     803e28 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803cf1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cf5:	48 89 c7             	mov    %rax,%rdi
+  803cf8:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  803cff:	00 00 00 
+  803d02:	ff d0                	call   *%rax
+  803d04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d08:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d0c:	48 01 c2             	add    %rax,%rdx
+  803d0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d13:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d17:	48 89 c1             	mov    %rax,%rcx
+  803d1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d1e:	48 01 c8             	add    %rcx,%rax
+  803d21:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d27:	48 89 d1             	mov    %rdx,%rcx
+  803d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2f:	48 89 c6             	mov    %rax,%rsi
+  803d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d37:	48 b8 ed 1f 80 00 00 	movabs $0x801fed,%rax
+  803d3e:	00 00 00 
+  803d41:	ff d0                	call   *%rax
+  803d43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d4a:	79 0a                	jns    803d56 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d4c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d51:	e9 d3 00 00 00       	jmp    803e29 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d56:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803d5b:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803d62:	00 
+  803d63:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803d67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d6b:	48 01 d0             	add    %rdx,%rax
+  803d6e:	48 83 c0 1f          	add    $0x1f,%rax
+  803d72:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803d76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d7f:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803d83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d87:	48 29 d0             	sub    %rdx,%rax
+  803d8a:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d8e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803d92:	0f 82 21 ff ff ff    	jb     803cb9 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803d98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d9c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803da0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da4:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803da8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803dac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803db0:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803db7:	00 00 00 
+  803dba:	8b 12                	mov    (%rdx),%edx
+  803dbc:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803dbe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dc2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803dc9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dcd:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dd4:	00 00 00 
+  803dd7:	8b 12                	mov    (%rdx),%edx
+  803dd9:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803ddb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ddf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803de6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dea:	48 89 c7             	mov    %rax,%rdi
+  803ded:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	89 c2                	mov    %eax,%edx
+  803dfb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803dff:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e01:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e05:	48 89 c7             	mov    %rax,%rdi
+  803e08:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  803e0f:	00 00 00 
+  803e12:	ff d0                	call   *%rax
+  803e14:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e18:	48 83 c2 04          	add    $0x4,%rdx
+  803e1c:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e23:	e9 a5 00 00 00       	jmp    803ecd <pipe_size+0x2ff>
+      goto err2;
+  803e28:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e29:	eb 58                	jmp    803e83 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e2f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e33:	48 89 c2             	mov    %rax,%rdx
+  803e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e3a:	48 01 d0             	add    %rdx,%rax
+  803e3d:	48 89 c6             	mov    %rax,%rsi
+  803e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e45:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e55:	48 89 c7             	mov    %rax,%rdi
+  803e58:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  803e5f:	00 00 00 
+  803e62:	ff d0                	call   *%rax
+  803e64:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e68:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e6c:	48 01 d0             	add    %rdx,%rax
+  803e6f:	48 89 c6             	mov    %rax,%rsi
+  803e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e77:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803e7e:	00 00 00 
+  803e81:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803e83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e87:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e8b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803e8f:	48 85 c0             	test   %rax,%rax
+  803e92:	75 97                	jne    803e2b <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803e94:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e98:	48 89 c6             	mov    %rax,%rsi
+  803e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea0:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803ea7:	00 00 00 
+  803eaa:	ff d0                	call   *%rax
+  803eac:	eb 01                	jmp    803eaf <pipe_size+0x2e1>
+    goto err1;
+  803eae:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803eaf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eb3:	48 89 c6             	mov    %rax,%rsi
+  803eb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ebb:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803ec2:	00 00 00 
+  803ec5:	ff d0                	call   *%rax
+  803ec7:	eb 01                	jmp    803eca <pipe_size+0x2fc>
+    goto err;
+  803ec9:	90                   	nop
+err:
+  return r;
+  803eca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ecd:	c9                   	leave
+  803ece:	c3                   	ret
+
+0000000000803ecf <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ecf:	55                   	push   %rbp
+  803ed0:	48 89 e5             	mov    %rsp,%rbp
+  803ed3:	53                   	push   %rbx
+  803ed4:	48 83 ec 28          	sub    $0x28,%rsp
+  803ed8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803edc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803ee0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ee7:	00 00 00 
+  803eea:	8b 40 04             	mov    0x4(%rax),%eax
+  803eed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ef2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803ef9:	00 00 00 
+  803efc:	48 98                	cltq
+  803efe:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f05:	48 01 d0             	add    %rdx,%rax
+  803f08:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f0e:	8b 00                	mov    (%rax),%eax
+  803f10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f17:	48 89 c7             	mov    %rax,%rdi
+  803f1a:	48 b8 da 4e 80 00 00 	movabs $0x804eda,%rax
+  803f21:	00 00 00 
+  803f24:	ff d0                	call   *%rax
+  803f26:	89 c3                	mov    %eax,%ebx
+  803f28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f2c:	48 89 c7             	mov    %rax,%rdi
+  803f2f:	48 b8 da 4e 80 00 00 	movabs $0x804eda,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+  803f3b:	39 c3                	cmp    %eax,%ebx
+  803f3d:	0f 94 c0             	sete   %al
+  803f40:	0f b6 c0             	movzbl %al,%eax
+  803f43:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f46:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f4d:	00 00 00 
+  803f50:	8b 40 04             	mov    0x4(%rax),%eax
+  803f53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f5f:	00 00 00 
+  803f62:	48 98                	cltq
+  803f64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f6b:	48 01 d0             	add    %rdx,%rax
+  803f6e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f74:	8b 00                	mov    (%rax),%eax
+  803f76:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803f79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f7c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f7f:	75 05                	jne    803f86 <_pipeisclosed+0xb7>
+      return ret;
+  803f81:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f84:	eb 68                	jmp    803fee <_pipeisclosed+0x11f>
+    if (n != nn)
+  803f86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f89:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f8c:	0f 84 4e ff ff ff    	je     803ee0 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803f92:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f99:	00 00 00 
+  803f9c:	8b 40 04             	mov    0x4(%rax),%eax
+  803f9f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fa4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fab:	00 00 00 
+  803fae:	48 98                	cltq
+  803fb0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fb7:	48 01 d0             	add    %rdx,%rax
+  803fba:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fc0:	8b 10                	mov    (%rax),%edx
+  803fc2:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803fc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc8:	89 c6                	mov    %eax,%esi
+  803fca:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  803fd1:	00 00 00 
+  803fd4:	48 89 c7             	mov    %rax,%rdi
+  803fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fdc:	49 b8 17 02 80 00 00 	movabs $0x800217,%r8
+  803fe3:	00 00 00 
+  803fe6:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803fe9:	e9 f2 fe ff ff       	jmp    803ee0 <_pipeisclosed+0x11>
+  }
+}
+  803fee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ff2:	c9                   	leave
+  803ff3:	c3                   	ret
+
+0000000000803ff4 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  803ff4:	55                   	push   %rbp
+  803ff5:	48 89 e5             	mov    %rsp,%rbp
+  803ff8:	48 83 ec 30          	sub    $0x30,%rsp
+  803ffc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803fff:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804003:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804006:	48 89 d6             	mov    %rdx,%rsi
+  804009:	89 c7                	mov    %eax,%edi
+  80400b:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+  804017:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80401a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80401e:	79 05                	jns    804025 <pipeisclosed+0x31>
+    return r;
+  804020:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804023:	eb 31                	jmp    804056 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804025:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804029:	48 89 c7             	mov    %rax,%rdi
+  80402c:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  804033:	00 00 00 
+  804036:	ff d0                	call   *%rax
+  804038:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80403c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804040:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804044:	48 89 d6             	mov    %rdx,%rsi
+  804047:	48 89 c7             	mov    %rax,%rdi
+  80404a:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+}
+  804056:	c9                   	leave
+  804057:	c3                   	ret
+
+0000000000804058 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804058:	55                   	push   %rbp
+  804059:	48 89 e5             	mov    %rsp,%rbp
+  80405c:	48 83 ec 10          	sub    $0x10,%rsp
+  804060:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804068:	8b 40 18             	mov    0x18(%rax),%eax
+  80406b:	8d 50 01             	lea    0x1(%rax),%edx
+  80406e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804072:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804075:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804079:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80407c:	85 c0                	test   %eax,%eax
+  80407e:	74 27                	je     8040a7 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804080:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804084:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80408b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80408f:	48 83 c0 18          	add    $0x18,%rax
+  804093:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804098:	48 89 c7             	mov    %rax,%rdi
+  80409b:	48 b8 90 23 80 00 00 	movabs $0x802390,%rax
+  8040a2:	00 00 00 
+  8040a5:	ff d0                	call   *%rax
+  }
+}
+  8040a7:	90                   	nop
+  8040a8:	c9                   	leave
+  8040a9:	c3                   	ret
+
+00000000008040aa <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040aa:	55                   	push   %rbp
+  8040ab:	48 89 e5             	mov    %rsp,%rbp
+  8040ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8040b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040b6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8040b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040bd:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8040c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c8:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8040cc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040cf:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8040d6:	89 c6                	mov    %eax,%esi
+  8040d8:	48 89 cf             	mov    %rcx,%rdi
+  8040db:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8040e2:	00 00 00 
+  8040e5:	ff d0                	call   *%rax
+}
+  8040e7:	90                   	nop
+  8040e8:	c9                   	leave
+  8040e9:	c3                   	ret
+
+00000000008040ea <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040ea:	55                   	push   %rbp
+  8040eb:	48 89 e5             	mov    %rsp,%rbp
+  8040ee:	48 83 ec 70          	sub    $0x70,%rsp
+  8040f2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8040f6:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8040fa:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8040fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804102:	48 89 c7             	mov    %rax,%rdi
+  804105:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+  804111:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804115:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80411a:	75 0a                	jne    804126 <devpipe_read+0x3c>
+    return 0;
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804121:	e9 63 01 00 00       	jmp    804289 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804126:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80412a:	8b 40 18             	mov    0x18(%rax),%eax
+  80412d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804130:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804134:	48 8b 10             	mov    (%rax),%rdx
+  804137:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80413b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80413f:	48 39 c2             	cmp    %rax,%rdx
+  804142:	75 42                	jne    804186 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804144:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804148:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80414c:	48 89 d6             	mov    %rdx,%rsi
+  80414f:	48 89 c7             	mov    %rax,%rdi
+  804152:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  804159:	00 00 00 
+  80415c:	ff d0                	call   *%rax
+  80415e:	85 c0                	test   %eax,%eax
+  804160:	74 0a                	je     80416c <devpipe_read+0x82>
+      return 0;
+  804162:	b8 00 00 00 00       	mov    $0x0,%eax
+  804167:	e9 1d 01 00 00       	jmp    804289 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80416c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80416f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804173:	89 d6                	mov    %edx,%esi
+  804175:	48 89 c7             	mov    %rax,%rdi
+  804178:	48 b8 aa 40 80 00 00 	movabs $0x8040aa,%rax
+  80417f:	00 00 00 
+  804182:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804184:	eb a0                	jmp    804126 <devpipe_read+0x3c>
+      break;
+  804186:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804187:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80418b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80418f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804193:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804197:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80419b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80419f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a3:	48 8b 00             	mov    (%rax),%rax
+  8041a6:	48 29 c2             	sub    %rax,%rdx
+  8041a9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041b5:	48 39 c2             	cmp    %rax,%rdx
+  8041b8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041bc:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8041c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041c4:	48 8b 00             	mov    (%rax),%rax
+  8041c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041cb:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8041cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041d4:	48 f7 f1             	div    %rcx
+  8041d7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8041db:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041eb:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8041ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041f3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041fb:	48 39 c2             	cmp    %rax,%rdx
+  8041fe:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804202:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804206:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420a:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80420e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804212:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804216:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80421a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421e:	48 89 ce             	mov    %rcx,%rsi
+  804221:	48 89 c7             	mov    %rax,%rdi
+  804224:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  80422b:	00 00 00 
+  80422e:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804230:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804234:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804238:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80423c:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804240:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804244:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804248:	48 01 d1             	add    %rdx,%rcx
+  80424b:	48 89 c2             	mov    %rax,%rdx
+  80424e:	48 89 cf             	mov    %rcx,%rdi
+  804251:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  804258:	00 00 00 
+  80425b:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80425d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804261:	48 8b 10             	mov    (%rax),%rdx
+  804264:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804268:	48 01 c2             	add    %rax,%rdx
+  80426b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80426f:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804276:	48 89 c7             	mov    %rax,%rdi
+  804279:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  804280:	00 00 00 
+  804283:	ff d0                	call   *%rax
+  return n;
+  804285:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804289:	c9                   	leave
+  80428a:	c3                   	ret
+
+000000000080428b <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80428b:	55                   	push   %rbp
+  80428c:	48 89 e5             	mov    %rsp,%rbp
+  80428f:	48 83 ec 70          	sub    $0x70,%rsp
+  804293:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804297:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80429b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80429f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042a3:	48 89 c7             	mov    %rax,%rdi
+  8042a6:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  8042ad:	00 00 00 
+  8042b0:	ff d0                	call   *%rax
+  8042b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042b6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8042be:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8042c5:	00 
+  8042c6:	e9 b8 01 00 00       	jmp    804483 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8042cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042cf:	8b 40 18             	mov    0x18(%rax),%eax
+  8042d2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8042d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8042dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e1:	48 8b 00             	mov    (%rax),%rax
+  8042e4:	48 29 c2             	sub    %rax,%rdx
+  8042e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042eb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042ef:	48 39 c2             	cmp    %rax,%rdx
+  8042f2:	75 4d                	jne    804341 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8042f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042f8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042fc:	48 89 d6             	mov    %rdx,%rsi
+  8042ff:	48 89 c7             	mov    %rax,%rdi
+  804302:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  804309:	00 00 00 
+  80430c:	ff d0                	call   *%rax
+  80430e:	85 c0                	test   %eax,%eax
+  804310:	74 0a                	je     80431c <devpipe_write+0x91>
+        return 0;
+  804312:	b8 00 00 00 00       	mov    $0x0,%eax
+  804317:	e9 79 01 00 00       	jmp    804495 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80431c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80431f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804323:	89 d6                	mov    %edx,%esi
+  804325:	48 89 c7             	mov    %rax,%rdi
+  804328:	48 b8 aa 40 80 00 00 	movabs $0x8040aa,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+      m = 0;
+  804334:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80433b:	00 
+      continue;
+  80433c:	e9 3a 01 00 00       	jmp    80447b <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804341:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804345:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804349:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80434d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804351:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804355:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804359:	48 8b 08             	mov    (%rax),%rcx
+  80435c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804360:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804364:	48 29 c1             	sub    %rax,%rcx
+  804367:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80436b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80436f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804373:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804377:	48 39 c2             	cmp    %rax,%rdx
+  80437a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80437e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804382:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804386:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80438a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80438e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804392:	ba 00 00 00 00       	mov    $0x0,%edx
+  804397:	48 f7 f1             	div    %rcx
+  80439a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  80439e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043a2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043aa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043ae:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043b2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043b6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043ba:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8043be:	48 39 c2             	cmp    %rax,%rdx
+  8043c1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043c5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8043c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043cd:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8043d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043d5:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8043d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043dd:	48 01 d1             	add    %rdx,%rcx
+  8043e0:	48 89 c2             	mov    %rax,%rdx
+  8043e3:	48 89 cf             	mov    %rcx,%rdi
+  8043e6:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  8043ed:	00 00 00 
+  8043f0:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8043f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043f6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043fa:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043fe:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804402:	73 4d                	jae    804451 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804408:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80440c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804410:	48 29 c2             	sub    %rax,%rdx
+  804413:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804417:	48 01 c2             	add    %rax,%rdx
+  80441a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80441e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804422:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804426:	48 89 c1             	mov    %rax,%rcx
+  804429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80442d:	48 01 c1             	add    %rax,%rcx
+  804430:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804434:	48 01 c1             	add    %rax,%rcx
+  804437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443b:	48 83 c0 20          	add    $0x20,%rax
+  80443f:	48 89 ce             	mov    %rcx,%rsi
+  804442:	48 89 c7             	mov    %rax,%rdi
+  804445:	48 b8 10 19 80 00 00 	movabs $0x801910,%rax
+  80444c:	00 00 00 
+  80444f:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804451:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804455:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804459:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80445d:	48 01 c2             	add    %rax,%rdx
+  804460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804464:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804468:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80446c:	48 89 c7             	mov    %rax,%rdi
+  80446f:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  804476:	00 00 00 
+  804479:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80447b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80447f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804487:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80448b:	0f 82 3a fe ff ff    	jb     8042cb <devpipe_write+0x40>
+  }
+
+  return i;
+  804491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804495:	c9                   	leave
+  804496:	c3                   	ret
+
+0000000000804497 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804497:	55                   	push   %rbp
+  804498:	48 89 e5             	mov    %rsp,%rbp
+  80449b:	48 83 ec 40          	sub    $0x40,%rsp
+  80449f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044a3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044a6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044ae:	48 89 c7             	mov    %rax,%rdi
+  8044b1:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  8044b8:	00 00 00 
+  8044bb:	ff d0                	call   *%rax
+  8044bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8044c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8044c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044cc:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8044d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044d4:	48 89 d6             	mov    %rdx,%rsi
+  8044d7:	48 89 c7             	mov    %rax,%rdi
+  8044da:	48 b8 72 31 80 00 00 	movabs $0x803172,%rax
+  8044e1:	00 00 00 
+  8044e4:	ff d0                	call   *%rax
+  8044e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044ed:	79 08                	jns    8044f7 <devpipe_poll+0x60>
+    return r;
+  8044ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f2:	e9 85 00 00 00       	jmp    80457c <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8044f7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8044fa:	83 e0 01             	and    $0x1,%eax
+  8044fd:	85 c0                	test   %eax,%eax
+  8044ff:	74 18                	je     804519 <devpipe_poll+0x82>
+  804501:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804505:	48 8b 10             	mov    (%rax),%rdx
+  804508:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80450c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804510:	48 39 c2             	cmp    %rax,%rdx
+  804513:	74 04                	je     804519 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804515:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804519:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80451c:	83 e0 02             	and    $0x2,%eax
+  80451f:	85 c0                	test   %eax,%eax
+  804521:	74 23                	je     804546 <devpipe_poll+0xaf>
+  804523:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804527:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80452b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80452f:	48 8b 00             	mov    (%rax),%rax
+  804532:	48 29 c2             	sub    %rax,%rdx
+  804535:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804539:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80453d:	48 39 c2             	cmp    %rax,%rdx
+  804540:	73 04                	jae    804546 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804542:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804546:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80454a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80454e:	48 89 d6             	mov    %rdx,%rsi
+  804551:	48 89 c7             	mov    %rax,%rdi
+  804554:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  80455b:	00 00 00 
+  80455e:	ff d0                	call   *%rax
+  804560:	85 c0                	test   %eax,%eax
+  804562:	74 04                	je     804568 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804564:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804568:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80456c:	75 0b                	jne    804579 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80456e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804572:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804579:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80457c:	c9                   	leave
+  80457d:	c3                   	ret
+
+000000000080457e <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80457e:	55                   	push   %rbp
+  80457f:	48 89 e5             	mov    %rsp,%rbp
+  804582:	48 83 ec 20          	sub    $0x20,%rsp
+  804586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80458a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80458e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804592:	48 89 c7             	mov    %rax,%rdi
+  804595:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  80459c:	00 00 00 
+  80459f:	ff d0                	call   *%rax
+  8045a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a9:	48 ba 11 56 80 00 00 	movabs $0x805611,%rdx
+  8045b0:	00 00 00 
+  8045b3:	48 89 d6             	mov    %rdx,%rsi
+  8045b6:	48 89 c7             	mov    %rax,%rdi
+  8045b9:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  8045c0:	00 00 00 
+  8045c3:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8045c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045cd:	89 c1                	mov    %eax,%ecx
+  8045cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d3:	48 8b 00             	mov    (%rax),%rax
+  8045d6:	89 c2                	mov    %eax,%edx
+  8045d8:	89 c8                	mov    %ecx,%eax
+  8045da:	29 d0                	sub    %edx,%eax
+  8045dc:	89 c2                	mov    %eax,%edx
+  8045de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8045e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ec:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8045f3:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8045f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045fa:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804601:	00 00 00 
+  804604:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80460b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804610:	c9                   	leave
+  804611:	c3                   	ret
+
+0000000000804612 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804612:	55                   	push   %rbp
+  804613:	48 89 e5             	mov    %rsp,%rbp
+  804616:	48 83 ec 40          	sub    $0x40,%rsp
+  80461a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80461e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804622:	48 89 c7             	mov    %rax,%rdi
+  804625:	48 b8 9f 26 80 00 00 	movabs $0x80269f,%rax
+  80462c:	00 00 00 
+  80462f:	ff d0                	call   *%rax
+  804631:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804635:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80463c:	00 
+  80463d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804641:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804649:	48 01 d0             	add    %rdx,%rax
+  80464c:	48 83 c0 1f          	add    $0x1f,%rax
+  804650:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804654:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80465d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804665:	48 29 d0             	sub    %rdx,%rax
+  804668:	48 c1 e8 0c          	shr    $0xc,%rax
+  80466c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804670:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804674:	48 89 c6             	mov    %rax,%rsi
+  804677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80467c:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  804683:	00 00 00 
+  804686:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804688:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80468c:	48 89 c7             	mov    %rax,%rdi
+  80468f:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  804696:	00 00 00 
+  804699:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80469b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80469f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046a3:	eb 2f                	jmp    8046d4 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046a9:	48 83 e8 01          	sub    $0x1,%rax
+  8046ad:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046b1:	48 89 c2             	mov    %rax,%rdx
+  8046b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046b8:	48 01 d0             	add    %rdx,%rax
+  8046bb:	48 89 c6             	mov    %rax,%rsi
+  8046be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c3:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046cf:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046d4:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8046d9:	77 ca                	ja     8046a5 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8046db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046df:	48 89 c6             	mov    %rax,%rsi
+  8046e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046e7:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8046ee:	00 00 00 
+  8046f1:	ff d0                	call   *%rax
+}
+  8046f3:	c9                   	leave
+  8046f4:	c3                   	ret
+
+00000000008046f5 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8046f5:	55                   	push   %rbp
+  8046f6:	48 89 e5             	mov    %rsp,%rbp
+  8046f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8046fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804700:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804704:	75 10                	jne    804716 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804706:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80470d:	00 00 00 
+  804710:	8b 00                	mov    (%rax),%eax
+  804712:	48 98                	cltq
+  804714:	eb 05                	jmp    80471b <vsyscall+0x26>
+  }
+  return 0;
+  804716:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80471b:	c9                   	leave
+  80471c:	c3                   	ret
+
+000000000080471d <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80471d:	55                   	push   %rbp
+  80471e:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804721:	bf 00 00 00 00       	mov    $0x0,%edi
+  804726:	48 b8 f5 46 80 00 00 	movabs $0x8046f5,%rax
+  80472d:	00 00 00 
+  804730:	ff d0                	call   *%rax
+}
+  804732:	5d                   	pop    %rbp
+  804733:	c3                   	ret
+
+0000000000804734 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804734:	55                   	push   %rbp
+  804735:	48 89 e5             	mov    %rsp,%rbp
+  804738:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80473c:	0f 31                	rdtsc
+  80473e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804741:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804744:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804747:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80474a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80474e:	48 09 d0             	or     %rdx,%rax
+  804751:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804755:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804759:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80475d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804764:	00 00 00 
+  804767:	8b 40 08             	mov    0x8(%rax),%eax
+  80476a:	48 98                	cltq
+  80476c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804770:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804774:	ba 00 00 00 00       	mov    $0x0,%edx
+  804779:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80477d:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80478d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804791:	48 89 d0             	mov    %rdx,%rax
+  804794:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80479b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047a4:	48 01 c8             	add    %rcx,%rax
+}
+  8047a7:	c9                   	leave
+  8047a8:	c3                   	ret
+
+00000000008047a9 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047a9:	55                   	push   %rbp
+  8047aa:	48 89 e5             	mov    %rsp,%rbp
+  8047ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8047b1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047b7:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8047ba:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8047be:	be 01 00 00 00       	mov    $0x1,%esi
+  8047c3:	48 89 c7             	mov    %rax,%rdi
+  8047c6:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  8047cd:	00 00 00 
+  8047d0:	ff d0                	call   *%rax
+}
+  8047d2:	90                   	nop
+  8047d3:	c9                   	leave
+  8047d4:	c3                   	ret
+
+00000000008047d5 <getchar>:
+
+int
+getchar(void) {
+  8047d5:	55                   	push   %rbp
+  8047d6:	48 89 e5             	mov    %rsp,%rbp
+  8047d9:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8047dd:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8047e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047e6:	48 89 c6             	mov    %rax,%rsi
+  8047e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ee:	48 b8 08 2d 80 00 00 	movabs $0x802d08,%rax
+  8047f5:	00 00 00 
+  8047f8:	ff d0                	call   *%rax
+  8047fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8047fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804801:	79 05                	jns    804808 <getchar+0x33>
+    return r;
+  804803:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804806:	eb 14                	jmp    80481c <getchar+0x47>
+  if (r < 1)
+  804808:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80480c:	7f 07                	jg     804815 <getchar+0x40>
+    return -E_EOF;
+  80480e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804813:	eb 07                	jmp    80481c <getchar+0x47>
+  return c;
+  804815:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804819:	0f b6 c0             	movzbl %al,%eax
+}
+  80481c:	c9                   	leave
+  80481d:	c3                   	ret
+
+000000000080481e <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80481e:	55                   	push   %rbp
+  80481f:	48 89 e5             	mov    %rsp,%rbp
+  804822:	48 83 ec 20          	sub    $0x20,%rsp
+  804826:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804829:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80482d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804830:	48 89 d6             	mov    %rdx,%rsi
+  804833:	89 c7                	mov    %eax,%edi
+  804835:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  80483c:	00 00 00 
+  80483f:	ff d0                	call   *%rax
+  804841:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804844:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804848:	79 05                	jns    80484f <iscons+0x31>
+    return r;
+  80484a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80484d:	eb 1a                	jmp    804869 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80484f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804853:	8b 10                	mov    (%rax),%edx
+  804855:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  80485c:	00 00 00 
+  80485f:	8b 00                	mov    (%rax),%eax
+  804861:	39 c2                	cmp    %eax,%edx
+  804863:	0f 94 c0             	sete   %al
+  804866:	0f b6 c0             	movzbl %al,%eax
+}
+  804869:	c9                   	leave
+  80486a:	c3                   	ret
+
+000000000080486b <opencons>:
+
+int
+opencons(void) {
+  80486b:	55                   	push   %rbp
+  80486c:	48 89 e5             	mov    %rsp,%rbp
+  80486f:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804873:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804877:	48 89 c7             	mov    %rax,%rdi
+  80487a:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  804881:	00 00 00 
+  804884:	ff d0                	call   *%rax
+  804886:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804889:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80488d:	79 05                	jns    804894 <opencons+0x29>
+    return r;
+  80488f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804892:	eb 66                	jmp    8048fa <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804894:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804898:	ba 07 04 00 00       	mov    $0x407,%edx
+  80489d:	48 89 c6             	mov    %rax,%rsi
+  8048a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048a5:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  8048ac:	00 00 00 
+  8048af:	ff d0                	call   *%rax
+  8048b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048b8:	79 05                	jns    8048bf <opencons+0x54>
+    return r;
+  8048ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048bd:	eb 3b                	jmp    8048fa <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8048bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c3:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8048ca:	00 00 00 
+  8048cd:	8b 12                	mov    (%rdx),%edx
+  8048cf:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8048d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8048dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e0:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8048e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048eb:	48 89 c7             	mov    %rax,%rdi
+  8048ee:	48 b8 7c 26 80 00 00 	movabs $0x80267c,%rax
+  8048f5:	00 00 00 
+  8048f8:	ff d0                	call   *%rax
+}
+  8048fa:	c9                   	leave
+  8048fb:	c3                   	ret
+
+00000000008048fc <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8048fc:	55                   	push   %rbp
+  8048fd:	48 89 e5             	mov    %rsp,%rbp
+  804900:	48 83 ec 20          	sub    $0x20,%rsp
+  804904:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804907:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80490a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80490e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804911:	48 89 d6             	mov    %rdx,%rsi
+  804914:	89 c7                	mov    %eax,%edi
+  804916:	48 b8 ac 27 80 00 00 	movabs $0x8027ac,%rax
+  80491d:	00 00 00 
+  804920:	ff d0                	call   *%rax
+  804922:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804925:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804929:	79 05                	jns    804930 <consmode+0x34>
+    return r;
+  80492b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80492e:	eb 34                	jmp    804964 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804930:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804934:	8b 10                	mov    (%rax),%edx
+  804936:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  80493d:	00 00 00 
+  804940:	8b 00                	mov    (%rax),%eax
+  804942:	39 c2                	cmp    %eax,%edx
+  804944:	74 07                	je     80494d <consmode+0x51>
+    return -E_INVAL;
+  804946:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80494b:	eb 17                	jmp    804964 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80494d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804951:	8b 40 0c             	mov    0xc(%rax),%eax
+  804954:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804957:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80495b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80495e:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804961:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804964:	c9                   	leave
+  804965:	c3                   	ret
+
+0000000000804966 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804966:	55                   	push   %rbp
+  804967:	48 89 e5             	mov    %rsp,%rbp
+  80496a:	48 83 ec 20          	sub    $0x20,%rsp
+  80496e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804972:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804976:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80497a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80497e:	8b 50 0c             	mov    0xc(%rax),%edx
+  804981:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804985:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804989:	48 89 ce             	mov    %rcx,%rsi
+  80498c:	48 89 c7             	mov    %rax,%rdi
+  80498f:	48 b8 ef 22 80 00 00 	movabs $0x8022ef,%rax
+  804996:	00 00 00 
+  804999:	ff d0                	call   *%rax
+  80499b:	48 98                	cltq
+}
+  80499d:	c9                   	leave
+  80499e:	c3                   	ret
+
+000000000080499f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80499f:	55                   	push   %rbp
+  8049a0:	48 89 e5             	mov    %rsp,%rbp
+  8049a3:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049aa:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049b1:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049b8:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8049bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049c6:	eb 74                	jmp    804a3c <devcons_write+0x9d>
+    m = n - tot;
+  8049c8:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8049cf:	89 c2                	mov    %eax,%edx
+  8049d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049d4:	29 c2                	sub    %eax,%edx
+  8049d6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8049d9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049dc:	83 f8 7f             	cmp    $0x7f,%eax
+  8049df:	76 07                	jbe    8049e8 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8049e1:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8049e8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049eb:	48 63 d0             	movslq %eax,%rdx
+  8049ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049f1:	48 63 c8             	movslq %eax,%rcx
+  8049f4:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8049fb:	48 01 c1             	add    %rax,%rcx
+  8049fe:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a05:	48 89 ce             	mov    %rcx,%rsi
+  804a08:	48 89 c7             	mov    %rax,%rdi
+  804a0b:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  804a12:	00 00 00 
+  804a15:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a1a:	48 63 d0             	movslq %eax,%rdx
+  804a1d:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a24:	48 89 d6             	mov    %rdx,%rsi
+  804a27:	48 89 c7             	mov    %rax,%rdi
+  804a2a:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  804a31:	00 00 00 
+  804a34:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a36:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a39:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a3f:	48 98                	cltq
+  804a41:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a48:	0f 82 7a ff ff ff    	jb     8049c8 <devcons_write+0x29>
+  }
+  return tot;
+  804a4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a51:	48 98                	cltq
+}
+  804a53:	c9                   	leave
+  804a54:	c3                   	ret
+
+0000000000804a55 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a55:	55                   	push   %rbp
+  804a56:	48 89 e5             	mov    %rsp,%rbp
+  804a59:	48 83 ec 08          	sub    $0x8,%rsp
+  804a5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a66:	c9                   	leave
+  804a67:	c3                   	ret
+
+0000000000804a68 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a68:	55                   	push   %rbp
+  804a69:	48 89 e5             	mov    %rsp,%rbp
+  804a6c:	48 83 ec 10          	sub    $0x10,%rsp
+  804a70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a7c:	48 ba 1d 56 80 00 00 	movabs $0x80561d,%rdx
+  804a83:	00 00 00 
+  804a86:	48 89 d6             	mov    %rdx,%rsi
+  804a89:	48 89 c7             	mov    %rax,%rdi
+  804a8c:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  804a93:	00 00 00 
+  804a96:	ff d0                	call   *%rax
+  return 0;
+  804a98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a9d:	c9                   	leave
+  804a9e:	c3                   	ret
+
+0000000000804a9f <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804a9f:	55                   	push   %rbp
+  804aa0:	48 89 e5             	mov    %rsp,%rbp
+  804aa3:	48 83 ec 30          	sub    $0x30,%rsp
+  804aa7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804aab:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804aae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804ab2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804ab9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804abc:	83 e0 02             	and    $0x2,%eax
+  804abf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804ac2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ac6:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ac9:	83 f8 01             	cmp    $0x1,%eax
+  804acc:	75 04                	jne    804ad2 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804ace:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804ad2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ad5:	83 e0 01             	and    $0x1,%eax
+  804ad8:	85 c0                	test   %eax,%eax
+  804ada:	74 44                	je     804b20 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804adc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ae4:	89 c2                	mov    %eax,%edx
+  804ae6:	be 00 00 00 00       	mov    $0x0,%esi
+  804aeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af0:	48 b8 dd 23 80 00 00 	movabs $0x8023dd,%rax
+  804af7:	00 00 00 
+  804afa:	ff d0                	call   *%rax
+  804afc:	83 f8 01             	cmp    $0x1,%eax
+  804aff:	75 06                	jne    804b07 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b01:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b05:	eb 19                	jmp    804b20 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0b:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b11:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b14:	89 c2                	mov    %eax,%edx
+  804b16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b1a:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b20:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b23:	c9                   	leave
+  804b24:	c3                   	ret
+
+0000000000804b25 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b25:	55                   	push   %rbp
+  804b26:	48 89 e5             	mov    %rsp,%rbp
+  804b29:	53                   	push   %rbx
+  804b2a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b31:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b38:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b3e:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b45:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b4c:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b53:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804b5a:	84 c0                	test   %al,%al
+  804b5c:	74 23                	je     804b81 <_panic+0x5c>
+  804b5e:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804b65:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804b69:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804b6d:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804b71:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804b75:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804b79:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804b7d:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b81:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804b88:	00 00 00 
+  804b8b:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804b92:	00 00 00 
+  804b95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b99:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804ba0:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804ba7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bae:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bb5:	00 00 00 
+  804bb8:	48 8b 18             	mov    (%rax),%rbx
+  804bbb:	48 b8 1c 1f 80 00 00 	movabs $0x801f1c,%rax
+  804bc2:	00 00 00 
+  804bc5:	ff d0                	call   *%rax
+  804bc7:	89 c6                	mov    %eax,%esi
+  804bc9:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804bcf:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804bd6:	41 89 d0             	mov    %edx,%r8d
+  804bd9:	48 89 c1             	mov    %rax,%rcx
+  804bdc:	48 89 da             	mov    %rbx,%rdx
+  804bdf:	48 b8 28 56 80 00 00 	movabs $0x805628,%rax
+  804be6:	00 00 00 
+  804be9:	48 89 c7             	mov    %rax,%rdi
+  804bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf1:	49 b9 17 02 80 00 00 	movabs $0x800217,%r9
+  804bf8:	00 00 00 
+  804bfb:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804bfe:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c05:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c0c:	48 89 d6             	mov    %rdx,%rsi
+  804c0f:	48 89 c7             	mov    %rax,%rdi
+  804c12:	48 b8 8c 01 80 00 00 	movabs $0x80018c,%rax
+  804c19:	00 00 00 
+  804c1c:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c1e:	48 b8 4b 56 80 00 00 	movabs $0x80564b,%rax
+  804c25:	00 00 00 
+  804c28:	48 89 c7             	mov    %rax,%rdi
+  804c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c30:	48 ba 17 02 80 00 00 	movabs $0x800217,%rdx
+  804c37:	00 00 00 
+  804c3a:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c3c:	cc                   	int3
+  804c3d:	eb fd                	jmp    804c3c <_panic+0x117>
+
+0000000000804c3f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c3f:	55                   	push   %rbp
+  804c40:	48 89 e5             	mov    %rsp,%rbp
+  804c43:	48 83 ec 20          	sub    $0x20,%rsp
+  804c47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c4f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c57:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c5f:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c66:	48 89 c7             	mov    %rax,%rdi
+  804c69:	48 b8 77 4c 80 00 00 	movabs $0x804c77,%rax
+  804c70:	00 00 00 
+  804c73:	ff d0                	call   *%rax
+}
+  804c75:	c9                   	leave
+  804c76:	c3                   	ret
+
+0000000000804c77 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c77:	55                   	push   %rbp
+  804c78:	48 89 e5             	mov    %rsp,%rbp
+  804c7b:	48 83 ec 30          	sub    $0x30,%rsp
+  804c7f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c83:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c87:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c8b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c8f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c94:	75 0e                	jne    804ca4 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c96:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c9d:	00 00 00 
+  804ca0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804ca4:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804ca9:	75 18                	jne    804cc3 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804caf:	48 89 c7             	mov    %rax,%rdi
+  804cb2:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  804cb9:	00 00 00 
+  804cbc:	ff d0                	call   *%rax
+  804cbe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cc1:	eb 1d                	jmp    804ce0 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cc3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ccb:	48 89 d6             	mov    %rdx,%rsi
+  804cce:	48 89 c7             	mov    %rax,%rdi
+  804cd1:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  804cd8:	00 00 00 
+  804cdb:	ff d0                	call   *%rax
+  804cdd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804ce0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ce4:	79 2a                	jns    804d10 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804ce6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ceb:	74 0a                	je     804cf7 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ced:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cf7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cfc:	74 0a                	je     804d08 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d02:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d0b:	e9 aa 00 00 00       	jmp    804dba <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d10:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d15:	74 36                	je     804d4d <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d17:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d1e:	00 00 00 
+  804d21:	8b 40 04             	mov    0x4(%rax),%eax
+  804d24:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d29:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d30:	00 00 00 
+  804d33:	48 98                	cltq
+  804d35:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d3c:	48 01 d0             	add    %rdx,%rax
+  804d3f:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d45:	8b 10                	mov    (%rax),%edx
+  804d47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d4b:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d4d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d52:	74 36                	je     804d8a <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d54:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d5b:	00 00 00 
+  804d5e:	8b 40 04             	mov    0x4(%rax),%eax
+  804d61:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d66:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d6d:	00 00 00 
+  804d70:	48 98                	cltq
+  804d72:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d79:	48 01 d0             	add    %rdx,%rax
+  804d7c:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d82:	8b 10                	mov    (%rax),%edx
+  804d84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d88:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d8a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d91:	00 00 00 
+  804d94:	8b 40 04             	mov    0x4(%rax),%eax
+  804d97:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d9c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804da3:	00 00 00 
+  804da6:	48 98                	cltq
+  804da8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804daf:	48 01 d0             	add    %rdx,%rax
+  804db2:	48 05 20 01 00 00    	add    $0x120,%rax
+  804db8:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dba:	c9                   	leave
+  804dbb:	c3                   	ret
+
+0000000000804dbc <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dbc:	55                   	push   %rbp
+  804dbd:	48 89 e5             	mov    %rsp,%rbp
+  804dc0:	48 83 ec 30          	sub    $0x30,%rsp
+  804dc4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dc7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dca:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dce:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dd1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dd6:	75 5e                	jne    804e36 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dd8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ddf:	00 00 00 
+  804de2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804de6:	eb 4e                	jmp    804e36 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804de8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dec:	79 3c                	jns    804e2a <ipc_send+0x6e>
+  804dee:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804df2:	74 36                	je     804e2a <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804df4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804df7:	89 c1                	mov    %eax,%ecx
+  804df9:	48 b8 50 56 80 00 00 	movabs $0x805650,%rax
+  804e00:	00 00 00 
+  804e03:	48 89 c2             	mov    %rax,%rdx
+  804e06:	be 54 00 00 00       	mov    $0x54,%esi
+  804e0b:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  804e12:	00 00 00 
+  804e15:	48 89 c7             	mov    %rax,%rdi
+  804e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1d:	49 b8 25 4b 80 00 00 	movabs $0x804b25,%r8
+  804e24:	00 00 00 
+  804e27:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e2a:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  804e31:	00 00 00 
+  804e34:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e36:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e39:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e3c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e43:	89 c7                	mov    %eax,%edi
+  804e45:	48 b8 7e 21 80 00 00 	movabs $0x80217e,%rax
+  804e4c:	00 00 00 
+  804e4f:	ff d0                	call   *%rax
+  804e51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e58:	75 8e                	jne    804de8 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e5a:	48 b8 58 1f 80 00 00 	movabs $0x801f58,%rax
+  804e61:	00 00 00 
+  804e64:	ff d0                	call   *%rax
+}
+  804e66:	90                   	nop
+  804e67:	c9                   	leave
+  804e68:	c3                   	ret
+
+0000000000804e69 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e69:	55                   	push   %rbp
+  804e6a:	48 89 e5             	mov    %rsp,%rbp
+  804e6d:	48 83 ec 18          	sub    $0x18,%rsp
+  804e71:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e7b:	eb 4d                	jmp    804eca <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e7d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e84:	00 00 00 
+  804e87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e8a:	48 98                	cltq
+  804e8c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e93:	48 01 d0             	add    %rdx,%rax
+  804e96:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e9c:	8b 00                	mov    (%rax),%eax
+  804e9e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ea1:	75 23                	jne    804ec6 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804ea3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eaa:	00 00 00 
+  804ead:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eb0:	48 98                	cltq
+  804eb2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eb9:	48 01 d0             	add    %rdx,%rax
+  804ebc:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ec2:	8b 00                	mov    (%rax),%eax
+  804ec4:	eb 12                	jmp    804ed8 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ec6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804eca:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ed1:	7e aa                	jle    804e7d <ipc_find_env+0x14>
+  return 0;
+  804ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed8:	c9                   	leave
+  804ed9:	c3                   	ret
+
+0000000000804eda <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804eda:	55                   	push   %rbp
+  804edb:	48 89 e5             	mov    %rsp,%rbp
+  804ede:	48 83 ec 18          	sub    $0x18,%rsp
+  804ee2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eea:	48 c1 e8 27          	shr    $0x27,%rax
+  804eee:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ef3:	48 89 c2             	mov    %rax,%rdx
+  804ef6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804efd:	01 00 00 
+  804f00:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f04:	83 e0 01             	and    $0x1,%eax
+  804f07:	48 85 c0             	test   %rax,%rax
+  804f0a:	74 63                	je     804f6f <pageref+0x95>
+  804f0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f10:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f14:	48 89 c2             	mov    %rax,%rdx
+  804f17:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f1e:	01 00 00 
+  804f21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f25:	83 e0 01             	and    $0x1,%eax
+  804f28:	48 85 c0             	test   %rax,%rax
+  804f2b:	74 42                	je     804f6f <pageref+0x95>
+  804f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f31:	48 c1 e8 15          	shr    $0x15,%rax
+  804f35:	48 89 c2             	mov    %rax,%rdx
+  804f38:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f3f:	01 00 00 
+  804f42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f46:	83 e0 01             	and    $0x1,%eax
+  804f49:	48 85 c0             	test   %rax,%rax
+  804f4c:	74 21                	je     804f6f <pageref+0x95>
+  804f4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f52:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f56:	48 89 c2             	mov    %rax,%rdx
+  804f59:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f60:	01 00 00 
+  804f63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f67:	83 e0 01             	and    $0x1,%eax
+  804f6a:	48 85 c0             	test   %rax,%rax
+  804f6d:	75 07                	jne    804f76 <pageref+0x9c>
+    return 0;
+  804f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f74:	eb 53                	jmp    804fc9 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7a:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f7e:	48 89 c2             	mov    %rax,%rdx
+  804f81:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f88:	01 00 00 
+  804f8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f97:	83 e0 01             	and    $0x1,%eax
+  804f9a:	48 85 c0             	test   %rax,%rax
+  804f9d:	75 07                	jne    804fa6 <pageref+0xcc>
+    return 0;
+  804f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa4:	eb 23                	jmp    804fc9 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804faa:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fae:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fb5:	00 00 00 
+  804fb8:	48 c1 e0 04          	shl    $0x4,%rax
+  804fbc:	48 01 d0             	add    %rdx,%rax
+  804fbf:	48 83 c0 08          	add    $0x8,%rax
+  804fc3:	0f b7 00             	movzwl (%rax),%eax
+  804fc6:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fc9:	c9                   	leave
+  804fca:	c3                   	ret
+  804fcb:	90                   	nop
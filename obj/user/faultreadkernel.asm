@@ -0,0 +1,8049 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 44 00 00 00       	call   800070 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// buggy program - faults with a read from kernel space
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800041:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800048:	00 00 00 
+  80004b:	8b 00                	mov    (%rax),%eax
+  80004d:	89 c6                	mov    %eax,%esi
+  80004f:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  800056:	00 00 00 
+  800059:	48 89 c7             	mov    %rax,%rdi
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	48 ba 1c 02 80 00 00 	movabs $0x80021c,%rdx
+  800068:	00 00 00 
+  80006b:	ff d2                	call   *%rdx
+}
+  80006d:	90                   	nop
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	48 83 ec 20          	sub    $0x20,%rsp
+  800078:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80007b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80007f:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800086:	00 00 00 
+  800089:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80008d:	eb 13                	jmp    8000a2 <libmain+0x32>
+    (*ctor)();
+  80008f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800093:	48 8b 10             	mov    (%rax),%rdx
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	ff d2                	call   *%rdx
+    ctor++;
+  80009d:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000a2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000b0:	72 dd                	jb     80008f <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000b6:	7e 14                	jle    8000cc <libmain+0x5c>
+    binaryname = argv[0];
+  8000b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000bc:	48 8b 00             	mov    (%rax),%rax
+  8000bf:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000c6:	00 00 00 
+  8000c9:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000d3:	48 89 d6             	mov    %rdx,%rsi
+  8000d6:	89 c7                	mov    %eax,%edi
+  8000d8:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000e4:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	90                   	nop
+  8000f1:	c9                   	leave
+  8000f2:	c3                   	ret
+
+00000000008000f3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f3:	55                   	push   %rbp
+  8000f4:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000f7:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  8000fe:	00 00 00 
+  800101:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800103:	bf 00 00 00 00       	mov    $0x0,%edi
+  800108:	48 b8 52 1e 80 00 00 	movabs $0x801e52,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+}
+  800114:	90                   	nop
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	48 83 ec 10          	sub    $0x10,%rsp
+  80011f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800122:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800126:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80012a:	8b 00                	mov    (%rax),%eax
+  80012c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80012f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800133:	89 0a                	mov    %ecx,(%rdx)
+  800135:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800138:	89 d1                	mov    %edx,%ecx
+  80013a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80013e:	48 98                	cltq
+  800140:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800144:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800148:	8b 00                	mov    (%rax),%eax
+  80014a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014f:	75 2c                	jne    80017d <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800151:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800155:	8b 00                	mov    (%rax),%eax
+  800157:	48 98                	cltq
+  800159:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80015d:	48 83 c2 08          	add    $0x8,%rdx
+  800161:	48 89 c6             	mov    %rax,%rsi
+  800164:	48 89 d7             	mov    %rdx,%rdi
+  800167:	48 b8 83 1d 80 00 00 	movabs $0x801d83,%rax
+  80016e:	00 00 00 
+  800171:	ff d0                	call   *%rax
+    b->idx = 0;
+  800173:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800177:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80017d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800181:	8b 40 04             	mov    0x4(%rax),%eax
+  800184:	8d 50 01             	lea    0x1(%rax),%edx
+  800187:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80018b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80018e:	90                   	nop
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+
+0000000000800191 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800191:	55                   	push   %rbp
+  800192:	48 89 e5             	mov    %rsp,%rbp
+  800195:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80019c:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8001a3:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001aa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001b1:	00 00 00 
+  b.cnt = 0;
+  8001b4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001bb:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8001be:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8001c5:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8001cc:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001d3:	48 89 c6             	mov    %rax,%rsi
+  8001d6:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001dd:	00 00 00 
+  8001e0:	48 89 c7             	mov    %rax,%rdi
+  8001e3:	48 b8 76 05 80 00 00 	movabs $0x800576,%rax
+  8001ea:	00 00 00 
+  8001ed:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8001ef:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8001f5:	48 98                	cltq
+  8001f7:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8001fe:	48 83 c2 08          	add    $0x8,%rdx
+  800202:	48 89 c6             	mov    %rax,%rsi
+  800205:	48 89 d7             	mov    %rdx,%rdi
+  800208:	48 b8 83 1d 80 00 00 	movabs $0x801d83,%rax
+  80020f:	00 00 00 
+  800212:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800214:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+000000000080021c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800227:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80022e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800235:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80023c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800243:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80024a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800251:	84 c0                	test   %al,%al
+  800253:	74 20                	je     800275 <cprintf+0x59>
+  800255:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800259:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80025d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800261:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800265:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800269:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80026d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800271:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800275:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80027c:	00 00 00 
+  80027f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800286:	00 00 00 
+  800289:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800294:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80029b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8002a2:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002a9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002b0:	48 89 d6             	mov    %rdx,%rsi
+  8002b3:	48 89 c7             	mov    %rax,%rdi
+  8002b6:	48 b8 91 01 80 00 00 	movabs $0x800191,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+  8002c2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8002c8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+
+00000000008002d0 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8002d0:	55                   	push   %rbp
+  8002d1:	48 89 e5             	mov    %rsp,%rbp
+  8002d4:	48 83 ec 30          	sub    $0x30,%rsp
+  8002d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8002dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8002e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8002e4:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8002e7:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8002eb:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8002ef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002f2:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8002f6:	72 54                	jb     80034c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002fb:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8002fe:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800301:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800305:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030a:	48 f7 f6             	div    %rsi
+  80030d:	49 89 c2             	mov    %rax,%r10
+  800310:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800313:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800316:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80031a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80031e:	41 89 c9             	mov    %ecx,%r9d
+  800321:	41 89 f8             	mov    %edi,%r8d
+  800324:	89 d1                	mov    %edx,%ecx
+  800326:	4c 89 d2             	mov    %r10,%rdx
+  800329:	48 89 c7             	mov    %rax,%rdi
+  80032c:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb 1c                	jmp    800356 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80033a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80033e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800341:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800345:	48 89 d6             	mov    %rdx,%rsi
+  800348:	89 c7                	mov    %eax,%edi
+  80034a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80034c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800350:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800354:	7f e4                	jg     80033a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800356:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80035d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800362:	48 f7 f1             	div    %rcx
+  800365:	48 b8 50 52 80 00 00 	movabs $0x805250,%rax
+  80036c:	00 00 00 
+  80036f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800373:	0f be c0             	movsbl %al,%eax
+  800376:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80037a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80037e:	48 89 d6             	mov    %rdx,%rsi
+  800381:	89 c7                	mov    %eax,%edi
+  800383:	ff d1                	call   *%rcx
+}
+  800385:	90                   	nop
+  800386:	c9                   	leave
+  800387:	c3                   	ret
+
+0000000000800388 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800388:	55                   	push   %rbp
+  800389:	48 89 e5             	mov    %rsp,%rbp
+  80038c:	48 83 ec 10          	sub    $0x10,%rsp
+  800390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800394:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800397:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80039b:	7e 4b                	jle    8003e8 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80039d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003a1:	8b 00                	mov    (%rax),%eax
+  8003a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8003a6:	77 24                	ja     8003cc <getuint+0x44>
+  8003a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003b4:	8b 00                	mov    (%rax),%eax
+  8003b6:	89 c0                	mov    %eax,%eax
+  8003b8:	48 01 d0             	add    %rdx,%rax
+  8003bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003bf:	8b 12                	mov    (%rdx),%edx
+  8003c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8003c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c8:	89 0a                	mov    %ecx,(%rdx)
+  8003ca:	eb 14                	jmp    8003e0 <getuint+0x58>
+  8003cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8003d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8003e0:	48 8b 00             	mov    (%rax),%rax
+  8003e3:	e9 95 00 00 00       	jmp    80047d <getuint+0xf5>
+  else if (lflag)
+  8003e8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8003ec:	74 48                	je     800436 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8003ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f2:	8b 00                	mov    (%rax),%eax
+  8003f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f7:	77 24                	ja     80041d <getuint+0x95>
+  8003f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003fd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800405:	8b 00                	mov    (%rax),%eax
+  800407:	89 c0                	mov    %eax,%eax
+  800409:	48 01 d0             	add    %rdx,%rax
+  80040c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800410:	8b 12                	mov    (%rdx),%edx
+  800412:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800415:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800419:	89 0a                	mov    %ecx,(%rdx)
+  80041b:	eb 14                	jmp    800431 <getuint+0xa9>
+  80041d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800421:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800425:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800429:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80042d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800431:	48 8b 00             	mov    (%rax),%rax
+  800434:	eb 47                	jmp    80047d <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80043a:	8b 00                	mov    (%rax),%eax
+  80043c:	83 f8 2f             	cmp    $0x2f,%eax
+  80043f:	77 24                	ja     800465 <getuint+0xdd>
+  800441:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800445:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800449:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80044d:	8b 00                	mov    (%rax),%eax
+  80044f:	89 c0                	mov    %eax,%eax
+  800451:	48 01 d0             	add    %rdx,%rax
+  800454:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800458:	8b 12                	mov    (%rdx),%edx
+  80045a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80045d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800461:	89 0a                	mov    %ecx,(%rdx)
+  800463:	eb 14                	jmp    800479 <getuint+0xf1>
+  800465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800469:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80046d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800471:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800475:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800479:	8b 00                	mov    (%rax),%eax
+  80047b:	89 c0                	mov    %eax,%eax
+}
+  80047d:	c9                   	leave
+  80047e:	c3                   	ret
+
+000000000080047f <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80047f:	55                   	push   %rbp
+  800480:	48 89 e5             	mov    %rsp,%rbp
+  800483:	48 83 ec 10          	sub    $0x10,%rsp
+  800487:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80048b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80048e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800492:	7e 4b                	jle    8004df <getint+0x60>
+    return va_arg(*ap, long long);
+  800494:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800498:	8b 00                	mov    (%rax),%eax
+  80049a:	83 f8 2f             	cmp    $0x2f,%eax
+  80049d:	77 24                	ja     8004c3 <getint+0x44>
+  80049f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ab:	8b 00                	mov    (%rax),%eax
+  8004ad:	89 c0                	mov    %eax,%eax
+  8004af:	48 01 d0             	add    %rdx,%rax
+  8004b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b6:	8b 12                	mov    (%rdx),%edx
+  8004b8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004bf:	89 0a                	mov    %ecx,(%rdx)
+  8004c1:	eb 14                	jmp    8004d7 <getint+0x58>
+  8004c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004cb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004d3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004d7:	48 8b 00             	mov    (%rax),%rax
+  8004da:	e9 95 00 00 00       	jmp    800574 <getint+0xf5>
+  else if (lflag)
+  8004df:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004e3:	74 48                	je     80052d <getint+0xae>
+    return va_arg(*ap, long);
+  8004e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e9:	8b 00                	mov    (%rax),%eax
+  8004eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ee:	77 24                	ja     800514 <getint+0x95>
+  8004f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004fc:	8b 00                	mov    (%rax),%eax
+  8004fe:	89 c0                	mov    %eax,%eax
+  800500:	48 01 d0             	add    %rdx,%rax
+  800503:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800507:	8b 12                	mov    (%rdx),%edx
+  800509:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80050c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800510:	89 0a                	mov    %ecx,(%rdx)
+  800512:	eb 14                	jmp    800528 <getint+0xa9>
+  800514:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800518:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80051c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800520:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800524:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800528:	48 8b 00             	mov    (%rax),%rax
+  80052b:	eb 47                	jmp    800574 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80052d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800531:	8b 00                	mov    (%rax),%eax
+  800533:	83 f8 2f             	cmp    $0x2f,%eax
+  800536:	77 24                	ja     80055c <getint+0xdd>
+  800538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800544:	8b 00                	mov    (%rax),%eax
+  800546:	89 c0                	mov    %eax,%eax
+  800548:	48 01 d0             	add    %rdx,%rax
+  80054b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80054f:	8b 12                	mov    (%rdx),%edx
+  800551:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800554:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800558:	89 0a                	mov    %ecx,(%rdx)
+  80055a:	eb 14                	jmp    800570 <getint+0xf1>
+  80055c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800560:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800564:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800568:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80056c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800570:	8b 00                	mov    (%rax),%eax
+  800572:	48 98                	cltq
+}
+  800574:	c9                   	leave
+  800575:	c3                   	ret
+
+0000000000800576 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800576:	55                   	push   %rbp
+  800577:	48 89 e5             	mov    %rsp,%rbp
+  80057a:	41 54                	push   %r12
+  80057c:	53                   	push   %rbx
+  80057d:	48 83 ec 60          	sub    $0x60,%rsp
+  800581:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800585:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800589:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80058d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800591:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800595:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800599:	48 8b 06             	mov    (%rsi),%rax
+  80059c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005a0:	48 89 01             	mov    %rax,(%rcx)
+  8005a3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005a7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005ab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005af:	eb 17                	jmp    8005c8 <vprintfmt+0x52>
+      if (ch == '\0')
+  8005b1:	85 db                	test   %ebx,%ebx
+  8005b3:	0f 84 bf 04 00 00    	je     800a78 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005bd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8005c1:	48 89 c6             	mov    %rax,%rsi
+  8005c4:	89 df                	mov    %ebx,%edi
+  8005c6:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005c8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8005cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005d0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005d4:	0f b6 00             	movzbl (%rax),%eax
+  8005d7:	0f b6 d8             	movzbl %al,%ebx
+  8005da:	83 fb 25             	cmp    $0x25,%ebx
+  8005dd:	75 d2                	jne    8005b1 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8005df:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8005e3:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8005ea:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8005f1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8005f8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8005ff:	eb 04                	jmp    800605 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800601:	90                   	nop
+  800602:	eb 01                	jmp    800605 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800604:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800605:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800609:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80060d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800611:	0f b6 00             	movzbl (%rax),%eax
+  800614:	0f b6 d8             	movzbl %al,%ebx
+  800617:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80061a:	83 f8 55             	cmp    $0x55,%eax
+  80061d:	0f 87 22 04 00 00    	ja     800a45 <vprintfmt+0x4cf>
+  800623:	89 c0                	mov    %eax,%eax
+  800625:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80062c:	00 
+  80062d:	48 b8 78 52 80 00 00 	movabs $0x805278,%rax
+  800634:	00 00 00 
+  800637:	48 01 d0             	add    %rdx,%rax
+  80063a:	48 8b 00             	mov    (%rax),%rax
+  80063d:	ff e0                	jmp    *%rax
+        padc = '-';
+  80063f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800643:	eb c0                	jmp    800605 <vprintfmt+0x8f>
+        padc = '0';
+  800645:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800649:	eb ba                	jmp    800605 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80064b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800652:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800655:	89 d0                	mov    %edx,%eax
+  800657:	c1 e0 02             	shl    $0x2,%eax
+  80065a:	01 d0                	add    %edx,%eax
+  80065c:	01 c0                	add    %eax,%eax
+  80065e:	01 d8                	add    %ebx,%eax
+  800660:	83 e8 30             	sub    $0x30,%eax
+  800663:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800666:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80066a:	0f b6 00             	movzbl (%rax),%eax
+  80066d:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800670:	83 fb 2f             	cmp    $0x2f,%ebx
+  800673:	7e 60                	jle    8006d5 <vprintfmt+0x15f>
+  800675:	83 fb 39             	cmp    $0x39,%ebx
+  800678:	7f 5b                	jg     8006d5 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80067a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80067f:	eb d1                	jmp    800652 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800681:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800684:	83 f8 2f             	cmp    $0x2f,%eax
+  800687:	77 17                	ja     8006a0 <vprintfmt+0x12a>
+  800689:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80068d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800690:	89 d2                	mov    %edx,%edx
+  800692:	48 01 d0             	add    %rdx,%rax
+  800695:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800698:	83 c2 08             	add    $0x8,%edx
+  80069b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80069e:	eb 0c                	jmp    8006ac <vprintfmt+0x136>
+  8006a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8006a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006a8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006ac:	8b 00                	mov    (%rax),%eax
+  8006ae:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006b1:	eb 23                	jmp    8006d6 <vprintfmt+0x160>
+        if (width < 0)
+  8006b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006b7:	0f 89 44 ff ff ff    	jns    800601 <vprintfmt+0x8b>
+          width = 0;
+  8006bd:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8006c4:	e9 38 ff ff ff       	jmp    800601 <vprintfmt+0x8b>
+        altflag = 1;
+  8006c9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8006d0:	e9 30 ff ff ff       	jmp    800605 <vprintfmt+0x8f>
+        goto process_precision;
+  8006d5:	90                   	nop
+        if (width < 0)
+  8006d6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006da:	0f 89 24 ff ff ff    	jns    800604 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8006e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8006e3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8006e6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8006ed:	e9 12 ff ff ff       	jmp    800604 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8006f2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8006f6:	e9 0a ff ff ff       	jmp    800605 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8006fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800701:	77 17                	ja     80071a <vprintfmt+0x1a4>
+  800703:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800707:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80070a:	89 d2                	mov    %edx,%edx
+  80070c:	48 01 d0             	add    %rdx,%rax
+  80070f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800712:	83 c2 08             	add    $0x8,%edx
+  800715:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800718:	eb 0c                	jmp    800726 <vprintfmt+0x1b0>
+  80071a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80071e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800722:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800726:	8b 00                	mov    (%rax),%eax
+  800728:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80072c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800730:	48 89 d6             	mov    %rdx,%rsi
+  800733:	89 c7                	mov    %eax,%edi
+  800735:	ff d1                	call   *%rcx
+        break;
+  800737:	e9 37 03 00 00       	jmp    800a73 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80073c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073f:	83 f8 2f             	cmp    $0x2f,%eax
+  800742:	77 17                	ja     80075b <vprintfmt+0x1e5>
+  800744:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800748:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80074b:	89 d2                	mov    %edx,%edx
+  80074d:	48 01 d0             	add    %rdx,%rax
+  800750:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800753:	83 c2 08             	add    $0x8,%edx
+  800756:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800759:	eb 0c                	jmp    800767 <vprintfmt+0x1f1>
+  80075b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80075f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800763:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800767:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800769:	85 db                	test   %ebx,%ebx
+  80076b:	79 02                	jns    80076f <vprintfmt+0x1f9>
+          err = -err;
+  80076d:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80076f:	83 fb 15             	cmp    $0x15,%ebx
+  800772:	7f 16                	jg     80078a <vprintfmt+0x214>
+  800774:	48 ba a0 51 80 00 00 	movabs $0x8051a0,%rdx
+  80077b:	00 00 00 
+  80077e:	48 63 c3             	movslq %ebx,%rax
+  800781:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800785:	4d 85 e4             	test   %r12,%r12
+  800788:	75 2e                	jne    8007b8 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80078a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80078e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800792:	89 d9                	mov    %ebx,%ecx
+  800794:	48 ba 61 52 80 00 00 	movabs $0x805261,%rdx
+  80079b:	00 00 00 
+  80079e:	48 89 c7             	mov    %rax,%rdi
+  8007a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a6:	49 b8 82 0a 80 00 00 	movabs $0x800a82,%r8
+  8007ad:	00 00 00 
+  8007b0:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007b3:	e9 bb 02 00 00       	jmp    800a73 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007b8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007c0:	4c 89 e1             	mov    %r12,%rcx
+  8007c3:	48 ba 6a 52 80 00 00 	movabs $0x80526a,%rdx
+  8007ca:	00 00 00 
+  8007cd:	48 89 c7             	mov    %rax,%rdi
+  8007d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d5:	49 b8 82 0a 80 00 00 	movabs $0x800a82,%r8
+  8007dc:	00 00 00 
+  8007df:	41 ff d0             	call   *%r8
+        break;
+  8007e2:	e9 8c 02 00 00       	jmp    800a73 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8007e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ed:	77 17                	ja     800806 <vprintfmt+0x290>
+  8007ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007f3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f6:	89 d2                	mov    %edx,%edx
+  8007f8:	48 01 d0             	add    %rdx,%rax
+  8007fb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007fe:	83 c2 08             	add    $0x8,%edx
+  800801:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800804:	eb 0c                	jmp    800812 <vprintfmt+0x29c>
+  800806:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80080a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80080e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800812:	4c 8b 20             	mov    (%rax),%r12
+  800815:	4d 85 e4             	test   %r12,%r12
+  800818:	75 0a                	jne    800824 <vprintfmt+0x2ae>
+          p = "(null)";
+  80081a:	49 bc 6d 52 80 00 00 	movabs $0x80526d,%r12
+  800821:	00 00 00 
+        if (width > 0 && padc != '-')
+  800824:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800828:	7e 78                	jle    8008a2 <vprintfmt+0x32c>
+  80082a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80082e:	74 72                	je     8008a2 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800830:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800833:	48 98                	cltq
+  800835:	48 89 c6             	mov    %rax,%rsi
+  800838:	4c 89 e7             	mov    %r12,%rdi
+  80083b:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  800842:	00 00 00 
+  800845:	ff d0                	call   *%rax
+  800847:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80084a:	eb 17                	jmp    800863 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80084c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800850:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800854:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800858:	48 89 d6             	mov    %rdx,%rsi
+  80085b:	89 c7                	mov    %eax,%edi
+  80085d:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80085f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800863:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800867:	7f e3                	jg     80084c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800869:	eb 37                	jmp    8008a2 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80086b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80086f:	74 1e                	je     80088f <vprintfmt+0x319>
+  800871:	83 fb 1f             	cmp    $0x1f,%ebx
+  800874:	7e 05                	jle    80087b <vprintfmt+0x305>
+  800876:	83 fb 7e             	cmp    $0x7e,%ebx
+  800879:	7e 14                	jle    80088f <vprintfmt+0x319>
+            putch('?', putdat);
+  80087b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80087f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800883:	48 89 c6             	mov    %rax,%rsi
+  800886:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80088b:	ff d2                	call   *%rdx
+  80088d:	eb 0f                	jmp    80089e <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80088f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800893:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800897:	48 89 c6             	mov    %rax,%rsi
+  80089a:	89 df                	mov    %ebx,%edi
+  80089c:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80089e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008a2:	4c 89 e0             	mov    %r12,%rax
+  8008a5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a9:	0f b6 00             	movzbl (%rax),%eax
+  8008ac:	0f be d8             	movsbl %al,%ebx
+  8008af:	85 db                	test   %ebx,%ebx
+  8008b1:	74 28                	je     8008db <vprintfmt+0x365>
+  8008b3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008b7:	78 b2                	js     80086b <vprintfmt+0x2f5>
+  8008b9:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008c1:	79 a8                	jns    80086b <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8008c3:	eb 16                	jmp    8008db <vprintfmt+0x365>
+          putch(' ', putdat);
+  8008c5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008c9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008cd:	48 89 c6             	mov    %rax,%rsi
+  8008d0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d5:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8008d7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008db:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008df:	7f e4                	jg     8008c5 <vprintfmt+0x34f>
+        break;
+  8008e1:	e9 8d 01 00 00       	jmp    800a73 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8008e6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8008e9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8008ed:	89 d6                	mov    %edx,%esi
+  8008ef:	48 89 c7             	mov    %rax,%rdi
+  8008f2:	48 b8 7f 04 80 00 00 	movabs $0x80047f,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+  8008fe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800906:	48 85 c0             	test   %rax,%rax
+  800909:	79 1d                	jns    800928 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80090b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80090f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800913:	48 89 c6             	mov    %rax,%rsi
+  800916:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80091b:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80091d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800921:	48 f7 d8             	neg    %rax
+  800924:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800928:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80092f:	e9 d2 00 00 00       	jmp    800a06 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800934:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800937:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80093b:	89 d6                	mov    %edx,%esi
+  80093d:	48 89 c7             	mov    %rax,%rdi
+  800940:	48 b8 88 03 80 00 00 	movabs $0x800388,%rax
+  800947:	00 00 00 
+  80094a:	ff d0                	call   *%rax
+  80094c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800950:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800957:	e9 aa 00 00 00       	jmp    800a06 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80095c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80095f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800963:	89 d6                	mov    %edx,%esi
+  800965:	48 89 c7             	mov    %rax,%rdi
+  800968:	48 b8 88 03 80 00 00 	movabs $0x800388,%rax
+  80096f:	00 00 00 
+  800972:	ff d0                	call   *%rax
+  800974:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800978:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80097f:	e9 82 00 00 00       	jmp    800a06 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800984:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800988:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80098c:	48 89 c6             	mov    %rax,%rsi
+  80098f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800994:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800996:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80099a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80099e:	48 89 c6             	mov    %rax,%rsi
+  8009a1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a6:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 17                	ja     8009c7 <vprintfmt+0x451>
+  8009b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009b4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009b7:	89 d2                	mov    %edx,%edx
+  8009b9:	48 01 d0             	add    %rdx,%rax
+  8009bc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009bf:	83 c2 08             	add    $0x8,%edx
+  8009c2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009c5:	eb 0c                	jmp    8009d3 <vprintfmt+0x45d>
+  8009c7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009cb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009cf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009d3:	48 8b 00             	mov    (%rax),%rax
+  8009d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009da:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8009e1:	eb 23                	jmp    800a06 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8009e3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009e6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009ea:	89 d6                	mov    %edx,%esi
+  8009ec:	48 89 c7             	mov    %rax,%rdi
+  8009ef:	48 b8 88 03 80 00 00 	movabs $0x800388,%rax
+  8009f6:	00 00 00 
+  8009f9:	ff d0                	call   *%rax
+  8009fb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009ff:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a06:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a0b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a0e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a15:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a19:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a1d:	45 89 c1             	mov    %r8d,%r9d
+  800a20:	41 89 f8             	mov    %edi,%r8d
+  800a23:	48 89 c7             	mov    %rax,%rdi
+  800a26:	48 b8 d0 02 80 00 00 	movabs $0x8002d0,%rax
+  800a2d:	00 00 00 
+  800a30:	ff d0                	call   *%rax
+        break;
+  800a32:	eb 3f                	jmp    800a73 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a34:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a38:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a3c:	48 89 c6             	mov    %rax,%rsi
+  800a3f:	89 df                	mov    %ebx,%edi
+  800a41:	ff d2                	call   *%rdx
+        break;
+  800a43:	eb 2e                	jmp    800a73 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a45:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a49:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a4d:	48 89 c6             	mov    %rax,%rsi
+  800a50:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a55:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a57:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a5c:	eb 05                	jmp    800a63 <vprintfmt+0x4ed>
+  800a5e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a63:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a67:	48 83 e8 01          	sub    $0x1,%rax
+  800a6b:	0f b6 00             	movzbl (%rax),%eax
+  800a6e:	3c 25                	cmp    $0x25,%al
+  800a70:	75 ec                	jne    800a5e <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800a72:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a73:	e9 50 fb ff ff       	jmp    8005c8 <vprintfmt+0x52>
+        return;
+  800a78:	90                   	nop
+    }
+  }
+}
+  800a79:	48 83 c4 60          	add    $0x60,%rsp
+  800a7d:	5b                   	pop    %rbx
+  800a7e:	41 5c                	pop    %r12
+  800a80:	5d                   	pop    %rbp
+  800a81:	c3                   	ret
+
+0000000000800a82 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a82:	55                   	push   %rbp
+  800a83:	48 89 e5             	mov    %rsp,%rbp
+  800a86:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800a8d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a94:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800a9b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800aa2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800aa9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ab0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ab7:	84 c0                	test   %al,%al
+  800ab9:	74 20                	je     800adb <printfmt+0x59>
+  800abb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800abf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ac3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ac7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800acb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800acf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ad3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ad7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800adb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ae2:	00 00 00 
+  800ae5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800aec:	00 00 00 
+  800aef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800afa:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b01:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b08:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b0f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b16:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b1d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b24:	48 89 c7             	mov    %rax,%rdi
+  800b27:	48 b8 76 05 80 00 00 	movabs $0x800576,%rax
+  800b2e:	00 00 00 
+  800b31:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b33:	90                   	nop
+  800b34:	c9                   	leave
+  800b35:	c3                   	ret
+
+0000000000800b36 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b36:	55                   	push   %rbp
+  800b37:	48 89 e5             	mov    %rsp,%rbp
+  800b3a:	48 83 ec 10          	sub    $0x10,%rsp
+  800b3e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b41:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b49:	8b 40 10             	mov    0x10(%rax),%eax
+  800b4c:	8d 50 01             	lea    0x1(%rax),%edx
+  800b4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b53:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5a:	48 8b 10             	mov    (%rax),%rdx
+  800b5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b65:	48 39 c2             	cmp    %rax,%rdx
+  800b68:	73 17                	jae    800b81 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800b6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6e:	48 8b 00             	mov    (%rax),%rax
+  800b71:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800b75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b79:	48 89 0a             	mov    %rcx,(%rdx)
+  800b7c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b7f:	88 10                	mov    %dl,(%rax)
+}
+  800b81:	90                   	nop
+  800b82:	c9                   	leave
+  800b83:	c3                   	ret
+
+0000000000800b84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800b84:	55                   	push   %rbp
+  800b85:	48 89 e5             	mov    %rsp,%rbp
+  800b88:	48 83 ec 40          	sub    $0x40,%rsp
+  800b8c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b90:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b93:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b97:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800b9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b9f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800ba3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800ba6:	48 98                	cltq
+  800ba8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb0:	48 01 d0             	add    %rdx,%rax
+  800bb3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bb7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800bbe:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bc3:	74 06                	je     800bcb <vsnprintf+0x47>
+  800bc5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bc9:	7f 07                	jg     800bd2 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800bcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd0:	eb 32                	jmp    800c04 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800bd2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bd6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800bda:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800bde:	48 89 c6             	mov    %rax,%rsi
+  800be1:	48 b8 36 0b 80 00 00 	movabs $0x800b36,%rax
+  800be8:	00 00 00 
+  800beb:	48 89 c7             	mov    %rax,%rdi
+  800bee:	48 b8 76 05 80 00 00 	movabs $0x800576,%rax
+  800bf5:	00 00 00 
+  800bf8:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800bfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bfe:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c01:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+0000000000800c06 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c06:	55                   	push   %rbp
+  800c07:	48 89 e5             	mov    %rsp,%rbp
+  800c0a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c11:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c18:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c1e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c25:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c2c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c33:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c3a:	84 c0                	test   %al,%al
+  800c3c:	74 20                	je     800c5e <snprintf+0x58>
+  800c3e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c42:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c46:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c4a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c4e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c52:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c56:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c5a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c5e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800c65:	00 00 00 
+  800c68:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c6f:	00 00 00 
+  800c72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c76:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c7d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c84:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c8b:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800c92:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c99:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800c9f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ca6:	48 89 c7             	mov    %rax,%rdi
+  800ca9:	48 b8 84 0b 80 00 00 	movabs $0x800b84,%rax
+  800cb0:	00 00 00 
+  800cb3:	ff d0                	call   *%rax
+  800cb5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cbb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cc1:	c9                   	leave
+  800cc2:	c3                   	ret
+
+0000000000800cc3 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800cc3:	55                   	push   %rbp
+  800cc4:	48 89 e5             	mov    %rsp,%rbp
+  800cc7:	53                   	push   %rbx
+  800cc8:	48 83 ec 38          	sub    $0x38,%rsp
+  800ccc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ccf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cd3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800cd7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800cdb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800cdf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	89 d1                	mov    %edx,%ecx
+  800ce9:	0f a2                	cpuid
+  800ceb:	89 de                	mov    %ebx,%esi
+  800ced:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800cf0:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800cf3:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800cf6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800cf9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800cfe:	74 09                	je     800d09 <cpuid+0x46>
+}
+  800d00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d04:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d07:	89 10                	mov    %edx,(%rax)
+
+  800d09:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d0e:	74 09                	je     800d19 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d14:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d17:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d19:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d1e:	74 09                	je     800d29 <cpuid+0x66>
+char *
+  800d20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d24:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d27:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d29:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d2e:	74 09                	je     800d39 <cpuid+0x76>
+  for (; *s; s++)
+  800d30:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d34:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d37:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d39:	90                   	nop
+  800d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+
+0000000000800d40 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d40:	55                   	push   %rbp
+  800d41:	48 89 e5             	mov    %rsp,%rbp
+  800d44:	48 83 ec 18          	sub    $0x18,%rsp
+  800d48:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d4e:	89 c1                	mov    %eax,%ecx
+  800d50:	0f 01 d0             	xgetbv
+  800d53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d56:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d5c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800d5f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d63:	48 09 d0             	or     %rdx,%rax
+#else
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+0000000000800d68 <string_cpu>:
+string_cpu(void) {
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800d70:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800d77:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800d7e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d85:	00 00 00 
+  800d88:	8b 00                	mov    (%rax),%eax
+  800d8a:	85 c0                	test   %eax,%eax
+  800d8c:	78 11                	js     800d9f <string_cpu+0x37>
+    return string_features;
+  800d8e:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d95:	00 00 00 
+  800d98:	8b 00                	mov    (%rax),%eax
+  800d9a:	e9 df 00 00 00       	jmp    800e7e <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800d9f:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800da3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800da9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db3:	48 89 c6             	mov    %rax,%rsi
+  800db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dbb:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  800dc2:	00 00 00 
+  800dc5:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800dc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800dca:	83 f8 06             	cmp    $0x6,%eax
+  800dcd:	76 28                	jbe    800df7 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800dcf:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800dd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dde:	48 89 c2             	mov    %rax,%rdx
+  800de1:	be 00 00 00 00       	mov    $0x0,%esi
+  800de6:	bf 07 00 00 00       	mov    $0x7,%edi
+  800deb:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  800df2:	00 00 00 
+  800df5:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800df7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800dfa:	25 00 02 00 00       	and    $0x200,%eax
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	74 04                	je     800e07 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e03:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e07:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e11:	48 89 c1             	mov    %rax,%rcx
+  800e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e19:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e23:	48 b8 c3 0c 80 00 00 	movabs $0x800cc3,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e32:	83 e0 20             	and    $0x20,%eax
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	74 2a                	je     800e63 <string_cpu+0xfb>
+  800e39:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e3c:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e41:	85 c0                	test   %eax,%eax
+  800e43:	74 1e                	je     800e63 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4a:	48 b8 40 0d 80 00 00 	movabs $0x800d40,%rax
+  800e51:	00 00 00 
+  800e54:	ff d0                	call   *%rax
+  800e56:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e59:	48 83 f8 06          	cmp    $0x6,%rax
+  800e5d:	75 04                	jne    800e63 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800e5f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800e63:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800e6a:	00 00 00 
+  800e6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e70:	89 02                	mov    %eax,(%rdx)
+  800e72:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e79:	00 00 00 
+  800e7c:	8b 00                	mov    (%rax),%eax
+}
+  800e7e:	c9                   	leave
+  800e7f:	c3                   	ret
+
+0000000000800e80 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800e80:	55                   	push   %rbp
+  800e81:	48 89 e5             	mov    %rsp,%rbp
+  800e84:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800e88:	48 83 ec 60          	sub    $0x60,%rsp
+  800e8c:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800e91:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800e96:	83 e0 1f             	and    $0x1f,%eax
+  800e99:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800e9d:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ea1:	48 f7 d8             	neg    %rax
+  800ea4:	48 89 c2             	mov    %rax,%rdx
+  800ea7:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800eac:	48 01 d0             	add    %rdx,%rax
+  800eaf:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800eb4:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800eb8:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800ebe:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ec3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ec7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ecd:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ed1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800ed5:	89 c2                	mov    %eax,%edx
+  800ed7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800edb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800ee0:	89 c1                	mov    %eax,%ecx
+  800ee2:	d3 e6                	shl    %cl,%esi
+  800ee4:	89 f0                	mov    %esi,%eax
+  800ee6:	21 d0                	and    %edx,%eax
+  800ee8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800eec:	eb 21                	jmp    800f0f <strlen_avx2+0x8f>
+    p += 32;
+  800eee:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800ef4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ef9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800efd:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f03:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f07:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f0b:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f0f:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f14:	74 d8                	je     800eee <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f16:	31 c0                	xor    %eax,%eax
+  800f18:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f1e:	48 63 d0             	movslq %eax,%rdx
+  800f21:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f26:	48 01 d0             	add    %rdx,%rax
+  800f29:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f2e:	c9                   	leave
+  800f2f:	c3                   	ret
+
+0000000000800f30 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f30:	55                   	push   %rbp
+  800f31:	48 89 e5             	mov    %rsp,%rbp
+  800f34:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f38:	48 83 ec 40          	sub    $0x40,%rsp
+  800f3c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f41:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f46:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f4b:	eb 77                	jmp    800fc4 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f4d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f52:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f56:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f5a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800f5f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f63:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f67:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f6b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800f6f:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800f74:	74 3c                	je     800fb2 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800f76:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800f7a:	f7 d0                	not    %eax
+  800f7c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f80:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800f84:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800f88:	48 63 d0             	movslq %eax,%rdx
+  800f8b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f90:	48 01 d0             	add    %rdx,%rax
+  800f93:	0f b6 00             	movzbl (%rax),%eax
+  800f96:	0f b6 c0             	movzbl %al,%eax
+  800f99:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800f9d:	48 63 ca             	movslq %edx,%rcx
+  800fa0:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fa5:	48 01 ca             	add    %rcx,%rdx
+  800fa8:	0f b6 12             	movzbl (%rdx),%edx
+  800fab:	0f b6 d2             	movzbl %dl,%edx
+  800fae:	29 d0                	sub    %edx,%eax
+  800fb0:	eb 6b                	jmp    80101d <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fb2:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800fb8:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800fbe:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800fc4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800fca:	77 81                	ja     800f4d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800fcc:	eb 42                	jmp    801010 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800fce:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fd3:	0f b6 10             	movzbl (%rax),%edx
+  800fd6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fdb:	0f b6 00             	movzbl (%rax),%eax
+  800fde:	38 c2                	cmp    %al,%dl
+  800fe0:	74 1c                	je     800ffe <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800fe2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fe7:	0f b6 00             	movzbl (%rax),%eax
+  800fea:	0f b6 c8             	movzbl %al,%ecx
+  800fed:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800ff2:	0f b6 00             	movzbl (%rax),%eax
+  800ff5:	0f b6 d0             	movzbl %al,%edx
+  800ff8:	89 c8                	mov    %ecx,%eax
+  800ffa:	29 d0                	sub    %edx,%eax
+  800ffc:	eb 1f                	jmp    80101d <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  800ffe:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801004:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80100a:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801010:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801016:	75 b6                	jne    800fce <memcmp_avx2+0x9e>
+  return 0;
+  801018:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80101d:	c9                   	leave
+  80101e:	c3                   	ret
+
+000000000080101f <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80101f:	55                   	push   %rbp
+  801020:	48 89 e5             	mov    %rsp,%rbp
+  801023:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801027:	48 83 ec 60          	sub    $0x60,%rsp
+  80102b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801030:	89 f0                	mov    %esi,%eax
+  801032:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801037:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80103b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801040:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801044:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801049:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80104f:	eb 47                	jmp    801098 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801051:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801056:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80105a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80105e:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801064:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801068:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80106c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801070:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801075:	74 15                	je     80108c <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801077:	31 c0                	xor    %eax,%eax
+  801079:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80107f:	48 63 d0             	movslq %eax,%rdx
+  801082:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801087:	48 01 d0             	add    %rdx,%rax
+  80108a:	eb 3d                	jmp    8010c9 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80108c:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801092:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801098:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80109e:	77 b1                	ja     801051 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8010a0:	eb 0c                	jmp    8010ae <memfind_avx2+0x8f>
+  8010a2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010a8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010ae:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010b4:	74 0e                	je     8010c4 <memfind_avx2+0xa5>
+  8010b6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010bb:	0f b6 00             	movzbl (%rax),%eax
+  8010be:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8010c2:	75 de                	jne    8010a2 <memfind_avx2+0x83>
+  return s;
+  8010c4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+
+00000000008010cb <strlen>:
+strlen(const char *s) {
+  8010cb:	55                   	push   %rbp
+  8010cc:	48 89 e5             	mov    %rsp,%rbp
+  8010cf:	48 83 ec 40          	sub    $0x40,%rsp
+  8010d3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8010d7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8010db:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8010df:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  8010e6:	00 00 00 
+  8010e9:	ff d0                	call   *%rax
+  8010eb:	83 e0 02             	and    $0x2,%eax
+  8010ee:	85 c0                	test   %eax,%eax
+  8010f0:	74 18                	je     80110a <strlen+0x3f>
+    return strlen_avx2(s);
+  8010f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010f6:	48 89 c7             	mov    %rax,%rdi
+  8010f9:	48 b8 80 0e 80 00 00 	movabs $0x800e80,%rax
+  801100:	00 00 00 
+  801103:	ff d0                	call   *%rax
+  801105:	e9 82 00 00 00       	jmp    80118c <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80110a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80110e:	83 e0 0f             	and    $0xf,%eax
+  801111:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801114:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801117:	48 f7 d8             	neg    %rax
+  80111a:	48 89 c2             	mov    %rax,%rdx
+  80111d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801121:	48 01 d0             	add    %rdx,%rax
+  801124:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801128:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80112c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801130:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801135:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801139:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80113d:	89 c2                	mov    %eax,%edx
+  80113f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801142:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801147:	89 c1                	mov    %eax,%ecx
+  801149:	d3 e6                	shl    %cl,%esi
+  80114b:	89 f0                	mov    %esi,%eax
+  80114d:	21 d0                	and    %edx,%eax
+  80114f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801152:	eb 1d                	jmp    801171 <strlen+0xa6>
+    p += 16;
+  801154:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801159:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80115d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801161:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801166:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80116a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80116e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801171:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801175:	74 dd                	je     801154 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801177:	31 c0                	xor    %eax,%eax
+  801179:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80117e:	48 63 d0             	movslq %eax,%rdx
+  801181:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801185:	48 01 d0             	add    %rdx,%rax
+  801188:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80118c:	c9                   	leave
+  80118d:	c3                   	ret
+
+000000000080118e <strnlen>:
+strnlen(const char *s, size_t size) {
+  80118e:	55                   	push   %rbp
+  80118f:	48 89 e5             	mov    %rsp,%rbp
+  801192:	48 83 ec 20          	sub    $0x20,%rsp
+  801196:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80119a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80119e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011a5:	eb 0e                	jmp    8011b5 <strnlen+0x27>
+    n++;
+  8011a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011ab:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011b0:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011b5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011ba:	74 0b                	je     8011c7 <strnlen+0x39>
+  8011bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c0:	0f b6 00             	movzbl (%rax),%eax
+  8011c3:	84 c0                	test   %al,%al
+  8011c5:	75 e0                	jne    8011a7 <strnlen+0x19>
+  return n;
+  8011c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+
+00000000008011cc <strcpy>:
+strcpy(char *dst, const char *src) {
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+  8011d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8011d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8011dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8011e4:	90                   	nop
+  8011e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011e9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011fd:	0f b6 12             	movzbl (%rdx),%edx
+  801200:	88 10                	mov    %dl,(%rax)
+  801202:	0f b6 00             	movzbl (%rax),%eax
+  801205:	84 c0                	test   %al,%al
+  801207:	75 dc                	jne    8011e5 <strcpy+0x19>
+  return ret;
+  801209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80120d:	c9                   	leave
+  80120e:	c3                   	ret
+
+000000000080120f <strcat>:
+strcat(char *dst, const char *src) {
+  80120f:	55                   	push   %rbp
+  801210:	48 89 e5             	mov    %rsp,%rbp
+  801213:	48 83 ec 20          	sub    $0x20,%rsp
+  801217:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80121b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80121f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801223:	48 89 c7             	mov    %rax,%rdi
+  801226:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  80122d:	00 00 00 
+  801230:	ff d0                	call   *%rax
+  801232:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801235:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801238:	48 63 d0             	movslq %eax,%rdx
+  80123b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80123f:	48 01 c2             	add    %rax,%rdx
+  801242:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801246:	48 89 c6             	mov    %rax,%rsi
+  801249:	48 89 d7             	mov    %rdx,%rdi
+  80124c:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  801253:	00 00 00 
+  801256:	ff d0                	call   *%rax
+  return dst;
+  801258:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+000000000080125e <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80125e:	55                   	push   %rbp
+  80125f:	48 89 e5             	mov    %rsp,%rbp
+  801262:	48 83 ec 28          	sub    $0x28,%rsp
+  801266:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80126a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80126e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801272:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801276:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80127a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801281:	00 
+  801282:	eb 2a                	jmp    8012ae <strncpy+0x50>
+    *dst++ = *src;
+  801284:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801288:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80128c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801290:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801294:	0f b6 12             	movzbl (%rdx),%edx
+  801297:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801299:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80129d:	0f b6 00             	movzbl (%rax),%eax
+  8012a0:	84 c0                	test   %al,%al
+  8012a2:	74 05                	je     8012a9 <strncpy+0x4b>
+      src++;
+  8012a4:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012b6:	72 cc                	jb     801284 <strncpy+0x26>
+  return ret;
+  8012b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012bc:	c9                   	leave
+  8012bd:	c3                   	ret
+
+00000000008012be <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8012be:	55                   	push   %rbp
+  8012bf:	48 89 e5             	mov    %rsp,%rbp
+  8012c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8012c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012ce:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8012d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8012da:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012df:	74 3d                	je     80131e <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8012e1:	eb 1d                	jmp    801300 <strlcpy+0x42>
+      *dst++ = *src++;
+  8012e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012e7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012eb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012fb:	0f b6 12             	movzbl (%rdx),%edx
+  8012fe:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801300:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801305:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80130a:	74 0b                	je     801317 <strlcpy+0x59>
+  80130c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801310:	0f b6 00             	movzbl (%rax),%eax
+  801313:	84 c0                	test   %al,%al
+  801315:	75 cc                	jne    8012e3 <strlcpy+0x25>
+    *dst = '\0';
+  801317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131b:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80131e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801322:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801326:	c9                   	leave
+  801327:	c3                   	ret
+
+0000000000801328 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	48 83 ec 30          	sub    $0x30,%rsp
+  801330:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801334:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801338:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80133c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801340:	48 89 c7             	mov    %rax,%rdi
+  801343:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  80134a:	00 00 00 
+  80134d:	ff d0                	call   *%rax
+  80134f:	48 98                	cltq
+  801351:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801355:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135d:	48 89 d6             	mov    %rdx,%rsi
+  801360:	48 89 c7             	mov    %rax,%rdi
+  801363:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  80136a:	00 00 00 
+  80136d:	ff d0                	call   *%rax
+  80136f:	48 98                	cltq
+  801371:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801375:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801379:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80137d:	75 10                	jne    80138f <strlcat+0x67>
+    return maxlen + srclen;
+  80137f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801387:	48 01 d0             	add    %rdx,%rax
+  80138a:	e9 86 00 00 00       	jmp    801415 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80138f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801393:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801397:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80139b:	73 2b                	jae    8013c8 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80139d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ad:	48 01 c1             	add    %rax,%rcx
+  8013b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013b4:	48 89 c6             	mov    %rax,%rsi
+  8013b7:	48 89 cf             	mov    %rcx,%rdi
+  8013ba:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  8013c1:	00 00 00 
+  8013c4:	ff d0                	call   *%rax
+  8013c6:	eb 42                	jmp    80140a <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8013c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013cc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d8:	48 01 c1             	add    %rax,%rcx
+  8013db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013df:	48 89 c6             	mov    %rax,%rsi
+  8013e2:	48 89 cf             	mov    %rcx,%rdi
+  8013e5:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  8013ec:	00 00 00 
+  8013ef:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8013f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013f9:	48 01 d0             	add    %rdx,%rax
+  8013fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801404:	48 01 d0             	add    %rdx,%rax
+  801407:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80140a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80140e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801412:	48 01 d0             	add    %rdx,%rax
+}
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+
+0000000000801417 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801417:	55                   	push   %rbp
+  801418:	48 89 e5             	mov    %rsp,%rbp
+  80141b:	48 83 ec 10          	sub    $0x10,%rsp
+  80141f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801423:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801427:	eb 0a                	jmp    801433 <strcmp+0x1c>
+    p++, q++;
+  801429:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80142e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801433:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801437:	0f b6 00             	movzbl (%rax),%eax
+  80143a:	84 c0                	test   %al,%al
+  80143c:	74 12                	je     801450 <strcmp+0x39>
+  80143e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801442:	0f b6 10             	movzbl (%rax),%edx
+  801445:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801449:	0f b6 00             	movzbl (%rax),%eax
+  80144c:	38 c2                	cmp    %al,%dl
+  80144e:	74 d9                	je     801429 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801454:	0f b6 00             	movzbl (%rax),%eax
+  801457:	0f b6 d0             	movzbl %al,%edx
+  80145a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80145e:	0f b6 00             	movzbl (%rax),%eax
+  801461:	0f b6 c0             	movzbl %al,%eax
+  801464:	29 c2                	sub    %eax,%edx
+  801466:	89 d0                	mov    %edx,%eax
+}
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+
+000000000080146a <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	48 83 ec 18          	sub    $0x18,%rsp
+  801472:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801476:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80147a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80147e:	eb 0f                	jmp    80148f <strncmp+0x25>
+    n--, p++, q++;
+  801480:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801485:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80148a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80148f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801494:	74 1d                	je     8014b3 <strncmp+0x49>
+  801496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80149a:	0f b6 00             	movzbl (%rax),%eax
+  80149d:	84 c0                	test   %al,%al
+  80149f:	74 12                	je     8014b3 <strncmp+0x49>
+  8014a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a5:	0f b6 10             	movzbl (%rax),%edx
+  8014a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ac:	0f b6 00             	movzbl (%rax),%eax
+  8014af:	38 c2                	cmp    %al,%dl
+  8014b1:	74 cd                	je     801480 <strncmp+0x16>
+  if (n == 0)
+  8014b3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014b8:	75 07                	jne    8014c1 <strncmp+0x57>
+    return 0;
+  8014ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014bf:	eb 16                	jmp    8014d7 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8014c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c5:	0f b6 00             	movzbl (%rax),%eax
+  8014c8:	0f b6 d0             	movzbl %al,%edx
+  8014cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014cf:	0f b6 00             	movzbl (%rax),%eax
+  8014d2:	0f b6 c0             	movzbl %al,%eax
+  8014d5:	29 c2                	sub    %eax,%edx
+}
+  8014d7:	89 d0                	mov    %edx,%eax
+  8014d9:	c9                   	leave
+  8014da:	c3                   	ret
+
+00000000008014db <strchr>:
+strchr(const char *s, char c) {
+  8014db:	55                   	push   %rbp
+  8014dc:	48 89 e5             	mov    %rsp,%rbp
+  8014df:	48 83 ec 60          	sub    $0x60,%rsp
+  8014e3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8014e7:	89 f0                	mov    %esi,%eax
+  8014e9:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8014ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014f0:	83 e0 0f             	and    $0xf,%eax
+  8014f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8014f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8014f9:	48 f7 d8             	neg    %rax
+  8014fc:	48 89 c2             	mov    %rax,%rdx
+  8014ff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801503:	48 01 d0             	add    %rdx,%rax
+  801506:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80150a:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80150e:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801512:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801516:	66 0f 6e c0          	movd   %eax,%xmm0
+  80151a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80151e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801522:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801527:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80152b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801533:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801537:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80153c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801541:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801545:	89 c2                	mov    %eax,%edx
+  801547:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80154c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801551:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801555:	09 c2                	or     %eax,%edx
+  801557:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80155a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80155f:	89 c1                	mov    %eax,%ecx
+  801561:	d3 e6                	shl    %cl,%esi
+  801563:	89 f0                	mov    %esi,%eax
+  801565:	21 d0                	and    %edx,%eax
+  801567:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80156a:	eb 34                	jmp    8015a0 <strchr+0xc5>
+    p += 16;
+  80156c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801571:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801575:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801579:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80157d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801582:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801587:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80158b:	89 c2                	mov    %eax,%edx
+  80158d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801592:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801597:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80159b:	09 d0                	or     %edx,%eax
+  80159d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015a4:	74 c6                	je     80156c <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015a6:	31 c0                	xor    %eax,%eax
+  8015a8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015ad:	48 98                	cltq
+  8015af:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b7:	0f b6 00             	movzbl (%rax),%eax
+  8015ba:	84 c0                	test   %al,%al
+  8015bc:	74 06                	je     8015c4 <strchr+0xe9>
+  8015be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c2:	eb 05                	jmp    8015c9 <strchr+0xee>
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+00000000008015cb <strfind>:
+strfind(const char *s, char c) {
+  8015cb:	55                   	push   %rbp
+  8015cc:	48 89 e5             	mov    %rsp,%rbp
+  8015cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8015d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d7:	89 f0                	mov    %esi,%eax
+  8015d9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8015dc:	eb 11                	jmp    8015ef <strfind+0x24>
+    if (*s == c)
+  8015de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e2:	0f b6 00             	movzbl (%rax),%eax
+  8015e5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015e8:	74 12                	je     8015fc <strfind+0x31>
+  for (; *s; s++)
+  8015ea:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f3:	0f b6 00             	movzbl (%rax),%eax
+  8015f6:	84 c0                	test   %al,%al
+  8015f8:	75 e4                	jne    8015de <strfind+0x13>
+  8015fa:	eb 01                	jmp    8015fd <strfind+0x32>
+      break;
+  8015fc:	90                   	nop
+  return (char *)s;
+  8015fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+0000000000801603 <memset>:
+memset(void *v, int c, size_t n) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	48 83 ec 38          	sub    $0x38,%rsp
+  80160b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80160f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801612:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801616:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80161a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80161e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801623:	76 41                	jbe    801666 <memset+0x63>
+  801625:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80162c:	00 00 00 
+  80162f:	ff d0                	call   *%rax
+  801631:	83 e0 01             	and    $0x1,%eax
+  801634:	85 c0                	test   %eax,%eax
+  801636:	74 2e                	je     801666 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801638:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80163b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80163f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801643:	48 89 ce             	mov    %rcx,%rsi
+  801646:	48 89 f7             	mov    %rsi,%rdi
+  801649:	48 89 d1             	mov    %rdx,%rcx
+  80164c:	fc                   	cld
+  80164d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80164f:	48 89 ca             	mov    %rcx,%rdx
+  801652:	48 89 fe             	mov    %rdi,%rsi
+  801655:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801659:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80165d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801661:	e9 a7 00 00 00       	jmp    80170d <memset+0x10a>
+  if (n >= 8) {
+  801666:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80166b:	0f 86 87 00 00 00    	jbe    8016f8 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801671:	eb 16                	jmp    801689 <memset+0x86>
+      *p++ = c;
+  801673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801677:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80167b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80167f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801682:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801684:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801689:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168d:	83 e0 07             	and    $0x7,%eax
+  801690:	48 85 c0             	test   %rax,%rax
+  801693:	75 de                	jne    801673 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801695:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801698:	0f b6 c0             	movzbl %al,%eax
+  80169b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016a2:	01 01 01 
+  8016a5:	48 0f af c2          	imul   %rdx,%rax
+  8016a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016b1:	48 c1 e8 03          	shr    $0x3,%rax
+  8016b5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016bd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016c5:	48 89 ce             	mov    %rcx,%rsi
+  8016c8:	48 89 f7             	mov    %rsi,%rdi
+  8016cb:	48 89 d1             	mov    %rdx,%rcx
+  8016ce:	fc                   	cld
+  8016cf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016d2:	48 89 ca             	mov    %rcx,%rdx
+  8016d5:	48 89 fe             	mov    %rdi,%rsi
+  8016d8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8016e0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8016e5:	eb 11                	jmp    8016f8 <memset+0xf5>
+    *p++ = c;
+  8016e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016ef:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016f3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016f6:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8016f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801700:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801704:	48 85 c0             	test   %rax,%rax
+  801707:	75 de                	jne    8016e7 <memset+0xe4>
+  return v;
+  801709:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	48 83 ec 38          	sub    $0x38,%rsp
+  801717:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80171b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80171f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801723:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801727:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80172b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80172f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801737:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80173b:	0f 83 da 00 00 00    	jae    80181b <memmove+0x10c>
+  801741:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801745:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801749:	48 01 d0             	add    %rdx,%rax
+  80174c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801750:	0f 83 c5 00 00 00    	jae    80181b <memmove+0x10c>
+    s += n;
+  801756:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80175e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801762:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801766:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80176b:	0f 86 94 00 00 00    	jbe    801805 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801771:	eb 1c                	jmp    80178f <memmove+0x80>
+        *--d = *--s;
+  801773:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801778:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80177d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801781:	0f b6 10             	movzbl (%rax),%edx
+  801784:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801788:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80178a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80178f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801793:	83 e0 07             	and    $0x7,%eax
+  801796:	48 85 c0             	test   %rax,%rax
+  801799:	75 d8                	jne    801773 <memmove+0x64>
+      nq = n / 8;
+  80179b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80179f:	48 c1 e8 03          	shr    $0x3,%rax
+  8017a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017a7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017ac:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017b1:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017b6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c2:	48 89 cf             	mov    %rcx,%rdi
+  8017c5:	48 89 d6             	mov    %rdx,%rsi
+  8017c8:	48 89 c1             	mov    %rax,%rcx
+  8017cb:	fd                   	std
+  8017cc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017cf:	fc                   	cld
+  8017d0:	48 89 c8             	mov    %rcx,%rax
+  8017d3:	48 89 f2             	mov    %rsi,%rdx
+  8017d6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8017da:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8017e2:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8017e7:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8017ec:	eb 17                	jmp    801805 <memmove+0xf6>
+      *--d = *--s;
+  8017ee:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017f3:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fc:	0f b6 10             	movzbl (%rax),%edx
+  8017ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801803:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801805:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801809:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80180d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801811:	48 85 c0             	test   %rax,%rax
+  801814:	75 d8                	jne    8017ee <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801816:	e9 f4 00 00 00       	jmp    80190f <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80181b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801820:	76 46                	jbe    801868 <memmove+0x159>
+  801822:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  801829:	00 00 00 
+  80182c:	ff d0                	call   *%rax
+  80182e:	83 e0 01             	and    $0x1,%eax
+  801831:	85 c0                	test   %eax,%eax
+  801833:	74 33                	je     801868 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801835:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801839:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80183d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801841:	48 89 cf             	mov    %rcx,%rdi
+  801844:	48 89 d6             	mov    %rdx,%rsi
+  801847:	48 89 c1             	mov    %rax,%rcx
+  80184a:	fc                   	cld
+  80184b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80184d:	48 89 c8             	mov    %rcx,%rax
+  801850:	48 89 f2             	mov    %rsi,%rdx
+  801853:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801857:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80185b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80185f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801863:	e9 ab 00 00 00       	jmp    801913 <memmove+0x204>
+    if (n >= 8) {
+  801868:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80186d:	0f 86 8b 00 00 00    	jbe    8018fe <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801873:	eb 22                	jmp    801897 <memmove+0x188>
+        *d++ = *s++;
+  801875:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801879:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80187d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801881:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801885:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801889:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80188d:	0f b6 12             	movzbl (%rdx),%edx
+  801890:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801892:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801897:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80189b:	83 e0 07             	and    $0x7,%eax
+  80189e:	48 85 c0             	test   %rax,%rax
+  8018a1:	75 d2                	jne    801875 <memmove+0x166>
+      nq = n / 8;
+  8018a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a7:	48 c1 e8 03          	shr    $0x3,%rax
+  8018ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018af:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bb:	48 89 cf             	mov    %rcx,%rdi
+  8018be:	48 89 d6             	mov    %rdx,%rsi
+  8018c1:	48 89 c1             	mov    %rax,%rcx
+  8018c4:	fc                   	cld
+  8018c5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018c8:	48 89 c8             	mov    %rcx,%rax
+  8018cb:	48 89 f2             	mov    %rsi,%rdx
+  8018ce:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018d2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018da:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8018df:	eb 1d                	jmp    8018fe <memmove+0x1ef>
+      *d++ = *s++;
+  8018e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018f5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8018f9:	0f b6 12             	movzbl (%rdx),%edx
+  8018fc:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801902:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801906:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80190a:	48 85 c0             	test   %rax,%rax
+  80190d:	75 d2                	jne    8018e1 <memmove+0x1d2>
+  return dst;
+  80190f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801913:	c9                   	leave
+  801914:	c3                   	ret
+
+0000000000801915 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801915:	55                   	push   %rbp
+  801916:	48 89 e5             	mov    %rsp,%rbp
+  801919:	48 83 ec 18          	sub    $0x18,%rsp
+  80191d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801921:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801925:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801929:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80192d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801935:	48 89 ce             	mov    %rcx,%rsi
+  801938:	48 89 c7             	mov    %rax,%rdi
+  80193b:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  801942:	00 00 00 
+  801945:	ff d0                	call   *%rax
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+0000000000801949 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801949:	55                   	push   %rbp
+  80194a:	48 89 e5             	mov    %rsp,%rbp
+  80194d:	48 83 ec 40          	sub    $0x40,%rsp
+  801951:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801955:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801959:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80195d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801961:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801965:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801969:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80196d:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801972:	0f 86 a7 00 00 00    	jbe    801a1f <memcmp+0xd6>
+  801978:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80197f:	00 00 00 
+  801982:	ff d0                	call   *%rax
+  801984:	83 e0 02             	and    $0x2,%eax
+  801987:	85 c0                	test   %eax,%eax
+  801989:	0f 84 90 00 00 00    	je     801a1f <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80198f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801993:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199b:	48 89 ce             	mov    %rcx,%rsi
+  80199e:	48 89 c7             	mov    %rax,%rdi
+  8019a1:	48 b8 30 0f 80 00 00 	movabs $0x800f30,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+  8019ad:	e9 c2 00 00 00       	jmp    801a74 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019ba:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8019be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019c6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8019ca:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8019d1:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8019d8:	74 36                	je     801a10 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8019da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019dd:	f7 d0                	not    %eax
+  8019df:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8019e3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8019e6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8019e9:	48 63 d0             	movslq %eax,%rdx
+  8019ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f0:	48 01 d0             	add    %rdx,%rax
+  8019f3:	0f b6 00             	movzbl (%rax),%eax
+  8019f6:	0f b6 c0             	movzbl %al,%eax
+  8019f9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8019fc:	48 63 ca             	movslq %edx,%rcx
+  8019ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a03:	48 01 ca             	add    %rcx,%rdx
+  801a06:	0f b6 12             	movzbl (%rdx),%edx
+  801a09:	0f b6 d2             	movzbl %dl,%edx
+  801a0c:	29 d0                	sub    %edx,%eax
+  801a0e:	eb 64                	jmp    801a74 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a10:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a15:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a1a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a1f:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a24:	77 8c                	ja     8019b2 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a26:	eb 36                	jmp    801a5e <memcmp+0x115>
+    if (*s1 != *s2)
+  801a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2c:	0f b6 10             	movzbl (%rax),%edx
+  801a2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a33:	0f b6 00             	movzbl (%rax),%eax
+  801a36:	38 c2                	cmp    %al,%dl
+  801a38:	74 1a                	je     801a54 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3e:	0f b6 00             	movzbl (%rax),%eax
+  801a41:	0f b6 c8             	movzbl %al,%ecx
+  801a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a48:	0f b6 00             	movzbl (%rax),%eax
+  801a4b:	0f b6 d0             	movzbl %al,%edx
+  801a4e:	89 c8                	mov    %ecx,%eax
+  801a50:	29 d0                	sub    %edx,%eax
+  801a52:	eb 20                	jmp    801a74 <memcmp+0x12b>
+    s1++, s2++;
+  801a54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801a5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a62:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a66:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a6a:	48 85 c0             	test   %rax,%rax
+  801a6d:	75 b9                	jne    801a28 <memcmp+0xdf>
+  }
+
+  return 0;
+  801a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a74:	c9                   	leave
+  801a75:	c3                   	ret
+
+0000000000801a76 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801a76:	55                   	push   %rbp
+  801a77:	48 89 e5             	mov    %rsp,%rbp
+  801a7a:	48 83 ec 50          	sub    $0x50,%rsp
+  801a7e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801a82:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801a85:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801a89:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a8d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a91:	48 01 d0             	add    %rdx,%rax
+  801a94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801a98:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801a9b:	66 0f 6e c0          	movd   %eax,%xmm0
+  801a9f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801aa3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801aa7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801aac:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ab0:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ab5:	76 73                	jbe    801b2a <memfind+0xb4>
+  801ab7:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	83 e0 02             	and    $0x2,%eax
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	74 60                	je     801b2a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801aca:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801acd:	0f b6 c8             	movzbl %al,%ecx
+  801ad0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ad4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ad8:	89 ce                	mov    %ecx,%esi
+  801ada:	48 89 c7             	mov    %rax,%rdi
+  801add:	48 b8 1f 10 80 00 00 	movabs $0x80101f,%rax
+  801ae4:	00 00 00 
+  801ae7:	ff d0                	call   *%rax
+  801ae9:	eb 6c                	jmp    801b57 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801aeb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aef:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801af3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801af7:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801afc:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b00:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b04:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b07:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b0b:	74 13                	je     801b20 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b0d:	31 c0                	xor    %eax,%eax
+  801b0f:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b14:	48 63 d0             	movslq %eax,%rdx
+  801b17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1b:	48 01 d0             	add    %rdx,%rax
+  801b1e:	eb 37                	jmp    801b57 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b20:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b25:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b2a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b2f:	77 ba                	ja     801aeb <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b31:	eb 13                	jmp    801b46 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b37:	0f b6 00             	movzbl (%rax),%eax
+  801b3a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b3d:	38 d0                	cmp    %dl,%al
+  801b3f:	74 11                	je     801b52 <memfind+0xdc>
+  for (; s < ends; s++)
+  801b41:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b4a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b4e:	72 e3                	jb     801b33 <memfind+0xbd>
+  801b50:	eb 01                	jmp    801b53 <memfind+0xdd>
+      break;
+  801b52:	90                   	nop
+  return (void *)s;
+  801b53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+0000000000801b59 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	48 83 ec 38          	sub    $0x38,%rsp
+  801b61:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b65:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b69:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801b6c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801b73:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b7a:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801b7b:	eb 05                	jmp    801b82 <strtol+0x29>
+    s++;
+  801b7d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801b82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b86:	0f b6 00             	movzbl (%rax),%eax
+  801b89:	3c 20                	cmp    $0x20,%al
+  801b8b:	74 f0                	je     801b7d <strtol+0x24>
+  801b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b91:	0f b6 00             	movzbl (%rax),%eax
+  801b94:	3c 09                	cmp    $0x9,%al
+  801b96:	74 e5                	je     801b7d <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9c:	0f b6 00             	movzbl (%rax),%eax
+  801b9f:	3c 2b                	cmp    $0x2b,%al
+  801ba1:	75 07                	jne    801baa <strtol+0x51>
+    s++;
+  801ba3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ba8:	eb 17                	jmp    801bc1 <strtol+0x68>
+  else if (*s == '-')
+  801baa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bae:	0f b6 00             	movzbl (%rax),%eax
+  801bb1:	3c 2d                	cmp    $0x2d,%al
+  801bb3:	75 0c                	jne    801bc1 <strtol+0x68>
+    s++, neg = 1;
+  801bb5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bba:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bc1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bc5:	74 06                	je     801bcd <strtol+0x74>
+  801bc7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bcb:	75 28                	jne    801bf5 <strtol+0x9c>
+  801bcd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd1:	0f b6 00             	movzbl (%rax),%eax
+  801bd4:	3c 30                	cmp    $0x30,%al
+  801bd6:	75 1d                	jne    801bf5 <strtol+0x9c>
+  801bd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdc:	48 83 c0 01          	add    $0x1,%rax
+  801be0:	0f b6 00             	movzbl (%rax),%eax
+  801be3:	3c 78                	cmp    $0x78,%al
+  801be5:	75 0e                	jne    801bf5 <strtol+0x9c>
+    s += 2, base = 16;
+  801be7:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bec:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bf3:	eb 2c                	jmp    801c21 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801bf5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bf9:	75 19                	jne    801c14 <strtol+0xbb>
+  801bfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bff:	0f b6 00             	movzbl (%rax),%eax
+  801c02:	3c 30                	cmp    $0x30,%al
+  801c04:	75 0e                	jne    801c14 <strtol+0xbb>
+    s++, base = 8;
+  801c06:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c0b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c12:	eb 0d                	jmp    801c21 <strtol+0xc8>
+  else if (base == 0)
+  801c14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c18:	75 07                	jne    801c21 <strtol+0xc8>
+    base = 10;
+  801c1a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c25:	0f b6 00             	movzbl (%rax),%eax
+  801c28:	3c 2f                	cmp    $0x2f,%al
+  801c2a:	7e 1d                	jle    801c49 <strtol+0xf0>
+  801c2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c30:	0f b6 00             	movzbl (%rax),%eax
+  801c33:	3c 39                	cmp    $0x39,%al
+  801c35:	7f 12                	jg     801c49 <strtol+0xf0>
+      dig = *s - '0';
+  801c37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c3b:	0f b6 00             	movzbl (%rax),%eax
+  801c3e:	0f be c0             	movsbl %al,%eax
+  801c41:	83 e8 30             	sub    $0x30,%eax
+  801c44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c47:	eb 4e                	jmp    801c97 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c4d:	0f b6 00             	movzbl (%rax),%eax
+  801c50:	3c 60                	cmp    $0x60,%al
+  801c52:	7e 1d                	jle    801c71 <strtol+0x118>
+  801c54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c58:	0f b6 00             	movzbl (%rax),%eax
+  801c5b:	3c 7a                	cmp    $0x7a,%al
+  801c5d:	7f 12                	jg     801c71 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801c5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c63:	0f b6 00             	movzbl (%rax),%eax
+  801c66:	0f be c0             	movsbl %al,%eax
+  801c69:	83 e8 57             	sub    $0x57,%eax
+  801c6c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c6f:	eb 26                	jmp    801c97 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c75:	0f b6 00             	movzbl (%rax),%eax
+  801c78:	3c 40                	cmp    $0x40,%al
+  801c7a:	7e 47                	jle    801cc3 <strtol+0x16a>
+  801c7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c80:	0f b6 00             	movzbl (%rax),%eax
+  801c83:	3c 5a                	cmp    $0x5a,%al
+  801c85:	7f 3c                	jg     801cc3 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801c87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8b:	0f b6 00             	movzbl (%rax),%eax
+  801c8e:	0f be c0             	movsbl %al,%eax
+  801c91:	83 e8 37             	sub    $0x37,%eax
+  801c94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801c97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c9a:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c9d:	7d 23                	jge    801cc2 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801c9f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ca4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ca7:	48 98                	cltq
+  801ca9:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cae:	48 89 c2             	mov    %rax,%rdx
+  801cb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cb4:	48 98                	cltq
+  801cb6:	48 01 d0             	add    %rdx,%rax
+  801cb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cbd:	e9 5f ff ff ff       	jmp    801c21 <strtol+0xc8>
+      break;
+  801cc2:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801cc3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cc8:	74 0b                	je     801cd5 <strtol+0x17c>
+    *endptr = (char *)s;
+  801cca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cd2:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801cd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cd9:	74 09                	je     801ce4 <strtol+0x18b>
+  801cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cdf:	48 f7 d8             	neg    %rax
+  801ce2:	eb 04                	jmp    801ce8 <strtol+0x18f>
+  801ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+0000000000801cea <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801cea:	55                   	push   %rbp
+  801ceb:	48 89 e5             	mov    %rsp,%rbp
+  801cee:	53                   	push   %rbx
+  801cef:	48 83 ec 48          	sub    $0x48,%rsp
+  801cf3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cf7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cfb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cff:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d03:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d07:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d13:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d17:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d1b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d1f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d23:	4c 89 c3             	mov    %r8,%rbx
+  801d26:	cd 30                	int    $0x30
+  801d28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d2c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d31:	74 46                	je     801d79 <syscall+0x8f>
+  801d33:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d38:	7e 3f                	jle    801d79 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d42:	49 89 d0             	mov    %rdx,%r8
+  801d45:	48 89 c1             	mov    %rax,%rcx
+  801d48:	48 b8 28 55 80 00 00 	movabs $0x805528,%rax
+  801d4f:	00 00 00 
+  801d52:	48 89 c2             	mov    %rax,%rdx
+  801d55:	be 22 00 00 00       	mov    $0x22,%esi
+  801d5a:	48 b8 47 55 80 00 00 	movabs $0x805547,%rax
+  801d61:	00 00 00 
+  801d64:	48 89 c7             	mov    %rax,%rdi
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	49 b9 2a 4b 80 00 00 	movabs $0x804b2a,%r9
+  801d73:	00 00 00 
+  801d76:	41 ff d1             	call   *%r9
+
+  return ret;
+  801d79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d81:	c9                   	leave
+  801d82:	c3                   	ret
+
+0000000000801d83 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d83:	55                   	push   %rbp
+  801d84:	48 89 e5             	mov    %rsp,%rbp
+  801d87:	48 83 ec 10          	sub    $0x10,%rsp
+  801d8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d8f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d93:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801d9f:	6a 00                	push   $0x0
+  801da1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801da7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dad:	48 89 d1             	mov    %rdx,%rcx
+  801db0:	48 89 c2             	mov    %rax,%rdx
+  801db3:	be 00 00 00 00       	mov    $0x0,%esi
+  801db8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbd:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+  801dc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dcd:	90                   	nop
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+0000000000801dd0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801dd0:	55                   	push   %rbp
+  801dd1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801dd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd8:	6a 00                	push   $0x0
+  801dda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df0:	be 00 00 00 00       	mov    $0x0,%esi
+  801df5:	bf 01 00 00 00       	mov    $0x1,%edi
+  801dfa:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e0a:	c9                   	leave
+  801e0b:	c3                   	ret
+
+0000000000801e0c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e0c:	55                   	push   %rbp
+  801e0d:	48 89 e5             	mov    %rsp,%rbp
+  801e10:	48 83 ec 10          	sub    $0x10,%rsp
+  801e14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e1a:	48 98                	cltq
+  801e1c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e20:	6a 00                	push   $0x0
+  801e22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e33:	48 89 c2             	mov    %rax,%rdx
+  801e36:	be 01 00 00 00       	mov    $0x1,%esi
+  801e3b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e40:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e50:	c9                   	leave
+  801e51:	c3                   	ret
+
+0000000000801e52 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e52:	55                   	push   %rbp
+  801e53:	48 89 e5             	mov    %rsp,%rbp
+  801e56:	48 83 ec 10          	sub    $0x10,%rsp
+  801e5a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e60:	48 98                	cltq
+  801e62:	48 83 ec 08          	sub    $0x8,%rsp
+  801e66:	6a 00                	push   $0x0
+  801e68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e79:	48 89 c2             	mov    %rax,%rdx
+  801e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e81:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e86:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801e8d:	00 00 00 
+  801e90:	ff d0                	call   *%rax
+  801e92:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e96:	90                   	nop
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+0000000000801e99 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801ea4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801ea8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eab:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801eae:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eb3:	cd 30                	int    $0x30
+  801eb5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801eb9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801ebd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801ec2:	7e 3d                	jle    801f01 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801ec4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec8:	49 89 c0             	mov    %rax,%r8
+  801ecb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ed0:	48 b8 28 55 80 00 00 	movabs $0x805528,%rax
+  801ed7:	00 00 00 
+  801eda:	48 89 c2             	mov    %rax,%rdx
+  801edd:	be 49 00 00 00       	mov    $0x49,%esi
+  801ee2:	48 b8 47 55 80 00 00 	movabs $0x805547,%rax
+  801ee9:	00 00 00 
+  801eec:	48 89 c7             	mov    %rax,%rdi
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef4:	49 b9 2a 4b 80 00 00 	movabs $0x804b2a,%r9
+  801efb:	00 00 00 
+  801efe:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f01:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f06:	75 13                	jne    801f1b <sys_env_wait+0x82>
+  801f08:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f0d:	74 0c                	je     801f1b <sys_env_wait+0x82>
+    *status = st;
+  801f0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f13:	89 c2                	mov    %eax,%edx
+  801f15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f19:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+
+0000000000801f21 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f21:	55                   	push   %rbp
+  801f22:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f25:	48 83 ec 08          	sub    $0x8,%rsp
+  801f29:	6a 00                	push   $0x0
+  801f2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f41:	be 00 00 00 00       	mov    $0x0,%esi
+  801f46:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f4b:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801f52:	00 00 00 
+  801f55:	ff d0                	call   *%rax
+  801f57:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f5b:	c9                   	leave
+  801f5c:	c3                   	ret
+
+0000000000801f5d <sys_yield>:
+
+void
+sys_yield(void) {
+  801f5d:	55                   	push   %rbp
+  801f5e:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f61:	48 83 ec 08          	sub    $0x8,%rsp
+  801f65:	6a 00                	push   $0x0
+  801f67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f82:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f87:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+  801f93:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f97:	90                   	nop
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+0000000000801f9a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	48 83 ec 20          	sub    $0x20,%rsp
+  801fa2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fa5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801fa9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801faf:	48 63 c8             	movslq %eax,%rcx
+  801fb2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fb9:	48 98                	cltq
+  801fbb:	48 83 ec 08          	sub    $0x8,%rsp
+  801fbf:	6a 00                	push   $0x0
+  801fc1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fc7:	49 89 c8             	mov    %rcx,%r8
+  801fca:	48 89 d1             	mov    %rdx,%rcx
+  801fcd:	48 89 c2             	mov    %rax,%rdx
+  801fd0:	be 01 00 00 00       	mov    $0x1,%esi
+  801fd5:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fda:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+  801fe6:	48 83 c4 10          	add    $0x10,%rsp
+  801fea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  801fed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+0000000000801ff2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801ff2:	55                   	push   %rbp
+  801ff3:	48 89 e5             	mov    %rsp,%rbp
+  801ff6:	48 83 ec 20          	sub    $0x20,%rsp
+  801ffa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ffd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802001:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802004:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802008:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80200c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80200f:	48 63 c8             	movslq %eax,%rcx
+  802012:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802016:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802019:	48 63 f0             	movslq %eax,%rsi
+  80201c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802020:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802023:	48 98                	cltq
+  802025:	48 83 ec 08          	sub    $0x8,%rsp
+  802029:	51                   	push   %rcx
+  80202a:	49 89 f9             	mov    %rdi,%r9
+  80202d:	49 89 f0             	mov    %rsi,%r8
+  802030:	48 89 d1             	mov    %rdx,%rcx
+  802033:	48 89 c2             	mov    %rax,%rdx
+  802036:	be 01 00 00 00       	mov    $0x1,%esi
+  80203b:	bf 07 00 00 00       	mov    $0x7,%edi
+  802040:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+
+0000000000802052 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	48 83 ec 10          	sub    $0x10,%rsp
+  80205a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80205d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802061:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802065:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802068:	48 98                	cltq
+  80206a:	48 83 ec 08          	sub    $0x8,%rsp
+  80206e:	6a 00                	push   $0x0
+  802070:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802076:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80207c:	48 89 d1             	mov    %rdx,%rcx
+  80207f:	48 89 c2             	mov    %rax,%rdx
+  802082:	be 01 00 00 00       	mov    $0x1,%esi
+  802087:	bf 08 00 00 00       	mov    $0x8,%edi
+  80208c:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802093:	00 00 00 
+  802096:	ff d0                	call   *%rax
+  802098:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209c:	c9                   	leave
+  80209d:	c3                   	ret
+
+000000000080209e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80209e:	55                   	push   %rbp
+  80209f:	48 89 e5             	mov    %rsp,%rbp
+  8020a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020a9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020af:	48 63 d0             	movslq %eax,%rdx
+  8020b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b5:	48 98                	cltq
+  8020b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020bb:	6a 00                	push   $0x0
+  8020bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c9:	48 89 d1             	mov    %rdx,%rcx
+  8020cc:	48 89 c2             	mov    %rax,%rdx
+  8020cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8020d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020d9:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e9:	c9                   	leave
+  8020ea:	c3                   	ret
+
+00000000008020eb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020eb:	55                   	push   %rbp
+  8020ec:	48 89 e5             	mov    %rsp,%rbp
+  8020ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8020fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802101:	48 98                	cltq
+  802103:	48 83 ec 08          	sub    $0x8,%rsp
+  802107:	6a 00                	push   $0x0
+  802109:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802115:	48 89 d1             	mov    %rdx,%rcx
+  802118:	48 89 c2             	mov    %rax,%rdx
+  80211b:	be 01 00 00 00       	mov    $0x1,%esi
+  802120:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802125:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802135:	c9                   	leave
+  802136:	c3                   	ret
+
+0000000000802137 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802137:	55                   	push   %rbp
+  802138:	48 89 e5             	mov    %rsp,%rbp
+  80213b:	48 83 ec 10          	sub    $0x10,%rsp
+  80213f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802142:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802146:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80214a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80214d:	48 98                	cltq
+  80214f:	48 83 ec 08          	sub    $0x8,%rsp
+  802153:	6a 00                	push   $0x0
+  802155:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80215b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802161:	48 89 d1             	mov    %rdx,%rcx
+  802164:	48 89 c2             	mov    %rax,%rdx
+  802167:	be 01 00 00 00       	mov    $0x1,%esi
+  80216c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802171:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802178:	00 00 00 
+  80217b:	ff d0                	call   *%rax
+  80217d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802181:	c9                   	leave
+  802182:	c3                   	ret
+
+0000000000802183 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802183:	55                   	push   %rbp
+  802184:	48 89 e5             	mov    %rsp,%rbp
+  802187:	48 83 ec 20          	sub    $0x20,%rsp
+  80218b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80218e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802192:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802196:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802199:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80219c:	48 63 f0             	movslq %eax,%rsi
+  80219f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021aa:	48 98                	cltq
+  8021ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b0:	6a 00                	push   $0x0
+  8021b2:	49 89 f1             	mov    %rsi,%r9
+  8021b5:	49 89 c8             	mov    %rcx,%r8
+  8021b8:	48 89 d1             	mov    %rdx,%rcx
+  8021bb:	48 89 c2             	mov    %rax,%rdx
+  8021be:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8021c8:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8021cf:	00 00 00 
+  8021d2:	ff d0                	call   *%rax
+  8021d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+
+00000000008021da <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8021da:	55                   	push   %rbp
+  8021db:	48 89 e5             	mov    %rsp,%rbp
+  8021de:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8021e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ee:	6a 00                	push   $0x0
+  8021f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802201:	48 89 c2             	mov    %rax,%rdx
+  802204:	be 01 00 00 00       	mov    $0x1,%esi
+  802209:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80220e:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802215:	00 00 00 
+  802218:	ff d0                	call   *%rax
+  80221a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+
+0000000000802220 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	48 83 ec 10          	sub    $0x10,%rsp
+  802228:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80222c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802230:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802238:	48 83 ec 08          	sub    $0x8,%rsp
+  80223c:	6a 00                	push   $0x0
+  80223e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802244:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80224a:	48 89 d1             	mov    %rdx,%rcx
+  80224d:	48 89 c2             	mov    %rax,%rdx
+  802250:	be 01 00 00 00       	mov    $0x1,%esi
+  802255:	bf 10 00 00 00       	mov    $0x10,%edi
+  80225a:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+  802266:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80226a:	c9                   	leave
+  80226b:	c3                   	ret
+
+000000000080226c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802270:	48 83 ec 08          	sub    $0x8,%rsp
+  802274:	6a 00                	push   $0x0
+  802276:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802282:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228c:	be 00 00 00 00       	mov    $0x0,%esi
+  802291:	bf 11 00 00 00       	mov    $0x11,%edi
+  802296:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80229d:	00 00 00 
+  8022a0:	ff d0                	call   *%rax
+  8022a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a6:	c9                   	leave
+  8022a7:	c3                   	ret
+
+00000000008022a8 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022a8:	55                   	push   %rbp
+  8022a9:	48 89 e5             	mov    %rsp,%rbp
+  8022ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c4:	6a 00                	push   $0x0
+  8022c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d2:	48 89 d1             	mov    %rdx,%rcx
+  8022d5:	48 89 c2             	mov    %rax,%rdx
+  8022d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022dd:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022e2:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+  8022ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f2:	c9                   	leave
+  8022f3:	c3                   	ret
+
+00000000008022f4 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8022f4:	55                   	push   %rbp
+  8022f5:	48 89 e5             	mov    %rsp,%rbp
+  8022f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8022fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802300:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802304:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802307:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80230a:	48 63 c8             	movslq %eax,%rcx
+  80230d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802311:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802315:	48 83 ec 08          	sub    $0x8,%rsp
+  802319:	6a 00                	push   $0x0
+  80231b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802321:	49 89 c8             	mov    %rcx,%r8
+  802324:	48 89 d1             	mov    %rdx,%rcx
+  802327:	48 89 c2             	mov    %rax,%rdx
+  80232a:	be 00 00 00 00       	mov    $0x0,%esi
+  80232f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802334:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80233b:	00 00 00 
+  80233e:	ff d0                	call   *%rax
+  802340:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802344:	c9                   	leave
+  802345:	c3                   	ret
+
+0000000000802346 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802346:	55                   	push   %rbp
+  802347:	48 89 e5             	mov    %rsp,%rbp
+  80234a:	48 83 ec 20          	sub    $0x20,%rsp
+  80234e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802352:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802355:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802359:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80235d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802360:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802364:	48 83 ec 08          	sub    $0x8,%rsp
+  802368:	6a 00                	push   $0x0
+  80236a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802370:	49 89 c8             	mov    %rcx,%r8
+  802373:	48 89 d1             	mov    %rdx,%rcx
+  802376:	48 89 c2             	mov    %rax,%rdx
+  802379:	be 00 00 00 00       	mov    $0x0,%esi
+  80237e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802383:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80238a:	00 00 00 
+  80238d:	ff d0                	call   *%rax
+  80238f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802393:	c9                   	leave
+  802394:	c3                   	ret
+
+0000000000802395 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802395:	55                   	push   %rbp
+  802396:	48 89 e5             	mov    %rsp,%rbp
+  802399:	48 83 ec 10          	sub    $0x10,%rsp
+  80239d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8023a4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023a7:	48 63 d0             	movslq %eax,%rdx
+  8023aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b2:	6a 00                	push   $0x0
+  8023b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c0:	48 89 d1             	mov    %rdx,%rcx
+  8023c3:	48 89 c2             	mov    %rax,%rdx
+  8023c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cb:	bf 15 00 00 00       	mov    $0x15,%edi
+  8023d0:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+  8023dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+00000000008023e2 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8023e2:	55                   	push   %rbp
+  8023e3:	48 89 e5             	mov    %rsp,%rbp
+  8023e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8023ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023ee:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023f1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8023f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8023f8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023fc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8023ff:	48 63 c8             	movslq %eax,%rcx
+  802402:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802405:	48 63 d0             	movslq %eax,%rdx
+  802408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80240c:	48 83 ec 08          	sub    $0x8,%rsp
+  802410:	6a 00                	push   $0x0
+  802412:	49 89 f1             	mov    %rsi,%r9
+  802415:	49 89 c8             	mov    %rcx,%r8
+  802418:	48 89 d1             	mov    %rdx,%rcx
+  80241b:	48 89 c2             	mov    %rax,%rdx
+  80241e:	be 00 00 00 00       	mov    $0x0,%esi
+  802423:	bf 16 00 00 00       	mov    $0x16,%edi
+  802428:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80242f:	00 00 00 
+  802432:	ff d0                	call   *%rax
+  802434:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+
+000000000080243a <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80243a:	55                   	push   %rbp
+  80243b:	48 89 e5             	mov    %rsp,%rbp
+  80243e:	48 83 ec 30          	sub    $0x30,%rsp
+  802442:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802446:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80244a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80244e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802452:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802456:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80245a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80245e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802462:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802466:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246a:	48 83 ec 08          	sub    $0x8,%rsp
+  80246e:	51                   	push   %rcx
+  80246f:	49 89 f9             	mov    %rdi,%r9
+  802472:	49 89 f0             	mov    %rsi,%r8
+  802475:	48 89 d1             	mov    %rdx,%rcx
+  802478:	48 89 c2             	mov    %rax,%rdx
+  80247b:	be 00 00 00 00       	mov    $0x0,%esi
+  802480:	bf 17 00 00 00       	mov    $0x17,%edi
+  802485:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80248c:	00 00 00 
+  80248f:	ff d0                	call   *%rax
+  802491:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802495:	c9                   	leave
+  802496:	c3                   	ret
+
+0000000000802497 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802497:	55                   	push   %rbp
+  802498:	48 89 e5             	mov    %rsp,%rbp
+  80249b:	48 83 ec 10          	sub    $0x10,%rsp
+  80249f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8024a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024a5:	48 98                	cltq
+  8024a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ab:	6a 00                	push   $0x0
+  8024ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024be:	48 89 c2             	mov    %rax,%rdx
+  8024c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024cb:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8024d2:	00 00 00 
+  8024d5:	ff d0                	call   *%rax
+  8024d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024db:	90                   	nop
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+
+00000000008024de <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8024de:	55                   	push   %rbp
+  8024df:	48 89 e5             	mov    %rsp,%rbp
+  8024e2:	48 83 ec 30          	sub    $0x30,%rsp
+  8024e6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024ed:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024f1:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8024f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024f7:	48 63 f0             	movslq %eax,%rsi
+  8024fa:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8024fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802502:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802505:	48 98                	cltq
+  802507:	48 83 ec 08          	sub    $0x8,%rsp
+  80250b:	6a 00                	push   $0x0
+  80250d:	49 89 f1             	mov    %rsi,%r9
+  802510:	49 89 c8             	mov    %rcx,%r8
+  802513:	48 89 d1             	mov    %rdx,%rcx
+  802516:	48 89 c2             	mov    %rax,%rdx
+  802519:	be 01 00 00 00       	mov    $0x1,%esi
+  80251e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802523:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80252a:	00 00 00 
+  80252d:	ff d0                	call   *%rax
+  80252f:	48 83 c4 10          	add    $0x10,%rsp
+  802533:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802536:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802539:	c9                   	leave
+  80253a:	c3                   	ret
+
+000000000080253b <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80253b:	55                   	push   %rbp
+  80253c:	48 89 e5             	mov    %rsp,%rbp
+  80253f:	48 83 ec 20          	sub    $0x20,%rsp
+  802543:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802547:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80254b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80254e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802551:	48 63 c8             	movslq %eax,%rcx
+  802554:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255c:	48 83 ec 08          	sub    $0x8,%rsp
+  802560:	6a 00                	push   $0x0
+  802562:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802568:	49 89 c8             	mov    %rcx,%r8
+  80256b:	48 89 d1             	mov    %rdx,%rcx
+  80256e:	48 89 c2             	mov    %rax,%rdx
+  802571:	be 01 00 00 00       	mov    $0x1,%esi
+  802576:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80257b:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+  802587:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80258b:	c9                   	leave
+  80258c:	c3                   	ret
+
+000000000080258d <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80258d:	55                   	push   %rbp
+  80258e:	48 89 e5             	mov    %rsp,%rbp
+  802591:	48 83 ec 20          	sub    $0x20,%rsp
+  802595:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802599:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80259d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8025a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025a5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b1:	6a 00                	push   $0x0
+  8025b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b9:	49 89 c8             	mov    %rcx,%r8
+  8025bc:	48 89 d1             	mov    %rdx,%rcx
+  8025bf:	48 89 c2             	mov    %rax,%rdx
+  8025c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c7:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8025cc:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+  8025d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025dc:	c9                   	leave
+  8025dd:	c3                   	ret
+
+00000000008025de <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8025de:	55                   	push   %rbp
+  8025df:	48 89 e5             	mov    %rsp,%rbp
+  8025e2:	48 83 ec 30          	sub    $0x30,%rsp
+  8025e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025ee:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8025f1:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8025f5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8025f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025fc:	48 63 c8             	movslq %eax,%rcx
+  8025ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802607:	48 83 ec 08          	sub    $0x8,%rsp
+  80260b:	6a 00                	push   $0x0
+  80260d:	49 89 f1             	mov    %rsi,%r9
+  802610:	49 89 c8             	mov    %rcx,%r8
+  802613:	48 89 d1             	mov    %rdx,%rcx
+  802616:	48 89 c2             	mov    %rax,%rdx
+  802619:	be 01 00 00 00       	mov    $0x1,%esi
+  80261e:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802623:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+  80262f:	48 83 c4 10          	add    $0x10,%rsp
+  802633:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802636:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802639:	c9                   	leave
+  80263a:	c3                   	ret
+
+000000000080263b <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80263b:	55                   	push   %rbp
+  80263c:	48 89 e5             	mov    %rsp,%rbp
+  80263f:	48 83 ec 10          	sub    $0x10,%rsp
+  802643:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802646:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802649:	48 98                	cltq
+  80264b:	48 83 ec 08          	sub    $0x8,%rsp
+  80264f:	6a 00                	push   $0x0
+  802651:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802657:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802662:	48 89 c2             	mov    %rax,%rdx
+  802665:	be 01 00 00 00       	mov    $0x1,%esi
+  80266a:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80266f:	48 b8 ea 1c 80 00 00 	movabs $0x801cea,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+  80267b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+
+0000000000802681 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  802685:	48 83 ec 08          	sub    $0x8,%rsp
+  802689:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80268d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802691:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802698:	ff ff ff 
+  80269b:	48 01 d0             	add    %rdx,%rax
+  80269e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026a2:	c9                   	leave
+  8026a3:	c3                   	ret
+
+00000000008026a4 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b4:	48 89 c7             	mov    %rax,%rdi
+  8026b7:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+  8026c3:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8026c9:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+
+00000000008026cf <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8026cf:	55                   	push   %rbp
+  8026d0:	48 89 e5             	mov    %rsp,%rbp
+  8026d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8026db:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026e2:	e9 ae 00 00 00       	jmp    802795 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8026e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026ea:	c1 e0 0c             	shl    $0xc,%eax
+  8026ed:	48 98                	cltq
+  8026ef:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026f4:	48 01 d0             	add    %rdx,%rax
+  8026f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8026fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026ff:	48 c1 e8 27          	shr    $0x27,%rax
+  802703:	48 89 c2             	mov    %rax,%rdx
+  802706:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80270d:	01 00 00 
+  802710:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802714:	83 e0 01             	and    $0x1,%eax
+  802717:	48 85 c0             	test   %rax,%rax
+  80271a:	74 63                	je     80277f <fd_alloc+0xb0>
+  80271c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802720:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802724:	48 89 c2             	mov    %rax,%rdx
+  802727:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80272e:	01 00 00 
+  802731:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802735:	83 e0 01             	and    $0x1,%eax
+  802738:	48 85 c0             	test   %rax,%rax
+  80273b:	74 42                	je     80277f <fd_alloc+0xb0>
+  80273d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802741:	48 c1 e8 15          	shr    $0x15,%rax
+  802745:	48 89 c2             	mov    %rax,%rdx
+  802748:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80274f:	01 00 00 
+  802752:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802756:	83 e0 01             	and    $0x1,%eax
+  802759:	48 85 c0             	test   %rax,%rax
+  80275c:	74 21                	je     80277f <fd_alloc+0xb0>
+  80275e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802762:	48 c1 e8 0c          	shr    $0xc,%rax
+  802766:	48 89 c2             	mov    %rax,%rdx
+  802769:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802770:	01 00 00 
+  802773:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802777:	83 e0 01             	and    $0x1,%eax
+  80277a:	48 85 c0             	test   %rax,%rax
+  80277d:	75 12                	jne    802791 <fd_alloc+0xc2>
+      *fd_store = fd;
+  80277f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802783:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802787:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80278a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278f:	eb 1e                	jmp    8027af <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802791:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802795:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802799:	0f 8e 48 ff ff ff    	jle    8026e7 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80279f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027aa:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027af:	c9                   	leave
+  8027b0:	c3                   	ret
+
+00000000008027b1 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027b1:	55                   	push   %rbp
+  8027b2:	48 89 e5             	mov    %rsp,%rbp
+  8027b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8027b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8027c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027c4:	78 06                	js     8027cc <fd_lookup+0x1b>
+  8027c6:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8027ca:	7e 0a                	jle    8027d6 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8027cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d1:	e9 af 00 00 00       	jmp    802885 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8027d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027d9:	c1 e0 0c             	shl    $0xc,%eax
+  8027dc:	48 98                	cltq
+  8027de:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027e3:	48 01 d0             	add    %rdx,%rax
+  8027e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8027ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ee:	48 c1 e8 27          	shr    $0x27,%rax
+  8027f2:	48 89 c2             	mov    %rax,%rdx
+  8027f5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027fc:	01 00 00 
+  8027ff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802803:	83 e0 01             	and    $0x1,%eax
+  802806:	48 85 c0             	test   %rax,%rax
+  802809:	74 63                	je     80286e <fd_lookup+0xbd>
+  80280b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80280f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802813:	48 89 c2             	mov    %rax,%rdx
+  802816:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80281d:	01 00 00 
+  802820:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802824:	83 e0 01             	and    $0x1,%eax
+  802827:	48 85 c0             	test   %rax,%rax
+  80282a:	74 42                	je     80286e <fd_lookup+0xbd>
+  80282c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802830:	48 c1 e8 15          	shr    $0x15,%rax
+  802834:	48 89 c2             	mov    %rax,%rdx
+  802837:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80283e:	01 00 00 
+  802841:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802845:	83 e0 01             	and    $0x1,%eax
+  802848:	48 85 c0             	test   %rax,%rax
+  80284b:	74 21                	je     80286e <fd_lookup+0xbd>
+  80284d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802851:	48 c1 e8 0c          	shr    $0xc,%rax
+  802855:	48 89 c2             	mov    %rax,%rdx
+  802858:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80285f:	01 00 00 
+  802862:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802866:	83 e0 01             	and    $0x1,%eax
+  802869:	48 85 c0             	test   %rax,%rax
+  80286c:	75 07                	jne    802875 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80286e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802873:	eb 10                	jmp    802885 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802875:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802879:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80287d:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802880:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+0000000000802887 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	48 83 ec 30          	sub    $0x30,%rsp
+  80288f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802893:	89 f0                	mov    %esi,%eax
+  802895:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802898:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80289c:	48 89 c7             	mov    %rax,%rdi
+  80289f:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  8028a6:	00 00 00 
+  8028a9:	ff d0                	call   *%rax
+  8028ab:	89 c2                	mov    %eax,%edx
+  8028ad:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028b1:	48 89 c6             	mov    %rax,%rsi
+  8028b4:	89 d7                	mov    %edx,%edi
+  8028b6:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028c9:	78 0a                	js     8028d5 <fd_close+0x4e>
+  8028cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028cf:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8028d3:	74 12                	je     8028e7 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8028d5:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8028d9:	74 05                	je     8028e0 <fd_close+0x59>
+  8028db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028de:	eb 70                	jmp    802950 <fd_close+0xc9>
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	eb 69                	jmp    802950 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028eb:	8b 00                	mov    (%rax),%eax
+  8028ed:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028f1:	48 89 d6             	mov    %rdx,%rsi
+  8028f4:	89 c7                	mov    %eax,%edi
+  8028f6:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  8028fd:	00 00 00 
+  802900:	ff d0                	call   *%rax
+  802902:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802905:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802909:	78 2a                	js     802935 <fd_close+0xae>
+    if (dev->dev_close)
+  80290b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80290f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802913:	48 85 c0             	test   %rax,%rax
+  802916:	74 16                	je     80292e <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291c:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802920:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802924:	48 89 c7             	mov    %rax,%rdi
+  802927:	ff d2                	call   *%rdx
+  802929:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80292c:	eb 07                	jmp    802935 <fd_close+0xae>
+    else
+      r = 0;
+  80292e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802935:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802939:	48 89 c6             	mov    %rax,%rsi
+  80293c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802941:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  return r;
+  80294d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802950:	c9                   	leave
+  802951:	c3                   	ret
+
+0000000000802952 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802952:	55                   	push   %rbp
+  802953:	48 89 e5             	mov    %rsp,%rbp
+  802956:	48 83 ec 20          	sub    $0x20,%rsp
+  80295a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80295d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802961:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802968:	eb 3f                	jmp    8029a9 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80296a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802971:	00 00 00 
+  802974:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802977:	48 98                	cltq
+  802979:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80297d:	8b 00                	mov    (%rax),%eax
+  80297f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802982:	75 21                	jne    8029a5 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802984:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80298b:	00 00 00 
+  80298e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802991:	48 98                	cltq
+  802993:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802997:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80299b:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80299e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a3:	eb 7f                	jmp    802a24 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029a5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029a9:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029b0:	00 00 00 
+  8029b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b6:	48 98                	cltq
+  8029b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029bc:	48 85 c0             	test   %rax,%rax
+  8029bf:	75 a9                	jne    80296a <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8029c1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8029c8:	00 00 00 
+  8029cb:	8b 40 04             	mov    0x4(%rax),%eax
+  8029ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029d3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029da:	00 00 00 
+  8029dd:	48 98                	cltq
+  8029df:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029e6:	48 01 d0             	add    %rdx,%rax
+  8029e9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029ef:	8b 00                	mov    (%rax),%eax
+  8029f1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029f4:	89 c6                	mov    %eax,%esi
+  8029f6:	48 b8 58 55 80 00 00 	movabs $0x805558,%rax
+  8029fd:	00 00 00 
+  802a00:	48 89 c7             	mov    %rax,%rdi
+  802a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a08:	48 b9 1c 02 80 00 00 	movabs $0x80021c,%rcx
+  802a0f:	00 00 00 
+  802a12:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a18:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+0000000000802a26 <close>:
+
+int
+close(int fdnum) {
+  802a26:	55                   	push   %rbp
+  802a27:	48 89 e5             	mov    %rsp,%rbp
+  802a2a:	48 83 ec 20          	sub    $0x20,%rsp
+  802a2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a31:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a38:	48 89 d6             	mov    %rdx,%rsi
+  802a3b:	89 c7                	mov    %eax,%edi
+  802a3d:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+  802a49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a50:	79 05                	jns    802a57 <close+0x31>
+    return r;
+  802a52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a55:	eb 18                	jmp    802a6f <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a5b:	be 01 00 00 00       	mov    $0x1,%esi
+  802a60:	48 89 c7             	mov    %rax,%rdi
+  802a63:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  802a6a:	00 00 00 
+  802a6d:	ff d0                	call   *%rax
+}
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+
+0000000000802a71 <close_all>:
+
+void
+close_all(void) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802a79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a80:	eb 15                	jmp    802a97 <close_all+0x26>
+    close(i);
+  802a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a85:	89 c7                	mov    %eax,%edi
+  802a87:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802a93:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a97:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a9b:	7e e5                	jle    802a82 <close_all+0x11>
+}
+  802a9d:	90                   	nop
+  802a9e:	90                   	nop
+  802a9f:	c9                   	leave
+  802aa0:	c3                   	ret
+
+0000000000802aa1 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802aa1:	55                   	push   %rbp
+  802aa2:	48 89 e5             	mov    %rsp,%rbp
+  802aa5:	48 83 ec 40          	sub    $0x40,%rsp
+  802aa9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802aac:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802aaf:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802ab3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ab6:	48 89 d6             	mov    %rdx,%rsi
+  802ab9:	89 c7                	mov    %eax,%edi
+  802abb:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802ac2:	00 00 00 
+  802ac5:	ff d0                	call   *%rax
+  802ac7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802aca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ace:	79 08                	jns    802ad8 <dup+0x37>
+    return r;
+  802ad0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ad3:	e9 33 02 00 00       	jmp    802d0b <dup+0x26a>
+  close(newfdnum);
+  802ad8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802adb:	89 c7                	mov    %eax,%edi
+  802add:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  802ae4:	00 00 00 
+  802ae7:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802ae9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802aec:	c1 e0 0c             	shl    $0xc,%eax
+  802aef:	48 98                	cltq
+  802af1:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802af6:	48 01 d0             	add    %rdx,%rax
+  802af9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802afd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b01:	48 89 c7             	mov    %rax,%rdi
+  802b04:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  802b0b:	00 00 00 
+  802b0e:	ff d0                	call   *%rax
+  802b10:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b18:	48 89 c7             	mov    %rax,%rdi
+  802b1b:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+  802b27:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b2b:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b32:	00 
+  802b33:	e9 19 01 00 00       	jmp    802c51 <dup+0x1b0>
+    off -= PGSIZE;
+  802b38:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b3f:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b40:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b48:	48 01 d0             	add    %rdx,%rax
+  802b4b:	48 c1 e8 27          	shr    $0x27,%rax
+  802b4f:	48 89 c2             	mov    %rax,%rdx
+  802b52:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b59:	01 00 00 
+  802b5c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b60:	83 e0 01             	and    $0x1,%eax
+  802b63:	48 85 c0             	test   %rax,%rax
+  802b66:	0f 84 e5 00 00 00    	je     802c51 <dup+0x1b0>
+  802b6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b74:	48 01 d0             	add    %rdx,%rax
+  802b77:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b7b:	48 89 c2             	mov    %rax,%rdx
+  802b7e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b85:	01 00 00 
+  802b88:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b8c:	83 e0 01             	and    $0x1,%eax
+  802b8f:	48 85 c0             	test   %rax,%rax
+  802b92:	0f 84 b9 00 00 00    	je     802c51 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802b98:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba0:	48 01 d0             	add    %rdx,%rax
+  802ba3:	48 c1 e8 15          	shr    $0x15,%rax
+  802ba7:	48 89 c2             	mov    %rax,%rdx
+  802baa:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bb1:	01 00 00 
+  802bb4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bb8:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bbb:	48 85 c0             	test   %rax,%rax
+  802bbe:	0f 84 8d 00 00 00    	je     802c51 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bc4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bcc:	48 01 d0             	add    %rdx,%rax
+  802bcf:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bd3:	48 89 c2             	mov    %rax,%rdx
+  802bd6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bdd:	01 00 00 
+  802be0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be4:	83 e0 01             	and    $0x1,%eax
+  802be7:	48 85 c0             	test   %rax,%rax
+  802bea:	74 65                	je     802c51 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802bec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bf0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bf4:	48 01 d0             	add    %rdx,%rax
+  802bf7:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bfb:	48 89 c2             	mov    %rax,%rdx
+  802bfe:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c05:	01 00 00 
+  802c08:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c0c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c11:	89 c6                	mov    %eax,%esi
+  802c13:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c1b:	48 01 c2             	add    %rax,%rdx
+  802c1e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c26:	48 01 c8             	add    %rcx,%rax
+  802c29:	41 89 f0             	mov    %esi,%r8d
+  802c2c:	48 89 d1             	mov    %rdx,%rcx
+  802c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c34:	48 89 c6             	mov    %rax,%rsi
+  802c37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3c:	48 b8 f2 1f 80 00 00 	movabs $0x801ff2,%rax
+  802c43:	00 00 00 
+  802c46:	ff d0                	call   *%rax
+  802c48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c4f:	78 60                	js     802cb1 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c51:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c56:	0f 85 dc fe ff ff    	jne    802b38 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c60:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c64:	48 89 c2             	mov    %rax,%rdx
+  802c67:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c6e:	01 00 00 
+  802c71:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c75:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c7a:	89 c1                	mov    %eax,%ecx
+  802c7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c84:	41 89 c8             	mov    %ecx,%r8d
+  802c87:	48 89 d1             	mov    %rdx,%rcx
+  802c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8f:	48 89 c6             	mov    %rax,%rsi
+  802c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c97:	48 b8 f2 1f 80 00 00 	movabs $0x801ff2,%rax
+  802c9e:	00 00 00 
+  802ca1:	ff d0                	call   *%rax
+  802ca3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802caa:	78 08                	js     802cb4 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802cac:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802caf:	eb 5a                	jmp    802d0b <dup+0x26a>
+        goto err;
+  802cb1:	90                   	nop
+  802cb2:	eb 01                	jmp    802cb5 <dup+0x214>
+    goto err;
+  802cb4:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb9:	48 89 c6             	mov    %rax,%rsi
+  802cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc1:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802ccd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802cd4:	00 
+  802cd5:	eb 27                	jmp    802cfe <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802cd7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cdf:	48 01 d0             	add    %rdx,%rax
+  802ce2:	48 89 c6             	mov    %rax,%rsi
+  802ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cea:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cf6:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802cfd:	00 
+  802cfe:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d05:	00 
+  802d06:	76 cf                	jbe    802cd7 <dup+0x236>
+  return r;
+  802d08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d0b:	c9                   	leave
+  802d0c:	c3                   	ret
+
+0000000000802d0d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	48 83 ec 40          	sub    $0x40,%rsp
+  802d15:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d20:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d27:	48 89 d6             	mov    %rdx,%rsi
+  802d2a:	89 c7                	mov    %eax,%edi
+  802d2c:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d3b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d3f:	78 24                	js     802d65 <read+0x58>
+  802d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d45:	8b 00                	mov    (%rax),%eax
+  802d47:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d4b:	48 89 d6             	mov    %rdx,%rsi
+  802d4e:	89 c7                	mov    %eax,%edi
+  802d50:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  802d57:	00 00 00 
+  802d5a:	ff d0                	call   *%rax
+  802d5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d63:	79 0a                	jns    802d6f <read+0x62>
+    return r;
+  802d65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d68:	48 98                	cltq
+  802d6a:	e9 9e 00 00 00       	jmp    802e0d <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d73:	8b 40 08             	mov    0x8(%rax),%eax
+  802d76:	83 e0 03             	and    $0x3,%eax
+  802d79:	83 f8 01             	cmp    $0x1,%eax
+  802d7c:	75 5c                	jne    802dda <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d7e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d85:	00 00 00 
+  802d88:	8b 40 04             	mov    0x4(%rax),%eax
+  802d8b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d90:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d97:	00 00 00 
+  802d9a:	48 98                	cltq
+  802d9c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802da3:	48 01 d0             	add    %rdx,%rax
+  802da6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802dac:	8b 00                	mov    (%rax),%eax
+  802dae:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db1:	89 c6                	mov    %eax,%esi
+  802db3:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  802dba:	00 00 00 
+  802dbd:	48 89 c7             	mov    %rax,%rdi
+  802dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc5:	48 b9 1c 02 80 00 00 	movabs $0x80021c,%rcx
+  802dcc:	00 00 00 
+  802dcf:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802dd1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dd8:	eb 33                	jmp    802e0d <read+0x100>
+  }
+  if (!dev->dev_read)
+  802dda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dde:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802de2:	48 85 c0             	test   %rax,%rax
+  802de5:	75 09                	jne    802df0 <read+0xe3>
+    return -E_NOT_SUPP;
+  802de7:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802dee:	eb 1d                	jmp    802e0d <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802df0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df4:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802df8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dfc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e00:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e04:	48 89 ce             	mov    %rcx,%rsi
+  802e07:	48 89 c7             	mov    %rax,%rdi
+  802e0a:	41 ff d0             	call   *%r8
+}
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+0000000000802e0f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e0f:	55                   	push   %rbp
+  802e10:	48 89 e5             	mov    %rsp,%rbp
+  802e13:	48 83 ec 30          	sub    $0x30,%rsp
+  802e17:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e1e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e22:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e29:	eb 49                	jmp    802e74 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e2e:	48 98                	cltq
+  802e30:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e34:	48 29 c2             	sub    %rax,%rdx
+  802e37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e3a:	48 63 c8             	movslq %eax,%rcx
+  802e3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e41:	48 01 c1             	add    %rax,%rcx
+  802e44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e47:	48 89 ce             	mov    %rcx,%rsi
+  802e4a:	89 c7                	mov    %eax,%edi
+  802e4c:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+  802e58:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e5b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e5f:	79 07                	jns    802e68 <readn+0x59>
+      return m;
+  802e61:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e64:	48 98                	cltq
+  802e66:	eb 1f                	jmp    802e87 <readn+0x78>
+    if (m == 0)
+  802e68:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e6c:	74 13                	je     802e81 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802e6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e71:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e77:	48 98                	cltq
+  802e79:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802e7d:	72 ac                	jb     802e2b <readn+0x1c>
+  802e7f:	eb 01                	jmp    802e82 <readn+0x73>
+      break;
+  802e81:	90                   	nop
+  }
+  return tot;
+  802e82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e85:	48 98                	cltq
+}
+  802e87:	c9                   	leave
+  802e88:	c3                   	ret
+
+0000000000802e89 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e89:	55                   	push   %rbp
+  802e8a:	48 89 e5             	mov    %rsp,%rbp
+  802e8d:	48 83 ec 40          	sub    $0x40,%rsp
+  802e91:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e94:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e98:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e9c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ea0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ea3:	48 89 d6             	mov    %rdx,%rsi
+  802ea6:	89 c7                	mov    %eax,%edi
+  802ea8:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+  802eb4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802eb7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ebb:	78 24                	js     802ee1 <write+0x58>
+  802ebd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ec1:	8b 00                	mov    (%rax),%eax
+  802ec3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ec7:	48 89 d6             	mov    %rdx,%rsi
+  802eca:	89 c7                	mov    %eax,%edi
+  802ecc:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  802ed3:	00 00 00 
+  802ed6:	ff d0                	call   *%rax
+  802ed8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802edb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802edf:	79 0a                	jns    802eeb <write+0x62>
+    return r;
+  802ee1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee4:	48 98                	cltq
+  802ee6:	e9 9d 00 00 00       	jmp    802f88 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eef:	8b 40 08             	mov    0x8(%rax),%eax
+  802ef2:	83 e0 03             	and    $0x3,%eax
+  802ef5:	85 c0                	test   %eax,%eax
+  802ef7:	75 5c                	jne    802f55 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802ef9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f00:	00 00 00 
+  802f03:	8b 40 04             	mov    0x4(%rax),%eax
+  802f06:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f0b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f12:	00 00 00 
+  802f15:	48 98                	cltq
+  802f17:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f1e:	48 01 d0             	add    %rdx,%rax
+  802f21:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f27:	8b 00                	mov    (%rax),%eax
+  802f29:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f2c:	89 c6                	mov    %eax,%esi
+  802f2e:	48 b8 93 55 80 00 00 	movabs $0x805593,%rax
+  802f35:	00 00 00 
+  802f38:	48 89 c7             	mov    %rax,%rdi
+  802f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f40:	48 b9 1c 02 80 00 00 	movabs $0x80021c,%rcx
+  802f47:	00 00 00 
+  802f4a:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f4c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f53:	eb 33                	jmp    802f88 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f59:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f5d:	48 85 c0             	test   %rax,%rax
+  802f60:	75 09                	jne    802f6b <write+0xe2>
+    return -E_NOT_SUPP;
+  802f62:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f69:	eb 1d                	jmp    802f88 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802f6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f6f:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f77:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f7b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802f7f:	48 89 ce             	mov    %rcx,%rsi
+  802f82:	48 89 c7             	mov    %rax,%rdi
+  802f85:	41 ff d0             	call   *%r8
+}
+  802f88:	c9                   	leave
+  802f89:	c3                   	ret
+
+0000000000802f8a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802f8a:	55                   	push   %rbp
+  802f8b:	48 89 e5             	mov    %rsp,%rbp
+  802f8e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f95:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f98:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f9f:	48 89 d6             	mov    %rdx,%rsi
+  802fa2:	89 c7                	mov    %eax,%edi
+  802fa4:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+  802fb0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fb7:	79 05                	jns    802fbe <seek+0x34>
+    return r;
+  802fb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fbc:	eb 0f                	jmp    802fcd <seek+0x43>
+  fd->fd_offset = offset;
+  802fbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802fc5:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fcd:	c9                   	leave
+  802fce:	c3                   	ret
+
+0000000000802fcf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802fcf:	55                   	push   %rbp
+  802fd0:	48 89 e5             	mov    %rsp,%rbp
+  802fd3:	48 83 ec 30          	sub    $0x30,%rsp
+  802fd7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fda:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fdd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fe1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fe4:	48 89 d6             	mov    %rdx,%rsi
+  802fe7:	89 c7                	mov    %eax,%edi
+  802fe9:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+  802ff5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ffc:	78 24                	js     803022 <ftruncate+0x53>
+  802ffe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803002:	8b 00                	mov    (%rax),%eax
+  803004:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803008:	48 89 d6             	mov    %rdx,%rsi
+  80300b:	89 c7                	mov    %eax,%edi
+  80300d:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  803014:	00 00 00 
+  803017:	ff d0                	call   *%rax
+  803019:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80301c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803020:	79 08                	jns    80302a <ftruncate+0x5b>
+    return r;
+  803022:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803025:	e9 92 00 00 00       	jmp    8030bc <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80302a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80302e:	8b 40 08             	mov    0x8(%rax),%eax
+  803031:	83 e0 03             	and    $0x3,%eax
+  803034:	85 c0                	test   %eax,%eax
+  803036:	75 5a                	jne    803092 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803038:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80303f:	00 00 00 
+  803042:	8b 40 04             	mov    0x4(%rax),%eax
+  803045:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80304a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803051:	00 00 00 
+  803054:	48 98                	cltq
+  803056:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80305d:	48 01 d0             	add    %rdx,%rax
+  803060:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803066:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803068:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80306b:	89 c6                	mov    %eax,%esi
+  80306d:	48 b8 b0 55 80 00 00 	movabs $0x8055b0,%rax
+  803074:	00 00 00 
+  803077:	48 89 c7             	mov    %rax,%rdi
+  80307a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307f:	48 b9 1c 02 80 00 00 	movabs $0x80021c,%rcx
+  803086:	00 00 00 
+  803089:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80308b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803090:	eb 2a                	jmp    8030bc <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803092:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803096:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80309a:	48 85 c0             	test   %rax,%rax
+  80309d:	75 07                	jne    8030a6 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80309f:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8030a4:	eb 16                	jmp    8030bc <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030aa:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030b2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030b5:	89 d6                	mov    %edx,%esi
+  8030b7:	48 89 c7             	mov    %rax,%rdi
+  8030ba:	ff d1                	call   *%rcx
+}
+  8030bc:	c9                   	leave
+  8030bd:	c3                   	ret
+
+00000000008030be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030be:	55                   	push   %rbp
+  8030bf:	48 89 e5             	mov    %rsp,%rbp
+  8030c2:	48 83 ec 30          	sub    $0x30,%rsp
+  8030c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030cd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030d4:	48 89 d6             	mov    %rdx,%rsi
+  8030d7:	89 c7                	mov    %eax,%edi
+  8030d9:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+  8030e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030ec:	78 24                	js     803112 <fstat+0x54>
+  8030ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f2:	8b 00                	mov    (%rax),%eax
+  8030f4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030f8:	48 89 d6             	mov    %rdx,%rsi
+  8030fb:	89 c7                	mov    %eax,%edi
+  8030fd:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  803104:	00 00 00 
+  803107:	ff d0                	call   *%rax
+  803109:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80310c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803110:	79 05                	jns    803117 <fstat+0x59>
+    return r;
+  803112:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803115:	eb 5e                	jmp    803175 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803117:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80311b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80311f:	48 85 c0             	test   %rax,%rax
+  803122:	75 07                	jne    80312b <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803124:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803129:	eb 4a                	jmp    803175 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80312b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80312f:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803132:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803136:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80313d:	00 00 00 
+  stat->st_isdir   = 0;
+  803140:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803144:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80314b:	00 00 00 
+  stat->st_dev     = dev;
+  80314e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803152:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803156:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80315d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803161:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803165:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803169:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80316d:	48 89 d6             	mov    %rdx,%rsi
+  803170:	48 89 c7             	mov    %rax,%rdi
+  803173:	ff d1                	call   *%rcx
+}
+  803175:	c9                   	leave
+  803176:	c3                   	ret
+
+0000000000803177 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803177:	55                   	push   %rbp
+  803178:	48 89 e5             	mov    %rsp,%rbp
+  80317b:	48 83 ec 10          	sub    $0x10,%rsp
+  80317f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803183:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803187:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80318b:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803191:	83 f8 20             	cmp    $0x20,%eax
+  803194:	75 07                	jne    80319d <pollwait_key+0x26>
+    return -E_INVAL;
+  803196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80319b:	eb 5f                	jmp    8031fc <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80319d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031a1:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ab:	48 63 d2             	movslq %edx,%rdx
+  8031ae:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031b2:	48 01 c2             	add    %rax,%rdx
+  8031b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b9:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c0:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8031c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031ca:	8b 00                	mov    (%rax),%eax
+  8031cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d0:	48 63 c9             	movslq %ecx,%rcx
+  8031d3:	48 c1 e1 04          	shl    $0x4,%rcx
+  8031d7:	48 01 ca             	add    %rcx,%rdx
+  8031da:	48 83 c2 08          	add    $0x8,%rdx
+  8031de:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8031e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031e4:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031ea:	8d 50 01             	lea    0x1(%rax),%edx
+  8031ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f1:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8031f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031fc:	c9                   	leave
+  8031fd:	c3                   	ret
+
+00000000008031fe <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8031fe:	55                   	push   %rbp
+  8031ff:	48 89 e5             	mov    %rsp,%rbp
+  803202:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803209:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803210:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803216:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80321d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803224:	00 
+  int i, r, ready, ipc = 0;
+  803225:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80322c:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803233:	00 
+  803234:	74 45                	je     80327b <poll+0x7d>
+  803236:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80323d:	ff 
+  80323e:	74 3b                	je     80327b <poll+0x7d>
+    now      = vsys_clock_ns();
+  803240:	48 b8 39 47 80 00 00 	movabs $0x804739,%rax
+  803247:	00 00 00 
+  80324a:	ff d0                	call   *%rax
+  80324c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803250:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803254:	48 f7 d0             	not    %rax
+  803257:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80325e:	73 10                	jae    803270 <poll+0x72>
+  803260:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803264:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80326b:	48 01 d0             	add    %rdx,%rax
+  80326e:	eb 07                	jmp    803277 <poll+0x79>
+  803270:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803277:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80327b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803282:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803289:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803290:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803297:	e9 46 02 00 00       	jmp    8034e2 <poll+0x2e4>
+      fds[i].revents = 0;
+  80329c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80329f:	48 63 d0             	movslq %eax,%rdx
+  8032a2:	48 89 d0             	mov    %rdx,%rax
+  8032a5:	48 01 c0             	add    %rax,%rax
+  8032a8:	48 01 d0             	add    %rdx,%rax
+  8032ab:	48 c1 e0 02          	shl    $0x2,%rax
+  8032af:	48 89 c2             	mov    %rax,%rdx
+  8032b2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032b9:	48 01 d0             	add    %rdx,%rax
+  8032bc:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8032c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032c6:	48 63 d0             	movslq %eax,%rdx
+  8032c9:	48 89 d0             	mov    %rdx,%rax
+  8032cc:	48 01 c0             	add    %rax,%rax
+  8032cf:	48 01 d0             	add    %rdx,%rax
+  8032d2:	48 c1 e0 02          	shl    $0x2,%rax
+  8032d6:	48 89 c2             	mov    %rax,%rdx
+  8032d9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032e0:	48 01 d0             	add    %rdx,%rax
+  8032e3:	8b 00                	mov    (%rax),%eax
+  8032e5:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8032e8:	75 62                	jne    80334c <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8032ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032ed:	48 63 d0             	movslq %eax,%rdx
+  8032f0:	48 89 d0             	mov    %rdx,%rax
+  8032f3:	48 01 c0             	add    %rax,%rax
+  8032f6:	48 01 d0             	add    %rdx,%rax
+  8032f9:	48 c1 e0 02          	shl    $0x2,%rax
+  8032fd:	48 89 c2             	mov    %rax,%rdx
+  803300:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803307:	48 01 d0             	add    %rdx,%rax
+  80330a:	8b 40 04             	mov    0x4(%rax),%eax
+  80330d:	83 e0 01             	and    $0x1,%eax
+  803310:	85 c0                	test   %eax,%eax
+  803312:	0f 84 9b 01 00 00    	je     8034b3 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803318:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80331b:	48 63 d0             	movslq %eax,%rdx
+  80331e:	48 89 d0             	mov    %rdx,%rax
+  803321:	48 01 c0             	add    %rax,%rax
+  803324:	48 01 d0             	add    %rdx,%rax
+  803327:	48 c1 e0 02          	shl    $0x2,%rax
+  80332b:	48 89 c2             	mov    %rax,%rdx
+  80332e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803335:	48 01 c2             	add    %rax,%rdx
+  803338:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80333b:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80333e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803341:	83 c8 04             	or     $0x4,%eax
+  803344:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803347:	e9 67 01 00 00       	jmp    8034b3 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80334c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80334f:	48 63 d0             	movslq %eax,%rdx
+  803352:	48 89 d0             	mov    %rdx,%rax
+  803355:	48 01 c0             	add    %rax,%rax
+  803358:	48 01 d0             	add    %rdx,%rax
+  80335b:	48 c1 e0 02          	shl    $0x2,%rax
+  80335f:	48 89 c2             	mov    %rax,%rdx
+  803362:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803369:	48 01 d0             	add    %rdx,%rax
+  80336c:	8b 00                	mov    (%rax),%eax
+  80336e:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803375:	48 89 d6             	mov    %rdx,%rsi
+  803378:	89 c7                	mov    %eax,%edi
+  80337a:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+  803386:	85 c0                	test   %eax,%eax
+  803388:	78 25                	js     8033af <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80338a:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803391:	8b 00                	mov    (%rax),%eax
+  803393:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80339a:	48 89 d6             	mov    %rdx,%rsi
+  80339d:	89 c7                	mov    %eax,%edi
+  80339f:	48 b8 52 29 80 00 00 	movabs $0x802952,%rax
+  8033a6:	00 00 00 
+  8033a9:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033ab:	85 c0                	test   %eax,%eax
+  8033ad:	79 2c                	jns    8033db <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033b2:	48 63 d0             	movslq %eax,%rdx
+  8033b5:	48 89 d0             	mov    %rdx,%rax
+  8033b8:	48 01 c0             	add    %rax,%rax
+  8033bb:	48 01 d0             	add    %rdx,%rax
+  8033be:	48 c1 e0 02          	shl    $0x2,%rax
+  8033c2:	48 89 c2             	mov    %rax,%rdx
+  8033c5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033cc:	48 01 d0             	add    %rdx,%rax
+  8033cf:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8033d6:	e9 d8 00 00 00       	jmp    8034b3 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8033db:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033e2:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8033e6:	48 85 c0             	test   %rax,%rax
+  8033e9:	74 7d                	je     803468 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8033eb:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033f2:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8033f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033f9:	48 63 d0             	movslq %eax,%rdx
+  8033fc:	48 89 d0             	mov    %rdx,%rax
+  8033ff:	48 01 c0             	add    %rax,%rax
+  803402:	48 01 d0             	add    %rdx,%rax
+  803405:	48 c1 e0 02          	shl    $0x2,%rax
+  803409:	48 89 c2             	mov    %rax,%rdx
+  80340c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803413:	48 01 d0             	add    %rdx,%rax
+  803416:	8b 48 04             	mov    0x4(%rax),%ecx
+  803419:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803420:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803427:	89 ce                	mov    %ecx,%esi
+  803429:	48 89 c7             	mov    %rax,%rdi
+  80342c:	41 ff d0             	call   *%r8
+  80342f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803432:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803436:	79 08                	jns    803440 <poll+0x242>
+          return r;
+  803438:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80343b:	e9 45 01 00 00       	jmp    803585 <poll+0x387>
+        fds[i].revents = r;
+  803440:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803443:	48 63 d0             	movslq %eax,%rdx
+  803446:	48 89 d0             	mov    %rdx,%rax
+  803449:	48 01 c0             	add    %rax,%rax
+  80344c:	48 01 d0             	add    %rdx,%rax
+  80344f:	48 c1 e0 02          	shl    $0x2,%rax
+  803453:	48 89 c2             	mov    %rax,%rdx
+  803456:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80345d:	48 01 c2             	add    %rax,%rdx
+  803460:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803463:	89 42 08             	mov    %eax,0x8(%rdx)
+  803466:	eb 4b                	jmp    8034b3 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803468:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80346b:	48 63 d0             	movslq %eax,%rdx
+  80346e:	48 89 d0             	mov    %rdx,%rax
+  803471:	48 01 c0             	add    %rax,%rax
+  803474:	48 01 d0             	add    %rdx,%rax
+  803477:	48 c1 e0 02          	shl    $0x2,%rax
+  80347b:	48 89 c2             	mov    %rax,%rdx
+  80347e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803485:	48 01 d0             	add    %rdx,%rax
+  803488:	8b 48 04             	mov    0x4(%rax),%ecx
+  80348b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80348e:	48 63 d0             	movslq %eax,%rdx
+  803491:	48 89 d0             	mov    %rdx,%rax
+  803494:	48 01 c0             	add    %rax,%rax
+  803497:	48 01 d0             	add    %rdx,%rax
+  80349a:	48 c1 e0 02          	shl    $0x2,%rax
+  80349e:	48 89 c2             	mov    %rax,%rdx
+  8034a1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034a8:	48 01 d0             	add    %rdx,%rax
+  8034ab:	83 e1 03             	and    $0x3,%ecx
+  8034ae:	89 ca                	mov    %ecx,%edx
+  8034b0:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034b6:	48 63 d0             	movslq %eax,%rdx
+  8034b9:	48 89 d0             	mov    %rdx,%rax
+  8034bc:	48 01 c0             	add    %rax,%rax
+  8034bf:	48 01 d0             	add    %rdx,%rax
+  8034c2:	48 c1 e0 02          	shl    $0x2,%rax
+  8034c6:	48 89 c2             	mov    %rax,%rdx
+  8034c9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034d0:	48 01 d0             	add    %rdx,%rax
+  8034d3:	8b 40 08             	mov    0x8(%rax),%eax
+  8034d6:	85 c0                	test   %eax,%eax
+  8034d8:	74 04                	je     8034de <poll+0x2e0>
+        ready++;
+  8034da:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034de:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8034e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034e5:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8034eb:	0f 8c ab fd ff ff    	jl     80329c <poll+0x9e>
+    }
+    if (ready)
+  8034f1:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8034f5:	74 08                	je     8034ff <poll+0x301>
+      return ready;
+  8034f7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8034fa:	e9 86 00 00 00       	jmp    803585 <poll+0x387>
+
+    if (deadline) {
+  8034ff:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803504:	74 30                	je     803536 <poll+0x338>
+      now     = vsys_clock_ns();
+  803506:	48 b8 39 47 80 00 00 	movabs $0x804739,%rax
+  80350d:	00 00 00 
+  803510:	ff d0                	call   *%rax
+  803512:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803516:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80351a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80351e:	73 0a                	jae    80352a <poll+0x32c>
+  803520:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803524:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803528:	eb 05                	jmp    80352f <poll+0x331>
+  80352a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352f:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803536:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803539:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80353c:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803543:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80354a:	48 89 c7             	mov    %rax,%rdi
+  80354d:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+  803559:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80355c:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803560:	75 07                	jne    803569 <poll+0x36b>
+      return 0;
+  803562:	b8 00 00 00 00       	mov    $0x0,%eax
+  803567:	eb 1c                	jmp    803585 <poll+0x387>
+    if (r < 0)
+  803569:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80356d:	79 05                	jns    803574 <poll+0x376>
+      return r;
+  80356f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803572:	eb 11                	jmp    803585 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803574:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803577:	c1 f8 02             	sar    $0x2,%eax
+  80357a:	83 e0 01             	and    $0x1,%eax
+  80357d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803580:	e9 f6 fc ff ff       	jmp    80327b <poll+0x7d>
+  }
+}
+  803585:	c9                   	leave
+  803586:	c3                   	ret
+
+0000000000803587 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803587:	55                   	push   %rbp
+  803588:	48 89 e5             	mov    %rsp,%rbp
+  80358b:	48 83 ec 20          	sub    $0x20,%rsp
+  80358f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803593:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80359b:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a0:	48 89 c7             	mov    %rax,%rdi
+  8035a3:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  8035aa:	00 00 00 
+  8035ad:	ff d0                	call   *%rax
+  8035af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035b6:	79 05                	jns    8035bd <stat+0x36>
+    return fd;
+  8035b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035bb:	eb 2f                	jmp    8035ec <stat+0x65>
+  r = fstat(fd, stat);
+  8035bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c4:	48 89 d6             	mov    %rdx,%rsi
+  8035c7:	89 c7                	mov    %eax,%edi
+  8035c9:	48 b8 be 30 80 00 00 	movabs $0x8030be,%rax
+  8035d0:	00 00 00 
+  8035d3:	ff d0                	call   *%rax
+  8035d5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8035d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035db:	89 c7                	mov    %eax,%edi
+  8035dd:	48 b8 26 2a 80 00 00 	movabs $0x802a26,%rax
+  8035e4:	00 00 00 
+  8035e7:	ff d0                	call   *%rax
+  return r;
+  8035e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035ec:	c9                   	leave
+  8035ed:	c3                   	ret
+
+00000000008035ee <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8035ee:	55                   	push   %rbp
+  8035ef:	48 89 e5             	mov    %rsp,%rbp
+  8035f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8035f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8035fd:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803604:	00 00 00 
+  803607:	8b 00                	mov    (%rax),%eax
+  803609:	85 c0                	test   %eax,%eax
+  80360b:	75 1d                	jne    80362a <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80360d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803612:	48 b8 6e 4e 80 00 00 	movabs $0x804e6e,%rax
+  803619:	00 00 00 
+  80361c:	ff d0                	call   *%rax
+  80361e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803625:	00 00 00 
+  803628:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80362a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803631:	00 00 00 
+  803634:	8b 00                	mov    (%rax),%eax
+  803636:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803639:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80363e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803645:	00 00 00 
+  803648:	89 c7                	mov    %eax,%edi
+  80364a:	48 b8 c1 4d 80 00 00 	movabs $0x804dc1,%rax
+  803651:	00 00 00 
+  803654:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803656:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80365a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80365f:	48 89 c6             	mov    %rax,%rsi
+  803662:	bf 00 00 00 00       	mov    $0x0,%edi
+  803667:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+}
+  803673:	c9                   	leave
+  803674:	c3                   	ret
+
+0000000000803675 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803675:	55                   	push   %rbp
+  803676:	48 89 e5             	mov    %rsp,%rbp
+  803679:	48 83 ec 20          	sub    $0x20,%rsp
+  80367d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803681:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803684:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803688:	48 89 c7             	mov    %rax,%rdi
+  80368b:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+  803697:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80369c:	7e 0a                	jle    8036a8 <open+0x33>
+    return -E_BAD_PATH;
+  80369e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036a3:	e9 a8 00 00 00       	jmp    803750 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036a8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036ac:	48 89 c7             	mov    %rax,%rdi
+  8036af:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+  8036bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036c2:	79 08                	jns    8036cc <open+0x57>
+    return r;
+  8036c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c7:	e9 84 00 00 00       	jmp    803750 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8036cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036d0:	48 89 c6             	mov    %rax,%rsi
+  8036d3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8036da:	00 00 00 
+  8036dd:	48 89 c7             	mov    %rax,%rdi
+  8036e0:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  8036e7:	00 00 00 
+  8036ea:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8036ec:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8036f3:	00 00 00 
+  8036f6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036f9:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8036ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803703:	48 89 c6             	mov    %rax,%rsi
+  803706:	bf 01 00 00 00       	mov    $0x1,%edi
+  80370b:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803712:	00 00 00 
+  803715:	ff d0                	call   *%rax
+  803717:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80371a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80371e:	79 1d                	jns    80373d <open+0xc8>
+    fd_close(fd, 0);
+  803720:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803724:	be 00 00 00 00       	mov    $0x0,%esi
+  803729:	48 89 c7             	mov    %rax,%rdi
+  80372c:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+    return r;
+  803738:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80373b:	eb 13                	jmp    803750 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80373d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803741:	48 89 c7             	mov    %rax,%rdi
+  803744:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  80374b:	00 00 00 
+  80374e:	ff d0                	call   *%rax
+}
+  803750:	c9                   	leave
+  803751:	c3                   	ret
+
+0000000000803752 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803752:	55                   	push   %rbp
+  803753:	48 89 e5             	mov    %rsp,%rbp
+  803756:	48 83 ec 10          	sub    $0x10,%rsp
+  80375a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80375e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803762:	8b 40 0c             	mov    0xc(%rax),%eax
+  803765:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80376c:	00 00 00 
+  80376f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803771:	be 00 00 00 00       	mov    $0x0,%esi
+  803776:	bf 06 00 00 00       	mov    $0x6,%edi
+  80377b:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+}
+  803787:	c9                   	leave
+  803788:	c3                   	ret
+
+0000000000803789 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803789:	55                   	push   %rbp
+  80378a:	48 89 e5             	mov    %rsp,%rbp
+  80378d:	48 83 ec 30          	sub    $0x30,%rsp
+  803791:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803795:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803799:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80379d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8037a2:	74 07                	je     8037ab <devfile_read+0x22>
+  8037a4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037a9:	75 0a                	jne    8037b5 <devfile_read+0x2c>
+  return E_INVAL;
+  8037ab:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037b0:	e9 b4 00 00 00       	jmp    803869 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037b5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037bc:	00 
+  while (n) {
+  8037bd:	e9 98 00 00 00       	jmp    80385a <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037c9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037d0:	00 00 00 
+  8037d3:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8037d5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037dc:	00 00 00 
+  8037df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037e3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8037e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037f1:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+  8037fd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803800:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803804:	7f 13                	jg     803819 <devfile_read+0x90>
+      return res ? res : res0;
+  803806:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80380a:	74 07                	je     803813 <devfile_read+0x8a>
+  80380c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80380f:	48 98                	cltq
+  803811:	eb 56                	jmp    803869 <devfile_read+0xe0>
+  803813:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803817:	eb 50                	jmp    803869 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803819:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80381c:	48 63 d0             	movslq %eax,%rdx
+  80381f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803823:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80382a:	00 00 00 
+  80382d:	48 89 ce             	mov    %rcx,%rsi
+  803830:	48 89 c7             	mov    %rax,%rdi
+  803833:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+
+    buf += res;
+  80383f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803842:	48 98                	cltq
+  803844:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803848:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384b:	48 98                	cltq
+  80384d:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803851:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803854:	48 98                	cltq
+  803856:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80385a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80385f:	0f 85 5d ff ff ff    	jne    8037c2 <devfile_read+0x39>
+  }
+
+  return res0;
+  803865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803869:	c9                   	leave
+  80386a:	c3                   	ret
+
+000000000080386b <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80386b:	55                   	push   %rbp
+  80386c:	48 89 e5             	mov    %rsp,%rbp
+  80386f:	48 83 ec 50          	sub    $0x50,%rsp
+  803873:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803877:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80387b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80387f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803884:	74 07                	je     80388d <devfile_write+0x22>
+  803886:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80388b:	75 0a                	jne    803897 <devfile_write+0x2c>
+  return E_INVAL;
+  80388d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803892:	e9 c9 00 00 00       	jmp    803960 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803897:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80389e:	00 
+
+  while (n) {
+  80389f:	e9 ad 00 00 00       	jmp    803951 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8038a4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038ac:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038b3:	00 
+  8038b4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038bc:	48 39 c2             	cmp    %rax,%rdx
+  8038bf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038c3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8038c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038cf:	48 89 c6             	mov    %rax,%rsi
+  8038d2:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8038d9:	00 00 00 
+  8038dc:	48 89 c7             	mov    %rax,%rdi
+  8038df:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  8038e6:	00 00 00 
+  8038e9:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ef:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f2:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8038f9:	00 00 00 
+  8038fc:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8038fe:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803905:	00 00 00 
+  803908:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80390c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803910:	be 00 00 00 00       	mov    $0x0,%esi
+  803915:	bf 04 00 00 00       	mov    $0x4,%edi
+  80391a:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+  803926:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803929:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80392d:	79 07                	jns    803936 <devfile_write+0xcb>
+      return res;
+  80392f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803932:	48 98                	cltq
+  803934:	eb 2a                	jmp    803960 <devfile_write+0xf5>
+
+    buf += res;
+  803936:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803939:	48 98                	cltq
+  80393b:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80393f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803942:	48 98                	cltq
+  803944:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803948:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80394b:	48 98                	cltq
+  80394d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803951:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803956:	0f 85 48 ff ff ff    	jne    8038a4 <devfile_write+0x39>
+  }
+
+  return res0;
+  80395c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+
+0000000000803962 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803962:	55                   	push   %rbp
+  803963:	48 89 e5             	mov    %rsp,%rbp
+  803966:	48 83 ec 20          	sub    $0x20,%rsp
+  80396a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80396e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803972:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803976:	8b 40 0c             	mov    0xc(%rax),%eax
+  803979:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803980:	00 00 00 
+  803983:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803985:	be 00 00 00 00       	mov    $0x0,%esi
+  80398a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80398f:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803996:	00 00 00 
+  803999:	ff d0                	call   *%rax
+  80399b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80399e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039a2:	79 05                	jns    8039a9 <devfile_stat+0x47>
+    return r;
+  8039a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a7:	eb 59                	jmp    803a02 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ad:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039b4:	00 00 00 
+  8039b7:	48 89 d6             	mov    %rdx,%rsi
+  8039ba:	48 89 c7             	mov    %rax,%rdi
+  8039bd:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8039c9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039d0:	00 00 00 
+  8039d3:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039dd:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039e3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039ea:	00 00 00 
+  8039ed:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f7:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8039fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a02:	c9                   	leave
+  803a03:	c3                   	ret
+
+0000000000803a04 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a04:	55                   	push   %rbp
+  803a05:	48 89 e5             	mov    %rsp,%rbp
+  803a08:	48 83 ec 10          	sub    $0x10,%rsp
+  803a0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a10:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a17:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a1a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a21:	00 00 00 
+  803a24:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a26:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a2d:	00 00 00 
+  803a30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a33:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a36:	be 00 00 00 00       	mov    $0x0,%esi
+  803a3b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a40:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803a47:	00 00 00 
+  803a4a:	ff d0                	call   *%rax
+}
+  803a4c:	c9                   	leave
+  803a4d:	c3                   	ret
+
+0000000000803a4e <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a4e:	55                   	push   %rbp
+  803a4f:	48 89 e5             	mov    %rsp,%rbp
+  803a52:	48 83 ec 18          	sub    $0x18,%rsp
+  803a56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a5a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a5d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803a61:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a64:	83 e0 03             	and    $0x3,%eax
+}
+  803a67:	c9                   	leave
+  803a68:	c3                   	ret
+
+0000000000803a69 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803a69:	55                   	push   %rbp
+  803a6a:	48 89 e5             	mov    %rsp,%rbp
+  803a6d:	48 83 ec 10          	sub    $0x10,%rsp
+  803a71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803a75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a79:	48 89 c7             	mov    %rax,%rdi
+  803a7c:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  803a83:	00 00 00 
+  803a86:	ff d0                	call   *%rax
+  803a88:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a8d:	7e 07                	jle    803a96 <remove+0x2d>
+    return -E_BAD_PATH;
+  803a8f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a94:	eb 36                	jmp    803acc <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a9a:	48 89 c6             	mov    %rax,%rsi
+  803a9d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803aa4:	00 00 00 
+  803aa7:	48 89 c7             	mov    %rax,%rdi
+  803aaa:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  803ab1:	00 00 00 
+  803ab4:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  803abb:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ac0:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+}
+  803acc:	c9                   	leave
+  803acd:	c3                   	ret
+
+0000000000803ace <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803ace:	55                   	push   %rbp
+  803acf:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803ad2:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad7:	bf 08 00 00 00       	mov    $0x8,%edi
+  803adc:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803ae3:	00 00 00 
+  803ae6:	ff d0                	call   *%rax
+}
+  803ae8:	5d                   	pop    %rbp
+  803ae9:	c3                   	ret
+
+0000000000803aea <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803aea:	55                   	push   %rbp
+  803aeb:	48 89 e5             	mov    %rsp,%rbp
+  803aee:	48 83 ec 20          	sub    $0x20,%rsp
+  803af2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803af6:	be 00 00 00 00       	mov    $0x0,%esi
+  803afb:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b00:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+  803b0c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b0f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b13:	79 05                	jns    803b1a <fs_stats+0x30>
+    return r;
+  803b15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b18:	eb 2a                	jmp    803b44 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b1e:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b23:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b2a:	00 00 00 
+  803b2d:	48 89 ce             	mov    %rcx,%rsi
+  803b30:	48 89 c7             	mov    %rax,%rdi
+  803b33:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  803b3a:	00 00 00 
+  803b3d:	ff d0                	call   *%rax
+  return 0;
+  803b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b44:	c9                   	leave
+  803b45:	c3                   	ret
+
+0000000000803b46 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b46:	55                   	push   %rbp
+  803b47:	48 89 e5             	mov    %rsp,%rbp
+  803b4a:	48 83 ec 10          	sub    $0x10,%rsp
+  803b4e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b51:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b58:	00 00 00 
+  803b5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b5e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803b60:	be 00 00 00 00       	mov    $0x0,%esi
+  803b65:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b6a:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+}
+  803b76:	c9                   	leave
+  803b77:	c3                   	ret
+
+0000000000803b78 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803b78:	55                   	push   %rbp
+  803b79:	48 89 e5             	mov    %rsp,%rbp
+  803b7c:	48 83 ec 10          	sub    $0x10,%rsp
+  803b80:	89 f8                	mov    %edi,%eax
+  803b82:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803b85:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803b89:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b90:	00 00 00 
+  803b93:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803b95:	be 00 00 00 00       	mov    $0x0,%esi
+  803b9a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803b9f:	48 b8 ee 35 80 00 00 	movabs $0x8035ee,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+}
+  803bab:	c9                   	leave
+  803bac:	c3                   	ret
+
+0000000000803bad <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803bad:	55                   	push   %rbp
+  803bae:	48 89 e5             	mov    %rsp,%rbp
+  803bb1:	48 83 ec 10          	sub    $0x10,%rsp
+  803bb5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bbd:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803bc2:	48 89 c7             	mov    %rax,%rdi
+  803bc5:	48 b8 d3 3b 80 00 00 	movabs $0x803bd3,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+}
+  803bd1:	c9                   	leave
+  803bd2:	c3                   	ret
+
+0000000000803bd3 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803bd3:	55                   	push   %rbp
+  803bd4:	48 89 e5             	mov    %rsp,%rbp
+  803bd7:	48 83 ec 50          	sub    $0x50,%rsp
+  803bdb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803bdf:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803be3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803bea:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803beb:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803bf0:	74 0a                	je     803bfc <pipe_size+0x29>
+  803bf2:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803bf9:	00 
+  803bfa:	76 0a                	jbe    803c06 <pipe_size+0x33>
+    return -E_INVAL;
+  803bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c01:	e9 cc 02 00 00       	jmp    803ed2 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c06:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c0a:	48 89 c7             	mov    %rax,%rdi
+  803c0d:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  803c14:	00 00 00 
+  803c17:	ff d0                	call   *%rax
+  803c19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c20:	0f 88 a8 02 00 00    	js     803ece <pipe_size+0x2fb>
+  803c26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c2a:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c2f:	48 89 c6             	mov    %rax,%rsi
+  803c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c37:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+  803c43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c4a:	0f 88 7e 02 00 00    	js     803ece <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c50:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c54:	48 89 c7             	mov    %rax,%rdi
+  803c57:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+  803c63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6a:	0f 88 43 02 00 00    	js     803eb3 <pipe_size+0x2e0>
+  803c70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c74:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c79:	48 89 c6             	mov    %rax,%rsi
+  803c7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c81:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  803c88:	00 00 00 
+  803c8b:	ff d0                	call   *%rax
+  803c8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c94:	0f 88 19 02 00 00    	js     803eb3 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803c9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c9e:	48 89 c7             	mov    %rax,%rdi
+  803ca1:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  803ca8:	00 00 00 
+  803cab:	ff d0                	call   *%rax
+  803cad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cb1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cb8:	00 
+  803cb9:	e9 a2 00 00 00       	jmp    803d60 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cc2:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cc6:	48 89 c2             	mov    %rax,%rdx
+  803cc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ccd:	48 01 d0             	add    %rdx,%rax
+  803cd0:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cd5:	48 89 c6             	mov    %rax,%rsi
+  803cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cdd:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  803ce4:	00 00 00 
+  803ce7:	ff d0                	call   *%rax
+  803ce9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cf0:	0f 88 37 01 00 00    	js     803e2d <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803cf6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfa:	48 89 c7             	mov    %rax,%rdi
+  803cfd:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  803d04:	00 00 00 
+  803d07:	ff d0                	call   *%rax
+  803d09:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d0d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d11:	48 01 c2             	add    %rax,%rdx
+  803d14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d18:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d1c:	48 89 c1             	mov    %rax,%rcx
+  803d1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d23:	48 01 c8             	add    %rcx,%rax
+  803d26:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d2c:	48 89 d1             	mov    %rdx,%rcx
+  803d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d34:	48 89 c6             	mov    %rax,%rsi
+  803d37:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3c:	48 b8 f2 1f 80 00 00 	movabs $0x801ff2,%rax
+  803d43:	00 00 00 
+  803d46:	ff d0                	call   *%rax
+  803d48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d4f:	79 0a                	jns    803d5b <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d51:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d56:	e9 d3 00 00 00       	jmp    803e2e <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d5b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803d60:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803d67:	00 
+  803d68:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803d6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d70:	48 01 d0             	add    %rdx,%rax
+  803d73:	48 83 c0 1f          	add    $0x1f,%rax
+  803d77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803d7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d84:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803d88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d8c:	48 29 d0             	sub    %rdx,%rax
+  803d8f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d93:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803d97:	0f 82 21 ff ff ff    	jb     803cbe <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803d9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803da5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803dad:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803db1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803db5:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dbc:	00 00 00 
+  803dbf:	8b 12                	mov    (%rdx),%edx
+  803dc1:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803dc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dc7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803dce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dd2:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dd9:	00 00 00 
+  803ddc:	8b 12                	mov    (%rdx),%edx
+  803dde:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803de0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803de4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803deb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803def:	48 89 c7             	mov    %rax,%rdi
+  803df2:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+  803dfe:	89 c2                	mov    %eax,%edx
+  803e00:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e04:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e0a:	48 89 c7             	mov    %rax,%rdi
+  803e0d:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  803e14:	00 00 00 
+  803e17:	ff d0                	call   *%rax
+  803e19:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e1d:	48 83 c2 04          	add    $0x4,%rdx
+  803e21:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e28:	e9 a5 00 00 00       	jmp    803ed2 <pipe_size+0x2ff>
+      goto err2;
+  803e2d:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e2e:	eb 58                	jmp    803e88 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e34:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e38:	48 89 c2             	mov    %rax,%rdx
+  803e3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e3f:	48 01 d0             	add    %rdx,%rax
+  803e42:	48 89 c6             	mov    %rax,%rsi
+  803e45:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4a:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  803e51:	00 00 00 
+  803e54:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e56:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e5a:	48 89 c7             	mov    %rax,%rdi
+  803e5d:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  803e64:	00 00 00 
+  803e67:	ff d0                	call   *%rax
+  803e69:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e6d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e71:	48 01 d0             	add    %rdx,%rax
+  803e74:	48 89 c6             	mov    %rax,%rsi
+  803e77:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7c:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  803e83:	00 00 00 
+  803e86:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e8c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e90:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803e94:	48 85 c0             	test   %rax,%rax
+  803e97:	75 97                	jne    803e30 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803e99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e9d:	48 89 c6             	mov    %rax,%rsi
+  803ea0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea5:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  803eac:	00 00 00 
+  803eaf:	ff d0                	call   *%rax
+  803eb1:	eb 01                	jmp    803eb4 <pipe_size+0x2e1>
+    goto err1;
+  803eb3:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803eb4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eb8:	48 89 c6             	mov    %rax,%rsi
+  803ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec0:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+  803ecc:	eb 01                	jmp    803ecf <pipe_size+0x2fc>
+    goto err;
+  803ece:	90                   	nop
+err:
+  return r;
+  803ecf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ed2:	c9                   	leave
+  803ed3:	c3                   	ret
+
+0000000000803ed4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ed4:	55                   	push   %rbp
+  803ed5:	48 89 e5             	mov    %rsp,%rbp
+  803ed8:	53                   	push   %rbx
+  803ed9:	48 83 ec 28          	sub    $0x28,%rsp
+  803edd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ee1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803ee5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803eec:	00 00 00 
+  803eef:	8b 40 04             	mov    0x4(%rax),%eax
+  803ef2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ef7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803efe:	00 00 00 
+  803f01:	48 98                	cltq
+  803f03:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f0a:	48 01 d0             	add    %rdx,%rax
+  803f0d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f13:	8b 00                	mov    (%rax),%eax
+  803f15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f1c:	48 89 c7             	mov    %rax,%rdi
+  803f1f:	48 b8 df 4e 80 00 00 	movabs $0x804edf,%rax
+  803f26:	00 00 00 
+  803f29:	ff d0                	call   *%rax
+  803f2b:	89 c3                	mov    %eax,%ebx
+  803f2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f31:	48 89 c7             	mov    %rax,%rdi
+  803f34:	48 b8 df 4e 80 00 00 	movabs $0x804edf,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+  803f40:	39 c3                	cmp    %eax,%ebx
+  803f42:	0f 94 c0             	sete   %al
+  803f45:	0f b6 c0             	movzbl %al,%eax
+  803f48:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f4b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f52:	00 00 00 
+  803f55:	8b 40 04             	mov    0x4(%rax),%eax
+  803f58:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f5d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f64:	00 00 00 
+  803f67:	48 98                	cltq
+  803f69:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f70:	48 01 d0             	add    %rdx,%rax
+  803f73:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f79:	8b 00                	mov    (%rax),%eax
+  803f7b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803f7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f81:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f84:	75 05                	jne    803f8b <_pipeisclosed+0xb7>
+      return ret;
+  803f86:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f89:	eb 68                	jmp    803ff3 <_pipeisclosed+0x11f>
+    if (n != nn)
+  803f8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f8e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f91:	0f 84 4e ff ff ff    	je     803ee5 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803f97:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f9e:	00 00 00 
+  803fa1:	8b 40 04             	mov    0x4(%rax),%eax
+  803fa4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fa9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fb0:	00 00 00 
+  803fb3:	48 98                	cltq
+  803fb5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fbc:	48 01 d0             	add    %rdx,%rax
+  803fbf:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fc5:	8b 10                	mov    (%rax),%edx
+  803fc7:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803fca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fcd:	89 c6                	mov    %eax,%esi
+  803fcf:	48 b8 e0 55 80 00 00 	movabs $0x8055e0,%rax
+  803fd6:	00 00 00 
+  803fd9:	48 89 c7             	mov    %rax,%rdi
+  803fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe1:	49 b8 1c 02 80 00 00 	movabs $0x80021c,%r8
+  803fe8:	00 00 00 
+  803feb:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803fee:	e9 f2 fe ff ff       	jmp    803ee5 <_pipeisclosed+0x11>
+  }
+}
+  803ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ff7:	c9                   	leave
+  803ff8:	c3                   	ret
+
+0000000000803ff9 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  803ff9:	55                   	push   %rbp
+  803ffa:	48 89 e5             	mov    %rsp,%rbp
+  803ffd:	48 83 ec 30          	sub    $0x30,%rsp
+  804001:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804004:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804008:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80400b:	48 89 d6             	mov    %rdx,%rsi
+  80400e:	89 c7                	mov    %eax,%edi
+  804010:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+  80401c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80401f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804023:	79 05                	jns    80402a <pipeisclosed+0x31>
+    return r;
+  804025:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804028:	eb 31                	jmp    80405b <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80402a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80402e:	48 89 c7             	mov    %rax,%rdi
+  804031:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  804038:	00 00 00 
+  80403b:	ff d0                	call   *%rax
+  80403d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804041:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804045:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804049:	48 89 d6             	mov    %rdx,%rsi
+  80404c:	48 89 c7             	mov    %rax,%rdi
+  80404f:	48 b8 d4 3e 80 00 00 	movabs $0x803ed4,%rax
+  804056:	00 00 00 
+  804059:	ff d0                	call   *%rax
+}
+  80405b:	c9                   	leave
+  80405c:	c3                   	ret
+
+000000000080405d <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80405d:	55                   	push   %rbp
+  80405e:	48 89 e5             	mov    %rsp,%rbp
+  804061:	48 83 ec 10          	sub    $0x10,%rsp
+  804065:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804069:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80406d:	8b 40 18             	mov    0x18(%rax),%eax
+  804070:	8d 50 01             	lea    0x1(%rax),%edx
+  804073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804077:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80407a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407e:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804081:	85 c0                	test   %eax,%eax
+  804083:	74 27                	je     8040ac <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804085:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804089:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804090:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804094:	48 83 c0 18          	add    $0x18,%rax
+  804098:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80409d:	48 89 c7             	mov    %rax,%rdi
+  8040a0:	48 b8 95 23 80 00 00 	movabs $0x802395,%rax
+  8040a7:	00 00 00 
+  8040aa:	ff d0                	call   *%rax
+  }
+}
+  8040ac:	90                   	nop
+  8040ad:	c9                   	leave
+  8040ae:	c3                   	ret
+
+00000000008040af <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040af:	55                   	push   %rbp
+  8040b0:	48 89 e5             	mov    %rsp,%rbp
+  8040b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8040b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040bb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8040be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c2:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8040c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040cd:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8040d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040d4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8040db:	89 c6                	mov    %eax,%esi
+  8040dd:	48 89 cf             	mov    %rcx,%rdi
+  8040e0:	48 b8 46 23 80 00 00 	movabs $0x802346,%rax
+  8040e7:	00 00 00 
+  8040ea:	ff d0                	call   *%rax
+}
+  8040ec:	90                   	nop
+  8040ed:	c9                   	leave
+  8040ee:	c3                   	ret
+
+00000000008040ef <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040ef:	55                   	push   %rbp
+  8040f0:	48 89 e5             	mov    %rsp,%rbp
+  8040f3:	48 83 ec 70          	sub    $0x70,%rsp
+  8040f7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8040fb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8040ff:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804103:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804107:	48 89 c7             	mov    %rax,%rdi
+  80410a:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+  804116:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80411a:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80411f:	75 0a                	jne    80412b <devpipe_read+0x3c>
+    return 0;
+  804121:	b8 00 00 00 00       	mov    $0x0,%eax
+  804126:	e9 63 01 00 00       	jmp    80428e <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80412b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80412f:	8b 40 18             	mov    0x18(%rax),%eax
+  804132:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804135:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804139:	48 8b 10             	mov    (%rax),%rdx
+  80413c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804140:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804144:	48 39 c2             	cmp    %rax,%rdx
+  804147:	75 42                	jne    80418b <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804149:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80414d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804151:	48 89 d6             	mov    %rdx,%rsi
+  804154:	48 89 c7             	mov    %rax,%rdi
+  804157:	48 b8 d4 3e 80 00 00 	movabs $0x803ed4,%rax
+  80415e:	00 00 00 
+  804161:	ff d0                	call   *%rax
+  804163:	85 c0                	test   %eax,%eax
+  804165:	74 0a                	je     804171 <devpipe_read+0x82>
+      return 0;
+  804167:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416c:	e9 1d 01 00 00       	jmp    80428e <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804171:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804174:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804178:	89 d6                	mov    %edx,%esi
+  80417a:	48 89 c7             	mov    %rax,%rdi
+  80417d:	48 b8 af 40 80 00 00 	movabs $0x8040af,%rax
+  804184:	00 00 00 
+  804187:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804189:	eb a0                	jmp    80412b <devpipe_read+0x3c>
+      break;
+  80418b:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80418c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804190:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804194:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804198:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80419c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a8:	48 8b 00             	mov    (%rax),%rax
+  8041ab:	48 29 c2             	sub    %rax,%rdx
+  8041ae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041ba:	48 39 c2             	cmp    %rax,%rdx
+  8041bd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041c1:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8041c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041c9:	48 8b 00             	mov    (%rax),%rax
+  8041cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041d0:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8041d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041d9:	48 f7 f1             	div    %rcx
+  8041dc:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8041e0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ec:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041f0:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8041f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041f8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804200:	48 39 c2             	cmp    %rax,%rdx
+  804203:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804207:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80420b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804213:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804217:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80421b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80421f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804223:	48 89 ce             	mov    %rcx,%rsi
+  804226:	48 89 c7             	mov    %rax,%rdi
+  804229:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  804230:	00 00 00 
+  804233:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804235:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804239:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80423d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804241:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804245:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804249:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80424d:	48 01 d1             	add    %rdx,%rcx
+  804250:	48 89 c2             	mov    %rax,%rdx
+  804253:	48 89 cf             	mov    %rcx,%rdi
+  804256:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  80425d:	00 00 00 
+  804260:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804262:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804266:	48 8b 10             	mov    (%rax),%rdx
+  804269:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80426d:	48 01 c2             	add    %rax,%rdx
+  804270:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804274:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804277:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80427b:	48 89 c7             	mov    %rax,%rdi
+  80427e:	48 b8 5d 40 80 00 00 	movabs $0x80405d,%rax
+  804285:	00 00 00 
+  804288:	ff d0                	call   *%rax
+  return n;
+  80428a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80428e:	c9                   	leave
+  80428f:	c3                   	ret
+
+0000000000804290 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804290:	55                   	push   %rbp
+  804291:	48 89 e5             	mov    %rsp,%rbp
+  804294:	48 83 ec 70          	sub    $0x70,%rsp
+  804298:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80429c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042a0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042a4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042a8:	48 89 c7             	mov    %rax,%rdi
+  8042ab:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8042b2:	00 00 00 
+  8042b5:	ff d0                	call   *%rax
+  8042b7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8042c3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8042ca:	00 
+  8042cb:	e9 b8 01 00 00       	jmp    804488 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8042d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d4:	8b 40 18             	mov    0x18(%rax),%eax
+  8042d7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8042da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042de:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8042e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e6:	48 8b 00             	mov    (%rax),%rax
+  8042e9:	48 29 c2             	sub    %rax,%rdx
+  8042ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042f4:	48 39 c2             	cmp    %rax,%rdx
+  8042f7:	75 4d                	jne    804346 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8042f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804301:	48 89 d6             	mov    %rdx,%rsi
+  804304:	48 89 c7             	mov    %rax,%rdi
+  804307:	48 b8 d4 3e 80 00 00 	movabs $0x803ed4,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+  804313:	85 c0                	test   %eax,%eax
+  804315:	74 0a                	je     804321 <devpipe_write+0x91>
+        return 0;
+  804317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431c:	e9 79 01 00 00       	jmp    80449a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804321:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804328:	89 d6                	mov    %edx,%esi
+  80432a:	48 89 c7             	mov    %rax,%rdi
+  80432d:	48 b8 af 40 80 00 00 	movabs $0x8040af,%rax
+  804334:	00 00 00 
+  804337:	ff d0                	call   *%rax
+      m = 0;
+  804339:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804340:	00 
+      continue;
+  804341:	e9 3a 01 00 00       	jmp    804480 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804346:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80434a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80434e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804352:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804356:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80435a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435e:	48 8b 08             	mov    (%rax),%rcx
+  804361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804365:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804369:	48 29 c1             	sub    %rax,%rcx
+  80436c:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804370:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804374:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804378:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80437c:	48 39 c2             	cmp    %rax,%rdx
+  80437f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804383:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804387:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80438b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80438f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804393:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80439c:	48 f7 f1             	div    %rcx
+  80439f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8043a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043b3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043b7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043bb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043bf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8043c3:	48 39 c2             	cmp    %rax,%rdx
+  8043c6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043ca:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8043ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043d2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8043d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043da:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8043de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043e2:	48 01 d1             	add    %rdx,%rcx
+  8043e5:	48 89 c2             	mov    %rax,%rdx
+  8043e8:	48 89 cf             	mov    %rcx,%rdi
+  8043eb:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  8043f2:	00 00 00 
+  8043f5:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8043f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043fb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043ff:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804403:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804407:	73 4d                	jae    804456 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804409:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80440d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804411:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804415:	48 29 c2             	sub    %rax,%rdx
+  804418:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441c:	48 01 c2             	add    %rax,%rdx
+  80441f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804423:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804427:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80442b:	48 89 c1             	mov    %rax,%rcx
+  80442e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804432:	48 01 c1             	add    %rax,%rcx
+  804435:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804439:	48 01 c1             	add    %rax,%rcx
+  80443c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804440:	48 83 c0 20          	add    $0x20,%rax
+  804444:	48 89 ce             	mov    %rcx,%rsi
+  804447:	48 89 c7             	mov    %rax,%rdi
+  80444a:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  804451:	00 00 00 
+  804454:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804456:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80445a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80445e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804462:	48 01 c2             	add    %rax,%rdx
+  804465:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804469:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80446d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804471:	48 89 c7             	mov    %rax,%rdi
+  804474:	48 b8 5d 40 80 00 00 	movabs $0x80405d,%rax
+  80447b:	00 00 00 
+  80447e:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804480:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804484:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80448c:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804490:	0f 82 3a fe ff ff    	jb     8042d0 <devpipe_write+0x40>
+  }
+
+  return i;
+  804496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80449a:	c9                   	leave
+  80449b:	c3                   	ret
+
+000000000080449c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80449c:	55                   	push   %rbp
+  80449d:	48 89 e5             	mov    %rsp,%rbp
+  8044a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8044a4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044a8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044b3:	48 89 c7             	mov    %rax,%rdi
+  8044b6:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8044bd:	00 00 00 
+  8044c0:	ff d0                	call   *%rax
+  8044c2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8044c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8044cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d1:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8044d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044d9:	48 89 d6             	mov    %rdx,%rsi
+  8044dc:	48 89 c7             	mov    %rax,%rdi
+  8044df:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  8044e6:	00 00 00 
+  8044e9:	ff d0                	call   *%rax
+  8044eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f2:	79 08                	jns    8044fc <devpipe_poll+0x60>
+    return r;
+  8044f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f7:	e9 85 00 00 00       	jmp    804581 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8044fc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8044ff:	83 e0 01             	and    $0x1,%eax
+  804502:	85 c0                	test   %eax,%eax
+  804504:	74 18                	je     80451e <devpipe_poll+0x82>
+  804506:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80450a:	48 8b 10             	mov    (%rax),%rdx
+  80450d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804511:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804515:	48 39 c2             	cmp    %rax,%rdx
+  804518:	74 04                	je     80451e <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80451a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80451e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804521:	83 e0 02             	and    $0x2,%eax
+  804524:	85 c0                	test   %eax,%eax
+  804526:	74 23                	je     80454b <devpipe_poll+0xaf>
+  804528:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80452c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804530:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804534:	48 8b 00             	mov    (%rax),%rax
+  804537:	48 29 c2             	sub    %rax,%rdx
+  80453a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804542:	48 39 c2             	cmp    %rax,%rdx
+  804545:	73 04                	jae    80454b <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804547:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80454b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80454f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804553:	48 89 d6             	mov    %rdx,%rsi
+  804556:	48 89 c7             	mov    %rax,%rdi
+  804559:	48 b8 d4 3e 80 00 00 	movabs $0x803ed4,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+  804565:	85 c0                	test   %eax,%eax
+  804567:	74 04                	je     80456d <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804569:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80456d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804571:	75 0b                	jne    80457e <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804573:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804577:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80457e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804581:	c9                   	leave
+  804582:	c3                   	ret
+
+0000000000804583 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804583:	55                   	push   %rbp
+  804584:	48 89 e5             	mov    %rsp,%rbp
+  804587:	48 83 ec 20          	sub    $0x20,%rsp
+  80458b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80458f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804597:	48 89 c7             	mov    %rax,%rdi
+  80459a:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8045a1:	00 00 00 
+  8045a4:	ff d0                	call   *%rax
+  8045a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ae:	48 ba 11 56 80 00 00 	movabs $0x805611,%rdx
+  8045b5:	00 00 00 
+  8045b8:	48 89 d6             	mov    %rdx,%rsi
+  8045bb:	48 89 c7             	mov    %rax,%rdi
+  8045be:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  8045c5:	00 00 00 
+  8045c8:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8045ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045d2:	89 c1                	mov    %eax,%ecx
+  8045d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d8:	48 8b 00             	mov    (%rax),%rax
+  8045db:	89 c2                	mov    %eax,%edx
+  8045dd:	89 c8                	mov    %ecx,%eax
+  8045df:	29 d0                	sub    %edx,%eax
+  8045e1:	89 c2                	mov    %eax,%edx
+  8045e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e7:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8045ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8045f8:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8045fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ff:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804606:	00 00 00 
+  804609:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804610:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804615:	c9                   	leave
+  804616:	c3                   	ret
+
+0000000000804617 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804617:	55                   	push   %rbp
+  804618:	48 89 e5             	mov    %rsp,%rbp
+  80461b:	48 83 ec 40          	sub    $0x40,%rsp
+  80461f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804623:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804627:	48 89 c7             	mov    %rax,%rdi
+  80462a:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  804631:	00 00 00 
+  804634:	ff d0                	call   *%rax
+  804636:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80463a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804641:	00 
+  804642:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804646:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80464a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464e:	48 01 d0             	add    %rdx,%rax
+  804651:	48 83 c0 1f          	add    $0x1f,%rax
+  804655:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804659:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80465d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804662:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804666:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80466a:	48 29 d0             	sub    %rdx,%rax
+  80466d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804671:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804675:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804679:	48 89 c6             	mov    %rax,%rsi
+  80467c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804681:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  804688:	00 00 00 
+  80468b:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80468d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804691:	48 89 c7             	mov    %rax,%rdi
+  804694:	48 b8 5d 40 80 00 00 	movabs $0x80405d,%rax
+  80469b:	00 00 00 
+  80469e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046a8:	eb 2f                	jmp    8046d9 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ae:	48 83 e8 01          	sub    $0x1,%rax
+  8046b2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046b6:	48 89 c2             	mov    %rax,%rdx
+  8046b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046bd:	48 01 d0             	add    %rdx,%rax
+  8046c0:	48 89 c6             	mov    %rax,%rsi
+  8046c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c8:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  8046cf:	00 00 00 
+  8046d2:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046d4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046d9:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8046de:	77 ca                	ja     8046aa <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8046e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e4:	48 89 c6             	mov    %rax,%rsi
+  8046e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ec:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  8046f3:	00 00 00 
+  8046f6:	ff d0                	call   *%rax
+}
+  8046f8:	c9                   	leave
+  8046f9:	c3                   	ret
+
+00000000008046fa <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8046fa:	55                   	push   %rbp
+  8046fb:	48 89 e5             	mov    %rsp,%rbp
+  8046fe:	48 83 ec 08          	sub    $0x8,%rsp
+  804702:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804705:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804709:	75 10                	jne    80471b <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80470b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804712:	00 00 00 
+  804715:	8b 00                	mov    (%rax),%eax
+  804717:	48 98                	cltq
+  804719:	eb 05                	jmp    804720 <vsyscall+0x26>
+  }
+  return 0;
+  80471b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804720:	c9                   	leave
+  804721:	c3                   	ret
+
+0000000000804722 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804722:	55                   	push   %rbp
+  804723:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804726:	bf 00 00 00 00       	mov    $0x0,%edi
+  80472b:	48 b8 fa 46 80 00 00 	movabs $0x8046fa,%rax
+  804732:	00 00 00 
+  804735:	ff d0                	call   *%rax
+}
+  804737:	5d                   	pop    %rbp
+  804738:	c3                   	ret
+
+0000000000804739 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804739:	55                   	push   %rbp
+  80473a:	48 89 e5             	mov    %rsp,%rbp
+  80473d:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804741:	0f 31                	rdtsc
+  804743:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804746:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804749:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80474c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80474f:	48 c1 e2 20          	shl    $0x20,%rdx
+  804753:	48 09 d0             	or     %rdx,%rax
+  804756:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80475a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80475e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804762:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804769:	00 00 00 
+  80476c:	8b 40 08             	mov    0x8(%rax),%eax
+  80476f:	48 98                	cltq
+  804771:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804779:	ba 00 00 00 00       	mov    $0x0,%edx
+  80477e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804782:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804789:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80478d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804792:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804796:	48 89 d0             	mov    %rdx,%rax
+  804799:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8047a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a5:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047a9:	48 01 c8             	add    %rcx,%rax
+}
+  8047ac:	c9                   	leave
+  8047ad:	c3                   	ret
+
+00000000008047ae <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047ae:	55                   	push   %rbp
+  8047af:	48 89 e5             	mov    %rsp,%rbp
+  8047b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8047b6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047bc:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8047bf:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8047c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8047c8:	48 89 c7             	mov    %rax,%rdi
+  8047cb:	48 b8 83 1d 80 00 00 	movabs $0x801d83,%rax
+  8047d2:	00 00 00 
+  8047d5:	ff d0                	call   *%rax
+}
+  8047d7:	90                   	nop
+  8047d8:	c9                   	leave
+  8047d9:	c3                   	ret
+
+00000000008047da <getchar>:
+
+int
+getchar(void) {
+  8047da:	55                   	push   %rbp
+  8047db:	48 89 e5             	mov    %rsp,%rbp
+  8047de:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8047e2:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8047e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047eb:	48 89 c6             	mov    %rax,%rsi
+  8047ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f3:	48 b8 0d 2d 80 00 00 	movabs $0x802d0d,%rax
+  8047fa:	00 00 00 
+  8047fd:	ff d0                	call   *%rax
+  8047ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804802:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804806:	79 05                	jns    80480d <getchar+0x33>
+    return r;
+  804808:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80480b:	eb 14                	jmp    804821 <getchar+0x47>
+  if (r < 1)
+  80480d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804811:	7f 07                	jg     80481a <getchar+0x40>
+    return -E_EOF;
+  804813:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804818:	eb 07                	jmp    804821 <getchar+0x47>
+  return c;
+  80481a:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80481e:	0f b6 c0             	movzbl %al,%eax
+}
+  804821:	c9                   	leave
+  804822:	c3                   	ret
+
+0000000000804823 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804823:	55                   	push   %rbp
+  804824:	48 89 e5             	mov    %rsp,%rbp
+  804827:	48 83 ec 20          	sub    $0x20,%rsp
+  80482b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80482e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804832:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804835:	48 89 d6             	mov    %rdx,%rsi
+  804838:	89 c7                	mov    %eax,%edi
+  80483a:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  804841:	00 00 00 
+  804844:	ff d0                	call   *%rax
+  804846:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804849:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80484d:	79 05                	jns    804854 <iscons+0x31>
+    return r;
+  80484f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804852:	eb 1a                	jmp    80486e <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804854:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804858:	8b 10                	mov    (%rax),%edx
+  80485a:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804861:	00 00 00 
+  804864:	8b 00                	mov    (%rax),%eax
+  804866:	39 c2                	cmp    %eax,%edx
+  804868:	0f 94 c0             	sete   %al
+  80486b:	0f b6 c0             	movzbl %al,%eax
+}
+  80486e:	c9                   	leave
+  80486f:	c3                   	ret
+
+0000000000804870 <opencons>:
+
+int
+opencons(void) {
+  804870:	55                   	push   %rbp
+  804871:	48 89 e5             	mov    %rsp,%rbp
+  804874:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804878:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80487c:	48 89 c7             	mov    %rax,%rdi
+  80487f:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  804886:	00 00 00 
+  804889:	ff d0                	call   *%rax
+  80488b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80488e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804892:	79 05                	jns    804899 <opencons+0x29>
+    return r;
+  804894:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804897:	eb 66                	jmp    8048ff <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804899:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80489d:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048a2:	48 89 c6             	mov    %rax,%rsi
+  8048a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048aa:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  8048b1:	00 00 00 
+  8048b4:	ff d0                	call   *%rax
+  8048b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048bd:	79 05                	jns    8048c4 <opencons+0x54>
+    return r;
+  8048bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048c2:	eb 3b                	jmp    8048ff <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8048c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c8:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8048cf:	00 00 00 
+  8048d2:	8b 12                	mov    (%rdx),%edx
+  8048d4:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8048d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048da:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8048e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8048ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f0:	48 89 c7             	mov    %rax,%rdi
+  8048f3:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  8048fa:	00 00 00 
+  8048fd:	ff d0                	call   *%rax
+}
+  8048ff:	c9                   	leave
+  804900:	c3                   	ret
+
+0000000000804901 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804901:	55                   	push   %rbp
+  804902:	48 89 e5             	mov    %rsp,%rbp
+  804905:	48 83 ec 20          	sub    $0x20,%rsp
+  804909:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80490c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80490f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804916:	48 89 d6             	mov    %rdx,%rsi
+  804919:	89 c7                	mov    %eax,%edi
+  80491b:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  804922:	00 00 00 
+  804925:	ff d0                	call   *%rax
+  804927:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80492a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80492e:	79 05                	jns    804935 <consmode+0x34>
+    return r;
+  804930:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804933:	eb 34                	jmp    804969 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804935:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804939:	8b 10                	mov    (%rax),%edx
+  80493b:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804942:	00 00 00 
+  804945:	8b 00                	mov    (%rax),%eax
+  804947:	39 c2                	cmp    %eax,%edx
+  804949:	74 07                	je     804952 <consmode+0x51>
+    return -E_INVAL;
+  80494b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804950:	eb 17                	jmp    804969 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804952:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804956:	8b 40 0c             	mov    0xc(%rax),%eax
+  804959:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80495c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804960:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804963:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804966:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804969:	c9                   	leave
+  80496a:	c3                   	ret
+
+000000000080496b <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80496b:	55                   	push   %rbp
+  80496c:	48 89 e5             	mov    %rsp,%rbp
+  80496f:	48 83 ec 20          	sub    $0x20,%rsp
+  804973:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804977:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80497b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80497f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804983:	8b 50 0c             	mov    0xc(%rax),%edx
+  804986:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80498a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80498e:	48 89 ce             	mov    %rcx,%rsi
+  804991:	48 89 c7             	mov    %rax,%rdi
+  804994:	48 b8 f4 22 80 00 00 	movabs $0x8022f4,%rax
+  80499b:	00 00 00 
+  80499e:	ff d0                	call   *%rax
+  8049a0:	48 98                	cltq
+}
+  8049a2:	c9                   	leave
+  8049a3:	c3                   	ret
+
+00000000008049a4 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049a4:	55                   	push   %rbp
+  8049a5:	48 89 e5             	mov    %rsp,%rbp
+  8049a8:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049af:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049b6:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049bd:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8049c4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049cb:	eb 74                	jmp    804a41 <devcons_write+0x9d>
+    m = n - tot;
+  8049cd:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8049d4:	89 c2                	mov    %eax,%edx
+  8049d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049d9:	29 c2                	sub    %eax,%edx
+  8049db:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8049de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049e1:	83 f8 7f             	cmp    $0x7f,%eax
+  8049e4:	76 07                	jbe    8049ed <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8049e6:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8049ed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049f0:	48 63 d0             	movslq %eax,%rdx
+  8049f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049f6:	48 63 c8             	movslq %eax,%rcx
+  8049f9:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804a00:	48 01 c1             	add    %rax,%rcx
+  804a03:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a0a:	48 89 ce             	mov    %rcx,%rsi
+  804a0d:	48 89 c7             	mov    %rax,%rdi
+  804a10:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  804a17:	00 00 00 
+  804a1a:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a1c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a1f:	48 63 d0             	movslq %eax,%rdx
+  804a22:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a29:	48 89 d6             	mov    %rdx,%rsi
+  804a2c:	48 89 c7             	mov    %rax,%rdi
+  804a2f:	48 b8 83 1d 80 00 00 	movabs $0x801d83,%rax
+  804a36:	00 00 00 
+  804a39:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a3b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a3e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a44:	48 98                	cltq
+  804a46:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a4d:	0f 82 7a ff ff ff    	jb     8049cd <devcons_write+0x29>
+  }
+  return tot;
+  804a53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a56:	48 98                	cltq
+}
+  804a58:	c9                   	leave
+  804a59:	c3                   	ret
+
+0000000000804a5a <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a5a:	55                   	push   %rbp
+  804a5b:	48 89 e5             	mov    %rsp,%rbp
+  804a5e:	48 83 ec 08          	sub    $0x8,%rsp
+  804a62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804a66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a6b:	c9                   	leave
+  804a6c:	c3                   	ret
+
+0000000000804a6d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a6d:	55                   	push   %rbp
+  804a6e:	48 89 e5             	mov    %rsp,%rbp
+  804a71:	48 83 ec 10          	sub    $0x10,%rsp
+  804a75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a81:	48 ba 1d 56 80 00 00 	movabs $0x80561d,%rdx
+  804a88:	00 00 00 
+  804a8b:	48 89 d6             	mov    %rdx,%rsi
+  804a8e:	48 89 c7             	mov    %rax,%rdi
+  804a91:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  804a98:	00 00 00 
+  804a9b:	ff d0                	call   *%rax
+  return 0;
+  804a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804aa2:	c9                   	leave
+  804aa3:	c3                   	ret
+
+0000000000804aa4 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aa4:	55                   	push   %rbp
+  804aa5:	48 89 e5             	mov    %rsp,%rbp
+  804aa8:	48 83 ec 30          	sub    $0x30,%rsp
+  804aac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ab0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804ab3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804ab7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804abe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ac1:	83 e0 02             	and    $0x2,%eax
+  804ac4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804acb:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ace:	83 f8 01             	cmp    $0x1,%eax
+  804ad1:	75 04                	jne    804ad7 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804ad3:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804ad7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ada:	83 e0 01             	and    $0x1,%eax
+  804add:	85 c0                	test   %eax,%eax
+  804adf:	74 44                	je     804b25 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ae1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ae4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ae9:	89 c2                	mov    %eax,%edx
+  804aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  804af0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af5:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  804afc:	00 00 00 
+  804aff:	ff d0                	call   *%rax
+  804b01:	83 f8 01             	cmp    $0x1,%eax
+  804b04:	75 06                	jne    804b0c <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b06:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b0a:	eb 19                	jmp    804b25 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b10:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b16:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b19:	89 c2                	mov    %eax,%edx
+  804b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b1f:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b25:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b28:	c9                   	leave
+  804b29:	c3                   	ret
+
+0000000000804b2a <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b2a:	55                   	push   %rbp
+  804b2b:	48 89 e5             	mov    %rsp,%rbp
+  804b2e:	53                   	push   %rbx
+  804b2f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b36:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b3d:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b43:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b4a:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b51:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b58:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804b5f:	84 c0                	test   %al,%al
+  804b61:	74 23                	je     804b86 <_panic+0x5c>
+  804b63:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804b6a:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804b6e:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804b72:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804b76:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804b7a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804b7e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804b82:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b86:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804b8d:	00 00 00 
+  804b90:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804b97:	00 00 00 
+  804b9a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b9e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804ba5:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804bac:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bb3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bba:	00 00 00 
+  804bbd:	48 8b 18             	mov    (%rax),%rbx
+  804bc0:	48 b8 21 1f 80 00 00 	movabs $0x801f21,%rax
+  804bc7:	00 00 00 
+  804bca:	ff d0                	call   *%rax
+  804bcc:	89 c6                	mov    %eax,%esi
+  804bce:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804bd4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804bdb:	41 89 d0             	mov    %edx,%r8d
+  804bde:	48 89 c1             	mov    %rax,%rcx
+  804be1:	48 89 da             	mov    %rbx,%rdx
+  804be4:	48 b8 28 56 80 00 00 	movabs $0x805628,%rax
+  804beb:	00 00 00 
+  804bee:	48 89 c7             	mov    %rax,%rdi
+  804bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf6:	49 b9 1c 02 80 00 00 	movabs $0x80021c,%r9
+  804bfd:	00 00 00 
+  804c00:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804c03:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c0a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c11:	48 89 d6             	mov    %rdx,%rsi
+  804c14:	48 89 c7             	mov    %rax,%rdi
+  804c17:	48 b8 91 01 80 00 00 	movabs $0x800191,%rax
+  804c1e:	00 00 00 
+  804c21:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c23:	48 b8 4b 56 80 00 00 	movabs $0x80564b,%rax
+  804c2a:	00 00 00 
+  804c2d:	48 89 c7             	mov    %rax,%rdi
+  804c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c35:	48 ba 1c 02 80 00 00 	movabs $0x80021c,%rdx
+  804c3c:	00 00 00 
+  804c3f:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c41:	cc                   	int3
+  804c42:	eb fd                	jmp    804c41 <_panic+0x117>
+
+0000000000804c44 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c44:	55                   	push   %rbp
+  804c45:	48 89 e5             	mov    %rsp,%rbp
+  804c48:	48 83 ec 20          	sub    $0x20,%rsp
+  804c4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c50:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c54:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c58:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c5c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c64:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c6b:	48 89 c7             	mov    %rax,%rdi
+  804c6e:	48 b8 7c 4c 80 00 00 	movabs $0x804c7c,%rax
+  804c75:	00 00 00 
+  804c78:	ff d0                	call   *%rax
+}
+  804c7a:	c9                   	leave
+  804c7b:	c3                   	ret
+
+0000000000804c7c <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c7c:	55                   	push   %rbp
+  804c7d:	48 89 e5             	mov    %rsp,%rbp
+  804c80:	48 83 ec 30          	sub    $0x30,%rsp
+  804c84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c88:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c8c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c90:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c94:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c99:	75 0e                	jne    804ca9 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c9b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ca2:	00 00 00 
+  804ca5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804ca9:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cae:	75 18                	jne    804cc8 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cb4:	48 89 c7             	mov    %rax,%rdi
+  804cb7:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  804cbe:	00 00 00 
+  804cc1:	ff d0                	call   *%rax
+  804cc3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cc6:	eb 1d                	jmp    804ce5 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cc8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ccc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd0:	48 89 d6             	mov    %rdx,%rsi
+  804cd3:	48 89 c7             	mov    %rax,%rdi
+  804cd6:	48 b8 20 22 80 00 00 	movabs $0x802220,%rax
+  804cdd:	00 00 00 
+  804ce0:	ff d0                	call   *%rax
+  804ce2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804ce5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ce9:	79 2a                	jns    804d15 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804ceb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf0:	74 0a                	je     804cfc <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cfc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d01:	74 0a                	je     804d0d <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d07:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d10:	e9 aa 00 00 00       	jmp    804dbf <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d15:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d1a:	74 36                	je     804d52 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d1c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d23:	00 00 00 
+  804d26:	8b 40 04             	mov    0x4(%rax),%eax
+  804d29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d2e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d35:	00 00 00 
+  804d38:	48 98                	cltq
+  804d3a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d41:	48 01 d0             	add    %rdx,%rax
+  804d44:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d4a:	8b 10                	mov    (%rax),%edx
+  804d4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d50:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d52:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d57:	74 36                	je     804d8f <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d59:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d60:	00 00 00 
+  804d63:	8b 40 04             	mov    0x4(%rax),%eax
+  804d66:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d6b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d72:	00 00 00 
+  804d75:	48 98                	cltq
+  804d77:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d7e:	48 01 d0             	add    %rdx,%rax
+  804d81:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d87:	8b 10                	mov    (%rax),%edx
+  804d89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d8d:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d8f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d96:	00 00 00 
+  804d99:	8b 40 04             	mov    0x4(%rax),%eax
+  804d9c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804da1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804da8:	00 00 00 
+  804dab:	48 98                	cltq
+  804dad:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804db4:	48 01 d0             	add    %rdx,%rax
+  804db7:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dbd:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dbf:	c9                   	leave
+  804dc0:	c3                   	ret
+
+0000000000804dc1 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dc1:	55                   	push   %rbp
+  804dc2:	48 89 e5             	mov    %rsp,%rbp
+  804dc5:	48 83 ec 30          	sub    $0x30,%rsp
+  804dc9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dcc:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dcf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dd3:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dd6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ddb:	75 5e                	jne    804e3b <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804ddd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804de4:	00 00 00 
+  804de7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804deb:	eb 4e                	jmp    804e3b <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804ded:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804df1:	79 3c                	jns    804e2f <ipc_send+0x6e>
+  804df3:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804df7:	74 36                	je     804e2f <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dfc:	89 c1                	mov    %eax,%ecx
+  804dfe:	48 b8 50 56 80 00 00 	movabs $0x805650,%rax
+  804e05:	00 00 00 
+  804e08:	48 89 c2             	mov    %rax,%rdx
+  804e0b:	be 54 00 00 00       	mov    $0x54,%esi
+  804e10:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  804e17:	00 00 00 
+  804e1a:	48 89 c7             	mov    %rax,%rdi
+  804e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e22:	49 b8 2a 4b 80 00 00 	movabs $0x804b2a,%r8
+  804e29:	00 00 00 
+  804e2c:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e2f:	48 b8 5d 1f 80 00 00 	movabs $0x801f5d,%rax
+  804e36:	00 00 00 
+  804e39:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e3b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e3e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e41:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e48:	89 c7                	mov    %eax,%edi
+  804e4a:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  804e51:	00 00 00 
+  804e54:	ff d0                	call   *%rax
+  804e56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e59:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e5d:	75 8e                	jne    804ded <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e5f:	48 b8 5d 1f 80 00 00 	movabs $0x801f5d,%rax
+  804e66:	00 00 00 
+  804e69:	ff d0                	call   *%rax
+}
+  804e6b:	90                   	nop
+  804e6c:	c9                   	leave
+  804e6d:	c3                   	ret
+
+0000000000804e6e <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e6e:	55                   	push   %rbp
+  804e6f:	48 89 e5             	mov    %rsp,%rbp
+  804e72:	48 83 ec 18          	sub    $0x18,%rsp
+  804e76:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e80:	eb 4d                	jmp    804ecf <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e82:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e89:	00 00 00 
+  804e8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e8f:	48 98                	cltq
+  804e91:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e98:	48 01 d0             	add    %rdx,%rax
+  804e9b:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ea1:	8b 00                	mov    (%rax),%eax
+  804ea3:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ea6:	75 23                	jne    804ecb <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804ea8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eaf:	00 00 00 
+  804eb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eb5:	48 98                	cltq
+  804eb7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ebe:	48 01 d0             	add    %rdx,%rax
+  804ec1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ec7:	8b 00                	mov    (%rax),%eax
+  804ec9:	eb 12                	jmp    804edd <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ecb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ecf:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ed6:	7e aa                	jle    804e82 <ipc_find_env+0x14>
+  return 0;
+  804ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804edd:	c9                   	leave
+  804ede:	c3                   	ret
+
+0000000000804edf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804edf:	55                   	push   %rbp
+  804ee0:	48 89 e5             	mov    %rsp,%rbp
+  804ee3:	48 83 ec 18          	sub    $0x18,%rsp
+  804ee7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eef:	48 c1 e8 27          	shr    $0x27,%rax
+  804ef3:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ef8:	48 89 c2             	mov    %rax,%rdx
+  804efb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f02:	01 00 00 
+  804f05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f09:	83 e0 01             	and    $0x1,%eax
+  804f0c:	48 85 c0             	test   %rax,%rax
+  804f0f:	74 63                	je     804f74 <pageref+0x95>
+  804f11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f15:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f19:	48 89 c2             	mov    %rax,%rdx
+  804f1c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f23:	01 00 00 
+  804f26:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f2a:	83 e0 01             	and    $0x1,%eax
+  804f2d:	48 85 c0             	test   %rax,%rax
+  804f30:	74 42                	je     804f74 <pageref+0x95>
+  804f32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f36:	48 c1 e8 15          	shr    $0x15,%rax
+  804f3a:	48 89 c2             	mov    %rax,%rdx
+  804f3d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f44:	01 00 00 
+  804f47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f4b:	83 e0 01             	and    $0x1,%eax
+  804f4e:	48 85 c0             	test   %rax,%rax
+  804f51:	74 21                	je     804f74 <pageref+0x95>
+  804f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f57:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f5b:	48 89 c2             	mov    %rax,%rdx
+  804f5e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f65:	01 00 00 
+  804f68:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f6c:	83 e0 01             	and    $0x1,%eax
+  804f6f:	48 85 c0             	test   %rax,%rax
+  804f72:	75 07                	jne    804f7b <pageref+0x9c>
+    return 0;
+  804f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f79:	eb 53                	jmp    804fce <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f83:	48 89 c2             	mov    %rax,%rdx
+  804f86:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f8d:	01 00 00 
+  804f90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f9c:	83 e0 01             	and    $0x1,%eax
+  804f9f:	48 85 c0             	test   %rax,%rax
+  804fa2:	75 07                	jne    804fab <pageref+0xcc>
+    return 0;
+  804fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa9:	eb 23                	jmp    804fce <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804faf:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fb3:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fba:	00 00 00 
+  804fbd:	48 c1 e0 04          	shl    $0x4,%rax
+  804fc1:	48 01 d0             	add    %rdx,%rax
+  804fc4:	48 83 c0 08          	add    $0x8,%rax
+  804fc8:	0f b7 00             	movzwl (%rax),%eax
+  804fcb:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fce:	c9                   	leave
+  804fcf:	c3                   	ret
@@ -0,0 +1,9244 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 0a 0f 00 00       	call   800f36 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 40          	sub    $0x40,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80003e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800042:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800046:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  80004a:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+  int mismatch = 0;
+  80004e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800055:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800059:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80005d:	48 89 d1             	mov    %rdx,%rcx
+  800060:	48 89 c2             	mov    %rax,%rdx
+  800063:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80006a:	00 00 00 
+  80006d:	48 89 c6             	mov    %rax,%rsi
+  800070:	48 b8 01 60 80 00 00 	movabs $0x806001,%rax
+  800077:	00 00 00 
+  80007a:	48 89 c7             	mov    %rax,%rdi
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800089:	00 00 00 
+  80008c:	41 ff d0             	call   *%r8
+      cprintf("MISMATCH\n");                                                               \
+      mismatch = 1;                                                                        \
+    }                                                                                      \
+  } while (0)
+
+  CHECK(r14, regs.reg_r14);
+  80008f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800093:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  800097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80009b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80009f:	48 89 d1             	mov    %rdx,%rcx
+  8000a2:	48 89 c2             	mov    %rax,%rdx
+  8000a5:	48 b8 11 60 80 00 00 	movabs $0x806011,%rax
+  8000ac:	00 00 00 
+  8000af:	48 89 c6             	mov    %rax,%rsi
+  8000b2:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 89 c7             	mov    %rax,%rdi
+  8000bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c4:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8000cb:	00 00 00 
+  8000ce:	41 ff d0             	call   *%r8
+  8000d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000d5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8000d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8000dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8000e1:	48 39 c2             	cmp    %rax,%rdx
+  8000e4:	75 20                	jne    800106 <check_regs+0xd4>
+  8000e6:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8000ed:	00 00 00 
+  8000f0:	48 89 c7             	mov    %rax,%rdi
+  8000f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f8:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8000ff:	00 00 00 
+  800102:	ff d2                	call   *%rdx
+  800104:	eb 25                	jmp    80012b <check_regs+0xf9>
+  800106:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  80010d:	00 00 00 
+  800110:	48 89 c7             	mov    %rax,%rdi
+  800113:	b8 00 00 00 00       	mov    $0x0,%eax
+  800118:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80011f:	00 00 00 
+  800122:	ff d2                	call   *%rdx
+  800124:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(r13, regs.reg_r13);
+  80012b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80012f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800137:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80013b:	48 89 d1             	mov    %rdx,%rcx
+  80013e:	48 89 c2             	mov    %rax,%rdx
+  800141:	48 b8 35 60 80 00 00 	movabs $0x806035,%rax
+  800148:	00 00 00 
+  80014b:	48 89 c6             	mov    %rax,%rsi
+  80014e:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800155:	00 00 00 
+  800158:	48 89 c7             	mov    %rax,%rdi
+  80015b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800160:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800167:	00 00 00 
+  80016a:	41 ff d0             	call   *%r8
+  80016d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800171:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800175:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800179:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	75 20                	jne    8001a2 <check_regs+0x170>
+  800182:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800189:	00 00 00 
+  80018c:	48 89 c7             	mov    %rax,%rdi
+  80018f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800194:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80019b:	00 00 00 
+  80019e:	ff d2                	call   *%rdx
+  8001a0:	eb 25                	jmp    8001c7 <check_regs+0x195>
+  8001a2:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8001a9:	00 00 00 
+  8001ac:	48 89 c7             	mov    %rax,%rdi
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8001bb:	00 00 00 
+  8001be:	ff d2                	call   *%rdx
+  8001c0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(r12, regs.reg_r12);
+  8001c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001cb:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8001cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8001d3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8001d7:	48 89 d1             	mov    %rdx,%rcx
+  8001da:	48 89 c2             	mov    %rax,%rdx
+  8001dd:	48 b8 39 60 80 00 00 	movabs $0x806039,%rax
+  8001e4:	00 00 00 
+  8001e7:	48 89 c6             	mov    %rax,%rsi
+  8001ea:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8001f1:	00 00 00 
+  8001f4:	48 89 c7             	mov    %rax,%rdi
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80020d:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  800211:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800215:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800219:	48 39 c2             	cmp    %rax,%rdx
+  80021c:	75 20                	jne    80023e <check_regs+0x20c>
+  80021e:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800225:	00 00 00 
+  800228:	48 89 c7             	mov    %rax,%rdi
+  80022b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800230:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800237:	00 00 00 
+  80023a:	ff d2                	call   *%rdx
+  80023c:	eb 25                	jmp    800263 <check_regs+0x231>
+  80023e:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800245:	00 00 00 
+  800248:	48 89 c7             	mov    %rax,%rdi
+  80024b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800250:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800257:	00 00 00 
+  80025a:	ff d2                	call   *%rdx
+  80025c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(r11, regs.reg_r11);
+  800263:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800267:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80026b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80026f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800273:	48 89 d1             	mov    %rdx,%rcx
+  800276:	48 89 c2             	mov    %rax,%rdx
+  800279:	48 b8 3d 60 80 00 00 	movabs $0x80603d,%rax
+  800280:	00 00 00 
+  800283:	48 89 c6             	mov    %rax,%rsi
+  800286:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  80028d:	00 00 00 
+  800290:	48 89 c7             	mov    %rax,%rdi
+  800293:	b8 00 00 00 00       	mov    $0x0,%eax
+  800298:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80029f:	00 00 00 
+  8002a2:	41 ff d0             	call   *%r8
+  8002a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002a9:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8002ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8002b1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8002b5:	48 39 c2             	cmp    %rax,%rdx
+  8002b8:	75 20                	jne    8002da <check_regs+0x2a8>
+  8002ba:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8002c1:	00 00 00 
+  8002c4:	48 89 c7             	mov    %rax,%rdi
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8002d3:	00 00 00 
+  8002d6:	ff d2                	call   *%rdx
+  8002d8:	eb 25                	jmp    8002ff <check_regs+0x2cd>
+  8002da:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8002e1:	00 00 00 
+  8002e4:	48 89 c7             	mov    %rax,%rdi
+  8002e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ec:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8002f3:	00 00 00 
+  8002f6:	ff d2                	call   *%rdx
+  8002f8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(r10, regs.reg_r10);
+  8002ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800303:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  800307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80030b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80030f:	48 89 d1             	mov    %rdx,%rcx
+  800312:	48 89 c2             	mov    %rax,%rdx
+  800315:	48 b8 41 60 80 00 00 	movabs $0x806041,%rax
+  80031c:	00 00 00 
+  80031f:	48 89 c6             	mov    %rax,%rsi
+  800322:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800329:	00 00 00 
+  80032c:	48 89 c7             	mov    %rax,%rdi
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80033b:	00 00 00 
+  80033e:	41 ff d0             	call   *%r8
+  800341:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800345:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  800349:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80034d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800351:	48 39 c2             	cmp    %rax,%rdx
+  800354:	75 20                	jne    800376 <check_regs+0x344>
+  800356:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  80035d:	00 00 00 
+  800360:	48 89 c7             	mov    %rax,%rdi
+  800363:	b8 00 00 00 00       	mov    $0x0,%eax
+  800368:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80036f:	00 00 00 
+  800372:	ff d2                	call   *%rdx
+  800374:	eb 25                	jmp    80039b <check_regs+0x369>
+  800376:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  80037d:	00 00 00 
+  800380:	48 89 c7             	mov    %rax,%rdi
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80038f:	00 00 00 
+  800392:	ff d2                	call   *%rdx
+  800394:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rsi, regs.reg_rsi);
+  80039b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80039f:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  8003a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003a7:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8003ab:	48 89 d1             	mov    %rdx,%rcx
+  8003ae:	48 89 c2             	mov    %rax,%rdx
+  8003b1:	48 b8 45 60 80 00 00 	movabs $0x806045,%rax
+  8003b8:	00 00 00 
+  8003bb:	48 89 c6             	mov    %rax,%rsi
+  8003be:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8003c5:	00 00 00 
+  8003c8:	48 89 c7             	mov    %rax,%rdi
+  8003cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d0:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8003d7:	00 00 00 
+  8003da:	41 ff d0             	call   *%r8
+  8003dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003e1:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  8003e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003e9:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8003ed:	48 39 c2             	cmp    %rax,%rdx
+  8003f0:	75 20                	jne    800412 <check_regs+0x3e0>
+  8003f2:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8003f9:	00 00 00 
+  8003fc:	48 89 c7             	mov    %rax,%rdi
+  8003ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800404:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80040b:	00 00 00 
+  80040e:	ff d2                	call   *%rdx
+  800410:	eb 25                	jmp    800437 <check_regs+0x405>
+  800412:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800419:	00 00 00 
+  80041c:	48 89 c7             	mov    %rax,%rdi
+  80041f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800424:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80042b:	00 00 00 
+  80042e:	ff d2                	call   *%rdx
+  800430:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rdi, regs.reg_rdi);
+  800437:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80043b:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80043f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800443:	48 8b 40 48          	mov    0x48(%rax),%rax
+  800447:	48 89 d1             	mov    %rdx,%rcx
+  80044a:	48 89 c2             	mov    %rax,%rdx
+  80044d:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  800454:	00 00 00 
+  800457:	48 89 c6             	mov    %rax,%rsi
+  80045a:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800461:	00 00 00 
+  800464:	48 89 c7             	mov    %rax,%rdi
+  800467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046c:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800473:	00 00 00 
+  800476:	41 ff d0             	call   *%r8
+  800479:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80047d:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  800481:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800485:	48 8b 40 48          	mov    0x48(%rax),%rax
+  800489:	48 39 c2             	cmp    %rax,%rdx
+  80048c:	75 20                	jne    8004ae <check_regs+0x47c>
+  80048e:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800495:	00 00 00 
+  800498:	48 89 c7             	mov    %rax,%rdi
+  80049b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a0:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8004a7:	00 00 00 
+  8004aa:	ff d2                	call   *%rdx
+  8004ac:	eb 25                	jmp    8004d3 <check_regs+0x4a1>
+  8004ae:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8004b5:	00 00 00 
+  8004b8:	48 89 c7             	mov    %rax,%rdi
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rdi, regs.reg_rdi);
+  8004d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004d7:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8004db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004df:	48 8b 40 48          	mov    0x48(%rax),%rax
+  8004e3:	48 89 d1             	mov    %rdx,%rcx
+  8004e6:	48 89 c2             	mov    %rax,%rdx
+  8004e9:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  8004f0:	00 00 00 
+  8004f3:	48 89 c6             	mov    %rax,%rsi
+  8004f6:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8004fd:	00 00 00 
+  800500:	48 89 c7             	mov    %rax,%rdi
+  800503:	b8 00 00 00 00       	mov    $0x0,%eax
+  800508:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80050f:	00 00 00 
+  800512:	41 ff d0             	call   *%r8
+  800515:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800519:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80051d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800521:	48 8b 40 48          	mov    0x48(%rax),%rax
+  800525:	48 39 c2             	cmp    %rax,%rdx
+  800528:	75 20                	jne    80054a <check_regs+0x518>
+  80052a:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800531:	00 00 00 
+  800534:	48 89 c7             	mov    %rax,%rdi
+  800537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053c:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800543:	00 00 00 
+  800546:	ff d2                	call   *%rdx
+  800548:	eb 25                	jmp    80056f <check_regs+0x53d>
+  80054a:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800551:	00 00 00 
+  800554:	48 89 c7             	mov    %rax,%rdi
+  800557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055c:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800563:	00 00 00 
+  800566:	ff d2                	call   *%rdx
+  800568:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rsi, regs.reg_rsi);
+  80056f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800573:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  800577:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80057b:	48 8b 40 40          	mov    0x40(%rax),%rax
+  80057f:	48 89 d1             	mov    %rdx,%rcx
+  800582:	48 89 c2             	mov    %rax,%rdx
+  800585:	48 b8 45 60 80 00 00 	movabs $0x806045,%rax
+  80058c:	00 00 00 
+  80058f:	48 89 c6             	mov    %rax,%rsi
+  800592:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800599:	00 00 00 
+  80059c:	48 89 c7             	mov    %rax,%rdi
+  80059f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a4:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8005ab:	00 00 00 
+  8005ae:	41 ff d0             	call   *%r8
+  8005b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b5:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  8005b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005bd:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8005c1:	48 39 c2             	cmp    %rax,%rdx
+  8005c4:	75 20                	jne    8005e6 <check_regs+0x5b4>
+  8005c6:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8005cd:	00 00 00 
+  8005d0:	48 89 c7             	mov    %rax,%rdi
+  8005d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d8:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8005df:	00 00 00 
+  8005e2:	ff d2                	call   *%rdx
+  8005e4:	eb 25                	jmp    80060b <check_regs+0x5d9>
+  8005e6:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8005ed:	00 00 00 
+  8005f0:	48 89 c7             	mov    %rax,%rdi
+  8005f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f8:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8005ff:	00 00 00 
+  800602:	ff d2                	call   *%rdx
+  800604:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rbp, regs.reg_rbp);
+  80060b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80060f:	48 8b 50 50          	mov    0x50(%rax),%rdx
+  800613:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800617:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80061b:	48 89 d1             	mov    %rdx,%rcx
+  80061e:	48 89 c2             	mov    %rax,%rdx
+  800621:	48 b8 4d 60 80 00 00 	movabs $0x80604d,%rax
+  800628:	00 00 00 
+  80062b:	48 89 c6             	mov    %rax,%rsi
+  80062e:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800635:	00 00 00 
+  800638:	48 89 c7             	mov    %rax,%rdi
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800640:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800647:	00 00 00 
+  80064a:	41 ff d0             	call   *%r8
+  80064d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800651:	48 8b 50 50          	mov    0x50(%rax),%rdx
+  800655:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800659:	48 8b 40 50          	mov    0x50(%rax),%rax
+  80065d:	48 39 c2             	cmp    %rax,%rdx
+  800660:	75 20                	jne    800682 <check_regs+0x650>
+  800662:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800669:	00 00 00 
+  80066c:	48 89 c7             	mov    %rax,%rdi
+  80066f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800674:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80067b:	00 00 00 
+  80067e:	ff d2                	call   *%rdx
+  800680:	eb 25                	jmp    8006a7 <check_regs+0x675>
+  800682:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800689:	00 00 00 
+  80068c:	48 89 c7             	mov    %rax,%rdi
+  80068f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800694:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80069b:	00 00 00 
+  80069e:	ff d2                	call   *%rdx
+  8006a0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rbx, regs.reg_rbx);
+  8006a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006ab:	48 8b 50 68          	mov    0x68(%rax),%rdx
+  8006af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006b3:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8006b7:	48 89 d1             	mov    %rdx,%rcx
+  8006ba:	48 89 c2             	mov    %rax,%rdx
+  8006bd:	48 b8 51 60 80 00 00 	movabs $0x806051,%rax
+  8006c4:	00 00 00 
+  8006c7:	48 89 c6             	mov    %rax,%rsi
+  8006ca:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8006d1:	00 00 00 
+  8006d4:	48 89 c7             	mov    %rax,%rdi
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8006e3:	00 00 00 
+  8006e6:	41 ff d0             	call   *%r8
+  8006e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ed:	48 8b 50 68          	mov    0x68(%rax),%rdx
+  8006f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006f5:	48 8b 40 68          	mov    0x68(%rax),%rax
+  8006f9:	48 39 c2             	cmp    %rax,%rdx
+  8006fc:	75 20                	jne    80071e <check_regs+0x6ec>
+  8006fe:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800705:	00 00 00 
+  800708:	48 89 c7             	mov    %rax,%rdi
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	eb 25                	jmp    800743 <check_regs+0x711>
+  80071e:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800725:	00 00 00 
+  800728:	48 89 c7             	mov    %rax,%rdi
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rdx, regs.reg_rdx);
+  800743:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800747:	48 8b 50 58          	mov    0x58(%rax),%rdx
+  80074b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074f:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800753:	48 89 d1             	mov    %rdx,%rcx
+  800756:	48 89 c2             	mov    %rax,%rdx
+  800759:	48 b8 55 60 80 00 00 	movabs $0x806055,%rax
+  800760:	00 00 00 
+  800763:	48 89 c6             	mov    %rax,%rsi
+  800766:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  80076d:	00 00 00 
+  800770:	48 89 c7             	mov    %rax,%rdi
+  800773:	b8 00 00 00 00       	mov    $0x0,%eax
+  800778:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80077f:	00 00 00 
+  800782:	41 ff d0             	call   *%r8
+  800785:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800789:	48 8b 50 58          	mov    0x58(%rax),%rdx
+  80078d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800791:	48 8b 40 58          	mov    0x58(%rax),%rax
+  800795:	48 39 c2             	cmp    %rax,%rdx
+  800798:	75 20                	jne    8007ba <check_regs+0x788>
+  80079a:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8007a1:	00 00 00 
+  8007a4:	48 89 c7             	mov    %rax,%rdi
+  8007a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ac:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8007b3:	00 00 00 
+  8007b6:	ff d2                	call   *%rdx
+  8007b8:	eb 25                	jmp    8007df <check_regs+0x7ad>
+  8007ba:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8007c1:	00 00 00 
+  8007c4:	48 89 c7             	mov    %rax,%rdi
+  8007c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cc:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8007d3:	00 00 00 
+  8007d6:	ff d2                	call   *%rdx
+  8007d8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rcx, regs.reg_rcx);
+  8007df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007e3:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8007e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007eb:	48 8b 40 60          	mov    0x60(%rax),%rax
+  8007ef:	48 89 d1             	mov    %rdx,%rcx
+  8007f2:	48 89 c2             	mov    %rax,%rdx
+  8007f5:	48 b8 59 60 80 00 00 	movabs $0x806059,%rax
+  8007fc:	00 00 00 
+  8007ff:	48 89 c6             	mov    %rax,%rsi
+  800802:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800809:	00 00 00 
+  80080c:	48 89 c7             	mov    %rax,%rdi
+  80080f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800814:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80081b:	00 00 00 
+  80081e:	41 ff d0             	call   *%r8
+  800821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800825:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800829:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80082d:	48 8b 40 60          	mov    0x60(%rax),%rax
+  800831:	48 39 c2             	cmp    %rax,%rdx
+  800834:	75 20                	jne    800856 <check_regs+0x824>
+  800836:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  80083d:	00 00 00 
+  800840:	48 89 c7             	mov    %rax,%rdi
+  800843:	b8 00 00 00 00       	mov    $0x0,%eax
+  800848:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80084f:	00 00 00 
+  800852:	ff d2                	call   *%rdx
+  800854:	eb 25                	jmp    80087b <check_regs+0x849>
+  800856:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  80085d:	00 00 00 
+  800860:	48 89 c7             	mov    %rax,%rdi
+  800863:	b8 00 00 00 00       	mov    $0x0,%eax
+  800868:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80086f:	00 00 00 
+  800872:	ff d2                	call   *%rdx
+  800874:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rax, regs.reg_rax);
+  80087b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80087f:	48 8b 50 70          	mov    0x70(%rax),%rdx
+  800883:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800887:	48 8b 40 70          	mov    0x70(%rax),%rax
+  80088b:	48 89 d1             	mov    %rdx,%rcx
+  80088e:	48 89 c2             	mov    %rax,%rdx
+  800891:	48 b8 5d 60 80 00 00 	movabs $0x80605d,%rax
+  800898:	00 00 00 
+  80089b:	48 89 c6             	mov    %rax,%rsi
+  80089e:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8008a5:	00 00 00 
+  8008a8:	48 89 c7             	mov    %rax,%rdi
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8008b7:	00 00 00 
+  8008ba:	41 ff d0             	call   *%r8
+  8008bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c1:	48 8b 50 70          	mov    0x70(%rax),%rdx
+  8008c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008c9:	48 8b 40 70          	mov    0x70(%rax),%rax
+  8008cd:	48 39 c2             	cmp    %rax,%rdx
+  8008d0:	75 20                	jne    8008f2 <check_regs+0x8c0>
+  8008d2:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  8008d9:	00 00 00 
+  8008dc:	48 89 c7             	mov    %rax,%rdi
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8008eb:	00 00 00 
+  8008ee:	ff d2                	call   *%rdx
+  8008f0:	eb 25                	jmp    800917 <check_regs+0x8e5>
+  8008f2:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  8008f9:	00 00 00 
+  8008fc:	48 89 c7             	mov    %rax,%rdi
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  80090b:	00 00 00 
+  80090e:	ff d2                	call   *%rdx
+  800910:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rip, rip);
+  800917:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80091b:	48 8b 50 78          	mov    0x78(%rax),%rdx
+  80091f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800923:	48 8b 40 78          	mov    0x78(%rax),%rax
+  800927:	48 89 d1             	mov    %rdx,%rcx
+  80092a:	48 89 c2             	mov    %rax,%rdx
+  80092d:	48 b8 61 60 80 00 00 	movabs $0x806061,%rax
+  800934:	00 00 00 
+  800937:	48 89 c6             	mov    %rax,%rsi
+  80093a:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800941:	00 00 00 
+  800944:	48 89 c7             	mov    %rax,%rdi
+  800947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094c:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800953:	00 00 00 
+  800956:	41 ff d0             	call   *%r8
+  800959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095d:	48 8b 50 78          	mov    0x78(%rax),%rdx
+  800961:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800965:	48 8b 40 78          	mov    0x78(%rax),%rax
+  800969:	48 39 c2             	cmp    %rax,%rdx
+  80096c:	75 20                	jne    80098e <check_regs+0x95c>
+  80096e:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800975:	00 00 00 
+  800978:	48 89 c7             	mov    %rax,%rdi
+  80097b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800980:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800987:	00 00 00 
+  80098a:	ff d2                	call   *%rdx
+  80098c:	eb 25                	jmp    8009b3 <check_regs+0x981>
+  80098e:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800995:	00 00 00 
+  800998:	48 89 c7             	mov    %rax,%rdi
+  80099b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a0:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8009a7:	00 00 00 
+  8009aa:	ff d2                	call   *%rdx
+  8009ac:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rflags, rflags);
+  8009b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009b7:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8009be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c2:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  8009c9:	48 89 d1             	mov    %rdx,%rcx
+  8009cc:	48 89 c2             	mov    %rax,%rdx
+  8009cf:	48 b8 65 60 80 00 00 	movabs $0x806065,%rax
+  8009d6:	00 00 00 
+  8009d9:	48 89 c6             	mov    %rax,%rsi
+  8009dc:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  8009e3:	00 00 00 
+  8009e6:	48 89 c7             	mov    %rax,%rdi
+  8009e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ee:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  8009f5:	00 00 00 
+  8009f8:	41 ff d0             	call   *%r8
+  8009fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ff:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  800a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a0a:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  800a11:	48 39 c2             	cmp    %rax,%rdx
+  800a14:	75 20                	jne    800a36 <check_regs+0xa04>
+  800a16:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800a1d:	00 00 00 
+  800a20:	48 89 c7             	mov    %rax,%rdi
+  800a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a28:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800a2f:	00 00 00 
+  800a32:	ff d2                	call   *%rdx
+  800a34:	eb 25                	jmp    800a5b <check_regs+0xa29>
+  800a36:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800a3d:	00 00 00 
+  800a40:	48 89 c7             	mov    %rax,%rdi
+  800a43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a48:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800a4f:	00 00 00 
+  800a52:	ff d2                	call   *%rdx
+  800a54:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  CHECK(rsp, rsp);
+  800a5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a5f:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  800a66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a6a:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  800a71:	48 89 d1             	mov    %rdx,%rcx
+  800a74:	48 89 c2             	mov    %rax,%rdx
+  800a77:	48 b8 6c 60 80 00 00 	movabs $0x80606c,%rax
+  800a7e:	00 00 00 
+  800a81:	48 89 c6             	mov    %rax,%rsi
+  800a84:	48 b8 15 60 80 00 00 	movabs $0x806015,%rax
+  800a8b:	00 00 00 
+  800a8e:	48 89 c7             	mov    %rax,%rdi
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a96:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  800a9d:	00 00 00 
+  800aa0:	41 ff d0             	call   *%r8
+  800aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa7:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  800aae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ab2:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  800ab9:	48 39 c2             	cmp    %rax,%rdx
+  800abc:	75 20                	jne    800ade <check_regs+0xaac>
+  800abe:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800ac5:	00 00 00 
+  800ac8:	48 89 c7             	mov    %rax,%rdi
+  800acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad0:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800ad7:	00 00 00 
+  800ada:	ff d2                	call   *%rdx
+  800adc:	eb 25                	jmp    800b03 <check_regs+0xad1>
+  800ade:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800ae5:	00 00 00 
+  800ae8:	48 89 c7             	mov    %rax,%rdi
+  800aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af0:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800af7:	00 00 00 
+  800afa:	ff d2                	call   *%rdx
+  800afc:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+#undef CHECK
+
+  cprintf("Registers %s ", testname);
+  800b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b07:	48 89 c6             	mov    %rax,%rsi
+  800b0a:	48 b8 70 60 80 00 00 	movabs $0x806070,%rax
+  800b11:	00 00 00 
+  800b14:	48 89 c7             	mov    %rax,%rdi
+  800b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1c:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800b23:	00 00 00 
+  800b26:	ff d2                	call   *%rdx
+  if (!mismatch)
+  800b28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800b2c:	75 20                	jne    800b4e <check_regs+0xb1c>
+    cprintf("OK\n");
+  800b2e:	48 b8 27 60 80 00 00 	movabs $0x806027,%rax
+  800b35:	00 00 00 
+  800b38:	48 89 c7             	mov    %rax,%rdi
+  800b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b40:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800b47:	00 00 00 
+  800b4a:	ff d2                	call   *%rdx
+  else
+    cprintf("MISMATCH\n");
+}
+  800b4c:	eb 1e                	jmp    800b6c <check_regs+0xb3a>
+    cprintf("MISMATCH\n");
+  800b4e:	48 b8 2b 60 80 00 00 	movabs $0x80602b,%rax
+  800b55:	00 00 00 
+  800b58:	48 89 c7             	mov    %rax,%rdi
+  800b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b60:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800b67:	00 00 00 
+  800b6a:	ff d2                	call   *%rdx
+}
+  800b6c:	90                   	nop
+  800b6d:	c9                   	leave
+  800b6e:	c3                   	ret
+
+0000000000800b6f <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf) {
+  800b6f:	55                   	push   %rbp
+  800b70:	48 89 e5             	mov    %rsp,%rbp
+  800b73:	53                   	push   %rbx
+  800b74:	48 83 ec 28          	sub    $0x28,%rsp
+  800b78:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int r;
+
+  if (utf->utf_fault_va != (uint64_t)UTEMP)
+  800b7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b80:	48 8b 00             	mov    (%rax),%rax
+  800b83:	48 3d 00 00 40 00    	cmp    $0x400000,%rax
+  800b89:	74 49                	je     800bd4 <pgfault+0x65>
+    panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800b8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b8f:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  800b96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b9a:	48 8b 00             	mov    (%rax),%rax
+  800b9d:	49 89 d0             	mov    %rdx,%r8
+  800ba0:	48 89 c1             	mov    %rax,%rcx
+  800ba3:	48 b8 80 60 80 00 00 	movabs $0x806080,%rax
+  800baa:	00 00 00 
+  800bad:	48 89 c2             	mov    %rax,%rdx
+  800bb0:	be 62 00 00 00       	mov    $0x62,%esi
+  800bb5:	48 b8 b3 60 80 00 00 	movabs $0x8060b3,%rax
+  800bbc:	00 00 00 
+  800bbf:	48 89 c7             	mov    %rax,%rdi
+  800bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc7:	49 b9 dd 0f 80 00 00 	movabs $0x800fdd,%r9
+  800bce:	00 00 00 
+  800bd1:	41 ff d1             	call   *%r9
+          (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+  // Check registers in UTrapframe
+  during.regs   = utf->utf_regs;
+  800bd4:	48 ba a0 80 80 00 00 	movabs $0x8080a0,%rdx
+  800bdb:	00 00 00 
+  800bde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800be2:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  800be6:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  800bea:	48 89 0a             	mov    %rcx,(%rdx)
+  800bed:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  800bf1:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  800bf5:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  800bf9:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+  800bfd:	48 89 5a 18          	mov    %rbx,0x18(%rdx)
+  800c01:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  800c05:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  800c09:	48 89 4a 20          	mov    %rcx,0x20(%rdx)
+  800c0d:	48 89 5a 28          	mov    %rbx,0x28(%rdx)
+  800c11:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  800c15:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  800c19:	48 89 4a 30          	mov    %rcx,0x30(%rdx)
+  800c1d:	48 89 5a 38          	mov    %rbx,0x38(%rdx)
+  800c21:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  800c25:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  800c29:	48 89 4a 40          	mov    %rcx,0x40(%rdx)
+  800c2d:	48 89 5a 48          	mov    %rbx,0x48(%rdx)
+  800c31:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  800c35:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  800c39:	48 89 4a 50          	mov    %rcx,0x50(%rdx)
+  800c3d:	48 89 5a 58          	mov    %rbx,0x58(%rdx)
+  800c41:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  800c45:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  800c49:	48 89 4a 60          	mov    %rcx,0x60(%rdx)
+  800c4d:	48 89 5a 68          	mov    %rbx,0x68(%rdx)
+  800c51:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  800c58:	48 89 42 70          	mov    %rax,0x70(%rdx)
+  during.rip    = utf->utf_rip;
+  800c5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c60:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  800c67:	48 ba a0 80 80 00 00 	movabs $0x8080a0,%rdx
+  800c6e:	00 00 00 
+  800c71:	48 89 42 78          	mov    %rax,0x78(%rdx)
+  during.rflags = utf->utf_rflags & 0xfff;
+  800c75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c79:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  800c80:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800c85:	48 89 c2             	mov    %rax,%rdx
+  800c88:	48 b8 a0 80 80 00 00 	movabs $0x8080a0,%rax
+  800c8f:	00 00 00 
+  800c92:	48 89 90 80 00 00 00 	mov    %rdx,0x80(%rax)
+  during.rsp    = utf->utf_rsp;
+  800c99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c9d:	48 8b 80 98 00 00 00 	mov    0x98(%rax),%rax
+  800ca4:	48 ba a0 80 80 00 00 	movabs $0x8080a0,%rdx
+  800cab:	00 00 00 
+  800cae:	48 89 82 88 00 00 00 	mov    %rax,0x88(%rdx)
+  check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800cb5:	49 b8 c4 60 80 00 00 	movabs $0x8060c4,%r8
+  800cbc:	00 00 00 
+  800cbf:	48 b8 d2 60 80 00 00 	movabs $0x8060d2,%rax
+  800cc6:	00 00 00 
+  800cc9:	48 89 c1             	mov    %rax,%rcx
+  800ccc:	48 b8 a0 80 80 00 00 	movabs $0x8080a0,%rax
+  800cd3:	00 00 00 
+  800cd6:	48 89 c2             	mov    %rax,%rdx
+  800cd9:	48 b8 d9 60 80 00 00 	movabs $0x8060d9,%rax
+  800ce0:	00 00 00 
+  800ce3:	48 89 c6             	mov    %rax,%rsi
+  800ce6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800ced:	00 00 00 
+  800cf0:	48 89 c7             	mov    %rax,%rdi
+  800cf3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800cfa:	00 00 00 
+  800cfd:	ff d0                	call   *%rax
+  ;
+
+  // Map UTEMP so the write succeeds
+  if ((r = sys_page_alloc(0, UTEMP, PTE_U | PTE_P | PTE_W)) < 0)
+  800cff:	ba 07 00 00 00       	mov    $0x7,%edx
+  800d04:	be 00 00 40 00       	mov    $0x400000,%esi
+  800d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d0e:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  800d15:	00 00 00 
+  800d18:	ff d0                	call   *%rax
+  800d1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800d1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800d21:	79 36                	jns    800d59 <pgfault+0x1ea>
+    panic("sys_page_alloc: %i", r);
+  800d23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d26:	89 c1                	mov    %eax,%ecx
+  800d28:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800d2f:	00 00 00 
+  800d32:	48 89 c2             	mov    %rax,%rdx
+  800d35:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800d3a:	48 b8 b3 60 80 00 00 	movabs $0x8060b3,%rax
+  800d41:	00 00 00 
+  800d44:	48 89 c7             	mov    %rax,%rdi
+  800d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4c:	49 b8 dd 0f 80 00 00 	movabs $0x800fdd,%r8
+  800d53:	00 00 00 
+  800d56:	41 ff d0             	call   *%r8
+}
+  800d59:	90                   	nop
+  800d5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d5e:	c9                   	leave
+  800d5f:	c3                   	ret
+
+0000000000800d60 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800d60:	55                   	push   %rbp
+  800d61:	48 89 e5             	mov    %rsp,%rbp
+  800d64:	48 83 ec 10          	sub    $0x10,%rsp
+  800d68:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  set_pgfault_handler(pgfault);
+  800d6f:	48 b8 6f 0b 80 00 00 	movabs $0x800b6f,%rax
+  800d76:	00 00 00 
+  800d79:	48 89 c7             	mov    %rax,%rdi
+  800d7c:	48 b8 61 36 80 00 00 	movabs $0x803661,%rax
+  800d83:	00 00 00 
+  800d86:	ff d0                	call   *%rax
+
+  __asm __volatile(
+  800d88:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800d8f:	00 00 00 
+  800d92:	48 ba 40 81 80 00 00 	movabs $0x808140,%rdx
+  800d99:	00 00 00 
+  800d9c:	50                   	push   %rax
+  800d9d:	52                   	push   %rdx
+  800d9e:	50                   	push   %rax
+  800d9f:	9c                   	pushf
+  800da0:	58                   	pop    %rax
+  800da1:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800da7:	50                   	push   %rax
+  800da8:	9d                   	popf
+  800da9:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800dae:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800db5:	48 8d 04 25 01 0e 80 	lea    0x800e01,%rax
+  800dbc:	00 
+  800dbd:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800dc1:	58                   	pop    %rax
+  800dc2:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800dc6:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800dca:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800dce:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800dd2:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800dd6:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800dda:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800dde:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800de2:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800de6:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800dea:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800dee:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800df2:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800df6:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800dfa:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800e01:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800e08:	2a 00 00 00 
+  800e0c:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800e10:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800e14:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800e18:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800e1c:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800e20:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800e24:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800e28:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800e2c:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800e30:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800e34:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800e38:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800e3c:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800e40:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800e44:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800e48:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800e4f:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800e54:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800e58:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800e5c:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800e60:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800e64:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800e68:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800e6c:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800e70:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800e74:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800e78:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800e7c:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800e80:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800e84:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800e88:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800e8c:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800e93:	50                   	push   %rax
+  800e94:	9c                   	pushf
+  800e95:	58                   	pop    %rax
+  800e96:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800e9b:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800ea2:	58                   	pop    %rax
+      : "memory", "cc");
+
+  // Check UTEMP to roughly determine that EIP was restored
+  // correctly (of course, we probably wouldn't get this far if
+  // it weren't)
+  if (*(int *)UTEMP != 42)
+  800ea3:	b8 00 00 40 00       	mov    $0x400000,%eax
+  800ea8:	8b 00                	mov    (%rax),%eax
+  800eaa:	83 f8 2a             	cmp    $0x2a,%eax
+  800ead:	74 1e                	je     800ecd <umain+0x16d>
+    cprintf("RIP after page-fault MISMATCH\n");
+  800eaf:	48 b8 f8 60 80 00 00 	movabs $0x8060f8,%rax
+  800eb6:	00 00 00 
+  800eb9:	48 89 c7             	mov    %rax,%rdi
+  800ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec1:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  800ec8:	00 00 00 
+  800ecb:	ff d2                	call   *%rdx
+  after.rip = before.rip;
+  800ecd:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800ed4:	00 00 00 
+  800ed7:	48 8b 40 78          	mov    0x78(%rax),%rax
+  800edb:	48 ba 40 81 80 00 00 	movabs $0x808140,%rdx
+  800ee2:	00 00 00 
+  800ee5:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+  check_regs(&before, "before", &after, "after", "after page-fault");
+  800ee9:	49 b8 17 61 80 00 00 	movabs $0x806117,%r8
+  800ef0:	00 00 00 
+  800ef3:	48 b8 28 61 80 00 00 	movabs $0x806128,%rax
+  800efa:	00 00 00 
+  800efd:	48 89 c1             	mov    %rax,%rcx
+  800f00:	48 b8 40 81 80 00 00 	movabs $0x808140,%rax
+  800f07:	00 00 00 
+  800f0a:	48 89 c2             	mov    %rax,%rdx
+  800f0d:	48 b8 d9 60 80 00 00 	movabs $0x8060d9,%rax
+  800f14:	00 00 00 
+  800f17:	48 89 c6             	mov    %rax,%rsi
+  800f1a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800f21:	00 00 00 
+  800f24:	48 89 c7             	mov    %rax,%rdi
+  800f27:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800f2e:	00 00 00 
+  800f31:	ff d0                	call   *%rax
+}
+  800f33:	90                   	nop
+  800f34:	c9                   	leave
+  800f35:	c3                   	ret
+
+0000000000800f36 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800f36:	55                   	push   %rbp
+  800f37:	48 89 e5             	mov    %rsp,%rbp
+  800f3a:	48 83 ec 20          	sub    $0x20,%rsp
+  800f3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800f41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800f45:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800f4c:	00 00 00 
+  800f4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800f53:	eb 13                	jmp    800f68 <libmain+0x32>
+    (*ctor)();
+  800f55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f59:	48 8b 10             	mov    (%rax),%rdx
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f61:	ff d2                	call   *%rdx
+    ctor++;
+  800f63:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800f68:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800f6f:	00 00 00 
+  800f72:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800f76:	72 dd                	jb     800f55 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800f78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800f7c:	7e 14                	jle    800f92 <libmain+0x5c>
+    binaryname = argv[0];
+  800f7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f82:	48 8b 00             	mov    (%rax),%rax
+  800f85:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800f8c:	00 00 00 
+  800f8f:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800f92:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f99:	48 89 d6             	mov    %rdx,%rsi
+  800f9c:	89 c7                	mov    %eax,%edi
+  800f9e:	48 b8 60 0d 80 00 00 	movabs $0x800d60,%rax
+  800fa5:	00 00 00 
+  800fa8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800faa:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  800fb1:	00 00 00 
+  800fb4:	ff d0                	call   *%rax
+#endif
+}
+  800fb6:	90                   	nop
+  800fb7:	c9                   	leave
+  800fb8:	c3                   	ret
+
+0000000000800fb9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800fb9:	55                   	push   %rbp
+  800fba:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800fbd:	48 b8 b7 3b 80 00 00 	movabs $0x803bb7,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fce:	48 b8 32 2e 80 00 00 	movabs $0x802e32,%rax
+  800fd5:	00 00 00 
+  800fd8:	ff d0                	call   *%rax
+}
+  800fda:	90                   	nop
+  800fdb:	5d                   	pop    %rbp
+  800fdc:	c3                   	ret
+
+0000000000800fdd <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800fdd:	55                   	push   %rbp
+  800fde:	48 89 e5             	mov    %rsp,%rbp
+  800fe1:	53                   	push   %rbx
+  800fe2:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800fe9:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800ff0:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800ff6:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800ffd:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  801004:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80100b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  801012:	84 c0                	test   %al,%al
+  801014:	74 23                	je     801039 <_panic+0x5c>
+  801016:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80101d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  801021:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  801025:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  801029:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80102d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  801031:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  801035:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801039:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  801040:	00 00 00 
+  801043:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80104a:	00 00 00 
+  80104d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801051:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  801058:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80105f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  801066:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80106d:	00 00 00 
+  801070:	48 8b 18             	mov    (%rax),%rbx
+  801073:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  80107a:	00 00 00 
+  80107d:	ff d0                	call   *%rax
+  80107f:	89 c6                	mov    %eax,%esi
+  801081:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  801087:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80108e:	41 89 d0             	mov    %edx,%r8d
+  801091:	48 89 c1             	mov    %rax,%rcx
+  801094:	48 89 da             	mov    %rbx,%rdx
+  801097:	48 b8 38 61 80 00 00 	movabs $0x806138,%rax
+  80109e:	00 00 00 
+  8010a1:	48 89 c7             	mov    %rax,%rdi
+  8010a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a9:	49 b9 fc 11 80 00 00 	movabs $0x8011fc,%r9
+  8010b0:	00 00 00 
+  8010b3:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8010b6:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8010bd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8010c4:	48 89 d6             	mov    %rdx,%rsi
+  8010c7:	48 89 c7             	mov    %rax,%rdi
+  8010ca:	48 b8 71 11 80 00 00 	movabs $0x801171,%rax
+  8010d1:	00 00 00 
+  8010d4:	ff d0                	call   *%rax
+  cprintf("\n");
+  8010d6:	48 b8 5b 61 80 00 00 	movabs $0x80615b,%rax
+  8010dd:	00 00 00 
+  8010e0:	48 89 c7             	mov    %rax,%rdi
+  8010e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e8:	48 ba fc 11 80 00 00 	movabs $0x8011fc,%rdx
+  8010ef:	00 00 00 
+  8010f2:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8010f4:	cc                   	int3
+  8010f5:	eb fd                	jmp    8010f4 <_panic+0x117>
+
+00000000008010f7 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8010f7:	55                   	push   %rbp
+  8010f8:	48 89 e5             	mov    %rsp,%rbp
+  8010fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8010ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801102:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  801106:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80110a:	8b 00                	mov    (%rax),%eax
+  80110c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80110f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801113:	89 0a                	mov    %ecx,(%rdx)
+  801115:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801118:	89 d1                	mov    %edx,%ecx
+  80111a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80111e:	48 98                	cltq
+  801120:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  801124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801128:	8b 00                	mov    (%rax),%eax
+  80112a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80112f:	75 2c                	jne    80115d <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  801131:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801135:	8b 00                	mov    (%rax),%eax
+  801137:	48 98                	cltq
+  801139:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80113d:	48 83 c2 08          	add    $0x8,%rdx
+  801141:	48 89 c6             	mov    %rax,%rsi
+  801144:	48 89 d7             	mov    %rdx,%rdi
+  801147:	48 b8 63 2d 80 00 00 	movabs $0x802d63,%rax
+  80114e:	00 00 00 
+  801151:	ff d0                	call   *%rax
+    b->idx = 0;
+  801153:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801157:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80115d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801161:	8b 40 04             	mov    0x4(%rax),%eax
+  801164:	8d 50 01             	lea    0x1(%rax),%edx
+  801167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80116e:	90                   	nop
+  80116f:	c9                   	leave
+  801170:	c3                   	ret
+
+0000000000801171 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801171:	55                   	push   %rbp
+  801172:	48 89 e5             	mov    %rsp,%rbp
+  801175:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80117c:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  801183:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80118a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  801191:	00 00 00 
+  b.cnt = 0;
+  801194:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80119b:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80119e:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8011a5:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8011ac:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8011b3:	48 89 c6             	mov    %rax,%rsi
+  8011b6:	48 b8 f7 10 80 00 00 	movabs $0x8010f7,%rax
+  8011bd:	00 00 00 
+  8011c0:	48 89 c7             	mov    %rax,%rdi
+  8011c3:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  8011ca:	00 00 00 
+  8011cd:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8011cf:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8011d5:	48 98                	cltq
+  8011d7:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8011de:	48 83 c2 08          	add    $0x8,%rdx
+  8011e2:	48 89 c6             	mov    %rax,%rsi
+  8011e5:	48 89 d7             	mov    %rdx,%rdi
+  8011e8:	48 b8 63 2d 80 00 00 	movabs $0x802d63,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8011f4:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8011fa:	c9                   	leave
+  8011fb:	c3                   	ret
+
+00000000008011fc <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8011fc:	55                   	push   %rbp
+  8011fd:	48 89 e5             	mov    %rsp,%rbp
+  801200:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  801207:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80120e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  801215:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80121c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801223:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80122a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801231:	84 c0                	test   %al,%al
+  801233:	74 20                	je     801255 <cprintf+0x59>
+  801235:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801239:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80123d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801241:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801245:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801249:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80124d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801251:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  801255:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80125c:	00 00 00 
+  80125f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801266:	00 00 00 
+  801269:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80126d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801274:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80127b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  801282:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  801289:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801290:	48 89 d6             	mov    %rdx,%rsi
+  801293:	48 89 c7             	mov    %rax,%rdi
+  801296:	48 b8 71 11 80 00 00 	movabs $0x801171,%rax
+  80129d:	00 00 00 
+  8012a0:	ff d0                	call   *%rax
+  8012a2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8012a8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012ae:	c9                   	leave
+  8012af:	c3                   	ret
+
+00000000008012b0 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8012b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8012c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012c4:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8012c7:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8012cb:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8012cf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012d2:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8012d6:	72 54                	jb     80132c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8012d8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8012db:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8012de:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8012e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ea:	48 f7 f6             	div    %rsi
+  8012ed:	49 89 c2             	mov    %rax,%r10
+  8012f0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8012f3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8012f6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8012fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012fe:	41 89 c9             	mov    %ecx,%r9d
+  801301:	41 89 f8             	mov    %edi,%r8d
+  801304:	89 d1                	mov    %edx,%ecx
+  801306:	4c 89 d2             	mov    %r10,%rdx
+  801309:	48 89 c7             	mov    %rax,%rdi
+  80130c:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  801313:	00 00 00 
+  801316:	ff d0                	call   *%rax
+  801318:	eb 1c                	jmp    801336 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80131a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80131e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801321:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801325:	48 89 d6             	mov    %rdx,%rsi
+  801328:	89 c7                	mov    %eax,%edi
+  80132a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80132c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  801330:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801334:	7f e4                	jg     80131a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  801336:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801339:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80133d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801342:	48 f7 f1             	div    %rcx
+  801345:	48 b8 90 63 80 00 00 	movabs $0x806390,%rax
+  80134c:	00 00 00 
+  80134f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  801353:	0f be c0             	movsbl %al,%eax
+  801356:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80135a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80135e:	48 89 d6             	mov    %rdx,%rsi
+  801361:	89 c7                	mov    %eax,%edi
+  801363:	ff d1                	call   *%rcx
+}
+  801365:	90                   	nop
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+
+0000000000801368 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	48 83 ec 10          	sub    $0x10,%rsp
+  801370:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801374:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  801377:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80137b:	7e 4b                	jle    8013c8 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80137d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801381:	8b 00                	mov    (%rax),%eax
+  801383:	83 f8 2f             	cmp    $0x2f,%eax
+  801386:	77 24                	ja     8013ac <getuint+0x44>
+  801388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801390:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801394:	8b 00                	mov    (%rax),%eax
+  801396:	89 c0                	mov    %eax,%eax
+  801398:	48 01 d0             	add    %rdx,%rax
+  80139b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80139f:	8b 12                	mov    (%rdx),%edx
+  8013a1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013a8:	89 0a                	mov    %ecx,(%rdx)
+  8013aa:	eb 14                	jmp    8013c0 <getuint+0x58>
+  8013ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013b4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013bc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013c0:	48 8b 00             	mov    (%rax),%rax
+  8013c3:	e9 95 00 00 00       	jmp    80145d <getuint+0xf5>
+  else if (lflag)
+  8013c8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8013cc:	74 48                	je     801416 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8013ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013d2:	8b 00                	mov    (%rax),%eax
+  8013d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8013d7:	77 24                	ja     8013fd <getuint+0x95>
+  8013d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013dd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013e5:	8b 00                	mov    (%rax),%eax
+  8013e7:	89 c0                	mov    %eax,%eax
+  8013e9:	48 01 d0             	add    %rdx,%rax
+  8013ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013f0:	8b 12                	mov    (%rdx),%edx
+  8013f2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013f9:	89 0a                	mov    %ecx,(%rdx)
+  8013fb:	eb 14                	jmp    801411 <getuint+0xa9>
+  8013fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801401:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801405:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801409:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80140d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801411:	48 8b 00             	mov    (%rax),%rax
+  801414:	eb 47                	jmp    80145d <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  801416:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80141a:	8b 00                	mov    (%rax),%eax
+  80141c:	83 f8 2f             	cmp    $0x2f,%eax
+  80141f:	77 24                	ja     801445 <getuint+0xdd>
+  801421:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801425:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80142d:	8b 00                	mov    (%rax),%eax
+  80142f:	89 c0                	mov    %eax,%eax
+  801431:	48 01 d0             	add    %rdx,%rax
+  801434:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801438:	8b 12                	mov    (%rdx),%edx
+  80143a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80143d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801441:	89 0a                	mov    %ecx,(%rdx)
+  801443:	eb 14                	jmp    801459 <getuint+0xf1>
+  801445:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801449:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80144d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801451:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801455:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801459:	8b 00                	mov    (%rax),%eax
+  80145b:	89 c0                	mov    %eax,%eax
+}
+  80145d:	c9                   	leave
+  80145e:	c3                   	ret
+
+000000000080145f <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80145f:	55                   	push   %rbp
+  801460:	48 89 e5             	mov    %rsp,%rbp
+  801463:	48 83 ec 10          	sub    $0x10,%rsp
+  801467:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80146b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80146e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  801472:	7e 4b                	jle    8014bf <getint+0x60>
+    return va_arg(*ap, long long);
+  801474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801478:	8b 00                	mov    (%rax),%eax
+  80147a:	83 f8 2f             	cmp    $0x2f,%eax
+  80147d:	77 24                	ja     8014a3 <getint+0x44>
+  80147f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801483:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80148b:	8b 00                	mov    (%rax),%eax
+  80148d:	89 c0                	mov    %eax,%eax
+  80148f:	48 01 d0             	add    %rdx,%rax
+  801492:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801496:	8b 12                	mov    (%rdx),%edx
+  801498:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80149b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80149f:	89 0a                	mov    %ecx,(%rdx)
+  8014a1:	eb 14                	jmp    8014b7 <getint+0x58>
+  8014a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8014ab:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8014af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014b3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8014b7:	48 8b 00             	mov    (%rax),%rax
+  8014ba:	e9 95 00 00 00       	jmp    801554 <getint+0xf5>
+  else if (lflag)
+  8014bf:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8014c3:	74 48                	je     80150d <getint+0xae>
+    return va_arg(*ap, long);
+  8014c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c9:	8b 00                	mov    (%rax),%eax
+  8014cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ce:	77 24                	ja     8014f4 <getint+0x95>
+  8014d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8014d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014dc:	8b 00                	mov    (%rax),%eax
+  8014de:	89 c0                	mov    %eax,%eax
+  8014e0:	48 01 d0             	add    %rdx,%rax
+  8014e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014e7:	8b 12                	mov    (%rdx),%edx
+  8014e9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8014ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014f0:	89 0a                	mov    %ecx,(%rdx)
+  8014f2:	eb 14                	jmp    801508 <getint+0xa9>
+  8014f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8014fc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801500:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801504:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801508:	48 8b 00             	mov    (%rax),%rax
+  80150b:	eb 47                	jmp    801554 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80150d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801511:	8b 00                	mov    (%rax),%eax
+  801513:	83 f8 2f             	cmp    $0x2f,%eax
+  801516:	77 24                	ja     80153c <getint+0xdd>
+  801518:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80151c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801520:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801524:	8b 00                	mov    (%rax),%eax
+  801526:	89 c0                	mov    %eax,%eax
+  801528:	48 01 d0             	add    %rdx,%rax
+  80152b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80152f:	8b 12                	mov    (%rdx),%edx
+  801531:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801534:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801538:	89 0a                	mov    %ecx,(%rdx)
+  80153a:	eb 14                	jmp    801550 <getint+0xf1>
+  80153c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801540:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801544:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801548:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80154c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801550:	8b 00                	mov    (%rax),%eax
+  801552:	48 98                	cltq
+}
+  801554:	c9                   	leave
+  801555:	c3                   	ret
+
+0000000000801556 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	41 54                	push   %r12
+  80155c:	53                   	push   %rbx
+  80155d:	48 83 ec 60          	sub    $0x60,%rsp
+  801561:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801565:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801569:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80156d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  801571:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801575:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801579:	48 8b 06             	mov    (%rsi),%rax
+  80157c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801580:	48 89 01             	mov    %rax,(%rcx)
+  801583:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801587:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80158b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80158f:	eb 17                	jmp    8015a8 <vprintfmt+0x52>
+      if (ch == '\0')
+  801591:	85 db                	test   %ebx,%ebx
+  801593:	0f 84 bf 04 00 00    	je     801a58 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  801599:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80159d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8015a1:	48 89 c6             	mov    %rax,%rsi
+  8015a4:	89 df                	mov    %ebx,%edi
+  8015a6:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8015a8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8015ac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015b0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8015b4:	0f b6 00             	movzbl (%rax),%eax
+  8015b7:	0f b6 d8             	movzbl %al,%ebx
+  8015ba:	83 fb 25             	cmp    $0x25,%ebx
+  8015bd:	75 d2                	jne    801591 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8015bf:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8015c3:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8015ca:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8015d1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8015d8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8015df:	eb 04                	jmp    8015e5 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8015e1:	90                   	nop
+  8015e2:	eb 01                	jmp    8015e5 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8015e4:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8015e5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8015e9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015ed:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8015f1:	0f b6 00             	movzbl (%rax),%eax
+  8015f4:	0f b6 d8             	movzbl %al,%ebx
+  8015f7:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8015fa:	83 f8 55             	cmp    $0x55,%eax
+  8015fd:	0f 87 22 04 00 00    	ja     801a25 <vprintfmt+0x4cf>
+  801603:	89 c0                	mov    %eax,%eax
+  801605:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80160c:	00 
+  80160d:	48 b8 b8 63 80 00 00 	movabs $0x8063b8,%rax
+  801614:	00 00 00 
+  801617:	48 01 d0             	add    %rdx,%rax
+  80161a:	48 8b 00             	mov    (%rax),%rax
+  80161d:	ff e0                	jmp    *%rax
+        padc = '-';
+  80161f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  801623:	eb c0                	jmp    8015e5 <vprintfmt+0x8f>
+        padc = '0';
+  801625:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  801629:	eb ba                	jmp    8015e5 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80162b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  801632:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801635:	89 d0                	mov    %edx,%eax
+  801637:	c1 e0 02             	shl    $0x2,%eax
+  80163a:	01 d0                	add    %edx,%eax
+  80163c:	01 c0                	add    %eax,%eax
+  80163e:	01 d8                	add    %ebx,%eax
+  801640:	83 e8 30             	sub    $0x30,%eax
+  801643:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  801646:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80164a:	0f b6 00             	movzbl (%rax),%eax
+  80164d:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  801650:	83 fb 2f             	cmp    $0x2f,%ebx
+  801653:	7e 60                	jle    8016b5 <vprintfmt+0x15f>
+  801655:	83 fb 39             	cmp    $0x39,%ebx
+  801658:	7f 5b                	jg     8016b5 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80165a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80165f:	eb d1                	jmp    801632 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  801661:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801664:	83 f8 2f             	cmp    $0x2f,%eax
+  801667:	77 17                	ja     801680 <vprintfmt+0x12a>
+  801669:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80166d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801670:	89 d2                	mov    %edx,%edx
+  801672:	48 01 d0             	add    %rdx,%rax
+  801675:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801678:	83 c2 08             	add    $0x8,%edx
+  80167b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80167e:	eb 0c                	jmp    80168c <vprintfmt+0x136>
+  801680:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801684:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801688:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80168c:	8b 00                	mov    (%rax),%eax
+  80168e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  801691:	eb 23                	jmp    8016b6 <vprintfmt+0x160>
+        if (width < 0)
+  801693:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801697:	0f 89 44 ff ff ff    	jns    8015e1 <vprintfmt+0x8b>
+          width = 0;
+  80169d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8016a4:	e9 38 ff ff ff       	jmp    8015e1 <vprintfmt+0x8b>
+        altflag = 1;
+  8016a9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8016b0:	e9 30 ff ff ff       	jmp    8015e5 <vprintfmt+0x8f>
+        goto process_precision;
+  8016b5:	90                   	nop
+        if (width < 0)
+  8016b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8016ba:	0f 89 24 ff ff ff    	jns    8015e4 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8016c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8016c3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8016c6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8016cd:	e9 12 ff ff ff       	jmp    8015e4 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8016d2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8016d6:	e9 0a ff ff ff       	jmp    8015e5 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8016db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016de:	83 f8 2f             	cmp    $0x2f,%eax
+  8016e1:	77 17                	ja     8016fa <vprintfmt+0x1a4>
+  8016e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016e7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8016ea:	89 d2                	mov    %edx,%edx
+  8016ec:	48 01 d0             	add    %rdx,%rax
+  8016ef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8016f2:	83 c2 08             	add    $0x8,%edx
+  8016f5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8016f8:	eb 0c                	jmp    801706 <vprintfmt+0x1b0>
+  8016fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8016fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801702:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801706:	8b 00                	mov    (%rax),%eax
+  801708:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80170c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801710:	48 89 d6             	mov    %rdx,%rsi
+  801713:	89 c7                	mov    %eax,%edi
+  801715:	ff d1                	call   *%rcx
+        break;
+  801717:	e9 37 03 00 00       	jmp    801a53 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80171c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80171f:	83 f8 2f             	cmp    $0x2f,%eax
+  801722:	77 17                	ja     80173b <vprintfmt+0x1e5>
+  801724:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801728:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80172b:	89 d2                	mov    %edx,%edx
+  80172d:	48 01 d0             	add    %rdx,%rax
+  801730:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801733:	83 c2 08             	add    $0x8,%edx
+  801736:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801739:	eb 0c                	jmp    801747 <vprintfmt+0x1f1>
+  80173b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80173f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801743:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801747:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  801749:	85 db                	test   %ebx,%ebx
+  80174b:	79 02                	jns    80174f <vprintfmt+0x1f9>
+          err = -err;
+  80174d:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80174f:	83 fb 15             	cmp    $0x15,%ebx
+  801752:	7f 16                	jg     80176a <vprintfmt+0x214>
+  801754:	48 ba e0 62 80 00 00 	movabs $0x8062e0,%rdx
+  80175b:	00 00 00 
+  80175e:	48 63 c3             	movslq %ebx,%rax
+  801761:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  801765:	4d 85 e4             	test   %r12,%r12
+  801768:	75 2e                	jne    801798 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80176a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80176e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801772:	89 d9                	mov    %ebx,%ecx
+  801774:	48 ba a1 63 80 00 00 	movabs $0x8063a1,%rdx
+  80177b:	00 00 00 
+  80177e:	48 89 c7             	mov    %rax,%rdi
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	49 b8 62 1a 80 00 00 	movabs $0x801a62,%r8
+  80178d:	00 00 00 
+  801790:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  801793:	e9 bb 02 00 00       	jmp    801a53 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  801798:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80179c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8017a0:	4c 89 e1             	mov    %r12,%rcx
+  8017a3:	48 ba aa 63 80 00 00 	movabs $0x8063aa,%rdx
+  8017aa:	00 00 00 
+  8017ad:	48 89 c7             	mov    %rax,%rdi
+  8017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b5:	49 b8 62 1a 80 00 00 	movabs $0x801a62,%r8
+  8017bc:	00 00 00 
+  8017bf:	41 ff d0             	call   *%r8
+        break;
+  8017c2:	e9 8c 02 00 00       	jmp    801a53 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8017c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8017cd:	77 17                	ja     8017e6 <vprintfmt+0x290>
+  8017cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017d3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8017d6:	89 d2                	mov    %edx,%edx
+  8017d8:	48 01 d0             	add    %rdx,%rax
+  8017db:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8017de:	83 c2 08             	add    $0x8,%edx
+  8017e1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8017e4:	eb 0c                	jmp    8017f2 <vprintfmt+0x29c>
+  8017e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8017ea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8017ee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8017f2:	4c 8b 20             	mov    (%rax),%r12
+  8017f5:	4d 85 e4             	test   %r12,%r12
+  8017f8:	75 0a                	jne    801804 <vprintfmt+0x2ae>
+          p = "(null)";
+  8017fa:	49 bc ad 63 80 00 00 	movabs $0x8063ad,%r12
+  801801:	00 00 00 
+        if (width > 0 && padc != '-')
+  801804:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801808:	7e 78                	jle    801882 <vprintfmt+0x32c>
+  80180a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80180e:	74 72                	je     801882 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801810:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801813:	48 98                	cltq
+  801815:	48 89 c6             	mov    %rax,%rsi
+  801818:	4c 89 e7             	mov    %r12,%rdi
+  80181b:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+  801827:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80182a:	eb 17                	jmp    801843 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80182c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801830:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801834:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801838:	48 89 d6             	mov    %rdx,%rsi
+  80183b:	89 c7                	mov    %eax,%edi
+  80183d:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80183f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801843:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801847:	7f e3                	jg     80182c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801849:	eb 37                	jmp    801882 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80184b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80184f:	74 1e                	je     80186f <vprintfmt+0x319>
+  801851:	83 fb 1f             	cmp    $0x1f,%ebx
+  801854:	7e 05                	jle    80185b <vprintfmt+0x305>
+  801856:	83 fb 7e             	cmp    $0x7e,%ebx
+  801859:	7e 14                	jle    80186f <vprintfmt+0x319>
+            putch('?', putdat);
+  80185b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80185f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801863:	48 89 c6             	mov    %rax,%rsi
+  801866:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80186b:	ff d2                	call   *%rdx
+  80186d:	eb 0f                	jmp    80187e <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80186f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801873:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801877:	48 89 c6             	mov    %rax,%rsi
+  80187a:	89 df                	mov    %ebx,%edi
+  80187c:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80187e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801882:	4c 89 e0             	mov    %r12,%rax
+  801885:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801889:	0f b6 00             	movzbl (%rax),%eax
+  80188c:	0f be d8             	movsbl %al,%ebx
+  80188f:	85 db                	test   %ebx,%ebx
+  801891:	74 28                	je     8018bb <vprintfmt+0x365>
+  801893:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801897:	78 b2                	js     80184b <vprintfmt+0x2f5>
+  801899:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80189d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8018a1:	79 a8                	jns    80184b <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8018a3:	eb 16                	jmp    8018bb <vprintfmt+0x365>
+          putch(' ', putdat);
+  8018a5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018a9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018ad:	48 89 c6             	mov    %rax,%rsi
+  8018b0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8018b5:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8018b7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8018bb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8018bf:	7f e4                	jg     8018a5 <vprintfmt+0x34f>
+        break;
+  8018c1:	e9 8d 01 00 00       	jmp    801a53 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8018c6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8018c9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8018cd:	89 d6                	mov    %edx,%esi
+  8018cf:	48 89 c7             	mov    %rax,%rdi
+  8018d2:	48 b8 5f 14 80 00 00 	movabs $0x80145f,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+  8018de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8018e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e6:	48 85 c0             	test   %rax,%rax
+  8018e9:	79 1d                	jns    801908 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8018eb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018ef:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018f3:	48 89 c6             	mov    %rax,%rsi
+  8018f6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8018fb:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8018fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801901:	48 f7 d8             	neg    %rax
+  801904:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  801908:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80190f:	e9 d2 00 00 00       	jmp    8019e6 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  801914:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801917:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80191b:	89 d6                	mov    %edx,%esi
+  80191d:	48 89 c7             	mov    %rax,%rdi
+  801920:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  801927:	00 00 00 
+  80192a:	ff d0                	call   *%rax
+  80192c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  801930:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801937:	e9 aa 00 00 00       	jmp    8019e6 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80193c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80193f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801943:	89 d6                	mov    %edx,%esi
+  801945:	48 89 c7             	mov    %rax,%rdi
+  801948:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+  801954:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  801958:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80195f:	e9 82 00 00 00       	jmp    8019e6 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  801964:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801968:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80196c:	48 89 c6             	mov    %rax,%rsi
+  80196f:	bf 30 00 00 00       	mov    $0x30,%edi
+  801974:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  801976:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80197a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80197e:	48 89 c6             	mov    %rax,%rsi
+  801981:	bf 78 00 00 00       	mov    $0x78,%edi
+  801986:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80198b:	83 f8 2f             	cmp    $0x2f,%eax
+  80198e:	77 17                	ja     8019a7 <vprintfmt+0x451>
+  801990:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801994:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801997:	89 d2                	mov    %edx,%edx
+  801999:	48 01 d0             	add    %rdx,%rax
+  80199c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80199f:	83 c2 08             	add    $0x8,%edx
+  8019a2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8019a5:	eb 0c                	jmp    8019b3 <vprintfmt+0x45d>
+  8019a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8019ab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8019af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8019b3:	48 8b 00             	mov    (%rax),%rax
+  8019b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8019ba:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8019c1:	eb 23                	jmp    8019e6 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8019c3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8019c6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8019ca:	89 d6                	mov    %edx,%esi
+  8019cc:	48 89 c7             	mov    %rax,%rdi
+  8019cf:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+  8019db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8019df:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8019e6:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8019eb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8019ee:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8019f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019f5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8019f9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019fd:	45 89 c1             	mov    %r8d,%r9d
+  801a00:	41 89 f8             	mov    %edi,%r8d
+  801a03:	48 89 c7             	mov    %rax,%rdi
+  801a06:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  801a0d:	00 00 00 
+  801a10:	ff d0                	call   *%rax
+        break;
+  801a12:	eb 3f                	jmp    801a53 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801a14:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a18:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801a1c:	48 89 c6             	mov    %rax,%rsi
+  801a1f:	89 df                	mov    %ebx,%edi
+  801a21:	ff d2                	call   *%rdx
+        break;
+  801a23:	eb 2e                	jmp    801a53 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801a25:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a29:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801a2d:	48 89 c6             	mov    %rax,%rsi
+  801a30:	bf 25 00 00 00       	mov    $0x25,%edi
+  801a35:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801a37:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801a3c:	eb 05                	jmp    801a43 <vprintfmt+0x4ed>
+  801a3e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801a43:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801a47:	48 83 e8 01          	sub    $0x1,%rax
+  801a4b:	0f b6 00             	movzbl (%rax),%eax
+  801a4e:	3c 25                	cmp    $0x25,%al
+  801a50:	75 ec                	jne    801a3e <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  801a52:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801a53:	e9 50 fb ff ff       	jmp    8015a8 <vprintfmt+0x52>
+        return;
+  801a58:	90                   	nop
+    }
+  }
+}
+  801a59:	48 83 c4 60          	add    $0x60,%rsp
+  801a5d:	5b                   	pop    %rbx
+  801a5e:	41 5c                	pop    %r12
+  801a60:	5d                   	pop    %rbp
+  801a61:	c3                   	ret
+
+0000000000801a62 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801a62:	55                   	push   %rbp
+  801a63:	48 89 e5             	mov    %rsp,%rbp
+  801a66:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801a6d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801a74:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801a7b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801a82:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801a89:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801a90:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801a97:	84 c0                	test   %al,%al
+  801a99:	74 20                	je     801abb <printfmt+0x59>
+  801a9b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801a9f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801aa3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801aa7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801aab:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801aaf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801ab3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801ab7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801abb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801ac2:	00 00 00 
+  801ac5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801acc:	00 00 00 
+  801acf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ad3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801ada:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801ae1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801ae8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801aef:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801af6:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801afd:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801b04:	48 89 c7             	mov    %rax,%rdi
+  801b07:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  801b0e:	00 00 00 
+  801b11:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801b13:	90                   	nop
+  801b14:	c9                   	leave
+  801b15:	c3                   	ret
+
+0000000000801b16 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	48 83 ec 10          	sub    $0x10,%rsp
+  801b1e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801b21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b29:	8b 40 10             	mov    0x10(%rax),%eax
+  801b2c:	8d 50 01             	lea    0x1(%rax),%edx
+  801b2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b33:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801b36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b3a:	48 8b 10             	mov    (%rax),%rdx
+  801b3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b41:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b45:	48 39 c2             	cmp    %rax,%rdx
+  801b48:	73 17                	jae    801b61 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4e:	48 8b 00             	mov    (%rax),%rax
+  801b51:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b59:	48 89 0a             	mov    %rcx,(%rdx)
+  801b5c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801b5f:	88 10                	mov    %dl,(%rax)
+}
+  801b61:	90                   	nop
+  801b62:	c9                   	leave
+  801b63:	c3                   	ret
+
+0000000000801b64 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801b64:	55                   	push   %rbp
+  801b65:	48 89 e5             	mov    %rsp,%rbp
+  801b68:	48 83 ec 40          	sub    $0x40,%rsp
+  801b6c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b70:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801b73:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b77:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801b7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b83:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b86:	48 98                	cltq
+  801b88:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b90:	48 01 d0             	add    %rdx,%rax
+  801b93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801b97:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801b9e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801ba3:	74 06                	je     801bab <vsnprintf+0x47>
+  801ba5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801ba9:	7f 07                	jg     801bb2 <vsnprintf+0x4e>
+    return -E_INVAL;
+  801bab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb0:	eb 32                	jmp    801be4 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801bb2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801bb6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bba:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801bbe:	48 89 c6             	mov    %rax,%rsi
+  801bc1:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801bc8:	00 00 00 
+  801bcb:	48 89 c7             	mov    %rax,%rdi
+  801bce:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  801bd5:	00 00 00 
+  801bd8:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801bda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bde:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801be1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801be4:	c9                   	leave
+  801be5:	c3                   	ret
+
+0000000000801be6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801be6:	55                   	push   %rbp
+  801be7:	48 89 e5             	mov    %rsp,%rbp
+  801bea:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801bf1:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801bf8:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801bfe:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801c05:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801c0c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801c13:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801c1a:	84 c0                	test   %al,%al
+  801c1c:	74 20                	je     801c3e <snprintf+0x58>
+  801c1e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801c22:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801c26:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801c2a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801c2e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801c32:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801c36:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801c3a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801c3e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801c45:	00 00 00 
+  801c48:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801c4f:	00 00 00 
+  801c52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c56:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801c5d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801c64:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801c6b:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801c72:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801c79:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801c7f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801c86:	48 89 c7             	mov    %rax,%rdi
+  801c89:	48 b8 64 1b 80 00 00 	movabs $0x801b64,%rax
+  801c90:	00 00 00 
+  801c93:	ff d0                	call   *%rax
+  801c95:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801c9b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	53                   	push   %rbx
+  801ca8:	48 83 ec 38          	sub    $0x38,%rsp
+  801cac:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801caf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801cb3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801cb7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801cbb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801cbf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc7:	89 d1                	mov    %edx,%ecx
+  801cc9:	0f a2                	cpuid
+  801ccb:	89 de                	mov    %ebx,%esi
+  801ccd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801cd0:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801cd3:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801cd6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801cd9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cde:	74 09                	je     801ce9 <cpuid+0x46>
+}
+  801ce0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801ce7:	89 10                	mov    %edx,(%rax)
+
+  801ce9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cee:	74 09                	je     801cf9 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801cf0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801cf7:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801cf9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801cfe:	74 09                	je     801d09 <cpuid+0x66>
+char *
+  801d00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d04:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801d07:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801d09:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801d0e:	74 09                	je     801d19 <cpuid+0x76>
+  for (; *s; s++)
+  801d10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d14:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801d17:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801d19:	90                   	nop
+  801d1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+0000000000801d20 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801d20:	55                   	push   %rbp
+  801d21:	48 89 e5             	mov    %rsp,%rbp
+  801d24:	48 83 ec 18          	sub    $0x18,%rsp
+  801d28:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d2e:	89 c1                	mov    %eax,%ecx
+  801d30:	0f 01 d0             	xgetbv
+  801d33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801d36:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801d39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d3c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801d3f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801d43:	48 09 d0             	or     %rdx,%rax
+#else
+  801d46:	c9                   	leave
+  801d47:	c3                   	ret
+
+0000000000801d48 <string_cpu>:
+string_cpu(void) {
+  801d48:	55                   	push   %rbp
+  801d49:	48 89 e5             	mov    %rsp,%rbp
+  801d4c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801d50:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801d57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801d5e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801d65:	00 00 00 
+  801d68:	8b 00                	mov    (%rax),%eax
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 11                	js     801d7f <string_cpu+0x37>
+    return string_features;
+  801d6e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801d75:	00 00 00 
+  801d78:	8b 00                	mov    (%rax),%eax
+  801d7a:	e9 df 00 00 00       	jmp    801e5e <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801d7f:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801d83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d93:	48 89 c6             	mov    %rax,%rsi
+  801d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9b:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801da7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801daa:	83 f8 06             	cmp    $0x6,%eax
+  801dad:	76 28                	jbe    801dd7 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801daf:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801db3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dbe:	48 89 c2             	mov    %rax,%rdx
+  801dc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc6:	bf 07 00 00 00       	mov    $0x7,%edi
+  801dcb:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  801dd2:	00 00 00 
+  801dd5:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801dd7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801dda:	25 00 02 00 00       	and    $0x200,%eax
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	74 04                	je     801de7 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801de3:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801de7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801deb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801df1:	48 89 c1             	mov    %rax,%rcx
+  801df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df9:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfe:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e03:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  801e0a:	00 00 00 
+  801e0d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801e0f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e12:	83 e0 20             	and    $0x20,%eax
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	74 2a                	je     801e43 <string_cpu+0xfb>
+  801e19:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801e1c:	25 00 00 00 08       	and    $0x8000000,%eax
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	74 1e                	je     801e43 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801e25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e2a:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+  801e36:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801e39:	48 83 f8 06          	cmp    $0x6,%rax
+  801e3d:	75 04                	jne    801e43 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801e3f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801e43:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801e4a:	00 00 00 
+  801e4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e50:	89 02                	mov    %eax,(%rdx)
+  801e52:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801e59:	00 00 00 
+  801e5c:	8b 00                	mov    (%rax),%eax
+}
+  801e5e:	c9                   	leave
+  801e5f:	c3                   	ret
+
+0000000000801e60 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801e60:	55                   	push   %rbp
+  801e61:	48 89 e5             	mov    %rsp,%rbp
+  801e64:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801e68:	48 83 ec 60          	sub    $0x60,%rsp
+  801e6c:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801e71:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801e76:	83 e0 1f             	and    $0x1f,%eax
+  801e79:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801e7d:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801e81:	48 f7 d8             	neg    %rax
+  801e84:	48 89 c2             	mov    %rax,%rdx
+  801e87:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801e8c:	48 01 d0             	add    %rdx,%rax
+  801e8f:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801e94:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801e98:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801e9e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801ea3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801ea7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801ead:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801eb1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801eb5:	89 c2                	mov    %eax,%edx
+  801eb7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801ebb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801ec0:	89 c1                	mov    %eax,%ecx
+  801ec2:	d3 e6                	shl    %cl,%esi
+  801ec4:	89 f0                	mov    %esi,%eax
+  801ec6:	21 d0                	and    %edx,%eax
+  801ec8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801ecc:	eb 21                	jmp    801eef <strlen_avx2+0x8f>
+    p += 32;
+  801ece:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801ed4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801ed9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801edd:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801ee3:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801ee7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801eeb:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801eef:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801ef4:	74 d8                	je     801ece <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801ef6:	31 c0                	xor    %eax,%eax
+  801ef8:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801efe:	48 63 d0             	movslq %eax,%rdx
+  801f01:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801f06:	48 01 d0             	add    %rdx,%rax
+  801f09:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801f0e:	c9                   	leave
+  801f0f:	c3                   	ret
+
+0000000000801f10 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801f18:	48 83 ec 40          	sub    $0x40,%rsp
+  801f1c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801f21:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801f26:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801f2b:	eb 77                	jmp    801fa4 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801f2d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f32:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801f36:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801f3a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801f3f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801f43:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801f47:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801f4b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801f4f:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801f54:	74 3c                	je     801f92 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801f56:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801f5a:	f7 d0                	not    %eax
+  801f5c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801f60:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801f64:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801f68:	48 63 d0             	movslq %eax,%rdx
+  801f6b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f70:	48 01 d0             	add    %rdx,%rax
+  801f73:	0f b6 00             	movzbl (%rax),%eax
+  801f76:	0f b6 c0             	movzbl %al,%eax
+  801f79:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801f7d:	48 63 ca             	movslq %edx,%rcx
+  801f80:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801f85:	48 01 ca             	add    %rcx,%rdx
+  801f88:	0f b6 12             	movzbl (%rdx),%edx
+  801f8b:	0f b6 d2             	movzbl %dl,%edx
+  801f8e:	29 d0                	sub    %edx,%eax
+  801f90:	eb 6b                	jmp    801ffd <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801f92:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801f98:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801f9e:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801fa4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801faa:	77 81                	ja     801f2d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801fac:	eb 42                	jmp    801ff0 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801fae:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801fb3:	0f b6 10             	movzbl (%rax),%edx
+  801fb6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801fbb:	0f b6 00             	movzbl (%rax),%eax
+  801fbe:	38 c2                	cmp    %al,%dl
+  801fc0:	74 1c                	je     801fde <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801fc2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801fc7:	0f b6 00             	movzbl (%rax),%eax
+  801fca:	0f b6 c8             	movzbl %al,%ecx
+  801fcd:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801fd2:	0f b6 00             	movzbl (%rax),%eax
+  801fd5:	0f b6 d0             	movzbl %al,%edx
+  801fd8:	89 c8                	mov    %ecx,%eax
+  801fda:	29 d0                	sub    %edx,%eax
+  801fdc:	eb 1f                	jmp    801ffd <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801fde:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801fe4:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801fea:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801ff0:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801ff6:	75 b6                	jne    801fae <memcmp_avx2+0x9e>
+  return 0;
+  801ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+0000000000801fff <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+  802003:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  802007:	48 83 ec 60          	sub    $0x60,%rsp
+  80200b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  802010:	89 f0                	mov    %esi,%eax
+  802012:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  802017:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80201b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  802020:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  802024:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  802029:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80202f:	eb 47                	jmp    802078 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  802031:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  802036:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80203a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80203e:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  802044:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  802048:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80204c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  802050:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  802055:	74 15                	je     80206c <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  802057:	31 c0                	xor    %eax,%eax
+  802059:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80205f:	48 63 d0             	movslq %eax,%rdx
+  802062:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  802067:	48 01 d0             	add    %rdx,%rax
+  80206a:	eb 3d                	jmp    8020a9 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80206c:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  802072:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  802078:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80207e:	77 b1                	ja     802031 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  802080:	eb 0c                	jmp    80208e <memfind_avx2+0x8f>
+  802082:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  802088:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80208e:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  802094:	74 0e                	je     8020a4 <memfind_avx2+0xa5>
+  802096:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80209b:	0f b6 00             	movzbl (%rax),%eax
+  80209e:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8020a2:	75 de                	jne    802082 <memfind_avx2+0x83>
+  return s;
+  8020a4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8020a9:	c9                   	leave
+  8020aa:	c3                   	ret
+
+00000000008020ab <strlen>:
+strlen(const char *s) {
+  8020ab:	55                   	push   %rbp
+  8020ac:	48 89 e5             	mov    %rsp,%rbp
+  8020af:	48 83 ec 40          	sub    $0x40,%rsp
+  8020b3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8020b7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8020bb:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8020bf:	48 b8 48 1d 80 00 00 	movabs $0x801d48,%rax
+  8020c6:	00 00 00 
+  8020c9:	ff d0                	call   *%rax
+  8020cb:	83 e0 02             	and    $0x2,%eax
+  8020ce:	85 c0                	test   %eax,%eax
+  8020d0:	74 18                	je     8020ea <strlen+0x3f>
+    return strlen_avx2(s);
+  8020d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d6:	48 89 c7             	mov    %rax,%rdi
+  8020d9:	48 b8 60 1e 80 00 00 	movabs $0x801e60,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	e9 82 00 00 00       	jmp    80216c <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8020ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ee:	83 e0 0f             	and    $0xf,%eax
+  8020f1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8020f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8020f7:	48 f7 d8             	neg    %rax
+  8020fa:	48 89 c2             	mov    %rax,%rdx
+  8020fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802101:	48 01 d0             	add    %rdx,%rax
+  802104:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  802108:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80210c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802110:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  802115:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802119:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80211d:	89 c2                	mov    %eax,%edx
+  80211f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802122:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  802127:	89 c1                	mov    %eax,%ecx
+  802129:	d3 e6                	shl    %cl,%esi
+  80212b:	89 f0                	mov    %esi,%eax
+  80212d:	21 d0                	and    %edx,%eax
+  80212f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802132:	eb 1d                	jmp    802151 <strlen+0xa6>
+    p += 16;
+  802134:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  802139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80213d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802141:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  802146:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80214a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80214e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802151:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802155:	74 dd                	je     802134 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  802157:	31 c0                	xor    %eax,%eax
+  802159:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80215e:	48 63 d0             	movslq %eax,%rdx
+  802161:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802165:	48 01 d0             	add    %rdx,%rax
+  802168:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+
+000000000080216e <strnlen>:
+strnlen(const char *s, size_t size) {
+  80216e:	55                   	push   %rbp
+  80216f:	48 89 e5             	mov    %rsp,%rbp
+  802172:	48 83 ec 20          	sub    $0x20,%rsp
+  802176:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80217a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80217e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802185:	eb 0e                	jmp    802195 <strnlen+0x27>
+    n++;
+  802187:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80218b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802190:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  802195:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80219a:	74 0b                	je     8021a7 <strnlen+0x39>
+  80219c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a0:	0f b6 00             	movzbl (%rax),%eax
+  8021a3:	84 c0                	test   %al,%al
+  8021a5:	75 e0                	jne    802187 <strnlen+0x19>
+  return n;
+  8021a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021aa:	c9                   	leave
+  8021ab:	c3                   	ret
+
+00000000008021ac <strcpy>:
+strcpy(char *dst, const char *src) {
+  8021ac:	55                   	push   %rbp
+  8021ad:	48 89 e5             	mov    %rsp,%rbp
+  8021b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8021b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8021bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8021c4:	90                   	nop
+  8021c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8021c9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8021cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8021d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021d5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8021d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021dd:	0f b6 12             	movzbl (%rdx),%edx
+  8021e0:	88 10                	mov    %dl,(%rax)
+  8021e2:	0f b6 00             	movzbl (%rax),%eax
+  8021e5:	84 c0                	test   %al,%al
+  8021e7:	75 dc                	jne    8021c5 <strcpy+0x19>
+  return ret;
+  8021e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+00000000008021ef <strcat>:
+strcat(char *dst, const char *src) {
+  8021ef:	55                   	push   %rbp
+  8021f0:	48 89 e5             	mov    %rsp,%rbp
+  8021f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8021f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8021ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802203:	48 89 c7             	mov    %rax,%rdi
+  802206:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  80220d:	00 00 00 
+  802210:	ff d0                	call   *%rax
+  802212:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  802215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802218:	48 63 d0             	movslq %eax,%rdx
+  80221b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80221f:	48 01 c2             	add    %rax,%rdx
+  802222:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802226:	48 89 c6             	mov    %rax,%rsi
+  802229:	48 89 d7             	mov    %rdx,%rdi
+  80222c:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+  return dst;
+  802238:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80223c:	c9                   	leave
+  80223d:	c3                   	ret
+
+000000000080223e <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80223e:	55                   	push   %rbp
+  80223f:	48 89 e5             	mov    %rsp,%rbp
+  802242:	48 83 ec 28          	sub    $0x28,%rsp
+  802246:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80224a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80224e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  802252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802256:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80225a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802261:	00 
+  802262:	eb 2a                	jmp    80228e <strncpy+0x50>
+    *dst++ = *src;
+  802264:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802268:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80226c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802270:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802274:	0f b6 12             	movzbl (%rdx),%edx
+  802277:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  802279:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80227d:	0f b6 00             	movzbl (%rax),%eax
+  802280:	84 c0                	test   %al,%al
+  802282:	74 05                	je     802289 <strncpy+0x4b>
+      src++;
+  802284:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  802289:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80228e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802292:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802296:	72 cc                	jb     802264 <strncpy+0x26>
+  return ret;
+  802298:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+000000000080229e <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80229e:	55                   	push   %rbp
+  80229f:	48 89 e5             	mov    %rsp,%rbp
+  8022a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8022a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8022ae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8022b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8022ba:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8022bf:	74 3d                	je     8022fe <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8022c1:	eb 1d                	jmp    8022e0 <strlcpy+0x42>
+      *dst++ = *src++;
+  8022c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8022c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8022cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8022cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8022d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022db:	0f b6 12             	movzbl (%rdx),%edx
+  8022de:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8022e0:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8022e5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8022ea:	74 0b                	je     8022f7 <strlcpy+0x59>
+  8022ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022f0:	0f b6 00             	movzbl (%rax),%eax
+  8022f3:	84 c0                	test   %al,%al
+  8022f5:	75 cc                	jne    8022c3 <strlcpy+0x25>
+    *dst = '\0';
+  8022f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022fb:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8022fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802302:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  802306:	c9                   	leave
+  802307:	c3                   	ret
+
+0000000000802308 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802308:	55                   	push   %rbp
+  802309:	48 89 e5             	mov    %rsp,%rbp
+  80230c:	48 83 ec 30          	sub    $0x30,%rsp
+  802310:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802314:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802318:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80231c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802320:	48 89 c7             	mov    %rax,%rdi
+  802323:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  80232a:	00 00 00 
+  80232d:	ff d0                	call   *%rax
+  80232f:	48 98                	cltq
+  802331:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  802335:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802339:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80233d:	48 89 d6             	mov    %rdx,%rsi
+  802340:	48 89 c7             	mov    %rax,%rdi
+  802343:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+  80234f:	48 98                	cltq
+  802351:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  802355:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802359:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80235d:	75 10                	jne    80236f <strlcat+0x67>
+    return maxlen + srclen;
+  80235f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802363:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802367:	48 01 d0             	add    %rdx,%rax
+  80236a:	e9 86 00 00 00       	jmp    8023f5 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80236f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802373:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  802377:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80237b:	73 2b                	jae    8023a8 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80237d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802381:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802385:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802389:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80238d:	48 01 c1             	add    %rax,%rcx
+  802390:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802394:	48 89 c6             	mov    %rax,%rsi
+  802397:	48 89 cf             	mov    %rcx,%rdi
+  80239a:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	eb 42                	jmp    8023ea <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8023a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ac:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8023b0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023b8:	48 01 c1             	add    %rax,%rcx
+  8023bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023bf:	48 89 c6             	mov    %rax,%rsi
+  8023c2:	48 89 cf             	mov    %rcx,%rdi
+  8023c5:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8023d1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023d9:	48 01 d0             	add    %rdx,%rax
+  8023dc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8023e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023e4:	48 01 d0             	add    %rdx,%rax
+  8023e7:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8023ea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f2:	48 01 d0             	add    %rdx,%rax
+}
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+
+00000000008023f7 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8023f7:	55                   	push   %rbp
+  8023f8:	48 89 e5             	mov    %rsp,%rbp
+  8023fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802403:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  802407:	eb 0a                	jmp    802413 <strcmp+0x1c>
+    p++, q++;
+  802409:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80240e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  802413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802417:	0f b6 00             	movzbl (%rax),%eax
+  80241a:	84 c0                	test   %al,%al
+  80241c:	74 12                	je     802430 <strcmp+0x39>
+  80241e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802422:	0f b6 10             	movzbl (%rax),%edx
+  802425:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802429:	0f b6 00             	movzbl (%rax),%eax
+  80242c:	38 c2                	cmp    %al,%dl
+  80242e:	74 d9                	je     802409 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802430:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802434:	0f b6 00             	movzbl (%rax),%eax
+  802437:	0f b6 d0             	movzbl %al,%edx
+  80243a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80243e:	0f b6 00             	movzbl (%rax),%eax
+  802441:	0f b6 c0             	movzbl %al,%eax
+  802444:	29 c2                	sub    %eax,%edx
+  802446:	89 d0                	mov    %edx,%eax
+}
+  802448:	c9                   	leave
+  802449:	c3                   	ret
+
+000000000080244a <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80244a:	55                   	push   %rbp
+  80244b:	48 89 e5             	mov    %rsp,%rbp
+  80244e:	48 83 ec 18          	sub    $0x18,%rsp
+  802452:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802456:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80245a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80245e:	eb 0f                	jmp    80246f <strncmp+0x25>
+    n--, p++, q++;
+  802460:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  802465:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80246a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80246f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802474:	74 1d                	je     802493 <strncmp+0x49>
+  802476:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247a:	0f b6 00             	movzbl (%rax),%eax
+  80247d:	84 c0                	test   %al,%al
+  80247f:	74 12                	je     802493 <strncmp+0x49>
+  802481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802485:	0f b6 10             	movzbl (%rax),%edx
+  802488:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80248c:	0f b6 00             	movzbl (%rax),%eax
+  80248f:	38 c2                	cmp    %al,%dl
+  802491:	74 cd                	je     802460 <strncmp+0x16>
+  if (n == 0)
+  802493:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802498:	75 07                	jne    8024a1 <strncmp+0x57>
+    return 0;
+  80249a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249f:	eb 16                	jmp    8024b7 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a5:	0f b6 00             	movzbl (%rax),%eax
+  8024a8:	0f b6 d0             	movzbl %al,%edx
+  8024ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024af:	0f b6 00             	movzbl (%rax),%eax
+  8024b2:	0f b6 c0             	movzbl %al,%eax
+  8024b5:	29 c2                	sub    %eax,%edx
+}
+  8024b7:	89 d0                	mov    %edx,%eax
+  8024b9:	c9                   	leave
+  8024ba:	c3                   	ret
+
+00000000008024bb <strchr>:
+strchr(const char *s, char c) {
+  8024bb:	55                   	push   %rbp
+  8024bc:	48 89 e5             	mov    %rsp,%rbp
+  8024bf:	48 83 ec 60          	sub    $0x60,%rsp
+  8024c3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8024c7:	89 f0                	mov    %esi,%eax
+  8024c9:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8024cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024d0:	83 e0 0f             	and    $0xf,%eax
+  8024d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8024d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024d9:	48 f7 d8             	neg    %rax
+  8024dc:	48 89 c2             	mov    %rax,%rdx
+  8024df:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024e3:	48 01 d0             	add    %rdx,%rax
+  8024e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8024ea:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8024ee:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8024f2:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8024f6:	66 0f 6e c0          	movd   %eax,%xmm0
+  8024fa:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8024fe:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  802502:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802507:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80250b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80250f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802513:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  802517:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80251c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  802521:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802525:	89 c2                	mov    %eax,%edx
+  802527:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80252c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  802531:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802535:	09 c2                	or     %eax,%edx
+  802537:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80253a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80253f:	89 c1                	mov    %eax,%ecx
+  802541:	d3 e6                	shl    %cl,%esi
+  802543:	89 f0                	mov    %esi,%eax
+  802545:	21 d0                	and    %edx,%eax
+  802547:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80254a:	eb 34                	jmp    802580 <strchr+0xc5>
+    p += 16;
+  80254c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  802551:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802555:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802559:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80255d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802562:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  802567:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80256b:	89 c2                	mov    %eax,%edx
+  80256d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802572:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  802577:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80257b:	09 d0                	or     %edx,%eax
+  80257d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802580:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802584:	74 c6                	je     80254c <strchr+0x91>
+  p += __builtin_ctz(m);
+  802586:	31 c0                	xor    %eax,%eax
+  802588:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80258d:	48 98                	cltq
+  80258f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  802593:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802597:	0f b6 00             	movzbl (%rax),%eax
+  80259a:	84 c0                	test   %al,%al
+  80259c:	74 06                	je     8025a4 <strchr+0xe9>
+  80259e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025a2:	eb 05                	jmp    8025a9 <strchr+0xee>
+  8025a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a9:	c9                   	leave
+  8025aa:	c3                   	ret
+
+00000000008025ab <strfind>:
+strfind(const char *s, char c) {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+  8025af:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025b7:	89 f0                	mov    %esi,%eax
+  8025b9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8025bc:	eb 11                	jmp    8025cf <strfind+0x24>
+    if (*s == c)
+  8025be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c2:	0f b6 00             	movzbl (%rax),%eax
+  8025c5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8025c8:	74 12                	je     8025dc <strfind+0x31>
+  for (; *s; s++)
+  8025ca:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8025cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025d3:	0f b6 00             	movzbl (%rax),%eax
+  8025d6:	84 c0                	test   %al,%al
+  8025d8:	75 e4                	jne    8025be <strfind+0x13>
+  8025da:	eb 01                	jmp    8025dd <strfind+0x32>
+      break;
+  8025dc:	90                   	nop
+  return (char *)s;
+  8025dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+
+00000000008025e3 <memset>:
+memset(void *v, int c, size_t n) {
+  8025e3:	55                   	push   %rbp
+  8025e4:	48 89 e5             	mov    %rsp,%rbp
+  8025e7:	48 83 ec 38          	sub    $0x38,%rsp
+  8025eb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8025ef:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8025f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8025f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8025fe:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802603:	76 41                	jbe    802646 <memset+0x63>
+  802605:	48 b8 48 1d 80 00 00 	movabs $0x801d48,%rax
+  80260c:	00 00 00 
+  80260f:	ff d0                	call   *%rax
+  802611:	83 e0 01             	and    $0x1,%eax
+  802614:	85 c0                	test   %eax,%eax
+  802616:	74 2e                	je     802646 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  802618:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80261b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80261f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802623:	48 89 ce             	mov    %rcx,%rsi
+  802626:	48 89 f7             	mov    %rsi,%rdi
+  802629:	48 89 d1             	mov    %rdx,%rcx
+  80262c:	fc                   	cld
+  80262d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80262f:	48 89 ca             	mov    %rcx,%rdx
+  802632:	48 89 fe             	mov    %rdi,%rsi
+  802635:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  802639:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80263d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802641:	e9 a7 00 00 00       	jmp    8026ed <memset+0x10a>
+  if (n >= 8) {
+  802646:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80264b:	0f 86 87 00 00 00    	jbe    8026d8 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  802651:	eb 16                	jmp    802669 <memset+0x86>
+      *p++ = c;
+  802653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802657:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80265b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80265f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802662:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  802664:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80266d:	83 e0 07             	and    $0x7,%eax
+  802670:	48 85 c0             	test   %rax,%rax
+  802673:	75 de                	jne    802653 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  802675:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802678:	0f b6 c0             	movzbl %al,%eax
+  80267b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  802682:	01 01 01 
+  802685:	48 0f af c2          	imul   %rdx,%rax
+  802689:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80268d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802691:	48 c1 e8 03          	shr    $0x3,%rax
+  802695:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  802699:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80269d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8026a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8026a5:	48 89 ce             	mov    %rcx,%rsi
+  8026a8:	48 89 f7             	mov    %rsi,%rdi
+  8026ab:	48 89 d1             	mov    %rdx,%rcx
+  8026ae:	fc                   	cld
+  8026af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8026b2:	48 89 ca             	mov    %rcx,%rdx
+  8026b5:	48 89 fe             	mov    %rdi,%rsi
+  8026b8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8026bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8026c0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8026c5:	eb 11                	jmp    8026d8 <memset+0xf5>
+    *p++ = c;
+  8026c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026cb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8026cf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8026d3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8026d6:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8026d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026dc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8026e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026e4:	48 85 c0             	test   %rax,%rax
+  8026e7:	75 de                	jne    8026c7 <memset+0xe4>
+  return v;
+  8026e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+
+00000000008026ef <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8026ef:	55                   	push   %rbp
+  8026f0:	48 89 e5             	mov    %rsp,%rbp
+  8026f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8026f7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8026fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8026ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  802703:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802707:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80270b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80270f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  802713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802717:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80271b:	0f 83 da 00 00 00    	jae    8027fb <memmove+0x10c>
+  802721:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802725:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802729:	48 01 d0             	add    %rdx,%rax
+  80272c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802730:	0f 83 c5 00 00 00    	jae    8027fb <memmove+0x10c>
+    s += n;
+  802736:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80273a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80273e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802742:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  802746:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80274b:	0f 86 94 00 00 00    	jbe    8027e5 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  802751:	eb 1c                	jmp    80276f <memmove+0x80>
+        *--d = *--s;
+  802753:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802758:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80275d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802761:	0f b6 10             	movzbl (%rax),%edx
+  802764:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802768:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80276a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80276f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802773:	83 e0 07             	and    $0x7,%eax
+  802776:	48 85 c0             	test   %rax,%rax
+  802779:	75 d8                	jne    802753 <memmove+0x64>
+      nq = n / 8;
+  80277b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277f:	48 c1 e8 03          	shr    $0x3,%rax
+  802783:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  802787:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  80278c:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  802791:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  802796:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80279a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80279e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a2:	48 89 cf             	mov    %rcx,%rdi
+  8027a5:	48 89 d6             	mov    %rdx,%rsi
+  8027a8:	48 89 c1             	mov    %rax,%rcx
+  8027ab:	fd                   	std
+  8027ac:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027af:	fc                   	cld
+  8027b0:	48 89 c8             	mov    %rcx,%rax
+  8027b3:	48 89 f2             	mov    %rsi,%rdx
+  8027b6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8027ba:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8027be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8027c2:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8027c7:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8027cc:	eb 17                	jmp    8027e5 <memmove+0xf6>
+      *--d = *--s;
+  8027ce:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8027d3:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8027d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027dc:	0f b6 10             	movzbl (%rax),%edx
+  8027df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027e3:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8027e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027e9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8027ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027f1:	48 85 c0             	test   %rax,%rax
+  8027f4:	75 d8                	jne    8027ce <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8027f6:	e9 f4 00 00 00       	jmp    8028ef <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8027fb:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802800:	76 46                	jbe    802848 <memmove+0x159>
+  802802:	48 b8 48 1d 80 00 00 	movabs $0x801d48,%rax
+  802809:	00 00 00 
+  80280c:	ff d0                	call   *%rax
+  80280e:	83 e0 01             	and    $0x1,%eax
+  802811:	85 c0                	test   %eax,%eax
+  802813:	74 33                	je     802848 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  802815:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802819:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80281d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802821:	48 89 cf             	mov    %rcx,%rdi
+  802824:	48 89 d6             	mov    %rdx,%rsi
+  802827:	48 89 c1             	mov    %rax,%rcx
+  80282a:	fc                   	cld
+  80282b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80282d:	48 89 c8             	mov    %rcx,%rax
+  802830:	48 89 f2             	mov    %rsi,%rdx
+  802833:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802837:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80283b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80283f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802843:	e9 ab 00 00 00       	jmp    8028f3 <memmove+0x204>
+    if (n >= 8) {
+  802848:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80284d:	0f 86 8b 00 00 00    	jbe    8028de <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  802853:	eb 22                	jmp    802877 <memmove+0x188>
+        *d++ = *s++;
+  802855:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802859:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80285d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802861:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802865:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802869:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80286d:	0f b6 12             	movzbl (%rdx),%edx
+  802870:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  802872:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802877:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80287b:	83 e0 07             	and    $0x7,%eax
+  80287e:	48 85 c0             	test   %rax,%rax
+  802881:	75 d2                	jne    802855 <memmove+0x166>
+      nq = n / 8;
+  802883:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802887:	48 c1 e8 03          	shr    $0x3,%rax
+  80288b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80288f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802893:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80289b:	48 89 cf             	mov    %rcx,%rdi
+  80289e:	48 89 d6             	mov    %rdx,%rsi
+  8028a1:	48 89 c1             	mov    %rax,%rcx
+  8028a4:	fc                   	cld
+  8028a5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028a8:	48 89 c8             	mov    %rcx,%rax
+  8028ab:	48 89 f2             	mov    %rsi,%rdx
+  8028ae:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8028b2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8028b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8028ba:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8028bf:	eb 1d                	jmp    8028de <memmove+0x1ef>
+      *d++ = *s++;
+  8028c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028c5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8028c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8028cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8028d5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8028d9:	0f b6 12             	movzbl (%rdx),%edx
+  8028dc:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8028de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028e2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8028e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028ea:	48 85 c0             	test   %rax,%rax
+  8028ed:	75 d2                	jne    8028c1 <memmove+0x1d2>
+  return dst;
+  8028ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+00000000008028f5 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8028fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802901:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802905:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  802909:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80290d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802911:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802915:	48 89 ce             	mov    %rcx,%rsi
+  802918:	48 89 c7             	mov    %rax,%rdi
+  80291b:	48 b8 ef 26 80 00 00 	movabs $0x8026ef,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+}
+  802927:	c9                   	leave
+  802928:	c3                   	ret
+
+0000000000802929 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  802929:	55                   	push   %rbp
+  80292a:	48 89 e5             	mov    %rsp,%rbp
+  80292d:	48 83 ec 40          	sub    $0x40,%rsp
+  802931:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802935:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802939:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80293d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802941:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  802945:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802949:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80294d:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  802952:	0f 86 a7 00 00 00    	jbe    8029ff <memcmp+0xd6>
+  802958:	48 b8 48 1d 80 00 00 	movabs $0x801d48,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+  802964:	83 e0 02             	and    $0x2,%eax
+  802967:	85 c0                	test   %eax,%eax
+  802969:	0f 84 90 00 00 00    	je     8029ff <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80296f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802973:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80297b:	48 89 ce             	mov    %rcx,%rsi
+  80297e:	48 89 c7             	mov    %rax,%rdi
+  802981:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+  80298d:	e9 c2 00 00 00       	jmp    802a54 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  802992:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802996:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80299a:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80299e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029a2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8029a6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8029aa:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8029ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8029b1:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8029b8:	74 36                	je     8029f0 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8029ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029bd:	f7 d0                	not    %eax
+  8029bf:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8029c3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8029c6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8029c9:	48 63 d0             	movslq %eax,%rdx
+  8029cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d0:	48 01 d0             	add    %rdx,%rax
+  8029d3:	0f b6 00             	movzbl (%rax),%eax
+  8029d6:	0f b6 c0             	movzbl %al,%eax
+  8029d9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8029dc:	48 63 ca             	movslq %edx,%rcx
+  8029df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029e3:	48 01 ca             	add    %rcx,%rdx
+  8029e6:	0f b6 12             	movzbl (%rdx),%edx
+  8029e9:	0f b6 d2             	movzbl %dl,%edx
+  8029ec:	29 d0                	sub    %edx,%eax
+  8029ee:	eb 64                	jmp    802a54 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8029f0:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8029f5:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8029fa:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  8029ff:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802a04:	77 8c                	ja     802992 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802a06:	eb 36                	jmp    802a3e <memcmp+0x115>
+    if (*s1 != *s2)
+  802a08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a0c:	0f b6 10             	movzbl (%rax),%edx
+  802a0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a13:	0f b6 00             	movzbl (%rax),%eax
+  802a16:	38 c2                	cmp    %al,%dl
+  802a18:	74 1a                	je     802a34 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a1e:	0f b6 00             	movzbl (%rax),%eax
+  802a21:	0f b6 c8             	movzbl %al,%ecx
+  802a24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a28:	0f b6 00             	movzbl (%rax),%eax
+  802a2b:	0f b6 d0             	movzbl %al,%edx
+  802a2e:	89 c8                	mov    %ecx,%eax
+  802a30:	29 d0                	sub    %edx,%eax
+  802a32:	eb 20                	jmp    802a54 <memcmp+0x12b>
+    s1++, s2++;
+  802a34:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802a39:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  802a3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a42:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802a46:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802a4a:	48 85 c0             	test   %rax,%rax
+  802a4d:	75 b9                	jne    802a08 <memcmp+0xdf>
+  }
+
+  return 0;
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+
+0000000000802a56 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802a56:	55                   	push   %rbp
+  802a57:	48 89 e5             	mov    %rsp,%rbp
+  802a5a:	48 83 ec 50          	sub    $0x50,%rsp
+  802a5e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802a62:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802a65:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802a69:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802a6d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a71:	48 01 d0             	add    %rdx,%rax
+  802a74:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802a78:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802a7b:	66 0f 6e c0          	movd   %eax,%xmm0
+  802a7f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  802a83:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  802a87:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802a8c:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802a90:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  802a95:	76 73                	jbe    802b0a <memfind+0xb4>
+  802a97:	48 b8 48 1d 80 00 00 	movabs $0x801d48,%rax
+  802a9e:	00 00 00 
+  802aa1:	ff d0                	call   *%rax
+  802aa3:	83 e0 02             	and    $0x2,%eax
+  802aa6:	85 c0                	test   %eax,%eax
+  802aa8:	74 60                	je     802b0a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802aaa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802aad:	0f b6 c8             	movzbl %al,%ecx
+  802ab0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802ab4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab8:	89 ce                	mov    %ecx,%esi
+  802aba:	48 89 c7             	mov    %rax,%rdi
+  802abd:	48 b8 ff 1f 80 00 00 	movabs $0x801fff,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+  802ac9:	eb 6c                	jmp    802b37 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  802acb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802acf:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802ad3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802ad7:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802adc:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802ae0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802ae4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802ae7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802aeb:	74 13                	je     802b00 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802aed:	31 c0                	xor    %eax,%eax
+  802aef:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802af4:	48 63 d0             	movslq %eax,%rdx
+  802af7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802afb:	48 01 d0             	add    %rdx,%rax
+  802afe:	eb 37                	jmp    802b37 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802b00:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802b05:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802b0a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802b0f:	77 ba                	ja     802acb <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802b11:	eb 13                	jmp    802b26 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802b13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b17:	0f b6 00             	movzbl (%rax),%eax
+  802b1a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802b1d:	38 d0                	cmp    %dl,%al
+  802b1f:	74 11                	je     802b32 <memfind+0xdc>
+  for (; s < ends; s++)
+  802b21:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802b26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b2a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802b2e:	72 e3                	jb     802b13 <memfind+0xbd>
+  802b30:	eb 01                	jmp    802b33 <memfind+0xdd>
+      break;
+  802b32:	90                   	nop
+  return (void *)s;
+  802b33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802b37:	c9                   	leave
+  802b38:	c3                   	ret
+
+0000000000802b39 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802b39:	55                   	push   %rbp
+  802b3a:	48 89 e5             	mov    %rsp,%rbp
+  802b3d:	48 83 ec 38          	sub    $0x38,%rsp
+  802b41:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802b45:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802b49:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802b4c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802b53:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802b5a:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802b5b:	eb 05                	jmp    802b62 <strtol+0x29>
+    s++;
+  802b5d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802b62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b66:	0f b6 00             	movzbl (%rax),%eax
+  802b69:	3c 20                	cmp    $0x20,%al
+  802b6b:	74 f0                	je     802b5d <strtol+0x24>
+  802b6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b71:	0f b6 00             	movzbl (%rax),%eax
+  802b74:	3c 09                	cmp    $0x9,%al
+  802b76:	74 e5                	je     802b5d <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b7c:	0f b6 00             	movzbl (%rax),%eax
+  802b7f:	3c 2b                	cmp    $0x2b,%al
+  802b81:	75 07                	jne    802b8a <strtol+0x51>
+    s++;
+  802b83:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802b88:	eb 17                	jmp    802ba1 <strtol+0x68>
+  else if (*s == '-')
+  802b8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b8e:	0f b6 00             	movzbl (%rax),%eax
+  802b91:	3c 2d                	cmp    $0x2d,%al
+  802b93:	75 0c                	jne    802ba1 <strtol+0x68>
+    s++, neg = 1;
+  802b95:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802b9a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802ba1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802ba5:	74 06                	je     802bad <strtol+0x74>
+  802ba7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802bab:	75 28                	jne    802bd5 <strtol+0x9c>
+  802bad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bb1:	0f b6 00             	movzbl (%rax),%eax
+  802bb4:	3c 30                	cmp    $0x30,%al
+  802bb6:	75 1d                	jne    802bd5 <strtol+0x9c>
+  802bb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bbc:	48 83 c0 01          	add    $0x1,%rax
+  802bc0:	0f b6 00             	movzbl (%rax),%eax
+  802bc3:	3c 78                	cmp    $0x78,%al
+  802bc5:	75 0e                	jne    802bd5 <strtol+0x9c>
+    s += 2, base = 16;
+  802bc7:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802bcc:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802bd3:	eb 2c                	jmp    802c01 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802bd5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802bd9:	75 19                	jne    802bf4 <strtol+0xbb>
+  802bdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bdf:	0f b6 00             	movzbl (%rax),%eax
+  802be2:	3c 30                	cmp    $0x30,%al
+  802be4:	75 0e                	jne    802bf4 <strtol+0xbb>
+    s++, base = 8;
+  802be6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802beb:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802bf2:	eb 0d                	jmp    802c01 <strtol+0xc8>
+  else if (base == 0)
+  802bf4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802bf8:	75 07                	jne    802c01 <strtol+0xc8>
+    base = 10;
+  802bfa:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c05:	0f b6 00             	movzbl (%rax),%eax
+  802c08:	3c 2f                	cmp    $0x2f,%al
+  802c0a:	7e 1d                	jle    802c29 <strtol+0xf0>
+  802c0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c10:	0f b6 00             	movzbl (%rax),%eax
+  802c13:	3c 39                	cmp    $0x39,%al
+  802c15:	7f 12                	jg     802c29 <strtol+0xf0>
+      dig = *s - '0';
+  802c17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c1b:	0f b6 00             	movzbl (%rax),%eax
+  802c1e:	0f be c0             	movsbl %al,%eax
+  802c21:	83 e8 30             	sub    $0x30,%eax
+  802c24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c27:	eb 4e                	jmp    802c77 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802c29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c2d:	0f b6 00             	movzbl (%rax),%eax
+  802c30:	3c 60                	cmp    $0x60,%al
+  802c32:	7e 1d                	jle    802c51 <strtol+0x118>
+  802c34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c38:	0f b6 00             	movzbl (%rax),%eax
+  802c3b:	3c 7a                	cmp    $0x7a,%al
+  802c3d:	7f 12                	jg     802c51 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802c3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c43:	0f b6 00             	movzbl (%rax),%eax
+  802c46:	0f be c0             	movsbl %al,%eax
+  802c49:	83 e8 57             	sub    $0x57,%eax
+  802c4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c4f:	eb 26                	jmp    802c77 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802c51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c55:	0f b6 00             	movzbl (%rax),%eax
+  802c58:	3c 40                	cmp    $0x40,%al
+  802c5a:	7e 47                	jle    802ca3 <strtol+0x16a>
+  802c5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c60:	0f b6 00             	movzbl (%rax),%eax
+  802c63:	3c 5a                	cmp    $0x5a,%al
+  802c65:	7f 3c                	jg     802ca3 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802c67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c6b:	0f b6 00             	movzbl (%rax),%eax
+  802c6e:	0f be c0             	movsbl %al,%eax
+  802c71:	83 e8 37             	sub    $0x37,%eax
+  802c74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802c77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7a:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802c7d:	7d 23                	jge    802ca2 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802c7f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802c84:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c87:	48 98                	cltq
+  802c89:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802c8e:	48 89 c2             	mov    %rax,%rdx
+  802c91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c94:	48 98                	cltq
+  802c96:	48 01 d0             	add    %rdx,%rax
+  802c99:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802c9d:	e9 5f ff ff ff       	jmp    802c01 <strtol+0xc8>
+      break;
+  802ca2:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802ca3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802ca8:	74 0b                	je     802cb5 <strtol+0x17c>
+    *endptr = (char *)s;
+  802caa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cb2:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802cb5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb9:	74 09                	je     802cc4 <strtol+0x18b>
+  802cbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cbf:	48 f7 d8             	neg    %rax
+  802cc2:	eb 04                	jmp    802cc8 <strtol+0x18f>
+  802cc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+0000000000802cca <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802cca:	55                   	push   %rbp
+  802ccb:	48 89 e5             	mov    %rsp,%rbp
+  802cce:	53                   	push   %rbx
+  802ccf:	48 83 ec 48          	sub    $0x48,%rsp
+  802cd3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802cd7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802cdb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802cdf:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802ce3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802ce7:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802ceb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cef:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802cf3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802cf7:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802cfb:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802cff:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802d03:	4c 89 c3             	mov    %r8,%rbx
+  802d06:	cd 30                	int    $0x30
+  802d08:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802d0c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802d11:	74 46                	je     802d59 <syscall+0x8f>
+  802d13:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802d18:	7e 3f                	jle    802d59 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802d1a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802d1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d22:	49 89 d0             	mov    %rdx,%r8
+  802d25:	48 89 c1             	mov    %rax,%rcx
+  802d28:	48 b8 68 66 80 00 00 	movabs $0x806668,%rax
+  802d2f:	00 00 00 
+  802d32:	48 89 c2             	mov    %rax,%rdx
+  802d35:	be 22 00 00 00       	mov    $0x22,%esi
+  802d3a:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  802d41:	00 00 00 
+  802d44:	48 89 c7             	mov    %rax,%rdi
+  802d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4c:	49 b9 dd 0f 80 00 00 	movabs $0x800fdd,%r9
+  802d53:	00 00 00 
+  802d56:	41 ff d1             	call   *%r9
+
+  return ret;
+  802d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802d5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d61:	c9                   	leave
+  802d62:	c3                   	ret
+
+0000000000802d63 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802d63:	55                   	push   %rbp
+  802d64:	48 89 e5             	mov    %rsp,%rbp
+  802d67:	48 83 ec 10          	sub    $0x10,%rsp
+  802d6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d6f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802d73:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802d77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d7b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d7f:	6a 00                	push   $0x0
+  802d81:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d8d:	48 89 d1             	mov    %rdx,%rcx
+  802d90:	48 89 c2             	mov    %rax,%rdx
+  802d93:	be 00 00 00 00       	mov    $0x0,%esi
+  802d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d9d:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+  802da9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dad:	90                   	nop
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+0000000000802db0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802db4:	48 83 ec 08          	sub    $0x8,%rsp
+  802db8:	6a 00                	push   $0x0
+  802dba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd0:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd5:	bf 01 00 00 00       	mov    $0x1,%edi
+  802dda:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+  802de6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dea:	c9                   	leave
+  802deb:	c3                   	ret
+
+0000000000802dec <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	48 83 ec 10          	sub    $0x10,%rsp
+  802df4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802df7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dfa:	48 98                	cltq
+  802dfc:	48 83 ec 08          	sub    $0x8,%rsp
+  802e00:	6a 00                	push   $0x0
+  802e02:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e13:	48 89 c2             	mov    %rax,%rdx
+  802e16:	be 01 00 00 00       	mov    $0x1,%esi
+  802e1b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e20:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+
+0000000000802e32 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802e32:	55                   	push   %rbp
+  802e33:	48 89 e5             	mov    %rsp,%rbp
+  802e36:	48 83 ec 10          	sub    $0x10,%rsp
+  802e3a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802e3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e40:	48 98                	cltq
+  802e42:	48 83 ec 08          	sub    $0x8,%rsp
+  802e46:	6a 00                	push   $0x0
+  802e48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e4e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e59:	48 89 c2             	mov    %rax,%rdx
+  802e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e61:	bf 04 00 00 00       	mov    $0x4,%edi
+  802e66:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+  802e72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e76:	90                   	nop
+  802e77:	c9                   	leave
+  802e78:	c3                   	ret
+
+0000000000802e79 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802e79:	55                   	push   %rbp
+  802e7a:	48 89 e5             	mov    %rsp,%rbp
+  802e7d:	48 83 ec 20          	sub    $0x20,%rsp
+  802e81:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e84:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802e88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e8b:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802e8e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e93:	cd 30                	int    $0x30
+  802e95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802e99:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802e9d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802ea2:	7e 3d                	jle    802ee1 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802ea4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ea8:	49 89 c0             	mov    %rax,%r8
+  802eab:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802eb0:	48 b8 68 66 80 00 00 	movabs $0x806668,%rax
+  802eb7:	00 00 00 
+  802eba:	48 89 c2             	mov    %rax,%rdx
+  802ebd:	be 49 00 00 00       	mov    $0x49,%esi
+  802ec2:	48 b8 87 66 80 00 00 	movabs $0x806687,%rax
+  802ec9:	00 00 00 
+  802ecc:	48 89 c7             	mov    %rax,%rdi
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed4:	49 b9 dd 0f 80 00 00 	movabs $0x800fdd,%r9
+  802edb:	00 00 00 
+  802ede:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802ee1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802ee6:	75 13                	jne    802efb <sys_env_wait+0x82>
+  802ee8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802eed:	74 0c                	je     802efb <sys_env_wait+0x82>
+    *status = st;
+  802eef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ef3:	89 c2                	mov    %eax,%edx
+  802ef5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ef9:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802efb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802eff:	c9                   	leave
+  802f00:	c3                   	ret
+
+0000000000802f01 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802f01:	55                   	push   %rbp
+  802f02:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802f05:	48 83 ec 08          	sub    $0x8,%rsp
+  802f09:	6a 00                	push   $0x0
+  802f0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f21:	be 00 00 00 00       	mov    $0x0,%esi
+  802f26:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f2b:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+  802f37:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f3b:	c9                   	leave
+  802f3c:	c3                   	ret
+
+0000000000802f3d <sys_yield>:
+
+void
+sys_yield(void) {
+  802f3d:	55                   	push   %rbp
+  802f3e:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802f41:	48 83 ec 08          	sub    $0x8,%rsp
+  802f45:	6a 00                	push   $0x0
+  802f47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f62:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802f67:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+  802f73:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f77:	90                   	nop
+  802f78:	c9                   	leave
+  802f79:	c3                   	ret
+
+0000000000802f7a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802f7a:	55                   	push   %rbp
+  802f7b:	48 89 e5             	mov    %rsp,%rbp
+  802f7e:	48 83 ec 20          	sub    $0x20,%rsp
+  802f82:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f85:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802f89:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802f8c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f8f:	48 63 c8             	movslq %eax,%rcx
+  802f92:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f99:	48 98                	cltq
+  802f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f9f:	6a 00                	push   $0x0
+  802fa1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fa7:	49 89 c8             	mov    %rcx,%r8
+  802faa:	48 89 d1             	mov    %rdx,%rcx
+  802fad:	48 89 c2             	mov    %rax,%rdx
+  802fb0:	be 01 00 00 00       	mov    $0x1,%esi
+  802fb5:	bf 06 00 00 00       	mov    $0x6,%edi
+  802fba:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+  802fc6:	48 83 c4 10          	add    $0x10,%rsp
+  802fca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802fcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802fd0:	c9                   	leave
+  802fd1:	c3                   	ret
+
+0000000000802fd2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802fd2:	55                   	push   %rbp
+  802fd3:	48 89 e5             	mov    %rsp,%rbp
+  802fd6:	48 83 ec 20          	sub    $0x20,%rsp
+  802fda:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fdd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802fe1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802fe4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802fe8:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802fec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802fef:	48 63 c8             	movslq %eax,%rcx
+  802ff2:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802ff6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802ff9:	48 63 f0             	movslq %eax,%rsi
+  802ffc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803000:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803003:	48 98                	cltq
+  803005:	48 83 ec 08          	sub    $0x8,%rsp
+  803009:	51                   	push   %rcx
+  80300a:	49 89 f9             	mov    %rdi,%r9
+  80300d:	49 89 f0             	mov    %rsi,%r8
+  803010:	48 89 d1             	mov    %rdx,%rcx
+  803013:	48 89 c2             	mov    %rax,%rdx
+  803016:	be 01 00 00 00       	mov    $0x1,%esi
+  80301b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803020:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803027:	00 00 00 
+  80302a:	ff d0                	call   *%rax
+  80302c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803030:	c9                   	leave
+  803031:	c3                   	ret
+
+0000000000803032 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  803032:	55                   	push   %rbp
+  803033:	48 89 e5             	mov    %rsp,%rbp
+  803036:	48 83 ec 10          	sub    $0x10,%rsp
+  80303a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80303d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  803041:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803045:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803048:	48 98                	cltq
+  80304a:	48 83 ec 08          	sub    $0x8,%rsp
+  80304e:	6a 00                	push   $0x0
+  803050:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803056:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80305c:	48 89 d1             	mov    %rdx,%rcx
+  80305f:	48 89 c2             	mov    %rax,%rdx
+  803062:	be 01 00 00 00       	mov    $0x1,%esi
+  803067:	bf 08 00 00 00       	mov    $0x8,%edi
+  80306c:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+  803078:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80307c:	c9                   	leave
+  80307d:	c3                   	ret
+
+000000000080307e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80307e:	55                   	push   %rbp
+  80307f:	48 89 e5             	mov    %rsp,%rbp
+  803082:	48 83 ec 10          	sub    $0x10,%rsp
+  803086:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803089:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80308c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80308f:	48 63 d0             	movslq %eax,%rdx
+  803092:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803095:	48 98                	cltq
+  803097:	48 83 ec 08          	sub    $0x8,%rsp
+  80309b:	6a 00                	push   $0x0
+  80309d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030a9:	48 89 d1             	mov    %rdx,%rcx
+  8030ac:	48 89 c2             	mov    %rax,%rdx
+  8030af:	be 01 00 00 00       	mov    $0x1,%esi
+  8030b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8030b9:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+  8030c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030c9:	c9                   	leave
+  8030ca:	c3                   	ret
+
+00000000008030cb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8030cb:	55                   	push   %rbp
+  8030cc:	48 89 e5             	mov    %rsp,%rbp
+  8030cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8030d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8030da:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030e1:	48 98                	cltq
+  8030e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8030e7:	6a 00                	push   $0x0
+  8030e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030f5:	48 89 d1             	mov    %rdx,%rcx
+  8030f8:	48 89 c2             	mov    %rax,%rdx
+  8030fb:	be 01 00 00 00       	mov    $0x1,%esi
+  803100:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803105:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80310c:	00 00 00 
+  80310f:	ff d0                	call   *%rax
+  803111:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803115:	c9                   	leave
+  803116:	c3                   	ret
+
+0000000000803117 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803117:	55                   	push   %rbp
+  803118:	48 89 e5             	mov    %rsp,%rbp
+  80311b:	48 83 ec 10          	sub    $0x10,%rsp
+  80311f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803122:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  803126:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80312a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80312d:	48 98                	cltq
+  80312f:	48 83 ec 08          	sub    $0x8,%rsp
+  803133:	6a 00                	push   $0x0
+  803135:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80313b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803141:	48 89 d1             	mov    %rdx,%rcx
+  803144:	48 89 c2             	mov    %rax,%rdx
+  803147:	be 01 00 00 00       	mov    $0x1,%esi
+  80314c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803151:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803158:	00 00 00 
+  80315b:	ff d0                	call   *%rax
+  80315d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803161:	c9                   	leave
+  803162:	c3                   	ret
+
+0000000000803163 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  803163:	55                   	push   %rbp
+  803164:	48 89 e5             	mov    %rsp,%rbp
+  803167:	48 83 ec 20          	sub    $0x20,%rsp
+  80316b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80316e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803172:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803176:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  803179:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80317c:	48 63 f0             	movslq %eax,%rsi
+  80317f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803183:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803187:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80318a:	48 98                	cltq
+  80318c:	48 83 ec 08          	sub    $0x8,%rsp
+  803190:	6a 00                	push   $0x0
+  803192:	49 89 f1             	mov    %rsi,%r9
+  803195:	49 89 c8             	mov    %rcx,%r8
+  803198:	48 89 d1             	mov    %rdx,%rcx
+  80319b:	48 89 c2             	mov    %rax,%rdx
+  80319e:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8031a8:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8031af:	00 00 00 
+  8031b2:	ff d0                	call   *%rax
+  8031b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031b8:	c9                   	leave
+  8031b9:	c3                   	ret
+
+00000000008031ba <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8031ba:	55                   	push   %rbp
+  8031bb:	48 89 e5             	mov    %rsp,%rbp
+  8031be:	48 83 ec 10          	sub    $0x10,%rsp
+  8031c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8031c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ce:	6a 00                	push   $0x0
+  8031d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031e1:	48 89 c2             	mov    %rax,%rdx
+  8031e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8031e9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8031ee:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8031f5:	00 00 00 
+  8031f8:	ff d0                	call   *%rax
+  8031fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031fe:	c9                   	leave
+  8031ff:	c3                   	ret
+
+0000000000803200 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  803200:	55                   	push   %rbp
+  803201:	48 89 e5             	mov    %rsp,%rbp
+  803204:	48 83 ec 10          	sub    $0x10,%rsp
+  803208:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80320c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  803210:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803214:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803218:	48 83 ec 08          	sub    $0x8,%rsp
+  80321c:	6a 00                	push   $0x0
+  80321e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80322a:	48 89 d1             	mov    %rdx,%rcx
+  80322d:	48 89 c2             	mov    %rax,%rdx
+  803230:	be 01 00 00 00       	mov    $0x1,%esi
+  803235:	bf 10 00 00 00       	mov    $0x10,%edi
+  80323a:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+  803246:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80324a:	c9                   	leave
+  80324b:	c3                   	ret
+
+000000000080324c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80324c:	55                   	push   %rbp
+  80324d:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  803250:	48 83 ec 08          	sub    $0x8,%rsp
+  803254:	6a 00                	push   $0x0
+  803256:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80325c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803262:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803267:	ba 00 00 00 00       	mov    $0x0,%edx
+  80326c:	be 00 00 00 00       	mov    $0x0,%esi
+  803271:	bf 11 00 00 00       	mov    $0x11,%edi
+  803276:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80327d:	00 00 00 
+  803280:	ff d0                	call   *%rax
+  803282:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803286:	c9                   	leave
+  803287:	c3                   	ret
+
+0000000000803288 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  803288:	55                   	push   %rbp
+  803289:	48 89 e5             	mov    %rsp,%rbp
+  80328c:	48 83 ec 10          	sub    $0x10,%rsp
+  803290:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803294:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  803298:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80329c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8032a4:	6a 00                	push   $0x0
+  8032a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8032ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032b2:	48 89 d1             	mov    %rdx,%rcx
+  8032b5:	48 89 c2             	mov    %rax,%rdx
+  8032b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032bd:	bf 12 00 00 00       	mov    $0x12,%edi
+  8032c2:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+  8032ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+00000000008032d4 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8032dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8032e4:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8032e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032ea:	48 63 c8             	movslq %eax,%rcx
+  8032ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8032f9:	6a 00                	push   $0x0
+  8032fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803301:	49 89 c8             	mov    %rcx,%r8
+  803304:	48 89 d1             	mov    %rdx,%rcx
+  803307:	48 89 c2             	mov    %rax,%rdx
+  80330a:	be 00 00 00 00       	mov    $0x0,%esi
+  80330f:	bf 13 00 00 00       	mov    $0x13,%edi
+  803314:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80331b:	00 00 00 
+  80331e:	ff d0                	call   *%rax
+  803320:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+0000000000803326 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  803326:	55                   	push   %rbp
+  803327:	48 89 e5             	mov    %rsp,%rbp
+  80332a:	48 83 ec 20          	sub    $0x20,%rsp
+  80332e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803332:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803335:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  803339:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80333d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803344:	48 83 ec 08          	sub    $0x8,%rsp
+  803348:	6a 00                	push   $0x0
+  80334a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803350:	49 89 c8             	mov    %rcx,%r8
+  803353:	48 89 d1             	mov    %rdx,%rcx
+  803356:	48 89 c2             	mov    %rax,%rdx
+  803359:	be 00 00 00 00       	mov    $0x0,%esi
+  80335e:	bf 14 00 00 00       	mov    $0x14,%edi
+  803363:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80336a:	00 00 00 
+  80336d:	ff d0                	call   *%rax
+  80336f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+0000000000803375 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  803375:	55                   	push   %rbp
+  803376:	48 89 e5             	mov    %rsp,%rbp
+  803379:	48 83 ec 10          	sub    $0x10,%rsp
+  80337d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803381:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  803384:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803387:	48 63 d0             	movslq %eax,%rdx
+  80338a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338e:	48 83 ec 08          	sub    $0x8,%rsp
+  803392:	6a 00                	push   $0x0
+  803394:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80339a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033a0:	48 89 d1             	mov    %rdx,%rcx
+  8033a3:	48 89 c2             	mov    %rax,%rdx
+  8033a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8033ab:	bf 15 00 00 00       	mov    $0x15,%edi
+  8033b0:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8033b7:	00 00 00 
+  8033ba:	ff d0                	call   *%rax
+  8033bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+
+00000000008033c2 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8033c2:	55                   	push   %rbp
+  8033c3:	48 89 e5             	mov    %rsp,%rbp
+  8033c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8033ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033ce:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8033d1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8033d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8033d8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8033dc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8033df:	48 63 c8             	movslq %eax,%rcx
+  8033e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033e5:	48 63 d0             	movslq %eax,%rdx
+  8033e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f0:	6a 00                	push   $0x0
+  8033f2:	49 89 f1             	mov    %rsi,%r9
+  8033f5:	49 89 c8             	mov    %rcx,%r8
+  8033f8:	48 89 d1             	mov    %rdx,%rcx
+  8033fb:	48 89 c2             	mov    %rax,%rdx
+  8033fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803403:	bf 16 00 00 00       	mov    $0x16,%edi
+  803408:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80340f:	00 00 00 
+  803412:	ff d0                	call   *%rax
+  803414:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803418:	c9                   	leave
+  803419:	c3                   	ret
+
+000000000080341a <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80341a:	55                   	push   %rbp
+  80341b:	48 89 e5             	mov    %rsp,%rbp
+  80341e:	48 83 ec 30          	sub    $0x30,%rsp
+  803422:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803426:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80342a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80342e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  803432:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  803436:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80343a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80343e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  803442:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344a:	48 83 ec 08          	sub    $0x8,%rsp
+  80344e:	51                   	push   %rcx
+  80344f:	49 89 f9             	mov    %rdi,%r9
+  803452:	49 89 f0             	mov    %rsi,%r8
+  803455:	48 89 d1             	mov    %rdx,%rcx
+  803458:	48 89 c2             	mov    %rax,%rdx
+  80345b:	be 00 00 00 00       	mov    $0x0,%esi
+  803460:	bf 17 00 00 00       	mov    $0x17,%edi
+  803465:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80346c:	00 00 00 
+  80346f:	ff d0                	call   *%rax
+  803471:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803475:	c9                   	leave
+  803476:	c3                   	ret
+
+0000000000803477 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  803477:	55                   	push   %rbp
+  803478:	48 89 e5             	mov    %rsp,%rbp
+  80347b:	48 83 ec 10          	sub    $0x10,%rsp
+  80347f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  803482:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803485:	48 98                	cltq
+  803487:	48 83 ec 08          	sub    $0x8,%rsp
+  80348b:	6a 00                	push   $0x0
+  80348d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803499:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80349e:	48 89 c2             	mov    %rax,%rdx
+  8034a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8034ab:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+  8034b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8034bb:	90                   	nop
+  8034bc:	c9                   	leave
+  8034bd:	c3                   	ret
+
+00000000008034be <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8034be:	55                   	push   %rbp
+  8034bf:	48 89 e5             	mov    %rsp,%rbp
+  8034c2:	48 83 ec 30          	sub    $0x30,%rsp
+  8034c6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8034cd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8034d1:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8034d4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8034d7:	48 63 f0             	movslq %eax,%rsi
+  8034da:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8034de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034e5:	48 98                	cltq
+  8034e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8034eb:	6a 00                	push   $0x0
+  8034ed:	49 89 f1             	mov    %rsi,%r9
+  8034f0:	49 89 c8             	mov    %rcx,%r8
+  8034f3:	48 89 d1             	mov    %rdx,%rcx
+  8034f6:	48 89 c2             	mov    %rax,%rdx
+  8034f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8034fe:	bf 19 00 00 00       	mov    $0x19,%edi
+  803503:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	48 83 c4 10          	add    $0x10,%rsp
+  803513:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  803516:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803519:	c9                   	leave
+  80351a:	c3                   	ret
+
+000000000080351b <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80351b:	55                   	push   %rbp
+  80351c:	48 89 e5             	mov    %rsp,%rbp
+  80351f:	48 83 ec 20          	sub    $0x20,%rsp
+  803523:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803527:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80352b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80352e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803531:	48 63 c8             	movslq %eax,%rcx
+  803534:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80353c:	48 83 ec 08          	sub    $0x8,%rsp
+  803540:	6a 00                	push   $0x0
+  803542:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803548:	49 89 c8             	mov    %rcx,%r8
+  80354b:	48 89 d1             	mov    %rdx,%rcx
+  80354e:	48 89 c2             	mov    %rax,%rdx
+  803551:	be 01 00 00 00       	mov    $0x1,%esi
+  803556:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80355b:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803562:	00 00 00 
+  803565:	ff d0                	call   *%rax
+  803567:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80356b:	c9                   	leave
+  80356c:	c3                   	ret
+
+000000000080356d <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80356d:	55                   	push   %rbp
+  80356e:	48 89 e5             	mov    %rsp,%rbp
+  803571:	48 83 ec 20          	sub    $0x20,%rsp
+  803575:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803579:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80357d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  803581:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803585:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803589:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80358d:	48 83 ec 08          	sub    $0x8,%rsp
+  803591:	6a 00                	push   $0x0
+  803593:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803599:	49 89 c8             	mov    %rcx,%r8
+  80359c:	48 89 d1             	mov    %rdx,%rcx
+  80359f:	48 89 c2             	mov    %rax,%rdx
+  8035a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8035a7:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8035ac:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  8035b3:	00 00 00 
+  8035b6:	ff d0                	call   *%rax
+  8035b8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+
+00000000008035be <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8035be:	55                   	push   %rbp
+  8035bf:	48 89 e5             	mov    %rsp,%rbp
+  8035c2:	48 83 ec 30          	sub    $0x30,%rsp
+  8035c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035ce:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8035d1:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8035d5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8035d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035dc:	48 63 c8             	movslq %eax,%rcx
+  8035df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8035eb:	6a 00                	push   $0x0
+  8035ed:	49 89 f1             	mov    %rsi,%r9
+  8035f0:	49 89 c8             	mov    %rcx,%r8
+  8035f3:	48 89 d1             	mov    %rdx,%rcx
+  8035f6:	48 89 c2             	mov    %rax,%rdx
+  8035f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8035fe:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  803603:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80360a:	00 00 00 
+  80360d:	ff d0                	call   *%rax
+  80360f:	48 83 c4 10          	add    $0x10,%rsp
+  803613:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  803616:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803619:	c9                   	leave
+  80361a:	c3                   	ret
+
+000000000080361b <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	48 83 ec 10          	sub    $0x10,%rsp
+  803623:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  803626:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803629:	48 98                	cltq
+  80362b:	48 83 ec 08          	sub    $0x8,%rsp
+  80362f:	6a 00                	push   $0x0
+  803631:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80363d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803642:	48 89 c2             	mov    %rax,%rdx
+  803645:	be 01 00 00 00       	mov    $0x1,%esi
+  80364a:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80364f:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+  80365b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80365f:	c9                   	leave
+  803660:	c3                   	ret
+
+0000000000803661 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  803661:	55                   	push   %rbp
+  803662:	48 89 e5             	mov    %rsp,%rbp
+  803665:	48 83 ec 20          	sub    $0x20,%rsp
+  803669:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80366d:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  803674:	00 00 00 
+  803677:	ff d0                	call   *%rax
+  803679:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  80367c:	48 b8 d0 81 80 00 00 	movabs $0x8081d0,%rax
+  803683:	00 00 00 
+  803686:	48 8b 00             	mov    (%rax),%rax
+  803689:	48 85 c0             	test   %rax,%rax
+  80368c:	75 62                	jne    8036f0 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  80368e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803691:	ba 07 00 00 00       	mov    $0x7,%edx
+  803696:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  80369d:	00 00 00 
+  8036a0:	48 89 ce             	mov    %rcx,%rsi
+  8036a3:	89 c7                	mov    %eax,%edi
+  8036a5:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8036b4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8036b8:	79 36                	jns    8036f0 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8036ba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8036bd:	89 c1                	mov    %eax,%ecx
+  8036bf:	48 b8 95 66 80 00 00 	movabs $0x806695,%rax
+  8036c6:	00 00 00 
+  8036c9:	48 89 c2             	mov    %rax,%rdx
+  8036cc:	be 23 00 00 00       	mov    $0x23,%esi
+  8036d1:	48 b8 ad 66 80 00 00 	movabs $0x8066ad,%rax
+  8036d8:	00 00 00 
+  8036db:	48 89 c7             	mov    %rax,%rdi
+  8036de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e3:	49 b8 dd 0f 80 00 00 	movabs $0x800fdd,%r8
+  8036ea:	00 00 00 
+  8036ed:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036f0:	48 ba d0 81 80 00 00 	movabs $0x8081d0,%rdx
+  8036f7:	00 00 00 
+  8036fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036fe:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  803701:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803704:	48 ba 61 37 80 00 00 	movabs $0x803761,%rdx
+  80370b:	00 00 00 
+  80370e:	48 89 d6             	mov    %rdx,%rsi
+  803711:	89 c7                	mov    %eax,%edi
+  803713:	48 b8 17 31 80 00 00 	movabs $0x803117,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+  80371f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  803722:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803726:	79 36                	jns    80375e <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  803728:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80372b:	89 c1                	mov    %eax,%ecx
+  80372d:	48 b8 95 66 80 00 00 	movabs $0x806695,%rax
+  803734:	00 00 00 
+  803737:	48 89 c2             	mov    %rax,%rdx
+  80373a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80373f:	48 b8 ad 66 80 00 00 	movabs $0x8066ad,%rax
+  803746:	00 00 00 
+  803749:	48 89 c7             	mov    %rax,%rdi
+  80374c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803751:	49 b8 dd 0f 80 00 00 	movabs $0x800fdd,%r8
+  803758:	00 00 00 
+  80375b:	41 ff d0             	call   *%r8
+}
+  80375e:	90                   	nop
+  80375f:	c9                   	leave
+  803760:	c3                   	ret
+
+0000000000803761 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  803761:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  803764:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  803767:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  80376e:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  803772:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  803777:	48 a1 d0 81 80 00 00 	movabs 0x8081d0,%rax
+  80377e:	00 00 00 
+	call *%rax
+  803781:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  803783:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  803788:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  80378b:	41 5f                	pop    %r15
+	popq %r15
+  80378d:	41 5f                	pop    %r15
+	popq %r15
+  80378f:	41 5f                	pop    %r15
+	popq %r14
+  803791:	41 5e                	pop    %r14
+	popq %r13
+  803793:	41 5d                	pop    %r13
+	popq %r12
+  803795:	41 5c                	pop    %r12
+	popq %r11
+  803797:	41 5b                	pop    %r11
+	popq %r10
+  803799:	41 5a                	pop    %r10
+	popq %r9
+  80379b:	41 59                	pop    %r9
+	popq %r8
+  80379d:	41 58                	pop    %r8
+	popq %rsi
+  80379f:	5e                   	pop    %rsi
+	popq %rdi
+  8037a0:	5f                   	pop    %rdi
+	popq %rbp
+  8037a1:	5d                   	pop    %rbp
+	popq %rdx
+  8037a2:	5a                   	pop    %rdx
+	popq %rcx
+  8037a3:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8037a4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8037a9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8037ae:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8037b2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8037b5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8037ba:	5b                   	pop    %rbx
+	popq %rax
+  8037bb:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8037bc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8037c0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8037c1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8037c6:	c3                   	ret
+
+00000000008037c7 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8037c7:	55                   	push   %rbp
+  8037c8:	48 89 e5             	mov    %rsp,%rbp
+  8037cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8037cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8037d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037d7:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8037de:	ff ff ff 
+  8037e1:	48 01 d0             	add    %rdx,%rax
+  8037e4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8037e8:	c9                   	leave
+  8037e9:	c3                   	ret
+
+00000000008037ea <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8037ea:	55                   	push   %rbp
+  8037eb:	48 89 e5             	mov    %rsp,%rbp
+  8037ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8037f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8037f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037fa:	48 89 c7             	mov    %rax,%rdi
+  8037fd:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+  803809:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80380f:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803813:	c9                   	leave
+  803814:	c3                   	ret
+
+0000000000803815 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803815:	55                   	push   %rbp
+  803816:	48 89 e5             	mov    %rsp,%rbp
+  803819:	48 83 ec 18          	sub    $0x18,%rsp
+  80381d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803821:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803828:	e9 ae 00 00 00       	jmp    8038db <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80382d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803830:	c1 e0 0c             	shl    $0xc,%eax
+  803833:	48 98                	cltq
+  803835:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80383a:	48 01 d0             	add    %rdx,%rax
+  80383d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803841:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803845:	48 c1 e8 27          	shr    $0x27,%rax
+  803849:	48 89 c2             	mov    %rax,%rdx
+  80384c:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803853:	01 00 00 
+  803856:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80385a:	83 e0 01             	and    $0x1,%eax
+  80385d:	48 85 c0             	test   %rax,%rax
+  803860:	74 63                	je     8038c5 <fd_alloc+0xb0>
+  803862:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803866:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80386a:	48 89 c2             	mov    %rax,%rdx
+  80386d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803874:	01 00 00 
+  803877:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80387b:	83 e0 01             	and    $0x1,%eax
+  80387e:	48 85 c0             	test   %rax,%rax
+  803881:	74 42                	je     8038c5 <fd_alloc+0xb0>
+  803883:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803887:	48 c1 e8 15          	shr    $0x15,%rax
+  80388b:	48 89 c2             	mov    %rax,%rdx
+  80388e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803895:	01 00 00 
+  803898:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80389c:	83 e0 01             	and    $0x1,%eax
+  80389f:	48 85 c0             	test   %rax,%rax
+  8038a2:	74 21                	je     8038c5 <fd_alloc+0xb0>
+  8038a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038ac:	48 89 c2             	mov    %rax,%rdx
+  8038af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038b6:	01 00 00 
+  8038b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038bd:	83 e0 01             	and    $0x1,%eax
+  8038c0:	48 85 c0             	test   %rax,%rax
+  8038c3:	75 12                	jne    8038d7 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8038c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038cd:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8038d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d5:	eb 1e                	jmp    8038f5 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8038d7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8038db:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8038df:	0f 8e 48 ff ff ff    	jle    80382d <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8038e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8038f0:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8038f5:	c9                   	leave
+  8038f6:	c3                   	ret
+
+00000000008038f7 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+  8038fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8038ff:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803902:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803906:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80390a:	78 06                	js     803912 <fd_lookup+0x1b>
+  80390c:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803910:	7e 0a                	jle    80391c <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803912:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803917:	e9 af 00 00 00       	jmp    8039cb <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80391c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80391f:	c1 e0 0c             	shl    $0xc,%eax
+  803922:	48 98                	cltq
+  803924:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803929:	48 01 d0             	add    %rdx,%rax
+  80392c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803934:	48 c1 e8 27          	shr    $0x27,%rax
+  803938:	48 89 c2             	mov    %rax,%rdx
+  80393b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803942:	01 00 00 
+  803945:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803949:	83 e0 01             	and    $0x1,%eax
+  80394c:	48 85 c0             	test   %rax,%rax
+  80394f:	74 63                	je     8039b4 <fd_lookup+0xbd>
+  803951:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803955:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803959:	48 89 c2             	mov    %rax,%rdx
+  80395c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803963:	01 00 00 
+  803966:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80396a:	83 e0 01             	and    $0x1,%eax
+  80396d:	48 85 c0             	test   %rax,%rax
+  803970:	74 42                	je     8039b4 <fd_lookup+0xbd>
+  803972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803976:	48 c1 e8 15          	shr    $0x15,%rax
+  80397a:	48 89 c2             	mov    %rax,%rdx
+  80397d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803984:	01 00 00 
+  803987:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80398b:	83 e0 01             	and    $0x1,%eax
+  80398e:	48 85 c0             	test   %rax,%rax
+  803991:	74 21                	je     8039b4 <fd_lookup+0xbd>
+  803993:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803997:	48 c1 e8 0c          	shr    $0xc,%rax
+  80399b:	48 89 c2             	mov    %rax,%rdx
+  80399e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8039a5:	01 00 00 
+  8039a8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039ac:	83 e0 01             	and    $0x1,%eax
+  8039af:	48 85 c0             	test   %rax,%rax
+  8039b2:	75 07                	jne    8039bb <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8039b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039b9:	eb 10                	jmp    8039cb <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8039bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039c3:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8039c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039cb:	c9                   	leave
+  8039cc:	c3                   	ret
+
+00000000008039cd <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8039cd:	55                   	push   %rbp
+  8039ce:	48 89 e5             	mov    %rsp,%rbp
+  8039d1:	48 83 ec 30          	sub    $0x30,%rsp
+  8039d5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8039d9:	89 f0                	mov    %esi,%eax
+  8039db:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8039de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039e2:	48 89 c7             	mov    %rax,%rdi
+  8039e5:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+  8039f1:	89 c2                	mov    %eax,%edx
+  8039f3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8039f7:	48 89 c6             	mov    %rax,%rsi
+  8039fa:	89 d7                	mov    %edx,%edi
+  8039fc:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803a03:	00 00 00 
+  803a06:	ff d0                	call   *%rax
+  803a08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a0f:	78 0a                	js     803a1b <fd_close+0x4e>
+  803a11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a15:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803a19:	74 12                	je     803a2d <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803a1b:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803a1f:	74 05                	je     803a26 <fd_close+0x59>
+  803a21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a24:	eb 70                	jmp    803a96 <fd_close+0xc9>
+  803a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2b:	eb 69                	jmp    803a96 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803a2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a31:	8b 00                	mov    (%rax),%eax
+  803a33:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a37:	48 89 d6             	mov    %rdx,%rsi
+  803a3a:	89 c7                	mov    %eax,%edi
+  803a3c:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+  803a48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a4f:	78 2a                	js     803a7b <fd_close+0xae>
+    if (dev->dev_close)
+  803a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a55:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803a59:	48 85 c0             	test   %rax,%rax
+  803a5c:	74 16                	je     803a74 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803a5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a62:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803a66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a6a:	48 89 c7             	mov    %rax,%rdi
+  803a6d:	ff d2                	call   *%rdx
+  803a6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a72:	eb 07                	jmp    803a7b <fd_close+0xae>
+    else
+      r = 0;
+  803a74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803a7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a7f:	48 89 c6             	mov    %rax,%rsi
+  803a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a87:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  803a8e:	00 00 00 
+  803a91:	ff d0                	call   *%rax
+  return r;
+  803a93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+
+0000000000803a98 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803a98:	55                   	push   %rbp
+  803a99:	48 89 e5             	mov    %rsp,%rbp
+  803a9c:	48 83 ec 20          	sub    $0x20,%rsp
+  803aa0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803aa3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803aa7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803aae:	eb 3f                	jmp    803aef <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803ab0:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803ab7:	00 00 00 
+  803aba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803abd:	48 98                	cltq
+  803abf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ac3:	8b 00                	mov    (%rax),%eax
+  803ac5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803ac8:	75 21                	jne    803aeb <dev_lookup+0x53>
+      *dev = devtab[i];
+  803aca:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803ad1:	00 00 00 
+  803ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ad7:	48 98                	cltq
+  803ad9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803add:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ae1:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae9:	eb 7f                	jmp    803b6a <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803aeb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803aef:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803af6:	00 00 00 
+  803af9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803afc:	48 98                	cltq
+  803afe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b02:	48 85 c0             	test   %rax,%rax
+  803b05:	75 a9                	jne    803ab0 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803b07:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b0e:	00 00 00 
+  803b11:	8b 40 04             	mov    0x4(%rax),%eax
+  803b14:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b19:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b20:	00 00 00 
+  803b23:	48 98                	cltq
+  803b25:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b2c:	48 01 d0             	add    %rdx,%rax
+  803b2f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b35:	8b 00                	mov    (%rax),%eax
+  803b37:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803b3a:	89 c6                	mov    %eax,%esi
+  803b3c:	48 b8 c0 66 80 00 00 	movabs $0x8066c0,%rax
+  803b43:	00 00 00 
+  803b46:	48 89 c7             	mov    %rax,%rdi
+  803b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4e:	48 b9 fc 11 80 00 00 	movabs $0x8011fc,%rcx
+  803b55:	00 00 00 
+  803b58:	ff d1                	call   *%rcx
+  *dev = 0;
+  803b5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b5e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803b6a:	c9                   	leave
+  803b6b:	c3                   	ret
+
+0000000000803b6c <close>:
+
+int
+close(int fdnum) {
+  803b6c:	55                   	push   %rbp
+  803b6d:	48 89 e5             	mov    %rsp,%rbp
+  803b70:	48 83 ec 20          	sub    $0x20,%rsp
+  803b74:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b77:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b7e:	48 89 d6             	mov    %rdx,%rsi
+  803b81:	89 c7                	mov    %eax,%edi
+  803b83:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803b8a:	00 00 00 
+  803b8d:	ff d0                	call   *%rax
+  803b8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b96:	79 05                	jns    803b9d <close+0x31>
+    return r;
+  803b98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b9b:	eb 18                	jmp    803bb5 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803b9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba1:	be 01 00 00 00       	mov    $0x1,%esi
+  803ba6:	48 89 c7             	mov    %rax,%rdi
+  803ba9:	48 b8 cd 39 80 00 00 	movabs $0x8039cd,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+}
+  803bb5:	c9                   	leave
+  803bb6:	c3                   	ret
+
+0000000000803bb7 <close_all>:
+
+void
+close_all(void) {
+  803bb7:	55                   	push   %rbp
+  803bb8:	48 89 e5             	mov    %rsp,%rbp
+  803bbb:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803bbf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803bc6:	eb 15                	jmp    803bdd <close_all+0x26>
+    close(i);
+  803bc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bcb:	89 c7                	mov    %eax,%edi
+  803bcd:	48 b8 6c 3b 80 00 00 	movabs $0x803b6c,%rax
+  803bd4:	00 00 00 
+  803bd7:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803bd9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803bdd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803be1:	7e e5                	jle    803bc8 <close_all+0x11>
+}
+  803be3:	90                   	nop
+  803be4:	90                   	nop
+  803be5:	c9                   	leave
+  803be6:	c3                   	ret
+
+0000000000803be7 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803be7:	55                   	push   %rbp
+  803be8:	48 89 e5             	mov    %rsp,%rbp
+  803beb:	48 83 ec 40          	sub    $0x40,%rsp
+  803bef:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803bf2:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803bf5:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803bf9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bfc:	48 89 d6             	mov    %rdx,%rsi
+  803bff:	89 c7                	mov    %eax,%edi
+  803c01:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+  803c0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c14:	79 08                	jns    803c1e <dup+0x37>
+    return r;
+  803c16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c19:	e9 33 02 00 00       	jmp    803e51 <dup+0x26a>
+  close(newfdnum);
+  803c1e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803c21:	89 c7                	mov    %eax,%edi
+  803c23:	48 b8 6c 3b 80 00 00 	movabs $0x803b6c,%rax
+  803c2a:	00 00 00 
+  803c2d:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803c2f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803c32:	c1 e0 0c             	shl    $0xc,%eax
+  803c35:	48 98                	cltq
+  803c37:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803c3c:	48 01 d0             	add    %rdx,%rax
+  803c3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803c43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c47:	48 89 c7             	mov    %rax,%rdi
+  803c4a:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+  803c56:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c5e:	48 89 c7             	mov    %rax,%rdi
+  803c61:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  803c68:	00 00 00 
+  803c6b:	ff d0                	call   *%rax
+  803c6d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803c71:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803c78:	00 
+  803c79:	e9 19 01 00 00       	jmp    803d97 <dup+0x1b0>
+    off -= PGSIZE;
+  803c7e:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803c85:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803c86:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c8e:	48 01 d0             	add    %rdx,%rax
+  803c91:	48 c1 e8 27          	shr    $0x27,%rax
+  803c95:	48 89 c2             	mov    %rax,%rdx
+  803c98:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803c9f:	01 00 00 
+  803ca2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ca6:	83 e0 01             	and    $0x1,%eax
+  803ca9:	48 85 c0             	test   %rax,%rax
+  803cac:	0f 84 e5 00 00 00    	je     803d97 <dup+0x1b0>
+  803cb2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cba:	48 01 d0             	add    %rdx,%rax
+  803cbd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803cc1:	48 89 c2             	mov    %rax,%rdx
+  803cc4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803ccb:	01 00 00 
+  803cce:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803cd2:	83 e0 01             	and    $0x1,%eax
+  803cd5:	48 85 c0             	test   %rax,%rax
+  803cd8:	0f 84 b9 00 00 00    	je     803d97 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803cde:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ce6:	48 01 d0             	add    %rdx,%rax
+  803ce9:	48 c1 e8 15          	shr    $0x15,%rax
+  803ced:	48 89 c2             	mov    %rax,%rdx
+  803cf0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803cf7:	01 00 00 
+  803cfa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803cfe:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803d01:	48 85 c0             	test   %rax,%rax
+  803d04:	0f 84 8d 00 00 00    	je     803d97 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803d0a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d12:	48 01 d0             	add    %rdx,%rax
+  803d15:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d19:	48 89 c2             	mov    %rax,%rdx
+  803d1c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803d23:	01 00 00 
+  803d26:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d2a:	83 e0 01             	and    $0x1,%eax
+  803d2d:	48 85 c0             	test   %rax,%rax
+  803d30:	74 65                	je     803d97 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803d32:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d3a:	48 01 d0             	add    %rdx,%rax
+  803d3d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d41:	48 89 c2             	mov    %rax,%rdx
+  803d44:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803d4b:	01 00 00 
+  803d4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d52:	25 07 0e 00 00       	and    $0xe07,%eax
+  803d57:	89 c6                	mov    %eax,%esi
+  803d59:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d61:	48 01 c2             	add    %rax,%rdx
+  803d64:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d6c:	48 01 c8             	add    %rcx,%rax
+  803d6f:	41 89 f0             	mov    %esi,%r8d
+  803d72:	48 89 d1             	mov    %rdx,%rcx
+  803d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d7a:	48 89 c6             	mov    %rax,%rsi
+  803d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d82:	48 b8 d2 2f 80 00 00 	movabs $0x802fd2,%rax
+  803d89:	00 00 00 
+  803d8c:	ff d0                	call   *%rax
+  803d8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d95:	78 60                	js     803df7 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803d97:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803d9c:	0f 85 dc fe ff ff    	jne    803c7e <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803da2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da6:	48 c1 e8 0c          	shr    $0xc,%rax
+  803daa:	48 89 c2             	mov    %rax,%rdx
+  803dad:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803db4:	01 00 00 
+  803db7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803dbb:	25 07 0e 00 00       	and    $0xe07,%eax
+  803dc0:	89 c1                	mov    %eax,%ecx
+  803dc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803dca:	41 89 c8             	mov    %ecx,%r8d
+  803dcd:	48 89 d1             	mov    %rdx,%rcx
+  803dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd5:	48 89 c6             	mov    %rax,%rsi
+  803dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddd:	48 b8 d2 2f 80 00 00 	movabs $0x802fd2,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+  803de9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803df0:	78 08                	js     803dfa <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803df2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803df5:	eb 5a                	jmp    803e51 <dup+0x26a>
+        goto err;
+  803df7:	90                   	nop
+  803df8:	eb 01                	jmp    803dfb <dup+0x214>
+    goto err;
+  803dfa:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803dfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dff:	48 89 c6             	mov    %rax,%rsi
+  803e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e07:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803e13:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803e1a:	00 
+  803e1b:	eb 27                	jmp    803e44 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803e1d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e25:	48 01 d0             	add    %rdx,%rax
+  803e28:	48 89 c6             	mov    %rax,%rsi
+  803e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e30:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803e3c:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803e43:	00 
+  803e44:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803e4b:	00 
+  803e4c:	76 cf                	jbe    803e1d <dup+0x236>
+  return r;
+  803e4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803e51:	c9                   	leave
+  803e52:	c3                   	ret
+
+0000000000803e53 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803e53:	55                   	push   %rbp
+  803e54:	48 89 e5             	mov    %rsp,%rbp
+  803e57:	48 83 ec 40          	sub    $0x40,%rsp
+  803e5b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e5e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e62:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e66:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803e6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e6d:	48 89 d6             	mov    %rdx,%rsi
+  803e70:	89 c7                	mov    %eax,%edi
+  803e72:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803e79:	00 00 00 
+  803e7c:	ff d0                	call   *%rax
+  803e7e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e81:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e85:	78 24                	js     803eab <read+0x58>
+  803e87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e8b:	8b 00                	mov    (%rax),%eax
+  803e8d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e91:	48 89 d6             	mov    %rdx,%rsi
+  803e94:	89 c7                	mov    %eax,%edi
+  803e96:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  803e9d:	00 00 00 
+  803ea0:	ff d0                	call   *%rax
+  803ea2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ea5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ea9:	79 0a                	jns    803eb5 <read+0x62>
+    return r;
+  803eab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eae:	48 98                	cltq
+  803eb0:	e9 9e 00 00 00       	jmp    803f53 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803eb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb9:	8b 40 08             	mov    0x8(%rax),%eax
+  803ebc:	83 e0 03             	and    $0x3,%eax
+  803ebf:	83 f8 01             	cmp    $0x1,%eax
+  803ec2:	75 5c                	jne    803f20 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803ec4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ecb:	00 00 00 
+  803ece:	8b 40 04             	mov    0x4(%rax),%eax
+  803ed1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ed6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803edd:	00 00 00 
+  803ee0:	48 98                	cltq
+  803ee2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ee9:	48 01 d0             	add    %rdx,%rax
+  803eec:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803ef2:	8b 00                	mov    (%rax),%eax
+  803ef4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803ef7:	89 c6                	mov    %eax,%esi
+  803ef9:	48 b8 df 66 80 00 00 	movabs $0x8066df,%rax
+  803f00:	00 00 00 
+  803f03:	48 89 c7             	mov    %rax,%rdi
+  803f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0b:	48 b9 fc 11 80 00 00 	movabs $0x8011fc,%rcx
+  803f12:	00 00 00 
+  803f15:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803f17:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803f1e:	eb 33                	jmp    803f53 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803f20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f24:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803f28:	48 85 c0             	test   %rax,%rax
+  803f2b:	75 09                	jne    803f36 <read+0xe3>
+    return -E_NOT_SUPP;
+  803f2d:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803f34:	eb 1d                	jmp    803f53 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803f36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f3a:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f42:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803f46:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803f4a:	48 89 ce             	mov    %rcx,%rsi
+  803f4d:	48 89 c7             	mov    %rax,%rdi
+  803f50:	41 ff d0             	call   *%r8
+}
+  803f53:	c9                   	leave
+  803f54:	c3                   	ret
+
+0000000000803f55 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803f55:	55                   	push   %rbp
+  803f56:	48 89 e5             	mov    %rsp,%rbp
+  803f59:	48 83 ec 30          	sub    $0x30,%rsp
+  803f5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f60:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803f64:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803f68:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803f6f:	eb 49                	jmp    803fba <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803f71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f74:	48 98                	cltq
+  803f76:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f7a:	48 29 c2             	sub    %rax,%rdx
+  803f7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f80:	48 63 c8             	movslq %eax,%rcx
+  803f83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f87:	48 01 c1             	add    %rax,%rcx
+  803f8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f8d:	48 89 ce             	mov    %rcx,%rsi
+  803f90:	89 c7                	mov    %eax,%edi
+  803f92:	48 b8 53 3e 80 00 00 	movabs $0x803e53,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+  803f9e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803fa1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803fa5:	79 07                	jns    803fae <readn+0x59>
+      return m;
+  803fa7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803faa:	48 98                	cltq
+  803fac:	eb 1f                	jmp    803fcd <readn+0x78>
+    if (m == 0)
+  803fae:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803fb2:	74 13                	je     803fc7 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803fb4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803fb7:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803fba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fbd:	48 98                	cltq
+  803fbf:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803fc3:	72 ac                	jb     803f71 <readn+0x1c>
+  803fc5:	eb 01                	jmp    803fc8 <readn+0x73>
+      break;
+  803fc7:	90                   	nop
+  }
+  return tot;
+  803fc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fcb:	48 98                	cltq
+}
+  803fcd:	c9                   	leave
+  803fce:	c3                   	ret
+
+0000000000803fcf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803fcf:	55                   	push   %rbp
+  803fd0:	48 89 e5             	mov    %rsp,%rbp
+  803fd3:	48 83 ec 40          	sub    $0x40,%rsp
+  803fd7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803fda:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803fde:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803fe2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803fe6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fe9:	48 89 d6             	mov    %rdx,%rsi
+  803fec:	89 c7                	mov    %eax,%edi
+  803fee:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ffd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804001:	78 24                	js     804027 <write+0x58>
+  804003:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804007:	8b 00                	mov    (%rax),%eax
+  804009:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80400d:	48 89 d6             	mov    %rdx,%rsi
+  804010:	89 c7                	mov    %eax,%edi
+  804012:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  804019:	00 00 00 
+  80401c:	ff d0                	call   *%rax
+  80401e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804021:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804025:	79 0a                	jns    804031 <write+0x62>
+    return r;
+  804027:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80402a:	48 98                	cltq
+  80402c:	e9 9d 00 00 00       	jmp    8040ce <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804035:	8b 40 08             	mov    0x8(%rax),%eax
+  804038:	83 e0 03             	and    $0x3,%eax
+  80403b:	85 c0                	test   %eax,%eax
+  80403d:	75 5c                	jne    80409b <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80403f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804046:	00 00 00 
+  804049:	8b 40 04             	mov    0x4(%rax),%eax
+  80404c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804051:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804058:	00 00 00 
+  80405b:	48 98                	cltq
+  80405d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804064:	48 01 d0             	add    %rdx,%rax
+  804067:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80406d:	8b 00                	mov    (%rax),%eax
+  80406f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804072:	89 c6                	mov    %eax,%esi
+  804074:	48 b8 fb 66 80 00 00 	movabs $0x8066fb,%rax
+  80407b:	00 00 00 
+  80407e:	48 89 c7             	mov    %rax,%rdi
+  804081:	b8 00 00 00 00       	mov    $0x0,%eax
+  804086:	48 b9 fc 11 80 00 00 	movabs $0x8011fc,%rcx
+  80408d:	00 00 00 
+  804090:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804092:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804099:	eb 33                	jmp    8040ce <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80409b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80409f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8040a3:	48 85 c0             	test   %rax,%rax
+  8040a6:	75 09                	jne    8040b1 <write+0xe2>
+    return -E_NOT_SUPP;
+  8040a8:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8040af:	eb 1d                	jmp    8040ce <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8040b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040b5:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8040b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040c1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8040c5:	48 89 ce             	mov    %rcx,%rsi
+  8040c8:	48 89 c7             	mov    %rax,%rdi
+  8040cb:	41 ff d0             	call   *%r8
+}
+  8040ce:	c9                   	leave
+  8040cf:	c3                   	ret
+
+00000000008040d0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8040d0:	55                   	push   %rbp
+  8040d1:	48 89 e5             	mov    %rsp,%rbp
+  8040d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8040d8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8040db:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8040de:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8040e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e5:	48 89 d6             	mov    %rdx,%rsi
+  8040e8:	89 c7                	mov    %eax,%edi
+  8040ea:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  8040f1:	00 00 00 
+  8040f4:	ff d0                	call   *%rax
+  8040f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040fd:	79 05                	jns    804104 <seek+0x34>
+    return r;
+  8040ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804102:	eb 0f                	jmp    804113 <seek+0x43>
+  fd->fd_offset = offset;
+  804104:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804108:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80410b:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80410e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804113:	c9                   	leave
+  804114:	c3                   	ret
+
+0000000000804115 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804115:	55                   	push   %rbp
+  804116:	48 89 e5             	mov    %rsp,%rbp
+  804119:	48 83 ec 30          	sub    $0x30,%rsp
+  80411d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804120:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804123:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804127:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80412a:	48 89 d6             	mov    %rdx,%rsi
+  80412d:	89 c7                	mov    %eax,%edi
+  80412f:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  804136:	00 00 00 
+  804139:	ff d0                	call   *%rax
+  80413b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80413e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804142:	78 24                	js     804168 <ftruncate+0x53>
+  804144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804148:	8b 00                	mov    (%rax),%eax
+  80414a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80414e:	48 89 d6             	mov    %rdx,%rsi
+  804151:	89 c7                	mov    %eax,%edi
+  804153:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  80415a:	00 00 00 
+  80415d:	ff d0                	call   *%rax
+  80415f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804162:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804166:	79 08                	jns    804170 <ftruncate+0x5b>
+    return r;
+  804168:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80416b:	e9 92 00 00 00       	jmp    804202 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804170:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804174:	8b 40 08             	mov    0x8(%rax),%eax
+  804177:	83 e0 03             	and    $0x3,%eax
+  80417a:	85 c0                	test   %eax,%eax
+  80417c:	75 5a                	jne    8041d8 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80417e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804185:	00 00 00 
+  804188:	8b 40 04             	mov    0x4(%rax),%eax
+  80418b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804190:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804197:	00 00 00 
+  80419a:	48 98                	cltq
+  80419c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8041a3:	48 01 d0             	add    %rdx,%rax
+  8041a6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8041ac:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8041ae:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8041b1:	89 c6                	mov    %eax,%esi
+  8041b3:	48 b8 18 67 80 00 00 	movabs $0x806718,%rax
+  8041ba:	00 00 00 
+  8041bd:	48 89 c7             	mov    %rax,%rdi
+  8041c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c5:	48 b9 fc 11 80 00 00 	movabs $0x8011fc,%rcx
+  8041cc:	00 00 00 
+  8041cf:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8041d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041d6:	eb 2a                	jmp    804202 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8041d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041dc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8041e0:	48 85 c0             	test   %rax,%rax
+  8041e3:	75 07                	jne    8041ec <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8041e5:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8041ea:	eb 16                	jmp    804202 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8041ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041f0:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8041f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041f8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8041fb:	89 d6                	mov    %edx,%esi
+  8041fd:	48 89 c7             	mov    %rax,%rdi
+  804200:	ff d1                	call   *%rcx
+}
+  804202:	c9                   	leave
+  804203:	c3                   	ret
+
+0000000000804204 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804204:	55                   	push   %rbp
+  804205:	48 89 e5             	mov    %rsp,%rbp
+  804208:	48 83 ec 30          	sub    $0x30,%rsp
+  80420c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80420f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804213:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804217:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80421a:	48 89 d6             	mov    %rdx,%rsi
+  80421d:	89 c7                	mov    %eax,%edi
+  80421f:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  804226:	00 00 00 
+  804229:	ff d0                	call   *%rax
+  80422b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80422e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804232:	78 24                	js     804258 <fstat+0x54>
+  804234:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804238:	8b 00                	mov    (%rax),%eax
+  80423a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80423e:	48 89 d6             	mov    %rdx,%rsi
+  804241:	89 c7                	mov    %eax,%edi
+  804243:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  80424a:	00 00 00 
+  80424d:	ff d0                	call   *%rax
+  80424f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804252:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804256:	79 05                	jns    80425d <fstat+0x59>
+    return r;
+  804258:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80425b:	eb 5e                	jmp    8042bb <fstat+0xb7>
+  if (!dev->dev_stat)
+  80425d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804261:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804265:	48 85 c0             	test   %rax,%rax
+  804268:	75 07                	jne    804271 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80426a:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80426f:	eb 4a                	jmp    8042bb <fstat+0xb7>
+  stat->st_name[0] = 0;
+  804271:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804275:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  804278:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80427c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804283:	00 00 00 
+  stat->st_isdir   = 0;
+  804286:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80428a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804291:	00 00 00 
+  stat->st_dev     = dev;
+  804294:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804298:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80429c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8042a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042a7:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8042ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042af:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8042b3:	48 89 d6             	mov    %rdx,%rsi
+  8042b6:	48 89 c7             	mov    %rax,%rdi
+  8042b9:	ff d1                	call   *%rcx
+}
+  8042bb:	c9                   	leave
+  8042bc:	c3                   	ret
+
+00000000008042bd <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8042bd:	55                   	push   %rbp
+  8042be:	48 89 e5             	mov    %rsp,%rbp
+  8042c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8042c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8042cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d1:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8042d7:	83 f8 20             	cmp    $0x20,%eax
+  8042da:	75 07                	jne    8042e3 <pollwait_key+0x26>
+    return -E_INVAL;
+  8042dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8042e1:	eb 5f                	jmp    804342 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8042e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042e7:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8042ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042f1:	48 63 d2             	movslq %edx,%rdx
+  8042f4:	48 c1 e2 04          	shl    $0x4,%rdx
+  8042f8:	48 01 c2             	add    %rax,%rdx
+  8042fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042ff:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804302:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804306:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80430c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804310:	8b 00                	mov    (%rax),%eax
+  804312:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804316:	48 63 c9             	movslq %ecx,%rcx
+  804319:	48 c1 e1 04          	shl    $0x4,%rcx
+  80431d:	48 01 ca             	add    %rcx,%rdx
+  804320:	48 83 c2 08          	add    $0x8,%rdx
+  804324:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  804326:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80432a:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804330:	8d 50 01             	lea    0x1(%rax),%edx
+  804333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804337:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80433d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804342:	c9                   	leave
+  804343:	c3                   	ret
+
+0000000000804344 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  804344:	55                   	push   %rbp
+  804345:	48 89 e5             	mov    %rsp,%rbp
+  804348:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80434f:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  804356:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80435c:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  804363:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80436a:	00 
+  int i, r, ready, ipc = 0;
+  80436b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  804372:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  804379:	00 
+  80437a:	74 45                	je     8043c1 <poll+0x7d>
+  80437c:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  804383:	ff 
+  804384:	74 3b                	je     8043c1 <poll+0x7d>
+    now      = vsys_clock_ns();
+  804386:	48 b8 7f 58 80 00 00 	movabs $0x80587f,%rax
+  80438d:	00 00 00 
+  804390:	ff d0                	call   *%rax
+  804392:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  804396:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80439a:	48 f7 d0             	not    %rax
+  80439d:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8043a4:	73 10                	jae    8043b6 <poll+0x72>
+  8043a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043aa:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8043b1:	48 01 d0             	add    %rdx,%rax
+  8043b4:	eb 07                	jmp    8043bd <poll+0x79>
+  8043b6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8043bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8043c1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8043c8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8043cf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8043d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8043dd:	e9 46 02 00 00       	jmp    804628 <poll+0x2e4>
+      fds[i].revents = 0;
+  8043e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043e5:	48 63 d0             	movslq %eax,%rdx
+  8043e8:	48 89 d0             	mov    %rdx,%rax
+  8043eb:	48 01 c0             	add    %rax,%rax
+  8043ee:	48 01 d0             	add    %rdx,%rax
+  8043f1:	48 c1 e0 02          	shl    $0x2,%rax
+  8043f5:	48 89 c2             	mov    %rax,%rdx
+  8043f8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8043ff:	48 01 d0             	add    %rdx,%rax
+  804402:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804409:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80440c:	48 63 d0             	movslq %eax,%rdx
+  80440f:	48 89 d0             	mov    %rdx,%rax
+  804412:	48 01 c0             	add    %rax,%rax
+  804415:	48 01 d0             	add    %rdx,%rax
+  804418:	48 c1 e0 02          	shl    $0x2,%rax
+  80441c:	48 89 c2             	mov    %rax,%rdx
+  80441f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804426:	48 01 d0             	add    %rdx,%rax
+  804429:	8b 00                	mov    (%rax),%eax
+  80442b:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80442e:	75 62                	jne    804492 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  804430:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804433:	48 63 d0             	movslq %eax,%rdx
+  804436:	48 89 d0             	mov    %rdx,%rax
+  804439:	48 01 c0             	add    %rax,%rax
+  80443c:	48 01 d0             	add    %rdx,%rax
+  80443f:	48 c1 e0 02          	shl    $0x2,%rax
+  804443:	48 89 c2             	mov    %rax,%rdx
+  804446:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80444d:	48 01 d0             	add    %rdx,%rax
+  804450:	8b 40 04             	mov    0x4(%rax),%eax
+  804453:	83 e0 01             	and    $0x1,%eax
+  804456:	85 c0                	test   %eax,%eax
+  804458:	0f 84 9b 01 00 00    	je     8045f9 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80445e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804461:	48 63 d0             	movslq %eax,%rdx
+  804464:	48 89 d0             	mov    %rdx,%rax
+  804467:	48 01 c0             	add    %rax,%rax
+  80446a:	48 01 d0             	add    %rdx,%rax
+  80446d:	48 c1 e0 02          	shl    $0x2,%rax
+  804471:	48 89 c2             	mov    %rax,%rdx
+  804474:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80447b:	48 01 c2             	add    %rax,%rdx
+  80447e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804481:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  804484:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804487:	83 c8 04             	or     $0x4,%eax
+  80448a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80448d:	e9 67 01 00 00       	jmp    8045f9 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804492:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804495:	48 63 d0             	movslq %eax,%rdx
+  804498:	48 89 d0             	mov    %rdx,%rax
+  80449b:	48 01 c0             	add    %rax,%rax
+  80449e:	48 01 d0             	add    %rdx,%rax
+  8044a1:	48 c1 e0 02          	shl    $0x2,%rax
+  8044a5:	48 89 c2             	mov    %rax,%rdx
+  8044a8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044af:	48 01 d0             	add    %rdx,%rax
+  8044b2:	8b 00                	mov    (%rax),%eax
+  8044b4:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8044bb:	48 89 d6             	mov    %rdx,%rsi
+  8044be:	89 c7                	mov    %eax,%edi
+  8044c0:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  8044c7:	00 00 00 
+  8044ca:	ff d0                	call   *%rax
+  8044cc:	85 c0                	test   %eax,%eax
+  8044ce:	78 25                	js     8044f5 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8044d0:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8044d7:	8b 00                	mov    (%rax),%eax
+  8044d9:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8044e0:	48 89 d6             	mov    %rdx,%rsi
+  8044e3:	89 c7                	mov    %eax,%edi
+  8044e5:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  8044ec:	00 00 00 
+  8044ef:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8044f1:	85 c0                	test   %eax,%eax
+  8044f3:	79 2c                	jns    804521 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8044f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044f8:	48 63 d0             	movslq %eax,%rdx
+  8044fb:	48 89 d0             	mov    %rdx,%rax
+  8044fe:	48 01 c0             	add    %rax,%rax
+  804501:	48 01 d0             	add    %rdx,%rax
+  804504:	48 c1 e0 02          	shl    $0x2,%rax
+  804508:	48 89 c2             	mov    %rax,%rdx
+  80450b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804512:	48 01 d0             	add    %rdx,%rax
+  804515:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80451c:	e9 d8 00 00 00       	jmp    8045f9 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804521:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804528:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80452c:	48 85 c0             	test   %rax,%rax
+  80452f:	74 7d                	je     8045ae <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  804531:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804538:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80453c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80453f:	48 63 d0             	movslq %eax,%rdx
+  804542:	48 89 d0             	mov    %rdx,%rax
+  804545:	48 01 c0             	add    %rax,%rax
+  804548:	48 01 d0             	add    %rdx,%rax
+  80454b:	48 c1 e0 02          	shl    $0x2,%rax
+  80454f:	48 89 c2             	mov    %rax,%rdx
+  804552:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804559:	48 01 d0             	add    %rdx,%rax
+  80455c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80455f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804566:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80456d:	89 ce                	mov    %ecx,%esi
+  80456f:	48 89 c7             	mov    %rax,%rdi
+  804572:	41 ff d0             	call   *%r8
+  804575:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804578:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80457c:	79 08                	jns    804586 <poll+0x242>
+          return r;
+  80457e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804581:	e9 45 01 00 00       	jmp    8046cb <poll+0x387>
+        fds[i].revents = r;
+  804586:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804589:	48 63 d0             	movslq %eax,%rdx
+  80458c:	48 89 d0             	mov    %rdx,%rax
+  80458f:	48 01 c0             	add    %rax,%rax
+  804592:	48 01 d0             	add    %rdx,%rax
+  804595:	48 c1 e0 02          	shl    $0x2,%rax
+  804599:	48 89 c2             	mov    %rax,%rdx
+  80459c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8045a3:	48 01 c2             	add    %rax,%rdx
+  8045a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045a9:	89 42 08             	mov    %eax,0x8(%rdx)
+  8045ac:	eb 4b                	jmp    8045f9 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8045ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045b1:	48 63 d0             	movslq %eax,%rdx
+  8045b4:	48 89 d0             	mov    %rdx,%rax
+  8045b7:	48 01 c0             	add    %rax,%rax
+  8045ba:	48 01 d0             	add    %rdx,%rax
+  8045bd:	48 c1 e0 02          	shl    $0x2,%rax
+  8045c1:	48 89 c2             	mov    %rax,%rdx
+  8045c4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8045cb:	48 01 d0             	add    %rdx,%rax
+  8045ce:	8b 48 04             	mov    0x4(%rax),%ecx
+  8045d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045d4:	48 63 d0             	movslq %eax,%rdx
+  8045d7:	48 89 d0             	mov    %rdx,%rax
+  8045da:	48 01 c0             	add    %rax,%rax
+  8045dd:	48 01 d0             	add    %rdx,%rax
+  8045e0:	48 c1 e0 02          	shl    $0x2,%rax
+  8045e4:	48 89 c2             	mov    %rax,%rdx
+  8045e7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8045ee:	48 01 d0             	add    %rdx,%rax
+  8045f1:	83 e1 03             	and    $0x3,%ecx
+  8045f4:	89 ca                	mov    %ecx,%edx
+  8045f6:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8045f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045fc:	48 63 d0             	movslq %eax,%rdx
+  8045ff:	48 89 d0             	mov    %rdx,%rax
+  804602:	48 01 c0             	add    %rax,%rax
+  804605:	48 01 d0             	add    %rdx,%rax
+  804608:	48 c1 e0 02          	shl    $0x2,%rax
+  80460c:	48 89 c2             	mov    %rax,%rdx
+  80460f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804616:	48 01 d0             	add    %rdx,%rax
+  804619:	8b 40 08             	mov    0x8(%rax),%eax
+  80461c:	85 c0                	test   %eax,%eax
+  80461e:	74 04                	je     804624 <poll+0x2e0>
+        ready++;
+  804620:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804624:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804628:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80462b:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804631:	0f 8c ab fd ff ff    	jl     8043e2 <poll+0x9e>
+    }
+    if (ready)
+  804637:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80463b:	74 08                	je     804645 <poll+0x301>
+      return ready;
+  80463d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804640:	e9 86 00 00 00       	jmp    8046cb <poll+0x387>
+
+    if (deadline) {
+  804645:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80464a:	74 30                	je     80467c <poll+0x338>
+      now     = vsys_clock_ns();
+  80464c:	48 b8 7f 58 80 00 00 	movabs $0x80587f,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+  804658:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80465c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804660:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804664:	73 0a                	jae    804670 <poll+0x32c>
+  804666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80466a:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80466e:	eb 05                	jmp    804675 <poll+0x331>
+  804670:	b8 00 00 00 00       	mov    $0x0,%eax
+  804675:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80467c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80467f:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804682:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804689:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804690:	48 89 c7             	mov    %rax,%rdi
+  804693:	48 b8 c2 33 80 00 00 	movabs $0x8033c2,%rax
+  80469a:	00 00 00 
+  80469d:	ff d0                	call   *%rax
+  80469f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8046a2:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8046a6:	75 07                	jne    8046af <poll+0x36b>
+      return 0;
+  8046a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ad:	eb 1c                	jmp    8046cb <poll+0x387>
+    if (r < 0)
+  8046af:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8046b3:	79 05                	jns    8046ba <poll+0x376>
+      return r;
+  8046b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046b8:	eb 11                	jmp    8046cb <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8046ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046bd:	c1 f8 02             	sar    $0x2,%eax
+  8046c0:	83 e0 01             	and    $0x1,%eax
+  8046c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8046c6:	e9 f6 fc ff ff       	jmp    8043c1 <poll+0x7d>
+  }
+}
+  8046cb:	c9                   	leave
+  8046cc:	c3                   	ret
+
+00000000008046cd <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8046cd:	55                   	push   %rbp
+  8046ce:	48 89 e5             	mov    %rsp,%rbp
+  8046d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8046d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8046d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8046dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8046e6:	48 89 c7             	mov    %rax,%rdi
+  8046e9:	48 b8 bb 47 80 00 00 	movabs $0x8047bb,%rax
+  8046f0:	00 00 00 
+  8046f3:	ff d0                	call   *%rax
+  8046f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046fc:	79 05                	jns    804703 <stat+0x36>
+    return fd;
+  8046fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804701:	eb 2f                	jmp    804732 <stat+0x65>
+  r = fstat(fd, stat);
+  804703:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804707:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80470a:	48 89 d6             	mov    %rdx,%rsi
+  80470d:	89 c7                	mov    %eax,%edi
+  80470f:	48 b8 04 42 80 00 00 	movabs $0x804204,%rax
+  804716:	00 00 00 
+  804719:	ff d0                	call   *%rax
+  80471b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80471e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804721:	89 c7                	mov    %eax,%edi
+  804723:	48 b8 6c 3b 80 00 00 	movabs $0x803b6c,%rax
+  80472a:	00 00 00 
+  80472d:	ff d0                	call   *%rax
+  return r;
+  80472f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804732:	c9                   	leave
+  804733:	c3                   	ret
+
+0000000000804734 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804734:	55                   	push   %rbp
+  804735:	48 89 e5             	mov    %rsp,%rbp
+  804738:	48 83 ec 10          	sub    $0x10,%rsp
+  80473c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80473f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  804743:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80474a:	00 00 00 
+  80474d:	8b 00                	mov    (%rax),%eax
+  80474f:	85 c0                	test   %eax,%eax
+  804751:	75 1d                	jne    804770 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804753:	bf 03 00 00 00       	mov    $0x3,%edi
+  804758:	48 b8 9a 5e 80 00 00 	movabs $0x805e9a,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+  804764:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80476b:	00 00 00 
+  80476e:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804770:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804777:	00 00 00 
+  80477a:	8b 00                	mov    (%rax),%eax
+  80477c:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80477f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804784:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80478b:	00 00 00 
+  80478e:	89 c7                	mov    %eax,%edi
+  804790:	48 b8 ed 5d 80 00 00 	movabs $0x805ded,%rax
+  804797:	00 00 00 
+  80479a:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80479c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a5:	48 89 c6             	mov    %rax,%rsi
+  8047a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ad:	48 b8 70 5c 80 00 00 	movabs $0x805c70,%rax
+  8047b4:	00 00 00 
+  8047b7:	ff d0                	call   *%rax
+}
+  8047b9:	c9                   	leave
+  8047ba:	c3                   	ret
+
+00000000008047bb <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8047bb:	55                   	push   %rbp
+  8047bc:	48 89 e5             	mov    %rsp,%rbp
+  8047bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8047c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8047c7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8047ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ce:	48 89 c7             	mov    %rax,%rdi
+  8047d1:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  8047d8:	00 00 00 
+  8047db:	ff d0                	call   *%rax
+  8047dd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8047e2:	7e 0a                	jle    8047ee <open+0x33>
+    return -E_BAD_PATH;
+  8047e4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8047e9:	e9 a8 00 00 00       	jmp    804896 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8047ee:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8047f2:	48 89 c7             	mov    %rax,%rdi
+  8047f5:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+  804801:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804804:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804808:	79 08                	jns    804812 <open+0x57>
+    return r;
+  80480a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80480d:	e9 84 00 00 00       	jmp    804896 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804812:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804816:	48 89 c6             	mov    %rax,%rsi
+  804819:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804820:	00 00 00 
+  804823:	48 89 c7             	mov    %rax,%rdi
+  804826:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  80482d:	00 00 00 
+  804830:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804832:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804839:	00 00 00 
+  80483c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80483f:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804845:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804849:	48 89 c6             	mov    %rax,%rsi
+  80484c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804851:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804858:	00 00 00 
+  80485b:	ff d0                	call   *%rax
+  80485d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804860:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804864:	79 1d                	jns    804883 <open+0xc8>
+    fd_close(fd, 0);
+  804866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80486a:	be 00 00 00 00       	mov    $0x0,%esi
+  80486f:	48 89 c7             	mov    %rax,%rdi
+  804872:	48 b8 cd 39 80 00 00 	movabs $0x8039cd,%rax
+  804879:	00 00 00 
+  80487c:	ff d0                	call   *%rax
+    return r;
+  80487e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804881:	eb 13                	jmp    804896 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804883:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804887:	48 89 c7             	mov    %rax,%rdi
+  80488a:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  804891:	00 00 00 
+  804894:	ff d0                	call   *%rax
+}
+  804896:	c9                   	leave
+  804897:	c3                   	ret
+
+0000000000804898 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804898:	55                   	push   %rbp
+  804899:	48 89 e5             	mov    %rsp,%rbp
+  80489c:	48 83 ec 10          	sub    $0x10,%rsp
+  8048a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8048a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048a8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8048ab:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8048b2:	00 00 00 
+  8048b5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8048b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8048bc:	bf 06 00 00 00       	mov    $0x6,%edi
+  8048c1:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  8048c8:	00 00 00 
+  8048cb:	ff d0                	call   *%rax
+}
+  8048cd:	c9                   	leave
+  8048ce:	c3                   	ret
+
+00000000008048cf <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8048cf:	55                   	push   %rbp
+  8048d0:	48 89 e5             	mov    %rsp,%rbp
+  8048d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8048d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8048df:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8048e3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8048e8:	74 07                	je     8048f1 <devfile_read+0x22>
+  8048ea:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8048ef:	75 0a                	jne    8048fb <devfile_read+0x2c>
+  return E_INVAL;
+  8048f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8048f6:	e9 b4 00 00 00       	jmp    8049af <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8048fb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804902:	00 
+  while (n) {
+  804903:	e9 98 00 00 00       	jmp    8049a0 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804908:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80490c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80490f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804916:	00 00 00 
+  804919:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80491b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804922:	00 00 00 
+  804925:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804929:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80492d:	be 00 00 00 00       	mov    $0x0,%esi
+  804932:	bf 03 00 00 00       	mov    $0x3,%edi
+  804937:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  80493e:	00 00 00 
+  804941:	ff d0                	call   *%rax
+  804943:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804946:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80494a:	7f 13                	jg     80495f <devfile_read+0x90>
+      return res ? res : res0;
+  80494c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804950:	74 07                	je     804959 <devfile_read+0x8a>
+  804952:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804955:	48 98                	cltq
+  804957:	eb 56                	jmp    8049af <devfile_read+0xe0>
+  804959:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495d:	eb 50                	jmp    8049af <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80495f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804962:	48 63 d0             	movslq %eax,%rdx
+  804965:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804969:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804970:	00 00 00 
+  804973:	48 89 ce             	mov    %rcx,%rsi
+  804976:	48 89 c7             	mov    %rax,%rdi
+  804979:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  804980:	00 00 00 
+  804983:	ff d0                	call   *%rax
+
+    buf += res;
+  804985:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804988:	48 98                	cltq
+  80498a:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80498e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804991:	48 98                	cltq
+  804993:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804997:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80499a:	48 98                	cltq
+  80499c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8049a0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8049a5:	0f 85 5d ff ff ff    	jne    804908 <devfile_read+0x39>
+  }
+
+  return res0;
+  8049ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8049af:	c9                   	leave
+  8049b0:	c3                   	ret
+
+00000000008049b1 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8049b1:	55                   	push   %rbp
+  8049b2:	48 89 e5             	mov    %rsp,%rbp
+  8049b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8049b9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049bd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8049c1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8049c5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8049ca:	74 07                	je     8049d3 <devfile_write+0x22>
+  8049cc:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8049d1:	75 0a                	jne    8049dd <devfile_write+0x2c>
+  return E_INVAL;
+  8049d3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8049d8:	e9 c9 00 00 00       	jmp    804aa6 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8049dd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8049e4:	00 
+
+  while (n) {
+  8049e5:	e9 ad 00 00 00       	jmp    804a97 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8049ea:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8049f2:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8049f9:	00 
+  8049fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a02:	48 39 c2             	cmp    %rax,%rdx
+  804a05:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804a0d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a11:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a15:	48 89 c6             	mov    %rax,%rsi
+  804a18:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804a1f:	00 00 00 
+  804a22:	48 89 c7             	mov    %rax,%rdi
+  804a25:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  804a2c:	00 00 00 
+  804a2f:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804a31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a35:	8b 40 0c             	mov    0xc(%rax),%eax
+  804a38:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804a3f:	00 00 00 
+  804a42:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804a44:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804a4b:	00 00 00 
+  804a4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a52:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804a56:	be 00 00 00 00       	mov    $0x0,%esi
+  804a5b:	bf 04 00 00 00       	mov    $0x4,%edi
+  804a60:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804a67:	00 00 00 
+  804a6a:	ff d0                	call   *%rax
+  804a6c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804a6f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a73:	79 07                	jns    804a7c <devfile_write+0xcb>
+      return res;
+  804a75:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a78:	48 98                	cltq
+  804a7a:	eb 2a                	jmp    804aa6 <devfile_write+0xf5>
+
+    buf += res;
+  804a7c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a7f:	48 98                	cltq
+  804a81:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804a85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a88:	48 98                	cltq
+  804a8a:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804a8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a91:	48 98                	cltq
+  804a93:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804a97:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804a9c:	0f 85 48 ff ff ff    	jne    8049ea <devfile_write+0x39>
+  }
+
+  return res0;
+  804aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804aa6:	c9                   	leave
+  804aa7:	c3                   	ret
+
+0000000000804aa8 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804aa8:	55                   	push   %rbp
+  804aa9:	48 89 e5             	mov    %rsp,%rbp
+  804aac:	48 83 ec 20          	sub    $0x20,%rsp
+  804ab0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ab4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804abc:	8b 40 0c             	mov    0xc(%rax),%eax
+  804abf:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804ac6:	00 00 00 
+  804ac9:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804acb:	be 00 00 00 00       	mov    $0x0,%esi
+  804ad0:	bf 05 00 00 00       	mov    $0x5,%edi
+  804ad5:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804adc:	00 00 00 
+  804adf:	ff d0                	call   *%rax
+  804ae1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ae4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ae8:	79 05                	jns    804aef <devfile_stat+0x47>
+    return r;
+  804aea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804aed:	eb 59                	jmp    804b48 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804aef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804af3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804afa:	00 00 00 
+  804afd:	48 89 d6             	mov    %rdx,%rsi
+  804b00:	48 89 c7             	mov    %rax,%rdi
+  804b03:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  804b0a:	00 00 00 
+  804b0d:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804b0f:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804b16:	00 00 00 
+  804b19:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804b1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b23:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804b29:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804b30:	00 00 00 
+  804b33:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804b39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b3d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804b43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b48:	c9                   	leave
+  804b49:	c3                   	ret
+
+0000000000804b4a <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804b4a:	55                   	push   %rbp
+  804b4b:	48 89 e5             	mov    %rsp,%rbp
+  804b4e:	48 83 ec 10          	sub    $0x10,%rsp
+  804b52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804b56:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804b59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b5d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b60:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804b67:	00 00 00 
+  804b6a:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804b6c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804b73:	00 00 00 
+  804b76:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804b79:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804b7c:	be 00 00 00 00       	mov    $0x0,%esi
+  804b81:	bf 02 00 00 00       	mov    $0x2,%edi
+  804b86:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804b8d:	00 00 00 
+  804b90:	ff d0                	call   *%rax
+}
+  804b92:	c9                   	leave
+  804b93:	c3                   	ret
+
+0000000000804b94 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804b94:	55                   	push   %rbp
+  804b95:	48 89 e5             	mov    %rsp,%rbp
+  804b98:	48 83 ec 18          	sub    $0x18,%rsp
+  804b9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804ba0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804ba3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804ba7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804baa:	83 e0 03             	and    $0x3,%eax
+}
+  804bad:	c9                   	leave
+  804bae:	c3                   	ret
+
+0000000000804baf <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804baf:	55                   	push   %rbp
+  804bb0:	48 89 e5             	mov    %rsp,%rbp
+  804bb3:	48 83 ec 10          	sub    $0x10,%rsp
+  804bb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804bbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bbf:	48 89 c7             	mov    %rax,%rdi
+  804bc2:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  804bc9:	00 00 00 
+  804bcc:	ff d0                	call   *%rax
+  804bce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804bd3:	7e 07                	jle    804bdc <remove+0x2d>
+    return -E_BAD_PATH;
+  804bd5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804bda:	eb 36                	jmp    804c12 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804bdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804be0:	48 89 c6             	mov    %rax,%rsi
+  804be3:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804bea:	00 00 00 
+  804bed:	48 89 c7             	mov    %rax,%rdi
+  804bf0:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  804bf7:	00 00 00 
+  804bfa:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804bfc:	be 00 00 00 00       	mov    $0x0,%esi
+  804c01:	bf 07 00 00 00       	mov    $0x7,%edi
+  804c06:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804c0d:	00 00 00 
+  804c10:	ff d0                	call   *%rax
+}
+  804c12:	c9                   	leave
+  804c13:	c3                   	ret
+
+0000000000804c14 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804c14:	55                   	push   %rbp
+  804c15:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804c18:	be 00 00 00 00       	mov    $0x0,%esi
+  804c1d:	bf 08 00 00 00       	mov    $0x8,%edi
+  804c22:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804c29:	00 00 00 
+  804c2c:	ff d0                	call   *%rax
+}
+  804c2e:	5d                   	pop    %rbp
+  804c2f:	c3                   	ret
+
+0000000000804c30 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804c30:	55                   	push   %rbp
+  804c31:	48 89 e5             	mov    %rsp,%rbp
+  804c34:	48 83 ec 20          	sub    $0x20,%rsp
+  804c38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804c3c:	be 00 00 00 00       	mov    $0x0,%esi
+  804c41:	bf 09 00 00 00       	mov    $0x9,%edi
+  804c46:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804c4d:	00 00 00 
+  804c50:	ff d0                	call   *%rax
+  804c52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c59:	79 05                	jns    804c60 <fs_stats+0x30>
+    return r;
+  804c5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c5e:	eb 2a                	jmp    804c8a <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804c60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c64:	ba 68 00 00 00       	mov    $0x68,%edx
+  804c69:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804c70:	00 00 00 
+  804c73:	48 89 ce             	mov    %rcx,%rsi
+  804c76:	48 89 c7             	mov    %rax,%rdi
+  804c79:	48 b8 ef 26 80 00 00 	movabs $0x8026ef,%rax
+  804c80:	00 00 00 
+  804c83:	ff d0                	call   *%rax
+  return 0;
+  804c85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c8a:	c9                   	leave
+  804c8b:	c3                   	ret
+
+0000000000804c8c <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804c8c:	55                   	push   %rbp
+  804c8d:	48 89 e5             	mov    %rsp,%rbp
+  804c90:	48 83 ec 10          	sub    $0x10,%rsp
+  804c94:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804c97:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804c9e:	00 00 00 
+  804ca1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ca4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804ca6:	be 00 00 00 00       	mov    $0x0,%esi
+  804cab:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804cb0:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804cb7:	00 00 00 
+  804cba:	ff d0                	call   *%rax
+}
+  804cbc:	c9                   	leave
+  804cbd:	c3                   	ret
+
+0000000000804cbe <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804cbe:	55                   	push   %rbp
+  804cbf:	48 89 e5             	mov    %rsp,%rbp
+  804cc2:	48 83 ec 10          	sub    $0x10,%rsp
+  804cc6:	89 f8                	mov    %edi,%eax
+  804cc8:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804ccb:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804ccf:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804cd6:	00 00 00 
+  804cd9:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  804ce0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804ce5:	48 b8 34 47 80 00 00 	movabs $0x804734,%rax
+  804cec:	00 00 00 
+  804cef:	ff d0                	call   *%rax
+}
+  804cf1:	c9                   	leave
+  804cf2:	c3                   	ret
+
+0000000000804cf3 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804cf3:	55                   	push   %rbp
+  804cf4:	48 89 e5             	mov    %rsp,%rbp
+  804cf7:	48 83 ec 10          	sub    $0x10,%rsp
+  804cfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804cff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d03:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804d08:	48 89 c7             	mov    %rax,%rdi
+  804d0b:	48 b8 19 4d 80 00 00 	movabs $0x804d19,%rax
+  804d12:	00 00 00 
+  804d15:	ff d0                	call   *%rax
+}
+  804d17:	c9                   	leave
+  804d18:	c3                   	ret
+
+0000000000804d19 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804d19:	55                   	push   %rbp
+  804d1a:	48 89 e5             	mov    %rsp,%rbp
+  804d1d:	48 83 ec 50          	sub    $0x50,%rsp
+  804d21:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804d25:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804d29:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804d30:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804d31:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804d36:	74 0a                	je     804d42 <pipe_size+0x29>
+  804d38:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804d3f:	00 
+  804d40:	76 0a                	jbe    804d4c <pipe_size+0x33>
+    return -E_INVAL;
+  804d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d47:	e9 cc 02 00 00       	jmp    805018 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804d4c:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804d50:	48 89 c7             	mov    %rax,%rdi
+  804d53:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  804d5a:	00 00 00 
+  804d5d:	ff d0                	call   *%rax
+  804d5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d66:	0f 88 a8 02 00 00    	js     805014 <pipe_size+0x2fb>
+  804d6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d70:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d75:	48 89 c6             	mov    %rax,%rsi
+  804d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7d:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  804d84:	00 00 00 
+  804d87:	ff d0                	call   *%rax
+  804d89:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d90:	0f 88 7e 02 00 00    	js     805014 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804d96:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804d9a:	48 89 c7             	mov    %rax,%rdi
+  804d9d:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  804da4:	00 00 00 
+  804da7:	ff d0                	call   *%rax
+  804da9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804db0:	0f 88 43 02 00 00    	js     804ff9 <pipe_size+0x2e0>
+  804db6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804dba:	ba 07 04 00 00       	mov    $0x407,%edx
+  804dbf:	48 89 c6             	mov    %rax,%rsi
+  804dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dc7:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  804dce:	00 00 00 
+  804dd1:	ff d0                	call   *%rax
+  804dd3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dd6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dda:	0f 88 19 02 00 00    	js     804ff9 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804de0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804de4:	48 89 c7             	mov    %rax,%rdi
+  804de7:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  804dee:	00 00 00 
+  804df1:	ff d0                	call   *%rax
+  804df3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804df7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804dfe:	00 
+  804dff:	e9 a2 00 00 00       	jmp    804ea6 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804e04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e08:	48 c1 e0 0c          	shl    $0xc,%rax
+  804e0c:	48 89 c2             	mov    %rax,%rdx
+  804e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e13:	48 01 d0             	add    %rdx,%rax
+  804e16:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e1b:	48 89 c6             	mov    %rax,%rsi
+  804e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e23:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  804e2a:	00 00 00 
+  804e2d:	ff d0                	call   *%rax
+  804e2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e36:	0f 88 37 01 00 00    	js     804f73 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804e3c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e40:	48 89 c7             	mov    %rax,%rdi
+  804e43:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  804e4a:	00 00 00 
+  804e4d:	ff d0                	call   *%rax
+  804e4f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e53:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804e57:	48 01 c2             	add    %rax,%rdx
+  804e5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e5e:	48 c1 e0 0c          	shl    $0xc,%rax
+  804e62:	48 89 c1             	mov    %rax,%rcx
+  804e65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e69:	48 01 c8             	add    %rcx,%rax
+  804e6c:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804e72:	48 89 d1             	mov    %rdx,%rcx
+  804e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e7a:	48 89 c6             	mov    %rax,%rsi
+  804e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e82:	48 b8 d2 2f 80 00 00 	movabs $0x802fd2,%rax
+  804e89:	00 00 00 
+  804e8c:	ff d0                	call   *%rax
+  804e8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e95:	79 0a                	jns    804ea1 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804e97:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804e9c:	e9 d3 00 00 00       	jmp    804f74 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804ea1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804ea6:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804ead:	00 
+  804eae:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804eb2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb6:	48 01 d0             	add    %rdx,%rax
+  804eb9:	48 83 c0 1f          	add    $0x1f,%rax
+  804ebd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eca:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804ece:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ed2:	48 29 d0             	sub    %rdx,%rax
+  804ed5:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ed9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804edd:	0f 82 21 ff ff ff    	jb     804e04 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804eeb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eef:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804ef3:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804ef7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804efb:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804f02:	00 00 00 
+  804f05:	8b 12                	mov    (%rdx),%edx
+  804f07:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804f09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f0d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804f14:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f18:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804f1f:	00 00 00 
+  804f22:	8b 12                	mov    (%rdx),%edx
+  804f24:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804f26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f2a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804f31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f35:	48 89 c7             	mov    %rax,%rdi
+  804f38:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  804f3f:	00 00 00 
+  804f42:	ff d0                	call   *%rax
+  804f44:	89 c2                	mov    %eax,%edx
+  804f46:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804f4a:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804f4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f50:	48 89 c7             	mov    %rax,%rdi
+  804f53:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  804f5a:	00 00 00 
+  804f5d:	ff d0                	call   *%rax
+  804f5f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f63:	48 83 c2 04          	add    $0x4,%rdx
+  804f67:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6e:	e9 a5 00 00 00       	jmp    805018 <pipe_size+0x2ff>
+      goto err2;
+  804f73:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804f74:	eb 58                	jmp    804fce <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804f76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f7a:	48 c1 e0 0c          	shl    $0xc,%rax
+  804f7e:	48 89 c2             	mov    %rax,%rdx
+  804f81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f85:	48 01 d0             	add    %rdx,%rax
+  804f88:	48 89 c6             	mov    %rax,%rsi
+  804f8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f90:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  804f97:	00 00 00 
+  804f9a:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804f9c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fa0:	48 89 c7             	mov    %rax,%rdi
+  804fa3:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  804faa:	00 00 00 
+  804fad:	ff d0                	call   *%rax
+  804faf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804fb3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804fb7:	48 01 d0             	add    %rdx,%rax
+  804fba:	48 89 c6             	mov    %rax,%rsi
+  804fbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc2:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  804fc9:	00 00 00 
+  804fcc:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804fce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fd2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804fd6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804fda:	48 85 c0             	test   %rax,%rax
+  804fdd:	75 97                	jne    804f76 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804fdf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fe3:	48 89 c6             	mov    %rax,%rsi
+  804fe6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804feb:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  804ff2:	00 00 00 
+  804ff5:	ff d0                	call   *%rax
+  804ff7:	eb 01                	jmp    804ffa <pipe_size+0x2e1>
+    goto err1;
+  804ff9:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804ffa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ffe:	48 89 c6             	mov    %rax,%rsi
+  805001:	bf 00 00 00 00       	mov    $0x0,%edi
+  805006:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  80500d:	00 00 00 
+  805010:	ff d0                	call   *%rax
+  805012:	eb 01                	jmp    805015 <pipe_size+0x2fc>
+    goto err;
+  805014:	90                   	nop
+err:
+  return r;
+  805015:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805018:	c9                   	leave
+  805019:	c3                   	ret
+
+000000000080501a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80501a:	55                   	push   %rbp
+  80501b:	48 89 e5             	mov    %rsp,%rbp
+  80501e:	53                   	push   %rbx
+  80501f:	48 83 ec 28          	sub    $0x28,%rsp
+  805023:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805027:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80502b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805032:	00 00 00 
+  805035:	8b 40 04             	mov    0x4(%rax),%eax
+  805038:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80503d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805044:	00 00 00 
+  805047:	48 98                	cltq
+  805049:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805050:	48 01 d0             	add    %rdx,%rax
+  805053:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805059:	8b 00                	mov    (%rax),%eax
+  80505b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80505e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805062:	48 89 c7             	mov    %rax,%rdi
+  805065:	48 b8 0b 5f 80 00 00 	movabs $0x805f0b,%rax
+  80506c:	00 00 00 
+  80506f:	ff d0                	call   *%rax
+  805071:	89 c3                	mov    %eax,%ebx
+  805073:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805077:	48 89 c7             	mov    %rax,%rdi
+  80507a:	48 b8 0b 5f 80 00 00 	movabs $0x805f0b,%rax
+  805081:	00 00 00 
+  805084:	ff d0                	call   *%rax
+  805086:	39 c3                	cmp    %eax,%ebx
+  805088:	0f 94 c0             	sete   %al
+  80508b:	0f b6 c0             	movzbl %al,%eax
+  80508e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  805091:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805098:	00 00 00 
+  80509b:	8b 40 04             	mov    0x4(%rax),%eax
+  80509e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8050a3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050aa:	00 00 00 
+  8050ad:	48 98                	cltq
+  8050af:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8050b6:	48 01 d0             	add    %rdx,%rax
+  8050b9:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8050bf:	8b 00                	mov    (%rax),%eax
+  8050c1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8050c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050c7:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8050ca:	75 05                	jne    8050d1 <_pipeisclosed+0xb7>
+      return ret;
+  8050cc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050cf:	eb 68                	jmp    805139 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8050d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050d4:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8050d7:	0f 84 4e ff ff ff    	je     80502b <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8050dd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8050e4:	00 00 00 
+  8050e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8050ea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8050ef:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050f6:	00 00 00 
+  8050f9:	48 98                	cltq
+  8050fb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805102:	48 01 d0             	add    %rdx,%rax
+  805105:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80510b:	8b 10                	mov    (%rax),%edx
+  80510d:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  805110:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805113:	89 c6                	mov    %eax,%esi
+  805115:	48 b8 48 67 80 00 00 	movabs $0x806748,%rax
+  80511c:	00 00 00 
+  80511f:	48 89 c7             	mov    %rax,%rdi
+  805122:	b8 00 00 00 00       	mov    $0x0,%eax
+  805127:	49 b8 fc 11 80 00 00 	movabs $0x8011fc,%r8
+  80512e:	00 00 00 
+  805131:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  805134:	e9 f2 fe ff ff       	jmp    80502b <_pipeisclosed+0x11>
+  }
+}
+  805139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80513d:	c9                   	leave
+  80513e:	c3                   	ret
+
+000000000080513f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80513f:	55                   	push   %rbp
+  805140:	48 89 e5             	mov    %rsp,%rbp
+  805143:	48 83 ec 30          	sub    $0x30,%rsp
+  805147:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80514a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80514e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805151:	48 89 d6             	mov    %rdx,%rsi
+  805154:	89 c7                	mov    %eax,%edi
+  805156:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  80515d:	00 00 00 
+  805160:	ff d0                	call   *%rax
+  805162:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805165:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805169:	79 05                	jns    805170 <pipeisclosed+0x31>
+    return r;
+  80516b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80516e:	eb 31                	jmp    8051a1 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  805170:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805174:	48 89 c7             	mov    %rax,%rdi
+  805177:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  80517e:	00 00 00 
+  805181:	ff d0                	call   *%rax
+  805183:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  805187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80518b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80518f:	48 89 d6             	mov    %rdx,%rsi
+  805192:	48 89 c7             	mov    %rax,%rdi
+  805195:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  80519c:	00 00 00 
+  80519f:	ff d0                	call   *%rax
+}
+  8051a1:	c9                   	leave
+  8051a2:	c3                   	ret
+
+00000000008051a3 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8051a3:	55                   	push   %rbp
+  8051a4:	48 89 e5             	mov    %rsp,%rbp
+  8051a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8051ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8051af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051b3:	8b 40 18             	mov    0x18(%rax),%eax
+  8051b6:	8d 50 01             	lea    0x1(%rax),%edx
+  8051b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051bd:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8051c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051c4:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8051c7:	85 c0                	test   %eax,%eax
+  8051c9:	74 27                	je     8051f2 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8051cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051cf:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8051d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051da:	48 83 c0 18          	add    $0x18,%rax
+  8051de:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8051e3:	48 89 c7             	mov    %rax,%rdi
+  8051e6:	48 b8 75 33 80 00 00 	movabs $0x803375,%rax
+  8051ed:	00 00 00 
+  8051f0:	ff d0                	call   *%rax
+  }
+}
+  8051f2:	90                   	nop
+  8051f3:	c9                   	leave
+  8051f4:	c3                   	ret
+
+00000000008051f5 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8051f5:	55                   	push   %rbp
+  8051f6:	48 89 e5             	mov    %rsp,%rbp
+  8051f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8051fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805201:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  805204:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805208:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80520f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805213:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805217:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80521a:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805221:	89 c6                	mov    %eax,%esi
+  805223:	48 89 cf             	mov    %rcx,%rdi
+  805226:	48 b8 26 33 80 00 00 	movabs $0x803326,%rax
+  80522d:	00 00 00 
+  805230:	ff d0                	call   *%rax
+}
+  805232:	90                   	nop
+  805233:	c9                   	leave
+  805234:	c3                   	ret
+
+0000000000805235 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805235:	55                   	push   %rbp
+  805236:	48 89 e5             	mov    %rsp,%rbp
+  805239:	48 83 ec 70          	sub    $0x70,%rsp
+  80523d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805241:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805245:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805249:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80524d:	48 89 c7             	mov    %rax,%rdi
+  805250:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  805257:	00 00 00 
+  80525a:	ff d0                	call   *%rax
+  80525c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  805260:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  805265:	75 0a                	jne    805271 <devpipe_read+0x3c>
+    return 0;
+  805267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526c:	e9 63 01 00 00       	jmp    8053d4 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  805271:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805275:	8b 40 18             	mov    0x18(%rax),%eax
+  805278:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80527b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80527f:	48 8b 10             	mov    (%rax),%rdx
+  805282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805286:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80528a:	48 39 c2             	cmp    %rax,%rdx
+  80528d:	75 42                	jne    8052d1 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80528f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805293:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805297:	48 89 d6             	mov    %rdx,%rsi
+  80529a:	48 89 c7             	mov    %rax,%rdi
+  80529d:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  8052a4:	00 00 00 
+  8052a7:	ff d0                	call   *%rax
+  8052a9:	85 c0                	test   %eax,%eax
+  8052ab:	74 0a                	je     8052b7 <devpipe_read+0x82>
+      return 0;
+  8052ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b2:	e9 1d 01 00 00       	jmp    8053d4 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8052b7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8052ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052be:	89 d6                	mov    %edx,%esi
+  8052c0:	48 89 c7             	mov    %rax,%rdi
+  8052c3:	48 b8 f5 51 80 00 00 	movabs $0x8051f5,%rax
+  8052ca:	00 00 00 
+  8052cd:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8052cf:	eb a0                	jmp    805271 <devpipe_read+0x3c>
+      break;
+  8052d1:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8052d2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8052d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8052da:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8052de:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8052e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052e6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8052ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052ee:	48 8b 00             	mov    (%rax),%rax
+  8052f1:	48 29 c2             	sub    %rax,%rdx
+  8052f4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8052f8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805300:	48 39 c2             	cmp    %rax,%rdx
+  805303:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805307:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80530b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80530f:	48 8b 00             	mov    (%rax),%rax
+  805312:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805316:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80531a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80531f:	48 f7 f1             	div    %rcx
+  805322:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805326:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80532a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80532e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805332:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805336:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80533a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80533e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805342:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805346:	48 39 c2             	cmp    %rax,%rdx
+  805349:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80534d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  805351:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805355:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  805359:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80535d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805361:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805365:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805369:	48 89 ce             	mov    %rcx,%rsi
+  80536c:	48 89 c7             	mov    %rax,%rdi
+  80536f:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  805376:	00 00 00 
+  805379:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80537b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80537f:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  805383:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805387:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80538b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80538f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805393:	48 01 d1             	add    %rdx,%rcx
+  805396:	48 89 c2             	mov    %rax,%rdx
+  805399:	48 89 cf             	mov    %rcx,%rdi
+  80539c:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  8053a3:	00 00 00 
+  8053a6:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8053a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ac:	48 8b 10             	mov    (%rax),%rdx
+  8053af:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8053b3:	48 01 c2             	add    %rax,%rdx
+  8053b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ba:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8053bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053c1:	48 89 c7             	mov    %rax,%rdi
+  8053c4:	48 b8 a3 51 80 00 00 	movabs $0x8051a3,%rax
+  8053cb:	00 00 00 
+  8053ce:	ff d0                	call   *%rax
+  return n;
+  8053d0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8053d4:	c9                   	leave
+  8053d5:	c3                   	ret
+
+00000000008053d6 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8053d6:	55                   	push   %rbp
+  8053d7:	48 89 e5             	mov    %rsp,%rbp
+  8053da:	48 83 ec 70          	sub    $0x70,%rsp
+  8053de:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8053e2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8053e6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8053ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8053ee:	48 89 c7             	mov    %rax,%rdi
+  8053f1:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  8053f8:	00 00 00 
+  8053fb:	ff d0                	call   *%rax
+  8053fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  805401:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805405:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805409:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805410:	00 
+  805411:	e9 b8 01 00 00       	jmp    8055ce <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805416:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80541a:	8b 40 18             	mov    0x18(%rax),%eax
+  80541d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805420:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805424:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805428:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80542c:	48 8b 00             	mov    (%rax),%rax
+  80542f:	48 29 c2             	sub    %rax,%rdx
+  805432:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805436:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80543a:	48 39 c2             	cmp    %rax,%rdx
+  80543d:	75 4d                	jne    80548c <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80543f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805443:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805447:	48 89 d6             	mov    %rdx,%rsi
+  80544a:	48 89 c7             	mov    %rax,%rdi
+  80544d:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  805454:	00 00 00 
+  805457:	ff d0                	call   *%rax
+  805459:	85 c0                	test   %eax,%eax
+  80545b:	74 0a                	je     805467 <devpipe_write+0x91>
+        return 0;
+  80545d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805462:	e9 79 01 00 00       	jmp    8055e0 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805467:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80546a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80546e:	89 d6                	mov    %edx,%esi
+  805470:	48 89 c7             	mov    %rax,%rdi
+  805473:	48 b8 f5 51 80 00 00 	movabs $0x8051f5,%rax
+  80547a:	00 00 00 
+  80547d:	ff d0                	call   *%rax
+      m = 0;
+  80547f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805486:	00 
+      continue;
+  805487:	e9 3a 01 00 00       	jmp    8055c6 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80548c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805490:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  805494:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805498:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80549c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8054a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054a4:	48 8b 08             	mov    (%rax),%rcx
+  8054a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054af:	48 29 c1             	sub    %rax,%rcx
+  8054b2:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8054b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8054ba:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8054be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054c2:	48 39 c2             	cmp    %rax,%rdx
+  8054c5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8054c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8054cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8054d9:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8054dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054e2:	48 f7 f1             	div    %rcx
+  8054e5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8054e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054ed:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8054f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054f5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8054f9:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8054fd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805501:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805505:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805509:	48 39 c2             	cmp    %rax,%rdx
+  80550c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805510:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805514:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805518:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80551c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805520:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805524:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805528:	48 01 d1             	add    %rdx,%rcx
+  80552b:	48 89 c2             	mov    %rax,%rdx
+  80552e:	48 89 cf             	mov    %rcx,%rdi
+  805531:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  805538:	00 00 00 
+  80553b:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80553d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805541:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805545:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805549:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80554d:	73 4d                	jae    80559c <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80554f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805553:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805557:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80555b:	48 29 c2             	sub    %rax,%rdx
+  80555e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805562:	48 01 c2             	add    %rax,%rdx
+  805565:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805569:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80556d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805571:	48 89 c1             	mov    %rax,%rcx
+  805574:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805578:	48 01 c1             	add    %rax,%rcx
+  80557b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80557f:	48 01 c1             	add    %rax,%rcx
+  805582:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805586:	48 83 c0 20          	add    $0x20,%rax
+  80558a:	48 89 ce             	mov    %rcx,%rsi
+  80558d:	48 89 c7             	mov    %rax,%rdi
+  805590:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  805597:	00 00 00 
+  80559a:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80559c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055a0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8055a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055a8:	48 01 c2             	add    %rax,%rdx
+  8055ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055af:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8055b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055b7:	48 89 c7             	mov    %rax,%rdi
+  8055ba:	48 b8 a3 51 80 00 00 	movabs $0x8051a3,%rax
+  8055c1:	00 00 00 
+  8055c4:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8055c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055ca:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8055ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055d2:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8055d6:	0f 82 3a fe ff ff    	jb     805416 <devpipe_write+0x40>
+  }
+
+  return i;
+  8055dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8055e0:	c9                   	leave
+  8055e1:	c3                   	ret
+
+00000000008055e2 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8055e2:	55                   	push   %rbp
+  8055e3:	48 89 e5             	mov    %rsp,%rbp
+  8055e6:	48 83 ec 40          	sub    $0x40,%rsp
+  8055ea:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8055ee:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8055f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8055f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055f9:	48 89 c7             	mov    %rax,%rdi
+  8055fc:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  805603:	00 00 00 
+  805606:	ff d0                	call   *%rax
+  805608:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80560c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805613:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805617:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80561b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80561f:	48 89 d6             	mov    %rdx,%rsi
+  805622:	48 89 c7             	mov    %rax,%rdi
+  805625:	48 b8 bd 42 80 00 00 	movabs $0x8042bd,%rax
+  80562c:	00 00 00 
+  80562f:	ff d0                	call   *%rax
+  805631:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805634:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805638:	79 08                	jns    805642 <devpipe_poll+0x60>
+    return r;
+  80563a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80563d:	e9 85 00 00 00       	jmp    8056c7 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805642:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805645:	83 e0 01             	and    $0x1,%eax
+  805648:	85 c0                	test   %eax,%eax
+  80564a:	74 18                	je     805664 <devpipe_poll+0x82>
+  80564c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805650:	48 8b 10             	mov    (%rax),%rdx
+  805653:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805657:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80565b:	48 39 c2             	cmp    %rax,%rdx
+  80565e:	74 04                	je     805664 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805660:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805664:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805667:	83 e0 02             	and    $0x2,%eax
+  80566a:	85 c0                	test   %eax,%eax
+  80566c:	74 23                	je     805691 <devpipe_poll+0xaf>
+  80566e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805672:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805676:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80567a:	48 8b 00             	mov    (%rax),%rax
+  80567d:	48 29 c2             	sub    %rax,%rdx
+  805680:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805684:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805688:	48 39 c2             	cmp    %rax,%rdx
+  80568b:	73 04                	jae    805691 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80568d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805691:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805695:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805699:	48 89 d6             	mov    %rdx,%rsi
+  80569c:	48 89 c7             	mov    %rax,%rdi
+  80569f:	48 b8 1a 50 80 00 00 	movabs $0x80501a,%rax
+  8056a6:	00 00 00 
+  8056a9:	ff d0                	call   *%rax
+  8056ab:	85 c0                	test   %eax,%eax
+  8056ad:	74 04                	je     8056b3 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8056af:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8056b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b7:	75 0b                	jne    8056c4 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8056b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056bd:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8056c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8056c7:	c9                   	leave
+  8056c8:	c3                   	ret
+
+00000000008056c9 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8056c9:	55                   	push   %rbp
+  8056ca:	48 89 e5             	mov    %rsp,%rbp
+  8056cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8056d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8056d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056dd:	48 89 c7             	mov    %rax,%rdi
+  8056e0:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  8056e7:	00 00 00 
+  8056ea:	ff d0                	call   *%rax
+  8056ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8056f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056f4:	48 ba 79 67 80 00 00 	movabs $0x806779,%rdx
+  8056fb:	00 00 00 
+  8056fe:	48 89 d6             	mov    %rdx,%rsi
+  805701:	48 89 c7             	mov    %rax,%rdi
+  805704:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  80570b:	00 00 00 
+  80570e:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805710:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805714:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805718:	89 c1                	mov    %eax,%ecx
+  80571a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80571e:	48 8b 00             	mov    (%rax),%rax
+  805721:	89 c2                	mov    %eax,%edx
+  805723:	89 c8                	mov    %ecx,%eax
+  805725:	29 d0                	sub    %edx,%eax
+  805727:	89 c2                	mov    %eax,%edx
+  805729:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80572d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805733:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805737:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80573e:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805741:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805745:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  80574c:	00 00 00 
+  80574f:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805756:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80575b:	c9                   	leave
+  80575c:	c3                   	ret
+
+000000000080575d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80575d:	55                   	push   %rbp
+  80575e:	48 89 e5             	mov    %rsp,%rbp
+  805761:	48 83 ec 40          	sub    $0x40,%rsp
+  805765:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80576d:	48 89 c7             	mov    %rax,%rdi
+  805770:	48 b8 ea 37 80 00 00 	movabs $0x8037ea,%rax
+  805777:	00 00 00 
+  80577a:	ff d0                	call   *%rax
+  80577c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805780:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805787:	00 
+  805788:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80578c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805794:	48 01 d0             	add    %rdx,%rax
+  805797:	48 83 c0 1f          	add    $0x1f,%rax
+  80579b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80579f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057a8:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8057ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057b0:	48 29 d0             	sub    %rdx,%rax
+  8057b3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8057b7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8057bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057bf:	48 89 c6             	mov    %rax,%rsi
+  8057c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057c7:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  8057ce:	00 00 00 
+  8057d1:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8057d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057d7:	48 89 c7             	mov    %rax,%rdi
+  8057da:	48 b8 a3 51 80 00 00 	movabs $0x8051a3,%rax
+  8057e1:	00 00 00 
+  8057e4:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8057e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8057ee:	eb 2f                	jmp    80581f <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8057f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057f4:	48 83 e8 01          	sub    $0x1,%rax
+  8057f8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8057fc:	48 89 c2             	mov    %rax,%rdx
+  8057ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805803:	48 01 d0             	add    %rdx,%rax
+  805806:	48 89 c6             	mov    %rax,%rsi
+  805809:	bf 00 00 00 00       	mov    $0x0,%edi
+  80580e:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  805815:	00 00 00 
+  805818:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80581a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80581f:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805824:	77 ca                	ja     8057f0 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805826:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80582a:	48 89 c6             	mov    %rax,%rsi
+  80582d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805832:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  805839:	00 00 00 
+  80583c:	ff d0                	call   *%rax
+}
+  80583e:	c9                   	leave
+  80583f:	c3                   	ret
+
+0000000000805840 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805840:	55                   	push   %rbp
+  805841:	48 89 e5             	mov    %rsp,%rbp
+  805844:	48 83 ec 08          	sub    $0x8,%rsp
+  805848:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80584b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80584f:	75 10                	jne    805861 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805851:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805858:	00 00 00 
+  80585b:	8b 00                	mov    (%rax),%eax
+  80585d:	48 98                	cltq
+  80585f:	eb 05                	jmp    805866 <vsyscall+0x26>
+  }
+  return 0;
+  805861:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805866:	c9                   	leave
+  805867:	c3                   	ret
+
+0000000000805868 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805868:	55                   	push   %rbp
+  805869:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80586c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805871:	48 b8 40 58 80 00 00 	movabs $0x805840,%rax
+  805878:	00 00 00 
+  80587b:	ff d0                	call   *%rax
+}
+  80587d:	5d                   	pop    %rbp
+  80587e:	c3                   	ret
+
+000000000080587f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80587f:	55                   	push   %rbp
+  805880:	48 89 e5             	mov    %rsp,%rbp
+  805883:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805887:	0f 31                	rdtsc
+  805889:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80588c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80588f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805892:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805895:	48 c1 e2 20          	shl    $0x20,%rdx
+  805899:	48 09 d0             	or     %rdx,%rax
+  80589c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8058a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8058a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8058a8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8058af:	00 00 00 
+  8058b2:	8b 40 08             	mov    0x8(%rax),%eax
+  8058b5:	48 98                	cltq
+  8058b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8058bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058c4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058c8:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8058cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058d8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058dc:	48 89 d0             	mov    %rdx,%rax
+  8058df:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8058e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058eb:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058ef:	48 01 c8             	add    %rcx,%rax
+}
+  8058f2:	c9                   	leave
+  8058f3:	c3                   	ret
+
+00000000008058f4 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8058f4:	55                   	push   %rbp
+  8058f5:	48 89 e5             	mov    %rsp,%rbp
+  8058f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8058fc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8058ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805902:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805905:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805909:	be 01 00 00 00       	mov    $0x1,%esi
+  80590e:	48 89 c7             	mov    %rax,%rdi
+  805911:	48 b8 63 2d 80 00 00 	movabs $0x802d63,%rax
+  805918:	00 00 00 
+  80591b:	ff d0                	call   *%rax
+}
+  80591d:	90                   	nop
+  80591e:	c9                   	leave
+  80591f:	c3                   	ret
+
+0000000000805920 <getchar>:
+
+int
+getchar(void) {
+  805920:	55                   	push   %rbp
+  805921:	48 89 e5             	mov    %rsp,%rbp
+  805924:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805928:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  80592c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805931:	48 89 c6             	mov    %rax,%rsi
+  805934:	bf 00 00 00 00       	mov    $0x0,%edi
+  805939:	48 b8 53 3e 80 00 00 	movabs $0x803e53,%rax
+  805940:	00 00 00 
+  805943:	ff d0                	call   *%rax
+  805945:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805948:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80594c:	79 05                	jns    805953 <getchar+0x33>
+    return r;
+  80594e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805951:	eb 14                	jmp    805967 <getchar+0x47>
+  if (r < 1)
+  805953:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805957:	7f 07                	jg     805960 <getchar+0x40>
+    return -E_EOF;
+  805959:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80595e:	eb 07                	jmp    805967 <getchar+0x47>
+  return c;
+  805960:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805964:	0f b6 c0             	movzbl %al,%eax
+}
+  805967:	c9                   	leave
+  805968:	c3                   	ret
+
+0000000000805969 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805969:	55                   	push   %rbp
+  80596a:	48 89 e5             	mov    %rsp,%rbp
+  80596d:	48 83 ec 20          	sub    $0x20,%rsp
+  805971:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805974:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805978:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80597b:	48 89 d6             	mov    %rdx,%rsi
+  80597e:	89 c7                	mov    %eax,%edi
+  805980:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  805987:	00 00 00 
+  80598a:	ff d0                	call   *%rax
+  80598c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80598f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805993:	79 05                	jns    80599a <iscons+0x31>
+    return r;
+  805995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805998:	eb 1a                	jmp    8059b4 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80599a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80599e:	8b 10                	mov    (%rax),%edx
+  8059a0:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8059a7:	00 00 00 
+  8059aa:	8b 00                	mov    (%rax),%eax
+  8059ac:	39 c2                	cmp    %eax,%edx
+  8059ae:	0f 94 c0             	sete   %al
+  8059b1:	0f b6 c0             	movzbl %al,%eax
+}
+  8059b4:	c9                   	leave
+  8059b5:	c3                   	ret
+
+00000000008059b6 <opencons>:
+
+int
+opencons(void) {
+  8059b6:	55                   	push   %rbp
+  8059b7:	48 89 e5             	mov    %rsp,%rbp
+  8059ba:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8059be:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8059c2:	48 89 c7             	mov    %rax,%rdi
+  8059c5:	48 b8 15 38 80 00 00 	movabs $0x803815,%rax
+  8059cc:	00 00 00 
+  8059cf:	ff d0                	call   *%rax
+  8059d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059d8:	79 05                	jns    8059df <opencons+0x29>
+    return r;
+  8059da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059dd:	eb 66                	jmp    805a45 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8059df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059e3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059e8:	48 89 c6             	mov    %rax,%rsi
+  8059eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059f0:	48 b8 7a 2f 80 00 00 	movabs $0x802f7a,%rax
+  8059f7:	00 00 00 
+  8059fa:	ff d0                	call   *%rax
+  8059fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a03:	79 05                	jns    805a0a <opencons+0x54>
+    return r;
+  805a05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a08:	eb 3b                	jmp    805a45 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805a0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a0e:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805a15:	00 00 00 
+  805a18:	8b 12                	mov    (%rdx),%edx
+  805a1a:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805a1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a20:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a2b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a36:	48 89 c7             	mov    %rax,%rdi
+  805a39:	48 b8 c7 37 80 00 00 	movabs $0x8037c7,%rax
+  805a40:	00 00 00 
+  805a43:	ff d0                	call   *%rax
+}
+  805a45:	c9                   	leave
+  805a46:	c3                   	ret
+
+0000000000805a47 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805a47:	55                   	push   %rbp
+  805a48:	48 89 e5             	mov    %rsp,%rbp
+  805a4b:	48 83 ec 20          	sub    $0x20,%rsp
+  805a4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a52:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a55:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a5c:	48 89 d6             	mov    %rdx,%rsi
+  805a5f:	89 c7                	mov    %eax,%edi
+  805a61:	48 b8 f7 38 80 00 00 	movabs $0x8038f7,%rax
+  805a68:	00 00 00 
+  805a6b:	ff d0                	call   *%rax
+  805a6d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a70:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a74:	79 05                	jns    805a7b <consmode+0x34>
+    return r;
+  805a76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a79:	eb 34                	jmp    805aaf <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805a7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a7f:	8b 10                	mov    (%rax),%edx
+  805a81:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805a88:	00 00 00 
+  805a8b:	8b 00                	mov    (%rax),%eax
+  805a8d:	39 c2                	cmp    %eax,%edx
+  805a8f:	74 07                	je     805a98 <consmode+0x51>
+    return -E_INVAL;
+  805a91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a96:	eb 17                	jmp    805aaf <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a9c:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805aa6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805aa9:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805aac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805aaf:	c9                   	leave
+  805ab0:	c3                   	ret
+
+0000000000805ab1 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805ab1:	55                   	push   %rbp
+  805ab2:	48 89 e5             	mov    %rsp,%rbp
+  805ab5:	48 83 ec 20          	sub    $0x20,%rsp
+  805ab9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805abd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805ac1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ac9:	8b 50 0c             	mov    0xc(%rax),%edx
+  805acc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ad4:	48 89 ce             	mov    %rcx,%rsi
+  805ad7:	48 89 c7             	mov    %rax,%rdi
+  805ada:	48 b8 d4 32 80 00 00 	movabs $0x8032d4,%rax
+  805ae1:	00 00 00 
+  805ae4:	ff d0                	call   *%rax
+  805ae6:	48 98                	cltq
+}
+  805ae8:	c9                   	leave
+  805ae9:	c3                   	ret
+
+0000000000805aea <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805aea:	55                   	push   %rbp
+  805aeb:	48 89 e5             	mov    %rsp,%rbp
+  805aee:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805af5:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805afc:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805b03:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805b0a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805b11:	eb 74                	jmp    805b87 <devcons_write+0x9d>
+    m = n - tot;
+  805b13:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805b1a:	89 c2                	mov    %eax,%edx
+  805b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b1f:	29 c2                	sub    %eax,%edx
+  805b21:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805b24:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b27:	83 f8 7f             	cmp    $0x7f,%eax
+  805b2a:	76 07                	jbe    805b33 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805b2c:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805b33:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b36:	48 63 d0             	movslq %eax,%rdx
+  805b39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b3c:	48 63 c8             	movslq %eax,%rcx
+  805b3f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805b46:	48 01 c1             	add    %rax,%rcx
+  805b49:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b50:	48 89 ce             	mov    %rcx,%rsi
+  805b53:	48 89 c7             	mov    %rax,%rdi
+  805b56:	48 b8 ef 26 80 00 00 	movabs $0x8026ef,%rax
+  805b5d:	00 00 00 
+  805b60:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805b62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b65:	48 63 d0             	movslq %eax,%rdx
+  805b68:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b6f:	48 89 d6             	mov    %rdx,%rsi
+  805b72:	48 89 c7             	mov    %rax,%rdi
+  805b75:	48 b8 63 2d 80 00 00 	movabs $0x802d63,%rax
+  805b7c:	00 00 00 
+  805b7f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805b81:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b84:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805b87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b8a:	48 98                	cltq
+  805b8c:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805b93:	0f 82 7a ff ff ff    	jb     805b13 <devcons_write+0x29>
+  }
+  return tot;
+  805b99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b9c:	48 98                	cltq
+}
+  805b9e:	c9                   	leave
+  805b9f:	c3                   	ret
+
+0000000000805ba0 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805ba0:	55                   	push   %rbp
+  805ba1:	48 89 e5             	mov    %rsp,%rbp
+  805ba4:	48 83 ec 08          	sub    $0x8,%rsp
+  805ba8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805bac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805bb1:	c9                   	leave
+  805bb2:	c3                   	ret
+
+0000000000805bb3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805bb3:	55                   	push   %rbp
+  805bb4:	48 89 e5             	mov    %rsp,%rbp
+  805bb7:	48 83 ec 10          	sub    $0x10,%rsp
+  805bbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805bbf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bc7:	48 ba 85 67 80 00 00 	movabs $0x806785,%rdx
+  805bce:	00 00 00 
+  805bd1:	48 89 d6             	mov    %rdx,%rsi
+  805bd4:	48 89 c7             	mov    %rax,%rdi
+  805bd7:	48 b8 ac 21 80 00 00 	movabs $0x8021ac,%rax
+  805bde:	00 00 00 
+  805be1:	ff d0                	call   *%rax
+  return 0;
+  805be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805be8:	c9                   	leave
+  805be9:	c3                   	ret
+
+0000000000805bea <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805bea:	55                   	push   %rbp
+  805beb:	48 89 e5             	mov    %rsp,%rbp
+  805bee:	48 83 ec 30          	sub    $0x30,%rsp
+  805bf2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805bf6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805bf9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805bfd:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805c04:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c07:	83 e0 02             	and    $0x2,%eax
+  805c0a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805c0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c11:	8b 40 0c             	mov    0xc(%rax),%eax
+  805c14:	83 f8 01             	cmp    $0x1,%eax
+  805c17:	75 04                	jne    805c1d <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805c19:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805c1d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c20:	83 e0 01             	and    $0x1,%eax
+  805c23:	85 c0                	test   %eax,%eax
+  805c25:	74 44                	je     805c6b <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805c27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805c2f:	89 c2                	mov    %eax,%edx
+  805c31:	be 00 00 00 00       	mov    $0x0,%esi
+  805c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c3b:	48 b8 c2 33 80 00 00 	movabs $0x8033c2,%rax
+  805c42:	00 00 00 
+  805c45:	ff d0                	call   *%rax
+  805c47:	83 f8 01             	cmp    $0x1,%eax
+  805c4a:	75 06                	jne    805c52 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805c4c:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805c50:	eb 19                	jmp    805c6b <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805c52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c56:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805c5c:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805c5f:	89 c2                	mov    %eax,%edx
+  805c61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c65:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805c6b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805c6e:	c9                   	leave
+  805c6f:	c3                   	ret
+
+0000000000805c70 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805c70:	55                   	push   %rbp
+  805c71:	48 89 e5             	mov    %rsp,%rbp
+  805c74:	48 83 ec 20          	sub    $0x20,%rsp
+  805c78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805c7c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805c80:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805c84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c88:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805c8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805c90:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805c97:	48 89 c7             	mov    %rax,%rdi
+  805c9a:	48 b8 a8 5c 80 00 00 	movabs $0x805ca8,%rax
+  805ca1:	00 00 00 
+  805ca4:	ff d0                	call   *%rax
+}
+  805ca6:	c9                   	leave
+  805ca7:	c3                   	ret
+
+0000000000805ca8 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805ca8:	55                   	push   %rbp
+  805ca9:	48 89 e5             	mov    %rsp,%rbp
+  805cac:	48 83 ec 30          	sub    $0x30,%rsp
+  805cb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805cb4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805cb8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805cbc:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805cc0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805cc5:	75 0e                	jne    805cd5 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805cc7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805cce:	00 00 00 
+  805cd1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805cd5:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805cda:	75 18                	jne    805cf4 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805cdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ce0:	48 89 c7             	mov    %rax,%rdi
+  805ce3:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  805cea:	00 00 00 
+  805ced:	ff d0                	call   *%rax
+  805cef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805cf2:	eb 1d                	jmp    805d11 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805cf4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805cf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cfc:	48 89 d6             	mov    %rdx,%rsi
+  805cff:	48 89 c7             	mov    %rax,%rdi
+  805d02:	48 b8 00 32 80 00 00 	movabs $0x803200,%rax
+  805d09:	00 00 00 
+  805d0c:	ff d0                	call   *%rax
+  805d0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805d11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d15:	79 2a                	jns    805d41 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805d17:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d1c:	74 0a                	je     805d28 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d22:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805d28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805d2d:	74 0a                	je     805d39 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d33:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805d39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d3c:	e9 aa 00 00 00       	jmp    805deb <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805d41:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d46:	74 36                	je     805d7e <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805d48:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d4f:	00 00 00 
+  805d52:	8b 40 04             	mov    0x4(%rax),%eax
+  805d55:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805d5a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d61:	00 00 00 
+  805d64:	48 98                	cltq
+  805d66:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d6d:	48 01 d0             	add    %rdx,%rax
+  805d70:	48 05 24 01 00 00    	add    $0x124,%rax
+  805d76:	8b 10                	mov    (%rax),%edx
+  805d78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d7c:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805d7e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805d83:	74 36                	je     805dbb <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805d85:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d8c:	00 00 00 
+  805d8f:	8b 40 04             	mov    0x4(%rax),%eax
+  805d92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805d97:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d9e:	00 00 00 
+  805da1:	48 98                	cltq
+  805da3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805daa:	48 01 d0             	add    %rdx,%rax
+  805dad:	48 05 28 01 00 00    	add    $0x128,%rax
+  805db3:	8b 10                	mov    (%rax),%edx
+  805db5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805db9:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805dbb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805dc2:	00 00 00 
+  805dc5:	8b 40 04             	mov    0x4(%rax),%eax
+  805dc8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805dcd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805dd4:	00 00 00 
+  805dd7:	48 98                	cltq
+  805dd9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805de0:	48 01 d0             	add    %rdx,%rax
+  805de3:	48 05 20 01 00 00    	add    $0x120,%rax
+  805de9:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805deb:	c9                   	leave
+  805dec:	c3                   	ret
+
+0000000000805ded <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805ded:	55                   	push   %rbp
+  805dee:	48 89 e5             	mov    %rsp,%rbp
+  805df1:	48 83 ec 30          	sub    $0x30,%rsp
+  805df5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805df8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805dfb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805dff:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805e02:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805e07:	75 5e                	jne    805e67 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805e09:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e10:	00 00 00 
+  805e13:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805e17:	eb 4e                	jmp    805e67 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805e19:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e1d:	79 3c                	jns    805e5b <ipc_send+0x6e>
+  805e1f:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805e23:	74 36                	je     805e5b <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805e25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e28:	89 c1                	mov    %eax,%ecx
+  805e2a:	48 b8 90 67 80 00 00 	movabs $0x806790,%rax
+  805e31:	00 00 00 
+  805e34:	48 89 c2             	mov    %rax,%rdx
+  805e37:	be 54 00 00 00       	mov    $0x54,%esi
+  805e3c:	48 b8 b6 67 80 00 00 	movabs $0x8067b6,%rax
+  805e43:	00 00 00 
+  805e46:	48 89 c7             	mov    %rax,%rdi
+  805e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e4e:	49 b8 dd 0f 80 00 00 	movabs $0x800fdd,%r8
+  805e55:	00 00 00 
+  805e58:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805e5b:	48 b8 3d 2f 80 00 00 	movabs $0x802f3d,%rax
+  805e62:	00 00 00 
+  805e65:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805e67:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805e6a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805e6d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e74:	89 c7                	mov    %eax,%edi
+  805e76:	48 b8 63 31 80 00 00 	movabs $0x803163,%rax
+  805e7d:	00 00 00 
+  805e80:	ff d0                	call   *%rax
+  805e82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e85:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e89:	75 8e                	jne    805e19 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805e8b:	48 b8 3d 2f 80 00 00 	movabs $0x802f3d,%rax
+  805e92:	00 00 00 
+  805e95:	ff d0                	call   *%rax
+}
+  805e97:	90                   	nop
+  805e98:	c9                   	leave
+  805e99:	c3                   	ret
+
+0000000000805e9a <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805e9a:	55                   	push   %rbp
+  805e9b:	48 89 e5             	mov    %rsp,%rbp
+  805e9e:	48 83 ec 18          	sub    $0x18,%rsp
+  805ea2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805ea5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805eac:	eb 4d                	jmp    805efb <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805eae:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805eb5:	00 00 00 
+  805eb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ebb:	48 98                	cltq
+  805ebd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ec4:	48 01 d0             	add    %rdx,%rax
+  805ec7:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805ecd:	8b 00                	mov    (%rax),%eax
+  805ecf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805ed2:	75 23                	jne    805ef7 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805ed4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805edb:	00 00 00 
+  805ede:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ee1:	48 98                	cltq
+  805ee3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805eea:	48 01 d0             	add    %rdx,%rax
+  805eed:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805ef3:	8b 00                	mov    (%rax),%eax
+  805ef5:	eb 12                	jmp    805f09 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805ef7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805efb:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805f02:	7e aa                	jle    805eae <ipc_find_env+0x14>
+  return 0;
+  805f04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f09:	c9                   	leave
+  805f0a:	c3                   	ret
+
+0000000000805f0b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805f0b:	55                   	push   %rbp
+  805f0c:	48 89 e5             	mov    %rsp,%rbp
+  805f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  805f13:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805f17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f1b:	48 c1 e8 27          	shr    $0x27,%rax
+  805f1f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805f24:	48 89 c2             	mov    %rax,%rdx
+  805f27:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805f2e:	01 00 00 
+  805f31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f35:	83 e0 01             	and    $0x1,%eax
+  805f38:	48 85 c0             	test   %rax,%rax
+  805f3b:	74 63                	je     805fa0 <pageref+0x95>
+  805f3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f41:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805f45:	48 89 c2             	mov    %rax,%rdx
+  805f48:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805f4f:	01 00 00 
+  805f52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f56:	83 e0 01             	and    $0x1,%eax
+  805f59:	48 85 c0             	test   %rax,%rax
+  805f5c:	74 42                	je     805fa0 <pageref+0x95>
+  805f5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f62:	48 c1 e8 15          	shr    $0x15,%rax
+  805f66:	48 89 c2             	mov    %rax,%rdx
+  805f69:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805f70:	01 00 00 
+  805f73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f77:	83 e0 01             	and    $0x1,%eax
+  805f7a:	48 85 c0             	test   %rax,%rax
+  805f7d:	74 21                	je     805fa0 <pageref+0x95>
+  805f7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f83:	48 c1 e8 0c          	shr    $0xc,%rax
+  805f87:	48 89 c2             	mov    %rax,%rdx
+  805f8a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805f91:	01 00 00 
+  805f94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f98:	83 e0 01             	and    $0x1,%eax
+  805f9b:	48 85 c0             	test   %rax,%rax
+  805f9e:	75 07                	jne    805fa7 <pageref+0x9c>
+    return 0;
+  805fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fa5:	eb 53                	jmp    805ffa <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805fa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fab:	48 c1 e8 0c          	shr    $0xc,%rax
+  805faf:	48 89 c2             	mov    %rax,%rdx
+  805fb2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805fb9:	01 00 00 
+  805fbc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805fc0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805fc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fc8:	83 e0 01             	and    $0x1,%eax
+  805fcb:	48 85 c0             	test   %rax,%rax
+  805fce:	75 07                	jne    805fd7 <pageref+0xcc>
+    return 0;
+  805fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fd5:	eb 23                	jmp    805ffa <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805fd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fdb:	48 c1 e8 0c          	shr    $0xc,%rax
+  805fdf:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805fe6:	00 00 00 
+  805fe9:	48 c1 e0 04          	shl    $0x4,%rax
+  805fed:	48 01 d0             	add    %rdx,%rax
+  805ff0:	48 83 c0 08          	add    $0x8,%rax
+  805ff4:	0f b7 00             	movzwl (%rax),%eax
+  805ff7:	0f b7 c0             	movzwl %ax,%eax
+}
+  805ffa:	c9                   	leave
+  805ffb:	c3                   	ret
@@ -0,0 +1,8041 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 23 00 00 00       	call   80004f <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// buggy program - faults with a write to location zero
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  *(volatile unsigned *)0 = 0;
+  800041:	b8 00 00 00 00       	mov    $0x0,%eax
+  800046:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80004c:	90                   	nop
+  80004d:	c9                   	leave
+  80004e:	c3                   	ret
+
+000000000080004f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004f:	55                   	push   %rbp
+  800050:	48 89 e5             	mov    %rsp,%rbp
+  800053:	48 83 ec 20          	sub    $0x20,%rsp
+  800057:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80005a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80005e:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800065:	00 00 00 
+  800068:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80006c:	eb 13                	jmp    800081 <libmain+0x32>
+    (*ctor)();
+  80006e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800072:	48 8b 10             	mov    (%rax),%rdx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff d2                	call   *%rdx
+    ctor++;
+  80007c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800081:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  800088:	00 00 00 
+  80008b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80008f:	72 dd                	jb     80006e <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800091:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800095:	7e 14                	jle    8000ab <libmain+0x5c>
+    binaryname = argv[0];
+  800097:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80009b:	48 8b 00             	mov    (%rax),%rax
+  80009e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000a5:	00 00 00 
+  8000a8:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000b2:	48 89 d6             	mov    %rdx,%rsi
+  8000b5:	89 c7                	mov    %eax,%edi
+  8000b7:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000c3:	48 b8 d2 00 80 00 00 	movabs $0x8000d2,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+#endif
+}
+  8000cf:	90                   	nop
+  8000d0:	c9                   	leave
+  8000d1:	c3                   	ret
+
+00000000008000d2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d2:	55                   	push   %rbp
+  8000d3:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000d6:	48 b8 7d 0e 80 00 00 	movabs $0x800e7d,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e7:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+}
+  8000f3:	90                   	nop
+  8000f4:	5d                   	pop    %rbp
+  8000f5:	c3                   	ret
+
+00000000008000f6 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8000f6:	55                   	push   %rbp
+  8000f7:	48 89 e5             	mov    %rsp,%rbp
+  8000fa:	53                   	push   %rbx
+  8000fb:	48 83 ec 48          	sub    $0x48,%rsp
+  8000ff:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800103:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800107:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80010b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80010f:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800113:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800117:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80011b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80011f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800123:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800127:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80012b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80012f:	4c 89 c3             	mov    %r8,%rbx
+  800132:	cd 30                	int    $0x30
+  800134:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  800138:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80013d:	74 46                	je     800185 <syscall+0x8f>
+  80013f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800144:	7e 3f                	jle    800185 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  800146:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80014a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80014e:	49 89 d0             	mov    %rdx,%r8
+  800151:	48 89 c1             	mov    %rax,%rcx
+  800154:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  80015b:	00 00 00 
+  80015e:	48 89 c2             	mov    %rax,%rdx
+  800161:	be 22 00 00 00       	mov    $0x22,%esi
+  800166:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  80016d:	00 00 00 
+  800170:	48 89 c7             	mov    %rax,%rdi
+  800173:	b8 00 00 00 00       	mov    $0x0,%eax
+  800178:	49 b9 36 2f 80 00 00 	movabs $0x802f36,%r9
+  80017f:	00 00 00 
+  800182:	41 ff d1             	call   *%r9
+
+  return ret;
+  800185:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800189:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018d:	c9                   	leave
+  80018e:	c3                   	ret
+
+000000000080018f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80018f:	55                   	push   %rbp
+  800190:	48 89 e5             	mov    %rsp,%rbp
+  800193:	48 83 ec 10          	sub    $0x10,%rsp
+  800197:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80019b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80019f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ab:	6a 00                	push   $0x0
+  8001ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001b9:	48 89 d1             	mov    %rdx,%rcx
+  8001bc:	48 89 c2             	mov    %rax,%rdx
+  8001bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c9:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+  8001d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001d9:	90                   	nop
+  8001da:	c9                   	leave
+  8001db:	c3                   	ret
+
+00000000008001dc <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001dc:	55                   	push   %rbp
+  8001dd:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001e4:	6a 00                	push   $0x0
+  8001e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800201:	bf 01 00 00 00       	mov    $0x1,%edi
+  800206:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80020d:	00 00 00 
+  800210:	ff d0                	call   *%rax
+  800212:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+
+0000000000800218 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800218:	55                   	push   %rbp
+  800219:	48 89 e5             	mov    %rsp,%rbp
+  80021c:	48 83 ec 10          	sub    $0x10,%rsp
+  800220:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800223:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800226:	48 98                	cltq
+  800228:	48 83 ec 08          	sub    $0x8,%rsp
+  80022c:	6a 00                	push   $0x0
+  80022e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80023f:	48 89 c2             	mov    %rax,%rdx
+  800242:	be 01 00 00 00       	mov    $0x1,%esi
+  800247:	bf 03 00 00 00       	mov    $0x3,%edi
+  80024c:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+  800258:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+000000000080025e <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	48 83 ec 10          	sub    $0x10,%rsp
+  800266:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800269:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80026c:	48 98                	cltq
+  80026e:	48 83 ec 08          	sub    $0x8,%rsp
+  800272:	6a 00                	push   $0x0
+  800274:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80027a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800285:	48 89 c2             	mov    %rax,%rdx
+  800288:	be 00 00 00 00       	mov    $0x0,%esi
+  80028d:	bf 04 00 00 00       	mov    $0x4,%edi
+  800292:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800299:	00 00 00 
+  80029c:	ff d0                	call   *%rax
+  80029e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002a2:	90                   	nop
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+
+00000000008002a5 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8002ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002b7:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002ba:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002bf:	cd 30                	int    $0x30
+  8002c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002c5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002c9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002ce:	7e 3d                	jle    80030d <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002d4:	49 89 c0             	mov    %rax,%r8
+  8002d7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002dc:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002e3:	00 00 00 
+  8002e6:	48 89 c2             	mov    %rax,%rdx
+  8002e9:	be 49 00 00 00       	mov    $0x49,%esi
+  8002ee:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  8002f5:	00 00 00 
+  8002f8:	48 89 c7             	mov    %rax,%rdi
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	49 b9 36 2f 80 00 00 	movabs $0x802f36,%r9
+  800307:	00 00 00 
+  80030a:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80030d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800312:	75 13                	jne    800327 <sys_env_wait+0x82>
+  800314:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800319:	74 0c                	je     800327 <sys_env_wait+0x82>
+    *status = st;
+  80031b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80031f:	89 c2                	mov    %eax,%edx
+  800321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800325:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800331:	48 83 ec 08          	sub    $0x8,%rsp
+  800335:	6a 00                	push   $0x0
+  800337:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80033d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034d:	be 00 00 00 00       	mov    $0x0,%esi
+  800352:	bf 02 00 00 00       	mov    $0x2,%edi
+  800357:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80035e:	00 00 00 
+  800361:	ff d0                	call   *%rax
+  800363:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+0000000000800369 <sys_yield>:
+
+void
+sys_yield(void) {
+  800369:	55                   	push   %rbp
+  80036a:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80036d:	48 83 ec 08          	sub    $0x8,%rsp
+  800371:	6a 00                	push   $0x0
+  800373:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800379:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80037f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800384:	ba 00 00 00 00       	mov    $0x0,%edx
+  800389:	be 00 00 00 00       	mov    $0x0,%esi
+  80038e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800393:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80039a:	00 00 00 
+  80039d:	ff d0                	call   *%rax
+  80039f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003a3:	90                   	nop
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+
+00000000008003a6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003a6:	55                   	push   %rbp
+  8003a7:	48 89 e5             	mov    %rsp,%rbp
+  8003aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8003ae:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003b5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003b8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003bb:	48 63 c8             	movslq %eax,%rcx
+  8003be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003c5:	48 98                	cltq
+  8003c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8003cb:	6a 00                	push   $0x0
+  8003cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003d3:	49 89 c8             	mov    %rcx,%r8
+  8003d6:	48 89 d1             	mov    %rdx,%rcx
+  8003d9:	48 89 c2             	mov    %rax,%rdx
+  8003dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003e6:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8003ed:	00 00 00 
+  8003f0:	ff d0                	call   *%rax
+  8003f2:	48 83 c4 10          	add    $0x10,%rsp
+  8003f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8003f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8003fc:	c9                   	leave
+  8003fd:	c3                   	ret
+
+00000000008003fe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8003fe:	55                   	push   %rbp
+  8003ff:	48 89 e5             	mov    %rsp,%rbp
+  800402:	48 83 ec 20          	sub    $0x20,%rsp
+  800406:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800409:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80040d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800410:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800414:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800418:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80041b:	48 63 c8             	movslq %eax,%rcx
+  80041e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800422:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800425:	48 63 f0             	movslq %eax,%rsi
+  800428:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80042c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80042f:	48 98                	cltq
+  800431:	48 83 ec 08          	sub    $0x8,%rsp
+  800435:	51                   	push   %rcx
+  800436:	49 89 f9             	mov    %rdi,%r9
+  800439:	49 89 f0             	mov    %rsi,%r8
+  80043c:	48 89 d1             	mov    %rdx,%rcx
+  80043f:	48 89 c2             	mov    %rax,%rdx
+  800442:	be 01 00 00 00       	mov    $0x1,%esi
+  800447:	bf 07 00 00 00       	mov    $0x7,%edi
+  80044c:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800453:	00 00 00 
+  800456:	ff d0                	call   *%rax
+  800458:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80045c:	c9                   	leave
+  80045d:	c3                   	ret
+
+000000000080045e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	48 83 ec 10          	sub    $0x10,%rsp
+  800466:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800469:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80046d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800471:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800474:	48 98                	cltq
+  800476:	48 83 ec 08          	sub    $0x8,%rsp
+  80047a:	6a 00                	push   $0x0
+  80047c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800482:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800488:	48 89 d1             	mov    %rdx,%rcx
+  80048b:	48 89 c2             	mov    %rax,%rdx
+  80048e:	be 01 00 00 00       	mov    $0x1,%esi
+  800493:	bf 08 00 00 00       	mov    $0x8,%edi
+  800498:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80049f:	00 00 00 
+  8004a2:	ff d0                	call   *%rax
+  8004a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004a8:	c9                   	leave
+  8004a9:	c3                   	ret
+
+00000000008004aa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004aa:	55                   	push   %rbp
+  8004ab:	48 89 e5             	mov    %rsp,%rbp
+  8004ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8004b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004b5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004b8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004bb:	48 63 d0             	movslq %eax,%rdx
+  8004be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004c1:	48 98                	cltq
+  8004c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c7:	6a 00                	push   $0x0
+  8004c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004d5:	48 89 d1             	mov    %rdx,%rcx
+  8004d8:	48 89 c2             	mov    %rax,%rdx
+  8004db:	be 01 00 00 00       	mov    $0x1,%esi
+  8004e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004e5:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8004ec:	00 00 00 
+  8004ef:	ff d0                	call   *%rax
+  8004f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004f5:	c9                   	leave
+  8004f6:	c3                   	ret
+
+00000000008004f7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004f7:	55                   	push   %rbp
+  8004f8:	48 89 e5             	mov    %rsp,%rbp
+  8004fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800502:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800506:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80050a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80050d:	48 98                	cltq
+  80050f:	48 83 ec 08          	sub    $0x8,%rsp
+  800513:	6a 00                	push   $0x0
+  800515:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80051b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800521:	48 89 d1             	mov    %rdx,%rcx
+  800524:	48 89 c2             	mov    %rax,%rdx
+  800527:	be 01 00 00 00       	mov    $0x1,%esi
+  80052c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800531:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800538:	00 00 00 
+  80053b:	ff d0                	call   *%rax
+  80053d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800541:	c9                   	leave
+  800542:	c3                   	ret
+
+0000000000800543 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800543:	55                   	push   %rbp
+  800544:	48 89 e5             	mov    %rsp,%rbp
+  800547:	48 83 ec 10          	sub    $0x10,%rsp
+  80054b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80054e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800552:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800556:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800559:	48 98                	cltq
+  80055b:	48 83 ec 08          	sub    $0x8,%rsp
+  80055f:	6a 00                	push   $0x0
+  800561:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80056d:	48 89 d1             	mov    %rdx,%rcx
+  800570:	48 89 c2             	mov    %rax,%rdx
+  800573:	be 01 00 00 00       	mov    $0x1,%esi
+  800578:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80057d:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+  800589:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80058d:	c9                   	leave
+  80058e:	c3                   	ret
+
+000000000080058f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80058f:	55                   	push   %rbp
+  800590:	48 89 e5             	mov    %rsp,%rbp
+  800593:	48 83 ec 20          	sub    $0x20,%rsp
+  800597:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80059a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80059e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005a2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005a8:	48 63 f0             	movslq %eax,%rsi
+  8005ab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005b6:	48 98                	cltq
+  8005b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005bc:	6a 00                	push   $0x0
+  8005be:	49 89 f1             	mov    %rsi,%r9
+  8005c1:	49 89 c8             	mov    %rcx,%r8
+  8005c4:	48 89 d1             	mov    %rdx,%rcx
+  8005c7:	48 89 c2             	mov    %rax,%rdx
+  8005ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8005cf:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005d4:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+  8005e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005e4:	c9                   	leave
+  8005e5:	c3                   	ret
+
+00000000008005e6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005e6:	55                   	push   %rbp
+  8005e7:	48 89 e5             	mov    %rsp,%rbp
+  8005ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8005ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8005fa:	6a 00                	push   $0x0
+  8005fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800602:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80060d:	48 89 c2             	mov    %rax,%rdx
+  800610:	be 01 00 00 00       	mov    $0x1,%esi
+  800615:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80061a:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800621:	00 00 00 
+  800624:	ff d0                	call   *%rax
+  800626:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80062a:	c9                   	leave
+  80062b:	c3                   	ret
+
+000000000080062c <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80062c:	55                   	push   %rbp
+  80062d:	48 89 e5             	mov    %rsp,%rbp
+  800630:	48 83 ec 10          	sub    $0x10,%rsp
+  800634:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800638:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80063c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800644:	48 83 ec 08          	sub    $0x8,%rsp
+  800648:	6a 00                	push   $0x0
+  80064a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800650:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800656:	48 89 d1             	mov    %rdx,%rcx
+  800659:	48 89 c2             	mov    %rax,%rdx
+  80065c:	be 01 00 00 00       	mov    $0x1,%esi
+  800661:	bf 10 00 00 00       	mov    $0x10,%edi
+  800666:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80066d:	00 00 00 
+  800670:	ff d0                	call   *%rax
+  800672:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800676:	c9                   	leave
+  800677:	c3                   	ret
+
+0000000000800678 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  800678:	55                   	push   %rbp
+  800679:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80067c:	48 83 ec 08          	sub    $0x8,%rsp
+  800680:	6a 00                	push   $0x0
+  800682:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800688:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80068e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800693:	ba 00 00 00 00       	mov    $0x0,%edx
+  800698:	be 00 00 00 00       	mov    $0x0,%esi
+  80069d:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006a2:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8006a9:	00 00 00 
+  8006ac:	ff d0                	call   *%rax
+  8006ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006b2:	c9                   	leave
+  8006b3:	c3                   	ret
+
+00000000008006b4 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006b4:	55                   	push   %rbp
+  8006b5:	48 89 e5             	mov    %rsp,%rbp
+  8006b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8006bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d0:	6a 00                	push   $0x0
+  8006d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006de:	48 89 d1             	mov    %rdx,%rcx
+  8006e1:	48 89 c2             	mov    %rax,%rdx
+  8006e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e9:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006ee:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8006f5:	00 00 00 
+  8006f8:	ff d0                	call   *%rax
+  8006fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006fe:	c9                   	leave
+  8006ff:	c3                   	ret
+
+0000000000800700 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800700:	55                   	push   %rbp
+  800701:	48 89 e5             	mov    %rsp,%rbp
+  800704:	48 83 ec 20          	sub    $0x20,%rsp
+  800708:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80070c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800710:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800713:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800716:	48 63 c8             	movslq %eax,%rcx
+  800719:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80071d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800721:	48 83 ec 08          	sub    $0x8,%rsp
+  800725:	6a 00                	push   $0x0
+  800727:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80072d:	49 89 c8             	mov    %rcx,%r8
+  800730:	48 89 d1             	mov    %rdx,%rcx
+  800733:	48 89 c2             	mov    %rax,%rdx
+  800736:	be 00 00 00 00       	mov    $0x0,%esi
+  80073b:	bf 13 00 00 00       	mov    $0x13,%edi
+  800740:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800747:	00 00 00 
+  80074a:	ff d0                	call   *%rax
+  80074c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800750:	c9                   	leave
+  800751:	c3                   	ret
+
+0000000000800752 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800752:	55                   	push   %rbp
+  800753:	48 89 e5             	mov    %rsp,%rbp
+  800756:	48 83 ec 20          	sub    $0x20,%rsp
+  80075a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80075e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800761:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  800765:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800769:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80076c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800770:	48 83 ec 08          	sub    $0x8,%rsp
+  800774:	6a 00                	push   $0x0
+  800776:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80077c:	49 89 c8             	mov    %rcx,%r8
+  80077f:	48 89 d1             	mov    %rdx,%rcx
+  800782:	48 89 c2             	mov    %rax,%rdx
+  800785:	be 00 00 00 00       	mov    $0x0,%esi
+  80078a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80078f:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800796:	00 00 00 
+  800799:	ff d0                	call   *%rax
+  80079b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80079f:	c9                   	leave
+  8007a0:	c3                   	ret
+
+00000000008007a1 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007a1:	55                   	push   %rbp
+  8007a2:	48 89 e5             	mov    %rsp,%rbp
+  8007a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8007a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007ad:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007b3:	48 63 d0             	movslq %eax,%rdx
+  8007b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8007be:	6a 00                	push   $0x0
+  8007c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007cc:	48 89 d1             	mov    %rdx,%rcx
+  8007cf:	48 89 c2             	mov    %rax,%rdx
+  8007d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d7:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007dc:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8007e3:	00 00 00 
+  8007e6:	ff d0                	call   *%rax
+  8007e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007ec:	c9                   	leave
+  8007ed:	c3                   	ret
+
+00000000008007ee <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007ee:	55                   	push   %rbp
+  8007ef:	48 89 e5             	mov    %rsp,%rbp
+  8007f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8007f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007fd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800800:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  800804:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800808:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80080b:	48 63 c8             	movslq %eax,%rcx
+  80080e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800811:	48 63 d0             	movslq %eax,%rdx
+  800814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800818:	48 83 ec 08          	sub    $0x8,%rsp
+  80081c:	6a 00                	push   $0x0
+  80081e:	49 89 f1             	mov    %rsi,%r9
+  800821:	49 89 c8             	mov    %rcx,%r8
+  800824:	48 89 d1             	mov    %rdx,%rcx
+  800827:	48 89 c2             	mov    %rax,%rdx
+  80082a:	be 00 00 00 00       	mov    $0x0,%esi
+  80082f:	bf 16 00 00 00       	mov    $0x16,%edi
+  800834:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80083b:	00 00 00 
+  80083e:	ff d0                	call   *%rax
+  800840:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800844:	c9                   	leave
+  800845:	c3                   	ret
+
+0000000000800846 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  800846:	55                   	push   %rbp
+  800847:	48 89 e5             	mov    %rsp,%rbp
+  80084a:	48 83 ec 30          	sub    $0x30,%rsp
+  80084e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800852:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800856:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80085a:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80085e:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800862:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800866:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80086a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80086e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800872:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800876:	48 83 ec 08          	sub    $0x8,%rsp
+  80087a:	51                   	push   %rcx
+  80087b:	49 89 f9             	mov    %rdi,%r9
+  80087e:	49 89 f0             	mov    %rsi,%r8
+  800881:	48 89 d1             	mov    %rdx,%rcx
+  800884:	48 89 c2             	mov    %rax,%rdx
+  800887:	be 00 00 00 00       	mov    $0x0,%esi
+  80088c:	bf 17 00 00 00       	mov    $0x17,%edi
+  800891:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800898:	00 00 00 
+  80089b:	ff d0                	call   *%rax
+  80089d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+
+00000000008008a3 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008a3:	55                   	push   %rbp
+  8008a4:	48 89 e5             	mov    %rsp,%rbp
+  8008a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8008ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008b1:	48 98                	cltq
+  8008b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b7:	6a 00                	push   $0x0
+  8008b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ca:	48 89 c2             	mov    %rax,%rdx
+  8008cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8008d2:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008d7:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8008de:	00 00 00 
+  8008e1:	ff d0                	call   *%rax
+  8008e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008e7:	90                   	nop
+  8008e8:	c9                   	leave
+  8008e9:	c3                   	ret
+
+00000000008008ea <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008ea:	55                   	push   %rbp
+  8008eb:	48 89 e5             	mov    %rsp,%rbp
+  8008ee:	48 83 ec 30          	sub    $0x30,%rsp
+  8008f2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008f9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8008fd:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800900:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800903:	48 63 f0             	movslq %eax,%rsi
+  800906:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80090a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80090e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800911:	48 98                	cltq
+  800913:	48 83 ec 08          	sub    $0x8,%rsp
+  800917:	6a 00                	push   $0x0
+  800919:	49 89 f1             	mov    %rsi,%r9
+  80091c:	49 89 c8             	mov    %rcx,%r8
+  80091f:	48 89 d1             	mov    %rdx,%rcx
+  800922:	48 89 c2             	mov    %rax,%rdx
+  800925:	be 01 00 00 00       	mov    $0x1,%esi
+  80092a:	bf 19 00 00 00       	mov    $0x19,%edi
+  80092f:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800936:	00 00 00 
+  800939:	ff d0                	call   *%rax
+  80093b:	48 83 c4 10          	add    $0x10,%rsp
+  80093f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800942:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800945:	c9                   	leave
+  800946:	c3                   	ret
+
+0000000000800947 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  800947:	55                   	push   %rbp
+  800948:	48 89 e5             	mov    %rsp,%rbp
+  80094b:	48 83 ec 20          	sub    $0x20,%rsp
+  80094f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800953:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800957:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80095a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80095d:	48 63 c8             	movslq %eax,%rcx
+  800960:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	6a 00                	push   $0x0
+  80096e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800974:	49 89 c8             	mov    %rcx,%r8
+  800977:	48 89 d1             	mov    %rdx,%rcx
+  80097a:	48 89 c2             	mov    %rax,%rdx
+  80097d:	be 01 00 00 00       	mov    $0x1,%esi
+  800982:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  800987:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  80098e:	00 00 00 
+  800991:	ff d0                	call   *%rax
+  800993:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800997:	c9                   	leave
+  800998:	c3                   	ret
+
+0000000000800999 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  800999:	55                   	push   %rbp
+  80099a:	48 89 e5             	mov    %rsp,%rbp
+  80099d:	48 83 ec 20          	sub    $0x20,%rsp
+  8009a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009ad:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009bd:	6a 00                	push   $0x0
+  8009bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009c5:	49 89 c8             	mov    %rcx,%r8
+  8009c8:	48 89 d1             	mov    %rdx,%rcx
+  8009cb:	48 89 c2             	mov    %rax,%rdx
+  8009ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8009d3:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009d8:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8009df:	00 00 00 
+  8009e2:	ff d0                	call   *%rax
+  8009e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009e8:	c9                   	leave
+  8009e9:	c3                   	ret
+
+00000000008009ea <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009ea:	55                   	push   %rbp
+  8009eb:	48 89 e5             	mov    %rsp,%rbp
+  8009ee:	48 83 ec 30          	sub    $0x30,%rsp
+  8009f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009fa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8009fd:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a01:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a08:	48 63 c8             	movslq %eax,%rcx
+  800a0b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a13:	48 83 ec 08          	sub    $0x8,%rsp
+  800a17:	6a 00                	push   $0x0
+  800a19:	49 89 f1             	mov    %rsi,%r9
+  800a1c:	49 89 c8             	mov    %rcx,%r8
+  800a1f:	48 89 d1             	mov    %rdx,%rcx
+  800a22:	48 89 c2             	mov    %rax,%rdx
+  800a25:	be 01 00 00 00       	mov    $0x1,%esi
+  800a2a:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a2f:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800a36:	00 00 00 
+  800a39:	ff d0                	call   *%rax
+  800a3b:	48 83 c4 10          	add    $0x10,%rsp
+  800a3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+0000000000800a47 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a47:	55                   	push   %rbp
+  800a48:	48 89 e5             	mov    %rsp,%rbp
+  800a4b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a4f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a55:	48 98                	cltq
+  800a57:	48 83 ec 08          	sub    $0x8,%rsp
+  800a5b:	6a 00                	push   $0x0
+  800a5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6e:	48 89 c2             	mov    %rax,%rdx
+  800a71:	be 01 00 00 00       	mov    $0x1,%esi
+  800a76:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a7b:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  800a82:	00 00 00 
+  800a85:	ff d0                	call   *%rax
+  800a87:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a8b:	c9                   	leave
+  800a8c:	c3                   	ret
+
+0000000000800a8d <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a8d:	55                   	push   %rbp
+  800a8e:	48 89 e5             	mov    %rsp,%rbp
+  800a91:	48 83 ec 08          	sub    $0x8,%rsp
+  800a95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a9d:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800aa4:	ff ff ff 
+  800aa7:	48 01 d0             	add    %rdx,%rax
+  800aaa:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800aae:	c9                   	leave
+  800aaf:	c3                   	ret
+
+0000000000800ab0 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800ab0:	55                   	push   %rbp
+  800ab1:	48 89 e5             	mov    %rsp,%rbp
+  800ab4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac0:	48 89 c7             	mov    %rax,%rdi
+  800ac3:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800ad5:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800ad9:	c9                   	leave
+  800ada:	c3                   	ret
+
+0000000000800adb <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800adb:	55                   	push   %rbp
+  800adc:	48 89 e5             	mov    %rsp,%rbp
+  800adf:	48 83 ec 18          	sub    $0x18,%rsp
+  800ae3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800ae7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800aee:	e9 ae 00 00 00       	jmp    800ba1 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800af6:	c1 e0 0c             	shl    $0xc,%eax
+  800af9:	48 98                	cltq
+  800afb:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b00:	48 01 d0             	add    %rdx,%rax
+  800b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b0b:	48 c1 e8 27          	shr    $0x27,%rax
+  800b0f:	48 89 c2             	mov    %rax,%rdx
+  800b12:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b19:	01 00 00 
+  800b1c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b20:	83 e0 01             	and    $0x1,%eax
+  800b23:	48 85 c0             	test   %rax,%rax
+  800b26:	74 63                	je     800b8b <fd_alloc+0xb0>
+  800b28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b2c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b30:	48 89 c2             	mov    %rax,%rdx
+  800b33:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b3a:	01 00 00 
+  800b3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b41:	83 e0 01             	and    $0x1,%eax
+  800b44:	48 85 c0             	test   %rax,%rax
+  800b47:	74 42                	je     800b8b <fd_alloc+0xb0>
+  800b49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b4d:	48 c1 e8 15          	shr    $0x15,%rax
+  800b51:	48 89 c2             	mov    %rax,%rdx
+  800b54:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b5b:	01 00 00 
+  800b5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b62:	83 e0 01             	and    $0x1,%eax
+  800b65:	48 85 c0             	test   %rax,%rax
+  800b68:	74 21                	je     800b8b <fd_alloc+0xb0>
+  800b6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6e:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b72:	48 89 c2             	mov    %rax,%rdx
+  800b75:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b7c:	01 00 00 
+  800b7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b83:	83 e0 01             	and    $0x1,%eax
+  800b86:	48 85 c0             	test   %rax,%rax
+  800b89:	75 12                	jne    800b9d <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b93:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9b:	eb 1e                	jmp    800bbb <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800b9d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800ba1:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ba5:	0f 8e 48 ff ff ff    	jle    800af3 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800baf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bb6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+
+0000000000800bbd <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bbd:	55                   	push   %rbp
+  800bbe:	48 89 e5             	mov    %rsp,%rbp
+  800bc1:	48 83 ec 20          	sub    $0x20,%rsp
+  800bc5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bd0:	78 06                	js     800bd8 <fd_lookup+0x1b>
+  800bd2:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bd6:	7e 0a                	jle    800be2 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bdd:	e9 af 00 00 00       	jmp    800c91 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800be2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800be5:	c1 e0 0c             	shl    $0xc,%eax
+  800be8:	48 98                	cltq
+  800bea:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800bef:	48 01 d0             	add    %rdx,%rax
+  800bf2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800bf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bfa:	48 c1 e8 27          	shr    $0x27,%rax
+  800bfe:	48 89 c2             	mov    %rax,%rdx
+  800c01:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c08:	01 00 00 
+  800c0b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c0f:	83 e0 01             	and    $0x1,%eax
+  800c12:	48 85 c0             	test   %rax,%rax
+  800c15:	74 63                	je     800c7a <fd_lookup+0xbd>
+  800c17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c1b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c1f:	48 89 c2             	mov    %rax,%rdx
+  800c22:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c29:	01 00 00 
+  800c2c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c30:	83 e0 01             	and    $0x1,%eax
+  800c33:	48 85 c0             	test   %rax,%rax
+  800c36:	74 42                	je     800c7a <fd_lookup+0xbd>
+  800c38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c3c:	48 c1 e8 15          	shr    $0x15,%rax
+  800c40:	48 89 c2             	mov    %rax,%rdx
+  800c43:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c4a:	01 00 00 
+  800c4d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c51:	83 e0 01             	and    $0x1,%eax
+  800c54:	48 85 c0             	test   %rax,%rax
+  800c57:	74 21                	je     800c7a <fd_lookup+0xbd>
+  800c59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c5d:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c61:	48 89 c2             	mov    %rax,%rdx
+  800c64:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c6b:	01 00 00 
+  800c6e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c72:	83 e0 01             	and    $0x1,%eax
+  800c75:	48 85 c0             	test   %rax,%rax
+  800c78:	75 07                	jne    800c81 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c7f:	eb 10                	jmp    800c91 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c89:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+
+0000000000800c93 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c93:	55                   	push   %rbp
+  800c94:	48 89 e5             	mov    %rsp,%rbp
+  800c97:	48 83 ec 30          	sub    $0x30,%rsp
+  800c9b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c9f:	89 f0                	mov    %esi,%eax
+  800ca1:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800ca4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ca8:	48 89 c7             	mov    %rax,%rdi
+  800cab:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  800cb2:	00 00 00 
+  800cb5:	ff d0                	call   *%rax
+  800cb7:	89 c2                	mov    %eax,%edx
+  800cb9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cbd:	48 89 c6             	mov    %rax,%rsi
+  800cc0:	89 d7                	mov    %edx,%edi
+  800cc2:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  800cc9:	00 00 00 
+  800ccc:	ff d0                	call   *%rax
+  800cce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800cd1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800cd5:	78 0a                	js     800ce1 <fd_close+0x4e>
+  800cd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cdb:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cdf:	74 12                	je     800cf3 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800ce1:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800ce5:	74 05                	je     800cec <fd_close+0x59>
+  800ce7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800cea:	eb 70                	jmp    800d5c <fd_close+0xc9>
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	eb 69                	jmp    800d5c <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cf3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cf7:	8b 00                	mov    (%rax),%eax
+  800cf9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800cfd:	48 89 d6             	mov    %rdx,%rsi
+  800d00:	89 c7                	mov    %eax,%edi
+  800d02:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  800d09:	00 00 00 
+  800d0c:	ff d0                	call   *%rax
+  800d0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d15:	78 2a                	js     800d41 <fd_close+0xae>
+    if (dev->dev_close)
+  800d17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d1f:	48 85 c0             	test   %rax,%rax
+  800d22:	74 16                	je     800d3a <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d28:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d30:	48 89 c7             	mov    %rax,%rdi
+  800d33:	ff d2                	call   *%rdx
+  800d35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d38:	eb 07                	jmp    800d41 <fd_close+0xae>
+    else
+      r = 0;
+  800d3a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d45:	48 89 c6             	mov    %rax,%rsi
+  800d48:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d4d:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  800d54:	00 00 00 
+  800d57:	ff d0                	call   *%rax
+  return r;
+  800d59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d5c:	c9                   	leave
+  800d5d:	c3                   	ret
+
+0000000000800d5e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d5e:	55                   	push   %rbp
+  800d5f:	48 89 e5             	mov    %rsp,%rbp
+  800d62:	48 83 ec 20          	sub    $0x20,%rsp
+  800d66:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d69:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d6d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d74:	eb 3f                	jmp    800db5 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d76:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d7d:	00 00 00 
+  800d80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d83:	48 98                	cltq
+  800d85:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d89:	8b 00                	mov    (%rax),%eax
+  800d8b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d8e:	75 21                	jne    800db1 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d90:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d97:	00 00 00 
+  800d9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d9d:	48 98                	cltq
+  800d9f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800da3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800da7:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daf:	eb 7f                	jmp    800e30 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800db1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800db5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dbc:	00 00 00 
+  800dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dc2:	48 98                	cltq
+  800dc4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dc8:	48 85 c0             	test   %rax,%rax
+  800dcb:	75 a9                	jne    800d76 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dcd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dd4:	00 00 00 
+  800dd7:	8b 40 04             	mov    0x4(%rax),%eax
+  800dda:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800ddf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800de6:	00 00 00 
+  800de9:	48 98                	cltq
+  800deb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800df2:	48 01 d0             	add    %rdx,%rax
+  800df5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800dfb:	8b 00                	mov    (%rax),%eax
+  800dfd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e00:	89 c6                	mov    %eax,%esi
+  800e02:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800e09:	00 00 00 
+  800e0c:	48 89 c7             	mov    %rax,%rdi
+  800e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e14:	48 b9 55 31 80 00 00 	movabs $0x803155,%rcx
+  800e1b:	00 00 00 
+  800e1e:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e24:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e30:	c9                   	leave
+  800e31:	c3                   	ret
+
+0000000000800e32 <close>:
+
+int
+close(int fdnum) {
+  800e32:	55                   	push   %rbp
+  800e33:	48 89 e5             	mov    %rsp,%rbp
+  800e36:	48 83 ec 20          	sub    $0x20,%rsp
+  800e3a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e3d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e44:	48 89 d6             	mov    %rdx,%rsi
+  800e47:	89 c7                	mov    %eax,%edi
+  800e49:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  800e50:	00 00 00 
+  800e53:	ff d0                	call   *%rax
+  800e55:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e58:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e5c:	79 05                	jns    800e63 <close+0x31>
+    return r;
+  800e5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e61:	eb 18                	jmp    800e7b <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e67:	be 01 00 00 00       	mov    $0x1,%esi
+  800e6c:	48 89 c7             	mov    %rax,%rdi
+  800e6f:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+}
+  800e7b:	c9                   	leave
+  800e7c:	c3                   	ret
+
+0000000000800e7d <close_all>:
+
+void
+close_all(void) {
+  800e7d:	55                   	push   %rbp
+  800e7e:	48 89 e5             	mov    %rsp,%rbp
+  800e81:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e85:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e8c:	eb 15                	jmp    800ea3 <close_all+0x26>
+    close(i);
+  800e8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e91:	89 c7                	mov    %eax,%edi
+  800e93:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800e9f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800ea3:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ea7:	7e e5                	jle    800e8e <close_all+0x11>
+}
+  800ea9:	90                   	nop
+  800eaa:	90                   	nop
+  800eab:	c9                   	leave
+  800eac:	c3                   	ret
+
+0000000000800ead <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ead:	55                   	push   %rbp
+  800eae:	48 89 e5             	mov    %rsp,%rbp
+  800eb1:	48 83 ec 40          	sub    $0x40,%rsp
+  800eb5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800eb8:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ebb:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800ebf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ec2:	48 89 d6             	mov    %rdx,%rsi
+  800ec5:	89 c7                	mov    %eax,%edi
+  800ec7:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  800ece:	00 00 00 
+  800ed1:	ff d0                	call   *%rax
+  800ed3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ed6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800eda:	79 08                	jns    800ee4 <dup+0x37>
+    return r;
+  800edc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800edf:	e9 33 02 00 00       	jmp    801117 <dup+0x26a>
+  close(newfdnum);
+  800ee4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ee7:	89 c7                	mov    %eax,%edi
+  800ee9:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  800ef0:	00 00 00 
+  800ef3:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800ef5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ef8:	c1 e0 0c             	shl    $0xc,%eax
+  800efb:	48 98                	cltq
+  800efd:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f02:	48 01 d0             	add    %rdx,%rax
+  800f05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f0d:	48 89 c7             	mov    %rax,%rdi
+  800f10:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800f17:	00 00 00 
+  800f1a:	ff d0                	call   *%rax
+  800f1c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f24:	48 89 c7             	mov    %rax,%rdi
+  800f27:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  800f2e:	00 00 00 
+  800f31:	ff d0                	call   *%rax
+  800f33:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f37:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f3e:	00 
+  800f3f:	e9 19 01 00 00       	jmp    80105d <dup+0x1b0>
+    off -= PGSIZE;
+  800f44:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f4b:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f4c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f54:	48 01 d0             	add    %rdx,%rax
+  800f57:	48 c1 e8 27          	shr    $0x27,%rax
+  800f5b:	48 89 c2             	mov    %rax,%rdx
+  800f5e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f65:	01 00 00 
+  800f68:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f6c:	83 e0 01             	and    $0x1,%eax
+  800f6f:	48 85 c0             	test   %rax,%rax
+  800f72:	0f 84 e5 00 00 00    	je     80105d <dup+0x1b0>
+  800f78:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f80:	48 01 d0             	add    %rdx,%rax
+  800f83:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f87:	48 89 c2             	mov    %rax,%rdx
+  800f8a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f91:	01 00 00 
+  800f94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f98:	83 e0 01             	and    $0x1,%eax
+  800f9b:	48 85 c0             	test   %rax,%rax
+  800f9e:	0f 84 b9 00 00 00    	je     80105d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fa4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fa8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fac:	48 01 d0             	add    %rdx,%rax
+  800faf:	48 c1 e8 15          	shr    $0x15,%rax
+  800fb3:	48 89 c2             	mov    %rax,%rdx
+  800fb6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fbd:	01 00 00 
+  800fc0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fc4:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fc7:	48 85 c0             	test   %rax,%rax
+  800fca:	0f 84 8d 00 00 00    	je     80105d <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fd0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd8:	48 01 d0             	add    %rdx,%rax
+  800fdb:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fdf:	48 89 c2             	mov    %rax,%rdx
+  800fe2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fe9:	01 00 00 
+  800fec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ff0:	83 e0 01             	and    $0x1,%eax
+  800ff3:	48 85 c0             	test   %rax,%rax
+  800ff6:	74 65                	je     80105d <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800ff8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ffc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801000:	48 01 d0             	add    %rdx,%rax
+  801003:	48 c1 e8 0c          	shr    $0xc,%rax
+  801007:	48 89 c2             	mov    %rax,%rdx
+  80100a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801011:	01 00 00 
+  801014:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801018:	25 07 0e 00 00       	and    $0xe07,%eax
+  80101d:	89 c6                	mov    %eax,%esi
+  80101f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801023:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801027:	48 01 c2             	add    %rax,%rdx
+  80102a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80102e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801032:	48 01 c8             	add    %rcx,%rax
+  801035:	41 89 f0             	mov    %esi,%r8d
+  801038:	48 89 d1             	mov    %rdx,%rcx
+  80103b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801040:	48 89 c6             	mov    %rax,%rsi
+  801043:	bf 00 00 00 00       	mov    $0x0,%edi
+  801048:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  80104f:	00 00 00 
+  801052:	ff d0                	call   *%rax
+  801054:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801057:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80105b:	78 60                	js     8010bd <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80105d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801062:	0f 85 dc fe ff ff    	jne    800f44 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801068:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80106c:	48 c1 e8 0c          	shr    $0xc,%rax
+  801070:	48 89 c2             	mov    %rax,%rdx
+  801073:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80107a:	01 00 00 
+  80107d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801081:	25 07 0e 00 00       	and    $0xe07,%eax
+  801086:	89 c1                	mov    %eax,%ecx
+  801088:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80108c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801090:	41 89 c8             	mov    %ecx,%r8d
+  801093:	48 89 d1             	mov    %rdx,%rcx
+  801096:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109b:	48 89 c6             	mov    %rax,%rsi
+  80109e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010a3:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+  8010af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010b6:	78 08                	js     8010c0 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010b8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010bb:	eb 5a                	jmp    801117 <dup+0x26a>
+        goto err;
+  8010bd:	90                   	nop
+  8010be:	eb 01                	jmp    8010c1 <dup+0x214>
+    goto err;
+  8010c0:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c5:	48 89 c6             	mov    %rax,%rsi
+  8010c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010cd:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  8010d4:	00 00 00 
+  8010d7:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010d9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010e0:	00 
+  8010e1:	eb 27                	jmp    80110a <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010e3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010eb:	48 01 d0             	add    %rdx,%rax
+  8010ee:	48 89 c6             	mov    %rax,%rsi
+  8010f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010f6:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  8010fd:	00 00 00 
+  801100:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801102:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801109:	00 
+  80110a:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801111:	00 
+  801112:	76 cf                	jbe    8010e3 <dup+0x236>
+  return r;
+  801114:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801117:	c9                   	leave
+  801118:	c3                   	ret
+
+0000000000801119 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+  80111d:	48 83 ec 40          	sub    $0x40,%rsp
+  801121:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801124:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801128:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80112c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801130:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801133:	48 89 d6             	mov    %rdx,%rsi
+  801136:	89 c7                	mov    %eax,%edi
+  801138:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+  801144:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801147:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80114b:	78 24                	js     801171 <read+0x58>
+  80114d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801151:	8b 00                	mov    (%rax),%eax
+  801153:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801157:	48 89 d6             	mov    %rdx,%rsi
+  80115a:	89 c7                	mov    %eax,%edi
+  80115c:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  801163:	00 00 00 
+  801166:	ff d0                	call   *%rax
+  801168:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80116b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80116f:	79 0a                	jns    80117b <read+0x62>
+    return r;
+  801171:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801174:	48 98                	cltq
+  801176:	e9 9e 00 00 00       	jmp    801219 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80117b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80117f:	8b 40 08             	mov    0x8(%rax),%eax
+  801182:	83 e0 03             	and    $0x3,%eax
+  801185:	83 f8 01             	cmp    $0x1,%eax
+  801188:	75 5c                	jne    8011e6 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80118a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801191:	00 00 00 
+  801194:	8b 40 04             	mov    0x4(%rax),%eax
+  801197:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80119c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011a3:	00 00 00 
+  8011a6:	48 98                	cltq
+  8011a8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011af:	48 01 d0             	add    %rdx,%rax
+  8011b2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011b8:	8b 00                	mov    (%rax),%eax
+  8011ba:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011bd:	89 c6                	mov    %eax,%esi
+  8011bf:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011c6:	00 00 00 
+  8011c9:	48 89 c7             	mov    %rax,%rdi
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d1:	48 b9 55 31 80 00 00 	movabs $0x803155,%rcx
+  8011d8:	00 00 00 
+  8011db:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011e4:	eb 33                	jmp    801219 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011ee:	48 85 c0             	test   %rax,%rax
+  8011f1:	75 09                	jne    8011fc <read+0xe3>
+    return -E_NOT_SUPP;
+  8011f3:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8011fa:	eb 1d                	jmp    801219 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8011fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801200:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801204:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801208:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80120c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801210:	48 89 ce             	mov    %rcx,%rsi
+  801213:	48 89 c7             	mov    %rax,%rdi
+  801216:	41 ff d0             	call   *%r8
+}
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+
+000000000080121b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80121b:	55                   	push   %rbp
+  80121c:	48 89 e5             	mov    %rsp,%rbp
+  80121f:	48 83 ec 30          	sub    $0x30,%rsp
+  801223:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801226:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80122a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80122e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801235:	eb 49                	jmp    801280 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  801237:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123a:	48 98                	cltq
+  80123c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801240:	48 29 c2             	sub    %rax,%rdx
+  801243:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801246:	48 63 c8             	movslq %eax,%rcx
+  801249:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80124d:	48 01 c1             	add    %rax,%rcx
+  801250:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801253:	48 89 ce             	mov    %rcx,%rsi
+  801256:	89 c7                	mov    %eax,%edi
+  801258:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+  801264:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  801267:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80126b:	79 07                	jns    801274 <readn+0x59>
+      return m;
+  80126d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801270:	48 98                	cltq
+  801272:	eb 1f                	jmp    801293 <readn+0x78>
+    if (m == 0)
+  801274:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801278:	74 13                	je     80128d <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80127a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80127d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801283:	48 98                	cltq
+  801285:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801289:	72 ac                	jb     801237 <readn+0x1c>
+  80128b:	eb 01                	jmp    80128e <readn+0x73>
+      break;
+  80128d:	90                   	nop
+  }
+  return tot;
+  80128e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801291:	48 98                	cltq
+}
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	48 83 ec 40          	sub    $0x40,%rsp
+  80129d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012a8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012af:	48 89 d6             	mov    %rdx,%rsi
+  8012b2:	89 c7                	mov    %eax,%edi
+  8012b4:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8012bb:	00 00 00 
+  8012be:	ff d0                	call   *%rax
+  8012c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012c7:	78 24                	js     8012ed <write+0x58>
+  8012c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012cd:	8b 00                	mov    (%rax),%eax
+  8012cf:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012d3:	48 89 d6             	mov    %rdx,%rsi
+  8012d6:	89 c7                	mov    %eax,%edi
+  8012d8:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  8012df:	00 00 00 
+  8012e2:	ff d0                	call   *%rax
+  8012e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012eb:	79 0a                	jns    8012f7 <write+0x62>
+    return r;
+  8012ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012f0:	48 98                	cltq
+  8012f2:	e9 9d 00 00 00       	jmp    801394 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012fb:	8b 40 08             	mov    0x8(%rax),%eax
+  8012fe:	83 e0 03             	and    $0x3,%eax
+  801301:	85 c0                	test   %eax,%eax
+  801303:	75 5c                	jne    801361 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801305:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80130c:	00 00 00 
+  80130f:	8b 40 04             	mov    0x4(%rax),%eax
+  801312:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801317:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80131e:	00 00 00 
+  801321:	48 98                	cltq
+  801323:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80132a:	48 01 d0             	add    %rdx,%rax
+  80132d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801333:	8b 00                	mov    (%rax),%eax
+  801335:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801338:	89 c6                	mov    %eax,%esi
+  80133a:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  801341:	00 00 00 
+  801344:	48 89 c7             	mov    %rax,%rdi
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	48 b9 55 31 80 00 00 	movabs $0x803155,%rcx
+  801353:	00 00 00 
+  801356:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801358:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80135f:	eb 33                	jmp    801394 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801361:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801365:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801369:	48 85 c0             	test   %rax,%rax
+  80136c:	75 09                	jne    801377 <write+0xe2>
+    return -E_NOT_SUPP;
+  80136e:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801375:	eb 1d                	jmp    801394 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  801377:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80137f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801383:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801387:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80138b:	48 89 ce             	mov    %rcx,%rsi
+  80138e:	48 89 c7             	mov    %rax,%rdi
+  801391:	41 ff d0             	call   *%r8
+}
+  801394:	c9                   	leave
+  801395:	c3                   	ret
+
+0000000000801396 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801396:	55                   	push   %rbp
+  801397:	48 89 e5             	mov    %rsp,%rbp
+  80139a:	48 83 ec 18          	sub    $0x18,%rsp
+  80139e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013a1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013a4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013ab:	48 89 d6             	mov    %rdx,%rsi
+  8013ae:	89 c7                	mov    %eax,%edi
+  8013b0:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8013b7:	00 00 00 
+  8013ba:	ff d0                	call   *%rax
+  8013bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013c3:	79 05                	jns    8013ca <seek+0x34>
+    return r;
+  8013c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013c8:	eb 0f                	jmp    8013d9 <seek+0x43>
+  fd->fd_offset = offset;
+  8013ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ce:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013d1:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d9:	c9                   	leave
+  8013da:	c3                   	ret
+
+00000000008013db <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013db:	55                   	push   %rbp
+  8013dc:	48 89 e5             	mov    %rsp,%rbp
+  8013df:	48 83 ec 30          	sub    $0x30,%rsp
+  8013e3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013e6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013f0:	48 89 d6             	mov    %rdx,%rsi
+  8013f3:	89 c7                	mov    %eax,%edi
+  8013f5:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8013fc:	00 00 00 
+  8013ff:	ff d0                	call   *%rax
+  801401:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801404:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801408:	78 24                	js     80142e <ftruncate+0x53>
+  80140a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140e:	8b 00                	mov    (%rax),%eax
+  801410:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801414:	48 89 d6             	mov    %rdx,%rsi
+  801417:	89 c7                	mov    %eax,%edi
+  801419:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  801420:	00 00 00 
+  801423:	ff d0                	call   *%rax
+  801425:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801428:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80142c:	79 08                	jns    801436 <ftruncate+0x5b>
+    return r;
+  80142e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801431:	e9 92 00 00 00       	jmp    8014c8 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143a:	8b 40 08             	mov    0x8(%rax),%eax
+  80143d:	83 e0 03             	and    $0x3,%eax
+  801440:	85 c0                	test   %eax,%eax
+  801442:	75 5a                	jne    80149e <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  801444:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80144b:	00 00 00 
+  80144e:	8b 40 04             	mov    0x4(%rax),%eax
+  801451:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801456:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80145d:	00 00 00 
+  801460:	48 98                	cltq
+  801462:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801469:	48 01 d0             	add    %rdx,%rax
+  80146c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801472:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801474:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801477:	89 c6                	mov    %eax,%esi
+  801479:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  801480:	00 00 00 
+  801483:	48 89 c7             	mov    %rax,%rdi
+  801486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148b:	48 b9 55 31 80 00 00 	movabs $0x803155,%rcx
+  801492:	00 00 00 
+  801495:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801497:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149c:	eb 2a                	jmp    8014c8 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80149e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014a6:	48 85 c0             	test   %rax,%rax
+  8014a9:	75 07                	jne    8014b2 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014ab:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014b0:	eb 16                	jmp    8014c8 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b6:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014be:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014c1:	89 d6                	mov    %edx,%esi
+  8014c3:	48 89 c7             	mov    %rax,%rdi
+  8014c6:	ff d1                	call   *%rcx
+}
+  8014c8:	c9                   	leave
+  8014c9:	c3                   	ret
+
+00000000008014ca <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014ca:	55                   	push   %rbp
+  8014cb:	48 89 e5             	mov    %rsp,%rbp
+  8014ce:	48 83 ec 30          	sub    $0x30,%rsp
+  8014d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014e0:	48 89 d6             	mov    %rdx,%rsi
+  8014e3:	89 c7                	mov    %eax,%edi
+  8014e5:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8014ec:	00 00 00 
+  8014ef:	ff d0                	call   *%rax
+  8014f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014f4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014f8:	78 24                	js     80151e <fstat+0x54>
+  8014fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fe:	8b 00                	mov    (%rax),%eax
+  801500:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801504:	48 89 d6             	mov    %rdx,%rsi
+  801507:	89 c7                	mov    %eax,%edi
+  801509:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  801510:	00 00 00 
+  801513:	ff d0                	call   *%rax
+  801515:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801518:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80151c:	79 05                	jns    801523 <fstat+0x59>
+    return r;
+  80151e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801521:	eb 5e                	jmp    801581 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801523:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801527:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80152b:	48 85 c0             	test   %rax,%rax
+  80152e:	75 07                	jne    801537 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801530:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  801535:	eb 4a                	jmp    801581 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  801537:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80153b:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80153e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801542:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801549:	00 00 00 
+  stat->st_isdir   = 0;
+  80154c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801550:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  801557:	00 00 00 
+  stat->st_dev     = dev;
+  80155a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80155e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801562:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  801569:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80156d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801571:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801575:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801579:	48 89 d6             	mov    %rdx,%rsi
+  80157c:	48 89 c7             	mov    %rax,%rdi
+  80157f:	ff d1                	call   *%rcx
+}
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+
+0000000000801583 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801583:	55                   	push   %rbp
+  801584:	48 89 e5             	mov    %rsp,%rbp
+  801587:	48 83 ec 10          	sub    $0x10,%rsp
+  80158b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80158f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  801593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801597:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80159d:	83 f8 20             	cmp    $0x20,%eax
+  8015a0:	75 07                	jne    8015a9 <pollwait_key+0x26>
+    return -E_INVAL;
+  8015a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a7:	eb 5f                	jmp    801608 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ad:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b7:	48 63 d2             	movslq %edx,%rdx
+  8015ba:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015be:	48 01 c2             	add    %rax,%rdx
+  8015c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c5:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015cc:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d6:	8b 00                	mov    (%rax),%eax
+  8015d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015dc:	48 63 c9             	movslq %ecx,%rcx
+  8015df:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015e3:	48 01 ca             	add    %rcx,%rdx
+  8015e6:	48 83 c2 08          	add    $0x8,%rdx
+  8015ea:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f0:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8015f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fd:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+
+000000000080160a <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80160a:	55                   	push   %rbp
+  80160b:	48 89 e5             	mov    %rsp,%rbp
+  80160e:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801615:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80161c:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801622:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801629:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801630:	00 
+  int i, r, ready, ipc = 0;
+  801631:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  801638:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80163f:	00 
+  801640:	74 45                	je     801687 <poll+0x7d>
+  801642:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801649:	ff 
+  80164a:	74 3b                	je     801687 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80164c:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  801653:	00 00 00 
+  801656:	ff d0                	call   *%rax
+  801658:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80165c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801660:	48 f7 d0             	not    %rax
+  801663:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80166a:	73 10                	jae    80167c <poll+0x72>
+  80166c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801670:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  801677:	48 01 d0             	add    %rdx,%rax
+  80167a:	eb 07                	jmp    801683 <poll+0x79>
+  80167c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801683:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  801687:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80168e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  801695:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80169c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016a3:	e9 46 02 00 00       	jmp    8018ee <poll+0x2e4>
+      fds[i].revents = 0;
+  8016a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016ab:	48 63 d0             	movslq %eax,%rdx
+  8016ae:	48 89 d0             	mov    %rdx,%rax
+  8016b1:	48 01 c0             	add    %rax,%rax
+  8016b4:	48 01 d0             	add    %rdx,%rax
+  8016b7:	48 c1 e0 02          	shl    $0x2,%rax
+  8016bb:	48 89 c2             	mov    %rax,%rdx
+  8016be:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016c5:	48 01 d0             	add    %rdx,%rax
+  8016c8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016cf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016d2:	48 63 d0             	movslq %eax,%rdx
+  8016d5:	48 89 d0             	mov    %rdx,%rax
+  8016d8:	48 01 c0             	add    %rax,%rax
+  8016db:	48 01 d0             	add    %rdx,%rax
+  8016de:	48 c1 e0 02          	shl    $0x2,%rax
+  8016e2:	48 89 c2             	mov    %rax,%rdx
+  8016e5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016ec:	48 01 d0             	add    %rdx,%rax
+  8016ef:	8b 00                	mov    (%rax),%eax
+  8016f1:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016f4:	75 62                	jne    801758 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8016f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016f9:	48 63 d0             	movslq %eax,%rdx
+  8016fc:	48 89 d0             	mov    %rdx,%rax
+  8016ff:	48 01 c0             	add    %rax,%rax
+  801702:	48 01 d0             	add    %rdx,%rax
+  801705:	48 c1 e0 02          	shl    $0x2,%rax
+  801709:	48 89 c2             	mov    %rax,%rdx
+  80170c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801713:	48 01 d0             	add    %rdx,%rax
+  801716:	8b 40 04             	mov    0x4(%rax),%eax
+  801719:	83 e0 01             	and    $0x1,%eax
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	0f 84 9b 01 00 00    	je     8018bf <poll+0x2b5>
+          fds[i].revents = ipc;
+  801724:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801727:	48 63 d0             	movslq %eax,%rdx
+  80172a:	48 89 d0             	mov    %rdx,%rax
+  80172d:	48 01 c0             	add    %rax,%rax
+  801730:	48 01 d0             	add    %rdx,%rax
+  801733:	48 c1 e0 02          	shl    $0x2,%rax
+  801737:	48 89 c2             	mov    %rax,%rdx
+  80173a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801741:	48 01 c2             	add    %rax,%rdx
+  801744:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801747:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80174a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80174d:	83 c8 04             	or     $0x4,%eax
+  801750:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  801753:	e9 67 01 00 00       	jmp    8018bf <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  801758:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80175b:	48 63 d0             	movslq %eax,%rdx
+  80175e:	48 89 d0             	mov    %rdx,%rax
+  801761:	48 01 c0             	add    %rax,%rax
+  801764:	48 01 d0             	add    %rdx,%rax
+  801767:	48 c1 e0 02          	shl    $0x2,%rax
+  80176b:	48 89 c2             	mov    %rax,%rdx
+  80176e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801775:	48 01 d0             	add    %rdx,%rax
+  801778:	8b 00                	mov    (%rax),%eax
+  80177a:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801781:	48 89 d6             	mov    %rdx,%rsi
+  801784:	89 c7                	mov    %eax,%edi
+  801786:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 25                	js     8017bb <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  801796:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80179d:	8b 00                	mov    (%rax),%eax
+  80179f:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017a6:	48 89 d6             	mov    %rdx,%rsi
+  8017a9:	89 c7                	mov    %eax,%edi
+  8017ab:	48 b8 5e 0d 80 00 00 	movabs $0x800d5e,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017b7:	85 c0                	test   %eax,%eax
+  8017b9:	79 2c                	jns    8017e7 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017be:	48 63 d0             	movslq %eax,%rdx
+  8017c1:	48 89 d0             	mov    %rdx,%rax
+  8017c4:	48 01 c0             	add    %rax,%rax
+  8017c7:	48 01 d0             	add    %rdx,%rax
+  8017ca:	48 c1 e0 02          	shl    $0x2,%rax
+  8017ce:	48 89 c2             	mov    %rax,%rdx
+  8017d1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017d8:	48 01 d0             	add    %rdx,%rax
+  8017db:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017e2:	e9 d8 00 00 00       	jmp    8018bf <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017e7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017ee:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017f2:	48 85 c0             	test   %rax,%rax
+  8017f5:	74 7d                	je     801874 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8017f7:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017fe:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801802:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801805:	48 63 d0             	movslq %eax,%rdx
+  801808:	48 89 d0             	mov    %rdx,%rax
+  80180b:	48 01 c0             	add    %rax,%rax
+  80180e:	48 01 d0             	add    %rdx,%rax
+  801811:	48 c1 e0 02          	shl    $0x2,%rax
+  801815:	48 89 c2             	mov    %rax,%rdx
+  801818:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80181f:	48 01 d0             	add    %rdx,%rax
+  801822:	8b 48 04             	mov    0x4(%rax),%ecx
+  801825:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80182c:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801833:	89 ce                	mov    %ecx,%esi
+  801835:	48 89 c7             	mov    %rax,%rdi
+  801838:	41 ff d0             	call   *%r8
+  80183b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80183e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801842:	79 08                	jns    80184c <poll+0x242>
+          return r;
+  801844:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801847:	e9 45 01 00 00       	jmp    801991 <poll+0x387>
+        fds[i].revents = r;
+  80184c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80184f:	48 63 d0             	movslq %eax,%rdx
+  801852:	48 89 d0             	mov    %rdx,%rax
+  801855:	48 01 c0             	add    %rax,%rax
+  801858:	48 01 d0             	add    %rdx,%rax
+  80185b:	48 c1 e0 02          	shl    $0x2,%rax
+  80185f:	48 89 c2             	mov    %rax,%rdx
+  801862:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801869:	48 01 c2             	add    %rax,%rdx
+  80186c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80186f:	89 42 08             	mov    %eax,0x8(%rdx)
+  801872:	eb 4b                	jmp    8018bf <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  801874:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801877:	48 63 d0             	movslq %eax,%rdx
+  80187a:	48 89 d0             	mov    %rdx,%rax
+  80187d:	48 01 c0             	add    %rax,%rax
+  801880:	48 01 d0             	add    %rdx,%rax
+  801883:	48 c1 e0 02          	shl    $0x2,%rax
+  801887:	48 89 c2             	mov    %rax,%rdx
+  80188a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801891:	48 01 d0             	add    %rdx,%rax
+  801894:	8b 48 04             	mov    0x4(%rax),%ecx
+  801897:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80189a:	48 63 d0             	movslq %eax,%rdx
+  80189d:	48 89 d0             	mov    %rdx,%rax
+  8018a0:	48 01 c0             	add    %rax,%rax
+  8018a3:	48 01 d0             	add    %rdx,%rax
+  8018a6:	48 c1 e0 02          	shl    $0x2,%rax
+  8018aa:	48 89 c2             	mov    %rax,%rdx
+  8018ad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018b4:	48 01 d0             	add    %rdx,%rax
+  8018b7:	83 e1 03             	and    $0x3,%ecx
+  8018ba:	89 ca                	mov    %ecx,%edx
+  8018bc:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018c2:	48 63 d0             	movslq %eax,%rdx
+  8018c5:	48 89 d0             	mov    %rdx,%rax
+  8018c8:	48 01 c0             	add    %rax,%rax
+  8018cb:	48 01 d0             	add    %rdx,%rax
+  8018ce:	48 c1 e0 02          	shl    $0x2,%rax
+  8018d2:	48 89 c2             	mov    %rax,%rdx
+  8018d5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018dc:	48 01 d0             	add    %rdx,%rax
+  8018df:	8b 40 08             	mov    0x8(%rax),%eax
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	74 04                	je     8018ea <poll+0x2e0>
+        ready++;
+  8018e6:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018ea:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f1:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8018f7:	0f 8c ab fd ff ff    	jl     8016a8 <poll+0x9e>
+    }
+    if (ready)
+  8018fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801901:	74 08                	je     80190b <poll+0x301>
+      return ready;
+  801903:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801906:	e9 86 00 00 00       	jmp    801991 <poll+0x387>
+
+    if (deadline) {
+  80190b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801910:	74 30                	je     801942 <poll+0x338>
+      now     = vsys_clock_ns();
+  801912:	48 b8 45 2b 80 00 00 	movabs $0x802b45,%rax
+  801919:	00 00 00 
+  80191c:	ff d0                	call   *%rax
+  80191e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801922:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801926:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80192a:	73 0a                	jae    801936 <poll+0x32c>
+  80192c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801930:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801934:	eb 05                	jmp    80193b <poll+0x331>
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193b:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801942:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801945:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  801948:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80194f:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  801956:	48 89 c7             	mov    %rax,%rdi
+  801959:	48 b8 ee 07 80 00 00 	movabs $0x8007ee,%rax
+  801960:	00 00 00 
+  801963:	ff d0                	call   *%rax
+  801965:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  801968:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80196c:	75 07                	jne    801975 <poll+0x36b>
+      return 0;
+  80196e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801973:	eb 1c                	jmp    801991 <poll+0x387>
+    if (r < 0)
+  801975:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801979:	79 05                	jns    801980 <poll+0x376>
+      return r;
+  80197b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80197e:	eb 11                	jmp    801991 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801980:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801983:	c1 f8 02             	sar    $0x2,%eax
+  801986:	83 e0 01             	and    $0x1,%eax
+  801989:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80198c:	e9 f6 fc ff ff       	jmp    801687 <poll+0x7d>
+  }
+}
+  801991:	c9                   	leave
+  801992:	c3                   	ret
+
+0000000000801993 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801993:	55                   	push   %rbp
+  801994:	48 89 e5             	mov    %rsp,%rbp
+  801997:	48 83 ec 20          	sub    $0x20,%rsp
+  80199b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80199f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ac:	48 89 c7             	mov    %rax,%rdi
+  8019af:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+  8019bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019c2:	79 05                	jns    8019c9 <stat+0x36>
+    return fd;
+  8019c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019c7:	eb 2f                	jmp    8019f8 <stat+0x65>
+  r = fstat(fd, stat);
+  8019c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019d0:	48 89 d6             	mov    %rdx,%rsi
+  8019d3:	89 c7                	mov    %eax,%edi
+  8019d5:	48 b8 ca 14 80 00 00 	movabs $0x8014ca,%rax
+  8019dc:	00 00 00 
+  8019df:	ff d0                	call   *%rax
+  8019e1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019e7:	89 c7                	mov    %eax,%edi
+  8019e9:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  8019f0:	00 00 00 
+  8019f3:	ff d0                	call   *%rax
+  return r;
+  8019f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+00000000008019fa <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	48 83 ec 10          	sub    $0x10,%rsp
+  801a02:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a05:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a09:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a10:	00 00 00 
+  801a13:	8b 00                	mov    (%rax),%eax
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	75 1d                	jne    801a36 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a19:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a1e:	48 b8 4d 4e 80 00 00 	movabs $0x804e4d,%rax
+  801a25:	00 00 00 
+  801a28:	ff d0                	call   *%rax
+  801a2a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a31:	00 00 00 
+  801a34:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a36:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a3d:	00 00 00 
+  801a40:	8b 00                	mov    (%rax),%eax
+  801a42:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a45:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a4a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a51:	00 00 00 
+  801a54:	89 c7                	mov    %eax,%edi
+  801a56:	48 b8 a0 4d 80 00 00 	movabs $0x804da0,%rax
+  801a5d:	00 00 00 
+  801a60:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6b:	48 89 c6             	mov    %rax,%rsi
+  801a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a73:	48 b8 23 4c 80 00 00 	movabs $0x804c23,%rax
+  801a7a:	00 00 00 
+  801a7d:	ff d0                	call   *%rax
+}
+  801a7f:	c9                   	leave
+  801a80:	c3                   	ret
+
+0000000000801a81 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	48 83 ec 20          	sub    $0x20,%rsp
+  801a89:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a8d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a94:	48 89 c7             	mov    %rax,%rdi
+  801a97:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  801a9e:	00 00 00 
+  801aa1:	ff d0                	call   *%rax
+  801aa3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aa8:	7e 0a                	jle    801ab4 <open+0x33>
+    return -E_BAD_PATH;
+  801aaa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aaf:	e9 a8 00 00 00       	jmp    801b5c <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801ab4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801ab8:	48 89 c7             	mov    %rax,%rdi
+  801abb:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  801ac2:	00 00 00 
+  801ac5:	ff d0                	call   *%rax
+  801ac7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801aca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ace:	79 08                	jns    801ad8 <open+0x57>
+    return r;
+  801ad0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ad3:	e9 84 00 00 00       	jmp    801b5c <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801ad8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801adc:	48 89 c6             	mov    %rax,%rsi
+  801adf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ae6:	00 00 00 
+  801ae9:	48 89 c7             	mov    %rax,%rdi
+  801aec:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  801af3:	00 00 00 
+  801af6:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801af8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801aff:	00 00 00 
+  801b02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b05:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b0f:	48 89 c6             	mov    %rax,%rsi
+  801b12:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b17:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b2a:	79 1d                	jns    801b49 <open+0xc8>
+    fd_close(fd, 0);
+  801b2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b30:	be 00 00 00 00       	mov    $0x0,%esi
+  801b35:	48 89 c7             	mov    %rax,%rdi
+  801b38:	48 b8 93 0c 80 00 00 	movabs $0x800c93,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+    return r;
+  801b44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b47:	eb 13                	jmp    801b5c <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4d:	48 89 c7             	mov    %rax,%rdi
+  801b50:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+}
+  801b5c:	c9                   	leave
+  801b5d:	c3                   	ret
+
+0000000000801b5e <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b5e:	55                   	push   %rbp
+  801b5f:	48 89 e5             	mov    %rsp,%rbp
+  801b62:	48 83 ec 10          	sub    $0x10,%rsp
+  801b66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b6e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b71:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b78:	00 00 00 
+  801b7b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801b82:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b87:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801b8e:	00 00 00 
+  801b91:	ff d0                	call   *%rax
+}
+  801b93:	c9                   	leave
+  801b94:	c3                   	ret
+
+0000000000801b95 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b95:	55                   	push   %rbp
+  801b96:	48 89 e5             	mov    %rsp,%rbp
+  801b99:	48 83 ec 30          	sub    $0x30,%rsp
+  801b9d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ba1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801ba5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801ba9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bae:	74 07                	je     801bb7 <devfile_read+0x22>
+  801bb0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bb5:	75 0a                	jne    801bc1 <devfile_read+0x2c>
+  return E_INVAL;
+  801bb7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bbc:	e9 b4 00 00 00       	jmp    801c75 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bc1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bc8:	00 
+  while (n) {
+  801bc9:	e9 98 00 00 00       	jmp    801c66 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bd2:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bd5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bdc:	00 00 00 
+  801bdf:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801be1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801be8:	00 00 00 
+  801beb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bef:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801bf3:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf8:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bfd:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801c04:	00 00 00 
+  801c07:	ff d0                	call   *%rax
+  801c09:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c0c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c10:	7f 13                	jg     801c25 <devfile_read+0x90>
+      return res ? res : res0;
+  801c12:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c16:	74 07                	je     801c1f <devfile_read+0x8a>
+  801c18:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c1b:	48 98                	cltq
+  801c1d:	eb 56                	jmp    801c75 <devfile_read+0xe0>
+  801c1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c23:	eb 50                	jmp    801c75 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c25:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c28:	48 63 d0             	movslq %eax,%rdx
+  801c2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c2f:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c36:	00 00 00 
+  801c39:	48 89 ce             	mov    %rcx,%rsi
+  801c3c:	48 89 c7             	mov    %rax,%rdi
+  801c3f:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+
+    buf += res;
+  801c4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c4e:	48 98                	cltq
+  801c50:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c54:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c57:	48 98                	cltq
+  801c59:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c5d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c60:	48 98                	cltq
+  801c62:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c66:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c6b:	0f 85 5d ff ff ff    	jne    801bce <devfile_read+0x39>
+  }
+
+  return res0;
+  801c71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c75:	c9                   	leave
+  801c76:	c3                   	ret
+
+0000000000801c77 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c77:	55                   	push   %rbp
+  801c78:	48 89 e5             	mov    %rsp,%rbp
+  801c7b:	48 83 ec 50          	sub    $0x50,%rsp
+  801c7f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c83:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c87:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c8b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c90:	74 07                	je     801c99 <devfile_write+0x22>
+  801c92:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c97:	75 0a                	jne    801ca3 <devfile_write+0x2c>
+  return E_INVAL;
+  801c99:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c9e:	e9 c9 00 00 00       	jmp    801d6c <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801ca3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801caa:	00 
+
+  while (n) {
+  801cab:	e9 ad 00 00 00       	jmp    801d5d <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cb0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cb8:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cbf:	00 
+  801cc0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cc8:	48 39 c2             	cmp    %rax,%rdx
+  801ccb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ccf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cd3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cd7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cdb:	48 89 c6             	mov    %rax,%rsi
+  801cde:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801ce5:	00 00 00 
+  801ce8:	48 89 c7             	mov    %rax,%rdi
+  801ceb:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cf7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cfb:	8b 40 0c             	mov    0xc(%rax),%eax
+  801cfe:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d05:	00 00 00 
+  801d08:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d0a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d11:	00 00 00 
+  801d14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d18:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d21:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d26:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801d2d:	00 00 00 
+  801d30:	ff d0                	call   *%rax
+  801d32:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d35:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d39:	79 07                	jns    801d42 <devfile_write+0xcb>
+      return res;
+  801d3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d3e:	48 98                	cltq
+  801d40:	eb 2a                	jmp    801d6c <devfile_write+0xf5>
+
+    buf += res;
+  801d42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d45:	48 98                	cltq
+  801d47:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d4e:	48 98                	cltq
+  801d50:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d54:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d57:	48 98                	cltq
+  801d59:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d5d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d62:	0f 85 48 ff ff ff    	jne    801cb0 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d6c:	c9                   	leave
+  801d6d:	c3                   	ret
+
+0000000000801d6e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d6e:	55                   	push   %rbp
+  801d6f:	48 89 e5             	mov    %rsp,%rbp
+  801d72:	48 83 ec 20          	sub    $0x20,%rsp
+  801d76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d7a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d82:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d85:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d8c:	00 00 00 
+  801d8f:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d91:	be 00 00 00 00       	mov    $0x0,%esi
+  801d96:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d9b:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+  801da7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801daa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dae:	79 05                	jns    801db5 <devfile_stat+0x47>
+    return r;
+  801db0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801db3:	eb 59                	jmp    801e0e <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801db5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801db9:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dc0:	00 00 00 
+  801dc3:	48 89 d6             	mov    %rdx,%rsi
+  801dc6:	48 89 c7             	mov    %rax,%rdi
+  801dc9:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dd5:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ddc:	00 00 00 
+  801ddf:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801de5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801de9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801def:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801df6:	00 00 00 
+  801df9:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801dff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e03:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+0000000000801e10 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e10:	55                   	push   %rbp
+  801e11:	48 89 e5             	mov    %rsp,%rbp
+  801e14:	48 83 ec 10          	sub    $0x10,%rsp
+  801e18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e1c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e23:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e26:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e2d:	00 00 00 
+  801e30:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e32:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e39:	00 00 00 
+  801e3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e3f:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e42:	be 00 00 00 00       	mov    $0x0,%esi
+  801e47:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e4c:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801e53:	00 00 00 
+  801e56:	ff d0                	call   *%rax
+}
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+0000000000801e5a <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e66:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e69:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e6d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e70:	83 e0 03             	and    $0x3,%eax
+}
+  801e73:	c9                   	leave
+  801e74:	c3                   	ret
+
+0000000000801e75 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e75:	55                   	push   %rbp
+  801e76:	48 89 e5             	mov    %rsp,%rbp
+  801e79:	48 83 ec 10          	sub    $0x10,%rsp
+  801e7d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e85:	48 89 c7             	mov    %rax,%rdi
+  801e88:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+  801e94:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e99:	7e 07                	jle    801ea2 <remove+0x2d>
+    return -E_BAD_PATH;
+  801e9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea0:	eb 36                	jmp    801ed8 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801ea2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ea6:	48 89 c6             	mov    %rax,%rsi
+  801ea9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801eb0:	00 00 00 
+  801eb3:	48 89 c7             	mov    %rax,%rdi
+  801eb6:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  801ebd:	00 00 00 
+  801ec0:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ec2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec7:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ecc:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+}
+  801ed8:	c9                   	leave
+  801ed9:	c3                   	ret
+
+0000000000801eda <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801eda:	55                   	push   %rbp
+  801edb:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ede:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee3:	bf 08 00 00 00       	mov    $0x8,%edi
+  801ee8:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801eef:	00 00 00 
+  801ef2:	ff d0                	call   *%rax
+}
+  801ef4:	5d                   	pop    %rbp
+  801ef5:	c3                   	ret
+
+0000000000801ef6 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801ef6:	55                   	push   %rbp
+  801ef7:	48 89 e5             	mov    %rsp,%rbp
+  801efa:	48 83 ec 20          	sub    $0x20,%rsp
+  801efe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f02:	be 00 00 00 00       	mov    $0x0,%esi
+  801f07:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f0c:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f1b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f1f:	79 05                	jns    801f26 <fs_stats+0x30>
+    return r;
+  801f21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f24:	eb 2a                	jmp    801f50 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f2a:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f2f:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f36:	00 00 00 
+  801f39:	48 89 ce             	mov    %rcx,%rsi
+  801f3c:	48 89 c7             	mov    %rax,%rdi
+  801f3f:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  801f46:	00 00 00 
+  801f49:	ff d0                	call   *%rax
+  return 0;
+  801f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f50:	c9                   	leave
+  801f51:	c3                   	ret
+
+0000000000801f52 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f52:	55                   	push   %rbp
+  801f53:	48 89 e5             	mov    %rsp,%rbp
+  801f56:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f5d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f64:	00 00 00 
+  801f67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f6a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f6c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f71:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f76:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+0000000000801f84 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f84:	55                   	push   %rbp
+  801f85:	48 89 e5             	mov    %rsp,%rbp
+  801f88:	48 83 ec 10          	sub    $0x10,%rsp
+  801f8c:	89 f8                	mov    %edi,%eax
+  801f8e:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f91:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801f95:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f9c:	00 00 00 
+  801f9f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fab:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+}
+  801fb7:	c9                   	leave
+  801fb8:	c3                   	ret
+
+0000000000801fb9 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fb9:	55                   	push   %rbp
+  801fba:	48 89 e5             	mov    %rsp,%rbp
+  801fbd:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc9:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fce:	48 89 c7             	mov    %rax,%rdi
+  801fd1:	48 b8 df 1f 80 00 00 	movabs $0x801fdf,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+}
+  801fdd:	c9                   	leave
+  801fde:	c3                   	ret
+
+0000000000801fdf <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fdf:	55                   	push   %rbp
+  801fe0:	48 89 e5             	mov    %rsp,%rbp
+  801fe3:	48 83 ec 50          	sub    $0x50,%rsp
+  801fe7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801feb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801fef:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ff6:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  801ff7:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  801ffc:	74 0a                	je     802008 <pipe_size+0x29>
+  801ffe:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802005:	00 
+  802006:	76 0a                	jbe    802012 <pipe_size+0x33>
+    return -E_INVAL;
+  802008:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200d:	e9 cc 02 00 00       	jmp    8022de <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802012:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802016:	48 89 c7             	mov    %rax,%rdi
+  802019:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802028:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80202c:	0f 88 a8 02 00 00    	js     8022da <pipe_size+0x2fb>
+  802032:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802036:	ba 07 04 00 00       	mov    $0x407,%edx
+  80203b:	48 89 c6             	mov    %rax,%rsi
+  80203e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802043:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802052:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802056:	0f 88 7e 02 00 00    	js     8022da <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80205c:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802060:	48 89 c7             	mov    %rax,%rdi
+  802063:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+  80206f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802072:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802076:	0f 88 43 02 00 00    	js     8022bf <pipe_size+0x2e0>
+  80207c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802080:	ba 07 04 00 00       	mov    $0x407,%edx
+  802085:	48 89 c6             	mov    %rax,%rsi
+  802088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80208d:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+  802099:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80209c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020a0:	0f 88 19 02 00 00    	js     8022bf <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020aa:	48 89 c7             	mov    %rax,%rdi
+  8020ad:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020bd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020c4:	00 
+  8020c5:	e9 a2 00 00 00       	jmp    80216c <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020ce:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020d2:	48 89 c2             	mov    %rax,%rdx
+  8020d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d9:	48 01 d0             	add    %rdx,%rax
+  8020dc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020e1:	48 89 c6             	mov    %rax,%rsi
+  8020e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e9:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+  8020f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020fc:	0f 88 37 01 00 00    	js     802239 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802102:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802106:	48 89 c7             	mov    %rax,%rdi
+  802109:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+  802115:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802119:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80211d:	48 01 c2             	add    %rax,%rdx
+  802120:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802124:	48 c1 e0 0c          	shl    $0xc,%rax
+  802128:	48 89 c1             	mov    %rax,%rcx
+  80212b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80212f:	48 01 c8             	add    %rcx,%rax
+  802132:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  802138:	48 89 d1             	mov    %rdx,%rcx
+  80213b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802140:	48 89 c6             	mov    %rax,%rsi
+  802143:	bf 00 00 00 00       	mov    $0x0,%edi
+  802148:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+  802154:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802157:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80215b:	79 0a                	jns    802167 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80215d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802162:	e9 d3 00 00 00       	jmp    80223a <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  802167:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80216c:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  802173:	00 
+  802174:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802178:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80217c:	48 01 d0             	add    %rdx,%rax
+  80217f:	48 83 c0 1f          	add    $0x1f,%rax
+  802183:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802187:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802190:	48 f7 75 e0          	divq   -0x20(%rbp)
+  802194:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802198:	48 29 d0             	sub    %rdx,%rax
+  80219b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80219f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021a3:	0f 82 21 ff ff ff    	jb     8020ca <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021ad:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b5:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021b9:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c1:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021c8:	00 00 00 
+  8021cb:	8b 12                	mov    (%rdx),%edx
+  8021cd:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021de:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021e5:	00 00 00 
+  8021e8:	8b 12                	mov    (%rdx),%edx
+  8021ea:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8021f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021fb:	48 89 c7             	mov    %rax,%rdi
+  8021fe:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  802205:	00 00 00 
+  802208:	ff d0                	call   *%rax
+  80220a:	89 c2                	mov    %eax,%edx
+  80220c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802210:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802212:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802216:	48 89 c7             	mov    %rax,%rdi
+  802219:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  802220:	00 00 00 
+  802223:	ff d0                	call   *%rax
+  802225:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802229:	48 83 c2 04          	add    $0x4,%rdx
+  80222d:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802234:	e9 a5 00 00 00       	jmp    8022de <pipe_size+0x2ff>
+      goto err2;
+  802239:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80223a:	eb 58                	jmp    802294 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80223c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802240:	48 c1 e0 0c          	shl    $0xc,%rax
+  802244:	48 89 c2             	mov    %rax,%rdx
+  802247:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80224b:	48 01 d0             	add    %rdx,%rax
+  80224e:	48 89 c6             	mov    %rax,%rsi
+  802251:	bf 00 00 00 00       	mov    $0x0,%edi
+  802256:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802262:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802266:	48 89 c7             	mov    %rax,%rdi
+  802269:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802279:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80227d:	48 01 d0             	add    %rdx,%rax
+  802280:	48 89 c6             	mov    %rax,%rsi
+  802283:	bf 00 00 00 00       	mov    $0x0,%edi
+  802288:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  80228f:	00 00 00 
+  802292:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  802294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802298:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80229c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022a0:	48 85 c0             	test   %rax,%rax
+  8022a3:	75 97                	jne    80223c <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022a5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a9:	48 89 c6             	mov    %rax,%rsi
+  8022ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b1:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	eb 01                	jmp    8022c0 <pipe_size+0x2e1>
+    goto err1;
+  8022bf:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022c4:	48 89 c6             	mov    %rax,%rsi
+  8022c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022cc:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  8022d3:	00 00 00 
+  8022d6:	ff d0                	call   *%rax
+  8022d8:	eb 01                	jmp    8022db <pipe_size+0x2fc>
+    goto err;
+  8022da:	90                   	nop
+err:
+  return r;
+  8022db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+00000000008022e0 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022e0:	55                   	push   %rbp
+  8022e1:	48 89 e5             	mov    %rsp,%rbp
+  8022e4:	53                   	push   %rbx
+  8022e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8022e9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022ed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022f1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022f8:	00 00 00 
+  8022fb:	8b 40 04             	mov    0x4(%rax),%eax
+  8022fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802303:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80230a:	00 00 00 
+  80230d:	48 98                	cltq
+  80230f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802316:	48 01 d0             	add    %rdx,%rax
+  802319:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80231f:	8b 00                	mov    (%rax),%eax
+  802321:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  802324:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802328:	48 89 c7             	mov    %rax,%rdi
+  80232b:	48 b8 be 4e 80 00 00 	movabs $0x804ebe,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+  802337:	89 c3                	mov    %eax,%ebx
+  802339:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80233d:	48 89 c7             	mov    %rax,%rdi
+  802340:	48 b8 be 4e 80 00 00 	movabs $0x804ebe,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+  80234c:	39 c3                	cmp    %eax,%ebx
+  80234e:	0f 94 c0             	sete   %al
+  802351:	0f b6 c0             	movzbl %al,%eax
+  802354:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  802357:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80235e:	00 00 00 
+  802361:	8b 40 04             	mov    0x4(%rax),%eax
+  802364:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802369:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802370:	00 00 00 
+  802373:	48 98                	cltq
+  802375:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80237c:	48 01 d0             	add    %rdx,%rax
+  80237f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802385:	8b 00                	mov    (%rax),%eax
+  802387:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80238a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80238d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802390:	75 05                	jne    802397 <_pipeisclosed+0xb7>
+      return ret;
+  802392:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802395:	eb 68                	jmp    8023ff <_pipeisclosed+0x11f>
+    if (n != nn)
+  802397:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80239a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80239d:	0f 84 4e ff ff ff    	je     8022f1 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023a3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023aa:	00 00 00 
+  8023ad:	8b 40 04             	mov    0x4(%rax),%eax
+  8023b0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023b5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023bc:	00 00 00 
+  8023bf:	48 98                	cltq
+  8023c1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023c8:	48 01 d0             	add    %rdx,%rax
+  8023cb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023d1:	8b 10                	mov    (%rax),%edx
+  8023d3:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023d9:	89 c6                	mov    %eax,%esi
+  8023db:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023e2:	00 00 00 
+  8023e5:	48 89 c7             	mov    %rax,%rdi
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ed:	49 b8 55 31 80 00 00 	movabs $0x803155,%r8
+  8023f4:	00 00 00 
+  8023f7:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8023fa:	e9 f2 fe ff ff       	jmp    8022f1 <_pipeisclosed+0x11>
+  }
+}
+  8023ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802403:	c9                   	leave
+  802404:	c3                   	ret
+
+0000000000802405 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802405:	55                   	push   %rbp
+  802406:	48 89 e5             	mov    %rsp,%rbp
+  802409:	48 83 ec 30          	sub    $0x30,%rsp
+  80240d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802410:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802414:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802417:	48 89 d6             	mov    %rdx,%rsi
+  80241a:	89 c7                	mov    %eax,%edi
+  80241c:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80242b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80242f:	79 05                	jns    802436 <pipeisclosed+0x31>
+    return r;
+  802431:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802434:	eb 31                	jmp    802467 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  802436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80243a:	48 89 c7             	mov    %rax,%rdi
+  80243d:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+  802449:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80244d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802451:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802455:	48 89 d6             	mov    %rdx,%rsi
+  802458:	48 89 c7             	mov    %rax,%rdi
+  80245b:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  802462:	00 00 00 
+  802465:	ff d0                	call   *%rax
+}
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+0000000000802469 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  802469:	55                   	push   %rbp
+  80246a:	48 89 e5             	mov    %rsp,%rbp
+  80246d:	48 83 ec 10          	sub    $0x10,%rsp
+  802471:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  802475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802479:	8b 40 18             	mov    0x18(%rax),%eax
+  80247c:	8d 50 01             	lea    0x1(%rax),%edx
+  80247f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802483:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  802486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248a:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	74 27                	je     8024b8 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802495:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80249c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a0:	48 83 c0 18          	add    $0x18,%rax
+  8024a4:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024a9:	48 89 c7             	mov    %rax,%rdi
+  8024ac:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  }
+}
+  8024b8:	90                   	nop
+  8024b9:	c9                   	leave
+  8024ba:	c3                   	ret
+
+00000000008024bb <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024bb:	55                   	push   %rbp
+  8024bc:	48 89 e5             	mov    %rsp,%rbp
+  8024bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024c7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ce:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d9:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024e0:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024e7:	89 c6                	mov    %eax,%esi
+  8024e9:	48 89 cf             	mov    %rcx,%rdi
+  8024ec:	48 b8 52 07 80 00 00 	movabs $0x800752,%rax
+  8024f3:	00 00 00 
+  8024f6:	ff d0                	call   *%rax
+}
+  8024f8:	90                   	nop
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+
+00000000008024fb <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	48 83 ec 70          	sub    $0x70,%rsp
+  802503:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802507:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80250b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80250f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802513:	48 89 c7             	mov    %rax,%rdi
+  802516:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  80251d:	00 00 00 
+  802520:	ff d0                	call   *%rax
+  802522:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802526:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80252b:	75 0a                	jne    802537 <devpipe_read+0x3c>
+    return 0;
+  80252d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802532:	e9 63 01 00 00       	jmp    80269a <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  802537:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253b:	8b 40 18             	mov    0x18(%rax),%eax
+  80253e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802541:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802545:	48 8b 10             	mov    (%rax),%rdx
+  802548:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802550:	48 39 c2             	cmp    %rax,%rdx
+  802553:	75 42                	jne    802597 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  802555:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802559:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80255d:	48 89 d6             	mov    %rdx,%rsi
+  802560:	48 89 c7             	mov    %rax,%rdi
+  802563:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	74 0a                	je     80257d <devpipe_read+0x82>
+      return 0;
+  802573:	b8 00 00 00 00       	mov    $0x0,%eax
+  802578:	e9 1d 01 00 00       	jmp    80269a <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80257d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802584:	89 d6                	mov    %edx,%esi
+  802586:	48 89 c7             	mov    %rax,%rdi
+  802589:	48 b8 bb 24 80 00 00 	movabs $0x8024bb,%rax
+  802590:	00 00 00 
+  802593:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  802595:	eb a0                	jmp    802537 <devpipe_read+0x3c>
+      break;
+  802597:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  802598:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80259c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025a0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ac:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b4:	48 8b 00             	mov    (%rax),%rax
+  8025b7:	48 29 c2             	sub    %rax,%rdx
+  8025ba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c6:	48 39 c2             	cmp    %rax,%rdx
+  8025c9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025cd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025d5:	48 8b 00             	mov    (%rax),%rax
+  8025d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025dc:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e5:	48 f7 f1             	div    %rcx
+  8025e8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025ec:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025f0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025f8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025fc:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802600:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802604:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802608:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80260c:	48 39 c2             	cmp    %rax,%rdx
+  80260f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802613:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261b:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80261f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802623:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  802627:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80262b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80262f:	48 89 ce             	mov    %rcx,%rsi
+  802632:	48 89 c7             	mov    %rax,%rdi
+  802635:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802641:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802645:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802649:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80264d:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802651:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802655:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802659:	48 01 d1             	add    %rdx,%rcx
+  80265c:	48 89 c2             	mov    %rax,%rdx
+  80265f:	48 89 cf             	mov    %rcx,%rdi
+  802662:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80266e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802672:	48 8b 10             	mov    (%rax),%rdx
+  802675:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802679:	48 01 c2             	add    %rax,%rdx
+  80267c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802680:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802683:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802687:	48 89 c7             	mov    %rax,%rdi
+  80268a:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  return n;
+  802696:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80269a:	c9                   	leave
+  80269b:	c3                   	ret
+
+000000000080269c <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80269c:	55                   	push   %rbp
+  80269d:	48 89 e5             	mov    %rsp,%rbp
+  8026a0:	48 83 ec 70          	sub    $0x70,%rsp
+  8026a4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026a8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026ac:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026b4:	48 89 c7             	mov    %rax,%rdi
+  8026b7:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+  8026c3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026c7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026cf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026d6:	00 
+  8026d7:	e9 b8 01 00 00       	jmp    802894 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e0:	8b 40 18             	mov    0x18(%rax),%eax
+  8026e3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ea:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f2:	48 8b 00             	mov    (%rax),%rax
+  8026f5:	48 29 c2             	sub    %rax,%rdx
+  8026f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802700:	48 39 c2             	cmp    %rax,%rdx
+  802703:	75 4d                	jne    802752 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802705:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802709:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80270d:	48 89 d6             	mov    %rdx,%rsi
+  802710:	48 89 c7             	mov    %rax,%rdi
+  802713:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  80271a:	00 00 00 
+  80271d:	ff d0                	call   *%rax
+  80271f:	85 c0                	test   %eax,%eax
+  802721:	74 0a                	je     80272d <devpipe_write+0x91>
+        return 0;
+  802723:	b8 00 00 00 00       	mov    $0x0,%eax
+  802728:	e9 79 01 00 00       	jmp    8028a6 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80272d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802734:	89 d6                	mov    %edx,%esi
+  802736:	48 89 c7             	mov    %rax,%rdi
+  802739:	48 b8 bb 24 80 00 00 	movabs $0x8024bb,%rax
+  802740:	00 00 00 
+  802743:	ff d0                	call   *%rax
+      m = 0;
+  802745:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80274c:	00 
+      continue;
+  80274d:	e9 3a 01 00 00       	jmp    80288c <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802752:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802756:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80275a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80275e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802762:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802766:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276a:	48 8b 08             	mov    (%rax),%rcx
+  80276d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802771:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802775:	48 29 c1             	sub    %rax,%rcx
+  802778:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80277c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802780:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802784:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802788:	48 39 c2             	cmp    %rax,%rdx
+  80278b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80278f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  802793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802797:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80279b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80279f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a8:	48 f7 f1             	div    %rcx
+  8027ab:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027b3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027bb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027bf:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027c3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027c7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027cf:	48 39 c2             	cmp    %rax,%rdx
+  8027d2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027d6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027de:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027e6:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027ee:	48 01 d1             	add    %rdx,%rcx
+  8027f1:	48 89 c2             	mov    %rax,%rdx
+  8027f4:	48 89 cf             	mov    %rcx,%rdi
+  8027f7:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802803:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802807:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80280b:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80280f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802813:	73 4d                	jae    802862 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802819:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80281d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802821:	48 29 c2             	sub    %rax,%rdx
+  802824:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802828:	48 01 c2             	add    %rax,%rdx
+  80282b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802833:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802837:	48 89 c1             	mov    %rax,%rcx
+  80283a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283e:	48 01 c1             	add    %rax,%rcx
+  802841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802845:	48 01 c1             	add    %rax,%rcx
+  802848:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284c:	48 83 c0 20          	add    $0x20,%rax
+  802850:	48 89 ce             	mov    %rcx,%rsi
+  802853:	48 89 c7             	mov    %rax,%rdi
+  802856:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802866:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80286a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80286e:	48 01 c2             	add    %rax,%rdx
+  802871:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802875:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802879:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287d:	48 89 c7             	mov    %rax,%rdi
+  802880:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  802887:	00 00 00 
+  80288a:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80288c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802890:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  802894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802898:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80289c:	0f 82 3a fe ff ff    	jb     8026dc <devpipe_write+0x40>
+  }
+
+  return i;
+  8028a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028a6:	c9                   	leave
+  8028a7:	c3                   	ret
+
+00000000008028a8 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	48 83 ec 40          	sub    $0x40,%rsp
+  8028b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028b4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028bf:	48 89 c7             	mov    %rax,%rdi
+  8028c2:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8028c9:	00 00 00 
+  8028cc:	ff d0                	call   *%rax
+  8028ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028dd:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028e5:	48 89 d6             	mov    %rdx,%rsi
+  8028e8:	48 89 c7             	mov    %rax,%rdi
+  8028eb:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  8028f2:	00 00 00 
+  8028f5:	ff d0                	call   *%rax
+  8028f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028fe:	79 08                	jns    802908 <devpipe_poll+0x60>
+    return r;
+  802900:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802903:	e9 85 00 00 00       	jmp    80298d <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802908:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80290b:	83 e0 01             	and    $0x1,%eax
+  80290e:	85 c0                	test   %eax,%eax
+  802910:	74 18                	je     80292a <devpipe_poll+0x82>
+  802912:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802916:	48 8b 10             	mov    (%rax),%rdx
+  802919:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80291d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802921:	48 39 c2             	cmp    %rax,%rdx
+  802924:	74 04                	je     80292a <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802926:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80292a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80292d:	83 e0 02             	and    $0x2,%eax
+  802930:	85 c0                	test   %eax,%eax
+  802932:	74 23                	je     802957 <devpipe_poll+0xaf>
+  802934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802938:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80293c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802940:	48 8b 00             	mov    (%rax),%rax
+  802943:	48 29 c2             	sub    %rax,%rdx
+  802946:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80294e:	48 39 c2             	cmp    %rax,%rdx
+  802951:	73 04                	jae    802957 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802953:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  802957:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80295b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80295f:	48 89 d6             	mov    %rdx,%rsi
+  802962:	48 89 c7             	mov    %rax,%rdi
+  802965:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+  802971:	85 c0                	test   %eax,%eax
+  802973:	74 04                	je     802979 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  802975:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802979:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80297d:	75 0b                	jne    80298a <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80297f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802983:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80298a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+
+000000000080298f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	48 83 ec 20          	sub    $0x20,%rsp
+  802997:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80299b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80299f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029a3:	48 89 c7             	mov    %rax,%rdi
+  8029a6:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+  8029b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ba:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029c1:	00 00 00 
+  8029c4:	48 89 d6             	mov    %rdx,%rsi
+  8029c7:	48 89 c7             	mov    %rax,%rdi
+  8029ca:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029da:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029de:	89 c1                	mov    %eax,%ecx
+  8029e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029e4:	48 8b 00             	mov    (%rax),%rax
+  8029e7:	89 c2                	mov    %eax,%edx
+  8029e9:	89 c8                	mov    %ecx,%eax
+  8029eb:	29 d0                	sub    %edx,%eax
+  8029ed:	89 c2                	mov    %eax,%edx
+  8029ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8029f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029fd:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a04:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a0b:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a12:	00 00 00 
+  802a15:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a21:	c9                   	leave
+  802a22:	c3                   	ret
+
+0000000000802a23 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a23:	55                   	push   %rbp
+  802a24:	48 89 e5             	mov    %rsp,%rbp
+  802a27:	48 83 ec 40          	sub    $0x40,%rsp
+  802a2b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a33:	48 89 c7             	mov    %rax,%rdi
+  802a36:	48 b8 b0 0a 80 00 00 	movabs $0x800ab0,%rax
+  802a3d:	00 00 00 
+  802a40:	ff d0                	call   *%rax
+  802a42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a46:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a4d:	00 
+  802a4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a52:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a5a:	48 01 d0             	add    %rdx,%rax
+  802a5d:	48 83 c0 1f          	add    $0x1f,%rax
+  802a61:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a69:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a6e:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a76:	48 29 d0             	sub    %rdx,%rax
+  802a79:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a7d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a85:	48 89 c6             	mov    %rax,%rsi
+  802a88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a8d:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  802a94:	00 00 00 
+  802a97:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802a99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a9d:	48 89 c7             	mov    %rax,%rdi
+  802aa0:	48 b8 69 24 80 00 00 	movabs $0x802469,%rax
+  802aa7:	00 00 00 
+  802aaa:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802aac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802ab4:	eb 2f                	jmp    802ae5 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802ab6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aba:	48 83 e8 01          	sub    $0x1,%rax
+  802abe:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ac2:	48 89 c2             	mov    %rax,%rdx
+  802ac5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac9:	48 01 d0             	add    %rdx,%rax
+  802acc:	48 89 c6             	mov    %rax,%rsi
+  802acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad4:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ae0:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802ae5:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802aea:	77 ca                	ja     802ab6 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802aec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802af0:	48 89 c6             	mov    %rax,%rsi
+  802af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af8:	48 b8 5e 04 80 00 00 	movabs $0x80045e,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+}
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+0000000000802b06 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b15:	75 10                	jne    802b27 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b17:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b1e:	00 00 00 
+  802b21:	8b 00                	mov    (%rax),%eax
+  802b23:	48 98                	cltq
+  802b25:	eb 05                	jmp    802b2c <vsyscall+0x26>
+  }
+  return 0;
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+
+0000000000802b2e <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b2e:	55                   	push   %rbp
+  802b2f:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b37:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+}
+  802b43:	5d                   	pop    %rbp
+  802b44:	c3                   	ret
+
+0000000000802b45 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  802b49:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b4d:	0f 31                	rdtsc
+  802b4f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b52:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b58:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b5b:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b5f:	48 09 d0             	or     %rdx,%rax
+  802b62:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b6e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b75:	00 00 00 
+  802b78:	8b 40 08             	mov    0x8(%rax),%eax
+  802b7b:	48 98                	cltq
+  802b7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b85:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b8e:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802b95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b9e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802ba2:	48 89 d0             	mov    %rdx,%rax
+  802ba5:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bac:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bb5:	48 01 c8             	add    %rcx,%rax
+}
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+0000000000802bba <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+  802bbe:	48 83 ec 20          	sub    $0x20,%rsp
+  802bc2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bc8:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bcb:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bcf:	be 01 00 00 00       	mov    $0x1,%esi
+  802bd4:	48 89 c7             	mov    %rax,%rdi
+  802bd7:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  802bde:	00 00 00 
+  802be1:	ff d0                	call   *%rax
+}
+  802be3:	90                   	nop
+  802be4:	c9                   	leave
+  802be5:	c3                   	ret
+
+0000000000802be6 <getchar>:
+
+int
+getchar(void) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802bee:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802bf2:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bf7:	48 89 c6             	mov    %rax,%rsi
+  802bfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bff:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  802c06:	00 00 00 
+  802c09:	ff d0                	call   *%rax
+  802c0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c0e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c12:	79 05                	jns    802c19 <getchar+0x33>
+    return r;
+  802c14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c17:	eb 14                	jmp    802c2d <getchar+0x47>
+  if (r < 1)
+  802c19:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c1d:	7f 07                	jg     802c26 <getchar+0x40>
+    return -E_EOF;
+  802c1f:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c24:	eb 07                	jmp    802c2d <getchar+0x47>
+  return c;
+  802c26:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c2a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+
+0000000000802c2f <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c2f:	55                   	push   %rbp
+  802c30:	48 89 e5             	mov    %rsp,%rbp
+  802c33:	48 83 ec 20          	sub    $0x20,%rsp
+  802c37:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c3a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c41:	48 89 d6             	mov    %rdx,%rsi
+  802c44:	89 c7                	mov    %eax,%edi
+  802c46:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  802c52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c59:	79 05                	jns    802c60 <iscons+0x31>
+    return r;
+  802c5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c5e:	eb 1a                	jmp    802c7a <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c64:	8b 10                	mov    (%rax),%edx
+  802c66:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c6d:	00 00 00 
+  802c70:	8b 00                	mov    (%rax),%eax
+  802c72:	39 c2                	cmp    %eax,%edx
+  802c74:	0f 94 c0             	sete   %al
+  802c77:	0f b6 c0             	movzbl %al,%eax
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+0000000000802c7c <opencons>:
+
+int
+opencons(void) {
+  802c7c:	55                   	push   %rbp
+  802c7d:	48 89 e5             	mov    %rsp,%rbp
+  802c80:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c84:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c88:	48 89 c7             	mov    %rax,%rdi
+  802c8b:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  802c92:	00 00 00 
+  802c95:	ff d0                	call   *%rax
+  802c97:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c9a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c9e:	79 05                	jns    802ca5 <opencons+0x29>
+    return r;
+  802ca0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ca3:	eb 66                	jmp    802d0b <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802ca5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca9:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cae:	48 89 c6             	mov    %rax,%rsi
+  802cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb6:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+  802cc2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cc9:	79 05                	jns    802cd0 <opencons+0x54>
+    return r;
+  802ccb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cce:	eb 3b                	jmp    802d0b <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802cd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cd4:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cdb:	00 00 00 
+  802cde:	8b 12                	mov    (%rdx),%edx
+  802ce0:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802ced:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802cf8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfc:	48 89 c7             	mov    %rax,%rdi
+  802cff:	48 b8 8d 0a 80 00 00 	movabs $0x800a8d,%rax
+  802d06:	00 00 00 
+  802d09:	ff d0                	call   *%rax
+}
+  802d0b:	c9                   	leave
+  802d0c:	c3                   	ret
+
+0000000000802d0d <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	48 83 ec 20          	sub    $0x20,%rsp
+  802d15:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d18:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d1b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d22:	48 89 d6             	mov    %rdx,%rsi
+  802d25:	89 c7                	mov    %eax,%edi
+  802d27:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  802d2e:	00 00 00 
+  802d31:	ff d0                	call   *%rax
+  802d33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d36:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d3a:	79 05                	jns    802d41 <consmode+0x34>
+    return r;
+  802d3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d3f:	eb 34                	jmp    802d75 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d45:	8b 10                	mov    (%rax),%edx
+  802d47:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d4e:	00 00 00 
+  802d51:	8b 00                	mov    (%rax),%eax
+  802d53:	39 c2                	cmp    %eax,%edx
+  802d55:	74 07                	je     802d5e <consmode+0x51>
+    return -E_INVAL;
+  802d57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5c:	eb 17                	jmp    802d75 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d62:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d6f:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d75:	c9                   	leave
+  802d76:	c3                   	ret
+
+0000000000802d77 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d77:	55                   	push   %rbp
+  802d78:	48 89 e5             	mov    %rsp,%rbp
+  802d7b:	48 83 ec 20          	sub    $0x20,%rsp
+  802d7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d87:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d8f:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d92:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d9a:	48 89 ce             	mov    %rcx,%rsi
+  802d9d:	48 89 c7             	mov    %rax,%rdi
+  802da0:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  802da7:	00 00 00 
+  802daa:	ff d0                	call   *%rax
+  802dac:	48 98                	cltq
+}
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+0000000000802db0 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+  802db4:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dbb:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dc2:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dc9:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802dd0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dd7:	eb 74                	jmp    802e4d <devcons_write+0x9d>
+    m = n - tot;
+  802dd9:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802de0:	89 c2                	mov    %eax,%edx
+  802de2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802de5:	29 c2                	sub    %eax,%edx
+  802de7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802dea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802ded:	83 f8 7f             	cmp    $0x7f,%eax
+  802df0:	76 07                	jbe    802df9 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802df2:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802df9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802dfc:	48 63 d0             	movslq %eax,%rdx
+  802dff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e02:	48 63 c8             	movslq %eax,%rcx
+  802e05:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e0c:	48 01 c1             	add    %rax,%rcx
+  802e0f:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e16:	48 89 ce             	mov    %rcx,%rsi
+  802e19:	48 89 c7             	mov    %rax,%rdi
+  802e1c:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  802e23:	00 00 00 
+  802e26:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e28:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e2b:	48 63 d0             	movslq %eax,%rdx
+  802e2e:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e35:	48 89 d6             	mov    %rdx,%rsi
+  802e38:	48 89 c7             	mov    %rax,%rdi
+  802e3b:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  802e42:	00 00 00 
+  802e45:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e4a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e50:	48 98                	cltq
+  802e52:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e59:	0f 82 7a ff ff ff    	jb     802dd9 <devcons_write+0x29>
+  }
+  return tot;
+  802e5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e62:	48 98                	cltq
+}
+  802e64:	c9                   	leave
+  802e65:	c3                   	ret
+
+0000000000802e66 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e66:	55                   	push   %rbp
+  802e67:	48 89 e5             	mov    %rsp,%rbp
+  802e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e6e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e77:	c9                   	leave
+  802e78:	c3                   	ret
+
+0000000000802e79 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e79:	55                   	push   %rbp
+  802e7a:	48 89 e5             	mov    %rsp,%rbp
+  802e7d:	48 83 ec 10          	sub    $0x10,%rsp
+  802e81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e85:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e8d:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e94:	00 00 00 
+  802e97:	48 89 d6             	mov    %rdx,%rsi
+  802e9a:	48 89 c7             	mov    %rax,%rdi
+  802e9d:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+  return 0;
+  802ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eae:	c9                   	leave
+  802eaf:	c3                   	ret
+
+0000000000802eb0 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	48 83 ec 30          	sub    $0x30,%rsp
+  802eb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ebc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802ebf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ec3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802eca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ecd:	83 e0 02             	and    $0x2,%eax
+  802ed0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ed3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed7:	8b 40 0c             	mov    0xc(%rax),%eax
+  802eda:	83 f8 01             	cmp    $0x1,%eax
+  802edd:	75 04                	jne    802ee3 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802edf:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ee3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ee6:	83 e0 01             	and    $0x1,%eax
+  802ee9:	85 c0                	test   %eax,%eax
+  802eeb:	74 44                	je     802f31 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802eed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ef0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ef5:	89 c2                	mov    %eax,%edx
+  802ef7:	be 00 00 00 00       	mov    $0x0,%esi
+  802efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f01:	48 b8 ee 07 80 00 00 	movabs $0x8007ee,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	83 f8 01             	cmp    $0x1,%eax
+  802f10:	75 06                	jne    802f18 <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f12:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f16:	eb 19                	jmp    802f31 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f1c:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f22:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f25:	89 c2                	mov    %eax,%edx
+  802f27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f2b:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f34:	c9                   	leave
+  802f35:	c3                   	ret
+
+0000000000802f36 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f36:	55                   	push   %rbp
+  802f37:	48 89 e5             	mov    %rsp,%rbp
+  802f3a:	53                   	push   %rbx
+  802f3b:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f42:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f49:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f4f:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f56:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f5d:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f64:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f6b:	84 c0                	test   %al,%al
+  802f6d:	74 23                	je     802f92 <_panic+0x5c>
+  802f6f:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f76:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f7a:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f7e:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f82:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f86:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f8a:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f8e:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f92:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802f99:	00 00 00 
+  802f9c:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fa3:	00 00 00 
+  802fa6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802faa:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fb1:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fb8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fbf:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fc6:	00 00 00 
+  802fc9:	48 8b 18             	mov    (%rax),%rbx
+  802fcc:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  802fd3:	00 00 00 
+  802fd6:	ff d0                	call   *%rax
+  802fd8:	89 c6                	mov    %eax,%esi
+  802fda:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802fe0:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802fe7:	41 89 d0             	mov    %edx,%r8d
+  802fea:	48 89 c1             	mov    %rax,%rcx
+  802fed:	48 89 da             	mov    %rbx,%rdx
+  802ff0:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  802ff7:	00 00 00 
+  802ffa:	48 89 c7             	mov    %rax,%rdi
+  802ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803002:	49 b9 55 31 80 00 00 	movabs $0x803155,%r9
+  803009:	00 00 00 
+  80300c:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80300f:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803016:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80301d:	48 89 d6             	mov    %rdx,%rsi
+  803020:	48 89 c7             	mov    %rax,%rdi
+  803023:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  80302a:	00 00 00 
+  80302d:	ff d0                	call   *%rax
+  cprintf("\n");
+  80302f:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  803036:	00 00 00 
+  803039:	48 89 c7             	mov    %rax,%rdi
+  80303c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803041:	48 ba 55 31 80 00 00 	movabs $0x803155,%rdx
+  803048:	00 00 00 
+  80304b:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80304d:	cc                   	int3
+  80304e:	eb fd                	jmp    80304d <_panic+0x117>
+
+0000000000803050 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803050:	55                   	push   %rbp
+  803051:	48 89 e5             	mov    %rsp,%rbp
+  803054:	48 83 ec 10          	sub    $0x10,%rsp
+  803058:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80305b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80305f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803063:	8b 00                	mov    (%rax),%eax
+  803065:	8d 48 01             	lea    0x1(%rax),%ecx
+  803068:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80306c:	89 0a                	mov    %ecx,(%rdx)
+  80306e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803071:	89 d1                	mov    %edx,%ecx
+  803073:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803077:	48 98                	cltq
+  803079:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80307d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803081:	8b 00                	mov    (%rax),%eax
+  803083:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803088:	75 2c                	jne    8030b6 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80308a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80308e:	8b 00                	mov    (%rax),%eax
+  803090:	48 98                	cltq
+  803092:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803096:	48 83 c2 08          	add    $0x8,%rdx
+  80309a:	48 89 c6             	mov    %rax,%rsi
+  80309d:	48 89 d7             	mov    %rdx,%rdi
+  8030a0:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ba:	8b 40 04             	mov    0x4(%rax),%eax
+  8030bd:	8d 50 01             	lea    0x1(%rax),%edx
+  8030c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c4:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030c7:	90                   	nop
+  8030c8:	c9                   	leave
+  8030c9:	c3                   	ret
+
+00000000008030ca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030d5:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030dc:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030e3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030ea:	00 00 00 
+  b.cnt = 0;
+  8030ed:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030f4:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8030f7:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8030fe:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803105:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80310c:	48 89 c6             	mov    %rax,%rsi
+  80310f:	48 b8 50 30 80 00 00 	movabs $0x803050,%rax
+  803116:	00 00 00 
+  803119:	48 89 c7             	mov    %rax,%rdi
+  80311c:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  803128:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80312e:	48 98                	cltq
+  803130:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  803137:	48 83 c2 08          	add    $0x8,%rdx
+  80313b:	48 89 c6             	mov    %rax,%rsi
+  80313e:	48 89 d7             	mov    %rdx,%rdi
+  803141:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80314d:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  803153:	c9                   	leave
+  803154:	c3                   	ret
+
+0000000000803155 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803155:	55                   	push   %rbp
+  803156:	48 89 e5             	mov    %rsp,%rbp
+  803159:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803160:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803167:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80316e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803175:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80317c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803183:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80318a:	84 c0                	test   %al,%al
+  80318c:	74 20                	je     8031ae <cprintf+0x59>
+  80318e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803192:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803196:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80319a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80319e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031a2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031a6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031aa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031ae:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031b5:	00 00 00 
+  8031b8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031bf:	00 00 00 
+  8031c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031c6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031cd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031d4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031db:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031e2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031e9:	48 89 d6             	mov    %rdx,%rsi
+  8031ec:	48 89 c7             	mov    %rax,%rdi
+  8031ef:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803201:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803207:	c9                   	leave
+  803208:	c3                   	ret
+
+0000000000803209 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803209:	55                   	push   %rbp
+  80320a:	48 89 e5             	mov    %rsp,%rbp
+  80320d:	48 83 ec 30          	sub    $0x30,%rsp
+  803211:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803215:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803219:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80321d:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803220:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  803224:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  803228:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80322b:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80322f:	72 54                	jb     803285 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803231:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803234:	8d 78 ff             	lea    -0x1(%rax),%edi
+  803237:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80323a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80323e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803243:	48 f7 f6             	div    %rsi
+  803246:	49 89 c2             	mov    %rax,%r10
+  803249:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80324c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80324f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803253:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803257:	41 89 c9             	mov    %ecx,%r9d
+  80325a:	41 89 f8             	mov    %edi,%r8d
+  80325d:	89 d1                	mov    %edx,%ecx
+  80325f:	4c 89 d2             	mov    %r10,%rdx
+  803262:	48 89 c7             	mov    %rax,%rdi
+  803265:	48 b8 09 32 80 00 00 	movabs $0x803209,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+  803271:	eb 1c                	jmp    80328f <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  803273:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803277:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80327a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80327e:	48 89 d6             	mov    %rdx,%rsi
+  803281:	89 c7                	mov    %eax,%edi
+  803283:	ff d1                	call   *%rcx
+    while (--width > 0)
+  803285:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  803289:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80328d:	7f e4                	jg     803273 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80328f:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803292:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80329b:	48 f7 f1             	div    %rcx
+  80329e:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  8032a5:	00 00 00 
+  8032a8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032ac:	0f be c0             	movsbl %al,%eax
+  8032af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032b3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032b7:	48 89 d6             	mov    %rdx,%rsi
+  8032ba:	89 c7                	mov    %eax,%edi
+  8032bc:	ff d1                	call   *%rcx
+}
+  8032be:	90                   	nop
+  8032bf:	c9                   	leave
+  8032c0:	c3                   	ret
+
+00000000008032c1 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032c1:	55                   	push   %rbp
+  8032c2:	48 89 e5             	mov    %rsp,%rbp
+  8032c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8032c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032cd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032d0:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032d4:	7e 4b                	jle    803321 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032da:	8b 00                	mov    (%rax),%eax
+  8032dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8032df:	77 24                	ja     803305 <getuint+0x44>
+  8032e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032ed:	8b 00                	mov    (%rax),%eax
+  8032ef:	89 c0                	mov    %eax,%eax
+  8032f1:	48 01 d0             	add    %rdx,%rax
+  8032f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f8:	8b 12                	mov    (%rdx),%edx
+  8032fa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8032fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803301:	89 0a                	mov    %ecx,(%rdx)
+  803303:	eb 14                	jmp    803319 <getuint+0x58>
+  803305:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803309:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80330d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803311:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803315:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803319:	48 8b 00             	mov    (%rax),%rax
+  80331c:	e9 95 00 00 00       	jmp    8033b6 <getuint+0xf5>
+  else if (lflag)
+  803321:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803325:	74 48                	je     80336f <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  803327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80332b:	8b 00                	mov    (%rax),%eax
+  80332d:	83 f8 2f             	cmp    $0x2f,%eax
+  803330:	77 24                	ja     803356 <getuint+0x95>
+  803332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803336:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80333a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80333e:	8b 00                	mov    (%rax),%eax
+  803340:	89 c0                	mov    %eax,%eax
+  803342:	48 01 d0             	add    %rdx,%rax
+  803345:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803349:	8b 12                	mov    (%rdx),%edx
+  80334b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80334e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803352:	89 0a                	mov    %ecx,(%rdx)
+  803354:	eb 14                	jmp    80336a <getuint+0xa9>
+  803356:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80335a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80335e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803362:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803366:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80336a:	48 8b 00             	mov    (%rax),%rax
+  80336d:	eb 47                	jmp    8033b6 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80336f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803373:	8b 00                	mov    (%rax),%eax
+  803375:	83 f8 2f             	cmp    $0x2f,%eax
+  803378:	77 24                	ja     80339e <getuint+0xdd>
+  80337a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80337e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803386:	8b 00                	mov    (%rax),%eax
+  803388:	89 c0                	mov    %eax,%eax
+  80338a:	48 01 d0             	add    %rdx,%rax
+  80338d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803391:	8b 12                	mov    (%rdx),%edx
+  803393:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803396:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80339a:	89 0a                	mov    %ecx,(%rdx)
+  80339c:	eb 14                	jmp    8033b2 <getuint+0xf1>
+  80339e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033a6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ae:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033b2:	8b 00                	mov    (%rax),%eax
+  8033b4:	89 c0                	mov    %eax,%eax
+}
+  8033b6:	c9                   	leave
+  8033b7:	c3                   	ret
+
+00000000008033b8 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033b8:	55                   	push   %rbp
+  8033b9:	48 89 e5             	mov    %rsp,%rbp
+  8033bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8033c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033c4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033c7:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033cb:	7e 4b                	jle    803418 <getint+0x60>
+    return va_arg(*ap, long long);
+  8033cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d1:	8b 00                	mov    (%rax),%eax
+  8033d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8033d6:	77 24                	ja     8033fc <getint+0x44>
+  8033d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033dc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e4:	8b 00                	mov    (%rax),%eax
+  8033e6:	89 c0                	mov    %eax,%eax
+  8033e8:	48 01 d0             	add    %rdx,%rax
+  8033eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ef:	8b 12                	mov    (%rdx),%edx
+  8033f1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033f8:	89 0a                	mov    %ecx,(%rdx)
+  8033fa:	eb 14                	jmp    803410 <getint+0x58>
+  8033fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803400:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803404:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803408:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80340c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803410:	48 8b 00             	mov    (%rax),%rax
+  803413:	e9 95 00 00 00       	jmp    8034ad <getint+0xf5>
+  else if (lflag)
+  803418:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80341c:	74 48                	je     803466 <getint+0xae>
+    return va_arg(*ap, long);
+  80341e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803422:	8b 00                	mov    (%rax),%eax
+  803424:	83 f8 2f             	cmp    $0x2f,%eax
+  803427:	77 24                	ja     80344d <getint+0x95>
+  803429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80342d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803435:	8b 00                	mov    (%rax),%eax
+  803437:	89 c0                	mov    %eax,%eax
+  803439:	48 01 d0             	add    %rdx,%rax
+  80343c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803440:	8b 12                	mov    (%rdx),%edx
+  803442:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803445:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803449:	89 0a                	mov    %ecx,(%rdx)
+  80344b:	eb 14                	jmp    803461 <getint+0xa9>
+  80344d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803451:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803455:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803459:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80345d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803461:	48 8b 00             	mov    (%rax),%rax
+  803464:	eb 47                	jmp    8034ad <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  803466:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346a:	8b 00                	mov    (%rax),%eax
+  80346c:	83 f8 2f             	cmp    $0x2f,%eax
+  80346f:	77 24                	ja     803495 <getint+0xdd>
+  803471:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803475:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347d:	8b 00                	mov    (%rax),%eax
+  80347f:	89 c0                	mov    %eax,%eax
+  803481:	48 01 d0             	add    %rdx,%rax
+  803484:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803488:	8b 12                	mov    (%rdx),%edx
+  80348a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80348d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803491:	89 0a                	mov    %ecx,(%rdx)
+  803493:	eb 14                	jmp    8034a9 <getint+0xf1>
+  803495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803499:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80349d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034a9:	8b 00                	mov    (%rax),%eax
+  8034ab:	48 98                	cltq
+}
+  8034ad:	c9                   	leave
+  8034ae:	c3                   	ret
+
+00000000008034af <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034af:	55                   	push   %rbp
+  8034b0:	48 89 e5             	mov    %rsp,%rbp
+  8034b3:	41 54                	push   %r12
+  8034b5:	53                   	push   %rbx
+  8034b6:	48 83 ec 60          	sub    $0x60,%rsp
+  8034ba:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034be:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034c2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034c6:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034ca:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034ce:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034d2:	48 8b 06             	mov    (%rsi),%rax
+  8034d5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034d9:	48 89 01             	mov    %rax,(%rcx)
+  8034dc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034e0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034e4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034e8:	eb 17                	jmp    803501 <vprintfmt+0x52>
+      if (ch == '\0')
+  8034ea:	85 db                	test   %ebx,%ebx
+  8034ec:	0f 84 bf 04 00 00    	je     8039b1 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034f2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034f6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8034fa:	48 89 c6             	mov    %rax,%rsi
+  8034fd:	89 df                	mov    %ebx,%edi
+  8034ff:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803501:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803505:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803509:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80350d:	0f b6 00             	movzbl (%rax),%eax
+  803510:	0f b6 d8             	movzbl %al,%ebx
+  803513:	83 fb 25             	cmp    $0x25,%ebx
+  803516:	75 d2                	jne    8034ea <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803518:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  80351c:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  803523:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80352a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803531:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  803538:	eb 04                	jmp    80353e <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80353a:	90                   	nop
+  80353b:	eb 01                	jmp    80353e <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80353d:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80353e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803542:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803546:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80354a:	0f b6 00             	movzbl (%rax),%eax
+  80354d:	0f b6 d8             	movzbl %al,%ebx
+  803550:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  803553:	83 f8 55             	cmp    $0x55,%eax
+  803556:	0f 87 22 04 00 00    	ja     80397e <vprintfmt+0x4cf>
+  80355c:	89 c0                	mov    %eax,%eax
+  80355e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803565:	00 
+  803566:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  80356d:	00 00 00 
+  803570:	48 01 d0             	add    %rdx,%rax
+  803573:	48 8b 00             	mov    (%rax),%rax
+  803576:	ff e0                	jmp    *%rax
+        padc = '-';
+  803578:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80357c:	eb c0                	jmp    80353e <vprintfmt+0x8f>
+        padc = '0';
+  80357e:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803582:	eb ba                	jmp    80353e <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  803584:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80358b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80358e:	89 d0                	mov    %edx,%eax
+  803590:	c1 e0 02             	shl    $0x2,%eax
+  803593:	01 d0                	add    %edx,%eax
+  803595:	01 c0                	add    %eax,%eax
+  803597:	01 d8                	add    %ebx,%eax
+  803599:	83 e8 30             	sub    $0x30,%eax
+  80359c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80359f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035a3:	0f b6 00             	movzbl (%rax),%eax
+  8035a6:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035a9:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035ac:	7e 60                	jle    80360e <vprintfmt+0x15f>
+  8035ae:	83 fb 39             	cmp    $0x39,%ebx
+  8035b1:	7f 5b                	jg     80360e <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035b3:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035b8:	eb d1                	jmp    80358b <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8035c0:	77 17                	ja     8035d9 <vprintfmt+0x12a>
+  8035c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035c6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035c9:	89 d2                	mov    %edx,%edx
+  8035cb:	48 01 d0             	add    %rdx,%rax
+  8035ce:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035d1:	83 c2 08             	add    $0x8,%edx
+  8035d4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035d7:	eb 0c                	jmp    8035e5 <vprintfmt+0x136>
+  8035d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035dd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035e1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035e5:	8b 00                	mov    (%rax),%eax
+  8035e7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035ea:	eb 23                	jmp    80360f <vprintfmt+0x160>
+        if (width < 0)
+  8035ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035f0:	0f 89 44 ff ff ff    	jns    80353a <vprintfmt+0x8b>
+          width = 0;
+  8035f6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8035fd:	e9 38 ff ff ff       	jmp    80353a <vprintfmt+0x8b>
+        altflag = 1;
+  803602:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803609:	e9 30 ff ff ff       	jmp    80353e <vprintfmt+0x8f>
+        goto process_precision;
+  80360e:	90                   	nop
+        if (width < 0)
+  80360f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803613:	0f 89 24 ff ff ff    	jns    80353d <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803619:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80361c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80361f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803626:	e9 12 ff ff ff       	jmp    80353d <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80362b:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80362f:	e9 0a ff ff ff       	jmp    80353e <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  803634:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803637:	83 f8 2f             	cmp    $0x2f,%eax
+  80363a:	77 17                	ja     803653 <vprintfmt+0x1a4>
+  80363c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803640:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803643:	89 d2                	mov    %edx,%edx
+  803645:	48 01 d0             	add    %rdx,%rax
+  803648:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80364b:	83 c2 08             	add    $0x8,%edx
+  80364e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803651:	eb 0c                	jmp    80365f <vprintfmt+0x1b0>
+  803653:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803657:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80365b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80365f:	8b 00                	mov    (%rax),%eax
+  803661:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803665:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803669:	48 89 d6             	mov    %rdx,%rsi
+  80366c:	89 c7                	mov    %eax,%edi
+  80366e:	ff d1                	call   *%rcx
+        break;
+  803670:	e9 37 03 00 00       	jmp    8039ac <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  803675:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803678:	83 f8 2f             	cmp    $0x2f,%eax
+  80367b:	77 17                	ja     803694 <vprintfmt+0x1e5>
+  80367d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803681:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803684:	89 d2                	mov    %edx,%edx
+  803686:	48 01 d0             	add    %rdx,%rax
+  803689:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80368c:	83 c2 08             	add    $0x8,%edx
+  80368f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803692:	eb 0c                	jmp    8036a0 <vprintfmt+0x1f1>
+  803694:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803698:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80369c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036a0:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036a2:	85 db                	test   %ebx,%ebx
+  8036a4:	79 02                	jns    8036a8 <vprintfmt+0x1f9>
+          err = -err;
+  8036a6:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036a8:	83 fb 15             	cmp    $0x15,%ebx
+  8036ab:	7f 16                	jg     8036c3 <vprintfmt+0x214>
+  8036ad:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036b4:	00 00 00 
+  8036b7:	48 63 c3             	movslq %ebx,%rax
+  8036ba:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036be:	4d 85 e4             	test   %r12,%r12
+  8036c1:	75 2e                	jne    8036f1 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036c3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036cb:	89 d9                	mov    %ebx,%ecx
+  8036cd:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036d4:	00 00 00 
+  8036d7:	48 89 c7             	mov    %rax,%rdi
+  8036da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036df:	49 b8 bb 39 80 00 00 	movabs $0x8039bb,%r8
+  8036e6:	00 00 00 
+  8036e9:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036ec:	e9 bb 02 00 00       	jmp    8039ac <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036f1:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036f9:	4c 89 e1             	mov    %r12,%rcx
+  8036fc:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  803703:	00 00 00 
+  803706:	48 89 c7             	mov    %rax,%rdi
+  803709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370e:	49 b8 bb 39 80 00 00 	movabs $0x8039bb,%r8
+  803715:	00 00 00 
+  803718:	41 ff d0             	call   *%r8
+        break;
+  80371b:	e9 8c 02 00 00       	jmp    8039ac <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803720:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803723:	83 f8 2f             	cmp    $0x2f,%eax
+  803726:	77 17                	ja     80373f <vprintfmt+0x290>
+  803728:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80372c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80372f:	89 d2                	mov    %edx,%edx
+  803731:	48 01 d0             	add    %rdx,%rax
+  803734:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803737:	83 c2 08             	add    $0x8,%edx
+  80373a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80373d:	eb 0c                	jmp    80374b <vprintfmt+0x29c>
+  80373f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803743:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803747:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80374b:	4c 8b 20             	mov    (%rax),%r12
+  80374e:	4d 85 e4             	test   %r12,%r12
+  803751:	75 0a                	jne    80375d <vprintfmt+0x2ae>
+          p = "(null)";
+  803753:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  80375a:	00 00 00 
+        if (width > 0 && padc != '-')
+  80375d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803761:	7e 78                	jle    8037db <vprintfmt+0x32c>
+  803763:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  803767:	74 72                	je     8037db <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803769:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80376c:	48 98                	cltq
+  80376e:	48 89 c6             	mov    %rax,%rsi
+  803771:	4c 89 e7             	mov    %r12,%rdi
+  803774:	48 b8 c7 40 80 00 00 	movabs $0x8040c7,%rax
+  80377b:	00 00 00 
+  80377e:	ff d0                	call   *%rax
+  803780:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803783:	eb 17                	jmp    80379c <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  803785:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  803789:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80378d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803791:	48 89 d6             	mov    %rdx,%rsi
+  803794:	89 c7                	mov    %eax,%edi
+  803796:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803798:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80379c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037a0:	7f e3                	jg     803785 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037a2:	eb 37                	jmp    8037db <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037a4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037a8:	74 1e                	je     8037c8 <vprintfmt+0x319>
+  8037aa:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037ad:	7e 05                	jle    8037b4 <vprintfmt+0x305>
+  8037af:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037b2:	7e 14                	jle    8037c8 <vprintfmt+0x319>
+            putch('?', putdat);
+  8037b4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037b8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037bc:	48 89 c6             	mov    %rax,%rsi
+  8037bf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037c4:	ff d2                	call   *%rdx
+  8037c6:	eb 0f                	jmp    8037d7 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037cc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037d0:	48 89 c6             	mov    %rax,%rsi
+  8037d3:	89 df                	mov    %ebx,%edi
+  8037d5:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037d7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037db:	4c 89 e0             	mov    %r12,%rax
+  8037de:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037e2:	0f b6 00             	movzbl (%rax),%eax
+  8037e5:	0f be d8             	movsbl %al,%ebx
+  8037e8:	85 db                	test   %ebx,%ebx
+  8037ea:	74 28                	je     803814 <vprintfmt+0x365>
+  8037ec:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037f0:	78 b2                	js     8037a4 <vprintfmt+0x2f5>
+  8037f2:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8037f6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037fa:	79 a8                	jns    8037a4 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8037fc:	eb 16                	jmp    803814 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8037fe:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803802:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803806:	48 89 c6             	mov    %rax,%rsi
+  803809:	bf 20 00 00 00       	mov    $0x20,%edi
+  80380e:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803810:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803814:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803818:	7f e4                	jg     8037fe <vprintfmt+0x34f>
+        break;
+  80381a:	e9 8d 01 00 00       	jmp    8039ac <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80381f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803822:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803826:	89 d6                	mov    %edx,%esi
+  803828:	48 89 c7             	mov    %rax,%rdi
+  80382b:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  803832:	00 00 00 
+  803835:	ff d0                	call   *%rax
+  803837:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80383b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80383f:	48 85 c0             	test   %rax,%rax
+  803842:	79 1d                	jns    803861 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  803844:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803848:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80384c:	48 89 c6             	mov    %rax,%rsi
+  80384f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803854:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  803856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80385a:	48 f7 d8             	neg    %rax
+  80385d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803861:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803868:	e9 d2 00 00 00       	jmp    80393f <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80386d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803870:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803874:	89 d6                	mov    %edx,%esi
+  803876:	48 89 c7             	mov    %rax,%rdi
+  803879:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  803880:	00 00 00 
+  803883:	ff d0                	call   *%rax
+  803885:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  803889:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803890:	e9 aa 00 00 00       	jmp    80393f <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  803895:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803898:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80389c:	89 d6                	mov    %edx,%esi
+  80389e:	48 89 c7             	mov    %rax,%rdi
+  8038a1:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  8038a8:	00 00 00 
+  8038ab:	ff d0                	call   *%rax
+  8038ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038b1:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038b8:	e9 82 00 00 00       	jmp    80393f <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038bd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038c1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038c5:	48 89 c6             	mov    %rax,%rsi
+  8038c8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038cd:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038cf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038d3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038d7:	48 89 c6             	mov    %rax,%rsi
+  8038da:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038df:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8038e7:	77 17                	ja     803900 <vprintfmt+0x451>
+  8038e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038f0:	89 d2                	mov    %edx,%edx
+  8038f2:	48 01 d0             	add    %rdx,%rax
+  8038f5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038f8:	83 c2 08             	add    $0x8,%edx
+  8038fb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8038fe:	eb 0c                	jmp    80390c <vprintfmt+0x45d>
+  803900:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803904:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803908:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80390c:	48 8b 00             	mov    (%rax),%rax
+  80390f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803913:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80391a:	eb 23                	jmp    80393f <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  80391c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80391f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803923:	89 d6                	mov    %edx,%esi
+  803925:	48 89 c7             	mov    %rax,%rdi
+  803928:	48 b8 c1 32 80 00 00 	movabs $0x8032c1,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+  803934:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803938:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80393f:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  803944:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803947:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80394a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80394e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803952:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803956:	45 89 c1             	mov    %r8d,%r9d
+  803959:	41 89 f8             	mov    %edi,%r8d
+  80395c:	48 89 c7             	mov    %rax,%rdi
+  80395f:	48 b8 09 32 80 00 00 	movabs $0x803209,%rax
+  803966:	00 00 00 
+  803969:	ff d0                	call   *%rax
+        break;
+  80396b:	eb 3f                	jmp    8039ac <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  80396d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803971:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803975:	48 89 c6             	mov    %rax,%rsi
+  803978:	89 df                	mov    %ebx,%edi
+  80397a:	ff d2                	call   *%rdx
+        break;
+  80397c:	eb 2e                	jmp    8039ac <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80397e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803982:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803986:	48 89 c6             	mov    %rax,%rsi
+  803989:	bf 25 00 00 00       	mov    $0x25,%edi
+  80398e:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803990:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803995:	eb 05                	jmp    80399c <vprintfmt+0x4ed>
+  803997:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80399c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039a0:	48 83 e8 01          	sub    $0x1,%rax
+  8039a4:	0f b6 00             	movzbl (%rax),%eax
+  8039a7:	3c 25                	cmp    $0x25,%al
+  8039a9:	75 ec                	jne    803997 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039ab:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039ac:	e9 50 fb ff ff       	jmp    803501 <vprintfmt+0x52>
+        return;
+  8039b1:	90                   	nop
+    }
+  }
+}
+  8039b2:	48 83 c4 60          	add    $0x60,%rsp
+  8039b6:	5b                   	pop    %rbx
+  8039b7:	41 5c                	pop    %r12
+  8039b9:	5d                   	pop    %rbp
+  8039ba:	c3                   	ret
+
+00000000008039bb <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039bb:	55                   	push   %rbp
+  8039bc:	48 89 e5             	mov    %rsp,%rbp
+  8039bf:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039c6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039cd:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039d4:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039db:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039e2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039e9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039f0:	84 c0                	test   %al,%al
+  8039f2:	74 20                	je     803a14 <printfmt+0x59>
+  8039f4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039f8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8039fc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a00:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a04:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a08:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a0c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a10:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a14:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a1b:	00 00 00 
+  803a1e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a25:	00 00 00 
+  803a28:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a2c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a33:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a3a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a41:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a48:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a4f:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a56:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a5d:	48 89 c7             	mov    %rax,%rdi
+  803a60:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803a67:	00 00 00 
+  803a6a:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a6c:	90                   	nop
+  803a6d:	c9                   	leave
+  803a6e:	c3                   	ret
+
+0000000000803a6f <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a6f:	55                   	push   %rbp
+  803a70:	48 89 e5             	mov    %rsp,%rbp
+  803a73:	48 83 ec 10          	sub    $0x10,%rsp
+  803a77:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a82:	8b 40 10             	mov    0x10(%rax),%eax
+  803a85:	8d 50 01             	lea    0x1(%rax),%edx
+  803a88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8c:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a93:	48 8b 10             	mov    (%rax),%rdx
+  803a96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803a9e:	48 39 c2             	cmp    %rax,%rdx
+  803aa1:	73 17                	jae    803aba <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803aa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa7:	48 8b 00             	mov    (%rax),%rax
+  803aaa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803aae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ab2:	48 89 0a             	mov    %rcx,(%rdx)
+  803ab5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803ab8:	88 10                	mov    %dl,(%rax)
+}
+  803aba:	90                   	nop
+  803abb:	c9                   	leave
+  803abc:	c3                   	ret
+
+0000000000803abd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803abd:	55                   	push   %rbp
+  803abe:	48 89 e5             	mov    %rsp,%rbp
+  803ac1:	48 83 ec 40          	sub    $0x40,%rsp
+  803ac5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ac9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803acc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ad0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803ad4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ad8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803adc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803adf:	48 98                	cltq
+  803ae1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803ae5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae9:	48 01 d0             	add    %rdx,%rax
+  803aec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803af0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803af7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803afc:	74 06                	je     803b04 <vsnprintf+0x47>
+  803afe:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b02:	7f 07                	jg     803b0b <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b09:	eb 32                	jmp    803b3d <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b0b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b0f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b13:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b17:	48 89 c6             	mov    %rax,%rsi
+  803b1a:	48 b8 6f 3a 80 00 00 	movabs $0x803a6f,%rax
+  803b21:	00 00 00 
+  803b24:	48 89 c7             	mov    %rax,%rdi
+  803b27:	48 b8 af 34 80 00 00 	movabs $0x8034af,%rax
+  803b2e:	00 00 00 
+  803b31:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b37:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b3a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b3d:	c9                   	leave
+  803b3e:	c3                   	ret
+
+0000000000803b3f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b3f:	55                   	push   %rbp
+  803b40:	48 89 e5             	mov    %rsp,%rbp
+  803b43:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b4a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b51:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b57:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b5e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b65:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b6c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b73:	84 c0                	test   %al,%al
+  803b75:	74 20                	je     803b97 <snprintf+0x58>
+  803b77:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b7b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b7f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b83:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b87:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b8b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b8f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b93:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803b97:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803b9e:	00 00 00 
+  803ba1:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803ba8:	00 00 00 
+  803bab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803baf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bb6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bbd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bc4:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bcb:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bd2:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bd8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bdf:	48 89 c7             	mov    %rax,%rdi
+  803be2:	48 b8 bd 3a 80 00 00 	movabs $0x803abd,%rax
+  803be9:	00 00 00 
+  803bec:	ff d0                	call   *%rax
+  803bee:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803bf4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803bfa:	c9                   	leave
+  803bfb:	c3                   	ret
+
+0000000000803bfc <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803bfc:	55                   	push   %rbp
+  803bfd:	48 89 e5             	mov    %rsp,%rbp
+  803c00:	53                   	push   %rbx
+  803c01:	48 83 ec 38          	sub    $0x38,%rsp
+  803c05:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c08:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c0c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c10:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c14:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c20:	89 d1                	mov    %edx,%ecx
+  803c22:	0f a2                	cpuid
+  803c24:	89 de                	mov    %ebx,%esi
+  803c26:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c29:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c2c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c2f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c32:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c37:	74 09                	je     803c42 <cpuid+0x46>
+}
+  803c39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c3d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c40:	89 10                	mov    %edx,(%rax)
+
+  803c42:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c47:	74 09                	je     803c52 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c4d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c50:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c52:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c57:	74 09                	je     803c62 <cpuid+0x66>
+char *
+  803c59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c5d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c60:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c62:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c67:	74 09                	je     803c72 <cpuid+0x76>
+  for (; *s; s++)
+  803c69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c6d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c70:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c72:	90                   	nop
+  803c73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c77:	c9                   	leave
+  803c78:	c3                   	ret
+
+0000000000803c79 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c79:	55                   	push   %rbp
+  803c7a:	48 89 e5             	mov    %rsp,%rbp
+  803c7d:	48 83 ec 18          	sub    $0x18,%rsp
+  803c81:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c87:	89 c1                	mov    %eax,%ecx
+  803c89:	0f 01 d0             	xgetbv
+  803c8c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c95:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803c98:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c9c:	48 09 d0             	or     %rdx,%rax
+#else
+  803c9f:	c9                   	leave
+  803ca0:	c3                   	ret
+
+0000000000803ca1 <string_cpu>:
+string_cpu(void) {
+  803ca1:	55                   	push   %rbp
+  803ca2:	48 89 e5             	mov    %rsp,%rbp
+  803ca5:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803ca9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cb0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cb7:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cbe:	00 00 00 
+  803cc1:	8b 00                	mov    (%rax),%eax
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	78 11                	js     803cd8 <string_cpu+0x37>
+    return string_features;
+  803cc7:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cce:	00 00 00 
+  803cd1:	8b 00                	mov    (%rax),%eax
+  803cd3:	e9 df 00 00 00       	jmp    803db7 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cd8:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cec:	48 89 c6             	mov    %rax,%rsi
+  803cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf4:	48 b8 fc 3b 80 00 00 	movabs $0x803bfc,%rax
+  803cfb:	00 00 00 
+  803cfe:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d03:	83 f8 06             	cmp    $0x6,%eax
+  803d06:	76 28                	jbe    803d30 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d08:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d17:	48 89 c2             	mov    %rax,%rdx
+  803d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  803d1f:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d24:	48 b8 fc 3b 80 00 00 	movabs $0x803bfc,%rax
+  803d2b:	00 00 00 
+  803d2e:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d33:	25 00 02 00 00       	and    $0x200,%eax
+  803d38:	85 c0                	test   %eax,%eax
+  803d3a:	74 04                	je     803d40 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d3c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d40:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d4a:	48 89 c1             	mov    %rax,%rcx
+  803d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d52:	be 00 00 00 00       	mov    $0x0,%esi
+  803d57:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d5c:	48 b8 fc 3b 80 00 00 	movabs $0x803bfc,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d6b:	83 e0 20             	and    $0x20,%eax
+  803d6e:	85 c0                	test   %eax,%eax
+  803d70:	74 2a                	je     803d9c <string_cpu+0xfb>
+  803d72:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d75:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d7a:	85 c0                	test   %eax,%eax
+  803d7c:	74 1e                	je     803d9c <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d83:	48 b8 79 3c 80 00 00 	movabs $0x803c79,%rax
+  803d8a:	00 00 00 
+  803d8d:	ff d0                	call   *%rax
+  803d8f:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d92:	48 83 f8 06          	cmp    $0x6,%rax
+  803d96:	75 04                	jne    803d9c <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803d98:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803d9c:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803da3:	00 00 00 
+  803da6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803da9:	89 02                	mov    %eax,(%rdx)
+  803dab:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803db2:	00 00 00 
+  803db5:	8b 00                	mov    (%rax),%eax
+}
+  803db7:	c9                   	leave
+  803db8:	c3                   	ret
+
+0000000000803db9 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803db9:	55                   	push   %rbp
+  803dba:	48 89 e5             	mov    %rsp,%rbp
+  803dbd:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dc1:	48 83 ec 60          	sub    $0x60,%rsp
+  803dc5:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dca:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dcf:	83 e0 1f             	and    $0x1f,%eax
+  803dd2:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803dd6:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803dda:	48 f7 d8             	neg    %rax
+  803ddd:	48 89 c2             	mov    %rax,%rdx
+  803de0:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803de5:	48 01 d0             	add    %rdx,%rax
+  803de8:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803ded:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803df1:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803df7:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803dfc:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e00:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e06:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e0a:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e0e:	89 c2                	mov    %eax,%edx
+  803e10:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e14:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e19:	89 c1                	mov    %eax,%ecx
+  803e1b:	d3 e6                	shl    %cl,%esi
+  803e1d:	89 f0                	mov    %esi,%eax
+  803e1f:	21 d0                	and    %edx,%eax
+  803e21:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e25:	eb 21                	jmp    803e48 <strlen_avx2+0x8f>
+    p += 32;
+  803e27:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e2d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e32:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e36:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e3c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e40:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e44:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e48:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e4d:	74 d8                	je     803e27 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e4f:	31 c0                	xor    %eax,%eax
+  803e51:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e57:	48 63 d0             	movslq %eax,%rdx
+  803e5a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e5f:	48 01 d0             	add    %rdx,%rax
+  803e62:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e67:	c9                   	leave
+  803e68:	c3                   	ret
+
+0000000000803e69 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e69:	55                   	push   %rbp
+  803e6a:	48 89 e5             	mov    %rsp,%rbp
+  803e6d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e71:	48 83 ec 40          	sub    $0x40,%rsp
+  803e75:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e7a:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e7f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e84:	eb 77                	jmp    803efd <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e86:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e8b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e8f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e93:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803e98:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e9c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803ea0:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803ea4:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ea8:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ead:	74 3c                	je     803eeb <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803eaf:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eb3:	f7 d0                	not    %eax
+  803eb5:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803eb9:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ebd:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ec1:	48 63 d0             	movslq %eax,%rdx
+  803ec4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ec9:	48 01 d0             	add    %rdx,%rax
+  803ecc:	0f b6 00             	movzbl (%rax),%eax
+  803ecf:	0f b6 c0             	movzbl %al,%eax
+  803ed2:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ed6:	48 63 ca             	movslq %edx,%rcx
+  803ed9:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ede:	48 01 ca             	add    %rcx,%rdx
+  803ee1:	0f b6 12             	movzbl (%rdx),%edx
+  803ee4:	0f b6 d2             	movzbl %dl,%edx
+  803ee7:	29 d0                	sub    %edx,%eax
+  803ee9:	eb 6b                	jmp    803f56 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803eeb:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803ef1:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803ef7:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803efd:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f03:	77 81                	ja     803e86 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f05:	eb 42                	jmp    803f49 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f07:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f0c:	0f b6 10             	movzbl (%rax),%edx
+  803f0f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f14:	0f b6 00             	movzbl (%rax),%eax
+  803f17:	38 c2                	cmp    %al,%dl
+  803f19:	74 1c                	je     803f37 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f1b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f20:	0f b6 00             	movzbl (%rax),%eax
+  803f23:	0f b6 c8             	movzbl %al,%ecx
+  803f26:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f2b:	0f b6 00             	movzbl (%rax),%eax
+  803f2e:	0f b6 d0             	movzbl %al,%edx
+  803f31:	89 c8                	mov    %ecx,%eax
+  803f33:	29 d0                	sub    %edx,%eax
+  803f35:	eb 1f                	jmp    803f56 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f37:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f3d:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f43:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f49:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f4f:	75 b6                	jne    803f07 <memcmp_avx2+0x9e>
+  return 0;
+  803f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f56:	c9                   	leave
+  803f57:	c3                   	ret
+
+0000000000803f58 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f58:	55                   	push   %rbp
+  803f59:	48 89 e5             	mov    %rsp,%rbp
+  803f5c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f60:	48 83 ec 60          	sub    $0x60,%rsp
+  803f64:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f69:	89 f0                	mov    %esi,%eax
+  803f6b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f70:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f74:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f79:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f7d:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f82:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f88:	eb 47                	jmp    803fd1 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f8a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f8f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f93:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f97:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803f9d:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fa1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fa5:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fa9:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fae:	74 15                	je     803fc5 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fb0:	31 c0                	xor    %eax,%eax
+  803fb2:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fb8:	48 63 d0             	movslq %eax,%rdx
+  803fbb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fc0:	48 01 d0             	add    %rdx,%rax
+  803fc3:	eb 3d                	jmp    804002 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fc5:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fcb:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fd1:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fd7:	77 b1                	ja     803f8a <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fd9:	eb 0c                	jmp    803fe7 <memfind_avx2+0x8f>
+  803fdb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fe1:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fe7:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fed:	74 0e                	je     803ffd <memfind_avx2+0xa5>
+  803fef:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ff4:	0f b6 00             	movzbl (%rax),%eax
+  803ff7:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  803ffb:	75 de                	jne    803fdb <memfind_avx2+0x83>
+  return s;
+  803ffd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804002:	c9                   	leave
+  804003:	c3                   	ret
+
+0000000000804004 <strlen>:
+strlen(const char *s) {
+  804004:	55                   	push   %rbp
+  804005:	48 89 e5             	mov    %rsp,%rbp
+  804008:	48 83 ec 40          	sub    $0x40,%rsp
+  80400c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804010:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804014:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804018:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+  804024:	83 e0 02             	and    $0x2,%eax
+  804027:	85 c0                	test   %eax,%eax
+  804029:	74 18                	je     804043 <strlen+0x3f>
+    return strlen_avx2(s);
+  80402b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80402f:	48 89 c7             	mov    %rax,%rdi
+  804032:	48 b8 b9 3d 80 00 00 	movabs $0x803db9,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+  80403e:	e9 82 00 00 00       	jmp    8040c5 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  804043:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804047:	83 e0 0f             	and    $0xf,%eax
+  80404a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80404d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804050:	48 f7 d8             	neg    %rax
+  804053:	48 89 c2             	mov    %rax,%rdx
+  804056:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405a:	48 01 d0             	add    %rdx,%rax
+  80405d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804061:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804065:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804069:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80406e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804072:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804076:	89 c2                	mov    %eax,%edx
+  804078:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80407b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804080:	89 c1                	mov    %eax,%ecx
+  804082:	d3 e6                	shl    %cl,%esi
+  804084:	89 f0                	mov    %esi,%eax
+  804086:	21 d0                	and    %edx,%eax
+  804088:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80408b:	eb 1d                	jmp    8040aa <strlen+0xa6>
+    p += 16;
+  80408d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804092:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804096:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80409a:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80409f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040a3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040ae:	74 dd                	je     80408d <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040b0:	31 c0                	xor    %eax,%eax
+  8040b2:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040b7:	48 63 d0             	movslq %eax,%rdx
+  8040ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040be:	48 01 d0             	add    %rdx,%rax
+  8040c1:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040c5:	c9                   	leave
+  8040c6:	c3                   	ret
+
+00000000008040c7 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040c7:	55                   	push   %rbp
+  8040c8:	48 89 e5             	mov    %rsp,%rbp
+  8040cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8040cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040d3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040de:	eb 0e                	jmp    8040ee <strnlen+0x27>
+    n++;
+  8040e0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040e4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040e9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040ee:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040f3:	74 0b                	je     804100 <strnlen+0x39>
+  8040f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040f9:	0f b6 00             	movzbl (%rax),%eax
+  8040fc:	84 c0                	test   %al,%al
+  8040fe:	75 e0                	jne    8040e0 <strnlen+0x19>
+  return n;
+  804100:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804103:	c9                   	leave
+  804104:	c3                   	ret
+
+0000000000804105 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804105:	55                   	push   %rbp
+  804106:	48 89 e5             	mov    %rsp,%rbp
+  804109:	48 83 ec 20          	sub    $0x20,%rsp
+  80410d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804111:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804119:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80411d:	90                   	nop
+  80411e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804122:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804126:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80412a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80412e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804132:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804136:	0f b6 12             	movzbl (%rdx),%edx
+  804139:	88 10                	mov    %dl,(%rax)
+  80413b:	0f b6 00             	movzbl (%rax),%eax
+  80413e:	84 c0                	test   %al,%al
+  804140:	75 dc                	jne    80411e <strcpy+0x19>
+  return ret;
+  804142:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804146:	c9                   	leave
+  804147:	c3                   	ret
+
+0000000000804148 <strcat>:
+strcat(char *dst, const char *src) {
+  804148:	55                   	push   %rbp
+  804149:	48 89 e5             	mov    %rsp,%rbp
+  80414c:	48 83 ec 20          	sub    $0x20,%rsp
+  804150:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804154:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  804158:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80415c:	48 89 c7             	mov    %rax,%rdi
+  80415f:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  804166:	00 00 00 
+  804169:	ff d0                	call   *%rax
+  80416b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80416e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804171:	48 63 d0             	movslq %eax,%rdx
+  804174:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804178:	48 01 c2             	add    %rax,%rdx
+  80417b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80417f:	48 89 c6             	mov    %rax,%rsi
+  804182:	48 89 d7             	mov    %rdx,%rdi
+  804185:	48 b8 05 41 80 00 00 	movabs $0x804105,%rax
+  80418c:	00 00 00 
+  80418f:	ff d0                	call   *%rax
+  return dst;
+  804191:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804195:	c9                   	leave
+  804196:	c3                   	ret
+
+0000000000804197 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  804197:	55                   	push   %rbp
+  804198:	48 89 e5             	mov    %rsp,%rbp
+  80419b:	48 83 ec 28          	sub    $0x28,%rsp
+  80419f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041af:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041b3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041ba:	00 
+  8041bb:	eb 2a                	jmp    8041e7 <strncpy+0x50>
+    *dst++ = *src;
+  8041bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041cd:	0f b6 12             	movzbl (%rdx),%edx
+  8041d0:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d6:	0f b6 00             	movzbl (%rax),%eax
+  8041d9:	84 c0                	test   %al,%al
+  8041db:	74 05                	je     8041e2 <strncpy+0x4b>
+      src++;
+  8041dd:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041e2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041eb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041ef:	72 cc                	jb     8041bd <strncpy+0x26>
+  return ret;
+  8041f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8041f5:	c9                   	leave
+  8041f6:	c3                   	ret
+
+00000000008041f7 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8041f7:	55                   	push   %rbp
+  8041f8:	48 89 e5             	mov    %rsp,%rbp
+  8041fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8041ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804203:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804207:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80420b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80420f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804213:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804218:	74 3d                	je     804257 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80421a:	eb 1d                	jmp    804239 <strlcpy+0x42>
+      *dst++ = *src++;
+  80421c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804220:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804224:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804228:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804230:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804234:	0f b6 12             	movzbl (%rdx),%edx
+  804237:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804239:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80423e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804243:	74 0b                	je     804250 <strlcpy+0x59>
+  804245:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804249:	0f b6 00             	movzbl (%rax),%eax
+  80424c:	84 c0                	test   %al,%al
+  80424e:	75 cc                	jne    80421c <strlcpy+0x25>
+    *dst = '\0';
+  804250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804254:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  804257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80425b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80425f:	c9                   	leave
+  804260:	c3                   	ret
+
+0000000000804261 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804261:	55                   	push   %rbp
+  804262:	48 89 e5             	mov    %rsp,%rbp
+  804265:	48 83 ec 30          	sub    $0x30,%rsp
+  804269:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80426d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804271:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  804275:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804279:	48 89 c7             	mov    %rax,%rdi
+  80427c:	48 b8 04 40 80 00 00 	movabs $0x804004,%rax
+  804283:	00 00 00 
+  804286:	ff d0                	call   *%rax
+  804288:	48 98                	cltq
+  80428a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80428e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804292:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804296:	48 89 d6             	mov    %rdx,%rsi
+  804299:	48 89 c7             	mov    %rax,%rdi
+  80429c:	48 b8 c7 40 80 00 00 	movabs $0x8040c7,%rax
+  8042a3:	00 00 00 
+  8042a6:	ff d0                	call   *%rax
+  8042a8:	48 98                	cltq
+  8042aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042b2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042b6:	75 10                	jne    8042c8 <strlcat+0x67>
+    return maxlen + srclen;
+  8042b8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042c0:	48 01 d0             	add    %rdx,%rax
+  8042c3:	e9 86 00 00 00       	jmp    80434e <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042cc:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042d0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042d4:	73 2b                	jae    804301 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042da:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042e6:	48 01 c1             	add    %rax,%rcx
+  8042e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042ed:	48 89 c6             	mov    %rax,%rsi
+  8042f0:	48 89 cf             	mov    %rcx,%rdi
+  8042f3:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  8042fa:	00 00 00 
+  8042fd:	ff d0                	call   *%rax
+  8042ff:	eb 42                	jmp    804343 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804301:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804305:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804309:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80430d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804311:	48 01 c1             	add    %rax,%rcx
+  804314:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804318:	48 89 c6             	mov    %rax,%rsi
+  80431b:	48 89 cf             	mov    %rcx,%rdi
+  80431e:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80432a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80432e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804332:	48 01 d0             	add    %rdx,%rax
+  804335:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804339:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80433d:	48 01 d0             	add    %rdx,%rax
+  804340:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  804343:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80434b:	48 01 d0             	add    %rdx,%rax
+}
+  80434e:	c9                   	leave
+  80434f:	c3                   	ret
+
+0000000000804350 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804350:	55                   	push   %rbp
+  804351:	48 89 e5             	mov    %rsp,%rbp
+  804354:	48 83 ec 10          	sub    $0x10,%rsp
+  804358:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80435c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804360:	eb 0a                	jmp    80436c <strcmp+0x1c>
+    p++, q++;
+  804362:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804367:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80436c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804370:	0f b6 00             	movzbl (%rax),%eax
+  804373:	84 c0                	test   %al,%al
+  804375:	74 12                	je     804389 <strcmp+0x39>
+  804377:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80437b:	0f b6 10             	movzbl (%rax),%edx
+  80437e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804382:	0f b6 00             	movzbl (%rax),%eax
+  804385:	38 c2                	cmp    %al,%dl
+  804387:	74 d9                	je     804362 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  804389:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80438d:	0f b6 00             	movzbl (%rax),%eax
+  804390:	0f b6 d0             	movzbl %al,%edx
+  804393:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804397:	0f b6 00             	movzbl (%rax),%eax
+  80439a:	0f b6 c0             	movzbl %al,%eax
+  80439d:	29 c2                	sub    %eax,%edx
+  80439f:	89 d0                	mov    %edx,%eax
+}
+  8043a1:	c9                   	leave
+  8043a2:	c3                   	ret
+
+00000000008043a3 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043a3:	55                   	push   %rbp
+  8043a4:	48 89 e5             	mov    %rsp,%rbp
+  8043a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8043ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043b3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043b7:	eb 0f                	jmp    8043c8 <strncmp+0x25>
+    n--, p++, q++;
+  8043b9:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043c3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043c8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043cd:	74 1d                	je     8043ec <strncmp+0x49>
+  8043cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d3:	0f b6 00             	movzbl (%rax),%eax
+  8043d6:	84 c0                	test   %al,%al
+  8043d8:	74 12                	je     8043ec <strncmp+0x49>
+  8043da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043de:	0f b6 10             	movzbl (%rax),%edx
+  8043e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e5:	0f b6 00             	movzbl (%rax),%eax
+  8043e8:	38 c2                	cmp    %al,%dl
+  8043ea:	74 cd                	je     8043b9 <strncmp+0x16>
+  if (n == 0)
+  8043ec:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043f1:	75 07                	jne    8043fa <strncmp+0x57>
+    return 0;
+  8043f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043f8:	eb 16                	jmp    804410 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8043fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043fe:	0f b6 00             	movzbl (%rax),%eax
+  804401:	0f b6 d0             	movzbl %al,%edx
+  804404:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804408:	0f b6 00             	movzbl (%rax),%eax
+  80440b:	0f b6 c0             	movzbl %al,%eax
+  80440e:	29 c2                	sub    %eax,%edx
+}
+  804410:	89 d0                	mov    %edx,%eax
+  804412:	c9                   	leave
+  804413:	c3                   	ret
+
+0000000000804414 <strchr>:
+strchr(const char *s, char c) {
+  804414:	55                   	push   %rbp
+  804415:	48 89 e5             	mov    %rsp,%rbp
+  804418:	48 83 ec 60          	sub    $0x60,%rsp
+  80441c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804420:	89 f0                	mov    %esi,%eax
+  804422:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804425:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804429:	83 e0 0f             	and    $0xf,%eax
+  80442c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80442f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804432:	48 f7 d8             	neg    %rax
+  804435:	48 89 c2             	mov    %rax,%rdx
+  804438:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80443c:	48 01 d0             	add    %rdx,%rax
+  80443f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  804443:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804447:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80444b:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80444f:	66 0f 6e c0          	movd   %eax,%xmm0
+  804453:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804457:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80445b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804460:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  804464:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804468:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80446c:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804470:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804475:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80447a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80447e:	89 c2                	mov    %eax,%edx
+  804480:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804485:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80448a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80448e:	09 c2                	or     %eax,%edx
+  804490:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804493:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804498:	89 c1                	mov    %eax,%ecx
+  80449a:	d3 e6                	shl    %cl,%esi
+  80449c:	89 f0                	mov    %esi,%eax
+  80449e:	21 d0                	and    %edx,%eax
+  8044a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044a3:	eb 34                	jmp    8044d9 <strchr+0xc5>
+    p += 16;
+  8044a5:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044ae:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044b2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044b6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044bb:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044c0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044c4:	89 c2                	mov    %eax,%edx
+  8044c6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044cb:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044d0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044d4:	09 d0                	or     %edx,%eax
+  8044d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044dd:	74 c6                	je     8044a5 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044df:	31 c0                	xor    %eax,%eax
+  8044e1:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044e6:	48 98                	cltq
+  8044e8:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f0:	0f b6 00             	movzbl (%rax),%eax
+  8044f3:	84 c0                	test   %al,%al
+  8044f5:	74 06                	je     8044fd <strchr+0xe9>
+  8044f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044fb:	eb 05                	jmp    804502 <strchr+0xee>
+  8044fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804502:	c9                   	leave
+  804503:	c3                   	ret
+
+0000000000804504 <strfind>:
+strfind(const char *s, char c) {
+  804504:	55                   	push   %rbp
+  804505:	48 89 e5             	mov    %rsp,%rbp
+  804508:	48 83 ec 10          	sub    $0x10,%rsp
+  80450c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804510:	89 f0                	mov    %esi,%eax
+  804512:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804515:	eb 11                	jmp    804528 <strfind+0x24>
+    if (*s == c)
+  804517:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80451b:	0f b6 00             	movzbl (%rax),%eax
+  80451e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804521:	74 12                	je     804535 <strfind+0x31>
+  for (; *s; s++)
+  804523:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804528:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80452c:	0f b6 00             	movzbl (%rax),%eax
+  80452f:	84 c0                	test   %al,%al
+  804531:	75 e4                	jne    804517 <strfind+0x13>
+  804533:	eb 01                	jmp    804536 <strfind+0x32>
+      break;
+  804535:	90                   	nop
+  return (char *)s;
+  804536:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80453a:	c9                   	leave
+  80453b:	c3                   	ret
+
+000000000080453c <memset>:
+memset(void *v, int c, size_t n) {
+  80453c:	55                   	push   %rbp
+  80453d:	48 89 e5             	mov    %rsp,%rbp
+  804540:	48 83 ec 38          	sub    $0x38,%rsp
+  804544:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804548:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80454b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80454f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804553:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804557:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80455c:	76 41                	jbe    80459f <memset+0x63>
+  80455e:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  804565:	00 00 00 
+  804568:	ff d0                	call   *%rax
+  80456a:	83 e0 01             	and    $0x1,%eax
+  80456d:	85 c0                	test   %eax,%eax
+  80456f:	74 2e                	je     80459f <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804571:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804574:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804578:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80457c:	48 89 ce             	mov    %rcx,%rsi
+  80457f:	48 89 f7             	mov    %rsi,%rdi
+  804582:	48 89 d1             	mov    %rdx,%rcx
+  804585:	fc                   	cld
+  804586:	f3 aa                	rep stos %al,%es:(%rdi)
+  804588:	48 89 ca             	mov    %rcx,%rdx
+  80458b:	48 89 fe             	mov    %rdi,%rsi
+  80458e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804592:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  804596:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80459a:	e9 a7 00 00 00       	jmp    804646 <memset+0x10a>
+  if (n >= 8) {
+  80459f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045a4:	0f 86 87 00 00 00    	jbe    804631 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045aa:	eb 16                	jmp    8045c2 <memset+0x86>
+      *p++ = c;
+  8045ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045b4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045b8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045bb:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045bd:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c6:	83 e0 07             	and    $0x7,%eax
+  8045c9:	48 85 c0             	test   %rax,%rax
+  8045cc:	75 de                	jne    8045ac <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045ce:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045d1:	0f b6 c0             	movzbl %al,%eax
+  8045d4:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045db:	01 01 01 
+  8045de:	48 0f af c2          	imul   %rdx,%rax
+  8045e2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045ea:	48 c1 e8 03          	shr    $0x3,%rax
+  8045ee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045fe:	48 89 ce             	mov    %rcx,%rsi
+  804601:	48 89 f7             	mov    %rsi,%rdi
+  804604:	48 89 d1             	mov    %rdx,%rcx
+  804607:	fc                   	cld
+  804608:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80460b:	48 89 ca             	mov    %rcx,%rdx
+  80460e:	48 89 fe             	mov    %rdi,%rsi
+  804611:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804615:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804619:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  80461e:	eb 11                	jmp    804631 <memset+0xf5>
+    *p++ = c;
+  804620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804624:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804628:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80462c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80462f:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804631:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804635:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804639:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80463d:	48 85 c0             	test   %rax,%rax
+  804640:	75 de                	jne    804620 <memset+0xe4>
+  return v;
+  804642:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804646:	c9                   	leave
+  804647:	c3                   	ret
+
+0000000000804648 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  804648:	55                   	push   %rbp
+  804649:	48 89 e5             	mov    %rsp,%rbp
+  80464c:	48 83 ec 38          	sub    $0x38,%rsp
+  804650:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804654:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804658:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80465c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804660:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  804664:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804668:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80466c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804670:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804674:	0f 83 da 00 00 00    	jae    804754 <memmove+0x10c>
+  80467a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80467e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804682:	48 01 d0             	add    %rdx,%rax
+  804685:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804689:	0f 83 c5 00 00 00    	jae    804754 <memmove+0x10c>
+    s += n;
+  80468f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804693:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  804697:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80469b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80469f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046a4:	0f 86 94 00 00 00    	jbe    80473e <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046aa:	eb 1c                	jmp    8046c8 <memmove+0x80>
+        *--d = *--s;
+  8046ac:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046b1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046ba:	0f b6 10             	movzbl (%rax),%edx
+  8046bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c1:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046c3:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046cc:	83 e0 07             	and    $0x7,%eax
+  8046cf:	48 85 c0             	test   %rax,%rax
+  8046d2:	75 d8                	jne    8046ac <memmove+0x64>
+      nq = n / 8;
+  8046d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046d8:	48 c1 e8 03          	shr    $0x3,%rax
+  8046dc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046e0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046e5:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046ea:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046fb:	48 89 cf             	mov    %rcx,%rdi
+  8046fe:	48 89 d6             	mov    %rdx,%rsi
+  804701:	48 89 c1             	mov    %rax,%rcx
+  804704:	fd                   	std
+  804705:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804708:	fc                   	cld
+  804709:	48 89 c8             	mov    %rcx,%rax
+  80470c:	48 89 f2             	mov    %rsi,%rdx
+  80470f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804713:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804717:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80471b:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804720:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804725:	eb 17                	jmp    80473e <memmove+0xf6>
+      *--d = *--s;
+  804727:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80472c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804731:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804735:	0f b6 10             	movzbl (%rax),%edx
+  804738:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80473c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80473e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804742:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804746:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80474a:	48 85 c0             	test   %rax,%rax
+  80474d:	75 d8                	jne    804727 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80474f:	e9 f4 00 00 00       	jmp    804848 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804754:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804759:	76 46                	jbe    8047a1 <memmove+0x159>
+  80475b:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  804762:	00 00 00 
+  804765:	ff d0                	call   *%rax
+  804767:	83 e0 01             	and    $0x1,%eax
+  80476a:	85 c0                	test   %eax,%eax
+  80476c:	74 33                	je     8047a1 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80476e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804772:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804776:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80477a:	48 89 cf             	mov    %rcx,%rdi
+  80477d:	48 89 d6             	mov    %rdx,%rsi
+  804780:	48 89 c1             	mov    %rax,%rcx
+  804783:	fc                   	cld
+  804784:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804786:	48 89 c8             	mov    %rcx,%rax
+  804789:	48 89 f2             	mov    %rsi,%rdx
+  80478c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804790:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804794:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  804798:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80479c:	e9 ab 00 00 00       	jmp    80484c <memmove+0x204>
+    if (n >= 8) {
+  8047a1:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047a6:	0f 86 8b 00 00 00    	jbe    804837 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047ac:	eb 22                	jmp    8047d0 <memmove+0x188>
+        *d++ = *s++;
+  8047ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047b2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047be:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047c2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047c6:	0f b6 12             	movzbl (%rdx),%edx
+  8047c9:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047cb:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d4:	83 e0 07             	and    $0x7,%eax
+  8047d7:	48 85 c0             	test   %rax,%rax
+  8047da:	75 d2                	jne    8047ae <memmove+0x166>
+      nq = n / 8;
+  8047dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047e0:	48 c1 e8 03          	shr    $0x3,%rax
+  8047e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f4:	48 89 cf             	mov    %rcx,%rdi
+  8047f7:	48 89 d6             	mov    %rdx,%rsi
+  8047fa:	48 89 c1             	mov    %rax,%rcx
+  8047fd:	fc                   	cld
+  8047fe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804801:	48 89 c8             	mov    %rcx,%rax
+  804804:	48 89 f2             	mov    %rsi,%rdx
+  804807:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80480b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80480f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804813:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804818:	eb 1d                	jmp    804837 <memmove+0x1ef>
+      *d++ = *s++;
+  80481a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80481e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804822:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804826:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80482a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80482e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804832:	0f b6 12             	movzbl (%rdx),%edx
+  804835:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804837:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80483b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80483f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804843:	48 85 c0             	test   %rax,%rax
+  804846:	75 d2                	jne    80481a <memmove+0x1d2>
+  return dst;
+  804848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80484c:	c9                   	leave
+  80484d:	c3                   	ret
+
+000000000080484e <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80484e:	55                   	push   %rbp
+  80484f:	48 89 e5             	mov    %rsp,%rbp
+  804852:	48 83 ec 18          	sub    $0x18,%rsp
+  804856:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80485a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80485e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804862:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804866:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80486a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80486e:	48 89 ce             	mov    %rcx,%rsi
+  804871:	48 89 c7             	mov    %rax,%rdi
+  804874:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  80487b:	00 00 00 
+  80487e:	ff d0                	call   *%rax
+}
+  804880:	c9                   	leave
+  804881:	c3                   	ret
+
+0000000000804882 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804882:	55                   	push   %rbp
+  804883:	48 89 e5             	mov    %rsp,%rbp
+  804886:	48 83 ec 40          	sub    $0x40,%rsp
+  80488a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80488e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804892:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  804896:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80489a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80489e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048a6:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048ab:	0f 86 a7 00 00 00    	jbe    804958 <memcmp+0xd6>
+  8048b1:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  8048b8:	00 00 00 
+  8048bb:	ff d0                	call   *%rax
+  8048bd:	83 e0 02             	and    $0x2,%eax
+  8048c0:	85 c0                	test   %eax,%eax
+  8048c2:	0f 84 90 00 00 00    	je     804958 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048c8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048d4:	48 89 ce             	mov    %rcx,%rsi
+  8048d7:	48 89 c7             	mov    %rax,%rdi
+  8048da:	48 b8 69 3e 80 00 00 	movabs $0x803e69,%rax
+  8048e1:	00 00 00 
+  8048e4:	ff d0                	call   *%rax
+  8048e6:	e9 c2 00 00 00       	jmp    8049ad <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ef:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048f3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8048f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048fb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048ff:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804903:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804907:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80490a:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804911:	74 36                	je     804949 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804916:	f7 d0                	not    %eax
+  804918:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80491c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80491f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804922:	48 63 d0             	movslq %eax,%rdx
+  804925:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804929:	48 01 d0             	add    %rdx,%rax
+  80492c:	0f b6 00             	movzbl (%rax),%eax
+  80492f:	0f b6 c0             	movzbl %al,%eax
+  804932:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804935:	48 63 ca             	movslq %edx,%rcx
+  804938:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80493c:	48 01 ca             	add    %rcx,%rdx
+  80493f:	0f b6 12             	movzbl (%rdx),%edx
+  804942:	0f b6 d2             	movzbl %dl,%edx
+  804945:	29 d0                	sub    %edx,%eax
+  804947:	eb 64                	jmp    8049ad <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804949:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  80494e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804953:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  804958:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  80495d:	77 8c                	ja     8048eb <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80495f:	eb 36                	jmp    804997 <memcmp+0x115>
+    if (*s1 != *s2)
+  804961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804965:	0f b6 10             	movzbl (%rax),%edx
+  804968:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80496c:	0f b6 00             	movzbl (%rax),%eax
+  80496f:	38 c2                	cmp    %al,%dl
+  804971:	74 1a                	je     80498d <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804977:	0f b6 00             	movzbl (%rax),%eax
+  80497a:	0f b6 c8             	movzbl %al,%ecx
+  80497d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804981:	0f b6 00             	movzbl (%rax),%eax
+  804984:	0f b6 d0             	movzbl %al,%edx
+  804987:	89 c8                	mov    %ecx,%eax
+  804989:	29 d0                	sub    %edx,%eax
+  80498b:	eb 20                	jmp    8049ad <memcmp+0x12b>
+    s1++, s2++;
+  80498d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804992:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  804997:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80499b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80499f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049a3:	48 85 c0             	test   %rax,%rax
+  8049a6:	75 b9                	jne    804961 <memcmp+0xdf>
+  }
+
+  return 0;
+  8049a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049ad:	c9                   	leave
+  8049ae:	c3                   	ret
+
+00000000008049af <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049af:	55                   	push   %rbp
+  8049b0:	48 89 e5             	mov    %rsp,%rbp
+  8049b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8049b7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049bb:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049be:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049c2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049c6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049ca:	48 01 d0             	add    %rdx,%rax
+  8049cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049d4:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049d8:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049dc:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049e0:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049e5:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049e9:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049ee:	76 73                	jbe    804a63 <memfind+0xb4>
+  8049f0:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  8049f7:	00 00 00 
+  8049fa:	ff d0                	call   *%rax
+  8049fc:	83 e0 02             	and    $0x2,%eax
+  8049ff:	85 c0                	test   %eax,%eax
+  804a01:	74 60                	je     804a63 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a03:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a06:	0f b6 c8             	movzbl %al,%ecx
+  804a09:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a11:	89 ce                	mov    %ecx,%esi
+  804a13:	48 89 c7             	mov    %rax,%rdi
+  804a16:	48 b8 58 3f 80 00 00 	movabs $0x803f58,%rax
+  804a1d:	00 00 00 
+  804a20:	ff d0                	call   *%rax
+  804a22:	eb 6c                	jmp    804a90 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a28:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a2c:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a30:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a35:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a39:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a3d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a40:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a44:	74 13                	je     804a59 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a46:	31 c0                	xor    %eax,%eax
+  804a48:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a4d:	48 63 d0             	movslq %eax,%rdx
+  804a50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a54:	48 01 d0             	add    %rdx,%rax
+  804a57:	eb 37                	jmp    804a90 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a59:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a5e:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a63:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a68:	77 ba                	ja     804a24 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a6a:	eb 13                	jmp    804a7f <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a70:	0f b6 00             	movzbl (%rax),%eax
+  804a73:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a76:	38 d0                	cmp    %dl,%al
+  804a78:	74 11                	je     804a8b <memfind+0xdc>
+  for (; s < ends; s++)
+  804a7a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a83:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a87:	72 e3                	jb     804a6c <memfind+0xbd>
+  804a89:	eb 01                	jmp    804a8c <memfind+0xdd>
+      break;
+  804a8b:	90                   	nop
+  return (void *)s;
+  804a8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a90:	c9                   	leave
+  804a91:	c3                   	ret
+
+0000000000804a92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a92:	55                   	push   %rbp
+  804a93:	48 89 e5             	mov    %rsp,%rbp
+  804a96:	48 83 ec 38          	sub    $0x38,%rsp
+  804a9a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a9e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804aa2:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804aa5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804aac:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ab3:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804ab4:	eb 05                	jmp    804abb <strtol+0x29>
+    s++;
+  804ab6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804abb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804abf:	0f b6 00             	movzbl (%rax),%eax
+  804ac2:	3c 20                	cmp    $0x20,%al
+  804ac4:	74 f0                	je     804ab6 <strtol+0x24>
+  804ac6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aca:	0f b6 00             	movzbl (%rax),%eax
+  804acd:	3c 09                	cmp    $0x9,%al
+  804acf:	74 e5                	je     804ab6 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ad1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad5:	0f b6 00             	movzbl (%rax),%eax
+  804ad8:	3c 2b                	cmp    $0x2b,%al
+  804ada:	75 07                	jne    804ae3 <strtol+0x51>
+    s++;
+  804adc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ae1:	eb 17                	jmp    804afa <strtol+0x68>
+  else if (*s == '-')
+  804ae3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae7:	0f b6 00             	movzbl (%rax),%eax
+  804aea:	3c 2d                	cmp    $0x2d,%al
+  804aec:	75 0c                	jne    804afa <strtol+0x68>
+    s++, neg = 1;
+  804aee:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804af3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804afa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804afe:	74 06                	je     804b06 <strtol+0x74>
+  804b00:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b04:	75 28                	jne    804b2e <strtol+0x9c>
+  804b06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0a:	0f b6 00             	movzbl (%rax),%eax
+  804b0d:	3c 30                	cmp    $0x30,%al
+  804b0f:	75 1d                	jne    804b2e <strtol+0x9c>
+  804b11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b15:	48 83 c0 01          	add    $0x1,%rax
+  804b19:	0f b6 00             	movzbl (%rax),%eax
+  804b1c:	3c 78                	cmp    $0x78,%al
+  804b1e:	75 0e                	jne    804b2e <strtol+0x9c>
+    s += 2, base = 16;
+  804b20:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b25:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b2c:	eb 2c                	jmp    804b5a <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b2e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b32:	75 19                	jne    804b4d <strtol+0xbb>
+  804b34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b38:	0f b6 00             	movzbl (%rax),%eax
+  804b3b:	3c 30                	cmp    $0x30,%al
+  804b3d:	75 0e                	jne    804b4d <strtol+0xbb>
+    s++, base = 8;
+  804b3f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b44:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b4b:	eb 0d                	jmp    804b5a <strtol+0xc8>
+  else if (base == 0)
+  804b4d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b51:	75 07                	jne    804b5a <strtol+0xc8>
+    base = 10;
+  804b53:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b5e:	0f b6 00             	movzbl (%rax),%eax
+  804b61:	3c 2f                	cmp    $0x2f,%al
+  804b63:	7e 1d                	jle    804b82 <strtol+0xf0>
+  804b65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b69:	0f b6 00             	movzbl (%rax),%eax
+  804b6c:	3c 39                	cmp    $0x39,%al
+  804b6e:	7f 12                	jg     804b82 <strtol+0xf0>
+      dig = *s - '0';
+  804b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b74:	0f b6 00             	movzbl (%rax),%eax
+  804b77:	0f be c0             	movsbl %al,%eax
+  804b7a:	83 e8 30             	sub    $0x30,%eax
+  804b7d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b80:	eb 4e                	jmp    804bd0 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b86:	0f b6 00             	movzbl (%rax),%eax
+  804b89:	3c 60                	cmp    $0x60,%al
+  804b8b:	7e 1d                	jle    804baa <strtol+0x118>
+  804b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b91:	0f b6 00             	movzbl (%rax),%eax
+  804b94:	3c 7a                	cmp    $0x7a,%al
+  804b96:	7f 12                	jg     804baa <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b9c:	0f b6 00             	movzbl (%rax),%eax
+  804b9f:	0f be c0             	movsbl %al,%eax
+  804ba2:	83 e8 57             	sub    $0x57,%eax
+  804ba5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ba8:	eb 26                	jmp    804bd0 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804baa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bae:	0f b6 00             	movzbl (%rax),%eax
+  804bb1:	3c 40                	cmp    $0x40,%al
+  804bb3:	7e 47                	jle    804bfc <strtol+0x16a>
+  804bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb9:	0f b6 00             	movzbl (%rax),%eax
+  804bbc:	3c 5a                	cmp    $0x5a,%al
+  804bbe:	7f 3c                	jg     804bfc <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc4:	0f b6 00             	movzbl (%rax),%eax
+  804bc7:	0f be c0             	movsbl %al,%eax
+  804bca:	83 e8 37             	sub    $0x37,%eax
+  804bcd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bd3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bd6:	7d 23                	jge    804bfb <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bd8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bdd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804be0:	48 98                	cltq
+  804be2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804be7:	48 89 c2             	mov    %rax,%rdx
+  804bea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bed:	48 98                	cltq
+  804bef:	48 01 d0             	add    %rdx,%rax
+  804bf2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804bf6:	e9 5f ff ff ff       	jmp    804b5a <strtol+0xc8>
+      break;
+  804bfb:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804bfc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c01:	74 0b                	je     804c0e <strtol+0x17c>
+    *endptr = (char *)s;
+  804c03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c07:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c0b:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c0e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c12:	74 09                	je     804c1d <strtol+0x18b>
+  804c14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c18:	48 f7 d8             	neg    %rax
+  804c1b:	eb 04                	jmp    804c21 <strtol+0x18f>
+  804c1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c21:	c9                   	leave
+  804c22:	c3                   	ret
+
+0000000000804c23 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c23:	55                   	push   %rbp
+  804c24:	48 89 e5             	mov    %rsp,%rbp
+  804c27:	48 83 ec 20          	sub    $0x20,%rsp
+  804c2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c33:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c3b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c43:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c4a:	48 89 c7             	mov    %rax,%rdi
+  804c4d:	48 b8 5b 4c 80 00 00 	movabs $0x804c5b,%rax
+  804c54:	00 00 00 
+  804c57:	ff d0                	call   *%rax
+}
+  804c59:	c9                   	leave
+  804c5a:	c3                   	ret
+
+0000000000804c5b <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c5b:	55                   	push   %rbp
+  804c5c:	48 89 e5             	mov    %rsp,%rbp
+  804c5f:	48 83 ec 30          	sub    $0x30,%rsp
+  804c63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c6b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c6f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c73:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c78:	75 0e                	jne    804c88 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c7a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c81:	00 00 00 
+  804c84:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c88:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c8d:	75 18                	jne    804ca7 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c93:	48 89 c7             	mov    %rax,%rdi
+  804c96:	48 b8 e6 05 80 00 00 	movabs $0x8005e6,%rax
+  804c9d:	00 00 00 
+  804ca0:	ff d0                	call   *%rax
+  804ca2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ca5:	eb 1d                	jmp    804cc4 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804ca7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804caf:	48 89 d6             	mov    %rdx,%rsi
+  804cb2:	48 89 c7             	mov    %rax,%rdi
+  804cb5:	48 b8 2c 06 80 00 00 	movabs $0x80062c,%rax
+  804cbc:	00 00 00 
+  804cbf:	ff d0                	call   *%rax
+  804cc1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cc4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cc8:	79 2a                	jns    804cf4 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cca:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ccf:	74 0a                	je     804cdb <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cdb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ce0:	74 0a                	je     804cec <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804ce2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ce6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804cec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cef:	e9 aa 00 00 00       	jmp    804d9e <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804cf4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf9:	74 36                	je     804d31 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804cfb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d02:	00 00 00 
+  804d05:	8b 40 04             	mov    0x4(%rax),%eax
+  804d08:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d0d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d14:	00 00 00 
+  804d17:	48 98                	cltq
+  804d19:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d20:	48 01 d0             	add    %rdx,%rax
+  804d23:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d29:	8b 10                	mov    (%rax),%edx
+  804d2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d2f:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d31:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d36:	74 36                	je     804d6e <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d38:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d3f:	00 00 00 
+  804d42:	8b 40 04             	mov    0x4(%rax),%eax
+  804d45:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d4a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d51:	00 00 00 
+  804d54:	48 98                	cltq
+  804d56:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d5d:	48 01 d0             	add    %rdx,%rax
+  804d60:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d66:	8b 10                	mov    (%rax),%edx
+  804d68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d6c:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d6e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d75:	00 00 00 
+  804d78:	8b 40 04             	mov    0x4(%rax),%eax
+  804d7b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d80:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d87:	00 00 00 
+  804d8a:	48 98                	cltq
+  804d8c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d93:	48 01 d0             	add    %rdx,%rax
+  804d96:	48 05 20 01 00 00    	add    $0x120,%rax
+  804d9c:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804d9e:	c9                   	leave
+  804d9f:	c3                   	ret
+
+0000000000804da0 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804da0:	55                   	push   %rbp
+  804da1:	48 89 e5             	mov    %rsp,%rbp
+  804da4:	48 83 ec 30          	sub    $0x30,%rsp
+  804da8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dab:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804db2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804db5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dba:	75 5e                	jne    804e1a <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dbc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dc3:	00 00 00 
+  804dc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dca:	eb 4e                	jmp    804e1a <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dcc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dd0:	79 3c                	jns    804e0e <ipc_send+0x6e>
+  804dd2:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dd6:	74 36                	je     804e0e <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ddb:	89 c1                	mov    %eax,%ecx
+  804ddd:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804de4:	00 00 00 
+  804de7:	48 89 c2             	mov    %rax,%rdx
+  804dea:	be 54 00 00 00       	mov    $0x54,%esi
+  804def:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804df6:	00 00 00 
+  804df9:	48 89 c7             	mov    %rax,%rdi
+  804dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e01:	49 b8 36 2f 80 00 00 	movabs $0x802f36,%r8
+  804e08:	00 00 00 
+  804e0b:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e0e:	48 b8 69 03 80 00 00 	movabs $0x800369,%rax
+  804e15:	00 00 00 
+  804e18:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e1a:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e1d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e20:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e27:	89 c7                	mov    %eax,%edi
+  804e29:	48 b8 8f 05 80 00 00 	movabs $0x80058f,%rax
+  804e30:	00 00 00 
+  804e33:	ff d0                	call   *%rax
+  804e35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e38:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e3c:	75 8e                	jne    804dcc <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e3e:	48 b8 69 03 80 00 00 	movabs $0x800369,%rax
+  804e45:	00 00 00 
+  804e48:	ff d0                	call   *%rax
+}
+  804e4a:	90                   	nop
+  804e4b:	c9                   	leave
+  804e4c:	c3                   	ret
+
+0000000000804e4d <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e4d:	55                   	push   %rbp
+  804e4e:	48 89 e5             	mov    %rsp,%rbp
+  804e51:	48 83 ec 18          	sub    $0x18,%rsp
+  804e55:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e58:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e5f:	eb 4d                	jmp    804eae <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e61:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e68:	00 00 00 
+  804e6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e6e:	48 98                	cltq
+  804e70:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e77:	48 01 d0             	add    %rdx,%rax
+  804e7a:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e80:	8b 00                	mov    (%rax),%eax
+  804e82:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e85:	75 23                	jne    804eaa <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e87:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e8e:	00 00 00 
+  804e91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e94:	48 98                	cltq
+  804e96:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e9d:	48 01 d0             	add    %rdx,%rax
+  804ea0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ea6:	8b 00                	mov    (%rax),%eax
+  804ea8:	eb 12                	jmp    804ebc <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804eaa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804eae:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804eb5:	7e aa                	jle    804e61 <ipc_find_env+0x14>
+  return 0;
+  804eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ebc:	c9                   	leave
+  804ebd:	c3                   	ret
+
+0000000000804ebe <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ebe:	55                   	push   %rbp
+  804ebf:	48 89 e5             	mov    %rsp,%rbp
+  804ec2:	48 83 ec 18          	sub    $0x18,%rsp
+  804ec6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804eca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ece:	48 c1 e8 27          	shr    $0x27,%rax
+  804ed2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ed7:	48 89 c2             	mov    %rax,%rdx
+  804eda:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ee1:	01 00 00 
+  804ee4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ee8:	83 e0 01             	and    $0x1,%eax
+  804eeb:	48 85 c0             	test   %rax,%rax
+  804eee:	74 63                	je     804f53 <pageref+0x95>
+  804ef0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804ef8:	48 89 c2             	mov    %rax,%rdx
+  804efb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f02:	01 00 00 
+  804f05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f09:	83 e0 01             	and    $0x1,%eax
+  804f0c:	48 85 c0             	test   %rax,%rax
+  804f0f:	74 42                	je     804f53 <pageref+0x95>
+  804f11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f15:	48 c1 e8 15          	shr    $0x15,%rax
+  804f19:	48 89 c2             	mov    %rax,%rdx
+  804f1c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f23:	01 00 00 
+  804f26:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f2a:	83 e0 01             	and    $0x1,%eax
+  804f2d:	48 85 c0             	test   %rax,%rax
+  804f30:	74 21                	je     804f53 <pageref+0x95>
+  804f32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f36:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f3a:	48 89 c2             	mov    %rax,%rdx
+  804f3d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f44:	01 00 00 
+  804f47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f4b:	83 e0 01             	and    $0x1,%eax
+  804f4e:	48 85 c0             	test   %rax,%rax
+  804f51:	75 07                	jne    804f5a <pageref+0x9c>
+    return 0;
+  804f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f58:	eb 53                	jmp    804fad <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f62:	48 89 c2             	mov    %rax,%rdx
+  804f65:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f6c:	01 00 00 
+  804f6f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f73:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f7b:	83 e0 01             	and    $0x1,%eax
+  804f7e:	48 85 c0             	test   %rax,%rax
+  804f81:	75 07                	jne    804f8a <pageref+0xcc>
+    return 0;
+  804f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f88:	eb 23                	jmp    804fad <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f8e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f92:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804f99:	00 00 00 
+  804f9c:	48 c1 e0 04          	shl    $0x4,%rax
+  804fa0:	48 01 d0             	add    %rdx,%rax
+  804fa3:	48 83 c0 08          	add    $0x8,%rax
+  804fa7:	0f b7 00             	movzwl (%rax),%eax
+  804faa:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fad:	c9                   	leave
+  804fae:	c3                   	ret
+  804faf:	90                   	nop
@@ -0,0 +1,8041 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 28 00 00 00       	call   800054 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// buggy program - faults with a write to a kernel location
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  *(volatile unsigned *)0x8040000000 = 0;
+  800041:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800048:	00 00 00 
+  80004b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800051:	90                   	nop
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+0000000000800054 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800054:	55                   	push   %rbp
+  800055:	48 89 e5             	mov    %rsp,%rbp
+  800058:	48 83 ec 20          	sub    $0x20,%rsp
+  80005c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80005f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800063:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80006a:	00 00 00 
+  80006d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800071:	eb 13                	jmp    800086 <libmain+0x32>
+    (*ctor)();
+  800073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800077:	48 8b 10             	mov    (%rax),%rdx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff d2                	call   *%rdx
+    ctor++;
+  800081:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800086:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80008d:	00 00 00 
+  800090:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800094:	72 dd                	jb     800073 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800096:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80009a:	7e 14                	jle    8000b0 <libmain+0x5c>
+    binaryname = argv[0];
+  80009c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000a0:	48 8b 00             	mov    (%rax),%rax
+  8000a3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000aa:	00 00 00 
+  8000ad:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000b7:	48 89 d6             	mov    %rdx,%rsi
+  8000ba:	89 c7                	mov    %eax,%edi
+  8000bc:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000c8:	48 b8 d7 00 80 00 00 	movabs $0x8000d7,%rax
+  8000cf:	00 00 00 
+  8000d2:	ff d0                	call   *%rax
+#endif
+}
+  8000d4:	90                   	nop
+  8000d5:	c9                   	leave
+  8000d6:	c3                   	ret
+
+00000000008000d7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d7:	55                   	push   %rbp
+  8000d8:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000db:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  8000e2:	00 00 00 
+  8000e5:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ec:	48 b8 63 02 80 00 00 	movabs $0x800263,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+}
+  8000f8:	90                   	nop
+  8000f9:	5d                   	pop    %rbp
+  8000fa:	c3                   	ret
+
+00000000008000fb <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+  8000ff:	53                   	push   %rbx
+  800100:	48 83 ec 48          	sub    $0x48,%rsp
+  800104:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800108:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80010c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800110:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800114:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  800118:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80011c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800120:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800124:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800128:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80012c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800130:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800134:	4c 89 c3             	mov    %r8,%rbx
+  800137:	cd 30                	int    $0x30
+  800139:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80013d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800142:	74 46                	je     80018a <syscall+0x8f>
+  800144:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800149:	7e 3f                	jle    80018a <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80014b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80014f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800153:	49 89 d0             	mov    %rdx,%r8
+  800156:	48 89 c1             	mov    %rax,%rcx
+  800159:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  800160:	00 00 00 
+  800163:	48 89 c2             	mov    %rax,%rdx
+  800166:	be 22 00 00 00       	mov    $0x22,%esi
+  80016b:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800172:	00 00 00 
+  800175:	48 89 c7             	mov    %rax,%rdi
+  800178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017d:	49 b9 3b 2f 80 00 00 	movabs $0x802f3b,%r9
+  800184:	00 00 00 
+  800187:	41 ff d1             	call   *%r9
+
+  return ret;
+  80018a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80018e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800192:	c9                   	leave
+  800193:	c3                   	ret
+
+0000000000800194 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  800194:	55                   	push   %rbp
+  800195:	48 89 e5             	mov    %rsp,%rbp
+  800198:	48 83 ec 10          	sub    $0x10,%rsp
+  80019c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8001b0:	6a 00                	push   $0x0
+  8001b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001be:	48 89 d1             	mov    %rdx,%rcx
+  8001c1:	48 89 c2             	mov    %rax,%rdx
+  8001c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ce:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001de:	90                   	nop
+  8001df:	c9                   	leave
+  8001e0:	c3                   	ret
+
+00000000008001e1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001e1:	55                   	push   %rbp
+  8001e2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8001e9:	6a 00                	push   $0x0
+  8001eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800201:	be 00 00 00 00       	mov    $0x0,%esi
+  800206:	bf 01 00 00 00       	mov    $0x1,%edi
+  80020b:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800212:	00 00 00 
+  800215:	ff d0                	call   *%rax
+  800217:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+000000000080021d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	48 83 ec 10          	sub    $0x10,%rsp
+  800225:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800228:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80022b:	48 98                	cltq
+  80022d:	48 83 ec 08          	sub    $0x8,%rsp
+  800231:	6a 00                	push   $0x0
+  800233:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800244:	48 89 c2             	mov    %rax,%rdx
+  800247:	be 01 00 00 00       	mov    $0x1,%esi
+  80024c:	bf 03 00 00 00       	mov    $0x3,%edi
+  800251:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800258:	00 00 00 
+  80025b:	ff d0                	call   *%rax
+  80025d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800261:	c9                   	leave
+  800262:	c3                   	ret
+
+0000000000800263 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800263:	55                   	push   %rbp
+  800264:	48 89 e5             	mov    %rsp,%rbp
+  800267:	48 83 ec 10          	sub    $0x10,%rsp
+  80026b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80026e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800271:	48 98                	cltq
+  800273:	48 83 ec 08          	sub    $0x8,%rsp
+  800277:	6a 00                	push   $0x0
+  800279:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80027f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80028a:	48 89 c2             	mov    %rax,%rdx
+  80028d:	be 00 00 00 00       	mov    $0x0,%esi
+  800292:	bf 04 00 00 00       	mov    $0x4,%edi
+  800297:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+  8002a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002a7:	90                   	nop
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+
+00000000008002aa <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002aa:	55                   	push   %rbp
+  8002ab:	48 89 e5             	mov    %rsp,%rbp
+  8002ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8002b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002bc:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002bf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002c4:	cd 30                	int    $0x30
+  8002c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002ca:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002ce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002d3:	7e 3d                	jle    800312 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002d9:	49 89 c0             	mov    %rax,%r8
+  8002dc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002e1:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002e8:	00 00 00 
+  8002eb:	48 89 c2             	mov    %rax,%rdx
+  8002ee:	be 49 00 00 00       	mov    $0x49,%esi
+  8002f3:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  8002fa:	00 00 00 
+  8002fd:	48 89 c7             	mov    %rax,%rdi
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	49 b9 3b 2f 80 00 00 	movabs $0x802f3b,%r9
+  80030c:	00 00 00 
+  80030f:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800312:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800317:	75 13                	jne    80032c <sys_env_wait+0x82>
+  800319:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80031e:	74 0c                	je     80032c <sys_env_wait+0x82>
+    *status = st;
+  800320:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800324:	89 c2                	mov    %eax,%edx
+  800326:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80032a:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80032c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+
+0000000000800332 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800332:	55                   	push   %rbp
+  800333:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800336:	48 83 ec 08          	sub    $0x8,%rsp
+  80033a:	6a 00                	push   $0x0
+  80033c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800342:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800348:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80034d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800352:	be 00 00 00 00       	mov    $0x0,%esi
+  800357:	bf 02 00 00 00       	mov    $0x2,%edi
+  80035c:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+000000000080036e <sys_yield>:
+
+void
+sys_yield(void) {
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800372:	48 83 ec 08          	sub    $0x8,%rsp
+  800376:	6a 00                	push   $0x0
+  800378:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800384:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80038e:	be 00 00 00 00       	mov    $0x0,%esi
+  800393:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800398:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+  8003a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003a8:	90                   	nop
+  8003a9:	c9                   	leave
+  8003aa:	c3                   	ret
+
+00000000008003ab <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003ab:	55                   	push   %rbp
+  8003ac:	48 89 e5             	mov    %rsp,%rbp
+  8003af:	48 83 ec 20          	sub    $0x20,%rsp
+  8003b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003ba:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003bd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003c0:	48 63 c8             	movslq %eax,%rcx
+  8003c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ca:	48 98                	cltq
+  8003cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d0:	6a 00                	push   $0x0
+  8003d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003d8:	49 89 c8             	mov    %rcx,%r8
+  8003db:	48 89 d1             	mov    %rdx,%rcx
+  8003de:	48 89 c2             	mov    %rax,%rdx
+  8003e1:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003eb:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8003f2:	00 00 00 
+  8003f5:	ff d0                	call   *%rax
+  8003f7:	48 83 c4 10          	add    $0x10,%rsp
+  8003fb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8003fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+
+0000000000800403 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800403:	55                   	push   %rbp
+  800404:	48 89 e5             	mov    %rsp,%rbp
+  800407:	48 83 ec 20          	sub    $0x20,%rsp
+  80040b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80040e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800412:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800415:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800419:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80041d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800420:	48 63 c8             	movslq %eax,%rcx
+  800423:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800427:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80042a:	48 63 f0             	movslq %eax,%rsi
+  80042d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800431:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800434:	48 98                	cltq
+  800436:	48 83 ec 08          	sub    $0x8,%rsp
+  80043a:	51                   	push   %rcx
+  80043b:	49 89 f9             	mov    %rdi,%r9
+  80043e:	49 89 f0             	mov    %rsi,%r8
+  800441:	48 89 d1             	mov    %rdx,%rcx
+  800444:	48 89 c2             	mov    %rax,%rdx
+  800447:	be 01 00 00 00       	mov    $0x1,%esi
+  80044c:	bf 07 00 00 00       	mov    $0x7,%edi
+  800451:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+  80045d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800461:	c9                   	leave
+  800462:	c3                   	ret
+
+0000000000800463 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+  800467:	48 83 ec 10          	sub    $0x10,%rsp
+  80046b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80046e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800472:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800476:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800479:	48 98                	cltq
+  80047b:	48 83 ec 08          	sub    $0x8,%rsp
+  80047f:	6a 00                	push   $0x0
+  800481:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800487:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80048d:	48 89 d1             	mov    %rdx,%rcx
+  800490:	48 89 c2             	mov    %rax,%rdx
+  800493:	be 01 00 00 00       	mov    $0x1,%esi
+  800498:	bf 08 00 00 00       	mov    $0x8,%edi
+  80049d:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8004a4:	00 00 00 
+  8004a7:	ff d0                	call   *%rax
+  8004a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004ad:	c9                   	leave
+  8004ae:	c3                   	ret
+
+00000000008004af <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004af:	55                   	push   %rbp
+  8004b0:	48 89 e5             	mov    %rsp,%rbp
+  8004b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8004b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004ba:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004bd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004c0:	48 63 d0             	movslq %eax,%rdx
+  8004c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004c6:	48 98                	cltq
+  8004c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8004cc:	6a 00                	push   $0x0
+  8004ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004da:	48 89 d1             	mov    %rdx,%rcx
+  8004dd:	48 89 c2             	mov    %rax,%rdx
+  8004e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8004e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004ea:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8004f1:	00 00 00 
+  8004f4:	ff d0                	call   *%rax
+  8004f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004fa:	c9                   	leave
+  8004fb:	c3                   	ret
+
+00000000008004fc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004fc:	55                   	push   %rbp
+  8004fd:	48 89 e5             	mov    %rsp,%rbp
+  800500:	48 83 ec 10          	sub    $0x10,%rsp
+  800504:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800507:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80050b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80050f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800512:	48 98                	cltq
+  800514:	48 83 ec 08          	sub    $0x8,%rsp
+  800518:	6a 00                	push   $0x0
+  80051a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800520:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800526:	48 89 d1             	mov    %rdx,%rcx
+  800529:	48 89 c2             	mov    %rax,%rdx
+  80052c:	be 01 00 00 00       	mov    $0x1,%esi
+  800531:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800536:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80053d:	00 00 00 
+  800540:	ff d0                	call   *%rax
+  800542:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800546:	c9                   	leave
+  800547:	c3                   	ret
+
+0000000000800548 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800548:	55                   	push   %rbp
+  800549:	48 89 e5             	mov    %rsp,%rbp
+  80054c:	48 83 ec 10          	sub    $0x10,%rsp
+  800550:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800553:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800557:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80055b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80055e:	48 98                	cltq
+  800560:	48 83 ec 08          	sub    $0x8,%rsp
+  800564:	6a 00                	push   $0x0
+  800566:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80056c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800572:	48 89 d1             	mov    %rdx,%rcx
+  800575:	48 89 c2             	mov    %rax,%rdx
+  800578:	be 01 00 00 00       	mov    $0x1,%esi
+  80057d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800582:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800589:	00 00 00 
+  80058c:	ff d0                	call   *%rax
+  80058e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800592:	c9                   	leave
+  800593:	c3                   	ret
+
+0000000000800594 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  800594:	55                   	push   %rbp
+  800595:	48 89 e5             	mov    %rsp,%rbp
+  800598:	48 83 ec 20          	sub    $0x20,%rsp
+  80059c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80059f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005a3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005a7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005aa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005ad:	48 63 f0             	movslq %eax,%rsi
+  8005b0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005b4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005bb:	48 98                	cltq
+  8005bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c1:	6a 00                	push   $0x0
+  8005c3:	49 89 f1             	mov    %rsi,%r9
+  8005c6:	49 89 c8             	mov    %rcx,%r8
+  8005c9:	48 89 d1             	mov    %rdx,%rcx
+  8005cc:	48 89 c2             	mov    %rax,%rdx
+  8005cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005d9:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8005e0:	00 00 00 
+  8005e3:	ff d0                	call   *%rax
+  8005e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005e9:	c9                   	leave
+  8005ea:	c3                   	ret
+
+00000000008005eb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005eb:	55                   	push   %rbp
+  8005ec:	48 89 e5             	mov    %rsp,%rbp
+  8005ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8005f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ff:	6a 00                	push   $0x0
+  800601:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80060d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800612:	48 89 c2             	mov    %rax,%rdx
+  800615:	be 01 00 00 00       	mov    $0x1,%esi
+  80061a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80061f:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800626:	00 00 00 
+  800629:	ff d0                	call   *%rax
+  80062b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80062f:	c9                   	leave
+  800630:	c3                   	ret
+
+0000000000800631 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  800635:	48 83 ec 10          	sub    $0x10,%rsp
+  800639:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80063d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800641:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800649:	48 83 ec 08          	sub    $0x8,%rsp
+  80064d:	6a 00                	push   $0x0
+  80064f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800655:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80065b:	48 89 d1             	mov    %rdx,%rcx
+  80065e:	48 89 c2             	mov    %rax,%rdx
+  800661:	be 01 00 00 00       	mov    $0x1,%esi
+  800666:	bf 10 00 00 00       	mov    $0x10,%edi
+  80066b:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800672:	00 00 00 
+  800675:	ff d0                	call   *%rax
+  800677:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80067b:	c9                   	leave
+  80067c:	c3                   	ret
+
+000000000080067d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80067d:	55                   	push   %rbp
+  80067e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800681:	48 83 ec 08          	sub    $0x8,%rsp
+  800685:	6a 00                	push   $0x0
+  800687:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80068d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800693:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80069d:	be 00 00 00 00       	mov    $0x0,%esi
+  8006a2:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006a7:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8006ae:	00 00 00 
+  8006b1:	ff d0                	call   *%rax
+  8006b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006b7:	c9                   	leave
+  8006b8:	c3                   	ret
+
+00000000008006b9 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006b9:	55                   	push   %rbp
+  8006ba:	48 89 e5             	mov    %rsp,%rbp
+  8006bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8006c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d5:	6a 00                	push   $0x0
+  8006d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006e3:	48 89 d1             	mov    %rdx,%rcx
+  8006e6:	48 89 c2             	mov    %rax,%rdx
+  8006e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ee:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006f3:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8006fa:	00 00 00 
+  8006fd:	ff d0                	call   *%rax
+  8006ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+
+0000000000800705 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	48 83 ec 20          	sub    $0x20,%rsp
+  80070d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800711:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800715:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  800718:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80071b:	48 63 c8             	movslq %eax,%rcx
+  80071e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800722:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800726:	48 83 ec 08          	sub    $0x8,%rsp
+  80072a:	6a 00                	push   $0x0
+  80072c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800732:	49 89 c8             	mov    %rcx,%r8
+  800735:	48 89 d1             	mov    %rdx,%rcx
+  800738:	48 89 c2             	mov    %rax,%rdx
+  80073b:	be 00 00 00 00       	mov    $0x0,%esi
+  800740:	bf 13 00 00 00       	mov    $0x13,%edi
+  800745:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80074c:	00 00 00 
+  80074f:	ff d0                	call   *%rax
+  800751:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800755:	c9                   	leave
+  800756:	c3                   	ret
+
+0000000000800757 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800757:	55                   	push   %rbp
+  800758:	48 89 e5             	mov    %rsp,%rbp
+  80075b:	48 83 ec 20          	sub    $0x20,%rsp
+  80075f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800763:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800766:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80076a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80076e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800771:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800775:	48 83 ec 08          	sub    $0x8,%rsp
+  800779:	6a 00                	push   $0x0
+  80077b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800781:	49 89 c8             	mov    %rcx,%r8
+  800784:	48 89 d1             	mov    %rdx,%rcx
+  800787:	48 89 c2             	mov    %rax,%rdx
+  80078a:	be 00 00 00 00       	mov    $0x0,%esi
+  80078f:	bf 14 00 00 00       	mov    $0x14,%edi
+  800794:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80079b:	00 00 00 
+  80079e:	ff d0                	call   *%rax
+  8007a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+00000000008007a6 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8007ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007b2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007b8:	48 63 d0             	movslq %eax,%rdx
+  8007bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8007c3:	6a 00                	push   $0x0
+  8007c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007d1:	48 89 d1             	mov    %rdx,%rcx
+  8007d4:	48 89 c2             	mov    %rax,%rdx
+  8007d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8007dc:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007e1:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8007e8:	00 00 00 
+  8007eb:	ff d0                	call   *%rax
+  8007ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007f1:	c9                   	leave
+  8007f2:	c3                   	ret
+
+00000000008007f3 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007f3:	55                   	push   %rbp
+  8007f4:	48 89 e5             	mov    %rsp,%rbp
+  8007f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8007fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007ff:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800802:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800805:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  800809:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80080d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800810:	48 63 c8             	movslq %eax,%rcx
+  800813:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800816:	48 63 d0             	movslq %eax,%rdx
+  800819:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081d:	48 83 ec 08          	sub    $0x8,%rsp
+  800821:	6a 00                	push   $0x0
+  800823:	49 89 f1             	mov    %rsi,%r9
+  800826:	49 89 c8             	mov    %rcx,%r8
+  800829:	48 89 d1             	mov    %rdx,%rcx
+  80082c:	48 89 c2             	mov    %rax,%rdx
+  80082f:	be 00 00 00 00       	mov    $0x0,%esi
+  800834:	bf 16 00 00 00       	mov    $0x16,%edi
+  800839:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800840:	00 00 00 
+  800843:	ff d0                	call   *%rax
+  800845:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+
+000000000080084b <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80084b:	55                   	push   %rbp
+  80084c:	48 89 e5             	mov    %rsp,%rbp
+  80084f:	48 83 ec 30          	sub    $0x30,%rsp
+  800853:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800857:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80085b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80085f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800863:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800867:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80086b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80086f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800873:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800877:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087b:	48 83 ec 08          	sub    $0x8,%rsp
+  80087f:	51                   	push   %rcx
+  800880:	49 89 f9             	mov    %rdi,%r9
+  800883:	49 89 f0             	mov    %rsi,%r8
+  800886:	48 89 d1             	mov    %rdx,%rcx
+  800889:	48 89 c2             	mov    %rax,%rdx
+  80088c:	be 00 00 00 00       	mov    $0x0,%esi
+  800891:	bf 17 00 00 00       	mov    $0x17,%edi
+  800896:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80089d:	00 00 00 
+  8008a0:	ff d0                	call   *%rax
+  8008a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008a6:	c9                   	leave
+  8008a7:	c3                   	ret
+
+00000000008008a8 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008a8:	55                   	push   %rbp
+  8008a9:	48 89 e5             	mov    %rsp,%rbp
+  8008ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8008b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008b6:	48 98                	cltq
+  8008b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8008bc:	6a 00                	push   $0x0
+  8008be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cf:	48 89 c2             	mov    %rax,%rdx
+  8008d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8008d7:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008dc:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8008e3:	00 00 00 
+  8008e6:	ff d0                	call   *%rax
+  8008e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008ec:	90                   	nop
+  8008ed:	c9                   	leave
+  8008ee:	c3                   	ret
+
+00000000008008ef <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008ef:	55                   	push   %rbp
+  8008f0:	48 89 e5             	mov    %rsp,%rbp
+  8008f3:	48 83 ec 30          	sub    $0x30,%rsp
+  8008f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008fa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008fe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800902:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800905:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800908:	48 63 f0             	movslq %eax,%rsi
+  80090b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80090f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800916:	48 98                	cltq
+  800918:	48 83 ec 08          	sub    $0x8,%rsp
+  80091c:	6a 00                	push   $0x0
+  80091e:	49 89 f1             	mov    %rsi,%r9
+  800921:	49 89 c8             	mov    %rcx,%r8
+  800924:	48 89 d1             	mov    %rdx,%rcx
+  800927:	48 89 c2             	mov    %rax,%rdx
+  80092a:	be 01 00 00 00       	mov    $0x1,%esi
+  80092f:	bf 19 00 00 00       	mov    $0x19,%edi
+  800934:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  80093b:	00 00 00 
+  80093e:	ff d0                	call   *%rax
+  800940:	48 83 c4 10          	add    $0x10,%rsp
+  800944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800947:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+
+000000000080094c <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80094c:	55                   	push   %rbp
+  80094d:	48 89 e5             	mov    %rsp,%rbp
+  800950:	48 83 ec 20          	sub    $0x20,%rsp
+  800954:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800958:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80095c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80095f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800962:	48 63 c8             	movslq %eax,%rcx
+  800965:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80096d:	48 83 ec 08          	sub    $0x8,%rsp
+  800971:	6a 00                	push   $0x0
+  800973:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800979:	49 89 c8             	mov    %rcx,%r8
+  80097c:	48 89 d1             	mov    %rdx,%rcx
+  80097f:	48 89 c2             	mov    %rax,%rdx
+  800982:	be 01 00 00 00       	mov    $0x1,%esi
+  800987:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80098c:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800993:	00 00 00 
+  800996:	ff d0                	call   *%rax
+  800998:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80099c:	c9                   	leave
+  80099d:	c3                   	ret
+
+000000000080099e <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80099e:	55                   	push   %rbp
+  80099f:	48 89 e5             	mov    %rsp,%rbp
+  8009a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8009a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009ae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009b2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009be:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c2:	6a 00                	push   $0x0
+  8009c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009ca:	49 89 c8             	mov    %rcx,%r8
+  8009cd:	48 89 d1             	mov    %rdx,%rcx
+  8009d0:	48 89 c2             	mov    %rax,%rdx
+  8009d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8009d8:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009dd:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8009e4:	00 00 00 
+  8009e7:	ff d0                	call   *%rax
+  8009e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009ed:	c9                   	leave
+  8009ee:	c3                   	ret
+
+00000000008009ef <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009ef:	55                   	push   %rbp
+  8009f0:	48 89 e5             	mov    %rsp,%rbp
+  8009f3:	48 83 ec 30          	sub    $0x30,%rsp
+  8009f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009ff:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a02:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a06:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a0a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a0d:	48 63 c8             	movslq %eax,%rcx
+  800a10:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a18:	48 83 ec 08          	sub    $0x8,%rsp
+  800a1c:	6a 00                	push   $0x0
+  800a1e:	49 89 f1             	mov    %rsi,%r9
+  800a21:	49 89 c8             	mov    %rcx,%r8
+  800a24:	48 89 d1             	mov    %rdx,%rcx
+  800a27:	48 89 c2             	mov    %rax,%rdx
+  800a2a:	be 01 00 00 00       	mov    $0x1,%esi
+  800a2f:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a34:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800a3b:	00 00 00 
+  800a3e:	ff d0                	call   *%rax
+  800a40:	48 83 c4 10          	add    $0x10,%rsp
+  800a44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a4a:	c9                   	leave
+  800a4b:	c3                   	ret
+
+0000000000800a4c <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a4c:	55                   	push   %rbp
+  800a4d:	48 89 e5             	mov    %rsp,%rbp
+  800a50:	48 83 ec 10          	sub    $0x10,%rsp
+  800a54:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a5a:	48 98                	cltq
+  800a5c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a60:	6a 00                	push   $0x0
+  800a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a73:	48 89 c2             	mov    %rax,%rdx
+  800a76:	be 01 00 00 00       	mov    $0x1,%esi
+  800a7b:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a80:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  800a87:	00 00 00 
+  800a8a:	ff d0                	call   *%rax
+  800a8c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a90:	c9                   	leave
+  800a91:	c3                   	ret
+
+0000000000800a92 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a92:	55                   	push   %rbp
+  800a93:	48 89 e5             	mov    %rsp,%rbp
+  800a96:	48 83 ec 08          	sub    $0x8,%rsp
+  800a9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa2:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800aa9:	ff ff ff 
+  800aac:	48 01 d0             	add    %rdx,%rax
+  800aaf:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ab3:	c9                   	leave
+  800ab4:	c3                   	ret
+
+0000000000800ab5 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800ab5:	55                   	push   %rbp
+  800ab6:	48 89 e5             	mov    %rsp,%rbp
+  800ab9:	48 83 ec 08          	sub    $0x8,%rsp
+  800abd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ac1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac5:	48 89 c7             	mov    %rax,%rdi
+  800ac8:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800acf:	00 00 00 
+  800ad2:	ff d0                	call   *%rax
+  800ad4:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800ada:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+0000000000800ae0 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800ae0:	55                   	push   %rbp
+  800ae1:	48 89 e5             	mov    %rsp,%rbp
+  800ae4:	48 83 ec 18          	sub    $0x18,%rsp
+  800ae8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800aec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800af3:	e9 ae 00 00 00       	jmp    800ba6 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800af8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800afb:	c1 e0 0c             	shl    $0xc,%eax
+  800afe:	48 98                	cltq
+  800b00:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b05:	48 01 d0             	add    %rdx,%rax
+  800b08:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b10:	48 c1 e8 27          	shr    $0x27,%rax
+  800b14:	48 89 c2             	mov    %rax,%rdx
+  800b17:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b1e:	01 00 00 
+  800b21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b25:	83 e0 01             	and    $0x1,%eax
+  800b28:	48 85 c0             	test   %rax,%rax
+  800b2b:	74 63                	je     800b90 <fd_alloc+0xb0>
+  800b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b31:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b35:	48 89 c2             	mov    %rax,%rdx
+  800b38:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b3f:	01 00 00 
+  800b42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b46:	83 e0 01             	and    $0x1,%eax
+  800b49:	48 85 c0             	test   %rax,%rax
+  800b4c:	74 42                	je     800b90 <fd_alloc+0xb0>
+  800b4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b52:	48 c1 e8 15          	shr    $0x15,%rax
+  800b56:	48 89 c2             	mov    %rax,%rdx
+  800b59:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b60:	01 00 00 
+  800b63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b67:	83 e0 01             	and    $0x1,%eax
+  800b6a:	48 85 c0             	test   %rax,%rax
+  800b6d:	74 21                	je     800b90 <fd_alloc+0xb0>
+  800b6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b73:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b77:	48 89 c2             	mov    %rax,%rdx
+  800b7a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b81:	01 00 00 
+  800b84:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b88:	83 e0 01             	and    $0x1,%eax
+  800b8b:	48 85 c0             	test   %rax,%rax
+  800b8e:	75 12                	jne    800ba2 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b94:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b98:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba0:	eb 1e                	jmp    800bc0 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800ba2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800ba6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800baa:	0f 8e 48 ff ff ff    	jle    800af8 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bbb:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bc0:	c9                   	leave
+  800bc1:	c3                   	ret
+
+0000000000800bc2 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bc2:	55                   	push   %rbp
+  800bc3:	48 89 e5             	mov    %rsp,%rbp
+  800bc6:	48 83 ec 20          	sub    $0x20,%rsp
+  800bca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bcd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bd1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bd5:	78 06                	js     800bdd <fd_lookup+0x1b>
+  800bd7:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bdb:	7e 0a                	jle    800be7 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800be2:	e9 af 00 00 00       	jmp    800c96 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800be7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bea:	c1 e0 0c             	shl    $0xc,%eax
+  800bed:	48 98                	cltq
+  800bef:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800bf4:	48 01 d0             	add    %rdx,%rax
+  800bf7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800bfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bff:	48 c1 e8 27          	shr    $0x27,%rax
+  800c03:	48 89 c2             	mov    %rax,%rdx
+  800c06:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c0d:	01 00 00 
+  800c10:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c14:	83 e0 01             	and    $0x1,%eax
+  800c17:	48 85 c0             	test   %rax,%rax
+  800c1a:	74 63                	je     800c7f <fd_lookup+0xbd>
+  800c1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c20:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c24:	48 89 c2             	mov    %rax,%rdx
+  800c27:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c2e:	01 00 00 
+  800c31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c35:	83 e0 01             	and    $0x1,%eax
+  800c38:	48 85 c0             	test   %rax,%rax
+  800c3b:	74 42                	je     800c7f <fd_lookup+0xbd>
+  800c3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c41:	48 c1 e8 15          	shr    $0x15,%rax
+  800c45:	48 89 c2             	mov    %rax,%rdx
+  800c48:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c4f:	01 00 00 
+  800c52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c56:	83 e0 01             	and    $0x1,%eax
+  800c59:	48 85 c0             	test   %rax,%rax
+  800c5c:	74 21                	je     800c7f <fd_lookup+0xbd>
+  800c5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c62:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c66:	48 89 c2             	mov    %rax,%rdx
+  800c69:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c70:	01 00 00 
+  800c73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c77:	83 e0 01             	and    $0x1,%eax
+  800c7a:	48 85 c0             	test   %rax,%rax
+  800c7d:	75 07                	jne    800c86 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c84:	eb 10                	jmp    800c96 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c8e:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c96:	c9                   	leave
+  800c97:	c3                   	ret
+
+0000000000800c98 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c98:	55                   	push   %rbp
+  800c99:	48 89 e5             	mov    %rsp,%rbp
+  800c9c:	48 83 ec 30          	sub    $0x30,%rsp
+  800ca0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ca4:	89 f0                	mov    %esi,%eax
+  800ca6:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800ca9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cad:	48 89 c7             	mov    %rax,%rdi
+  800cb0:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  800cb7:	00 00 00 
+  800cba:	ff d0                	call   *%rax
+  800cbc:	89 c2                	mov    %eax,%edx
+  800cbe:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cc2:	48 89 c6             	mov    %rax,%rsi
+  800cc5:	89 d7                	mov    %edx,%edi
+  800cc7:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  800cce:	00 00 00 
+  800cd1:	ff d0                	call   *%rax
+  800cd3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800cd6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800cda:	78 0a                	js     800ce6 <fd_close+0x4e>
+  800cdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ce0:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800ce4:	74 12                	je     800cf8 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800ce6:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cea:	74 05                	je     800cf1 <fd_close+0x59>
+  800cec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800cef:	eb 70                	jmp    800d61 <fd_close+0xc9>
+  800cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf6:	eb 69                	jmp    800d61 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cfc:	8b 00                	mov    (%rax),%eax
+  800cfe:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d02:	48 89 d6             	mov    %rdx,%rsi
+  800d05:	89 c7                	mov    %eax,%edi
+  800d07:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  800d0e:	00 00 00 
+  800d11:	ff d0                	call   *%rax
+  800d13:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d1a:	78 2a                	js     800d46 <fd_close+0xae>
+    if (dev->dev_close)
+  800d1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d20:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d24:	48 85 c0             	test   %rax,%rax
+  800d27:	74 16                	je     800d3f <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d35:	48 89 c7             	mov    %rax,%rdi
+  800d38:	ff d2                	call   *%rdx
+  800d3a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d3d:	eb 07                	jmp    800d46 <fd_close+0xae>
+    else
+      r = 0;
+  800d3f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d4a:	48 89 c6             	mov    %rax,%rsi
+  800d4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d52:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  800d59:	00 00 00 
+  800d5c:	ff d0                	call   *%rax
+  return r;
+  800d5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d61:	c9                   	leave
+  800d62:	c3                   	ret
+
+0000000000800d63 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	48 83 ec 20          	sub    $0x20,%rsp
+  800d6b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d6e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d72:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d79:	eb 3f                	jmp    800dba <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d7b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d82:	00 00 00 
+  800d85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d88:	48 98                	cltq
+  800d8a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d8e:	8b 00                	mov    (%rax),%eax
+  800d90:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d93:	75 21                	jne    800db6 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d95:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d9c:	00 00 00 
+  800d9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800da2:	48 98                	cltq
+  800da4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800da8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dac:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db4:	eb 7f                	jmp    800e35 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800db6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dba:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dc1:	00 00 00 
+  800dc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dc7:	48 98                	cltq
+  800dc9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dcd:	48 85 c0             	test   %rax,%rax
+  800dd0:	75 a9                	jne    800d7b <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dd2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dd9:	00 00 00 
+  800ddc:	8b 40 04             	mov    0x4(%rax),%eax
+  800ddf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800de4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800deb:	00 00 00 
+  800dee:	48 98                	cltq
+  800df0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800df7:	48 01 d0             	add    %rdx,%rax
+  800dfa:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e00:	8b 00                	mov    (%rax),%eax
+  800e02:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e05:	89 c6                	mov    %eax,%esi
+  800e07:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800e0e:	00 00 00 
+  800e11:	48 89 c7             	mov    %rax,%rdi
+  800e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e19:	48 b9 5a 31 80 00 00 	movabs $0x80315a,%rcx
+  800e20:	00 00 00 
+  800e23:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e25:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e29:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e35:	c9                   	leave
+  800e36:	c3                   	ret
+
+0000000000800e37 <close>:
+
+int
+close(int fdnum) {
+  800e37:	55                   	push   %rbp
+  800e38:	48 89 e5             	mov    %rsp,%rbp
+  800e3b:	48 83 ec 20          	sub    $0x20,%rsp
+  800e3f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e42:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e49:	48 89 d6             	mov    %rdx,%rsi
+  800e4c:	89 c7                	mov    %eax,%edi
+  800e4e:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+  800e5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e61:	79 05                	jns    800e68 <close+0x31>
+    return r;
+  800e63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e66:	eb 18                	jmp    800e80 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e6c:	be 01 00 00 00       	mov    $0x1,%esi
+  800e71:	48 89 c7             	mov    %rax,%rdi
+  800e74:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  800e7b:	00 00 00 
+  800e7e:	ff d0                	call   *%rax
+}
+  800e80:	c9                   	leave
+  800e81:	c3                   	ret
+
+0000000000800e82 <close_all>:
+
+void
+close_all(void) {
+  800e82:	55                   	push   %rbp
+  800e83:	48 89 e5             	mov    %rsp,%rbp
+  800e86:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e8a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e91:	eb 15                	jmp    800ea8 <close_all+0x26>
+    close(i);
+  800e93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e96:	89 c7                	mov    %eax,%edi
+  800e98:	48 b8 37 0e 80 00 00 	movabs $0x800e37,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800ea4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800ea8:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800eac:	7e e5                	jle    800e93 <close_all+0x11>
+}
+  800eae:	90                   	nop
+  800eaf:	90                   	nop
+  800eb0:	c9                   	leave
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800eb2:	55                   	push   %rbp
+  800eb3:	48 89 e5             	mov    %rsp,%rbp
+  800eb6:	48 83 ec 40          	sub    $0x40,%rsp
+  800eba:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ebd:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ec0:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800ec4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ec7:	48 89 d6             	mov    %rdx,%rsi
+  800eca:	89 c7                	mov    %eax,%edi
+  800ecc:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  800ed3:	00 00 00 
+  800ed6:	ff d0                	call   *%rax
+  800ed8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800edb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800edf:	79 08                	jns    800ee9 <dup+0x37>
+    return r;
+  800ee1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ee4:	e9 33 02 00 00       	jmp    80111c <dup+0x26a>
+  close(newfdnum);
+  800ee9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800eec:	89 c7                	mov    %eax,%edi
+  800eee:	48 b8 37 0e 80 00 00 	movabs $0x800e37,%rax
+  800ef5:	00 00 00 
+  800ef8:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800efa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efd:	c1 e0 0c             	shl    $0xc,%eax
+  800f00:	48 98                	cltq
+  800f02:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f07:	48 01 d0             	add    %rdx,%rax
+  800f0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f12:	48 89 c7             	mov    %rax,%rdi
+  800f15:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  800f1c:	00 00 00 
+  800f1f:	ff d0                	call   *%rax
+  800f21:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f29:	48 89 c7             	mov    %rax,%rdi
+  800f2c:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  800f33:	00 00 00 
+  800f36:	ff d0                	call   *%rax
+  800f38:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f3c:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f43:	00 
+  800f44:	e9 19 01 00 00       	jmp    801062 <dup+0x1b0>
+    off -= PGSIZE;
+  800f49:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f50:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f51:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f59:	48 01 d0             	add    %rdx,%rax
+  800f5c:	48 c1 e8 27          	shr    $0x27,%rax
+  800f60:	48 89 c2             	mov    %rax,%rdx
+  800f63:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f6a:	01 00 00 
+  800f6d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f71:	83 e0 01             	and    $0x1,%eax
+  800f74:	48 85 c0             	test   %rax,%rax
+  800f77:	0f 84 e5 00 00 00    	je     801062 <dup+0x1b0>
+  800f7d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f85:	48 01 d0             	add    %rdx,%rax
+  800f88:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f8c:	48 89 c2             	mov    %rax,%rdx
+  800f8f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f96:	01 00 00 
+  800f99:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f9d:	83 e0 01             	and    $0x1,%eax
+  800fa0:	48 85 c0             	test   %rax,%rax
+  800fa3:	0f 84 b9 00 00 00    	je     801062 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fa9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb1:	48 01 d0             	add    %rdx,%rax
+  800fb4:	48 c1 e8 15          	shr    $0x15,%rax
+  800fb8:	48 89 c2             	mov    %rax,%rdx
+  800fbb:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fc2:	01 00 00 
+  800fc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fc9:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fcc:	48 85 c0             	test   %rax,%rax
+  800fcf:	0f 84 8d 00 00 00    	je     801062 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fd5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fdd:	48 01 d0             	add    %rdx,%rax
+  800fe0:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fe4:	48 89 c2             	mov    %rax,%rdx
+  800fe7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fee:	01 00 00 
+  800ff1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800ff5:	83 e0 01             	and    $0x1,%eax
+  800ff8:	48 85 c0             	test   %rax,%rax
+  800ffb:	74 65                	je     801062 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800ffd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801001:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801005:	48 01 d0             	add    %rdx,%rax
+  801008:	48 c1 e8 0c          	shr    $0xc,%rax
+  80100c:	48 89 c2             	mov    %rax,%rdx
+  80100f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801016:	01 00 00 
+  801019:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80101d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801022:	89 c6                	mov    %eax,%esi
+  801024:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801028:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80102c:	48 01 c2             	add    %rax,%rdx
+  80102f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801033:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801037:	48 01 c8             	add    %rcx,%rax
+  80103a:	41 89 f0             	mov    %esi,%r8d
+  80103d:	48 89 d1             	mov    %rdx,%rcx
+  801040:	ba 00 00 00 00       	mov    $0x0,%edx
+  801045:	48 89 c6             	mov    %rax,%rsi
+  801048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80104d:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  801054:	00 00 00 
+  801057:	ff d0                	call   *%rax
+  801059:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80105c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801060:	78 60                	js     8010c2 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801062:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801067:	0f 85 dc fe ff ff    	jne    800f49 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80106d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801071:	48 c1 e8 0c          	shr    $0xc,%rax
+  801075:	48 89 c2             	mov    %rax,%rdx
+  801078:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80107f:	01 00 00 
+  801082:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801086:	25 07 0e 00 00       	and    $0xe07,%eax
+  80108b:	89 c1                	mov    %eax,%ecx
+  80108d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801091:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801095:	41 89 c8             	mov    %ecx,%r8d
+  801098:	48 89 d1             	mov    %rdx,%rcx
+  80109b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a0:	48 89 c6             	mov    %rax,%rsi
+  8010a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010a8:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  8010af:	00 00 00 
+  8010b2:	ff d0                	call   *%rax
+  8010b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010bb:	78 08                	js     8010c5 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010bd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010c0:	eb 5a                	jmp    80111c <dup+0x26a>
+        goto err;
+  8010c2:	90                   	nop
+  8010c3:	eb 01                	jmp    8010c6 <dup+0x214>
+    goto err;
+  8010c5:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ca:	48 89 c6             	mov    %rax,%rsi
+  8010cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d2:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  8010d9:	00 00 00 
+  8010dc:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010de:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010e5:	00 
+  8010e6:	eb 27                	jmp    80110f <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010f0:	48 01 d0             	add    %rdx,%rax
+  8010f3:	48 89 c6             	mov    %rax,%rsi
+  8010f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010fb:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  801102:	00 00 00 
+  801105:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801107:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80110e:	00 
+  80110f:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801116:	00 
+  801117:	76 cf                	jbe    8010e8 <dup+0x236>
+  return r;
+  801119:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	48 83 ec 40          	sub    $0x40,%rsp
+  801126:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801129:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80112d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801131:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801135:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801138:	48 89 d6             	mov    %rdx,%rsi
+  80113b:	89 c7                	mov    %eax,%edi
+  80113d:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  801144:	00 00 00 
+  801147:	ff d0                	call   *%rax
+  801149:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80114c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801150:	78 24                	js     801176 <read+0x58>
+  801152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801156:	8b 00                	mov    (%rax),%eax
+  801158:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80115c:	48 89 d6             	mov    %rdx,%rsi
+  80115f:	89 c7                	mov    %eax,%edi
+  801161:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801168:	00 00 00 
+  80116b:	ff d0                	call   *%rax
+  80116d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801170:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801174:	79 0a                	jns    801180 <read+0x62>
+    return r;
+  801176:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801179:	48 98                	cltq
+  80117b:	e9 9e 00 00 00       	jmp    80121e <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801184:	8b 40 08             	mov    0x8(%rax),%eax
+  801187:	83 e0 03             	and    $0x3,%eax
+  80118a:	83 f8 01             	cmp    $0x1,%eax
+  80118d:	75 5c                	jne    8011eb <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80118f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801196:	00 00 00 
+  801199:	8b 40 04             	mov    0x4(%rax),%eax
+  80119c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011a1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011a8:	00 00 00 
+  8011ab:	48 98                	cltq
+  8011ad:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011b4:	48 01 d0             	add    %rdx,%rax
+  8011b7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011bd:	8b 00                	mov    (%rax),%eax
+  8011bf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011c2:	89 c6                	mov    %eax,%esi
+  8011c4:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011cb:	00 00 00 
+  8011ce:	48 89 c7             	mov    %rax,%rdi
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d6:	48 b9 5a 31 80 00 00 	movabs $0x80315a,%rcx
+  8011dd:	00 00 00 
+  8011e0:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011e2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011e9:	eb 33                	jmp    80121e <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011ef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011f3:	48 85 c0             	test   %rax,%rax
+  8011f6:	75 09                	jne    801201 <read+0xe3>
+    return -E_NOT_SUPP;
+  8011f8:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8011ff:	eb 1d                	jmp    80121e <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801201:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801205:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801209:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801211:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801215:	48 89 ce             	mov    %rcx,%rsi
+  801218:	48 89 c7             	mov    %rax,%rdi
+  80121b:	41 ff d0             	call   *%r8
+}
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+
+0000000000801220 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801220:	55                   	push   %rbp
+  801221:	48 89 e5             	mov    %rsp,%rbp
+  801224:	48 83 ec 30          	sub    $0x30,%rsp
+  801228:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80122b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80122f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801233:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80123a:	eb 49                	jmp    801285 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80123c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123f:	48 98                	cltq
+  801241:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801245:	48 29 c2             	sub    %rax,%rdx
+  801248:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80124b:	48 63 c8             	movslq %eax,%rcx
+  80124e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801252:	48 01 c1             	add    %rax,%rcx
+  801255:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801258:	48 89 ce             	mov    %rcx,%rsi
+  80125b:	89 c7                	mov    %eax,%edi
+  80125d:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  801264:	00 00 00 
+  801267:	ff d0                	call   *%rax
+  801269:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80126c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801270:	79 07                	jns    801279 <readn+0x59>
+      return m;
+  801272:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801275:	48 98                	cltq
+  801277:	eb 1f                	jmp    801298 <readn+0x78>
+    if (m == 0)
+  801279:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80127d:	74 13                	je     801292 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80127f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801282:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801285:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801288:	48 98                	cltq
+  80128a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80128e:	72 ac                	jb     80123c <readn+0x1c>
+  801290:	eb 01                	jmp    801293 <readn+0x73>
+      break;
+  801292:	90                   	nop
+  }
+  return tot;
+  801293:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801296:	48 98                	cltq
+}
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+000000000080129a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	48 83 ec 40          	sub    $0x40,%rsp
+  8012a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012ad:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012b4:	48 89 d6             	mov    %rdx,%rsi
+  8012b7:	89 c7                	mov    %eax,%edi
+  8012b9:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  8012c0:	00 00 00 
+  8012c3:	ff d0                	call   *%rax
+  8012c5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012c8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012cc:	78 24                	js     8012f2 <write+0x58>
+  8012ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d2:	8b 00                	mov    (%rax),%eax
+  8012d4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012d8:	48 89 d6             	mov    %rdx,%rsi
+  8012db:	89 c7                	mov    %eax,%edi
+  8012dd:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  8012e4:	00 00 00 
+  8012e7:	ff d0                	call   *%rax
+  8012e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012f0:	79 0a                	jns    8012fc <write+0x62>
+    return r;
+  8012f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012f5:	48 98                	cltq
+  8012f7:	e9 9d 00 00 00       	jmp    801399 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801300:	8b 40 08             	mov    0x8(%rax),%eax
+  801303:	83 e0 03             	and    $0x3,%eax
+  801306:	85 c0                	test   %eax,%eax
+  801308:	75 5c                	jne    801366 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80130a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801311:	00 00 00 
+  801314:	8b 40 04             	mov    0x4(%rax),%eax
+  801317:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80131c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801323:	00 00 00 
+  801326:	48 98                	cltq
+  801328:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80132f:	48 01 d0             	add    %rdx,%rax
+  801332:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801338:	8b 00                	mov    (%rax),%eax
+  80133a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80133d:	89 c6                	mov    %eax,%esi
+  80133f:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  801346:	00 00 00 
+  801349:	48 89 c7             	mov    %rax,%rdi
+  80134c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801351:	48 b9 5a 31 80 00 00 	movabs $0x80315a,%rcx
+  801358:	00 00 00 
+  80135b:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80135d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801364:	eb 33                	jmp    801399 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801366:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80136a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80136e:	48 85 c0             	test   %rax,%rax
+  801371:	75 09                	jne    80137c <write+0xe2>
+    return -E_NOT_SUPP;
+  801373:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80137a:	eb 1d                	jmp    801399 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80137c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801380:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801388:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80138c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801390:	48 89 ce             	mov    %rcx,%rsi
+  801393:	48 89 c7             	mov    %rax,%rdi
+  801396:	41 ff d0             	call   *%r8
+}
+  801399:	c9                   	leave
+  80139a:	c3                   	ret
+
+000000000080139b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80139b:	55                   	push   %rbp
+  80139c:	48 89 e5             	mov    %rsp,%rbp
+  80139f:	48 83 ec 18          	sub    $0x18,%rsp
+  8013a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013a6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013a9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013b0:	48 89 d6             	mov    %rdx,%rsi
+  8013b3:	89 c7                	mov    %eax,%edi
+  8013b5:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  8013bc:	00 00 00 
+  8013bf:	ff d0                	call   *%rax
+  8013c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013c8:	79 05                	jns    8013cf <seek+0x34>
+    return r;
+  8013ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013cd:	eb 0f                	jmp    8013de <seek+0x43>
+  fd->fd_offset = offset;
+  8013cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013d6:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013de:	c9                   	leave
+  8013df:	c3                   	ret
+
+00000000008013e0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013e0:	55                   	push   %rbp
+  8013e1:	48 89 e5             	mov    %rsp,%rbp
+  8013e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8013e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013eb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013ee:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013f5:	48 89 d6             	mov    %rdx,%rsi
+  8013f8:	89 c7                	mov    %eax,%edi
+  8013fa:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  801401:	00 00 00 
+  801404:	ff d0                	call   *%rax
+  801406:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801409:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80140d:	78 24                	js     801433 <ftruncate+0x53>
+  80140f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801413:	8b 00                	mov    (%rax),%eax
+  801415:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801419:	48 89 d6             	mov    %rdx,%rsi
+  80141c:	89 c7                	mov    %eax,%edi
+  80141e:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801425:	00 00 00 
+  801428:	ff d0                	call   *%rax
+  80142a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80142d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801431:	79 08                	jns    80143b <ftruncate+0x5b>
+    return r;
+  801433:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801436:	e9 92 00 00 00       	jmp    8014cd <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80143b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143f:	8b 40 08             	mov    0x8(%rax),%eax
+  801442:	83 e0 03             	and    $0x3,%eax
+  801445:	85 c0                	test   %eax,%eax
+  801447:	75 5a                	jne    8014a3 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  801449:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801450:	00 00 00 
+  801453:	8b 40 04             	mov    0x4(%rax),%eax
+  801456:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80145b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801462:	00 00 00 
+  801465:	48 98                	cltq
+  801467:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80146e:	48 01 d0             	add    %rdx,%rax
+  801471:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801477:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801479:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80147c:	89 c6                	mov    %eax,%esi
+  80147e:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  801485:	00 00 00 
+  801488:	48 89 c7             	mov    %rax,%rdi
+  80148b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801490:	48 b9 5a 31 80 00 00 	movabs $0x80315a,%rcx
+  801497:	00 00 00 
+  80149a:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80149c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a1:	eb 2a                	jmp    8014cd <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014ab:	48 85 c0             	test   %rax,%rax
+  8014ae:	75 07                	jne    8014b7 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014b0:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014b5:	eb 16                	jmp    8014cd <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014bb:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014c6:	89 d6                	mov    %edx,%esi
+  8014c8:	48 89 c7             	mov    %rax,%rdi
+  8014cb:	ff d1                	call   *%rcx
+}
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+00000000008014cf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8014d7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014da:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014de:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014e5:	48 89 d6             	mov    %rdx,%rsi
+  8014e8:	89 c7                	mov    %eax,%edi
+  8014ea:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  8014f1:	00 00 00 
+  8014f4:	ff d0                	call   *%rax
+  8014f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014fd:	78 24                	js     801523 <fstat+0x54>
+  8014ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801503:	8b 00                	mov    (%rax),%eax
+  801505:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801509:	48 89 d6             	mov    %rdx,%rsi
+  80150c:	89 c7                	mov    %eax,%edi
+  80150e:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  801515:	00 00 00 
+  801518:	ff d0                	call   *%rax
+  80151a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80151d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801521:	79 05                	jns    801528 <fstat+0x59>
+    return r;
+  801523:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801526:	eb 5e                	jmp    801586 <fstat+0xb7>
+  if (!dev->dev_stat)
+  801528:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801530:	48 85 c0             	test   %rax,%rax
+  801533:	75 07                	jne    80153c <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801535:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80153a:	eb 4a                	jmp    801586 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80153c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801540:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801543:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801547:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80154e:	00 00 00 
+  stat->st_isdir   = 0;
+  801551:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801555:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80155c:	00 00 00 
+  stat->st_dev     = dev;
+  80155f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801563:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801567:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80156e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801572:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80157e:	48 89 d6             	mov    %rdx,%rsi
+  801581:	48 89 c7             	mov    %rax,%rdi
+  801584:	ff d1                	call   *%rcx
+}
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	48 83 ec 10          	sub    $0x10,%rsp
+  801590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801594:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  801598:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80159c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015a2:	83 f8 20             	cmp    $0x20,%eax
+  8015a5:	75 07                	jne    8015ae <pollwait_key+0x26>
+    return -E_INVAL;
+  8015a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ac:	eb 5f                	jmp    80160d <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b2:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015bc:	48 63 d2             	movslq %edx,%rdx
+  8015bf:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015c3:	48 01 c2             	add    %rax,%rdx
+  8015c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ca:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d1:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015db:	8b 00                	mov    (%rax),%eax
+  8015dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015e1:	48 63 c9             	movslq %ecx,%rcx
+  8015e4:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015e8:	48 01 ca             	add    %rcx,%rdx
+  8015eb:	48 83 c2 08          	add    $0x8,%rdx
+  8015ef:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f5:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015fb:	8d 50 01             	lea    0x1(%rax),%edx
+  8015fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801602:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  801608:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+
+000000000080160f <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80160f:	55                   	push   %rbp
+  801610:	48 89 e5             	mov    %rsp,%rbp
+  801613:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80161a:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801621:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801627:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80162e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801635:	00 
+  int i, r, ready, ipc = 0;
+  801636:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80163d:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801644:	00 
+  801645:	74 45                	je     80168c <poll+0x7d>
+  801647:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80164e:	ff 
+  80164f:	74 3b                	je     80168c <poll+0x7d>
+    now      = vsys_clock_ns();
+  801651:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  801658:	00 00 00 
+  80165b:	ff d0                	call   *%rax
+  80165d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801665:	48 f7 d0             	not    %rax
+  801668:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80166f:	73 10                	jae    801681 <poll+0x72>
+  801671:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801675:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80167c:	48 01 d0             	add    %rdx,%rax
+  80167f:	eb 07                	jmp    801688 <poll+0x79>
+  801681:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801688:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80168c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801693:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80169a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016a8:	e9 46 02 00 00       	jmp    8018f3 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016b0:	48 63 d0             	movslq %eax,%rdx
+  8016b3:	48 89 d0             	mov    %rdx,%rax
+  8016b6:	48 01 c0             	add    %rax,%rax
+  8016b9:	48 01 d0             	add    %rdx,%rax
+  8016bc:	48 c1 e0 02          	shl    $0x2,%rax
+  8016c0:	48 89 c2             	mov    %rax,%rdx
+  8016c3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016ca:	48 01 d0             	add    %rdx,%rax
+  8016cd:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016d7:	48 63 d0             	movslq %eax,%rdx
+  8016da:	48 89 d0             	mov    %rdx,%rax
+  8016dd:	48 01 c0             	add    %rax,%rax
+  8016e0:	48 01 d0             	add    %rdx,%rax
+  8016e3:	48 c1 e0 02          	shl    $0x2,%rax
+  8016e7:	48 89 c2             	mov    %rax,%rdx
+  8016ea:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016f1:	48 01 d0             	add    %rdx,%rax
+  8016f4:	8b 00                	mov    (%rax),%eax
+  8016f6:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016f9:	75 62                	jne    80175d <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8016fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016fe:	48 63 d0             	movslq %eax,%rdx
+  801701:	48 89 d0             	mov    %rdx,%rax
+  801704:	48 01 c0             	add    %rax,%rax
+  801707:	48 01 d0             	add    %rdx,%rax
+  80170a:	48 c1 e0 02          	shl    $0x2,%rax
+  80170e:	48 89 c2             	mov    %rax,%rdx
+  801711:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801718:	48 01 d0             	add    %rdx,%rax
+  80171b:	8b 40 04             	mov    0x4(%rax),%eax
+  80171e:	83 e0 01             	and    $0x1,%eax
+  801721:	85 c0                	test   %eax,%eax
+  801723:	0f 84 9b 01 00 00    	je     8018c4 <poll+0x2b5>
+          fds[i].revents = ipc;
+  801729:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80172c:	48 63 d0             	movslq %eax,%rdx
+  80172f:	48 89 d0             	mov    %rdx,%rax
+  801732:	48 01 c0             	add    %rax,%rax
+  801735:	48 01 d0             	add    %rdx,%rax
+  801738:	48 c1 e0 02          	shl    $0x2,%rax
+  80173c:	48 89 c2             	mov    %rax,%rdx
+  80173f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801746:	48 01 c2             	add    %rax,%rdx
+  801749:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80174c:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80174f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801752:	83 c8 04             	or     $0x4,%eax
+  801755:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  801758:	e9 67 01 00 00       	jmp    8018c4 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80175d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801760:	48 63 d0             	movslq %eax,%rdx
+  801763:	48 89 d0             	mov    %rdx,%rax
+  801766:	48 01 c0             	add    %rax,%rax
+  801769:	48 01 d0             	add    %rdx,%rax
+  80176c:	48 c1 e0 02          	shl    $0x2,%rax
+  801770:	48 89 c2             	mov    %rax,%rdx
+  801773:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80177a:	48 01 d0             	add    %rdx,%rax
+  80177d:	8b 00                	mov    (%rax),%eax
+  80177f:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801786:	48 89 d6             	mov    %rdx,%rsi
+  801789:	89 c7                	mov    %eax,%edi
+  80178b:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  801792:	00 00 00 
+  801795:	ff d0                	call   *%rax
+  801797:	85 c0                	test   %eax,%eax
+  801799:	78 25                	js     8017c0 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80179b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017a2:	8b 00                	mov    (%rax),%eax
+  8017a4:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017ab:	48 89 d6             	mov    %rdx,%rsi
+  8017ae:	89 c7                	mov    %eax,%edi
+  8017b0:	48 b8 63 0d 80 00 00 	movabs $0x800d63,%rax
+  8017b7:	00 00 00 
+  8017ba:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	79 2c                	jns    8017ec <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017c3:	48 63 d0             	movslq %eax,%rdx
+  8017c6:	48 89 d0             	mov    %rdx,%rax
+  8017c9:	48 01 c0             	add    %rax,%rax
+  8017cc:	48 01 d0             	add    %rdx,%rax
+  8017cf:	48 c1 e0 02          	shl    $0x2,%rax
+  8017d3:	48 89 c2             	mov    %rax,%rdx
+  8017d6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017dd:	48 01 d0             	add    %rdx,%rax
+  8017e0:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017e7:	e9 d8 00 00 00       	jmp    8018c4 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017ec:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017f3:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017f7:	48 85 c0             	test   %rax,%rax
+  8017fa:	74 7d                	je     801879 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8017fc:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801803:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801807:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80180a:	48 63 d0             	movslq %eax,%rdx
+  80180d:	48 89 d0             	mov    %rdx,%rax
+  801810:	48 01 c0             	add    %rax,%rax
+  801813:	48 01 d0             	add    %rdx,%rax
+  801816:	48 c1 e0 02          	shl    $0x2,%rax
+  80181a:	48 89 c2             	mov    %rax,%rdx
+  80181d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801824:	48 01 d0             	add    %rdx,%rax
+  801827:	8b 48 04             	mov    0x4(%rax),%ecx
+  80182a:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801831:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  801838:	89 ce                	mov    %ecx,%esi
+  80183a:	48 89 c7             	mov    %rax,%rdi
+  80183d:	41 ff d0             	call   *%r8
+  801840:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801843:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801847:	79 08                	jns    801851 <poll+0x242>
+          return r;
+  801849:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80184c:	e9 45 01 00 00       	jmp    801996 <poll+0x387>
+        fds[i].revents = r;
+  801851:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801854:	48 63 d0             	movslq %eax,%rdx
+  801857:	48 89 d0             	mov    %rdx,%rax
+  80185a:	48 01 c0             	add    %rax,%rax
+  80185d:	48 01 d0             	add    %rdx,%rax
+  801860:	48 c1 e0 02          	shl    $0x2,%rax
+  801864:	48 89 c2             	mov    %rax,%rdx
+  801867:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80186e:	48 01 c2             	add    %rax,%rdx
+  801871:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801874:	89 42 08             	mov    %eax,0x8(%rdx)
+  801877:	eb 4b                	jmp    8018c4 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  801879:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80187c:	48 63 d0             	movslq %eax,%rdx
+  80187f:	48 89 d0             	mov    %rdx,%rax
+  801882:	48 01 c0             	add    %rax,%rax
+  801885:	48 01 d0             	add    %rdx,%rax
+  801888:	48 c1 e0 02          	shl    $0x2,%rax
+  80188c:	48 89 c2             	mov    %rax,%rdx
+  80188f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801896:	48 01 d0             	add    %rdx,%rax
+  801899:	8b 48 04             	mov    0x4(%rax),%ecx
+  80189c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80189f:	48 63 d0             	movslq %eax,%rdx
+  8018a2:	48 89 d0             	mov    %rdx,%rax
+  8018a5:	48 01 c0             	add    %rax,%rax
+  8018a8:	48 01 d0             	add    %rdx,%rax
+  8018ab:	48 c1 e0 02          	shl    $0x2,%rax
+  8018af:	48 89 c2             	mov    %rax,%rdx
+  8018b2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018b9:	48 01 d0             	add    %rdx,%rax
+  8018bc:	83 e1 03             	and    $0x3,%ecx
+  8018bf:	89 ca                	mov    %ecx,%edx
+  8018c1:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018c4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018c7:	48 63 d0             	movslq %eax,%rdx
+  8018ca:	48 89 d0             	mov    %rdx,%rax
+  8018cd:	48 01 c0             	add    %rax,%rax
+  8018d0:	48 01 d0             	add    %rdx,%rax
+  8018d3:	48 c1 e0 02          	shl    $0x2,%rax
+  8018d7:	48 89 c2             	mov    %rax,%rdx
+  8018da:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018e1:	48 01 d0             	add    %rdx,%rax
+  8018e4:	8b 40 08             	mov    0x8(%rax),%eax
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	74 04                	je     8018ef <poll+0x2e0>
+        ready++;
+  8018eb:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018ef:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f6:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8018fc:	0f 8c ab fd ff ff    	jl     8016ad <poll+0x9e>
+    }
+    if (ready)
+  801902:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801906:	74 08                	je     801910 <poll+0x301>
+      return ready;
+  801908:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80190b:	e9 86 00 00 00       	jmp    801996 <poll+0x387>
+
+    if (deadline) {
+  801910:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801915:	74 30                	je     801947 <poll+0x338>
+      now     = vsys_clock_ns();
+  801917:	48 b8 4a 2b 80 00 00 	movabs $0x802b4a,%rax
+  80191e:	00 00 00 
+  801921:	ff d0                	call   *%rax
+  801923:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801927:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80192b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80192f:	73 0a                	jae    80193b <poll+0x32c>
+  801931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801935:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801939:	eb 05                	jmp    801940 <poll+0x331>
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801940:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801947:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80194a:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80194d:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801954:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80195b:	48 89 c7             	mov    %rax,%rdi
+  80195e:	48 b8 f3 07 80 00 00 	movabs $0x8007f3,%rax
+  801965:	00 00 00 
+  801968:	ff d0                	call   *%rax
+  80196a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80196d:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801971:	75 07                	jne    80197a <poll+0x36b>
+      return 0;
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	eb 1c                	jmp    801996 <poll+0x387>
+    if (r < 0)
+  80197a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80197e:	79 05                	jns    801985 <poll+0x376>
+      return r;
+  801980:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801983:	eb 11                	jmp    801996 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801985:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801988:	c1 f8 02             	sar    $0x2,%eax
+  80198b:	83 e0 01             	and    $0x1,%eax
+  80198e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801991:	e9 f6 fc ff ff       	jmp    80168c <poll+0x7d>
+  }
+}
+  801996:	c9                   	leave
+  801997:	c3                   	ret
+
+0000000000801998 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801998:	55                   	push   %rbp
+  801999:	48 89 e5             	mov    %rsp,%rbp
+  80199c:	48 83 ec 20          	sub    $0x20,%rsp
+  8019a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b1:	48 89 c7             	mov    %rax,%rdi
+  8019b4:	48 b8 86 1a 80 00 00 	movabs $0x801a86,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+  8019c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019c7:	79 05                	jns    8019ce <stat+0x36>
+    return fd;
+  8019c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019cc:	eb 2f                	jmp    8019fd <stat+0x65>
+  r = fstat(fd, stat);
+  8019ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019d5:	48 89 d6             	mov    %rdx,%rsi
+  8019d8:	89 c7                	mov    %eax,%edi
+  8019da:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  8019e1:	00 00 00 
+  8019e4:	ff d0                	call   *%rax
+  8019e6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019ec:	89 c7                	mov    %eax,%edi
+  8019ee:	48 b8 37 0e 80 00 00 	movabs $0x800e37,%rax
+  8019f5:	00 00 00 
+  8019f8:	ff d0                	call   *%rax
+  return r;
+  8019fa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+00000000008019ff <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019ff:	55                   	push   %rbp
+  801a00:	48 89 e5             	mov    %rsp,%rbp
+  801a03:	48 83 ec 10          	sub    $0x10,%rsp
+  801a07:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a0a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a0e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a15:	00 00 00 
+  801a18:	8b 00                	mov    (%rax),%eax
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	75 1d                	jne    801a3b <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a1e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a23:	48 b8 52 4e 80 00 00 	movabs $0x804e52,%rax
+  801a2a:	00 00 00 
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a36:	00 00 00 
+  801a39:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a3b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a42:	00 00 00 
+  801a45:	8b 00                	mov    (%rax),%eax
+  801a47:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a4a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a4f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a56:	00 00 00 
+  801a59:	89 c7                	mov    %eax,%edi
+  801a5b:	48 b8 a5 4d 80 00 00 	movabs $0x804da5,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a70:	48 89 c6             	mov    %rax,%rsi
+  801a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a78:	48 b8 28 4c 80 00 00 	movabs $0x804c28,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+}
+  801a84:	c9                   	leave
+  801a85:	c3                   	ret
+
+0000000000801a86 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a86:	55                   	push   %rbp
+  801a87:	48 89 e5             	mov    %rsp,%rbp
+  801a8a:	48 83 ec 20          	sub    $0x20,%rsp
+  801a8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a92:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a99:	48 89 c7             	mov    %rax,%rdi
+  801a9c:	48 b8 09 40 80 00 00 	movabs $0x804009,%rax
+  801aa3:	00 00 00 
+  801aa6:	ff d0                	call   *%rax
+  801aa8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801aad:	7e 0a                	jle    801ab9 <open+0x33>
+    return -E_BAD_PATH;
+  801aaf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab4:	e9 a8 00 00 00       	jmp    801b61 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801ab9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801abd:	48 89 c7             	mov    %rax,%rdi
+  801ac0:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801acf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ad3:	79 08                	jns    801add <open+0x57>
+    return r;
+  801ad5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ad8:	e9 84 00 00 00       	jmp    801b61 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801add:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ae1:	48 89 c6             	mov    %rax,%rsi
+  801ae4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801aeb:	00 00 00 
+  801aee:	48 89 c7             	mov    %rax,%rdi
+  801af1:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801afd:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b04:	00 00 00 
+  801b07:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b0a:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b14:	48 89 c6             	mov    %rax,%rsi
+  801b17:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b1c:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801b23:	00 00 00 
+  801b26:	ff d0                	call   *%rax
+  801b28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b2f:	79 1d                	jns    801b4e <open+0xc8>
+    fd_close(fd, 0);
+  801b31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b35:	be 00 00 00 00       	mov    $0x0,%esi
+  801b3a:	48 89 c7             	mov    %rax,%rdi
+  801b3d:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+    return r;
+  801b49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b4c:	eb 13                	jmp    801b61 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b52:	48 89 c7             	mov    %rax,%rdi
+  801b55:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+}
+  801b61:	c9                   	leave
+  801b62:	c3                   	ret
+
+0000000000801b63 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+  801b67:	48 83 ec 10          	sub    $0x10,%rsp
+  801b6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b73:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b76:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b7d:	00 00 00 
+  801b80:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b82:	be 00 00 00 00       	mov    $0x0,%esi
+  801b87:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b8c:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801b93:	00 00 00 
+  801b96:	ff d0                	call   *%rax
+}
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+0000000000801b9a <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	48 83 ec 30          	sub    $0x30,%rsp
+  801ba2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ba6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801baa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801bae:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bb3:	74 07                	je     801bbc <devfile_read+0x22>
+  801bb5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bba:	75 0a                	jne    801bc6 <devfile_read+0x2c>
+  return E_INVAL;
+  801bbc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bc1:	e9 b4 00 00 00       	jmp    801c7a <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bc6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bcd:	00 
+  while (n) {
+  801bce:	e9 98 00 00 00       	jmp    801c6b <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bd7:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bda:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801be1:	00 00 00 
+  801be4:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801be6:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bed:	00 00 00 
+  801bf0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  801bfd:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c02:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+  801c0e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c11:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c15:	7f 13                	jg     801c2a <devfile_read+0x90>
+      return res ? res : res0;
+  801c17:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c1b:	74 07                	je     801c24 <devfile_read+0x8a>
+  801c1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c20:	48 98                	cltq
+  801c22:	eb 56                	jmp    801c7a <devfile_read+0xe0>
+  801c24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c28:	eb 50                	jmp    801c7a <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c2a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c2d:	48 63 d0             	movslq %eax,%rdx
+  801c30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c34:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c3b:	00 00 00 
+  801c3e:	48 89 ce             	mov    %rcx,%rsi
+  801c41:	48 89 c7             	mov    %rax,%rdi
+  801c44:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  801c4b:	00 00 00 
+  801c4e:	ff d0                	call   *%rax
+
+    buf += res;
+  801c50:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c53:	48 98                	cltq
+  801c55:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c59:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c5c:	48 98                	cltq
+  801c5e:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c65:	48 98                	cltq
+  801c67:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c6b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c70:	0f 85 5d ff ff ff    	jne    801bd3 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c7a:	c9                   	leave
+  801c7b:	c3                   	ret
+
+0000000000801c7c <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c7c:	55                   	push   %rbp
+  801c7d:	48 89 e5             	mov    %rsp,%rbp
+  801c80:	48 83 ec 50          	sub    $0x50,%rsp
+  801c84:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c88:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c8c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c90:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c95:	74 07                	je     801c9e <devfile_write+0x22>
+  801c97:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c9c:	75 0a                	jne    801ca8 <devfile_write+0x2c>
+  return E_INVAL;
+  801c9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ca3:	e9 c9 00 00 00       	jmp    801d71 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801ca8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801caf:	00 
+
+  while (n) {
+  801cb0:	e9 ad 00 00 00       	jmp    801d62 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cb5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801cbd:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cc4:	00 
+  801cc5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ccd:	48 39 c2             	cmp    %rax,%rdx
+  801cd0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801cd4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cd8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cdc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801ce0:	48 89 c6             	mov    %rax,%rsi
+  801ce3:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cea:	00 00 00 
+  801ced:	48 89 c7             	mov    %rax,%rdi
+  801cf0:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  801cf7:	00 00 00 
+  801cfa:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cfc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d00:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d03:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d0a:	00 00 00 
+  801d0d:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d0f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d16:	00 00 00 
+  801d19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d1d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d21:	be 00 00 00 00       	mov    $0x0,%esi
+  801d26:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d2b:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801d32:	00 00 00 
+  801d35:	ff d0                	call   *%rax
+  801d37:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d3a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d3e:	79 07                	jns    801d47 <devfile_write+0xcb>
+      return res;
+  801d40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d43:	48 98                	cltq
+  801d45:	eb 2a                	jmp    801d71 <devfile_write+0xf5>
+
+    buf += res;
+  801d47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d4a:	48 98                	cltq
+  801d4c:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d53:	48 98                	cltq
+  801d55:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d5c:	48 98                	cltq
+  801d5e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d62:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d67:	0f 85 48 ff ff ff    	jne    801cb5 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+
+0000000000801d73 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	48 83 ec 20          	sub    $0x20,%rsp
+  801d7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d7f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d87:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d8a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d91:	00 00 00 
+  801d94:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d96:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9b:	bf 05 00 00 00       	mov    $0x5,%edi
+  801da0:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801da7:	00 00 00 
+  801daa:	ff d0                	call   *%rax
+  801dac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801daf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801db3:	79 05                	jns    801dba <devfile_stat+0x47>
+    return r;
+  801db5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801db8:	eb 59                	jmp    801e13 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dbe:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dc5:	00 00 00 
+  801dc8:	48 89 d6             	mov    %rdx,%rsi
+  801dcb:	48 89 c7             	mov    %rax,%rdi
+  801dce:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  801dd5:	00 00 00 
+  801dd8:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dda:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801de1:	00 00 00 
+  801de4:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801dea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dee:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801df4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dfb:	00 00 00 
+  801dfe:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e08:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+
+0000000000801e15 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+  801e19:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e21:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e28:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e2b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e32:	00 00 00 
+  801e35:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e37:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e3e:	00 00 00 
+  801e41:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e44:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e47:	be 00 00 00 00       	mov    $0x0,%esi
+  801e4c:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e51:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801e58:	00 00 00 
+  801e5b:	ff d0                	call   *%rax
+}
+  801e5d:	c9                   	leave
+  801e5e:	c3                   	ret
+
+0000000000801e5f <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e5f:	55                   	push   %rbp
+  801e60:	48 89 e5             	mov    %rsp,%rbp
+  801e63:	48 83 ec 18          	sub    $0x18,%rsp
+  801e67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e6b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e6e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e75:	83 e0 03             	and    $0x3,%eax
+}
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+
+0000000000801e7a <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e7a:	55                   	push   %rbp
+  801e7b:	48 89 e5             	mov    %rsp,%rbp
+  801e7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8a:	48 89 c7             	mov    %rax,%rdi
+  801e8d:	48 b8 09 40 80 00 00 	movabs $0x804009,%rax
+  801e94:	00 00 00 
+  801e97:	ff d0                	call   *%rax
+  801e99:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e9e:	7e 07                	jle    801ea7 <remove+0x2d>
+    return -E_BAD_PATH;
+  801ea0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea5:	eb 36                	jmp    801edd <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801ea7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eab:	48 89 c6             	mov    %rax,%rsi
+  801eae:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801eb5:	00 00 00 
+  801eb8:	48 89 c7             	mov    %rax,%rdi
+  801ebb:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecc:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ed1:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+}
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+
+0000000000801edf <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801edf:	55                   	push   %rbp
+  801ee0:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee8:	bf 08 00 00 00       	mov    $0x8,%edi
+  801eed:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+}
+  801ef9:	5d                   	pop    %rbp
+  801efa:	c3                   	ret
+
+0000000000801efb <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801efb:	55                   	push   %rbp
+  801efc:	48 89 e5             	mov    %rsp,%rbp
+  801eff:	48 83 ec 20          	sub    $0x20,%rsp
+  801f03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f07:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0c:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f11:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801f18:	00 00 00 
+  801f1b:	ff d0                	call   *%rax
+  801f1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f20:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f24:	79 05                	jns    801f2b <fs_stats+0x30>
+    return r;
+  801f26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f29:	eb 2a                	jmp    801f55 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f2f:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f34:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f3b:	00 00 00 
+  801f3e:	48 89 ce             	mov    %rcx,%rsi
+  801f41:	48 89 c7             	mov    %rax,%rdi
+  801f44:	48 b8 4d 46 80 00 00 	movabs $0x80464d,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  return 0;
+  801f50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+
+0000000000801f57 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f57:	55                   	push   %rbp
+  801f58:	48 89 e5             	mov    %rsp,%rbp
+  801f5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f62:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f69:	00 00 00 
+  801f6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f6f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f71:	be 00 00 00 00       	mov    $0x0,%esi
+  801f76:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f7b:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+}
+  801f87:	c9                   	leave
+  801f88:	c3                   	ret
+
+0000000000801f89 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f89:	55                   	push   %rbp
+  801f8a:	48 89 e5             	mov    %rsp,%rbp
+  801f8d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f91:	89 f8                	mov    %edi,%eax
+  801f93:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f96:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801f9a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fa1:	00 00 00 
+  801fa4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801fab:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fb0:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+}
+  801fbc:	c9                   	leave
+  801fbd:	c3                   	ret
+
+0000000000801fbe <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fce:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fd3:	48 89 c7             	mov    %rax,%rdi
+  801fd6:	48 b8 e4 1f 80 00 00 	movabs $0x801fe4,%rax
+  801fdd:	00 00 00 
+  801fe0:	ff d0                	call   *%rax
+}
+  801fe2:	c9                   	leave
+  801fe3:	c3                   	ret
+
+0000000000801fe4 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fe4:	55                   	push   %rbp
+  801fe5:	48 89 e5             	mov    %rsp,%rbp
+  801fe8:	48 83 ec 50          	sub    $0x50,%rsp
+  801fec:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801ff0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801ff4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ffb:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  801ffc:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802001:	74 0a                	je     80200d <pipe_size+0x29>
+  802003:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80200a:	00 
+  80200b:	76 0a                	jbe    802017 <pipe_size+0x33>
+    return -E_INVAL;
+  80200d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802012:	e9 cc 02 00 00       	jmp    8022e3 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802017:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80201b:	48 89 c7             	mov    %rax,%rdi
+  80201e:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+  80202a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80202d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802031:	0f 88 a8 02 00 00    	js     8022df <pipe_size+0x2fb>
+  802037:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80203b:	ba 07 04 00 00       	mov    $0x407,%edx
+  802040:	48 89 c6             	mov    %rax,%rsi
+  802043:	bf 00 00 00 00       	mov    $0x0,%edi
+  802048:	48 b8 ab 03 80 00 00 	movabs $0x8003ab,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802057:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80205b:	0f 88 7e 02 00 00    	js     8022df <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802061:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802065:	48 89 c7             	mov    %rax,%rdi
+  802068:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+  802074:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802077:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80207b:	0f 88 43 02 00 00    	js     8022c4 <pipe_size+0x2e0>
+  802081:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802085:	ba 07 04 00 00       	mov    $0x407,%edx
+  80208a:	48 89 c6             	mov    %rax,%rsi
+  80208d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802092:	48 b8 ab 03 80 00 00 	movabs $0x8003ab,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+  80209e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020a5:	0f 88 19 02 00 00    	js     8022c4 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020af:	48 89 c7             	mov    %rax,%rdi
+  8020b2:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+  8020be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020c2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020c9:	00 
+  8020ca:	e9 a2 00 00 00       	jmp    802171 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020d3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020d7:	48 89 c2             	mov    %rax,%rdx
+  8020da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020de:	48 01 d0             	add    %rdx,%rax
+  8020e1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020e6:	48 89 c6             	mov    %rax,%rsi
+  8020e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ee:	48 b8 ab 03 80 00 00 	movabs $0x8003ab,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802101:	0f 88 37 01 00 00    	js     80223e <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802107:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80210b:	48 89 c7             	mov    %rax,%rdi
+  80210e:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802115:	00 00 00 
+  802118:	ff d0                	call   *%rax
+  80211a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80211e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802122:	48 01 c2             	add    %rax,%rdx
+  802125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802129:	48 c1 e0 0c          	shl    $0xc,%rax
+  80212d:	48 89 c1             	mov    %rax,%rcx
+  802130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802134:	48 01 c8             	add    %rcx,%rax
+  802137:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80213d:	48 89 d1             	mov    %rdx,%rcx
+  802140:	ba 00 00 00 00       	mov    $0x0,%edx
+  802145:	48 89 c6             	mov    %rax,%rsi
+  802148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80214d:	48 b8 03 04 80 00 00 	movabs $0x800403,%rax
+  802154:	00 00 00 
+  802157:	ff d0                	call   *%rax
+  802159:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80215c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802160:	79 0a                	jns    80216c <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802162:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802167:	e9 d3 00 00 00       	jmp    80223f <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80216c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802171:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  802178:	00 
+  802179:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80217d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802181:	48 01 d0             	add    %rdx,%rax
+  802184:	48 83 c0 1f          	add    $0x1f,%rax
+  802188:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80218c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802190:	ba 00 00 00 00       	mov    $0x0,%edx
+  802195:	48 f7 75 e0          	divq   -0x20(%rbp)
+  802199:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80219d:	48 29 d0             	sub    %rdx,%rax
+  8021a0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021a4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021a8:	0f 82 21 ff ff ff    	jb     8020cf <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ba:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021be:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c6:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021cd:	00 00 00 
+  8021d0:	8b 12                	mov    (%rdx),%edx
+  8021d2:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e3:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021ea:	00 00 00 
+  8021ed:	8b 12                	mov    (%rdx),%edx
+  8021ef:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8021fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802200:	48 89 c7             	mov    %rax,%rdi
+  802203:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  80220a:	00 00 00 
+  80220d:	ff d0                	call   *%rax
+  80220f:	89 c2                	mov    %eax,%edx
+  802211:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802215:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802217:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80221b:	48 89 c7             	mov    %rax,%rdi
+  80221e:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+  80222a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80222e:	48 83 c2 04          	add    $0x4,%rdx
+  802232:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+  802239:	e9 a5 00 00 00       	jmp    8022e3 <pipe_size+0x2ff>
+      goto err2;
+  80223e:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80223f:	eb 58                	jmp    802299 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802241:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802245:	48 c1 e0 0c          	shl    $0xc,%rax
+  802249:	48 89 c2             	mov    %rax,%rdx
+  80224c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802250:	48 01 d0             	add    %rdx,%rax
+  802253:	48 89 c6             	mov    %rax,%rsi
+  802256:	bf 00 00 00 00       	mov    $0x0,%edi
+  80225b:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802267:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80226b:	48 89 c7             	mov    %rax,%rdi
+  80226e:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+  80227a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80227e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802282:	48 01 d0             	add    %rdx,%rax
+  802285:	48 89 c6             	mov    %rax,%rsi
+  802288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80228d:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  802299:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80229d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022a1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022a5:	48 85 c0             	test   %rax,%rax
+  8022a8:	75 97                	jne    802241 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ae:	48 89 c6             	mov    %rax,%rsi
+  8022b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b6:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	eb 01                	jmp    8022c5 <pipe_size+0x2e1>
+    goto err1;
+  8022c4:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022c9:	48 89 c6             	mov    %rax,%rsi
+  8022cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d1:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+  8022dd:	eb 01                	jmp    8022e0 <pipe_size+0x2fc>
+    goto err;
+  8022df:	90                   	nop
+err:
+  return r;
+  8022e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+
+00000000008022e5 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022e5:	55                   	push   %rbp
+  8022e6:	48 89 e5             	mov    %rsp,%rbp
+  8022e9:	53                   	push   %rbx
+  8022ea:	48 83 ec 28          	sub    $0x28,%rsp
+  8022ee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022f2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022f6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022fd:	00 00 00 
+  802300:	8b 40 04             	mov    0x4(%rax),%eax
+  802303:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802308:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80230f:	00 00 00 
+  802312:	48 98                	cltq
+  802314:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80231b:	48 01 d0             	add    %rdx,%rax
+  80231e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802324:	8b 00                	mov    (%rax),%eax
+  802326:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  802329:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80232d:	48 89 c7             	mov    %rax,%rdi
+  802330:	48 b8 c3 4e 80 00 00 	movabs $0x804ec3,%rax
+  802337:	00 00 00 
+  80233a:	ff d0                	call   *%rax
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802342:	48 89 c7             	mov    %rax,%rdi
+  802345:	48 b8 c3 4e 80 00 00 	movabs $0x804ec3,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	39 c3                	cmp    %eax,%ebx
+  802353:	0f 94 c0             	sete   %al
+  802356:	0f b6 c0             	movzbl %al,%eax
+  802359:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80235c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802363:	00 00 00 
+  802366:	8b 40 04             	mov    0x4(%rax),%eax
+  802369:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80236e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802375:	00 00 00 
+  802378:	48 98                	cltq
+  80237a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802381:	48 01 d0             	add    %rdx,%rax
+  802384:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80238a:	8b 00                	mov    (%rax),%eax
+  80238c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80238f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802392:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802395:	75 05                	jne    80239c <_pipeisclosed+0xb7>
+      return ret;
+  802397:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80239a:	eb 68                	jmp    802404 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80239c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80239f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023a2:	0f 84 4e ff ff ff    	je     8022f6 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023a8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023af:	00 00 00 
+  8023b2:	8b 40 04             	mov    0x4(%rax),%eax
+  8023b5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023ba:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023c1:	00 00 00 
+  8023c4:	48 98                	cltq
+  8023c6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023cd:	48 01 d0             	add    %rdx,%rax
+  8023d0:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023d6:	8b 10                	mov    (%rax),%edx
+  8023d8:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023de:	89 c6                	mov    %eax,%esi
+  8023e0:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023e7:	00 00 00 
+  8023ea:	48 89 c7             	mov    %rax,%rdi
+  8023ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f2:	49 b8 5a 31 80 00 00 	movabs $0x80315a,%r8
+  8023f9:	00 00 00 
+  8023fc:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8023ff:	e9 f2 fe ff ff       	jmp    8022f6 <_pipeisclosed+0x11>
+  }
+}
+  802404:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802408:	c9                   	leave
+  802409:	c3                   	ret
+
+000000000080240a <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80240a:	55                   	push   %rbp
+  80240b:	48 89 e5             	mov    %rsp,%rbp
+  80240e:	48 83 ec 30          	sub    $0x30,%rsp
+  802412:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802415:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802419:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80241c:	48 89 d6             	mov    %rdx,%rsi
+  80241f:	89 c7                	mov    %eax,%edi
+  802421:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+  80242d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802430:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802434:	79 05                	jns    80243b <pipeisclosed+0x31>
+    return r;
+  802436:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802439:	eb 31                	jmp    80246c <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80243b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80243f:	48 89 c7             	mov    %rax,%rdi
+  802442:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802452:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802456:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80245a:	48 89 d6             	mov    %rdx,%rsi
+  80245d:	48 89 c7             	mov    %rax,%rdi
+  802460:	48 b8 e5 22 80 00 00 	movabs $0x8022e5,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+}
+  80246c:	c9                   	leave
+  80246d:	c3                   	ret
+
+000000000080246e <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80246e:	55                   	push   %rbp
+  80246f:	48 89 e5             	mov    %rsp,%rbp
+  802472:	48 83 ec 10          	sub    $0x10,%rsp
+  802476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80247a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247e:	8b 40 18             	mov    0x18(%rax),%eax
+  802481:	8d 50 01             	lea    0x1(%rax),%edx
+  802484:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802488:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80248b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248f:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802492:	85 c0                	test   %eax,%eax
+  802494:	74 27                	je     8024bd <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a5:	48 83 c0 18          	add    $0x18,%rax
+  8024a9:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024ae:	48 89 c7             	mov    %rax,%rdi
+  8024b1:	48 b8 a6 07 80 00 00 	movabs $0x8007a6,%rax
+  8024b8:	00 00 00 
+  8024bb:	ff d0                	call   *%rax
+  }
+}
+  8024bd:	90                   	nop
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+
+00000000008024c0 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024c0:	55                   	push   %rbp
+  8024c1:	48 89 e5             	mov    %rsp,%rbp
+  8024c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d3:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024de:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024e5:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024ec:	89 c6                	mov    %eax,%esi
+  8024ee:	48 89 cf             	mov    %rcx,%rdi
+  8024f1:	48 b8 57 07 80 00 00 	movabs $0x800757,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+}
+  8024fd:	90                   	nop
+  8024fe:	c9                   	leave
+  8024ff:	c3                   	ret
+
+0000000000802500 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	48 83 ec 70          	sub    $0x70,%rsp
+  802508:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80250c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802510:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802514:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802518:	48 89 c7             	mov    %rax,%rdi
+  80251b:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+  802527:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80252b:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802530:	75 0a                	jne    80253c <devpipe_read+0x3c>
+    return 0;
+  802532:	b8 00 00 00 00       	mov    $0x0,%eax
+  802537:	e9 63 01 00 00       	jmp    80269f <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80253c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802540:	8b 40 18             	mov    0x18(%rax),%eax
+  802543:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802546:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254a:	48 8b 10             	mov    (%rax),%rdx
+  80254d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802551:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802555:	48 39 c2             	cmp    %rax,%rdx
+  802558:	75 42                	jne    80259c <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80255a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80255e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802562:	48 89 d6             	mov    %rdx,%rsi
+  802565:	48 89 c7             	mov    %rax,%rdi
+  802568:	48 b8 e5 22 80 00 00 	movabs $0x8022e5,%rax
+  80256f:	00 00 00 
+  802572:	ff d0                	call   *%rax
+  802574:	85 c0                	test   %eax,%eax
+  802576:	74 0a                	je     802582 <devpipe_read+0x82>
+      return 0;
+  802578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257d:	e9 1d 01 00 00       	jmp    80269f <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802582:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802589:	89 d6                	mov    %edx,%esi
+  80258b:	48 89 c7             	mov    %rax,%rdi
+  80258e:	48 b8 c0 24 80 00 00 	movabs $0x8024c0,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80259a:	eb a0                	jmp    80253c <devpipe_read+0x3c>
+      break;
+  80259c:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80259d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025a1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025a9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b9:	48 8b 00             	mov    (%rax),%rax
+  8025bc:	48 29 c2             	sub    %rax,%rdx
+  8025bf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025cb:	48 39 c2             	cmp    %rax,%rdx
+  8025ce:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025d2:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025da:	48 8b 00             	mov    (%rax),%rax
+  8025dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025e1:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ea:	48 f7 f1             	div    %rcx
+  8025ed:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025f1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025fd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802601:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802605:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802609:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80260d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802611:	48 39 c2             	cmp    %rax,%rdx
+  802614:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802618:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80261c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802620:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802624:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802628:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80262c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802630:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802634:	48 89 ce             	mov    %rcx,%rsi
+  802637:	48 89 c7             	mov    %rax,%rdi
+  80263a:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802646:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80264a:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80264e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802652:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802656:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80265a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80265e:	48 01 d1             	add    %rdx,%rcx
+  802661:	48 89 c2             	mov    %rax,%rdx
+  802664:	48 89 cf             	mov    %rcx,%rdi
+  802667:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802677:	48 8b 10             	mov    (%rax),%rdx
+  80267a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80267e:	48 01 c2             	add    %rax,%rdx
+  802681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802685:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  802688:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80268c:	48 89 c7             	mov    %rax,%rdi
+  80268f:	48 b8 6e 24 80 00 00 	movabs $0x80246e,%rax
+  802696:	00 00 00 
+  802699:	ff d0                	call   *%rax
+  return n;
+  80269b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+00000000008026a1 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+  8026a5:	48 83 ec 70          	sub    $0x70,%rsp
+  8026a9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026ad:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026b1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026b5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026b9:	48 89 c7             	mov    %rax,%rdi
+  8026bc:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+  8026c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026d0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026d4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026db:	00 
+  8026dc:	e9 b8 01 00 00       	jmp    802899 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e5:	8b 40 18             	mov    0x18(%rax),%eax
+  8026e8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ef:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f7:	48 8b 00             	mov    (%rax),%rax
+  8026fa:	48 29 c2             	sub    %rax,%rdx
+  8026fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802701:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802705:	48 39 c2             	cmp    %rax,%rdx
+  802708:	75 4d                	jne    802757 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80270a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80270e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802712:	48 89 d6             	mov    %rdx,%rsi
+  802715:	48 89 c7             	mov    %rax,%rdi
+  802718:	48 b8 e5 22 80 00 00 	movabs $0x8022e5,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+  802724:	85 c0                	test   %eax,%eax
+  802726:	74 0a                	je     802732 <devpipe_write+0x91>
+        return 0;
+  802728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272d:	e9 79 01 00 00       	jmp    8028ab <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802732:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802735:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802739:	89 d6                	mov    %edx,%esi
+  80273b:	48 89 c7             	mov    %rax,%rdi
+  80273e:	48 b8 c0 24 80 00 00 	movabs $0x8024c0,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+      m = 0;
+  80274a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802751:	00 
+      continue;
+  802752:	e9 3a 01 00 00       	jmp    802891 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802757:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80275b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80275f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802767:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80276b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276f:	48 8b 08             	mov    (%rax),%rcx
+  802772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802776:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80277a:	48 29 c1             	sub    %rax,%rcx
+  80277d:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802781:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802785:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802789:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80278d:	48 39 c2             	cmp    %rax,%rdx
+  802790:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802794:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  802798:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80279c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027a4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ad:	48 f7 f1             	div    %rcx
+  8027b0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027b8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027c4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027c8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027cc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027d4:	48 39 c2             	cmp    %rax,%rdx
+  8027d7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027e3:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027eb:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027f3:	48 01 d1             	add    %rdx,%rcx
+  8027f6:	48 89 c2             	mov    %rax,%rdx
+  8027f9:	48 89 cf             	mov    %rcx,%rdi
+  8027fc:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  802808:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80280c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802810:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802814:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802818:	73 4d                	jae    802867 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80281a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802826:	48 29 c2             	sub    %rax,%rdx
+  802829:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80282d:	48 01 c2             	add    %rax,%rdx
+  802830:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802834:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802838:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80283c:	48 89 c1             	mov    %rax,%rcx
+  80283f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802843:	48 01 c1             	add    %rax,%rcx
+  802846:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80284a:	48 01 c1             	add    %rax,%rcx
+  80284d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802851:	48 83 c0 20          	add    $0x20,%rax
+  802855:	48 89 ce             	mov    %rcx,%rsi
+  802858:	48 89 c7             	mov    %rax,%rdi
+  80285b:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80286b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80286f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802873:	48 01 c2             	add    %rax,%rdx
+  802876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80287e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802882:	48 89 c7             	mov    %rax,%rdi
+  802885:	48 b8 6e 24 80 00 00 	movabs $0x80246e,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802891:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802895:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  802899:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289d:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028a1:	0f 82 3a fe ff ff    	jb     8026e1 <devpipe_write+0x40>
+  }
+
+  return i;
+  8028a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028ab:	c9                   	leave
+  8028ac:	c3                   	ret
+
+00000000008028ad <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028ad:	55                   	push   %rbp
+  8028ae:	48 89 e5             	mov    %rsp,%rbp
+  8028b1:	48 83 ec 40          	sub    $0x40,%rsp
+  8028b5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028b9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028c4:	48 89 c7             	mov    %rax,%rdi
+  8028c7:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+  8028d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028e2:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028ea:	48 89 d6             	mov    %rdx,%rsi
+  8028ed:	48 89 c7             	mov    %rax,%rdi
+  8028f0:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+  8028fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802903:	79 08                	jns    80290d <devpipe_poll+0x60>
+    return r;
+  802905:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802908:	e9 85 00 00 00       	jmp    802992 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80290d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802910:	83 e0 01             	and    $0x1,%eax
+  802913:	85 c0                	test   %eax,%eax
+  802915:	74 18                	je     80292f <devpipe_poll+0x82>
+  802917:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80291b:	48 8b 10             	mov    (%rax),%rdx
+  80291e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802922:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802926:	48 39 c2             	cmp    %rax,%rdx
+  802929:	74 04                	je     80292f <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80292b:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80292f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802932:	83 e0 02             	and    $0x2,%eax
+  802935:	85 c0                	test   %eax,%eax
+  802937:	74 23                	je     80295c <devpipe_poll+0xaf>
+  802939:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80293d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802941:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802945:	48 8b 00             	mov    (%rax),%rax
+  802948:	48 29 c2             	sub    %rax,%rdx
+  80294b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802953:	48 39 c2             	cmp    %rax,%rdx
+  802956:	73 04                	jae    80295c <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  802958:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80295c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802960:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802964:	48 89 d6             	mov    %rdx,%rsi
+  802967:	48 89 c7             	mov    %rax,%rdi
+  80296a:	48 b8 e5 22 80 00 00 	movabs $0x8022e5,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	85 c0                	test   %eax,%eax
+  802978:	74 04                	je     80297e <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80297a:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80297e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802982:	75 0b                	jne    80298f <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802988:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80298f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+0000000000802994 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	48 83 ec 20          	sub    $0x20,%rsp
+  80299c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029a8:	48 89 c7             	mov    %rax,%rdi
+  8029ab:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+  8029b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029bf:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029c6:	00 00 00 
+  8029c9:	48 89 d6             	mov    %rdx,%rsi
+  8029cc:	48 89 c7             	mov    %rax,%rdi
+  8029cf:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029df:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029e3:	89 c1                	mov    %eax,%ecx
+  8029e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029e9:	48 8b 00             	mov    (%rax),%rax
+  8029ec:	89 c2                	mov    %eax,%edx
+  8029ee:	89 c8                	mov    %ecx,%eax
+  8029f0:	29 d0                	sub    %edx,%eax
+  8029f2:	89 c2                	mov    %eax,%edx
+  8029f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8029fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a02:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a09:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a10:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a17:	00 00 00 
+  802a1a:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a26:	c9                   	leave
+  802a27:	c3                   	ret
+
+0000000000802a28 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a28:	55                   	push   %rbp
+  802a29:	48 89 e5             	mov    %rsp,%rbp
+  802a2c:	48 83 ec 40          	sub    $0x40,%rsp
+  802a30:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a38:	48 89 c7             	mov    %rax,%rdi
+  802a3b:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802a42:	00 00 00 
+  802a45:	ff d0                	call   *%rax
+  802a47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a4b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a52:	00 
+  802a53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a57:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a5f:	48 01 d0             	add    %rdx,%rax
+  802a62:	48 83 c0 1f          	add    $0x1f,%rax
+  802a66:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a73:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a7b:	48 29 d0             	sub    %rdx,%rax
+  802a7e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a82:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a8a:	48 89 c6             	mov    %rax,%rsi
+  802a8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a92:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aa2:	48 89 c7             	mov    %rax,%rdi
+  802aa5:	48 b8 6e 24 80 00 00 	movabs $0x80246e,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ab1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802ab9:	eb 2f                	jmp    802aea <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802abb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802abf:	48 83 e8 01          	sub    $0x1,%rax
+  802ac3:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ac7:	48 89 c2             	mov    %rax,%rdx
+  802aca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ace:	48 01 d0             	add    %rdx,%rax
+  802ad1:	48 89 c6             	mov    %rax,%rsi
+  802ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad9:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  802ae0:	00 00 00 
+  802ae3:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ae5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802aea:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802aef:	77 ca                	ja     802abb <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802af1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802af5:	48 89 c6             	mov    %rax,%rsi
+  802af8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802afd:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+0000000000802b0b <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b0b:	55                   	push   %rbp
+  802b0c:	48 89 e5             	mov    %rsp,%rbp
+  802b0f:	48 83 ec 08          	sub    $0x8,%rsp
+  802b13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b1a:	75 10                	jne    802b2c <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b1c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b23:	00 00 00 
+  802b26:	8b 00                	mov    (%rax),%eax
+  802b28:	48 98                	cltq
+  802b2a:	eb 05                	jmp    802b31 <vsyscall+0x26>
+  }
+  return 0;
+  802b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b31:	c9                   	leave
+  802b32:	c3                   	ret
+
+0000000000802b33 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b33:	55                   	push   %rbp
+  802b34:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3c:	48 b8 0b 2b 80 00 00 	movabs $0x802b0b,%rax
+  802b43:	00 00 00 
+  802b46:	ff d0                	call   *%rax
+}
+  802b48:	5d                   	pop    %rbp
+  802b49:	c3                   	ret
+
+0000000000802b4a <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b52:	0f 31                	rdtsc
+  802b54:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b57:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b5d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b60:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b64:	48 09 d0             	or     %rdx,%rax
+  802b67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b73:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b7a:	00 00 00 
+  802b7d:	8b 40 08             	mov    0x8(%rax),%eax
+  802b80:	48 98                	cltq
+  802b82:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8f:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b93:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802b9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba3:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802ba7:	48 89 d0             	mov    %rdx,%rax
+  802baa:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb6:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bba:	48 01 c8             	add    %rcx,%rax
+}
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+0000000000802bbf <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+  802bc3:	48 83 ec 20          	sub    $0x20,%rsp
+  802bc7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bcd:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bd0:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bd4:	be 01 00 00 00       	mov    $0x1,%esi
+  802bd9:	48 89 c7             	mov    %rax,%rdi
+  802bdc:	48 b8 94 01 80 00 00 	movabs $0x800194,%rax
+  802be3:	00 00 00 
+  802be6:	ff d0                	call   *%rax
+}
+  802be8:	90                   	nop
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+
+0000000000802beb <getchar>:
+
+int
+getchar(void) {
+  802beb:	55                   	push   %rbp
+  802bec:	48 89 e5             	mov    %rsp,%rbp
+  802bef:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802bf3:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802bf7:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bfc:	48 89 c6             	mov    %rax,%rsi
+  802bff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c04:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  802c0b:	00 00 00 
+  802c0e:	ff d0                	call   *%rax
+  802c10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c17:	79 05                	jns    802c1e <getchar+0x33>
+    return r;
+  802c19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c1c:	eb 14                	jmp    802c32 <getchar+0x47>
+  if (r < 1)
+  802c1e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c22:	7f 07                	jg     802c2b <getchar+0x40>
+    return -E_EOF;
+  802c24:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c29:	eb 07                	jmp    802c32 <getchar+0x47>
+  return c;
+  802c2b:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c2f:	0f b6 c0             	movzbl %al,%eax
+}
+  802c32:	c9                   	leave
+  802c33:	c3                   	ret
+
+0000000000802c34 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c34:	55                   	push   %rbp
+  802c35:	48 89 e5             	mov    %rsp,%rbp
+  802c38:	48 83 ec 20          	sub    $0x20,%rsp
+  802c3c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c3f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c46:	48 89 d6             	mov    %rdx,%rsi
+  802c49:	89 c7                	mov    %eax,%edi
+  802c4b:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+  802c57:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c5a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c5e:	79 05                	jns    802c65 <iscons+0x31>
+    return r;
+  802c60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c63:	eb 1a                	jmp    802c7f <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c69:	8b 10                	mov    (%rax),%edx
+  802c6b:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c72:	00 00 00 
+  802c75:	8b 00                	mov    (%rax),%eax
+  802c77:	39 c2                	cmp    %eax,%edx
+  802c79:	0f 94 c0             	sete   %al
+  802c7c:	0f b6 c0             	movzbl %al,%eax
+}
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+
+0000000000802c81 <opencons>:
+
+int
+opencons(void) {
+  802c81:	55                   	push   %rbp
+  802c82:	48 89 e5             	mov    %rsp,%rbp
+  802c85:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c89:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c8d:	48 89 c7             	mov    %rax,%rdi
+  802c90:	48 b8 e0 0a 80 00 00 	movabs $0x800ae0,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+  802c9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca3:	79 05                	jns    802caa <opencons+0x29>
+    return r;
+  802ca5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ca8:	eb 66                	jmp    802d10 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802caa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cae:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cb3:	48 89 c6             	mov    %rax,%rsi
+  802cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cbb:	48 b8 ab 03 80 00 00 	movabs $0x8003ab,%rax
+  802cc2:	00 00 00 
+  802cc5:	ff d0                	call   *%rax
+  802cc7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cce:	79 05                	jns    802cd5 <opencons+0x54>
+    return r;
+  802cd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cd3:	eb 3b                	jmp    802d10 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802cd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cd9:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802ce0:	00 00 00 
+  802ce3:	8b 12                	mov    (%rdx),%edx
+  802ce5:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ceb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802cf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802cfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d01:	48 89 c7             	mov    %rax,%rdi
+  802d04:	48 b8 92 0a 80 00 00 	movabs $0x800a92,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+}
+  802d10:	c9                   	leave
+  802d11:	c3                   	ret
+
+0000000000802d12 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d12:	55                   	push   %rbp
+  802d13:	48 89 e5             	mov    %rsp,%rbp
+  802d16:	48 83 ec 20          	sub    $0x20,%rsp
+  802d1a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d1d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d20:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d27:	48 89 d6             	mov    %rdx,%rsi
+  802d2a:	89 c7                	mov    %eax,%edi
+  802d2c:	48 b8 c2 0b 80 00 00 	movabs $0x800bc2,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d3b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d3f:	79 05                	jns    802d46 <consmode+0x34>
+    return r;
+  802d41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d44:	eb 34                	jmp    802d7a <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d4a:	8b 10                	mov    (%rax),%edx
+  802d4c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d53:	00 00 00 
+  802d56:	8b 00                	mov    (%rax),%eax
+  802d58:	39 c2                	cmp    %eax,%edx
+  802d5a:	74 07                	je     802d63 <consmode+0x51>
+    return -E_INVAL;
+  802d5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d61:	eb 17                	jmp    802d7a <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d67:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d6a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d71:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d74:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d7a:	c9                   	leave
+  802d7b:	c3                   	ret
+
+0000000000802d7c <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d7c:	55                   	push   %rbp
+  802d7d:	48 89 e5             	mov    %rsp,%rbp
+  802d80:	48 83 ec 20          	sub    $0x20,%rsp
+  802d84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d8c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d94:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d97:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d9f:	48 89 ce             	mov    %rcx,%rsi
+  802da2:	48 89 c7             	mov    %rax,%rdi
+  802da5:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  802dac:	00 00 00 
+  802daf:	ff d0                	call   *%rax
+  802db1:	48 98                	cltq
+}
+  802db3:	c9                   	leave
+  802db4:	c3                   	ret
+
+0000000000802db5 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802db5:	55                   	push   %rbp
+  802db6:	48 89 e5             	mov    %rsp,%rbp
+  802db9:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dc0:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dc7:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dce:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802dd5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ddc:	eb 74                	jmp    802e52 <devcons_write+0x9d>
+    m = n - tot;
+  802dde:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802de5:	89 c2                	mov    %eax,%edx
+  802de7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dea:	29 c2                	sub    %eax,%edx
+  802dec:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802def:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802df2:	83 f8 7f             	cmp    $0x7f,%eax
+  802df5:	76 07                	jbe    802dfe <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802df7:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802dfe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e01:	48 63 d0             	movslq %eax,%rdx
+  802e04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e07:	48 63 c8             	movslq %eax,%rcx
+  802e0a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e11:	48 01 c1             	add    %rax,%rcx
+  802e14:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e1b:	48 89 ce             	mov    %rcx,%rsi
+  802e1e:	48 89 c7             	mov    %rax,%rdi
+  802e21:	48 b8 4d 46 80 00 00 	movabs $0x80464d,%rax
+  802e28:	00 00 00 
+  802e2b:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e30:	48 63 d0             	movslq %eax,%rdx
+  802e33:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e3a:	48 89 d6             	mov    %rdx,%rsi
+  802e3d:	48 89 c7             	mov    %rax,%rdi
+  802e40:	48 b8 94 01 80 00 00 	movabs $0x800194,%rax
+  802e47:	00 00 00 
+  802e4a:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e4c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e4f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e55:	48 98                	cltq
+  802e57:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e5e:	0f 82 7a ff ff ff    	jb     802dde <devcons_write+0x29>
+  }
+  return tot;
+  802e64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e67:	48 98                	cltq
+}
+  802e69:	c9                   	leave
+  802e6a:	c3                   	ret
+
+0000000000802e6b <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	48 83 ec 08          	sub    $0x8,%rsp
+  802e73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e7c:	c9                   	leave
+  802e7d:	c3                   	ret
+
+0000000000802e7e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e7e:	55                   	push   %rbp
+  802e7f:	48 89 e5             	mov    %rsp,%rbp
+  802e82:	48 83 ec 10          	sub    $0x10,%rsp
+  802e86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e8a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e92:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e99:	00 00 00 
+  802e9c:	48 89 d6             	mov    %rdx,%rsi
+  802e9f:	48 89 c7             	mov    %rax,%rdi
+  802ea2:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  return 0;
+  802eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eb3:	c9                   	leave
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802eb5:	55                   	push   %rbp
+  802eb6:	48 89 e5             	mov    %rsp,%rbp
+  802eb9:	48 83 ec 30          	sub    $0x30,%rsp
+  802ebd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ec1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802ec4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802ec8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ecf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ed2:	83 e0 02             	and    $0x2,%eax
+  802ed5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802ed8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802edc:	8b 40 0c             	mov    0xc(%rax),%eax
+  802edf:	83 f8 01             	cmp    $0x1,%eax
+  802ee2:	75 04                	jne    802ee8 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ee4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802ee8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802eeb:	83 e0 01             	and    $0x1,%eax
+  802eee:	85 c0                	test   %eax,%eax
+  802ef0:	74 44                	je     802f36 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802ef2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802efa:	89 c2                	mov    %eax,%edx
+  802efc:	be 00 00 00 00       	mov    $0x0,%esi
+  802f01:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f06:	48 b8 f3 07 80 00 00 	movabs $0x8007f3,%rax
+  802f0d:	00 00 00 
+  802f10:	ff d0                	call   *%rax
+  802f12:	83 f8 01             	cmp    $0x1,%eax
+  802f15:	75 06                	jne    802f1d <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f17:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f1b:	eb 19                	jmp    802f36 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f21:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f27:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f2a:	89 c2                	mov    %eax,%edx
+  802f2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f30:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f36:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f39:	c9                   	leave
+  802f3a:	c3                   	ret
+
+0000000000802f3b <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f3b:	55                   	push   %rbp
+  802f3c:	48 89 e5             	mov    %rsp,%rbp
+  802f3f:	53                   	push   %rbx
+  802f40:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f47:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f4e:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f54:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f5b:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f62:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f69:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f70:	84 c0                	test   %al,%al
+  802f72:	74 23                	je     802f97 <_panic+0x5c>
+  802f74:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f7b:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f7f:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f83:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f87:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f8b:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f8f:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f93:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f97:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802f9e:	00 00 00 
+  802fa1:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fa8:	00 00 00 
+  802fab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802faf:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fb6:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fbd:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fc4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fcb:	00 00 00 
+  802fce:	48 8b 18             	mov    (%rax),%rbx
+  802fd1:	48 b8 32 03 80 00 00 	movabs $0x800332,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+  802fdd:	89 c6                	mov    %eax,%esi
+  802fdf:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802fe5:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802fec:	41 89 d0             	mov    %edx,%r8d
+  802fef:	48 89 c1             	mov    %rax,%rcx
+  802ff2:	48 89 da             	mov    %rbx,%rdx
+  802ff5:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  802ffc:	00 00 00 
+  802fff:	48 89 c7             	mov    %rax,%rdi
+  803002:	b8 00 00 00 00       	mov    $0x0,%eax
+  803007:	49 b9 5a 31 80 00 00 	movabs $0x80315a,%r9
+  80300e:	00 00 00 
+  803011:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803014:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80301b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803022:	48 89 d6             	mov    %rdx,%rsi
+  803025:	48 89 c7             	mov    %rax,%rdi
+  803028:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  80302f:	00 00 00 
+  803032:	ff d0                	call   *%rax
+  cprintf("\n");
+  803034:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  80303b:	00 00 00 
+  80303e:	48 89 c7             	mov    %rax,%rdi
+  803041:	b8 00 00 00 00       	mov    $0x0,%eax
+  803046:	48 ba 5a 31 80 00 00 	movabs $0x80315a,%rdx
+  80304d:	00 00 00 
+  803050:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803052:	cc                   	int3
+  803053:	eb fd                	jmp    803052 <_panic+0x117>
+
+0000000000803055 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	48 83 ec 10          	sub    $0x10,%rsp
+  80305d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803060:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803068:	8b 00                	mov    (%rax),%eax
+  80306a:	8d 48 01             	lea    0x1(%rax),%ecx
+  80306d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803071:	89 0a                	mov    %ecx,(%rdx)
+  803073:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803076:	89 d1                	mov    %edx,%ecx
+  803078:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80307c:	48 98                	cltq
+  80307e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803082:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803086:	8b 00                	mov    (%rax),%eax
+  803088:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80308d:	75 2c                	jne    8030bb <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80308f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803093:	8b 00                	mov    (%rax),%eax
+  803095:	48 98                	cltq
+  803097:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80309b:	48 83 c2 08          	add    $0x8,%rdx
+  80309f:	48 89 c6             	mov    %rax,%rsi
+  8030a2:	48 89 d7             	mov    %rdx,%rdi
+  8030a5:	48 b8 94 01 80 00 00 	movabs $0x800194,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bf:	8b 40 04             	mov    0x4(%rax),%eax
+  8030c2:	8d 50 01             	lea    0x1(%rax),%edx
+  8030c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c9:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030cc:	90                   	nop
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+00000000008030cf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030cf:	55                   	push   %rbp
+  8030d0:	48 89 e5             	mov    %rsp,%rbp
+  8030d3:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030da:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030e1:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030e8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030ef:	00 00 00 
+  b.cnt = 0;
+  8030f2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030f9:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8030fc:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803103:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80310a:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803111:	48 89 c6             	mov    %rax,%rsi
+  803114:	48 b8 55 30 80 00 00 	movabs $0x803055,%rax
+  80311b:	00 00 00 
+  80311e:	48 89 c7             	mov    %rax,%rdi
+  803121:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80312d:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803133:	48 98                	cltq
+  803135:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80313c:	48 83 c2 08          	add    $0x8,%rdx
+  803140:	48 89 c6             	mov    %rax,%rsi
+  803143:	48 89 d7             	mov    %rdx,%rdi
+  803146:	48 b8 94 01 80 00 00 	movabs $0x800194,%rax
+  80314d:	00 00 00 
+  803150:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803152:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  803158:	c9                   	leave
+  803159:	c3                   	ret
+
+000000000080315a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80315a:	55                   	push   %rbp
+  80315b:	48 89 e5             	mov    %rsp,%rbp
+  80315e:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803165:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80316c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803173:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80317a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803181:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803188:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80318f:	84 c0                	test   %al,%al
+  803191:	74 20                	je     8031b3 <cprintf+0x59>
+  803193:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803197:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80319b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80319f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031a3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031a7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031ab:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031af:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031b3:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031ba:	00 00 00 
+  8031bd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031c4:	00 00 00 
+  8031c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031cb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031d2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031d9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031e0:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031e7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031ee:	48 89 d6             	mov    %rdx,%rsi
+  8031f1:	48 89 c7             	mov    %rax,%rdi
+  8031f4:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+  803200:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803206:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80320c:	c9                   	leave
+  80320d:	c3                   	ret
+
+000000000080320e <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80320e:	55                   	push   %rbp
+  80320f:	48 89 e5             	mov    %rsp,%rbp
+  803212:	48 83 ec 30          	sub    $0x30,%rsp
+  803216:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80321a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80321e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803222:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803225:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  803229:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80322d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803230:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803234:	72 54                	jb     80328a <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803236:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803239:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80323c:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80323f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803243:	ba 00 00 00 00       	mov    $0x0,%edx
+  803248:	48 f7 f6             	div    %rsi
+  80324b:	49 89 c2             	mov    %rax,%r10
+  80324e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803251:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803254:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803258:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80325c:	41 89 c9             	mov    %ecx,%r9d
+  80325f:	41 89 f8             	mov    %edi,%r8d
+  803262:	89 d1                	mov    %edx,%ecx
+  803264:	4c 89 d2             	mov    %r10,%rdx
+  803267:	48 89 c7             	mov    %rax,%rdi
+  80326a:	48 b8 0e 32 80 00 00 	movabs $0x80320e,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+  803276:	eb 1c                	jmp    803294 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  803278:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80327c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80327f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803283:	48 89 d6             	mov    %rdx,%rsi
+  803286:	89 c7                	mov    %eax,%edi
+  803288:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80328a:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80328e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803292:	7f e4                	jg     803278 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  803294:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a0:	48 f7 f1             	div    %rcx
+  8032a3:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  8032aa:	00 00 00 
+  8032ad:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032b1:	0f be c0             	movsbl %al,%eax
+  8032b4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032b8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032bc:	48 89 d6             	mov    %rdx,%rsi
+  8032bf:	89 c7                	mov    %eax,%edi
+  8032c1:	ff d1                	call   *%rcx
+}
+  8032c3:	90                   	nop
+  8032c4:	c9                   	leave
+  8032c5:	c3                   	ret
+
+00000000008032c6 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032c6:	55                   	push   %rbp
+  8032c7:	48 89 e5             	mov    %rsp,%rbp
+  8032ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8032ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032d5:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032d9:	7e 4b                	jle    803326 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032df:	8b 00                	mov    (%rax),%eax
+  8032e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8032e4:	77 24                	ja     80330a <getuint+0x44>
+  8032e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032ea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f2:	8b 00                	mov    (%rax),%eax
+  8032f4:	89 c0                	mov    %eax,%eax
+  8032f6:	48 01 d0             	add    %rdx,%rax
+  8032f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032fd:	8b 12                	mov    (%rdx),%edx
+  8032ff:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803302:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803306:	89 0a                	mov    %ecx,(%rdx)
+  803308:	eb 14                	jmp    80331e <getuint+0x58>
+  80330a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80330e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803312:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803316:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80331a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80331e:	48 8b 00             	mov    (%rax),%rax
+  803321:	e9 95 00 00 00       	jmp    8033bb <getuint+0xf5>
+  else if (lflag)
+  803326:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80332a:	74 48                	je     803374 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80332c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803330:	8b 00                	mov    (%rax),%eax
+  803332:	83 f8 2f             	cmp    $0x2f,%eax
+  803335:	77 24                	ja     80335b <getuint+0x95>
+  803337:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80333b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80333f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803343:	8b 00                	mov    (%rax),%eax
+  803345:	89 c0                	mov    %eax,%eax
+  803347:	48 01 d0             	add    %rdx,%rax
+  80334a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80334e:	8b 12                	mov    (%rdx),%edx
+  803350:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803353:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803357:	89 0a                	mov    %ecx,(%rdx)
+  803359:	eb 14                	jmp    80336f <getuint+0xa9>
+  80335b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80335f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803363:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803367:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80336b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80336f:	48 8b 00             	mov    (%rax),%rax
+  803372:	eb 47                	jmp    8033bb <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803378:	8b 00                	mov    (%rax),%eax
+  80337a:	83 f8 2f             	cmp    $0x2f,%eax
+  80337d:	77 24                	ja     8033a3 <getuint+0xdd>
+  80337f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803383:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338b:	8b 00                	mov    (%rax),%eax
+  80338d:	89 c0                	mov    %eax,%eax
+  80338f:	48 01 d0             	add    %rdx,%rax
+  803392:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803396:	8b 12                	mov    (%rdx),%edx
+  803398:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80339b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80339f:	89 0a                	mov    %ecx,(%rdx)
+  8033a1:	eb 14                	jmp    8033b7 <getuint+0xf1>
+  8033a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033ab:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033b7:	8b 00                	mov    (%rax),%eax
+  8033b9:	89 c0                	mov    %eax,%eax
+}
+  8033bb:	c9                   	leave
+  8033bc:	c3                   	ret
+
+00000000008033bd <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033bd:	55                   	push   %rbp
+  8033be:	48 89 e5             	mov    %rsp,%rbp
+  8033c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8033c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033c9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033cc:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033d0:	7e 4b                	jle    80341d <getint+0x60>
+    return va_arg(*ap, long long);
+  8033d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d6:	8b 00                	mov    (%rax),%eax
+  8033d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8033db:	77 24                	ja     803401 <getint+0x44>
+  8033dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e9:	8b 00                	mov    (%rax),%eax
+  8033eb:	89 c0                	mov    %eax,%eax
+  8033ed:	48 01 d0             	add    %rdx,%rax
+  8033f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033f4:	8b 12                	mov    (%rdx),%edx
+  8033f6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033fd:	89 0a                	mov    %ecx,(%rdx)
+  8033ff:	eb 14                	jmp    803415 <getint+0x58>
+  803401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803405:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803409:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80340d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803411:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803415:	48 8b 00             	mov    (%rax),%rax
+  803418:	e9 95 00 00 00       	jmp    8034b2 <getint+0xf5>
+  else if (lflag)
+  80341d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803421:	74 48                	je     80346b <getint+0xae>
+    return va_arg(*ap, long);
+  803423:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803427:	8b 00                	mov    (%rax),%eax
+  803429:	83 f8 2f             	cmp    $0x2f,%eax
+  80342c:	77 24                	ja     803452 <getint+0x95>
+  80342e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803432:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343a:	8b 00                	mov    (%rax),%eax
+  80343c:	89 c0                	mov    %eax,%eax
+  80343e:	48 01 d0             	add    %rdx,%rax
+  803441:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803445:	8b 12                	mov    (%rdx),%edx
+  803447:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80344a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80344e:	89 0a                	mov    %ecx,(%rdx)
+  803450:	eb 14                	jmp    803466 <getint+0xa9>
+  803452:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803456:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80345a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80345e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803462:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803466:	48 8b 00             	mov    (%rax),%rax
+  803469:	eb 47                	jmp    8034b2 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80346b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346f:	8b 00                	mov    (%rax),%eax
+  803471:	83 f8 2f             	cmp    $0x2f,%eax
+  803474:	77 24                	ja     80349a <getint+0xdd>
+  803476:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80347e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803482:	8b 00                	mov    (%rax),%eax
+  803484:	89 c0                	mov    %eax,%eax
+  803486:	48 01 d0             	add    %rdx,%rax
+  803489:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80348d:	8b 12                	mov    (%rdx),%edx
+  80348f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803492:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803496:	89 0a                	mov    %ecx,(%rdx)
+  803498:	eb 14                	jmp    8034ae <getint+0xf1>
+  80349a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80349e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034a2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034aa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034ae:	8b 00                	mov    (%rax),%eax
+  8034b0:	48 98                	cltq
+}
+  8034b2:	c9                   	leave
+  8034b3:	c3                   	ret
+
+00000000008034b4 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034b4:	55                   	push   %rbp
+  8034b5:	48 89 e5             	mov    %rsp,%rbp
+  8034b8:	41 54                	push   %r12
+  8034ba:	53                   	push   %rbx
+  8034bb:	48 83 ec 60          	sub    $0x60,%rsp
+  8034bf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034c3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034c7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034cb:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034d3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034d7:	48 8b 06             	mov    (%rsi),%rax
+  8034da:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034de:	48 89 01             	mov    %rax,(%rcx)
+  8034e1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034e5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034e9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034ed:	eb 17                	jmp    803506 <vprintfmt+0x52>
+      if (ch == '\0')
+  8034ef:	85 db                	test   %ebx,%ebx
+  8034f1:	0f 84 bf 04 00 00    	je     8039b6 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034f7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034fb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8034ff:	48 89 c6             	mov    %rax,%rsi
+  803502:	89 df                	mov    %ebx,%edi
+  803504:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803506:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80350a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80350e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803512:	0f b6 00             	movzbl (%rax),%eax
+  803515:	0f b6 d8             	movzbl %al,%ebx
+  803518:	83 fb 25             	cmp    $0x25,%ebx
+  80351b:	75 d2                	jne    8034ef <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80351d:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803521:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  803528:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80352f:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803536:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80353d:	eb 04                	jmp    803543 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80353f:	90                   	nop
+  803540:	eb 01                	jmp    803543 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803542:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803543:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803547:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80354b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80354f:	0f b6 00             	movzbl (%rax),%eax
+  803552:	0f b6 d8             	movzbl %al,%ebx
+  803555:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  803558:	83 f8 55             	cmp    $0x55,%eax
+  80355b:	0f 87 22 04 00 00    	ja     803983 <vprintfmt+0x4cf>
+  803561:	89 c0                	mov    %eax,%eax
+  803563:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80356a:	00 
+  80356b:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  803572:	00 00 00 
+  803575:	48 01 d0             	add    %rdx,%rax
+  803578:	48 8b 00             	mov    (%rax),%rax
+  80357b:	ff e0                	jmp    *%rax
+        padc = '-';
+  80357d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803581:	eb c0                	jmp    803543 <vprintfmt+0x8f>
+        padc = '0';
+  803583:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803587:	eb ba                	jmp    803543 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  803589:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  803590:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803593:	89 d0                	mov    %edx,%eax
+  803595:	c1 e0 02             	shl    $0x2,%eax
+  803598:	01 d0                	add    %edx,%eax
+  80359a:	01 c0                	add    %eax,%eax
+  80359c:	01 d8                	add    %ebx,%eax
+  80359e:	83 e8 30             	sub    $0x30,%eax
+  8035a1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035a4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035a8:	0f b6 00             	movzbl (%rax),%eax
+  8035ab:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035ae:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035b1:	7e 60                	jle    803613 <vprintfmt+0x15f>
+  8035b3:	83 fb 39             	cmp    $0x39,%ebx
+  8035b6:	7f 5b                	jg     803613 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035b8:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035bd:	eb d1                	jmp    803590 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8035c5:	77 17                	ja     8035de <vprintfmt+0x12a>
+  8035c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035cb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035ce:	89 d2                	mov    %edx,%edx
+  8035d0:	48 01 d0             	add    %rdx,%rax
+  8035d3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035d6:	83 c2 08             	add    $0x8,%edx
+  8035d9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035dc:	eb 0c                	jmp    8035ea <vprintfmt+0x136>
+  8035de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035e2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035e6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035ea:	8b 00                	mov    (%rax),%eax
+  8035ec:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035ef:	eb 23                	jmp    803614 <vprintfmt+0x160>
+        if (width < 0)
+  8035f1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035f5:	0f 89 44 ff ff ff    	jns    80353f <vprintfmt+0x8b>
+          width = 0;
+  8035fb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803602:	e9 38 ff ff ff       	jmp    80353f <vprintfmt+0x8b>
+        altflag = 1;
+  803607:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80360e:	e9 30 ff ff ff       	jmp    803543 <vprintfmt+0x8f>
+        goto process_precision;
+  803613:	90                   	nop
+        if (width < 0)
+  803614:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803618:	0f 89 24 ff ff ff    	jns    803542 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80361e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803621:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803624:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80362b:	e9 12 ff ff ff       	jmp    803542 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803630:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803634:	e9 0a ff ff ff       	jmp    803543 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  803639:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80363c:	83 f8 2f             	cmp    $0x2f,%eax
+  80363f:	77 17                	ja     803658 <vprintfmt+0x1a4>
+  803641:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803645:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803648:	89 d2                	mov    %edx,%edx
+  80364a:	48 01 d0             	add    %rdx,%rax
+  80364d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803650:	83 c2 08             	add    $0x8,%edx
+  803653:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803656:	eb 0c                	jmp    803664 <vprintfmt+0x1b0>
+  803658:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80365c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803660:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803664:	8b 00                	mov    (%rax),%eax
+  803666:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80366a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80366e:	48 89 d6             	mov    %rdx,%rsi
+  803671:	89 c7                	mov    %eax,%edi
+  803673:	ff d1                	call   *%rcx
+        break;
+  803675:	e9 37 03 00 00       	jmp    8039b1 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80367a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80367d:	83 f8 2f             	cmp    $0x2f,%eax
+  803680:	77 17                	ja     803699 <vprintfmt+0x1e5>
+  803682:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803686:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803689:	89 d2                	mov    %edx,%edx
+  80368b:	48 01 d0             	add    %rdx,%rax
+  80368e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803691:	83 c2 08             	add    $0x8,%edx
+  803694:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803697:	eb 0c                	jmp    8036a5 <vprintfmt+0x1f1>
+  803699:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80369d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036a1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036a5:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036a7:	85 db                	test   %ebx,%ebx
+  8036a9:	79 02                	jns    8036ad <vprintfmt+0x1f9>
+          err = -err;
+  8036ab:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036ad:	83 fb 15             	cmp    $0x15,%ebx
+  8036b0:	7f 16                	jg     8036c8 <vprintfmt+0x214>
+  8036b2:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036b9:	00 00 00 
+  8036bc:	48 63 c3             	movslq %ebx,%rax
+  8036bf:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036c3:	4d 85 e4             	test   %r12,%r12
+  8036c6:	75 2e                	jne    8036f6 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036c8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036d0:	89 d9                	mov    %ebx,%ecx
+  8036d2:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036d9:	00 00 00 
+  8036dc:	48 89 c7             	mov    %rax,%rdi
+  8036df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e4:	49 b8 c0 39 80 00 00 	movabs $0x8039c0,%r8
+  8036eb:	00 00 00 
+  8036ee:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036f1:	e9 bb 02 00 00       	jmp    8039b1 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036f6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036fe:	4c 89 e1             	mov    %r12,%rcx
+  803701:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  803708:	00 00 00 
+  80370b:	48 89 c7             	mov    %rax,%rdi
+  80370e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803713:	49 b8 c0 39 80 00 00 	movabs $0x8039c0,%r8
+  80371a:	00 00 00 
+  80371d:	41 ff d0             	call   *%r8
+        break;
+  803720:	e9 8c 02 00 00       	jmp    8039b1 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803725:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803728:	83 f8 2f             	cmp    $0x2f,%eax
+  80372b:	77 17                	ja     803744 <vprintfmt+0x290>
+  80372d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803731:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803734:	89 d2                	mov    %edx,%edx
+  803736:	48 01 d0             	add    %rdx,%rax
+  803739:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80373c:	83 c2 08             	add    $0x8,%edx
+  80373f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803742:	eb 0c                	jmp    803750 <vprintfmt+0x29c>
+  803744:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803748:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80374c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803750:	4c 8b 20             	mov    (%rax),%r12
+  803753:	4d 85 e4             	test   %r12,%r12
+  803756:	75 0a                	jne    803762 <vprintfmt+0x2ae>
+          p = "(null)";
+  803758:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  80375f:	00 00 00 
+        if (width > 0 && padc != '-')
+  803762:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803766:	7e 78                	jle    8037e0 <vprintfmt+0x32c>
+  803768:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80376c:	74 72                	je     8037e0 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80376e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803771:	48 98                	cltq
+  803773:	48 89 c6             	mov    %rax,%rsi
+  803776:	4c 89 e7             	mov    %r12,%rdi
+  803779:	48 b8 cc 40 80 00 00 	movabs $0x8040cc,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  803785:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  803788:	eb 17                	jmp    8037a1 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80378a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80378e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803792:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803796:	48 89 d6             	mov    %rdx,%rsi
+  803799:	89 c7                	mov    %eax,%edi
+  80379b:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80379d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037a1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037a5:	7f e3                	jg     80378a <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037a7:	eb 37                	jmp    8037e0 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037a9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037ad:	74 1e                	je     8037cd <vprintfmt+0x319>
+  8037af:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037b2:	7e 05                	jle    8037b9 <vprintfmt+0x305>
+  8037b4:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037b7:	7e 14                	jle    8037cd <vprintfmt+0x319>
+            putch('?', putdat);
+  8037b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037bd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037c1:	48 89 c6             	mov    %rax,%rsi
+  8037c4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037c9:	ff d2                	call   *%rdx
+  8037cb:	eb 0f                	jmp    8037dc <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037cd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037d1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037d5:	48 89 c6             	mov    %rax,%rsi
+  8037d8:	89 df                	mov    %ebx,%edi
+  8037da:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037dc:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037e0:	4c 89 e0             	mov    %r12,%rax
+  8037e3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037e7:	0f b6 00             	movzbl (%rax),%eax
+  8037ea:	0f be d8             	movsbl %al,%ebx
+  8037ed:	85 db                	test   %ebx,%ebx
+  8037ef:	74 28                	je     803819 <vprintfmt+0x365>
+  8037f1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037f5:	78 b2                	js     8037a9 <vprintfmt+0x2f5>
+  8037f7:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8037fb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037ff:	79 a8                	jns    8037a9 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803801:	eb 16                	jmp    803819 <vprintfmt+0x365>
+          putch(' ', putdat);
+  803803:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803807:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80380b:	48 89 c6             	mov    %rax,%rsi
+  80380e:	bf 20 00 00 00       	mov    $0x20,%edi
+  803813:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803815:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803819:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80381d:	7f e4                	jg     803803 <vprintfmt+0x34f>
+        break;
+  80381f:	e9 8d 01 00 00       	jmp    8039b1 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803824:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803827:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80382b:	89 d6                	mov    %edx,%esi
+  80382d:	48 89 c7             	mov    %rax,%rdi
+  803830:	48 b8 bd 33 80 00 00 	movabs $0x8033bd,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+  80383c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803844:	48 85 c0             	test   %rax,%rax
+  803847:	79 1d                	jns    803866 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  803849:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80384d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803851:	48 89 c6             	mov    %rax,%rsi
+  803854:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803859:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80385b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80385f:	48 f7 d8             	neg    %rax
+  803862:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803866:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80386d:	e9 d2 00 00 00       	jmp    803944 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803872:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803875:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803879:	89 d6                	mov    %edx,%esi
+  80387b:	48 89 c7             	mov    %rax,%rdi
+  80387e:	48 b8 c6 32 80 00 00 	movabs $0x8032c6,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+  80388a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  80388e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803895:	e9 aa 00 00 00       	jmp    803944 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80389a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80389d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038a1:	89 d6                	mov    %edx,%esi
+  8038a3:	48 89 c7             	mov    %rax,%rdi
+  8038a6:	48 b8 c6 32 80 00 00 	movabs $0x8032c6,%rax
+  8038ad:	00 00 00 
+  8038b0:	ff d0                	call   *%rax
+  8038b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038b6:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038bd:	e9 82 00 00 00       	jmp    803944 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038c6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038ca:	48 89 c6             	mov    %rax,%rsi
+  8038cd:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038d2:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038d8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038dc:	48 89 c6             	mov    %rax,%rsi
+  8038df:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038e4:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8038ec:	77 17                	ja     803905 <vprintfmt+0x451>
+  8038ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038f5:	89 d2                	mov    %edx,%edx
+  8038f7:	48 01 d0             	add    %rdx,%rax
+  8038fa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038fd:	83 c2 08             	add    $0x8,%edx
+  803900:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803903:	eb 0c                	jmp    803911 <vprintfmt+0x45d>
+  803905:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803909:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80390d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803911:	48 8b 00             	mov    (%rax),%rax
+  803914:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  803918:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80391f:	eb 23                	jmp    803944 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803921:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803924:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803928:	89 d6                	mov    %edx,%esi
+  80392a:	48 89 c7             	mov    %rax,%rdi
+  80392d:	48 b8 c6 32 80 00 00 	movabs $0x8032c6,%rax
+  803934:	00 00 00 
+  803937:	ff d0                	call   *%rax
+  803939:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80393d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803944:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  803949:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80394c:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80394f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803953:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803957:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80395b:	45 89 c1             	mov    %r8d,%r9d
+  80395e:	41 89 f8             	mov    %edi,%r8d
+  803961:	48 89 c7             	mov    %rax,%rdi
+  803964:	48 b8 0e 32 80 00 00 	movabs $0x80320e,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+        break;
+  803970:	eb 3f                	jmp    8039b1 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803972:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803976:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80397a:	48 89 c6             	mov    %rax,%rsi
+  80397d:	89 df                	mov    %ebx,%edi
+  80397f:	ff d2                	call   *%rdx
+        break;
+  803981:	eb 2e                	jmp    8039b1 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803983:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803987:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80398b:	48 89 c6             	mov    %rax,%rsi
+  80398e:	bf 25 00 00 00       	mov    $0x25,%edi
+  803993:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803995:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80399a:	eb 05                	jmp    8039a1 <vprintfmt+0x4ed>
+  80399c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039a1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039a5:	48 83 e8 01          	sub    $0x1,%rax
+  8039a9:	0f b6 00             	movzbl (%rax),%eax
+  8039ac:	3c 25                	cmp    $0x25,%al
+  8039ae:	75 ec                	jne    80399c <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039b0:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039b1:	e9 50 fb ff ff       	jmp    803506 <vprintfmt+0x52>
+        return;
+  8039b6:	90                   	nop
+    }
+  }
+}
+  8039b7:	48 83 c4 60          	add    $0x60,%rsp
+  8039bb:	5b                   	pop    %rbx
+  8039bc:	41 5c                	pop    %r12
+  8039be:	5d                   	pop    %rbp
+  8039bf:	c3                   	ret
+
+00000000008039c0 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039cb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039d2:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039d9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039e0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039e7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039ee:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039f5:	84 c0                	test   %al,%al
+  8039f7:	74 20                	je     803a19 <printfmt+0x59>
+  8039f9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039fd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a01:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a05:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a09:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a0d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a11:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a15:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a19:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a20:	00 00 00 
+  803a23:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a2a:	00 00 00 
+  803a2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a31:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a38:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a3f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a46:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a4d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a54:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a5b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a62:	48 89 c7             	mov    %rax,%rdi
+  803a65:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803a6c:	00 00 00 
+  803a6f:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a71:	90                   	nop
+  803a72:	c9                   	leave
+  803a73:	c3                   	ret
+
+0000000000803a74 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	48 83 ec 10          	sub    $0x10,%rsp
+  803a7c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a7f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a87:	8b 40 10             	mov    0x10(%rax),%eax
+  803a8a:	8d 50 01             	lea    0x1(%rax),%edx
+  803a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a91:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a98:	48 8b 10             	mov    (%rax),%rdx
+  803a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803aa3:	48 39 c2             	cmp    %rax,%rdx
+  803aa6:	73 17                	jae    803abf <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803aa8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aac:	48 8b 00             	mov    (%rax),%rax
+  803aaf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ab3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ab7:	48 89 0a             	mov    %rcx,(%rdx)
+  803aba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803abd:	88 10                	mov    %dl,(%rax)
+}
+  803abf:	90                   	nop
+  803ac0:	c9                   	leave
+  803ac1:	c3                   	ret
+
+0000000000803ac2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ac2:	55                   	push   %rbp
+  803ac3:	48 89 e5             	mov    %rsp,%rbp
+  803ac6:	48 83 ec 40          	sub    $0x40,%rsp
+  803aca:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ace:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ad1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ad5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803add:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ae1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ae4:	48 98                	cltq
+  803ae6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aee:	48 01 d0             	add    %rdx,%rax
+  803af1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803af5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803afc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b01:	74 06                	je     803b09 <vsnprintf+0x47>
+  803b03:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b07:	7f 07                	jg     803b10 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b0e:	eb 32                	jmp    803b42 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b10:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b14:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b18:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b1c:	48 89 c6             	mov    %rax,%rsi
+  803b1f:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803b26:	00 00 00 
+  803b29:	48 89 c7             	mov    %rax,%rdi
+  803b2c:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803b33:	00 00 00 
+  803b36:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b3c:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b3f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b42:	c9                   	leave
+  803b43:	c3                   	ret
+
+0000000000803b44 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b44:	55                   	push   %rbp
+  803b45:	48 89 e5             	mov    %rsp,%rbp
+  803b48:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b4f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b56:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b5c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b63:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b6a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b71:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b78:	84 c0                	test   %al,%al
+  803b7a:	74 20                	je     803b9c <snprintf+0x58>
+  803b7c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b80:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b84:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b88:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b8c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b90:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b94:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b98:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803b9c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803ba3:	00 00 00 
+  803ba6:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803bad:	00 00 00 
+  803bb0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bb4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bbb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bc2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bc9:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bd0:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bd7:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bdd:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803be4:	48 89 c7             	mov    %rax,%rdi
+  803be7:	48 b8 c2 3a 80 00 00 	movabs $0x803ac2,%rax
+  803bee:	00 00 00 
+  803bf1:	ff d0                	call   *%rax
+  803bf3:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803bf9:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803bff:	c9                   	leave
+  803c00:	c3                   	ret
+
+0000000000803c01 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c01:	55                   	push   %rbp
+  803c02:	48 89 e5             	mov    %rsp,%rbp
+  803c05:	53                   	push   %rbx
+  803c06:	48 83 ec 38          	sub    $0x38,%rsp
+  803c0a:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c0d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c11:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c15:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c19:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c1d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c25:	89 d1                	mov    %edx,%ecx
+  803c27:	0f a2                	cpuid
+  803c29:	89 de                	mov    %ebx,%esi
+  803c2b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c2e:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c31:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c34:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c37:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c3c:	74 09                	je     803c47 <cpuid+0x46>
+}
+  803c3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c42:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c45:	89 10                	mov    %edx,(%rax)
+
+  803c47:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c4c:	74 09                	je     803c57 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c52:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c55:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c57:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c5c:	74 09                	je     803c67 <cpuid+0x66>
+char *
+  803c5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c62:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c65:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c67:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c6c:	74 09                	je     803c77 <cpuid+0x76>
+  for (; *s; s++)
+  803c6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c72:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c75:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c77:	90                   	nop
+  803c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c7c:	c9                   	leave
+  803c7d:	c3                   	ret
+
+0000000000803c7e <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c7e:	55                   	push   %rbp
+  803c7f:	48 89 e5             	mov    %rsp,%rbp
+  803c82:	48 83 ec 18          	sub    $0x18,%rsp
+  803c86:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c8c:	89 c1                	mov    %eax,%ecx
+  803c8e:	0f 01 d0             	xgetbv
+  803c91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c94:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c9a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803c9d:	48 c1 e2 20          	shl    $0x20,%rdx
+  803ca1:	48 09 d0             	or     %rdx,%rax
+#else
+  803ca4:	c9                   	leave
+  803ca5:	c3                   	ret
+
+0000000000803ca6 <string_cpu>:
+string_cpu(void) {
+  803ca6:	55                   	push   %rbp
+  803ca7:	48 89 e5             	mov    %rsp,%rbp
+  803caa:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803cae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cb5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cbc:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cc3:	00 00 00 
+  803cc6:	8b 00                	mov    (%rax),%eax
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	78 11                	js     803cdd <string_cpu+0x37>
+    return string_features;
+  803ccc:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cd3:	00 00 00 
+  803cd6:	8b 00                	mov    (%rax),%eax
+  803cd8:	e9 df 00 00 00       	jmp    803dbc <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cdd:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803ce1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803ce7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cf1:	48 89 c6             	mov    %rax,%rsi
+  803cf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf9:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  803d00:	00 00 00 
+  803d03:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d05:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d08:	83 f8 06             	cmp    $0x6,%eax
+  803d0b:	76 28                	jbe    803d35 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d0d:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d1c:	48 89 c2             	mov    %rax,%rdx
+  803d1f:	be 00 00 00 00       	mov    $0x0,%esi
+  803d24:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d29:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  803d30:	00 00 00 
+  803d33:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d35:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d38:	25 00 02 00 00       	and    $0x200,%eax
+  803d3d:	85 c0                	test   %eax,%eax
+  803d3f:	74 04                	je     803d45 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d41:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d45:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d4f:	48 89 c1             	mov    %rax,%rcx
+  803d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d57:	be 00 00 00 00       	mov    $0x0,%esi
+  803d5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d61:	48 b8 01 3c 80 00 00 	movabs $0x803c01,%rax
+  803d68:	00 00 00 
+  803d6b:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d6d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d70:	83 e0 20             	and    $0x20,%eax
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	74 2a                	je     803da1 <string_cpu+0xfb>
+  803d77:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d7a:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	74 1e                	je     803da1 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d88:	48 b8 7e 3c 80 00 00 	movabs $0x803c7e,%rax
+  803d8f:	00 00 00 
+  803d92:	ff d0                	call   *%rax
+  803d94:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d97:	48 83 f8 06          	cmp    $0x6,%rax
+  803d9b:	75 04                	jne    803da1 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803d9d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803da1:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803da8:	00 00 00 
+  803dab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dae:	89 02                	mov    %eax,(%rdx)
+  803db0:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803db7:	00 00 00 
+  803dba:	8b 00                	mov    (%rax),%eax
+}
+  803dbc:	c9                   	leave
+  803dbd:	c3                   	ret
+
+0000000000803dbe <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803dbe:	55                   	push   %rbp
+  803dbf:	48 89 e5             	mov    %rsp,%rbp
+  803dc2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dc6:	48 83 ec 60          	sub    $0x60,%rsp
+  803dca:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dcf:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dd4:	83 e0 1f             	and    $0x1f,%eax
+  803dd7:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803ddb:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803ddf:	48 f7 d8             	neg    %rax
+  803de2:	48 89 c2             	mov    %rax,%rdx
+  803de5:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dea:	48 01 d0             	add    %rdx,%rax
+  803ded:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803df2:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803df6:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803dfc:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e01:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e05:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e0b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e0f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e13:	89 c2                	mov    %eax,%edx
+  803e15:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e19:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e1e:	89 c1                	mov    %eax,%ecx
+  803e20:	d3 e6                	shl    %cl,%esi
+  803e22:	89 f0                	mov    %esi,%eax
+  803e24:	21 d0                	and    %edx,%eax
+  803e26:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e2a:	eb 21                	jmp    803e4d <strlen_avx2+0x8f>
+    p += 32;
+  803e2c:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e32:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e37:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e3b:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e41:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e45:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e49:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e4d:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e52:	74 d8                	je     803e2c <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e54:	31 c0                	xor    %eax,%eax
+  803e56:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e5c:	48 63 d0             	movslq %eax,%rdx
+  803e5f:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e64:	48 01 d0             	add    %rdx,%rax
+  803e67:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e6c:	c9                   	leave
+  803e6d:	c3                   	ret
+
+0000000000803e6e <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e6e:	55                   	push   %rbp
+  803e6f:	48 89 e5             	mov    %rsp,%rbp
+  803e72:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e76:	48 83 ec 40          	sub    $0x40,%rsp
+  803e7a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e7f:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e84:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e89:	eb 77                	jmp    803f02 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e8b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e90:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e94:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e98:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803e9d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ea1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803ea5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803ea9:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ead:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803eb2:	74 3c                	je     803ef0 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803eb4:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eb8:	f7 d0                	not    %eax
+  803eba:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ebe:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ec2:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ec6:	48 63 d0             	movslq %eax,%rdx
+  803ec9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ece:	48 01 d0             	add    %rdx,%rax
+  803ed1:	0f b6 00             	movzbl (%rax),%eax
+  803ed4:	0f b6 c0             	movzbl %al,%eax
+  803ed7:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803edb:	48 63 ca             	movslq %edx,%rcx
+  803ede:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ee3:	48 01 ca             	add    %rcx,%rdx
+  803ee6:	0f b6 12             	movzbl (%rdx),%edx
+  803ee9:	0f b6 d2             	movzbl %dl,%edx
+  803eec:	29 d0                	sub    %edx,%eax
+  803eee:	eb 6b                	jmp    803f5b <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ef0:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803ef6:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803efc:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f02:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f08:	77 81                	ja     803e8b <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f0a:	eb 42                	jmp    803f4e <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f0c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f11:	0f b6 10             	movzbl (%rax),%edx
+  803f14:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f19:	0f b6 00             	movzbl (%rax),%eax
+  803f1c:	38 c2                	cmp    %al,%dl
+  803f1e:	74 1c                	je     803f3c <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f20:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f25:	0f b6 00             	movzbl (%rax),%eax
+  803f28:	0f b6 c8             	movzbl %al,%ecx
+  803f2b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f30:	0f b6 00             	movzbl (%rax),%eax
+  803f33:	0f b6 d0             	movzbl %al,%edx
+  803f36:	89 c8                	mov    %ecx,%eax
+  803f38:	29 d0                	sub    %edx,%eax
+  803f3a:	eb 1f                	jmp    803f5b <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f3c:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f42:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f48:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f4e:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f54:	75 b6                	jne    803f0c <memcmp_avx2+0x9e>
+  return 0;
+  803f56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f5b:	c9                   	leave
+  803f5c:	c3                   	ret
+
+0000000000803f5d <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f5d:	55                   	push   %rbp
+  803f5e:	48 89 e5             	mov    %rsp,%rbp
+  803f61:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f65:	48 83 ec 60          	sub    $0x60,%rsp
+  803f69:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f6e:	89 f0                	mov    %esi,%eax
+  803f70:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f75:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f79:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f7e:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f82:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f87:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f8d:	eb 47                	jmp    803fd6 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f8f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f94:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f98:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f9c:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fa2:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fa6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803faa:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fae:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fb3:	74 15                	je     803fca <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fb5:	31 c0                	xor    %eax,%eax
+  803fb7:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fbd:	48 63 d0             	movslq %eax,%rdx
+  803fc0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fc5:	48 01 d0             	add    %rdx,%rax
+  803fc8:	eb 3d                	jmp    804007 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fca:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fd0:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fd6:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fdc:	77 b1                	ja     803f8f <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fde:	eb 0c                	jmp    803fec <memfind_avx2+0x8f>
+  803fe0:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fe6:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fec:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803ff2:	74 0e                	je     804002 <memfind_avx2+0xa5>
+  803ff4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ff9:	0f b6 00             	movzbl (%rax),%eax
+  803ffc:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804000:	75 de                	jne    803fe0 <memfind_avx2+0x83>
+  return s;
+  804002:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804007:	c9                   	leave
+  804008:	c3                   	ret
+
+0000000000804009 <strlen>:
+strlen(const char *s) {
+  804009:	55                   	push   %rbp
+  80400a:	48 89 e5             	mov    %rsp,%rbp
+  80400d:	48 83 ec 40          	sub    $0x40,%rsp
+  804011:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804015:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804019:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80401d:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+  804029:	83 e0 02             	and    $0x2,%eax
+  80402c:	85 c0                	test   %eax,%eax
+  80402e:	74 18                	je     804048 <strlen+0x3f>
+    return strlen_avx2(s);
+  804030:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804034:	48 89 c7             	mov    %rax,%rdi
+  804037:	48 b8 be 3d 80 00 00 	movabs $0x803dbe,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+  804043:	e9 82 00 00 00       	jmp    8040ca <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  804048:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80404c:	83 e0 0f             	and    $0xf,%eax
+  80404f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804052:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804055:	48 f7 d8             	neg    %rax
+  804058:	48 89 c2             	mov    %rax,%rdx
+  80405b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405f:	48 01 d0             	add    %rdx,%rax
+  804062:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804066:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80406a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80406e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804073:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804077:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80407b:	89 c2                	mov    %eax,%edx
+  80407d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804080:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804085:	89 c1                	mov    %eax,%ecx
+  804087:	d3 e6                	shl    %cl,%esi
+  804089:	89 f0                	mov    %esi,%eax
+  80408b:	21 d0                	and    %edx,%eax
+  80408d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804090:	eb 1d                	jmp    8040af <strlen+0xa6>
+    p += 16;
+  804092:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804097:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80409b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80409f:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040a4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040a8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040b3:	74 dd                	je     804092 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040b5:	31 c0                	xor    %eax,%eax
+  8040b7:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040bc:	48 63 d0             	movslq %eax,%rdx
+  8040bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040c3:	48 01 d0             	add    %rdx,%rax
+  8040c6:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040ca:	c9                   	leave
+  8040cb:	c3                   	ret
+
+00000000008040cc <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040cc:	55                   	push   %rbp
+  8040cd:	48 89 e5             	mov    %rsp,%rbp
+  8040d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8040d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040e3:	eb 0e                	jmp    8040f3 <strnlen+0x27>
+    n++;
+  8040e5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040e9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040ee:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040f3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040f8:	74 0b                	je     804105 <strnlen+0x39>
+  8040fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040fe:	0f b6 00             	movzbl (%rax),%eax
+  804101:	84 c0                	test   %al,%al
+  804103:	75 e0                	jne    8040e5 <strnlen+0x19>
+  return n;
+  804105:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804108:	c9                   	leave
+  804109:	c3                   	ret
+
+000000000080410a <strcpy>:
+strcpy(char *dst, const char *src) {
+  80410a:	55                   	push   %rbp
+  80410b:	48 89 e5             	mov    %rsp,%rbp
+  80410e:	48 83 ec 20          	sub    $0x20,%rsp
+  804112:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804116:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80411a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80411e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804122:	90                   	nop
+  804123:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804127:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80412b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80412f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804133:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804137:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80413b:	0f b6 12             	movzbl (%rdx),%edx
+  80413e:	88 10                	mov    %dl,(%rax)
+  804140:	0f b6 00             	movzbl (%rax),%eax
+  804143:	84 c0                	test   %al,%al
+  804145:	75 dc                	jne    804123 <strcpy+0x19>
+  return ret;
+  804147:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80414b:	c9                   	leave
+  80414c:	c3                   	ret
+
+000000000080414d <strcat>:
+strcat(char *dst, const char *src) {
+  80414d:	55                   	push   %rbp
+  80414e:	48 89 e5             	mov    %rsp,%rbp
+  804151:	48 83 ec 20          	sub    $0x20,%rsp
+  804155:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804159:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80415d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804161:	48 89 c7             	mov    %rax,%rdi
+  804164:	48 b8 09 40 80 00 00 	movabs $0x804009,%rax
+  80416b:	00 00 00 
+  80416e:	ff d0                	call   *%rax
+  804170:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804173:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804176:	48 63 d0             	movslq %eax,%rdx
+  804179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80417d:	48 01 c2             	add    %rax,%rdx
+  804180:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804184:	48 89 c6             	mov    %rax,%rsi
+  804187:	48 89 d7             	mov    %rdx,%rdi
+  80418a:	48 b8 0a 41 80 00 00 	movabs $0x80410a,%rax
+  804191:	00 00 00 
+  804194:	ff d0                	call   *%rax
+  return dst;
+  804196:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80419a:	c9                   	leave
+  80419b:	c3                   	ret
+
+000000000080419c <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80419c:	55                   	push   %rbp
+  80419d:	48 89 e5             	mov    %rsp,%rbp
+  8041a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8041a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041b8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041bf:	00 
+  8041c0:	eb 2a                	jmp    8041ec <strncpy+0x50>
+    *dst++ = *src;
+  8041c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041ca:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041d2:	0f b6 12             	movzbl (%rdx),%edx
+  8041d5:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041db:	0f b6 00             	movzbl (%rax),%eax
+  8041de:	84 c0                	test   %al,%al
+  8041e0:	74 05                	je     8041e7 <strncpy+0x4b>
+      src++;
+  8041e2:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041e7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041f0:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041f4:	72 cc                	jb     8041c2 <strncpy+0x26>
+  return ret;
+  8041f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8041fa:	c9                   	leave
+  8041fb:	c3                   	ret
+
+00000000008041fc <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8041fc:	55                   	push   %rbp
+  8041fd:	48 89 e5             	mov    %rsp,%rbp
+  804200:	48 83 ec 28          	sub    $0x28,%rsp
+  804204:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804208:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80420c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804210:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804214:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  804218:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80421d:	74 3d                	je     80425c <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80421f:	eb 1d                	jmp    80423e <strlcpy+0x42>
+      *dst++ = *src++;
+  804221:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804225:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804229:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80422d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804231:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804235:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804239:	0f b6 12             	movzbl (%rdx),%edx
+  80423c:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80423e:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804243:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804248:	74 0b                	je     804255 <strlcpy+0x59>
+  80424a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80424e:	0f b6 00             	movzbl (%rax),%eax
+  804251:	84 c0                	test   %al,%al
+  804253:	75 cc                	jne    804221 <strlcpy+0x25>
+    *dst = '\0';
+  804255:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804259:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80425c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804260:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804264:	c9                   	leave
+  804265:	c3                   	ret
+
+0000000000804266 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804266:	55                   	push   %rbp
+  804267:	48 89 e5             	mov    %rsp,%rbp
+  80426a:	48 83 ec 30          	sub    $0x30,%rsp
+  80426e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804272:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804276:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80427a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80427e:	48 89 c7             	mov    %rax,%rdi
+  804281:	48 b8 09 40 80 00 00 	movabs $0x804009,%rax
+  804288:	00 00 00 
+  80428b:	ff d0                	call   *%rax
+  80428d:	48 98                	cltq
+  80428f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804293:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80429b:	48 89 d6             	mov    %rdx,%rsi
+  80429e:	48 89 c7             	mov    %rax,%rdi
+  8042a1:	48 b8 cc 40 80 00 00 	movabs $0x8040cc,%rax
+  8042a8:	00 00 00 
+  8042ab:	ff d0                	call   *%rax
+  8042ad:	48 98                	cltq
+  8042af:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042b7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042bb:	75 10                	jne    8042cd <strlcat+0x67>
+    return maxlen + srclen;
+  8042bd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042c5:	48 01 d0             	add    %rdx,%rax
+  8042c8:	e9 86 00 00 00       	jmp    804353 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042d1:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042d5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042d9:	73 2b                	jae    804306 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042df:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042eb:	48 01 c1             	add    %rax,%rcx
+  8042ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f2:	48 89 c6             	mov    %rax,%rsi
+  8042f5:	48 89 cf             	mov    %rcx,%rdi
+  8042f8:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  8042ff:	00 00 00 
+  804302:	ff d0                	call   *%rax
+  804304:	eb 42                	jmp    804348 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804306:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80430a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80430e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804312:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804316:	48 01 c1             	add    %rax,%rcx
+  804319:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80431d:	48 89 c6             	mov    %rax,%rsi
+  804320:	48 89 cf             	mov    %rcx,%rdi
+  804323:	48 b8 53 48 80 00 00 	movabs $0x804853,%rax
+  80432a:	00 00 00 
+  80432d:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80432f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804333:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804337:	48 01 d0             	add    %rdx,%rax
+  80433a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80433e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804342:	48 01 d0             	add    %rdx,%rax
+  804345:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  804348:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80434c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804350:	48 01 d0             	add    %rdx,%rax
+}
+  804353:	c9                   	leave
+  804354:	c3                   	ret
+
+0000000000804355 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804355:	55                   	push   %rbp
+  804356:	48 89 e5             	mov    %rsp,%rbp
+  804359:	48 83 ec 10          	sub    $0x10,%rsp
+  80435d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804361:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804365:	eb 0a                	jmp    804371 <strcmp+0x1c>
+    p++, q++;
+  804367:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80436c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804371:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804375:	0f b6 00             	movzbl (%rax),%eax
+  804378:	84 c0                	test   %al,%al
+  80437a:	74 12                	je     80438e <strcmp+0x39>
+  80437c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804380:	0f b6 10             	movzbl (%rax),%edx
+  804383:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804387:	0f b6 00             	movzbl (%rax),%eax
+  80438a:	38 c2                	cmp    %al,%dl
+  80438c:	74 d9                	je     804367 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80438e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804392:	0f b6 00             	movzbl (%rax),%eax
+  804395:	0f b6 d0             	movzbl %al,%edx
+  804398:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80439c:	0f b6 00             	movzbl (%rax),%eax
+  80439f:	0f b6 c0             	movzbl %al,%eax
+  8043a2:	29 c2                	sub    %eax,%edx
+  8043a4:	89 d0                	mov    %edx,%eax
+}
+  8043a6:	c9                   	leave
+  8043a7:	c3                   	ret
+
+00000000008043a8 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043a8:	55                   	push   %rbp
+  8043a9:	48 89 e5             	mov    %rsp,%rbp
+  8043ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8043b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043bc:	eb 0f                	jmp    8043cd <strncmp+0x25>
+    n--, p++, q++;
+  8043be:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043c3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043c8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043cd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043d2:	74 1d                	je     8043f1 <strncmp+0x49>
+  8043d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d8:	0f b6 00             	movzbl (%rax),%eax
+  8043db:	84 c0                	test   %al,%al
+  8043dd:	74 12                	je     8043f1 <strncmp+0x49>
+  8043df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e3:	0f b6 10             	movzbl (%rax),%edx
+  8043e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ea:	0f b6 00             	movzbl (%rax),%eax
+  8043ed:	38 c2                	cmp    %al,%dl
+  8043ef:	74 cd                	je     8043be <strncmp+0x16>
+  if (n == 0)
+  8043f1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043f6:	75 07                	jne    8043ff <strncmp+0x57>
+    return 0;
+  8043f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043fd:	eb 16                	jmp    804415 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8043ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804403:	0f b6 00             	movzbl (%rax),%eax
+  804406:	0f b6 d0             	movzbl %al,%edx
+  804409:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80440d:	0f b6 00             	movzbl (%rax),%eax
+  804410:	0f b6 c0             	movzbl %al,%eax
+  804413:	29 c2                	sub    %eax,%edx
+}
+  804415:	89 d0                	mov    %edx,%eax
+  804417:	c9                   	leave
+  804418:	c3                   	ret
+
+0000000000804419 <strchr>:
+strchr(const char *s, char c) {
+  804419:	55                   	push   %rbp
+  80441a:	48 89 e5             	mov    %rsp,%rbp
+  80441d:	48 83 ec 60          	sub    $0x60,%rsp
+  804421:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804425:	89 f0                	mov    %esi,%eax
+  804427:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80442a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80442e:	83 e0 0f             	and    $0xf,%eax
+  804431:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804434:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804437:	48 f7 d8             	neg    %rax
+  80443a:	48 89 c2             	mov    %rax,%rdx
+  80443d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804441:	48 01 d0             	add    %rdx,%rax
+  804444:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  804448:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80444c:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804450:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804454:	66 0f 6e c0          	movd   %eax,%xmm0
+  804458:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80445c:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804460:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804465:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  804469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80446d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804471:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804475:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80447a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80447f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804483:	89 c2                	mov    %eax,%edx
+  804485:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80448a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80448f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804493:	09 c2                	or     %eax,%edx
+  804495:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804498:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80449d:	89 c1                	mov    %eax,%ecx
+  80449f:	d3 e6                	shl    %cl,%esi
+  8044a1:	89 f0                	mov    %esi,%eax
+  8044a3:	21 d0                	and    %edx,%eax
+  8044a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044a8:	eb 34                	jmp    8044de <strchr+0xc5>
+    p += 16;
+  8044aa:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044b3:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044b7:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044bb:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c0:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044c5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044c9:	89 c2                	mov    %eax,%edx
+  8044cb:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044d0:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044d5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044d9:	09 d0                	or     %edx,%eax
+  8044db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044e2:	74 c6                	je     8044aa <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044e4:	31 c0                	xor    %eax,%eax
+  8044e6:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044eb:	48 98                	cltq
+  8044ed:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f5:	0f b6 00             	movzbl (%rax),%eax
+  8044f8:	84 c0                	test   %al,%al
+  8044fa:	74 06                	je     804502 <strchr+0xe9>
+  8044fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804500:	eb 05                	jmp    804507 <strchr+0xee>
+  804502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804507:	c9                   	leave
+  804508:	c3                   	ret
+
+0000000000804509 <strfind>:
+strfind(const char *s, char c) {
+  804509:	55                   	push   %rbp
+  80450a:	48 89 e5             	mov    %rsp,%rbp
+  80450d:	48 83 ec 10          	sub    $0x10,%rsp
+  804511:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804515:	89 f0                	mov    %esi,%eax
+  804517:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80451a:	eb 11                	jmp    80452d <strfind+0x24>
+    if (*s == c)
+  80451c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804520:	0f b6 00             	movzbl (%rax),%eax
+  804523:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804526:	74 12                	je     80453a <strfind+0x31>
+  for (; *s; s++)
+  804528:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80452d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804531:	0f b6 00             	movzbl (%rax),%eax
+  804534:	84 c0                	test   %al,%al
+  804536:	75 e4                	jne    80451c <strfind+0x13>
+  804538:	eb 01                	jmp    80453b <strfind+0x32>
+      break;
+  80453a:	90                   	nop
+  return (char *)s;
+  80453b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80453f:	c9                   	leave
+  804540:	c3                   	ret
+
+0000000000804541 <memset>:
+memset(void *v, int c, size_t n) {
+  804541:	55                   	push   %rbp
+  804542:	48 89 e5             	mov    %rsp,%rbp
+  804545:	48 83 ec 38          	sub    $0x38,%rsp
+  804549:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80454d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804550:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804554:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804558:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80455c:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804561:	76 41                	jbe    8045a4 <memset+0x63>
+  804563:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  80456a:	00 00 00 
+  80456d:	ff d0                	call   *%rax
+  80456f:	83 e0 01             	and    $0x1,%eax
+  804572:	85 c0                	test   %eax,%eax
+  804574:	74 2e                	je     8045a4 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804576:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804579:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80457d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804581:	48 89 ce             	mov    %rcx,%rsi
+  804584:	48 89 f7             	mov    %rsi,%rdi
+  804587:	48 89 d1             	mov    %rdx,%rcx
+  80458a:	fc                   	cld
+  80458b:	f3 aa                	rep stos %al,%es:(%rdi)
+  80458d:	48 89 ca             	mov    %rcx,%rdx
+  804590:	48 89 fe             	mov    %rdi,%rsi
+  804593:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804597:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80459b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80459f:	e9 a7 00 00 00       	jmp    80464b <memset+0x10a>
+  if (n >= 8) {
+  8045a4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045a9:	0f 86 87 00 00 00    	jbe    804636 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045af:	eb 16                	jmp    8045c7 <memset+0x86>
+      *p++ = c;
+  8045b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045b5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045b9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045bd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045c0:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045c2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045cb:	83 e0 07             	and    $0x7,%eax
+  8045ce:	48 85 c0             	test   %rax,%rax
+  8045d1:	75 de                	jne    8045b1 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045d3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045d6:	0f b6 c0             	movzbl %al,%eax
+  8045d9:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045e0:	01 01 01 
+  8045e3:	48 0f af c2          	imul   %rdx,%rax
+  8045e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045ef:	48 c1 e8 03          	shr    $0x3,%rax
+  8045f3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045fb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045ff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804603:	48 89 ce             	mov    %rcx,%rsi
+  804606:	48 89 f7             	mov    %rsi,%rdi
+  804609:	48 89 d1             	mov    %rdx,%rcx
+  80460c:	fc                   	cld
+  80460d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804610:	48 89 ca             	mov    %rcx,%rdx
+  804613:	48 89 fe             	mov    %rdi,%rsi
+  804616:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80461a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80461e:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804623:	eb 11                	jmp    804636 <memset+0xf5>
+    *p++ = c;
+  804625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804629:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80462d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804631:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804634:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804636:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80463a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80463e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804642:	48 85 c0             	test   %rax,%rax
+  804645:	75 de                	jne    804625 <memset+0xe4>
+  return v;
+  804647:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80464b:	c9                   	leave
+  80464c:	c3                   	ret
+
+000000000080464d <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80464d:	55                   	push   %rbp
+  80464e:	48 89 e5             	mov    %rsp,%rbp
+  804651:	48 83 ec 38          	sub    $0x38,%rsp
+  804655:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804659:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80465d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804661:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804665:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  804669:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80466d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804675:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804679:	0f 83 da 00 00 00    	jae    804759 <memmove+0x10c>
+  80467f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804683:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804687:	48 01 d0             	add    %rdx,%rax
+  80468a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80468e:	0f 83 c5 00 00 00    	jae    804759 <memmove+0x10c>
+    s += n;
+  804694:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804698:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80469c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046a4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046a9:	0f 86 94 00 00 00    	jbe    804743 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046af:	eb 1c                	jmp    8046cd <memmove+0x80>
+        *--d = *--s;
+  8046b1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046b6:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046bf:	0f b6 10             	movzbl (%rax),%edx
+  8046c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c6:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046c8:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d1:	83 e0 07             	and    $0x7,%eax
+  8046d4:	48 85 c0             	test   %rax,%rax
+  8046d7:	75 d8                	jne    8046b1 <memmove+0x64>
+      nq = n / 8;
+  8046d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046dd:	48 c1 e8 03          	shr    $0x3,%rax
+  8046e1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046e5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046ea:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046ef:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046f4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804700:	48 89 cf             	mov    %rcx,%rdi
+  804703:	48 89 d6             	mov    %rdx,%rsi
+  804706:	48 89 c1             	mov    %rax,%rcx
+  804709:	fd                   	std
+  80470a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80470d:	fc                   	cld
+  80470e:	48 89 c8             	mov    %rcx,%rax
+  804711:	48 89 f2             	mov    %rsi,%rdx
+  804714:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804718:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80471c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804720:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804725:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80472a:	eb 17                	jmp    804743 <memmove+0xf6>
+      *--d = *--s;
+  80472c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804731:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804736:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80473a:	0f b6 10             	movzbl (%rax),%edx
+  80473d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804741:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804743:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804747:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80474b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80474f:	48 85 c0             	test   %rax,%rax
+  804752:	75 d8                	jne    80472c <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804754:	e9 f4 00 00 00       	jmp    80484d <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  804759:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80475e:	76 46                	jbe    8047a6 <memmove+0x159>
+  804760:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  804767:	00 00 00 
+  80476a:	ff d0                	call   *%rax
+  80476c:	83 e0 01             	and    $0x1,%eax
+  80476f:	85 c0                	test   %eax,%eax
+  804771:	74 33                	je     8047a6 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804773:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804777:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80477b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80477f:	48 89 cf             	mov    %rcx,%rdi
+  804782:	48 89 d6             	mov    %rdx,%rsi
+  804785:	48 89 c1             	mov    %rax,%rcx
+  804788:	fc                   	cld
+  804789:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80478b:	48 89 c8             	mov    %rcx,%rax
+  80478e:	48 89 f2             	mov    %rsi,%rdx
+  804791:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804795:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804799:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80479d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047a1:	e9 ab 00 00 00       	jmp    804851 <memmove+0x204>
+    if (n >= 8) {
+  8047a6:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047ab:	0f 86 8b 00 00 00    	jbe    80483c <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047b1:	eb 22                	jmp    8047d5 <memmove+0x188>
+        *d++ = *s++;
+  8047b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047b7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047c3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047c7:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047cb:	0f b6 12             	movzbl (%rdx),%edx
+  8047ce:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047d0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d9:	83 e0 07             	and    $0x7,%eax
+  8047dc:	48 85 c0             	test   %rax,%rax
+  8047df:	75 d2                	jne    8047b3 <memmove+0x166>
+      nq = n / 8;
+  8047e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047e5:	48 c1 e8 03          	shr    $0x3,%rax
+  8047e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047ed:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f9:	48 89 cf             	mov    %rcx,%rdi
+  8047fc:	48 89 d6             	mov    %rdx,%rsi
+  8047ff:	48 89 c1             	mov    %rax,%rcx
+  804802:	fc                   	cld
+  804803:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804806:	48 89 c8             	mov    %rcx,%rax
+  804809:	48 89 f2             	mov    %rsi,%rdx
+  80480c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804810:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804814:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  804818:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80481d:	eb 1d                	jmp    80483c <memmove+0x1ef>
+      *d++ = *s++;
+  80481f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804823:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804827:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80482b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80482f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804833:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804837:	0f b6 12             	movzbl (%rdx),%edx
+  80483a:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80483c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804840:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804844:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804848:	48 85 c0             	test   %rax,%rax
+  80484b:	75 d2                	jne    80481f <memmove+0x1d2>
+  return dst;
+  80484d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804851:	c9                   	leave
+  804852:	c3                   	ret
+
+0000000000804853 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804853:	55                   	push   %rbp
+  804854:	48 89 e5             	mov    %rsp,%rbp
+  804857:	48 83 ec 18          	sub    $0x18,%rsp
+  80485b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80485f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804863:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804867:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80486b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80486f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804873:	48 89 ce             	mov    %rcx,%rsi
+  804876:	48 89 c7             	mov    %rax,%rdi
+  804879:	48 b8 4d 46 80 00 00 	movabs $0x80464d,%rax
+  804880:	00 00 00 
+  804883:	ff d0                	call   *%rax
+}
+  804885:	c9                   	leave
+  804886:	c3                   	ret
+
+0000000000804887 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804887:	55                   	push   %rbp
+  804888:	48 89 e5             	mov    %rsp,%rbp
+  80488b:	48 83 ec 40          	sub    $0x40,%rsp
+  80488f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804893:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804897:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80489b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80489f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048ab:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048b0:	0f 86 a7 00 00 00    	jbe    80495d <memcmp+0xd6>
+  8048b6:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  8048bd:	00 00 00 
+  8048c0:	ff d0                	call   *%rax
+  8048c2:	83 e0 02             	and    $0x2,%eax
+  8048c5:	85 c0                	test   %eax,%eax
+  8048c7:	0f 84 90 00 00 00    	je     80495d <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048cd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048d1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048d9:	48 89 ce             	mov    %rcx,%rsi
+  8048dc:	48 89 c7             	mov    %rax,%rdi
+  8048df:	48 b8 6e 3e 80 00 00 	movabs $0x803e6e,%rax
+  8048e6:	00 00 00 
+  8048e9:	ff d0                	call   *%rax
+  8048eb:	e9 c2 00 00 00       	jmp    8049b2 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048f4:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048f8:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8048fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804900:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804904:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804908:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80490c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80490f:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804916:	74 36                	je     80494e <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  804918:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80491b:	f7 d0                	not    %eax
+  80491d:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804921:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804924:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804927:	48 63 d0             	movslq %eax,%rdx
+  80492a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80492e:	48 01 d0             	add    %rdx,%rax
+  804931:	0f b6 00             	movzbl (%rax),%eax
+  804934:	0f b6 c0             	movzbl %al,%eax
+  804937:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80493a:	48 63 ca             	movslq %edx,%rcx
+  80493d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804941:	48 01 ca             	add    %rcx,%rdx
+  804944:	0f b6 12             	movzbl (%rdx),%edx
+  804947:	0f b6 d2             	movzbl %dl,%edx
+  80494a:	29 d0                	sub    %edx,%eax
+  80494c:	eb 64                	jmp    8049b2 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80494e:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804953:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  804958:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80495d:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804962:	77 8c                	ja     8048f0 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804964:	eb 36                	jmp    80499c <memcmp+0x115>
+    if (*s1 != *s2)
+  804966:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80496a:	0f b6 10             	movzbl (%rax),%edx
+  80496d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804971:	0f b6 00             	movzbl (%rax),%eax
+  804974:	38 c2                	cmp    %al,%dl
+  804976:	74 1a                	je     804992 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  804978:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80497c:	0f b6 00             	movzbl (%rax),%eax
+  80497f:	0f b6 c8             	movzbl %al,%ecx
+  804982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804986:	0f b6 00             	movzbl (%rax),%eax
+  804989:	0f b6 d0             	movzbl %al,%edx
+  80498c:	89 c8                	mov    %ecx,%eax
+  80498e:	29 d0                	sub    %edx,%eax
+  804990:	eb 20                	jmp    8049b2 <memcmp+0x12b>
+    s1++, s2++;
+  804992:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804997:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80499c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049a0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049a8:	48 85 c0             	test   %rax,%rax
+  8049ab:	75 b9                	jne    804966 <memcmp+0xdf>
+  }
+
+  return 0;
+  8049ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049b2:	c9                   	leave
+  8049b3:	c3                   	ret
+
+00000000008049b4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049b4:	55                   	push   %rbp
+  8049b5:	48 89 e5             	mov    %rsp,%rbp
+  8049b8:	48 83 ec 50          	sub    $0x50,%rsp
+  8049bc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049c0:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049c3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049c7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049cb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049cf:	48 01 d0             	add    %rdx,%rax
+  8049d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049d6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049d9:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049dd:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049e1:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049e5:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049ea:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049ee:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049f3:	76 73                	jbe    804a68 <memfind+0xb4>
+  8049f5:	48 b8 a6 3c 80 00 00 	movabs $0x803ca6,%rax
+  8049fc:	00 00 00 
+  8049ff:	ff d0                	call   *%rax
+  804a01:	83 e0 02             	and    $0x2,%eax
+  804a04:	85 c0                	test   %eax,%eax
+  804a06:	74 60                	je     804a68 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a08:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a0b:	0f b6 c8             	movzbl %al,%ecx
+  804a0e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a16:	89 ce                	mov    %ecx,%esi
+  804a18:	48 89 c7             	mov    %rax,%rdi
+  804a1b:	48 b8 5d 3f 80 00 00 	movabs $0x803f5d,%rax
+  804a22:	00 00 00 
+  804a25:	ff d0                	call   *%rax
+  804a27:	eb 6c                	jmp    804a95 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a2d:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a31:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a35:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a3a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a3e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a42:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a45:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a49:	74 13                	je     804a5e <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a4b:	31 c0                	xor    %eax,%eax
+  804a4d:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a52:	48 63 d0             	movslq %eax,%rdx
+  804a55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a59:	48 01 d0             	add    %rdx,%rax
+  804a5c:	eb 37                	jmp    804a95 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a5e:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a63:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a68:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a6d:	77 ba                	ja     804a29 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a6f:	eb 13                	jmp    804a84 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a75:	0f b6 00             	movzbl (%rax),%eax
+  804a78:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a7b:	38 d0                	cmp    %dl,%al
+  804a7d:	74 11                	je     804a90 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a7f:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a88:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a8c:	72 e3                	jb     804a71 <memfind+0xbd>
+  804a8e:	eb 01                	jmp    804a91 <memfind+0xdd>
+      break;
+  804a90:	90                   	nop
+  return (void *)s;
+  804a91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a95:	c9                   	leave
+  804a96:	c3                   	ret
+
+0000000000804a97 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a97:	55                   	push   %rbp
+  804a98:	48 89 e5             	mov    %rsp,%rbp
+  804a9b:	48 83 ec 38          	sub    $0x38,%rsp
+  804a9f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804aa3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804aa7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804aaa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804ab1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ab8:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804ab9:	eb 05                	jmp    804ac0 <strtol+0x29>
+    s++;
+  804abb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ac0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac4:	0f b6 00             	movzbl (%rax),%eax
+  804ac7:	3c 20                	cmp    $0x20,%al
+  804ac9:	74 f0                	je     804abb <strtol+0x24>
+  804acb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acf:	0f b6 00             	movzbl (%rax),%eax
+  804ad2:	3c 09                	cmp    $0x9,%al
+  804ad4:	74 e5                	je     804abb <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ad6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ada:	0f b6 00             	movzbl (%rax),%eax
+  804add:	3c 2b                	cmp    $0x2b,%al
+  804adf:	75 07                	jne    804ae8 <strtol+0x51>
+    s++;
+  804ae1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ae6:	eb 17                	jmp    804aff <strtol+0x68>
+  else if (*s == '-')
+  804ae8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aec:	0f b6 00             	movzbl (%rax),%eax
+  804aef:	3c 2d                	cmp    $0x2d,%al
+  804af1:	75 0c                	jne    804aff <strtol+0x68>
+    s++, neg = 1;
+  804af3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804af8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804aff:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b03:	74 06                	je     804b0b <strtol+0x74>
+  804b05:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b09:	75 28                	jne    804b33 <strtol+0x9c>
+  804b0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0f:	0f b6 00             	movzbl (%rax),%eax
+  804b12:	3c 30                	cmp    $0x30,%al
+  804b14:	75 1d                	jne    804b33 <strtol+0x9c>
+  804b16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b1a:	48 83 c0 01          	add    $0x1,%rax
+  804b1e:	0f b6 00             	movzbl (%rax),%eax
+  804b21:	3c 78                	cmp    $0x78,%al
+  804b23:	75 0e                	jne    804b33 <strtol+0x9c>
+    s += 2, base = 16;
+  804b25:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b2a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b31:	eb 2c                	jmp    804b5f <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b33:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b37:	75 19                	jne    804b52 <strtol+0xbb>
+  804b39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b3d:	0f b6 00             	movzbl (%rax),%eax
+  804b40:	3c 30                	cmp    $0x30,%al
+  804b42:	75 0e                	jne    804b52 <strtol+0xbb>
+    s++, base = 8;
+  804b44:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b49:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b50:	eb 0d                	jmp    804b5f <strtol+0xc8>
+  else if (base == 0)
+  804b52:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b56:	75 07                	jne    804b5f <strtol+0xc8>
+    base = 10;
+  804b58:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b63:	0f b6 00             	movzbl (%rax),%eax
+  804b66:	3c 2f                	cmp    $0x2f,%al
+  804b68:	7e 1d                	jle    804b87 <strtol+0xf0>
+  804b6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6e:	0f b6 00             	movzbl (%rax),%eax
+  804b71:	3c 39                	cmp    $0x39,%al
+  804b73:	7f 12                	jg     804b87 <strtol+0xf0>
+      dig = *s - '0';
+  804b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b79:	0f b6 00             	movzbl (%rax),%eax
+  804b7c:	0f be c0             	movsbl %al,%eax
+  804b7f:	83 e8 30             	sub    $0x30,%eax
+  804b82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b85:	eb 4e                	jmp    804bd5 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8b:	0f b6 00             	movzbl (%rax),%eax
+  804b8e:	3c 60                	cmp    $0x60,%al
+  804b90:	7e 1d                	jle    804baf <strtol+0x118>
+  804b92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b96:	0f b6 00             	movzbl (%rax),%eax
+  804b99:	3c 7a                	cmp    $0x7a,%al
+  804b9b:	7f 12                	jg     804baf <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804b9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba1:	0f b6 00             	movzbl (%rax),%eax
+  804ba4:	0f be c0             	movsbl %al,%eax
+  804ba7:	83 e8 57             	sub    $0x57,%eax
+  804baa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bad:	eb 26                	jmp    804bd5 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804baf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb3:	0f b6 00             	movzbl (%rax),%eax
+  804bb6:	3c 40                	cmp    $0x40,%al
+  804bb8:	7e 47                	jle    804c01 <strtol+0x16a>
+  804bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bbe:	0f b6 00             	movzbl (%rax),%eax
+  804bc1:	3c 5a                	cmp    $0x5a,%al
+  804bc3:	7f 3c                	jg     804c01 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc9:	0f b6 00             	movzbl (%rax),%eax
+  804bcc:	0f be c0             	movsbl %al,%eax
+  804bcf:	83 e8 37             	sub    $0x37,%eax
+  804bd2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bd5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bd8:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bdb:	7d 23                	jge    804c00 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bdd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804be2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804be5:	48 98                	cltq
+  804be7:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bec:	48 89 c2             	mov    %rax,%rdx
+  804bef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bf2:	48 98                	cltq
+  804bf4:	48 01 d0             	add    %rdx,%rax
+  804bf7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804bfb:	e9 5f ff ff ff       	jmp    804b5f <strtol+0xc8>
+      break;
+  804c00:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c01:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c06:	74 0b                	je     804c13 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c0c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c10:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c17:	74 09                	je     804c22 <strtol+0x18b>
+  804c19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c1d:	48 f7 d8             	neg    %rax
+  804c20:	eb 04                	jmp    804c26 <strtol+0x18f>
+  804c22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c26:	c9                   	leave
+  804c27:	c3                   	ret
+
+0000000000804c28 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c28:	55                   	push   %rbp
+  804c29:	48 89 e5             	mov    %rsp,%rbp
+  804c2c:	48 83 ec 20          	sub    $0x20,%rsp
+  804c30:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c34:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c38:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c40:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c48:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c4f:	48 89 c7             	mov    %rax,%rdi
+  804c52:	48 b8 60 4c 80 00 00 	movabs $0x804c60,%rax
+  804c59:	00 00 00 
+  804c5c:	ff d0                	call   *%rax
+}
+  804c5e:	c9                   	leave
+  804c5f:	c3                   	ret
+
+0000000000804c60 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c60:	55                   	push   %rbp
+  804c61:	48 89 e5             	mov    %rsp,%rbp
+  804c64:	48 83 ec 30          	sub    $0x30,%rsp
+  804c68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c6c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c70:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c74:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c78:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c7d:	75 0e                	jne    804c8d <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c7f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c86:	00 00 00 
+  804c89:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c8d:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c92:	75 18                	jne    804cac <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c98:	48 89 c7             	mov    %rax,%rdi
+  804c9b:	48 b8 eb 05 80 00 00 	movabs $0x8005eb,%rax
+  804ca2:	00 00 00 
+  804ca5:	ff d0                	call   *%rax
+  804ca7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804caa:	eb 1d                	jmp    804cc9 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cac:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cb4:	48 89 d6             	mov    %rdx,%rsi
+  804cb7:	48 89 c7             	mov    %rax,%rdi
+  804cba:	48 b8 31 06 80 00 00 	movabs $0x800631,%rax
+  804cc1:	00 00 00 
+  804cc4:	ff d0                	call   *%rax
+  804cc6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cc9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ccd:	79 2a                	jns    804cf9 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804ccf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cd4:	74 0a                	je     804ce0 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cda:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804ce0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ce5:	74 0a                	je     804cf1 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804ce7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ceb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804cf1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cf4:	e9 aa 00 00 00       	jmp    804da3 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804cf9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cfe:	74 36                	je     804d36 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d00:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d07:	00 00 00 
+  804d0a:	8b 40 04             	mov    0x4(%rax),%eax
+  804d0d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d12:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d19:	00 00 00 
+  804d1c:	48 98                	cltq
+  804d1e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d25:	48 01 d0             	add    %rdx,%rax
+  804d28:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d2e:	8b 10                	mov    (%rax),%edx
+  804d30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d34:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d36:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d3b:	74 36                	je     804d73 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d3d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d44:	00 00 00 
+  804d47:	8b 40 04             	mov    0x4(%rax),%eax
+  804d4a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d4f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d56:	00 00 00 
+  804d59:	48 98                	cltq
+  804d5b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d62:	48 01 d0             	add    %rdx,%rax
+  804d65:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d6b:	8b 10                	mov    (%rax),%edx
+  804d6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d71:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d73:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d7a:	00 00 00 
+  804d7d:	8b 40 04             	mov    0x4(%rax),%eax
+  804d80:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d85:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d8c:	00 00 00 
+  804d8f:	48 98                	cltq
+  804d91:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d98:	48 01 d0             	add    %rdx,%rax
+  804d9b:	48 05 20 01 00 00    	add    $0x120,%rax
+  804da1:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804da3:	c9                   	leave
+  804da4:	c3                   	ret
+
+0000000000804da5 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804da5:	55                   	push   %rbp
+  804da6:	48 89 e5             	mov    %rsp,%rbp
+  804da9:	48 83 ec 30          	sub    $0x30,%rsp
+  804dad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804db0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804db3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804db7:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dba:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dbf:	75 5e                	jne    804e1f <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dc1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dc8:	00 00 00 
+  804dcb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dcf:	eb 4e                	jmp    804e1f <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dd1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dd5:	79 3c                	jns    804e13 <ipc_send+0x6e>
+  804dd7:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804ddb:	74 36                	je     804e13 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804ddd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804de0:	89 c1                	mov    %eax,%ecx
+  804de2:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804de9:	00 00 00 
+  804dec:	48 89 c2             	mov    %rax,%rdx
+  804def:	be 54 00 00 00       	mov    $0x54,%esi
+  804df4:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804dfb:	00 00 00 
+  804dfe:	48 89 c7             	mov    %rax,%rdi
+  804e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e06:	49 b8 3b 2f 80 00 00 	movabs $0x802f3b,%r8
+  804e0d:	00 00 00 
+  804e10:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e13:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  804e1a:	00 00 00 
+  804e1d:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e1f:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e22:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e25:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e2c:	89 c7                	mov    %eax,%edi
+  804e2e:	48 b8 94 05 80 00 00 	movabs $0x800594,%rax
+  804e35:	00 00 00 
+  804e38:	ff d0                	call   *%rax
+  804e3a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e3d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e41:	75 8e                	jne    804dd1 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e43:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  804e4a:	00 00 00 
+  804e4d:	ff d0                	call   *%rax
+}
+  804e4f:	90                   	nop
+  804e50:	c9                   	leave
+  804e51:	c3                   	ret
+
+0000000000804e52 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e52:	55                   	push   %rbp
+  804e53:	48 89 e5             	mov    %rsp,%rbp
+  804e56:	48 83 ec 18          	sub    $0x18,%rsp
+  804e5a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e64:	eb 4d                	jmp    804eb3 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e66:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e6d:	00 00 00 
+  804e70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e73:	48 98                	cltq
+  804e75:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e7c:	48 01 d0             	add    %rdx,%rax
+  804e7f:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e85:	8b 00                	mov    (%rax),%eax
+  804e87:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e8a:	75 23                	jne    804eaf <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e8c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e93:	00 00 00 
+  804e96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e99:	48 98                	cltq
+  804e9b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ea2:	48 01 d0             	add    %rdx,%rax
+  804ea5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804eab:	8b 00                	mov    (%rax),%eax
+  804ead:	eb 12                	jmp    804ec1 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804eaf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804eb3:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804eba:	7e aa                	jle    804e66 <ipc_find_env+0x14>
+  return 0;
+  804ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ec1:	c9                   	leave
+  804ec2:	c3                   	ret
+
+0000000000804ec3 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ec3:	55                   	push   %rbp
+  804ec4:	48 89 e5             	mov    %rsp,%rbp
+  804ec7:	48 83 ec 18          	sub    $0x18,%rsp
+  804ecb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ecf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed3:	48 c1 e8 27          	shr    $0x27,%rax
+  804ed7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804edc:	48 89 c2             	mov    %rax,%rdx
+  804edf:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ee6:	01 00 00 
+  804ee9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804eed:	83 e0 01             	and    $0x1,%eax
+  804ef0:	48 85 c0             	test   %rax,%rax
+  804ef3:	74 63                	je     804f58 <pageref+0x95>
+  804ef5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804efd:	48 89 c2             	mov    %rax,%rdx
+  804f00:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f07:	01 00 00 
+  804f0a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f0e:	83 e0 01             	and    $0x1,%eax
+  804f11:	48 85 c0             	test   %rax,%rax
+  804f14:	74 42                	je     804f58 <pageref+0x95>
+  804f16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f1a:	48 c1 e8 15          	shr    $0x15,%rax
+  804f1e:	48 89 c2             	mov    %rax,%rdx
+  804f21:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f28:	01 00 00 
+  804f2b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f2f:	83 e0 01             	and    $0x1,%eax
+  804f32:	48 85 c0             	test   %rax,%rax
+  804f35:	74 21                	je     804f58 <pageref+0x95>
+  804f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3b:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f3f:	48 89 c2             	mov    %rax,%rdx
+  804f42:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f49:	01 00 00 
+  804f4c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f50:	83 e0 01             	and    $0x1,%eax
+  804f53:	48 85 c0             	test   %rax,%rax
+  804f56:	75 07                	jne    804f5f <pageref+0x9c>
+    return 0;
+  804f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f5d:	eb 53                	jmp    804fb2 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f63:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f67:	48 89 c2             	mov    %rax,%rdx
+  804f6a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f71:	01 00 00 
+  804f74:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f78:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f80:	83 e0 01             	and    $0x1,%eax
+  804f83:	48 85 c0             	test   %rax,%rax
+  804f86:	75 07                	jne    804f8f <pageref+0xcc>
+    return 0;
+  804f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8d:	eb 23                	jmp    804fb2 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f93:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f97:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804f9e:	00 00 00 
+  804fa1:	48 c1 e0 04          	shl    $0x4,%rax
+  804fa5:	48 01 d0             	add    %rdx,%rax
+  804fa8:	48 83 c0 08          	add    $0x8,%rax
+  804fac:	0f b7 00             	movzwl (%rax),%eax
+  804faf:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fb2:	c9                   	leave
+  804fb3:	c3                   	ret
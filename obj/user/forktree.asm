@@ -0,0 +1,10113 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 38 01 00 00       	call   800164 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <forkchild>:
+#define DEPTH 3
+
+void forktree(const char *cur);
+
+void
+forkchild(const char *cur, char branch) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80003e:	89 f0                	mov    %esi,%eax
+  800040:	88 45 e4             	mov    %al,-0x1c(%rbp)
+  char nxt[DEPTH + 1];
+
+  if (strlen(cur) >= DEPTH)
+  800043:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800047:	48 89 c7             	mov    %rax,%rdi
+  80004a:	48 b8 bf 11 80 00 00 	movabs $0x8011bf,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+  800056:	83 f8 02             	cmp    $0x2,%eax
+  800059:	7f 67                	jg     8000c2 <forkchild+0x90>
+    return;
+
+  snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  80005b:	0f be 4d e4          	movsbl -0x1c(%rbp),%ecx
+  80005f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800063:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  800067:	41 89 c8             	mov    %ecx,%r8d
+  80006a:	48 89 d1             	mov    %rdx,%rcx
+  80006d:	48 ba 40 64 80 00 00 	movabs $0x806440,%rdx
+  800074:	00 00 00 
+  800077:	be 04 00 00 00       	mov    $0x4,%esi
+  80007c:	48 89 c7             	mov    %rax,%rdi
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	49 b9 fa 0c 80 00 00 	movabs $0x800cfa,%r9
+  80008b:	00 00 00 
+  80008e:	41 ff d1             	call   *%r9
+  if (fork() == 0) {
+  800091:	48 b8 27 2f 80 00 00 	movabs $0x802f27,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	85 c0                	test   %eax,%eax
+  80009f:	75 22                	jne    8000c3 <forkchild+0x91>
+    forktree(nxt);
+  8000a1:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+  8000a5:	48 89 c7             	mov    %rax,%rdi
+  8000a8:	48 b8 c5 00 80 00 00 	movabs $0x8000c5,%rax
+  8000af:	00 00 00 
+  8000b2:	ff d0                	call   *%rax
+    exit();
+  8000b4:	48 b8 e7 01 80 00 00 	movabs $0x8001e7,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+  8000c0:	eb 01                	jmp    8000c3 <forkchild+0x91>
+    return;
+  8000c2:	90                   	nop
+  }
+}
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+
+00000000008000c5 <forktree>:
+
+void
+forktree(const char *cur) {
+  8000c5:	55                   	push   %rbp
+  8000c6:	48 89 e5             	mov    %rsp,%rbp
+  8000c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8000cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  8000d1:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  8000d8:	00 00 00 
+  8000db:	ff d0                	call   *%rax
+  8000dd:	89 c1                	mov    %eax,%ecx
+  8000df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000e3:	48 89 c2             	mov    %rax,%rdx
+  8000e6:	89 ce                	mov    %ecx,%esi
+  8000e8:	48 b8 45 64 80 00 00 	movabs $0x806445,%rax
+  8000ef:	00 00 00 
+  8000f2:	48 89 c7             	mov    %rax,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	48 b9 10 03 80 00 00 	movabs $0x800310,%rcx
+  800101:	00 00 00 
+  800104:	ff d1                	call   *%rcx
+
+  forkchild(cur, '0');
+  800106:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80010a:	be 30 00 00 00       	mov    $0x30,%esi
+  80010f:	48 89 c7             	mov    %rax,%rdi
+  800112:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800119:	00 00 00 
+  80011c:	ff d0                	call   *%rax
+  forkchild(cur, '1');
+  80011e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800122:	be 31 00 00 00       	mov    $0x31,%esi
+  800127:	48 89 c7             	mov    %rax,%rdi
+  80012a:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+}
+  800136:	90                   	nop
+  800137:	c9                   	leave
+  800138:	c3                   	ret
+
+0000000000800139 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800139:	55                   	push   %rbp
+  80013a:	48 89 e5             	mov    %rsp,%rbp
+  80013d:	48 83 ec 10          	sub    $0x10,%rsp
+  800141:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800144:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  forktree("");
+  800148:	48 b8 56 64 80 00 00 	movabs $0x806456,%rax
+  80014f:	00 00 00 
+  800152:	48 89 c7             	mov    %rax,%rdi
+  800155:	48 b8 c5 00 80 00 00 	movabs $0x8000c5,%rax
+  80015c:	00 00 00 
+  80015f:	ff d0                	call   *%rax
+}
+  800161:	90                   	nop
+  800162:	c9                   	leave
+  800163:	c3                   	ret
+
+0000000000800164 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800164:	55                   	push   %rbp
+  800165:	48 89 e5             	mov    %rsp,%rbp
+  800168:	48 83 ec 20          	sub    $0x20,%rsp
+  80016c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80016f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800173:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80017a:	00 00 00 
+  80017d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800181:	eb 13                	jmp    800196 <libmain+0x32>
+    (*ctor)();
+  800183:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800187:	48 8b 10             	mov    (%rax),%rdx
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	ff d2                	call   *%rdx
+    ctor++;
+  800191:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800196:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80019d:	00 00 00 
+  8001a0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8001a4:	72 dd                	jb     800183 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001aa:	7e 14                	jle    8001c0 <libmain+0x5c>
+    binaryname = argv[0];
+  8001ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001b0:	48 8b 00             	mov    (%rax),%rax
+  8001b3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8001ba:	00 00 00 
+  8001bd:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001c7:	48 89 d6             	mov    %rdx,%rsi
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	48 b8 39 01 80 00 00 	movabs $0x800139,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001d8:	48 b8 e7 01 80 00 00 	movabs $0x8001e7,%rax
+  8001df:	00 00 00 
+  8001e2:	ff d0                	call   *%rax
+#endif
+}
+  8001e4:	90                   	nop
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+
+00000000008001e7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001e7:	55                   	push   %rbp
+  8001e8:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001eb:	48 b8 45 33 80 00 00 	movabs $0x803345,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 46 1f 80 00 00 	movabs $0x801f46,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+}
+  800208:	90                   	nop
+  800209:	5d                   	pop    %rbp
+  80020a:	c3                   	ret
+
+000000000080020b <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80020b:	55                   	push   %rbp
+  80020c:	48 89 e5             	mov    %rsp,%rbp
+  80020f:	48 83 ec 10          	sub    $0x10,%rsp
+  800213:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800216:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80021a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80021e:	8b 00                	mov    (%rax),%eax
+  800220:	8d 48 01             	lea    0x1(%rax),%ecx
+  800223:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800227:	89 0a                	mov    %ecx,(%rdx)
+  800229:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80022c:	89 d1                	mov    %edx,%ecx
+  80022e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800232:	48 98                	cltq
+  800234:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800238:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80023c:	8b 00                	mov    (%rax),%eax
+  80023e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800243:	75 2c                	jne    800271 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800245:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800249:	8b 00                	mov    (%rax),%eax
+  80024b:	48 98                	cltq
+  80024d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800251:	48 83 c2 08          	add    $0x8,%rdx
+  800255:	48 89 c6             	mov    %rax,%rsi
+  800258:	48 89 d7             	mov    %rdx,%rdi
+  80025b:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+    b->idx = 0;
+  800267:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80026b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800271:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800275:	8b 40 04             	mov    0x4(%rax),%eax
+  800278:	8d 50 01             	lea    0x1(%rax),%edx
+  80027b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80027f:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800282:	90                   	nop
+  800283:	c9                   	leave
+  800284:	c3                   	ret
+
+0000000000800285 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800285:	55                   	push   %rbp
+  800286:	48 89 e5             	mov    %rsp,%rbp
+  800289:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800290:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800297:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80029e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002a5:	00 00 00 
+  b.cnt = 0;
+  8002a8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002af:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8002b2:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8002b9:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8002c0:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002c7:	48 89 c6             	mov    %rax,%rsi
+  8002ca:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8002d1:	00 00 00 
+  8002d4:	48 89 c7             	mov    %rax,%rdi
+  8002d7:	48 b8 6a 06 80 00 00 	movabs $0x80066a,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8002e3:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002e9:	48 98                	cltq
+  8002eb:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002f2:	48 83 c2 08          	add    $0x8,%rdx
+  8002f6:	48 89 c6             	mov    %rax,%rsi
+  8002f9:	48 89 d7             	mov    %rdx,%rdi
+  8002fc:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800308:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+0000000000800310 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800310:	55                   	push   %rbp
+  800311:	48 89 e5             	mov    %rsp,%rbp
+  800314:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80031b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800322:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800329:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800330:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800337:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80033e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800345:	84 c0                	test   %al,%al
+  800347:	74 20                	je     800369 <cprintf+0x59>
+  800349:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80034d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800351:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800355:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800359:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80035d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800361:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800365:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800369:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800370:	00 00 00 
+  800373:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80037a:	00 00 00 
+  80037d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800381:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800388:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80038f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800396:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80039d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8003a4:	48 89 d6             	mov    %rdx,%rsi
+  8003a7:	48 89 c7             	mov    %rax,%rdi
+  8003aa:	48 b8 85 02 80 00 00 	movabs $0x800285,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+  8003b6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8003bc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003c2:	c9                   	leave
+  8003c3:	c3                   	ret
+
+00000000008003c4 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8003c4:	55                   	push   %rbp
+  8003c5:	48 89 e5             	mov    %rsp,%rbp
+  8003c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8003cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003d4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003d8:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003db:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003df:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8003e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003e6:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003ea:	72 54                	jb     800440 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003ec:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003ef:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003f2:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fe:	48 f7 f6             	div    %rsi
+  800401:	49 89 c2             	mov    %rax,%r10
+  800404:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800407:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80040a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80040e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800412:	41 89 c9             	mov    %ecx,%r9d
+  800415:	41 89 f8             	mov    %edi,%r8d
+  800418:	89 d1                	mov    %edx,%ecx
+  80041a:	4c 89 d2             	mov    %r10,%rdx
+  80041d:	48 89 c7             	mov    %rax,%rdi
+  800420:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+  80042c:	eb 1c                	jmp    80044a <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80042e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800432:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800435:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800439:	48 89 d6             	mov    %rdx,%rsi
+  80043c:	89 c7                	mov    %eax,%edi
+  80043e:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800440:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800444:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800448:	7f e4                	jg     80042e <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80044a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80044d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800451:	ba 00 00 00 00       	mov    $0x0,%edx
+  800456:	48 f7 f1             	div    %rcx
+  800459:	48 b8 b0 66 80 00 00 	movabs $0x8066b0,%rax
+  800460:	00 00 00 
+  800463:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800467:	0f be c0             	movsbl %al,%eax
+  80046a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80046e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800472:	48 89 d6             	mov    %rdx,%rsi
+  800475:	89 c7                	mov    %eax,%edi
+  800477:	ff d1                	call   *%rcx
+}
+  800479:	90                   	nop
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+000000000080047c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80047c:	55                   	push   %rbp
+  80047d:	48 89 e5             	mov    %rsp,%rbp
+  800480:	48 83 ec 10          	sub    $0x10,%rsp
+  800484:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800488:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80048b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80048f:	7e 4b                	jle    8004dc <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800495:	8b 00                	mov    (%rax),%eax
+  800497:	83 f8 2f             	cmp    $0x2f,%eax
+  80049a:	77 24                	ja     8004c0 <getuint+0x44>
+  80049c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a8:	8b 00                	mov    (%rax),%eax
+  8004aa:	89 c0                	mov    %eax,%eax
+  8004ac:	48 01 d0             	add    %rdx,%rax
+  8004af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b3:	8b 12                	mov    (%rdx),%edx
+  8004b5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004bc:	89 0a                	mov    %ecx,(%rdx)
+  8004be:	eb 14                	jmp    8004d4 <getuint+0x58>
+  8004c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004c8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004d0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004d4:	48 8b 00             	mov    (%rax),%rax
+  8004d7:	e9 95 00 00 00       	jmp    800571 <getuint+0xf5>
+  else if (lflag)
+  8004dc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004e0:	74 48                	je     80052a <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8004e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e6:	8b 00                	mov    (%rax),%eax
+  8004e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004eb:	77 24                	ja     800511 <getuint+0x95>
+  8004ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f9:	8b 00                	mov    (%rax),%eax
+  8004fb:	89 c0                	mov    %eax,%eax
+  8004fd:	48 01 d0             	add    %rdx,%rax
+  800500:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800504:	8b 12                	mov    (%rdx),%edx
+  800506:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800509:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80050d:	89 0a                	mov    %ecx,(%rdx)
+  80050f:	eb 14                	jmp    800525 <getuint+0xa9>
+  800511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800515:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800519:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80051d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800521:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800525:	48 8b 00             	mov    (%rax),%rax
+  800528:	eb 47                	jmp    800571 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80052a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80052e:	8b 00                	mov    (%rax),%eax
+  800530:	83 f8 2f             	cmp    $0x2f,%eax
+  800533:	77 24                	ja     800559 <getuint+0xdd>
+  800535:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800539:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80053d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800541:	8b 00                	mov    (%rax),%eax
+  800543:	89 c0                	mov    %eax,%eax
+  800545:	48 01 d0             	add    %rdx,%rax
+  800548:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80054c:	8b 12                	mov    (%rdx),%edx
+  80054e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800551:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800555:	89 0a                	mov    %ecx,(%rdx)
+  800557:	eb 14                	jmp    80056d <getuint+0xf1>
+  800559:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80055d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800561:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800565:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800569:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80056d:	8b 00                	mov    (%rax),%eax
+  80056f:	89 c0                	mov    %eax,%eax
+}
+  800571:	c9                   	leave
+  800572:	c3                   	ret
+
+0000000000800573 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800573:	55                   	push   %rbp
+  800574:	48 89 e5             	mov    %rsp,%rbp
+  800577:	48 83 ec 10          	sub    $0x10,%rsp
+  80057b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80057f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800582:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800586:	7e 4b                	jle    8005d3 <getint+0x60>
+    return va_arg(*ap, long long);
+  800588:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80058c:	8b 00                	mov    (%rax),%eax
+  80058e:	83 f8 2f             	cmp    $0x2f,%eax
+  800591:	77 24                	ja     8005b7 <getint+0x44>
+  800593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800597:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80059b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80059f:	8b 00                	mov    (%rax),%eax
+  8005a1:	89 c0                	mov    %eax,%eax
+  8005a3:	48 01 d0             	add    %rdx,%rax
+  8005a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005aa:	8b 12                	mov    (%rdx),%edx
+  8005ac:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005b3:	89 0a                	mov    %ecx,(%rdx)
+  8005b5:	eb 14                	jmp    8005cb <getint+0x58>
+  8005b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005bb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005bf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005cb:	48 8b 00             	mov    (%rax),%rax
+  8005ce:	e9 95 00 00 00       	jmp    800668 <getint+0xf5>
+  else if (lflag)
+  8005d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005d7:	74 48                	je     800621 <getint+0xae>
+    return va_arg(*ap, long);
+  8005d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005dd:	8b 00                	mov    (%rax),%eax
+  8005df:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e2:	77 24                	ja     800608 <getint+0x95>
+  8005e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f0:	8b 00                	mov    (%rax),%eax
+  8005f2:	89 c0                	mov    %eax,%eax
+  8005f4:	48 01 d0             	add    %rdx,%rax
+  8005f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005fb:	8b 12                	mov    (%rdx),%edx
+  8005fd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800600:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800604:	89 0a                	mov    %ecx,(%rdx)
+  800606:	eb 14                	jmp    80061c <getint+0xa9>
+  800608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800610:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800614:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800618:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80061c:	48 8b 00             	mov    (%rax),%rax
+  80061f:	eb 47                	jmp    800668 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800625:	8b 00                	mov    (%rax),%eax
+  800627:	83 f8 2f             	cmp    $0x2f,%eax
+  80062a:	77 24                	ja     800650 <getint+0xdd>
+  80062c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800630:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800638:	8b 00                	mov    (%rax),%eax
+  80063a:	89 c0                	mov    %eax,%eax
+  80063c:	48 01 d0             	add    %rdx,%rax
+  80063f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800643:	8b 12                	mov    (%rdx),%edx
+  800645:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800648:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80064c:	89 0a                	mov    %ecx,(%rdx)
+  80064e:	eb 14                	jmp    800664 <getint+0xf1>
+  800650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800654:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800658:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80065c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800660:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800664:	8b 00                	mov    (%rax),%eax
+  800666:	48 98                	cltq
+}
+  800668:	c9                   	leave
+  800669:	c3                   	ret
+
+000000000080066a <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80066a:	55                   	push   %rbp
+  80066b:	48 89 e5             	mov    %rsp,%rbp
+  80066e:	41 54                	push   %r12
+  800670:	53                   	push   %rbx
+  800671:	48 83 ec 60          	sub    $0x60,%rsp
+  800675:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800679:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80067d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800681:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800685:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800689:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80068d:	48 8b 06             	mov    (%rsi),%rax
+  800690:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800694:	48 89 01             	mov    %rax,(%rcx)
+  800697:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80069b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80069f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8006a3:	eb 17                	jmp    8006bc <vprintfmt+0x52>
+      if (ch == '\0')
+  8006a5:	85 db                	test   %ebx,%ebx
+  8006a7:	0f 84 bf 04 00 00    	je     800b6c <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8006ad:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006b1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006b5:	48 89 c6             	mov    %rax,%rsi
+  8006b8:	89 df                	mov    %ebx,%edi
+  8006ba:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8006bc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006c0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006c8:	0f b6 00             	movzbl (%rax),%eax
+  8006cb:	0f b6 d8             	movzbl %al,%ebx
+  8006ce:	83 fb 25             	cmp    $0x25,%ebx
+  8006d1:	75 d2                	jne    8006a5 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8006d3:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8006d7:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8006de:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8006e5:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8006ec:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8006f3:	eb 04                	jmp    8006f9 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8006f5:	90                   	nop
+  8006f6:	eb 01                	jmp    8006f9 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8006f8:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8006f9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006fd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800701:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800705:	0f b6 00             	movzbl (%rax),%eax
+  800708:	0f b6 d8             	movzbl %al,%ebx
+  80070b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80070e:	83 f8 55             	cmp    $0x55,%eax
+  800711:	0f 87 22 04 00 00    	ja     800b39 <vprintfmt+0x4cf>
+  800717:	89 c0                	mov    %eax,%eax
+  800719:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800720:	00 
+  800721:	48 b8 d8 66 80 00 00 	movabs $0x8066d8,%rax
+  800728:	00 00 00 
+  80072b:	48 01 d0             	add    %rdx,%rax
+  80072e:	48 8b 00             	mov    (%rax),%rax
+  800731:	ff e0                	jmp    *%rax
+        padc = '-';
+  800733:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800737:	eb c0                	jmp    8006f9 <vprintfmt+0x8f>
+        padc = '0';
+  800739:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80073d:	eb ba                	jmp    8006f9 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80073f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800746:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800749:	89 d0                	mov    %edx,%eax
+  80074b:	c1 e0 02             	shl    $0x2,%eax
+  80074e:	01 d0                	add    %edx,%eax
+  800750:	01 c0                	add    %eax,%eax
+  800752:	01 d8                	add    %ebx,%eax
+  800754:	83 e8 30             	sub    $0x30,%eax
+  800757:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80075a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80075e:	0f b6 00             	movzbl (%rax),%eax
+  800761:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800764:	83 fb 2f             	cmp    $0x2f,%ebx
+  800767:	7e 60                	jle    8007c9 <vprintfmt+0x15f>
+  800769:	83 fb 39             	cmp    $0x39,%ebx
+  80076c:	7f 5b                	jg     8007c9 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80076e:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800773:	eb d1                	jmp    800746 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800775:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800778:	83 f8 2f             	cmp    $0x2f,%eax
+  80077b:	77 17                	ja     800794 <vprintfmt+0x12a>
+  80077d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800781:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800784:	89 d2                	mov    %edx,%edx
+  800786:	48 01 d0             	add    %rdx,%rax
+  800789:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80078c:	83 c2 08             	add    $0x8,%edx
+  80078f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800792:	eb 0c                	jmp    8007a0 <vprintfmt+0x136>
+  800794:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800798:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80079c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007a0:	8b 00                	mov    (%rax),%eax
+  8007a2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8007a5:	eb 23                	jmp    8007ca <vprintfmt+0x160>
+        if (width < 0)
+  8007a7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007ab:	0f 89 44 ff ff ff    	jns    8006f5 <vprintfmt+0x8b>
+          width = 0;
+  8007b1:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8007b8:	e9 38 ff ff ff       	jmp    8006f5 <vprintfmt+0x8b>
+        altflag = 1;
+  8007bd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8007c4:	e9 30 ff ff ff       	jmp    8006f9 <vprintfmt+0x8f>
+        goto process_precision;
+  8007c9:	90                   	nop
+        if (width < 0)
+  8007ca:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007ce:	0f 89 24 ff ff ff    	jns    8006f8 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8007d4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007d7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007da:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8007e1:	e9 12 ff ff ff       	jmp    8006f8 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8007e6:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8007ea:	e9 0a ff ff ff       	jmp    8006f9 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8007ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f5:	77 17                	ja     80080e <vprintfmt+0x1a4>
+  8007f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007fb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007fe:	89 d2                	mov    %edx,%edx
+  800800:	48 01 d0             	add    %rdx,%rax
+  800803:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800806:	83 c2 08             	add    $0x8,%edx
+  800809:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80080c:	eb 0c                	jmp    80081a <vprintfmt+0x1b0>
+  80080e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800812:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800816:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80081a:	8b 00                	mov    (%rax),%eax
+  80081c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800820:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800824:	48 89 d6             	mov    %rdx,%rsi
+  800827:	89 c7                	mov    %eax,%edi
+  800829:	ff d1                	call   *%rcx
+        break;
+  80082b:	e9 37 03 00 00       	jmp    800b67 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 17                	ja     80084f <vprintfmt+0x1e5>
+  800838:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80083c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80083f:	89 d2                	mov    %edx,%edx
+  800841:	48 01 d0             	add    %rdx,%rax
+  800844:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800847:	83 c2 08             	add    $0x8,%edx
+  80084a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80084d:	eb 0c                	jmp    80085b <vprintfmt+0x1f1>
+  80084f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800853:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800857:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80085b:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80085d:	85 db                	test   %ebx,%ebx
+  80085f:	79 02                	jns    800863 <vprintfmt+0x1f9>
+          err = -err;
+  800861:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800863:	83 fb 15             	cmp    $0x15,%ebx
+  800866:	7f 16                	jg     80087e <vprintfmt+0x214>
+  800868:	48 ba 00 66 80 00 00 	movabs $0x806600,%rdx
+  80086f:	00 00 00 
+  800872:	48 63 c3             	movslq %ebx,%rax
+  800875:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800879:	4d 85 e4             	test   %r12,%r12
+  80087c:	75 2e                	jne    8008ac <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80087e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800882:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800886:	89 d9                	mov    %ebx,%ecx
+  800888:	48 ba c1 66 80 00 00 	movabs $0x8066c1,%rdx
+  80088f:	00 00 00 
+  800892:	48 89 c7             	mov    %rax,%rdi
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089a:	49 b8 76 0b 80 00 00 	movabs $0x800b76,%r8
+  8008a1:	00 00 00 
+  8008a4:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8008a7:	e9 bb 02 00 00       	jmp    800b67 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8008ac:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008b4:	4c 89 e1             	mov    %r12,%rcx
+  8008b7:	48 ba ca 66 80 00 00 	movabs $0x8066ca,%rdx
+  8008be:	00 00 00 
+  8008c1:	48 89 c7             	mov    %rax,%rdi
+  8008c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c9:	49 b8 76 0b 80 00 00 	movabs $0x800b76,%r8
+  8008d0:	00 00 00 
+  8008d3:	41 ff d0             	call   *%r8
+        break;
+  8008d6:	e9 8c 02 00 00       	jmp    800b67 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	77 17                	ja     8008fa <vprintfmt+0x290>
+  8008e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008e7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008ea:	89 d2                	mov    %edx,%edx
+  8008ec:	48 01 d0             	add    %rdx,%rax
+  8008ef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f2:	83 c2 08             	add    $0x8,%edx
+  8008f5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008f8:	eb 0c                	jmp    800906 <vprintfmt+0x29c>
+  8008fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800902:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800906:	4c 8b 20             	mov    (%rax),%r12
+  800909:	4d 85 e4             	test   %r12,%r12
+  80090c:	75 0a                	jne    800918 <vprintfmt+0x2ae>
+          p = "(null)";
+  80090e:	49 bc cd 66 80 00 00 	movabs $0x8066cd,%r12
+  800915:	00 00 00 
+        if (width > 0 && padc != '-')
+  800918:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80091c:	7e 78                	jle    800996 <vprintfmt+0x32c>
+  80091e:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800922:	74 72                	je     800996 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800924:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800927:	48 98                	cltq
+  800929:	48 89 c6             	mov    %rax,%rsi
+  80092c:	4c 89 e7             	mov    %r12,%rdi
+  80092f:	48 b8 82 12 80 00 00 	movabs $0x801282,%rax
+  800936:	00 00 00 
+  800939:	ff d0                	call   *%rax
+  80093b:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80093e:	eb 17                	jmp    800957 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800940:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800944:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800948:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80094c:	48 89 d6             	mov    %rdx,%rsi
+  80094f:	89 c7                	mov    %eax,%edi
+  800951:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800953:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800957:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80095b:	7f e3                	jg     800940 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80095d:	eb 37                	jmp    800996 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80095f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800963:	74 1e                	je     800983 <vprintfmt+0x319>
+  800965:	83 fb 1f             	cmp    $0x1f,%ebx
+  800968:	7e 05                	jle    80096f <vprintfmt+0x305>
+  80096a:	83 fb 7e             	cmp    $0x7e,%ebx
+  80096d:	7e 14                	jle    800983 <vprintfmt+0x319>
+            putch('?', putdat);
+  80096f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800973:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800977:	48 89 c6             	mov    %rax,%rsi
+  80097a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80097f:	ff d2                	call   *%rdx
+  800981:	eb 0f                	jmp    800992 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800983:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800987:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80098b:	48 89 c6             	mov    %rax,%rsi
+  80098e:	89 df                	mov    %ebx,%edi
+  800990:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800992:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800996:	4c 89 e0             	mov    %r12,%rax
+  800999:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80099d:	0f b6 00             	movzbl (%rax),%eax
+  8009a0:	0f be d8             	movsbl %al,%ebx
+  8009a3:	85 db                	test   %ebx,%ebx
+  8009a5:	74 28                	je     8009cf <vprintfmt+0x365>
+  8009a7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009ab:	78 b2                	js     80095f <vprintfmt+0x2f5>
+  8009ad:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009b1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009b5:	79 a8                	jns    80095f <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8009b7:	eb 16                	jmp    8009cf <vprintfmt+0x365>
+          putch(' ', putdat);
+  8009b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009bd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009c1:	48 89 c6             	mov    %rax,%rsi
+  8009c4:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009c9:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8009cb:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009cf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009d3:	7f e4                	jg     8009b9 <vprintfmt+0x34f>
+        break;
+  8009d5:	e9 8d 01 00 00       	jmp    800b67 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8009da:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009dd:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009e1:	89 d6                	mov    %edx,%esi
+  8009e3:	48 89 c7             	mov    %rax,%rdi
+  8009e6:	48 b8 73 05 80 00 00 	movabs $0x800573,%rax
+  8009ed:	00 00 00 
+  8009f0:	ff d0                	call   *%rax
+  8009f2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8009f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fa:	48 85 c0             	test   %rax,%rax
+  8009fd:	79 1d                	jns    800a1c <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8009ff:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a03:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a07:	48 89 c6             	mov    %rax,%rsi
+  800a0a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a0f:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a15:	48 f7 d8             	neg    %rax
+  800a18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800a1c:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a23:	e9 d2 00 00 00       	jmp    800afa <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800a28:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a2b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a2f:	89 d6                	mov    %edx,%esi
+  800a31:	48 89 c7             	mov    %rax,%rdi
+  800a34:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800a3b:	00 00 00 
+  800a3e:	ff d0                	call   *%rax
+  800a40:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a44:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a4b:	e9 aa 00 00 00       	jmp    800afa <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800a50:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a53:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a57:	89 d6                	mov    %edx,%esi
+  800a59:	48 89 c7             	mov    %rax,%rdi
+  800a5c:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800a63:	00 00 00 
+  800a66:	ff d0                	call   *%rax
+  800a68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800a6c:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800a73:	e9 82 00 00 00       	jmp    800afa <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800a78:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a7c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a80:	48 89 c6             	mov    %rax,%rsi
+  800a83:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a88:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800a8a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a8e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a92:	48 89 c6             	mov    %rax,%rsi
+  800a95:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a9a:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 17                	ja     800abb <vprintfmt+0x451>
+  800aa4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aa8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aab:	89 d2                	mov    %edx,%edx
+  800aad:	48 01 d0             	add    %rdx,%rax
+  800ab0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ab3:	83 c2 08             	add    $0x8,%edx
+  800ab6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ab9:	eb 0c                	jmp    800ac7 <vprintfmt+0x45d>
+  800abb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800abf:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ac3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ac7:	48 8b 00             	mov    (%rax),%rax
+  800aca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ace:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800ad5:	eb 23                	jmp    800afa <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ad7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ada:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ade:	89 d6                	mov    %edx,%esi
+  800ae0:	48 89 c7             	mov    %rax,%rdi
+  800ae3:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800aea:	00 00 00 
+  800aed:	ff d0                	call   *%rax
+  800aef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800af3:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800afa:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800aff:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b02:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b09:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b0d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b11:	45 89 c1             	mov    %r8d,%r9d
+  800b14:	41 89 f8             	mov    %edi,%r8d
+  800b17:	48 89 c7             	mov    %rax,%rdi
+  800b1a:	48 b8 c4 03 80 00 00 	movabs $0x8003c4,%rax
+  800b21:	00 00 00 
+  800b24:	ff d0                	call   *%rax
+        break;
+  800b26:	eb 3f                	jmp    800b67 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800b28:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b30:	48 89 c6             	mov    %rax,%rsi
+  800b33:	89 df                	mov    %ebx,%edi
+  800b35:	ff d2                	call   *%rdx
+        break;
+  800b37:	eb 2e                	jmp    800b67 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b39:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b3d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b41:	48 89 c6             	mov    %rax,%rsi
+  800b44:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b49:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800b4b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b50:	eb 05                	jmp    800b57 <vprintfmt+0x4ed>
+  800b52:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b57:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b5b:	48 83 e8 01          	sub    $0x1,%rax
+  800b5f:	0f b6 00             	movzbl (%rax),%eax
+  800b62:	3c 25                	cmp    $0x25,%al
+  800b64:	75 ec                	jne    800b52 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800b66:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b67:	e9 50 fb ff ff       	jmp    8006bc <vprintfmt+0x52>
+        return;
+  800b6c:	90                   	nop
+    }
+  }
+}
+  800b6d:	48 83 c4 60          	add    $0x60,%rsp
+  800b71:	5b                   	pop    %rbx
+  800b72:	41 5c                	pop    %r12
+  800b74:	5d                   	pop    %rbp
+  800b75:	c3                   	ret
+
+0000000000800b76 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800b76:	55                   	push   %rbp
+  800b77:	48 89 e5             	mov    %rsp,%rbp
+  800b7a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b81:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b88:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b8f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b96:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b9d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ba4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800bab:	84 c0                	test   %al,%al
+  800bad:	74 20                	je     800bcf <printfmt+0x59>
+  800baf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800bb3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800bb7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bbb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bbf:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bc3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bc7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bcb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800bcf:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bd6:	00 00 00 
+  800bd9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800be0:	00 00 00 
+  800be3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800be7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bee:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bf5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800bfc:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c03:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c0a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c11:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c18:	48 89 c7             	mov    %rax,%rdi
+  800c1b:	48 b8 6a 06 80 00 00 	movabs $0x80066a,%rax
+  800c22:	00 00 00 
+  800c25:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800c27:	90                   	nop
+  800c28:	c9                   	leave
+  800c29:	c3                   	ret
+
+0000000000800c2a <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800c2a:	55                   	push   %rbp
+  800c2b:	48 89 e5             	mov    %rsp,%rbp
+  800c2e:	48 83 ec 10          	sub    $0x10,%rsp
+  800c32:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c35:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c3d:	8b 40 10             	mov    0x10(%rax),%eax
+  800c40:	8d 50 01             	lea    0x1(%rax),%edx
+  800c43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c47:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800c4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c4e:	48 8b 10             	mov    (%rax),%rdx
+  800c51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c55:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c59:	48 39 c2             	cmp    %rax,%rdx
+  800c5c:	73 17                	jae    800c75 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c62:	48 8b 00             	mov    (%rax),%rax
+  800c65:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c69:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c6d:	48 89 0a             	mov    %rcx,(%rdx)
+  800c70:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c73:	88 10                	mov    %dl,(%rax)
+}
+  800c75:	90                   	nop
+  800c76:	c9                   	leave
+  800c77:	c3                   	ret
+
+0000000000800c78 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800c78:	55                   	push   %rbp
+  800c79:	48 89 e5             	mov    %rsp,%rbp
+  800c7c:	48 83 ec 40          	sub    $0x40,%rsp
+  800c80:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c84:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800c87:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c8b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c93:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c97:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c9a:	48 98                	cltq
+  800c9c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800ca0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ca4:	48 01 d0             	add    %rdx,%rax
+  800ca7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800cab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800cb2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800cb7:	74 06                	je     800cbf <vsnprintf+0x47>
+  800cb9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800cbd:	7f 07                	jg     800cc6 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800cbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc4:	eb 32                	jmp    800cf8 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800cc6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800cca:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800cce:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800cd2:	48 89 c6             	mov    %rax,%rsi
+  800cd5:	48 b8 2a 0c 80 00 00 	movabs $0x800c2a,%rax
+  800cdc:	00 00 00 
+  800cdf:	48 89 c7             	mov    %rax,%rdi
+  800ce2:	48 b8 6a 06 80 00 00 	movabs $0x80066a,%rax
+  800ce9:	00 00 00 
+  800cec:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800cee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cf2:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800cf5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cf8:	c9                   	leave
+  800cf9:	c3                   	ret
+
+0000000000800cfa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800cfa:	55                   	push   %rbp
+  800cfb:	48 89 e5             	mov    %rsp,%rbp
+  800cfe:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d05:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d0c:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800d12:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d19:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d20:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d27:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d2e:	84 c0                	test   %al,%al
+  800d30:	74 20                	je     800d52 <snprintf+0x58>
+  800d32:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d36:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d3a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d3e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d42:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d46:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d4a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d4e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d52:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d59:	00 00 00 
+  800d5c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d63:	00 00 00 
+  800d66:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d6a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d71:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d78:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d7f:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800d86:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d8d:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d93:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d9a:	48 89 c7             	mov    %rax,%rdi
+  800d9d:	48 b8 78 0c 80 00 00 	movabs $0x800c78,%rax
+  800da4:	00 00 00 
+  800da7:	ff d0                	call   *%rax
+  800da9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800daf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800db5:	c9                   	leave
+  800db6:	c3                   	ret
+
+0000000000800db7 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800db7:	55                   	push   %rbp
+  800db8:	48 89 e5             	mov    %rsp,%rbp
+  800dbb:	53                   	push   %rbx
+  800dbc:	48 83 ec 38          	sub    $0x38,%rsp
+  800dc0:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800dc3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800dc7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800dcb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dcf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800dd3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddb:	89 d1                	mov    %edx,%ecx
+  800ddd:	0f a2                	cpuid
+  800ddf:	89 de                	mov    %ebx,%esi
+  800de1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800de4:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800de7:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800dea:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ded:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800df2:	74 09                	je     800dfd <cpuid+0x46>
+}
+  800df4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800df8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800dfb:	89 10                	mov    %edx,(%rax)
+
+  800dfd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e02:	74 09                	je     800e0d <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800e04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e08:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e0b:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800e0d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e12:	74 09                	je     800e1d <cpuid+0x66>
+char *
+  800e14:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e18:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e1b:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800e1d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e22:	74 09                	je     800e2d <cpuid+0x76>
+  for (; *s; s++)
+  800e24:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e28:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e2b:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800e2d:	90                   	nop
+  800e2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e32:	c9                   	leave
+  800e33:	c3                   	ret
+
+0000000000800e34 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800e34:	55                   	push   %rbp
+  800e35:	48 89 e5             	mov    %rsp,%rbp
+  800e38:	48 83 ec 18          	sub    $0x18,%rsp
+  800e3c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e42:	89 c1                	mov    %eax,%ecx
+  800e44:	0f 01 d0             	xgetbv
+  800e47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e4a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800e4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e50:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800e53:	48 c1 e2 20          	shl    $0x20,%rdx
+  800e57:	48 09 d0             	or     %rdx,%rax
+#else
+  800e5a:	c9                   	leave
+  800e5b:	c3                   	ret
+
+0000000000800e5c <string_cpu>:
+string_cpu(void) {
+  800e5c:	55                   	push   %rbp
+  800e5d:	48 89 e5             	mov    %rsp,%rbp
+  800e60:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800e64:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800e6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800e72:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e79:	00 00 00 
+  800e7c:	8b 00                	mov    (%rax),%eax
+  800e7e:	85 c0                	test   %eax,%eax
+  800e80:	78 11                	js     800e93 <string_cpu+0x37>
+    return string_features;
+  800e82:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e89:	00 00 00 
+  800e8c:	8b 00                	mov    (%rax),%eax
+  800e8e:	e9 df 00 00 00       	jmp    800f72 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e93:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea7:	48 89 c6             	mov    %rax,%rsi
+  800eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eaf:	48 b8 b7 0d 80 00 00 	movabs $0x800db7,%rax
+  800eb6:	00 00 00 
+  800eb9:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800ebb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800ebe:	83 f8 06             	cmp    $0x6,%eax
+  800ec1:	76 28                	jbe    800eeb <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800ec3:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800ec7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ecd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed2:	48 89 c2             	mov    %rax,%rdx
+  800ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eda:	bf 07 00 00 00       	mov    $0x7,%edi
+  800edf:	48 b8 b7 0d 80 00 00 	movabs $0x800db7,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800eeb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800eee:	25 00 02 00 00       	and    $0x200,%eax
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	74 04                	je     800efb <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800ef7:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800efb:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800eff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f05:	48 89 c1             	mov    %rax,%rcx
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f12:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f17:	48 b8 b7 0d 80 00 00 	movabs $0x800db7,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f23:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800f26:	83 e0 20             	and    $0x20,%eax
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	74 2a                	je     800f57 <string_cpu+0xfb>
+  800f2d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800f30:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f35:	85 c0                	test   %eax,%eax
+  800f37:	74 1e                	je     800f57 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f39:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f3e:	48 b8 34 0e 80 00 00 	movabs $0x800e34,%rax
+  800f45:	00 00 00 
+  800f48:	ff d0                	call   *%rax
+  800f4a:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f4d:	48 83 f8 06          	cmp    $0x6,%rax
+  800f51:	75 04                	jne    800f57 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800f53:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800f57:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800f5e:	00 00 00 
+  800f61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f64:	89 02                	mov    %eax,(%rdx)
+  800f66:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f6d:	00 00 00 
+  800f70:	8b 00                	mov    (%rax),%eax
+}
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+0000000000800f74 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800f74:	55                   	push   %rbp
+  800f75:	48 89 e5             	mov    %rsp,%rbp
+  800f78:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f7c:	48 83 ec 60          	sub    $0x60,%rsp
+  800f80:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800f85:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f8a:	83 e0 1f             	and    $0x1f,%eax
+  800f8d:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f91:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f95:	48 f7 d8             	neg    %rax
+  800f98:	48 89 c2             	mov    %rax,%rdx
+  800f9b:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800fa0:	48 01 d0             	add    %rdx,%rax
+  800fa3:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800fa8:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800fac:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800fb2:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fb7:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fbb:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fc1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fc5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fc9:	89 c2                	mov    %eax,%edx
+  800fcb:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800fcf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800fd4:	89 c1                	mov    %eax,%ecx
+  800fd6:	d3 e6                	shl    %cl,%esi
+  800fd8:	89 f0                	mov    %esi,%eax
+  800fda:	21 d0                	and    %edx,%eax
+  800fdc:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fe0:	eb 21                	jmp    801003 <strlen_avx2+0x8f>
+    p += 32;
+  800fe2:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800fe8:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fed:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ff1:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ff7:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ffb:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fff:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801003:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801008:	74 d8                	je     800fe2 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80100a:	31 c0                	xor    %eax,%eax
+  80100c:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801012:	48 63 d0             	movslq %eax,%rdx
+  801015:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80101a:	48 01 d0             	add    %rdx,%rax
+  80101d:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801022:	c9                   	leave
+  801023:	c3                   	ret
+
+0000000000801024 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801024:	55                   	push   %rbp
+  801025:	48 89 e5             	mov    %rsp,%rbp
+  801028:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80102c:	48 83 ec 40          	sub    $0x40,%rsp
+  801030:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801035:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80103a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80103f:	eb 77                	jmp    8010b8 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801041:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801046:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80104a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80104e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801053:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801057:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80105b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80105f:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801063:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801068:	74 3c                	je     8010a6 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80106a:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80106e:	f7 d0                	not    %eax
+  801070:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801074:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801078:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80107c:	48 63 d0             	movslq %eax,%rdx
+  80107f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801084:	48 01 d0             	add    %rdx,%rax
+  801087:	0f b6 00             	movzbl (%rax),%eax
+  80108a:	0f b6 c0             	movzbl %al,%eax
+  80108d:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801091:	48 63 ca             	movslq %edx,%rcx
+  801094:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801099:	48 01 ca             	add    %rcx,%rdx
+  80109c:	0f b6 12             	movzbl (%rdx),%edx
+  80109f:	0f b6 d2             	movzbl %dl,%edx
+  8010a2:	29 d0                	sub    %edx,%eax
+  8010a4:	eb 6b                	jmp    801111 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8010a6:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8010ac:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8010b2:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8010b8:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8010be:	77 81                	ja     801041 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8010c0:	eb 42                	jmp    801104 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8010c2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010c7:	0f b6 10             	movzbl (%rax),%edx
+  8010ca:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010cf:	0f b6 00             	movzbl (%rax),%eax
+  8010d2:	38 c2                	cmp    %al,%dl
+  8010d4:	74 1c                	je     8010f2 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8010d6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010db:	0f b6 00             	movzbl (%rax),%eax
+  8010de:	0f b6 c8             	movzbl %al,%ecx
+  8010e1:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010e6:	0f b6 00             	movzbl (%rax),%eax
+  8010e9:	0f b6 d0             	movzbl %al,%edx
+  8010ec:	89 c8                	mov    %ecx,%eax
+  8010ee:	29 d0                	sub    %edx,%eax
+  8010f0:	eb 1f                	jmp    801111 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8010f2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010f8:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8010fe:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801104:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80110a:	75 b6                	jne    8010c2 <memcmp_avx2+0x9e>
+  return 0;
+  80110c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801111:	c9                   	leave
+  801112:	c3                   	ret
+
+0000000000801113 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801113:	55                   	push   %rbp
+  801114:	48 89 e5             	mov    %rsp,%rbp
+  801117:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80111b:	48 83 ec 60          	sub    $0x60,%rsp
+  80111f:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801124:	89 f0                	mov    %esi,%eax
+  801126:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80112b:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80112f:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801134:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801138:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80113d:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801143:	eb 47                	jmp    80118c <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801145:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80114a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80114e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801152:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801158:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80115c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801160:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801164:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801169:	74 15                	je     801180 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80116b:	31 c0                	xor    %eax,%eax
+  80116d:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801173:	48 63 d0             	movslq %eax,%rdx
+  801176:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80117b:	48 01 d0             	add    %rdx,%rax
+  80117e:	eb 3d                	jmp    8011bd <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801180:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801186:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80118c:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801192:	77 b1                	ja     801145 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801194:	eb 0c                	jmp    8011a2 <memfind_avx2+0x8f>
+  801196:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80119c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8011a2:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8011a8:	74 0e                	je     8011b8 <memfind_avx2+0xa5>
+  8011aa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011af:	0f b6 00             	movzbl (%rax),%eax
+  8011b2:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8011b6:	75 de                	jne    801196 <memfind_avx2+0x83>
+  return s;
+  8011b8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8011bd:	c9                   	leave
+  8011be:	c3                   	ret
+
+00000000008011bf <strlen>:
+strlen(const char *s) {
+  8011bf:	55                   	push   %rbp
+  8011c0:	48 89 e5             	mov    %rsp,%rbp
+  8011c3:	48 83 ec 40          	sub    $0x40,%rsp
+  8011c7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8011cb:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8011cf:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8011d3:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+  8011df:	83 e0 02             	and    $0x2,%eax
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	74 18                	je     8011fe <strlen+0x3f>
+    return strlen_avx2(s);
+  8011e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011ea:	48 89 c7             	mov    %rax,%rdi
+  8011ed:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  8011f4:	00 00 00 
+  8011f7:	ff d0                	call   *%rax
+  8011f9:	e9 82 00 00 00       	jmp    801280 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8011fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801202:	83 e0 0f             	and    $0xf,%eax
+  801205:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801208:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80120b:	48 f7 d8             	neg    %rax
+  80120e:	48 89 c2             	mov    %rax,%rdx
+  801211:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801215:	48 01 d0             	add    %rdx,%rax
+  801218:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80121c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801220:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801224:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801229:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80122d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801231:	89 c2                	mov    %eax,%edx
+  801233:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801236:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80123b:	89 c1                	mov    %eax,%ecx
+  80123d:	d3 e6                	shl    %cl,%esi
+  80123f:	89 f0                	mov    %esi,%eax
+  801241:	21 d0                	and    %edx,%eax
+  801243:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801246:	eb 1d                	jmp    801265 <strlen+0xa6>
+    p += 16;
+  801248:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80124d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801251:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801255:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80125a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80125e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801262:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801265:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801269:	74 dd                	je     801248 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80126b:	31 c0                	xor    %eax,%eax
+  80126d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801272:	48 63 d0             	movslq %eax,%rdx
+  801275:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801279:	48 01 d0             	add    %rdx,%rax
+  80127c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801280:	c9                   	leave
+  801281:	c3                   	ret
+
+0000000000801282 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801282:	55                   	push   %rbp
+  801283:	48 89 e5             	mov    %rsp,%rbp
+  801286:	48 83 ec 20          	sub    $0x20,%rsp
+  80128a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80128e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801292:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801299:	eb 0e                	jmp    8012a9 <strnlen+0x27>
+    n++;
+  80129b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80129f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8012a4:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8012a9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8012ae:	74 0b                	je     8012bb <strnlen+0x39>
+  8012b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b4:	0f b6 00             	movzbl (%rax),%eax
+  8012b7:	84 c0                	test   %al,%al
+  8012b9:	75 e0                	jne    80129b <strnlen+0x19>
+  return n;
+  8012bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+
+00000000008012c0 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+  8012c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8012c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8012d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8012d8:	90                   	nop
+  8012d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012dd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012e1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012ed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012f1:	0f b6 12             	movzbl (%rdx),%edx
+  8012f4:	88 10                	mov    %dl,(%rax)
+  8012f6:	0f b6 00             	movzbl (%rax),%eax
+  8012f9:	84 c0                	test   %al,%al
+  8012fb:	75 dc                	jne    8012d9 <strcpy+0x19>
+  return ret;
+  8012fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801301:	c9                   	leave
+  801302:	c3                   	ret
+
+0000000000801303 <strcat>:
+strcat(char *dst, const char *src) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	48 83 ec 20          	sub    $0x20,%rsp
+  80130b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80130f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801313:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801317:	48 89 c7             	mov    %rax,%rdi
+  80131a:	48 b8 bf 11 80 00 00 	movabs $0x8011bf,%rax
+  801321:	00 00 00 
+  801324:	ff d0                	call   *%rax
+  801326:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801329:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80132c:	48 63 d0             	movslq %eax,%rdx
+  80132f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801333:	48 01 c2             	add    %rax,%rdx
+  801336:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80133a:	48 89 c6             	mov    %rax,%rsi
+  80133d:	48 89 d7             	mov    %rdx,%rdi
+  801340:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  801347:	00 00 00 
+  80134a:	ff d0                	call   *%rax
+  return dst;
+  80134c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+0000000000801352 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	48 83 ec 28          	sub    $0x28,%rsp
+  80135a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80135e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801362:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801366:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80136a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80136e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801375:	00 
+  801376:	eb 2a                	jmp    8013a2 <strncpy+0x50>
+    *dst++ = *src;
+  801378:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801380:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801384:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801388:	0f b6 12             	movzbl (%rdx),%edx
+  80138b:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80138d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801391:	0f b6 00             	movzbl (%rax),%eax
+  801394:	84 c0                	test   %al,%al
+  801396:	74 05                	je     80139d <strncpy+0x4b>
+      src++;
+  801398:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80139d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013aa:	72 cc                	jb     801378 <strncpy+0x26>
+  return ret;
+  8013ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013b0:	c9                   	leave
+  8013b1:	c3                   	ret
+
+00000000008013b2 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8013b2:	55                   	push   %rbp
+  8013b3:	48 89 e5             	mov    %rsp,%rbp
+  8013b6:	48 83 ec 28          	sub    $0x28,%rsp
+  8013ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013c2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8013c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8013ce:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013d3:	74 3d                	je     801412 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8013d5:	eb 1d                	jmp    8013f4 <strlcpy+0x42>
+      *dst++ = *src++;
+  8013d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013db:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013df:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013ef:	0f b6 12             	movzbl (%rdx),%edx
+  8013f2:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8013f4:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013f9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013fe:	74 0b                	je     80140b <strlcpy+0x59>
+  801400:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801404:	0f b6 00             	movzbl (%rax),%eax
+  801407:	84 c0                	test   %al,%al
+  801409:	75 cc                	jne    8013d7 <strlcpy+0x25>
+    *dst = '\0';
+  80140b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140f:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801412:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801416:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80141a:	c9                   	leave
+  80141b:	c3                   	ret
+
+000000000080141c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	48 83 ec 30          	sub    $0x30,%rsp
+  801424:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801428:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80142c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801430:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801434:	48 89 c7             	mov    %rax,%rdi
+  801437:	48 b8 bf 11 80 00 00 	movabs $0x8011bf,%rax
+  80143e:	00 00 00 
+  801441:	ff d0                	call   *%rax
+  801443:	48 98                	cltq
+  801445:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801449:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80144d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801451:	48 89 d6             	mov    %rdx,%rsi
+  801454:	48 89 c7             	mov    %rax,%rdi
+  801457:	48 b8 82 12 80 00 00 	movabs $0x801282,%rax
+  80145e:	00 00 00 
+  801461:	ff d0                	call   *%rax
+  801463:	48 98                	cltq
+  801465:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80146d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801471:	75 10                	jne    801483 <strlcat+0x67>
+    return maxlen + srclen;
+  801473:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80147b:	48 01 d0             	add    %rdx,%rax
+  80147e:	e9 86 00 00 00       	jmp    801509 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801483:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801487:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80148b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80148f:	73 2b                	jae    8014bc <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801495:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801499:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80149d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a1:	48 01 c1             	add    %rax,%rcx
+  8014a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014a8:	48 89 c6             	mov    %rax,%rsi
+  8014ab:	48 89 cf             	mov    %rcx,%rdi
+  8014ae:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  8014b5:	00 00 00 
+  8014b8:	ff d0                	call   *%rax
+  8014ba:	eb 42                	jmp    8014fe <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8014bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014c0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014c4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014cc:	48 01 c1             	add    %rax,%rcx
+  8014cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014d3:	48 89 c6             	mov    %rax,%rsi
+  8014d6:	48 89 cf             	mov    %rcx,%rdi
+  8014d9:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  8014e0:	00 00 00 
+  8014e3:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8014e5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ed:	48 01 d0             	add    %rdx,%rax
+  8014f0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f8:	48 01 d0             	add    %rdx,%rax
+  8014fb:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8014fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801506:	48 01 d0             	add    %rdx,%rax
+}
+  801509:	c9                   	leave
+  80150a:	c3                   	ret
+
+000000000080150b <strcmp>:
+strcmp(const char *p, const char *q) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	48 83 ec 10          	sub    $0x10,%rsp
+  801513:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801517:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80151b:	eb 0a                	jmp    801527 <strcmp+0x1c>
+    p++, q++;
+  80151d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801522:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80152b:	0f b6 00             	movzbl (%rax),%eax
+  80152e:	84 c0                	test   %al,%al
+  801530:	74 12                	je     801544 <strcmp+0x39>
+  801532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801536:	0f b6 10             	movzbl (%rax),%edx
+  801539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153d:	0f b6 00             	movzbl (%rax),%eax
+  801540:	38 c2                	cmp    %al,%dl
+  801542:	74 d9                	je     80151d <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801544:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801548:	0f b6 00             	movzbl (%rax),%eax
+  80154b:	0f b6 d0             	movzbl %al,%edx
+  80154e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801552:	0f b6 00             	movzbl (%rax),%eax
+  801555:	0f b6 c0             	movzbl %al,%eax
+  801558:	29 c2                	sub    %eax,%edx
+  80155a:	89 d0                	mov    %edx,%eax
+}
+  80155c:	c9                   	leave
+  80155d:	c3                   	ret
+
+000000000080155e <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+  801562:	48 83 ec 18          	sub    $0x18,%rsp
+  801566:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80156a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80156e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801572:	eb 0f                	jmp    801583 <strncmp+0x25>
+    n--, p++, q++;
+  801574:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801579:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80157e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801583:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801588:	74 1d                	je     8015a7 <strncmp+0x49>
+  80158a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158e:	0f b6 00             	movzbl (%rax),%eax
+  801591:	84 c0                	test   %al,%al
+  801593:	74 12                	je     8015a7 <strncmp+0x49>
+  801595:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801599:	0f b6 10             	movzbl (%rax),%edx
+  80159c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a0:	0f b6 00             	movzbl (%rax),%eax
+  8015a3:	38 c2                	cmp    %al,%dl
+  8015a5:	74 cd                	je     801574 <strncmp+0x16>
+  if (n == 0)
+  8015a7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015ac:	75 07                	jne    8015b5 <strncmp+0x57>
+    return 0;
+  8015ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b3:	eb 16                	jmp    8015cb <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8015b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b9:	0f b6 00             	movzbl (%rax),%eax
+  8015bc:	0f b6 d0             	movzbl %al,%edx
+  8015bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c3:	0f b6 00             	movzbl (%rax),%eax
+  8015c6:	0f b6 c0             	movzbl %al,%eax
+  8015c9:	29 c2                	sub    %eax,%edx
+}
+  8015cb:	89 d0                	mov    %edx,%eax
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+
+00000000008015cf <strchr>:
+strchr(const char *s, char c) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	48 83 ec 60          	sub    $0x60,%rsp
+  8015d7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8015db:	89 f0                	mov    %esi,%eax
+  8015dd:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8015e0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015e4:	83 e0 0f             	and    $0xf,%eax
+  8015e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8015ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015ed:	48 f7 d8             	neg    %rax
+  8015f0:	48 89 c2             	mov    %rax,%rdx
+  8015f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015f7:	48 01 d0             	add    %rdx,%rax
+  8015fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8015fe:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801602:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801606:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80160a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80160e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801612:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801616:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80161b:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80161f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801623:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801627:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80162b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801630:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801635:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801639:	89 c2                	mov    %eax,%edx
+  80163b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801640:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801645:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801649:	09 c2                	or     %eax,%edx
+  80164b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80164e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801653:	89 c1                	mov    %eax,%ecx
+  801655:	d3 e6                	shl    %cl,%esi
+  801657:	89 f0                	mov    %esi,%eax
+  801659:	21 d0                	and    %edx,%eax
+  80165b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80165e:	eb 34                	jmp    801694 <strchr+0xc5>
+    p += 16;
+  801660:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801665:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801669:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80166d:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801671:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801676:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80167b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80167f:	89 c2                	mov    %eax,%edx
+  801681:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801686:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80168b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80168f:	09 d0                	or     %edx,%eax
+  801691:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801694:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801698:	74 c6                	je     801660 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80169a:	31 c0                	xor    %eax,%eax
+  80169c:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8016a1:	48 98                	cltq
+  8016a3:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8016a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ab:	0f b6 00             	movzbl (%rax),%eax
+  8016ae:	84 c0                	test   %al,%al
+  8016b0:	74 06                	je     8016b8 <strchr+0xe9>
+  8016b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b6:	eb 05                	jmp    8016bd <strchr+0xee>
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+
+00000000008016bf <strfind>:
+strfind(const char *s, char c) {
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+  8016c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8016c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016cb:	89 f0                	mov    %esi,%eax
+  8016cd:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8016d0:	eb 11                	jmp    8016e3 <strfind+0x24>
+    if (*s == c)
+  8016d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d6:	0f b6 00             	movzbl (%rax),%eax
+  8016d9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016dc:	74 12                	je     8016f0 <strfind+0x31>
+  for (; *s; s++)
+  8016de:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e7:	0f b6 00             	movzbl (%rax),%eax
+  8016ea:	84 c0                	test   %al,%al
+  8016ec:	75 e4                	jne    8016d2 <strfind+0x13>
+  8016ee:	eb 01                	jmp    8016f1 <strfind+0x32>
+      break;
+  8016f0:	90                   	nop
+  return (char *)s;
+  8016f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+
+00000000008016f7 <memset>:
+memset(void *v, int c, size_t n) {
+  8016f7:	55                   	push   %rbp
+  8016f8:	48 89 e5             	mov    %rsp,%rbp
+  8016fb:	48 83 ec 38          	sub    $0x38,%rsp
+  8016ff:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801703:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801706:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80170a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80170e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801712:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801717:	76 41                	jbe    80175a <memset+0x63>
+  801719:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  801720:	00 00 00 
+  801723:	ff d0                	call   *%rax
+  801725:	83 e0 01             	and    $0x1,%eax
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	74 2e                	je     80175a <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80172c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80172f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801733:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801737:	48 89 ce             	mov    %rcx,%rsi
+  80173a:	48 89 f7             	mov    %rsi,%rdi
+  80173d:	48 89 d1             	mov    %rdx,%rcx
+  801740:	fc                   	cld
+  801741:	f3 aa                	rep stos %al,%es:(%rdi)
+  801743:	48 89 ca             	mov    %rcx,%rdx
+  801746:	48 89 fe             	mov    %rdi,%rsi
+  801749:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80174d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801751:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801755:	e9 a7 00 00 00       	jmp    801801 <memset+0x10a>
+  if (n >= 8) {
+  80175a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80175f:	0f 86 87 00 00 00    	jbe    8017ec <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801765:	eb 16                	jmp    80177d <memset+0x86>
+      *p++ = c;
+  801767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80176f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801773:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801776:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801778:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80177d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801781:	83 e0 07             	and    $0x7,%eax
+  801784:	48 85 c0             	test   %rax,%rax
+  801787:	75 de                	jne    801767 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801789:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80178c:	0f b6 c0             	movzbl %al,%eax
+  80178f:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801796:	01 01 01 
+  801799:	48 0f af c2          	imul   %rdx,%rax
+  80179d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8017a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a5:	48 c1 e8 03          	shr    $0x3,%rax
+  8017a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8017ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017b9:	48 89 ce             	mov    %rcx,%rsi
+  8017bc:	48 89 f7             	mov    %rsi,%rdi
+  8017bf:	48 89 d1             	mov    %rdx,%rcx
+  8017c2:	fc                   	cld
+  8017c3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8017c6:	48 89 ca             	mov    %rcx,%rdx
+  8017c9:	48 89 fe             	mov    %rdi,%rsi
+  8017cc:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8017d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8017d4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8017d9:	eb 11                	jmp    8017ec <memset+0xf5>
+    *p++ = c;
+  8017db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017df:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017e3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017e7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017ea:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8017ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017f0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017f8:	48 85 c0             	test   %rax,%rax
+  8017fb:	75 de                	jne    8017db <memset+0xe4>
+  return v;
+  8017fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801801:	c9                   	leave
+  801802:	c3                   	ret
+
+0000000000801803 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+  801807:	48 83 ec 38          	sub    $0x38,%rsp
+  80180b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80180f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801813:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801817:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80181b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80181f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801823:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80182f:	0f 83 da 00 00 00    	jae    80190f <memmove+0x10c>
+  801835:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801839:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80183d:	48 01 d0             	add    %rdx,%rax
+  801840:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801844:	0f 83 c5 00 00 00    	jae    80190f <memmove+0x10c>
+    s += n;
+  80184a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80184e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801852:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801856:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80185a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80185f:	0f 86 94 00 00 00    	jbe    8018f9 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801865:	eb 1c                	jmp    801883 <memmove+0x80>
+        *--d = *--s;
+  801867:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80186c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801871:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801875:	0f b6 10             	movzbl (%rax),%edx
+  801878:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80187c:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80187e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801883:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801887:	83 e0 07             	and    $0x7,%eax
+  80188a:	48 85 c0             	test   %rax,%rax
+  80188d:	75 d8                	jne    801867 <memmove+0x64>
+      nq = n / 8;
+  80188f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801893:	48 c1 e8 03          	shr    $0x3,%rax
+  801897:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80189b:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8018a0:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8018a5:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8018aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b6:	48 89 cf             	mov    %rcx,%rdi
+  8018b9:	48 89 d6             	mov    %rdx,%rsi
+  8018bc:	48 89 c1             	mov    %rax,%rcx
+  8018bf:	fd                   	std
+  8018c0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018c3:	fc                   	cld
+  8018c4:	48 89 c8             	mov    %rcx,%rax
+  8018c7:	48 89 f2             	mov    %rsi,%rdx
+  8018ca:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018ce:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018d2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8018d6:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8018db:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8018e0:	eb 17                	jmp    8018f9 <memmove+0xf6>
+      *--d = *--s;
+  8018e2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018e7:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f0:	0f b6 10             	movzbl (%rax),%edx
+  8018f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f7:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801901:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801905:	48 85 c0             	test   %rax,%rax
+  801908:	75 d8                	jne    8018e2 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80190a:	e9 f4 00 00 00       	jmp    801a03 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80190f:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801914:	76 46                	jbe    80195c <memmove+0x159>
+  801916:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  80191d:	00 00 00 
+  801920:	ff d0                	call   *%rax
+  801922:	83 e0 01             	and    $0x1,%eax
+  801925:	85 c0                	test   %eax,%eax
+  801927:	74 33                	je     80195c <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801929:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80192d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801931:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801935:	48 89 cf             	mov    %rcx,%rdi
+  801938:	48 89 d6             	mov    %rdx,%rsi
+  80193b:	48 89 c1             	mov    %rax,%rcx
+  80193e:	fc                   	cld
+  80193f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801941:	48 89 c8             	mov    %rcx,%rax
+  801944:	48 89 f2             	mov    %rsi,%rdx
+  801947:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80194b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80194f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801953:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801957:	e9 ab 00 00 00       	jmp    801a07 <memmove+0x204>
+    if (n >= 8) {
+  80195c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801961:	0f 86 8b 00 00 00    	jbe    8019f2 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801967:	eb 22                	jmp    80198b <memmove+0x188>
+        *d++ = *s++;
+  801969:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80196d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801971:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801979:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80197d:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801981:	0f b6 12             	movzbl (%rdx),%edx
+  801984:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801986:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80198b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198f:	83 e0 07             	and    $0x7,%eax
+  801992:	48 85 c0             	test   %rax,%rax
+  801995:	75 d2                	jne    801969 <memmove+0x166>
+      nq = n / 8;
+  801997:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80199b:	48 c1 e8 03          	shr    $0x3,%rax
+  80199f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8019a3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019af:	48 89 cf             	mov    %rcx,%rdi
+  8019b2:	48 89 d6             	mov    %rdx,%rsi
+  8019b5:	48 89 c1             	mov    %rax,%rcx
+  8019b8:	fc                   	cld
+  8019b9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019bc:	48 89 c8             	mov    %rcx,%rax
+  8019bf:	48 89 f2             	mov    %rsi,%rdx
+  8019c2:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019c6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019ca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019ce:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8019d3:	eb 1d                	jmp    8019f2 <memmove+0x1ef>
+      *d++ = *s++;
+  8019d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019e5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019e9:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019ed:	0f b6 12             	movzbl (%rdx),%edx
+  8019f0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019f6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019fe:	48 85 c0             	test   %rax,%rax
+  801a01:	75 d2                	jne    8019d5 <memmove+0x1d2>
+  return dst;
+  801a03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a07:	c9                   	leave
+  801a08:	c3                   	ret
+
+0000000000801a09 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a09:	55                   	push   %rbp
+  801a0a:	48 89 e5             	mov    %rsp,%rbp
+  801a0d:	48 83 ec 18          	sub    $0x18,%rsp
+  801a11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a15:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a19:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801a1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a21:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a29:	48 89 ce             	mov    %rcx,%rsi
+  801a2c:	48 89 c7             	mov    %rax,%rdi
+  801a2f:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  801a36:	00 00 00 
+  801a39:	ff d0                	call   *%rax
+}
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+
+0000000000801a3d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a3d:	55                   	push   %rbp
+  801a3e:	48 89 e5             	mov    %rsp,%rbp
+  801a41:	48 83 ec 40          	sub    $0x40,%rsp
+  801a45:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a49:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a4d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801a51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a55:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801a59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801a61:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801a66:	0f 86 a7 00 00 00    	jbe    801b13 <memcmp+0xd6>
+  801a6c:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  801a73:	00 00 00 
+  801a76:	ff d0                	call   *%rax
+  801a78:	83 e0 02             	and    $0x2,%eax
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	0f 84 90 00 00 00    	je     801b13 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801a83:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a87:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8f:	48 89 ce             	mov    %rcx,%rsi
+  801a92:	48 89 c7             	mov    %rax,%rdi
+  801a95:	48 b8 24 10 80 00 00 	movabs $0x801024,%rax
+  801a9c:	00 00 00 
+  801a9f:	ff d0                	call   *%rax
+  801aa1:	e9 c2 00 00 00       	jmp    801b68 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801aa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aaa:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801aae:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801aba:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801abe:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ac2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801ac5:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801acc:	74 36                	je     801b04 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801ace:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ad1:	f7 d0                	not    %eax
+  801ad3:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ad7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ada:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801add:	48 63 d0             	movslq %eax,%rdx
+  801ae0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae4:	48 01 d0             	add    %rdx,%rax
+  801ae7:	0f b6 00             	movzbl (%rax),%eax
+  801aea:	0f b6 c0             	movzbl %al,%eax
+  801aed:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801af0:	48 63 ca             	movslq %edx,%rcx
+  801af3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801af7:	48 01 ca             	add    %rcx,%rdx
+  801afa:	0f b6 12             	movzbl (%rdx),%edx
+  801afd:	0f b6 d2             	movzbl %dl,%edx
+  801b00:	29 d0                	sub    %edx,%eax
+  801b02:	eb 64                	jmp    801b68 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801b04:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801b09:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801b0e:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801b13:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801b18:	77 8c                	ja     801aa6 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801b1a:	eb 36                	jmp    801b52 <memcmp+0x115>
+    if (*s1 != *s2)
+  801b1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b20:	0f b6 10             	movzbl (%rax),%edx
+  801b23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b27:	0f b6 00             	movzbl (%rax),%eax
+  801b2a:	38 c2                	cmp    %al,%dl
+  801b2c:	74 1a                	je     801b48 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801b2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b32:	0f b6 00             	movzbl (%rax),%eax
+  801b35:	0f b6 c8             	movzbl %al,%ecx
+  801b38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b3c:	0f b6 00             	movzbl (%rax),%eax
+  801b3f:	0f b6 d0             	movzbl %al,%edx
+  801b42:	89 c8                	mov    %ecx,%eax
+  801b44:	29 d0                	sub    %edx,%eax
+  801b46:	eb 20                	jmp    801b68 <memcmp+0x12b>
+    s1++, s2++;
+  801b48:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b4d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801b52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b56:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b5a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b5e:	48 85 c0             	test   %rax,%rax
+  801b61:	75 b9                	jne    801b1c <memcmp+0xdf>
+  }
+
+  return 0;
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b68:	c9                   	leave
+  801b69:	c3                   	ret
+
+0000000000801b6a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801b6a:	55                   	push   %rbp
+  801b6b:	48 89 e5             	mov    %rsp,%rbp
+  801b6e:	48 83 ec 50          	sub    $0x50,%rsp
+  801b72:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b76:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801b79:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801b7d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b81:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b85:	48 01 d0             	add    %rdx,%rax
+  801b88:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801b8c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b8f:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b93:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b97:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b9b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801ba0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ba4:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ba9:	76 73                	jbe    801c1e <memfind+0xb4>
+  801bab:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  801bb2:	00 00 00 
+  801bb5:	ff d0                	call   *%rax
+  801bb7:	83 e0 02             	and    $0x2,%eax
+  801bba:	85 c0                	test   %eax,%eax
+  801bbc:	74 60                	je     801c1e <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801bbe:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801bc1:	0f b6 c8             	movzbl %al,%ecx
+  801bc4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801bc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bcc:	89 ce                	mov    %ecx,%esi
+  801bce:	48 89 c7             	mov    %rax,%rdi
+  801bd1:	48 b8 13 11 80 00 00 	movabs $0x801113,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	eb 6c                	jmp    801c4b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801bdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be3:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801be7:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801beb:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801bf0:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bf4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bf8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bfb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801bff:	74 13                	je     801c14 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801c01:	31 c0                	xor    %eax,%eax
+  801c03:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801c08:	48 63 d0             	movslq %eax,%rdx
+  801c0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c0f:	48 01 d0             	add    %rdx,%rax
+  801c12:	eb 37                	jmp    801c4b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801c14:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801c19:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801c1e:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801c23:	77 ba                	ja     801bdf <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801c25:	eb 13                	jmp    801c3a <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801c27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2b:	0f b6 00             	movzbl (%rax),%eax
+  801c2e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801c31:	38 d0                	cmp    %dl,%al
+  801c33:	74 11                	je     801c46 <memfind+0xdc>
+  for (; s < ends; s++)
+  801c35:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c3e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c42:	72 e3                	jb     801c27 <memfind+0xbd>
+  801c44:	eb 01                	jmp    801c47 <memfind+0xdd>
+      break;
+  801c46:	90                   	nop
+  return (void *)s;
+  801c47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c4b:	c9                   	leave
+  801c4c:	c3                   	ret
+
+0000000000801c4d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801c4d:	55                   	push   %rbp
+  801c4e:	48 89 e5             	mov    %rsp,%rbp
+  801c51:	48 83 ec 38          	sub    $0x38,%rsp
+  801c55:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c59:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c5d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801c60:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801c67:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c6e:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801c6f:	eb 05                	jmp    801c76 <strtol+0x29>
+    s++;
+  801c71:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801c76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7a:	0f b6 00             	movzbl (%rax),%eax
+  801c7d:	3c 20                	cmp    $0x20,%al
+  801c7f:	74 f0                	je     801c71 <strtol+0x24>
+  801c81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c85:	0f b6 00             	movzbl (%rax),%eax
+  801c88:	3c 09                	cmp    $0x9,%al
+  801c8a:	74 e5                	je     801c71 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801c8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c90:	0f b6 00             	movzbl (%rax),%eax
+  801c93:	3c 2b                	cmp    $0x2b,%al
+  801c95:	75 07                	jne    801c9e <strtol+0x51>
+    s++;
+  801c97:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c9c:	eb 17                	jmp    801cb5 <strtol+0x68>
+  else if (*s == '-')
+  801c9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca2:	0f b6 00             	movzbl (%rax),%eax
+  801ca5:	3c 2d                	cmp    $0x2d,%al
+  801ca7:	75 0c                	jne    801cb5 <strtol+0x68>
+    s++, neg = 1;
+  801ca9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cae:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801cb5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cb9:	74 06                	je     801cc1 <strtol+0x74>
+  801cbb:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801cbf:	75 28                	jne    801ce9 <strtol+0x9c>
+  801cc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc5:	0f b6 00             	movzbl (%rax),%eax
+  801cc8:	3c 30                	cmp    $0x30,%al
+  801cca:	75 1d                	jne    801ce9 <strtol+0x9c>
+  801ccc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd0:	48 83 c0 01          	add    $0x1,%rax
+  801cd4:	0f b6 00             	movzbl (%rax),%eax
+  801cd7:	3c 78                	cmp    $0x78,%al
+  801cd9:	75 0e                	jne    801ce9 <strtol+0x9c>
+    s += 2, base = 16;
+  801cdb:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801ce0:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ce7:	eb 2c                	jmp    801d15 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801ce9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ced:	75 19                	jne    801d08 <strtol+0xbb>
+  801cef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf3:	0f b6 00             	movzbl (%rax),%eax
+  801cf6:	3c 30                	cmp    $0x30,%al
+  801cf8:	75 0e                	jne    801d08 <strtol+0xbb>
+    s++, base = 8;
+  801cfa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cff:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d06:	eb 0d                	jmp    801d15 <strtol+0xc8>
+  else if (base == 0)
+  801d08:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d0c:	75 07                	jne    801d15 <strtol+0xc8>
+    base = 10;
+  801d0e:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801d15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d19:	0f b6 00             	movzbl (%rax),%eax
+  801d1c:	3c 2f                	cmp    $0x2f,%al
+  801d1e:	7e 1d                	jle    801d3d <strtol+0xf0>
+  801d20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d24:	0f b6 00             	movzbl (%rax),%eax
+  801d27:	3c 39                	cmp    $0x39,%al
+  801d29:	7f 12                	jg     801d3d <strtol+0xf0>
+      dig = *s - '0';
+  801d2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2f:	0f b6 00             	movzbl (%rax),%eax
+  801d32:	0f be c0             	movsbl %al,%eax
+  801d35:	83 e8 30             	sub    $0x30,%eax
+  801d38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d3b:	eb 4e                	jmp    801d8b <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d41:	0f b6 00             	movzbl (%rax),%eax
+  801d44:	3c 60                	cmp    $0x60,%al
+  801d46:	7e 1d                	jle    801d65 <strtol+0x118>
+  801d48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4c:	0f b6 00             	movzbl (%rax),%eax
+  801d4f:	3c 7a                	cmp    $0x7a,%al
+  801d51:	7f 12                	jg     801d65 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801d53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d57:	0f b6 00             	movzbl (%rax),%eax
+  801d5a:	0f be c0             	movsbl %al,%eax
+  801d5d:	83 e8 57             	sub    $0x57,%eax
+  801d60:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d63:	eb 26                	jmp    801d8b <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801d65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d69:	0f b6 00             	movzbl (%rax),%eax
+  801d6c:	3c 40                	cmp    $0x40,%al
+  801d6e:	7e 47                	jle    801db7 <strtol+0x16a>
+  801d70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d74:	0f b6 00             	movzbl (%rax),%eax
+  801d77:	3c 5a                	cmp    $0x5a,%al
+  801d79:	7f 3c                	jg     801db7 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801d7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7f:	0f b6 00             	movzbl (%rax),%eax
+  801d82:	0f be c0             	movsbl %al,%eax
+  801d85:	83 e8 37             	sub    $0x37,%eax
+  801d88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801d8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d8e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d91:	7d 23                	jge    801db6 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d93:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d98:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d9b:	48 98                	cltq
+  801d9d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801da2:	48 89 c2             	mov    %rax,%rdx
+  801da5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801da8:	48 98                	cltq
+  801daa:	48 01 d0             	add    %rdx,%rax
+  801dad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801db1:	e9 5f ff ff ff       	jmp    801d15 <strtol+0xc8>
+      break;
+  801db6:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801db7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dbc:	74 0b                	je     801dc9 <strtol+0x17c>
+    *endptr = (char *)s;
+  801dbe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801dc6:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801dc9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dcd:	74 09                	je     801dd8 <strtol+0x18b>
+  801dcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dd3:	48 f7 d8             	neg    %rax
+  801dd6:	eb 04                	jmp    801ddc <strtol+0x18f>
+  801dd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ddc:	c9                   	leave
+  801ddd:	c3                   	ret
+
+0000000000801dde <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801dde:	55                   	push   %rbp
+  801ddf:	48 89 e5             	mov    %rsp,%rbp
+  801de2:	53                   	push   %rbx
+  801de3:	48 83 ec 48          	sub    $0x48,%rsp
+  801de7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801deb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801def:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801df3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801df7:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801dfb:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801dff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e03:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e07:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e0b:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801e0f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e13:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e17:	4c 89 c3             	mov    %r8,%rbx
+  801e1a:	cd 30                	int    $0x30
+  801e1c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801e20:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e25:	74 46                	je     801e6d <syscall+0x8f>
+  801e27:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e2c:	7e 3f                	jle    801e6d <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801e2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e36:	49 89 d0             	mov    %rdx,%r8
+  801e39:	48 89 c1             	mov    %rax,%rcx
+  801e3c:	48 b8 88 69 80 00 00 	movabs $0x806988,%rax
+  801e43:	00 00 00 
+  801e46:	48 89 c2             	mov    %rax,%rdx
+  801e49:	be 22 00 00 00       	mov    $0x22,%esi
+  801e4e:	48 b8 a7 69 80 00 00 	movabs $0x8069a7,%rax
+  801e55:	00 00 00 
+  801e58:	48 89 c7             	mov    %rax,%rdi
+  801e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e60:	49 b9 3d 58 80 00 00 	movabs $0x80583d,%r9
+  801e67:	00 00 00 
+  801e6a:	41 ff d1             	call   *%r9
+
+  return ret;
+  801e6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e71:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e75:	c9                   	leave
+  801e76:	c3                   	ret
+
+0000000000801e77 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e87:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e93:	6a 00                	push   $0x0
+  801e95:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e9b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ea1:	48 89 d1             	mov    %rdx,%rcx
+  801ea4:	48 89 c2             	mov    %rax,%rdx
+  801ea7:	be 00 00 00 00       	mov    $0x0,%esi
+  801eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eb1:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801eb8:	00 00 00 
+  801ebb:	ff d0                	call   *%rax
+  801ebd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec1:	90                   	nop
+  801ec2:	c9                   	leave
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ec8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ecc:	6a 00                	push   $0x0
+  801ece:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ed4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee9:	bf 01 00 00 00       	mov    $0x1,%edi
+  801eee:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+  801efa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801efe:	c9                   	leave
+  801eff:	c3                   	ret
+
+0000000000801f00 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801f00:	55                   	push   %rbp
+  801f01:	48 89 e5             	mov    %rsp,%rbp
+  801f04:	48 83 ec 10          	sub    $0x10,%rsp
+  801f08:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f0e:	48 98                	cltq
+  801f10:	48 83 ec 08          	sub    $0x8,%rsp
+  801f14:	6a 00                	push   $0x0
+  801f16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f27:	48 89 c2             	mov    %rax,%rdx
+  801f2a:	be 01 00 00 00       	mov    $0x1,%esi
+  801f2f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f34:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801f51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f54:	48 98                	cltq
+  801f56:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f6d:	48 89 c2             	mov    %rax,%rdx
+  801f70:	be 00 00 00 00       	mov    $0x0,%esi
+  801f75:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f7a:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8a:	90                   	nop
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+
+0000000000801f8d <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801f8d:	55                   	push   %rbp
+  801f8e:	48 89 e5             	mov    %rsp,%rbp
+  801f91:	48 83 ec 20          	sub    $0x20,%rsp
+  801f95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f98:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f9f:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801fa2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fa7:	cd 30                	int    $0x30
+  801fa9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801fad:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801fb1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fb6:	7e 3d                	jle    801ff5 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801fb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fbc:	49 89 c0             	mov    %rax,%r8
+  801fbf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801fc4:	48 b8 88 69 80 00 00 	movabs $0x806988,%rax
+  801fcb:	00 00 00 
+  801fce:	48 89 c2             	mov    %rax,%rdx
+  801fd1:	be 49 00 00 00       	mov    $0x49,%esi
+  801fd6:	48 b8 a7 69 80 00 00 	movabs $0x8069a7,%rax
+  801fdd:	00 00 00 
+  801fe0:	48 89 c7             	mov    %rax,%rdi
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	49 b9 3d 58 80 00 00 	movabs $0x80583d,%r9
+  801fef:	00 00 00 
+  801ff2:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801ff5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801ffa:	75 13                	jne    80200f <sys_env_wait+0x82>
+  801ffc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802001:	74 0c                	je     80200f <sys_env_wait+0x82>
+    *status = st;
+  802003:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802007:	89 c2                	mov    %eax,%edx
+  802009:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80200d:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80200f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802013:	c9                   	leave
+  802014:	c3                   	ret
+
+0000000000802015 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802015:	55                   	push   %rbp
+  802016:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802019:	48 83 ec 08          	sub    $0x8,%rsp
+  80201d:	6a 00                	push   $0x0
+  80201f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802025:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80202b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802030:	ba 00 00 00 00       	mov    $0x0,%edx
+  802035:	be 00 00 00 00       	mov    $0x0,%esi
+  80203a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80203f:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+  80204b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+0000000000802051 <sys_yield>:
+
+void
+sys_yield(void) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802055:	48 83 ec 08          	sub    $0x8,%rsp
+  802059:	6a 00                	push   $0x0
+  80205b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802061:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802067:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802071:	be 00 00 00 00       	mov    $0x0,%esi
+  802076:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80207b:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802082:	00 00 00 
+  802085:	ff d0                	call   *%rax
+  802087:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80208b:	90                   	nop
+  80208c:	c9                   	leave
+  80208d:	c3                   	ret
+
+000000000080208e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80208e:	55                   	push   %rbp
+  80208f:	48 89 e5             	mov    %rsp,%rbp
+  802092:	48 83 ec 20          	sub    $0x20,%rsp
+  802096:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802099:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80209d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8020a0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8020a3:	48 63 c8             	movslq %eax,%rcx
+  8020a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020ad:	48 98                	cltq
+  8020af:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b3:	6a 00                	push   $0x0
+  8020b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020bb:	49 89 c8             	mov    %rcx,%r8
+  8020be:	48 89 d1             	mov    %rdx,%rcx
+  8020c1:	48 89 c2             	mov    %rax,%rdx
+  8020c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020ce:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	48 83 c4 10          	add    $0x10,%rsp
+  8020de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8020e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+
+00000000008020e6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8020ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020f5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020fc:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802100:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802103:	48 63 c8             	movslq %eax,%rcx
+  802106:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80210a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80210d:	48 63 f0             	movslq %eax,%rsi
+  802110:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802114:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802117:	48 98                	cltq
+  802119:	48 83 ec 08          	sub    $0x8,%rsp
+  80211d:	51                   	push   %rcx
+  80211e:	49 89 f9             	mov    %rdi,%r9
+  802121:	49 89 f0             	mov    %rsi,%r8
+  802124:	48 89 d1             	mov    %rdx,%rcx
+  802127:	48 89 c2             	mov    %rax,%rdx
+  80212a:	be 01 00 00 00       	mov    $0x1,%esi
+  80212f:	bf 07 00 00 00       	mov    $0x7,%edi
+  802134:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+  802140:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802144:	c9                   	leave
+  802145:	c3                   	ret
+
+0000000000802146 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802146:	55                   	push   %rbp
+  802147:	48 89 e5             	mov    %rsp,%rbp
+  80214a:	48 83 ec 10          	sub    $0x10,%rsp
+  80214e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802151:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802155:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80215c:	48 98                	cltq
+  80215e:	48 83 ec 08          	sub    $0x8,%rsp
+  802162:	6a 00                	push   $0x0
+  802164:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802170:	48 89 d1             	mov    %rdx,%rcx
+  802173:	48 89 c2             	mov    %rax,%rdx
+  802176:	be 01 00 00 00       	mov    $0x1,%esi
+  80217b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802180:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802190:	c9                   	leave
+  802191:	c3                   	ret
+
+0000000000802192 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	48 83 ec 10          	sub    $0x10,%rsp
+  80219a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80219d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8021a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021a3:	48 63 d0             	movslq %eax,%rdx
+  8021a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021a9:	48 98                	cltq
+  8021ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8021af:	6a 00                	push   $0x0
+  8021b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021bd:	48 89 d1             	mov    %rdx,%rcx
+  8021c0:	48 89 c2             	mov    %rax,%rdx
+  8021c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8021c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021cd:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+  8021d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021dd:	c9                   	leave
+  8021de:	c3                   	ret
+
+00000000008021df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8021df:	55                   	push   %rbp
+  8021e0:	48 89 e5             	mov    %rsp,%rbp
+  8021e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8021ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021f5:	48 98                	cltq
+  8021f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fb:	6a 00                	push   $0x0
+  8021fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802203:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802209:	48 89 d1             	mov    %rdx,%rcx
+  80220c:	48 89 c2             	mov    %rax,%rdx
+  80220f:	be 01 00 00 00       	mov    $0x1,%esi
+  802214:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802219:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802220:	00 00 00 
+  802223:	ff d0                	call   *%rax
+  802225:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802229:	c9                   	leave
+  80222a:	c3                   	ret
+
+000000000080222b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	48 83 ec 10          	sub    $0x10,%rsp
+  802233:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802236:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80223a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80223e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802241:	48 98                	cltq
+  802243:	48 83 ec 08          	sub    $0x8,%rsp
+  802247:	6a 00                	push   $0x0
+  802249:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802255:	48 89 d1             	mov    %rdx,%rcx
+  802258:	48 89 c2             	mov    %rax,%rdx
+  80225b:	be 01 00 00 00       	mov    $0x1,%esi
+  802260:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802265:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+  802271:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+0000000000802277 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802277:	55                   	push   %rbp
+  802278:	48 89 e5             	mov    %rsp,%rbp
+  80227b:	48 83 ec 20          	sub    $0x20,%rsp
+  80227f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802282:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802286:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80228a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80228d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802290:	48 63 f0             	movslq %eax,%rsi
+  802293:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802297:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80229b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80229e:	48 98                	cltq
+  8022a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a4:	6a 00                	push   $0x0
+  8022a6:	49 89 f1             	mov    %rsi,%r9
+  8022a9:	49 89 c8             	mov    %rcx,%r8
+  8022ac:	48 89 d1             	mov    %rdx,%rcx
+  8022af:	48 89 c2             	mov    %rax,%rdx
+  8022b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b7:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8022bc:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+  8022c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+
+00000000008022ce <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8022da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022de:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e2:	6a 00                	push   $0x0
+  8022e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f5:	48 89 c2             	mov    %rax,%rdx
+  8022f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022fd:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802302:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802309:	00 00 00 
+  80230c:	ff d0                	call   *%rax
+  80230e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802312:	c9                   	leave
+  802313:	c3                   	ret
+
+0000000000802314 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802314:	55                   	push   %rbp
+  802315:	48 89 e5             	mov    %rsp,%rbp
+  802318:	48 83 ec 10          	sub    $0x10,%rsp
+  80231c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802320:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802324:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802328:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80232c:	48 83 ec 08          	sub    $0x8,%rsp
+  802330:	6a 00                	push   $0x0
+  802332:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802338:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80233e:	48 89 d1             	mov    %rdx,%rcx
+  802341:	48 89 c2             	mov    %rax,%rdx
+  802344:	be 01 00 00 00       	mov    $0x1,%esi
+  802349:	bf 10 00 00 00       	mov    $0x10,%edi
+  80234e:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802355:	00 00 00 
+  802358:	ff d0                	call   *%rax
+  80235a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80235e:	c9                   	leave
+  80235f:	c3                   	ret
+
+0000000000802360 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802360:	55                   	push   %rbp
+  802361:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802364:	48 83 ec 08          	sub    $0x8,%rsp
+  802368:	6a 00                	push   $0x0
+  80236a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802376:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80237b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802380:	be 00 00 00 00       	mov    $0x0,%esi
+  802385:	bf 11 00 00 00       	mov    $0x11,%edi
+  80238a:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+  802396:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+000000000080239c <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8023ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b8:	6a 00                	push   $0x0
+  8023ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c6:	48 89 d1             	mov    %rdx,%rcx
+  8023c9:	48 89 c2             	mov    %rax,%rdx
+  8023cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d1:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023d6:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8023dd:	00 00 00 
+  8023e0:	ff d0                	call   *%rax
+  8023e2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e6:	c9                   	leave
+  8023e7:	c3                   	ret
+
+00000000008023e8 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8023e8:	55                   	push   %rbp
+  8023e9:	48 89 e5             	mov    %rsp,%rbp
+  8023ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8023f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023f8:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8023fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023fe:	48 63 c8             	movslq %eax,%rcx
+  802401:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802405:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802409:	48 83 ec 08          	sub    $0x8,%rsp
+  80240d:	6a 00                	push   $0x0
+  80240f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802415:	49 89 c8             	mov    %rcx,%r8
+  802418:	48 89 d1             	mov    %rdx,%rcx
+  80241b:	48 89 c2             	mov    %rax,%rdx
+  80241e:	be 00 00 00 00       	mov    $0x0,%esi
+  802423:	bf 13 00 00 00       	mov    $0x13,%edi
+  802428:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80242f:	00 00 00 
+  802432:	ff d0                	call   *%rax
+  802434:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+
+000000000080243a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80243a:	55                   	push   %rbp
+  80243b:	48 89 e5             	mov    %rsp,%rbp
+  80243e:	48 83 ec 20          	sub    $0x20,%rsp
+  802442:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802446:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802449:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80244d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802451:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802458:	48 83 ec 08          	sub    $0x8,%rsp
+  80245c:	6a 00                	push   $0x0
+  80245e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802464:	49 89 c8             	mov    %rcx,%r8
+  802467:	48 89 d1             	mov    %rdx,%rcx
+  80246a:	48 89 c2             	mov    %rax,%rdx
+  80246d:	be 00 00 00 00       	mov    $0x0,%esi
+  802472:	bf 14 00 00 00       	mov    $0x14,%edi
+  802477:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+  802483:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802487:	c9                   	leave
+  802488:	c3                   	ret
+
+0000000000802489 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802489:	55                   	push   %rbp
+  80248a:	48 89 e5             	mov    %rsp,%rbp
+  80248d:	48 83 ec 10          	sub    $0x10,%rsp
+  802491:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802495:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802498:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80249b:	48 63 d0             	movslq %eax,%rdx
+  80249e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a6:	6a 00                	push   $0x0
+  8024a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b4:	48 89 d1             	mov    %rdx,%rcx
+  8024b7:	48 89 c2             	mov    %rax,%rdx
+  8024ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8024bf:	bf 15 00 00 00       	mov    $0x15,%edi
+  8024c4:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8024cb:	00 00 00 
+  8024ce:	ff d0                	call   *%rax
+  8024d0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+
+00000000008024d6 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8024d6:	55                   	push   %rbp
+  8024d7:	48 89 e5             	mov    %rsp,%rbp
+  8024da:	48 83 ec 20          	sub    $0x20,%rsp
+  8024de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024e2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024e5:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8024e8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8024ec:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024f0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8024f3:	48 63 c8             	movslq %eax,%rcx
+  8024f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024f9:	48 63 d0             	movslq %eax,%rdx
+  8024fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802500:	48 83 ec 08          	sub    $0x8,%rsp
+  802504:	6a 00                	push   $0x0
+  802506:	49 89 f1             	mov    %rsi,%r9
+  802509:	49 89 c8             	mov    %rcx,%r8
+  80250c:	48 89 d1             	mov    %rdx,%rcx
+  80250f:	48 89 c2             	mov    %rax,%rdx
+  802512:	be 00 00 00 00       	mov    $0x0,%esi
+  802517:	bf 16 00 00 00       	mov    $0x16,%edi
+  80251c:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802523:	00 00 00 
+  802526:	ff d0                	call   *%rax
+  802528:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80252c:	c9                   	leave
+  80252d:	c3                   	ret
+
+000000000080252e <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80252e:	55                   	push   %rbp
+  80252f:	48 89 e5             	mov    %rsp,%rbp
+  802532:	48 83 ec 30          	sub    $0x30,%rsp
+  802536:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80253a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80253e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802542:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802546:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80254a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80254e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802552:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802556:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80255a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255e:	48 83 ec 08          	sub    $0x8,%rsp
+  802562:	51                   	push   %rcx
+  802563:	49 89 f9             	mov    %rdi,%r9
+  802566:	49 89 f0             	mov    %rsi,%r8
+  802569:	48 89 d1             	mov    %rdx,%rcx
+  80256c:	48 89 c2             	mov    %rax,%rdx
+  80256f:	be 00 00 00 00       	mov    $0x0,%esi
+  802574:	bf 17 00 00 00       	mov    $0x17,%edi
+  802579:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802580:	00 00 00 
+  802583:	ff d0                	call   *%rax
+  802585:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802589:	c9                   	leave
+  80258a:	c3                   	ret
+
+000000000080258b <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80258b:	55                   	push   %rbp
+  80258c:	48 89 e5             	mov    %rsp,%rbp
+  80258f:	48 83 ec 10          	sub    $0x10,%rsp
+  802593:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802596:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802599:	48 98                	cltq
+  80259b:	48 83 ec 08          	sub    $0x8,%rsp
+  80259f:	6a 00                	push   $0x0
+  8025a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b2:	48 89 c2             	mov    %rax,%rdx
+  8025b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ba:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025bf:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8025c6:	00 00 00 
+  8025c9:	ff d0                	call   *%rax
+  8025cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025cf:	90                   	nop
+  8025d0:	c9                   	leave
+  8025d1:	c3                   	ret
+
+00000000008025d2 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8025d2:	55                   	push   %rbp
+  8025d3:	48 89 e5             	mov    %rsp,%rbp
+  8025d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8025da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025e5:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8025e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025eb:	48 63 f0             	movslq %eax,%rsi
+  8025ee:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025f9:	48 98                	cltq
+  8025fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ff:	6a 00                	push   $0x0
+  802601:	49 89 f1             	mov    %rsi,%r9
+  802604:	49 89 c8             	mov    %rcx,%r8
+  802607:	48 89 d1             	mov    %rdx,%rcx
+  80260a:	48 89 c2             	mov    %rax,%rdx
+  80260d:	be 01 00 00 00       	mov    $0x1,%esi
+  802612:	bf 19 00 00 00       	mov    $0x19,%edi
+  802617:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80261e:	00 00 00 
+  802621:	ff d0                	call   *%rax
+  802623:	48 83 c4 10          	add    $0x10,%rsp
+  802627:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80262a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80262d:	c9                   	leave
+  80262e:	c3                   	ret
+
+000000000080262f <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80262f:	55                   	push   %rbp
+  802630:	48 89 e5             	mov    %rsp,%rbp
+  802633:	48 83 ec 20          	sub    $0x20,%rsp
+  802637:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80263b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80263f:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802642:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802645:	48 63 c8             	movslq %eax,%rcx
+  802648:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80264c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802650:	48 83 ec 08          	sub    $0x8,%rsp
+  802654:	6a 00                	push   $0x0
+  802656:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265c:	49 89 c8             	mov    %rcx,%r8
+  80265f:	48 89 d1             	mov    %rdx,%rcx
+  802662:	48 89 c2             	mov    %rax,%rdx
+  802665:	be 01 00 00 00       	mov    $0x1,%esi
+  80266a:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80266f:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+  80267b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+
+0000000000802681 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  802685:	48 83 ec 20          	sub    $0x20,%rsp
+  802689:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80268d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802691:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802695:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802699:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80269d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ad:	49 89 c8             	mov    %rcx,%r8
+  8026b0:	48 89 d1             	mov    %rdx,%rcx
+  8026b3:	48 89 c2             	mov    %rax,%rdx
+  8026b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8026bb:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8026c0:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+00000000008026d2 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8026da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8026de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026e2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8026e5:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8026e9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026f0:	48 63 c8             	movslq %eax,%rcx
+  8026f3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ff:	6a 00                	push   $0x0
+  802701:	49 89 f1             	mov    %rsi,%r9
+  802704:	49 89 c8             	mov    %rcx,%r8
+  802707:	48 89 d1             	mov    %rdx,%rcx
+  80270a:	48 89 c2             	mov    %rax,%rdx
+  80270d:	be 01 00 00 00       	mov    $0x1,%esi
+  802712:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802717:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80271e:	00 00 00 
+  802721:	ff d0                	call   *%rax
+  802723:	48 83 c4 10          	add    $0x10,%rsp
+  802727:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80272a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+
+000000000080272f <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80272f:	55                   	push   %rbp
+  802730:	48 89 e5             	mov    %rsp,%rbp
+  802733:	48 83 ec 10          	sub    $0x10,%rsp
+  802737:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80273a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80273d:	48 98                	cltq
+  80273f:	48 83 ec 08          	sub    $0x8,%rsp
+  802743:	6a 00                	push   $0x0
+  802745:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802751:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802756:	48 89 c2             	mov    %rax,%rdx
+  802759:	be 01 00 00 00       	mov    $0x1,%esi
+  80275e:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802763:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+  80276f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802773:	c9                   	leave
+  802774:	c3                   	ret
+
+0000000000802775 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802775:	55                   	push   %rbp
+  802776:	48 89 e5             	mov    %rsp,%rbp
+  802779:	48 83 ec 40          	sub    $0x40,%rsp
+  80277d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802781:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802785:	48 8b 00             	mov    (%rax),%rax
+  802788:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  80278c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802790:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802794:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802798:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80279c:	83 e0 02             	and    $0x2,%eax
+  80279f:	48 85 c0             	test   %rax,%rax
+  8027a2:	74 25                	je     8027c9 <pgfault+0x54>
+  8027a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027ac:	48 89 c2             	mov    %rax,%rdx
+  8027af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027b6:	01 00 00 
+  8027b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027bd:	83 e0 02             	and    $0x2,%eax
+  8027c0:	48 85 c0             	test   %rax,%rax
+  8027c3:	0f 85 fe 01 00 00    	jne    8029c7 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8027c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027cd:	83 e0 02             	and    $0x2,%eax
+  8027d0:	48 85 c0             	test   %rax,%rax
+  8027d3:	74 23                	je     8027f8 <pgfault+0x83>
+  8027d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027d9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027dd:	48 89 c2             	mov    %rax,%rdx
+  8027e0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027e7:	01 00 00 
+  8027ea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027ee:	25 00 08 00 00       	and    $0x800,%eax
+  8027f3:	48 85 c0             	test   %rax,%rax
+  8027f6:	75 3f                	jne    802837 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8027f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802800:	49 89 d0             	mov    %rdx,%r8
+  802803:	48 89 c1             	mov    %rax,%rcx
+  802806:	48 b8 b8 69 80 00 00 	movabs $0x8069b8,%rax
+  80280d:	00 00 00 
+  802810:	48 89 c2             	mov    %rax,%rdx
+  802813:	be 26 00 00 00       	mov    $0x26,%esi
+  802818:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  80281f:	00 00 00 
+  802822:	48 89 c7             	mov    %rax,%rdi
+  802825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282a:	49 b9 3d 58 80 00 00 	movabs $0x80583d,%r9
+  802831:	00 00 00 
+  802834:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802837:	48 b8 8b 53 80 00 00 	movabs $0x80538b,%rax
+  80283e:	00 00 00 
+  802841:	ff d0                	call   *%rax
+  802843:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284b:	ba 07 00 00 00       	mov    $0x7,%edx
+  802850:	48 89 c6             	mov    %rax,%rsi
+  802853:	bf 00 00 00 00       	mov    $0x0,%edi
+  802858:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  80285f:	00 00 00 
+  802862:	ff d0                	call   *%rax
+  802864:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802867:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80286b:	79 36                	jns    8028a3 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  80286d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802870:	89 c1                	mov    %eax,%ecx
+  802872:	48 b8 f8 69 80 00 00 	movabs $0x8069f8,%rax
+  802879:	00 00 00 
+  80287c:	48 89 c2             	mov    %rax,%rdx
+  80287f:	be 35 00 00 00       	mov    $0x35,%esi
+  802884:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  80288b:	00 00 00 
+  80288e:	48 89 c7             	mov    %rax,%rdi
+  802891:	b8 00 00 00 00       	mov    $0x0,%eax
+  802896:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  80289d:	00 00 00 
+  8028a0:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8028a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8028ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028af:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8028b5:	48 89 c1             	mov    %rax,%rcx
+  8028b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028c1:	48 89 ce             	mov    %rcx,%rsi
+  8028c4:	48 89 c7             	mov    %rax,%rdi
+  8028c7:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  8028ce:	00 00 00 
+  8028d1:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8028d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028db:	48 89 c2             	mov    %rax,%rdx
+  8028de:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028e5:	01 00 00 
+  8028e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028ec:	25 00 08 00 00       	and    $0x800,%eax
+  8028f1:	48 85 c0             	test   %rax,%rax
+  8028f4:	74 7a                	je     802970 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8028f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028fa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8028fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802902:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802908:	48 89 c2             	mov    %rax,%rdx
+  80290b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80290f:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802915:	48 89 d1             	mov    %rdx,%rcx
+  802918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80291d:	48 89 c6             	mov    %rax,%rsi
+  802920:	bf 00 00 00 00       	mov    $0x0,%edi
+  802925:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  80292c:	00 00 00 
+  80292f:	ff d0                	call   *%rax
+  802931:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802934:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802938:	79 36                	jns    802970 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  80293a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80293d:	89 c1                	mov    %eax,%ecx
+  80293f:	48 b8 20 6a 80 00 00 	movabs $0x806a20,%rax
+  802946:	00 00 00 
+  802949:	48 89 c2             	mov    %rax,%rdx
+  80294c:	be 42 00 00 00       	mov    $0x42,%esi
+  802951:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802958:	00 00 00 
+  80295b:	48 89 c7             	mov    %rax,%rdi
+  80295e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802963:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  80296a:	00 00 00 
+  80296d:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802970:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802974:	48 89 c6             	mov    %rax,%rsi
+  802977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297c:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80298b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80298f:	79 37                	jns    8029c8 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802991:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802994:	89 c1                	mov    %eax,%ecx
+  802996:	48 b8 48 6a 80 00 00 	movabs $0x806a48,%rax
+  80299d:	00 00 00 
+  8029a0:	48 89 c2             	mov    %rax,%rdx
+  8029a3:	be 46 00 00 00       	mov    $0x46,%esi
+  8029a8:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  8029af:	00 00 00 
+  8029b2:	48 89 c7             	mov    %rax,%rdi
+  8029b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ba:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  8029c1:	00 00 00 
+  8029c4:	41 ff d0             	call   *%r8
+    return;
+  8029c7:	90                   	nop
+  }
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+00000000008029ca <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  8029ca:	55                   	push   %rbp
+  8029cb:	48 89 e5             	mov    %rsp,%rbp
+  8029ce:	48 83 ec 30          	sub    $0x30,%rsp
+  8029d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8029d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  8029d9:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8029e0:	01 00 00 
+  8029e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029eb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8029f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  8029f4:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802a03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a07:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a0b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802a0f:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802a16:	01 00 00 
+  802a19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a1d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a21:	25 00 04 00 00       	and    $0x400,%eax
+  802a26:	48 85 c0             	test   %rax,%rax
+  802a29:	74 7b                	je     802aa6 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802a2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a2f:	89 c1                	mov    %eax,%ecx
+  802a31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a35:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a39:	48 89 c2             	mov    %rax,%rdx
+  802a3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a40:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a44:	48 89 c6             	mov    %rax,%rsi
+  802a47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a4a:	41 89 c8             	mov    %ecx,%r8d
+  802a4d:	48 89 d1             	mov    %rdx,%rcx
+  802a50:	89 c2                	mov    %eax,%edx
+  802a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a57:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+  802a63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a6a:	0f 89 da 00 00 00    	jns    802b4a <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802a70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a73:	89 c1                	mov    %eax,%ecx
+  802a75:	48 b8 70 6a 80 00 00 	movabs $0x806a70,%rax
+  802a7c:	00 00 00 
+  802a7f:	48 89 c2             	mov    %rax,%rdx
+  802a82:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802a87:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802a8e:	00 00 00 
+  802a91:	48 89 c7             	mov    %rax,%rdi
+  802a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a99:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  802aa0:	00 00 00 
+  802aa3:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802aa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aaa:	25 02 08 00 00       	and    $0x802,%eax
+  802aaf:	48 85 c0             	test   %rax,%rax
+  802ab2:	74 6e                	je     802b22 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802ab4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab8:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802abe:	80 cc 08             	or     $0x8,%ah
+  802ac1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802ac5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac9:	89 c7                	mov    %eax,%edi
+  802acb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802acf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ad2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ad6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ad9:	41 89 f8             	mov    %edi,%r8d
+  802adc:	89 c7                	mov    %eax,%edi
+  802ade:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802ae5:	00 00 00 
+  802ae8:	ff d0                	call   *%rax
+  802aea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802aed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802af1:	79 05                	jns    802af8 <duppage+0x12e>
+      return r;
+  802af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802af6:	eb 55                	jmp    802b4d <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802af8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802afc:	89 c7                	mov    %eax,%edi
+  802afe:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b02:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802b05:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802b09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b0c:	41 89 f8             	mov    %edi,%r8d
+  802b0f:	89 c7                	mov    %eax,%edi
+  802b11:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+  802b1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b20:	eb 28                	jmp    802b4a <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802b22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b26:	89 c7                	mov    %eax,%edi
+  802b28:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b2c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802b2f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802b33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b36:	41 89 f8             	mov    %edi,%r8d
+  802b39:	89 c7                	mov    %eax,%edi
+  802b3b:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802b42:	00 00 00 
+  802b45:	ff d0                	call   *%rax
+  802b47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802b4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b4d:	c9                   	leave
+  802b4e:	c3                   	ret
+
+0000000000802b4f <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802b4f:	55                   	push   %rbp
+  802b50:	48 89 e5             	mov    %rsp,%rbp
+  802b53:	48 83 ec 20          	sub    $0x20,%rsp
+  802b57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b5a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802b5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b62:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802b6a:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b71:	01 00 00 
+  802b74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b78:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b7c:	25 00 08 00 00       	and    $0x800,%eax
+  802b81:	48 85 c0             	test   %rax,%rax
+  802b84:	74 0d                	je     802b93 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b8a:	0f b6 10             	movzbl (%rax),%edx
+  802b8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b91:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802b93:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b9a:	01 00 00 
+  802b9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ba1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ba5:	25 07 0e 00 00       	and    $0xe07,%eax
+  802baa:	89 c6                	mov    %eax,%esi
+  802bac:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802bb0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802bb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb7:	41 89 f0             	mov    %esi,%r8d
+  802bba:	48 89 c6             	mov    %rax,%rsi
+  802bbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc2:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+0000000000802bd0 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802bd0:	55                   	push   %rbp
+  802bd1:	48 89 e5             	mov    %rsp,%rbp
+  802bd4:	48 83 ec 40          	sub    $0x40,%rsp
+  802bd8:	89 f8                	mov    %edi,%eax
+  802bda:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802bdd:	48 b8 75 27 80 00 00 	movabs $0x802775,%rax
+  802be4:	00 00 00 
+  802be7:	48 89 c7             	mov    %rax,%rdi
+  802bea:	48 b8 57 59 80 00 00 	movabs $0x805957,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802bf6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bfb:	cd 30                	int    $0x30
+  802bfd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802c00:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802c03:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c06:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c0a:	79 36                	jns    802c42 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802c0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c0f:	89 c1                	mov    %eax,%ecx
+  802c11:	48 b8 9b 6a 80 00 00 	movabs $0x806a9b,%rax
+  802c18:	00 00 00 
+  802c1b:	48 89 c2             	mov    %rax,%rdx
+  802c1e:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802c23:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802c2a:	00 00 00 
+  802c2d:	48 89 c7             	mov    %rax,%rdi
+  802c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c35:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  802c3c:	00 00 00 
+  802c3f:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802c42:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c46:	75 0a                	jne    802c52 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4d:	e9 d3 02 00 00       	jmp    802f25 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802c52:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c59:	00 
+  802c5a:	e9 7a 01 00 00       	jmp    802dd9 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802c5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c63:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c67:	48 c1 e8 27          	shr    $0x27,%rax
+  802c6b:	48 89 c2             	mov    %rax,%rdx
+  802c6e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c75:	01 00 00 
+  802c78:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c7c:	83 e0 01             	and    $0x1,%eax
+  802c7f:	48 85 c0             	test   %rax,%rax
+  802c82:	0f 84 4c 01 00 00    	je     802dd4 <fork_common+0x204>
+  802c88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c8c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c90:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c94:	48 89 c2             	mov    %rax,%rdx
+  802c97:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c9e:	01 00 00 
+  802ca1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ca5:	83 e0 01             	and    $0x1,%eax
+  802ca8:	48 85 c0             	test   %rax,%rax
+  802cab:	0f 84 23 01 00 00    	je     802dd4 <fork_common+0x204>
+  802cb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb5:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cb9:	48 c1 e8 15          	shr    $0x15,%rax
+  802cbd:	48 89 c2             	mov    %rax,%rdx
+  802cc0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802cc7:	01 00 00 
+  802cca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cce:	83 e0 01             	and    $0x1,%eax
+  802cd1:	48 85 c0             	test   %rax,%rax
+  802cd4:	0f 84 fa 00 00 00    	je     802dd4 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802cda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cde:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ce2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cea:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802cf1:	00 00 00 
+  802cf4:	48 39 c2             	cmp    %rax,%rdx
+  802cf7:	0f 82 d7 00 00 00    	jb     802dd4 <fork_common+0x204>
+  802cfd:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802d04:	00 00 00 
+  802d07:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802d0b:	0f 84 c3 00 00 00    	je     802dd4 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802d11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d15:	48 89 c7             	mov    %rax,%rdi
+  802d18:	48 b8 47 53 80 00 00 	movabs $0x805347,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+  802d24:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802d27:	84 c0                	test   %al,%al
+  802d29:	0f 84 a5 00 00 00    	je     802dd4 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802d2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d33:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d37:	48 89 c2             	mov    %rax,%rdx
+  802d3a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d41:	01 00 00 
+  802d44:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d48:	83 e0 01             	and    $0x1,%eax
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	0f 84 80 00 00 00    	je     802dd4 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802d54:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802d58:	74 4a                	je     802da4 <fork_common+0x1d4>
+  802d5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d5e:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802d65:	00 00 00 
+  802d68:	48 39 c2             	cmp    %rax,%rdx
+  802d6b:	73 13                	jae    802d80 <fork_common+0x1b0>
+  802d6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d71:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802d78:	00 00 00 
+  802d7b:	48 39 c2             	cmp    %rax,%rdx
+  802d7e:	73 24                	jae    802da4 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802d80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d84:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d88:	48 89 c2             	mov    %rax,%rdx
+  802d8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d8e:	48 89 d6             	mov    %rdx,%rsi
+  802d91:	89 c7                	mov    %eax,%edi
+  802d93:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+  802d9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802da2:	eb 22                	jmp    802dc6 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802da4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802da8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802dac:	48 89 c2             	mov    %rax,%rdx
+  802daf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802db2:	48 89 d6             	mov    %rdx,%rsi
+  802db5:	89 c7                	mov    %eax,%edi
+  802db7:	48 b8 ca 29 80 00 00 	movabs $0x8029ca,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+  802dc3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802dc6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dca:	79 08                	jns    802dd4 <fork_common+0x204>
+            return r;
+  802dcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dcf:	e9 51 01 00 00       	jmp    802f25 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802dd4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802dd9:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802de0:	07 
+  802de1:	0f 86 78 fe ff ff    	jbe    802c5f <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802de7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802dee:	00 00 00 
+  802df1:	8b 40 04             	mov    0x4(%rax),%eax
+  802df4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802df9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802e00:	00 00 00 
+  802e03:	48 98                	cltq
+  802e05:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802e0c:	48 01 d0             	add    %rdx,%rax
+  802e0f:	48 05 00 01 00 00    	add    $0x100,%rax
+  802e15:	48 8b 10             	mov    (%rax),%rdx
+  802e18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e1b:	48 89 d6             	mov    %rdx,%rsi
+  802e1e:	89 c7                	mov    %eax,%edi
+  802e20:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e33:	79 36                	jns    802e6b <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802e35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e38:	89 c1                	mov    %eax,%ecx
+  802e3a:	48 b8 b0 6a 80 00 00 	movabs $0x806ab0,%rax
+  802e41:	00 00 00 
+  802e44:	48 89 c2             	mov    %rax,%rdx
+  802e47:	be be 00 00 00       	mov    $0xbe,%esi
+  802e4c:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802e53:	00 00 00 
+  802e56:	48 89 c7             	mov    %rax,%rdi
+  802e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5e:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  802e65:	00 00 00 
+  802e68:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802e6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e6e:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e73:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802e7a:	00 00 00 
+  802e7d:	48 89 ce             	mov    %rcx,%rsi
+  802e80:	89 c7                	mov    %eax,%edi
+  802e82:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  802e89:	00 00 00 
+  802e8c:	ff d0                	call   *%rax
+  802e8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e95:	79 36                	jns    802ecd <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  802e97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e9a:	89 c1                	mov    %eax,%ecx
+  802e9c:	48 b8 e0 6a 80 00 00 	movabs $0x806ae0,%rax
+  802ea3:	00 00 00 
+  802ea6:	48 89 c2             	mov    %rax,%rdx
+  802ea9:	be c1 00 00 00       	mov    $0xc1,%esi
+  802eae:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802eb5:	00 00 00 
+  802eb8:	48 89 c7             	mov    %rax,%rdi
+  802ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec0:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  802ec7:	00 00 00 
+  802eca:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  802ecd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ed0:	be 02 00 00 00       	mov    $0x2,%esi
+  802ed5:	89 c7                	mov    %eax,%edi
+  802ed7:	48 b8 92 21 80 00 00 	movabs $0x802192,%rax
+  802ede:	00 00 00 
+  802ee1:	ff d0                	call   *%rax
+  802ee3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ee6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eea:	79 36                	jns    802f22 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  802eec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eef:	89 c1                	mov    %eax,%ecx
+  802ef1:	48 b8 00 6b 80 00 00 	movabs $0x806b00,%rax
+  802ef8:	00 00 00 
+  802efb:	48 89 c2             	mov    %rax,%rdx
+  802efe:	be d4 00 00 00       	mov    $0xd4,%esi
+  802f03:	48 b8 e6 69 80 00 00 	movabs $0x8069e6,%rax
+  802f0a:	00 00 00 
+  802f0d:	48 89 c7             	mov    %rax,%rdi
+  802f10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f15:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  802f1c:	00 00 00 
+  802f1f:	41 ff d0             	call   *%r8
+    }
+    return e;
+  802f22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  802f25:	c9                   	leave
+  802f26:	c3                   	ret
+
+0000000000802f27 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  802f27:	55                   	push   %rbp
+  802f28:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  802f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f30:	48 b8 d0 2b 80 00 00 	movabs $0x802bd0,%rax
+  802f37:	00 00 00 
+  802f3a:	ff d0                	call   *%rax
+}
+  802f3c:	5d                   	pop    %rbp
+  802f3d:	c3                   	ret
+
+0000000000802f3e <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  802f3e:	55                   	push   %rbp
+  802f3f:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  802f42:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f47:	48 b8 d0 2b 80 00 00 	movabs $0x802bd0,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+}
+  802f53:	5d                   	pop    %rbp
+  802f54:	c3                   	ret
+
+0000000000802f55 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802f55:	55                   	push   %rbp
+  802f56:	48 89 e5             	mov    %rsp,%rbp
+  802f59:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802f61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f65:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802f6c:	ff ff ff 
+  802f6f:	48 01 d0             	add    %rdx,%rax
+  802f72:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f76:	c9                   	leave
+  802f77:	c3                   	ret
+
+0000000000802f78 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+  802f7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802f80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802f84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f88:	48 89 c7             	mov    %rax,%rdi
+  802f8b:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  802f92:	00 00 00 
+  802f95:	ff d0                	call   *%rax
+  802f97:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802f9d:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802fa1:	c9                   	leave
+  802fa2:	c3                   	ret
+
+0000000000802fa3 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802fa3:	55                   	push   %rbp
+  802fa4:	48 89 e5             	mov    %rsp,%rbp
+  802fa7:	48 83 ec 18          	sub    $0x18,%rsp
+  802fab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802faf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fb6:	e9 ae 00 00 00       	jmp    803069 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802fbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fbe:	c1 e0 0c             	shl    $0xc,%eax
+  802fc1:	48 98                	cltq
+  802fc3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802fc8:	48 01 d0             	add    %rdx,%rax
+  802fcb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802fcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd3:	48 c1 e8 27          	shr    $0x27,%rax
+  802fd7:	48 89 c2             	mov    %rax,%rdx
+  802fda:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802fe1:	01 00 00 
+  802fe4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fe8:	83 e0 01             	and    $0x1,%eax
+  802feb:	48 85 c0             	test   %rax,%rax
+  802fee:	74 63                	je     803053 <fd_alloc+0xb0>
+  802ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ff4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ff8:	48 89 c2             	mov    %rax,%rdx
+  802ffb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803002:	01 00 00 
+  803005:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803009:	83 e0 01             	and    $0x1,%eax
+  80300c:	48 85 c0             	test   %rax,%rax
+  80300f:	74 42                	je     803053 <fd_alloc+0xb0>
+  803011:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803015:	48 c1 e8 15          	shr    $0x15,%rax
+  803019:	48 89 c2             	mov    %rax,%rdx
+  80301c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803023:	01 00 00 
+  803026:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80302a:	83 e0 01             	and    $0x1,%eax
+  80302d:	48 85 c0             	test   %rax,%rax
+  803030:	74 21                	je     803053 <fd_alloc+0xb0>
+  803032:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803036:	48 c1 e8 0c          	shr    $0xc,%rax
+  80303a:	48 89 c2             	mov    %rax,%rdx
+  80303d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803044:	01 00 00 
+  803047:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80304b:	83 e0 01             	and    $0x1,%eax
+  80304e:	48 85 c0             	test   %rax,%rax
+  803051:	75 12                	jne    803065 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803053:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803057:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80305b:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80305e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803063:	eb 1e                	jmp    803083 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803065:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803069:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80306d:	0f 8e 48 ff ff ff    	jle    802fbb <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803077:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80307e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803083:	c9                   	leave
+  803084:	c3                   	ret
+
+0000000000803085 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803085:	55                   	push   %rbp
+  803086:	48 89 e5             	mov    %rsp,%rbp
+  803089:	48 83 ec 20          	sub    $0x20,%rsp
+  80308d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803090:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803094:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803098:	78 06                	js     8030a0 <fd_lookup+0x1b>
+  80309a:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80309e:	7e 0a                	jle    8030aa <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8030a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030a5:	e9 af 00 00 00       	jmp    803159 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8030aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030ad:	c1 e0 0c             	shl    $0xc,%eax
+  8030b0:	48 98                	cltq
+  8030b2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8030b7:	48 01 d0             	add    %rdx,%rax
+  8030ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8030be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030c2:	48 c1 e8 27          	shr    $0x27,%rax
+  8030c6:	48 89 c2             	mov    %rax,%rdx
+  8030c9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8030d0:	01 00 00 
+  8030d3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030d7:	83 e0 01             	and    $0x1,%eax
+  8030da:	48 85 c0             	test   %rax,%rax
+  8030dd:	74 63                	je     803142 <fd_lookup+0xbd>
+  8030df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030e3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030e7:	48 89 c2             	mov    %rax,%rdx
+  8030ea:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8030f1:	01 00 00 
+  8030f4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030f8:	83 e0 01             	and    $0x1,%eax
+  8030fb:	48 85 c0             	test   %rax,%rax
+  8030fe:	74 42                	je     803142 <fd_lookup+0xbd>
+  803100:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803104:	48 c1 e8 15          	shr    $0x15,%rax
+  803108:	48 89 c2             	mov    %rax,%rdx
+  80310b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803112:	01 00 00 
+  803115:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803119:	83 e0 01             	and    $0x1,%eax
+  80311c:	48 85 c0             	test   %rax,%rax
+  80311f:	74 21                	je     803142 <fd_lookup+0xbd>
+  803121:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803125:	48 c1 e8 0c          	shr    $0xc,%rax
+  803129:	48 89 c2             	mov    %rax,%rdx
+  80312c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803133:	01 00 00 
+  803136:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80313a:	83 e0 01             	and    $0x1,%eax
+  80313d:	48 85 c0             	test   %rax,%rax
+  803140:	75 07                	jne    803149 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803142:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803147:	eb 10                	jmp    803159 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803149:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80314d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803151:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803154:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803159:	c9                   	leave
+  80315a:	c3                   	ret
+
+000000000080315b <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80315b:	55                   	push   %rbp
+  80315c:	48 89 e5             	mov    %rsp,%rbp
+  80315f:	48 83 ec 30          	sub    $0x30,%rsp
+  803163:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803167:	89 f0                	mov    %esi,%eax
+  803169:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80316c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803170:	48 89 c7             	mov    %rax,%rdi
+  803173:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+  80317f:	89 c2                	mov    %eax,%edx
+  803181:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803185:	48 89 c6             	mov    %rax,%rsi
+  803188:	89 d7                	mov    %edx,%edi
+  80318a:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803191:	00 00 00 
+  803194:	ff d0                	call   *%rax
+  803196:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803199:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80319d:	78 0a                	js     8031a9 <fd_close+0x4e>
+  80319f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031a3:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8031a7:	74 12                	je     8031bb <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8031a9:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8031ad:	74 05                	je     8031b4 <fd_close+0x59>
+  8031af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031b2:	eb 70                	jmp    803224 <fd_close+0xc9>
+  8031b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b9:	eb 69                	jmp    803224 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8031bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031bf:	8b 00                	mov    (%rax),%eax
+  8031c1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031c5:	48 89 d6             	mov    %rdx,%rsi
+  8031c8:	89 c7                	mov    %eax,%edi
+  8031ca:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+  8031d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031dd:	78 2a                	js     803209 <fd_close+0xae>
+    if (dev->dev_close)
+  8031df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031e3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031e7:	48 85 c0             	test   %rax,%rax
+  8031ea:	74 16                	je     803202 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8031ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031f0:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8031f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031f8:	48 89 c7             	mov    %rax,%rdi
+  8031fb:	ff d2                	call   *%rdx
+  8031fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803200:	eb 07                	jmp    803209 <fd_close+0xae>
+    else
+      r = 0;
+  803202:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803209:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80320d:	48 89 c6             	mov    %rax,%rsi
+  803210:	bf 00 00 00 00       	mov    $0x0,%edi
+  803215:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  80321c:	00 00 00 
+  80321f:	ff d0                	call   *%rax
+  return r;
+  803221:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+0000000000803226 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803226:	55                   	push   %rbp
+  803227:	48 89 e5             	mov    %rsp,%rbp
+  80322a:	48 83 ec 20          	sub    $0x20,%rsp
+  80322e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803231:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803235:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80323c:	eb 3f                	jmp    80327d <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80323e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803245:	00 00 00 
+  803248:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80324b:	48 98                	cltq
+  80324d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803251:	8b 00                	mov    (%rax),%eax
+  803253:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803256:	75 21                	jne    803279 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803258:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80325f:	00 00 00 
+  803262:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803265:	48 98                	cltq
+  803267:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80326b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80326f:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803272:	b8 00 00 00 00       	mov    $0x0,%eax
+  803277:	eb 7f                	jmp    8032f8 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803279:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80327d:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803284:	00 00 00 
+  803287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80328a:	48 98                	cltq
+  80328c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803290:	48 85 c0             	test   %rax,%rax
+  803293:	75 a9                	jne    80323e <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803295:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80329c:	00 00 00 
+  80329f:	8b 40 04             	mov    0x4(%rax),%eax
+  8032a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032a7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032ae:	00 00 00 
+  8032b1:	48 98                	cltq
+  8032b3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032ba:	48 01 d0             	add    %rdx,%rax
+  8032bd:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032c3:	8b 00                	mov    (%rax),%eax
+  8032c5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032c8:	89 c6                	mov    %eax,%esi
+  8032ca:	48 b8 28 6b 80 00 00 	movabs $0x806b28,%rax
+  8032d1:	00 00 00 
+  8032d4:	48 89 c7             	mov    %rax,%rdi
+  8032d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032dc:	48 b9 10 03 80 00 00 	movabs $0x800310,%rcx
+  8032e3:	00 00 00 
+  8032e6:	ff d1                	call   *%rcx
+  *dev = 0;
+  8032e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032ec:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8032f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032f8:	c9                   	leave
+  8032f9:	c3                   	ret
+
+00000000008032fa <close>:
+
+int
+close(int fdnum) {
+  8032fa:	55                   	push   %rbp
+  8032fb:	48 89 e5             	mov    %rsp,%rbp
+  8032fe:	48 83 ec 20          	sub    $0x20,%rsp
+  803302:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803305:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803309:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80330c:	48 89 d6             	mov    %rdx,%rsi
+  80330f:	89 c7                	mov    %eax,%edi
+  803311:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803320:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803324:	79 05                	jns    80332b <close+0x31>
+    return r;
+  803326:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803329:	eb 18                	jmp    803343 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80332b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80332f:	be 01 00 00 00       	mov    $0x1,%esi
+  803334:	48 89 c7             	mov    %rax,%rdi
+  803337:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+}
+  803343:	c9                   	leave
+  803344:	c3                   	ret
+
+0000000000803345 <close_all>:
+
+void
+close_all(void) {
+  803345:	55                   	push   %rbp
+  803346:	48 89 e5             	mov    %rsp,%rbp
+  803349:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80334d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803354:	eb 15                	jmp    80336b <close_all+0x26>
+    close(i);
+  803356:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803359:	89 c7                	mov    %eax,%edi
+  80335b:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803367:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80336b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80336f:	7e e5                	jle    803356 <close_all+0x11>
+}
+  803371:	90                   	nop
+  803372:	90                   	nop
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+0000000000803375 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803375:	55                   	push   %rbp
+  803376:	48 89 e5             	mov    %rsp,%rbp
+  803379:	48 83 ec 40          	sub    $0x40,%rsp
+  80337d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803380:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803383:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803387:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80338a:	48 89 d6             	mov    %rdx,%rsi
+  80338d:	89 c7                	mov    %eax,%edi
+  80338f:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+  80339b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80339e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033a2:	79 08                	jns    8033ac <dup+0x37>
+    return r;
+  8033a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033a7:	e9 33 02 00 00       	jmp    8035df <dup+0x26a>
+  close(newfdnum);
+  8033ac:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033af:	89 c7                	mov    %eax,%edi
+  8033b1:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  8033b8:	00 00 00 
+  8033bb:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8033bd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033c0:	c1 e0 0c             	shl    $0xc,%eax
+  8033c3:	48 98                	cltq
+  8033c5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033ca:	48 01 d0             	add    %rdx,%rax
+  8033cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8033d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033d5:	48 89 c7             	mov    %rax,%rdi
+  8033d8:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8033df:	00 00 00 
+  8033e2:	ff d0                	call   *%rax
+  8033e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8033e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033ec:	48 89 c7             	mov    %rax,%rdi
+  8033ef:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8033f6:	00 00 00 
+  8033f9:	ff d0                	call   *%rax
+  8033fb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8033ff:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803406:	00 
+  803407:	e9 19 01 00 00       	jmp    803525 <dup+0x1b0>
+    off -= PGSIZE;
+  80340c:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803413:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803414:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803418:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80341c:	48 01 d0             	add    %rdx,%rax
+  80341f:	48 c1 e8 27          	shr    $0x27,%rax
+  803423:	48 89 c2             	mov    %rax,%rdx
+  803426:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80342d:	01 00 00 
+  803430:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803434:	83 e0 01             	and    $0x1,%eax
+  803437:	48 85 c0             	test   %rax,%rax
+  80343a:	0f 84 e5 00 00 00    	je     803525 <dup+0x1b0>
+  803440:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803444:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803448:	48 01 d0             	add    %rdx,%rax
+  80344b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80344f:	48 89 c2             	mov    %rax,%rdx
+  803452:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803459:	01 00 00 
+  80345c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803460:	83 e0 01             	and    $0x1,%eax
+  803463:	48 85 c0             	test   %rax,%rax
+  803466:	0f 84 b9 00 00 00    	je     803525 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80346c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803470:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803474:	48 01 d0             	add    %rdx,%rax
+  803477:	48 c1 e8 15          	shr    $0x15,%rax
+  80347b:	48 89 c2             	mov    %rax,%rdx
+  80347e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803485:	01 00 00 
+  803488:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80348c:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80348f:	48 85 c0             	test   %rax,%rax
+  803492:	0f 84 8d 00 00 00    	je     803525 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803498:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80349c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034a0:	48 01 d0             	add    %rdx,%rax
+  8034a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034a7:	48 89 c2             	mov    %rax,%rdx
+  8034aa:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034b1:	01 00 00 
+  8034b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034b8:	83 e0 01             	and    $0x1,%eax
+  8034bb:	48 85 c0             	test   %rax,%rax
+  8034be:	74 65                	je     803525 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8034c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034c8:	48 01 d0             	add    %rdx,%rax
+  8034cb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034cf:	48 89 c2             	mov    %rax,%rdx
+  8034d2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034d9:	01 00 00 
+  8034dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034e5:	89 c6                	mov    %eax,%esi
+  8034e7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034ef:	48 01 c2             	add    %rax,%rdx
+  8034f2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8034f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034fa:	48 01 c8             	add    %rcx,%rax
+  8034fd:	41 89 f0             	mov    %esi,%r8d
+  803500:	48 89 d1             	mov    %rdx,%rcx
+  803503:	ba 00 00 00 00       	mov    $0x0,%edx
+  803508:	48 89 c6             	mov    %rax,%rsi
+  80350b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803510:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+  80351c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80351f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803523:	78 60                	js     803585 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803525:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80352a:	0f 85 dc fe ff ff    	jne    80340c <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803530:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803534:	48 c1 e8 0c          	shr    $0xc,%rax
+  803538:	48 89 c2             	mov    %rax,%rdx
+  80353b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803542:	01 00 00 
+  803545:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803549:	25 07 0e 00 00       	and    $0xe07,%eax
+  80354e:	89 c1                	mov    %eax,%ecx
+  803550:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803554:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803558:	41 89 c8             	mov    %ecx,%r8d
+  80355b:	48 89 d1             	mov    %rdx,%rcx
+  80355e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803563:	48 89 c6             	mov    %rax,%rsi
+  803566:	bf 00 00 00 00       	mov    $0x0,%edi
+  80356b:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  803572:	00 00 00 
+  803575:	ff d0                	call   *%rax
+  803577:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80357a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80357e:	78 08                	js     803588 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803580:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803583:	eb 5a                	jmp    8035df <dup+0x26a>
+        goto err;
+  803585:	90                   	nop
+  803586:	eb 01                	jmp    803589 <dup+0x214>
+    goto err;
+  803588:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80358d:	48 89 c6             	mov    %rax,%rsi
+  803590:	bf 00 00 00 00       	mov    $0x0,%edi
+  803595:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  80359c:	00 00 00 
+  80359f:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8035a1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8035a8:	00 
+  8035a9:	eb 27                	jmp    8035d2 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8035ab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8035af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035b3:	48 01 d0             	add    %rdx,%rax
+  8035b6:	48 89 c6             	mov    %rax,%rsi
+  8035b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035be:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8035ca:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8035d1:	00 
+  8035d2:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8035d9:	00 
+  8035da:	76 cf                	jbe    8035ab <dup+0x236>
+  return r;
+  8035dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8035df:	c9                   	leave
+  8035e0:	c3                   	ret
+
+00000000008035e1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8035e1:	55                   	push   %rbp
+  8035e2:	48 89 e5             	mov    %rsp,%rbp
+  8035e5:	48 83 ec 40          	sub    $0x40,%rsp
+  8035e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8035ec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8035f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8035f4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8035f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035fb:	48 89 d6             	mov    %rdx,%rsi
+  8035fe:	89 c7                	mov    %eax,%edi
+  803600:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+  80360c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80360f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803613:	78 24                	js     803639 <read+0x58>
+  803615:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803619:	8b 00                	mov    (%rax),%eax
+  80361b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80361f:	48 89 d6             	mov    %rdx,%rsi
+  803622:	89 c7                	mov    %eax,%edi
+  803624:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  80362b:	00 00 00 
+  80362e:	ff d0                	call   *%rax
+  803630:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803633:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803637:	79 0a                	jns    803643 <read+0x62>
+    return r;
+  803639:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80363c:	48 98                	cltq
+  80363e:	e9 9e 00 00 00       	jmp    8036e1 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803647:	8b 40 08             	mov    0x8(%rax),%eax
+  80364a:	83 e0 03             	and    $0x3,%eax
+  80364d:	83 f8 01             	cmp    $0x1,%eax
+  803650:	75 5c                	jne    8036ae <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803652:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803659:	00 00 00 
+  80365c:	8b 40 04             	mov    0x4(%rax),%eax
+  80365f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803664:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80366b:	00 00 00 
+  80366e:	48 98                	cltq
+  803670:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803677:	48 01 d0             	add    %rdx,%rax
+  80367a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803680:	8b 00                	mov    (%rax),%eax
+  803682:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803685:	89 c6                	mov    %eax,%esi
+  803687:	48 b8 47 6b 80 00 00 	movabs $0x806b47,%rax
+  80368e:	00 00 00 
+  803691:	48 89 c7             	mov    %rax,%rdi
+  803694:	b8 00 00 00 00       	mov    $0x0,%eax
+  803699:	48 b9 10 03 80 00 00 	movabs $0x800310,%rcx
+  8036a0:	00 00 00 
+  8036a3:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8036a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036ac:	eb 33                	jmp    8036e1 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8036ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036b2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036b6:	48 85 c0             	test   %rax,%rax
+  8036b9:	75 09                	jne    8036c4 <read+0xe3>
+    return -E_NOT_SUPP;
+  8036bb:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8036c2:	eb 1d                	jmp    8036e1 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8036c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036c8:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8036cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036d4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8036d8:	48 89 ce             	mov    %rcx,%rsi
+  8036db:	48 89 c7             	mov    %rax,%rdi
+  8036de:	41 ff d0             	call   *%r8
+}
+  8036e1:	c9                   	leave
+  8036e2:	c3                   	ret
+
+00000000008036e3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036e3:	55                   	push   %rbp
+  8036e4:	48 89 e5             	mov    %rsp,%rbp
+  8036e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8036eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8036f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8036f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036fd:	eb 49                	jmp    803748 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8036ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803702:	48 98                	cltq
+  803704:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803708:	48 29 c2             	sub    %rax,%rdx
+  80370b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80370e:	48 63 c8             	movslq %eax,%rcx
+  803711:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803715:	48 01 c1             	add    %rax,%rcx
+  803718:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80371b:	48 89 ce             	mov    %rcx,%rsi
+  80371e:	89 c7                	mov    %eax,%edi
+  803720:	48 b8 e1 35 80 00 00 	movabs $0x8035e1,%rax
+  803727:	00 00 00 
+  80372a:	ff d0                	call   *%rax
+  80372c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80372f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803733:	79 07                	jns    80373c <readn+0x59>
+      return m;
+  803735:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803738:	48 98                	cltq
+  80373a:	eb 1f                	jmp    80375b <readn+0x78>
+    if (m == 0)
+  80373c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803740:	74 13                	je     803755 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803742:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803745:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803748:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80374b:	48 98                	cltq
+  80374d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803751:	72 ac                	jb     8036ff <readn+0x1c>
+  803753:	eb 01                	jmp    803756 <readn+0x73>
+      break;
+  803755:	90                   	nop
+  }
+  return tot;
+  803756:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803759:	48 98                	cltq
+}
+  80375b:	c9                   	leave
+  80375c:	c3                   	ret
+
+000000000080375d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80375d:	55                   	push   %rbp
+  80375e:	48 89 e5             	mov    %rsp,%rbp
+  803761:	48 83 ec 40          	sub    $0x40,%rsp
+  803765:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803768:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80376c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803770:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803774:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803777:	48 89 d6             	mov    %rdx,%rsi
+  80377a:	89 c7                	mov    %eax,%edi
+  80377c:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803783:	00 00 00 
+  803786:	ff d0                	call   *%rax
+  803788:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80378b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80378f:	78 24                	js     8037b5 <write+0x58>
+  803791:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803795:	8b 00                	mov    (%rax),%eax
+  803797:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80379b:	48 89 d6             	mov    %rdx,%rsi
+  80379e:	89 c7                	mov    %eax,%edi
+  8037a0:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037b3:	79 0a                	jns    8037bf <write+0x62>
+    return r;
+  8037b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037b8:	48 98                	cltq
+  8037ba:	e9 9d 00 00 00       	jmp    80385c <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037c3:	8b 40 08             	mov    0x8(%rax),%eax
+  8037c6:	83 e0 03             	and    $0x3,%eax
+  8037c9:	85 c0                	test   %eax,%eax
+  8037cb:	75 5c                	jne    803829 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037cd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8037d4:	00 00 00 
+  8037d7:	8b 40 04             	mov    0x4(%rax),%eax
+  8037da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037df:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8037e6:	00 00 00 
+  8037e9:	48 98                	cltq
+  8037eb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8037f2:	48 01 d0             	add    %rdx,%rax
+  8037f5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8037fb:	8b 00                	mov    (%rax),%eax
+  8037fd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803800:	89 c6                	mov    %eax,%esi
+  803802:	48 b8 63 6b 80 00 00 	movabs $0x806b63,%rax
+  803809:	00 00 00 
+  80380c:	48 89 c7             	mov    %rax,%rdi
+  80380f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803814:	48 b9 10 03 80 00 00 	movabs $0x800310,%rcx
+  80381b:	00 00 00 
+  80381e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803820:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803827:	eb 33                	jmp    80385c <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803829:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80382d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803831:	48 85 c0             	test   %rax,%rax
+  803834:	75 09                	jne    80383f <write+0xe2>
+    return -E_NOT_SUPP;
+  803836:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80383d:	eb 1d                	jmp    80385c <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80383f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803843:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80384b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80384f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803853:	48 89 ce             	mov    %rcx,%rsi
+  803856:	48 89 c7             	mov    %rax,%rdi
+  803859:	41 ff d0             	call   *%r8
+}
+  80385c:	c9                   	leave
+  80385d:	c3                   	ret
+
+000000000080385e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80385e:	55                   	push   %rbp
+  80385f:	48 89 e5             	mov    %rsp,%rbp
+  803862:	48 83 ec 18          	sub    $0x18,%rsp
+  803866:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803869:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80386c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803870:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803873:	48 89 d6             	mov    %rdx,%rsi
+  803876:	89 c7                	mov    %eax,%edi
+  803878:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  80387f:	00 00 00 
+  803882:	ff d0                	call   *%rax
+  803884:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803887:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80388b:	79 05                	jns    803892 <seek+0x34>
+    return r;
+  80388d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803890:	eb 0f                	jmp    8038a1 <seek+0x43>
+  fd->fd_offset = offset;
+  803892:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803896:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803899:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80389c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a1:	c9                   	leave
+  8038a2:	c3                   	ret
+
+00000000008038a3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038a3:	55                   	push   %rbp
+  8038a4:	48 89 e5             	mov    %rsp,%rbp
+  8038a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8038ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038ae:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038b1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8038b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038b8:	48 89 d6             	mov    %rdx,%rsi
+  8038bb:	89 c7                	mov    %eax,%edi
+  8038bd:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  8038c4:	00 00 00 
+  8038c7:	ff d0                	call   *%rax
+  8038c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038d0:	78 24                	js     8038f6 <ftruncate+0x53>
+  8038d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038d6:	8b 00                	mov    (%rax),%eax
+  8038d8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038dc:	48 89 d6             	mov    %rdx,%rsi
+  8038df:	89 c7                	mov    %eax,%edi
+  8038e1:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+  8038ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038f4:	79 08                	jns    8038fe <ftruncate+0x5b>
+    return r;
+  8038f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038f9:	e9 92 00 00 00       	jmp    803990 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803902:	8b 40 08             	mov    0x8(%rax),%eax
+  803905:	83 e0 03             	and    $0x3,%eax
+  803908:	85 c0                	test   %eax,%eax
+  80390a:	75 5a                	jne    803966 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80390c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803913:	00 00 00 
+  803916:	8b 40 04             	mov    0x4(%rax),%eax
+  803919:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80391e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803925:	00 00 00 
+  803928:	48 98                	cltq
+  80392a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803931:	48 01 d0             	add    %rdx,%rax
+  803934:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80393a:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80393c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80393f:	89 c6                	mov    %eax,%esi
+  803941:	48 b8 80 6b 80 00 00 	movabs $0x806b80,%rax
+  803948:	00 00 00 
+  80394b:	48 89 c7             	mov    %rax,%rdi
+  80394e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803953:	48 b9 10 03 80 00 00 	movabs $0x800310,%rcx
+  80395a:	00 00 00 
+  80395d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80395f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803964:	eb 2a                	jmp    803990 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803966:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80396a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80396e:	48 85 c0             	test   %rax,%rax
+  803971:	75 07                	jne    80397a <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803973:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803978:	eb 16                	jmp    803990 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80397a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80397e:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803982:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803986:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803989:	89 d6                	mov    %edx,%esi
+  80398b:	48 89 c7             	mov    %rax,%rdi
+  80398e:	ff d1                	call   *%rcx
+}
+  803990:	c9                   	leave
+  803991:	c3                   	ret
+
+0000000000803992 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803992:	55                   	push   %rbp
+  803993:	48 89 e5             	mov    %rsp,%rbp
+  803996:	48 83 ec 30          	sub    $0x30,%rsp
+  80399a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80399d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039a1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039a8:	48 89 d6             	mov    %rdx,%rsi
+  8039ab:	89 c7                	mov    %eax,%edi
+  8039ad:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  8039b4:	00 00 00 
+  8039b7:	ff d0                	call   *%rax
+  8039b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039c0:	78 24                	js     8039e6 <fstat+0x54>
+  8039c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c6:	8b 00                	mov    (%rax),%eax
+  8039c8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039cc:	48 89 d6             	mov    %rdx,%rsi
+  8039cf:	89 c7                	mov    %eax,%edi
+  8039d1:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039e0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039e4:	79 05                	jns    8039eb <fstat+0x59>
+    return r;
+  8039e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039e9:	eb 5e                	jmp    803a49 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8039eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ef:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8039f3:	48 85 c0             	test   %rax,%rax
+  8039f6:	75 07                	jne    8039ff <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8039f8:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8039fd:	eb 4a                	jmp    803a49 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8039ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a03:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803a06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a0a:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803a11:	00 00 00 
+  stat->st_isdir   = 0;
+  803a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a18:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803a1f:	00 00 00 
+  stat->st_dev     = dev;
+  803a22:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a2a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803a31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a35:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803a39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a3d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a41:	48 89 d6             	mov    %rdx,%rsi
+  803a44:	48 89 c7             	mov    %rax,%rdi
+  803a47:	ff d1                	call   *%rcx
+}
+  803a49:	c9                   	leave
+  803a4a:	c3                   	ret
+
+0000000000803a4b <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803a4b:	55                   	push   %rbp
+  803a4c:	48 89 e5             	mov    %rsp,%rbp
+  803a4f:	48 83 ec 10          	sub    $0x10,%rsp
+  803a53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a5f:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a65:	83 f8 20             	cmp    $0x20,%eax
+  803a68:	75 07                	jne    803a71 <pollwait_key+0x26>
+    return -E_INVAL;
+  803a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a6f:	eb 5f                	jmp    803ad0 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803a71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a75:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803a7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a7f:	48 63 d2             	movslq %edx,%rdx
+  803a82:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a86:	48 01 c2             	add    %rax,%rdx
+  803a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8d:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a94:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9e:	8b 00                	mov    (%rax),%eax
+  803aa0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803aa4:	48 63 c9             	movslq %ecx,%rcx
+  803aa7:	48 c1 e1 04          	shl    $0x4,%rcx
+  803aab:	48 01 ca             	add    %rcx,%rdx
+  803aae:	48 83 c2 08          	add    $0x8,%rdx
+  803ab2:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803ab4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ab8:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803abe:	8d 50 01             	lea    0x1(%rax),%edx
+  803ac1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ac5:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803acb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad0:	c9                   	leave
+  803ad1:	c3                   	ret
+
+0000000000803ad2 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803ad2:	55                   	push   %rbp
+  803ad3:	48 89 e5             	mov    %rsp,%rbp
+  803ad6:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803add:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803ae4:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803aea:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803af1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803af8:	00 
+  int i, r, ready, ipc = 0;
+  803af9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803b00:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803b07:	00 
+  803b08:	74 45                	je     803b4f <poll+0x7d>
+  803b0a:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803b11:	ff 
+  803b12:	74 3b                	je     803b4f <poll+0x7d>
+    now      = vsys_clock_ns();
+  803b14:	48 b8 4c 54 80 00 00 	movabs $0x80544c,%rax
+  803b1b:	00 00 00 
+  803b1e:	ff d0                	call   *%rax
+  803b20:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803b24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b28:	48 f7 d0             	not    %rax
+  803b2b:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803b32:	73 10                	jae    803b44 <poll+0x72>
+  803b34:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b38:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803b3f:	48 01 d0             	add    %rdx,%rax
+  803b42:	eb 07                	jmp    803b4b <poll+0x79>
+  803b44:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803b4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803b4f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803b56:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803b5d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803b64:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803b6b:	e9 46 02 00 00       	jmp    803db6 <poll+0x2e4>
+      fds[i].revents = 0;
+  803b70:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b73:	48 63 d0             	movslq %eax,%rdx
+  803b76:	48 89 d0             	mov    %rdx,%rax
+  803b79:	48 01 c0             	add    %rax,%rax
+  803b7c:	48 01 d0             	add    %rdx,%rax
+  803b7f:	48 c1 e0 02          	shl    $0x2,%rax
+  803b83:	48 89 c2             	mov    %rax,%rdx
+  803b86:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b8d:	48 01 d0             	add    %rdx,%rax
+  803b90:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803b97:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b9a:	48 63 d0             	movslq %eax,%rdx
+  803b9d:	48 89 d0             	mov    %rdx,%rax
+  803ba0:	48 01 c0             	add    %rax,%rax
+  803ba3:	48 01 d0             	add    %rdx,%rax
+  803ba6:	48 c1 e0 02          	shl    $0x2,%rax
+  803baa:	48 89 c2             	mov    %rax,%rdx
+  803bad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bb4:	48 01 d0             	add    %rdx,%rax
+  803bb7:	8b 00                	mov    (%rax),%eax
+  803bb9:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803bbc:	75 62                	jne    803c20 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803bbe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bc1:	48 63 d0             	movslq %eax,%rdx
+  803bc4:	48 89 d0             	mov    %rdx,%rax
+  803bc7:	48 01 c0             	add    %rax,%rax
+  803bca:	48 01 d0             	add    %rdx,%rax
+  803bcd:	48 c1 e0 02          	shl    $0x2,%rax
+  803bd1:	48 89 c2             	mov    %rax,%rdx
+  803bd4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bdb:	48 01 d0             	add    %rdx,%rax
+  803bde:	8b 40 04             	mov    0x4(%rax),%eax
+  803be1:	83 e0 01             	and    $0x1,%eax
+  803be4:	85 c0                	test   %eax,%eax
+  803be6:	0f 84 9b 01 00 00    	je     803d87 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803bec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bef:	48 63 d0             	movslq %eax,%rdx
+  803bf2:	48 89 d0             	mov    %rdx,%rax
+  803bf5:	48 01 c0             	add    %rax,%rax
+  803bf8:	48 01 d0             	add    %rdx,%rax
+  803bfb:	48 c1 e0 02          	shl    $0x2,%rax
+  803bff:	48 89 c2             	mov    %rax,%rdx
+  803c02:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c09:	48 01 c2             	add    %rax,%rdx
+  803c0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c0f:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803c12:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803c15:	83 c8 04             	or     $0x4,%eax
+  803c18:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803c1b:	e9 67 01 00 00       	jmp    803d87 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c23:	48 63 d0             	movslq %eax,%rdx
+  803c26:	48 89 d0             	mov    %rdx,%rax
+  803c29:	48 01 c0             	add    %rax,%rax
+  803c2c:	48 01 d0             	add    %rdx,%rax
+  803c2f:	48 c1 e0 02          	shl    $0x2,%rax
+  803c33:	48 89 c2             	mov    %rax,%rdx
+  803c36:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c3d:	48 01 d0             	add    %rdx,%rax
+  803c40:	8b 00                	mov    (%rax),%eax
+  803c42:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803c49:	48 89 d6             	mov    %rdx,%rsi
+  803c4c:	89 c7                	mov    %eax,%edi
+  803c4e:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  803c55:	00 00 00 
+  803c58:	ff d0                	call   *%rax
+  803c5a:	85 c0                	test   %eax,%eax
+  803c5c:	78 25                	js     803c83 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803c5e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c65:	8b 00                	mov    (%rax),%eax
+  803c67:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803c6e:	48 89 d6             	mov    %rdx,%rsi
+  803c71:	89 c7                	mov    %eax,%edi
+  803c73:	48 b8 26 32 80 00 00 	movabs $0x803226,%rax
+  803c7a:	00 00 00 
+  803c7d:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c7f:	85 c0                	test   %eax,%eax
+  803c81:	79 2c                	jns    803caf <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803c83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c86:	48 63 d0             	movslq %eax,%rdx
+  803c89:	48 89 d0             	mov    %rdx,%rax
+  803c8c:	48 01 c0             	add    %rax,%rax
+  803c8f:	48 01 d0             	add    %rdx,%rax
+  803c92:	48 c1 e0 02          	shl    $0x2,%rax
+  803c96:	48 89 c2             	mov    %rax,%rdx
+  803c99:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ca0:	48 01 d0             	add    %rdx,%rax
+  803ca3:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803caa:	e9 d8 00 00 00       	jmp    803d87 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803caf:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803cb6:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803cba:	48 85 c0             	test   %rax,%rax
+  803cbd:	74 7d                	je     803d3c <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803cbf:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803cc6:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803cca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ccd:	48 63 d0             	movslq %eax,%rdx
+  803cd0:	48 89 d0             	mov    %rdx,%rax
+  803cd3:	48 01 c0             	add    %rax,%rax
+  803cd6:	48 01 d0             	add    %rdx,%rax
+  803cd9:	48 c1 e0 02          	shl    $0x2,%rax
+  803cdd:	48 89 c2             	mov    %rax,%rdx
+  803ce0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ce7:	48 01 d0             	add    %rdx,%rax
+  803cea:	8b 48 04             	mov    0x4(%rax),%ecx
+  803ced:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803cf4:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803cfb:	89 ce                	mov    %ecx,%esi
+  803cfd:	48 89 c7             	mov    %rax,%rdi
+  803d00:	41 ff d0             	call   *%r8
+  803d03:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803d06:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d0a:	79 08                	jns    803d14 <poll+0x242>
+          return r;
+  803d0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d0f:	e9 45 01 00 00       	jmp    803e59 <poll+0x387>
+        fds[i].revents = r;
+  803d14:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d17:	48 63 d0             	movslq %eax,%rdx
+  803d1a:	48 89 d0             	mov    %rdx,%rax
+  803d1d:	48 01 c0             	add    %rax,%rax
+  803d20:	48 01 d0             	add    %rdx,%rax
+  803d23:	48 c1 e0 02          	shl    $0x2,%rax
+  803d27:	48 89 c2             	mov    %rax,%rdx
+  803d2a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d31:	48 01 c2             	add    %rax,%rdx
+  803d34:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d37:	89 42 08             	mov    %eax,0x8(%rdx)
+  803d3a:	eb 4b                	jmp    803d87 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803d3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d3f:	48 63 d0             	movslq %eax,%rdx
+  803d42:	48 89 d0             	mov    %rdx,%rax
+  803d45:	48 01 c0             	add    %rax,%rax
+  803d48:	48 01 d0             	add    %rdx,%rax
+  803d4b:	48 c1 e0 02          	shl    $0x2,%rax
+  803d4f:	48 89 c2             	mov    %rax,%rdx
+  803d52:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d59:	48 01 d0             	add    %rdx,%rax
+  803d5c:	8b 48 04             	mov    0x4(%rax),%ecx
+  803d5f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d62:	48 63 d0             	movslq %eax,%rdx
+  803d65:	48 89 d0             	mov    %rdx,%rax
+  803d68:	48 01 c0             	add    %rax,%rax
+  803d6b:	48 01 d0             	add    %rdx,%rax
+  803d6e:	48 c1 e0 02          	shl    $0x2,%rax
+  803d72:	48 89 c2             	mov    %rax,%rdx
+  803d75:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d7c:	48 01 d0             	add    %rdx,%rax
+  803d7f:	83 e1 03             	and    $0x3,%ecx
+  803d82:	89 ca                	mov    %ecx,%edx
+  803d84:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803d87:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d8a:	48 63 d0             	movslq %eax,%rdx
+  803d8d:	48 89 d0             	mov    %rdx,%rax
+  803d90:	48 01 c0             	add    %rax,%rax
+  803d93:	48 01 d0             	add    %rdx,%rax
+  803d96:	48 c1 e0 02          	shl    $0x2,%rax
+  803d9a:	48 89 c2             	mov    %rax,%rdx
+  803d9d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803da4:	48 01 d0             	add    %rdx,%rax
+  803da7:	8b 40 08             	mov    0x8(%rax),%eax
+  803daa:	85 c0                	test   %eax,%eax
+  803dac:	74 04                	je     803db2 <poll+0x2e0>
+        ready++;
+  803dae:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803db2:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803db6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803db9:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803dbf:	0f 8c ab fd ff ff    	jl     803b70 <poll+0x9e>
+    }
+    if (ready)
+  803dc5:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803dc9:	74 08                	je     803dd3 <poll+0x301>
+      return ready;
+  803dcb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803dce:	e9 86 00 00 00       	jmp    803e59 <poll+0x387>
+
+    if (deadline) {
+  803dd3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803dd8:	74 30                	je     803e0a <poll+0x338>
+      now     = vsys_clock_ns();
+  803dda:	48 b8 4c 54 80 00 00 	movabs $0x80544c,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+  803de6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803dea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dee:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803df2:	73 0a                	jae    803dfe <poll+0x32c>
+  803df4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df8:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803dfc:	eb 05                	jmp    803e03 <poll+0x331>
+  803dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e03:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803e0a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803e0d:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803e10:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803e17:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803e1e:	48 89 c7             	mov    %rax,%rdi
+  803e21:	48 b8 d6 24 80 00 00 	movabs $0x8024d6,%rax
+  803e28:	00 00 00 
+  803e2b:	ff d0                	call   *%rax
+  803e2d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803e30:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803e34:	75 07                	jne    803e3d <poll+0x36b>
+      return 0;
+  803e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3b:	eb 1c                	jmp    803e59 <poll+0x387>
+    if (r < 0)
+  803e3d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803e41:	79 05                	jns    803e48 <poll+0x376>
+      return r;
+  803e43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e46:	eb 11                	jmp    803e59 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803e48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e4b:	c1 f8 02             	sar    $0x2,%eax
+  803e4e:	83 e0 01             	and    $0x1,%eax
+  803e51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803e54:	e9 f6 fc ff ff       	jmp    803b4f <poll+0x7d>
+  }
+}
+  803e59:	c9                   	leave
+  803e5a:	c3                   	ret
+
+0000000000803e5b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803e5b:	55                   	push   %rbp
+  803e5c:	48 89 e5             	mov    %rsp,%rbp
+  803e5f:	48 83 ec 20          	sub    $0x20,%rsp
+  803e63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803e6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e6f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e74:	48 89 c7             	mov    %rax,%rdi
+  803e77:	48 b8 49 3f 80 00 00 	movabs $0x803f49,%rax
+  803e7e:	00 00 00 
+  803e81:	ff d0                	call   *%rax
+  803e83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e86:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e8a:	79 05                	jns    803e91 <stat+0x36>
+    return fd;
+  803e8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e8f:	eb 2f                	jmp    803ec0 <stat+0x65>
+  r = fstat(fd, stat);
+  803e91:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e98:	48 89 d6             	mov    %rdx,%rsi
+  803e9b:	89 c7                	mov    %eax,%edi
+  803e9d:	48 b8 92 39 80 00 00 	movabs $0x803992,%rax
+  803ea4:	00 00 00 
+  803ea7:	ff d0                	call   *%rax
+  803ea9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803eac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eaf:	89 c7                	mov    %eax,%edi
+  803eb1:	48 b8 fa 32 80 00 00 	movabs $0x8032fa,%rax
+  803eb8:	00 00 00 
+  803ebb:	ff d0                	call   *%rax
+  return r;
+  803ebd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803ec0:	c9                   	leave
+  803ec1:	c3                   	ret
+
+0000000000803ec2 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803ec2:	55                   	push   %rbp
+  803ec3:	48 89 e5             	mov    %rsp,%rbp
+  803ec6:	48 83 ec 10          	sub    $0x10,%rsp
+  803eca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803ecd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803ed1:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803ed8:	00 00 00 
+  803edb:	8b 00                	mov    (%rax),%eax
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	75 1d                	jne    803efe <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ee1:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ee6:	48 b8 e7 5c 80 00 00 	movabs $0x805ce7,%rax
+  803eed:	00 00 00 
+  803ef0:	ff d0                	call   *%rax
+  803ef2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803ef9:	00 00 00 
+  803efc:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803efe:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803f05:	00 00 00 
+  803f08:	8b 00                	mov    (%rax),%eax
+  803f0a:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803f0d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803f12:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f19:	00 00 00 
+  803f1c:	89 c7                	mov    %eax,%edi
+  803f1e:	48 b8 3a 5c 80 00 00 	movabs $0x805c3a,%rax
+  803f25:	00 00 00 
+  803f28:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803f2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f33:	48 89 c6             	mov    %rax,%rsi
+  803f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f3b:	48 b8 bd 5a 80 00 00 	movabs $0x805abd,%rax
+  803f42:	00 00 00 
+  803f45:	ff d0                	call   *%rax
+}
+  803f47:	c9                   	leave
+  803f48:	c3                   	ret
+
+0000000000803f49 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803f49:	55                   	push   %rbp
+  803f4a:	48 89 e5             	mov    %rsp,%rbp
+  803f4d:	48 83 ec 20          	sub    $0x20,%rsp
+  803f51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803f55:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803f58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f5c:	48 89 c7             	mov    %rax,%rdi
+  803f5f:	48 b8 bf 11 80 00 00 	movabs $0x8011bf,%rax
+  803f66:	00 00 00 
+  803f69:	ff d0                	call   *%rax
+  803f6b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f70:	7e 0a                	jle    803f7c <open+0x33>
+    return -E_BAD_PATH;
+  803f72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f77:	e9 a8 00 00 00       	jmp    804024 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803f7c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803f80:	48 89 c7             	mov    %rax,%rdi
+  803f83:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  803f8a:	00 00 00 
+  803f8d:	ff d0                	call   *%rax
+  803f8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f96:	79 08                	jns    803fa0 <open+0x57>
+    return r;
+  803f98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f9b:	e9 84 00 00 00       	jmp    804024 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803fa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fa4:	48 89 c6             	mov    %rax,%rsi
+  803fa7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803fae:	00 00 00 
+  803fb1:	48 89 c7             	mov    %rax,%rdi
+  803fb4:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  803fbb:	00 00 00 
+  803fbe:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803fc0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803fc7:	00 00 00 
+  803fca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fcd:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803fd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fd7:	48 89 c6             	mov    %rax,%rsi
+  803fda:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fdf:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  803fe6:	00 00 00 
+  803fe9:	ff d0                	call   *%rax
+  803feb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ff2:	79 1d                	jns    804011 <open+0xc8>
+    fd_close(fd, 0);
+  803ff4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ff8:	be 00 00 00 00       	mov    $0x0,%esi
+  803ffd:	48 89 c7             	mov    %rax,%rdi
+  804000:	48 b8 5b 31 80 00 00 	movabs $0x80315b,%rax
+  804007:	00 00 00 
+  80400a:	ff d0                	call   *%rax
+    return r;
+  80400c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80400f:	eb 13                	jmp    804024 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804011:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804015:	48 89 c7             	mov    %rax,%rdi
+  804018:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+}
+  804024:	c9                   	leave
+  804025:	c3                   	ret
+
+0000000000804026 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804026:	55                   	push   %rbp
+  804027:	48 89 e5             	mov    %rsp,%rbp
+  80402a:	48 83 ec 10          	sub    $0x10,%rsp
+  80402e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804032:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804036:	8b 40 0c             	mov    0xc(%rax),%eax
+  804039:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804040:	00 00 00 
+  804043:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804045:	be 00 00 00 00       	mov    $0x0,%esi
+  80404a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80404f:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  804056:	00 00 00 
+  804059:	ff d0                	call   *%rax
+}
+  80405b:	c9                   	leave
+  80405c:	c3                   	ret
+
+000000000080405d <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80405d:	55                   	push   %rbp
+  80405e:	48 89 e5             	mov    %rsp,%rbp
+  804061:	48 83 ec 30          	sub    $0x30,%rsp
+  804065:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804069:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80406d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804071:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804076:	74 07                	je     80407f <devfile_read+0x22>
+  804078:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80407d:	75 0a                	jne    804089 <devfile_read+0x2c>
+  return E_INVAL;
+  80407f:	b8 03 00 00 00       	mov    $0x3,%eax
+  804084:	e9 b4 00 00 00       	jmp    80413d <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804089:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804090:	00 
+  while (n) {
+  804091:	e9 98 00 00 00       	jmp    80412e <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804096:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80409a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80409d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8040a4:	00 00 00 
+  8040a7:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8040a9:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8040b0:	00 00 00 
+  8040b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8040bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8040c0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8040c5:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8040cc:	00 00 00 
+  8040cf:	ff d0                	call   *%rax
+  8040d1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8040d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040d8:	7f 13                	jg     8040ed <devfile_read+0x90>
+      return res ? res : res0;
+  8040da:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040de:	74 07                	je     8040e7 <devfile_read+0x8a>
+  8040e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040e3:	48 98                	cltq
+  8040e5:	eb 56                	jmp    80413d <devfile_read+0xe0>
+  8040e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040eb:	eb 50                	jmp    80413d <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8040ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040f0:	48 63 d0             	movslq %eax,%rdx
+  8040f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040f7:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8040fe:	00 00 00 
+  804101:	48 89 ce             	mov    %rcx,%rsi
+  804104:	48 89 c7             	mov    %rax,%rdi
+  804107:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  80410e:	00 00 00 
+  804111:	ff d0                	call   *%rax
+
+    buf += res;
+  804113:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804116:	48 98                	cltq
+  804118:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80411c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80411f:	48 98                	cltq
+  804121:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804125:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804128:	48 98                	cltq
+  80412a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80412e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804133:	0f 85 5d ff ff ff    	jne    804096 <devfile_read+0x39>
+  }
+
+  return res0;
+  804139:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80413d:	c9                   	leave
+  80413e:	c3                   	ret
+
+000000000080413f <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80413f:	55                   	push   %rbp
+  804140:	48 89 e5             	mov    %rsp,%rbp
+  804143:	48 83 ec 50          	sub    $0x50,%rsp
+  804147:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80414b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80414f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804153:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804158:	74 07                	je     804161 <devfile_write+0x22>
+  80415a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80415f:	75 0a                	jne    80416b <devfile_write+0x2c>
+  return E_INVAL;
+  804161:	b8 03 00 00 00       	mov    $0x3,%eax
+  804166:	e9 c9 00 00 00       	jmp    804234 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80416b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804172:	00 
+
+  while (n) {
+  804173:	e9 ad 00 00 00       	jmp    804225 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804178:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80417c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804180:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804187:	00 
+  804188:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80418c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804190:	48 39 c2             	cmp    %rax,%rdx
+  804193:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804197:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80419b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80419f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041a3:	48 89 c6             	mov    %rax,%rsi
+  8041a6:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8041ad:	00 00 00 
+  8041b0:	48 89 c7             	mov    %rax,%rdi
+  8041b3:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  8041ba:	00 00 00 
+  8041bd:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8041bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041c3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041c6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8041cd:	00 00 00 
+  8041d0:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8041d2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8041d9:	00 00 00 
+  8041dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e0:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8041e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8041e9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8041ee:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8041f5:	00 00 00 
+  8041f8:	ff d0                	call   *%rax
+  8041fa:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8041fd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804201:	79 07                	jns    80420a <devfile_write+0xcb>
+      return res;
+  804203:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804206:	48 98                	cltq
+  804208:	eb 2a                	jmp    804234 <devfile_write+0xf5>
+
+    buf += res;
+  80420a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80420d:	48 98                	cltq
+  80420f:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804213:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804216:	48 98                	cltq
+  804218:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80421c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80421f:	48 98                	cltq
+  804221:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804225:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80422a:	0f 85 48 ff ff ff    	jne    804178 <devfile_write+0x39>
+  }
+
+  return res0;
+  804230:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804234:	c9                   	leave
+  804235:	c3                   	ret
+
+0000000000804236 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804236:	55                   	push   %rbp
+  804237:	48 89 e5             	mov    %rsp,%rbp
+  80423a:	48 83 ec 20          	sub    $0x20,%rsp
+  80423e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804242:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80424a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80424d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804254:	00 00 00 
+  804257:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804259:	be 00 00 00 00       	mov    $0x0,%esi
+  80425e:	bf 05 00 00 00       	mov    $0x5,%edi
+  804263:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+  80426f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804272:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804276:	79 05                	jns    80427d <devfile_stat+0x47>
+    return r;
+  804278:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80427b:	eb 59                	jmp    8042d6 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80427d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804281:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804288:	00 00 00 
+  80428b:	48 89 d6             	mov    %rdx,%rsi
+  80428e:	48 89 c7             	mov    %rax,%rdi
+  804291:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  804298:	00 00 00 
+  80429b:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80429d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8042a4:	00 00 00 
+  8042a7:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8042ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042b1:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8042b7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8042be:	00 00 00 
+  8042c1:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8042c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042cb:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8042d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042d6:	c9                   	leave
+  8042d7:	c3                   	ret
+
+00000000008042d8 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8042d8:	55                   	push   %rbp
+  8042d9:	48 89 e5             	mov    %rsp,%rbp
+  8042dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8042e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8042e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042eb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042ee:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042f5:	00 00 00 
+  8042f8:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8042fa:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804301:	00 00 00 
+  804304:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804307:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80430a:	be 00 00 00 00       	mov    $0x0,%esi
+  80430f:	bf 02 00 00 00       	mov    $0x2,%edi
+  804314:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+}
+  804320:	c9                   	leave
+  804321:	c3                   	ret
+
+0000000000804322 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+  804326:	48 83 ec 18          	sub    $0x18,%rsp
+  80432a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80432e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804331:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804335:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804338:	83 e0 03             	and    $0x3,%eax
+}
+  80433b:	c9                   	leave
+  80433c:	c3                   	ret
+
+000000000080433d <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80433d:	55                   	push   %rbp
+  80433e:	48 89 e5             	mov    %rsp,%rbp
+  804341:	48 83 ec 10          	sub    $0x10,%rsp
+  804345:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804349:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80434d:	48 89 c7             	mov    %rax,%rdi
+  804350:	48 b8 bf 11 80 00 00 	movabs $0x8011bf,%rax
+  804357:	00 00 00 
+  80435a:	ff d0                	call   *%rax
+  80435c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804361:	7e 07                	jle    80436a <remove+0x2d>
+    return -E_BAD_PATH;
+  804363:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804368:	eb 36                	jmp    8043a0 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  80436a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80436e:	48 89 c6             	mov    %rax,%rsi
+  804371:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804378:	00 00 00 
+  80437b:	48 89 c7             	mov    %rax,%rdi
+  80437e:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  804385:	00 00 00 
+  804388:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  80438a:	be 00 00 00 00       	mov    $0x0,%esi
+  80438f:	bf 07 00 00 00       	mov    $0x7,%edi
+  804394:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80439b:	00 00 00 
+  80439e:	ff d0                	call   *%rax
+}
+  8043a0:	c9                   	leave
+  8043a1:	c3                   	ret
+
+00000000008043a2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8043a2:	55                   	push   %rbp
+  8043a3:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8043a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8043ab:	bf 08 00 00 00       	mov    $0x8,%edi
+  8043b0:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+}
+  8043bc:	5d                   	pop    %rbp
+  8043bd:	c3                   	ret
+
+00000000008043be <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8043be:	55                   	push   %rbp
+  8043bf:	48 89 e5             	mov    %rsp,%rbp
+  8043c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8043c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8043ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8043cf:	bf 09 00 00 00       	mov    $0x9,%edi
+  8043d4:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  8043db:	00 00 00 
+  8043de:	ff d0                	call   *%rax
+  8043e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043e7:	79 05                	jns    8043ee <fs_stats+0x30>
+    return r;
+  8043e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043ec:	eb 2a                	jmp    804418 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8043ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043f2:	ba 68 00 00 00       	mov    $0x68,%edx
+  8043f7:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8043fe:	00 00 00 
+  804401:	48 89 ce             	mov    %rcx,%rsi
+  804404:	48 89 c7             	mov    %rax,%rdi
+  804407:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  80440e:	00 00 00 
+  804411:	ff d0                	call   *%rax
+  return 0;
+  804413:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804418:	c9                   	leave
+  804419:	c3                   	ret
+
+000000000080441a <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80441a:	55                   	push   %rbp
+  80441b:	48 89 e5             	mov    %rsp,%rbp
+  80441e:	48 83 ec 10          	sub    $0x10,%rsp
+  804422:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804425:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80442c:	00 00 00 
+  80442f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804432:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804434:	be 00 00 00 00       	mov    $0x0,%esi
+  804439:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80443e:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  804445:	00 00 00 
+  804448:	ff d0                	call   *%rax
+}
+  80444a:	c9                   	leave
+  80444b:	c3                   	ret
+
+000000000080444c <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  80444c:	55                   	push   %rbp
+  80444d:	48 89 e5             	mov    %rsp,%rbp
+  804450:	48 83 ec 10          	sub    $0x10,%rsp
+  804454:	89 f8                	mov    %edi,%eax
+  804456:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804459:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  80445d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804464:	00 00 00 
+  804467:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804469:	be 00 00 00 00       	mov    $0x0,%esi
+  80446e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804473:	48 b8 c2 3e 80 00 00 	movabs $0x803ec2,%rax
+  80447a:	00 00 00 
+  80447d:	ff d0                	call   *%rax
+}
+  80447f:	c9                   	leave
+  804480:	c3                   	ret
+
+0000000000804481 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804481:	55                   	push   %rbp
+  804482:	48 89 e5             	mov    %rsp,%rbp
+  804485:	48 83 ec 10          	sub    $0x10,%rsp
+  804489:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  80448d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804491:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804496:	48 89 c7             	mov    %rax,%rdi
+  804499:	48 b8 a7 44 80 00 00 	movabs $0x8044a7,%rax
+  8044a0:	00 00 00 
+  8044a3:	ff d0                	call   *%rax
+}
+  8044a5:	c9                   	leave
+  8044a6:	c3                   	ret
+
+00000000008044a7 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8044a7:	55                   	push   %rbp
+  8044a8:	48 89 e5             	mov    %rsp,%rbp
+  8044ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8044af:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8044b3:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8044b7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8044be:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8044bf:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8044c4:	74 0a                	je     8044d0 <pipe_size+0x29>
+  8044c6:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8044cd:	00 
+  8044ce:	76 0a                	jbe    8044da <pipe_size+0x33>
+    return -E_INVAL;
+  8044d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044d5:	e9 cc 02 00 00       	jmp    8047a6 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8044da:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8044de:	48 89 c7             	mov    %rax,%rdi
+  8044e1:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  8044e8:	00 00 00 
+  8044eb:	ff d0                	call   *%rax
+  8044ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044f4:	0f 88 a8 02 00 00    	js     8047a2 <pipe_size+0x2fb>
+  8044fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044fe:	ba 07 04 00 00       	mov    $0x407,%edx
+  804503:	48 89 c6             	mov    %rax,%rsi
+  804506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450b:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  804512:	00 00 00 
+  804515:	ff d0                	call   *%rax
+  804517:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80451a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80451e:	0f 88 7e 02 00 00    	js     8047a2 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804524:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804528:	48 89 c7             	mov    %rax,%rdi
+  80452b:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  804532:	00 00 00 
+  804535:	ff d0                	call   *%rax
+  804537:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80453a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80453e:	0f 88 43 02 00 00    	js     804787 <pipe_size+0x2e0>
+  804544:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804548:	ba 07 04 00 00       	mov    $0x407,%edx
+  80454d:	48 89 c6             	mov    %rax,%rsi
+  804550:	bf 00 00 00 00       	mov    $0x0,%edi
+  804555:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+  804561:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804564:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804568:	0f 88 19 02 00 00    	js     804787 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80456e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804572:	48 89 c7             	mov    %rax,%rdi
+  804575:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  80457c:	00 00 00 
+  80457f:	ff d0                	call   *%rax
+  804581:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804585:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80458c:	00 
+  80458d:	e9 a2 00 00 00       	jmp    804634 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804592:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804596:	48 c1 e0 0c          	shl    $0xc,%rax
+  80459a:	48 89 c2             	mov    %rax,%rdx
+  80459d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045a1:	48 01 d0             	add    %rdx,%rax
+  8045a4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8045a9:	48 89 c6             	mov    %rax,%rsi
+  8045ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045b1:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  8045b8:	00 00 00 
+  8045bb:	ff d0                	call   *%rax
+  8045bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045c4:	0f 88 37 01 00 00    	js     804701 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8045ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045ce:	48 89 c7             	mov    %rax,%rdi
+  8045d1:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8045d8:	00 00 00 
+  8045db:	ff d0                	call   *%rax
+  8045dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8045e1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8045e5:	48 01 c2             	add    %rax,%rdx
+  8045e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045ec:	48 c1 e0 0c          	shl    $0xc,%rax
+  8045f0:	48 89 c1             	mov    %rax,%rcx
+  8045f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045f7:	48 01 c8             	add    %rcx,%rax
+  8045fa:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804600:	48 89 d1             	mov    %rdx,%rcx
+  804603:	ba 00 00 00 00       	mov    $0x0,%edx
+  804608:	48 89 c6             	mov    %rax,%rsi
+  80460b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804610:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  804617:	00 00 00 
+  80461a:	ff d0                	call   *%rax
+  80461c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80461f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804623:	79 0a                	jns    80462f <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804625:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80462a:	e9 d3 00 00 00       	jmp    804702 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80462f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804634:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80463b:	00 
+  80463c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804640:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804644:	48 01 d0             	add    %rdx,%rax
+  804647:	48 83 c0 1f          	add    $0x1f,%rax
+  80464b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80464f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804653:	ba 00 00 00 00       	mov    $0x0,%edx
+  804658:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80465c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804660:	48 29 d0             	sub    %rdx,%rax
+  804663:	48 c1 e8 0c          	shr    $0xc,%rax
+  804667:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80466b:	0f 82 21 ff ff ff    	jb     804592 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804671:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804675:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804679:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80467d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804681:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804685:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804689:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804690:	00 00 00 
+  804693:	8b 12                	mov    (%rdx),%edx
+  804695:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804697:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80469b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8046a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046a6:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8046ad:	00 00 00 
+  8046b0:	8b 12                	mov    (%rdx),%edx
+  8046b2:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8046b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046b8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8046bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046c3:	48 89 c7             	mov    %rax,%rdi
+  8046c6:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  8046cd:	00 00 00 
+  8046d0:	ff d0                	call   *%rax
+  8046d2:	89 c2                	mov    %eax,%edx
+  8046d4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8046d8:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8046da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046de:	48 89 c7             	mov    %rax,%rdi
+  8046e1:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  8046e8:	00 00 00 
+  8046eb:	ff d0                	call   *%rax
+  8046ed:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8046f1:	48 83 c2 04          	add    $0x4,%rdx
+  8046f5:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8046f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fc:	e9 a5 00 00 00       	jmp    8047a6 <pipe_size+0x2ff>
+      goto err2;
+  804701:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804702:	eb 58                	jmp    80475c <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804704:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804708:	48 c1 e0 0c          	shl    $0xc,%rax
+  80470c:	48 89 c2             	mov    %rax,%rdx
+  80470f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804713:	48 01 d0             	add    %rdx,%rax
+  804716:	48 89 c6             	mov    %rax,%rsi
+  804719:	bf 00 00 00 00       	mov    $0x0,%edi
+  80471e:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804725:	00 00 00 
+  804728:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80472a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80472e:	48 89 c7             	mov    %rax,%rdi
+  804731:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804738:	00 00 00 
+  80473b:	ff d0                	call   *%rax
+  80473d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804741:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804745:	48 01 d0             	add    %rdx,%rax
+  804748:	48 89 c6             	mov    %rax,%rsi
+  80474b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804750:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804757:	00 00 00 
+  80475a:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80475c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804760:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804764:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804768:	48 85 c0             	test   %rax,%rax
+  80476b:	75 97                	jne    804704 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  80476d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804771:	48 89 c6             	mov    %rax,%rsi
+  804774:	bf 00 00 00 00       	mov    $0x0,%edi
+  804779:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804780:	00 00 00 
+  804783:	ff d0                	call   *%rax
+  804785:	eb 01                	jmp    804788 <pipe_size+0x2e1>
+    goto err1;
+  804787:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804788:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80478c:	48 89 c6             	mov    %rax,%rsi
+  80478f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804794:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  80479b:	00 00 00 
+  80479e:	ff d0                	call   *%rax
+  8047a0:	eb 01                	jmp    8047a3 <pipe_size+0x2fc>
+    goto err;
+  8047a2:	90                   	nop
+err:
+  return r;
+  8047a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8047a6:	c9                   	leave
+  8047a7:	c3                   	ret
+
+00000000008047a8 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8047a8:	55                   	push   %rbp
+  8047a9:	48 89 e5             	mov    %rsp,%rbp
+  8047ac:	53                   	push   %rbx
+  8047ad:	48 83 ec 28          	sub    $0x28,%rsp
+  8047b1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8047b5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8047b9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8047c0:	00 00 00 
+  8047c3:	8b 40 04             	mov    0x4(%rax),%eax
+  8047c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8047cb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8047d2:	00 00 00 
+  8047d5:	48 98                	cltq
+  8047d7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8047de:	48 01 d0             	add    %rdx,%rax
+  8047e1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8047e7:	8b 00                	mov    (%rax),%eax
+  8047e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8047ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047f0:	48 89 c7             	mov    %rax,%rdi
+  8047f3:	48 b8 58 5d 80 00 00 	movabs $0x805d58,%rax
+  8047fa:	00 00 00 
+  8047fd:	ff d0                	call   *%rax
+  8047ff:	89 c3                	mov    %eax,%ebx
+  804801:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804805:	48 89 c7             	mov    %rax,%rdi
+  804808:	48 b8 58 5d 80 00 00 	movabs $0x805d58,%rax
+  80480f:	00 00 00 
+  804812:	ff d0                	call   *%rax
+  804814:	39 c3                	cmp    %eax,%ebx
+  804816:	0f 94 c0             	sete   %al
+  804819:	0f b6 c0             	movzbl %al,%eax
+  80481c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80481f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804826:	00 00 00 
+  804829:	8b 40 04             	mov    0x4(%rax),%eax
+  80482c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804831:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804838:	00 00 00 
+  80483b:	48 98                	cltq
+  80483d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804844:	48 01 d0             	add    %rdx,%rax
+  804847:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80484d:	8b 00                	mov    (%rax),%eax
+  80484f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804852:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804855:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804858:	75 05                	jne    80485f <_pipeisclosed+0xb7>
+      return ret;
+  80485a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80485d:	eb 68                	jmp    8048c7 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80485f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804862:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804865:	0f 84 4e ff ff ff    	je     8047b9 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80486b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804872:	00 00 00 
+  804875:	8b 40 04             	mov    0x4(%rax),%eax
+  804878:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80487d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804884:	00 00 00 
+  804887:	48 98                	cltq
+  804889:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804890:	48 01 d0             	add    %rdx,%rax
+  804893:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804899:	8b 10                	mov    (%rax),%edx
+  80489b:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80489e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a1:	89 c6                	mov    %eax,%esi
+  8048a3:	48 b8 b0 6b 80 00 00 	movabs $0x806bb0,%rax
+  8048aa:	00 00 00 
+  8048ad:	48 89 c7             	mov    %rax,%rdi
+  8048b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048b5:	49 b8 10 03 80 00 00 	movabs $0x800310,%r8
+  8048bc:	00 00 00 
+  8048bf:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8048c2:	e9 f2 fe ff ff       	jmp    8047b9 <_pipeisclosed+0x11>
+  }
+}
+  8048c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8048cb:	c9                   	leave
+  8048cc:	c3                   	ret
+
+00000000008048cd <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8048cd:	55                   	push   %rbp
+  8048ce:	48 89 e5             	mov    %rsp,%rbp
+  8048d1:	48 83 ec 30          	sub    $0x30,%rsp
+  8048d5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8048d8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8048dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048df:	48 89 d6             	mov    %rdx,%rsi
+  8048e2:	89 c7                	mov    %eax,%edi
+  8048e4:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  8048eb:	00 00 00 
+  8048ee:	ff d0                	call   *%rax
+  8048f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048f7:	79 05                	jns    8048fe <pipeisclosed+0x31>
+    return r;
+  8048f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048fc:	eb 31                	jmp    80492f <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8048fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804902:	48 89 c7             	mov    %rax,%rdi
+  804905:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  80490c:	00 00 00 
+  80490f:	ff d0                	call   *%rax
+  804911:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804915:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804919:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80491d:	48 89 d6             	mov    %rdx,%rsi
+  804920:	48 89 c7             	mov    %rax,%rdi
+  804923:	48 b8 a8 47 80 00 00 	movabs $0x8047a8,%rax
+  80492a:	00 00 00 
+  80492d:	ff d0                	call   *%rax
+}
+  80492f:	c9                   	leave
+  804930:	c3                   	ret
+
+0000000000804931 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804931:	55                   	push   %rbp
+  804932:	48 89 e5             	mov    %rsp,%rbp
+  804935:	48 83 ec 10          	sub    $0x10,%rsp
+  804939:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80493d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804941:	8b 40 18             	mov    0x18(%rax),%eax
+  804944:	8d 50 01             	lea    0x1(%rax),%edx
+  804947:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80494b:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80494e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804952:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804955:	85 c0                	test   %eax,%eax
+  804957:	74 27                	je     804980 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804959:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495d:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804968:	48 83 c0 18          	add    $0x18,%rax
+  80496c:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804971:	48 89 c7             	mov    %rax,%rdi
+  804974:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  80497b:	00 00 00 
+  80497e:	ff d0                	call   *%rax
+  }
+}
+  804980:	90                   	nop
+  804981:	c9                   	leave
+  804982:	c3                   	ret
+
+0000000000804983 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804983:	55                   	push   %rbp
+  804984:	48 89 e5             	mov    %rsp,%rbp
+  804987:	48 83 ec 10          	sub    $0x10,%rsp
+  80498b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80498f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804992:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804996:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80499d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049a1:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8049a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049a8:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8049af:	89 c6                	mov    %eax,%esi
+  8049b1:	48 89 cf             	mov    %rcx,%rdi
+  8049b4:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  8049bb:	00 00 00 
+  8049be:	ff d0                	call   *%rax
+}
+  8049c0:	90                   	nop
+  8049c1:	c9                   	leave
+  8049c2:	c3                   	ret
+
+00000000008049c3 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8049c3:	55                   	push   %rbp
+  8049c4:	48 89 e5             	mov    %rsp,%rbp
+  8049c7:	48 83 ec 70          	sub    $0x70,%rsp
+  8049cb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8049cf:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8049d3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8049d7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8049db:	48 89 c7             	mov    %rax,%rdi
+  8049de:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8049e5:	00 00 00 
+  8049e8:	ff d0                	call   *%rax
+  8049ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8049ee:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8049f3:	75 0a                	jne    8049ff <devpipe_read+0x3c>
+    return 0;
+  8049f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049fa:	e9 63 01 00 00       	jmp    804b62 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8049ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a03:	8b 40 18             	mov    0x18(%rax),%eax
+  804a06:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a0d:	48 8b 10             	mov    (%rax),%rdx
+  804a10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a14:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a18:	48 39 c2             	cmp    %rax,%rdx
+  804a1b:	75 42                	jne    804a5f <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804a1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a25:	48 89 d6             	mov    %rdx,%rsi
+  804a28:	48 89 c7             	mov    %rax,%rdi
+  804a2b:	48 b8 a8 47 80 00 00 	movabs $0x8047a8,%rax
+  804a32:	00 00 00 
+  804a35:	ff d0                	call   *%rax
+  804a37:	85 c0                	test   %eax,%eax
+  804a39:	74 0a                	je     804a45 <devpipe_read+0x82>
+      return 0;
+  804a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a40:	e9 1d 01 00 00       	jmp    804b62 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804a45:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804a48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a4c:	89 d6                	mov    %edx,%esi
+  804a4e:	48 89 c7             	mov    %rax,%rdi
+  804a51:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  804a58:	00 00 00 
+  804a5b:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804a5d:	eb a0                	jmp    8049ff <devpipe_read+0x3c>
+      break;
+  804a5f:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804a60:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804a64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804a68:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804a6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804a70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a74:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a7c:	48 8b 00             	mov    (%rax),%rax
+  804a7f:	48 29 c2             	sub    %rax,%rdx
+  804a82:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804a86:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a8e:	48 39 c2             	cmp    %rax,%rdx
+  804a91:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a95:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a9d:	48 8b 00             	mov    (%rax),%rax
+  804aa0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804aa4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804aa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804aad:	48 f7 f1             	div    %rcx
+  804ab0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804ab4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ab8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ac0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ac4:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804ac8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804acc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ad0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ad4:	48 39 c2             	cmp    %rax,%rdx
+  804ad7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804adb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804adf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ae3:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804ae7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aeb:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804aef:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804af3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804af7:	48 89 ce             	mov    %rcx,%rsi
+  804afa:	48 89 c7             	mov    %rax,%rdi
+  804afd:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  804b04:	00 00 00 
+  804b07:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804b09:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804b0d:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804b11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b15:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804b19:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804b1d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b21:	48 01 d1             	add    %rdx,%rcx
+  804b24:	48 89 c2             	mov    %rax,%rdx
+  804b27:	48 89 cf             	mov    %rcx,%rdi
+  804b2a:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  804b31:	00 00 00 
+  804b34:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804b36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b3a:	48 8b 10             	mov    (%rax),%rdx
+  804b3d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804b41:	48 01 c2             	add    %rax,%rdx
+  804b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b48:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804b4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b4f:	48 89 c7             	mov    %rax,%rdi
+  804b52:	48 b8 31 49 80 00 00 	movabs $0x804931,%rax
+  804b59:	00 00 00 
+  804b5c:	ff d0                	call   *%rax
+  return n;
+  804b5e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804b62:	c9                   	leave
+  804b63:	c3                   	ret
+
+0000000000804b64 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804b64:	55                   	push   %rbp
+  804b65:	48 89 e5             	mov    %rsp,%rbp
+  804b68:	48 83 ec 70          	sub    $0x70,%rsp
+  804b6c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804b70:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804b74:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804b78:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804b7c:	48 89 c7             	mov    %rax,%rdi
+  804b7f:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804b86:	00 00 00 
+  804b89:	ff d0                	call   *%rax
+  804b8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804b8f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804b93:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804b97:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804b9e:	00 
+  804b9f:	e9 b8 01 00 00       	jmp    804d5c <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba8:	8b 40 18             	mov    0x18(%rax),%eax
+  804bab:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804bae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804bb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bba:	48 8b 00             	mov    (%rax),%rax
+  804bbd:	48 29 c2             	sub    %rax,%rdx
+  804bc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bc4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804bc8:	48 39 c2             	cmp    %rax,%rdx
+  804bcb:	75 4d                	jne    804c1a <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804bcd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bd1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804bd5:	48 89 d6             	mov    %rdx,%rsi
+  804bd8:	48 89 c7             	mov    %rax,%rdi
+  804bdb:	48 b8 a8 47 80 00 00 	movabs $0x8047a8,%rax
+  804be2:	00 00 00 
+  804be5:	ff d0                	call   *%rax
+  804be7:	85 c0                	test   %eax,%eax
+  804be9:	74 0a                	je     804bf5 <devpipe_write+0x91>
+        return 0;
+  804beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf0:	e9 79 01 00 00       	jmp    804d6e <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804bf5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804bf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bfc:	89 d6                	mov    %edx,%esi
+  804bfe:	48 89 c7             	mov    %rax,%rdi
+  804c01:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  804c08:	00 00 00 
+  804c0b:	ff d0                	call   *%rax
+      m = 0;
+  804c0d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804c14:	00 
+      continue;
+  804c15:	e9 3a 01 00 00       	jmp    804d54 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804c1a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804c1e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804c22:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804c26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c2a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c32:	48 8b 08             	mov    (%rax),%rcx
+  804c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c39:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c3d:	48 29 c1             	sub    %rax,%rcx
+  804c40:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804c44:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804c48:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804c4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c50:	48 39 c2             	cmp    %rax,%rdx
+  804c53:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804c57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804c5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c5f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c63:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c67:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804c6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c70:	48 f7 f1             	div    %rcx
+  804c73:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804c77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c7b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804c7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c83:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804c87:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804c8b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804c8f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c93:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c97:	48 39 c2             	cmp    %rax,%rdx
+  804c9a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804c9e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804ca2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ca6:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804caa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804cae:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804cb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804cb6:	48 01 d1             	add    %rdx,%rcx
+  804cb9:	48 89 c2             	mov    %rax,%rdx
+  804cbc:	48 89 cf             	mov    %rcx,%rdi
+  804cbf:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  804cc6:	00 00 00 
+  804cc9:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804ccb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ccf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cd3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804cd7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804cdb:	73 4d                	jae    804d2a <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804cdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ce1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ce5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804ce9:	48 29 c2             	sub    %rax,%rdx
+  804cec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cf0:	48 01 c2             	add    %rax,%rdx
+  804cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cfb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804cff:	48 89 c1             	mov    %rax,%rcx
+  804d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d06:	48 01 c1             	add    %rax,%rcx
+  804d09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d0d:	48 01 c1             	add    %rax,%rcx
+  804d10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d14:	48 83 c0 20          	add    $0x20,%rax
+  804d18:	48 89 ce             	mov    %rcx,%rsi
+  804d1b:	48 89 c7             	mov    %rax,%rdi
+  804d1e:	48 b8 09 1a 80 00 00 	movabs $0x801a09,%rax
+  804d25:	00 00 00 
+  804d28:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804d2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d2e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d36:	48 01 c2             	add    %rax,%rdx
+  804d39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d45:	48 89 c7             	mov    %rax,%rdi
+  804d48:	48 b8 31 49 80 00 00 	movabs $0x804931,%rax
+  804d4f:	00 00 00 
+  804d52:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d58:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804d5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d60:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804d64:	0f 82 3a fe ff ff    	jb     804ba4 <devpipe_write+0x40>
+  }
+
+  return i;
+  804d6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804d6e:	c9                   	leave
+  804d6f:	c3                   	ret
+
+0000000000804d70 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804d70:	55                   	push   %rbp
+  804d71:	48 89 e5             	mov    %rsp,%rbp
+  804d74:	48 83 ec 40          	sub    $0x40,%rsp
+  804d78:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804d7c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804d7f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d87:	48 89 c7             	mov    %rax,%rdi
+  804d8a:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804d91:	00 00 00 
+  804d94:	ff d0                	call   *%rax
+  804d96:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804d9a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804da5:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804da9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dad:	48 89 d6             	mov    %rdx,%rsi
+  804db0:	48 89 c7             	mov    %rax,%rdi
+  804db3:	48 b8 4b 3a 80 00 00 	movabs $0x803a4b,%rax
+  804dba:	00 00 00 
+  804dbd:	ff d0                	call   *%rax
+  804dbf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dc6:	79 08                	jns    804dd0 <devpipe_poll+0x60>
+    return r;
+  804dc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dcb:	e9 85 00 00 00       	jmp    804e55 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804dd0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804dd3:	83 e0 01             	and    $0x1,%eax
+  804dd6:	85 c0                	test   %eax,%eax
+  804dd8:	74 18                	je     804df2 <devpipe_poll+0x82>
+  804dda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dde:	48 8b 10             	mov    (%rax),%rdx
+  804de1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804de5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804de9:	48 39 c2             	cmp    %rax,%rdx
+  804dec:	74 04                	je     804df2 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804dee:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804df2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804df5:	83 e0 02             	and    $0x2,%eax
+  804df8:	85 c0                	test   %eax,%eax
+  804dfa:	74 23                	je     804e1f <devpipe_poll+0xaf>
+  804dfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e00:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e08:	48 8b 00             	mov    (%rax),%rax
+  804e0b:	48 29 c2             	sub    %rax,%rdx
+  804e0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e16:	48 39 c2             	cmp    %rax,%rdx
+  804e19:	73 04                	jae    804e1f <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804e1b:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804e1f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e27:	48 89 d6             	mov    %rdx,%rsi
+  804e2a:	48 89 c7             	mov    %rax,%rdi
+  804e2d:	48 b8 a8 47 80 00 00 	movabs $0x8047a8,%rax
+  804e34:	00 00 00 
+  804e37:	ff d0                	call   *%rax
+  804e39:	85 c0                	test   %eax,%eax
+  804e3b:	74 04                	je     804e41 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804e3d:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804e41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e45:	75 0b                	jne    804e52 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804e47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e4b:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804e52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804e55:	c9                   	leave
+  804e56:	c3                   	ret
+
+0000000000804e57 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804e57:	55                   	push   %rbp
+  804e58:	48 89 e5             	mov    %rsp,%rbp
+  804e5b:	48 83 ec 20          	sub    $0x20,%rsp
+  804e5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804e67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e6b:	48 89 c7             	mov    %rax,%rdi
+  804e6e:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804e75:	00 00 00 
+  804e78:	ff d0                	call   *%rax
+  804e7a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804e7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e82:	48 ba e1 6b 80 00 00 	movabs $0x806be1,%rdx
+  804e89:	00 00 00 
+  804e8c:	48 89 d6             	mov    %rdx,%rsi
+  804e8f:	48 89 c7             	mov    %rax,%rdi
+  804e92:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  804e99:	00 00 00 
+  804e9c:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804e9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ea2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ea6:	89 c1                	mov    %eax,%ecx
+  804ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eac:	48 8b 00             	mov    (%rax),%rax
+  804eaf:	89 c2                	mov    %eax,%edx
+  804eb1:	89 c8                	mov    %ecx,%eax
+  804eb3:	29 d0                	sub    %edx,%eax
+  804eb5:	89 c2                	mov    %eax,%edx
+  804eb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ebb:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804ec1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804ecc:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ed3:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  804eda:	00 00 00 
+  804edd:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ee9:	c9                   	leave
+  804eea:	c3                   	ret
+
+0000000000804eeb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804eeb:	55                   	push   %rbp
+  804eec:	48 89 e5             	mov    %rsp,%rbp
+  804eef:	48 83 ec 40          	sub    $0x40,%rsp
+  804ef3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ef7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804efb:	48 89 c7             	mov    %rax,%rdi
+  804efe:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804f05:	00 00 00 
+  804f08:	ff d0                	call   *%rax
+  804f0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804f0e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804f15:	00 
+  804f16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f1a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f22:	48 01 d0             	add    %rdx,%rax
+  804f25:	48 83 c0 1f          	add    $0x1f,%rax
+  804f29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f36:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804f3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f3e:	48 29 d0             	sub    %rdx,%rax
+  804f41:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f45:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804f49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f4d:	48 89 c6             	mov    %rax,%rsi
+  804f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f55:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804f5c:	00 00 00 
+  804f5f:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804f61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f65:	48 89 c7             	mov    %rax,%rdi
+  804f68:	48 b8 31 49 80 00 00 	movabs $0x804931,%rax
+  804f6f:	00 00 00 
+  804f72:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804f74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f78:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804f7c:	eb 2f                	jmp    804fad <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804f7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f82:	48 83 e8 01          	sub    $0x1,%rax
+  804f86:	48 c1 e0 0c          	shl    $0xc,%rax
+  804f8a:	48 89 c2             	mov    %rax,%rdx
+  804f8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f91:	48 01 d0             	add    %rdx,%rax
+  804f94:	48 89 c6             	mov    %rax,%rsi
+  804f97:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f9c:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804fa3:	00 00 00 
+  804fa6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804fa8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804fad:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804fb2:	77 ca                	ja     804f7e <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804fb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fb8:	48 89 c6             	mov    %rax,%rsi
+  804fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fc0:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804fc7:	00 00 00 
+  804fca:	ff d0                	call   *%rax
+}
+  804fcc:	c9                   	leave
+  804fcd:	c3                   	ret
+
+0000000000804fce <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  804fce:	55                   	push   %rbp
+  804fcf:	48 89 e5             	mov    %rsp,%rbp
+  804fd2:	48 83 ec 10          	sub    $0x10,%rsp
+  804fd6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fda:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  804fde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fe2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fe6:	48 89 c7             	mov    %rax,%rdi
+  804fe9:	ff d2                	call   *%rdx
+  thread_exit(0);
+  804feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff0:	48 b8 32 52 80 00 00 	movabs $0x805232,%rax
+  804ff7:	00 00 00 
+  804ffa:	ff d0                	call   *%rax
+}
+  804ffc:	90                   	nop
+  804ffd:	c9                   	leave
+  804ffe:	c3                   	ret
+
+0000000000804fff <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  804fff:	55                   	push   %rbp
+  805000:	48 89 e5             	mov    %rsp,%rbp
+  805003:	48 83 ec 20          	sub    $0x20,%rsp
+  805007:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  80500a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80500d:	c1 e0 10             	shl    $0x10,%eax
+  805010:	48 98                	cltq
+  805012:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805017:	48 01 d0             	add    %rdx,%rax
+  80501a:	48 89 c6             	mov    %rax,%rsi
+  80501d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805022:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  805029:	00 00 00 
+  80502c:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80502e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805031:	83 c0 01             	add    $0x1,%eax
+  805034:	c1 e0 10             	shl    $0x10,%eax
+  805037:	48 98                	cltq
+  805039:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80503e:	48 01 d0             	add    %rdx,%rax
+  805041:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805045:	eb 20                	jmp    805067 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805047:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80504b:	48 89 c6             	mov    %rax,%rsi
+  80504e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805053:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  80505a:	00 00 00 
+  80505d:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80505f:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805066:	00 
+  805067:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80506a:	83 c0 01             	add    $0x1,%eax
+  80506d:	c1 e0 10             	shl    $0x10,%eax
+  805070:	48 98                	cltq
+  805072:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805077:	48 01 d0             	add    %rdx,%rax
+  80507a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80507e:	72 c7                	jb     805047 <slot_unmap+0x48>
+}
+  805080:	90                   	nop
+  805081:	90                   	nop
+  805082:	c9                   	leave
+  805083:	c3                   	ret
+
+0000000000805084 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805084:	55                   	push   %rbp
+  805085:	48 89 e5             	mov    %rsp,%rbp
+  805088:	48 83 ec 30          	sub    $0x30,%rsp
+  80508c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805090:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805094:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80509b:	00 00 00 
+  80509e:	48 89 c7             	mov    %rax,%rdi
+  8050a1:	48 b8 7b 5f 80 00 00 	movabs $0x805f7b,%rax
+  8050a8:	00 00 00 
+  8050ab:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8050ad:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8050b4:	eb 04                	jmp    8050ba <thread_create+0x36>
+  8050b6:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8050ba:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8050be:	7f 16                	jg     8050d6 <thread_create+0x52>
+  8050c0:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8050c7:	00 00 00 
+  8050ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050cd:	48 98                	cltq
+  8050cf:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8050d2:	85 c0                	test   %eax,%eax
+  8050d4:	75 e0                	jne    8050b6 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8050d6:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8050da:	75 0c                	jne    8050e8 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8050dc:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8050e3:	e9 2c 01 00 00       	jmp    805214 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8050e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050eb:	c1 e0 10             	shl    $0x10,%eax
+  8050ee:	48 98                	cltq
+  8050f0:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8050f5:	48 01 d0             	add    %rdx,%rax
+  8050f8:	ba 07 00 00 00       	mov    $0x7,%edx
+  8050fd:	48 89 c6             	mov    %rax,%rsi
+  805100:	bf 00 00 00 00       	mov    $0x0,%edi
+  805105:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  80510c:	00 00 00 
+  80510f:	ff d0                	call   *%rax
+  805111:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805114:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805118:	0f 88 f5 00 00 00    	js     805213 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80511e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805121:	83 c0 01             	add    $0x1,%eax
+  805124:	c1 e0 10             	shl    $0x10,%eax
+  805127:	48 98                	cltq
+  805129:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80512e:	48 01 d0             	add    %rdx,%rax
+  805131:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805135:	eb 32                	jmp    805169 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805137:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80513b:	ba 07 00 00 00       	mov    $0x7,%edx
+  805140:	48 89 c6             	mov    %rax,%rsi
+  805143:	bf 00 00 00 00       	mov    $0x0,%edi
+  805148:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  80514f:	00 00 00 
+  805152:	ff d0                	call   *%rax
+  805154:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805157:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80515b:	0f 88 9e 00 00 00    	js     8051ff <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805161:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805168:	00 
+  805169:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80516c:	83 c0 01             	add    $0x1,%eax
+  80516f:	c1 e0 10             	shl    $0x10,%eax
+  805172:	48 98                	cltq
+  805174:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805179:	48 01 d0             	add    %rdx,%rax
+  80517c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805180:	72 b5                	jb     805137 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805182:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805186:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80518a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80518d:	c1 e2 10             	shl    $0x10,%edx
+  805190:	48 63 d2             	movslq %edx,%rdx
+  805193:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805198:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80519b:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80519e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8051a1:	83 c2 01             	add    $0x1,%edx
+  8051a4:	c1 e2 10             	shl    $0x10,%edx
+  8051a7:	48 63 d2             	movslq %edx,%rdx
+  8051aa:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8051af:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  8051b2:	48 bf ce 4f 80 00 00 	movabs $0x804fce,%rdi
+  8051b9:	00 00 00 
+  8051bc:	49 89 c8             	mov    %rcx,%r8
+  8051bf:	48 89 c1             	mov    %rax,%rcx
+  8051c2:	4c 89 ca             	mov    %r9,%rdx
+  8051c5:	48 b8 2e 25 80 00 00 	movabs $0x80252e,%rax
+  8051cc:	00 00 00 
+  8051cf:	ff d0                	call   *%rax
+  8051d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8051d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051d8:	79 08                	jns    8051e2 <thread_create+0x15e>
+    r = id;
+  8051da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051dd:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8051e0:	eb 1e                	jmp    805200 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8051e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051e5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8051e8:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8051ef:	00 00 00 
+  8051f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8051f5:	48 98                	cltq
+  8051f7:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8051fa:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8051fd:	eb 15                	jmp    805214 <thread_create+0x190>
+      goto fail;
+  8051ff:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805200:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805203:	89 c7                	mov    %eax,%edi
+  805205:	48 b8 ff 4f 80 00 00 	movabs $0x804fff,%rax
+  80520c:	00 00 00 
+  80520f:	ff d0                	call   *%rax
+  805211:	eb 01                	jmp    805214 <thread_create+0x190>
+    goto out;
+  805213:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805214:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80521b:	00 00 00 
+  80521e:	48 89 c7             	mov    %rax,%rdi
+  805221:	48 b8 50 60 80 00 00 	movabs $0x806050,%rax
+  805228:	00 00 00 
+  80522b:	ff d0                	call   *%rax
+  return r;
+  80522d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805230:	c9                   	leave
+  805231:	c3                   	ret
+
+0000000000805232 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805232:	55                   	push   %rbp
+  805233:	48 89 e5             	mov    %rsp,%rbp
+  805236:	48 83 ec 10          	sub    $0x10,%rsp
+  80523a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  80523d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805240:	89 c7                	mov    %eax,%edi
+  805242:	48 b8 8b 25 80 00 00 	movabs $0x80258b,%rax
+  805249:	00 00 00 
+  80524c:	ff d0                	call   *%rax
+}
+  80524e:	90                   	nop
+  80524f:	c9                   	leave
+  805250:	c3                   	ret
+
+0000000000805251 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805251:	55                   	push   %rbp
+  805252:	48 89 e5             	mov    %rsp,%rbp
+  805255:	48 83 ec 20          	sub    $0x20,%rsp
+  805259:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80525c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805260:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805267:	00 00 00 
+  80526a:	48 89 c7             	mov    %rax,%rdi
+  80526d:	48 b8 7b 5f 80 00 00 	movabs $0x805f7b,%rax
+  805274:	00 00 00 
+  805277:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805279:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805280:	eb 04                	jmp    805286 <thread_join+0x35>
+  805282:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805286:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80528a:	7f 17                	jg     8052a3 <thread_join+0x52>
+  80528c:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805293:	00 00 00 
+  805296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805299:	48 98                	cltq
+  80529b:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80529e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8052a1:	75 df                	jne    805282 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8052a3:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8052aa:	00 00 00 
+  8052ad:	48 89 c7             	mov    %rax,%rdi
+  8052b0:	48 b8 50 60 80 00 00 	movabs $0x806050,%rax
+  8052b7:	00 00 00 
+  8052ba:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8052bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052c0:	74 06                	je     8052c8 <thread_join+0x77>
+  8052c2:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8052c6:	75 07                	jne    8052cf <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8052c8:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8052cd:	eb 76                	jmp    805345 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8052cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d6:	48 89 d6             	mov    %rdx,%rsi
+  8052d9:	89 c7                	mov    %eax,%edi
+  8052db:	48 b8 6d 5e 80 00 00 	movabs $0x805e6d,%rax
+  8052e2:	00 00 00 
+  8052e5:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8052e7:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8052ee:	00 00 00 
+  8052f1:	48 89 c7             	mov    %rax,%rdi
+  8052f4:	48 b8 7b 5f 80 00 00 	movabs $0x805f7b,%rax
+  8052fb:	00 00 00 
+  8052fe:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805300:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805303:	89 c7                	mov    %eax,%edi
+  805305:	48 b8 ff 4f 80 00 00 	movabs $0x804fff,%rax
+  80530c:	00 00 00 
+  80530f:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805311:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805318:	00 00 00 
+  80531b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80531e:	48 98                	cltq
+  805320:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805327:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80532e:	00 00 00 
+  805331:	48 89 c7             	mov    %rax,%rdi
+  805334:	48 b8 50 60 80 00 00 	movabs $0x806050,%rax
+  80533b:	00 00 00 
+  80533e:	ff d0                	call   *%rax
+  return 0;
+  805340:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805345:	c9                   	leave
+  805346:	c3                   	ret
+
+0000000000805347 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805347:	55                   	push   %rbp
+  805348:	48 89 e5             	mov    %rsp,%rbp
+  80534b:	48 83 ec 08          	sub    $0x8,%rsp
+  80534f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805353:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805358:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80535c:	73 23                	jae    805381 <thread_is_uxstack+0x3a>
+  80535e:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805363:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805367:	72 18                	jb     805381 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80536d:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805372:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805378:	75 07                	jne    805381 <thread_is_uxstack+0x3a>
+  80537a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80537f:	eb 05                	jmp    805386 <thread_is_uxstack+0x3f>
+  805381:	b8 00 00 00 00       	mov    $0x0,%eax
+  805386:	83 e0 01             	and    $0x1,%eax
+}
+  805389:	c9                   	leave
+  80538a:	c3                   	ret
+
+000000000080538b <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80538b:	55                   	push   %rbp
+  80538c:	48 89 e5             	mov    %rsp,%rbp
+  80538f:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805393:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80539a:	00 00 00 
+  80539d:	8b 40 04             	mov    0x4(%rax),%eax
+  8053a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8053a5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8053ac:	00 00 00 
+  8053af:	48 98                	cltq
+  8053b1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8053b8:	48 01 d0             	add    %rdx,%rax
+  8053bb:	48 05 08 01 00 00    	add    $0x108,%rax
+  8053c1:	48 8b 00             	mov    (%rax),%rax
+  8053c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8053c8:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8053cd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8053d1:	73 0b                	jae    8053de <thread_pftemp+0x53>
+  8053d3:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8053d8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8053dc:	73 07                	jae    8053e5 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8053de:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8053e3:	eb 26                	jmp    80540b <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8053e5:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8053ec:	ff ff ff 
+  8053ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053f3:	48 01 d0             	add    %rdx,%rax
+  8053f6:	48 c1 e8 10          	shr    $0x10,%rax
+  8053fa:	48 83 c0 01          	add    $0x1,%rax
+  8053fe:	48 c1 e0 0c          	shl    $0xc,%rax
+  805402:	48 f7 d8             	neg    %rax
+  805405:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  80540b:	c9                   	leave
+  80540c:	c3                   	ret
+
+000000000080540d <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80540d:	55                   	push   %rbp
+  80540e:	48 89 e5             	mov    %rsp,%rbp
+  805411:	48 83 ec 08          	sub    $0x8,%rsp
+  805415:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805418:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80541c:	75 10                	jne    80542e <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80541e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805425:	00 00 00 
+  805428:	8b 00                	mov    (%rax),%eax
+  80542a:	48 98                	cltq
+  80542c:	eb 05                	jmp    805433 <vsyscall+0x26>
+  }
+  return 0;
+  80542e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805433:	c9                   	leave
+  805434:	c3                   	ret
+
+0000000000805435 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805435:	55                   	push   %rbp
+  805436:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805439:	bf 00 00 00 00       	mov    $0x0,%edi
+  80543e:	48 b8 0d 54 80 00 00 	movabs $0x80540d,%rax
+  805445:	00 00 00 
+  805448:	ff d0                	call   *%rax
+}
+  80544a:	5d                   	pop    %rbp
+  80544b:	c3                   	ret
+
+000000000080544c <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80544c:	55                   	push   %rbp
+  80544d:	48 89 e5             	mov    %rsp,%rbp
+  805450:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805454:	0f 31                	rdtsc
+  805456:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805459:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80545c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80545f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805462:	48 c1 e2 20          	shl    $0x20,%rdx
+  805466:	48 09 d0             	or     %rdx,%rax
+  805469:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80546d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805471:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805475:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80547c:	00 00 00 
+  80547f:	8b 40 08             	mov    0x8(%rax),%eax
+  805482:	48 98                	cltq
+  805484:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80548c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805491:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805495:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80549c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054a5:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8054a9:	48 89 d0             	mov    %rdx,%rax
+  8054ac:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8054b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054b8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8054bc:	48 01 c8             	add    %rcx,%rax
+}
+  8054bf:	c9                   	leave
+  8054c0:	c3                   	ret
+
+00000000008054c1 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8054c1:	55                   	push   %rbp
+  8054c2:	48 89 e5             	mov    %rsp,%rbp
+  8054c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8054c9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8054cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054cf:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8054d2:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8054d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8054db:	48 89 c7             	mov    %rax,%rdi
+  8054de:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  8054e5:	00 00 00 
+  8054e8:	ff d0                	call   *%rax
+}
+  8054ea:	90                   	nop
+  8054eb:	c9                   	leave
+  8054ec:	c3                   	ret
+
+00000000008054ed <getchar>:
+
+int
+getchar(void) {
+  8054ed:	55                   	push   %rbp
+  8054ee:	48 89 e5             	mov    %rsp,%rbp
+  8054f1:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8054f5:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8054f9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054fe:	48 89 c6             	mov    %rax,%rsi
+  805501:	bf 00 00 00 00       	mov    $0x0,%edi
+  805506:	48 b8 e1 35 80 00 00 	movabs $0x8035e1,%rax
+  80550d:	00 00 00 
+  805510:	ff d0                	call   *%rax
+  805512:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805515:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805519:	79 05                	jns    805520 <getchar+0x33>
+    return r;
+  80551b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80551e:	eb 14                	jmp    805534 <getchar+0x47>
+  if (r < 1)
+  805520:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805524:	7f 07                	jg     80552d <getchar+0x40>
+    return -E_EOF;
+  805526:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80552b:	eb 07                	jmp    805534 <getchar+0x47>
+  return c;
+  80552d:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805531:	0f b6 c0             	movzbl %al,%eax
+}
+  805534:	c9                   	leave
+  805535:	c3                   	ret
+
+0000000000805536 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805536:	55                   	push   %rbp
+  805537:	48 89 e5             	mov    %rsp,%rbp
+  80553a:	48 83 ec 20          	sub    $0x20,%rsp
+  80553e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805541:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805545:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805548:	48 89 d6             	mov    %rdx,%rsi
+  80554b:	89 c7                	mov    %eax,%edi
+  80554d:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  805554:	00 00 00 
+  805557:	ff d0                	call   *%rax
+  805559:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80555c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805560:	79 05                	jns    805567 <iscons+0x31>
+    return r;
+  805562:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805565:	eb 1a                	jmp    805581 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805567:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80556b:	8b 10                	mov    (%rax),%edx
+  80556d:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805574:	00 00 00 
+  805577:	8b 00                	mov    (%rax),%eax
+  805579:	39 c2                	cmp    %eax,%edx
+  80557b:	0f 94 c0             	sete   %al
+  80557e:	0f b6 c0             	movzbl %al,%eax
+}
+  805581:	c9                   	leave
+  805582:	c3                   	ret
+
+0000000000805583 <opencons>:
+
+int
+opencons(void) {
+  805583:	55                   	push   %rbp
+  805584:	48 89 e5             	mov    %rsp,%rbp
+  805587:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80558b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80558f:	48 89 c7             	mov    %rax,%rdi
+  805592:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+  80559e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055a5:	79 05                	jns    8055ac <opencons+0x29>
+    return r;
+  8055a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055aa:	eb 66                	jmp    805612 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8055ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055b0:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055b5:	48 89 c6             	mov    %rax,%rsi
+  8055b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055bd:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  8055c4:	00 00 00 
+  8055c7:	ff d0                	call   *%rax
+  8055c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055d0:	79 05                	jns    8055d7 <opencons+0x54>
+    return r;
+  8055d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055d5:	eb 3b                	jmp    805612 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8055d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055db:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8055e2:	00 00 00 
+  8055e5:	8b 12                	mov    (%rdx),%edx
+  8055e7:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8055e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055ed:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8055f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055f8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8055ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805603:	48 89 c7             	mov    %rax,%rdi
+  805606:	48 b8 55 2f 80 00 00 	movabs $0x802f55,%rax
+  80560d:	00 00 00 
+  805610:	ff d0                	call   *%rax
+}
+  805612:	c9                   	leave
+  805613:	c3                   	ret
+
+0000000000805614 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805614:	55                   	push   %rbp
+  805615:	48 89 e5             	mov    %rsp,%rbp
+  805618:	48 83 ec 20          	sub    $0x20,%rsp
+  80561c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80561f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805622:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805626:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805629:	48 89 d6             	mov    %rdx,%rsi
+  80562c:	89 c7                	mov    %eax,%edi
+  80562e:	48 b8 85 30 80 00 00 	movabs $0x803085,%rax
+  805635:	00 00 00 
+  805638:	ff d0                	call   *%rax
+  80563a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80563d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805641:	79 05                	jns    805648 <consmode+0x34>
+    return r;
+  805643:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805646:	eb 34                	jmp    80567c <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805648:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80564c:	8b 10                	mov    (%rax),%edx
+  80564e:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805655:	00 00 00 
+  805658:	8b 00                	mov    (%rax),%eax
+  80565a:	39 c2                	cmp    %eax,%edx
+  80565c:	74 07                	je     805665 <consmode+0x51>
+    return -E_INVAL;
+  80565e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805663:	eb 17                	jmp    80567c <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805665:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805669:	8b 40 0c             	mov    0xc(%rax),%eax
+  80566c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80566f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805673:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805676:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805679:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80567c:	c9                   	leave
+  80567d:	c3                   	ret
+
+000000000080567e <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80567e:	55                   	push   %rbp
+  80567f:	48 89 e5             	mov    %rsp,%rbp
+  805682:	48 83 ec 20          	sub    $0x20,%rsp
+  805686:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80568a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80568e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805692:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805696:	8b 50 0c             	mov    0xc(%rax),%edx
+  805699:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80569d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056a1:	48 89 ce             	mov    %rcx,%rsi
+  8056a4:	48 89 c7             	mov    %rax,%rdi
+  8056a7:	48 b8 e8 23 80 00 00 	movabs $0x8023e8,%rax
+  8056ae:	00 00 00 
+  8056b1:	ff d0                	call   *%rax
+  8056b3:	48 98                	cltq
+}
+  8056b5:	c9                   	leave
+  8056b6:	c3                   	ret
+
+00000000008056b7 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8056b7:	55                   	push   %rbp
+  8056b8:	48 89 e5             	mov    %rsp,%rbp
+  8056bb:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8056c2:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8056c9:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8056d0:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8056d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8056de:	eb 74                	jmp    805754 <devcons_write+0x9d>
+    m = n - tot;
+  8056e0:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8056e7:	89 c2                	mov    %eax,%edx
+  8056e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056ec:	29 c2                	sub    %eax,%edx
+  8056ee:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8056f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8056f4:	83 f8 7f             	cmp    $0x7f,%eax
+  8056f7:	76 07                	jbe    805700 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8056f9:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805700:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805703:	48 63 d0             	movslq %eax,%rdx
+  805706:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805709:	48 63 c8             	movslq %eax,%rcx
+  80570c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805713:	48 01 c1             	add    %rax,%rcx
+  805716:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80571d:	48 89 ce             	mov    %rcx,%rsi
+  805720:	48 89 c7             	mov    %rax,%rdi
+  805723:	48 b8 03 18 80 00 00 	movabs $0x801803,%rax
+  80572a:	00 00 00 
+  80572d:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80572f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805732:	48 63 d0             	movslq %eax,%rdx
+  805735:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80573c:	48 89 d6             	mov    %rdx,%rsi
+  80573f:	48 89 c7             	mov    %rax,%rdi
+  805742:	48 b8 77 1e 80 00 00 	movabs $0x801e77,%rax
+  805749:	00 00 00 
+  80574c:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80574e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805751:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805754:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805757:	48 98                	cltq
+  805759:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805760:	0f 82 7a ff ff ff    	jb     8056e0 <devcons_write+0x29>
+  }
+  return tot;
+  805766:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805769:	48 98                	cltq
+}
+  80576b:	c9                   	leave
+  80576c:	c3                   	ret
+
+000000000080576d <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80576d:	55                   	push   %rbp
+  80576e:	48 89 e5             	mov    %rsp,%rbp
+  805771:	48 83 ec 08          	sub    $0x8,%rsp
+  805775:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805779:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80577e:	c9                   	leave
+  80577f:	c3                   	ret
+
+0000000000805780 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805780:	55                   	push   %rbp
+  805781:	48 89 e5             	mov    %rsp,%rbp
+  805784:	48 83 ec 10          	sub    $0x10,%rsp
+  805788:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80578c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805794:	48 ba ed 6b 80 00 00 	movabs $0x806bed,%rdx
+  80579b:	00 00 00 
+  80579e:	48 89 d6             	mov    %rdx,%rsi
+  8057a1:	48 89 c7             	mov    %rax,%rdi
+  8057a4:	48 b8 c0 12 80 00 00 	movabs $0x8012c0,%rax
+  8057ab:	00 00 00 
+  8057ae:	ff d0                	call   *%rax
+  return 0;
+  8057b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b5:	c9                   	leave
+  8057b6:	c3                   	ret
+
+00000000008057b7 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8057b7:	55                   	push   %rbp
+  8057b8:	48 89 e5             	mov    %rsp,%rbp
+  8057bb:	48 83 ec 30          	sub    $0x30,%rsp
+  8057bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8057c3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8057c6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8057ca:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8057d1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8057d4:	83 e0 02             	and    $0x2,%eax
+  8057d7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8057da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057de:	8b 40 0c             	mov    0xc(%rax),%eax
+  8057e1:	83 f8 01             	cmp    $0x1,%eax
+  8057e4:	75 04                	jne    8057ea <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8057e6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8057ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8057ed:	83 e0 01             	and    $0x1,%eax
+  8057f0:	85 c0                	test   %eax,%eax
+  8057f2:	74 44                	je     805838 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8057f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8057fc:	89 c2                	mov    %eax,%edx
+  8057fe:	be 00 00 00 00       	mov    $0x0,%esi
+  805803:	bf 00 00 00 00       	mov    $0x0,%edi
+  805808:	48 b8 d6 24 80 00 00 	movabs $0x8024d6,%rax
+  80580f:	00 00 00 
+  805812:	ff d0                	call   *%rax
+  805814:	83 f8 01             	cmp    $0x1,%eax
+  805817:	75 06                	jne    80581f <devcons_poll+0x68>
+      revents |= POLLIN;
+  805819:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80581d:	eb 19                	jmp    805838 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80581f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805823:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805829:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80582c:	89 c2                	mov    %eax,%edx
+  80582e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805832:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805838:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80583b:	c9                   	leave
+  80583c:	c3                   	ret
+
+000000000080583d <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80583d:	55                   	push   %rbp
+  80583e:	48 89 e5             	mov    %rsp,%rbp
+  805841:	53                   	push   %rbx
+  805842:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805849:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  805850:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  805856:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80585d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  805864:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80586b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  805872:	84 c0                	test   %al,%al
+  805874:	74 23                	je     805899 <_panic+0x5c>
+  805876:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80587d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  805881:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  805885:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  805889:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80588d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  805891:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  805895:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  805899:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8058a0:	00 00 00 
+  8058a3:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8058aa:	00 00 00 
+  8058ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8058b1:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8058b8:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8058bf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8058c6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8058cd:	00 00 00 
+  8058d0:	48 8b 18             	mov    (%rax),%rbx
+  8058d3:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  8058da:	00 00 00 
+  8058dd:	ff d0                	call   *%rax
+  8058df:	89 c6                	mov    %eax,%esi
+  8058e1:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8058e7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8058ee:	41 89 d0             	mov    %edx,%r8d
+  8058f1:	48 89 c1             	mov    %rax,%rcx
+  8058f4:	48 89 da             	mov    %rbx,%rdx
+  8058f7:	48 b8 f8 6b 80 00 00 	movabs $0x806bf8,%rax
+  8058fe:	00 00 00 
+  805901:	48 89 c7             	mov    %rax,%rdi
+  805904:	b8 00 00 00 00       	mov    $0x0,%eax
+  805909:	49 b9 10 03 80 00 00 	movabs $0x800310,%r9
+  805910:	00 00 00 
+  805913:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  805916:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80591d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805924:	48 89 d6             	mov    %rdx,%rsi
+  805927:	48 89 c7             	mov    %rax,%rdi
+  80592a:	48 b8 85 02 80 00 00 	movabs $0x800285,%rax
+  805931:	00 00 00 
+  805934:	ff d0                	call   *%rax
+  cprintf("\n");
+  805936:	48 b8 1b 6c 80 00 00 	movabs $0x806c1b,%rax
+  80593d:	00 00 00 
+  805940:	48 89 c7             	mov    %rax,%rdi
+  805943:	b8 00 00 00 00       	mov    $0x0,%eax
+  805948:	48 ba 10 03 80 00 00 	movabs $0x800310,%rdx
+  80594f:	00 00 00 
+  805952:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805954:	cc                   	int3
+  805955:	eb fd                	jmp    805954 <_panic+0x117>
+
+0000000000805957 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805957:	55                   	push   %rbp
+  805958:	48 89 e5             	mov    %rsp,%rbp
+  80595b:	48 83 ec 20          	sub    $0x20,%rsp
+  80595f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805963:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  80596a:	00 00 00 
+  80596d:	ff d0                	call   *%rax
+  80596f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805972:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805979:	00 00 00 
+  80597c:	48 8b 00             	mov    (%rax),%rax
+  80597f:	48 85 c0             	test   %rax,%rax
+  805982:	75 62                	jne    8059e6 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805984:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805987:	ba 07 00 00 00       	mov    $0x7,%edx
+  80598c:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805993:	00 00 00 
+  805996:	48 89 ce             	mov    %rcx,%rsi
+  805999:	89 c7                	mov    %eax,%edi
+  80599b:	48 b8 8e 20 80 00 00 	movabs $0x80208e,%rax
+  8059a2:	00 00 00 
+  8059a5:	ff d0                	call   *%rax
+  8059a7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8059aa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8059ae:	79 36                	jns    8059e6 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8059b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059b3:	89 c1                	mov    %eax,%ecx
+  8059b5:	48 b8 1d 6c 80 00 00 	movabs $0x806c1d,%rax
+  8059bc:	00 00 00 
+  8059bf:	48 89 c2             	mov    %rax,%rdx
+  8059c2:	be 23 00 00 00       	mov    $0x23,%esi
+  8059c7:	48 b8 35 6c 80 00 00 	movabs $0x806c35,%rax
+  8059ce:	00 00 00 
+  8059d1:	48 89 c7             	mov    %rax,%rdi
+  8059d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059d9:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  8059e0:	00 00 00 
+  8059e3:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8059e6:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  8059ed:	00 00 00 
+  8059f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059f4:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  8059f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059fa:	48 ba 57 5a 80 00 00 	movabs $0x805a57,%rdx
+  805a01:	00 00 00 
+  805a04:	48 89 d6             	mov    %rdx,%rsi
+  805a07:	89 c7                	mov    %eax,%edi
+  805a09:	48 b8 2b 22 80 00 00 	movabs $0x80222b,%rax
+  805a10:	00 00 00 
+  805a13:	ff d0                	call   *%rax
+  805a15:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805a18:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805a1c:	79 36                	jns    805a54 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805a1e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a21:	89 c1                	mov    %eax,%ecx
+  805a23:	48 b8 1d 6c 80 00 00 	movabs $0x806c1d,%rax
+  805a2a:	00 00 00 
+  805a2d:	48 89 c2             	mov    %rax,%rdx
+  805a30:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805a35:	48 b8 35 6c 80 00 00 	movabs $0x806c35,%rax
+  805a3c:	00 00 00 
+  805a3f:	48 89 c7             	mov    %rax,%rdi
+  805a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a47:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  805a4e:	00 00 00 
+  805a51:	41 ff d0             	call   *%r8
+}
+  805a54:	90                   	nop
+  805a55:	c9                   	leave
+  805a56:	c3                   	ret
+
+0000000000805a57 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805a57:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805a5a:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805a5d:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805a64:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805a68:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805a6d:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805a74:	00 00 00 
+	call *%rax
+  805a77:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805a79:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805a7e:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805a81:	41 5f                	pop    %r15
+	popq %r15
+  805a83:	41 5f                	pop    %r15
+	popq %r15
+  805a85:	41 5f                	pop    %r15
+	popq %r14
+  805a87:	41 5e                	pop    %r14
+	popq %r13
+  805a89:	41 5d                	pop    %r13
+	popq %r12
+  805a8b:	41 5c                	pop    %r12
+	popq %r11
+  805a8d:	41 5b                	pop    %r11
+	popq %r10
+  805a8f:	41 5a                	pop    %r10
+	popq %r9
+  805a91:	41 59                	pop    %r9
+	popq %r8
+  805a93:	41 58                	pop    %r8
+	popq %rsi
+  805a95:	5e                   	pop    %rsi
+	popq %rdi
+  805a96:	5f                   	pop    %rdi
+	popq %rbp
+  805a97:	5d                   	pop    %rbp
+	popq %rdx
+  805a98:	5a                   	pop    %rdx
+	popq %rcx
+  805a99:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805a9a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805a9f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805aa4:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805aa8:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805aab:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805ab0:	5b                   	pop    %rbx
+	popq %rax
+  805ab1:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805ab2:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805ab6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805ab7:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805abc:	c3                   	ret
+
+0000000000805abd <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805abd:	55                   	push   %rbp
+  805abe:	48 89 e5             	mov    %rsp,%rbp
+  805ac1:	48 83 ec 20          	sub    $0x20,%rsp
+  805ac5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ac9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805acd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805ad1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ad5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805ad9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805add:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805ae4:	48 89 c7             	mov    %rax,%rdi
+  805ae7:	48 b8 f5 5a 80 00 00 	movabs $0x805af5,%rax
+  805aee:	00 00 00 
+  805af1:	ff d0                	call   *%rax
+}
+  805af3:	c9                   	leave
+  805af4:	c3                   	ret
+
+0000000000805af5 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805af5:	55                   	push   %rbp
+  805af6:	48 89 e5             	mov    %rsp,%rbp
+  805af9:	48 83 ec 30          	sub    $0x30,%rsp
+  805afd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b01:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b05:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805b09:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805b0d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805b12:	75 0e                	jne    805b22 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805b14:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b1b:	00 00 00 
+  805b1e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805b22:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805b27:	75 18                	jne    805b41 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805b29:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b2d:	48 89 c7             	mov    %rax,%rdi
+  805b30:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  805b37:	00 00 00 
+  805b3a:	ff d0                	call   *%rax
+  805b3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b3f:	eb 1d                	jmp    805b5e <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805b41:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b49:	48 89 d6             	mov    %rdx,%rsi
+  805b4c:	48 89 c7             	mov    %rax,%rdi
+  805b4f:	48 b8 14 23 80 00 00 	movabs $0x802314,%rax
+  805b56:	00 00 00 
+  805b59:	ff d0                	call   *%rax
+  805b5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805b5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b62:	79 2a                	jns    805b8e <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805b64:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b69:	74 0a                	je     805b75 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805b6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b6f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805b75:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805b7a:	74 0a                	je     805b86 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805b7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b80:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805b86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b89:	e9 aa 00 00 00       	jmp    805c38 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805b8e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b93:	74 36                	je     805bcb <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805b95:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b9c:	00 00 00 
+  805b9f:	8b 40 04             	mov    0x4(%rax),%eax
+  805ba2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ba7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805bae:	00 00 00 
+  805bb1:	48 98                	cltq
+  805bb3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bba:	48 01 d0             	add    %rdx,%rax
+  805bbd:	48 05 24 01 00 00    	add    $0x124,%rax
+  805bc3:	8b 10                	mov    (%rax),%edx
+  805bc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bc9:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805bcb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805bd0:	74 36                	je     805c08 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805bd2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bd9:	00 00 00 
+  805bdc:	8b 40 04             	mov    0x4(%rax),%eax
+  805bdf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805be4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805beb:	00 00 00 
+  805bee:	48 98                	cltq
+  805bf0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bf7:	48 01 d0             	add    %rdx,%rax
+  805bfa:	48 05 28 01 00 00    	add    $0x128,%rax
+  805c00:	8b 10                	mov    (%rax),%edx
+  805c02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c06:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805c08:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c0f:	00 00 00 
+  805c12:	8b 40 04             	mov    0x4(%rax),%eax
+  805c15:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c1a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c21:	00 00 00 
+  805c24:	48 98                	cltq
+  805c26:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c2d:	48 01 d0             	add    %rdx,%rax
+  805c30:	48 05 20 01 00 00    	add    $0x120,%rax
+  805c36:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805c38:	c9                   	leave
+  805c39:	c3                   	ret
+
+0000000000805c3a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805c3a:	55                   	push   %rbp
+  805c3b:	48 89 e5             	mov    %rsp,%rbp
+  805c3e:	48 83 ec 30          	sub    $0x30,%rsp
+  805c42:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c45:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805c48:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805c4c:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805c4f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805c54:	75 5e                	jne    805cb4 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805c56:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c5d:	00 00 00 
+  805c60:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c64:	eb 4e                	jmp    805cb4 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805c66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c6a:	79 3c                	jns    805ca8 <ipc_send+0x6e>
+  805c6c:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805c70:	74 36                	je     805ca8 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805c72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c75:	89 c1                	mov    %eax,%ecx
+  805c77:	48 b8 48 6c 80 00 00 	movabs $0x806c48,%rax
+  805c7e:	00 00 00 
+  805c81:	48 89 c2             	mov    %rax,%rdx
+  805c84:	be 54 00 00 00       	mov    $0x54,%esi
+  805c89:	48 b8 6e 6c 80 00 00 	movabs $0x806c6e,%rax
+  805c90:	00 00 00 
+  805c93:	48 89 c7             	mov    %rax,%rdi
+  805c96:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c9b:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  805ca2:	00 00 00 
+  805ca5:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805ca8:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  805caf:	00 00 00 
+  805cb2:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805cb4:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805cb7:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805cba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cc1:	89 c7                	mov    %eax,%edi
+  805cc3:	48 b8 77 22 80 00 00 	movabs $0x802277,%rax
+  805cca:	00 00 00 
+  805ccd:	ff d0                	call   *%rax
+  805ccf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805cd2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cd6:	75 8e                	jne    805c66 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805cd8:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  805cdf:	00 00 00 
+  805ce2:	ff d0                	call   *%rax
+}
+  805ce4:	90                   	nop
+  805ce5:	c9                   	leave
+  805ce6:	c3                   	ret
+
+0000000000805ce7 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805ce7:	55                   	push   %rbp
+  805ce8:	48 89 e5             	mov    %rsp,%rbp
+  805ceb:	48 83 ec 18          	sub    $0x18,%rsp
+  805cef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805cf2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805cf9:	eb 4d                	jmp    805d48 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805cfb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d02:	00 00 00 
+  805d05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d08:	48 98                	cltq
+  805d0a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d11:	48 01 d0             	add    %rdx,%rax
+  805d14:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805d1a:	8b 00                	mov    (%rax),%eax
+  805d1c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805d1f:	75 23                	jne    805d44 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805d21:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d28:	00 00 00 
+  805d2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d2e:	48 98                	cltq
+  805d30:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d37:	48 01 d0             	add    %rdx,%rax
+  805d3a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d40:	8b 00                	mov    (%rax),%eax
+  805d42:	eb 12                	jmp    805d56 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805d44:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d48:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d4f:	7e aa                	jle    805cfb <ipc_find_env+0x14>
+  return 0;
+  805d51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d56:	c9                   	leave
+  805d57:	c3                   	ret
+
+0000000000805d58 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805d58:	55                   	push   %rbp
+  805d59:	48 89 e5             	mov    %rsp,%rbp
+  805d5c:	48 83 ec 18          	sub    $0x18,%rsp
+  805d60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805d64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d68:	48 c1 e8 27          	shr    $0x27,%rax
+  805d6c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d71:	48 89 c2             	mov    %rax,%rdx
+  805d74:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805d7b:	01 00 00 
+  805d7e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d82:	83 e0 01             	and    $0x1,%eax
+  805d85:	48 85 c0             	test   %rax,%rax
+  805d88:	74 63                	je     805ded <pageref+0x95>
+  805d8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d8e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805d92:	48 89 c2             	mov    %rax,%rdx
+  805d95:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805d9c:	01 00 00 
+  805d9f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805da3:	83 e0 01             	and    $0x1,%eax
+  805da6:	48 85 c0             	test   %rax,%rax
+  805da9:	74 42                	je     805ded <pageref+0x95>
+  805dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805daf:	48 c1 e8 15          	shr    $0x15,%rax
+  805db3:	48 89 c2             	mov    %rax,%rdx
+  805db6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805dbd:	01 00 00 
+  805dc0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dc4:	83 e0 01             	and    $0x1,%eax
+  805dc7:	48 85 c0             	test   %rax,%rax
+  805dca:	74 21                	je     805ded <pageref+0x95>
+  805dcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd0:	48 c1 e8 0c          	shr    $0xc,%rax
+  805dd4:	48 89 c2             	mov    %rax,%rdx
+  805dd7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805dde:	01 00 00 
+  805de1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805de5:	83 e0 01             	and    $0x1,%eax
+  805de8:	48 85 c0             	test   %rax,%rax
+  805deb:	75 07                	jne    805df4 <pageref+0x9c>
+    return 0;
+  805ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  805df2:	eb 53                	jmp    805e47 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805df4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805df8:	48 c1 e8 0c          	shr    $0xc,%rax
+  805dfc:	48 89 c2             	mov    %rax,%rdx
+  805dff:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e06:	01 00 00 
+  805e09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e0d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805e11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e15:	83 e0 01             	and    $0x1,%eax
+  805e18:	48 85 c0             	test   %rax,%rax
+  805e1b:	75 07                	jne    805e24 <pageref+0xcc>
+    return 0;
+  805e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e22:	eb 23                	jmp    805e47 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e28:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e2c:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e33:	00 00 00 
+  805e36:	48 c1 e0 04          	shl    $0x4,%rax
+  805e3a:	48 01 d0             	add    %rdx,%rax
+  805e3d:	48 83 c0 08          	add    $0x8,%rax
+  805e41:	0f b7 00             	movzwl (%rax),%eax
+  805e44:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e47:	c9                   	leave
+  805e48:	c3                   	ret
+
+0000000000805e49 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805e49:	55                   	push   %rbp
+  805e4a:	48 89 e5             	mov    %rsp,%rbp
+  805e4d:	48 83 ec 10          	sub    $0x10,%rsp
+  805e51:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e57:	be 00 00 00 00       	mov    $0x0,%esi
+  805e5c:	89 c7                	mov    %eax,%edi
+  805e5e:	48 b8 6d 5e 80 00 00 	movabs $0x805e6d,%rax
+  805e65:	00 00 00 
+  805e68:	ff d0                	call   *%rax
+}
+  805e6a:	90                   	nop
+  805e6b:	c9                   	leave
+  805e6c:	c3                   	ret
+
+0000000000805e6d <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805e6d:	55                   	push   %rbp
+  805e6e:	48 89 e5             	mov    %rsp,%rbp
+  805e71:	48 83 ec 10          	sub    $0x10,%rsp
+  805e75:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805e78:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805e7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e80:	75 3e                	jne    805ec0 <waitpid+0x53>
+  805e82:	48 b8 78 6c 80 00 00 	movabs $0x806c78,%rax
+  805e89:	00 00 00 
+  805e8c:	48 89 c1             	mov    %rax,%rcx
+  805e8f:	48 b8 83 6c 80 00 00 	movabs $0x806c83,%rax
+  805e96:	00 00 00 
+  805e99:	48 89 c2             	mov    %rax,%rdx
+  805e9c:	be 0e 00 00 00       	mov    $0xe,%esi
+  805ea1:	48 b8 98 6c 80 00 00 	movabs $0x806c98,%rax
+  805ea8:	00 00 00 
+  805eab:	48 89 c7             	mov    %rax,%rdi
+  805eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  805eb3:	49 b8 3d 58 80 00 00 	movabs $0x80583d,%r8
+  805eba:	00 00 00 
+  805ebd:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805ec0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805ec5:	74 0a                	je     805ed1 <waitpid+0x64>
+    *status = 0;
+  805ec7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ecb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805ed1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805ed5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ed8:	48 89 d6             	mov    %rdx,%rsi
+  805edb:	89 c7                	mov    %eax,%edi
+  805edd:	48 b8 8d 1f 80 00 00 	movabs $0x801f8d,%rax
+  805ee4:	00 00 00 
+  805ee7:	ff d0                	call   *%rax
+}
+  805ee9:	c9                   	leave
+  805eea:	c3                   	ret
+
+0000000000805eeb <xchg>:
+  805eeb:	55                   	push   %rbp
+  805eec:	48 89 e5             	mov    %rsp,%rbp
+  805eef:	48 83 ec 20          	sub    $0x20,%rsp
+  805ef3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ef7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805efa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805efe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f01:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f05:	f0 87 02             	lock xchg %eax,(%rdx)
+  805f08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f0e:	c9                   	leave
+  805f0f:	c3                   	ret
+
+0000000000805f10 <cmpxchg>:
+  805f10:	55                   	push   %rbp
+  805f11:	48 89 e5             	mov    %rsp,%rbp
+  805f14:	48 83 ec 20          	sub    $0x20,%rsp
+  805f18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f1c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f1f:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805f22:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805f26:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805f29:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f2c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f30:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805f34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f3a:	c9                   	leave
+  805f3b:	c3                   	ret
+
+0000000000805f3c <xadd>:
+  805f3c:	55                   	push   %rbp
+  805f3d:	48 89 e5             	mov    %rsp,%rbp
+  805f40:	48 83 ec 10          	sub    $0x10,%rsp
+  805f44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f48:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805f4b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805f4f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f52:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f56:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805f5a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  805f5d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f60:	c9                   	leave
+  805f61:	c3                   	ret
+
+0000000000805f62 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805f62:	55                   	push   %rbp
+  805f63:	48 89 e5             	mov    %rsp,%rbp
+  805f66:	48 83 ec 08          	sub    $0x8,%rsp
+  805f6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  805f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f72:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805f78:	90                   	nop
+  805f79:	c9                   	leave
+  805f7a:	c3                   	ret
+
+0000000000805f7b <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805f7b:	55                   	push   %rbp
+  805f7c:	48 89 e5             	mov    %rsp,%rbp
+  805f7f:	48 83 ec 20          	sub    $0x20,%rsp
+  805f83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805f87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f8b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805f90:	be 00 00 00 00       	mov    $0x0,%esi
+  805f95:	48 89 c7             	mov    %rax,%rdi
+  805f98:	48 b8 10 5f 80 00 00 	movabs $0x805f10,%rax
+  805f9f:	00 00 00 
+  805fa2:	ff d0                	call   *%rax
+  805fa4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805fa7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fab:	74 65                	je     806012 <mutex_lock+0x97>
+  if (c != 2)
+  805fad:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  805fb1:	74 57                	je     80600a <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  805fb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb7:	be 02 00 00 00       	mov    $0x2,%esi
+  805fbc:	48 89 c7             	mov    %rax,%rdi
+  805fbf:	48 b8 eb 5e 80 00 00 	movabs $0x805eeb,%rax
+  805fc6:	00 00 00 
+  805fc9:	ff d0                	call   *%rax
+  805fcb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805fce:	eb 3a                	jmp    80600a <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  805fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fd4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805fdb:	be 02 00 00 00       	mov    $0x2,%esi
+  805fe0:	48 89 c7             	mov    %rax,%rdi
+  805fe3:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  805fea:	00 00 00 
+  805fed:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  805fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ff3:	be 02 00 00 00       	mov    $0x2,%esi
+  805ff8:	48 89 c7             	mov    %rax,%rdi
+  805ffb:	48 b8 eb 5e 80 00 00 	movabs $0x805eeb,%rax
+  806002:	00 00 00 
+  806005:	ff d0                	call   *%rax
+  806007:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80600a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80600e:	75 c0                	jne    805fd0 <mutex_lock+0x55>
+  806010:	eb 01                	jmp    806013 <mutex_lock+0x98>
+    return;
+  806012:	90                   	nop
+}
+  806013:	c9                   	leave
+  806014:	c3                   	ret
+
+0000000000806015 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806015:	55                   	push   %rbp
+  806016:	48 89 e5             	mov    %rsp,%rbp
+  806019:	48 83 ec 08          	sub    $0x8,%rsp
+  80601d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806021:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806025:	ba 01 00 00 00       	mov    $0x1,%edx
+  80602a:	be 00 00 00 00       	mov    $0x0,%esi
+  80602f:	48 89 c7             	mov    %rax,%rdi
+  806032:	48 b8 10 5f 80 00 00 	movabs $0x805f10,%rax
+  806039:	00 00 00 
+  80603c:	ff d0                	call   *%rax
+  80603e:	85 c0                	test   %eax,%eax
+  806040:	75 07                	jne    806049 <mutex_trylock+0x34>
+  806042:	b8 00 00 00 00       	mov    $0x0,%eax
+  806047:	eb 05                	jmp    80604e <mutex_trylock+0x39>
+  806049:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80604e:	c9                   	leave
+  80604f:	c3                   	ret
+
+0000000000806050 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806050:	55                   	push   %rbp
+  806051:	48 89 e5             	mov    %rsp,%rbp
+  806054:	48 83 ec 10          	sub    $0x10,%rsp
+  806058:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80605c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806060:	be 00 00 00 00       	mov    $0x0,%esi
+  806065:	48 89 c7             	mov    %rax,%rdi
+  806068:	48 b8 eb 5e 80 00 00 	movabs $0x805eeb,%rax
+  80606f:	00 00 00 
+  806072:	ff d0                	call   *%rax
+  806074:	83 f8 02             	cmp    $0x2,%eax
+  806077:	75 18                	jne    806091 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806079:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80607d:	be 01 00 00 00       	mov    $0x1,%esi
+  806082:	48 89 c7             	mov    %rax,%rdi
+  806085:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  80608c:	00 00 00 
+  80608f:	ff d0                	call   *%rax
+}
+  806091:	90                   	nop
+  806092:	c9                   	leave
+  806093:	c3                   	ret
+
+0000000000806094 <cond_init>:
+cond_init(struct Cond *c) {
+  806094:	55                   	push   %rbp
+  806095:	48 89 e5             	mov    %rsp,%rbp
+  806098:	48 83 ec 08          	sub    $0x8,%rsp
+  80609c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  8060a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060a4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8060aa:	90                   	nop
+  8060ab:	c9                   	leave
+  8060ac:	c3                   	ret
+
+00000000008060ad <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8060ad:	55                   	push   %rbp
+  8060ae:	48 89 e5             	mov    %rsp,%rbp
+  8060b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8060b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8060bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8060c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060c5:	8b 00                	mov    (%rax),%eax
+  8060c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8060ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060ce:	48 89 c7             	mov    %rax,%rdi
+  8060d1:	48 b8 50 60 80 00 00 	movabs $0x806050,%rax
+  8060d8:	00 00 00 
+  8060db:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8060dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060e1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8060e5:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8060e8:	89 ce                	mov    %ecx,%esi
+  8060ea:	48 89 c7             	mov    %rax,%rdi
+  8060ed:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  8060f4:	00 00 00 
+  8060f7:	ff d0                	call   *%rax
+  8060f9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8060fc:	eb 1f                	jmp    80611d <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8060fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806102:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806109:	be 02 00 00 00       	mov    $0x2,%esi
+  80610e:	48 89 c7             	mov    %rax,%rdi
+  806111:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  806118:	00 00 00 
+  80611b:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  80611d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806121:	be 02 00 00 00       	mov    $0x2,%esi
+  806126:	48 89 c7             	mov    %rax,%rdi
+  806129:	48 b8 eb 5e 80 00 00 	movabs $0x805eeb,%rax
+  806130:	00 00 00 
+  806133:	ff d0                	call   *%rax
+  806135:	85 c0                	test   %eax,%eax
+  806137:	75 c5                	jne    8060fe <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806139:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80613d:	75 07                	jne    806146 <cond_timedwait+0x99>
+  80613f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806144:	eb 05                	jmp    80614b <cond_timedwait+0x9e>
+  806146:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80614b:	c9                   	leave
+  80614c:	c3                   	ret
+
+000000000080614d <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80614d:	55                   	push   %rbp
+  80614e:	48 89 e5             	mov    %rsp,%rbp
+  806151:	48 83 ec 10          	sub    $0x10,%rsp
+  806155:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806159:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80615d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806165:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80616c:	48 89 ce             	mov    %rcx,%rsi
+  80616f:	48 89 c7             	mov    %rax,%rdi
+  806172:	48 b8 ad 60 80 00 00 	movabs $0x8060ad,%rax
+  806179:	00 00 00 
+  80617c:	ff d0                	call   *%rax
+}
+  80617e:	90                   	nop
+  80617f:	c9                   	leave
+  806180:	c3                   	ret
+
+0000000000806181 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806181:	55                   	push   %rbp
+  806182:	48 89 e5             	mov    %rsp,%rbp
+  806185:	48 83 ec 10          	sub    $0x10,%rsp
+  806189:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80618d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806191:	be 01 00 00 00       	mov    $0x1,%esi
+  806196:	48 89 c7             	mov    %rax,%rdi
+  806199:	48 b8 3c 5f 80 00 00 	movabs $0x805f3c,%rax
+  8061a0:	00 00 00 
+  8061a3:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8061a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8061ae:	48 89 c7             	mov    %rax,%rdi
+  8061b1:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  8061b8:	00 00 00 
+  8061bb:	ff d0                	call   *%rax
+}
+  8061bd:	90                   	nop
+  8061be:	c9                   	leave
+  8061bf:	c3                   	ret
+
+00000000008061c0 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8061c0:	55                   	push   %rbp
+  8061c1:	48 89 e5             	mov    %rsp,%rbp
+  8061c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8061c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8061cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8061d5:	48 89 c7             	mov    %rax,%rdi
+  8061d8:	48 b8 3c 5f 80 00 00 	movabs $0x805f3c,%rax
+  8061df:	00 00 00 
+  8061e2:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8061e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061e8:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8061ed:	48 89 c7             	mov    %rax,%rdi
+  8061f0:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  8061f7:	00 00 00 
+  8061fa:	ff d0                	call   *%rax
+}
+  8061fc:	90                   	nop
+  8061fd:	c9                   	leave
+  8061fe:	c3                   	ret
+
+00000000008061ff <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8061ff:	55                   	push   %rbp
+  806200:	48 89 e5             	mov    %rsp,%rbp
+  806203:	48 83 ec 10          	sub    $0x10,%rsp
+  806207:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80620b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80620e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806212:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806215:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80621b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806222:	90                   	nop
+  806223:	c9                   	leave
+  806224:	c3                   	ret
+
+0000000000806225 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806225:	55                   	push   %rbp
+  806226:	48 89 e5             	mov    %rsp,%rbp
+  806229:	48 83 ec 18          	sub    $0x18,%rsp
+  80622d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806231:	eb 2a                	jmp    80625d <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806233:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806236:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806239:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80623d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806240:	89 ce                	mov    %ecx,%esi
+  806242:	48 89 c7             	mov    %rax,%rdi
+  806245:	48 b8 10 5f 80 00 00 	movabs $0x805f10,%rax
+  80624c:	00 00 00 
+  80624f:	ff d0                	call   *%rax
+  806251:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806254:	75 07                	jne    80625d <sem_trywait+0x38>
+      return 0;
+  806256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80625b:	eb 14                	jmp    806271 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80625d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806261:	8b 00                	mov    (%rax),%eax
+  806263:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806266:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80626a:	75 c7                	jne    806233 <sem_trywait+0xe>
+  return -E_BUSY;
+  80626c:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806271:	c9                   	leave
+  806272:	c3                   	ret
+
+0000000000806273 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806273:	55                   	push   %rbp
+  806274:	48 89 e5             	mov    %rsp,%rbp
+  806277:	48 83 ec 30          	sub    $0x30,%rsp
+  80627b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80627f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806283:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80628a:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80628b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806290:	0f 84 fb 00 00 00    	je     806391 <sem_timedwait+0x11e>
+  806296:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80629b:	0f 84 f0 00 00 00    	je     806391 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  8062a1:	48 b8 4c 54 80 00 00 	movabs $0x80544c,%rax
+  8062a8:	00 00 00 
+  8062ab:	ff d0                	call   *%rax
+  8062ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8062b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062b5:	48 f7 d0             	not    %rax
+  8062b8:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8062bc:	73 0d                	jae    8062cb <sem_timedwait+0x58>
+  8062be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8062c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062c6:	48 01 d0             	add    %rdx,%rax
+  8062c9:	eb 07                	jmp    8062d2 <sem_timedwait+0x5f>
+  8062cb:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8062d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8062d6:	e9 b6 00 00 00       	jmp    806391 <sem_timedwait+0x11e>
+    if (deadline) {
+  8062db:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8062e0:	74 2d                	je     80630f <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8062e2:	48 b8 4c 54 80 00 00 	movabs $0x80544c,%rax
+  8062e9:	00 00 00 
+  8062ec:	ff d0                	call   *%rax
+  8062ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8062f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062f6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8062fa:	73 0a                	jae    806306 <sem_timedwait+0x93>
+  8062fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806300:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  806304:	eb 05                	jmp    80630b <sem_timedwait+0x98>
+  806306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80630b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80630f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806313:	48 83 c0 04          	add    $0x4,%rax
+  806317:	be 01 00 00 00       	mov    $0x1,%esi
+  80631c:	48 89 c7             	mov    %rax,%rdi
+  80631f:	48 b8 3c 5f 80 00 00 	movabs $0x805f3c,%rax
+  806326:	00 00 00 
+  806329:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  80632b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80632f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806333:	be 00 00 00 00       	mov    $0x0,%esi
+  806338:	48 89 c7             	mov    %rax,%rdi
+  80633b:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  806342:	00 00 00 
+  806345:	ff d0                	call   *%rax
+  806347:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80634a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80634e:	48 83 c0 04          	add    $0x4,%rax
+  806352:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806357:	48 89 c7             	mov    %rax,%rdi
+  80635a:	48 b8 3c 5f 80 00 00 	movabs $0x805f3c,%rax
+  806361:	00 00 00 
+  806364:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806366:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80636a:	75 25                	jne    806391 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80636c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806370:	48 89 c7             	mov    %rax,%rdi
+  806373:	48 b8 25 62 80 00 00 	movabs $0x806225,%rax
+  80637a:	00 00 00 
+  80637d:	ff d0                	call   *%rax
+  80637f:	85 c0                	test   %eax,%eax
+  806381:	79 07                	jns    80638a <sem_timedwait+0x117>
+  806383:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806388:	eb 27                	jmp    8063b1 <sem_timedwait+0x13e>
+  80638a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80638f:	eb 20                	jmp    8063b1 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806391:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806395:	48 89 c7             	mov    %rax,%rdi
+  806398:	48 b8 25 62 80 00 00 	movabs $0x806225,%rax
+  80639f:	00 00 00 
+  8063a2:	ff d0                	call   *%rax
+  8063a4:	85 c0                	test   %eax,%eax
+  8063a6:	0f 88 2f ff ff ff    	js     8062db <sem_timedwait+0x68>
+  return 0;
+  8063ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063b1:	c9                   	leave
+  8063b2:	c3                   	ret
+
+00000000008063b3 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8063b3:	55                   	push   %rbp
+  8063b4:	48 89 e5             	mov    %rsp,%rbp
+  8063b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8063bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8063bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063c3:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8063ca:	48 89 c7             	mov    %rax,%rdi
+  8063cd:	48 b8 73 62 80 00 00 	movabs $0x806273,%rax
+  8063d4:	00 00 00 
+  8063d7:	ff d0                	call   *%rax
+}
+  8063d9:	90                   	nop
+  8063da:	c9                   	leave
+  8063db:	c3                   	ret
+
+00000000008063dc <sem_post>:
+sem_post(struct Semaphore *s) {
+  8063dc:	55                   	push   %rbp
+  8063dd:	48 89 e5             	mov    %rsp,%rbp
+  8063e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8063e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8063e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8063f1:	48 89 c7             	mov    %rax,%rdi
+  8063f4:	48 b8 3c 5f 80 00 00 	movabs $0x805f3c,%rax
+  8063fb:	00 00 00 
+  8063fe:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  806400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806404:	8b 40 04             	mov    0x4(%rax),%eax
+  806407:	85 c0                	test   %eax,%eax
+  806409:	74 18                	je     806423 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  80640b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80640f:	be 01 00 00 00       	mov    $0x1,%esi
+  806414:	48 89 c7             	mov    %rax,%rdi
+  806417:	48 b8 89 24 80 00 00 	movabs $0x802489,%rax
+  80641e:	00 00 00 
+  806421:	ff d0                	call   *%rax
+}
+  806423:	90                   	nop
+  806424:	c9                   	leave
+  806425:	c3                   	ret
+  806426:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8978 @@
+
+obj/user/fsstat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 ba 04 00 00       	call   8004e6 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <usage>:
+// -d off, first turn disk DMA on or off.
+
+#include <inc/lib.h>
+
+static void
+usage(void) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  printf("usage: fsstat [-c nblocks] [-d on|off]\n");
+  800036:	48 b8 60 5a 80 00 00 	movabs $0x805a60,%rax
+  80003d:	00 00 00 
+  800040:	48 89 c7             	mov    %rax,%rdi
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba bc 39 80 00 00 	movabs $0x8039bc,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+  exit();
+  800054:	48 b8 69 05 80 00 00 	movabs $0x800569,%rax
+  80005b:	00 00 00 
+  80005e:	ff d0                	call   *%rax
+}
+  800060:	90                   	nop
+  800061:	5d                   	pop    %rbp
+  800062:	c3                   	ret
+
+0000000000800063 <percent>:
+
+static void
+percent(const char *what, uint64_t n, uint64_t total) {
+  800063:	55                   	push   %rbp
+  800064:	48 89 e5             	mov    %rsp,%rbp
+  800067:	48 83 ec 30          	sub    $0x30,%rsp
+  80006b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80006f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800073:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint64_t tenths = total ? n * 1000 / total : 0;
+  800077:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80007c:	74 16                	je     800094 <percent+0x31>
+  80007e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800082:	48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+  800089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008e:	48 f7 75 d8          	divq   -0x28(%rbp)
+  800092:	eb 05                	jmp    800099 <percent+0x36>
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  printf("%s: %ld (%ld.%ld%%)\n", what, (long)n, (long)(tenths / 10), (long)(tenths % 10));
+  80009d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8000a1:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  8000a8:	cc cc cc 
+  8000ab:	48 89 c8             	mov    %rcx,%rax
+  8000ae:	48 f7 e2             	mul    %rdx
+  8000b1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8000b5:	48 89 d0             	mov    %rdx,%rax
+  8000b8:	48 c1 e0 02          	shl    $0x2,%rax
+  8000bc:	48 01 d0             	add    %rdx,%rax
+  8000bf:	48 01 c0             	add    %rax,%rax
+  8000c2:	48 29 c1             	sub    %rax,%rcx
+  8000c5:	48 89 ca             	mov    %rcx,%rdx
+  8000c8:	48 89 d6             	mov    %rdx,%rsi
+  8000cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000cf:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  8000d6:	cc cc cc 
+  8000d9:	48 f7 e2             	mul    %rdx
+  8000dc:	48 89 d0             	mov    %rdx,%rax
+  8000df:	48 c1 e8 03          	shr    $0x3,%rax
+  8000e3:	48 89 c1             	mov    %rax,%rcx
+  8000e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000ee:	49 89 f0             	mov    %rsi,%r8
+  8000f1:	48 89 c6             	mov    %rax,%rsi
+  8000f4:	48 b8 88 5a 80 00 00 	movabs $0x805a88,%rax
+  8000fb:	00 00 00 
+  8000fe:	48 89 c7             	mov    %rax,%rdi
+  800101:	b8 00 00 00 00       	mov    $0x0,%eax
+  800106:	49 b9 bc 39 80 00 00 	movabs $0x8039bc,%r9
+  80010d:	00 00 00 
+  800110:	41 ff d1             	call   *%r9
+}
+  800113:	90                   	nop
+  800114:	c9                   	leave
+  800115:	c3                   	ret
+
+0000000000800116 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800116:	55                   	push   %rbp
+  800117:	48 89 e5             	mov    %rsp,%rbp
+  80011a:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800121:	89 bd 5c ff ff ff    	mov    %edi,-0xa4(%rbp)
+  800127:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  struct Fsret_stats st;
+  struct Argstate args;
+  const char *cap = NULL, *dma = NULL;
+  80012e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800135:	00 
+  800136:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80013d:	00 
+  int i, r;
+
+  argstart(&argc, argv, &args);
+  80013e:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  800145:	48 8b 8d 50 ff ff ff 	mov    -0xb0(%rbp),%rcx
+  80014c:	48 8d 85 5c ff ff ff 	lea    -0xa4(%rbp),%rax
+  800153:	48 89 ce             	mov    %rcx,%rsi
+  800156:	48 89 c7             	mov    %rax,%rdi
+  800159:	48 b8 4b 1f 80 00 00 	movabs $0x801f4b,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+  while ((i = argnext(&args)) >= 0) {
+  800165:	e9 a8 00 00 00       	jmp    800212 <umain+0xfc>
+    if (i == 'c' && (cap = argvalue(&args)))
+  80016a:	83 7d ec 63          	cmpl   $0x63,-0x14(%rbp)
+  80016e:	75 21                	jne    800191 <umain+0x7b>
+  800170:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800177:	48 89 c7             	mov    %rax,%rdi
+  80017a:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+  800186:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80018a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80018f:	75 7d                	jne    80020e <umain+0xf8>
+      continue;
+    if (i == 'd' && (dma = argvalue(&args)) &&
+  800191:	83 7d ec 64          	cmpl   $0x64,-0x14(%rbp)
+  800195:	75 69                	jne    800200 <umain+0xea>
+  800197:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80019e:	48 89 c7             	mov    %rax,%rdi
+  8001a1:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  8001a8:	00 00 00 
+  8001ab:	ff d0                	call   *%rax
+  8001ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8001b1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8001b6:	74 48                	je     800200 <umain+0xea>
+        (!strcmp(dma, "on") || !strcmp(dma, "off")))
+  8001b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001bc:	48 ba 9d 5a 80 00 00 	movabs $0x805a9d,%rdx
+  8001c3:	00 00 00 
+  8001c6:	48 89 d6             	mov    %rdx,%rsi
+  8001c9:	48 89 c7             	mov    %rax,%rdi
+  8001cc:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+    if (i == 'd' && (dma = argvalue(&args)) &&
+  8001d8:	85 c0                	test   %eax,%eax
+  8001da:	74 35                	je     800211 <umain+0xfb>
+        (!strcmp(dma, "on") || !strcmp(dma, "off")))
+  8001dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e0:	48 ba a0 5a 80 00 00 	movabs $0x805aa0,%rdx
+  8001e7:	00 00 00 
+  8001ea:	48 89 d6             	mov    %rdx,%rsi
+  8001ed:	48 89 c7             	mov    %rax,%rdi
+  8001f0:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8001f7:	00 00 00 
+  8001fa:	ff d0                	call   *%rax
+  8001fc:	85 c0                	test   %eax,%eax
+  8001fe:	74 11                	je     800211 <umain+0xfb>
+      continue;
+    usage();
+  800200:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+  80020c:	eb 04                	jmp    800212 <umain+0xfc>
+      continue;
+  80020e:	90                   	nop
+  80020f:	eb 01                	jmp    800212 <umain+0xfc>
+      continue;
+  800211:	90                   	nop
+  while ((i = argnext(&args)) >= 0) {
+  800212:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800219:	48 89 c7             	mov    %rax,%rdi
+  80021c:	48 b8 b0 1f 80 00 00 	movabs $0x801fb0,%rax
+  800223:	00 00 00 
+  800226:	ff d0                	call   *%rax
+  800228:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80022b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80022f:	0f 89 35 ff ff ff    	jns    80016a <umain+0x54>
+  }
+  if (argc != 1)
+  800235:	8b 85 5c ff ff ff    	mov    -0xa4(%rbp),%eax
+  80023b:	83 f8 01             	cmp    $0x1,%eax
+  80023e:	74 0c                	je     80024c <umain+0x136>
+    usage();
+  800240:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+
+  if (cap && (r = fs_set_cache(strtol(cap, NULL, 0))) < 0) {
+  80024c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800251:	74 61                	je     8002b4 <umain+0x19e>
+  800253:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025c:	be 00 00 00 00       	mov    $0x0,%esi
+  800261:	48 89 c7             	mov    %rax,%rdi
+  800264:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  80026b:	00 00 00 
+  80026e:	ff d0                	call   *%rax
+  800270:	89 c7                	mov    %eax,%edi
+  800272:	48 b8 f2 36 80 00 00 	movabs $0x8036f2,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+  80027e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800281:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800285:	79 2d                	jns    8002b4 <umain+0x19e>
+    printf("fsstat: block cache of %s blocks: %i\n", cap, r);
+  800287:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80028a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80028e:	48 89 c6             	mov    %rax,%rsi
+  800291:	48 b8 a8 5a 80 00 00 	movabs $0x805aa8,%rax
+  800298:	00 00 00 
+  80029b:	48 89 c7             	mov    %rax,%rdi
+  80029e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a3:	48 b9 bc 39 80 00 00 	movabs $0x8039bc,%rcx
+  8002aa:	00 00 00 
+  8002ad:	ff d1                	call   *%rcx
+    return;
+  8002af:	e9 30 02 00 00       	jmp    8004e4 <umain+0x3ce>
+  }
+  if (dma && (r = fs_set_dma(!strcmp(dma, "on"))) < 0) {
+  8002b4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8002b9:	74 6c                	je     800327 <umain+0x211>
+  8002bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002bf:	48 ba 9d 5a 80 00 00 	movabs $0x805a9d,%rdx
+  8002c6:	00 00 00 
+  8002c9:	48 89 d6             	mov    %rdx,%rsi
+  8002cc:	48 89 c7             	mov    %rax,%rdi
+  8002cf:	48 b8 e1 0c 80 00 00 	movabs $0x800ce1,%rax
+  8002d6:	00 00 00 
+  8002d9:	ff d0                	call   *%rax
+  8002db:	85 c0                	test   %eax,%eax
+  8002dd:	0f 94 c0             	sete   %al
+  8002e0:	0f b6 c0             	movzbl %al,%eax
+  8002e3:	89 c7                	mov    %eax,%edi
+  8002e5:	48 b8 24 37 80 00 00 	movabs $0x803724,%rax
+  8002ec:	00 00 00 
+  8002ef:	ff d0                	call   *%rax
+  8002f1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8002f4:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8002f8:	79 2d                	jns    800327 <umain+0x211>
+    printf("fsstat: DMA %s: %i\n", dma, r);
+  8002fa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8002fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800301:	48 89 c6             	mov    %rax,%rsi
+  800304:	48 b8 ce 5a 80 00 00 	movabs $0x805ace,%rax
+  80030b:	00 00 00 
+  80030e:	48 89 c7             	mov    %rax,%rdi
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	48 b9 bc 39 80 00 00 	movabs $0x8039bc,%rcx
+  80031d:	00 00 00 
+  800320:	ff d1                	call   *%rcx
+    return;
+  800322:	e9 bd 01 00 00       	jmp    8004e4 <umain+0x3ce>
+  }
+  if ((r = fs_stats(&st)) < 0) {
+  800327:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  80032b:	48 89 c7             	mov    %rax,%rdi
+  80032e:	48 b8 96 36 80 00 00 	movabs $0x803696,%rax
+  800335:	00 00 00 
+  800338:	ff d0                	call   *%rax
+  80033a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80033d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800341:	79 28                	jns    80036b <umain+0x255>
+    printf("fsstat: %i\n", r);
+  800343:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800346:	89 c6                	mov    %eax,%esi
+  800348:	48 b8 e2 5a 80 00 00 	movabs $0x805ae2,%rax
+  80034f:	00 00 00 
+  800352:	48 89 c7             	mov    %rax,%rdi
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	48 ba bc 39 80 00 00 	movabs $0x8039bc,%rdx
+  800361:	00 00 00 
+  800364:	ff d2                	call   *%rdx
+    return;
+  800366:	e9 79 01 00 00       	jmp    8004e4 <umain+0x3ce>
+  }
+  printf("path lookup cache: %d entries, %ld lookups\n",
+         st.ret_dcache_size, (long)st.ret_dcache_lookups);
+  80036b:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  printf("path lookup cache: %d entries, %ld lookups\n",
+  80036f:	48 89 c2             	mov    %rax,%rdx
+  800372:	8b 45 98             	mov    -0x68(%rbp),%eax
+  800375:	89 c6                	mov    %eax,%esi
+  800377:	48 b8 f0 5a 80 00 00 	movabs $0x805af0,%rax
+  80037e:	00 00 00 
+  800381:	48 89 c7             	mov    %rax,%rdi
+  800384:	b8 00 00 00 00       	mov    $0x0,%eax
+  800389:	48 b9 bc 39 80 00 00 	movabs $0x8039bc,%rcx
+  800390:	00 00 00 
+  800393:	ff d1                	call   *%rcx
+  percent("  hits", st.ret_dcache_hits, st.ret_dcache_lookups);
+  800395:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+  800399:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80039d:	48 89 c6             	mov    %rax,%rsi
+  8003a0:	48 b8 1c 5b 80 00 00 	movabs $0x805b1c,%rax
+  8003a7:	00 00 00 
+  8003aa:	48 89 c7             	mov    %rax,%rdi
+  8003ad:	48 b8 63 00 80 00 00 	movabs $0x800063,%rax
+  8003b4:	00 00 00 
+  8003b7:	ff d0                	call   *%rax
+  percent("  negative hits", st.ret_dcache_neg_hits, st.ret_dcache_lookups);
+  8003b9:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+  8003bd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8003c1:	48 89 c6             	mov    %rax,%rsi
+  8003c4:	48 b8 23 5b 80 00 00 	movabs $0x805b23,%rax
+  8003cb:	00 00 00 
+  8003ce:	48 89 c7             	mov    %rax,%rdi
+  8003d1:	48 b8 63 00 80 00 00 	movabs $0x800063,%rax
+  8003d8:	00 00 00 
+  8003db:	ff d0                	call   *%rax
+  printf("block cache: %d of %d blocks, %ld evictions\n",
+         st.ret_bc_cached, st.ret_bc_capacity, (long)st.ret_bc_evictions);
+  8003dd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  printf("block cache: %d of %d blocks, %ld evictions\n",
+  8003e1:	48 89 c1             	mov    %rax,%rcx
+  8003e4:	8b 55 9c             	mov    -0x64(%rbp),%edx
+  8003e7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8003ea:	89 c6                	mov    %eax,%esi
+  8003ec:	48 b8 38 5b 80 00 00 	movabs $0x805b38,%rax
+  8003f3:	00 00 00 
+  8003f6:	48 89 c7             	mov    %rax,%rdi
+  8003f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fe:	49 b8 bc 39 80 00 00 	movabs $0x8039bc,%r8
+  800405:	00 00 00 
+  800408:	41 ff d0             	call   *%r8
+  percent("  hits", st.ret_bc_hits, st.ret_bc_hits + st.ret_bc_misses);
+  80040b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80040f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800413:	48 01 c2             	add    %rax,%rdx
+  800416:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80041a:	48 89 c6             	mov    %rax,%rsi
+  80041d:	48 b8 1c 5b 80 00 00 	movabs $0x805b1c,%rax
+  800424:	00 00 00 
+  800427:	48 89 c7             	mov    %rax,%rdi
+  80042a:	48 b8 63 00 80 00 00 	movabs $0x800063,%rax
+  800431:	00 00 00 
+  800434:	ff d0                	call   *%rax
+  percent("  misses", st.ret_bc_misses, st.ret_bc_hits + st.ret_bc_misses);
+  800436:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80043a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80043e:	48 01 c2             	add    %rax,%rdx
+  800441:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800445:	48 89 c6             	mov    %rax,%rsi
+  800448:	48 b8 65 5b 80 00 00 	movabs $0x805b65,%rax
+  80044f:	00 00 00 
+  800452:	48 89 c7             	mov    %rax,%rdi
+  800455:	48 b8 63 00 80 00 00 	movabs $0x800063,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+  if (st.ret_disk_virtio)
+  800461:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800464:	85 c0                	test   %eax,%eax
+  800466:	74 2f                	je     800497 <umain+0x381>
+    printf("disk: virtio-blk, %ld requests, at most %d in flight\n",
+  800468:	8b 45 e0             	mov    -0x20(%rbp),%eax
+           (long)st.ret_virtio_reqs, st.ret_virtio_max_inflight);
+  80046b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    printf("disk: virtio-blk, %ld requests, at most %d in flight\n",
+  80046f:	48 89 d1             	mov    %rdx,%rcx
+  800472:	89 c2                	mov    %eax,%edx
+  800474:	48 89 ce             	mov    %rcx,%rsi
+  800477:	48 b8 70 5b 80 00 00 	movabs $0x805b70,%rax
+  80047e:	00 00 00 
+  800481:	48 89 c7             	mov    %rax,%rdi
+  800484:	b8 00 00 00 00       	mov    $0x0,%eax
+  800489:	48 b9 bc 39 80 00 00 	movabs $0x8039bc,%rcx
+  800490:	00 00 00 
+  800493:	ff d1                	call   *%rcx
+  800495:	eb 4d                	jmp    8004e4 <umain+0x3ce>
+  else
+    printf("disk: IDE %s, %ld DMA and %ld PIO transfers\n", st.ret_ide_dma ? "DMA" : "PIO",
+           (long)st.ret_ide_dma_xfers, (long)st.ret_ide_pio_xfers);
+  800497:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    printf("disk: IDE %s, %ld DMA and %ld PIO transfers\n", st.ret_ide_dma ? "DMA" : "PIO",
+  80049b:	48 89 c1             	mov    %rax,%rcx
+           (long)st.ret_ide_dma_xfers, (long)st.ret_ide_pio_xfers);
+  80049e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    printf("disk: IDE %s, %ld DMA and %ld PIO transfers\n", st.ret_ide_dma ? "DMA" : "PIO",
+  8004a2:	48 89 c2             	mov    %rax,%rdx
+  8004a5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8004a8:	85 c0                	test   %eax,%eax
+  8004aa:	74 0c                	je     8004b8 <umain+0x3a2>
+  8004ac:	48 b8 a6 5b 80 00 00 	movabs $0x805ba6,%rax
+  8004b3:	00 00 00 
+  8004b6:	eb 0a                	jmp    8004c2 <umain+0x3ac>
+  8004b8:	48 b8 aa 5b 80 00 00 	movabs $0x805baa,%rax
+  8004bf:	00 00 00 
+  8004c2:	48 89 c6             	mov    %rax,%rsi
+  8004c5:	48 b8 b0 5b 80 00 00 	movabs $0x805bb0,%rax
+  8004cc:	00 00 00 
+  8004cf:	48 89 c7             	mov    %rax,%rdi
+  8004d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d7:	49 b8 bc 39 80 00 00 	movabs $0x8039bc,%r8
+  8004de:	00 00 00 
+  8004e1:	41 ff d0             	call   *%r8
+}
+  8004e4:	c9                   	leave
+  8004e5:	c3                   	ret
+
+00000000008004e6 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004e6:	55                   	push   %rbp
+  8004e7:	48 89 e5             	mov    %rsp,%rbp
+  8004ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8004ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8004f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8004f5:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8004fc:	00 00 00 
+  8004ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800503:	eb 13                	jmp    800518 <libmain+0x32>
+    (*ctor)();
+  800505:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800509:	48 8b 10             	mov    (%rax),%rdx
+  80050c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800511:	ff d2                	call   *%rdx
+    ctor++;
+  800513:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800518:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80051f:	00 00 00 
+  800522:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800526:	72 dd                	jb     800505 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800528:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80052c:	7e 14                	jle    800542 <libmain+0x5c>
+    binaryname = argv[0];
+  80052e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800532:	48 8b 00             	mov    (%rax),%rax
+  800535:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80053c:	00 00 00 
+  80053f:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800542:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800546:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800549:	48 89 d6             	mov    %rdx,%rsi
+  80054c:	89 c7                	mov    %eax,%edi
+  80054e:	48 b8 16 01 80 00 00 	movabs $0x800116,%rax
+  800555:	00 00 00 
+  800558:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80055a:	48 b8 69 05 80 00 00 	movabs $0x800569,%rax
+  800561:	00 00 00 
+  800564:	ff d0                	call   *%rax
+#endif
+}
+  800566:	90                   	nop
+  800567:	c9                   	leave
+  800568:	c3                   	ret
+
+0000000000800569 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800569:	55                   	push   %rbp
+  80056a:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80056d:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800579:	bf 00 00 00 00       	mov    $0x0,%edi
+  80057e:	48 b8 1c 17 80 00 00 	movabs $0x80171c,%rax
+  800585:	00 00 00 
+  800588:	ff d0                	call   *%rax
+}
+  80058a:	90                   	nop
+  80058b:	5d                   	pop    %rbp
+  80058c:	c3                   	ret
+
+000000000080058d <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  80058d:	55                   	push   %rbp
+  80058e:	48 89 e5             	mov    %rsp,%rbp
+  800591:	53                   	push   %rbx
+  800592:	48 83 ec 38          	sub    $0x38,%rsp
+  800596:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800599:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80059d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8005a1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8005a5:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8005a9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	89 d1                	mov    %edx,%ecx
+  8005b3:	0f a2                	cpuid
+  8005b5:	89 de                	mov    %ebx,%esi
+  8005b7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8005ba:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8005bd:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8005c0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8005c3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8005c8:	74 09                	je     8005d3 <cpuid+0x46>
+}
+  8005ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005ce:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8005d1:	89 10                	mov    %edx,(%rax)
+
+  8005d3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8005d8:	74 09                	je     8005e3 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8005da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8005de:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8005e1:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8005e3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8005e8:	74 09                	je     8005f3 <cpuid+0x66>
+char *
+  8005ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005ee:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8005f1:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8005f3:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8005f8:	74 09                	je     800603 <cpuid+0x76>
+  for (; *s; s++)
+  8005fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8005fe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800601:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800603:	90                   	nop
+  800604:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800608:	c9                   	leave
+  800609:	c3                   	ret
+
+000000000080060a <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80060a:	55                   	push   %rbp
+  80060b:	48 89 e5             	mov    %rsp,%rbp
+  80060e:	48 83 ec 18          	sub    $0x18,%rsp
+  800612:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800615:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800618:	89 c1                	mov    %eax,%ecx
+  80061a:	0f 01 d0             	xgetbv
+  80061d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800620:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800623:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800626:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800629:	48 c1 e2 20          	shl    $0x20,%rdx
+  80062d:	48 09 d0             	or     %rdx,%rax
+#else
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <string_cpu>:
+string_cpu(void) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80063a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800641:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800648:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80064f:	00 00 00 
+  800652:	8b 00                	mov    (%rax),%eax
+  800654:	85 c0                	test   %eax,%eax
+  800656:	78 11                	js     800669 <string_cpu+0x37>
+    return string_features;
+  800658:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80065f:	00 00 00 
+  800662:	8b 00                	mov    (%rax),%eax
+  800664:	e9 df 00 00 00       	jmp    800748 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800669:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80066d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800673:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067d:	48 89 c6             	mov    %rax,%rsi
+  800680:	bf 00 00 00 00       	mov    $0x0,%edi
+  800685:	48 b8 8d 05 80 00 00 	movabs $0x80058d,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800691:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800694:	83 f8 06             	cmp    $0x6,%eax
+  800697:	76 28                	jbe    8006c1 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800699:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80069d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a8:	48 89 c2             	mov    %rax,%rdx
+  8006ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8006b5:	48 b8 8d 05 80 00 00 	movabs $0x80058d,%rax
+  8006bc:	00 00 00 
+  8006bf:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8006c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8006c4:	25 00 02 00 00       	and    $0x200,%eax
+  8006c9:	85 c0                	test   %eax,%eax
+  8006cb:	74 04                	je     8006d1 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8006cd:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8006d1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8006d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006db:	48 89 c1             	mov    %rax,%rcx
+  8006de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006ed:	48 b8 8d 05 80 00 00 	movabs $0x80058d,%rax
+  8006f4:	00 00 00 
+  8006f7:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8006f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8006fc:	83 e0 20             	and    $0x20,%eax
+  8006ff:	85 c0                	test   %eax,%eax
+  800701:	74 2a                	je     80072d <string_cpu+0xfb>
+  800703:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800706:	25 00 00 00 08       	and    $0x8000000,%eax
+  80070b:	85 c0                	test   %eax,%eax
+  80070d:	74 1e                	je     80072d <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80070f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800714:	48 b8 0a 06 80 00 00 	movabs $0x80060a,%rax
+  80071b:	00 00 00 
+  80071e:	ff d0                	call   *%rax
+  800720:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800723:	48 83 f8 06          	cmp    $0x6,%rax
+  800727:	75 04                	jne    80072d <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800729:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80072d:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800734:	00 00 00 
+  800737:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80073a:	89 02                	mov    %eax,(%rdx)
+  80073c:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800743:	00 00 00 
+  800746:	8b 00                	mov    (%rax),%eax
+}
+  800748:	c9                   	leave
+  800749:	c3                   	ret
+
+000000000080074a <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80074a:	55                   	push   %rbp
+  80074b:	48 89 e5             	mov    %rsp,%rbp
+  80074e:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800752:	48 83 ec 60          	sub    $0x60,%rsp
+  800756:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80075b:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800760:	83 e0 1f             	and    $0x1f,%eax
+  800763:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800767:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80076b:	48 f7 d8             	neg    %rax
+  80076e:	48 89 c2             	mov    %rax,%rdx
+  800771:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800776:	48 01 d0             	add    %rdx,%rax
+  800779:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  80077e:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800782:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800788:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80078d:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800791:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800797:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80079b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80079f:	89 c2                	mov    %eax,%edx
+  8007a1:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8007a5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8007aa:	89 c1                	mov    %eax,%ecx
+  8007ac:	d3 e6                	shl    %cl,%esi
+  8007ae:	89 f0                	mov    %esi,%eax
+  8007b0:	21 d0                	and    %edx,%eax
+  8007b2:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8007b6:	eb 21                	jmp    8007d9 <strlen_avx2+0x8f>
+    p += 32;
+  8007b8:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8007be:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8007c3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8007c7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8007cd:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8007d1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8007d5:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8007d9:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8007de:	74 d8                	je     8007b8 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8007e0:	31 c0                	xor    %eax,%eax
+  8007e2:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8007e8:	48 63 d0             	movslq %eax,%rdx
+  8007eb:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8007f0:	48 01 d0             	add    %rdx,%rax
+  8007f3:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8007f8:	c9                   	leave
+  8007f9:	c3                   	ret
+
+00000000008007fa <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8007fa:	55                   	push   %rbp
+  8007fb:	48 89 e5             	mov    %rsp,%rbp
+  8007fe:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800802:	48 83 ec 40          	sub    $0x40,%rsp
+  800806:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80080b:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800810:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800815:	eb 77                	jmp    80088e <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800817:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80081c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800820:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800824:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800829:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80082d:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800831:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800835:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800839:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80083e:	74 3c                	je     80087c <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800840:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800844:	f7 d0                	not    %eax
+  800846:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80084a:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80084e:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800852:	48 63 d0             	movslq %eax,%rdx
+  800855:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80085a:	48 01 d0             	add    %rdx,%rax
+  80085d:	0f b6 00             	movzbl (%rax),%eax
+  800860:	0f b6 c0             	movzbl %al,%eax
+  800863:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800867:	48 63 ca             	movslq %edx,%rcx
+  80086a:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80086f:	48 01 ca             	add    %rcx,%rdx
+  800872:	0f b6 12             	movzbl (%rdx),%edx
+  800875:	0f b6 d2             	movzbl %dl,%edx
+  800878:	29 d0                	sub    %edx,%eax
+  80087a:	eb 6b                	jmp    8008e7 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80087c:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800882:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800888:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80088e:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800894:	77 81                	ja     800817 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800896:	eb 42                	jmp    8008da <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800898:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80089d:	0f b6 10             	movzbl (%rax),%edx
+  8008a0:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8008a5:	0f b6 00             	movzbl (%rax),%eax
+  8008a8:	38 c2                	cmp    %al,%dl
+  8008aa:	74 1c                	je     8008c8 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8008ac:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8008b1:	0f b6 00             	movzbl (%rax),%eax
+  8008b4:	0f b6 c8             	movzbl %al,%ecx
+  8008b7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8008bc:	0f b6 00             	movzbl (%rax),%eax
+  8008bf:	0f b6 d0             	movzbl %al,%edx
+  8008c2:	89 c8                	mov    %ecx,%eax
+  8008c4:	29 d0                	sub    %edx,%eax
+  8008c6:	eb 1f                	jmp    8008e7 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8008c8:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8008ce:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8008d4:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8008da:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8008e0:	75 b6                	jne    800898 <memcmp_avx2+0x9e>
+  return 0;
+  8008e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+00000000008008e9 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8008e9:	55                   	push   %rbp
+  8008ea:	48 89 e5             	mov    %rsp,%rbp
+  8008ed:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8008f1:	48 83 ec 60          	sub    $0x60,%rsp
+  8008f5:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8008fa:	89 f0                	mov    %esi,%eax
+  8008fc:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  800901:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  800905:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80090a:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80090e:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  800913:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  800919:	eb 47                	jmp    800962 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80091b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800920:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800924:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800928:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80092e:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  800932:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800936:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80093a:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80093f:	74 15                	je     800956 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  800941:	31 c0                	xor    %eax,%eax
+  800943:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  800949:	48 63 d0             	movslq %eax,%rdx
+  80094c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800951:	48 01 d0             	add    %rdx,%rax
+  800954:	eb 3d                	jmp    800993 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  800956:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80095c:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800962:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800968:	77 b1                	ja     80091b <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80096a:	eb 0c                	jmp    800978 <memfind_avx2+0x8f>
+  80096c:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  800972:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  800978:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80097e:	74 0e                	je     80098e <memfind_avx2+0xa5>
+  800980:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800985:	0f b6 00             	movzbl (%rax),%eax
+  800988:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80098c:	75 de                	jne    80096c <memfind_avx2+0x83>
+  return s;
+  80098e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  800993:	c9                   	leave
+  800994:	c3                   	ret
+
+0000000000800995 <strlen>:
+strlen(const char *s) {
+  800995:	55                   	push   %rbp
+  800996:	48 89 e5             	mov    %rsp,%rbp
+  800999:	48 83 ec 40          	sub    $0x40,%rsp
+  80099d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8009a1:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8009a5:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8009a9:	48 b8 32 06 80 00 00 	movabs $0x800632,%rax
+  8009b0:	00 00 00 
+  8009b3:	ff d0                	call   *%rax
+  8009b5:	83 e0 02             	and    $0x2,%eax
+  8009b8:	85 c0                	test   %eax,%eax
+  8009ba:	74 18                	je     8009d4 <strlen+0x3f>
+    return strlen_avx2(s);
+  8009bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009c0:	48 89 c7             	mov    %rax,%rdi
+  8009c3:	48 b8 4a 07 80 00 00 	movabs $0x80074a,%rax
+  8009ca:	00 00 00 
+  8009cd:	ff d0                	call   *%rax
+  8009cf:	e9 82 00 00 00       	jmp    800a56 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8009d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009d8:	83 e0 0f             	and    $0xf,%eax
+  8009db:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8009de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8009e1:	48 f7 d8             	neg    %rax
+  8009e4:	48 89 c2             	mov    %rax,%rdx
+  8009e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009eb:	48 01 d0             	add    %rdx,%rax
+  8009ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8009f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009f6:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8009fa:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8009ff:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  800a03:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800a07:	89 c2                	mov    %eax,%edx
+  800a09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a0c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800a11:	89 c1                	mov    %eax,%ecx
+  800a13:	d3 e6                	shl    %cl,%esi
+  800a15:	89 f0                	mov    %esi,%eax
+  800a17:	21 d0                	and    %edx,%eax
+  800a19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800a1c:	eb 1d                	jmp    800a3b <strlen+0xa6>
+    p += 16;
+  800a1e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  800a23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a27:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800a2b:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  800a30:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  800a34:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800a38:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800a3b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800a3f:	74 dd                	je     800a1e <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  800a41:	31 c0                	xor    %eax,%eax
+  800a43:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  800a48:	48 63 d0             	movslq %eax,%rdx
+  800a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a4f:	48 01 d0             	add    %rdx,%rax
+  800a52:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+0000000000800a58 <strnlen>:
+strnlen(const char *s, size_t size) {
+  800a58:	55                   	push   %rbp
+  800a59:	48 89 e5             	mov    %rsp,%rbp
+  800a5c:	48 83 ec 20          	sub    $0x20,%rsp
+  800a60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a64:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a68:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800a6f:	eb 0e                	jmp    800a7f <strnlen+0x27>
+    n++;
+  800a71:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a75:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800a7a:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  800a7f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800a84:	74 0b                	je     800a91 <strnlen+0x39>
+  800a86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8a:	0f b6 00             	movzbl (%rax),%eax
+  800a8d:	84 c0                	test   %al,%al
+  800a8f:	75 e0                	jne    800a71 <strnlen+0x19>
+  return n;
+  800a91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+
+0000000000800a96 <strcpy>:
+strcpy(char *dst, const char *src) {
+  800a96:	55                   	push   %rbp
+  800a97:	48 89 e5             	mov    %rsp,%rbp
+  800a9a:	48 83 ec 20          	sub    $0x20,%rsp
+  800a9e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800aa2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  800aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  800aae:	90                   	nop
+  800aaf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ab3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800ab7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800ac3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac7:	0f b6 12             	movzbl (%rdx),%edx
+  800aca:	88 10                	mov    %dl,(%rax)
+  800acc:	0f b6 00             	movzbl (%rax),%eax
+  800acf:	84 c0                	test   %al,%al
+  800ad1:	75 dc                	jne    800aaf <strcpy+0x19>
+  return ret;
+  800ad3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800ad7:	c9                   	leave
+  800ad8:	c3                   	ret
+
+0000000000800ad9 <strcat>:
+strcat(char *dst, const char *src) {
+  800ad9:	55                   	push   %rbp
+  800ada:	48 89 e5             	mov    %rsp,%rbp
+  800add:	48 83 ec 20          	sub    $0x20,%rsp
+  800ae1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ae5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  800ae9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aed:	48 89 c7             	mov    %rax,%rdi
+  800af0:	48 b8 95 09 80 00 00 	movabs $0x800995,%rax
+  800af7:	00 00 00 
+  800afa:	ff d0                	call   *%rax
+  800afc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  800aff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b02:	48 63 d0             	movslq %eax,%rdx
+  800b05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b09:	48 01 c2             	add    %rax,%rdx
+  800b0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b10:	48 89 c6             	mov    %rax,%rsi
+  800b13:	48 89 d7             	mov    %rdx,%rdi
+  800b16:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  800b1d:	00 00 00 
+  800b20:	ff d0                	call   *%rax
+  return dst;
+  800b22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800b26:	c9                   	leave
+  800b27:	c3                   	ret
+
+0000000000800b28 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  800b28:	55                   	push   %rbp
+  800b29:	48 89 e5             	mov    %rsp,%rbp
+  800b2c:	48 83 ec 28          	sub    $0x28,%rsp
+  800b30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b34:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800b38:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  800b3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b40:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  800b44:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800b4b:	00 
+  800b4c:	eb 2a                	jmp    800b78 <strncpy+0x50>
+    *dst++ = *src;
+  800b4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b52:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b56:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800b5a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800b5e:	0f b6 12             	movzbl (%rdx),%edx
+  800b61:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  800b63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b67:	0f b6 00             	movzbl (%rax),%eax
+  800b6a:	84 c0                	test   %al,%al
+  800b6c:	74 05                	je     800b73 <strncpy+0x4b>
+      src++;
+  800b6e:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  800b73:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800b78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b7c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800b80:	72 cc                	jb     800b4e <strncpy+0x26>
+  return ret;
+  800b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800b86:	c9                   	leave
+  800b87:	c3                   	ret
+
+0000000000800b88 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  800b88:	55                   	push   %rbp
+  800b89:	48 89 e5             	mov    %rsp,%rbp
+  800b8c:	48 83 ec 28          	sub    $0x28,%rsp
+  800b90:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b94:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800b98:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  800b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  800ba4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ba9:	74 3d                	je     800be8 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  800bab:	eb 1d                	jmp    800bca <strlcpy+0x42>
+      *dst++ = *src++;
+  800bad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bb1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  800bb5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800bb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800bc1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bc5:	0f b6 12             	movzbl (%rdx),%edx
+  800bc8:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  800bca:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  800bcf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bd4:	74 0b                	je     800be1 <strlcpy+0x59>
+  800bd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bda:	0f b6 00             	movzbl (%rax),%eax
+  800bdd:	84 c0                	test   %al,%al
+  800bdf:	75 cc                	jne    800bad <strlcpy+0x25>
+    *dst = '\0';
+  800be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be5:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  800be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bec:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  800bf0:	c9                   	leave
+  800bf1:	c3                   	ret
+
+0000000000800bf2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800bf2:	55                   	push   %rbp
+  800bf3:	48 89 e5             	mov    %rsp,%rbp
+  800bf6:	48 83 ec 30          	sub    $0x30,%rsp
+  800bfa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bfe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800c02:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  800c06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c0a:	48 89 c7             	mov    %rax,%rdi
+  800c0d:	48 b8 95 09 80 00 00 	movabs $0x800995,%rax
+  800c14:	00 00 00 
+  800c17:	ff d0                	call   *%rax
+  800c19:	48 98                	cltq
+  800c1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  800c1f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c27:	48 89 d6             	mov    %rdx,%rsi
+  800c2a:	48 89 c7             	mov    %rax,%rdi
+  800c2d:	48 b8 58 0a 80 00 00 	movabs $0x800a58,%rax
+  800c34:	00 00 00 
+  800c37:	ff d0                	call   *%rax
+  800c39:	48 98                	cltq
+  800c3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  800c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c43:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800c47:	75 10                	jne    800c59 <strlcat+0x67>
+    return maxlen + srclen;
+  800c49:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c51:	48 01 d0             	add    %rdx,%rax
+  800c54:	e9 86 00 00 00       	jmp    800cdf <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  800c59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c5d:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  800c61:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800c65:	73 2b                	jae    800c92 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  800c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c6b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c6f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c77:	48 01 c1             	add    %rax,%rcx
+  800c7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c7e:	48 89 c6             	mov    %rax,%rsi
+  800c81:	48 89 cf             	mov    %rcx,%rdi
+  800c84:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+  800c90:	eb 42                	jmp    800cd4 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  800c92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c96:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c9a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ca2:	48 01 c1             	add    %rax,%rcx
+  800ca5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ca9:	48 89 c6             	mov    %rax,%rsi
+  800cac:	48 89 cf             	mov    %rcx,%rdi
+  800caf:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  800cb6:	00 00 00 
+  800cb9:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  800cbb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cc3:	48 01 d0             	add    %rdx,%rax
+  800cc6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cce:	48 01 d0             	add    %rdx,%rax
+  800cd1:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  800cd4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cdc:	48 01 d0             	add    %rdx,%rax
+}
+  800cdf:	c9                   	leave
+  800ce0:	c3                   	ret
+
+0000000000800ce1 <strcmp>:
+strcmp(const char *p, const char *q) {
+  800ce1:	55                   	push   %rbp
+  800ce2:	48 89 e5             	mov    %rsp,%rbp
+  800ce5:	48 83 ec 10          	sub    $0x10,%rsp
+  800ce9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ced:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  800cf1:	eb 0a                	jmp    800cfd <strcmp+0x1c>
+    p++, q++;
+  800cf3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800cf8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  800cfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d01:	0f b6 00             	movzbl (%rax),%eax
+  800d04:	84 c0                	test   %al,%al
+  800d06:	74 12                	je     800d1a <strcmp+0x39>
+  800d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d0c:	0f b6 10             	movzbl (%rax),%edx
+  800d0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d13:	0f b6 00             	movzbl (%rax),%eax
+  800d16:	38 c2                	cmp    %al,%dl
+  800d18:	74 d9                	je     800cf3 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800d1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d1e:	0f b6 00             	movzbl (%rax),%eax
+  800d21:	0f b6 d0             	movzbl %al,%edx
+  800d24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d28:	0f b6 00             	movzbl (%rax),%eax
+  800d2b:	0f b6 c0             	movzbl %al,%eax
+  800d2e:	29 c2                	sub    %eax,%edx
+  800d30:	89 d0                	mov    %edx,%eax
+}
+  800d32:	c9                   	leave
+  800d33:	c3                   	ret
+
+0000000000800d34 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  800d34:	55                   	push   %rbp
+  800d35:	48 89 e5             	mov    %rsp,%rbp
+  800d38:	48 83 ec 18          	sub    $0x18,%rsp
+  800d3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d40:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800d44:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  800d48:	eb 0f                	jmp    800d59 <strncmp+0x25>
+    n--, p++, q++;
+  800d4a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  800d4f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800d54:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  800d59:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d5e:	74 1d                	je     800d7d <strncmp+0x49>
+  800d60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d64:	0f b6 00             	movzbl (%rax),%eax
+  800d67:	84 c0                	test   %al,%al
+  800d69:	74 12                	je     800d7d <strncmp+0x49>
+  800d6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d6f:	0f b6 10             	movzbl (%rax),%edx
+  800d72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d76:	0f b6 00             	movzbl (%rax),%eax
+  800d79:	38 c2                	cmp    %al,%dl
+  800d7b:	74 cd                	je     800d4a <strncmp+0x16>
+  if (n == 0)
+  800d7d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d82:	75 07                	jne    800d8b <strncmp+0x57>
+    return 0;
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d89:	eb 16                	jmp    800da1 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d8f:	0f b6 00             	movzbl (%rax),%eax
+  800d92:	0f b6 d0             	movzbl %al,%edx
+  800d95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d99:	0f b6 00             	movzbl (%rax),%eax
+  800d9c:	0f b6 c0             	movzbl %al,%eax
+  800d9f:	29 c2                	sub    %eax,%edx
+}
+  800da1:	89 d0                	mov    %edx,%eax
+  800da3:	c9                   	leave
+  800da4:	c3                   	ret
+
+0000000000800da5 <strchr>:
+strchr(const char *s, char c) {
+  800da5:	55                   	push   %rbp
+  800da6:	48 89 e5             	mov    %rsp,%rbp
+  800da9:	48 83 ec 60          	sub    $0x60,%rsp
+  800dad:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800db1:	89 f0                	mov    %esi,%eax
+  800db3:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  800db6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dba:	83 e0 0f             	and    $0xf,%eax
+  800dbd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  800dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800dc3:	48 f7 d8             	neg    %rax
+  800dc6:	48 89 c2             	mov    %rax,%rdx
+  800dc9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dcd:	48 01 d0             	add    %rdx,%rax
+  800dd0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  800dd4:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  800dd8:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  800ddc:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  800de0:	66 0f 6e c0          	movd   %eax,%xmm0
+  800de4:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  800de8:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  800dec:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  800df1:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  800df5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800df9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800dfd:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  800e01:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800e06:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  800e0b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800e0f:	89 c2                	mov    %eax,%edx
+  800e11:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800e16:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  800e1b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800e1f:	09 c2                	or     %eax,%edx
+  800e21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e24:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800e29:	89 c1                	mov    %eax,%ecx
+  800e2b:	d3 e6                	shl    %cl,%esi
+  800e2d:	89 f0                	mov    %esi,%eax
+  800e2f:	21 d0                	and    %edx,%eax
+  800e31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800e34:	eb 34                	jmp    800e6a <strchr+0xc5>
+    p += 16;
+  800e36:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  800e3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e3f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  800e43:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  800e47:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800e4c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  800e51:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800e55:	89 c2                	mov    %eax,%edx
+  800e57:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  800e5c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  800e61:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  800e65:	09 d0                	or     %edx,%eax
+  800e67:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  800e6a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e6e:	74 c6                	je     800e36 <strchr+0x91>
+  p += __builtin_ctz(m);
+  800e70:	31 c0                	xor    %eax,%eax
+  800e72:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  800e77:	48 98                	cltq
+  800e79:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  800e7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e81:	0f b6 00             	movzbl (%rax),%eax
+  800e84:	84 c0                	test   %al,%al
+  800e86:	74 06                	je     800e8e <strchr+0xe9>
+  800e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e8c:	eb 05                	jmp    800e93 <strchr+0xee>
+  800e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e93:	c9                   	leave
+  800e94:	c3                   	ret
+
+0000000000800e95 <strfind>:
+strfind(const char *s, char c) {
+  800e95:	55                   	push   %rbp
+  800e96:	48 89 e5             	mov    %rsp,%rbp
+  800e99:	48 83 ec 10          	sub    $0x10,%rsp
+  800e9d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ea1:	89 f0                	mov    %esi,%eax
+  800ea3:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  800ea6:	eb 11                	jmp    800eb9 <strfind+0x24>
+    if (*s == c)
+  800ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800eac:	0f b6 00             	movzbl (%rax),%eax
+  800eaf:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  800eb2:	74 12                	je     800ec6 <strfind+0x31>
+  for (; *s; s++)
+  800eb4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800eb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ebd:	0f b6 00             	movzbl (%rax),%eax
+  800ec0:	84 c0                	test   %al,%al
+  800ec2:	75 e4                	jne    800ea8 <strfind+0x13>
+  800ec4:	eb 01                	jmp    800ec7 <strfind+0x32>
+      break;
+  800ec6:	90                   	nop
+  return (char *)s;
+  800ec7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800ecb:	c9                   	leave
+  800ecc:	c3                   	ret
+
+0000000000800ecd <memset>:
+memset(void *v, int c, size_t n) {
+  800ecd:	55                   	push   %rbp
+  800ece:	48 89 e5             	mov    %rsp,%rbp
+  800ed1:	48 83 ec 38          	sub    $0x38,%rsp
+  800ed5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ed9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800edc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  800ee0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ee4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  800ee8:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  800eed:	76 41                	jbe    800f30 <memset+0x63>
+  800eef:	48 b8 32 06 80 00 00 	movabs $0x800632,%rax
+  800ef6:	00 00 00 
+  800ef9:	ff d0                	call   *%rax
+  800efb:	83 e0 01             	and    $0x1,%eax
+  800efe:	85 c0                	test   %eax,%eax
+  800f00:	74 2e                	je     800f30 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  800f02:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f05:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800f09:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800f0d:	48 89 ce             	mov    %rcx,%rsi
+  800f10:	48 89 f7             	mov    %rsi,%rdi
+  800f13:	48 89 d1             	mov    %rdx,%rcx
+  800f16:	fc                   	cld
+  800f17:	f3 aa                	rep stos %al,%es:(%rdi)
+  800f19:	48 89 ca             	mov    %rcx,%rdx
+  800f1c:	48 89 fe             	mov    %rdi,%rsi
+  800f1f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  800f23:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  800f27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f2b:	e9 a7 00 00 00       	jmp    800fd7 <memset+0x10a>
+  if (n >= 8) {
+  800f30:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  800f35:	0f 86 87 00 00 00    	jbe    800fc2 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  800f3b:	eb 16                	jmp    800f53 <memset+0x86>
+      *p++ = c;
+  800f3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f41:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f45:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800f49:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800f4c:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  800f4e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  800f53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f57:	83 e0 07             	and    $0x7,%eax
+  800f5a:	48 85 c0             	test   %rax,%rax
+  800f5d:	75 de                	jne    800f3d <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  800f5f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f62:	0f b6 c0             	movzbl %al,%eax
+  800f65:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  800f6c:	01 01 01 
+  800f6f:	48 0f af c2          	imul   %rdx,%rax
+  800f73:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  800f77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f7b:	48 c1 e8 03          	shr    $0x3,%rax
+  800f7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  800f83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f87:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800f8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f8f:	48 89 ce             	mov    %rcx,%rsi
+  800f92:	48 89 f7             	mov    %rsi,%rdi
+  800f95:	48 89 d1             	mov    %rdx,%rcx
+  800f98:	fc                   	cld
+  800f99:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  800f9c:	48 89 ca             	mov    %rcx,%rdx
+  800f9f:	48 89 fe             	mov    %rdi,%rsi
+  800fa2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  800fa6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  800faa:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  800faf:	eb 11                	jmp    800fc2 <memset+0xf5>
+    *p++ = c;
+  800fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800fb5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fb9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  800fbd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800fc0:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  800fc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fc6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800fca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fce:	48 85 c0             	test   %rax,%rax
+  800fd1:	75 de                	jne    800fb1 <memset+0xe4>
+  return v;
+  800fd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  800fd7:	c9                   	leave
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	48 83 ec 38          	sub    $0x38,%rsp
+  800fe1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800fe5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800fe9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  800fed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ff1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  800ff5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ff9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  800ffd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801001:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801005:	0f 83 da 00 00 00    	jae    8010e5 <memmove+0x10c>
+  80100b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80100f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801013:	48 01 d0             	add    %rdx,%rax
+  801016:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80101a:	0f 83 c5 00 00 00    	jae    8010e5 <memmove+0x10c>
+    s += n;
+  801020:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801024:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801028:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80102c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801030:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801035:	0f 86 94 00 00 00    	jbe    8010cf <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80103b:	eb 1c                	jmp    801059 <memmove+0x80>
+        *--d = *--s;
+  80103d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801042:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801047:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80104b:	0f b6 10             	movzbl (%rax),%edx
+  80104e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801052:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801054:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80105d:	83 e0 07             	and    $0x7,%eax
+  801060:	48 85 c0             	test   %rax,%rax
+  801063:	75 d8                	jne    80103d <memmove+0x64>
+      nq = n / 8;
+  801065:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801069:	48 c1 e8 03          	shr    $0x3,%rax
+  80106d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801071:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801076:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  80107b:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801080:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801084:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801088:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80108c:	48 89 cf             	mov    %rcx,%rdi
+  80108f:	48 89 d6             	mov    %rdx,%rsi
+  801092:	48 89 c1             	mov    %rax,%rcx
+  801095:	fd                   	std
+  801096:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801099:	fc                   	cld
+  80109a:	48 89 c8             	mov    %rcx,%rax
+  80109d:	48 89 f2             	mov    %rsi,%rdx
+  8010a0:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8010a4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8010a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8010ac:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8010b1:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8010b6:	eb 17                	jmp    8010cf <memmove+0xf6>
+      *--d = *--s;
+  8010b8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8010bd:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8010c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8010c6:	0f b6 10             	movzbl (%rax),%edx
+  8010c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010cd:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8010cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010d3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8010d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8010db:	48 85 c0             	test   %rax,%rax
+  8010de:	75 d8                	jne    8010b8 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8010e0:	e9 f4 00 00 00       	jmp    8011d9 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8010e5:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8010ea:	76 46                	jbe    801132 <memmove+0x159>
+  8010ec:	48 b8 32 06 80 00 00 	movabs $0x800632,%rax
+  8010f3:	00 00 00 
+  8010f6:	ff d0                	call   *%rax
+  8010f8:	83 e0 01             	and    $0x1,%eax
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	74 33                	je     801132 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8010ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801103:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801107:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80110b:	48 89 cf             	mov    %rcx,%rdi
+  80110e:	48 89 d6             	mov    %rdx,%rsi
+  801111:	48 89 c1             	mov    %rax,%rcx
+  801114:	fc                   	cld
+  801115:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801117:	48 89 c8             	mov    %rcx,%rax
+  80111a:	48 89 f2             	mov    %rsi,%rdx
+  80111d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801121:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801125:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801129:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80112d:	e9 ab 00 00 00       	jmp    8011dd <memmove+0x204>
+    if (n >= 8) {
+  801132:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801137:	0f 86 8b 00 00 00    	jbe    8011c8 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80113d:	eb 22                	jmp    801161 <memmove+0x188>
+        *d++ = *s++;
+  80113f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801143:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801147:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80114b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80114f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801153:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801157:	0f b6 12             	movzbl (%rdx),%edx
+  80115a:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80115c:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801161:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801165:	83 e0 07             	and    $0x7,%eax
+  801168:	48 85 c0             	test   %rax,%rax
+  80116b:	75 d2                	jne    80113f <memmove+0x166>
+      nq = n / 8;
+  80116d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801171:	48 c1 e8 03          	shr    $0x3,%rax
+  801175:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801179:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80117d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801181:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801185:	48 89 cf             	mov    %rcx,%rdi
+  801188:	48 89 d6             	mov    %rdx,%rsi
+  80118b:	48 89 c1             	mov    %rax,%rcx
+  80118e:	fc                   	cld
+  80118f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801192:	48 89 c8             	mov    %rcx,%rax
+  801195:	48 89 f2             	mov    %rsi,%rdx
+  801198:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80119c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8011a0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8011a4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8011a9:	eb 1d                	jmp    8011c8 <memmove+0x1ef>
+      *d++ = *s++;
+  8011ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8011af:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8011b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011bf:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8011c3:	0f b6 12             	movzbl (%rdx),%edx
+  8011c6:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8011c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011cc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8011d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8011d4:	48 85 c0             	test   %rax,%rax
+  8011d7:	75 d2                	jne    8011ab <memmove+0x1d2>
+  return dst;
+  8011d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8011dd:	c9                   	leave
+  8011de:	c3                   	ret
+
+00000000008011df <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011df:	55                   	push   %rbp
+  8011e0:	48 89 e5             	mov    %rsp,%rbp
+  8011e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8011e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011ef:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8011f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011f7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8011fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011ff:	48 89 ce             	mov    %rcx,%rsi
+  801202:	48 89 c7             	mov    %rax,%rdi
+  801205:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  80120c:	00 00 00 
+  80120f:	ff d0                	call   *%rax
+}
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+
+0000000000801213 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801213:	55                   	push   %rbp
+  801214:	48 89 e5             	mov    %rsp,%rbp
+  801217:	48 83 ec 40          	sub    $0x40,%rsp
+  80121b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80121f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801223:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801227:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80122b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80122f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801233:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801237:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80123c:	0f 86 a7 00 00 00    	jbe    8012e9 <memcmp+0xd6>
+  801242:	48 b8 32 06 80 00 00 	movabs $0x800632,%rax
+  801249:	00 00 00 
+  80124c:	ff d0                	call   *%rax
+  80124e:	83 e0 02             	and    $0x2,%eax
+  801251:	85 c0                	test   %eax,%eax
+  801253:	0f 84 90 00 00 00    	je     8012e9 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801259:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80125d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801261:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801265:	48 89 ce             	mov    %rcx,%rsi
+  801268:	48 89 c7             	mov    %rax,%rdi
+  80126b:	48 b8 fa 07 80 00 00 	movabs $0x8007fa,%rax
+  801272:	00 00 00 
+  801275:	ff d0                	call   *%rax
+  801277:	e9 c2 00 00 00       	jmp    80133e <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  80127c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801280:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801284:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801288:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80128c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801290:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801294:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801298:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80129b:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8012a2:	74 36                	je     8012da <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8012a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012a7:	f7 d0                	not    %eax
+  8012a9:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8012ad:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8012b0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8012b3:	48 63 d0             	movslq %eax,%rdx
+  8012b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ba:	48 01 d0             	add    %rdx,%rax
+  8012bd:	0f b6 00             	movzbl (%rax),%eax
+  8012c0:	0f b6 c0             	movzbl %al,%eax
+  8012c3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8012c6:	48 63 ca             	movslq %edx,%rcx
+  8012c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012cd:	48 01 ca             	add    %rcx,%rdx
+  8012d0:	0f b6 12             	movzbl (%rdx),%edx
+  8012d3:	0f b6 d2             	movzbl %dl,%edx
+  8012d6:	29 d0                	sub    %edx,%eax
+  8012d8:	eb 64                	jmp    80133e <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8012da:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8012df:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8012e4:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  8012e9:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  8012ee:	77 8c                	ja     80127c <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  8012f0:	eb 36                	jmp    801328 <memcmp+0x115>
+    if (*s1 != *s2)
+  8012f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f6:	0f b6 10             	movzbl (%rax),%edx
+  8012f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012fd:	0f b6 00             	movzbl (%rax),%eax
+  801300:	38 c2                	cmp    %al,%dl
+  801302:	74 1a                	je     80131e <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801304:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801308:	0f b6 00             	movzbl (%rax),%eax
+  80130b:	0f b6 c8             	movzbl %al,%ecx
+  80130e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801312:	0f b6 00             	movzbl (%rax),%eax
+  801315:	0f b6 d0             	movzbl %al,%edx
+  801318:	89 c8                	mov    %ecx,%eax
+  80131a:	29 d0                	sub    %edx,%eax
+  80131c:	eb 20                	jmp    80133e <memcmp+0x12b>
+    s1++, s2++;
+  80131e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801323:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801328:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80132c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801330:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801334:	48 85 c0             	test   %rax,%rax
+  801337:	75 b9                	jne    8012f2 <memcmp+0xdf>
+  }
+
+  return 0;
+  801339:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+
+0000000000801340 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+  801344:	48 83 ec 50          	sub    $0x50,%rsp
+  801348:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80134c:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80134f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801353:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801357:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80135b:	48 01 d0             	add    %rdx,%rax
+  80135e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801362:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801365:	66 0f 6e c0          	movd   %eax,%xmm0
+  801369:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80136d:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801371:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801376:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80137a:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  80137f:	76 73                	jbe    8013f4 <memfind+0xb4>
+  801381:	48 b8 32 06 80 00 00 	movabs $0x800632,%rax
+  801388:	00 00 00 
+  80138b:	ff d0                	call   *%rax
+  80138d:	83 e0 02             	and    $0x2,%eax
+  801390:	85 c0                	test   %eax,%eax
+  801392:	74 60                	je     8013f4 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801394:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801397:	0f b6 c8             	movzbl %al,%ecx
+  80139a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80139e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013a2:	89 ce                	mov    %ecx,%esi
+  8013a4:	48 89 c7             	mov    %rax,%rdi
+  8013a7:	48 b8 e9 08 80 00 00 	movabs $0x8008e9,%rax
+  8013ae:	00 00 00 
+  8013b1:	ff d0                	call   *%rax
+  8013b3:	eb 6c                	jmp    801421 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8013b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013b9:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8013bd:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8013c1:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8013c6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8013ca:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8013ce:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8013d1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8013d5:	74 13                	je     8013ea <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  8013d7:	31 c0                	xor    %eax,%eax
+  8013d9:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  8013de:	48 63 d0             	movslq %eax,%rdx
+  8013e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013e5:	48 01 d0             	add    %rdx,%rax
+  8013e8:	eb 37                	jmp    801421 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  8013ea:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  8013ef:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  8013f4:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  8013f9:	77 ba                	ja     8013b5 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  8013fb:	eb 13                	jmp    801410 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  8013fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801401:	0f b6 00             	movzbl (%rax),%eax
+  801404:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801407:	38 d0                	cmp    %dl,%al
+  801409:	74 11                	je     80141c <memfind+0xdc>
+  for (; s < ends; s++)
+  80140b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801410:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801414:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801418:	72 e3                	jb     8013fd <memfind+0xbd>
+  80141a:	eb 01                	jmp    80141d <memfind+0xdd>
+      break;
+  80141c:	90                   	nop
+  return (void *)s;
+  80141d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801421:	c9                   	leave
+  801422:	c3                   	ret
+
+0000000000801423 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801423:	55                   	push   %rbp
+  801424:	48 89 e5             	mov    %rsp,%rbp
+  801427:	48 83 ec 38          	sub    $0x38,%rsp
+  80142b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80142f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801433:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801436:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  80143d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801444:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801445:	eb 05                	jmp    80144c <strtol+0x29>
+    s++;
+  801447:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80144c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801450:	0f b6 00             	movzbl (%rax),%eax
+  801453:	3c 20                	cmp    $0x20,%al
+  801455:	74 f0                	je     801447 <strtol+0x24>
+  801457:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80145b:	0f b6 00             	movzbl (%rax),%eax
+  80145e:	3c 09                	cmp    $0x9,%al
+  801460:	74 e5                	je     801447 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801462:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801466:	0f b6 00             	movzbl (%rax),%eax
+  801469:	3c 2b                	cmp    $0x2b,%al
+  80146b:	75 07                	jne    801474 <strtol+0x51>
+    s++;
+  80146d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801472:	eb 17                	jmp    80148b <strtol+0x68>
+  else if (*s == '-')
+  801474:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801478:	0f b6 00             	movzbl (%rax),%eax
+  80147b:	3c 2d                	cmp    $0x2d,%al
+  80147d:	75 0c                	jne    80148b <strtol+0x68>
+    s++, neg = 1;
+  80147f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801484:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80148b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80148f:	74 06                	je     801497 <strtol+0x74>
+  801491:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801495:	75 28                	jne    8014bf <strtol+0x9c>
+  801497:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80149b:	0f b6 00             	movzbl (%rax),%eax
+  80149e:	3c 30                	cmp    $0x30,%al
+  8014a0:	75 1d                	jne    8014bf <strtol+0x9c>
+  8014a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014a6:	48 83 c0 01          	add    $0x1,%rax
+  8014aa:	0f b6 00             	movzbl (%rax),%eax
+  8014ad:	3c 78                	cmp    $0x78,%al
+  8014af:	75 0e                	jne    8014bf <strtol+0x9c>
+    s += 2, base = 16;
+  8014b1:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8014b6:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8014bd:	eb 2c                	jmp    8014eb <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8014bf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8014c3:	75 19                	jne    8014de <strtol+0xbb>
+  8014c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014c9:	0f b6 00             	movzbl (%rax),%eax
+  8014cc:	3c 30                	cmp    $0x30,%al
+  8014ce:	75 0e                	jne    8014de <strtol+0xbb>
+    s++, base = 8;
+  8014d0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8014d5:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8014dc:	eb 0d                	jmp    8014eb <strtol+0xc8>
+  else if (base == 0)
+  8014de:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8014e2:	75 07                	jne    8014eb <strtol+0xc8>
+    base = 10;
+  8014e4:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  8014eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ef:	0f b6 00             	movzbl (%rax),%eax
+  8014f2:	3c 2f                	cmp    $0x2f,%al
+  8014f4:	7e 1d                	jle    801513 <strtol+0xf0>
+  8014f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014fa:	0f b6 00             	movzbl (%rax),%eax
+  8014fd:	3c 39                	cmp    $0x39,%al
+  8014ff:	7f 12                	jg     801513 <strtol+0xf0>
+      dig = *s - '0';
+  801501:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801505:	0f b6 00             	movzbl (%rax),%eax
+  801508:	0f be c0             	movsbl %al,%eax
+  80150b:	83 e8 30             	sub    $0x30,%eax
+  80150e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801511:	eb 4e                	jmp    801561 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801513:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801517:	0f b6 00             	movzbl (%rax),%eax
+  80151a:	3c 60                	cmp    $0x60,%al
+  80151c:	7e 1d                	jle    80153b <strtol+0x118>
+  80151e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801522:	0f b6 00             	movzbl (%rax),%eax
+  801525:	3c 7a                	cmp    $0x7a,%al
+  801527:	7f 12                	jg     80153b <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801529:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80152d:	0f b6 00             	movzbl (%rax),%eax
+  801530:	0f be c0             	movsbl %al,%eax
+  801533:	83 e8 57             	sub    $0x57,%eax
+  801536:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801539:	eb 26                	jmp    801561 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80153b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80153f:	0f b6 00             	movzbl (%rax),%eax
+  801542:	3c 40                	cmp    $0x40,%al
+  801544:	7e 47                	jle    80158d <strtol+0x16a>
+  801546:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80154a:	0f b6 00             	movzbl (%rax),%eax
+  80154d:	3c 5a                	cmp    $0x5a,%al
+  80154f:	7f 3c                	jg     80158d <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801551:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801555:	0f b6 00             	movzbl (%rax),%eax
+  801558:	0f be c0             	movsbl %al,%eax
+  80155b:	83 e8 37             	sub    $0x37,%eax
+  80155e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801561:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801564:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801567:	7d 23                	jge    80158c <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801569:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80156e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801571:	48 98                	cltq
+  801573:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801578:	48 89 c2             	mov    %rax,%rdx
+  80157b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80157e:	48 98                	cltq
+  801580:	48 01 d0             	add    %rdx,%rax
+  801583:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801587:	e9 5f ff ff ff       	jmp    8014eb <strtol+0xc8>
+      break;
+  80158c:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  80158d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801592:	74 0b                	je     80159f <strtol+0x17c>
+    *endptr = (char *)s;
+  801594:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801598:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80159c:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80159f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015a3:	74 09                	je     8015ae <strtol+0x18b>
+  8015a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a9:	48 f7 d8             	neg    %rax
+  8015ac:	eb 04                	jmp    8015b2 <strtol+0x18f>
+  8015ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+
+00000000008015b4 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8015b4:	55                   	push   %rbp
+  8015b5:	48 89 e5             	mov    %rsp,%rbp
+  8015b8:	53                   	push   %rbx
+  8015b9:	48 83 ec 48          	sub    $0x48,%rsp
+  8015bd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8015c1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8015c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8015c9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8015cd:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8015d1:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8015d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8015dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8015e1:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8015e5:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8015e9:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8015ed:	4c 89 c3             	mov    %r8,%rbx
+  8015f0:	cd 30                	int    $0x30
+  8015f2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8015f6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8015fb:	74 46                	je     801643 <syscall+0x8f>
+  8015fd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801602:	7e 3f                	jle    801643 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801604:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801608:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80160c:	49 89 d0             	mov    %rdx,%r8
+  80160f:	48 89 c1             	mov    %rax,%rcx
+  801612:	48 b8 e8 5b 80 00 00 	movabs $0x805be8,%rax
+  801619:	00 00 00 
+  80161c:	48 89 c2             	mov    %rax,%rdx
+  80161f:	be 22 00 00 00       	mov    $0x22,%esi
+  801624:	48 b8 07 5c 80 00 00 	movabs $0x805c07,%rax
+  80162b:	00 00 00 
+  80162e:	48 89 c7             	mov    %rax,%rdi
+  801631:	b8 00 00 00 00       	mov    $0x0,%eax
+  801636:	49 b9 ef 49 80 00 00 	movabs $0x8049ef,%r9
+  80163d:	00 00 00 
+  801640:	41 ff d1             	call   *%r9
+
+  return ret;
+  801643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801647:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+
+000000000080164d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	48 83 ec 10          	sub    $0x10,%rsp
+  801655:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801659:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80165d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801665:	48 83 ec 08          	sub    $0x8,%rsp
+  801669:	6a 00                	push   $0x0
+  80166b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801677:	48 89 d1             	mov    %rdx,%rcx
+  80167a:	48 89 c2             	mov    %rax,%rdx
+  80167d:	be 00 00 00 00       	mov    $0x0,%esi
+  801682:	bf 00 00 00 00       	mov    $0x0,%edi
+  801687:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  80168e:	00 00 00 
+  801691:	ff d0                	call   *%rax
+  801693:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801697:	90                   	nop
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+000000000080169a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80169e:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a2:	6a 00                	push   $0x0
+  8016a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8016aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bf:	bf 01 00 00 00       	mov    $0x1,%edi
+  8016c4:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  8016cb:	00 00 00 
+  8016ce:	ff d0                	call   *%rax
+  8016d0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8016d4:	c9                   	leave
+  8016d5:	c3                   	ret
+
+00000000008016d6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	48 83 ec 10          	sub    $0x10,%rsp
+  8016de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8016e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016e4:	48 98                	cltq
+  8016e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8016f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016fd:	48 89 c2             	mov    %rax,%rdx
+  801700:	be 01 00 00 00       	mov    $0x1,%esi
+  801705:	bf 03 00 00 00       	mov    $0x3,%edi
+  80170a:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801711:	00 00 00 
+  801714:	ff d0                	call   *%rax
+  801716:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+000000000080171c <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80171c:	55                   	push   %rbp
+  80171d:	48 89 e5             	mov    %rsp,%rbp
+  801720:	48 83 ec 10          	sub    $0x10,%rsp
+  801724:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801727:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80172a:	48 98                	cltq
+  80172c:	48 83 ec 08          	sub    $0x8,%rsp
+  801730:	6a 00                	push   $0x0
+  801732:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801738:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80173e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801743:	48 89 c2             	mov    %rax,%rdx
+  801746:	be 00 00 00 00       	mov    $0x0,%esi
+  80174b:	bf 04 00 00 00       	mov    $0x4,%edi
+  801750:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801757:	00 00 00 
+  80175a:	ff d0                	call   *%rax
+  80175c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801760:	90                   	nop
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	48 83 ec 20          	sub    $0x20,%rsp
+  80176b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80176e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801772:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801775:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801778:	b8 05 00 00 00       	mov    $0x5,%eax
+  80177d:	cd 30                	int    $0x30
+  80177f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801783:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801787:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80178c:	7e 3d                	jle    8017cb <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80178e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801792:	49 89 c0             	mov    %rax,%r8
+  801795:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80179a:	48 b8 e8 5b 80 00 00 	movabs $0x805be8,%rax
+  8017a1:	00 00 00 
+  8017a4:	48 89 c2             	mov    %rax,%rdx
+  8017a7:	be 49 00 00 00       	mov    $0x49,%esi
+  8017ac:	48 b8 07 5c 80 00 00 	movabs $0x805c07,%rax
+  8017b3:	00 00 00 
+  8017b6:	48 89 c7             	mov    %rax,%rdi
+  8017b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017be:	49 b9 ef 49 80 00 00 	movabs $0x8049ef,%r9
+  8017c5:	00 00 00 
+  8017c8:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8017cb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8017d0:	75 13                	jne    8017e5 <sys_env_wait+0x82>
+  8017d2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8017d7:	74 0c                	je     8017e5 <sys_env_wait+0x82>
+    *status = st;
+  8017d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017dd:	89 c2                	mov    %eax,%edx
+  8017df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017e3:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8017e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+
+00000000008017eb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8017eb:	55                   	push   %rbp
+  8017ec:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8017ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8017f3:	6a 00                	push   $0x0
+  8017f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8017fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801801:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801806:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180b:	be 00 00 00 00       	mov    $0x0,%esi
+  801810:	bf 02 00 00 00       	mov    $0x2,%edi
+  801815:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  80181c:	00 00 00 
+  80181f:	ff d0                	call   *%rax
+  801821:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+0000000000801827 <sys_yield>:
+
+void
+sys_yield(void) {
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80182b:	48 83 ec 08          	sub    $0x8,%rsp
+  80182f:	6a 00                	push   $0x0
+  801831:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801837:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80183d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801842:	ba 00 00 00 00       	mov    $0x0,%edx
+  801847:	be 00 00 00 00       	mov    $0x0,%esi
+  80184c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801851:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+  80185d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801861:	90                   	nop
+  801862:	c9                   	leave
+  801863:	c3                   	ret
+
+0000000000801864 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801864:	55                   	push   %rbp
+  801865:	48 89 e5             	mov    %rsp,%rbp
+  801868:	48 83 ec 20          	sub    $0x20,%rsp
+  80186c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80186f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801873:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801876:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801879:	48 63 c8             	movslq %eax,%rcx
+  80187c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801880:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801883:	48 98                	cltq
+  801885:	48 83 ec 08          	sub    $0x8,%rsp
+  801889:	6a 00                	push   $0x0
+  80188b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801891:	49 89 c8             	mov    %rcx,%r8
+  801894:	48 89 d1             	mov    %rdx,%rcx
+  801897:	48 89 c2             	mov    %rax,%rdx
+  80189a:	be 01 00 00 00       	mov    $0x1,%esi
+  80189f:	bf 06 00 00 00       	mov    $0x6,%edi
+  8018a4:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  8018ab:	00 00 00 
+  8018ae:	ff d0                	call   *%rax
+  8018b0:	48 83 c4 10          	add    $0x10,%rsp
+  8018b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8018b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8018ba:	c9                   	leave
+  8018bb:	c3                   	ret
+
+00000000008018bc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8018c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8018c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018cb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8018ce:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018d2:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8018d6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8018d9:	48 63 c8             	movslq %eax,%rcx
+  8018dc:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8018e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8018e3:	48 63 f0             	movslq %eax,%rsi
+  8018e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8018ed:	48 98                	cltq
+  8018ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f3:	51                   	push   %rcx
+  8018f4:	49 89 f9             	mov    %rdi,%r9
+  8018f7:	49 89 f0             	mov    %rsi,%r8
+  8018fa:	48 89 d1             	mov    %rdx,%rcx
+  8018fd:	48 89 c2             	mov    %rax,%rdx
+  801900:	be 01 00 00 00       	mov    $0x1,%esi
+  801905:	bf 07 00 00 00       	mov    $0x7,%edi
+  80190a:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801911:	00 00 00 
+  801914:	ff d0                	call   *%rax
+  801916:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80191a:	c9                   	leave
+  80191b:	c3                   	ret
+
+000000000080191c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	48 83 ec 10          	sub    $0x10,%rsp
+  801924:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801927:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80192b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80192f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801932:	48 98                	cltq
+  801934:	48 83 ec 08          	sub    $0x8,%rsp
+  801938:	6a 00                	push   $0x0
+  80193a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801940:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801946:	48 89 d1             	mov    %rdx,%rcx
+  801949:	48 89 c2             	mov    %rax,%rdx
+  80194c:	be 01 00 00 00       	mov    $0x1,%esi
+  801951:	bf 08 00 00 00       	mov    $0x8,%edi
+  801956:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  80195d:	00 00 00 
+  801960:	ff d0                	call   *%rax
+  801962:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	48 83 ec 10          	sub    $0x10,%rsp
+  801970:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801973:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801976:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801979:	48 63 d0             	movslq %eax,%rdx
+  80197c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80197f:	48 98                	cltq
+  801981:	48 83 ec 08          	sub    $0x8,%rsp
+  801985:	6a 00                	push   $0x0
+  801987:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80198d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801993:	48 89 d1             	mov    %rdx,%rcx
+  801996:	48 89 c2             	mov    %rax,%rdx
+  801999:	be 01 00 00 00       	mov    $0x1,%esi
+  80199e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8019a3:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  8019aa:	00 00 00 
+  8019ad:	ff d0                	call   *%rax
+  8019af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8019b3:	c9                   	leave
+  8019b4:	c3                   	ret
+
+00000000008019b5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8019b5:	55                   	push   %rbp
+  8019b6:	48 89 e5             	mov    %rsp,%rbp
+  8019b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8019c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8019c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019cb:	48 98                	cltq
+  8019cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8019d1:	6a 00                	push   $0x0
+  8019d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8019d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019df:	48 89 d1             	mov    %rdx,%rcx
+  8019e2:	48 89 c2             	mov    %rax,%rdx
+  8019e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8019ea:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8019ef:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  8019f6:	00 00 00 
+  8019f9:	ff d0                	call   *%rax
+  8019fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8019ff:	c9                   	leave
+  801a00:	c3                   	ret
+
+0000000000801a01 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	48 83 ec 10          	sub    $0x10,%rsp
+  801a09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a0c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  801a10:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a17:	48 98                	cltq
+  801a19:	48 83 ec 08          	sub    $0x8,%rsp
+  801a1d:	6a 00                	push   $0x0
+  801a1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a2b:	48 89 d1             	mov    %rdx,%rcx
+  801a2e:	48 89 c2             	mov    %rax,%rdx
+  801a31:	be 01 00 00 00       	mov    $0x1,%esi
+  801a36:	bf 0c 00 00 00       	mov    $0xc,%edi
+  801a3b:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801a42:	00 00 00 
+  801a45:	ff d0                	call   *%rax
+  801a47:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801a4b:	c9                   	leave
+  801a4c:	c3                   	ret
+
+0000000000801a4d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	48 83 ec 20          	sub    $0x20,%rsp
+  801a55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a5c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801a60:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  801a63:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801a66:	48 63 f0             	movslq %eax,%rsi
+  801a69:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a6d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a74:	48 98                	cltq
+  801a76:	48 83 ec 08          	sub    $0x8,%rsp
+  801a7a:	6a 00                	push   $0x0
+  801a7c:	49 89 f1             	mov    %rsi,%r9
+  801a7f:	49 89 c8             	mov    %rcx,%r8
+  801a82:	48 89 d1             	mov    %rdx,%rcx
+  801a85:	48 89 c2             	mov    %rax,%rdx
+  801a88:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801a92:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801a99:	00 00 00 
+  801a9c:	ff d0                	call   *%rax
+  801a9e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801aa2:	c9                   	leave
+  801aa3:	c3                   	ret
+
+0000000000801aa4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	48 83 ec 10          	sub    $0x10,%rsp
+  801aac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  801ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ab4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ab8:	6a 00                	push   $0x0
+  801aba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ac0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ac6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acb:	48 89 c2             	mov    %rax,%rdx
+  801ace:	be 01 00 00 00       	mov    $0x1,%esi
+  801ad3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  801ad8:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+0000000000801aea <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	48 83 ec 10          	sub    $0x10,%rsp
+  801af2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801af6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  801afa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801afe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b02:	48 83 ec 08          	sub    $0x8,%rsp
+  801b06:	6a 00                	push   $0x0
+  801b08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b14:	48 89 d1             	mov    %rdx,%rcx
+  801b17:	48 89 c2             	mov    %rax,%rdx
+  801b1a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b1f:	bf 10 00 00 00       	mov    $0x10,%edi
+  801b24:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801b2b:	00 00 00 
+  801b2e:	ff d0                	call   *%rax
+  801b30:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+0000000000801b36 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  801b3a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b3e:	6a 00                	push   $0x0
+  801b40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b56:	be 00 00 00 00       	mov    $0x0,%esi
+  801b5b:	bf 11 00 00 00       	mov    $0x11,%edi
+  801b60:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801b67:	00 00 00 
+  801b6a:	ff d0                	call   *%rax
+  801b6c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801b70:	c9                   	leave
+  801b71:	c3                   	ret
+
+0000000000801b72 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  801b72:	55                   	push   %rbp
+  801b73:	48 89 e5             	mov    %rsp,%rbp
+  801b76:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  801b82:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b8e:	6a 00                	push   $0x0
+  801b90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801b96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b9c:	48 89 d1             	mov    %rdx,%rcx
+  801b9f:	48 89 c2             	mov    %rax,%rdx
+  801ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba7:	bf 12 00 00 00       	mov    $0x12,%edi
+  801bac:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+  801bb8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801bbc:	c9                   	leave
+  801bbd:	c3                   	ret
+
+0000000000801bbe <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  801bbe:	55                   	push   %rbp
+  801bbf:	48 89 e5             	mov    %rsp,%rbp
+  801bc2:	48 83 ec 20          	sub    $0x20,%rsp
+  801bc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801bce:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  801bd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bd4:	48 63 c8             	movslq %eax,%rcx
+  801bd7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bdf:	48 83 ec 08          	sub    $0x8,%rsp
+  801be3:	6a 00                	push   $0x0
+  801be5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801beb:	49 89 c8             	mov    %rcx,%r8
+  801bee:	48 89 d1             	mov    %rdx,%rcx
+  801bf1:	48 89 c2             	mov    %rax,%rdx
+  801bf4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bf9:	bf 13 00 00 00       	mov    $0x13,%edi
+  801bfe:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c0e:	c9                   	leave
+  801c0f:	c3                   	ret
+
+0000000000801c10 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  801c10:	55                   	push   %rbp
+  801c11:	48 89 e5             	mov    %rsp,%rbp
+  801c14:	48 83 ec 20          	sub    $0x20,%rsp
+  801c18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c1c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801c1f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  801c23:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c27:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c2e:	48 83 ec 08          	sub    $0x8,%rsp
+  801c32:	6a 00                	push   $0x0
+  801c34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c3a:	49 89 c8             	mov    %rcx,%r8
+  801c3d:	48 89 d1             	mov    %rdx,%rcx
+  801c40:	48 89 c2             	mov    %rax,%rdx
+  801c43:	be 00 00 00 00       	mov    $0x0,%esi
+  801c48:	bf 14 00 00 00       	mov    $0x14,%edi
+  801c4d:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+  801c59:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+
+0000000000801c5f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	48 83 ec 10          	sub    $0x10,%rsp
+  801c67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c6b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  801c6e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c71:	48 63 d0             	movslq %eax,%rdx
+  801c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c78:	48 83 ec 08          	sub    $0x8,%rsp
+  801c7c:	6a 00                	push   $0x0
+  801c7e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c8a:	48 89 d1             	mov    %rdx,%rcx
+  801c8d:	48 89 c2             	mov    %rax,%rdx
+  801c90:	be 00 00 00 00       	mov    $0x0,%esi
+  801c95:	bf 15 00 00 00       	mov    $0x15,%edi
+  801c9a:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801caa:	c9                   	leave
+  801cab:	c3                   	ret
+
+0000000000801cac <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	48 83 ec 20          	sub    $0x20,%rsp
+  801cb4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cb8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801cbb:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  801cbe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  801cc2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801cc6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801cc9:	48 63 c8             	movslq %eax,%rcx
+  801ccc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ccf:	48 63 d0             	movslq %eax,%rdx
+  801cd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cd6:	48 83 ec 08          	sub    $0x8,%rsp
+  801cda:	6a 00                	push   $0x0
+  801cdc:	49 89 f1             	mov    %rsi,%r9
+  801cdf:	49 89 c8             	mov    %rcx,%r8
+  801ce2:	48 89 d1             	mov    %rdx,%rcx
+  801ce5:	48 89 c2             	mov    %rax,%rdx
+  801ce8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ced:	bf 16 00 00 00       	mov    $0x16,%edi
+  801cf2:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801cf9:	00 00 00 
+  801cfc:	ff d0                	call   *%rax
+  801cfe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d02:	c9                   	leave
+  801d03:	c3                   	ret
+
+0000000000801d04 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  801d04:	55                   	push   %rbp
+  801d05:	48 89 e5             	mov    %rsp,%rbp
+  801d08:	48 83 ec 30          	sub    $0x30,%rsp
+  801d0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d14:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801d18:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  801d1c:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  801d20:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801d24:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801d28:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  801d2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d34:	48 83 ec 08          	sub    $0x8,%rsp
+  801d38:	51                   	push   %rcx
+  801d39:	49 89 f9             	mov    %rdi,%r9
+  801d3c:	49 89 f0             	mov    %rsi,%r8
+  801d3f:	48 89 d1             	mov    %rdx,%rcx
+  801d42:	48 89 c2             	mov    %rax,%rdx
+  801d45:	be 00 00 00 00       	mov    $0x0,%esi
+  801d4a:	bf 17 00 00 00       	mov    $0x17,%edi
+  801d4f:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801d56:	00 00 00 
+  801d59:	ff d0                	call   *%rax
+  801d5b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d5f:	c9                   	leave
+  801d60:	c3                   	ret
+
+0000000000801d61 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+  801d65:	48 83 ec 10          	sub    $0x10,%rsp
+  801d69:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  801d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d6f:	48 98                	cltq
+  801d71:	48 83 ec 08          	sub    $0x8,%rsp
+  801d75:	6a 00                	push   $0x0
+  801d77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d88:	48 89 c2             	mov    %rax,%rdx
+  801d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d90:	bf 18 00 00 00       	mov    $0x18,%edi
+  801d95:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+  801da1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801da5:	90                   	nop
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+0000000000801da8 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  801da8:	55                   	push   %rbp
+  801da9:	48 89 e5             	mov    %rsp,%rbp
+  801dac:	48 83 ec 30          	sub    $0x30,%rsp
+  801db0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801db3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801db7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801dbb:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  801dbe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801dc1:	48 63 f0             	movslq %eax,%rsi
+  801dc4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801dc8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dcf:	48 98                	cltq
+  801dd1:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd5:	6a 00                	push   $0x0
+  801dd7:	49 89 f1             	mov    %rsi,%r9
+  801dda:	49 89 c8             	mov    %rcx,%r8
+  801ddd:	48 89 d1             	mov    %rdx,%rcx
+  801de0:	48 89 c2             	mov    %rax,%rdx
+  801de3:	be 01 00 00 00       	mov    $0x1,%esi
+  801de8:	bf 19 00 00 00       	mov    $0x19,%edi
+  801ded:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801df4:	00 00 00 
+  801df7:	ff d0                	call   *%rax
+  801df9:	48 83 c4 10          	add    $0x10,%rsp
+  801dfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  801e00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+0000000000801e05 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  801e05:	55                   	push   %rbp
+  801e06:	48 89 e5             	mov    %rsp,%rbp
+  801e09:	48 83 ec 20          	sub    $0x20,%rsp
+  801e0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e15:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  801e18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e1b:	48 63 c8             	movslq %eax,%rcx
+  801e1e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e26:	48 83 ec 08          	sub    $0x8,%rsp
+  801e2a:	6a 00                	push   $0x0
+  801e2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e32:	49 89 c8             	mov    %rcx,%r8
+  801e35:	48 89 d1             	mov    %rdx,%rcx
+  801e38:	48 89 c2             	mov    %rax,%rdx
+  801e3b:	be 01 00 00 00       	mov    $0x1,%esi
+  801e40:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  801e45:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+  801e51:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e55:	c9                   	leave
+  801e56:	c3                   	ret
+
+0000000000801e57 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  801e57:	55                   	push   %rbp
+  801e58:	48 89 e5             	mov    %rsp,%rbp
+  801e5b:	48 83 ec 20          	sub    $0x20,%rsp
+  801e5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e67:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  801e6b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801e6f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e77:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7b:	6a 00                	push   $0x0
+  801e7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e83:	49 89 c8             	mov    %rcx,%r8
+  801e86:	48 89 d1             	mov    %rdx,%rcx
+  801e89:	48 89 c2             	mov    %rax,%rdx
+  801e8c:	be 01 00 00 00       	mov    $0x1,%esi
+  801e91:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  801e96:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801e9d:	00 00 00 
+  801ea0:	ff d0                	call   *%rax
+  801ea2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	48 83 ec 30          	sub    $0x30,%rsp
+  801eb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801eb4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801eb8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  801ebb:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  801ebf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  801ec3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ec6:	48 63 c8             	movslq %eax,%rcx
+  801ec9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ecd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ed1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed5:	6a 00                	push   $0x0
+  801ed7:	49 89 f1             	mov    %rsi,%r9
+  801eda:	49 89 c8             	mov    %rcx,%r8
+  801edd:	48 89 d1             	mov    %rdx,%rcx
+  801ee0:	48 89 c2             	mov    %rax,%rdx
+  801ee3:	be 01 00 00 00       	mov    $0x1,%esi
+  801ee8:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  801eed:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+  801ef9:	48 83 c4 10          	add    $0x10,%rsp
+  801efd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  801f00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801f03:	c9                   	leave
+  801f04:	c3                   	ret
+
+0000000000801f05 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  801f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f13:	48 98                	cltq
+  801f15:	48 83 ec 08          	sub    $0x8,%rsp
+  801f19:	6a 00                	push   $0x0
+  801f1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f21:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f2c:	48 89 c2             	mov    %rax,%rdx
+  801f2f:	be 01 00 00 00       	mov    $0x1,%esi
+  801f34:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  801f39:	48 b8 b4 15 80 00 00 	movabs $0x8015b4,%rax
+  801f40:	00 00 00 
+  801f43:	ff d0                	call   *%rax
+  801f45:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f49:	c9                   	leave
+  801f4a:	c3                   	ret
+
+0000000000801f4b <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+  801f4b:	55                   	push   %rbp
+  801f4c:	48 89 e5             	mov    %rsp,%rbp
+  801f4f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f5b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  args->argc     = argc;
+  801f5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f63:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f67:	48 89 10             	mov    %rdx,(%rax)
+  args->argv     = (const char **)argv;
+  801f6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f6e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f72:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  args->curarg   = (*argc > 1 && argv ? "" : 0);
+  801f76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f7a:	8b 00                	mov    (%rax),%eax
+  801f7c:	83 f8 01             	cmp    $0x1,%eax
+  801f7f:	7e 13                	jle    801f94 <argstart+0x49>
+  801f81:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801f86:	74 0c                	je     801f94 <argstart+0x49>
+  801f88:	48 ba 15 5c 80 00 00 	movabs $0x805c15,%rdx
+  801f8f:	00 00 00 
+  801f92:	eb 05                	jmp    801f99 <argstart+0x4e>
+  801f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f9d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  args->argvalue = 0;
+  801fa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fa5:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  801fac:	00 
+}
+  801fad:	90                   	nop
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+0000000000801fb0 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	48 83 ec 20          	sub    $0x20,%rsp
+  801fb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int arg;
+
+  args->argvalue = 0;
+  801fbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fc0:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  801fc7:	00 
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  801fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fcc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fd0:	48 85 c0             	test   %rax,%rax
+  801fd3:	75 0a                	jne    801fdf <argnext+0x2f>
+    return -1;
+  801fd5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801fda:	e9 27 01 00 00       	jmp    802106 <argnext+0x156>
+
+  if (!*args->curarg) {
+  801fdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fe7:	0f b6 00             	movzbl (%rax),%eax
+  801fea:	84 c0                	test   %al,%al
+  801fec:	0f 85 d5 00 00 00    	jne    8020c7 <argnext+0x117>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1 || args->argv[1][0] != '-' || args->argv[1][1] == '\0')
+  801ff2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ff6:	48 8b 00             	mov    (%rax),%rax
+  801ff9:	8b 00                	mov    (%rax),%eax
+  801ffb:	83 f8 01             	cmp    $0x1,%eax
+  801ffe:	0f 84 ed 00 00 00    	je     8020f1 <argnext+0x141>
+  802004:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802008:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80200c:	48 83 c0 08          	add    $0x8,%rax
+  802010:	48 8b 00             	mov    (%rax),%rax
+  802013:	0f b6 00             	movzbl (%rax),%eax
+  802016:	3c 2d                	cmp    $0x2d,%al
+  802018:	0f 85 d3 00 00 00    	jne    8020f1 <argnext+0x141>
+  80201e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802022:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802026:	48 83 c0 08          	add    $0x8,%rax
+  80202a:	48 8b 00             	mov    (%rax),%rax
+  80202d:	48 83 c0 01          	add    $0x1,%rax
+  802031:	0f b6 00             	movzbl (%rax),%eax
+  802034:	84 c0                	test   %al,%al
+  802036:	0f 84 b5 00 00 00    	je     8020f1 <argnext+0x141>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  80203c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802040:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802044:	48 83 c0 08          	add    $0x8,%rax
+  802048:	48 8b 00             	mov    (%rax),%rax
+  80204b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80204f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802053:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80205b:	48 8b 00             	mov    (%rax),%rax
+  80205e:	8b 00                	mov    (%rax),%eax
+  802060:	83 e8 01             	sub    $0x1,%eax
+  802063:	48 98                	cltq
+  802065:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80206c:	00 
+  80206d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802071:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802075:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  802079:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80207d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802081:	48 83 c0 08          	add    $0x8,%rax
+  802085:	48 89 ce             	mov    %rcx,%rsi
+  802088:	48 89 c7             	mov    %rax,%rdi
+  80208b:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+    (*args->argc)--;
+  802097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80209b:	48 8b 00             	mov    (%rax),%rax
+  80209e:	8b 10                	mov    (%rax),%edx
+  8020a0:	83 ea 01             	sub    $0x1,%edx
+  8020a3:	89 10                	mov    %edx,(%rax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8020a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020a9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020ad:	0f b6 00             	movzbl (%rax),%eax
+  8020b0:	3c 2d                	cmp    $0x2d,%al
+  8020b2:	75 13                	jne    8020c7 <argnext+0x117>
+  8020b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020b8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020bc:	48 83 c0 01          	add    $0x1,%rax
+  8020c0:	0f b6 00             	movzbl (%rax),%eax
+  8020c3:	84 c0                	test   %al,%al
+  8020c5:	74 2d                	je     8020f4 <argnext+0x144>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  8020c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020cb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020cf:	0f b6 00             	movzbl (%rax),%eax
+  8020d2:	0f b6 c0             	movzbl %al,%eax
+  8020d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  args->curarg++;
+  8020d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020dc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020e0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8020e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return arg;
+  8020ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020ef:	eb 15                	jmp    802106 <argnext+0x156>
+      goto endofargs;
+  8020f1:	90                   	nop
+  8020f2:	eb 01                	jmp    8020f5 <argnext+0x145>
+      goto endofargs;
+  8020f4:	90                   	nop
+
+endofargs:
+  args->curarg = 0;
+  8020f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f9:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802100:	00 
+  return -1;
+  802101:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+
+0000000000802108 <argvalue>:
+
+char *
+argvalue(struct Argstate *args) {
+  802108:	55                   	push   %rbp
+  802109:	48 89 e5             	mov    %rsp,%rbp
+  80210c:	48 83 ec 10          	sub    $0x10,%rsp
+  802110:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802114:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802118:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80211c:	48 85 c0             	test   %rax,%rax
+  80211f:	74 0a                	je     80212b <argvalue+0x23>
+  802121:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802125:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802129:	eb 13                	jmp    80213e <argvalue+0x36>
+  80212b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80212f:	48 89 c7             	mov    %rax,%rdi
+  802132:	48 b8 40 21 80 00 00 	movabs $0x802140,%rax
+  802139:	00 00 00 
+  80213c:	ff d0                	call   *%rax
+}
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+0000000000802140 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args) {
+  802140:	55                   	push   %rbp
+  802141:	48 89 e5             	mov    %rsp,%rbp
+  802144:	48 83 ec 10          	sub    $0x10,%rsp
+  802148:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (!args->curarg)
+  80214c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802150:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802154:	48 85 c0             	test   %rax,%rax
+  802157:	75 0a                	jne    802163 <argnextvalue+0x23>
+    return 0;
+  802159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215e:	e9 c8 00 00 00       	jmp    80222b <argnextvalue+0xeb>
+  if (*args->curarg) {
+  802163:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802167:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80216b:	0f b6 00             	movzbl (%rax),%eax
+  80216e:	84 c0                	test   %al,%al
+  802170:	74 27                	je     802199 <argnextvalue+0x59>
+    args->argvalue = args->curarg;
+  802172:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802176:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80217a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80217e:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    args->curarg   = "";
+  802182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802186:	48 be 15 5c 80 00 00 	movabs $0x805c15,%rsi
+  80218d:	00 00 00 
+  802190:	48 89 70 10          	mov    %rsi,0x10(%rax)
+  802194:	e9 8a 00 00 00       	jmp    802223 <argnextvalue+0xe3>
+  } else if (*args->argc > 1) {
+  802199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80219d:	48 8b 00             	mov    (%rax),%rax
+  8021a0:	8b 00                	mov    (%rax),%eax
+  8021a2:	83 f8 01             	cmp    $0x1,%eax
+  8021a5:	7e 64                	jle    80220b <argnextvalue+0xcb>
+    args->argvalue = args->argv[1];
+  8021a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021af:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8021b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b7:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8021bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021bf:	48 8b 00             	mov    (%rax),%rax
+  8021c2:	8b 00                	mov    (%rax),%eax
+  8021c4:	83 e8 01             	sub    $0x1,%eax
+  8021c7:	48 98                	cltq
+  8021c9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8021d0:	00 
+  8021d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021d9:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  8021dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8021e5:	48 83 c0 08          	add    $0x8,%rax
+  8021e9:	48 89 ce             	mov    %rcx,%rsi
+  8021ec:	48 89 c7             	mov    %rax,%rdi
+  8021ef:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+    (*args->argc)--;
+  8021fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021ff:	48 8b 00             	mov    (%rax),%rax
+  802202:	8b 10                	mov    (%rax),%edx
+  802204:	83 ea 01             	sub    $0x1,%edx
+  802207:	89 10                	mov    %edx,(%rax)
+  802209:	eb 18                	jmp    802223 <argnextvalue+0xe3>
+  } else {
+    args->argvalue = 0;
+  80220b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80220f:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802216:	00 
+    args->curarg   = 0;
+  802217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80221b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802222:	00 
+  }
+  return (char *)args->argvalue;
+  802223:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802227:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  80222b:	c9                   	leave
+  80222c:	c3                   	ret
+
+000000000080222d <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80222d:	55                   	push   %rbp
+  80222e:	48 89 e5             	mov    %rsp,%rbp
+  802231:	48 83 ec 08          	sub    $0x8,%rsp
+  802235:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80223d:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802244:	ff ff ff 
+  802247:	48 01 d0             	add    %rdx,%rax
+  80224a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+0000000000802250 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 83 ec 08          	sub    $0x8,%rsp
+  802258:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80225c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802260:	48 89 c7             	mov    %rax,%rdi
+  802263:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  80226a:	00 00 00 
+  80226d:	ff d0                	call   *%rax
+  80226f:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802275:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+000000000080227b <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	48 83 ec 18          	sub    $0x18,%rsp
+  802283:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802287:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80228e:	e9 ae 00 00 00       	jmp    802341 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802293:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802296:	c1 e0 0c             	shl    $0xc,%eax
+  802299:	48 98                	cltq
+  80229b:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8022a0:	48 01 d0             	add    %rdx,%rax
+  8022a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8022a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ab:	48 c1 e8 27          	shr    $0x27,%rax
+  8022af:	48 89 c2             	mov    %rax,%rdx
+  8022b2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8022b9:	01 00 00 
+  8022bc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8022c0:	83 e0 01             	and    $0x1,%eax
+  8022c3:	48 85 c0             	test   %rax,%rax
+  8022c6:	74 63                	je     80232b <fd_alloc+0xb0>
+  8022c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022cc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8022d0:	48 89 c2             	mov    %rax,%rdx
+  8022d3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8022da:	01 00 00 
+  8022dd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8022e1:	83 e0 01             	and    $0x1,%eax
+  8022e4:	48 85 c0             	test   %rax,%rax
+  8022e7:	74 42                	je     80232b <fd_alloc+0xb0>
+  8022e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ed:	48 c1 e8 15          	shr    $0x15,%rax
+  8022f1:	48 89 c2             	mov    %rax,%rdx
+  8022f4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8022fb:	01 00 00 
+  8022fe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802302:	83 e0 01             	and    $0x1,%eax
+  802305:	48 85 c0             	test   %rax,%rax
+  802308:	74 21                	je     80232b <fd_alloc+0xb0>
+  80230a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80230e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802312:	48 89 c2             	mov    %rax,%rdx
+  802315:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80231c:	01 00 00 
+  80231f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802323:	83 e0 01             	and    $0x1,%eax
+  802326:	48 85 c0             	test   %rax,%rax
+  802329:	75 12                	jne    80233d <fd_alloc+0xc2>
+      *fd_store = fd;
+  80232b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80232f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802333:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233b:	eb 1e                	jmp    80235b <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80233d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802341:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802345:	0f 8e 48 ff ff ff    	jle    802293 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80234b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80234f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802356:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+000000000080235d <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80235d:	55                   	push   %rbp
+  80235e:	48 89 e5             	mov    %rsp,%rbp
+  802361:	48 83 ec 20          	sub    $0x20,%rsp
+  802365:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802368:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80236c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802370:	78 06                	js     802378 <fd_lookup+0x1b>
+  802372:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802376:	7e 0a                	jle    802382 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802378:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80237d:	e9 af 00 00 00       	jmp    802431 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802382:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802385:	c1 e0 0c             	shl    $0xc,%eax
+  802388:	48 98                	cltq
+  80238a:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80238f:	48 01 d0             	add    %rdx,%rax
+  802392:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802396:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80239a:	48 c1 e8 27          	shr    $0x27,%rax
+  80239e:	48 89 c2             	mov    %rax,%rdx
+  8023a1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8023a8:	01 00 00 
+  8023ab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8023af:	83 e0 01             	and    $0x1,%eax
+  8023b2:	48 85 c0             	test   %rax,%rax
+  8023b5:	74 63                	je     80241a <fd_lookup+0xbd>
+  8023b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023bb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8023bf:	48 89 c2             	mov    %rax,%rdx
+  8023c2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8023c9:	01 00 00 
+  8023cc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8023d0:	83 e0 01             	and    $0x1,%eax
+  8023d3:	48 85 c0             	test   %rax,%rax
+  8023d6:	74 42                	je     80241a <fd_lookup+0xbd>
+  8023d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023dc:	48 c1 e8 15          	shr    $0x15,%rax
+  8023e0:	48 89 c2             	mov    %rax,%rdx
+  8023e3:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8023ea:	01 00 00 
+  8023ed:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8023f1:	83 e0 01             	and    $0x1,%eax
+  8023f4:	48 85 c0             	test   %rax,%rax
+  8023f7:	74 21                	je     80241a <fd_lookup+0xbd>
+  8023f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023fd:	48 c1 e8 0c          	shr    $0xc,%rax
+  802401:	48 89 c2             	mov    %rax,%rdx
+  802404:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80240b:	01 00 00 
+  80240e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802412:	83 e0 01             	and    $0x1,%eax
+  802415:	48 85 c0             	test   %rax,%rax
+  802418:	75 07                	jne    802421 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80241a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80241f:	eb 10                	jmp    802431 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802421:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802425:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802429:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+
+0000000000802433 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802433:	55                   	push   %rbp
+  802434:	48 89 e5             	mov    %rsp,%rbp
+  802437:	48 83 ec 30          	sub    $0x30,%rsp
+  80243b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80243f:	89 f0                	mov    %esi,%eax
+  802441:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802444:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802448:	48 89 c7             	mov    %rax,%rdi
+  80244b:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  802452:	00 00 00 
+  802455:	ff d0                	call   *%rax
+  802457:	89 c2                	mov    %eax,%edx
+  802459:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80245d:	48 89 c6             	mov    %rax,%rsi
+  802460:	89 d7                	mov    %edx,%edi
+  802462:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802469:	00 00 00 
+  80246c:	ff d0                	call   *%rax
+  80246e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802471:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802475:	78 0a                	js     802481 <fd_close+0x4e>
+  802477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80247b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80247f:	74 12                	je     802493 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802481:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802485:	74 05                	je     80248c <fd_close+0x59>
+  802487:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80248a:	eb 70                	jmp    8024fc <fd_close+0xc9>
+  80248c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802491:	eb 69                	jmp    8024fc <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802493:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802497:	8b 00                	mov    (%rax),%eax
+  802499:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80249d:	48 89 d6             	mov    %rdx,%rsi
+  8024a0:	89 c7                	mov    %eax,%edi
+  8024a2:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024b5:	78 2a                	js     8024e1 <fd_close+0xae>
+    if (dev->dev_close)
+  8024b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024bb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8024bf:	48 85 c0             	test   %rax,%rax
+  8024c2:	74 16                	je     8024da <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8024c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024c8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8024cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024d0:	48 89 c7             	mov    %rax,%rdi
+  8024d3:	ff d2                	call   *%rdx
+  8024d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8024d8:	eb 07                	jmp    8024e1 <fd_close+0xae>
+    else
+      r = 0;
+  8024da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8024e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024e5:	48 89 c6             	mov    %rax,%rsi
+  8024e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ed:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+  return r;
+  8024f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8024fc:	c9                   	leave
+  8024fd:	c3                   	ret
+
+00000000008024fe <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	48 83 ec 20          	sub    $0x20,%rsp
+  802506:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802509:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  80250d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802514:	eb 3f                	jmp    802555 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802516:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80251d:	00 00 00 
+  802520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802523:	48 98                	cltq
+  802525:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802529:	8b 00                	mov    (%rax),%eax
+  80252b:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80252e:	75 21                	jne    802551 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802530:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802537:	00 00 00 
+  80253a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80253d:	48 98                	cltq
+  80253f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802543:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802547:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80254a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80254f:	eb 7f                	jmp    8025d0 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802551:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802555:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80255c:	00 00 00 
+  80255f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802562:	48 98                	cltq
+  802564:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802568:	48 85 c0             	test   %rax,%rax
+  80256b:	75 a9                	jne    802516 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80256d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802574:	00 00 00 
+  802577:	8b 40 04             	mov    0x4(%rax),%eax
+  80257a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80257f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802586:	00 00 00 
+  802589:	48 98                	cltq
+  80258b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802592:	48 01 d0             	add    %rdx,%rax
+  802595:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80259b:	8b 00                	mov    (%rax),%eax
+  80259d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8025a0:	89 c6                	mov    %eax,%esi
+  8025a2:	48 b8 18 5c 80 00 00 	movabs $0x805c18,%rax
+  8025a9:	00 00 00 
+  8025ac:	48 89 c7             	mov    %rax,%rdi
+  8025af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b4:	48 b9 0e 4c 80 00 00 	movabs $0x804c0e,%rcx
+  8025bb:	00 00 00 
+  8025be:	ff d1                	call   *%rcx
+  *dev = 0;
+  8025c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025c4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8025cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025d0:	c9                   	leave
+  8025d1:	c3                   	ret
+
+00000000008025d2 <close>:
+
+int
+close(int fdnum) {
+  8025d2:	55                   	push   %rbp
+  8025d3:	48 89 e5             	mov    %rsp,%rbp
+  8025d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8025da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025dd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8025e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025e4:	48 89 d6             	mov    %rdx,%rsi
+  8025e7:	89 c7                	mov    %eax,%edi
+  8025e9:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8025f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8025fc:	79 05                	jns    802603 <close+0x31>
+    return r;
+  8025fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802601:	eb 18                	jmp    80261b <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802603:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802607:	be 01 00 00 00       	mov    $0x1,%esi
+  80260c:	48 89 c7             	mov    %rax,%rdi
+  80260f:	48 b8 33 24 80 00 00 	movabs $0x802433,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+}
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+000000000080261d <close_all>:
+
+void
+close_all(void) {
+  80261d:	55                   	push   %rbp
+  80261e:	48 89 e5             	mov    %rsp,%rbp
+  802621:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802625:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80262c:	eb 15                	jmp    802643 <close_all+0x26>
+    close(i);
+  80262e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802631:	89 c7                	mov    %eax,%edi
+  802633:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  80263f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802643:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802647:	7e e5                	jle    80262e <close_all+0x11>
+}
+  802649:	90                   	nop
+  80264a:	90                   	nop
+  80264b:	c9                   	leave
+  80264c:	c3                   	ret
+
+000000000080264d <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  80264d:	55                   	push   %rbp
+  80264e:	48 89 e5             	mov    %rsp,%rbp
+  802651:	48 83 ec 40          	sub    $0x40,%rsp
+  802655:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802658:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80265b:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80265f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802662:	48 89 d6             	mov    %rdx,%rsi
+  802665:	89 c7                	mov    %eax,%edi
+  802667:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802676:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80267a:	79 08                	jns    802684 <dup+0x37>
+    return r;
+  80267c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80267f:	e9 33 02 00 00       	jmp    8028b7 <dup+0x26a>
+  close(newfdnum);
+  802684:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802687:	89 c7                	mov    %eax,%edi
+  802689:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  802690:	00 00 00 
+  802693:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802695:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802698:	c1 e0 0c             	shl    $0xc,%eax
+  80269b:	48 98                	cltq
+  80269d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026a2:	48 01 d0             	add    %rdx,%rax
+  8026a5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8026a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026ad:	48 89 c7             	mov    %rax,%rdi
+  8026b0:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8026c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026c4:	48 89 c7             	mov    %rax,%rdi
+  8026c7:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8026d7:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8026de:	00 
+  8026df:	e9 19 01 00 00       	jmp    8027fd <dup+0x1b0>
+    off -= PGSIZE;
+  8026e4:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8026eb:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8026ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026f4:	48 01 d0             	add    %rdx,%rax
+  8026f7:	48 c1 e8 27          	shr    $0x27,%rax
+  8026fb:	48 89 c2             	mov    %rax,%rdx
+  8026fe:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802705:	01 00 00 
+  802708:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80270c:	83 e0 01             	and    $0x1,%eax
+  80270f:	48 85 c0             	test   %rax,%rax
+  802712:	0f 84 e5 00 00 00    	je     8027fd <dup+0x1b0>
+  802718:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80271c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802720:	48 01 d0             	add    %rdx,%rax
+  802723:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802727:	48 89 c2             	mov    %rax,%rdx
+  80272a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802731:	01 00 00 
+  802734:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802738:	83 e0 01             	and    $0x1,%eax
+  80273b:	48 85 c0             	test   %rax,%rax
+  80273e:	0f 84 b9 00 00 00    	je     8027fd <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802744:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802748:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80274c:	48 01 d0             	add    %rdx,%rax
+  80274f:	48 c1 e8 15          	shr    $0x15,%rax
+  802753:	48 89 c2             	mov    %rax,%rdx
+  802756:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80275d:	01 00 00 
+  802760:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802764:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802767:	48 85 c0             	test   %rax,%rax
+  80276a:	0f 84 8d 00 00 00    	je     8027fd <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802770:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802778:	48 01 d0             	add    %rdx,%rax
+  80277b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80277f:	48 89 c2             	mov    %rax,%rdx
+  802782:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802789:	01 00 00 
+  80278c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802790:	83 e0 01             	and    $0x1,%eax
+  802793:	48 85 c0             	test   %rax,%rax
+  802796:	74 65                	je     8027fd <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802798:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80279c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a0:	48 01 d0             	add    %rdx,%rax
+  8027a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027a7:	48 89 c2             	mov    %rax,%rdx
+  8027aa:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027b1:	01 00 00 
+  8027b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027b8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8027bd:	89 c6                	mov    %eax,%esi
+  8027bf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027c7:	48 01 c2             	add    %rax,%rdx
+  8027ca:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027d2:	48 01 c8             	add    %rcx,%rax
+  8027d5:	41 89 f0             	mov    %esi,%r8d
+  8027d8:	48 89 d1             	mov    %rdx,%rcx
+  8027db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e0:	48 89 c6             	mov    %rax,%rsi
+  8027e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e8:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8027ef:	00 00 00 
+  8027f2:	ff d0                	call   *%rax
+  8027f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8027f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8027fb:	78 60                	js     80285d <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8027fd:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802802:	0f 85 dc fe ff ff    	jne    8026e4 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802808:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80280c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802810:	48 89 c2             	mov    %rax,%rdx
+  802813:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80281a:	01 00 00 
+  80281d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802821:	25 07 0e 00 00       	and    $0xe07,%eax
+  802826:	89 c1                	mov    %eax,%ecx
+  802828:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80282c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802830:	41 89 c8             	mov    %ecx,%r8d
+  802833:	48 89 d1             	mov    %rdx,%rcx
+  802836:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283b:	48 89 c6             	mov    %rax,%rsi
+  80283e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802843:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+  80284f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802852:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802856:	78 08                	js     802860 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802858:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80285b:	eb 5a                	jmp    8028b7 <dup+0x26a>
+        goto err;
+  80285d:	90                   	nop
+  80285e:	eb 01                	jmp    802861 <dup+0x214>
+    goto err;
+  802860:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802861:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802865:	48 89 c6             	mov    %rax,%rsi
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286d:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802879:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802880:	00 
+  802881:	eb 27                	jmp    8028aa <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802883:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80288b:	48 01 d0             	add    %rdx,%rax
+  80288e:	48 89 c6             	mov    %rax,%rsi
+  802891:	bf 00 00 00 00       	mov    $0x0,%edi
+  802896:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8028a2:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8028a9:	00 
+  8028aa:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8028b1:	00 
+  8028b2:	76 cf                	jbe    802883 <dup+0x236>
+  return r;
+  8028b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+
+00000000008028b9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8028b9:	55                   	push   %rbp
+  8028ba:	48 89 e5             	mov    %rsp,%rbp
+  8028bd:	48 83 ec 40          	sub    $0x40,%rsp
+  8028c1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8028c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8028c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8028cc:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8028d3:	48 89 d6             	mov    %rdx,%rsi
+  8028d6:	89 c7                	mov    %eax,%edi
+  8028d8:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028eb:	78 24                	js     802911 <read+0x58>
+  8028ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028f1:	8b 00                	mov    (%rax),%eax
+  8028f3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8028f7:	48 89 d6             	mov    %rdx,%rsi
+  8028fa:	89 c7                	mov    %eax,%edi
+  8028fc:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802903:	00 00 00 
+  802906:	ff d0                	call   *%rax
+  802908:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80290b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80290f:	79 0a                	jns    80291b <read+0x62>
+    return r;
+  802911:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802914:	48 98                	cltq
+  802916:	e9 9e 00 00 00       	jmp    8029b9 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80291b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291f:	8b 40 08             	mov    0x8(%rax),%eax
+  802922:	83 e0 03             	and    $0x3,%eax
+  802925:	83 f8 01             	cmp    $0x1,%eax
+  802928:	75 5c                	jne    802986 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80292a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802931:	00 00 00 
+  802934:	8b 40 04             	mov    0x4(%rax),%eax
+  802937:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80293c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802943:	00 00 00 
+  802946:	48 98                	cltq
+  802948:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80294f:	48 01 d0             	add    %rdx,%rax
+  802952:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802958:	8b 00                	mov    (%rax),%eax
+  80295a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80295d:	89 c6                	mov    %eax,%esi
+  80295f:	48 b8 37 5c 80 00 00 	movabs $0x805c37,%rax
+  802966:	00 00 00 
+  802969:	48 89 c7             	mov    %rax,%rdi
+  80296c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802971:	48 b9 0e 4c 80 00 00 	movabs $0x804c0e,%rcx
+  802978:	00 00 00 
+  80297b:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80297d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802984:	eb 33                	jmp    8029b9 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802986:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80298a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80298e:	48 85 c0             	test   %rax,%rax
+  802991:	75 09                	jne    80299c <read+0xe3>
+    return -E_NOT_SUPP;
+  802993:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80299a:	eb 1d                	jmp    8029b9 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80299c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029a0:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8029a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029a8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8029ac:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8029b0:	48 89 ce             	mov    %rcx,%rsi
+  8029b3:	48 89 c7             	mov    %rax,%rdi
+  8029b6:	41 ff d0             	call   *%r8
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+00000000008029bb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8029bb:	55                   	push   %rbp
+  8029bc:	48 89 e5             	mov    %rsp,%rbp
+  8029bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8029c3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029ca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8029ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029d5:	eb 49                	jmp    802a20 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8029d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029da:	48 98                	cltq
+  8029dc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8029e0:	48 29 c2             	sub    %rax,%rdx
+  8029e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029e6:	48 63 c8             	movslq %eax,%rcx
+  8029e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ed:	48 01 c1             	add    %rax,%rcx
+  8029f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029f3:	48 89 ce             	mov    %rcx,%rsi
+  8029f6:	89 c7                	mov    %eax,%edi
+  8029f8:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  8029ff:	00 00 00 
+  802a02:	ff d0                	call   *%rax
+  802a04:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802a07:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802a0b:	79 07                	jns    802a14 <readn+0x59>
+      return m;
+  802a0d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802a10:	48 98                	cltq
+  802a12:	eb 1f                	jmp    802a33 <readn+0x78>
+    if (m == 0)
+  802a14:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802a18:	74 13                	je     802a2d <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802a1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802a1d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a23:	48 98                	cltq
+  802a25:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802a29:	72 ac                	jb     8029d7 <readn+0x1c>
+  802a2b:	eb 01                	jmp    802a2e <readn+0x73>
+      break;
+  802a2d:	90                   	nop
+  }
+  return tot;
+  802a2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a31:	48 98                	cltq
+}
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+
+0000000000802a35 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	48 83 ec 40          	sub    $0x40,%rsp
+  802a3d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a40:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802a44:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802a48:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802a4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a4f:	48 89 d6             	mov    %rdx,%rsi
+  802a52:	89 c7                	mov    %eax,%edi
+  802a54:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+  802a60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a67:	78 24                	js     802a8d <write+0x58>
+  802a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a6d:	8b 00                	mov    (%rax),%eax
+  802a6f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a73:	48 89 d6             	mov    %rdx,%rsi
+  802a76:	89 c7                	mov    %eax,%edi
+  802a78:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802a7f:	00 00 00 
+  802a82:	ff d0                	call   *%rax
+  802a84:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a87:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a8b:	79 0a                	jns    802a97 <write+0x62>
+    return r;
+  802a8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a90:	48 98                	cltq
+  802a92:	e9 9d 00 00 00       	jmp    802b34 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a9b:	8b 40 08             	mov    0x8(%rax),%eax
+  802a9e:	83 e0 03             	and    $0x3,%eax
+  802aa1:	85 c0                	test   %eax,%eax
+  802aa3:	75 5c                	jne    802b01 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802aa5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802aac:	00 00 00 
+  802aaf:	8b 40 04             	mov    0x4(%rax),%eax
+  802ab2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ab7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802abe:	00 00 00 
+  802ac1:	48 98                	cltq
+  802ac3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802aca:	48 01 d0             	add    %rdx,%rax
+  802acd:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802ad3:	8b 00                	mov    (%rax),%eax
+  802ad5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ad8:	89 c6                	mov    %eax,%esi
+  802ada:	48 b8 53 5c 80 00 00 	movabs $0x805c53,%rax
+  802ae1:	00 00 00 
+  802ae4:	48 89 c7             	mov    %rax,%rdi
+  802ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aec:	48 b9 0e 4c 80 00 00 	movabs $0x804c0e,%rcx
+  802af3:	00 00 00 
+  802af6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802af8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802aff:	eb 33                	jmp    802b34 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b05:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802b09:	48 85 c0             	test   %rax,%rax
+  802b0c:	75 09                	jne    802b17 <write+0xe2>
+    return -E_NOT_SUPP;
+  802b0e:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802b15:	eb 1d                	jmp    802b34 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802b17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b1b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b23:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802b27:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802b2b:	48 89 ce             	mov    %rcx,%rsi
+  802b2e:	48 89 c7             	mov    %rax,%rdi
+  802b31:	41 ff d0             	call   *%r8
+}
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+
+0000000000802b36 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802b36:	55                   	push   %rbp
+  802b37:	48 89 e5             	mov    %rsp,%rbp
+  802b3a:	48 83 ec 18          	sub    $0x18,%rsp
+  802b3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b41:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b44:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802b48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4b:	48 89 d6             	mov    %rdx,%rsi
+  802b4e:	89 c7                	mov    %eax,%edi
+  802b50:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+  802b5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b63:	79 05                	jns    802b6a <seek+0x34>
+    return r;
+  802b65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b68:	eb 0f                	jmp    802b79 <seek+0x43>
+  fd->fd_offset = offset;
+  802b6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b6e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b71:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802b74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b79:	c9                   	leave
+  802b7a:	c3                   	ret
+
+0000000000802b7b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+  802b7f:	48 83 ec 30          	sub    $0x30,%rsp
+  802b83:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b86:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802b89:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802b8d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b90:	48 89 d6             	mov    %rdx,%rsi
+  802b93:	89 c7                	mov    %eax,%edi
+  802b95:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802b9c:	00 00 00 
+  802b9f:	ff d0                	call   *%rax
+  802ba1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ba4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ba8:	78 24                	js     802bce <ftruncate+0x53>
+  802baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bae:	8b 00                	mov    (%rax),%eax
+  802bb0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802bb4:	48 89 d6             	mov    %rdx,%rsi
+  802bb7:	89 c7                	mov    %eax,%edi
+  802bb9:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802bc0:	00 00 00 
+  802bc3:	ff d0                	call   *%rax
+  802bc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bcc:	79 08                	jns    802bd6 <ftruncate+0x5b>
+    return r;
+  802bce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bd1:	e9 92 00 00 00       	jmp    802c68 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802bd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bda:	8b 40 08             	mov    0x8(%rax),%eax
+  802bdd:	83 e0 03             	and    $0x3,%eax
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	75 5a                	jne    802c3e <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  802be4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802beb:	00 00 00 
+  802bee:	8b 40 04             	mov    0x4(%rax),%eax
+  802bf1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802bf6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802bfd:	00 00 00 
+  802c00:	48 98                	cltq
+  802c02:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802c09:	48 01 d0             	add    %rdx,%rax
+  802c0c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802c12:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802c14:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c17:	89 c6                	mov    %eax,%esi
+  802c19:	48 b8 70 5c 80 00 00 	movabs $0x805c70,%rax
+  802c20:	00 00 00 
+  802c23:	48 89 c7             	mov    %rax,%rdi
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2b:	48 b9 0e 4c 80 00 00 	movabs $0x804c0e,%rcx
+  802c32:	00 00 00 
+  802c35:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802c37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c3c:	eb 2a                	jmp    802c68 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  802c3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c42:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802c46:	48 85 c0             	test   %rax,%rax
+  802c49:	75 07                	jne    802c52 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  802c4b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  802c50:	eb 16                	jmp    802c68 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  802c52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c56:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  802c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c5e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c61:	89 d6                	mov    %edx,%esi
+  802c63:	48 89 c7             	mov    %rax,%rdi
+  802c66:	ff d1                	call   *%rcx
+}
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+
+0000000000802c6a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802c6a:	55                   	push   %rbp
+  802c6b:	48 89 e5             	mov    %rsp,%rbp
+  802c6e:	48 83 ec 30          	sub    $0x30,%rsp
+  802c72:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c75:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802c79:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802c80:	48 89 d6             	mov    %rdx,%rsi
+  802c83:	89 c7                	mov    %eax,%edi
+  802c85:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802c8c:	00 00 00 
+  802c8f:	ff d0                	call   *%rax
+  802c91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c98:	78 24                	js     802cbe <fstat+0x54>
+  802c9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c9e:	8b 00                	mov    (%rax),%eax
+  802ca0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ca4:	48 89 d6             	mov    %rdx,%rsi
+  802ca7:	89 c7                	mov    %eax,%edi
+  802ca9:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802cb0:	00 00 00 
+  802cb3:	ff d0                	call   *%rax
+  802cb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cbc:	79 05                	jns    802cc3 <fstat+0x59>
+    return r;
+  802cbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc1:	eb 5e                	jmp    802d21 <fstat+0xb7>
+  if (!dev->dev_stat)
+  802cc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cc7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802ccb:	48 85 c0             	test   %rax,%rax
+  802cce:	75 07                	jne    802cd7 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  802cd0:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  802cd5:	eb 4a                	jmp    802d21 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  802cd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cdb:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  802cde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ce2:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  802ce9:	00 00 00 
+  stat->st_isdir   = 0;
+  802cec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cf0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802cf7:	00 00 00 
+  stat->st_dev     = dev;
+  802cfa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802cfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d02:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  802d09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d0d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  802d11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d15:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802d19:	48 89 d6             	mov    %rdx,%rsi
+  802d1c:	48 89 c7             	mov    %rax,%rdi
+  802d1f:	ff d1                	call   *%rcx
+}
+  802d21:	c9                   	leave
+  802d22:	c3                   	ret
+
+0000000000802d23 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  802d23:	55                   	push   %rbp
+  802d24:	48 89 e5             	mov    %rsp,%rbp
+  802d27:	48 83 ec 10          	sub    $0x10,%rsp
+  802d2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  802d33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d37:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  802d3d:	83 f8 20             	cmp    $0x20,%eax
+  802d40:	75 07                	jne    802d49 <pollwait_key+0x26>
+    return -E_INVAL;
+  802d42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d47:	eb 5f                	jmp    802da8 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  802d49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d4d:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  802d53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d57:	48 63 d2             	movslq %edx,%rdx
+  802d5a:	48 c1 e2 04          	shl    $0x4,%rdx
+  802d5e:	48 01 c2             	add    %rax,%rdx
+  802d61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d65:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  802d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d6c:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  802d72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d76:	8b 00                	mov    (%rax),%eax
+  802d78:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d7c:	48 63 c9             	movslq %ecx,%rcx
+  802d7f:	48 c1 e1 04          	shl    $0x4,%rcx
+  802d83:	48 01 ca             	add    %rcx,%rdx
+  802d86:	48 83 c2 08          	add    $0x8,%rdx
+  802d8a:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  802d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d90:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  802d96:	8d 50 01             	lea    0x1(%rax),%edx
+  802d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d9d:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  802da3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da8:	c9                   	leave
+  802da9:	c3                   	ret
+
+0000000000802daa <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  802daa:	55                   	push   %rbp
+  802dab:	48 89 e5             	mov    %rsp,%rbp
+  802dae:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  802db5:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  802dbc:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  802dc2:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  802dc9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802dd0:	00 
+  int i, r, ready, ipc = 0;
+  802dd1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  802dd8:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  802ddf:	00 
+  802de0:	74 45                	je     802e27 <poll+0x7d>
+  802de2:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  802de9:	ff 
+  802dea:	74 3b                	je     802e27 <poll+0x7d>
+    now      = vsys_clock_ns();
+  802dec:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  802df3:	00 00 00 
+  802df6:	ff d0                	call   *%rax
+  802df8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  802dfc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e00:	48 f7 d0             	not    %rax
+  802e03:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  802e0a:	73 10                	jae    802e1c <poll+0x72>
+  802e0c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e10:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  802e17:	48 01 d0             	add    %rdx,%rax
+  802e1a:	eb 07                	jmp    802e23 <poll+0x79>
+  802e1c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  802e23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  802e27:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  802e2e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  802e35:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  802e3c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  802e43:	e9 46 02 00 00       	jmp    80308e <poll+0x2e4>
+      fds[i].revents = 0;
+  802e48:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802e4b:	48 63 d0             	movslq %eax,%rdx
+  802e4e:	48 89 d0             	mov    %rdx,%rax
+  802e51:	48 01 c0             	add    %rax,%rax
+  802e54:	48 01 d0             	add    %rdx,%rax
+  802e57:	48 c1 e0 02          	shl    $0x2,%rax
+  802e5b:	48 89 c2             	mov    %rax,%rdx
+  802e5e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802e65:	48 01 d0             	add    %rdx,%rax
+  802e68:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  802e6f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802e72:	48 63 d0             	movslq %eax,%rdx
+  802e75:	48 89 d0             	mov    %rdx,%rax
+  802e78:	48 01 c0             	add    %rax,%rax
+  802e7b:	48 01 d0             	add    %rdx,%rax
+  802e7e:	48 c1 e0 02          	shl    $0x2,%rax
+  802e82:	48 89 c2             	mov    %rax,%rdx
+  802e85:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802e8c:	48 01 d0             	add    %rdx,%rax
+  802e8f:	8b 00                	mov    (%rax),%eax
+  802e91:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  802e94:	75 62                	jne    802ef8 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  802e96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802e99:	48 63 d0             	movslq %eax,%rdx
+  802e9c:	48 89 d0             	mov    %rdx,%rax
+  802e9f:	48 01 c0             	add    %rax,%rax
+  802ea2:	48 01 d0             	add    %rdx,%rax
+  802ea5:	48 c1 e0 02          	shl    $0x2,%rax
+  802ea9:	48 89 c2             	mov    %rax,%rdx
+  802eac:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802eb3:	48 01 d0             	add    %rdx,%rax
+  802eb6:	8b 40 04             	mov    0x4(%rax),%eax
+  802eb9:	83 e0 01             	and    $0x1,%eax
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	0f 84 9b 01 00 00    	je     80305f <poll+0x2b5>
+          fds[i].revents = ipc;
+  802ec4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802ec7:	48 63 d0             	movslq %eax,%rdx
+  802eca:	48 89 d0             	mov    %rdx,%rax
+  802ecd:	48 01 c0             	add    %rax,%rax
+  802ed0:	48 01 d0             	add    %rdx,%rax
+  802ed3:	48 c1 e0 02          	shl    $0x2,%rax
+  802ed7:	48 89 c2             	mov    %rax,%rdx
+  802eda:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802ee1:	48 01 c2             	add    %rax,%rdx
+  802ee4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ee7:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  802eea:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802eed:	83 c8 04             	or     $0x4,%eax
+  802ef0:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  802ef3:	e9 67 01 00 00       	jmp    80305f <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  802ef8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802efb:	48 63 d0             	movslq %eax,%rdx
+  802efe:	48 89 d0             	mov    %rdx,%rax
+  802f01:	48 01 c0             	add    %rax,%rax
+  802f04:	48 01 d0             	add    %rdx,%rax
+  802f07:	48 c1 e0 02          	shl    $0x2,%rax
+  802f0b:	48 89 c2             	mov    %rax,%rdx
+  802f0e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802f15:	48 01 d0             	add    %rdx,%rax
+  802f18:	8b 00                	mov    (%rax),%eax
+  802f1a:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  802f21:	48 89 d6             	mov    %rdx,%rsi
+  802f24:	89 c7                	mov    %eax,%edi
+  802f26:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+  802f32:	85 c0                	test   %eax,%eax
+  802f34:	78 25                	js     802f5b <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  802f36:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  802f3d:	8b 00                	mov    (%rax),%eax
+  802f3f:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  802f46:	48 89 d6             	mov    %rdx,%rsi
+  802f49:	89 c7                	mov    %eax,%edi
+  802f4b:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	79 2c                	jns    802f87 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  802f5b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802f5e:	48 63 d0             	movslq %eax,%rdx
+  802f61:	48 89 d0             	mov    %rdx,%rax
+  802f64:	48 01 c0             	add    %rax,%rax
+  802f67:	48 01 d0             	add    %rdx,%rax
+  802f6a:	48 c1 e0 02          	shl    $0x2,%rax
+  802f6e:	48 89 c2             	mov    %rax,%rdx
+  802f71:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802f78:	48 01 d0             	add    %rdx,%rax
+  802f7b:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  802f82:	e9 d8 00 00 00       	jmp    80305f <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  802f87:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  802f8e:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802f92:	48 85 c0             	test   %rax,%rax
+  802f95:	74 7d                	je     803014 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  802f97:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  802f9e:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  802fa2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802fa5:	48 63 d0             	movslq %eax,%rdx
+  802fa8:	48 89 d0             	mov    %rdx,%rax
+  802fab:	48 01 c0             	add    %rax,%rax
+  802fae:	48 01 d0             	add    %rdx,%rax
+  802fb1:	48 c1 e0 02          	shl    $0x2,%rax
+  802fb5:	48 89 c2             	mov    %rax,%rdx
+  802fb8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  802fbf:	48 01 d0             	add    %rdx,%rax
+  802fc2:	8b 48 04             	mov    0x4(%rax),%ecx
+  802fc5:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  802fcc:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  802fd3:	89 ce                	mov    %ecx,%esi
+  802fd5:	48 89 c7             	mov    %rax,%rdi
+  802fd8:	41 ff d0             	call   *%r8
+  802fdb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802fde:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802fe2:	79 08                	jns    802fec <poll+0x242>
+          return r;
+  802fe4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fe7:	e9 45 01 00 00       	jmp    803131 <poll+0x387>
+        fds[i].revents = r;
+  802fec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802fef:	48 63 d0             	movslq %eax,%rdx
+  802ff2:	48 89 d0             	mov    %rdx,%rax
+  802ff5:	48 01 c0             	add    %rax,%rax
+  802ff8:	48 01 d0             	add    %rdx,%rax
+  802ffb:	48 c1 e0 02          	shl    $0x2,%rax
+  802fff:	48 89 c2             	mov    %rax,%rdx
+  803002:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803009:	48 01 c2             	add    %rax,%rdx
+  80300c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80300f:	89 42 08             	mov    %eax,0x8(%rdx)
+  803012:	eb 4b                	jmp    80305f <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803014:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803017:	48 63 d0             	movslq %eax,%rdx
+  80301a:	48 89 d0             	mov    %rdx,%rax
+  80301d:	48 01 c0             	add    %rax,%rax
+  803020:	48 01 d0             	add    %rdx,%rax
+  803023:	48 c1 e0 02          	shl    $0x2,%rax
+  803027:	48 89 c2             	mov    %rax,%rdx
+  80302a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803031:	48 01 d0             	add    %rdx,%rax
+  803034:	8b 48 04             	mov    0x4(%rax),%ecx
+  803037:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80303a:	48 63 d0             	movslq %eax,%rdx
+  80303d:	48 89 d0             	mov    %rdx,%rax
+  803040:	48 01 c0             	add    %rax,%rax
+  803043:	48 01 d0             	add    %rdx,%rax
+  803046:	48 c1 e0 02          	shl    $0x2,%rax
+  80304a:	48 89 c2             	mov    %rax,%rdx
+  80304d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803054:	48 01 d0             	add    %rdx,%rax
+  803057:	83 e1 03             	and    $0x3,%ecx
+  80305a:	89 ca                	mov    %ecx,%edx
+  80305c:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80305f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803062:	48 63 d0             	movslq %eax,%rdx
+  803065:	48 89 d0             	mov    %rdx,%rax
+  803068:	48 01 c0             	add    %rax,%rax
+  80306b:	48 01 d0             	add    %rdx,%rax
+  80306e:	48 c1 e0 02          	shl    $0x2,%rax
+  803072:	48 89 c2             	mov    %rax,%rdx
+  803075:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80307c:	48 01 d0             	add    %rdx,%rax
+  80307f:	8b 40 08             	mov    0x8(%rax),%eax
+  803082:	85 c0                	test   %eax,%eax
+  803084:	74 04                	je     80308a <poll+0x2e0>
+        ready++;
+  803086:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80308a:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80308e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803091:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803097:	0f 8c ab fd ff ff    	jl     802e48 <poll+0x9e>
+    }
+    if (ready)
+  80309d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8030a1:	74 08                	je     8030ab <poll+0x301>
+      return ready;
+  8030a3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8030a6:	e9 86 00 00 00       	jmp    803131 <poll+0x387>
+
+    if (deadline) {
+  8030ab:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8030b0:	74 30                	je     8030e2 <poll+0x338>
+      now     = vsys_clock_ns();
+  8030b2:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+  8030be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8030c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030c6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8030ca:	73 0a                	jae    8030d6 <poll+0x32c>
+  8030cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030d0:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8030d4:	eb 05                	jmp    8030db <poll+0x331>
+  8030d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030db:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8030e2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8030e5:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8030e8:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8030ef:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8030f6:	48 89 c7             	mov    %rax,%rdi
+  8030f9:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+  803105:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803108:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80310c:	75 07                	jne    803115 <poll+0x36b>
+      return 0;
+  80310e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803113:	eb 1c                	jmp    803131 <poll+0x387>
+    if (r < 0)
+  803115:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803119:	79 05                	jns    803120 <poll+0x376>
+      return r;
+  80311b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80311e:	eb 11                	jmp    803131 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803120:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803123:	c1 f8 02             	sar    $0x2,%eax
+  803126:	83 e0 01             	and    $0x1,%eax
+  803129:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80312c:	e9 f6 fc ff ff       	jmp    802e27 <poll+0x7d>
+  }
+}
+  803131:	c9                   	leave
+  803132:	c3                   	ret
+
+0000000000803133 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803133:	55                   	push   %rbp
+  803134:	48 89 e5             	mov    %rsp,%rbp
+  803137:	48 83 ec 20          	sub    $0x20,%rsp
+  80313b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80313f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803143:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803147:	be 00 00 00 00       	mov    $0x0,%esi
+  80314c:	48 89 c7             	mov    %rax,%rdi
+  80314f:	48 b8 21 32 80 00 00 	movabs $0x803221,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+  80315b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80315e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803162:	79 05                	jns    803169 <stat+0x36>
+    return fd;
+  803164:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803167:	eb 2f                	jmp    803198 <stat+0x65>
+  r = fstat(fd, stat);
+  803169:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80316d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803170:	48 89 d6             	mov    %rdx,%rsi
+  803173:	89 c7                	mov    %eax,%edi
+  803175:	48 b8 6a 2c 80 00 00 	movabs $0x802c6a,%rax
+  80317c:	00 00 00 
+  80317f:	ff d0                	call   *%rax
+  803181:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803184:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803187:	89 c7                	mov    %eax,%edi
+  803189:	48 b8 d2 25 80 00 00 	movabs $0x8025d2,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  return r;
+  803195:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803198:	c9                   	leave
+  803199:	c3                   	ret
+
+000000000080319a <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80319a:	55                   	push   %rbp
+  80319b:	48 89 e5             	mov    %rsp,%rbp
+  80319e:	48 83 ec 10          	sub    $0x10,%rsp
+  8031a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8031a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8031a9:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8031b0:	00 00 00 
+  8031b3:	8b 00                	mov    (%rax),%eax
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	75 1d                	jne    8031d6 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031b9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031be:	48 b8 df 58 80 00 00 	movabs $0x8058df,%rax
+  8031c5:	00 00 00 
+  8031c8:	ff d0                	call   *%rax
+  8031ca:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8031d1:	00 00 00 
+  8031d4:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8031d6:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8031dd:	00 00 00 
+  8031e0:	8b 00                	mov    (%rax),%eax
+  8031e2:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8031e5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031ea:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8031f1:	00 00 00 
+  8031f4:	89 c7                	mov    %eax,%edi
+  8031f6:	48 b8 32 58 80 00 00 	movabs $0x805832,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803202:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320b:	48 89 c6             	mov    %rax,%rsi
+  80320e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803213:	48 b8 b5 56 80 00 00 	movabs $0x8056b5,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+}
+  80321f:	c9                   	leave
+  803220:	c3                   	ret
+
+0000000000803221 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803221:	55                   	push   %rbp
+  803222:	48 89 e5             	mov    %rsp,%rbp
+  803225:	48 83 ec 20          	sub    $0x20,%rsp
+  803229:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80322d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803230:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803234:	48 89 c7             	mov    %rax,%rdi
+  803237:	48 b8 95 09 80 00 00 	movabs $0x800995,%rax
+  80323e:	00 00 00 
+  803241:	ff d0                	call   *%rax
+  803243:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803248:	7e 0a                	jle    803254 <open+0x33>
+    return -E_BAD_PATH;
+  80324a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80324f:	e9 a8 00 00 00       	jmp    8032fc <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803254:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803258:	48 89 c7             	mov    %rax,%rdi
+  80325b:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  803262:	00 00 00 
+  803265:	ff d0                	call   *%rax
+  803267:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80326a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80326e:	79 08                	jns    803278 <open+0x57>
+    return r;
+  803270:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803273:	e9 84 00 00 00       	jmp    8032fc <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803278:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80327c:	48 89 c6             	mov    %rax,%rsi
+  80327f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803286:	00 00 00 
+  803289:	48 89 c7             	mov    %rax,%rdi
+  80328c:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  803293:	00 00 00 
+  803296:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803298:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80329f:	00 00 00 
+  8032a2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032a5:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8032ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032af:	48 89 c6             	mov    %rax,%rsi
+  8032b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032b7:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+  8032c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032ca:	79 1d                	jns    8032e9 <open+0xc8>
+    fd_close(fd, 0);
+  8032cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d5:	48 89 c7             	mov    %rax,%rdi
+  8032d8:	48 b8 33 24 80 00 00 	movabs $0x802433,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+    return r;
+  8032e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032e7:	eb 13                	jmp    8032fc <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8032e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032ed:	48 89 c7             	mov    %rax,%rdi
+  8032f0:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  8032f7:	00 00 00 
+  8032fa:	ff d0                	call   *%rax
+}
+  8032fc:	c9                   	leave
+  8032fd:	c3                   	ret
+
+00000000008032fe <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8032fe:	55                   	push   %rbp
+  8032ff:	48 89 e5             	mov    %rsp,%rbp
+  803302:	48 83 ec 10          	sub    $0x10,%rsp
+  803306:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80330a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80330e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803311:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803318:	00 00 00 
+  80331b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80331d:	be 00 00 00 00       	mov    $0x0,%esi
+  803322:	bf 06 00 00 00       	mov    $0x6,%edi
+  803327:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+}
+  803333:	c9                   	leave
+  803334:	c3                   	ret
+
+0000000000803335 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803335:	55                   	push   %rbp
+  803336:	48 89 e5             	mov    %rsp,%rbp
+  803339:	48 83 ec 30          	sub    $0x30,%rsp
+  80333d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803341:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803345:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803349:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80334e:	74 07                	je     803357 <devfile_read+0x22>
+  803350:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803355:	75 0a                	jne    803361 <devfile_read+0x2c>
+  return E_INVAL;
+  803357:	b8 03 00 00 00       	mov    $0x3,%eax
+  80335c:	e9 b4 00 00 00       	jmp    803415 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803361:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803368:	00 
+  while (n) {
+  803369:	e9 98 00 00 00       	jmp    803406 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80336e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803372:	8b 40 0c             	mov    0xc(%rax),%eax
+  803375:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80337c:	00 00 00 
+  80337f:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803381:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803388:	00 00 00 
+  80338b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80338f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803393:	be 00 00 00 00       	mov    $0x0,%esi
+  803398:	bf 03 00 00 00       	mov    $0x3,%edi
+  80339d:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  8033a4:	00 00 00 
+  8033a7:	ff d0                	call   *%rax
+  8033a9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8033ac:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8033b0:	7f 13                	jg     8033c5 <devfile_read+0x90>
+      return res ? res : res0;
+  8033b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8033b6:	74 07                	je     8033bf <devfile_read+0x8a>
+  8033b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033bb:	48 98                	cltq
+  8033bd:	eb 56                	jmp    803415 <devfile_read+0xe0>
+  8033bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c3:	eb 50                	jmp    803415 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8033c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033c8:	48 63 d0             	movslq %eax,%rdx
+  8033cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033cf:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8033d6:	00 00 00 
+  8033d9:	48 89 ce             	mov    %rcx,%rsi
+  8033dc:	48 89 c7             	mov    %rax,%rdi
+  8033df:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+
+    buf += res;
+  8033eb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033ee:	48 98                	cltq
+  8033f0:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8033f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033f7:	48 98                	cltq
+  8033f9:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8033fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803400:	48 98                	cltq
+  803402:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803406:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80340b:	0f 85 5d ff ff ff    	jne    80336e <devfile_read+0x39>
+  }
+
+  return res0;
+  803411:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803415:	c9                   	leave
+  803416:	c3                   	ret
+
+0000000000803417 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803417:	55                   	push   %rbp
+  803418:	48 89 e5             	mov    %rsp,%rbp
+  80341b:	48 83 ec 50          	sub    $0x50,%rsp
+  80341f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803423:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803427:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80342b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803430:	74 07                	je     803439 <devfile_write+0x22>
+  803432:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803437:	75 0a                	jne    803443 <devfile_write+0x2c>
+  return E_INVAL;
+  803439:	b8 03 00 00 00       	mov    $0x3,%eax
+  80343e:	e9 c9 00 00 00       	jmp    80350c <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803443:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80344a:	00 
+
+  while (n) {
+  80344b:	e9 ad 00 00 00       	jmp    8034fd <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803450:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803454:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803458:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  80345f:	00 
+  803460:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803468:	48 39 c2             	cmp    %rax,%rdx
+  80346b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80346f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803473:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803477:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80347b:	48 89 c6             	mov    %rax,%rsi
+  80347e:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803485:	00 00 00 
+  803488:	48 89 c7             	mov    %rax,%rdi
+  80348b:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  803492:	00 00 00 
+  803495:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803497:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80349b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80349e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8034a5:	00 00 00 
+  8034a8:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8034aa:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8034b1:	00 00 00 
+  8034b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034b8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8034bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8034c1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8034c6:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+  8034d2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8034d5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8034d9:	79 07                	jns    8034e2 <devfile_write+0xcb>
+      return res;
+  8034db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034de:	48 98                	cltq
+  8034e0:	eb 2a                	jmp    80350c <devfile_write+0xf5>
+
+    buf += res;
+  8034e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034e5:	48 98                	cltq
+  8034e7:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8034eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034ee:	48 98                	cltq
+  8034f0:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8034f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034f7:	48 98                	cltq
+  8034f9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8034fd:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803502:	0f 85 48 ff ff ff    	jne    803450 <devfile_write+0x39>
+  }
+
+  return res0;
+  803508:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80350c:	c9                   	leave
+  80350d:	c3                   	ret
+
+000000000080350e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80350e:	55                   	push   %rbp
+  80350f:	48 89 e5             	mov    %rsp,%rbp
+  803512:	48 83 ec 20          	sub    $0x20,%rsp
+  803516:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80351a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80351e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803522:	8b 40 0c             	mov    0xc(%rax),%eax
+  803525:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80352c:	00 00 00 
+  80352f:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803531:	be 00 00 00 00       	mov    $0x0,%esi
+  803536:	bf 05 00 00 00       	mov    $0x5,%edi
+  80353b:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+  803547:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80354a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80354e:	79 05                	jns    803555 <devfile_stat+0x47>
+    return r;
+  803550:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803553:	eb 59                	jmp    8035ae <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803555:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803559:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803560:	00 00 00 
+  803563:	48 89 d6             	mov    %rdx,%rsi
+  803566:	48 89 c7             	mov    %rax,%rdi
+  803569:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803575:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80357c:	00 00 00 
+  80357f:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803585:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803589:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80358f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803596:	00 00 00 
+  803599:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  80359f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035a3:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8035a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ae:	c9                   	leave
+  8035af:	c3                   	ret
+
+00000000008035b0 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035b0:	55                   	push   %rbp
+  8035b1:	48 89 e5             	mov    %rsp,%rbp
+  8035b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8035b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8035bc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8035bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035c3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035c6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8035cd:	00 00 00 
+  8035d0:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8035d2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8035d9:	00 00 00 
+  8035dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035df:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8035e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035ec:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+}
+  8035f8:	c9                   	leave
+  8035f9:	c3                   	ret
+
+00000000008035fa <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8035fa:	55                   	push   %rbp
+  8035fb:	48 89 e5             	mov    %rsp,%rbp
+  8035fe:	48 83 ec 18          	sub    $0x18,%rsp
+  803602:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803606:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803609:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  80360d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803610:	83 e0 03             	and    $0x3,%eax
+}
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+
+0000000000803615 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803615:	55                   	push   %rbp
+  803616:	48 89 e5             	mov    %rsp,%rbp
+  803619:	48 83 ec 10          	sub    $0x10,%rsp
+  80361d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803625:	48 89 c7             	mov    %rax,%rdi
+  803628:	48 b8 95 09 80 00 00 	movabs $0x800995,%rax
+  80362f:	00 00 00 
+  803632:	ff d0                	call   *%rax
+  803634:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803639:	7e 07                	jle    803642 <remove+0x2d>
+    return -E_BAD_PATH;
+  80363b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803640:	eb 36                	jmp    803678 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803646:	48 89 c6             	mov    %rax,%rsi
+  803649:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803650:	00 00 00 
+  803653:	48 89 c7             	mov    %rax,%rdi
+  803656:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  80365d:	00 00 00 
+  803660:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803662:	be 00 00 00 00       	mov    $0x0,%esi
+  803667:	bf 07 00 00 00       	mov    $0x7,%edi
+  80366c:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+}
+  803678:	c9                   	leave
+  803679:	c3                   	ret
+
+000000000080367a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80367a:	55                   	push   %rbp
+  80367b:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80367e:	be 00 00 00 00       	mov    $0x0,%esi
+  803683:	bf 08 00 00 00       	mov    $0x8,%edi
+  803688:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  80368f:	00 00 00 
+  803692:	ff d0                	call   *%rax
+}
+  803694:	5d                   	pop    %rbp
+  803695:	c3                   	ret
+
+0000000000803696 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803696:	55                   	push   %rbp
+  803697:	48 89 e5             	mov    %rsp,%rbp
+  80369a:	48 83 ec 20          	sub    $0x20,%rsp
+  80369e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8036a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8036a7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8036ac:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  8036b3:	00 00 00 
+  8036b6:	ff d0                	call   *%rax
+  8036b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036bb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036bf:	79 05                	jns    8036c6 <fs_stats+0x30>
+    return r;
+  8036c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c4:	eb 2a                	jmp    8036f0 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8036c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ca:	ba 68 00 00 00       	mov    $0x68,%edx
+  8036cf:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8036d6:	00 00 00 
+  8036d9:	48 89 ce             	mov    %rcx,%rsi
+  8036dc:	48 89 c7             	mov    %rax,%rdi
+  8036df:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  8036e6:	00 00 00 
+  8036e9:	ff d0                	call   *%rax
+  return 0;
+  8036eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+00000000008036f2 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8036fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  8036fd:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803704:	00 00 00 
+  803707:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80370a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80370c:	be 00 00 00 00       	mov    $0x0,%esi
+  803711:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803716:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  80371d:	00 00 00 
+  803720:	ff d0                	call   *%rax
+}
+  803722:	c9                   	leave
+  803723:	c3                   	ret
+
+0000000000803724 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803724:	55                   	push   %rbp
+  803725:	48 89 e5             	mov    %rsp,%rbp
+  803728:	48 83 ec 10          	sub    $0x10,%rsp
+  80372c:	89 f8                	mov    %edi,%eax
+  80372e:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803731:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803735:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80373c:	00 00 00 
+  80373f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803741:	be 00 00 00 00       	mov    $0x0,%esi
+  803746:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80374b:	48 b8 9a 31 80 00 00 	movabs $0x80319a,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+}
+  803757:	c9                   	leave
+  803758:	c3                   	ret
+
+0000000000803759 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  803759:	55                   	push   %rbp
+  80375a:	48 89 e5             	mov    %rsp,%rbp
+  80375d:	48 83 ec 20          	sub    $0x20,%rsp
+  803761:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  803765:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803769:	8b 40 10             	mov    0x10(%rax),%eax
+  80376c:	85 c0                	test   %eax,%eax
+  80376e:	7e 73                	jle    8037e3 <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  803770:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803774:	8b 40 04             	mov    0x4(%rax),%eax
+  803777:	48 63 d0             	movslq %eax,%rdx
+  80377a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80377e:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  803782:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803786:	8b 00                	mov    (%rax),%eax
+  803788:	48 89 ce             	mov    %rcx,%rsi
+  80378b:	89 c7                	mov    %eax,%edi
+  80378d:	48 b8 35 2a 80 00 00 	movabs $0x802a35,%rax
+  803794:	00 00 00 
+  803797:	ff d0                	call   *%rax
+  803799:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  80379d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8037a2:	7e 17                	jle    8037bb <writebuf+0x62>
+      b->result += result;
+  8037a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037a8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8037ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037b0:	48 01 c2             	add    %rax,%rdx
+  8037b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  8037bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037bf:	8b 40 04             	mov    0x4(%rax),%eax
+  8037c2:	48 98                	cltq
+  8037c4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8037c8:	74 19                	je     8037e3 <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  8037ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037d3:	48 85 c0             	test   %rax,%rax
+  8037d6:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8037da:	89 c2                	mov    %eax,%edx
+  8037dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e0:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  8037e3:	90                   	nop
+  8037e4:	c9                   	leave
+  8037e5:	c3                   	ret
+
+00000000008037e6 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  8037e6:	55                   	push   %rbp
+  8037e7:	48 89 e5             	mov    %rsp,%rbp
+  8037ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8037ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8037f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  8037f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  8037fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803801:	8b 40 04             	mov    0x4(%rax),%eax
+  803804:	8d 48 01             	lea    0x1(%rax),%ecx
+  803807:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80380b:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80380e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803811:	89 d1                	mov    %edx,%ecx
+  803813:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803817:	48 98                	cltq
+  803819:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  80381d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803821:	8b 40 04             	mov    0x4(%rax),%eax
+  803824:	3d 00 01 00 00       	cmp    $0x100,%eax
+  803829:	75 1e                	jne    803849 <putch+0x63>
+    writebuf(b);
+  80382b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80382f:	48 89 c7             	mov    %rax,%rdi
+  803832:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  803839:	00 00 00 
+  80383c:	ff d0                	call   *%rax
+    b->idx = 0;
+  80383e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803842:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  803849:	90                   	nop
+  80384a:	c9                   	leave
+  80384b:	c3                   	ret
+
+000000000080384c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80384c:	55                   	push   %rbp
+  80384d:	48 89 e5             	mov    %rsp,%rbp
+  803850:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  803857:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  80385d:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  803864:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  80386b:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  803871:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  803877:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80387e:	00 00 00 
+  b.result = 0;
+  803881:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  803888:	00 00 00 00 
+  b.error  = 1;
+  80388c:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  803893:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  803896:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  80389d:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  8038a4:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8038ab:	48 89 c6             	mov    %rax,%rsi
+  8038ae:	48 b8 e6 37 80 00 00 	movabs $0x8037e6,%rax
+  8038b5:	00 00 00 
+  8038b8:	48 89 c7             	mov    %rax,%rdi
+  8038bb:	48 b8 68 4f 80 00 00 	movabs $0x804f68,%rax
+  8038c2:	00 00 00 
+  8038c5:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  8038c7:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	7e 16                	jle    8038e7 <vfprintf+0x9b>
+    writebuf(&b);
+  8038d1:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8038d8:	48 89 c7             	mov    %rax,%rdi
+  8038db:	48 b8 59 37 80 00 00 	movabs $0x803759,%rax
+  8038e2:	00 00 00 
+  8038e5:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  8038e7:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8038ee:	48 85 c0             	test   %rax,%rax
+  8038f1:	74 09                	je     8038fc <vfprintf+0xb0>
+  8038f3:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8038fa:	eb 06                	jmp    803902 <vfprintf+0xb6>
+  8038fc:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  803902:	c9                   	leave
+  803903:	c3                   	ret
+
+0000000000803904 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803904:	55                   	push   %rbp
+  803905:	48 89 e5             	mov    %rsp,%rbp
+  803908:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80390f:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  803915:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80391c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803923:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80392a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803931:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803938:	84 c0                	test   %al,%al
+  80393a:	74 20                	je     80395c <fprintf+0x58>
+  80393c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803940:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803944:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803948:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80394c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803950:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803954:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803958:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80395c:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  803963:	00 00 00 
+  803966:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80396d:	00 00 00 
+  803970:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803974:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80397b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803982:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  803989:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  803990:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  803997:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80399d:	48 89 ce             	mov    %rcx,%rsi
+  8039a0:	89 c7                	mov    %eax,%edi
+  8039a2:	48 b8 4c 38 80 00 00 	movabs $0x80384c,%rax
+  8039a9:	00 00 00 
+  8039ac:	ff d0                	call   *%rax
+  8039ae:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8039b4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8039ba:	c9                   	leave
+  8039bb:	c3                   	ret
+
+00000000008039bc <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8039bc:	55                   	push   %rbp
+  8039bd:	48 89 e5             	mov    %rsp,%rbp
+  8039c0:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8039c7:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039ce:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8039d5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8039dc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039e3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039ea:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039f1:	84 c0                	test   %al,%al
+  8039f3:	74 20                	je     803a15 <printf+0x59>
+  8039f5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039f9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8039fd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a01:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a05:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a09:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a0d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a11:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  803a15:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803a1c:	00 00 00 
+  803a1f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803a26:	00 00 00 
+  803a29:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a2d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803a34:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a3b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  803a42:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  803a49:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a50:	48 89 c6             	mov    %rax,%rsi
+  803a53:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a58:	48 b8 4c 38 80 00 00 	movabs $0x80384c,%rax
+  803a5f:	00 00 00 
+  803a62:	ff d0                	call   *%rax
+  803a64:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803a6a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803a70:	c9                   	leave
+  803a71:	c3                   	ret
+
+0000000000803a72 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803a72:	55                   	push   %rbp
+  803a73:	48 89 e5             	mov    %rsp,%rbp
+  803a76:	48 83 ec 10          	sub    $0x10,%rsp
+  803a7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a82:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803a87:	48 89 c7             	mov    %rax,%rdi
+  803a8a:	48 b8 98 3a 80 00 00 	movabs $0x803a98,%rax
+  803a91:	00 00 00 
+  803a94:	ff d0                	call   *%rax
+}
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+
+0000000000803a98 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803a98:	55                   	push   %rbp
+  803a99:	48 89 e5             	mov    %rsp,%rbp
+  803a9c:	48 83 ec 50          	sub    $0x50,%rsp
+  803aa0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803aa4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803aa8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803aaf:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803ab0:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803ab5:	74 0a                	je     803ac1 <pipe_size+0x29>
+  803ab7:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803abe:	00 
+  803abf:	76 0a                	jbe    803acb <pipe_size+0x33>
+    return -E_INVAL;
+  803ac1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ac6:	e9 cc 02 00 00       	jmp    803d97 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803acb:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803acf:	48 89 c7             	mov    %rax,%rdi
+  803ad2:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  803ad9:	00 00 00 
+  803adc:	ff d0                	call   *%rax
+  803ade:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ae1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ae5:	0f 88 a8 02 00 00    	js     803d93 <pipe_size+0x2fb>
+  803aeb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aef:	ba 07 04 00 00       	mov    $0x407,%edx
+  803af4:	48 89 c6             	mov    %rax,%rsi
+  803af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803afc:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  803b03:	00 00 00 
+  803b06:	ff d0                	call   *%rax
+  803b08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b0f:	0f 88 7e 02 00 00    	js     803d93 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803b15:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803b19:	48 89 c7             	mov    %rax,%rdi
+  803b1c:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  803b23:	00 00 00 
+  803b26:	ff d0                	call   *%rax
+  803b28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b2f:	0f 88 43 02 00 00    	js     803d78 <pipe_size+0x2e0>
+  803b35:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b39:	ba 07 04 00 00       	mov    $0x407,%edx
+  803b3e:	48 89 c6             	mov    %rax,%rsi
+  803b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b46:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  803b4d:	00 00 00 
+  803b50:	ff d0                	call   *%rax
+  803b52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b59:	0f 88 19 02 00 00    	js     803d78 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803b5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b63:	48 89 c7             	mov    %rax,%rdi
+  803b66:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803b76:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803b7d:	00 
+  803b7e:	e9 a2 00 00 00       	jmp    803c25 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803b83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b87:	48 c1 e0 0c          	shl    $0xc,%rax
+  803b8b:	48 89 c2             	mov    %rax,%rdx
+  803b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b92:	48 01 d0             	add    %rdx,%rax
+  803b95:	ba 07 04 00 00       	mov    $0x407,%edx
+  803b9a:	48 89 c6             	mov    %rax,%rsi
+  803b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba2:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  803ba9:	00 00 00 
+  803bac:	ff d0                	call   *%rax
+  803bae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bb1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bb5:	0f 88 37 01 00 00    	js     803cf2 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803bbb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bbf:	48 89 c7             	mov    %rax,%rdi
+  803bc2:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+  803bce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803bd2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803bd6:	48 01 c2             	add    %rax,%rdx
+  803bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bdd:	48 c1 e0 0c          	shl    $0xc,%rax
+  803be1:	48 89 c1             	mov    %rax,%rcx
+  803be4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803be8:	48 01 c8             	add    %rcx,%rax
+  803beb:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803bf1:	48 89 d1             	mov    %rdx,%rcx
+  803bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bf9:	48 89 c6             	mov    %rax,%rsi
+  803bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c01:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+  803c0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c14:	79 0a                	jns    803c20 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803c16:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803c1b:	e9 d3 00 00 00       	jmp    803cf3 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803c20:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803c25:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803c2c:	00 
+  803c2d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803c31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c35:	48 01 d0             	add    %rdx,%rax
+  803c38:	48 83 c0 1f          	add    $0x1f,%rax
+  803c3c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803c40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c44:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c49:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803c4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c51:	48 29 d0             	sub    %rdx,%rax
+  803c54:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c58:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803c5c:	0f 82 21 ff ff ff    	jb     803b83 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803c62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c66:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803c6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c6e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803c72:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803c76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c7a:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  803c81:	00 00 00 
+  803c84:	8b 12                	mov    (%rdx),%edx
+  803c86:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803c88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c8c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803c93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c97:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  803c9e:	00 00 00 
+  803ca1:	8b 12                	mov    (%rdx),%edx
+  803ca3:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803ca5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ca9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803cb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cb4:	48 89 c7             	mov    %rax,%rdi
+  803cb7:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  803cbe:	00 00 00 
+  803cc1:	ff d0                	call   *%rax
+  803cc3:	89 c2                	mov    %eax,%edx
+  803cc5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803cc9:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803ccb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ccf:	48 89 c7             	mov    %rax,%rdi
+  803cd2:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  803cd9:	00 00 00 
+  803cdc:	ff d0                	call   *%rax
+  803cde:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803ce2:	48 83 c2 04          	add    $0x4,%rdx
+  803ce6:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ced:	e9 a5 00 00 00       	jmp    803d97 <pipe_size+0x2ff>
+      goto err2;
+  803cf2:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803cf3:	eb 58                	jmp    803d4d <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803cf5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cf9:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cfd:	48 89 c2             	mov    %rax,%rdx
+  803d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d04:	48 01 d0             	add    %rdx,%rax
+  803d07:	48 89 c6             	mov    %rax,%rsi
+  803d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0f:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  803d16:	00 00 00 
+  803d19:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803d1b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d1f:	48 89 c7             	mov    %rax,%rdi
+  803d22:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  803d29:	00 00 00 
+  803d2c:	ff d0                	call   *%rax
+  803d2e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d32:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d36:	48 01 d0             	add    %rdx,%rax
+  803d39:	48 89 c6             	mov    %rax,%rsi
+  803d3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d41:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  803d48:	00 00 00 
+  803d4b:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d51:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803d55:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803d59:	48 85 c0             	test   %rax,%rax
+  803d5c:	75 97                	jne    803cf5 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803d5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d62:	48 89 c6             	mov    %rax,%rsi
+  803d65:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d6a:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  803d71:	00 00 00 
+  803d74:	ff d0                	call   *%rax
+  803d76:	eb 01                	jmp    803d79 <pipe_size+0x2e1>
+    goto err1;
+  803d78:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803d79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d7d:	48 89 c6             	mov    %rax,%rsi
+  803d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d85:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+  803d91:	eb 01                	jmp    803d94 <pipe_size+0x2fc>
+    goto err;
+  803d93:	90                   	nop
+err:
+  return r;
+  803d94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803d97:	c9                   	leave
+  803d98:	c3                   	ret
+
+0000000000803d99 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803d99:	55                   	push   %rbp
+  803d9a:	48 89 e5             	mov    %rsp,%rbp
+  803d9d:	53                   	push   %rbx
+  803d9e:	48 83 ec 28          	sub    $0x28,%rsp
+  803da2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803da6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803daa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803db1:	00 00 00 
+  803db4:	8b 40 04             	mov    0x4(%rax),%eax
+  803db7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803dbc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803dc3:	00 00 00 
+  803dc6:	48 98                	cltq
+  803dc8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803dcf:	48 01 d0             	add    %rdx,%rax
+  803dd2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803dd8:	8b 00                	mov    (%rax),%eax
+  803dda:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803ddd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803de1:	48 89 c7             	mov    %rax,%rdi
+  803de4:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  803deb:	00 00 00 
+  803dee:	ff d0                	call   *%rax
+  803df0:	89 c3                	mov    %eax,%ebx
+  803df2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803df6:	48 89 c7             	mov    %rax,%rdi
+  803df9:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+  803e05:	39 c3                	cmp    %eax,%ebx
+  803e07:	0f 94 c0             	sete   %al
+  803e0a:	0f b6 c0             	movzbl %al,%eax
+  803e0d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803e10:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803e17:	00 00 00 
+  803e1a:	8b 40 04             	mov    0x4(%rax),%eax
+  803e1d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e22:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e29:	00 00 00 
+  803e2c:	48 98                	cltq
+  803e2e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803e35:	48 01 d0             	add    %rdx,%rax
+  803e38:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803e3e:	8b 00                	mov    (%rax),%eax
+  803e40:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803e43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e46:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803e49:	75 05                	jne    803e50 <_pipeisclosed+0xb7>
+      return ret;
+  803e4b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e4e:	eb 68                	jmp    803eb8 <_pipeisclosed+0x11f>
+    if (n != nn)
+  803e50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e53:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803e56:	0f 84 4e ff ff ff    	je     803daa <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803e5c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803e63:	00 00 00 
+  803e66:	8b 40 04             	mov    0x4(%rax),%eax
+  803e69:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e6e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e75:	00 00 00 
+  803e78:	48 98                	cltq
+  803e7a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803e81:	48 01 d0             	add    %rdx,%rax
+  803e84:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803e8a:	8b 10                	mov    (%rax),%edx
+  803e8c:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803e8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e92:	89 c6                	mov    %eax,%esi
+  803e94:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  803e9b:	00 00 00 
+  803e9e:	48 89 c7             	mov    %rax,%rdi
+  803ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea6:	49 b8 0e 4c 80 00 00 	movabs $0x804c0e,%r8
+  803ead:	00 00 00 
+  803eb0:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803eb3:	e9 f2 fe ff ff       	jmp    803daa <_pipeisclosed+0x11>
+  }
+}
+  803eb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ebc:	c9                   	leave
+  803ebd:	c3                   	ret
+
+0000000000803ebe <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  803ebe:	55                   	push   %rbp
+  803ebf:	48 89 e5             	mov    %rsp,%rbp
+  803ec2:	48 83 ec 30          	sub    $0x30,%rsp
+  803ec6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ec9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ecd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ed0:	48 89 d6             	mov    %rdx,%rsi
+  803ed3:	89 c7                	mov    %eax,%edi
+  803ed5:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  803edc:	00 00 00 
+  803edf:	ff d0                	call   *%rax
+  803ee1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ee4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ee8:	79 05                	jns    803eef <pipeisclosed+0x31>
+    return r;
+  803eea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eed:	eb 31                	jmp    803f20 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  803eef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ef3:	48 89 c7             	mov    %rax,%rdi
+  803ef6:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  803efd:	00 00 00 
+  803f00:	ff d0                	call   *%rax
+  803f02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  803f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f0a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f0e:	48 89 d6             	mov    %rdx,%rsi
+  803f11:	48 89 c7             	mov    %rax,%rdi
+  803f14:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  803f1b:	00 00 00 
+  803f1e:	ff d0                	call   *%rax
+}
+  803f20:	c9                   	leave
+  803f21:	c3                   	ret
+
+0000000000803f22 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  803f22:	55                   	push   %rbp
+  803f23:	48 89 e5             	mov    %rsp,%rbp
+  803f26:	48 83 ec 10          	sub    $0x10,%rsp
+  803f2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  803f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f32:	8b 40 18             	mov    0x18(%rax),%eax
+  803f35:	8d 50 01             	lea    0x1(%rax),%edx
+  803f38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f3c:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  803f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f43:	8b 40 1c             	mov    0x1c(%rax),%eax
+  803f46:	85 c0                	test   %eax,%eax
+  803f48:	74 27                	je     803f71 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  803f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f4e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  803f55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f59:	48 83 c0 18          	add    $0x18,%rax
+  803f5d:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  803f62:	48 89 c7             	mov    %rax,%rdi
+  803f65:	48 b8 5f 1c 80 00 00 	movabs $0x801c5f,%rax
+  803f6c:	00 00 00 
+  803f6f:	ff d0                	call   *%rax
+  }
+}
+  803f71:	90                   	nop
+  803f72:	c9                   	leave
+  803f73:	c3                   	ret
+
+0000000000803f74 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  803f74:	55                   	push   %rbp
+  803f75:	48 89 e5             	mov    %rsp,%rbp
+  803f78:	48 83 ec 10          	sub    $0x10,%rsp
+  803f7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803f80:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  803f83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f87:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  803f8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f92:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  803f96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f99:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  803fa0:	89 c6                	mov    %eax,%esi
+  803fa2:	48 89 cf             	mov    %rcx,%rdi
+  803fa5:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  803fac:	00 00 00 
+  803faf:	ff d0                	call   *%rax
+}
+  803fb1:	90                   	nop
+  803fb2:	c9                   	leave
+  803fb3:	c3                   	ret
+
+0000000000803fb4 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fb4:	55                   	push   %rbp
+  803fb5:	48 89 e5             	mov    %rsp,%rbp
+  803fb8:	48 83 ec 70          	sub    $0x70,%rsp
+  803fbc:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803fc0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803fc4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  803fc8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803fcc:	48 89 c7             	mov    %rax,%rdi
+  803fcf:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  803fd6:	00 00 00 
+  803fd9:	ff d0                	call   *%rax
+  803fdb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  803fdf:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  803fe4:	75 0a                	jne    803ff0 <devpipe_read+0x3c>
+    return 0;
+  803fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803feb:	e9 63 01 00 00       	jmp    804153 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  803ff0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ff4:	8b 40 18             	mov    0x18(%rax),%eax
+  803ff7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  803ffa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ffe:	48 8b 10             	mov    (%rax),%rdx
+  804001:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804005:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804009:	48 39 c2             	cmp    %rax,%rdx
+  80400c:	75 42                	jne    804050 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80400e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804012:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804016:	48 89 d6             	mov    %rdx,%rsi
+  804019:	48 89 c7             	mov    %rax,%rdi
+  80401c:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  804023:	00 00 00 
+  804026:	ff d0                	call   *%rax
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	74 0a                	je     804036 <devpipe_read+0x82>
+      return 0;
+  80402c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804031:	e9 1d 01 00 00       	jmp    804153 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804036:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804039:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80403d:	89 d6                	mov    %edx,%esi
+  80403f:	48 89 c7             	mov    %rax,%rdi
+  804042:	48 b8 74 3f 80 00 00 	movabs $0x803f74,%rax
+  804049:	00 00 00 
+  80404c:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80404e:	eb a0                	jmp    803ff0 <devpipe_read+0x3c>
+      break;
+  804050:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804051:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804055:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804059:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80405d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804065:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804069:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80406d:	48 8b 00             	mov    (%rax),%rax
+  804070:	48 29 c2             	sub    %rax,%rdx
+  804073:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804077:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80407b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80407f:	48 39 c2             	cmp    %rax,%rdx
+  804082:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804086:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80408a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80408e:	48 8b 00             	mov    (%rax),%rax
+  804091:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804095:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80409e:	48 f7 f1             	div    %rcx
+  8040a1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8040a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8040a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8040b5:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8040b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040c1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040c5:	48 39 c2             	cmp    %rax,%rdx
+  8040c8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8040cc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8040d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040d4:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8040d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040dc:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8040e0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8040e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040e8:	48 89 ce             	mov    %rcx,%rsi
+  8040eb:	48 89 c7             	mov    %rax,%rdi
+  8040ee:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  8040f5:	00 00 00 
+  8040f8:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8040fa:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8040fe:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804102:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804106:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80410a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80410e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804112:	48 01 d1             	add    %rdx,%rcx
+  804115:	48 89 c2             	mov    %rax,%rdx
+  804118:	48 89 cf             	mov    %rcx,%rdi
+  80411b:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  804122:	00 00 00 
+  804125:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804127:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80412b:	48 8b 10             	mov    (%rax),%rdx
+  80412e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804132:	48 01 c2             	add    %rax,%rdx
+  804135:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804139:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80413c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804140:	48 89 c7             	mov    %rax,%rdi
+  804143:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  80414a:	00 00 00 
+  80414d:	ff d0                	call   *%rax
+  return n;
+  80414f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804153:	c9                   	leave
+  804154:	c3                   	ret
+
+0000000000804155 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804155:	55                   	push   %rbp
+  804156:	48 89 e5             	mov    %rsp,%rbp
+  804159:	48 83 ec 70          	sub    $0x70,%rsp
+  80415d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804161:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804165:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804169:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80416d:	48 89 c7             	mov    %rax,%rdi
+  804170:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  804177:	00 00 00 
+  80417a:	ff d0                	call   *%rax
+  80417c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804180:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804184:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804188:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80418f:	00 
+  804190:	e9 b8 01 00 00       	jmp    80434d <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804199:	8b 40 18             	mov    0x18(%rax),%eax
+  80419c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80419f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ab:	48 8b 00             	mov    (%rax),%rax
+  8041ae:	48 29 c2             	sub    %rax,%rdx
+  8041b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041b9:	48 39 c2             	cmp    %rax,%rdx
+  8041bc:	75 4d                	jne    80420b <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8041be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8041c6:	48 89 d6             	mov    %rdx,%rsi
+  8041c9:	48 89 c7             	mov    %rax,%rdi
+  8041cc:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	74 0a                	je     8041e6 <devpipe_write+0x91>
+        return 0;
+  8041dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e1:	e9 79 01 00 00       	jmp    80435f <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8041e6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8041e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ed:	89 d6                	mov    %edx,%esi
+  8041ef:	48 89 c7             	mov    %rax,%rdi
+  8041f2:	48 b8 74 3f 80 00 00 	movabs $0x803f74,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+      m = 0;
+  8041fe:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804205:	00 
+      continue;
+  804206:	e9 3a 01 00 00       	jmp    804345 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80420b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80420f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804213:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80421f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804223:	48 8b 08             	mov    (%rax),%rcx
+  804226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80422e:	48 29 c1             	sub    %rax,%rcx
+  804231:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804235:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804239:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80423d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804241:	48 39 c2             	cmp    %rax,%rdx
+  804244:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804248:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80424c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804250:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804254:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804258:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80425c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804261:	48 f7 f1             	div    %rcx
+  804264:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804268:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80426c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804274:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804278:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80427c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804280:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804284:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804288:	48 39 c2             	cmp    %rax,%rdx
+  80428b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80428f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804293:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804297:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80429b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80429f:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8042a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042a7:	48 01 d1             	add    %rdx,%rcx
+  8042aa:	48 89 c2             	mov    %rax,%rdx
+  8042ad:	48 89 cf             	mov    %rcx,%rdi
+  8042b0:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  8042b7:	00 00 00 
+  8042ba:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8042bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042c0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042c4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8042c8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8042cc:	73 4d                	jae    80431b <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8042ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042da:	48 29 c2             	sub    %rax,%rdx
+  8042dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042e1:	48 01 c2             	add    %rax,%rdx
+  8042e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042ec:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8042f0:	48 89 c1             	mov    %rax,%rcx
+  8042f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042f7:	48 01 c1             	add    %rax,%rcx
+  8042fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042fe:	48 01 c1             	add    %rax,%rcx
+  804301:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804305:	48 83 c0 20          	add    $0x20,%rax
+  804309:	48 89 ce             	mov    %rcx,%rsi
+  80430c:	48 89 c7             	mov    %rax,%rdi
+  80430f:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  804316:	00 00 00 
+  804319:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80431b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80431f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804323:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804327:	48 01 c2             	add    %rax,%rdx
+  80432a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804332:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804336:	48 89 c7             	mov    %rax,%rdi
+  804339:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804345:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804349:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80434d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804351:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804355:	0f 82 3a fe ff ff    	jb     804195 <devpipe_write+0x40>
+  }
+
+  return i;
+  80435b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80435f:	c9                   	leave
+  804360:	c3                   	ret
+
+0000000000804361 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804361:	55                   	push   %rbp
+  804362:	48 89 e5             	mov    %rsp,%rbp
+  804365:	48 83 ec 40          	sub    $0x40,%rsp
+  804369:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80436d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804370:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804374:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804378:	48 89 c7             	mov    %rax,%rdi
+  80437b:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+  804387:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80438b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804392:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804396:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80439a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80439e:	48 89 d6             	mov    %rdx,%rsi
+  8043a1:	48 89 c7             	mov    %rax,%rdi
+  8043a4:	48 b8 23 2d 80 00 00 	movabs $0x802d23,%rax
+  8043ab:	00 00 00 
+  8043ae:	ff d0                	call   *%rax
+  8043b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043b7:	79 08                	jns    8043c1 <devpipe_poll+0x60>
+    return r;
+  8043b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043bc:	e9 85 00 00 00       	jmp    804446 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8043c1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8043c4:	83 e0 01             	and    $0x1,%eax
+  8043c7:	85 c0                	test   %eax,%eax
+  8043c9:	74 18                	je     8043e3 <devpipe_poll+0x82>
+  8043cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043cf:	48 8b 10             	mov    (%rax),%rdx
+  8043d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043d6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043da:	48 39 c2             	cmp    %rax,%rdx
+  8043dd:	74 04                	je     8043e3 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8043df:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8043e3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8043e6:	83 e0 02             	and    $0x2,%eax
+  8043e9:	85 c0                	test   %eax,%eax
+  8043eb:	74 23                	je     804410 <devpipe_poll+0xaf>
+  8043ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043f1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8043f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043f9:	48 8b 00             	mov    (%rax),%rax
+  8043fc:	48 29 c2             	sub    %rax,%rdx
+  8043ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804403:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804407:	48 39 c2             	cmp    %rax,%rdx
+  80440a:	73 04                	jae    804410 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80440c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804410:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804414:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804418:	48 89 d6             	mov    %rdx,%rsi
+  80441b:	48 89 c7             	mov    %rax,%rdi
+  80441e:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  804425:	00 00 00 
+  804428:	ff d0                	call   *%rax
+  80442a:	85 c0                	test   %eax,%eax
+  80442c:	74 04                	je     804432 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80442e:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804432:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804436:	75 0b                	jne    804443 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804438:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80443c:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804443:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804446:	c9                   	leave
+  804447:	c3                   	ret
+
+0000000000804448 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804448:	55                   	push   %rbp
+  804449:	48 89 e5             	mov    %rsp,%rbp
+  80444c:	48 83 ec 20          	sub    $0x20,%rsp
+  804450:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804454:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804458:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80445c:	48 89 c7             	mov    %rax,%rdi
+  80445f:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+  80446b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80446f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804473:	48 ba d1 5c 80 00 00 	movabs $0x805cd1,%rdx
+  80447a:	00 00 00 
+  80447d:	48 89 d6             	mov    %rdx,%rsi
+  804480:	48 89 c7             	mov    %rax,%rdi
+  804483:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  80448a:	00 00 00 
+  80448d:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80448f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804493:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804497:	89 c1                	mov    %eax,%ecx
+  804499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80449d:	48 8b 00             	mov    (%rax),%rax
+  8044a0:	89 c2                	mov    %eax,%edx
+  8044a2:	89 c8                	mov    %ecx,%eax
+  8044a4:	29 d0                	sub    %edx,%eax
+  8044a6:	89 c2                	mov    %eax,%edx
+  8044a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044ac:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8044b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b6:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8044bd:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8044c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c4:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8044cb:	00 00 00 
+  8044ce:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8044d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044da:	c9                   	leave
+  8044db:	c3                   	ret
+
+00000000008044dc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8044dc:	55                   	push   %rbp
+  8044dd:	48 89 e5             	mov    %rsp,%rbp
+  8044e0:	48 83 ec 40          	sub    $0x40,%rsp
+  8044e4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044ec:	48 89 c7             	mov    %rax,%rdi
+  8044ef:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  8044f6:	00 00 00 
+  8044f9:	ff d0                	call   *%rax
+  8044fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8044ff:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804506:	00 
+  804507:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80450b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80450f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804513:	48 01 d0             	add    %rdx,%rax
+  804516:	48 83 c0 1f          	add    $0x1f,%rax
+  80451a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80451e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804522:	ba 00 00 00 00       	mov    $0x0,%edx
+  804527:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80452b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80452f:	48 29 d0             	sub    %rdx,%rax
+  804532:	48 c1 e8 0c          	shr    $0xc,%rax
+  804536:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80453a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80453e:	48 89 c6             	mov    %rax,%rsi
+  804541:	bf 00 00 00 00       	mov    $0x0,%edi
+  804546:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  80454d:	00 00 00 
+  804550:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804552:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804556:	48 89 c7             	mov    %rax,%rdi
+  804559:	48 b8 22 3f 80 00 00 	movabs $0x803f22,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804565:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804569:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80456d:	eb 2f                	jmp    80459e <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80456f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804573:	48 83 e8 01          	sub    $0x1,%rax
+  804577:	48 c1 e0 0c          	shl    $0xc,%rax
+  80457b:	48 89 c2             	mov    %rax,%rdx
+  80457e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804582:	48 01 d0             	add    %rdx,%rax
+  804585:	48 89 c6             	mov    %rax,%rsi
+  804588:	bf 00 00 00 00       	mov    $0x0,%edi
+  80458d:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  804594:	00 00 00 
+  804597:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804599:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80459e:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8045a3:	77 ca                	ja     80456f <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8045a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045a9:	48 89 c6             	mov    %rax,%rsi
+  8045ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045b1:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8045b8:	00 00 00 
+  8045bb:	ff d0                	call   *%rax
+}
+  8045bd:	c9                   	leave
+  8045be:	c3                   	ret
+
+00000000008045bf <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8045bf:	55                   	push   %rbp
+  8045c0:	48 89 e5             	mov    %rsp,%rbp
+  8045c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8045ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045ce:	75 10                	jne    8045e0 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8045d0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8045d7:	00 00 00 
+  8045da:	8b 00                	mov    (%rax),%eax
+  8045dc:	48 98                	cltq
+  8045de:	eb 05                	jmp    8045e5 <vsyscall+0x26>
+  }
+  return 0;
+  8045e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045e5:	c9                   	leave
+  8045e6:	c3                   	ret
+
+00000000008045e7 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8045e7:	55                   	push   %rbp
+  8045e8:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8045eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045f0:	48 b8 bf 45 80 00 00 	movabs $0x8045bf,%rax
+  8045f7:	00 00 00 
+  8045fa:	ff d0                	call   *%rax
+}
+  8045fc:	5d                   	pop    %rbp
+  8045fd:	c3                   	ret
+
+00000000008045fe <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8045fe:	55                   	push   %rbp
+  8045ff:	48 89 e5             	mov    %rsp,%rbp
+  804602:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804606:	0f 31                	rdtsc
+  804608:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80460b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80460e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804611:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804614:	48 c1 e2 20          	shl    $0x20,%rdx
+  804618:	48 09 d0             	or     %rdx,%rax
+  80461b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80461f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804623:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804627:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80462e:	00 00 00 
+  804631:	8b 40 08             	mov    0x8(%rax),%eax
+  804634:	48 98                	cltq
+  804636:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80463a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80463e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804643:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804647:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80464e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804652:	ba 00 00 00 00       	mov    $0x0,%edx
+  804657:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80465b:	48 89 d0             	mov    %rdx,%rax
+  80465e:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80466e:	48 01 c8             	add    %rcx,%rax
+}
+  804671:	c9                   	leave
+  804672:	c3                   	ret
+
+0000000000804673 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804673:	55                   	push   %rbp
+  804674:	48 89 e5             	mov    %rsp,%rbp
+  804677:	48 83 ec 20          	sub    $0x20,%rsp
+  80467b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80467e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804681:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804684:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804688:	be 01 00 00 00       	mov    $0x1,%esi
+  80468d:	48 89 c7             	mov    %rax,%rdi
+  804690:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  804697:	00 00 00 
+  80469a:	ff d0                	call   *%rax
+}
+  80469c:	90                   	nop
+  80469d:	c9                   	leave
+  80469e:	c3                   	ret
+
+000000000080469f <getchar>:
+
+int
+getchar(void) {
+  80469f:	55                   	push   %rbp
+  8046a0:	48 89 e5             	mov    %rsp,%rbp
+  8046a3:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8046a7:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8046ab:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046b0:	48 89 c6             	mov    %rax,%rsi
+  8046b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046b8:	48 b8 b9 28 80 00 00 	movabs $0x8028b9,%rax
+  8046bf:	00 00 00 
+  8046c2:	ff d0                	call   *%rax
+  8046c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8046c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046cb:	79 05                	jns    8046d2 <getchar+0x33>
+    return r;
+  8046cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046d0:	eb 14                	jmp    8046e6 <getchar+0x47>
+  if (r < 1)
+  8046d2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046d6:	7f 07                	jg     8046df <getchar+0x40>
+    return -E_EOF;
+  8046d8:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8046dd:	eb 07                	jmp    8046e6 <getchar+0x47>
+  return c;
+  8046df:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8046e3:	0f b6 c0             	movzbl %al,%eax
+}
+  8046e6:	c9                   	leave
+  8046e7:	c3                   	ret
+
+00000000008046e8 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8046e8:	55                   	push   %rbp
+  8046e9:	48 89 e5             	mov    %rsp,%rbp
+  8046ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8046f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046f3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8046f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046fa:	48 89 d6             	mov    %rdx,%rsi
+  8046fd:	89 c7                	mov    %eax,%edi
+  8046ff:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  804706:	00 00 00 
+  804709:	ff d0                	call   *%rax
+  80470b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80470e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804712:	79 05                	jns    804719 <iscons+0x31>
+    return r;
+  804714:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804717:	eb 1a                	jmp    804733 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804719:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80471d:	8b 10                	mov    (%rax),%edx
+  80471f:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804726:	00 00 00 
+  804729:	8b 00                	mov    (%rax),%eax
+  80472b:	39 c2                	cmp    %eax,%edx
+  80472d:	0f 94 c0             	sete   %al
+  804730:	0f b6 c0             	movzbl %al,%eax
+}
+  804733:	c9                   	leave
+  804734:	c3                   	ret
+
+0000000000804735 <opencons>:
+
+int
+opencons(void) {
+  804735:	55                   	push   %rbp
+  804736:	48 89 e5             	mov    %rsp,%rbp
+  804739:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80473d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804741:	48 89 c7             	mov    %rax,%rdi
+  804744:	48 b8 7b 22 80 00 00 	movabs $0x80227b,%rax
+  80474b:	00 00 00 
+  80474e:	ff d0                	call   *%rax
+  804750:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804753:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804757:	79 05                	jns    80475e <opencons+0x29>
+    return r;
+  804759:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80475c:	eb 66                	jmp    8047c4 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80475e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804762:	ba 07 04 00 00       	mov    $0x407,%edx
+  804767:	48 89 c6             	mov    %rax,%rsi
+  80476a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80476f:	48 b8 64 18 80 00 00 	movabs $0x801864,%rax
+  804776:	00 00 00 
+  804779:	ff d0                	call   *%rax
+  80477b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80477e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804782:	79 05                	jns    804789 <opencons+0x54>
+    return r;
+  804784:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804787:	eb 3b                	jmp    8047c4 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804789:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80478d:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  804794:	00 00 00 
+  804797:	8b 12                	mov    (%rdx),%edx
+  804799:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  80479b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80479f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8047a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047aa:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8047b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b5:	48 89 c7             	mov    %rax,%rdi
+  8047b8:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  8047bf:	00 00 00 
+  8047c2:	ff d0                	call   *%rax
+}
+  8047c4:	c9                   	leave
+  8047c5:	c3                   	ret
+
+00000000008047c6 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8047c6:	55                   	push   %rbp
+  8047c7:	48 89 e5             	mov    %rsp,%rbp
+  8047ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8047ce:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047d1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8047d4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8047d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047db:	48 89 d6             	mov    %rdx,%rsi
+  8047de:	89 c7                	mov    %eax,%edi
+  8047e0:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  8047e7:	00 00 00 
+  8047ea:	ff d0                	call   *%rax
+  8047ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047f3:	79 05                	jns    8047fa <consmode+0x34>
+    return r;
+  8047f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047f8:	eb 34                	jmp    80482e <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8047fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047fe:	8b 10                	mov    (%rax),%edx
+  804800:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804807:	00 00 00 
+  80480a:	8b 00                	mov    (%rax),%eax
+  80480c:	39 c2                	cmp    %eax,%edx
+  80480e:	74 07                	je     804817 <consmode+0x51>
+    return -E_INVAL;
+  804810:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804815:	eb 17                	jmp    80482e <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80481b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80481e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804821:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804825:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804828:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80482b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80482e:	c9                   	leave
+  80482f:	c3                   	ret
+
+0000000000804830 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804830:	55                   	push   %rbp
+  804831:	48 89 e5             	mov    %rsp,%rbp
+  804834:	48 83 ec 20          	sub    $0x20,%rsp
+  804838:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80483c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804840:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804848:	8b 50 0c             	mov    0xc(%rax),%edx
+  80484b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80484f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804853:	48 89 ce             	mov    %rcx,%rsi
+  804856:	48 89 c7             	mov    %rax,%rdi
+  804859:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  804860:	00 00 00 
+  804863:	ff d0                	call   *%rax
+  804865:	48 98                	cltq
+}
+  804867:	c9                   	leave
+  804868:	c3                   	ret
+
+0000000000804869 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804869:	55                   	push   %rbp
+  80486a:	48 89 e5             	mov    %rsp,%rbp
+  80486d:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804874:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  80487b:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804882:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804889:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804890:	eb 74                	jmp    804906 <devcons_write+0x9d>
+    m = n - tot;
+  804892:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804899:	89 c2                	mov    %eax,%edx
+  80489b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80489e:	29 c2                	sub    %eax,%edx
+  8048a0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8048a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8048a6:	83 f8 7f             	cmp    $0x7f,%eax
+  8048a9:	76 07                	jbe    8048b2 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8048ab:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8048b2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8048b5:	48 63 d0             	movslq %eax,%rdx
+  8048b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048bb:	48 63 c8             	movslq %eax,%rcx
+  8048be:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8048c5:	48 01 c1             	add    %rax,%rcx
+  8048c8:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8048cf:	48 89 ce             	mov    %rcx,%rsi
+  8048d2:	48 89 c7             	mov    %rax,%rdi
+  8048d5:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  8048dc:	00 00 00 
+  8048df:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8048e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8048e4:	48 63 d0             	movslq %eax,%rdx
+  8048e7:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8048ee:	48 89 d6             	mov    %rdx,%rsi
+  8048f1:	48 89 c7             	mov    %rax,%rdi
+  8048f4:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8048fb:	00 00 00 
+  8048fe:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804900:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804903:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804906:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804909:	48 98                	cltq
+  80490b:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804912:	0f 82 7a ff ff ff    	jb     804892 <devcons_write+0x29>
+  }
+  return tot;
+  804918:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80491b:	48 98                	cltq
+}
+  80491d:	c9                   	leave
+  80491e:	c3                   	ret
+
+000000000080491f <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80491f:	55                   	push   %rbp
+  804920:	48 89 e5             	mov    %rsp,%rbp
+  804923:	48 83 ec 08          	sub    $0x8,%rsp
+  804927:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80492b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804930:	c9                   	leave
+  804931:	c3                   	ret
+
+0000000000804932 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804932:	55                   	push   %rbp
+  804933:	48 89 e5             	mov    %rsp,%rbp
+  804936:	48 83 ec 10          	sub    $0x10,%rsp
+  80493a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80493e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804942:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804946:	48 ba dd 5c 80 00 00 	movabs $0x805cdd,%rdx
+  80494d:	00 00 00 
+  804950:	48 89 d6             	mov    %rdx,%rsi
+  804953:	48 89 c7             	mov    %rax,%rdi
+  804956:	48 b8 96 0a 80 00 00 	movabs $0x800a96,%rax
+  80495d:	00 00 00 
+  804960:	ff d0                	call   *%rax
+  return 0;
+  804962:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804967:	c9                   	leave
+  804968:	c3                   	ret
+
+0000000000804969 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804969:	55                   	push   %rbp
+  80496a:	48 89 e5             	mov    %rsp,%rbp
+  80496d:	48 83 ec 30          	sub    $0x30,%rsp
+  804971:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804975:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804978:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  80497c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804983:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804986:	83 e0 02             	and    $0x2,%eax
+  804989:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  80498c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804990:	8b 40 0c             	mov    0xc(%rax),%eax
+  804993:	83 f8 01             	cmp    $0x1,%eax
+  804996:	75 04                	jne    80499c <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804998:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  80499c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80499f:	83 e0 01             	and    $0x1,%eax
+  8049a2:	85 c0                	test   %eax,%eax
+  8049a4:	74 44                	je     8049ea <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8049a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8049ae:	89 c2                	mov    %eax,%edx
+  8049b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8049b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ba:	48 b8 ac 1c 80 00 00 	movabs $0x801cac,%rax
+  8049c1:	00 00 00 
+  8049c4:	ff d0                	call   *%rax
+  8049c6:	83 f8 01             	cmp    $0x1,%eax
+  8049c9:	75 06                	jne    8049d1 <devcons_poll+0x68>
+      revents |= POLLIN;
+  8049cb:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8049cf:	eb 19                	jmp    8049ea <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  8049d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049d5:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8049db:	0b 45 fc             	or     -0x4(%rbp),%eax
+  8049de:	89 c2                	mov    %eax,%edx
+  8049e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049e4:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  8049ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8049ed:	c9                   	leave
+  8049ee:	c3                   	ret
+
+00000000008049ef <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8049ef:	55                   	push   %rbp
+  8049f0:	48 89 e5             	mov    %rsp,%rbp
+  8049f3:	53                   	push   %rbx
+  8049f4:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8049fb:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804a02:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804a08:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804a0f:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804a16:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804a1d:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804a24:	84 c0                	test   %al,%al
+  804a26:	74 23                	je     804a4b <_panic+0x5c>
+  804a28:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804a2f:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804a33:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804a37:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804a3b:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804a3f:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804a43:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804a47:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804a4b:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804a52:	00 00 00 
+  804a55:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804a5c:	00 00 00 
+  804a5f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a63:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804a6a:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804a71:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804a78:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  804a7f:	00 00 00 
+  804a82:	48 8b 18             	mov    (%rax),%rbx
+  804a85:	48 b8 eb 17 80 00 00 	movabs $0x8017eb,%rax
+  804a8c:	00 00 00 
+  804a8f:	ff d0                	call   *%rax
+  804a91:	89 c6                	mov    %eax,%esi
+  804a93:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804a99:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804aa0:	41 89 d0             	mov    %edx,%r8d
+  804aa3:	48 89 c1             	mov    %rax,%rcx
+  804aa6:	48 89 da             	mov    %rbx,%rdx
+  804aa9:	48 b8 e8 5c 80 00 00 	movabs $0x805ce8,%rax
+  804ab0:	00 00 00 
+  804ab3:	48 89 c7             	mov    %rax,%rdi
+  804ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804abb:	49 b9 0e 4c 80 00 00 	movabs $0x804c0e,%r9
+  804ac2:	00 00 00 
+  804ac5:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804ac8:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804acf:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804ad6:	48 89 d6             	mov    %rdx,%rsi
+  804ad9:	48 89 c7             	mov    %rax,%rdi
+  804adc:	48 b8 83 4b 80 00 00 	movabs $0x804b83,%rax
+  804ae3:	00 00 00 
+  804ae6:	ff d0                	call   *%rax
+  cprintf("\n");
+  804ae8:	48 b8 0b 5d 80 00 00 	movabs $0x805d0b,%rax
+  804aef:	00 00 00 
+  804af2:	48 89 c7             	mov    %rax,%rdi
+  804af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afa:	48 ba 0e 4c 80 00 00 	movabs $0x804c0e,%rdx
+  804b01:	00 00 00 
+  804b04:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804b06:	cc                   	int3
+  804b07:	eb fd                	jmp    804b06 <_panic+0x117>
+
+0000000000804b09 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  804b09:	55                   	push   %rbp
+  804b0a:	48 89 e5             	mov    %rsp,%rbp
+  804b0d:	48 83 ec 10          	sub    $0x10,%rsp
+  804b11:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804b14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  804b18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b1c:	8b 00                	mov    (%rax),%eax
+  804b1e:	8d 48 01             	lea    0x1(%rax),%ecx
+  804b21:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b25:	89 0a                	mov    %ecx,(%rdx)
+  804b27:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804b2a:	89 d1                	mov    %edx,%ecx
+  804b2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b30:	48 98                	cltq
+  804b32:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  804b36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b3a:	8b 00                	mov    (%rax),%eax
+  804b3c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  804b41:	75 2c                	jne    804b6f <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  804b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b47:	8b 00                	mov    (%rax),%eax
+  804b49:	48 98                	cltq
+  804b4b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b4f:	48 83 c2 08          	add    $0x8,%rdx
+  804b53:	48 89 c6             	mov    %rax,%rsi
+  804b56:	48 89 d7             	mov    %rdx,%rdi
+  804b59:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  804b60:	00 00 00 
+  804b63:	ff d0                	call   *%rax
+    b->idx = 0;
+  804b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b69:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  804b6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b73:	8b 40 04             	mov    0x4(%rax),%eax
+  804b76:	8d 50 01             	lea    0x1(%rax),%edx
+  804b79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b7d:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804b80:	90                   	nop
+  804b81:	c9                   	leave
+  804b82:	c3                   	ret
+
+0000000000804b83 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  804b83:	55                   	push   %rbp
+  804b84:	48 89 e5             	mov    %rsp,%rbp
+  804b87:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804b8e:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  804b95:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  804b9c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  804ba3:	00 00 00 
+  b.cnt = 0;
+  804ba6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  804bad:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  804bb0:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  804bb7:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  804bbe:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  804bc5:	48 89 c6             	mov    %rax,%rsi
+  804bc8:	48 b8 09 4b 80 00 00 	movabs $0x804b09,%rax
+  804bcf:	00 00 00 
+  804bd2:	48 89 c7             	mov    %rax,%rdi
+  804bd5:	48 b8 68 4f 80 00 00 	movabs $0x804f68,%rax
+  804bdc:	00 00 00 
+  804bdf:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  804be1:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  804be7:	48 98                	cltq
+  804be9:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  804bf0:	48 83 c2 08          	add    $0x8,%rdx
+  804bf4:	48 89 c6             	mov    %rax,%rsi
+  804bf7:	48 89 d7             	mov    %rdx,%rdi
+  804bfa:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  804c01:	00 00 00 
+  804c04:	ff d0                	call   *%rax
+
+  return b.cnt;
+  804c06:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  804c0c:	c9                   	leave
+  804c0d:	c3                   	ret
+
+0000000000804c0e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  804c0e:	55                   	push   %rbp
+  804c0f:	48 89 e5             	mov    %rsp,%rbp
+  804c12:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804c19:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804c20:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804c27:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804c2e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804c35:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804c3c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804c43:	84 c0                	test   %al,%al
+  804c45:	74 20                	je     804c67 <cprintf+0x59>
+  804c47:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804c4b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804c4f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804c53:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804c57:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804c5b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804c5f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804c63:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804c67:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804c6e:	00 00 00 
+  804c71:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804c78:	00 00 00 
+  804c7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804c7f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804c86:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804c8d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  804c94:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804c9b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804ca2:	48 89 d6             	mov    %rdx,%rsi
+  804ca5:	48 89 c7             	mov    %rax,%rdi
+  804ca8:	48 b8 83 4b 80 00 00 	movabs $0x804b83,%rax
+  804caf:	00 00 00 
+  804cb2:	ff d0                	call   *%rax
+  804cb4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804cba:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804cc0:	c9                   	leave
+  804cc1:	c3                   	ret
+
+0000000000804cc2 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  804cc2:	55                   	push   %rbp
+  804cc3:	48 89 e5             	mov    %rsp,%rbp
+  804cc6:	48 83 ec 30          	sub    $0x30,%rsp
+  804cca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804cd2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804cd6:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  804cd9:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  804cdd:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  804ce1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ce4:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  804ce8:	72 54                	jb     804d3e <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  804cea:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ced:	8d 78 ff             	lea    -0x1(%rax),%edi
+  804cf0:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  804cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cfc:	48 f7 f6             	div    %rsi
+  804cff:	49 89 c2             	mov    %rax,%r10
+  804d02:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804d05:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804d08:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804d0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d10:	41 89 c9             	mov    %ecx,%r9d
+  804d13:	41 89 f8             	mov    %edi,%r8d
+  804d16:	89 d1                	mov    %edx,%ecx
+  804d18:	4c 89 d2             	mov    %r10,%rdx
+  804d1b:	48 89 c7             	mov    %rax,%rdi
+  804d1e:	48 b8 c2 4c 80 00 00 	movabs $0x804cc2,%rax
+  804d25:	00 00 00 
+  804d28:	ff d0                	call   *%rax
+  804d2a:	eb 1c                	jmp    804d48 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  804d2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d33:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804d37:	48 89 d6             	mov    %rdx,%rsi
+  804d3a:	89 c7                	mov    %eax,%edi
+  804d3c:	ff d1                	call   *%rcx
+    while (--width > 0)
+  804d3e:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  804d42:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804d46:	7f e4                	jg     804d2c <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  804d48:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  804d4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d54:	48 f7 f1             	div    %rcx
+  804d57:	48 b8 50 5f 80 00 00 	movabs $0x805f50,%rax
+  804d5e:	00 00 00 
+  804d61:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  804d65:	0f be c0             	movsbl %al,%eax
+  804d68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d6c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804d70:	48 89 d6             	mov    %rdx,%rsi
+  804d73:	89 c7                	mov    %eax,%edi
+  804d75:	ff d1                	call   *%rcx
+}
+  804d77:	90                   	nop
+  804d78:	c9                   	leave
+  804d79:	c3                   	ret
+
+0000000000804d7a <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  804d7a:	55                   	push   %rbp
+  804d7b:	48 89 e5             	mov    %rsp,%rbp
+  804d7e:	48 83 ec 10          	sub    $0x10,%rsp
+  804d82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d86:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  804d89:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  804d8d:	7e 4b                	jle    804dda <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  804d8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d93:	8b 00                	mov    (%rax),%eax
+  804d95:	83 f8 2f             	cmp    $0x2f,%eax
+  804d98:	77 24                	ja     804dbe <getuint+0x44>
+  804d9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804da2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804da6:	8b 00                	mov    (%rax),%eax
+  804da8:	89 c0                	mov    %eax,%eax
+  804daa:	48 01 d0             	add    %rdx,%rax
+  804dad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804db1:	8b 12                	mov    (%rdx),%edx
+  804db3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804db6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dba:	89 0a                	mov    %ecx,(%rdx)
+  804dbc:	eb 14                	jmp    804dd2 <getuint+0x58>
+  804dbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804dc6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804dca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804dd2:	48 8b 00             	mov    (%rax),%rax
+  804dd5:	e9 95 00 00 00       	jmp    804e6f <getuint+0xf5>
+  else if (lflag)
+  804dda:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804dde:	74 48                	je     804e28 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  804de0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804de4:	8b 00                	mov    (%rax),%eax
+  804de6:	83 f8 2f             	cmp    $0x2f,%eax
+  804de9:	77 24                	ja     804e0f <getuint+0x95>
+  804deb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804def:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804df3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df7:	8b 00                	mov    (%rax),%eax
+  804df9:	89 c0                	mov    %eax,%eax
+  804dfb:	48 01 d0             	add    %rdx,%rax
+  804dfe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e02:	8b 12                	mov    (%rdx),%edx
+  804e04:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804e07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e0b:	89 0a                	mov    %ecx,(%rdx)
+  804e0d:	eb 14                	jmp    804e23 <getuint+0xa9>
+  804e0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e13:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e17:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804e1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e1f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804e23:	48 8b 00             	mov    (%rax),%rax
+  804e26:	eb 47                	jmp    804e6f <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  804e28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e2c:	8b 00                	mov    (%rax),%eax
+  804e2e:	83 f8 2f             	cmp    $0x2f,%eax
+  804e31:	77 24                	ja     804e57 <getuint+0xdd>
+  804e33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e37:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804e3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e3f:	8b 00                	mov    (%rax),%eax
+  804e41:	89 c0                	mov    %eax,%eax
+  804e43:	48 01 d0             	add    %rdx,%rax
+  804e46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e4a:	8b 12                	mov    (%rdx),%edx
+  804e4c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804e4f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e53:	89 0a                	mov    %ecx,(%rdx)
+  804e55:	eb 14                	jmp    804e6b <getuint+0xf1>
+  804e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e5f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804e63:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e67:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804e6b:	8b 00                	mov    (%rax),%eax
+  804e6d:	89 c0                	mov    %eax,%eax
+}
+  804e6f:	c9                   	leave
+  804e70:	c3                   	ret
+
+0000000000804e71 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  804e71:	55                   	push   %rbp
+  804e72:	48 89 e5             	mov    %rsp,%rbp
+  804e75:	48 83 ec 10          	sub    $0x10,%rsp
+  804e79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e7d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  804e80:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  804e84:	7e 4b                	jle    804ed1 <getint+0x60>
+    return va_arg(*ap, long long);
+  804e86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e8a:	8b 00                	mov    (%rax),%eax
+  804e8c:	83 f8 2f             	cmp    $0x2f,%eax
+  804e8f:	77 24                	ja     804eb5 <getint+0x44>
+  804e91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e95:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e9d:	8b 00                	mov    (%rax),%eax
+  804e9f:	89 c0                	mov    %eax,%eax
+  804ea1:	48 01 d0             	add    %rdx,%rax
+  804ea4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ea8:	8b 12                	mov    (%rdx),%edx
+  804eaa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804ead:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804eb1:	89 0a                	mov    %ecx,(%rdx)
+  804eb3:	eb 14                	jmp    804ec9 <getint+0x58>
+  804eb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eb9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ebd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804ec1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ec5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804ec9:	48 8b 00             	mov    (%rax),%rax
+  804ecc:	e9 95 00 00 00       	jmp    804f66 <getint+0xf5>
+  else if (lflag)
+  804ed1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804ed5:	74 48                	je     804f1f <getint+0xae>
+    return va_arg(*ap, long);
+  804ed7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804edb:	8b 00                	mov    (%rax),%eax
+  804edd:	83 f8 2f             	cmp    $0x2f,%eax
+  804ee0:	77 24                	ja     804f06 <getint+0x95>
+  804ee2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ee6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eee:	8b 00                	mov    (%rax),%eax
+  804ef0:	89 c0                	mov    %eax,%eax
+  804ef2:	48 01 d0             	add    %rdx,%rax
+  804ef5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ef9:	8b 12                	mov    (%rdx),%edx
+  804efb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804efe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f02:	89 0a                	mov    %ecx,(%rdx)
+  804f04:	eb 14                	jmp    804f1a <getint+0xa9>
+  804f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f0a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f0e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804f12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f16:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804f1a:	48 8b 00             	mov    (%rax),%rax
+  804f1d:	eb 47                	jmp    804f66 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  804f1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f23:	8b 00                	mov    (%rax),%eax
+  804f25:	83 f8 2f             	cmp    $0x2f,%eax
+  804f28:	77 24                	ja     804f4e <getint+0xdd>
+  804f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f2e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f36:	8b 00                	mov    (%rax),%eax
+  804f38:	89 c0                	mov    %eax,%eax
+  804f3a:	48 01 d0             	add    %rdx,%rax
+  804f3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f41:	8b 12                	mov    (%rdx),%edx
+  804f43:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804f46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f4a:	89 0a                	mov    %ecx,(%rdx)
+  804f4c:	eb 14                	jmp    804f62 <getint+0xf1>
+  804f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f52:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f56:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804f5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f5e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804f62:	8b 00                	mov    (%rax),%eax
+  804f64:	48 98                	cltq
+}
+  804f66:	c9                   	leave
+  804f67:	c3                   	ret
+
+0000000000804f68 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  804f68:	55                   	push   %rbp
+  804f69:	48 89 e5             	mov    %rsp,%rbp
+  804f6c:	41 54                	push   %r12
+  804f6e:	53                   	push   %rbx
+  804f6f:	48 83 ec 60          	sub    $0x60,%rsp
+  804f73:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f77:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f7b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  804f7f:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  804f83:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  804f87:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804f8b:	48 8b 06             	mov    (%rsi),%rax
+  804f8e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804f92:	48 89 01             	mov    %rax,(%rcx)
+  804f95:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804f99:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804f9d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  804fa1:	eb 17                	jmp    804fba <vprintfmt+0x52>
+      if (ch == '\0')
+  804fa3:	85 db                	test   %ebx,%ebx
+  804fa5:	0f 84 bf 04 00 00    	je     80546a <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  804fab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804faf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804fb3:	48 89 c6             	mov    %rax,%rsi
+  804fb6:	89 df                	mov    %ebx,%edi
+  804fb8:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  804fba:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804fbe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804fc2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  804fc6:	0f b6 00             	movzbl (%rax),%eax
+  804fc9:	0f b6 d8             	movzbl %al,%ebx
+  804fcc:	83 fb 25             	cmp    $0x25,%ebx
+  804fcf:	75 d2                	jne    804fa3 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  804fd1:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  804fd5:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  804fdc:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  804fe3:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  804fea:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  804ff1:	eb 04                	jmp    804ff7 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  804ff3:	90                   	nop
+  804ff4:	eb 01                	jmp    804ff7 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  804ff6:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  804ff7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ffb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804fff:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  805003:	0f b6 00             	movzbl (%rax),%eax
+  805006:	0f b6 d8             	movzbl %al,%ebx
+  805009:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80500c:	83 f8 55             	cmp    $0x55,%eax
+  80500f:	0f 87 22 04 00 00    	ja     805437 <vprintfmt+0x4cf>
+  805015:	89 c0                	mov    %eax,%eax
+  805017:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80501e:	00 
+  80501f:	48 b8 78 5f 80 00 00 	movabs $0x805f78,%rax
+  805026:	00 00 00 
+  805029:	48 01 d0             	add    %rdx,%rax
+  80502c:	48 8b 00             	mov    (%rax),%rax
+  80502f:	ff e0                	jmp    *%rax
+        padc = '-';
+  805031:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  805035:	eb c0                	jmp    804ff7 <vprintfmt+0x8f>
+        padc = '0';
+  805037:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80503b:	eb ba                	jmp    804ff7 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80503d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  805044:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805047:	89 d0                	mov    %edx,%eax
+  805049:	c1 e0 02             	shl    $0x2,%eax
+  80504c:	01 d0                	add    %edx,%eax
+  80504e:	01 c0                	add    %eax,%eax
+  805050:	01 d8                	add    %ebx,%eax
+  805052:	83 e8 30             	sub    $0x30,%eax
+  805055:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  805058:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80505c:	0f b6 00             	movzbl (%rax),%eax
+  80505f:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  805062:	83 fb 2f             	cmp    $0x2f,%ebx
+  805065:	7e 60                	jle    8050c7 <vprintfmt+0x15f>
+  805067:	83 fb 39             	cmp    $0x39,%ebx
+  80506a:	7f 5b                	jg     8050c7 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80506c:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  805071:	eb d1                	jmp    805044 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  805073:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805076:	83 f8 2f             	cmp    $0x2f,%eax
+  805079:	77 17                	ja     805092 <vprintfmt+0x12a>
+  80507b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80507f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  805082:	89 d2                	mov    %edx,%edx
+  805084:	48 01 d0             	add    %rdx,%rax
+  805087:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80508a:	83 c2 08             	add    $0x8,%edx
+  80508d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  805090:	eb 0c                	jmp    80509e <vprintfmt+0x136>
+  805092:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805096:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80509a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80509e:	8b 00                	mov    (%rax),%eax
+  8050a0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8050a3:	eb 23                	jmp    8050c8 <vprintfmt+0x160>
+        if (width < 0)
+  8050a5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8050a9:	0f 89 44 ff ff ff    	jns    804ff3 <vprintfmt+0x8b>
+          width = 0;
+  8050af:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8050b6:	e9 38 ff ff ff       	jmp    804ff3 <vprintfmt+0x8b>
+        altflag = 1;
+  8050bb:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8050c2:	e9 30 ff ff ff       	jmp    804ff7 <vprintfmt+0x8f>
+        goto process_precision;
+  8050c7:	90                   	nop
+        if (width < 0)
+  8050c8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8050cc:	0f 89 24 ff ff ff    	jns    804ff6 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8050d2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8050d5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8050d8:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8050df:	e9 12 ff ff ff       	jmp    804ff6 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8050e4:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8050e8:	e9 0a ff ff ff       	jmp    804ff7 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8050ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8050f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8050f3:	77 17                	ja     80510c <vprintfmt+0x1a4>
+  8050f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050f9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8050fc:	89 d2                	mov    %edx,%edx
+  8050fe:	48 01 d0             	add    %rdx,%rax
+  805101:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  805104:	83 c2 08             	add    $0x8,%edx
+  805107:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80510a:	eb 0c                	jmp    805118 <vprintfmt+0x1b0>
+  80510c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805110:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805114:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805118:	8b 00                	mov    (%rax),%eax
+  80511a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80511e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  805122:	48 89 d6             	mov    %rdx,%rsi
+  805125:	89 c7                	mov    %eax,%edi
+  805127:	ff d1                	call   *%rcx
+        break;
+  805129:	e9 37 03 00 00       	jmp    805465 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80512e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805131:	83 f8 2f             	cmp    $0x2f,%eax
+  805134:	77 17                	ja     80514d <vprintfmt+0x1e5>
+  805136:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80513a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80513d:	89 d2                	mov    %edx,%edx
+  80513f:	48 01 d0             	add    %rdx,%rax
+  805142:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  805145:	83 c2 08             	add    $0x8,%edx
+  805148:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80514b:	eb 0c                	jmp    805159 <vprintfmt+0x1f1>
+  80514d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805151:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805155:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805159:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80515b:	85 db                	test   %ebx,%ebx
+  80515d:	79 02                	jns    805161 <vprintfmt+0x1f9>
+          err = -err;
+  80515f:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  805161:	83 fb 15             	cmp    $0x15,%ebx
+  805164:	7f 16                	jg     80517c <vprintfmt+0x214>
+  805166:	48 ba a0 5e 80 00 00 	movabs $0x805ea0,%rdx
+  80516d:	00 00 00 
+  805170:	48 63 c3             	movslq %ebx,%rax
+  805173:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  805177:	4d 85 e4             	test   %r12,%r12
+  80517a:	75 2e                	jne    8051aa <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80517c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  805180:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805184:	89 d9                	mov    %ebx,%ecx
+  805186:	48 ba 61 5f 80 00 00 	movabs $0x805f61,%rdx
+  80518d:	00 00 00 
+  805190:	48 89 c7             	mov    %rax,%rdi
+  805193:	b8 00 00 00 00       	mov    $0x0,%eax
+  805198:	49 b8 74 54 80 00 00 	movabs $0x805474,%r8
+  80519f:	00 00 00 
+  8051a2:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8051a5:	e9 bb 02 00 00       	jmp    805465 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8051aa:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8051ae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8051b2:	4c 89 e1             	mov    %r12,%rcx
+  8051b5:	48 ba 6a 5f 80 00 00 	movabs $0x805f6a,%rdx
+  8051bc:	00 00 00 
+  8051bf:	48 89 c7             	mov    %rax,%rdi
+  8051c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c7:	49 b8 74 54 80 00 00 	movabs $0x805474,%r8
+  8051ce:	00 00 00 
+  8051d1:	41 ff d0             	call   *%r8
+        break;
+  8051d4:	e9 8c 02 00 00       	jmp    805465 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8051d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8051dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8051df:	77 17                	ja     8051f8 <vprintfmt+0x290>
+  8051e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051e5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8051e8:	89 d2                	mov    %edx,%edx
+  8051ea:	48 01 d0             	add    %rdx,%rax
+  8051ed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8051f0:	83 c2 08             	add    $0x8,%edx
+  8051f3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8051f6:	eb 0c                	jmp    805204 <vprintfmt+0x29c>
+  8051f8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051fc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805200:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805204:	4c 8b 20             	mov    (%rax),%r12
+  805207:	4d 85 e4             	test   %r12,%r12
+  80520a:	75 0a                	jne    805216 <vprintfmt+0x2ae>
+          p = "(null)";
+  80520c:	49 bc 6d 5f 80 00 00 	movabs $0x805f6d,%r12
+  805213:	00 00 00 
+        if (width > 0 && padc != '-')
+  805216:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80521a:	7e 78                	jle    805294 <vprintfmt+0x32c>
+  80521c:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  805220:	74 72                	je     805294 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  805222:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805225:	48 98                	cltq
+  805227:	48 89 c6             	mov    %rax,%rsi
+  80522a:	4c 89 e7             	mov    %r12,%rdi
+  80522d:	48 b8 58 0a 80 00 00 	movabs $0x800a58,%rax
+  805234:	00 00 00 
+  805237:	ff d0                	call   *%rax
+  805239:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80523c:	eb 17                	jmp    805255 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80523e:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  805242:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  805246:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80524a:	48 89 d6             	mov    %rdx,%rsi
+  80524d:	89 c7                	mov    %eax,%edi
+  80524f:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  805251:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  805255:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805259:	7f e3                	jg     80523e <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80525b:	eb 37                	jmp    805294 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80525d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  805261:	74 1e                	je     805281 <vprintfmt+0x319>
+  805263:	83 fb 1f             	cmp    $0x1f,%ebx
+  805266:	7e 05                	jle    80526d <vprintfmt+0x305>
+  805268:	83 fb 7e             	cmp    $0x7e,%ebx
+  80526b:	7e 14                	jle    805281 <vprintfmt+0x319>
+            putch('?', putdat);
+  80526d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805271:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  805275:	48 89 c6             	mov    %rax,%rsi
+  805278:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80527d:	ff d2                	call   *%rdx
+  80527f:	eb 0f                	jmp    805290 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  805281:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805285:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  805289:	48 89 c6             	mov    %rax,%rsi
+  80528c:	89 df                	mov    %ebx,%edi
+  80528e:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  805290:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  805294:	4c 89 e0             	mov    %r12,%rax
+  805297:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80529b:	0f b6 00             	movzbl (%rax),%eax
+  80529e:	0f be d8             	movsbl %al,%ebx
+  8052a1:	85 db                	test   %ebx,%ebx
+  8052a3:	74 28                	je     8052cd <vprintfmt+0x365>
+  8052a5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8052a9:	78 b2                	js     80525d <vprintfmt+0x2f5>
+  8052ab:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8052af:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8052b3:	79 a8                	jns    80525d <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8052b5:	eb 16                	jmp    8052cd <vprintfmt+0x365>
+          putch(' ', putdat);
+  8052b7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8052bb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8052bf:	48 89 c6             	mov    %rax,%rsi
+  8052c2:	bf 20 00 00 00       	mov    $0x20,%edi
+  8052c7:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8052c9:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8052cd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8052d1:	7f e4                	jg     8052b7 <vprintfmt+0x34f>
+        break;
+  8052d3:	e9 8d 01 00 00       	jmp    805465 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8052d8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8052db:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8052df:	89 d6                	mov    %edx,%esi
+  8052e1:	48 89 c7             	mov    %rax,%rdi
+  8052e4:	48 b8 71 4e 80 00 00 	movabs $0x804e71,%rax
+  8052eb:	00 00 00 
+  8052ee:	ff d0                	call   *%rax
+  8052f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8052f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052f8:	48 85 c0             	test   %rax,%rax
+  8052fb:	79 1d                	jns    80531a <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8052fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805301:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  805305:	48 89 c6             	mov    %rax,%rsi
+  805308:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80530d:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80530f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805313:	48 f7 d8             	neg    %rax
+  805316:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80531a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  805321:	e9 d2 00 00 00       	jmp    8053f8 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  805326:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805329:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80532d:	89 d6                	mov    %edx,%esi
+  80532f:	48 89 c7             	mov    %rax,%rdi
+  805332:	48 b8 7a 4d 80 00 00 	movabs $0x804d7a,%rax
+  805339:	00 00 00 
+  80533c:	ff d0                	call   *%rax
+  80533e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  805342:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  805349:	e9 aa 00 00 00       	jmp    8053f8 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80534e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805351:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  805355:	89 d6                	mov    %edx,%esi
+  805357:	48 89 c7             	mov    %rax,%rdi
+  80535a:	48 b8 7a 4d 80 00 00 	movabs $0x804d7a,%rax
+  805361:	00 00 00 
+  805364:	ff d0                	call   *%rax
+  805366:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  80536a:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  805371:	e9 82 00 00 00       	jmp    8053f8 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  805376:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80537a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80537e:	48 89 c6             	mov    %rax,%rsi
+  805381:	bf 30 00 00 00       	mov    $0x30,%edi
+  805386:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  805388:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80538c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  805390:	48 89 c6             	mov    %rax,%rsi
+  805393:	bf 78 00 00 00       	mov    $0x78,%edi
+  805398:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  80539a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80539d:	83 f8 2f             	cmp    $0x2f,%eax
+  8053a0:	77 17                	ja     8053b9 <vprintfmt+0x451>
+  8053a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053a6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8053a9:	89 d2                	mov    %edx,%edx
+  8053ab:	48 01 d0             	add    %rdx,%rax
+  8053ae:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8053b1:	83 c2 08             	add    $0x8,%edx
+  8053b4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8053b7:	eb 0c                	jmp    8053c5 <vprintfmt+0x45d>
+  8053b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053bd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8053c1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8053c5:	48 8b 00             	mov    (%rax),%rax
+  8053c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8053cc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8053d3:	eb 23                	jmp    8053f8 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8053d5:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8053d8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8053dc:	89 d6                	mov    %edx,%esi
+  8053de:	48 89 c7             	mov    %rax,%rdi
+  8053e1:	48 b8 7a 4d 80 00 00 	movabs $0x804d7a,%rax
+  8053e8:	00 00 00 
+  8053eb:	ff d0                	call   *%rax
+  8053ed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8053f1:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8053f8:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8053fd:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  805400:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  805403:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805407:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80540b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80540f:	45 89 c1             	mov    %r8d,%r9d
+  805412:	41 89 f8             	mov    %edi,%r8d
+  805415:	48 89 c7             	mov    %rax,%rdi
+  805418:	48 b8 c2 4c 80 00 00 	movabs $0x804cc2,%rax
+  80541f:	00 00 00 
+  805422:	ff d0                	call   *%rax
+        break;
+  805424:	eb 3f                	jmp    805465 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  805426:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80542a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80542e:	48 89 c6             	mov    %rax,%rsi
+  805431:	89 df                	mov    %ebx,%edi
+  805433:	ff d2                	call   *%rdx
+        break;
+  805435:	eb 2e                	jmp    805465 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  805437:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80543b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80543f:	48 89 c6             	mov    %rax,%rsi
+  805442:	bf 25 00 00 00       	mov    $0x25,%edi
+  805447:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  805449:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80544e:	eb 05                	jmp    805455 <vprintfmt+0x4ed>
+  805450:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  805455:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805459:	48 83 e8 01          	sub    $0x1,%rax
+  80545d:	0f b6 00             	movzbl (%rax),%eax
+  805460:	3c 25                	cmp    $0x25,%al
+  805462:	75 ec                	jne    805450 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  805464:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  805465:	e9 50 fb ff ff       	jmp    804fba <vprintfmt+0x52>
+        return;
+  80546a:	90                   	nop
+    }
+  }
+}
+  80546b:	48 83 c4 60          	add    $0x60,%rsp
+  80546f:	5b                   	pop    %rbx
+  805470:	41 5c                	pop    %r12
+  805472:	5d                   	pop    %rbp
+  805473:	c3                   	ret
+
+0000000000805474 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  805474:	55                   	push   %rbp
+  805475:	48 89 e5             	mov    %rsp,%rbp
+  805478:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80547f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  805486:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80548d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  805494:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80549b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8054a2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8054a9:	84 c0                	test   %al,%al
+  8054ab:	74 20                	je     8054cd <printfmt+0x59>
+  8054ad:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8054b1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8054b5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8054b9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8054bd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8054c1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8054c5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8054c9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8054cd:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8054d4:	00 00 00 
+  8054d7:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8054de:	00 00 00 
+  8054e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8054e5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8054ec:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8054f3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  8054fa:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  805501:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  805508:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80550f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  805516:	48 89 c7             	mov    %rax,%rdi
+  805519:	48 b8 68 4f 80 00 00 	movabs $0x804f68,%rax
+  805520:	00 00 00 
+  805523:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  805525:	90                   	nop
+  805526:	c9                   	leave
+  805527:	c3                   	ret
+
+0000000000805528 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  805528:	55                   	push   %rbp
+  805529:	48 89 e5             	mov    %rsp,%rbp
+  80552c:	48 83 ec 10          	sub    $0x10,%rsp
+  805530:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805533:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  805537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80553b:	8b 40 10             	mov    0x10(%rax),%eax
+  80553e:	8d 50 01             	lea    0x1(%rax),%edx
+  805541:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805545:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  805548:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80554c:	48 8b 10             	mov    (%rax),%rdx
+  80554f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805553:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805557:	48 39 c2             	cmp    %rax,%rdx
+  80555a:	73 17                	jae    805573 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  80555c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805560:	48 8b 00             	mov    (%rax),%rax
+  805563:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805567:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80556b:	48 89 0a             	mov    %rcx,(%rdx)
+  80556e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805571:	88 10                	mov    %dl,(%rax)
+}
+  805573:	90                   	nop
+  805574:	c9                   	leave
+  805575:	c3                   	ret
+
+0000000000805576 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  805576:	55                   	push   %rbp
+  805577:	48 89 e5             	mov    %rsp,%rbp
+  80557a:	48 83 ec 40          	sub    $0x40,%rsp
+  80557e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805582:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805585:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805589:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  80558d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805591:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805595:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805598:	48 98                	cltq
+  80559a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80559e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055a2:	48 01 d0             	add    %rdx,%rax
+  8055a5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8055a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8055b0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8055b5:	74 06                	je     8055bd <vsnprintf+0x47>
+  8055b7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8055bb:	7f 07                	jg     8055c4 <vsnprintf+0x4e>
+    return -E_INVAL;
+  8055bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8055c2:	eb 32                	jmp    8055f6 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8055c4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8055c8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8055cc:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8055d0:	48 89 c6             	mov    %rax,%rsi
+  8055d3:	48 b8 28 55 80 00 00 	movabs $0x805528,%rax
+  8055da:	00 00 00 
+  8055dd:	48 89 c7             	mov    %rax,%rdi
+  8055e0:	48 b8 68 4f 80 00 00 	movabs $0x804f68,%rax
+  8055e7:	00 00 00 
+  8055ea:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8055ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055f0:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8055f3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8055f6:	c9                   	leave
+  8055f7:	c3                   	ret
+
+00000000008055f8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8055f8:	55                   	push   %rbp
+  8055f9:	48 89 e5             	mov    %rsp,%rbp
+  8055fc:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  805603:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80560a:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  805610:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  805617:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80561e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  805625:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80562c:	84 c0                	test   %al,%al
+  80562e:	74 20                	je     805650 <snprintf+0x58>
+  805630:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  805634:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  805638:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80563c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  805640:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  805644:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  805648:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80564c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  805650:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  805657:	00 00 00 
+  80565a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  805661:	00 00 00 
+  805664:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805668:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80566f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805676:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80567d:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  805684:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80568b:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  805691:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  805698:	48 89 c7             	mov    %rax,%rdi
+  80569b:	48 b8 76 55 80 00 00 	movabs $0x805576,%rax
+  8056a2:	00 00 00 
+  8056a5:	ff d0                	call   *%rax
+  8056a7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8056ad:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8056b3:	c9                   	leave
+  8056b4:	c3                   	ret
+
+00000000008056b5 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8056b5:	55                   	push   %rbp
+  8056b6:	48 89 e5             	mov    %rsp,%rbp
+  8056b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8056bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8056c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8056c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8056c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8056cd:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8056d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056d5:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8056dc:	48 89 c7             	mov    %rax,%rdi
+  8056df:	48 b8 ed 56 80 00 00 	movabs $0x8056ed,%rax
+  8056e6:	00 00 00 
+  8056e9:	ff d0                	call   *%rax
+}
+  8056eb:	c9                   	leave
+  8056ec:	c3                   	ret
+
+00000000008056ed <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8056ed:	55                   	push   %rbp
+  8056ee:	48 89 e5             	mov    %rsp,%rbp
+  8056f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8056f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805701:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805705:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80570a:	75 0e                	jne    80571a <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80570c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805713:	00 00 00 
+  805716:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80571a:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80571f:	75 18                	jne    805739 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805721:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805725:	48 89 c7             	mov    %rax,%rdi
+  805728:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  80572f:	00 00 00 
+  805732:	ff d0                	call   *%rax
+  805734:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805737:	eb 1d                	jmp    805756 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805739:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80573d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805741:	48 89 d6             	mov    %rdx,%rsi
+  805744:	48 89 c7             	mov    %rax,%rdi
+  805747:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  80574e:	00 00 00 
+  805751:	ff d0                	call   *%rax
+  805753:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805756:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80575a:	79 2a                	jns    805786 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  80575c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805761:	74 0a                	je     80576d <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805767:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  80576d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805772:	74 0a                	je     80577e <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805774:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805778:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  80577e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805781:	e9 aa 00 00 00       	jmp    805830 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805786:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80578b:	74 36                	je     8057c3 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  80578d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805794:	00 00 00 
+  805797:	8b 40 04             	mov    0x4(%rax),%eax
+  80579a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80579f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8057a6:	00 00 00 
+  8057a9:	48 98                	cltq
+  8057ab:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057b2:	48 01 d0             	add    %rdx,%rax
+  8057b5:	48 05 24 01 00 00    	add    $0x124,%rax
+  8057bb:	8b 10                	mov    (%rax),%edx
+  8057bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057c1:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8057c3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8057c8:	74 36                	je     805800 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8057ca:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057d1:	00 00 00 
+  8057d4:	8b 40 04             	mov    0x4(%rax),%eax
+  8057d7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8057dc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8057e3:	00 00 00 
+  8057e6:	48 98                	cltq
+  8057e8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057ef:	48 01 d0             	add    %rdx,%rax
+  8057f2:	48 05 28 01 00 00    	add    $0x128,%rax
+  8057f8:	8b 10                	mov    (%rax),%edx
+  8057fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057fe:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805800:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805807:	00 00 00 
+  80580a:	8b 40 04             	mov    0x4(%rax),%eax
+  80580d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805812:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805819:	00 00 00 
+  80581c:	48 98                	cltq
+  80581e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805825:	48 01 d0             	add    %rdx,%rax
+  805828:	48 05 20 01 00 00    	add    $0x120,%rax
+  80582e:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805830:	c9                   	leave
+  805831:	c3                   	ret
+
+0000000000805832 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805832:	55                   	push   %rbp
+  805833:	48 89 e5             	mov    %rsp,%rbp
+  805836:	48 83 ec 30          	sub    $0x30,%rsp
+  80583a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80583d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805840:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805844:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805847:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80584c:	75 5e                	jne    8058ac <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  80584e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805855:	00 00 00 
+  805858:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80585c:	eb 4e                	jmp    8058ac <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  80585e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805862:	79 3c                	jns    8058a0 <ipc_send+0x6e>
+  805864:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805868:	74 36                	je     8058a0 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80586a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80586d:	89 c1                	mov    %eax,%ecx
+  80586f:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  805876:	00 00 00 
+  805879:	48 89 c2             	mov    %rax,%rdx
+  80587c:	be 54 00 00 00       	mov    $0x54,%esi
+  805881:	48 b8 4e 62 80 00 00 	movabs $0x80624e,%rax
+  805888:	00 00 00 
+  80588b:	48 89 c7             	mov    %rax,%rdi
+  80588e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805893:	49 b8 ef 49 80 00 00 	movabs $0x8049ef,%r8
+  80589a:	00 00 00 
+  80589d:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8058a0:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  8058a7:	00 00 00 
+  8058aa:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8058ac:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8058af:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8058b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8058b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058b9:	89 c7                	mov    %eax,%edi
+  8058bb:	48 b8 4d 1a 80 00 00 	movabs $0x801a4d,%rax
+  8058c2:	00 00 00 
+  8058c5:	ff d0                	call   *%rax
+  8058c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058ce:	75 8e                	jne    80585e <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8058d0:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  8058d7:	00 00 00 
+  8058da:	ff d0                	call   *%rax
+}
+  8058dc:	90                   	nop
+  8058dd:	c9                   	leave
+  8058de:	c3                   	ret
+
+00000000008058df <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8058df:	55                   	push   %rbp
+  8058e0:	48 89 e5             	mov    %rsp,%rbp
+  8058e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8058e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8058ea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8058f1:	eb 4d                	jmp    805940 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8058f3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8058fa:	00 00 00 
+  8058fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805900:	48 98                	cltq
+  805902:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805909:	48 01 d0             	add    %rdx,%rax
+  80590c:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805912:	8b 00                	mov    (%rax),%eax
+  805914:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805917:	75 23                	jne    80593c <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805919:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805920:	00 00 00 
+  805923:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805926:	48 98                	cltq
+  805928:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80592f:	48 01 d0             	add    %rdx,%rax
+  805932:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805938:	8b 00                	mov    (%rax),%eax
+  80593a:	eb 12                	jmp    80594e <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80593c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805940:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805947:	7e aa                	jle    8058f3 <ipc_find_env+0x14>
+  return 0;
+  805949:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80594e:	c9                   	leave
+  80594f:	c3                   	ret
+
+0000000000805950 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805950:	55                   	push   %rbp
+  805951:	48 89 e5             	mov    %rsp,%rbp
+  805954:	48 83 ec 18          	sub    $0x18,%rsp
+  805958:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80595c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805960:	48 c1 e8 27          	shr    $0x27,%rax
+  805964:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805969:	48 89 c2             	mov    %rax,%rdx
+  80596c:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805973:	01 00 00 
+  805976:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80597a:	83 e0 01             	and    $0x1,%eax
+  80597d:	48 85 c0             	test   %rax,%rax
+  805980:	74 63                	je     8059e5 <pageref+0x95>
+  805982:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805986:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80598a:	48 89 c2             	mov    %rax,%rdx
+  80598d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805994:	01 00 00 
+  805997:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80599b:	83 e0 01             	and    $0x1,%eax
+  80599e:	48 85 c0             	test   %rax,%rax
+  8059a1:	74 42                	je     8059e5 <pageref+0x95>
+  8059a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059a7:	48 c1 e8 15          	shr    $0x15,%rax
+  8059ab:	48 89 c2             	mov    %rax,%rdx
+  8059ae:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8059b5:	01 00 00 
+  8059b8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059bc:	83 e0 01             	and    $0x1,%eax
+  8059bf:	48 85 c0             	test   %rax,%rax
+  8059c2:	74 21                	je     8059e5 <pageref+0x95>
+  8059c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059c8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8059cc:	48 89 c2             	mov    %rax,%rdx
+  8059cf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8059d6:	01 00 00 
+  8059d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059dd:	83 e0 01             	and    $0x1,%eax
+  8059e0:	48 85 c0             	test   %rax,%rax
+  8059e3:	75 07                	jne    8059ec <pageref+0x9c>
+    return 0;
+  8059e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ea:	eb 53                	jmp    805a3f <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8059ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059f0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8059f4:	48 89 c2             	mov    %rax,%rdx
+  8059f7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8059fe:	01 00 00 
+  805a01:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a0d:	83 e0 01             	and    $0x1,%eax
+  805a10:	48 85 c0             	test   %rax,%rax
+  805a13:	75 07                	jne    805a1c <pageref+0xcc>
+    return 0;
+  805a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a1a:	eb 23                	jmp    805a3f <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a20:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a24:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805a2b:	00 00 00 
+  805a2e:	48 c1 e0 04          	shl    $0x4,%rax
+  805a32:	48 01 d0             	add    %rdx,%rax
+  805a35:	48 83 c0 08          	add    $0x8,%rax
+  805a39:	0f b7 00             	movzwl (%rax),%eax
+  805a3c:	0f b7 c0             	movzwl %ax,%eax
+}
+  805a3f:	c9                   	leave
+  805a40:	c3                   	ret
+  805a41:	0f 1f 00             	nopl   (%rax)
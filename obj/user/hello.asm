@@ -0,0 +1,8065 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 86 00 00 00       	call   8000b2 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cprintf("hello, world\n");
+  800041:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c7             	mov    %rax,%rdi
+  80004e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800053:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  80005a:	00 00 00 
+  80005d:	ff d2                	call   *%rdx
+  cprintf("i am environment %08x\n", thisenv->env_id);
+  80005f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800066:	00 00 00 
+  800069:	8b 40 04             	mov    0x4(%rax),%eax
+  80006c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800071:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800078:	00 00 00 
+  80007b:	48 98                	cltq
+  80007d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800084:	48 01 d0             	add    %rdx,%rax
+  800087:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80008d:	8b 00                	mov    (%rax),%eax
+  80008f:	89 c6                	mov    %eax,%esi
+  800091:	48 b8 2e 50 80 00 00 	movabs $0x80502e,%rax
+  800098:	00 00 00 
+  80009b:	48 89 c7             	mov    %rax,%rdi
+  80009e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a3:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  8000aa:	00 00 00 
+  8000ad:	ff d2                	call   *%rdx
+}
+  8000af:	90                   	nop
+  8000b0:	c9                   	leave
+  8000b1:	c3                   	ret
+
+00000000008000b2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000b2:	55                   	push   %rbp
+  8000b3:	48 89 e5             	mov    %rsp,%rbp
+  8000b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8000ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8000c1:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000c8:	00 00 00 
+  8000cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000cf:	eb 13                	jmp    8000e4 <libmain+0x32>
+    (*ctor)();
+  8000d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000d5:	48 8b 10             	mov    (%rax),%rdx
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	ff d2                	call   *%rdx
+    ctor++;
+  8000df:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000e4:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000eb:	00 00 00 
+  8000ee:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000f2:	72 dd                	jb     8000d1 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000f8:	7e 14                	jle    80010e <libmain+0x5c>
+    binaryname = argv[0];
+  8000fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000fe:	48 8b 00             	mov    (%rax),%rax
+  800101:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800108:	00 00 00 
+  80010b:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80010e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800112:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800115:	48 89 d6             	mov    %rdx,%rsi
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800126:	48 b8 35 01 80 00 00 	movabs $0x800135,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+#endif
+}
+  800132:	90                   	nop
+  800133:	c9                   	leave
+  800134:	c3                   	ret
+
+0000000000800135 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800135:	55                   	push   %rbp
+  800136:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800139:	48 b8 b3 2a 80 00 00 	movabs $0x802ab3,%rax
+  800140:	00 00 00 
+  800143:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800145:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014a:	48 b8 94 1e 80 00 00 	movabs $0x801e94,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+}
+  800156:	90                   	nop
+  800157:	5d                   	pop    %rbp
+  800158:	c3                   	ret
+
+0000000000800159 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800159:	55                   	push   %rbp
+  80015a:	48 89 e5             	mov    %rsp,%rbp
+  80015d:	48 83 ec 10          	sub    $0x10,%rsp
+  800161:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800164:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80016c:	8b 00                	mov    (%rax),%eax
+  80016e:	8d 48 01             	lea    0x1(%rax),%ecx
+  800171:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800175:	89 0a                	mov    %ecx,(%rdx)
+  800177:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80017a:	89 d1                	mov    %edx,%ecx
+  80017c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800180:	48 98                	cltq
+  800182:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800186:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80018a:	8b 00                	mov    (%rax),%eax
+  80018c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800191:	75 2c                	jne    8001bf <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800193:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800197:	8b 00                	mov    (%rax),%eax
+  800199:	48 98                	cltq
+  80019b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80019f:	48 83 c2 08          	add    $0x8,%rdx
+  8001a3:	48 89 c6             	mov    %rax,%rsi
+  8001a6:	48 89 d7             	mov    %rdx,%rdi
+  8001a9:	48 b8 c5 1d 80 00 00 	movabs $0x801dc5,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+    b->idx = 0;
+  8001b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001b9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8001bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001c3:	8b 40 04             	mov    0x4(%rax),%eax
+  8001c6:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001cd:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8001d0:	90                   	nop
+  8001d1:	c9                   	leave
+  8001d2:	c3                   	ret
+
+00000000008001d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001d3:	55                   	push   %rbp
+  8001d4:	48 89 e5             	mov    %rsp,%rbp
+  8001d7:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8001de:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8001e5:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001ec:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001f3:	00 00 00 
+  b.cnt = 0;
+  8001f6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001fd:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800200:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800207:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80020e:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800215:	48 89 c6             	mov    %rax,%rsi
+  800218:	48 b8 59 01 80 00 00 	movabs $0x800159,%rax
+  80021f:	00 00 00 
+  800222:	48 89 c7             	mov    %rax,%rdi
+  800225:	48 b8 b8 05 80 00 00 	movabs $0x8005b8,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800231:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800237:	48 98                	cltq
+  800239:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800240:	48 83 c2 08          	add    $0x8,%rdx
+  800244:	48 89 c6             	mov    %rax,%rsi
+  800247:	48 89 d7             	mov    %rdx,%rdi
+  80024a:	48 b8 c5 1d 80 00 00 	movabs $0x801dc5,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800256:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+000000000080025e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800269:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800270:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800277:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80027e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800285:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80028c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800293:	84 c0                	test   %al,%al
+  800295:	74 20                	je     8002b7 <cprintf+0x59>
+  800297:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80029b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80029f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8002a3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8002a7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8002ab:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8002af:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8002b3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002b7:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8002be:	00 00 00 
+  8002c1:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8002c8:	00 00 00 
+  8002cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002cf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8002d6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8002dd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8002e4:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002eb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002f2:	48 89 d6             	mov    %rdx,%rsi
+  8002f5:	48 89 c7             	mov    %rax,%rdi
+  8002f8:	48 b8 d3 01 80 00 00 	movabs $0x8001d3,%rax
+  8002ff:	00 00 00 
+  800302:	ff d0                	call   *%rax
+  800304:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80030a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+0000000000800312 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800312:	55                   	push   %rbp
+  800313:	48 89 e5             	mov    %rsp,%rbp
+  800316:	48 83 ec 30          	sub    $0x30,%rsp
+  80031a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80031e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800322:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800326:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800329:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80032d:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800331:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800334:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800338:	72 54                	jb     80038e <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80033a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80033d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800340:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800347:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034c:	48 f7 f6             	div    %rsi
+  80034f:	49 89 c2             	mov    %rax,%r10
+  800352:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800355:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800358:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80035c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800360:	41 89 c9             	mov    %ecx,%r9d
+  800363:	41 89 f8             	mov    %edi,%r8d
+  800366:	89 d1                	mov    %edx,%ecx
+  800368:	4c 89 d2             	mov    %r10,%rdx
+  80036b:	48 89 c7             	mov    %rax,%rdi
+  80036e:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+  80037a:	eb 1c                	jmp    800398 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80037c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800380:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800383:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800387:	48 89 d6             	mov    %rdx,%rsi
+  80038a:	89 c7                	mov    %eax,%edi
+  80038c:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80038e:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800392:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800396:	7f e4                	jg     80037c <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800398:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80039b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80039f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a4:	48 f7 f1             	div    %rcx
+  8003a7:	48 b8 90 52 80 00 00 	movabs $0x805290,%rax
+  8003ae:	00 00 00 
+  8003b1:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8003b5:	0f be c0             	movsbl %al,%eax
+  8003b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003bc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8003c0:	48 89 d6             	mov    %rdx,%rsi
+  8003c3:	89 c7                	mov    %eax,%edi
+  8003c5:	ff d1                	call   *%rcx
+}
+  8003c7:	90                   	nop
+  8003c8:	c9                   	leave
+  8003c9:	c3                   	ret
+
+00000000008003ca <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8003ca:	55                   	push   %rbp
+  8003cb:	48 89 e5             	mov    %rsp,%rbp
+  8003ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8003d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003d6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8003d9:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8003dd:	7e 4b                	jle    80042a <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8003df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003e3:	8b 00                	mov    (%rax),%eax
+  8003e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e8:	77 24                	ja     80040e <getuint+0x44>
+  8003ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003ee:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f6:	8b 00                	mov    (%rax),%eax
+  8003f8:	89 c0                	mov    %eax,%eax
+  8003fa:	48 01 d0             	add    %rdx,%rax
+  8003fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800401:	8b 12                	mov    (%rdx),%edx
+  800403:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800406:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80040a:	89 0a                	mov    %ecx,(%rdx)
+  80040c:	eb 14                	jmp    800422 <getuint+0x58>
+  80040e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800412:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800416:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80041a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80041e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800422:	48 8b 00             	mov    (%rax),%rax
+  800425:	e9 95 00 00 00       	jmp    8004bf <getuint+0xf5>
+  else if (lflag)
+  80042a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80042e:	74 48                	je     800478 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800430:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800434:	8b 00                	mov    (%rax),%eax
+  800436:	83 f8 2f             	cmp    $0x2f,%eax
+  800439:	77 24                	ja     80045f <getuint+0x95>
+  80043b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80043f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800447:	8b 00                	mov    (%rax),%eax
+  800449:	89 c0                	mov    %eax,%eax
+  80044b:	48 01 d0             	add    %rdx,%rax
+  80044e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800452:	8b 12                	mov    (%rdx),%edx
+  800454:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800457:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80045b:	89 0a                	mov    %ecx,(%rdx)
+  80045d:	eb 14                	jmp    800473 <getuint+0xa9>
+  80045f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800463:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800467:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80046b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80046f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800473:	48 8b 00             	mov    (%rax),%rax
+  800476:	eb 47                	jmp    8004bf <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800478:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80047c:	8b 00                	mov    (%rax),%eax
+  80047e:	83 f8 2f             	cmp    $0x2f,%eax
+  800481:	77 24                	ja     8004a7 <getuint+0xdd>
+  800483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800487:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80048b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80048f:	8b 00                	mov    (%rax),%eax
+  800491:	89 c0                	mov    %eax,%eax
+  800493:	48 01 d0             	add    %rdx,%rax
+  800496:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80049a:	8b 12                	mov    (%rdx),%edx
+  80049c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80049f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004a3:	89 0a                	mov    %ecx,(%rdx)
+  8004a5:	eb 14                	jmp    8004bb <getuint+0xf1>
+  8004a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004af:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004bb:	8b 00                	mov    (%rax),%eax
+  8004bd:	89 c0                	mov    %eax,%eax
+}
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+
+00000000008004c1 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8004c1:	55                   	push   %rbp
+  8004c2:	48 89 e5             	mov    %rsp,%rbp
+  8004c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8004c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004cd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8004d0:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8004d4:	7e 4b                	jle    800521 <getint+0x60>
+    return va_arg(*ap, long long);
+  8004d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004da:	8b 00                	mov    (%rax),%eax
+  8004dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8004df:	77 24                	ja     800505 <getint+0x44>
+  8004e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ed:	8b 00                	mov    (%rax),%eax
+  8004ef:	89 c0                	mov    %eax,%eax
+  8004f1:	48 01 d0             	add    %rdx,%rax
+  8004f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004f8:	8b 12                	mov    (%rdx),%edx
+  8004fa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800501:	89 0a                	mov    %ecx,(%rdx)
+  800503:	eb 14                	jmp    800519 <getint+0x58>
+  800505:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800509:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80050d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800511:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800515:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800519:	48 8b 00             	mov    (%rax),%rax
+  80051c:	e9 95 00 00 00       	jmp    8005b6 <getint+0xf5>
+  else if (lflag)
+  800521:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800525:	74 48                	je     80056f <getint+0xae>
+    return va_arg(*ap, long);
+  800527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80052b:	8b 00                	mov    (%rax),%eax
+  80052d:	83 f8 2f             	cmp    $0x2f,%eax
+  800530:	77 24                	ja     800556 <getint+0x95>
+  800532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800536:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80053a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053e:	8b 00                	mov    (%rax),%eax
+  800540:	89 c0                	mov    %eax,%eax
+  800542:	48 01 d0             	add    %rdx,%rax
+  800545:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800549:	8b 12                	mov    (%rdx),%edx
+  80054b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80054e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800552:	89 0a                	mov    %ecx,(%rdx)
+  800554:	eb 14                	jmp    80056a <getint+0xa9>
+  800556:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80055a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80055e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800566:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80056a:	48 8b 00             	mov    (%rax),%rax
+  80056d:	eb 47                	jmp    8005b6 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80056f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800573:	8b 00                	mov    (%rax),%eax
+  800575:	83 f8 2f             	cmp    $0x2f,%eax
+  800578:	77 24                	ja     80059e <getint+0xdd>
+  80057a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80057e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800586:	8b 00                	mov    (%rax),%eax
+  800588:	89 c0                	mov    %eax,%eax
+  80058a:	48 01 d0             	add    %rdx,%rax
+  80058d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800591:	8b 12                	mov    (%rdx),%edx
+  800593:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800596:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80059a:	89 0a                	mov    %ecx,(%rdx)
+  80059c:	eb 14                	jmp    8005b2 <getint+0xf1>
+  80059e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005a6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005ae:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005b2:	8b 00                	mov    (%rax),%eax
+  8005b4:	48 98                	cltq
+}
+  8005b6:	c9                   	leave
+  8005b7:	c3                   	ret
+
+00000000008005b8 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8005b8:	55                   	push   %rbp
+  8005b9:	48 89 e5             	mov    %rsp,%rbp
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 60          	sub    $0x60,%rsp
+  8005c3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8005c7:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8005cb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005cf:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8005d3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d7:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8005db:	48 8b 06             	mov    (%rsi),%rax
+  8005de:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005e2:	48 89 01             	mov    %rax,(%rcx)
+  8005e5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005e9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005ed:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005f1:	eb 17                	jmp    80060a <vprintfmt+0x52>
+      if (ch == '\0')
+  8005f3:	85 db                	test   %ebx,%ebx
+  8005f5:	0f 84 bf 04 00 00    	je     800aba <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005ff:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800603:	48 89 c6             	mov    %rax,%rsi
+  800606:	89 df                	mov    %ebx,%edi
+  800608:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80060a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80060e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800612:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800616:	0f b6 00             	movzbl (%rax),%eax
+  800619:	0f b6 d8             	movzbl %al,%ebx
+  80061c:	83 fb 25             	cmp    $0x25,%ebx
+  80061f:	75 d2                	jne    8005f3 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800621:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800625:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80062c:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800633:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80063a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800641:	eb 04                	jmp    800647 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800643:	90                   	nop
+  800644:	eb 01                	jmp    800647 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800646:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800647:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80064b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80064f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800653:	0f b6 00             	movzbl (%rax),%eax
+  800656:	0f b6 d8             	movzbl %al,%ebx
+  800659:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80065c:	83 f8 55             	cmp    $0x55,%eax
+  80065f:	0f 87 22 04 00 00    	ja     800a87 <vprintfmt+0x4cf>
+  800665:	89 c0                	mov    %eax,%eax
+  800667:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80066e:	00 
+  80066f:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  800676:	00 00 00 
+  800679:	48 01 d0             	add    %rdx,%rax
+  80067c:	48 8b 00             	mov    (%rax),%rax
+  80067f:	ff e0                	jmp    *%rax
+        padc = '-';
+  800681:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800685:	eb c0                	jmp    800647 <vprintfmt+0x8f>
+        padc = '0';
+  800687:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80068b:	eb ba                	jmp    800647 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80068d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800694:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800697:	89 d0                	mov    %edx,%eax
+  800699:	c1 e0 02             	shl    $0x2,%eax
+  80069c:	01 d0                	add    %edx,%eax
+  80069e:	01 c0                	add    %eax,%eax
+  8006a0:	01 d8                	add    %ebx,%eax
+  8006a2:	83 e8 30             	sub    $0x30,%eax
+  8006a5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8006a8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006ac:	0f b6 00             	movzbl (%rax),%eax
+  8006af:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8006b2:	83 fb 2f             	cmp    $0x2f,%ebx
+  8006b5:	7e 60                	jle    800717 <vprintfmt+0x15f>
+  8006b7:	83 fb 39             	cmp    $0x39,%ebx
+  8006ba:	7f 5b                	jg     800717 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8006bc:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8006c1:	eb d1                	jmp    800694 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8006c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c9:	77 17                	ja     8006e2 <vprintfmt+0x12a>
+  8006cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006cf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8006d2:	89 d2                	mov    %edx,%edx
+  8006d4:	48 01 d0             	add    %rdx,%rax
+  8006d7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8006da:	83 c2 08             	add    $0x8,%edx
+  8006dd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8006e0:	eb 0c                	jmp    8006ee <vprintfmt+0x136>
+  8006e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8006e6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006ea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006ee:	8b 00                	mov    (%rax),%eax
+  8006f0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006f3:	eb 23                	jmp    800718 <vprintfmt+0x160>
+        if (width < 0)
+  8006f5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006f9:	0f 89 44 ff ff ff    	jns    800643 <vprintfmt+0x8b>
+          width = 0;
+  8006ff:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800706:	e9 38 ff ff ff       	jmp    800643 <vprintfmt+0x8b>
+        altflag = 1;
+  80070b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800712:	e9 30 ff ff ff       	jmp    800647 <vprintfmt+0x8f>
+        goto process_precision;
+  800717:	90                   	nop
+        if (width < 0)
+  800718:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80071c:	0f 89 24 ff ff ff    	jns    800646 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800722:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800725:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800728:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80072f:	e9 12 ff ff ff       	jmp    800646 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800734:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800738:	e9 0a ff ff ff       	jmp    800647 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80073d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800740:	83 f8 2f             	cmp    $0x2f,%eax
+  800743:	77 17                	ja     80075c <vprintfmt+0x1a4>
+  800745:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800749:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80074c:	89 d2                	mov    %edx,%edx
+  80074e:	48 01 d0             	add    %rdx,%rax
+  800751:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800754:	83 c2 08             	add    $0x8,%edx
+  800757:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80075a:	eb 0c                	jmp    800768 <vprintfmt+0x1b0>
+  80075c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800760:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800764:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800768:	8b 00                	mov    (%rax),%eax
+  80076a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80076e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800772:	48 89 d6             	mov    %rdx,%rsi
+  800775:	89 c7                	mov    %eax,%edi
+  800777:	ff d1                	call   *%rcx
+        break;
+  800779:	e9 37 03 00 00       	jmp    800ab5 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80077e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800781:	83 f8 2f             	cmp    $0x2f,%eax
+  800784:	77 17                	ja     80079d <vprintfmt+0x1e5>
+  800786:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80078a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80078d:	89 d2                	mov    %edx,%edx
+  80078f:	48 01 d0             	add    %rdx,%rax
+  800792:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800795:	83 c2 08             	add    $0x8,%edx
+  800798:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80079b:	eb 0c                	jmp    8007a9 <vprintfmt+0x1f1>
+  80079d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007a1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007a5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007a9:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8007ab:	85 db                	test   %ebx,%ebx
+  8007ad:	79 02                	jns    8007b1 <vprintfmt+0x1f9>
+          err = -err;
+  8007af:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007b1:	83 fb 15             	cmp    $0x15,%ebx
+  8007b4:	7f 16                	jg     8007cc <vprintfmt+0x214>
+  8007b6:	48 ba e0 51 80 00 00 	movabs $0x8051e0,%rdx
+  8007bd:	00 00 00 
+  8007c0:	48 63 c3             	movslq %ebx,%rax
+  8007c3:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8007c7:	4d 85 e4             	test   %r12,%r12
+  8007ca:	75 2e                	jne    8007fa <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8007cc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007d4:	89 d9                	mov    %ebx,%ecx
+  8007d6:	48 ba a1 52 80 00 00 	movabs $0x8052a1,%rdx
+  8007dd:	00 00 00 
+  8007e0:	48 89 c7             	mov    %rax,%rdi
+  8007e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e8:	49 b8 c4 0a 80 00 00 	movabs $0x800ac4,%r8
+  8007ef:	00 00 00 
+  8007f2:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007f5:	e9 bb 02 00 00       	jmp    800ab5 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007fa:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800802:	4c 89 e1             	mov    %r12,%rcx
+  800805:	48 ba aa 52 80 00 00 	movabs $0x8052aa,%rdx
+  80080c:	00 00 00 
+  80080f:	48 89 c7             	mov    %rax,%rdi
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	49 b8 c4 0a 80 00 00 	movabs $0x800ac4,%r8
+  80081e:	00 00 00 
+  800821:	41 ff d0             	call   *%r8
+        break;
+  800824:	e9 8c 02 00 00       	jmp    800ab5 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800829:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082c:	83 f8 2f             	cmp    $0x2f,%eax
+  80082f:	77 17                	ja     800848 <vprintfmt+0x290>
+  800831:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800835:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800838:	89 d2                	mov    %edx,%edx
+  80083a:	48 01 d0             	add    %rdx,%rax
+  80083d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800840:	83 c2 08             	add    $0x8,%edx
+  800843:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800846:	eb 0c                	jmp    800854 <vprintfmt+0x29c>
+  800848:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80084c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800850:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800854:	4c 8b 20             	mov    (%rax),%r12
+  800857:	4d 85 e4             	test   %r12,%r12
+  80085a:	75 0a                	jne    800866 <vprintfmt+0x2ae>
+          p = "(null)";
+  80085c:	49 bc ad 52 80 00 00 	movabs $0x8052ad,%r12
+  800863:	00 00 00 
+        if (width > 0 && padc != '-')
+  800866:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80086a:	7e 78                	jle    8008e4 <vprintfmt+0x32c>
+  80086c:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800870:	74 72                	je     8008e4 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800872:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800875:	48 98                	cltq
+  800877:	48 89 c6             	mov    %rax,%rsi
+  80087a:	4c 89 e7             	mov    %r12,%rdi
+  80087d:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  800884:	00 00 00 
+  800887:	ff d0                	call   *%rax
+  800889:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80088c:	eb 17                	jmp    8008a5 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80088e:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800892:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800896:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80089a:	48 89 d6             	mov    %rdx,%rsi
+  80089d:	89 c7                	mov    %eax,%edi
+  80089f:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8008a1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008a5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008a9:	7f e3                	jg     80088e <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ab:	eb 37                	jmp    8008e4 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8008ad:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8008b1:	74 1e                	je     8008d1 <vprintfmt+0x319>
+  8008b3:	83 fb 1f             	cmp    $0x1f,%ebx
+  8008b6:	7e 05                	jle    8008bd <vprintfmt+0x305>
+  8008b8:	83 fb 7e             	cmp    $0x7e,%ebx
+  8008bb:	7e 14                	jle    8008d1 <vprintfmt+0x319>
+            putch('?', putdat);
+  8008bd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008c1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008c5:	48 89 c6             	mov    %rax,%rsi
+  8008c8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008cd:	ff d2                	call   *%rdx
+  8008cf:	eb 0f                	jmp    8008e0 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8008d1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008d5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008d9:	48 89 c6             	mov    %rax,%rsi
+  8008dc:	89 df                	mov    %ebx,%edi
+  8008de:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008e0:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008e4:	4c 89 e0             	mov    %r12,%rax
+  8008e7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008eb:	0f b6 00             	movzbl (%rax),%eax
+  8008ee:	0f be d8             	movsbl %al,%ebx
+  8008f1:	85 db                	test   %ebx,%ebx
+  8008f3:	74 28                	je     80091d <vprintfmt+0x365>
+  8008f5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008f9:	78 b2                	js     8008ad <vprintfmt+0x2f5>
+  8008fb:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008ff:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800903:	79 a8                	jns    8008ad <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800905:	eb 16                	jmp    80091d <vprintfmt+0x365>
+          putch(' ', putdat);
+  800907:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80090b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80090f:	48 89 c6             	mov    %rax,%rsi
+  800912:	bf 20 00 00 00       	mov    $0x20,%edi
+  800917:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800919:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80091d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800921:	7f e4                	jg     800907 <vprintfmt+0x34f>
+        break;
+  800923:	e9 8d 01 00 00       	jmp    800ab5 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800928:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80092b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80092f:	89 d6                	mov    %edx,%esi
+  800931:	48 89 c7             	mov    %rax,%rdi
+  800934:	48 b8 c1 04 80 00 00 	movabs $0x8004c1,%rax
+  80093b:	00 00 00 
+  80093e:	ff d0                	call   *%rax
+  800940:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800944:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800948:	48 85 c0             	test   %rax,%rax
+  80094b:	79 1d                	jns    80096a <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80094d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800951:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800955:	48 89 c6             	mov    %rax,%rsi
+  800958:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80095d:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80095f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800963:	48 f7 d8             	neg    %rax
+  800966:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80096a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800971:	e9 d2 00 00 00       	jmp    800a48 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800976:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800979:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80097d:	89 d6                	mov    %edx,%esi
+  80097f:	48 89 c7             	mov    %rax,%rdi
+  800982:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  800989:	00 00 00 
+  80098c:	ff d0                	call   *%rax
+  80098e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800992:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800999:	e9 aa 00 00 00       	jmp    800a48 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80099e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009a1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009a5:	89 d6                	mov    %edx,%esi
+  8009a7:	48 89 c7             	mov    %rax,%rdi
+  8009aa:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  8009b1:	00 00 00 
+  8009b4:	ff d0                	call   *%rax
+  8009b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8009ba:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8009c1:	e9 82 00 00 00       	jmp    800a48 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8009c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ca:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009ce:	48 89 c6             	mov    %rax,%rsi
+  8009d1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009d6:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8009d8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009dc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009e0:	48 89 c6             	mov    %rax,%rsi
+  8009e3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009e8:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 17                	ja     800a09 <vprintfmt+0x451>
+  8009f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009f9:	89 d2                	mov    %edx,%edx
+  8009fb:	48 01 d0             	add    %rdx,%rax
+  8009fe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a01:	83 c2 08             	add    $0x8,%edx
+  800a04:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a07:	eb 0c                	jmp    800a15 <vprintfmt+0x45d>
+  800a09:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a0d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a11:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a15:	48 8b 00             	mov    (%rax),%rax
+  800a18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a1c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800a23:	eb 23                	jmp    800a48 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800a25:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a28:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a2c:	89 d6                	mov    %edx,%esi
+  800a2e:	48 89 c7             	mov    %rax,%rdi
+  800a31:	48 b8 ca 03 80 00 00 	movabs $0x8003ca,%rax
+  800a38:	00 00 00 
+  800a3b:	ff d0                	call   *%rax
+  800a3d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a41:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a48:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a4d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a50:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a57:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a5b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a5f:	45 89 c1             	mov    %r8d,%r9d
+  800a62:	41 89 f8             	mov    %edi,%r8d
+  800a65:	48 89 c7             	mov    %rax,%rdi
+  800a68:	48 b8 12 03 80 00 00 	movabs $0x800312,%rax
+  800a6f:	00 00 00 
+  800a72:	ff d0                	call   *%rax
+        break;
+  800a74:	eb 3f                	jmp    800ab5 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a7a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a7e:	48 89 c6             	mov    %rax,%rsi
+  800a81:	89 df                	mov    %ebx,%edi
+  800a83:	ff d2                	call   *%rdx
+        break;
+  800a85:	eb 2e                	jmp    800ab5 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a87:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a8b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a8f:	48 89 c6             	mov    %rax,%rsi
+  800a92:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a97:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a99:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a9e:	eb 05                	jmp    800aa5 <vprintfmt+0x4ed>
+  800aa0:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800aa5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800aa9:	48 83 e8 01          	sub    $0x1,%rax
+  800aad:	0f b6 00             	movzbl (%rax),%eax
+  800ab0:	3c 25                	cmp    $0x25,%al
+  800ab2:	75 ec                	jne    800aa0 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800ab4:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ab5:	e9 50 fb ff ff       	jmp    80060a <vprintfmt+0x52>
+        return;
+  800aba:	90                   	nop
+    }
+  }
+}
+  800abb:	48 83 c4 60          	add    $0x60,%rsp
+  800abf:	5b                   	pop    %rbx
+  800ac0:	41 5c                	pop    %r12
+  800ac2:	5d                   	pop    %rbp
+  800ac3:	c3                   	ret
+
+0000000000800ac4 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ac4:	55                   	push   %rbp
+  800ac5:	48 89 e5             	mov    %rsp,%rbp
+  800ac8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800acf:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ad6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800add:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ae4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800aeb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800af2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800af9:	84 c0                	test   %al,%al
+  800afb:	74 20                	je     800b1d <printfmt+0x59>
+  800afd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b01:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b05:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b09:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b0d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b11:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b15:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b19:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800b1d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800b24:	00 00 00 
+  800b27:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800b2e:	00 00 00 
+  800b31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b35:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800b3c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b43:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b4a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b51:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b58:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b5f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b66:	48 89 c7             	mov    %rax,%rdi
+  800b69:	48 b8 b8 05 80 00 00 	movabs $0x8005b8,%rax
+  800b70:	00 00 00 
+  800b73:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b75:	90                   	nop
+  800b76:	c9                   	leave
+  800b77:	c3                   	ret
+
+0000000000800b78 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b78:	55                   	push   %rbp
+  800b79:	48 89 e5             	mov    %rsp,%rbp
+  800b7c:	48 83 ec 10          	sub    $0x10,%rsp
+  800b80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b8b:	8b 40 10             	mov    0x10(%rax),%eax
+  800b8e:	8d 50 01             	lea    0x1(%rax),%edx
+  800b91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b95:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b9c:	48 8b 10             	mov    (%rax),%rdx
+  800b9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ba3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ba7:	48 39 c2             	cmp    %rax,%rdx
+  800baa:	73 17                	jae    800bc3 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800bac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb0:	48 8b 00             	mov    (%rax),%rax
+  800bb3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800bb7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800bbb:	48 89 0a             	mov    %rcx,(%rdx)
+  800bbe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800bc1:	88 10                	mov    %dl,(%rax)
+}
+  800bc3:	90                   	nop
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+0000000000800bc6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800bc6:	55                   	push   %rbp
+  800bc7:	48 89 e5             	mov    %rsp,%rbp
+  800bca:	48 83 ec 40          	sub    $0x40,%rsp
+  800bce:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800bd2:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800bd5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800bd9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800bdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800be1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800be5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800be8:	48 98                	cltq
+  800bea:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800bee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bf2:	48 01 d0             	add    %rdx,%rax
+  800bf5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bf9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800c00:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c05:	74 06                	je     800c0d <vsnprintf+0x47>
+  800c07:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c0b:	7f 07                	jg     800c14 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800c0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c12:	eb 32                	jmp    800c46 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800c14:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800c18:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800c1c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800c20:	48 89 c6             	mov    %rax,%rsi
+  800c23:	48 b8 78 0b 80 00 00 	movabs $0x800b78,%rax
+  800c2a:	00 00 00 
+  800c2d:	48 89 c7             	mov    %rax,%rdi
+  800c30:	48 b8 b8 05 80 00 00 	movabs $0x8005b8,%rax
+  800c37:	00 00 00 
+  800c3a:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c40:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c43:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c46:	c9                   	leave
+  800c47:	c3                   	ret
+
+0000000000800c48 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c53:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c5a:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c60:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c67:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c6e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c75:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c7c:	84 c0                	test   %al,%al
+  800c7e:	74 20                	je     800ca0 <snprintf+0x58>
+  800c80:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c84:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c88:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c8c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c90:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c94:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c98:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c9c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800ca0:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800ca7:	00 00 00 
+  800caa:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800cb1:	00 00 00 
+  800cb4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cb8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800cbf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800cc6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800ccd:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800cd4:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800cdb:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ce1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ce8:	48 89 c7             	mov    %rax,%rdi
+  800ceb:	48 b8 c6 0b 80 00 00 	movabs $0x800bc6,%rax
+  800cf2:	00 00 00 
+  800cf5:	ff d0                	call   *%rax
+  800cf7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cfd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+
+0000000000800d05 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800d05:	55                   	push   %rbp
+  800d06:	48 89 e5             	mov    %rsp,%rbp
+  800d09:	53                   	push   %rbx
+  800d0a:	48 83 ec 38          	sub    $0x38,%rsp
+  800d0e:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800d11:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800d15:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800d19:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800d1d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800d21:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d29:	89 d1                	mov    %edx,%ecx
+  800d2b:	0f a2                	cpuid
+  800d2d:	89 de                	mov    %ebx,%esi
+  800d2f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800d32:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800d35:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800d38:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800d3b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d40:	74 09                	je     800d4b <cpuid+0x46>
+}
+  800d42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d46:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d49:	89 10                	mov    %edx,(%rax)
+
+  800d4b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d50:	74 09                	je     800d5b <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d56:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d59:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d5b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d60:	74 09                	je     800d6b <cpuid+0x66>
+char *
+  800d62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d69:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d6b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d70:	74 09                	je     800d7b <cpuid+0x76>
+  for (; *s; s++)
+  800d72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d76:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d79:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d7b:	90                   	nop
+  800d7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d80:	c9                   	leave
+  800d81:	c3                   	ret
+
+0000000000800d82 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d82:	55                   	push   %rbp
+  800d83:	48 89 e5             	mov    %rsp,%rbp
+  800d86:	48 83 ec 18          	sub    $0x18,%rsp
+  800d8a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d90:	89 c1                	mov    %eax,%ecx
+  800d92:	0f 01 d0             	xgetbv
+  800d95:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d98:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d9e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800da1:	48 c1 e2 20          	shl    $0x20,%rdx
+  800da5:	48 09 d0             	or     %rdx,%rax
+#else
+  800da8:	c9                   	leave
+  800da9:	c3                   	ret
+
+0000000000800daa <string_cpu>:
+string_cpu(void) {
+  800daa:	55                   	push   %rbp
+  800dab:	48 89 e5             	mov    %rsp,%rbp
+  800dae:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800db2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800db9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800dc0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800dc7:	00 00 00 
+  800dca:	8b 00                	mov    (%rax),%eax
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	78 11                	js     800de1 <string_cpu+0x37>
+    return string_features;
+  800dd0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800dd7:	00 00 00 
+  800dda:	8b 00                	mov    (%rax),%eax
+  800ddc:	e9 df 00 00 00       	jmp    800ec0 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800de1:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800de5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800deb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df5:	48 89 c6             	mov    %rax,%rsi
+  800df8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dfd:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  800e04:	00 00 00 
+  800e07:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800e09:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e0c:	83 f8 06             	cmp    $0x6,%eax
+  800e0f:	76 28                	jbe    800e39 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800e11:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800e15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e20:	48 89 c2             	mov    %rax,%rdx
+  800e23:	be 00 00 00 00       	mov    $0x0,%esi
+  800e28:	bf 07 00 00 00       	mov    $0x7,%edi
+  800e2d:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  800e34:	00 00 00 
+  800e37:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800e39:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e3c:	25 00 02 00 00       	and    $0x200,%eax
+  800e41:	85 c0                	test   %eax,%eax
+  800e43:	74 04                	je     800e49 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e45:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e49:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e53:	48 89 c1             	mov    %rax,%rcx
+  800e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e60:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e65:	48 b8 05 0d 80 00 00 	movabs $0x800d05,%rax
+  800e6c:	00 00 00 
+  800e6f:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e71:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e74:	83 e0 20             	and    $0x20,%eax
+  800e77:	85 c0                	test   %eax,%eax
+  800e79:	74 2a                	je     800ea5 <string_cpu+0xfb>
+  800e7b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e7e:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	74 1e                	je     800ea5 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e8c:	48 b8 82 0d 80 00 00 	movabs $0x800d82,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+  800e98:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e9b:	48 83 f8 06          	cmp    $0x6,%rax
+  800e9f:	75 04                	jne    800ea5 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800ea1:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800ea5:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800eac:	00 00 00 
+  800eaf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800eb2:	89 02                	mov    %eax,(%rdx)
+  800eb4:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800ebb:	00 00 00 
+  800ebe:	8b 00                	mov    (%rax),%eax
+}
+  800ec0:	c9                   	leave
+  800ec1:	c3                   	ret
+
+0000000000800ec2 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800ec2:	55                   	push   %rbp
+  800ec3:	48 89 e5             	mov    %rsp,%rbp
+  800ec6:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800eca:	48 83 ec 60          	sub    $0x60,%rsp
+  800ece:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800ed3:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800ed8:	83 e0 1f             	and    $0x1f,%eax
+  800edb:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800edf:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ee3:	48 f7 d8             	neg    %rax
+  800ee6:	48 89 c2             	mov    %rax,%rdx
+  800ee9:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800eee:	48 01 d0             	add    %rdx,%rax
+  800ef1:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800ef6:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800efa:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800f00:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f05:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f09:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f0f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f13:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f17:	89 c2                	mov    %eax,%edx
+  800f19:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f1d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800f22:	89 c1                	mov    %eax,%ecx
+  800f24:	d3 e6                	shl    %cl,%esi
+  800f26:	89 f0                	mov    %esi,%eax
+  800f28:	21 d0                	and    %edx,%eax
+  800f2a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f2e:	eb 21                	jmp    800f51 <strlen_avx2+0x8f>
+    p += 32;
+  800f30:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800f36:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f3b:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f3f:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f45:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f49:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f4d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f51:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f56:	74 d8                	je     800f30 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f58:	31 c0                	xor    %eax,%eax
+  800f5a:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f60:	48 63 d0             	movslq %eax,%rdx
+  800f63:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f68:	48 01 d0             	add    %rdx,%rax
+  800f6b:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f70:	c9                   	leave
+  800f71:	c3                   	ret
+
+0000000000800f72 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f72:	55                   	push   %rbp
+  800f73:	48 89 e5             	mov    %rsp,%rbp
+  800f76:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f7a:	48 83 ec 40          	sub    $0x40,%rsp
+  800f7e:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f83:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f88:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f8d:	eb 77                	jmp    801006 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f8f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f94:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f98:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f9c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fa1:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800fa5:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fa9:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fad:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800fb1:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800fb6:	74 3c                	je     800ff4 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800fb8:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800fbc:	f7 d0                	not    %eax
+  800fbe:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800fc2:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800fc6:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800fca:	48 63 d0             	movslq %eax,%rdx
+  800fcd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fd2:	48 01 d0             	add    %rdx,%rax
+  800fd5:	0f b6 00             	movzbl (%rax),%eax
+  800fd8:	0f b6 c0             	movzbl %al,%eax
+  800fdb:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800fdf:	48 63 ca             	movslq %edx,%rcx
+  800fe2:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fe7:	48 01 ca             	add    %rcx,%rdx
+  800fea:	0f b6 12             	movzbl (%rdx),%edx
+  800fed:	0f b6 d2             	movzbl %dl,%edx
+  800ff0:	29 d0                	sub    %edx,%eax
+  800ff2:	eb 6b                	jmp    80105f <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800ff4:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800ffa:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801000:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801006:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80100c:	77 81                	ja     800f8f <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80100e:	eb 42                	jmp    801052 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801010:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801015:	0f b6 10             	movzbl (%rax),%edx
+  801018:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80101d:	0f b6 00             	movzbl (%rax),%eax
+  801020:	38 c2                	cmp    %al,%dl
+  801022:	74 1c                	je     801040 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801024:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801029:	0f b6 00             	movzbl (%rax),%eax
+  80102c:	0f b6 c8             	movzbl %al,%ecx
+  80102f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801034:	0f b6 00             	movzbl (%rax),%eax
+  801037:	0f b6 d0             	movzbl %al,%edx
+  80103a:	89 c8                	mov    %ecx,%eax
+  80103c:	29 d0                	sub    %edx,%eax
+  80103e:	eb 1f                	jmp    80105f <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801040:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801046:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80104c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801052:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801058:	75 b6                	jne    801010 <memcmp_avx2+0x9e>
+  return 0;
+  80105a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80105f:	c9                   	leave
+  801060:	c3                   	ret
+
+0000000000801061 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801061:	55                   	push   %rbp
+  801062:	48 89 e5             	mov    %rsp,%rbp
+  801065:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801069:	48 83 ec 60          	sub    $0x60,%rsp
+  80106d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801072:	89 f0                	mov    %esi,%eax
+  801074:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801079:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80107d:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801082:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801086:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80108b:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801091:	eb 47                	jmp    8010da <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801093:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801098:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80109c:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8010a0:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8010a6:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8010aa:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010ae:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8010b2:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8010b7:	74 15                	je     8010ce <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8010b9:	31 c0                	xor    %eax,%eax
+  8010bb:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8010c1:	48 63 d0             	movslq %eax,%rdx
+  8010c4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010c9:	48 01 d0             	add    %rdx,%rax
+  8010cc:	eb 3d                	jmp    80110b <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8010ce:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8010d4:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8010da:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8010e0:	77 b1                	ja     801093 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8010e2:	eb 0c                	jmp    8010f0 <memfind_avx2+0x8f>
+  8010e4:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010ea:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010f0:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010f6:	74 0e                	je     801106 <memfind_avx2+0xa5>
+  8010f8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010fd:	0f b6 00             	movzbl (%rax),%eax
+  801100:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801104:	75 de                	jne    8010e4 <memfind_avx2+0x83>
+  return s;
+  801106:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+
+000000000080110d <strlen>:
+strlen(const char *s) {
+  80110d:	55                   	push   %rbp
+  80110e:	48 89 e5             	mov    %rsp,%rbp
+  801111:	48 83 ec 40          	sub    $0x40,%rsp
+  801115:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801119:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80111d:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801121:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  801128:	00 00 00 
+  80112b:	ff d0                	call   *%rax
+  80112d:	83 e0 02             	and    $0x2,%eax
+  801130:	85 c0                	test   %eax,%eax
+  801132:	74 18                	je     80114c <strlen+0x3f>
+    return strlen_avx2(s);
+  801134:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801138:	48 89 c7             	mov    %rax,%rdi
+  80113b:	48 b8 c2 0e 80 00 00 	movabs $0x800ec2,%rax
+  801142:	00 00 00 
+  801145:	ff d0                	call   *%rax
+  801147:	e9 82 00 00 00       	jmp    8011ce <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80114c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801150:	83 e0 0f             	and    $0xf,%eax
+  801153:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801156:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801159:	48 f7 d8             	neg    %rax
+  80115c:	48 89 c2             	mov    %rax,%rdx
+  80115f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801163:	48 01 d0             	add    %rdx,%rax
+  801166:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80116a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801172:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801177:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80117b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80117f:	89 c2                	mov    %eax,%edx
+  801181:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801184:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801189:	89 c1                	mov    %eax,%ecx
+  80118b:	d3 e6                	shl    %cl,%esi
+  80118d:	89 f0                	mov    %esi,%eax
+  80118f:	21 d0                	and    %edx,%eax
+  801191:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801194:	eb 1d                	jmp    8011b3 <strlen+0xa6>
+    p += 16;
+  801196:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80119b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80119f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8011a3:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8011a8:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8011ac:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8011b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8011b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011b7:	74 dd                	je     801196 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8011b9:	31 c0                	xor    %eax,%eax
+  8011bb:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8011c0:	48 63 d0             	movslq %eax,%rdx
+  8011c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011c7:	48 01 d0             	add    %rdx,%rax
+  8011ca:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8011ce:	c9                   	leave
+  8011cf:	c3                   	ret
+
+00000000008011d0 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8011d0:	55                   	push   %rbp
+  8011d1:	48 89 e5             	mov    %rsp,%rbp
+  8011d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8011d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011e7:	eb 0e                	jmp    8011f7 <strnlen+0x27>
+    n++;
+  8011e9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011ed:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011f2:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011f7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011fc:	74 0b                	je     801209 <strnlen+0x39>
+  8011fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801202:	0f b6 00             	movzbl (%rax),%eax
+  801205:	84 c0                	test   %al,%al
+  801207:	75 e0                	jne    8011e9 <strnlen+0x19>
+  return n;
+  801209:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80120c:	c9                   	leave
+  80120d:	c3                   	ret
+
+000000000080120e <strcpy>:
+strcpy(char *dst, const char *src) {
+  80120e:	55                   	push   %rbp
+  80120f:	48 89 e5             	mov    %rsp,%rbp
+  801212:	48 83 ec 20          	sub    $0x20,%rsp
+  801216:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80121a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80121e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801222:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801226:	90                   	nop
+  801227:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80122b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80122f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801233:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801237:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80123b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80123f:	0f b6 12             	movzbl (%rdx),%edx
+  801242:	88 10                	mov    %dl,(%rax)
+  801244:	0f b6 00             	movzbl (%rax),%eax
+  801247:	84 c0                	test   %al,%al
+  801249:	75 dc                	jne    801227 <strcpy+0x19>
+  return ret;
+  80124b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+0000000000801251 <strcat>:
+strcat(char *dst, const char *src) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+  801255:	48 83 ec 20          	sub    $0x20,%rsp
+  801259:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80125d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801265:	48 89 c7             	mov    %rax,%rdi
+  801268:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  80126f:	00 00 00 
+  801272:	ff d0                	call   *%rax
+  801274:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801277:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80127a:	48 63 d0             	movslq %eax,%rdx
+  80127d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801281:	48 01 c2             	add    %rax,%rdx
+  801284:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801288:	48 89 c6             	mov    %rax,%rsi
+  80128b:	48 89 d7             	mov    %rdx,%rdi
+  80128e:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  801295:	00 00 00 
+  801298:	ff d0                	call   *%rax
+  return dst;
+  80129a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80129e:	c9                   	leave
+  80129f:	c3                   	ret
+
+00000000008012a0 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8012a0:	55                   	push   %rbp
+  8012a1:	48 89 e5             	mov    %rsp,%rbp
+  8012a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8012a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012b0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8012b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8012bc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8012c3:	00 
+  8012c4:	eb 2a                	jmp    8012f0 <strncpy+0x50>
+    *dst++ = *src;
+  8012c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8012ce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012d6:	0f b6 12             	movzbl (%rdx),%edx
+  8012d9:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8012db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012df:	0f b6 00             	movzbl (%rax),%eax
+  8012e2:	84 c0                	test   %al,%al
+  8012e4:	74 05                	je     8012eb <strncpy+0x4b>
+      src++;
+  8012e6:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012eb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f4:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012f8:	72 cc                	jb     8012c6 <strncpy+0x26>
+  return ret;
+  8012fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+
+0000000000801300 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801300:	55                   	push   %rbp
+  801301:	48 89 e5             	mov    %rsp,%rbp
+  801304:	48 83 ec 28          	sub    $0x28,%rsp
+  801308:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80130c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801310:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801318:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80131c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801321:	74 3d                	je     801360 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801323:	eb 1d                	jmp    801342 <strlcpy+0x42>
+      *dst++ = *src++;
+  801325:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801329:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80132d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801331:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801335:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801339:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80133d:	0f b6 12             	movzbl (%rdx),%edx
+  801340:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801342:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801347:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80134c:	74 0b                	je     801359 <strlcpy+0x59>
+  80134e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801352:	0f b6 00             	movzbl (%rax),%eax
+  801355:	84 c0                	test   %al,%al
+  801357:	75 cc                	jne    801325 <strlcpy+0x25>
+    *dst = '\0';
+  801359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135d:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801364:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+
+000000000080136a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	48 83 ec 30          	sub    $0x30,%rsp
+  801372:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801376:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80137a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80137e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801382:	48 89 c7             	mov    %rax,%rdi
+  801385:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  80138c:	00 00 00 
+  80138f:	ff d0                	call   *%rax
+  801391:	48 98                	cltq
+  801393:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801397:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80139b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80139f:	48 89 d6             	mov    %rdx,%rsi
+  8013a2:	48 89 c7             	mov    %rax,%rdi
+  8013a5:	48 b8 d0 11 80 00 00 	movabs $0x8011d0,%rax
+  8013ac:	00 00 00 
+  8013af:	ff d0                	call   *%rax
+  8013b1:	48 98                	cltq
+  8013b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8013b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013bb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013bf:	75 10                	jne    8013d1 <strlcat+0x67>
+    return maxlen + srclen;
+  8013c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8013c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c9:	48 01 d0             	add    %rdx,%rax
+  8013cc:	e9 86 00 00 00       	jmp    801457 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8013d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013d5:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8013d9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8013dd:	73 2b                	jae    80140a <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8013df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013e3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ef:	48 01 c1             	add    %rax,%rcx
+  8013f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013f6:	48 89 c6             	mov    %rax,%rsi
+  8013f9:	48 89 cf             	mov    %rcx,%rdi
+  8013fc:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  801403:	00 00 00 
+  801406:	ff d0                	call   *%rax
+  801408:	eb 42                	jmp    80144c <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80140a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80140e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801412:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801416:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80141a:	48 01 c1             	add    %rax,%rcx
+  80141d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801421:	48 89 c6             	mov    %rax,%rsi
+  801424:	48 89 cf             	mov    %rcx,%rdi
+  801427:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  80142e:	00 00 00 
+  801431:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801433:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801437:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80143b:	48 01 d0             	add    %rdx,%rax
+  80143e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801442:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801446:	48 01 d0             	add    %rdx,%rax
+  801449:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80144c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801454:	48 01 d0             	add    %rdx,%rax
+}
+  801457:	c9                   	leave
+  801458:	c3                   	ret
+
+0000000000801459 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801459:	55                   	push   %rbp
+  80145a:	48 89 e5             	mov    %rsp,%rbp
+  80145d:	48 83 ec 10          	sub    $0x10,%rsp
+  801461:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801465:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801469:	eb 0a                	jmp    801475 <strcmp+0x1c>
+    p++, q++;
+  80146b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801470:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801479:	0f b6 00             	movzbl (%rax),%eax
+  80147c:	84 c0                	test   %al,%al
+  80147e:	74 12                	je     801492 <strcmp+0x39>
+  801480:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801484:	0f b6 10             	movzbl (%rax),%edx
+  801487:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80148b:	0f b6 00             	movzbl (%rax),%eax
+  80148e:	38 c2                	cmp    %al,%dl
+  801490:	74 d9                	je     80146b <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801492:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801496:	0f b6 00             	movzbl (%rax),%eax
+  801499:	0f b6 d0             	movzbl %al,%edx
+  80149c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a0:	0f b6 00             	movzbl (%rax),%eax
+  8014a3:	0f b6 c0             	movzbl %al,%eax
+  8014a6:	29 c2                	sub    %eax,%edx
+  8014a8:	89 d0                	mov    %edx,%eax
+}
+  8014aa:	c9                   	leave
+  8014ab:	c3                   	ret
+
+00000000008014ac <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8014ac:	55                   	push   %rbp
+  8014ad:	48 89 e5             	mov    %rsp,%rbp
+  8014b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8014b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8014bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8014c0:	eb 0f                	jmp    8014d1 <strncmp+0x25>
+    n--, p++, q++;
+  8014c2:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014c7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014cc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8014d1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014d6:	74 1d                	je     8014f5 <strncmp+0x49>
+  8014d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014dc:	0f b6 00             	movzbl (%rax),%eax
+  8014df:	84 c0                	test   %al,%al
+  8014e1:	74 12                	je     8014f5 <strncmp+0x49>
+  8014e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e7:	0f b6 10             	movzbl (%rax),%edx
+  8014ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ee:	0f b6 00             	movzbl (%rax),%eax
+  8014f1:	38 c2                	cmp    %al,%dl
+  8014f3:	74 cd                	je     8014c2 <strncmp+0x16>
+  if (n == 0)
+  8014f5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014fa:	75 07                	jne    801503 <strncmp+0x57>
+    return 0;
+  8014fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801501:	eb 16                	jmp    801519 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801507:	0f b6 00             	movzbl (%rax),%eax
+  80150a:	0f b6 d0             	movzbl %al,%edx
+  80150d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801511:	0f b6 00             	movzbl (%rax),%eax
+  801514:	0f b6 c0             	movzbl %al,%eax
+  801517:	29 c2                	sub    %eax,%edx
+}
+  801519:	89 d0                	mov    %edx,%eax
+  80151b:	c9                   	leave
+  80151c:	c3                   	ret
+
+000000000080151d <strchr>:
+strchr(const char *s, char c) {
+  80151d:	55                   	push   %rbp
+  80151e:	48 89 e5             	mov    %rsp,%rbp
+  801521:	48 83 ec 60          	sub    $0x60,%rsp
+  801525:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801529:	89 f0                	mov    %esi,%eax
+  80152b:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80152e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801532:	83 e0 0f             	and    $0xf,%eax
+  801535:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801538:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80153b:	48 f7 d8             	neg    %rax
+  80153e:	48 89 c2             	mov    %rax,%rdx
+  801541:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801545:	48 01 d0             	add    %rdx,%rax
+  801548:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80154c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801550:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801554:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801558:	66 0f 6e c0          	movd   %eax,%xmm0
+  80155c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801560:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801564:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801569:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80156d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801571:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801575:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801579:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80157e:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801583:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801587:	89 c2                	mov    %eax,%edx
+  801589:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80158e:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801593:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801597:	09 c2                	or     %eax,%edx
+  801599:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80159c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8015a1:	89 c1                	mov    %eax,%ecx
+  8015a3:	d3 e6                	shl    %cl,%esi
+  8015a5:	89 f0                	mov    %esi,%eax
+  8015a7:	21 d0                	and    %edx,%eax
+  8015a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015ac:	eb 34                	jmp    8015e2 <strchr+0xc5>
+    p += 16;
+  8015ae:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8015b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b7:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015bb:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8015bf:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015c4:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8015c9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015cd:	89 c2                	mov    %eax,%edx
+  8015cf:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8015d4:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8015d9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015dd:	09 d0                	or     %edx,%eax
+  8015df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015e6:	74 c6                	je     8015ae <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015e8:	31 c0                	xor    %eax,%eax
+  8015ea:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015ef:	48 98                	cltq
+  8015f1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f9:	0f b6 00             	movzbl (%rax),%eax
+  8015fc:	84 c0                	test   %al,%al
+  8015fe:	74 06                	je     801606 <strchr+0xe9>
+  801600:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801604:	eb 05                	jmp    80160b <strchr+0xee>
+  801606:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+
+000000000080160d <strfind>:
+strfind(const char *s, char c) {
+  80160d:	55                   	push   %rbp
+  80160e:	48 89 e5             	mov    %rsp,%rbp
+  801611:	48 83 ec 10          	sub    $0x10,%rsp
+  801615:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801619:	89 f0                	mov    %esi,%eax
+  80161b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80161e:	eb 11                	jmp    801631 <strfind+0x24>
+    if (*s == c)
+  801620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801624:	0f b6 00             	movzbl (%rax),%eax
+  801627:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80162a:	74 12                	je     80163e <strfind+0x31>
+  for (; *s; s++)
+  80162c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801635:	0f b6 00             	movzbl (%rax),%eax
+  801638:	84 c0                	test   %al,%al
+  80163a:	75 e4                	jne    801620 <strfind+0x13>
+  80163c:	eb 01                	jmp    80163f <strfind+0x32>
+      break;
+  80163e:	90                   	nop
+  return (char *)s;
+  80163f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801643:	c9                   	leave
+  801644:	c3                   	ret
+
+0000000000801645 <memset>:
+memset(void *v, int c, size_t n) {
+  801645:	55                   	push   %rbp
+  801646:	48 89 e5             	mov    %rsp,%rbp
+  801649:	48 83 ec 38          	sub    $0x38,%rsp
+  80164d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801651:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801654:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801660:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801665:	76 41                	jbe    8016a8 <memset+0x63>
+  801667:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  80166e:	00 00 00 
+  801671:	ff d0                	call   *%rax
+  801673:	83 e0 01             	and    $0x1,%eax
+  801676:	85 c0                	test   %eax,%eax
+  801678:	74 2e                	je     8016a8 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80167a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80167d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801681:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801685:	48 89 ce             	mov    %rcx,%rsi
+  801688:	48 89 f7             	mov    %rsi,%rdi
+  80168b:	48 89 d1             	mov    %rdx,%rcx
+  80168e:	fc                   	cld
+  80168f:	f3 aa                	rep stos %al,%es:(%rdi)
+  801691:	48 89 ca             	mov    %rcx,%rdx
+  801694:	48 89 fe             	mov    %rdi,%rsi
+  801697:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80169b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80169f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016a3:	e9 a7 00 00 00       	jmp    80174f <memset+0x10a>
+  if (n >= 8) {
+  8016a8:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8016ad:	0f 86 87 00 00 00    	jbe    80173a <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8016b3:	eb 16                	jmp    8016cb <memset+0x86>
+      *p++ = c;
+  8016b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016bd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016c1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016c4:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8016c6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8016cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016cf:	83 e0 07             	and    $0x7,%eax
+  8016d2:	48 85 c0             	test   %rax,%rax
+  8016d5:	75 de                	jne    8016b5 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8016d7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016da:	0f b6 c0             	movzbl %al,%eax
+  8016dd:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016e4:	01 01 01 
+  8016e7:	48 0f af c2          	imul   %rdx,%rax
+  8016eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f3:	48 c1 e8 03          	shr    $0x3,%rax
+  8016f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ff:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801703:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801707:	48 89 ce             	mov    %rcx,%rsi
+  80170a:	48 89 f7             	mov    %rsi,%rdi
+  80170d:	48 89 d1             	mov    %rdx,%rcx
+  801710:	fc                   	cld
+  801711:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801714:	48 89 ca             	mov    %rcx,%rdx
+  801717:	48 89 fe             	mov    %rdi,%rsi
+  80171a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80171e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801722:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801727:	eb 11                	jmp    80173a <memset+0xf5>
+    *p++ = c;
+  801729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801731:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801735:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801738:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80173a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80173e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801742:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801746:	48 85 c0             	test   %rax,%rax
+  801749:	75 de                	jne    801729 <memset+0xe4>
+  return v;
+  80174b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80174f:	c9                   	leave
+  801750:	c3                   	ret
+
+0000000000801751 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801751:	55                   	push   %rbp
+  801752:	48 89 e5             	mov    %rsp,%rbp
+  801755:	48 83 ec 38          	sub    $0x38,%rsp
+  801759:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80175d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801761:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801765:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801769:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80176d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801771:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801779:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80177d:	0f 83 da 00 00 00    	jae    80185d <memmove+0x10c>
+  801783:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801787:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80178b:	48 01 d0             	add    %rdx,%rax
+  80178e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801792:	0f 83 c5 00 00 00    	jae    80185d <memmove+0x10c>
+    s += n;
+  801798:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80179c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8017a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8017a8:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8017ad:	0f 86 94 00 00 00    	jbe    801847 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8017b3:	eb 1c                	jmp    8017d1 <memmove+0x80>
+        *--d = *--s;
+  8017b5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017ba:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c3:	0f b6 10             	movzbl (%rax),%edx
+  8017c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ca:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8017cc:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8017d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d5:	83 e0 07             	and    $0x7,%eax
+  8017d8:	48 85 c0             	test   %rax,%rax
+  8017db:	75 d8                	jne    8017b5 <memmove+0x64>
+      nq = n / 8;
+  8017dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017e1:	48 c1 e8 03          	shr    $0x3,%rax
+  8017e5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017e9:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017ee:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017f3:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017f8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801800:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801804:	48 89 cf             	mov    %rcx,%rdi
+  801807:	48 89 d6             	mov    %rdx,%rsi
+  80180a:	48 89 c1             	mov    %rax,%rcx
+  80180d:	fd                   	std
+  80180e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801811:	fc                   	cld
+  801812:	48 89 c8             	mov    %rcx,%rax
+  801815:	48 89 f2             	mov    %rsi,%rdx
+  801818:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80181c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801820:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801824:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801829:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80182e:	eb 17                	jmp    801847 <memmove+0xf6>
+      *--d = *--s;
+  801830:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801835:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80183a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80183e:	0f b6 10             	movzbl (%rax),%edx
+  801841:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801845:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801847:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80184b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80184f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801853:	48 85 c0             	test   %rax,%rax
+  801856:	75 d8                	jne    801830 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801858:	e9 f4 00 00 00       	jmp    801951 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80185d:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801862:	76 46                	jbe    8018aa <memmove+0x159>
+  801864:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  80186b:	00 00 00 
+  80186e:	ff d0                	call   *%rax
+  801870:	83 e0 01             	and    $0x1,%eax
+  801873:	85 c0                	test   %eax,%eax
+  801875:	74 33                	je     8018aa <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801877:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80187b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80187f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801883:	48 89 cf             	mov    %rcx,%rdi
+  801886:	48 89 d6             	mov    %rdx,%rsi
+  801889:	48 89 c1             	mov    %rax,%rcx
+  80188c:	fc                   	cld
+  80188d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80188f:	48 89 c8             	mov    %rcx,%rax
+  801892:	48 89 f2             	mov    %rsi,%rdx
+  801895:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801899:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80189d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8018a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a5:	e9 ab 00 00 00       	jmp    801955 <memmove+0x204>
+    if (n >= 8) {
+  8018aa:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8018af:	0f 86 8b 00 00 00    	jbe    801940 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8018b5:	eb 22                	jmp    8018d9 <memmove+0x188>
+        *d++ = *s++;
+  8018b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018bb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018cb:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8018cf:	0f b6 12             	movzbl (%rdx),%edx
+  8018d2:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8018d4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018dd:	83 e0 07             	and    $0x7,%eax
+  8018e0:	48 85 c0             	test   %rax,%rax
+  8018e3:	75 d2                	jne    8018b7 <memmove+0x166>
+      nq = n / 8;
+  8018e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e9:	48 c1 e8 03          	shr    $0x3,%rax
+  8018ed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018f1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018fd:	48 89 cf             	mov    %rcx,%rdi
+  801900:	48 89 d6             	mov    %rdx,%rsi
+  801903:	48 89 c1             	mov    %rax,%rcx
+  801906:	fc                   	cld
+  801907:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80190a:	48 89 c8             	mov    %rcx,%rax
+  80190d:	48 89 f2             	mov    %rsi,%rdx
+  801910:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801914:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801918:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80191c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801921:	eb 1d                	jmp    801940 <memmove+0x1ef>
+      *d++ = *s++;
+  801923:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801927:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80192b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80192f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801933:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801937:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80193b:	0f b6 12             	movzbl (%rdx),%edx
+  80193e:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801940:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801944:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801948:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80194c:	48 85 c0             	test   %rax,%rax
+  80194f:	75 d2                	jne    801923 <memmove+0x1d2>
+  return dst;
+  801951:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801955:	c9                   	leave
+  801956:	c3                   	ret
+
+0000000000801957 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801957:	55                   	push   %rbp
+  801958:	48 89 e5             	mov    %rsp,%rbp
+  80195b:	48 83 ec 18          	sub    $0x18,%rsp
+  80195f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801963:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801967:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80196b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80196f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801977:	48 89 ce             	mov    %rcx,%rsi
+  80197a:	48 89 c7             	mov    %rax,%rdi
+  80197d:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+}
+  801989:	c9                   	leave
+  80198a:	c3                   	ret
+
+000000000080198b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80198b:	55                   	push   %rbp
+  80198c:	48 89 e5             	mov    %rsp,%rbp
+  80198f:	48 83 ec 40          	sub    $0x40,%rsp
+  801993:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801997:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80199b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80199f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8019a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8019af:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8019b4:	0f 86 a7 00 00 00    	jbe    801a61 <memcmp+0xd6>
+  8019ba:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+  8019c6:	83 e0 02             	and    $0x2,%eax
+  8019c9:	85 c0                	test   %eax,%eax
+  8019cb:	0f 84 90 00 00 00    	je     801a61 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8019d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8019d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019dd:	48 89 ce             	mov    %rcx,%rsi
+  8019e0:	48 89 c7             	mov    %rax,%rdi
+  8019e3:	48 b8 72 0f 80 00 00 	movabs $0x800f72,%rax
+  8019ea:	00 00 00 
+  8019ed:	ff d0                	call   *%rax
+  8019ef:	e9 c2 00 00 00       	jmp    801ab6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f8:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019fc:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a04:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a08:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801a0c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801a13:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801a1a:	74 36                	je     801a52 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801a1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a1f:	f7 d0                	not    %eax
+  801a21:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801a25:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801a28:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801a2b:	48 63 d0             	movslq %eax,%rdx
+  801a2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a32:	48 01 d0             	add    %rdx,%rax
+  801a35:	0f b6 00             	movzbl (%rax),%eax
+  801a38:	0f b6 c0             	movzbl %al,%eax
+  801a3b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801a3e:	48 63 ca             	movslq %edx,%rcx
+  801a41:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a45:	48 01 ca             	add    %rcx,%rdx
+  801a48:	0f b6 12             	movzbl (%rdx),%edx
+  801a4b:	0f b6 d2             	movzbl %dl,%edx
+  801a4e:	29 d0                	sub    %edx,%eax
+  801a50:	eb 64                	jmp    801ab6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a52:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a57:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a5c:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a61:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a66:	77 8c                	ja     8019f4 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a68:	eb 36                	jmp    801aa0 <memcmp+0x115>
+    if (*s1 != *s2)
+  801a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a6e:	0f b6 10             	movzbl (%rax),%edx
+  801a71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a75:	0f b6 00             	movzbl (%rax),%eax
+  801a78:	38 c2                	cmp    %al,%dl
+  801a7a:	74 1a                	je     801a96 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a80:	0f b6 00             	movzbl (%rax),%eax
+  801a83:	0f b6 c8             	movzbl %al,%ecx
+  801a86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8a:	0f b6 00             	movzbl (%rax),%eax
+  801a8d:	0f b6 d0             	movzbl %al,%edx
+  801a90:	89 c8                	mov    %ecx,%eax
+  801a92:	29 d0                	sub    %edx,%eax
+  801a94:	eb 20                	jmp    801ab6 <memcmp+0x12b>
+    s1++, s2++;
+  801a96:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a9b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801aa8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801aac:	48 85 c0             	test   %rax,%rax
+  801aaf:	75 b9                	jne    801a6a <memcmp+0xdf>
+  }
+
+  return 0;
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+0000000000801ab8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ab8:	55                   	push   %rbp
+  801ab9:	48 89 e5             	mov    %rsp,%rbp
+  801abc:	48 83 ec 50          	sub    $0x50,%rsp
+  801ac0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ac4:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801ac7:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801acb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801acf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ad3:	48 01 d0             	add    %rdx,%rax
+  801ad6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801ada:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801add:	66 0f 6e c0          	movd   %eax,%xmm0
+  801ae1:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801ae5:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801ae9:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801aee:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801af2:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801af7:	76 73                	jbe    801b6c <memfind+0xb4>
+  801af9:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  801b00:	00 00 00 
+  801b03:	ff d0                	call   *%rax
+  801b05:	83 e0 02             	and    $0x2,%eax
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	74 60                	je     801b6c <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801b0c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b0f:	0f b6 c8             	movzbl %al,%ecx
+  801b12:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1a:	89 ce                	mov    %ecx,%esi
+  801b1c:	48 89 c7             	mov    %rax,%rdi
+  801b1f:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  801b26:	00 00 00 
+  801b29:	ff d0                	call   *%rax
+  801b2b:	eb 6c                	jmp    801b99 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801b2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b31:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b35:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801b39:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801b3e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b42:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b46:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b49:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b4d:	74 13                	je     801b62 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b4f:	31 c0                	xor    %eax,%eax
+  801b51:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b56:	48 63 d0             	movslq %eax,%rdx
+  801b59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b5d:	48 01 d0             	add    %rdx,%rax
+  801b60:	eb 37                	jmp    801b99 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b62:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b67:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b6c:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b71:	77 ba                	ja     801b2d <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b73:	eb 13                	jmp    801b88 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b79:	0f b6 00             	movzbl (%rax),%eax
+  801b7c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b7f:	38 d0                	cmp    %dl,%al
+  801b81:	74 11                	je     801b94 <memfind+0xdc>
+  for (; s < ends; s++)
+  801b83:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b90:	72 e3                	jb     801b75 <memfind+0xbd>
+  801b92:	eb 01                	jmp    801b95 <memfind+0xdd>
+      break;
+  801b94:	90                   	nop
+  return (void *)s;
+  801b95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b99:	c9                   	leave
+  801b9a:	c3                   	ret
+
+0000000000801b9b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b9b:	55                   	push   %rbp
+  801b9c:	48 89 e5             	mov    %rsp,%rbp
+  801b9f:	48 83 ec 38          	sub    $0x38,%rsp
+  801ba3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ba7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bab:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801bae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801bb5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801bbc:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801bbd:	eb 05                	jmp    801bc4 <strtol+0x29>
+    s++;
+  801bbf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc8:	0f b6 00             	movzbl (%rax),%eax
+  801bcb:	3c 20                	cmp    $0x20,%al
+  801bcd:	74 f0                	je     801bbf <strtol+0x24>
+  801bcf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd3:	0f b6 00             	movzbl (%rax),%eax
+  801bd6:	3c 09                	cmp    $0x9,%al
+  801bd8:	74 e5                	je     801bbf <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801bda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bde:	0f b6 00             	movzbl (%rax),%eax
+  801be1:	3c 2b                	cmp    $0x2b,%al
+  801be3:	75 07                	jne    801bec <strtol+0x51>
+    s++;
+  801be5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bea:	eb 17                	jmp    801c03 <strtol+0x68>
+  else if (*s == '-')
+  801bec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf0:	0f b6 00             	movzbl (%rax),%eax
+  801bf3:	3c 2d                	cmp    $0x2d,%al
+  801bf5:	75 0c                	jne    801c03 <strtol+0x68>
+    s++, neg = 1;
+  801bf7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bfc:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c03:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c07:	74 06                	je     801c0f <strtol+0x74>
+  801c09:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c0d:	75 28                	jne    801c37 <strtol+0x9c>
+  801c0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c13:	0f b6 00             	movzbl (%rax),%eax
+  801c16:	3c 30                	cmp    $0x30,%al
+  801c18:	75 1d                	jne    801c37 <strtol+0x9c>
+  801c1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1e:	48 83 c0 01          	add    $0x1,%rax
+  801c22:	0f b6 00             	movzbl (%rax),%eax
+  801c25:	3c 78                	cmp    $0x78,%al
+  801c27:	75 0e                	jne    801c37 <strtol+0x9c>
+    s += 2, base = 16;
+  801c29:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c2e:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c35:	eb 2c                	jmp    801c63 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801c37:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c3b:	75 19                	jne    801c56 <strtol+0xbb>
+  801c3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c41:	0f b6 00             	movzbl (%rax),%eax
+  801c44:	3c 30                	cmp    $0x30,%al
+  801c46:	75 0e                	jne    801c56 <strtol+0xbb>
+    s++, base = 8;
+  801c48:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c4d:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c54:	eb 0d                	jmp    801c63 <strtol+0xc8>
+  else if (base == 0)
+  801c56:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c5a:	75 07                	jne    801c63 <strtol+0xc8>
+    base = 10;
+  801c5c:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c67:	0f b6 00             	movzbl (%rax),%eax
+  801c6a:	3c 2f                	cmp    $0x2f,%al
+  801c6c:	7e 1d                	jle    801c8b <strtol+0xf0>
+  801c6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c72:	0f b6 00             	movzbl (%rax),%eax
+  801c75:	3c 39                	cmp    $0x39,%al
+  801c77:	7f 12                	jg     801c8b <strtol+0xf0>
+      dig = *s - '0';
+  801c79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7d:	0f b6 00             	movzbl (%rax),%eax
+  801c80:	0f be c0             	movsbl %al,%eax
+  801c83:	83 e8 30             	sub    $0x30,%eax
+  801c86:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c89:	eb 4e                	jmp    801cd9 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8f:	0f b6 00             	movzbl (%rax),%eax
+  801c92:	3c 60                	cmp    $0x60,%al
+  801c94:	7e 1d                	jle    801cb3 <strtol+0x118>
+  801c96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9a:	0f b6 00             	movzbl (%rax),%eax
+  801c9d:	3c 7a                	cmp    $0x7a,%al
+  801c9f:	7f 12                	jg     801cb3 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801ca1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca5:	0f b6 00             	movzbl (%rax),%eax
+  801ca8:	0f be c0             	movsbl %al,%eax
+  801cab:	83 e8 57             	sub    $0x57,%eax
+  801cae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cb1:	eb 26                	jmp    801cd9 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	3c 40                	cmp    $0x40,%al
+  801cbc:	7e 47                	jle    801d05 <strtol+0x16a>
+  801cbe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc2:	0f b6 00             	movzbl (%rax),%eax
+  801cc5:	3c 5a                	cmp    $0x5a,%al
+  801cc7:	7f 3c                	jg     801d05 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801cc9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ccd:	0f b6 00             	movzbl (%rax),%eax
+  801cd0:	0f be c0             	movsbl %al,%eax
+  801cd3:	83 e8 37             	sub    $0x37,%eax
+  801cd6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801cd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cdc:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801cdf:	7d 23                	jge    801d04 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ce1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ce6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ce9:	48 98                	cltq
+  801ceb:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cf0:	48 89 c2             	mov    %rax,%rdx
+  801cf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cf6:	48 98                	cltq
+  801cf8:	48 01 d0             	add    %rdx,%rax
+  801cfb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cff:	e9 5f ff ff ff       	jmp    801c63 <strtol+0xc8>
+      break;
+  801d04:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801d05:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d0a:	74 0b                	je     801d17 <strtol+0x17c>
+    *endptr = (char *)s;
+  801d0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d10:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d14:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801d17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d1b:	74 09                	je     801d26 <strtol+0x18b>
+  801d1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d21:	48 f7 d8             	neg    %rax
+  801d24:	eb 04                	jmp    801d2a <strtol+0x18f>
+  801d26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d2a:	c9                   	leave
+  801d2b:	c3                   	ret
+
+0000000000801d2c <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801d2c:	55                   	push   %rbp
+  801d2d:	48 89 e5             	mov    %rsp,%rbp
+  801d30:	53                   	push   %rbx
+  801d31:	48 83 ec 48          	sub    $0x48,%rsp
+  801d35:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d39:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d3d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d41:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d45:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d49:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d51:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d55:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d59:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d5d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d61:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d65:	4c 89 c3             	mov    %r8,%rbx
+  801d68:	cd 30                	int    $0x30
+  801d6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d6e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d73:	74 46                	je     801dbb <syscall+0x8f>
+  801d75:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d7a:	7e 3f                	jle    801dbb <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d84:	49 89 d0             	mov    %rdx,%r8
+  801d87:	48 89 c1             	mov    %rax,%rcx
+  801d8a:	48 b8 68 55 80 00 00 	movabs $0x805568,%rax
+  801d91:	00 00 00 
+  801d94:	48 89 c2             	mov    %rax,%rdx
+  801d97:	be 22 00 00 00       	mov    $0x22,%esi
+  801d9c:	48 b8 87 55 80 00 00 	movabs $0x805587,%rax
+  801da3:	00 00 00 
+  801da6:	48 89 c7             	mov    %rax,%rdi
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dae:	49 b9 6c 4b 80 00 00 	movabs $0x804b6c,%r9
+  801db5:	00 00 00 
+  801db8:	41 ff d1             	call   *%r9
+
+  return ret;
+  801dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801dbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc3:	c9                   	leave
+  801dc4:	c3                   	ret
+
+0000000000801dc5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801dc5:	55                   	push   %rbp
+  801dc6:	48 89 e5             	mov    %rsp,%rbp
+  801dc9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dcd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801dd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801dd5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ddd:	48 83 ec 08          	sub    $0x8,%rsp
+  801de1:	6a 00                	push   $0x0
+  801de3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801def:	48 89 d1             	mov    %rdx,%rcx
+  801df2:	48 89 c2             	mov    %rax,%rdx
+  801df5:	be 00 00 00 00       	mov    $0x0,%esi
+  801dfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dff:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801e06:	00 00 00 
+  801e09:	ff d0                	call   *%rax
+  801e0b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e0f:	90                   	nop
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+
+0000000000801e12 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e16:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1a:	6a 00                	push   $0x0
+  801e1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e32:	be 00 00 00 00       	mov    $0x0,%esi
+  801e37:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e3c:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801e43:	00 00 00 
+  801e46:	ff d0                	call   *%rax
+  801e48:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e4c:	c9                   	leave
+  801e4d:	c3                   	ret
+
+0000000000801e4e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e4e:	55                   	push   %rbp
+  801e4f:	48 89 e5             	mov    %rsp,%rbp
+  801e52:	48 83 ec 10          	sub    $0x10,%rsp
+  801e56:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e5c:	48 98                	cltq
+  801e5e:	48 83 ec 08          	sub    $0x8,%rsp
+  801e62:	6a 00                	push   $0x0
+  801e64:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e6a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e75:	48 89 c2             	mov    %rax,%rdx
+  801e78:	be 01 00 00 00       	mov    $0x1,%esi
+  801e7d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e82:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+0000000000801e94 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+  801e98:	48 83 ec 10          	sub    $0x10,%rsp
+  801e9c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ea2:	48 98                	cltq
+  801ea4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea8:	6a 00                	push   $0x0
+  801eaa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ebb:	48 89 c2             	mov    %rax,%rdx
+  801ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec3:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ec8:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed8:	90                   	nop
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+0000000000801edb <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801edb:	55                   	push   %rbp
+  801edc:	48 89 e5             	mov    %rsp,%rbp
+  801edf:	48 83 ec 20          	sub    $0x20,%rsp
+  801ee3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801ee6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801eea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eed:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801ef0:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ef5:	cd 30                	int    $0x30
+  801ef7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801efb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801eff:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f04:	7e 3d                	jle    801f43 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f0a:	49 89 c0             	mov    %rax,%r8
+  801f0d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f12:	48 b8 68 55 80 00 00 	movabs $0x805568,%rax
+  801f19:	00 00 00 
+  801f1c:	48 89 c2             	mov    %rax,%rdx
+  801f1f:	be 49 00 00 00       	mov    $0x49,%esi
+  801f24:	48 b8 87 55 80 00 00 	movabs $0x805587,%rax
+  801f2b:	00 00 00 
+  801f2e:	48 89 c7             	mov    %rax,%rdi
+  801f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f36:	49 b9 6c 4b 80 00 00 	movabs $0x804b6c,%r9
+  801f3d:	00 00 00 
+  801f40:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f43:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f48:	75 13                	jne    801f5d <sys_env_wait+0x82>
+  801f4a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f4f:	74 0c                	je     801f5d <sys_env_wait+0x82>
+    *status = st;
+  801f51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f55:	89 c2                	mov    %eax,%edx
+  801f57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f5b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+0000000000801f63 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f63:	55                   	push   %rbp
+  801f64:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f67:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6b:	6a 00                	push   $0x0
+  801f6d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f83:	be 00 00 00 00       	mov    $0x0,%esi
+  801f88:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f8d:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+  801f99:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+
+0000000000801f9f <sys_yield>:
+
+void
+sys_yield(void) {
+  801f9f:	55                   	push   %rbp
+  801fa0:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801fa3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801faf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbf:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801fc9:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd9:	90                   	nop
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+
+0000000000801fdc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801fdc:	55                   	push   %rbp
+  801fdd:	48 89 e5             	mov    %rsp,%rbp
+  801fe0:	48 83 ec 20          	sub    $0x20,%rsp
+  801fe4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fe7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801feb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ff1:	48 63 c8             	movslq %eax,%rcx
+  801ff4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ff8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ffb:	48 98                	cltq
+  801ffd:	48 83 ec 08          	sub    $0x8,%rsp
+  802001:	6a 00                	push   $0x0
+  802003:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802009:	49 89 c8             	mov    %rcx,%r8
+  80200c:	48 89 d1             	mov    %rdx,%rcx
+  80200f:	48 89 c2             	mov    %rax,%rdx
+  802012:	be 01 00 00 00       	mov    $0x1,%esi
+  802017:	bf 06 00 00 00       	mov    $0x6,%edi
+  80201c:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802023:	00 00 00 
+  802026:	ff d0                	call   *%rax
+  802028:	48 83 c4 10          	add    $0x10,%rsp
+  80202c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80202f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+
+0000000000802034 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802034:	55                   	push   %rbp
+  802035:	48 89 e5             	mov    %rsp,%rbp
+  802038:	48 83 ec 20          	sub    $0x20,%rsp
+  80203c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80203f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802043:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802046:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80204a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80204e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802051:	48 63 c8             	movslq %eax,%rcx
+  802054:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802058:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80205b:	48 63 f0             	movslq %eax,%rsi
+  80205e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802062:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802065:	48 98                	cltq
+  802067:	48 83 ec 08          	sub    $0x8,%rsp
+  80206b:	51                   	push   %rcx
+  80206c:	49 89 f9             	mov    %rdi,%r9
+  80206f:	49 89 f0             	mov    %rsi,%r8
+  802072:	48 89 d1             	mov    %rdx,%rcx
+  802075:	48 89 c2             	mov    %rax,%rdx
+  802078:	be 01 00 00 00       	mov    $0x1,%esi
+  80207d:	bf 07 00 00 00       	mov    $0x7,%edi
+  802082:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802092:	c9                   	leave
+  802093:	c3                   	ret
+
+0000000000802094 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802094:	55                   	push   %rbp
+  802095:	48 89 e5             	mov    %rsp,%rbp
+  802098:	48 83 ec 10          	sub    $0x10,%rsp
+  80209c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80209f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8020a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020aa:	48 98                	cltq
+  8020ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020be:	48 89 d1             	mov    %rdx,%rcx
+  8020c1:	48 89 c2             	mov    %rax,%rdx
+  8020c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020ce:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020de:	c9                   	leave
+  8020df:	c3                   	ret
+
+00000000008020e0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8020e0:	55                   	push   %rbp
+  8020e1:	48 89 e5             	mov    %rsp,%rbp
+  8020e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020eb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020f1:	48 63 d0             	movslq %eax,%rdx
+  8020f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020f7:	48 98                	cltq
+  8020f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020fd:	6a 00                	push   $0x0
+  8020ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802105:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80210b:	48 89 d1             	mov    %rdx,%rcx
+  80210e:	48 89 c2             	mov    %rax,%rdx
+  802111:	be 01 00 00 00       	mov    $0x1,%esi
+  802116:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80211b:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802122:	00 00 00 
+  802125:	ff d0                	call   *%rax
+  802127:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80212b:	c9                   	leave
+  80212c:	c3                   	ret
+
+000000000080212d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+  802131:	48 83 ec 10          	sub    $0x10,%rsp
+  802135:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802138:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80213c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802140:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802143:	48 98                	cltq
+  802145:	48 83 ec 08          	sub    $0x8,%rsp
+  802149:	6a 00                	push   $0x0
+  80214b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802151:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802157:	48 89 d1             	mov    %rdx,%rcx
+  80215a:	48 89 c2             	mov    %rax,%rdx
+  80215d:	be 01 00 00 00       	mov    $0x1,%esi
+  802162:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802167:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+  802173:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+
+0000000000802179 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802179:	55                   	push   %rbp
+  80217a:	48 89 e5             	mov    %rsp,%rbp
+  80217d:	48 83 ec 10          	sub    $0x10,%rsp
+  802181:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802184:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802188:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80218c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80218f:	48 98                	cltq
+  802191:	48 83 ec 08          	sub    $0x8,%rsp
+  802195:	6a 00                	push   $0x0
+  802197:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a3:	48 89 d1             	mov    %rdx,%rcx
+  8021a6:	48 89 c2             	mov    %rax,%rdx
+  8021a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8021ae:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021b3:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c3:	c9                   	leave
+  8021c4:	c3                   	ret
+
+00000000008021c5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8021c5:	55                   	push   %rbp
+  8021c6:	48 89 e5             	mov    %rsp,%rbp
+  8021c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8021cd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021d4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021d8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8021db:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021de:	48 63 f0             	movslq %eax,%rsi
+  8021e1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021e5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021ec:	48 98                	cltq
+  8021ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f2:	6a 00                	push   $0x0
+  8021f4:	49 89 f1             	mov    %rsi,%r9
+  8021f7:	49 89 c8             	mov    %rcx,%r8
+  8021fa:	48 89 d1             	mov    %rdx,%rcx
+  8021fd:	48 89 c2             	mov    %rax,%rdx
+  802200:	be 00 00 00 00       	mov    $0x0,%esi
+  802205:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80220a:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+000000000080221c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+  802220:	48 83 ec 10          	sub    $0x10,%rsp
+  802224:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80222c:	48 83 ec 08          	sub    $0x8,%rsp
+  802230:	6a 00                	push   $0x0
+  802232:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802243:	48 89 c2             	mov    %rax,%rdx
+  802246:	be 01 00 00 00       	mov    $0x1,%esi
+  80224b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802250:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+  80225c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+
+0000000000802262 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802262:	55                   	push   %rbp
+  802263:	48 89 e5             	mov    %rsp,%rbp
+  802266:	48 83 ec 10          	sub    $0x10,%rsp
+  80226a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80226e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802272:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802276:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80227a:	48 83 ec 08          	sub    $0x8,%rsp
+  80227e:	6a 00                	push   $0x0
+  802280:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228c:	48 89 d1             	mov    %rdx,%rcx
+  80228f:	48 89 c2             	mov    %rax,%rdx
+  802292:	be 01 00 00 00       	mov    $0x1,%esi
+  802297:	bf 10 00 00 00       	mov    $0x10,%edi
+  80229c:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+  8022a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+00000000008022ae <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8022ae:	55                   	push   %rbp
+  8022af:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8022b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d3:	bf 11 00 00 00       	mov    $0x11,%edi
+  8022d8:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8022df:	00 00 00 
+  8022e2:	ff d0                	call   *%rax
+  8022e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e8:	c9                   	leave
+  8022e9:	c3                   	ret
+
+00000000008022ea <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022ea:	55                   	push   %rbp
+  8022eb:	48 89 e5             	mov    %rsp,%rbp
+  8022ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802302:	48 83 ec 08          	sub    $0x8,%rsp
+  802306:	6a 00                	push   $0x0
+  802308:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80230e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802314:	48 89 d1             	mov    %rdx,%rcx
+  802317:	48 89 c2             	mov    %rax,%rdx
+  80231a:	be 00 00 00 00       	mov    $0x0,%esi
+  80231f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802324:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+0000000000802336 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802336:	55                   	push   %rbp
+  802337:	48 89 e5             	mov    %rsp,%rbp
+  80233a:	48 83 ec 20          	sub    $0x20,%rsp
+  80233e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802342:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802346:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802349:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80234c:	48 63 c8             	movslq %eax,%rcx
+  80234f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802357:	48 83 ec 08          	sub    $0x8,%rsp
+  80235b:	6a 00                	push   $0x0
+  80235d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802363:	49 89 c8             	mov    %rcx,%r8
+  802366:	48 89 d1             	mov    %rdx,%rcx
+  802369:	48 89 c2             	mov    %rax,%rdx
+  80236c:	be 00 00 00 00       	mov    $0x0,%esi
+  802371:	bf 13 00 00 00       	mov    $0x13,%edi
+  802376:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  80237d:	00 00 00 
+  802380:	ff d0                	call   *%rax
+  802382:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+
+0000000000802388 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802388:	55                   	push   %rbp
+  802389:	48 89 e5             	mov    %rsp,%rbp
+  80238c:	48 83 ec 20          	sub    $0x20,%rsp
+  802390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802394:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802397:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80239b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80239f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8023a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023aa:	6a 00                	push   $0x0
+  8023ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b2:	49 89 c8             	mov    %rcx,%r8
+  8023b5:	48 89 d1             	mov    %rdx,%rcx
+  8023b8:	48 89 c2             	mov    %rax,%rdx
+  8023bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8023c5:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+  8023d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d5:	c9                   	leave
+  8023d6:	c3                   	ret
+
+00000000008023d7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8023d7:	55                   	push   %rbp
+  8023d8:	48 89 e5             	mov    %rsp,%rbp
+  8023db:	48 83 ec 10          	sub    $0x10,%rsp
+  8023df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8023e6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023e9:	48 63 d0             	movslq %eax,%rdx
+  8023ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802402:	48 89 d1             	mov    %rdx,%rcx
+  802405:	48 89 c2             	mov    %rax,%rdx
+  802408:	be 00 00 00 00       	mov    $0x0,%esi
+  80240d:	bf 15 00 00 00       	mov    $0x15,%edi
+  802412:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802419:	00 00 00 
+  80241c:	ff d0                	call   *%rax
+  80241e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+0000000000802424 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802424:	55                   	push   %rbp
+  802425:	48 89 e5             	mov    %rsp,%rbp
+  802428:	48 83 ec 20          	sub    $0x20,%rsp
+  80242c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802430:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802433:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802436:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80243a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80243e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802441:	48 63 c8             	movslq %eax,%rcx
+  802444:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802447:	48 63 d0             	movslq %eax,%rdx
+  80244a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80244e:	48 83 ec 08          	sub    $0x8,%rsp
+  802452:	6a 00                	push   $0x0
+  802454:	49 89 f1             	mov    %rsi,%r9
+  802457:	49 89 c8             	mov    %rcx,%r8
+  80245a:	48 89 d1             	mov    %rdx,%rcx
+  80245d:	48 89 c2             	mov    %rax,%rdx
+  802460:	be 00 00 00 00       	mov    $0x0,%esi
+  802465:	bf 16 00 00 00       	mov    $0x16,%edi
+  80246a:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+  802476:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+000000000080247c <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	48 83 ec 30          	sub    $0x30,%rsp
+  802484:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802488:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80248c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802490:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802494:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802498:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80249c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8024a0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b0:	51                   	push   %rcx
+  8024b1:	49 89 f9             	mov    %rdi,%r9
+  8024b4:	49 89 f0             	mov    %rsi,%r8
+  8024b7:	48 89 d1             	mov    %rdx,%rcx
+  8024ba:	48 89 c2             	mov    %rax,%rdx
+  8024bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c2:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024c7:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+00000000008024d9 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+  8024dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8024e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024e7:	48 98                	cltq
+  8024e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802500:	48 89 c2             	mov    %rax,%rdx
+  802503:	be 00 00 00 00       	mov    $0x0,%esi
+  802508:	bf 18 00 00 00       	mov    $0x18,%edi
+  80250d:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+  802519:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80251d:	90                   	nop
+  80251e:	c9                   	leave
+  80251f:	c3                   	ret
+
+0000000000802520 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802520:	55                   	push   %rbp
+  802521:	48 89 e5             	mov    %rsp,%rbp
+  802524:	48 83 ec 30          	sub    $0x30,%rsp
+  802528:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80252b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80252f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802533:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802536:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802539:	48 63 f0             	movslq %eax,%rsi
+  80253c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802540:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802544:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802547:	48 98                	cltq
+  802549:	48 83 ec 08          	sub    $0x8,%rsp
+  80254d:	6a 00                	push   $0x0
+  80254f:	49 89 f1             	mov    %rsi,%r9
+  802552:	49 89 c8             	mov    %rcx,%r8
+  802555:	48 89 d1             	mov    %rdx,%rcx
+  802558:	48 89 c2             	mov    %rax,%rdx
+  80255b:	be 01 00 00 00       	mov    $0x1,%esi
+  802560:	bf 19 00 00 00       	mov    $0x19,%edi
+  802565:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  80256c:	00 00 00 
+  80256f:	ff d0                	call   *%rax
+  802571:	48 83 c4 10          	add    $0x10,%rsp
+  802575:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802578:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+
+000000000080257d <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	48 83 ec 20          	sub    $0x20,%rsp
+  802585:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802589:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80258d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802590:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802593:	48 63 c8             	movslq %eax,%rcx
+  802596:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80259a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80259e:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025aa:	49 89 c8             	mov    %rcx,%r8
+  8025ad:	48 89 d1             	mov    %rdx,%rcx
+  8025b0:	48 89 c2             	mov    %rax,%rdx
+  8025b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8025b8:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8025bd:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+  8025c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025cd:	c9                   	leave
+  8025ce:	c3                   	ret
+
+00000000008025cf <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+  8025d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8025e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f3:	6a 00                	push   $0x0
+  8025f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025fb:	49 89 c8             	mov    %rcx,%r8
+  8025fe:	48 89 d1             	mov    %rdx,%rcx
+  802601:	48 89 c2             	mov    %rax,%rdx
+  802604:	be 01 00 00 00       	mov    $0x1,%esi
+  802609:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80260e:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  802615:	00 00 00 
+  802618:	ff d0                	call   *%rax
+  80261a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80261e:	c9                   	leave
+  80261f:	c3                   	ret
+
+0000000000802620 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+  802624:	48 83 ec 30          	sub    $0x30,%rsp
+  802628:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80262c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802630:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802633:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802637:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80263b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80263e:	48 63 c8             	movslq %eax,%rcx
+  802641:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802645:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802649:	48 83 ec 08          	sub    $0x8,%rsp
+  80264d:	6a 00                	push   $0x0
+  80264f:	49 89 f1             	mov    %rsi,%r9
+  802652:	49 89 c8             	mov    %rcx,%r8
+  802655:	48 89 d1             	mov    %rdx,%rcx
+  802658:	48 89 c2             	mov    %rax,%rdx
+  80265b:	be 01 00 00 00       	mov    $0x1,%esi
+  802660:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802665:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+  802671:	48 83 c4 10          	add    $0x10,%rsp
+  802675:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802678:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80267b:	c9                   	leave
+  80267c:	c3                   	ret
+
+000000000080267d <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	48 83 ec 10          	sub    $0x10,%rsp
+  802685:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802688:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80268b:	48 98                	cltq
+  80268d:	48 83 ec 08          	sub    $0x8,%rsp
+  802691:	6a 00                	push   $0x0
+  802693:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802699:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80269f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026a4:	48 89 c2             	mov    %rax,%rdx
+  8026a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ac:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8026b1:	48 b8 2c 1d 80 00 00 	movabs $0x801d2c,%rax
+  8026b8:	00 00 00 
+  8026bb:	ff d0                	call   *%rax
+  8026bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c1:	c9                   	leave
+  8026c2:	c3                   	ret
+
+00000000008026c3 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8026c3:	55                   	push   %rbp
+  8026c4:	48 89 e5             	mov    %rsp,%rbp
+  8026c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8026cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d3:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8026da:	ff ff ff 
+  8026dd:	48 01 d0             	add    %rdx,%rax
+  8026e0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026e4:	c9                   	leave
+  8026e5:	c3                   	ret
+
+00000000008026e6 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8026e6:	55                   	push   %rbp
+  8026e7:	48 89 e5             	mov    %rsp,%rbp
+  8026ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f6:	48 89 c7             	mov    %rax,%rdi
+  8026f9:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  802700:	00 00 00 
+  802703:	ff d0                	call   *%rax
+  802705:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80270b:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80270f:	c9                   	leave
+  802710:	c3                   	ret
+
+0000000000802711 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+  802715:	48 83 ec 18          	sub    $0x18,%rsp
+  802719:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80271d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802724:	e9 ae 00 00 00       	jmp    8027d7 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802729:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80272c:	c1 e0 0c             	shl    $0xc,%eax
+  80272f:	48 98                	cltq
+  802731:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802736:	48 01 d0             	add    %rdx,%rax
+  802739:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80273d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802741:	48 c1 e8 27          	shr    $0x27,%rax
+  802745:	48 89 c2             	mov    %rax,%rdx
+  802748:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80274f:	01 00 00 
+  802752:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802756:	83 e0 01             	and    $0x1,%eax
+  802759:	48 85 c0             	test   %rax,%rax
+  80275c:	74 63                	je     8027c1 <fd_alloc+0xb0>
+  80275e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802762:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802766:	48 89 c2             	mov    %rax,%rdx
+  802769:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802770:	01 00 00 
+  802773:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802777:	83 e0 01             	and    $0x1,%eax
+  80277a:	48 85 c0             	test   %rax,%rax
+  80277d:	74 42                	je     8027c1 <fd_alloc+0xb0>
+  80277f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802783:	48 c1 e8 15          	shr    $0x15,%rax
+  802787:	48 89 c2             	mov    %rax,%rdx
+  80278a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802791:	01 00 00 
+  802794:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802798:	83 e0 01             	and    $0x1,%eax
+  80279b:	48 85 c0             	test   %rax,%rax
+  80279e:	74 21                	je     8027c1 <fd_alloc+0xb0>
+  8027a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027a8:	48 89 c2             	mov    %rax,%rdx
+  8027ab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027b2:	01 00 00 
+  8027b5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027b9:	83 e0 01             	and    $0x1,%eax
+  8027bc:	48 85 c0             	test   %rax,%rax
+  8027bf:	75 12                	jne    8027d3 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8027c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027c9:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8027cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d1:	eb 1e                	jmp    8027f1 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8027d3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8027d7:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8027db:	0f 8e 48 ff ff ff    	jle    802729 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8027e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027e5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027ec:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027f1:	c9                   	leave
+  8027f2:	c3                   	ret
+
+00000000008027f3 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+  8027f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8027fb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802802:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802806:	78 06                	js     80280e <fd_lookup+0x1b>
+  802808:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80280c:	7e 0a                	jle    802818 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80280e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802813:	e9 af 00 00 00       	jmp    8028c7 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802818:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80281b:	c1 e0 0c             	shl    $0xc,%eax
+  80281e:	48 98                	cltq
+  802820:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802825:	48 01 d0             	add    %rdx,%rax
+  802828:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80282c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802830:	48 c1 e8 27          	shr    $0x27,%rax
+  802834:	48 89 c2             	mov    %rax,%rdx
+  802837:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80283e:	01 00 00 
+  802841:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802845:	83 e0 01             	and    $0x1,%eax
+  802848:	48 85 c0             	test   %rax,%rax
+  80284b:	74 63                	je     8028b0 <fd_lookup+0xbd>
+  80284d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802851:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802855:	48 89 c2             	mov    %rax,%rdx
+  802858:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80285f:	01 00 00 
+  802862:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802866:	83 e0 01             	and    $0x1,%eax
+  802869:	48 85 c0             	test   %rax,%rax
+  80286c:	74 42                	je     8028b0 <fd_lookup+0xbd>
+  80286e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802872:	48 c1 e8 15          	shr    $0x15,%rax
+  802876:	48 89 c2             	mov    %rax,%rdx
+  802879:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802880:	01 00 00 
+  802883:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802887:	83 e0 01             	and    $0x1,%eax
+  80288a:	48 85 c0             	test   %rax,%rax
+  80288d:	74 21                	je     8028b0 <fd_lookup+0xbd>
+  80288f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802893:	48 c1 e8 0c          	shr    $0xc,%rax
+  802897:	48 89 c2             	mov    %rax,%rdx
+  80289a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028a1:	01 00 00 
+  8028a4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028a8:	83 e0 01             	and    $0x1,%eax
+  8028ab:	48 85 c0             	test   %rax,%rax
+  8028ae:	75 07                	jne    8028b7 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8028b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b5:	eb 10                	jmp    8028c7 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8028b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028bf:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8028c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+
+00000000008028c9 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8028c9:	55                   	push   %rbp
+  8028ca:	48 89 e5             	mov    %rsp,%rbp
+  8028cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8028d1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028d5:	89 f0                	mov    %esi,%eax
+  8028d7:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8028da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028de:	48 89 c7             	mov    %rax,%rdi
+  8028e1:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+  8028ed:	89 c2                	mov    %eax,%edx
+  8028ef:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028f3:	48 89 c6             	mov    %rax,%rsi
+  8028f6:	89 d7                	mov    %edx,%edi
+  8028f8:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  8028ff:	00 00 00 
+  802902:	ff d0                	call   *%rax
+  802904:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802907:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80290b:	78 0a                	js     802917 <fd_close+0x4e>
+  80290d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802911:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802915:	74 12                	je     802929 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802917:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80291b:	74 05                	je     802922 <fd_close+0x59>
+  80291d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802920:	eb 70                	jmp    802992 <fd_close+0xc9>
+  802922:	b8 00 00 00 00       	mov    $0x0,%eax
+  802927:	eb 69                	jmp    802992 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802929:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80292d:	8b 00                	mov    (%rax),%eax
+  80292f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802933:	48 89 d6             	mov    %rdx,%rsi
+  802936:	89 c7                	mov    %eax,%edi
+  802938:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802947:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80294b:	78 2a                	js     802977 <fd_close+0xae>
+    if (dev->dev_close)
+  80294d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802951:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802955:	48 85 c0             	test   %rax,%rax
+  802958:	74 16                	je     802970 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80295a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80295e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802966:	48 89 c7             	mov    %rax,%rdi
+  802969:	ff d2                	call   *%rdx
+  80296b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80296e:	eb 07                	jmp    802977 <fd_close+0xae>
+    else
+      r = 0;
+  802970:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80297b:	48 89 c6             	mov    %rax,%rsi
+  80297e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802983:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+  return r;
+  80298f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+0000000000802994 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	48 83 ec 20          	sub    $0x20,%rsp
+  80299c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80299f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8029a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029aa:	eb 3f                	jmp    8029eb <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8029ac:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029b3:	00 00 00 
+  8029b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b9:	48 98                	cltq
+  8029bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029bf:	8b 00                	mov    (%rax),%eax
+  8029c1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8029c4:	75 21                	jne    8029e7 <dev_lookup+0x53>
+      *dev = devtab[i];
+  8029c6:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029cd:	00 00 00 
+  8029d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029d3:	48 98                	cltq
+  8029d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029dd:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8029e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e5:	eb 7f                	jmp    802a66 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029e7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029eb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029f2:	00 00 00 
+  8029f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029f8:	48 98                	cltq
+  8029fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029fe:	48 85 c0             	test   %rax,%rax
+  802a01:	75 a9                	jne    8029ac <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802a03:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802a0a:	00 00 00 
+  802a0d:	8b 40 04             	mov    0x4(%rax),%eax
+  802a10:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802a15:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802a1c:	00 00 00 
+  802a1f:	48 98                	cltq
+  802a21:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802a28:	48 01 d0             	add    %rdx,%rax
+  802a2b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802a31:	8b 00                	mov    (%rax),%eax
+  802a33:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802a36:	89 c6                	mov    %eax,%esi
+  802a38:	48 b8 98 55 80 00 00 	movabs $0x805598,%rax
+  802a3f:	00 00 00 
+  802a42:	48 89 c7             	mov    %rax,%rdi
+  802a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4a:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  802a51:	00 00 00 
+  802a54:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a5a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a66:	c9                   	leave
+  802a67:	c3                   	ret
+
+0000000000802a68 <close>:
+
+int
+close(int fdnum) {
+  802a68:	55                   	push   %rbp
+  802a69:	48 89 e5             	mov    %rsp,%rbp
+  802a6c:	48 83 ec 20          	sub    $0x20,%rsp
+  802a70:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a73:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a7a:	48 89 d6             	mov    %rdx,%rsi
+  802a7d:	89 c7                	mov    %eax,%edi
+  802a7f:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  802a86:	00 00 00 
+  802a89:	ff d0                	call   *%rax
+  802a8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a8e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a92:	79 05                	jns    802a99 <close+0x31>
+    return r;
+  802a94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a97:	eb 18                	jmp    802ab1 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a9d:	be 01 00 00 00       	mov    $0x1,%esi
+  802aa2:	48 89 c7             	mov    %rax,%rdi
+  802aa5:	48 b8 c9 28 80 00 00 	movabs $0x8028c9,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+}
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+
+0000000000802ab3 <close_all>:
+
+void
+close_all(void) {
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+  802ab7:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802abb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ac2:	eb 15                	jmp    802ad9 <close_all+0x26>
+    close(i);
+  802ac4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ac7:	89 c7                	mov    %eax,%edi
+  802ac9:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802ad5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ad9:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802add:	7e e5                	jle    802ac4 <close_all+0x11>
+}
+  802adf:	90                   	nop
+  802ae0:	90                   	nop
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+
+0000000000802ae3 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	48 83 ec 40          	sub    $0x40,%rsp
+  802aeb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802aee:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802af1:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802af5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802af8:	48 89 d6             	mov    %rdx,%rsi
+  802afb:	89 c7                	mov    %eax,%edi
+  802afd:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+  802b09:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b0c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b10:	79 08                	jns    802b1a <dup+0x37>
+    return r;
+  802b12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b15:	e9 33 02 00 00       	jmp    802d4d <dup+0x26a>
+  close(newfdnum);
+  802b1a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b1d:	89 c7                	mov    %eax,%edi
+  802b1f:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  802b26:	00 00 00 
+  802b29:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802b2b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b2e:	c1 e0 0c             	shl    $0xc,%eax
+  802b31:	48 98                	cltq
+  802b33:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b38:	48 01 d0             	add    %rdx,%rax
+  802b3b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802b3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b43:	48 89 c7             	mov    %rax,%rdi
+  802b46:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  802b4d:	00 00 00 
+  802b50:	ff d0                	call   *%rax
+  802b52:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b5a:	48 89 c7             	mov    %rax,%rdi
+  802b5d:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  802b64:	00 00 00 
+  802b67:	ff d0                	call   *%rax
+  802b69:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b6d:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b74:	00 
+  802b75:	e9 19 01 00 00       	jmp    802c93 <dup+0x1b0>
+    off -= PGSIZE;
+  802b7a:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b81:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b82:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b8a:	48 01 d0             	add    %rdx,%rax
+  802b8d:	48 c1 e8 27          	shr    $0x27,%rax
+  802b91:	48 89 c2             	mov    %rax,%rdx
+  802b94:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b9b:	01 00 00 
+  802b9e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ba2:	83 e0 01             	and    $0x1,%eax
+  802ba5:	48 85 c0             	test   %rax,%rax
+  802ba8:	0f 84 e5 00 00 00    	je     802c93 <dup+0x1b0>
+  802bae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bb6:	48 01 d0             	add    %rdx,%rax
+  802bb9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bbd:	48 89 c2             	mov    %rax,%rdx
+  802bc0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802bc7:	01 00 00 
+  802bca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bce:	83 e0 01             	and    $0x1,%eax
+  802bd1:	48 85 c0             	test   %rax,%rax
+  802bd4:	0f 84 b9 00 00 00    	je     802c93 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bda:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802be2:	48 01 d0             	add    %rdx,%rax
+  802be5:	48 c1 e8 15          	shr    $0x15,%rax
+  802be9:	48 89 c2             	mov    %rax,%rdx
+  802bec:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bf3:	01 00 00 
+  802bf6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bfa:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bfd:	48 85 c0             	test   %rax,%rax
+  802c00:	0f 84 8d 00 00 00    	je     802c93 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802c06:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c0e:	48 01 d0             	add    %rdx,%rax
+  802c11:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c15:	48 89 c2             	mov    %rax,%rdx
+  802c18:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c1f:	01 00 00 
+  802c22:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c26:	83 e0 01             	and    $0x1,%eax
+  802c29:	48 85 c0             	test   %rax,%rax
+  802c2c:	74 65                	je     802c93 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802c2e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c36:	48 01 d0             	add    %rdx,%rax
+  802c39:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c3d:	48 89 c2             	mov    %rax,%rdx
+  802c40:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c47:	01 00 00 
+  802c4a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c4e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c53:	89 c6                	mov    %eax,%esi
+  802c55:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5d:	48 01 c2             	add    %rax,%rdx
+  802c60:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c68:	48 01 c8             	add    %rcx,%rax
+  802c6b:	41 89 f0             	mov    %esi,%r8d
+  802c6e:	48 89 d1             	mov    %rdx,%rcx
+  802c71:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c76:	48 89 c6             	mov    %rax,%rsi
+  802c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7e:	48 b8 34 20 80 00 00 	movabs $0x802034,%rax
+  802c85:	00 00 00 
+  802c88:	ff d0                	call   *%rax
+  802c8a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c91:	78 60                	js     802cf3 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c93:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c98:	0f 85 dc fe ff ff    	jne    802b7a <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ca2:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ca6:	48 89 c2             	mov    %rax,%rdx
+  802ca9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cb0:	01 00 00 
+  802cb3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cb7:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cbc:	89 c1                	mov    %eax,%ecx
+  802cbe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cc2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802cc6:	41 89 c8             	mov    %ecx,%r8d
+  802cc9:	48 89 d1             	mov    %rdx,%rcx
+  802ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd1:	48 89 c6             	mov    %rax,%rsi
+  802cd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd9:	48 b8 34 20 80 00 00 	movabs $0x802034,%rax
+  802ce0:	00 00 00 
+  802ce3:	ff d0                	call   *%rax
+  802ce5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ce8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cec:	78 08                	js     802cf6 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802cee:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cf1:	eb 5a                	jmp    802d4d <dup+0x26a>
+        goto err;
+  802cf3:	90                   	nop
+  802cf4:	eb 01                	jmp    802cf7 <dup+0x214>
+    goto err;
+  802cf6:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cf7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cfb:	48 89 c6             	mov    %rax,%rsi
+  802cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d03:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802d0f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802d16:	00 
+  802d17:	eb 27                	jmp    802d40 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802d19:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d21:	48 01 d0             	add    %rdx,%rax
+  802d24:	48 89 c6             	mov    %rax,%rsi
+  802d27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2c:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802d38:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802d3f:	00 
+  802d40:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d47:	00 
+  802d48:	76 cf                	jbe    802d19 <dup+0x236>
+  return r;
+  802d4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+
+0000000000802d4f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d4f:	55                   	push   %rbp
+  802d50:	48 89 e5             	mov    %rsp,%rbp
+  802d53:	48 83 ec 40          	sub    $0x40,%rsp
+  802d57:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d5a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d5e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d62:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d69:	48 89 d6             	mov    %rdx,%rsi
+  802d6c:	89 c7                	mov    %eax,%edi
+  802d6e:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+  802d7a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d7d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d81:	78 24                	js     802da7 <read+0x58>
+  802d83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d87:	8b 00                	mov    (%rax),%eax
+  802d89:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d8d:	48 89 d6             	mov    %rdx,%rsi
+  802d90:	89 c7                	mov    %eax,%edi
+  802d92:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+  802d9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802da1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802da5:	79 0a                	jns    802db1 <read+0x62>
+    return r;
+  802da7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802daa:	48 98                	cltq
+  802dac:	e9 9e 00 00 00       	jmp    802e4f <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802db1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802db5:	8b 40 08             	mov    0x8(%rax),%eax
+  802db8:	83 e0 03             	and    $0x3,%eax
+  802dbb:	83 f8 01             	cmp    $0x1,%eax
+  802dbe:	75 5c                	jne    802e1c <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802dc0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802dc7:	00 00 00 
+  802dca:	8b 40 04             	mov    0x4(%rax),%eax
+  802dcd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802dd2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802dd9:	00 00 00 
+  802ddc:	48 98                	cltq
+  802dde:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802de5:	48 01 d0             	add    %rdx,%rax
+  802de8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802dee:	8b 00                	mov    (%rax),%eax
+  802df0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802df3:	89 c6                	mov    %eax,%esi
+  802df5:	48 b8 b7 55 80 00 00 	movabs $0x8055b7,%rax
+  802dfc:	00 00 00 
+  802dff:	48 89 c7             	mov    %rax,%rdi
+  802e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e07:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  802e0e:	00 00 00 
+  802e11:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802e13:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802e1a:	eb 33                	jmp    802e4f <read+0x100>
+  }
+  if (!dev->dev_read)
+  802e1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e20:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e24:	48 85 c0             	test   %rax,%rax
+  802e27:	75 09                	jne    802e32 <read+0xe3>
+    return -E_NOT_SUPP;
+  802e29:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802e30:	eb 1d                	jmp    802e4f <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802e32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e36:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802e3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e3e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e42:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e46:	48 89 ce             	mov    %rcx,%rsi
+  802e49:	48 89 c7             	mov    %rax,%rdi
+  802e4c:	41 ff d0             	call   *%r8
+}
+  802e4f:	c9                   	leave
+  802e50:	c3                   	ret
+
+0000000000802e51 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e51:	55                   	push   %rbp
+  802e52:	48 89 e5             	mov    %rsp,%rbp
+  802e55:	48 83 ec 30          	sub    $0x30,%rsp
+  802e59:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e5c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e60:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e6b:	eb 49                	jmp    802eb6 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e70:	48 98                	cltq
+  802e72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e76:	48 29 c2             	sub    %rax,%rdx
+  802e79:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e7c:	48 63 c8             	movslq %eax,%rcx
+  802e7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e83:	48 01 c1             	add    %rax,%rcx
+  802e86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e89:	48 89 ce             	mov    %rcx,%rsi
+  802e8c:	89 c7                	mov    %eax,%edi
+  802e8e:	48 b8 4f 2d 80 00 00 	movabs $0x802d4f,%rax
+  802e95:	00 00 00 
+  802e98:	ff d0                	call   *%rax
+  802e9a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e9d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802ea1:	79 07                	jns    802eaa <readn+0x59>
+      return m;
+  802ea3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802ea6:	48 98                	cltq
+  802ea8:	eb 1f                	jmp    802ec9 <readn+0x78>
+    if (m == 0)
+  802eaa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802eae:	74 13                	je     802ec3 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802eb0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802eb3:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802eb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eb9:	48 98                	cltq
+  802ebb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802ebf:	72 ac                	jb     802e6d <readn+0x1c>
+  802ec1:	eb 01                	jmp    802ec4 <readn+0x73>
+      break;
+  802ec3:	90                   	nop
+  }
+  return tot;
+  802ec4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ec7:	48 98                	cltq
+}
+  802ec9:	c9                   	leave
+  802eca:	c3                   	ret
+
+0000000000802ecb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802ecb:	55                   	push   %rbp
+  802ecc:	48 89 e5             	mov    %rsp,%rbp
+  802ecf:	48 83 ec 40          	sub    $0x40,%rsp
+  802ed3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ed6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802eda:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ede:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ee2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ee5:	48 89 d6             	mov    %rdx,%rsi
+  802ee8:	89 c7                	mov    %eax,%edi
+  802eea:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  802ef1:	00 00 00 
+  802ef4:	ff d0                	call   *%rax
+  802ef6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ef9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802efd:	78 24                	js     802f23 <write+0x58>
+  802eff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f03:	8b 00                	mov    (%rax),%eax
+  802f05:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f09:	48 89 d6             	mov    %rdx,%rsi
+  802f0c:	89 c7                	mov    %eax,%edi
+  802f0e:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+  802f1a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f21:	79 0a                	jns    802f2d <write+0x62>
+    return r;
+  802f23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f26:	48 98                	cltq
+  802f28:	e9 9d 00 00 00       	jmp    802fca <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f31:	8b 40 08             	mov    0x8(%rax),%eax
+  802f34:	83 e0 03             	and    $0x3,%eax
+  802f37:	85 c0                	test   %eax,%eax
+  802f39:	75 5c                	jne    802f97 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f3b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f42:	00 00 00 
+  802f45:	8b 40 04             	mov    0x4(%rax),%eax
+  802f48:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f4d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f54:	00 00 00 
+  802f57:	48 98                	cltq
+  802f59:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f60:	48 01 d0             	add    %rdx,%rax
+  802f63:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f69:	8b 00                	mov    (%rax),%eax
+  802f6b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f6e:	89 c6                	mov    %eax,%esi
+  802f70:	48 b8 d3 55 80 00 00 	movabs $0x8055d3,%rax
+  802f77:	00 00 00 
+  802f7a:	48 89 c7             	mov    %rax,%rdi
+  802f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f82:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  802f89:	00 00 00 
+  802f8c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f8e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f95:	eb 33                	jmp    802fca <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f9b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f9f:	48 85 c0             	test   %rax,%rax
+  802fa2:	75 09                	jne    802fad <write+0xe2>
+    return -E_NOT_SUPP;
+  802fa4:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802fab:	eb 1d                	jmp    802fca <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802fad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb1:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fb9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fbd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802fc1:	48 89 ce             	mov    %rcx,%rsi
+  802fc4:	48 89 c7             	mov    %rax,%rdi
+  802fc7:	41 ff d0             	call   *%r8
+}
+  802fca:	c9                   	leave
+  802fcb:	c3                   	ret
+
+0000000000802fcc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802fcc:	55                   	push   %rbp
+  802fcd:	48 89 e5             	mov    %rsp,%rbp
+  802fd0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fd4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fd7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fda:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fe1:	48 89 d6             	mov    %rdx,%rsi
+  802fe4:	89 c7                	mov    %eax,%edi
+  802fe6:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+  802ff2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ff9:	79 05                	jns    803000 <seek+0x34>
+    return r;
+  802ffb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ffe:	eb 0f                	jmp    80300f <seek+0x43>
+  fd->fd_offset = offset;
+  803000:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803004:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803007:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80300a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80300f:	c9                   	leave
+  803010:	c3                   	ret
+
+0000000000803011 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803011:	55                   	push   %rbp
+  803012:	48 89 e5             	mov    %rsp,%rbp
+  803015:	48 83 ec 30          	sub    $0x30,%rsp
+  803019:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80301c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80301f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803023:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803026:	48 89 d6             	mov    %rdx,%rsi
+  803029:	89 c7                	mov    %eax,%edi
+  80302b:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+  803037:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80303a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80303e:	78 24                	js     803064 <ftruncate+0x53>
+  803040:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803044:	8b 00                	mov    (%rax),%eax
+  803046:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80304a:	48 89 d6             	mov    %rdx,%rsi
+  80304d:	89 c7                	mov    %eax,%edi
+  80304f:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  803056:	00 00 00 
+  803059:	ff d0                	call   *%rax
+  80305b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80305e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803062:	79 08                	jns    80306c <ftruncate+0x5b>
+    return r;
+  803064:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803067:	e9 92 00 00 00       	jmp    8030fe <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80306c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803070:	8b 40 08             	mov    0x8(%rax),%eax
+  803073:	83 e0 03             	and    $0x3,%eax
+  803076:	85 c0                	test   %eax,%eax
+  803078:	75 5a                	jne    8030d4 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80307a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803081:	00 00 00 
+  803084:	8b 40 04             	mov    0x4(%rax),%eax
+  803087:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80308c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803093:	00 00 00 
+  803096:	48 98                	cltq
+  803098:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80309f:	48 01 d0             	add    %rdx,%rax
+  8030a2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8030a8:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8030aa:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030ad:	89 c6                	mov    %eax,%esi
+  8030af:	48 b8 f0 55 80 00 00 	movabs $0x8055f0,%rax
+  8030b6:	00 00 00 
+  8030b9:	48 89 c7             	mov    %rax,%rdi
+  8030bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c1:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  8030c8:	00 00 00 
+  8030cb:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8030cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030d2:	eb 2a                	jmp    8030fe <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8030d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8030dc:	48 85 c0             	test   %rax,%rax
+  8030df:	75 07                	jne    8030e8 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8030e1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8030e6:	eb 16                	jmp    8030fe <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ec:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030f7:	89 d6                	mov    %edx,%esi
+  8030f9:	48 89 c7             	mov    %rax,%rdi
+  8030fc:	ff d1                	call   *%rcx
+}
+  8030fe:	c9                   	leave
+  8030ff:	c3                   	ret
+
+0000000000803100 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803100:	55                   	push   %rbp
+  803101:	48 89 e5             	mov    %rsp,%rbp
+  803104:	48 83 ec 30          	sub    $0x30,%rsp
+  803108:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80310b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80310f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803113:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803116:	48 89 d6             	mov    %rdx,%rsi
+  803119:	89 c7                	mov    %eax,%edi
+  80311b:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+  803127:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80312a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80312e:	78 24                	js     803154 <fstat+0x54>
+  803130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803134:	8b 00                	mov    (%rax),%eax
+  803136:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80313a:	48 89 d6             	mov    %rdx,%rsi
+  80313d:	89 c7                	mov    %eax,%edi
+  80313f:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80314e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803152:	79 05                	jns    803159 <fstat+0x59>
+    return r;
+  803154:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803157:	eb 5e                	jmp    8031b7 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803159:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80315d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803161:	48 85 c0             	test   %rax,%rax
+  803164:	75 07                	jne    80316d <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803166:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80316b:	eb 4a                	jmp    8031b7 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80316d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803171:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803174:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803178:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80317f:	00 00 00 
+  stat->st_isdir   = 0;
+  803182:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803186:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80318d:	00 00 00 
+  stat->st_dev     = dev;
+  803190:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803194:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803198:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80319f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031a3:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8031a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ab:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031af:	48 89 d6             	mov    %rdx,%rsi
+  8031b2:	48 89 c7             	mov    %rax,%rdi
+  8031b5:	ff d1                	call   *%rcx
+}
+  8031b7:	c9                   	leave
+  8031b8:	c3                   	ret
+
+00000000008031b9 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8031b9:	55                   	push   %rbp
+  8031ba:	48 89 e5             	mov    %rsp,%rbp
+  8031bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8031c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8031c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8031c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031cd:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031d3:	83 f8 20             	cmp    $0x20,%eax
+  8031d6:	75 07                	jne    8031df <pollwait_key+0x26>
+    return -E_INVAL;
+  8031d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031dd:	eb 5f                	jmp    80323e <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8031df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031e3:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ed:	48 63 d2             	movslq %edx,%rdx
+  8031f0:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031f4:	48 01 c2             	add    %rax,%rdx
+  8031f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031fb:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803202:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803208:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80320c:	8b 00                	mov    (%rax),%eax
+  80320e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803212:	48 63 c9             	movslq %ecx,%rcx
+  803215:	48 c1 e1 04          	shl    $0x4,%rcx
+  803219:	48 01 ca             	add    %rcx,%rdx
+  80321c:	48 83 c2 08          	add    $0x8,%rdx
+  803220:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803222:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803226:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80322c:	8d 50 01             	lea    0x1(%rax),%edx
+  80322f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803233:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803239:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80323e:	c9                   	leave
+  80323f:	c3                   	ret
+
+0000000000803240 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803240:	55                   	push   %rbp
+  803241:	48 89 e5             	mov    %rsp,%rbp
+  803244:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80324b:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803252:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803258:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80325f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803266:	00 
+  int i, r, ready, ipc = 0;
+  803267:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80326e:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803275:	00 
+  803276:	74 45                	je     8032bd <poll+0x7d>
+  803278:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80327f:	ff 
+  803280:	74 3b                	je     8032bd <poll+0x7d>
+    now      = vsys_clock_ns();
+  803282:	48 b8 7b 47 80 00 00 	movabs $0x80477b,%rax
+  803289:	00 00 00 
+  80328c:	ff d0                	call   *%rax
+  80328e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803292:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803296:	48 f7 d0             	not    %rax
+  803299:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8032a0:	73 10                	jae    8032b2 <poll+0x72>
+  8032a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8032a6:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8032ad:	48 01 d0             	add    %rdx,%rax
+  8032b0:	eb 07                	jmp    8032b9 <poll+0x79>
+  8032b2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8032b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8032bd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8032c4:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8032cb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8032d2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8032d9:	e9 46 02 00 00       	jmp    803524 <poll+0x2e4>
+      fds[i].revents = 0;
+  8032de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032e1:	48 63 d0             	movslq %eax,%rdx
+  8032e4:	48 89 d0             	mov    %rdx,%rax
+  8032e7:	48 01 c0             	add    %rax,%rax
+  8032ea:	48 01 d0             	add    %rdx,%rax
+  8032ed:	48 c1 e0 02          	shl    $0x2,%rax
+  8032f1:	48 89 c2             	mov    %rax,%rdx
+  8032f4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032fb:	48 01 d0             	add    %rdx,%rax
+  8032fe:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803305:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803308:	48 63 d0             	movslq %eax,%rdx
+  80330b:	48 89 d0             	mov    %rdx,%rax
+  80330e:	48 01 c0             	add    %rax,%rax
+  803311:	48 01 d0             	add    %rdx,%rax
+  803314:	48 c1 e0 02          	shl    $0x2,%rax
+  803318:	48 89 c2             	mov    %rax,%rdx
+  80331b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803322:	48 01 d0             	add    %rdx,%rax
+  803325:	8b 00                	mov    (%rax),%eax
+  803327:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80332a:	75 62                	jne    80338e <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80332c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80332f:	48 63 d0             	movslq %eax,%rdx
+  803332:	48 89 d0             	mov    %rdx,%rax
+  803335:	48 01 c0             	add    %rax,%rax
+  803338:	48 01 d0             	add    %rdx,%rax
+  80333b:	48 c1 e0 02          	shl    $0x2,%rax
+  80333f:	48 89 c2             	mov    %rax,%rdx
+  803342:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803349:	48 01 d0             	add    %rdx,%rax
+  80334c:	8b 40 04             	mov    0x4(%rax),%eax
+  80334f:	83 e0 01             	and    $0x1,%eax
+  803352:	85 c0                	test   %eax,%eax
+  803354:	0f 84 9b 01 00 00    	je     8034f5 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80335a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80335d:	48 63 d0             	movslq %eax,%rdx
+  803360:	48 89 d0             	mov    %rdx,%rax
+  803363:	48 01 c0             	add    %rax,%rax
+  803366:	48 01 d0             	add    %rdx,%rax
+  803369:	48 c1 e0 02          	shl    $0x2,%rax
+  80336d:	48 89 c2             	mov    %rax,%rdx
+  803370:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803377:	48 01 c2             	add    %rax,%rdx
+  80337a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80337d:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803380:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803383:	83 c8 04             	or     $0x4,%eax
+  803386:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803389:	e9 67 01 00 00       	jmp    8034f5 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80338e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803391:	48 63 d0             	movslq %eax,%rdx
+  803394:	48 89 d0             	mov    %rdx,%rax
+  803397:	48 01 c0             	add    %rax,%rax
+  80339a:	48 01 d0             	add    %rdx,%rax
+  80339d:	48 c1 e0 02          	shl    $0x2,%rax
+  8033a1:	48 89 c2             	mov    %rax,%rdx
+  8033a4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033ab:	48 01 d0             	add    %rdx,%rax
+  8033ae:	8b 00                	mov    (%rax),%eax
+  8033b0:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8033b7:	48 89 d6             	mov    %rdx,%rsi
+  8033ba:	89 c7                	mov    %eax,%edi
+  8033bc:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  8033c3:	00 00 00 
+  8033c6:	ff d0                	call   *%rax
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	78 25                	js     8033f1 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8033cc:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8033d3:	8b 00                	mov    (%rax),%eax
+  8033d5:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8033dc:	48 89 d6             	mov    %rdx,%rsi
+  8033df:	89 c7                	mov    %eax,%edi
+  8033e1:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  8033e8:	00 00 00 
+  8033eb:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	79 2c                	jns    80341d <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033f4:	48 63 d0             	movslq %eax,%rdx
+  8033f7:	48 89 d0             	mov    %rdx,%rax
+  8033fa:	48 01 c0             	add    %rax,%rax
+  8033fd:	48 01 d0             	add    %rdx,%rax
+  803400:	48 c1 e0 02          	shl    $0x2,%rax
+  803404:	48 89 c2             	mov    %rax,%rdx
+  803407:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80340e:	48 01 d0             	add    %rdx,%rax
+  803411:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803418:	e9 d8 00 00 00       	jmp    8034f5 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80341d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803424:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803428:	48 85 c0             	test   %rax,%rax
+  80342b:	74 7d                	je     8034aa <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80342d:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803434:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803438:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80343b:	48 63 d0             	movslq %eax,%rdx
+  80343e:	48 89 d0             	mov    %rdx,%rax
+  803441:	48 01 c0             	add    %rax,%rax
+  803444:	48 01 d0             	add    %rdx,%rax
+  803447:	48 c1 e0 02          	shl    $0x2,%rax
+  80344b:	48 89 c2             	mov    %rax,%rdx
+  80344e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803455:	48 01 d0             	add    %rdx,%rax
+  803458:	8b 48 04             	mov    0x4(%rax),%ecx
+  80345b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803462:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803469:	89 ce                	mov    %ecx,%esi
+  80346b:	48 89 c7             	mov    %rax,%rdi
+  80346e:	41 ff d0             	call   *%r8
+  803471:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803474:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803478:	79 08                	jns    803482 <poll+0x242>
+          return r;
+  80347a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80347d:	e9 45 01 00 00       	jmp    8035c7 <poll+0x387>
+        fds[i].revents = r;
+  803482:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803485:	48 63 d0             	movslq %eax,%rdx
+  803488:	48 89 d0             	mov    %rdx,%rax
+  80348b:	48 01 c0             	add    %rax,%rax
+  80348e:	48 01 d0             	add    %rdx,%rax
+  803491:	48 c1 e0 02          	shl    $0x2,%rax
+  803495:	48 89 c2             	mov    %rax,%rdx
+  803498:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80349f:	48 01 c2             	add    %rax,%rdx
+  8034a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034a5:	89 42 08             	mov    %eax,0x8(%rdx)
+  8034a8:	eb 4b                	jmp    8034f5 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8034aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034ad:	48 63 d0             	movslq %eax,%rdx
+  8034b0:	48 89 d0             	mov    %rdx,%rax
+  8034b3:	48 01 c0             	add    %rax,%rax
+  8034b6:	48 01 d0             	add    %rdx,%rax
+  8034b9:	48 c1 e0 02          	shl    $0x2,%rax
+  8034bd:	48 89 c2             	mov    %rax,%rdx
+  8034c0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034c7:	48 01 d0             	add    %rdx,%rax
+  8034ca:	8b 48 04             	mov    0x4(%rax),%ecx
+  8034cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034d0:	48 63 d0             	movslq %eax,%rdx
+  8034d3:	48 89 d0             	mov    %rdx,%rax
+  8034d6:	48 01 c0             	add    %rax,%rax
+  8034d9:	48 01 d0             	add    %rdx,%rax
+  8034dc:	48 c1 e0 02          	shl    $0x2,%rax
+  8034e0:	48 89 c2             	mov    %rax,%rdx
+  8034e3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034ea:	48 01 d0             	add    %rdx,%rax
+  8034ed:	83 e1 03             	and    $0x3,%ecx
+  8034f0:	89 ca                	mov    %ecx,%edx
+  8034f2:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034f8:	48 63 d0             	movslq %eax,%rdx
+  8034fb:	48 89 d0             	mov    %rdx,%rax
+  8034fe:	48 01 c0             	add    %rax,%rax
+  803501:	48 01 d0             	add    %rdx,%rax
+  803504:	48 c1 e0 02          	shl    $0x2,%rax
+  803508:	48 89 c2             	mov    %rax,%rdx
+  80350b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803512:	48 01 d0             	add    %rdx,%rax
+  803515:	8b 40 08             	mov    0x8(%rax),%eax
+  803518:	85 c0                	test   %eax,%eax
+  80351a:	74 04                	je     803520 <poll+0x2e0>
+        ready++;
+  80351c:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803520:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803524:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803527:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80352d:	0f 8c ab fd ff ff    	jl     8032de <poll+0x9e>
+    }
+    if (ready)
+  803533:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803537:	74 08                	je     803541 <poll+0x301>
+      return ready;
+  803539:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80353c:	e9 86 00 00 00       	jmp    8035c7 <poll+0x387>
+
+    if (deadline) {
+  803541:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803546:	74 30                	je     803578 <poll+0x338>
+      now     = vsys_clock_ns();
+  803548:	48 b8 7b 47 80 00 00 	movabs $0x80477b,%rax
+  80354f:	00 00 00 
+  803552:	ff d0                	call   *%rax
+  803554:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803558:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80355c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803560:	73 0a                	jae    80356c <poll+0x32c>
+  803562:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803566:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80356a:	eb 05                	jmp    803571 <poll+0x331>
+  80356c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803571:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803578:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80357b:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80357e:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803585:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80358c:	48 89 c7             	mov    %rax,%rdi
+  80358f:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+  80359b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80359e:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8035a2:	75 07                	jne    8035ab <poll+0x36b>
+      return 0;
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	eb 1c                	jmp    8035c7 <poll+0x387>
+    if (r < 0)
+  8035ab:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035af:	79 05                	jns    8035b6 <poll+0x376>
+      return r;
+  8035b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035b4:	eb 11                	jmp    8035c7 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8035b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035b9:	c1 f8 02             	sar    $0x2,%eax
+  8035bc:	83 e0 01             	and    $0x1,%eax
+  8035bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8035c2:	e9 f6 fc ff ff       	jmp    8032bd <poll+0x7d>
+  }
+}
+  8035c7:	c9                   	leave
+  8035c8:	c3                   	ret
+
+00000000008035c9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8035c9:	55                   	push   %rbp
+  8035ca:	48 89 e5             	mov    %rsp,%rbp
+  8035cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8035d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8035d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e2:	48 89 c7             	mov    %rax,%rdi
+  8035e5:	48 b8 b7 36 80 00 00 	movabs $0x8036b7,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+  8035f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035f4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035f8:	79 05                	jns    8035ff <stat+0x36>
+    return fd;
+  8035fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035fd:	eb 2f                	jmp    80362e <stat+0x65>
+  r = fstat(fd, stat);
+  8035ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803603:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803606:	48 89 d6             	mov    %rdx,%rsi
+  803609:	89 c7                	mov    %eax,%edi
+  80360b:	48 b8 00 31 80 00 00 	movabs $0x803100,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+  803617:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80361a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80361d:	89 c7                	mov    %eax,%edi
+  80361f:	48 b8 68 2a 80 00 00 	movabs $0x802a68,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+  return r;
+  80362b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80362e:	c9                   	leave
+  80362f:	c3                   	ret
+
+0000000000803630 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803630:	55                   	push   %rbp
+  803631:	48 89 e5             	mov    %rsp,%rbp
+  803634:	48 83 ec 10          	sub    $0x10,%rsp
+  803638:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80363b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80363f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803646:	00 00 00 
+  803649:	8b 00                	mov    (%rax),%eax
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	75 1d                	jne    80366c <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80364f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803654:	48 b8 b0 4e 80 00 00 	movabs $0x804eb0,%rax
+  80365b:	00 00 00 
+  80365e:	ff d0                	call   *%rax
+  803660:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803667:	00 00 00 
+  80366a:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80366c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803673:	00 00 00 
+  803676:	8b 00                	mov    (%rax),%eax
+  803678:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80367b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803680:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803687:	00 00 00 
+  80368a:	89 c7                	mov    %eax,%edi
+  80368c:	48 b8 03 4e 80 00 00 	movabs $0x804e03,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803698:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80369c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036a1:	48 89 c6             	mov    %rax,%rsi
+  8036a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a9:	48 b8 86 4c 80 00 00 	movabs $0x804c86,%rax
+  8036b0:	00 00 00 
+  8036b3:	ff d0                	call   *%rax
+}
+  8036b5:	c9                   	leave
+  8036b6:	c3                   	ret
+
+00000000008036b7 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8036b7:	55                   	push   %rbp
+  8036b8:	48 89 e5             	mov    %rsp,%rbp
+  8036bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8036bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8036c3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8036c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ca:	48 89 c7             	mov    %rax,%rdi
+  8036cd:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  8036d4:	00 00 00 
+  8036d7:	ff d0                	call   *%rax
+  8036d9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8036de:	7e 0a                	jle    8036ea <open+0x33>
+    return -E_BAD_PATH;
+  8036e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036e5:	e9 a8 00 00 00       	jmp    803792 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036ea:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036ee:	48 89 c7             	mov    %rax,%rdi
+  8036f1:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  8036f8:	00 00 00 
+  8036fb:	ff d0                	call   *%rax
+  8036fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803700:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803704:	79 08                	jns    80370e <open+0x57>
+    return r;
+  803706:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803709:	e9 84 00 00 00       	jmp    803792 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80370e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803712:	48 89 c6             	mov    %rax,%rsi
+  803715:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80371c:	00 00 00 
+  80371f:	48 89 c7             	mov    %rax,%rdi
+  803722:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  803729:	00 00 00 
+  80372c:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80372e:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803735:	00 00 00 
+  803738:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80373b:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803745:	48 89 c6             	mov    %rax,%rsi
+  803748:	bf 01 00 00 00       	mov    $0x1,%edi
+  80374d:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+  803759:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80375c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803760:	79 1d                	jns    80377f <open+0xc8>
+    fd_close(fd, 0);
+  803762:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803766:	be 00 00 00 00       	mov    $0x0,%esi
+  80376b:	48 89 c7             	mov    %rax,%rdi
+  80376e:	48 b8 c9 28 80 00 00 	movabs $0x8028c9,%rax
+  803775:	00 00 00 
+  803778:	ff d0                	call   *%rax
+    return r;
+  80377a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80377d:	eb 13                	jmp    803792 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80377f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803783:	48 89 c7             	mov    %rax,%rdi
+  803786:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  80378d:	00 00 00 
+  803790:	ff d0                	call   *%rax
+}
+  803792:	c9                   	leave
+  803793:	c3                   	ret
+
+0000000000803794 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803794:	55                   	push   %rbp
+  803795:	48 89 e5             	mov    %rsp,%rbp
+  803798:	48 83 ec 10          	sub    $0x10,%rsp
+  80379c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037a4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037a7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037ae:	00 00 00 
+  8037b1:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8037b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037bd:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  8037c4:	00 00 00 
+  8037c7:	ff d0                	call   *%rax
+}
+  8037c9:	c9                   	leave
+  8037ca:	c3                   	ret
+
+00000000008037cb <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8037cb:	55                   	push   %rbp
+  8037cc:	48 89 e5             	mov    %rsp,%rbp
+  8037cf:	48 83 ec 30          	sub    $0x30,%rsp
+  8037d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8037d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8037db:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8037df:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8037e4:	74 07                	je     8037ed <devfile_read+0x22>
+  8037e6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037eb:	75 0a                	jne    8037f7 <devfile_read+0x2c>
+  return E_INVAL;
+  8037ed:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037f2:	e9 b4 00 00 00       	jmp    8038ab <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037f7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037fe:	00 
+  while (n) {
+  8037ff:	e9 98 00 00 00       	jmp    80389c <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803804:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803808:	8b 40 0c             	mov    0xc(%rax),%eax
+  80380b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803812:	00 00 00 
+  803815:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803817:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80381e:	00 00 00 
+  803821:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803825:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803829:	be 00 00 00 00       	mov    $0x0,%esi
+  80382e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803833:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+  80383f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803842:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803846:	7f 13                	jg     80385b <devfile_read+0x90>
+      return res ? res : res0;
+  803848:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80384c:	74 07                	je     803855 <devfile_read+0x8a>
+  80384e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803851:	48 98                	cltq
+  803853:	eb 56                	jmp    8038ab <devfile_read+0xe0>
+  803855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803859:	eb 50                	jmp    8038ab <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80385b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80385e:	48 63 d0             	movslq %eax,%rdx
+  803861:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803865:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80386c:	00 00 00 
+  80386f:	48 89 ce             	mov    %rcx,%rsi
+  803872:	48 89 c7             	mov    %rax,%rdi
+  803875:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+
+    buf += res;
+  803881:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803884:	48 98                	cltq
+  803886:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80388a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80388d:	48 98                	cltq
+  80388f:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803893:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803896:	48 98                	cltq
+  803898:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80389c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8038a1:	0f 85 5d ff ff ff    	jne    803804 <devfile_read+0x39>
+  }
+
+  return res0;
+  8038a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8038ab:	c9                   	leave
+  8038ac:	c3                   	ret
+
+00000000008038ad <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8038ad:	55                   	push   %rbp
+  8038ae:	48 89 e5             	mov    %rsp,%rbp
+  8038b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8038b5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038b9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038bd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8038c1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8038c6:	74 07                	je     8038cf <devfile_write+0x22>
+  8038c8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8038cd:	75 0a                	jne    8038d9 <devfile_write+0x2c>
+  return E_INVAL;
+  8038cf:	b8 03 00 00 00       	mov    $0x3,%eax
+  8038d4:	e9 c9 00 00 00       	jmp    8039a2 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8038d9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8038e0:	00 
+
+  while (n) {
+  8038e1:	e9 ad 00 00 00       	jmp    803993 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8038e6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038ee:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038f5:	00 
+  8038f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038fe:	48 39 c2             	cmp    %rax,%rdx
+  803901:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803905:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803909:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80390d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803911:	48 89 c6             	mov    %rax,%rsi
+  803914:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  80391b:	00 00 00 
+  80391e:	48 89 c7             	mov    %rax,%rdi
+  803921:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80392d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803931:	8b 40 0c             	mov    0xc(%rax),%eax
+  803934:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80393b:	00 00 00 
+  80393e:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803940:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803947:	00 00 00 
+  80394a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80394e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803952:	be 00 00 00 00       	mov    $0x0,%esi
+  803957:	bf 04 00 00 00       	mov    $0x4,%edi
+  80395c:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+  803968:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80396b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80396f:	79 07                	jns    803978 <devfile_write+0xcb>
+      return res;
+  803971:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803974:	48 98                	cltq
+  803976:	eb 2a                	jmp    8039a2 <devfile_write+0xf5>
+
+    buf += res;
+  803978:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80397b:	48 98                	cltq
+  80397d:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803981:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803984:	48 98                	cltq
+  803986:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80398a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80398d:	48 98                	cltq
+  80398f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803993:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803998:	0f 85 48 ff ff ff    	jne    8038e6 <devfile_write+0x39>
+  }
+
+  return res0;
+  80399e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8039a2:	c9                   	leave
+  8039a3:	c3                   	ret
+
+00000000008039a4 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8039a4:	55                   	push   %rbp
+  8039a5:	48 89 e5             	mov    %rsp,%rbp
+  8039a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8039ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039b8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039bb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039c2:	00 00 00 
+  8039c5:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8039c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8039cc:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039d1:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+  8039dd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039e0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039e4:	79 05                	jns    8039eb <devfile_stat+0x47>
+    return r;
+  8039e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039e9:	eb 59                	jmp    803a44 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ef:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039f6:	00 00 00 
+  8039f9:	48 89 d6             	mov    %rdx,%rsi
+  8039fc:	48 89 c7             	mov    %rax,%rdi
+  8039ff:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  803a06:	00 00 00 
+  803a09:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803a0b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803a12:	00 00 00 
+  803a15:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803a1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a1f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a25:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803a2c:	00 00 00 
+  803a2f:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803a35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a39:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a44:	c9                   	leave
+  803a45:	c3                   	ret
+
+0000000000803a46 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a46:	55                   	push   %rbp
+  803a47:	48 89 e5             	mov    %rsp,%rbp
+  803a4a:	48 83 ec 10          	sub    $0x10,%rsp
+  803a4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a52:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a59:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a5c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a63:	00 00 00 
+  803a66:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a68:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a6f:	00 00 00 
+  803a72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a75:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a78:	be 00 00 00 00       	mov    $0x0,%esi
+  803a7d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a82:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803a89:	00 00 00 
+  803a8c:	ff d0                	call   *%rax
+}
+  803a8e:	c9                   	leave
+  803a8f:	c3                   	ret
+
+0000000000803a90 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a90:	55                   	push   %rbp
+  803a91:	48 89 e5             	mov    %rsp,%rbp
+  803a94:	48 83 ec 18          	sub    $0x18,%rsp
+  803a98:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a9c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a9f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803aa3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803aa6:	83 e0 03             	and    $0x3,%eax
+}
+  803aa9:	c9                   	leave
+  803aaa:	c3                   	ret
+
+0000000000803aab <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803aab:	55                   	push   %rbp
+  803aac:	48 89 e5             	mov    %rsp,%rbp
+  803aaf:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803ab7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803abb:	48 89 c7             	mov    %rax,%rdi
+  803abe:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803ac5:	00 00 00 
+  803ac8:	ff d0                	call   *%rax
+  803aca:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803acf:	7e 07                	jle    803ad8 <remove+0x2d>
+    return -E_BAD_PATH;
+  803ad1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ad6:	eb 36                	jmp    803b0e <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803ad8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803adc:	48 89 c6             	mov    %rax,%rsi
+  803adf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803ae6:	00 00 00 
+  803ae9:	48 89 c7             	mov    %rax,%rdi
+  803aec:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803af8:	be 00 00 00 00       	mov    $0x0,%esi
+  803afd:	bf 07 00 00 00       	mov    $0x7,%edi
+  803b02:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+}
+  803b0e:	c9                   	leave
+  803b0f:	c3                   	ret
+
+0000000000803b10 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803b10:	55                   	push   %rbp
+  803b11:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803b14:	be 00 00 00 00       	mov    $0x0,%esi
+  803b19:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b1e:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803b25:	00 00 00 
+  803b28:	ff d0                	call   *%rax
+}
+  803b2a:	5d                   	pop    %rbp
+  803b2b:	c3                   	ret
+
+0000000000803b2c <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803b2c:	55                   	push   %rbp
+  803b2d:	48 89 e5             	mov    %rsp,%rbp
+  803b30:	48 83 ec 20          	sub    $0x20,%rsp
+  803b34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803b38:	be 00 00 00 00       	mov    $0x0,%esi
+  803b3d:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b42:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803b49:	00 00 00 
+  803b4c:	ff d0                	call   *%rax
+  803b4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b55:	79 05                	jns    803b5c <fs_stats+0x30>
+    return r;
+  803b57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b5a:	eb 2a                	jmp    803b86 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b60:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b65:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b6c:	00 00 00 
+  803b6f:	48 89 ce             	mov    %rcx,%rsi
+  803b72:	48 89 c7             	mov    %rax,%rdi
+  803b75:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  803b7c:	00 00 00 
+  803b7f:	ff d0                	call   *%rax
+  return 0;
+  803b81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b86:	c9                   	leave
+  803b87:	c3                   	ret
+
+0000000000803b88 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b88:	55                   	push   %rbp
+  803b89:	48 89 e5             	mov    %rsp,%rbp
+  803b8c:	48 83 ec 10          	sub    $0x10,%rsp
+  803b90:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b93:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b9a:	00 00 00 
+  803b9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ba0:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803bac:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803bb3:	00 00 00 
+  803bb6:	ff d0                	call   *%rax
+}
+  803bb8:	c9                   	leave
+  803bb9:	c3                   	ret
+
+0000000000803bba <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803bba:	55                   	push   %rbp
+  803bbb:	48 89 e5             	mov    %rsp,%rbp
+  803bbe:	48 83 ec 10          	sub    $0x10,%rsp
+  803bc2:	89 f8                	mov    %edi,%eax
+  803bc4:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803bc7:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803bcb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803bd2:	00 00 00 
+  803bd5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  803bdc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803be1:	48 b8 30 36 80 00 00 	movabs $0x803630,%rax
+  803be8:	00 00 00 
+  803beb:	ff d0                	call   *%rax
+}
+  803bed:	c9                   	leave
+  803bee:	c3                   	ret
+
+0000000000803bef <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+  803bf3:	48 83 ec 10          	sub    $0x10,%rsp
+  803bf7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bff:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803c04:	48 89 c7             	mov    %rax,%rdi
+  803c07:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+}
+  803c13:	c9                   	leave
+  803c14:	c3                   	ret
+
+0000000000803c15 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803c15:	55                   	push   %rbp
+  803c16:	48 89 e5             	mov    %rsp,%rbp
+  803c19:	48 83 ec 50          	sub    $0x50,%rsp
+  803c1d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803c21:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803c25:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803c2c:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803c2d:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803c32:	74 0a                	je     803c3e <pipe_size+0x29>
+  803c34:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803c3b:	00 
+  803c3c:	76 0a                	jbe    803c48 <pipe_size+0x33>
+    return -E_INVAL;
+  803c3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c43:	e9 cc 02 00 00       	jmp    803f14 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c48:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c4c:	48 89 c7             	mov    %rax,%rdi
+  803c4f:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c62:	0f 88 a8 02 00 00    	js     803f10 <pipe_size+0x2fb>
+  803c68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c6c:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c71:	48 89 c6             	mov    %rax,%rsi
+  803c74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c79:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  803c80:	00 00 00 
+  803c83:	ff d0                	call   *%rax
+  803c85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c88:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c8c:	0f 88 7e 02 00 00    	js     803f10 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c92:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c96:	48 89 c7             	mov    %rax,%rdi
+  803c99:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  803ca0:	00 00 00 
+  803ca3:	ff d0                	call   *%rax
+  803ca5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ca8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cac:	0f 88 43 02 00 00    	js     803ef5 <pipe_size+0x2e0>
+  803cb2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cb6:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cbb:	48 89 c6             	mov    %rax,%rsi
+  803cbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc3:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  803cca:	00 00 00 
+  803ccd:	ff d0                	call   *%rax
+  803ccf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cd2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cd6:	0f 88 19 02 00 00    	js     803ef5 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803cdc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ce0:	48 89 c7             	mov    %rax,%rdi
+  803ce3:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+  803cef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cf3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cfa:	00 
+  803cfb:	e9 a2 00 00 00       	jmp    803da2 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803d00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d04:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d08:	48 89 c2             	mov    %rax,%rdx
+  803d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d0f:	48 01 d0             	add    %rdx,%rax
+  803d12:	ba 07 04 00 00       	mov    $0x407,%edx
+  803d17:	48 89 c6             	mov    %rax,%rsi
+  803d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d1f:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+  803d2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d32:	0f 88 37 01 00 00    	js     803e6f <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803d38:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d3c:	48 89 c7             	mov    %rax,%rdi
+  803d3f:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  803d46:	00 00 00 
+  803d49:	ff d0                	call   *%rax
+  803d4b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d4f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d53:	48 01 c2             	add    %rax,%rdx
+  803d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d5a:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d5e:	48 89 c1             	mov    %rax,%rcx
+  803d61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d65:	48 01 c8             	add    %rcx,%rax
+  803d68:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d6e:	48 89 d1             	mov    %rdx,%rcx
+  803d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d76:	48 89 c6             	mov    %rax,%rsi
+  803d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7e:	48 b8 34 20 80 00 00 	movabs $0x802034,%rax
+  803d85:	00 00 00 
+  803d88:	ff d0                	call   *%rax
+  803d8a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d91:	79 0a                	jns    803d9d <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d93:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d98:	e9 d3 00 00 00       	jmp    803e70 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d9d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803da2:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803da9:	00 
+  803daa:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803dae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803db2:	48 01 d0             	add    %rdx,%rax
+  803db5:	48 83 c0 1f          	add    $0x1f,%rax
+  803db9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803dbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dc6:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803dca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dce:	48 29 d0             	sub    %rdx,%rax
+  803dd1:	48 c1 e8 0c          	shr    $0xc,%rax
+  803dd5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803dd9:	0f 82 21 ff ff ff    	jb     803d00 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803ddf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803de3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803de7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803deb:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803def:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803df3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df7:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dfe:	00 00 00 
+  803e01:	8b 12                	mov    (%rdx),%edx
+  803e03:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803e05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e09:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803e10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e14:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803e1b:	00 00 00 
+  803e1e:	8b 12                	mov    (%rdx),%edx
+  803e20:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803e22:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e26:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803e2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e31:	48 89 c7             	mov    %rax,%rdi
+  803e34:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  803e3b:	00 00 00 
+  803e3e:	ff d0                	call   *%rax
+  803e40:	89 c2                	mov    %eax,%edx
+  803e42:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e46:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e4c:	48 89 c7             	mov    %rax,%rdi
+  803e4f:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+  803e5b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e5f:	48 83 c2 04          	add    $0x4,%rdx
+  803e63:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6a:	e9 a5 00 00 00       	jmp    803f14 <pipe_size+0x2ff>
+      goto err2;
+  803e6f:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e70:	eb 58                	jmp    803eca <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e76:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e7a:	48 89 c2             	mov    %rax,%rdx
+  803e7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e81:	48 01 d0             	add    %rdx,%rax
+  803e84:	48 89 c6             	mov    %rax,%rsi
+  803e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8c:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  803e93:	00 00 00 
+  803e96:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e9c:	48 89 c7             	mov    %rax,%rdi
+  803e9f:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  803ea6:	00 00 00 
+  803ea9:	ff d0                	call   *%rax
+  803eab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803eaf:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803eb3:	48 01 d0             	add    %rdx,%rax
+  803eb6:	48 89 c6             	mov    %rax,%rsi
+  803eb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ebe:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  803ec5:	00 00 00 
+  803ec8:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ece:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803ed2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803ed6:	48 85 c0             	test   %rax,%rax
+  803ed9:	75 97                	jne    803e72 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803edb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803edf:	48 89 c6             	mov    %rax,%rsi
+  803ee2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ee7:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+  803ef3:	eb 01                	jmp    803ef6 <pipe_size+0x2e1>
+    goto err1;
+  803ef5:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803ef6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803efa:	48 89 c6             	mov    %rax,%rsi
+  803efd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f02:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  803f09:	00 00 00 
+  803f0c:	ff d0                	call   *%rax
+  803f0e:	eb 01                	jmp    803f11 <pipe_size+0x2fc>
+    goto err;
+  803f10:	90                   	nop
+err:
+  return r;
+  803f11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803f14:	c9                   	leave
+  803f15:	c3                   	ret
+
+0000000000803f16 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803f16:	55                   	push   %rbp
+  803f17:	48 89 e5             	mov    %rsp,%rbp
+  803f1a:	53                   	push   %rbx
+  803f1b:	48 83 ec 28          	sub    $0x28,%rsp
+  803f1f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803f23:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803f27:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f2e:	00 00 00 
+  803f31:	8b 40 04             	mov    0x4(%rax),%eax
+  803f34:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f39:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f40:	00 00 00 
+  803f43:	48 98                	cltq
+  803f45:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f4c:	48 01 d0             	add    %rdx,%rax
+  803f4f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f55:	8b 00                	mov    (%rax),%eax
+  803f57:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f5e:	48 89 c7             	mov    %rax,%rdi
+  803f61:	48 b8 21 4f 80 00 00 	movabs $0x804f21,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+  803f6d:	89 c3                	mov    %eax,%ebx
+  803f6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f73:	48 89 c7             	mov    %rax,%rdi
+  803f76:	48 b8 21 4f 80 00 00 	movabs $0x804f21,%rax
+  803f7d:	00 00 00 
+  803f80:	ff d0                	call   *%rax
+  803f82:	39 c3                	cmp    %eax,%ebx
+  803f84:	0f 94 c0             	sete   %al
+  803f87:	0f b6 c0             	movzbl %al,%eax
+  803f8a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f8d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f94:	00 00 00 
+  803f97:	8b 40 04             	mov    0x4(%rax),%eax
+  803f9a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f9f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fa6:	00 00 00 
+  803fa9:	48 98                	cltq
+  803fab:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fb2:	48 01 d0             	add    %rdx,%rax
+  803fb5:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fbb:	8b 00                	mov    (%rax),%eax
+  803fbd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803fc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc3:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803fc6:	75 05                	jne    803fcd <_pipeisclosed+0xb7>
+      return ret;
+  803fc8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fcb:	eb 68                	jmp    804035 <_pipeisclosed+0x11f>
+    if (n != nn)
+  803fcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fd0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803fd3:	0f 84 4e ff ff ff    	je     803f27 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803fd9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803fe0:	00 00 00 
+  803fe3:	8b 40 04             	mov    0x4(%rax),%eax
+  803fe6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803feb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803ff2:	00 00 00 
+  803ff5:	48 98                	cltq
+  803ff7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ffe:	48 01 d0             	add    %rdx,%rax
+  804001:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804007:	8b 10                	mov    (%rax),%edx
+  804009:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80400c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80400f:	89 c6                	mov    %eax,%esi
+  804011:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  804018:	00 00 00 
+  80401b:	48 89 c7             	mov    %rax,%rdi
+  80401e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804023:	49 b8 5e 02 80 00 00 	movabs $0x80025e,%r8
+  80402a:	00 00 00 
+  80402d:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804030:	e9 f2 fe ff ff       	jmp    803f27 <_pipeisclosed+0x11>
+  }
+}
+  804035:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804039:	c9                   	leave
+  80403a:	c3                   	ret
+
+000000000080403b <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80403b:	55                   	push   %rbp
+  80403c:	48 89 e5             	mov    %rsp,%rbp
+  80403f:	48 83 ec 30          	sub    $0x30,%rsp
+  804043:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804046:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80404a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80404d:	48 89 d6             	mov    %rdx,%rsi
+  804050:	89 c7                	mov    %eax,%edi
+  804052:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804059:	00 00 00 
+  80405c:	ff d0                	call   *%rax
+  80405e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804061:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804065:	79 05                	jns    80406c <pipeisclosed+0x31>
+    return r;
+  804067:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80406a:	eb 31                	jmp    80409d <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80406c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804070:	48 89 c7             	mov    %rax,%rdi
+  804073:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  80407a:	00 00 00 
+  80407d:	ff d0                	call   *%rax
+  80407f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804083:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804087:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80408b:	48 89 d6             	mov    %rdx,%rsi
+  80408e:	48 89 c7             	mov    %rax,%rdi
+  804091:	48 b8 16 3f 80 00 00 	movabs $0x803f16,%rax
+  804098:	00 00 00 
+  80409b:	ff d0                	call   *%rax
+}
+  80409d:	c9                   	leave
+  80409e:	c3                   	ret
+
+000000000080409f <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80409f:	55                   	push   %rbp
+  8040a0:	48 89 e5             	mov    %rsp,%rbp
+  8040a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8040a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8040ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040af:	8b 40 18             	mov    0x18(%rax),%eax
+  8040b2:	8d 50 01             	lea    0x1(%rax),%edx
+  8040b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040b9:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8040bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c0:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8040c3:	85 c0                	test   %eax,%eax
+  8040c5:	74 27                	je     8040ee <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8040c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040cb:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8040d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040d6:	48 83 c0 18          	add    $0x18,%rax
+  8040da:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8040df:	48 89 c7             	mov    %rax,%rdi
+  8040e2:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  8040e9:	00 00 00 
+  8040ec:	ff d0                	call   *%rax
+  }
+}
+  8040ee:	90                   	nop
+  8040ef:	c9                   	leave
+  8040f0:	c3                   	ret
+
+00000000008040f1 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040f1:	55                   	push   %rbp
+  8040f2:	48 89 e5             	mov    %rsp,%rbp
+  8040f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8040f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040fd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804100:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804104:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80410b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80410f:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804113:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804116:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80411d:	89 c6                	mov    %eax,%esi
+  80411f:	48 89 cf             	mov    %rcx,%rdi
+  804122:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+}
+  80412e:	90                   	nop
+  80412f:	c9                   	leave
+  804130:	c3                   	ret
+
+0000000000804131 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804131:	55                   	push   %rbp
+  804132:	48 89 e5             	mov    %rsp,%rbp
+  804135:	48 83 ec 70          	sub    $0x70,%rsp
+  804139:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80413d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804141:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804145:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804149:	48 89 c7             	mov    %rax,%rdi
+  80414c:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  804153:	00 00 00 
+  804156:	ff d0                	call   *%rax
+  804158:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80415c:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804161:	75 0a                	jne    80416d <devpipe_read+0x3c>
+    return 0;
+  804163:	b8 00 00 00 00       	mov    $0x0,%eax
+  804168:	e9 63 01 00 00       	jmp    8042d0 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80416d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804171:	8b 40 18             	mov    0x18(%rax),%eax
+  804174:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804177:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80417b:	48 8b 10             	mov    (%rax),%rdx
+  80417e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804182:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804186:	48 39 c2             	cmp    %rax,%rdx
+  804189:	75 42                	jne    8041cd <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80418b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80418f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804193:	48 89 d6             	mov    %rdx,%rsi
+  804196:	48 89 c7             	mov    %rax,%rdi
+  804199:	48 b8 16 3f 80 00 00 	movabs $0x803f16,%rax
+  8041a0:	00 00 00 
+  8041a3:	ff d0                	call   *%rax
+  8041a5:	85 c0                	test   %eax,%eax
+  8041a7:	74 0a                	je     8041b3 <devpipe_read+0x82>
+      return 0;
+  8041a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ae:	e9 1d 01 00 00       	jmp    8042d0 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8041b3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8041b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ba:	89 d6                	mov    %edx,%esi
+  8041bc:	48 89 c7             	mov    %rax,%rdi
+  8041bf:	48 b8 f1 40 80 00 00 	movabs $0x8040f1,%rax
+  8041c6:	00 00 00 
+  8041c9:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8041cb:	eb a0                	jmp    80416d <devpipe_read+0x3c>
+      break;
+  8041cd:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8041ce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8041d2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8041d6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041da:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8041de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ea:	48 8b 00             	mov    (%rax),%rax
+  8041ed:	48 29 c2             	sub    %rax,%rdx
+  8041f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041fc:	48 39 c2             	cmp    %rax,%rdx
+  8041ff:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804203:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804207:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420b:	48 8b 00             	mov    (%rax),%rax
+  80420e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804212:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80421b:	48 f7 f1             	div    %rcx
+  80421e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804222:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804226:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80422a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80422e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804232:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804236:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80423a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80423e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804242:	48 39 c2             	cmp    %rax,%rdx
+  804245:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804249:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80424d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804251:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804255:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804259:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80425d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804265:	48 89 ce             	mov    %rcx,%rsi
+  804268:	48 89 c7             	mov    %rax,%rdi
+  80426b:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  804272:	00 00 00 
+  804275:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804277:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80427b:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80427f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804283:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804287:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80428b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80428f:	48 01 d1             	add    %rdx,%rcx
+  804292:	48 89 c2             	mov    %rax,%rdx
+  804295:	48 89 cf             	mov    %rcx,%rdi
+  804298:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  80429f:	00 00 00 
+  8042a2:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8042a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042a8:	48 8b 10             	mov    (%rax),%rdx
+  8042ab:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8042af:	48 01 c2             	add    %rax,%rdx
+  8042b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042b6:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8042b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042bd:	48 89 c7             	mov    %rax,%rdi
+  8042c0:	48 b8 9f 40 80 00 00 	movabs $0x80409f,%rax
+  8042c7:	00 00 00 
+  8042ca:	ff d0                	call   *%rax
+  return n;
+  8042cc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8042d0:	c9                   	leave
+  8042d1:	c3                   	ret
+
+00000000008042d2 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042d2:	55                   	push   %rbp
+  8042d3:	48 89 e5             	mov    %rsp,%rbp
+  8042d6:	48 83 ec 70          	sub    $0x70,%rsp
+  8042da:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8042de:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042e2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042ea:	48 89 c7             	mov    %rax,%rdi
+  8042ed:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  8042f4:	00 00 00 
+  8042f7:	ff d0                	call   *%rax
+  8042f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804301:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804305:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80430c:	00 
+  80430d:	e9 b8 01 00 00       	jmp    8044ca <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804316:	8b 40 18             	mov    0x18(%rax),%eax
+  804319:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80431c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804320:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804328:	48 8b 00             	mov    (%rax),%rax
+  80432b:	48 29 c2             	sub    %rax,%rdx
+  80432e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804332:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804336:	48 39 c2             	cmp    %rax,%rdx
+  804339:	75 4d                	jne    804388 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80433b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80433f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804343:	48 89 d6             	mov    %rdx,%rsi
+  804346:	48 89 c7             	mov    %rax,%rdi
+  804349:	48 b8 16 3f 80 00 00 	movabs $0x803f16,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+  804355:	85 c0                	test   %eax,%eax
+  804357:	74 0a                	je     804363 <devpipe_write+0x91>
+        return 0;
+  804359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80435e:	e9 79 01 00 00       	jmp    8044dc <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804363:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804366:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80436a:	89 d6                	mov    %edx,%esi
+  80436c:	48 89 c7             	mov    %rax,%rdi
+  80436f:	48 b8 f1 40 80 00 00 	movabs $0x8040f1,%rax
+  804376:	00 00 00 
+  804379:	ff d0                	call   *%rax
+      m = 0;
+  80437b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804382:	00 
+      continue;
+  804383:	e9 3a 01 00 00       	jmp    8044c2 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804388:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80438c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804390:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804394:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804398:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80439c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043a0:	48 8b 08             	mov    (%rax),%rcx
+  8043a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043ab:	48 29 c1             	sub    %rax,%rcx
+  8043ae:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8043b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043b6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8043ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043be:	48 39 c2             	cmp    %rax,%rdx
+  8043c1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8043c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043cd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043d5:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8043d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043de:	48 f7 f1             	div    %rcx
+  8043e1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8043e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043f1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043f5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043f9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043fd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804401:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804405:	48 39 c2             	cmp    %rax,%rdx
+  804408:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80440c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804410:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804414:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804418:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80441c:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804420:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804424:	48 01 d1             	add    %rdx,%rcx
+  804427:	48 89 c2             	mov    %rax,%rdx
+  80442a:	48 89 cf             	mov    %rcx,%rdi
+  80442d:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  804434:	00 00 00 
+  804437:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804441:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804445:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804449:	73 4d                	jae    804498 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80444b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80444f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804453:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804457:	48 29 c2             	sub    %rax,%rdx
+  80445a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80445e:	48 01 c2             	add    %rax,%rdx
+  804461:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804465:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804469:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80446d:	48 89 c1             	mov    %rax,%rcx
+  804470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804474:	48 01 c1             	add    %rax,%rcx
+  804477:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80447b:	48 01 c1             	add    %rax,%rcx
+  80447e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804482:	48 83 c0 20          	add    $0x20,%rax
+  804486:	48 89 ce             	mov    %rcx,%rsi
+  804489:	48 89 c7             	mov    %rax,%rdi
+  80448c:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  804493:	00 00 00 
+  804496:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804498:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80449c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8044a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044a4:	48 01 c2             	add    %rax,%rdx
+  8044a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ab:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8044af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044b3:	48 89 c7             	mov    %rax,%rdi
+  8044b6:	48 b8 9f 40 80 00 00 	movabs $0x80409f,%rax
+  8044bd:	00 00 00 
+  8044c0:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8044c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044c6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8044ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044ce:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8044d2:	0f 82 3a fe ff ff    	jb     804312 <devpipe_write+0x40>
+  }
+
+  return i;
+  8044d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8044dc:	c9                   	leave
+  8044dd:	c3                   	ret
+
+00000000008044de <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8044de:	55                   	push   %rbp
+  8044df:	48 89 e5             	mov    %rsp,%rbp
+  8044e2:	48 83 ec 40          	sub    $0x40,%rsp
+  8044e6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044ea:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044f5:	48 89 c7             	mov    %rax,%rdi
+  8044f8:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  8044ff:	00 00 00 
+  804502:	ff d0                	call   *%rax
+  804504:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804508:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80450f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804513:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804517:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80451b:	48 89 d6             	mov    %rdx,%rsi
+  80451e:	48 89 c7             	mov    %rax,%rdi
+  804521:	48 b8 b9 31 80 00 00 	movabs $0x8031b9,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+  80452d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804530:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804534:	79 08                	jns    80453e <devpipe_poll+0x60>
+    return r;
+  804536:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804539:	e9 85 00 00 00       	jmp    8045c3 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80453e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804541:	83 e0 01             	and    $0x1,%eax
+  804544:	85 c0                	test   %eax,%eax
+  804546:	74 18                	je     804560 <devpipe_poll+0x82>
+  804548:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80454c:	48 8b 10             	mov    (%rax),%rdx
+  80454f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804553:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804557:	48 39 c2             	cmp    %rax,%rdx
+  80455a:	74 04                	je     804560 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80455c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804560:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804563:	83 e0 02             	and    $0x2,%eax
+  804566:	85 c0                	test   %eax,%eax
+  804568:	74 23                	je     80458d <devpipe_poll+0xaf>
+  80456a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80456e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804572:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804576:	48 8b 00             	mov    (%rax),%rax
+  804579:	48 29 c2             	sub    %rax,%rdx
+  80457c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804580:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804584:	48 39 c2             	cmp    %rax,%rdx
+  804587:	73 04                	jae    80458d <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804589:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80458d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804591:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804595:	48 89 d6             	mov    %rdx,%rsi
+  804598:	48 89 c7             	mov    %rax,%rdi
+  80459b:	48 b8 16 3f 80 00 00 	movabs $0x803f16,%rax
+  8045a2:	00 00 00 
+  8045a5:	ff d0                	call   *%rax
+  8045a7:	85 c0                	test   %eax,%eax
+  8045a9:	74 04                	je     8045af <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8045ab:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8045af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045b3:	75 0b                	jne    8045c0 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8045b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045b9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8045c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8045c3:	c9                   	leave
+  8045c4:	c3                   	ret
+
+00000000008045c5 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8045c5:	55                   	push   %rbp
+  8045c6:	48 89 e5             	mov    %rsp,%rbp
+  8045c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8045cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8045d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045d9:	48 89 c7             	mov    %rax,%rdi
+  8045dc:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  8045e3:	00 00 00 
+  8045e6:	ff d0                	call   *%rax
+  8045e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f0:	48 ba 51 56 80 00 00 	movabs $0x805651,%rdx
+  8045f7:	00 00 00 
+  8045fa:	48 89 d6             	mov    %rdx,%rsi
+  8045fd:	48 89 c7             	mov    %rax,%rdi
+  804600:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  804607:	00 00 00 
+  80460a:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80460c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804610:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804614:	89 c1                	mov    %eax,%ecx
+  804616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80461a:	48 8b 00             	mov    (%rax),%rax
+  80461d:	89 c2                	mov    %eax,%edx
+  80461f:	89 c8                	mov    %ecx,%eax
+  804621:	29 d0                	sub    %edx,%eax
+  804623:	89 c2                	mov    %eax,%edx
+  804625:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804629:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80462f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804633:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80463a:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80463d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804641:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804648:	00 00 00 
+  80464b:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804652:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804657:	c9                   	leave
+  804658:	c3                   	ret
+
+0000000000804659 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804659:	55                   	push   %rbp
+  80465a:	48 89 e5             	mov    %rsp,%rbp
+  80465d:	48 83 ec 40          	sub    $0x40,%rsp
+  804661:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804665:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804669:	48 89 c7             	mov    %rax,%rdi
+  80466c:	48 b8 e6 26 80 00 00 	movabs $0x8026e6,%rax
+  804673:	00 00 00 
+  804676:	ff d0                	call   *%rax
+  804678:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80467c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804683:	00 
+  804684:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804688:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80468c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804690:	48 01 d0             	add    %rdx,%rax
+  804693:	48 83 c0 1f          	add    $0x1f,%rax
+  804697:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80469b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80469f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046a4:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8046a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046ac:	48 29 d0             	sub    %rdx,%rax
+  8046af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046b3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8046b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046bb:	48 89 c6             	mov    %rax,%rsi
+  8046be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c3:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8046cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d3:	48 89 c7             	mov    %rax,%rdi
+  8046d6:	48 b8 9f 40 80 00 00 	movabs $0x80409f,%rax
+  8046dd:	00 00 00 
+  8046e0:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046ea:	eb 2f                	jmp    80471b <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046f0:	48 83 e8 01          	sub    $0x1,%rax
+  8046f4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046f8:	48 89 c2             	mov    %rax,%rdx
+  8046fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046ff:	48 01 d0             	add    %rdx,%rax
+  804702:	48 89 c6             	mov    %rax,%rsi
+  804705:	bf 00 00 00 00       	mov    $0x0,%edi
+  80470a:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  804711:	00 00 00 
+  804714:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804716:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80471b:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804720:	77 ca                	ja     8046ec <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804726:	48 89 c6             	mov    %rax,%rsi
+  804729:	bf 00 00 00 00       	mov    $0x0,%edi
+  80472e:	48 b8 94 20 80 00 00 	movabs $0x802094,%rax
+  804735:	00 00 00 
+  804738:	ff d0                	call   *%rax
+}
+  80473a:	c9                   	leave
+  80473b:	c3                   	ret
+
+000000000080473c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80473c:	55                   	push   %rbp
+  80473d:	48 89 e5             	mov    %rsp,%rbp
+  804740:	48 83 ec 08          	sub    $0x8,%rsp
+  804744:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804747:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80474b:	75 10                	jne    80475d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80474d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804754:	00 00 00 
+  804757:	8b 00                	mov    (%rax),%eax
+  804759:	48 98                	cltq
+  80475b:	eb 05                	jmp    804762 <vsyscall+0x26>
+  }
+  return 0;
+  80475d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804762:	c9                   	leave
+  804763:	c3                   	ret
+
+0000000000804764 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804764:	55                   	push   %rbp
+  804765:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804768:	bf 00 00 00 00       	mov    $0x0,%edi
+  80476d:	48 b8 3c 47 80 00 00 	movabs $0x80473c,%rax
+  804774:	00 00 00 
+  804777:	ff d0                	call   *%rax
+}
+  804779:	5d                   	pop    %rbp
+  80477a:	c3                   	ret
+
+000000000080477b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80477b:	55                   	push   %rbp
+  80477c:	48 89 e5             	mov    %rsp,%rbp
+  80477f:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804783:	0f 31                	rdtsc
+  804785:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804788:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80478b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80478e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804791:	48 c1 e2 20          	shl    $0x20,%rdx
+  804795:	48 09 d0             	or     %rdx,%rax
+  804798:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80479c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8047a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047a4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8047ab:	00 00 00 
+  8047ae:	8b 40 08             	mov    0x8(%rax),%eax
+  8047b1:	48 98                	cltq
+  8047b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8047b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047c0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047c4:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8047cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047d8:	48 89 d0             	mov    %rdx,%rax
+  8047db:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8047e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047e7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047eb:	48 01 c8             	add    %rcx,%rax
+}
+  8047ee:	c9                   	leave
+  8047ef:	c3                   	ret
+
+00000000008047f0 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047f0:	55                   	push   %rbp
+  8047f1:	48 89 e5             	mov    %rsp,%rbp
+  8047f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8047f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047fe:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804801:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804805:	be 01 00 00 00       	mov    $0x1,%esi
+  80480a:	48 89 c7             	mov    %rax,%rdi
+  80480d:	48 b8 c5 1d 80 00 00 	movabs $0x801dc5,%rax
+  804814:	00 00 00 
+  804817:	ff d0                	call   *%rax
+}
+  804819:	90                   	nop
+  80481a:	c9                   	leave
+  80481b:	c3                   	ret
+
+000000000080481c <getchar>:
+
+int
+getchar(void) {
+  80481c:	55                   	push   %rbp
+  80481d:	48 89 e5             	mov    %rsp,%rbp
+  804820:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804824:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804828:	ba 01 00 00 00       	mov    $0x1,%edx
+  80482d:	48 89 c6             	mov    %rax,%rsi
+  804830:	bf 00 00 00 00       	mov    $0x0,%edi
+  804835:	48 b8 4f 2d 80 00 00 	movabs $0x802d4f,%rax
+  80483c:	00 00 00 
+  80483f:	ff d0                	call   *%rax
+  804841:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804844:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804848:	79 05                	jns    80484f <getchar+0x33>
+    return r;
+  80484a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80484d:	eb 14                	jmp    804863 <getchar+0x47>
+  if (r < 1)
+  80484f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804853:	7f 07                	jg     80485c <getchar+0x40>
+    return -E_EOF;
+  804855:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80485a:	eb 07                	jmp    804863 <getchar+0x47>
+  return c;
+  80485c:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804860:	0f b6 c0             	movzbl %al,%eax
+}
+  804863:	c9                   	leave
+  804864:	c3                   	ret
+
+0000000000804865 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804865:	55                   	push   %rbp
+  804866:	48 89 e5             	mov    %rsp,%rbp
+  804869:	48 83 ec 20          	sub    $0x20,%rsp
+  80486d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804870:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804874:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804877:	48 89 d6             	mov    %rdx,%rsi
+  80487a:	89 c7                	mov    %eax,%edi
+  80487c:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804883:	00 00 00 
+  804886:	ff d0                	call   *%rax
+  804888:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80488b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80488f:	79 05                	jns    804896 <iscons+0x31>
+    return r;
+  804891:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804894:	eb 1a                	jmp    8048b0 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804896:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80489a:	8b 10                	mov    (%rax),%edx
+  80489c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  8048a3:	00 00 00 
+  8048a6:	8b 00                	mov    (%rax),%eax
+  8048a8:	39 c2                	cmp    %eax,%edx
+  8048aa:	0f 94 c0             	sete   %al
+  8048ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8048b0:	c9                   	leave
+  8048b1:	c3                   	ret
+
+00000000008048b2 <opencons>:
+
+int
+opencons(void) {
+  8048b2:	55                   	push   %rbp
+  8048b3:	48 89 e5             	mov    %rsp,%rbp
+  8048b6:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8048ba:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8048be:	48 89 c7             	mov    %rax,%rdi
+  8048c1:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  8048c8:	00 00 00 
+  8048cb:	ff d0                	call   *%rax
+  8048cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d4:	79 05                	jns    8048db <opencons+0x29>
+    return r;
+  8048d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048d9:	eb 66                	jmp    804941 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8048db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048df:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048e4:	48 89 c6             	mov    %rax,%rsi
+  8048e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ec:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  8048f3:	00 00 00 
+  8048f6:	ff d0                	call   *%rax
+  8048f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048ff:	79 05                	jns    804906 <opencons+0x54>
+    return r;
+  804901:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804904:	eb 3b                	jmp    804941 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80490a:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804911:	00 00 00 
+  804914:	8b 12                	mov    (%rdx),%edx
+  804916:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804918:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80491c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804927:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80492e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804932:	48 89 c7             	mov    %rax,%rdi
+  804935:	48 b8 c3 26 80 00 00 	movabs $0x8026c3,%rax
+  80493c:	00 00 00 
+  80493f:	ff d0                	call   *%rax
+}
+  804941:	c9                   	leave
+  804942:	c3                   	ret
+
+0000000000804943 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804943:	55                   	push   %rbp
+  804944:	48 89 e5             	mov    %rsp,%rbp
+  804947:	48 83 ec 20          	sub    $0x20,%rsp
+  80494b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80494e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804951:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804955:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804958:	48 89 d6             	mov    %rdx,%rsi
+  80495b:	89 c7                	mov    %eax,%edi
+  80495d:	48 b8 f3 27 80 00 00 	movabs $0x8027f3,%rax
+  804964:	00 00 00 
+  804967:	ff d0                	call   *%rax
+  804969:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80496c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804970:	79 05                	jns    804977 <consmode+0x34>
+    return r;
+  804972:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804975:	eb 34                	jmp    8049ab <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804977:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497b:	8b 10                	mov    (%rax),%edx
+  80497d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804984:	00 00 00 
+  804987:	8b 00                	mov    (%rax),%eax
+  804989:	39 c2                	cmp    %eax,%edx
+  80498b:	74 07                	je     804994 <consmode+0x51>
+    return -E_INVAL;
+  80498d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804992:	eb 17                	jmp    8049ab <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804994:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804998:	8b 40 0c             	mov    0xc(%rax),%eax
+  80499b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80499e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049a2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049a5:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8049a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8049ab:	c9                   	leave
+  8049ac:	c3                   	ret
+
+00000000008049ad <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8049ad:	55                   	push   %rbp
+  8049ae:	48 89 e5             	mov    %rsp,%rbp
+  8049b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8049b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8049b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8049bd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8049c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049c5:	8b 50 0c             	mov    0xc(%rax),%edx
+  8049c8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8049cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049d0:	48 89 ce             	mov    %rcx,%rsi
+  8049d3:	48 89 c7             	mov    %rax,%rdi
+  8049d6:	48 b8 36 23 80 00 00 	movabs $0x802336,%rax
+  8049dd:	00 00 00 
+  8049e0:	ff d0                	call   *%rax
+  8049e2:	48 98                	cltq
+}
+  8049e4:	c9                   	leave
+  8049e5:	c3                   	ret
+
+00000000008049e6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049e6:	55                   	push   %rbp
+  8049e7:	48 89 e5             	mov    %rsp,%rbp
+  8049ea:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049f1:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049f8:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049ff:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804a06:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804a0d:	eb 74                	jmp    804a83 <devcons_write+0x9d>
+    m = n - tot;
+  804a0f:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804a16:	89 c2                	mov    %eax,%edx
+  804a18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a1b:	29 c2                	sub    %eax,%edx
+  804a1d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804a20:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a23:	83 f8 7f             	cmp    $0x7f,%eax
+  804a26:	76 07                	jbe    804a2f <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804a28:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804a2f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a32:	48 63 d0             	movslq %eax,%rdx
+  804a35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a38:	48 63 c8             	movslq %eax,%rcx
+  804a3b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804a42:	48 01 c1             	add    %rax,%rcx
+  804a45:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a4c:	48 89 ce             	mov    %rcx,%rsi
+  804a4f:	48 89 c7             	mov    %rax,%rdi
+  804a52:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  804a59:	00 00 00 
+  804a5c:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a61:	48 63 d0             	movslq %eax,%rdx
+  804a64:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a6b:	48 89 d6             	mov    %rdx,%rsi
+  804a6e:	48 89 c7             	mov    %rax,%rdi
+  804a71:	48 b8 c5 1d 80 00 00 	movabs $0x801dc5,%rax
+  804a78:	00 00 00 
+  804a7b:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a7d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a80:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a86:	48 98                	cltq
+  804a88:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a8f:	0f 82 7a ff ff ff    	jb     804a0f <devcons_write+0x29>
+  }
+  return tot;
+  804a95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a98:	48 98                	cltq
+}
+  804a9a:	c9                   	leave
+  804a9b:	c3                   	ret
+
+0000000000804a9c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a9c:	55                   	push   %rbp
+  804a9d:	48 89 e5             	mov    %rsp,%rbp
+  804aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  804aa4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804aad:	c9                   	leave
+  804aae:	c3                   	ret
+
+0000000000804aaf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804aaf:	55                   	push   %rbp
+  804ab0:	48 89 e5             	mov    %rsp,%rbp
+  804ab3:	48 83 ec 10          	sub    $0x10,%rsp
+  804ab7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804abb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804abf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ac3:	48 ba 5d 56 80 00 00 	movabs $0x80565d,%rdx
+  804aca:	00 00 00 
+  804acd:	48 89 d6             	mov    %rdx,%rsi
+  804ad0:	48 89 c7             	mov    %rax,%rdi
+  804ad3:	48 b8 0e 12 80 00 00 	movabs $0x80120e,%rax
+  804ada:	00 00 00 
+  804add:	ff d0                	call   *%rax
+  return 0;
+  804adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ae4:	c9                   	leave
+  804ae5:	c3                   	ret
+
+0000000000804ae6 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804ae6:	55                   	push   %rbp
+  804ae7:	48 89 e5             	mov    %rsp,%rbp
+  804aea:	48 83 ec 30          	sub    $0x30,%rsp
+  804aee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804af2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804af5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804af9:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804b00:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b03:	83 e0 02             	and    $0x2,%eax
+  804b06:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804b09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b0d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b10:	83 f8 01             	cmp    $0x1,%eax
+  804b13:	75 04                	jne    804b19 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804b15:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804b19:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b1c:	83 e0 01             	and    $0x1,%eax
+  804b1f:	85 c0                	test   %eax,%eax
+  804b21:	74 44                	je     804b67 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804b23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b2b:	89 c2                	mov    %eax,%edx
+  804b2d:	be 00 00 00 00       	mov    $0x0,%esi
+  804b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b37:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  804b3e:	00 00 00 
+  804b41:	ff d0                	call   *%rax
+  804b43:	83 f8 01             	cmp    $0x1,%eax
+  804b46:	75 06                	jne    804b4e <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b48:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b4c:	eb 19                	jmp    804b67 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b52:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b58:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b5b:	89 c2                	mov    %eax,%edx
+  804b5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b61:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b67:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b6a:	c9                   	leave
+  804b6b:	c3                   	ret
+
+0000000000804b6c <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b6c:	55                   	push   %rbp
+  804b6d:	48 89 e5             	mov    %rsp,%rbp
+  804b70:	53                   	push   %rbx
+  804b71:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b78:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b7f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b85:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b8c:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b93:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b9a:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804ba1:	84 c0                	test   %al,%al
+  804ba3:	74 23                	je     804bc8 <_panic+0x5c>
+  804ba5:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804bac:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804bb0:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804bb4:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804bb8:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804bbc:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804bc0:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804bc4:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804bc8:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804bcf:	00 00 00 
+  804bd2:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804bd9:	00 00 00 
+  804bdc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804be0:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804be7:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804bee:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bf5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bfc:	00 00 00 
+  804bff:	48 8b 18             	mov    (%rax),%rbx
+  804c02:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  804c09:	00 00 00 
+  804c0c:	ff d0                	call   *%rax
+  804c0e:	89 c6                	mov    %eax,%esi
+  804c10:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804c16:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804c1d:	41 89 d0             	mov    %edx,%r8d
+  804c20:	48 89 c1             	mov    %rax,%rcx
+  804c23:	48 89 da             	mov    %rbx,%rdx
+  804c26:	48 b8 68 56 80 00 00 	movabs $0x805668,%rax
+  804c2d:	00 00 00 
+  804c30:	48 89 c7             	mov    %rax,%rdi
+  804c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c38:	49 b9 5e 02 80 00 00 	movabs $0x80025e,%r9
+  804c3f:	00 00 00 
+  804c42:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804c45:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c4c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c53:	48 89 d6             	mov    %rdx,%rsi
+  804c56:	48 89 c7             	mov    %rax,%rdi
+  804c59:	48 b8 d3 01 80 00 00 	movabs $0x8001d3,%rax
+  804c60:	00 00 00 
+  804c63:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c65:	48 b8 8b 56 80 00 00 	movabs $0x80568b,%rax
+  804c6c:	00 00 00 
+  804c6f:	48 89 c7             	mov    %rax,%rdi
+  804c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c77:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  804c7e:	00 00 00 
+  804c81:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c83:	cc                   	int3
+  804c84:	eb fd                	jmp    804c83 <_panic+0x117>
+
+0000000000804c86 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c86:	55                   	push   %rbp
+  804c87:	48 89 e5             	mov    %rsp,%rbp
+  804c8a:	48 83 ec 20          	sub    $0x20,%rsp
+  804c8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c96:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c9a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c9e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804ca2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ca6:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804cad:	48 89 c7             	mov    %rax,%rdi
+  804cb0:	48 b8 be 4c 80 00 00 	movabs $0x804cbe,%rax
+  804cb7:	00 00 00 
+  804cba:	ff d0                	call   *%rax
+}
+  804cbc:	c9                   	leave
+  804cbd:	c3                   	ret
+
+0000000000804cbe <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804cbe:	55                   	push   %rbp
+  804cbf:	48 89 e5             	mov    %rsp,%rbp
+  804cc2:	48 83 ec 30          	sub    $0x30,%rsp
+  804cc6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804cca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804cce:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804cd2:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804cd6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804cdb:	75 0e                	jne    804ceb <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804cdd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ce4:	00 00 00 
+  804ce7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804ceb:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cf0:	75 18                	jne    804d0a <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cf6:	48 89 c7             	mov    %rax,%rdi
+  804cf9:	48 b8 1c 22 80 00 00 	movabs $0x80221c,%rax
+  804d00:	00 00 00 
+  804d03:	ff d0                	call   *%rax
+  804d05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d08:	eb 1d                	jmp    804d27 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804d0a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804d0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d12:	48 89 d6             	mov    %rdx,%rsi
+  804d15:	48 89 c7             	mov    %rax,%rdi
+  804d18:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  804d1f:	00 00 00 
+  804d22:	ff d0                	call   *%rax
+  804d24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804d27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d2b:	79 2a                	jns    804d57 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804d2d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d32:	74 0a                	je     804d3e <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804d34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d38:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804d3e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d43:	74 0a                	je     804d4f <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d49:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d52:	e9 aa 00 00 00       	jmp    804e01 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d57:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d5c:	74 36                	je     804d94 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d5e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d65:	00 00 00 
+  804d68:	8b 40 04             	mov    0x4(%rax),%eax
+  804d6b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d70:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d77:	00 00 00 
+  804d7a:	48 98                	cltq
+  804d7c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d83:	48 01 d0             	add    %rdx,%rax
+  804d86:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d8c:	8b 10                	mov    (%rax),%edx
+  804d8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d92:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d94:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d99:	74 36                	je     804dd1 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d9b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804da2:	00 00 00 
+  804da5:	8b 40 04             	mov    0x4(%rax),%eax
+  804da8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804dad:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804db4:	00 00 00 
+  804db7:	48 98                	cltq
+  804db9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dc0:	48 01 d0             	add    %rdx,%rax
+  804dc3:	48 05 28 01 00 00    	add    $0x128,%rax
+  804dc9:	8b 10                	mov    (%rax),%edx
+  804dcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dcf:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804dd1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804dd8:	00 00 00 
+  804ddb:	8b 40 04             	mov    0x4(%rax),%eax
+  804dde:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804de3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804dea:	00 00 00 
+  804ded:	48 98                	cltq
+  804def:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804df6:	48 01 d0             	add    %rdx,%rax
+  804df9:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dff:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804e01:	c9                   	leave
+  804e02:	c3                   	ret
+
+0000000000804e03 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804e03:	55                   	push   %rbp
+  804e04:	48 89 e5             	mov    %rsp,%rbp
+  804e07:	48 83 ec 30          	sub    $0x30,%rsp
+  804e0b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804e0e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804e11:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804e15:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804e18:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804e1d:	75 5e                	jne    804e7d <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804e1f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e26:	00 00 00 
+  804e29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e2d:	eb 4e                	jmp    804e7d <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804e2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e33:	79 3c                	jns    804e71 <ipc_send+0x6e>
+  804e35:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804e39:	74 36                	je     804e71 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804e3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e3e:	89 c1                	mov    %eax,%ecx
+  804e40:	48 b8 90 56 80 00 00 	movabs $0x805690,%rax
+  804e47:	00 00 00 
+  804e4a:	48 89 c2             	mov    %rax,%rdx
+  804e4d:	be 54 00 00 00       	mov    $0x54,%esi
+  804e52:	48 b8 b6 56 80 00 00 	movabs $0x8056b6,%rax
+  804e59:	00 00 00 
+  804e5c:	48 89 c7             	mov    %rax,%rdi
+  804e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e64:	49 b8 6c 4b 80 00 00 	movabs $0x804b6c,%r8
+  804e6b:	00 00 00 
+  804e6e:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e71:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  804e78:	00 00 00 
+  804e7b:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e7d:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e80:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e8a:	89 c7                	mov    %eax,%edi
+  804e8c:	48 b8 c5 21 80 00 00 	movabs $0x8021c5,%rax
+  804e93:	00 00 00 
+  804e96:	ff d0                	call   *%rax
+  804e98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e9f:	75 8e                	jne    804e2f <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804ea1:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  804ea8:	00 00 00 
+  804eab:	ff d0                	call   *%rax
+}
+  804ead:	90                   	nop
+  804eae:	c9                   	leave
+  804eaf:	c3                   	ret
+
+0000000000804eb0 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804eb0:	55                   	push   %rbp
+  804eb1:	48 89 e5             	mov    %rsp,%rbp
+  804eb4:	48 83 ec 18          	sub    $0x18,%rsp
+  804eb8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804ebb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804ec2:	eb 4d                	jmp    804f11 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804ec4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ecb:	00 00 00 
+  804ece:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ed1:	48 98                	cltq
+  804ed3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eda:	48 01 d0             	add    %rdx,%rax
+  804edd:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ee3:	8b 00                	mov    (%rax),%eax
+  804ee5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ee8:	75 23                	jne    804f0d <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804eea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ef1:	00 00 00 
+  804ef4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ef7:	48 98                	cltq
+  804ef9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f00:	48 01 d0             	add    %rdx,%rax
+  804f03:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804f09:	8b 00                	mov    (%rax),%eax
+  804f0b:	eb 12                	jmp    804f1f <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804f0d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804f11:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804f18:	7e aa                	jle    804ec4 <ipc_find_env+0x14>
+  return 0;
+  804f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f1f:	c9                   	leave
+  804f20:	c3                   	ret
+
+0000000000804f21 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804f21:	55                   	push   %rbp
+  804f22:	48 89 e5             	mov    %rsp,%rbp
+  804f25:	48 83 ec 18          	sub    $0x18,%rsp
+  804f29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f31:	48 c1 e8 27          	shr    $0x27,%rax
+  804f35:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804f3a:	48 89 c2             	mov    %rax,%rdx
+  804f3d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f44:	01 00 00 
+  804f47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f4b:	83 e0 01             	and    $0x1,%eax
+  804f4e:	48 85 c0             	test   %rax,%rax
+  804f51:	74 63                	je     804fb6 <pageref+0x95>
+  804f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f57:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f5b:	48 89 c2             	mov    %rax,%rdx
+  804f5e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f65:	01 00 00 
+  804f68:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f6c:	83 e0 01             	and    $0x1,%eax
+  804f6f:	48 85 c0             	test   %rax,%rax
+  804f72:	74 42                	je     804fb6 <pageref+0x95>
+  804f74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f78:	48 c1 e8 15          	shr    $0x15,%rax
+  804f7c:	48 89 c2             	mov    %rax,%rdx
+  804f7f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f86:	01 00 00 
+  804f89:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f8d:	83 e0 01             	and    $0x1,%eax
+  804f90:	48 85 c0             	test   %rax,%rax
+  804f93:	74 21                	je     804fb6 <pageref+0x95>
+  804f95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f99:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f9d:	48 89 c2             	mov    %rax,%rdx
+  804fa0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804fa7:	01 00 00 
+  804faa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fae:	83 e0 01             	and    $0x1,%eax
+  804fb1:	48 85 c0             	test   %rax,%rax
+  804fb4:	75 07                	jne    804fbd <pageref+0x9c>
+    return 0;
+  804fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fbb:	eb 53                	jmp    805010 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804fbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc1:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fc5:	48 89 c2             	mov    %rax,%rdx
+  804fc8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804fcf:	01 00 00 
+  804fd2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fd6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804fda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fde:	83 e0 01             	and    $0x1,%eax
+  804fe1:	48 85 c0             	test   %rax,%rax
+  804fe4:	75 07                	jne    804fed <pageref+0xcc>
+    return 0;
+  804fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804feb:	eb 23                	jmp    805010 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ff1:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ff5:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804ffc:	00 00 00 
+  804fff:	48 c1 e0 04          	shl    $0x4,%rax
+  805003:	48 01 d0             	add    %rdx,%rax
+  805006:	48 83 c0 08          	add    $0x8,%rax
+  80500a:	0f b7 00             	movzwl (%rax),%eax
+  80500d:	0f b7 c0             	movzwl %ax,%eax
+}
+  805010:	c9                   	leave
+  805011:	c3                   	ret
+  805012:	66 90                	xchg   %ax,%ax
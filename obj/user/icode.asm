@@ -0,0 +1,9300 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 2f 02 00 00       	call   80025b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80003d:	89 bd ec fd ff ff    	mov    %edi,-0x214(%rbp)
+  800043:	48 89 b5 e0 fd ff ff 	mov    %rsi,-0x220(%rbp)
+  int fd, n;
+  char buf[512 + 1];
+
+  binaryname = "icode";
+  80004a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800051:	00 00 00 
+  800054:	48 b9 00 5f 80 00 00 	movabs $0x805f00,%rcx
+  80005b:	00 00 00 
+  80005e:	48 89 08             	mov    %rcx,(%rax)
+
+  cprintf("icode startup\n");
+  800061:	48 b8 06 5f 80 00 00 	movabs $0x805f06,%rax
+  800068:	00 00 00 
+  80006b:	48 89 c7             	mov    %rax,%rdi
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  80007a:	00 00 00 
+  80007d:	ff d2                	call   *%rdx
+
+  cprintf("icode: open /motd\n");
+  80007f:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  800086:	00 00 00 
+  800089:	48 89 c7             	mov    %rax,%rdi
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  800098:	00 00 00 
+  80009b:	ff d2                	call   *%rdx
+  if ((fd = open("/motd", O_RDONLY)) < 0)
+  80009d:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a2:	48 b8 28 5f 80 00 00 	movabs $0x805f28,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 89 c7             	mov    %rax,%rdi
+  8000af:	48 b8 7a 39 80 00 00 	movabs $0x80397a,%rax
+  8000b6:	00 00 00 
+  8000b9:	ff d0                	call   *%rax
+  8000bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000c2:	79 36                	jns    8000fa <umain+0xc8>
+    panic("icode: open /motd: %i", fd);
+  8000c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 b8 2e 5f 80 00 00 	movabs $0x805f2e,%rax
+  8000d0:	00 00 00 
+  8000d3:	48 89 c2             	mov    %rax,%rdx
+  8000d6:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000db:	48 b8 44 5f 80 00 00 	movabs $0x805f44,%rax
+  8000e2:	00 00 00 
+  8000e5:	48 89 c7             	mov    %rax,%rdi
+  8000e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ed:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  8000f4:	00 00 00 
+  8000f7:	41 ff d0             	call   *%r8
+
+  cprintf("icode: read /motd\n");
+  8000fa:	48 b8 51 5f 80 00 00 	movabs $0x805f51,%rax
+  800101:	00 00 00 
+  800104:	48 89 c7             	mov    %rax,%rdi
+  800107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010c:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  800113:	00 00 00 
+  800116:	ff d2                	call   *%rdx
+  while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800118:	eb 1f                	jmp    800139 <umain+0x107>
+    sys_cputs(buf, n);
+  80011a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80011d:	48 63 d0             	movslq %eax,%rdx
+  800120:	48 8d 85 f0 fd ff ff 	lea    -0x210(%rbp),%rax
+  800127:	48 89 d6             	mov    %rdx,%rsi
+  80012a:	48 89 c7             	mov    %rax,%rdi
+  80012d:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  800134:	00 00 00 
+  800137:	ff d0                	call   *%rax
+  while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800139:	48 8d 8d f0 fd ff ff 	lea    -0x210(%rbp),%rcx
+  800140:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800143:	ba 00 02 00 00       	mov    $0x200,%edx
+  800148:	48 89 ce             	mov    %rcx,%rsi
+  80014b:	89 c7                	mov    %eax,%edi
+  80014d:	48 b8 12 30 80 00 00 	movabs $0x803012,%rax
+  800154:	00 00 00 
+  800157:	ff d0                	call   *%rax
+  800159:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80015c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800160:	7f b8                	jg     80011a <umain+0xe8>
+
+  cprintf("icode: close /motd\n");
+  800162:	48 b8 64 5f 80 00 00 	movabs $0x805f64,%rax
+  800169:	00 00 00 
+  80016c:	48 89 c7             	mov    %rax,%rdi
+  80016f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800174:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  80017b:	00 00 00 
+  80017e:	ff d2                	call   *%rdx
+  close(fd);
+  800180:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800183:	89 c7                	mov    %eax,%edi
+  800185:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  80018c:	00 00 00 
+  80018f:	ff d0                	call   *%rax
+
+  {
+    int r;
+    cprintf("icode: spawn /init\n");
+  800191:	48 b8 78 5f 80 00 00 	movabs $0x805f78,%rax
+  800198:	00 00 00 
+  80019b:	48 89 c7             	mov    %rax,%rdi
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a3:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  8001aa:	00 00 00 
+  8001ad:	ff d2                	call   *%rdx
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  8001af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001b5:	48 b8 8c 5f 80 00 00 	movabs $0x805f8c,%rax
+  8001bc:	00 00 00 
+  8001bf:	48 89 c1             	mov    %rax,%rcx
+  8001c2:	48 b8 95 5f 80 00 00 	movabs $0x805f95,%rax
+  8001c9:	00 00 00 
+  8001cc:	48 89 c2             	mov    %rax,%rdx
+  8001cf:	48 b8 9e 5f 80 00 00 	movabs $0x805f9e,%rax
+  8001d6:	00 00 00 
+  8001d9:	48 89 c6             	mov    %rax,%rsi
+  8001dc:	48 b8 a3 5f 80 00 00 	movabs $0x805fa3,%rax
+  8001e3:	00 00 00 
+  8001e6:	48 89 c7             	mov    %rax,%rdi
+  8001e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ee:	49 b9 33 43 80 00 00 	movabs $0x804333,%r9
+  8001f5:	00 00 00 
+  8001f8:	41 ff d1             	call   *%r9
+  8001fb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8001fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800202:	79 36                	jns    80023a <umain+0x208>
+      panic("icode: spawn /init: %i", r);
+  800204:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800207:	89 c1                	mov    %eax,%ecx
+  800209:	48 b8 a9 5f 80 00 00 	movabs $0x805fa9,%rax
+  800210:	00 00 00 
+  800213:	48 89 c2             	mov    %rax,%rdx
+  800216:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80021b:	48 b8 44 5f 80 00 00 	movabs $0x805f44,%rax
+  800222:	00 00 00 
+  800225:	48 89 c7             	mov    %rax,%rdi
+  800228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022d:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  800234:	00 00 00 
+  800237:	41 ff d0             	call   *%r8
+  }
+
+  cprintf("icode: exiting\n");
+  80023a:	48 b8 c0 5f 80 00 00 	movabs $0x805fc0,%rax
+  800241:	00 00 00 
+  800244:	48 89 c7             	mov    %rax,%rdi
+  800247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024c:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  800253:	00 00 00 
+  800256:	ff d2                	call   *%rdx
+}
+  800258:	90                   	nop
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+000000000080025b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80025b:	55                   	push   %rbp
+  80025c:	48 89 e5             	mov    %rsp,%rbp
+  80025f:	48 83 ec 20          	sub    $0x20,%rsp
+  800263:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800266:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80026a:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800271:	00 00 00 
+  800274:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800278:	eb 13                	jmp    80028d <libmain+0x32>
+    (*ctor)();
+  80027a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80027e:	48 8b 10             	mov    (%rax),%rdx
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	ff d2                	call   *%rdx
+    ctor++;
+  800288:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80028d:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800294:	00 00 00 
+  800297:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80029b:	72 dd                	jb     80027a <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80029d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8002a1:	7e 14                	jle    8002b7 <libmain+0x5c>
+    binaryname = argv[0];
+  8002a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002a7:	48 8b 00             	mov    (%rax),%rax
+  8002aa:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8002b1:	00 00 00 
+  8002b4:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8002b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002be:	48 89 d6             	mov    %rdx,%rsi
+  8002c1:	89 c7                	mov    %eax,%edi
+  8002c3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8002ca:	00 00 00 
+  8002cd:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8002cf:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  8002d6:	00 00 00 
+  8002d9:	ff d0                	call   *%rax
+#endif
+}
+  8002db:	90                   	nop
+  8002dc:	c9                   	leave
+  8002dd:	c3                   	ret
+
+00000000008002de <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8002e2:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  8002e9:	00 00 00 
+  8002ec:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8002ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002f3:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+}
+  8002ff:	90                   	nop
+  800300:	5d                   	pop    %rbp
+  800301:	c3                   	ret
+
+0000000000800302 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	53                   	push   %rbx
+  800307:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80030e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800315:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80031b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800322:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800329:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800330:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800337:	84 c0                	test   %al,%al
+  800339:	74 23                	je     80035e <_panic+0x5c>
+  80033b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800342:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800346:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80034a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80034e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800352:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800356:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80035a:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80035e:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800365:	00 00 00 
+  800368:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80036f:	00 00 00 
+  800372:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800376:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80037d:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800384:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80038b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800392:	00 00 00 
+  800395:	48 8b 18             	mov    (%rax),%rbx
+  800398:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+  8003a4:	89 c6                	mov    %eax,%esi
+  8003a6:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8003ac:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8003b3:	41 89 d0             	mov    %edx,%r8d
+  8003b6:	48 89 c1             	mov    %rax,%rcx
+  8003b9:	48 89 da             	mov    %rbx,%rdx
+  8003bc:	48 b8 e0 5f 80 00 00 	movabs $0x805fe0,%rax
+  8003c3:	00 00 00 
+  8003c6:	48 89 c7             	mov    %rax,%rdi
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	49 b9 21 05 80 00 00 	movabs $0x800521,%r9
+  8003d5:	00 00 00 
+  8003d8:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003db:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8003e2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003e9:	48 89 d6             	mov    %rdx,%rsi
+  8003ec:	48 89 c7             	mov    %rax,%rdi
+  8003ef:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  8003f6:	00 00 00 
+  8003f9:	ff d0                	call   *%rax
+  cprintf("\n");
+  8003fb:	48 b8 03 60 80 00 00 	movabs $0x806003,%rax
+  800402:	00 00 00 
+  800405:	48 89 c7             	mov    %rax,%rdi
+  800408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040d:	48 ba 21 05 80 00 00 	movabs $0x800521,%rdx
+  800414:	00 00 00 
+  800417:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800419:	cc                   	int3
+  80041a:	eb fd                	jmp    800419 <_panic+0x117>
+
+000000000080041c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 83 ec 10          	sub    $0x10,%rsp
+  800424:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800427:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80042b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80042f:	8b 00                	mov    (%rax),%eax
+  800431:	8d 48 01             	lea    0x1(%rax),%ecx
+  800434:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800438:	89 0a                	mov    %ecx,(%rdx)
+  80043a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80043d:	89 d1                	mov    %edx,%ecx
+  80043f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800443:	48 98                	cltq
+  800445:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800449:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80044d:	8b 00                	mov    (%rax),%eax
+  80044f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800454:	75 2c                	jne    800482 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800456:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80045a:	8b 00                	mov    (%rax),%eax
+  80045c:	48 98                	cltq
+  80045e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800462:	48 83 c2 08          	add    $0x8,%rdx
+  800466:	48 89 c6             	mov    %rax,%rsi
+  800469:	48 89 d7             	mov    %rdx,%rdi
+  80046c:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  800473:	00 00 00 
+  800476:	ff d0                	call   *%rax
+    b->idx = 0;
+  800478:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80047c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800482:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800486:	8b 40 04             	mov    0x4(%rax),%eax
+  800489:	8d 50 01             	lea    0x1(%rax),%edx
+  80048c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800490:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800493:	90                   	nop
+  800494:	c9                   	leave
+  800495:	c3                   	ret
+
+0000000000800496 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800496:	55                   	push   %rbp
+  800497:	48 89 e5             	mov    %rsp,%rbp
+  80049a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8004a1:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8004a8:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8004af:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8004b6:	00 00 00 
+  b.cnt = 0;
+  8004b9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8004c0:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8004c3:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8004ca:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8004d1:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8004d8:	48 89 c6             	mov    %rax,%rsi
+  8004db:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  8004e2:	00 00 00 
+  8004e5:	48 89 c7             	mov    %rax,%rdi
+  8004e8:	48 b8 7b 08 80 00 00 	movabs $0x80087b,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8004f4:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8004fa:	48 98                	cltq
+  8004fc:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800503:	48 83 c2 08          	add    $0x8,%rdx
+  800507:	48 89 c6             	mov    %rax,%rsi
+  80050a:	48 89 d7             	mov    %rdx,%rdi
+  80050d:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  800514:	00 00 00 
+  800517:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800519:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80051f:	c9                   	leave
+  800520:	c3                   	ret
+
+0000000000800521 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800521:	55                   	push   %rbp
+  800522:	48 89 e5             	mov    %rsp,%rbp
+  800525:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80052c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800533:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80053a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800541:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800548:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80054f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800556:	84 c0                	test   %al,%al
+  800558:	74 20                	je     80057a <cprintf+0x59>
+  80055a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80055e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800562:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800566:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80056a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80056e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800572:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800576:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80057a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800581:	00 00 00 
+  800584:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80058b:	00 00 00 
+  80058e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800592:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800599:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8005a0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8005a7:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8005ae:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8005b5:	48 89 d6             	mov    %rdx,%rsi
+  8005b8:	48 89 c7             	mov    %rax,%rdi
+  8005bb:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  8005c2:	00 00 00 
+  8005c5:	ff d0                	call   *%rax
+  8005c7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8005cd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005d3:	c9                   	leave
+  8005d4:	c3                   	ret
+
+00000000008005d5 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8005d5:	55                   	push   %rbp
+  8005d6:	48 89 e5             	mov    %rsp,%rbp
+  8005d9:	48 83 ec 30          	sub    $0x30,%rsp
+  8005dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005e9:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8005ec:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8005f0:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8005f4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005f7:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8005fb:	72 54                	jb     800651 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005fd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800600:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800603:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80060a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060f:	48 f7 f6             	div    %rsi
+  800612:	49 89 c2             	mov    %rax,%r10
+  800615:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800618:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80061b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80061f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800623:	41 89 c9             	mov    %ecx,%r9d
+  800626:	41 89 f8             	mov    %edi,%r8d
+  800629:	89 d1                	mov    %edx,%ecx
+  80062b:	4c 89 d2             	mov    %r10,%rdx
+  80062e:	48 89 c7             	mov    %rax,%rdi
+  800631:	48 b8 d5 05 80 00 00 	movabs $0x8005d5,%rax
+  800638:	00 00 00 
+  80063b:	ff d0                	call   *%rax
+  80063d:	eb 1c                	jmp    80065b <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80063f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800643:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800646:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80064a:	48 89 d6             	mov    %rdx,%rsi
+  80064d:	89 c7                	mov    %eax,%edi
+  80064f:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800651:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800655:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800659:	7f e4                	jg     80063f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80065b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80065e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800662:	ba 00 00 00 00       	mov    $0x0,%edx
+  800667:	48 f7 f1             	div    %rcx
+  80066a:	48 b8 50 62 80 00 00 	movabs $0x806250,%rax
+  800671:	00 00 00 
+  800674:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800678:	0f be c0             	movsbl %al,%eax
+  80067b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80067f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800683:	48 89 d6             	mov    %rdx,%rsi
+  800686:	89 c7                	mov    %eax,%edi
+  800688:	ff d1                	call   *%rcx
+}
+  80068a:	90                   	nop
+  80068b:	c9                   	leave
+  80068c:	c3                   	ret
+
+000000000080068d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+  800691:	48 83 ec 10          	sub    $0x10,%rsp
+  800695:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800699:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80069c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8006a0:	7e 4b                	jle    8006ed <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8006a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a6:	8b 00                	mov    (%rax),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 24                	ja     8006d1 <getuint+0x44>
+  8006ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006b9:	8b 00                	mov    (%rax),%eax
+  8006bb:	89 c0                	mov    %eax,%eax
+  8006bd:	48 01 d0             	add    %rdx,%rax
+  8006c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006c4:	8b 12                	mov    (%rdx),%edx
+  8006c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006cd:	89 0a                	mov    %ecx,(%rdx)
+  8006cf:	eb 14                	jmp    8006e5 <getuint+0x58>
+  8006d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006d9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006e5:	48 8b 00             	mov    (%rax),%rax
+  8006e8:	e9 95 00 00 00       	jmp    800782 <getuint+0xf5>
+  else if (lflag)
+  8006ed:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006f1:	74 48                	je     80073b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8006f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f7:	8b 00                	mov    (%rax),%eax
+  8006f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fc:	77 24                	ja     800722 <getuint+0x95>
+  8006fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800702:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800706:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80070a:	8b 00                	mov    (%rax),%eax
+  80070c:	89 c0                	mov    %eax,%eax
+  80070e:	48 01 d0             	add    %rdx,%rax
+  800711:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800715:	8b 12                	mov    (%rdx),%edx
+  800717:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80071a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80071e:	89 0a                	mov    %ecx,(%rdx)
+  800720:	eb 14                	jmp    800736 <getuint+0xa9>
+  800722:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800726:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80072a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80072e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800732:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800736:	48 8b 00             	mov    (%rax),%rax
+  800739:	eb 47                	jmp    800782 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80073b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80073f:	8b 00                	mov    (%rax),%eax
+  800741:	83 f8 2f             	cmp    $0x2f,%eax
+  800744:	77 24                	ja     80076a <getuint+0xdd>
+  800746:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80074e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800752:	8b 00                	mov    (%rax),%eax
+  800754:	89 c0                	mov    %eax,%eax
+  800756:	48 01 d0             	add    %rdx,%rax
+  800759:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80075d:	8b 12                	mov    (%rdx),%edx
+  80075f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800762:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800766:	89 0a                	mov    %ecx,(%rdx)
+  800768:	eb 14                	jmp    80077e <getuint+0xf1>
+  80076a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80076e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800772:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800776:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80077a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80077e:	8b 00                	mov    (%rax),%eax
+  800780:	89 c0                	mov    %eax,%eax
+}
+  800782:	c9                   	leave
+  800783:	c3                   	ret
+
+0000000000800784 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800784:	55                   	push   %rbp
+  800785:	48 89 e5             	mov    %rsp,%rbp
+  800788:	48 83 ec 10          	sub    $0x10,%rsp
+  80078c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800790:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800793:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800797:	7e 4b                	jle    8007e4 <getint+0x60>
+    return va_arg(*ap, long long);
+  800799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80079d:	8b 00                	mov    (%rax),%eax
+  80079f:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a2:	77 24                	ja     8007c8 <getint+0x44>
+  8007a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b0:	8b 00                	mov    (%rax),%eax
+  8007b2:	89 c0                	mov    %eax,%eax
+  8007b4:	48 01 d0             	add    %rdx,%rax
+  8007b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007bb:	8b 12                	mov    (%rdx),%edx
+  8007bd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007c4:	89 0a                	mov    %ecx,(%rdx)
+  8007c6:	eb 14                	jmp    8007dc <getint+0x58>
+  8007c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007cc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007d0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007d8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007dc:	48 8b 00             	mov    (%rax),%rax
+  8007df:	e9 95 00 00 00       	jmp    800879 <getint+0xf5>
+  else if (lflag)
+  8007e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007e8:	74 48                	je     800832 <getint+0xae>
+    return va_arg(*ap, long);
+  8007ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ee:	8b 00                	mov    (%rax),%eax
+  8007f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f3:	77 24                	ja     800819 <getint+0x95>
+  8007f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800801:	8b 00                	mov    (%rax),%eax
+  800803:	89 c0                	mov    %eax,%eax
+  800805:	48 01 d0             	add    %rdx,%rax
+  800808:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80080c:	8b 12                	mov    (%rdx),%edx
+  80080e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800811:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800815:	89 0a                	mov    %ecx,(%rdx)
+  800817:	eb 14                	jmp    80082d <getint+0xa9>
+  800819:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800821:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800825:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800829:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80082d:	48 8b 00             	mov    (%rax),%rax
+  800830:	eb 47                	jmp    800879 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800836:	8b 00                	mov    (%rax),%eax
+  800838:	83 f8 2f             	cmp    $0x2f,%eax
+  80083b:	77 24                	ja     800861 <getint+0xdd>
+  80083d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800841:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800845:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800849:	8b 00                	mov    (%rax),%eax
+  80084b:	89 c0                	mov    %eax,%eax
+  80084d:	48 01 d0             	add    %rdx,%rax
+  800850:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800854:	8b 12                	mov    (%rdx),%edx
+  800856:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800859:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80085d:	89 0a                	mov    %ecx,(%rdx)
+  80085f:	eb 14                	jmp    800875 <getint+0xf1>
+  800861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800865:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800869:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80086d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800871:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800875:	8b 00                	mov    (%rax),%eax
+  800877:	48 98                	cltq
+}
+  800879:	c9                   	leave
+  80087a:	c3                   	ret
+
+000000000080087b <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80087b:	55                   	push   %rbp
+  80087c:	48 89 e5             	mov    %rsp,%rbp
+  80087f:	41 54                	push   %r12
+  800881:	53                   	push   %rbx
+  800882:	48 83 ec 60          	sub    $0x60,%rsp
+  800886:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80088a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80088e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800892:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800896:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80089a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80089e:	48 8b 06             	mov    (%rsi),%rax
+  8008a1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8008a5:	48 89 01             	mov    %rax,(%rcx)
+  8008a8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8008ac:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8008b0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8008b4:	eb 17                	jmp    8008cd <vprintfmt+0x52>
+      if (ch == '\0')
+  8008b6:	85 db                	test   %ebx,%ebx
+  8008b8:	0f 84 bf 04 00 00    	je     800d7d <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8008be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008c2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008c6:	48 89 c6             	mov    %rax,%rsi
+  8008c9:	89 df                	mov    %ebx,%edi
+  8008cb:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8008cd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008d5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008d9:	0f b6 00             	movzbl (%rax),%eax
+  8008dc:	0f b6 d8             	movzbl %al,%ebx
+  8008df:	83 fb 25             	cmp    $0x25,%ebx
+  8008e2:	75 d2                	jne    8008b6 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8008e4:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8008e8:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8008ef:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8008f6:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8008fd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800904:	eb 04                	jmp    80090a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800906:	90                   	nop
+  800907:	eb 01                	jmp    80090a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800909:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80090a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80090e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800912:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800916:	0f b6 00             	movzbl (%rax),%eax
+  800919:	0f b6 d8             	movzbl %al,%ebx
+  80091c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80091f:	83 f8 55             	cmp    $0x55,%eax
+  800922:	0f 87 22 04 00 00    	ja     800d4a <vprintfmt+0x4cf>
+  800928:	89 c0                	mov    %eax,%eax
+  80092a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800931:	00 
+  800932:	48 b8 78 62 80 00 00 	movabs $0x806278,%rax
+  800939:	00 00 00 
+  80093c:	48 01 d0             	add    %rdx,%rax
+  80093f:	48 8b 00             	mov    (%rax),%rax
+  800942:	ff e0                	jmp    *%rax
+        padc = '-';
+  800944:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800948:	eb c0                	jmp    80090a <vprintfmt+0x8f>
+        padc = '0';
+  80094a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80094e:	eb ba                	jmp    80090a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800950:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800957:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80095a:	89 d0                	mov    %edx,%eax
+  80095c:	c1 e0 02             	shl    $0x2,%eax
+  80095f:	01 d0                	add    %edx,%eax
+  800961:	01 c0                	add    %eax,%eax
+  800963:	01 d8                	add    %ebx,%eax
+  800965:	83 e8 30             	sub    $0x30,%eax
+  800968:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80096b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80096f:	0f b6 00             	movzbl (%rax),%eax
+  800972:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800975:	83 fb 2f             	cmp    $0x2f,%ebx
+  800978:	7e 60                	jle    8009da <vprintfmt+0x15f>
+  80097a:	83 fb 39             	cmp    $0x39,%ebx
+  80097d:	7f 5b                	jg     8009da <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80097f:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800984:	eb d1                	jmp    800957 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 17                	ja     8009a5 <vprintfmt+0x12a>
+  80098e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800992:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800995:	89 d2                	mov    %edx,%edx
+  800997:	48 01 d0             	add    %rdx,%rax
+  80099a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80099d:	83 c2 08             	add    $0x8,%edx
+  8009a0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009a3:	eb 0c                	jmp    8009b1 <vprintfmt+0x136>
+  8009a5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009a9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009ad:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009b1:	8b 00                	mov    (%rax),%eax
+  8009b3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8009b6:	eb 23                	jmp    8009db <vprintfmt+0x160>
+        if (width < 0)
+  8009b8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009bc:	0f 89 44 ff ff ff    	jns    800906 <vprintfmt+0x8b>
+          width = 0;
+  8009c2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8009c9:	e9 38 ff ff ff       	jmp    800906 <vprintfmt+0x8b>
+        altflag = 1;
+  8009ce:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8009d5:	e9 30 ff ff ff       	jmp    80090a <vprintfmt+0x8f>
+        goto process_precision;
+  8009da:	90                   	nop
+        if (width < 0)
+  8009db:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009df:	0f 89 24 ff ff ff    	jns    800909 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8009e5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009e8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8009eb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8009f2:	e9 12 ff ff ff       	jmp    800909 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8009f7:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8009fb:	e9 0a ff ff ff       	jmp    80090a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800a00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a03:	83 f8 2f             	cmp    $0x2f,%eax
+  800a06:	77 17                	ja     800a1f <vprintfmt+0x1a4>
+  800a08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a0c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a0f:	89 d2                	mov    %edx,%edx
+  800a11:	48 01 d0             	add    %rdx,%rax
+  800a14:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a17:	83 c2 08             	add    $0x8,%edx
+  800a1a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a1d:	eb 0c                	jmp    800a2b <vprintfmt+0x1b0>
+  800a1f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a23:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a27:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a2b:	8b 00                	mov    (%rax),%eax
+  800a2d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a31:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a35:	48 89 d6             	mov    %rdx,%rsi
+  800a38:	89 c7                	mov    %eax,%edi
+  800a3a:	ff d1                	call   *%rcx
+        break;
+  800a3c:	e9 37 03 00 00       	jmp    800d78 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800a41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a44:	83 f8 2f             	cmp    $0x2f,%eax
+  800a47:	77 17                	ja     800a60 <vprintfmt+0x1e5>
+  800a49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a4d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a50:	89 d2                	mov    %edx,%edx
+  800a52:	48 01 d0             	add    %rdx,%rax
+  800a55:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a58:	83 c2 08             	add    $0x8,%edx
+  800a5b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a5e:	eb 0c                	jmp    800a6c <vprintfmt+0x1f1>
+  800a60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a64:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a68:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a6c:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800a6e:	85 db                	test   %ebx,%ebx
+  800a70:	79 02                	jns    800a74 <vprintfmt+0x1f9>
+          err = -err;
+  800a72:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a74:	83 fb 15             	cmp    $0x15,%ebx
+  800a77:	7f 16                	jg     800a8f <vprintfmt+0x214>
+  800a79:	48 ba a0 61 80 00 00 	movabs $0x8061a0,%rdx
+  800a80:	00 00 00 
+  800a83:	48 63 c3             	movslq %ebx,%rax
+  800a86:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800a8a:	4d 85 e4             	test   %r12,%r12
+  800a8d:	75 2e                	jne    800abd <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800a8f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a93:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a97:	89 d9                	mov    %ebx,%ecx
+  800a99:	48 ba 61 62 80 00 00 	movabs $0x806261,%rdx
+  800aa0:	00 00 00 
+  800aa3:	48 89 c7             	mov    %rax,%rdi
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	49 b8 87 0d 80 00 00 	movabs $0x800d87,%r8
+  800ab2:	00 00 00 
+  800ab5:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800ab8:	e9 bb 02 00 00       	jmp    800d78 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800abd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ac1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ac5:	4c 89 e1             	mov    %r12,%rcx
+  800ac8:	48 ba 6a 62 80 00 00 	movabs $0x80626a,%rdx
+  800acf:	00 00 00 
+  800ad2:	48 89 c7             	mov    %rax,%rdi
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ada:	49 b8 87 0d 80 00 00 	movabs $0x800d87,%r8
+  800ae1:	00 00 00 
+  800ae4:	41 ff d0             	call   *%r8
+        break;
+  800ae7:	e9 8c 02 00 00       	jmp    800d78 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 17                	ja     800b0b <vprintfmt+0x290>
+  800af4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800af8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800afb:	89 d2                	mov    %edx,%edx
+  800afd:	48 01 d0             	add    %rdx,%rax
+  800b00:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b03:	83 c2 08             	add    $0x8,%edx
+  800b06:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b09:	eb 0c                	jmp    800b17 <vprintfmt+0x29c>
+  800b0b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b0f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b13:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b17:	4c 8b 20             	mov    (%rax),%r12
+  800b1a:	4d 85 e4             	test   %r12,%r12
+  800b1d:	75 0a                	jne    800b29 <vprintfmt+0x2ae>
+          p = "(null)";
+  800b1f:	49 bc 6d 62 80 00 00 	movabs $0x80626d,%r12
+  800b26:	00 00 00 
+        if (width > 0 && padc != '-')
+  800b29:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b2d:	7e 78                	jle    800ba7 <vprintfmt+0x32c>
+  800b2f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800b33:	74 72                	je     800ba7 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800b35:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b38:	48 98                	cltq
+  800b3a:	48 89 c6             	mov    %rax,%rsi
+  800b3d:	4c 89 e7             	mov    %r12,%rdi
+  800b40:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+  800b4c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800b4f:	eb 17                	jmp    800b68 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800b51:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800b55:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b59:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b5d:	48 89 d6             	mov    %rdx,%rsi
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800b64:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b68:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b6c:	7f e3                	jg     800b51 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b6e:	eb 37                	jmp    800ba7 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800b70:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800b74:	74 1e                	je     800b94 <vprintfmt+0x319>
+  800b76:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b79:	7e 05                	jle    800b80 <vprintfmt+0x305>
+  800b7b:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b7e:	7e 14                	jle    800b94 <vprintfmt+0x319>
+            putch('?', putdat);
+  800b80:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b84:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b88:	48 89 c6             	mov    %rax,%rsi
+  800b8b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b90:	ff d2                	call   *%rdx
+  800b92:	eb 0f                	jmp    800ba3 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800b94:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b98:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b9c:	48 89 c6             	mov    %rax,%rsi
+  800b9f:	89 df                	mov    %ebx,%edi
+  800ba1:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ba3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ba7:	4c 89 e0             	mov    %r12,%rax
+  800baa:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800bae:	0f b6 00             	movzbl (%rax),%eax
+  800bb1:	0f be d8             	movsbl %al,%ebx
+  800bb4:	85 db                	test   %ebx,%ebx
+  800bb6:	74 28                	je     800be0 <vprintfmt+0x365>
+  800bb8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800bbc:	78 b2                	js     800b70 <vprintfmt+0x2f5>
+  800bbe:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800bc2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800bc6:	79 a8                	jns    800b70 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800bc8:	eb 16                	jmp    800be0 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800bca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bd2:	48 89 c6             	mov    %rax,%rsi
+  800bd5:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bda:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800bdc:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800be0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800be4:	7f e4                	jg     800bca <vprintfmt+0x34f>
+        break;
+  800be6:	e9 8d 01 00 00       	jmp    800d78 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800beb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bee:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bf2:	89 d6                	mov    %edx,%esi
+  800bf4:	48 89 c7             	mov    %rax,%rdi
+  800bf7:	48 b8 84 07 80 00 00 	movabs $0x800784,%rax
+  800bfe:	00 00 00 
+  800c01:	ff d0                	call   *%rax
+  800c03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0b:	48 85 c0             	test   %rax,%rax
+  800c0e:	79 1d                	jns    800c2d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800c10:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c14:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c18:	48 89 c6             	mov    %rax,%rsi
+  800c1b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c20:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800c22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c26:	48 f7 d8             	neg    %rax
+  800c29:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800c2d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800c34:	e9 d2 00 00 00       	jmp    800d0b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800c39:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c3c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c40:	89 d6                	mov    %edx,%esi
+  800c42:	48 89 c7             	mov    %rax,%rdi
+  800c45:	48 b8 8d 06 80 00 00 	movabs $0x80068d,%rax
+  800c4c:	00 00 00 
+  800c4f:	ff d0                	call   *%rax
+  800c51:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800c55:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800c5c:	e9 aa 00 00 00       	jmp    800d0b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800c61:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c64:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c68:	89 d6                	mov    %edx,%esi
+  800c6a:	48 89 c7             	mov    %rax,%rdi
+  800c6d:	48 b8 8d 06 80 00 00 	movabs $0x80068d,%rax
+  800c74:	00 00 00 
+  800c77:	ff d0                	call   *%rax
+  800c79:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800c7d:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800c84:	e9 82 00 00 00       	jmp    800d0b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800c89:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c8d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c91:	48 89 c6             	mov    %rax,%rsi
+  800c94:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c99:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800c9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c9f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ca3:	48 89 c6             	mov    %rax,%rsi
+  800ca6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cab:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb3:	77 17                	ja     800ccc <vprintfmt+0x451>
+  800cb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cb9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cbc:	89 d2                	mov    %edx,%edx
+  800cbe:	48 01 d0             	add    %rdx,%rax
+  800cc1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cc4:	83 c2 08             	add    $0x8,%edx
+  800cc7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cca:	eb 0c                	jmp    800cd8 <vprintfmt+0x45d>
+  800ccc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cd0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cd4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cd8:	48 8b 00             	mov    (%rax),%rax
+  800cdb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800cdf:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800ce6:	eb 23                	jmp    800d0b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ce8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ceb:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cef:	89 d6                	mov    %edx,%esi
+  800cf1:	48 89 c7             	mov    %rax,%rdi
+  800cf4:	48 b8 8d 06 80 00 00 	movabs $0x80068d,%rax
+  800cfb:	00 00 00 
+  800cfe:	ff d0                	call   *%rax
+  800d00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d04:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800d0b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800d10:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800d13:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800d16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d1a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d22:	45 89 c1             	mov    %r8d,%r9d
+  800d25:	41 89 f8             	mov    %edi,%r8d
+  800d28:	48 89 c7             	mov    %rax,%rdi
+  800d2b:	48 b8 d5 05 80 00 00 	movabs $0x8005d5,%rax
+  800d32:	00 00 00 
+  800d35:	ff d0                	call   *%rax
+        break;
+  800d37:	eb 3f                	jmp    800d78 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800d39:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d3d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d41:	48 89 c6             	mov    %rax,%rsi
+  800d44:	89 df                	mov    %ebx,%edi
+  800d46:	ff d2                	call   *%rdx
+        break;
+  800d48:	eb 2e                	jmp    800d78 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800d4a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d4e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d52:	48 89 c6             	mov    %rax,%rsi
+  800d55:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d5a:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800d5c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d61:	eb 05                	jmp    800d68 <vprintfmt+0x4ed>
+  800d63:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800d68:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d6c:	48 83 e8 01          	sub    $0x1,%rax
+  800d70:	0f b6 00             	movzbl (%rax),%eax
+  800d73:	3c 25                	cmp    $0x25,%al
+  800d75:	75 ec                	jne    800d63 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800d77:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800d78:	e9 50 fb ff ff       	jmp    8008cd <vprintfmt+0x52>
+        return;
+  800d7d:	90                   	nop
+    }
+  }
+}
+  800d7e:	48 83 c4 60          	add    $0x60,%rsp
+  800d82:	5b                   	pop    %rbx
+  800d83:	41 5c                	pop    %r12
+  800d85:	5d                   	pop    %rbp
+  800d86:	c3                   	ret
+
+0000000000800d87 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800d87:	55                   	push   %rbp
+  800d88:	48 89 e5             	mov    %rsp,%rbp
+  800d8b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d92:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d99:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800da0:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800da7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800dae:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800db5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800dbc:	84 c0                	test   %al,%al
+  800dbe:	74 20                	je     800de0 <printfmt+0x59>
+  800dc0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800dc4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800dc8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800dcc:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800dd0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800dd4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800dd8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ddc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800de0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800de7:	00 00 00 
+  800dea:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800df1:	00 00 00 
+  800df4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800df8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800dff:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e06:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800e0d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800e14:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e1b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800e22:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e29:	48 89 c7             	mov    %rax,%rdi
+  800e2c:	48 b8 7b 08 80 00 00 	movabs $0x80087b,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800e38:	90                   	nop
+  800e39:	c9                   	leave
+  800e3a:	c3                   	ret
+
+0000000000800e3b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800e3b:	55                   	push   %rbp
+  800e3c:	48 89 e5             	mov    %rsp,%rbp
+  800e3f:	48 83 ec 10          	sub    $0x10,%rsp
+  800e43:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800e46:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800e4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e4e:	8b 40 10             	mov    0x10(%rax),%eax
+  800e51:	8d 50 01             	lea    0x1(%rax),%edx
+  800e54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e58:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800e5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e5f:	48 8b 10             	mov    (%rax),%rdx
+  800e62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e6a:	48 39 c2             	cmp    %rax,%rdx
+  800e6d:	73 17                	jae    800e86 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800e6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e73:	48 8b 00             	mov    (%rax),%rax
+  800e76:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800e7a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e7e:	48 89 0a             	mov    %rcx,(%rdx)
+  800e81:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e84:	88 10                	mov    %dl,(%rax)
+}
+  800e86:	90                   	nop
+  800e87:	c9                   	leave
+  800e88:	c3                   	ret
+
+0000000000800e89 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800e89:	55                   	push   %rbp
+  800e8a:	48 89 e5             	mov    %rsp,%rbp
+  800e8d:	48 83 ec 40          	sub    $0x40,%rsp
+  800e91:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800e95:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800e98:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800e9c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ea0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ea4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800ea8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800eab:	48 98                	cltq
+  800ead:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800eb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb5:	48 01 d0             	add    %rdx,%rax
+  800eb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800ebc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800ec3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ec8:	74 06                	je     800ed0 <vsnprintf+0x47>
+  800eca:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ece:	7f 07                	jg     800ed7 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed5:	eb 32                	jmp    800f09 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800ed7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800edb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800edf:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800ee3:	48 89 c6             	mov    %rax,%rsi
+  800ee6:	48 b8 3b 0e 80 00 00 	movabs $0x800e3b,%rax
+  800eed:	00 00 00 
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	48 b8 7b 08 80 00 00 	movabs $0x80087b,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800eff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f03:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800f06:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f09:	c9                   	leave
+  800f0a:	c3                   	ret
+
+0000000000800f0b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800f0b:	55                   	push   %rbp
+  800f0c:	48 89 e5             	mov    %rsp,%rbp
+  800f0f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f16:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f1d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800f23:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f2a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f31:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f38:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f3f:	84 c0                	test   %al,%al
+  800f41:	74 20                	je     800f63 <snprintf+0x58>
+  800f43:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f47:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f4b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f4f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f53:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f57:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f5b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f5f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800f63:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800f6a:	00 00 00 
+  800f6d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f74:	00 00 00 
+  800f77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f7b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f82:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f89:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800f90:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800f97:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f9e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800fa4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800fab:	48 89 c7             	mov    %rax,%rdi
+  800fae:	48 b8 89 0e 80 00 00 	movabs $0x800e89,%rax
+  800fb5:	00 00 00 
+  800fb8:	ff d0                	call   *%rax
+  800fba:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800fc0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800fc6:	c9                   	leave
+  800fc7:	c3                   	ret
+
+0000000000800fc8 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800fc8:	55                   	push   %rbp
+  800fc9:	48 89 e5             	mov    %rsp,%rbp
+  800fcc:	53                   	push   %rbx
+  800fcd:	48 83 ec 38          	sub    $0x38,%rsp
+  800fd1:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800fd4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800fd8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800fdc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800fe0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800fe4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fec:	89 d1                	mov    %edx,%ecx
+  800fee:	0f a2                	cpuid
+  800ff0:	89 de                	mov    %ebx,%esi
+  800ff2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ff5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ff8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ffb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ffe:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801003:	74 09                	je     80100e <cpuid+0x46>
+}
+  801005:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801009:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80100c:	89 10                	mov    %edx,(%rax)
+
+  80100e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801013:	74 09                	je     80101e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801015:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801019:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80101c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80101e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801023:	74 09                	je     80102e <cpuid+0x66>
+char *
+  801025:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801029:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80102c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80102e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801033:	74 09                	je     80103e <cpuid+0x76>
+  for (; *s; s++)
+  801035:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801039:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80103c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80103e:	90                   	nop
+  80103f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801043:	c9                   	leave
+  801044:	c3                   	ret
+
+0000000000801045 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	48 83 ec 18          	sub    $0x18,%rsp
+  80104d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801050:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801053:	89 c1                	mov    %eax,%ecx
+  801055:	0f 01 d0             	xgetbv
+  801058:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80105b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80105e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801061:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801064:	48 c1 e2 20          	shl    $0x20,%rdx
+  801068:	48 09 d0             	or     %rdx,%rax
+#else
+  80106b:	c9                   	leave
+  80106c:	c3                   	ret
+
+000000000080106d <string_cpu>:
+string_cpu(void) {
+  80106d:	55                   	push   %rbp
+  80106e:	48 89 e5             	mov    %rsp,%rbp
+  801071:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801075:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80107c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801083:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80108a:	00 00 00 
+  80108d:	8b 00                	mov    (%rax),%eax
+  80108f:	85 c0                	test   %eax,%eax
+  801091:	78 11                	js     8010a4 <string_cpu+0x37>
+    return string_features;
+  801093:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80109a:	00 00 00 
+  80109d:	8b 00                	mov    (%rax),%eax
+  80109f:	e9 df 00 00 00       	jmp    801183 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8010a4:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8010a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b8:	48 89 c6             	mov    %rax,%rsi
+  8010bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c0:	48 b8 c8 0f 80 00 00 	movabs $0x800fc8,%rax
+  8010c7:	00 00 00 
+  8010ca:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8010cc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8010cf:	83 f8 06             	cmp    $0x6,%eax
+  8010d2:	76 28                	jbe    8010fc <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8010d4:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8010d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e3:	48 89 c2             	mov    %rax,%rdx
+  8010e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010eb:	bf 07 00 00 00       	mov    $0x7,%edi
+  8010f0:	48 b8 c8 0f 80 00 00 	movabs $0x800fc8,%rax
+  8010f7:	00 00 00 
+  8010fa:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8010fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8010ff:	25 00 02 00 00       	and    $0x200,%eax
+  801104:	85 c0                	test   %eax,%eax
+  801106:	74 04                	je     80110c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801108:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80110c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801116:	48 89 c1             	mov    %rax,%rcx
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111e:	be 00 00 00 00       	mov    $0x0,%esi
+  801123:	bf 01 00 00 00       	mov    $0x1,%edi
+  801128:	48 b8 c8 0f 80 00 00 	movabs $0x800fc8,%rax
+  80112f:	00 00 00 
+  801132:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801134:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801137:	83 e0 20             	and    $0x20,%eax
+  80113a:	85 c0                	test   %eax,%eax
+  80113c:	74 2a                	je     801168 <string_cpu+0xfb>
+  80113e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801141:	25 00 00 00 08       	and    $0x8000000,%eax
+  801146:	85 c0                	test   %eax,%eax
+  801148:	74 1e                	je     801168 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80114a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80114f:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  801156:	00 00 00 
+  801159:	ff d0                	call   *%rax
+  80115b:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80115e:	48 83 f8 06          	cmp    $0x6,%rax
+  801162:	75 04                	jne    801168 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801164:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801168:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80116f:	00 00 00 
+  801172:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801175:	89 02                	mov    %eax,(%rdx)
+  801177:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80117e:	00 00 00 
+  801181:	8b 00                	mov    (%rax),%eax
+}
+  801183:	c9                   	leave
+  801184:	c3                   	ret
+
+0000000000801185 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80118d:	48 83 ec 60          	sub    $0x60,%rsp
+  801191:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801196:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80119b:	83 e0 1f             	and    $0x1f,%eax
+  80119e:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8011a2:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8011a6:	48 f7 d8             	neg    %rax
+  8011a9:	48 89 c2             	mov    %rax,%rdx
+  8011ac:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8011b1:	48 01 d0             	add    %rdx,%rax
+  8011b4:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8011b9:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8011bd:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8011c3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8011c8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8011cc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8011d2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8011d6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8011da:	89 c2                	mov    %eax,%edx
+  8011dc:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8011e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8011e5:	89 c1                	mov    %eax,%ecx
+  8011e7:	d3 e6                	shl    %cl,%esi
+  8011e9:	89 f0                	mov    %esi,%eax
+  8011eb:	21 d0                	and    %edx,%eax
+  8011ed:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8011f1:	eb 21                	jmp    801214 <strlen_avx2+0x8f>
+    p += 32;
+  8011f3:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8011f9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8011fe:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801202:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801208:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80120c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801210:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801214:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801219:	74 d8                	je     8011f3 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80121b:	31 c0                	xor    %eax,%eax
+  80121d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801223:	48 63 d0             	movslq %eax,%rdx
+  801226:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80122b:	48 01 d0             	add    %rdx,%rax
+  80122e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801233:	c9                   	leave
+  801234:	c3                   	ret
+
+0000000000801235 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801235:	55                   	push   %rbp
+  801236:	48 89 e5             	mov    %rsp,%rbp
+  801239:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80123d:	48 83 ec 40          	sub    $0x40,%rsp
+  801241:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801246:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80124b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801250:	eb 77                	jmp    8012c9 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801252:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801257:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80125b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80125f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801264:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801268:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80126c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801270:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801274:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801279:	74 3c                	je     8012b7 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80127b:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80127f:	f7 d0                	not    %eax
+  801281:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801285:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801289:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80128d:	48 63 d0             	movslq %eax,%rdx
+  801290:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801295:	48 01 d0             	add    %rdx,%rax
+  801298:	0f b6 00             	movzbl (%rax),%eax
+  80129b:	0f b6 c0             	movzbl %al,%eax
+  80129e:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8012a2:	48 63 ca             	movslq %edx,%rcx
+  8012a5:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8012aa:	48 01 ca             	add    %rcx,%rdx
+  8012ad:	0f b6 12             	movzbl (%rdx),%edx
+  8012b0:	0f b6 d2             	movzbl %dl,%edx
+  8012b3:	29 d0                	sub    %edx,%eax
+  8012b5:	eb 6b                	jmp    801322 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8012b7:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8012bd:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8012c3:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8012c9:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8012cf:	77 81                	ja     801252 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8012d1:	eb 42                	jmp    801315 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8012d3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012d8:	0f b6 10             	movzbl (%rax),%edx
+  8012db:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012e0:	0f b6 00             	movzbl (%rax),%eax
+  8012e3:	38 c2                	cmp    %al,%dl
+  8012e5:	74 1c                	je     801303 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8012e7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012ec:	0f b6 00             	movzbl (%rax),%eax
+  8012ef:	0f b6 c8             	movzbl %al,%ecx
+  8012f2:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012f7:	0f b6 00             	movzbl (%rax),%eax
+  8012fa:	0f b6 d0             	movzbl %al,%edx
+  8012fd:	89 c8                	mov    %ecx,%eax
+  8012ff:	29 d0                	sub    %edx,%eax
+  801301:	eb 1f                	jmp    801322 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801303:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801309:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80130f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801315:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80131b:	75 b6                	jne    8012d3 <memcmp_avx2+0x9e>
+  return 0;
+  80131d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+
+0000000000801324 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801324:	55                   	push   %rbp
+  801325:	48 89 e5             	mov    %rsp,%rbp
+  801328:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80132c:	48 83 ec 60          	sub    $0x60,%rsp
+  801330:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801335:	89 f0                	mov    %esi,%eax
+  801337:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80133c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801340:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801345:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801349:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80134e:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801354:	eb 47                	jmp    80139d <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801356:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80135b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80135f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801363:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801369:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80136d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801371:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801375:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80137a:	74 15                	je     801391 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80137c:	31 c0                	xor    %eax,%eax
+  80137e:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801384:	48 63 d0             	movslq %eax,%rdx
+  801387:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80138c:	48 01 d0             	add    %rdx,%rax
+  80138f:	eb 3d                	jmp    8013ce <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801391:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801397:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80139d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8013a3:	77 b1                	ja     801356 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8013a5:	eb 0c                	jmp    8013b3 <memfind_avx2+0x8f>
+  8013a7:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8013ad:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8013b3:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8013b9:	74 0e                	je     8013c9 <memfind_avx2+0xa5>
+  8013bb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013c0:	0f b6 00             	movzbl (%rax),%eax
+  8013c3:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8013c7:	75 de                	jne    8013a7 <memfind_avx2+0x83>
+  return s;
+  8013c9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8013ce:	c9                   	leave
+  8013cf:	c3                   	ret
+
+00000000008013d0 <strlen>:
+strlen(const char *s) {
+  8013d0:	55                   	push   %rbp
+  8013d1:	48 89 e5             	mov    %rsp,%rbp
+  8013d4:	48 83 ec 40          	sub    $0x40,%rsp
+  8013d8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8013dc:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8013e0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8013e4:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  8013eb:	00 00 00 
+  8013ee:	ff d0                	call   *%rax
+  8013f0:	83 e0 02             	and    $0x2,%eax
+  8013f3:	85 c0                	test   %eax,%eax
+  8013f5:	74 18                	je     80140f <strlen+0x3f>
+    return strlen_avx2(s);
+  8013f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013fb:	48 89 c7             	mov    %rax,%rdi
+  8013fe:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  801405:	00 00 00 
+  801408:	ff d0                	call   *%rax
+  80140a:	e9 82 00 00 00       	jmp    801491 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80140f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801413:	83 e0 0f             	and    $0xf,%eax
+  801416:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801419:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80141c:	48 f7 d8             	neg    %rax
+  80141f:	48 89 c2             	mov    %rax,%rdx
+  801422:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801426:	48 01 d0             	add    %rdx,%rax
+  801429:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80142d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801431:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801435:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80143a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80143e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801447:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80144c:	89 c1                	mov    %eax,%ecx
+  80144e:	d3 e6                	shl    %cl,%esi
+  801450:	89 f0                	mov    %esi,%eax
+  801452:	21 d0                	and    %edx,%eax
+  801454:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801457:	eb 1d                	jmp    801476 <strlen+0xa6>
+    p += 16;
+  801459:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80145e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801462:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801466:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80146b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80146f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801473:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801476:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80147a:	74 dd                	je     801459 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80147c:	31 c0                	xor    %eax,%eax
+  80147e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801483:	48 63 d0             	movslq %eax,%rdx
+  801486:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80148a:	48 01 d0             	add    %rdx,%rax
+  80148d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+
+0000000000801493 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801493:	55                   	push   %rbp
+  801494:	48 89 e5             	mov    %rsp,%rbp
+  801497:	48 83 ec 20          	sub    $0x20,%rsp
+  80149b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80149f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014aa:	eb 0e                	jmp    8014ba <strnlen+0x27>
+    n++;
+  8014ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014b0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014b5:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8014ba:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8014bf:	74 0b                	je     8014cc <strnlen+0x39>
+  8014c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c5:	0f b6 00             	movzbl (%rax),%eax
+  8014c8:	84 c0                	test   %al,%al
+  8014ca:	75 e0                	jne    8014ac <strnlen+0x19>
+  return n;
+  8014cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014cf:	c9                   	leave
+  8014d0:	c3                   	ret
+
+00000000008014d1 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8014d1:	55                   	push   %rbp
+  8014d2:	48 89 e5             	mov    %rsp,%rbp
+  8014d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8014d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8014e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8014e9:	90                   	nop
+  8014ea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014ee:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801502:	0f b6 12             	movzbl (%rdx),%edx
+  801505:	88 10                	mov    %dl,(%rax)
+  801507:	0f b6 00             	movzbl (%rax),%eax
+  80150a:	84 c0                	test   %al,%al
+  80150c:	75 dc                	jne    8014ea <strcpy+0x19>
+  return ret;
+  80150e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+
+0000000000801514 <strcat>:
+strcat(char *dst, const char *src) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	48 83 ec 20          	sub    $0x20,%rsp
+  80151c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801520:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801528:	48 89 c7             	mov    %rax,%rdi
+  80152b:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  801532:	00 00 00 
+  801535:	ff d0                	call   *%rax
+  801537:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80153a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80153d:	48 63 d0             	movslq %eax,%rdx
+  801540:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801544:	48 01 c2             	add    %rax,%rdx
+  801547:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80154b:	48 89 c6             	mov    %rax,%rsi
+  80154e:	48 89 d7             	mov    %rdx,%rdi
+  801551:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  801558:	00 00 00 
+  80155b:	ff d0                	call   *%rax
+  return dst;
+  80155d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801561:	c9                   	leave
+  801562:	c3                   	ret
+
+0000000000801563 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801563:	55                   	push   %rbp
+  801564:	48 89 e5             	mov    %rsp,%rbp
+  801567:	48 83 ec 28          	sub    $0x28,%rsp
+  80156b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80156f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801573:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801577:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80157f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801586:	00 
+  801587:	eb 2a                	jmp    8015b3 <strncpy+0x50>
+    *dst++ = *src;
+  801589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801591:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801595:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801599:	0f b6 12             	movzbl (%rdx),%edx
+  80159c:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80159e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015a2:	0f b6 00             	movzbl (%rax),%eax
+  8015a5:	84 c0                	test   %al,%al
+  8015a7:	74 05                	je     8015ae <strncpy+0x4b>
+      src++;
+  8015a9:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8015ae:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015bb:	72 cc                	jb     801589 <strncpy+0x26>
+  return ret;
+  8015bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+00000000008015c3 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	48 83 ec 28          	sub    $0x28,%rsp
+  8015cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8015d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8015df:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8015e4:	74 3d                	je     801623 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8015e6:	eb 1d                	jmp    801605 <strlcpy+0x42>
+      *dst++ = *src++;
+  8015e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015ec:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015f0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015f8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015fc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801600:	0f b6 12             	movzbl (%rdx),%edx
+  801603:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801605:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80160a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80160f:	74 0b                	je     80161c <strlcpy+0x59>
+  801611:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801615:	0f b6 00             	movzbl (%rax),%eax
+  801618:	84 c0                	test   %al,%al
+  80161a:	75 cc                	jne    8015e8 <strlcpy+0x25>
+    *dst = '\0';
+  80161c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801620:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801627:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+
+000000000080162d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80162d:	55                   	push   %rbp
+  80162e:	48 89 e5             	mov    %rsp,%rbp
+  801631:	48 83 ec 30          	sub    $0x30,%rsp
+  801635:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801639:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80163d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801641:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801645:	48 89 c7             	mov    %rax,%rdi
+  801648:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+  801654:	48 98                	cltq
+  801656:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80165a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80165e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801662:	48 89 d6             	mov    %rdx,%rsi
+  801665:	48 89 c7             	mov    %rax,%rdi
+  801668:	48 b8 93 14 80 00 00 	movabs $0x801493,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+  801674:	48 98                	cltq
+  801676:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80167a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801682:	75 10                	jne    801694 <strlcat+0x67>
+    return maxlen + srclen;
+  801684:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801688:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168c:	48 01 d0             	add    %rdx,%rax
+  80168f:	e9 86 00 00 00       	jmp    80171a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801694:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801698:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80169c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8016a0:	73 2b                	jae    8016cd <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8016a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016aa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b2:	48 01 c1             	add    %rax,%rcx
+  8016b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b9:	48 89 c6             	mov    %rax,%rsi
+  8016bc:	48 89 cf             	mov    %rcx,%rdi
+  8016bf:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  8016c6:	00 00 00 
+  8016c9:	ff d0                	call   *%rax
+  8016cb:	eb 42                	jmp    80170f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8016cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016d1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016d5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016dd:	48 01 c1             	add    %rax,%rcx
+  8016e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e4:	48 89 c6             	mov    %rax,%rsi
+  8016e7:	48 89 cf             	mov    %rcx,%rdi
+  8016ea:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  8016f1:	00 00 00 
+  8016f4:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8016f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8016fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016fe:	48 01 d0             	add    %rdx,%rax
+  801701:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801705:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801709:	48 01 d0             	add    %rdx,%rax
+  80170c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80170f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801717:	48 01 d0             	add    %rdx,%rax
+}
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+000000000080171c <strcmp>:
+strcmp(const char *p, const char *q) {
+  80171c:	55                   	push   %rbp
+  80171d:	48 89 e5             	mov    %rsp,%rbp
+  801720:	48 83 ec 10          	sub    $0x10,%rsp
+  801724:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801728:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80172c:	eb 0a                	jmp    801738 <strcmp+0x1c>
+    p++, q++;
+  80172e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801733:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173c:	0f b6 00             	movzbl (%rax),%eax
+  80173f:	84 c0                	test   %al,%al
+  801741:	74 12                	je     801755 <strcmp+0x39>
+  801743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801747:	0f b6 10             	movzbl (%rax),%edx
+  80174a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80174e:	0f b6 00             	movzbl (%rax),%eax
+  801751:	38 c2                	cmp    %al,%dl
+  801753:	74 d9                	je     80172e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801755:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801759:	0f b6 00             	movzbl (%rax),%eax
+  80175c:	0f b6 d0             	movzbl %al,%edx
+  80175f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801763:	0f b6 00             	movzbl (%rax),%eax
+  801766:	0f b6 c0             	movzbl %al,%eax
+  801769:	29 c2                	sub    %eax,%edx
+  80176b:	89 d0                	mov    %edx,%eax
+}
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+
+000000000080176f <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80176f:	55                   	push   %rbp
+  801770:	48 89 e5             	mov    %rsp,%rbp
+  801773:	48 83 ec 18          	sub    $0x18,%rsp
+  801777:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80177b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80177f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801783:	eb 0f                	jmp    801794 <strncmp+0x25>
+    n--, p++, q++;
+  801785:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80178a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80178f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801794:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801799:	74 1d                	je     8017b8 <strncmp+0x49>
+  80179b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179f:	0f b6 00             	movzbl (%rax),%eax
+  8017a2:	84 c0                	test   %al,%al
+  8017a4:	74 12                	je     8017b8 <strncmp+0x49>
+  8017a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017aa:	0f b6 10             	movzbl (%rax),%edx
+  8017ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b1:	0f b6 00             	movzbl (%rax),%eax
+  8017b4:	38 c2                	cmp    %al,%dl
+  8017b6:	74 cd                	je     801785 <strncmp+0x16>
+  if (n == 0)
+  8017b8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017bd:	75 07                	jne    8017c6 <strncmp+0x57>
+    return 0;
+  8017bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c4:	eb 16                	jmp    8017dc <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8017c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ca:	0f b6 00             	movzbl (%rax),%eax
+  8017cd:	0f b6 d0             	movzbl %al,%edx
+  8017d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d4:	0f b6 00             	movzbl (%rax),%eax
+  8017d7:	0f b6 c0             	movzbl %al,%eax
+  8017da:	29 c2                	sub    %eax,%edx
+}
+  8017dc:	89 d0                	mov    %edx,%eax
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+
+00000000008017e0 <strchr>:
+strchr(const char *s, char c) {
+  8017e0:	55                   	push   %rbp
+  8017e1:	48 89 e5             	mov    %rsp,%rbp
+  8017e4:	48 83 ec 60          	sub    $0x60,%rsp
+  8017e8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8017ec:	89 f0                	mov    %esi,%eax
+  8017ee:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8017f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8017f5:	83 e0 0f             	and    $0xf,%eax
+  8017f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8017fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017fe:	48 f7 d8             	neg    %rax
+  801801:	48 89 c2             	mov    %rax,%rdx
+  801804:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801808:	48 01 d0             	add    %rdx,%rax
+  80180b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80180f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801813:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801817:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80181b:	66 0f 6e c0          	movd   %eax,%xmm0
+  80181f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801823:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801827:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80182c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801830:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801834:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801838:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80183c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801841:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801846:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80184a:	89 c2                	mov    %eax,%edx
+  80184c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801851:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801856:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80185a:	09 c2                	or     %eax,%edx
+  80185c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80185f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801864:	89 c1                	mov    %eax,%ecx
+  801866:	d3 e6                	shl    %cl,%esi
+  801868:	89 f0                	mov    %esi,%eax
+  80186a:	21 d0                	and    %edx,%eax
+  80186c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80186f:	eb 34                	jmp    8018a5 <strchr+0xc5>
+    p += 16;
+  801871:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801876:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80187a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80187e:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801882:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801887:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80188c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801890:	89 c2                	mov    %eax,%edx
+  801892:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801897:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80189c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018a0:	09 d0                	or     %edx,%eax
+  8018a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8018a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8018a9:	74 c6                	je     801871 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8018ab:	31 c0                	xor    %eax,%eax
+  8018ad:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8018b2:	48 98                	cltq
+  8018b4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8018b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018bc:	0f b6 00             	movzbl (%rax),%eax
+  8018bf:	84 c0                	test   %al,%al
+  8018c1:	74 06                	je     8018c9 <strchr+0xe9>
+  8018c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c7:	eb 05                	jmp    8018ce <strchr+0xee>
+  8018c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ce:	c9                   	leave
+  8018cf:	c3                   	ret
+
+00000000008018d0 <strfind>:
+strfind(const char *s, char c) {
+  8018d0:	55                   	push   %rbp
+  8018d1:	48 89 e5             	mov    %rsp,%rbp
+  8018d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8018d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018dc:	89 f0                	mov    %esi,%eax
+  8018de:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8018e1:	eb 11                	jmp    8018f4 <strfind+0x24>
+    if (*s == c)
+  8018e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e7:	0f b6 00             	movzbl (%rax),%eax
+  8018ea:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018ed:	74 12                	je     801901 <strfind+0x31>
+  for (; *s; s++)
+  8018ef:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f8:	0f b6 00             	movzbl (%rax),%eax
+  8018fb:	84 c0                	test   %al,%al
+  8018fd:	75 e4                	jne    8018e3 <strfind+0x13>
+  8018ff:	eb 01                	jmp    801902 <strfind+0x32>
+      break;
+  801901:	90                   	nop
+  return (char *)s;
+  801902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801906:	c9                   	leave
+  801907:	c3                   	ret
+
+0000000000801908 <memset>:
+memset(void *v, int c, size_t n) {
+  801908:	55                   	push   %rbp
+  801909:	48 89 e5             	mov    %rsp,%rbp
+  80190c:	48 83 ec 38          	sub    $0x38,%rsp
+  801910:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801914:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801917:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80191b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801923:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801928:	76 41                	jbe    80196b <memset+0x63>
+  80192a:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+  801936:	83 e0 01             	and    $0x1,%eax
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	74 2e                	je     80196b <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80193d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801940:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801944:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801948:	48 89 ce             	mov    %rcx,%rsi
+  80194b:	48 89 f7             	mov    %rsi,%rdi
+  80194e:	48 89 d1             	mov    %rdx,%rcx
+  801951:	fc                   	cld
+  801952:	f3 aa                	rep stos %al,%es:(%rdi)
+  801954:	48 89 ca             	mov    %rcx,%rdx
+  801957:	48 89 fe             	mov    %rdi,%rsi
+  80195a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80195e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801966:	e9 a7 00 00 00       	jmp    801a12 <memset+0x10a>
+  if (n >= 8) {
+  80196b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801970:	0f 86 87 00 00 00    	jbe    8019fd <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801976:	eb 16                	jmp    80198e <memset+0x86>
+      *p++ = c;
+  801978:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801980:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801984:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801987:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801989:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80198e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801992:	83 e0 07             	and    $0x7,%eax
+  801995:	48 85 c0             	test   %rax,%rax
+  801998:	75 de                	jne    801978 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80199a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80199d:	0f b6 c0             	movzbl %al,%eax
+  8019a0:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8019a7:	01 01 01 
+  8019aa:	48 0f af c2          	imul   %rdx,%rax
+  8019ae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8019b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b6:	48 c1 e8 03          	shr    $0x3,%rax
+  8019ba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8019be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019ca:	48 89 ce             	mov    %rcx,%rsi
+  8019cd:	48 89 f7             	mov    %rsi,%rdi
+  8019d0:	48 89 d1             	mov    %rdx,%rcx
+  8019d3:	fc                   	cld
+  8019d4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8019d7:	48 89 ca             	mov    %rcx,%rdx
+  8019da:	48 89 fe             	mov    %rdi,%rsi
+  8019dd:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8019e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8019e5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8019ea:	eb 11                	jmp    8019fd <memset+0xf5>
+    *p++ = c;
+  8019ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019f4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019f8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019fb:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8019fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a01:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a05:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a09:	48 85 c0             	test   %rax,%rax
+  801a0c:	75 de                	jne    8019ec <memset+0xe4>
+  return v;
+  801a0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+
+0000000000801a14 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	48 83 ec 38          	sub    $0x38,%rsp
+  801a1c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a20:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a24:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801a28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801a30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801a38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a40:	0f 83 da 00 00 00    	jae    801b20 <memmove+0x10c>
+  801a46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a4e:	48 01 d0             	add    %rdx,%rax
+  801a51:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a55:	0f 83 c5 00 00 00    	jae    801b20 <memmove+0x10c>
+    s += n;
+  801a5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a5f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801a63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a67:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801a6b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a70:	0f 86 94 00 00 00    	jbe    801b0a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801a76:	eb 1c                	jmp    801a94 <memmove+0x80>
+        *--d = *--s;
+  801a78:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801a7d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801a82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a86:	0f b6 10             	movzbl (%rax),%edx
+  801a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a8f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a98:	83 e0 07             	and    $0x7,%eax
+  801a9b:	48 85 c0             	test   %rax,%rax
+  801a9e:	75 d8                	jne    801a78 <memmove+0x64>
+      nq = n / 8;
+  801aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa4:	48 c1 e8 03          	shr    $0x3,%rax
+  801aa8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801aac:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801ab1:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801ab6:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801abb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801abf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ac3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac7:	48 89 cf             	mov    %rcx,%rdi
+  801aca:	48 89 d6             	mov    %rdx,%rsi
+  801acd:	48 89 c1             	mov    %rax,%rcx
+  801ad0:	fd                   	std
+  801ad1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ad4:	fc                   	cld
+  801ad5:	48 89 c8             	mov    %rcx,%rax
+  801ad8:	48 89 f2             	mov    %rsi,%rdx
+  801adb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801adf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ae3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801ae7:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801aec:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801af1:	eb 17                	jmp    801b0a <memmove+0xf6>
+      *--d = *--s;
+  801af3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801af8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801afd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b01:	0f b6 10             	movzbl (%rax),%edx
+  801b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b08:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b0e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b12:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b16:	48 85 c0             	test   %rax,%rax
+  801b19:	75 d8                	jne    801af3 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801b1b:	e9 f4 00 00 00       	jmp    801c14 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801b20:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801b25:	76 46                	jbe    801b6d <memmove+0x159>
+  801b27:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	83 e0 01             	and    $0x1,%eax
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	74 33                	je     801b6d <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801b3a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b3e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b46:	48 89 cf             	mov    %rcx,%rdi
+  801b49:	48 89 d6             	mov    %rdx,%rsi
+  801b4c:	48 89 c1             	mov    %rax,%rcx
+  801b4f:	fc                   	cld
+  801b50:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801b52:	48 89 c8             	mov    %rcx,%rax
+  801b55:	48 89 f2             	mov    %rsi,%rdx
+  801b58:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b5c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b60:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801b64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b68:	e9 ab 00 00 00       	jmp    801c18 <memmove+0x204>
+    if (n >= 8) {
+  801b6d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b72:	0f 86 8b 00 00 00    	jbe    801c03 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801b78:	eb 22                	jmp    801b9c <memmove+0x188>
+        *d++ = *s++;
+  801b7a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b7e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b82:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801b86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b8a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b8e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b92:	0f b6 12             	movzbl (%rdx),%edx
+  801b95:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b97:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ba0:	83 e0 07             	and    $0x7,%eax
+  801ba3:	48 85 c0             	test   %rax,%rax
+  801ba6:	75 d2                	jne    801b7a <memmove+0x166>
+      nq = n / 8;
+  801ba8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bac:	48 c1 e8 03          	shr    $0x3,%rax
+  801bb0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801bb4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bb8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc0:	48 89 cf             	mov    %rcx,%rdi
+  801bc3:	48 89 d6             	mov    %rdx,%rsi
+  801bc6:	48 89 c1             	mov    %rax,%rcx
+  801bc9:	fc                   	cld
+  801bca:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801bcd:	48 89 c8             	mov    %rcx,%rax
+  801bd0:	48 89 f2             	mov    %rsi,%rdx
+  801bd3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bd7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bdb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801bdf:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801be4:	eb 1d                	jmp    801c03 <memmove+0x1ef>
+      *d++ = *s++;
+  801be6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bea:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801bee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801bfa:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801bfe:	0f b6 12             	movzbl (%rdx),%edx
+  801c01:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c07:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c0b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c0f:	48 85 c0             	test   %rax,%rax
+  801c12:	75 d2                	jne    801be6 <memmove+0x1d2>
+  return dst;
+  801c14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801c18:	c9                   	leave
+  801c19:	c3                   	ret
+
+0000000000801c1a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c1a:	55                   	push   %rbp
+  801c1b:	48 89 e5             	mov    %rsp,%rbp
+  801c1e:	48 83 ec 18          	sub    $0x18,%rsp
+  801c22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c26:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c2a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801c2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c32:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3a:	48 89 ce             	mov    %rcx,%rsi
+  801c3d:	48 89 c7             	mov    %rax,%rdi
+  801c40:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  801c47:	00 00 00 
+  801c4a:	ff d0                	call   *%rax
+}
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+0000000000801c4e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	48 83 ec 40          	sub    $0x40,%rsp
+  801c56:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c5a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c5e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801c62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801c6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801c72:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801c77:	0f 86 a7 00 00 00    	jbe    801d24 <memcmp+0xd6>
+  801c7d:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	83 e0 02             	and    $0x2,%eax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	0f 84 90 00 00 00    	je     801d24 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801c94:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c98:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca0:	48 89 ce             	mov    %rcx,%rsi
+  801ca3:	48 89 c7             	mov    %rax,%rdi
+  801ca6:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  801cad:	00 00 00 
+  801cb0:	ff d0                	call   *%rax
+  801cb2:	e9 c2 00 00 00       	jmp    801d79 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801cb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cbb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cbf:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801cc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cc7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ccb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ccf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801cd3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801cd6:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801cdd:	74 36                	je     801d15 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801cdf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ce2:	f7 d0                	not    %eax
+  801ce4:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ce8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ceb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801cee:	48 63 d0             	movslq %eax,%rdx
+  801cf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cf5:	48 01 d0             	add    %rdx,%rax
+  801cf8:	0f b6 00             	movzbl (%rax),%eax
+  801cfb:	0f b6 c0             	movzbl %al,%eax
+  801cfe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801d01:	48 63 ca             	movslq %edx,%rcx
+  801d04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d08:	48 01 ca             	add    %rcx,%rdx
+  801d0b:	0f b6 12             	movzbl (%rdx),%edx
+  801d0e:	0f b6 d2             	movzbl %dl,%edx
+  801d11:	29 d0                	sub    %edx,%eax
+  801d13:	eb 64                	jmp    801d79 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801d15:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801d1a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801d1f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801d24:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801d29:	77 8c                	ja     801cb7 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801d2b:	eb 36                	jmp    801d63 <memcmp+0x115>
+    if (*s1 != *s2)
+  801d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d31:	0f b6 10             	movzbl (%rax),%edx
+  801d34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d38:	0f b6 00             	movzbl (%rax),%eax
+  801d3b:	38 c2                	cmp    %al,%dl
+  801d3d:	74 1a                	je     801d59 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d43:	0f b6 00             	movzbl (%rax),%eax
+  801d46:	0f b6 c8             	movzbl %al,%ecx
+  801d49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d4d:	0f b6 00             	movzbl (%rax),%eax
+  801d50:	0f b6 d0             	movzbl %al,%edx
+  801d53:	89 c8                	mov    %ecx,%eax
+  801d55:	29 d0                	sub    %edx,%eax
+  801d57:	eb 20                	jmp    801d79 <memcmp+0x12b>
+    s1++, s2++;
+  801d59:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801d5e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801d63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d67:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d6b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d6f:	48 85 c0             	test   %rax,%rax
+  801d72:	75 b9                	jne    801d2d <memcmp+0xdf>
+  }
+
+  return 0;
+  801d74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d79:	c9                   	leave
+  801d7a:	c3                   	ret
+
+0000000000801d7b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+  801d7f:	48 83 ec 50          	sub    $0x50,%rsp
+  801d83:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801d87:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801d8a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801d8e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d92:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801d96:	48 01 d0             	add    %rdx,%rax
+  801d99:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801d9d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801da0:	66 0f 6e c0          	movd   %eax,%xmm0
+  801da4:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801da8:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801dac:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801db1:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801db5:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801dba:	76 73                	jbe    801e2f <memfind+0xb4>
+  801dbc:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  801dc3:	00 00 00 
+  801dc6:	ff d0                	call   *%rax
+  801dc8:	83 e0 02             	and    $0x2,%eax
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	74 60                	je     801e2f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801dcf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801dd2:	0f b6 c8             	movzbl %al,%ecx
+  801dd5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801dd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ddd:	89 ce                	mov    %ecx,%esi
+  801ddf:	48 89 c7             	mov    %rax,%rdi
+  801de2:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  801de9:	00 00 00 
+  801dec:	ff d0                	call   *%rax
+  801dee:	eb 6c                	jmp    801e5c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801df0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801df4:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801df8:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801dfc:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801e01:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e05:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e09:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801e0c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801e10:	74 13                	je     801e25 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801e12:	31 c0                	xor    %eax,%eax
+  801e14:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801e19:	48 63 d0             	movslq %eax,%rdx
+  801e1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e20:	48 01 d0             	add    %rdx,%rax
+  801e23:	eb 37                	jmp    801e5c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801e25:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801e2a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801e2f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801e34:	77 ba                	ja     801df0 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801e36:	eb 13                	jmp    801e4b <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801e38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3c:	0f b6 00             	movzbl (%rax),%eax
+  801e3f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801e42:	38 d0                	cmp    %dl,%al
+  801e44:	74 11                	je     801e57 <memfind+0xdc>
+  for (; s < ends; s++)
+  801e46:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801e4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e4f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801e53:	72 e3                	jb     801e38 <memfind+0xbd>
+  801e55:	eb 01                	jmp    801e58 <memfind+0xdd>
+      break;
+  801e57:	90                   	nop
+  return (void *)s;
+  801e58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801e5c:	c9                   	leave
+  801e5d:	c3                   	ret
+
+0000000000801e5e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	48 83 ec 38          	sub    $0x38,%rsp
+  801e66:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e6a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e6e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801e71:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801e78:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801e7f:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801e80:	eb 05                	jmp    801e87 <strtol+0x29>
+    s++;
+  801e82:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801e87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e8b:	0f b6 00             	movzbl (%rax),%eax
+  801e8e:	3c 20                	cmp    $0x20,%al
+  801e90:	74 f0                	je     801e82 <strtol+0x24>
+  801e92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e96:	0f b6 00             	movzbl (%rax),%eax
+  801e99:	3c 09                	cmp    $0x9,%al
+  801e9b:	74 e5                	je     801e82 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801e9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea1:	0f b6 00             	movzbl (%rax),%eax
+  801ea4:	3c 2b                	cmp    $0x2b,%al
+  801ea6:	75 07                	jne    801eaf <strtol+0x51>
+    s++;
+  801ea8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ead:	eb 17                	jmp    801ec6 <strtol+0x68>
+  else if (*s == '-')
+  801eaf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eb3:	0f b6 00             	movzbl (%rax),%eax
+  801eb6:	3c 2d                	cmp    $0x2d,%al
+  801eb8:	75 0c                	jne    801ec6 <strtol+0x68>
+    s++, neg = 1;
+  801eba:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ebf:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ec6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801eca:	74 06                	je     801ed2 <strtol+0x74>
+  801ecc:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ed0:	75 28                	jne    801efa <strtol+0x9c>
+  801ed2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed6:	0f b6 00             	movzbl (%rax),%eax
+  801ed9:	3c 30                	cmp    $0x30,%al
+  801edb:	75 1d                	jne    801efa <strtol+0x9c>
+  801edd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee1:	48 83 c0 01          	add    $0x1,%rax
+  801ee5:	0f b6 00             	movzbl (%rax),%eax
+  801ee8:	3c 78                	cmp    $0x78,%al
+  801eea:	75 0e                	jne    801efa <strtol+0x9c>
+    s += 2, base = 16;
+  801eec:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801ef1:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ef8:	eb 2c                	jmp    801f26 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801efa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801efe:	75 19                	jne    801f19 <strtol+0xbb>
+  801f00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f04:	0f b6 00             	movzbl (%rax),%eax
+  801f07:	3c 30                	cmp    $0x30,%al
+  801f09:	75 0e                	jne    801f19 <strtol+0xbb>
+    s++, base = 8;
+  801f0b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f10:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f17:	eb 0d                	jmp    801f26 <strtol+0xc8>
+  else if (base == 0)
+  801f19:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f1d:	75 07                	jne    801f26 <strtol+0xc8>
+    base = 10;
+  801f1f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801f26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f2a:	0f b6 00             	movzbl (%rax),%eax
+  801f2d:	3c 2f                	cmp    $0x2f,%al
+  801f2f:	7e 1d                	jle    801f4e <strtol+0xf0>
+  801f31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f35:	0f b6 00             	movzbl (%rax),%eax
+  801f38:	3c 39                	cmp    $0x39,%al
+  801f3a:	7f 12                	jg     801f4e <strtol+0xf0>
+      dig = *s - '0';
+  801f3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f40:	0f b6 00             	movzbl (%rax),%eax
+  801f43:	0f be c0             	movsbl %al,%eax
+  801f46:	83 e8 30             	sub    $0x30,%eax
+  801f49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f4c:	eb 4e                	jmp    801f9c <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801f4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f52:	0f b6 00             	movzbl (%rax),%eax
+  801f55:	3c 60                	cmp    $0x60,%al
+  801f57:	7e 1d                	jle    801f76 <strtol+0x118>
+  801f59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f5d:	0f b6 00             	movzbl (%rax),%eax
+  801f60:	3c 7a                	cmp    $0x7a,%al
+  801f62:	7f 12                	jg     801f76 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801f64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f68:	0f b6 00             	movzbl (%rax),%eax
+  801f6b:	0f be c0             	movsbl %al,%eax
+  801f6e:	83 e8 57             	sub    $0x57,%eax
+  801f71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f74:	eb 26                	jmp    801f9c <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801f76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f7a:	0f b6 00             	movzbl (%rax),%eax
+  801f7d:	3c 40                	cmp    $0x40,%al
+  801f7f:	7e 47                	jle    801fc8 <strtol+0x16a>
+  801f81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f85:	0f b6 00             	movzbl (%rax),%eax
+  801f88:	3c 5a                	cmp    $0x5a,%al
+  801f8a:	7f 3c                	jg     801fc8 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801f8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f90:	0f b6 00             	movzbl (%rax),%eax
+  801f93:	0f be c0             	movsbl %al,%eax
+  801f96:	83 e8 37             	sub    $0x37,%eax
+  801f99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801f9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f9f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801fa2:	7d 23                	jge    801fc7 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801fa4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fa9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801fac:	48 98                	cltq
+  801fae:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801fb3:	48 89 c2             	mov    %rax,%rdx
+  801fb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fb9:	48 98                	cltq
+  801fbb:	48 01 d0             	add    %rdx,%rax
+  801fbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801fc2:	e9 5f ff ff ff       	jmp    801f26 <strtol+0xc8>
+      break;
+  801fc7:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801fc8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801fcd:	74 0b                	je     801fda <strtol+0x17c>
+    *endptr = (char *)s;
+  801fcf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fd3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801fd7:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801fda:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801fde:	74 09                	je     801fe9 <strtol+0x18b>
+  801fe0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fe4:	48 f7 d8             	neg    %rax
+  801fe7:	eb 04                	jmp    801fed <strtol+0x18f>
+  801fe9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+0000000000801fef <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	53                   	push   %rbx
+  801ff4:	48 83 ec 48          	sub    $0x48,%rsp
+  801ff8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ffc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802000:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802004:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802008:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80200c:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802010:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802014:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802018:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80201c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802020:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802024:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802028:	4c 89 c3             	mov    %r8,%rbx
+  80202b:	cd 30                	int    $0x30
+  80202d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802031:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802036:	74 46                	je     80207e <syscall+0x8f>
+  802038:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80203d:	7e 3f                	jle    80207e <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80203f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802043:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802047:	49 89 d0             	mov    %rdx,%r8
+  80204a:	48 89 c1             	mov    %rax,%rcx
+  80204d:	48 b8 28 65 80 00 00 	movabs $0x806528,%rax
+  802054:	00 00 00 
+  802057:	48 89 c2             	mov    %rax,%rdx
+  80205a:	be 22 00 00 00       	mov    $0x22,%esi
+  80205f:	48 b8 47 65 80 00 00 	movabs $0x806547,%rax
+  802066:	00 00 00 
+  802069:	48 89 c7             	mov    %rax,%rdi
+  80206c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802071:	49 b9 02 03 80 00 00 	movabs $0x800302,%r9
+  802078:	00 00 00 
+  80207b:	41 ff d1             	call   *%r9
+
+  return ret;
+  80207e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802082:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+0000000000802088 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802088:	55                   	push   %rbp
+  802089:	48 89 e5             	mov    %rsp,%rbp
+  80208c:	48 83 ec 10          	sub    $0x10,%rsp
+  802090:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802094:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802098:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80209c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a4:	6a 00                	push   $0x0
+  8020a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b2:	48 89 d1             	mov    %rdx,%rcx
+  8020b5:	48 89 c2             	mov    %rax,%rdx
+  8020b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020c2:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8020c9:	00 00 00 
+  8020cc:	ff d0                	call   *%rax
+  8020ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d2:	90                   	nop
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+00000000008020d5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8020d5:	55                   	push   %rbp
+  8020d6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020dd:	6a 00                	push   $0x0
+  8020df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020ff:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+
+0000000000802111 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802111:	55                   	push   %rbp
+  802112:	48 89 e5             	mov    %rsp,%rbp
+  802115:	48 83 ec 10          	sub    $0x10,%rsp
+  802119:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80211c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80211f:	48 98                	cltq
+  802121:	48 83 ec 08          	sub    $0x8,%rsp
+  802125:	6a 00                	push   $0x0
+  802127:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80212d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802133:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802138:	48 89 c2             	mov    %rax,%rdx
+  80213b:	be 01 00 00 00       	mov    $0x1,%esi
+  802140:	bf 03 00 00 00       	mov    $0x3,%edi
+  802145:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+  802151:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802155:	c9                   	leave
+  802156:	c3                   	ret
+
+0000000000802157 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802157:	55                   	push   %rbp
+  802158:	48 89 e5             	mov    %rsp,%rbp
+  80215b:	48 83 ec 10          	sub    $0x10,%rsp
+  80215f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802162:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802165:	48 98                	cltq
+  802167:	48 83 ec 08          	sub    $0x8,%rsp
+  80216b:	6a 00                	push   $0x0
+  80216d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802179:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80217e:	48 89 c2             	mov    %rax,%rdx
+  802181:	be 00 00 00 00       	mov    $0x0,%esi
+  802186:	bf 04 00 00 00       	mov    $0x4,%edi
+  80218b:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802192:	00 00 00 
+  802195:	ff d0                	call   *%rax
+  802197:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219b:	90                   	nop
+  80219c:	c9                   	leave
+  80219d:	c3                   	ret
+
+000000000080219e <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+  8021a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8021a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8021ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021b0:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8021b3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021b8:	cd 30                	int    $0x30
+  8021ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8021be:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8021c2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8021c7:	7e 3d                	jle    802206 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8021c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021cd:	49 89 c0             	mov    %rax,%r8
+  8021d0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8021d5:	48 b8 28 65 80 00 00 	movabs $0x806528,%rax
+  8021dc:	00 00 00 
+  8021df:	48 89 c2             	mov    %rax,%rdx
+  8021e2:	be 49 00 00 00       	mov    $0x49,%esi
+  8021e7:	48 b8 47 65 80 00 00 	movabs $0x806547,%rax
+  8021ee:	00 00 00 
+  8021f1:	48 89 c7             	mov    %rax,%rdi
+  8021f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f9:	49 b9 02 03 80 00 00 	movabs $0x800302,%r9
+  802200:	00 00 00 
+  802203:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802206:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80220b:	75 13                	jne    802220 <sys_env_wait+0x82>
+  80220d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802212:	74 0c                	je     802220 <sys_env_wait+0x82>
+    *status = st;
+  802214:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802218:	89 c2                	mov    %eax,%edx
+  80221a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80221e:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+
+0000000000802226 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80222a:	48 83 ec 08          	sub    $0x8,%rsp
+  80222e:	6a 00                	push   $0x0
+  802230:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802236:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802241:	ba 00 00 00 00       	mov    $0x0,%edx
+  802246:	be 00 00 00 00       	mov    $0x0,%esi
+  80224b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802250:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+  80225c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+
+0000000000802262 <sys_yield>:
+
+void
+sys_yield(void) {
+  802262:	55                   	push   %rbp
+  802263:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802266:	48 83 ec 08          	sub    $0x8,%rsp
+  80226a:	6a 00                	push   $0x0
+  80226c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802272:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802278:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802282:	be 00 00 00 00       	mov    $0x0,%esi
+  802287:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80228c:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+  802298:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80229c:	90                   	nop
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+
+000000000080229f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80229f:	55                   	push   %rbp
+  8022a0:	48 89 e5             	mov    %rsp,%rbp
+  8022a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8022a7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8022aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8022ae:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8022b1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022b4:	48 63 c8             	movslq %eax,%rcx
+  8022b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8022bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022be:	48 98                	cltq
+  8022c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c4:	6a 00                	push   $0x0
+  8022c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cc:	49 89 c8             	mov    %rcx,%r8
+  8022cf:	48 89 d1             	mov    %rdx,%rcx
+  8022d2:	48 89 c2             	mov    %rax,%rdx
+  8022d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8022da:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022df:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+  8022eb:	48 83 c4 10          	add    $0x10,%rsp
+  8022ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8022f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022f5:	c9                   	leave
+  8022f6:	c3                   	ret
+
+00000000008022f7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8022ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802302:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802306:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802309:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80230d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802311:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802314:	48 63 c8             	movslq %eax,%rcx
+  802317:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80231b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80231e:	48 63 f0             	movslq %eax,%rsi
+  802321:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802325:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802328:	48 98                	cltq
+  80232a:	48 83 ec 08          	sub    $0x8,%rsp
+  80232e:	51                   	push   %rcx
+  80232f:	49 89 f9             	mov    %rdi,%r9
+  802332:	49 89 f0             	mov    %rsi,%r8
+  802335:	48 89 d1             	mov    %rdx,%rcx
+  802338:	48 89 c2             	mov    %rax,%rdx
+  80233b:	be 01 00 00 00       	mov    $0x1,%esi
+  802340:	bf 07 00 00 00       	mov    $0x7,%edi
+  802345:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+
+0000000000802357 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	48 83 ec 10          	sub    $0x10,%rsp
+  80235f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802366:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80236a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80236d:	48 98                	cltq
+  80236f:	48 83 ec 08          	sub    $0x8,%rsp
+  802373:	6a 00                	push   $0x0
+  802375:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80237b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802381:	48 89 d1             	mov    %rdx,%rcx
+  802384:	48 89 c2             	mov    %rax,%rdx
+  802387:	be 01 00 00 00       	mov    $0x1,%esi
+  80238c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802391:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+  80239d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+
+00000000008023a3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+  8023a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ae:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8023b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023b4:	48 63 d0             	movslq %eax,%rdx
+  8023b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023ba:	48 98                	cltq
+  8023bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c0:	6a 00                	push   $0x0
+  8023c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023ce:	48 89 d1             	mov    %rdx,%rcx
+  8023d1:	48 89 c2             	mov    %rax,%rdx
+  8023d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8023d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8023de:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ee:	c9                   	leave
+  8023ef:	c3                   	ret
+
+00000000008023f0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8023f0:	55                   	push   %rbp
+  8023f1:	48 89 e5             	mov    %rsp,%rbp
+  8023f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8023ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802403:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802406:	48 98                	cltq
+  802408:	48 83 ec 08          	sub    $0x8,%rsp
+  80240c:	6a 00                	push   $0x0
+  80240e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802414:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80241a:	48 89 d1             	mov    %rdx,%rcx
+  80241d:	48 89 c2             	mov    %rax,%rdx
+  802420:	be 01 00 00 00       	mov    $0x1,%esi
+  802425:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80242a:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+  802436:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+
+000000000080243c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80243c:	55                   	push   %rbp
+  80243d:	48 89 e5             	mov    %rsp,%rbp
+  802440:	48 83 ec 10          	sub    $0x10,%rsp
+  802444:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802447:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80244b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80244f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802452:	48 98                	cltq
+  802454:	48 83 ec 08          	sub    $0x8,%rsp
+  802458:	6a 00                	push   $0x0
+  80245a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802460:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802466:	48 89 d1             	mov    %rdx,%rcx
+  802469:	48 89 c2             	mov    %rax,%rdx
+  80246c:	be 01 00 00 00       	mov    $0x1,%esi
+  802471:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802476:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+  802482:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802486:	c9                   	leave
+  802487:	c3                   	ret
+
+0000000000802488 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802488:	55                   	push   %rbp
+  802489:	48 89 e5             	mov    %rsp,%rbp
+  80248c:	48 83 ec 20          	sub    $0x20,%rsp
+  802490:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802493:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802497:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80249b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80249e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024a1:	48 63 f0             	movslq %eax,%rsi
+  8024a4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8024a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024af:	48 98                	cltq
+  8024b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b5:	6a 00                	push   $0x0
+  8024b7:	49 89 f1             	mov    %rsi,%r9
+  8024ba:	49 89 c8             	mov    %rcx,%r8
+  8024bd:	48 89 d1             	mov    %rdx,%rcx
+  8024c0:	48 89 c2             	mov    %rax,%rdx
+  8024c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8024cd:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+  8024d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024dd:	c9                   	leave
+  8024de:	c3                   	ret
+
+00000000008024df <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8024df:	55                   	push   %rbp
+  8024e0:	48 89 e5             	mov    %rsp,%rbp
+  8024e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8024eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f3:	6a 00                	push   $0x0
+  8024f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802501:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802506:	48 89 c2             	mov    %rax,%rdx
+  802509:	be 01 00 00 00       	mov    $0x1,%esi
+  80250e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802513:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+  80251f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+0000000000802525 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802525:	55                   	push   %rbp
+  802526:	48 89 e5             	mov    %rsp,%rbp
+  802529:	48 83 ec 10          	sub    $0x10,%rsp
+  80252d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802531:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802535:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253d:	48 83 ec 08          	sub    $0x8,%rsp
+  802541:	6a 00                	push   $0x0
+  802543:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802549:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80254f:	48 89 d1             	mov    %rdx,%rcx
+  802552:	48 89 c2             	mov    %rax,%rdx
+  802555:	be 01 00 00 00       	mov    $0x1,%esi
+  80255a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80255f:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802566:	00 00 00 
+  802569:	ff d0                	call   *%rax
+  80256b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80256f:	c9                   	leave
+  802570:	c3                   	ret
+
+0000000000802571 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802571:	55                   	push   %rbp
+  802572:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802575:	48 83 ec 08          	sub    $0x8,%rsp
+  802579:	6a 00                	push   $0x0
+  80257b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802581:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802587:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802591:	be 00 00 00 00       	mov    $0x0,%esi
+  802596:	bf 11 00 00 00       	mov    $0x11,%edi
+  80259b:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+  8025a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ab:	c9                   	leave
+  8025ac:	c3                   	ret
+
+00000000008025ad <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8025ad:	55                   	push   %rbp
+  8025ae:	48 89 e5             	mov    %rsp,%rbp
+  8025b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8025bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c9:	6a 00                	push   $0x0
+  8025cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025d7:	48 89 d1             	mov    %rdx,%rcx
+  8025da:	48 89 c2             	mov    %rax,%rdx
+  8025dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e2:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025e7:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+00000000008025f9 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	48 83 ec 20          	sub    $0x20,%rsp
+  802601:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802605:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802609:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80260c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80260f:	48 63 c8             	movslq %eax,%rcx
+  802612:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261a:	48 83 ec 08          	sub    $0x8,%rsp
+  80261e:	6a 00                	push   $0x0
+  802620:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802626:	49 89 c8             	mov    %rcx,%r8
+  802629:	48 89 d1             	mov    %rdx,%rcx
+  80262c:	48 89 c2             	mov    %rax,%rdx
+  80262f:	be 00 00 00 00       	mov    $0x0,%esi
+  802634:	bf 13 00 00 00       	mov    $0x13,%edi
+  802639:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+  802645:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802649:	c9                   	leave
+  80264a:	c3                   	ret
+
+000000000080264b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80264b:	55                   	push   %rbp
+  80264c:	48 89 e5             	mov    %rsp,%rbp
+  80264f:	48 83 ec 20          	sub    $0x20,%rsp
+  802653:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802657:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80265a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80265e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802662:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802669:	48 83 ec 08          	sub    $0x8,%rsp
+  80266d:	6a 00                	push   $0x0
+  80266f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802675:	49 89 c8             	mov    %rcx,%r8
+  802678:	48 89 d1             	mov    %rdx,%rcx
+  80267b:	48 89 c2             	mov    %rax,%rdx
+  80267e:	be 00 00 00 00       	mov    $0x0,%esi
+  802683:	bf 14 00 00 00       	mov    $0x14,%edi
+  802688:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80268f:	00 00 00 
+  802692:	ff d0                	call   *%rax
+  802694:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802698:	c9                   	leave
+  802699:	c3                   	ret
+
+000000000080269a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80269a:	55                   	push   %rbp
+  80269b:	48 89 e5             	mov    %rsp,%rbp
+  80269e:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026a6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8026a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8026ac:	48 63 d0             	movslq %eax,%rdx
+  8026af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b7:	6a 00                	push   $0x0
+  8026b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c5:	48 89 d1             	mov    %rdx,%rcx
+  8026c8:	48 89 c2             	mov    %rax,%rdx
+  8026cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d0:	bf 15 00 00 00       	mov    $0x15,%edi
+  8026d5:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+  8026e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+
+00000000008026e7 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8026ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8026f6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8026f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8026fd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802701:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802704:	48 63 c8             	movslq %eax,%rcx
+  802707:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80270a:	48 63 d0             	movslq %eax,%rdx
+  80270d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802711:	48 83 ec 08          	sub    $0x8,%rsp
+  802715:	6a 00                	push   $0x0
+  802717:	49 89 f1             	mov    %rsi,%r9
+  80271a:	49 89 c8             	mov    %rcx,%r8
+  80271d:	48 89 d1             	mov    %rdx,%rcx
+  802720:	48 89 c2             	mov    %rax,%rdx
+  802723:	be 00 00 00 00       	mov    $0x0,%esi
+  802728:	bf 16 00 00 00       	mov    $0x16,%edi
+  80272d:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802734:	00 00 00 
+  802737:	ff d0                	call   *%rax
+  802739:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80273d:	c9                   	leave
+  80273e:	c3                   	ret
+
+000000000080273f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+  802743:	48 83 ec 30          	sub    $0x30,%rsp
+  802747:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80274b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802753:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802757:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80275b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80275f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802763:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802767:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80276b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80276f:	48 83 ec 08          	sub    $0x8,%rsp
+  802773:	51                   	push   %rcx
+  802774:	49 89 f9             	mov    %rdi,%r9
+  802777:	49 89 f0             	mov    %rsi,%r8
+  80277a:	48 89 d1             	mov    %rdx,%rcx
+  80277d:	48 89 c2             	mov    %rax,%rdx
+  802780:	be 00 00 00 00       	mov    $0x0,%esi
+  802785:	bf 17 00 00 00       	mov    $0x17,%edi
+  80278a:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+000000000080279c <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80279c:	55                   	push   %rbp
+  80279d:	48 89 e5             	mov    %rsp,%rbp
+  8027a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8027a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027aa:	48 98                	cltq
+  8027ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b0:	6a 00                	push   $0x0
+  8027b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c3:	48 89 c2             	mov    %rax,%rdx
+  8027c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cb:	bf 18 00 00 00       	mov    $0x18,%edi
+  8027d0:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+  8027dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027e0:	90                   	nop
+  8027e1:	c9                   	leave
+  8027e2:	c3                   	ret
+
+00000000008027e3 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8027e3:	55                   	push   %rbp
+  8027e4:	48 89 e5             	mov    %rsp,%rbp
+  8027e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8027eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8027f6:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8027f9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8027fc:	48 63 f0             	movslq %eax,%rsi
+  8027ff:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802803:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802807:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80280a:	48 98                	cltq
+  80280c:	48 83 ec 08          	sub    $0x8,%rsp
+  802810:	6a 00                	push   $0x0
+  802812:	49 89 f1             	mov    %rsi,%r9
+  802815:	49 89 c8             	mov    %rcx,%r8
+  802818:	48 89 d1             	mov    %rdx,%rcx
+  80281b:	48 89 c2             	mov    %rax,%rdx
+  80281e:	be 01 00 00 00       	mov    $0x1,%esi
+  802823:	bf 19 00 00 00       	mov    $0x19,%edi
+  802828:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	48 83 c4 10          	add    $0x10,%rsp
+  802838:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80283b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80283e:	c9                   	leave
+  80283f:	c3                   	ret
+
+0000000000802840 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802840:	55                   	push   %rbp
+  802841:	48 89 e5             	mov    %rsp,%rbp
+  802844:	48 83 ec 20          	sub    $0x20,%rsp
+  802848:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80284c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802850:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802853:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802856:	48 63 c8             	movslq %eax,%rcx
+  802859:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80285d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802861:	48 83 ec 08          	sub    $0x8,%rsp
+  802865:	6a 00                	push   $0x0
+  802867:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80286d:	49 89 c8             	mov    %rcx,%r8
+  802870:	48 89 d1             	mov    %rdx,%rcx
+  802873:	48 89 c2             	mov    %rax,%rdx
+  802876:	be 01 00 00 00       	mov    $0x1,%esi
+  80287b:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802880:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  802887:	00 00 00 
+  80288a:	ff d0                	call   *%rax
+  80288c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802890:	c9                   	leave
+  802891:	c3                   	ret
+
+0000000000802892 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802892:	55                   	push   %rbp
+  802893:	48 89 e5             	mov    %rsp,%rbp
+  802896:	48 83 ec 20          	sub    $0x20,%rsp
+  80289a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80289e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8028a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8028aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b6:	6a 00                	push   $0x0
+  8028b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028be:	49 89 c8             	mov    %rcx,%r8
+  8028c1:	48 89 d1             	mov    %rdx,%rcx
+  8028c4:	48 89 c2             	mov    %rax,%rdx
+  8028c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028cc:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8028d1:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+  8028dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028e1:	c9                   	leave
+  8028e2:	c3                   	ret
+
+00000000008028e3 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8028e3:	55                   	push   %rbp
+  8028e4:	48 89 e5             	mov    %rsp,%rbp
+  8028e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8028eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028f3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8028f6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8028fa:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8028fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802901:	48 63 c8             	movslq %eax,%rcx
+  802904:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802908:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80290c:	48 83 ec 08          	sub    $0x8,%rsp
+  802910:	6a 00                	push   $0x0
+  802912:	49 89 f1             	mov    %rsi,%r9
+  802915:	49 89 c8             	mov    %rcx,%r8
+  802918:	48 89 d1             	mov    %rdx,%rcx
+  80291b:	48 89 c2             	mov    %rax,%rdx
+  80291e:	be 01 00 00 00       	mov    $0x1,%esi
+  802923:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802928:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80292f:	00 00 00 
+  802932:	ff d0                	call   *%rax
+  802934:	48 83 c4 10          	add    $0x10,%rsp
+  802938:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80293b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80293e:	c9                   	leave
+  80293f:	c3                   	ret
+
+0000000000802940 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802940:	55                   	push   %rbp
+  802941:	48 89 e5             	mov    %rsp,%rbp
+  802944:	48 83 ec 10          	sub    $0x10,%rsp
+  802948:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80294b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80294e:	48 98                	cltq
+  802950:	48 83 ec 08          	sub    $0x8,%rsp
+  802954:	6a 00                	push   $0x0
+  802956:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80295c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802962:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802967:	48 89 c2             	mov    %rax,%rdx
+  80296a:	be 01 00 00 00       	mov    $0x1,%esi
+  80296f:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802974:	48 b8 ef 1f 80 00 00 	movabs $0x801fef,%rax
+  80297b:	00 00 00 
+  80297e:	ff d0                	call   *%rax
+  802980:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+0000000000802986 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802986:	55                   	push   %rbp
+  802987:	48 89 e5             	mov    %rsp,%rbp
+  80298a:	48 83 ec 08          	sub    $0x8,%rsp
+  80298e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802992:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802996:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80299d:	ff ff ff 
+  8029a0:	48 01 d0             	add    %rdx,%rax
+  8029a3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+
+00000000008029a9 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8029a9:	55                   	push   %rbp
+  8029aa:	48 89 e5             	mov    %rsp,%rbp
+  8029ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8029b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029b9:	48 89 c7             	mov    %rax,%rdi
+  8029bc:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8029ce:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8029d2:	c9                   	leave
+  8029d3:	c3                   	ret
+
+00000000008029d4 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8029d4:	55                   	push   %rbp
+  8029d5:	48 89 e5             	mov    %rsp,%rbp
+  8029d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8029dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8029e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029e7:	e9 ae 00 00 00       	jmp    802a9a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8029ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029ef:	c1 e0 0c             	shl    $0xc,%eax
+  8029f2:	48 98                	cltq
+  8029f4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8029f9:	48 01 d0             	add    %rdx,%rax
+  8029fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a04:	48 c1 e8 27          	shr    $0x27,%rax
+  802a08:	48 89 c2             	mov    %rax,%rdx
+  802a0b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a12:	01 00 00 
+  802a15:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a19:	83 e0 01             	and    $0x1,%eax
+  802a1c:	48 85 c0             	test   %rax,%rax
+  802a1f:	74 63                	je     802a84 <fd_alloc+0xb0>
+  802a21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a25:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a29:	48 89 c2             	mov    %rax,%rdx
+  802a2c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802a33:	01 00 00 
+  802a36:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a3a:	83 e0 01             	and    $0x1,%eax
+  802a3d:	48 85 c0             	test   %rax,%rax
+  802a40:	74 42                	je     802a84 <fd_alloc+0xb0>
+  802a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a46:	48 c1 e8 15          	shr    $0x15,%rax
+  802a4a:	48 89 c2             	mov    %rax,%rdx
+  802a4d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802a54:	01 00 00 
+  802a57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a5b:	83 e0 01             	and    $0x1,%eax
+  802a5e:	48 85 c0             	test   %rax,%rax
+  802a61:	74 21                	je     802a84 <fd_alloc+0xb0>
+  802a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a67:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a6b:	48 89 c2             	mov    %rax,%rdx
+  802a6e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a75:	01 00 00 
+  802a78:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a7c:	83 e0 01             	and    $0x1,%eax
+  802a7f:	48 85 c0             	test   %rax,%rax
+  802a82:	75 12                	jne    802a96 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802a84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a88:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a8c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a94:	eb 1e                	jmp    802ab4 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802a96:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a9a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a9e:	0f 8e 48 ff ff ff    	jle    8029ec <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aa8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802aaf:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802ab4:	c9                   	leave
+  802ab5:	c3                   	ret
+
+0000000000802ab6 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802ab6:	55                   	push   %rbp
+  802ab7:	48 89 e5             	mov    %rsp,%rbp
+  802aba:	48 83 ec 20          	sub    $0x20,%rsp
+  802abe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ac1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802ac5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ac9:	78 06                	js     802ad1 <fd_lookup+0x1b>
+  802acb:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802acf:	7e 0a                	jle    802adb <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802ad1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad6:	e9 af 00 00 00       	jmp    802b8a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802adb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ade:	c1 e0 0c             	shl    $0xc,%eax
+  802ae1:	48 98                	cltq
+  802ae3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ae8:	48 01 d0             	add    %rdx,%rax
+  802aeb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802af3:	48 c1 e8 27          	shr    $0x27,%rax
+  802af7:	48 89 c2             	mov    %rax,%rdx
+  802afa:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b01:	01 00 00 
+  802b04:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b08:	83 e0 01             	and    $0x1,%eax
+  802b0b:	48 85 c0             	test   %rax,%rax
+  802b0e:	74 63                	je     802b73 <fd_lookup+0xbd>
+  802b10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b14:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b18:	48 89 c2             	mov    %rax,%rdx
+  802b1b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b22:	01 00 00 
+  802b25:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b29:	83 e0 01             	and    $0x1,%eax
+  802b2c:	48 85 c0             	test   %rax,%rax
+  802b2f:	74 42                	je     802b73 <fd_lookup+0xbd>
+  802b31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b35:	48 c1 e8 15          	shr    $0x15,%rax
+  802b39:	48 89 c2             	mov    %rax,%rdx
+  802b3c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b43:	01 00 00 
+  802b46:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b4a:	83 e0 01             	and    $0x1,%eax
+  802b4d:	48 85 c0             	test   %rax,%rax
+  802b50:	74 21                	je     802b73 <fd_lookup+0xbd>
+  802b52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b56:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b5a:	48 89 c2             	mov    %rax,%rdx
+  802b5d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b64:	01 00 00 
+  802b67:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b6b:	83 e0 01             	and    $0x1,%eax
+  802b6e:	48 85 c0             	test   %rax,%rax
+  802b71:	75 07                	jne    802b7a <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b78:	eb 10                	jmp    802b8a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802b7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b7e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b82:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802b85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+0000000000802b8c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	48 83 ec 30          	sub    $0x30,%rsp
+  802b94:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802b98:	89 f0                	mov    %esi,%eax
+  802b9a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802b9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ba1:	48 89 c7             	mov    %rax,%rdi
+  802ba4:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	89 c2                	mov    %eax,%edx
+  802bb2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802bb6:	48 89 c6             	mov    %rax,%rsi
+  802bb9:	89 d7                	mov    %edx,%edi
+  802bbb:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  802bc2:	00 00 00 
+  802bc5:	ff d0                	call   *%rax
+  802bc7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bce:	78 0a                	js     802bda <fd_close+0x4e>
+  802bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bd4:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802bd8:	74 12                	je     802bec <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802bda:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802bde:	74 05                	je     802be5 <fd_close+0x59>
+  802be0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802be3:	eb 70                	jmp    802c55 <fd_close+0xc9>
+  802be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bea:	eb 69                	jmp    802c55 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802bec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bf0:	8b 00                	mov    (%rax),%eax
+  802bf2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802bf6:	48 89 d6             	mov    %rdx,%rsi
+  802bf9:	89 c7                	mov    %eax,%edi
+  802bfb:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  802c02:	00 00 00 
+  802c05:	ff d0                	call   *%rax
+  802c07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c0a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c0e:	78 2a                	js     802c3a <fd_close+0xae>
+    if (dev->dev_close)
+  802c10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c14:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c18:	48 85 c0             	test   %rax,%rax
+  802c1b:	74 16                	je     802c33 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802c1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c21:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c29:	48 89 c7             	mov    %rax,%rdi
+  802c2c:	ff d2                	call   *%rdx
+  802c2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c31:	eb 07                	jmp    802c3a <fd_close+0xae>
+    else
+      r = 0;
+  802c33:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802c3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c3e:	48 89 c6             	mov    %rax,%rsi
+  802c41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c46:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  return r;
+  802c52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+
+0000000000802c57 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802c57:	55                   	push   %rbp
+  802c58:	48 89 e5             	mov    %rsp,%rbp
+  802c5b:	48 83 ec 20          	sub    $0x20,%rsp
+  802c5f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c62:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802c66:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802c6d:	eb 3f                	jmp    802cae <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802c6f:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802c76:	00 00 00 
+  802c79:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c7c:	48 98                	cltq
+  802c7e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c82:	8b 00                	mov    (%rax),%eax
+  802c84:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802c87:	75 21                	jne    802caa <dev_lookup+0x53>
+      *dev = devtab[i];
+  802c89:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802c90:	00 00 00 
+  802c93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c96:	48 98                	cltq
+  802c98:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ca0:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca8:	eb 7f                	jmp    802d29 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802caa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802cae:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802cb5:	00 00 00 
+  802cb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cbb:	48 98                	cltq
+  802cbd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cc1:	48 85 c0             	test   %rax,%rax
+  802cc4:	75 a9                	jne    802c6f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802cc6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802ccd:	00 00 00 
+  802cd0:	8b 40 04             	mov    0x4(%rax),%eax
+  802cd3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802cd8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802cdf:	00 00 00 
+  802ce2:	48 98                	cltq
+  802ce4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802ceb:	48 01 d0             	add    %rdx,%rax
+  802cee:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802cf4:	8b 00                	mov    (%rax),%eax
+  802cf6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802cf9:	89 c6                	mov    %eax,%esi
+  802cfb:	48 b8 58 65 80 00 00 	movabs $0x806558,%rax
+  802d02:	00 00 00 
+  802d05:	48 89 c7             	mov    %rax,%rdi
+  802d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0d:	48 b9 21 05 80 00 00 	movabs $0x800521,%rcx
+  802d14:	00 00 00 
+  802d17:	ff d1                	call   *%rcx
+  *dev = 0;
+  802d19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d1d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802d24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d29:	c9                   	leave
+  802d2a:	c3                   	ret
+
+0000000000802d2b <close>:
+
+int
+close(int fdnum) {
+  802d2b:	55                   	push   %rbp
+  802d2c:	48 89 e5             	mov    %rsp,%rbp
+  802d2f:	48 83 ec 20          	sub    $0x20,%rsp
+  802d33:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d36:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d3d:	48 89 d6             	mov    %rdx,%rsi
+  802d40:	89 c7                	mov    %eax,%edi
+  802d42:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  802d49:	00 00 00 
+  802d4c:	ff d0                	call   *%rax
+  802d4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d55:	79 05                	jns    802d5c <close+0x31>
+    return r;
+  802d57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d5a:	eb 18                	jmp    802d74 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802d5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d60:	be 01 00 00 00       	mov    $0x1,%esi
+  802d65:	48 89 c7             	mov    %rax,%rdi
+  802d68:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+}
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <close_all>:
+
+void
+close_all(void) {
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802d7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d85:	eb 15                	jmp    802d9c <close_all+0x26>
+    close(i);
+  802d87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d8a:	89 c7                	mov    %eax,%edi
+  802d8c:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802d98:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d9c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802da0:	7e e5                	jle    802d87 <close_all+0x11>
+}
+  802da2:	90                   	nop
+  802da3:	90                   	nop
+  802da4:	c9                   	leave
+  802da5:	c3                   	ret
+
+0000000000802da6 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802da6:	55                   	push   %rbp
+  802da7:	48 89 e5             	mov    %rsp,%rbp
+  802daa:	48 83 ec 40          	sub    $0x40,%rsp
+  802dae:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802db1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802db4:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802db8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802dbb:	48 89 d6             	mov    %rdx,%rsi
+  802dbe:	89 c7                	mov    %eax,%edi
+  802dc0:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  802dc7:	00 00 00 
+  802dca:	ff d0                	call   *%rax
+  802dcc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dcf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dd3:	79 08                	jns    802ddd <dup+0x37>
+    return r;
+  802dd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dd8:	e9 33 02 00 00       	jmp    803010 <dup+0x26a>
+  close(newfdnum);
+  802ddd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802de0:	89 c7                	mov    %eax,%edi
+  802de2:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  802de9:	00 00 00 
+  802dec:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802dee:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802df1:	c1 e0 0c             	shl    $0xc,%eax
+  802df4:	48 98                	cltq
+  802df6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802dfb:	48 01 d0             	add    %rdx,%rax
+  802dfe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802e02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e06:	48 89 c7             	mov    %rax,%rdi
+  802e09:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  802e10:	00 00 00 
+  802e13:	ff d0                	call   *%rax
+  802e15:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802e19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e1d:	48 89 c7             	mov    %rax,%rdi
+  802e20:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  802e27:	00 00 00 
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802e30:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802e37:	00 
+  802e38:	e9 19 01 00 00       	jmp    802f56 <dup+0x1b0>
+    off -= PGSIZE;
+  802e3d:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802e44:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802e45:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e4d:	48 01 d0             	add    %rdx,%rax
+  802e50:	48 c1 e8 27          	shr    $0x27,%rax
+  802e54:	48 89 c2             	mov    %rax,%rdx
+  802e57:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802e5e:	01 00 00 
+  802e61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e65:	83 e0 01             	and    $0x1,%eax
+  802e68:	48 85 c0             	test   %rax,%rax
+  802e6b:	0f 84 e5 00 00 00    	je     802f56 <dup+0x1b0>
+  802e71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e79:	48 01 d0             	add    %rdx,%rax
+  802e7c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e80:	48 89 c2             	mov    %rax,%rdx
+  802e83:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802e8a:	01 00 00 
+  802e8d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e91:	83 e0 01             	and    $0x1,%eax
+  802e94:	48 85 c0             	test   %rax,%rax
+  802e97:	0f 84 b9 00 00 00    	je     802f56 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802e9d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ea1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea5:	48 01 d0             	add    %rdx,%rax
+  802ea8:	48 c1 e8 15          	shr    $0x15,%rax
+  802eac:	48 89 c2             	mov    %rax,%rdx
+  802eaf:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802eb6:	01 00 00 
+  802eb9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ebd:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ec0:	48 85 c0             	test   %rax,%rax
+  802ec3:	0f 84 8d 00 00 00    	je     802f56 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802ec9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ecd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ed1:	48 01 d0             	add    %rdx,%rax
+  802ed4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ed8:	48 89 c2             	mov    %rax,%rdx
+  802edb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ee2:	01 00 00 
+  802ee5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ee9:	83 e0 01             	and    $0x1,%eax
+  802eec:	48 85 c0             	test   %rax,%rax
+  802eef:	74 65                	je     802f56 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802ef1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ef5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ef9:	48 01 d0             	add    %rdx,%rax
+  802efc:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f00:	48 89 c2             	mov    %rax,%rdx
+  802f03:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f0a:	01 00 00 
+  802f0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f11:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f16:	89 c6                	mov    %eax,%esi
+  802f18:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f20:	48 01 c2             	add    %rax,%rdx
+  802f23:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f2b:	48 01 c8             	add    %rcx,%rax
+  802f2e:	41 89 f0             	mov    %esi,%r8d
+  802f31:	48 89 d1             	mov    %rdx,%rcx
+  802f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f39:	48 89 c6             	mov    %rax,%rsi
+  802f3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f41:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802f48:	00 00 00 
+  802f4b:	ff d0                	call   *%rax
+  802f4d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f50:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f54:	78 60                	js     802fb6 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802f56:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802f5b:	0f 85 dc fe ff ff    	jne    802e3d <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f65:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f69:	48 89 c2             	mov    %rax,%rdx
+  802f6c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f73:	01 00 00 
+  802f76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f7a:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f7f:	89 c1                	mov    %eax,%ecx
+  802f81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f85:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f89:	41 89 c8             	mov    %ecx,%r8d
+  802f8c:	48 89 d1             	mov    %rdx,%rcx
+  802f8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f94:	48 89 c6             	mov    %rax,%rsi
+  802f97:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f9c:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+  802fa8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802faf:	78 08                	js     802fb9 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802fb1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802fb4:	eb 5a                	jmp    803010 <dup+0x26a>
+        goto err;
+  802fb6:	90                   	nop
+  802fb7:	eb 01                	jmp    802fba <dup+0x214>
+    goto err;
+  802fb9:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802fba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fbe:	48 89 c6             	mov    %rax,%rsi
+  802fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc6:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802fd2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802fd9:	00 
+  802fda:	eb 27                	jmp    803003 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802fdc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fe0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fe4:	48 01 d0             	add    %rdx,%rax
+  802fe7:	48 89 c6             	mov    %rax,%rsi
+  802fea:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fef:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802ffb:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803002:	00 
+  803003:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80300a:	00 
+  80300b:	76 cf                	jbe    802fdc <dup+0x236>
+  return r;
+  80300d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803010:	c9                   	leave
+  803011:	c3                   	ret
+
+0000000000803012 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803012:	55                   	push   %rbp
+  803013:	48 89 e5             	mov    %rsp,%rbp
+  803016:	48 83 ec 40          	sub    $0x40,%rsp
+  80301a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80301d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803021:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803025:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803029:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80302c:	48 89 d6             	mov    %rdx,%rsi
+  80302f:	89 c7                	mov    %eax,%edi
+  803031:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  803038:	00 00 00 
+  80303b:	ff d0                	call   *%rax
+  80303d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803040:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803044:	78 24                	js     80306a <read+0x58>
+  803046:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80304a:	8b 00                	mov    (%rax),%eax
+  80304c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803050:	48 89 d6             	mov    %rdx,%rsi
+  803053:	89 c7                	mov    %eax,%edi
+  803055:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  80305c:	00 00 00 
+  80305f:	ff d0                	call   *%rax
+  803061:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803064:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803068:	79 0a                	jns    803074 <read+0x62>
+    return r;
+  80306a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80306d:	48 98                	cltq
+  80306f:	e9 9e 00 00 00       	jmp    803112 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803078:	8b 40 08             	mov    0x8(%rax),%eax
+  80307b:	83 e0 03             	and    $0x3,%eax
+  80307e:	83 f8 01             	cmp    $0x1,%eax
+  803081:	75 5c                	jne    8030df <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803083:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80308a:	00 00 00 
+  80308d:	8b 40 04             	mov    0x4(%rax),%eax
+  803090:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803095:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80309c:	00 00 00 
+  80309f:	48 98                	cltq
+  8030a1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8030a8:	48 01 d0             	add    %rdx,%rax
+  8030ab:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8030b1:	8b 00                	mov    (%rax),%eax
+  8030b3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030b6:	89 c6                	mov    %eax,%esi
+  8030b8:	48 b8 77 65 80 00 00 	movabs $0x806577,%rax
+  8030bf:	00 00 00 
+  8030c2:	48 89 c7             	mov    %rax,%rdi
+  8030c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ca:	48 b9 21 05 80 00 00 	movabs $0x800521,%rcx
+  8030d1:	00 00 00 
+  8030d4:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8030d6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8030dd:	eb 33                	jmp    803112 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8030df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030e7:	48 85 c0             	test   %rax,%rax
+  8030ea:	75 09                	jne    8030f5 <read+0xe3>
+    return -E_NOT_SUPP;
+  8030ec:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8030f3:	eb 1d                	jmp    803112 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8030f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030f9:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8030fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803101:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803105:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803109:	48 89 ce             	mov    %rcx,%rsi
+  80310c:	48 89 c7             	mov    %rax,%rdi
+  80310f:	41 ff d0             	call   *%r8
+}
+  803112:	c9                   	leave
+  803113:	c3                   	ret
+
+0000000000803114 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803114:	55                   	push   %rbp
+  803115:	48 89 e5             	mov    %rsp,%rbp
+  803118:	48 83 ec 30          	sub    $0x30,%rsp
+  80311c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80311f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803123:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803127:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80312e:	eb 49                	jmp    803179 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803130:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803133:	48 98                	cltq
+  803135:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803139:	48 29 c2             	sub    %rax,%rdx
+  80313c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80313f:	48 63 c8             	movslq %eax,%rcx
+  803142:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803146:	48 01 c1             	add    %rax,%rcx
+  803149:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80314c:	48 89 ce             	mov    %rcx,%rsi
+  80314f:	89 c7                	mov    %eax,%edi
+  803151:	48 b8 12 30 80 00 00 	movabs $0x803012,%rax
+  803158:	00 00 00 
+  80315b:	ff d0                	call   *%rax
+  80315d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803160:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803164:	79 07                	jns    80316d <readn+0x59>
+      return m;
+  803166:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803169:	48 98                	cltq
+  80316b:	eb 1f                	jmp    80318c <readn+0x78>
+    if (m == 0)
+  80316d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803171:	74 13                	je     803186 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803173:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803176:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803179:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80317c:	48 98                	cltq
+  80317e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803182:	72 ac                	jb     803130 <readn+0x1c>
+  803184:	eb 01                	jmp    803187 <readn+0x73>
+      break;
+  803186:	90                   	nop
+  }
+  return tot;
+  803187:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80318a:	48 98                	cltq
+}
+  80318c:	c9                   	leave
+  80318d:	c3                   	ret
+
+000000000080318e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80318e:	55                   	push   %rbp
+  80318f:	48 89 e5             	mov    %rsp,%rbp
+  803192:	48 83 ec 40          	sub    $0x40,%rsp
+  803196:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803199:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80319d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031a1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031a8:	48 89 d6             	mov    %rdx,%rsi
+  8031ab:	89 c7                	mov    %eax,%edi
+  8031ad:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  8031b4:	00 00 00 
+  8031b7:	ff d0                	call   *%rax
+  8031b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031c0:	78 24                	js     8031e6 <write+0x58>
+  8031c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031c6:	8b 00                	mov    (%rax),%eax
+  8031c8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031cc:	48 89 d6             	mov    %rdx,%rsi
+  8031cf:	89 c7                	mov    %eax,%edi
+  8031d1:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031e4:	79 0a                	jns    8031f0 <write+0x62>
+    return r;
+  8031e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031e9:	48 98                	cltq
+  8031eb:	e9 9d 00 00 00       	jmp    80328d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031f4:	8b 40 08             	mov    0x8(%rax),%eax
+  8031f7:	83 e0 03             	and    $0x3,%eax
+  8031fa:	85 c0                	test   %eax,%eax
+  8031fc:	75 5c                	jne    80325a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031fe:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803205:	00 00 00 
+  803208:	8b 40 04             	mov    0x4(%rax),%eax
+  80320b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803210:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803217:	00 00 00 
+  80321a:	48 98                	cltq
+  80321c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803223:	48 01 d0             	add    %rdx,%rax
+  803226:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80322c:	8b 00                	mov    (%rax),%eax
+  80322e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803231:	89 c6                	mov    %eax,%esi
+  803233:	48 b8 93 65 80 00 00 	movabs $0x806593,%rax
+  80323a:	00 00 00 
+  80323d:	48 89 c7             	mov    %rax,%rdi
+  803240:	b8 00 00 00 00       	mov    $0x0,%eax
+  803245:	48 b9 21 05 80 00 00 	movabs $0x800521,%rcx
+  80324c:	00 00 00 
+  80324f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803251:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803258:	eb 33                	jmp    80328d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80325a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80325e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803262:	48 85 c0             	test   %rax,%rax
+  803265:	75 09                	jne    803270 <write+0xe2>
+    return -E_NOT_SUPP;
+  803267:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80326e:	eb 1d                	jmp    80328d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803270:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803274:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803278:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80327c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803280:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803284:	48 89 ce             	mov    %rcx,%rsi
+  803287:	48 89 c7             	mov    %rax,%rdi
+  80328a:	41 ff d0             	call   *%r8
+}
+  80328d:	c9                   	leave
+  80328e:	c3                   	ret
+
+000000000080328f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80328f:	55                   	push   %rbp
+  803290:	48 89 e5             	mov    %rsp,%rbp
+  803293:	48 83 ec 18          	sub    $0x18,%rsp
+  803297:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80329a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80329d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032a4:	48 89 d6             	mov    %rdx,%rsi
+  8032a7:	89 c7                	mov    %eax,%edi
+  8032a9:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  8032b0:	00 00 00 
+  8032b3:	ff d0                	call   *%rax
+  8032b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032bc:	79 05                	jns    8032c3 <seek+0x34>
+    return r;
+  8032be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032c1:	eb 0f                	jmp    8032d2 <seek+0x43>
+  fd->fd_offset = offset;
+  8032c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032c7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8032ca:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8032cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+00000000008032d4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	48 83 ec 30          	sub    $0x30,%rsp
+  8032dc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032df:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032e2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8032e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032e9:	48 89 d6             	mov    %rdx,%rsi
+  8032ec:	89 c7                	mov    %eax,%edi
+  8032ee:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  8032f5:	00 00 00 
+  8032f8:	ff d0                	call   *%rax
+  8032fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803301:	78 24                	js     803327 <ftruncate+0x53>
+  803303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803307:	8b 00                	mov    (%rax),%eax
+  803309:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80330d:	48 89 d6             	mov    %rdx,%rsi
+  803310:	89 c7                	mov    %eax,%edi
+  803312:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  803319:	00 00 00 
+  80331c:	ff d0                	call   *%rax
+  80331e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803321:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803325:	79 08                	jns    80332f <ftruncate+0x5b>
+    return r;
+  803327:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80332a:	e9 92 00 00 00       	jmp    8033c1 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80332f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803333:	8b 40 08             	mov    0x8(%rax),%eax
+  803336:	83 e0 03             	and    $0x3,%eax
+  803339:	85 c0                	test   %eax,%eax
+  80333b:	75 5a                	jne    803397 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80333d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803344:	00 00 00 
+  803347:	8b 40 04             	mov    0x4(%rax),%eax
+  80334a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80334f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803356:	00 00 00 
+  803359:	48 98                	cltq
+  80335b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803362:	48 01 d0             	add    %rdx,%rax
+  803365:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80336b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80336d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803370:	89 c6                	mov    %eax,%esi
+  803372:	48 b8 b0 65 80 00 00 	movabs $0x8065b0,%rax
+  803379:	00 00 00 
+  80337c:	48 89 c7             	mov    %rax,%rdi
+  80337f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803384:	48 b9 21 05 80 00 00 	movabs $0x800521,%rcx
+  80338b:	00 00 00 
+  80338e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803390:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803395:	eb 2a                	jmp    8033c1 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80339b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80339f:	48 85 c0             	test   %rax,%rax
+  8033a2:	75 07                	jne    8033ab <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8033a4:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8033a9:	eb 16                	jmp    8033c1 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8033ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033af:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8033b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8033ba:	89 d6                	mov    %edx,%esi
+  8033bc:	48 89 c7             	mov    %rax,%rdi
+  8033bf:	ff d1                	call   *%rcx
+}
+  8033c1:	c9                   	leave
+  8033c2:	c3                   	ret
+
+00000000008033c3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033c3:	55                   	push   %rbp
+  8033c4:	48 89 e5             	mov    %rsp,%rbp
+  8033c7:	48 83 ec 30          	sub    $0x30,%rsp
+  8033cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8033ce:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033d2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8033d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033d9:	48 89 d6             	mov    %rdx,%rsi
+  8033dc:	89 c7                	mov    %eax,%edi
+  8033de:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033f1:	78 24                	js     803417 <fstat+0x54>
+  8033f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f7:	8b 00                	mov    (%rax),%eax
+  8033f9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033fd:	48 89 d6             	mov    %rdx,%rsi
+  803400:	89 c7                	mov    %eax,%edi
+  803402:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+  80340e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803411:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803415:	79 05                	jns    80341c <fstat+0x59>
+    return r;
+  803417:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80341a:	eb 5e                	jmp    80347a <fstat+0xb7>
+  if (!dev->dev_stat)
+  80341c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803420:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803424:	48 85 c0             	test   %rax,%rax
+  803427:	75 07                	jne    803430 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803429:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80342e:	eb 4a                	jmp    80347a <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803430:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803434:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803437:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80343b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803442:	00 00 00 
+  stat->st_isdir   = 0;
+  803445:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803449:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803450:	00 00 00 
+  stat->st_dev     = dev;
+  803453:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803457:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80345b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803466:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80346a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80346e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803472:	48 89 d6             	mov    %rdx,%rsi
+  803475:	48 89 c7             	mov    %rax,%rdi
+  803478:	ff d1                	call   *%rcx
+}
+  80347a:	c9                   	leave
+  80347b:	c3                   	ret
+
+000000000080347c <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80347c:	55                   	push   %rbp
+  80347d:	48 89 e5             	mov    %rsp,%rbp
+  803480:	48 83 ec 10          	sub    $0x10,%rsp
+  803484:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803488:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80348c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803490:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803496:	83 f8 20             	cmp    $0x20,%eax
+  803499:	75 07                	jne    8034a2 <pollwait_key+0x26>
+    return -E_INVAL;
+  80349b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034a0:	eb 5f                	jmp    803501 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8034a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a6:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8034ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b0:	48 63 d2             	movslq %edx,%rdx
+  8034b3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8034b7:	48 01 c2             	add    %rax,%rdx
+  8034ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034be:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8034c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034c5:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8034cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034cf:	8b 00                	mov    (%rax),%eax
+  8034d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034d5:	48 63 c9             	movslq %ecx,%rcx
+  8034d8:	48 c1 e1 04          	shl    $0x4,%rcx
+  8034dc:	48 01 ca             	add    %rcx,%rdx
+  8034df:	48 83 c2 08          	add    $0x8,%rdx
+  8034e3:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8034e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e9:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8034ef:	8d 50 01             	lea    0x1(%rax),%edx
+  8034f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034f6:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+
+0000000000803503 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803503:	55                   	push   %rbp
+  803504:	48 89 e5             	mov    %rsp,%rbp
+  803507:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80350e:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803515:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80351b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803522:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803529:	00 
+  int i, r, ready, ipc = 0;
+  80352a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803531:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803538:	00 
+  803539:	74 45                	je     803580 <poll+0x7d>
+  80353b:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803542:	ff 
+  803543:	74 3b                	je     803580 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803545:	48 b8 79 57 80 00 00 	movabs $0x805779,%rax
+  80354c:	00 00 00 
+  80354f:	ff d0                	call   *%rax
+  803551:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803555:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803559:	48 f7 d0             	not    %rax
+  80355c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803563:	73 10                	jae    803575 <poll+0x72>
+  803565:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803569:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803570:	48 01 d0             	add    %rdx,%rax
+  803573:	eb 07                	jmp    80357c <poll+0x79>
+  803575:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80357c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803580:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803587:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80358e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803595:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80359c:	e9 46 02 00 00       	jmp    8037e7 <poll+0x2e4>
+      fds[i].revents = 0;
+  8035a1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035a4:	48 63 d0             	movslq %eax,%rdx
+  8035a7:	48 89 d0             	mov    %rdx,%rax
+  8035aa:	48 01 c0             	add    %rax,%rax
+  8035ad:	48 01 d0             	add    %rdx,%rax
+  8035b0:	48 c1 e0 02          	shl    $0x2,%rax
+  8035b4:	48 89 c2             	mov    %rax,%rdx
+  8035b7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035be:	48 01 d0             	add    %rdx,%rax
+  8035c1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8035c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035cb:	48 63 d0             	movslq %eax,%rdx
+  8035ce:	48 89 d0             	mov    %rdx,%rax
+  8035d1:	48 01 c0             	add    %rax,%rax
+  8035d4:	48 01 d0             	add    %rdx,%rax
+  8035d7:	48 c1 e0 02          	shl    $0x2,%rax
+  8035db:	48 89 c2             	mov    %rax,%rdx
+  8035de:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035e5:	48 01 d0             	add    %rdx,%rax
+  8035e8:	8b 00                	mov    (%rax),%eax
+  8035ea:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8035ed:	75 62                	jne    803651 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8035ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035f2:	48 63 d0             	movslq %eax,%rdx
+  8035f5:	48 89 d0             	mov    %rdx,%rax
+  8035f8:	48 01 c0             	add    %rax,%rax
+  8035fb:	48 01 d0             	add    %rdx,%rax
+  8035fe:	48 c1 e0 02          	shl    $0x2,%rax
+  803602:	48 89 c2             	mov    %rax,%rdx
+  803605:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80360c:	48 01 d0             	add    %rdx,%rax
+  80360f:	8b 40 04             	mov    0x4(%rax),%eax
+  803612:	83 e0 01             	and    $0x1,%eax
+  803615:	85 c0                	test   %eax,%eax
+  803617:	0f 84 9b 01 00 00    	je     8037b8 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80361d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803620:	48 63 d0             	movslq %eax,%rdx
+  803623:	48 89 d0             	mov    %rdx,%rax
+  803626:	48 01 c0             	add    %rax,%rax
+  803629:	48 01 d0             	add    %rdx,%rax
+  80362c:	48 c1 e0 02          	shl    $0x2,%rax
+  803630:	48 89 c2             	mov    %rax,%rdx
+  803633:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80363a:	48 01 c2             	add    %rax,%rdx
+  80363d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803640:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803643:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803646:	83 c8 04             	or     $0x4,%eax
+  803649:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80364c:	e9 67 01 00 00       	jmp    8037b8 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803651:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803654:	48 63 d0             	movslq %eax,%rdx
+  803657:	48 89 d0             	mov    %rdx,%rax
+  80365a:	48 01 c0             	add    %rax,%rax
+  80365d:	48 01 d0             	add    %rdx,%rax
+  803660:	48 c1 e0 02          	shl    $0x2,%rax
+  803664:	48 89 c2             	mov    %rax,%rdx
+  803667:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80366e:	48 01 d0             	add    %rdx,%rax
+  803671:	8b 00                	mov    (%rax),%eax
+  803673:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80367a:	48 89 d6             	mov    %rdx,%rsi
+  80367d:	89 c7                	mov    %eax,%edi
+  80367f:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	78 25                	js     8036b4 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80368f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803696:	8b 00                	mov    (%rax),%eax
+  803698:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80369f:	48 89 d6             	mov    %rdx,%rsi
+  8036a2:	89 c7                	mov    %eax,%edi
+  8036a4:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  8036ab:	00 00 00 
+  8036ae:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	79 2c                	jns    8036e0 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8036b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036b7:	48 63 d0             	movslq %eax,%rdx
+  8036ba:	48 89 d0             	mov    %rdx,%rax
+  8036bd:	48 01 c0             	add    %rax,%rax
+  8036c0:	48 01 d0             	add    %rdx,%rax
+  8036c3:	48 c1 e0 02          	shl    $0x2,%rax
+  8036c7:	48 89 c2             	mov    %rax,%rdx
+  8036ca:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036d1:	48 01 d0             	add    %rdx,%rax
+  8036d4:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8036db:	e9 d8 00 00 00       	jmp    8037b8 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8036e0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8036e7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8036eb:	48 85 c0             	test   %rax,%rax
+  8036ee:	74 7d                	je     80376d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8036f0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8036f7:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8036fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036fe:	48 63 d0             	movslq %eax,%rdx
+  803701:	48 89 d0             	mov    %rdx,%rax
+  803704:	48 01 c0             	add    %rax,%rax
+  803707:	48 01 d0             	add    %rdx,%rax
+  80370a:	48 c1 e0 02          	shl    $0x2,%rax
+  80370e:	48 89 c2             	mov    %rax,%rdx
+  803711:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803718:	48 01 d0             	add    %rdx,%rax
+  80371b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80371e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803725:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80372c:	89 ce                	mov    %ecx,%esi
+  80372e:	48 89 c7             	mov    %rax,%rdi
+  803731:	41 ff d0             	call   *%r8
+  803734:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803737:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80373b:	79 08                	jns    803745 <poll+0x242>
+          return r;
+  80373d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803740:	e9 45 01 00 00       	jmp    80388a <poll+0x387>
+        fds[i].revents = r;
+  803745:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803748:	48 63 d0             	movslq %eax,%rdx
+  80374b:	48 89 d0             	mov    %rdx,%rax
+  80374e:	48 01 c0             	add    %rax,%rax
+  803751:	48 01 d0             	add    %rdx,%rax
+  803754:	48 c1 e0 02          	shl    $0x2,%rax
+  803758:	48 89 c2             	mov    %rax,%rdx
+  80375b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803762:	48 01 c2             	add    %rax,%rdx
+  803765:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803768:	89 42 08             	mov    %eax,0x8(%rdx)
+  80376b:	eb 4b                	jmp    8037b8 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80376d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803770:	48 63 d0             	movslq %eax,%rdx
+  803773:	48 89 d0             	mov    %rdx,%rax
+  803776:	48 01 c0             	add    %rax,%rax
+  803779:	48 01 d0             	add    %rdx,%rax
+  80377c:	48 c1 e0 02          	shl    $0x2,%rax
+  803780:	48 89 c2             	mov    %rax,%rdx
+  803783:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80378a:	48 01 d0             	add    %rdx,%rax
+  80378d:	8b 48 04             	mov    0x4(%rax),%ecx
+  803790:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803793:	48 63 d0             	movslq %eax,%rdx
+  803796:	48 89 d0             	mov    %rdx,%rax
+  803799:	48 01 c0             	add    %rax,%rax
+  80379c:	48 01 d0             	add    %rdx,%rax
+  80379f:	48 c1 e0 02          	shl    $0x2,%rax
+  8037a3:	48 89 c2             	mov    %rax,%rdx
+  8037a6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037ad:	48 01 d0             	add    %rdx,%rax
+  8037b0:	83 e1 03             	and    $0x3,%ecx
+  8037b3:	89 ca                	mov    %ecx,%edx
+  8037b5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8037b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037bb:	48 63 d0             	movslq %eax,%rdx
+  8037be:	48 89 d0             	mov    %rdx,%rax
+  8037c1:	48 01 c0             	add    %rax,%rax
+  8037c4:	48 01 d0             	add    %rdx,%rax
+  8037c7:	48 c1 e0 02          	shl    $0x2,%rax
+  8037cb:	48 89 c2             	mov    %rax,%rdx
+  8037ce:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037d5:	48 01 d0             	add    %rdx,%rax
+  8037d8:	8b 40 08             	mov    0x8(%rax),%eax
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	74 04                	je     8037e3 <poll+0x2e0>
+        ready++;
+  8037df:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8037e3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8037e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037ea:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8037f0:	0f 8c ab fd ff ff    	jl     8035a1 <poll+0x9e>
+    }
+    if (ready)
+  8037f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8037fa:	74 08                	je     803804 <poll+0x301>
+      return ready;
+  8037fc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8037ff:	e9 86 00 00 00       	jmp    80388a <poll+0x387>
+
+    if (deadline) {
+  803804:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803809:	74 30                	je     80383b <poll+0x338>
+      now     = vsys_clock_ns();
+  80380b:	48 b8 79 57 80 00 00 	movabs $0x805779,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+  803817:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80381b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80381f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803823:	73 0a                	jae    80382f <poll+0x32c>
+  803825:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803829:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80382d:	eb 05                	jmp    803834 <poll+0x331>
+  80382f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803834:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80383b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80383e:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803841:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803848:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80384f:	48 89 c7             	mov    %rax,%rdi
+  803852:	48 b8 e7 26 80 00 00 	movabs $0x8026e7,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+  80385e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803861:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803865:	75 07                	jne    80386e <poll+0x36b>
+      return 0;
+  803867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386c:	eb 1c                	jmp    80388a <poll+0x387>
+    if (r < 0)
+  80386e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803872:	79 05                	jns    803879 <poll+0x376>
+      return r;
+  803874:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803877:	eb 11                	jmp    80388a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803879:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80387c:	c1 f8 02             	sar    $0x2,%eax
+  80387f:	83 e0 01             	and    $0x1,%eax
+  803882:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803885:	e9 f6 fc ff ff       	jmp    803580 <poll+0x7d>
+  }
+}
+  80388a:	c9                   	leave
+  80388b:	c3                   	ret
+
+000000000080388c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80388c:	55                   	push   %rbp
+  80388d:	48 89 e5             	mov    %rsp,%rbp
+  803890:	48 83 ec 20          	sub    $0x20,%rsp
+  803894:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803898:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80389c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a5:	48 89 c7             	mov    %rax,%rdi
+  8038a8:	48 b8 7a 39 80 00 00 	movabs $0x80397a,%rax
+  8038af:	00 00 00 
+  8038b2:	ff d0                	call   *%rax
+  8038b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038bb:	79 05                	jns    8038c2 <stat+0x36>
+    return fd;
+  8038bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038c0:	eb 2f                	jmp    8038f1 <stat+0x65>
+  r = fstat(fd, stat);
+  8038c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038c9:	48 89 d6             	mov    %rdx,%rsi
+  8038cc:	89 c7                	mov    %eax,%edi
+  8038ce:	48 b8 c3 33 80 00 00 	movabs $0x8033c3,%rax
+  8038d5:	00 00 00 
+  8038d8:	ff d0                	call   *%rax
+  8038da:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8038dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038e0:	89 c7                	mov    %eax,%edi
+  8038e2:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  8038e9:	00 00 00 
+  8038ec:	ff d0                	call   *%rax
+  return r;
+  8038ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8038f1:	c9                   	leave
+  8038f2:	c3                   	ret
+
+00000000008038f3 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8038fb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8038fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803902:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803909:	00 00 00 
+  80390c:	8b 00                	mov    (%rax),%eax
+  80390e:	85 c0                	test   %eax,%eax
+  803910:	75 1d                	jne    80392f <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803912:	bf 03 00 00 00       	mov    $0x3,%edi
+  803917:	48 b8 94 5d 80 00 00 	movabs $0x805d94,%rax
+  80391e:	00 00 00 
+  803921:	ff d0                	call   *%rax
+  803923:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80392a:	00 00 00 
+  80392d:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80392f:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803936:	00 00 00 
+  803939:	8b 00                	mov    (%rax),%eax
+  80393b:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80393e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803943:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80394a:	00 00 00 
+  80394d:	89 c7                	mov    %eax,%edi
+  80394f:	48 b8 e7 5c 80 00 00 	movabs $0x805ce7,%rax
+  803956:	00 00 00 
+  803959:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80395b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80395f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803964:	48 89 c6             	mov    %rax,%rsi
+  803967:	bf 00 00 00 00       	mov    $0x0,%edi
+  80396c:	48 b8 6a 5b 80 00 00 	movabs $0x805b6a,%rax
+  803973:	00 00 00 
+  803976:	ff d0                	call   *%rax
+}
+  803978:	c9                   	leave
+  803979:	c3                   	ret
+
+000000000080397a <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80397a:	55                   	push   %rbp
+  80397b:	48 89 e5             	mov    %rsp,%rbp
+  80397e:	48 83 ec 20          	sub    $0x20,%rsp
+  803982:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803986:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803989:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80398d:	48 89 c7             	mov    %rax,%rdi
+  803990:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  803997:	00 00 00 
+  80399a:	ff d0                	call   *%rax
+  80399c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8039a1:	7e 0a                	jle    8039ad <open+0x33>
+    return -E_BAD_PATH;
+  8039a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8039a8:	e9 a8 00 00 00       	jmp    803a55 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8039ad:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8039b1:	48 89 c7             	mov    %rax,%rdi
+  8039b4:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  8039bb:	00 00 00 
+  8039be:	ff d0                	call   *%rax
+  8039c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039c7:	79 08                	jns    8039d1 <open+0x57>
+    return r;
+  8039c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039cc:	e9 84 00 00 00       	jmp    803a55 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8039d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d5:	48 89 c6             	mov    %rax,%rsi
+  8039d8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8039df:	00 00 00 
+  8039e2:	48 89 c7             	mov    %rax,%rdi
+  8039e5:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8039f1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039f8:	00 00 00 
+  8039fb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039fe:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a08:	48 89 c6             	mov    %rax,%rsi
+  803a0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a10:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803a17:	00 00 00 
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a23:	79 1d                	jns    803a42 <open+0xc8>
+    fd_close(fd, 0);
+  803a25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a29:	be 00 00 00 00       	mov    $0x0,%esi
+  803a2e:	48 89 c7             	mov    %rax,%rdi
+  803a31:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  803a38:	00 00 00 
+  803a3b:	ff d0                	call   *%rax
+    return r;
+  803a3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a40:	eb 13                	jmp    803a55 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a46:	48 89 c7             	mov    %rax,%rdi
+  803a49:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  803a50:	00 00 00 
+  803a53:	ff d0                	call   *%rax
+}
+  803a55:	c9                   	leave
+  803a56:	c3                   	ret
+
+0000000000803a57 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803a57:	55                   	push   %rbp
+  803a58:	48 89 e5             	mov    %rsp,%rbp
+  803a5b:	48 83 ec 10          	sub    $0x10,%rsp
+  803a5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a67:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a6a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a71:	00 00 00 
+  803a74:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803a76:	be 00 00 00 00       	mov    $0x0,%esi
+  803a7b:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a80:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803a87:	00 00 00 
+  803a8a:	ff d0                	call   *%rax
+}
+  803a8c:	c9                   	leave
+  803a8d:	c3                   	ret
+
+0000000000803a8e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a8e:	55                   	push   %rbp
+  803a8f:	48 89 e5             	mov    %rsp,%rbp
+  803a92:	48 83 ec 30          	sub    $0x30,%rsp
+  803a96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a9a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a9e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803aa2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803aa7:	74 07                	je     803ab0 <devfile_read+0x22>
+  803aa9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803aae:	75 0a                	jne    803aba <devfile_read+0x2c>
+  return E_INVAL;
+  803ab0:	b8 03 00 00 00       	mov    $0x3,%eax
+  803ab5:	e9 b4 00 00 00       	jmp    803b6e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803aba:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ac1:	00 
+  while (n) {
+  803ac2:	e9 98 00 00 00       	jmp    803b5f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803acb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ace:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ad5:	00 00 00 
+  803ad8:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803ada:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ae1:	00 00 00 
+  803ae4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803aec:	be 00 00 00 00       	mov    $0x0,%esi
+  803af1:	bf 03 00 00 00       	mov    $0x3,%edi
+  803af6:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803afd:	00 00 00 
+  803b00:	ff d0                	call   *%rax
+  803b02:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803b05:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b09:	7f 13                	jg     803b1e <devfile_read+0x90>
+      return res ? res : res0;
+  803b0b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b0f:	74 07                	je     803b18 <devfile_read+0x8a>
+  803b11:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b14:	48 98                	cltq
+  803b16:	eb 56                	jmp    803b6e <devfile_read+0xe0>
+  803b18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b1c:	eb 50                	jmp    803b6e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b1e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b21:	48 63 d0             	movslq %eax,%rdx
+  803b24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b28:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803b2f:	00 00 00 
+  803b32:	48 89 ce             	mov    %rcx,%rsi
+  803b35:	48 89 c7             	mov    %rax,%rdi
+  803b38:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+
+    buf += res;
+  803b44:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b47:	48 98                	cltq
+  803b49:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803b4d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b50:	48 98                	cltq
+  803b52:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803b56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b59:	48 98                	cltq
+  803b5b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803b5f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b64:	0f 85 5d ff ff ff    	jne    803ac7 <devfile_read+0x39>
+  }
+
+  return res0;
+  803b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803b6e:	c9                   	leave
+  803b6f:	c3                   	ret
+
+0000000000803b70 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803b70:	55                   	push   %rbp
+  803b71:	48 89 e5             	mov    %rsp,%rbp
+  803b74:	48 83 ec 50          	sub    $0x50,%rsp
+  803b78:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b7c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b80:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b84:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b89:	74 07                	je     803b92 <devfile_write+0x22>
+  803b8b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803b90:	75 0a                	jne    803b9c <devfile_write+0x2c>
+  return E_INVAL;
+  803b92:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b97:	e9 c9 00 00 00       	jmp    803c65 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803b9c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ba3:	00 
+
+  while (n) {
+  803ba4:	e9 ad 00 00 00       	jmp    803c56 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803ba9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803bad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803bb1:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803bb8:	00 
+  803bb9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803bbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bc1:	48 39 c2             	cmp    %rax,%rdx
+  803bc4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803bc8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803bcc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803bd0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bd4:	48 89 c6             	mov    %rax,%rsi
+  803bd7:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803bde:	00 00 00 
+  803be1:	48 89 c7             	mov    %rax,%rdi
+  803be4:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  803beb:	00 00 00 
+  803bee:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803bf0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bf4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bf7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bfe:	00 00 00 
+  803c01:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803c03:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c0a:	00 00 00 
+  803c0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c11:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803c15:	be 00 00 00 00       	mov    $0x0,%esi
+  803c1a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c1f:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803c26:	00 00 00 
+  803c29:	ff d0                	call   *%rax
+  803c2b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803c2e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c32:	79 07                	jns    803c3b <devfile_write+0xcb>
+      return res;
+  803c34:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c37:	48 98                	cltq
+  803c39:	eb 2a                	jmp    803c65 <devfile_write+0xf5>
+
+    buf += res;
+  803c3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c3e:	48 98                	cltq
+  803c40:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803c44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c47:	48 98                	cltq
+  803c49:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803c4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c50:	48 98                	cltq
+  803c52:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803c56:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803c5b:	0f 85 48 ff ff ff    	jne    803ba9 <devfile_write+0x39>
+  }
+
+  return res0;
+  803c61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803c65:	c9                   	leave
+  803c66:	c3                   	ret
+
+0000000000803c67 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c67:	55                   	push   %rbp
+  803c68:	48 89 e5             	mov    %rsp,%rbp
+  803c6b:	48 83 ec 20          	sub    $0x20,%rsp
+  803c6f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c73:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c7b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c7e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c85:	00 00 00 
+  803c88:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803c8a:	be 00 00 00 00       	mov    $0x0,%esi
+  803c8f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c94:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803c9b:	00 00 00 
+  803c9e:	ff d0                	call   *%rax
+  803ca0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ca3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ca7:	79 05                	jns    803cae <devfile_stat+0x47>
+    return r;
+  803ca9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cac:	eb 59                	jmp    803d07 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803cae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cb2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803cb9:	00 00 00 
+  803cbc:	48 89 d6             	mov    %rdx,%rsi
+  803cbf:	48 89 c7             	mov    %rax,%rdi
+  803cc2:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  803cc9:	00 00 00 
+  803ccc:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803cce:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803cd5:	00 00 00 
+  803cd8:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803cde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ce2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ce8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803cef:	00 00 00 
+  803cf2:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803cf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cfc:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803d02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d07:	c9                   	leave
+  803d08:	c3                   	ret
+
+0000000000803d09 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+  803d0d:	48 83 ec 10          	sub    $0x10,%rsp
+  803d11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d15:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803d18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d1c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d1f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d26:	00 00 00 
+  803d29:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803d2b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d32:	00 00 00 
+  803d35:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d38:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803d3b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d40:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d45:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803d4c:	00 00 00 
+  803d4f:	ff d0                	call   *%rax
+}
+  803d51:	c9                   	leave
+  803d52:	c3                   	ret
+
+0000000000803d53 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803d53:	55                   	push   %rbp
+  803d54:	48 89 e5             	mov    %rsp,%rbp
+  803d57:	48 83 ec 18          	sub    $0x18,%rsp
+  803d5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d5f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803d62:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803d66:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d69:	83 e0 03             	and    $0x3,%eax
+}
+  803d6c:	c9                   	leave
+  803d6d:	c3                   	ret
+
+0000000000803d6e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803d6e:	55                   	push   %rbp
+  803d6f:	48 89 e5             	mov    %rsp,%rbp
+  803d72:	48 83 ec 10          	sub    $0x10,%rsp
+  803d76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803d7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d7e:	48 89 c7             	mov    %rax,%rdi
+  803d81:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+  803d8d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d92:	7e 07                	jle    803d9b <remove+0x2d>
+    return -E_BAD_PATH;
+  803d94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803d99:	eb 36                	jmp    803dd1 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803d9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d9f:	48 89 c6             	mov    %rax,%rsi
+  803da2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803da9:	00 00 00 
+  803dac:	48 89 c7             	mov    %rax,%rdi
+  803daf:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc0:	bf 07 00 00 00       	mov    $0x7,%edi
+  803dc5:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+}
+  803dd1:	c9                   	leave
+  803dd2:	c3                   	ret
+
+0000000000803dd3 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803dd3:	55                   	push   %rbp
+  803dd4:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  803ddc:	bf 08 00 00 00       	mov    $0x8,%edi
+  803de1:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803de8:	00 00 00 
+  803deb:	ff d0                	call   *%rax
+}
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+
+0000000000803def <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	48 83 ec 20          	sub    $0x20,%rsp
+  803df7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803dfb:	be 00 00 00 00       	mov    $0x0,%esi
+  803e00:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e05:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803e0c:	00 00 00 
+  803e0f:	ff d0                	call   *%rax
+  803e11:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e14:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e18:	79 05                	jns    803e1f <fs_stats+0x30>
+    return r;
+  803e1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e1d:	eb 2a                	jmp    803e49 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803e1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e23:	ba 68 00 00 00       	mov    $0x68,%edx
+  803e28:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803e2f:	00 00 00 
+  803e32:	48 89 ce             	mov    %rcx,%rsi
+  803e35:	48 89 c7             	mov    %rax,%rdi
+  803e38:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+  return 0;
+  803e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e49:	c9                   	leave
+  803e4a:	c3                   	ret
+
+0000000000803e4b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803e4b:	55                   	push   %rbp
+  803e4c:	48 89 e5             	mov    %rsp,%rbp
+  803e4f:	48 83 ec 10          	sub    $0x10,%rsp
+  803e53:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803e56:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803e5d:	00 00 00 
+  803e60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e63:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803e65:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803e6f:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803e76:	00 00 00 
+  803e79:	ff d0                	call   *%rax
+}
+  803e7b:	c9                   	leave
+  803e7c:	c3                   	ret
+
+0000000000803e7d <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803e7d:	55                   	push   %rbp
+  803e7e:	48 89 e5             	mov    %rsp,%rbp
+  803e81:	48 83 ec 10          	sub    $0x10,%rsp
+  803e85:	89 f8                	mov    %edi,%eax
+  803e87:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803e8a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803e8e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803e95:	00 00 00 
+  803e98:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ea4:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803eab:	00 00 00 
+  803eae:	ff d0                	call   *%rax
+}
+  803eb0:	c9                   	leave
+  803eb1:	c3                   	ret
+
+0000000000803eb2 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  803eb2:	55                   	push   %rbp
+  803eb3:	48 89 e5             	mov    %rsp,%rbp
+  803eb6:	53                   	push   %rbx
+  803eb7:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  803ebe:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  803ec5:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  803ecc:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803ed3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ed8:	48 89 c7             	mov    %rax,%rdi
+  803edb:	48 b8 7a 39 80 00 00 	movabs $0x80397a,%rax
+  803ee2:	00 00 00 
+  803ee5:	ff d0                	call   *%rax
+  803ee7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803eea:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803eee:	79 08                	jns    803ef8 <spawn+0x46>
+    return r;
+  803ef0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803ef3:	e9 35 04 00 00       	jmp    80432d <spawn+0x47b>
+  fd = r;
+  803ef8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803efb:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  803efe:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  803f05:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  803f09:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  803f10:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f13:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f18:	48 89 ce             	mov    %rcx,%rsi
+  803f1b:	89 c7                	mov    %eax,%edi
+  803f1d:	48 b8 14 31 80 00 00 	movabs $0x803114,%rax
+  803f24:	00 00 00 
+  803f27:	ff d0                	call   *%rax
+  803f29:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  803f2f:	75 0d                	jne    803f3e <spawn+0x8c>
+  803f31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f35:	8b 00                	mov    (%rax),%eax
+  803f37:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  803f3c:	74 46                	je     803f84 <spawn+0xd2>
+    close(fd);
+  803f3e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f41:	89 c7                	mov    %eax,%edi
+  803f43:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  803f4a:	00 00 00 
+  803f4d:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803f4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f53:	8b 00                	mov    (%rax),%eax
+  803f55:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803f5a:	89 c6                	mov    %eax,%esi
+  803f5c:	48 b8 d8 65 80 00 00 	movabs $0x8065d8,%rax
+  803f63:	00 00 00 
+  803f66:	48 89 c7             	mov    %rax,%rdi
+  803f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6e:	48 b9 21 05 80 00 00 	movabs $0x800521,%rcx
+  803f75:	00 00 00 
+  803f78:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  803f7a:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  803f7f:	e9 a9 03 00 00       	jmp    80432d <spawn+0x47b>
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  803f84:	b8 09 00 00 00       	mov    $0x9,%eax
+  803f89:	cd 30                	int    $0x30
+  803f8b:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  803f8e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  803f91:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803f94:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803f98:	79 08                	jns    803fa2 <spawn+0xf0>
+    return r;
+  803f9a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803f9d:	e9 8b 03 00 00       	jmp    80432d <spawn+0x47b>
+  child = r;
+  803fa2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803fa5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  803fa8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803fab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fb0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fb7:	00 00 00 
+  803fba:	48 98                	cltq
+  803fbc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fc3:	48 01 d0             	add    %rdx,%rax
+  803fc6:	48 8b 08             	mov    (%rax),%rcx
+  803fc9:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  803fcd:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  803fd4:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  803fdb:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  803fdf:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  803fe3:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  803fea:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  803ff1:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  803ff5:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  803ff9:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  804000:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  804007:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80400b:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  80400f:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  804016:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  80401d:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  804021:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  804025:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  80402c:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  804033:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  804037:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  80403b:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  804042:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  804049:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  80404d:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  804051:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  804058:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  80405f:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  804063:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  804067:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  80406e:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  804075:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  80407c:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  804083:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  80408a:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  804091:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  804098:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  80409f:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  8040a6:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  8040ad:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  8040b4:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  8040bb:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  8040c2:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  8040c9:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  8040d0:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  8040d7:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  8040de:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  8040e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040e9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8040ed:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  8040f4:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  8040fb:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  804101:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  804105:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804109:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  804110:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804113:	48 89 ce             	mov    %rcx,%rsi
+  804116:	89 c7                	mov    %eax,%edi
+  804118:	48 b8 95 45 80 00 00 	movabs $0x804595,%rax
+  80411f:	00 00 00 
+  804122:	ff d0                	call   *%rax
+  804124:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804127:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80412b:	79 08                	jns    804135 <spawn+0x283>
+    return r;
+  80412d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804130:	e9 f8 01 00 00       	jmp    80432d <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804139:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80413d:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  804144:	48 01 d0             	add    %rdx,%rax
+  804147:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80414b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804152:	e9 80 00 00 00       	jmp    8041d7 <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  804157:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80415b:	8b 00                	mov    (%rax),%eax
+  80415d:	83 f8 01             	cmp    $0x1,%eax
+  804160:	75 6b                	jne    8041cd <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  804162:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  804169:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80416d:	8b 40 04             	mov    0x4(%rax),%eax
+  804170:	83 e0 02             	and    $0x2,%eax
+  804173:	85 c0                	test   %eax,%eax
+  804175:	74 04                	je     80417b <spawn+0x2c9>
+      perm |= PTE_W;
+  804177:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  80417b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80417f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  804183:	41 89 c1             	mov    %eax,%r9d
+  804186:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80418a:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  80418e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804192:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  804196:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80419a:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80419e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8041a1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8041a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8041a8:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8041ab:	57                   	push   %rdi
+  8041ac:	89 c7                	mov    %eax,%edi
+  8041ae:	48 b8 dd 48 80 00 00 	movabs $0x8048dd,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+  8041ba:	48 83 c4 10          	add    $0x10,%rsp
+  8041be:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8041c1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8041c5:	0f 88 3c 01 00 00    	js     804307 <spawn+0x455>
+  8041cb:	eb 01                	jmp    8041ce <spawn+0x31c>
+      continue;
+  8041cd:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8041ce:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8041d2:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  8041d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041db:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  8041df:	0f b7 c0             	movzwl %ax,%eax
+  8041e2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8041e5:	0f 8c 6c ff ff ff    	jl     804157 <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  8041eb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8041ee:	89 c7                	mov    %eax,%edi
+  8041f0:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  8041f7:	00 00 00 
+  8041fa:	ff d0                	call   *%rax
+  fd = -1;
+  8041fc:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  804203:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804206:	89 c7                	mov    %eax,%edi
+  804208:	48 b8 cb 4a 80 00 00 	movabs $0x804acb,%rax
+  80420f:	00 00 00 
+  804212:	ff d0                	call   *%rax
+  804214:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804217:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80421b:	79 36                	jns    804253 <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  80421d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804220:	89 c1                	mov    %eax,%ecx
+  804222:	48 b8 f2 65 80 00 00 	movabs $0x8065f2,%rax
+  804229:	00 00 00 
+  80422c:	48 89 c2             	mov    %rax,%rdx
+  80422f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804234:	48 b8 08 66 80 00 00 	movabs $0x806608,%rax
+  80423b:	00 00 00 
+  80423e:	48 89 c7             	mov    %rax,%rdi
+  804241:	b8 00 00 00 00       	mov    $0x0,%eax
+  804246:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  80424d:	00 00 00 
+  804250:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804253:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  80425a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80425d:	48 89 d6             	mov    %rdx,%rsi
+  804260:	89 c7                	mov    %eax,%edi
+  804262:	48 b8 f0 23 80 00 00 	movabs $0x8023f0,%rax
+  804269:	00 00 00 
+  80426c:	ff d0                	call   *%rax
+  80426e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804271:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804275:	79 36                	jns    8042ad <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  804277:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80427a:	89 c1                	mov    %eax,%ecx
+  80427c:	48 b8 14 66 80 00 00 	movabs $0x806614,%rax
+  804283:	00 00 00 
+  804286:	48 89 c2             	mov    %rax,%rdx
+  804289:	be a2 00 00 00       	mov    $0xa2,%esi
+  80428e:	48 b8 08 66 80 00 00 	movabs $0x806608,%rax
+  804295:	00 00 00 
+  804298:	48 89 c7             	mov    %rax,%rdi
+  80429b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a0:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  8042a7:	00 00 00 
+  8042aa:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8042ad:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8042b0:	be 02 00 00 00       	mov    $0x2,%esi
+  8042b5:	89 c7                	mov    %eax,%edi
+  8042b7:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  8042be:	00 00 00 
+  8042c1:	ff d0                	call   *%rax
+  8042c3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8042c6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8042ca:	79 36                	jns    804302 <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  8042cc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8042cf:	89 c1                	mov    %eax,%ecx
+  8042d1:	48 b8 2e 66 80 00 00 	movabs $0x80662e,%rax
+  8042d8:	00 00 00 
+  8042db:	48 89 c2             	mov    %rax,%rdx
+  8042de:	be a5 00 00 00       	mov    $0xa5,%esi
+  8042e3:	48 b8 08 66 80 00 00 	movabs $0x806608,%rax
+  8042ea:	00 00 00 
+  8042ed:	48 89 c7             	mov    %rax,%rdi
+  8042f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f5:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  8042fc:	00 00 00 
+  8042ff:	41 ff d0             	call   *%r8
+
+  return child;
+  804302:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804305:	eb 26                	jmp    80432d <spawn+0x47b>
+      goto error;
+  804307:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  804308:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80430b:	89 c7                	mov    %eax,%edi
+  80430d:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+  close(fd);
+  804319:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80431c:	89 c7                	mov    %eax,%edi
+  80431e:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+  return r;
+  80432a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  80432d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+
+0000000000804333 <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  804333:	55                   	push   %rbp
+  804334:	48 89 e5             	mov    %rsp,%rbp
+  804337:	41 55                	push   %r13
+  804339:	41 54                	push   %r12
+  80433b:	53                   	push   %rbx
+  80433c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804343:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  80434a:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  804351:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  804358:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80435f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  804366:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80436d:	84 c0                	test   %al,%al
+  80436f:	74 26                	je     804397 <spawnl+0x64>
+  804371:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  804378:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80437f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  804383:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  804387:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80438b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80438f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  804393:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  804397:	48 89 e0             	mov    %rsp,%rax
+  80439a:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  80439d:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  8043a4:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  8043a7:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  8043ae:	00 00 00 
+  8043b1:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  8043b8:	00 00 00 
+  8043bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043bf:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  8043c6:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8043cd:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  8043d4:	eb 07                	jmp    8043dd <spawnl+0xaa>
+    argc++;
+  8043d6:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  8043dd:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8043e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8043e6:	77 23                	ja     80440b <spawnl+0xd8>
+  8043e8:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8043ef:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8043f5:	89 d2                	mov    %edx,%edx
+  8043f7:	48 01 d0             	add    %rdx,%rax
+  8043fa:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804400:	83 c2 08             	add    $0x8,%edx
+  804403:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  804409:	eb 12                	jmp    80441d <spawnl+0xea>
+  80440b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804412:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804416:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80441d:	48 8b 00             	mov    (%rax),%rax
+  804420:	48 85 c0             	test   %rax,%rax
+  804423:	75 b1                	jne    8043d6 <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  804425:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80442b:	83 c0 02             	add    $0x2,%eax
+  80442e:	48 63 d0             	movslq %eax,%rdx
+  804431:	48 83 ea 01          	sub    $0x1,%rdx
+  804435:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  80443c:	48 63 d0             	movslq %eax,%rdx
+  80443f:	49 89 d4             	mov    %rdx,%r12
+  804442:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804448:	48 63 d0             	movslq %eax,%rdx
+  80444b:	49 89 d2             	mov    %rdx,%r10
+  80444e:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  804454:	48 98                	cltq
+  804456:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80445d:	00 
+  80445e:	b8 10 00 00 00       	mov    $0x10,%eax
+  804463:	48 83 e8 01          	sub    $0x1,%rax
+  804467:	48 01 d0             	add    %rdx,%rax
+  80446a:	be 10 00 00 00       	mov    $0x10,%esi
+  80446f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804474:	48 f7 f6             	div    %rsi
+  804477:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  80447b:	48 29 c4             	sub    %rax,%rsp
+  80447e:	48 89 e0             	mov    %rsp,%rax
+  804481:	48 83 c0 07          	add    $0x7,%rax
+  804485:	48 c1 e8 03          	shr    $0x3,%rax
+  804489:	48 c1 e0 03          	shl    $0x3,%rax
+  80448d:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  804494:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80449b:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  8044a2:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  8044a5:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8044ab:	8d 50 01             	lea    0x1(%rax),%edx
+  8044ae:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8044b5:	48 63 d2             	movslq %edx,%rdx
+  8044b8:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  8044bf:	00 
+
+  va_start(vl, arg0);
+  8044c0:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  8044c7:	00 00 00 
+  8044ca:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  8044d1:	00 00 00 
+  8044d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044d8:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  8044df:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8044e6:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  8044ed:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  8044f4:	00 00 00 
+  8044f7:	eb 60                	jmp    804559 <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  8044f9:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  8044ff:	8d 48 01             	lea    0x1(%rax),%ecx
+  804502:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  804508:	83 f8 2f             	cmp    $0x2f,%eax
+  80450b:	77 23                	ja     804530 <spawnl+0x1fd>
+  80450d:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  804514:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  80451a:	89 d2                	mov    %edx,%edx
+  80451c:	48 01 d0             	add    %rdx,%rax
+  80451f:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804525:	83 c2 08             	add    $0x8,%edx
+  804528:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  80452e:	eb 12                	jmp    804542 <spawnl+0x20f>
+  804530:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804537:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80453b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804542:	48 8b 10             	mov    (%rax),%rdx
+  804545:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80454c:	89 c9                	mov    %ecx,%ecx
+  80454e:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  804552:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  804559:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80455f:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  804565:	72 92                	jb     8044f9 <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  804567:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80456e:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804575:	48 89 d6             	mov    %rdx,%rsi
+  804578:	48 89 c7             	mov    %rax,%rdi
+  80457b:	48 b8 b2 3e 80 00 00 	movabs $0x803eb2,%rax
+  804582:	00 00 00 
+  804585:	ff d0                	call   *%rax
+  804587:	48 89 dc             	mov    %rbx,%rsp
+}
+  80458a:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  80458e:	5b                   	pop    %rbx
+  80458f:	41 5c                	pop    %r12
+  804591:	41 5d                	pop    %r13
+  804593:	5d                   	pop    %rbp
+  804594:	c3                   	ret
+
+0000000000804595 <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  804595:	55                   	push   %rbp
+  804596:	48 89 e5             	mov    %rsp,%rbp
+  804599:	48 83 ec 50          	sub    $0x50,%rsp
+  80459d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8045a0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8045a4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  8045a8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8045af:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  8045b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8045b7:	eb 33                	jmp    8045ec <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  8045b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045bc:	48 98                	cltq
+  8045be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8045c5:	00 
+  8045c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045ca:	48 01 d0             	add    %rdx,%rax
+  8045cd:	48 8b 00             	mov    (%rax),%rax
+  8045d0:	48 89 c7             	mov    %rax,%rdi
+  8045d3:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  8045da:	00 00 00 
+  8045dd:	ff d0                	call   *%rax
+  8045df:	83 c0 01             	add    $0x1,%eax
+  8045e2:	48 98                	cltq
+  8045e4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  8045e8:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8045ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045ef:	48 98                	cltq
+  8045f1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8045f8:	00 
+  8045f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045fd:	48 01 d0             	add    %rdx,%rax
+  804600:	48 8b 00             	mov    (%rax),%rax
+  804603:	48 85 c0             	test   %rax,%rax
+  804606:	75 b1                	jne    8045b9 <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  804608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80460c:	48 f7 d8             	neg    %rax
+  80460f:	48 05 00 40 40 00    	add    $0x404000,%rax
+  804615:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  804619:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80461d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804621:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804625:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  804629:	48 89 c2             	mov    %rax,%rdx
+  80462c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80462f:	83 c0 01             	add    $0x1,%eax
+  804632:	c1 e0 03             	shl    $0x3,%eax
+  804635:	48 98                	cltq
+  804637:	48 f7 d8             	neg    %rax
+  80463a:	48 01 d0             	add    %rdx,%rax
+  80463d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  804641:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804645:	48 83 e8 10          	sub    $0x10,%rax
+  804649:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80464f:	77 0a                	ja     80465b <init_stack+0xc6>
+    return -E_NO_MEM;
+  804651:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804656:	e9 80 02 00 00       	jmp    8048db <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  80465b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804662:	eb 3c                	jmp    8046a0 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  804664:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804667:	48 98                	cltq
+  804669:	48 05 00 00 40 00    	add    $0x400000,%rax
+  80466f:	ba 07 00 00 00       	mov    $0x7,%edx
+  804674:	48 89 c6             	mov    %rax,%rsi
+  804677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80467c:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804683:	00 00 00 
+  804686:	ff d0                	call   *%rax
+  804688:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80468b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80468f:	79 08                	jns    804699 <init_stack+0x104>
+      return r;
+  804691:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804694:	e9 42 02 00 00       	jmp    8048db <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804699:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  8046a0:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  8046a7:	7e bb                	jle    804664 <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  8046a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8046b0:	e9 8f 00 00 00       	jmp    804744 <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  8046b5:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  8046bc:	00 00 00 
+  8046bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046c3:	48 01 d0             	add    %rdx,%rax
+  8046c6:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8046cd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8046d0:	48 98                	cltq
+  8046d2:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8046d9:	00 
+  8046da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046de:	48 01 c8             	add    %rcx,%rax
+  8046e1:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  8046e4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8046e7:	48 98                	cltq
+  8046e9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8046f0:	00 
+  8046f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046f5:	48 01 d0             	add    %rdx,%rax
+  8046f8:	48 8b 10             	mov    (%rax),%rdx
+  8046fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046ff:	48 89 d6             	mov    %rdx,%rsi
+  804702:	48 89 c7             	mov    %rax,%rdi
+  804705:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  80470c:	00 00 00 
+  80470f:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  804711:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804714:	48 98                	cltq
+  804716:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80471d:	00 
+  80471e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804722:	48 01 d0             	add    %rdx,%rax
+  804725:	48 8b 00             	mov    (%rax),%rax
+  804728:	48 89 c7             	mov    %rax,%rdi
+  80472b:	48 b8 d0 13 80 00 00 	movabs $0x8013d0,%rax
+  804732:	00 00 00 
+  804735:	ff d0                	call   *%rax
+  804737:	83 c0 01             	add    $0x1,%eax
+  80473a:	48 98                	cltq
+  80473c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  804740:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  804744:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804747:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  80474a:	0f 8c 65 ff ff ff    	jl     8046b5 <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  804750:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804753:	48 98                	cltq
+  804755:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80475c:	00 
+  80475d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804761:	48 01 d0             	add    %rdx,%rax
+  804764:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  80476b:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  804772:	00 
+  804773:	74 3e                	je     8047b3 <init_stack+0x21e>
+  804775:	48 b8 48 66 80 00 00 	movabs $0x806648,%rax
+  80477c:	00 00 00 
+  80477f:	48 89 c1             	mov    %rax,%rcx
+  804782:	48 b8 73 66 80 00 00 	movabs $0x806673,%rax
+  804789:	00 00 00 
+  80478c:	48 89 c2             	mov    %rax,%rdx
+  80478f:	be 0c 01 00 00       	mov    $0x10c,%esi
+  804794:	48 b8 08 66 80 00 00 	movabs $0x806608,%rax
+  80479b:	00 00 00 
+  80479e:	48 89 c7             	mov    %rax,%rdi
+  8047a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a6:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  8047ad:	00 00 00 
+  8047b0:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  8047b3:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  8047ba:	00 00 00 
+  8047bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047c1:	48 01 d0             	add    %rdx,%rax
+  8047c4:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8047cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047cf:	48 83 e8 08          	sub    $0x8,%rax
+  8047d3:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  8047d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047da:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  8047de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047e1:	48 98                	cltq
+  8047e3:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8047e6:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  8047ed:	00 00 00 
+  8047f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047f4:	48 01 d0             	add    %rdx,%rax
+  8047f7:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  8047fd:	48 89 c2             	mov    %rax,%rdx
+  804800:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804804:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804807:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  80480e:	eb 78                	jmp    804888 <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  804810:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804813:	48 98                	cltq
+  804815:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80481c:	00 00 00 
+  80481f:	48 01 d0             	add    %rdx,%rax
+  804822:	48 89 c2             	mov    %rax,%rdx
+  804825:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804828:	48 98                	cltq
+  80482a:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  804831:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804834:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80483a:	48 89 d1             	mov    %rdx,%rcx
+  80483d:	89 c2                	mov    %eax,%edx
+  80483f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804844:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  80484b:	00 00 00 
+  80484e:	ff d0                	call   *%rax
+  804850:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804853:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804857:	78 43                	js     80489c <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  804859:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80485c:	48 98                	cltq
+  80485e:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804864:	48 89 c6             	mov    %rax,%rsi
+  804867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80486c:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804873:	00 00 00 
+  804876:	ff d0                	call   *%rax
+  804878:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80487b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80487f:	78 1e                	js     80489f <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804881:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804888:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  80488f:	0f 8e 7b ff ff ff    	jle    804810 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  804895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80489a:	eb 3f                	jmp    8048db <init_stack+0x346>
+      goto error;
+  80489c:	90                   	nop
+  80489d:	eb 01                	jmp    8048a0 <init_stack+0x30b>
+      goto error;
+  80489f:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  8048a0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8048a7:	eb 26                	jmp    8048cf <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  8048a9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8048ac:	48 98                	cltq
+  8048ae:	48 05 00 00 40 00    	add    $0x400000,%rax
+  8048b4:	48 89 c6             	mov    %rax,%rsi
+  8048b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048bc:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8048c3:	00 00 00 
+  8048c6:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  8048c8:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  8048cf:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  8048d6:	7e d1                	jle    8048a9 <init_stack+0x314>
+  return r;
+  8048d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8048db:	c9                   	leave
+  8048dc:	c3                   	ret
+
+00000000008048dd <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  8048dd:	55                   	push   %rbp
+  8048de:	48 89 e5             	mov    %rsp,%rbp
+  8048e1:	48 83 ec 50          	sub    $0x50,%rsp
+  8048e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8048e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8048f0:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  8048f3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8048f7:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  8048fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ff:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804904:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804907:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80490b:	74 21                	je     80492e <map_segment+0x51>
+    va -= i;
+  80490d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804910:	48 98                	cltq
+  804912:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  804916:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804919:	48 98                	cltq
+  80491b:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  80491f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804922:	48 98                	cltq
+  804924:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  804928:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80492b:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  80492e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804935:	e9 7b 01 00 00       	jmp    804ab5 <map_segment+0x1d8>
+    if (i >= filesz) {
+  80493a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80493d:	48 98                	cltq
+  80493f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  804943:	72 3c                	jb     804981 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  804945:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804948:	48 63 d0             	movslq %eax,%rdx
+  80494b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80494f:	48 01 d0             	add    %rdx,%rax
+  804952:	48 89 c1             	mov    %rax,%rcx
+  804955:	8b 55 10             	mov    0x10(%rbp),%edx
+  804958:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80495b:	48 89 ce             	mov    %rcx,%rsi
+  80495e:	89 c7                	mov    %eax,%edi
+  804960:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804967:	00 00 00 
+  80496a:	ff d0                	call   *%rax
+  80496c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80496f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804973:	0f 89 35 01 00 00    	jns    804aae <map_segment+0x1d1>
+        return r;
+  804979:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80497c:	e9 48 01 00 00       	jmp    804ac9 <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  804981:	ba 07 00 00 00       	mov    $0x7,%edx
+  804986:	be 00 00 40 00       	mov    $0x400000,%esi
+  80498b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804990:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804997:	00 00 00 
+  80499a:	ff d0                	call   *%rax
+  80499c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80499f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8049a3:	79 08                	jns    8049ad <map_segment+0xd0>
+        return r;
+  8049a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049a8:	e9 1c 01 00 00       	jmp    804ac9 <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  8049ad:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  8049b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049b3:	01 c2                	add    %eax,%edx
+  8049b5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8049b8:	89 d6                	mov    %edx,%esi
+  8049ba:	89 c7                	mov    %eax,%edi
+  8049bc:	48 b8 8f 32 80 00 00 	movabs $0x80328f,%rax
+  8049c3:	00 00 00 
+  8049c6:	ff d0                	call   *%rax
+  8049c8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8049cb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8049cf:	79 08                	jns    8049d9 <map_segment+0xfc>
+        return r;
+  8049d1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049d4:	e9 f0 00 00 00       	jmp    804ac9 <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  8049d9:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  8049e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049e3:	48 98                	cltq
+  8049e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049e9:	48 29 c2             	sub    %rax,%rdx
+  8049ec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8049f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049f3:	48 63 d0             	movslq %eax,%rdx
+  8049f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049fa:	48 39 c2             	cmp    %rax,%rdx
+  8049fd:	48 0f 47 d0          	cmova  %rax,%rdx
+  804a01:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a04:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a09:	89 c7                	mov    %eax,%edi
+  804a0b:	48 b8 14 31 80 00 00 	movabs $0x803114,%rax
+  804a12:	00 00 00 
+  804a15:	ff d0                	call   *%rax
+  804a17:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804a1a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804a1e:	79 08                	jns    804a28 <map_segment+0x14b>
+        return r;
+  804a20:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a23:	e9 a1 00 00 00       	jmp    804ac9 <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  804a28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a2b:	48 63 d0             	movslq %eax,%rdx
+  804a2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a32:	48 01 d0             	add    %rdx,%rax
+  804a35:	48 89 c1             	mov    %rax,%rcx
+  804a38:	8b 55 10             	mov    0x10(%rbp),%edx
+  804a3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a3e:	41 89 d0             	mov    %edx,%r8d
+  804a41:	89 c2                	mov    %eax,%edx
+  804a43:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a4d:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  804a54:	00 00 00 
+  804a57:	ff d0                	call   *%rax
+  804a59:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804a5c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804a60:	79 36                	jns    804a98 <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  804a62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a65:	89 c1                	mov    %eax,%ecx
+  804a67:	48 b8 88 66 80 00 00 	movabs $0x806688,%rax
+  804a6e:	00 00 00 
+  804a71:	48 89 c2             	mov    %rax,%rdx
+  804a74:	be 40 01 00 00       	mov    $0x140,%esi
+  804a79:	48 b8 08 66 80 00 00 	movabs $0x806608,%rax
+  804a80:	00 00 00 
+  804a83:	48 89 c7             	mov    %rax,%rdi
+  804a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8b:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  804a92:	00 00 00 
+  804a95:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  804a98:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa2:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804aa9:	00 00 00 
+  804aac:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  804aae:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  804ab5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ab8:	48 98                	cltq
+  804aba:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804abe:	0f 82 76 fe ff ff    	jb     80493a <map_segment+0x5d>
+    }
+  }
+  return 0;
+  804ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ac9:	c9                   	leave
+  804aca:	c3                   	ret
+
+0000000000804acb <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  804acb:	55                   	push   %rbp
+  804acc:	48 89 e5             	mov    %rsp,%rbp
+  804acf:	48 83 ec 20          	sub    $0x20,%rsp
+  804ad3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  804ad6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  804add:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ae4:	00 
+  804ae5:	e9 e7 00 00 00       	jmp    804bd1 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  804aea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aee:	48 c1 e8 27          	shr    $0x27,%rax
+  804af2:	48 89 c2             	mov    %rax,%rdx
+  804af5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804afc:	01 00 00 
+  804aff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b03:	83 e0 01             	and    $0x1,%eax
+  804b06:	48 85 c0             	test   %rax,%rax
+  804b09:	0f 84 b9 00 00 00    	je     804bc8 <copy_shared_pages+0xfd>
+  804b0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b13:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b17:	48 89 c2             	mov    %rax,%rdx
+  804b1a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804b21:	01 00 00 
+  804b24:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b28:	83 e0 01             	and    $0x1,%eax
+  804b2b:	48 85 c0             	test   %rax,%rax
+  804b2e:	0f 84 94 00 00 00    	je     804bc8 <copy_shared_pages+0xfd>
+  804b34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b38:	48 c1 e8 15          	shr    $0x15,%rax
+  804b3c:	48 89 c2             	mov    %rax,%rdx
+  804b3f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804b46:	01 00 00 
+  804b49:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b4d:	83 e0 01             	and    $0x1,%eax
+  804b50:	48 85 c0             	test   %rax,%rax
+  804b53:	74 73                	je     804bc8 <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  804b55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b59:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b5d:	48 89 c2             	mov    %rax,%rdx
+  804b60:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b67:	01 00 00 
+  804b6a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b6e:	25 01 04 00 00       	and    $0x401,%eax
+  804b73:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  804b79:	75 4e                	jne    804bc9 <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  804b7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b7f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b83:	48 89 c2             	mov    %rax,%rdx
+  804b86:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b8d:	01 00 00 
+  804b90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b94:	25 07 0e 00 00       	and    $0xe07,%eax
+  804b99:	89 c6                	mov    %eax,%esi
+  804b9b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804b9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ba3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804ba6:	41 89 f0             	mov    %esi,%r8d
+  804ba9:	48 89 c6             	mov    %rax,%rsi
+  804bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bb1:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  804bb8:	00 00 00 
+  804bbb:	ff d0                	call   *%rax
+  804bbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  804bc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bc4:	78 21                	js     804be7 <copy_shared_pages+0x11c>
+  804bc6:	eb 01                	jmp    804bc9 <copy_shared_pages+0xfe>
+      continue;
+  804bc8:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  804bc9:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  804bd0:	00 
+  804bd1:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  804bd8:	00 00 00 
+  804bdb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804bdf:	0f 83 05 ff ff ff    	jae    804aea <copy_shared_pages+0x1f>
+  804be5:	eb 01                	jmp    804be8 <copy_shared_pages+0x11d>
+        break;
+  804be7:	90                   	nop
+    }
+  }
+  return err;
+  804be8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804beb:	c9                   	leave
+  804bec:	c3                   	ret
+
+0000000000804bed <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804bed:	55                   	push   %rbp
+  804bee:	48 89 e5             	mov    %rsp,%rbp
+  804bf1:	48 83 ec 10          	sub    $0x10,%rsp
+  804bf5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804bf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bfd:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804c02:	48 89 c7             	mov    %rax,%rdi
+  804c05:	48 b8 13 4c 80 00 00 	movabs $0x804c13,%rax
+  804c0c:	00 00 00 
+  804c0f:	ff d0                	call   *%rax
+}
+  804c11:	c9                   	leave
+  804c12:	c3                   	ret
+
+0000000000804c13 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804c13:	55                   	push   %rbp
+  804c14:	48 89 e5             	mov    %rsp,%rbp
+  804c17:	48 83 ec 50          	sub    $0x50,%rsp
+  804c1b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804c1f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804c23:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804c2a:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804c2b:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804c30:	74 0a                	je     804c3c <pipe_size+0x29>
+  804c32:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804c39:	00 
+  804c3a:	76 0a                	jbe    804c46 <pipe_size+0x33>
+    return -E_INVAL;
+  804c3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804c41:	e9 cc 02 00 00       	jmp    804f12 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804c46:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804c4a:	48 89 c7             	mov    %rax,%rdi
+  804c4d:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  804c54:	00 00 00 
+  804c57:	ff d0                	call   *%rax
+  804c59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c60:	0f 88 a8 02 00 00    	js     804f0e <pipe_size+0x2fb>
+  804c66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c6a:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c6f:	48 89 c6             	mov    %rax,%rsi
+  804c72:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c77:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804c7e:	00 00 00 
+  804c81:	ff d0                	call   *%rax
+  804c83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c86:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c8a:	0f 88 7e 02 00 00    	js     804f0e <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804c90:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804c94:	48 89 c7             	mov    %rax,%rdi
+  804c97:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  804c9e:	00 00 00 
+  804ca1:	ff d0                	call   *%rax
+  804ca3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ca6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804caa:	0f 88 43 02 00 00    	js     804ef3 <pipe_size+0x2e0>
+  804cb0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cb4:	ba 07 04 00 00       	mov    $0x407,%edx
+  804cb9:	48 89 c6             	mov    %rax,%rsi
+  804cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cc1:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804cc8:	00 00 00 
+  804ccb:	ff d0                	call   *%rax
+  804ccd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cd4:	0f 88 19 02 00 00    	js     804ef3 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804cda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cde:	48 89 c7             	mov    %rax,%rdi
+  804ce1:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  804ce8:	00 00 00 
+  804ceb:	ff d0                	call   *%rax
+  804ced:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804cf1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804cf8:	00 
+  804cf9:	e9 a2 00 00 00       	jmp    804da0 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804cfe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d02:	48 c1 e0 0c          	shl    $0xc,%rax
+  804d06:	48 89 c2             	mov    %rax,%rdx
+  804d09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0d:	48 01 d0             	add    %rdx,%rax
+  804d10:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d15:	48 89 c6             	mov    %rax,%rsi
+  804d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d1d:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  804d24:	00 00 00 
+  804d27:	ff d0                	call   *%rax
+  804d29:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d30:	0f 88 37 01 00 00    	js     804e6d <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804d36:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d3a:	48 89 c7             	mov    %rax,%rdi
+  804d3d:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  804d44:	00 00 00 
+  804d47:	ff d0                	call   *%rax
+  804d49:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d4d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804d51:	48 01 c2             	add    %rax,%rdx
+  804d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d58:	48 c1 e0 0c          	shl    $0xc,%rax
+  804d5c:	48 89 c1             	mov    %rax,%rcx
+  804d5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d63:	48 01 c8             	add    %rcx,%rax
+  804d66:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804d6c:	48 89 d1             	mov    %rdx,%rcx
+  804d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d74:	48 89 c6             	mov    %rax,%rsi
+  804d77:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7c:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  804d83:	00 00 00 
+  804d86:	ff d0                	call   *%rax
+  804d88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d8b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d8f:	79 0a                	jns    804d9b <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804d91:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804d96:	e9 d3 00 00 00       	jmp    804e6e <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804d9b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804da0:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804da7:	00 
+  804da8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804dac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db0:	48 01 d0             	add    %rdx,%rax
+  804db3:	48 83 c0 1f          	add    $0x1f,%rax
+  804db7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804dbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dc4:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804dc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dcc:	48 29 d0             	sub    %rdx,%rax
+  804dcf:	48 c1 e8 0c          	shr    $0xc,%rax
+  804dd3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804dd7:	0f 82 21 ff ff ff    	jb     804cfe <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804ddd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804de1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804de5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804de9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804ded:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804df1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804df5:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804dfc:	00 00 00 
+  804dff:	8b 12                	mov    (%rdx),%edx
+  804e01:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804e03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e07:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804e0e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e12:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804e19:	00 00 00 
+  804e1c:	8b 12                	mov    (%rdx),%edx
+  804e1e:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804e20:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e24:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804e2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e2f:	48 89 c7             	mov    %rax,%rdi
+  804e32:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  804e39:	00 00 00 
+  804e3c:	ff d0                	call   *%rax
+  804e3e:	89 c2                	mov    %eax,%edx
+  804e40:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804e44:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804e46:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e4a:	48 89 c7             	mov    %rax,%rdi
+  804e4d:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  804e54:	00 00 00 
+  804e57:	ff d0                	call   *%rax
+  804e59:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e5d:	48 83 c2 04          	add    $0x4,%rdx
+  804e61:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804e63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e68:	e9 a5 00 00 00       	jmp    804f12 <pipe_size+0x2ff>
+      goto err2;
+  804e6d:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804e6e:	eb 58                	jmp    804ec8 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804e70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e74:	48 c1 e0 0c          	shl    $0xc,%rax
+  804e78:	48 89 c2             	mov    %rax,%rdx
+  804e7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e7f:	48 01 d0             	add    %rdx,%rax
+  804e82:	48 89 c6             	mov    %rax,%rsi
+  804e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e8a:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804e91:	00 00 00 
+  804e94:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804e96:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e9a:	48 89 c7             	mov    %rax,%rdi
+  804e9d:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  804ea4:	00 00 00 
+  804ea7:	ff d0                	call   *%rax
+  804ea9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804ead:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804eb1:	48 01 d0             	add    %rdx,%rax
+  804eb4:	48 89 c6             	mov    %rax,%rsi
+  804eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ebc:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804ec3:	00 00 00 
+  804ec6:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ecc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804ed0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804ed4:	48 85 c0             	test   %rax,%rax
+  804ed7:	75 97                	jne    804e70 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804ed9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804edd:	48 89 c6             	mov    %rax,%rsi
+  804ee0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee5:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804eec:	00 00 00 
+  804eef:	ff d0                	call   *%rax
+  804ef1:	eb 01                	jmp    804ef4 <pipe_size+0x2e1>
+    goto err1;
+  804ef3:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804ef4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ef8:	48 89 c6             	mov    %rax,%rsi
+  804efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f00:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  804f07:	00 00 00 
+  804f0a:	ff d0                	call   *%rax
+  804f0c:	eb 01                	jmp    804f0f <pipe_size+0x2fc>
+    goto err;
+  804f0e:	90                   	nop
+err:
+  return r;
+  804f0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804f12:	c9                   	leave
+  804f13:	c3                   	ret
+
+0000000000804f14 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804f14:	55                   	push   %rbp
+  804f15:	48 89 e5             	mov    %rsp,%rbp
+  804f18:	53                   	push   %rbx
+  804f19:	48 83 ec 28          	sub    $0x28,%rsp
+  804f1d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804f21:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804f25:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f2c:	00 00 00 
+  804f2f:	8b 40 04             	mov    0x4(%rax),%eax
+  804f32:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f37:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f3e:	00 00 00 
+  804f41:	48 98                	cltq
+  804f43:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f4a:	48 01 d0             	add    %rdx,%rax
+  804f4d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804f53:	8b 00                	mov    (%rax),%eax
+  804f55:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804f58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f5c:	48 89 c7             	mov    %rax,%rdi
+  804f5f:	48 b8 05 5e 80 00 00 	movabs $0x805e05,%rax
+  804f66:	00 00 00 
+  804f69:	ff d0                	call   *%rax
+  804f6b:	89 c3                	mov    %eax,%ebx
+  804f6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f71:	48 89 c7             	mov    %rax,%rdi
+  804f74:	48 b8 05 5e 80 00 00 	movabs $0x805e05,%rax
+  804f7b:	00 00 00 
+  804f7e:	ff d0                	call   *%rax
+  804f80:	39 c3                	cmp    %eax,%ebx
+  804f82:	0f 94 c0             	sete   %al
+  804f85:	0f b6 c0             	movzbl %al,%eax
+  804f88:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804f8b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f92:	00 00 00 
+  804f95:	8b 40 04             	mov    0x4(%rax),%eax
+  804f98:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f9d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fa4:	00 00 00 
+  804fa7:	48 98                	cltq
+  804fa9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804fb0:	48 01 d0             	add    %rdx,%rax
+  804fb3:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804fb9:	8b 00                	mov    (%rax),%eax
+  804fbb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fc1:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804fc4:	75 05                	jne    804fcb <_pipeisclosed+0xb7>
+      return ret;
+  804fc6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804fc9:	eb 68                	jmp    805033 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804fcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fce:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804fd1:	0f 84 4e ff ff ff    	je     804f25 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804fd7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804fde:	00 00 00 
+  804fe1:	8b 40 04             	mov    0x4(%rax),%eax
+  804fe4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804fe9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ff0:	00 00 00 
+  804ff3:	48 98                	cltq
+  804ff5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ffc:	48 01 d0             	add    %rdx,%rax
+  804fff:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805005:	8b 10                	mov    (%rax),%edx
+  805007:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80500a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80500d:	89 c6                	mov    %eax,%esi
+  80500f:	48 b8 b0 66 80 00 00 	movabs $0x8066b0,%rax
+  805016:	00 00 00 
+  805019:	48 89 c7             	mov    %rax,%rdi
+  80501c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805021:	49 b8 21 05 80 00 00 	movabs $0x800521,%r8
+  805028:	00 00 00 
+  80502b:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80502e:	e9 f2 fe ff ff       	jmp    804f25 <_pipeisclosed+0x11>
+  }
+}
+  805033:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805037:	c9                   	leave
+  805038:	c3                   	ret
+
+0000000000805039 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  805039:	55                   	push   %rbp
+  80503a:	48 89 e5             	mov    %rsp,%rbp
+  80503d:	48 83 ec 30          	sub    $0x30,%rsp
+  805041:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805044:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805048:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80504b:	48 89 d6             	mov    %rdx,%rsi
+  80504e:	89 c7                	mov    %eax,%edi
+  805050:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  805057:	00 00 00 
+  80505a:	ff d0                	call   *%rax
+  80505c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80505f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805063:	79 05                	jns    80506a <pipeisclosed+0x31>
+    return r;
+  805065:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805068:	eb 31                	jmp    80509b <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80506a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80506e:	48 89 c7             	mov    %rax,%rdi
+  805071:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  805078:	00 00 00 
+  80507b:	ff d0                	call   *%rax
+  80507d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  805081:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805085:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805089:	48 89 d6             	mov    %rdx,%rsi
+  80508c:	48 89 c7             	mov    %rax,%rdi
+  80508f:	48 b8 14 4f 80 00 00 	movabs $0x804f14,%rax
+  805096:	00 00 00 
+  805099:	ff d0                	call   *%rax
+}
+  80509b:	c9                   	leave
+  80509c:	c3                   	ret
+
+000000000080509d <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80509d:	55                   	push   %rbp
+  80509e:	48 89 e5             	mov    %rsp,%rbp
+  8050a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8050a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8050a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ad:	8b 40 18             	mov    0x18(%rax),%eax
+  8050b0:	8d 50 01             	lea    0x1(%rax),%edx
+  8050b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050b7:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8050ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050be:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8050c1:	85 c0                	test   %eax,%eax
+  8050c3:	74 27                	je     8050ec <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8050c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050c9:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8050d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050d4:	48 83 c0 18          	add    $0x18,%rax
+  8050d8:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8050dd:	48 89 c7             	mov    %rax,%rdi
+  8050e0:	48 b8 9a 26 80 00 00 	movabs $0x80269a,%rax
+  8050e7:	00 00 00 
+  8050ea:	ff d0                	call   *%rax
+  }
+}
+  8050ec:	90                   	nop
+  8050ed:	c9                   	leave
+  8050ee:	c3                   	ret
+
+00000000008050ef <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8050ef:	55                   	push   %rbp
+  8050f0:	48 89 e5             	mov    %rsp,%rbp
+  8050f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8050f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8050fb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8050fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805102:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  805109:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80510d:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805111:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805114:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80511b:	89 c6                	mov    %eax,%esi
+  80511d:	48 89 cf             	mov    %rcx,%rdi
+  805120:	48 b8 4b 26 80 00 00 	movabs $0x80264b,%rax
+  805127:	00 00 00 
+  80512a:	ff d0                	call   *%rax
+}
+  80512c:	90                   	nop
+  80512d:	c9                   	leave
+  80512e:	c3                   	ret
+
+000000000080512f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80512f:	55                   	push   %rbp
+  805130:	48 89 e5             	mov    %rsp,%rbp
+  805133:	48 83 ec 70          	sub    $0x70,%rsp
+  805137:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80513b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80513f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805143:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805147:	48 89 c7             	mov    %rax,%rdi
+  80514a:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  805151:	00 00 00 
+  805154:	ff d0                	call   *%rax
+  805156:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80515a:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80515f:	75 0a                	jne    80516b <devpipe_read+0x3c>
+    return 0;
+  805161:	b8 00 00 00 00       	mov    $0x0,%eax
+  805166:	e9 63 01 00 00       	jmp    8052ce <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80516b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80516f:	8b 40 18             	mov    0x18(%rax),%eax
+  805172:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  805175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805179:	48 8b 10             	mov    (%rax),%rdx
+  80517c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805180:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805184:	48 39 c2             	cmp    %rax,%rdx
+  805187:	75 42                	jne    8051cb <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  805189:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80518d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805191:	48 89 d6             	mov    %rdx,%rsi
+  805194:	48 89 c7             	mov    %rax,%rdi
+  805197:	48 b8 14 4f 80 00 00 	movabs $0x804f14,%rax
+  80519e:	00 00 00 
+  8051a1:	ff d0                	call   *%rax
+  8051a3:	85 c0                	test   %eax,%eax
+  8051a5:	74 0a                	je     8051b1 <devpipe_read+0x82>
+      return 0;
+  8051a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051ac:	e9 1d 01 00 00       	jmp    8052ce <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8051b1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8051b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051b8:	89 d6                	mov    %edx,%esi
+  8051ba:	48 89 c7             	mov    %rax,%rdi
+  8051bd:	48 b8 ef 50 80 00 00 	movabs $0x8050ef,%rax
+  8051c4:	00 00 00 
+  8051c7:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8051c9:	eb a0                	jmp    80516b <devpipe_read+0x3c>
+      break;
+  8051cb:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8051cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8051d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8051d4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8051d8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8051dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8051e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e8:	48 8b 00             	mov    (%rax),%rax
+  8051eb:	48 29 c2             	sub    %rax,%rdx
+  8051ee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8051f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051fa:	48 39 c2             	cmp    %rax,%rdx
+  8051fd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805201:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  805205:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805209:	48 8b 00             	mov    (%rax),%rax
+  80520c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805210:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805214:	ba 00 00 00 00       	mov    $0x0,%edx
+  805219:	48 f7 f1             	div    %rcx
+  80521c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805220:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805224:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80522c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805230:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805234:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805238:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80523c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805240:	48 39 c2             	cmp    %rax,%rdx
+  805243:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805247:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80524b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80524f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  805253:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805257:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80525b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80525f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805263:	48 89 ce             	mov    %rcx,%rsi
+  805266:	48 89 c7             	mov    %rax,%rdi
+  805269:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  805270:	00 00 00 
+  805273:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  805275:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805279:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80527d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805281:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  805285:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805289:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80528d:	48 01 d1             	add    %rdx,%rcx
+  805290:	48 89 c2             	mov    %rax,%rdx
+  805293:	48 89 cf             	mov    %rcx,%rdi
+  805296:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  80529d:	00 00 00 
+  8052a0:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8052a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052a6:	48 8b 10             	mov    (%rax),%rdx
+  8052a9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8052ad:	48 01 c2             	add    %rax,%rdx
+  8052b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052b4:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8052b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052bb:	48 89 c7             	mov    %rax,%rdi
+  8052be:	48 b8 9d 50 80 00 00 	movabs $0x80509d,%rax
+  8052c5:	00 00 00 
+  8052c8:	ff d0                	call   *%rax
+  return n;
+  8052ca:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8052ce:	c9                   	leave
+  8052cf:	c3                   	ret
+
+00000000008052d0 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8052d0:	55                   	push   %rbp
+  8052d1:	48 89 e5             	mov    %rsp,%rbp
+  8052d4:	48 83 ec 70          	sub    $0x70,%rsp
+  8052d8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8052dc:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8052e0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8052e4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8052e8:	48 89 c7             	mov    %rax,%rdi
+  8052eb:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  8052f2:	00 00 00 
+  8052f5:	ff d0                	call   *%rax
+  8052f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8052fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8052ff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805303:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80530a:	00 
+  80530b:	e9 b8 01 00 00       	jmp    8054c8 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805314:	8b 40 18             	mov    0x18(%rax),%eax
+  805317:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80531a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80531e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805322:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805326:	48 8b 00             	mov    (%rax),%rax
+  805329:	48 29 c2             	sub    %rax,%rdx
+  80532c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805330:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805334:	48 39 c2             	cmp    %rax,%rdx
+  805337:	75 4d                	jne    805386 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  805339:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80533d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805341:	48 89 d6             	mov    %rdx,%rsi
+  805344:	48 89 c7             	mov    %rax,%rdi
+  805347:	48 b8 14 4f 80 00 00 	movabs $0x804f14,%rax
+  80534e:	00 00 00 
+  805351:	ff d0                	call   *%rax
+  805353:	85 c0                	test   %eax,%eax
+  805355:	74 0a                	je     805361 <devpipe_write+0x91>
+        return 0;
+  805357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80535c:	e9 79 01 00 00       	jmp    8054da <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805361:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805364:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805368:	89 d6                	mov    %edx,%esi
+  80536a:	48 89 c7             	mov    %rax,%rdi
+  80536d:	48 b8 ef 50 80 00 00 	movabs $0x8050ef,%rax
+  805374:	00 00 00 
+  805377:	ff d0                	call   *%rax
+      m = 0;
+  805379:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805380:	00 
+      continue;
+  805381:	e9 3a 01 00 00       	jmp    8054c0 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  805386:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80538a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80538e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805392:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805396:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80539a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80539e:	48 8b 08             	mov    (%rax),%rcx
+  8053a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8053a9:	48 29 c1             	sub    %rax,%rcx
+  8053ac:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8053b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8053b4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8053b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053bc:	48 39 c2             	cmp    %rax,%rdx
+  8053bf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8053c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8053c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8053cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8053d3:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8053d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053dc:	48 f7 f1             	div    %rcx
+  8053df:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8053e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8053eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053ef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053f3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8053f7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8053fb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8053ff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805403:	48 39 c2             	cmp    %rax,%rdx
+  805406:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80540a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80540e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805412:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805416:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80541a:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80541e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805422:	48 01 d1             	add    %rdx,%rcx
+  805425:	48 89 c2             	mov    %rax,%rdx
+  805428:	48 89 cf             	mov    %rcx,%rdi
+  80542b:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  805432:	00 00 00 
+  805435:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80543b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80543f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805443:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805447:	73 4d                	jae    805496 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805449:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80544d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805451:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805455:	48 29 c2             	sub    %rax,%rdx
+  805458:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80545c:	48 01 c2             	add    %rax,%rdx
+  80545f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805463:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805467:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80546b:	48 89 c1             	mov    %rax,%rcx
+  80546e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805472:	48 01 c1             	add    %rax,%rcx
+  805475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805479:	48 01 c1             	add    %rax,%rcx
+  80547c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805480:	48 83 c0 20          	add    $0x20,%rax
+  805484:	48 89 ce             	mov    %rcx,%rsi
+  805487:	48 89 c7             	mov    %rax,%rdi
+  80548a:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  805491:	00 00 00 
+  805494:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805496:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80549a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80549e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054a2:	48 01 c2             	add    %rax,%rdx
+  8054a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054a9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8054ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054b1:	48 89 c7             	mov    %rax,%rdi
+  8054b4:	48 b8 9d 50 80 00 00 	movabs $0x80509d,%rax
+  8054bb:	00 00 00 
+  8054be:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8054c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8054c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054cc:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8054d0:	0f 82 3a fe ff ff    	jb     805310 <devpipe_write+0x40>
+  }
+
+  return i;
+  8054d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8054da:	c9                   	leave
+  8054db:	c3                   	ret
+
+00000000008054dc <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8054dc:	55                   	push   %rbp
+  8054dd:	48 89 e5             	mov    %rsp,%rbp
+  8054e0:	48 83 ec 40          	sub    $0x40,%rsp
+  8054e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8054e8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8054eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8054ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054f3:	48 89 c7             	mov    %rax,%rdi
+  8054f6:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  8054fd:	00 00 00 
+  805500:	ff d0                	call   *%rax
+  805502:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805506:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80550d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805511:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805515:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805519:	48 89 d6             	mov    %rdx,%rsi
+  80551c:	48 89 c7             	mov    %rax,%rdi
+  80551f:	48 b8 7c 34 80 00 00 	movabs $0x80347c,%rax
+  805526:	00 00 00 
+  805529:	ff d0                	call   *%rax
+  80552b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80552e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805532:	79 08                	jns    80553c <devpipe_poll+0x60>
+    return r;
+  805534:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805537:	e9 85 00 00 00       	jmp    8055c1 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80553c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80553f:	83 e0 01             	and    $0x1,%eax
+  805542:	85 c0                	test   %eax,%eax
+  805544:	74 18                	je     80555e <devpipe_poll+0x82>
+  805546:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80554a:	48 8b 10             	mov    (%rax),%rdx
+  80554d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805551:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805555:	48 39 c2             	cmp    %rax,%rdx
+  805558:	74 04                	je     80555e <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80555a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80555e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805561:	83 e0 02             	and    $0x2,%eax
+  805564:	85 c0                	test   %eax,%eax
+  805566:	74 23                	je     80558b <devpipe_poll+0xaf>
+  805568:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80556c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805574:	48 8b 00             	mov    (%rax),%rax
+  805577:	48 29 c2             	sub    %rax,%rdx
+  80557a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80557e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805582:	48 39 c2             	cmp    %rax,%rdx
+  805585:	73 04                	jae    80558b <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805587:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80558b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80558f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805593:	48 89 d6             	mov    %rdx,%rsi
+  805596:	48 89 c7             	mov    %rax,%rdi
+  805599:	48 b8 14 4f 80 00 00 	movabs $0x804f14,%rax
+  8055a0:	00 00 00 
+  8055a3:	ff d0                	call   *%rax
+  8055a5:	85 c0                	test   %eax,%eax
+  8055a7:	74 04                	je     8055ad <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8055a9:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8055ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055b1:	75 0b                	jne    8055be <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8055b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055b7:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8055be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8055c1:	c9                   	leave
+  8055c2:	c3                   	ret
+
+00000000008055c3 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8055c3:	55                   	push   %rbp
+  8055c4:	48 89 e5             	mov    %rsp,%rbp
+  8055c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8055cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8055cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8055d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055d7:	48 89 c7             	mov    %rax,%rdi
+  8055da:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  8055e1:	00 00 00 
+  8055e4:	ff d0                	call   *%rax
+  8055e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8055ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055ee:	48 ba e1 66 80 00 00 	movabs $0x8066e1,%rdx
+  8055f5:	00 00 00 
+  8055f8:	48 89 d6             	mov    %rdx,%rsi
+  8055fb:	48 89 c7             	mov    %rax,%rdi
+  8055fe:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  805605:	00 00 00 
+  805608:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80560a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80560e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805612:	89 c1                	mov    %eax,%ecx
+  805614:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805618:	48 8b 00             	mov    (%rax),%rax
+  80561b:	89 c2                	mov    %eax,%edx
+  80561d:	89 c8                	mov    %ecx,%eax
+  80561f:	29 d0                	sub    %edx,%eax
+  805621:	89 c2                	mov    %eax,%edx
+  805623:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805627:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80562d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805631:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805638:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80563b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80563f:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805646:	00 00 00 
+  805649:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805655:	c9                   	leave
+  805656:	c3                   	ret
+
+0000000000805657 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805657:	55                   	push   %rbp
+  805658:	48 89 e5             	mov    %rsp,%rbp
+  80565b:	48 83 ec 40          	sub    $0x40,%rsp
+  80565f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805663:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805667:	48 89 c7             	mov    %rax,%rdi
+  80566a:	48 b8 a9 29 80 00 00 	movabs $0x8029a9,%rax
+  805671:	00 00 00 
+  805674:	ff d0                	call   *%rax
+  805676:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80567a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805681:	00 
+  805682:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805686:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80568a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80568e:	48 01 d0             	add    %rdx,%rax
+  805691:	48 83 c0 1f          	add    $0x1f,%rax
+  805695:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805699:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80569d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056a2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8056a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056aa:	48 29 d0             	sub    %rdx,%rax
+  8056ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056b1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8056b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056b9:	48 89 c6             	mov    %rax,%rsi
+  8056bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056c1:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8056c8:	00 00 00 
+  8056cb:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8056cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056d1:	48 89 c7             	mov    %rax,%rdi
+  8056d4:	48 b8 9d 50 80 00 00 	movabs $0x80509d,%rax
+  8056db:	00 00 00 
+  8056de:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8056e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8056e8:	eb 2f                	jmp    805719 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8056ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056ee:	48 83 e8 01          	sub    $0x1,%rax
+  8056f2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8056f6:	48 89 c2             	mov    %rax,%rdx
+  8056f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056fd:	48 01 d0             	add    %rdx,%rax
+  805700:	48 89 c6             	mov    %rax,%rsi
+  805703:	bf 00 00 00 00       	mov    $0x0,%edi
+  805708:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  80570f:	00 00 00 
+  805712:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805714:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805719:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80571e:	77 ca                	ja     8056ea <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805720:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805724:	48 89 c6             	mov    %rax,%rsi
+  805727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80572c:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  805733:	00 00 00 
+  805736:	ff d0                	call   *%rax
+}
+  805738:	c9                   	leave
+  805739:	c3                   	ret
+
+000000000080573a <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80573a:	55                   	push   %rbp
+  80573b:	48 89 e5             	mov    %rsp,%rbp
+  80573e:	48 83 ec 08          	sub    $0x8,%rsp
+  805742:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805745:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805749:	75 10                	jne    80575b <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80574b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805752:	00 00 00 
+  805755:	8b 00                	mov    (%rax),%eax
+  805757:	48 98                	cltq
+  805759:	eb 05                	jmp    805760 <vsyscall+0x26>
+  }
+  return 0;
+  80575b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805760:	c9                   	leave
+  805761:	c3                   	ret
+
+0000000000805762 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805762:	55                   	push   %rbp
+  805763:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805766:	bf 00 00 00 00       	mov    $0x0,%edi
+  80576b:	48 b8 3a 57 80 00 00 	movabs $0x80573a,%rax
+  805772:	00 00 00 
+  805775:	ff d0                	call   *%rax
+}
+  805777:	5d                   	pop    %rbp
+  805778:	c3                   	ret
+
+0000000000805779 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805779:	55                   	push   %rbp
+  80577a:	48 89 e5             	mov    %rsp,%rbp
+  80577d:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805781:	0f 31                	rdtsc
+  805783:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805786:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805789:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80578c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80578f:	48 c1 e2 20          	shl    $0x20,%rdx
+  805793:	48 09 d0             	or     %rdx,%rax
+  805796:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80579a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80579e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8057a2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057a9:	00 00 00 
+  8057ac:	8b 40 08             	mov    0x8(%rax),%eax
+  8057af:	48 98                	cltq
+  8057b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8057b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057be:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8057c2:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8057c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057d2:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8057d6:	48 89 d0             	mov    %rdx,%rax
+  8057d9:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8057e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057e5:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8057e9:	48 01 c8             	add    %rcx,%rax
+}
+  8057ec:	c9                   	leave
+  8057ed:	c3                   	ret
+
+00000000008057ee <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8057ee:	55                   	push   %rbp
+  8057ef:	48 89 e5             	mov    %rsp,%rbp
+  8057f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8057f6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8057f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057fc:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8057ff:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805803:	be 01 00 00 00       	mov    $0x1,%esi
+  805808:	48 89 c7             	mov    %rax,%rdi
+  80580b:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  805812:	00 00 00 
+  805815:	ff d0                	call   *%rax
+}
+  805817:	90                   	nop
+  805818:	c9                   	leave
+  805819:	c3                   	ret
+
+000000000080581a <getchar>:
+
+int
+getchar(void) {
+  80581a:	55                   	push   %rbp
+  80581b:	48 89 e5             	mov    %rsp,%rbp
+  80581e:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805822:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805826:	ba 01 00 00 00       	mov    $0x1,%edx
+  80582b:	48 89 c6             	mov    %rax,%rsi
+  80582e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805833:	48 b8 12 30 80 00 00 	movabs $0x803012,%rax
+  80583a:	00 00 00 
+  80583d:	ff d0                	call   *%rax
+  80583f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805842:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805846:	79 05                	jns    80584d <getchar+0x33>
+    return r;
+  805848:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80584b:	eb 14                	jmp    805861 <getchar+0x47>
+  if (r < 1)
+  80584d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805851:	7f 07                	jg     80585a <getchar+0x40>
+    return -E_EOF;
+  805853:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805858:	eb 07                	jmp    805861 <getchar+0x47>
+  return c;
+  80585a:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80585e:	0f b6 c0             	movzbl %al,%eax
+}
+  805861:	c9                   	leave
+  805862:	c3                   	ret
+
+0000000000805863 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805863:	55                   	push   %rbp
+  805864:	48 89 e5             	mov    %rsp,%rbp
+  805867:	48 83 ec 20          	sub    $0x20,%rsp
+  80586b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80586e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805872:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805875:	48 89 d6             	mov    %rdx,%rsi
+  805878:	89 c7                	mov    %eax,%edi
+  80587a:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  805881:	00 00 00 
+  805884:	ff d0                	call   *%rax
+  805886:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805889:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80588d:	79 05                	jns    805894 <iscons+0x31>
+    return r;
+  80588f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805892:	eb 1a                	jmp    8058ae <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805894:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805898:	8b 10                	mov    (%rax),%edx
+  80589a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8058a1:	00 00 00 
+  8058a4:	8b 00                	mov    (%rax),%eax
+  8058a6:	39 c2                	cmp    %eax,%edx
+  8058a8:	0f 94 c0             	sete   %al
+  8058ab:	0f b6 c0             	movzbl %al,%eax
+}
+  8058ae:	c9                   	leave
+  8058af:	c3                   	ret
+
+00000000008058b0 <opencons>:
+
+int
+opencons(void) {
+  8058b0:	55                   	push   %rbp
+  8058b1:	48 89 e5             	mov    %rsp,%rbp
+  8058b4:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8058b8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8058bc:	48 89 c7             	mov    %rax,%rdi
+  8058bf:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  8058c6:	00 00 00 
+  8058c9:	ff d0                	call   *%rax
+  8058cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058d2:	79 05                	jns    8058d9 <opencons+0x29>
+    return r;
+  8058d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058d7:	eb 66                	jmp    80593f <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8058d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058dd:	ba 07 04 00 00       	mov    $0x407,%edx
+  8058e2:	48 89 c6             	mov    %rax,%rsi
+  8058e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058ea:	48 b8 9f 22 80 00 00 	movabs $0x80229f,%rax
+  8058f1:	00 00 00 
+  8058f4:	ff d0                	call   *%rax
+  8058f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058fd:	79 05                	jns    805904 <opencons+0x54>
+    return r;
+  8058ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805902:	eb 3b                	jmp    80593f <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805904:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805908:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  80590f:	00 00 00 
+  805912:	8b 12                	mov    (%rdx),%edx
+  805914:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805916:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80591a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805921:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805925:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80592c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805930:	48 89 c7             	mov    %rax,%rdi
+  805933:	48 b8 86 29 80 00 00 	movabs $0x802986,%rax
+  80593a:	00 00 00 
+  80593d:	ff d0                	call   *%rax
+}
+  80593f:	c9                   	leave
+  805940:	c3                   	ret
+
+0000000000805941 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805941:	55                   	push   %rbp
+  805942:	48 89 e5             	mov    %rsp,%rbp
+  805945:	48 83 ec 20          	sub    $0x20,%rsp
+  805949:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80594c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80594f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805953:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805956:	48 89 d6             	mov    %rdx,%rsi
+  805959:	89 c7                	mov    %eax,%edi
+  80595b:	48 b8 b6 2a 80 00 00 	movabs $0x802ab6,%rax
+  805962:	00 00 00 
+  805965:	ff d0                	call   *%rax
+  805967:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80596a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80596e:	79 05                	jns    805975 <consmode+0x34>
+    return r;
+  805970:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805973:	eb 34                	jmp    8059a9 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805979:	8b 10                	mov    (%rax),%edx
+  80597b:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805982:	00 00 00 
+  805985:	8b 00                	mov    (%rax),%eax
+  805987:	39 c2                	cmp    %eax,%edx
+  805989:	74 07                	je     805992 <consmode+0x51>
+    return -E_INVAL;
+  80598b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805990:	eb 17                	jmp    8059a9 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805996:	8b 40 0c             	mov    0xc(%rax),%eax
+  805999:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80599c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059a0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059a3:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8059a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8059a9:	c9                   	leave
+  8059aa:	c3                   	ret
+
+00000000008059ab <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8059ab:	55                   	push   %rbp
+  8059ac:	48 89 e5             	mov    %rsp,%rbp
+  8059af:	48 83 ec 20          	sub    $0x20,%rsp
+  8059b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8059b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8059bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8059bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059c3:	8b 50 0c             	mov    0xc(%rax),%edx
+  8059c6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8059ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059ce:	48 89 ce             	mov    %rcx,%rsi
+  8059d1:	48 89 c7             	mov    %rax,%rdi
+  8059d4:	48 b8 f9 25 80 00 00 	movabs $0x8025f9,%rax
+  8059db:	00 00 00 
+  8059de:	ff d0                	call   *%rax
+  8059e0:	48 98                	cltq
+}
+  8059e2:	c9                   	leave
+  8059e3:	c3                   	ret
+
+00000000008059e4 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8059e4:	55                   	push   %rbp
+  8059e5:	48 89 e5             	mov    %rsp,%rbp
+  8059e8:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8059ef:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8059f6:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8059fd:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805a04:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805a0b:	eb 74                	jmp    805a81 <devcons_write+0x9d>
+    m = n - tot;
+  805a0d:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805a14:	89 c2                	mov    %eax,%edx
+  805a16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a19:	29 c2                	sub    %eax,%edx
+  805a1b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805a1e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a21:	83 f8 7f             	cmp    $0x7f,%eax
+  805a24:	76 07                	jbe    805a2d <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805a26:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805a2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a30:	48 63 d0             	movslq %eax,%rdx
+  805a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a36:	48 63 c8             	movslq %eax,%rcx
+  805a39:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805a40:	48 01 c1             	add    %rax,%rcx
+  805a43:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a4a:	48 89 ce             	mov    %rcx,%rsi
+  805a4d:	48 89 c7             	mov    %rax,%rdi
+  805a50:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  805a57:	00 00 00 
+  805a5a:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805a5c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a5f:	48 63 d0             	movslq %eax,%rdx
+  805a62:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a69:	48 89 d6             	mov    %rdx,%rsi
+  805a6c:	48 89 c7             	mov    %rax,%rdi
+  805a6f:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  805a76:	00 00 00 
+  805a79:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805a7b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a7e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805a81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a84:	48 98                	cltq
+  805a86:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805a8d:	0f 82 7a ff ff ff    	jb     805a0d <devcons_write+0x29>
+  }
+  return tot;
+  805a93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a96:	48 98                	cltq
+}
+  805a98:	c9                   	leave
+  805a99:	c3                   	ret
+
+0000000000805a9a <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805a9a:	55                   	push   %rbp
+  805a9b:	48 89 e5             	mov    %rsp,%rbp
+  805a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  805aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805aab:	c9                   	leave
+  805aac:	c3                   	ret
+
+0000000000805aad <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805aad:	55                   	push   %rbp
+  805aae:	48 89 e5             	mov    %rsp,%rbp
+  805ab1:	48 83 ec 10          	sub    $0x10,%rsp
+  805ab5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ab9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805abd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ac1:	48 ba ed 66 80 00 00 	movabs $0x8066ed,%rdx
+  805ac8:	00 00 00 
+  805acb:	48 89 d6             	mov    %rdx,%rsi
+  805ace:	48 89 c7             	mov    %rax,%rdi
+  805ad1:	48 b8 d1 14 80 00 00 	movabs $0x8014d1,%rax
+  805ad8:	00 00 00 
+  805adb:	ff d0                	call   *%rax
+  return 0;
+  805add:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ae2:	c9                   	leave
+  805ae3:	c3                   	ret
+
+0000000000805ae4 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805ae4:	55                   	push   %rbp
+  805ae5:	48 89 e5             	mov    %rsp,%rbp
+  805ae8:	48 83 ec 30          	sub    $0x30,%rsp
+  805aec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805af0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805af3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805af7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805afe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b01:	83 e0 02             	and    $0x2,%eax
+  805b04:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b0b:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b0e:	83 f8 01             	cmp    $0x1,%eax
+  805b11:	75 04                	jne    805b17 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805b13:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805b17:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b1a:	83 e0 01             	and    $0x1,%eax
+  805b1d:	85 c0                	test   %eax,%eax
+  805b1f:	74 44                	je     805b65 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805b21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b29:	89 c2                	mov    %eax,%edx
+  805b2b:	be 00 00 00 00       	mov    $0x0,%esi
+  805b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b35:	48 b8 e7 26 80 00 00 	movabs $0x8026e7,%rax
+  805b3c:	00 00 00 
+  805b3f:	ff d0                	call   *%rax
+  805b41:	83 f8 01             	cmp    $0x1,%eax
+  805b44:	75 06                	jne    805b4c <devcons_poll+0x68>
+      revents |= POLLIN;
+  805b46:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805b4a:	eb 19                	jmp    805b65 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805b4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b50:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805b56:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805b59:	89 c2                	mov    %eax,%edx
+  805b5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b5f:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805b65:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805b68:	c9                   	leave
+  805b69:	c3                   	ret
+
+0000000000805b6a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805b6a:	55                   	push   %rbp
+  805b6b:	48 89 e5             	mov    %rsp,%rbp
+  805b6e:	48 83 ec 20          	sub    $0x20,%rsp
+  805b72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805b7a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805b7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805b82:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b8a:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805b91:	48 89 c7             	mov    %rax,%rdi
+  805b94:	48 b8 a2 5b 80 00 00 	movabs $0x805ba2,%rax
+  805b9b:	00 00 00 
+  805b9e:	ff d0                	call   *%rax
+}
+  805ba0:	c9                   	leave
+  805ba1:	c3                   	ret
+
+0000000000805ba2 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805ba2:	55                   	push   %rbp
+  805ba3:	48 89 e5             	mov    %rsp,%rbp
+  805ba6:	48 83 ec 30          	sub    $0x30,%rsp
+  805baa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805bae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805bb2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805bb6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805bba:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805bbf:	75 0e                	jne    805bcf <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805bc1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805bc8:	00 00 00 
+  805bcb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805bcf:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805bd4:	75 18                	jne    805bee <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805bd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bda:	48 89 c7             	mov    %rax,%rdi
+  805bdd:	48 b8 df 24 80 00 00 	movabs $0x8024df,%rax
+  805be4:	00 00 00 
+  805be7:	ff d0                	call   *%rax
+  805be9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805bec:	eb 1d                	jmp    805c0b <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805bee:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805bf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bf6:	48 89 d6             	mov    %rdx,%rsi
+  805bf9:	48 89 c7             	mov    %rax,%rdi
+  805bfc:	48 b8 25 25 80 00 00 	movabs $0x802525,%rax
+  805c03:	00 00 00 
+  805c06:	ff d0                	call   *%rax
+  805c08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805c0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c0f:	79 2a                	jns    805c3b <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805c11:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805c16:	74 0a                	je     805c22 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c1c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805c22:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805c27:	74 0a                	je     805c33 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805c29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c2d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805c33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c36:	e9 aa 00 00 00       	jmp    805ce5 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805c3b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805c40:	74 36                	je     805c78 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805c42:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c49:	00 00 00 
+  805c4c:	8b 40 04             	mov    0x4(%rax),%eax
+  805c4f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c54:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c5b:	00 00 00 
+  805c5e:	48 98                	cltq
+  805c60:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c67:	48 01 d0             	add    %rdx,%rax
+  805c6a:	48 05 24 01 00 00    	add    $0x124,%rax
+  805c70:	8b 10                	mov    (%rax),%edx
+  805c72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c76:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805c78:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805c7d:	74 36                	je     805cb5 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805c7f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c86:	00 00 00 
+  805c89:	8b 40 04             	mov    0x4(%rax),%eax
+  805c8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c91:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c98:	00 00 00 
+  805c9b:	48 98                	cltq
+  805c9d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ca4:	48 01 d0             	add    %rdx,%rax
+  805ca7:	48 05 28 01 00 00    	add    $0x128,%rax
+  805cad:	8b 10                	mov    (%rax),%edx
+  805caf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cb3:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805cb5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805cbc:	00 00 00 
+  805cbf:	8b 40 04             	mov    0x4(%rax),%eax
+  805cc2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805cc7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805cce:	00 00 00 
+  805cd1:	48 98                	cltq
+  805cd3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805cda:	48 01 d0             	add    %rdx,%rax
+  805cdd:	48 05 20 01 00 00    	add    $0x120,%rax
+  805ce3:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805ce5:	c9                   	leave
+  805ce6:	c3                   	ret
+
+0000000000805ce7 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805ce7:	55                   	push   %rbp
+  805ce8:	48 89 e5             	mov    %rsp,%rbp
+  805ceb:	48 83 ec 30          	sub    $0x30,%rsp
+  805cef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cf2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805cf5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805cf9:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805cfc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805d01:	75 5e                	jne    805d61 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805d03:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805d0a:	00 00 00 
+  805d0d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805d11:	eb 4e                	jmp    805d61 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805d13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d17:	79 3c                	jns    805d55 <ipc_send+0x6e>
+  805d19:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805d1d:	74 36                	je     805d55 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805d1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d22:	89 c1                	mov    %eax,%ecx
+  805d24:	48 b8 f8 66 80 00 00 	movabs $0x8066f8,%rax
+  805d2b:	00 00 00 
+  805d2e:	48 89 c2             	mov    %rax,%rdx
+  805d31:	be 54 00 00 00       	mov    $0x54,%esi
+  805d36:	48 b8 1e 67 80 00 00 	movabs $0x80671e,%rax
+  805d3d:	00 00 00 
+  805d40:	48 89 c7             	mov    %rax,%rdi
+  805d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d48:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  805d4f:	00 00 00 
+  805d52:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805d55:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  805d5c:	00 00 00 
+  805d5f:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805d61:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805d64:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805d67:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d6e:	89 c7                	mov    %eax,%edi
+  805d70:	48 b8 88 24 80 00 00 	movabs $0x802488,%rax
+  805d77:	00 00 00 
+  805d7a:	ff d0                	call   *%rax
+  805d7c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d7f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d83:	75 8e                	jne    805d13 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805d85:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  805d8c:	00 00 00 
+  805d8f:	ff d0                	call   *%rax
+}
+  805d91:	90                   	nop
+  805d92:	c9                   	leave
+  805d93:	c3                   	ret
+
+0000000000805d94 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805d94:	55                   	push   %rbp
+  805d95:	48 89 e5             	mov    %rsp,%rbp
+  805d98:	48 83 ec 18          	sub    $0x18,%rsp
+  805d9c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805d9f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805da6:	eb 4d                	jmp    805df5 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805da8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805daf:	00 00 00 
+  805db2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805db5:	48 98                	cltq
+  805db7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805dbe:	48 01 d0             	add    %rdx,%rax
+  805dc1:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805dc7:	8b 00                	mov    (%rax),%eax
+  805dc9:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805dcc:	75 23                	jne    805df1 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805dce:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805dd5:	00 00 00 
+  805dd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ddb:	48 98                	cltq
+  805ddd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805de4:	48 01 d0             	add    %rdx,%rax
+  805de7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805ded:	8b 00                	mov    (%rax),%eax
+  805def:	eb 12                	jmp    805e03 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805df1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805df5:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805dfc:	7e aa                	jle    805da8 <ipc_find_env+0x14>
+  return 0;
+  805dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e03:	c9                   	leave
+  805e04:	c3                   	ret
+
+0000000000805e05 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805e05:	55                   	push   %rbp
+  805e06:	48 89 e5             	mov    %rsp,%rbp
+  805e09:	48 83 ec 18          	sub    $0x18,%rsp
+  805e0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e15:	48 c1 e8 27          	shr    $0x27,%rax
+  805e19:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805e1e:	48 89 c2             	mov    %rax,%rdx
+  805e21:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805e28:	01 00 00 
+  805e2b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e2f:	83 e0 01             	and    $0x1,%eax
+  805e32:	48 85 c0             	test   %rax,%rax
+  805e35:	74 63                	je     805e9a <pageref+0x95>
+  805e37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e3b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805e3f:	48 89 c2             	mov    %rax,%rdx
+  805e42:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805e49:	01 00 00 
+  805e4c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e50:	83 e0 01             	and    $0x1,%eax
+  805e53:	48 85 c0             	test   %rax,%rax
+  805e56:	74 42                	je     805e9a <pageref+0x95>
+  805e58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e5c:	48 c1 e8 15          	shr    $0x15,%rax
+  805e60:	48 89 c2             	mov    %rax,%rdx
+  805e63:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805e6a:	01 00 00 
+  805e6d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e71:	83 e0 01             	and    $0x1,%eax
+  805e74:	48 85 c0             	test   %rax,%rax
+  805e77:	74 21                	je     805e9a <pageref+0x95>
+  805e79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e7d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e81:	48 89 c2             	mov    %rax,%rdx
+  805e84:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e8b:	01 00 00 
+  805e8e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e92:	83 e0 01             	and    $0x1,%eax
+  805e95:	48 85 c0             	test   %rax,%rax
+  805e98:	75 07                	jne    805ea1 <pageref+0x9c>
+    return 0;
+  805e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e9f:	eb 53                	jmp    805ef4 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805ea1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ea5:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ea9:	48 89 c2             	mov    %rax,%rdx
+  805eac:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805eb3:	01 00 00 
+  805eb6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805eba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805ebe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ec2:	83 e0 01             	and    $0x1,%eax
+  805ec5:	48 85 c0             	test   %rax,%rax
+  805ec8:	75 07                	jne    805ed1 <pageref+0xcc>
+    return 0;
+  805eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ecf:	eb 23                	jmp    805ef4 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805ed1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ed5:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ed9:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805ee0:	00 00 00 
+  805ee3:	48 c1 e0 04          	shl    $0x4,%rax
+  805ee7:	48 01 d0             	add    %rdx,%rax
+  805eea:	48 83 c0 08          	add    $0x8,%rax
+  805eee:	0f b7 00             	movzwl (%rax),%eax
+  805ef1:	0f b7 c0             	movzwl %ax,%eax
+}
+  805ef4:	c9                   	leave
+  805ef5:	c3                   	ret
+  805ef6:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8050 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 3a 00 00 00       	call   800066 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  binaryname = "idle";
+  800041:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800048:	00 00 00 
+  80004b:	48 ba e0 4f 80 00 00 	movabs $0x804fe0,%rdx
+  800052:	00 00 00 
+  800055:	48 89 10             	mov    %rdx,(%rax)
+  // Instead of busy-waiting like this,
+  // a better way would be to use the processor's HLT instruction
+  // to cause the processor to stop executing until the next interrupt -
+  // doing so allows the processor to conserve power more effectively.
+  while (1) {
+    sys_yield();
+  800058:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	eb f2                	jmp    800058 <umain+0x26>
+
+0000000000800066 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800066:	55                   	push   %rbp
+  800067:	48 89 e5             	mov    %rsp,%rbp
+  80006a:	48 83 ec 20          	sub    $0x20,%rsp
+  80006e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800071:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800075:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80007c:	00 00 00 
+  80007f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800083:	eb 13                	jmp    800098 <libmain+0x32>
+    (*ctor)();
+  800085:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800089:	48 8b 10             	mov    (%rax),%rdx
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	ff d2                	call   *%rdx
+    ctor++;
+  800093:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800098:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80009f:	00 00 00 
+  8000a2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000a6:	72 dd                	jb     800085 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000ac:	7e 14                	jle    8000c2 <libmain+0x5c>
+    binaryname = argv[0];
+  8000ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000b2:	48 8b 00             	mov    (%rax),%rax
+  8000b5:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000bc:	00 00 00 
+  8000bf:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000c9:	48 89 d6             	mov    %rdx,%rsi
+  8000cc:	89 c7                	mov    %eax,%edi
+  8000ce:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000da:	48 b8 e9 00 80 00 00 	movabs $0x8000e9,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+#endif
+}
+  8000e6:	90                   	nop
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+
+00000000008000e9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000ed:	48 b8 94 0e 80 00 00 	movabs $0x800e94,%rax
+  8000f4:	00 00 00 
+  8000f7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fe:	48 b8 75 02 80 00 00 	movabs $0x800275,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+}
+  80010a:	90                   	nop
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	53                   	push   %rbx
+  800112:	48 83 ec 48          	sub    $0x48,%rsp
+  800116:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80011a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80011e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800122:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800126:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80012a:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80012e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800132:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800136:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80013a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80013e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800142:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800146:	4c 89 c3             	mov    %r8,%rbx
+  800149:	cd 30                	int    $0x30
+  80014b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80014f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800154:	74 46                	je     80019c <syscall+0x8f>
+  800156:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80015b:	7e 3f                	jle    80019c <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80015d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800161:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800165:	49 89 d0             	mov    %rdx,%r8
+  800168:	48 89 c1             	mov    %rax,%rcx
+  80016b:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  800172:	00 00 00 
+  800175:	48 89 c2             	mov    %rax,%rdx
+  800178:	be 22 00 00 00       	mov    $0x22,%esi
+  80017d:	48 b8 0f 50 80 00 00 	movabs $0x80500f,%rax
+  800184:	00 00 00 
+  800187:	48 89 c7             	mov    %rax,%rdi
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	49 b9 4d 2f 80 00 00 	movabs $0x802f4d,%r9
+  800196:	00 00 00 
+  800199:	41 ff d1             	call   *%r9
+
+  return ret;
+  80019c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8001a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+00000000008001a6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001a6:	55                   	push   %rbp
+  8001a7:	48 89 e5             	mov    %rsp,%rbp
+  8001aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8001ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8001b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8001b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8001ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001be:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c2:	6a 00                	push   $0x0
+  8001c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001d0:	48 89 d1             	mov    %rdx,%rcx
+  8001d3:	48 89 c2             	mov    %rax,%rdx
+  8001d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e0:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+  8001ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001f0:	90                   	nop
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+00000000008001f3 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001f3:	55                   	push   %rbp
+  8001f4:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8001fb:	6a 00                	push   $0x0
+  8001fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800203:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800209:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80020e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800213:	be 00 00 00 00       	mov    $0x0,%esi
+  800218:	bf 01 00 00 00       	mov    $0x1,%edi
+  80021d:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800224:	00 00 00 
+  800227:	ff d0                	call   *%rax
+  800229:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+
+000000000080022f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80022f:	55                   	push   %rbp
+  800230:	48 89 e5             	mov    %rsp,%rbp
+  800233:	48 83 ec 10          	sub    $0x10,%rsp
+  800237:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80023a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80023d:	48 98                	cltq
+  80023f:	48 83 ec 08          	sub    $0x8,%rsp
+  800243:	6a 00                	push   $0x0
+  800245:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80024b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800256:	48 89 c2             	mov    %rax,%rdx
+  800259:	be 01 00 00 00       	mov    $0x1,%esi
+  80025e:	bf 03 00 00 00       	mov    $0x3,%edi
+  800263:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80026a:	00 00 00 
+  80026d:	ff d0                	call   *%rax
+  80026f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+0000000000800275 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+  800279:	48 83 ec 10          	sub    $0x10,%rsp
+  80027d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800283:	48 98                	cltq
+  800285:	48 83 ec 08          	sub    $0x8,%rsp
+  800289:	6a 00                	push   $0x0
+  80028b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800291:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800297:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80029c:	48 89 c2             	mov    %rax,%rdx
+  80029f:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002a9:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+  8002b5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002b9:	90                   	nop
+  8002ba:	c9                   	leave
+  8002bb:	c3                   	ret
+
+00000000008002bc <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8002bc:	55                   	push   %rbp
+  8002bd:	48 89 e5             	mov    %rsp,%rbp
+  8002c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8002c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ce:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002d1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002d6:	cd 30                	int    $0x30
+  8002d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002dc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002e0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002e5:	7e 3d                	jle    800324 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002eb:	49 89 c0             	mov    %rax,%r8
+  8002ee:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002f3:	48 b8 f0 4f 80 00 00 	movabs $0x804ff0,%rax
+  8002fa:	00 00 00 
+  8002fd:	48 89 c2             	mov    %rax,%rdx
+  800300:	be 49 00 00 00       	mov    $0x49,%esi
+  800305:	48 b8 0f 50 80 00 00 	movabs $0x80500f,%rax
+  80030c:	00 00 00 
+  80030f:	48 89 c7             	mov    %rax,%rdi
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	49 b9 4d 2f 80 00 00 	movabs $0x802f4d,%r9
+  80031e:	00 00 00 
+  800321:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800324:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800329:	75 13                	jne    80033e <sys_env_wait+0x82>
+  80032b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800330:	74 0c                	je     80033e <sys_env_wait+0x82>
+    *status = st;
+  800332:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800336:	89 c2                	mov    %eax,%edx
+  800338:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80033c:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80033e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800342:	c9                   	leave
+  800343:	c3                   	ret
+
+0000000000800344 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800344:	55                   	push   %rbp
+  800345:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800348:	48 83 ec 08          	sub    $0x8,%rsp
+  80034c:	6a 00                	push   $0x0
+  80034e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800354:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80035a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80035f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800364:	be 00 00 00 00       	mov    $0x0,%esi
+  800369:	bf 02 00 00 00       	mov    $0x2,%edi
+  80036e:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+  80037a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80037e:	c9                   	leave
+  80037f:	c3                   	ret
+
+0000000000800380 <sys_yield>:
+
+void
+sys_yield(void) {
+  800380:	55                   	push   %rbp
+  800381:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800384:	48 83 ec 08          	sub    $0x8,%rsp
+  800388:	6a 00                	push   $0x0
+  80038a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800396:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80039b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8003a5:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003aa:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+  8003b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003ba:	90                   	nop
+  8003bb:	c9                   	leave
+  8003bc:	c3                   	ret
+
+00000000008003bd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8003bd:	55                   	push   %rbp
+  8003be:	48 89 e5             	mov    %rsp,%rbp
+  8003c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8003c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003cc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003cf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003d2:	48 63 c8             	movslq %eax,%rcx
+  8003d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003dc:	48 98                	cltq
+  8003de:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e2:	6a 00                	push   $0x0
+  8003e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003ea:	49 89 c8             	mov    %rcx,%r8
+  8003ed:	48 89 d1             	mov    %rdx,%rcx
+  8003f0:	48 89 c2             	mov    %rax,%rdx
+  8003f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8003f8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003fd:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800404:	00 00 00 
+  800407:	ff d0                	call   *%rax
+  800409:	48 83 c4 10          	add    $0x10,%rsp
+  80040d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  800410:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800413:	c9                   	leave
+  800414:	c3                   	ret
+
+0000000000800415 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800415:	55                   	push   %rbp
+  800416:	48 89 e5             	mov    %rsp,%rbp
+  800419:	48 83 ec 20          	sub    $0x20,%rsp
+  80041d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800420:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800424:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800427:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80042f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800432:	48 63 c8             	movslq %eax,%rcx
+  800435:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800439:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80043c:	48 63 f0             	movslq %eax,%rsi
+  80043f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800443:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800446:	48 98                	cltq
+  800448:	48 83 ec 08          	sub    $0x8,%rsp
+  80044c:	51                   	push   %rcx
+  80044d:	49 89 f9             	mov    %rdi,%r9
+  800450:	49 89 f0             	mov    %rsi,%r8
+  800453:	48 89 d1             	mov    %rdx,%rcx
+  800456:	48 89 c2             	mov    %rax,%rdx
+  800459:	be 01 00 00 00       	mov    $0x1,%esi
+  80045e:	bf 07 00 00 00       	mov    $0x7,%edi
+  800463:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80046a:	00 00 00 
+  80046d:	ff d0                	call   *%rax
+  80046f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800473:	c9                   	leave
+  800474:	c3                   	ret
+
+0000000000800475 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	48 83 ec 10          	sub    $0x10,%rsp
+  80047d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800480:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800484:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800488:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80048b:	48 98                	cltq
+  80048d:	48 83 ec 08          	sub    $0x8,%rsp
+  800491:	6a 00                	push   $0x0
+  800493:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800499:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80049f:	48 89 d1             	mov    %rdx,%rcx
+  8004a2:	48 89 c2             	mov    %rax,%rdx
+  8004a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8004aa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8004af:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8004b6:	00 00 00 
+  8004b9:	ff d0                	call   *%rax
+  8004bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+
+00000000008004c1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004c1:	55                   	push   %rbp
+  8004c2:	48 89 e5             	mov    %rsp,%rbp
+  8004c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8004c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004cc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004d2:	48 63 d0             	movslq %eax,%rdx
+  8004d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004d8:	48 98                	cltq
+  8004da:	48 83 ec 08          	sub    $0x8,%rsp
+  8004de:	6a 00                	push   $0x0
+  8004e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004ec:	48 89 d1             	mov    %rdx,%rcx
+  8004ef:	48 89 c2             	mov    %rax,%rdx
+  8004f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8004f7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004fc:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800503:	00 00 00 
+  800506:	ff d0                	call   *%rax
+  800508:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+000000000080050e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80050e:	55                   	push   %rbp
+  80050f:	48 89 e5             	mov    %rsp,%rbp
+  800512:	48 83 ec 10          	sub    $0x10,%rsp
+  800516:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800519:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80051d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800521:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800524:	48 98                	cltq
+  800526:	48 83 ec 08          	sub    $0x8,%rsp
+  80052a:	6a 00                	push   $0x0
+  80052c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800532:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800538:	48 89 d1             	mov    %rdx,%rcx
+  80053b:	48 89 c2             	mov    %rax,%rdx
+  80053e:	be 01 00 00 00       	mov    $0x1,%esi
+  800543:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800548:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80054f:	00 00 00 
+  800552:	ff d0                	call   *%rax
+  800554:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800558:	c9                   	leave
+  800559:	c3                   	ret
+
+000000000080055a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80055a:	55                   	push   %rbp
+  80055b:	48 89 e5             	mov    %rsp,%rbp
+  80055e:	48 83 ec 10          	sub    $0x10,%rsp
+  800562:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800565:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800569:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80056d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800570:	48 98                	cltq
+  800572:	48 83 ec 08          	sub    $0x8,%rsp
+  800576:	6a 00                	push   $0x0
+  800578:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80057e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800584:	48 89 d1             	mov    %rdx,%rcx
+  800587:	48 89 c2             	mov    %rax,%rdx
+  80058a:	be 01 00 00 00       	mov    $0x1,%esi
+  80058f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800594:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80059b:	00 00 00 
+  80059e:	ff d0                	call   *%rax
+  8005a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005a4:	c9                   	leave
+  8005a5:	c3                   	ret
+
+00000000008005a6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8005ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005b9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8005bc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8005bf:	48 63 f0             	movslq %eax,%rsi
+  8005c2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005cd:	48 98                	cltq
+  8005cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d3:	6a 00                	push   $0x0
+  8005d5:	49 89 f1             	mov    %rsi,%r9
+  8005d8:	49 89 c8             	mov    %rcx,%r8
+  8005db:	48 89 d1             	mov    %rdx,%rcx
+  8005de:	48 89 c2             	mov    %rax,%rdx
+  8005e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e6:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005eb:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8005f2:	00 00 00 
+  8005f5:	ff d0                	call   *%rax
+  8005f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005fb:	c9                   	leave
+  8005fc:	c3                   	ret
+
+00000000008005fd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005fd:	55                   	push   %rbp
+  8005fe:	48 89 e5             	mov    %rsp,%rbp
+  800601:	48 83 ec 10          	sub    $0x10,%rsp
+  800605:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  800609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060d:	48 83 ec 08          	sub    $0x8,%rsp
+  800611:	6a 00                	push   $0x0
+  800613:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80061f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800624:	48 89 c2             	mov    %rax,%rdx
+  800627:	be 01 00 00 00       	mov    $0x1,%esi
+  80062c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800631:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800638:	00 00 00 
+  80063b:	ff d0                	call   *%rax
+  80063d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+
+0000000000800643 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800643:	55                   	push   %rbp
+  800644:	48 89 e5             	mov    %rsp,%rbp
+  800647:	48 83 ec 10          	sub    $0x10,%rsp
+  80064b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80064f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800653:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80065b:	48 83 ec 08          	sub    $0x8,%rsp
+  80065f:	6a 00                	push   $0x0
+  800661:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800667:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80066d:	48 89 d1             	mov    %rdx,%rcx
+  800670:	48 89 c2             	mov    %rax,%rdx
+  800673:	be 01 00 00 00       	mov    $0x1,%esi
+  800678:	bf 10 00 00 00       	mov    $0x10,%edi
+  80067d:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800684:	00 00 00 
+  800687:	ff d0                	call   *%rax
+  800689:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80068d:	c9                   	leave
+  80068e:	c3                   	ret
+
+000000000080068f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80068f:	55                   	push   %rbp
+  800690:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800693:	48 83 ec 08          	sub    $0x8,%rsp
+  800697:	6a 00                	push   $0x0
+  800699:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80069f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006af:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b4:	bf 11 00 00 00       	mov    $0x11,%edi
+  8006b9:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8006c0:	00 00 00 
+  8006c3:	ff d0                	call   *%rax
+  8006c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006c9:	c9                   	leave
+  8006ca:	c3                   	ret
+
+00000000008006cb <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006cb:	55                   	push   %rbp
+  8006cc:	48 89 e5             	mov    %rsp,%rbp
+  8006cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8006d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e7:	6a 00                	push   $0x0
+  8006e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006f5:	48 89 d1             	mov    %rdx,%rcx
+  8006f8:	48 89 c2             	mov    %rax,%rdx
+  8006fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800700:	bf 12 00 00 00       	mov    $0x12,%edi
+  800705:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80070c:	00 00 00 
+  80070f:	ff d0                	call   *%rax
+  800711:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800715:	c9                   	leave
+  800716:	c3                   	ret
+
+0000000000800717 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  800717:	55                   	push   %rbp
+  800718:	48 89 e5             	mov    %rsp,%rbp
+  80071b:	48 83 ec 20          	sub    $0x20,%rsp
+  80071f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800723:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800727:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80072a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80072d:	48 63 c8             	movslq %eax,%rcx
+  800730:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800738:	48 83 ec 08          	sub    $0x8,%rsp
+  80073c:	6a 00                	push   $0x0
+  80073e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800744:	49 89 c8             	mov    %rcx,%r8
+  800747:	48 89 d1             	mov    %rdx,%rcx
+  80074a:	48 89 c2             	mov    %rax,%rdx
+  80074d:	be 00 00 00 00       	mov    $0x0,%esi
+  800752:	bf 13 00 00 00       	mov    $0x13,%edi
+  800757:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80075e:	00 00 00 
+  800761:	ff d0                	call   *%rax
+  800763:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800767:	c9                   	leave
+  800768:	c3                   	ret
+
+0000000000800769 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800769:	55                   	push   %rbp
+  80076a:	48 89 e5             	mov    %rsp,%rbp
+  80076d:	48 83 ec 20          	sub    $0x20,%rsp
+  800771:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800775:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800778:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80077c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800780:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800787:	48 83 ec 08          	sub    $0x8,%rsp
+  80078b:	6a 00                	push   $0x0
+  80078d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800793:	49 89 c8             	mov    %rcx,%r8
+  800796:	48 89 d1             	mov    %rdx,%rcx
+  800799:	48 89 c2             	mov    %rax,%rdx
+  80079c:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a1:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007a6:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8007ad:	00 00 00 
+  8007b0:	ff d0                	call   *%rax
+  8007b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+00000000008007b8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8007b8:	55                   	push   %rbp
+  8007b9:	48 89 e5             	mov    %rsp,%rbp
+  8007bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8007c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007c4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007c7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007ca:	48 63 d0             	movslq %eax,%rdx
+  8007cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8007d5:	6a 00                	push   $0x0
+  8007d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007e3:	48 89 d1             	mov    %rdx,%rcx
+  8007e6:	48 89 c2             	mov    %rax,%rdx
+  8007e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ee:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007f3:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+  8007ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800803:	c9                   	leave
+  800804:	c3                   	ret
+
+0000000000800805 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  800805:	55                   	push   %rbp
+  800806:	48 89 e5             	mov    %rsp,%rbp
+  800809:	48 83 ec 20          	sub    $0x20,%rsp
+  80080d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800811:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800814:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  800817:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80081b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80081f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800822:	48 63 c8             	movslq %eax,%rcx
+  800825:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800828:	48 63 d0             	movslq %eax,%rdx
+  80082b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082f:	48 83 ec 08          	sub    $0x8,%rsp
+  800833:	6a 00                	push   $0x0
+  800835:	49 89 f1             	mov    %rsi,%r9
+  800838:	49 89 c8             	mov    %rcx,%r8
+  80083b:	48 89 d1             	mov    %rdx,%rcx
+  80083e:	48 89 c2             	mov    %rax,%rdx
+  800841:	be 00 00 00 00       	mov    $0x0,%esi
+  800846:	bf 16 00 00 00       	mov    $0x16,%edi
+  80084b:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800852:	00 00 00 
+  800855:	ff d0                	call   *%rax
+  800857:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+
+000000000080085d <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80085d:	55                   	push   %rbp
+  80085e:	48 89 e5             	mov    %rsp,%rbp
+  800861:	48 83 ec 30          	sub    $0x30,%rsp
+  800865:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800869:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80086d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800871:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800875:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800879:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80087d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800881:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800885:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800889:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088d:	48 83 ec 08          	sub    $0x8,%rsp
+  800891:	51                   	push   %rcx
+  800892:	49 89 f9             	mov    %rdi,%r9
+  800895:	49 89 f0             	mov    %rsi,%r8
+  800898:	48 89 d1             	mov    %rdx,%rcx
+  80089b:	48 89 c2             	mov    %rax,%rdx
+  80089e:	be 00 00 00 00       	mov    $0x0,%esi
+  8008a3:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008a8:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8008af:	00 00 00 
+  8008b2:	ff d0                	call   *%rax
+  8008b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008b8:	c9                   	leave
+  8008b9:	c3                   	ret
+
+00000000008008ba <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8008ba:	55                   	push   %rbp
+  8008bb:	48 89 e5             	mov    %rsp,%rbp
+  8008be:	48 83 ec 10          	sub    $0x10,%rsp
+  8008c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008c8:	48 98                	cltq
+  8008ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ce:	6a 00                	push   $0x0
+  8008d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e1:	48 89 c2             	mov    %rax,%rdx
+  8008e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8008e9:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008ee:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8008f5:	00 00 00 
+  8008f8:	ff d0                	call   *%rax
+  8008fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008fe:	90                   	nop
+  8008ff:	c9                   	leave
+  800900:	c3                   	ret
+
+0000000000800901 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800901:	55                   	push   %rbp
+  800902:	48 89 e5             	mov    %rsp,%rbp
+  800905:	48 83 ec 30          	sub    $0x30,%rsp
+  800909:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80090c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800910:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800914:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  800917:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80091a:	48 63 f0             	movslq %eax,%rsi
+  80091d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800921:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800925:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800928:	48 98                	cltq
+  80092a:	48 83 ec 08          	sub    $0x8,%rsp
+  80092e:	6a 00                	push   $0x0
+  800930:	49 89 f1             	mov    %rsi,%r9
+  800933:	49 89 c8             	mov    %rcx,%r8
+  800936:	48 89 d1             	mov    %rdx,%rcx
+  800939:	48 89 c2             	mov    %rax,%rdx
+  80093c:	be 01 00 00 00       	mov    $0x1,%esi
+  800941:	bf 19 00 00 00       	mov    $0x19,%edi
+  800946:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80094d:	00 00 00 
+  800950:	ff d0                	call   *%rax
+  800952:	48 83 c4 10          	add    $0x10,%rsp
+  800956:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800959:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+
+000000000080095e <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80095e:	55                   	push   %rbp
+  80095f:	48 89 e5             	mov    %rsp,%rbp
+  800962:	48 83 ec 20          	sub    $0x20,%rsp
+  800966:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80096a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80096e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800971:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800974:	48 63 c8             	movslq %eax,%rcx
+  800977:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80097b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80097f:	48 83 ec 08          	sub    $0x8,%rsp
+  800983:	6a 00                	push   $0x0
+  800985:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80098b:	49 89 c8             	mov    %rcx,%r8
+  80098e:	48 89 d1             	mov    %rdx,%rcx
+  800991:	48 89 c2             	mov    %rax,%rdx
+  800994:	be 01 00 00 00       	mov    $0x1,%esi
+  800999:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80099e:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8009a5:	00 00 00 
+  8009a8:	ff d0                	call   *%rax
+  8009aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009ae:	c9                   	leave
+  8009af:	c3                   	ret
+
+00000000008009b0 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8009b0:	55                   	push   %rbp
+  8009b1:	48 89 e5             	mov    %rsp,%rbp
+  8009b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8009b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009c4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d4:	6a 00                	push   $0x0
+  8009d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009dc:	49 89 c8             	mov    %rcx,%r8
+  8009df:	48 89 d1             	mov    %rdx,%rcx
+  8009e2:	48 89 c2             	mov    %rax,%rdx
+  8009e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8009ea:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009ef:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  8009f6:	00 00 00 
+  8009f9:	ff d0                	call   *%rax
+  8009fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009ff:	c9                   	leave
+  800a00:	c3                   	ret
+
+0000000000800a01 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a01:	55                   	push   %rbp
+  800a02:	48 89 e5             	mov    %rsp,%rbp
+  800a05:	48 83 ec 30          	sub    $0x30,%rsp
+  800a09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a0d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a11:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a14:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a18:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a1c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a1f:	48 63 c8             	movslq %eax,%rcx
+  800a22:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a2a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a2e:	6a 00                	push   $0x0
+  800a30:	49 89 f1             	mov    %rsi,%r9
+  800a33:	49 89 c8             	mov    %rcx,%r8
+  800a36:	48 89 d1             	mov    %rdx,%rcx
+  800a39:	48 89 c2             	mov    %rax,%rdx
+  800a3c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a41:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a46:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800a4d:	00 00 00 
+  800a50:	ff d0                	call   *%rax
+  800a52:	48 83 c4 10          	add    $0x10,%rsp
+  800a56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a5c:	c9                   	leave
+  800a5d:	c3                   	ret
+
+0000000000800a5e <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a5e:	55                   	push   %rbp
+  800a5f:	48 89 e5             	mov    %rsp,%rbp
+  800a62:	48 83 ec 10          	sub    $0x10,%rsp
+  800a66:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a6c:	48 98                	cltq
+  800a6e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a72:	6a 00                	push   $0x0
+  800a74:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a85:	48 89 c2             	mov    %rax,%rdx
+  800a88:	be 01 00 00 00       	mov    $0x1,%esi
+  800a8d:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a92:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  800a99:	00 00 00 
+  800a9c:	ff d0                	call   *%rax
+  800a9e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800aa2:	c9                   	leave
+  800aa3:	c3                   	ret
+
+0000000000800aa4 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800aa4:	55                   	push   %rbp
+  800aa5:	48 89 e5             	mov    %rsp,%rbp
+  800aa8:	48 83 ec 08          	sub    $0x8,%rsp
+  800aac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab4:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800abb:	ff ff ff 
+  800abe:	48 01 d0             	add    %rdx,%rax
+  800ac1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800ac5:	c9                   	leave
+  800ac6:	c3                   	ret
+
+0000000000800ac7 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800ac7:	55                   	push   %rbp
+  800ac8:	48 89 e5             	mov    %rsp,%rbp
+  800acb:	48 83 ec 08          	sub    $0x8,%rsp
+  800acf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ad3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ad7:	48 89 c7             	mov    %rax,%rdi
+  800ada:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  800ae1:	00 00 00 
+  800ae4:	ff d0                	call   *%rax
+  800ae6:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800aec:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800af0:	c9                   	leave
+  800af1:	c3                   	ret
+
+0000000000800af2 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800af2:	55                   	push   %rbp
+  800af3:	48 89 e5             	mov    %rsp,%rbp
+  800af6:	48 83 ec 18          	sub    $0x18,%rsp
+  800afa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800afe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b05:	e9 ae 00 00 00       	jmp    800bb8 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b0d:	c1 e0 0c             	shl    $0xc,%eax
+  800b10:	48 98                	cltq
+  800b12:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b17:	48 01 d0             	add    %rdx,%rax
+  800b1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b22:	48 c1 e8 27          	shr    $0x27,%rax
+  800b26:	48 89 c2             	mov    %rax,%rdx
+  800b29:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b30:	01 00 00 
+  800b33:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b37:	83 e0 01             	and    $0x1,%eax
+  800b3a:	48 85 c0             	test   %rax,%rax
+  800b3d:	74 63                	je     800ba2 <fd_alloc+0xb0>
+  800b3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b43:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b47:	48 89 c2             	mov    %rax,%rdx
+  800b4a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b51:	01 00 00 
+  800b54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b58:	83 e0 01             	and    $0x1,%eax
+  800b5b:	48 85 c0             	test   %rax,%rax
+  800b5e:	74 42                	je     800ba2 <fd_alloc+0xb0>
+  800b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b64:	48 c1 e8 15          	shr    $0x15,%rax
+  800b68:	48 89 c2             	mov    %rax,%rdx
+  800b6b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b72:	01 00 00 
+  800b75:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b79:	83 e0 01             	and    $0x1,%eax
+  800b7c:	48 85 c0             	test   %rax,%rax
+  800b7f:	74 21                	je     800ba2 <fd_alloc+0xb0>
+  800b81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b85:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b89:	48 89 c2             	mov    %rax,%rdx
+  800b8c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b93:	01 00 00 
+  800b96:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b9a:	83 e0 01             	and    $0x1,%eax
+  800b9d:	48 85 c0             	test   %rax,%rax
+  800ba0:	75 12                	jne    800bb4 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800baa:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb2:	eb 1e                	jmp    800bd2 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800bb4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800bb8:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800bbc:	0f 8e 48 ff ff ff    	jle    800b0a <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800bc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bcd:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bd2:	c9                   	leave
+  800bd3:	c3                   	ret
+
+0000000000800bd4 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bd4:	55                   	push   %rbp
+  800bd5:	48 89 e5             	mov    %rsp,%rbp
+  800bd8:	48 83 ec 20          	sub    $0x20,%rsp
+  800bdc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bdf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800be3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800be7:	78 06                	js     800bef <fd_lookup+0x1b>
+  800be9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bed:	7e 0a                	jle    800bf9 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf4:	e9 af 00 00 00       	jmp    800ca8 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bf9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bfc:	c1 e0 0c             	shl    $0xc,%eax
+  800bff:	48 98                	cltq
+  800c01:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c06:	48 01 d0             	add    %rdx,%rax
+  800c09:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c11:	48 c1 e8 27          	shr    $0x27,%rax
+  800c15:	48 89 c2             	mov    %rax,%rdx
+  800c18:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c1f:	01 00 00 
+  800c22:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c26:	83 e0 01             	and    $0x1,%eax
+  800c29:	48 85 c0             	test   %rax,%rax
+  800c2c:	74 63                	je     800c91 <fd_lookup+0xbd>
+  800c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c32:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c36:	48 89 c2             	mov    %rax,%rdx
+  800c39:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c40:	01 00 00 
+  800c43:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c47:	83 e0 01             	and    $0x1,%eax
+  800c4a:	48 85 c0             	test   %rax,%rax
+  800c4d:	74 42                	je     800c91 <fd_lookup+0xbd>
+  800c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c53:	48 c1 e8 15          	shr    $0x15,%rax
+  800c57:	48 89 c2             	mov    %rax,%rdx
+  800c5a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c61:	01 00 00 
+  800c64:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c68:	83 e0 01             	and    $0x1,%eax
+  800c6b:	48 85 c0             	test   %rax,%rax
+  800c6e:	74 21                	je     800c91 <fd_lookup+0xbd>
+  800c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c74:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c78:	48 89 c2             	mov    %rax,%rdx
+  800c7b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c82:	01 00 00 
+  800c85:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c89:	83 e0 01             	and    $0x1,%eax
+  800c8c:	48 85 c0             	test   %rax,%rax
+  800c8f:	75 07                	jne    800c98 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c96:	eb 10                	jmp    800ca8 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c9c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ca0:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca8:	c9                   	leave
+  800ca9:	c3                   	ret
+
+0000000000800caa <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800caa:	55                   	push   %rbp
+  800cab:	48 89 e5             	mov    %rsp,%rbp
+  800cae:	48 83 ec 30          	sub    $0x30,%rsp
+  800cb2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800cb6:	89 f0                	mov    %esi,%eax
+  800cb8:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800cbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cbf:	48 89 c7             	mov    %rax,%rdi
+  800cc2:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  800cc9:	00 00 00 
+  800ccc:	ff d0                	call   *%rax
+  800cce:	89 c2                	mov    %eax,%edx
+  800cd0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cd4:	48 89 c6             	mov    %rax,%rsi
+  800cd7:	89 d7                	mov    %edx,%edi
+  800cd9:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800ce0:	00 00 00 
+  800ce3:	ff d0                	call   *%rax
+  800ce5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ce8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800cec:	78 0a                	js     800cf8 <fd_close+0x4e>
+  800cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cf2:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cf6:	74 12                	je     800d0a <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cf8:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cfc:	74 05                	je     800d03 <fd_close+0x59>
+  800cfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d01:	eb 70                	jmp    800d73 <fd_close+0xc9>
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d08:	eb 69                	jmp    800d73 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d0e:	8b 00                	mov    (%rax),%eax
+  800d10:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d14:	48 89 d6             	mov    %rdx,%rsi
+  800d17:	89 c7                	mov    %eax,%edi
+  800d19:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  800d20:	00 00 00 
+  800d23:	ff d0                	call   *%rax
+  800d25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d2c:	78 2a                	js     800d58 <fd_close+0xae>
+    if (dev->dev_close)
+  800d2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d32:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d36:	48 85 c0             	test   %rax,%rax
+  800d39:	74 16                	je     800d51 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d3f:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d47:	48 89 c7             	mov    %rax,%rdi
+  800d4a:	ff d2                	call   *%rdx
+  800d4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d4f:	eb 07                	jmp    800d58 <fd_close+0xae>
+    else
+      r = 0;
+  800d51:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d5c:	48 89 c6             	mov    %rax,%rsi
+  800d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d64:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  800d6b:	00 00 00 
+  800d6e:	ff d0                	call   *%rax
+  return r;
+  800d70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d73:	c9                   	leave
+  800d74:	c3                   	ret
+
+0000000000800d75 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d75:	55                   	push   %rbp
+  800d76:	48 89 e5             	mov    %rsp,%rbp
+  800d79:	48 83 ec 20          	sub    $0x20,%rsp
+  800d7d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d80:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d84:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d8b:	eb 3f                	jmp    800dcc <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d8d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d94:	00 00 00 
+  800d97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d9a:	48 98                	cltq
+  800d9c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800da0:	8b 00                	mov    (%rax),%eax
+  800da2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800da5:	75 21                	jne    800dc8 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800da7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dae:	00 00 00 
+  800db1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800db4:	48 98                	cltq
+  800db6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800dba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dbe:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc6:	eb 7f                	jmp    800e47 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800dc8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dcc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800dd3:	00 00 00 
+  800dd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dd9:	48 98                	cltq
+  800ddb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ddf:	48 85 c0             	test   %rax,%rax
+  800de2:	75 a9                	jne    800d8d <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800de4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800deb:	00 00 00 
+  800dee:	8b 40 04             	mov    0x4(%rax),%eax
+  800df1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800df6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800dfd:	00 00 00 
+  800e00:	48 98                	cltq
+  800e02:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e09:	48 01 d0             	add    %rdx,%rax
+  800e0c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e12:	8b 00                	mov    (%rax),%eax
+  800e14:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e17:	89 c6                	mov    %eax,%esi
+  800e19:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  800e20:	00 00 00 
+  800e23:	48 89 c7             	mov    %rax,%rdi
+  800e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2b:	48 b9 6c 31 80 00 00 	movabs $0x80316c,%rcx
+  800e32:	00 00 00 
+  800e35:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e3b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e47:	c9                   	leave
+  800e48:	c3                   	ret
+
+0000000000800e49 <close>:
+
+int
+close(int fdnum) {
+  800e49:	55                   	push   %rbp
+  800e4a:	48 89 e5             	mov    %rsp,%rbp
+  800e4d:	48 83 ec 20          	sub    $0x20,%rsp
+  800e51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e54:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e5b:	48 89 d6             	mov    %rdx,%rsi
+  800e5e:	89 c7                	mov    %eax,%edi
+  800e60:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800e67:	00 00 00 
+  800e6a:	ff d0                	call   *%rax
+  800e6c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e6f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e73:	79 05                	jns    800e7a <close+0x31>
+    return r;
+  800e75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e78:	eb 18                	jmp    800e92 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e7e:	be 01 00 00 00       	mov    $0x1,%esi
+  800e83:	48 89 c7             	mov    %rax,%rdi
+  800e86:	48 b8 aa 0c 80 00 00 	movabs $0x800caa,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+}
+  800e92:	c9                   	leave
+  800e93:	c3                   	ret
+
+0000000000800e94 <close_all>:
+
+void
+close_all(void) {
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+  800e98:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e9c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ea3:	eb 15                	jmp    800eba <close_all+0x26>
+    close(i);
+  800ea5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ea8:	89 c7                	mov    %eax,%edi
+  800eaa:	48 b8 49 0e 80 00 00 	movabs $0x800e49,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800eb6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800eba:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800ebe:	7e e5                	jle    800ea5 <close_all+0x11>
+}
+  800ec0:	90                   	nop
+  800ec1:	90                   	nop
+  800ec2:	c9                   	leave
+  800ec3:	c3                   	ret
+
+0000000000800ec4 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ec4:	55                   	push   %rbp
+  800ec5:	48 89 e5             	mov    %rsp,%rbp
+  800ec8:	48 83 ec 40          	sub    $0x40,%rsp
+  800ecc:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800ecf:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800ed2:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800ed6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ed9:	48 89 d6             	mov    %rdx,%rsi
+  800edc:	89 c7                	mov    %eax,%edi
+  800ede:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800ee5:	00 00 00 
+  800ee8:	ff d0                	call   *%rax
+  800eea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800eed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ef1:	79 08                	jns    800efb <dup+0x37>
+    return r;
+  800ef3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ef6:	e9 33 02 00 00       	jmp    80112e <dup+0x26a>
+  close(newfdnum);
+  800efb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efe:	89 c7                	mov    %eax,%edi
+  800f00:	48 b8 49 0e 80 00 00 	movabs $0x800e49,%rax
+  800f07:	00 00 00 
+  800f0a:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f0c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f0f:	c1 e0 0c             	shl    $0xc,%eax
+  800f12:	48 98                	cltq
+  800f14:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f19:	48 01 d0             	add    %rdx,%rax
+  800f1c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f24:	48 89 c7             	mov    %rax,%rdi
+  800f27:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  800f2e:	00 00 00 
+  800f31:	ff d0                	call   *%rax
+  800f33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f3b:	48 89 c7             	mov    %rax,%rdi
+  800f3e:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  800f45:	00 00 00 
+  800f48:	ff d0                	call   *%rax
+  800f4a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f4e:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f55:	00 
+  800f56:	e9 19 01 00 00       	jmp    801074 <dup+0x1b0>
+    off -= PGSIZE;
+  800f5b:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f62:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f63:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f6b:	48 01 d0             	add    %rdx,%rax
+  800f6e:	48 c1 e8 27          	shr    $0x27,%rax
+  800f72:	48 89 c2             	mov    %rax,%rdx
+  800f75:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f7c:	01 00 00 
+  800f7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f83:	83 e0 01             	and    $0x1,%eax
+  800f86:	48 85 c0             	test   %rax,%rax
+  800f89:	0f 84 e5 00 00 00    	je     801074 <dup+0x1b0>
+  800f8f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f97:	48 01 d0             	add    %rdx,%rax
+  800f9a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f9e:	48 89 c2             	mov    %rax,%rdx
+  800fa1:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800fa8:	01 00 00 
+  800fab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800faf:	83 e0 01             	and    $0x1,%eax
+  800fb2:	48 85 c0             	test   %rax,%rax
+  800fb5:	0f 84 b9 00 00 00    	je     801074 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fbb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc3:	48 01 d0             	add    %rdx,%rax
+  800fc6:	48 c1 e8 15          	shr    $0x15,%rax
+  800fca:	48 89 c2             	mov    %rax,%rdx
+  800fcd:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fd4:	01 00 00 
+  800fd7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fdb:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fde:	48 85 c0             	test   %rax,%rax
+  800fe1:	0f 84 8d 00 00 00    	je     801074 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fe7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800feb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fef:	48 01 d0             	add    %rdx,%rax
+  800ff2:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ff6:	48 89 c2             	mov    %rax,%rdx
+  800ff9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801000:	01 00 00 
+  801003:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801007:	83 e0 01             	and    $0x1,%eax
+  80100a:	48 85 c0             	test   %rax,%rax
+  80100d:	74 65                	je     801074 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80100f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801017:	48 01 d0             	add    %rdx,%rax
+  80101a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80101e:	48 89 c2             	mov    %rax,%rdx
+  801021:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801028:	01 00 00 
+  80102b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801034:	89 c6                	mov    %eax,%esi
+  801036:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80103a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103e:	48 01 c2             	add    %rax,%rdx
+  801041:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801045:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801049:	48 01 c8             	add    %rcx,%rax
+  80104c:	41 89 f0             	mov    %esi,%r8d
+  80104f:	48 89 d1             	mov    %rdx,%rcx
+  801052:	ba 00 00 00 00       	mov    $0x0,%edx
+  801057:	48 89 c6             	mov    %rax,%rsi
+  80105a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105f:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  801066:	00 00 00 
+  801069:	ff d0                	call   *%rax
+  80106b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80106e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801072:	78 60                	js     8010d4 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801074:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801079:	0f 85 dc fe ff ff    	jne    800f5b <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80107f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801083:	48 c1 e8 0c          	shr    $0xc,%rax
+  801087:	48 89 c2             	mov    %rax,%rdx
+  80108a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801091:	01 00 00 
+  801094:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801098:	25 07 0e 00 00       	and    $0xe07,%eax
+  80109d:	89 c1                	mov    %eax,%ecx
+  80109f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010a7:	41 89 c8             	mov    %ecx,%r8d
+  8010aa:	48 89 d1             	mov    %rdx,%rcx
+  8010ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b2:	48 89 c6             	mov    %rax,%rsi
+  8010b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ba:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010cd:	78 08                	js     8010d7 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010cf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010d2:	eb 5a                	jmp    80112e <dup+0x26a>
+        goto err;
+  8010d4:	90                   	nop
+  8010d5:	eb 01                	jmp    8010d8 <dup+0x214>
+    goto err;
+  8010d7:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010dc:	48 89 c6             	mov    %rax,%rsi
+  8010df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e4:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  8010eb:	00 00 00 
+  8010ee:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010f0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010f7:	00 
+  8010f8:	eb 27                	jmp    801121 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801102:	48 01 d0             	add    %rdx,%rax
+  801105:	48 89 c6             	mov    %rax,%rsi
+  801108:	bf 00 00 00 00       	mov    $0x0,%edi
+  80110d:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  801114:	00 00 00 
+  801117:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801119:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801120:	00 
+  801121:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801128:	00 
+  801129:	76 cf                	jbe    8010fa <dup+0x236>
+  return r;
+  80112b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	48 83 ec 40          	sub    $0x40,%rsp
+  801138:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80113b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80113f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801143:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801147:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80114a:	48 89 d6             	mov    %rdx,%rsi
+  80114d:	89 c7                	mov    %eax,%edi
+  80114f:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  801156:	00 00 00 
+  801159:	ff d0                	call   *%rax
+  80115b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80115e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801162:	78 24                	js     801188 <read+0x58>
+  801164:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801168:	8b 00                	mov    (%rax),%eax
+  80116a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80116e:	48 89 d6             	mov    %rdx,%rsi
+  801171:	89 c7                	mov    %eax,%edi
+  801173:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  80117a:	00 00 00 
+  80117d:	ff d0                	call   *%rax
+  80117f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801182:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801186:	79 0a                	jns    801192 <read+0x62>
+    return r;
+  801188:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80118b:	48 98                	cltq
+  80118d:	e9 9e 00 00 00       	jmp    801230 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801196:	8b 40 08             	mov    0x8(%rax),%eax
+  801199:	83 e0 03             	and    $0x3,%eax
+  80119c:	83 f8 01             	cmp    $0x1,%eax
+  80119f:	75 5c                	jne    8011fd <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011a1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011a8:	00 00 00 
+  8011ab:	8b 40 04             	mov    0x4(%rax),%eax
+  8011ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011b3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8011ba:	00 00 00 
+  8011bd:	48 98                	cltq
+  8011bf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011c6:	48 01 d0             	add    %rdx,%rax
+  8011c9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011cf:	8b 00                	mov    (%rax),%eax
+  8011d1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011d4:	89 c6                	mov    %eax,%esi
+  8011d6:	48 b8 3f 50 80 00 00 	movabs $0x80503f,%rax
+  8011dd:	00 00 00 
+  8011e0:	48 89 c7             	mov    %rax,%rdi
+  8011e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e8:	48 b9 6c 31 80 00 00 	movabs $0x80316c,%rcx
+  8011ef:	00 00 00 
+  8011f2:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011f4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011fb:	eb 33                	jmp    801230 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801201:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801205:	48 85 c0             	test   %rax,%rax
+  801208:	75 09                	jne    801213 <read+0xe3>
+    return -E_NOT_SUPP;
+  80120a:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801211:	eb 1d                	jmp    801230 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801213:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801217:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80121b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80121f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801223:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801227:	48 89 ce             	mov    %rcx,%rsi
+  80122a:	48 89 c7             	mov    %rax,%rdi
+  80122d:	41 ff d0             	call   *%r8
+}
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	48 83 ec 30          	sub    $0x30,%rsp
+  80123a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80123d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801241:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801245:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80124c:	eb 49                	jmp    801297 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80124e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801251:	48 98                	cltq
+  801253:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801257:	48 29 c2             	sub    %rax,%rdx
+  80125a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80125d:	48 63 c8             	movslq %eax,%rcx
+  801260:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801264:	48 01 c1             	add    %rax,%rcx
+  801267:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80126a:	48 89 ce             	mov    %rcx,%rsi
+  80126d:	89 c7                	mov    %eax,%edi
+  80126f:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  801276:	00 00 00 
+  801279:	ff d0                	call   *%rax
+  80127b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80127e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801282:	79 07                	jns    80128b <readn+0x59>
+      return m;
+  801284:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801287:	48 98                	cltq
+  801289:	eb 1f                	jmp    8012aa <readn+0x78>
+    if (m == 0)
+  80128b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80128f:	74 13                	je     8012a4 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801291:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801294:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801297:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80129a:	48 98                	cltq
+  80129c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012a0:	72 ac                	jb     80124e <readn+0x1c>
+  8012a2:	eb 01                	jmp    8012a5 <readn+0x73>
+      break;
+  8012a4:	90                   	nop
+  }
+  return tot;
+  8012a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012a8:	48 98                	cltq
+}
+  8012aa:	c9                   	leave
+  8012ab:	c3                   	ret
+
+00000000008012ac <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8012ac:	55                   	push   %rbp
+  8012ad:	48 89 e5             	mov    %rsp,%rbp
+  8012b0:	48 83 ec 40          	sub    $0x40,%rsp
+  8012b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8012b7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8012bb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8012bf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012c6:	48 89 d6             	mov    %rdx,%rsi
+  8012c9:	89 c7                	mov    %eax,%edi
+  8012cb:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8012d2:	00 00 00 
+  8012d5:	ff d0                	call   *%rax
+  8012d7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012da:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012de:	78 24                	js     801304 <write+0x58>
+  8012e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012e4:	8b 00                	mov    (%rax),%eax
+  8012e6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012ea:	48 89 d6             	mov    %rdx,%rsi
+  8012ed:	89 c7                	mov    %eax,%edi
+  8012ef:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+  8012fb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012fe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801302:	79 0a                	jns    80130e <write+0x62>
+    return r;
+  801304:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801307:	48 98                	cltq
+  801309:	e9 9d 00 00 00       	jmp    8013ab <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80130e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801312:	8b 40 08             	mov    0x8(%rax),%eax
+  801315:	83 e0 03             	and    $0x3,%eax
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	75 5c                	jne    801378 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80131c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801323:	00 00 00 
+  801326:	8b 40 04             	mov    0x4(%rax),%eax
+  801329:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80132e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801335:	00 00 00 
+  801338:	48 98                	cltq
+  80133a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801341:	48 01 d0             	add    %rdx,%rax
+  801344:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80134a:	8b 00                	mov    (%rax),%eax
+  80134c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80134f:	89 c6                	mov    %eax,%esi
+  801351:	48 b8 5b 50 80 00 00 	movabs $0x80505b,%rax
+  801358:	00 00 00 
+  80135b:	48 89 c7             	mov    %rax,%rdi
+  80135e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801363:	48 b9 6c 31 80 00 00 	movabs $0x80316c,%rcx
+  80136a:	00 00 00 
+  80136d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80136f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801376:	eb 33                	jmp    8013ab <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801378:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801380:	48 85 c0             	test   %rax,%rax
+  801383:	75 09                	jne    80138e <write+0xe2>
+    return -E_NOT_SUPP;
+  801385:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80138c:	eb 1d                	jmp    8013ab <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80138e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801392:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801396:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80139a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80139e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8013a2:	48 89 ce             	mov    %rcx,%rsi
+  8013a5:	48 89 c7             	mov    %rax,%rdi
+  8013a8:	41 ff d0             	call   *%r8
+}
+  8013ab:	c9                   	leave
+  8013ac:	c3                   	ret
+
+00000000008013ad <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8013ad:	55                   	push   %rbp
+  8013ae:	48 89 e5             	mov    %rsp,%rbp
+  8013b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8013b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8013b8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013bb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8013bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013c2:	48 89 d6             	mov    %rdx,%rsi
+  8013c5:	89 c7                	mov    %eax,%edi
+  8013c7:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8013ce:	00 00 00 
+  8013d1:	ff d0                	call   *%rax
+  8013d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013da:	79 05                	jns    8013e1 <seek+0x34>
+    return r;
+  8013dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013df:	eb 0f                	jmp    8013f0 <seek+0x43>
+  fd->fd_offset = offset;
+  8013e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013e8:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+
+00000000008013f2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	48 83 ec 30          	sub    $0x30,%rsp
+  8013fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013fd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801400:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801404:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801407:	48 89 d6             	mov    %rdx,%rsi
+  80140a:	89 c7                	mov    %eax,%edi
+  80140c:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  801413:	00 00 00 
+  801416:	ff d0                	call   *%rax
+  801418:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80141b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80141f:	78 24                	js     801445 <ftruncate+0x53>
+  801421:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801425:	8b 00                	mov    (%rax),%eax
+  801427:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80142b:	48 89 d6             	mov    %rdx,%rsi
+  80142e:	89 c7                	mov    %eax,%edi
+  801430:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  801437:	00 00 00 
+  80143a:	ff d0                	call   *%rax
+  80143c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80143f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801443:	79 08                	jns    80144d <ftruncate+0x5b>
+    return r;
+  801445:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801448:	e9 92 00 00 00       	jmp    8014df <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80144d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801451:	8b 40 08             	mov    0x8(%rax),%eax
+  801454:	83 e0 03             	and    $0x3,%eax
+  801457:	85 c0                	test   %eax,%eax
+  801459:	75 5a                	jne    8014b5 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80145b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801462:	00 00 00 
+  801465:	8b 40 04             	mov    0x4(%rax),%eax
+  801468:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80146d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801474:	00 00 00 
+  801477:	48 98                	cltq
+  801479:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801480:	48 01 d0             	add    %rdx,%rax
+  801483:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801489:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80148b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80148e:	89 c6                	mov    %eax,%esi
+  801490:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  801497:	00 00 00 
+  80149a:	48 89 c7             	mov    %rax,%rdi
+  80149d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a2:	48 b9 6c 31 80 00 00 	movabs $0x80316c,%rcx
+  8014a9:	00 00 00 
+  8014ac:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8014ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b3:	eb 2a                	jmp    8014df <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8014b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8014bd:	48 85 c0             	test   %rax,%rax
+  8014c0:	75 07                	jne    8014c9 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014c2:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014c7:	eb 16                	jmp    8014df <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014cd:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014d8:	89 d6                	mov    %edx,%esi
+  8014da:	48 89 c7             	mov    %rax,%rdi
+  8014dd:	ff d1                	call   *%rcx
+}
+  8014df:	c9                   	leave
+  8014e0:	c3                   	ret
+
+00000000008014e1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014e1:	55                   	push   %rbp
+  8014e2:	48 89 e5             	mov    %rsp,%rbp
+  8014e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8014e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014ec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014f0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014f7:	48 89 d6             	mov    %rdx,%rsi
+  8014fa:	89 c7                	mov    %eax,%edi
+  8014fc:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  801503:	00 00 00 
+  801506:	ff d0                	call   *%rax
+  801508:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80150b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80150f:	78 24                	js     801535 <fstat+0x54>
+  801511:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801515:	8b 00                	mov    (%rax),%eax
+  801517:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80151b:	48 89 d6             	mov    %rdx,%rsi
+  80151e:	89 c7                	mov    %eax,%edi
+  801520:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  801527:	00 00 00 
+  80152a:	ff d0                	call   *%rax
+  80152c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80152f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801533:	79 05                	jns    80153a <fstat+0x59>
+    return r;
+  801535:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801538:	eb 5e                	jmp    801598 <fstat+0xb7>
+  if (!dev->dev_stat)
+  80153a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	75 07                	jne    80154e <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801547:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80154c:	eb 4a                	jmp    801598 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80154e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801552:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801555:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801559:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801560:	00 00 00 
+  stat->st_isdir   = 0;
+  801563:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801567:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80156e:	00 00 00 
+  stat->st_dev     = dev;
+  801571:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801575:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801579:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  801580:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801584:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801590:	48 89 d6             	mov    %rdx,%rsi
+  801593:	48 89 c7             	mov    %rax,%rdi
+  801596:	ff d1                	call   *%rcx
+}
+  801598:	c9                   	leave
+  801599:	c3                   	ret
+
+000000000080159a <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	48 83 ec 10          	sub    $0x10,%rsp
+  8015a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ae:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015b4:	83 f8 20             	cmp    $0x20,%eax
+  8015b7:	75 07                	jne    8015c0 <pollwait_key+0x26>
+    return -E_INVAL;
+  8015b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015be:	eb 5f                	jmp    80161f <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c4:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ce:	48 63 d2             	movslq %edx,%rdx
+  8015d1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015d5:	48 01 c2             	add    %rax,%rdx
+  8015d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015dc:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e3:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ed:	8b 00                	mov    (%rax),%eax
+  8015ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015f3:	48 63 c9             	movslq %ecx,%rcx
+  8015f6:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015fa:	48 01 ca             	add    %rcx,%rdx
+  8015fd:	48 83 c2 08          	add    $0x8,%rdx
+  801601:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801607:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80160d:	8d 50 01             	lea    0x1(%rax),%edx
+  801610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801614:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80161a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80162c:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801633:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801639:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801640:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801647:	00 
+  int i, r, ready, ipc = 0;
+  801648:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80164f:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801656:	00 
+  801657:	74 45                	je     80169e <poll+0x7d>
+  801659:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801660:	ff 
+  801661:	74 3b                	je     80169e <poll+0x7d>
+    now      = vsys_clock_ns();
+  801663:	48 b8 5c 2b 80 00 00 	movabs $0x802b5c,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+  80166f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801673:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801677:	48 f7 d0             	not    %rax
+  80167a:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801681:	73 10                	jae    801693 <poll+0x72>
+  801683:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801687:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80168e:	48 01 d0             	add    %rdx,%rax
+  801691:	eb 07                	jmp    80169a <poll+0x79>
+  801693:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80169a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80169e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016a5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8016ac:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8016b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8016ba:	e9 46 02 00 00       	jmp    801905 <poll+0x2e4>
+      fds[i].revents = 0;
+  8016bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016c2:	48 63 d0             	movslq %eax,%rdx
+  8016c5:	48 89 d0             	mov    %rdx,%rax
+  8016c8:	48 01 c0             	add    %rax,%rax
+  8016cb:	48 01 d0             	add    %rdx,%rax
+  8016ce:	48 c1 e0 02          	shl    $0x2,%rax
+  8016d2:	48 89 c2             	mov    %rax,%rdx
+  8016d5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016dc:	48 01 d0             	add    %rdx,%rax
+  8016df:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016e6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e9:	48 63 d0             	movslq %eax,%rdx
+  8016ec:	48 89 d0             	mov    %rdx,%rax
+  8016ef:	48 01 c0             	add    %rax,%rax
+  8016f2:	48 01 d0             	add    %rdx,%rax
+  8016f5:	48 c1 e0 02          	shl    $0x2,%rax
+  8016f9:	48 89 c2             	mov    %rax,%rdx
+  8016fc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801703:	48 01 d0             	add    %rdx,%rax
+  801706:	8b 00                	mov    (%rax),%eax
+  801708:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80170b:	75 62                	jne    80176f <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80170d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801710:	48 63 d0             	movslq %eax,%rdx
+  801713:	48 89 d0             	mov    %rdx,%rax
+  801716:	48 01 c0             	add    %rax,%rax
+  801719:	48 01 d0             	add    %rdx,%rax
+  80171c:	48 c1 e0 02          	shl    $0x2,%rax
+  801720:	48 89 c2             	mov    %rax,%rdx
+  801723:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80172a:	48 01 d0             	add    %rdx,%rax
+  80172d:	8b 40 04             	mov    0x4(%rax),%eax
+  801730:	83 e0 01             	and    $0x1,%eax
+  801733:	85 c0                	test   %eax,%eax
+  801735:	0f 84 9b 01 00 00    	je     8018d6 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80173b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173e:	48 63 d0             	movslq %eax,%rdx
+  801741:	48 89 d0             	mov    %rdx,%rax
+  801744:	48 01 c0             	add    %rax,%rax
+  801747:	48 01 d0             	add    %rdx,%rax
+  80174a:	48 c1 e0 02          	shl    $0x2,%rax
+  80174e:	48 89 c2             	mov    %rax,%rdx
+  801751:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801758:	48 01 c2             	add    %rax,%rdx
+  80175b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80175e:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801761:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801764:	83 c8 04             	or     $0x4,%eax
+  801767:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80176a:	e9 67 01 00 00       	jmp    8018d6 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80176f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801772:	48 63 d0             	movslq %eax,%rdx
+  801775:	48 89 d0             	mov    %rdx,%rax
+  801778:	48 01 c0             	add    %rax,%rax
+  80177b:	48 01 d0             	add    %rdx,%rax
+  80177e:	48 c1 e0 02          	shl    $0x2,%rax
+  801782:	48 89 c2             	mov    %rax,%rdx
+  801785:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80178c:	48 01 d0             	add    %rdx,%rax
+  80178f:	8b 00                	mov    (%rax),%eax
+  801791:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801798:	48 89 d6             	mov    %rdx,%rsi
+  80179b:	89 c7                	mov    %eax,%edi
+  80179d:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8017a4:	00 00 00 
+  8017a7:	ff d0                	call   *%rax
+  8017a9:	85 c0                	test   %eax,%eax
+  8017ab:	78 25                	js     8017d2 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8017ad:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8017b4:	8b 00                	mov    (%rax),%eax
+  8017b6:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8017bd:	48 89 d6             	mov    %rdx,%rsi
+  8017c0:	89 c7                	mov    %eax,%edi
+  8017c2:	48 b8 75 0d 80 00 00 	movabs $0x800d75,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017ce:	85 c0                	test   %eax,%eax
+  8017d0:	79 2c                	jns    8017fe <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017d5:	48 63 d0             	movslq %eax,%rdx
+  8017d8:	48 89 d0             	mov    %rdx,%rax
+  8017db:	48 01 c0             	add    %rax,%rax
+  8017de:	48 01 d0             	add    %rdx,%rax
+  8017e1:	48 c1 e0 02          	shl    $0x2,%rax
+  8017e5:	48 89 c2             	mov    %rax,%rdx
+  8017e8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017ef:	48 01 d0             	add    %rdx,%rax
+  8017f2:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017f9:	e9 d8 00 00 00       	jmp    8018d6 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017fe:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801805:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801809:	48 85 c0             	test   %rax,%rax
+  80180c:	74 7d                	je     80188b <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80180e:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801815:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  801819:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80181c:	48 63 d0             	movslq %eax,%rdx
+  80181f:	48 89 d0             	mov    %rdx,%rax
+  801822:	48 01 c0             	add    %rax,%rax
+  801825:	48 01 d0             	add    %rdx,%rax
+  801828:	48 c1 e0 02          	shl    $0x2,%rax
+  80182c:	48 89 c2             	mov    %rax,%rdx
+  80182f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801836:	48 01 d0             	add    %rdx,%rax
+  801839:	8b 48 04             	mov    0x4(%rax),%ecx
+  80183c:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801843:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80184a:	89 ce                	mov    %ecx,%esi
+  80184c:	48 89 c7             	mov    %rax,%rdi
+  80184f:	41 ff d0             	call   *%r8
+  801852:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801855:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801859:	79 08                	jns    801863 <poll+0x242>
+          return r;
+  80185b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80185e:	e9 45 01 00 00       	jmp    8019a8 <poll+0x387>
+        fds[i].revents = r;
+  801863:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801866:	48 63 d0             	movslq %eax,%rdx
+  801869:	48 89 d0             	mov    %rdx,%rax
+  80186c:	48 01 c0             	add    %rax,%rax
+  80186f:	48 01 d0             	add    %rdx,%rax
+  801872:	48 c1 e0 02          	shl    $0x2,%rax
+  801876:	48 89 c2             	mov    %rax,%rdx
+  801879:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801880:	48 01 c2             	add    %rax,%rdx
+  801883:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801886:	89 42 08             	mov    %eax,0x8(%rdx)
+  801889:	eb 4b                	jmp    8018d6 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80188b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80188e:	48 63 d0             	movslq %eax,%rdx
+  801891:	48 89 d0             	mov    %rdx,%rax
+  801894:	48 01 c0             	add    %rax,%rax
+  801897:	48 01 d0             	add    %rdx,%rax
+  80189a:	48 c1 e0 02          	shl    $0x2,%rax
+  80189e:	48 89 c2             	mov    %rax,%rdx
+  8018a1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018a8:	48 01 d0             	add    %rdx,%rax
+  8018ab:	8b 48 04             	mov    0x4(%rax),%ecx
+  8018ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b1:	48 63 d0             	movslq %eax,%rdx
+  8018b4:	48 89 d0             	mov    %rdx,%rax
+  8018b7:	48 01 c0             	add    %rax,%rax
+  8018ba:	48 01 d0             	add    %rdx,%rax
+  8018bd:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c1:	48 89 c2             	mov    %rax,%rdx
+  8018c4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018cb:	48 01 d0             	add    %rdx,%rax
+  8018ce:	83 e1 03             	and    $0x3,%ecx
+  8018d1:	89 ca                	mov    %ecx,%edx
+  8018d3:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018d6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d9:	48 63 d0             	movslq %eax,%rdx
+  8018dc:	48 89 d0             	mov    %rdx,%rax
+  8018df:	48 01 c0             	add    %rax,%rax
+  8018e2:	48 01 d0             	add    %rdx,%rax
+  8018e5:	48 c1 e0 02          	shl    $0x2,%rax
+  8018e9:	48 89 c2             	mov    %rax,%rdx
+  8018ec:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018f3:	48 01 d0             	add    %rdx,%rax
+  8018f6:	8b 40 08             	mov    0x8(%rax),%eax
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	74 04                	je     801901 <poll+0x2e0>
+        ready++;
+  8018fd:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801901:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801905:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801908:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80190e:	0f 8c ab fd ff ff    	jl     8016bf <poll+0x9e>
+    }
+    if (ready)
+  801914:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  801918:	74 08                	je     801922 <poll+0x301>
+      return ready;
+  80191a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80191d:	e9 86 00 00 00       	jmp    8019a8 <poll+0x387>
+
+    if (deadline) {
+  801922:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801927:	74 30                	je     801959 <poll+0x338>
+      now     = vsys_clock_ns();
+  801929:	48 b8 5c 2b 80 00 00 	movabs $0x802b5c,%rax
+  801930:	00 00 00 
+  801933:	ff d0                	call   *%rax
+  801935:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801939:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80193d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801941:	73 0a                	jae    80194d <poll+0x32c>
+  801943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801947:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80194b:	eb 05                	jmp    801952 <poll+0x331>
+  80194d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801952:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801959:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80195c:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80195f:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801966:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80196d:	48 89 c7             	mov    %rax,%rdi
+  801970:	48 b8 05 08 80 00 00 	movabs $0x800805,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+  80197c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80197f:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801983:	75 07                	jne    80198c <poll+0x36b>
+      return 0;
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198a:	eb 1c                	jmp    8019a8 <poll+0x387>
+    if (r < 0)
+  80198c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801990:	79 05                	jns    801997 <poll+0x376>
+      return r;
+  801992:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801995:	eb 11                	jmp    8019a8 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801997:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80199a:	c1 f8 02             	sar    $0x2,%eax
+  80199d:	83 e0 01             	and    $0x1,%eax
+  8019a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8019a3:	e9 f6 fc ff ff       	jmp    80169e <poll+0x7d>
+  }
+}
+  8019a8:	c9                   	leave
+  8019a9:	c3                   	ret
+
+00000000008019aa <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019aa:	55                   	push   %rbp
+  8019ab:	48 89 e5             	mov    %rsp,%rbp
+  8019ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8019b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8019ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019be:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c3:	48 89 c7             	mov    %rax,%rdi
+  8019c6:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  8019cd:	00 00 00 
+  8019d0:	ff d0                	call   *%rax
+  8019d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019d9:	79 05                	jns    8019e0 <stat+0x36>
+    return fd;
+  8019db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019de:	eb 2f                	jmp    801a0f <stat+0x65>
+  r = fstat(fd, stat);
+  8019e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019e7:	48 89 d6             	mov    %rdx,%rsi
+  8019ea:	89 c7                	mov    %eax,%edi
+  8019ec:	48 b8 e1 14 80 00 00 	movabs $0x8014e1,%rax
+  8019f3:	00 00 00 
+  8019f6:	ff d0                	call   *%rax
+  8019f8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019fe:	89 c7                	mov    %eax,%edi
+  801a00:	48 b8 49 0e 80 00 00 	movabs $0x800e49,%rax
+  801a07:	00 00 00 
+  801a0a:	ff d0                	call   *%rax
+  return r;
+  801a0c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+0000000000801a11 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	48 83 ec 10          	sub    $0x10,%rsp
+  801a19:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a20:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a27:	00 00 00 
+  801a2a:	8b 00                	mov    (%rax),%eax
+  801a2c:	85 c0                	test   %eax,%eax
+  801a2e:	75 1d                	jne    801a4d <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a30:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a35:	48 b8 64 4e 80 00 00 	movabs $0x804e64,%rax
+  801a3c:	00 00 00 
+  801a3f:	ff d0                	call   *%rax
+  801a41:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a48:	00 00 00 
+  801a4b:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a4d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a54:	00 00 00 
+  801a57:	8b 00                	mov    (%rax),%eax
+  801a59:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a5c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a61:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a68:	00 00 00 
+  801a6b:	89 c7                	mov    %eax,%edi
+  801a6d:	48 b8 b7 4d 80 00 00 	movabs $0x804db7,%rax
+  801a74:	00 00 00 
+  801a77:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a82:	48 89 c6             	mov    %rax,%rsi
+  801a85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a8a:	48 b8 3a 4c 80 00 00 	movabs $0x804c3a,%rax
+  801a91:	00 00 00 
+  801a94:	ff d0                	call   *%rax
+}
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+
+0000000000801a98 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	48 83 ec 20          	sub    $0x20,%rsp
+  801aa0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aab:	48 89 c7             	mov    %rax,%rdi
+  801aae:	48 b8 1b 40 80 00 00 	movabs $0x80401b,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801abf:	7e 0a                	jle    801acb <open+0x33>
+    return -E_BAD_PATH;
+  801ac1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac6:	e9 a8 00 00 00       	jmp    801b73 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801acb:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801acf:	48 89 c7             	mov    %rax,%rdi
+  801ad2:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  801ad9:	00 00 00 
+  801adc:	ff d0                	call   *%rax
+  801ade:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ae1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ae5:	79 08                	jns    801aef <open+0x57>
+    return r;
+  801ae7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801aea:	e9 84 00 00 00       	jmp    801b73 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801af3:	48 89 c6             	mov    %rax,%rsi
+  801af6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801afd:	00 00 00 
+  801b00:	48 89 c7             	mov    %rax,%rdi
+  801b03:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b0f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b16:	00 00 00 
+  801b19:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b1c:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b26:	48 89 c6             	mov    %rax,%rsi
+  801b29:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b2e:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+  801b3a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b3d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b41:	79 1d                	jns    801b60 <open+0xc8>
+    fd_close(fd, 0);
+  801b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b47:	be 00 00 00 00       	mov    $0x0,%esi
+  801b4c:	48 89 c7             	mov    %rax,%rdi
+  801b4f:	48 b8 aa 0c 80 00 00 	movabs $0x800caa,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+    return r;
+  801b5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b5e:	eb 13                	jmp    801b73 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b64:	48 89 c7             	mov    %rax,%rdi
+  801b67:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+}
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+
+0000000000801b75 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b75:	55                   	push   %rbp
+  801b76:	48 89 e5             	mov    %rsp,%rbp
+  801b79:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b85:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b88:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b8f:	00 00 00 
+  801b92:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b94:	be 00 00 00 00       	mov    $0x0,%esi
+  801b99:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b9e:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+}
+  801baa:	c9                   	leave
+  801bab:	c3                   	ret
+
+0000000000801bac <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801bac:	55                   	push   %rbp
+  801bad:	48 89 e5             	mov    %rsp,%rbp
+  801bb0:	48 83 ec 30          	sub    $0x30,%rsp
+  801bb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bb8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bbc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801bc0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bc5:	74 07                	je     801bce <devfile_read+0x22>
+  801bc7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bcc:	75 0a                	jne    801bd8 <devfile_read+0x2c>
+  return E_INVAL;
+  801bce:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd3:	e9 b4 00 00 00       	jmp    801c8c <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bd8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bdf:	00 
+  while (n) {
+  801be0:	e9 98 00 00 00       	jmp    801c7d <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801be9:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bec:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bf3:	00 00 00 
+  801bf6:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bf8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bff:	00 00 00 
+  801c02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c06:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c14:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+  801c20:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c23:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c27:	7f 13                	jg     801c3c <devfile_read+0x90>
+      return res ? res : res0;
+  801c29:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c2d:	74 07                	je     801c36 <devfile_read+0x8a>
+  801c2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c32:	48 98                	cltq
+  801c34:	eb 56                	jmp    801c8c <devfile_read+0xe0>
+  801c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3a:	eb 50                	jmp    801c8c <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c3f:	48 63 d0             	movslq %eax,%rdx
+  801c42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c46:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c4d:	00 00 00 
+  801c50:	48 89 ce             	mov    %rcx,%rsi
+  801c53:	48 89 c7             	mov    %rax,%rdi
+  801c56:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  801c5d:	00 00 00 
+  801c60:	ff d0                	call   *%rax
+
+    buf += res;
+  801c62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c65:	48 98                	cltq
+  801c67:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c6b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c6e:	48 98                	cltq
+  801c70:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c77:	48 98                	cltq
+  801c79:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c7d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c82:	0f 85 5d ff ff ff    	jne    801be5 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c8c:	c9                   	leave
+  801c8d:	c3                   	ret
+
+0000000000801c8e <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c8e:	55                   	push   %rbp
+  801c8f:	48 89 e5             	mov    %rsp,%rbp
+  801c92:	48 83 ec 50          	sub    $0x50,%rsp
+  801c96:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c9a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c9e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801ca2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ca7:	74 07                	je     801cb0 <devfile_write+0x22>
+  801ca9:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801cae:	75 0a                	jne    801cba <devfile_write+0x2c>
+  return E_INVAL;
+  801cb0:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cb5:	e9 c9 00 00 00       	jmp    801d83 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801cba:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801cc1:	00 
+
+  while (n) {
+  801cc2:	e9 ad 00 00 00       	jmp    801d74 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801cc7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ccb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801ccf:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cd6:	00 
+  801cd7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cdf:	48 39 c2             	cmp    %rax,%rdx
+  801ce2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ce6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cf2:	48 89 c6             	mov    %rax,%rsi
+  801cf5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cfc:	00 00 00 
+  801cff:	48 89 c7             	mov    %rax,%rdi
+  801d02:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d12:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d15:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d1c:	00 00 00 
+  801d1f:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d21:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d28:	00 00 00 
+  801d2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d2f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d33:	be 00 00 00 00       	mov    $0x0,%esi
+  801d38:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d3d:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801d44:	00 00 00 
+  801d47:	ff d0                	call   *%rax
+  801d49:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d4c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d50:	79 07                	jns    801d59 <devfile_write+0xcb>
+      return res;
+  801d52:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d55:	48 98                	cltq
+  801d57:	eb 2a                	jmp    801d83 <devfile_write+0xf5>
+
+    buf += res;
+  801d59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d5c:	48 98                	cltq
+  801d5e:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d62:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d65:	48 98                	cltq
+  801d67:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d6e:	48 98                	cltq
+  801d70:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d74:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d79:	0f 85 48 ff ff ff    	jne    801cc7 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+
+0000000000801d85 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	48 83 ec 20          	sub    $0x20,%rsp
+  801d8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d91:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d99:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d9c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801da3:	00 00 00 
+  801da6:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801da8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dad:	bf 05 00 00 00       	mov    $0x5,%edi
+  801db2:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801db9:	00 00 00 
+  801dbc:	ff d0                	call   *%rax
+  801dbe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801dc1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dc5:	79 05                	jns    801dcc <devfile_stat+0x47>
+    return r;
+  801dc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801dca:	eb 59                	jmp    801e25 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dcc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dd0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801dd7:	00 00 00 
+  801dda:	48 89 d6             	mov    %rdx,%rsi
+  801ddd:	48 89 c7             	mov    %rax,%rdi
+  801de0:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  801de7:	00 00 00 
+  801dea:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dec:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801df3:	00 00 00 
+  801df6:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801dfc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e00:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e06:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e0d:	00 00 00 
+  801e10:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e1a:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+0000000000801e27 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e27:	55                   	push   %rbp
+  801e28:	48 89 e5             	mov    %rsp,%rbp
+  801e2b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e33:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e3a:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e3d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e44:	00 00 00 
+  801e47:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e49:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e50:	00 00 00 
+  801e53:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e56:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e59:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e63:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801e6a:	00 00 00 
+  801e6d:	ff d0                	call   *%rax
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+0000000000801e71 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e71:	55                   	push   %rbp
+  801e72:	48 89 e5             	mov    %rsp,%rbp
+  801e75:	48 83 ec 18          	sub    $0x18,%rsp
+  801e79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e7d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e80:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e84:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e87:	83 e0 03             	and    $0x3,%eax
+}
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+
+0000000000801e8c <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e8c:	55                   	push   %rbp
+  801e8d:	48 89 e5             	mov    %rsp,%rbp
+  801e90:	48 83 ec 10          	sub    $0x10,%rsp
+  801e94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9c:	48 89 c7             	mov    %rax,%rdi
+  801e9f:	48 b8 1b 40 80 00 00 	movabs $0x80401b,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+  801eab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eb0:	7e 07                	jle    801eb9 <remove+0x2d>
+    return -E_BAD_PATH;
+  801eb2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb7:	eb 36                	jmp    801eef <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801eb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ebd:	48 89 c6             	mov    %rax,%rsi
+  801ec0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ec7:	00 00 00 
+  801eca:	48 89 c7             	mov    %rax,%rdi
+  801ecd:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ede:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ee3:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801eea:	00 00 00 
+  801eed:	ff d0                	call   *%rax
+}
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+
+0000000000801ef1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ef1:	55                   	push   %rbp
+  801ef2:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ef5:	be 00 00 00 00       	mov    $0x0,%esi
+  801efa:	bf 08 00 00 00       	mov    $0x8,%edi
+  801eff:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801f06:	00 00 00 
+  801f09:	ff d0                	call   *%rax
+}
+  801f0b:	5d                   	pop    %rbp
+  801f0c:	c3                   	ret
+
+0000000000801f0d <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f0d:	55                   	push   %rbp
+  801f0e:	48 89 e5             	mov    %rsp,%rbp
+  801f11:	48 83 ec 20          	sub    $0x20,%rsp
+  801f15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f19:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1e:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f23:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+  801f2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f36:	79 05                	jns    801f3d <fs_stats+0x30>
+    return r;
+  801f38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f3b:	eb 2a                	jmp    801f67 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f41:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f46:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f4d:	00 00 00 
+  801f50:	48 89 ce             	mov    %rcx,%rsi
+  801f53:	48 89 c7             	mov    %rax,%rdi
+  801f56:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+  return 0;
+  801f62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+0000000000801f69 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f69:	55                   	push   %rbp
+  801f6a:	48 89 e5             	mov    %rsp,%rbp
+  801f6d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f71:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f74:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f7b:	00 00 00 
+  801f7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f81:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f83:	be 00 00 00 00       	mov    $0x0,%esi
+  801f88:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f8d:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+}
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+
+0000000000801f9b <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa3:	89 f8                	mov    %edi,%eax
+  801fa5:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801fa8:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801fac:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fb3:	00 00 00 
+  801fb6:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801fb8:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fc2:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801fc9:	00 00 00 
+  801fcc:	ff d0                	call   *%rax
+}
+  801fce:	c9                   	leave
+  801fcf:	c3                   	ret
+
+0000000000801fd0 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fd0:	55                   	push   %rbp
+  801fd1:	48 89 e5             	mov    %rsp,%rbp
+  801fd4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fe0:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fe5:	48 89 c7             	mov    %rax,%rdi
+  801fe8:	48 b8 f6 1f 80 00 00 	movabs $0x801ff6,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+}
+  801ff4:	c9                   	leave
+  801ff5:	c3                   	ret
+
+0000000000801ff6 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  801ffa:	48 83 ec 50          	sub    $0x50,%rsp
+  801ffe:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802002:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  802006:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80200d:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80200e:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802013:	74 0a                	je     80201f <pipe_size+0x29>
+  802015:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80201c:	00 
+  80201d:	76 0a                	jbe    802029 <pipe_size+0x33>
+    return -E_INVAL;
+  80201f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802024:	e9 cc 02 00 00       	jmp    8022f5 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802029:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80202d:	48 89 c7             	mov    %rax,%rdi
+  802030:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+  80203c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80203f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802043:	0f 88 a8 02 00 00    	js     8022f1 <pipe_size+0x2fb>
+  802049:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80204d:	ba 07 04 00 00       	mov    $0x407,%edx
+  802052:	48 89 c6             	mov    %rax,%rsi
+  802055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80205a:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802069:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80206d:	0f 88 7e 02 00 00    	js     8022f1 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802073:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802077:	48 89 c7             	mov    %rax,%rdi
+  80207a:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+  802086:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802089:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80208d:	0f 88 43 02 00 00    	js     8022d6 <pipe_size+0x2e0>
+  802093:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802097:	ba 07 04 00 00       	mov    $0x407,%edx
+  80209c:	48 89 c6             	mov    %rax,%rsi
+  80209f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a4:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+  8020b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020b7:	0f 88 19 02 00 00    	js     8022d6 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8020bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c1:	48 89 c7             	mov    %rax,%rdi
+  8020c4:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  8020cb:	00 00 00 
+  8020ce:	ff d0                	call   *%rax
+  8020d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020d4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020db:	00 
+  8020dc:	e9 a2 00 00 00       	jmp    802183 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020e5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020e9:	48 89 c2             	mov    %rax,%rdx
+  8020ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f0:	48 01 d0             	add    %rdx,%rax
+  8020f3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020f8:	48 89 c6             	mov    %rax,%rsi
+  8020fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802100:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+  80210c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80210f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802113:	0f 88 37 01 00 00    	js     802250 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  802119:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80211d:	48 89 c7             	mov    %rax,%rdi
+  802120:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+  80212c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802130:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802134:	48 01 c2             	add    %rax,%rdx
+  802137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80213b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80213f:	48 89 c1             	mov    %rax,%rcx
+  802142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802146:	48 01 c8             	add    %rcx,%rax
+  802149:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80214f:	48 89 d1             	mov    %rdx,%rcx
+  802152:	ba 00 00 00 00       	mov    $0x0,%edx
+  802157:	48 89 c6             	mov    %rax,%rsi
+  80215a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215f:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  802166:	00 00 00 
+  802169:	ff d0                	call   *%rax
+  80216b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80216e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802172:	79 0a                	jns    80217e <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802174:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802179:	e9 d3 00 00 00       	jmp    802251 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80217e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802183:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80218a:	00 
+  80218b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80218f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802193:	48 01 d0             	add    %rdx,%rax
+  802196:	48 83 c0 1f          	add    $0x1f,%rax
+  80219a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80219e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a7:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8021ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021af:	48 29 d0             	sub    %rdx,%rax
+  8021b2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8021b6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8021ba:	0f 82 21 ff ff ff    	jb     8020e1 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021cc:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021d0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d8:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021df:	00 00 00 
+  8021e2:	8b 12                	mov    (%rdx),%edx
+  8021e4:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ea:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f5:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021fc:	00 00 00 
+  8021ff:	8b 12                	mov    (%rdx),%edx
+  802201:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  802203:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802207:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80220e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802212:	48 89 c7             	mov    %rax,%rdi
+  802215:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	89 c2                	mov    %eax,%edx
+  802223:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802227:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802229:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80222d:	48 89 c7             	mov    %rax,%rdi
+  802230:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802240:	48 83 c2 04          	add    $0x4,%rdx
+  802244:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224b:	e9 a5 00 00 00       	jmp    8022f5 <pipe_size+0x2ff>
+      goto err2;
+  802250:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802251:	eb 58                	jmp    8022ab <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802253:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802257:	48 c1 e0 0c          	shl    $0xc,%rax
+  80225b:	48 89 c2             	mov    %rax,%rdx
+  80225e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802262:	48 01 d0             	add    %rdx,%rax
+  802265:	48 89 c6             	mov    %rax,%rsi
+  802268:	bf 00 00 00 00       	mov    $0x0,%edi
+  80226d:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802279:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80227d:	48 89 c7             	mov    %rax,%rdi
+  802280:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802287:	00 00 00 
+  80228a:	ff d0                	call   *%rax
+  80228c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802290:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802294:	48 01 d0             	add    %rdx,%rax
+  802297:	48 89 c6             	mov    %rax,%rsi
+  80229a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229f:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  8022a6:	00 00 00 
+  8022a9:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8022ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022af:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022b3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8022b7:	48 85 c0             	test   %rax,%rax
+  8022ba:	75 97                	jne    802253 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8022bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022c0:	48 89 c6             	mov    %rax,%rsi
+  8022c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c8:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  8022cf:	00 00 00 
+  8022d2:	ff d0                	call   *%rax
+  8022d4:	eb 01                	jmp    8022d7 <pipe_size+0x2e1>
+    goto err1;
+  8022d6:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022db:	48 89 c6             	mov    %rax,%rsi
+  8022de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e3:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	eb 01                	jmp    8022f2 <pipe_size+0x2fc>
+    goto err;
+  8022f1:	90                   	nop
+err:
+  return r;
+  8022f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022f5:	c9                   	leave
+  8022f6:	c3                   	ret
+
+00000000008022f7 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	53                   	push   %rbx
+  8022fc:	48 83 ec 28          	sub    $0x28,%rsp
+  802300:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802304:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  802308:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80230f:	00 00 00 
+  802312:	8b 40 04             	mov    0x4(%rax),%eax
+  802315:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80231a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802321:	00 00 00 
+  802324:	48 98                	cltq
+  802326:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80232d:	48 01 d0             	add    %rdx,%rax
+  802330:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802336:	8b 00                	mov    (%rax),%eax
+  802338:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80233b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80233f:	48 89 c7             	mov    %rax,%rdi
+  802342:	48 b8 d5 4e 80 00 00 	movabs $0x804ed5,%rax
+  802349:	00 00 00 
+  80234c:	ff d0                	call   *%rax
+  80234e:	89 c3                	mov    %eax,%ebx
+  802350:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802354:	48 89 c7             	mov    %rax,%rdi
+  802357:	48 b8 d5 4e 80 00 00 	movabs $0x804ed5,%rax
+  80235e:	00 00 00 
+  802361:	ff d0                	call   *%rax
+  802363:	39 c3                	cmp    %eax,%ebx
+  802365:	0f 94 c0             	sete   %al
+  802368:	0f b6 c0             	movzbl %al,%eax
+  80236b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80236e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802375:	00 00 00 
+  802378:	8b 40 04             	mov    0x4(%rax),%eax
+  80237b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802380:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802387:	00 00 00 
+  80238a:	48 98                	cltq
+  80238c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802393:	48 01 d0             	add    %rdx,%rax
+  802396:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80239c:	8b 00                	mov    (%rax),%eax
+  80239e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8023a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a4:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023a7:	75 05                	jne    8023ae <_pipeisclosed+0xb7>
+      return ret;
+  8023a9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023ac:	eb 68                	jmp    802416 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8023ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023b1:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023b4:	0f 84 4e ff ff ff    	je     802308 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8023ba:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023c1:	00 00 00 
+  8023c4:	8b 40 04             	mov    0x4(%rax),%eax
+  8023c7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023cc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023d3:	00 00 00 
+  8023d6:	48 98                	cltq
+  8023d8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023df:	48 01 d0             	add    %rdx,%rax
+  8023e2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023e8:	8b 10                	mov    (%rax),%edx
+  8023ea:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023f0:	89 c6                	mov    %eax,%esi
+  8023f2:	48 b8 a8 50 80 00 00 	movabs $0x8050a8,%rax
+  8023f9:	00 00 00 
+  8023fc:	48 89 c7             	mov    %rax,%rdi
+  8023ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802404:	49 b8 6c 31 80 00 00 	movabs $0x80316c,%r8
+  80240b:	00 00 00 
+  80240e:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802411:	e9 f2 fe ff ff       	jmp    802308 <_pipeisclosed+0x11>
+  }
+}
+  802416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80241a:	c9                   	leave
+  80241b:	c3                   	ret
+
+000000000080241c <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+  802420:	48 83 ec 30          	sub    $0x30,%rsp
+  802424:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802427:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80242b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80242e:	48 89 d6             	mov    %rdx,%rsi
+  802431:	89 c7                	mov    %eax,%edi
+  802433:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802442:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802446:	79 05                	jns    80244d <pipeisclosed+0x31>
+    return r;
+  802448:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80244b:	eb 31                	jmp    80247e <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80244d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802451:	48 89 c7             	mov    %rax,%rdi
+  802454:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+  802460:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802468:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80246c:	48 89 d6             	mov    %rdx,%rsi
+  80246f:	48 89 c7             	mov    %rax,%rdi
+  802472:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+}
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+0000000000802480 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  802480:	55                   	push   %rbp
+  802481:	48 89 e5             	mov    %rsp,%rbp
+  802484:	48 83 ec 10          	sub    $0x10,%rsp
+  802488:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80248c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802490:	8b 40 18             	mov    0x18(%rax),%eax
+  802493:	8d 50 01             	lea    0x1(%rax),%edx
+  802496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249a:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80249d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a1:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	74 27                	je     8024cf <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8024a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ac:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8024b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b7:	48 83 c0 18          	add    $0x18,%rax
+  8024bb:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024c0:	48 89 c7             	mov    %rax,%rdi
+  8024c3:	48 b8 b8 07 80 00 00 	movabs $0x8007b8,%rax
+  8024ca:	00 00 00 
+  8024cd:	ff d0                	call   *%rax
+  }
+}
+  8024cf:	90                   	nop
+  8024d0:	c9                   	leave
+  8024d1:	c3                   	ret
+
+00000000008024d2 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024d2:	55                   	push   %rbp
+  8024d3:	48 89 e5             	mov    %rsp,%rbp
+  8024d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8024da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024de:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e5:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f0:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024f7:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024fe:	89 c6                	mov    %eax,%esi
+  802500:	48 89 cf             	mov    %rcx,%rdi
+  802503:	48 b8 69 07 80 00 00 	movabs $0x800769,%rax
+  80250a:	00 00 00 
+  80250d:	ff d0                	call   *%rax
+}
+  80250f:	90                   	nop
+  802510:	c9                   	leave
+  802511:	c3                   	ret
+
+0000000000802512 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802512:	55                   	push   %rbp
+  802513:	48 89 e5             	mov    %rsp,%rbp
+  802516:	48 83 ec 70          	sub    $0x70,%rsp
+  80251a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80251e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802522:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802526:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80252a:	48 89 c7             	mov    %rax,%rdi
+  80252d:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+  802539:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80253d:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802542:	75 0a                	jne    80254e <devpipe_read+0x3c>
+    return 0;
+  802544:	b8 00 00 00 00       	mov    $0x0,%eax
+  802549:	e9 63 01 00 00       	jmp    8026b1 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80254e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802552:	8b 40 18             	mov    0x18(%rax),%eax
+  802555:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255c:	48 8b 10             	mov    (%rax),%rdx
+  80255f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802563:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802567:	48 39 c2             	cmp    %rax,%rdx
+  80256a:	75 42                	jne    8025ae <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80256c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802570:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802574:	48 89 d6             	mov    %rdx,%rsi
+  802577:	48 89 c7             	mov    %rax,%rdi
+  80257a:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+  802586:	85 c0                	test   %eax,%eax
+  802588:	74 0a                	je     802594 <devpipe_read+0x82>
+      return 0;
+  80258a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80258f:	e9 1d 01 00 00       	jmp    8026b1 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802594:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802597:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80259b:	89 d6                	mov    %edx,%esi
+  80259d:	48 89 c7             	mov    %rax,%rdi
+  8025a0:	48 b8 d2 24 80 00 00 	movabs $0x8024d2,%rax
+  8025a7:	00 00 00 
+  8025aa:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8025ac:	eb a0                	jmp    80254e <devpipe_read+0x3c>
+      break;
+  8025ae:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8025af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8025b7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025bb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8025bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025cb:	48 8b 00             	mov    (%rax),%rax
+  8025ce:	48 29 c2             	sub    %rax,%rdx
+  8025d1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025dd:	48 39 c2             	cmp    %rax,%rdx
+  8025e0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025e4:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ec:	48 8b 00             	mov    (%rax),%rax
+  8025ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025f3:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fc:	48 f7 f1             	div    %rcx
+  8025ff:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  802603:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802607:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80260b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80260f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802613:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  802617:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80261b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80261f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802623:	48 39 c2             	cmp    %rax,%rdx
+  802626:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80262a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80262e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802632:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802636:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80263a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80263e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802642:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802646:	48 89 ce             	mov    %rcx,%rsi
+  802649:	48 89 c7             	mov    %rax,%rdi
+  80264c:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802658:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80265c:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802660:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802664:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802668:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80266c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802670:	48 01 d1             	add    %rdx,%rcx
+  802673:	48 89 c2             	mov    %rax,%rdx
+  802676:	48 89 cf             	mov    %rcx,%rdi
+  802679:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  802680:	00 00 00 
+  802683:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802689:	48 8b 10             	mov    (%rax),%rdx
+  80268c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802690:	48 01 c2             	add    %rax,%rdx
+  802693:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802697:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80269a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269e:	48 89 c7             	mov    %rax,%rdi
+  8026a1:	48 b8 80 24 80 00 00 	movabs $0x802480,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+  return n;
+  8026ad:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+00000000008026b3 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026b3:	55                   	push   %rbp
+  8026b4:	48 89 e5             	mov    %rsp,%rbp
+  8026b7:	48 83 ec 70          	sub    $0x70,%rsp
+  8026bb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8026bf:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026c3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026cb:	48 89 c7             	mov    %rax,%rdi
+  8026ce:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  8026d5:	00 00 00 
+  8026d8:	ff d0                	call   *%rax
+  8026da:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026de:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026e2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026e6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026ed:	00 
+  8026ee:	e9 b8 01 00 00       	jmp    8028ab <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f7:	8b 40 18             	mov    0x18(%rax),%eax
+  8026fa:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802701:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802705:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802709:	48 8b 00             	mov    (%rax),%rax
+  80270c:	48 29 c2             	sub    %rax,%rdx
+  80270f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802713:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802717:	48 39 c2             	cmp    %rax,%rdx
+  80271a:	75 4d                	jne    802769 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80271c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802720:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802724:	48 89 d6             	mov    %rdx,%rsi
+  802727:	48 89 c7             	mov    %rax,%rdi
+  80272a:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	85 c0                	test   %eax,%eax
+  802738:	74 0a                	je     802744 <devpipe_write+0x91>
+        return 0;
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273f:	e9 79 01 00 00       	jmp    8028bd <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802744:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802747:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80274b:	89 d6                	mov    %edx,%esi
+  80274d:	48 89 c7             	mov    %rax,%rdi
+  802750:	48 b8 d2 24 80 00 00 	movabs $0x8024d2,%rax
+  802757:	00 00 00 
+  80275a:	ff d0                	call   *%rax
+      m = 0;
+  80275c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802763:	00 
+      continue;
+  802764:	e9 3a 01 00 00       	jmp    8028a3 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802769:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80276d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802771:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802775:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802779:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80277d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802781:	48 8b 08             	mov    (%rax),%rcx
+  802784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802788:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80278c:	48 29 c1             	sub    %rax,%rcx
+  80278f:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802793:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802797:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80279b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80279f:	48 39 c2             	cmp    %rax,%rdx
+  8027a2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8027aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027b6:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8027ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bf:	48 f7 f1             	div    %rcx
+  8027c2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027ca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027d6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027da:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027de:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027e6:	48 39 c2             	cmp    %rax,%rdx
+  8027e9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027ed:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027f5:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027fd:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  802801:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802805:	48 01 d1             	add    %rdx,%rcx
+  802808:	48 89 c2             	mov    %rax,%rdx
+  80280b:	48 89 cf             	mov    %rcx,%rdi
+  80280e:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80281a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80281e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802822:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802826:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80282a:	73 4d                	jae    802879 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80282c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802830:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802834:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802838:	48 29 c2             	sub    %rax,%rdx
+  80283b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80283f:	48 01 c2             	add    %rax,%rdx
+  802842:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802846:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80284a:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80284e:	48 89 c1             	mov    %rax,%rcx
+  802851:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802855:	48 01 c1             	add    %rax,%rcx
+  802858:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80285c:	48 01 c1             	add    %rax,%rcx
+  80285f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802863:	48 83 c0 20          	add    $0x20,%rax
+  802867:	48 89 ce             	mov    %rcx,%rsi
+  80286a:	48 89 c7             	mov    %rax,%rdi
+  80286d:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  802874:	00 00 00 
+  802877:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802879:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80287d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802881:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802885:	48 01 c2             	add    %rax,%rdx
+  802888:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80288c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802894:	48 89 c7             	mov    %rax,%rdi
+  802897:	48 b8 80 24 80 00 00 	movabs $0x802480,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8028a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028a7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8028ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028af:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8028b3:	0f 82 3a fe ff ff    	jb     8026f3 <devpipe_write+0x40>
+  }
+
+  return i;
+  8028b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8028bd:	c9                   	leave
+  8028be:	c3                   	ret
+
+00000000008028bf <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8028bf:	55                   	push   %rbp
+  8028c0:	48 89 e5             	mov    %rsp,%rbp
+  8028c3:	48 83 ec 40          	sub    $0x40,%rsp
+  8028c7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028cb:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028d6:	48 89 c7             	mov    %rax,%rdi
+  8028d9:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  8028e0:	00 00 00 
+  8028e3:	ff d0                	call   *%rax
+  8028e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f4:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028fc:	48 89 d6             	mov    %rdx,%rsi
+  8028ff:	48 89 c7             	mov    %rax,%rdi
+  802902:	48 b8 9a 15 80 00 00 	movabs $0x80159a,%rax
+  802909:	00 00 00 
+  80290c:	ff d0                	call   *%rax
+  80290e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802911:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802915:	79 08                	jns    80291f <devpipe_poll+0x60>
+    return r;
+  802917:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80291a:	e9 85 00 00 00       	jmp    8029a4 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80291f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802922:	83 e0 01             	and    $0x1,%eax
+  802925:	85 c0                	test   %eax,%eax
+  802927:	74 18                	je     802941 <devpipe_poll+0x82>
+  802929:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80292d:	48 8b 10             	mov    (%rax),%rdx
+  802930:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802934:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802938:	48 39 c2             	cmp    %rax,%rdx
+  80293b:	74 04                	je     802941 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80293d:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802941:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802944:	83 e0 02             	and    $0x2,%eax
+  802947:	85 c0                	test   %eax,%eax
+  802949:	74 23                	je     80296e <devpipe_poll+0xaf>
+  80294b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80294f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802953:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802957:	48 8b 00             	mov    (%rax),%rax
+  80295a:	48 29 c2             	sub    %rax,%rdx
+  80295d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802961:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802965:	48 39 c2             	cmp    %rax,%rdx
+  802968:	73 04                	jae    80296e <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80296a:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80296e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802972:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802976:	48 89 d6             	mov    %rdx,%rsi
+  802979:	48 89 c7             	mov    %rax,%rdi
+  80297c:	48 b8 f7 22 80 00 00 	movabs $0x8022f7,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	74 04                	je     802990 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80298c:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802990:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802994:	75 0b                	jne    8029a1 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80299a:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8029a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+
+00000000008029a6 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8029ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8029b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029ba:	48 89 c7             	mov    %rax,%rdi
+  8029bd:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  8029c4:	00 00 00 
+  8029c7:	ff d0                	call   *%rax
+  8029c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029d1:	48 ba d9 50 80 00 00 	movabs $0x8050d9,%rdx
+  8029d8:	00 00 00 
+  8029db:	48 89 d6             	mov    %rdx,%rsi
+  8029de:	48 89 c7             	mov    %rax,%rdi
+  8029e1:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029f5:	89 c1                	mov    %eax,%ecx
+  8029f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029fb:	48 8b 00             	mov    (%rax),%rax
+  8029fe:	89 c2                	mov    %eax,%edx
+  802a00:	89 c8                	mov    %ecx,%eax
+  802a02:	29 d0                	sub    %edx,%eax
+  802a04:	89 c2                	mov    %eax,%edx
+  802a06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a0a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a14:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a1b:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a22:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a29:	00 00 00 
+  802a2c:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a38:	c9                   	leave
+  802a39:	c3                   	ret
+
+0000000000802a3a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	48 83 ec 40          	sub    $0x40,%rsp
+  802a42:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a4a:	48 89 c7             	mov    %rax,%rdi
+  802a4d:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802a54:	00 00 00 
+  802a57:	ff d0                	call   *%rax
+  802a59:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a5d:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a64:	00 
+  802a65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a69:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a71:	48 01 d0             	add    %rdx,%rax
+  802a74:	48 83 c0 1f          	add    $0x1f,%rax
+  802a78:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a85:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a8d:	48 29 d0             	sub    %rdx,%rax
+  802a90:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a94:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a9c:	48 89 c6             	mov    %rax,%rsi
+  802a9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa4:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802ab0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ab4:	48 89 c7             	mov    %rax,%rdi
+  802ab7:	48 b8 80 24 80 00 00 	movabs $0x802480,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ac3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ac7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802acb:	eb 2f                	jmp    802afc <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ad1:	48 83 e8 01          	sub    $0x1,%rax
+  802ad5:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ad9:	48 89 c2             	mov    %rax,%rdx
+  802adc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ae0:	48 01 d0             	add    %rdx,%rax
+  802ae3:	48 89 c6             	mov    %rax,%rsi
+  802ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aeb:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  802af2:	00 00 00 
+  802af5:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802af7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802afc:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802b01:	77 ca                	ja     802acd <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b07:	48 89 c6             	mov    %rax,%rsi
+  802b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0f:	48 b8 75 04 80 00 00 	movabs $0x800475,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+}
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+0000000000802b1d <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b1d:	55                   	push   %rbp
+  802b1e:	48 89 e5             	mov    %rsp,%rbp
+  802b21:	48 83 ec 08          	sub    $0x8,%rsp
+  802b25:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b2c:	75 10                	jne    802b3e <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b2e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b35:	00 00 00 
+  802b38:	8b 00                	mov    (%rax),%eax
+  802b3a:	48 98                	cltq
+  802b3c:	eb 05                	jmp    802b43 <vsyscall+0x26>
+  }
+  return 0;
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+
+0000000000802b45 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4e:	48 b8 1d 2b 80 00 00 	movabs $0x802b1d,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+}
+  802b5a:	5d                   	pop    %rbp
+  802b5b:	c3                   	ret
+
+0000000000802b5c <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b5c:	55                   	push   %rbp
+  802b5d:	48 89 e5             	mov    %rsp,%rbp
+  802b60:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b64:	0f 31                	rdtsc
+  802b66:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b69:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b6f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b72:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b76:	48 09 d0             	or     %rdx,%rax
+  802b79:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b81:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b85:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b8c:	00 00 00 
+  802b8f:	8b 40 08             	mov    0x8(%rax),%eax
+  802b92:	48 98                	cltq
+  802b94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802ba5:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802bac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb5:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bb9:	48 89 d0             	mov    %rdx,%rax
+  802bbc:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bcc:	48 01 c8             	add    %rcx,%rax
+}
+  802bcf:	c9                   	leave
+  802bd0:	c3                   	ret
+
+0000000000802bd1 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bd1:	55                   	push   %rbp
+  802bd2:	48 89 e5             	mov    %rsp,%rbp
+  802bd5:	48 83 ec 20          	sub    $0x20,%rsp
+  802bd9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bdc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bdf:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802be2:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802be6:	be 01 00 00 00       	mov    $0x1,%esi
+  802beb:	48 89 c7             	mov    %rax,%rdi
+  802bee:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+}
+  802bfa:	90                   	nop
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+
+0000000000802bfd <getchar>:
+
+int
+getchar(void) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c05:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c09:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c0e:	48 89 c6             	mov    %rax,%rsi
+  802c11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c16:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  802c1d:	00 00 00 
+  802c20:	ff d0                	call   *%rax
+  802c22:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c25:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c29:	79 05                	jns    802c30 <getchar+0x33>
+    return r;
+  802c2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c2e:	eb 14                	jmp    802c44 <getchar+0x47>
+  if (r < 1)
+  802c30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c34:	7f 07                	jg     802c3d <getchar+0x40>
+    return -E_EOF;
+  802c36:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c3b:	eb 07                	jmp    802c44 <getchar+0x47>
+  return c;
+  802c3d:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c41:	0f b6 c0             	movzbl %al,%eax
+}
+  802c44:	c9                   	leave
+  802c45:	c3                   	ret
+
+0000000000802c46 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c46:	55                   	push   %rbp
+  802c47:	48 89 e5             	mov    %rsp,%rbp
+  802c4a:	48 83 ec 20          	sub    $0x20,%rsp
+  802c4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c51:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c58:	48 89 d6             	mov    %rdx,%rsi
+  802c5b:	89 c7                	mov    %eax,%edi
+  802c5d:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+  802c69:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c6c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c70:	79 05                	jns    802c77 <iscons+0x31>
+    return r;
+  802c72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c75:	eb 1a                	jmp    802c91 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c7b:	8b 10                	mov    (%rax),%edx
+  802c7d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c84:	00 00 00 
+  802c87:	8b 00                	mov    (%rax),%eax
+  802c89:	39 c2                	cmp    %eax,%edx
+  802c8b:	0f 94 c0             	sete   %al
+  802c8e:	0f b6 c0             	movzbl %al,%eax
+}
+  802c91:	c9                   	leave
+  802c92:	c3                   	ret
+
+0000000000802c93 <opencons>:
+
+int
+opencons(void) {
+  802c93:	55                   	push   %rbp
+  802c94:	48 89 e5             	mov    %rsp,%rbp
+  802c97:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c9b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c9f:	48 89 c7             	mov    %rax,%rdi
+  802ca2:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  802ca9:	00 00 00 
+  802cac:	ff d0                	call   *%rax
+  802cae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cb1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cb5:	79 05                	jns    802cbc <opencons+0x29>
+    return r;
+  802cb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cba:	eb 66                	jmp    802d22 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802cbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cc0:	ba 07 04 00 00       	mov    $0x407,%edx
+  802cc5:	48 89 c6             	mov    %rax,%rsi
+  802cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccd:	48 b8 bd 03 80 00 00 	movabs $0x8003bd,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+  802cd9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ce0:	79 05                	jns    802ce7 <opencons+0x54>
+    return r;
+  802ce2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce5:	eb 3b                	jmp    802d22 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ceb:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cf2:	00 00 00 
+  802cf5:	8b 12                	mov    (%rdx),%edx
+  802cf7:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cf9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d08:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d13:	48 89 c7             	mov    %rax,%rdi
+  802d16:	48 b8 a4 0a 80 00 00 	movabs $0x800aa4,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+}
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+
+0000000000802d24 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	48 83 ec 20          	sub    $0x20,%rsp
+  802d2c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d2f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d32:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d39:	48 89 d6             	mov    %rdx,%rsi
+  802d3c:	89 c7                	mov    %eax,%edi
+  802d3e:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+  802d4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d51:	79 05                	jns    802d58 <consmode+0x34>
+    return r;
+  802d53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d56:	eb 34                	jmp    802d8c <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d5c:	8b 10                	mov    (%rax),%edx
+  802d5e:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d65:	00 00 00 
+  802d68:	8b 00                	mov    (%rax),%eax
+  802d6a:	39 c2                	cmp    %eax,%edx
+  802d6c:	74 07                	je     802d75 <consmode+0x51>
+    return -E_INVAL;
+  802d6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d73:	eb 17                	jmp    802d8c <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d79:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d7c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d83:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d86:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+0000000000802d8e <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d8e:	55                   	push   %rbp
+  802d8f:	48 89 e5             	mov    %rsp,%rbp
+  802d92:	48 83 ec 20          	sub    $0x20,%rsp
+  802d96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802da2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802da6:	8b 50 0c             	mov    0xc(%rax),%edx
+  802da9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802dad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db1:	48 89 ce             	mov    %rcx,%rsi
+  802db4:	48 89 c7             	mov    %rax,%rdi
+  802db7:	48 b8 17 07 80 00 00 	movabs $0x800717,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+  802dc3:	48 98                	cltq
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802dd2:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802dd9:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802de0:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802de7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dee:	eb 74                	jmp    802e64 <devcons_write+0x9d>
+    m = n - tot;
+  802df0:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802df7:	89 c2                	mov    %eax,%edx
+  802df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dfc:	29 c2                	sub    %eax,%edx
+  802dfe:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802e01:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e04:	83 f8 7f             	cmp    $0x7f,%eax
+  802e07:	76 07                	jbe    802e10 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e09:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e13:	48 63 d0             	movslq %eax,%rdx
+  802e16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e19:	48 63 c8             	movslq %eax,%rcx
+  802e1c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e23:	48 01 c1             	add    %rax,%rcx
+  802e26:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e2d:	48 89 ce             	mov    %rcx,%rsi
+  802e30:	48 89 c7             	mov    %rax,%rdi
+  802e33:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e3f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e42:	48 63 d0             	movslq %eax,%rdx
+  802e45:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e4c:	48 89 d6             	mov    %rdx,%rsi
+  802e4f:	48 89 c7             	mov    %rax,%rdi
+  802e52:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  802e59:	00 00 00 
+  802e5c:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e61:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e67:	48 98                	cltq
+  802e69:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e70:	0f 82 7a ff ff ff    	jb     802df0 <devcons_write+0x29>
+  }
+  return tot;
+  802e76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e79:	48 98                	cltq
+}
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+
+0000000000802e7d <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e7d:	55                   	push   %rbp
+  802e7e:	48 89 e5             	mov    %rsp,%rbp
+  802e81:	48 83 ec 08          	sub    $0x8,%rsp
+  802e85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+0000000000802e90 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	48 83 ec 10          	sub    $0x10,%rsp
+  802e98:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e9c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802ea0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea4:	48 ba e5 50 80 00 00 	movabs $0x8050e5,%rdx
+  802eab:	00 00 00 
+  802eae:	48 89 d6             	mov    %rdx,%rsi
+  802eb1:	48 89 c7             	mov    %rax,%rdi
+  802eb4:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  802ebb:	00 00 00 
+  802ebe:	ff d0                	call   *%rax
+  return 0;
+  802ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ec5:	c9                   	leave
+  802ec6:	c3                   	ret
+
+0000000000802ec7 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ec7:	55                   	push   %rbp
+  802ec8:	48 89 e5             	mov    %rsp,%rbp
+  802ecb:	48 83 ec 30          	sub    $0x30,%rsp
+  802ecf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ed3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802ed6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802eda:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ee1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ee4:	83 e0 02             	and    $0x2,%eax
+  802ee7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802eea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eee:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ef1:	83 f8 01             	cmp    $0x1,%eax
+  802ef4:	75 04                	jne    802efa <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ef6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802efa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802efd:	83 e0 01             	and    $0x1,%eax
+  802f00:	85 c0                	test   %eax,%eax
+  802f02:	74 44                	je     802f48 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f0c:	89 c2                	mov    %eax,%edx
+  802f0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f18:	48 b8 05 08 80 00 00 	movabs $0x800805,%rax
+  802f1f:	00 00 00 
+  802f22:	ff d0                	call   *%rax
+  802f24:	83 f8 01             	cmp    $0x1,%eax
+  802f27:	75 06                	jne    802f2f <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f29:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f2d:	eb 19                	jmp    802f48 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f33:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f39:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f3c:	89 c2                	mov    %eax,%edx
+  802f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f42:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f48:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f4b:	c9                   	leave
+  802f4c:	c3                   	ret
+
+0000000000802f4d <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f4d:	55                   	push   %rbp
+  802f4e:	48 89 e5             	mov    %rsp,%rbp
+  802f51:	53                   	push   %rbx
+  802f52:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f59:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f60:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f66:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f6d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f74:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f7b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f82:	84 c0                	test   %al,%al
+  802f84:	74 23                	je     802fa9 <_panic+0x5c>
+  802f86:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f8d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f91:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f95:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f99:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f9d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802fa1:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802fa5:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802fa9:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802fb0:	00 00 00 
+  802fb3:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802fba:	00 00 00 
+  802fbd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fc1:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fc8:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802fcf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fd6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fdd:	00 00 00 
+  802fe0:	48 8b 18             	mov    (%rax),%rbx
+  802fe3:	48 b8 44 03 80 00 00 	movabs $0x800344,%rax
+  802fea:	00 00 00 
+  802fed:	ff d0                	call   *%rax
+  802fef:	89 c6                	mov    %eax,%esi
+  802ff1:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802ff7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802ffe:	41 89 d0             	mov    %edx,%r8d
+  803001:	48 89 c1             	mov    %rax,%rcx
+  803004:	48 89 da             	mov    %rbx,%rdx
+  803007:	48 b8 f0 50 80 00 00 	movabs $0x8050f0,%rax
+  80300e:	00 00 00 
+  803011:	48 89 c7             	mov    %rax,%rdi
+  803014:	b8 00 00 00 00       	mov    $0x0,%eax
+  803019:	49 b9 6c 31 80 00 00 	movabs $0x80316c,%r9
+  803020:	00 00 00 
+  803023:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803026:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80302d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803034:	48 89 d6             	mov    %rdx,%rsi
+  803037:	48 89 c7             	mov    %rax,%rdi
+  80303a:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  803041:	00 00 00 
+  803044:	ff d0                	call   *%rax
+  cprintf("\n");
+  803046:	48 b8 13 51 80 00 00 	movabs $0x805113,%rax
+  80304d:	00 00 00 
+  803050:	48 89 c7             	mov    %rax,%rdi
+  803053:	b8 00 00 00 00       	mov    $0x0,%eax
+  803058:	48 ba 6c 31 80 00 00 	movabs $0x80316c,%rdx
+  80305f:	00 00 00 
+  803062:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803064:	cc                   	int3
+  803065:	eb fd                	jmp    803064 <_panic+0x117>
+
+0000000000803067 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803067:	55                   	push   %rbp
+  803068:	48 89 e5             	mov    %rsp,%rbp
+  80306b:	48 83 ec 10          	sub    $0x10,%rsp
+  80306f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803072:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803076:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80307a:	8b 00                	mov    (%rax),%eax
+  80307c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80307f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803083:	89 0a                	mov    %ecx,(%rdx)
+  803085:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803088:	89 d1                	mov    %edx,%ecx
+  80308a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80308e:	48 98                	cltq
+  803090:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803094:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803098:	8b 00                	mov    (%rax),%eax
+  80309a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80309f:	75 2c                	jne    8030cd <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8030a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a5:	8b 00                	mov    (%rax),%eax
+  8030a7:	48 98                	cltq
+  8030a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030ad:	48 83 c2 08          	add    $0x8,%rdx
+  8030b1:	48 89 c6             	mov    %rax,%rsi
+  8030b4:	48 89 d7             	mov    %rdx,%rdi
+  8030b7:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  8030be:	00 00 00 
+  8030c1:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d1:	8b 40 04             	mov    0x4(%rax),%eax
+  8030d4:	8d 50 01             	lea    0x1(%rax),%edx
+  8030d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030db:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030de:	90                   	nop
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+
+00000000008030e1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030e1:	55                   	push   %rbp
+  8030e2:	48 89 e5             	mov    %rsp,%rbp
+  8030e5:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030ec:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030f3:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030fa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  803101:	00 00 00 
+  b.cnt = 0;
+  803104:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80310b:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80310e:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803115:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80311c:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803123:	48 89 c6             	mov    %rax,%rsi
+  803126:	48 b8 67 30 80 00 00 	movabs $0x803067,%rax
+  80312d:	00 00 00 
+  803130:	48 89 c7             	mov    %rax,%rdi
+  803133:	48 b8 c6 34 80 00 00 	movabs $0x8034c6,%rax
+  80313a:	00 00 00 
+  80313d:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80313f:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803145:	48 98                	cltq
+  803147:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80314e:	48 83 c2 08          	add    $0x8,%rdx
+  803152:	48 89 c6             	mov    %rax,%rsi
+  803155:	48 89 d7             	mov    %rdx,%rdi
+  803158:	48 b8 a6 01 80 00 00 	movabs $0x8001a6,%rax
+  80315f:	00 00 00 
+  803162:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803164:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80316a:	c9                   	leave
+  80316b:	c3                   	ret
+
+000000000080316c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80316c:	55                   	push   %rbp
+  80316d:	48 89 e5             	mov    %rsp,%rbp
+  803170:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803177:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80317e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803185:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80318c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803193:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80319a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8031a1:	84 c0                	test   %al,%al
+  8031a3:	74 20                	je     8031c5 <cprintf+0x59>
+  8031a5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8031a9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8031ad:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8031b1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8031b5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8031b9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8031bd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031c1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031c5:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031cc:	00 00 00 
+  8031cf:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031d6:	00 00 00 
+  8031d9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031dd:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031e4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031eb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031f2:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031f9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803200:	48 89 d6             	mov    %rdx,%rsi
+  803203:	48 89 c7             	mov    %rax,%rdi
+  803206:	48 b8 e1 30 80 00 00 	movabs $0x8030e1,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+  803212:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  803218:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+0000000000803220 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803220:	55                   	push   %rbp
+  803221:	48 89 e5             	mov    %rsp,%rbp
+  803224:	48 83 ec 30          	sub    $0x30,%rsp
+  803228:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80322c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803230:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803234:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803237:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80323b:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80323f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803242:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803246:	72 54                	jb     80329c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803248:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80324b:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80324e:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80325a:	48 f7 f6             	div    %rsi
+  80325d:	49 89 c2             	mov    %rax,%r10
+  803260:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803263:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803266:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80326a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80326e:	41 89 c9             	mov    %ecx,%r9d
+  803271:	41 89 f8             	mov    %edi,%r8d
+  803274:	89 d1                	mov    %edx,%ecx
+  803276:	4c 89 d2             	mov    %r10,%rdx
+  803279:	48 89 c7             	mov    %rax,%rdi
+  80327c:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  803283:	00 00 00 
+  803286:	ff d0                	call   *%rax
+  803288:	eb 1c                	jmp    8032a6 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80328a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80328e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803291:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803295:	48 89 d6             	mov    %rdx,%rsi
+  803298:	89 c7                	mov    %eax,%edi
+  80329a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80329c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8032a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8032a4:	7f e4                	jg     80328a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8032a6:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8032a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b2:	48 f7 f1             	div    %rcx
+  8032b5:	48 b8 50 53 80 00 00 	movabs $0x805350,%rax
+  8032bc:	00 00 00 
+  8032bf:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032c3:	0f be c0             	movsbl %al,%eax
+  8032c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ca:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032ce:	48 89 d6             	mov    %rdx,%rsi
+  8032d1:	89 c7                	mov    %eax,%edi
+  8032d3:	ff d1                	call   *%rcx
+}
+  8032d5:	90                   	nop
+  8032d6:	c9                   	leave
+  8032d7:	c3                   	ret
+
+00000000008032d8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032d8:	55                   	push   %rbp
+  8032d9:	48 89 e5             	mov    %rsp,%rbp
+  8032dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8032e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032e7:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032eb:	7e 4b                	jle    803338 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032f1:	8b 00                	mov    (%rax),%eax
+  8032f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8032f6:	77 24                	ja     80331c <getuint+0x44>
+  8032f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032fc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803300:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803304:	8b 00                	mov    (%rax),%eax
+  803306:	89 c0                	mov    %eax,%eax
+  803308:	48 01 d0             	add    %rdx,%rax
+  80330b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330f:	8b 12                	mov    (%rdx),%edx
+  803311:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803314:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803318:	89 0a                	mov    %ecx,(%rdx)
+  80331a:	eb 14                	jmp    803330 <getuint+0x58>
+  80331c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803320:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803324:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803328:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80332c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803330:	48 8b 00             	mov    (%rax),%rax
+  803333:	e9 95 00 00 00       	jmp    8033cd <getuint+0xf5>
+  else if (lflag)
+  803338:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80333c:	74 48                	je     803386 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80333e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803342:	8b 00                	mov    (%rax),%eax
+  803344:	83 f8 2f             	cmp    $0x2f,%eax
+  803347:	77 24                	ja     80336d <getuint+0x95>
+  803349:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80334d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803351:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803355:	8b 00                	mov    (%rax),%eax
+  803357:	89 c0                	mov    %eax,%eax
+  803359:	48 01 d0             	add    %rdx,%rax
+  80335c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803360:	8b 12                	mov    (%rdx),%edx
+  803362:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803365:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803369:	89 0a                	mov    %ecx,(%rdx)
+  80336b:	eb 14                	jmp    803381 <getuint+0xa9>
+  80336d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803371:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803375:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803379:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80337d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803381:	48 8b 00             	mov    (%rax),%rax
+  803384:	eb 47                	jmp    8033cd <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803386:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338a:	8b 00                	mov    (%rax),%eax
+  80338c:	83 f8 2f             	cmp    $0x2f,%eax
+  80338f:	77 24                	ja     8033b5 <getuint+0xdd>
+  803391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803395:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803399:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339d:	8b 00                	mov    (%rax),%eax
+  80339f:	89 c0                	mov    %eax,%eax
+  8033a1:	48 01 d0             	add    %rdx,%rax
+  8033a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a8:	8b 12                	mov    (%rdx),%edx
+  8033aa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b1:	89 0a                	mov    %ecx,(%rdx)
+  8033b3:	eb 14                	jmp    8033c9 <getuint+0xf1>
+  8033b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033bd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033c9:	8b 00                	mov    (%rax),%eax
+  8033cb:	89 c0                	mov    %eax,%eax
+}
+  8033cd:	c9                   	leave
+  8033ce:	c3                   	ret
+
+00000000008033cf <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033cf:	55                   	push   %rbp
+  8033d0:	48 89 e5             	mov    %rsp,%rbp
+  8033d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033db:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033de:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033e2:	7e 4b                	jle    80342f <getint+0x60>
+    return va_arg(*ap, long long);
+  8033e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e8:	8b 00                	mov    (%rax),%eax
+  8033ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8033ed:	77 24                	ja     803413 <getint+0x44>
+  8033ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033fb:	8b 00                	mov    (%rax),%eax
+  8033fd:	89 c0                	mov    %eax,%eax
+  8033ff:	48 01 d0             	add    %rdx,%rax
+  803402:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803406:	8b 12                	mov    (%rdx),%edx
+  803408:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80340b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80340f:	89 0a                	mov    %ecx,(%rdx)
+  803411:	eb 14                	jmp    803427 <getint+0x58>
+  803413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803417:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80341b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80341f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803423:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803427:	48 8b 00             	mov    (%rax),%rax
+  80342a:	e9 95 00 00 00       	jmp    8034c4 <getint+0xf5>
+  else if (lflag)
+  80342f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803433:	74 48                	je     80347d <getint+0xae>
+    return va_arg(*ap, long);
+  803435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803439:	8b 00                	mov    (%rax),%eax
+  80343b:	83 f8 2f             	cmp    $0x2f,%eax
+  80343e:	77 24                	ja     803464 <getint+0x95>
+  803440:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803444:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344c:	8b 00                	mov    (%rax),%eax
+  80344e:	89 c0                	mov    %eax,%eax
+  803450:	48 01 d0             	add    %rdx,%rax
+  803453:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803457:	8b 12                	mov    (%rdx),%edx
+  803459:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80345c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803460:	89 0a                	mov    %ecx,(%rdx)
+  803462:	eb 14                	jmp    803478 <getint+0xa9>
+  803464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803468:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80346c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803470:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803474:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803478:	48 8b 00             	mov    (%rax),%rax
+  80347b:	eb 47                	jmp    8034c4 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80347d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803481:	8b 00                	mov    (%rax),%eax
+  803483:	83 f8 2f             	cmp    $0x2f,%eax
+  803486:	77 24                	ja     8034ac <getint+0xdd>
+  803488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803494:	8b 00                	mov    (%rax),%eax
+  803496:	89 c0                	mov    %eax,%eax
+  803498:	48 01 d0             	add    %rdx,%rax
+  80349b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349f:	8b 12                	mov    (%rdx),%edx
+  8034a1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034a8:	89 0a                	mov    %ecx,(%rdx)
+  8034aa:	eb 14                	jmp    8034c0 <getint+0xf1>
+  8034ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034b4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034bc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034c0:	8b 00                	mov    (%rax),%eax
+  8034c2:	48 98                	cltq
+}
+  8034c4:	c9                   	leave
+  8034c5:	c3                   	ret
+
+00000000008034c6 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034c6:	55                   	push   %rbp
+  8034c7:	48 89 e5             	mov    %rsp,%rbp
+  8034ca:	41 54                	push   %r12
+  8034cc:	53                   	push   %rbx
+  8034cd:	48 83 ec 60          	sub    $0x60,%rsp
+  8034d1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034d5:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034d9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034dd:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034e1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034e5:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034e9:	48 8b 06             	mov    (%rsi),%rax
+  8034ec:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034f0:	48 89 01             	mov    %rax,(%rcx)
+  8034f3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034f7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034fb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034ff:	eb 17                	jmp    803518 <vprintfmt+0x52>
+      if (ch == '\0')
+  803501:	85 db                	test   %ebx,%ebx
+  803503:	0f 84 bf 04 00 00    	je     8039c8 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  803509:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80350d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803511:	48 89 c6             	mov    %rax,%rsi
+  803514:	89 df                	mov    %ebx,%edi
+  803516:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803518:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80351c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803520:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803524:	0f b6 00             	movzbl (%rax),%eax
+  803527:	0f b6 d8             	movzbl %al,%ebx
+  80352a:	83 fb 25             	cmp    $0x25,%ebx
+  80352d:	75 d2                	jne    803501 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80352f:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803533:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80353a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803541:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803548:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80354f:	eb 04                	jmp    803555 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803551:	90                   	nop
+  803552:	eb 01                	jmp    803555 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803554:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803555:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803559:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80355d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803561:	0f b6 00             	movzbl (%rax),%eax
+  803564:	0f b6 d8             	movzbl %al,%ebx
+  803567:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80356a:	83 f8 55             	cmp    $0x55,%eax
+  80356d:	0f 87 22 04 00 00    	ja     803995 <vprintfmt+0x4cf>
+  803573:	89 c0                	mov    %eax,%eax
+  803575:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80357c:	00 
+  80357d:	48 b8 78 53 80 00 00 	movabs $0x805378,%rax
+  803584:	00 00 00 
+  803587:	48 01 d0             	add    %rdx,%rax
+  80358a:	48 8b 00             	mov    (%rax),%rax
+  80358d:	ff e0                	jmp    *%rax
+        padc = '-';
+  80358f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803593:	eb c0                	jmp    803555 <vprintfmt+0x8f>
+        padc = '0';
+  803595:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803599:	eb ba                	jmp    803555 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80359b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035a2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8035a5:	89 d0                	mov    %edx,%eax
+  8035a7:	c1 e0 02             	shl    $0x2,%eax
+  8035aa:	01 d0                	add    %edx,%eax
+  8035ac:	01 c0                	add    %eax,%eax
+  8035ae:	01 d8                	add    %ebx,%eax
+  8035b0:	83 e8 30             	sub    $0x30,%eax
+  8035b3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8035b6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035ba:	0f b6 00             	movzbl (%rax),%eax
+  8035bd:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035c0:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035c3:	7e 60                	jle    803625 <vprintfmt+0x15f>
+  8035c5:	83 fb 39             	cmp    $0x39,%ebx
+  8035c8:	7f 5b                	jg     803625 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035ca:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035cf:	eb d1                	jmp    8035a2 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8035d7:	77 17                	ja     8035f0 <vprintfmt+0x12a>
+  8035d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035dd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035e0:	89 d2                	mov    %edx,%edx
+  8035e2:	48 01 d0             	add    %rdx,%rax
+  8035e5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035e8:	83 c2 08             	add    $0x8,%edx
+  8035eb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035ee:	eb 0c                	jmp    8035fc <vprintfmt+0x136>
+  8035f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035f4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035f8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035fc:	8b 00                	mov    (%rax),%eax
+  8035fe:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  803601:	eb 23                	jmp    803626 <vprintfmt+0x160>
+        if (width < 0)
+  803603:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803607:	0f 89 44 ff ff ff    	jns    803551 <vprintfmt+0x8b>
+          width = 0;
+  80360d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803614:	e9 38 ff ff ff       	jmp    803551 <vprintfmt+0x8b>
+        altflag = 1;
+  803619:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803620:	e9 30 ff ff ff       	jmp    803555 <vprintfmt+0x8f>
+        goto process_precision;
+  803625:	90                   	nop
+        if (width < 0)
+  803626:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80362a:	0f 89 24 ff ff ff    	jns    803554 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803630:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803633:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803636:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80363d:	e9 12 ff ff ff       	jmp    803554 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803642:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803646:	e9 0a ff ff ff       	jmp    803555 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80364b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364e:	83 f8 2f             	cmp    $0x2f,%eax
+  803651:	77 17                	ja     80366a <vprintfmt+0x1a4>
+  803653:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803657:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80365a:	89 d2                	mov    %edx,%edx
+  80365c:	48 01 d0             	add    %rdx,%rax
+  80365f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803662:	83 c2 08             	add    $0x8,%edx
+  803665:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803668:	eb 0c                	jmp    803676 <vprintfmt+0x1b0>
+  80366a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80366e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803672:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803676:	8b 00                	mov    (%rax),%eax
+  803678:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80367c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803680:	48 89 d6             	mov    %rdx,%rsi
+  803683:	89 c7                	mov    %eax,%edi
+  803685:	ff d1                	call   *%rcx
+        break;
+  803687:	e9 37 03 00 00       	jmp    8039c3 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80368c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80368f:	83 f8 2f             	cmp    $0x2f,%eax
+  803692:	77 17                	ja     8036ab <vprintfmt+0x1e5>
+  803694:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803698:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80369b:	89 d2                	mov    %edx,%edx
+  80369d:	48 01 d0             	add    %rdx,%rax
+  8036a0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036a3:	83 c2 08             	add    $0x8,%edx
+  8036a6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036a9:	eb 0c                	jmp    8036b7 <vprintfmt+0x1f1>
+  8036ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036af:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036b3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036b7:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8036b9:	85 db                	test   %ebx,%ebx
+  8036bb:	79 02                	jns    8036bf <vprintfmt+0x1f9>
+          err = -err;
+  8036bd:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8036bf:	83 fb 15             	cmp    $0x15,%ebx
+  8036c2:	7f 16                	jg     8036da <vprintfmt+0x214>
+  8036c4:	48 ba a0 52 80 00 00 	movabs $0x8052a0,%rdx
+  8036cb:	00 00 00 
+  8036ce:	48 63 c3             	movslq %ebx,%rax
+  8036d1:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036d5:	4d 85 e4             	test   %r12,%r12
+  8036d8:	75 2e                	jne    803708 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036da:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036de:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036e2:	89 d9                	mov    %ebx,%ecx
+  8036e4:	48 ba 61 53 80 00 00 	movabs $0x805361,%rdx
+  8036eb:	00 00 00 
+  8036ee:	48 89 c7             	mov    %rax,%rdi
+  8036f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f6:	49 b8 d2 39 80 00 00 	movabs $0x8039d2,%r8
+  8036fd:	00 00 00 
+  803700:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803703:	e9 bb 02 00 00       	jmp    8039c3 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  803708:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80370c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803710:	4c 89 e1             	mov    %r12,%rcx
+  803713:	48 ba 6a 53 80 00 00 	movabs $0x80536a,%rdx
+  80371a:	00 00 00 
+  80371d:	48 89 c7             	mov    %rax,%rdi
+  803720:	b8 00 00 00 00       	mov    $0x0,%eax
+  803725:	49 b8 d2 39 80 00 00 	movabs $0x8039d2,%r8
+  80372c:	00 00 00 
+  80372f:	41 ff d0             	call   *%r8
+        break;
+  803732:	e9 8c 02 00 00       	jmp    8039c3 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80373a:	83 f8 2f             	cmp    $0x2f,%eax
+  80373d:	77 17                	ja     803756 <vprintfmt+0x290>
+  80373f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803743:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803746:	89 d2                	mov    %edx,%edx
+  803748:	48 01 d0             	add    %rdx,%rax
+  80374b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80374e:	83 c2 08             	add    $0x8,%edx
+  803751:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803754:	eb 0c                	jmp    803762 <vprintfmt+0x29c>
+  803756:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80375a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80375e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803762:	4c 8b 20             	mov    (%rax),%r12
+  803765:	4d 85 e4             	test   %r12,%r12
+  803768:	75 0a                	jne    803774 <vprintfmt+0x2ae>
+          p = "(null)";
+  80376a:	49 bc 6d 53 80 00 00 	movabs $0x80536d,%r12
+  803771:	00 00 00 
+        if (width > 0 && padc != '-')
+  803774:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803778:	7e 78                	jle    8037f2 <vprintfmt+0x32c>
+  80377a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80377e:	74 72                	je     8037f2 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803780:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803783:	48 98                	cltq
+  803785:	48 89 c6             	mov    %rax,%rsi
+  803788:	4c 89 e7             	mov    %r12,%rdi
+  80378b:	48 b8 de 40 80 00 00 	movabs $0x8040de,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+  803797:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80379a:	eb 17                	jmp    8037b3 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80379c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8037a0:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8037a4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8037a8:	48 89 d6             	mov    %rdx,%rsi
+  8037ab:	89 c7                	mov    %eax,%edi
+  8037ad:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037af:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037b7:	7f e3                	jg     80379c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037b9:	eb 37                	jmp    8037f2 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8037bb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8037bf:	74 1e                	je     8037df <vprintfmt+0x319>
+  8037c1:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037c4:	7e 05                	jle    8037cb <vprintfmt+0x305>
+  8037c6:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037c9:	7e 14                	jle    8037df <vprintfmt+0x319>
+            putch('?', putdat);
+  8037cb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037cf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037d3:	48 89 c6             	mov    %rax,%rsi
+  8037d6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037db:	ff d2                	call   *%rdx
+  8037dd:	eb 0f                	jmp    8037ee <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037df:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037e3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037e7:	48 89 c6             	mov    %rax,%rsi
+  8037ea:	89 df                	mov    %ebx,%edi
+  8037ec:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037ee:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037f2:	4c 89 e0             	mov    %r12,%rax
+  8037f5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037f9:	0f b6 00             	movzbl (%rax),%eax
+  8037fc:	0f be d8             	movsbl %al,%ebx
+  8037ff:	85 db                	test   %ebx,%ebx
+  803801:	74 28                	je     80382b <vprintfmt+0x365>
+  803803:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803807:	78 b2                	js     8037bb <vprintfmt+0x2f5>
+  803809:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80380d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803811:	79 a8                	jns    8037bb <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803813:	eb 16                	jmp    80382b <vprintfmt+0x365>
+          putch(' ', putdat);
+  803815:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803819:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80381d:	48 89 c6             	mov    %rax,%rsi
+  803820:	bf 20 00 00 00       	mov    $0x20,%edi
+  803825:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803827:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80382b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80382f:	7f e4                	jg     803815 <vprintfmt+0x34f>
+        break;
+  803831:	e9 8d 01 00 00       	jmp    8039c3 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803836:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803839:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80383d:	89 d6                	mov    %edx,%esi
+  80383f:	48 89 c7             	mov    %rax,%rdi
+  803842:	48 b8 cf 33 80 00 00 	movabs $0x8033cf,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+  80384e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803856:	48 85 c0             	test   %rax,%rax
+  803859:	79 1d                	jns    803878 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80385b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80385f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803863:	48 89 c6             	mov    %rax,%rsi
+  803866:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80386b:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80386d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803871:	48 f7 d8             	neg    %rax
+  803874:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803878:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80387f:	e9 d2 00 00 00       	jmp    803956 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803884:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803887:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80388b:	89 d6                	mov    %edx,%esi
+  80388d:	48 89 c7             	mov    %rax,%rdi
+  803890:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8038a0:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038a7:	e9 aa 00 00 00       	jmp    803956 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8038ac:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038af:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038b3:	89 d6                	mov    %edx,%esi
+  8038b5:	48 89 c7             	mov    %rax,%rdi
+  8038b8:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+  8038c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038c8:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038cf:	e9 82 00 00 00       	jmp    803956 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038d8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038dc:	48 89 c6             	mov    %rax,%rsi
+  8038df:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038e4:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038e6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038ea:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038ee:	48 89 c6             	mov    %rax,%rsi
+  8038f1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038f6:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8038fe:	77 17                	ja     803917 <vprintfmt+0x451>
+  803900:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803904:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803907:	89 d2                	mov    %edx,%edx
+  803909:	48 01 d0             	add    %rdx,%rax
+  80390c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80390f:	83 c2 08             	add    $0x8,%edx
+  803912:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803915:	eb 0c                	jmp    803923 <vprintfmt+0x45d>
+  803917:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80391b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80391f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803923:	48 8b 00             	mov    (%rax),%rax
+  803926:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80392a:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803931:	eb 23                	jmp    803956 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803933:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803936:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80393a:	89 d6                	mov    %edx,%esi
+  80393c:	48 89 c7             	mov    %rax,%rdi
+  80393f:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  803946:	00 00 00 
+  803949:	ff d0                	call   *%rax
+  80394b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80394f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803956:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80395b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80395e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803961:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803965:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803969:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80396d:	45 89 c1             	mov    %r8d,%r9d
+  803970:	41 89 f8             	mov    %edi,%r8d
+  803973:	48 89 c7             	mov    %rax,%rdi
+  803976:	48 b8 20 32 80 00 00 	movabs $0x803220,%rax
+  80397d:	00 00 00 
+  803980:	ff d0                	call   *%rax
+        break;
+  803982:	eb 3f                	jmp    8039c3 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803984:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803988:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80398c:	48 89 c6             	mov    %rax,%rsi
+  80398f:	89 df                	mov    %ebx,%edi
+  803991:	ff d2                	call   *%rdx
+        break;
+  803993:	eb 2e                	jmp    8039c3 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803995:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803999:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80399d:	48 89 c6             	mov    %rax,%rsi
+  8039a0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039a5:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8039a7:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039ac:	eb 05                	jmp    8039b3 <vprintfmt+0x4ed>
+  8039ae:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8039b3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8039b7:	48 83 e8 01          	sub    $0x1,%rax
+  8039bb:	0f b6 00             	movzbl (%rax),%eax
+  8039be:	3c 25                	cmp    $0x25,%al
+  8039c0:	75 ec                	jne    8039ae <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039c2:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039c3:	e9 50 fb ff ff       	jmp    803518 <vprintfmt+0x52>
+        return;
+  8039c8:	90                   	nop
+    }
+  }
+}
+  8039c9:	48 83 c4 60          	add    $0x60,%rsp
+  8039cd:	5b                   	pop    %rbx
+  8039ce:	41 5c                	pop    %r12
+  8039d0:	5d                   	pop    %rbp
+  8039d1:	c3                   	ret
+
+00000000008039d2 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039d2:	55                   	push   %rbp
+  8039d3:	48 89 e5             	mov    %rsp,%rbp
+  8039d6:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039dd:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039e4:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039eb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039f2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039f9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803a00:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a07:	84 c0                	test   %al,%al
+  803a09:	74 20                	je     803a2b <printfmt+0x59>
+  803a0b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a0f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a13:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a17:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a1b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a1f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a23:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a27:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a2b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a32:	00 00 00 
+  803a35:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a3c:	00 00 00 
+  803a3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a43:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a4a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a51:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a58:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a5f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a66:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a6d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a74:	48 89 c7             	mov    %rax,%rdi
+  803a77:	48 b8 c6 34 80 00 00 	movabs $0x8034c6,%rax
+  803a7e:	00 00 00 
+  803a81:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a83:	90                   	nop
+  803a84:	c9                   	leave
+  803a85:	c3                   	ret
+
+0000000000803a86 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a86:	55                   	push   %rbp
+  803a87:	48 89 e5             	mov    %rsp,%rbp
+  803a8a:	48 83 ec 10          	sub    $0x10,%rsp
+  803a8e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a91:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a99:	8b 40 10             	mov    0x10(%rax),%eax
+  803a9c:	8d 50 01             	lea    0x1(%rax),%edx
+  803a9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa3:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803aa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aaa:	48 8b 10             	mov    (%rax),%rdx
+  803aad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ab5:	48 39 c2             	cmp    %rax,%rdx
+  803ab8:	73 17                	jae    803ad1 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803aba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803abe:	48 8b 00             	mov    (%rax),%rax
+  803ac1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803ac5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ac9:	48 89 0a             	mov    %rcx,(%rdx)
+  803acc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803acf:	88 10                	mov    %dl,(%rax)
+}
+  803ad1:	90                   	nop
+  803ad2:	c9                   	leave
+  803ad3:	c3                   	ret
+
+0000000000803ad4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ad4:	55                   	push   %rbp
+  803ad5:	48 89 e5             	mov    %rsp,%rbp
+  803ad8:	48 83 ec 40          	sub    $0x40,%rsp
+  803adc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ae0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ae3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ae7:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803aeb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803af3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803af6:	48 98                	cltq
+  803af8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803afc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b00:	48 01 d0             	add    %rdx,%rax
+  803b03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b07:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b0e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b13:	74 06                	je     803b1b <vsnprintf+0x47>
+  803b15:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b19:	7f 07                	jg     803b22 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b20:	eb 32                	jmp    803b54 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b22:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b26:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b2a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b2e:	48 89 c6             	mov    %rax,%rsi
+  803b31:	48 b8 86 3a 80 00 00 	movabs $0x803a86,%rax
+  803b38:	00 00 00 
+  803b3b:	48 89 c7             	mov    %rax,%rdi
+  803b3e:	48 b8 c6 34 80 00 00 	movabs $0x8034c6,%rax
+  803b45:	00 00 00 
+  803b48:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b4e:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b51:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b54:	c9                   	leave
+  803b55:	c3                   	ret
+
+0000000000803b56 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b56:	55                   	push   %rbp
+  803b57:	48 89 e5             	mov    %rsp,%rbp
+  803b5a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b61:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b68:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b6e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b75:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b7c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b83:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b8a:	84 c0                	test   %al,%al
+  803b8c:	74 20                	je     803bae <snprintf+0x58>
+  803b8e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b92:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b96:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b9a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b9e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803ba2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803ba6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803baa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803bae:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803bb5:	00 00 00 
+  803bb8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803bbf:	00 00 00 
+  803bc2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803bc6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bcd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bd4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bdb:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803be2:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803be9:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bef:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bf6:	48 89 c7             	mov    %rax,%rdi
+  803bf9:	48 b8 d4 3a 80 00 00 	movabs $0x803ad4,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+  803c05:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c0b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c11:	c9                   	leave
+  803c12:	c3                   	ret
+
+0000000000803c13 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c13:	55                   	push   %rbp
+  803c14:	48 89 e5             	mov    %rsp,%rbp
+  803c17:	53                   	push   %rbx
+  803c18:	48 83 ec 38          	sub    $0x38,%rsp
+  803c1c:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c1f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c23:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c27:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c2b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c2f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c37:	89 d1                	mov    %edx,%ecx
+  803c39:	0f a2                	cpuid
+  803c3b:	89 de                	mov    %ebx,%esi
+  803c3d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c40:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c43:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c46:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c49:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c4e:	74 09                	je     803c59 <cpuid+0x46>
+}
+  803c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c54:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c57:	89 10                	mov    %edx,(%rax)
+
+  803c59:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c5e:	74 09                	je     803c69 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c64:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c67:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c69:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c6e:	74 09                	je     803c79 <cpuid+0x66>
+char *
+  803c70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c74:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c77:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c79:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c7e:	74 09                	je     803c89 <cpuid+0x76>
+  for (; *s; s++)
+  803c80:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c84:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c87:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c89:	90                   	nop
+  803c8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c8e:	c9                   	leave
+  803c8f:	c3                   	ret
+
+0000000000803c90 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c90:	55                   	push   %rbp
+  803c91:	48 89 e5             	mov    %rsp,%rbp
+  803c94:	48 83 ec 18          	sub    $0x18,%rsp
+  803c98:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c9e:	89 c1                	mov    %eax,%ecx
+  803ca0:	0f 01 d0             	xgetbv
+  803ca3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ca6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803ca9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cac:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803caf:	48 c1 e2 20          	shl    $0x20,%rdx
+  803cb3:	48 09 d0             	or     %rdx,%rax
+#else
+  803cb6:	c9                   	leave
+  803cb7:	c3                   	ret
+
+0000000000803cb8 <string_cpu>:
+string_cpu(void) {
+  803cb8:	55                   	push   %rbp
+  803cb9:	48 89 e5             	mov    %rsp,%rbp
+  803cbc:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803cc0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803cc7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cce:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cd5:	00 00 00 
+  803cd8:	8b 00                	mov    (%rax),%eax
+  803cda:	85 c0                	test   %eax,%eax
+  803cdc:	78 11                	js     803cef <string_cpu+0x37>
+    return string_features;
+  803cde:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803ce5:	00 00 00 
+  803ce8:	8b 00                	mov    (%rax),%eax
+  803cea:	e9 df 00 00 00       	jmp    803dce <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803cef:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cf3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d03:	48 89 c6             	mov    %rax,%rsi
+  803d06:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d0b:	48 b8 13 3c 80 00 00 	movabs $0x803c13,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d1a:	83 f8 06             	cmp    $0x6,%eax
+  803d1d:	76 28                	jbe    803d47 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d1f:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d23:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d2e:	48 89 c2             	mov    %rax,%rdx
+  803d31:	be 00 00 00 00       	mov    $0x0,%esi
+  803d36:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d3b:	48 b8 13 3c 80 00 00 	movabs $0x803c13,%rax
+  803d42:	00 00 00 
+  803d45:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d4a:	25 00 02 00 00       	and    $0x200,%eax
+  803d4f:	85 c0                	test   %eax,%eax
+  803d51:	74 04                	je     803d57 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d53:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d57:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d61:	48 89 c1             	mov    %rax,%rcx
+  803d64:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d69:	be 00 00 00 00       	mov    $0x0,%esi
+  803d6e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d73:	48 b8 13 3c 80 00 00 	movabs $0x803c13,%rax
+  803d7a:	00 00 00 
+  803d7d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d7f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d82:	83 e0 20             	and    $0x20,%eax
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	74 2a                	je     803db3 <string_cpu+0xfb>
+  803d89:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d8c:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d91:	85 c0                	test   %eax,%eax
+  803d93:	74 1e                	je     803db3 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9a:	48 b8 90 3c 80 00 00 	movabs $0x803c90,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+  803da6:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803da9:	48 83 f8 06          	cmp    $0x6,%rax
+  803dad:	75 04                	jne    803db3 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803daf:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803db3:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803dba:	00 00 00 
+  803dbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dc0:	89 02                	mov    %eax,(%rdx)
+  803dc2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803dc9:	00 00 00 
+  803dcc:	8b 00                	mov    (%rax),%eax
+}
+  803dce:	c9                   	leave
+  803dcf:	c3                   	ret
+
+0000000000803dd0 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803dd0:	55                   	push   %rbp
+  803dd1:	48 89 e5             	mov    %rsp,%rbp
+  803dd4:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803dd8:	48 83 ec 60          	sub    $0x60,%rsp
+  803ddc:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803de1:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803de6:	83 e0 1f             	and    $0x1f,%eax
+  803de9:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803ded:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803df1:	48 f7 d8             	neg    %rax
+  803df4:	48 89 c2             	mov    %rax,%rdx
+  803df7:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dfc:	48 01 d0             	add    %rdx,%rax
+  803dff:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e04:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e08:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e0e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e13:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e17:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e1d:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e21:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e25:	89 c2                	mov    %eax,%edx
+  803e27:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e2b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e30:	89 c1                	mov    %eax,%ecx
+  803e32:	d3 e6                	shl    %cl,%esi
+  803e34:	89 f0                	mov    %esi,%eax
+  803e36:	21 d0                	and    %edx,%eax
+  803e38:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e3c:	eb 21                	jmp    803e5f <strlen_avx2+0x8f>
+    p += 32;
+  803e3e:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e44:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e49:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e4d:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e53:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e57:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e5b:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e5f:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e64:	74 d8                	je     803e3e <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e66:	31 c0                	xor    %eax,%eax
+  803e68:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e6e:	48 63 d0             	movslq %eax,%rdx
+  803e71:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e76:	48 01 d0             	add    %rdx,%rax
+  803e79:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e7e:	c9                   	leave
+  803e7f:	c3                   	ret
+
+0000000000803e80 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e80:	55                   	push   %rbp
+  803e81:	48 89 e5             	mov    %rsp,%rbp
+  803e84:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e88:	48 83 ec 40          	sub    $0x40,%rsp
+  803e8c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e91:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e96:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e9b:	eb 77                	jmp    803f14 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e9d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ea2:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ea6:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803eaa:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803eaf:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803eb3:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803eb7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803ebb:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803ebf:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ec4:	74 3c                	je     803f02 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803ec6:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eca:	f7 d0                	not    %eax
+  803ecc:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803ed0:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803ed4:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803ed8:	48 63 d0             	movslq %eax,%rdx
+  803edb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ee0:	48 01 d0             	add    %rdx,%rax
+  803ee3:	0f b6 00             	movzbl (%rax),%eax
+  803ee6:	0f b6 c0             	movzbl %al,%eax
+  803ee9:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803eed:	48 63 ca             	movslq %edx,%rcx
+  803ef0:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ef5:	48 01 ca             	add    %rcx,%rdx
+  803ef8:	0f b6 12             	movzbl (%rdx),%edx
+  803efb:	0f b6 d2             	movzbl %dl,%edx
+  803efe:	29 d0                	sub    %edx,%eax
+  803f00:	eb 6b                	jmp    803f6d <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f02:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f08:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f0e:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f14:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f1a:	77 81                	ja     803e9d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f1c:	eb 42                	jmp    803f60 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f1e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f23:	0f b6 10             	movzbl (%rax),%edx
+  803f26:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f2b:	0f b6 00             	movzbl (%rax),%eax
+  803f2e:	38 c2                	cmp    %al,%dl
+  803f30:	74 1c                	je     803f4e <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f32:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f37:	0f b6 00             	movzbl (%rax),%eax
+  803f3a:	0f b6 c8             	movzbl %al,%ecx
+  803f3d:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f42:	0f b6 00             	movzbl (%rax),%eax
+  803f45:	0f b6 d0             	movzbl %al,%edx
+  803f48:	89 c8                	mov    %ecx,%eax
+  803f4a:	29 d0                	sub    %edx,%eax
+  803f4c:	eb 1f                	jmp    803f6d <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f4e:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f54:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f5a:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f60:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f66:	75 b6                	jne    803f1e <memcmp_avx2+0x9e>
+  return 0;
+  803f68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f6d:	c9                   	leave
+  803f6e:	c3                   	ret
+
+0000000000803f6f <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f6f:	55                   	push   %rbp
+  803f70:	48 89 e5             	mov    %rsp,%rbp
+  803f73:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f77:	48 83 ec 60          	sub    $0x60,%rsp
+  803f7b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f80:	89 f0                	mov    %esi,%eax
+  803f82:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f87:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f8b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f90:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f94:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f99:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f9f:	eb 47                	jmp    803fe8 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803fa1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fa6:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803faa:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803fae:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803fb4:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803fb8:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803fbc:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fc0:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fc5:	74 15                	je     803fdc <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fc7:	31 c0                	xor    %eax,%eax
+  803fc9:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803fcf:	48 63 d0             	movslq %eax,%rdx
+  803fd2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fd7:	48 01 d0             	add    %rdx,%rax
+  803fda:	eb 3d                	jmp    804019 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fdc:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fe2:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fe8:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fee:	77 b1                	ja     803fa1 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803ff0:	eb 0c                	jmp    803ffe <memfind_avx2+0x8f>
+  803ff2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803ff8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803ffe:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804004:	74 0e                	je     804014 <memfind_avx2+0xa5>
+  804006:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80400b:	0f b6 00             	movzbl (%rax),%eax
+  80400e:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804012:	75 de                	jne    803ff2 <memfind_avx2+0x83>
+  return s;
+  804014:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  804019:	c9                   	leave
+  80401a:	c3                   	ret
+
+000000000080401b <strlen>:
+strlen(const char *s) {
+  80401b:	55                   	push   %rbp
+  80401c:	48 89 e5             	mov    %rsp,%rbp
+  80401f:	48 83 ec 40          	sub    $0x40,%rsp
+  804023:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804027:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80402b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80402f:	48 b8 b8 3c 80 00 00 	movabs $0x803cb8,%rax
+  804036:	00 00 00 
+  804039:	ff d0                	call   *%rax
+  80403b:	83 e0 02             	and    $0x2,%eax
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	74 18                	je     80405a <strlen+0x3f>
+    return strlen_avx2(s);
+  804042:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804046:	48 89 c7             	mov    %rax,%rdi
+  804049:	48 b8 d0 3d 80 00 00 	movabs $0x803dd0,%rax
+  804050:	00 00 00 
+  804053:	ff d0                	call   *%rax
+  804055:	e9 82 00 00 00       	jmp    8040dc <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80405a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405e:	83 e0 0f             	and    $0xf,%eax
+  804061:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804064:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804067:	48 f7 d8             	neg    %rax
+  80406a:	48 89 c2             	mov    %rax,%rdx
+  80406d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804071:	48 01 d0             	add    %rdx,%rax
+  804074:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804078:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80407c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804080:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804085:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804089:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80408d:	89 c2                	mov    %eax,%edx
+  80408f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804092:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804097:	89 c1                	mov    %eax,%ecx
+  804099:	d3 e6                	shl    %cl,%esi
+  80409b:	89 f0                	mov    %esi,%eax
+  80409d:	21 d0                	and    %edx,%eax
+  80409f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040a2:	eb 1d                	jmp    8040c1 <strlen+0xa6>
+    p += 16;
+  8040a4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8040a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040ad:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040b1:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040b6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040ba:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040c5:	74 dd                	je     8040a4 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040c7:	31 c0                	xor    %eax,%eax
+  8040c9:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040ce:	48 63 d0             	movslq %eax,%rdx
+  8040d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d5:	48 01 d0             	add    %rdx,%rax
+  8040d8:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040dc:	c9                   	leave
+  8040dd:	c3                   	ret
+
+00000000008040de <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040de:	55                   	push   %rbp
+  8040df:	48 89 e5             	mov    %rsp,%rbp
+  8040e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8040e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040ee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040f5:	eb 0e                	jmp    804105 <strnlen+0x27>
+    n++;
+  8040f7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040fb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804100:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804105:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80410a:	74 0b                	je     804117 <strnlen+0x39>
+  80410c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804110:	0f b6 00             	movzbl (%rax),%eax
+  804113:	84 c0                	test   %al,%al
+  804115:	75 e0                	jne    8040f7 <strnlen+0x19>
+  return n;
+  804117:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80411a:	c9                   	leave
+  80411b:	c3                   	ret
+
+000000000080411c <strcpy>:
+strcpy(char *dst, const char *src) {
+  80411c:	55                   	push   %rbp
+  80411d:	48 89 e5             	mov    %rsp,%rbp
+  804120:	48 83 ec 20          	sub    $0x20,%rsp
+  804124:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804128:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80412c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804130:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804134:	90                   	nop
+  804135:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804139:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80413d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804145:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804149:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80414d:	0f b6 12             	movzbl (%rdx),%edx
+  804150:	88 10                	mov    %dl,(%rax)
+  804152:	0f b6 00             	movzbl (%rax),%eax
+  804155:	84 c0                	test   %al,%al
+  804157:	75 dc                	jne    804135 <strcpy+0x19>
+  return ret;
+  804159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80415d:	c9                   	leave
+  80415e:	c3                   	ret
+
+000000000080415f <strcat>:
+strcat(char *dst, const char *src) {
+  80415f:	55                   	push   %rbp
+  804160:	48 89 e5             	mov    %rsp,%rbp
+  804163:	48 83 ec 20          	sub    $0x20,%rsp
+  804167:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80416b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80416f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804173:	48 89 c7             	mov    %rax,%rdi
+  804176:	48 b8 1b 40 80 00 00 	movabs $0x80401b,%rax
+  80417d:	00 00 00 
+  804180:	ff d0                	call   *%rax
+  804182:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804188:	48 63 d0             	movslq %eax,%rdx
+  80418b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418f:	48 01 c2             	add    %rax,%rdx
+  804192:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804196:	48 89 c6             	mov    %rax,%rsi
+  804199:	48 89 d7             	mov    %rdx,%rdi
+  80419c:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  return dst;
+  8041a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8041ac:	c9                   	leave
+  8041ad:	c3                   	ret
+
+00000000008041ae <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8041ae:	55                   	push   %rbp
+  8041af:	48 89 e5             	mov    %rsp,%rbp
+  8041b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8041b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041be:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041ca:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041d1:	00 
+  8041d2:	eb 2a                	jmp    8041fe <strncpy+0x50>
+    *dst++ = *src;
+  8041d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041e4:	0f b6 12             	movzbl (%rdx),%edx
+  8041e7:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ed:	0f b6 00             	movzbl (%rax),%eax
+  8041f0:	84 c0                	test   %al,%al
+  8041f2:	74 05                	je     8041f9 <strncpy+0x4b>
+      src++;
+  8041f4:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041f9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804202:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804206:	72 cc                	jb     8041d4 <strncpy+0x26>
+  return ret;
+  804208:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80420c:	c9                   	leave
+  80420d:	c3                   	ret
+
+000000000080420e <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80420e:	55                   	push   %rbp
+  80420f:	48 89 e5             	mov    %rsp,%rbp
+  804212:	48 83 ec 28          	sub    $0x28,%rsp
+  804216:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80421a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80421e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804222:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804226:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80422a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80422f:	74 3d                	je     80426e <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804231:	eb 1d                	jmp    804250 <strlcpy+0x42>
+      *dst++ = *src++;
+  804233:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804237:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80423b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80423f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804243:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804247:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80424b:	0f b6 12             	movzbl (%rdx),%edx
+  80424e:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804250:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804255:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80425a:	74 0b                	je     804267 <strlcpy+0x59>
+  80425c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804260:	0f b6 00             	movzbl (%rax),%eax
+  804263:	84 c0                	test   %al,%al
+  804265:	75 cc                	jne    804233 <strlcpy+0x25>
+    *dst = '\0';
+  804267:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80426b:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80426e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804272:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804276:	c9                   	leave
+  804277:	c3                   	ret
+
+0000000000804278 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804278:	55                   	push   %rbp
+  804279:	48 89 e5             	mov    %rsp,%rbp
+  80427c:	48 83 ec 30          	sub    $0x30,%rsp
+  804280:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804284:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804288:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80428c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804290:	48 89 c7             	mov    %rax,%rdi
+  804293:	48 b8 1b 40 80 00 00 	movabs $0x80401b,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+  80429f:	48 98                	cltq
+  8042a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8042a5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ad:	48 89 d6             	mov    %rdx,%rsi
+  8042b0:	48 89 c7             	mov    %rax,%rdi
+  8042b3:	48 b8 de 40 80 00 00 	movabs $0x8040de,%rax
+  8042ba:	00 00 00 
+  8042bd:	ff d0                	call   *%rax
+  8042bf:	48 98                	cltq
+  8042c1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042c9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042cd:	75 10                	jne    8042df <strlcat+0x67>
+    return maxlen + srclen;
+  8042cf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d7:	48 01 d0             	add    %rdx,%rax
+  8042da:	e9 86 00 00 00       	jmp    804365 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042e3:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042e7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042eb:	73 2b                	jae    804318 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042f1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042f5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042fd:	48 01 c1             	add    %rax,%rcx
+  804300:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804304:	48 89 c6             	mov    %rax,%rsi
+  804307:	48 89 cf             	mov    %rcx,%rdi
+  80430a:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  804311:	00 00 00 
+  804314:	ff d0                	call   *%rax
+  804316:	eb 42                	jmp    80435a <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  804318:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80431c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804320:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804328:	48 01 c1             	add    %rax,%rcx
+  80432b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80432f:	48 89 c6             	mov    %rax,%rsi
+  804332:	48 89 cf             	mov    %rcx,%rdi
+  804335:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804341:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804345:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804349:	48 01 d0             	add    %rdx,%rax
+  80434c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804354:	48 01 d0             	add    %rdx,%rax
+  804357:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80435a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80435e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804362:	48 01 d0             	add    %rdx,%rax
+}
+  804365:	c9                   	leave
+  804366:	c3                   	ret
+
+0000000000804367 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804367:	55                   	push   %rbp
+  804368:	48 89 e5             	mov    %rsp,%rbp
+  80436b:	48 83 ec 10          	sub    $0x10,%rsp
+  80436f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804373:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804377:	eb 0a                	jmp    804383 <strcmp+0x1c>
+    p++, q++;
+  804379:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80437e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804387:	0f b6 00             	movzbl (%rax),%eax
+  80438a:	84 c0                	test   %al,%al
+  80438c:	74 12                	je     8043a0 <strcmp+0x39>
+  80438e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804392:	0f b6 10             	movzbl (%rax),%edx
+  804395:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804399:	0f b6 00             	movzbl (%rax),%eax
+  80439c:	38 c2                	cmp    %al,%dl
+  80439e:	74 d9                	je     804379 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8043a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043a4:	0f b6 00             	movzbl (%rax),%eax
+  8043a7:	0f b6 d0             	movzbl %al,%edx
+  8043aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ae:	0f b6 00             	movzbl (%rax),%eax
+  8043b1:	0f b6 c0             	movzbl %al,%eax
+  8043b4:	29 c2                	sub    %eax,%edx
+  8043b6:	89 d0                	mov    %edx,%eax
+}
+  8043b8:	c9                   	leave
+  8043b9:	c3                   	ret
+
+00000000008043ba <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8043ba:	55                   	push   %rbp
+  8043bb:	48 89 e5             	mov    %rsp,%rbp
+  8043be:	48 83 ec 18          	sub    $0x18,%rsp
+  8043c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043ca:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043ce:	eb 0f                	jmp    8043df <strncmp+0x25>
+    n--, p++, q++;
+  8043d0:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043d5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043da:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043df:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043e4:	74 1d                	je     804403 <strncmp+0x49>
+  8043e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ea:	0f b6 00             	movzbl (%rax),%eax
+  8043ed:	84 c0                	test   %al,%al
+  8043ef:	74 12                	je     804403 <strncmp+0x49>
+  8043f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f5:	0f b6 10             	movzbl (%rax),%edx
+  8043f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043fc:	0f b6 00             	movzbl (%rax),%eax
+  8043ff:	38 c2                	cmp    %al,%dl
+  804401:	74 cd                	je     8043d0 <strncmp+0x16>
+  if (n == 0)
+  804403:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804408:	75 07                	jne    804411 <strncmp+0x57>
+    return 0;
+  80440a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440f:	eb 16                	jmp    804427 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804411:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804415:	0f b6 00             	movzbl (%rax),%eax
+  804418:	0f b6 d0             	movzbl %al,%edx
+  80441b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441f:	0f b6 00             	movzbl (%rax),%eax
+  804422:	0f b6 c0             	movzbl %al,%eax
+  804425:	29 c2                	sub    %eax,%edx
+}
+  804427:	89 d0                	mov    %edx,%eax
+  804429:	c9                   	leave
+  80442a:	c3                   	ret
+
+000000000080442b <strchr>:
+strchr(const char *s, char c) {
+  80442b:	55                   	push   %rbp
+  80442c:	48 89 e5             	mov    %rsp,%rbp
+  80442f:	48 83 ec 60          	sub    $0x60,%rsp
+  804433:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804437:	89 f0                	mov    %esi,%eax
+  804439:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80443c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804440:	83 e0 0f             	and    $0xf,%eax
+  804443:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804446:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804449:	48 f7 d8             	neg    %rax
+  80444c:	48 89 c2             	mov    %rax,%rdx
+  80444f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804453:	48 01 d0             	add    %rdx,%rax
+  804456:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80445a:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80445e:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804462:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804466:	66 0f 6e c0          	movd   %eax,%xmm0
+  80446a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80446e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804472:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804477:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80447b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80447f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804483:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804487:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80448c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804491:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804495:	89 c2                	mov    %eax,%edx
+  804497:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80449c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044a1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044a5:	09 c2                	or     %eax,%edx
+  8044a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044aa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8044af:	89 c1                	mov    %eax,%ecx
+  8044b1:	d3 e6                	shl    %cl,%esi
+  8044b3:	89 f0                	mov    %esi,%eax
+  8044b5:	21 d0                	and    %edx,%eax
+  8044b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044ba:	eb 34                	jmp    8044f0 <strchr+0xc5>
+    p += 16;
+  8044bc:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044c5:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044c9:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044cd:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044d2:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044d7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044db:	89 c2                	mov    %eax,%edx
+  8044dd:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044e2:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044e7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044eb:	09 d0                	or     %edx,%eax
+  8044ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044f4:	74 c6                	je     8044bc <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044f6:	31 c0                	xor    %eax,%eax
+  8044f8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044fd:	48 98                	cltq
+  8044ff:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  804503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804507:	0f b6 00             	movzbl (%rax),%eax
+  80450a:	84 c0                	test   %al,%al
+  80450c:	74 06                	je     804514 <strchr+0xe9>
+  80450e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804512:	eb 05                	jmp    804519 <strchr+0xee>
+  804514:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804519:	c9                   	leave
+  80451a:	c3                   	ret
+
+000000000080451b <strfind>:
+strfind(const char *s, char c) {
+  80451b:	55                   	push   %rbp
+  80451c:	48 89 e5             	mov    %rsp,%rbp
+  80451f:	48 83 ec 10          	sub    $0x10,%rsp
+  804523:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804527:	89 f0                	mov    %esi,%eax
+  804529:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80452c:	eb 11                	jmp    80453f <strfind+0x24>
+    if (*s == c)
+  80452e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804532:	0f b6 00             	movzbl (%rax),%eax
+  804535:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804538:	74 12                	je     80454c <strfind+0x31>
+  for (; *s; s++)
+  80453a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80453f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804543:	0f b6 00             	movzbl (%rax),%eax
+  804546:	84 c0                	test   %al,%al
+  804548:	75 e4                	jne    80452e <strfind+0x13>
+  80454a:	eb 01                	jmp    80454d <strfind+0x32>
+      break;
+  80454c:	90                   	nop
+  return (char *)s;
+  80454d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804551:	c9                   	leave
+  804552:	c3                   	ret
+
+0000000000804553 <memset>:
+memset(void *v, int c, size_t n) {
+  804553:	55                   	push   %rbp
+  804554:	48 89 e5             	mov    %rsp,%rbp
+  804557:	48 83 ec 38          	sub    $0x38,%rsp
+  80455b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80455f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804562:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804566:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80456a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80456e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804573:	76 41                	jbe    8045b6 <memset+0x63>
+  804575:	48 b8 b8 3c 80 00 00 	movabs $0x803cb8,%rax
+  80457c:	00 00 00 
+  80457f:	ff d0                	call   *%rax
+  804581:	83 e0 01             	and    $0x1,%eax
+  804584:	85 c0                	test   %eax,%eax
+  804586:	74 2e                	je     8045b6 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804588:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80458b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80458f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804593:	48 89 ce             	mov    %rcx,%rsi
+  804596:	48 89 f7             	mov    %rsi,%rdi
+  804599:	48 89 d1             	mov    %rdx,%rcx
+  80459c:	fc                   	cld
+  80459d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80459f:	48 89 ca             	mov    %rcx,%rdx
+  8045a2:	48 89 fe             	mov    %rdi,%rsi
+  8045a5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8045a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8045ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045b1:	e9 a7 00 00 00       	jmp    80465d <memset+0x10a>
+  if (n >= 8) {
+  8045b6:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8045bb:	0f 86 87 00 00 00    	jbe    804648 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045c1:	eb 16                	jmp    8045d9 <memset+0x86>
+      *p++ = c;
+  8045c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045cb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045cf:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045d2:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045d4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045dd:	83 e0 07             	and    $0x7,%eax
+  8045e0:	48 85 c0             	test   %rax,%rax
+  8045e3:	75 de                	jne    8045c3 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045e5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045e8:	0f b6 c0             	movzbl %al,%eax
+  8045eb:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045f2:	01 01 01 
+  8045f5:	48 0f af c2          	imul   %rdx,%rax
+  8045f9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804601:	48 c1 e8 03          	shr    $0x3,%rax
+  804605:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  804609:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80460d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804611:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804615:	48 89 ce             	mov    %rcx,%rsi
+  804618:	48 89 f7             	mov    %rsi,%rdi
+  80461b:	48 89 d1             	mov    %rdx,%rcx
+  80461e:	fc                   	cld
+  80461f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804622:	48 89 ca             	mov    %rcx,%rdx
+  804625:	48 89 fe             	mov    %rdi,%rsi
+  804628:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80462c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804630:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804635:	eb 11                	jmp    804648 <memset+0xf5>
+    *p++ = c;
+  804637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80463b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80463f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804643:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804646:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804648:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80464c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804650:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804654:	48 85 c0             	test   %rax,%rax
+  804657:	75 de                	jne    804637 <memset+0xe4>
+  return v;
+  804659:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80465d:	c9                   	leave
+  80465e:	c3                   	ret
+
+000000000080465f <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80465f:	55                   	push   %rbp
+  804660:	48 89 e5             	mov    %rsp,%rbp
+  804663:	48 83 ec 38          	sub    $0x38,%rsp
+  804667:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80466b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80466f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804673:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804677:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80467b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80467f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804683:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804687:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80468b:	0f 83 da 00 00 00    	jae    80476b <memmove+0x10c>
+  804691:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804695:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804699:	48 01 d0             	add    %rdx,%rax
+  80469c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8046a0:	0f 83 c5 00 00 00    	jae    80476b <memmove+0x10c>
+    s += n;
+  8046a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046aa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8046ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046b2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8046b6:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8046bb:	0f 86 94 00 00 00    	jbe    804755 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046c1:	eb 1c                	jmp    8046df <memmove+0x80>
+        *--d = *--s;
+  8046c3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046c8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046d1:	0f b6 10             	movzbl (%rax),%edx
+  8046d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046d8:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046da:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e3:	83 e0 07             	and    $0x7,%eax
+  8046e6:	48 85 c0             	test   %rax,%rax
+  8046e9:	75 d8                	jne    8046c3 <memmove+0x64>
+      nq = n / 8;
+  8046eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ef:	48 c1 e8 03          	shr    $0x3,%rax
+  8046f3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046f7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046fc:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  804701:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  804706:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80470a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80470e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804712:	48 89 cf             	mov    %rcx,%rdi
+  804715:	48 89 d6             	mov    %rdx,%rsi
+  804718:	48 89 c1             	mov    %rax,%rcx
+  80471b:	fd                   	std
+  80471c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80471f:	fc                   	cld
+  804720:	48 89 c8             	mov    %rcx,%rax
+  804723:	48 89 f2             	mov    %rsi,%rdx
+  804726:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80472a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80472e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804732:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804737:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80473c:	eb 17                	jmp    804755 <memmove+0xf6>
+      *--d = *--s;
+  80473e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804743:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804748:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80474c:	0f b6 10             	movzbl (%rax),%edx
+  80474f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804753:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804755:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804759:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80475d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804761:	48 85 c0             	test   %rax,%rax
+  804764:	75 d8                	jne    80473e <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804766:	e9 f4 00 00 00       	jmp    80485f <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80476b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804770:	76 46                	jbe    8047b8 <memmove+0x159>
+  804772:	48 b8 b8 3c 80 00 00 	movabs $0x803cb8,%rax
+  804779:	00 00 00 
+  80477c:	ff d0                	call   *%rax
+  80477e:	83 e0 01             	and    $0x1,%eax
+  804781:	85 c0                	test   %eax,%eax
+  804783:	74 33                	je     8047b8 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804785:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804789:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80478d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804791:	48 89 cf             	mov    %rcx,%rdi
+  804794:	48 89 d6             	mov    %rdx,%rsi
+  804797:	48 89 c1             	mov    %rax,%rcx
+  80479a:	fc                   	cld
+  80479b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80479d:	48 89 c8             	mov    %rcx,%rax
+  8047a0:	48 89 f2             	mov    %rsi,%rdx
+  8047a3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8047a7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8047ab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8047af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047b3:	e9 ab 00 00 00       	jmp    804863 <memmove+0x204>
+    if (n >= 8) {
+  8047b8:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8047bd:	0f 86 8b 00 00 00    	jbe    80484e <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047c3:	eb 22                	jmp    8047e7 <memmove+0x188>
+        *d++ = *s++;
+  8047c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047c9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047d9:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047dd:	0f b6 12             	movzbl (%rdx),%edx
+  8047e0:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047e2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047eb:	83 e0 07             	and    $0x7,%eax
+  8047ee:	48 85 c0             	test   %rax,%rax
+  8047f1:	75 d2                	jne    8047c5 <memmove+0x166>
+      nq = n / 8;
+  8047f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047f7:	48 c1 e8 03          	shr    $0x3,%rax
+  8047fb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804803:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804807:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80480b:	48 89 cf             	mov    %rcx,%rdi
+  80480e:	48 89 d6             	mov    %rdx,%rsi
+  804811:	48 89 c1             	mov    %rax,%rcx
+  804814:	fc                   	cld
+  804815:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804818:	48 89 c8             	mov    %rcx,%rax
+  80481b:	48 89 f2             	mov    %rsi,%rdx
+  80481e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804822:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804826:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80482a:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80482f:	eb 1d                	jmp    80484e <memmove+0x1ef>
+      *d++ = *s++;
+  804831:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804835:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804839:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80483d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804841:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804845:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804849:	0f b6 12             	movzbl (%rdx),%edx
+  80484c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80484e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804852:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804856:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80485a:	48 85 c0             	test   %rax,%rax
+  80485d:	75 d2                	jne    804831 <memmove+0x1d2>
+  return dst;
+  80485f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804863:	c9                   	leave
+  804864:	c3                   	ret
+
+0000000000804865 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804865:	55                   	push   %rbp
+  804866:	48 89 e5             	mov    %rsp,%rbp
+  804869:	48 83 ec 18          	sub    $0x18,%rsp
+  80486d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804871:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804875:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804879:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80487d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804881:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804885:	48 89 ce             	mov    %rcx,%rsi
+  804888:	48 89 c7             	mov    %rax,%rdi
+  80488b:	48 b8 5f 46 80 00 00 	movabs $0x80465f,%rax
+  804892:	00 00 00 
+  804895:	ff d0                	call   *%rax
+}
+  804897:	c9                   	leave
+  804898:	c3                   	ret
+
+0000000000804899 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804899:	55                   	push   %rbp
+  80489a:	48 89 e5             	mov    %rsp,%rbp
+  80489d:	48 83 ec 40          	sub    $0x40,%rsp
+  8048a1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8048ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8048b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8048bd:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048c2:	0f 86 a7 00 00 00    	jbe    80496f <memcmp+0xd6>
+  8048c8:	48 b8 b8 3c 80 00 00 	movabs $0x803cb8,%rax
+  8048cf:	00 00 00 
+  8048d2:	ff d0                	call   *%rax
+  8048d4:	83 e0 02             	and    $0x2,%eax
+  8048d7:	85 c0                	test   %eax,%eax
+  8048d9:	0f 84 90 00 00 00    	je     80496f <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048df:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048e3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048eb:	48 89 ce             	mov    %rcx,%rsi
+  8048ee:	48 89 c7             	mov    %rax,%rdi
+  8048f1:	48 b8 80 3e 80 00 00 	movabs $0x803e80,%rax
+  8048f8:	00 00 00 
+  8048fb:	ff d0                	call   *%rax
+  8048fd:	e9 c2 00 00 00       	jmp    8049c4 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  804902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804906:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80490a:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80490e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804912:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804916:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80491a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80491e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804921:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804928:	74 36                	je     804960 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80492a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80492d:	f7 d0                	not    %eax
+  80492f:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804933:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804936:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804939:	48 63 d0             	movslq %eax,%rdx
+  80493c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804940:	48 01 d0             	add    %rdx,%rax
+  804943:	0f b6 00             	movzbl (%rax),%eax
+  804946:	0f b6 c0             	movzbl %al,%eax
+  804949:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80494c:	48 63 ca             	movslq %edx,%rcx
+  80494f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804953:	48 01 ca             	add    %rcx,%rdx
+  804956:	0f b6 12             	movzbl (%rdx),%edx
+  804959:	0f b6 d2             	movzbl %dl,%edx
+  80495c:	29 d0                	sub    %edx,%eax
+  80495e:	eb 64                	jmp    8049c4 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804960:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804965:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80496a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80496f:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804974:	77 8c                	ja     804902 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804976:	eb 36                	jmp    8049ae <memcmp+0x115>
+    if (*s1 != *s2)
+  804978:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80497c:	0f b6 10             	movzbl (%rax),%edx
+  80497f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804983:	0f b6 00             	movzbl (%rax),%eax
+  804986:	38 c2                	cmp    %al,%dl
+  804988:	74 1a                	je     8049a4 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80498a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80498e:	0f b6 00             	movzbl (%rax),%eax
+  804991:	0f b6 c8             	movzbl %al,%ecx
+  804994:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804998:	0f b6 00             	movzbl (%rax),%eax
+  80499b:	0f b6 d0             	movzbl %al,%edx
+  80499e:	89 c8                	mov    %ecx,%eax
+  8049a0:	29 d0                	sub    %edx,%eax
+  8049a2:	eb 20                	jmp    8049c4 <memcmp+0x12b>
+    s1++, s2++;
+  8049a4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8049a9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8049ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049b2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049b6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8049ba:	48 85 c0             	test   %rax,%rax
+  8049bd:	75 b9                	jne    804978 <memcmp+0xdf>
+  }
+
+  return 0;
+  8049bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049c4:	c9                   	leave
+  8049c5:	c3                   	ret
+
+00000000008049c6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049c6:	55                   	push   %rbp
+  8049c7:	48 89 e5             	mov    %rsp,%rbp
+  8049ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8049ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049d2:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049d5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049dd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049e1:	48 01 d0             	add    %rdx,%rax
+  8049e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049e8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049eb:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049ef:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049f3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049f7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049fc:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804a00:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a05:	76 73                	jbe    804a7a <memfind+0xb4>
+  804a07:	48 b8 b8 3c 80 00 00 	movabs $0x803cb8,%rax
+  804a0e:	00 00 00 
+  804a11:	ff d0                	call   *%rax
+  804a13:	83 e0 02             	and    $0x2,%eax
+  804a16:	85 c0                	test   %eax,%eax
+  804a18:	74 60                	je     804a7a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a1a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a1d:	0f b6 c8             	movzbl %al,%ecx
+  804a20:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a28:	89 ce                	mov    %ecx,%esi
+  804a2a:	48 89 c7             	mov    %rax,%rdi
+  804a2d:	48 b8 6f 3f 80 00 00 	movabs $0x803f6f,%rax
+  804a34:	00 00 00 
+  804a37:	ff d0                	call   *%rax
+  804a39:	eb 6c                	jmp    804aa7 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a3f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a43:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a47:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a4c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a50:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a54:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a57:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a5b:	74 13                	je     804a70 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a5d:	31 c0                	xor    %eax,%eax
+  804a5f:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a64:	48 63 d0             	movslq %eax,%rdx
+  804a67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a6b:	48 01 d0             	add    %rdx,%rax
+  804a6e:	eb 37                	jmp    804aa7 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a70:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a75:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a7a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a7f:	77 ba                	ja     804a3b <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a81:	eb 13                	jmp    804a96 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a87:	0f b6 00             	movzbl (%rax),%eax
+  804a8a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a8d:	38 d0                	cmp    %dl,%al
+  804a8f:	74 11                	je     804aa2 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a91:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a9a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a9e:	72 e3                	jb     804a83 <memfind+0xbd>
+  804aa0:	eb 01                	jmp    804aa3 <memfind+0xdd>
+      break;
+  804aa2:	90                   	nop
+  return (void *)s;
+  804aa3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804aa7:	c9                   	leave
+  804aa8:	c3                   	ret
+
+0000000000804aa9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804aa9:	55                   	push   %rbp
+  804aaa:	48 89 e5             	mov    %rsp,%rbp
+  804aad:	48 83 ec 38          	sub    $0x38,%rsp
+  804ab1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ab5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ab9:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804abc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804ac3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804aca:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804acb:	eb 05                	jmp    804ad2 <strtol+0x29>
+    s++;
+  804acd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ad2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ad6:	0f b6 00             	movzbl (%rax),%eax
+  804ad9:	3c 20                	cmp    $0x20,%al
+  804adb:	74 f0                	je     804acd <strtol+0x24>
+  804add:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ae1:	0f b6 00             	movzbl (%rax),%eax
+  804ae4:	3c 09                	cmp    $0x9,%al
+  804ae6:	74 e5                	je     804acd <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ae8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aec:	0f b6 00             	movzbl (%rax),%eax
+  804aef:	3c 2b                	cmp    $0x2b,%al
+  804af1:	75 07                	jne    804afa <strtol+0x51>
+    s++;
+  804af3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804af8:	eb 17                	jmp    804b11 <strtol+0x68>
+  else if (*s == '-')
+  804afa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804afe:	0f b6 00             	movzbl (%rax),%eax
+  804b01:	3c 2d                	cmp    $0x2d,%al
+  804b03:	75 0c                	jne    804b11 <strtol+0x68>
+    s++, neg = 1;
+  804b05:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b0a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b11:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b15:	74 06                	je     804b1d <strtol+0x74>
+  804b17:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b1b:	75 28                	jne    804b45 <strtol+0x9c>
+  804b1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b21:	0f b6 00             	movzbl (%rax),%eax
+  804b24:	3c 30                	cmp    $0x30,%al
+  804b26:	75 1d                	jne    804b45 <strtol+0x9c>
+  804b28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2c:	48 83 c0 01          	add    $0x1,%rax
+  804b30:	0f b6 00             	movzbl (%rax),%eax
+  804b33:	3c 78                	cmp    $0x78,%al
+  804b35:	75 0e                	jne    804b45 <strtol+0x9c>
+    s += 2, base = 16;
+  804b37:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b3c:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b43:	eb 2c                	jmp    804b71 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b45:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b49:	75 19                	jne    804b64 <strtol+0xbb>
+  804b4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b4f:	0f b6 00             	movzbl (%rax),%eax
+  804b52:	3c 30                	cmp    $0x30,%al
+  804b54:	75 0e                	jne    804b64 <strtol+0xbb>
+    s++, base = 8;
+  804b56:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b5b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b62:	eb 0d                	jmp    804b71 <strtol+0xc8>
+  else if (base == 0)
+  804b64:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b68:	75 07                	jne    804b71 <strtol+0xc8>
+    base = 10;
+  804b6a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b75:	0f b6 00             	movzbl (%rax),%eax
+  804b78:	3c 2f                	cmp    $0x2f,%al
+  804b7a:	7e 1d                	jle    804b99 <strtol+0xf0>
+  804b7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b80:	0f b6 00             	movzbl (%rax),%eax
+  804b83:	3c 39                	cmp    $0x39,%al
+  804b85:	7f 12                	jg     804b99 <strtol+0xf0>
+      dig = *s - '0';
+  804b87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8b:	0f b6 00             	movzbl (%rax),%eax
+  804b8e:	0f be c0             	movsbl %al,%eax
+  804b91:	83 e8 30             	sub    $0x30,%eax
+  804b94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b97:	eb 4e                	jmp    804be7 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b9d:	0f b6 00             	movzbl (%rax),%eax
+  804ba0:	3c 60                	cmp    $0x60,%al
+  804ba2:	7e 1d                	jle    804bc1 <strtol+0x118>
+  804ba4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba8:	0f b6 00             	movzbl (%rax),%eax
+  804bab:	3c 7a                	cmp    $0x7a,%al
+  804bad:	7f 12                	jg     804bc1 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804baf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb3:	0f b6 00             	movzbl (%rax),%eax
+  804bb6:	0f be c0             	movsbl %al,%eax
+  804bb9:	83 e8 57             	sub    $0x57,%eax
+  804bbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbf:	eb 26                	jmp    804be7 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804bc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc5:	0f b6 00             	movzbl (%rax),%eax
+  804bc8:	3c 40                	cmp    $0x40,%al
+  804bca:	7e 47                	jle    804c13 <strtol+0x16a>
+  804bcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bd0:	0f b6 00             	movzbl (%rax),%eax
+  804bd3:	3c 5a                	cmp    $0x5a,%al
+  804bd5:	7f 3c                	jg     804c13 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bdb:	0f b6 00             	movzbl (%rax),%eax
+  804bde:	0f be c0             	movsbl %al,%eax
+  804be1:	83 e8 37             	sub    $0x37,%eax
+  804be4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804be7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bea:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bed:	7d 23                	jge    804c12 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bef:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bf4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bf7:	48 98                	cltq
+  804bf9:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bfe:	48 89 c2             	mov    %rax,%rdx
+  804c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c04:	48 98                	cltq
+  804c06:	48 01 d0             	add    %rdx,%rax
+  804c09:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c0d:	e9 5f ff ff ff       	jmp    804b71 <strtol+0xc8>
+      break;
+  804c12:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c13:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c18:	74 0b                	je     804c25 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c1e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c22:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c25:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c29:	74 09                	je     804c34 <strtol+0x18b>
+  804c2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c2f:	48 f7 d8             	neg    %rax
+  804c32:	eb 04                	jmp    804c38 <strtol+0x18f>
+  804c34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c38:	c9                   	leave
+  804c39:	c3                   	ret
+
+0000000000804c3a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c3a:	55                   	push   %rbp
+  804c3b:	48 89 e5             	mov    %rsp,%rbp
+  804c3e:	48 83 ec 20          	sub    $0x20,%rsp
+  804c42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c46:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c4a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c4e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c52:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c5a:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c61:	48 89 c7             	mov    %rax,%rdi
+  804c64:	48 b8 72 4c 80 00 00 	movabs $0x804c72,%rax
+  804c6b:	00 00 00 
+  804c6e:	ff d0                	call   *%rax
+}
+  804c70:	c9                   	leave
+  804c71:	c3                   	ret
+
+0000000000804c72 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c72:	55                   	push   %rbp
+  804c73:	48 89 e5             	mov    %rsp,%rbp
+  804c76:	48 83 ec 30          	sub    $0x30,%rsp
+  804c7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c7e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c82:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c86:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c8a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c8f:	75 0e                	jne    804c9f <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c91:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c98:	00 00 00 
+  804c9b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c9f:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804ca4:	75 18                	jne    804cbe <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804ca6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804caa:	48 89 c7             	mov    %rax,%rdi
+  804cad:	48 b8 fd 05 80 00 00 	movabs $0x8005fd,%rax
+  804cb4:	00 00 00 
+  804cb7:	ff d0                	call   *%rax
+  804cb9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cbc:	eb 1d                	jmp    804cdb <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cbe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804cc2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cc6:	48 89 d6             	mov    %rdx,%rsi
+  804cc9:	48 89 c7             	mov    %rax,%rdi
+  804ccc:	48 b8 43 06 80 00 00 	movabs $0x800643,%rax
+  804cd3:	00 00 00 
+  804cd6:	ff d0                	call   *%rax
+  804cd8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cdb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cdf:	79 2a                	jns    804d0b <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804ce1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ce6:	74 0a                	je     804cf2 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cec:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cf2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cf7:	74 0a                	je     804d03 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cfd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d06:	e9 aa 00 00 00       	jmp    804db5 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d0b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d10:	74 36                	je     804d48 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d12:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d19:	00 00 00 
+  804d1c:	8b 40 04             	mov    0x4(%rax),%eax
+  804d1f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d24:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d2b:	00 00 00 
+  804d2e:	48 98                	cltq
+  804d30:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d37:	48 01 d0             	add    %rdx,%rax
+  804d3a:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d40:	8b 10                	mov    (%rax),%edx
+  804d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d46:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d48:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d4d:	74 36                	je     804d85 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d4f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d56:	00 00 00 
+  804d59:	8b 40 04             	mov    0x4(%rax),%eax
+  804d5c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d61:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d68:	00 00 00 
+  804d6b:	48 98                	cltq
+  804d6d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d74:	48 01 d0             	add    %rdx,%rax
+  804d77:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d7d:	8b 10                	mov    (%rax),%edx
+  804d7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d83:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d85:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d8c:	00 00 00 
+  804d8f:	8b 40 04             	mov    0x4(%rax),%eax
+  804d92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d97:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d9e:	00 00 00 
+  804da1:	48 98                	cltq
+  804da3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804daa:	48 01 d0             	add    %rdx,%rax
+  804dad:	48 05 20 01 00 00    	add    $0x120,%rax
+  804db3:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804db5:	c9                   	leave
+  804db6:	c3                   	ret
+
+0000000000804db7 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804db7:	55                   	push   %rbp
+  804db8:	48 89 e5             	mov    %rsp,%rbp
+  804dbb:	48 83 ec 30          	sub    $0x30,%rsp
+  804dbf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dc2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dc5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dc9:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dcc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dd1:	75 5e                	jne    804e31 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dd3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dda:	00 00 00 
+  804ddd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804de1:	eb 4e                	jmp    804e31 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804de3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804de7:	79 3c                	jns    804e25 <ipc_send+0x6e>
+  804de9:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804ded:	74 36                	je     804e25 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804def:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804df2:	89 c1                	mov    %eax,%ecx
+  804df4:	48 b8 28 56 80 00 00 	movabs $0x805628,%rax
+  804dfb:	00 00 00 
+  804dfe:	48 89 c2             	mov    %rax,%rdx
+  804e01:	be 54 00 00 00       	mov    $0x54,%esi
+  804e06:	48 b8 4e 56 80 00 00 	movabs $0x80564e,%rax
+  804e0d:	00 00 00 
+  804e10:	48 89 c7             	mov    %rax,%rdi
+  804e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e18:	49 b8 4d 2f 80 00 00 	movabs $0x802f4d,%r8
+  804e1f:	00 00 00 
+  804e22:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e25:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  804e2c:	00 00 00 
+  804e2f:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e31:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e34:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e37:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e3e:	89 c7                	mov    %eax,%edi
+  804e40:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  804e47:	00 00 00 
+  804e4a:	ff d0                	call   *%rax
+  804e4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e4f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e53:	75 8e                	jne    804de3 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e55:	48 b8 80 03 80 00 00 	movabs $0x800380,%rax
+  804e5c:	00 00 00 
+  804e5f:	ff d0                	call   *%rax
+}
+  804e61:	90                   	nop
+  804e62:	c9                   	leave
+  804e63:	c3                   	ret
+
+0000000000804e64 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e64:	55                   	push   %rbp
+  804e65:	48 89 e5             	mov    %rsp,%rbp
+  804e68:	48 83 ec 18          	sub    $0x18,%rsp
+  804e6c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e6f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e76:	eb 4d                	jmp    804ec5 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e78:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e7f:	00 00 00 
+  804e82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e85:	48 98                	cltq
+  804e87:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e8e:	48 01 d0             	add    %rdx,%rax
+  804e91:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e97:	8b 00                	mov    (%rax),%eax
+  804e99:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e9c:	75 23                	jne    804ec1 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e9e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ea5:	00 00 00 
+  804ea8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eab:	48 98                	cltq
+  804ead:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804eb4:	48 01 d0             	add    %rdx,%rax
+  804eb7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ebd:	8b 00                	mov    (%rax),%eax
+  804ebf:	eb 12                	jmp    804ed3 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ec1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ec5:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ecc:	7e aa                	jle    804e78 <ipc_find_env+0x14>
+  return 0;
+  804ece:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed3:	c9                   	leave
+  804ed4:	c3                   	ret
+
+0000000000804ed5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ed5:	55                   	push   %rbp
+  804ed6:	48 89 e5             	mov    %rsp,%rbp
+  804ed9:	48 83 ec 18          	sub    $0x18,%rsp
+  804edd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ee1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee5:	48 c1 e8 27          	shr    $0x27,%rax
+  804ee9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804eee:	48 89 c2             	mov    %rax,%rdx
+  804ef1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ef8:	01 00 00 
+  804efb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804eff:	83 e0 01             	and    $0x1,%eax
+  804f02:	48 85 c0             	test   %rax,%rax
+  804f05:	74 63                	je     804f6a <pageref+0x95>
+  804f07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f0f:	48 89 c2             	mov    %rax,%rdx
+  804f12:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f19:	01 00 00 
+  804f1c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f20:	83 e0 01             	and    $0x1,%eax
+  804f23:	48 85 c0             	test   %rax,%rax
+  804f26:	74 42                	je     804f6a <pageref+0x95>
+  804f28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2c:	48 c1 e8 15          	shr    $0x15,%rax
+  804f30:	48 89 c2             	mov    %rax,%rdx
+  804f33:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f3a:	01 00 00 
+  804f3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f41:	83 e0 01             	and    $0x1,%eax
+  804f44:	48 85 c0             	test   %rax,%rax
+  804f47:	74 21                	je     804f6a <pageref+0x95>
+  804f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f4d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f51:	48 89 c2             	mov    %rax,%rdx
+  804f54:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f5b:	01 00 00 
+  804f5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f62:	83 e0 01             	and    $0x1,%eax
+  804f65:	48 85 c0             	test   %rax,%rax
+  804f68:	75 07                	jne    804f71 <pageref+0x9c>
+    return 0;
+  804f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6f:	eb 53                	jmp    804fc4 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f75:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f79:	48 89 c2             	mov    %rax,%rdx
+  804f7c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f83:	01 00 00 
+  804f86:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f92:	83 e0 01             	and    $0x1,%eax
+  804f95:	48 85 c0             	test   %rax,%rax
+  804f98:	75 07                	jne    804fa1 <pageref+0xcc>
+    return 0;
+  804f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f9f:	eb 23                	jmp    804fc4 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa5:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fa9:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fb0:	00 00 00 
+  804fb3:	48 c1 e0 04          	shl    $0x4,%rax
+  804fb7:	48 01 d0             	add    %rdx,%rax
+  804fba:	48 83 c0 08          	add    $0x8,%rax
+  804fbe:	0f b7 00             	movzwl (%rax),%eax
+  804fc1:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fc4:	c9                   	leave
+  804fc5:	c3                   	ret
+  804fc6:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8100 @@
+
+obj/user/implicitconv:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 8e 00 00 00       	call   8000ba <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <signed_impl_conv>:
+//Test for UBSAN support - implicit conversion
+
+#include <inc/lib.h>
+
+void
+signed_impl_conv() {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  int a   = 2000000;
+  80003a:	c7 45 fc 80 84 1e 00 	movl   $0x1e8480,-0x4(%rbp)
+  short b = a;
+  800041:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800044:	66 89 45 fa          	mov    %ax,-0x6(%rbp)
+
+  a = 12000;
+  800048:	c7 45 fc e0 2e 00 00 	movl   $0x2ee0,-0x4(%rbp)
+  b = a;
+  80004f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800052:	66 89 45 fa          	mov    %ax,-0x6(%rbp)
+
+  a      = 257;
+  800056:	c7 45 fc 01 01 00 00 	movl   $0x101,-0x4(%rbp)
+  char c = a;
+  80005d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800060:	88 45 f9             	mov    %al,-0x7(%rbp)
+
+  (void)b;
+  (void)c;
+}
+  800063:	90                   	nop
+  800064:	c9                   	leave
+  800065:	c3                   	ret
+
+0000000000800066 <unsigned_impl_conv>:
+
+void
+unsigned_impl_conv() {
+  800066:	55                   	push   %rbp
+  800067:	48 89 e5             	mov    %rsp,%rbp
+  80006a:	48 83 ec 10          	sub    $0x10,%rsp
+  unsigned long long a = 400000000000;
+  80006e:	48 b8 00 a0 db 21 5d 	movabs $0x5d21dba000,%rax
+  800075:	00 00 00 
+  800078:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  unsigned int b       = a;
+  80007c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800080:	89 45 f4             	mov    %eax,-0xc(%rbp)
+
+  (void)b;
+}
+  800083:	90                   	nop
+  800084:	c9                   	leave
+  800085:	c3                   	ret
+
+0000000000800086 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800086:	55                   	push   %rbp
+  800087:	48 89 e5             	mov    %rsp,%rbp
+  80008a:	48 83 ec 10          	sub    $0x10,%rsp
+  80008e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800091:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  signed_impl_conv();
+  800095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009a:	48 ba 32 00 80 00 00 	movabs $0x800032,%rdx
+  8000a1:	00 00 00 
+  8000a4:	ff d2                	call   *%rdx
+  unsigned_impl_conv();
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba 66 00 80 00 00 	movabs $0x800066,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	90                   	nop
+  8000b8:	c9                   	leave
+  8000b9:	c3                   	ret
+
+00000000008000ba <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ba:	55                   	push   %rbp
+  8000bb:	48 89 e5             	mov    %rsp,%rbp
+  8000be:	48 83 ec 20          	sub    $0x20,%rsp
+  8000c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8000c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8000c9:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000d0:	00 00 00 
+  8000d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000d7:	eb 13                	jmp    8000ec <libmain+0x32>
+    (*ctor)();
+  8000d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8000dd:	48 8b 10             	mov    (%rax),%rdx
+  8000e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e5:	ff d2                	call   *%rdx
+    ctor++;
+  8000e7:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000ec:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  8000f3:	00 00 00 
+  8000f6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000fa:	72 dd                	jb     8000d9 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800100:	7e 14                	jle    800116 <libmain+0x5c>
+    binaryname = argv[0];
+  800102:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800106:	48 8b 00             	mov    (%rax),%rax
+  800109:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800110:	00 00 00 
+  800113:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800116:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80011a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80011d:	48 89 d6             	mov    %rdx,%rsi
+  800120:	89 c7                	mov    %eax,%edi
+  800122:	48 b8 86 00 80 00 00 	movabs $0x800086,%rax
+  800129:	00 00 00 
+  80012c:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80012e:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+#endif
+}
+  80013a:	90                   	nop
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+
+000000000080013d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800141:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  800148:	00 00 00 
+  80014b:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80014d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800152:	48 b8 c9 02 80 00 00 	movabs $0x8002c9,%rax
+  800159:	00 00 00 
+  80015c:	ff d0                	call   *%rax
+}
+  80015e:	90                   	nop
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 83 ec 48          	sub    $0x48,%rsp
+  80016a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80016e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800172:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800176:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80017a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80017e:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  800182:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800186:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80018a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80018e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800192:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800196:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80019a:	4c 89 c3             	mov    %r8,%rbx
+  80019d:	cd 30                	int    $0x30
+  80019f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8001a3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001a8:	74 46                	je     8001f0 <syscall+0x8f>
+  8001aa:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8001af:	7e 3f                	jle    8001f0 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8001b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8001b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001b9:	49 89 d0             	mov    %rdx,%r8
+  8001bc:	48 89 c1             	mov    %rax,%rcx
+  8001bf:	48 b8 30 50 80 00 00 	movabs $0x805030,%rax
+  8001c6:	00 00 00 
+  8001c9:	48 89 c2             	mov    %rax,%rdx
+  8001cc:	be 22 00 00 00       	mov    $0x22,%esi
+  8001d1:	48 b8 4f 50 80 00 00 	movabs $0x80504f,%rax
+  8001d8:	00 00 00 
+  8001db:	48 89 c7             	mov    %rax,%rdi
+  8001de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e3:	49 b9 a1 2f 80 00 00 	movabs $0x802fa1,%r9
+  8001ea:	00 00 00 
+  8001ed:	41 ff d1             	call   *%r9
+
+  return ret;
+  8001f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8001f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f8:	c9                   	leave
+  8001f9:	c3                   	ret
+
+00000000008001fa <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+  8001fe:	48 83 ec 10          	sub    $0x10,%rsp
+  800202:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800206:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80020a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80020e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800212:	48 83 ec 08          	sub    $0x8,%rsp
+  800216:	6a 00                	push   $0x0
+  800218:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80021e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800224:	48 89 d1             	mov    %rdx,%rcx
+  800227:	48 89 c2             	mov    %rax,%rdx
+  80022a:	be 00 00 00 00       	mov    $0x0,%esi
+  80022f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800234:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800244:	90                   	nop
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+0000000000800247 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800247:	55                   	push   %rbp
+  800248:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	6a 00                	push   $0x0
+  800251:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800257:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80025d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800262:	ba 00 00 00 00       	mov    $0x0,%edx
+  800267:	be 00 00 00 00       	mov    $0x0,%esi
+  80026c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800271:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800278:	00 00 00 
+  80027b:	ff d0                	call   *%rax
+  80027d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800281:	c9                   	leave
+  800282:	c3                   	ret
+
+0000000000800283 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800283:	55                   	push   %rbp
+  800284:	48 89 e5             	mov    %rsp,%rbp
+  800287:	48 83 ec 10          	sub    $0x10,%rsp
+  80028b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80028e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800291:	48 98                	cltq
+  800293:	48 83 ec 08          	sub    $0x8,%rsp
+  800297:	6a 00                	push   $0x0
+  800299:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80029f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002aa:	48 89 c2             	mov    %rax,%rdx
+  8002ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8002b2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8002b7:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8002be:	00 00 00 
+  8002c1:	ff d0                	call   *%rax
+  8002c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8002c7:	c9                   	leave
+  8002c8:	c3                   	ret
+
+00000000008002c9 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8002c9:	55                   	push   %rbp
+  8002ca:	48 89 e5             	mov    %rsp,%rbp
+  8002cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8002d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8002d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d7:	48 98                	cltq
+  8002d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002dd:	6a 00                	push   $0x0
+  8002df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8002e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002f0:	48 89 c2             	mov    %rax,%rdx
+  8002f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002f8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002fd:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+  800309:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80030d:	90                   	nop
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+0000000000800310 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  800310:	55                   	push   %rbp
+  800311:	48 89 e5             	mov    %rsp,%rbp
+  800314:	48 83 ec 20          	sub    $0x20,%rsp
+  800318:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80031b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80031f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800322:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  800325:	b8 05 00 00 00       	mov    $0x5,%eax
+  80032a:	cd 30                	int    $0x30
+  80032c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800330:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  800334:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800339:	7e 3d                	jle    800378 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80033b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80033f:	49 89 c0             	mov    %rax,%r8
+  800342:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800347:	48 b8 30 50 80 00 00 	movabs $0x805030,%rax
+  80034e:	00 00 00 
+  800351:	48 89 c2             	mov    %rax,%rdx
+  800354:	be 49 00 00 00       	mov    $0x49,%esi
+  800359:	48 b8 4f 50 80 00 00 	movabs $0x80504f,%rax
+  800360:	00 00 00 
+  800363:	48 89 c7             	mov    %rax,%rdi
+  800366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036b:	49 b9 a1 2f 80 00 00 	movabs $0x802fa1,%r9
+  800372:	00 00 00 
+  800375:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800378:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80037d:	75 13                	jne    800392 <sys_env_wait+0x82>
+  80037f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800384:	74 0c                	je     800392 <sys_env_wait+0x82>
+    *status = st;
+  800386:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80038a:	89 c2                	mov    %eax,%edx
+  80038c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800390:	89 10                	mov    %edx,(%rax)
+  return ret;
+  800392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800396:	c9                   	leave
+  800397:	c3                   	ret
+
+0000000000800398 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800398:	55                   	push   %rbp
+  800399:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80039c:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a0:	6a 00                	push   $0x0
+  8003a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8003bd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8003c2:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8003c9:	00 00 00 
+  8003cc:	ff d0                	call   *%rax
+  8003ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+
+00000000008003d4 <sys_yield>:
+
+void
+sys_yield(void) {
+  8003d4:	55                   	push   %rbp
+  8003d5:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8003d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8003dc:	6a 00                	push   $0x0
+  8003de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f9:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8003fe:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+  80040a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80040e:	90                   	nop
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+0000000000800411 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  800411:	55                   	push   %rbp
+  800412:	48 89 e5             	mov    %rsp,%rbp
+  800415:	48 83 ec 20          	sub    $0x20,%rsp
+  800419:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80041c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800420:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  800423:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800426:	48 63 c8             	movslq %eax,%rcx
+  800429:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80042d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800430:	48 98                	cltq
+  800432:	48 83 ec 08          	sub    $0x8,%rsp
+  800436:	6a 00                	push   $0x0
+  800438:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80043e:	49 89 c8             	mov    %rcx,%r8
+  800441:	48 89 d1             	mov    %rdx,%rcx
+  800444:	48 89 c2             	mov    %rax,%rdx
+  800447:	be 01 00 00 00       	mov    $0x1,%esi
+  80044c:	bf 06 00 00 00       	mov    $0x6,%edi
+  800451:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+  80045d:	48 83 c4 10          	add    $0x10,%rsp
+  800461:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  800464:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800467:	c9                   	leave
+  800468:	c3                   	ret
+
+0000000000800469 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  800469:	55                   	push   %rbp
+  80046a:	48 89 e5             	mov    %rsp,%rbp
+  80046d:	48 83 ec 20          	sub    $0x20,%rsp
+  800471:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800474:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800478:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80047b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80047f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  800483:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800486:	48 63 c8             	movslq %eax,%rcx
+  800489:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80048d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800490:	48 63 f0             	movslq %eax,%rsi
+  800493:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800497:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80049a:	48 98                	cltq
+  80049c:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a0:	51                   	push   %rcx
+  8004a1:	49 89 f9             	mov    %rdi,%r9
+  8004a4:	49 89 f0             	mov    %rsi,%r8
+  8004a7:	48 89 d1             	mov    %rdx,%rcx
+  8004aa:	48 89 c2             	mov    %rax,%rdx
+  8004ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8004b2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8004b7:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8004be:	00 00 00 
+  8004c1:	ff d0                	call   *%rax
+  8004c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004c7:	c9                   	leave
+  8004c8:	c3                   	ret
+
+00000000008004c9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8004c9:	55                   	push   %rbp
+  8004ca:	48 89 e5             	mov    %rsp,%rbp
+  8004cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8004d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8004d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004df:	48 98                	cltq
+  8004e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e5:	6a 00                	push   $0x0
+  8004e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004f3:	48 89 d1             	mov    %rdx,%rcx
+  8004f6:	48 89 c2             	mov    %rax,%rdx
+  8004f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8004fe:	bf 08 00 00 00       	mov    $0x8,%edi
+  800503:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  80050a:	00 00 00 
+  80050d:	ff d0                	call   *%rax
+  80050f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800513:	c9                   	leave
+  800514:	c3                   	ret
+
+0000000000800515 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800515:	55                   	push   %rbp
+  800516:	48 89 e5             	mov    %rsp,%rbp
+  800519:	48 83 ec 10          	sub    $0x10,%rsp
+  80051d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800520:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800523:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800526:	48 63 d0             	movslq %eax,%rdx
+  800529:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80052c:	48 98                	cltq
+  80052e:	48 83 ec 08          	sub    $0x8,%rsp
+  800532:	6a 00                	push   $0x0
+  800534:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80053a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800540:	48 89 d1             	mov    %rdx,%rcx
+  800543:	48 89 c2             	mov    %rax,%rdx
+  800546:	be 01 00 00 00       	mov    $0x1,%esi
+  80054b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800550:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800557:	00 00 00 
+  80055a:	ff d0                	call   *%rax
+  80055c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+
+0000000000800562 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+  800566:	48 83 ec 10          	sub    $0x10,%rsp
+  80056a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80056d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  800571:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800575:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800578:	48 98                	cltq
+  80057a:	48 83 ec 08          	sub    $0x8,%rsp
+  80057e:	6a 00                	push   $0x0
+  800580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800586:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80058c:	48 89 d1             	mov    %rdx,%rcx
+  80058f:	48 89 c2             	mov    %rax,%rdx
+  800592:	be 01 00 00 00       	mov    $0x1,%esi
+  800597:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80059c:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+  8005a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005ac:	c9                   	leave
+  8005ad:	c3                   	ret
+
+00000000008005ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8005b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8005bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005c4:	48 98                	cltq
+  8005c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ca:	6a 00                	push   $0x0
+  8005cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005d8:	48 89 d1             	mov    %rdx,%rcx
+  8005db:	48 89 c2             	mov    %rax,%rdx
+  8005de:	be 01 00 00 00       	mov    $0x1,%esi
+  8005e3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8005e8:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8005ef:	00 00 00 
+  8005f2:	ff d0                	call   *%rax
+  8005f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+
+00000000008005fa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	48 83 ec 20          	sub    $0x20,%rsp
+  800602:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800605:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800609:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80060d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  800610:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800613:	48 63 f0             	movslq %eax,%rsi
+  800616:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80061a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80061e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800621:	48 98                	cltq
+  800623:	48 83 ec 08          	sub    $0x8,%rsp
+  800627:	6a 00                	push   $0x0
+  800629:	49 89 f1             	mov    %rsi,%r9
+  80062c:	49 89 c8             	mov    %rcx,%r8
+  80062f:	48 89 d1             	mov    %rdx,%rcx
+  800632:	48 89 c2             	mov    %rax,%rdx
+  800635:	be 00 00 00 00       	mov    $0x0,%esi
+  80063a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80063f:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800646:	00 00 00 
+  800649:	ff d0                	call   *%rax
+  80064b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+0000000000800651 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  800651:	55                   	push   %rbp
+  800652:	48 89 e5             	mov    %rsp,%rbp
+  800655:	48 83 ec 10          	sub    $0x10,%rsp
+  800659:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80065d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800661:	48 83 ec 08          	sub    $0x8,%rsp
+  800665:	6a 00                	push   $0x0
+  800667:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80066d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800673:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800678:	48 89 c2             	mov    %rax,%rdx
+  80067b:	be 01 00 00 00       	mov    $0x1,%esi
+  800680:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800685:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800695:	c9                   	leave
+  800696:	c3                   	ret
+
+0000000000800697 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800697:	55                   	push   %rbp
+  800698:	48 89 e5             	mov    %rsp,%rbp
+  80069b:	48 83 ec 10          	sub    $0x10,%rsp
+  80069f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8006a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006af:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b3:	6a 00                	push   $0x0
+  8006b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006c1:	48 89 d1             	mov    %rdx,%rcx
+  8006c4:	48 89 c2             	mov    %rax,%rdx
+  8006c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8006cc:	bf 10 00 00 00       	mov    $0x10,%edi
+  8006d1:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8006d8:	00 00 00 
+  8006db:	ff d0                	call   *%rax
+  8006dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006e1:	c9                   	leave
+  8006e2:	c3                   	ret
+
+00000000008006e3 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8006e3:	55                   	push   %rbp
+  8006e4:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8006e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006eb:	6a 00                	push   $0x0
+  8006ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800703:	be 00 00 00 00       	mov    $0x0,%esi
+  800708:	bf 11 00 00 00       	mov    $0x11,%edi
+  80070d:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800714:	00 00 00 
+  800717:	ff d0                	call   *%rax
+  800719:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80071d:	c9                   	leave
+  80071e:	c3                   	ret
+
+000000000080071f <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80071f:	55                   	push   %rbp
+  800720:	48 89 e5             	mov    %rsp,%rbp
+  800723:	48 83 ec 10          	sub    $0x10,%rsp
+  800727:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80072b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80072f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800737:	48 83 ec 08          	sub    $0x8,%rsp
+  80073b:	6a 00                	push   $0x0
+  80073d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800749:	48 89 d1             	mov    %rdx,%rcx
+  80074c:	48 89 c2             	mov    %rax,%rdx
+  80074f:	be 00 00 00 00       	mov    $0x0,%esi
+  800754:	bf 12 00 00 00       	mov    $0x12,%edi
+  800759:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800760:	00 00 00 
+  800763:	ff d0                	call   *%rax
+  800765:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800769:	c9                   	leave
+  80076a:	c3                   	ret
+
+000000000080076b <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80076b:	55                   	push   %rbp
+  80076c:	48 89 e5             	mov    %rsp,%rbp
+  80076f:	48 83 ec 20          	sub    $0x20,%rsp
+  800773:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800777:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80077b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80077e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800781:	48 63 c8             	movslq %eax,%rcx
+  800784:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078c:	48 83 ec 08          	sub    $0x8,%rsp
+  800790:	6a 00                	push   $0x0
+  800792:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800798:	49 89 c8             	mov    %rcx,%r8
+  80079b:	48 89 d1             	mov    %rdx,%rcx
+  80079e:	48 89 c2             	mov    %rax,%rdx
+  8007a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007a6:	bf 13 00 00 00       	mov    $0x13,%edi
+  8007ab:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8007b2:	00 00 00 
+  8007b5:	ff d0                	call   *%rax
+  8007b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007bb:	c9                   	leave
+  8007bc:	c3                   	ret
+
+00000000008007bd <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8007bd:	55                   	push   %rbp
+  8007be:	48 89 e5             	mov    %rsp,%rbp
+  8007c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8007c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007c9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8007d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007d4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8007d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007db:	48 83 ec 08          	sub    $0x8,%rsp
+  8007df:	6a 00                	push   $0x0
+  8007e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007e7:	49 89 c8             	mov    %rcx,%r8
+  8007ea:	48 89 d1             	mov    %rdx,%rcx
+  8007ed:	48 89 c2             	mov    %rax,%rdx
+  8007f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8007f5:	bf 14 00 00 00       	mov    $0x14,%edi
+  8007fa:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800801:	00 00 00 
+  800804:	ff d0                	call   *%rax
+  800806:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80080a:	c9                   	leave
+  80080b:	c3                   	ret
+
+000000000080080c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80080c:	55                   	push   %rbp
+  80080d:	48 89 e5             	mov    %rsp,%rbp
+  800810:	48 83 ec 10          	sub    $0x10,%rsp
+  800814:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800818:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  80081b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80081e:	48 63 d0             	movslq %eax,%rdx
+  800821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800825:	48 83 ec 08          	sub    $0x8,%rsp
+  800829:	6a 00                	push   $0x0
+  80082b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800831:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800837:	48 89 d1             	mov    %rdx,%rcx
+  80083a:	48 89 c2             	mov    %rax,%rdx
+  80083d:	be 00 00 00 00       	mov    $0x0,%esi
+  800842:	bf 15 00 00 00       	mov    $0x15,%edi
+  800847:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  80084e:	00 00 00 
+  800851:	ff d0                	call   *%rax
+  800853:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+0000000000800859 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  800859:	55                   	push   %rbp
+  80085a:	48 89 e5             	mov    %rsp,%rbp
+  80085d:	48 83 ec 20          	sub    $0x20,%rsp
+  800861:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800865:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800868:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80086b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80086f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800873:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800876:	48 63 c8             	movslq %eax,%rcx
+  800879:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80087c:	48 63 d0             	movslq %eax,%rdx
+  80087f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800883:	48 83 ec 08          	sub    $0x8,%rsp
+  800887:	6a 00                	push   $0x0
+  800889:	49 89 f1             	mov    %rsi,%r9
+  80088c:	49 89 c8             	mov    %rcx,%r8
+  80088f:	48 89 d1             	mov    %rdx,%rcx
+  800892:	48 89 c2             	mov    %rax,%rdx
+  800895:	be 00 00 00 00       	mov    $0x0,%esi
+  80089a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80089f:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8008a6:	00 00 00 
+  8008a9:	ff d0                	call   *%rax
+  8008ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+
+00000000008008b1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8008b1:	55                   	push   %rbp
+  8008b2:	48 89 e5             	mov    %rsp,%rbp
+  8008b5:	48 83 ec 30          	sub    $0x30,%rsp
+  8008b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008c1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008c5:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8008c9:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8008cd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8008d1:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8008d5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8008dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e5:	51                   	push   %rcx
+  8008e6:	49 89 f9             	mov    %rdi,%r9
+  8008e9:	49 89 f0             	mov    %rsi,%r8
+  8008ec:	48 89 d1             	mov    %rdx,%rcx
+  8008ef:	48 89 c2             	mov    %rax,%rdx
+  8008f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8008f7:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008fc:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800903:	00 00 00 
+  800906:	ff d0                	call   *%rax
+  800908:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+000000000080090e <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80090e:	55                   	push   %rbp
+  80090f:	48 89 e5             	mov    %rsp,%rbp
+  800912:	48 83 ec 10          	sub    $0x10,%rsp
+  800916:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  800919:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80091c:	48 98                	cltq
+  80091e:	48 83 ec 08          	sub    $0x8,%rsp
+  800922:	6a 00                	push   $0x0
+  800924:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80092a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800930:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800935:	48 89 c2             	mov    %rax,%rdx
+  800938:	be 00 00 00 00       	mov    $0x0,%esi
+  80093d:	bf 18 00 00 00       	mov    $0x18,%edi
+  800942:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800949:	00 00 00 
+  80094c:	ff d0                	call   *%rax
+  80094e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800952:	90                   	nop
+  800953:	c9                   	leave
+  800954:	c3                   	ret
+
+0000000000800955 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  800955:	55                   	push   %rbp
+  800956:	48 89 e5             	mov    %rsp,%rbp
+  800959:	48 83 ec 30          	sub    $0x30,%rsp
+  80095d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800960:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800964:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800968:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80096b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80096e:	48 63 f0             	movslq %eax,%rsi
+  800971:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800975:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800979:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80097c:	48 98                	cltq
+  80097e:	48 83 ec 08          	sub    $0x8,%rsp
+  800982:	6a 00                	push   $0x0
+  800984:	49 89 f1             	mov    %rsi,%r9
+  800987:	49 89 c8             	mov    %rcx,%r8
+  80098a:	48 89 d1             	mov    %rdx,%rcx
+  80098d:	48 89 c2             	mov    %rax,%rdx
+  800990:	be 01 00 00 00       	mov    $0x1,%esi
+  800995:	bf 19 00 00 00       	mov    $0x19,%edi
+  80099a:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+  8009a6:	48 83 c4 10          	add    $0x10,%rsp
+  8009aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8009ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8009b0:	c9                   	leave
+  8009b1:	c3                   	ret
+
+00000000008009b2 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8009b2:	55                   	push   %rbp
+  8009b3:	48 89 e5             	mov    %rsp,%rbp
+  8009b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8009ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009c2:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8009c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8009c8:	48 63 c8             	movslq %eax,%rcx
+  8009cb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d7:	6a 00                	push   $0x0
+  8009d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009df:	49 89 c8             	mov    %rcx,%r8
+  8009e2:	48 89 d1             	mov    %rdx,%rcx
+  8009e5:	48 89 c2             	mov    %rax,%rdx
+  8009e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8009ed:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8009f2:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8009f9:	00 00 00 
+  8009fc:	ff d0                	call   *%rax
+  8009fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+
+0000000000800a04 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  800a04:	55                   	push   %rbp
+  800a05:	48 89 e5             	mov    %rsp,%rbp
+  800a08:	48 83 ec 20          	sub    $0x20,%rsp
+  800a0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a14:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  800a18:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a1c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800a20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a24:	48 83 ec 08          	sub    $0x8,%rsp
+  800a28:	6a 00                	push   $0x0
+  800a2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a30:	49 89 c8             	mov    %rcx,%r8
+  800a33:	48 89 d1             	mov    %rdx,%rcx
+  800a36:	48 89 c2             	mov    %rax,%rdx
+  800a39:	be 01 00 00 00       	mov    $0x1,%esi
+  800a3e:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  800a43:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800a4a:	00 00 00 
+  800a4d:	ff d0                	call   *%rax
+  800a4f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a53:	c9                   	leave
+  800a54:	c3                   	ret
+
+0000000000800a55 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  800a55:	55                   	push   %rbp
+  800a56:	48 89 e5             	mov    %rsp,%rbp
+  800a59:	48 83 ec 30          	sub    $0x30,%rsp
+  800a5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a65:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  800a68:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  800a6c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  800a70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a73:	48 63 c8             	movslq %eax,%rcx
+  800a76:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a82:	6a 00                	push   $0x0
+  800a84:	49 89 f1             	mov    %rsi,%r9
+  800a87:	49 89 c8             	mov    %rcx,%r8
+  800a8a:	48 89 d1             	mov    %rdx,%rcx
+  800a8d:	48 89 c2             	mov    %rax,%rdx
+  800a90:	be 01 00 00 00       	mov    $0x1,%esi
+  800a95:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a9a:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800aa1:	00 00 00 
+  800aa4:	ff d0                	call   *%rax
+  800aa6:	48 83 c4 10          	add    $0x10,%rsp
+  800aaa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800aad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+
+0000000000800ab2 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800ab2:	55                   	push   %rbp
+  800ab3:	48 89 e5             	mov    %rsp,%rbp
+  800ab6:	48 83 ec 10          	sub    $0x10,%rsp
+  800aba:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800abd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ac0:	48 98                	cltq
+  800ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac6:	6a 00                	push   $0x0
+  800ac8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ace:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ad4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad9:	48 89 c2             	mov    %rax,%rdx
+  800adc:	be 01 00 00 00       	mov    $0x1,%esi
+  800ae1:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800ae6:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800aed:	00 00 00 
+  800af0:	ff d0                	call   *%rax
+  800af2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800af6:	c9                   	leave
+  800af7:	c3                   	ret
+
+0000000000800af8 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800af8:	55                   	push   %rbp
+  800af9:	48 89 e5             	mov    %rsp,%rbp
+  800afc:	48 83 ec 08          	sub    $0x8,%rsp
+  800b00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800b04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b08:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800b0f:	ff ff ff 
+  800b12:	48 01 d0             	add    %rdx,%rax
+  800b15:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+
+0000000000800b1b <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800b1b:	55                   	push   %rbp
+  800b1c:	48 89 e5             	mov    %rsp,%rbp
+  800b1f:	48 83 ec 08          	sub    $0x8,%rsp
+  800b23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800b27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b2b:	48 89 c7             	mov    %rax,%rdi
+  800b2e:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  800b35:	00 00 00 
+  800b38:	ff d0                	call   *%rax
+  800b3a:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800b40:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800b44:	c9                   	leave
+  800b45:	c3                   	ret
+
+0000000000800b46 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800b46:	55                   	push   %rbp
+  800b47:	48 89 e5             	mov    %rsp,%rbp
+  800b4a:	48 83 ec 18          	sub    $0x18,%rsp
+  800b4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800b52:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800b59:	e9 ae 00 00 00       	jmp    800c0c <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800b5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b61:	c1 e0 0c             	shl    $0xc,%eax
+  800b64:	48 98                	cltq
+  800b66:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800b6b:	48 01 d0             	add    %rdx,%rax
+  800b6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b76:	48 c1 e8 27          	shr    $0x27,%rax
+  800b7a:	48 89 c2             	mov    %rax,%rdx
+  800b7d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b84:	01 00 00 
+  800b87:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b8b:	83 e0 01             	and    $0x1,%eax
+  800b8e:	48 85 c0             	test   %rax,%rax
+  800b91:	74 63                	je     800bf6 <fd_alloc+0xb0>
+  800b93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b97:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b9b:	48 89 c2             	mov    %rax,%rdx
+  800b9e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800ba5:	01 00 00 
+  800ba8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bac:	83 e0 01             	and    $0x1,%eax
+  800baf:	48 85 c0             	test   %rax,%rax
+  800bb2:	74 42                	je     800bf6 <fd_alloc+0xb0>
+  800bb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bb8:	48 c1 e8 15          	shr    $0x15,%rax
+  800bbc:	48 89 c2             	mov    %rax,%rdx
+  800bbf:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800bc6:	01 00 00 
+  800bc9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bcd:	83 e0 01             	and    $0x1,%eax
+  800bd0:	48 85 c0             	test   %rax,%rax
+  800bd3:	74 21                	je     800bf6 <fd_alloc+0xb0>
+  800bd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bd9:	48 c1 e8 0c          	shr    $0xc,%rax
+  800bdd:	48 89 c2             	mov    %rax,%rdx
+  800be0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800be7:	01 00 00 
+  800bea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800bee:	83 e0 01             	and    $0x1,%eax
+  800bf1:	48 85 c0             	test   %rax,%rax
+  800bf4:	75 12                	jne    800c08 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800bf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800bfe:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c06:	eb 1e                	jmp    800c26 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800c08:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800c0c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800c10:	0f 8e 48 ff ff ff    	jle    800b5e <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c1a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800c21:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800c26:	c9                   	leave
+  800c27:	c3                   	ret
+
+0000000000800c28 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800c28:	55                   	push   %rbp
+  800c29:	48 89 e5             	mov    %rsp,%rbp
+  800c2c:	48 83 ec 20          	sub    $0x20,%rsp
+  800c30:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800c33:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800c37:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800c3b:	78 06                	js     800c43 <fd_lookup+0x1b>
+  800c3d:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800c41:	7e 0a                	jle    800c4d <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c48:	e9 af 00 00 00       	jmp    800cfc <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800c4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c50:	c1 e0 0c             	shl    $0xc,%eax
+  800c53:	48 98                	cltq
+  800c55:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800c5a:	48 01 d0             	add    %rdx,%rax
+  800c5d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800c61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c65:	48 c1 e8 27          	shr    $0x27,%rax
+  800c69:	48 89 c2             	mov    %rax,%rdx
+  800c6c:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800c73:	01 00 00 
+  800c76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c7a:	83 e0 01             	and    $0x1,%eax
+  800c7d:	48 85 c0             	test   %rax,%rax
+  800c80:	74 63                	je     800ce5 <fd_lookup+0xbd>
+  800c82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c86:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c8a:	48 89 c2             	mov    %rax,%rdx
+  800c8d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c94:	01 00 00 
+  800c97:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c9b:	83 e0 01             	and    $0x1,%eax
+  800c9e:	48 85 c0             	test   %rax,%rax
+  800ca1:	74 42                	je     800ce5 <fd_lookup+0xbd>
+  800ca3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ca7:	48 c1 e8 15          	shr    $0x15,%rax
+  800cab:	48 89 c2             	mov    %rax,%rdx
+  800cae:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800cb5:	01 00 00 
+  800cb8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cbc:	83 e0 01             	and    $0x1,%eax
+  800cbf:	48 85 c0             	test   %rax,%rax
+  800cc2:	74 21                	je     800ce5 <fd_lookup+0xbd>
+  800cc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cc8:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ccc:	48 89 c2             	mov    %rax,%rdx
+  800ccf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800cd6:	01 00 00 
+  800cd9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800cdd:	83 e0 01             	and    $0x1,%eax
+  800ce0:	48 85 c0             	test   %rax,%rax
+  800ce3:	75 07                	jne    800cec <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800ce5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cea:	eb 10                	jmp    800cfc <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800cec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cf0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cf4:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cfc:	c9                   	leave
+  800cfd:	c3                   	ret
+
+0000000000800cfe <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800cfe:	55                   	push   %rbp
+  800cff:	48 89 e5             	mov    %rsp,%rbp
+  800d02:	48 83 ec 30          	sub    $0x30,%rsp
+  800d06:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d0a:	89 f0                	mov    %esi,%eax
+  800d0c:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800d0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d13:	48 89 c7             	mov    %rax,%rdi
+  800d16:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  800d1d:	00 00 00 
+  800d20:	ff d0                	call   *%rax
+  800d22:	89 c2                	mov    %eax,%edx
+  800d24:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800d28:	48 89 c6             	mov    %rax,%rsi
+  800d2b:	89 d7                	mov    %edx,%edi
+  800d2d:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  800d34:	00 00 00 
+  800d37:	ff d0                	call   *%rax
+  800d39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d40:	78 0a                	js     800d4c <fd_close+0x4e>
+  800d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d46:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800d4a:	74 12                	je     800d5e <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800d4c:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800d50:	74 05                	je     800d57 <fd_close+0x59>
+  800d52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d55:	eb 70                	jmp    800dc7 <fd_close+0xc9>
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5c:	eb 69                	jmp    800dc7 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d62:	8b 00                	mov    (%rax),%eax
+  800d64:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d68:	48 89 d6             	mov    %rdx,%rsi
+  800d6b:	89 c7                	mov    %eax,%edi
+  800d6d:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  800d74:	00 00 00 
+  800d77:	ff d0                	call   *%rax
+  800d79:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d80:	78 2a                	js     800dac <fd_close+0xae>
+    if (dev->dev_close)
+  800d82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d86:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d8a:	48 85 c0             	test   %rax,%rax
+  800d8d:	74 16                	je     800da5 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d93:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d9b:	48 89 c7             	mov    %rax,%rdi
+  800d9e:	ff d2                	call   *%rdx
+  800da0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800da3:	eb 07                	jmp    800dac <fd_close+0xae>
+    else
+      r = 0;
+  800da5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800dac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800db0:	48 89 c6             	mov    %rax,%rsi
+  800db3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800db8:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+  return r;
+  800dc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800dc7:	c9                   	leave
+  800dc8:	c3                   	ret
+
+0000000000800dc9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800dc9:	55                   	push   %rbp
+  800dca:	48 89 e5             	mov    %rsp,%rbp
+  800dcd:	48 83 ec 20          	sub    $0x20,%rsp
+  800dd1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800dd4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800dd8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ddf:	eb 3f                	jmp    800e20 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800de1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800de8:	00 00 00 
+  800deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800dee:	48 98                	cltq
+  800df0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800df4:	8b 00                	mov    (%rax),%eax
+  800df6:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800df9:	75 21                	jne    800e1c <dev_lookup+0x53>
+      *dev = devtab[i];
+  800dfb:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e02:	00 00 00 
+  800e05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e08:	48 98                	cltq
+  800e0a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800e0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e12:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1a:	eb 7f                	jmp    800e9b <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800e1c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e20:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800e27:	00 00 00 
+  800e2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e2d:	48 98                	cltq
+  800e2f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800e33:	48 85 c0             	test   %rax,%rax
+  800e36:	75 a9                	jne    800de1 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800e38:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800e3f:	00 00 00 
+  800e42:	8b 40 04             	mov    0x4(%rax),%eax
+  800e45:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800e4a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800e51:	00 00 00 
+  800e54:	48 98                	cltq
+  800e56:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800e5d:	48 01 d0             	add    %rdx,%rax
+  800e60:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800e66:	8b 00                	mov    (%rax),%eax
+  800e68:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e6b:	89 c6                	mov    %eax,%esi
+  800e6d:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  800e74:	00 00 00 
+  800e77:	48 89 c7             	mov    %rax,%rdi
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7f:	48 b9 c0 31 80 00 00 	movabs $0x8031c0,%rcx
+  800e86:	00 00 00 
+  800e89:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e8f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e9b:	c9                   	leave
+  800e9c:	c3                   	ret
+
+0000000000800e9d <close>:
+
+int
+close(int fdnum) {
+  800e9d:	55                   	push   %rbp
+  800e9e:	48 89 e5             	mov    %rsp,%rbp
+  800ea1:	48 83 ec 20          	sub    $0x20,%rsp
+  800ea5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ea8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800eaf:	48 89 d6             	mov    %rdx,%rsi
+  800eb2:	89 c7                	mov    %eax,%edi
+  800eb4:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  800ebb:	00 00 00 
+  800ebe:	ff d0                	call   *%rax
+  800ec0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ec3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ec7:	79 05                	jns    800ece <close+0x31>
+    return r;
+  800ec9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ecc:	eb 18                	jmp    800ee6 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800ece:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ed2:	be 01 00 00 00       	mov    $0x1,%esi
+  800ed7:	48 89 c7             	mov    %rax,%rdi
+  800eda:	48 b8 fe 0c 80 00 00 	movabs $0x800cfe,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+}
+  800ee6:	c9                   	leave
+  800ee7:	c3                   	ret
+
+0000000000800ee8 <close_all>:
+
+void
+close_all(void) {
+  800ee8:	55                   	push   %rbp
+  800ee9:	48 89 e5             	mov    %rsp,%rbp
+  800eec:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800ef0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ef7:	eb 15                	jmp    800f0e <close_all+0x26>
+    close(i);
+  800ef9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800efc:	89 c7                	mov    %eax,%edi
+  800efe:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800f0a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800f0e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800f12:	7e e5                	jle    800ef9 <close_all+0x11>
+}
+  800f14:	90                   	nop
+  800f15:	90                   	nop
+  800f16:	c9                   	leave
+  800f17:	c3                   	ret
+
+0000000000800f18 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800f18:	55                   	push   %rbp
+  800f19:	48 89 e5             	mov    %rsp,%rbp
+  800f1c:	48 83 ec 40          	sub    $0x40,%rsp
+  800f20:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800f23:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800f26:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800f2a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800f2d:	48 89 d6             	mov    %rdx,%rsi
+  800f30:	89 c7                	mov    %eax,%edi
+  800f32:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  800f39:	00 00 00 
+  800f3c:	ff d0                	call   *%rax
+  800f3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800f45:	79 08                	jns    800f4f <dup+0x37>
+    return r;
+  800f47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f4a:	e9 33 02 00 00       	jmp    801182 <dup+0x26a>
+  close(newfdnum);
+  800f4f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f52:	89 c7                	mov    %eax,%edi
+  800f54:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  800f5b:	00 00 00 
+  800f5e:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800f60:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f63:	c1 e0 0c             	shl    $0xc,%eax
+  800f66:	48 98                	cltq
+  800f68:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800f6d:	48 01 d0             	add    %rdx,%rax
+  800f70:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f78:	48 89 c7             	mov    %rax,%rdi
+  800f7b:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800f82:	00 00 00 
+  800f85:	ff d0                	call   *%rax
+  800f87:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f8f:	48 89 c7             	mov    %rax,%rdi
+  800f92:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  800f99:	00 00 00 
+  800f9c:	ff d0                	call   *%rax
+  800f9e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800fa2:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800fa9:	00 
+  800faa:	e9 19 01 00 00       	jmp    8010c8 <dup+0x1b0>
+    off -= PGSIZE;
+  800faf:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800fb6:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fb7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fbf:	48 01 d0             	add    %rdx,%rax
+  800fc2:	48 c1 e8 27          	shr    $0x27,%rax
+  800fc6:	48 89 c2             	mov    %rax,%rdx
+  800fc9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800fd0:	01 00 00 
+  800fd3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fd7:	83 e0 01             	and    $0x1,%eax
+  800fda:	48 85 c0             	test   %rax,%rax
+  800fdd:	0f 84 e5 00 00 00    	je     8010c8 <dup+0x1b0>
+  800fe3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fe7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800feb:	48 01 d0             	add    %rdx,%rax
+  800fee:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800ff2:	48 89 c2             	mov    %rax,%rdx
+  800ff5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800ffc:	01 00 00 
+  800fff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801003:	83 e0 01             	and    $0x1,%eax
+  801006:	48 85 c0             	test   %rax,%rax
+  801009:	0f 84 b9 00 00 00    	je     8010c8 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80100f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801017:	48 01 d0             	add    %rdx,%rax
+  80101a:	48 c1 e8 15          	shr    $0x15,%rax
+  80101e:	48 89 c2             	mov    %rax,%rdx
+  801021:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  801028:	01 00 00 
+  80102b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80102f:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  801032:	48 85 c0             	test   %rax,%rax
+  801035:	0f 84 8d 00 00 00    	je     8010c8 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80103b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80103f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801043:	48 01 d0             	add    %rdx,%rax
+  801046:	48 c1 e8 0c          	shr    $0xc,%rax
+  80104a:	48 89 c2             	mov    %rax,%rdx
+  80104d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801054:	01 00 00 
+  801057:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80105b:	83 e0 01             	and    $0x1,%eax
+  80105e:	48 85 c0             	test   %rax,%rax
+  801061:	74 65                	je     8010c8 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801063:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801067:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80106b:	48 01 d0             	add    %rdx,%rax
+  80106e:	48 c1 e8 0c          	shr    $0xc,%rax
+  801072:	48 89 c2             	mov    %rax,%rdx
+  801075:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80107c:	01 00 00 
+  80107f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801083:	25 07 0e 00 00       	and    $0xe07,%eax
+  801088:	89 c6                	mov    %eax,%esi
+  80108a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80108e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801092:	48 01 c2             	add    %rax,%rdx
+  801095:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801099:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80109d:	48 01 c8             	add    %rcx,%rax
+  8010a0:	41 89 f0             	mov    %esi,%r8d
+  8010a3:	48 89 d1             	mov    %rdx,%rcx
+  8010a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ab:	48 89 c6             	mov    %rax,%rsi
+  8010ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b3:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8010ba:	00 00 00 
+  8010bd:	ff d0                	call   *%rax
+  8010bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010c6:	78 60                	js     801128 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8010c8:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8010cd:	0f 85 dc fe ff ff    	jne    800faf <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8010d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8010db:	48 89 c2             	mov    %rax,%rdx
+  8010de:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8010e5:	01 00 00 
+  8010e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8010ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8010f1:	89 c1                	mov    %eax,%ecx
+  8010f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010fb:	41 89 c8             	mov    %ecx,%r8d
+  8010fe:	48 89 d1             	mov    %rdx,%rcx
+  801101:	ba 00 00 00 00       	mov    $0x0,%edx
+  801106:	48 89 c6             	mov    %rax,%rsi
+  801109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80110e:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  801115:	00 00 00 
+  801118:	ff d0                	call   *%rax
+  80111a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80111d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801121:	78 08                	js     80112b <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  801123:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801126:	eb 5a                	jmp    801182 <dup+0x26a>
+        goto err;
+  801128:	90                   	nop
+  801129:	eb 01                	jmp    80112c <dup+0x214>
+    goto err;
+  80112b:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80112c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801130:	48 89 c6             	mov    %rax,%rsi
+  801133:	bf 00 00 00 00       	mov    $0x0,%edi
+  801138:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801144:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80114b:	00 
+  80114c:	eb 27                	jmp    801175 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80114e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801156:	48 01 d0             	add    %rdx,%rax
+  801159:	48 89 c6             	mov    %rax,%rsi
+  80115c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801161:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  801168:	00 00 00 
+  80116b:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80116d:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801174:	00 
+  801175:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80117c:	00 
+  80117d:	76 cf                	jbe    80114e <dup+0x236>
+  return r;
+  80117f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801182:	c9                   	leave
+  801183:	c3                   	ret
+
+0000000000801184 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801184:	55                   	push   %rbp
+  801185:	48 89 e5             	mov    %rsp,%rbp
+  801188:	48 83 ec 40          	sub    $0x40,%rsp
+  80118c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80118f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801193:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801197:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80119b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80119e:	48 89 d6             	mov    %rdx,%rsi
+  8011a1:	89 c7                	mov    %eax,%edi
+  8011a3:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  8011aa:	00 00 00 
+  8011ad:	ff d0                	call   *%rax
+  8011af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011b6:	78 24                	js     8011dc <read+0x58>
+  8011b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011bc:	8b 00                	mov    (%rax),%eax
+  8011be:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8011c2:	48 89 d6             	mov    %rdx,%rsi
+  8011c5:	89 c7                	mov    %eax,%edi
+  8011c7:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  8011ce:	00 00 00 
+  8011d1:	ff d0                	call   *%rax
+  8011d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8011da:	79 0a                	jns    8011e6 <read+0x62>
+    return r;
+  8011dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011df:	48 98                	cltq
+  8011e1:	e9 9e 00 00 00       	jmp    801284 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8011e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ea:	8b 40 08             	mov    0x8(%rax),%eax
+  8011ed:	83 e0 03             	and    $0x3,%eax
+  8011f0:	83 f8 01             	cmp    $0x1,%eax
+  8011f3:	75 5c                	jne    801251 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8011f5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8011fc:	00 00 00 
+  8011ff:	8b 40 04             	mov    0x4(%rax),%eax
+  801202:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801207:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80120e:	00 00 00 
+  801211:	48 98                	cltq
+  801213:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80121a:	48 01 d0             	add    %rdx,%rax
+  80121d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801223:	8b 00                	mov    (%rax),%eax
+  801225:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801228:	89 c6                	mov    %eax,%esi
+  80122a:	48 b8 7f 50 80 00 00 	movabs $0x80507f,%rax
+  801231:	00 00 00 
+  801234:	48 89 c7             	mov    %rax,%rdi
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	48 b9 c0 31 80 00 00 	movabs $0x8031c0,%rcx
+  801243:	00 00 00 
+  801246:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801248:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80124f:	eb 33                	jmp    801284 <read+0x100>
+  }
+  if (!dev->dev_read)
+  801251:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801255:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801259:	48 85 c0             	test   %rax,%rax
+  80125c:	75 09                	jne    801267 <read+0xe3>
+    return -E_NOT_SUPP;
+  80125e:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  801265:	eb 1d                	jmp    801284 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  801267:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80126b:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80126f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801273:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801277:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80127b:	48 89 ce             	mov    %rcx,%rsi
+  80127e:	48 89 c7             	mov    %rax,%rdi
+  801281:	41 ff d0             	call   *%r8
+}
+  801284:	c9                   	leave
+  801285:	c3                   	ret
+
+0000000000801286 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801286:	55                   	push   %rbp
+  801287:	48 89 e5             	mov    %rsp,%rbp
+  80128a:	48 83 ec 30          	sub    $0x30,%rsp
+  80128e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801291:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801295:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801299:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8012a0:	eb 49                	jmp    8012eb <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8012a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012a5:	48 98                	cltq
+  8012a7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012ab:	48 29 c2             	sub    %rax,%rdx
+  8012ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012b1:	48 63 c8             	movslq %eax,%rcx
+  8012b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012b8:	48 01 c1             	add    %rax,%rcx
+  8012bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012be:	48 89 ce             	mov    %rcx,%rsi
+  8012c1:	89 c7                	mov    %eax,%edi
+  8012c3:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  8012ca:	00 00 00 
+  8012cd:	ff d0                	call   *%rax
+  8012cf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8012d2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012d6:	79 07                	jns    8012df <readn+0x59>
+      return m;
+  8012d8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012db:	48 98                	cltq
+  8012dd:	eb 1f                	jmp    8012fe <readn+0x78>
+    if (m == 0)
+  8012df:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8012e3:	74 13                	je     8012f8 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8012e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012e8:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8012eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ee:	48 98                	cltq
+  8012f0:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012f4:	72 ac                	jb     8012a2 <readn+0x1c>
+  8012f6:	eb 01                	jmp    8012f9 <readn+0x73>
+      break;
+  8012f8:	90                   	nop
+  }
+  return tot;
+  8012f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012fc:	48 98                	cltq
+}
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+
+0000000000801300 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801300:	55                   	push   %rbp
+  801301:	48 89 e5             	mov    %rsp,%rbp
+  801304:	48 83 ec 40          	sub    $0x40,%rsp
+  801308:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80130b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80130f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801313:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801317:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80131a:	48 89 d6             	mov    %rdx,%rsi
+  80131d:	89 c7                	mov    %eax,%edi
+  80131f:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  801326:	00 00 00 
+  801329:	ff d0                	call   *%rax
+  80132b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80132e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801332:	78 24                	js     801358 <write+0x58>
+  801334:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801338:	8b 00                	mov    (%rax),%eax
+  80133a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80133e:	48 89 d6             	mov    %rdx,%rsi
+  801341:	89 c7                	mov    %eax,%edi
+  801343:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  80134a:	00 00 00 
+  80134d:	ff d0                	call   *%rax
+  80134f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801352:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801356:	79 0a                	jns    801362 <write+0x62>
+    return r;
+  801358:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80135b:	48 98                	cltq
+  80135d:	e9 9d 00 00 00       	jmp    8013ff <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801366:	8b 40 08             	mov    0x8(%rax),%eax
+  801369:	83 e0 03             	and    $0x3,%eax
+  80136c:	85 c0                	test   %eax,%eax
+  80136e:	75 5c                	jne    8013cc <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801370:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801377:	00 00 00 
+  80137a:	8b 40 04             	mov    0x4(%rax),%eax
+  80137d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801382:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801389:	00 00 00 
+  80138c:	48 98                	cltq
+  80138e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801395:	48 01 d0             	add    %rdx,%rax
+  801398:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80139e:	8b 00                	mov    (%rax),%eax
+  8013a0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8013a3:	89 c6                	mov    %eax,%esi
+  8013a5:	48 b8 9b 50 80 00 00 	movabs $0x80509b,%rax
+  8013ac:	00 00 00 
+  8013af:	48 89 c7             	mov    %rax,%rdi
+  8013b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b7:	48 b9 c0 31 80 00 00 	movabs $0x8031c0,%rcx
+  8013be:	00 00 00 
+  8013c1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8013c3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8013ca:	eb 33                	jmp    8013ff <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8013cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8013d4:	48 85 c0             	test   %rax,%rax
+  8013d7:	75 09                	jne    8013e2 <write+0xe2>
+    return -E_NOT_SUPP;
+  8013d9:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8013e0:	eb 1d                	jmp    8013ff <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8013e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e6:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8013ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8013f2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8013f6:	48 89 ce             	mov    %rcx,%rsi
+  8013f9:	48 89 c7             	mov    %rax,%rdi
+  8013fc:	41 ff d0             	call   *%r8
+}
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+
+0000000000801401 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801401:	55                   	push   %rbp
+  801402:	48 89 e5             	mov    %rsp,%rbp
+  801405:	48 83 ec 18          	sub    $0x18,%rsp
+  801409:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80140c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80140f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  801413:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801416:	48 89 d6             	mov    %rdx,%rsi
+  801419:	89 c7                	mov    %eax,%edi
+  80141b:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  801422:	00 00 00 
+  801425:	ff d0                	call   *%rax
+  801427:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80142a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80142e:	79 05                	jns    801435 <seek+0x34>
+    return r;
+  801430:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801433:	eb 0f                	jmp    801444 <seek+0x43>
+  fd->fd_offset = offset;
+  801435:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801439:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80143c:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+
+0000000000801446 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801446:	55                   	push   %rbp
+  801447:	48 89 e5             	mov    %rsp,%rbp
+  80144a:	48 83 ec 30          	sub    $0x30,%rsp
+  80144e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801451:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801454:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801458:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80145b:	48 89 d6             	mov    %rdx,%rsi
+  80145e:	89 c7                	mov    %eax,%edi
+  801460:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  801467:	00 00 00 
+  80146a:	ff d0                	call   *%rax
+  80146c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80146f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801473:	78 24                	js     801499 <ftruncate+0x53>
+  801475:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801479:	8b 00                	mov    (%rax),%eax
+  80147b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80147f:	48 89 d6             	mov    %rdx,%rsi
+  801482:	89 c7                	mov    %eax,%edi
+  801484:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  80148b:	00 00 00 
+  80148e:	ff d0                	call   *%rax
+  801490:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801493:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801497:	79 08                	jns    8014a1 <ftruncate+0x5b>
+    return r;
+  801499:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80149c:	e9 92 00 00 00       	jmp    801533 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a5:	8b 40 08             	mov    0x8(%rax),%eax
+  8014a8:	83 e0 03             	and    $0x3,%eax
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	75 5a                	jne    801509 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8014af:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8014b6:	00 00 00 
+  8014b9:	8b 40 04             	mov    0x4(%rax),%eax
+  8014bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014c1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8014c8:	00 00 00 
+  8014cb:	48 98                	cltq
+  8014cd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8014d4:	48 01 d0             	add    %rdx,%rax
+  8014d7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8014dd:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014df:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8014e2:	89 c6                	mov    %eax,%esi
+  8014e4:	48 b8 b8 50 80 00 00 	movabs $0x8050b8,%rax
+  8014eb:	00 00 00 
+  8014ee:	48 89 c7             	mov    %rax,%rdi
+  8014f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f6:	48 b9 c0 31 80 00 00 	movabs $0x8031c0,%rcx
+  8014fd:	00 00 00 
+  801500:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  801502:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801507:	eb 2a                	jmp    801533 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801509:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80150d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801511:	48 85 c0             	test   %rax,%rax
+  801514:	75 07                	jne    80151d <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  801516:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80151b:	eb 16                	jmp    801533 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80151d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801521:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  801525:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801529:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80152c:	89 d6                	mov    %edx,%esi
+  80152e:	48 89 c7             	mov    %rax,%rdi
+  801531:	ff d1                	call   *%rcx
+}
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+
+0000000000801535 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801535:	55                   	push   %rbp
+  801536:	48 89 e5             	mov    %rsp,%rbp
+  801539:	48 83 ec 30          	sub    $0x30,%rsp
+  80153d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801540:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801544:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801548:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80154b:	48 89 d6             	mov    %rdx,%rsi
+  80154e:	89 c7                	mov    %eax,%edi
+  801550:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  801557:	00 00 00 
+  80155a:	ff d0                	call   *%rax
+  80155c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80155f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801563:	78 24                	js     801589 <fstat+0x54>
+  801565:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801569:	8b 00                	mov    (%rax),%eax
+  80156b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80156f:	48 89 d6             	mov    %rdx,%rsi
+  801572:	89 c7                	mov    %eax,%edi
+  801574:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  80157b:	00 00 00 
+  80157e:	ff d0                	call   *%rax
+  801580:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801583:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801587:	79 05                	jns    80158e <fstat+0x59>
+    return r;
+  801589:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80158c:	eb 5e                	jmp    8015ec <fstat+0xb7>
+  if (!dev->dev_stat)
+  80158e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801592:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801596:	48 85 c0             	test   %rax,%rax
+  801599:	75 07                	jne    8015a2 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80159b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8015a0:	eb 4a                	jmp    8015ec <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8015a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015a6:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8015a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015ad:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8015b4:	00 00 00 
+  stat->st_isdir   = 0;
+  8015b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015bb:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8015c2:	00 00 00 
+  stat->st_dev     = dev;
+  8015c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015cd:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8015d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d8:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8015dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8015e4:	48 89 d6             	mov    %rdx,%rsi
+  8015e7:	48 89 c7             	mov    %rax,%rdi
+  8015ea:	ff d1                	call   *%rcx
+}
+  8015ec:	c9                   	leave
+  8015ed:	c3                   	ret
+
+00000000008015ee <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8015ee:	55                   	push   %rbp
+  8015ef:	48 89 e5             	mov    %rsp,%rbp
+  8015f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8015f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8015fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801602:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801608:	83 f8 20             	cmp    $0x20,%eax
+  80160b:	75 07                	jne    801614 <pollwait_key+0x26>
+    return -E_INVAL;
+  80160d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801612:	eb 5f                	jmp    801673 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  801614:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801618:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80161e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801622:	48 63 d2             	movslq %edx,%rdx
+  801625:	48 c1 e2 04          	shl    $0x4,%rdx
+  801629:	48 01 c2             	add    %rax,%rdx
+  80162c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801630:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  801633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801637:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80163d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801641:	8b 00                	mov    (%rax),%eax
+  801643:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801647:	48 63 c9             	movslq %ecx,%rcx
+  80164a:	48 c1 e1 04          	shl    $0x4,%rcx
+  80164e:	48 01 ca             	add    %rcx,%rdx
+  801651:	48 83 c2 08          	add    $0x8,%rdx
+  801655:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  801657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165b:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801661:	8d 50 01             	lea    0x1(%rax),%edx
+  801664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801668:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801673:	c9                   	leave
+  801674:	c3                   	ret
+
+0000000000801675 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801675:	55                   	push   %rbp
+  801676:	48 89 e5             	mov    %rsp,%rbp
+  801679:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  801680:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801687:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80168d:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801694:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80169b:	00 
+  int i, r, ready, ipc = 0;
+  80169c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8016a3:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8016aa:	00 
+  8016ab:	74 45                	je     8016f2 <poll+0x7d>
+  8016ad:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8016b4:	ff 
+  8016b5:	74 3b                	je     8016f2 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8016b7:	48 b8 b0 2b 80 00 00 	movabs $0x802bb0,%rax
+  8016be:	00 00 00 
+  8016c1:	ff d0                	call   *%rax
+  8016c3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8016c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016cb:	48 f7 d0             	not    %rax
+  8016ce:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8016d5:	73 10                	jae    8016e7 <poll+0x72>
+  8016d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016db:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8016e2:	48 01 d0             	add    %rdx,%rax
+  8016e5:	eb 07                	jmp    8016ee <poll+0x79>
+  8016e7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8016ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8016f2:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8016f9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  801700:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801707:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80170e:	e9 46 02 00 00       	jmp    801959 <poll+0x2e4>
+      fds[i].revents = 0;
+  801713:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801716:	48 63 d0             	movslq %eax,%rdx
+  801719:	48 89 d0             	mov    %rdx,%rax
+  80171c:	48 01 c0             	add    %rax,%rax
+  80171f:	48 01 d0             	add    %rdx,%rax
+  801722:	48 c1 e0 02          	shl    $0x2,%rax
+  801726:	48 89 c2             	mov    %rax,%rdx
+  801729:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801730:	48 01 d0             	add    %rdx,%rax
+  801733:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80173a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173d:	48 63 d0             	movslq %eax,%rdx
+  801740:	48 89 d0             	mov    %rdx,%rax
+  801743:	48 01 c0             	add    %rax,%rax
+  801746:	48 01 d0             	add    %rdx,%rax
+  801749:	48 c1 e0 02          	shl    $0x2,%rax
+  80174d:	48 89 c2             	mov    %rax,%rdx
+  801750:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801757:	48 01 d0             	add    %rdx,%rax
+  80175a:	8b 00                	mov    (%rax),%eax
+  80175c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80175f:	75 62                	jne    8017c3 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  801761:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801764:	48 63 d0             	movslq %eax,%rdx
+  801767:	48 89 d0             	mov    %rdx,%rax
+  80176a:	48 01 c0             	add    %rax,%rax
+  80176d:	48 01 d0             	add    %rdx,%rax
+  801770:	48 c1 e0 02          	shl    $0x2,%rax
+  801774:	48 89 c2             	mov    %rax,%rdx
+  801777:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80177e:	48 01 d0             	add    %rdx,%rax
+  801781:	8b 40 04             	mov    0x4(%rax),%eax
+  801784:	83 e0 01             	and    $0x1,%eax
+  801787:	85 c0                	test   %eax,%eax
+  801789:	0f 84 9b 01 00 00    	je     80192a <poll+0x2b5>
+          fds[i].revents = ipc;
+  80178f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801792:	48 63 d0             	movslq %eax,%rdx
+  801795:	48 89 d0             	mov    %rdx,%rax
+  801798:	48 01 c0             	add    %rax,%rax
+  80179b:	48 01 d0             	add    %rdx,%rax
+  80179e:	48 c1 e0 02          	shl    $0x2,%rax
+  8017a2:	48 89 c2             	mov    %rax,%rdx
+  8017a5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017ac:	48 01 c2             	add    %rax,%rdx
+  8017af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017b2:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8017b5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8017b8:	83 c8 04             	or     $0x4,%eax
+  8017bb:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8017be:	e9 67 01 00 00       	jmp    80192a <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017c6:	48 63 d0             	movslq %eax,%rdx
+  8017c9:	48 89 d0             	mov    %rdx,%rax
+  8017cc:	48 01 c0             	add    %rax,%rax
+  8017cf:	48 01 d0             	add    %rdx,%rax
+  8017d2:	48 c1 e0 02          	shl    $0x2,%rax
+  8017d6:	48 89 c2             	mov    %rax,%rdx
+  8017d9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017e0:	48 01 d0             	add    %rdx,%rax
+  8017e3:	8b 00                	mov    (%rax),%eax
+  8017e5:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8017ec:	48 89 d6             	mov    %rdx,%rsi
+  8017ef:	89 c7                	mov    %eax,%edi
+  8017f1:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  8017f8:	00 00 00 
+  8017fb:	ff d0                	call   *%rax
+  8017fd:	85 c0                	test   %eax,%eax
+  8017ff:	78 25                	js     801826 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  801801:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801808:	8b 00                	mov    (%rax),%eax
+  80180a:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  801811:	48 89 d6             	mov    %rdx,%rsi
+  801814:	89 c7                	mov    %eax,%edi
+  801816:	48 b8 c9 0d 80 00 00 	movabs $0x800dc9,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  801822:	85 c0                	test   %eax,%eax
+  801824:	79 2c                	jns    801852 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  801826:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801829:	48 63 d0             	movslq %eax,%rdx
+  80182c:	48 89 d0             	mov    %rdx,%rax
+  80182f:	48 01 c0             	add    %rax,%rax
+  801832:	48 01 d0             	add    %rdx,%rax
+  801835:	48 c1 e0 02          	shl    $0x2,%rax
+  801839:	48 89 c2             	mov    %rax,%rdx
+  80183c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801843:	48 01 d0             	add    %rdx,%rax
+  801846:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80184d:	e9 d8 00 00 00       	jmp    80192a <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  801852:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801859:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80185d:	48 85 c0             	test   %rax,%rax
+  801860:	74 7d                	je     8018df <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  801862:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  801869:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80186d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801870:	48 63 d0             	movslq %eax,%rdx
+  801873:	48 89 d0             	mov    %rdx,%rax
+  801876:	48 01 c0             	add    %rax,%rax
+  801879:	48 01 d0             	add    %rdx,%rax
+  80187c:	48 c1 e0 02          	shl    $0x2,%rax
+  801880:	48 89 c2             	mov    %rax,%rdx
+  801883:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80188a:	48 01 d0             	add    %rdx,%rax
+  80188d:	8b 48 04             	mov    0x4(%rax),%ecx
+  801890:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801897:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80189e:	89 ce                	mov    %ecx,%esi
+  8018a0:	48 89 c7             	mov    %rax,%rdi
+  8018a3:	41 ff d0             	call   *%r8
+  8018a6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8018a9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8018ad:	79 08                	jns    8018b7 <poll+0x242>
+          return r;
+  8018af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018b2:	e9 45 01 00 00       	jmp    8019fc <poll+0x387>
+        fds[i].revents = r;
+  8018b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ba:	48 63 d0             	movslq %eax,%rdx
+  8018bd:	48 89 d0             	mov    %rdx,%rax
+  8018c0:	48 01 c0             	add    %rax,%rax
+  8018c3:	48 01 d0             	add    %rdx,%rax
+  8018c6:	48 c1 e0 02          	shl    $0x2,%rax
+  8018ca:	48 89 c2             	mov    %rax,%rdx
+  8018cd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018d4:	48 01 c2             	add    %rax,%rdx
+  8018d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8018da:	89 42 08             	mov    %eax,0x8(%rdx)
+  8018dd:	eb 4b                	jmp    80192a <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8018df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018e2:	48 63 d0             	movslq %eax,%rdx
+  8018e5:	48 89 d0             	mov    %rdx,%rax
+  8018e8:	48 01 c0             	add    %rax,%rax
+  8018eb:	48 01 d0             	add    %rdx,%rax
+  8018ee:	48 c1 e0 02          	shl    $0x2,%rax
+  8018f2:	48 89 c2             	mov    %rax,%rdx
+  8018f5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018fc:	48 01 d0             	add    %rdx,%rax
+  8018ff:	8b 48 04             	mov    0x4(%rax),%ecx
+  801902:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801905:	48 63 d0             	movslq %eax,%rdx
+  801908:	48 89 d0             	mov    %rdx,%rax
+  80190b:	48 01 c0             	add    %rax,%rax
+  80190e:	48 01 d0             	add    %rdx,%rax
+  801911:	48 c1 e0 02          	shl    $0x2,%rax
+  801915:	48 89 c2             	mov    %rax,%rdx
+  801918:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80191f:	48 01 d0             	add    %rdx,%rax
+  801922:	83 e1 03             	and    $0x3,%ecx
+  801925:	89 ca                	mov    %ecx,%edx
+  801927:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80192a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80192d:	48 63 d0             	movslq %eax,%rdx
+  801930:	48 89 d0             	mov    %rdx,%rax
+  801933:	48 01 c0             	add    %rax,%rax
+  801936:	48 01 d0             	add    %rdx,%rax
+  801939:	48 c1 e0 02          	shl    $0x2,%rax
+  80193d:	48 89 c2             	mov    %rax,%rdx
+  801940:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801947:	48 01 d0             	add    %rdx,%rax
+  80194a:	8b 40 08             	mov    0x8(%rax),%eax
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	74 04                	je     801955 <poll+0x2e0>
+        ready++;
+  801951:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801955:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  801959:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80195c:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  801962:	0f 8c ab fd ff ff    	jl     801713 <poll+0x9e>
+    }
+    if (ready)
+  801968:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80196c:	74 08                	je     801976 <poll+0x301>
+      return ready;
+  80196e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801971:	e9 86 00 00 00       	jmp    8019fc <poll+0x387>
+
+    if (deadline) {
+  801976:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80197b:	74 30                	je     8019ad <poll+0x338>
+      now     = vsys_clock_ns();
+  80197d:	48 b8 b0 2b 80 00 00 	movabs $0x802bb0,%rax
+  801984:	00 00 00 
+  801987:	ff d0                	call   *%rax
+  801989:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80198d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801991:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801995:	73 0a                	jae    8019a1 <poll+0x32c>
+  801997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80199f:	eb 05                	jmp    8019a6 <poll+0x331>
+  8019a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a6:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8019ad:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019b0:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8019b3:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8019ba:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8019c1:	48 89 c7             	mov    %rax,%rdi
+  8019c4:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8019d3:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8019d7:	75 07                	jne    8019e0 <poll+0x36b>
+      return 0;
+  8019d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019de:	eb 1c                	jmp    8019fc <poll+0x387>
+    if (r < 0)
+  8019e0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8019e4:	79 05                	jns    8019eb <poll+0x376>
+      return r;
+  8019e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019e9:	eb 11                	jmp    8019fc <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8019eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019ee:	c1 f8 02             	sar    $0x2,%eax
+  8019f1:	83 e0 01             	and    $0x1,%eax
+  8019f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8019f7:	e9 f6 fc ff ff       	jmp    8016f2 <poll+0x7d>
+  }
+}
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+00000000008019fe <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	48 83 ec 20          	sub    $0x20,%rsp
+  801a06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  801a0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a12:	be 00 00 00 00       	mov    $0x0,%esi
+  801a17:	48 89 c7             	mov    %rax,%rdi
+  801a1a:	48 b8 ec 1a 80 00 00 	movabs $0x801aec,%rax
+  801a21:	00 00 00 
+  801a24:	ff d0                	call   *%rax
+  801a26:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801a29:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a2d:	79 05                	jns    801a34 <stat+0x36>
+    return fd;
+  801a2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a32:	eb 2f                	jmp    801a63 <stat+0x65>
+  r = fstat(fd, stat);
+  801a34:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a3b:	48 89 d6             	mov    %rdx,%rsi
+  801a3e:	89 c7                	mov    %eax,%edi
+  801a40:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  801a47:	00 00 00 
+  801a4a:	ff d0                	call   *%rax
+  801a4c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  801a4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a52:	89 c7                	mov    %eax,%edi
+  801a54:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  801a5b:	00 00 00 
+  801a5e:	ff d0                	call   *%rax
+  return r;
+  801a60:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+
+0000000000801a65 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  801a65:	55                   	push   %rbp
+  801a66:	48 89 e5             	mov    %rsp,%rbp
+  801a69:	48 83 ec 10          	sub    $0x10,%rsp
+  801a6d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a74:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a7b:	00 00 00 
+  801a7e:	8b 00                	mov    (%rax),%eax
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	75 1d                	jne    801aa1 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a84:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a89:	48 b8 b8 4e 80 00 00 	movabs $0x804eb8,%rax
+  801a90:	00 00 00 
+  801a93:	ff d0                	call   *%rax
+  801a95:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a9c:	00 00 00 
+  801a9f:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801aa1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801aa8:	00 00 00 
+  801aab:	8b 00                	mov    (%rax),%eax
+  801aad:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801ab0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ab5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801abc:	00 00 00 
+  801abf:	89 c7                	mov    %eax,%edi
+  801ac1:	48 b8 0b 4e 80 00 00 	movabs $0x804e0b,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801acd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad6:	48 89 c6             	mov    %rax,%rsi
+  801ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ade:	48 b8 8e 4c 80 00 00 	movabs $0x804c8e,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+}
+  801aea:	c9                   	leave
+  801aeb:	c3                   	ret
+
+0000000000801aec <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801aec:	55                   	push   %rbp
+  801aed:	48 89 e5             	mov    %rsp,%rbp
+  801af0:	48 83 ec 20          	sub    $0x20,%rsp
+  801af4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801af8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801afb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aff:	48 89 c7             	mov    %rax,%rdi
+  801b02:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  801b09:	00 00 00 
+  801b0c:	ff d0                	call   *%rax
+  801b0e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b13:	7e 0a                	jle    801b1f <open+0x33>
+    return -E_BAD_PATH;
+  801b15:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b1a:	e9 a8 00 00 00       	jmp    801bc7 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801b1f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801b23:	48 89 c7             	mov    %rax,%rdi
+  801b26:	48 b8 46 0b 80 00 00 	movabs $0x800b46,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+  801b32:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b35:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b39:	79 08                	jns    801b43 <open+0x57>
+    return r;
+  801b3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b3e:	e9 84 00 00 00       	jmp    801bc7 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b47:	48 89 c6             	mov    %rax,%rsi
+  801b4a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801b51:	00 00 00 
+  801b54:	48 89 c7             	mov    %rax,%rdi
+  801b57:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801b63:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b6a:	00 00 00 
+  801b6d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b70:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7a:	48 89 c6             	mov    %rax,%rsi
+  801b7d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b82:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b95:	79 1d                	jns    801bb4 <open+0xc8>
+    fd_close(fd, 0);
+  801b97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba0:	48 89 c7             	mov    %rax,%rdi
+  801ba3:	48 b8 fe 0c 80 00 00 	movabs $0x800cfe,%rax
+  801baa:	00 00 00 
+  801bad:	ff d0                	call   *%rax
+    return r;
+  801baf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bb2:	eb 13                	jmp    801bc7 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801bb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb8:	48 89 c7             	mov    %rax,%rdi
+  801bbb:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+}
+  801bc7:	c9                   	leave
+  801bc8:	c3                   	ret
+
+0000000000801bc9 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801bc9:	55                   	push   %rbp
+  801bca:	48 89 e5             	mov    %rsp,%rbp
+  801bcd:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd9:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bdc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801be3:	00 00 00 
+  801be6:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801be8:	be 00 00 00 00       	mov    $0x0,%esi
+  801bed:	bf 06 00 00 00       	mov    $0x6,%edi
+  801bf2:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801bf9:	00 00 00 
+  801bfc:	ff d0                	call   *%rax
+}
+  801bfe:	c9                   	leave
+  801bff:	c3                   	ret
+
+0000000000801c00 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+  801c04:	48 83 ec 30          	sub    $0x30,%rsp
+  801c08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c0c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c10:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c14:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c19:	74 07                	je     801c22 <devfile_read+0x22>
+  801c1b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801c20:	75 0a                	jne    801c2c <devfile_read+0x2c>
+  return E_INVAL;
+  801c22:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c27:	e9 b4 00 00 00       	jmp    801ce0 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801c2c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801c33:	00 
+  while (n) {
+  801c34:	e9 98 00 00 00       	jmp    801cd1 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801c40:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c47:	00 00 00 
+  801c4a:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801c4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801c53:	00 00 00 
+  801c56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801c63:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c68:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+  801c74:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c77:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c7b:	7f 13                	jg     801c90 <devfile_read+0x90>
+      return res ? res : res0;
+  801c7d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c81:	74 07                	je     801c8a <devfile_read+0x8a>
+  801c83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c86:	48 98                	cltq
+  801c88:	eb 56                	jmp    801ce0 <devfile_read+0xe0>
+  801c8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8e:	eb 50                	jmp    801ce0 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c93:	48 63 d0             	movslq %eax,%rdx
+  801c96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c9a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801ca1:	00 00 00 
+  801ca4:	48 89 ce             	mov    %rcx,%rsi
+  801ca7:	48 89 c7             	mov    %rax,%rdi
+  801caa:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+
+    buf += res;
+  801cb6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cb9:	48 98                	cltq
+  801cbb:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801cbf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801cc2:	48 98                	cltq
+  801cc4:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801cc8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ccb:	48 98                	cltq
+  801ccd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801cd1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cd6:	0f 85 5d ff ff ff    	jne    801c39 <devfile_read+0x39>
+  }
+
+  return res0;
+  801cdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801ce0:	c9                   	leave
+  801ce1:	c3                   	ret
+
+0000000000801ce2 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801ce2:	55                   	push   %rbp
+  801ce3:	48 89 e5             	mov    %rsp,%rbp
+  801ce6:	48 83 ec 50          	sub    $0x50,%rsp
+  801cea:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801cee:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801cf2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801cf6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801cfb:	74 07                	je     801d04 <devfile_write+0x22>
+  801cfd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801d02:	75 0a                	jne    801d0e <devfile_write+0x2c>
+  return E_INVAL;
+  801d04:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d09:	e9 c9 00 00 00       	jmp    801dd7 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801d0e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801d15:	00 
+
+  while (n) {
+  801d16:	e9 ad 00 00 00       	jmp    801dc8 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801d1b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801d1f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801d23:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801d2a:	00 
+  801d2b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d33:	48 39 c2             	cmp    %rax,%rdx
+  801d36:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801d3a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801d3e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801d42:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d46:	48 89 c6             	mov    %rax,%rsi
+  801d49:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801d50:	00 00 00 
+  801d53:	48 89 c7             	mov    %rax,%rdi
+  801d56:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  801d5d:	00 00 00 
+  801d60:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d66:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d69:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d70:	00 00 00 
+  801d73:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d75:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d7c:	00 00 00 
+  801d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d83:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d87:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d91:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801da0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801da4:	79 07                	jns    801dad <devfile_write+0xcb>
+      return res;
+  801da6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801da9:	48 98                	cltq
+  801dab:	eb 2a                	jmp    801dd7 <devfile_write+0xf5>
+
+    buf += res;
+  801dad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801db0:	48 98                	cltq
+  801db2:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801db6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801db9:	48 98                	cltq
+  801dbb:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801dbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dc2:	48 98                	cltq
+  801dc4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801dc8:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801dcd:	0f 85 48 ff ff ff    	jne    801d1b <devfile_write+0x39>
+  }
+
+  return res0;
+  801dd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+
+0000000000801dd9 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801dd9:	55                   	push   %rbp
+  801dda:	48 89 e5             	mov    %rsp,%rbp
+  801ddd:	48 83 ec 20          	sub    $0x20,%rsp
+  801de1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801de5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801de9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ded:	8b 40 0c             	mov    0xc(%rax),%eax
+  801df0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801df7:	00 00 00 
+  801dfa:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dfc:	be 00 00 00 00       	mov    $0x0,%esi
+  801e01:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e06:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+  801e12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801e15:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e19:	79 05                	jns    801e20 <devfile_stat+0x47>
+    return r;
+  801e1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e1e:	eb 59                	jmp    801e79 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e24:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e2b:	00 00 00 
+  801e2e:	48 89 d6             	mov    %rdx,%rsi
+  801e31:	48 89 c7             	mov    %rax,%rdi
+  801e34:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  801e3b:	00 00 00 
+  801e3e:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801e40:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e47:	00 00 00 
+  801e4a:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801e50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e54:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e5a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e61:	00 00 00 
+  801e64:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801e6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e6e:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e79:	c9                   	leave
+  801e7a:	c3                   	ret
+
+0000000000801e7b <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e7b:	55                   	push   %rbp
+  801e7c:	48 89 e5             	mov    %rsp,%rbp
+  801e7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e87:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e91:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e98:	00 00 00 
+  801e9b:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e9d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801ea4:	00 00 00 
+  801ea7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801eaa:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ead:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb2:	bf 02 00 00 00       	mov    $0x2,%edi
+  801eb7:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801ebe:	00 00 00 
+  801ec1:	ff d0                	call   *%rax
+}
+  801ec3:	c9                   	leave
+  801ec4:	c3                   	ret
+
+0000000000801ec5 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801ec5:	55                   	push   %rbp
+  801ec6:	48 89 e5             	mov    %rsp,%rbp
+  801ec9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ecd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ed1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801ed4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801ed8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801edb:	83 e0 03             	and    $0x3,%eax
+}
+  801ede:	c9                   	leave
+  801edf:	c3                   	ret
+
+0000000000801ee0 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+  801ee4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef0:	48 89 c7             	mov    %rax,%rdi
+  801ef3:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+  801eff:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f04:	7e 07                	jle    801f0d <remove+0x2d>
+    return -E_BAD_PATH;
+  801f06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f0b:	eb 36                	jmp    801f43 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801f0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f11:	48 89 c6             	mov    %rax,%rsi
+  801f14:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f1b:	00 00 00 
+  801f1e:	48 89 c7             	mov    %rax,%rdi
+  801f21:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  801f28:	00 00 00 
+  801f2b:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f32:	bf 07 00 00 00       	mov    $0x7,%edi
+  801f37:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+}
+  801f43:	c9                   	leave
+  801f44:	c3                   	ret
+
+0000000000801f45 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801f45:	55                   	push   %rbp
+  801f46:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f49:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4e:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f53:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+}
+  801f5f:	5d                   	pop    %rbp
+  801f60:	c3                   	ret
+
+0000000000801f61 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	48 83 ec 20          	sub    $0x20,%rsp
+  801f69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f72:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f77:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f86:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f8a:	79 05                	jns    801f91 <fs_stats+0x30>
+    return r;
+  801f8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f8f:	eb 2a                	jmp    801fbb <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f95:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f9a:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801fa1:	00 00 00 
+  801fa4:	48 89 ce             	mov    %rcx,%rsi
+  801fa7:	48 89 c7             	mov    %rax,%rdi
+  801faa:	48 b8 b3 46 80 00 00 	movabs $0x8046b3,%rax
+  801fb1:	00 00 00 
+  801fb4:	ff d0                	call   *%rax
+  return 0;
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbb:	c9                   	leave
+  801fbc:	c3                   	ret
+
+0000000000801fbd <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801fbd:	55                   	push   %rbp
+  801fbe:	48 89 e5             	mov    %rsp,%rbp
+  801fc1:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801fc8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801fcf:	00 00 00 
+  801fd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fd5:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801fd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801fdc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801fe1:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+
+0000000000801fef <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff7:	89 f8                	mov    %edi,%eax
+  801ff9:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801ffc:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  802000:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802007:	00 00 00 
+  80200a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  80200c:	be 00 00 00 00       	mov    $0x0,%esi
+  802011:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802016:	48 b8 65 1a 80 00 00 	movabs $0x801a65,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+}
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+0000000000802024 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+  802028:	48 83 ec 10          	sub    $0x10,%rsp
+  80202c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  802030:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802034:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  802039:	48 89 c7             	mov    %rax,%rdi
+  80203c:	48 b8 4a 20 80 00 00 	movabs $0x80204a,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+}
+  802048:	c9                   	leave
+  802049:	c3                   	ret
+
+000000000080204a <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  80204a:	55                   	push   %rbp
+  80204b:	48 89 e5             	mov    %rsp,%rbp
+  80204e:	48 83 ec 50          	sub    $0x50,%rsp
+  802052:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802056:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  80205a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802061:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  802062:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  802067:	74 0a                	je     802073 <pipe_size+0x29>
+  802069:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  802070:	00 
+  802071:	76 0a                	jbe    80207d <pipe_size+0x33>
+    return -E_INVAL;
+  802073:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802078:	e9 cc 02 00 00       	jmp    802349 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80207d:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  802081:	48 89 c7             	mov    %rax,%rdi
+  802084:	48 b8 46 0b 80 00 00 	movabs $0x800b46,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802093:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802097:	0f 88 a8 02 00 00    	js     802345 <pipe_size+0x2fb>
+  80209d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020a6:	48 89 c6             	mov    %rax,%rsi
+  8020a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ae:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  8020b5:	00 00 00 
+  8020b8:	ff d0                	call   *%rax
+  8020ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020c1:	0f 88 7e 02 00 00    	js     802345 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020c7:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8020cb:	48 89 c7             	mov    %rax,%rdi
+  8020ce:	48 b8 46 0b 80 00 00 	movabs $0x800b46,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020e1:	0f 88 43 02 00 00    	js     80232a <pipe_size+0x2e0>
+  8020e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8020eb:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020f0:	48 89 c6             	mov    %rax,%rsi
+  8020f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f8:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+  802104:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802107:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80210b:	0f 88 19 02 00 00    	js     80232a <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  802111:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802115:	48 89 c7             	mov    %rax,%rdi
+  802118:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+  802124:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  802128:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80212f:	00 
+  802130:	e9 a2 00 00 00       	jmp    8021d7 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802135:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802139:	48 c1 e0 0c          	shl    $0xc,%rax
+  80213d:	48 89 c2             	mov    %rax,%rdx
+  802140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802144:	48 01 d0             	add    %rdx,%rax
+  802147:	ba 07 04 00 00       	mov    $0x407,%edx
+  80214c:	48 89 c6             	mov    %rax,%rsi
+  80214f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802154:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+  802160:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802163:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802167:	0f 88 37 01 00 00    	js     8022a4 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80216d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802171:	48 89 c7             	mov    %rax,%rdi
+  802174:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+  802180:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802184:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802188:	48 01 c2             	add    %rax,%rdx
+  80218b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80218f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802193:	48 89 c1             	mov    %rax,%rcx
+  802196:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80219a:	48 01 c8             	add    %rcx,%rax
+  80219d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8021a3:	48 89 d1             	mov    %rdx,%rcx
+  8021a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ab:	48 89 c6             	mov    %rax,%rsi
+  8021ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b3:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8021ba:	00 00 00 
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8021c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021c6:	79 0a                	jns    8021d2 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8021c8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8021cd:	e9 d3 00 00 00       	jmp    8022a5 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8021d2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8021d7:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8021de:	00 
+  8021df:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021e7:	48 01 d0             	add    %rdx,%rax
+  8021ea:	48 83 c0 1f          	add    $0x1f,%rax
+  8021ee:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8021f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fb:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8021ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802203:	48 29 d0             	sub    %rdx,%rax
+  802206:	48 c1 e8 0c          	shr    $0xc,%rax
+  80220a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80220e:	0f 82 21 ff ff ff    	jb     802135 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  802214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802218:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80221c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802220:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802224:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  802228:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80222c:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802233:	00 00 00 
+  802236:	8b 12                	mov    (%rdx),%edx
+  802238:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80223a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80223e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  802245:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802249:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  802250:	00 00 00 
+  802253:	8b 12                	mov    (%rdx),%edx
+  802255:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  802257:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80225b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  802262:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802266:	48 89 c7             	mov    %rax,%rdi
+  802269:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	89 c2                	mov    %eax,%edx
+  802277:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80227b:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80227d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802281:	48 89 c7             	mov    %rax,%rdi
+  802284:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802294:	48 83 c2 04          	add    $0x4,%rdx
+  802298:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80229a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229f:	e9 a5 00 00 00       	jmp    802349 <pipe_size+0x2ff>
+      goto err2;
+  8022a4:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8022a5:	eb 58                	jmp    8022ff <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8022a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ab:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022af:	48 89 c2             	mov    %rax,%rdx
+  8022b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b6:	48 01 d0             	add    %rdx,%rax
+  8022b9:	48 89 c6             	mov    %rax,%rsi
+  8022bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c1:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  8022c8:	00 00 00 
+  8022cb:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8022cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022d1:	48 89 c7             	mov    %rax,%rdi
+  8022d4:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022e4:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8022e8:	48 01 d0             	add    %rdx,%rax
+  8022eb:	48 89 c6             	mov    %rax,%rsi
+  8022ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f3:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8022ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802303:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802307:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80230b:	48 85 c0             	test   %rax,%rax
+  80230e:	75 97                	jne    8022a7 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  802310:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802314:	48 89 c6             	mov    %rax,%rsi
+  802317:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231c:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	eb 01                	jmp    80232b <pipe_size+0x2e1>
+    goto err1;
+  80232a:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80232b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80232f:	48 89 c6             	mov    %rax,%rsi
+  802332:	bf 00 00 00 00       	mov    $0x0,%edi
+  802337:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+  802343:	eb 01                	jmp    802346 <pipe_size+0x2fc>
+    goto err;
+  802345:	90                   	nop
+err:
+  return r;
+  802346:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802349:	c9                   	leave
+  80234a:	c3                   	ret
+
+000000000080234b <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80234b:	55                   	push   %rbp
+  80234c:	48 89 e5             	mov    %rsp,%rbp
+  80234f:	53                   	push   %rbx
+  802350:	48 83 ec 28          	sub    $0x28,%rsp
+  802354:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802358:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80235c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802363:	00 00 00 
+  802366:	8b 40 04             	mov    0x4(%rax),%eax
+  802369:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80236e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802375:	00 00 00 
+  802378:	48 98                	cltq
+  80237a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802381:	48 01 d0             	add    %rdx,%rax
+  802384:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80238a:	8b 00                	mov    (%rax),%eax
+  80238c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80238f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802393:	48 89 c7             	mov    %rax,%rdi
+  802396:	48 b8 29 4f 80 00 00 	movabs $0x804f29,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+  8023a2:	89 c3                	mov    %eax,%ebx
+  8023a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023a8:	48 89 c7             	mov    %rax,%rdi
+  8023ab:	48 b8 29 4f 80 00 00 	movabs $0x804f29,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	39 c3                	cmp    %eax,%ebx
+  8023b9:	0f 94 c0             	sete   %al
+  8023bc:	0f b6 c0             	movzbl %al,%eax
+  8023bf:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8023c2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023c9:	00 00 00 
+  8023cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8023cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023d4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023db:	00 00 00 
+  8023de:	48 98                	cltq
+  8023e0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023e7:	48 01 d0             	add    %rdx,%rax
+  8023ea:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023f0:	8b 00                	mov    (%rax),%eax
+  8023f2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8023f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023f8:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8023fb:	75 05                	jne    802402 <_pipeisclosed+0xb7>
+      return ret;
+  8023fd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802400:	eb 68                	jmp    80246a <_pipeisclosed+0x11f>
+    if (n != nn)
+  802402:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802405:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802408:	0f 84 4e ff ff ff    	je     80235c <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80240e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802415:	00 00 00 
+  802418:	8b 40 04             	mov    0x4(%rax),%eax
+  80241b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802420:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802427:	00 00 00 
+  80242a:	48 98                	cltq
+  80242c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802433:	48 01 d0             	add    %rdx,%rax
+  802436:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80243c:	8b 10                	mov    (%rax),%edx
+  80243e:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  802441:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802444:	89 c6                	mov    %eax,%esi
+  802446:	48 b8 e8 50 80 00 00 	movabs $0x8050e8,%rax
+  80244d:	00 00 00 
+  802450:	48 89 c7             	mov    %rax,%rdi
+  802453:	b8 00 00 00 00       	mov    $0x0,%eax
+  802458:	49 b8 c0 31 80 00 00 	movabs $0x8031c0,%r8
+  80245f:	00 00 00 
+  802462:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  802465:	e9 f2 fe ff ff       	jmp    80235c <_pipeisclosed+0x11>
+  }
+}
+  80246a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80246e:	c9                   	leave
+  80246f:	c3                   	ret
+
+0000000000802470 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	48 83 ec 30          	sub    $0x30,%rsp
+  802478:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80247b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80247f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802482:	48 89 d6             	mov    %rdx,%rsi
+  802485:	89 c7                	mov    %eax,%edi
+  802487:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802496:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80249a:	79 05                	jns    8024a1 <pipeisclosed+0x31>
+    return r;
+  80249c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80249f:	eb 31                	jmp    8024d2 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8024a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024a5:	48 89 c7             	mov    %rax,%rdi
+  8024a8:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  8024af:	00 00 00 
+  8024b2:	ff d0                	call   *%rax
+  8024b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8024b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024c0:	48 89 d6             	mov    %rdx,%rsi
+  8024c3:	48 89 c7             	mov    %rax,%rdi
+  8024c6:	48 b8 4b 23 80 00 00 	movabs $0x80234b,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+}
+  8024d2:	c9                   	leave
+  8024d3:	c3                   	ret
+
+00000000008024d4 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8024d4:	55                   	push   %rbp
+  8024d5:	48 89 e5             	mov    %rsp,%rbp
+  8024d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8024dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8024e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e4:	8b 40 18             	mov    0x18(%rax),%eax
+  8024e7:	8d 50 01             	lea    0x1(%rax),%edx
+  8024ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024ee:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8024f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f5:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	74 27                	je     802523 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8024fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802500:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  802507:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80250b:	48 83 c0 18          	add    $0x18,%rax
+  80250f:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  802514:	48 89 c7             	mov    %rax,%rdi
+  802517:	48 b8 0c 08 80 00 00 	movabs $0x80080c,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  }
+}
+  802523:	90                   	nop
+  802524:	c9                   	leave
+  802525:	c3                   	ret
+
+0000000000802526 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	48 83 ec 10          	sub    $0x10,%rsp
+  80252e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802532:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  802535:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802539:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  802540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802544:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  802548:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80254b:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  802552:	89 c6                	mov    %eax,%esi
+  802554:	48 89 cf             	mov    %rcx,%rdi
+  802557:	48 b8 bd 07 80 00 00 	movabs $0x8007bd,%rax
+  80255e:	00 00 00 
+  802561:	ff d0                	call   *%rax
+}
+  802563:	90                   	nop
+  802564:	c9                   	leave
+  802565:	c3                   	ret
+
+0000000000802566 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	48 83 ec 70          	sub    $0x70,%rsp
+  80256e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802572:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802576:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80257a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80257e:	48 89 c7             	mov    %rax,%rdi
+  802581:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  802591:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802596:	75 0a                	jne    8025a2 <devpipe_read+0x3c>
+    return 0;
+  802598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259d:	e9 63 01 00 00       	jmp    802705 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8025a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a6:	8b 40 18             	mov    0x18(%rax),%eax
+  8025a9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8025ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b0:	48 8b 10             	mov    (%rax),%rdx
+  8025b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025bb:	48 39 c2             	cmp    %rax,%rdx
+  8025be:	75 42                	jne    802602 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8025c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025c4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8025c8:	48 89 d6             	mov    %rdx,%rsi
+  8025cb:	48 89 c7             	mov    %rax,%rdi
+  8025ce:	48 b8 4b 23 80 00 00 	movabs $0x80234b,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	74 0a                	je     8025e8 <devpipe_read+0x82>
+      return 0;
+  8025de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e3:	e9 1d 01 00 00       	jmp    802705 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8025e8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8025eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ef:	89 d6                	mov    %edx,%esi
+  8025f1:	48 89 c7             	mov    %rax,%rdi
+  8025f4:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  8025fb:	00 00 00 
+  8025fe:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  802600:	eb a0                	jmp    8025a2 <devpipe_read+0x3c>
+      break;
+  802602:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  802603:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802607:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80260b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80260f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802617:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80261b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80261f:	48 8b 00             	mov    (%rax),%rax
+  802622:	48 29 c2             	sub    %rax,%rdx
+  802625:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802629:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80262d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802631:	48 39 c2             	cmp    %rax,%rdx
+  802634:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802638:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80263c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802640:	48 8b 00             	mov    (%rax),%rax
+  802643:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802647:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80264b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802650:	48 f7 f1             	div    %rcx
+  802653:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  802657:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80265b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80265f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802663:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802667:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80266b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80266f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802673:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802677:	48 39 c2             	cmp    %rax,%rdx
+  80267a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80267e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  802682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802686:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80268a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80268e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  802692:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802696:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80269a:	48 89 ce             	mov    %rcx,%rsi
+  80269d:	48 89 c7             	mov    %rax,%rdi
+  8026a0:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8026ac:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8026b0:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8026b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026b8:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8026bc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026c0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8026c4:	48 01 d1             	add    %rdx,%rcx
+  8026c7:	48 89 c2             	mov    %rax,%rdx
+  8026ca:	48 89 cf             	mov    %rcx,%rdi
+  8026cd:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  8026d4:	00 00 00 
+  8026d7:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8026d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026dd:	48 8b 10             	mov    (%rax),%rdx
+  8026e0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8026e4:	48 01 c2             	add    %rax,%rdx
+  8026e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026eb:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8026ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f2:	48 89 c7             	mov    %rax,%rdi
+  8026f5:	48 b8 d4 24 80 00 00 	movabs $0x8024d4,%rax
+  8026fc:	00 00 00 
+  8026ff:	ff d0                	call   *%rax
+  return n;
+  802701:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802705:	c9                   	leave
+  802706:	c3                   	ret
+
+0000000000802707 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802707:	55                   	push   %rbp
+  802708:	48 89 e5             	mov    %rsp,%rbp
+  80270b:	48 83 ec 70          	sub    $0x70,%rsp
+  80270f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802713:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802717:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80271b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80271f:	48 89 c7             	mov    %rax,%rdi
+  802722:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+  80272e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  802732:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802736:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80273a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802741:	00 
+  802742:	e9 b8 01 00 00       	jmp    8028ff <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  802747:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80274b:	8b 40 18             	mov    0x18(%rax),%eax
+  80274e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  802751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802755:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802759:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80275d:	48 8b 00             	mov    (%rax),%rax
+  802760:	48 29 c2             	sub    %rax,%rdx
+  802763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802767:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80276b:	48 39 c2             	cmp    %rax,%rdx
+  80276e:	75 4d                	jne    8027bd <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  802770:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802774:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802778:	48 89 d6             	mov    %rdx,%rsi
+  80277b:	48 89 c7             	mov    %rax,%rdi
+  80277e:	48 b8 4b 23 80 00 00 	movabs $0x80234b,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	74 0a                	je     802798 <devpipe_write+0x91>
+        return 0;
+  80278e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802793:	e9 79 01 00 00       	jmp    802911 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802798:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80279b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80279f:	89 d6                	mov    %edx,%esi
+  8027a1:	48 89 c7             	mov    %rax,%rdi
+  8027a4:	48 b8 26 25 80 00 00 	movabs $0x802526,%rax
+  8027ab:	00 00 00 
+  8027ae:	ff d0                	call   *%rax
+      m = 0;
+  8027b0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8027b7:	00 
+      continue;
+  8027b8:	e9 3a 01 00 00       	jmp    8028f7 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8027bd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8027c1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8027c5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8027c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027cd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8027d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027d5:	48 8b 08             	mov    (%rax),%rcx
+  8027d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027e0:	48 29 c1             	sub    %rax,%rcx
+  8027e3:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8027e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8027eb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027f3:	48 39 c2             	cmp    %rax,%rdx
+  8027f6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8027fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802802:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802806:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80280a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80280e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802813:	48 f7 f1             	div    %rcx
+  802816:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  80281a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80281e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802826:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80282a:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80282e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802832:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802836:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80283a:	48 39 c2             	cmp    %rax,%rdx
+  80283d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802841:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802845:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802849:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80284d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802851:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  802855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802859:	48 01 d1             	add    %rdx,%rcx
+  80285c:	48 89 c2             	mov    %rax,%rdx
+  80285f:	48 89 cf             	mov    %rcx,%rdi
+  802862:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  802869:	00 00 00 
+  80286c:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80286e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802872:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802876:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80287a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80287e:	73 4d                	jae    8028cd <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  802880:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802884:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802888:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80288c:	48 29 c2             	sub    %rax,%rdx
+  80288f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802893:	48 01 c2             	add    %rax,%rdx
+  802896:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80289a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80289e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8028a2:	48 89 c1             	mov    %rax,%rcx
+  8028a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a9:	48 01 c1             	add    %rax,%rcx
+  8028ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028b0:	48 01 c1             	add    %rax,%rcx
+  8028b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028b7:	48 83 c0 20          	add    $0x20,%rax
+  8028bb:	48 89 ce             	mov    %rcx,%rsi
+  8028be:	48 89 c7             	mov    %rax,%rdi
+  8028c1:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  8028c8:	00 00 00 
+  8028cb:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8028cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028d1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8028d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d9:	48 01 c2             	add    %rax,%rdx
+  8028dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028e0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8028e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028e8:	48 89 c7             	mov    %rax,%rdi
+  8028eb:	48 b8 d4 24 80 00 00 	movabs $0x8024d4,%rax
+  8028f2:	00 00 00 
+  8028f5:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8028f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028fb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8028ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802903:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802907:	0f 82 3a fe ff ff    	jb     802747 <devpipe_write+0x40>
+  }
+
+  return i;
+  80290d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+
+0000000000802913 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802913:	55                   	push   %rbp
+  802914:	48 89 e5             	mov    %rsp,%rbp
+  802917:	48 83 ec 40          	sub    $0x40,%rsp
+  80291b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80291f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  802922:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802926:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80292a:	48 89 c7             	mov    %rax,%rdi
+  80292d:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  802934:	00 00 00 
+  802937:	ff d0                	call   *%rax
+  802939:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80293d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  802944:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802948:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80294c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802950:	48 89 d6             	mov    %rdx,%rsi
+  802953:	48 89 c7             	mov    %rax,%rdi
+  802956:	48 b8 ee 15 80 00 00 	movabs $0x8015ee,%rax
+  80295d:	00 00 00 
+  802960:	ff d0                	call   *%rax
+  802962:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802965:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802969:	79 08                	jns    802973 <devpipe_poll+0x60>
+    return r;
+  80296b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80296e:	e9 85 00 00 00       	jmp    8029f8 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  802973:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802976:	83 e0 01             	and    $0x1,%eax
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	74 18                	je     802995 <devpipe_poll+0x82>
+  80297d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802981:	48 8b 10             	mov    (%rax),%rdx
+  802984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802988:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80298c:	48 39 c2             	cmp    %rax,%rdx
+  80298f:	74 04                	je     802995 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  802991:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802995:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802998:	83 e0 02             	and    $0x2,%eax
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	74 23                	je     8029c2 <devpipe_poll+0xaf>
+  80299f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029a3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8029a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029ab:	48 8b 00             	mov    (%rax),%rax
+  8029ae:	48 29 c2             	sub    %rax,%rdx
+  8029b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029b5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8029b9:	48 39 c2             	cmp    %rax,%rdx
+  8029bc:	73 04                	jae    8029c2 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8029be:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8029c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029ca:	48 89 d6             	mov    %rdx,%rsi
+  8029cd:	48 89 c7             	mov    %rax,%rdi
+  8029d0:	48 b8 4b 23 80 00 00 	movabs $0x80234b,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	74 04                	je     8029e4 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8029e0:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8029e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029e8:	75 0b                	jne    8029f5 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8029ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029ee:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8029f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+00000000008029fa <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8029fa:	55                   	push   %rbp
+  8029fb:	48 89 e5             	mov    %rsp,%rbp
+  8029fe:	48 83 ec 20          	sub    $0x20,%rsp
+  802a02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a06:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a0e:	48 89 c7             	mov    %rax,%rdi
+  802a11:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+  802a1d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  802a21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a25:	48 ba 19 51 80 00 00 	movabs $0x805119,%rdx
+  802a2c:	00 00 00 
+  802a2f:	48 89 d6             	mov    %rdx,%rsi
+  802a32:	48 89 c7             	mov    %rax,%rdi
+  802a35:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  802a3c:	00 00 00 
+  802a3f:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  802a41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a45:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a49:	89 c1                	mov    %eax,%ecx
+  802a4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a4f:	48 8b 00             	mov    (%rax),%rax
+  802a52:	89 c2                	mov    %eax,%edx
+  802a54:	89 c8                	mov    %ecx,%eax
+  802a56:	29 d0                	sub    %edx,%eax
+  802a58:	89 c2                	mov    %eax,%edx
+  802a5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a5e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  802a64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a68:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  802a6f:	00 00 00 
+  stat->st_dev   = &devpipe;
+  802a72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a76:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a7d:	00 00 00 
+  802a80:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a8c:	c9                   	leave
+  802a8d:	c3                   	ret
+
+0000000000802a8e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a8e:	55                   	push   %rbp
+  802a8f:	48 89 e5             	mov    %rsp,%rbp
+  802a92:	48 83 ec 40          	sub    $0x40,%rsp
+  802a96:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a9e:	48 89 c7             	mov    %rax,%rdi
+  802aa1:	48 b8 1b 0b 80 00 00 	movabs $0x800b1b,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+  802aad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802ab1:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802ab8:	00 
+  802ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802abd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802ac1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac5:	48 01 d0             	add    %rdx,%rax
+  802ac8:	48 83 c0 1f          	add    $0x1f,%rax
+  802acc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802ad0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ad4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad9:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802add:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ae1:	48 29 d0             	sub    %rdx,%rax
+  802ae4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ae8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802aec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802af0:	48 89 c6             	mov    %rax,%rsi
+  802af3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af8:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b08:	48 89 c7             	mov    %rax,%rdi
+  802b0b:	48 b8 d4 24 80 00 00 	movabs $0x8024d4,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802b17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b1f:	eb 2f                	jmp    802b50 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802b21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b25:	48 83 e8 01          	sub    $0x1,%rax
+  802b29:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b2d:	48 89 c2             	mov    %rax,%rdx
+  802b30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b34:	48 01 d0             	add    %rdx,%rax
+  802b37:	48 89 c6             	mov    %rax,%rsi
+  802b3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3f:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802b4b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802b50:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802b55:	77 ca                	ja     802b21 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802b57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b5b:	48 89 c6             	mov    %rax,%rsi
+  802b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b63:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  802b6a:	00 00 00 
+  802b6d:	ff d0                	call   *%rax
+}
+  802b6f:	c9                   	leave
+  802b70:	c3                   	ret
+
+0000000000802b71 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802b71:	55                   	push   %rbp
+  802b72:	48 89 e5             	mov    %rsp,%rbp
+  802b75:	48 83 ec 08          	sub    $0x8,%rsp
+  802b79:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b80:	75 10                	jne    802b92 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b82:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b89:	00 00 00 
+  802b8c:	8b 00                	mov    (%rax),%eax
+  802b8e:	48 98                	cltq
+  802b90:	eb 05                	jmp    802b97 <vsyscall+0x26>
+  }
+  return 0;
+  802b92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b97:	c9                   	leave
+  802b98:	c3                   	ret
+
+0000000000802b99 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 71 2b 80 00 00 	movabs $0x802b71,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+}
+  802bae:	5d                   	pop    %rbp
+  802baf:	c3                   	ret
+
+0000000000802bb0 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802bb0:	55                   	push   %rbp
+  802bb1:	48 89 e5             	mov    %rsp,%rbp
+  802bb4:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802bb8:	0f 31                	rdtsc
+  802bba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bbd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802bc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bc3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802bc6:	48 c1 e2 20          	shl    $0x20,%rdx
+  802bca:	48 09 d0             	or     %rdx,%rax
+  802bcd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802bd1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802bd5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802bd9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802be0:	00 00 00 
+  802be3:	8b 40 08             	mov    0x8(%rax),%eax
+  802be6:	48 98                	cltq
+  802be8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf5:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bf9:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802c00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c09:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802c0d:	48 89 d0             	mov    %rdx,%rax
+  802c10:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802c20:	48 01 c8             	add    %rcx,%rax
+}
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+0000000000802c25 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	48 83 ec 20          	sub    $0x20,%rsp
+  802c2d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802c30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c33:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802c36:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802c3a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c3f:	48 89 c7             	mov    %rax,%rdi
+  802c42:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+}
+  802c4e:	90                   	nop
+  802c4f:	c9                   	leave
+  802c50:	c3                   	ret
+
+0000000000802c51 <getchar>:
+
+int
+getchar(void) {
+  802c51:	55                   	push   %rbp
+  802c52:	48 89 e5             	mov    %rsp,%rbp
+  802c55:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802c59:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802c5d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c62:	48 89 c6             	mov    %rax,%rsi
+  802c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6a:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+  802c76:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c7d:	79 05                	jns    802c84 <getchar+0x33>
+    return r;
+  802c7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c82:	eb 14                	jmp    802c98 <getchar+0x47>
+  if (r < 1)
+  802c84:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c88:	7f 07                	jg     802c91 <getchar+0x40>
+    return -E_EOF;
+  802c8a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c8f:	eb 07                	jmp    802c98 <getchar+0x47>
+  return c;
+  802c91:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c95:	0f b6 c0             	movzbl %al,%eax
+}
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+0000000000802c9a <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	48 83 ec 20          	sub    $0x20,%rsp
+  802ca2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ca5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ca9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cac:	48 89 d6             	mov    %rdx,%rsi
+  802caf:	89 c7                	mov    %eax,%edi
+  802cb1:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+  802cbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cc4:	79 05                	jns    802ccb <iscons+0x31>
+    return r;
+  802cc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc9:	eb 1a                	jmp    802ce5 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ccf:	8b 10                	mov    (%rax),%edx
+  802cd1:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802cd8:	00 00 00 
+  802cdb:	8b 00                	mov    (%rax),%eax
+  802cdd:	39 c2                	cmp    %eax,%edx
+  802cdf:	0f 94 c0             	sete   %al
+  802ce2:	0f b6 c0             	movzbl %al,%eax
+}
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+0000000000802ce7 <opencons>:
+
+int
+opencons(void) {
+  802ce7:	55                   	push   %rbp
+  802ce8:	48 89 e5             	mov    %rsp,%rbp
+  802ceb:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802cef:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802cf3:	48 89 c7             	mov    %rax,%rdi
+  802cf6:	48 b8 46 0b 80 00 00 	movabs $0x800b46,%rax
+  802cfd:	00 00 00 
+  802d00:	ff d0                	call   *%rax
+  802d02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d05:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d09:	79 05                	jns    802d10 <opencons+0x29>
+    return r;
+  802d0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d0e:	eb 66                	jmp    802d76 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802d10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d14:	ba 07 04 00 00       	mov    $0x407,%edx
+  802d19:	48 89 c6             	mov    %rax,%rsi
+  802d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d21:	48 b8 11 04 80 00 00 	movabs $0x800411,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+  802d2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d34:	79 05                	jns    802d3b <opencons+0x54>
+    return r;
+  802d36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d39:	eb 3b                	jmp    802d76 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802d3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3f:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802d46:	00 00 00 
+  802d49:	8b 12                	mov    (%rdx),%edx
+  802d4b:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d51:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802d58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d5c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802d63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d67:	48 89 c7             	mov    %rax,%rdi
+  802d6a:	48 b8 f8 0a 80 00 00 	movabs $0x800af8,%rax
+  802d71:	00 00 00 
+  802d74:	ff d0                	call   *%rax
+}
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+
+0000000000802d78 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d78:	55                   	push   %rbp
+  802d79:	48 89 e5             	mov    %rsp,%rbp
+  802d7c:	48 83 ec 20          	sub    $0x20,%rsp
+  802d80:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d83:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d86:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d8d:	48 89 d6             	mov    %rdx,%rsi
+  802d90:	89 c7                	mov    %eax,%edi
+  802d92:	48 b8 28 0c 80 00 00 	movabs $0x800c28,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+  802d9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802da1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802da5:	79 05                	jns    802dac <consmode+0x34>
+    return r;
+  802da7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802daa:	eb 34                	jmp    802de0 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db0:	8b 10                	mov    (%rax),%edx
+  802db2:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802db9:	00 00 00 
+  802dbc:	8b 00                	mov    (%rax),%eax
+  802dbe:	39 c2                	cmp    %eax,%edx
+  802dc0:	74 07                	je     802dc9 <consmode+0x51>
+    return -E_INVAL;
+  802dc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dc7:	eb 17                	jmp    802de0 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802dc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dcd:	8b 40 0c             	mov    0xc(%rax),%eax
+  802dd0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802dd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802dda:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802ddd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802de0:	c9                   	leave
+  802de1:	c3                   	ret
+
+0000000000802de2 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de2:	55                   	push   %rbp
+  802de3:	48 89 e5             	mov    %rsp,%rbp
+  802de6:	48 83 ec 20          	sub    $0x20,%rsp
+  802dea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802dee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802df2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dfa:	8b 50 0c             	mov    0xc(%rax),%edx
+  802dfd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e05:	48 89 ce             	mov    %rcx,%rsi
+  802e08:	48 89 c7             	mov    %rax,%rdi
+  802e0b:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+  802e17:	48 98                	cltq
+}
+  802e19:	c9                   	leave
+  802e1a:	c3                   	ret
+
+0000000000802e1b <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802e1b:	55                   	push   %rbp
+  802e1c:	48 89 e5             	mov    %rsp,%rbp
+  802e1f:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802e26:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802e2d:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802e34:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802e3b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e42:	eb 74                	jmp    802eb8 <devcons_write+0x9d>
+    m = n - tot;
+  802e44:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802e4b:	89 c2                	mov    %eax,%edx
+  802e4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e50:	29 c2                	sub    %eax,%edx
+  802e52:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802e55:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e58:	83 f8 7f             	cmp    $0x7f,%eax
+  802e5b:	76 07                	jbe    802e64 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802e5d:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802e64:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e67:	48 63 d0             	movslq %eax,%rdx
+  802e6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e6d:	48 63 c8             	movslq %eax,%rcx
+  802e70:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e77:	48 01 c1             	add    %rax,%rcx
+  802e7a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e81:	48 89 ce             	mov    %rcx,%rsi
+  802e84:	48 89 c7             	mov    %rax,%rdi
+  802e87:	48 b8 b3 46 80 00 00 	movabs $0x8046b3,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e93:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e96:	48 63 d0             	movslq %eax,%rdx
+  802e99:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802ea0:	48 89 d6             	mov    %rdx,%rsi
+  802ea3:	48 89 c7             	mov    %rax,%rdi
+  802ea6:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  802ead:	00 00 00 
+  802eb0:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802eb2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802eb5:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802eb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ebb:	48 98                	cltq
+  802ebd:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802ec4:	0f 82 7a ff ff ff    	jb     802e44 <devcons_write+0x29>
+  }
+  return tot;
+  802eca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ecd:	48 98                	cltq
+}
+  802ecf:	c9                   	leave
+  802ed0:	c3                   	ret
+
+0000000000802ed1 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802ed1:	55                   	push   %rbp
+  802ed2:	48 89 e5             	mov    %rsp,%rbp
+  802ed5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ed9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802edd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee2:	c9                   	leave
+  802ee3:	c3                   	ret
+
+0000000000802ee4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802ee4:	55                   	push   %rbp
+  802ee5:	48 89 e5             	mov    %rsp,%rbp
+  802ee8:	48 83 ec 10          	sub    $0x10,%rsp
+  802eec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ef0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802ef4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ef8:	48 ba 25 51 80 00 00 	movabs $0x805125,%rdx
+  802eff:	00 00 00 
+  802f02:	48 89 d6             	mov    %rdx,%rsi
+  802f05:	48 89 c7             	mov    %rax,%rdi
+  802f08:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+  return 0;
+  802f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f19:	c9                   	leave
+  802f1a:	c3                   	ret
+
+0000000000802f1b <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802f1b:	55                   	push   %rbp
+  802f1c:	48 89 e5             	mov    %rsp,%rbp
+  802f1f:	48 83 ec 30          	sub    $0x30,%rsp
+  802f23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f27:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802f2a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802f2e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802f35:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f38:	83 e0 02             	and    $0x2,%eax
+  802f3b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f42:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f45:	83 f8 01             	cmp    $0x1,%eax
+  802f48:	75 04                	jne    802f4e <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802f4a:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802f4e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f51:	83 e0 01             	and    $0x1,%eax
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	74 44                	je     802f9c <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802f58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f60:	89 c2                	mov    %eax,%edx
+  802f62:	be 00 00 00 00       	mov    $0x0,%esi
+  802f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6c:	48 b8 59 08 80 00 00 	movabs $0x800859,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+  802f78:	83 f8 01             	cmp    $0x1,%eax
+  802f7b:	75 06                	jne    802f83 <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f7d:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f81:	eb 19                	jmp    802f9c <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f87:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f8d:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f90:	89 c2                	mov    %eax,%edx
+  802f92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f96:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f9c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f9f:	c9                   	leave
+  802fa0:	c3                   	ret
+
+0000000000802fa1 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802fa1:	55                   	push   %rbp
+  802fa2:	48 89 e5             	mov    %rsp,%rbp
+  802fa5:	53                   	push   %rbx
+  802fa6:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802fad:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802fb4:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802fba:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802fc1:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802fc8:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802fcf:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802fd6:	84 c0                	test   %al,%al
+  802fd8:	74 23                	je     802ffd <_panic+0x5c>
+  802fda:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802fe1:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802fe5:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802fe9:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802fed:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802ff1:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802ff5:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802ff9:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802ffd:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  803004:	00 00 00 
+  803007:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80300e:	00 00 00 
+  803011:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803015:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80301c:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  803023:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80302a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  803031:	00 00 00 
+  803034:	48 8b 18             	mov    (%rax),%rbx
+  803037:	48 b8 98 03 80 00 00 	movabs $0x800398,%rax
+  80303e:	00 00 00 
+  803041:	ff d0                	call   *%rax
+  803043:	89 c6                	mov    %eax,%esi
+  803045:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80304b:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  803052:	41 89 d0             	mov    %edx,%r8d
+  803055:	48 89 c1             	mov    %rax,%rcx
+  803058:	48 89 da             	mov    %rbx,%rdx
+  80305b:	48 b8 30 51 80 00 00 	movabs $0x805130,%rax
+  803062:	00 00 00 
+  803065:	48 89 c7             	mov    %rax,%rdi
+  803068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306d:	49 b9 c0 31 80 00 00 	movabs $0x8031c0,%r9
+  803074:	00 00 00 
+  803077:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80307a:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  803081:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803088:	48 89 d6             	mov    %rdx,%rsi
+  80308b:	48 89 c7             	mov    %rax,%rdi
+  80308e:	48 b8 35 31 80 00 00 	movabs $0x803135,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+  cprintf("\n");
+  80309a:	48 b8 53 51 80 00 00 	movabs $0x805153,%rax
+  8030a1:	00 00 00 
+  8030a4:	48 89 c7             	mov    %rax,%rdi
+  8030a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ac:	48 ba c0 31 80 00 00 	movabs $0x8031c0,%rdx
+  8030b3:	00 00 00 
+  8030b6:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8030b8:	cc                   	int3
+  8030b9:	eb fd                	jmp    8030b8 <_panic+0x117>
+
+00000000008030bb <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8030bb:	55                   	push   %rbp
+  8030bc:	48 89 e5             	mov    %rsp,%rbp
+  8030bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8030c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8030ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ce:	8b 00                	mov    (%rax),%eax
+  8030d0:	8d 48 01             	lea    0x1(%rax),%ecx
+  8030d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030d7:	89 0a                	mov    %ecx,(%rdx)
+  8030d9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030dc:	89 d1                	mov    %edx,%ecx
+  8030de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030e2:	48 98                	cltq
+  8030e4:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8030e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ec:	8b 00                	mov    (%rax),%eax
+  8030ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8030f3:	75 2c                	jne    803121 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8030f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030f9:	8b 00                	mov    (%rax),%eax
+  8030fb:	48 98                	cltq
+  8030fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803101:	48 83 c2 08          	add    $0x8,%rdx
+  803105:	48 89 c6             	mov    %rax,%rsi
+  803108:	48 89 d7             	mov    %rdx,%rdi
+  80310b:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+    b->idx = 0;
+  803117:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80311b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  803121:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803125:	8b 40 04             	mov    0x4(%rax),%eax
+  803128:	8d 50 01             	lea    0x1(%rax),%edx
+  80312b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80312f:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803132:	90                   	nop
+  803133:	c9                   	leave
+  803134:	c3                   	ret
+
+0000000000803135 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803135:	55                   	push   %rbp
+  803136:	48 89 e5             	mov    %rsp,%rbp
+  803139:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803140:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  803147:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80314e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  803155:	00 00 00 
+  b.cnt = 0;
+  803158:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80315f:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  803162:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  803169:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  803170:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803177:	48 89 c6             	mov    %rax,%rsi
+  80317a:	48 b8 bb 30 80 00 00 	movabs $0x8030bb,%rax
+  803181:	00 00 00 
+  803184:	48 89 c7             	mov    %rax,%rdi
+  803187:	48 b8 1a 35 80 00 00 	movabs $0x80351a,%rax
+  80318e:	00 00 00 
+  803191:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  803193:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803199:	48 98                	cltq
+  80319b:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8031a2:	48 83 c2 08          	add    $0x8,%rdx
+  8031a6:	48 89 c6             	mov    %rax,%rsi
+  8031a9:	48 89 d7             	mov    %rdx,%rdi
+  8031ac:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  8031b3:	00 00 00 
+  8031b6:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8031b8:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8031be:	c9                   	leave
+  8031bf:	c3                   	ret
+
+00000000008031c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8031c0:	55                   	push   %rbp
+  8031c1:	48 89 e5             	mov    %rsp,%rbp
+  8031c4:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8031cb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8031d2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8031d9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8031e0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8031e7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8031ee:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8031f5:	84 c0                	test   %al,%al
+  8031f7:	74 20                	je     803219 <cprintf+0x59>
+  8031f9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8031fd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803201:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803205:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803209:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80320d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803211:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803215:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  803219:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803220:	00 00 00 
+  803223:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80322a:	00 00 00 
+  80322d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803231:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803238:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80323f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  803246:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80324d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803254:	48 89 d6             	mov    %rdx,%rsi
+  803257:	48 89 c7             	mov    %rax,%rdi
+  80325a:	48 b8 35 31 80 00 00 	movabs $0x803135,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+  803266:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80326c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803272:	c9                   	leave
+  803273:	c3                   	ret
+
+0000000000803274 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803274:	55                   	push   %rbp
+  803275:	48 89 e5             	mov    %rsp,%rbp
+  803278:	48 83 ec 30          	sub    $0x30,%rsp
+  80327c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803280:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803284:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803288:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80328b:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80328f:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  803293:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803296:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80329a:	72 54                	jb     8032f0 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80329c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80329f:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8032a2:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8032a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ae:	48 f7 f6             	div    %rsi
+  8032b1:	49 89 c2             	mov    %rax,%r10
+  8032b4:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8032b7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8032ba:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8032be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032c2:	41 89 c9             	mov    %ecx,%r9d
+  8032c5:	41 89 f8             	mov    %edi,%r8d
+  8032c8:	89 d1                	mov    %edx,%ecx
+  8032ca:	4c 89 d2             	mov    %r10,%rdx
+  8032cd:	48 89 c7             	mov    %rax,%rdi
+  8032d0:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+  8032dc:	eb 1c                	jmp    8032fa <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8032de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032e5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032e9:	48 89 d6             	mov    %rdx,%rsi
+  8032ec:	89 c7                	mov    %eax,%edi
+  8032ee:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8032f0:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8032f4:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8032f8:	7f e4                	jg     8032de <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8032fa:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8032fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803301:	ba 00 00 00 00       	mov    $0x0,%edx
+  803306:	48 f7 f1             	div    %rcx
+  803309:	48 b8 90 53 80 00 00 	movabs $0x805390,%rax
+  803310:	00 00 00 
+  803313:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  803317:	0f be c0             	movsbl %al,%eax
+  80331a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80331e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803322:	48 89 d6             	mov    %rdx,%rsi
+  803325:	89 c7                	mov    %eax,%edi
+  803327:	ff d1                	call   *%rcx
+}
+  803329:	90                   	nop
+  80332a:	c9                   	leave
+  80332b:	c3                   	ret
+
+000000000080332c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80332c:	55                   	push   %rbp
+  80332d:	48 89 e5             	mov    %rsp,%rbp
+  803330:	48 83 ec 10          	sub    $0x10,%rsp
+  803334:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803338:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80333b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80333f:	7e 4b                	jle    80338c <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  803341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803345:	8b 00                	mov    (%rax),%eax
+  803347:	83 f8 2f             	cmp    $0x2f,%eax
+  80334a:	77 24                	ja     803370 <getuint+0x44>
+  80334c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803350:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803358:	8b 00                	mov    (%rax),%eax
+  80335a:	89 c0                	mov    %eax,%eax
+  80335c:	48 01 d0             	add    %rdx,%rax
+  80335f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803363:	8b 12                	mov    (%rdx),%edx
+  803365:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803368:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80336c:	89 0a                	mov    %ecx,(%rdx)
+  80336e:	eb 14                	jmp    803384 <getuint+0x58>
+  803370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803374:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803378:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80337c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803380:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803384:	48 8b 00             	mov    (%rax),%rax
+  803387:	e9 95 00 00 00       	jmp    803421 <getuint+0xf5>
+  else if (lflag)
+  80338c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803390:	74 48                	je     8033da <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  803392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803396:	8b 00                	mov    (%rax),%eax
+  803398:	83 f8 2f             	cmp    $0x2f,%eax
+  80339b:	77 24                	ja     8033c1 <getuint+0x95>
+  80339d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033a1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033a9:	8b 00                	mov    (%rax),%eax
+  8033ab:	89 c0                	mov    %eax,%eax
+  8033ad:	48 01 d0             	add    %rdx,%rax
+  8033b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b4:	8b 12                	mov    (%rdx),%edx
+  8033b6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033bd:	89 0a                	mov    %ecx,(%rdx)
+  8033bf:	eb 14                	jmp    8033d5 <getuint+0xa9>
+  8033c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033c9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033d1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033d5:	48 8b 00             	mov    (%rax),%rax
+  8033d8:	eb 47                	jmp    803421 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8033da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033de:	8b 00                	mov    (%rax),%eax
+  8033e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8033e3:	77 24                	ja     803409 <getuint+0xdd>
+  8033e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f1:	8b 00                	mov    (%rax),%eax
+  8033f3:	89 c0                	mov    %eax,%eax
+  8033f5:	48 01 d0             	add    %rdx,%rax
+  8033f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033fc:	8b 12                	mov    (%rdx),%edx
+  8033fe:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803401:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803405:	89 0a                	mov    %ecx,(%rdx)
+  803407:	eb 14                	jmp    80341d <getuint+0xf1>
+  803409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803411:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803415:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803419:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80341d:	8b 00                	mov    (%rax),%eax
+  80341f:	89 c0                	mov    %eax,%eax
+}
+  803421:	c9                   	leave
+  803422:	c3                   	ret
+
+0000000000803423 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  803423:	55                   	push   %rbp
+  803424:	48 89 e5             	mov    %rsp,%rbp
+  803427:	48 83 ec 10          	sub    $0x10,%rsp
+  80342b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80342f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  803432:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  803436:	7e 4b                	jle    803483 <getint+0x60>
+    return va_arg(*ap, long long);
+  803438:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343c:	8b 00                	mov    (%rax),%eax
+  80343e:	83 f8 2f             	cmp    $0x2f,%eax
+  803441:	77 24                	ja     803467 <getint+0x44>
+  803443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803447:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80344b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344f:	8b 00                	mov    (%rax),%eax
+  803451:	89 c0                	mov    %eax,%eax
+  803453:	48 01 d0             	add    %rdx,%rax
+  803456:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80345a:	8b 12                	mov    (%rdx),%edx
+  80345c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80345f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803463:	89 0a                	mov    %ecx,(%rdx)
+  803465:	eb 14                	jmp    80347b <getint+0x58>
+  803467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80346f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803473:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803477:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80347b:	48 8b 00             	mov    (%rax),%rax
+  80347e:	e9 95 00 00 00       	jmp    803518 <getint+0xf5>
+  else if (lflag)
+  803483:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803487:	74 48                	je     8034d1 <getint+0xae>
+    return va_arg(*ap, long);
+  803489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348d:	8b 00                	mov    (%rax),%eax
+  80348f:	83 f8 2f             	cmp    $0x2f,%eax
+  803492:	77 24                	ja     8034b8 <getint+0x95>
+  803494:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803498:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80349c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a0:	8b 00                	mov    (%rax),%eax
+  8034a2:	89 c0                	mov    %eax,%eax
+  8034a4:	48 01 d0             	add    %rdx,%rax
+  8034a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034ab:	8b 12                	mov    (%rdx),%edx
+  8034ad:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034b4:	89 0a                	mov    %ecx,(%rdx)
+  8034b6:	eb 14                	jmp    8034cc <getint+0xa9>
+  8034b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8034c0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8034c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034c8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034cc:	48 8b 00             	mov    (%rax),%rax
+  8034cf:	eb 47                	jmp    803518 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8034d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034d5:	8b 00                	mov    (%rax),%eax
+  8034d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8034da:	77 24                	ja     803500 <getint+0xdd>
+  8034dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e8:	8b 00                	mov    (%rax),%eax
+  8034ea:	89 c0                	mov    %eax,%eax
+  8034ec:	48 01 d0             	add    %rdx,%rax
+  8034ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034f3:	8b 12                	mov    (%rdx),%edx
+  8034f5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8034f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034fc:	89 0a                	mov    %ecx,(%rdx)
+  8034fe:	eb 14                	jmp    803514 <getint+0xf1>
+  803500:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803504:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803508:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80350c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803510:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803514:	8b 00                	mov    (%rax),%eax
+  803516:	48 98                	cltq
+}
+  803518:	c9                   	leave
+  803519:	c3                   	ret
+
+000000000080351a <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80351a:	55                   	push   %rbp
+  80351b:	48 89 e5             	mov    %rsp,%rbp
+  80351e:	41 54                	push   %r12
+  803520:	53                   	push   %rbx
+  803521:	48 83 ec 60          	sub    $0x60,%rsp
+  803525:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803529:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80352d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803531:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  803535:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803539:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80353d:	48 8b 06             	mov    (%rsi),%rax
+  803540:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803544:	48 89 01             	mov    %rax,(%rcx)
+  803547:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80354b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80354f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803553:	eb 17                	jmp    80356c <vprintfmt+0x52>
+      if (ch == '\0')
+  803555:	85 db                	test   %ebx,%ebx
+  803557:	0f 84 bf 04 00 00    	je     803a1c <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80355d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803561:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803565:	48 89 c6             	mov    %rax,%rsi
+  803568:	89 df                	mov    %ebx,%edi
+  80356a:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80356c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803570:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803574:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803578:	0f b6 00             	movzbl (%rax),%eax
+  80357b:	0f b6 d8             	movzbl %al,%ebx
+  80357e:	83 fb 25             	cmp    $0x25,%ebx
+  803581:	75 d2                	jne    803555 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  803583:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803587:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80358e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803595:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80359c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8035a3:	eb 04                	jmp    8035a9 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8035a5:	90                   	nop
+  8035a6:	eb 01                	jmp    8035a9 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8035a8:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8035a9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8035ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035b1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8035b5:	0f b6 00             	movzbl (%rax),%eax
+  8035b8:	0f b6 d8             	movzbl %al,%ebx
+  8035bb:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8035be:	83 f8 55             	cmp    $0x55,%eax
+  8035c1:	0f 87 22 04 00 00    	ja     8039e9 <vprintfmt+0x4cf>
+  8035c7:	89 c0                	mov    %eax,%eax
+  8035c9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8035d0:	00 
+  8035d1:	48 b8 b8 53 80 00 00 	movabs $0x8053b8,%rax
+  8035d8:	00 00 00 
+  8035db:	48 01 d0             	add    %rdx,%rax
+  8035de:	48 8b 00             	mov    (%rax),%rax
+  8035e1:	ff e0                	jmp    *%rax
+        padc = '-';
+  8035e3:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8035e7:	eb c0                	jmp    8035a9 <vprintfmt+0x8f>
+        padc = '0';
+  8035e9:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8035ed:	eb ba                	jmp    8035a9 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8035ef:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035f6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8035f9:	89 d0                	mov    %edx,%eax
+  8035fb:	c1 e0 02             	shl    $0x2,%eax
+  8035fe:	01 d0                	add    %edx,%eax
+  803600:	01 c0                	add    %eax,%eax
+  803602:	01 d8                	add    %ebx,%eax
+  803604:	83 e8 30             	sub    $0x30,%eax
+  803607:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80360a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80360e:	0f b6 00             	movzbl (%rax),%eax
+  803611:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  803614:	83 fb 2f             	cmp    $0x2f,%ebx
+  803617:	7e 60                	jle    803679 <vprintfmt+0x15f>
+  803619:	83 fb 39             	cmp    $0x39,%ebx
+  80361c:	7f 5b                	jg     803679 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80361e:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  803623:	eb d1                	jmp    8035f6 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  803625:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803628:	83 f8 2f             	cmp    $0x2f,%eax
+  80362b:	77 17                	ja     803644 <vprintfmt+0x12a>
+  80362d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803631:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803634:	89 d2                	mov    %edx,%edx
+  803636:	48 01 d0             	add    %rdx,%rax
+  803639:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80363c:	83 c2 08             	add    $0x8,%edx
+  80363f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803642:	eb 0c                	jmp    803650 <vprintfmt+0x136>
+  803644:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803648:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80364c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803650:	8b 00                	mov    (%rax),%eax
+  803652:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  803655:	eb 23                	jmp    80367a <vprintfmt+0x160>
+        if (width < 0)
+  803657:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80365b:	0f 89 44 ff ff ff    	jns    8035a5 <vprintfmt+0x8b>
+          width = 0;
+  803661:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  803668:	e9 38 ff ff ff       	jmp    8035a5 <vprintfmt+0x8b>
+        altflag = 1;
+  80366d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803674:	e9 30 ff ff ff       	jmp    8035a9 <vprintfmt+0x8f>
+        goto process_precision;
+  803679:	90                   	nop
+        if (width < 0)
+  80367a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80367e:	0f 89 24 ff ff ff    	jns    8035a8 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803684:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803687:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80368a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  803691:	e9 12 ff ff ff       	jmp    8035a8 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803696:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80369a:	e9 0a ff ff ff       	jmp    8035a9 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80369f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8036a5:	77 17                	ja     8036be <vprintfmt+0x1a4>
+  8036a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036ab:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036ae:	89 d2                	mov    %edx,%edx
+  8036b0:	48 01 d0             	add    %rdx,%rax
+  8036b3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036b6:	83 c2 08             	add    $0x8,%edx
+  8036b9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036bc:	eb 0c                	jmp    8036ca <vprintfmt+0x1b0>
+  8036be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8036c6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8036ca:	8b 00                	mov    (%rax),%eax
+  8036cc:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8036d0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8036d4:	48 89 d6             	mov    %rdx,%rsi
+  8036d7:	89 c7                	mov    %eax,%edi
+  8036d9:	ff d1                	call   *%rcx
+        break;
+  8036db:	e9 37 03 00 00       	jmp    803a17 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8036e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8036e6:	77 17                	ja     8036ff <vprintfmt+0x1e5>
+  8036e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036ec:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036ef:	89 d2                	mov    %edx,%edx
+  8036f1:	48 01 d0             	add    %rdx,%rax
+  8036f4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8036f7:	83 c2 08             	add    $0x8,%edx
+  8036fa:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8036fd:	eb 0c                	jmp    80370b <vprintfmt+0x1f1>
+  8036ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803703:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803707:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80370b:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80370d:	85 db                	test   %ebx,%ebx
+  80370f:	79 02                	jns    803713 <vprintfmt+0x1f9>
+          err = -err;
+  803711:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  803713:	83 fb 15             	cmp    $0x15,%ebx
+  803716:	7f 16                	jg     80372e <vprintfmt+0x214>
+  803718:	48 ba e0 52 80 00 00 	movabs $0x8052e0,%rdx
+  80371f:	00 00 00 
+  803722:	48 63 c3             	movslq %ebx,%rax
+  803725:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  803729:	4d 85 e4             	test   %r12,%r12
+  80372c:	75 2e                	jne    80375c <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80372e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803732:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803736:	89 d9                	mov    %ebx,%ecx
+  803738:	48 ba a1 53 80 00 00 	movabs $0x8053a1,%rdx
+  80373f:	00 00 00 
+  803742:	48 89 c7             	mov    %rax,%rdi
+  803745:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374a:	49 b8 26 3a 80 00 00 	movabs $0x803a26,%r8
+  803751:	00 00 00 
+  803754:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  803757:	e9 bb 02 00 00       	jmp    803a17 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80375c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803760:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803764:	4c 89 e1             	mov    %r12,%rcx
+  803767:	48 ba aa 53 80 00 00 	movabs $0x8053aa,%rdx
+  80376e:	00 00 00 
+  803771:	48 89 c7             	mov    %rax,%rdi
+  803774:	b8 00 00 00 00       	mov    $0x0,%eax
+  803779:	49 b8 26 3a 80 00 00 	movabs $0x803a26,%r8
+  803780:	00 00 00 
+  803783:	41 ff d0             	call   *%r8
+        break;
+  803786:	e9 8c 02 00 00       	jmp    803a17 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80378b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80378e:	83 f8 2f             	cmp    $0x2f,%eax
+  803791:	77 17                	ja     8037aa <vprintfmt+0x290>
+  803793:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803797:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80379a:	89 d2                	mov    %edx,%edx
+  80379c:	48 01 d0             	add    %rdx,%rax
+  80379f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8037a2:	83 c2 08             	add    $0x8,%edx
+  8037a5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8037a8:	eb 0c                	jmp    8037b6 <vprintfmt+0x29c>
+  8037aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8037ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8037b2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8037b6:	4c 8b 20             	mov    (%rax),%r12
+  8037b9:	4d 85 e4             	test   %r12,%r12
+  8037bc:	75 0a                	jne    8037c8 <vprintfmt+0x2ae>
+          p = "(null)";
+  8037be:	49 bc ad 53 80 00 00 	movabs $0x8053ad,%r12
+  8037c5:	00 00 00 
+        if (width > 0 && padc != '-')
+  8037c8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037cc:	7e 78                	jle    803846 <vprintfmt+0x32c>
+  8037ce:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8037d2:	74 72                	je     803846 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8037d4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8037d7:	48 98                	cltq
+  8037d9:	48 89 c6             	mov    %rax,%rsi
+  8037dc:	4c 89 e7             	mov    %r12,%rdi
+  8037df:	48 b8 32 41 80 00 00 	movabs $0x804132,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+  8037eb:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8037ee:	eb 17                	jmp    803807 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8037f0:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8037f4:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8037f8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8037fc:	48 89 d6             	mov    %rdx,%rsi
+  8037ff:	89 c7                	mov    %eax,%edi
+  803801:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803803:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803807:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80380b:	7f e3                	jg     8037f0 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80380d:	eb 37                	jmp    803846 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80380f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803813:	74 1e                	je     803833 <vprintfmt+0x319>
+  803815:	83 fb 1f             	cmp    $0x1f,%ebx
+  803818:	7e 05                	jle    80381f <vprintfmt+0x305>
+  80381a:	83 fb 7e             	cmp    $0x7e,%ebx
+  80381d:	7e 14                	jle    803833 <vprintfmt+0x319>
+            putch('?', putdat);
+  80381f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803823:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803827:	48 89 c6             	mov    %rax,%rsi
+  80382a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80382f:	ff d2                	call   *%rdx
+  803831:	eb 0f                	jmp    803842 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  803833:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803837:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80383b:	48 89 c6             	mov    %rax,%rsi
+  80383e:	89 df                	mov    %ebx,%edi
+  803840:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803842:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803846:	4c 89 e0             	mov    %r12,%rax
+  803849:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80384d:	0f b6 00             	movzbl (%rax),%eax
+  803850:	0f be d8             	movsbl %al,%ebx
+  803853:	85 db                	test   %ebx,%ebx
+  803855:	74 28                	je     80387f <vprintfmt+0x365>
+  803857:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80385b:	78 b2                	js     80380f <vprintfmt+0x2f5>
+  80385d:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  803861:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803865:	79 a8                	jns    80380f <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  803867:	eb 16                	jmp    80387f <vprintfmt+0x365>
+          putch(' ', putdat);
+  803869:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80386d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803871:	48 89 c6             	mov    %rax,%rsi
+  803874:	bf 20 00 00 00       	mov    $0x20,%edi
+  803879:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80387b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80387f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803883:	7f e4                	jg     803869 <vprintfmt+0x34f>
+        break;
+  803885:	e9 8d 01 00 00       	jmp    803a17 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80388a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80388d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803891:	89 d6                	mov    %edx,%esi
+  803893:	48 89 c7             	mov    %rax,%rdi
+  803896:	48 b8 23 34 80 00 00 	movabs $0x803423,%rax
+  80389d:	00 00 00 
+  8038a0:	ff d0                	call   *%rax
+  8038a2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8038a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038aa:	48 85 c0             	test   %rax,%rax
+  8038ad:	79 1d                	jns    8038cc <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8038af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038b3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038b7:	48 89 c6             	mov    %rax,%rsi
+  8038ba:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8038bf:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8038c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c5:	48 f7 d8             	neg    %rax
+  8038c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8038cc:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038d3:	e9 d2 00 00 00       	jmp    8039aa <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  8038d8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8038db:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8038df:	89 d6                	mov    %edx,%esi
+  8038e1:	48 89 c7             	mov    %rax,%rdi
+  8038e4:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+  8038f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8038f4:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8038fb:	e9 aa 00 00 00       	jmp    8039aa <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  803900:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803903:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803907:	89 d6                	mov    %edx,%esi
+  803909:	48 89 c7             	mov    %rax,%rdi
+  80390c:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+  803918:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  80391c:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  803923:	e9 82 00 00 00       	jmp    8039aa <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  803928:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80392c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803930:	48 89 c6             	mov    %rax,%rsi
+  803933:	bf 30 00 00 00       	mov    $0x30,%edi
+  803938:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80393a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80393e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803942:	48 89 c6             	mov    %rax,%rsi
+  803945:	bf 78 00 00 00       	mov    $0x78,%edi
+  80394a:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  80394c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80394f:	83 f8 2f             	cmp    $0x2f,%eax
+  803952:	77 17                	ja     80396b <vprintfmt+0x451>
+  803954:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803958:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80395b:	89 d2                	mov    %edx,%edx
+  80395d:	48 01 d0             	add    %rdx,%rax
+  803960:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803963:	83 c2 08             	add    $0x8,%edx
+  803966:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803969:	eb 0c                	jmp    803977 <vprintfmt+0x45d>
+  80396b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80396f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803973:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803977:	48 8b 00             	mov    (%rax),%rax
+  80397a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80397e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803985:	eb 23                	jmp    8039aa <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803987:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80398a:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80398e:	89 d6                	mov    %edx,%esi
+  803990:	48 89 c7             	mov    %rax,%rdi
+  803993:	48 b8 2c 33 80 00 00 	movabs $0x80332c,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+  80399f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8039a3:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8039aa:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8039af:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8039b2:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8039b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8039b9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8039bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039c1:	45 89 c1             	mov    %r8d,%r9d
+  8039c4:	41 89 f8             	mov    %edi,%r8d
+  8039c7:	48 89 c7             	mov    %rax,%rdi
+  8039ca:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+        break;
+  8039d6:	eb 3f                	jmp    803a17 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  8039d8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039dc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8039e0:	48 89 c6             	mov    %rax,%rsi
+  8039e3:	89 df                	mov    %ebx,%edi
+  8039e5:	ff d2                	call   *%rdx
+        break;
+  8039e7:	eb 2e                	jmp    803a17 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  8039e9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039ed:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8039f1:	48 89 c6             	mov    %rax,%rsi
+  8039f4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8039f9:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8039fb:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803a00:	eb 05                	jmp    803a07 <vprintfmt+0x4ed>
+  803a02:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803a07:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803a0b:	48 83 e8 01          	sub    $0x1,%rax
+  803a0f:	0f b6 00             	movzbl (%rax),%eax
+  803a12:	3c 25                	cmp    $0x25,%al
+  803a14:	75 ec                	jne    803a02 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  803a16:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  803a17:	e9 50 fb ff ff       	jmp    80356c <vprintfmt+0x52>
+        return;
+  803a1c:	90                   	nop
+    }
+  }
+}
+  803a1d:	48 83 c4 60          	add    $0x60,%rsp
+  803a21:	5b                   	pop    %rbx
+  803a22:	41 5c                	pop    %r12
+  803a24:	5d                   	pop    %rbp
+  803a25:	c3                   	ret
+
+0000000000803a26 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803a26:	55                   	push   %rbp
+  803a27:	48 89 e5             	mov    %rsp,%rbp
+  803a2a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803a31:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803a38:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  803a3f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803a46:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803a4d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803a54:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803a5b:	84 c0                	test   %al,%al
+  803a5d:	74 20                	je     803a7f <printfmt+0x59>
+  803a5f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803a63:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803a67:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803a6b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803a6f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803a73:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a77:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a7b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a7f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a86:	00 00 00 
+  803a89:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a90:	00 00 00 
+  803a93:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a97:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a9e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803aa5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803aac:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803ab3:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803aba:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803ac1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803ac8:	48 89 c7             	mov    %rax,%rdi
+  803acb:	48 b8 1a 35 80 00 00 	movabs $0x80351a,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803ad7:	90                   	nop
+  803ad8:	c9                   	leave
+  803ad9:	c3                   	ret
+
+0000000000803ada <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803ada:	55                   	push   %rbp
+  803adb:	48 89 e5             	mov    %rsp,%rbp
+  803ade:	48 83 ec 10          	sub    $0x10,%rsp
+  803ae2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803ae5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803ae9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aed:	8b 40 10             	mov    0x10(%rax),%eax
+  803af0:	8d 50 01             	lea    0x1(%rax),%edx
+  803af3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803af7:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803afa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803afe:	48 8b 10             	mov    (%rax),%rdx
+  803b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b05:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803b09:	48 39 c2             	cmp    %rax,%rdx
+  803b0c:	73 17                	jae    803b25 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803b0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b12:	48 8b 00             	mov    (%rax),%rax
+  803b15:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803b19:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b1d:	48 89 0a             	mov    %rcx,(%rdx)
+  803b20:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b23:	88 10                	mov    %dl,(%rax)
+}
+  803b25:	90                   	nop
+  803b26:	c9                   	leave
+  803b27:	c3                   	ret
+
+0000000000803b28 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803b28:	55                   	push   %rbp
+  803b29:	48 89 e5             	mov    %rsp,%rbp
+  803b2c:	48 83 ec 40          	sub    $0x40,%rsp
+  803b30:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b34:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803b37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803b3b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803b3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b43:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803b47:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803b4a:	48 98                	cltq
+  803b4c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803b50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b54:	48 01 d0             	add    %rdx,%rax
+  803b57:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803b5b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803b62:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803b67:	74 06                	je     803b6f <vsnprintf+0x47>
+  803b69:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803b6d:	7f 07                	jg     803b76 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803b6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b74:	eb 32                	jmp    803ba8 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b76:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b7a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b7e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b82:	48 89 c6             	mov    %rax,%rsi
+  803b85:	48 b8 da 3a 80 00 00 	movabs $0x803ada,%rax
+  803b8c:	00 00 00 
+  803b8f:	48 89 c7             	mov    %rax,%rdi
+  803b92:	48 b8 1a 35 80 00 00 	movabs $0x80351a,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ba2:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803ba5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803ba8:	c9                   	leave
+  803ba9:	c3                   	ret
+
+0000000000803baa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803baa:	55                   	push   %rbp
+  803bab:	48 89 e5             	mov    %rsp,%rbp
+  803bae:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803bb5:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803bbc:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803bc2:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803bc9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803bd0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803bd7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803bde:	84 c0                	test   %al,%al
+  803be0:	74 20                	je     803c02 <snprintf+0x58>
+  803be2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803be6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803bea:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803bee:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803bf2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803bf6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803bfa:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803bfe:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803c02:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803c09:	00 00 00 
+  803c0c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803c13:	00 00 00 
+  803c16:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803c1a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803c21:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803c28:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803c2f:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803c36:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803c3d:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803c43:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803c4a:	48 89 c7             	mov    %rax,%rdi
+  803c4d:	48 b8 28 3b 80 00 00 	movabs $0x803b28,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+  803c59:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803c5f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803c65:	c9                   	leave
+  803c66:	c3                   	ret
+
+0000000000803c67 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803c67:	55                   	push   %rbp
+  803c68:	48 89 e5             	mov    %rsp,%rbp
+  803c6b:	53                   	push   %rbx
+  803c6c:	48 83 ec 38          	sub    $0x38,%rsp
+  803c70:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803c73:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c77:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c7b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c7f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c83:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8b:	89 d1                	mov    %edx,%ecx
+  803c8d:	0f a2                	cpuid
+  803c8f:	89 de                	mov    %ebx,%esi
+  803c91:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c94:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c97:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c9a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c9d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803ca2:	74 09                	je     803cad <cpuid+0x46>
+}
+  803ca4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ca8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803cab:	89 10                	mov    %edx,(%rax)
+
+  803cad:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803cb2:	74 09                	je     803cbd <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803cb4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cb8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803cbb:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803cbd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803cc2:	74 09                	je     803ccd <cpuid+0x66>
+char *
+  803cc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cc8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803ccb:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803ccd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803cd2:	74 09                	je     803cdd <cpuid+0x76>
+  for (; *s; s++)
+  803cd4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cd8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803cdb:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803cdd:	90                   	nop
+  803cde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ce2:	c9                   	leave
+  803ce3:	c3                   	ret
+
+0000000000803ce4 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803ce4:	55                   	push   %rbp
+  803ce5:	48 89 e5             	mov    %rsp,%rbp
+  803ce8:	48 83 ec 18          	sub    $0x18,%rsp
+  803cec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803cef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cf2:	89 c1                	mov    %eax,%ecx
+  803cf4:	0f 01 d0             	xgetbv
+  803cf7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cfa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803cfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d00:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803d03:	48 c1 e2 20          	shl    $0x20,%rdx
+  803d07:	48 09 d0             	or     %rdx,%rax
+#else
+  803d0a:	c9                   	leave
+  803d0b:	c3                   	ret
+
+0000000000803d0c <string_cpu>:
+string_cpu(void) {
+  803d0c:	55                   	push   %rbp
+  803d0d:	48 89 e5             	mov    %rsp,%rbp
+  803d10:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803d14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803d1b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803d22:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803d29:	00 00 00 
+  803d2c:	8b 00                	mov    (%rax),%eax
+  803d2e:	85 c0                	test   %eax,%eax
+  803d30:	78 11                	js     803d43 <string_cpu+0x37>
+    return string_features;
+  803d32:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803d39:	00 00 00 
+  803d3c:	8b 00                	mov    (%rax),%eax
+  803d3e:	e9 df 00 00 00       	jmp    803e22 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803d43:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803d47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d57:	48 89 c6             	mov    %rax,%rsi
+  803d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5f:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803d66:	00 00 00 
+  803d69:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803d6b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d6e:	83 f8 06             	cmp    $0x6,%eax
+  803d71:	76 28                	jbe    803d9b <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803d73:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d82:	48 89 c2             	mov    %rax,%rdx
+  803d85:	be 00 00 00 00       	mov    $0x0,%esi
+  803d8a:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d8f:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d9b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d9e:	25 00 02 00 00       	and    $0x200,%eax
+  803da3:	85 c0                	test   %eax,%eax
+  803da5:	74 04                	je     803dab <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803da7:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803dab:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803daf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803db5:	48 89 c1             	mov    %rax,%rcx
+  803db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc2:	bf 01 00 00 00       	mov    $0x1,%edi
+  803dc7:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  803dce:	00 00 00 
+  803dd1:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803dd3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dd6:	83 e0 20             	and    $0x20,%eax
+  803dd9:	85 c0                	test   %eax,%eax
+  803ddb:	74 2a                	je     803e07 <string_cpu+0xfb>
+  803ddd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803de0:	25 00 00 00 08       	and    $0x8000000,%eax
+  803de5:	85 c0                	test   %eax,%eax
+  803de7:	74 1e                	je     803e07 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803de9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dee:	48 b8 e4 3c 80 00 00 	movabs $0x803ce4,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+  803dfa:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803dfd:	48 83 f8 06          	cmp    $0x6,%rax
+  803e01:	75 04                	jne    803e07 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803e03:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803e07:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803e0e:	00 00 00 
+  803e11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e14:	89 02                	mov    %eax,(%rdx)
+  803e16:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803e1d:	00 00 00 
+  803e20:	8b 00                	mov    (%rax),%eax
+}
+  803e22:	c9                   	leave
+  803e23:	c3                   	ret
+
+0000000000803e24 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803e24:	55                   	push   %rbp
+  803e25:	48 89 e5             	mov    %rsp,%rbp
+  803e28:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e2c:	48 83 ec 60          	sub    $0x60,%rsp
+  803e30:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803e35:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e3a:	83 e0 1f             	and    $0x1f,%eax
+  803e3d:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803e41:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e45:	48 f7 d8             	neg    %rax
+  803e48:	48 89 c2             	mov    %rax,%rdx
+  803e4b:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803e50:	48 01 d0             	add    %rdx,%rax
+  803e53:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803e58:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803e5c:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803e62:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e67:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e6b:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e71:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e75:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e79:	89 c2                	mov    %eax,%edx
+  803e7b:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e7f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e84:	89 c1                	mov    %eax,%ecx
+  803e86:	d3 e6                	shl    %cl,%esi
+  803e88:	89 f0                	mov    %esi,%eax
+  803e8a:	21 d0                	and    %edx,%eax
+  803e8c:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e90:	eb 21                	jmp    803eb3 <strlen_avx2+0x8f>
+    p += 32;
+  803e92:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e98:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e9d:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803ea1:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803ea7:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803eab:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803eaf:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803eb3:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803eb8:	74 d8                	je     803e92 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803eba:	31 c0                	xor    %eax,%eax
+  803ebc:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803ec2:	48 63 d0             	movslq %eax,%rdx
+  803ec5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803eca:	48 01 d0             	add    %rdx,%rax
+  803ecd:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803ed2:	c9                   	leave
+  803ed3:	c3                   	ret
+
+0000000000803ed4 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803ed4:	55                   	push   %rbp
+  803ed5:	48 89 e5             	mov    %rsp,%rbp
+  803ed8:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803edc:	48 83 ec 40          	sub    $0x40,%rsp
+  803ee0:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803ee5:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803eea:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803eef:	eb 77                	jmp    803f68 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803ef1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ef6:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803efa:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803efe:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f03:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f07:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803f0b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803f0f:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803f13:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803f18:	74 3c                	je     803f56 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803f1a:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803f1e:	f7 d0                	not    %eax
+  803f20:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803f24:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803f28:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803f2c:	48 63 d0             	movslq %eax,%rdx
+  803f2f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f34:	48 01 d0             	add    %rdx,%rax
+  803f37:	0f b6 00             	movzbl (%rax),%eax
+  803f3a:	0f b6 c0             	movzbl %al,%eax
+  803f3d:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803f41:	48 63 ca             	movslq %edx,%rcx
+  803f44:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803f49:	48 01 ca             	add    %rcx,%rdx
+  803f4c:	0f b6 12             	movzbl (%rdx),%edx
+  803f4f:	0f b6 d2             	movzbl %dl,%edx
+  803f52:	29 d0                	sub    %edx,%eax
+  803f54:	eb 6b                	jmp    803fc1 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803f56:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803f5c:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803f62:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803f68:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803f6e:	77 81                	ja     803ef1 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803f70:	eb 42                	jmp    803fb4 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803f72:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f77:	0f b6 10             	movzbl (%rax),%edx
+  803f7a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f7f:	0f b6 00             	movzbl (%rax),%eax
+  803f82:	38 c2                	cmp    %al,%dl
+  803f84:	74 1c                	je     803fa2 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f86:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f8b:	0f b6 00             	movzbl (%rax),%eax
+  803f8e:	0f b6 c8             	movzbl %al,%ecx
+  803f91:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f96:	0f b6 00             	movzbl (%rax),%eax
+  803f99:	0f b6 d0             	movzbl %al,%edx
+  803f9c:	89 c8                	mov    %ecx,%eax
+  803f9e:	29 d0                	sub    %edx,%eax
+  803fa0:	eb 1f                	jmp    803fc1 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803fa2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fa8:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803fae:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fb4:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fba:	75 b6                	jne    803f72 <memcmp_avx2+0x9e>
+  return 0;
+  803fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fc1:	c9                   	leave
+  803fc2:	c3                   	ret
+
+0000000000803fc3 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803fc3:	55                   	push   %rbp
+  803fc4:	48 89 e5             	mov    %rsp,%rbp
+  803fc7:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803fcb:	48 83 ec 60          	sub    $0x60,%rsp
+  803fcf:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803fd4:	89 f0                	mov    %esi,%eax
+  803fd6:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803fdb:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803fdf:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803fe4:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803fe8:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803fed:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803ff3:	eb 47                	jmp    80403c <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803ff5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ffa:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803ffe:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  804002:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  804008:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80400c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  804010:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  804014:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  804019:	74 15                	je     804030 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80401b:	31 c0                	xor    %eax,%eax
+  80401d:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  804023:	48 63 d0             	movslq %eax,%rdx
+  804026:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80402b:	48 01 d0             	add    %rdx,%rax
+  80402e:	eb 3d                	jmp    80406d <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  804030:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  804036:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80403c:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  804042:	77 b1                	ja     803ff5 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  804044:	eb 0c                	jmp    804052 <memfind_avx2+0x8f>
+  804046:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80404c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  804052:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  804058:	74 0e                	je     804068 <memfind_avx2+0xa5>
+  80405a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80405f:	0f b6 00             	movzbl (%rax),%eax
+  804062:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  804066:	75 de                	jne    804046 <memfind_avx2+0x83>
+  return s;
+  804068:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80406d:	c9                   	leave
+  80406e:	c3                   	ret
+
+000000000080406f <strlen>:
+strlen(const char *s) {
+  80406f:	55                   	push   %rbp
+  804070:	48 89 e5             	mov    %rsp,%rbp
+  804073:	48 83 ec 40          	sub    $0x40,%rsp
+  804077:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80407b:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80407f:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  804083:	48 b8 0c 3d 80 00 00 	movabs $0x803d0c,%rax
+  80408a:	00 00 00 
+  80408d:	ff d0                	call   *%rax
+  80408f:	83 e0 02             	and    $0x2,%eax
+  804092:	85 c0                	test   %eax,%eax
+  804094:	74 18                	je     8040ae <strlen+0x3f>
+    return strlen_avx2(s);
+  804096:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80409a:	48 89 c7             	mov    %rax,%rdi
+  80409d:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+  8040a9:	e9 82 00 00 00       	jmp    804130 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8040ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b2:	83 e0 0f             	and    $0xf,%eax
+  8040b5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8040b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040bb:	48 f7 d8             	neg    %rax
+  8040be:	48 89 c2             	mov    %rax,%rdx
+  8040c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040c5:	48 01 d0             	add    %rdx,%rax
+  8040c8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8040cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040d0:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8040d4:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8040d9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8040dd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8040e1:	89 c2                	mov    %eax,%edx
+  8040e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040e6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8040eb:	89 c1                	mov    %eax,%ecx
+  8040ed:	d3 e6                	shl    %cl,%esi
+  8040ef:	89 f0                	mov    %esi,%eax
+  8040f1:	21 d0                	and    %edx,%eax
+  8040f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040f6:	eb 1d                	jmp    804115 <strlen+0xa6>
+    p += 16;
+  8040f8:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8040fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804101:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804105:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80410a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80410e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804112:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804115:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804119:	74 dd                	je     8040f8 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80411b:	31 c0                	xor    %eax,%eax
+  80411d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  804122:	48 63 d0             	movslq %eax,%rdx
+  804125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804129:	48 01 d0             	add    %rdx,%rax
+  80412c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  804130:	c9                   	leave
+  804131:	c3                   	ret
+
+0000000000804132 <strnlen>:
+strnlen(const char *s, size_t size) {
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+  804136:	48 83 ec 20          	sub    $0x20,%rsp
+  80413a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80413e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804142:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804149:	eb 0e                	jmp    804159 <strnlen+0x27>
+    n++;
+  80414b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80414f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804154:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804159:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80415e:	74 0b                	je     80416b <strnlen+0x39>
+  804160:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804164:	0f b6 00             	movzbl (%rax),%eax
+  804167:	84 c0                	test   %al,%al
+  804169:	75 e0                	jne    80414b <strnlen+0x19>
+  return n;
+  80416b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80416e:	c9                   	leave
+  80416f:	c3                   	ret
+
+0000000000804170 <strcpy>:
+strcpy(char *dst, const char *src) {
+  804170:	55                   	push   %rbp
+  804171:	48 89 e5             	mov    %rsp,%rbp
+  804174:	48 83 ec 20          	sub    $0x20,%rsp
+  804178:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80417c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  804180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804184:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804188:	90                   	nop
+  804189:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80418d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804191:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804199:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80419d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041a1:	0f b6 12             	movzbl (%rdx),%edx
+  8041a4:	88 10                	mov    %dl,(%rax)
+  8041a6:	0f b6 00             	movzbl (%rax),%eax
+  8041a9:	84 c0                	test   %al,%al
+  8041ab:	75 dc                	jne    804189 <strcpy+0x19>
+  return ret;
+  8041ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8041b1:	c9                   	leave
+  8041b2:	c3                   	ret
+
+00000000008041b3 <strcat>:
+strcat(char *dst, const char *src) {
+  8041b3:	55                   	push   %rbp
+  8041b4:	48 89 e5             	mov    %rsp,%rbp
+  8041b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8041bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8041c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c7:	48 89 c7             	mov    %rax,%rdi
+  8041ca:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  8041d1:	00 00 00 
+  8041d4:	ff d0                	call   *%rax
+  8041d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8041d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041dc:	48 63 d0             	movslq %eax,%rdx
+  8041df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e3:	48 01 c2             	add    %rax,%rdx
+  8041e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ea:	48 89 c6             	mov    %rax,%rsi
+  8041ed:	48 89 d7             	mov    %rdx,%rdi
+  8041f0:	48 b8 70 41 80 00 00 	movabs $0x804170,%rax
+  8041f7:	00 00 00 
+  8041fa:	ff d0                	call   *%rax
+  return dst;
+  8041fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804200:	c9                   	leave
+  804201:	c3                   	ret
+
+0000000000804202 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  804202:	55                   	push   %rbp
+  804203:	48 89 e5             	mov    %rsp,%rbp
+  804206:	48 83 ec 28          	sub    $0x28,%rsp
+  80420a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80420e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804212:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  804216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80421e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804225:	00 
+  804226:	eb 2a                	jmp    804252 <strncpy+0x50>
+    *dst++ = *src;
+  804228:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804230:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804234:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804238:	0f b6 12             	movzbl (%rdx),%edx
+  80423b:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80423d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804241:	0f b6 00             	movzbl (%rax),%eax
+  804244:	84 c0                	test   %al,%al
+  804246:	74 05                	je     80424d <strncpy+0x4b>
+      src++;
+  804248:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80424d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804252:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804256:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80425a:	72 cc                	jb     804228 <strncpy+0x26>
+  return ret;
+  80425c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804260:	c9                   	leave
+  804261:	c3                   	ret
+
+0000000000804262 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  804262:	55                   	push   %rbp
+  804263:	48 89 e5             	mov    %rsp,%rbp
+  804266:	48 83 ec 28          	sub    $0x28,%rsp
+  80426a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80426e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804272:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80427a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80427e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804283:	74 3d                	je     8042c2 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804285:	eb 1d                	jmp    8042a4 <strlcpy+0x42>
+      *dst++ = *src++;
+  804287:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80428b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80428f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804297:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80429b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80429f:	0f b6 12             	movzbl (%rdx),%edx
+  8042a2:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8042a4:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8042a9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8042ae:	74 0b                	je     8042bb <strlcpy+0x59>
+  8042b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042b4:	0f b6 00             	movzbl (%rax),%eax
+  8042b7:	84 c0                	test   %al,%al
+  8042b9:	75 cc                	jne    804287 <strlcpy+0x25>
+    *dst = '\0';
+  8042bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042bf:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8042c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042c6:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8042ca:	c9                   	leave
+  8042cb:	c3                   	ret
+
+00000000008042cc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8042cc:	55                   	push   %rbp
+  8042cd:	48 89 e5             	mov    %rsp,%rbp
+  8042d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8042d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042dc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8042e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042e4:	48 89 c7             	mov    %rax,%rdi
+  8042e7:	48 b8 6f 40 80 00 00 	movabs $0x80406f,%rax
+  8042ee:	00 00 00 
+  8042f1:	ff d0                	call   *%rax
+  8042f3:	48 98                	cltq
+  8042f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8042f9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804301:	48 89 d6             	mov    %rdx,%rsi
+  804304:	48 89 c7             	mov    %rax,%rdi
+  804307:	48 b8 32 41 80 00 00 	movabs $0x804132,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+  804313:	48 98                	cltq
+  804315:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  804319:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80431d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804321:	75 10                	jne    804333 <strlcat+0x67>
+    return maxlen + srclen;
+  804323:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80432b:	48 01 d0             	add    %rdx,%rax
+  80432e:	e9 86 00 00 00       	jmp    8043b9 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  804333:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804337:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80433b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80433f:	73 2b                	jae    80436c <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  804341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804345:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804349:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80434d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804351:	48 01 c1             	add    %rax,%rcx
+  804354:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804358:	48 89 c6             	mov    %rax,%rsi
+  80435b:	48 89 cf             	mov    %rcx,%rdi
+  80435e:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  804365:	00 00 00 
+  804368:	ff d0                	call   *%rax
+  80436a:	eb 42                	jmp    8043ae <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80436c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804370:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804374:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804378:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80437c:	48 01 c1             	add    %rax,%rcx
+  80437f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804383:	48 89 c6             	mov    %rax,%rsi
+  804386:	48 89 cf             	mov    %rcx,%rdi
+  804389:	48 b8 b9 48 80 00 00 	movabs $0x8048b9,%rax
+  804390:	00 00 00 
+  804393:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804395:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804399:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80439d:	48 01 d0             	add    %rdx,%rax
+  8043a0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8043a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043a8:	48 01 d0             	add    %rdx,%rax
+  8043ab:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8043ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043b6:	48 01 d0             	add    %rdx,%rax
+}
+  8043b9:	c9                   	leave
+  8043ba:	c3                   	ret
+
+00000000008043bb <strcmp>:
+strcmp(const char *p, const char *q) {
+  8043bb:	55                   	push   %rbp
+  8043bc:	48 89 e5             	mov    %rsp,%rbp
+  8043bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8043c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8043cb:	eb 0a                	jmp    8043d7 <strcmp+0x1c>
+    p++, q++;
+  8043cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043d2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8043d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043db:	0f b6 00             	movzbl (%rax),%eax
+  8043de:	84 c0                	test   %al,%al
+  8043e0:	74 12                	je     8043f4 <strcmp+0x39>
+  8043e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e6:	0f b6 10             	movzbl (%rax),%edx
+  8043e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ed:	0f b6 00             	movzbl (%rax),%eax
+  8043f0:	38 c2                	cmp    %al,%dl
+  8043f2:	74 d9                	je     8043cd <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8043f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f8:	0f b6 00             	movzbl (%rax),%eax
+  8043fb:	0f b6 d0             	movzbl %al,%edx
+  8043fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804402:	0f b6 00             	movzbl (%rax),%eax
+  804405:	0f b6 c0             	movzbl %al,%eax
+  804408:	29 c2                	sub    %eax,%edx
+  80440a:	89 d0                	mov    %edx,%eax
+}
+  80440c:	c9                   	leave
+  80440d:	c3                   	ret
+
+000000000080440e <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80440e:	55                   	push   %rbp
+  80440f:	48 89 e5             	mov    %rsp,%rbp
+  804412:	48 83 ec 18          	sub    $0x18,%rsp
+  804416:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80441a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80441e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  804422:	eb 0f                	jmp    804433 <strncmp+0x25>
+    n--, p++, q++;
+  804424:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  804429:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80442e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  804433:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804438:	74 1d                	je     804457 <strncmp+0x49>
+  80443a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80443e:	0f b6 00             	movzbl (%rax),%eax
+  804441:	84 c0                	test   %al,%al
+  804443:	74 12                	je     804457 <strncmp+0x49>
+  804445:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804449:	0f b6 10             	movzbl (%rax),%edx
+  80444c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804450:	0f b6 00             	movzbl (%rax),%eax
+  804453:	38 c2                	cmp    %al,%dl
+  804455:	74 cd                	je     804424 <strncmp+0x16>
+  if (n == 0)
+  804457:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80445c:	75 07                	jne    804465 <strncmp+0x57>
+    return 0;
+  80445e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804463:	eb 16                	jmp    80447b <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  804465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804469:	0f b6 00             	movzbl (%rax),%eax
+  80446c:	0f b6 d0             	movzbl %al,%edx
+  80446f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804473:	0f b6 00             	movzbl (%rax),%eax
+  804476:	0f b6 c0             	movzbl %al,%eax
+  804479:	29 c2                	sub    %eax,%edx
+}
+  80447b:	89 d0                	mov    %edx,%eax
+  80447d:	c9                   	leave
+  80447e:	c3                   	ret
+
+000000000080447f <strchr>:
+strchr(const char *s, char c) {
+  80447f:	55                   	push   %rbp
+  804480:	48 89 e5             	mov    %rsp,%rbp
+  804483:	48 83 ec 60          	sub    $0x60,%rsp
+  804487:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80448b:	89 f0                	mov    %esi,%eax
+  80448d:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  804490:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804494:	83 e0 0f             	and    $0xf,%eax
+  804497:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80449a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80449d:	48 f7 d8             	neg    %rax
+  8044a0:	48 89 c2             	mov    %rax,%rdx
+  8044a3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044a7:	48 01 d0             	add    %rdx,%rax
+  8044aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8044ae:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8044b2:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8044b6:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8044ba:	66 0f 6e c0          	movd   %eax,%xmm0
+  8044be:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8044c2:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8044c6:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8044cb:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8044cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d3:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044d7:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8044db:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044e0:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044e5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044e9:	89 c2                	mov    %eax,%edx
+  8044eb:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044f0:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044f5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044f9:	09 c2                	or     %eax,%edx
+  8044fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044fe:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804503:	89 c1                	mov    %eax,%ecx
+  804505:	d3 e6                	shl    %cl,%esi
+  804507:	89 f0                	mov    %esi,%eax
+  804509:	21 d0                	and    %edx,%eax
+  80450b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80450e:	eb 34                	jmp    804544 <strchr+0xc5>
+    p += 16;
+  804510:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  804515:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804519:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80451d:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  804521:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804526:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80452b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80452f:	89 c2                	mov    %eax,%edx
+  804531:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  804536:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80453b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80453f:	09 d0                	or     %edx,%eax
+  804541:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804544:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804548:	74 c6                	je     804510 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80454a:	31 c0                	xor    %eax,%eax
+  80454c:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  804551:	48 98                	cltq
+  804553:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  804557:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80455b:	0f b6 00             	movzbl (%rax),%eax
+  80455e:	84 c0                	test   %al,%al
+  804560:	74 06                	je     804568 <strchr+0xe9>
+  804562:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804566:	eb 05                	jmp    80456d <strchr+0xee>
+  804568:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80456d:	c9                   	leave
+  80456e:	c3                   	ret
+
+000000000080456f <strfind>:
+strfind(const char *s, char c) {
+  80456f:	55                   	push   %rbp
+  804570:	48 89 e5             	mov    %rsp,%rbp
+  804573:	48 83 ec 10          	sub    $0x10,%rsp
+  804577:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80457b:	89 f0                	mov    %esi,%eax
+  80457d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  804580:	eb 11                	jmp    804593 <strfind+0x24>
+    if (*s == c)
+  804582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804586:	0f b6 00             	movzbl (%rax),%eax
+  804589:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80458c:	74 12                	je     8045a0 <strfind+0x31>
+  for (; *s; s++)
+  80458e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804593:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804597:	0f b6 00             	movzbl (%rax),%eax
+  80459a:	84 c0                	test   %al,%al
+  80459c:	75 e4                	jne    804582 <strfind+0x13>
+  80459e:	eb 01                	jmp    8045a1 <strfind+0x32>
+      break;
+  8045a0:	90                   	nop
+  return (char *)s;
+  8045a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8045a5:	c9                   	leave
+  8045a6:	c3                   	ret
+
+00000000008045a7 <memset>:
+memset(void *v, int c, size_t n) {
+  8045a7:	55                   	push   %rbp
+  8045a8:	48 89 e5             	mov    %rsp,%rbp
+  8045ab:	48 83 ec 38          	sub    $0x38,%rsp
+  8045af:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8045b3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8045b6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8045ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8045c2:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8045c7:	76 41                	jbe    80460a <memset+0x63>
+  8045c9:	48 b8 0c 3d 80 00 00 	movabs $0x803d0c,%rax
+  8045d0:	00 00 00 
+  8045d3:	ff d0                	call   *%rax
+  8045d5:	83 e0 01             	and    $0x1,%eax
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	74 2e                	je     80460a <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8045dc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045df:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045e3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045e7:	48 89 ce             	mov    %rcx,%rsi
+  8045ea:	48 89 f7             	mov    %rsi,%rdi
+  8045ed:	48 89 d1             	mov    %rdx,%rcx
+  8045f0:	fc                   	cld
+  8045f1:	f3 aa                	rep stos %al,%es:(%rdi)
+  8045f3:	48 89 ca             	mov    %rcx,%rdx
+  8045f6:	48 89 fe             	mov    %rdi,%rsi
+  8045f9:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8045fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  804601:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804605:	e9 a7 00 00 00       	jmp    8046b1 <memset+0x10a>
+  if (n >= 8) {
+  80460a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80460f:	0f 86 87 00 00 00    	jbe    80469c <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  804615:	eb 16                	jmp    80462d <memset+0x86>
+      *p++ = c;
+  804617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80461b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80461f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804623:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804626:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  804628:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80462d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804631:	83 e0 07             	and    $0x7,%eax
+  804634:	48 85 c0             	test   %rax,%rax
+  804637:	75 de                	jne    804617 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  804639:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80463c:	0f b6 c0             	movzbl %al,%eax
+  80463f:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  804646:	01 01 01 
+  804649:	48 0f af c2          	imul   %rdx,%rax
+  80464d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  804651:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804655:	48 c1 e8 03          	shr    $0x3,%rax
+  804659:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80465d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804661:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804665:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804669:	48 89 ce             	mov    %rcx,%rsi
+  80466c:	48 89 f7             	mov    %rsi,%rdi
+  80466f:	48 89 d1             	mov    %rdx,%rcx
+  804672:	fc                   	cld
+  804673:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804676:	48 89 ca             	mov    %rcx,%rdx
+  804679:	48 89 fe             	mov    %rdi,%rsi
+  80467c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804680:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804684:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804689:	eb 11                	jmp    80469c <memset+0xf5>
+    *p++ = c;
+  80468b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80468f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804693:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804697:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80469a:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80469c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8046a8:	48 85 c0             	test   %rax,%rax
+  8046ab:	75 de                	jne    80468b <memset+0xe4>
+  return v;
+  8046ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8046b1:	c9                   	leave
+  8046b2:	c3                   	ret
+
+00000000008046b3 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8046b3:	55                   	push   %rbp
+  8046b4:	48 89 e5             	mov    %rsp,%rbp
+  8046b7:	48 83 ec 38          	sub    $0x38,%rsp
+  8046bb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8046bf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8046c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8046cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8046d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046db:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8046df:	0f 83 da 00 00 00    	jae    8047bf <memmove+0x10c>
+  8046e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ed:	48 01 d0             	add    %rdx,%rax
+  8046f0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8046f4:	0f 83 c5 00 00 00    	jae    8047bf <memmove+0x10c>
+    s += n;
+  8046fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046fe:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  804702:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804706:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80470a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80470f:	0f 86 94 00 00 00    	jbe    8047a9 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  804715:	eb 1c                	jmp    804733 <memmove+0x80>
+        *--d = *--s;
+  804717:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80471c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804721:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804725:	0f b6 10             	movzbl (%rax),%edx
+  804728:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80472c:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80472e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  804733:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804737:	83 e0 07             	and    $0x7,%eax
+  80473a:	48 85 c0             	test   %rax,%rax
+  80473d:	75 d8                	jne    804717 <memmove+0x64>
+      nq = n / 8;
+  80473f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804743:	48 c1 e8 03          	shr    $0x3,%rax
+  804747:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80474b:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  804750:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  804755:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80475a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80475e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804766:	48 89 cf             	mov    %rcx,%rdi
+  804769:	48 89 d6             	mov    %rdx,%rsi
+  80476c:	48 89 c1             	mov    %rax,%rcx
+  80476f:	fd                   	std
+  804770:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804773:	fc                   	cld
+  804774:	48 89 c8             	mov    %rcx,%rax
+  804777:	48 89 f2             	mov    %rsi,%rdx
+  80477a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80477e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804782:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804786:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80478b:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  804790:	eb 17                	jmp    8047a9 <memmove+0xf6>
+      *--d = *--s;
+  804792:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804797:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80479c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047a0:	0f b6 10             	movzbl (%rax),%edx
+  8047a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047a7:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8047a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047ad:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8047b1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8047b5:	48 85 c0             	test   %rax,%rax
+  8047b8:	75 d8                	jne    804792 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8047ba:	e9 f4 00 00 00       	jmp    8048b3 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8047bf:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8047c4:	76 46                	jbe    80480c <memmove+0x159>
+  8047c6:	48 b8 0c 3d 80 00 00 	movabs $0x803d0c,%rax
+  8047cd:	00 00 00 
+  8047d0:	ff d0                	call   *%rax
+  8047d2:	83 e0 01             	and    $0x1,%eax
+  8047d5:	85 c0                	test   %eax,%eax
+  8047d7:	74 33                	je     80480c <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8047d9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047e5:	48 89 cf             	mov    %rcx,%rdi
+  8047e8:	48 89 d6             	mov    %rdx,%rsi
+  8047eb:	48 89 c1             	mov    %rax,%rcx
+  8047ee:	fc                   	cld
+  8047ef:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8047f1:	48 89 c8             	mov    %rcx,%rax
+  8047f4:	48 89 f2             	mov    %rsi,%rdx
+  8047f7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8047fb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8047ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  804803:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804807:	e9 ab 00 00 00       	jmp    8048b7 <memmove+0x204>
+    if (n >= 8) {
+  80480c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  804811:	0f 86 8b 00 00 00    	jbe    8048a2 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  804817:	eb 22                	jmp    80483b <memmove+0x188>
+        *d++ = *s++;
+  804819:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80481d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804821:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804825:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804829:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80482d:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804831:	0f b6 12             	movzbl (%rdx),%edx
+  804834:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  804836:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80483b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80483f:	83 e0 07             	and    $0x7,%eax
+  804842:	48 85 c0             	test   %rax,%rax
+  804845:	75 d2                	jne    804819 <memmove+0x166>
+      nq = n / 8;
+  804847:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80484b:	48 c1 e8 03          	shr    $0x3,%rax
+  80484f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  804853:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804857:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80485b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80485f:	48 89 cf             	mov    %rcx,%rdi
+  804862:	48 89 d6             	mov    %rdx,%rsi
+  804865:	48 89 c1             	mov    %rax,%rcx
+  804868:	fc                   	cld
+  804869:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80486c:	48 89 c8             	mov    %rcx,%rax
+  80486f:	48 89 f2             	mov    %rsi,%rdx
+  804872:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804876:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80487a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80487e:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  804883:	eb 1d                	jmp    8048a2 <memmove+0x1ef>
+      *d++ = *s++;
+  804885:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804889:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80488d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804891:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804895:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804899:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80489d:	0f b6 12             	movzbl (%rdx),%edx
+  8048a0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8048a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8048aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8048ae:	48 85 c0             	test   %rax,%rax
+  8048b1:	75 d2                	jne    804885 <memmove+0x1d2>
+  return dst;
+  8048b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8048b7:	c9                   	leave
+  8048b8:	c3                   	ret
+
+00000000008048b9 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8048b9:	55                   	push   %rbp
+  8048ba:	48 89 e5             	mov    %rsp,%rbp
+  8048bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8048c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8048c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8048c9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8048cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048d1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048d9:	48 89 ce             	mov    %rcx,%rsi
+  8048dc:	48 89 c7             	mov    %rax,%rdi
+  8048df:	48 b8 b3 46 80 00 00 	movabs $0x8046b3,%rax
+  8048e6:	00 00 00 
+  8048e9:	ff d0                	call   *%rax
+}
+  8048eb:	c9                   	leave
+  8048ec:	c3                   	ret
+
+00000000008048ed <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  8048ed:	55                   	push   %rbp
+  8048ee:	48 89 e5             	mov    %rsp,%rbp
+  8048f1:	48 83 ec 40          	sub    $0x40,%rsp
+  8048f5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048f9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  804901:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804905:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804909:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80490d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804911:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  804916:	0f 86 a7 00 00 00    	jbe    8049c3 <memcmp+0xd6>
+  80491c:	48 b8 0c 3d 80 00 00 	movabs $0x803d0c,%rax
+  804923:	00 00 00 
+  804926:	ff d0                	call   *%rax
+  804928:	83 e0 02             	and    $0x2,%eax
+  80492b:	85 c0                	test   %eax,%eax
+  80492d:	0f 84 90 00 00 00    	je     8049c3 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  804933:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804937:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80493b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493f:	48 89 ce             	mov    %rcx,%rsi
+  804942:	48 89 c7             	mov    %rax,%rdi
+  804945:	48 b8 d4 3e 80 00 00 	movabs $0x803ed4,%rax
+  80494c:	00 00 00 
+  80494f:	ff d0                	call   *%rax
+  804951:	e9 c2 00 00 00       	jmp    804a18 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  804956:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495a:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80495e:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804962:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804966:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80496a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80496e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804972:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804975:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  80497c:	74 36                	je     8049b4 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80497e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804981:	f7 d0                	not    %eax
+  804983:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804987:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80498a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80498d:	48 63 d0             	movslq %eax,%rdx
+  804990:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804994:	48 01 d0             	add    %rdx,%rax
+  804997:	0f b6 00             	movzbl (%rax),%eax
+  80499a:	0f b6 c0             	movzbl %al,%eax
+  80499d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049a0:	48 63 ca             	movslq %edx,%rcx
+  8049a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049a7:	48 01 ca             	add    %rcx,%rdx
+  8049aa:	0f b6 12             	movzbl (%rdx),%edx
+  8049ad:	0f b6 d2             	movzbl %dl,%edx
+  8049b0:	29 d0                	sub    %edx,%eax
+  8049b2:	eb 64                	jmp    804a18 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8049b4:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8049b9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8049be:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  8049c3:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  8049c8:	77 8c                	ja     804956 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  8049ca:	eb 36                	jmp    804a02 <memcmp+0x115>
+    if (*s1 != *s2)
+  8049cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049d0:	0f b6 10             	movzbl (%rax),%edx
+  8049d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049d7:	0f b6 00             	movzbl (%rax),%eax
+  8049da:	38 c2                	cmp    %al,%dl
+  8049dc:	74 1a                	je     8049f8 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  8049de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049e2:	0f b6 00             	movzbl (%rax),%eax
+  8049e5:	0f b6 c8             	movzbl %al,%ecx
+  8049e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049ec:	0f b6 00             	movzbl (%rax),%eax
+  8049ef:	0f b6 d0             	movzbl %al,%edx
+  8049f2:	89 c8                	mov    %ecx,%eax
+  8049f4:	29 d0                	sub    %edx,%eax
+  8049f6:	eb 20                	jmp    804a18 <memcmp+0x12b>
+    s1++, s2++;
+  8049f8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8049fd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  804a02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a06:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804a0e:	48 85 c0             	test   %rax,%rax
+  804a11:	75 b9                	jne    8049cc <memcmp+0xdf>
+  }
+
+  return 0;
+  804a13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a18:	c9                   	leave
+  804a19:	c3                   	ret
+
+0000000000804a1a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  804a1a:	55                   	push   %rbp
+  804a1b:	48 89 e5             	mov    %rsp,%rbp
+  804a1e:	48 83 ec 50          	sub    $0x50,%rsp
+  804a22:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804a26:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  804a29:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  804a2d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a31:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a35:	48 01 d0             	add    %rdx,%rax
+  804a38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  804a3c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a3f:	66 0f 6e c0          	movd   %eax,%xmm0
+  804a43:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  804a47:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804a4b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804a50:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  804a54:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  804a59:	76 73                	jbe    804ace <memfind+0xb4>
+  804a5b:	48 b8 0c 3d 80 00 00 	movabs $0x803d0c,%rax
+  804a62:	00 00 00 
+  804a65:	ff d0                	call   *%rax
+  804a67:	83 e0 02             	and    $0x2,%eax
+  804a6a:	85 c0                	test   %eax,%eax
+  804a6c:	74 60                	je     804ace <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  804a6e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a71:	0f b6 c8             	movzbl %al,%ecx
+  804a74:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a7c:	89 ce                	mov    %ecx,%esi
+  804a7e:	48 89 c7             	mov    %rax,%rdi
+  804a81:	48 b8 c3 3f 80 00 00 	movabs $0x803fc3,%rax
+  804a88:	00 00 00 
+  804a8b:	ff d0                	call   *%rax
+  804a8d:	eb 6c                	jmp    804afb <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a93:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a97:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a9b:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804aa0:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804aa4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804aa8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804aab:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804aaf:	74 13                	je     804ac4 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804ab1:	31 c0                	xor    %eax,%eax
+  804ab3:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804ab8:	48 63 d0             	movslq %eax,%rdx
+  804abb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804abf:	48 01 d0             	add    %rdx,%rax
+  804ac2:	eb 37                	jmp    804afb <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804ac4:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804ac9:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804ace:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804ad3:	77 ba                	ja     804a8f <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804ad5:	eb 13                	jmp    804aea <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804ad7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804adb:	0f b6 00             	movzbl (%rax),%eax
+  804ade:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804ae1:	38 d0                	cmp    %dl,%al
+  804ae3:	74 11                	je     804af6 <memfind+0xdc>
+  for (; s < ends; s++)
+  804ae5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804aea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aee:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804af2:	72 e3                	jb     804ad7 <memfind+0xbd>
+  804af4:	eb 01                	jmp    804af7 <memfind+0xdd>
+      break;
+  804af6:	90                   	nop
+  return (void *)s;
+  804af7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804afb:	c9                   	leave
+  804afc:	c3                   	ret
+
+0000000000804afd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804afd:	55                   	push   %rbp
+  804afe:	48 89 e5             	mov    %rsp,%rbp
+  804b01:	48 83 ec 38          	sub    $0x38,%rsp
+  804b05:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b09:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b0d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804b10:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804b17:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804b1e:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804b1f:	eb 05                	jmp    804b26 <strtol+0x29>
+    s++;
+  804b21:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804b26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2a:	0f b6 00             	movzbl (%rax),%eax
+  804b2d:	3c 20                	cmp    $0x20,%al
+  804b2f:	74 f0                	je     804b21 <strtol+0x24>
+  804b31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b35:	0f b6 00             	movzbl (%rax),%eax
+  804b38:	3c 09                	cmp    $0x9,%al
+  804b3a:	74 e5                	je     804b21 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804b3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b40:	0f b6 00             	movzbl (%rax),%eax
+  804b43:	3c 2b                	cmp    $0x2b,%al
+  804b45:	75 07                	jne    804b4e <strtol+0x51>
+    s++;
+  804b47:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b4c:	eb 17                	jmp    804b65 <strtol+0x68>
+  else if (*s == '-')
+  804b4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b52:	0f b6 00             	movzbl (%rax),%eax
+  804b55:	3c 2d                	cmp    $0x2d,%al
+  804b57:	75 0c                	jne    804b65 <strtol+0x68>
+    s++, neg = 1;
+  804b59:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b5e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804b65:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b69:	74 06                	je     804b71 <strtol+0x74>
+  804b6b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804b6f:	75 28                	jne    804b99 <strtol+0x9c>
+  804b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b75:	0f b6 00             	movzbl (%rax),%eax
+  804b78:	3c 30                	cmp    $0x30,%al
+  804b7a:	75 1d                	jne    804b99 <strtol+0x9c>
+  804b7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b80:	48 83 c0 01          	add    $0x1,%rax
+  804b84:	0f b6 00             	movzbl (%rax),%eax
+  804b87:	3c 78                	cmp    $0x78,%al
+  804b89:	75 0e                	jne    804b99 <strtol+0x9c>
+    s += 2, base = 16;
+  804b8b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b90:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b97:	eb 2c                	jmp    804bc5 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b9d:	75 19                	jne    804bb8 <strtol+0xbb>
+  804b9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba3:	0f b6 00             	movzbl (%rax),%eax
+  804ba6:	3c 30                	cmp    $0x30,%al
+  804ba8:	75 0e                	jne    804bb8 <strtol+0xbb>
+    s++, base = 8;
+  804baa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804baf:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804bb6:	eb 0d                	jmp    804bc5 <strtol+0xc8>
+  else if (base == 0)
+  804bb8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804bbc:	75 07                	jne    804bc5 <strtol+0xc8>
+    base = 10;
+  804bbe:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804bc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc9:	0f b6 00             	movzbl (%rax),%eax
+  804bcc:	3c 2f                	cmp    $0x2f,%al
+  804bce:	7e 1d                	jle    804bed <strtol+0xf0>
+  804bd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bd4:	0f b6 00             	movzbl (%rax),%eax
+  804bd7:	3c 39                	cmp    $0x39,%al
+  804bd9:	7f 12                	jg     804bed <strtol+0xf0>
+      dig = *s - '0';
+  804bdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bdf:	0f b6 00             	movzbl (%rax),%eax
+  804be2:	0f be c0             	movsbl %al,%eax
+  804be5:	83 e8 30             	sub    $0x30,%eax
+  804be8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804beb:	eb 4e                	jmp    804c3b <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf1:	0f b6 00             	movzbl (%rax),%eax
+  804bf4:	3c 60                	cmp    $0x60,%al
+  804bf6:	7e 1d                	jle    804c15 <strtol+0x118>
+  804bf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bfc:	0f b6 00             	movzbl (%rax),%eax
+  804bff:	3c 7a                	cmp    $0x7a,%al
+  804c01:	7f 12                	jg     804c15 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804c03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c07:	0f b6 00             	movzbl (%rax),%eax
+  804c0a:	0f be c0             	movsbl %al,%eax
+  804c0d:	83 e8 57             	sub    $0x57,%eax
+  804c10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c13:	eb 26                	jmp    804c3b <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804c15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c19:	0f b6 00             	movzbl (%rax),%eax
+  804c1c:	3c 40                	cmp    $0x40,%al
+  804c1e:	7e 47                	jle    804c67 <strtol+0x16a>
+  804c20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c24:	0f b6 00             	movzbl (%rax),%eax
+  804c27:	3c 5a                	cmp    $0x5a,%al
+  804c29:	7f 3c                	jg     804c67 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804c2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c2f:	0f b6 00             	movzbl (%rax),%eax
+  804c32:	0f be c0             	movsbl %al,%eax
+  804c35:	83 e8 37             	sub    $0x37,%eax
+  804c38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804c3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c3e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804c41:	7d 23                	jge    804c66 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804c43:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804c48:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c4b:	48 98                	cltq
+  804c4d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804c52:	48 89 c2             	mov    %rax,%rdx
+  804c55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c58:	48 98                	cltq
+  804c5a:	48 01 d0             	add    %rdx,%rax
+  804c5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804c61:	e9 5f ff ff ff       	jmp    804bc5 <strtol+0xc8>
+      break;
+  804c66:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804c67:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804c6c:	74 0b                	je     804c79 <strtol+0x17c>
+    *endptr = (char *)s;
+  804c6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c76:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c7d:	74 09                	je     804c88 <strtol+0x18b>
+  804c7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c83:	48 f7 d8             	neg    %rax
+  804c86:	eb 04                	jmp    804c8c <strtol+0x18f>
+  804c88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c8c:	c9                   	leave
+  804c8d:	c3                   	ret
+
+0000000000804c8e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c8e:	55                   	push   %rbp
+  804c8f:	48 89 e5             	mov    %rsp,%rbp
+  804c92:	48 83 ec 20          	sub    $0x20,%rsp
+  804c96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804ca2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ca6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804caa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cae:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804cb5:	48 89 c7             	mov    %rax,%rdi
+  804cb8:	48 b8 c6 4c 80 00 00 	movabs $0x804cc6,%rax
+  804cbf:	00 00 00 
+  804cc2:	ff d0                	call   *%rax
+}
+  804cc4:	c9                   	leave
+  804cc5:	c3                   	ret
+
+0000000000804cc6 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804cc6:	55                   	push   %rbp
+  804cc7:	48 89 e5             	mov    %rsp,%rbp
+  804cca:	48 83 ec 30          	sub    $0x30,%rsp
+  804cce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804cd2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804cd6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804cda:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804cde:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ce3:	75 0e                	jne    804cf3 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804ce5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804cec:	00 00 00 
+  804cef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804cf3:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804cf8:	75 18                	jne    804d12 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cfe:	48 89 c7             	mov    %rax,%rdi
+  804d01:	48 b8 51 06 80 00 00 	movabs $0x800651,%rax
+  804d08:	00 00 00 
+  804d0b:	ff d0                	call   *%rax
+  804d0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d10:	eb 1d                	jmp    804d2f <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804d12:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804d16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d1a:	48 89 d6             	mov    %rdx,%rsi
+  804d1d:	48 89 c7             	mov    %rax,%rdi
+  804d20:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  804d27:	00 00 00 
+  804d2a:	ff d0                	call   *%rax
+  804d2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804d2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d33:	79 2a                	jns    804d5f <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804d35:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d3a:	74 0a                	je     804d46 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d40:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804d46:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d4b:	74 0a                	je     804d57 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d51:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d5a:	e9 aa 00 00 00       	jmp    804e09 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d5f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d64:	74 36                	je     804d9c <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d66:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d6d:	00 00 00 
+  804d70:	8b 40 04             	mov    0x4(%rax),%eax
+  804d73:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d78:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d7f:	00 00 00 
+  804d82:	48 98                	cltq
+  804d84:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d8b:	48 01 d0             	add    %rdx,%rax
+  804d8e:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d94:	8b 10                	mov    (%rax),%edx
+  804d96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d9a:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d9c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804da1:	74 36                	je     804dd9 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804da3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804daa:	00 00 00 
+  804dad:	8b 40 04             	mov    0x4(%rax),%eax
+  804db0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804db5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804dbc:	00 00 00 
+  804dbf:	48 98                	cltq
+  804dc1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dc8:	48 01 d0             	add    %rdx,%rax
+  804dcb:	48 05 28 01 00 00    	add    $0x128,%rax
+  804dd1:	8b 10                	mov    (%rax),%edx
+  804dd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dd7:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804dd9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804de0:	00 00 00 
+  804de3:	8b 40 04             	mov    0x4(%rax),%eax
+  804de6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804deb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804df2:	00 00 00 
+  804df5:	48 98                	cltq
+  804df7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804dfe:	48 01 d0             	add    %rdx,%rax
+  804e01:	48 05 20 01 00 00    	add    $0x120,%rax
+  804e07:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804e09:	c9                   	leave
+  804e0a:	c3                   	ret
+
+0000000000804e0b <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804e0b:	55                   	push   %rbp
+  804e0c:	48 89 e5             	mov    %rsp,%rbp
+  804e0f:	48 83 ec 30          	sub    $0x30,%rsp
+  804e13:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804e16:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804e19:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804e1d:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804e20:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804e25:	75 5e                	jne    804e85 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804e27:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e2e:	00 00 00 
+  804e31:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e35:	eb 4e                	jmp    804e85 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804e37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e3b:	79 3c                	jns    804e79 <ipc_send+0x6e>
+  804e3d:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804e41:	74 36                	je     804e79 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804e43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e46:	89 c1                	mov    %eax,%ecx
+  804e48:	48 b8 68 56 80 00 00 	movabs $0x805668,%rax
+  804e4f:	00 00 00 
+  804e52:	48 89 c2             	mov    %rax,%rdx
+  804e55:	be 54 00 00 00       	mov    $0x54,%esi
+  804e5a:	48 b8 8e 56 80 00 00 	movabs $0x80568e,%rax
+  804e61:	00 00 00 
+  804e64:	48 89 c7             	mov    %rax,%rdi
+  804e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e6c:	49 b8 a1 2f 80 00 00 	movabs $0x802fa1,%r8
+  804e73:	00 00 00 
+  804e76:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e79:	48 b8 d4 03 80 00 00 	movabs $0x8003d4,%rax
+  804e80:	00 00 00 
+  804e83:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e85:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e88:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e92:	89 c7                	mov    %eax,%edi
+  804e94:	48 b8 fa 05 80 00 00 	movabs $0x8005fa,%rax
+  804e9b:	00 00 00 
+  804e9e:	ff d0                	call   *%rax
+  804ea0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ea3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ea7:	75 8e                	jne    804e37 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804ea9:	48 b8 d4 03 80 00 00 	movabs $0x8003d4,%rax
+  804eb0:	00 00 00 
+  804eb3:	ff d0                	call   *%rax
+}
+  804eb5:	90                   	nop
+  804eb6:	c9                   	leave
+  804eb7:	c3                   	ret
+
+0000000000804eb8 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804eb8:	55                   	push   %rbp
+  804eb9:	48 89 e5             	mov    %rsp,%rbp
+  804ebc:	48 83 ec 18          	sub    $0x18,%rsp
+  804ec0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804ec3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804eca:	eb 4d                	jmp    804f19 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804ecc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ed3:	00 00 00 
+  804ed6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ed9:	48 98                	cltq
+  804edb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ee2:	48 01 d0             	add    %rdx,%rax
+  804ee5:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804eeb:	8b 00                	mov    (%rax),%eax
+  804eed:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ef0:	75 23                	jne    804f15 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804ef2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ef9:	00 00 00 
+  804efc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eff:	48 98                	cltq
+  804f01:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f08:	48 01 d0             	add    %rdx,%rax
+  804f0b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804f11:	8b 00                	mov    (%rax),%eax
+  804f13:	eb 12                	jmp    804f27 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804f15:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804f19:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804f20:	7e aa                	jle    804ecc <ipc_find_env+0x14>
+  return 0;
+  804f22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f27:	c9                   	leave
+  804f28:	c3                   	ret
+
+0000000000804f29 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804f29:	55                   	push   %rbp
+  804f2a:	48 89 e5             	mov    %rsp,%rbp
+  804f2d:	48 83 ec 18          	sub    $0x18,%rsp
+  804f31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804f35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f39:	48 c1 e8 27          	shr    $0x27,%rax
+  804f3d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804f42:	48 89 c2             	mov    %rax,%rdx
+  804f45:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f4c:	01 00 00 
+  804f4f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f53:	83 e0 01             	and    $0x1,%eax
+  804f56:	48 85 c0             	test   %rax,%rax
+  804f59:	74 63                	je     804fbe <pageref+0x95>
+  804f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f63:	48 89 c2             	mov    %rax,%rdx
+  804f66:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f6d:	01 00 00 
+  804f70:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f74:	83 e0 01             	and    $0x1,%eax
+  804f77:	48 85 c0             	test   %rax,%rax
+  804f7a:	74 42                	je     804fbe <pageref+0x95>
+  804f7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f80:	48 c1 e8 15          	shr    $0x15,%rax
+  804f84:	48 89 c2             	mov    %rax,%rdx
+  804f87:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f8e:	01 00 00 
+  804f91:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f95:	83 e0 01             	and    $0x1,%eax
+  804f98:	48 85 c0             	test   %rax,%rax
+  804f9b:	74 21                	je     804fbe <pageref+0x95>
+  804f9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa1:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fa5:	48 89 c2             	mov    %rax,%rdx
+  804fa8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804faf:	01 00 00 
+  804fb2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fb6:	83 e0 01             	and    $0x1,%eax
+  804fb9:	48 85 c0             	test   %rax,%rax
+  804fbc:	75 07                	jne    804fc5 <pageref+0x9c>
+    return 0;
+  804fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fc3:	eb 53                	jmp    805018 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804fc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc9:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fcd:	48 89 c2             	mov    %rax,%rdx
+  804fd0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804fd7:	01 00 00 
+  804fda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fde:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804fe2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fe6:	83 e0 01             	and    $0x1,%eax
+  804fe9:	48 85 c0             	test   %rax,%rax
+  804fec:	75 07                	jne    804ff5 <pageref+0xcc>
+    return 0;
+  804fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff3:	eb 23                	jmp    805018 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ff9:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ffd:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805004:	00 00 00 
+  805007:	48 c1 e0 04          	shl    $0x4,%rax
+  80500b:	48 01 d0             	add    %rdx,%rax
+  80500e:	48 83 c0 08          	add    $0x8,%rax
+  805012:	0f b7 00             	movzwl (%rax),%eax
+  805015:	0f b7 c0             	movzwl %ax,%eax
+}
+  805018:	c9                   	leave
+  805019:	c3                   	ret
+  80501a:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,9510 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 5f 07 00 00       	call   80078b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <sum>:
+    "so is this"};
+
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80003e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, tot = 0;
+  800041:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  for (i = 0; i < n; i++)
+  800048:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80004f:	eb 1e                	jmp    80006f <sum+0x3d>
+    tot ^= i * s[i];
+  800051:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800054:	48 63 d0             	movslq %eax,%rdx
+  800057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80005b:	48 01 d0             	add    %rdx,%rax
+  80005e:	0f b6 00             	movzbl (%rax),%eax
+  800061:	0f be c0             	movsbl %al,%eax
+  800064:	0f af 45 fc          	imul   -0x4(%rbp),%eax
+  800068:	31 45 f8             	xor    %eax,-0x8(%rbp)
+  for (i = 0; i < n; i++)
+  80006b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80006f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800072:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  800075:	7c da                	jl     800051 <sum+0x1f>
+  return tot;
+  800077:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80007a:	c9                   	leave
+  80007b:	c3                   	ret
+
+000000000080007c <umain>:
+
+void
+umain(int argc, char **argv) {
+  80007c:	55                   	push   %rbp
+  80007d:	48 89 e5             	mov    %rsp,%rbp
+  800080:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800087:	89 bd ec fe ff ff    	mov    %edi,-0x114(%rbp)
+  80008d:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  int i, r, x, want;
+  char args[256];
+
+  cprintf("init: running\n");
+  800094:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  80009b:	00 00 00 
+  80009e:	48 89 c7             	mov    %rax,%rdi
+  8000a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a6:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  8000ad:	00 00 00 
+  8000b0:	ff d2                	call   *%rdx
+
+  want = 0xf989e;
+  8000b2:	c7 45 f8 9e 98 0f 00 	movl   $0xf989e,-0x8(%rbp)
+  if ((x = sum((char *)&data, sizeof data)) != want)
+  8000b9:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000be:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000c5:	00 00 00 
+  8000c8:	48 89 c7             	mov    %rax,%rdi
+  8000cb:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+  8000d7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8000da:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000dd:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+  8000e0:	74 28                	je     80010a <umain+0x8e>
+    cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000e2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8000e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000e8:	89 c6                	mov    %eax,%esi
+  8000ea:	48 b8 70 61 80 00 00 	movabs $0x806170,%rax
+  8000f1:	00 00 00 
+  8000f4:	48 89 c7             	mov    %rax,%rdi
+  8000f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fc:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  800103:	00 00 00 
+  800106:	ff d1                	call   *%rcx
+  800108:	eb 1e                	jmp    800128 <umain+0xac>
+            x, want);
+  else
+    cprintf("init: data seems okay\n");
+  80010a:	48 b8 a9 61 80 00 00 	movabs $0x8061a9,%rax
+  800111:	00 00 00 
+  800114:	48 89 c7             	mov    %rax,%rdi
+  800117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011c:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  800123:	00 00 00 
+  800126:	ff d2                	call   *%rdx
+  if ((x = sum(bss, sizeof bss)) != 0)
+  800128:	be 70 17 00 00       	mov    $0x1770,%esi
+  80012d:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800134:	00 00 00 
+  800137:	48 89 c7             	mov    %rax,%rdi
+  80013a:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800141:	00 00 00 
+  800144:	ff d0                	call   *%rax
+  800146:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800149:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80014d:	74 25                	je     800174 <umain+0xf8>
+    cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  80014f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800152:	89 c6                	mov    %eax,%esi
+  800154:	48 b8 c0 61 80 00 00 	movabs $0x8061c0,%rax
+  80015b:	00 00 00 
+  80015e:	48 89 c7             	mov    %rax,%rdi
+  800161:	b8 00 00 00 00       	mov    $0x0,%eax
+  800166:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  80016d:	00 00 00 
+  800170:	ff d2                	call   *%rdx
+  800172:	eb 1e                	jmp    800192 <umain+0x116>
+  else
+    cprintf("init: bss seems okay\n");
+  800174:	48 b8 ef 61 80 00 00 	movabs $0x8061ef,%rax
+  80017b:	00 00 00 
+  80017e:	48 89 c7             	mov    %rax,%rdi
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  80018d:	00 00 00 
+  800190:	ff d2                	call   *%rdx
+
+  // output in one syscall per line to avoid output interleaving
+  strcat(args, "init: args:");
+  800192:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800199:	48 ba 05 62 80 00 00 	movabs $0x806205,%rdx
+  8001a0:	00 00 00 
+  8001a3:	48 89 d6             	mov    %rdx,%rsi
+  8001a6:	48 89 c7             	mov    %rax,%rdi
+  8001a9:	48 b8 44 1a 80 00 00 	movabs $0x801a44,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+  for (i = 0; i < argc; i++) {
+  8001b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8001bc:	eb 7d                	jmp    80023b <umain+0x1bf>
+    strcat(args, " '");
+  8001be:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001c5:	48 ba 11 62 80 00 00 	movabs $0x806211,%rdx
+  8001cc:	00 00 00 
+  8001cf:	48 89 d6             	mov    %rdx,%rsi
+  8001d2:	48 89 c7             	mov    %rax,%rdi
+  8001d5:	48 b8 44 1a 80 00 00 	movabs $0x801a44,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+    strcat(args, argv[i]);
+  8001e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e4:	48 98                	cltq
+  8001e6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8001ed:	00 
+  8001ee:	48 8b 85 e0 fe ff ff 	mov    -0x120(%rbp),%rax
+  8001f5:	48 01 d0             	add    %rdx,%rax
+  8001f8:	48 8b 10             	mov    (%rax),%rdx
+  8001fb:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800202:	48 89 d6             	mov    %rdx,%rsi
+  800205:	48 89 c7             	mov    %rax,%rdi
+  800208:	48 b8 44 1a 80 00 00 	movabs $0x801a44,%rax
+  80020f:	00 00 00 
+  800212:	ff d0                	call   *%rax
+    strcat(args, "'");
+  800214:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80021b:	48 ba 14 62 80 00 00 	movabs $0x806214,%rdx
+  800222:	00 00 00 
+  800225:	48 89 d6             	mov    %rdx,%rsi
+  800228:	48 89 c7             	mov    %rax,%rdi
+  80022b:	48 b8 44 1a 80 00 00 	movabs $0x801a44,%rax
+  800232:	00 00 00 
+  800235:	ff d0                	call   *%rax
+  for (i = 0; i < argc; i++) {
+  800237:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80023b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80023e:	3b 85 ec fe ff ff    	cmp    -0x114(%rbp),%eax
+  800244:	0f 8c 74 ff ff ff    	jl     8001be <umain+0x142>
+  }
+  cprintf("%s\n", args);
+  80024a:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800251:	48 89 c6             	mov    %rax,%rsi
+  800254:	48 b8 16 62 80 00 00 	movabs $0x806216,%rax
+  80025b:	00 00 00 
+  80025e:	48 89 c7             	mov    %rax,%rdi
+  800261:	b8 00 00 00 00       	mov    $0x0,%eax
+  800266:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  80026d:	00 00 00 
+  800270:	ff d2                	call   *%rdx
+
+  cprintf("init: running sh\n");
+  800272:	48 b8 1a 62 80 00 00 	movabs $0x80621a,%rax
+  800279:	00 00 00 
+  80027c:	48 89 c7             	mov    %rax,%rdi
+  80027f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800284:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  80028b:	00 00 00 
+  80028e:	ff d2                	call   *%rdx
+
+  // being run directly from kernel, so no file descriptors open yet
+  close(0);
+  800290:	bf 00 00 00 00       	mov    $0x0,%edi
+  800295:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+  if ((r = opencons()) < 0)
+  8002a1:	48 b8 d1 04 80 00 00 	movabs $0x8004d1,%rax
+  8002a8:	00 00 00 
+  8002ab:	ff d0                	call   *%rax
+  8002ad:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8002b0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8002b4:	79 36                	jns    8002ec <umain+0x270>
+    panic("opencons: %i", r);
+  8002b6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8002b9:	89 c1                	mov    %eax,%ecx
+  8002bb:	48 b8 2c 62 80 00 00 	movabs $0x80622c,%rax
+  8002c2:	00 00 00 
+  8002c5:	48 89 c2             	mov    %rax,%rdx
+  8002c8:	be 34 00 00 00       	mov    $0x34,%esi
+  8002cd:	48 b8 39 62 80 00 00 	movabs $0x806239,%rax
+  8002d4:	00 00 00 
+  8002d7:	48 89 c7             	mov    %rax,%rdi
+  8002da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002df:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  8002e6:	00 00 00 
+  8002e9:	41 ff d0             	call   *%r8
+  if (r != 0)
+  8002ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8002f0:	74 36                	je     800328 <umain+0x2ac>
+    panic("first opencons used fd %d", r);
+  8002f2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8002f5:	89 c1                	mov    %eax,%ecx
+  8002f7:	48 b8 45 62 80 00 00 	movabs $0x806245,%rax
+  8002fe:	00 00 00 
+  800301:	48 89 c2             	mov    %rax,%rdx
+  800304:	be 36 00 00 00       	mov    $0x36,%esi
+  800309:	48 b8 39 62 80 00 00 	movabs $0x806239,%rax
+  800310:	00 00 00 
+  800313:	48 89 c7             	mov    %rax,%rdi
+  800316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031b:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  800322:	00 00 00 
+  800325:	41 ff d0             	call   *%r8
+  if ((r = dup(0, 1)) < 0)
+  800328:	be 01 00 00 00       	mov    $0x1,%esi
+  80032d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800332:	48 b8 d6 32 80 00 00 	movabs $0x8032d6,%rax
+  800339:	00 00 00 
+  80033c:	ff d0                	call   *%rax
+  80033e:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  800341:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800345:	79 36                	jns    80037d <umain+0x301>
+    panic("dup: %i", r);
+  800347:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80034a:	89 c1                	mov    %eax,%ecx
+  80034c:	48 b8 5f 62 80 00 00 	movabs $0x80625f,%rax
+  800353:	00 00 00 
+  800356:	48 89 c2             	mov    %rax,%rdx
+  800359:	be 38 00 00 00       	mov    $0x38,%esi
+  80035e:	48 b8 39 62 80 00 00 	movabs $0x806239,%rax
+  800365:	00 00 00 
+  800368:	48 89 c7             	mov    %rax,%rdi
+  80036b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800370:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  800377:	00 00 00 
+  80037a:	41 ff d0             	call   *%r8
+  while (1) {
+    cprintf("init: starting sh\n");
+  80037d:	48 b8 67 62 80 00 00 	movabs $0x806267,%rax
+  800384:	00 00 00 
+  800387:	48 89 c7             	mov    %rax,%rdi
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  800396:	00 00 00 
+  800399:	ff d2                	call   *%rdx
+    r = spawnl("/sh", "sh", (char *)0);
+  80039b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a0:	48 b8 7a 62 80 00 00 	movabs $0x80627a,%rax
+  8003a7:	00 00 00 
+  8003aa:	48 89 c6             	mov    %rax,%rsi
+  8003ad:	48 b8 7d 62 80 00 00 	movabs $0x80627d,%rax
+  8003b4:	00 00 00 
+  8003b7:	48 89 c7             	mov    %rax,%rdi
+  8003ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bf:	48 b9 63 48 80 00 00 	movabs $0x804863,%rcx
+  8003c6:	00 00 00 
+  8003c9:	ff d1                	call   *%rcx
+  8003cb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (r < 0) {
+  8003ce:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8003d2:	79 25                	jns    8003f9 <umain+0x37d>
+      cprintf("init: spawn sh: %i\n", r);
+  8003d4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8003d7:	89 c6                	mov    %eax,%esi
+  8003d9:	48 b8 81 62 80 00 00 	movabs $0x806281,%rax
+  8003e0:	00 00 00 
+  8003e3:	48 89 c7             	mov    %rax,%rdi
+  8003e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003eb:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  8003f2:	00 00 00 
+  8003f5:	ff d2                	call   *%rdx
+      continue;
+  8003f7:	eb 11                	jmp    80040a <umain+0x38e>
+    }
+    wait(r);
+  8003f9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8003fc:	89 c7                	mov    %eax,%edi
+  8003fe:	48 b8 6a 5c 80 00 00 	movabs $0x805c6a,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+    cprintf("init: starting sh\n");
+  80040a:	e9 6e ff ff ff       	jmp    80037d <umain+0x301>
+
+000000000080040f <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80040f:	55                   	push   %rbp
+  800410:	48 89 e5             	mov    %rsp,%rbp
+  800413:	48 83 ec 20          	sub    $0x20,%rsp
+  800417:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80041a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80041d:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  800420:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  800424:	be 01 00 00 00       	mov    $0x1,%esi
+  800429:	48 89 c7             	mov    %rax,%rdi
+  80042c:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+}
+  800438:	90                   	nop
+  800439:	c9                   	leave
+  80043a:	c3                   	ret
+
+000000000080043b <getchar>:
+
+int
+getchar(void) {
+  80043b:	55                   	push   %rbp
+  80043c:	48 89 e5             	mov    %rsp,%rbp
+  80043f:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  800443:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  800447:	ba 01 00 00 00       	mov    $0x1,%edx
+  80044c:	48 89 c6             	mov    %rax,%rsi
+  80044f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800454:	48 b8 42 35 80 00 00 	movabs $0x803542,%rax
+  80045b:	00 00 00 
+  80045e:	ff d0                	call   *%rax
+  800460:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  800463:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800467:	79 05                	jns    80046e <getchar+0x33>
+    return r;
+  800469:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046c:	eb 14                	jmp    800482 <getchar+0x47>
+  if (r < 1)
+  80046e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800472:	7f 07                	jg     80047b <getchar+0x40>
+    return -E_EOF;
+  800474:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800479:	eb 07                	jmp    800482 <getchar+0x47>
+  return c;
+  80047b:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80047f:	0f b6 c0             	movzbl %al,%eax
+}
+  800482:	c9                   	leave
+  800483:	c3                   	ret
+
+0000000000800484 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  800484:	55                   	push   %rbp
+  800485:	48 89 e5             	mov    %rsp,%rbp
+  800488:	48 83 ec 20          	sub    $0x20,%rsp
+  80048c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80048f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800493:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800496:	48 89 d6             	mov    %rdx,%rsi
+  800499:	89 c7                	mov    %eax,%edi
+  80049b:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8004a2:	00 00 00 
+  8004a5:	ff d0                	call   *%rax
+  8004a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8004aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8004ae:	79 05                	jns    8004b5 <iscons+0x31>
+    return r;
+  8004b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004b3:	eb 1a                	jmp    8004cf <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8004b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004b9:	8b 10                	mov    (%rax),%edx
+  8004bb:	48 b8 80 87 80 00 00 	movabs $0x808780,%rax
+  8004c2:	00 00 00 
+  8004c5:	8b 00                	mov    (%rax),%eax
+  8004c7:	39 c2                	cmp    %eax,%edx
+  8004c9:	0f 94 c0             	sete   %al
+  8004cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8004cf:	c9                   	leave
+  8004d0:	c3                   	ret
+
+00000000008004d1 <opencons>:
+
+int
+opencons(void) {
+  8004d1:	55                   	push   %rbp
+  8004d2:	48 89 e5             	mov    %rsp,%rbp
+  8004d5:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8004d9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8004dd:	48 89 c7             	mov    %rax,%rdi
+  8004e0:	48 b8 04 2f 80 00 00 	movabs $0x802f04,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+  8004ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8004ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8004f3:	79 05                	jns    8004fa <opencons+0x29>
+    return r;
+  8004f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004f8:	eb 66                	jmp    800560 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8004fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004fe:	ba 07 04 00 00       	mov    $0x407,%edx
+  800503:	48 89 c6             	mov    %rax,%rsi
+  800506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80050b:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  800512:	00 00 00 
+  800515:	ff d0                	call   *%rax
+  800517:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80051a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80051e:	79 05                	jns    800525 <opencons+0x54>
+    return r;
+  800520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800523:	eb 3b                	jmp    800560 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  800525:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800529:	48 ba 80 87 80 00 00 	movabs $0x808780,%rdx
+  800530:	00 00 00 
+  800533:	8b 12                	mov    (%rdx),%edx
+  800535:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  800537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80053b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  800542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800546:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80054d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800551:	48 89 c7             	mov    %rax,%rdi
+  800554:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+}
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+
+0000000000800562 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+  800566:	48 83 ec 20          	sub    $0x20,%rsp
+  80056a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80056d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800570:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800574:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800577:	48 89 d6             	mov    %rdx,%rsi
+  80057a:	89 c7                	mov    %eax,%edi
+  80057c:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  800583:	00 00 00 
+  800586:	ff d0                	call   *%rax
+  800588:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80058b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80058f:	79 05                	jns    800596 <consmode+0x34>
+    return r;
+  800591:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800594:	eb 34                	jmp    8005ca <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  800596:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80059a:	8b 10                	mov    (%rax),%edx
+  80059c:	48 b8 80 87 80 00 00 	movabs $0x808780,%rax
+  8005a3:	00 00 00 
+  8005a6:	8b 00                	mov    (%rax),%eax
+  8005a8:	39 c2                	cmp    %eax,%edx
+  8005aa:	74 07                	je     8005b3 <consmode+0x51>
+    return -E_INVAL;
+  8005ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005b1:	eb 17                	jmp    8005ca <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8005b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005b7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8005ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8005bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005c1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8005c4:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8005c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8005ca:	c9                   	leave
+  8005cb:	c3                   	ret
+
+00000000008005cc <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005cc:	55                   	push   %rbp
+  8005cd:	48 89 e5             	mov    %rsp,%rbp
+  8005d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8005d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8005e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e4:	8b 50 0c             	mov    0xc(%rax),%edx
+  8005e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005ef:	48 89 ce             	mov    %rcx,%rsi
+  8005f2:	48 89 c7             	mov    %rax,%rdi
+  8005f5:	48 b8 29 2b 80 00 00 	movabs $0x802b29,%rax
+  8005fc:	00 00 00 
+  8005ff:	ff d0                	call   *%rax
+  800601:	48 98                	cltq
+}
+  800603:	c9                   	leave
+  800604:	c3                   	ret
+
+0000000000800605 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800605:	55                   	push   %rbp
+  800606:	48 89 e5             	mov    %rsp,%rbp
+  800609:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800610:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  800617:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  80061e:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  800625:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80062c:	eb 74                	jmp    8006a2 <devcons_write+0x9d>
+    m = n - tot;
+  80062e:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800635:	89 c2                	mov    %eax,%edx
+  800637:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80063a:	29 c2                	sub    %eax,%edx
+  80063c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  80063f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800642:	83 f8 7f             	cmp    $0x7f,%eax
+  800645:	76 07                	jbe    80064e <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  800647:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80064e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800651:	48 63 d0             	movslq %eax,%rdx
+  800654:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800657:	48 63 c8             	movslq %eax,%rcx
+  80065a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  800661:	48 01 c1             	add    %rax,%rcx
+  800664:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80066b:	48 89 ce             	mov    %rcx,%rsi
+  80066e:	48 89 c7             	mov    %rax,%rdi
+  800671:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  800678:	00 00 00 
+  80067b:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80067d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800680:	48 63 d0             	movslq %eax,%rdx
+  800683:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80068a:	48 89 d6             	mov    %rdx,%rsi
+  80068d:	48 89 c7             	mov    %rax,%rdi
+  800690:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  800697:	00 00 00 
+  80069a:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80069c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80069f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8006a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8006a5:	48 98                	cltq
+  8006a7:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8006ae:	0f 82 7a ff ff ff    	jb     80062e <devcons_write+0x29>
+  }
+  return tot;
+  8006b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8006b7:	48 98                	cltq
+}
+  8006b9:	c9                   	leave
+  8006ba:	c3                   	ret
+
+00000000008006bb <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8006bb:	55                   	push   %rbp
+  8006bc:	48 89 e5             	mov    %rsp,%rbp
+  8006bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8006c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006cc:	c9                   	leave
+  8006cd:	c3                   	ret
+
+00000000008006ce <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8006ce:	55                   	push   %rbp
+  8006cf:	48 89 e5             	mov    %rsp,%rbp
+  8006d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8006d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8006de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006e2:	48 ba 9a 62 80 00 00 	movabs $0x80629a,%rdx
+  8006e9:	00 00 00 
+  8006ec:	48 89 d6             	mov    %rdx,%rsi
+  8006ef:	48 89 c7             	mov    %rax,%rdi
+  8006f2:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8006f9:	00 00 00 
+  8006fc:	ff d0                	call   *%rax
+  return 0;
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800703:	c9                   	leave
+  800704:	c3                   	ret
+
+0000000000800705 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	48 83 ec 30          	sub    $0x30,%rsp
+  80070d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800711:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800714:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  800718:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  80071f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800722:	83 e0 02             	and    $0x2,%eax
+  800725:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  800728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80072f:	83 f8 01             	cmp    $0x1,%eax
+  800732:	75 04                	jne    800738 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  800734:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  800738:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80073b:	83 e0 01             	and    $0x1,%eax
+  80073e:	85 c0                	test   %eax,%eax
+  800740:	74 44                	je     800786 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  800742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800745:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074a:	89 c2                	mov    %eax,%edx
+  80074c:	be 00 00 00 00       	mov    $0x0,%esi
+  800751:	bf 00 00 00 00       	mov    $0x0,%edi
+  800756:	48 b8 17 2c 80 00 00 	movabs $0x802c17,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	83 f8 01             	cmp    $0x1,%eax
+  800765:	75 06                	jne    80076d <devcons_poll+0x68>
+      revents |= POLLIN;
+  800767:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80076b:	eb 19                	jmp    800786 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80076d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800771:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  800777:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80077a:	89 c2                	mov    %eax,%edx
+  80077c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800780:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  800786:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800789:	c9                   	leave
+  80078a:	c3                   	ret
+
+000000000080078b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80078b:	55                   	push   %rbp
+  80078c:	48 89 e5             	mov    %rsp,%rbp
+  80078f:	48 83 ec 20          	sub    $0x20,%rsp
+  800793:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800796:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80079a:	48 b8 80 88 80 00 00 	movabs $0x808880,%rax
+  8007a1:	00 00 00 
+  8007a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8007a8:	eb 13                	jmp    8007bd <libmain+0x32>
+    (*ctor)();
+  8007aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ae:	48 8b 10             	mov    (%rax),%rdx
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b6:	ff d2                	call   *%rdx
+    ctor++;
+  8007b8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8007bd:	48 b8 80 88 80 00 00 	movabs $0x808880,%rax
+  8007c4:	00 00 00 
+  8007c7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8007cb:	72 dd                	jb     8007aa <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8007cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8007d1:	7e 14                	jle    8007e7 <libmain+0x5c>
+    binaryname = argv[0];
+  8007d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007d7:	48 8b 00             	mov    (%rax),%rax
+  8007da:	48 ba c0 87 80 00 00 	movabs $0x8087c0,%rdx
+  8007e1:	00 00 00 
+  8007e4:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8007e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8007ee:	48 89 d6             	mov    %rdx,%rsi
+  8007f1:	89 c7                	mov    %eax,%edi
+  8007f3:	48 b8 7c 00 80 00 00 	movabs $0x80007c,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8007ff:	48 b8 0e 08 80 00 00 	movabs $0x80080e,%rax
+  800806:	00 00 00 
+  800809:	ff d0                	call   *%rax
+#endif
+}
+  80080b:	90                   	nop
+  80080c:	c9                   	leave
+  80080d:	c3                   	ret
+
+000000000080080e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80080e:	55                   	push   %rbp
+  80080f:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800812:	48 b8 a6 32 80 00 00 	movabs $0x8032a6,%rax
+  800819:	00 00 00 
+  80081c:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80081e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800823:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  80082a:	00 00 00 
+  80082d:	ff d0                	call   *%rax
+}
+  80082f:	90                   	nop
+  800830:	5d                   	pop    %rbp
+  800831:	c3                   	ret
+
+0000000000800832 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800832:	55                   	push   %rbp
+  800833:	48 89 e5             	mov    %rsp,%rbp
+  800836:	53                   	push   %rbx
+  800837:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80083e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800845:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80084b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800852:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800859:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800860:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800867:	84 c0                	test   %al,%al
+  800869:	74 23                	je     80088e <_panic+0x5c>
+  80086b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800872:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800876:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80087a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80087e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800882:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800886:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80088a:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80088e:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800895:	00 00 00 
+  800898:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80089f:	00 00 00 
+  8008a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008a6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8008ad:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8008b4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8008bb:	48 b8 c0 87 80 00 00 	movabs $0x8087c0,%rax
+  8008c2:	00 00 00 
+  8008c5:	48 8b 18             	mov    (%rax),%rbx
+  8008c8:	48 b8 56 27 80 00 00 	movabs $0x802756,%rax
+  8008cf:	00 00 00 
+  8008d2:	ff d0                	call   *%rax
+  8008d4:	89 c6                	mov    %eax,%esi
+  8008d6:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8008dc:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8008e3:	41 89 d0             	mov    %edx,%r8d
+  8008e6:	48 89 c1             	mov    %rax,%rcx
+  8008e9:	48 89 da             	mov    %rbx,%rdx
+  8008ec:	48 b8 b0 62 80 00 00 	movabs $0x8062b0,%rax
+  8008f3:	00 00 00 
+  8008f6:	48 89 c7             	mov    %rax,%rdi
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	49 b9 51 0a 80 00 00 	movabs $0x800a51,%r9
+  800905:	00 00 00 
+  800908:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80090b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800912:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800919:	48 89 d6             	mov    %rdx,%rsi
+  80091c:	48 89 c7             	mov    %rax,%rdi
+  80091f:	48 b8 c6 09 80 00 00 	movabs $0x8009c6,%rax
+  800926:	00 00 00 
+  800929:	ff d0                	call   *%rax
+  cprintf("\n");
+  80092b:	48 b8 d3 62 80 00 00 	movabs $0x8062d3,%rax
+  800932:	00 00 00 
+  800935:	48 89 c7             	mov    %rax,%rdi
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	48 ba 51 0a 80 00 00 	movabs $0x800a51,%rdx
+  800944:	00 00 00 
+  800947:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800949:	cc                   	int3
+  80094a:	eb fd                	jmp    800949 <_panic+0x117>
+
+000000000080094c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80094c:	55                   	push   %rbp
+  80094d:	48 89 e5             	mov    %rsp,%rbp
+  800950:	48 83 ec 10          	sub    $0x10,%rsp
+  800954:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800957:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80095b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80095f:	8b 00                	mov    (%rax),%eax
+  800961:	8d 48 01             	lea    0x1(%rax),%ecx
+  800964:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800968:	89 0a                	mov    %ecx,(%rdx)
+  80096a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80096d:	89 d1                	mov    %edx,%ecx
+  80096f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800973:	48 98                	cltq
+  800975:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800979:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80097d:	8b 00                	mov    (%rax),%eax
+  80097f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800984:	75 2c                	jne    8009b2 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800986:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80098a:	8b 00                	mov    (%rax),%eax
+  80098c:	48 98                	cltq
+  80098e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800992:	48 83 c2 08          	add    $0x8,%rdx
+  800996:	48 89 c6             	mov    %rax,%rsi
+  800999:	48 89 d7             	mov    %rdx,%rdi
+  80099c:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  8009a3:	00 00 00 
+  8009a6:	ff d0                	call   *%rax
+    b->idx = 0;
+  8009a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009ac:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8009b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009b6:	8b 40 04             	mov    0x4(%rax),%eax
+  8009b9:	8d 50 01             	lea    0x1(%rax),%edx
+  8009bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009c0:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8009c3:	90                   	nop
+  8009c4:	c9                   	leave
+  8009c5:	c3                   	ret
+
+00000000008009c6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8009c6:	55                   	push   %rbp
+  8009c7:	48 89 e5             	mov    %rsp,%rbp
+  8009ca:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8009d1:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8009d8:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8009df:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8009e6:	00 00 00 
+  b.cnt = 0;
+  8009e9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8009f0:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8009f3:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8009fa:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800a01:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800a08:	48 89 c6             	mov    %rax,%rsi
+  800a0b:	48 b8 4c 09 80 00 00 	movabs $0x80094c,%rax
+  800a12:	00 00 00 
+  800a15:	48 89 c7             	mov    %rax,%rdi
+  800a18:	48 b8 ab 0d 80 00 00 	movabs $0x800dab,%rax
+  800a1f:	00 00 00 
+  800a22:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800a24:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800a2a:	48 98                	cltq
+  800a2c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800a33:	48 83 c2 08          	add    $0x8,%rdx
+  800a37:	48 89 c6             	mov    %rax,%rsi
+  800a3a:	48 89 d7             	mov    %rdx,%rdi
+  800a3d:	48 b8 b8 25 80 00 00 	movabs $0x8025b8,%rax
+  800a44:	00 00 00 
+  800a47:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800a49:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+0000000000800a51 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800a51:	55                   	push   %rbp
+  800a52:	48 89 e5             	mov    %rsp,%rbp
+  800a55:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800a5c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a63:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800a6a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800a71:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a78:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a7f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a86:	84 c0                	test   %al,%al
+  800a88:	74 20                	je     800aaa <cprintf+0x59>
+  800a8a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a8e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a92:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a96:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a9a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a9e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800aa2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800aa6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800aaa:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800ab1:	00 00 00 
+  800ab4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800abb:	00 00 00 
+  800abe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ac2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800ac9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ad0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800ad7:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800ade:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ae5:	48 89 d6             	mov    %rdx,%rsi
+  800ae8:	48 89 c7             	mov    %rax,%rdi
+  800aeb:	48 b8 c6 09 80 00 00 	movabs $0x8009c6,%rax
+  800af2:	00 00 00 
+  800af5:	ff d0                	call   *%rax
+  800af7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800afd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+0000000000800b05 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800b05:	55                   	push   %rbp
+  800b06:	48 89 e5             	mov    %rsp,%rbp
+  800b09:	48 83 ec 30          	sub    $0x30,%rsp
+  800b0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b15:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800b19:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800b1c:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800b20:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800b24:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800b27:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800b2b:	72 54                	jb     800b81 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b2d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800b30:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800b33:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800b36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3f:	48 f7 f6             	div    %rsi
+  800b42:	49 89 c2             	mov    %rax,%r10
+  800b45:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800b48:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800b4b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800b4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b53:	41 89 c9             	mov    %ecx,%r9d
+  800b56:	41 89 f8             	mov    %edi,%r8d
+  800b59:	89 d1                	mov    %edx,%ecx
+  800b5b:	4c 89 d2             	mov    %r10,%rdx
+  800b5e:	48 89 c7             	mov    %rax,%rdi
+  800b61:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  800b68:	00 00 00 
+  800b6b:	ff d0                	call   *%rax
+  800b6d:	eb 1c                	jmp    800b8b <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800b6f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b73:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800b76:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800b7a:	48 89 d6             	mov    %rdx,%rsi
+  800b7d:	89 c7                	mov    %eax,%edi
+  800b7f:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800b81:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800b85:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800b89:	7f e4                	jg     800b6f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800b8b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b97:	48 f7 f1             	div    %rcx
+  800b9a:	48 b8 10 65 80 00 00 	movabs $0x806510,%rax
+  800ba1:	00 00 00 
+  800ba4:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800ba8:	0f be c0             	movsbl %al,%eax
+  800bab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800baf:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800bb3:	48 89 d6             	mov    %rdx,%rsi
+  800bb6:	89 c7                	mov    %eax,%edi
+  800bb8:	ff d1                	call   *%rcx
+}
+  800bba:	90                   	nop
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+
+0000000000800bbd <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800bbd:	55                   	push   %rbp
+  800bbe:	48 89 e5             	mov    %rsp,%rbp
+  800bc1:	48 83 ec 10          	sub    $0x10,%rsp
+  800bc5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800bc9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800bcc:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800bd0:	7e 4b                	jle    800c1d <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bd6:	8b 00                	mov    (%rax),%eax
+  800bd8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdb:	77 24                	ja     800c01 <getuint+0x44>
+  800bdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800be1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800be5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800be9:	8b 00                	mov    (%rax),%eax
+  800beb:	89 c0                	mov    %eax,%eax
+  800bed:	48 01 d0             	add    %rdx,%rax
+  800bf0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bf4:	8b 12                	mov    (%rdx),%edx
+  800bf6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bf9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bfd:	89 0a                	mov    %ecx,(%rdx)
+  800bff:	eb 14                	jmp    800c15 <getuint+0x58>
+  800c01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c05:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c09:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c11:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c15:	48 8b 00             	mov    (%rax),%rax
+  800c18:	e9 95 00 00 00       	jmp    800cb2 <getuint+0xf5>
+  else if (lflag)
+  800c1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800c21:	74 48                	je     800c6b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800c23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c27:	8b 00                	mov    (%rax),%eax
+  800c29:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2c:	77 24                	ja     800c52 <getuint+0x95>
+  800c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c32:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c3a:	8b 00                	mov    (%rax),%eax
+  800c3c:	89 c0                	mov    %eax,%eax
+  800c3e:	48 01 d0             	add    %rdx,%rax
+  800c41:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c45:	8b 12                	mov    (%rdx),%edx
+  800c47:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c4a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c4e:	89 0a                	mov    %ecx,(%rdx)
+  800c50:	eb 14                	jmp    800c66 <getuint+0xa9>
+  800c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c5a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c5e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c62:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c66:	48 8b 00             	mov    (%rax),%rax
+  800c69:	eb 47                	jmp    800cb2 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800c6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c6f:	8b 00                	mov    (%rax),%eax
+  800c71:	83 f8 2f             	cmp    $0x2f,%eax
+  800c74:	77 24                	ja     800c9a <getuint+0xdd>
+  800c76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c7a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c82:	8b 00                	mov    (%rax),%eax
+  800c84:	89 c0                	mov    %eax,%eax
+  800c86:	48 01 d0             	add    %rdx,%rax
+  800c89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c8d:	8b 12                	mov    (%rdx),%edx
+  800c8f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c92:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c96:	89 0a                	mov    %ecx,(%rdx)
+  800c98:	eb 14                	jmp    800cae <getuint+0xf1>
+  800c9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c9e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ca2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ca6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800caa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cae:	8b 00                	mov    (%rax),%eax
+  800cb0:	89 c0                	mov    %eax,%eax
+}
+  800cb2:	c9                   	leave
+  800cb3:	c3                   	ret
+
+0000000000800cb4 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800cb4:	55                   	push   %rbp
+  800cb5:	48 89 e5             	mov    %rsp,%rbp
+  800cb8:	48 83 ec 10          	sub    $0x10,%rsp
+  800cbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800cc0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800cc3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800cc7:	7e 4b                	jle    800d14 <getint+0x60>
+    return va_arg(*ap, long long);
+  800cc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ccd:	8b 00                	mov    (%rax),%eax
+  800ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd2:	77 24                	ja     800cf8 <getint+0x44>
+  800cd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cd8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800cdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ce0:	8b 00                	mov    (%rax),%eax
+  800ce2:	89 c0                	mov    %eax,%eax
+  800ce4:	48 01 d0             	add    %rdx,%rax
+  800ce7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ceb:	8b 12                	mov    (%rdx),%edx
+  800ced:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cf0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cf4:	89 0a                	mov    %ecx,(%rdx)
+  800cf6:	eb 14                	jmp    800d0c <getint+0x58>
+  800cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800cfc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d00:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d08:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d0c:	48 8b 00             	mov    (%rax),%rax
+  800d0f:	e9 95 00 00 00       	jmp    800da9 <getint+0xf5>
+  else if (lflag)
+  800d14:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800d18:	74 48                	je     800d62 <getint+0xae>
+    return va_arg(*ap, long);
+  800d1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d1e:	8b 00                	mov    (%rax),%eax
+  800d20:	83 f8 2f             	cmp    $0x2f,%eax
+  800d23:	77 24                	ja     800d49 <getint+0x95>
+  800d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d29:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d31:	8b 00                	mov    (%rax),%eax
+  800d33:	89 c0                	mov    %eax,%eax
+  800d35:	48 01 d0             	add    %rdx,%rax
+  800d38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d3c:	8b 12                	mov    (%rdx),%edx
+  800d3e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d41:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d45:	89 0a                	mov    %ecx,(%rdx)
+  800d47:	eb 14                	jmp    800d5d <getint+0xa9>
+  800d49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d51:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d59:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d5d:	48 8b 00             	mov    (%rax),%rax
+  800d60:	eb 47                	jmp    800da9 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800d62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d66:	8b 00                	mov    (%rax),%eax
+  800d68:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6b:	77 24                	ja     800d91 <getint+0xdd>
+  800d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d71:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d79:	8b 00                	mov    (%rax),%eax
+  800d7b:	89 c0                	mov    %eax,%eax
+  800d7d:	48 01 d0             	add    %rdx,%rax
+  800d80:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d84:	8b 12                	mov    (%rdx),%edx
+  800d86:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d8d:	89 0a                	mov    %ecx,(%rdx)
+  800d8f:	eb 14                	jmp    800da5 <getint+0xf1>
+  800d91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d99:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d9d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800da1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800da5:	8b 00                	mov    (%rax),%eax
+  800da7:	48 98                	cltq
+}
+  800da9:	c9                   	leave
+  800daa:	c3                   	ret
+
+0000000000800dab <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800dab:	55                   	push   %rbp
+  800dac:	48 89 e5             	mov    %rsp,%rbp
+  800daf:	41 54                	push   %r12
+  800db1:	53                   	push   %rbx
+  800db2:	48 83 ec 60          	sub    $0x60,%rsp
+  800db6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800dba:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800dbe:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800dc2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800dc6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dca:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800dce:	48 8b 06             	mov    (%rsi),%rax
+  800dd1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dd5:	48 89 01             	mov    %rax,(%rcx)
+  800dd8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ddc:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800de0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800de4:	eb 17                	jmp    800dfd <vprintfmt+0x52>
+      if (ch == '\0')
+  800de6:	85 db                	test   %ebx,%ebx
+  800de8:	0f 84 bf 04 00 00    	je     8012ad <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800dee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800df2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800df6:	48 89 c6             	mov    %rax,%rsi
+  800df9:	89 df                	mov    %ebx,%edi
+  800dfb:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800dfd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e01:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e05:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800e09:	0f b6 00             	movzbl (%rax),%eax
+  800e0c:	0f b6 d8             	movzbl %al,%ebx
+  800e0f:	83 fb 25             	cmp    $0x25,%ebx
+  800e12:	75 d2                	jne    800de6 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800e14:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800e18:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800e1f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800e26:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800e2d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800e34:	eb 04                	jmp    800e3a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800e36:	90                   	nop
+  800e37:	eb 01                	jmp    800e3a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800e39:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800e3a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e3e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e42:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800e46:	0f b6 00             	movzbl (%rax),%eax
+  800e49:	0f b6 d8             	movzbl %al,%ebx
+  800e4c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800e4f:	83 f8 55             	cmp    $0x55,%eax
+  800e52:	0f 87 22 04 00 00    	ja     80127a <vprintfmt+0x4cf>
+  800e58:	89 c0                	mov    %eax,%eax
+  800e5a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800e61:	00 
+  800e62:	48 b8 38 65 80 00 00 	movabs $0x806538,%rax
+  800e69:	00 00 00 
+  800e6c:	48 01 d0             	add    %rdx,%rax
+  800e6f:	48 8b 00             	mov    (%rax),%rax
+  800e72:	ff e0                	jmp    *%rax
+        padc = '-';
+  800e74:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800e78:	eb c0                	jmp    800e3a <vprintfmt+0x8f>
+        padc = '0';
+  800e7a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800e7e:	eb ba                	jmp    800e3a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800e80:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800e87:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800e8a:	89 d0                	mov    %edx,%eax
+  800e8c:	c1 e0 02             	shl    $0x2,%eax
+  800e8f:	01 d0                	add    %edx,%eax
+  800e91:	01 c0                	add    %eax,%eax
+  800e93:	01 d8                	add    %ebx,%eax
+  800e95:	83 e8 30             	sub    $0x30,%eax
+  800e98:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800e9b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e9f:	0f b6 00             	movzbl (%rax),%eax
+  800ea2:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800ea5:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ea8:	7e 60                	jle    800f0a <vprintfmt+0x15f>
+  800eaa:	83 fb 39             	cmp    $0x39,%ebx
+  800ead:	7f 5b                	jg     800f0a <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800eaf:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800eb4:	eb d1                	jmp    800e87 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800eb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eb9:	83 f8 2f             	cmp    $0x2f,%eax
+  800ebc:	77 17                	ja     800ed5 <vprintfmt+0x12a>
+  800ebe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ec2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ec5:	89 d2                	mov    %edx,%edx
+  800ec7:	48 01 d0             	add    %rdx,%rax
+  800eca:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ecd:	83 c2 08             	add    $0x8,%edx
+  800ed0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ed3:	eb 0c                	jmp    800ee1 <vprintfmt+0x136>
+  800ed5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ed9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800edd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ee1:	8b 00                	mov    (%rax),%eax
+  800ee3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800ee6:	eb 23                	jmp    800f0b <vprintfmt+0x160>
+        if (width < 0)
+  800ee8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800eec:	0f 89 44 ff ff ff    	jns    800e36 <vprintfmt+0x8b>
+          width = 0;
+  800ef2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800ef9:	e9 38 ff ff ff       	jmp    800e36 <vprintfmt+0x8b>
+        altflag = 1;
+  800efe:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800f05:	e9 30 ff ff ff       	jmp    800e3a <vprintfmt+0x8f>
+        goto process_precision;
+  800f0a:	90                   	nop
+        if (width < 0)
+  800f0b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800f0f:	0f 89 24 ff ff ff    	jns    800e39 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800f15:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800f18:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800f1b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800f22:	e9 12 ff ff ff       	jmp    800e39 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800f27:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800f2b:	e9 0a ff ff ff       	jmp    800e3a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800f30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f33:	83 f8 2f             	cmp    $0x2f,%eax
+  800f36:	77 17                	ja     800f4f <vprintfmt+0x1a4>
+  800f38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f3c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f3f:	89 d2                	mov    %edx,%edx
+  800f41:	48 01 d0             	add    %rdx,%rax
+  800f44:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f47:	83 c2 08             	add    $0x8,%edx
+  800f4a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800f4d:	eb 0c                	jmp    800f5b <vprintfmt+0x1b0>
+  800f4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f53:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f57:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f5b:	8b 00                	mov    (%rax),%eax
+  800f5d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800f61:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800f65:	48 89 d6             	mov    %rdx,%rsi
+  800f68:	89 c7                	mov    %eax,%edi
+  800f6a:	ff d1                	call   *%rcx
+        break;
+  800f6c:	e9 37 03 00 00       	jmp    8012a8 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800f71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f74:	83 f8 2f             	cmp    $0x2f,%eax
+  800f77:	77 17                	ja     800f90 <vprintfmt+0x1e5>
+  800f79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f7d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f80:	89 d2                	mov    %edx,%edx
+  800f82:	48 01 d0             	add    %rdx,%rax
+  800f85:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f88:	83 c2 08             	add    $0x8,%edx
+  800f8b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800f8e:	eb 0c                	jmp    800f9c <vprintfmt+0x1f1>
+  800f90:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f94:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f98:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f9c:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800f9e:	85 db                	test   %ebx,%ebx
+  800fa0:	79 02                	jns    800fa4 <vprintfmt+0x1f9>
+          err = -err;
+  800fa2:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800fa4:	83 fb 15             	cmp    $0x15,%ebx
+  800fa7:	7f 16                	jg     800fbf <vprintfmt+0x214>
+  800fa9:	48 ba 60 64 80 00 00 	movabs $0x806460,%rdx
+  800fb0:	00 00 00 
+  800fb3:	48 63 c3             	movslq %ebx,%rax
+  800fb6:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800fba:	4d 85 e4             	test   %r12,%r12
+  800fbd:	75 2e                	jne    800fed <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800fbf:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800fc3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fc7:	89 d9                	mov    %ebx,%ecx
+  800fc9:	48 ba 21 65 80 00 00 	movabs $0x806521,%rdx
+  800fd0:	00 00 00 
+  800fd3:	48 89 c7             	mov    %rax,%rdi
+  800fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdb:	49 b8 b7 12 80 00 00 	movabs $0x8012b7,%r8
+  800fe2:	00 00 00 
+  800fe5:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800fe8:	e9 bb 02 00 00       	jmp    8012a8 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800fed:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ff1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ff5:	4c 89 e1             	mov    %r12,%rcx
+  800ff8:	48 ba 2a 65 80 00 00 	movabs $0x80652a,%rdx
+  800fff:	00 00 00 
+  801002:	48 89 c7             	mov    %rax,%rdi
+  801005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100a:	49 b8 b7 12 80 00 00 	movabs $0x8012b7,%r8
+  801011:	00 00 00 
+  801014:	41 ff d0             	call   *%r8
+        break;
+  801017:	e9 8c 02 00 00       	jmp    8012a8 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  80101c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80101f:	83 f8 2f             	cmp    $0x2f,%eax
+  801022:	77 17                	ja     80103b <vprintfmt+0x290>
+  801024:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801028:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80102b:	89 d2                	mov    %edx,%edx
+  80102d:	48 01 d0             	add    %rdx,%rax
+  801030:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801033:	83 c2 08             	add    $0x8,%edx
+  801036:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801039:	eb 0c                	jmp    801047 <vprintfmt+0x29c>
+  80103b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80103f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801043:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801047:	4c 8b 20             	mov    (%rax),%r12
+  80104a:	4d 85 e4             	test   %r12,%r12
+  80104d:	75 0a                	jne    801059 <vprintfmt+0x2ae>
+          p = "(null)";
+  80104f:	49 bc 2d 65 80 00 00 	movabs $0x80652d,%r12
+  801056:	00 00 00 
+        if (width > 0 && padc != '-')
+  801059:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80105d:	7e 78                	jle    8010d7 <vprintfmt+0x32c>
+  80105f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801063:	74 72                	je     8010d7 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801065:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801068:	48 98                	cltq
+  80106a:	48 89 c6             	mov    %rax,%rsi
+  80106d:	4c 89 e7             	mov    %r12,%rdi
+  801070:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  801077:	00 00 00 
+  80107a:	ff d0                	call   *%rax
+  80107c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80107f:	eb 17                	jmp    801098 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  801081:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801085:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801089:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80108d:	48 89 d6             	mov    %rdx,%rsi
+  801090:	89 c7                	mov    %eax,%edi
+  801092:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801094:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801098:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80109c:	7f e3                	jg     801081 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80109e:	eb 37                	jmp    8010d7 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8010a0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8010a4:	74 1e                	je     8010c4 <vprintfmt+0x319>
+  8010a6:	83 fb 1f             	cmp    $0x1f,%ebx
+  8010a9:	7e 05                	jle    8010b0 <vprintfmt+0x305>
+  8010ab:	83 fb 7e             	cmp    $0x7e,%ebx
+  8010ae:	7e 14                	jle    8010c4 <vprintfmt+0x319>
+            putch('?', putdat);
+  8010b0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010b4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010b8:	48 89 c6             	mov    %rax,%rsi
+  8010bb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010c0:	ff d2                	call   *%rdx
+  8010c2:	eb 0f                	jmp    8010d3 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8010c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010c8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010cc:	48 89 c6             	mov    %rax,%rsi
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8010d3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8010d7:	4c 89 e0             	mov    %r12,%rax
+  8010da:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8010de:	0f b6 00             	movzbl (%rax),%eax
+  8010e1:	0f be d8             	movsbl %al,%ebx
+  8010e4:	85 db                	test   %ebx,%ebx
+  8010e6:	74 28                	je     801110 <vprintfmt+0x365>
+  8010e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8010ec:	78 b2                	js     8010a0 <vprintfmt+0x2f5>
+  8010ee:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8010f2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8010f6:	79 a8                	jns    8010a0 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8010f8:	eb 16                	jmp    801110 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8010fa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010fe:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801102:	48 89 c6             	mov    %rax,%rsi
+  801105:	bf 20 00 00 00       	mov    $0x20,%edi
+  80110a:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  80110c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801110:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801114:	7f e4                	jg     8010fa <vprintfmt+0x34f>
+        break;
+  801116:	e9 8d 01 00 00       	jmp    8012a8 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  80111b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80111e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801122:	89 d6                	mov    %edx,%esi
+  801124:	48 89 c7             	mov    %rax,%rdi
+  801127:	48 b8 b4 0c 80 00 00 	movabs $0x800cb4,%rax
+  80112e:	00 00 00 
+  801131:	ff d0                	call   *%rax
+  801133:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  801137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80113b:	48 85 c0             	test   %rax,%rax
+  80113e:	79 1d                	jns    80115d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  801140:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801144:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801148:	48 89 c6             	mov    %rax,%rsi
+  80114b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801150:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  801152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801156:	48 f7 d8             	neg    %rax
+  801159:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80115d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801164:	e9 d2 00 00 00       	jmp    80123b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  801169:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80116c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801170:	89 d6                	mov    %edx,%esi
+  801172:	48 89 c7             	mov    %rax,%rdi
+  801175:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  80117c:	00 00 00 
+  80117f:	ff d0                	call   *%rax
+  801181:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  801185:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80118c:	e9 aa 00 00 00       	jmp    80123b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  801191:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801194:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801198:	89 d6                	mov    %edx,%esi
+  80119a:	48 89 c7             	mov    %rax,%rdi
+  80119d:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+  8011a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8011ad:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8011b4:	e9 82 00 00 00       	jmp    80123b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8011b9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8011bd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011c1:	48 89 c6             	mov    %rax,%rsi
+  8011c4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8011c9:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8011cb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8011cf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011d3:	48 89 c6             	mov    %rax,%rsi
+  8011d6:	bf 78 00 00 00       	mov    $0x78,%edi
+  8011db:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8011dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8011e3:	77 17                	ja     8011fc <vprintfmt+0x451>
+  8011e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011e9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011ec:	89 d2                	mov    %edx,%edx
+  8011ee:	48 01 d0             	add    %rdx,%rax
+  8011f1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011f4:	83 c2 08             	add    $0x8,%edx
+  8011f7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8011fa:	eb 0c                	jmp    801208 <vprintfmt+0x45d>
+  8011fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801200:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801204:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801208:	48 8b 00             	mov    (%rax),%rax
+  80120b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80120f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  801216:	eb 23                	jmp    80123b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  801218:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80121b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80121f:	89 d6                	mov    %edx,%esi
+  801221:	48 89 c7             	mov    %rax,%rdi
+  801224:	48 b8 bd 0b 80 00 00 	movabs $0x800bbd,%rax
+  80122b:	00 00 00 
+  80122e:	ff d0                	call   *%rax
+  801230:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801234:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80123b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801240:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801243:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801246:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80124a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80124e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801252:	45 89 c1             	mov    %r8d,%r9d
+  801255:	41 89 f8             	mov    %edi,%r8d
+  801258:	48 89 c7             	mov    %rax,%rdi
+  80125b:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  801262:	00 00 00 
+  801265:	ff d0                	call   *%rax
+        break;
+  801267:	eb 3f                	jmp    8012a8 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801269:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80126d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801271:	48 89 c6             	mov    %rax,%rsi
+  801274:	89 df                	mov    %ebx,%edi
+  801276:	ff d2                	call   *%rdx
+        break;
+  801278:	eb 2e                	jmp    8012a8 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80127a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80127e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801282:	48 89 c6             	mov    %rax,%rsi
+  801285:	bf 25 00 00 00       	mov    $0x25,%edi
+  80128a:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  80128c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801291:	eb 05                	jmp    801298 <vprintfmt+0x4ed>
+  801293:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801298:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80129c:	48 83 e8 01          	sub    $0x1,%rax
+  8012a0:	0f b6 00             	movzbl (%rax),%eax
+  8012a3:	3c 25                	cmp    $0x25,%al
+  8012a5:	75 ec                	jne    801293 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8012a7:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8012a8:	e9 50 fb ff ff       	jmp    800dfd <vprintfmt+0x52>
+        return;
+  8012ad:	90                   	nop
+    }
+  }
+}
+  8012ae:	48 83 c4 60          	add    $0x60,%rsp
+  8012b2:	5b                   	pop    %rbx
+  8012b3:	41 5c                	pop    %r12
+  8012b5:	5d                   	pop    %rbp
+  8012b6:	c3                   	ret
+
+00000000008012b7 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8012b7:	55                   	push   %rbp
+  8012b8:	48 89 e5             	mov    %rsp,%rbp
+  8012bb:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012c2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012c9:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012d0:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8012d7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012de:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012e5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012ec:	84 c0                	test   %al,%al
+  8012ee:	74 20                	je     801310 <printfmt+0x59>
+  8012f0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012f4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012f8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012fc:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801300:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801304:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801308:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80130c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801310:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801317:	00 00 00 
+  80131a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801321:	00 00 00 
+  801324:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801328:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80132f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801336:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  80133d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801344:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80134b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801352:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801359:	48 89 c7             	mov    %rax,%rdi
+  80135c:	48 b8 ab 0d 80 00 00 	movabs $0x800dab,%rax
+  801363:	00 00 00 
+  801366:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801368:	90                   	nop
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+
+000000000080136b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  80136b:	55                   	push   %rbp
+  80136c:	48 89 e5             	mov    %rsp,%rbp
+  80136f:	48 83 ec 10          	sub    $0x10,%rsp
+  801373:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801376:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  80137a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137e:	8b 40 10             	mov    0x10(%rax),%eax
+  801381:	8d 50 01             	lea    0x1(%rax),%edx
+  801384:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801388:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  80138b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80138f:	48 8b 10             	mov    (%rax),%rdx
+  801392:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801396:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80139a:	48 39 c2             	cmp    %rax,%rdx
+  80139d:	73 17                	jae    8013b6 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  80139f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a3:	48 8b 00             	mov    (%rax),%rax
+  8013a6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013ae:	48 89 0a             	mov    %rcx,(%rdx)
+  8013b1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013b4:	88 10                	mov    %dl,(%rax)
+}
+  8013b6:	90                   	nop
+  8013b7:	c9                   	leave
+  8013b8:	c3                   	ret
+
+00000000008013b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  8013b9:	55                   	push   %rbp
+  8013ba:	48 89 e5             	mov    %rsp,%rbp
+  8013bd:	48 83 ec 40          	sub    $0x40,%rsp
+  8013c1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8013c5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8013c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8013cc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8013d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013d4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013d8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8013db:	48 98                	cltq
+  8013dd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013e5:	48 01 d0             	add    %rdx,%rax
+  8013e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8013ec:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8013f3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013f8:	74 06                	je     801400 <vsnprintf+0x47>
+  8013fa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8013fe:	7f 07                	jg     801407 <vsnprintf+0x4e>
+    return -E_INVAL;
+  801400:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801405:	eb 32                	jmp    801439 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801407:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80140b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80140f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801413:	48 89 c6             	mov    %rax,%rsi
+  801416:	48 b8 6b 13 80 00 00 	movabs $0x80136b,%rax
+  80141d:	00 00 00 
+  801420:	48 89 c7             	mov    %rax,%rdi
+  801423:	48 b8 ab 0d 80 00 00 	movabs $0x800dab,%rax
+  80142a:	00 00 00 
+  80142d:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80142f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801433:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801436:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801439:	c9                   	leave
+  80143a:	c3                   	ret
+
+000000000080143b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  80143b:	55                   	push   %rbp
+  80143c:	48 89 e5             	mov    %rsp,%rbp
+  80143f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801446:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80144d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801453:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80145a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801461:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801468:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80146f:	84 c0                	test   %al,%al
+  801471:	74 20                	je     801493 <snprintf+0x58>
+  801473:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801477:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80147b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80147f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801483:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801487:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80148b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80148f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801493:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80149a:	00 00 00 
+  80149d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8014a4:	00 00 00 
+  8014a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014ab:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8014b2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014b9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8014c0:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8014c7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8014ce:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8014d4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8014db:	48 89 c7             	mov    %rax,%rdi
+  8014de:	48 b8 b9 13 80 00 00 	movabs $0x8013b9,%rax
+  8014e5:	00 00 00 
+  8014e8:	ff d0                	call   *%rax
+  8014ea:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8014f0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+00000000008014f8 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	53                   	push   %rbx
+  8014fd:	48 83 ec 38          	sub    $0x38,%rsp
+  801501:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801504:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801508:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80150c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801510:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801514:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151c:	89 d1                	mov    %edx,%ecx
+  80151e:	0f a2                	cpuid
+  801520:	89 de                	mov    %ebx,%esi
+  801522:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801525:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801528:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80152b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  80152e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801533:	74 09                	je     80153e <cpuid+0x46>
+}
+  801535:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801539:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80153c:	89 10                	mov    %edx,(%rax)
+
+  80153e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801543:	74 09                	je     80154e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801545:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801549:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80154c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80154e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801553:	74 09                	je     80155e <cpuid+0x66>
+char *
+  801555:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801559:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80155c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80155e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801563:	74 09                	je     80156e <cpuid+0x76>
+  for (; *s; s++)
+  801565:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801569:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80156c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80156e:	90                   	nop
+  80156f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801573:	c9                   	leave
+  801574:	c3                   	ret
+
+0000000000801575 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801575:	55                   	push   %rbp
+  801576:	48 89 e5             	mov    %rsp,%rbp
+  801579:	48 83 ec 18          	sub    $0x18,%rsp
+  80157d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801580:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801583:	89 c1                	mov    %eax,%ecx
+  801585:	0f 01 d0             	xgetbv
+  801588:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80158b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80158e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801591:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801594:	48 c1 e2 20          	shl    $0x20,%rdx
+  801598:	48 09 d0             	or     %rdx,%rax
+#else
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+
+000000000080159d <string_cpu>:
+string_cpu(void) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8015a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8015ac:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8015b3:	48 b8 c8 87 80 00 00 	movabs $0x8087c8,%rax
+  8015ba:	00 00 00 
+  8015bd:	8b 00                	mov    (%rax),%eax
+  8015bf:	85 c0                	test   %eax,%eax
+  8015c1:	78 11                	js     8015d4 <string_cpu+0x37>
+    return string_features;
+  8015c3:	48 b8 c8 87 80 00 00 	movabs $0x8087c8,%rax
+  8015ca:	00 00 00 
+  8015cd:	8b 00                	mov    (%rax),%eax
+  8015cf:	e9 df 00 00 00       	jmp    8016b3 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8015d4:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8015d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e8:	48 89 c6             	mov    %rax,%rsi
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f0:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  8015f7:	00 00 00 
+  8015fa:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8015fc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8015ff:	83 f8 06             	cmp    $0x6,%eax
+  801602:	76 28                	jbe    80162c <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801604:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801608:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80160e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801613:	48 89 c2             	mov    %rax,%rdx
+  801616:	be 00 00 00 00       	mov    $0x0,%esi
+  80161b:	bf 07 00 00 00       	mov    $0x7,%edi
+  801620:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80162c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80162f:	25 00 02 00 00       	and    $0x200,%eax
+  801634:	85 c0                	test   %eax,%eax
+  801636:	74 04                	je     80163c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801638:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80163c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801646:	48 89 c1             	mov    %rax,%rcx
+  801649:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	bf 01 00 00 00       	mov    $0x1,%edi
+  801658:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  80165f:	00 00 00 
+  801662:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801664:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801667:	83 e0 20             	and    $0x20,%eax
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	74 2a                	je     801698 <string_cpu+0xfb>
+  80166e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801671:	25 00 00 00 08       	and    $0x8000000,%eax
+  801676:	85 c0                	test   %eax,%eax
+  801678:	74 1e                	je     801698 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80167a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167f:	48 b8 75 15 80 00 00 	movabs $0x801575,%rax
+  801686:	00 00 00 
+  801689:	ff d0                	call   *%rax
+  80168b:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80168e:	48 83 f8 06          	cmp    $0x6,%rax
+  801692:	75 04                	jne    801698 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801694:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801698:	48 ba c8 87 80 00 00 	movabs $0x8087c8,%rdx
+  80169f:	00 00 00 
+  8016a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016a5:	89 02                	mov    %eax,(%rdx)
+  8016a7:	48 b8 c8 87 80 00 00 	movabs $0x8087c8,%rax
+  8016ae:	00 00 00 
+  8016b1:	8b 00                	mov    (%rax),%eax
+}
+  8016b3:	c9                   	leave
+  8016b4:	c3                   	ret
+
+00000000008016b5 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8016b5:	55                   	push   %rbp
+  8016b6:	48 89 e5             	mov    %rsp,%rbp
+  8016b9:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8016bd:	48 83 ec 60          	sub    $0x60,%rsp
+  8016c1:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8016c6:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8016cb:	83 e0 1f             	and    $0x1f,%eax
+  8016ce:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8016d2:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8016d6:	48 f7 d8             	neg    %rax
+  8016d9:	48 89 c2             	mov    %rax,%rdx
+  8016dc:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8016e1:	48 01 d0             	add    %rdx,%rax
+  8016e4:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8016e9:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8016ed:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8016f3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8016f8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8016fc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801702:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801706:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80170a:	89 c2                	mov    %eax,%edx
+  80170c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801710:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801715:	89 c1                	mov    %eax,%ecx
+  801717:	d3 e6                	shl    %cl,%esi
+  801719:	89 f0                	mov    %esi,%eax
+  80171b:	21 d0                	and    %edx,%eax
+  80171d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801721:	eb 21                	jmp    801744 <strlen_avx2+0x8f>
+    p += 32;
+  801723:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801729:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80172e:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801732:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801738:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80173c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801740:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801744:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801749:	74 d8                	je     801723 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80174b:	31 c0                	xor    %eax,%eax
+  80174d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801753:	48 63 d0             	movslq %eax,%rdx
+  801756:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80175b:	48 01 d0             	add    %rdx,%rax
+  80175e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801763:	c9                   	leave
+  801764:	c3                   	ret
+
+0000000000801765 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801765:	55                   	push   %rbp
+  801766:	48 89 e5             	mov    %rsp,%rbp
+  801769:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80176d:	48 83 ec 40          	sub    $0x40,%rsp
+  801771:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801776:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80177b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801780:	eb 77                	jmp    8017f9 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801782:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801787:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80178b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80178f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801794:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801798:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80179c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8017a0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8017a4:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8017a9:	74 3c                	je     8017e7 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8017ab:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8017af:	f7 d0                	not    %eax
+  8017b1:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8017b5:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8017b9:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8017bd:	48 63 d0             	movslq %eax,%rdx
+  8017c0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8017c5:	48 01 d0             	add    %rdx,%rax
+  8017c8:	0f b6 00             	movzbl (%rax),%eax
+  8017cb:	0f b6 c0             	movzbl %al,%eax
+  8017ce:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8017d2:	48 63 ca             	movslq %edx,%rcx
+  8017d5:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8017da:	48 01 ca             	add    %rcx,%rdx
+  8017dd:	0f b6 12             	movzbl (%rdx),%edx
+  8017e0:	0f b6 d2             	movzbl %dl,%edx
+  8017e3:	29 d0                	sub    %edx,%eax
+  8017e5:	eb 6b                	jmp    801852 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8017e7:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8017ed:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8017f3:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8017f9:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8017ff:	77 81                	ja     801782 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801801:	eb 42                	jmp    801845 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801803:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801808:	0f b6 10             	movzbl (%rax),%edx
+  80180b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801810:	0f b6 00             	movzbl (%rax),%eax
+  801813:	38 c2                	cmp    %al,%dl
+  801815:	74 1c                	je     801833 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801817:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80181c:	0f b6 00             	movzbl (%rax),%eax
+  80181f:	0f b6 c8             	movzbl %al,%ecx
+  801822:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801827:	0f b6 00             	movzbl (%rax),%eax
+  80182a:	0f b6 d0             	movzbl %al,%edx
+  80182d:	89 c8                	mov    %ecx,%eax
+  80182f:	29 d0                	sub    %edx,%eax
+  801831:	eb 1f                	jmp    801852 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801833:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801839:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80183f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801845:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80184b:	75 b6                	jne    801803 <memcmp_avx2+0x9e>
+  return 0;
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801852:	c9                   	leave
+  801853:	c3                   	ret
+
+0000000000801854 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801854:	55                   	push   %rbp
+  801855:	48 89 e5             	mov    %rsp,%rbp
+  801858:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80185c:	48 83 ec 60          	sub    $0x60,%rsp
+  801860:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801865:	89 f0                	mov    %esi,%eax
+  801867:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80186c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801870:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801875:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801879:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80187e:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801884:	eb 47                	jmp    8018cd <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801886:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80188b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80188f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801893:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801899:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80189d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8018a1:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8018a5:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8018aa:	74 15                	je     8018c1 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8018ac:	31 c0                	xor    %eax,%eax
+  8018ae:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8018b4:	48 63 d0             	movslq %eax,%rdx
+  8018b7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8018bc:	48 01 d0             	add    %rdx,%rax
+  8018bf:	eb 3d                	jmp    8018fe <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8018c1:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8018c7:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8018cd:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8018d3:	77 b1                	ja     801886 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8018d5:	eb 0c                	jmp    8018e3 <memfind_avx2+0x8f>
+  8018d7:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8018dd:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8018e3:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8018e9:	74 0e                	je     8018f9 <memfind_avx2+0xa5>
+  8018eb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8018f0:	0f b6 00             	movzbl (%rax),%eax
+  8018f3:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8018f7:	75 de                	jne    8018d7 <memfind_avx2+0x83>
+  return s;
+  8018f9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8018fe:	c9                   	leave
+  8018ff:	c3                   	ret
+
+0000000000801900 <strlen>:
+strlen(const char *s) {
+  801900:	55                   	push   %rbp
+  801901:	48 89 e5             	mov    %rsp,%rbp
+  801904:	48 83 ec 40          	sub    $0x40,%rsp
+  801908:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80190c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801910:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801914:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  80191b:	00 00 00 
+  80191e:	ff d0                	call   *%rax
+  801920:	83 e0 02             	and    $0x2,%eax
+  801923:	85 c0                	test   %eax,%eax
+  801925:	74 18                	je     80193f <strlen+0x3f>
+    return strlen_avx2(s);
+  801927:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192b:	48 89 c7             	mov    %rax,%rdi
+  80192e:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  801935:	00 00 00 
+  801938:	ff d0                	call   *%rax
+  80193a:	e9 82 00 00 00       	jmp    8019c1 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80193f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801943:	83 e0 0f             	and    $0xf,%eax
+  801946:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801949:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80194c:	48 f7 d8             	neg    %rax
+  80194f:	48 89 c2             	mov    %rax,%rdx
+  801952:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801956:	48 01 d0             	add    %rdx,%rax
+  801959:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80195d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801961:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801965:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80196a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80196e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801972:	89 c2                	mov    %eax,%edx
+  801974:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801977:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80197c:	89 c1                	mov    %eax,%ecx
+  80197e:	d3 e6                	shl    %cl,%esi
+  801980:	89 f0                	mov    %esi,%eax
+  801982:	21 d0                	and    %edx,%eax
+  801984:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801987:	eb 1d                	jmp    8019a6 <strlen+0xa6>
+    p += 16;
+  801989:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80198e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801992:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801996:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80199b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80199f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019a3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019aa:	74 dd                	je     801989 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8019ac:	31 c0                	xor    %eax,%eax
+  8019ae:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8019b3:	48 63 d0             	movslq %eax,%rdx
+  8019b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ba:	48 01 d0             	add    %rdx,%rax
+  8019bd:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+00000000008019c3 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8019cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8019da:	eb 0e                	jmp    8019ea <strnlen+0x27>
+    n++;
+  8019dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019e0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019e5:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8019ea:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8019ef:	74 0b                	je     8019fc <strnlen+0x39>
+  8019f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019f5:	0f b6 00             	movzbl (%rax),%eax
+  8019f8:	84 c0                	test   %al,%al
+  8019fa:	75 e0                	jne    8019dc <strnlen+0x19>
+  return n;
+  8019fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8019ff:	c9                   	leave
+  801a00:	c3                   	ret
+
+0000000000801a01 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801a01:	55                   	push   %rbp
+  801a02:	48 89 e5             	mov    %rsp,%rbp
+  801a05:	48 83 ec 20          	sub    $0x20,%rsp
+  801a09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a0d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a15:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801a19:	90                   	nop
+  801a1a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a1e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a22:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a32:	0f b6 12             	movzbl (%rdx),%edx
+  801a35:	88 10                	mov    %dl,(%rax)
+  801a37:	0f b6 00             	movzbl (%rax),%eax
+  801a3a:	84 c0                	test   %al,%al
+  801a3c:	75 dc                	jne    801a1a <strcpy+0x19>
+  return ret;
+  801a3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a42:	c9                   	leave
+  801a43:	c3                   	ret
+
+0000000000801a44 <strcat>:
+strcat(char *dst, const char *src) {
+  801a44:	55                   	push   %rbp
+  801a45:	48 89 e5             	mov    %rsp,%rbp
+  801a48:	48 83 ec 20          	sub    $0x20,%rsp
+  801a4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a50:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801a54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a58:	48 89 c7             	mov    %rax,%rdi
+  801a5b:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  801a67:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801a6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801a6d:	48 63 d0             	movslq %eax,%rdx
+  801a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a74:	48 01 c2             	add    %rax,%rdx
+  801a77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a7b:	48 89 c6             	mov    %rax,%rsi
+  801a7e:	48 89 d7             	mov    %rdx,%rdi
+  801a81:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+  return dst;
+  801a8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a91:	c9                   	leave
+  801a92:	c3                   	ret
+
+0000000000801a93 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	48 83 ec 28          	sub    $0x28,%rsp
+  801a9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801aa3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801aaf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ab6:	00 
+  801ab7:	eb 2a                	jmp    801ae3 <strncpy+0x50>
+    *dst++ = *src;
+  801ab9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801abd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ac1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801ac5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ac9:	0f b6 12             	movzbl (%rdx),%edx
+  801acc:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801ace:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ad2:	0f b6 00             	movzbl (%rax),%eax
+  801ad5:	84 c0                	test   %al,%al
+  801ad7:	74 05                	je     801ade <strncpy+0x4b>
+      src++;
+  801ad9:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801ade:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801aeb:	72 cc                	jb     801ab9 <strncpy+0x26>
+  return ret;
+  801aed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+0000000000801af3 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	48 83 ec 28          	sub    $0x28,%rsp
+  801afb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b03:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b0b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801b0f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b14:	74 3d                	je     801b53 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801b16:	eb 1d                	jmp    801b35 <strlcpy+0x42>
+      *dst++ = *src++;
+  801b18:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801b1c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b20:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b28:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b2c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b30:	0f b6 12             	movzbl (%rdx),%edx
+  801b33:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801b35:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801b3a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b3f:	74 0b                	je     801b4c <strlcpy+0x59>
+  801b41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b45:	0f b6 00             	movzbl (%rax),%eax
+  801b48:	84 c0                	test   %al,%al
+  801b4a:	75 cc                	jne    801b18 <strlcpy+0x25>
+    *dst = '\0';
+  801b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b50:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801b53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b57:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+
+0000000000801b5d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801b5d:	55                   	push   %rbp
+  801b5e:	48 89 e5             	mov    %rsp,%rbp
+  801b61:	48 83 ec 30          	sub    $0x30,%rsp
+  801b65:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b69:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b6d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801b71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b75:	48 89 c7             	mov    %rax,%rdi
+  801b78:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  801b7f:	00 00 00 
+  801b82:	ff d0                	call   *%rax
+  801b84:	48 98                	cltq
+  801b86:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801b8a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b92:	48 89 d6             	mov    %rdx,%rsi
+  801b95:	48 89 c7             	mov    %rax,%rdi
+  801b98:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  801b9f:	00 00 00 
+  801ba2:	ff d0                	call   *%rax
+  801ba4:	48 98                	cltq
+  801ba6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801baa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bae:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801bb2:	75 10                	jne    801bc4 <strlcat+0x67>
+    return maxlen + srclen;
+  801bb4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bbc:	48 01 d0             	add    %rdx,%rax
+  801bbf:	e9 86 00 00 00       	jmp    801c4a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc8:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801bcc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801bd0:	73 2b                	jae    801bfd <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bda:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801bde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be2:	48 01 c1             	add    %rax,%rcx
+  801be5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801be9:	48 89 c6             	mov    %rax,%rsi
+  801bec:	48 89 cf             	mov    %rcx,%rdi
+  801bef:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	eb 42                	jmp    801c3f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801bfd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c01:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c05:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c0d:	48 01 c1             	add    %rax,%rcx
+  801c10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c14:	48 89 c6             	mov    %rax,%rsi
+  801c17:	48 89 cf             	mov    %rcx,%rdi
+  801c1a:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801c26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2e:	48 01 d0             	add    %rdx,%rax
+  801c31:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c39:	48 01 d0             	add    %rdx,%rax
+  801c3c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801c3f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c47:	48 01 d0             	add    %rdx,%rax
+}
+  801c4a:	c9                   	leave
+  801c4b:	c3                   	ret
+
+0000000000801c4c <strcmp>:
+strcmp(const char *p, const char *q) {
+  801c4c:	55                   	push   %rbp
+  801c4d:	48 89 e5             	mov    %rsp,%rbp
+  801c50:	48 83 ec 10          	sub    $0x10,%rsp
+  801c54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801c5c:	eb 0a                	jmp    801c68 <strcmp+0x1c>
+    p++, q++;
+  801c5e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c63:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c6c:	0f b6 00             	movzbl (%rax),%eax
+  801c6f:	84 c0                	test   %al,%al
+  801c71:	74 12                	je     801c85 <strcmp+0x39>
+  801c73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c77:	0f b6 10             	movzbl (%rax),%edx
+  801c7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c7e:	0f b6 00             	movzbl (%rax),%eax
+  801c81:	38 c2                	cmp    %al,%dl
+  801c83:	74 d9                	je     801c5e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c89:	0f b6 00             	movzbl (%rax),%eax
+  801c8c:	0f b6 d0             	movzbl %al,%edx
+  801c8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c93:	0f b6 00             	movzbl (%rax),%eax
+  801c96:	0f b6 c0             	movzbl %al,%eax
+  801c99:	29 c2                	sub    %eax,%edx
+  801c9b:	89 d0                	mov    %edx,%eax
+}
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+
+0000000000801c9f <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801c9f:	55                   	push   %rbp
+  801ca0:	48 89 e5             	mov    %rsp,%rbp
+  801ca3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ca7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801caf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801cb3:	eb 0f                	jmp    801cc4 <strncmp+0x25>
+    n--, p++, q++;
+  801cb5:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801cba:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cbf:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801cc4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801cc9:	74 1d                	je     801ce8 <strncmp+0x49>
+  801ccb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ccf:	0f b6 00             	movzbl (%rax),%eax
+  801cd2:	84 c0                	test   %al,%al
+  801cd4:	74 12                	je     801ce8 <strncmp+0x49>
+  801cd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cda:	0f b6 10             	movzbl (%rax),%edx
+  801cdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce1:	0f b6 00             	movzbl (%rax),%eax
+  801ce4:	38 c2                	cmp    %al,%dl
+  801ce6:	74 cd                	je     801cb5 <strncmp+0x16>
+  if (n == 0)
+  801ce8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ced:	75 07                	jne    801cf6 <strncmp+0x57>
+    return 0;
+  801cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf4:	eb 16                	jmp    801d0c <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801cf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cfa:	0f b6 00             	movzbl (%rax),%eax
+  801cfd:	0f b6 d0             	movzbl %al,%edx
+  801d00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d04:	0f b6 00             	movzbl (%rax),%eax
+  801d07:	0f b6 c0             	movzbl %al,%eax
+  801d0a:	29 c2                	sub    %eax,%edx
+}
+  801d0c:	89 d0                	mov    %edx,%eax
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+0000000000801d10 <strchr>:
+strchr(const char *s, char c) {
+  801d10:	55                   	push   %rbp
+  801d11:	48 89 e5             	mov    %rsp,%rbp
+  801d14:	48 83 ec 60          	sub    $0x60,%rsp
+  801d18:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801d1c:	89 f0                	mov    %esi,%eax
+  801d1e:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801d21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801d25:	83 e0 0f             	and    $0xf,%eax
+  801d28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d2e:	48 f7 d8             	neg    %rax
+  801d31:	48 89 c2             	mov    %rax,%rdx
+  801d34:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801d38:	48 01 d0             	add    %rdx,%rax
+  801d3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801d3f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801d43:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801d47:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801d4b:	66 0f 6e c0          	movd   %eax,%xmm0
+  801d4f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801d53:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801d57:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801d5c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801d60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d64:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801d68:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801d6c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d71:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801d76:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d7a:	89 c2                	mov    %eax,%edx
+  801d7c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801d81:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801d86:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d8a:	09 c2                	or     %eax,%edx
+  801d8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d8f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801d94:	89 c1                	mov    %eax,%ecx
+  801d96:	d3 e6                	shl    %cl,%esi
+  801d98:	89 f0                	mov    %esi,%eax
+  801d9a:	21 d0                	and    %edx,%eax
+  801d9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801d9f:	eb 34                	jmp    801dd5 <strchr+0xc5>
+    p += 16;
+  801da1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801da6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801daa:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801dae:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801db2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801db7:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801dbc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801dc0:	89 c2                	mov    %eax,%edx
+  801dc2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801dc7:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801dcc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801dd0:	09 d0                	or     %edx,%eax
+  801dd2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801dd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dd9:	74 c6                	je     801da1 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801ddb:	31 c0                	xor    %eax,%eax
+  801ddd:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801de2:	48 98                	cltq
+  801de4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801de8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dec:	0f b6 00             	movzbl (%rax),%eax
+  801def:	84 c0                	test   %al,%al
+  801df1:	74 06                	je     801df9 <strchr+0xe9>
+  801df3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801df7:	eb 05                	jmp    801dfe <strchr+0xee>
+  801df9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfe:	c9                   	leave
+  801dff:	c3                   	ret
+
+0000000000801e00 <strfind>:
+strfind(const char *s, char c) {
+  801e00:	55                   	push   %rbp
+  801e01:	48 89 e5             	mov    %rsp,%rbp
+  801e04:	48 83 ec 10          	sub    $0x10,%rsp
+  801e08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e0c:	89 f0                	mov    %esi,%eax
+  801e0e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801e11:	eb 11                	jmp    801e24 <strfind+0x24>
+    if (*s == c)
+  801e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e17:	0f b6 00             	movzbl (%rax),%eax
+  801e1a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801e1d:	74 12                	je     801e31 <strfind+0x31>
+  for (; *s; s++)
+  801e1f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e28:	0f b6 00             	movzbl (%rax),%eax
+  801e2b:	84 c0                	test   %al,%al
+  801e2d:	75 e4                	jne    801e13 <strfind+0x13>
+  801e2f:	eb 01                	jmp    801e32 <strfind+0x32>
+      break;
+  801e31:	90                   	nop
+  return (char *)s;
+  801e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801e36:	c9                   	leave
+  801e37:	c3                   	ret
+
+0000000000801e38 <memset>:
+memset(void *v, int c, size_t n) {
+  801e38:	55                   	push   %rbp
+  801e39:	48 89 e5             	mov    %rsp,%rbp
+  801e3c:	48 83 ec 38          	sub    $0x38,%rsp
+  801e40:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e44:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801e47:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801e4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e53:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e58:	76 41                	jbe    801e9b <memset+0x63>
+  801e5a:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	83 e0 01             	and    $0x1,%eax
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	74 2e                	je     801e9b <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801e6d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801e70:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801e74:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e78:	48 89 ce             	mov    %rcx,%rsi
+  801e7b:	48 89 f7             	mov    %rsi,%rdi
+  801e7e:	48 89 d1             	mov    %rdx,%rcx
+  801e81:	fc                   	cld
+  801e82:	f3 aa                	rep stos %al,%es:(%rdi)
+  801e84:	48 89 ca             	mov    %rcx,%rdx
+  801e87:	48 89 fe             	mov    %rdi,%rsi
+  801e8a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801e8e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801e92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e96:	e9 a7 00 00 00       	jmp    801f42 <memset+0x10a>
+  if (n >= 8) {
+  801e9b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ea0:	0f 86 87 00 00 00    	jbe    801f2d <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801ea6:	eb 16                	jmp    801ebe <memset+0x86>
+      *p++ = c;
+  801ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801eb0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801eb4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801eb7:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801eb9:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ebe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec2:	83 e0 07             	and    $0x7,%eax
+  801ec5:	48 85 c0             	test   %rax,%rax
+  801ec8:	75 de                	jne    801ea8 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801eca:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ecd:	0f b6 c0             	movzbl %al,%eax
+  801ed0:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801ed7:	01 01 01 
+  801eda:	48 0f af c2          	imul   %rdx,%rax
+  801ede:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801ee2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ee6:	48 c1 e8 03          	shr    $0x3,%rax
+  801eea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801eee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ef2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ef6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801efa:	48 89 ce             	mov    %rcx,%rsi
+  801efd:	48 89 f7             	mov    %rsi,%rdi
+  801f00:	48 89 d1             	mov    %rdx,%rcx
+  801f03:	fc                   	cld
+  801f04:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801f07:	48 89 ca             	mov    %rcx,%rdx
+  801f0a:	48 89 fe             	mov    %rdi,%rsi
+  801f0d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801f11:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801f15:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801f1a:	eb 11                	jmp    801f2d <memset+0xf5>
+    *p++ = c;
+  801f1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f20:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f24:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801f28:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801f2b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801f2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f31:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f35:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f39:	48 85 c0             	test   %rax,%rax
+  801f3c:	75 de                	jne    801f1c <memset+0xe4>
+  return v;
+  801f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f42:	c9                   	leave
+  801f43:	c3                   	ret
+
+0000000000801f44 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801f44:	55                   	push   %rbp
+  801f45:	48 89 e5             	mov    %rsp,%rbp
+  801f48:	48 83 ec 38          	sub    $0x38,%rsp
+  801f4c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801f58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f5c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801f60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f64:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801f68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f6c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801f70:	0f 83 da 00 00 00    	jae    802050 <memmove+0x10c>
+  801f76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f7e:	48 01 d0             	add    %rdx,%rax
+  801f81:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801f85:	0f 83 c5 00 00 00    	jae    802050 <memmove+0x10c>
+    s += n;
+  801f8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f8f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801f93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f97:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801f9b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801fa0:	0f 86 94 00 00 00    	jbe    80203a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801fa6:	eb 1c                	jmp    801fc4 <memmove+0x80>
+        *--d = *--s;
+  801fa8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801fad:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801fb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb6:	0f b6 10             	movzbl (%rax),%edx
+  801fb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fbd:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801fbf:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801fc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fc8:	83 e0 07             	and    $0x7,%eax
+  801fcb:	48 85 c0             	test   %rax,%rax
+  801fce:	75 d8                	jne    801fa8 <memmove+0x64>
+      nq = n / 8;
+  801fd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd4:	48 c1 e8 03          	shr    $0x3,%rax
+  801fd8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801fdc:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801fe1:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801fe6:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801feb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ff3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ff7:	48 89 cf             	mov    %rcx,%rdi
+  801ffa:	48 89 d6             	mov    %rdx,%rsi
+  801ffd:	48 89 c1             	mov    %rax,%rcx
+  802000:	fd                   	std
+  802001:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802004:	fc                   	cld
+  802005:	48 89 c8             	mov    %rcx,%rax
+  802008:	48 89 f2             	mov    %rsi,%rdx
+  80200b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80200f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802013:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  802017:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  80201c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  802021:	eb 17                	jmp    80203a <memmove+0xf6>
+      *--d = *--s;
+  802023:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802028:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80202d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802031:	0f b6 10             	movzbl (%rax),%edx
+  802034:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802038:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80203a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80203e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802042:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802046:	48 85 c0             	test   %rax,%rax
+  802049:	75 d8                	jne    802023 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80204b:	e9 f4 00 00 00       	jmp    802144 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802050:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802055:	76 46                	jbe    80209d <memmove+0x159>
+  802057:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+  802063:	83 e0 01             	and    $0x1,%eax
+  802066:	85 c0                	test   %eax,%eax
+  802068:	74 33                	je     80209d <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80206a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80206e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802072:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802076:	48 89 cf             	mov    %rcx,%rdi
+  802079:	48 89 d6             	mov    %rdx,%rsi
+  80207c:	48 89 c1             	mov    %rax,%rcx
+  80207f:	fc                   	cld
+  802080:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802082:	48 89 c8             	mov    %rcx,%rax
+  802085:	48 89 f2             	mov    %rsi,%rdx
+  802088:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80208c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802090:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  802094:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802098:	e9 ab 00 00 00       	jmp    802148 <memmove+0x204>
+    if (n >= 8) {
+  80209d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8020a2:	0f 86 8b 00 00 00    	jbe    802133 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8020a8:	eb 22                	jmp    8020cc <memmove+0x188>
+        *d++ = *s++;
+  8020aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020ae:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8020b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8020b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020ba:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8020be:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8020c2:	0f b6 12             	movzbl (%rdx),%edx
+  8020c5:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8020c7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8020cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020d0:	83 e0 07             	and    $0x7,%eax
+  8020d3:	48 85 c0             	test   %rax,%rax
+  8020d6:	75 d2                	jne    8020aa <memmove+0x166>
+      nq = n / 8;
+  8020d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020dc:	48 c1 e8 03          	shr    $0x3,%rax
+  8020e0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8020e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020f0:	48 89 cf             	mov    %rcx,%rdi
+  8020f3:	48 89 d6             	mov    %rdx,%rsi
+  8020f6:	48 89 c1             	mov    %rax,%rcx
+  8020f9:	fc                   	cld
+  8020fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8020fd:	48 89 c8             	mov    %rcx,%rax
+  802100:	48 89 f2             	mov    %rsi,%rdx
+  802103:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802107:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80210b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80210f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  802114:	eb 1d                	jmp    802133 <memmove+0x1ef>
+      *d++ = *s++;
+  802116:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80211a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80211e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802122:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802126:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80212a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80212e:	0f b6 12             	movzbl (%rdx),%edx
+  802131:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  802133:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802137:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80213b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80213f:	48 85 c0             	test   %rax,%rax
+  802142:	75 d2                	jne    802116 <memmove+0x1d2>
+  return dst;
+  802144:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  802148:	c9                   	leave
+  802149:	c3                   	ret
+
+000000000080214a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80214a:	55                   	push   %rbp
+  80214b:	48 89 e5             	mov    %rsp,%rbp
+  80214e:	48 83 ec 18          	sub    $0x18,%rsp
+  802152:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802156:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80215a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80215e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802162:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802166:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80216a:	48 89 ce             	mov    %rcx,%rsi
+  80216d:	48 89 c7             	mov    %rax,%rdi
+  802170:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  802177:	00 00 00 
+  80217a:	ff d0                	call   *%rax
+}
+  80217c:	c9                   	leave
+  80217d:	c3                   	ret
+
+000000000080217e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	48 83 ec 40          	sub    $0x40,%rsp
+  802186:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80218a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80218e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  802192:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802196:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80219a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80219e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8021a2:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8021a7:	0f 86 a7 00 00 00    	jbe    802254 <memcmp+0xd6>
+  8021ad:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	83 e0 02             	and    $0x2,%eax
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	0f 84 90 00 00 00    	je     802254 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8021c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8021c8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d0:	48 89 ce             	mov    %rcx,%rsi
+  8021d3:	48 89 c7             	mov    %rax,%rdi
+  8021d6:	48 b8 65 17 80 00 00 	movabs $0x801765,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+  8021e2:	e9 c2 00 00 00       	jmp    8022a9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8021e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021eb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8021ef:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8021f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021f7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8021fb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8021ff:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802203:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  802206:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  80220d:	74 36                	je     802245 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80220f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802212:	f7 d0                	not    %eax
+  802214:	f3 0f bc c0          	tzcnt  %eax,%eax
+  802218:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80221b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80221e:	48 63 d0             	movslq %eax,%rdx
+  802221:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802225:	48 01 d0             	add    %rdx,%rax
+  802228:	0f b6 00             	movzbl (%rax),%eax
+  80222b:	0f b6 c0             	movzbl %al,%eax
+  80222e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802231:	48 63 ca             	movslq %edx,%rcx
+  802234:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802238:	48 01 ca             	add    %rcx,%rdx
+  80223b:	0f b6 12             	movzbl (%rdx),%edx
+  80223e:	0f b6 d2             	movzbl %dl,%edx
+  802241:	29 d0                	sub    %edx,%eax
+  802243:	eb 64                	jmp    8022a9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  802245:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  80224a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80224f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802254:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802259:	77 8c                	ja     8021e7 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80225b:	eb 36                	jmp    802293 <memcmp+0x115>
+    if (*s1 != *s2)
+  80225d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802261:	0f b6 10             	movzbl (%rax),%edx
+  802264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802268:	0f b6 00             	movzbl (%rax),%eax
+  80226b:	38 c2                	cmp    %al,%dl
+  80226d:	74 1a                	je     802289 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80226f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802273:	0f b6 00             	movzbl (%rax),%eax
+  802276:	0f b6 c8             	movzbl %al,%ecx
+  802279:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80227d:	0f b6 00             	movzbl (%rax),%eax
+  802280:	0f b6 d0             	movzbl %al,%edx
+  802283:	89 c8                	mov    %ecx,%eax
+  802285:	29 d0                	sub    %edx,%eax
+  802287:	eb 20                	jmp    8022a9 <memcmp+0x12b>
+    s1++, s2++;
+  802289:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80228e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  802293:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802297:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80229b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80229f:	48 85 c0             	test   %rax,%rax
+  8022a2:	75 b9                	jne    80225d <memcmp+0xdf>
+  }
+
+  return 0;
+  8022a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+
+00000000008022ab <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	48 83 ec 50          	sub    $0x50,%rsp
+  8022b3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022b7:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8022ba:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8022be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8022c2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8022c6:	48 01 d0             	add    %rdx,%rax
+  8022c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8022cd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8022d0:	66 0f 6e c0          	movd   %eax,%xmm0
+  8022d4:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8022d8:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8022dc:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8022e1:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8022e5:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8022ea:	76 73                	jbe    80235f <memfind+0xb4>
+  8022ec:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+  8022f8:	83 e0 02             	and    $0x2,%eax
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	74 60                	je     80235f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8022ff:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802302:	0f b6 c8             	movzbl %al,%ecx
+  802305:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802309:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80230d:	89 ce                	mov    %ecx,%esi
+  80230f:	48 89 c7             	mov    %rax,%rdi
+  802312:	48 b8 54 18 80 00 00 	movabs $0x801854,%rax
+  802319:	00 00 00 
+  80231c:	ff d0                	call   *%rax
+  80231e:	eb 6c                	jmp    80238c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  802320:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802324:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802328:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80232c:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802331:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802335:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802339:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80233c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802340:	74 13                	je     802355 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802342:	31 c0                	xor    %eax,%eax
+  802344:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802349:	48 63 d0             	movslq %eax,%rdx
+  80234c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802350:	48 01 d0             	add    %rdx,%rax
+  802353:	eb 37                	jmp    80238c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802355:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  80235a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  80235f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802364:	77 ba                	ja     802320 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802366:	eb 13                	jmp    80237b <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802368:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80236c:	0f b6 00             	movzbl (%rax),%eax
+  80236f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802372:	38 d0                	cmp    %dl,%al
+  802374:	74 11                	je     802387 <memfind+0xdc>
+  for (; s < ends; s++)
+  802376:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80237b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80237f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802383:	72 e3                	jb     802368 <memfind+0xbd>
+  802385:	eb 01                	jmp    802388 <memfind+0xdd>
+      break;
+  802387:	90                   	nop
+  return (void *)s;
+  802388:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80238c:	c9                   	leave
+  80238d:	c3                   	ret
+
+000000000080238e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+  802392:	48 83 ec 38          	sub    $0x38,%rsp
+  802396:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80239a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80239e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  8023a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  8023a8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8023af:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8023b0:	eb 05                	jmp    8023b7 <strtol+0x29>
+    s++;
+  8023b2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  8023b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023bb:	0f b6 00             	movzbl (%rax),%eax
+  8023be:	3c 20                	cmp    $0x20,%al
+  8023c0:	74 f0                	je     8023b2 <strtol+0x24>
+  8023c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023c6:	0f b6 00             	movzbl (%rax),%eax
+  8023c9:	3c 09                	cmp    $0x9,%al
+  8023cb:	74 e5                	je     8023b2 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8023cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023d1:	0f b6 00             	movzbl (%rax),%eax
+  8023d4:	3c 2b                	cmp    $0x2b,%al
+  8023d6:	75 07                	jne    8023df <strtol+0x51>
+    s++;
+  8023d8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023dd:	eb 17                	jmp    8023f6 <strtol+0x68>
+  else if (*s == '-')
+  8023df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023e3:	0f b6 00             	movzbl (%rax),%eax
+  8023e6:	3c 2d                	cmp    $0x2d,%al
+  8023e8:	75 0c                	jne    8023f6 <strtol+0x68>
+    s++, neg = 1;
+  8023ea:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023ef:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8023f6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8023fa:	74 06                	je     802402 <strtol+0x74>
+  8023fc:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802400:	75 28                	jne    80242a <strtol+0x9c>
+  802402:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802406:	0f b6 00             	movzbl (%rax),%eax
+  802409:	3c 30                	cmp    $0x30,%al
+  80240b:	75 1d                	jne    80242a <strtol+0x9c>
+  80240d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802411:	48 83 c0 01          	add    $0x1,%rax
+  802415:	0f b6 00             	movzbl (%rax),%eax
+  802418:	3c 78                	cmp    $0x78,%al
+  80241a:	75 0e                	jne    80242a <strtol+0x9c>
+    s += 2, base = 16;
+  80241c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802421:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802428:	eb 2c                	jmp    802456 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  80242a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80242e:	75 19                	jne    802449 <strtol+0xbb>
+  802430:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802434:	0f b6 00             	movzbl (%rax),%eax
+  802437:	3c 30                	cmp    $0x30,%al
+  802439:	75 0e                	jne    802449 <strtol+0xbb>
+    s++, base = 8;
+  80243b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802440:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802447:	eb 0d                	jmp    802456 <strtol+0xc8>
+  else if (base == 0)
+  802449:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80244d:	75 07                	jne    802456 <strtol+0xc8>
+    base = 10;
+  80244f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802456:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80245a:	0f b6 00             	movzbl (%rax),%eax
+  80245d:	3c 2f                	cmp    $0x2f,%al
+  80245f:	7e 1d                	jle    80247e <strtol+0xf0>
+  802461:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802465:	0f b6 00             	movzbl (%rax),%eax
+  802468:	3c 39                	cmp    $0x39,%al
+  80246a:	7f 12                	jg     80247e <strtol+0xf0>
+      dig = *s - '0';
+  80246c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802470:	0f b6 00             	movzbl (%rax),%eax
+  802473:	0f be c0             	movsbl %al,%eax
+  802476:	83 e8 30             	sub    $0x30,%eax
+  802479:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80247c:	eb 4e                	jmp    8024cc <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80247e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802482:	0f b6 00             	movzbl (%rax),%eax
+  802485:	3c 60                	cmp    $0x60,%al
+  802487:	7e 1d                	jle    8024a6 <strtol+0x118>
+  802489:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80248d:	0f b6 00             	movzbl (%rax),%eax
+  802490:	3c 7a                	cmp    $0x7a,%al
+  802492:	7f 12                	jg     8024a6 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802494:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802498:	0f b6 00             	movzbl (%rax),%eax
+  80249b:	0f be c0             	movsbl %al,%eax
+  80249e:	83 e8 57             	sub    $0x57,%eax
+  8024a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8024a4:	eb 26                	jmp    8024cc <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8024a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024aa:	0f b6 00             	movzbl (%rax),%eax
+  8024ad:	3c 40                	cmp    $0x40,%al
+  8024af:	7e 47                	jle    8024f8 <strtol+0x16a>
+  8024b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024b5:	0f b6 00             	movzbl (%rax),%eax
+  8024b8:	3c 5a                	cmp    $0x5a,%al
+  8024ba:	7f 3c                	jg     8024f8 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8024bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024c0:	0f b6 00             	movzbl (%rax),%eax
+  8024c3:	0f be c0             	movsbl %al,%eax
+  8024c6:	83 e8 37             	sub    $0x37,%eax
+  8024c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8024cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024cf:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8024d2:	7d 23                	jge    8024f7 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8024d4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8024d9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024dc:	48 98                	cltq
+  8024de:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8024e3:	48 89 c2             	mov    %rax,%rdx
+  8024e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024e9:	48 98                	cltq
+  8024eb:	48 01 d0             	add    %rdx,%rax
+  8024ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8024f2:	e9 5f ff ff ff       	jmp    802456 <strtol+0xc8>
+      break;
+  8024f7:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8024f8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8024fd:	74 0b                	je     80250a <strtol+0x17c>
+    *endptr = (char *)s;
+  8024ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802503:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802507:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80250a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80250e:	74 09                	je     802519 <strtol+0x18b>
+  802510:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802514:	48 f7 d8             	neg    %rax
+  802517:	eb 04                	jmp    80251d <strtol+0x18f>
+  802519:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80251d:	c9                   	leave
+  80251e:	c3                   	ret
+
+000000000080251f <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	53                   	push   %rbx
+  802524:	48 83 ec 48          	sub    $0x48,%rsp
+  802528:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80252c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802530:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802534:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802538:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80253c:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802540:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802544:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802548:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80254c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802550:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802554:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802558:	4c 89 c3             	mov    %r8,%rbx
+  80255b:	cd 30                	int    $0x30
+  80255d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802561:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802566:	74 46                	je     8025ae <syscall+0x8f>
+  802568:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80256d:	7e 3f                	jle    8025ae <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80256f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802573:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802577:	49 89 d0             	mov    %rdx,%r8
+  80257a:	48 89 c1             	mov    %rax,%rcx
+  80257d:	48 b8 e8 67 80 00 00 	movabs $0x8067e8,%rax
+  802584:	00 00 00 
+  802587:	48 89 c2             	mov    %rax,%rdx
+  80258a:	be 22 00 00 00       	mov    $0x22,%esi
+  80258f:	48 b8 07 68 80 00 00 	movabs $0x806807,%rax
+  802596:	00 00 00 
+  802599:	48 89 c7             	mov    %rax,%rdi
+  80259c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a1:	49 b9 32 08 80 00 00 	movabs $0x800832,%r9
+  8025a8:	00 00 00 
+  8025ab:	41 ff d1             	call   *%r9
+
+  return ret;
+  8025ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8025b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025b6:	c9                   	leave
+  8025b7:	c3                   	ret
+
+00000000008025b8 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8025b8:	55                   	push   %rbp
+  8025b9:	48 89 e5             	mov    %rsp,%rbp
+  8025bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8025c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d4:	6a 00                	push   $0x0
+  8025d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e2:	48 89 d1             	mov    %rdx,%rcx
+  8025e5:	48 89 c2             	mov    %rax,%rdx
+  8025e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025f2:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  8025f9:	00 00 00 
+  8025fc:	ff d0                	call   *%rax
+  8025fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802602:	90                   	nop
+  802603:	c9                   	leave
+  802604:	c3                   	ret
+
+0000000000802605 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802605:	55                   	push   %rbp
+  802606:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802609:	48 83 ec 08          	sub    $0x8,%rsp
+  80260d:	6a 00                	push   $0x0
+  80260f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80261b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802620:	ba 00 00 00 00       	mov    $0x0,%edx
+  802625:	be 00 00 00 00       	mov    $0x0,%esi
+  80262a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80262f:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+  80263b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+
+0000000000802641 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	48 83 ec 10          	sub    $0x10,%rsp
+  802649:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80264c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80264f:	48 98                	cltq
+  802651:	48 83 ec 08          	sub    $0x8,%rsp
+  802655:	6a 00                	push   $0x0
+  802657:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802668:	48 89 c2             	mov    %rax,%rdx
+  80266b:	be 01 00 00 00       	mov    $0x1,%esi
+  802670:	bf 03 00 00 00       	mov    $0x3,%edi
+  802675:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  802681:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802685:	c9                   	leave
+  802686:	c3                   	ret
+
+0000000000802687 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802687:	55                   	push   %rbp
+  802688:	48 89 e5             	mov    %rsp,%rbp
+  80268b:	48 83 ec 10          	sub    $0x10,%rsp
+  80268f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802692:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802695:	48 98                	cltq
+  802697:	48 83 ec 08          	sub    $0x8,%rsp
+  80269b:	6a 00                	push   $0x0
+  80269d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ae:	48 89 c2             	mov    %rax,%rdx
+  8026b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026bb:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+  8026c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026cb:	90                   	nop
+  8026cc:	c9                   	leave
+  8026cd:	c3                   	ret
+
+00000000008026ce <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8026ce:	55                   	push   %rbp
+  8026cf:	48 89 e5             	mov    %rsp,%rbp
+  8026d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8026d6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8026dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026e0:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8026e3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026e8:	cd 30                	int    $0x30
+  8026ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8026ee:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8026f2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8026f7:	7e 3d                	jle    802736 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8026f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026fd:	49 89 c0             	mov    %rax,%r8
+  802700:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802705:	48 b8 e8 67 80 00 00 	movabs $0x8067e8,%rax
+  80270c:	00 00 00 
+  80270f:	48 89 c2             	mov    %rax,%rdx
+  802712:	be 49 00 00 00       	mov    $0x49,%esi
+  802717:	48 b8 07 68 80 00 00 	movabs $0x806807,%rax
+  80271e:	00 00 00 
+  802721:	48 89 c7             	mov    %rax,%rdi
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+  802729:	49 b9 32 08 80 00 00 	movabs $0x800832,%r9
+  802730:	00 00 00 
+  802733:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802736:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80273b:	75 13                	jne    802750 <sys_env_wait+0x82>
+  80273d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802742:	74 0c                	je     802750 <sys_env_wait+0x82>
+    *status = st;
+  802744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802748:	89 c2                	mov    %eax,%edx
+  80274a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80274e:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802750:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802754:	c9                   	leave
+  802755:	c3                   	ret
+
+0000000000802756 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802756:	55                   	push   %rbp
+  802757:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80275a:	48 83 ec 08          	sub    $0x8,%rsp
+  80275e:	6a 00                	push   $0x0
+  802760:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80276c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802771:	ba 00 00 00 00       	mov    $0x0,%edx
+  802776:	be 00 00 00 00       	mov    $0x0,%esi
+  80277b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802780:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+  80278c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+
+0000000000802792 <sys_yield>:
+
+void
+sys_yield(void) {
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802796:	48 83 ec 08          	sub    $0x8,%rsp
+  80279a:	6a 00                	push   $0x0
+  80279c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b7:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8027bc:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027cc:	90                   	nop
+  8027cd:	c9                   	leave
+  8027ce:	c3                   	ret
+
+00000000008027cf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+  8027d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8027d7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027de:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8027e1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8027e4:	48 63 c8             	movslq %eax,%rcx
+  8027e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8027eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027ee:	48 98                	cltq
+  8027f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f4:	6a 00                	push   $0x0
+  8027f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027fc:	49 89 c8             	mov    %rcx,%r8
+  8027ff:	48 89 d1             	mov    %rdx,%rcx
+  802802:	48 89 c2             	mov    %rax,%rdx
+  802805:	be 01 00 00 00       	mov    $0x1,%esi
+  80280a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80280f:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	48 83 c4 10          	add    $0x10,%rsp
+  80281f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802822:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802825:	c9                   	leave
+  802826:	c3                   	ret
+
+0000000000802827 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	48 83 ec 20          	sub    $0x20,%rsp
+  80282f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802832:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802836:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802839:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80283d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802841:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802844:	48 63 c8             	movslq %eax,%rcx
+  802847:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80284b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80284e:	48 63 f0             	movslq %eax,%rsi
+  802851:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802855:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802858:	48 98                	cltq
+  80285a:	48 83 ec 08          	sub    $0x8,%rsp
+  80285e:	51                   	push   %rcx
+  80285f:	49 89 f9             	mov    %rdi,%r9
+  802862:	49 89 f0             	mov    %rsi,%r8
+  802865:	48 89 d1             	mov    %rdx,%rcx
+  802868:	48 89 c2             	mov    %rax,%rdx
+  80286b:	be 01 00 00 00       	mov    $0x1,%esi
+  802870:	bf 07 00 00 00       	mov    $0x7,%edi
+  802875:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+  802881:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+0000000000802887 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	48 83 ec 10          	sub    $0x10,%rsp
+  80288f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802892:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802896:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80289a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80289d:	48 98                	cltq
+  80289f:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b1:	48 89 d1             	mov    %rdx,%rcx
+  8028b4:	48 89 c2             	mov    %rax,%rdx
+  8028b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028bc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028c1:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  8028c8:	00 00 00 
+  8028cb:	ff d0                	call   *%rax
+  8028cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d1:	c9                   	leave
+  8028d2:	c3                   	ret
+
+00000000008028d3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8028d3:	55                   	push   %rbp
+  8028d4:	48 89 e5             	mov    %rsp,%rbp
+  8028d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8028db:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028de:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8028e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8028e4:	48 63 d0             	movslq %eax,%rdx
+  8028e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028ea:	48 98                	cltq
+  8028ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f0:	6a 00                	push   $0x0
+  8028f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028fe:	48 89 d1             	mov    %rdx,%rcx
+  802901:	48 89 c2             	mov    %rax,%rdx
+  802904:	be 01 00 00 00       	mov    $0x1,%esi
+  802909:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80290e:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802915:	00 00 00 
+  802918:	ff d0                	call   *%rax
+  80291a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80291e:	c9                   	leave
+  80291f:	c3                   	ret
+
+0000000000802920 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802920:	55                   	push   %rbp
+  802921:	48 89 e5             	mov    %rsp,%rbp
+  802924:	48 83 ec 10          	sub    $0x10,%rsp
+  802928:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80292b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80292f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802933:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802936:	48 98                	cltq
+  802938:	48 83 ec 08          	sub    $0x8,%rsp
+  80293c:	6a 00                	push   $0x0
+  80293e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802944:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80294a:	48 89 d1             	mov    %rdx,%rcx
+  80294d:	48 89 c2             	mov    %rax,%rdx
+  802950:	be 01 00 00 00       	mov    $0x1,%esi
+  802955:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80295a:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802961:	00 00 00 
+  802964:	ff d0                	call   *%rax
+  802966:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80296a:	c9                   	leave
+  80296b:	c3                   	ret
+
+000000000080296c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80296c:	55                   	push   %rbp
+  80296d:	48 89 e5             	mov    %rsp,%rbp
+  802970:	48 83 ec 10          	sub    $0x10,%rsp
+  802974:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802977:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80297b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80297f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802982:	48 98                	cltq
+  802984:	48 83 ec 08          	sub    $0x8,%rsp
+  802988:	6a 00                	push   $0x0
+  80298a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802990:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802996:	48 89 d1             	mov    %rdx,%rcx
+  802999:	48 89 c2             	mov    %rax,%rdx
+  80299c:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8029a6:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+  8029b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029b6:	c9                   	leave
+  8029b7:	c3                   	ret
+
+00000000008029b8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8029b8:	55                   	push   %rbp
+  8029b9:	48 89 e5             	mov    %rsp,%rbp
+  8029bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8029c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029c7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8029cb:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8029ce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8029d1:	48 63 f0             	movslq %eax,%rsi
+  8029d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029df:	48 98                	cltq
+  8029e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e5:	6a 00                	push   $0x0
+  8029e7:	49 89 f1             	mov    %rsi,%r9
+  8029ea:	49 89 c8             	mov    %rcx,%r8
+  8029ed:	48 89 d1             	mov    %rdx,%rcx
+  8029f0:	48 89 c2             	mov    %rax,%rdx
+  8029f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8029fd:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+0000000000802a0f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802a0f:	55                   	push   %rbp
+  802a10:	48 89 e5             	mov    %rsp,%rbp
+  802a13:	48 83 ec 10          	sub    $0x10,%rsp
+  802a17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802a1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a1f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a23:	6a 00                	push   $0x0
+  802a25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a36:	48 89 c2             	mov    %rax,%rdx
+  802a39:	be 01 00 00 00       	mov    $0x1,%esi
+  802a3e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a43:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802a4a:	00 00 00 
+  802a4d:	ff d0                	call   *%rax
+  802a4f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+
+0000000000802a55 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802a55:	55                   	push   %rbp
+  802a56:	48 89 e5             	mov    %rsp,%rbp
+  802a59:	48 83 ec 10          	sub    $0x10,%rsp
+  802a5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a61:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802a65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a6d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a71:	6a 00                	push   $0x0
+  802a73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a7f:	48 89 d1             	mov    %rdx,%rcx
+  802a82:	48 89 c2             	mov    %rax,%rdx
+  802a85:	be 01 00 00 00       	mov    $0x1,%esi
+  802a8a:	bf 10 00 00 00       	mov    $0x10,%edi
+  802a8f:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+  802a9b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a9f:	c9                   	leave
+  802aa0:	c3                   	ret
+
+0000000000802aa1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802aa1:	55                   	push   %rbp
+  802aa2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa9:	6a 00                	push   $0x0
+  802aab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ab1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ab7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac6:	bf 11 00 00 00       	mov    $0x11,%edi
+  802acb:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+  802ad7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+0000000000802add <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+  802ae1:	48 83 ec 10          	sub    $0x10,%rsp
+  802ae5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ae9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802aed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802af5:	48 83 ec 08          	sub    $0x8,%rsp
+  802af9:	6a 00                	push   $0x0
+  802afb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b07:	48 89 d1             	mov    %rdx,%rcx
+  802b0a:	48 89 c2             	mov    %rax,%rdx
+  802b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b12:	bf 12 00 00 00       	mov    $0x12,%edi
+  802b17:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+  802b23:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b27:	c9                   	leave
+  802b28:	c3                   	ret
+
+0000000000802b29 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802b29:	55                   	push   %rbp
+  802b2a:	48 89 e5             	mov    %rsp,%rbp
+  802b2d:	48 83 ec 20          	sub    $0x20,%rsp
+  802b31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b35:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b39:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802b3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b3f:	48 63 c8             	movslq %eax,%rcx
+  802b42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b4a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4e:	6a 00                	push   $0x0
+  802b50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b56:	49 89 c8             	mov    %rcx,%r8
+  802b59:	48 89 d1             	mov    %rdx,%rcx
+  802b5c:	48 89 c2             	mov    %rax,%rdx
+  802b5f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b64:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b69:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802b70:	00 00 00 
+  802b73:	ff d0                	call   *%rax
+  802b75:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b79:	c9                   	leave
+  802b7a:	c3                   	ret
+
+0000000000802b7b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+  802b7f:	48 83 ec 20          	sub    $0x20,%rsp
+  802b83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b87:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802b8a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802b8e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802b92:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802b95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b99:	48 83 ec 08          	sub    $0x8,%rsp
+  802b9d:	6a 00                	push   $0x0
+  802b9f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ba5:	49 89 c8             	mov    %rcx,%r8
+  802ba8:	48 89 d1             	mov    %rdx,%rcx
+  802bab:	48 89 c2             	mov    %rax,%rdx
+  802bae:	be 00 00 00 00       	mov    $0x0,%esi
+  802bb3:	bf 14 00 00 00       	mov    $0x14,%edi
+  802bb8:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802bbf:	00 00 00 
+  802bc2:	ff d0                	call   *%rax
+  802bc4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bc8:	c9                   	leave
+  802bc9:	c3                   	ret
+
+0000000000802bca <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802bca:	55                   	push   %rbp
+  802bcb:	48 89 e5             	mov    %rsp,%rbp
+  802bce:	48 83 ec 10          	sub    $0x10,%rsp
+  802bd2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bd6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802bd9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802bdc:	48 63 d0             	movslq %eax,%rdx
+  802bdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802be3:	48 83 ec 08          	sub    $0x8,%rsp
+  802be7:	6a 00                	push   $0x0
+  802be9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bf5:	48 89 d1             	mov    %rdx,%rcx
+  802bf8:	48 89 c2             	mov    %rax,%rdx
+  802bfb:	be 00 00 00 00       	mov    $0x0,%esi
+  802c00:	bf 15 00 00 00       	mov    $0x15,%edi
+  802c05:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802c0c:	00 00 00 
+  802c0f:	ff d0                	call   *%rax
+  802c11:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c15:	c9                   	leave
+  802c16:	c3                   	ret
+
+0000000000802c17 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802c17:	55                   	push   %rbp
+  802c18:	48 89 e5             	mov    %rsp,%rbp
+  802c1b:	48 83 ec 20          	sub    $0x20,%rsp
+  802c1f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c23:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802c26:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802c29:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802c2d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c31:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802c34:	48 63 c8             	movslq %eax,%rcx
+  802c37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802c3a:	48 63 d0             	movslq %eax,%rdx
+  802c3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c41:	48 83 ec 08          	sub    $0x8,%rsp
+  802c45:	6a 00                	push   $0x0
+  802c47:	49 89 f1             	mov    %rsi,%r9
+  802c4a:	49 89 c8             	mov    %rcx,%r8
+  802c4d:	48 89 d1             	mov    %rdx,%rcx
+  802c50:	48 89 c2             	mov    %rax,%rdx
+  802c53:	be 00 00 00 00       	mov    $0x0,%esi
+  802c58:	bf 16 00 00 00       	mov    $0x16,%edi
+  802c5d:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+  802c69:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c6d:	c9                   	leave
+  802c6e:	c3                   	ret
+
+0000000000802c6f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802c6f:	55                   	push   %rbp
+  802c70:	48 89 e5             	mov    %rsp,%rbp
+  802c73:	48 83 ec 30          	sub    $0x30,%rsp
+  802c77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c7f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802c83:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802c87:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802c8b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802c8f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802c93:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c97:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c9f:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca3:	51                   	push   %rcx
+  802ca4:	49 89 f9             	mov    %rdi,%r9
+  802ca7:	49 89 f0             	mov    %rsi,%r8
+  802caa:	48 89 d1             	mov    %rdx,%rcx
+  802cad:	48 89 c2             	mov    %rax,%rdx
+  802cb0:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb5:	bf 17 00 00 00       	mov    $0x17,%edi
+  802cba:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+  802cc6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cca:	c9                   	leave
+  802ccb:	c3                   	ret
+
+0000000000802ccc <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802ccc:	55                   	push   %rbp
+  802ccd:	48 89 e5             	mov    %rsp,%rbp
+  802cd0:	48 83 ec 10          	sub    $0x10,%rsp
+  802cd4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802cd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cda:	48 98                	cltq
+  802cdc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce0:	6a 00                	push   $0x0
+  802ce2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ce8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cf3:	48 89 c2             	mov    %rax,%rdx
+  802cf6:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfb:	bf 18 00 00 00       	mov    $0x18,%edi
+  802d00:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d10:	90                   	nop
+  802d11:	c9                   	leave
+  802d12:	c3                   	ret
+
+0000000000802d13 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802d13:	55                   	push   %rbp
+  802d14:	48 89 e5             	mov    %rsp,%rbp
+  802d17:	48 83 ec 30          	sub    $0x30,%rsp
+  802d1b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d1e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802d22:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802d26:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802d29:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d2c:	48 63 f0             	movslq %eax,%rsi
+  802d2f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802d33:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d3a:	48 98                	cltq
+  802d3c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d40:	6a 00                	push   $0x0
+  802d42:	49 89 f1             	mov    %rsi,%r9
+  802d45:	49 89 c8             	mov    %rcx,%r8
+  802d48:	48 89 d1             	mov    %rdx,%rcx
+  802d4b:	48 89 c2             	mov    %rax,%rdx
+  802d4e:	be 01 00 00 00       	mov    $0x1,%esi
+  802d53:	bf 19 00 00 00       	mov    $0x19,%edi
+  802d58:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+  802d64:	48 83 c4 10          	add    $0x10,%rsp
+  802d68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802d6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d6e:	c9                   	leave
+  802d6f:	c3                   	ret
+
+0000000000802d70 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802d70:	55                   	push   %rbp
+  802d71:	48 89 e5             	mov    %rsp,%rbp
+  802d74:	48 83 ec 20          	sub    $0x20,%rsp
+  802d78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d7c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d80:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802d83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d86:	48 63 c8             	movslq %eax,%rcx
+  802d89:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d91:	48 83 ec 08          	sub    $0x8,%rsp
+  802d95:	6a 00                	push   $0x0
+  802d97:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d9d:	49 89 c8             	mov    %rcx,%r8
+  802da0:	48 89 d1             	mov    %rdx,%rcx
+  802da3:	48 89 c2             	mov    %rax,%rdx
+  802da6:	be 01 00 00 00       	mov    $0x1,%esi
+  802dab:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802db0:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802db7:	00 00 00 
+  802dba:	ff d0                	call   *%rax
+  802dbc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dc0:	c9                   	leave
+  802dc1:	c3                   	ret
+
+0000000000802dc2 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802dc2:	55                   	push   %rbp
+  802dc3:	48 89 e5             	mov    %rsp,%rbp
+  802dc6:	48 83 ec 20          	sub    $0x20,%rsp
+  802dca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802dce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802dd2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802dd6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802dda:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802dde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802de2:	48 83 ec 08          	sub    $0x8,%rsp
+  802de6:	6a 00                	push   $0x0
+  802de8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dee:	49 89 c8             	mov    %rcx,%r8
+  802df1:	48 89 d1             	mov    %rdx,%rcx
+  802df4:	48 89 c2             	mov    %rax,%rdx
+  802df7:	be 01 00 00 00       	mov    $0x1,%esi
+  802dfc:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802e01:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802e08:	00 00 00 
+  802e0b:	ff d0                	call   *%rax
+  802e0d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e11:	c9                   	leave
+  802e12:	c3                   	ret
+
+0000000000802e13 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802e13:	55                   	push   %rbp
+  802e14:	48 89 e5             	mov    %rsp,%rbp
+  802e17:	48 83 ec 30          	sub    $0x30,%rsp
+  802e1b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e1f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e23:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802e26:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802e2a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e31:	48 63 c8             	movslq %eax,%rcx
+  802e34:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e40:	6a 00                	push   $0x0
+  802e42:	49 89 f1             	mov    %rsi,%r9
+  802e45:	49 89 c8             	mov    %rcx,%r8
+  802e48:	48 89 d1             	mov    %rdx,%rcx
+  802e4b:	48 89 c2             	mov    %rax,%rdx
+  802e4e:	be 01 00 00 00       	mov    $0x1,%esi
+  802e53:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802e58:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+  802e64:	48 83 c4 10          	add    $0x10,%rsp
+  802e68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802e6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+0000000000802e70 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+  802e74:	48 83 ec 10          	sub    $0x10,%rsp
+  802e78:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e7e:	48 98                	cltq
+  802e80:	48 83 ec 08          	sub    $0x8,%rsp
+  802e84:	6a 00                	push   $0x0
+  802e86:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e97:	48 89 c2             	mov    %rax,%rdx
+  802e9a:	be 01 00 00 00       	mov    $0x1,%esi
+  802e9f:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802ea4:	48 b8 1f 25 80 00 00 	movabs $0x80251f,%rax
+  802eab:	00 00 00 
+  802eae:	ff d0                	call   *%rax
+  802eb0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802eb4:	c9                   	leave
+  802eb5:	c3                   	ret
+
+0000000000802eb6 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802eb6:	55                   	push   %rbp
+  802eb7:	48 89 e5             	mov    %rsp,%rbp
+  802eba:	48 83 ec 08          	sub    $0x8,%rsp
+  802ebe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802ec2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ec6:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802ecd:	ff ff ff 
+  802ed0:	48 01 d0             	add    %rdx,%rax
+  802ed3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802ed7:	c9                   	leave
+  802ed8:	c3                   	ret
+
+0000000000802ed9 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802ed9:	55                   	push   %rbp
+  802eda:	48 89 e5             	mov    %rsp,%rbp
+  802edd:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802ee5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ee9:	48 89 c7             	mov    %rax,%rdi
+  802eec:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  802ef3:	00 00 00 
+  802ef6:	ff d0                	call   *%rax
+  802ef8:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802efe:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802f02:	c9                   	leave
+  802f03:	c3                   	ret
+
+0000000000802f04 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802f04:	55                   	push   %rbp
+  802f05:	48 89 e5             	mov    %rsp,%rbp
+  802f08:	48 83 ec 18          	sub    $0x18,%rsp
+  802f0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802f10:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f17:	e9 ae 00 00 00       	jmp    802fca <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802f1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f1f:	c1 e0 0c             	shl    $0xc,%eax
+  802f22:	48 98                	cltq
+  802f24:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802f29:	48 01 d0             	add    %rdx,%rax
+  802f2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802f30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f34:	48 c1 e8 27          	shr    $0x27,%rax
+  802f38:	48 89 c2             	mov    %rax,%rdx
+  802f3b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f42:	01 00 00 
+  802f45:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f49:	83 e0 01             	and    $0x1,%eax
+  802f4c:	48 85 c0             	test   %rax,%rax
+  802f4f:	74 63                	je     802fb4 <fd_alloc+0xb0>
+  802f51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f55:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f59:	48 89 c2             	mov    %rax,%rdx
+  802f5c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f63:	01 00 00 
+  802f66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f6a:	83 e0 01             	and    $0x1,%eax
+  802f6d:	48 85 c0             	test   %rax,%rax
+  802f70:	74 42                	je     802fb4 <fd_alloc+0xb0>
+  802f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f76:	48 c1 e8 15          	shr    $0x15,%rax
+  802f7a:	48 89 c2             	mov    %rax,%rdx
+  802f7d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f84:	01 00 00 
+  802f87:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f8b:	83 e0 01             	and    $0x1,%eax
+  802f8e:	48 85 c0             	test   %rax,%rax
+  802f91:	74 21                	je     802fb4 <fd_alloc+0xb0>
+  802f93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f97:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f9b:	48 89 c2             	mov    %rax,%rdx
+  802f9e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fa5:	01 00 00 
+  802fa8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fac:	83 e0 01             	and    $0x1,%eax
+  802faf:	48 85 c0             	test   %rax,%rax
+  802fb2:	75 12                	jne    802fc6 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802fb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fb8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802fbc:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc4:	eb 1e                	jmp    802fe4 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802fc6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802fca:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802fce:	0f 8e 48 ff ff ff    	jle    802f1c <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802fdf:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	48 83 ec 20          	sub    $0x20,%rsp
+  802fee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ff1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802ff5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ff9:	78 06                	js     803001 <fd_lookup+0x1b>
+  802ffb:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802fff:	7e 0a                	jle    80300b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803001:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803006:	e9 af 00 00 00       	jmp    8030ba <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80300b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80300e:	c1 e0 0c             	shl    $0xc,%eax
+  803011:	48 98                	cltq
+  803013:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803018:	48 01 d0             	add    %rdx,%rax
+  80301b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80301f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803023:	48 c1 e8 27          	shr    $0x27,%rax
+  803027:	48 89 c2             	mov    %rax,%rdx
+  80302a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803031:	01 00 00 
+  803034:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803038:	83 e0 01             	and    $0x1,%eax
+  80303b:	48 85 c0             	test   %rax,%rax
+  80303e:	74 63                	je     8030a3 <fd_lookup+0xbd>
+  803040:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803044:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803048:	48 89 c2             	mov    %rax,%rdx
+  80304b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803052:	01 00 00 
+  803055:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803059:	83 e0 01             	and    $0x1,%eax
+  80305c:	48 85 c0             	test   %rax,%rax
+  80305f:	74 42                	je     8030a3 <fd_lookup+0xbd>
+  803061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803065:	48 c1 e8 15          	shr    $0x15,%rax
+  803069:	48 89 c2             	mov    %rax,%rdx
+  80306c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803073:	01 00 00 
+  803076:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80307a:	83 e0 01             	and    $0x1,%eax
+  80307d:	48 85 c0             	test   %rax,%rax
+  803080:	74 21                	je     8030a3 <fd_lookup+0xbd>
+  803082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803086:	48 c1 e8 0c          	shr    $0xc,%rax
+  80308a:	48 89 c2             	mov    %rax,%rdx
+  80308d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803094:	01 00 00 
+  803097:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80309b:	83 e0 01             	and    $0x1,%eax
+  80309e:	48 85 c0             	test   %rax,%rax
+  8030a1:	75 07                	jne    8030aa <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8030a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030a8:	eb 10                	jmp    8030ba <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8030aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030b2:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8030b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ba:	c9                   	leave
+  8030bb:	c3                   	ret
+
+00000000008030bc <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8030bc:	55                   	push   %rbp
+  8030bd:	48 89 e5             	mov    %rsp,%rbp
+  8030c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8030c4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8030c8:	89 f0                	mov    %esi,%eax
+  8030ca:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8030cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030d1:	48 89 c7             	mov    %rax,%rdi
+  8030d4:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  8030db:	00 00 00 
+  8030de:	ff d0                	call   *%rax
+  8030e0:	89 c2                	mov    %eax,%edx
+  8030e2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8030e6:	48 89 c6             	mov    %rax,%rsi
+  8030e9:	89 d7                	mov    %edx,%edi
+  8030eb:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8030f2:	00 00 00 
+  8030f5:	ff d0                	call   *%rax
+  8030f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030fe:	78 0a                	js     80310a <fd_close+0x4e>
+  803100:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803104:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803108:	74 12                	je     80311c <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80310a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80310e:	74 05                	je     803115 <fd_close+0x59>
+  803110:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803113:	eb 70                	jmp    803185 <fd_close+0xc9>
+  803115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311a:	eb 69                	jmp    803185 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80311c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803120:	8b 00                	mov    (%rax),%eax
+  803122:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803126:	48 89 d6             	mov    %rdx,%rsi
+  803129:	89 c7                	mov    %eax,%edi
+  80312b:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+  803137:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80313a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80313e:	78 2a                	js     80316a <fd_close+0xae>
+    if (dev->dev_close)
+  803140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803144:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803148:	48 85 c0             	test   %rax,%rax
+  80314b:	74 16                	je     803163 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80314d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803151:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803159:	48 89 c7             	mov    %rax,%rdi
+  80315c:	ff d2                	call   *%rdx
+  80315e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803161:	eb 07                	jmp    80316a <fd_close+0xae>
+    else
+      r = 0;
+  803163:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80316a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80316e:	48 89 c6             	mov    %rax,%rsi
+  803171:	bf 00 00 00 00       	mov    $0x0,%edi
+  803176:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  return r;
+  803182:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803185:	c9                   	leave
+  803186:	c3                   	ret
+
+0000000000803187 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803187:	55                   	push   %rbp
+  803188:	48 89 e5             	mov    %rsp,%rbp
+  80318b:	48 83 ec 20          	sub    $0x20,%rsp
+  80318f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803192:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803196:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80319d:	eb 3f                	jmp    8031de <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80319f:	48 ba e0 87 80 00 00 	movabs $0x8087e0,%rdx
+  8031a6:	00 00 00 
+  8031a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031ac:	48 98                	cltq
+  8031ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031b2:	8b 00                	mov    (%rax),%eax
+  8031b4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8031b7:	75 21                	jne    8031da <dev_lookup+0x53>
+      *dev = devtab[i];
+  8031b9:	48 ba e0 87 80 00 00 	movabs $0x8087e0,%rdx
+  8031c0:	00 00 00 
+  8031c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031c6:	48 98                	cltq
+  8031c8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031d0:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	eb 7f                	jmp    803259 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8031da:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8031de:	48 ba e0 87 80 00 00 	movabs $0x8087e0,%rdx
+  8031e5:	00 00 00 
+  8031e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031eb:	48 98                	cltq
+  8031ed:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031f1:	48 85 c0             	test   %rax,%rax
+  8031f4:	75 a9                	jne    80319f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031f6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031fd:	00 00 00 
+  803200:	8b 40 04             	mov    0x4(%rax),%eax
+  803203:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803208:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80320f:	00 00 00 
+  803212:	48 98                	cltq
+  803214:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80321b:	48 01 d0             	add    %rdx,%rax
+  80321e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803224:	8b 00                	mov    (%rax),%eax
+  803226:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803229:	89 c6                	mov    %eax,%esi
+  80322b:	48 b8 18 68 80 00 00 	movabs $0x806818,%rax
+  803232:	00 00 00 
+  803235:	48 89 c7             	mov    %rax,%rdi
+  803238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80323d:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  803244:	00 00 00 
+  803247:	ff d1                	call   *%rcx
+  *dev = 0;
+  803249:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80324d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803254:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803259:	c9                   	leave
+  80325a:	c3                   	ret
+
+000000000080325b <close>:
+
+int
+close(int fdnum) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	48 83 ec 20          	sub    $0x20,%rsp
+  803263:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803266:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80326a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80326d:	48 89 d6             	mov    %rdx,%rsi
+  803270:	89 c7                	mov    %eax,%edi
+  803272:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803281:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803285:	79 05                	jns    80328c <close+0x31>
+    return r;
+  803287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80328a:	eb 18                	jmp    8032a4 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80328c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803290:	be 01 00 00 00       	mov    $0x1,%esi
+  803295:	48 89 c7             	mov    %rax,%rdi
+  803298:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+00000000008032a6 <close_all>:
+
+void
+close_all(void) {
+  8032a6:	55                   	push   %rbp
+  8032a7:	48 89 e5             	mov    %rsp,%rbp
+  8032aa:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8032ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032b5:	eb 15                	jmp    8032cc <close_all+0x26>
+    close(i);
+  8032b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032ba:	89 c7                	mov    %eax,%edi
+  8032bc:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  8032c3:	00 00 00 
+  8032c6:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8032c8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032cc:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8032d0:	7e e5                	jle    8032b7 <close_all+0x11>
+}
+  8032d2:	90                   	nop
+  8032d3:	90                   	nop
+  8032d4:	c9                   	leave
+  8032d5:	c3                   	ret
+
+00000000008032d6 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8032d6:	55                   	push   %rbp
+  8032d7:	48 89 e5             	mov    %rsp,%rbp
+  8032da:	48 83 ec 40          	sub    $0x40,%rsp
+  8032de:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032e1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8032e4:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8032e8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032eb:	48 89 d6             	mov    %rdx,%rsi
+  8032ee:	89 c7                	mov    %eax,%edi
+  8032f0:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8032f7:	00 00 00 
+  8032fa:	ff d0                	call   *%rax
+  8032fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803303:	79 08                	jns    80330d <dup+0x37>
+    return r;
+  803305:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803308:	e9 33 02 00 00       	jmp    803540 <dup+0x26a>
+  close(newfdnum);
+  80330d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803310:	89 c7                	mov    %eax,%edi
+  803312:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  803319:	00 00 00 
+  80331c:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  80331e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803321:	c1 e0 0c             	shl    $0xc,%eax
+  803324:	48 98                	cltq
+  803326:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80332b:	48 01 d0             	add    %rdx,%rax
+  80332e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803332:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803336:	48 89 c7             	mov    %rax,%rdi
+  803339:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  803340:	00 00 00 
+  803343:	ff d0                	call   *%rax
+  803345:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803349:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80334d:	48 89 c7             	mov    %rax,%rdi
+  803350:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  803357:	00 00 00 
+  80335a:	ff d0                	call   *%rax
+  80335c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803360:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803367:	00 
+  803368:	e9 19 01 00 00       	jmp    803486 <dup+0x1b0>
+    off -= PGSIZE;
+  80336d:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803374:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803375:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803379:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80337d:	48 01 d0             	add    %rdx,%rax
+  803380:	48 c1 e8 27          	shr    $0x27,%rax
+  803384:	48 89 c2             	mov    %rax,%rdx
+  803387:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80338e:	01 00 00 
+  803391:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803395:	83 e0 01             	and    $0x1,%eax
+  803398:	48 85 c0             	test   %rax,%rax
+  80339b:	0f 84 e5 00 00 00    	je     803486 <dup+0x1b0>
+  8033a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033a9:	48 01 d0             	add    %rdx,%rax
+  8033ac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033b0:	48 89 c2             	mov    %rax,%rdx
+  8033b3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033ba:	01 00 00 
+  8033bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c1:	83 e0 01             	and    $0x1,%eax
+  8033c4:	48 85 c0             	test   %rax,%rax
+  8033c7:	0f 84 b9 00 00 00    	je     803486 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8033cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033d5:	48 01 d0             	add    %rdx,%rax
+  8033d8:	48 c1 e8 15          	shr    $0x15,%rax
+  8033dc:	48 89 c2             	mov    %rax,%rdx
+  8033df:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8033e6:	01 00 00 
+  8033e9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ed:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8033f0:	48 85 c0             	test   %rax,%rax
+  8033f3:	0f 84 8d 00 00 00    	je     803486 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8033f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803401:	48 01 d0             	add    %rdx,%rax
+  803404:	48 c1 e8 0c          	shr    $0xc,%rax
+  803408:	48 89 c2             	mov    %rax,%rdx
+  80340b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803412:	01 00 00 
+  803415:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803419:	83 e0 01             	and    $0x1,%eax
+  80341c:	48 85 c0             	test   %rax,%rax
+  80341f:	74 65                	je     803486 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803421:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803425:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803429:	48 01 d0             	add    %rdx,%rax
+  80342c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803430:	48 89 c2             	mov    %rax,%rdx
+  803433:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80343a:	01 00 00 
+  80343d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803441:	25 07 0e 00 00       	and    $0xe07,%eax
+  803446:	89 c6                	mov    %eax,%esi
+  803448:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80344c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803450:	48 01 c2             	add    %rax,%rdx
+  803453:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803457:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80345b:	48 01 c8             	add    %rcx,%rax
+  80345e:	41 89 f0             	mov    %esi,%r8d
+  803461:	48 89 d1             	mov    %rdx,%rcx
+  803464:	ba 00 00 00 00       	mov    $0x0,%edx
+  803469:	48 89 c6             	mov    %rax,%rsi
+  80346c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803471:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803480:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803484:	78 60                	js     8034e6 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803486:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80348b:	0f 85 dc fe ff ff    	jne    80336d <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803491:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803495:	48 c1 e8 0c          	shr    $0xc,%rax
+  803499:	48 89 c2             	mov    %rax,%rdx
+  80349c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034a3:	01 00 00 
+  8034a6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034af:	89 c1                	mov    %eax,%ecx
+  8034b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8034b9:	41 89 c8             	mov    %ecx,%r8d
+  8034bc:	48 89 d1             	mov    %rdx,%rcx
+  8034bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034c4:	48 89 c6             	mov    %rax,%rsi
+  8034c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cc:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8034d3:	00 00 00 
+  8034d6:	ff d0                	call   *%rax
+  8034d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034df:	78 08                	js     8034e9 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8034e1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8034e4:	eb 5a                	jmp    803540 <dup+0x26a>
+        goto err;
+  8034e6:	90                   	nop
+  8034e7:	eb 01                	jmp    8034ea <dup+0x214>
+    goto err;
+  8034e9:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8034ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ee:	48 89 c6             	mov    %rax,%rsi
+  8034f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f6:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803502:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803509:	00 
+  80350a:	eb 27                	jmp    803533 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80350c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803510:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803514:	48 01 d0             	add    %rdx,%rax
+  803517:	48 89 c6             	mov    %rax,%rsi
+  80351a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351f:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80352b:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803532:	00 
+  803533:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80353a:	00 
+  80353b:	76 cf                	jbe    80350c <dup+0x236>
+  return r;
+  80353d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803540:	c9                   	leave
+  803541:	c3                   	ret
+
+0000000000803542 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803542:	55                   	push   %rbp
+  803543:	48 89 e5             	mov    %rsp,%rbp
+  803546:	48 83 ec 40          	sub    $0x40,%rsp
+  80354a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80354d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803551:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803555:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803559:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80355c:	48 89 d6             	mov    %rdx,%rsi
+  80355f:	89 c7                	mov    %eax,%edi
+  803561:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+  80356d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803570:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803574:	78 24                	js     80359a <read+0x58>
+  803576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80357a:	8b 00                	mov    (%rax),%eax
+  80357c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803580:	48 89 d6             	mov    %rdx,%rsi
+  803583:	89 c7                	mov    %eax,%edi
+  803585:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  80358c:	00 00 00 
+  80358f:	ff d0                	call   *%rax
+  803591:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803594:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803598:	79 0a                	jns    8035a4 <read+0x62>
+    return r;
+  80359a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80359d:	48 98                	cltq
+  80359f:	e9 9e 00 00 00       	jmp    803642 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8035a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a8:	8b 40 08             	mov    0x8(%rax),%eax
+  8035ab:	83 e0 03             	and    $0x3,%eax
+  8035ae:	83 f8 01             	cmp    $0x1,%eax
+  8035b1:	75 5c                	jne    80360f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8035b3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8035ba:	00 00 00 
+  8035bd:	8b 40 04             	mov    0x4(%rax),%eax
+  8035c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035c5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035cc:	00 00 00 
+  8035cf:	48 98                	cltq
+  8035d1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035d8:	48 01 d0             	add    %rdx,%rax
+  8035db:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035e1:	8b 00                	mov    (%rax),%eax
+  8035e3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8035e6:	89 c6                	mov    %eax,%esi
+  8035e8:	48 b8 37 68 80 00 00 	movabs $0x806837,%rax
+  8035ef:	00 00 00 
+  8035f2:	48 89 c7             	mov    %rax,%rdi
+  8035f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035fa:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  803601:	00 00 00 
+  803604:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803606:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80360d:	eb 33                	jmp    803642 <read+0x100>
+  }
+  if (!dev->dev_read)
+  80360f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803613:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803617:	48 85 c0             	test   %rax,%rax
+  80361a:	75 09                	jne    803625 <read+0xe3>
+    return -E_NOT_SUPP;
+  80361c:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803623:	eb 1d                	jmp    803642 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803625:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803629:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80362d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803631:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803635:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803639:	48 89 ce             	mov    %rcx,%rsi
+  80363c:	48 89 c7             	mov    %rax,%rdi
+  80363f:	41 ff d0             	call   *%r8
+}
+  803642:	c9                   	leave
+  803643:	c3                   	ret
+
+0000000000803644 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803644:	55                   	push   %rbp
+  803645:	48 89 e5             	mov    %rsp,%rbp
+  803648:	48 83 ec 30          	sub    $0x30,%rsp
+  80364c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80364f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803653:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803657:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80365e:	eb 49                	jmp    8036a9 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803660:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803663:	48 98                	cltq
+  803665:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803669:	48 29 c2             	sub    %rax,%rdx
+  80366c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80366f:	48 63 c8             	movslq %eax,%rcx
+  803672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803676:	48 01 c1             	add    %rax,%rcx
+  803679:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80367c:	48 89 ce             	mov    %rcx,%rsi
+  80367f:	89 c7                	mov    %eax,%edi
+  803681:	48 b8 42 35 80 00 00 	movabs $0x803542,%rax
+  803688:	00 00 00 
+  80368b:	ff d0                	call   *%rax
+  80368d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803690:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803694:	79 07                	jns    80369d <readn+0x59>
+      return m;
+  803696:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803699:	48 98                	cltq
+  80369b:	eb 1f                	jmp    8036bc <readn+0x78>
+    if (m == 0)
+  80369d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8036a1:	74 13                	je     8036b6 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8036a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8036a6:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8036a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036ac:	48 98                	cltq
+  8036ae:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8036b2:	72 ac                	jb     803660 <readn+0x1c>
+  8036b4:	eb 01                	jmp    8036b7 <readn+0x73>
+      break;
+  8036b6:	90                   	nop
+  }
+  return tot;
+  8036b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036ba:	48 98                	cltq
+}
+  8036bc:	c9                   	leave
+  8036bd:	c3                   	ret
+
+00000000008036be <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8036be:	55                   	push   %rbp
+  8036bf:	48 89 e5             	mov    %rsp,%rbp
+  8036c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8036c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8036cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8036d1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8036d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036d8:	48 89 d6             	mov    %rdx,%rsi
+  8036db:	89 c7                	mov    %eax,%edi
+  8036dd:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8036e4:	00 00 00 
+  8036e7:	ff d0                	call   *%rax
+  8036e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036f0:	78 24                	js     803716 <write+0x58>
+  8036f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036f6:	8b 00                	mov    (%rax),%eax
+  8036f8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8036fc:	48 89 d6             	mov    %rdx,%rsi
+  8036ff:	89 c7                	mov    %eax,%edi
+  803701:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  803708:	00 00 00 
+  80370b:	ff d0                	call   *%rax
+  80370d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803710:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803714:	79 0a                	jns    803720 <write+0x62>
+    return r;
+  803716:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803719:	48 98                	cltq
+  80371b:	e9 9d 00 00 00       	jmp    8037bd <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803724:	8b 40 08             	mov    0x8(%rax),%eax
+  803727:	83 e0 03             	and    $0x3,%eax
+  80372a:	85 c0                	test   %eax,%eax
+  80372c:	75 5c                	jne    80378a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80372e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803735:	00 00 00 
+  803738:	8b 40 04             	mov    0x4(%rax),%eax
+  80373b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803740:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803747:	00 00 00 
+  80374a:	48 98                	cltq
+  80374c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803753:	48 01 d0             	add    %rdx,%rax
+  803756:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80375c:	8b 00                	mov    (%rax),%eax
+  80375e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803761:	89 c6                	mov    %eax,%esi
+  803763:	48 b8 53 68 80 00 00 	movabs $0x806853,%rax
+  80376a:	00 00 00 
+  80376d:	48 89 c7             	mov    %rax,%rdi
+  803770:	b8 00 00 00 00       	mov    $0x0,%eax
+  803775:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  80377c:	00 00 00 
+  80377f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803781:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803788:	eb 33                	jmp    8037bd <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80378a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80378e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803792:	48 85 c0             	test   %rax,%rax
+  803795:	75 09                	jne    8037a0 <write+0xe2>
+    return -E_NOT_SUPP;
+  803797:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80379e:	eb 1d                	jmp    8037bd <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8037a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037a4:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8037a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037ac:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037b0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8037b4:	48 89 ce             	mov    %rcx,%rsi
+  8037b7:	48 89 c7             	mov    %rax,%rdi
+  8037ba:	41 ff d0             	call   *%r8
+}
+  8037bd:	c9                   	leave
+  8037be:	c3                   	ret
+
+00000000008037bf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8037bf:	55                   	push   %rbp
+  8037c0:	48 89 e5             	mov    %rsp,%rbp
+  8037c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8037c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8037ca:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037cd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8037d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037d4:	48 89 d6             	mov    %rdx,%rsi
+  8037d7:	89 c7                	mov    %eax,%edi
+  8037d9:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+  8037e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037ec:	79 05                	jns    8037f3 <seek+0x34>
+    return r;
+  8037ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037f1:	eb 0f                	jmp    803802 <seek+0x43>
+  fd->fd_offset = offset;
+  8037f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037f7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8037fa:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8037fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803802:	c9                   	leave
+  803803:	c3                   	ret
+
+0000000000803804 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803804:	55                   	push   %rbp
+  803805:	48 89 e5             	mov    %rsp,%rbp
+  803808:	48 83 ec 30          	sub    $0x30,%rsp
+  80380c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80380f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803812:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803816:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803819:	48 89 d6             	mov    %rdx,%rsi
+  80381c:	89 c7                	mov    %eax,%edi
+  80381e:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803825:	00 00 00 
+  803828:	ff d0                	call   *%rax
+  80382a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80382d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803831:	78 24                	js     803857 <ftruncate+0x53>
+  803833:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803837:	8b 00                	mov    (%rax),%eax
+  803839:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80383d:	48 89 d6             	mov    %rdx,%rsi
+  803840:	89 c7                	mov    %eax,%edi
+  803842:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+  80384e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803851:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803855:	79 08                	jns    80385f <ftruncate+0x5b>
+    return r;
+  803857:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80385a:	e9 92 00 00 00       	jmp    8038f1 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80385f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803863:	8b 40 08             	mov    0x8(%rax),%eax
+  803866:	83 e0 03             	and    $0x3,%eax
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	75 5a                	jne    8038c7 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80386d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803874:	00 00 00 
+  803877:	8b 40 04             	mov    0x4(%rax),%eax
+  80387a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80387f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803886:	00 00 00 
+  803889:	48 98                	cltq
+  80388b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803892:	48 01 d0             	add    %rdx,%rax
+  803895:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80389b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80389d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038a0:	89 c6                	mov    %eax,%esi
+  8038a2:	48 b8 70 68 80 00 00 	movabs $0x806870,%rax
+  8038a9:	00 00 00 
+  8038ac:	48 89 c7             	mov    %rax,%rdi
+  8038af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b4:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  8038bb:	00 00 00 
+  8038be:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8038c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038c5:	eb 2a                	jmp    8038f1 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8038c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038cb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8038cf:	48 85 c0             	test   %rax,%rax
+  8038d2:	75 07                	jne    8038db <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8038d4:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8038d9:	eb 16                	jmp    8038f1 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8038db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038df:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8038e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8038ea:	89 d6                	mov    %edx,%esi
+  8038ec:	48 89 c7             	mov    %rax,%rdi
+  8038ef:	ff d1                	call   *%rcx
+}
+  8038f1:	c9                   	leave
+  8038f2:	c3                   	ret
+
+00000000008038f3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	48 83 ec 30          	sub    $0x30,%rsp
+  8038fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803902:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803906:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803909:	48 89 d6             	mov    %rdx,%rsi
+  80390c:	89 c7                	mov    %eax,%edi
+  80390e:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803915:	00 00 00 
+  803918:	ff d0                	call   *%rax
+  80391a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80391d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803921:	78 24                	js     803947 <fstat+0x54>
+  803923:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803927:	8b 00                	mov    (%rax),%eax
+  803929:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80392d:	48 89 d6             	mov    %rdx,%rsi
+  803930:	89 c7                	mov    %eax,%edi
+  803932:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  803939:	00 00 00 
+  80393c:	ff d0                	call   *%rax
+  80393e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803941:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803945:	79 05                	jns    80394c <fstat+0x59>
+    return r;
+  803947:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80394a:	eb 5e                	jmp    8039aa <fstat+0xb7>
+  if (!dev->dev_stat)
+  80394c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803950:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803954:	48 85 c0             	test   %rax,%rax
+  803957:	75 07                	jne    803960 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803959:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80395e:	eb 4a                	jmp    8039aa <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803960:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803964:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803967:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80396b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803972:	00 00 00 
+  stat->st_isdir   = 0;
+  803975:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803979:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803980:	00 00 00 
+  stat->st_dev     = dev;
+  803983:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803987:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80398b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803996:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80399a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80399e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8039a2:	48 89 d6             	mov    %rdx,%rsi
+  8039a5:	48 89 c7             	mov    %rax,%rdi
+  8039a8:	ff d1                	call   *%rcx
+}
+  8039aa:	c9                   	leave
+  8039ab:	c3                   	ret
+
+00000000008039ac <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8039ac:	55                   	push   %rbp
+  8039ad:	48 89 e5             	mov    %rsp,%rbp
+  8039b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8039b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8039b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8039bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039c0:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8039c6:	83 f8 20             	cmp    $0x20,%eax
+  8039c9:	75 07                	jne    8039d2 <pollwait_key+0x26>
+    return -E_INVAL;
+  8039cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039d0:	eb 5f                	jmp    803a31 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8039d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039d6:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8039dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039e0:	48 63 d2             	movslq %edx,%rdx
+  8039e3:	48 c1 e2 04          	shl    $0x4,%rdx
+  8039e7:	48 01 c2             	add    %rax,%rdx
+  8039ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ee:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8039f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f5:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8039fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ff:	8b 00                	mov    (%rax),%eax
+  803a01:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a05:	48 63 c9             	movslq %ecx,%rcx
+  803a08:	48 c1 e1 04          	shl    $0x4,%rcx
+  803a0c:	48 01 ca             	add    %rcx,%rdx
+  803a0f:	48 83 c2 08          	add    $0x8,%rdx
+  803a13:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803a15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a19:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a1f:	8d 50 01             	lea    0x1(%rax),%edx
+  803a22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a26:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a31:	c9                   	leave
+  803a32:	c3                   	ret
+
+0000000000803a33 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803a33:	55                   	push   %rbp
+  803a34:	48 89 e5             	mov    %rsp,%rbp
+  803a37:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803a3e:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803a45:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803a4b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803a52:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a59:	00 
+  int i, r, ready, ipc = 0;
+  803a5a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803a61:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803a68:	00 
+  803a69:	74 45                	je     803ab0 <poll+0x7d>
+  803a6b:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803a72:	ff 
+  803a73:	74 3b                	je     803ab0 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803a75:	48 b8 4b 5d 80 00 00 	movabs $0x805d4b,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+  803a81:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803a85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a89:	48 f7 d0             	not    %rax
+  803a8c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803a93:	73 10                	jae    803aa5 <poll+0x72>
+  803a95:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a99:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803aa0:	48 01 d0             	add    %rdx,%rax
+  803aa3:	eb 07                	jmp    803aac <poll+0x79>
+  803aa5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803aac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803ab0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803ab7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803abe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803ac5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803acc:	e9 46 02 00 00       	jmp    803d17 <poll+0x2e4>
+      fds[i].revents = 0;
+  803ad1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ad4:	48 63 d0             	movslq %eax,%rdx
+  803ad7:	48 89 d0             	mov    %rdx,%rax
+  803ada:	48 01 c0             	add    %rax,%rax
+  803add:	48 01 d0             	add    %rdx,%rax
+  803ae0:	48 c1 e0 02          	shl    $0x2,%rax
+  803ae4:	48 89 c2             	mov    %rax,%rdx
+  803ae7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803aee:	48 01 d0             	add    %rdx,%rax
+  803af1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803af8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803afb:	48 63 d0             	movslq %eax,%rdx
+  803afe:	48 89 d0             	mov    %rdx,%rax
+  803b01:	48 01 c0             	add    %rax,%rax
+  803b04:	48 01 d0             	add    %rdx,%rax
+  803b07:	48 c1 e0 02          	shl    $0x2,%rax
+  803b0b:	48 89 c2             	mov    %rax,%rdx
+  803b0e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b15:	48 01 d0             	add    %rdx,%rax
+  803b18:	8b 00                	mov    (%rax),%eax
+  803b1a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803b1d:	75 62                	jne    803b81 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803b1f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b22:	48 63 d0             	movslq %eax,%rdx
+  803b25:	48 89 d0             	mov    %rdx,%rax
+  803b28:	48 01 c0             	add    %rax,%rax
+  803b2b:	48 01 d0             	add    %rdx,%rax
+  803b2e:	48 c1 e0 02          	shl    $0x2,%rax
+  803b32:	48 89 c2             	mov    %rax,%rdx
+  803b35:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b3c:	48 01 d0             	add    %rdx,%rax
+  803b3f:	8b 40 04             	mov    0x4(%rax),%eax
+  803b42:	83 e0 01             	and    $0x1,%eax
+  803b45:	85 c0                	test   %eax,%eax
+  803b47:	0f 84 9b 01 00 00    	je     803ce8 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803b4d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b50:	48 63 d0             	movslq %eax,%rdx
+  803b53:	48 89 d0             	mov    %rdx,%rax
+  803b56:	48 01 c0             	add    %rax,%rax
+  803b59:	48 01 d0             	add    %rdx,%rax
+  803b5c:	48 c1 e0 02          	shl    $0x2,%rax
+  803b60:	48 89 c2             	mov    %rax,%rdx
+  803b63:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b6a:	48 01 c2             	add    %rax,%rdx
+  803b6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b70:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803b73:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803b76:	83 c8 04             	or     $0x4,%eax
+  803b79:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803b7c:	e9 67 01 00 00       	jmp    803ce8 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803b81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b84:	48 63 d0             	movslq %eax,%rdx
+  803b87:	48 89 d0             	mov    %rdx,%rax
+  803b8a:	48 01 c0             	add    %rax,%rax
+  803b8d:	48 01 d0             	add    %rdx,%rax
+  803b90:	48 c1 e0 02          	shl    $0x2,%rax
+  803b94:	48 89 c2             	mov    %rax,%rdx
+  803b97:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b9e:	48 01 d0             	add    %rdx,%rax
+  803ba1:	8b 00                	mov    (%rax),%eax
+  803ba3:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803baa:	48 89 d6             	mov    %rdx,%rsi
+  803bad:	89 c7                	mov    %eax,%edi
+  803baf:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803bb6:	00 00 00 
+  803bb9:	ff d0                	call   *%rax
+  803bbb:	85 c0                	test   %eax,%eax
+  803bbd:	78 25                	js     803be4 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803bbf:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803bc6:	8b 00                	mov    (%rax),%eax
+  803bc8:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803bcf:	48 89 d6             	mov    %rdx,%rsi
+  803bd2:	89 c7                	mov    %eax,%edi
+  803bd4:	48 b8 87 31 80 00 00 	movabs $0x803187,%rax
+  803bdb:	00 00 00 
+  803bde:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803be0:	85 c0                	test   %eax,%eax
+  803be2:	79 2c                	jns    803c10 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803be4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803be7:	48 63 d0             	movslq %eax,%rdx
+  803bea:	48 89 d0             	mov    %rdx,%rax
+  803bed:	48 01 c0             	add    %rax,%rax
+  803bf0:	48 01 d0             	add    %rdx,%rax
+  803bf3:	48 c1 e0 02          	shl    $0x2,%rax
+  803bf7:	48 89 c2             	mov    %rax,%rdx
+  803bfa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c01:	48 01 d0             	add    %rdx,%rax
+  803c04:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803c0b:	e9 d8 00 00 00       	jmp    803ce8 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803c10:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803c17:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803c1b:	48 85 c0             	test   %rax,%rax
+  803c1e:	74 7d                	je     803c9d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803c20:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803c27:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803c2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c2e:	48 63 d0             	movslq %eax,%rdx
+  803c31:	48 89 d0             	mov    %rdx,%rax
+  803c34:	48 01 c0             	add    %rax,%rax
+  803c37:	48 01 d0             	add    %rdx,%rax
+  803c3a:	48 c1 e0 02          	shl    $0x2,%rax
+  803c3e:	48 89 c2             	mov    %rax,%rdx
+  803c41:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c48:	48 01 d0             	add    %rdx,%rax
+  803c4b:	8b 48 04             	mov    0x4(%rax),%ecx
+  803c4e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c55:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803c5c:	89 ce                	mov    %ecx,%esi
+  803c5e:	48 89 c7             	mov    %rax,%rdi
+  803c61:	41 ff d0             	call   *%r8
+  803c64:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803c67:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c6b:	79 08                	jns    803c75 <poll+0x242>
+          return r;
+  803c6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c70:	e9 45 01 00 00       	jmp    803dba <poll+0x387>
+        fds[i].revents = r;
+  803c75:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c78:	48 63 d0             	movslq %eax,%rdx
+  803c7b:	48 89 d0             	mov    %rdx,%rax
+  803c7e:	48 01 c0             	add    %rax,%rax
+  803c81:	48 01 d0             	add    %rdx,%rax
+  803c84:	48 c1 e0 02          	shl    $0x2,%rax
+  803c88:	48 89 c2             	mov    %rax,%rdx
+  803c8b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c92:	48 01 c2             	add    %rax,%rdx
+  803c95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c98:	89 42 08             	mov    %eax,0x8(%rdx)
+  803c9b:	eb 4b                	jmp    803ce8 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803c9d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ca0:	48 63 d0             	movslq %eax,%rdx
+  803ca3:	48 89 d0             	mov    %rdx,%rax
+  803ca6:	48 01 c0             	add    %rax,%rax
+  803ca9:	48 01 d0             	add    %rdx,%rax
+  803cac:	48 c1 e0 02          	shl    $0x2,%rax
+  803cb0:	48 89 c2             	mov    %rax,%rdx
+  803cb3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cba:	48 01 d0             	add    %rdx,%rax
+  803cbd:	8b 48 04             	mov    0x4(%rax),%ecx
+  803cc0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cc3:	48 63 d0             	movslq %eax,%rdx
+  803cc6:	48 89 d0             	mov    %rdx,%rax
+  803cc9:	48 01 c0             	add    %rax,%rax
+  803ccc:	48 01 d0             	add    %rdx,%rax
+  803ccf:	48 c1 e0 02          	shl    $0x2,%rax
+  803cd3:	48 89 c2             	mov    %rax,%rdx
+  803cd6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cdd:	48 01 d0             	add    %rdx,%rax
+  803ce0:	83 e1 03             	and    $0x3,%ecx
+  803ce3:	89 ca                	mov    %ecx,%edx
+  803ce5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803ce8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ceb:	48 63 d0             	movslq %eax,%rdx
+  803cee:	48 89 d0             	mov    %rdx,%rax
+  803cf1:	48 01 c0             	add    %rax,%rax
+  803cf4:	48 01 d0             	add    %rdx,%rax
+  803cf7:	48 c1 e0 02          	shl    $0x2,%rax
+  803cfb:	48 89 c2             	mov    %rax,%rdx
+  803cfe:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d05:	48 01 d0             	add    %rdx,%rax
+  803d08:	8b 40 08             	mov    0x8(%rax),%eax
+  803d0b:	85 c0                	test   %eax,%eax
+  803d0d:	74 04                	je     803d13 <poll+0x2e0>
+        ready++;
+  803d0f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803d13:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803d17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d1a:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803d20:	0f 8c ab fd ff ff    	jl     803ad1 <poll+0x9e>
+    }
+    if (ready)
+  803d26:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803d2a:	74 08                	je     803d34 <poll+0x301>
+      return ready;
+  803d2c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d2f:	e9 86 00 00 00       	jmp    803dba <poll+0x387>
+
+    if (deadline) {
+  803d34:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803d39:	74 30                	je     803d6b <poll+0x338>
+      now     = vsys_clock_ns();
+  803d3b:	48 b8 4b 5d 80 00 00 	movabs $0x805d4b,%rax
+  803d42:	00 00 00 
+  803d45:	ff d0                	call   *%rax
+  803d47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803d4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d4f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803d53:	73 0a                	jae    803d5f <poll+0x32c>
+  803d55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d59:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803d5d:	eb 05                	jmp    803d64 <poll+0x331>
+  803d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d64:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803d6b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803d6e:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803d71:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803d78:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803d7f:	48 89 c7             	mov    %rax,%rdi
+  803d82:	48 b8 17 2c 80 00 00 	movabs $0x802c17,%rax
+  803d89:	00 00 00 
+  803d8c:	ff d0                	call   *%rax
+  803d8e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803d91:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803d95:	75 07                	jne    803d9e <poll+0x36b>
+      return 0;
+  803d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9c:	eb 1c                	jmp    803dba <poll+0x387>
+    if (r < 0)
+  803d9e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803da2:	79 05                	jns    803da9 <poll+0x376>
+      return r;
+  803da4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803da7:	eb 11                	jmp    803dba <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803da9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803dac:	c1 f8 02             	sar    $0x2,%eax
+  803daf:	83 e0 01             	and    $0x1,%eax
+  803db2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803db5:	e9 f6 fc ff ff       	jmp    803ab0 <poll+0x7d>
+  }
+}
+  803dba:	c9                   	leave
+  803dbb:	c3                   	ret
+
+0000000000803dbc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803dbc:	55                   	push   %rbp
+  803dbd:	48 89 e5             	mov    %rsp,%rbp
+  803dc0:	48 83 ec 20          	sub    $0x20,%rsp
+  803dc4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803dc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803dcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dd0:	be 00 00 00 00       	mov    $0x0,%esi
+  803dd5:	48 89 c7             	mov    %rax,%rdi
+  803dd8:	48 b8 aa 3e 80 00 00 	movabs $0x803eaa,%rax
+  803ddf:	00 00 00 
+  803de2:	ff d0                	call   *%rax
+  803de4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803de7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803deb:	79 05                	jns    803df2 <stat+0x36>
+    return fd;
+  803ded:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803df0:	eb 2f                	jmp    803e21 <stat+0x65>
+  r = fstat(fd, stat);
+  803df2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803df6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803df9:	48 89 d6             	mov    %rdx,%rsi
+  803dfc:	89 c7                	mov    %eax,%edi
+  803dfe:	48 b8 f3 38 80 00 00 	movabs $0x8038f3,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+  803e0a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803e0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e10:	89 c7                	mov    %eax,%edi
+  803e12:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  803e19:	00 00 00 
+  803e1c:	ff d0                	call   *%rax
+  return r;
+  803e1e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803e21:	c9                   	leave
+  803e22:	c3                   	ret
+
+0000000000803e23 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803e23:	55                   	push   %rbp
+  803e24:	48 89 e5             	mov    %rsp,%rbp
+  803e27:	48 83 ec 10          	sub    $0x10,%rsp
+  803e2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803e2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803e32:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  803e39:	00 00 00 
+  803e3c:	8b 00                	mov    (%rax),%eax
+  803e3e:	85 c0                	test   %eax,%eax
+  803e40:	75 1d                	jne    803e5f <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e42:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e47:	48 b8 ea 5f 80 00 00 	movabs $0x805fea,%rax
+  803e4e:	00 00 00 
+  803e51:	ff d0                	call   *%rax
+  803e53:	48 ba 00 c0 80 00 00 	movabs $0x80c000,%rdx
+  803e5a:	00 00 00 
+  803e5d:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803e5f:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  803e66:	00 00 00 
+  803e69:	8b 00                	mov    (%rax),%eax
+  803e6b:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803e6e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803e73:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  803e7a:	00 00 00 
+  803e7d:	89 c7                	mov    %eax,%edi
+  803e7f:	48 b8 3d 5f 80 00 00 	movabs $0x805f3d,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803e8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e94:	48 89 c6             	mov    %rax,%rsi
+  803e97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e9c:	48 b8 c0 5d 80 00 00 	movabs $0x805dc0,%rax
+  803ea3:	00 00 00 
+  803ea6:	ff d0                	call   *%rax
+}
+  803ea8:	c9                   	leave
+  803ea9:	c3                   	ret
+
+0000000000803eaa <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803eaa:	55                   	push   %rbp
+  803eab:	48 89 e5             	mov    %rsp,%rbp
+  803eae:	48 83 ec 20          	sub    $0x20,%rsp
+  803eb2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803eb6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803eb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ebd:	48 89 c7             	mov    %rax,%rdi
+  803ec0:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+  803ecc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803ed1:	7e 0a                	jle    803edd <open+0x33>
+    return -E_BAD_PATH;
+  803ed3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ed8:	e9 a8 00 00 00       	jmp    803f85 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803edd:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803ee1:	48 89 c7             	mov    %rax,%rdi
+  803ee4:	48 b8 04 2f 80 00 00 	movabs $0x802f04,%rax
+  803eeb:	00 00 00 
+  803eee:	ff d0                	call   *%rax
+  803ef0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ef3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ef7:	79 08                	jns    803f01 <open+0x57>
+    return r;
+  803ef9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803efc:	e9 84 00 00 00       	jmp    803f85 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803f01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f05:	48 89 c6             	mov    %rax,%rsi
+  803f08:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  803f0f:	00 00 00 
+  803f12:	48 89 c7             	mov    %rax,%rdi
+  803f15:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803f21:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  803f28:	00 00 00 
+  803f2b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f2e:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f38:	48 89 c6             	mov    %rax,%rsi
+  803f3b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f40:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  803f47:	00 00 00 
+  803f4a:	ff d0                	call   *%rax
+  803f4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f4f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f53:	79 1d                	jns    803f72 <open+0xc8>
+    fd_close(fd, 0);
+  803f55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f59:	be 00 00 00 00       	mov    $0x0,%esi
+  803f5e:	48 89 c7             	mov    %rax,%rdi
+  803f61:	48 b8 bc 30 80 00 00 	movabs $0x8030bc,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+    return r;
+  803f6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f70:	eb 13                	jmp    803f85 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f76:	48 89 c7             	mov    %rax,%rdi
+  803f79:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  803f80:	00 00 00 
+  803f83:	ff d0                	call   *%rax
+}
+  803f85:	c9                   	leave
+  803f86:	c3                   	ret
+
+0000000000803f87 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803f87:	55                   	push   %rbp
+  803f88:	48 89 e5             	mov    %rsp,%rbp
+  803f8b:	48 83 ec 10          	sub    $0x10,%rsp
+  803f8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803f93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f97:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f9a:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  803fa1:	00 00 00 
+  803fa4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  803fab:	bf 06 00 00 00       	mov    $0x6,%edi
+  803fb0:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  803fb7:	00 00 00 
+  803fba:	ff d0                	call   *%rax
+}
+  803fbc:	c9                   	leave
+  803fbd:	c3                   	ret
+
+0000000000803fbe <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803fbe:	55                   	push   %rbp
+  803fbf:	48 89 e5             	mov    %rsp,%rbp
+  803fc2:	48 83 ec 30          	sub    $0x30,%rsp
+  803fc6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803fca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803fce:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803fd2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803fd7:	74 07                	je     803fe0 <devfile_read+0x22>
+  803fd9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803fde:	75 0a                	jne    803fea <devfile_read+0x2c>
+  return E_INVAL;
+  803fe0:	b8 03 00 00 00       	mov    $0x3,%eax
+  803fe5:	e9 b4 00 00 00       	jmp    80409e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803fea:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ff1:	00 
+  while (n) {
+  803ff2:	e9 98 00 00 00       	jmp    80408f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ffb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ffe:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  804005:	00 00 00 
+  804008:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80400a:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  804011:	00 00 00 
+  804014:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804018:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80401c:	be 00 00 00 00       	mov    $0x0,%esi
+  804021:	bf 03 00 00 00       	mov    $0x3,%edi
+  804026:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  80402d:	00 00 00 
+  804030:	ff d0                	call   *%rax
+  804032:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804035:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804039:	7f 13                	jg     80404e <devfile_read+0x90>
+      return res ? res : res0;
+  80403b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80403f:	74 07                	je     804048 <devfile_read+0x8a>
+  804041:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804044:	48 98                	cltq
+  804046:	eb 56                	jmp    80409e <devfile_read+0xe0>
+  804048:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80404c:	eb 50                	jmp    80409e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80404e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804051:	48 63 d0             	movslq %eax,%rdx
+  804054:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804058:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  80405f:	00 00 00 
+  804062:	48 89 ce             	mov    %rcx,%rsi
+  804065:	48 89 c7             	mov    %rax,%rdi
+  804068:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  80406f:	00 00 00 
+  804072:	ff d0                	call   *%rax
+
+    buf += res;
+  804074:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804077:	48 98                	cltq
+  804079:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80407d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804080:	48 98                	cltq
+  804082:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804086:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804089:	48 98                	cltq
+  80408b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80408f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804094:	0f 85 5d ff ff ff    	jne    803ff7 <devfile_read+0x39>
+  }
+
+  return res0;
+  80409a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80409e:	c9                   	leave
+  80409f:	c3                   	ret
+
+00000000008040a0 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8040a0:	55                   	push   %rbp
+  8040a1:	48 89 e5             	mov    %rsp,%rbp
+  8040a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8040a8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8040ac:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040b0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8040b4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8040b9:	74 07                	je     8040c2 <devfile_write+0x22>
+  8040bb:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8040c0:	75 0a                	jne    8040cc <devfile_write+0x2c>
+  return E_INVAL;
+  8040c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8040c7:	e9 c9 00 00 00       	jmp    804195 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8040cc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8040d3:	00 
+
+  while (n) {
+  8040d4:	e9 ad 00 00 00       	jmp    804186 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8040d9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8040dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8040e1:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8040e8:	00 
+  8040e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040f1:	48 39 c2             	cmp    %rax,%rdx
+  8040f4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8040f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8040fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804100:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804104:	48 89 c6             	mov    %rax,%rsi
+  804107:	48 b8 10 b0 80 00 00 	movabs $0x80b010,%rax
+  80410e:	00 00 00 
+  804111:	48 89 c7             	mov    %rax,%rdi
+  804114:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  80411b:	00 00 00 
+  80411e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804120:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804124:	8b 40 0c             	mov    0xc(%rax),%eax
+  804127:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80412e:	00 00 00 
+  804131:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804133:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80413a:	00 00 00 
+  80413d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804141:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804145:	be 00 00 00 00       	mov    $0x0,%esi
+  80414a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80414f:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  804156:	00 00 00 
+  804159:	ff d0                	call   *%rax
+  80415b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80415e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804162:	79 07                	jns    80416b <devfile_write+0xcb>
+      return res;
+  804164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804167:	48 98                	cltq
+  804169:	eb 2a                	jmp    804195 <devfile_write+0xf5>
+
+    buf += res;
+  80416b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80416e:	48 98                	cltq
+  804170:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804174:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804177:	48 98                	cltq
+  804179:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80417d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804180:	48 98                	cltq
+  804182:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804186:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80418b:	0f 85 48 ff ff ff    	jne    8040d9 <devfile_write+0x39>
+  }
+
+  return res0;
+  804191:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804195:	c9                   	leave
+  804196:	c3                   	ret
+
+0000000000804197 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804197:	55                   	push   %rbp
+  804198:	48 89 e5             	mov    %rsp,%rbp
+  80419b:	48 83 ec 20          	sub    $0x20,%rsp
+  80419f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8041a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ab:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041ae:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8041b5:	00 00 00 
+  8041b8:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8041ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8041bf:	bf 05 00 00 00       	mov    $0x5,%edi
+  8041c4:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  8041cb:	00 00 00 
+  8041ce:	ff d0                	call   *%rax
+  8041d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041d7:	79 05                	jns    8041de <devfile_stat+0x47>
+    return r;
+  8041d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041dc:	eb 59                	jmp    804237 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8041de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e2:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8041e9:	00 00 00 
+  8041ec:	48 89 d6             	mov    %rdx,%rsi
+  8041ef:	48 89 c7             	mov    %rax,%rdi
+  8041f2:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8041fe:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  804205:	00 00 00 
+  804208:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80420e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804212:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804218:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  80421f:	00 00 00 
+  804222:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804228:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80422c:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804237:	c9                   	leave
+  804238:	c3                   	ret
+
+0000000000804239 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804239:	55                   	push   %rbp
+  80423a:	48 89 e5             	mov    %rsp,%rbp
+  80423d:	48 83 ec 10          	sub    $0x10,%rsp
+  804241:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804245:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804248:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80424c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80424f:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  804256:	00 00 00 
+  804259:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80425b:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  804262:	00 00 00 
+  804265:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804268:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80426b:	be 00 00 00 00       	mov    $0x0,%esi
+  804270:	bf 02 00 00 00       	mov    $0x2,%edi
+  804275:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  80427c:	00 00 00 
+  80427f:	ff d0                	call   *%rax
+}
+  804281:	c9                   	leave
+  804282:	c3                   	ret
+
+0000000000804283 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804283:	55                   	push   %rbp
+  804284:	48 89 e5             	mov    %rsp,%rbp
+  804287:	48 83 ec 18          	sub    $0x18,%rsp
+  80428b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80428f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804292:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804296:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804299:	83 e0 03             	and    $0x3,%eax
+}
+  80429c:	c9                   	leave
+  80429d:	c3                   	ret
+
+000000000080429e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8042a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8042aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042ae:	48 89 c7             	mov    %rax,%rdi
+  8042b1:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  8042b8:	00 00 00 
+  8042bb:	ff d0                	call   *%rax
+  8042bd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8042c2:	7e 07                	jle    8042cb <remove+0x2d>
+    return -E_BAD_PATH;
+  8042c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8042c9:	eb 36                	jmp    804301 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8042cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042cf:	48 89 c6             	mov    %rax,%rsi
+  8042d2:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  8042d9:	00 00 00 
+  8042dc:	48 89 c7             	mov    %rax,%rdi
+  8042df:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  8042e6:	00 00 00 
+  8042e9:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8042eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8042f0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8042f5:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+}
+  804301:	c9                   	leave
+  804302:	c3                   	ret
+
+0000000000804303 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804307:	be 00 00 00 00       	mov    $0x0,%esi
+  80430c:	bf 08 00 00 00       	mov    $0x8,%edi
+  804311:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+}
+  80431d:	5d                   	pop    %rbp
+  80431e:	c3                   	ret
+
+000000000080431f <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  80431f:	55                   	push   %rbp
+  804320:	48 89 e5             	mov    %rsp,%rbp
+  804323:	48 83 ec 20          	sub    $0x20,%rsp
+  804327:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80432b:	be 00 00 00 00       	mov    $0x0,%esi
+  804330:	bf 09 00 00 00       	mov    $0x9,%edi
+  804335:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  80433c:	00 00 00 
+  80433f:	ff d0                	call   *%rax
+  804341:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804344:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804348:	79 05                	jns    80434f <fs_stats+0x30>
+    return r;
+  80434a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80434d:	eb 2a                	jmp    804379 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  80434f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804353:	ba 68 00 00 00       	mov    $0x68,%edx
+  804358:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  80435f:	00 00 00 
+  804362:	48 89 ce             	mov    %rcx,%rsi
+  804365:	48 89 c7             	mov    %rax,%rdi
+  804368:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+  return 0;
+  804374:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804379:	c9                   	leave
+  80437a:	c3                   	ret
+
+000000000080437b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80437b:	55                   	push   %rbp
+  80437c:	48 89 e5             	mov    %rsp,%rbp
+  80437f:	48 83 ec 10          	sub    $0x10,%rsp
+  804383:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804386:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80438d:	00 00 00 
+  804390:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804393:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804395:	be 00 00 00 00       	mov    $0x0,%esi
+  80439a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80439f:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+}
+  8043ab:	c9                   	leave
+  8043ac:	c3                   	ret
+
+00000000008043ad <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8043ad:	55                   	push   %rbp
+  8043ae:	48 89 e5             	mov    %rsp,%rbp
+  8043b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8043b5:	89 f8                	mov    %edi,%eax
+  8043b7:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8043ba:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8043be:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8043c5:	00 00 00 
+  8043c8:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8043ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8043cf:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8043d4:	48 b8 23 3e 80 00 00 	movabs $0x803e23,%rax
+  8043db:	00 00 00 
+  8043de:	ff d0                	call   *%rax
+}
+  8043e0:	c9                   	leave
+  8043e1:	c3                   	ret
+
+00000000008043e2 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  8043e2:	55                   	push   %rbp
+  8043e3:	48 89 e5             	mov    %rsp,%rbp
+  8043e6:	53                   	push   %rbx
+  8043e7:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  8043ee:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  8043f5:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  8043fc:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804403:	be 00 00 00 00       	mov    $0x0,%esi
+  804408:	48 89 c7             	mov    %rax,%rdi
+  80440b:	48 b8 aa 3e 80 00 00 	movabs $0x803eaa,%rax
+  804412:	00 00 00 
+  804415:	ff d0                	call   *%rax
+  804417:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80441a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80441e:	79 08                	jns    804428 <spawn+0x46>
+    return r;
+  804420:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804423:	e9 35 04 00 00       	jmp    80485d <spawn+0x47b>
+  fd = r;
+  804428:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80442b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  80442e:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  804435:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  804439:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  804440:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804443:	ba 00 02 00 00       	mov    $0x200,%edx
+  804448:	48 89 ce             	mov    %rcx,%rsi
+  80444b:	89 c7                	mov    %eax,%edi
+  80444d:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  804454:	00 00 00 
+  804457:	ff d0                	call   *%rax
+  804459:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  80445f:	75 0d                	jne    80446e <spawn+0x8c>
+  804461:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804465:	8b 00                	mov    (%rax),%eax
+  804467:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  80446c:	74 46                	je     8044b4 <spawn+0xd2>
+    close(fd);
+  80446e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804471:	89 c7                	mov    %eax,%edi
+  804473:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  80447a:	00 00 00 
+  80447d:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80447f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804483:	8b 00                	mov    (%rax),%eax
+  804485:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80448a:	89 c6                	mov    %eax,%esi
+  80448c:	48 b8 98 68 80 00 00 	movabs $0x806898,%rax
+  804493:	00 00 00 
+  804496:	48 89 c7             	mov    %rax,%rdi
+  804499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449e:	48 b9 51 0a 80 00 00 	movabs $0x800a51,%rcx
+  8044a5:	00 00 00 
+  8044a8:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  8044aa:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  8044af:	e9 a9 03 00 00       	jmp    80485d <spawn+0x47b>
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  8044b4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8044b9:	cd 30                	int    $0x30
+  8044bb:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  8044be:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  8044c1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8044c4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8044c8:	79 08                	jns    8044d2 <spawn+0xf0>
+    return r;
+  8044ca:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8044cd:	e9 8b 03 00 00       	jmp    80485d <spawn+0x47b>
+  child = r;
+  8044d2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8044d5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  8044d8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8044db:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8044e0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8044e7:	00 00 00 
+  8044ea:	48 98                	cltq
+  8044ec:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8044f3:	48 01 d0             	add    %rdx,%rax
+  8044f6:	48 8b 08             	mov    (%rax),%rcx
+  8044f9:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  8044fd:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  804504:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  80450b:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  80450f:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  804513:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  80451a:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  804521:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  804525:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  804529:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  804530:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  804537:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80453b:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  80453f:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  804546:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  80454d:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  804551:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  804555:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  80455c:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  804563:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  804567:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  80456b:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  804572:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  804579:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  80457d:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  804581:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  804588:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  80458f:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  804593:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  804597:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  80459e:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  8045a5:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  8045ac:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  8045b3:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  8045ba:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  8045c1:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  8045c8:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  8045cf:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  8045d6:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  8045dd:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  8045e4:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  8045eb:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  8045f2:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  8045f9:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804600:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  804607:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  80460e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  804615:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804619:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80461d:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  804624:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  80462b:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  804631:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  804635:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804639:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  804640:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804643:	48 89 ce             	mov    %rcx,%rsi
+  804646:	89 c7                	mov    %eax,%edi
+  804648:	48 b8 c5 4a 80 00 00 	movabs $0x804ac5,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+  804654:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804657:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80465b:	79 08                	jns    804665 <spawn+0x283>
+    return r;
+  80465d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804660:	e9 f8 01 00 00       	jmp    80485d <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804665:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804669:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80466d:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  804674:	48 01 d0             	add    %rdx,%rax
+  804677:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80467b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804682:	e9 80 00 00 00       	jmp    804707 <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  804687:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80468b:	8b 00                	mov    (%rax),%eax
+  80468d:	83 f8 01             	cmp    $0x1,%eax
+  804690:	75 6b                	jne    8046fd <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  804692:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  804699:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80469d:	8b 40 04             	mov    0x4(%rax),%eax
+  8046a0:	83 e0 02             	and    $0x2,%eax
+  8046a3:	85 c0                	test   %eax,%eax
+  8046a5:	74 04                	je     8046ab <spawn+0x2c9>
+      perm |= PTE_W;
+  8046a7:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8046ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046af:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8046b3:	41 89 c1             	mov    %eax,%r9d
+  8046b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046ba:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  8046be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046c2:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  8046c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046ca:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8046ce:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8046d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8046d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8046d8:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8046db:	57                   	push   %rdi
+  8046dc:	89 c7                	mov    %eax,%edi
+  8046de:	48 b8 0d 4e 80 00 00 	movabs $0x804e0d,%rax
+  8046e5:	00 00 00 
+  8046e8:	ff d0                	call   *%rax
+  8046ea:	48 83 c4 10          	add    $0x10,%rsp
+  8046ee:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8046f1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8046f5:	0f 88 3c 01 00 00    	js     804837 <spawn+0x455>
+  8046fb:	eb 01                	jmp    8046fe <spawn+0x31c>
+      continue;
+  8046fd:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8046fe:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804702:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  804707:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80470b:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  80470f:	0f b7 c0             	movzwl %ax,%eax
+  804712:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804715:	0f 8c 6c ff ff ff    	jl     804687 <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  80471b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80471e:	89 c7                	mov    %eax,%edi
+  804720:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  804727:	00 00 00 
+  80472a:	ff d0                	call   *%rax
+  fd = -1;
+  80472c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  804733:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804736:	89 c7                	mov    %eax,%edi
+  804738:	48 b8 fb 4f 80 00 00 	movabs $0x804ffb,%rax
+  80473f:	00 00 00 
+  804742:	ff d0                	call   *%rax
+  804744:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804747:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80474b:	79 36                	jns    804783 <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  80474d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804750:	89 c1                	mov    %eax,%ecx
+  804752:	48 b8 b2 68 80 00 00 	movabs $0x8068b2,%rax
+  804759:	00 00 00 
+  80475c:	48 89 c2             	mov    %rax,%rdx
+  80475f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804764:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  80476b:	00 00 00 
+  80476e:	48 89 c7             	mov    %rax,%rdi
+  804771:	b8 00 00 00 00       	mov    $0x0,%eax
+  804776:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  80477d:	00 00 00 
+  804780:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804783:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  80478a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80478d:	48 89 d6             	mov    %rdx,%rsi
+  804790:	89 c7                	mov    %eax,%edi
+  804792:	48 b8 20 29 80 00 00 	movabs $0x802920,%rax
+  804799:	00 00 00 
+  80479c:	ff d0                	call   *%rax
+  80479e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8047a1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8047a5:	79 36                	jns    8047dd <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  8047a7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8047aa:	89 c1                	mov    %eax,%ecx
+  8047ac:	48 b8 d4 68 80 00 00 	movabs $0x8068d4,%rax
+  8047b3:	00 00 00 
+  8047b6:	48 89 c2             	mov    %rax,%rdx
+  8047b9:	be a2 00 00 00       	mov    $0xa2,%esi
+  8047be:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  8047c5:	00 00 00 
+  8047c8:	48 89 c7             	mov    %rax,%rdi
+  8047cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d0:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  8047d7:	00 00 00 
+  8047da:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8047dd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8047e0:	be 02 00 00 00       	mov    $0x2,%esi
+  8047e5:	89 c7                	mov    %eax,%edi
+  8047e7:	48 b8 d3 28 80 00 00 	movabs $0x8028d3,%rax
+  8047ee:	00 00 00 
+  8047f1:	ff d0                	call   *%rax
+  8047f3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8047f6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8047fa:	79 36                	jns    804832 <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  8047fc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8047ff:	89 c1                	mov    %eax,%ecx
+  804801:	48 b8 ee 68 80 00 00 	movabs $0x8068ee,%rax
+  804808:	00 00 00 
+  80480b:	48 89 c2             	mov    %rax,%rdx
+  80480e:	be a5 00 00 00       	mov    $0xa5,%esi
+  804813:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  80481a:	00 00 00 
+  80481d:	48 89 c7             	mov    %rax,%rdi
+  804820:	b8 00 00 00 00       	mov    $0x0,%eax
+  804825:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  80482c:	00 00 00 
+  80482f:	41 ff d0             	call   *%r8
+
+  return child;
+  804832:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804835:	eb 26                	jmp    80485d <spawn+0x47b>
+      goto error;
+  804837:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  804838:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80483b:	89 c7                	mov    %eax,%edi
+  80483d:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  804844:	00 00 00 
+  804847:	ff d0                	call   *%rax
+  close(fd);
+  804849:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80484c:	89 c7                	mov    %eax,%edi
+  80484e:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  804855:	00 00 00 
+  804858:	ff d0                	call   *%rax
+  return r;
+  80485a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  80485d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804861:	c9                   	leave
+  804862:	c3                   	ret
+
+0000000000804863 <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  804863:	55                   	push   %rbp
+  804864:	48 89 e5             	mov    %rsp,%rbp
+  804867:	41 55                	push   %r13
+  804869:	41 54                	push   %r12
+  80486b:	53                   	push   %rbx
+  80486c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804873:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  80487a:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  804881:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  804888:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80488f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  804896:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80489d:	84 c0                	test   %al,%al
+  80489f:	74 26                	je     8048c7 <spawnl+0x64>
+  8048a1:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8048a8:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8048af:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8048b3:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8048b7:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8048bb:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8048bf:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8048c3:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  8048c7:	48 89 e0             	mov    %rsp,%rax
+  8048ca:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  8048cd:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  8048d4:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  8048d7:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  8048de:	00 00 00 
+  8048e1:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  8048e8:	00 00 00 
+  8048eb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8048ef:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  8048f6:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8048fd:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  804904:	eb 07                	jmp    80490d <spawnl+0xaa>
+    argc++;
+  804906:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  80490d:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  804913:	83 f8 2f             	cmp    $0x2f,%eax
+  804916:	77 23                	ja     80493b <spawnl+0xd8>
+  804918:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  80491f:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804925:	89 d2                	mov    %edx,%edx
+  804927:	48 01 d0             	add    %rdx,%rax
+  80492a:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804930:	83 c2 08             	add    $0x8,%edx
+  804933:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  804939:	eb 12                	jmp    80494d <spawnl+0xea>
+  80493b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804942:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804946:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80494d:	48 8b 00             	mov    (%rax),%rax
+  804950:	48 85 c0             	test   %rax,%rax
+  804953:	75 b1                	jne    804906 <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  804955:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80495b:	83 c0 02             	add    $0x2,%eax
+  80495e:	48 63 d0             	movslq %eax,%rdx
+  804961:	48 83 ea 01          	sub    $0x1,%rdx
+  804965:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  80496c:	48 63 d0             	movslq %eax,%rdx
+  80496f:	49 89 d4             	mov    %rdx,%r12
+  804972:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804978:	48 63 d0             	movslq %eax,%rdx
+  80497b:	49 89 d2             	mov    %rdx,%r10
+  80497e:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  804984:	48 98                	cltq
+  804986:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80498d:	00 
+  80498e:	b8 10 00 00 00       	mov    $0x10,%eax
+  804993:	48 83 e8 01          	sub    $0x1,%rax
+  804997:	48 01 d0             	add    %rdx,%rax
+  80499a:	be 10 00 00 00       	mov    $0x10,%esi
+  80499f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049a4:	48 f7 f6             	div    %rsi
+  8049a7:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  8049ab:	48 29 c4             	sub    %rax,%rsp
+  8049ae:	48 89 e0             	mov    %rsp,%rax
+  8049b1:	48 83 c0 07          	add    $0x7,%rax
+  8049b5:	48 c1 e8 03          	shr    $0x3,%rax
+  8049b9:	48 c1 e0 03          	shl    $0x3,%rax
+  8049bd:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  8049c4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8049cb:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  8049d2:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  8049d5:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8049db:	8d 50 01             	lea    0x1(%rax),%edx
+  8049de:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8049e5:	48 63 d2             	movslq %edx,%rdx
+  8049e8:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  8049ef:	00 
+
+  va_start(vl, arg0);
+  8049f0:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  8049f7:	00 00 00 
+  8049fa:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  804a01:	00 00 00 
+  804a04:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a08:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  804a0f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  804a16:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  804a1d:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  804a24:	00 00 00 
+  804a27:	eb 60                	jmp    804a89 <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  804a29:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  804a2f:	8d 48 01             	lea    0x1(%rax),%ecx
+  804a32:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  804a38:	83 f8 2f             	cmp    $0x2f,%eax
+  804a3b:	77 23                	ja     804a60 <spawnl+0x1fd>
+  804a3d:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  804a44:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804a4a:	89 d2                	mov    %edx,%edx
+  804a4c:	48 01 d0             	add    %rdx,%rax
+  804a4f:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804a55:	83 c2 08             	add    $0x8,%edx
+  804a58:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  804a5e:	eb 12                	jmp    804a72 <spawnl+0x20f>
+  804a60:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804a67:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804a6b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804a72:	48 8b 10             	mov    (%rax),%rdx
+  804a75:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804a7c:	89 c9                	mov    %ecx,%ecx
+  804a7e:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  804a82:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  804a89:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804a8f:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  804a95:	72 92                	jb     804a29 <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  804a97:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804a9e:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804aa5:	48 89 d6             	mov    %rdx,%rsi
+  804aa8:	48 89 c7             	mov    %rax,%rdi
+  804aab:	48 b8 e2 43 80 00 00 	movabs $0x8043e2,%rax
+  804ab2:	00 00 00 
+  804ab5:	ff d0                	call   *%rax
+  804ab7:	48 89 dc             	mov    %rbx,%rsp
+}
+  804aba:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  804abe:	5b                   	pop    %rbx
+  804abf:	41 5c                	pop    %r12
+  804ac1:	41 5d                	pop    %r13
+  804ac3:	5d                   	pop    %rbp
+  804ac4:	c3                   	ret
+
+0000000000804ac5 <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  804ac5:	55                   	push   %rbp
+  804ac6:	48 89 e5             	mov    %rsp,%rbp
+  804ac9:	48 83 ec 50          	sub    $0x50,%rsp
+  804acd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804ad0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804ad4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  804ad8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804adf:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  804ae0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  804ae7:	eb 33                	jmp    804b1c <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  804ae9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804aec:	48 98                	cltq
+  804aee:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804af5:	00 
+  804af6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804afa:	48 01 d0             	add    %rdx,%rax
+  804afd:	48 8b 00             	mov    (%rax),%rax
+  804b00:	48 89 c7             	mov    %rax,%rdi
+  804b03:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  804b0a:	00 00 00 
+  804b0d:	ff d0                	call   *%rax
+  804b0f:	83 c0 01             	add    $0x1,%eax
+  804b12:	48 98                	cltq
+  804b14:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  804b18:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804b1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804b1f:	48 98                	cltq
+  804b21:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804b28:	00 
+  804b29:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b2d:	48 01 d0             	add    %rdx,%rax
+  804b30:	48 8b 00             	mov    (%rax),%rax
+  804b33:	48 85 c0             	test   %rax,%rax
+  804b36:	75 b1                	jne    804ae9 <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  804b38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b3c:	48 f7 d8             	neg    %rax
+  804b3f:	48 05 00 40 40 00    	add    $0x404000,%rax
+  804b45:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  804b49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b4d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804b51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b55:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  804b59:	48 89 c2             	mov    %rax,%rdx
+  804b5c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804b5f:	83 c0 01             	add    $0x1,%eax
+  804b62:	c1 e0 03             	shl    $0x3,%eax
+  804b65:	48 98                	cltq
+  804b67:	48 f7 d8             	neg    %rax
+  804b6a:	48 01 d0             	add    %rdx,%rax
+  804b6d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  804b71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b75:	48 83 e8 10          	sub    $0x10,%rax
+  804b79:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804b7f:	77 0a                	ja     804b8b <init_stack+0xc6>
+    return -E_NO_MEM;
+  804b81:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804b86:	e9 80 02 00 00       	jmp    804e0b <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804b8b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804b92:	eb 3c                	jmp    804bd0 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  804b94:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804b97:	48 98                	cltq
+  804b99:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804b9f:	ba 07 00 00 00       	mov    $0x7,%edx
+  804ba4:	48 89 c6             	mov    %rax,%rsi
+  804ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bac:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  804bb3:	00 00 00 
+  804bb6:	ff d0                	call   *%rax
+  804bb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bbf:	79 08                	jns    804bc9 <init_stack+0x104>
+      return r;
+  804bc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc4:	e9 42 02 00 00       	jmp    804e0b <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804bc9:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804bd0:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  804bd7:	7e bb                	jle    804b94 <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  804bd9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804be0:	e9 8f 00 00 00       	jmp    804c74 <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  804be5:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804bec:	00 00 00 
+  804bef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bf3:	48 01 d0             	add    %rdx,%rax
+  804bf6:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804bfd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804c00:	48 98                	cltq
+  804c02:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  804c09:	00 
+  804c0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c0e:	48 01 c8             	add    %rcx,%rax
+  804c11:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  804c14:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804c17:	48 98                	cltq
+  804c19:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804c20:	00 
+  804c21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c25:	48 01 d0             	add    %rdx,%rax
+  804c28:	48 8b 10             	mov    (%rax),%rdx
+  804c2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c2f:	48 89 d6             	mov    %rdx,%rsi
+  804c32:	48 89 c7             	mov    %rax,%rdi
+  804c35:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  804c3c:	00 00 00 
+  804c3f:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  804c41:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804c44:	48 98                	cltq
+  804c46:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804c4d:	00 
+  804c4e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c52:	48 01 d0             	add    %rdx,%rax
+  804c55:	48 8b 00             	mov    (%rax),%rax
+  804c58:	48 89 c7             	mov    %rax,%rdi
+  804c5b:	48 b8 00 19 80 00 00 	movabs $0x801900,%rax
+  804c62:	00 00 00 
+  804c65:	ff d0                	call   *%rax
+  804c67:	83 c0 01             	add    $0x1,%eax
+  804c6a:	48 98                	cltq
+  804c6c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  804c70:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  804c74:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804c77:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  804c7a:	0f 8c 65 ff ff ff    	jl     804be5 <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  804c80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c83:	48 98                	cltq
+  804c85:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804c8c:	00 
+  804c8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c91:	48 01 d0             	add    %rdx,%rax
+  804c94:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  804c9b:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  804ca2:	00 
+  804ca3:	74 3e                	je     804ce3 <init_stack+0x21e>
+  804ca5:	48 b8 08 69 80 00 00 	movabs $0x806908,%rax
+  804cac:	00 00 00 
+  804caf:	48 89 c1             	mov    %rax,%rcx
+  804cb2:	48 b8 33 69 80 00 00 	movabs $0x806933,%rax
+  804cb9:	00 00 00 
+  804cbc:	48 89 c2             	mov    %rax,%rdx
+  804cbf:	be 0c 01 00 00       	mov    $0x10c,%esi
+  804cc4:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  804ccb:	00 00 00 
+  804cce:	48 89 c7             	mov    %rax,%rdi
+  804cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd6:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  804cdd:	00 00 00 
+  804ce0:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  804ce3:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804cea:	00 00 00 
+  804ced:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cf1:	48 01 d0             	add    %rdx,%rax
+  804cf4:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804cfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cff:	48 83 e8 08          	sub    $0x8,%rax
+  804d03:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  804d06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d0a:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  804d0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804d11:	48 98                	cltq
+  804d13:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  804d16:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  804d1d:	00 00 00 
+  804d20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d24:	48 01 d0             	add    %rdx,%rax
+  804d27:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  804d2d:	48 89 c2             	mov    %rax,%rdx
+  804d30:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d34:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804d37:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804d3e:	eb 78                	jmp    804db8 <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  804d40:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804d43:	48 98                	cltq
+  804d45:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804d4c:	00 00 00 
+  804d4f:	48 01 d0             	add    %rdx,%rax
+  804d52:	48 89 c2             	mov    %rax,%rdx
+  804d55:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804d58:	48 98                	cltq
+  804d5a:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  804d61:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804d64:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  804d6a:	48 89 d1             	mov    %rdx,%rcx
+  804d6d:	89 c2                	mov    %eax,%edx
+  804d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d74:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  804d7b:	00 00 00 
+  804d7e:	ff d0                	call   *%rax
+  804d80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d87:	78 43                	js     804dcc <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  804d89:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804d8c:	48 98                	cltq
+  804d8e:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804d94:	48 89 c6             	mov    %rax,%rsi
+  804d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d9c:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  804da3:	00 00 00 
+  804da6:	ff d0                	call   *%rax
+  804da8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804daf:	78 1e                	js     804dcf <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804db1:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804db8:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  804dbf:	0f 8e 7b ff ff ff    	jle    804d40 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  804dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dca:	eb 3f                	jmp    804e0b <init_stack+0x346>
+      goto error;
+  804dcc:	90                   	nop
+  804dcd:	eb 01                	jmp    804dd0 <init_stack+0x30b>
+      goto error;
+  804dcf:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  804dd0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804dd7:	eb 26                	jmp    804dff <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  804dd9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804ddc:	48 98                	cltq
+  804dde:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804de4:	48 89 c6             	mov    %rax,%rsi
+  804de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dec:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  804df3:	00 00 00 
+  804df6:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  804df8:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804dff:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  804e06:	7e d1                	jle    804dd9 <init_stack+0x314>
+  return r;
+  804e08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804e0b:	c9                   	leave
+  804e0c:	c3                   	ret
+
+0000000000804e0d <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  804e0d:	55                   	push   %rbp
+  804e0e:	48 89 e5             	mov    %rsp,%rbp
+  804e11:	48 83 ec 50          	sub    $0x50,%rsp
+  804e15:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804e1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804e20:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  804e23:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  804e27:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  804e2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e2f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804e34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e3b:	74 21                	je     804e5e <map_segment+0x51>
+    va -= i;
+  804e3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e40:	48 98                	cltq
+  804e42:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  804e46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e49:	48 98                	cltq
+  804e4b:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  804e4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e52:	48 98                	cltq
+  804e54:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  804e58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e5b:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  804e5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e65:	e9 7b 01 00 00       	jmp    804fe5 <map_segment+0x1d8>
+    if (i >= filesz) {
+  804e6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e6d:	48 98                	cltq
+  804e6f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  804e73:	72 3c                	jb     804eb1 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  804e75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e78:	48 63 d0             	movslq %eax,%rdx
+  804e7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e7f:	48 01 d0             	add    %rdx,%rax
+  804e82:	48 89 c1             	mov    %rax,%rcx
+  804e85:	8b 55 10             	mov    0x10(%rbp),%edx
+  804e88:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e8b:	48 89 ce             	mov    %rcx,%rsi
+  804e8e:	89 c7                	mov    %eax,%edi
+  804e90:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  804e97:	00 00 00 
+  804e9a:	ff d0                	call   *%rax
+  804e9c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804e9f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804ea3:	0f 89 35 01 00 00    	jns    804fde <map_segment+0x1d1>
+        return r;
+  804ea9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804eac:	e9 48 01 00 00       	jmp    804ff9 <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  804eb1:	ba 07 00 00 00       	mov    $0x7,%edx
+  804eb6:	be 00 00 40 00       	mov    $0x400000,%esi
+  804ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ec0:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  804ec7:	00 00 00 
+  804eca:	ff d0                	call   *%rax
+  804ecc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804ecf:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804ed3:	79 08                	jns    804edd <map_segment+0xd0>
+        return r;
+  804ed5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804ed8:	e9 1c 01 00 00       	jmp    804ff9 <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  804edd:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  804ee0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ee3:	01 c2                	add    %eax,%edx
+  804ee5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804ee8:	89 d6                	mov    %edx,%esi
+  804eea:	89 c7                	mov    %eax,%edi
+  804eec:	48 b8 bf 37 80 00 00 	movabs $0x8037bf,%rax
+  804ef3:	00 00 00 
+  804ef6:	ff d0                	call   *%rax
+  804ef8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804efb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804eff:	79 08                	jns    804f09 <map_segment+0xfc>
+        return r;
+  804f01:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804f04:	e9 f0 00 00 00       	jmp    804ff9 <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  804f09:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  804f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f13:	48 98                	cltq
+  804f15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f19:	48 29 c2             	sub    %rax,%rdx
+  804f1c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804f20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f23:	48 63 d0             	movslq %eax,%rdx
+  804f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2a:	48 39 c2             	cmp    %rax,%rdx
+  804f2d:	48 0f 47 d0          	cmova  %rax,%rdx
+  804f31:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804f34:	be 00 00 40 00       	mov    $0x400000,%esi
+  804f39:	89 c7                	mov    %eax,%edi
+  804f3b:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  804f42:	00 00 00 
+  804f45:	ff d0                	call   *%rax
+  804f47:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804f4a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804f4e:	79 08                	jns    804f58 <map_segment+0x14b>
+        return r;
+  804f50:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804f53:	e9 a1 00 00 00       	jmp    804ff9 <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  804f58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f5b:	48 63 d0             	movslq %eax,%rdx
+  804f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f62:	48 01 d0             	add    %rdx,%rax
+  804f65:	48 89 c1             	mov    %rax,%rcx
+  804f68:	8b 55 10             	mov    0x10(%rbp),%edx
+  804f6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f6e:	41 89 d0             	mov    %edx,%r8d
+  804f71:	89 c2                	mov    %eax,%edx
+  804f73:	be 00 00 40 00       	mov    $0x400000,%esi
+  804f78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f7d:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  804f84:	00 00 00 
+  804f87:	ff d0                	call   *%rax
+  804f89:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804f8c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804f90:	79 36                	jns    804fc8 <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  804f92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804f95:	89 c1                	mov    %eax,%ecx
+  804f97:	48 b8 48 69 80 00 00 	movabs $0x806948,%rax
+  804f9e:	00 00 00 
+  804fa1:	48 89 c2             	mov    %rax,%rdx
+  804fa4:	be 40 01 00 00       	mov    $0x140,%esi
+  804fa9:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  804fb0:	00 00 00 
+  804fb3:	48 89 c7             	mov    %rax,%rdi
+  804fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fbb:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  804fc2:	00 00 00 
+  804fc5:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  804fc8:	be 00 00 40 00       	mov    $0x400000,%esi
+  804fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd2:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  804fd9:	00 00 00 
+  804fdc:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  804fde:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  804fe5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fe8:	48 98                	cltq
+  804fea:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804fee:	0f 82 76 fe ff ff    	jb     804e6a <map_segment+0x5d>
+    }
+  }
+  return 0;
+  804ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ff9:	c9                   	leave
+  804ffa:	c3                   	ret
+
+0000000000804ffb <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  804ffb:	55                   	push   %rbp
+  804ffc:	48 89 e5             	mov    %rsp,%rbp
+  804fff:	48 83 ec 20          	sub    $0x20,%rsp
+  805003:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  805006:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  80500d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805014:	00 
+  805015:	e9 e7 00 00 00       	jmp    805101 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  80501a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80501e:	48 c1 e8 27          	shr    $0x27,%rax
+  805022:	48 89 c2             	mov    %rax,%rdx
+  805025:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80502c:	01 00 00 
+  80502f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805033:	83 e0 01             	and    $0x1,%eax
+  805036:	48 85 c0             	test   %rax,%rax
+  805039:	0f 84 b9 00 00 00    	je     8050f8 <copy_shared_pages+0xfd>
+  80503f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805043:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805047:	48 89 c2             	mov    %rax,%rdx
+  80504a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805051:	01 00 00 
+  805054:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805058:	83 e0 01             	and    $0x1,%eax
+  80505b:	48 85 c0             	test   %rax,%rax
+  80505e:	0f 84 94 00 00 00    	je     8050f8 <copy_shared_pages+0xfd>
+  805064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805068:	48 c1 e8 15          	shr    $0x15,%rax
+  80506c:	48 89 c2             	mov    %rax,%rdx
+  80506f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805076:	01 00 00 
+  805079:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80507d:	83 e0 01             	and    $0x1,%eax
+  805080:	48 85 c0             	test   %rax,%rax
+  805083:	74 73                	je     8050f8 <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  805085:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805089:	48 c1 e8 0c          	shr    $0xc,%rax
+  80508d:	48 89 c2             	mov    %rax,%rdx
+  805090:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805097:	01 00 00 
+  80509a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80509e:	25 01 04 00 00       	and    $0x401,%eax
+  8050a3:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8050a9:	75 4e                	jne    8050f9 <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  8050ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050b3:	48 89 c2             	mov    %rax,%rdx
+  8050b6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050bd:	01 00 00 
+  8050c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8050c9:	89 c6                	mov    %eax,%esi
+  8050cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8050cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050d3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8050d6:	41 89 f0             	mov    %esi,%r8d
+  8050d9:	48 89 c6             	mov    %rax,%rsi
+  8050dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050e1:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8050e8:	00 00 00 
+  8050eb:	ff d0                	call   *%rax
+  8050ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  8050f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050f4:	78 21                	js     805117 <copy_shared_pages+0x11c>
+  8050f6:	eb 01                	jmp    8050f9 <copy_shared_pages+0xfe>
+      continue;
+  8050f8:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  8050f9:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  805100:	00 
+  805101:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  805108:	00 00 00 
+  80510b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80510f:	0f 83 05 ff ff ff    	jae    80501a <copy_shared_pages+0x1f>
+  805115:	eb 01                	jmp    805118 <copy_shared_pages+0x11d>
+        break;
+  805117:	90                   	nop
+    }
+  }
+  return err;
+  805118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80511b:	c9                   	leave
+  80511c:	c3                   	ret
+
+000000000080511d <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80511d:	55                   	push   %rbp
+  80511e:	48 89 e5             	mov    %rsp,%rbp
+  805121:	48 83 ec 10          	sub    $0x10,%rsp
+  805125:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  805129:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512d:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  805132:	48 89 c7             	mov    %rax,%rdi
+  805135:	48 b8 43 51 80 00 00 	movabs $0x805143,%rax
+  80513c:	00 00 00 
+  80513f:	ff d0                	call   *%rax
+}
+  805141:	c9                   	leave
+  805142:	c3                   	ret
+
+0000000000805143 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  805143:	55                   	push   %rbp
+  805144:	48 89 e5             	mov    %rsp,%rbp
+  805147:	48 83 ec 50          	sub    $0x50,%rsp
+  80514b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80514f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  805153:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80515a:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80515b:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  805160:	74 0a                	je     80516c <pipe_size+0x29>
+  805162:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  805169:	00 
+  80516a:	76 0a                	jbe    805176 <pipe_size+0x33>
+    return -E_INVAL;
+  80516c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805171:	e9 cc 02 00 00       	jmp    805442 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  805176:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80517a:	48 89 c7             	mov    %rax,%rdi
+  80517d:	48 b8 04 2f 80 00 00 	movabs $0x802f04,%rax
+  805184:	00 00 00 
+  805187:	ff d0                	call   *%rax
+  805189:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80518c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805190:	0f 88 a8 02 00 00    	js     80543e <pipe_size+0x2fb>
+  805196:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80519a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80519f:	48 89 c6             	mov    %rax,%rsi
+  8051a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a7:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8051ae:	00 00 00 
+  8051b1:	ff d0                	call   *%rax
+  8051b3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051ba:	0f 88 7e 02 00 00    	js     80543e <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8051c0:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8051c4:	48 89 c7             	mov    %rax,%rdi
+  8051c7:	48 b8 04 2f 80 00 00 	movabs $0x802f04,%rax
+  8051ce:	00 00 00 
+  8051d1:	ff d0                	call   *%rax
+  8051d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051da:	0f 88 43 02 00 00    	js     805423 <pipe_size+0x2e0>
+  8051e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051e4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8051e9:	48 89 c6             	mov    %rax,%rsi
+  8051ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051f1:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  8051f8:	00 00 00 
+  8051fb:	ff d0                	call   *%rax
+  8051fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805200:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805204:	0f 88 19 02 00 00    	js     805423 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80520a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80520e:	48 89 c7             	mov    %rax,%rdi
+  805211:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805218:	00 00 00 
+  80521b:	ff d0                	call   *%rax
+  80521d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  805221:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805228:	00 
+  805229:	e9 a2 00 00 00       	jmp    8052d0 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80522e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805232:	48 c1 e0 0c          	shl    $0xc,%rax
+  805236:	48 89 c2             	mov    %rax,%rdx
+  805239:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80523d:	48 01 d0             	add    %rdx,%rax
+  805240:	ba 07 04 00 00       	mov    $0x407,%edx
+  805245:	48 89 c6             	mov    %rax,%rsi
+  805248:	bf 00 00 00 00       	mov    $0x0,%edi
+  80524d:	48 b8 cf 27 80 00 00 	movabs $0x8027cf,%rax
+  805254:	00 00 00 
+  805257:	ff d0                	call   *%rax
+  805259:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80525c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805260:	0f 88 37 01 00 00    	js     80539d <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  805266:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80526a:	48 89 c7             	mov    %rax,%rdi
+  80526d:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805274:	00 00 00 
+  805277:	ff d0                	call   *%rax
+  805279:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80527d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  805281:	48 01 c2             	add    %rax,%rdx
+  805284:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805288:	48 c1 e0 0c          	shl    $0xc,%rax
+  80528c:	48 89 c1             	mov    %rax,%rcx
+  80528f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805293:	48 01 c8             	add    %rcx,%rax
+  805296:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80529c:	48 89 d1             	mov    %rdx,%rcx
+  80529f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052a4:	48 89 c6             	mov    %rax,%rsi
+  8052a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ac:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8052b3:	00 00 00 
+  8052b6:	ff d0                	call   *%rax
+  8052b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8052bb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8052bf:	79 0a                	jns    8052cb <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8052c1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8052c6:	e9 d3 00 00 00       	jmp    80539e <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8052cb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8052d0:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8052d7:	00 
+  8052d8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8052dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052e0:	48 01 d0             	add    %rdx,%rax
+  8052e3:	48 83 c0 1f          	add    $0x1f,%rax
+  8052e7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8052eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052f4:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8052f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052fc:	48 29 d0             	sub    %rdx,%rax
+  8052ff:	48 c1 e8 0c          	shr    $0xc,%rax
+  805303:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  805307:	0f 82 21 ff ff ff    	jb     80522e <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80530d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805311:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  805315:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805319:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80531d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  805321:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805325:	48 ba 40 88 80 00 00 	movabs $0x808840,%rdx
+  80532c:	00 00 00 
+  80532f:	8b 12                	mov    (%rdx),%edx
+  805331:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  805333:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805337:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80533e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805342:	48 ba 40 88 80 00 00 	movabs $0x808840,%rdx
+  805349:	00 00 00 
+  80534c:	8b 12                	mov    (%rdx),%edx
+  80534e:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  805350:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805354:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80535b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80535f:	48 89 c7             	mov    %rax,%rdi
+  805362:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  805369:	00 00 00 
+  80536c:	ff d0                	call   *%rax
+  80536e:	89 c2                	mov    %eax,%edx
+  805370:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805374:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  805376:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80537a:	48 89 c7             	mov    %rax,%rdi
+  80537d:	48 b8 b6 2e 80 00 00 	movabs $0x802eb6,%rax
+  805384:	00 00 00 
+  805387:	ff d0                	call   *%rax
+  805389:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80538d:	48 83 c2 04          	add    $0x4,%rdx
+  805391:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  805393:	b8 00 00 00 00       	mov    $0x0,%eax
+  805398:	e9 a5 00 00 00       	jmp    805442 <pipe_size+0x2ff>
+      goto err2;
+  80539d:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80539e:	eb 58                	jmp    8053f8 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8053a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053a4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8053a8:	48 89 c2             	mov    %rax,%rdx
+  8053ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053af:	48 01 d0             	add    %rdx,%rax
+  8053b2:	48 89 c6             	mov    %rax,%rsi
+  8053b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053ba:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  8053c1:	00 00 00 
+  8053c4:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8053c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053ca:	48 89 c7             	mov    %rax,%rdi
+  8053cd:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  8053d4:	00 00 00 
+  8053d7:	ff d0                	call   *%rax
+  8053d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8053dd:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8053e1:	48 01 d0             	add    %rdx,%rax
+  8053e4:	48 89 c6             	mov    %rax,%rsi
+  8053e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053ec:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  8053f3:	00 00 00 
+  8053f6:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8053f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805400:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  805404:	48 85 c0             	test   %rax,%rax
+  805407:	75 97                	jne    8053a0 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  805409:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80540d:	48 89 c6             	mov    %rax,%rsi
+  805410:	bf 00 00 00 00       	mov    $0x0,%edi
+  805415:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  80541c:	00 00 00 
+  80541f:	ff d0                	call   *%rax
+  805421:	eb 01                	jmp    805424 <pipe_size+0x2e1>
+    goto err1;
+  805423:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  805424:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805428:	48 89 c6             	mov    %rax,%rsi
+  80542b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805430:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  805437:	00 00 00 
+  80543a:	ff d0                	call   *%rax
+  80543c:	eb 01                	jmp    80543f <pipe_size+0x2fc>
+    goto err;
+  80543e:	90                   	nop
+err:
+  return r;
+  80543f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805442:	c9                   	leave
+  805443:	c3                   	ret
+
+0000000000805444 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  805444:	55                   	push   %rbp
+  805445:	48 89 e5             	mov    %rsp,%rbp
+  805448:	53                   	push   %rbx
+  805449:	48 83 ec 28          	sub    $0x28,%rsp
+  80544d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805451:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  805455:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80545c:	00 00 00 
+  80545f:	8b 40 04             	mov    0x4(%rax),%eax
+  805462:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805467:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80546e:	00 00 00 
+  805471:	48 98                	cltq
+  805473:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80547a:	48 01 d0             	add    %rdx,%rax
+  80547d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805483:	8b 00                	mov    (%rax),%eax
+  805485:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  805488:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80548c:	48 89 c7             	mov    %rax,%rdi
+  80548f:	48 b8 5b 60 80 00 00 	movabs $0x80605b,%rax
+  805496:	00 00 00 
+  805499:	ff d0                	call   *%rax
+  80549b:	89 c3                	mov    %eax,%ebx
+  80549d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054a1:	48 89 c7             	mov    %rax,%rdi
+  8054a4:	48 b8 5b 60 80 00 00 	movabs $0x80605b,%rax
+  8054ab:	00 00 00 
+  8054ae:	ff d0                	call   *%rax
+  8054b0:	39 c3                	cmp    %eax,%ebx
+  8054b2:	0f 94 c0             	sete   %al
+  8054b5:	0f b6 c0             	movzbl %al,%eax
+  8054b8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8054bb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8054c2:	00 00 00 
+  8054c5:	8b 40 04             	mov    0x4(%rax),%eax
+  8054c8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8054cd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8054d4:	00 00 00 
+  8054d7:	48 98                	cltq
+  8054d9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8054e0:	48 01 d0             	add    %rdx,%rax
+  8054e3:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8054e9:	8b 00                	mov    (%rax),%eax
+  8054eb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8054ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054f1:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8054f4:	75 05                	jne    8054fb <_pipeisclosed+0xb7>
+      return ret;
+  8054f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054f9:	eb 68                	jmp    805563 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8054fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054fe:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805501:	0f 84 4e ff ff ff    	je     805455 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  805507:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80550e:	00 00 00 
+  805511:	8b 40 04             	mov    0x4(%rax),%eax
+  805514:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805519:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805520:	00 00 00 
+  805523:	48 98                	cltq
+  805525:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80552c:	48 01 d0             	add    %rdx,%rax
+  80552f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805535:	8b 10                	mov    (%rax),%edx
+  805537:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80553a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80553d:	89 c6                	mov    %eax,%esi
+  80553f:	48 b8 70 69 80 00 00 	movabs $0x806970,%rax
+  805546:	00 00 00 
+  805549:	48 89 c7             	mov    %rax,%rdi
+  80554c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805551:	49 b8 51 0a 80 00 00 	movabs $0x800a51,%r8
+  805558:	00 00 00 
+  80555b:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80555e:	e9 f2 fe ff ff       	jmp    805455 <_pipeisclosed+0x11>
+  }
+}
+  805563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805567:	c9                   	leave
+  805568:	c3                   	ret
+
+0000000000805569 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  805569:	55                   	push   %rbp
+  80556a:	48 89 e5             	mov    %rsp,%rbp
+  80556d:	48 83 ec 30          	sub    $0x30,%rsp
+  805571:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805574:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805578:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80557b:	48 89 d6             	mov    %rdx,%rsi
+  80557e:	89 c7                	mov    %eax,%edi
+  805580:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  805587:	00 00 00 
+  80558a:	ff d0                	call   *%rax
+  80558c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80558f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805593:	79 05                	jns    80559a <pipeisclosed+0x31>
+    return r;
+  805595:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805598:	eb 31                	jmp    8055cb <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80559a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80559e:	48 89 c7             	mov    %rax,%rdi
+  8055a1:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  8055a8:	00 00 00 
+  8055ab:	ff d0                	call   *%rax
+  8055ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8055b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8055b9:	48 89 d6             	mov    %rdx,%rsi
+  8055bc:	48 89 c7             	mov    %rax,%rdi
+  8055bf:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  8055c6:	00 00 00 
+  8055c9:	ff d0                	call   *%rax
+}
+  8055cb:	c9                   	leave
+  8055cc:	c3                   	ret
+
+00000000008055cd <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8055cd:	55                   	push   %rbp
+  8055ce:	48 89 e5             	mov    %rsp,%rbp
+  8055d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8055d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8055d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055dd:	8b 40 18             	mov    0x18(%rax),%eax
+  8055e0:	8d 50 01             	lea    0x1(%rax),%edx
+  8055e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055e7:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8055ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055ee:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8055f1:	85 c0                	test   %eax,%eax
+  8055f3:	74 27                	je     80561c <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8055f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055f9:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805604:	48 83 c0 18          	add    $0x18,%rax
+  805608:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80560d:	48 89 c7             	mov    %rax,%rdi
+  805610:	48 b8 ca 2b 80 00 00 	movabs $0x802bca,%rax
+  805617:	00 00 00 
+  80561a:	ff d0                	call   *%rax
+  }
+}
+  80561c:	90                   	nop
+  80561d:	c9                   	leave
+  80561e:	c3                   	ret
+
+000000000080561f <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80561f:	55                   	push   %rbp
+  805620:	48 89 e5             	mov    %rsp,%rbp
+  805623:	48 83 ec 10          	sub    $0x10,%rsp
+  805627:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80562b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80562e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805632:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  805639:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80563d:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805641:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805644:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80564b:	89 c6                	mov    %eax,%esi
+  80564d:	48 89 cf             	mov    %rcx,%rdi
+  805650:	48 b8 7b 2b 80 00 00 	movabs $0x802b7b,%rax
+  805657:	00 00 00 
+  80565a:	ff d0                	call   *%rax
+}
+  80565c:	90                   	nop
+  80565d:	c9                   	leave
+  80565e:	c3                   	ret
+
+000000000080565f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80565f:	55                   	push   %rbp
+  805660:	48 89 e5             	mov    %rsp,%rbp
+  805663:	48 83 ec 70          	sub    $0x70,%rsp
+  805667:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80566b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80566f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805673:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805677:	48 89 c7             	mov    %rax,%rdi
+  80567a:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805681:	00 00 00 
+  805684:	ff d0                	call   *%rax
+  805686:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80568a:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80568f:	75 0a                	jne    80569b <devpipe_read+0x3c>
+    return 0;
+  805691:	b8 00 00 00 00       	mov    $0x0,%eax
+  805696:	e9 63 01 00 00       	jmp    8057fe <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80569b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80569f:	8b 40 18             	mov    0x18(%rax),%eax
+  8056a2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8056a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056a9:	48 8b 10             	mov    (%rax),%rdx
+  8056ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8056b4:	48 39 c2             	cmp    %rax,%rdx
+  8056b7:	75 42                	jne    8056fb <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8056b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8056bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8056c1:	48 89 d6             	mov    %rdx,%rsi
+  8056c4:	48 89 c7             	mov    %rax,%rdi
+  8056c7:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  8056ce:	00 00 00 
+  8056d1:	ff d0                	call   *%rax
+  8056d3:	85 c0                	test   %eax,%eax
+  8056d5:	74 0a                	je     8056e1 <devpipe_read+0x82>
+      return 0;
+  8056d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056dc:	e9 1d 01 00 00       	jmp    8057fe <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8056e1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8056e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056e8:	89 d6                	mov    %edx,%esi
+  8056ea:	48 89 c7             	mov    %rax,%rdi
+  8056ed:	48 b8 1f 56 80 00 00 	movabs $0x80561f,%rax
+  8056f4:	00 00 00 
+  8056f7:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8056f9:	eb a0                	jmp    80569b <devpipe_read+0x3c>
+      break;
+  8056fb:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8056fc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805700:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  805704:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805708:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80570c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805710:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805718:	48 8b 00             	mov    (%rax),%rax
+  80571b:	48 29 c2             	sub    %rax,%rdx
+  80571e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805722:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805726:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80572a:	48 39 c2             	cmp    %rax,%rdx
+  80572d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805731:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  805735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805739:	48 8b 00             	mov    (%rax),%rax
+  80573c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805740:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805744:	ba 00 00 00 00       	mov    $0x0,%edx
+  805749:	48 f7 f1             	div    %rcx
+  80574c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805750:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805754:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80575c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805760:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805768:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80576c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805770:	48 39 c2             	cmp    %rax,%rdx
+  805773:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805777:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80577b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80577f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  805783:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805787:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80578b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80578f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805793:	48 89 ce             	mov    %rcx,%rsi
+  805796:	48 89 c7             	mov    %rax,%rdi
+  805799:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  8057a0:	00 00 00 
+  8057a3:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8057a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8057a9:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8057ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8057b1:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8057b5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8057b9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8057bd:	48 01 d1             	add    %rdx,%rcx
+  8057c0:	48 89 c2             	mov    %rax,%rdx
+  8057c3:	48 89 cf             	mov    %rcx,%rdi
+  8057c6:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  8057cd:	00 00 00 
+  8057d0:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8057d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057d6:	48 8b 10             	mov    (%rax),%rdx
+  8057d9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8057dd:	48 01 c2             	add    %rax,%rdx
+  8057e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057e4:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8057e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057eb:	48 89 c7             	mov    %rax,%rdi
+  8057ee:	48 b8 cd 55 80 00 00 	movabs $0x8055cd,%rax
+  8057f5:	00 00 00 
+  8057f8:	ff d0                	call   *%rax
+  return n;
+  8057fa:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8057fe:	c9                   	leave
+  8057ff:	c3                   	ret
+
+0000000000805800 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805800:	55                   	push   %rbp
+  805801:	48 89 e5             	mov    %rsp,%rbp
+  805804:	48 83 ec 70          	sub    $0x70,%rsp
+  805808:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80580c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805810:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805814:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805818:	48 89 c7             	mov    %rax,%rdi
+  80581b:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805822:	00 00 00 
+  805825:	ff d0                	call   *%rax
+  805827:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80582b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80582f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805833:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80583a:	00 
+  80583b:	e9 b8 01 00 00       	jmp    8059f8 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805844:	8b 40 18             	mov    0x18(%rax),%eax
+  805847:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80584a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80584e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805856:	48 8b 00             	mov    (%rax),%rax
+  805859:	48 29 c2             	sub    %rax,%rdx
+  80585c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805860:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805864:	48 39 c2             	cmp    %rax,%rdx
+  805867:	75 4d                	jne    8058b6 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  805869:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80586d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805871:	48 89 d6             	mov    %rdx,%rsi
+  805874:	48 89 c7             	mov    %rax,%rdi
+  805877:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  80587e:	00 00 00 
+  805881:	ff d0                	call   *%rax
+  805883:	85 c0                	test   %eax,%eax
+  805885:	74 0a                	je     805891 <devpipe_write+0x91>
+        return 0;
+  805887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80588c:	e9 79 01 00 00       	jmp    805a0a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805891:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805894:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805898:	89 d6                	mov    %edx,%esi
+  80589a:	48 89 c7             	mov    %rax,%rdi
+  80589d:	48 b8 1f 56 80 00 00 	movabs $0x80561f,%rax
+  8058a4:	00 00 00 
+  8058a7:	ff d0                	call   *%rax
+      m = 0;
+  8058a9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8058b0:	00 
+      continue;
+  8058b1:	e9 3a 01 00 00       	jmp    8059f0 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8058b6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8058ba:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8058be:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8058c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058c6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8058ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058ce:	48 8b 08             	mov    (%rax),%rcx
+  8058d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8058d9:	48 29 c1             	sub    %rax,%rcx
+  8058dc:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8058e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8058e4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8058e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058ec:	48 39 c2             	cmp    %rax,%rdx
+  8058ef:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8058f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8058f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8058ff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805903:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805907:	ba 00 00 00 00       	mov    $0x0,%edx
+  80590c:	48 f7 f1             	div    %rcx
+  80590f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805913:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805917:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80591b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80591f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805923:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805927:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80592b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80592f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805933:	48 39 c2             	cmp    %rax,%rdx
+  805936:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80593a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80593e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805942:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805946:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80594a:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80594e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805952:	48 01 d1             	add    %rdx,%rcx
+  805955:	48 89 c2             	mov    %rax,%rdx
+  805958:	48 89 cf             	mov    %rcx,%rdi
+  80595b:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  805962:	00 00 00 
+  805965:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805967:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80596b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80596f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805973:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805977:	73 4d                	jae    8059c6 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80597d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805981:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805985:	48 29 c2             	sub    %rax,%rdx
+  805988:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80598c:	48 01 c2             	add    %rax,%rdx
+  80598f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805993:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805997:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80599b:	48 89 c1             	mov    %rax,%rcx
+  80599e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059a2:	48 01 c1             	add    %rax,%rcx
+  8059a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059a9:	48 01 c1             	add    %rax,%rcx
+  8059ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059b0:	48 83 c0 20          	add    $0x20,%rax
+  8059b4:	48 89 ce             	mov    %rcx,%rsi
+  8059b7:	48 89 c7             	mov    %rax,%rdi
+  8059ba:	48 b8 4a 21 80 00 00 	movabs $0x80214a,%rax
+  8059c1:	00 00 00 
+  8059c4:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8059c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059ca:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8059ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059d2:	48 01 c2             	add    %rax,%rdx
+  8059d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059d9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8059dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059e1:	48 89 c7             	mov    %rax,%rdi
+  8059e4:	48 b8 cd 55 80 00 00 	movabs $0x8055cd,%rax
+  8059eb:	00 00 00 
+  8059ee:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8059f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059f4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8059f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059fc:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805a00:	0f 82 3a fe ff ff    	jb     805840 <devpipe_write+0x40>
+  }
+
+  return i;
+  805a06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805a0a:	c9                   	leave
+  805a0b:	c3                   	ret
+
+0000000000805a0c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805a0c:	55                   	push   %rbp
+  805a0d:	48 89 e5             	mov    %rsp,%rbp
+  805a10:	48 83 ec 40          	sub    $0x40,%rsp
+  805a14:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805a18:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805a1b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805a1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a23:	48 89 c7             	mov    %rax,%rdi
+  805a26:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805a2d:	00 00 00 
+  805a30:	ff d0                	call   *%rax
+  805a32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805a36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805a3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a41:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805a45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a49:	48 89 d6             	mov    %rdx,%rsi
+  805a4c:	48 89 c7             	mov    %rax,%rdi
+  805a4f:	48 b8 ac 39 80 00 00 	movabs $0x8039ac,%rax
+  805a56:	00 00 00 
+  805a59:	ff d0                	call   *%rax
+  805a5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a62:	79 08                	jns    805a6c <devpipe_poll+0x60>
+    return r;
+  805a64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a67:	e9 85 00 00 00       	jmp    805af1 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805a6c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805a6f:	83 e0 01             	and    $0x1,%eax
+  805a72:	85 c0                	test   %eax,%eax
+  805a74:	74 18                	je     805a8e <devpipe_poll+0x82>
+  805a76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a7a:	48 8b 10             	mov    (%rax),%rdx
+  805a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a81:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805a85:	48 39 c2             	cmp    %rax,%rdx
+  805a88:	74 04                	je     805a8e <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805a8a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805a8e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805a91:	83 e0 02             	and    $0x2,%eax
+  805a94:	85 c0                	test   %eax,%eax
+  805a96:	74 23                	je     805abb <devpipe_poll+0xaf>
+  805a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a9c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805aa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805aa4:	48 8b 00             	mov    (%rax),%rax
+  805aa7:	48 29 c2             	sub    %rax,%rdx
+  805aaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805aae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805ab2:	48 39 c2             	cmp    %rax,%rdx
+  805ab5:	73 04                	jae    805abb <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805ab7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805abb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805abf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ac3:	48 89 d6             	mov    %rdx,%rsi
+  805ac6:	48 89 c7             	mov    %rax,%rdi
+  805ac9:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  805ad0:	00 00 00 
+  805ad3:	ff d0                	call   *%rax
+  805ad5:	85 c0                	test   %eax,%eax
+  805ad7:	74 04                	je     805add <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805ad9:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805add:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ae1:	75 0b                	jne    805aee <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ae7:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805aee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805af1:	c9                   	leave
+  805af2:	c3                   	ret
+
+0000000000805af3 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805af3:	55                   	push   %rbp
+  805af4:	48 89 e5             	mov    %rsp,%rbp
+  805af7:	48 83 ec 20          	sub    $0x20,%rsp
+  805afb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805aff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805b03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b07:	48 89 c7             	mov    %rax,%rdi
+  805b0a:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805b11:	00 00 00 
+  805b14:	ff d0                	call   *%rax
+  805b16:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805b1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b1e:	48 ba a1 69 80 00 00 	movabs $0x8069a1,%rdx
+  805b25:	00 00 00 
+  805b28:	48 89 d6             	mov    %rdx,%rsi
+  805b2b:	48 89 c7             	mov    %rax,%rdi
+  805b2e:	48 b8 01 1a 80 00 00 	movabs $0x801a01,%rax
+  805b35:	00 00 00 
+  805b38:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805b3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805b42:	89 c1                	mov    %eax,%ecx
+  805b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b48:	48 8b 00             	mov    (%rax),%rax
+  805b4b:	89 c2                	mov    %eax,%edx
+  805b4d:	89 c8                	mov    %ecx,%eax
+  805b4f:	29 d0                	sub    %edx,%eax
+  805b51:	89 c2                	mov    %eax,%edx
+  805b53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b57:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805b5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b61:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805b68:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805b6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b6f:	48 b9 40 88 80 00 00 	movabs $0x808840,%rcx
+  805b76:	00 00 00 
+  805b79:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805b80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b85:	c9                   	leave
+  805b86:	c3                   	ret
+
+0000000000805b87 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805b87:	55                   	push   %rbp
+  805b88:	48 89 e5             	mov    %rsp,%rbp
+  805b8b:	48 83 ec 40          	sub    $0x40,%rsp
+  805b8f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805b93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b97:	48 89 c7             	mov    %rax,%rdi
+  805b9a:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  805ba1:	00 00 00 
+  805ba4:	ff d0                	call   *%rax
+  805ba6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805baa:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805bb1:	00 
+  805bb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bb6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805bba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bbe:	48 01 d0             	add    %rdx,%rax
+  805bc1:	48 83 c0 1f          	add    $0x1f,%rax
+  805bc5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805bc9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  805bd2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805bd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bda:	48 29 d0             	sub    %rdx,%rax
+  805bdd:	48 c1 e8 0c          	shr    $0xc,%rax
+  805be1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805be5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805be9:	48 89 c6             	mov    %rax,%rsi
+  805bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bf1:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  805bf8:	00 00 00 
+  805bfb:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805bfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c01:	48 89 c7             	mov    %rax,%rdi
+  805c04:	48 b8 cd 55 80 00 00 	movabs $0x8055cd,%rax
+  805c0b:	00 00 00 
+  805c0e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805c10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c14:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805c18:	eb 2f                	jmp    805c49 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805c1e:	48 83 e8 01          	sub    $0x1,%rax
+  805c22:	48 c1 e0 0c          	shl    $0xc,%rax
+  805c26:	48 89 c2             	mov    %rax,%rdx
+  805c29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c2d:	48 01 d0             	add    %rdx,%rax
+  805c30:	48 89 c6             	mov    %rax,%rsi
+  805c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c38:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  805c3f:	00 00 00 
+  805c42:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805c44:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805c49:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805c4e:	77 ca                	ja     805c1a <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c54:	48 89 c6             	mov    %rax,%rsi
+  805c57:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c5c:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  805c63:	00 00 00 
+  805c66:	ff d0                	call   *%rax
+}
+  805c68:	c9                   	leave
+  805c69:	c3                   	ret
+
+0000000000805c6a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805c6a:	55                   	push   %rbp
+  805c6b:	48 89 e5             	mov    %rsp,%rbp
+  805c6e:	48 83 ec 10          	sub    $0x10,%rsp
+  805c72:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805c75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c78:	be 00 00 00 00       	mov    $0x0,%esi
+  805c7d:	89 c7                	mov    %eax,%edi
+  805c7f:	48 b8 8e 5c 80 00 00 	movabs $0x805c8e,%rax
+  805c86:	00 00 00 
+  805c89:	ff d0                	call   *%rax
+}
+  805c8b:	90                   	nop
+  805c8c:	c9                   	leave
+  805c8d:	c3                   	ret
+
+0000000000805c8e <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805c8e:	55                   	push   %rbp
+  805c8f:	48 89 e5             	mov    %rsp,%rbp
+  805c92:	48 83 ec 10          	sub    $0x10,%rsp
+  805c96:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805c99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805c9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ca1:	75 3e                	jne    805ce1 <waitpid+0x53>
+  805ca3:	48 b8 a8 69 80 00 00 	movabs $0x8069a8,%rax
+  805caa:	00 00 00 
+  805cad:	48 89 c1             	mov    %rax,%rcx
+  805cb0:	48 b8 b3 69 80 00 00 	movabs $0x8069b3,%rax
+  805cb7:	00 00 00 
+  805cba:	48 89 c2             	mov    %rax,%rdx
+  805cbd:	be 0e 00 00 00       	mov    $0xe,%esi
+  805cc2:	48 b8 c8 69 80 00 00 	movabs $0x8069c8,%rax
+  805cc9:	00 00 00 
+  805ccc:	48 89 c7             	mov    %rax,%rdi
+  805ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cd4:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  805cdb:	00 00 00 
+  805cde:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805ce1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805ce6:	74 0a                	je     805cf2 <waitpid+0x64>
+    *status = 0;
+  805ce8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805cec:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805cf2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805cf6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cf9:	48 89 d6             	mov    %rdx,%rsi
+  805cfc:	89 c7                	mov    %eax,%edi
+  805cfe:	48 b8 ce 26 80 00 00 	movabs $0x8026ce,%rax
+  805d05:	00 00 00 
+  805d08:	ff d0                	call   *%rax
+}
+  805d0a:	c9                   	leave
+  805d0b:	c3                   	ret
+
+0000000000805d0c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805d0c:	55                   	push   %rbp
+  805d0d:	48 89 e5             	mov    %rsp,%rbp
+  805d10:	48 83 ec 08          	sub    $0x8,%rsp
+  805d14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805d17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d1b:	75 10                	jne    805d2d <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805d1d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d24:	00 00 00 
+  805d27:	8b 00                	mov    (%rax),%eax
+  805d29:	48 98                	cltq
+  805d2b:	eb 05                	jmp    805d32 <vsyscall+0x26>
+  }
+  return 0;
+  805d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d32:	c9                   	leave
+  805d33:	c3                   	ret
+
+0000000000805d34 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805d34:	55                   	push   %rbp
+  805d35:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d3d:	48 b8 0c 5d 80 00 00 	movabs $0x805d0c,%rax
+  805d44:	00 00 00 
+  805d47:	ff d0                	call   *%rax
+}
+  805d49:	5d                   	pop    %rbp
+  805d4a:	c3                   	ret
+
+0000000000805d4b <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805d4b:	55                   	push   %rbp
+  805d4c:	48 89 e5             	mov    %rsp,%rbp
+  805d4f:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805d53:	0f 31                	rdtsc
+  805d55:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d58:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805d5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d5e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d61:	48 c1 e2 20          	shl    $0x20,%rdx
+  805d65:	48 09 d0             	or     %rdx,%rax
+  805d68:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805d6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805d70:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805d74:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d7b:	00 00 00 
+  805d7e:	8b 40 08             	mov    0x8(%rax),%eax
+  805d81:	48 98                	cltq
+  805d83:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d90:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805d94:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805d9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805da4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805da8:	48 89 d0             	mov    %rdx,%rax
+  805dab:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  805db7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805dbb:	48 01 c8             	add    %rcx,%rax
+}
+  805dbe:	c9                   	leave
+  805dbf:	c3                   	ret
+
+0000000000805dc0 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805dc0:	55                   	push   %rbp
+  805dc1:	48 89 e5             	mov    %rsp,%rbp
+  805dc4:	48 83 ec 20          	sub    $0x20,%rsp
+  805dc8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805dcc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805dd0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805dd4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805dd8:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805ddc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805de0:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805de7:	48 89 c7             	mov    %rax,%rdi
+  805dea:	48 b8 f8 5d 80 00 00 	movabs $0x805df8,%rax
+  805df1:	00 00 00 
+  805df4:	ff d0                	call   *%rax
+}
+  805df6:	c9                   	leave
+  805df7:	c3                   	ret
+
+0000000000805df8 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805df8:	55                   	push   %rbp
+  805df9:	48 89 e5             	mov    %rsp,%rbp
+  805dfc:	48 83 ec 30          	sub    $0x30,%rsp
+  805e00:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805e04:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805e08:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805e0c:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805e10:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805e15:	75 0e                	jne    805e25 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805e17:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e1e:	00 00 00 
+  805e21:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805e25:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805e2a:	75 18                	jne    805e44 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805e2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e30:	48 89 c7             	mov    %rax,%rdi
+  805e33:	48 b8 0f 2a 80 00 00 	movabs $0x802a0f,%rax
+  805e3a:	00 00 00 
+  805e3d:	ff d0                	call   *%rax
+  805e3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e42:	eb 1d                	jmp    805e61 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805e44:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e4c:	48 89 d6             	mov    %rdx,%rsi
+  805e4f:	48 89 c7             	mov    %rax,%rdi
+  805e52:	48 b8 55 2a 80 00 00 	movabs $0x802a55,%rax
+  805e59:	00 00 00 
+  805e5c:	ff d0                	call   *%rax
+  805e5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805e61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e65:	79 2a                	jns    805e91 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805e67:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e6c:	74 0a                	je     805e78 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e72:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805e78:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e7d:	74 0a                	je     805e89 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805e7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e83:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805e89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e8c:	e9 aa 00 00 00       	jmp    805f3b <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805e91:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e96:	74 36                	je     805ece <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805e98:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e9f:	00 00 00 
+  805ea2:	8b 40 04             	mov    0x4(%rax),%eax
+  805ea5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805eaa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805eb1:	00 00 00 
+  805eb4:	48 98                	cltq
+  805eb6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ebd:	48 01 d0             	add    %rdx,%rax
+  805ec0:	48 05 24 01 00 00    	add    $0x124,%rax
+  805ec6:	8b 10                	mov    (%rax),%edx
+  805ec8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ecc:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805ece:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805ed3:	74 36                	je     805f0b <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805ed5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805edc:	00 00 00 
+  805edf:	8b 40 04             	mov    0x4(%rax),%eax
+  805ee2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ee7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805eee:	00 00 00 
+  805ef1:	48 98                	cltq
+  805ef3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805efa:	48 01 d0             	add    %rdx,%rax
+  805efd:	48 05 28 01 00 00    	add    $0x128,%rax
+  805f03:	8b 10                	mov    (%rax),%edx
+  805f05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f09:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805f0b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805f12:	00 00 00 
+  805f15:	8b 40 04             	mov    0x4(%rax),%eax
+  805f18:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805f1d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805f24:	00 00 00 
+  805f27:	48 98                	cltq
+  805f29:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805f30:	48 01 d0             	add    %rdx,%rax
+  805f33:	48 05 20 01 00 00    	add    $0x120,%rax
+  805f39:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805f3b:	c9                   	leave
+  805f3c:	c3                   	ret
+
+0000000000805f3d <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805f3d:	55                   	push   %rbp
+  805f3e:	48 89 e5             	mov    %rsp,%rbp
+  805f41:	48 83 ec 30          	sub    $0x30,%rsp
+  805f45:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f48:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805f4b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805f4f:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805f52:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805f57:	75 5e                	jne    805fb7 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805f59:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805f60:	00 00 00 
+  805f63:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f67:	eb 4e                	jmp    805fb7 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805f69:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f6d:	79 3c                	jns    805fab <ipc_send+0x6e>
+  805f6f:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805f73:	74 36                	je     805fab <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805f75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f78:	89 c1                	mov    %eax,%ecx
+  805f7a:	48 b8 d8 69 80 00 00 	movabs $0x8069d8,%rax
+  805f81:	00 00 00 
+  805f84:	48 89 c2             	mov    %rax,%rdx
+  805f87:	be 54 00 00 00       	mov    $0x54,%esi
+  805f8c:	48 b8 fe 69 80 00 00 	movabs $0x8069fe,%rax
+  805f93:	00 00 00 
+  805f96:	48 89 c7             	mov    %rax,%rdi
+  805f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f9e:	49 b8 32 08 80 00 00 	movabs $0x800832,%r8
+  805fa5:	00 00 00 
+  805fa8:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805fab:	48 b8 92 27 80 00 00 	movabs $0x802792,%rax
+  805fb2:	00 00 00 
+  805fb5:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805fb7:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805fba:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805fbd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805fc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fc4:	89 c7                	mov    %eax,%edi
+  805fc6:	48 b8 b8 29 80 00 00 	movabs $0x8029b8,%rax
+  805fcd:	00 00 00 
+  805fd0:	ff d0                	call   *%rax
+  805fd2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805fd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fd9:	75 8e                	jne    805f69 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805fdb:	48 b8 92 27 80 00 00 	movabs $0x802792,%rax
+  805fe2:	00 00 00 
+  805fe5:	ff d0                	call   *%rax
+}
+  805fe7:	90                   	nop
+  805fe8:	c9                   	leave
+  805fe9:	c3                   	ret
+
+0000000000805fea <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805fea:	55                   	push   %rbp
+  805feb:	48 89 e5             	mov    %rsp,%rbp
+  805fee:	48 83 ec 18          	sub    $0x18,%rsp
+  805ff2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805ff5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805ffc:	eb 4d                	jmp    80604b <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805ffe:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806005:	00 00 00 
+  806008:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80600b:	48 98                	cltq
+  80600d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806014:	48 01 d0             	add    %rdx,%rax
+  806017:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  80601d:	8b 00                	mov    (%rax),%eax
+  80601f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  806022:	75 23                	jne    806047 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  806024:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80602b:	00 00 00 
+  80602e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806031:	48 98                	cltq
+  806033:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80603a:	48 01 d0             	add    %rdx,%rax
+  80603d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806043:	8b 00                	mov    (%rax),%eax
+  806045:	eb 12                	jmp    806059 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806047:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80604b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806052:	7e aa                	jle    805ffe <ipc_find_env+0x14>
+  return 0;
+  806054:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806059:	c9                   	leave
+  80605a:	c3                   	ret
+
+000000000080605b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80605b:	55                   	push   %rbp
+  80605c:	48 89 e5             	mov    %rsp,%rbp
+  80605f:	48 83 ec 18          	sub    $0x18,%rsp
+  806063:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806067:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80606b:	48 c1 e8 27          	shr    $0x27,%rax
+  80606f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806074:	48 89 c2             	mov    %rax,%rdx
+  806077:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80607e:	01 00 00 
+  806081:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806085:	83 e0 01             	and    $0x1,%eax
+  806088:	48 85 c0             	test   %rax,%rax
+  80608b:	74 63                	je     8060f0 <pageref+0x95>
+  80608d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806091:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806095:	48 89 c2             	mov    %rax,%rdx
+  806098:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80609f:	01 00 00 
+  8060a2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060a6:	83 e0 01             	and    $0x1,%eax
+  8060a9:	48 85 c0             	test   %rax,%rax
+  8060ac:	74 42                	je     8060f0 <pageref+0x95>
+  8060ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060b2:	48 c1 e8 15          	shr    $0x15,%rax
+  8060b6:	48 89 c2             	mov    %rax,%rdx
+  8060b9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8060c0:	01 00 00 
+  8060c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060c7:	83 e0 01             	and    $0x1,%eax
+  8060ca:	48 85 c0             	test   %rax,%rax
+  8060cd:	74 21                	je     8060f0 <pageref+0x95>
+  8060cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060d3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060d7:	48 89 c2             	mov    %rax,%rdx
+  8060da:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8060e1:	01 00 00 
+  8060e4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060e8:	83 e0 01             	and    $0x1,%eax
+  8060eb:	48 85 c0             	test   %rax,%rax
+  8060ee:	75 07                	jne    8060f7 <pageref+0x9c>
+    return 0;
+  8060f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060f5:	eb 53                	jmp    80614a <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8060f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060fb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060ff:	48 89 c2             	mov    %rax,%rdx
+  806102:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806109:	01 00 00 
+  80610c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806110:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  806114:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806118:	83 e0 01             	and    $0x1,%eax
+  80611b:	48 85 c0             	test   %rax,%rax
+  80611e:	75 07                	jne    806127 <pageref+0xcc>
+    return 0;
+  806120:	b8 00 00 00 00       	mov    $0x0,%eax
+  806125:	eb 23                	jmp    80614a <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806127:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80612b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80612f:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  806136:	00 00 00 
+  806139:	48 c1 e0 04          	shl    $0x4,%rax
+  80613d:	48 01 d0             	add    %rdx,%rax
+  806140:	48 83 c0 08          	add    $0x8,%rax
+  806144:	0f b7 00             	movzwl (%rax),%eax
+  806147:	0f b7 c0             	movzwl %ax,%eax
+}
+  80614a:	c9                   	leave
+  80614b:	c3                   	ret
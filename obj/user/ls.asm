@@ -0,0 +1,9030 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 2b 05 00 00       	call   800557 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <ls>:
+
+void lsdir(const char *, const char *);
+void ls1(const char *, bool, off_t, const char *);
+
+void
+ls(const char *path, const char *prefix) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80003d:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  800044:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  int r;
+  struct Stat st;
+
+  if ((r = stat(path, &st)) < 0)
+  80004b:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  800052:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800059:	48 89 d6             	mov    %rdx,%rsi
+  80005c:	48 89 c7             	mov    %rax,%rdi
+  80005f:	48 b8 6a 3e 80 00 00 	movabs $0x803e6a,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+  80006b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80006e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800072:	79 41                	jns    8000b5 <ls+0x83>
+    panic("stat %s: %i", path, r);
+  800074:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800077:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80007e:	41 89 d0             	mov    %edx,%r8d
+  800081:	48 89 c1             	mov    %rax,%rcx
+  800084:	48 b8 c0 5a 80 00 00 	movabs $0x805ac0,%rax
+  80008b:	00 00 00 
+  80008e:	48 89 c2             	mov    %rax,%rdx
+  800091:	be 0e 00 00 00       	mov    $0xe,%esi
+  800096:	48 b8 cc 5a 80 00 00 	movabs $0x805acc,%rax
+  80009d:	00 00 00 
+  8000a0:	48 89 c7             	mov    %rax,%rdi
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	49 b9 fe 05 80 00 00 	movabs $0x8005fe,%r9
+  8000af:	00 00 00 
+  8000b2:	41 ff d1             	call   *%r9
+  if (st.st_isdir && !flag['d'])
+  8000b5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000b8:	85 c0                	test   %eax,%eax
+  8000ba:	74 36                	je     8000f2 <ls+0xc0>
+  8000bc:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000c3:	00 00 00 
+  8000c6:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+  8000cc:	85 c0                	test   %eax,%eax
+  8000ce:	75 22                	jne    8000f2 <ls+0xc0>
+    lsdir(path, prefix);
+  8000d0:	48 8b 95 50 ff ff ff 	mov    -0xb0(%rbp),%rdx
+  8000d7:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8000de:	48 89 d6             	mov    %rdx,%rsi
+  8000e1:	48 89 c7             	mov    %rax,%rdi
+  8000e4:	48 b8 1e 01 80 00 00 	movabs $0x80011e,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+  8000f0:	eb 29                	jmp    80011b <ls+0xe9>
+  else
+    ls1(0, st.st_isdir, st.st_size, path);
+  8000f2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8000f5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000f8:	85 c0                	test   %eax,%eax
+  8000fa:	0f 95 c0             	setne  %al
+  8000fd:	0f b6 c0             	movzbl %al,%eax
+  800100:	48 8b 8d 58 ff ff ff 	mov    -0xa8(%rbp),%rcx
+  800107:	89 c6                	mov    %eax,%esi
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	90                   	nop
+  80011b:	90                   	nop
+  80011c:	c9                   	leave
+  80011d:	c3                   	ret
+
+000000000080011e <lsdir>:
+
+void
+lsdir(const char *path, const char *prefix) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800129:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800130:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  int fd, n;
+  struct File f;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  800137:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80013e:	be 00 00 00 00       	mov    $0x0,%esi
+  800143:	48 89 c7             	mov    %rax,%rdi
+  800146:	48 b8 58 3f 80 00 00 	movabs $0x803f58,%rax
+  80014d:	00 00 00 
+  800150:	ff d0                	call   *%rax
+  800152:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800155:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800159:	79 7e                	jns    8001d9 <lsdir+0xbb>
+    panic("open %s: %i", path, fd);
+  80015b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80015e:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  800165:	41 89 d0             	mov    %edx,%r8d
+  800168:	48 89 c1             	mov    %rax,%rcx
+  80016b:	48 b8 d6 5a 80 00 00 	movabs $0x805ad6,%rax
+  800172:	00 00 00 
+  800175:	48 89 c2             	mov    %rax,%rdx
+  800178:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80017d:	48 b8 cc 5a 80 00 00 	movabs $0x805acc,%rax
+  800184:	00 00 00 
+  800187:	48 89 c7             	mov    %rax,%rdi
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	49 b9 fe 05 80 00 00 	movabs $0x8005fe,%r9
+  800196:	00 00 00 
+  800199:	41 ff d1             	call   *%r9
+  while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+    if (f.f_name[0])
+  80019c:	0f b6 85 f0 fe ff ff 	movzbl -0x110(%rbp),%eax
+  8001a3:	84 c0                	test   %al,%al
+  8001a5:	74 32                	je     8001d9 <lsdir+0xbb>
+      ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001a7:	8b 95 70 ff ff ff    	mov    -0x90(%rbp),%edx
+  8001ad:	8b 85 74 ff ff ff    	mov    -0x8c(%rbp),%eax
+  8001b3:	83 f8 01             	cmp    $0x1,%eax
+  8001b6:	0f 94 c0             	sete   %al
+  8001b9:	0f b6 f0             	movzbl %al,%esi
+  8001bc:	48 8d 8d f0 fe ff ff 	lea    -0x110(%rbp),%rcx
+  8001c3:	48 8b 85 e0 fe ff ff 	mov    -0x120(%rbp),%rax
+  8001ca:	48 89 c7             	mov    %rax,%rdi
+  8001cd:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+  while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  8001d9:	48 8d 8d f0 fe ff ff 	lea    -0x110(%rbp),%rcx
+  8001e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e3:	ba 00 01 00 00       	mov    $0x100,%edx
+  8001e8:	48 89 ce             	mov    %rcx,%rsi
+  8001eb:	89 c7                	mov    %eax,%edi
+  8001ed:	48 b8 f2 36 80 00 00 	movabs $0x8036f2,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+  8001f9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8001fc:	81 7d f8 00 01 00 00 	cmpl   $0x100,-0x8(%rbp)
+  800203:	74 97                	je     80019c <lsdir+0x7e>
+  if (n > 0)
+  800205:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800209:	7e 3b                	jle    800246 <lsdir+0x128>
+    panic("short read in directory %s", path);
+  80020b:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  800212:	48 89 c1             	mov    %rax,%rcx
+  800215:	48 b8 e2 5a 80 00 00 	movabs $0x805ae2,%rax
+  80021c:	00 00 00 
+  80021f:	48 89 c2             	mov    %rax,%rdx
+  800222:	be 20 00 00 00       	mov    $0x20,%esi
+  800227:	48 b8 cc 5a 80 00 00 	movabs $0x805acc,%rax
+  80022e:	00 00 00 
+  800231:	48 89 c7             	mov    %rax,%rdi
+  800234:	b8 00 00 00 00       	mov    $0x0,%eax
+  800239:	49 b8 fe 05 80 00 00 	movabs $0x8005fe,%r8
+  800240:	00 00 00 
+  800243:	41 ff d0             	call   *%r8
+  if (n < 0)
+  800246:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80024a:	79 41                	jns    80028d <lsdir+0x16f>
+    panic("error reading directory %s: %i", path, n);
+  80024c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80024f:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  800256:	41 89 d0             	mov    %edx,%r8d
+  800259:	48 89 c1             	mov    %rax,%rcx
+  80025c:	48 b8 00 5b 80 00 00 	movabs $0x805b00,%rax
+  800263:	00 00 00 
+  800266:	48 89 c2             	mov    %rax,%rdx
+  800269:	be 22 00 00 00       	mov    $0x22,%esi
+  80026e:	48 b8 cc 5a 80 00 00 	movabs $0x805acc,%rax
+  800275:	00 00 00 
+  800278:	48 89 c7             	mov    %rax,%rdi
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	49 b9 fe 05 80 00 00 	movabs $0x8005fe,%r9
+  800287:	00 00 00 
+  80028a:	41 ff d1             	call   *%r9
+}
+  80028d:	90                   	nop
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+0000000000800290 <ls1>:
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800290:	55                   	push   %rbp
+  800291:	48 89 e5             	mov    %rsp,%rbp
+  800294:	48 83 ec 30          	sub    $0x30,%rsp
+  800298:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80029c:	89 f0                	mov    %esi,%eax
+  80029e:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8002a1:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  8002a5:	88 45 e4             	mov    %al,-0x1c(%rbp)
+  const char *sep;
+
+  if (flag['l'])
+  8002a8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8002af:	00 00 00 
+  8002b2:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8002b8:	85 c0                	test   %eax,%eax
+  8002ba:	74 35                	je     8002f1 <ls1+0x61>
+    printf("%11d %c ", size, isdir ? 'd' : '-');
+  8002bc:	80 7d e4 00          	cmpb   $0x0,-0x1c(%rbp)
+  8002c0:	74 07                	je     8002c9 <ls1+0x39>
+  8002c2:	ba 64 00 00 00       	mov    $0x64,%edx
+  8002c7:	eb 05                	jmp    8002ce <ls1+0x3e>
+  8002c9:	ba 2d 00 00 00       	mov    $0x2d,%edx
+  8002ce:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002d1:	89 c6                	mov    %eax,%esi
+  8002d3:	48 b8 1f 5b 80 00 00 	movabs $0x805b1f,%rax
+  8002da:	00 00 00 
+  8002dd:	48 89 c7             	mov    %rax,%rdi
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 b9 f3 46 80 00 00 	movabs $0x8046f3,%rcx
+  8002ec:	00 00 00 
+  8002ef:	ff d1                	call   *%rcx
+  if (prefix) {
+  8002f1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8002f6:	74 79                	je     800371 <ls1+0xe1>
+    if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  8002f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002fc:	0f b6 00             	movzbl (%rax),%eax
+  8002ff:	84 c0                	test   %al,%al
+  800301:	74 37                	je     80033a <ls1+0xaa>
+  800303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800307:	48 89 c7             	mov    %rax,%rdi
+  80030a:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  800311:	00 00 00 
+  800314:	ff d0                	call   *%rax
+  800316:	48 98                	cltq
+  800318:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80031c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800320:	48 01 d0             	add    %rdx,%rax
+  800323:	0f b6 00             	movzbl (%rax),%eax
+  800326:	3c 2f                	cmp    $0x2f,%al
+  800328:	74 10                	je     80033a <ls1+0xaa>
+      sep = "/";
+  80032a:	48 b8 28 5b 80 00 00 	movabs $0x805b28,%rax
+  800331:	00 00 00 
+  800334:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800338:	eb 0e                	jmp    800348 <ls1+0xb8>
+    else
+      sep = "";
+  80033a:	48 b8 2a 5b 80 00 00 	movabs $0x805b2a,%rax
+  800341:	00 00 00 
+  800344:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    printf("%s%s", prefix, sep);
+  800348:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80034c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800350:	48 89 c6             	mov    %rax,%rsi
+  800353:	48 b8 2b 5b 80 00 00 	movabs $0x805b2b,%rax
+  80035a:	00 00 00 
+  80035d:	48 89 c7             	mov    %rax,%rdi
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 b9 f3 46 80 00 00 	movabs $0x8046f3,%rcx
+  80036c:	00 00 00 
+  80036f:	ff d1                	call   *%rcx
+  }
+  printf("%s", name);
+  800371:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800375:	48 89 c6             	mov    %rax,%rsi
+  800378:	48 b8 30 5b 80 00 00 	movabs $0x805b30,%rax
+  80037f:	00 00 00 
+  800382:	48 89 c7             	mov    %rax,%rdi
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	48 ba f3 46 80 00 00 	movabs $0x8046f3,%rdx
+  800391:	00 00 00 
+  800394:	ff d2                	call   *%rdx
+  if (flag['F'] && isdir)
+  800396:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80039d:	00 00 00 
+  8003a0:	8b 80 18 01 00 00    	mov    0x118(%rax),%eax
+  8003a6:	85 c0                	test   %eax,%eax
+  8003a8:	74 24                	je     8003ce <ls1+0x13e>
+  8003aa:	80 7d e4 00          	cmpb   $0x0,-0x1c(%rbp)
+  8003ae:	74 1e                	je     8003ce <ls1+0x13e>
+    printf("/");
+  8003b0:	48 b8 28 5b 80 00 00 	movabs $0x805b28,%rax
+  8003b7:	00 00 00 
+  8003ba:	48 89 c7             	mov    %rax,%rdi
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	48 ba f3 46 80 00 00 	movabs $0x8046f3,%rdx
+  8003c9:	00 00 00 
+  8003cc:	ff d2                	call   *%rdx
+  printf("\n");
+  8003ce:	48 b8 33 5b 80 00 00 	movabs $0x805b33,%rax
+  8003d5:	00 00 00 
+  8003d8:	48 89 c7             	mov    %rax,%rdi
+  8003db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e0:	48 ba f3 46 80 00 00 	movabs $0x8046f3,%rdx
+  8003e7:	00 00 00 
+  8003ea:	ff d2                	call   *%rdx
+}
+  8003ec:	90                   	nop
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+00000000008003ef <usage>:
+
+void
+usage(void) {
+  8003ef:	55                   	push   %rbp
+  8003f0:	48 89 e5             	mov    %rsp,%rbp
+  printf("usage: ls [-dFl] [file...]\n");
+  8003f3:	48 b8 35 5b 80 00 00 	movabs $0x805b35,%rax
+  8003fa:	00 00 00 
+  8003fd:	48 89 c7             	mov    %rax,%rdi
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	48 ba f3 46 80 00 00 	movabs $0x8046f3,%rdx
+  80040c:	00 00 00 
+  80040f:	ff d2                	call   *%rdx
+  exit();
+  800411:	48 b8 da 05 80 00 00 	movabs $0x8005da,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+}
+  80041d:	90                   	nop
+  80041e:	5d                   	pop    %rbp
+  80041f:	c3                   	ret
+
+0000000000800420 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+  800424:	48 83 ec 40          	sub    $0x40,%rsp
+  800428:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80042b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  int i;
+  struct Argstate args;
+
+  argstart(&argc, argv, &args);
+  80042f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800433:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800437:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+  80043b:	48 89 ce             	mov    %rcx,%rsi
+  80043e:	48 89 c7             	mov    %rax,%rdi
+  800441:	48 b8 82 2c 80 00 00 	movabs $0x802c82,%rax
+  800448:	00 00 00 
+  80044b:	ff d0                	call   *%rax
+  while ((i = argnext(&args)) >= 0)
+  80044d:	eb 64                	jmp    8004b3 <umain+0x93>
+    switch (i) {
+  80044f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800452:	83 e8 46             	sub    $0x46,%eax
+  800455:	83 f8 26             	cmp    $0x26,%eax
+  800458:	0f 97 c2             	seta   %dl
+  80045b:	84 d2                	test   %dl,%dl
+  80045d:	75 48                	jne    8004a7 <umain+0x87>
+  80045f:	48 ba 01 00 00 40 40 	movabs $0x4040000001,%rdx
+  800466:	00 00 00 
+  800469:	89 c1                	mov    %eax,%ecx
+  80046b:	48 d3 ea             	shr    %cl,%rdx
+  80046e:	48 89 d0             	mov    %rdx,%rax
+  800471:	83 e0 01             	and    $0x1,%eax
+  800474:	48 85 c0             	test   %rax,%rax
+  800477:	0f 95 c0             	setne  %al
+  80047a:	84 c0                	test   %al,%al
+  80047c:	74 29                	je     8004a7 <umain+0x87>
+      case 'd':
+      case 'F':
+      case 'l':
+        flag[i]++;
+  80047e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800485:	00 00 00 
+  800488:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80048b:	48 98                	cltq
+  80048d:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  800490:	8d 48 01             	lea    0x1(%rax),%ecx
+  800493:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80049a:	00 00 00 
+  80049d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004a0:	48 98                	cltq
+  8004a2:	89 0c 82             	mov    %ecx,(%rdx,%rax,4)
+        break;
+  8004a5:	eb 0c                	jmp    8004b3 <umain+0x93>
+      default:
+        usage();
+  8004a7:	48 b8 ef 03 80 00 00 	movabs $0x8003ef,%rax
+  8004ae:	00 00 00 
+  8004b1:	ff d0                	call   *%rax
+  while ((i = argnext(&args)) >= 0)
+  8004b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b7:	48 89 c7             	mov    %rax,%rdi
+  8004ba:	48 b8 e7 2c 80 00 00 	movabs $0x802ce7,%rax
+  8004c1:	00 00 00 
+  8004c4:	ff d0                	call   *%rax
+  8004c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8004c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8004cd:	79 80                	jns    80044f <umain+0x2f>
+    }
+
+  if (argc == 1)
+  8004cf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8004d2:	83 f8 01             	cmp    $0x1,%eax
+  8004d5:	75 28                	jne    8004ff <umain+0xdf>
+    ls("/", "");
+  8004d7:	48 b8 2a 5b 80 00 00 	movabs $0x805b2a,%rax
+  8004de:	00 00 00 
+  8004e1:	48 89 c6             	mov    %rax,%rsi
+  8004e4:	48 b8 28 5b 80 00 00 	movabs $0x805b28,%rax
+  8004eb:	00 00 00 
+  8004ee:	48 89 c7             	mov    %rax,%rdi
+  8004f1:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8004f8:	00 00 00 
+  8004fb:	ff d0                	call   *%rax
+  else {
+    for (i = 1; i < argc; i++)
+      ls(argv[i], argv[i]);
+  }
+}
+  8004fd:	eb 55                	jmp    800554 <umain+0x134>
+    for (i = 1; i < argc; i++)
+  8004ff:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  800506:	eb 44                	jmp    80054c <umain+0x12c>
+      ls(argv[i], argv[i]);
+  800508:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80050b:	48 98                	cltq
+  80050d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800514:	00 
+  800515:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800519:	48 01 d0             	add    %rdx,%rax
+  80051c:	48 8b 10             	mov    (%rax),%rdx
+  80051f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800522:	48 98                	cltq
+  800524:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  80052b:	00 
+  80052c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800530:	48 01 c8             	add    %rcx,%rax
+  800533:	48 8b 00             	mov    (%rax),%rax
+  800536:	48 89 d6             	mov    %rdx,%rsi
+  800539:	48 89 c7             	mov    %rax,%rdi
+  80053c:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+    for (i = 1; i < argc; i++)
+  800548:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80054c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80054f:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  800552:	7c b4                	jl     800508 <umain+0xe8>
+}
+  800554:	90                   	nop
+  800555:	c9                   	leave
+  800556:	c3                   	ret
+
+0000000000800557 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800557:	55                   	push   %rbp
+  800558:	48 89 e5             	mov    %rsp,%rbp
+  80055b:	48 83 ec 20          	sub    $0x20,%rsp
+  80055f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800562:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800566:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80056d:	00 00 00 
+  800570:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800574:	eb 13                	jmp    800589 <libmain+0x32>
+    (*ctor)();
+  800576:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80057a:	48 8b 10             	mov    (%rax),%rdx
+  80057d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800582:	ff d2                	call   *%rdx
+    ctor++;
+  800584:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800589:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800590:	00 00 00 
+  800593:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800597:	72 dd                	jb     800576 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800599:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80059d:	7e 14                	jle    8005b3 <libmain+0x5c>
+    binaryname = argv[0];
+  80059f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005a3:	48 8b 00             	mov    (%rax),%rax
+  8005a6:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8005ad:	00 00 00 
+  8005b0:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8005b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005ba:	48 89 d6             	mov    %rdx,%rsi
+  8005bd:	89 c7                	mov    %eax,%edi
+  8005bf:	48 b8 20 04 80 00 00 	movabs $0x800420,%rax
+  8005c6:	00 00 00 
+  8005c9:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8005cb:	48 b8 da 05 80 00 00 	movabs $0x8005da,%rax
+  8005d2:	00 00 00 
+  8005d5:	ff d0                	call   *%rax
+#endif
+}
+  8005d7:	90                   	nop
+  8005d8:	c9                   	leave
+  8005d9:	c3                   	ret
+
+00000000008005da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8005da:	55                   	push   %rbp
+  8005db:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8005de:	48 b8 54 33 80 00 00 	movabs $0x803354,%rax
+  8005e5:	00 00 00 
+  8005e8:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8005ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ef:	48 b8 53 24 80 00 00 	movabs $0x802453,%rax
+  8005f6:	00 00 00 
+  8005f9:	ff d0                	call   *%rax
+}
+  8005fb:	90                   	nop
+  8005fc:	5d                   	pop    %rbp
+  8005fd:	c3                   	ret
+
+00000000008005fe <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8005fe:	55                   	push   %rbp
+  8005ff:	48 89 e5             	mov    %rsp,%rbp
+  800602:	53                   	push   %rbx
+  800603:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80060a:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800611:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800617:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80061e:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800625:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80062c:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800633:	84 c0                	test   %al,%al
+  800635:	74 23                	je     80065a <_panic+0x5c>
+  800637:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80063e:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800642:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800646:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80064a:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80064e:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800652:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800656:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80065a:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800661:	00 00 00 
+  800664:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80066b:	00 00 00 
+  80066e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800672:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800679:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800680:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800687:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80068e:	00 00 00 
+  800691:	48 8b 18             	mov    (%rax),%rbx
+  800694:	48 b8 22 25 80 00 00 	movabs $0x802522,%rax
+  80069b:	00 00 00 
+  80069e:	ff d0                	call   *%rax
+  8006a0:	89 c6                	mov    %eax,%esi
+  8006a2:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8006a8:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8006af:	41 89 d0             	mov    %edx,%r8d
+  8006b2:	48 89 c1             	mov    %rax,%rcx
+  8006b5:	48 89 da             	mov    %rbx,%rdx
+  8006b8:	48 b8 60 5b 80 00 00 	movabs $0x805b60,%rax
+  8006bf:	00 00 00 
+  8006c2:	48 89 c7             	mov    %rax,%rdi
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	49 b9 1d 08 80 00 00 	movabs $0x80081d,%r9
+  8006d1:	00 00 00 
+  8006d4:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8006d7:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8006de:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006e5:	48 89 d6             	mov    %rdx,%rsi
+  8006e8:	48 89 c7             	mov    %rax,%rdi
+  8006eb:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  8006f2:	00 00 00 
+  8006f5:	ff d0                	call   *%rax
+  cprintf("\n");
+  8006f7:	48 b8 83 5b 80 00 00 	movabs $0x805b83,%rax
+  8006fe:	00 00 00 
+  800701:	48 89 c7             	mov    %rax,%rdi
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	48 ba 1d 08 80 00 00 	movabs $0x80081d,%rdx
+  800710:	00 00 00 
+  800713:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800715:	cc                   	int3
+  800716:	eb fd                	jmp    800715 <_panic+0x117>
+
+0000000000800718 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800718:	55                   	push   %rbp
+  800719:	48 89 e5             	mov    %rsp,%rbp
+  80071c:	48 83 ec 10          	sub    $0x10,%rsp
+  800720:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800723:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800727:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80072b:	8b 00                	mov    (%rax),%eax
+  80072d:	8d 48 01             	lea    0x1(%rax),%ecx
+  800730:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800734:	89 0a                	mov    %ecx,(%rdx)
+  800736:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800739:	89 d1                	mov    %edx,%ecx
+  80073b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80073f:	48 98                	cltq
+  800741:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800745:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800749:	8b 00                	mov    (%rax),%eax
+  80074b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800750:	75 2c                	jne    80077e <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800752:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800756:	8b 00                	mov    (%rax),%eax
+  800758:	48 98                	cltq
+  80075a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80075e:	48 83 c2 08          	add    $0x8,%rdx
+  800762:	48 89 c6             	mov    %rax,%rsi
+  800765:	48 89 d7             	mov    %rdx,%rdi
+  800768:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  80076f:	00 00 00 
+  800772:	ff d0                	call   *%rax
+    b->idx = 0;
+  800774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800778:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80077e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800782:	8b 40 04             	mov    0x4(%rax),%eax
+  800785:	8d 50 01             	lea    0x1(%rax),%edx
+  800788:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80078c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80078f:	90                   	nop
+  800790:	c9                   	leave
+  800791:	c3                   	ret
+
+0000000000800792 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800792:	55                   	push   %rbp
+  800793:	48 89 e5             	mov    %rsp,%rbp
+  800796:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80079d:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8007a4:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8007ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8007b2:	00 00 00 
+  b.cnt = 0;
+  8007b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8007bc:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8007bf:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8007c6:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8007cd:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8007d4:	48 89 c6             	mov    %rax,%rsi
+  8007d7:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  8007de:	00 00 00 
+  8007e1:	48 89 c7             	mov    %rax,%rdi
+  8007e4:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  8007eb:	00 00 00 
+  8007ee:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8007f0:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8007f6:	48 98                	cltq
+  8007f8:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8007ff:	48 83 c2 08          	add    $0x8,%rdx
+  800803:	48 89 c6             	mov    %rax,%rsi
+  800806:	48 89 d7             	mov    %rdx,%rdi
+  800809:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  800810:	00 00 00 
+  800813:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800815:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80081b:	c9                   	leave
+  80081c:	c3                   	ret
+
+000000000080081d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80081d:	55                   	push   %rbp
+  80081e:	48 89 e5             	mov    %rsp,%rbp
+  800821:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800828:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80082f:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800836:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80083d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800844:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80084b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800852:	84 c0                	test   %al,%al
+  800854:	74 20                	je     800876 <cprintf+0x59>
+  800856:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80085a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80085e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800862:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800866:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80086a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80086e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800872:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800876:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80087d:	00 00 00 
+  800880:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800887:	00 00 00 
+  80088a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80088e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800895:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80089c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8008a3:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8008aa:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8008b1:	48 89 d6             	mov    %rdx,%rsi
+  8008b4:	48 89 c7             	mov    %rax,%rdi
+  8008b7:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  8008be:	00 00 00 
+  8008c1:	ff d0                	call   *%rax
+  8008c3:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8008c9:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8008cf:	c9                   	leave
+  8008d0:	c3                   	ret
+
+00000000008008d1 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8008d1:	55                   	push   %rbp
+  8008d2:	48 89 e5             	mov    %rsp,%rbp
+  8008d5:	48 83 ec 30          	sub    $0x30,%rsp
+  8008d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008e5:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8008e8:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8008ec:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8008f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008f3:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8008f7:	72 54                	jb     80094d <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008f9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8008fc:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008ff:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80090b:	48 f7 f6             	div    %rsi
+  80090e:	49 89 c2             	mov    %rax,%r10
+  800911:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800914:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800917:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80091b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80091f:	41 89 c9             	mov    %ecx,%r9d
+  800922:	41 89 f8             	mov    %edi,%r8d
+  800925:	89 d1                	mov    %edx,%ecx
+  800927:	4c 89 d2             	mov    %r10,%rdx
+  80092a:	48 89 c7             	mov    %rax,%rdi
+  80092d:	48 b8 d1 08 80 00 00 	movabs $0x8008d1,%rax
+  800934:	00 00 00 
+  800937:	ff d0                	call   *%rax
+  800939:	eb 1c                	jmp    800957 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80093b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80093f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800942:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800946:	48 89 d6             	mov    %rdx,%rsi
+  800949:	89 c7                	mov    %eax,%edi
+  80094b:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80094d:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800951:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800955:	7f e4                	jg     80093b <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800957:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80095a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800963:	48 f7 f1             	div    %rcx
+  800966:	48 b8 d0 5d 80 00 00 	movabs $0x805dd0,%rax
+  80096d:	00 00 00 
+  800970:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800974:	0f be c0             	movsbl %al,%eax
+  800977:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80097b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80097f:	48 89 d6             	mov    %rdx,%rsi
+  800982:	89 c7                	mov    %eax,%edi
+  800984:	ff d1                	call   *%rcx
+}
+  800986:	90                   	nop
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+
+0000000000800989 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800989:	55                   	push   %rbp
+  80098a:	48 89 e5             	mov    %rsp,%rbp
+  80098d:	48 83 ec 10          	sub    $0x10,%rsp
+  800991:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800995:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800998:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80099c:	7e 4b                	jle    8009e9 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80099e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a2:	8b 00                	mov    (%rax),%eax
+  8009a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a7:	77 24                	ja     8009cd <getuint+0x44>
+  8009a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ad:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b5:	8b 00                	mov    (%rax),%eax
+  8009b7:	89 c0                	mov    %eax,%eax
+  8009b9:	48 01 d0             	add    %rdx,%rax
+  8009bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c0:	8b 12                	mov    (%rdx),%edx
+  8009c2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c9:	89 0a                	mov    %ecx,(%rdx)
+  8009cb:	eb 14                	jmp    8009e1 <getuint+0x58>
+  8009cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009dd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e1:	48 8b 00             	mov    (%rax),%rax
+  8009e4:	e9 95 00 00 00       	jmp    800a7e <getuint+0xf5>
+  else if (lflag)
+  8009e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009ed:	74 48                	je     800a37 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8009ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f3:	8b 00                	mov    (%rax),%eax
+  8009f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f8:	77 24                	ja     800a1e <getuint+0x95>
+  8009fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009fe:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a06:	8b 00                	mov    (%rax),%eax
+  800a08:	89 c0                	mov    %eax,%eax
+  800a0a:	48 01 d0             	add    %rdx,%rax
+  800a0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a11:	8b 12                	mov    (%rdx),%edx
+  800a13:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a1a:	89 0a                	mov    %ecx,(%rdx)
+  800a1c:	eb 14                	jmp    800a32 <getuint+0xa9>
+  800a1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a22:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a26:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a2a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a2e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a32:	48 8b 00             	mov    (%rax),%rax
+  800a35:	eb 47                	jmp    800a7e <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a3b:	8b 00                	mov    (%rax),%eax
+  800a3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a40:	77 24                	ja     800a66 <getuint+0xdd>
+  800a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a46:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a4e:	8b 00                	mov    (%rax),%eax
+  800a50:	89 c0                	mov    %eax,%eax
+  800a52:	48 01 d0             	add    %rdx,%rax
+  800a55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a59:	8b 12                	mov    (%rdx),%edx
+  800a5b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a5e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a62:	89 0a                	mov    %ecx,(%rdx)
+  800a64:	eb 14                	jmp    800a7a <getuint+0xf1>
+  800a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a6a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a6e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a76:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a7a:	8b 00                	mov    (%rax),%eax
+  800a7c:	89 c0                	mov    %eax,%eax
+}
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+0000000000800a80 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	48 83 ec 10          	sub    $0x10,%rsp
+  800a88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a8c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800a8f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800a93:	7e 4b                	jle    800ae0 <getint+0x60>
+    return va_arg(*ap, long long);
+  800a95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a99:	8b 00                	mov    (%rax),%eax
+  800a9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9e:	77 24                	ja     800ac4 <getint+0x44>
+  800aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aac:	8b 00                	mov    (%rax),%eax
+  800aae:	89 c0                	mov    %eax,%eax
+  800ab0:	48 01 d0             	add    %rdx,%rax
+  800ab3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ab7:	8b 12                	mov    (%rdx),%edx
+  800ab9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800abc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ac0:	89 0a                	mov    %ecx,(%rdx)
+  800ac2:	eb 14                	jmp    800ad8 <getint+0x58>
+  800ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800acc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ad0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ad4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ad8:	48 8b 00             	mov    (%rax),%rax
+  800adb:	e9 95 00 00 00       	jmp    800b75 <getint+0xf5>
+  else if (lflag)
+  800ae0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800ae4:	74 48                	je     800b2e <getint+0xae>
+    return va_arg(*ap, long);
+  800ae6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aea:	8b 00                	mov    (%rax),%eax
+  800aec:	83 f8 2f             	cmp    $0x2f,%eax
+  800aef:	77 24                	ja     800b15 <getint+0x95>
+  800af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800afd:	8b 00                	mov    (%rax),%eax
+  800aff:	89 c0                	mov    %eax,%eax
+  800b01:	48 01 d0             	add    %rdx,%rax
+  800b04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b08:	8b 12                	mov    (%rdx),%edx
+  800b0a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b11:	89 0a                	mov    %ecx,(%rdx)
+  800b13:	eb 14                	jmp    800b29 <getint+0xa9>
+  800b15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b19:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b1d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b25:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b29:	48 8b 00             	mov    (%rax),%rax
+  800b2c:	eb 47                	jmp    800b75 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800b2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b32:	8b 00                	mov    (%rax),%eax
+  800b34:	83 f8 2f             	cmp    $0x2f,%eax
+  800b37:	77 24                	ja     800b5d <getint+0xdd>
+  800b39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b3d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b45:	8b 00                	mov    (%rax),%eax
+  800b47:	89 c0                	mov    %eax,%eax
+  800b49:	48 01 d0             	add    %rdx,%rax
+  800b4c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b50:	8b 12                	mov    (%rdx),%edx
+  800b52:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b59:	89 0a                	mov    %ecx,(%rdx)
+  800b5b:	eb 14                	jmp    800b71 <getint+0xf1>
+  800b5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b65:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b6d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b71:	8b 00                	mov    (%rax),%eax
+  800b73:	48 98                	cltq
+}
+  800b75:	c9                   	leave
+  800b76:	c3                   	ret
+
+0000000000800b77 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800b77:	55                   	push   %rbp
+  800b78:	48 89 e5             	mov    %rsp,%rbp
+  800b7b:	41 54                	push   %r12
+  800b7d:	53                   	push   %rbx
+  800b7e:	48 83 ec 60          	sub    $0x60,%rsp
+  800b82:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800b86:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800b8a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800b8e:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800b92:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b96:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b9a:	48 8b 06             	mov    (%rsi),%rax
+  800b9d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ba1:	48 89 01             	mov    %rax,(%rcx)
+  800ba4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ba8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800bac:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bb0:	eb 17                	jmp    800bc9 <vprintfmt+0x52>
+      if (ch == '\0')
+  800bb2:	85 db                	test   %ebx,%ebx
+  800bb4:	0f 84 bf 04 00 00    	je     801079 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800bba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bbe:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bc2:	48 89 c6             	mov    %rax,%rsi
+  800bc5:	89 df                	mov    %ebx,%edi
+  800bc7:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bc9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bcd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bd1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800bd5:	0f b6 00             	movzbl (%rax),%eax
+  800bd8:	0f b6 d8             	movzbl %al,%ebx
+  800bdb:	83 fb 25             	cmp    $0x25,%ebx
+  800bde:	75 d2                	jne    800bb2 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800be0:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800be4:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800beb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800bf2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800bf9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800c00:	eb 04                	jmp    800c06 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800c02:	90                   	nop
+  800c03:	eb 01                	jmp    800c06 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800c05:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800c06:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c0a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c0e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c12:	0f b6 00             	movzbl (%rax),%eax
+  800c15:	0f b6 d8             	movzbl %al,%ebx
+  800c18:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c1b:	83 f8 55             	cmp    $0x55,%eax
+  800c1e:	0f 87 22 04 00 00    	ja     801046 <vprintfmt+0x4cf>
+  800c24:	89 c0                	mov    %eax,%eax
+  800c26:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c2d:	00 
+  800c2e:	48 b8 f8 5d 80 00 00 	movabs $0x805df8,%rax
+  800c35:	00 00 00 
+  800c38:	48 01 d0             	add    %rdx,%rax
+  800c3b:	48 8b 00             	mov    (%rax),%rax
+  800c3e:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c40:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c44:	eb c0                	jmp    800c06 <vprintfmt+0x8f>
+        padc = '0';
+  800c46:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800c4a:	eb ba                	jmp    800c06 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800c4c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c53:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800c56:	89 d0                	mov    %edx,%eax
+  800c58:	c1 e0 02             	shl    $0x2,%eax
+  800c5b:	01 d0                	add    %edx,%eax
+  800c5d:	01 c0                	add    %eax,%eax
+  800c5f:	01 d8                	add    %ebx,%eax
+  800c61:	83 e8 30             	sub    $0x30,%eax
+  800c64:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800c67:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c6b:	0f b6 00             	movzbl (%rax),%eax
+  800c6e:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800c71:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c74:	7e 60                	jle    800cd6 <vprintfmt+0x15f>
+  800c76:	83 fb 39             	cmp    $0x39,%ebx
+  800c79:	7f 5b                	jg     800cd6 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800c7b:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c80:	eb d1                	jmp    800c53 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800c82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c85:	83 f8 2f             	cmp    $0x2f,%eax
+  800c88:	77 17                	ja     800ca1 <vprintfmt+0x12a>
+  800c8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c8e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c91:	89 d2                	mov    %edx,%edx
+  800c93:	48 01 d0             	add    %rdx,%rax
+  800c96:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c99:	83 c2 08             	add    $0x8,%edx
+  800c9c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c9f:	eb 0c                	jmp    800cad <vprintfmt+0x136>
+  800ca1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ca5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ca9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cad:	8b 00                	mov    (%rax),%eax
+  800caf:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800cb2:	eb 23                	jmp    800cd7 <vprintfmt+0x160>
+        if (width < 0)
+  800cb4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cb8:	0f 89 44 ff ff ff    	jns    800c02 <vprintfmt+0x8b>
+          width = 0;
+  800cbe:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800cc5:	e9 38 ff ff ff       	jmp    800c02 <vprintfmt+0x8b>
+        altflag = 1;
+  800cca:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800cd1:	e9 30 ff ff ff       	jmp    800c06 <vprintfmt+0x8f>
+        goto process_precision;
+  800cd6:	90                   	nop
+        if (width < 0)
+  800cd7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cdb:	0f 89 24 ff ff ff    	jns    800c05 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800ce1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ce4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ce7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800cee:	e9 12 ff ff ff       	jmp    800c05 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800cf3:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800cf7:	e9 0a ff ff ff       	jmp    800c06 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800cfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cff:	83 f8 2f             	cmp    $0x2f,%eax
+  800d02:	77 17                	ja     800d1b <vprintfmt+0x1a4>
+  800d04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d08:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d0b:	89 d2                	mov    %edx,%edx
+  800d0d:	48 01 d0             	add    %rdx,%rax
+  800d10:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d13:	83 c2 08             	add    $0x8,%edx
+  800d16:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d19:	eb 0c                	jmp    800d27 <vprintfmt+0x1b0>
+  800d1b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d1f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d23:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d27:	8b 00                	mov    (%rax),%eax
+  800d29:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d2d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d31:	48 89 d6             	mov    %rdx,%rsi
+  800d34:	89 c7                	mov    %eax,%edi
+  800d36:	ff d1                	call   *%rcx
+        break;
+  800d38:	e9 37 03 00 00       	jmp    801074 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d40:	83 f8 2f             	cmp    $0x2f,%eax
+  800d43:	77 17                	ja     800d5c <vprintfmt+0x1e5>
+  800d45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d49:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d4c:	89 d2                	mov    %edx,%edx
+  800d4e:	48 01 d0             	add    %rdx,%rax
+  800d51:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d54:	83 c2 08             	add    $0x8,%edx
+  800d57:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d5a:	eb 0c                	jmp    800d68 <vprintfmt+0x1f1>
+  800d5c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d60:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d64:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d68:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800d6a:	85 db                	test   %ebx,%ebx
+  800d6c:	79 02                	jns    800d70 <vprintfmt+0x1f9>
+          err = -err;
+  800d6e:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d70:	83 fb 15             	cmp    $0x15,%ebx
+  800d73:	7f 16                	jg     800d8b <vprintfmt+0x214>
+  800d75:	48 ba 20 5d 80 00 00 	movabs $0x805d20,%rdx
+  800d7c:	00 00 00 
+  800d7f:	48 63 c3             	movslq %ebx,%rax
+  800d82:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800d86:	4d 85 e4             	test   %r12,%r12
+  800d89:	75 2e                	jne    800db9 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800d8b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d8f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d93:	89 d9                	mov    %ebx,%ecx
+  800d95:	48 ba e1 5d 80 00 00 	movabs $0x805de1,%rdx
+  800d9c:	00 00 00 
+  800d9f:	48 89 c7             	mov    %rax,%rdi
+  800da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da7:	49 b8 83 10 80 00 00 	movabs $0x801083,%r8
+  800dae:	00 00 00 
+  800db1:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800db4:	e9 bb 02 00 00       	jmp    801074 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800db9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800dbd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dc1:	4c 89 e1             	mov    %r12,%rcx
+  800dc4:	48 ba ea 5d 80 00 00 	movabs $0x805dea,%rdx
+  800dcb:	00 00 00 
+  800dce:	48 89 c7             	mov    %rax,%rdi
+  800dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd6:	49 b8 83 10 80 00 00 	movabs $0x801083,%r8
+  800ddd:	00 00 00 
+  800de0:	41 ff d0             	call   *%r8
+        break;
+  800de3:	e9 8c 02 00 00       	jmp    801074 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800de8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800deb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dee:	77 17                	ja     800e07 <vprintfmt+0x290>
+  800df0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800df4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800df7:	89 d2                	mov    %edx,%edx
+  800df9:	48 01 d0             	add    %rdx,%rax
+  800dfc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dff:	83 c2 08             	add    $0x8,%edx
+  800e02:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e05:	eb 0c                	jmp    800e13 <vprintfmt+0x29c>
+  800e07:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e0b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e0f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e13:	4c 8b 20             	mov    (%rax),%r12
+  800e16:	4d 85 e4             	test   %r12,%r12
+  800e19:	75 0a                	jne    800e25 <vprintfmt+0x2ae>
+          p = "(null)";
+  800e1b:	49 bc ed 5d 80 00 00 	movabs $0x805ded,%r12
+  800e22:	00 00 00 
+        if (width > 0 && padc != '-')
+  800e25:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e29:	7e 78                	jle    800ea3 <vprintfmt+0x32c>
+  800e2b:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800e2f:	74 72                	je     800ea3 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e31:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e34:	48 98                	cltq
+  800e36:	48 89 c6             	mov    %rax,%rsi
+  800e39:	4c 89 e7             	mov    %r12,%rdi
+  800e3c:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  800e43:	00 00 00 
+  800e46:	ff d0                	call   *%rax
+  800e48:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800e4b:	eb 17                	jmp    800e64 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800e4d:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800e51:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800e55:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800e59:	48 89 d6             	mov    %rdx,%rsi
+  800e5c:	89 c7                	mov    %eax,%edi
+  800e5e:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e60:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e64:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e68:	7f e3                	jg     800e4d <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e6a:	eb 37                	jmp    800ea3 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800e6c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e70:	74 1e                	je     800e90 <vprintfmt+0x319>
+  800e72:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e75:	7e 05                	jle    800e7c <vprintfmt+0x305>
+  800e77:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e7a:	7e 14                	jle    800e90 <vprintfmt+0x319>
+            putch('?', putdat);
+  800e7c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e80:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e84:	48 89 c6             	mov    %rax,%rsi
+  800e87:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e8c:	ff d2                	call   *%rdx
+  800e8e:	eb 0f                	jmp    800e9f <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800e90:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e94:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e98:	48 89 c6             	mov    %rax,%rsi
+  800e9b:	89 df                	mov    %ebx,%edi
+  800e9d:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e9f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ea3:	4c 89 e0             	mov    %r12,%rax
+  800ea6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800eaa:	0f b6 00             	movzbl (%rax),%eax
+  800ead:	0f be d8             	movsbl %al,%ebx
+  800eb0:	85 db                	test   %ebx,%ebx
+  800eb2:	74 28                	je     800edc <vprintfmt+0x365>
+  800eb4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800eb8:	78 b2                	js     800e6c <vprintfmt+0x2f5>
+  800eba:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800ebe:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ec2:	79 a8                	jns    800e6c <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800ec4:	eb 16                	jmp    800edc <vprintfmt+0x365>
+          putch(' ', putdat);
+  800ec6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800eca:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ece:	48 89 c6             	mov    %rax,%rsi
+  800ed1:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ed6:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ed8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800edc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ee0:	7f e4                	jg     800ec6 <vprintfmt+0x34f>
+        break;
+  800ee2:	e9 8d 01 00 00       	jmp    801074 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800ee7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800eea:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800eee:	89 d6                	mov    %edx,%esi
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	48 b8 80 0a 80 00 00 	movabs $0x800a80,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+  800eff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f07:	48 85 c0             	test   %rax,%rax
+  800f0a:	79 1d                	jns    800f29 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800f0c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f10:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f14:	48 89 c6             	mov    %rax,%rsi
+  800f17:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f1c:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800f1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f22:	48 f7 d8             	neg    %rax
+  800f25:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800f29:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f30:	e9 d2 00 00 00       	jmp    801007 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f35:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f38:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f3c:	89 d6                	mov    %edx,%esi
+  800f3e:	48 89 c7             	mov    %rax,%rdi
+  800f41:	48 b8 89 09 80 00 00 	movabs $0x800989,%rax
+  800f48:	00 00 00 
+  800f4b:	ff d0                	call   *%rax
+  800f4d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800f51:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f58:	e9 aa 00 00 00       	jmp    801007 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800f5d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f60:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f64:	89 d6                	mov    %edx,%esi
+  800f66:	48 89 c7             	mov    %rax,%rdi
+  800f69:	48 b8 89 09 80 00 00 	movabs $0x800989,%rax
+  800f70:	00 00 00 
+  800f73:	ff d0                	call   *%rax
+  800f75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800f79:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800f80:	e9 82 00 00 00       	jmp    801007 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800f85:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f89:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f8d:	48 89 c6             	mov    %rax,%rsi
+  800f90:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f95:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800f97:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f9b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f9f:	48 89 c6             	mov    %rax,%rsi
+  800fa2:	bf 78 00 00 00       	mov    $0x78,%edi
+  800fa7:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800fa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fac:	83 f8 2f             	cmp    $0x2f,%eax
+  800faf:	77 17                	ja     800fc8 <vprintfmt+0x451>
+  800fb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fb5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800fb8:	89 d2                	mov    %edx,%edx
+  800fba:	48 01 d0             	add    %rdx,%rax
+  800fbd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800fc0:	83 c2 08             	add    $0x8,%edx
+  800fc3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800fc6:	eb 0c                	jmp    800fd4 <vprintfmt+0x45d>
+  800fc8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fcc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fd0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800fd4:	48 8b 00             	mov    (%rax),%rax
+  800fd7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fdb:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800fe2:	eb 23                	jmp    801007 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800fe4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fe7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800feb:	89 d6                	mov    %edx,%esi
+  800fed:	48 89 c7             	mov    %rax,%rdi
+  800ff0:	48 b8 89 09 80 00 00 	movabs $0x800989,%rax
+  800ff7:	00 00 00 
+  800ffa:	ff d0                	call   *%rax
+  800ffc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801000:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  801007:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80100c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80100f:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801012:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801016:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80101a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80101e:	45 89 c1             	mov    %r8d,%r9d
+  801021:	41 89 f8             	mov    %edi,%r8d
+  801024:	48 89 c7             	mov    %rax,%rdi
+  801027:	48 b8 d1 08 80 00 00 	movabs $0x8008d1,%rax
+  80102e:	00 00 00 
+  801031:	ff d0                	call   *%rax
+        break;
+  801033:	eb 3f                	jmp    801074 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801035:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801039:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80103d:	48 89 c6             	mov    %rax,%rsi
+  801040:	89 df                	mov    %ebx,%edi
+  801042:	ff d2                	call   *%rdx
+        break;
+  801044:	eb 2e                	jmp    801074 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801046:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80104a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80104e:	48 89 c6             	mov    %rax,%rsi
+  801051:	bf 25 00 00 00       	mov    $0x25,%edi
+  801056:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801058:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80105d:	eb 05                	jmp    801064 <vprintfmt+0x4ed>
+  80105f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801064:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801068:	48 83 e8 01          	sub    $0x1,%rax
+  80106c:	0f b6 00             	movzbl (%rax),%eax
+  80106f:	3c 25                	cmp    $0x25,%al
+  801071:	75 ec                	jne    80105f <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  801073:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801074:	e9 50 fb ff ff       	jmp    800bc9 <vprintfmt+0x52>
+        return;
+  801079:	90                   	nop
+    }
+  }
+}
+  80107a:	48 83 c4 60          	add    $0x60,%rsp
+  80107e:	5b                   	pop    %rbx
+  80107f:	41 5c                	pop    %r12
+  801081:	5d                   	pop    %rbp
+  801082:	c3                   	ret
+
+0000000000801083 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801083:	55                   	push   %rbp
+  801084:	48 89 e5             	mov    %rsp,%rbp
+  801087:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80108e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801095:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80109c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010a3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010aa:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010b1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010b8:	84 c0                	test   %al,%al
+  8010ba:	74 20                	je     8010dc <printfmt+0x59>
+  8010bc:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010c0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010c4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010c8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010cc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010d0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010d4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010d8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8010dc:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010e3:	00 00 00 
+  8010e6:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010ed:	00 00 00 
+  8010f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010f4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010fb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801102:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801109:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801110:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801117:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80111e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801125:	48 89 c7             	mov    %rax,%rdi
+  801128:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  80112f:	00 00 00 
+  801132:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801134:	90                   	nop
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+
+0000000000801137 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	48 83 ec 10          	sub    $0x10,%rsp
+  80113f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801142:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801146:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80114a:	8b 40 10             	mov    0x10(%rax),%eax
+  80114d:	8d 50 01             	lea    0x1(%rax),%edx
+  801150:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801154:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801157:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80115b:	48 8b 10             	mov    (%rax),%rdx
+  80115e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801162:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801166:	48 39 c2             	cmp    %rax,%rdx
+  801169:	73 17                	jae    801182 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  80116b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80116f:	48 8b 00             	mov    (%rax),%rax
+  801172:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801176:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80117a:	48 89 0a             	mov    %rcx,(%rdx)
+  80117d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801180:	88 10                	mov    %dl,(%rax)
+}
+  801182:	90                   	nop
+  801183:	c9                   	leave
+  801184:	c3                   	ret
+
+0000000000801185 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	48 83 ec 40          	sub    $0x40,%rsp
+  80118d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801191:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801194:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801198:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  80119c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011a0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011a4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8011a7:	48 98                	cltq
+  8011a9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8011ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011b1:	48 01 d0             	add    %rdx,%rax
+  8011b4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8011b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8011bf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011c4:	74 06                	je     8011cc <vsnprintf+0x47>
+  8011c6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8011ca:	7f 07                	jg     8011d3 <vsnprintf+0x4e>
+    return -E_INVAL;
+  8011cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d1:	eb 32                	jmp    801205 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8011d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8011d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8011db:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8011df:	48 89 c6             	mov    %rax,%rsi
+  8011e2:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  8011e9:	00 00 00 
+  8011ec:	48 89 c7             	mov    %rax,%rdi
+  8011ef:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  8011f6:	00 00 00 
+  8011f9:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8011fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011ff:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801202:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801205:	c9                   	leave
+  801206:	c3                   	ret
+
+0000000000801207 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801207:	55                   	push   %rbp
+  801208:	48 89 e5             	mov    %rsp,%rbp
+  80120b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801212:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801219:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80121f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801226:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80122d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801234:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80123b:	84 c0                	test   %al,%al
+  80123d:	74 20                	je     80125f <snprintf+0x58>
+  80123f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801243:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801247:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80124b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80124f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801253:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801257:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80125b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80125f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801266:	00 00 00 
+  801269:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801270:	00 00 00 
+  801273:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801277:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80127e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801285:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80128c:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801293:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80129a:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8012a0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8012a7:	48 89 c7             	mov    %rax,%rdi
+  8012aa:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  8012b1:	00 00 00 
+  8012b4:	ff d0                	call   *%rax
+  8012b6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8012bc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012c2:	c9                   	leave
+  8012c3:	c3                   	ret
+
+00000000008012c4 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8012c4:	55                   	push   %rbp
+  8012c5:	48 89 e5             	mov    %rsp,%rbp
+  8012c8:	53                   	push   %rbx
+  8012c9:	48 83 ec 38          	sub    $0x38,%rsp
+  8012cd:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8012d0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8012d4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8012d8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8012dc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8012e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e8:	89 d1                	mov    %edx,%ecx
+  8012ea:	0f a2                	cpuid
+  8012ec:	89 de                	mov    %ebx,%esi
+  8012ee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8012f1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8012f4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8012f7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8012fa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012ff:	74 09                	je     80130a <cpuid+0x46>
+}
+  801301:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801305:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801308:	89 10                	mov    %edx,(%rax)
+
+  80130a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80130f:	74 09                	je     80131a <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801311:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801315:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801318:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80131a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80131f:	74 09                	je     80132a <cpuid+0x66>
+char *
+  801321:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801325:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801328:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80132a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80132f:	74 09                	je     80133a <cpuid+0x76>
+  for (; *s; s++)
+  801331:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801335:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801338:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80133a:	90                   	nop
+  80133b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133f:	c9                   	leave
+  801340:	c3                   	ret
+
+0000000000801341 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801341:	55                   	push   %rbp
+  801342:	48 89 e5             	mov    %rsp,%rbp
+  801345:	48 83 ec 18          	sub    $0x18,%rsp
+  801349:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80134c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80134f:	89 c1                	mov    %eax,%ecx
+  801351:	0f 01 d0             	xgetbv
+  801354:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801357:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80135a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80135d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801360:	48 c1 e2 20          	shl    $0x20,%rdx
+  801364:	48 09 d0             	or     %rdx,%rax
+#else
+  801367:	c9                   	leave
+  801368:	c3                   	ret
+
+0000000000801369 <string_cpu>:
+string_cpu(void) {
+  801369:	55                   	push   %rbp
+  80136a:	48 89 e5             	mov    %rsp,%rbp
+  80136d:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801371:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801378:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80137f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801386:	00 00 00 
+  801389:	8b 00                	mov    (%rax),%eax
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	78 11                	js     8013a0 <string_cpu+0x37>
+    return string_features;
+  80138f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801396:	00 00 00 
+  801399:	8b 00                	mov    (%rax),%eax
+  80139b:	e9 df 00 00 00       	jmp    80147f <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8013a0:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8013a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b4:	48 89 c6             	mov    %rax,%rsi
+  8013b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013bc:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  8013c3:	00 00 00 
+  8013c6:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8013c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013cb:	83 f8 06             	cmp    $0x6,%eax
+  8013ce:	76 28                	jbe    8013f8 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8013d0:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013df:	48 89 c2             	mov    %rax,%rdx
+  8013e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8013ec:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  8013f3:	00 00 00 
+  8013f6:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8013f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013fb:	25 00 02 00 00       	and    $0x200,%eax
+  801400:	85 c0                	test   %eax,%eax
+  801402:	74 04                	je     801408 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801404:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801408:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80140c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801412:	48 89 c1             	mov    %rax,%rcx
+  801415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141a:	be 00 00 00 00       	mov    $0x0,%esi
+  80141f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801424:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  80142b:	00 00 00 
+  80142e:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801430:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801433:	83 e0 20             	and    $0x20,%eax
+  801436:	85 c0                	test   %eax,%eax
+  801438:	74 2a                	je     801464 <string_cpu+0xfb>
+  80143a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80143d:	25 00 00 00 08       	and    $0x8000000,%eax
+  801442:	85 c0                	test   %eax,%eax
+  801444:	74 1e                	je     801464 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801446:	bf 00 00 00 00       	mov    $0x0,%edi
+  80144b:	48 b8 41 13 80 00 00 	movabs $0x801341,%rax
+  801452:	00 00 00 
+  801455:	ff d0                	call   *%rax
+  801457:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80145a:	48 83 f8 06          	cmp    $0x6,%rax
+  80145e:	75 04                	jne    801464 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801460:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801464:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80146b:	00 00 00 
+  80146e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801471:	89 02                	mov    %eax,(%rdx)
+  801473:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80147a:	00 00 00 
+  80147d:	8b 00                	mov    (%rax),%eax
+}
+  80147f:	c9                   	leave
+  801480:	c3                   	ret
+
+0000000000801481 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801481:	55                   	push   %rbp
+  801482:	48 89 e5             	mov    %rsp,%rbp
+  801485:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801489:	48 83 ec 60          	sub    $0x60,%rsp
+  80148d:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801492:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801497:	83 e0 1f             	and    $0x1f,%eax
+  80149a:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80149e:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014a2:	48 f7 d8             	neg    %rax
+  8014a5:	48 89 c2             	mov    %rax,%rdx
+  8014a8:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8014ad:	48 01 d0             	add    %rdx,%rax
+  8014b0:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8014b5:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8014b9:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8014bf:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014c4:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014c8:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8014ce:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014d2:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014d6:	89 c2                	mov    %eax,%edx
+  8014d8:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014dc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014e1:	89 c1                	mov    %eax,%ecx
+  8014e3:	d3 e6                	shl    %cl,%esi
+  8014e5:	89 f0                	mov    %esi,%eax
+  8014e7:	21 d0                	and    %edx,%eax
+  8014e9:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014ed:	eb 21                	jmp    801510 <strlen_avx2+0x8f>
+    p += 32;
+  8014ef:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8014f5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014fa:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014fe:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801504:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801508:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80150c:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801510:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801515:	74 d8                	je     8014ef <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801517:	31 c0                	xor    %eax,%eax
+  801519:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80151f:	48 63 d0             	movslq %eax,%rdx
+  801522:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801527:	48 01 d0             	add    %rdx,%rax
+  80152a:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+0000000000801531 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801539:	48 83 ec 40          	sub    $0x40,%rsp
+  80153d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801542:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801547:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80154c:	eb 77                	jmp    8015c5 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80154e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801553:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801557:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80155b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801560:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801564:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801568:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80156c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801570:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801575:	74 3c                	je     8015b3 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801577:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80157b:	f7 d0                	not    %eax
+  80157d:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801581:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801585:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801589:	48 63 d0             	movslq %eax,%rdx
+  80158c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801591:	48 01 d0             	add    %rdx,%rax
+  801594:	0f b6 00             	movzbl (%rax),%eax
+  801597:	0f b6 c0             	movzbl %al,%eax
+  80159a:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80159e:	48 63 ca             	movslq %edx,%rcx
+  8015a1:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8015a6:	48 01 ca             	add    %rcx,%rdx
+  8015a9:	0f b6 12             	movzbl (%rdx),%edx
+  8015ac:	0f b6 d2             	movzbl %dl,%edx
+  8015af:	29 d0                	sub    %edx,%eax
+  8015b1:	eb 6b                	jmp    80161e <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8015b3:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8015b9:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8015bf:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8015c5:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8015cb:	77 81                	ja     80154e <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8015cd:	eb 42                	jmp    801611 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8015cf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015d4:	0f b6 10             	movzbl (%rax),%edx
+  8015d7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015dc:	0f b6 00             	movzbl (%rax),%eax
+  8015df:	38 c2                	cmp    %al,%dl
+  8015e1:	74 1c                	je     8015ff <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8015e3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015e8:	0f b6 00             	movzbl (%rax),%eax
+  8015eb:	0f b6 c8             	movzbl %al,%ecx
+  8015ee:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015f3:	0f b6 00             	movzbl (%rax),%eax
+  8015f6:	0f b6 d0             	movzbl %al,%edx
+  8015f9:	89 c8                	mov    %ecx,%eax
+  8015fb:	29 d0                	sub    %edx,%eax
+  8015fd:	eb 1f                	jmp    80161e <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8015ff:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801605:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80160b:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801611:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801617:	75 b6                	jne    8015cf <memcmp_avx2+0x9e>
+  return 0;
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80161e:	c9                   	leave
+  80161f:	c3                   	ret
+
+0000000000801620 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801620:	55                   	push   %rbp
+  801621:	48 89 e5             	mov    %rsp,%rbp
+  801624:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801628:	48 83 ec 60          	sub    $0x60,%rsp
+  80162c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801631:	89 f0                	mov    %esi,%eax
+  801633:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801638:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80163c:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801641:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801645:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80164a:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801650:	eb 47                	jmp    801699 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801652:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801657:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80165b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80165f:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801665:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801669:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80166d:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801671:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801676:	74 15                	je     80168d <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801678:	31 c0                	xor    %eax,%eax
+  80167a:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801680:	48 63 d0             	movslq %eax,%rdx
+  801683:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801688:	48 01 d0             	add    %rdx,%rax
+  80168b:	eb 3d                	jmp    8016ca <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80168d:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801693:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801699:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80169f:	77 b1                	ja     801652 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8016a1:	eb 0c                	jmp    8016af <memfind_avx2+0x8f>
+  8016a3:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8016a9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8016af:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8016b5:	74 0e                	je     8016c5 <memfind_avx2+0xa5>
+  8016b7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016bc:	0f b6 00             	movzbl (%rax),%eax
+  8016bf:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8016c3:	75 de                	jne    8016a3 <memfind_avx2+0x83>
+  return s;
+  8016c5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+
+00000000008016cc <strlen>:
+strlen(const char *s) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	48 83 ec 40          	sub    $0x40,%rsp
+  8016d4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8016d8:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016dc:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8016e0:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  8016e7:	00 00 00 
+  8016ea:	ff d0                	call   *%rax
+  8016ec:	83 e0 02             	and    $0x2,%eax
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	74 18                	je     80170b <strlen+0x3f>
+    return strlen_avx2(s);
+  8016f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f7:	48 89 c7             	mov    %rax,%rdi
+  8016fa:	48 b8 81 14 80 00 00 	movabs $0x801481,%rax
+  801701:	00 00 00 
+  801704:	ff d0                	call   *%rax
+  801706:	e9 82 00 00 00       	jmp    80178d <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80170b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80170f:	83 e0 0f             	and    $0xf,%eax
+  801712:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801715:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801718:	48 f7 d8             	neg    %rax
+  80171b:	48 89 c2             	mov    %rax,%rdx
+  80171e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801722:	48 01 d0             	add    %rdx,%rax
+  801725:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801729:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801731:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801736:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80173a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80173e:	89 c2                	mov    %eax,%edx
+  801740:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801743:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801748:	89 c1                	mov    %eax,%ecx
+  80174a:	d3 e6                	shl    %cl,%esi
+  80174c:	89 f0                	mov    %esi,%eax
+  80174e:	21 d0                	and    %edx,%eax
+  801750:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801753:	eb 1d                	jmp    801772 <strlen+0xa6>
+    p += 16;
+  801755:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80175a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80175e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801762:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801767:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80176b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80176f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801772:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801776:	74 dd                	je     801755 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801778:	31 c0                	xor    %eax,%eax
+  80177a:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80177f:	48 63 d0             	movslq %eax,%rdx
+  801782:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801786:	48 01 d0             	add    %rdx,%rax
+  801789:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+
+000000000080178f <strnlen>:
+strnlen(const char *s, size_t size) {
+  80178f:	55                   	push   %rbp
+  801790:	48 89 e5             	mov    %rsp,%rbp
+  801793:	48 83 ec 20          	sub    $0x20,%rsp
+  801797:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80179b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80179f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8017a6:	eb 0e                	jmp    8017b6 <strnlen+0x27>
+    n++;
+  8017a8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017ac:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017b1:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8017b6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8017bb:	74 0b                	je     8017c8 <strnlen+0x39>
+  8017bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c1:	0f b6 00             	movzbl (%rax),%eax
+  8017c4:	84 c0                	test   %al,%al
+  8017c6:	75 e0                	jne    8017a8 <strnlen+0x19>
+  return n;
+  8017c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <strcpy>:
+strcpy(char *dst, const char *src) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8017d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8017dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8017e5:	90                   	nop
+  8017e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017ea:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017ee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017fe:	0f b6 12             	movzbl (%rdx),%edx
+  801801:	88 10                	mov    %dl,(%rax)
+  801803:	0f b6 00             	movzbl (%rax),%eax
+  801806:	84 c0                	test   %al,%al
+  801808:	75 dc                	jne    8017e6 <strcpy+0x19>
+  return ret;
+  80180a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80180e:	c9                   	leave
+  80180f:	c3                   	ret
+
+0000000000801810 <strcat>:
+strcat(char *dst, const char *src) {
+  801810:	55                   	push   %rbp
+  801811:	48 89 e5             	mov    %rsp,%rbp
+  801814:	48 83 ec 20          	sub    $0x20,%rsp
+  801818:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80181c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801824:	48 89 c7             	mov    %rax,%rdi
+  801827:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  80182e:	00 00 00 
+  801831:	ff d0                	call   *%rax
+  801833:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801836:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801839:	48 63 d0             	movslq %eax,%rdx
+  80183c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801840:	48 01 c2             	add    %rax,%rdx
+  801843:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801847:	48 89 c6             	mov    %rax,%rsi
+  80184a:	48 89 d7             	mov    %rdx,%rdi
+  80184d:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+  return dst;
+  801859:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80185d:	c9                   	leave
+  80185e:	c3                   	ret
+
+000000000080185f <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80185f:	55                   	push   %rbp
+  801860:	48 89 e5             	mov    %rsp,%rbp
+  801863:	48 83 ec 28          	sub    $0x28,%rsp
+  801867:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80186b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80186f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801873:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801877:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80187b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801882:	00 
+  801883:	eb 2a                	jmp    8018af <strncpy+0x50>
+    *dst++ = *src;
+  801885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801889:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80188d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801891:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801895:	0f b6 12             	movzbl (%rdx),%edx
+  801898:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80189a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	84 c0                	test   %al,%al
+  8018a3:	74 05                	je     8018aa <strncpy+0x4b>
+      src++;
+  8018a5:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8018aa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8018b7:	72 cc                	jb     801885 <strncpy+0x26>
+  return ret;
+  8018b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8018bd:	c9                   	leave
+  8018be:	c3                   	ret
+
+00000000008018bf <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8018bf:	55                   	push   %rbp
+  8018c0:	48 89 e5             	mov    %rsp,%rbp
+  8018c3:	48 83 ec 28          	sub    $0x28,%rsp
+  8018c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018cf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8018d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8018db:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018e0:	74 3d                	je     80191f <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8018e2:	eb 1d                	jmp    801901 <strlcpy+0x42>
+      *dst++ = *src++;
+  8018e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018e8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018fc:	0f b6 12             	movzbl (%rdx),%edx
+  8018ff:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801901:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801906:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80190b:	74 0b                	je     801918 <strlcpy+0x59>
+  80190d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801911:	0f b6 00             	movzbl (%rax),%eax
+  801914:	84 c0                	test   %al,%al
+  801916:	75 cc                	jne    8018e4 <strlcpy+0x25>
+    *dst = '\0';
+  801918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80191c:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80191f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801923:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801927:	c9                   	leave
+  801928:	c3                   	ret
+
+0000000000801929 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	48 83 ec 30          	sub    $0x30,%rsp
+  801931:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801935:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801939:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80193d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801941:	48 89 c7             	mov    %rax,%rdi
+  801944:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  80194b:	00 00 00 
+  80194e:	ff d0                	call   *%rax
+  801950:	48 98                	cltq
+  801952:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801956:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80195a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80195e:	48 89 d6             	mov    %rdx,%rsi
+  801961:	48 89 c7             	mov    %rax,%rdi
+  801964:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  80196b:	00 00 00 
+  80196e:	ff d0                	call   *%rax
+  801970:	48 98                	cltq
+  801972:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801976:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80197e:	75 10                	jne    801990 <strlcat+0x67>
+    return maxlen + srclen;
+  801980:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801988:	48 01 d0             	add    %rdx,%rax
+  80198b:	e9 86 00 00 00       	jmp    801a16 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801990:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801994:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801998:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80199c:	73 2b                	jae    8019c9 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80199e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ae:	48 01 c1             	add    %rax,%rcx
+  8019b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019b5:	48 89 c6             	mov    %rax,%rsi
+  8019b8:	48 89 cf             	mov    %rcx,%rdi
+  8019bb:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  8019c2:	00 00 00 
+  8019c5:	ff d0                	call   *%rax
+  8019c7:	eb 42                	jmp    801a0b <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8019c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019cd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019d1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d9:	48 01 c1             	add    %rax,%rcx
+  8019dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019e0:	48 89 c6             	mov    %rax,%rsi
+  8019e3:	48 89 cf             	mov    %rcx,%rdi
+  8019e6:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  8019ed:	00 00 00 
+  8019f0:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8019f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fa:	48 01 d0             	add    %rdx,%rax
+  8019fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a05:	48 01 d0             	add    %rdx,%rax
+  801a08:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801a0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a13:	48 01 d0             	add    %rdx,%rax
+}
+  801a16:	c9                   	leave
+  801a17:	c3                   	ret
+
+0000000000801a18 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801a18:	55                   	push   %rbp
+  801a19:	48 89 e5             	mov    %rsp,%rbp
+  801a1c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a20:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a24:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a28:	eb 0a                	jmp    801a34 <strcmp+0x1c>
+    p++, q++;
+  801a2a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a2f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a38:	0f b6 00             	movzbl (%rax),%eax
+  801a3b:	84 c0                	test   %al,%al
+  801a3d:	74 12                	je     801a51 <strcmp+0x39>
+  801a3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a43:	0f b6 10             	movzbl (%rax),%edx
+  801a46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a4a:	0f b6 00             	movzbl (%rax),%eax
+  801a4d:	38 c2                	cmp    %al,%dl
+  801a4f:	74 d9                	je     801a2a <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a55:	0f b6 00             	movzbl (%rax),%eax
+  801a58:	0f b6 d0             	movzbl %al,%edx
+  801a5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5f:	0f b6 00             	movzbl (%rax),%eax
+  801a62:	0f b6 c0             	movzbl %al,%eax
+  801a65:	29 c2                	sub    %eax,%edx
+  801a67:	89 d0                	mov    %edx,%eax
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+0000000000801a6b <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a7b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a7f:	eb 0f                	jmp    801a90 <strncmp+0x25>
+    n--, p++, q++;
+  801a81:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801a86:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a8b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a90:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a95:	74 1d                	je     801ab4 <strncmp+0x49>
+  801a97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9b:	0f b6 00             	movzbl (%rax),%eax
+  801a9e:	84 c0                	test   %al,%al
+  801aa0:	74 12                	je     801ab4 <strncmp+0x49>
+  801aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa6:	0f b6 10             	movzbl (%rax),%edx
+  801aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aad:	0f b6 00             	movzbl (%rax),%eax
+  801ab0:	38 c2                	cmp    %al,%dl
+  801ab2:	74 cd                	je     801a81 <strncmp+0x16>
+  if (n == 0)
+  801ab4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ab9:	75 07                	jne    801ac2 <strncmp+0x57>
+    return 0;
+  801abb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac0:	eb 16                	jmp    801ad8 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801ac2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac6:	0f b6 00             	movzbl (%rax),%eax
+  801ac9:	0f b6 d0             	movzbl %al,%edx
+  801acc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad0:	0f b6 00             	movzbl (%rax),%eax
+  801ad3:	0f b6 c0             	movzbl %al,%eax
+  801ad6:	29 c2                	sub    %eax,%edx
+}
+  801ad8:	89 d0                	mov    %edx,%eax
+  801ada:	c9                   	leave
+  801adb:	c3                   	ret
+
+0000000000801adc <strchr>:
+strchr(const char *s, char c) {
+  801adc:	55                   	push   %rbp
+  801add:	48 89 e5             	mov    %rsp,%rbp
+  801ae0:	48 83 ec 60          	sub    $0x60,%rsp
+  801ae4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801ae8:	89 f0                	mov    %esi,%eax
+  801aea:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801aed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801af1:	83 e0 0f             	and    $0xf,%eax
+  801af4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801af7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801afa:	48 f7 d8             	neg    %rax
+  801afd:	48 89 c2             	mov    %rax,%rdx
+  801b00:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b04:	48 01 d0             	add    %rdx,%rax
+  801b07:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801b0b:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801b0f:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801b13:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801b17:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b1b:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b1f:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b23:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b28:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801b2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b30:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b34:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b38:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b3d:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b42:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b46:	89 c2                	mov    %eax,%edx
+  801b48:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b4d:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b52:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b56:	09 c2                	or     %eax,%edx
+  801b58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b5b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801b60:	89 c1                	mov    %eax,%ecx
+  801b62:	d3 e6                	shl    %cl,%esi
+  801b64:	89 f0                	mov    %esi,%eax
+  801b66:	21 d0                	and    %edx,%eax
+  801b68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b6b:	eb 34                	jmp    801ba1 <strchr+0xc5>
+    p += 16;
+  801b6d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801b72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b76:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b7a:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801b7e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b83:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b88:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b8c:	89 c2                	mov    %eax,%edx
+  801b8e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b93:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b98:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b9c:	09 d0                	or     %edx,%eax
+  801b9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801ba1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ba5:	74 c6                	je     801b6d <strchr+0x91>
+  p += __builtin_ctz(m);
+  801ba7:	31 c0                	xor    %eax,%eax
+  801ba9:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801bae:	48 98                	cltq
+  801bb0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801bb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bb8:	0f b6 00             	movzbl (%rax),%eax
+  801bbb:	84 c0                	test   %al,%al
+  801bbd:	74 06                	je     801bc5 <strchr+0xe9>
+  801bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc3:	eb 05                	jmp    801bca <strchr+0xee>
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bca:	c9                   	leave
+  801bcb:	c3                   	ret
+
+0000000000801bcc <strfind>:
+strfind(const char *s, char c) {
+  801bcc:	55                   	push   %rbp
+  801bcd:	48 89 e5             	mov    %rsp,%rbp
+  801bd0:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bd8:	89 f0                	mov    %esi,%eax
+  801bda:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801bdd:	eb 11                	jmp    801bf0 <strfind+0x24>
+    if (*s == c)
+  801bdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801be3:	0f b6 00             	movzbl (%rax),%eax
+  801be6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801be9:	74 12                	je     801bfd <strfind+0x31>
+  for (; *s; s++)
+  801beb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf4:	0f b6 00             	movzbl (%rax),%eax
+  801bf7:	84 c0                	test   %al,%al
+  801bf9:	75 e4                	jne    801bdf <strfind+0x13>
+  801bfb:	eb 01                	jmp    801bfe <strfind+0x32>
+      break;
+  801bfd:	90                   	nop
+  return (char *)s;
+  801bfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801c02:	c9                   	leave
+  801c03:	c3                   	ret
+
+0000000000801c04 <memset>:
+memset(void *v, int c, size_t n) {
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+  801c08:	48 83 ec 38          	sub    $0x38,%rsp
+  801c0c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c10:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801c13:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801c17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c1f:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c24:	76 41                	jbe    801c67 <memset+0x63>
+  801c26:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  801c2d:	00 00 00 
+  801c30:	ff d0                	call   *%rax
+  801c32:	83 e0 01             	and    $0x1,%eax
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	74 2e                	je     801c67 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c39:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c3c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c40:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c44:	48 89 ce             	mov    %rcx,%rsi
+  801c47:	48 89 f7             	mov    %rsi,%rdi
+  801c4a:	48 89 d1             	mov    %rdx,%rcx
+  801c4d:	fc                   	cld
+  801c4e:	f3 aa                	rep stos %al,%es:(%rdi)
+  801c50:	48 89 ca             	mov    %rcx,%rdx
+  801c53:	48 89 fe             	mov    %rdi,%rsi
+  801c56:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801c5a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801c5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c62:	e9 a7 00 00 00       	jmp    801d0e <memset+0x10a>
+  if (n >= 8) {
+  801c67:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c6c:	0f 86 87 00 00 00    	jbe    801cf9 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801c72:	eb 16                	jmp    801c8a <memset+0x86>
+      *p++ = c;
+  801c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c78:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c7c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c80:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801c83:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801c85:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8e:	83 e0 07             	and    $0x7,%eax
+  801c91:	48 85 c0             	test   %rax,%rax
+  801c94:	75 de                	jne    801c74 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801c96:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c99:	0f b6 c0             	movzbl %al,%eax
+  801c9c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801ca3:	01 01 01 
+  801ca6:	48 0f af c2          	imul   %rdx,%rax
+  801caa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801cae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cb2:	48 c1 e8 03          	shr    $0x3,%rax
+  801cb6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801cba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cbe:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801cc2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cc6:	48 89 ce             	mov    %rcx,%rsi
+  801cc9:	48 89 f7             	mov    %rsi,%rdi
+  801ccc:	48 89 d1             	mov    %rdx,%rcx
+  801ccf:	fc                   	cld
+  801cd0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801cd3:	48 89 ca             	mov    %rcx,%rdx
+  801cd6:	48 89 fe             	mov    %rdi,%rsi
+  801cd9:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801cdd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801ce1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ce6:	eb 11                	jmp    801cf9 <memset+0xf5>
+    *p++ = c;
+  801ce8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cf0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cf4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cf7:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801cf9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cfd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d01:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d05:	48 85 c0             	test   %rax,%rax
+  801d08:	75 de                	jne    801ce8 <memset+0xe4>
+  return v;
+  801d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+0000000000801d10 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801d10:	55                   	push   %rbp
+  801d11:	48 89 e5             	mov    %rsp,%rbp
+  801d14:	48 83 ec 38          	sub    $0x38,%rsp
+  801d18:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d1c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d20:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801d24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801d2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d38:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d3c:	0f 83 da 00 00 00    	jae    801e1c <memmove+0x10c>
+  801d42:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4a:	48 01 d0             	add    %rdx,%rax
+  801d4d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801d51:	0f 83 c5 00 00 00    	jae    801e1c <memmove+0x10c>
+    s += n;
+  801d57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d5b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801d5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d63:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801d67:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d6c:	0f 86 94 00 00 00    	jbe    801e06 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801d72:	eb 1c                	jmp    801d90 <memmove+0x80>
+        *--d = *--s;
+  801d74:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801d79:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801d7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d82:	0f b6 10             	movzbl (%rax),%edx
+  801d85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d89:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d8b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d94:	83 e0 07             	and    $0x7,%eax
+  801d97:	48 85 c0             	test   %rax,%rax
+  801d9a:	75 d8                	jne    801d74 <memmove+0x64>
+      nq = n / 8;
+  801d9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da0:	48 c1 e8 03          	shr    $0x3,%rax
+  801da4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801da8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801dad:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801db2:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801db7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dbb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dc3:	48 89 cf             	mov    %rcx,%rdi
+  801dc6:	48 89 d6             	mov    %rdx,%rsi
+  801dc9:	48 89 c1             	mov    %rax,%rcx
+  801dcc:	fd                   	std
+  801dcd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801dd0:	fc                   	cld
+  801dd1:	48 89 c8             	mov    %rcx,%rax
+  801dd4:	48 89 f2             	mov    %rsi,%rdx
+  801dd7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ddb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ddf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801de3:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801de8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801ded:	eb 17                	jmp    801e06 <memmove+0xf6>
+      *--d = *--s;
+  801def:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801df4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801df9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dfd:	0f b6 10             	movzbl (%rax),%edx
+  801e00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e04:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801e06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e0e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e12:	48 85 c0             	test   %rax,%rax
+  801e15:	75 d8                	jne    801def <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801e17:	e9 f4 00 00 00       	jmp    801f10 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e1c:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e21:	76 46                	jbe    801e69 <memmove+0x159>
+  801e23:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  801e2a:	00 00 00 
+  801e2d:	ff d0                	call   *%rax
+  801e2f:	83 e0 01             	and    $0x1,%eax
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	74 33                	je     801e69 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e36:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e3a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e42:	48 89 cf             	mov    %rcx,%rdi
+  801e45:	48 89 d6             	mov    %rdx,%rsi
+  801e48:	48 89 c1             	mov    %rax,%rcx
+  801e4b:	fc                   	cld
+  801e4c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e4e:	48 89 c8             	mov    %rcx,%rax
+  801e51:	48 89 f2             	mov    %rsi,%rdx
+  801e54:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e58:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801e60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e64:	e9 ab 00 00 00       	jmp    801f14 <memmove+0x204>
+    if (n >= 8) {
+  801e69:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801e6e:	0f 86 8b 00 00 00    	jbe    801eff <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801e74:	eb 22                	jmp    801e98 <memmove+0x188>
+        *d++ = *s++;
+  801e76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e7a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e86:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e8a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801e8e:	0f b6 12             	movzbl (%rdx),%edx
+  801e91:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801e93:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801e98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e9c:	83 e0 07             	and    $0x7,%eax
+  801e9f:	48 85 c0             	test   %rax,%rax
+  801ea2:	75 d2                	jne    801e76 <memmove+0x166>
+      nq = n / 8;
+  801ea4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea8:	48 c1 e8 03          	shr    $0x3,%rax
+  801eac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801eb0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801eb4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ebc:	48 89 cf             	mov    %rcx,%rdi
+  801ebf:	48 89 d6             	mov    %rdx,%rsi
+  801ec2:	48 89 c1             	mov    %rax,%rcx
+  801ec5:	fc                   	cld
+  801ec6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ec9:	48 89 c8             	mov    %rcx,%rax
+  801ecc:	48 89 f2             	mov    %rsi,%rdx
+  801ecf:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ed3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ed7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801edb:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801ee0:	eb 1d                	jmp    801eff <memmove+0x1ef>
+      *d++ = *s++;
+  801ee2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ee6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801eea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801eee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ef2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ef6:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801efa:	0f b6 12             	movzbl (%rdx),%edx
+  801efd:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801eff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f03:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f07:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f0b:	48 85 c0             	test   %rax,%rax
+  801f0e:	75 d2                	jne    801ee2 <memmove+0x1d2>
+  return dst;
+  801f10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+
+0000000000801f16 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	48 83 ec 18          	sub    $0x18,%rsp
+  801f1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801f2a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f2e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f36:	48 89 ce             	mov    %rcx,%rsi
+  801f39:	48 89 c7             	mov    %rax,%rdi
+  801f3c:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+}
+  801f48:	c9                   	leave
+  801f49:	c3                   	ret
+
+0000000000801f4a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801f4a:	55                   	push   %rbp
+  801f4b:	48 89 e5             	mov    %rsp,%rbp
+  801f4e:	48 83 ec 40          	sub    $0x40,%rsp
+  801f52:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f56:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f5a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801f5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801f66:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f6a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f6e:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801f73:	0f 86 a7 00 00 00    	jbe    802020 <memcmp+0xd6>
+  801f79:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  801f80:	00 00 00 
+  801f83:	ff d0                	call   *%rax
+  801f85:	83 e0 02             	and    $0x2,%eax
+  801f88:	85 c0                	test   %eax,%eax
+  801f8a:	0f 84 90 00 00 00    	je     802020 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801f90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f94:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f9c:	48 89 ce             	mov    %rcx,%rsi
+  801f9f:	48 89 c7             	mov    %rax,%rdi
+  801fa2:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	e9 c2 00 00 00       	jmp    802075 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fbb:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801fbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fc3:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fc7:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fcb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fcf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801fd2:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801fd9:	74 36                	je     802011 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801fdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fde:	f7 d0                	not    %eax
+  801fe0:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801fe4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801fe7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fea:	48 63 d0             	movslq %eax,%rdx
+  801fed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff1:	48 01 d0             	add    %rdx,%rax
+  801ff4:	0f b6 00             	movzbl (%rax),%eax
+  801ff7:	0f b6 c0             	movzbl %al,%eax
+  801ffa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ffd:	48 63 ca             	movslq %edx,%rcx
+  802000:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802004:	48 01 ca             	add    %rcx,%rdx
+  802007:	0f b6 12             	movzbl (%rdx),%edx
+  80200a:	0f b6 d2             	movzbl %dl,%edx
+  80200d:	29 d0                	sub    %edx,%eax
+  80200f:	eb 64                	jmp    802075 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  802011:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  802016:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80201b:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802020:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802025:	77 8c                	ja     801fb3 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802027:	eb 36                	jmp    80205f <memcmp+0x115>
+    if (*s1 != *s2)
+  802029:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80202d:	0f b6 10             	movzbl (%rax),%edx
+  802030:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802034:	0f b6 00             	movzbl (%rax),%eax
+  802037:	38 c2                	cmp    %al,%dl
+  802039:	74 1a                	je     802055 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80203b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80203f:	0f b6 00             	movzbl (%rax),%eax
+  802042:	0f b6 c8             	movzbl %al,%ecx
+  802045:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802049:	0f b6 00             	movzbl (%rax),%eax
+  80204c:	0f b6 d0             	movzbl %al,%edx
+  80204f:	89 c8                	mov    %ecx,%eax
+  802051:	29 d0                	sub    %edx,%eax
+  802053:	eb 20                	jmp    802075 <memcmp+0x12b>
+    s1++, s2++;
+  802055:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80205a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80205f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802063:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802067:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80206b:	48 85 c0             	test   %rax,%rax
+  80206e:	75 b9                	jne    802029 <memcmp+0xdf>
+  }
+
+  return 0;
+  802070:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+0000000000802077 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	48 83 ec 50          	sub    $0x50,%rsp
+  80207f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802083:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802086:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  80208a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80208e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802092:	48 01 d0             	add    %rdx,%rax
+  802095:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802099:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80209c:	66 0f 6e c0          	movd   %eax,%xmm0
+  8020a0:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8020a4:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8020a8:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8020ad:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8020b1:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8020b6:	76 73                	jbe    80212b <memfind+0xb4>
+  8020b8:	48 b8 69 13 80 00 00 	movabs $0x801369,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+  8020c4:	83 e0 02             	and    $0x2,%eax
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	74 60                	je     80212b <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8020cb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020ce:	0f b6 c8             	movzbl %al,%ecx
+  8020d1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d9:	89 ce                	mov    %ecx,%esi
+  8020db:	48 89 c7             	mov    %rax,%rdi
+  8020de:	48 b8 20 16 80 00 00 	movabs $0x801620,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	eb 6c                	jmp    802158 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8020ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020f0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8020f4:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8020f8:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8020fd:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802101:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802105:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802108:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80210c:	74 13                	je     802121 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  80210e:	31 c0                	xor    %eax,%eax
+  802110:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802115:	48 63 d0             	movslq %eax,%rdx
+  802118:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80211c:	48 01 d0             	add    %rdx,%rax
+  80211f:	eb 37                	jmp    802158 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802121:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802126:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  80212b:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802130:	77 ba                	ja     8020ec <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802132:	eb 13                	jmp    802147 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802134:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802138:	0f b6 00             	movzbl (%rax),%eax
+  80213b:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80213e:	38 d0                	cmp    %dl,%al
+  802140:	74 11                	je     802153 <memfind+0xdc>
+  for (; s < ends; s++)
+  802142:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802147:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80214b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80214f:	72 e3                	jb     802134 <memfind+0xbd>
+  802151:	eb 01                	jmp    802154 <memfind+0xdd>
+      break;
+  802153:	90                   	nop
+  return (void *)s;
+  802154:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802158:	c9                   	leave
+  802159:	c3                   	ret
+
+000000000080215a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80215a:	55                   	push   %rbp
+  80215b:	48 89 e5             	mov    %rsp,%rbp
+  80215e:	48 83 ec 38          	sub    $0x38,%rsp
+  802162:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802166:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80216a:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  80216d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802174:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80217b:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80217c:	eb 05                	jmp    802183 <strtol+0x29>
+    s++;
+  80217e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802183:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802187:	0f b6 00             	movzbl (%rax),%eax
+  80218a:	3c 20                	cmp    $0x20,%al
+  80218c:	74 f0                	je     80217e <strtol+0x24>
+  80218e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802192:	0f b6 00             	movzbl (%rax),%eax
+  802195:	3c 09                	cmp    $0x9,%al
+  802197:	74 e5                	je     80217e <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802199:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80219d:	0f b6 00             	movzbl (%rax),%eax
+  8021a0:	3c 2b                	cmp    $0x2b,%al
+  8021a2:	75 07                	jne    8021ab <strtol+0x51>
+    s++;
+  8021a4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021a9:	eb 17                	jmp    8021c2 <strtol+0x68>
+  else if (*s == '-')
+  8021ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021af:	0f b6 00             	movzbl (%rax),%eax
+  8021b2:	3c 2d                	cmp    $0x2d,%al
+  8021b4:	75 0c                	jne    8021c2 <strtol+0x68>
+    s++, neg = 1;
+  8021b6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021bb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8021c2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021c6:	74 06                	je     8021ce <strtol+0x74>
+  8021c8:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8021cc:	75 28                	jne    8021f6 <strtol+0x9c>
+  8021ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d2:	0f b6 00             	movzbl (%rax),%eax
+  8021d5:	3c 30                	cmp    $0x30,%al
+  8021d7:	75 1d                	jne    8021f6 <strtol+0x9c>
+  8021d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021dd:	48 83 c0 01          	add    $0x1,%rax
+  8021e1:	0f b6 00             	movzbl (%rax),%eax
+  8021e4:	3c 78                	cmp    $0x78,%al
+  8021e6:	75 0e                	jne    8021f6 <strtol+0x9c>
+    s += 2, base = 16;
+  8021e8:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8021ed:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8021f4:	eb 2c                	jmp    802222 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8021f6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021fa:	75 19                	jne    802215 <strtol+0xbb>
+  8021fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802200:	0f b6 00             	movzbl (%rax),%eax
+  802203:	3c 30                	cmp    $0x30,%al
+  802205:	75 0e                	jne    802215 <strtol+0xbb>
+    s++, base = 8;
+  802207:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80220c:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802213:	eb 0d                	jmp    802222 <strtol+0xc8>
+  else if (base == 0)
+  802215:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802219:	75 07                	jne    802222 <strtol+0xc8>
+    base = 10;
+  80221b:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802222:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802226:	0f b6 00             	movzbl (%rax),%eax
+  802229:	3c 2f                	cmp    $0x2f,%al
+  80222b:	7e 1d                	jle    80224a <strtol+0xf0>
+  80222d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802231:	0f b6 00             	movzbl (%rax),%eax
+  802234:	3c 39                	cmp    $0x39,%al
+  802236:	7f 12                	jg     80224a <strtol+0xf0>
+      dig = *s - '0';
+  802238:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80223c:	0f b6 00             	movzbl (%rax),%eax
+  80223f:	0f be c0             	movsbl %al,%eax
+  802242:	83 e8 30             	sub    $0x30,%eax
+  802245:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802248:	eb 4e                	jmp    802298 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80224a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224e:	0f b6 00             	movzbl (%rax),%eax
+  802251:	3c 60                	cmp    $0x60,%al
+  802253:	7e 1d                	jle    802272 <strtol+0x118>
+  802255:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802259:	0f b6 00             	movzbl (%rax),%eax
+  80225c:	3c 7a                	cmp    $0x7a,%al
+  80225e:	7f 12                	jg     802272 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802260:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802264:	0f b6 00             	movzbl (%rax),%eax
+  802267:	0f be c0             	movsbl %al,%eax
+  80226a:	83 e8 57             	sub    $0x57,%eax
+  80226d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802270:	eb 26                	jmp    802298 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802272:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802276:	0f b6 00             	movzbl (%rax),%eax
+  802279:	3c 40                	cmp    $0x40,%al
+  80227b:	7e 47                	jle    8022c4 <strtol+0x16a>
+  80227d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802281:	0f b6 00             	movzbl (%rax),%eax
+  802284:	3c 5a                	cmp    $0x5a,%al
+  802286:	7f 3c                	jg     8022c4 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802288:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80228c:	0f b6 00             	movzbl (%rax),%eax
+  80228f:	0f be c0             	movsbl %al,%eax
+  802292:	83 e8 37             	sub    $0x37,%eax
+  802295:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802298:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80229b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80229e:	7d 23                	jge    8022c3 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8022a0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8022a5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022a8:	48 98                	cltq
+  8022aa:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8022af:	48 89 c2             	mov    %rax,%rdx
+  8022b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022b5:	48 98                	cltq
+  8022b7:	48 01 d0             	add    %rdx,%rax
+  8022ba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8022be:	e9 5f ff ff ff       	jmp    802222 <strtol+0xc8>
+      break;
+  8022c3:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8022c4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8022c9:	74 0b                	je     8022d6 <strtol+0x17c>
+    *endptr = (char *)s;
+  8022cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022cf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8022d3:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8022d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022da:	74 09                	je     8022e5 <strtol+0x18b>
+  8022dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022e0:	48 f7 d8             	neg    %rax
+  8022e3:	eb 04                	jmp    8022e9 <strtol+0x18f>
+  8022e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+
+00000000008022eb <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8022eb:	55                   	push   %rbp
+  8022ec:	48 89 e5             	mov    %rsp,%rbp
+  8022ef:	53                   	push   %rbx
+  8022f0:	48 83 ec 48          	sub    $0x48,%rsp
+  8022f4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8022fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802300:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802304:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802308:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80230c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802310:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802314:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802318:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80231c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802320:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802324:	4c 89 c3             	mov    %r8,%rbx
+  802327:	cd 30                	int    $0x30
+  802329:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80232d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802332:	74 46                	je     80237a <syscall+0x8f>
+  802334:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802339:	7e 3f                	jle    80237a <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80233b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80233f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802343:	49 89 d0             	mov    %rdx,%r8
+  802346:	48 89 c1             	mov    %rax,%rcx
+  802349:	48 b8 a8 60 80 00 00 	movabs $0x8060a8,%rax
+  802350:	00 00 00 
+  802353:	48 89 c2             	mov    %rax,%rdx
+  802356:	be 22 00 00 00       	mov    $0x22,%esi
+  80235b:	48 b8 c7 60 80 00 00 	movabs $0x8060c7,%rax
+  802362:	00 00 00 
+  802365:	48 89 c7             	mov    %rax,%rdi
+  802368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236d:	49 b9 fe 05 80 00 00 	movabs $0x8005fe,%r9
+  802374:	00 00 00 
+  802377:	41 ff d1             	call   *%r9
+
+  return ret;
+  80237a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80237e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802382:	c9                   	leave
+  802383:	c3                   	ret
+
+0000000000802384 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802384:	55                   	push   %rbp
+  802385:	48 89 e5             	mov    %rsp,%rbp
+  802388:	48 83 ec 10          	sub    $0x10,%rsp
+  80238c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802390:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802394:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80239c:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a0:	6a 00                	push   $0x0
+  8023a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023ae:	48 89 d1             	mov    %rdx,%rcx
+  8023b1:	48 89 c2             	mov    %rax,%rdx
+  8023b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023be:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+  8023ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ce:	90                   	nop
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+00000000008023d1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8023d1:	55                   	push   %rbp
+  8023d2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8023d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d9:	6a 00                	push   $0x0
+  8023db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023fb:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+  802407:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+000000000080240d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80240d:	55                   	push   %rbp
+  80240e:	48 89 e5             	mov    %rsp,%rbp
+  802411:	48 83 ec 10          	sub    $0x10,%rsp
+  802415:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802418:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80241b:	48 98                	cltq
+  80241d:	48 83 ec 08          	sub    $0x8,%rsp
+  802421:	6a 00                	push   $0x0
+  802423:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802434:	48 89 c2             	mov    %rax,%rdx
+  802437:	be 01 00 00 00       	mov    $0x1,%esi
+  80243c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802441:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+  80244d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802451:	c9                   	leave
+  802452:	c3                   	ret
+
+0000000000802453 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802453:	55                   	push   %rbp
+  802454:	48 89 e5             	mov    %rsp,%rbp
+  802457:	48 83 ec 10          	sub    $0x10,%rsp
+  80245b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80245e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802461:	48 98                	cltq
+  802463:	48 83 ec 08          	sub    $0x8,%rsp
+  802467:	6a 00                	push   $0x0
+  802469:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80246f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802475:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80247a:	48 89 c2             	mov    %rax,%rdx
+  80247d:	be 00 00 00 00       	mov    $0x0,%esi
+  802482:	bf 04 00 00 00       	mov    $0x4,%edi
+  802487:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+  802493:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802497:	90                   	nop
+  802498:	c9                   	leave
+  802499:	c3                   	ret
+
+000000000080249a <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80249a:	55                   	push   %rbp
+  80249b:	48 89 e5             	mov    %rsp,%rbp
+  80249e:	48 83 ec 20          	sub    $0x20,%rsp
+  8024a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8024a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024ac:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8024af:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024b4:	cd 30                	int    $0x30
+  8024b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8024ba:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8024be:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8024c3:	7e 3d                	jle    802502 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8024c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c9:	49 89 c0             	mov    %rax,%r8
+  8024cc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024d1:	48 b8 a8 60 80 00 00 	movabs $0x8060a8,%rax
+  8024d8:	00 00 00 
+  8024db:	48 89 c2             	mov    %rax,%rdx
+  8024de:	be 49 00 00 00       	mov    $0x49,%esi
+  8024e3:	48 b8 c7 60 80 00 00 	movabs $0x8060c7,%rax
+  8024ea:	00 00 00 
+  8024ed:	48 89 c7             	mov    %rax,%rdi
+  8024f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f5:	49 b9 fe 05 80 00 00 	movabs $0x8005fe,%r9
+  8024fc:	00 00 00 
+  8024ff:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802502:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802507:	75 13                	jne    80251c <sys_env_wait+0x82>
+  802509:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80250e:	74 0c                	je     80251c <sys_env_wait+0x82>
+    *status = st;
+  802510:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802514:	89 c2                	mov    %eax,%edx
+  802516:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80251a:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80251c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802520:	c9                   	leave
+  802521:	c3                   	ret
+
+0000000000802522 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802522:	55                   	push   %rbp
+  802523:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802526:	48 83 ec 08          	sub    $0x8,%rsp
+  80252a:	6a 00                	push   $0x0
+  80252c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802532:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802538:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802542:	be 00 00 00 00       	mov    $0x0,%esi
+  802547:	bf 02 00 00 00       	mov    $0x2,%edi
+  80254c:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+  802558:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255c:	c9                   	leave
+  80255d:	c3                   	ret
+
+000000000080255e <sys_yield>:
+
+void
+sys_yield(void) {
+  80255e:	55                   	push   %rbp
+  80255f:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802562:	48 83 ec 08          	sub    $0x8,%rsp
+  802566:	6a 00                	push   $0x0
+  802568:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80256e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802574:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257e:	be 00 00 00 00       	mov    $0x0,%esi
+  802583:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802588:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+  802594:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802598:	90                   	nop
+  802599:	c9                   	leave
+  80259a:	c3                   	ret
+
+000000000080259b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80259b:	55                   	push   %rbp
+  80259c:	48 89 e5             	mov    %rsp,%rbp
+  80259f:	48 83 ec 20          	sub    $0x20,%rsp
+  8025a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025aa:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8025ad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025b0:	48 63 c8             	movslq %eax,%rcx
+  8025b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025ba:	48 98                	cltq
+  8025bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c0:	6a 00                	push   $0x0
+  8025c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c8:	49 89 c8             	mov    %rcx,%r8
+  8025cb:	48 89 d1             	mov    %rdx,%rcx
+  8025ce:	48 89 c2             	mov    %rax,%rdx
+  8025d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8025db:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8025e2:	00 00 00 
+  8025e5:	ff d0                	call   *%rax
+  8025e7:	48 83 c4 10          	add    $0x10,%rsp
+  8025eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8025ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+
+00000000008025f3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8025f3:	55                   	push   %rbp
+  8025f4:	48 89 e5             	mov    %rsp,%rbp
+  8025f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8025fb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802602:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802605:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802609:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80260d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802610:	48 63 c8             	movslq %eax,%rcx
+  802613:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802617:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80261a:	48 63 f0             	movslq %eax,%rsi
+  80261d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802621:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802624:	48 98                	cltq
+  802626:	48 83 ec 08          	sub    $0x8,%rsp
+  80262a:	51                   	push   %rcx
+  80262b:	49 89 f9             	mov    %rdi,%r9
+  80262e:	49 89 f0             	mov    %rsi,%r8
+  802631:	48 89 d1             	mov    %rdx,%rcx
+  802634:	48 89 c2             	mov    %rax,%rdx
+  802637:	be 01 00 00 00       	mov    $0x1,%esi
+  80263c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802641:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+  80264d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802651:	c9                   	leave
+  802652:	c3                   	ret
+
+0000000000802653 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802653:	55                   	push   %rbp
+  802654:	48 89 e5             	mov    %rsp,%rbp
+  802657:	48 83 ec 10          	sub    $0x10,%rsp
+  80265b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80265e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802662:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802666:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802669:	48 98                	cltq
+  80266b:	48 83 ec 08          	sub    $0x8,%rsp
+  80266f:	6a 00                	push   $0x0
+  802671:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802677:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80267d:	48 89 d1             	mov    %rdx,%rcx
+  802680:	48 89 c2             	mov    %rax,%rdx
+  802683:	be 01 00 00 00       	mov    $0x1,%esi
+  802688:	bf 08 00 00 00       	mov    $0x8,%edi
+  80268d:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+  802699:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269d:	c9                   	leave
+  80269e:	c3                   	ret
+
+000000000080269f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80269f:	55                   	push   %rbp
+  8026a0:	48 89 e5             	mov    %rsp,%rbp
+  8026a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026aa:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8026ad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8026b0:	48 63 d0             	movslq %eax,%rdx
+  8026b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026b6:	48 98                	cltq
+  8026b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026bc:	6a 00                	push   $0x0
+  8026be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ca:	48 89 d1             	mov    %rdx,%rcx
+  8026cd:	48 89 c2             	mov    %rax,%rdx
+  8026d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8026da:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+  8026e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+00000000008026ec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8026ec:	55                   	push   %rbp
+  8026ed:	48 89 e5             	mov    %rsp,%rbp
+  8026f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8026fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802702:	48 98                	cltq
+  802704:	48 83 ec 08          	sub    $0x8,%rsp
+  802708:	6a 00                	push   $0x0
+  80270a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802710:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802716:	48 89 d1             	mov    %rdx,%rcx
+  802719:	48 89 c2             	mov    %rax,%rdx
+  80271c:	be 01 00 00 00       	mov    $0x1,%esi
+  802721:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802726:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+  802732:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+0000000000802738 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802738:	55                   	push   %rbp
+  802739:	48 89 e5             	mov    %rsp,%rbp
+  80273c:	48 83 ec 10          	sub    $0x10,%rsp
+  802740:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802743:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802747:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80274b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80274e:	48 98                	cltq
+  802750:	48 83 ec 08          	sub    $0x8,%rsp
+  802754:	6a 00                	push   $0x0
+  802756:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80275c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802762:	48 89 d1             	mov    %rdx,%rcx
+  802765:	48 89 c2             	mov    %rax,%rdx
+  802768:	be 01 00 00 00       	mov    $0x1,%esi
+  80276d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802772:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802779:	00 00 00 
+  80277c:	ff d0                	call   *%rax
+  80277e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802782:	c9                   	leave
+  802783:	c3                   	ret
+
+0000000000802784 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802784:	55                   	push   %rbp
+  802785:	48 89 e5             	mov    %rsp,%rbp
+  802788:	48 83 ec 20          	sub    $0x20,%rsp
+  80278c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80278f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802793:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802797:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80279a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80279d:	48 63 f0             	movslq %eax,%rsi
+  8027a0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027ab:	48 98                	cltq
+  8027ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b1:	6a 00                	push   $0x0
+  8027b3:	49 89 f1             	mov    %rsi,%r9
+  8027b6:	49 89 c8             	mov    %rcx,%r8
+  8027b9:	48 89 d1             	mov    %rdx,%rcx
+  8027bc:	48 89 c2             	mov    %rax,%rdx
+  8027bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027c9:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d9:	c9                   	leave
+  8027da:	c3                   	ret
+
+00000000008027db <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+  8027df:	48 83 ec 10          	sub    $0x10,%rsp
+  8027e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8027e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ef:	6a 00                	push   $0x0
+  8027f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802802:	48 89 c2             	mov    %rax,%rdx
+  802805:	be 01 00 00 00       	mov    $0x1,%esi
+  80280a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80280f:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80281f:	c9                   	leave
+  802820:	c3                   	ret
+
+0000000000802821 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802821:	55                   	push   %rbp
+  802822:	48 89 e5             	mov    %rsp,%rbp
+  802825:	48 83 ec 10          	sub    $0x10,%rsp
+  802829:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80282d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802831:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802835:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802839:	48 83 ec 08          	sub    $0x8,%rsp
+  80283d:	6a 00                	push   $0x0
+  80283f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802845:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80284b:	48 89 d1             	mov    %rdx,%rcx
+  80284e:	48 89 c2             	mov    %rax,%rdx
+  802851:	be 01 00 00 00       	mov    $0x1,%esi
+  802856:	bf 10 00 00 00       	mov    $0x10,%edi
+  80285b:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+
+000000000080286d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80286d:	55                   	push   %rbp
+  80286e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802871:	48 83 ec 08          	sub    $0x8,%rsp
+  802875:	6a 00                	push   $0x0
+  802877:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80287d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802888:	ba 00 00 00 00       	mov    $0x0,%edx
+  80288d:	be 00 00 00 00       	mov    $0x0,%esi
+  802892:	bf 11 00 00 00       	mov    $0x11,%edi
+  802897:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a7:	c9                   	leave
+  8028a8:	c3                   	ret
+
+00000000008028a9 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8028a9:	55                   	push   %rbp
+  8028aa:	48 89 e5             	mov    %rsp,%rbp
+  8028ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8028b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c5:	6a 00                	push   $0x0
+  8028c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028d3:	48 89 d1             	mov    %rdx,%rcx
+  8028d6:	48 89 c2             	mov    %rax,%rdx
+  8028d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028de:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028e3:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8028ea:	00 00 00 
+  8028ed:	ff d0                	call   *%rax
+  8028ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+00000000008028f5 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8028fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802901:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802905:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802908:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80290b:	48 63 c8             	movslq %eax,%rcx
+  80290e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802912:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802916:	48 83 ec 08          	sub    $0x8,%rsp
+  80291a:	6a 00                	push   $0x0
+  80291c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802922:	49 89 c8             	mov    %rcx,%r8
+  802925:	48 89 d1             	mov    %rdx,%rcx
+  802928:	48 89 c2             	mov    %rax,%rdx
+  80292b:	be 00 00 00 00       	mov    $0x0,%esi
+  802930:	bf 13 00 00 00       	mov    $0x13,%edi
+  802935:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+  802941:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802945:	c9                   	leave
+  802946:	c3                   	ret
+
+0000000000802947 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802947:	55                   	push   %rbp
+  802948:	48 89 e5             	mov    %rsp,%rbp
+  80294b:	48 83 ec 20          	sub    $0x20,%rsp
+  80294f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802953:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802956:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80295a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80295e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802965:	48 83 ec 08          	sub    $0x8,%rsp
+  802969:	6a 00                	push   $0x0
+  80296b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802971:	49 89 c8             	mov    %rcx,%r8
+  802974:	48 89 d1             	mov    %rdx,%rcx
+  802977:	48 89 c2             	mov    %rax,%rdx
+  80297a:	be 00 00 00 00       	mov    $0x0,%esi
+  80297f:	bf 14 00 00 00       	mov    $0x14,%edi
+  802984:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  80298b:	00 00 00 
+  80298e:	ff d0                	call   *%rax
+  802990:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+
+0000000000802996 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802996:	55                   	push   %rbp
+  802997:	48 89 e5             	mov    %rsp,%rbp
+  80299a:	48 83 ec 10          	sub    $0x10,%rsp
+  80299e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029a2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8029a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029a8:	48 63 d0             	movslq %eax,%rdx
+  8029ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029af:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b3:	6a 00                	push   $0x0
+  8029b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c1:	48 89 d1             	mov    %rdx,%rcx
+  8029c4:	48 89 c2             	mov    %rax,%rdx
+  8029c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cc:	bf 15 00 00 00       	mov    $0x15,%edi
+  8029d1:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+00000000008029e3 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8029eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029ef:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8029f2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8029f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8029f9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8029fd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802a00:	48 63 c8             	movslq %eax,%rcx
+  802a03:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a06:	48 63 d0             	movslq %eax,%rdx
+  802a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a0d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a11:	6a 00                	push   $0x0
+  802a13:	49 89 f1             	mov    %rsi,%r9
+  802a16:	49 89 c8             	mov    %rcx,%r8
+  802a19:	48 89 d1             	mov    %rdx,%rcx
+  802a1c:	48 89 c2             	mov    %rax,%rdx
+  802a1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a24:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a29:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802a30:	00 00 00 
+  802a33:	ff d0                	call   *%rax
+  802a35:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+0000000000802a3b <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802a3b:	55                   	push   %rbp
+  802a3c:	48 89 e5             	mov    %rsp,%rbp
+  802a3f:	48 83 ec 30          	sub    $0x30,%rsp
+  802a43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a47:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a4b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a4f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802a53:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802a57:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802a5b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802a5f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a63:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6f:	51                   	push   %rcx
+  802a70:	49 89 f9             	mov    %rdi,%r9
+  802a73:	49 89 f0             	mov    %rsi,%r8
+  802a76:	48 89 d1             	mov    %rdx,%rcx
+  802a79:	48 89 c2             	mov    %rax,%rdx
+  802a7c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a81:	bf 17 00 00 00       	mov    $0x17,%edi
+  802a86:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802a8d:	00 00 00 
+  802a90:	ff d0                	call   *%rax
+  802a92:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a96:	c9                   	leave
+  802a97:	c3                   	ret
+
+0000000000802a98 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802a98:	55                   	push   %rbp
+  802a99:	48 89 e5             	mov    %rsp,%rbp
+  802a9c:	48 83 ec 10          	sub    $0x10,%rsp
+  802aa0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802aa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802aa6:	48 98                	cltq
+  802aa8:	48 83 ec 08          	sub    $0x8,%rsp
+  802aac:	6a 00                	push   $0x0
+  802aae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ab4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802abf:	48 89 c2             	mov    %rax,%rdx
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	bf 18 00 00 00       	mov    $0x18,%edi
+  802acc:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+  802ad8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802adc:	90                   	nop
+  802add:	c9                   	leave
+  802ade:	c3                   	ret
+
+0000000000802adf <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802adf:	55                   	push   %rbp
+  802ae0:	48 89 e5             	mov    %rsp,%rbp
+  802ae3:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802aea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802aee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802af2:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802af5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802af8:	48 63 f0             	movslq %eax,%rsi
+  802afb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802aff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b06:	48 98                	cltq
+  802b08:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0c:	6a 00                	push   $0x0
+  802b0e:	49 89 f1             	mov    %rsi,%r9
+  802b11:	49 89 c8             	mov    %rcx,%r8
+  802b14:	48 89 d1             	mov    %rdx,%rcx
+  802b17:	48 89 c2             	mov    %rax,%rdx
+  802b1a:	be 01 00 00 00       	mov    $0x1,%esi
+  802b1f:	bf 19 00 00 00       	mov    $0x19,%edi
+  802b24:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+  802b30:	48 83 c4 10          	add    $0x10,%rsp
+  802b34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+
+0000000000802b3c <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+  802b40:	48 83 ec 20          	sub    $0x20,%rsp
+  802b44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b4c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802b4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b52:	48 63 c8             	movslq %eax,%rcx
+  802b55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b61:	6a 00                	push   $0x0
+  802b63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b69:	49 89 c8             	mov    %rcx,%r8
+  802b6c:	48 89 d1             	mov    %rdx,%rcx
+  802b6f:	48 89 c2             	mov    %rax,%rdx
+  802b72:	be 01 00 00 00       	mov    $0x1,%esi
+  802b77:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802b7c:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  802b88:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b8c:	c9                   	leave
+  802b8d:	c3                   	ret
+
+0000000000802b8e <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	48 83 ec 20          	sub    $0x20,%rsp
+  802b96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802ba2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802ba6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802baa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bae:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb2:	6a 00                	push   $0x0
+  802bb4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bba:	49 89 c8             	mov    %rcx,%r8
+  802bbd:	48 89 d1             	mov    %rdx,%rcx
+  802bc0:	48 89 c2             	mov    %rax,%rdx
+  802bc3:	be 01 00 00 00       	mov    $0x1,%esi
+  802bc8:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802bcd:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bdd:	c9                   	leave
+  802bde:	c3                   	ret
+
+0000000000802bdf <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802bdf:	55                   	push   %rbp
+  802be0:	48 89 e5             	mov    %rsp,%rbp
+  802be3:	48 83 ec 30          	sub    $0x30,%rsp
+  802be7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802beb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802bef:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802bf2:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802bf6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bfd:	48 63 c8             	movslq %eax,%rcx
+  802c00:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c08:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0c:	6a 00                	push   $0x0
+  802c0e:	49 89 f1             	mov    %rsi,%r9
+  802c11:	49 89 c8             	mov    %rcx,%r8
+  802c14:	48 89 d1             	mov    %rdx,%rcx
+  802c17:	48 89 c2             	mov    %rax,%rdx
+  802c1a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c1f:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802c24:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	48 83 c4 10          	add    $0x10,%rsp
+  802c34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802c37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c3a:	c9                   	leave
+  802c3b:	c3                   	ret
+
+0000000000802c3c <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802c3c:	55                   	push   %rbp
+  802c3d:	48 89 e5             	mov    %rsp,%rbp
+  802c40:	48 83 ec 10          	sub    $0x10,%rsp
+  802c44:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802c47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c4a:	48 98                	cltq
+  802c4c:	48 83 ec 08          	sub    $0x8,%rsp
+  802c50:	6a 00                	push   $0x0
+  802c52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c63:	48 89 c2             	mov    %rax,%rdx
+  802c66:	be 01 00 00 00       	mov    $0x1,%esi
+  802c6b:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802c70:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+  802c7c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+
+0000000000802c82 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+  802c82:	55                   	push   %rbp
+  802c83:	48 89 e5             	mov    %rsp,%rbp
+  802c86:	48 83 ec 18          	sub    $0x18,%rsp
+  802c8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c8e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c92:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  args->argc     = argc;
+  802c96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c9a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c9e:	48 89 10             	mov    %rdx,(%rax)
+  args->argv     = (const char **)argv;
+  802ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ca9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  args->curarg   = (*argc > 1 && argv ? "" : 0);
+  802cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cb1:	8b 00                	mov    (%rax),%eax
+  802cb3:	83 f8 01             	cmp    $0x1,%eax
+  802cb6:	7e 13                	jle    802ccb <argstart+0x49>
+  802cb8:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802cbd:	74 0c                	je     802ccb <argstart+0x49>
+  802cbf:	48 ba d5 60 80 00 00 	movabs $0x8060d5,%rdx
+  802cc6:	00 00 00 
+  802cc9:	eb 05                	jmp    802cd0 <argstart+0x4e>
+  802ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cd4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  args->argvalue = 0;
+  802cd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cdc:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802ce3:	00 
+}
+  802ce4:	90                   	nop
+  802ce5:	c9                   	leave
+  802ce6:	c3                   	ret
+
+0000000000802ce7 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+  802ce7:	55                   	push   %rbp
+  802ce8:	48 89 e5             	mov    %rsp,%rbp
+  802ceb:	48 83 ec 20          	sub    $0x20,%rsp
+  802cef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int arg;
+
+  args->argvalue = 0;
+  802cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf7:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802cfe:	00 
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  802cff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d03:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802d07:	48 85 c0             	test   %rax,%rax
+  802d0a:	75 0a                	jne    802d16 <argnext+0x2f>
+    return -1;
+  802d0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802d11:	e9 27 01 00 00       	jmp    802e3d <argnext+0x156>
+
+  if (!*args->curarg) {
+  802d16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d1a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802d1e:	0f b6 00             	movzbl (%rax),%eax
+  802d21:	84 c0                	test   %al,%al
+  802d23:	0f 85 d5 00 00 00    	jne    802dfe <argnext+0x117>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1 || args->argv[1][0] != '-' || args->argv[1][1] == '\0')
+  802d29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d2d:	48 8b 00             	mov    (%rax),%rax
+  802d30:	8b 00                	mov    (%rax),%eax
+  802d32:	83 f8 01             	cmp    $0x1,%eax
+  802d35:	0f 84 ed 00 00 00    	je     802e28 <argnext+0x141>
+  802d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d3f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d43:	48 83 c0 08          	add    $0x8,%rax
+  802d47:	48 8b 00             	mov    (%rax),%rax
+  802d4a:	0f b6 00             	movzbl (%rax),%eax
+  802d4d:	3c 2d                	cmp    $0x2d,%al
+  802d4f:	0f 85 d3 00 00 00    	jne    802e28 <argnext+0x141>
+  802d55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d5d:	48 83 c0 08          	add    $0x8,%rax
+  802d61:	48 8b 00             	mov    (%rax),%rax
+  802d64:	48 83 c0 01          	add    $0x1,%rax
+  802d68:	0f b6 00             	movzbl (%rax),%eax
+  802d6b:	84 c0                	test   %al,%al
+  802d6d:	0f 84 b5 00 00 00    	je     802e28 <argnext+0x141>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  802d73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d77:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d7b:	48 83 c0 08          	add    $0x8,%rax
+  802d7f:	48 8b 00             	mov    (%rax),%rax
+  802d82:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802d86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d8a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802d8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d92:	48 8b 00             	mov    (%rax),%rax
+  802d95:	8b 00                	mov    (%rax),%eax
+  802d97:	83 e8 01             	sub    $0x1,%eax
+  802d9a:	48 98                	cltq
+  802d9c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802da3:	00 
+  802da4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802da8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802dac:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  802db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802db4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802db8:	48 83 c0 08          	add    $0x8,%rax
+  802dbc:	48 89 ce             	mov    %rcx,%rsi
+  802dbf:	48 89 c7             	mov    %rax,%rdi
+  802dc2:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  802dc9:	00 00 00 
+  802dcc:	ff d0                	call   *%rax
+    (*args->argc)--;
+  802dce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dd2:	48 8b 00             	mov    (%rax),%rax
+  802dd5:	8b 10                	mov    (%rax),%edx
+  802dd7:	83 ea 01             	sub    $0x1,%edx
+  802dda:	89 10                	mov    %edx,(%rax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802ddc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802de0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802de4:	0f b6 00             	movzbl (%rax),%eax
+  802de7:	3c 2d                	cmp    $0x2d,%al
+  802de9:	75 13                	jne    802dfe <argnext+0x117>
+  802deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802def:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802df3:	48 83 c0 01          	add    $0x1,%rax
+  802df7:	0f b6 00             	movzbl (%rax),%eax
+  802dfa:	84 c0                	test   %al,%al
+  802dfc:	74 2d                	je     802e2b <argnext+0x144>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  802dfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e02:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e06:	0f b6 00             	movzbl (%rax),%eax
+  802e09:	0f b6 c0             	movzbl %al,%eax
+  802e0c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  args->curarg++;
+  802e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e13:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e17:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802e1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e1f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return arg;
+  802e23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e26:	eb 15                	jmp    802e3d <argnext+0x156>
+      goto endofargs;
+  802e28:	90                   	nop
+  802e29:	eb 01                	jmp    802e2c <argnext+0x145>
+      goto endofargs;
+  802e2b:	90                   	nop
+
+endofargs:
+  args->curarg = 0;
+  802e2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e30:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802e37:	00 
+  return -1;
+  802e38:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  802e3d:	c9                   	leave
+  802e3e:	c3                   	ret
+
+0000000000802e3f <argvalue>:
+
+char *
+argvalue(struct Argstate *args) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+  802e43:	48 83 ec 10          	sub    $0x10,%rsp
+  802e47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802e4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e4f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802e53:	48 85 c0             	test   %rax,%rax
+  802e56:	74 0a                	je     802e62 <argvalue+0x23>
+  802e58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e5c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802e60:	eb 13                	jmp    802e75 <argvalue+0x36>
+  802e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e66:	48 89 c7             	mov    %rax,%rdi
+  802e69:	48 b8 77 2e 80 00 00 	movabs $0x802e77,%rax
+  802e70:	00 00 00 
+  802e73:	ff d0                	call   *%rax
+}
+  802e75:	c9                   	leave
+  802e76:	c3                   	ret
+
+0000000000802e77 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args) {
+  802e77:	55                   	push   %rbp
+  802e78:	48 89 e5             	mov    %rsp,%rbp
+  802e7b:	48 83 ec 10          	sub    $0x10,%rsp
+  802e7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (!args->curarg)
+  802e83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e87:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e8b:	48 85 c0             	test   %rax,%rax
+  802e8e:	75 0a                	jne    802e9a <argnextvalue+0x23>
+    return 0;
+  802e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e95:	e9 c8 00 00 00       	jmp    802f62 <argnextvalue+0xeb>
+  if (*args->curarg) {
+  802e9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e9e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ea2:	0f b6 00             	movzbl (%rax),%eax
+  802ea5:	84 c0                	test   %al,%al
+  802ea7:	74 27                	je     802ed0 <argnextvalue+0x59>
+    args->argvalue = args->curarg;
+  802ea9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ead:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802eb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb5:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    args->curarg   = "";
+  802eb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ebd:	48 be d5 60 80 00 00 	movabs $0x8060d5,%rsi
+  802ec4:	00 00 00 
+  802ec7:	48 89 70 10          	mov    %rsi,0x10(%rax)
+  802ecb:	e9 8a 00 00 00       	jmp    802f5a <argnextvalue+0xe3>
+  } else if (*args->argc > 1) {
+  802ed0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ed4:	48 8b 00             	mov    (%rax),%rax
+  802ed7:	8b 00                	mov    (%rax),%eax
+  802ed9:	83 f8 01             	cmp    $0x1,%eax
+  802edc:	7e 64                	jle    802f42 <argnextvalue+0xcb>
+    args->argvalue = args->argv[1];
+  802ede:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ee2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ee6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eee:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802ef2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ef6:	48 8b 00             	mov    (%rax),%rax
+  802ef9:	8b 00                	mov    (%rax),%eax
+  802efb:	83 e8 01             	sub    $0x1,%eax
+  802efe:	48 98                	cltq
+  802f00:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f07:	00 
+  802f08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f0c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f10:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  802f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f18:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f1c:	48 83 c0 08          	add    $0x8,%rax
+  802f20:	48 89 ce             	mov    %rcx,%rsi
+  802f23:	48 89 c7             	mov    %rax,%rdi
+  802f26:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+    (*args->argc)--;
+  802f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f36:	48 8b 00             	mov    (%rax),%rax
+  802f39:	8b 10                	mov    (%rax),%edx
+  802f3b:	83 ea 01             	sub    $0x1,%edx
+  802f3e:	89 10                	mov    %edx,(%rax)
+  802f40:	eb 18                	jmp    802f5a <argnextvalue+0xe3>
+  } else {
+    args->argvalue = 0;
+  802f42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f46:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802f4d:	00 
+    args->curarg   = 0;
+  802f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f52:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802f59:	00 
+  }
+  return (char *)args->argvalue;
+  802f5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  802f62:	c9                   	leave
+  802f63:	c3                   	ret
+
+0000000000802f64 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802f64:	55                   	push   %rbp
+  802f65:	48 89 e5             	mov    %rsp,%rbp
+  802f68:	48 83 ec 08          	sub    $0x8,%rsp
+  802f6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f74:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802f7b:	ff ff ff 
+  802f7e:	48 01 d0             	add    %rdx,%rax
+  802f81:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f85:	c9                   	leave
+  802f86:	c3                   	ret
+
+0000000000802f87 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802f87:	55                   	push   %rbp
+  802f88:	48 89 e5             	mov    %rsp,%rbp
+  802f8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802f93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f97:	48 89 c7             	mov    %rax,%rdi
+  802f9a:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+  802fa6:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802fac:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802fb0:	c9                   	leave
+  802fb1:	c3                   	ret
+
+0000000000802fb2 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802fb2:	55                   	push   %rbp
+  802fb3:	48 89 e5             	mov    %rsp,%rbp
+  802fb6:	48 83 ec 18          	sub    $0x18,%rsp
+  802fba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802fbe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fc5:	e9 ae 00 00 00       	jmp    803078 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802fca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fcd:	c1 e0 0c             	shl    $0xc,%eax
+  802fd0:	48 98                	cltq
+  802fd2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802fd7:	48 01 d0             	add    %rdx,%rax
+  802fda:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802fde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fe2:	48 c1 e8 27          	shr    $0x27,%rax
+  802fe6:	48 89 c2             	mov    %rax,%rdx
+  802fe9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ff0:	01 00 00 
+  802ff3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ff7:	83 e0 01             	and    $0x1,%eax
+  802ffa:	48 85 c0             	test   %rax,%rax
+  802ffd:	74 63                	je     803062 <fd_alloc+0xb0>
+  802fff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803003:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803007:	48 89 c2             	mov    %rax,%rdx
+  80300a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803011:	01 00 00 
+  803014:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803018:	83 e0 01             	and    $0x1,%eax
+  80301b:	48 85 c0             	test   %rax,%rax
+  80301e:	74 42                	je     803062 <fd_alloc+0xb0>
+  803020:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803024:	48 c1 e8 15          	shr    $0x15,%rax
+  803028:	48 89 c2             	mov    %rax,%rdx
+  80302b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803032:	01 00 00 
+  803035:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803039:	83 e0 01             	and    $0x1,%eax
+  80303c:	48 85 c0             	test   %rax,%rax
+  80303f:	74 21                	je     803062 <fd_alloc+0xb0>
+  803041:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803045:	48 c1 e8 0c          	shr    $0xc,%rax
+  803049:	48 89 c2             	mov    %rax,%rdx
+  80304c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803053:	01 00 00 
+  803056:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80305a:	83 e0 01             	and    $0x1,%eax
+  80305d:	48 85 c0             	test   %rax,%rax
+  803060:	75 12                	jne    803074 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803062:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803066:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80306a:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80306d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803072:	eb 1e                	jmp    803092 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803074:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803078:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80307c:	0f 8e 48 ff ff ff    	jle    802fca <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803082:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803086:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80308d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803092:	c9                   	leave
+  803093:	c3                   	ret
+
+0000000000803094 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803094:	55                   	push   %rbp
+  803095:	48 89 e5             	mov    %rsp,%rbp
+  803098:	48 83 ec 20          	sub    $0x20,%rsp
+  80309c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80309f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8030a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030a7:	78 06                	js     8030af <fd_lookup+0x1b>
+  8030a9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8030ad:	7e 0a                	jle    8030b9 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8030af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030b4:	e9 af 00 00 00       	jmp    803168 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8030b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030bc:	c1 e0 0c             	shl    $0xc,%eax
+  8030bf:	48 98                	cltq
+  8030c1:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8030c6:	48 01 d0             	add    %rdx,%rax
+  8030c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8030cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030d1:	48 c1 e8 27          	shr    $0x27,%rax
+  8030d5:	48 89 c2             	mov    %rax,%rdx
+  8030d8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8030df:	01 00 00 
+  8030e2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e6:	83 e0 01             	and    $0x1,%eax
+  8030e9:	48 85 c0             	test   %rax,%rax
+  8030ec:	74 63                	je     803151 <fd_lookup+0xbd>
+  8030ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030f2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030f6:	48 89 c2             	mov    %rax,%rdx
+  8030f9:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803100:	01 00 00 
+  803103:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803107:	83 e0 01             	and    $0x1,%eax
+  80310a:	48 85 c0             	test   %rax,%rax
+  80310d:	74 42                	je     803151 <fd_lookup+0xbd>
+  80310f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803113:	48 c1 e8 15          	shr    $0x15,%rax
+  803117:	48 89 c2             	mov    %rax,%rdx
+  80311a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803121:	01 00 00 
+  803124:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803128:	83 e0 01             	and    $0x1,%eax
+  80312b:	48 85 c0             	test   %rax,%rax
+  80312e:	74 21                	je     803151 <fd_lookup+0xbd>
+  803130:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803134:	48 c1 e8 0c          	shr    $0xc,%rax
+  803138:	48 89 c2             	mov    %rax,%rdx
+  80313b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803142:	01 00 00 
+  803145:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803149:	83 e0 01             	and    $0x1,%eax
+  80314c:	48 85 c0             	test   %rax,%rax
+  80314f:	75 07                	jne    803158 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803151:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803156:	eb 10                	jmp    803168 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803158:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80315c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803160:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803168:	c9                   	leave
+  803169:	c3                   	ret
+
+000000000080316a <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80316a:	55                   	push   %rbp
+  80316b:	48 89 e5             	mov    %rsp,%rbp
+  80316e:	48 83 ec 30          	sub    $0x30,%rsp
+  803172:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803176:	89 f0                	mov    %esi,%eax
+  803178:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80317b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80317f:	48 89 c7             	mov    %rax,%rdi
+  803182:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  803189:	00 00 00 
+  80318c:	ff d0                	call   *%rax
+  80318e:	89 c2                	mov    %eax,%edx
+  803190:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803194:	48 89 c6             	mov    %rax,%rsi
+  803197:	89 d7                	mov    %edx,%edi
+  803199:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+  8031a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ac:	78 0a                	js     8031b8 <fd_close+0x4e>
+  8031ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b2:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8031b6:	74 12                	je     8031ca <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8031b8:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8031bc:	74 05                	je     8031c3 <fd_close+0x59>
+  8031be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031c1:	eb 70                	jmp    803233 <fd_close+0xc9>
+  8031c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c8:	eb 69                	jmp    803233 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8031ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ce:	8b 00                	mov    (%rax),%eax
+  8031d0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031d4:	48 89 d6             	mov    %rdx,%rsi
+  8031d7:	89 c7                	mov    %eax,%edi
+  8031d9:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+  8031e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ec:	78 2a                	js     803218 <fd_close+0xae>
+    if (dev->dev_close)
+  8031ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031f2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031f6:	48 85 c0             	test   %rax,%rax
+  8031f9:	74 16                	je     803211 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8031fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ff:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803203:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803207:	48 89 c7             	mov    %rax,%rdi
+  80320a:	ff d2                	call   *%rdx
+  80320c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80320f:	eb 07                	jmp    803218 <fd_close+0xae>
+    else
+      r = 0;
+  803211:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803218:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80321c:	48 89 c6             	mov    %rax,%rsi
+  80321f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803224:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  80322b:	00 00 00 
+  80322e:	ff d0                	call   *%rax
+  return r;
+  803230:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803233:	c9                   	leave
+  803234:	c3                   	ret
+
+0000000000803235 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803235:	55                   	push   %rbp
+  803236:	48 89 e5             	mov    %rsp,%rbp
+  803239:	48 83 ec 20          	sub    $0x20,%rsp
+  80323d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803240:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803244:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80324b:	eb 3f                	jmp    80328c <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80324d:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803254:	00 00 00 
+  803257:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80325a:	48 98                	cltq
+  80325c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803260:	8b 00                	mov    (%rax),%eax
+  803262:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803265:	75 21                	jne    803288 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803267:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80326e:	00 00 00 
+  803271:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803274:	48 98                	cltq
+  803276:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80327a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80327e:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803281:	b8 00 00 00 00       	mov    $0x0,%eax
+  803286:	eb 7f                	jmp    803307 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803288:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80328c:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803293:	00 00 00 
+  803296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803299:	48 98                	cltq
+  80329b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80329f:	48 85 c0             	test   %rax,%rax
+  8032a2:	75 a9                	jne    80324d <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8032a4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8032ab:	00 00 00 
+  8032ae:	8b 40 04             	mov    0x4(%rax),%eax
+  8032b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032b6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032bd:	00 00 00 
+  8032c0:	48 98                	cltq
+  8032c2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032c9:	48 01 d0             	add    %rdx,%rax
+  8032cc:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032d2:	8b 00                	mov    (%rax),%eax
+  8032d4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032d7:	89 c6                	mov    %eax,%esi
+  8032d9:	48 b8 d8 60 80 00 00 	movabs $0x8060d8,%rax
+  8032e0:	00 00 00 
+  8032e3:	48 89 c7             	mov    %rax,%rdi
+  8032e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032eb:	48 b9 1d 08 80 00 00 	movabs $0x80081d,%rcx
+  8032f2:	00 00 00 
+  8032f5:	ff d1                	call   *%rcx
+  *dev = 0;
+  8032f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032fb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803302:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803307:	c9                   	leave
+  803308:	c3                   	ret
+
+0000000000803309 <close>:
+
+int
+close(int fdnum) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	48 83 ec 20          	sub    $0x20,%rsp
+  803311:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803314:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803318:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80331b:	48 89 d6             	mov    %rdx,%rsi
+  80331e:	89 c7                	mov    %eax,%edi
+  803320:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803327:	00 00 00 
+  80332a:	ff d0                	call   *%rax
+  80332c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80332f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803333:	79 05                	jns    80333a <close+0x31>
+    return r;
+  803335:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803338:	eb 18                	jmp    803352 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80333a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80333e:	be 01 00 00 00       	mov    $0x1,%esi
+  803343:	48 89 c7             	mov    %rax,%rdi
+  803346:	48 b8 6a 31 80 00 00 	movabs $0x80316a,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+}
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+
+0000000000803354 <close_all>:
+
+void
+close_all(void) {
+  803354:	55                   	push   %rbp
+  803355:	48 89 e5             	mov    %rsp,%rbp
+  803358:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80335c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803363:	eb 15                	jmp    80337a <close_all+0x26>
+    close(i);
+  803365:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803368:	89 c7                	mov    %eax,%edi
+  80336a:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803376:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80337a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80337e:	7e e5                	jle    803365 <close_all+0x11>
+}
+  803380:	90                   	nop
+  803381:	90                   	nop
+  803382:	c9                   	leave
+  803383:	c3                   	ret
+
+0000000000803384 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803384:	55                   	push   %rbp
+  803385:	48 89 e5             	mov    %rsp,%rbp
+  803388:	48 83 ec 40          	sub    $0x40,%rsp
+  80338c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80338f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803392:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803396:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803399:	48 89 d6             	mov    %rdx,%rsi
+  80339c:	89 c7                	mov    %eax,%edi
+  80339e:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+  8033aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033b1:	79 08                	jns    8033bb <dup+0x37>
+    return r;
+  8033b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033b6:	e9 33 02 00 00       	jmp    8035ee <dup+0x26a>
+  close(newfdnum);
+  8033bb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033be:	89 c7                	mov    %eax,%edi
+  8033c0:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  8033c7:	00 00 00 
+  8033ca:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8033cc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033cf:	c1 e0 0c             	shl    $0xc,%eax
+  8033d2:	48 98                	cltq
+  8033d4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033d9:	48 01 d0             	add    %rdx,%rax
+  8033dc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8033e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033e4:	48 89 c7             	mov    %rax,%rdi
+  8033e7:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  8033ee:	00 00 00 
+  8033f1:	ff d0                	call   *%rax
+  8033f3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8033f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033fb:	48 89 c7             	mov    %rax,%rdi
+  8033fe:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  803405:	00 00 00 
+  803408:	ff d0                	call   *%rax
+  80340a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  80340e:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803415:	00 
+  803416:	e9 19 01 00 00       	jmp    803534 <dup+0x1b0>
+    off -= PGSIZE;
+  80341b:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803422:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803423:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803427:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342b:	48 01 d0             	add    %rdx,%rax
+  80342e:	48 c1 e8 27          	shr    $0x27,%rax
+  803432:	48 89 c2             	mov    %rax,%rdx
+  803435:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80343c:	01 00 00 
+  80343f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803443:	83 e0 01             	and    $0x1,%eax
+  803446:	48 85 c0             	test   %rax,%rax
+  803449:	0f 84 e5 00 00 00    	je     803534 <dup+0x1b0>
+  80344f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803453:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803457:	48 01 d0             	add    %rdx,%rax
+  80345a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80345e:	48 89 c2             	mov    %rax,%rdx
+  803461:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803468:	01 00 00 
+  80346b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80346f:	83 e0 01             	and    $0x1,%eax
+  803472:	48 85 c0             	test   %rax,%rax
+  803475:	0f 84 b9 00 00 00    	je     803534 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80347b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80347f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803483:	48 01 d0             	add    %rdx,%rax
+  803486:	48 c1 e8 15          	shr    $0x15,%rax
+  80348a:	48 89 c2             	mov    %rax,%rdx
+  80348d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803494:	01 00 00 
+  803497:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80349b:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80349e:	48 85 c0             	test   %rax,%rax
+  8034a1:	0f 84 8d 00 00 00    	je     803534 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8034a7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034af:	48 01 d0             	add    %rdx,%rax
+  8034b2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034b6:	48 89 c2             	mov    %rax,%rdx
+  8034b9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034c0:	01 00 00 
+  8034c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c7:	83 e0 01             	and    $0x1,%eax
+  8034ca:	48 85 c0             	test   %rax,%rax
+  8034cd:	74 65                	je     803534 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8034cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034d7:	48 01 d0             	add    %rdx,%rax
+  8034da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034de:	48 89 c2             	mov    %rax,%rdx
+  8034e1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034e8:	01 00 00 
+  8034eb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034ef:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034f4:	89 c6                	mov    %eax,%esi
+  8034f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034fe:	48 01 c2             	add    %rax,%rdx
+  803501:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803505:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803509:	48 01 c8             	add    %rcx,%rax
+  80350c:	41 89 f0             	mov    %esi,%r8d
+  80350f:	48 89 d1             	mov    %rdx,%rcx
+  803512:	ba 00 00 00 00       	mov    $0x0,%edx
+  803517:	48 89 c6             	mov    %rax,%rsi
+  80351a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351f:	48 b8 f3 25 80 00 00 	movabs $0x8025f3,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+  80352b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80352e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803532:	78 60                	js     803594 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803534:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803539:	0f 85 dc fe ff ff    	jne    80341b <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80353f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803543:	48 c1 e8 0c          	shr    $0xc,%rax
+  803547:	48 89 c2             	mov    %rax,%rdx
+  80354a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803551:	01 00 00 
+  803554:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803558:	25 07 0e 00 00       	and    $0xe07,%eax
+  80355d:	89 c1                	mov    %eax,%ecx
+  80355f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803563:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803567:	41 89 c8             	mov    %ecx,%r8d
+  80356a:	48 89 d1             	mov    %rdx,%rcx
+  80356d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803572:	48 89 c6             	mov    %rax,%rsi
+  803575:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357a:	48 b8 f3 25 80 00 00 	movabs $0x8025f3,%rax
+  803581:	00 00 00 
+  803584:	ff d0                	call   *%rax
+  803586:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803589:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80358d:	78 08                	js     803597 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80358f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803592:	eb 5a                	jmp    8035ee <dup+0x26a>
+        goto err;
+  803594:	90                   	nop
+  803595:	eb 01                	jmp    803598 <dup+0x214>
+    goto err;
+  803597:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803598:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80359c:	48 89 c6             	mov    %rax,%rsi
+  80359f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035a4:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8035ab:	00 00 00 
+  8035ae:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8035b0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8035b7:	00 
+  8035b8:	eb 27                	jmp    8035e1 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8035ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8035be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035c2:	48 01 d0             	add    %rdx,%rax
+  8035c5:	48 89 c6             	mov    %rax,%rsi
+  8035c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035cd:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8035d4:	00 00 00 
+  8035d7:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8035d9:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8035e0:	00 
+  8035e1:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8035e8:	00 
+  8035e9:	76 cf                	jbe    8035ba <dup+0x236>
+  return r;
+  8035eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8035ee:	c9                   	leave
+  8035ef:	c3                   	ret
+
+00000000008035f0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8035f0:	55                   	push   %rbp
+  8035f1:	48 89 e5             	mov    %rsp,%rbp
+  8035f4:	48 83 ec 40          	sub    $0x40,%rsp
+  8035f8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8035fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8035ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803603:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803607:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80360a:	48 89 d6             	mov    %rdx,%rsi
+  80360d:	89 c7                	mov    %eax,%edi
+  80360f:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803616:	00 00 00 
+  803619:	ff d0                	call   *%rax
+  80361b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80361e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803622:	78 24                	js     803648 <read+0x58>
+  803624:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803628:	8b 00                	mov    (%rax),%eax
+  80362a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80362e:	48 89 d6             	mov    %rdx,%rsi
+  803631:	89 c7                	mov    %eax,%edi
+  803633:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  80363a:	00 00 00 
+  80363d:	ff d0                	call   *%rax
+  80363f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803642:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803646:	79 0a                	jns    803652 <read+0x62>
+    return r;
+  803648:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80364b:	48 98                	cltq
+  80364d:	e9 9e 00 00 00       	jmp    8036f0 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803656:	8b 40 08             	mov    0x8(%rax),%eax
+  803659:	83 e0 03             	and    $0x3,%eax
+  80365c:	83 f8 01             	cmp    $0x1,%eax
+  80365f:	75 5c                	jne    8036bd <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803661:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803668:	00 00 00 
+  80366b:	8b 40 04             	mov    0x4(%rax),%eax
+  80366e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803673:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80367a:	00 00 00 
+  80367d:	48 98                	cltq
+  80367f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803686:	48 01 d0             	add    %rdx,%rax
+  803689:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80368f:	8b 00                	mov    (%rax),%eax
+  803691:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803694:	89 c6                	mov    %eax,%esi
+  803696:	48 b8 f7 60 80 00 00 	movabs $0x8060f7,%rax
+  80369d:	00 00 00 
+  8036a0:	48 89 c7             	mov    %rax,%rdi
+  8036a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a8:	48 b9 1d 08 80 00 00 	movabs $0x80081d,%rcx
+  8036af:	00 00 00 
+  8036b2:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8036b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036bb:	eb 33                	jmp    8036f0 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8036bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036c1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036c5:	48 85 c0             	test   %rax,%rax
+  8036c8:	75 09                	jne    8036d3 <read+0xe3>
+    return -E_NOT_SUPP;
+  8036ca:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8036d1:	eb 1d                	jmp    8036f0 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8036d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036d7:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8036db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036df:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036e3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8036e7:	48 89 ce             	mov    %rcx,%rsi
+  8036ea:	48 89 c7             	mov    %rax,%rdi
+  8036ed:	41 ff d0             	call   *%r8
+}
+  8036f0:	c9                   	leave
+  8036f1:	c3                   	ret
+
+00000000008036f2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036f2:	55                   	push   %rbp
+  8036f3:	48 89 e5             	mov    %rsp,%rbp
+  8036f6:	48 83 ec 30          	sub    $0x30,%rsp
+  8036fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803701:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803705:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80370c:	eb 49                	jmp    803757 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80370e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803711:	48 98                	cltq
+  803713:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803717:	48 29 c2             	sub    %rax,%rdx
+  80371a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80371d:	48 63 c8             	movslq %eax,%rcx
+  803720:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803724:	48 01 c1             	add    %rax,%rcx
+  803727:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80372a:	48 89 ce             	mov    %rcx,%rsi
+  80372d:	89 c7                	mov    %eax,%edi
+  80372f:	48 b8 f0 35 80 00 00 	movabs $0x8035f0,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+  80373b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80373e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803742:	79 07                	jns    80374b <readn+0x59>
+      return m;
+  803744:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803747:	48 98                	cltq
+  803749:	eb 1f                	jmp    80376a <readn+0x78>
+    if (m == 0)
+  80374b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80374f:	74 13                	je     803764 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803751:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803754:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803757:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80375a:	48 98                	cltq
+  80375c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803760:	72 ac                	jb     80370e <readn+0x1c>
+  803762:	eb 01                	jmp    803765 <readn+0x73>
+      break;
+  803764:	90                   	nop
+  }
+  return tot;
+  803765:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803768:	48 98                	cltq
+}
+  80376a:	c9                   	leave
+  80376b:	c3                   	ret
+
+000000000080376c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80376c:	55                   	push   %rbp
+  80376d:	48 89 e5             	mov    %rsp,%rbp
+  803770:	48 83 ec 40          	sub    $0x40,%rsp
+  803774:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803777:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80377b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80377f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803783:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803786:	48 89 d6             	mov    %rdx,%rsi
+  803789:	89 c7                	mov    %eax,%edi
+  80378b:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+  803797:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80379a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80379e:	78 24                	js     8037c4 <write+0x58>
+  8037a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037a4:	8b 00                	mov    (%rax),%eax
+  8037a6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8037aa:	48 89 d6             	mov    %rdx,%rsi
+  8037ad:	89 c7                	mov    %eax,%edi
+  8037af:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8037b6:	00 00 00 
+  8037b9:	ff d0                	call   *%rax
+  8037bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037c2:	79 0a                	jns    8037ce <write+0x62>
+    return r;
+  8037c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037c7:	48 98                	cltq
+  8037c9:	e9 9d 00 00 00       	jmp    80386b <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037d2:	8b 40 08             	mov    0x8(%rax),%eax
+  8037d5:	83 e0 03             	and    $0x3,%eax
+  8037d8:	85 c0                	test   %eax,%eax
+  8037da:	75 5c                	jne    803838 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037dc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8037e3:	00 00 00 
+  8037e6:	8b 40 04             	mov    0x4(%rax),%eax
+  8037e9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037ee:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8037f5:	00 00 00 
+  8037f8:	48 98                	cltq
+  8037fa:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803801:	48 01 d0             	add    %rdx,%rax
+  803804:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80380a:	8b 00                	mov    (%rax),%eax
+  80380c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80380f:	89 c6                	mov    %eax,%esi
+  803811:	48 b8 13 61 80 00 00 	movabs $0x806113,%rax
+  803818:	00 00 00 
+  80381b:	48 89 c7             	mov    %rax,%rdi
+  80381e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803823:	48 b9 1d 08 80 00 00 	movabs $0x80081d,%rcx
+  80382a:	00 00 00 
+  80382d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80382f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803836:	eb 33                	jmp    80386b <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803838:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80383c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803840:	48 85 c0             	test   %rax,%rax
+  803843:	75 09                	jne    80384e <write+0xe2>
+    return -E_NOT_SUPP;
+  803845:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80384c:	eb 1d                	jmp    80386b <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80384e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803852:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80385a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80385e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803862:	48 89 ce             	mov    %rcx,%rsi
+  803865:	48 89 c7             	mov    %rax,%rdi
+  803868:	41 ff d0             	call   *%r8
+}
+  80386b:	c9                   	leave
+  80386c:	c3                   	ret
+
+000000000080386d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80386d:	55                   	push   %rbp
+  80386e:	48 89 e5             	mov    %rsp,%rbp
+  803871:	48 83 ec 18          	sub    $0x18,%rsp
+  803875:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803878:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80387b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80387f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803882:	48 89 d6             	mov    %rdx,%rsi
+  803885:	89 c7                	mov    %eax,%edi
+  803887:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  80388e:	00 00 00 
+  803891:	ff d0                	call   *%rax
+  803893:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803896:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80389a:	79 05                	jns    8038a1 <seek+0x34>
+    return r;
+  80389c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80389f:	eb 0f                	jmp    8038b0 <seek+0x43>
+  fd->fd_offset = offset;
+  8038a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038a5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8038a8:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8038ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038b0:	c9                   	leave
+  8038b1:	c3                   	ret
+
+00000000008038b2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038b2:	55                   	push   %rbp
+  8038b3:	48 89 e5             	mov    %rsp,%rbp
+  8038b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8038ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038bd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038c0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8038c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038c7:	48 89 d6             	mov    %rdx,%rsi
+  8038ca:	89 c7                	mov    %eax,%edi
+  8038cc:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8038d3:	00 00 00 
+  8038d6:	ff d0                	call   *%rax
+  8038d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038df:	78 24                	js     803905 <ftruncate+0x53>
+  8038e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e5:	8b 00                	mov    (%rax),%eax
+  8038e7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038eb:	48 89 d6             	mov    %rdx,%rsi
+  8038ee:	89 c7                	mov    %eax,%edi
+  8038f0:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8038f7:	00 00 00 
+  8038fa:	ff d0                	call   *%rax
+  8038fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803903:	79 08                	jns    80390d <ftruncate+0x5b>
+    return r;
+  803905:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803908:	e9 92 00 00 00       	jmp    80399f <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80390d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803911:	8b 40 08             	mov    0x8(%rax),%eax
+  803914:	83 e0 03             	and    $0x3,%eax
+  803917:	85 c0                	test   %eax,%eax
+  803919:	75 5a                	jne    803975 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80391b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803922:	00 00 00 
+  803925:	8b 40 04             	mov    0x4(%rax),%eax
+  803928:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80392d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803934:	00 00 00 
+  803937:	48 98                	cltq
+  803939:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803940:	48 01 d0             	add    %rdx,%rax
+  803943:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803949:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80394b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80394e:	89 c6                	mov    %eax,%esi
+  803950:	48 b8 30 61 80 00 00 	movabs $0x806130,%rax
+  803957:	00 00 00 
+  80395a:	48 89 c7             	mov    %rax,%rdi
+  80395d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803962:	48 b9 1d 08 80 00 00 	movabs $0x80081d,%rcx
+  803969:	00 00 00 
+  80396c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80396e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803973:	eb 2a                	jmp    80399f <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803979:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80397d:	48 85 c0             	test   %rax,%rax
+  803980:	75 07                	jne    803989 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803982:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803987:	eb 16                	jmp    80399f <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803989:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80398d:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803991:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803995:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803998:	89 d6                	mov    %edx,%esi
+  80399a:	48 89 c7             	mov    %rax,%rdi
+  80399d:	ff d1                	call   *%rcx
+}
+  80399f:	c9                   	leave
+  8039a0:	c3                   	ret
+
+00000000008039a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	48 83 ec 30          	sub    $0x30,%rsp
+  8039a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039b0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039b7:	48 89 d6             	mov    %rdx,%rsi
+  8039ba:	89 c7                	mov    %eax,%edi
+  8039bc:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8039c3:	00 00 00 
+  8039c6:	ff d0                	call   *%rax
+  8039c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039cf:	78 24                	js     8039f5 <fstat+0x54>
+  8039d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d5:	8b 00                	mov    (%rax),%eax
+  8039d7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039db:	48 89 d6             	mov    %rdx,%rsi
+  8039de:	89 c7                	mov    %eax,%edi
+  8039e0:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  8039e7:	00 00 00 
+  8039ea:	ff d0                	call   *%rax
+  8039ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039f3:	79 05                	jns    8039fa <fstat+0x59>
+    return r;
+  8039f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039f8:	eb 5e                	jmp    803a58 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8039fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039fe:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803a02:	48 85 c0             	test   %rax,%rax
+  803a05:	75 07                	jne    803a0e <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803a07:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803a0c:	eb 4a                	jmp    803a58 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803a0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a12:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803a15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a19:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803a20:	00 00 00 
+  stat->st_isdir   = 0;
+  803a23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a27:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803a2e:	00 00 00 
+  stat->st_dev     = dev;
+  803a31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a39:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a44:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803a48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a4c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a50:	48 89 d6             	mov    %rdx,%rsi
+  803a53:	48 89 c7             	mov    %rax,%rdi
+  803a56:	ff d1                	call   *%rcx
+}
+  803a58:	c9                   	leave
+  803a59:	c3                   	ret
+
+0000000000803a5a <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803a5a:	55                   	push   %rbp
+  803a5b:	48 89 e5             	mov    %rsp,%rbp
+  803a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  803a62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a66:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a6e:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a74:	83 f8 20             	cmp    $0x20,%eax
+  803a77:	75 07                	jne    803a80 <pollwait_key+0x26>
+    return -E_INVAL;
+  803a79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a7e:	eb 5f                	jmp    803adf <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803a80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a84:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a8e:	48 63 d2             	movslq %edx,%rdx
+  803a91:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a95:	48 01 c2             	add    %rax,%rdx
+  803a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9c:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803a9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa3:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aad:	8b 00                	mov    (%rax),%eax
+  803aaf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ab3:	48 63 c9             	movslq %ecx,%rcx
+  803ab6:	48 c1 e1 04          	shl    $0x4,%rcx
+  803aba:	48 01 ca             	add    %rcx,%rdx
+  803abd:	48 83 c2 08          	add    $0x8,%rdx
+  803ac1:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803ac3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ac7:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803acd:	8d 50 01             	lea    0x1(%rax),%edx
+  803ad0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ad4:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803ada:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803adf:	c9                   	leave
+  803ae0:	c3                   	ret
+
+0000000000803ae1 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803ae1:	55                   	push   %rbp
+  803ae2:	48 89 e5             	mov    %rsp,%rbp
+  803ae5:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803aec:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803af3:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803af9:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803b00:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b07:	00 
+  int i, r, ready, ipc = 0;
+  803b08:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803b0f:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803b16:	00 
+  803b17:	74 45                	je     803b5e <poll+0x7d>
+  803b19:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803b20:	ff 
+  803b21:	74 3b                	je     803b5e <poll+0x7d>
+    now      = vsys_clock_ns();
+  803b23:	48 b8 35 53 80 00 00 	movabs $0x805335,%rax
+  803b2a:	00 00 00 
+  803b2d:	ff d0                	call   *%rax
+  803b2f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803b33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b37:	48 f7 d0             	not    %rax
+  803b3a:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803b41:	73 10                	jae    803b53 <poll+0x72>
+  803b43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b47:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803b4e:	48 01 d0             	add    %rdx,%rax
+  803b51:	eb 07                	jmp    803b5a <poll+0x79>
+  803b53:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803b5a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803b5e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803b65:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803b6c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803b73:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803b7a:	e9 46 02 00 00       	jmp    803dc5 <poll+0x2e4>
+      fds[i].revents = 0;
+  803b7f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b82:	48 63 d0             	movslq %eax,%rdx
+  803b85:	48 89 d0             	mov    %rdx,%rax
+  803b88:	48 01 c0             	add    %rax,%rax
+  803b8b:	48 01 d0             	add    %rdx,%rax
+  803b8e:	48 c1 e0 02          	shl    $0x2,%rax
+  803b92:	48 89 c2             	mov    %rax,%rdx
+  803b95:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b9c:	48 01 d0             	add    %rdx,%rax
+  803b9f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803ba6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba9:	48 63 d0             	movslq %eax,%rdx
+  803bac:	48 89 d0             	mov    %rdx,%rax
+  803baf:	48 01 c0             	add    %rax,%rax
+  803bb2:	48 01 d0             	add    %rdx,%rax
+  803bb5:	48 c1 e0 02          	shl    $0x2,%rax
+  803bb9:	48 89 c2             	mov    %rax,%rdx
+  803bbc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bc3:	48 01 d0             	add    %rdx,%rax
+  803bc6:	8b 00                	mov    (%rax),%eax
+  803bc8:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803bcb:	75 62                	jne    803c2f <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803bcd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bd0:	48 63 d0             	movslq %eax,%rdx
+  803bd3:	48 89 d0             	mov    %rdx,%rax
+  803bd6:	48 01 c0             	add    %rax,%rax
+  803bd9:	48 01 d0             	add    %rdx,%rax
+  803bdc:	48 c1 e0 02          	shl    $0x2,%rax
+  803be0:	48 89 c2             	mov    %rax,%rdx
+  803be3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bea:	48 01 d0             	add    %rdx,%rax
+  803bed:	8b 40 04             	mov    0x4(%rax),%eax
+  803bf0:	83 e0 01             	and    $0x1,%eax
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	0f 84 9b 01 00 00    	je     803d96 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803bfb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bfe:	48 63 d0             	movslq %eax,%rdx
+  803c01:	48 89 d0             	mov    %rdx,%rax
+  803c04:	48 01 c0             	add    %rax,%rax
+  803c07:	48 01 d0             	add    %rdx,%rax
+  803c0a:	48 c1 e0 02          	shl    $0x2,%rax
+  803c0e:	48 89 c2             	mov    %rax,%rdx
+  803c11:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c18:	48 01 c2             	add    %rax,%rdx
+  803c1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c1e:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803c21:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803c24:	83 c8 04             	or     $0x4,%eax
+  803c27:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803c2a:	e9 67 01 00 00       	jmp    803d96 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c32:	48 63 d0             	movslq %eax,%rdx
+  803c35:	48 89 d0             	mov    %rdx,%rax
+  803c38:	48 01 c0             	add    %rax,%rax
+  803c3b:	48 01 d0             	add    %rdx,%rax
+  803c3e:	48 c1 e0 02          	shl    $0x2,%rax
+  803c42:	48 89 c2             	mov    %rax,%rdx
+  803c45:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c4c:	48 01 d0             	add    %rdx,%rax
+  803c4f:	8b 00                	mov    (%rax),%eax
+  803c51:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803c58:	48 89 d6             	mov    %rdx,%rsi
+  803c5b:	89 c7                	mov    %eax,%edi
+  803c5d:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  803c64:	00 00 00 
+  803c67:	ff d0                	call   *%rax
+  803c69:	85 c0                	test   %eax,%eax
+  803c6b:	78 25                	js     803c92 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803c6d:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c74:	8b 00                	mov    (%rax),%eax
+  803c76:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803c7d:	48 89 d6             	mov    %rdx,%rsi
+  803c80:	89 c7                	mov    %eax,%edi
+  803c82:	48 b8 35 32 80 00 00 	movabs $0x803235,%rax
+  803c89:	00 00 00 
+  803c8c:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c8e:	85 c0                	test   %eax,%eax
+  803c90:	79 2c                	jns    803cbe <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803c92:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c95:	48 63 d0             	movslq %eax,%rdx
+  803c98:	48 89 d0             	mov    %rdx,%rax
+  803c9b:	48 01 c0             	add    %rax,%rax
+  803c9e:	48 01 d0             	add    %rdx,%rax
+  803ca1:	48 c1 e0 02          	shl    $0x2,%rax
+  803ca5:	48 89 c2             	mov    %rax,%rdx
+  803ca8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803caf:	48 01 d0             	add    %rdx,%rax
+  803cb2:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803cb9:	e9 d8 00 00 00       	jmp    803d96 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803cbe:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803cc5:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803cc9:	48 85 c0             	test   %rax,%rax
+  803ccc:	74 7d                	je     803d4b <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803cce:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803cd5:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803cd9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cdc:	48 63 d0             	movslq %eax,%rdx
+  803cdf:	48 89 d0             	mov    %rdx,%rax
+  803ce2:	48 01 c0             	add    %rax,%rax
+  803ce5:	48 01 d0             	add    %rdx,%rax
+  803ce8:	48 c1 e0 02          	shl    $0x2,%rax
+  803cec:	48 89 c2             	mov    %rax,%rdx
+  803cef:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cf6:	48 01 d0             	add    %rdx,%rax
+  803cf9:	8b 48 04             	mov    0x4(%rax),%ecx
+  803cfc:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803d03:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803d0a:	89 ce                	mov    %ecx,%esi
+  803d0c:	48 89 c7             	mov    %rax,%rdi
+  803d0f:	41 ff d0             	call   *%r8
+  803d12:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803d15:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d19:	79 08                	jns    803d23 <poll+0x242>
+          return r;
+  803d1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d1e:	e9 45 01 00 00       	jmp    803e68 <poll+0x387>
+        fds[i].revents = r;
+  803d23:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d26:	48 63 d0             	movslq %eax,%rdx
+  803d29:	48 89 d0             	mov    %rdx,%rax
+  803d2c:	48 01 c0             	add    %rax,%rax
+  803d2f:	48 01 d0             	add    %rdx,%rax
+  803d32:	48 c1 e0 02          	shl    $0x2,%rax
+  803d36:	48 89 c2             	mov    %rax,%rdx
+  803d39:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d40:	48 01 c2             	add    %rax,%rdx
+  803d43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d46:	89 42 08             	mov    %eax,0x8(%rdx)
+  803d49:	eb 4b                	jmp    803d96 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803d4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d4e:	48 63 d0             	movslq %eax,%rdx
+  803d51:	48 89 d0             	mov    %rdx,%rax
+  803d54:	48 01 c0             	add    %rax,%rax
+  803d57:	48 01 d0             	add    %rdx,%rax
+  803d5a:	48 c1 e0 02          	shl    $0x2,%rax
+  803d5e:	48 89 c2             	mov    %rax,%rdx
+  803d61:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d68:	48 01 d0             	add    %rdx,%rax
+  803d6b:	8b 48 04             	mov    0x4(%rax),%ecx
+  803d6e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d71:	48 63 d0             	movslq %eax,%rdx
+  803d74:	48 89 d0             	mov    %rdx,%rax
+  803d77:	48 01 c0             	add    %rax,%rax
+  803d7a:	48 01 d0             	add    %rdx,%rax
+  803d7d:	48 c1 e0 02          	shl    $0x2,%rax
+  803d81:	48 89 c2             	mov    %rax,%rdx
+  803d84:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d8b:	48 01 d0             	add    %rdx,%rax
+  803d8e:	83 e1 03             	and    $0x3,%ecx
+  803d91:	89 ca                	mov    %ecx,%edx
+  803d93:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803d96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d99:	48 63 d0             	movslq %eax,%rdx
+  803d9c:	48 89 d0             	mov    %rdx,%rax
+  803d9f:	48 01 c0             	add    %rax,%rax
+  803da2:	48 01 d0             	add    %rdx,%rax
+  803da5:	48 c1 e0 02          	shl    $0x2,%rax
+  803da9:	48 89 c2             	mov    %rax,%rdx
+  803dac:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803db3:	48 01 d0             	add    %rdx,%rax
+  803db6:	8b 40 08             	mov    0x8(%rax),%eax
+  803db9:	85 c0                	test   %eax,%eax
+  803dbb:	74 04                	je     803dc1 <poll+0x2e0>
+        ready++;
+  803dbd:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803dc1:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803dc5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803dc8:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803dce:	0f 8c ab fd ff ff    	jl     803b7f <poll+0x9e>
+    }
+    if (ready)
+  803dd4:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803dd8:	74 08                	je     803de2 <poll+0x301>
+      return ready;
+  803dda:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803ddd:	e9 86 00 00 00       	jmp    803e68 <poll+0x387>
+
+    if (deadline) {
+  803de2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803de7:	74 30                	je     803e19 <poll+0x338>
+      now     = vsys_clock_ns();
+  803de9:	48 b8 35 53 80 00 00 	movabs $0x805335,%rax
+  803df0:	00 00 00 
+  803df3:	ff d0                	call   *%rax
+  803df5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dfd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803e01:	73 0a                	jae    803e0d <poll+0x32c>
+  803e03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e07:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803e0b:	eb 05                	jmp    803e12 <poll+0x331>
+  803e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e12:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803e19:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803e1c:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803e1f:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803e26:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803e2d:	48 89 c7             	mov    %rax,%rdi
+  803e30:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  803e37:	00 00 00 
+  803e3a:	ff d0                	call   *%rax
+  803e3c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803e3f:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803e43:	75 07                	jne    803e4c <poll+0x36b>
+      return 0;
+  803e45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4a:	eb 1c                	jmp    803e68 <poll+0x387>
+    if (r < 0)
+  803e4c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803e50:	79 05                	jns    803e57 <poll+0x376>
+      return r;
+  803e52:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e55:	eb 11                	jmp    803e68 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803e57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e5a:	c1 f8 02             	sar    $0x2,%eax
+  803e5d:	83 e0 01             	and    $0x1,%eax
+  803e60:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803e63:	e9 f6 fc ff ff       	jmp    803b5e <poll+0x7d>
+  }
+}
+  803e68:	c9                   	leave
+  803e69:	c3                   	ret
+
+0000000000803e6a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803e6a:	55                   	push   %rbp
+  803e6b:	48 89 e5             	mov    %rsp,%rbp
+  803e6e:	48 83 ec 20          	sub    $0x20,%rsp
+  803e72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e76:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e7e:	be 00 00 00 00       	mov    $0x0,%esi
+  803e83:	48 89 c7             	mov    %rax,%rdi
+  803e86:	48 b8 58 3f 80 00 00 	movabs $0x803f58,%rax
+  803e8d:	00 00 00 
+  803e90:	ff d0                	call   *%rax
+  803e92:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e99:	79 05                	jns    803ea0 <stat+0x36>
+    return fd;
+  803e9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e9e:	eb 2f                	jmp    803ecf <stat+0x65>
+  r = fstat(fd, stat);
+  803ea0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ea4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ea7:	48 89 d6             	mov    %rdx,%rsi
+  803eaa:	89 c7                	mov    %eax,%edi
+  803eac:	48 b8 a1 39 80 00 00 	movabs $0x8039a1,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803ebb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ebe:	89 c7                	mov    %eax,%edi
+  803ec0:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+  return r;
+  803ecc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803ecf:	c9                   	leave
+  803ed0:	c3                   	ret
+
+0000000000803ed1 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803ed1:	55                   	push   %rbp
+  803ed2:	48 89 e5             	mov    %rsp,%rbp
+  803ed5:	48 83 ec 10          	sub    $0x10,%rsp
+  803ed9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803edc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803ee0:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803ee7:	00 00 00 
+  803eea:	8b 00                	mov    (%rax),%eax
+  803eec:	85 c0                	test   %eax,%eax
+  803eee:	75 1d                	jne    803f0d <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ef0:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ef5:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+  803f01:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  803f08:	00 00 00 
+  803f0b:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803f0d:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803f14:	00 00 00 
+  803f17:	8b 00                	mov    (%rax),%eax
+  803f19:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803f1c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803f21:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803f28:	00 00 00 
+  803f2b:	89 c7                	mov    %eax,%edi
+  803f2d:	48 b8 a3 58 80 00 00 	movabs $0x8058a3,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803f39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f42:	48 89 c6             	mov    %rax,%rsi
+  803f45:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f4a:	48 b8 26 57 80 00 00 	movabs $0x805726,%rax
+  803f51:	00 00 00 
+  803f54:	ff d0                	call   *%rax
+}
+  803f56:	c9                   	leave
+  803f57:	c3                   	ret
+
+0000000000803f58 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803f58:	55                   	push   %rbp
+  803f59:	48 89 e5             	mov    %rsp,%rbp
+  803f5c:	48 83 ec 20          	sub    $0x20,%rsp
+  803f60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803f64:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803f67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f6b:	48 89 c7             	mov    %rax,%rdi
+  803f6e:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  803f75:	00 00 00 
+  803f78:	ff d0                	call   *%rax
+  803f7a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f7f:	7e 0a                	jle    803f8b <open+0x33>
+    return -E_BAD_PATH;
+  803f81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f86:	e9 a8 00 00 00       	jmp    804033 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803f8b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803f8f:	48 89 c7             	mov    %rax,%rdi
+  803f92:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+  803f9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fa1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fa5:	79 08                	jns    803faf <open+0x57>
+    return r;
+  803fa7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803faa:	e9 84 00 00 00       	jmp    804033 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803faf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb3:	48 89 c6             	mov    %rax,%rsi
+  803fb6:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803fbd:	00 00 00 
+  803fc0:	48 89 c7             	mov    %rax,%rdi
+  803fc3:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803fcf:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803fd6:	00 00 00 
+  803fd9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fdc:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803fe2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fe6:	48 89 c6             	mov    %rax,%rsi
+  803fe9:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fee:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ffd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804001:	79 1d                	jns    804020 <open+0xc8>
+    fd_close(fd, 0);
+  804003:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804007:	be 00 00 00 00       	mov    $0x0,%esi
+  80400c:	48 89 c7             	mov    %rax,%rdi
+  80400f:	48 b8 6a 31 80 00 00 	movabs $0x80316a,%rax
+  804016:	00 00 00 
+  804019:	ff d0                	call   *%rax
+    return r;
+  80401b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80401e:	eb 13                	jmp    804033 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804020:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804024:	48 89 c7             	mov    %rax,%rdi
+  804027:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  80402e:	00 00 00 
+  804031:	ff d0                	call   *%rax
+}
+  804033:	c9                   	leave
+  804034:	c3                   	ret
+
+0000000000804035 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804035:	55                   	push   %rbp
+  804036:	48 89 e5             	mov    %rsp,%rbp
+  804039:	48 83 ec 10          	sub    $0x10,%rsp
+  80403d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804041:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804045:	8b 40 0c             	mov    0xc(%rax),%eax
+  804048:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80404f:	00 00 00 
+  804052:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804054:	be 00 00 00 00       	mov    $0x0,%esi
+  804059:	bf 06 00 00 00       	mov    $0x6,%edi
+  80405e:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+}
+  80406a:	c9                   	leave
+  80406b:	c3                   	ret
+
+000000000080406c <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80406c:	55                   	push   %rbp
+  80406d:	48 89 e5             	mov    %rsp,%rbp
+  804070:	48 83 ec 30          	sub    $0x30,%rsp
+  804074:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804078:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80407c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804080:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804085:	74 07                	je     80408e <devfile_read+0x22>
+  804087:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80408c:	75 0a                	jne    804098 <devfile_read+0x2c>
+  return E_INVAL;
+  80408e:	b8 03 00 00 00       	mov    $0x3,%eax
+  804093:	e9 b4 00 00 00       	jmp    80414c <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804098:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80409f:	00 
+  while (n) {
+  8040a0:	e9 98 00 00 00       	jmp    80413d <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8040a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040a9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040ac:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8040b3:	00 00 00 
+  8040b6:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8040b8:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8040bf:	00 00 00 
+  8040c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040c6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8040ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8040cf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8040d4:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  8040db:	00 00 00 
+  8040de:	ff d0                	call   *%rax
+  8040e0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8040e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040e7:	7f 13                	jg     8040fc <devfile_read+0x90>
+      return res ? res : res0;
+  8040e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040ed:	74 07                	je     8040f6 <devfile_read+0x8a>
+  8040ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040f2:	48 98                	cltq
+  8040f4:	eb 56                	jmp    80414c <devfile_read+0xe0>
+  8040f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040fa:	eb 50                	jmp    80414c <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8040fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040ff:	48 63 d0             	movslq %eax,%rdx
+  804102:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804106:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80410d:	00 00 00 
+  804110:	48 89 ce             	mov    %rcx,%rsi
+  804113:	48 89 c7             	mov    %rax,%rdi
+  804116:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  80411d:	00 00 00 
+  804120:	ff d0                	call   *%rax
+
+    buf += res;
+  804122:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804125:	48 98                	cltq
+  804127:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80412b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80412e:	48 98                	cltq
+  804130:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804134:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804137:	48 98                	cltq
+  804139:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80413d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804142:	0f 85 5d ff ff ff    	jne    8040a5 <devfile_read+0x39>
+  }
+
+  return res0;
+  804148:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80414c:	c9                   	leave
+  80414d:	c3                   	ret
+
+000000000080414e <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80414e:	55                   	push   %rbp
+  80414f:	48 89 e5             	mov    %rsp,%rbp
+  804152:	48 83 ec 50          	sub    $0x50,%rsp
+  804156:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80415a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80415e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804162:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804167:	74 07                	je     804170 <devfile_write+0x22>
+  804169:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80416e:	75 0a                	jne    80417a <devfile_write+0x2c>
+  return E_INVAL;
+  804170:	b8 03 00 00 00       	mov    $0x3,%eax
+  804175:	e9 c9 00 00 00       	jmp    804243 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80417a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804181:	00 
+
+  while (n) {
+  804182:	e9 ad 00 00 00       	jmp    804234 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804187:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80418b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80418f:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804196:	00 
+  804197:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80419b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80419f:	48 39 c2             	cmp    %rax,%rdx
+  8041a2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8041aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041b2:	48 89 c6             	mov    %rax,%rsi
+  8041b5:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8041bc:	00 00 00 
+  8041bf:	48 89 c7             	mov    %rax,%rdi
+  8041c2:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  8041c9:	00 00 00 
+  8041cc:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8041ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041d2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041d5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8041dc:	00 00 00 
+  8041df:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8041e1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8041e8:	00 00 00 
+  8041eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ef:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8041f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8041f8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8041fd:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  804204:	00 00 00 
+  804207:	ff d0                	call   *%rax
+  804209:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80420c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804210:	79 07                	jns    804219 <devfile_write+0xcb>
+      return res;
+  804212:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804215:	48 98                	cltq
+  804217:	eb 2a                	jmp    804243 <devfile_write+0xf5>
+
+    buf += res;
+  804219:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80421c:	48 98                	cltq
+  80421e:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804222:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804225:	48 98                	cltq
+  804227:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80422b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80422e:	48 98                	cltq
+  804230:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804234:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804239:	0f 85 48 ff ff ff    	jne    804187 <devfile_write+0x39>
+  }
+
+  return res0;
+  80423f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804243:	c9                   	leave
+  804244:	c3                   	ret
+
+0000000000804245 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804245:	55                   	push   %rbp
+  804246:	48 89 e5             	mov    %rsp,%rbp
+  804249:	48 83 ec 20          	sub    $0x20,%rsp
+  80424d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804251:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804255:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804259:	8b 40 0c             	mov    0xc(%rax),%eax
+  80425c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804263:	00 00 00 
+  804266:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804268:	be 00 00 00 00       	mov    $0x0,%esi
+  80426d:	bf 05 00 00 00       	mov    $0x5,%edi
+  804272:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+  80427e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804281:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804285:	79 05                	jns    80428c <devfile_stat+0x47>
+    return r;
+  804287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80428a:	eb 59                	jmp    8042e5 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80428c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804290:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804297:	00 00 00 
+  80429a:	48 89 d6             	mov    %rdx,%rsi
+  80429d:	48 89 c7             	mov    %rax,%rdi
+  8042a0:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  8042a7:	00 00 00 
+  8042aa:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8042ac:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042b3:	00 00 00 
+  8042b6:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8042bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042c0:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8042c6:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042cd:	00 00 00 
+  8042d0:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8042d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042da:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8042e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042e5:	c9                   	leave
+  8042e6:	c3                   	ret
+
+00000000008042e7 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8042e7:	55                   	push   %rbp
+  8042e8:	48 89 e5             	mov    %rsp,%rbp
+  8042eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8042ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8042f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042fa:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042fd:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804304:	00 00 00 
+  804307:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804309:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804310:	00 00 00 
+  804313:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804316:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804319:	be 00 00 00 00       	mov    $0x0,%esi
+  80431e:	bf 02 00 00 00       	mov    $0x2,%edi
+  804323:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  80432a:	00 00 00 
+  80432d:	ff d0                	call   *%rax
+}
+  80432f:	c9                   	leave
+  804330:	c3                   	ret
+
+0000000000804331 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804331:	55                   	push   %rbp
+  804332:	48 89 e5             	mov    %rsp,%rbp
+  804335:	48 83 ec 18          	sub    $0x18,%rsp
+  804339:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80433d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804340:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804344:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804347:	83 e0 03             	and    $0x3,%eax
+}
+  80434a:	c9                   	leave
+  80434b:	c3                   	ret
+
+000000000080434c <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80434c:	55                   	push   %rbp
+  80434d:	48 89 e5             	mov    %rsp,%rbp
+  804350:	48 83 ec 10          	sub    $0x10,%rsp
+  804354:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435c:	48 89 c7             	mov    %rax,%rdi
+  80435f:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  804366:	00 00 00 
+  804369:	ff d0                	call   *%rax
+  80436b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804370:	7e 07                	jle    804379 <remove+0x2d>
+    return -E_BAD_PATH;
+  804372:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804377:	eb 36                	jmp    8043af <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804379:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80437d:	48 89 c6             	mov    %rax,%rsi
+  804380:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804387:	00 00 00 
+  80438a:	48 89 c7             	mov    %rax,%rdi
+  80438d:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  804394:	00 00 00 
+  804397:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804399:	be 00 00 00 00       	mov    $0x0,%esi
+  80439e:	bf 07 00 00 00       	mov    $0x7,%edi
+  8043a3:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  8043aa:	00 00 00 
+  8043ad:	ff d0                	call   *%rax
+}
+  8043af:	c9                   	leave
+  8043b0:	c3                   	ret
+
+00000000008043b1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8043b1:	55                   	push   %rbp
+  8043b2:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8043b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8043ba:	bf 08 00 00 00       	mov    $0x8,%edi
+  8043bf:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  8043c6:	00 00 00 
+  8043c9:	ff d0                	call   *%rax
+}
+  8043cb:	5d                   	pop    %rbp
+  8043cc:	c3                   	ret
+
+00000000008043cd <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8043cd:	55                   	push   %rbp
+  8043ce:	48 89 e5             	mov    %rsp,%rbp
+  8043d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8043d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8043d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8043de:	bf 09 00 00 00       	mov    $0x9,%edi
+  8043e3:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  8043ea:	00 00 00 
+  8043ed:	ff d0                	call   *%rax
+  8043ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043f6:	79 05                	jns    8043fd <fs_stats+0x30>
+    return r;
+  8043f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043fb:	eb 2a                	jmp    804427 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8043fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804401:	ba 68 00 00 00       	mov    $0x68,%edx
+  804406:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80440d:	00 00 00 
+  804410:	48 89 ce             	mov    %rcx,%rsi
+  804413:	48 89 c7             	mov    %rax,%rdi
+  804416:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  80441d:	00 00 00 
+  804420:	ff d0                	call   *%rax
+  return 0;
+  804422:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804427:	c9                   	leave
+  804428:	c3                   	ret
+
+0000000000804429 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804429:	55                   	push   %rbp
+  80442a:	48 89 e5             	mov    %rsp,%rbp
+  80442d:	48 83 ec 10          	sub    $0x10,%rsp
+  804431:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804434:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80443b:	00 00 00 
+  80443e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804441:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804443:	be 00 00 00 00       	mov    $0x0,%esi
+  804448:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80444d:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  804454:	00 00 00 
+  804457:	ff d0                	call   *%rax
+}
+  804459:	c9                   	leave
+  80445a:	c3                   	ret
+
+000000000080445b <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  80445b:	55                   	push   %rbp
+  80445c:	48 89 e5             	mov    %rsp,%rbp
+  80445f:	48 83 ec 10          	sub    $0x10,%rsp
+  804463:	89 f8                	mov    %edi,%eax
+  804465:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804468:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  80446c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804473:	00 00 00 
+  804476:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804478:	be 00 00 00 00       	mov    $0x0,%esi
+  80447d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804482:	48 b8 d1 3e 80 00 00 	movabs $0x803ed1,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+}
+  80448e:	c9                   	leave
+  80448f:	c3                   	ret
+
+0000000000804490 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  804490:	55                   	push   %rbp
+  804491:	48 89 e5             	mov    %rsp,%rbp
+  804494:	48 83 ec 20          	sub    $0x20,%rsp
+  804498:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  80449c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044a0:	8b 40 10             	mov    0x10(%rax),%eax
+  8044a3:	85 c0                	test   %eax,%eax
+  8044a5:	7e 73                	jle    80451a <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  8044a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ab:	8b 40 04             	mov    0x4(%rax),%eax
+  8044ae:	48 63 d0             	movslq %eax,%rdx
+  8044b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044b5:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  8044b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044bd:	8b 00                	mov    (%rax),%eax
+  8044bf:	48 89 ce             	mov    %rcx,%rsi
+  8044c2:	89 c7                	mov    %eax,%edi
+  8044c4:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  8044cb:	00 00 00 
+  8044ce:	ff d0                	call   *%rax
+  8044d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  8044d4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8044d9:	7e 17                	jle    8044f2 <writebuf+0x62>
+      b->result += result;
+  8044db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044df:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8044e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044e7:	48 01 c2             	add    %rax,%rdx
+  8044ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ee:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  8044f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044f6:	8b 40 04             	mov    0x4(%rax),%eax
+  8044f9:	48 98                	cltq
+  8044fb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8044ff:	74 19                	je     80451a <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  804501:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80450a:	48 85 c0             	test   %rax,%rax
+  80450d:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804511:	89 c2                	mov    %eax,%edx
+  804513:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804517:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  80451a:	90                   	nop
+  80451b:	c9                   	leave
+  80451c:	c3                   	ret
+
+000000000080451d <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  80451d:	55                   	push   %rbp
+  80451e:	48 89 e5             	mov    %rsp,%rbp
+  804521:	48 83 ec 20          	sub    $0x20,%rsp
+  804525:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804528:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  80452c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804530:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  804534:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804538:	8b 40 04             	mov    0x4(%rax),%eax
+  80453b:	8d 48 01             	lea    0x1(%rax),%ecx
+  80453e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804542:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804545:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804548:	89 d1                	mov    %edx,%ecx
+  80454a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80454e:	48 98                	cltq
+  804550:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  804554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804558:	8b 40 04             	mov    0x4(%rax),%eax
+  80455b:	3d 00 01 00 00       	cmp    $0x100,%eax
+  804560:	75 1e                	jne    804580 <putch+0x63>
+    writebuf(b);
+  804562:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804566:	48 89 c7             	mov    %rax,%rdi
+  804569:	48 b8 90 44 80 00 00 	movabs $0x804490,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+    b->idx = 0;
+  804575:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804579:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  804580:	90                   	nop
+  804581:	c9                   	leave
+  804582:	c3                   	ret
+
+0000000000804583 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804583:	55                   	push   %rbp
+  804584:	48 89 e5             	mov    %rsp,%rbp
+  804587:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80458e:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  804594:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  80459b:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  8045a2:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  8045a8:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  8045ae:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8045b5:	00 00 00 
+  b.result = 0;
+  8045b8:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  8045bf:	00 00 00 00 
+  b.error  = 1;
+  8045c3:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  8045ca:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  8045cd:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  8045d4:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  8045db:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8045e2:	48 89 c6             	mov    %rax,%rsi
+  8045e5:	48 b8 1d 45 80 00 00 	movabs $0x80451d,%rax
+  8045ec:	00 00 00 
+  8045ef:	48 89 c7             	mov    %rax,%rdi
+  8045f2:	48 b8 77 0b 80 00 00 	movabs $0x800b77,%rax
+  8045f9:	00 00 00 
+  8045fc:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  8045fe:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804604:	85 c0                	test   %eax,%eax
+  804606:	7e 16                	jle    80461e <vfprintf+0x9b>
+    writebuf(&b);
+  804608:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80460f:	48 89 c7             	mov    %rax,%rdi
+  804612:	48 b8 90 44 80 00 00 	movabs $0x804490,%rax
+  804619:	00 00 00 
+  80461c:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  80461e:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804625:	48 85 c0             	test   %rax,%rax
+  804628:	74 09                	je     804633 <vfprintf+0xb0>
+  80462a:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804631:	eb 06                	jmp    804639 <vfprintf+0xb6>
+  804633:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  804639:	c9                   	leave
+  80463a:	c3                   	ret
+
+000000000080463b <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80463b:	55                   	push   %rbp
+  80463c:	48 89 e5             	mov    %rsp,%rbp
+  80463f:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804646:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  80464c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804653:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80465a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804661:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804668:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80466f:	84 c0                	test   %al,%al
+  804671:	74 20                	je     804693 <fprintf+0x58>
+  804673:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804677:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80467b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80467f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804683:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804687:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80468b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80468f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804693:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80469a:	00 00 00 
+  80469d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8046a4:	00 00 00 
+  8046a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8046ab:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8046b2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8046b9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  8046c0:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8046c7:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8046ce:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8046d4:	48 89 ce             	mov    %rcx,%rsi
+  8046d7:	89 c7                	mov    %eax,%edi
+  8046d9:	48 b8 83 45 80 00 00 	movabs $0x804583,%rax
+  8046e0:	00 00 00 
+  8046e3:	ff d0                	call   *%rax
+  8046e5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8046eb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8046f1:	c9                   	leave
+  8046f2:	c3                   	ret
+
+00000000008046f3 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8046f3:	55                   	push   %rbp
+  8046f4:	48 89 e5             	mov    %rsp,%rbp
+  8046f7:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8046fe:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804705:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80470c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804713:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80471a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804721:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804728:	84 c0                	test   %al,%al
+  80472a:	74 20                	je     80474c <printf+0x59>
+  80472c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804730:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804734:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804738:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80473c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804740:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804744:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804748:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80474c:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804753:	00 00 00 
+  804756:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80475d:	00 00 00 
+  804760:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804764:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80476b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804772:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  804779:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804780:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804787:	48 89 c6             	mov    %rax,%rsi
+  80478a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80478f:	48 b8 83 45 80 00 00 	movabs $0x804583,%rax
+  804796:	00 00 00 
+  804799:	ff d0                	call   *%rax
+  80479b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8047a1:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8047a7:	c9                   	leave
+  8047a8:	c3                   	ret
+
+00000000008047a9 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8047a9:	55                   	push   %rbp
+  8047aa:	48 89 e5             	mov    %rsp,%rbp
+  8047ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8047b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8047b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047b9:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8047be:	48 89 c7             	mov    %rax,%rdi
+  8047c1:	48 b8 cf 47 80 00 00 	movabs $0x8047cf,%rax
+  8047c8:	00 00 00 
+  8047cb:	ff d0                	call   *%rax
+}
+  8047cd:	c9                   	leave
+  8047ce:	c3                   	ret
+
+00000000008047cf <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8047cf:	55                   	push   %rbp
+  8047d0:	48 89 e5             	mov    %rsp,%rbp
+  8047d3:	48 83 ec 50          	sub    $0x50,%rsp
+  8047d7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8047db:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8047df:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8047e6:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8047e7:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8047ec:	74 0a                	je     8047f8 <pipe_size+0x29>
+  8047ee:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8047f5:	00 
+  8047f6:	76 0a                	jbe    804802 <pipe_size+0x33>
+    return -E_INVAL;
+  8047f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047fd:	e9 cc 02 00 00       	jmp    804ace <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804802:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804806:	48 89 c7             	mov    %rax,%rdi
+  804809:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  804810:	00 00 00 
+  804813:	ff d0                	call   *%rax
+  804815:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804818:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80481c:	0f 88 a8 02 00 00    	js     804aca <pipe_size+0x2fb>
+  804822:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804826:	ba 07 04 00 00       	mov    $0x407,%edx
+  80482b:	48 89 c6             	mov    %rax,%rsi
+  80482e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804833:	48 b8 9b 25 80 00 00 	movabs $0x80259b,%rax
+  80483a:	00 00 00 
+  80483d:	ff d0                	call   *%rax
+  80483f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804842:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804846:	0f 88 7e 02 00 00    	js     804aca <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80484c:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804850:	48 89 c7             	mov    %rax,%rdi
+  804853:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  80485a:	00 00 00 
+  80485d:	ff d0                	call   *%rax
+  80485f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804862:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804866:	0f 88 43 02 00 00    	js     804aaf <pipe_size+0x2e0>
+  80486c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804870:	ba 07 04 00 00       	mov    $0x407,%edx
+  804875:	48 89 c6             	mov    %rax,%rsi
+  804878:	bf 00 00 00 00       	mov    $0x0,%edi
+  80487d:	48 b8 9b 25 80 00 00 	movabs $0x80259b,%rax
+  804884:	00 00 00 
+  804887:	ff d0                	call   *%rax
+  804889:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80488c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804890:	0f 88 19 02 00 00    	js     804aaf <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804896:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489a:	48 89 c7             	mov    %rax,%rdi
+  80489d:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  8048a4:	00 00 00 
+  8048a7:	ff d0                	call   *%rax
+  8048a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8048ad:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8048b4:	00 
+  8048b5:	e9 a2 00 00 00       	jmp    80495c <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8048ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048be:	48 c1 e0 0c          	shl    $0xc,%rax
+  8048c2:	48 89 c2             	mov    %rax,%rdx
+  8048c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c9:	48 01 d0             	add    %rdx,%rax
+  8048cc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048d1:	48 89 c6             	mov    %rax,%rsi
+  8048d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d9:	48 b8 9b 25 80 00 00 	movabs $0x80259b,%rax
+  8048e0:	00 00 00 
+  8048e3:	ff d0                	call   *%rax
+  8048e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048ec:	0f 88 37 01 00 00    	js     804a29 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8048f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048f6:	48 89 c7             	mov    %rax,%rdi
+  8048f9:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  804900:	00 00 00 
+  804903:	ff d0                	call   *%rax
+  804905:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804909:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80490d:	48 01 c2             	add    %rax,%rdx
+  804910:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804914:	48 c1 e0 0c          	shl    $0xc,%rax
+  804918:	48 89 c1             	mov    %rax,%rcx
+  80491b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80491f:	48 01 c8             	add    %rcx,%rax
+  804922:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804928:	48 89 d1             	mov    %rdx,%rcx
+  80492b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804930:	48 89 c6             	mov    %rax,%rsi
+  804933:	bf 00 00 00 00       	mov    $0x0,%edi
+  804938:	48 b8 f3 25 80 00 00 	movabs $0x8025f3,%rax
+  80493f:	00 00 00 
+  804942:	ff d0                	call   *%rax
+  804944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804947:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80494b:	79 0a                	jns    804957 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80494d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804952:	e9 d3 00 00 00       	jmp    804a2a <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804957:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80495c:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804963:	00 
+  804964:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804968:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80496c:	48 01 d0             	add    %rdx,%rax
+  80496f:	48 83 c0 1f          	add    $0x1f,%rax
+  804973:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80497b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804980:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804984:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804988:	48 29 d0             	sub    %rdx,%rax
+  80498b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80498f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804993:	0f 82 21 ff ff ff    	jb     8048ba <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80499d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8049a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049a5:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049a9:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8049ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049b1:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8049b8:	00 00 00 
+  8049bb:	8b 12                	mov    (%rdx),%edx
+  8049bd:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8049bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049c3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8049ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049ce:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8049d5:	00 00 00 
+  8049d8:	8b 12                	mov    (%rdx),%edx
+  8049da:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8049dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049e0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8049e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049eb:	48 89 c7             	mov    %rax,%rdi
+  8049ee:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  8049f5:	00 00 00 
+  8049f8:	ff d0                	call   *%rax
+  8049fa:	89 c2                	mov    %eax,%edx
+  8049fc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a00:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804a02:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a06:	48 89 c7             	mov    %rax,%rdi
+  804a09:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  804a10:	00 00 00 
+  804a13:	ff d0                	call   *%rax
+  804a15:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a19:	48 83 c2 04          	add    $0x4,%rdx
+  804a1d:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a24:	e9 a5 00 00 00       	jmp    804ace <pipe_size+0x2ff>
+      goto err2;
+  804a29:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804a2a:	eb 58                	jmp    804a84 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a30:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a34:	48 89 c2             	mov    %rax,%rdx
+  804a37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a3b:	48 01 d0             	add    %rdx,%rax
+  804a3e:	48 89 c6             	mov    %rax,%rsi
+  804a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a46:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  804a4d:	00 00 00 
+  804a50:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804a52:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a56:	48 89 c7             	mov    %rax,%rdi
+  804a59:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  804a60:	00 00 00 
+  804a63:	ff d0                	call   *%rax
+  804a65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a69:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804a6d:	48 01 d0             	add    %rdx,%rax
+  804a70:	48 89 c6             	mov    %rax,%rsi
+  804a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a78:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  804a7f:	00 00 00 
+  804a82:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a88:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a8c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804a90:	48 85 c0             	test   %rax,%rax
+  804a93:	75 97                	jne    804a2c <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804a95:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a99:	48 89 c6             	mov    %rax,%rsi
+  804a9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa1:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  804aa8:	00 00 00 
+  804aab:	ff d0                	call   *%rax
+  804aad:	eb 01                	jmp    804ab0 <pipe_size+0x2e1>
+    goto err1;
+  804aaf:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804ab0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ab4:	48 89 c6             	mov    %rax,%rsi
+  804ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804abc:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  804ac3:	00 00 00 
+  804ac6:	ff d0                	call   *%rax
+  804ac8:	eb 01                	jmp    804acb <pipe_size+0x2fc>
+    goto err;
+  804aca:	90                   	nop
+err:
+  return r;
+  804acb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804ace:	c9                   	leave
+  804acf:	c3                   	ret
+
+0000000000804ad0 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804ad0:	55                   	push   %rbp
+  804ad1:	48 89 e5             	mov    %rsp,%rbp
+  804ad4:	53                   	push   %rbx
+  804ad5:	48 83 ec 28          	sub    $0x28,%rsp
+  804ad9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804add:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804ae1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ae8:	00 00 00 
+  804aeb:	8b 40 04             	mov    0x4(%rax),%eax
+  804aee:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804af3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804afa:	00 00 00 
+  804afd:	48 98                	cltq
+  804aff:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b06:	48 01 d0             	add    %rdx,%rax
+  804b09:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b0f:	8b 00                	mov    (%rax),%eax
+  804b11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804b14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b18:	48 89 c7             	mov    %rax,%rdi
+  804b1b:	48 b8 c1 59 80 00 00 	movabs $0x8059c1,%rax
+  804b22:	00 00 00 
+  804b25:	ff d0                	call   *%rax
+  804b27:	89 c3                	mov    %eax,%ebx
+  804b29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b2d:	48 89 c7             	mov    %rax,%rdi
+  804b30:	48 b8 c1 59 80 00 00 	movabs $0x8059c1,%rax
+  804b37:	00 00 00 
+  804b3a:	ff d0                	call   *%rax
+  804b3c:	39 c3                	cmp    %eax,%ebx
+  804b3e:	0f 94 c0             	sete   %al
+  804b41:	0f b6 c0             	movzbl %al,%eax
+  804b44:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804b47:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b4e:	00 00 00 
+  804b51:	8b 40 04             	mov    0x4(%rax),%eax
+  804b54:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b59:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b60:	00 00 00 
+  804b63:	48 98                	cltq
+  804b65:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b6c:	48 01 d0             	add    %rdx,%rax
+  804b6f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b75:	8b 00                	mov    (%rax),%eax
+  804b77:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804b7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b7d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b80:	75 05                	jne    804b87 <_pipeisclosed+0xb7>
+      return ret;
+  804b82:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b85:	eb 68                	jmp    804bef <_pipeisclosed+0x11f>
+    if (n != nn)
+  804b87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b8a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b8d:	0f 84 4e ff ff ff    	je     804ae1 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804b93:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b9a:	00 00 00 
+  804b9d:	8b 40 04             	mov    0x4(%rax),%eax
+  804ba0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ba5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bac:	00 00 00 
+  804baf:	48 98                	cltq
+  804bb1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bb8:	48 01 d0             	add    %rdx,%rax
+  804bbb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bc1:	8b 10                	mov    (%rax),%edx
+  804bc3:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804bc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc9:	89 c6                	mov    %eax,%esi
+  804bcb:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  804bd2:	00 00 00 
+  804bd5:	48 89 c7             	mov    %rax,%rdi
+  804bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bdd:	49 b8 1d 08 80 00 00 	movabs $0x80081d,%r8
+  804be4:	00 00 00 
+  804be7:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804bea:	e9 f2 fe ff ff       	jmp    804ae1 <_pipeisclosed+0x11>
+  }
+}
+  804bef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804bf3:	c9                   	leave
+  804bf4:	c3                   	ret
+
+0000000000804bf5 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804bf5:	55                   	push   %rbp
+  804bf6:	48 89 e5             	mov    %rsp,%rbp
+  804bf9:	48 83 ec 30          	sub    $0x30,%rsp
+  804bfd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c00:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804c04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c07:	48 89 d6             	mov    %rdx,%rsi
+  804c0a:	89 c7                	mov    %eax,%edi
+  804c0c:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  804c13:	00 00 00 
+  804c16:	ff d0                	call   *%rax
+  804c18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c1b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c1f:	79 05                	jns    804c26 <pipeisclosed+0x31>
+    return r;
+  804c21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c24:	eb 31                	jmp    804c57 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804c26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c2a:	48 89 c7             	mov    %rax,%rdi
+  804c2d:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  804c34:	00 00 00 
+  804c37:	ff d0                	call   *%rax
+  804c39:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c41:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c45:	48 89 d6             	mov    %rdx,%rsi
+  804c48:	48 89 c7             	mov    %rax,%rdi
+  804c4b:	48 b8 d0 4a 80 00 00 	movabs $0x804ad0,%rax
+  804c52:	00 00 00 
+  804c55:	ff d0                	call   *%rax
+}
+  804c57:	c9                   	leave
+  804c58:	c3                   	ret
+
+0000000000804c59 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804c59:	55                   	push   %rbp
+  804c5a:	48 89 e5             	mov    %rsp,%rbp
+  804c5d:	48 83 ec 10          	sub    $0x10,%rsp
+  804c61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c69:	8b 40 18             	mov    0x18(%rax),%eax
+  804c6c:	8d 50 01             	lea    0x1(%rax),%edx
+  804c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c73:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804c76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c7a:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804c7d:	85 c0                	test   %eax,%eax
+  804c7f:	74 27                	je     804ca8 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804c81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c85:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804c8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c90:	48 83 c0 18          	add    $0x18,%rax
+  804c94:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804c99:	48 89 c7             	mov    %rax,%rdi
+  804c9c:	48 b8 96 29 80 00 00 	movabs $0x802996,%rax
+  804ca3:	00 00 00 
+  804ca6:	ff d0                	call   *%rax
+  }
+}
+  804ca8:	90                   	nop
+  804ca9:	c9                   	leave
+  804caa:	c3                   	ret
+
+0000000000804cab <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804cab:	55                   	push   %rbp
+  804cac:	48 89 e5             	mov    %rsp,%rbp
+  804caf:	48 83 ec 10          	sub    $0x10,%rsp
+  804cb3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cb7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804cba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cbe:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804cc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc9:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804ccd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804cd0:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804cd7:	89 c6                	mov    %eax,%esi
+  804cd9:	48 89 cf             	mov    %rcx,%rdi
+  804cdc:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  804ce3:	00 00 00 
+  804ce6:	ff d0                	call   *%rax
+}
+  804ce8:	90                   	nop
+  804ce9:	c9                   	leave
+  804cea:	c3                   	ret
+
+0000000000804ceb <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804ceb:	55                   	push   %rbp
+  804cec:	48 89 e5             	mov    %rsp,%rbp
+  804cef:	48 83 ec 70          	sub    $0x70,%rsp
+  804cf3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804cf7:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804cfb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804cff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d03:	48 89 c7             	mov    %rax,%rdi
+  804d06:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  804d0d:	00 00 00 
+  804d10:	ff d0                	call   *%rax
+  804d12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804d16:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804d1b:	75 0a                	jne    804d27 <devpipe_read+0x3c>
+    return 0;
+  804d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d22:	e9 63 01 00 00       	jmp    804e8a <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d2b:	8b 40 18             	mov    0x18(%rax),%eax
+  804d2e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804d31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d35:	48 8b 10             	mov    (%rax),%rdx
+  804d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d40:	48 39 c2             	cmp    %rax,%rdx
+  804d43:	75 42                	jne    804d87 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804d45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d49:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d4d:	48 89 d6             	mov    %rdx,%rsi
+  804d50:	48 89 c7             	mov    %rax,%rdi
+  804d53:	48 b8 d0 4a 80 00 00 	movabs $0x804ad0,%rax
+  804d5a:	00 00 00 
+  804d5d:	ff d0                	call   *%rax
+  804d5f:	85 c0                	test   %eax,%eax
+  804d61:	74 0a                	je     804d6d <devpipe_read+0x82>
+      return 0;
+  804d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d68:	e9 1d 01 00 00       	jmp    804e8a <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804d6d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d74:	89 d6                	mov    %edx,%esi
+  804d76:	48 89 c7             	mov    %rax,%rdi
+  804d79:	48 b8 ab 4c 80 00 00 	movabs $0x804cab,%rax
+  804d80:	00 00 00 
+  804d83:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804d85:	eb a0                	jmp    804d27 <devpipe_read+0x3c>
+      break;
+  804d87:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804d88:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d8c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804d90:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d94:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804da0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804da4:	48 8b 00             	mov    (%rax),%rax
+  804da7:	48 29 c2             	sub    %rax,%rdx
+  804daa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804dae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804db2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804db6:	48 39 c2             	cmp    %rax,%rdx
+  804db9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804dbd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804dc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc5:	48 8b 00             	mov    (%rax),%rax
+  804dc8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dcc:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dd5:	48 f7 f1             	div    %rcx
+  804dd8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804ddc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804de0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804de8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804dec:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804df0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804df4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804df8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804dfc:	48 39 c2             	cmp    %rax,%rdx
+  804dff:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e03:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804e07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e0b:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804e0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e13:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e17:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e1f:	48 89 ce             	mov    %rcx,%rsi
+  804e22:	48 89 c7             	mov    %rax,%rdi
+  804e25:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  804e2c:	00 00 00 
+  804e2f:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804e31:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e35:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804e39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e3d:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804e41:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e45:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e49:	48 01 d1             	add    %rdx,%rcx
+  804e4c:	48 89 c2             	mov    %rax,%rdx
+  804e4f:	48 89 cf             	mov    %rcx,%rdi
+  804e52:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  804e59:	00 00 00 
+  804e5c:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804e5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e62:	48 8b 10             	mov    (%rax),%rdx
+  804e65:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e69:	48 01 c2             	add    %rax,%rdx
+  804e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e70:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804e73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e77:	48 89 c7             	mov    %rax,%rdi
+  804e7a:	48 b8 59 4c 80 00 00 	movabs $0x804c59,%rax
+  804e81:	00 00 00 
+  804e84:	ff d0                	call   *%rax
+  return n;
+  804e86:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804e8a:	c9                   	leave
+  804e8b:	c3                   	ret
+
+0000000000804e8c <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e8c:	55                   	push   %rbp
+  804e8d:	48 89 e5             	mov    %rsp,%rbp
+  804e90:	48 83 ec 70          	sub    $0x70,%rsp
+  804e94:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e98:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e9c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804ea0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ea4:	48 89 c7             	mov    %rax,%rdi
+  804ea7:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  804eae:	00 00 00 
+  804eb1:	ff d0                	call   *%rax
+  804eb3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804eb7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ebb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804ebf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804ec6:	00 
+  804ec7:	e9 b8 01 00 00       	jmp    805084 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed0:	8b 40 18             	mov    0x18(%rax),%eax
+  804ed3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804ed6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eda:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee2:	48 8b 00             	mov    (%rax),%rax
+  804ee5:	48 29 c2             	sub    %rax,%rdx
+  804ee8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eec:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ef0:	48 39 c2             	cmp    %rax,%rdx
+  804ef3:	75 4d                	jne    804f42 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804ef5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ef9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804efd:	48 89 d6             	mov    %rdx,%rsi
+  804f00:	48 89 c7             	mov    %rax,%rdi
+  804f03:	48 b8 d0 4a 80 00 00 	movabs $0x804ad0,%rax
+  804f0a:	00 00 00 
+  804f0d:	ff d0                	call   *%rax
+  804f0f:	85 c0                	test   %eax,%eax
+  804f11:	74 0a                	je     804f1d <devpipe_write+0x91>
+        return 0;
+  804f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f18:	e9 79 01 00 00       	jmp    805096 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804f1d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804f20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f24:	89 d6                	mov    %edx,%esi
+  804f26:	48 89 c7             	mov    %rax,%rdi
+  804f29:	48 b8 ab 4c 80 00 00 	movabs $0x804cab,%rax
+  804f30:	00 00 00 
+  804f33:	ff d0                	call   *%rax
+      m = 0;
+  804f35:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804f3c:	00 
+      continue;
+  804f3d:	e9 3a 01 00 00       	jmp    80507c <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804f42:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f46:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804f4a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f52:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5a:	48 8b 08             	mov    (%rax),%rcx
+  804f5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f61:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f65:	48 29 c1             	sub    %rax,%rcx
+  804f68:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804f6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f70:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f78:	48 39 c2             	cmp    %rax,%rdx
+  804f7b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804f83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f87:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f8f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f93:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f98:	48 f7 f1             	div    %rcx
+  804f9b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804f9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fa3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804fa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804faf:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fb3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804fb7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804fbb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fbf:	48 39 c2             	cmp    %rax,%rdx
+  804fc2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fc6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804fca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fce:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804fd2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fd6:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804fda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fde:	48 01 d1             	add    %rdx,%rcx
+  804fe1:	48 89 c2             	mov    %rax,%rdx
+  804fe4:	48 89 cf             	mov    %rcx,%rdi
+  804fe7:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  804fee:	00 00 00 
+  804ff1:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804ff3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ffb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fff:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805003:	73 4d                	jae    805052 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805009:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80500d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805011:	48 29 c2             	sub    %rax,%rdx
+  805014:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805018:	48 01 c2             	add    %rax,%rdx
+  80501b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805023:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805027:	48 89 c1             	mov    %rax,%rcx
+  80502a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80502e:	48 01 c1             	add    %rax,%rcx
+  805031:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805035:	48 01 c1             	add    %rax,%rcx
+  805038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80503c:	48 83 c0 20          	add    $0x20,%rax
+  805040:	48 89 ce             	mov    %rcx,%rsi
+  805043:	48 89 c7             	mov    %rax,%rdi
+  805046:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  80504d:	00 00 00 
+  805050:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805052:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805056:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80505a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80505e:	48 01 c2             	add    %rax,%rdx
+  805061:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805065:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805069:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80506d:	48 89 c7             	mov    %rax,%rdi
+  805070:	48 b8 59 4c 80 00 00 	movabs $0x804c59,%rax
+  805077:	00 00 00 
+  80507a:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80507c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805080:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805088:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80508c:	0f 82 3a fe ff ff    	jb     804ecc <devpipe_write+0x40>
+  }
+
+  return i;
+  805092:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805096:	c9                   	leave
+  805097:	c3                   	ret
+
+0000000000805098 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805098:	55                   	push   %rbp
+  805099:	48 89 e5             	mov    %rsp,%rbp
+  80509c:	48 83 ec 40          	sub    $0x40,%rsp
+  8050a0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8050a4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8050a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050af:	48 89 c7             	mov    %rax,%rdi
+  8050b2:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  8050b9:	00 00 00 
+  8050bc:	ff d0                	call   *%rax
+  8050be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8050c2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8050c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050cd:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8050d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050d5:	48 89 d6             	mov    %rdx,%rsi
+  8050d8:	48 89 c7             	mov    %rax,%rdi
+  8050db:	48 b8 5a 3a 80 00 00 	movabs $0x803a5a,%rax
+  8050e2:	00 00 00 
+  8050e5:	ff d0                	call   *%rax
+  8050e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050ee:	79 08                	jns    8050f8 <devpipe_poll+0x60>
+    return r;
+  8050f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050f3:	e9 85 00 00 00       	jmp    80517d <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8050f8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050fb:	83 e0 01             	and    $0x1,%eax
+  8050fe:	85 c0                	test   %eax,%eax
+  805100:	74 18                	je     80511a <devpipe_poll+0x82>
+  805102:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805106:	48 8b 10             	mov    (%rax),%rdx
+  805109:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80510d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805111:	48 39 c2             	cmp    %rax,%rdx
+  805114:	74 04                	je     80511a <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805116:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80511a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80511d:	83 e0 02             	and    $0x2,%eax
+  805120:	85 c0                	test   %eax,%eax
+  805122:	74 23                	je     805147 <devpipe_poll+0xaf>
+  805124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805128:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80512c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805130:	48 8b 00             	mov    (%rax),%rax
+  805133:	48 29 c2             	sub    %rax,%rdx
+  805136:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80513a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80513e:	48 39 c2             	cmp    %rax,%rdx
+  805141:	73 04                	jae    805147 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805143:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805147:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80514b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80514f:	48 89 d6             	mov    %rdx,%rsi
+  805152:	48 89 c7             	mov    %rax,%rdi
+  805155:	48 b8 d0 4a 80 00 00 	movabs $0x804ad0,%rax
+  80515c:	00 00 00 
+  80515f:	ff d0                	call   *%rax
+  805161:	85 c0                	test   %eax,%eax
+  805163:	74 04                	je     805169 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805165:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805169:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80516d:	75 0b                	jne    80517a <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80516f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805173:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80517a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80517d:	c9                   	leave
+  80517e:	c3                   	ret
+
+000000000080517f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80517f:	55                   	push   %rbp
+  805180:	48 89 e5             	mov    %rsp,%rbp
+  805183:	48 83 ec 20          	sub    $0x20,%rsp
+  805187:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80518b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80518f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805193:	48 89 c7             	mov    %rax,%rdi
+  805196:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  80519d:	00 00 00 
+  8051a0:	ff d0                	call   *%rax
+  8051a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8051a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051aa:	48 ba 91 61 80 00 00 	movabs $0x806191,%rdx
+  8051b1:	00 00 00 
+  8051b4:	48 89 d6             	mov    %rdx,%rsi
+  8051b7:	48 89 c7             	mov    %rax,%rdi
+  8051ba:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  8051c1:	00 00 00 
+  8051c4:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8051c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051ce:	89 c1                	mov    %eax,%ecx
+  8051d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051d4:	48 8b 00             	mov    (%rax),%rax
+  8051d7:	89 c2                	mov    %eax,%edx
+  8051d9:	89 c8                	mov    %ecx,%eax
+  8051db:	29 d0                	sub    %edx,%eax
+  8051dd:	89 c2                	mov    %eax,%edx
+  8051df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8051e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051ed:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8051f4:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8051f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051fb:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805202:	00 00 00 
+  805205:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80520c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805211:	c9                   	leave
+  805212:	c3                   	ret
+
+0000000000805213 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805213:	55                   	push   %rbp
+  805214:	48 89 e5             	mov    %rsp,%rbp
+  805217:	48 83 ec 40          	sub    $0x40,%rsp
+  80521b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80521f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805223:	48 89 c7             	mov    %rax,%rdi
+  805226:	48 b8 87 2f 80 00 00 	movabs $0x802f87,%rax
+  80522d:	00 00 00 
+  805230:	ff d0                	call   *%rax
+  805232:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805236:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80523d:	00 
+  80523e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805242:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80524a:	48 01 d0             	add    %rdx,%rax
+  80524d:	48 83 c0 1f          	add    $0x1f,%rax
+  805251:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805255:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805259:	ba 00 00 00 00       	mov    $0x0,%edx
+  80525e:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805266:	48 29 d0             	sub    %rdx,%rax
+  805269:	48 c1 e8 0c          	shr    $0xc,%rax
+  80526d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805271:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805275:	48 89 c6             	mov    %rax,%rsi
+  805278:	bf 00 00 00 00       	mov    $0x0,%edi
+  80527d:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  805284:	00 00 00 
+  805287:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80528d:	48 89 c7             	mov    %rax,%rdi
+  805290:	48 b8 59 4c 80 00 00 	movabs $0x804c59,%rax
+  805297:	00 00 00 
+  80529a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80529c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8052a4:	eb 2f                	jmp    8052d5 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8052a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052aa:	48 83 e8 01          	sub    $0x1,%rax
+  8052ae:	48 c1 e0 0c          	shl    $0xc,%rax
+  8052b2:	48 89 c2             	mov    %rax,%rdx
+  8052b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b9:	48 01 d0             	add    %rdx,%rax
+  8052bc:	48 89 c6             	mov    %rax,%rsi
+  8052bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052c4:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8052cb:	00 00 00 
+  8052ce:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8052d0:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8052d5:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8052da:	77 ca                	ja     8052a6 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8052dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052e0:	48 89 c6             	mov    %rax,%rsi
+  8052e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052e8:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8052ef:	00 00 00 
+  8052f2:	ff d0                	call   *%rax
+}
+  8052f4:	c9                   	leave
+  8052f5:	c3                   	ret
+
+00000000008052f6 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8052f6:	55                   	push   %rbp
+  8052f7:	48 89 e5             	mov    %rsp,%rbp
+  8052fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8052fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805301:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805305:	75 10                	jne    805317 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805307:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80530e:	00 00 00 
+  805311:	8b 00                	mov    (%rax),%eax
+  805313:	48 98                	cltq
+  805315:	eb 05                	jmp    80531c <vsyscall+0x26>
+  }
+  return 0;
+  805317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80531c:	c9                   	leave
+  80531d:	c3                   	ret
+
+000000000080531e <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80531e:	55                   	push   %rbp
+  80531f:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805322:	bf 00 00 00 00       	mov    $0x0,%edi
+  805327:	48 b8 f6 52 80 00 00 	movabs $0x8052f6,%rax
+  80532e:	00 00 00 
+  805331:	ff d0                	call   *%rax
+}
+  805333:	5d                   	pop    %rbp
+  805334:	c3                   	ret
+
+0000000000805335 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805335:	55                   	push   %rbp
+  805336:	48 89 e5             	mov    %rsp,%rbp
+  805339:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80533d:	0f 31                	rdtsc
+  80533f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805342:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805345:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805348:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80534b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80534f:	48 09 d0             	or     %rdx,%rax
+  805352:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805356:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80535a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80535e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805365:	00 00 00 
+  805368:	8b 40 08             	mov    0x8(%rax),%eax
+  80536b:	48 98                	cltq
+  80536d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805371:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805375:	ba 00 00 00 00       	mov    $0x0,%edx
+  80537a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80537e:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805385:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80538e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805392:	48 89 d0             	mov    %rdx,%rax
+  805395:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80539c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053a1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8053a5:	48 01 c8             	add    %rcx,%rax
+}
+  8053a8:	c9                   	leave
+  8053a9:	c3                   	ret
+
+00000000008053aa <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8053aa:	55                   	push   %rbp
+  8053ab:	48 89 e5             	mov    %rsp,%rbp
+  8053ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8053b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8053b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b8:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8053bb:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8053bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8053c4:	48 89 c7             	mov    %rax,%rdi
+  8053c7:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  8053ce:	00 00 00 
+  8053d1:	ff d0                	call   *%rax
+}
+  8053d3:	90                   	nop
+  8053d4:	c9                   	leave
+  8053d5:	c3                   	ret
+
+00000000008053d6 <getchar>:
+
+int
+getchar(void) {
+  8053d6:	55                   	push   %rbp
+  8053d7:	48 89 e5             	mov    %rsp,%rbp
+  8053da:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8053de:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8053e2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8053e7:	48 89 c6             	mov    %rax,%rsi
+  8053ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053ef:	48 b8 f0 35 80 00 00 	movabs $0x8035f0,%rax
+  8053f6:	00 00 00 
+  8053f9:	ff d0                	call   *%rax
+  8053fb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8053fe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805402:	79 05                	jns    805409 <getchar+0x33>
+    return r;
+  805404:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805407:	eb 14                	jmp    80541d <getchar+0x47>
+  if (r < 1)
+  805409:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80540d:	7f 07                	jg     805416 <getchar+0x40>
+    return -E_EOF;
+  80540f:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805414:	eb 07                	jmp    80541d <getchar+0x47>
+  return c;
+  805416:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80541a:	0f b6 c0             	movzbl %al,%eax
+}
+  80541d:	c9                   	leave
+  80541e:	c3                   	ret
+
+000000000080541f <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80541f:	55                   	push   %rbp
+  805420:	48 89 e5             	mov    %rsp,%rbp
+  805423:	48 83 ec 20          	sub    $0x20,%rsp
+  805427:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80542a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80542e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805431:	48 89 d6             	mov    %rdx,%rsi
+  805434:	89 c7                	mov    %eax,%edi
+  805436:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  80543d:	00 00 00 
+  805440:	ff d0                	call   *%rax
+  805442:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805445:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805449:	79 05                	jns    805450 <iscons+0x31>
+    return r;
+  80544b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80544e:	eb 1a                	jmp    80546a <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805450:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805454:	8b 10                	mov    (%rax),%edx
+  805456:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80545d:	00 00 00 
+  805460:	8b 00                	mov    (%rax),%eax
+  805462:	39 c2                	cmp    %eax,%edx
+  805464:	0f 94 c0             	sete   %al
+  805467:	0f b6 c0             	movzbl %al,%eax
+}
+  80546a:	c9                   	leave
+  80546b:	c3                   	ret
+
+000000000080546c <opencons>:
+
+int
+opencons(void) {
+  80546c:	55                   	push   %rbp
+  80546d:	48 89 e5             	mov    %rsp,%rbp
+  805470:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805474:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805478:	48 89 c7             	mov    %rax,%rdi
+  80547b:	48 b8 b2 2f 80 00 00 	movabs $0x802fb2,%rax
+  805482:	00 00 00 
+  805485:	ff d0                	call   *%rax
+  805487:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80548a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80548e:	79 05                	jns    805495 <opencons+0x29>
+    return r;
+  805490:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805493:	eb 66                	jmp    8054fb <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805495:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805499:	ba 07 04 00 00       	mov    $0x407,%edx
+  80549e:	48 89 c6             	mov    %rax,%rsi
+  8054a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054a6:	48 b8 9b 25 80 00 00 	movabs $0x80259b,%rax
+  8054ad:	00 00 00 
+  8054b0:	ff d0                	call   *%rax
+  8054b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8054b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054b9:	79 05                	jns    8054c0 <opencons+0x54>
+    return r;
+  8054bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054be:	eb 3b                	jmp    8054fb <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8054c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c4:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8054cb:	00 00 00 
+  8054ce:	8b 12                	mov    (%rdx),%edx
+  8054d0:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8054d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054d6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8054dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054e1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8054e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054ec:	48 89 c7             	mov    %rax,%rdi
+  8054ef:	48 b8 64 2f 80 00 00 	movabs $0x802f64,%rax
+  8054f6:	00 00 00 
+  8054f9:	ff d0                	call   *%rax
+}
+  8054fb:	c9                   	leave
+  8054fc:	c3                   	ret
+
+00000000008054fd <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8054fd:	55                   	push   %rbp
+  8054fe:	48 89 e5             	mov    %rsp,%rbp
+  805501:	48 83 ec 20          	sub    $0x20,%rsp
+  805505:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805508:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80550b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80550f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805512:	48 89 d6             	mov    %rdx,%rsi
+  805515:	89 c7                	mov    %eax,%edi
+  805517:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  80551e:	00 00 00 
+  805521:	ff d0                	call   *%rax
+  805523:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805526:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80552a:	79 05                	jns    805531 <consmode+0x34>
+    return r;
+  80552c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80552f:	eb 34                	jmp    805565 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805531:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805535:	8b 10                	mov    (%rax),%edx
+  805537:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80553e:	00 00 00 
+  805541:	8b 00                	mov    (%rax),%eax
+  805543:	39 c2                	cmp    %eax,%edx
+  805545:	74 07                	je     80554e <consmode+0x51>
+    return -E_INVAL;
+  805547:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80554c:	eb 17                	jmp    805565 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80554e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805552:	8b 40 0c             	mov    0xc(%rax),%eax
+  805555:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805558:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80555c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80555f:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805562:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805565:	c9                   	leave
+  805566:	c3                   	ret
+
+0000000000805567 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805567:	55                   	push   %rbp
+  805568:	48 89 e5             	mov    %rsp,%rbp
+  80556b:	48 83 ec 20          	sub    $0x20,%rsp
+  80556f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805573:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805577:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80557b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80557f:	8b 50 0c             	mov    0xc(%rax),%edx
+  805582:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805586:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80558a:	48 89 ce             	mov    %rcx,%rsi
+  80558d:	48 89 c7             	mov    %rax,%rdi
+  805590:	48 b8 f5 28 80 00 00 	movabs $0x8028f5,%rax
+  805597:	00 00 00 
+  80559a:	ff d0                	call   *%rax
+  80559c:	48 98                	cltq
+}
+  80559e:	c9                   	leave
+  80559f:	c3                   	ret
+
+00000000008055a0 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8055a0:	55                   	push   %rbp
+  8055a1:	48 89 e5             	mov    %rsp,%rbp
+  8055a4:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8055ab:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8055b2:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8055b9:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8055c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8055c7:	eb 74                	jmp    80563d <devcons_write+0x9d>
+    m = n - tot;
+  8055c9:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8055d0:	89 c2                	mov    %eax,%edx
+  8055d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055d5:	29 c2                	sub    %eax,%edx
+  8055d7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8055da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8055dd:	83 f8 7f             	cmp    $0x7f,%eax
+  8055e0:	76 07                	jbe    8055e9 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8055e2:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8055e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8055ec:	48 63 d0             	movslq %eax,%rdx
+  8055ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055f2:	48 63 c8             	movslq %eax,%rcx
+  8055f5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8055fc:	48 01 c1             	add    %rax,%rcx
+  8055ff:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805606:	48 89 ce             	mov    %rcx,%rsi
+  805609:	48 89 c7             	mov    %rax,%rdi
+  80560c:	48 b8 10 1d 80 00 00 	movabs $0x801d10,%rax
+  805613:	00 00 00 
+  805616:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805618:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80561b:	48 63 d0             	movslq %eax,%rdx
+  80561e:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805625:	48 89 d6             	mov    %rdx,%rsi
+  805628:	48 89 c7             	mov    %rax,%rdi
+  80562b:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  805632:	00 00 00 
+  805635:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805637:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80563a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80563d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805640:	48 98                	cltq
+  805642:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805649:	0f 82 7a ff ff ff    	jb     8055c9 <devcons_write+0x29>
+  }
+  return tot;
+  80564f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805652:	48 98                	cltq
+}
+  805654:	c9                   	leave
+  805655:	c3                   	ret
+
+0000000000805656 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805656:	55                   	push   %rbp
+  805657:	48 89 e5             	mov    %rsp,%rbp
+  80565a:	48 83 ec 08          	sub    $0x8,%rsp
+  80565e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805662:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805667:	c9                   	leave
+  805668:	c3                   	ret
+
+0000000000805669 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805669:	55                   	push   %rbp
+  80566a:	48 89 e5             	mov    %rsp,%rbp
+  80566d:	48 83 ec 10          	sub    $0x10,%rsp
+  805671:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805675:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805679:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80567d:	48 ba 9d 61 80 00 00 	movabs $0x80619d,%rdx
+  805684:	00 00 00 
+  805687:	48 89 d6             	mov    %rdx,%rsi
+  80568a:	48 89 c7             	mov    %rax,%rdi
+  80568d:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  805694:	00 00 00 
+  805697:	ff d0                	call   *%rax
+  return 0;
+  805699:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80569e:	c9                   	leave
+  80569f:	c3                   	ret
+
+00000000008056a0 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8056a0:	55                   	push   %rbp
+  8056a1:	48 89 e5             	mov    %rsp,%rbp
+  8056a4:	48 83 ec 30          	sub    $0x30,%rsp
+  8056a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056ac:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8056af:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8056b3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8056ba:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8056bd:	83 e0 02             	and    $0x2,%eax
+  8056c0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8056c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056c7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8056ca:	83 f8 01             	cmp    $0x1,%eax
+  8056cd:	75 04                	jne    8056d3 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8056cf:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8056d3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8056d6:	83 e0 01             	and    $0x1,%eax
+  8056d9:	85 c0                	test   %eax,%eax
+  8056db:	74 44                	je     805721 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8056dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056e5:	89 c2                	mov    %eax,%edx
+  8056e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8056ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056f1:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8056f8:	00 00 00 
+  8056fb:	ff d0                	call   *%rax
+  8056fd:	83 f8 01             	cmp    $0x1,%eax
+  805700:	75 06                	jne    805708 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805702:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805706:	eb 19                	jmp    805721 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805708:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80570c:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805712:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805715:	89 c2                	mov    %eax,%edx
+  805717:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80571b:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805721:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805724:	c9                   	leave
+  805725:	c3                   	ret
+
+0000000000805726 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805726:	55                   	push   %rbp
+  805727:	48 89 e5             	mov    %rsp,%rbp
+  80572a:	48 83 ec 20          	sub    $0x20,%rsp
+  80572e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805732:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805736:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80573a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80573e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805746:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  80574d:	48 89 c7             	mov    %rax,%rdi
+  805750:	48 b8 5e 57 80 00 00 	movabs $0x80575e,%rax
+  805757:	00 00 00 
+  80575a:	ff d0                	call   *%rax
+}
+  80575c:	c9                   	leave
+  80575d:	c3                   	ret
+
+000000000080575e <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  80575e:	55                   	push   %rbp
+  80575f:	48 89 e5             	mov    %rsp,%rbp
+  805762:	48 83 ec 30          	sub    $0x30,%rsp
+  805766:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80576a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80576e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805772:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805776:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80577b:	75 0e                	jne    80578b <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80577d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805784:	00 00 00 
+  805787:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80578b:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805790:	75 18                	jne    8057aa <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805792:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805796:	48 89 c7             	mov    %rax,%rdi
+  805799:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  8057a0:	00 00 00 
+  8057a3:	ff d0                	call   *%rax
+  8057a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8057a8:	eb 1d                	jmp    8057c7 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8057aa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8057ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057b2:	48 89 d6             	mov    %rdx,%rsi
+  8057b5:	48 89 c7             	mov    %rax,%rdi
+  8057b8:	48 b8 21 28 80 00 00 	movabs $0x802821,%rax
+  8057bf:	00 00 00 
+  8057c2:	ff d0                	call   *%rax
+  8057c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8057c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057cb:	79 2a                	jns    8057f7 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8057cd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8057d2:	74 0a                	je     8057de <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8057d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057d8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8057de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8057e3:	74 0a                	je     8057ef <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8057e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057e9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  8057ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057f2:	e9 aa 00 00 00       	jmp    8058a1 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  8057f7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8057fc:	74 36                	je     805834 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  8057fe:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805805:	00 00 00 
+  805808:	8b 40 04             	mov    0x4(%rax),%eax
+  80580b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805810:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805817:	00 00 00 
+  80581a:	48 98                	cltq
+  80581c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805823:	48 01 d0             	add    %rdx,%rax
+  805826:	48 05 24 01 00 00    	add    $0x124,%rax
+  80582c:	8b 10                	mov    (%rax),%edx
+  80582e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805832:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805834:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805839:	74 36                	je     805871 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80583b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805842:	00 00 00 
+  805845:	8b 40 04             	mov    0x4(%rax),%eax
+  805848:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80584d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805854:	00 00 00 
+  805857:	48 98                	cltq
+  805859:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805860:	48 01 d0             	add    %rdx,%rax
+  805863:	48 05 28 01 00 00    	add    $0x128,%rax
+  805869:	8b 10                	mov    (%rax),%edx
+  80586b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80586f:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805871:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805878:	00 00 00 
+  80587b:	8b 40 04             	mov    0x4(%rax),%eax
+  80587e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805883:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80588a:	00 00 00 
+  80588d:	48 98                	cltq
+  80588f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805896:	48 01 d0             	add    %rdx,%rax
+  805899:	48 05 20 01 00 00    	add    $0x120,%rax
+  80589f:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8058a1:	c9                   	leave
+  8058a2:	c3                   	ret
+
+00000000008058a3 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8058a3:	55                   	push   %rbp
+  8058a4:	48 89 e5             	mov    %rsp,%rbp
+  8058a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8058ab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058ae:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8058b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8058b5:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8058b8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8058bd:	75 5e                	jne    80591d <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8058bf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058c6:	00 00 00 
+  8058c9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8058cd:	eb 4e                	jmp    80591d <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8058cf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058d3:	79 3c                	jns    805911 <ipc_send+0x6e>
+  8058d5:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8058d9:	74 36                	je     805911 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8058db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058de:	89 c1                	mov    %eax,%ecx
+  8058e0:	48 b8 a8 61 80 00 00 	movabs $0x8061a8,%rax
+  8058e7:	00 00 00 
+  8058ea:	48 89 c2             	mov    %rax,%rdx
+  8058ed:	be 54 00 00 00       	mov    $0x54,%esi
+  8058f2:	48 b8 ce 61 80 00 00 	movabs $0x8061ce,%rax
+  8058f9:	00 00 00 
+  8058fc:	48 89 c7             	mov    %rax,%rdi
+  8058ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  805904:	49 b8 fe 05 80 00 00 	movabs $0x8005fe,%r8
+  80590b:	00 00 00 
+  80590e:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805911:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  805918:	00 00 00 
+  80591b:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80591d:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805920:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805923:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805927:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80592a:	89 c7                	mov    %eax,%edi
+  80592c:	48 b8 84 27 80 00 00 	movabs $0x802784,%rax
+  805933:	00 00 00 
+  805936:	ff d0                	call   *%rax
+  805938:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80593b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80593f:	75 8e                	jne    8058cf <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805941:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  805948:	00 00 00 
+  80594b:	ff d0                	call   *%rax
+}
+  80594d:	90                   	nop
+  80594e:	c9                   	leave
+  80594f:	c3                   	ret
+
+0000000000805950 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805950:	55                   	push   %rbp
+  805951:	48 89 e5             	mov    %rsp,%rbp
+  805954:	48 83 ec 18          	sub    $0x18,%rsp
+  805958:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  80595b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805962:	eb 4d                	jmp    8059b1 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805964:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80596b:	00 00 00 
+  80596e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805971:	48 98                	cltq
+  805973:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80597a:	48 01 d0             	add    %rdx,%rax
+  80597d:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805983:	8b 00                	mov    (%rax),%eax
+  805985:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805988:	75 23                	jne    8059ad <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80598a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805991:	00 00 00 
+  805994:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805997:	48 98                	cltq
+  805999:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8059a0:	48 01 d0             	add    %rdx,%rax
+  8059a3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8059a9:	8b 00                	mov    (%rax),%eax
+  8059ab:	eb 12                	jmp    8059bf <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8059ad:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8059b1:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8059b8:	7e aa                	jle    805964 <ipc_find_env+0x14>
+  return 0;
+  8059ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059bf:	c9                   	leave
+  8059c0:	c3                   	ret
+
+00000000008059c1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8059c1:	55                   	push   %rbp
+  8059c2:	48 89 e5             	mov    %rsp,%rbp
+  8059c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8059c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8059cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059d1:	48 c1 e8 27          	shr    $0x27,%rax
+  8059d5:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8059da:	48 89 c2             	mov    %rax,%rdx
+  8059dd:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8059e4:	01 00 00 
+  8059e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059eb:	83 e0 01             	and    $0x1,%eax
+  8059ee:	48 85 c0             	test   %rax,%rax
+  8059f1:	74 63                	je     805a56 <pageref+0x95>
+  8059f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059f7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8059fb:	48 89 c2             	mov    %rax,%rdx
+  8059fe:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805a05:	01 00 00 
+  805a08:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a0c:	83 e0 01             	and    $0x1,%eax
+  805a0f:	48 85 c0             	test   %rax,%rax
+  805a12:	74 42                	je     805a56 <pageref+0x95>
+  805a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a18:	48 c1 e8 15          	shr    $0x15,%rax
+  805a1c:	48 89 c2             	mov    %rax,%rdx
+  805a1f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805a26:	01 00 00 
+  805a29:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a2d:	83 e0 01             	and    $0x1,%eax
+  805a30:	48 85 c0             	test   %rax,%rax
+  805a33:	74 21                	je     805a56 <pageref+0x95>
+  805a35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a39:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a3d:	48 89 c2             	mov    %rax,%rdx
+  805a40:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805a47:	01 00 00 
+  805a4a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a4e:	83 e0 01             	and    $0x1,%eax
+  805a51:	48 85 c0             	test   %rax,%rax
+  805a54:	75 07                	jne    805a5d <pageref+0x9c>
+    return 0;
+  805a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a5b:	eb 53                	jmp    805ab0 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805a5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a61:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a65:	48 89 c2             	mov    %rax,%rdx
+  805a68:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805a6f:	01 00 00 
+  805a72:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a76:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805a7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a7e:	83 e0 01             	and    $0x1,%eax
+  805a81:	48 85 c0             	test   %rax,%rax
+  805a84:	75 07                	jne    805a8d <pageref+0xcc>
+    return 0;
+  805a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a8b:	eb 23                	jmp    805ab0 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805a8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a91:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a95:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805a9c:	00 00 00 
+  805a9f:	48 c1 e0 04          	shl    $0x4,%rax
+  805aa3:	48 01 d0             	add    %rdx,%rax
+  805aa6:	48 83 c0 08          	add    $0x8,%rax
+  805aaa:	0f b7 00             	movzwl (%rax),%eax
+  805aad:	0f b7 c0             	movzwl %ax,%eax
+}
+  805ab0:	c9                   	leave
+  805ab1:	c3                   	ret
+  805ab2:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,8721 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 91 01 00 00       	call   8001bd <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  cprintf("usage: lsfd [-1]\n");
+  800036:	48 b8 20 57 80 00 00 	movabs $0x805720,%rax
+  80003d:	00 00 00 
+  800040:	48 89 c7             	mov    %rax,%rdi
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba 69 03 80 00 00 	movabs $0x800369,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+  exit();
+  800054:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  80005b:	00 00 00 
+  80005e:	ff d0                	call   *%rax
+}
+  800060:	90                   	nop
+  800061:	5d                   	pop    %rbp
+  800062:	c3                   	ret
+
+0000000000800063 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800063:	55                   	push   %rbp
+  800064:	48 89 e5             	mov    %rsp,%rbp
+  800067:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  80006e:	89 bd 3c ff ff ff    	mov    %edi,-0xc4(%rbp)
+  800074:	48 89 b5 30 ff ff ff 	mov    %rsi,-0xd0(%rbp)
+  int i, usefprint = 0;
+  80007b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  struct Stat st;
+  struct Argstate args;
+
+  argstart(&argc, argv, &args);
+  800082:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  800089:	48 8b 8d 30 ff ff ff 	mov    -0xd0(%rbp),%rcx
+  800090:	48 8d 85 3c ff ff ff 	lea    -0xc4(%rbp),%rax
+  800097:	48 89 ce             	mov    %rcx,%rsi
+  80009a:	48 89 c7             	mov    %rax,%rdi
+  80009d:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8000a4:	00 00 00 
+  8000a7:	ff d0                	call   *%rax
+  while ((i = argnext(&args)) >= 0)
+  8000a9:	eb 1b                	jmp    8000c6 <umain+0x63>
+    if (i == '1')
+  8000ab:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+  8000af:	75 09                	jne    8000ba <umain+0x57>
+      usefprint = 1;
+  8000b1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+  8000b8:	eb 0c                	jmp    8000c6 <umain+0x63>
+    else
+      usage();
+  8000ba:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+  while ((i = argnext(&args)) >= 0)
+  8000c6:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8000cd:	48 89 c7             	mov    %rax,%rdi
+  8000d0:	48 b8 33 28 80 00 00 	movabs $0x802833,%rax
+  8000d7:	00 00 00 
+  8000da:	ff d0                	call   *%rax
+  8000dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000e3:	79 c6                	jns    8000ab <umain+0x48>
+
+  for (i = 0; i < 32; i++)
+  8000e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000ec:	e9 be 00 00 00       	jmp    8001af <umain+0x14c>
+    if (fstat(i, &st) >= 0) {
+  8000f1:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  8000f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000fb:	48 89 d6             	mov    %rdx,%rsi
+  8000fe:	89 c7                	mov    %eax,%edi
+  800100:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	85 c0                	test   %eax,%eax
+  80010e:	0f 88 97 00 00 00    	js     8001ab <umain+0x148>
+      if (usefprint)
+  800114:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800118:	74 52                	je     80016c <umain+0x109>
+        fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                i, st.st_name, st.st_isdir,
+                st.st_size, st.st_dev->dev_name);
+  80011a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  80011e:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  800122:	8b 7d e0             	mov    -0x20(%rbp),%edi
+  800125:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800128:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  80012f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800132:	48 83 ec 08          	sub    $0x8,%rsp
+  800136:	51                   	push   %rcx
+  800137:	41 89 f9             	mov    %edi,%r9d
+  80013a:	41 89 f0             	mov    %esi,%r8d
+  80013d:	48 89 d1             	mov    %rdx,%rcx
+  800140:	89 c2                	mov    %eax,%edx
+  800142:	48 b8 38 57 80 00 00 	movabs $0x805738,%rax
+  800149:	00 00 00 
+  80014c:	48 89 c6             	mov    %rax,%rsi
+  80014f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	49 ba 87 41 80 00 00 	movabs $0x804187,%r10
+  800160:	00 00 00 
+  800163:	41 ff d2             	call   *%r10
+  800166:	48 83 c4 10          	add    $0x10,%rsp
+  80016a:	eb 3f                	jmp    8001ab <umain+0x148>
+      else
+        cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+                i, st.st_name, st.st_isdir,
+                st.st_size, st.st_dev->dev_name);
+  80016c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  800170:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  800174:	8b 75 e0             	mov    -0x20(%rbp),%esi
+  800177:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80017a:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  800181:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800184:	49 89 f9             	mov    %rdi,%r9
+  800187:	41 89 f0             	mov    %esi,%r8d
+  80018a:	89 c6                	mov    %eax,%esi
+  80018c:	48 b8 38 57 80 00 00 	movabs $0x805738,%rax
+  800193:	00 00 00 
+  800196:	48 89 c7             	mov    %rax,%rdi
+  800199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019e:	49 ba 69 03 80 00 00 	movabs $0x800369,%r10
+  8001a5:	00 00 00 
+  8001a8:	41 ff d2             	call   *%r10
+  for (i = 0; i < 32; i++)
+  8001ab:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8001af:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8001b3:	0f 8e 38 ff ff ff    	jle    8000f1 <umain+0x8e>
+    }
+}
+  8001b9:	90                   	nop
+  8001ba:	90                   	nop
+  8001bb:	c9                   	leave
+  8001bc:	c3                   	ret
+
+00000000008001bd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001bd:	55                   	push   %rbp
+  8001be:	48 89 e5             	mov    %rsp,%rbp
+  8001c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8001c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8001c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8001cc:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8001d3:	00 00 00 
+  8001d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001da:	eb 13                	jmp    8001ef <libmain+0x32>
+    (*ctor)();
+  8001dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001e0:	48 8b 10             	mov    (%rax),%rdx
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	ff d2                	call   *%rdx
+    ctor++;
+  8001ea:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001ef:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8001f6:	00 00 00 
+  8001f9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8001fd:	72 dd                	jb     8001dc <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800203:	7e 14                	jle    800219 <libmain+0x5c>
+    binaryname = argv[0];
+  800205:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800209:	48 8b 00             	mov    (%rax),%rax
+  80020c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800213:	00 00 00 
+  800216:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800219:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80021d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800220:	48 89 d6             	mov    %rdx,%rsi
+  800223:	89 c7                	mov    %eax,%edi
+  800225:	48 b8 63 00 80 00 00 	movabs $0x800063,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800231:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+#endif
+}
+  80023d:	90                   	nop
+  80023e:	c9                   	leave
+  80023f:	c3                   	ret
+
+0000000000800240 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800240:	55                   	push   %rbp
+  800241:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800244:	48 b8 a0 2e 80 00 00 	movabs $0x802ea0,%rax
+  80024b:	00 00 00 
+  80024e:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800250:	bf 00 00 00 00       	mov    $0x0,%edi
+  800255:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  80025c:	00 00 00 
+  80025f:	ff d0                	call   *%rax
+}
+  800261:	90                   	nop
+  800262:	5d                   	pop    %rbp
+  800263:	c3                   	ret
+
+0000000000800264 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800264:	55                   	push   %rbp
+  800265:	48 89 e5             	mov    %rsp,%rbp
+  800268:	48 83 ec 10          	sub    $0x10,%rsp
+  80026c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80026f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800273:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800277:	8b 00                	mov    (%rax),%eax
+  800279:	8d 48 01             	lea    0x1(%rax),%ecx
+  80027c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800280:	89 0a                	mov    %ecx,(%rdx)
+  800282:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800285:	89 d1                	mov    %edx,%ecx
+  800287:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80028b:	48 98                	cltq
+  80028d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800291:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800295:	8b 00                	mov    (%rax),%eax
+  800297:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80029c:	75 2c                	jne    8002ca <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80029e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002a2:	8b 00                	mov    (%rax),%eax
+  8002a4:	48 98                	cltq
+  8002a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002aa:	48 83 c2 08          	add    $0x8,%rdx
+  8002ae:	48 89 c6             	mov    %rax,%rsi
+  8002b1:	48 89 d7             	mov    %rdx,%rdi
+  8002b4:	48 b8 d0 1e 80 00 00 	movabs $0x801ed0,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+    b->idx = 0;
+  8002c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002c4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8002ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8002d1:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002d8:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8002db:	90                   	nop
+  8002dc:	c9                   	leave
+  8002dd:	c3                   	ret
+
+00000000008002de <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8002e9:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8002f0:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8002f7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8002fe:	00 00 00 
+  b.cnt = 0;
+  800301:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800308:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80030b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800312:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800319:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800320:	48 89 c6             	mov    %rax,%rsi
+  800323:	48 b8 64 02 80 00 00 	movabs $0x800264,%rax
+  80032a:	00 00 00 
+  80032d:	48 89 c7             	mov    %rax,%rdi
+  800330:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  800337:	00 00 00 
+  80033a:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80033c:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800342:	48 98                	cltq
+  800344:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80034b:	48 83 c2 08          	add    $0x8,%rdx
+  80034f:	48 89 c6             	mov    %rax,%rsi
+  800352:	48 89 d7             	mov    %rdx,%rdi
+  800355:	48 b8 d0 1e 80 00 00 	movabs $0x801ed0,%rax
+  80035c:	00 00 00 
+  80035f:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800361:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+0000000000800369 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800369:	55                   	push   %rbp
+  80036a:	48 89 e5             	mov    %rsp,%rbp
+  80036d:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800374:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80037b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800382:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800389:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800390:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800397:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80039e:	84 c0                	test   %al,%al
+  8003a0:	74 20                	je     8003c2 <cprintf+0x59>
+  8003a2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003a6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003aa:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003ae:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003b2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003b6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003ba:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003be:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8003c2:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8003c9:	00 00 00 
+  8003cc:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8003d3:	00 00 00 
+  8003d6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003da:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8003e1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003e8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8003ef:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8003f6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8003fd:	48 89 d6             	mov    %rdx,%rsi
+  800400:	48 89 c7             	mov    %rax,%rdi
+  800403:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  80040a:	00 00 00 
+  80040d:	ff d0                	call   *%rax
+  80040f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800415:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80041b:	c9                   	leave
+  80041c:	c3                   	ret
+
+000000000080041d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	48 83 ec 30          	sub    $0x30,%rsp
+  800425:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800429:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80042d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800431:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800434:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800438:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80043c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80043f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800443:	72 54                	jb     800499 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800445:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800448:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80044b:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80044e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	48 f7 f6             	div    %rsi
+  80045a:	49 89 c2             	mov    %rax,%r10
+  80045d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800460:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800463:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80046b:	41 89 c9             	mov    %ecx,%r9d
+  80046e:	41 89 f8             	mov    %edi,%r8d
+  800471:	89 d1                	mov    %edx,%ecx
+  800473:	4c 89 d2             	mov    %r10,%rdx
+  800476:	48 89 c7             	mov    %rax,%rdi
+  800479:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  800480:	00 00 00 
+  800483:	ff d0                	call   *%rax
+  800485:	eb 1c                	jmp    8004a3 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800487:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80048b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80048e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800492:	48 89 d6             	mov    %rdx,%rsi
+  800495:	89 c7                	mov    %eax,%edi
+  800497:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800499:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80049d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8004a1:	7f e4                	jg     800487 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004a3:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8004a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004af:	48 f7 f1             	div    %rcx
+  8004b2:	48 b8 b0 59 80 00 00 	movabs $0x8059b0,%rax
+  8004b9:	00 00 00 
+  8004bc:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8004c0:	0f be c0             	movsbl %al,%eax
+  8004c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004c7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004cb:	48 89 d6             	mov    %rdx,%rsi
+  8004ce:	89 c7                	mov    %eax,%edi
+  8004d0:	ff d1                	call   *%rcx
+}
+  8004d2:	90                   	nop
+  8004d3:	c9                   	leave
+  8004d4:	c3                   	ret
+
+00000000008004d5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8004d5:	55                   	push   %rbp
+  8004d6:	48 89 e5             	mov    %rsp,%rbp
+  8004d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8004dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004e1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8004e4:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8004e8:	7e 4b                	jle    800535 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8004ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ee:	8b 00                	mov    (%rax),%eax
+  8004f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8004f3:	77 24                	ja     800519 <getuint+0x44>
+  8004f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800501:	8b 00                	mov    (%rax),%eax
+  800503:	89 c0                	mov    %eax,%eax
+  800505:	48 01 d0             	add    %rdx,%rax
+  800508:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80050c:	8b 12                	mov    (%rdx),%edx
+  80050e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800511:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800515:	89 0a                	mov    %ecx,(%rdx)
+  800517:	eb 14                	jmp    80052d <getuint+0x58>
+  800519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80051d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800521:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800525:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800529:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80052d:	48 8b 00             	mov    (%rax),%rax
+  800530:	e9 95 00 00 00       	jmp    8005ca <getuint+0xf5>
+  else if (lflag)
+  800535:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800539:	74 48                	je     800583 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80053b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053f:	8b 00                	mov    (%rax),%eax
+  800541:	83 f8 2f             	cmp    $0x2f,%eax
+  800544:	77 24                	ja     80056a <getuint+0x95>
+  800546:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80054e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800552:	8b 00                	mov    (%rax),%eax
+  800554:	89 c0                	mov    %eax,%eax
+  800556:	48 01 d0             	add    %rdx,%rax
+  800559:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80055d:	8b 12                	mov    (%rdx),%edx
+  80055f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800566:	89 0a                	mov    %ecx,(%rdx)
+  800568:	eb 14                	jmp    80057e <getuint+0xa9>
+  80056a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80056e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800572:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800576:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80057a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80057e:	48 8b 00             	mov    (%rax),%rax
+  800581:	eb 47                	jmp    8005ca <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800583:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800587:	8b 00                	mov    (%rax),%eax
+  800589:	83 f8 2f             	cmp    $0x2f,%eax
+  80058c:	77 24                	ja     8005b2 <getuint+0xdd>
+  80058e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800592:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80059a:	8b 00                	mov    (%rax),%eax
+  80059c:	89 c0                	mov    %eax,%eax
+  80059e:	48 01 d0             	add    %rdx,%rax
+  8005a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005a5:	8b 12                	mov    (%rdx),%edx
+  8005a7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005ae:	89 0a                	mov    %ecx,(%rdx)
+  8005b0:	eb 14                	jmp    8005c6 <getuint+0xf1>
+  8005b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005ba:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005c6:	8b 00                	mov    (%rax),%eax
+  8005c8:	89 c0                	mov    %eax,%eax
+}
+  8005ca:	c9                   	leave
+  8005cb:	c3                   	ret
+
+00000000008005cc <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8005cc:	55                   	push   %rbp
+  8005cd:	48 89 e5             	mov    %rsp,%rbp
+  8005d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8005d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005d8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8005db:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8005df:	7e 4b                	jle    80062c <getint+0x60>
+    return va_arg(*ap, long long);
+  8005e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e5:	8b 00                	mov    (%rax),%eax
+  8005e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ea:	77 24                	ja     800610 <getint+0x44>
+  8005ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f8:	8b 00                	mov    (%rax),%eax
+  8005fa:	89 c0                	mov    %eax,%eax
+  8005fc:	48 01 d0             	add    %rdx,%rax
+  8005ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800603:	8b 12                	mov    (%rdx),%edx
+  800605:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800608:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80060c:	89 0a                	mov    %ecx,(%rdx)
+  80060e:	eb 14                	jmp    800624 <getint+0x58>
+  800610:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800614:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800618:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80061c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800620:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800624:	48 8b 00             	mov    (%rax),%rax
+  800627:	e9 95 00 00 00       	jmp    8006c1 <getint+0xf5>
+  else if (lflag)
+  80062c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800630:	74 48                	je     80067a <getint+0xae>
+    return va_arg(*ap, long);
+  800632:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800636:	8b 00                	mov    (%rax),%eax
+  800638:	83 f8 2f             	cmp    $0x2f,%eax
+  80063b:	77 24                	ja     800661 <getint+0x95>
+  80063d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800641:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800649:	8b 00                	mov    (%rax),%eax
+  80064b:	89 c0                	mov    %eax,%eax
+  80064d:	48 01 d0             	add    %rdx,%rax
+  800650:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800654:	8b 12                	mov    (%rdx),%edx
+  800656:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800659:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80065d:	89 0a                	mov    %ecx,(%rdx)
+  80065f:	eb 14                	jmp    800675 <getint+0xa9>
+  800661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800665:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800669:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80066d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800671:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800675:	48 8b 00             	mov    (%rax),%rax
+  800678:	eb 47                	jmp    8006c1 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80067a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80067e:	8b 00                	mov    (%rax),%eax
+  800680:	83 f8 2f             	cmp    $0x2f,%eax
+  800683:	77 24                	ja     8006a9 <getint+0xdd>
+  800685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800689:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80068d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800691:	8b 00                	mov    (%rax),%eax
+  800693:	89 c0                	mov    %eax,%eax
+  800695:	48 01 d0             	add    %rdx,%rax
+  800698:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80069c:	8b 12                	mov    (%rdx),%edx
+  80069e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006a5:	89 0a                	mov    %ecx,(%rdx)
+  8006a7:	eb 14                	jmp    8006bd <getint+0xf1>
+  8006a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006b1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006b9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006bd:	8b 00                	mov    (%rax),%eax
+  8006bf:	48 98                	cltq
+}
+  8006c1:	c9                   	leave
+  8006c2:	c3                   	ret
+
+00000000008006c3 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8006c3:	55                   	push   %rbp
+  8006c4:	48 89 e5             	mov    %rsp,%rbp
+  8006c7:	41 54                	push   %r12
+  8006c9:	53                   	push   %rbx
+  8006ca:	48 83 ec 60          	sub    $0x60,%rsp
+  8006ce:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8006d2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8006d6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006da:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8006de:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006e2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8006e6:	48 8b 06             	mov    (%rsi),%rax
+  8006e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006ed:	48 89 01             	mov    %rax,(%rcx)
+  8006f0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006f4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006f8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8006fc:	eb 17                	jmp    800715 <vprintfmt+0x52>
+      if (ch == '\0')
+  8006fe:	85 db                	test   %ebx,%ebx
+  800700:	0f 84 bf 04 00 00    	je     800bc5 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800706:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80070a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80070e:	48 89 c6             	mov    %rax,%rsi
+  800711:	89 df                	mov    %ebx,%edi
+  800713:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800715:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800719:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80071d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800721:	0f b6 00             	movzbl (%rax),%eax
+  800724:	0f b6 d8             	movzbl %al,%ebx
+  800727:	83 fb 25             	cmp    $0x25,%ebx
+  80072a:	75 d2                	jne    8006fe <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80072c:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800730:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800737:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80073e:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800745:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80074c:	eb 04                	jmp    800752 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80074e:	90                   	nop
+  80074f:	eb 01                	jmp    800752 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800751:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800752:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800756:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80075a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80075e:	0f b6 00             	movzbl (%rax),%eax
+  800761:	0f b6 d8             	movzbl %al,%ebx
+  800764:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800767:	83 f8 55             	cmp    $0x55,%eax
+  80076a:	0f 87 22 04 00 00    	ja     800b92 <vprintfmt+0x4cf>
+  800770:	89 c0                	mov    %eax,%eax
+  800772:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800779:	00 
+  80077a:	48 b8 d8 59 80 00 00 	movabs $0x8059d8,%rax
+  800781:	00 00 00 
+  800784:	48 01 d0             	add    %rdx,%rax
+  800787:	48 8b 00             	mov    (%rax),%rax
+  80078a:	ff e0                	jmp    *%rax
+        padc = '-';
+  80078c:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800790:	eb c0                	jmp    800752 <vprintfmt+0x8f>
+        padc = '0';
+  800792:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800796:	eb ba                	jmp    800752 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800798:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80079f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8007a2:	89 d0                	mov    %edx,%eax
+  8007a4:	c1 e0 02             	shl    $0x2,%eax
+  8007a7:	01 d0                	add    %edx,%eax
+  8007a9:	01 c0                	add    %eax,%eax
+  8007ab:	01 d8                	add    %ebx,%eax
+  8007ad:	83 e8 30             	sub    $0x30,%eax
+  8007b0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8007b3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007b7:	0f b6 00             	movzbl (%rax),%eax
+  8007ba:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8007bd:	83 fb 2f             	cmp    $0x2f,%ebx
+  8007c0:	7e 60                	jle    800822 <vprintfmt+0x15f>
+  8007c2:	83 fb 39             	cmp    $0x39,%ebx
+  8007c5:	7f 5b                	jg     800822 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8007c7:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8007cc:	eb d1                	jmp    80079f <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8007ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d4:	77 17                	ja     8007ed <vprintfmt+0x12a>
+  8007d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007da:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007dd:	89 d2                	mov    %edx,%edx
+  8007df:	48 01 d0             	add    %rdx,%rax
+  8007e2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007e5:	83 c2 08             	add    $0x8,%edx
+  8007e8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007eb:	eb 0c                	jmp    8007f9 <vprintfmt+0x136>
+  8007ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007f1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007f5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007f9:	8b 00                	mov    (%rax),%eax
+  8007fb:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8007fe:	eb 23                	jmp    800823 <vprintfmt+0x160>
+        if (width < 0)
+  800800:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800804:	0f 89 44 ff ff ff    	jns    80074e <vprintfmt+0x8b>
+          width = 0;
+  80080a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800811:	e9 38 ff ff ff       	jmp    80074e <vprintfmt+0x8b>
+        altflag = 1;
+  800816:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80081d:	e9 30 ff ff ff       	jmp    800752 <vprintfmt+0x8f>
+        goto process_precision;
+  800822:	90                   	nop
+        if (width < 0)
+  800823:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800827:	0f 89 24 ff ff ff    	jns    800751 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80082d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800830:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800833:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80083a:	e9 12 ff ff ff       	jmp    800751 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80083f:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800843:	e9 0a ff ff ff       	jmp    800752 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800848:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084b:	83 f8 2f             	cmp    $0x2f,%eax
+  80084e:	77 17                	ja     800867 <vprintfmt+0x1a4>
+  800850:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800854:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800857:	89 d2                	mov    %edx,%edx
+  800859:	48 01 d0             	add    %rdx,%rax
+  80085c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80085f:	83 c2 08             	add    $0x8,%edx
+  800862:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800865:	eb 0c                	jmp    800873 <vprintfmt+0x1b0>
+  800867:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80086b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80086f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800873:	8b 00                	mov    (%rax),%eax
+  800875:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800879:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80087d:	48 89 d6             	mov    %rdx,%rsi
+  800880:	89 c7                	mov    %eax,%edi
+  800882:	ff d1                	call   *%rcx
+        break;
+  800884:	e9 37 03 00 00       	jmp    800bc0 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800889:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088c:	83 f8 2f             	cmp    $0x2f,%eax
+  80088f:	77 17                	ja     8008a8 <vprintfmt+0x1e5>
+  800891:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800895:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800898:	89 d2                	mov    %edx,%edx
+  80089a:	48 01 d0             	add    %rdx,%rax
+  80089d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008a0:	83 c2 08             	add    $0x8,%edx
+  8008a3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008a6:	eb 0c                	jmp    8008b4 <vprintfmt+0x1f1>
+  8008a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008ac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008b0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008b4:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8008b6:	85 db                	test   %ebx,%ebx
+  8008b8:	79 02                	jns    8008bc <vprintfmt+0x1f9>
+          err = -err;
+  8008ba:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008bc:	83 fb 15             	cmp    $0x15,%ebx
+  8008bf:	7f 16                	jg     8008d7 <vprintfmt+0x214>
+  8008c1:	48 ba 00 59 80 00 00 	movabs $0x805900,%rdx
+  8008c8:	00 00 00 
+  8008cb:	48 63 c3             	movslq %ebx,%rax
+  8008ce:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8008d2:	4d 85 e4             	test   %r12,%r12
+  8008d5:	75 2e                	jne    800905 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8008d7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008db:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008df:	89 d9                	mov    %ebx,%ecx
+  8008e1:	48 ba c1 59 80 00 00 	movabs $0x8059c1,%rdx
+  8008e8:	00 00 00 
+  8008eb:	48 89 c7             	mov    %rax,%rdi
+  8008ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f3:	49 b8 cf 0b 80 00 00 	movabs $0x800bcf,%r8
+  8008fa:	00 00 00 
+  8008fd:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800900:	e9 bb 02 00 00       	jmp    800bc0 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800905:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800909:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80090d:	4c 89 e1             	mov    %r12,%rcx
+  800910:	48 ba ca 59 80 00 00 	movabs $0x8059ca,%rdx
+  800917:	00 00 00 
+  80091a:	48 89 c7             	mov    %rax,%rdi
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	49 b8 cf 0b 80 00 00 	movabs $0x800bcf,%r8
+  800929:	00 00 00 
+  80092c:	41 ff d0             	call   *%r8
+        break;
+  80092f:	e9 8c 02 00 00       	jmp    800bc0 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800934:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800937:	83 f8 2f             	cmp    $0x2f,%eax
+  80093a:	77 17                	ja     800953 <vprintfmt+0x290>
+  80093c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800940:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800943:	89 d2                	mov    %edx,%edx
+  800945:	48 01 d0             	add    %rdx,%rax
+  800948:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80094b:	83 c2 08             	add    $0x8,%edx
+  80094e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800951:	eb 0c                	jmp    80095f <vprintfmt+0x29c>
+  800953:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800957:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80095b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80095f:	4c 8b 20             	mov    (%rax),%r12
+  800962:	4d 85 e4             	test   %r12,%r12
+  800965:	75 0a                	jne    800971 <vprintfmt+0x2ae>
+          p = "(null)";
+  800967:	49 bc cd 59 80 00 00 	movabs $0x8059cd,%r12
+  80096e:	00 00 00 
+        if (width > 0 && padc != '-')
+  800971:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800975:	7e 78                	jle    8009ef <vprintfmt+0x32c>
+  800977:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80097b:	74 72                	je     8009ef <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80097d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800980:	48 98                	cltq
+  800982:	48 89 c6             	mov    %rax,%rsi
+  800985:	4c 89 e7             	mov    %r12,%rdi
+  800988:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  80098f:	00 00 00 
+  800992:	ff d0                	call   *%rax
+  800994:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800997:	eb 17                	jmp    8009b0 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800999:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80099d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8009a1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8009a5:	48 89 d6             	mov    %rdx,%rsi
+  8009a8:	89 c7                	mov    %eax,%edi
+  8009aa:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8009ac:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009b0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009b4:	7f e3                	jg     800999 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009b6:	eb 37                	jmp    8009ef <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8009b8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8009bc:	74 1e                	je     8009dc <vprintfmt+0x319>
+  8009be:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009c1:	7e 05                	jle    8009c8 <vprintfmt+0x305>
+  8009c3:	83 fb 7e             	cmp    $0x7e,%ebx
+  8009c6:	7e 14                	jle    8009dc <vprintfmt+0x319>
+            putch('?', putdat);
+  8009c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009cc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009d0:	48 89 c6             	mov    %rax,%rsi
+  8009d3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009d8:	ff d2                	call   *%rdx
+  8009da:	eb 0f                	jmp    8009eb <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8009dc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009e0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009e4:	48 89 c6             	mov    %rax,%rsi
+  8009e7:	89 df                	mov    %ebx,%edi
+  8009e9:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009eb:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009ef:	4c 89 e0             	mov    %r12,%rax
+  8009f2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009f6:	0f b6 00             	movzbl (%rax),%eax
+  8009f9:	0f be d8             	movsbl %al,%ebx
+  8009fc:	85 db                	test   %ebx,%ebx
+  8009fe:	74 28                	je     800a28 <vprintfmt+0x365>
+  800a00:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a04:	78 b2                	js     8009b8 <vprintfmt+0x2f5>
+  800a06:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a0a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a0e:	79 a8                	jns    8009b8 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800a10:	eb 16                	jmp    800a28 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800a12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a16:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a1a:	48 89 c6             	mov    %rax,%rsi
+  800a1d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a22:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800a24:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a28:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a2c:	7f e4                	jg     800a12 <vprintfmt+0x34f>
+        break;
+  800a2e:	e9 8d 01 00 00       	jmp    800bc0 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800a33:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a36:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a3a:	89 d6                	mov    %edx,%esi
+  800a3c:	48 89 c7             	mov    %rax,%rdi
+  800a3f:	48 b8 cc 05 80 00 00 	movabs $0x8005cc,%rax
+  800a46:	00 00 00 
+  800a49:	ff d0                	call   *%rax
+  800a4b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800a4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a53:	48 85 c0             	test   %rax,%rax
+  800a56:	79 1d                	jns    800a75 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800a58:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a5c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a60:	48 89 c6             	mov    %rax,%rsi
+  800a63:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a68:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800a6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a6e:	48 f7 d8             	neg    %rax
+  800a71:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800a75:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a7c:	e9 d2 00 00 00       	jmp    800b53 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800a81:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a84:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a88:	89 d6                	mov    %edx,%esi
+  800a8a:	48 89 c7             	mov    %rax,%rdi
+  800a8d:	48 b8 d5 04 80 00 00 	movabs $0x8004d5,%rax
+  800a94:	00 00 00 
+  800a97:	ff d0                	call   *%rax
+  800a99:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a9d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800aa4:	e9 aa 00 00 00       	jmp    800b53 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800aa9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800aac:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ab0:	89 d6                	mov    %edx,%esi
+  800ab2:	48 89 c7             	mov    %rax,%rdi
+  800ab5:	48 b8 d5 04 80 00 00 	movabs $0x8004d5,%rax
+  800abc:	00 00 00 
+  800abf:	ff d0                	call   *%rax
+  800ac1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800ac5:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800acc:	e9 82 00 00 00       	jmp    800b53 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800ad1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ad5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ad9:	48 89 c6             	mov    %rax,%rsi
+  800adc:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ae1:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800ae3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ae7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aeb:	48 89 c6             	mov    %rax,%rsi
+  800aee:	bf 78 00 00 00       	mov    $0x78,%edi
+  800af3:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800af5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af8:	83 f8 2f             	cmp    $0x2f,%eax
+  800afb:	77 17                	ja     800b14 <vprintfmt+0x451>
+  800afd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b01:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b04:	89 d2                	mov    %edx,%edx
+  800b06:	48 01 d0             	add    %rdx,%rax
+  800b09:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b0c:	83 c2 08             	add    $0x8,%edx
+  800b0f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b12:	eb 0c                	jmp    800b20 <vprintfmt+0x45d>
+  800b14:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b18:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b1c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b20:	48 8b 00             	mov    (%rax),%rax
+  800b23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800b27:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800b2e:	eb 23                	jmp    800b53 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800b30:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b33:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b37:	89 d6                	mov    %edx,%esi
+  800b39:	48 89 c7             	mov    %rax,%rdi
+  800b3c:	48 b8 d5 04 80 00 00 	movabs $0x8004d5,%rax
+  800b43:	00 00 00 
+  800b46:	ff d0                	call   *%rax
+  800b48:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800b4c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800b53:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800b58:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800b5b:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800b5e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b62:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b66:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b6a:	45 89 c1             	mov    %r8d,%r9d
+  800b6d:	41 89 f8             	mov    %edi,%r8d
+  800b70:	48 89 c7             	mov    %rax,%rdi
+  800b73:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  800b7a:	00 00 00 
+  800b7d:	ff d0                	call   *%rax
+        break;
+  800b7f:	eb 3f                	jmp    800bc0 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800b81:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b85:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b89:	48 89 c6             	mov    %rax,%rsi
+  800b8c:	89 df                	mov    %ebx,%edi
+  800b8e:	ff d2                	call   *%rdx
+        break;
+  800b90:	eb 2e                	jmp    800bc0 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b92:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b96:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b9a:	48 89 c6             	mov    %rax,%rsi
+  800b9d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ba2:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800ba4:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ba9:	eb 05                	jmp    800bb0 <vprintfmt+0x4ed>
+  800bab:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800bb0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bb4:	48 83 e8 01          	sub    $0x1,%rax
+  800bb8:	0f b6 00             	movzbl (%rax),%eax
+  800bbb:	3c 25                	cmp    $0x25,%al
+  800bbd:	75 ec                	jne    800bab <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800bbf:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bc0:	e9 50 fb ff ff       	jmp    800715 <vprintfmt+0x52>
+        return;
+  800bc5:	90                   	nop
+    }
+  }
+}
+  800bc6:	48 83 c4 60          	add    $0x60,%rsp
+  800bca:	5b                   	pop    %rbx
+  800bcb:	41 5c                	pop    %r12
+  800bcd:	5d                   	pop    %rbp
+  800bce:	c3                   	ret
+
+0000000000800bcf <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800bcf:	55                   	push   %rbp
+  800bd0:	48 89 e5             	mov    %rsp,%rbp
+  800bd3:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800bda:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800be1:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800be8:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800bef:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800bf6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800bfd:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c04:	84 c0                	test   %al,%al
+  800c06:	74 20                	je     800c28 <printfmt+0x59>
+  800c08:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c0c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c10:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c14:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c18:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c1c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c20:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c24:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800c28:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c2f:	00 00 00 
+  800c32:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c39:	00 00 00 
+  800c3c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c40:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800c47:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c4e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800c55:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800c5c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c63:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c6a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c71:	48 89 c7             	mov    %rax,%rdi
+  800c74:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  800c7b:	00 00 00 
+  800c7e:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800c80:	90                   	nop
+  800c81:	c9                   	leave
+  800c82:	c3                   	ret
+
+0000000000800c83 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800c83:	55                   	push   %rbp
+  800c84:	48 89 e5             	mov    %rsp,%rbp
+  800c87:	48 83 ec 10          	sub    $0x10,%rsp
+  800c8b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c8e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c96:	8b 40 10             	mov    0x10(%rax),%eax
+  800c99:	8d 50 01             	lea    0x1(%rax),%edx
+  800c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ca0:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800ca3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ca7:	48 8b 10             	mov    (%rax),%rdx
+  800caa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cb2:	48 39 c2             	cmp    %rax,%rdx
+  800cb5:	73 17                	jae    800cce <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800cb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cbb:	48 8b 00             	mov    (%rax),%rax
+  800cbe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800cc2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800cc6:	48 89 0a             	mov    %rcx,(%rdx)
+  800cc9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ccc:	88 10                	mov    %dl,(%rax)
+}
+  800cce:	90                   	nop
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+
+0000000000800cd1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800cd1:	55                   	push   %rbp
+  800cd2:	48 89 e5             	mov    %rsp,%rbp
+  800cd5:	48 83 ec 40          	sub    $0x40,%rsp
+  800cd9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800cdd:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800ce0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800ce4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800ce8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800cf0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800cf3:	48 98                	cltq
+  800cf5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cfd:	48 01 d0             	add    %rdx,%rax
+  800d00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800d04:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800d0b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d10:	74 06                	je     800d18 <vsnprintf+0x47>
+  800d12:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d16:	7f 07                	jg     800d1f <vsnprintf+0x4e>
+    return -E_INVAL;
+  800d18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d1d:	eb 32                	jmp    800d51 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800d1f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800d23:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800d27:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800d2b:	48 89 c6             	mov    %rax,%rsi
+  800d2e:	48 b8 83 0c 80 00 00 	movabs $0x800c83,%rax
+  800d35:	00 00 00 
+  800d38:	48 89 c7             	mov    %rax,%rdi
+  800d3b:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  800d42:	00 00 00 
+  800d45:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800d47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d4b:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800d4e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800d51:	c9                   	leave
+  800d52:	c3                   	ret
+
+0000000000800d53 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800d53:	55                   	push   %rbp
+  800d54:	48 89 e5             	mov    %rsp,%rbp
+  800d57:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800d5e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800d65:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800d6b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d72:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d79:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d80:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d87:	84 c0                	test   %al,%al
+  800d89:	74 20                	je     800dab <snprintf+0x58>
+  800d8b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d8f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d93:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d97:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d9b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d9f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800da3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800da7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800dab:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800db2:	00 00 00 
+  800db5:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800dbc:	00 00 00 
+  800dbf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dc3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800dca:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800dd1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800dd8:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800ddf:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800de6:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800dec:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800df3:	48 89 c7             	mov    %rax,%rdi
+  800df6:	48 b8 d1 0c 80 00 00 	movabs $0x800cd1,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+  800e02:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800e08:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e0e:	c9                   	leave
+  800e0f:	c3                   	ret
+
+0000000000800e10 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800e10:	55                   	push   %rbp
+  800e11:	48 89 e5             	mov    %rsp,%rbp
+  800e14:	53                   	push   %rbx
+  800e15:	48 83 ec 38          	sub    $0x38,%rsp
+  800e19:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e1c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e20:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e24:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e28:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800e2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e34:	89 d1                	mov    %edx,%ecx
+  800e36:	0f a2                	cpuid
+  800e38:	89 de                	mov    %ebx,%esi
+  800e3a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e3d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800e40:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800e43:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800e46:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e4b:	74 09                	je     800e56 <cpuid+0x46>
+}
+  800e4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e51:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800e54:	89 10                	mov    %edx,(%rax)
+
+  800e56:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800e5b:	74 09                	je     800e66 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800e5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800e61:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800e64:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800e66:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e6b:	74 09                	je     800e76 <cpuid+0x66>
+char *
+  800e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e71:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e74:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800e76:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e7b:	74 09                	je     800e86 <cpuid+0x76>
+  for (; *s; s++)
+  800e7d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e81:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e84:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800e86:	90                   	nop
+  800e87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e8b:	c9                   	leave
+  800e8c:	c3                   	ret
+
+0000000000800e8d <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800e8d:	55                   	push   %rbp
+  800e8e:	48 89 e5             	mov    %rsp,%rbp
+  800e91:	48 83 ec 18          	sub    $0x18,%rsp
+  800e95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e9b:	89 c1                	mov    %eax,%ecx
+  800e9d:	0f 01 d0             	xgetbv
+  800ea0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ea3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800ea6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ea9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800eac:	48 c1 e2 20          	shl    $0x20,%rdx
+  800eb0:	48 09 d0             	or     %rdx,%rax
+#else
+  800eb3:	c9                   	leave
+  800eb4:	c3                   	ret
+
+0000000000800eb5 <string_cpu>:
+string_cpu(void) {
+  800eb5:	55                   	push   %rbp
+  800eb6:	48 89 e5             	mov    %rsp,%rbp
+  800eb9:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800ebd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800ec4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800ecb:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800ed2:	00 00 00 
+  800ed5:	8b 00                	mov    (%rax),%eax
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	78 11                	js     800eec <string_cpu+0x37>
+    return string_features;
+  800edb:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800ee2:	00 00 00 
+  800ee5:	8b 00                	mov    (%rax),%eax
+  800ee7:	e9 df 00 00 00       	jmp    800fcb <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800eec:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800ef0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ef6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f00:	48 89 c6             	mov    %rax,%rsi
+  800f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f08:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800f0f:	00 00 00 
+  800f12:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800f14:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f17:	83 f8 06             	cmp    $0x6,%eax
+  800f1a:	76 28                	jbe    800f44 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800f1c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800f20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2b:	48 89 c2             	mov    %rax,%rdx
+  800f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f33:	bf 07 00 00 00       	mov    $0x7,%edi
+  800f38:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800f3f:	00 00 00 
+  800f42:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800f44:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800f47:	25 00 02 00 00       	and    $0x200,%eax
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	74 04                	je     800f54 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800f50:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800f54:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800f58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f5e:	48 89 c1             	mov    %rax,%rcx
+  800f61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f66:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f70:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800f77:	00 00 00 
+  800f7a:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f7c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800f7f:	83 e0 20             	and    $0x20,%eax
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	74 2a                	je     800fb0 <string_cpu+0xfb>
+  800f86:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800f89:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f8e:	85 c0                	test   %eax,%eax
+  800f90:	74 1e                	je     800fb0 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f97:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  800f9e:	00 00 00 
+  800fa1:	ff d0                	call   *%rax
+  800fa3:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800fa6:	48 83 f8 06          	cmp    $0x6,%rax
+  800faa:	75 04                	jne    800fb0 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800fac:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800fb0:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800fb7:	00 00 00 
+  800fba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fbd:	89 02                	mov    %eax,(%rdx)
+  800fbf:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fc6:	00 00 00 
+  800fc9:	8b 00                	mov    (%rax),%eax
+}
+  800fcb:	c9                   	leave
+  800fcc:	c3                   	ret
+
+0000000000800fcd <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800fcd:	55                   	push   %rbp
+  800fce:	48 89 e5             	mov    %rsp,%rbp
+  800fd1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800fd5:	48 83 ec 60          	sub    $0x60,%rsp
+  800fd9:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800fde:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800fe3:	83 e0 1f             	and    $0x1f,%eax
+  800fe6:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800fea:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800fee:	48 f7 d8             	neg    %rax
+  800ff1:	48 89 c2             	mov    %rax,%rdx
+  800ff4:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800ff9:	48 01 d0             	add    %rdx,%rax
+  800ffc:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801001:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801005:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80100b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801010:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801014:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80101a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80101e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801022:	89 c2                	mov    %eax,%edx
+  801024:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801028:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80102d:	89 c1                	mov    %eax,%ecx
+  80102f:	d3 e6                	shl    %cl,%esi
+  801031:	89 f0                	mov    %esi,%eax
+  801033:	21 d0                	and    %edx,%eax
+  801035:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801039:	eb 21                	jmp    80105c <strlen_avx2+0x8f>
+    p += 32;
+  80103b:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801041:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801046:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80104a:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801050:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801054:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801058:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80105c:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801061:	74 d8                	je     80103b <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801063:	31 c0                	xor    %eax,%eax
+  801065:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80106b:	48 63 d0             	movslq %eax,%rdx
+  80106e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801073:	48 01 d0             	add    %rdx,%rax
+  801076:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80107b:	c9                   	leave
+  80107c:	c3                   	ret
+
+000000000080107d <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80107d:	55                   	push   %rbp
+  80107e:	48 89 e5             	mov    %rsp,%rbp
+  801081:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801085:	48 83 ec 40          	sub    $0x40,%rsp
+  801089:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80108e:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801093:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801098:	eb 77                	jmp    801111 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80109a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80109f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8010a3:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8010a7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010ac:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8010b0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010b4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010b8:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8010bc:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8010c1:	74 3c                	je     8010ff <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8010c3:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8010c7:	f7 d0                	not    %eax
+  8010c9:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8010cd:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8010d1:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8010d5:	48 63 d0             	movslq %eax,%rdx
+  8010d8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010dd:	48 01 d0             	add    %rdx,%rax
+  8010e0:	0f b6 00             	movzbl (%rax),%eax
+  8010e3:	0f b6 c0             	movzbl %al,%eax
+  8010e6:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8010ea:	48 63 ca             	movslq %edx,%rcx
+  8010ed:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8010f2:	48 01 ca             	add    %rcx,%rdx
+  8010f5:	0f b6 12             	movzbl (%rdx),%edx
+  8010f8:	0f b6 d2             	movzbl %dl,%edx
+  8010fb:	29 d0                	sub    %edx,%eax
+  8010fd:	eb 6b                	jmp    80116a <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8010ff:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801105:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80110b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801111:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801117:	77 81                	ja     80109a <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801119:	eb 42                	jmp    80115d <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80111b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801120:	0f b6 10             	movzbl (%rax),%edx
+  801123:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801128:	0f b6 00             	movzbl (%rax),%eax
+  80112b:	38 c2                	cmp    %al,%dl
+  80112d:	74 1c                	je     80114b <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80112f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801134:	0f b6 00             	movzbl (%rax),%eax
+  801137:	0f b6 c8             	movzbl %al,%ecx
+  80113a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80113f:	0f b6 00             	movzbl (%rax),%eax
+  801142:	0f b6 d0             	movzbl %al,%edx
+  801145:	89 c8                	mov    %ecx,%eax
+  801147:	29 d0                	sub    %edx,%eax
+  801149:	eb 1f                	jmp    80116a <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  80114b:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801151:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801157:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80115d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801163:	75 b6                	jne    80111b <memcmp_avx2+0x9e>
+  return 0;
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80116a:	c9                   	leave
+  80116b:	c3                   	ret
+
+000000000080116c <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80116c:	55                   	push   %rbp
+  80116d:	48 89 e5             	mov    %rsp,%rbp
+  801170:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801174:	48 83 ec 60          	sub    $0x60,%rsp
+  801178:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80117d:	89 f0                	mov    %esi,%eax
+  80117f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801184:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801188:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80118d:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801191:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801196:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80119c:	eb 47                	jmp    8011e5 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80119e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011a3:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8011a7:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8011ab:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8011b1:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8011b5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8011b9:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8011bd:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8011c2:	74 15                	je     8011d9 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8011c4:	31 c0                	xor    %eax,%eax
+  8011c6:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8011cc:	48 63 d0             	movslq %eax,%rdx
+  8011cf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011d4:	48 01 d0             	add    %rdx,%rax
+  8011d7:	eb 3d                	jmp    801216 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8011d9:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8011df:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8011e5:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8011eb:	77 b1                	ja     80119e <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8011ed:	eb 0c                	jmp    8011fb <memfind_avx2+0x8f>
+  8011ef:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8011f5:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8011fb:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801201:	74 0e                	je     801211 <memfind_avx2+0xa5>
+  801203:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801208:	0f b6 00             	movzbl (%rax),%eax
+  80120b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80120f:	75 de                	jne    8011ef <memfind_avx2+0x83>
+  return s;
+  801211:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801216:	c9                   	leave
+  801217:	c3                   	ret
+
+0000000000801218 <strlen>:
+strlen(const char *s) {
+  801218:	55                   	push   %rbp
+  801219:	48 89 e5             	mov    %rsp,%rbp
+  80121c:	48 83 ec 40          	sub    $0x40,%rsp
+  801220:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801224:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801228:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80122c:	48 b8 b5 0e 80 00 00 	movabs $0x800eb5,%rax
+  801233:	00 00 00 
+  801236:	ff d0                	call   *%rax
+  801238:	83 e0 02             	and    $0x2,%eax
+  80123b:	85 c0                	test   %eax,%eax
+  80123d:	74 18                	je     801257 <strlen+0x3f>
+    return strlen_avx2(s);
+  80123f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801243:	48 89 c7             	mov    %rax,%rdi
+  801246:	48 b8 cd 0f 80 00 00 	movabs $0x800fcd,%rax
+  80124d:	00 00 00 
+  801250:	ff d0                	call   *%rax
+  801252:	e9 82 00 00 00       	jmp    8012d9 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801257:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80125b:	83 e0 0f             	and    $0xf,%eax
+  80125e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801261:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801264:	48 f7 d8             	neg    %rax
+  801267:	48 89 c2             	mov    %rax,%rdx
+  80126a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80126e:	48 01 d0             	add    %rdx,%rax
+  801271:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801275:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801279:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80127d:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801282:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801286:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80128a:	89 c2                	mov    %eax,%edx
+  80128c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80128f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801294:	89 c1                	mov    %eax,%ecx
+  801296:	d3 e6                	shl    %cl,%esi
+  801298:	89 f0                	mov    %esi,%eax
+  80129a:	21 d0                	and    %edx,%eax
+  80129c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80129f:	eb 1d                	jmp    8012be <strlen+0xa6>
+    p += 16;
+  8012a1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8012a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012aa:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8012ae:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8012b3:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8012b7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8012bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8012be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012c2:	74 dd                	je     8012a1 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8012c4:	31 c0                	xor    %eax,%eax
+  8012c6:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8012cb:	48 63 d0             	movslq %eax,%rdx
+  8012ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d2:	48 01 d0             	add    %rdx,%rax
+  8012d5:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+00000000008012db <strnlen>:
+strnlen(const char *s, size_t size) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	48 83 ec 20          	sub    $0x20,%rsp
+  8012e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8012f2:	eb 0e                	jmp    801302 <strnlen+0x27>
+    n++;
+  8012f4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012f8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8012fd:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801302:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801307:	74 0b                	je     801314 <strnlen+0x39>
+  801309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130d:	0f b6 00             	movzbl (%rax),%eax
+  801310:	84 c0                	test   %al,%al
+  801312:	75 e0                	jne    8012f4 <strnlen+0x19>
+  return n;
+  801314:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+
+0000000000801319 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801319:	55                   	push   %rbp
+  80131a:	48 89 e5             	mov    %rsp,%rbp
+  80131d:	48 83 ec 20          	sub    $0x20,%rsp
+  801321:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801325:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801329:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80132d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801331:	90                   	nop
+  801332:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801336:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80133a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80133e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801342:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801346:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80134a:	0f b6 12             	movzbl (%rdx),%edx
+  80134d:	88 10                	mov    %dl,(%rax)
+  80134f:	0f b6 00             	movzbl (%rax),%eax
+  801352:	84 c0                	test   %al,%al
+  801354:	75 dc                	jne    801332 <strcpy+0x19>
+  return ret;
+  801356:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80135a:	c9                   	leave
+  80135b:	c3                   	ret
+
+000000000080135c <strcat>:
+strcat(char *dst, const char *src) {
+  80135c:	55                   	push   %rbp
+  80135d:	48 89 e5             	mov    %rsp,%rbp
+  801360:	48 83 ec 20          	sub    $0x20,%rsp
+  801364:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801368:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80136c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801370:	48 89 c7             	mov    %rax,%rdi
+  801373:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  80137a:	00 00 00 
+  80137d:	ff d0                	call   *%rax
+  80137f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801382:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801385:	48 63 d0             	movslq %eax,%rdx
+  801388:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80138c:	48 01 c2             	add    %rax,%rdx
+  80138f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801393:	48 89 c6             	mov    %rax,%rsi
+  801396:	48 89 d7             	mov    %rdx,%rdi
+  801399:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  8013a0:	00 00 00 
+  8013a3:	ff d0                	call   *%rax
+  return dst;
+  8013a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8013a9:	c9                   	leave
+  8013aa:	c3                   	ret
+
+00000000008013ab <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8013ab:	55                   	push   %rbp
+  8013ac:	48 89 e5             	mov    %rsp,%rbp
+  8013af:	48 83 ec 28          	sub    $0x28,%rsp
+  8013b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8013bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8013c7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8013ce:	00 
+  8013cf:	eb 2a                	jmp    8013fb <strncpy+0x50>
+    *dst++ = *src;
+  8013d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013d9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8013dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013e1:	0f b6 12             	movzbl (%rdx),%edx
+  8013e4:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8013e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013ea:	0f b6 00             	movzbl (%rax),%eax
+  8013ed:	84 c0                	test   %al,%al
+  8013ef:	74 05                	je     8013f6 <strncpy+0x4b>
+      src++;
+  8013f1:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8013f6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013ff:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801403:	72 cc                	jb     8013d1 <strncpy+0x26>
+  return ret;
+  801405:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801409:	c9                   	leave
+  80140a:	c3                   	ret
+
+000000000080140b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80140b:	55                   	push   %rbp
+  80140c:	48 89 e5             	mov    %rsp,%rbp
+  80140f:	48 83 ec 28          	sub    $0x28,%rsp
+  801413:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801417:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80141b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80141f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801423:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801427:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80142c:	74 3d                	je     80146b <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80142e:	eb 1d                	jmp    80144d <strlcpy+0x42>
+      *dst++ = *src++;
+  801430:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801434:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801438:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80143c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801440:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801444:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801448:	0f b6 12             	movzbl (%rdx),%edx
+  80144b:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80144d:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801452:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801457:	74 0b                	je     801464 <strlcpy+0x59>
+  801459:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80145d:	0f b6 00             	movzbl (%rax),%eax
+  801460:	84 c0                	test   %al,%al
+  801462:	75 cc                	jne    801430 <strlcpy+0x25>
+    *dst = '\0';
+  801464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801468:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80146b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80146f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801473:	c9                   	leave
+  801474:	c3                   	ret
+
+0000000000801475 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	48 83 ec 30          	sub    $0x30,%rsp
+  80147d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801481:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801485:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801489:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80148d:	48 89 c7             	mov    %rax,%rdi
+  801490:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  801497:	00 00 00 
+  80149a:	ff d0                	call   *%rax
+  80149c:	48 98                	cltq
+  80149e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8014a2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8014a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014aa:	48 89 d6             	mov    %rdx,%rsi
+  8014ad:	48 89 c7             	mov    %rax,%rdi
+  8014b0:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+  8014bc:	48 98                	cltq
+  8014be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8014c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014ca:	75 10                	jne    8014dc <strlcat+0x67>
+    return maxlen + srclen;
+  8014cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8014d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d4:	48 01 d0             	add    %rdx,%rax
+  8014d7:	e9 86 00 00 00       	jmp    801562 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8014dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014e0:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8014e4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8014e8:	73 2b                	jae    801515 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8014ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014f2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014fa:	48 01 c1             	add    %rax,%rcx
+  8014fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801501:	48 89 c6             	mov    %rax,%rsi
+  801504:	48 89 cf             	mov    %rcx,%rdi
+  801507:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  80150e:	00 00 00 
+  801511:	ff d0                	call   *%rax
+  801513:	eb 42                	jmp    801557 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801515:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801519:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80151d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801521:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801525:	48 01 c1             	add    %rax,%rcx
+  801528:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80152c:	48 89 c6             	mov    %rax,%rsi
+  80152f:	48 89 cf             	mov    %rcx,%rdi
+  801532:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801539:	00 00 00 
+  80153c:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80153e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801542:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801546:	48 01 d0             	add    %rdx,%rax
+  801549:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80154d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801551:	48 01 d0             	add    %rdx,%rax
+  801554:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801557:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80155b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80155f:	48 01 d0             	add    %rdx,%rax
+}
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+
+0000000000801564 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801564:	55                   	push   %rbp
+  801565:	48 89 e5             	mov    %rsp,%rbp
+  801568:	48 83 ec 10          	sub    $0x10,%rsp
+  80156c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801570:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801574:	eb 0a                	jmp    801580 <strcmp+0x1c>
+    p++, q++;
+  801576:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80157b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801584:	0f b6 00             	movzbl (%rax),%eax
+  801587:	84 c0                	test   %al,%al
+  801589:	74 12                	je     80159d <strcmp+0x39>
+  80158b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158f:	0f b6 10             	movzbl (%rax),%edx
+  801592:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801596:	0f b6 00             	movzbl (%rax),%eax
+  801599:	38 c2                	cmp    %al,%dl
+  80159b:	74 d9                	je     801576 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80159d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a1:	0f b6 00             	movzbl (%rax),%eax
+  8015a4:	0f b6 d0             	movzbl %al,%edx
+  8015a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ab:	0f b6 00             	movzbl (%rax),%eax
+  8015ae:	0f b6 c0             	movzbl %al,%eax
+  8015b1:	29 c2                	sub    %eax,%edx
+  8015b3:	89 d0                	mov    %edx,%eax
+}
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+
+00000000008015b7 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+  8015bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8015bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015c7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8015cb:	eb 0f                	jmp    8015dc <strncmp+0x25>
+    n--, p++, q++;
+  8015cd:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8015d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015d7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8015dc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015e1:	74 1d                	je     801600 <strncmp+0x49>
+  8015e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e7:	0f b6 00             	movzbl (%rax),%eax
+  8015ea:	84 c0                	test   %al,%al
+  8015ec:	74 12                	je     801600 <strncmp+0x49>
+  8015ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f2:	0f b6 10             	movzbl (%rax),%edx
+  8015f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f9:	0f b6 00             	movzbl (%rax),%eax
+  8015fc:	38 c2                	cmp    %al,%dl
+  8015fe:	74 cd                	je     8015cd <strncmp+0x16>
+  if (n == 0)
+  801600:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801605:	75 07                	jne    80160e <strncmp+0x57>
+    return 0;
+  801607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160c:	eb 16                	jmp    801624 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80160e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801612:	0f b6 00             	movzbl (%rax),%eax
+  801615:	0f b6 d0             	movzbl %al,%edx
+  801618:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161c:	0f b6 00             	movzbl (%rax),%eax
+  80161f:	0f b6 c0             	movzbl %al,%eax
+  801622:	29 c2                	sub    %eax,%edx
+}
+  801624:	89 d0                	mov    %edx,%eax
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+0000000000801628 <strchr>:
+strchr(const char *s, char c) {
+  801628:	55                   	push   %rbp
+  801629:	48 89 e5             	mov    %rsp,%rbp
+  80162c:	48 83 ec 60          	sub    $0x60,%rsp
+  801630:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801634:	89 f0                	mov    %esi,%eax
+  801636:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801639:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80163d:	83 e0 0f             	and    $0xf,%eax
+  801640:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801643:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801646:	48 f7 d8             	neg    %rax
+  801649:	48 89 c2             	mov    %rax,%rdx
+  80164c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801650:	48 01 d0             	add    %rdx,%rax
+  801653:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801657:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80165b:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80165f:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801663:	66 0f 6e c0          	movd   %eax,%xmm0
+  801667:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80166b:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80166f:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801674:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801680:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801684:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801689:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80168e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801692:	89 c2                	mov    %eax,%edx
+  801694:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801699:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80169e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8016a2:	09 c2                	or     %eax,%edx
+  8016a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8016a7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8016ac:	89 c1                	mov    %eax,%ecx
+  8016ae:	d3 e6                	shl    %cl,%esi
+  8016b0:	89 f0                	mov    %esi,%eax
+  8016b2:	21 d0                	and    %edx,%eax
+  8016b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8016b7:	eb 34                	jmp    8016ed <strchr+0xc5>
+    p += 16;
+  8016b9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8016be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c2:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8016c6:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8016ca:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8016cf:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8016d4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8016d8:	89 c2                	mov    %eax,%edx
+  8016da:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8016df:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8016e4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8016e8:	09 d0                	or     %edx,%eax
+  8016ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8016ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8016f1:	74 c6                	je     8016b9 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8016f3:	31 c0                	xor    %eax,%eax
+  8016f5:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8016fa:	48 98                	cltq
+  8016fc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801700:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801704:	0f b6 00             	movzbl (%rax),%eax
+  801707:	84 c0                	test   %al,%al
+  801709:	74 06                	je     801711 <strchr+0xe9>
+  80170b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80170f:	eb 05                	jmp    801716 <strchr+0xee>
+  801711:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801716:	c9                   	leave
+  801717:	c3                   	ret
+
+0000000000801718 <strfind>:
+strfind(const char *s, char c) {
+  801718:	55                   	push   %rbp
+  801719:	48 89 e5             	mov    %rsp,%rbp
+  80171c:	48 83 ec 10          	sub    $0x10,%rsp
+  801720:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801724:	89 f0                	mov    %esi,%eax
+  801726:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801729:	eb 11                	jmp    80173c <strfind+0x24>
+    if (*s == c)
+  80172b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172f:	0f b6 00             	movzbl (%rax),%eax
+  801732:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801735:	74 12                	je     801749 <strfind+0x31>
+  for (; *s; s++)
+  801737:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801740:	0f b6 00             	movzbl (%rax),%eax
+  801743:	84 c0                	test   %al,%al
+  801745:	75 e4                	jne    80172b <strfind+0x13>
+  801747:	eb 01                	jmp    80174a <strfind+0x32>
+      break;
+  801749:	90                   	nop
+  return (char *)s;
+  80174a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+
+0000000000801750 <memset>:
+memset(void *v, int c, size_t n) {
+  801750:	55                   	push   %rbp
+  801751:	48 89 e5             	mov    %rsp,%rbp
+  801754:	48 83 ec 38          	sub    $0x38,%rsp
+  801758:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80175c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80175f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801763:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801767:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80176b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801770:	76 41                	jbe    8017b3 <memset+0x63>
+  801772:	48 b8 b5 0e 80 00 00 	movabs $0x800eb5,%rax
+  801779:	00 00 00 
+  80177c:	ff d0                	call   *%rax
+  80177e:	83 e0 01             	and    $0x1,%eax
+  801781:	85 c0                	test   %eax,%eax
+  801783:	74 2e                	je     8017b3 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801785:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801788:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80178c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801790:	48 89 ce             	mov    %rcx,%rsi
+  801793:	48 89 f7             	mov    %rsi,%rdi
+  801796:	48 89 d1             	mov    %rdx,%rcx
+  801799:	fc                   	cld
+  80179a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80179c:	48 89 ca             	mov    %rcx,%rdx
+  80179f:	48 89 fe             	mov    %rdi,%rsi
+  8017a2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8017a6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8017aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ae:	e9 a7 00 00 00       	jmp    80185a <memset+0x10a>
+  if (n >= 8) {
+  8017b3:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8017b8:	0f 86 87 00 00 00    	jbe    801845 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8017be:	eb 16                	jmp    8017d6 <memset+0x86>
+      *p++ = c;
+  8017c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017c8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017cc:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017cf:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8017d1:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8017d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017da:	83 e0 07             	and    $0x7,%eax
+  8017dd:	48 85 c0             	test   %rax,%rax
+  8017e0:	75 de                	jne    8017c0 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8017e2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8017e5:	0f b6 c0             	movzbl %al,%eax
+  8017e8:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8017ef:	01 01 01 
+  8017f2:	48 0f af c2          	imul   %rdx,%rax
+  8017f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8017fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017fe:	48 c1 e8 03          	shr    $0x3,%rax
+  801802:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80180e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801812:	48 89 ce             	mov    %rcx,%rsi
+  801815:	48 89 f7             	mov    %rsi,%rdi
+  801818:	48 89 d1             	mov    %rdx,%rcx
+  80181b:	fc                   	cld
+  80181c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80181f:	48 89 ca             	mov    %rcx,%rdx
+  801822:	48 89 fe             	mov    %rdi,%rsi
+  801825:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801829:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80182d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801832:	eb 11                	jmp    801845 <memset+0xf5>
+    *p++ = c;
+  801834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801838:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80183c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801840:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801843:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801845:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801849:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80184d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801851:	48 85 c0             	test   %rax,%rax
+  801854:	75 de                	jne    801834 <memset+0xe4>
+  return v;
+  801856:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80185a:	c9                   	leave
+  80185b:	c3                   	ret
+
+000000000080185c <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	48 83 ec 38          	sub    $0x38,%rsp
+  801864:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801868:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80186c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801870:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801874:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801884:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801888:	0f 83 da 00 00 00    	jae    801968 <memmove+0x10c>
+  80188e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801892:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801896:	48 01 d0             	add    %rdx,%rax
+  801899:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80189d:	0f 83 c5 00 00 00    	jae    801968 <memmove+0x10c>
+    s += n;
+  8018a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8018ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018af:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8018b3:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8018b8:	0f 86 94 00 00 00    	jbe    801952 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8018be:	eb 1c                	jmp    8018dc <memmove+0x80>
+        *--d = *--s;
+  8018c0:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018c5:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ce:	0f b6 10             	movzbl (%rax),%edx
+  8018d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018d5:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8018d7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e0:	83 e0 07             	and    $0x7,%eax
+  8018e3:	48 85 c0             	test   %rax,%rax
+  8018e6:	75 d8                	jne    8018c0 <memmove+0x64>
+      nq = n / 8;
+  8018e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ec:	48 c1 e8 03          	shr    $0x3,%rax
+  8018f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018f4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8018f9:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8018fe:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801903:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801907:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80190b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190f:	48 89 cf             	mov    %rcx,%rdi
+  801912:	48 89 d6             	mov    %rdx,%rsi
+  801915:	48 89 c1             	mov    %rax,%rcx
+  801918:	fd                   	std
+  801919:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80191c:	fc                   	cld
+  80191d:	48 89 c8             	mov    %rcx,%rax
+  801920:	48 89 f2             	mov    %rsi,%rdx
+  801923:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801927:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80192b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80192f:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801934:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801939:	eb 17                	jmp    801952 <memmove+0xf6>
+      *--d = *--s;
+  80193b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801940:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801949:	0f b6 10             	movzbl (%rax),%edx
+  80194c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801950:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801952:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801956:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80195a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80195e:	48 85 c0             	test   %rax,%rax
+  801961:	75 d8                	jne    80193b <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801963:	e9 f4 00 00 00       	jmp    801a5c <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801968:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80196d:	76 46                	jbe    8019b5 <memmove+0x159>
+  80196f:	48 b8 b5 0e 80 00 00 	movabs $0x800eb5,%rax
+  801976:	00 00 00 
+  801979:	ff d0                	call   *%rax
+  80197b:	83 e0 01             	and    $0x1,%eax
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	74 33                	je     8019b5 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801982:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801986:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80198a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198e:	48 89 cf             	mov    %rcx,%rdi
+  801991:	48 89 d6             	mov    %rdx,%rsi
+  801994:	48 89 c1             	mov    %rax,%rcx
+  801997:	fc                   	cld
+  801998:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80199a:	48 89 c8             	mov    %rcx,%rax
+  80199d:	48 89 f2             	mov    %rsi,%rdx
+  8019a0:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019a4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8019ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b0:	e9 ab 00 00 00       	jmp    801a60 <memmove+0x204>
+    if (n >= 8) {
+  8019b5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8019ba:	0f 86 8b 00 00 00    	jbe    801a4b <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8019c0:	eb 22                	jmp    8019e4 <memmove+0x188>
+        *d++ = *s++;
+  8019c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019c6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019d6:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019da:	0f b6 12             	movzbl (%rdx),%edx
+  8019dd:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8019df:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8019e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019e8:	83 e0 07             	and    $0x7,%eax
+  8019eb:	48 85 c0             	test   %rax,%rax
+  8019ee:	75 d2                	jne    8019c2 <memmove+0x166>
+      nq = n / 8;
+  8019f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019f4:	48 c1 e8 03          	shr    $0x3,%rax
+  8019f8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8019fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a08:	48 89 cf             	mov    %rcx,%rdi
+  801a0b:	48 89 d6             	mov    %rdx,%rsi
+  801a0e:	48 89 c1             	mov    %rax,%rcx
+  801a11:	fc                   	cld
+  801a12:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a15:	48 89 c8             	mov    %rcx,%rax
+  801a18:	48 89 f2             	mov    %rsi,%rdx
+  801a1b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a1f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801a27:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801a2c:	eb 1d                	jmp    801a4b <memmove+0x1ef>
+      *d++ = *s++;
+  801a2e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a32:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a3e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a42:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801a46:	0f b6 12             	movzbl (%rdx),%edx
+  801a49:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a4f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a53:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a57:	48 85 c0             	test   %rax,%rax
+  801a5a:	75 d2                	jne    801a2e <memmove+0x1d2>
+  return dst;
+  801a5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a60:	c9                   	leave
+  801a61:	c3                   	ret
+
+0000000000801a62 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a62:	55                   	push   %rbp
+  801a63:	48 89 e5             	mov    %rsp,%rbp
+  801a66:	48 83 ec 18          	sub    $0x18,%rsp
+  801a6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a72:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801a76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a7a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a82:	48 89 ce             	mov    %rcx,%rsi
+  801a85:	48 89 c7             	mov    %rax,%rdi
+  801a88:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+}
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+
+0000000000801a96 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a96:	55                   	push   %rbp
+  801a97:	48 89 e5             	mov    %rsp,%rbp
+  801a9a:	48 83 ec 40          	sub    $0x40,%rsp
+  801a9e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801aa2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801aa6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801aaa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801ab2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ab6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801aba:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801abf:	0f 86 a7 00 00 00    	jbe    801b6c <memcmp+0xd6>
+  801ac5:	48 b8 b5 0e 80 00 00 	movabs $0x800eb5,%rax
+  801acc:	00 00 00 
+  801acf:	ff d0                	call   *%rax
+  801ad1:	83 e0 02             	and    $0x2,%eax
+  801ad4:	85 c0                	test   %eax,%eax
+  801ad6:	0f 84 90 00 00 00    	je     801b6c <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801adc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ae0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ae4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae8:	48 89 ce             	mov    %rcx,%rsi
+  801aeb:	48 89 c7             	mov    %rax,%rdi
+  801aee:	48 b8 7d 10 80 00 00 	movabs $0x80107d,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+  801afa:	e9 c2 00 00 00       	jmp    801bc1 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b03:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b07:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b0f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b13:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b17:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801b1e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801b25:	74 36                	je     801b5d <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801b27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b2a:	f7 d0                	not    %eax
+  801b2c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801b30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801b33:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801b36:	48 63 d0             	movslq %eax,%rdx
+  801b39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b3d:	48 01 d0             	add    %rdx,%rax
+  801b40:	0f b6 00             	movzbl (%rax),%eax
+  801b43:	0f b6 c0             	movzbl %al,%eax
+  801b46:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801b49:	48 63 ca             	movslq %edx,%rcx
+  801b4c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b50:	48 01 ca             	add    %rcx,%rdx
+  801b53:	0f b6 12             	movzbl (%rdx),%edx
+  801b56:	0f b6 d2             	movzbl %dl,%edx
+  801b59:	29 d0                	sub    %edx,%eax
+  801b5b:	eb 64                	jmp    801bc1 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801b5d:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801b62:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801b67:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801b6c:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801b71:	77 8c                	ja     801aff <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801b73:	eb 36                	jmp    801bab <memcmp+0x115>
+    if (*s1 != *s2)
+  801b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b79:	0f b6 10             	movzbl (%rax),%edx
+  801b7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b80:	0f b6 00             	movzbl (%rax),%eax
+  801b83:	38 c2                	cmp    %al,%dl
+  801b85:	74 1a                	je     801ba1 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801b87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b8b:	0f b6 00             	movzbl (%rax),%eax
+  801b8e:	0f b6 c8             	movzbl %al,%ecx
+  801b91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b95:	0f b6 00             	movzbl (%rax),%eax
+  801b98:	0f b6 d0             	movzbl %al,%edx
+  801b9b:	89 c8                	mov    %ecx,%eax
+  801b9d:	29 d0                	sub    %edx,%eax
+  801b9f:	eb 20                	jmp    801bc1 <memcmp+0x12b>
+    s1++, s2++;
+  801ba1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ba6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801bab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801baf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bb3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bb7:	48 85 c0             	test   %rax,%rax
+  801bba:	75 b9                	jne    801b75 <memcmp+0xdf>
+  }
+
+  return 0;
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bc1:	c9                   	leave
+  801bc2:	c3                   	ret
+
+0000000000801bc3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801bc3:	55                   	push   %rbp
+  801bc4:	48 89 e5             	mov    %rsp,%rbp
+  801bc7:	48 83 ec 50          	sub    $0x50,%rsp
+  801bcb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801bcf:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801bd2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801bd6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bda:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801bde:	48 01 d0             	add    %rdx,%rax
+  801be1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801be5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801be8:	66 0f 6e c0          	movd   %eax,%xmm0
+  801bec:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801bf0:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801bf4:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801bf9:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801bfd:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801c02:	76 73                	jbe    801c77 <memfind+0xb4>
+  801c04:	48 b8 b5 0e 80 00 00 	movabs $0x800eb5,%rax
+  801c0b:	00 00 00 
+  801c0e:	ff d0                	call   *%rax
+  801c10:	83 e0 02             	and    $0x2,%eax
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	74 60                	je     801c77 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801c17:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801c1a:	0f b6 c8             	movzbl %al,%ecx
+  801c1d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801c21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c25:	89 ce                	mov    %ecx,%esi
+  801c27:	48 89 c7             	mov    %rax,%rdi
+  801c2a:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  801c31:	00 00 00 
+  801c34:	ff d0                	call   *%rax
+  801c36:	eb 6c                	jmp    801ca4 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801c38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c3c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801c40:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801c44:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801c49:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801c4d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801c51:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801c54:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801c58:	74 13                	je     801c6d <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801c5a:	31 c0                	xor    %eax,%eax
+  801c5c:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801c61:	48 63 d0             	movslq %eax,%rdx
+  801c64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c68:	48 01 d0             	add    %rdx,%rax
+  801c6b:	eb 37                	jmp    801ca4 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801c6d:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801c72:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801c77:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801c7c:	77 ba                	ja     801c38 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801c7e:	eb 13                	jmp    801c93 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801c80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c84:	0f b6 00             	movzbl (%rax),%eax
+  801c87:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801c8a:	38 d0                	cmp    %dl,%al
+  801c8c:	74 11                	je     801c9f <memfind+0xdc>
+  for (; s < ends; s++)
+  801c8e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c97:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c9b:	72 e3                	jb     801c80 <memfind+0xbd>
+  801c9d:	eb 01                	jmp    801ca0 <memfind+0xdd>
+      break;
+  801c9f:	90                   	nop
+  return (void *)s;
+  801ca0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+
+0000000000801ca6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801ca6:	55                   	push   %rbp
+  801ca7:	48 89 e5             	mov    %rsp,%rbp
+  801caa:	48 83 ec 38          	sub    $0x38,%rsp
+  801cae:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cb2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cb6:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801cb9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801cc0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801cc7:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801cc8:	eb 05                	jmp    801ccf <strtol+0x29>
+    s++;
+  801cca:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801ccf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd3:	0f b6 00             	movzbl (%rax),%eax
+  801cd6:	3c 20                	cmp    $0x20,%al
+  801cd8:	74 f0                	je     801cca <strtol+0x24>
+  801cda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cde:	0f b6 00             	movzbl (%rax),%eax
+  801ce1:	3c 09                	cmp    $0x9,%al
+  801ce3:	74 e5                	je     801cca <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801ce5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce9:	0f b6 00             	movzbl (%rax),%eax
+  801cec:	3c 2b                	cmp    $0x2b,%al
+  801cee:	75 07                	jne    801cf7 <strtol+0x51>
+    s++;
+  801cf0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cf5:	eb 17                	jmp    801d0e <strtol+0x68>
+  else if (*s == '-')
+  801cf7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfb:	0f b6 00             	movzbl (%rax),%eax
+  801cfe:	3c 2d                	cmp    $0x2d,%al
+  801d00:	75 0c                	jne    801d0e <strtol+0x68>
+    s++, neg = 1;
+  801d02:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d07:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801d0e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d12:	74 06                	je     801d1a <strtol+0x74>
+  801d14:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d18:	75 28                	jne    801d42 <strtol+0x9c>
+  801d1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d1e:	0f b6 00             	movzbl (%rax),%eax
+  801d21:	3c 30                	cmp    $0x30,%al
+  801d23:	75 1d                	jne    801d42 <strtol+0x9c>
+  801d25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d29:	48 83 c0 01          	add    $0x1,%rax
+  801d2d:	0f b6 00             	movzbl (%rax),%eax
+  801d30:	3c 78                	cmp    $0x78,%al
+  801d32:	75 0e                	jne    801d42 <strtol+0x9c>
+    s += 2, base = 16;
+  801d34:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801d39:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801d40:	eb 2c                	jmp    801d6e <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801d42:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d46:	75 19                	jne    801d61 <strtol+0xbb>
+  801d48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4c:	0f b6 00             	movzbl (%rax),%eax
+  801d4f:	3c 30                	cmp    $0x30,%al
+  801d51:	75 0e                	jne    801d61 <strtol+0xbb>
+    s++, base = 8;
+  801d53:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d58:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d5f:	eb 0d                	jmp    801d6e <strtol+0xc8>
+  else if (base == 0)
+  801d61:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d65:	75 07                	jne    801d6e <strtol+0xc8>
+    base = 10;
+  801d67:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801d6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d72:	0f b6 00             	movzbl (%rax),%eax
+  801d75:	3c 2f                	cmp    $0x2f,%al
+  801d77:	7e 1d                	jle    801d96 <strtol+0xf0>
+  801d79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7d:	0f b6 00             	movzbl (%rax),%eax
+  801d80:	3c 39                	cmp    $0x39,%al
+  801d82:	7f 12                	jg     801d96 <strtol+0xf0>
+      dig = *s - '0';
+  801d84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d88:	0f b6 00             	movzbl (%rax),%eax
+  801d8b:	0f be c0             	movsbl %al,%eax
+  801d8e:	83 e8 30             	sub    $0x30,%eax
+  801d91:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d94:	eb 4e                	jmp    801de4 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d9a:	0f b6 00             	movzbl (%rax),%eax
+  801d9d:	3c 60                	cmp    $0x60,%al
+  801d9f:	7e 1d                	jle    801dbe <strtol+0x118>
+  801da1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da5:	0f b6 00             	movzbl (%rax),%eax
+  801da8:	3c 7a                	cmp    $0x7a,%al
+  801daa:	7f 12                	jg     801dbe <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801dac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db0:	0f b6 00             	movzbl (%rax),%eax
+  801db3:	0f be c0             	movsbl %al,%eax
+  801db6:	83 e8 57             	sub    $0x57,%eax
+  801db9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801dbc:	eb 26                	jmp    801de4 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801dbe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc2:	0f b6 00             	movzbl (%rax),%eax
+  801dc5:	3c 40                	cmp    $0x40,%al
+  801dc7:	7e 47                	jle    801e10 <strtol+0x16a>
+  801dc9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dcd:	0f b6 00             	movzbl (%rax),%eax
+  801dd0:	3c 5a                	cmp    $0x5a,%al
+  801dd2:	7f 3c                	jg     801e10 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801dd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd8:	0f b6 00             	movzbl (%rax),%eax
+  801ddb:	0f be c0             	movsbl %al,%eax
+  801dde:	83 e8 37             	sub    $0x37,%eax
+  801de1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801de4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801de7:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801dea:	7d 23                	jge    801e0f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801dec:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801df1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801df4:	48 98                	cltq
+  801df6:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801dfb:	48 89 c2             	mov    %rax,%rdx
+  801dfe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e01:	48 98                	cltq
+  801e03:	48 01 d0             	add    %rdx,%rax
+  801e06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801e0a:	e9 5f ff ff ff       	jmp    801d6e <strtol+0xc8>
+      break;
+  801e0f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801e10:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e15:	74 0b                	je     801e22 <strtol+0x17c>
+    *endptr = (char *)s;
+  801e17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e1b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e1f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801e22:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e26:	74 09                	je     801e31 <strtol+0x18b>
+  801e28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e2c:	48 f7 d8             	neg    %rax
+  801e2f:	eb 04                	jmp    801e35 <strtol+0x18f>
+  801e31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e35:	c9                   	leave
+  801e36:	c3                   	ret
+
+0000000000801e37 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 48          	sub    $0x48,%rsp
+  801e40:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e44:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e48:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e4c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801e50:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801e54:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801e58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e5c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e60:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801e64:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801e68:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e6c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e70:	4c 89 c3             	mov    %r8,%rbx
+  801e73:	cd 30                	int    $0x30
+  801e75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801e79:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e7e:	74 46                	je     801ec6 <syscall+0x8f>
+  801e80:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e85:	7e 3f                	jle    801ec6 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801e87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e8f:	49 89 d0             	mov    %rdx,%r8
+  801e92:	48 89 c1             	mov    %rax,%rcx
+  801e95:	48 b8 88 5c 80 00 00 	movabs $0x805c88,%rax
+  801e9c:	00 00 00 
+  801e9f:	48 89 c2             	mov    %rax,%rdx
+  801ea2:	be 22 00 00 00       	mov    $0x22,%esi
+  801ea7:	48 b8 a7 5c 80 00 00 	movabs $0x805ca7,%rax
+  801eae:	00 00 00 
+  801eb1:	48 89 c7             	mov    %rax,%rdi
+  801eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb9:	49 b9 72 52 80 00 00 	movabs $0x805272,%r9
+  801ec0:	00 00 00 
+  801ec3:	41 ff d1             	call   *%r9
+
+  return ret;
+  801ec6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801eca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ece:	c9                   	leave
+  801ecf:	c3                   	ret
+
+0000000000801ed0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801ed0:	55                   	push   %rbp
+  801ed1:	48 89 e5             	mov    %rsp,%rbp
+  801ed4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801edc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ee0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ee8:	48 83 ec 08          	sub    $0x8,%rsp
+  801eec:	6a 00                	push   $0x0
+  801eee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ef4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801efa:	48 89 d1             	mov    %rdx,%rcx
+  801efd:	48 89 c2             	mov    %rax,%rdx
+  801f00:	be 00 00 00 00       	mov    $0x0,%esi
+  801f05:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0a:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801f11:	00 00 00 
+  801f14:	ff d0                	call   *%rax
+  801f16:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f1a:	90                   	nop
+  801f1b:	c9                   	leave
+  801f1c:	c3                   	ret
+
+0000000000801f1d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801f1d:	55                   	push   %rbp
+  801f1e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f21:	48 83 ec 08          	sub    $0x8,%rsp
+  801f25:	6a 00                	push   $0x0
+  801f27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f42:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f47:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f57:	c9                   	leave
+  801f58:	c3                   	ret
+
+0000000000801f59 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+  801f5d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f61:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f67:	48 98                	cltq
+  801f69:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6d:	6a 00                	push   $0x0
+  801f6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f80:	48 89 c2             	mov    %rax,%rdx
+  801f83:	be 01 00 00 00       	mov    $0x1,%esi
+  801f88:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f8d:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+  801f99:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+
+0000000000801f9f <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f9f:	55                   	push   %rbp
+  801fa0:	48 89 e5             	mov    %rsp,%rbp
+  801fa3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801faa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fad:	48 98                	cltq
+  801faf:	48 83 ec 08          	sub    $0x8,%rsp
+  801fb3:	6a 00                	push   $0x0
+  801fb5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fbb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fc6:	48 89 c2             	mov    %rax,%rdx
+  801fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fce:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fd3:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe3:	90                   	nop
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+0000000000801fe6 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801fe6:	55                   	push   %rbp
+  801fe7:	48 89 e5             	mov    %rsp,%rbp
+  801fea:	48 83 ec 20          	sub    $0x20,%rsp
+  801fee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801ff1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801ff5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ff8:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801ffb:	b8 05 00 00 00       	mov    $0x5,%eax
+  802000:	cd 30                	int    $0x30
+  802002:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802006:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80200a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80200f:	7e 3d                	jle    80204e <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802011:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802015:	49 89 c0             	mov    %rax,%r8
+  802018:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80201d:	48 b8 88 5c 80 00 00 	movabs $0x805c88,%rax
+  802024:	00 00 00 
+  802027:	48 89 c2             	mov    %rax,%rdx
+  80202a:	be 49 00 00 00       	mov    $0x49,%esi
+  80202f:	48 b8 a7 5c 80 00 00 	movabs $0x805ca7,%rax
+  802036:	00 00 00 
+  802039:	48 89 c7             	mov    %rax,%rdi
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802041:	49 b9 72 52 80 00 00 	movabs $0x805272,%r9
+  802048:	00 00 00 
+  80204b:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80204e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802053:	75 13                	jne    802068 <sys_env_wait+0x82>
+  802055:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80205a:	74 0c                	je     802068 <sys_env_wait+0x82>
+    *status = st;
+  80205c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802060:	89 c2                	mov    %eax,%edx
+  802062:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802066:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802068:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80206c:	c9                   	leave
+  80206d:	c3                   	ret
+
+000000000080206e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80206e:	55                   	push   %rbp
+  80206f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802072:	48 83 ec 08          	sub    $0x8,%rsp
+  802076:	6a 00                	push   $0x0
+  802078:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80207e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802084:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208e:	be 00 00 00 00       	mov    $0x0,%esi
+  802093:	bf 02 00 00 00       	mov    $0x2,%edi
+  802098:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+  8020a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a8:	c9                   	leave
+  8020a9:	c3                   	ret
+
+00000000008020aa <sys_yield>:
+
+void
+sys_yield(void) {
+  8020aa:	55                   	push   %rbp
+  8020ab:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8020ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b2:	6a 00                	push   $0x0
+  8020b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cf:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8020d4:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e4:	90                   	nop
+  8020e5:	c9                   	leave
+  8020e6:	c3                   	ret
+
+00000000008020e7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8020e7:	55                   	push   %rbp
+  8020e8:	48 89 e5             	mov    %rsp,%rbp
+  8020eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8020ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8020f6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8020f9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8020fc:	48 63 c8             	movslq %eax,%rcx
+  8020ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802103:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802106:	48 98                	cltq
+  802108:	48 83 ec 08          	sub    $0x8,%rsp
+  80210c:	6a 00                	push   $0x0
+  80210e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802114:	49 89 c8             	mov    %rcx,%r8
+  802117:	48 89 d1             	mov    %rdx,%rcx
+  80211a:	48 89 c2             	mov    %rax,%rdx
+  80211d:	be 01 00 00 00       	mov    $0x1,%esi
+  802122:	bf 06 00 00 00       	mov    $0x6,%edi
+  802127:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+  802133:	48 83 c4 10          	add    $0x10,%rsp
+  802137:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80213a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+
+000000000080213f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80213f:	55                   	push   %rbp
+  802140:	48 89 e5             	mov    %rsp,%rbp
+  802143:	48 83 ec 20          	sub    $0x20,%rsp
+  802147:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80214a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80214e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802151:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802155:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802159:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80215c:	48 63 c8             	movslq %eax,%rcx
+  80215f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802163:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802166:	48 63 f0             	movslq %eax,%rsi
+  802169:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80216d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802170:	48 98                	cltq
+  802172:	48 83 ec 08          	sub    $0x8,%rsp
+  802176:	51                   	push   %rcx
+  802177:	49 89 f9             	mov    %rdi,%r9
+  80217a:	49 89 f0             	mov    %rsi,%r8
+  80217d:	48 89 d1             	mov    %rdx,%rcx
+  802180:	48 89 c2             	mov    %rax,%rdx
+  802183:	be 01 00 00 00       	mov    $0x1,%esi
+  802188:	bf 07 00 00 00       	mov    $0x7,%edi
+  80218d:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802194:	00 00 00 
+  802197:	ff d0                	call   *%rax
+  802199:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+
+000000000080219f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8021ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021b5:	48 98                	cltq
+  8021b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021bb:	6a 00                	push   $0x0
+  8021bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c9:	48 89 d1             	mov    %rdx,%rcx
+  8021cc:	48 89 c2             	mov    %rax,%rdx
+  8021cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021d9:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+  8021e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+00000000008021eb <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8021f9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021fc:	48 63 d0             	movslq %eax,%rdx
+  8021ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802202:	48 98                	cltq
+  802204:	48 83 ec 08          	sub    $0x8,%rsp
+  802208:	6a 00                	push   $0x0
+  80220a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802216:	48 89 d1             	mov    %rdx,%rcx
+  802219:	48 89 c2             	mov    %rax,%rdx
+  80221c:	be 01 00 00 00       	mov    $0x1,%esi
+  802221:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802226:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80222d:	00 00 00 
+  802230:	ff d0                	call   *%rax
+  802232:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+
+0000000000802238 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	48 83 ec 10          	sub    $0x10,%rsp
+  802240:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802243:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802247:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80224b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80224e:	48 98                	cltq
+  802250:	48 83 ec 08          	sub    $0x8,%rsp
+  802254:	6a 00                	push   $0x0
+  802256:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80225c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802262:	48 89 d1             	mov    %rdx,%rcx
+  802265:	48 89 c2             	mov    %rax,%rdx
+  802268:	be 01 00 00 00       	mov    $0x1,%esi
+  80226d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802272:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+  80227e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802282:	c9                   	leave
+  802283:	c3                   	ret
+
+0000000000802284 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802284:	55                   	push   %rbp
+  802285:	48 89 e5             	mov    %rsp,%rbp
+  802288:	48 83 ec 10          	sub    $0x10,%rsp
+  80228c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80228f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802293:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802297:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80229a:	48 98                	cltq
+  80229c:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a0:	6a 00                	push   $0x0
+  8022a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ae:	48 89 d1             	mov    %rdx,%rcx
+  8022b1:	48 89 c2             	mov    %rax,%rdx
+  8022b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022be:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8022c5:	00 00 00 
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+00000000008022d0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+  8022d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8022d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022e3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8022e6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022e9:	48 63 f0             	movslq %eax,%rsi
+  8022ec:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8022f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022f7:	48 98                	cltq
+  8022f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	49 89 f1             	mov    %rsi,%r9
+  802302:	49 89 c8             	mov    %rcx,%r8
+  802305:	48 89 d1             	mov    %rdx,%rcx
+  802308:	48 89 c2             	mov    %rax,%rdx
+  80230b:	be 00 00 00 00       	mov    $0x0,%esi
+  802310:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802315:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802325:	c9                   	leave
+  802326:	c3                   	ret
+
+0000000000802327 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802327:	55                   	push   %rbp
+  802328:	48 89 e5             	mov    %rsp,%rbp
+  80232b:	48 83 ec 10          	sub    $0x10,%rsp
+  80232f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802337:	48 83 ec 08          	sub    $0x8,%rsp
+  80233b:	6a 00                	push   $0x0
+  80233d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802349:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80234e:	48 89 c2             	mov    %rax,%rdx
+  802351:	be 01 00 00 00       	mov    $0x1,%esi
+  802356:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80235b:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+000000000080236d <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80236d:	55                   	push   %rbp
+  80236e:	48 89 e5             	mov    %rsp,%rbp
+  802371:	48 83 ec 10          	sub    $0x10,%rsp
+  802375:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802379:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80237d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802381:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802385:	48 83 ec 08          	sub    $0x8,%rsp
+  802389:	6a 00                	push   $0x0
+  80238b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802391:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802397:	48 89 d1             	mov    %rdx,%rcx
+  80239a:	48 89 c2             	mov    %rax,%rdx
+  80239d:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8023a7:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8023ae:	00 00 00 
+  8023b1:	ff d0                	call   *%rax
+  8023b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b7:	c9                   	leave
+  8023b8:	c3                   	ret
+
+00000000008023b9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8023b9:	55                   	push   %rbp
+  8023ba:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8023bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c1:	6a 00                	push   $0x0
+  8023c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023de:	bf 11 00 00 00       	mov    $0x11,%edi
+  8023e3:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+  8023ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023f3:	c9                   	leave
+  8023f4:	c3                   	ret
+
+00000000008023f5 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8023f5:	55                   	push   %rbp
+  8023f6:	48 89 e5             	mov    %rsp,%rbp
+  8023f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8023fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802401:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802405:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80240d:	48 83 ec 08          	sub    $0x8,%rsp
+  802411:	6a 00                	push   $0x0
+  802413:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802419:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80241f:	48 89 d1             	mov    %rdx,%rcx
+  802422:	48 89 c2             	mov    %rax,%rdx
+  802425:	be 00 00 00 00       	mov    $0x0,%esi
+  80242a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80242f:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802436:	00 00 00 
+  802439:	ff d0                	call   *%rax
+  80243b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243f:	c9                   	leave
+  802440:	c3                   	ret
+
+0000000000802441 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802441:	55                   	push   %rbp
+  802442:	48 89 e5             	mov    %rsp,%rbp
+  802445:	48 83 ec 20          	sub    $0x20,%rsp
+  802449:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80244d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802451:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802454:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802457:	48 63 c8             	movslq %eax,%rcx
+  80245a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80245e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802462:	48 83 ec 08          	sub    $0x8,%rsp
+  802466:	6a 00                	push   $0x0
+  802468:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80246e:	49 89 c8             	mov    %rcx,%r8
+  802471:	48 89 d1             	mov    %rdx,%rcx
+  802474:	48 89 c2             	mov    %rax,%rdx
+  802477:	be 00 00 00 00       	mov    $0x0,%esi
+  80247c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802481:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802488:	00 00 00 
+  80248b:	ff d0                	call   *%rax
+  80248d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802491:	c9                   	leave
+  802492:	c3                   	ret
+
+0000000000802493 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802493:	55                   	push   %rbp
+  802494:	48 89 e5             	mov    %rsp,%rbp
+  802497:	48 83 ec 20          	sub    $0x20,%rsp
+  80249b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80249f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8024a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8024aa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8024ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b5:	6a 00                	push   $0x0
+  8024b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024bd:	49 89 c8             	mov    %rcx,%r8
+  8024c0:	48 89 d1             	mov    %rdx,%rcx
+  8024c3:	48 89 c2             	mov    %rax,%rdx
+  8024c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cb:	bf 14 00 00 00       	mov    $0x14,%edi
+  8024d0:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+
+00000000008024e2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024ee:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8024f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024f4:	48 63 d0             	movslq %eax,%rdx
+  8024f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ff:	6a 00                	push   $0x0
+  802501:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802507:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80250d:	48 89 d1             	mov    %rdx,%rcx
+  802510:	48 89 c2             	mov    %rax,%rdx
+  802513:	be 00 00 00 00       	mov    $0x0,%esi
+  802518:	bf 15 00 00 00       	mov    $0x15,%edi
+  80251d:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802524:	00 00 00 
+  802527:	ff d0                	call   *%rax
+  802529:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80252d:	c9                   	leave
+  80252e:	c3                   	ret
+
+000000000080252f <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80252f:	55                   	push   %rbp
+  802530:	48 89 e5             	mov    %rsp,%rbp
+  802533:	48 83 ec 20          	sub    $0x20,%rsp
+  802537:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80253b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80253e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802541:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802545:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802549:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80254c:	48 63 c8             	movslq %eax,%rcx
+  80254f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802552:	48 63 d0             	movslq %eax,%rdx
+  802555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802559:	48 83 ec 08          	sub    $0x8,%rsp
+  80255d:	6a 00                	push   $0x0
+  80255f:	49 89 f1             	mov    %rsi,%r9
+  802562:	49 89 c8             	mov    %rcx,%r8
+  802565:	48 89 d1             	mov    %rdx,%rcx
+  802568:	48 89 c2             	mov    %rax,%rdx
+  80256b:	be 00 00 00 00       	mov    $0x0,%esi
+  802570:	bf 16 00 00 00       	mov    $0x16,%edi
+  802575:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+  802581:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+0000000000802587 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802587:	55                   	push   %rbp
+  802588:	48 89 e5             	mov    %rsp,%rbp
+  80258b:	48 83 ec 30          	sub    $0x30,%rsp
+  80258f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802593:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802597:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80259b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80259f:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8025a3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025a7:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8025ab:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bb:	51                   	push   %rcx
+  8025bc:	49 89 f9             	mov    %rdi,%r9
+  8025bf:	49 89 f0             	mov    %rsi,%r8
+  8025c2:	48 89 d1             	mov    %rdx,%rcx
+  8025c5:	48 89 c2             	mov    %rax,%rdx
+  8025c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cd:	bf 17 00 00 00       	mov    $0x17,%edi
+  8025d2:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+  8025de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e2:	c9                   	leave
+  8025e3:	c3                   	ret
+
+00000000008025e4 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8025e4:	55                   	push   %rbp
+  8025e5:	48 89 e5             	mov    %rsp,%rbp
+  8025e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8025ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025f2:	48 98                	cltq
+  8025f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f8:	6a 00                	push   $0x0
+  8025fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80260b:	48 89 c2             	mov    %rax,%rdx
+  80260e:	be 00 00 00 00       	mov    $0x0,%esi
+  802613:	bf 18 00 00 00       	mov    $0x18,%edi
+  802618:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+  802624:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802628:	90                   	nop
+  802629:	c9                   	leave
+  80262a:	c3                   	ret
+
+000000000080262b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	48 83 ec 30          	sub    $0x30,%rsp
+  802633:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802636:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80263a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80263e:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802641:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802644:	48 63 f0             	movslq %eax,%rsi
+  802647:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80264b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80264f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802652:	48 98                	cltq
+  802654:	48 83 ec 08          	sub    $0x8,%rsp
+  802658:	6a 00                	push   $0x0
+  80265a:	49 89 f1             	mov    %rsi,%r9
+  80265d:	49 89 c8             	mov    %rcx,%r8
+  802660:	48 89 d1             	mov    %rdx,%rcx
+  802663:	48 89 c2             	mov    %rax,%rdx
+  802666:	be 01 00 00 00       	mov    $0x1,%esi
+  80266b:	bf 19 00 00 00       	mov    $0x19,%edi
+  802670:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+  80267c:	48 83 c4 10          	add    $0x10,%rsp
+  802680:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802683:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802686:	c9                   	leave
+  802687:	c3                   	ret
+
+0000000000802688 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802688:	55                   	push   %rbp
+  802689:	48 89 e5             	mov    %rsp,%rbp
+  80268c:	48 83 ec 20          	sub    $0x20,%rsp
+  802690:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802694:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802698:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80269b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80269e:	48 63 c8             	movslq %eax,%rcx
+  8026a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ad:	6a 00                	push   $0x0
+  8026af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b5:	49 89 c8             	mov    %rcx,%r8
+  8026b8:	48 89 d1             	mov    %rdx,%rcx
+  8026bb:	48 89 c2             	mov    %rax,%rdx
+  8026be:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c3:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8026c8:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8026cf:	00 00 00 
+  8026d2:	ff d0                	call   *%rax
+  8026d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d8:	c9                   	leave
+  8026d9:	c3                   	ret
+
+00000000008026da <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8026da:	55                   	push   %rbp
+  8026db:	48 89 e5             	mov    %rsp,%rbp
+  8026de:	48 83 ec 20          	sub    $0x20,%rsp
+  8026e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8026ee:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8026fe:	6a 00                	push   $0x0
+  802700:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802706:	49 89 c8             	mov    %rcx,%r8
+  802709:	48 89 d1             	mov    %rdx,%rcx
+  80270c:	48 89 c2             	mov    %rax,%rdx
+  80270f:	be 01 00 00 00       	mov    $0x1,%esi
+  802714:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802719:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+000000000080272b <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+  80272f:	48 83 ec 30          	sub    $0x30,%rsp
+  802733:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802737:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80273b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  80273e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802742:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802746:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802749:	48 63 c8             	movslq %eax,%rcx
+  80274c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802754:	48 83 ec 08          	sub    $0x8,%rsp
+  802758:	6a 00                	push   $0x0
+  80275a:	49 89 f1             	mov    %rsi,%r9
+  80275d:	49 89 c8             	mov    %rcx,%r8
+  802760:	48 89 d1             	mov    %rdx,%rcx
+  802763:	48 89 c2             	mov    %rax,%rdx
+  802766:	be 01 00 00 00       	mov    $0x1,%esi
+  80276b:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802770:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  802777:	00 00 00 
+  80277a:	ff d0                	call   *%rax
+  80277c:	48 83 c4 10          	add    $0x10,%rsp
+  802780:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802783:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802786:	c9                   	leave
+  802787:	c3                   	ret
+
+0000000000802788 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802788:	55                   	push   %rbp
+  802789:	48 89 e5             	mov    %rsp,%rbp
+  80278c:	48 83 ec 10          	sub    $0x10,%rsp
+  802790:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802793:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802796:	48 98                	cltq
+  802798:	48 83 ec 08          	sub    $0x8,%rsp
+  80279c:	6a 00                	push   $0x0
+  80279e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027af:	48 89 c2             	mov    %rax,%rdx
+  8027b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b7:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8027bc:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027cc:	c9                   	leave
+  8027cd:	c3                   	ret
+
+00000000008027ce <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+  8027ce:	55                   	push   %rbp
+  8027cf:	48 89 e5             	mov    %rsp,%rbp
+  8027d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027de:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  args->argc     = argc;
+  8027e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027ea:	48 89 10             	mov    %rdx,(%rax)
+  args->argv     = (const char **)argv;
+  8027ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027f5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  args->curarg   = (*argc > 1 && argv ? "" : 0);
+  8027f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027fd:	8b 00                	mov    (%rax),%eax
+  8027ff:	83 f8 01             	cmp    $0x1,%eax
+  802802:	7e 13                	jle    802817 <argstart+0x49>
+  802804:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802809:	74 0c                	je     802817 <argstart+0x49>
+  80280b:	48 ba b5 5c 80 00 00 	movabs $0x805cb5,%rdx
+  802812:	00 00 00 
+  802815:	eb 05                	jmp    80281c <argstart+0x4e>
+  802817:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802820:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  args->argvalue = 0;
+  802824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802828:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  80282f:	00 
+}
+  802830:	90                   	nop
+  802831:	c9                   	leave
+  802832:	c3                   	ret
+
+0000000000802833 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+  802833:	55                   	push   %rbp
+  802834:	48 89 e5             	mov    %rsp,%rbp
+  802837:	48 83 ec 20          	sub    $0x20,%rsp
+  80283b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int arg;
+
+  args->argvalue = 0;
+  80283f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802843:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  80284a:	00 
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  80284b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802853:	48 85 c0             	test   %rax,%rax
+  802856:	75 0a                	jne    802862 <argnext+0x2f>
+    return -1;
+  802858:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80285d:	e9 27 01 00 00       	jmp    802989 <argnext+0x156>
+
+  if (!*args->curarg) {
+  802862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802866:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80286a:	0f b6 00             	movzbl (%rax),%eax
+  80286d:	84 c0                	test   %al,%al
+  80286f:	0f 85 d5 00 00 00    	jne    80294a <argnext+0x117>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1 || args->argv[1][0] != '-' || args->argv[1][1] == '\0')
+  802875:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802879:	48 8b 00             	mov    (%rax),%rax
+  80287c:	8b 00                	mov    (%rax),%eax
+  80287e:	83 f8 01             	cmp    $0x1,%eax
+  802881:	0f 84 ed 00 00 00    	je     802974 <argnext+0x141>
+  802887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80288b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80288f:	48 83 c0 08          	add    $0x8,%rax
+  802893:	48 8b 00             	mov    (%rax),%rax
+  802896:	0f b6 00             	movzbl (%rax),%eax
+  802899:	3c 2d                	cmp    $0x2d,%al
+  80289b:	0f 85 d3 00 00 00    	jne    802974 <argnext+0x141>
+  8028a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028a9:	48 83 c0 08          	add    $0x8,%rax
+  8028ad:	48 8b 00             	mov    (%rax),%rax
+  8028b0:	48 83 c0 01          	add    $0x1,%rax
+  8028b4:	0f b6 00             	movzbl (%rax),%eax
+  8028b7:	84 c0                	test   %al,%al
+  8028b9:	0f 84 b5 00 00 00    	je     802974 <argnext+0x141>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  8028bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028c7:	48 83 c0 08          	add    $0x8,%rax
+  8028cb:	48 8b 00             	mov    (%rax),%rax
+  8028ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8028d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028d6:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8028da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028de:	48 8b 00             	mov    (%rax),%rax
+  8028e1:	8b 00                	mov    (%rax),%eax
+  8028e3:	83 e8 01             	sub    $0x1,%eax
+  8028e6:	48 98                	cltq
+  8028e8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8028ef:	00 
+  8028f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028f8:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  8028fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802900:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802904:	48 83 c0 08          	add    $0x8,%rax
+  802908:	48 89 ce             	mov    %rcx,%rsi
+  80290b:	48 89 c7             	mov    %rax,%rdi
+  80290e:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  802915:	00 00 00 
+  802918:	ff d0                	call   *%rax
+    (*args->argc)--;
+  80291a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291e:	48 8b 00             	mov    (%rax),%rax
+  802921:	8b 10                	mov    (%rax),%edx
+  802923:	83 ea 01             	sub    $0x1,%edx
+  802926:	89 10                	mov    %edx,(%rax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80292c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802930:	0f b6 00             	movzbl (%rax),%eax
+  802933:	3c 2d                	cmp    $0x2d,%al
+  802935:	75 13                	jne    80294a <argnext+0x117>
+  802937:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80293b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80293f:	48 83 c0 01          	add    $0x1,%rax
+  802943:	0f b6 00             	movzbl (%rax),%eax
+  802946:	84 c0                	test   %al,%al
+  802948:	74 2d                	je     802977 <argnext+0x144>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  80294a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80294e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802952:	0f b6 00             	movzbl (%rax),%eax
+  802955:	0f b6 c0             	movzbl %al,%eax
+  802958:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  args->curarg++;
+  80295b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80295f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802963:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802967:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80296b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return arg;
+  80296f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802972:	eb 15                	jmp    802989 <argnext+0x156>
+      goto endofargs;
+  802974:	90                   	nop
+  802975:	eb 01                	jmp    802978 <argnext+0x145>
+      goto endofargs;
+  802977:	90                   	nop
+
+endofargs:
+  args->curarg = 0;
+  802978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80297c:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802983:	00 
+  return -1;
+  802984:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  802989:	c9                   	leave
+  80298a:	c3                   	ret
+
+000000000080298b <argvalue>:
+
+char *
+argvalue(struct Argstate *args) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	48 83 ec 10          	sub    $0x10,%rsp
+  802993:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80299b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80299f:	48 85 c0             	test   %rax,%rax
+  8029a2:	74 0a                	je     8029ae <argvalue+0x23>
+  8029a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029a8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8029ac:	eb 13                	jmp    8029c1 <argvalue+0x36>
+  8029ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029b2:	48 89 c7             	mov    %rax,%rdi
+  8029b5:	48 b8 c3 29 80 00 00 	movabs $0x8029c3,%rax
+  8029bc:	00 00 00 
+  8029bf:	ff d0                	call   *%rax
+}
+  8029c1:	c9                   	leave
+  8029c2:	c3                   	ret
+
+00000000008029c3 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args) {
+  8029c3:	55                   	push   %rbp
+  8029c4:	48 89 e5             	mov    %rsp,%rbp
+  8029c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8029cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (!args->curarg)
+  8029cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8029d7:	48 85 c0             	test   %rax,%rax
+  8029da:	75 0a                	jne    8029e6 <argnextvalue+0x23>
+    return 0;
+  8029dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e1:	e9 c8 00 00 00       	jmp    802aae <argnextvalue+0xeb>
+  if (*args->curarg) {
+  8029e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8029ee:	0f b6 00             	movzbl (%rax),%eax
+  8029f1:	84 c0                	test   %al,%al
+  8029f3:	74 27                	je     802a1c <argnextvalue+0x59>
+    args->argvalue = args->curarg;
+  8029f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8029fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a01:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    args->curarg   = "";
+  802a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a09:	48 be b5 5c 80 00 00 	movabs $0x805cb5,%rsi
+  802a10:	00 00 00 
+  802a13:	48 89 70 10          	mov    %rsi,0x10(%rax)
+  802a17:	e9 8a 00 00 00       	jmp    802aa6 <argnextvalue+0xe3>
+  } else if (*args->argc > 1) {
+  802a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a20:	48 8b 00             	mov    (%rax),%rax
+  802a23:	8b 00                	mov    (%rax),%eax
+  802a25:	83 f8 01             	cmp    $0x1,%eax
+  802a28:	7e 64                	jle    802a8e <argnextvalue+0xcb>
+    args->argvalue = args->argv[1];
+  802a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a32:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802a36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a3a:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802a3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a42:	48 8b 00             	mov    (%rax),%rax
+  802a45:	8b 00                	mov    (%rax),%eax
+  802a47:	83 e8 01             	sub    $0x1,%eax
+  802a4a:	48 98                	cltq
+  802a4c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802a53:	00 
+  802a54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a58:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a5c:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  802a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a68:	48 83 c0 08          	add    $0x8,%rax
+  802a6c:	48 89 ce             	mov    %rcx,%rsi
+  802a6f:	48 89 c7             	mov    %rax,%rdi
+  802a72:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+    (*args->argc)--;
+  802a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a82:	48 8b 00             	mov    (%rax),%rax
+  802a85:	8b 10                	mov    (%rax),%edx
+  802a87:	83 ea 01             	sub    $0x1,%edx
+  802a8a:	89 10                	mov    %edx,(%rax)
+  802a8c:	eb 18                	jmp    802aa6 <argnextvalue+0xe3>
+  } else {
+    args->argvalue = 0;
+  802a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a92:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802a99:	00 
+    args->curarg   = 0;
+  802a9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a9e:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802aa5:	00 
+  }
+  return (char *)args->argvalue;
+  802aa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aaa:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+0000000000802ab0 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802ab0:	55                   	push   %rbp
+  802ab1:	48 89 e5             	mov    %rsp,%rbp
+  802ab4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ac0:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802ac7:	ff ff ff 
+  802aca:	48 01 d0             	add    %rdx,%rax
+  802acd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802ad1:	c9                   	leave
+  802ad2:	c3                   	ret
+
+0000000000802ad3 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802ad3:	55                   	push   %rbp
+  802ad4:	48 89 e5             	mov    %rsp,%rbp
+  802ad7:	48 83 ec 08          	sub    $0x8,%rsp
+  802adb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802adf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ae3:	48 89 c7             	mov    %rax,%rdi
+  802ae6:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  802aed:	00 00 00 
+  802af0:	ff d0                	call   *%rax
+  802af2:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802af8:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802afc:	c9                   	leave
+  802afd:	c3                   	ret
+
+0000000000802afe <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+  802b02:	48 83 ec 18          	sub    $0x18,%rsp
+  802b06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802b0a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b11:	e9 ae 00 00 00       	jmp    802bc4 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802b16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b19:	c1 e0 0c             	shl    $0xc,%eax
+  802b1c:	48 98                	cltq
+  802b1e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b23:	48 01 d0             	add    %rdx,%rax
+  802b26:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802b2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b2e:	48 c1 e8 27          	shr    $0x27,%rax
+  802b32:	48 89 c2             	mov    %rax,%rdx
+  802b35:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b3c:	01 00 00 
+  802b3f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b43:	83 e0 01             	and    $0x1,%eax
+  802b46:	48 85 c0             	test   %rax,%rax
+  802b49:	74 63                	je     802bae <fd_alloc+0xb0>
+  802b4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b4f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b53:	48 89 c2             	mov    %rax,%rdx
+  802b56:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b5d:	01 00 00 
+  802b60:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b64:	83 e0 01             	and    $0x1,%eax
+  802b67:	48 85 c0             	test   %rax,%rax
+  802b6a:	74 42                	je     802bae <fd_alloc+0xb0>
+  802b6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b70:	48 c1 e8 15          	shr    $0x15,%rax
+  802b74:	48 89 c2             	mov    %rax,%rdx
+  802b77:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802b7e:	01 00 00 
+  802b81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b85:	83 e0 01             	and    $0x1,%eax
+  802b88:	48 85 c0             	test   %rax,%rax
+  802b8b:	74 21                	je     802bae <fd_alloc+0xb0>
+  802b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b91:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b95:	48 89 c2             	mov    %rax,%rdx
+  802b98:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b9f:	01 00 00 
+  802ba2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ba6:	83 e0 01             	and    $0x1,%eax
+  802ba9:	48 85 c0             	test   %rax,%rax
+  802bac:	75 12                	jne    802bc0 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802bae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802bb6:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	eb 1e                	jmp    802bde <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802bc0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802bc4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802bc8:	0f 8e 48 ff ff ff    	jle    802b16 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bd2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802bd9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802bde:	c9                   	leave
+  802bdf:	c3                   	ret
+
+0000000000802be0 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802be0:	55                   	push   %rbp
+  802be1:	48 89 e5             	mov    %rsp,%rbp
+  802be4:	48 83 ec 20          	sub    $0x20,%rsp
+  802be8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802beb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802bef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bf3:	78 06                	js     802bfb <fd_lookup+0x1b>
+  802bf5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802bf9:	7e 0a                	jle    802c05 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802bfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c00:	e9 af 00 00 00       	jmp    802cb4 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802c05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c08:	c1 e0 0c             	shl    $0xc,%eax
+  802c0b:	48 98                	cltq
+  802c0d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802c12:	48 01 d0             	add    %rdx,%rax
+  802c15:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c1d:	48 c1 e8 27          	shr    $0x27,%rax
+  802c21:	48 89 c2             	mov    %rax,%rdx
+  802c24:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c2b:	01 00 00 
+  802c2e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c32:	83 e0 01             	and    $0x1,%eax
+  802c35:	48 85 c0             	test   %rax,%rax
+  802c38:	74 63                	je     802c9d <fd_lookup+0xbd>
+  802c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c3e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c42:	48 89 c2             	mov    %rax,%rdx
+  802c45:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c4c:	01 00 00 
+  802c4f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c53:	83 e0 01             	and    $0x1,%eax
+  802c56:	48 85 c0             	test   %rax,%rax
+  802c59:	74 42                	je     802c9d <fd_lookup+0xbd>
+  802c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c5f:	48 c1 e8 15          	shr    $0x15,%rax
+  802c63:	48 89 c2             	mov    %rax,%rdx
+  802c66:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802c6d:	01 00 00 
+  802c70:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c74:	83 e0 01             	and    $0x1,%eax
+  802c77:	48 85 c0             	test   %rax,%rax
+  802c7a:	74 21                	je     802c9d <fd_lookup+0xbd>
+  802c7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c80:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c84:	48 89 c2             	mov    %rax,%rdx
+  802c87:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c8e:	01 00 00 
+  802c91:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c95:	83 e0 01             	and    $0x1,%eax
+  802c98:	48 85 c0             	test   %rax,%rax
+  802c9b:	75 07                	jne    802ca4 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802c9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ca2:	eb 10                	jmp    802cb4 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802ca4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ca8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cac:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802caf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb4:	c9                   	leave
+  802cb5:	c3                   	ret
+
+0000000000802cb6 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	48 83 ec 30          	sub    $0x30,%rsp
+  802cbe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802cc2:	89 f0                	mov    %esi,%eax
+  802cc4:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802cc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ccb:	48 89 c7             	mov    %rax,%rdi
+  802cce:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+  802cda:	89 c2                	mov    %eax,%edx
+  802cdc:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802ce0:	48 89 c6             	mov    %rax,%rsi
+  802ce3:	89 d7                	mov    %edx,%edi
+  802ce5:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+  802cf1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cf4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cf8:	78 0a                	js     802d04 <fd_close+0x4e>
+  802cfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cfe:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802d02:	74 12                	je     802d16 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802d04:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802d08:	74 05                	je     802d0f <fd_close+0x59>
+  802d0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d0d:	eb 70                	jmp    802d7f <fd_close+0xc9>
+  802d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d14:	eb 69                	jmp    802d7f <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802d16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d1a:	8b 00                	mov    (%rax),%eax
+  802d1c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d20:	48 89 d6             	mov    %rdx,%rsi
+  802d23:	89 c7                	mov    %eax,%edi
+  802d25:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+  802d31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d34:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d38:	78 2a                	js     802d64 <fd_close+0xae>
+    if (dev->dev_close)
+  802d3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d3e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802d42:	48 85 c0             	test   %rax,%rax
+  802d45:	74 16                	je     802d5d <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802d47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d4b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802d4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d53:	48 89 c7             	mov    %rax,%rdi
+  802d56:	ff d2                	call   *%rdx
+  802d58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d5b:	eb 07                	jmp    802d64 <fd_close+0xae>
+    else
+      r = 0;
+  802d5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802d64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d68:	48 89 c6             	mov    %rax,%rsi
+  802d6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d70:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+  return r;
+  802d7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d7f:	c9                   	leave
+  802d80:	c3                   	ret
+
+0000000000802d81 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802d81:	55                   	push   %rbp
+  802d82:	48 89 e5             	mov    %rsp,%rbp
+  802d85:	48 83 ec 20          	sub    $0x20,%rsp
+  802d89:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d8c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802d90:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d97:	eb 3f                	jmp    802dd8 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802d99:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802da0:	00 00 00 
+  802da3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802da6:	48 98                	cltq
+  802da8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802dac:	8b 00                	mov    (%rax),%eax
+  802dae:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802db1:	75 21                	jne    802dd4 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802db3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802dba:	00 00 00 
+  802dbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dc0:	48 98                	cltq
+  802dc2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dca:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd2:	eb 7f                	jmp    802e53 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802dd4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802dd8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ddf:	00 00 00 
+  802de2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802de5:	48 98                	cltq
+  802de7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802deb:	48 85 c0             	test   %rax,%rax
+  802dee:	75 a9                	jne    802d99 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802df0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802df7:	00 00 00 
+  802dfa:	8b 40 04             	mov    0x4(%rax),%eax
+  802dfd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e02:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802e09:	00 00 00 
+  802e0c:	48 98                	cltq
+  802e0e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802e15:	48 01 d0             	add    %rdx,%rax
+  802e18:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802e1e:	8b 00                	mov    (%rax),%eax
+  802e20:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e23:	89 c6                	mov    %eax,%esi
+  802e25:	48 b8 b8 5c 80 00 00 	movabs $0x805cb8,%rax
+  802e2c:	00 00 00 
+  802e2f:	48 89 c7             	mov    %rax,%rdi
+  802e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e37:	48 b9 69 03 80 00 00 	movabs $0x800369,%rcx
+  802e3e:	00 00 00 
+  802e41:	ff d1                	call   *%rcx
+  *dev = 0;
+  802e43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e47:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802e4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e53:	c9                   	leave
+  802e54:	c3                   	ret
+
+0000000000802e55 <close>:
+
+int
+close(int fdnum) {
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	48 83 ec 20          	sub    $0x20,%rsp
+  802e5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e60:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802e64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e67:	48 89 d6             	mov    %rdx,%rsi
+  802e6a:	89 c7                	mov    %eax,%edi
+  802e6c:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802e73:	00 00 00 
+  802e76:	ff d0                	call   *%rax
+  802e78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e7f:	79 05                	jns    802e86 <close+0x31>
+    return r;
+  802e81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e84:	eb 18                	jmp    802e9e <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802e86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e8a:	be 01 00 00 00       	mov    $0x1,%esi
+  802e8f:	48 89 c7             	mov    %rax,%rdi
+  802e92:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  802e99:	00 00 00 
+  802e9c:	ff d0                	call   *%rax
+}
+  802e9e:	c9                   	leave
+  802e9f:	c3                   	ret
+
+0000000000802ea0 <close_all>:
+
+void
+close_all(void) {
+  802ea0:	55                   	push   %rbp
+  802ea1:	48 89 e5             	mov    %rsp,%rbp
+  802ea4:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802ea8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802eaf:	eb 15                	jmp    802ec6 <close_all+0x26>
+    close(i);
+  802eb1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eb4:	89 c7                	mov    %eax,%edi
+  802eb6:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802ec2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ec6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802eca:	7e e5                	jle    802eb1 <close_all+0x11>
+}
+  802ecc:	90                   	nop
+  802ecd:	90                   	nop
+  802ece:	c9                   	leave
+  802ecf:	c3                   	ret
+
+0000000000802ed0 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802ed0:	55                   	push   %rbp
+  802ed1:	48 89 e5             	mov    %rsp,%rbp
+  802ed4:	48 83 ec 40          	sub    $0x40,%rsp
+  802ed8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802edb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802ede:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802ee2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ee5:	48 89 d6             	mov    %rdx,%rsi
+  802ee8:	89 c7                	mov    %eax,%edi
+  802eea:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  802ef1:	00 00 00 
+  802ef4:	ff d0                	call   *%rax
+  802ef6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ef9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802efd:	79 08                	jns    802f07 <dup+0x37>
+    return r;
+  802eff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f02:	e9 33 02 00 00       	jmp    80313a <dup+0x26a>
+  close(newfdnum);
+  802f07:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802f0a:	89 c7                	mov    %eax,%edi
+  802f0c:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  802f13:	00 00 00 
+  802f16:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802f18:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802f1b:	c1 e0 0c             	shl    $0xc,%eax
+  802f1e:	48 98                	cltq
+  802f20:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802f25:	48 01 d0             	add    %rdx,%rax
+  802f28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f30:	48 89 c7             	mov    %rax,%rdi
+  802f33:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+  802f3f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802f43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f47:	48 89 c7             	mov    %rax,%rdi
+  802f4a:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+  802f56:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802f5a:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802f61:	00 
+  802f62:	e9 19 01 00 00       	jmp    803080 <dup+0x1b0>
+    off -= PGSIZE;
+  802f67:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802f6e:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f6f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f77:	48 01 d0             	add    %rdx,%rax
+  802f7a:	48 c1 e8 27          	shr    $0x27,%rax
+  802f7e:	48 89 c2             	mov    %rax,%rdx
+  802f81:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f88:	01 00 00 
+  802f8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f8f:	83 e0 01             	and    $0x1,%eax
+  802f92:	48 85 c0             	test   %rax,%rax
+  802f95:	0f 84 e5 00 00 00    	je     803080 <dup+0x1b0>
+  802f9b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fa3:	48 01 d0             	add    %rdx,%rax
+  802fa6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802faa:	48 89 c2             	mov    %rax,%rdx
+  802fad:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802fb4:	01 00 00 
+  802fb7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fbb:	83 e0 01             	and    $0x1,%eax
+  802fbe:	48 85 c0             	test   %rax,%rax
+  802fc1:	0f 84 b9 00 00 00    	je     803080 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802fc7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802fcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fcf:	48 01 d0             	add    %rdx,%rax
+  802fd2:	48 c1 e8 15          	shr    $0x15,%rax
+  802fd6:	48 89 c2             	mov    %rax,%rdx
+  802fd9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802fe0:	01 00 00 
+  802fe3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fe7:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802fea:	48 85 c0             	test   %rax,%rax
+  802fed:	0f 84 8d 00 00 00    	je     803080 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802ff3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ff7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ffb:	48 01 d0             	add    %rdx,%rax
+  802ffe:	48 c1 e8 0c          	shr    $0xc,%rax
+  803002:	48 89 c2             	mov    %rax,%rdx
+  803005:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80300c:	01 00 00 
+  80300f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803013:	83 e0 01             	and    $0x1,%eax
+  803016:	48 85 c0             	test   %rax,%rax
+  803019:	74 65                	je     803080 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80301b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80301f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803023:	48 01 d0             	add    %rdx,%rax
+  803026:	48 c1 e8 0c          	shr    $0xc,%rax
+  80302a:	48 89 c2             	mov    %rax,%rdx
+  80302d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803034:	01 00 00 
+  803037:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80303b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803040:	89 c6                	mov    %eax,%esi
+  803042:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803046:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80304a:	48 01 c2             	add    %rax,%rdx
+  80304d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803051:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803055:	48 01 c8             	add    %rcx,%rax
+  803058:	41 89 f0             	mov    %esi,%r8d
+  80305b:	48 89 d1             	mov    %rdx,%rcx
+  80305e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803063:	48 89 c6             	mov    %rax,%rsi
+  803066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306b:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  803072:	00 00 00 
+  803075:	ff d0                	call   *%rax
+  803077:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80307a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80307e:	78 60                	js     8030e0 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803080:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803085:	0f 85 dc fe ff ff    	jne    802f67 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80308b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80308f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803093:	48 89 c2             	mov    %rax,%rdx
+  803096:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80309d:	01 00 00 
+  8030a0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030a4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030a9:	89 c1                	mov    %eax,%ecx
+  8030ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8030b3:	41 89 c8             	mov    %ecx,%r8d
+  8030b6:	48 89 d1             	mov    %rdx,%rcx
+  8030b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030be:	48 89 c6             	mov    %rax,%rsi
+  8030c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c6:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+  8030d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030d9:	78 08                	js     8030e3 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8030db:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8030de:	eb 5a                	jmp    80313a <dup+0x26a>
+        goto err;
+  8030e0:	90                   	nop
+  8030e1:	eb 01                	jmp    8030e4 <dup+0x214>
+    goto err;
+  8030e3:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8030e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030e8:	48 89 c6             	mov    %rax,%rsi
+  8030eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f0:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8030f7:	00 00 00 
+  8030fa:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8030fc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803103:	00 
+  803104:	eb 27                	jmp    80312d <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803106:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80310a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80310e:	48 01 d0             	add    %rdx,%rax
+  803111:	48 89 c6             	mov    %rax,%rsi
+  803114:	bf 00 00 00 00       	mov    $0x0,%edi
+  803119:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803125:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80312c:	00 
+  80312d:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803134:	00 
+  803135:	76 cf                	jbe    803106 <dup+0x236>
+  return r;
+  803137:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80313a:	c9                   	leave
+  80313b:	c3                   	ret
+
+000000000080313c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80313c:	55                   	push   %rbp
+  80313d:	48 89 e5             	mov    %rsp,%rbp
+  803140:	48 83 ec 40          	sub    $0x40,%rsp
+  803144:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803147:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80314b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80314f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803153:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803156:	48 89 d6             	mov    %rdx,%rsi
+  803159:	89 c7                	mov    %eax,%edi
+  80315b:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  803162:	00 00 00 
+  803165:	ff d0                	call   *%rax
+  803167:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80316a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80316e:	78 24                	js     803194 <read+0x58>
+  803170:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803174:	8b 00                	mov    (%rax),%eax
+  803176:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80317a:	48 89 d6             	mov    %rdx,%rsi
+  80317d:	89 c7                	mov    %eax,%edi
+  80317f:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+  80318b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80318e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803192:	79 0a                	jns    80319e <read+0x62>
+    return r;
+  803194:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803197:	48 98                	cltq
+  803199:	e9 9e 00 00 00       	jmp    80323c <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80319e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031a2:	8b 40 08             	mov    0x8(%rax),%eax
+  8031a5:	83 e0 03             	and    $0x3,%eax
+  8031a8:	83 f8 01             	cmp    $0x1,%eax
+  8031ab:	75 5c                	jne    803209 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031ad:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031b4:	00 00 00 
+  8031b7:	8b 40 04             	mov    0x4(%rax),%eax
+  8031ba:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031bf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031c6:	00 00 00 
+  8031c9:	48 98                	cltq
+  8031cb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031d2:	48 01 d0             	add    %rdx,%rax
+  8031d5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8031db:	8b 00                	mov    (%rax),%eax
+  8031dd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8031e0:	89 c6                	mov    %eax,%esi
+  8031e2:	48 b8 d7 5c 80 00 00 	movabs $0x805cd7,%rax
+  8031e9:	00 00 00 
+  8031ec:	48 89 c7             	mov    %rax,%rdi
+  8031ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f4:	48 b9 69 03 80 00 00 	movabs $0x800369,%rcx
+  8031fb:	00 00 00 
+  8031fe:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803200:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803207:	eb 33                	jmp    80323c <read+0x100>
+  }
+  if (!dev->dev_read)
+  803209:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80320d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803211:	48 85 c0             	test   %rax,%rax
+  803214:	75 09                	jne    80321f <read+0xe3>
+    return -E_NOT_SUPP;
+  803216:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80321d:	eb 1d                	jmp    80323c <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80321f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803223:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80322b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80322f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803233:	48 89 ce             	mov    %rcx,%rsi
+  803236:	48 89 c7             	mov    %rax,%rdi
+  803239:	41 ff d0             	call   *%r8
+}
+  80323c:	c9                   	leave
+  80323d:	c3                   	ret
+
+000000000080323e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80323e:	55                   	push   %rbp
+  80323f:	48 89 e5             	mov    %rsp,%rbp
+  803242:	48 83 ec 30          	sub    $0x30,%rsp
+  803246:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803249:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80324d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803251:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803258:	eb 49                	jmp    8032a3 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80325a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80325d:	48 98                	cltq
+  80325f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803263:	48 29 c2             	sub    %rax,%rdx
+  803266:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803269:	48 63 c8             	movslq %eax,%rcx
+  80326c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803270:	48 01 c1             	add    %rax,%rcx
+  803273:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803276:	48 89 ce             	mov    %rcx,%rsi
+  803279:	89 c7                	mov    %eax,%edi
+  80327b:	48 b8 3c 31 80 00 00 	movabs $0x80313c,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80328a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80328e:	79 07                	jns    803297 <readn+0x59>
+      return m;
+  803290:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803293:	48 98                	cltq
+  803295:	eb 1f                	jmp    8032b6 <readn+0x78>
+    if (m == 0)
+  803297:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80329b:	74 13                	je     8032b0 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80329d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8032a0:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8032a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032a6:	48 98                	cltq
+  8032a8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8032ac:	72 ac                	jb     80325a <readn+0x1c>
+  8032ae:	eb 01                	jmp    8032b1 <readn+0x73>
+      break;
+  8032b0:	90                   	nop
+  }
+  return tot;
+  8032b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032b4:	48 98                	cltq
+}
+  8032b6:	c9                   	leave
+  8032b7:	c3                   	ret
+
+00000000008032b8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8032b8:	55                   	push   %rbp
+  8032b9:	48 89 e5             	mov    %rsp,%rbp
+  8032bc:	48 83 ec 40          	sub    $0x40,%rsp
+  8032c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032c3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8032c7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032cb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8032cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032d2:	48 89 d6             	mov    %rdx,%rsi
+  8032d5:	89 c7                	mov    %eax,%edi
+  8032d7:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+  8032e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032ea:	78 24                	js     803310 <write+0x58>
+  8032ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f0:	8b 00                	mov    (%rax),%eax
+  8032f2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032f6:	48 89 d6             	mov    %rdx,%rsi
+  8032f9:	89 c7                	mov    %eax,%edi
+  8032fb:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  803302:	00 00 00 
+  803305:	ff d0                	call   *%rax
+  803307:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80330a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80330e:	79 0a                	jns    80331a <write+0x62>
+    return r;
+  803310:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803313:	48 98                	cltq
+  803315:	e9 9d 00 00 00       	jmp    8033b7 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80331a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331e:	8b 40 08             	mov    0x8(%rax),%eax
+  803321:	83 e0 03             	and    $0x3,%eax
+  803324:	85 c0                	test   %eax,%eax
+  803326:	75 5c                	jne    803384 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803328:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80332f:	00 00 00 
+  803332:	8b 40 04             	mov    0x4(%rax),%eax
+  803335:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80333a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803341:	00 00 00 
+  803344:	48 98                	cltq
+  803346:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80334d:	48 01 d0             	add    %rdx,%rax
+  803350:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803356:	8b 00                	mov    (%rax),%eax
+  803358:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80335b:	89 c6                	mov    %eax,%esi
+  80335d:	48 b8 f3 5c 80 00 00 	movabs $0x805cf3,%rax
+  803364:	00 00 00 
+  803367:	48 89 c7             	mov    %rax,%rdi
+  80336a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336f:	48 b9 69 03 80 00 00 	movabs $0x800369,%rcx
+  803376:	00 00 00 
+  803379:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80337b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803382:	eb 33                	jmp    8033b7 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803384:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803388:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80338c:	48 85 c0             	test   %rax,%rax
+  80338f:	75 09                	jne    80339a <write+0xe2>
+    return -E_NOT_SUPP;
+  803391:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803398:	eb 1d                	jmp    8033b7 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80339a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80339e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8033a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033a6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033aa:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8033ae:	48 89 ce             	mov    %rcx,%rsi
+  8033b1:	48 89 c7             	mov    %rax,%rdi
+  8033b4:	41 ff d0             	call   *%r8
+}
+  8033b7:	c9                   	leave
+  8033b8:	c3                   	ret
+
+00000000008033b9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8033b9:	55                   	push   %rbp
+  8033ba:	48 89 e5             	mov    %rsp,%rbp
+  8033bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8033c1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033c4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033c7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8033cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ce:	48 89 d6             	mov    %rdx,%rsi
+  8033d1:	89 c7                	mov    %eax,%edi
+  8033d3:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8033da:	00 00 00 
+  8033dd:	ff d0                	call   *%rax
+  8033df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033e6:	79 05                	jns    8033ed <seek+0x34>
+    return r;
+  8033e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033eb:	eb 0f                	jmp    8033fc <seek+0x43>
+  fd->fd_offset = offset;
+  8033ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033f1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8033f4:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8033f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033fc:	c9                   	leave
+  8033fd:	c3                   	ret
+
+00000000008033fe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8033fe:	55                   	push   %rbp
+  8033ff:	48 89 e5             	mov    %rsp,%rbp
+  803402:	48 83 ec 30          	sub    $0x30,%rsp
+  803406:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803409:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80340c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803410:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803413:	48 89 d6             	mov    %rdx,%rsi
+  803416:	89 c7                	mov    %eax,%edi
+  803418:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+  803424:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803427:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80342b:	78 24                	js     803451 <ftruncate+0x53>
+  80342d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803431:	8b 00                	mov    (%rax),%eax
+  803433:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803437:	48 89 d6             	mov    %rdx,%rsi
+  80343a:	89 c7                	mov    %eax,%edi
+  80343c:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  803443:	00 00 00 
+  803446:	ff d0                	call   *%rax
+  803448:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80344b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80344f:	79 08                	jns    803459 <ftruncate+0x5b>
+    return r;
+  803451:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803454:	e9 92 00 00 00       	jmp    8034eb <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803459:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80345d:	8b 40 08             	mov    0x8(%rax),%eax
+  803460:	83 e0 03             	and    $0x3,%eax
+  803463:	85 c0                	test   %eax,%eax
+  803465:	75 5a                	jne    8034c1 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803467:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80346e:	00 00 00 
+  803471:	8b 40 04             	mov    0x4(%rax),%eax
+  803474:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803479:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803480:	00 00 00 
+  803483:	48 98                	cltq
+  803485:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80348c:	48 01 d0             	add    %rdx,%rax
+  80348f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803495:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803497:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80349a:	89 c6                	mov    %eax,%esi
+  80349c:	48 b8 10 5d 80 00 00 	movabs $0x805d10,%rax
+  8034a3:	00 00 00 
+  8034a6:	48 89 c7             	mov    %rax,%rdi
+  8034a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ae:	48 b9 69 03 80 00 00 	movabs $0x800369,%rcx
+  8034b5:	00 00 00 
+  8034b8:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8034ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034bf:	eb 2a                	jmp    8034eb <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8034c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034c5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8034c9:	48 85 c0             	test   %rax,%rax
+  8034cc:	75 07                	jne    8034d5 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8034ce:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8034d3:	eb 16                	jmp    8034eb <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8034d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034d9:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8034dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034e1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8034e4:	89 d6                	mov    %edx,%esi
+  8034e6:	48 89 c7             	mov    %rax,%rdi
+  8034e9:	ff d1                	call   *%rcx
+}
+  8034eb:	c9                   	leave
+  8034ec:	c3                   	ret
+
+00000000008034ed <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+  8034f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8034f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8034f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8034fc:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803500:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803503:	48 89 d6             	mov    %rdx,%rsi
+  803506:	89 c7                	mov    %eax,%edi
+  803508:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80350f:	00 00 00 
+  803512:	ff d0                	call   *%rax
+  803514:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803517:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80351b:	78 24                	js     803541 <fstat+0x54>
+  80351d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803521:	8b 00                	mov    (%rax),%eax
+  803523:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803527:	48 89 d6             	mov    %rdx,%rsi
+  80352a:	89 c7                	mov    %eax,%edi
+  80352c:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+  803538:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80353b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80353f:	79 05                	jns    803546 <fstat+0x59>
+    return r;
+  803541:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803544:	eb 5e                	jmp    8035a4 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803546:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80354a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80354e:	48 85 c0             	test   %rax,%rax
+  803551:	75 07                	jne    80355a <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803553:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803558:	eb 4a                	jmp    8035a4 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80355a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80355e:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803561:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803565:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80356c:	00 00 00 
+  stat->st_isdir   = 0;
+  80356f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803573:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80357a:	00 00 00 
+  stat->st_dev     = dev;
+  80357d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803581:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803585:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80358c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803590:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803594:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803598:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80359c:	48 89 d6             	mov    %rdx,%rsi
+  80359f:	48 89 c7             	mov    %rax,%rdi
+  8035a2:	ff d1                	call   *%rcx
+}
+  8035a4:	c9                   	leave
+  8035a5:	c3                   	ret
+
+00000000008035a6 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8035a6:	55                   	push   %rbp
+  8035a7:	48 89 e5             	mov    %rsp,%rbp
+  8035aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8035ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8035b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8035b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035ba:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8035c0:	83 f8 20             	cmp    $0x20,%eax
+  8035c3:	75 07                	jne    8035cc <pollwait_key+0x26>
+    return -E_INVAL;
+  8035c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035ca:	eb 5f                	jmp    80362b <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8035cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035d0:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8035d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035da:	48 63 d2             	movslq %edx,%rdx
+  8035dd:	48 c1 e2 04          	shl    $0x4,%rdx
+  8035e1:	48 01 c2             	add    %rax,%rdx
+  8035e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035e8:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8035eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035ef:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8035f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035f9:	8b 00                	mov    (%rax),%eax
+  8035fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035ff:	48 63 c9             	movslq %ecx,%rcx
+  803602:	48 c1 e1 04          	shl    $0x4,%rcx
+  803606:	48 01 ca             	add    %rcx,%rdx
+  803609:	48 83 c2 08          	add    $0x8,%rdx
+  80360d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80360f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803613:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803619:	8d 50 01             	lea    0x1(%rax),%edx
+  80361c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803620:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80362b:	c9                   	leave
+  80362c:	c3                   	ret
+
+000000000080362d <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80362d:	55                   	push   %rbp
+  80362e:	48 89 e5             	mov    %rsp,%rbp
+  803631:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803638:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80363f:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803645:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80364c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803653:	00 
+  int i, r, ready, ipc = 0;
+  803654:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80365b:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803662:	00 
+  803663:	74 45                	je     8036aa <poll+0x7d>
+  803665:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80366c:	ff 
+  80366d:	74 3b                	je     8036aa <poll+0x7d>
+    now      = vsys_clock_ns();
+  80366f:	48 b8 81 4e 80 00 00 	movabs $0x804e81,%rax
+  803676:	00 00 00 
+  803679:	ff d0                	call   *%rax
+  80367b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80367f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803683:	48 f7 d0             	not    %rax
+  803686:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80368d:	73 10                	jae    80369f <poll+0x72>
+  80368f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803693:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80369a:	48 01 d0             	add    %rdx,%rax
+  80369d:	eb 07                	jmp    8036a6 <poll+0x79>
+  80369f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8036a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8036aa:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8036b1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8036b8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8036bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8036c6:	e9 46 02 00 00       	jmp    803911 <poll+0x2e4>
+      fds[i].revents = 0;
+  8036cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036ce:	48 63 d0             	movslq %eax,%rdx
+  8036d1:	48 89 d0             	mov    %rdx,%rax
+  8036d4:	48 01 c0             	add    %rax,%rax
+  8036d7:	48 01 d0             	add    %rdx,%rax
+  8036da:	48 c1 e0 02          	shl    $0x2,%rax
+  8036de:	48 89 c2             	mov    %rax,%rdx
+  8036e1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036e8:	48 01 d0             	add    %rdx,%rax
+  8036eb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8036f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036f5:	48 63 d0             	movslq %eax,%rdx
+  8036f8:	48 89 d0             	mov    %rdx,%rax
+  8036fb:	48 01 c0             	add    %rax,%rax
+  8036fe:	48 01 d0             	add    %rdx,%rax
+  803701:	48 c1 e0 02          	shl    $0x2,%rax
+  803705:	48 89 c2             	mov    %rax,%rdx
+  803708:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80370f:	48 01 d0             	add    %rdx,%rax
+  803712:	8b 00                	mov    (%rax),%eax
+  803714:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803717:	75 62                	jne    80377b <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803719:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80371c:	48 63 d0             	movslq %eax,%rdx
+  80371f:	48 89 d0             	mov    %rdx,%rax
+  803722:	48 01 c0             	add    %rax,%rax
+  803725:	48 01 d0             	add    %rdx,%rax
+  803728:	48 c1 e0 02          	shl    $0x2,%rax
+  80372c:	48 89 c2             	mov    %rax,%rdx
+  80372f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803736:	48 01 d0             	add    %rdx,%rax
+  803739:	8b 40 04             	mov    0x4(%rax),%eax
+  80373c:	83 e0 01             	and    $0x1,%eax
+  80373f:	85 c0                	test   %eax,%eax
+  803741:	0f 84 9b 01 00 00    	je     8038e2 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803747:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80374a:	48 63 d0             	movslq %eax,%rdx
+  80374d:	48 89 d0             	mov    %rdx,%rax
+  803750:	48 01 c0             	add    %rax,%rax
+  803753:	48 01 d0             	add    %rdx,%rax
+  803756:	48 c1 e0 02          	shl    $0x2,%rax
+  80375a:	48 89 c2             	mov    %rax,%rdx
+  80375d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803764:	48 01 c2             	add    %rax,%rdx
+  803767:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80376a:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80376d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803770:	83 c8 04             	or     $0x4,%eax
+  803773:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803776:	e9 67 01 00 00       	jmp    8038e2 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80377b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80377e:	48 63 d0             	movslq %eax,%rdx
+  803781:	48 89 d0             	mov    %rdx,%rax
+  803784:	48 01 c0             	add    %rax,%rax
+  803787:	48 01 d0             	add    %rdx,%rax
+  80378a:	48 c1 e0 02          	shl    $0x2,%rax
+  80378e:	48 89 c2             	mov    %rax,%rdx
+  803791:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803798:	48 01 d0             	add    %rdx,%rax
+  80379b:	8b 00                	mov    (%rax),%eax
+  80379d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8037a4:	48 89 d6             	mov    %rdx,%rsi
+  8037a7:	89 c7                	mov    %eax,%edi
+  8037a9:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8037b0:	00 00 00 
+  8037b3:	ff d0                	call   *%rax
+  8037b5:	85 c0                	test   %eax,%eax
+  8037b7:	78 25                	js     8037de <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8037b9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8037c0:	8b 00                	mov    (%rax),%eax
+  8037c2:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8037c9:	48 89 d6             	mov    %rdx,%rsi
+  8037cc:	89 c7                	mov    %eax,%edi
+  8037ce:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  8037d5:	00 00 00 
+  8037d8:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8037da:	85 c0                	test   %eax,%eax
+  8037dc:	79 2c                	jns    80380a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8037de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037e1:	48 63 d0             	movslq %eax,%rdx
+  8037e4:	48 89 d0             	mov    %rdx,%rax
+  8037e7:	48 01 c0             	add    %rax,%rax
+  8037ea:	48 01 d0             	add    %rdx,%rax
+  8037ed:	48 c1 e0 02          	shl    $0x2,%rax
+  8037f1:	48 89 c2             	mov    %rax,%rdx
+  8037f4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037fb:	48 01 d0             	add    %rdx,%rax
+  8037fe:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803805:	e9 d8 00 00 00       	jmp    8038e2 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80380a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803811:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803815:	48 85 c0             	test   %rax,%rax
+  803818:	74 7d                	je     803897 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80381a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803821:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803825:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803828:	48 63 d0             	movslq %eax,%rdx
+  80382b:	48 89 d0             	mov    %rdx,%rax
+  80382e:	48 01 c0             	add    %rax,%rax
+  803831:	48 01 d0             	add    %rdx,%rax
+  803834:	48 c1 e0 02          	shl    $0x2,%rax
+  803838:	48 89 c2             	mov    %rax,%rdx
+  80383b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803842:	48 01 d0             	add    %rdx,%rax
+  803845:	8b 48 04             	mov    0x4(%rax),%ecx
+  803848:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80384f:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803856:	89 ce                	mov    %ecx,%esi
+  803858:	48 89 c7             	mov    %rax,%rdi
+  80385b:	41 ff d0             	call   *%r8
+  80385e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803861:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803865:	79 08                	jns    80386f <poll+0x242>
+          return r;
+  803867:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80386a:	e9 45 01 00 00       	jmp    8039b4 <poll+0x387>
+        fds[i].revents = r;
+  80386f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803872:	48 63 d0             	movslq %eax,%rdx
+  803875:	48 89 d0             	mov    %rdx,%rax
+  803878:	48 01 c0             	add    %rax,%rax
+  80387b:	48 01 d0             	add    %rdx,%rax
+  80387e:	48 c1 e0 02          	shl    $0x2,%rax
+  803882:	48 89 c2             	mov    %rax,%rdx
+  803885:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80388c:	48 01 c2             	add    %rax,%rdx
+  80388f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803892:	89 42 08             	mov    %eax,0x8(%rdx)
+  803895:	eb 4b                	jmp    8038e2 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803897:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80389a:	48 63 d0             	movslq %eax,%rdx
+  80389d:	48 89 d0             	mov    %rdx,%rax
+  8038a0:	48 01 c0             	add    %rax,%rax
+  8038a3:	48 01 d0             	add    %rdx,%rax
+  8038a6:	48 c1 e0 02          	shl    $0x2,%rax
+  8038aa:	48 89 c2             	mov    %rax,%rdx
+  8038ad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038b4:	48 01 d0             	add    %rdx,%rax
+  8038b7:	8b 48 04             	mov    0x4(%rax),%ecx
+  8038ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038bd:	48 63 d0             	movslq %eax,%rdx
+  8038c0:	48 89 d0             	mov    %rdx,%rax
+  8038c3:	48 01 c0             	add    %rax,%rax
+  8038c6:	48 01 d0             	add    %rdx,%rax
+  8038c9:	48 c1 e0 02          	shl    $0x2,%rax
+  8038cd:	48 89 c2             	mov    %rax,%rdx
+  8038d0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038d7:	48 01 d0             	add    %rdx,%rax
+  8038da:	83 e1 03             	and    $0x3,%ecx
+  8038dd:	89 ca                	mov    %ecx,%edx
+  8038df:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8038e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038e5:	48 63 d0             	movslq %eax,%rdx
+  8038e8:	48 89 d0             	mov    %rdx,%rax
+  8038eb:	48 01 c0             	add    %rax,%rax
+  8038ee:	48 01 d0             	add    %rdx,%rax
+  8038f1:	48 c1 e0 02          	shl    $0x2,%rax
+  8038f5:	48 89 c2             	mov    %rax,%rdx
+  8038f8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038ff:	48 01 d0             	add    %rdx,%rax
+  803902:	8b 40 08             	mov    0x8(%rax),%eax
+  803905:	85 c0                	test   %eax,%eax
+  803907:	74 04                	je     80390d <poll+0x2e0>
+        ready++;
+  803909:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80390d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803911:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803914:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80391a:	0f 8c ab fd ff ff    	jl     8036cb <poll+0x9e>
+    }
+    if (ready)
+  803920:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803924:	74 08                	je     80392e <poll+0x301>
+      return ready;
+  803926:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803929:	e9 86 00 00 00       	jmp    8039b4 <poll+0x387>
+
+    if (deadline) {
+  80392e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803933:	74 30                	je     803965 <poll+0x338>
+      now     = vsys_clock_ns();
+  803935:	48 b8 81 4e 80 00 00 	movabs $0x804e81,%rax
+  80393c:	00 00 00 
+  80393f:	ff d0                	call   *%rax
+  803941:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803945:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803949:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80394d:	73 0a                	jae    803959 <poll+0x32c>
+  80394f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803953:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803957:	eb 05                	jmp    80395e <poll+0x331>
+  803959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395e:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803965:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803968:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80396b:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803972:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803979:	48 89 c7             	mov    %rax,%rdi
+  80397c:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  803983:	00 00 00 
+  803986:	ff d0                	call   *%rax
+  803988:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80398b:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80398f:	75 07                	jne    803998 <poll+0x36b>
+      return 0;
+  803991:	b8 00 00 00 00       	mov    $0x0,%eax
+  803996:	eb 1c                	jmp    8039b4 <poll+0x387>
+    if (r < 0)
+  803998:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80399c:	79 05                	jns    8039a3 <poll+0x376>
+      return r;
+  80399e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039a1:	eb 11                	jmp    8039b4 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8039a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039a6:	c1 f8 02             	sar    $0x2,%eax
+  8039a9:	83 e0 01             	and    $0x1,%eax
+  8039ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8039af:	e9 f6 fc ff ff       	jmp    8036aa <poll+0x7d>
+  }
+}
+  8039b4:	c9                   	leave
+  8039b5:	c3                   	ret
+
+00000000008039b6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8039be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8039c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8039cf:	48 89 c7             	mov    %rax,%rdi
+  8039d2:	48 b8 a4 3a 80 00 00 	movabs $0x803aa4,%rax
+  8039d9:	00 00 00 
+  8039dc:	ff d0                	call   *%rax
+  8039de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039e5:	79 05                	jns    8039ec <stat+0x36>
+    return fd;
+  8039e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039ea:	eb 2f                	jmp    803a1b <stat+0x65>
+  r = fstat(fd, stat);
+  8039ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8039f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039f3:	48 89 d6             	mov    %rdx,%rsi
+  8039f6:	89 c7                	mov    %eax,%edi
+  8039f8:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  8039ff:	00 00 00 
+  803a02:	ff d0                	call   *%rax
+  803a04:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803a07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a0a:	89 c7                	mov    %eax,%edi
+  803a0c:	48 b8 55 2e 80 00 00 	movabs $0x802e55,%rax
+  803a13:	00 00 00 
+  803a16:	ff d0                	call   *%rax
+  return r;
+  803a18:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803a1b:	c9                   	leave
+  803a1c:	c3                   	ret
+
+0000000000803a1d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803a1d:	55                   	push   %rbp
+  803a1e:	48 89 e5             	mov    %rsp,%rbp
+  803a21:	48 83 ec 10          	sub    $0x10,%rsp
+  803a25:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803a2c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a33:	00 00 00 
+  803a36:	8b 00                	mov    (%rax),%eax
+  803a38:	85 c0                	test   %eax,%eax
+  803a3a:	75 1d                	jne    803a59 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a3c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a41:	48 b8 b6 55 80 00 00 	movabs $0x8055b6,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+  803a4d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a54:	00 00 00 
+  803a57:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803a59:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a60:	00 00 00 
+  803a63:	8b 00                	mov    (%rax),%eax
+  803a65:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803a68:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803a6d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a74:	00 00 00 
+  803a77:	89 c7                	mov    %eax,%edi
+  803a79:	48 b8 09 55 80 00 00 	movabs $0x805509,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a8e:	48 89 c6             	mov    %rax,%rsi
+  803a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a96:	48 b8 8c 53 80 00 00 	movabs $0x80538c,%rax
+  803a9d:	00 00 00 
+  803aa0:	ff d0                	call   *%rax
+}
+  803aa2:	c9                   	leave
+  803aa3:	c3                   	ret
+
+0000000000803aa4 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803aa4:	55                   	push   %rbp
+  803aa5:	48 89 e5             	mov    %rsp,%rbp
+  803aa8:	48 83 ec 20          	sub    $0x20,%rsp
+  803aac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ab0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ab7:	48 89 c7             	mov    %rax,%rdi
+  803aba:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+  803ac6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803acb:	7e 0a                	jle    803ad7 <open+0x33>
+    return -E_BAD_PATH;
+  803acd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ad2:	e9 a8 00 00 00       	jmp    803b7f <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803ad7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803adb:	48 89 c7             	mov    %rax,%rdi
+  803ade:	48 b8 fe 2a 80 00 00 	movabs $0x802afe,%rax
+  803ae5:	00 00 00 
+  803ae8:	ff d0                	call   *%rax
+  803aea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803af1:	79 08                	jns    803afb <open+0x57>
+    return r;
+  803af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803af6:	e9 84 00 00 00       	jmp    803b7f <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803afb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aff:	48 89 c6             	mov    %rax,%rsi
+  803b02:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803b09:	00 00 00 
+  803b0c:	48 89 c7             	mov    %rax,%rdi
+  803b0f:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803b1b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b22:	00 00 00 
+  803b25:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b28:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803b2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b32:	48 89 c6             	mov    %rax,%rsi
+  803b35:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b3a:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+  803b46:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b49:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b4d:	79 1d                	jns    803b6c <open+0xc8>
+    fd_close(fd, 0);
+  803b4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b53:	be 00 00 00 00       	mov    $0x0,%esi
+  803b58:	48 89 c7             	mov    %rax,%rdi
+  803b5b:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+    return r;
+  803b67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b6a:	eb 13                	jmp    803b7f <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803b6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b70:	48 89 c7             	mov    %rax,%rdi
+  803b73:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  803b7a:	00 00 00 
+  803b7d:	ff d0                	call   *%rax
+}
+  803b7f:	c9                   	leave
+  803b80:	c3                   	ret
+
+0000000000803b81 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803b81:	55                   	push   %rbp
+  803b82:	48 89 e5             	mov    %rsp,%rbp
+  803b85:	48 83 ec 10          	sub    $0x10,%rsp
+  803b89:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803b8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b91:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b94:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b9b:	00 00 00 
+  803b9e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803ba0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba5:	bf 06 00 00 00       	mov    $0x6,%edi
+  803baa:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+}
+  803bb6:	c9                   	leave
+  803bb7:	c3                   	ret
+
+0000000000803bb8 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803bb8:	55                   	push   %rbp
+  803bb9:	48 89 e5             	mov    %rsp,%rbp
+  803bbc:	48 83 ec 30          	sub    $0x30,%rsp
+  803bc0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803bc4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803bc8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803bcc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803bd1:	74 07                	je     803bda <devfile_read+0x22>
+  803bd3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803bd8:	75 0a                	jne    803be4 <devfile_read+0x2c>
+  return E_INVAL;
+  803bda:	b8 03 00 00 00       	mov    $0x3,%eax
+  803bdf:	e9 b4 00 00 00       	jmp    803c98 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803be4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803beb:	00 
+  while (n) {
+  803bec:	e9 98 00 00 00       	jmp    803c89 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803bf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bf5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bf8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803bff:	00 00 00 
+  803c02:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803c04:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c0b:	00 00 00 
+  803c0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c12:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803c16:	be 00 00 00 00       	mov    $0x0,%esi
+  803c1b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c20:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+  803c2c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803c2f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803c33:	7f 13                	jg     803c48 <devfile_read+0x90>
+      return res ? res : res0;
+  803c35:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803c39:	74 07                	je     803c42 <devfile_read+0x8a>
+  803c3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c3e:	48 98                	cltq
+  803c40:	eb 56                	jmp    803c98 <devfile_read+0xe0>
+  803c42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c46:	eb 50                	jmp    803c98 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c48:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c4b:	48 63 d0             	movslq %eax,%rdx
+  803c4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c52:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803c59:	00 00 00 
+  803c5c:	48 89 ce             	mov    %rcx,%rsi
+  803c5f:	48 89 c7             	mov    %rax,%rdi
+  803c62:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+
+    buf += res;
+  803c6e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c71:	48 98                	cltq
+  803c73:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803c77:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c7a:	48 98                	cltq
+  803c7c:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803c80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c83:	48 98                	cltq
+  803c85:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803c89:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c8e:	0f 85 5d ff ff ff    	jne    803bf1 <devfile_read+0x39>
+  }
+
+  return res0;
+  803c94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803c98:	c9                   	leave
+  803c99:	c3                   	ret
+
+0000000000803c9a <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+  803c9e:	48 83 ec 50          	sub    $0x50,%rsp
+  803ca2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ca6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803caa:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803cae:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803cb3:	74 07                	je     803cbc <devfile_write+0x22>
+  803cb5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803cba:	75 0a                	jne    803cc6 <devfile_write+0x2c>
+  return E_INVAL;
+  803cbc:	b8 03 00 00 00       	mov    $0x3,%eax
+  803cc1:	e9 c9 00 00 00       	jmp    803d8f <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803cc6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ccd:	00 
+
+  while (n) {
+  803cce:	e9 ad 00 00 00       	jmp    803d80 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803cd3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803cd7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803cdb:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803ce2:	00 
+  803ce3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ce7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ceb:	48 39 c2             	cmp    %rax,%rdx
+  803cee:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803cf2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803cf6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803cfa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfe:	48 89 c6             	mov    %rax,%rsi
+  803d01:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  803d08:	00 00 00 
+  803d0b:	48 89 c7             	mov    %rax,%rdi
+  803d0e:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  803d15:	00 00 00 
+  803d18:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d1e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d21:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d28:	00 00 00 
+  803d2b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803d2d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d34:	00 00 00 
+  803d37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d3b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  803d44:	bf 04 00 00 00       	mov    $0x4,%edi
+  803d49:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803d50:	00 00 00 
+  803d53:	ff d0                	call   *%rax
+  803d55:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803d58:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d5c:	79 07                	jns    803d65 <devfile_write+0xcb>
+      return res;
+  803d5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d61:	48 98                	cltq
+  803d63:	eb 2a                	jmp    803d8f <devfile_write+0xf5>
+
+    buf += res;
+  803d65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d68:	48 98                	cltq
+  803d6a:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803d6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d71:	48 98                	cltq
+  803d73:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803d77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d7a:	48 98                	cltq
+  803d7c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803d80:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803d85:	0f 85 48 ff ff ff    	jne    803cd3 <devfile_write+0x39>
+  }
+
+  return res0;
+  803d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803d8f:	c9                   	leave
+  803d90:	c3                   	ret
+
+0000000000803d91 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803d91:	55                   	push   %rbp
+  803d92:	48 89 e5             	mov    %rsp,%rbp
+  803d95:	48 83 ec 20          	sub    $0x20,%rsp
+  803d99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d9d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803da1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803da8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803daf:	00 00 00 
+  803db2:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803db4:	be 00 00 00 00       	mov    $0x0,%esi
+  803db9:	bf 05 00 00 00       	mov    $0x5,%edi
+  803dbe:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803dc5:	00 00 00 
+  803dc8:	ff d0                	call   *%rax
+  803dca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dcd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dd1:	79 05                	jns    803dd8 <devfile_stat+0x47>
+    return r;
+  803dd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dd6:	eb 59                	jmp    803e31 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803dd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ddc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803de3:	00 00 00 
+  803de6:	48 89 d6             	mov    %rdx,%rsi
+  803de9:	48 89 c7             	mov    %rax,%rdi
+  803dec:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803df3:	00 00 00 
+  803df6:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803df8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803dff:	00 00 00 
+  803e02:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803e08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e0c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803e12:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803e19:	00 00 00 
+  803e1c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803e22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e26:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e31:	c9                   	leave
+  803e32:	c3                   	ret
+
+0000000000803e33 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803e33:	55                   	push   %rbp
+  803e34:	48 89 e5             	mov    %rsp,%rbp
+  803e37:	48 83 ec 10          	sub    $0x10,%rsp
+  803e3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e3f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803e42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e46:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e49:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803e50:	00 00 00 
+  803e53:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803e55:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803e5c:	00 00 00 
+  803e5f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e62:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803e65:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6a:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e6f:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803e76:	00 00 00 
+  803e79:	ff d0                	call   *%rax
+}
+  803e7b:	c9                   	leave
+  803e7c:	c3                   	ret
+
+0000000000803e7d <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803e7d:	55                   	push   %rbp
+  803e7e:	48 89 e5             	mov    %rsp,%rbp
+  803e81:	48 83 ec 18          	sub    $0x18,%rsp
+  803e85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e89:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803e8c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803e90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e93:	83 e0 03             	and    $0x3,%eax
+}
+  803e96:	c9                   	leave
+  803e97:	c3                   	ret
+
+0000000000803e98 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803e98:	55                   	push   %rbp
+  803e99:	48 89 e5             	mov    %rsp,%rbp
+  803e9c:	48 83 ec 10          	sub    $0x10,%rsp
+  803ea0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803ea4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ea8:	48 89 c7             	mov    %rax,%rdi
+  803eab:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803eb2:	00 00 00 
+  803eb5:	ff d0                	call   *%rax
+  803eb7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803ebc:	7e 07                	jle    803ec5 <remove+0x2d>
+    return -E_BAD_PATH;
+  803ebe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ec3:	eb 36                	jmp    803efb <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803ec5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ec9:	48 89 c6             	mov    %rax,%rsi
+  803ecc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803ed3:	00 00 00 
+  803ed6:	48 89 c7             	mov    %rax,%rdi
+  803ed9:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803ee0:	00 00 00 
+  803ee3:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  803eea:	bf 07 00 00 00       	mov    $0x7,%edi
+  803eef:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803ef6:	00 00 00 
+  803ef9:	ff d0                	call   *%rax
+}
+  803efb:	c9                   	leave
+  803efc:	c3                   	ret
+
+0000000000803efd <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803efd:	55                   	push   %rbp
+  803efe:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803f01:	be 00 00 00 00       	mov    $0x0,%esi
+  803f06:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f0b:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803f12:	00 00 00 
+  803f15:	ff d0                	call   *%rax
+}
+  803f17:	5d                   	pop    %rbp
+  803f18:	c3                   	ret
+
+0000000000803f19 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803f19:	55                   	push   %rbp
+  803f1a:	48 89 e5             	mov    %rsp,%rbp
+  803f1d:	48 83 ec 20          	sub    $0x20,%rsp
+  803f21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803f25:	be 00 00 00 00       	mov    $0x0,%esi
+  803f2a:	bf 09 00 00 00       	mov    $0x9,%edi
+  803f2f:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+  803f3b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f3e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f42:	79 05                	jns    803f49 <fs_stats+0x30>
+    return r;
+  803f44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f47:	eb 2a                	jmp    803f73 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f4d:	ba 68 00 00 00       	mov    $0x68,%edx
+  803f52:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803f59:	00 00 00 
+  803f5c:	48 89 ce             	mov    %rcx,%rsi
+  803f5f:	48 89 c7             	mov    %rax,%rdi
+  803f62:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  803f69:	00 00 00 
+  803f6c:	ff d0                	call   *%rax
+  return 0;
+  803f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f73:	c9                   	leave
+  803f74:	c3                   	ret
+
+0000000000803f75 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803f75:	55                   	push   %rbp
+  803f76:	48 89 e5             	mov    %rsp,%rbp
+  803f79:	48 83 ec 10          	sub    $0x10,%rsp
+  803f7d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803f80:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803f87:	00 00 00 
+  803f8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f8d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f94:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803f99:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803fa0:	00 00 00 
+  803fa3:	ff d0                	call   *%rax
+}
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+
+0000000000803fa7 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803fa7:	55                   	push   %rbp
+  803fa8:	48 89 e5             	mov    %rsp,%rbp
+  803fab:	48 83 ec 10          	sub    $0x10,%rsp
+  803faf:	89 f8                	mov    %edi,%eax
+  803fb1:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803fb4:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803fb8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803fbf:	00 00 00 
+  803fc2:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803fc4:	be 00 00 00 00       	mov    $0x0,%esi
+  803fc9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803fce:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803fd5:	00 00 00 
+  803fd8:	ff d0                	call   *%rax
+}
+  803fda:	c9                   	leave
+  803fdb:	c3                   	ret
+
+0000000000803fdc <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+  803fe0:	48 83 ec 20          	sub    $0x20,%rsp
+  803fe4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  803fe8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fec:	8b 40 10             	mov    0x10(%rax),%eax
+  803fef:	85 c0                	test   %eax,%eax
+  803ff1:	7e 73                	jle    804066 <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  803ff3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ff7:	8b 40 04             	mov    0x4(%rax),%eax
+  803ffa:	48 63 d0             	movslq %eax,%rdx
+  803ffd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804001:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  804005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804009:	8b 00                	mov    (%rax),%eax
+  80400b:	48 89 ce             	mov    %rcx,%rsi
+  80400e:	89 c7                	mov    %eax,%edi
+  804010:	48 b8 b8 32 80 00 00 	movabs $0x8032b8,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+  80401c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  804020:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804025:	7e 17                	jle    80403e <writebuf+0x62>
+      b->result += result;
+  804027:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80402b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80402f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804033:	48 01 c2             	add    %rax,%rdx
+  804036:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80403a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  80403e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804042:	8b 40 04             	mov    0x4(%rax),%eax
+  804045:	48 98                	cltq
+  804047:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80404b:	74 19                	je     804066 <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  80404d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804051:	ba 00 00 00 00       	mov    $0x0,%edx
+  804056:	48 85 c0             	test   %rax,%rax
+  804059:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80405d:	89 c2                	mov    %eax,%edx
+  80405f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804063:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  804066:	90                   	nop
+  804067:	c9                   	leave
+  804068:	c3                   	ret
+
+0000000000804069 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  804069:	55                   	push   %rbp
+  80406a:	48 89 e5             	mov    %rsp,%rbp
+  80406d:	48 83 ec 20          	sub    $0x20,%rsp
+  804071:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804074:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  804078:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80407c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  804080:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804084:	8b 40 04             	mov    0x4(%rax),%eax
+  804087:	8d 48 01             	lea    0x1(%rax),%ecx
+  80408a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80408e:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804091:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804094:	89 d1                	mov    %edx,%ecx
+  804096:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80409a:	48 98                	cltq
+  80409c:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  8040a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8040a7:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8040ac:	75 1e                	jne    8040cc <putch+0x63>
+    writebuf(b);
+  8040ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040b2:	48 89 c7             	mov    %rax,%rdi
+  8040b5:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  8040bc:	00 00 00 
+  8040bf:	ff d0                	call   *%rax
+    b->idx = 0;
+  8040c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c5:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  8040cc:	90                   	nop
+  8040cd:	c9                   	leave
+  8040ce:	c3                   	ret
+
+00000000008040cf <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8040cf:	55                   	push   %rbp
+  8040d0:	48 89 e5             	mov    %rsp,%rbp
+  8040d3:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8040da:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  8040e0:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  8040e7:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  8040ee:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  8040f4:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  8040fa:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  804101:	00 00 00 
+  b.result = 0;
+  804104:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  80410b:	00 00 00 00 
+  b.error  = 1;
+  80410f:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  804116:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  804119:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  804120:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804127:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80412e:	48 89 c6             	mov    %rax,%rsi
+  804131:	48 b8 69 40 80 00 00 	movabs $0x804069,%rax
+  804138:	00 00 00 
+  80413b:	48 89 c7             	mov    %rax,%rdi
+  80413e:	48 b8 c3 06 80 00 00 	movabs $0x8006c3,%rax
+  804145:	00 00 00 
+  804148:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  80414a:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804150:	85 c0                	test   %eax,%eax
+  804152:	7e 16                	jle    80416a <vfprintf+0x9b>
+    writebuf(&b);
+  804154:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80415b:	48 89 c7             	mov    %rax,%rdi
+  80415e:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  804165:	00 00 00 
+  804168:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  80416a:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804171:	48 85 c0             	test   %rax,%rax
+  804174:	74 09                	je     80417f <vfprintf+0xb0>
+  804176:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80417d:	eb 06                	jmp    804185 <vfprintf+0xb6>
+  80417f:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  804185:	c9                   	leave
+  804186:	c3                   	ret
+
+0000000000804187 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804187:	55                   	push   %rbp
+  804188:	48 89 e5             	mov    %rsp,%rbp
+  80418b:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804192:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  804198:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80419f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8041a6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8041ad:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8041b4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8041bb:	84 c0                	test   %al,%al
+  8041bd:	74 20                	je     8041df <fprintf+0x58>
+  8041bf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8041c3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8041c7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8041cb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8041cf:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8041d3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8041d7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8041db:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8041df:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  8041e6:	00 00 00 
+  8041e9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8041f0:	00 00 00 
+  8041f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041f7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8041fe:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804205:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  80420c:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804213:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  80421a:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804220:	48 89 ce             	mov    %rcx,%rsi
+  804223:	89 c7                	mov    %eax,%edi
+  804225:	48 b8 cf 40 80 00 00 	movabs $0x8040cf,%rax
+  80422c:	00 00 00 
+  80422f:	ff d0                	call   *%rax
+  804231:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804237:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80423d:	c9                   	leave
+  80423e:	c3                   	ret
+
+000000000080423f <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80423f:	55                   	push   %rbp
+  804240:	48 89 e5             	mov    %rsp,%rbp
+  804243:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80424a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804251:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804258:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80425f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804266:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80426d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804274:	84 c0                	test   %al,%al
+  804276:	74 20                	je     804298 <printf+0x59>
+  804278:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80427c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804280:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804284:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804288:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80428c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804290:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804294:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804298:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80429f:	00 00 00 
+  8042a2:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8042a9:	00 00 00 
+  8042ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042b0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8042b7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8042be:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  8042c5:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8042cc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8042d3:	48 89 c6             	mov    %rax,%rsi
+  8042d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042db:	48 b8 cf 40 80 00 00 	movabs $0x8040cf,%rax
+  8042e2:	00 00 00 
+  8042e5:	ff d0                	call   *%rax
+  8042e7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8042ed:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8042f3:	c9                   	leave
+  8042f4:	c3                   	ret
+
+00000000008042f5 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8042f5:	55                   	push   %rbp
+  8042f6:	48 89 e5             	mov    %rsp,%rbp
+  8042f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8042fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804301:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804305:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80430a:	48 89 c7             	mov    %rax,%rdi
+  80430d:	48 b8 1b 43 80 00 00 	movabs $0x80431b,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+}
+  804319:	c9                   	leave
+  80431a:	c3                   	ret
+
+000000000080431b <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  80431b:	55                   	push   %rbp
+  80431c:	48 89 e5             	mov    %rsp,%rbp
+  80431f:	48 83 ec 50          	sub    $0x50,%rsp
+  804323:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804327:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  80432b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804332:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804333:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804338:	74 0a                	je     804344 <pipe_size+0x29>
+  80433a:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804341:	00 
+  804342:	76 0a                	jbe    80434e <pipe_size+0x33>
+    return -E_INVAL;
+  804344:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804349:	e9 cc 02 00 00       	jmp    80461a <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80434e:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804352:	48 89 c7             	mov    %rax,%rdi
+  804355:	48 b8 fe 2a 80 00 00 	movabs $0x802afe,%rax
+  80435c:	00 00 00 
+  80435f:	ff d0                	call   *%rax
+  804361:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804364:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804368:	0f 88 a8 02 00 00    	js     804616 <pipe_size+0x2fb>
+  80436e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804372:	ba 07 04 00 00       	mov    $0x407,%edx
+  804377:	48 89 c6             	mov    %rax,%rsi
+  80437a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437f:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  804386:	00 00 00 
+  804389:	ff d0                	call   *%rax
+  80438b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80438e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804392:	0f 88 7e 02 00 00    	js     804616 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804398:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80439c:	48 89 c7             	mov    %rax,%rdi
+  80439f:	48 b8 fe 2a 80 00 00 	movabs $0x802afe,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+  8043ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043b2:	0f 88 43 02 00 00    	js     8045fb <pipe_size+0x2e0>
+  8043b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043bc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8043c1:	48 89 c6             	mov    %rax,%rsi
+  8043c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c9:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  8043d0:	00 00 00 
+  8043d3:	ff d0                	call   *%rax
+  8043d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043dc:	0f 88 19 02 00 00    	js     8045fb <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8043e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043e6:	48 89 c7             	mov    %rax,%rdi
+  8043e9:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+  8043f5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8043f9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804400:	00 
+  804401:	e9 a2 00 00 00       	jmp    8044a8 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804406:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80440a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80440e:	48 89 c2             	mov    %rax,%rdx
+  804411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804415:	48 01 d0             	add    %rdx,%rax
+  804418:	ba 07 04 00 00       	mov    $0x407,%edx
+  80441d:	48 89 c6             	mov    %rax,%rsi
+  804420:	bf 00 00 00 00       	mov    $0x0,%edi
+  804425:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  80442c:	00 00 00 
+  80442f:	ff d0                	call   *%rax
+  804431:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804434:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804438:	0f 88 37 01 00 00    	js     804575 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80443e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804442:	48 89 c7             	mov    %rax,%rdi
+  804445:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  80444c:	00 00 00 
+  80444f:	ff d0                	call   *%rax
+  804451:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804455:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804459:	48 01 c2             	add    %rax,%rdx
+  80445c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804460:	48 c1 e0 0c          	shl    $0xc,%rax
+  804464:	48 89 c1             	mov    %rax,%rcx
+  804467:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80446b:	48 01 c8             	add    %rcx,%rax
+  80446e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804474:	48 89 d1             	mov    %rdx,%rcx
+  804477:	ba 00 00 00 00       	mov    $0x0,%edx
+  80447c:	48 89 c6             	mov    %rax,%rsi
+  80447f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804484:	48 b8 3f 21 80 00 00 	movabs $0x80213f,%rax
+  80448b:	00 00 00 
+  80448e:	ff d0                	call   *%rax
+  804490:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804493:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804497:	79 0a                	jns    8044a3 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804499:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80449e:	e9 d3 00 00 00       	jmp    804576 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8044a3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8044a8:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8044af:	00 
+  8044b0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8044b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b8:	48 01 d0             	add    %rdx,%rax
+  8044bb:	48 83 c0 1f          	add    $0x1f,%rax
+  8044bf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8044c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044cc:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8044d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044d4:	48 29 d0             	sub    %rdx,%rax
+  8044d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8044db:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8044df:	0f 82 21 ff ff ff    	jb     804406 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8044e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8044ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044f1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8044f5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8044f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044fd:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804504:	00 00 00 
+  804507:	8b 12                	mov    (%rdx),%edx
+  804509:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80450b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80450f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804516:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80451a:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804521:	00 00 00 
+  804524:	8b 12                	mov    (%rdx),%edx
+  804526:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804528:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80452c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804533:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804537:	48 89 c7             	mov    %rax,%rdi
+  80453a:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  804541:	00 00 00 
+  804544:	ff d0                	call   *%rax
+  804546:	89 c2                	mov    %eax,%edx
+  804548:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80454c:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80454e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804552:	48 89 c7             	mov    %rax,%rdi
+  804555:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+  804561:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804565:	48 83 c2 04          	add    $0x4,%rdx
+  804569:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80456b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804570:	e9 a5 00 00 00       	jmp    80461a <pipe_size+0x2ff>
+      goto err2;
+  804575:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804576:	eb 58                	jmp    8045d0 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80457c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804580:	48 89 c2             	mov    %rax,%rdx
+  804583:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804587:	48 01 d0             	add    %rdx,%rax
+  80458a:	48 89 c6             	mov    %rax,%rsi
+  80458d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804592:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804599:	00 00 00 
+  80459c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80459e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045a2:	48 89 c7             	mov    %rax,%rdi
+  8045a5:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8045ac:	00 00 00 
+  8045af:	ff d0                	call   *%rax
+  8045b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8045b5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8045b9:	48 01 d0             	add    %rdx,%rax
+  8045bc:	48 89 c6             	mov    %rax,%rsi
+  8045bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045c4:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8045cb:	00 00 00 
+  8045ce:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8045d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045d4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8045d8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8045dc:	48 85 c0             	test   %rax,%rax
+  8045df:	75 97                	jne    804578 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8045e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045e5:	48 89 c6             	mov    %rax,%rsi
+  8045e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ed:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8045f4:	00 00 00 
+  8045f7:	ff d0                	call   *%rax
+  8045f9:	eb 01                	jmp    8045fc <pipe_size+0x2e1>
+    goto err1;
+  8045fb:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8045fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804600:	48 89 c6             	mov    %rax,%rsi
+  804603:	bf 00 00 00 00       	mov    $0x0,%edi
+  804608:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  80460f:	00 00 00 
+  804612:	ff d0                	call   *%rax
+  804614:	eb 01                	jmp    804617 <pipe_size+0x2fc>
+    goto err;
+  804616:	90                   	nop
+err:
+  return r;
+  804617:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80461a:	c9                   	leave
+  80461b:	c3                   	ret
+
+000000000080461c <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80461c:	55                   	push   %rbp
+  80461d:	48 89 e5             	mov    %rsp,%rbp
+  804620:	53                   	push   %rbx
+  804621:	48 83 ec 28          	sub    $0x28,%rsp
+  804625:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804629:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80462d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804634:	00 00 00 
+  804637:	8b 40 04             	mov    0x4(%rax),%eax
+  80463a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80463f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804646:	00 00 00 
+  804649:	48 98                	cltq
+  80464b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804652:	48 01 d0             	add    %rdx,%rax
+  804655:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80465b:	8b 00                	mov    (%rax),%eax
+  80465d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804660:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804664:	48 89 c7             	mov    %rax,%rdi
+  804667:	48 b8 27 56 80 00 00 	movabs $0x805627,%rax
+  80466e:	00 00 00 
+  804671:	ff d0                	call   *%rax
+  804673:	89 c3                	mov    %eax,%ebx
+  804675:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804679:	48 89 c7             	mov    %rax,%rdi
+  80467c:	48 b8 27 56 80 00 00 	movabs $0x805627,%rax
+  804683:	00 00 00 
+  804686:	ff d0                	call   *%rax
+  804688:	39 c3                	cmp    %eax,%ebx
+  80468a:	0f 94 c0             	sete   %al
+  80468d:	0f b6 c0             	movzbl %al,%eax
+  804690:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804693:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80469a:	00 00 00 
+  80469d:	8b 40 04             	mov    0x4(%rax),%eax
+  8046a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8046a5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8046ac:	00 00 00 
+  8046af:	48 98                	cltq
+  8046b1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8046b8:	48 01 d0             	add    %rdx,%rax
+  8046bb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8046c1:	8b 00                	mov    (%rax),%eax
+  8046c3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8046c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c9:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8046cc:	75 05                	jne    8046d3 <_pipeisclosed+0xb7>
+      return ret;
+  8046ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8046d1:	eb 68                	jmp    80473b <_pipeisclosed+0x11f>
+    if (n != nn)
+  8046d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046d6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8046d9:	0f 84 4e ff ff ff    	je     80462d <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8046df:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8046e6:	00 00 00 
+  8046e9:	8b 40 04             	mov    0x4(%rax),%eax
+  8046ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8046f1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8046f8:	00 00 00 
+  8046fb:	48 98                	cltq
+  8046fd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804704:	48 01 d0             	add    %rdx,%rax
+  804707:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80470d:	8b 10                	mov    (%rax),%edx
+  80470f:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804712:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804715:	89 c6                	mov    %eax,%esi
+  804717:	48 b8 40 5d 80 00 00 	movabs $0x805d40,%rax
+  80471e:	00 00 00 
+  804721:	48 89 c7             	mov    %rax,%rdi
+  804724:	b8 00 00 00 00       	mov    $0x0,%eax
+  804729:	49 b8 69 03 80 00 00 	movabs $0x800369,%r8
+  804730:	00 00 00 
+  804733:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804736:	e9 f2 fe ff ff       	jmp    80462d <_pipeisclosed+0x11>
+  }
+}
+  80473b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80473f:	c9                   	leave
+  804740:	c3                   	ret
+
+0000000000804741 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804741:	55                   	push   %rbp
+  804742:	48 89 e5             	mov    %rsp,%rbp
+  804745:	48 83 ec 30          	sub    $0x30,%rsp
+  804749:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80474c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804750:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804753:	48 89 d6             	mov    %rdx,%rsi
+  804756:	89 c7                	mov    %eax,%edi
+  804758:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+  804764:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804767:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80476b:	79 05                	jns    804772 <pipeisclosed+0x31>
+    return r;
+  80476d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804770:	eb 31                	jmp    8047a3 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804776:	48 89 c7             	mov    %rax,%rdi
+  804779:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  804780:	00 00 00 
+  804783:	ff d0                	call   *%rax
+  804785:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80478d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804791:	48 89 d6             	mov    %rdx,%rsi
+  804794:	48 89 c7             	mov    %rax,%rdi
+  804797:	48 b8 1c 46 80 00 00 	movabs $0x80461c,%rax
+  80479e:	00 00 00 
+  8047a1:	ff d0                	call   *%rax
+}
+  8047a3:	c9                   	leave
+  8047a4:	c3                   	ret
+
+00000000008047a5 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8047a5:	55                   	push   %rbp
+  8047a6:	48 89 e5             	mov    %rsp,%rbp
+  8047a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8047ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8047b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047b5:	8b 40 18             	mov    0x18(%rax),%eax
+  8047b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8047bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047bf:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8047c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047c6:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8047c9:	85 c0                	test   %eax,%eax
+  8047cb:	74 27                	je     8047f4 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8047cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047d1:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8047d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047dc:	48 83 c0 18          	add    $0x18,%rax
+  8047e0:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8047e5:	48 89 c7             	mov    %rax,%rdi
+  8047e8:	48 b8 e2 24 80 00 00 	movabs $0x8024e2,%rax
+  8047ef:	00 00 00 
+  8047f2:	ff d0                	call   *%rax
+  }
+}
+  8047f4:	90                   	nop
+  8047f5:	c9                   	leave
+  8047f6:	c3                   	ret
+
+00000000008047f7 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8047f7:	55                   	push   %rbp
+  8047f8:	48 89 e5             	mov    %rsp,%rbp
+  8047fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8047ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804803:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80480a:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804815:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804819:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80481c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804823:	89 c6                	mov    %eax,%esi
+  804825:	48 89 cf             	mov    %rcx,%rdi
+  804828:	48 b8 93 24 80 00 00 	movabs $0x802493,%rax
+  80482f:	00 00 00 
+  804832:	ff d0                	call   *%rax
+}
+  804834:	90                   	nop
+  804835:	c9                   	leave
+  804836:	c3                   	ret
+
+0000000000804837 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804837:	55                   	push   %rbp
+  804838:	48 89 e5             	mov    %rsp,%rbp
+  80483b:	48 83 ec 70          	sub    $0x70,%rsp
+  80483f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804843:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804847:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80484b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80484f:	48 89 c7             	mov    %rax,%rdi
+  804852:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  804859:	00 00 00 
+  80485c:	ff d0                	call   *%rax
+  80485e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804862:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804867:	75 0a                	jne    804873 <devpipe_read+0x3c>
+    return 0;
+  804869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80486e:	e9 63 01 00 00       	jmp    8049d6 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804873:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804877:	8b 40 18             	mov    0x18(%rax),%eax
+  80487a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80487d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804881:	48 8b 10             	mov    (%rax),%rdx
+  804884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804888:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80488c:	48 39 c2             	cmp    %rax,%rdx
+  80488f:	75 42                	jne    8048d3 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804891:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804895:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804899:	48 89 d6             	mov    %rdx,%rsi
+  80489c:	48 89 c7             	mov    %rax,%rdi
+  80489f:	48 b8 1c 46 80 00 00 	movabs $0x80461c,%rax
+  8048a6:	00 00 00 
+  8048a9:	ff d0                	call   *%rax
+  8048ab:	85 c0                	test   %eax,%eax
+  8048ad:	74 0a                	je     8048b9 <devpipe_read+0x82>
+      return 0;
+  8048af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048b4:	e9 1d 01 00 00       	jmp    8049d6 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8048b9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8048bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048c0:	89 d6                	mov    %edx,%esi
+  8048c2:	48 89 c7             	mov    %rax,%rdi
+  8048c5:	48 b8 f7 47 80 00 00 	movabs $0x8047f7,%rax
+  8048cc:	00 00 00 
+  8048cf:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8048d1:	eb a0                	jmp    804873 <devpipe_read+0x3c>
+      break;
+  8048d3:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8048d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8048d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8048dc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8048e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8048e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048e8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8048ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048f0:	48 8b 00             	mov    (%rax),%rax
+  8048f3:	48 29 c2             	sub    %rax,%rdx
+  8048f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8048fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8048fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804902:	48 39 c2             	cmp    %rax,%rdx
+  804905:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804909:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80490d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804911:	48 8b 00             	mov    (%rax),%rax
+  804914:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804918:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80491c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804921:	48 f7 f1             	div    %rcx
+  804924:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804928:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80492c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804934:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804938:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80493c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804940:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804944:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804948:	48 39 c2             	cmp    %rax,%rdx
+  80494b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80494f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804953:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804957:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80495b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80495f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804963:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804967:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80496b:	48 89 ce             	mov    %rcx,%rsi
+  80496e:	48 89 c7             	mov    %rax,%rdi
+  804971:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  804978:	00 00 00 
+  80497b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80497d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804981:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804985:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804989:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80498d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804991:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804995:	48 01 d1             	add    %rdx,%rcx
+  804998:	48 89 c2             	mov    %rax,%rdx
+  80499b:	48 89 cf             	mov    %rcx,%rdi
+  80499e:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  8049a5:	00 00 00 
+  8049a8:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8049aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049ae:	48 8b 10             	mov    (%rax),%rdx
+  8049b1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8049b5:	48 01 c2             	add    %rax,%rdx
+  8049b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049bc:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8049bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049c3:	48 89 c7             	mov    %rax,%rdi
+  8049c6:	48 b8 a5 47 80 00 00 	movabs $0x8047a5,%rax
+  8049cd:	00 00 00 
+  8049d0:	ff d0                	call   *%rax
+  return n;
+  8049d2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8049d6:	c9                   	leave
+  8049d7:	c3                   	ret
+
+00000000008049d8 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049d8:	55                   	push   %rbp
+  8049d9:	48 89 e5             	mov    %rsp,%rbp
+  8049dc:	48 83 ec 70          	sub    $0x70,%rsp
+  8049e0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8049e4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8049e8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8049ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8049f0:	48 89 c7             	mov    %rax,%rdi
+  8049f3:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  8049fa:	00 00 00 
+  8049fd:	ff d0                	call   *%rax
+  8049ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804a03:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804a07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804a0b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804a12:	00 
+  804a13:	e9 b8 01 00 00       	jmp    804bd0 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a1c:	8b 40 18             	mov    0x18(%rax),%eax
+  804a1f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804a22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a26:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a2e:	48 8b 00             	mov    (%rax),%rax
+  804a31:	48 29 c2             	sub    %rax,%rdx
+  804a34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a38:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a3c:	48 39 c2             	cmp    %rax,%rdx
+  804a3f:	75 4d                	jne    804a8e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804a41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a45:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a49:	48 89 d6             	mov    %rdx,%rsi
+  804a4c:	48 89 c7             	mov    %rax,%rdi
+  804a4f:	48 b8 1c 46 80 00 00 	movabs $0x80461c,%rax
+  804a56:	00 00 00 
+  804a59:	ff d0                	call   *%rax
+  804a5b:	85 c0                	test   %eax,%eax
+  804a5d:	74 0a                	je     804a69 <devpipe_write+0x91>
+        return 0;
+  804a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a64:	e9 79 01 00 00       	jmp    804be2 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804a69:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a70:	89 d6                	mov    %edx,%esi
+  804a72:	48 89 c7             	mov    %rax,%rdi
+  804a75:	48 b8 f7 47 80 00 00 	movabs $0x8047f7,%rax
+  804a7c:	00 00 00 
+  804a7f:	ff d0                	call   *%rax
+      m = 0;
+  804a81:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804a88:	00 
+      continue;
+  804a89:	e9 3a 01 00 00       	jmp    804bc8 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804a8e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804a92:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804a96:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804a9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a9e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804aa2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa6:	48 8b 08             	mov    (%rax),%rcx
+  804aa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ab1:	48 29 c1             	sub    %rax,%rcx
+  804ab4:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804ab8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804abc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ac0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ac4:	48 39 c2             	cmp    %rax,%rdx
+  804ac7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804acb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ad7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804adb:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804adf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ae4:	48 f7 f1             	div    %rcx
+  804ae7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804aeb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804af3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804af7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804afb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804aff:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804b03:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b0b:	48 39 c2             	cmp    %rax,%rdx
+  804b0e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804b12:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804b16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b1a:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804b1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804b22:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804b26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804b2a:	48 01 d1             	add    %rdx,%rcx
+  804b2d:	48 89 c2             	mov    %rax,%rdx
+  804b30:	48 89 cf             	mov    %rcx,%rdi
+  804b33:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  804b3a:	00 00 00 
+  804b3d:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804b3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b43:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b47:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804b4b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804b4f:	73 4d                	jae    804b9e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804b51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b55:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804b5d:	48 29 c2             	sub    %rax,%rdx
+  804b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b64:	48 01 c2             	add    %rax,%rdx
+  804b67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b6b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b6f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804b73:	48 89 c1             	mov    %rax,%rcx
+  804b76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b7a:	48 01 c1             	add    %rax,%rcx
+  804b7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b81:	48 01 c1             	add    %rax,%rcx
+  804b84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b88:	48 83 c0 20          	add    $0x20,%rax
+  804b8c:	48 89 ce             	mov    %rcx,%rsi
+  804b8f:	48 89 c7             	mov    %rax,%rdi
+  804b92:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  804b99:	00 00 00 
+  804b9c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804ba6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804baa:	48 01 c2             	add    %rax,%rdx
+  804bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804bb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb9:	48 89 c7             	mov    %rax,%rdi
+  804bbc:	48 b8 a5 47 80 00 00 	movabs $0x8047a5,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804bc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bcc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804bd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bd4:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804bd8:	0f 82 3a fe ff ff    	jb     804a18 <devpipe_write+0x40>
+  }
+
+  return i;
+  804bde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804be2:	c9                   	leave
+  804be3:	c3                   	ret
+
+0000000000804be4 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804be4:	55                   	push   %rbp
+  804be5:	48 89 e5             	mov    %rsp,%rbp
+  804be8:	48 83 ec 40          	sub    $0x40,%rsp
+  804bec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804bf0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804bf3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804bf7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bfb:	48 89 c7             	mov    %rax,%rdi
+  804bfe:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  804c05:	00 00 00 
+  804c08:	ff d0                	call   *%rax
+  804c0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804c0e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804c15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c19:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804c1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c21:	48 89 d6             	mov    %rdx,%rsi
+  804c24:	48 89 c7             	mov    %rax,%rdi
+  804c27:	48 b8 a6 35 80 00 00 	movabs $0x8035a6,%rax
+  804c2e:	00 00 00 
+  804c31:	ff d0                	call   *%rax
+  804c33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c3a:	79 08                	jns    804c44 <devpipe_poll+0x60>
+    return r;
+  804c3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c3f:	e9 85 00 00 00       	jmp    804cc9 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804c44:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c47:	83 e0 01             	and    $0x1,%eax
+  804c4a:	85 c0                	test   %eax,%eax
+  804c4c:	74 18                	je     804c66 <devpipe_poll+0x82>
+  804c4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c52:	48 8b 10             	mov    (%rax),%rdx
+  804c55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c59:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c5d:	48 39 c2             	cmp    %rax,%rdx
+  804c60:	74 04                	je     804c66 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804c62:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804c66:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c69:	83 e0 02             	and    $0x2,%eax
+  804c6c:	85 c0                	test   %eax,%eax
+  804c6e:	74 23                	je     804c93 <devpipe_poll+0xaf>
+  804c70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c74:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804c78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c7c:	48 8b 00             	mov    (%rax),%rax
+  804c7f:	48 29 c2             	sub    %rax,%rdx
+  804c82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c86:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804c8a:	48 39 c2             	cmp    %rax,%rdx
+  804c8d:	73 04                	jae    804c93 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804c8f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804c93:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c9b:	48 89 d6             	mov    %rdx,%rsi
+  804c9e:	48 89 c7             	mov    %rax,%rdi
+  804ca1:	48 b8 1c 46 80 00 00 	movabs $0x80461c,%rax
+  804ca8:	00 00 00 
+  804cab:	ff d0                	call   *%rax
+  804cad:	85 c0                	test   %eax,%eax
+  804caf:	74 04                	je     804cb5 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804cb1:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804cb5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cb9:	75 0b                	jne    804cc6 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804cbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cbf:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804cc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804cc9:	c9                   	leave
+  804cca:	c3                   	ret
+
+0000000000804ccb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804ccb:	55                   	push   %rbp
+  804ccc:	48 89 e5             	mov    %rsp,%rbp
+  804ccf:	48 83 ec 20          	sub    $0x20,%rsp
+  804cd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804cd7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804cdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cdf:	48 89 c7             	mov    %rax,%rdi
+  804ce2:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  804ce9:	00 00 00 
+  804cec:	ff d0                	call   *%rax
+  804cee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804cf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cf6:	48 ba 71 5d 80 00 00 	movabs $0x805d71,%rdx
+  804cfd:	00 00 00 
+  804d00:	48 89 d6             	mov    %rdx,%rsi
+  804d03:	48 89 c7             	mov    %rax,%rdi
+  804d06:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  804d0d:	00 00 00 
+  804d10:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804d12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d1a:	89 c1                	mov    %eax,%ecx
+  804d1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d20:	48 8b 00             	mov    (%rax),%rax
+  804d23:	89 c2                	mov    %eax,%edx
+  804d25:	89 c8                	mov    %ecx,%eax
+  804d27:	29 d0                	sub    %edx,%eax
+  804d29:	89 c2                	mov    %eax,%edx
+  804d2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d2f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804d35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d39:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804d40:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804d43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d47:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804d4e:	00 00 00 
+  804d51:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804d58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d5d:	c9                   	leave
+  804d5e:	c3                   	ret
+
+0000000000804d5f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804d5f:	55                   	push   %rbp
+  804d60:	48 89 e5             	mov    %rsp,%rbp
+  804d63:	48 83 ec 40          	sub    $0x40,%rsp
+  804d67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d6f:	48 89 c7             	mov    %rax,%rdi
+  804d72:	48 b8 d3 2a 80 00 00 	movabs $0x802ad3,%rax
+  804d79:	00 00 00 
+  804d7c:	ff d0                	call   *%rax
+  804d7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804d82:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804d89:	00 
+  804d8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d8e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804d92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d96:	48 01 d0             	add    %rdx,%rax
+  804d99:	48 83 c0 1f          	add    $0x1f,%rax
+  804d9d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804da1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804daa:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804dae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db2:	48 29 d0             	sub    %rdx,%rax
+  804db5:	48 c1 e8 0c          	shr    $0xc,%rax
+  804db9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804dbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dc1:	48 89 c6             	mov    %rax,%rsi
+  804dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dc9:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804dd0:	00 00 00 
+  804dd3:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804dd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dd9:	48 89 c7             	mov    %rax,%rdi
+  804ddc:	48 b8 a5 47 80 00 00 	movabs $0x8047a5,%rax
+  804de3:	00 00 00 
+  804de6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804de8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804df0:	eb 2f                	jmp    804e21 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804df2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df6:	48 83 e8 01          	sub    $0x1,%rax
+  804dfa:	48 c1 e0 0c          	shl    $0xc,%rax
+  804dfe:	48 89 c2             	mov    %rax,%rdx
+  804e01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e05:	48 01 d0             	add    %rdx,%rax
+  804e08:	48 89 c6             	mov    %rax,%rsi
+  804e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e10:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804e17:	00 00 00 
+  804e1a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804e1c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804e21:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804e26:	77 ca                	ja     804df2 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804e28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e2c:	48 89 c6             	mov    %rax,%rsi
+  804e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e34:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804e3b:	00 00 00 
+  804e3e:	ff d0                	call   *%rax
+}
+  804e40:	c9                   	leave
+  804e41:	c3                   	ret
+
+0000000000804e42 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804e42:	55                   	push   %rbp
+  804e43:	48 89 e5             	mov    %rsp,%rbp
+  804e46:	48 83 ec 08          	sub    $0x8,%rsp
+  804e4a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804e4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e51:	75 10                	jne    804e63 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804e53:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e5a:	00 00 00 
+  804e5d:	8b 00                	mov    (%rax),%eax
+  804e5f:	48 98                	cltq
+  804e61:	eb 05                	jmp    804e68 <vsyscall+0x26>
+  }
+  return 0;
+  804e63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e68:	c9                   	leave
+  804e69:	c3                   	ret
+
+0000000000804e6a <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804e6a:	55                   	push   %rbp
+  804e6b:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e73:	48 b8 42 4e 80 00 00 	movabs $0x804e42,%rax
+  804e7a:	00 00 00 
+  804e7d:	ff d0                	call   *%rax
+}
+  804e7f:	5d                   	pop    %rbp
+  804e80:	c3                   	ret
+
+0000000000804e81 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804e81:	55                   	push   %rbp
+  804e82:	48 89 e5             	mov    %rsp,%rbp
+  804e85:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804e89:	0f 31                	rdtsc
+  804e8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e8e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804e91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e94:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804e97:	48 c1 e2 20          	shl    $0x20,%rdx
+  804e9b:	48 09 d0             	or     %rdx,%rax
+  804e9e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804ea2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804ea6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804eaa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804eb1:	00 00 00 
+  804eb4:	8b 40 08             	mov    0x8(%rax),%eax
+  804eb7:	48 98                	cltq
+  804eb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804ebd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec1:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ec6:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804eca:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804ed1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eda:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804ede:	48 89 d0             	mov    %rdx,%rax
+  804ee1:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804ee8:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eed:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804ef1:	48 01 c8             	add    %rcx,%rax
+}
+  804ef4:	c9                   	leave
+  804ef5:	c3                   	ret
+
+0000000000804ef6 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804ef6:	55                   	push   %rbp
+  804ef7:	48 89 e5             	mov    %rsp,%rbp
+  804efa:	48 83 ec 20          	sub    $0x20,%rsp
+  804efe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804f01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f04:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804f07:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804f0b:	be 01 00 00 00       	mov    $0x1,%esi
+  804f10:	48 89 c7             	mov    %rax,%rdi
+  804f13:	48 b8 d0 1e 80 00 00 	movabs $0x801ed0,%rax
+  804f1a:	00 00 00 
+  804f1d:	ff d0                	call   *%rax
+}
+  804f1f:	90                   	nop
+  804f20:	c9                   	leave
+  804f21:	c3                   	ret
+
+0000000000804f22 <getchar>:
+
+int
+getchar(void) {
+  804f22:	55                   	push   %rbp
+  804f23:	48 89 e5             	mov    %rsp,%rbp
+  804f26:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804f2a:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804f2e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804f33:	48 89 c6             	mov    %rax,%rsi
+  804f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f3b:	48 b8 3c 31 80 00 00 	movabs $0x80313c,%rax
+  804f42:	00 00 00 
+  804f45:	ff d0                	call   *%rax
+  804f47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804f4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f4e:	79 05                	jns    804f55 <getchar+0x33>
+    return r;
+  804f50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f53:	eb 14                	jmp    804f69 <getchar+0x47>
+  if (r < 1)
+  804f55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f59:	7f 07                	jg     804f62 <getchar+0x40>
+    return -E_EOF;
+  804f5b:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804f60:	eb 07                	jmp    804f69 <getchar+0x47>
+  return c;
+  804f62:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804f66:	0f b6 c0             	movzbl %al,%eax
+}
+  804f69:	c9                   	leave
+  804f6a:	c3                   	ret
+
+0000000000804f6b <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804f6b:	55                   	push   %rbp
+  804f6c:	48 89 e5             	mov    %rsp,%rbp
+  804f6f:	48 83 ec 20          	sub    $0x20,%rsp
+  804f73:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804f76:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804f7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f7d:	48 89 d6             	mov    %rdx,%rsi
+  804f80:	89 c7                	mov    %eax,%edi
+  804f82:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  804f89:	00 00 00 
+  804f8c:	ff d0                	call   *%rax
+  804f8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f95:	79 05                	jns    804f9c <iscons+0x31>
+    return r;
+  804f97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f9a:	eb 1a                	jmp    804fb6 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804f9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fa0:	8b 10                	mov    (%rax),%edx
+  804fa2:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804fa9:	00 00 00 
+  804fac:	8b 00                	mov    (%rax),%eax
+  804fae:	39 c2                	cmp    %eax,%edx
+  804fb0:	0f 94 c0             	sete   %al
+  804fb3:	0f b6 c0             	movzbl %al,%eax
+}
+  804fb6:	c9                   	leave
+  804fb7:	c3                   	ret
+
+0000000000804fb8 <opencons>:
+
+int
+opencons(void) {
+  804fb8:	55                   	push   %rbp
+  804fb9:	48 89 e5             	mov    %rsp,%rbp
+  804fbc:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804fc0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804fc4:	48 89 c7             	mov    %rax,%rdi
+  804fc7:	48 b8 fe 2a 80 00 00 	movabs $0x802afe,%rax
+  804fce:	00 00 00 
+  804fd1:	ff d0                	call   *%rax
+  804fd3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804fd6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fda:	79 05                	jns    804fe1 <opencons+0x29>
+    return r;
+  804fdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fdf:	eb 66                	jmp    805047 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804fe1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fe5:	ba 07 04 00 00       	mov    $0x407,%edx
+  804fea:	48 89 c6             	mov    %rax,%rsi
+  804fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff2:	48 b8 e7 20 80 00 00 	movabs $0x8020e7,%rax
+  804ff9:	00 00 00 
+  804ffc:	ff d0                	call   *%rax
+  804ffe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805001:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805005:	79 05                	jns    80500c <opencons+0x54>
+    return r;
+  805007:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80500a:	eb 3b                	jmp    805047 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  80500c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805010:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  805017:	00 00 00 
+  80501a:	8b 12                	mov    (%rdx),%edx
+  80501c:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  80501e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805022:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805029:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80502d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805034:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805038:	48 89 c7             	mov    %rax,%rdi
+  80503b:	48 b8 b0 2a 80 00 00 	movabs $0x802ab0,%rax
+  805042:	00 00 00 
+  805045:	ff d0                	call   *%rax
+}
+  805047:	c9                   	leave
+  805048:	c3                   	ret
+
+0000000000805049 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805049:	55                   	push   %rbp
+  80504a:	48 89 e5             	mov    %rsp,%rbp
+  80504d:	48 83 ec 20          	sub    $0x20,%rsp
+  805051:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805054:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805057:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80505b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80505e:	48 89 d6             	mov    %rdx,%rsi
+  805061:	89 c7                	mov    %eax,%edi
+  805063:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  80506a:	00 00 00 
+  80506d:	ff d0                	call   *%rax
+  80506f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805072:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805076:	79 05                	jns    80507d <consmode+0x34>
+    return r;
+  805078:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80507b:	eb 34                	jmp    8050b1 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80507d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805081:	8b 10                	mov    (%rax),%edx
+  805083:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  80508a:	00 00 00 
+  80508d:	8b 00                	mov    (%rax),%eax
+  80508f:	39 c2                	cmp    %eax,%edx
+  805091:	74 07                	je     80509a <consmode+0x51>
+    return -E_INVAL;
+  805093:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805098:	eb 17                	jmp    8050b1 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80509a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80509e:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8050a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050a8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8050ab:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8050ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8050b1:	c9                   	leave
+  8050b2:	c3                   	ret
+
+00000000008050b3 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8050b3:	55                   	push   %rbp
+  8050b4:	48 89 e5             	mov    %rsp,%rbp
+  8050b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8050bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8050bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8050c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8050c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050cb:	8b 50 0c             	mov    0xc(%rax),%edx
+  8050ce:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8050d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050d6:	48 89 ce             	mov    %rcx,%rsi
+  8050d9:	48 89 c7             	mov    %rax,%rdi
+  8050dc:	48 b8 41 24 80 00 00 	movabs $0x802441,%rax
+  8050e3:	00 00 00 
+  8050e6:	ff d0                	call   *%rax
+  8050e8:	48 98                	cltq
+}
+  8050ea:	c9                   	leave
+  8050eb:	c3                   	ret
+
+00000000008050ec <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8050ec:	55                   	push   %rbp
+  8050ed:	48 89 e5             	mov    %rsp,%rbp
+  8050f0:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8050f7:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8050fe:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805105:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  80510c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805113:	eb 74                	jmp    805189 <devcons_write+0x9d>
+    m = n - tot;
+  805115:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80511c:	89 c2                	mov    %eax,%edx
+  80511e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805121:	29 c2                	sub    %eax,%edx
+  805123:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805126:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805129:	83 f8 7f             	cmp    $0x7f,%eax
+  80512c:	76 07                	jbe    805135 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  80512e:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805135:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805138:	48 63 d0             	movslq %eax,%rdx
+  80513b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80513e:	48 63 c8             	movslq %eax,%rcx
+  805141:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805148:	48 01 c1             	add    %rax,%rcx
+  80514b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805152:	48 89 ce             	mov    %rcx,%rsi
+  805155:	48 89 c7             	mov    %rax,%rdi
+  805158:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  80515f:	00 00 00 
+  805162:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805164:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805167:	48 63 d0             	movslq %eax,%rdx
+  80516a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805171:	48 89 d6             	mov    %rdx,%rsi
+  805174:	48 89 c7             	mov    %rax,%rdi
+  805177:	48 b8 d0 1e 80 00 00 	movabs $0x801ed0,%rax
+  80517e:	00 00 00 
+  805181:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805183:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805186:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805189:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80518c:	48 98                	cltq
+  80518e:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805195:	0f 82 7a ff ff ff    	jb     805115 <devcons_write+0x29>
+  }
+  return tot;
+  80519b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80519e:	48 98                	cltq
+}
+  8051a0:	c9                   	leave
+  8051a1:	c3                   	ret
+
+00000000008051a2 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8051a2:	55                   	push   %rbp
+  8051a3:	48 89 e5             	mov    %rsp,%rbp
+  8051a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8051aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8051ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051b3:	c9                   	leave
+  8051b4:	c3                   	ret
+
+00000000008051b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8051b5:	55                   	push   %rbp
+  8051b6:	48 89 e5             	mov    %rsp,%rbp
+  8051b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8051bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8051c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8051c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c9:	48 ba 7d 5d 80 00 00 	movabs $0x805d7d,%rdx
+  8051d0:	00 00 00 
+  8051d3:	48 89 d6             	mov    %rdx,%rsi
+  8051d6:	48 89 c7             	mov    %rax,%rdi
+  8051d9:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  8051e0:	00 00 00 
+  8051e3:	ff d0                	call   *%rax
+  return 0;
+  8051e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051ea:	c9                   	leave
+  8051eb:	c3                   	ret
+
+00000000008051ec <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8051ec:	55                   	push   %rbp
+  8051ed:	48 89 e5             	mov    %rsp,%rbp
+  8051f0:	48 83 ec 30          	sub    $0x30,%rsp
+  8051f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051f8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8051fb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8051ff:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805206:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805209:	83 e0 02             	and    $0x2,%eax
+  80520c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  80520f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805213:	8b 40 0c             	mov    0xc(%rax),%eax
+  805216:	83 f8 01             	cmp    $0x1,%eax
+  805219:	75 04                	jne    80521f <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  80521b:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  80521f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805222:	83 e0 01             	and    $0x1,%eax
+  805225:	85 c0                	test   %eax,%eax
+  805227:	74 44                	je     80526d <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80522c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805231:	89 c2                	mov    %eax,%edx
+  805233:	be 00 00 00 00       	mov    $0x0,%esi
+  805238:	bf 00 00 00 00       	mov    $0x0,%edi
+  80523d:	48 b8 2f 25 80 00 00 	movabs $0x80252f,%rax
+  805244:	00 00 00 
+  805247:	ff d0                	call   *%rax
+  805249:	83 f8 01             	cmp    $0x1,%eax
+  80524c:	75 06                	jne    805254 <devcons_poll+0x68>
+      revents |= POLLIN;
+  80524e:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805252:	eb 19                	jmp    80526d <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805254:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805258:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80525e:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805261:	89 c2                	mov    %eax,%edx
+  805263:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805267:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  80526d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805270:	c9                   	leave
+  805271:	c3                   	ret
+
+0000000000805272 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805272:	55                   	push   %rbp
+  805273:	48 89 e5             	mov    %rsp,%rbp
+  805276:	53                   	push   %rbx
+  805277:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80527e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  805285:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80528b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  805292:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  805299:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8052a0:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8052a7:	84 c0                	test   %al,%al
+  8052a9:	74 23                	je     8052ce <_panic+0x5c>
+  8052ab:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8052b2:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8052b6:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8052ba:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8052be:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8052c2:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8052c6:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8052ca:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8052ce:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8052d5:	00 00 00 
+  8052d8:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8052df:	00 00 00 
+  8052e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8052e6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8052ed:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8052f4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8052fb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  805302:	00 00 00 
+  805305:	48 8b 18             	mov    (%rax),%rbx
+  805308:	48 b8 6e 20 80 00 00 	movabs $0x80206e,%rax
+  80530f:	00 00 00 
+  805312:	ff d0                	call   *%rax
+  805314:	89 c6                	mov    %eax,%esi
+  805316:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80531c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  805323:	41 89 d0             	mov    %edx,%r8d
+  805326:	48 89 c1             	mov    %rax,%rcx
+  805329:	48 89 da             	mov    %rbx,%rdx
+  80532c:	48 b8 88 5d 80 00 00 	movabs $0x805d88,%rax
+  805333:	00 00 00 
+  805336:	48 89 c7             	mov    %rax,%rdi
+  805339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80533e:	49 b9 69 03 80 00 00 	movabs $0x800369,%r9
+  805345:	00 00 00 
+  805348:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80534b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  805352:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805359:	48 89 d6             	mov    %rdx,%rsi
+  80535c:	48 89 c7             	mov    %rax,%rdi
+  80535f:	48 b8 de 02 80 00 00 	movabs $0x8002de,%rax
+  805366:	00 00 00 
+  805369:	ff d0                	call   *%rax
+  cprintf("\n");
+  80536b:	48 b8 ab 5d 80 00 00 	movabs $0x805dab,%rax
+  805372:	00 00 00 
+  805375:	48 89 c7             	mov    %rax,%rdi
+  805378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537d:	48 ba 69 03 80 00 00 	movabs $0x800369,%rdx
+  805384:	00 00 00 
+  805387:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805389:	cc                   	int3
+  80538a:	eb fd                	jmp    805389 <_panic+0x117>
+
+000000000080538c <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80538c:	55                   	push   %rbp
+  80538d:	48 89 e5             	mov    %rsp,%rbp
+  805390:	48 83 ec 20          	sub    $0x20,%rsp
+  805394:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805398:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80539c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8053a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8053a4:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8053a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ac:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8053b3:	48 89 c7             	mov    %rax,%rdi
+  8053b6:	48 b8 c4 53 80 00 00 	movabs $0x8053c4,%rax
+  8053bd:	00 00 00 
+  8053c0:	ff d0                	call   *%rax
+}
+  8053c2:	c9                   	leave
+  8053c3:	c3                   	ret
+
+00000000008053c4 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8053c4:	55                   	push   %rbp
+  8053c5:	48 89 e5             	mov    %rsp,%rbp
+  8053c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8053cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8053d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8053d4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8053d8:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8053dc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8053e1:	75 0e                	jne    8053f1 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8053e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8053ea:	00 00 00 
+  8053ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8053f1:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8053f6:	75 18                	jne    805410 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8053f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053fc:	48 89 c7             	mov    %rax,%rdi
+  8053ff:	48 b8 27 23 80 00 00 	movabs $0x802327,%rax
+  805406:	00 00 00 
+  805409:	ff d0                	call   *%rax
+  80540b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80540e:	eb 1d                	jmp    80542d <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805410:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805414:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805418:	48 89 d6             	mov    %rdx,%rsi
+  80541b:	48 89 c7             	mov    %rax,%rdi
+  80541e:	48 b8 6d 23 80 00 00 	movabs $0x80236d,%rax
+  805425:	00 00 00 
+  805428:	ff d0                	call   *%rax
+  80542a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80542d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805431:	79 2a                	jns    80545d <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805433:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805438:	74 0a                	je     805444 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  80543a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80543e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805444:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805449:	74 0a                	je     805455 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  80544b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80544f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805455:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805458:	e9 aa 00 00 00       	jmp    805507 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80545d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805462:	74 36                	je     80549a <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805464:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80546b:	00 00 00 
+  80546e:	8b 40 04             	mov    0x4(%rax),%eax
+  805471:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805476:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80547d:	00 00 00 
+  805480:	48 98                	cltq
+  805482:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805489:	48 01 d0             	add    %rdx,%rax
+  80548c:	48 05 24 01 00 00    	add    $0x124,%rax
+  805492:	8b 10                	mov    (%rax),%edx
+  805494:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805498:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80549a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80549f:	74 36                	je     8054d7 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8054a1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8054a8:	00 00 00 
+  8054ab:	8b 40 04             	mov    0x4(%rax),%eax
+  8054ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8054b3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8054ba:	00 00 00 
+  8054bd:	48 98                	cltq
+  8054bf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8054c6:	48 01 d0             	add    %rdx,%rax
+  8054c9:	48 05 28 01 00 00    	add    $0x128,%rax
+  8054cf:	8b 10                	mov    (%rax),%edx
+  8054d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054d5:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8054d7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8054de:	00 00 00 
+  8054e1:	8b 40 04             	mov    0x4(%rax),%eax
+  8054e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8054e9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8054f0:	00 00 00 
+  8054f3:	48 98                	cltq
+  8054f5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8054fc:	48 01 d0             	add    %rdx,%rax
+  8054ff:	48 05 20 01 00 00    	add    $0x120,%rax
+  805505:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805507:	c9                   	leave
+  805508:	c3                   	ret
+
+0000000000805509 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805509:	55                   	push   %rbp
+  80550a:	48 89 e5             	mov    %rsp,%rbp
+  80550d:	48 83 ec 30          	sub    $0x30,%rsp
+  805511:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805514:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805517:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80551b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80551e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805523:	75 5e                	jne    805583 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805525:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80552c:	00 00 00 
+  80552f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805533:	eb 4e                	jmp    805583 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805535:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805539:	79 3c                	jns    805577 <ipc_send+0x6e>
+  80553b:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80553f:	74 36                	je     805577 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805541:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805544:	89 c1                	mov    %eax,%ecx
+  805546:	48 b8 b0 5d 80 00 00 	movabs $0x805db0,%rax
+  80554d:	00 00 00 
+  805550:	48 89 c2             	mov    %rax,%rdx
+  805553:	be 54 00 00 00       	mov    $0x54,%esi
+  805558:	48 b8 d6 5d 80 00 00 	movabs $0x805dd6,%rax
+  80555f:	00 00 00 
+  805562:	48 89 c7             	mov    %rax,%rdi
+  805565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80556a:	49 b8 72 52 80 00 00 	movabs $0x805272,%r8
+  805571:	00 00 00 
+  805574:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805577:	48 b8 aa 20 80 00 00 	movabs $0x8020aa,%rax
+  80557e:	00 00 00 
+  805581:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805583:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805586:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805589:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80558d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805590:	89 c7                	mov    %eax,%edi
+  805592:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+  80559e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055a5:	75 8e                	jne    805535 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8055a7:	48 b8 aa 20 80 00 00 	movabs $0x8020aa,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+}
+  8055b3:	90                   	nop
+  8055b4:	c9                   	leave
+  8055b5:	c3                   	ret
+
+00000000008055b6 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8055b6:	55                   	push   %rbp
+  8055b7:	48 89 e5             	mov    %rsp,%rbp
+  8055ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8055be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8055c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8055c8:	eb 4d                	jmp    805617 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8055ca:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8055d1:	00 00 00 
+  8055d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055d7:	48 98                	cltq
+  8055d9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8055e0:	48 01 d0             	add    %rdx,%rax
+  8055e3:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8055e9:	8b 00                	mov    (%rax),%eax
+  8055eb:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8055ee:	75 23                	jne    805613 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8055f0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8055f7:	00 00 00 
+  8055fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055fd:	48 98                	cltq
+  8055ff:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805606:	48 01 d0             	add    %rdx,%rax
+  805609:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80560f:	8b 00                	mov    (%rax),%eax
+  805611:	eb 12                	jmp    805625 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805613:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805617:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80561e:	7e aa                	jle    8055ca <ipc_find_env+0x14>
+  return 0;
+  805620:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805625:	c9                   	leave
+  805626:	c3                   	ret
+
+0000000000805627 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805627:	55                   	push   %rbp
+  805628:	48 89 e5             	mov    %rsp,%rbp
+  80562b:	48 83 ec 18          	sub    $0x18,%rsp
+  80562f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805637:	48 c1 e8 27          	shr    $0x27,%rax
+  80563b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805640:	48 89 c2             	mov    %rax,%rdx
+  805643:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80564a:	01 00 00 
+  80564d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805651:	83 e0 01             	and    $0x1,%eax
+  805654:	48 85 c0             	test   %rax,%rax
+  805657:	74 63                	je     8056bc <pageref+0x95>
+  805659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80565d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805661:	48 89 c2             	mov    %rax,%rdx
+  805664:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80566b:	01 00 00 
+  80566e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805672:	83 e0 01             	and    $0x1,%eax
+  805675:	48 85 c0             	test   %rax,%rax
+  805678:	74 42                	je     8056bc <pageref+0x95>
+  80567a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80567e:	48 c1 e8 15          	shr    $0x15,%rax
+  805682:	48 89 c2             	mov    %rax,%rdx
+  805685:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80568c:	01 00 00 
+  80568f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805693:	83 e0 01             	and    $0x1,%eax
+  805696:	48 85 c0             	test   %rax,%rax
+  805699:	74 21                	je     8056bc <pageref+0x95>
+  80569b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80569f:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056a3:	48 89 c2             	mov    %rax,%rdx
+  8056a6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8056ad:	01 00 00 
+  8056b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8056b4:	83 e0 01             	and    $0x1,%eax
+  8056b7:	48 85 c0             	test   %rax,%rax
+  8056ba:	75 07                	jne    8056c3 <pageref+0x9c>
+    return 0;
+  8056bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056c1:	eb 53                	jmp    805716 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8056c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056cb:	48 89 c2             	mov    %rax,%rdx
+  8056ce:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8056d5:	01 00 00 
+  8056d8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8056dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8056e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056e4:	83 e0 01             	and    $0x1,%eax
+  8056e7:	48 85 c0             	test   %rax,%rax
+  8056ea:	75 07                	jne    8056f3 <pageref+0xcc>
+    return 0;
+  8056ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056f1:	eb 23                	jmp    805716 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8056f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056f7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056fb:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805702:	00 00 00 
+  805705:	48 c1 e0 04          	shl    $0x4,%rax
+  805709:	48 01 d0             	add    %rdx,%rax
+  80570c:	48 83 c0 08          	add    $0x8,%rax
+  805710:	0f b7 00             	movzwl (%rax),%eax
+  805713:	0f b7 c0             	movzwl %ax,%eax
+}
+  805716:	c9                   	leave
+  805717:	c3                   	ret
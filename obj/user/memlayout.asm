@@ -0,0 +1,10401 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 f9 04 00 00       	call   800525 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <memlayout>:
+#ifndef PTE_SHARE
+#define PTE_SHARE 0x400
+#endif // PTE_SHARE
+
+void
+memlayout(void) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  pte_t *pg;
+  uintptr_t addr;
+  size_t total_p   = 0;
+  80003a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800041:	00 
+  size_t total_u   = 0;
+  800042:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800049:	00 
+  size_t total_w   = 0;
+  80004a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  800051:	00 
+  size_t total_cow = 0;
+  800052:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800059:	00 
+
+  cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  80005a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800061:	00 00 00 
+  800064:	8b 40 04             	mov    0x4(%rax),%eax
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800073:	00 00 00 
+  800076:	48 98                	cltq
+  800078:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80007f:	48 01 d0             	add    %rdx,%rax
+  800082:	48 05 cc 00 00 00    	add    $0xcc,%rax
+  800088:	8b 10                	mov    (%rax),%edx
+  80008a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800091:	00 00 00 
+  800094:	8b 40 04             	mov    0x4(%rax),%eax
+  800097:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009c:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  8000a3:	00 00 00 
+  8000a6:	48 98                	cltq
+  8000a8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8000af:	48 01 c8             	add    %rcx,%rax
+  8000b2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8000b8:	8b 00                	mov    (%rax),%eax
+  8000ba:	89 c6                	mov    %eax,%esi
+  8000bc:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  8000c3:	00 00 00 
+  8000c6:	48 89 c7             	mov    %rax,%rdi
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 b9 eb 07 80 00 00 	movabs $0x8007eb,%rcx
+  8000d5:	00 00 00 
+  8000d8:	ff d1                	call   *%rcx
+  cprintf("pml4e: %lx, uvpd: %lx, uvpt: %lx\n",
+  8000da:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8000e1:	01 00 00 
+  8000e4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8000eb:	01 00 00 
+          (unsigned long)thisenv->env_pml4e,
+  8000ee:	48 b9 00 e0 02 3c 80 	movabs $0x803c02e000,%rcx
+  8000f5:	00 00 00 
+  8000f8:	8b 49 04             	mov    0x4(%rcx),%ecx
+  8000fb:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  800101:	48 be 00 e0 22 3c 80 	movabs $0x803c22e000,%rsi
+  800108:	00 00 00 
+  80010b:	48 63 c9             	movslq %ecx,%rcx
+  80010e:	48 69 c9 68 02 00 00 	imul   $0x268,%rcx,%rcx
+  800115:	48 01 f1             	add    %rsi,%rcx
+  800118:	48 81 c1 e8 00 00 00 	add    $0xe8,%rcx
+  80011f:	48 8b 09             	mov    (%rcx),%rcx
+  cprintf("pml4e: %lx, uvpd: %lx, uvpt: %lx\n",
+  800122:	48 89 ce             	mov    %rcx,%rsi
+  800125:	48 89 d1             	mov    %rdx,%rcx
+  800128:	48 89 c2             	mov    %rax,%rdx
+  80012b:	48 b8 18 68 80 00 00 	movabs $0x806818,%rax
+  800132:	00 00 00 
+  800135:	48 89 c7             	mov    %rax,%rdi
+  800138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013d:	49 b8 eb 07 80 00 00 	movabs $0x8007eb,%r8
+  800144:	00 00 00 
+  800147:	41 ff d0             	call   *%r8
+          (unsigned long)uvpd,
+          (unsigned long)uvpt);
+
+  for (addr = 0; addr < KERNBASE; addr += PGSIZE) {
+  80014a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800151:	00 
+  800152:	e9 bb 01 00 00       	jmp    800312 <memlayout+0x2e0>
+    if ((uvpml4e[PML4(addr)] & PTE_P) == 0 ||
+  800157:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80015b:	48 c1 e8 27          	shr    $0x27,%rax
+  80015f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  800164:	48 89 c2             	mov    %rax,%rdx
+  800167:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80016e:	01 00 00 
+  800171:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800175:	83 e0 01             	and    $0x1,%eax
+  800178:	48 85 c0             	test   %rax,%rax
+  80017b:	0f 84 88 01 00 00    	je     800309 <memlayout+0x2d7>
+        (uvpde[VPDPE(addr)] & PTE_P) == 0 ||
+  800181:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800185:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800189:	48 89 c2             	mov    %rax,%rdx
+  80018c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800193:	01 00 00 
+  800196:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80019a:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[PML4(addr)] & PTE_P) == 0 ||
+  80019d:	48 85 c0             	test   %rax,%rax
+  8001a0:	0f 84 63 01 00 00    	je     800309 <memlayout+0x2d7>
+        (uvpd[VPD(addr)] & PTE_P) == 0 ||
+  8001a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001aa:	48 c1 e8 15          	shr    $0x15,%rax
+  8001ae:	48 89 c2             	mov    %rax,%rdx
+  8001b1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8001b8:	01 00 00 
+  8001bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8001bf:	83 e0 01             	and    $0x1,%eax
+        (uvpde[VPDPE(addr)] & PTE_P) == 0 ||
+  8001c2:	48 85 c0             	test   %rax,%rax
+  8001c5:	0f 84 3e 01 00 00    	je     800309 <memlayout+0x2d7>
+        uvpt[VPN(addr)] == 0)
+  8001cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001cf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8001d3:	48 89 c2             	mov    %rax,%rdx
+  8001d6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8001dd:	01 00 00 
+  8001e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+        (uvpd[VPD(addr)] & PTE_P) == 0 ||
+  8001e4:	48 85 c0             	test   %rax,%rax
+  8001e7:	0f 84 1c 01 00 00    	je     800309 <memlayout+0x2d7>
+      continue;
+    pg = (pte_t *)uvpt + VPN(addr);
+  8001ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001f1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8001f5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8001fc:	00 
+  8001fd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800204:	01 00 00 
+  800207:	48 01 d0             	add    %rdx,%rax
+  80020a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+            pg, (unsigned long)addr, (unsigned long)*pg,
+            (*pg & PTE_P) ? total_p++, 'P' : '-',
+            (*pg & PTE_U) ? total_u++, 'U' : '-',
+            (*pg & PTE_W) ? total_w++, 'W' : '-',
+            (*pg & PTE_COW) ? total_cow++, " COW" : "",
+            (*pg & PTE_SHARE) ? " SHARE" : "");
+  80020e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800212:	48 8b 00             	mov    (%rax),%rax
+  800215:	25 00 04 00 00       	and    $0x400,%eax
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80021a:	48 85 c0             	test   %rax,%rax
+  80021d:	74 0c                	je     80022b <memlayout+0x1f9>
+  80021f:	48 ba 3a 68 80 00 00 	movabs $0x80683a,%rdx
+  800226:	00 00 00 
+  800229:	eb 0a                	jmp    800235 <memlayout+0x203>
+  80022b:	48 ba 41 68 80 00 00 	movabs $0x806841,%rdx
+  800232:	00 00 00 
+            (*pg & PTE_COW) ? total_cow++, " COW" : "",
+  800235:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800239:	48 8b 00             	mov    (%rax),%rax
+  80023c:	25 00 08 00 00       	and    $0x800,%eax
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800241:	48 85 c0             	test   %rax,%rax
+  800244:	74 11                	je     800257 <memlayout+0x225>
+            (*pg & PTE_COW) ? total_cow++, " COW" : "",
+  800246:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80024b:	48 b8 42 68 80 00 00 	movabs $0x806842,%rax
+  800252:	00 00 00 
+  800255:	eb 0a                	jmp    800261 <memlayout+0x22f>
+  800257:	48 b8 41 68 80 00 00 	movabs $0x806841,%rax
+  80025e:	00 00 00 
+            (*pg & PTE_W) ? total_w++, 'W' : '-',
+  800261:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  800265:	48 8b 09             	mov    (%rcx),%rcx
+  800268:	83 e1 02             	and    $0x2,%ecx
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80026b:	48 85 c9             	test   %rcx,%rcx
+  80026e:	74 0d                	je     80027d <memlayout+0x24b>
+            (*pg & PTE_W) ? total_w++, 'W' : '-',
+  800270:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800275:	41 b8 57 00 00 00    	mov    $0x57,%r8d
+  80027b:	eb 06                	jmp    800283 <memlayout+0x251>
+  80027d:	41 b8 2d 00 00 00    	mov    $0x2d,%r8d
+            (*pg & PTE_U) ? total_u++, 'U' : '-',
+  800283:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  800287:	48 8b 09             	mov    (%rcx),%rcx
+  80028a:	83 e1 04             	and    $0x4,%ecx
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80028d:	48 85 c9             	test   %rcx,%rcx
+  800290:	74 0d                	je     80029f <memlayout+0x26d>
+            (*pg & PTE_U) ? total_u++, 'U' : '-',
+  800292:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800297:	41 b9 55 00 00 00    	mov    $0x55,%r9d
+  80029d:	eb 06                	jmp    8002a5 <memlayout+0x273>
+  80029f:	41 b9 2d 00 00 00    	mov    $0x2d,%r9d
+            (*pg & PTE_P) ? total_p++, 'P' : '-',
+  8002a5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8002a9:	48 8b 09             	mov    (%rcx),%rcx
+  8002ac:	83 e1 01             	and    $0x1,%ecx
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8002af:	48 85 c9             	test   %rcx,%rcx
+  8002b2:	74 0d                	je     8002c1 <memlayout+0x28f>
+            (*pg & PTE_P) ? total_p++, 'P' : '-',
+  8002b4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8002b9:	41 ba 50 00 00 00    	mov    $0x50,%r10d
+  8002bf:	eb 06                	jmp    8002c7 <memlayout+0x295>
+  8002c1:	41 ba 2d 00 00 00    	mov    $0x2d,%r10d
+  8002c7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8002cb:	48 8b 09             	mov    (%rcx),%rcx
+  8002ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8002d2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8002d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8002da:	52                   	push   %rdx
+  8002db:	50                   	push   %rax
+  8002dc:	41 50                	push   %r8
+  8002de:	45 89 d0             	mov    %r10d,%r8d
+  8002e1:	48 89 fa             	mov    %rdi,%rdx
+  8002e4:	48 b8 48 68 80 00 00 	movabs $0x806848,%rax
+  8002eb:	00 00 00 
+  8002ee:	48 89 c7             	mov    %rax,%rdi
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 ba eb 07 80 00 00 	movabs $0x8007eb,%r10
+  8002fd:	00 00 00 
+  800300:	41 ff d2             	call   *%r10
+  800303:	48 83 c4 20          	add    $0x20,%rsp
+  800307:	eb 01                	jmp    80030a <memlayout+0x2d8>
+      continue;
+  800309:	90                   	nop
+  for (addr = 0; addr < KERNBASE; addr += PGSIZE) {
+  80030a:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  800311:	00 
+  800312:	48 b8 ff ff ff 3f 80 	movabs $0x803fffffff,%rax
+  800319:	00 00 00 
+  80031c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  800320:	0f 83 31 fe ff ff    	jae    800157 <memlayout+0x125>
+  }
+
+  cprintf("Memory usage summary:\n");
+  800326:	48 b8 6b 68 80 00 00 	movabs $0x80686b,%rax
+  80032d:	00 00 00 
+  800330:	48 89 c7             	mov    %rax,%rdi
+  800333:	b8 00 00 00 00       	mov    $0x0,%eax
+  800338:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  80033f:	00 00 00 
+  800342:	ff d2                	call   *%rdx
+  cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  800344:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800348:	48 89 c6             	mov    %rax,%rsi
+  80034b:	48 b8 82 68 80 00 00 	movabs $0x806882,%rax
+  800352:	00 00 00 
+  800355:	48 89 c7             	mov    %rax,%rdi
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  800364:	00 00 00 
+  800367:	ff d2                	call   *%rdx
+  cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800369:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80036d:	48 89 c6             	mov    %rax,%rsi
+  800370:	48 b8 90 68 80 00 00 	movabs $0x806890,%rax
+  800377:	00 00 00 
+  80037a:	48 89 c7             	mov    %rax,%rdi
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  800389:	00 00 00 
+  80038c:	ff d2                	call   *%rdx
+  cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80038e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800392:	48 89 c6             	mov    %rax,%rsi
+  800395:	48 b8 9e 68 80 00 00 	movabs $0x80689e,%rax
+  80039c:	00 00 00 
+  80039f:	48 89 c7             	mov    %rax,%rdi
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  8003ae:	00 00 00 
+  8003b1:	ff d2                	call   *%rdx
+  cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  8003b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003b7:	48 89 c6             	mov    %rax,%rsi
+  8003ba:	48 b8 ac 68 80 00 00 	movabs $0x8068ac,%rax
+  8003c1:	00 00 00 
+  8003c4:	48 89 c7             	mov    %rax,%rdi
+  8003c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cc:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  8003d3:	00 00 00 
+  8003d6:	ff d2                	call   *%rdx
+}
+  8003d8:	90                   	nop
+  8003d9:	c9                   	leave
+  8003da:	c3                   	ret
+
+00000000008003db <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  8003db:	55                   	push   %rbp
+  8003dc:	48 89 e5             	mov    %rsp,%rbp
+  8003df:	48 83 ec 30          	sub    $0x30,%rsp
+  8003e3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8003e6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  envid_t ceid;
+  int pipefd[2];
+  int res;
+
+  memlayout();
+  8003ea:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003f1:	00 00 00 
+  8003f4:	ff d0                	call   *%rax
+
+  res = pipe(pipefd);
+  8003f6:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  8003fa:	48 89 c7             	mov    %rax,%rdi
+  8003fd:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  800404:	00 00 00 
+  800407:	ff d0                	call   *%rax
+  800409:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (res < 0)
+  80040c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800410:	79 30                	jns    800442 <umain+0x67>
+    panic("pipe() failed\n");
+  800412:	48 b8 bc 68 80 00 00 	movabs $0x8068bc,%rax
+  800419:	00 00 00 
+  80041c:	48 89 c2             	mov    %rax,%rdx
+  80041f:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800424:	48 b8 cb 68 80 00 00 	movabs $0x8068cb,%rax
+  80042b:	00 00 00 
+  80042e:	48 89 c7             	mov    %rax,%rdi
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	48 b9 cc 05 80 00 00 	movabs $0x8005cc,%rcx
+  80043d:	00 00 00 
+  800440:	ff d1                	call   *%rcx
+  ceid = fork();
+  800442:	48 b8 02 34 80 00 00 	movabs $0x803402,%rax
+  800449:	00 00 00 
+  80044c:	ff d0                	call   *%rax
+  80044e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (ceid < 0)
+  800451:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800455:	79 30                	jns    800487 <umain+0xac>
+    panic("fork() failed\n");
+  800457:	48 b8 dc 68 80 00 00 	movabs $0x8068dc,%rax
+  80045e:	00 00 00 
+  800461:	48 89 c2             	mov    %rax,%rdx
+  800464:	be 3d 00 00 00       	mov    $0x3d,%esi
+  800469:	48 b8 cb 68 80 00 00 	movabs $0x8068cb,%rax
+  800470:	00 00 00 
+  800473:	48 89 c7             	mov    %rax,%rdi
+  800476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047b:	48 b9 cc 05 80 00 00 	movabs $0x8005cc,%rcx
+  800482:	00 00 00 
+  800485:	ff d1                	call   *%rcx
+
+  if (ceid == 0) {
+  800487:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80048b:	75 6c                	jne    8004f9 <umain+0x11e>
+    // Child environment
+    int i;
+    cprintf("\n");
+  80048d:	48 b8 eb 68 80 00 00 	movabs $0x8068eb,%rax
+  800494:	00 00 00 
+  800497:	48 89 c7             	mov    %rax,%rdi
+  80049a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049f:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  8004a6:	00 00 00 
+  8004a9:	ff d2                	call   *%rdx
+    for (i = 0; i < 102400; i++)
+  8004ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8004b2:	eb 10                	jmp    8004c4 <umain+0xe9>
+      sys_yield();
+  8004b4:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+    for (i = 0; i < 102400; i++)
+  8004c0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8004c4:	81 7d fc ff 8f 01 00 	cmpl   $0x18fff,-0x4(%rbp)
+  8004cb:	7e e7                	jle    8004b4 <umain+0xd9>
+    cprintf("==== Child\n");
+  8004cd:	48 b8 ed 68 80 00 00 	movabs $0x8068ed,%rax
+  8004d4:	00 00 00 
+  8004d7:	48 89 c7             	mov    %rax,%rdi
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  8004e6:	00 00 00 
+  8004e9:	ff d2                	call   *%rdx
+    memlayout();
+  8004eb:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8004f2:	00 00 00 
+  8004f5:	ff d0                	call   *%rax
+  8004f7:	eb 2a                	jmp    800523 <umain+0x148>
+    return;
+  }
+
+  cprintf("==== Parent\n");
+  8004f9:	48 b8 f9 68 80 00 00 	movabs $0x8068f9,%rax
+  800500:	00 00 00 
+  800503:	48 89 c7             	mov    %rax,%rdi
+  800506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050b:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  800512:	00 00 00 
+  800515:	ff d2                	call   *%rdx
+  memlayout();
+  800517:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80051e:	00 00 00 
+  800521:	ff d0                	call   *%rax
+}
+  800523:	c9                   	leave
+  800524:	c3                   	ret
+
+0000000000800525 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800525:	55                   	push   %rbp
+  800526:	48 89 e5             	mov    %rsp,%rbp
+  800529:	48 83 ec 20          	sub    $0x20,%rsp
+  80052d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800530:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800534:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  80053b:	00 00 00 
+  80053e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800542:	eb 13                	jmp    800557 <libmain+0x32>
+    (*ctor)();
+  800544:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800548:	48 8b 10             	mov    (%rax),%rdx
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	ff d2                	call   *%rdx
+    ctor++;
+  800552:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800557:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  80055e:	00 00 00 
+  800561:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800565:	72 dd                	jb     800544 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800567:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80056b:	7e 14                	jle    800581 <libmain+0x5c>
+    binaryname = argv[0];
+  80056d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800571:	48 8b 00             	mov    (%rax),%rax
+  800574:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80057b:	00 00 00 
+  80057e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800581:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800585:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800588:	48 89 d6             	mov    %rdx,%rsi
+  80058b:	89 c7                	mov    %eax,%edi
+  80058d:	48 b8 db 03 80 00 00 	movabs $0x8003db,%rax
+  800594:	00 00 00 
+  800597:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800599:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  8005a0:	00 00 00 
+  8005a3:	ff d0                	call   *%rax
+#endif
+}
+  8005a5:	90                   	nop
+  8005a6:	c9                   	leave
+  8005a7:	c3                   	ret
+
+00000000008005a8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8005a8:	55                   	push   %rbp
+  8005a9:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8005ac:	48 b8 20 38 80 00 00 	movabs $0x803820,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8005b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005bd:	48 b8 21 24 80 00 00 	movabs $0x802421,%rax
+  8005c4:	00 00 00 
+  8005c7:	ff d0                	call   *%rax
+}
+  8005c9:	90                   	nop
+  8005ca:	5d                   	pop    %rbp
+  8005cb:	c3                   	ret
+
+00000000008005cc <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8005cc:	55                   	push   %rbp
+  8005cd:	48 89 e5             	mov    %rsp,%rbp
+  8005d0:	53                   	push   %rbx
+  8005d1:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8005d8:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8005df:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8005e5:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8005ec:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8005f3:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8005fa:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800601:	84 c0                	test   %al,%al
+  800603:	74 23                	je     800628 <_panic+0x5c>
+  800605:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80060c:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800610:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800614:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800618:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80061c:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800620:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800624:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800628:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80062f:	00 00 00 
+  800632:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800639:	00 00 00 
+  80063c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800640:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800647:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80064e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800655:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80065c:	00 00 00 
+  80065f:	48 8b 18             	mov    (%rax),%rbx
+  800662:	48 b8 f0 24 80 00 00 	movabs $0x8024f0,%rax
+  800669:	00 00 00 
+  80066c:	ff d0                	call   *%rax
+  80066e:	89 c6                	mov    %eax,%esi
+  800670:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800676:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80067d:	41 89 d0             	mov    %edx,%r8d
+  800680:	48 89 c1             	mov    %rax,%rcx
+  800683:	48 89 da             	mov    %rbx,%rdx
+  800686:	48 b8 10 69 80 00 00 	movabs $0x806910,%rax
+  80068d:	00 00 00 
+  800690:	48 89 c7             	mov    %rax,%rdi
+  800693:	b8 00 00 00 00       	mov    $0x0,%eax
+  800698:	49 b9 eb 07 80 00 00 	movabs $0x8007eb,%r9
+  80069f:	00 00 00 
+  8006a2:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8006a5:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8006ac:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006b3:	48 89 d6             	mov    %rdx,%rsi
+  8006b6:	48 89 c7             	mov    %rax,%rdi
+  8006b9:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  8006c0:	00 00 00 
+  8006c3:	ff d0                	call   *%rax
+  cprintf("\n");
+  8006c5:	48 b8 33 69 80 00 00 	movabs $0x806933,%rax
+  8006cc:	00 00 00 
+  8006cf:	48 89 c7             	mov    %rax,%rdi
+  8006d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d7:	48 ba eb 07 80 00 00 	movabs $0x8007eb,%rdx
+  8006de:	00 00 00 
+  8006e1:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8006e3:	cc                   	int3
+  8006e4:	eb fd                	jmp    8006e3 <_panic+0x117>
+
+00000000008006e6 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8006ee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8006f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8006f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006f9:	8b 00                	mov    (%rax),%eax
+  8006fb:	8d 48 01             	lea    0x1(%rax),%ecx
+  8006fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800702:	89 0a                	mov    %ecx,(%rdx)
+  800704:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800707:	89 d1                	mov    %edx,%ecx
+  800709:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80070d:	48 98                	cltq
+  80070f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800713:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800717:	8b 00                	mov    (%rax),%eax
+  800719:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80071e:	75 2c                	jne    80074c <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800720:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800724:	8b 00                	mov    (%rax),%eax
+  800726:	48 98                	cltq
+  800728:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80072c:	48 83 c2 08          	add    $0x8,%rdx
+  800730:	48 89 c6             	mov    %rax,%rsi
+  800733:	48 89 d7             	mov    %rdx,%rdi
+  800736:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  80073d:	00 00 00 
+  800740:	ff d0                	call   *%rax
+    b->idx = 0;
+  800742:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800746:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80074c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800750:	8b 40 04             	mov    0x4(%rax),%eax
+  800753:	8d 50 01             	lea    0x1(%rax),%edx
+  800756:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80075a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80075d:	90                   	nop
+  80075e:	c9                   	leave
+  80075f:	c3                   	ret
+
+0000000000800760 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800760:	55                   	push   %rbp
+  800761:	48 89 e5             	mov    %rsp,%rbp
+  800764:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80076b:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800772:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800779:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800780:	00 00 00 
+  b.cnt = 0;
+  800783:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80078a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80078d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800794:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80079b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8007a2:	48 89 c6             	mov    %rax,%rsi
+  8007a5:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  8007ac:	00 00 00 
+  8007af:	48 89 c7             	mov    %rax,%rdi
+  8007b2:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  8007b9:	00 00 00 
+  8007bc:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8007be:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8007c4:	48 98                	cltq
+  8007c6:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8007cd:	48 83 c2 08          	add    $0x8,%rdx
+  8007d1:	48 89 c6             	mov    %rax,%rsi
+  8007d4:	48 89 d7             	mov    %rdx,%rdi
+  8007d7:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  8007de:	00 00 00 
+  8007e1:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8007e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8007e9:	c9                   	leave
+  8007ea:	c3                   	ret
+
+00000000008007eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8007eb:	55                   	push   %rbp
+  8007ec:	48 89 e5             	mov    %rsp,%rbp
+  8007ef:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8007f6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8007fd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800804:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80080b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800812:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800819:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800820:	84 c0                	test   %al,%al
+  800822:	74 20                	je     800844 <cprintf+0x59>
+  800824:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800828:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80082c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800830:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800834:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800838:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80083c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800840:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800844:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80084b:	00 00 00 
+  80084e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800855:	00 00 00 
+  800858:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80085c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800863:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80086a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800871:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800878:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80087f:	48 89 d6             	mov    %rdx,%rsi
+  800882:	48 89 c7             	mov    %rax,%rdi
+  800885:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  80088c:	00 00 00 
+  80088f:	ff d0                	call   *%rax
+  800891:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800897:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+
+000000000080089f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8008a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008af:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008b3:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8008b6:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8008ba:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8008be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008c1:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8008c5:	72 54                	jb     80091b <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008c7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8008ca:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008cd:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8008d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008d9:	48 f7 f6             	div    %rsi
+  8008dc:	49 89 c2             	mov    %rax,%r10
+  8008df:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8008e2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8008e5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8008e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ed:	41 89 c9             	mov    %ecx,%r9d
+  8008f0:	41 89 f8             	mov    %edi,%r8d
+  8008f3:	89 d1                	mov    %edx,%ecx
+  8008f5:	4c 89 d2             	mov    %r10,%rdx
+  8008f8:	48 89 c7             	mov    %rax,%rdi
+  8008fb:	48 b8 9f 08 80 00 00 	movabs $0x80089f,%rax
+  800902:	00 00 00 
+  800905:	ff d0                	call   *%rax
+  800907:	eb 1c                	jmp    800925 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800909:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80090d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800910:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800914:	48 89 d6             	mov    %rdx,%rsi
+  800917:	89 c7                	mov    %eax,%edi
+  800919:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80091b:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80091f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800923:	7f e4                	jg     800909 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800925:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80092c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800931:	48 f7 f1             	div    %rcx
+  800934:	48 b8 70 6b 80 00 00 	movabs $0x806b70,%rax
+  80093b:	00 00 00 
+  80093e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800942:	0f be c0             	movsbl %al,%eax
+  800945:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800949:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80094d:	48 89 d6             	mov    %rdx,%rsi
+  800950:	89 c7                	mov    %eax,%edi
+  800952:	ff d1                	call   *%rcx
+}
+  800954:	90                   	nop
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+
+0000000000800957 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800957:	55                   	push   %rbp
+  800958:	48 89 e5             	mov    %rsp,%rbp
+  80095b:	48 83 ec 10          	sub    $0x10,%rsp
+  80095f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800963:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800966:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80096a:	7e 4b                	jle    8009b7 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80096c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800970:	8b 00                	mov    (%rax),%eax
+  800972:	83 f8 2f             	cmp    $0x2f,%eax
+  800975:	77 24                	ja     80099b <getuint+0x44>
+  800977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80097b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80097f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800983:	8b 00                	mov    (%rax),%eax
+  800985:	89 c0                	mov    %eax,%eax
+  800987:	48 01 d0             	add    %rdx,%rax
+  80098a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80098e:	8b 12                	mov    (%rdx),%edx
+  800990:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800993:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800997:	89 0a                	mov    %ecx,(%rdx)
+  800999:	eb 14                	jmp    8009af <getuint+0x58>
+  80099b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80099f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009af:	48 8b 00             	mov    (%rax),%rax
+  8009b2:	e9 95 00 00 00       	jmp    800a4c <getuint+0xf5>
+  else if (lflag)
+  8009b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009bb:	74 48                	je     800a05 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8009bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009c1:	8b 00                	mov    (%rax),%eax
+  8009c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c6:	77 24                	ja     8009ec <getuint+0x95>
+  8009c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d4:	8b 00                	mov    (%rax),%eax
+  8009d6:	89 c0                	mov    %eax,%eax
+  8009d8:	48 01 d0             	add    %rdx,%rax
+  8009db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009df:	8b 12                	mov    (%rdx),%edx
+  8009e1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009e8:	89 0a                	mov    %ecx,(%rdx)
+  8009ea:	eb 14                	jmp    800a00 <getuint+0xa9>
+  8009ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009f4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009fc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a00:	48 8b 00             	mov    (%rax),%rax
+  800a03:	eb 47                	jmp    800a4c <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a09:	8b 00                	mov    (%rax),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 24                	ja     800a34 <getuint+0xdd>
+  800a10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a14:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1c:	8b 00                	mov    (%rax),%eax
+  800a1e:	89 c0                	mov    %eax,%eax
+  800a20:	48 01 d0             	add    %rdx,%rax
+  800a23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a27:	8b 12                	mov    (%rdx),%edx
+  800a29:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a2c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a30:	89 0a                	mov    %ecx,(%rdx)
+  800a32:	eb 14                	jmp    800a48 <getuint+0xf1>
+  800a34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a38:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a3c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a44:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a48:	8b 00                	mov    (%rax),%eax
+  800a4a:	89 c0                	mov    %eax,%eax
+}
+  800a4c:	c9                   	leave
+  800a4d:	c3                   	ret
+
+0000000000800a4e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800a4e:	55                   	push   %rbp
+  800a4f:	48 89 e5             	mov    %rsp,%rbp
+  800a52:	48 83 ec 10          	sub    $0x10,%rsp
+  800a56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a5a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800a5d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800a61:	7e 4b                	jle    800aae <getint+0x60>
+    return va_arg(*ap, long long);
+  800a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a67:	8b 00                	mov    (%rax),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	77 24                	ja     800a92 <getint+0x44>
+  800a6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a72:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a7a:	8b 00                	mov    (%rax),%eax
+  800a7c:	89 c0                	mov    %eax,%eax
+  800a7e:	48 01 d0             	add    %rdx,%rax
+  800a81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a85:	8b 12                	mov    (%rdx),%edx
+  800a87:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a8e:	89 0a                	mov    %ecx,(%rdx)
+  800a90:	eb 14                	jmp    800aa6 <getint+0x58>
+  800a92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a96:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a9a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aa2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800aa6:	48 8b 00             	mov    (%rax),%rax
+  800aa9:	e9 95 00 00 00       	jmp    800b43 <getint+0xf5>
+  else if (lflag)
+  800aae:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800ab2:	74 48                	je     800afc <getint+0xae>
+    return va_arg(*ap, long);
+  800ab4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab8:	8b 00                	mov    (%rax),%eax
+  800aba:	83 f8 2f             	cmp    $0x2f,%eax
+  800abd:	77 24                	ja     800ae3 <getint+0x95>
+  800abf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800acb:	8b 00                	mov    (%rax),%eax
+  800acd:	89 c0                	mov    %eax,%eax
+  800acf:	48 01 d0             	add    %rdx,%rax
+  800ad2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ad6:	8b 12                	mov    (%rdx),%edx
+  800ad8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800adb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800adf:	89 0a                	mov    %ecx,(%rdx)
+  800ae1:	eb 14                	jmp    800af7 <getint+0xa9>
+  800ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ae7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800aeb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800aef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800af3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800af7:	48 8b 00             	mov    (%rax),%rax
+  800afa:	eb 47                	jmp    800b43 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b00:	8b 00                	mov    (%rax),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	77 24                	ja     800b2b <getint+0xdd>
+  800b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b0b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b13:	8b 00                	mov    (%rax),%eax
+  800b15:	89 c0                	mov    %eax,%eax
+  800b17:	48 01 d0             	add    %rdx,%rax
+  800b1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b1e:	8b 12                	mov    (%rdx),%edx
+  800b20:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b27:	89 0a                	mov    %ecx,(%rdx)
+  800b29:	eb 14                	jmp    800b3f <getint+0xf1>
+  800b2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b2f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b33:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b37:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b3b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b3f:	8b 00                	mov    (%rax),%eax
+  800b41:	48 98                	cltq
+}
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+
+0000000000800b45 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800b45:	55                   	push   %rbp
+  800b46:	48 89 e5             	mov    %rsp,%rbp
+  800b49:	41 54                	push   %r12
+  800b4b:	53                   	push   %rbx
+  800b4c:	48 83 ec 60          	sub    $0x60,%rsp
+  800b50:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800b54:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800b58:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800b5c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800b60:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b64:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b68:	48 8b 06             	mov    (%rsi),%rax
+  800b6b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b6f:	48 89 01             	mov    %rax,(%rcx)
+  800b72:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b76:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b7a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b7e:	eb 17                	jmp    800b97 <vprintfmt+0x52>
+      if (ch == '\0')
+  800b80:	85 db                	test   %ebx,%ebx
+  800b82:	0f 84 bf 04 00 00    	je     801047 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800b88:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b8c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b90:	48 89 c6             	mov    %rax,%rsi
+  800b93:	89 df                	mov    %ebx,%edi
+  800b95:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b97:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b9b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b9f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800ba3:	0f b6 00             	movzbl (%rax),%eax
+  800ba6:	0f b6 d8             	movzbl %al,%ebx
+  800ba9:	83 fb 25             	cmp    $0x25,%ebx
+  800bac:	75 d2                	jne    800b80 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800bae:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800bb2:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800bb9:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800bc0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800bc7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800bce:	eb 04                	jmp    800bd4 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800bd0:	90                   	nop
+  800bd1:	eb 01                	jmp    800bd4 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800bd3:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800bd4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bd8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bdc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800be0:	0f b6 00             	movzbl (%rax),%eax
+  800be3:	0f b6 d8             	movzbl %al,%ebx
+  800be6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800be9:	83 f8 55             	cmp    $0x55,%eax
+  800bec:	0f 87 22 04 00 00    	ja     801014 <vprintfmt+0x4cf>
+  800bf2:	89 c0                	mov    %eax,%eax
+  800bf4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800bfb:	00 
+  800bfc:	48 b8 98 6b 80 00 00 	movabs $0x806b98,%rax
+  800c03:	00 00 00 
+  800c06:	48 01 d0             	add    %rdx,%rax
+  800c09:	48 8b 00             	mov    (%rax),%rax
+  800c0c:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c0e:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c12:	eb c0                	jmp    800bd4 <vprintfmt+0x8f>
+        padc = '0';
+  800c14:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800c18:	eb ba                	jmp    800bd4 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800c1a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c21:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800c24:	89 d0                	mov    %edx,%eax
+  800c26:	c1 e0 02             	shl    $0x2,%eax
+  800c29:	01 d0                	add    %edx,%eax
+  800c2b:	01 c0                	add    %eax,%eax
+  800c2d:	01 d8                	add    %ebx,%eax
+  800c2f:	83 e8 30             	sub    $0x30,%eax
+  800c32:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800c35:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c39:	0f b6 00             	movzbl (%rax),%eax
+  800c3c:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800c3f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c42:	7e 60                	jle    800ca4 <vprintfmt+0x15f>
+  800c44:	83 fb 39             	cmp    $0x39,%ebx
+  800c47:	7f 5b                	jg     800ca4 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800c49:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c4e:	eb d1                	jmp    800c21 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800c50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c53:	83 f8 2f             	cmp    $0x2f,%eax
+  800c56:	77 17                	ja     800c6f <vprintfmt+0x12a>
+  800c58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c5c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c5f:	89 d2                	mov    %edx,%edx
+  800c61:	48 01 d0             	add    %rdx,%rax
+  800c64:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c67:	83 c2 08             	add    $0x8,%edx
+  800c6a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c6d:	eb 0c                	jmp    800c7b <vprintfmt+0x136>
+  800c6f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c73:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c77:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c7b:	8b 00                	mov    (%rax),%eax
+  800c7d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800c80:	eb 23                	jmp    800ca5 <vprintfmt+0x160>
+        if (width < 0)
+  800c82:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c86:	0f 89 44 ff ff ff    	jns    800bd0 <vprintfmt+0x8b>
+          width = 0;
+  800c8c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800c93:	e9 38 ff ff ff       	jmp    800bd0 <vprintfmt+0x8b>
+        altflag = 1;
+  800c98:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800c9f:	e9 30 ff ff ff       	jmp    800bd4 <vprintfmt+0x8f>
+        goto process_precision;
+  800ca4:	90                   	nop
+        if (width < 0)
+  800ca5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ca9:	0f 89 24 ff ff ff    	jns    800bd3 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800caf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800cb2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800cb5:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800cbc:	e9 12 ff ff ff       	jmp    800bd3 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800cc1:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800cc5:	e9 0a ff ff ff       	jmp    800bd4 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800cca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd0:	77 17                	ja     800ce9 <vprintfmt+0x1a4>
+  800cd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cd6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cd9:	89 d2                	mov    %edx,%edx
+  800cdb:	48 01 d0             	add    %rdx,%rax
+  800cde:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ce1:	83 c2 08             	add    $0x8,%edx
+  800ce4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ce7:	eb 0c                	jmp    800cf5 <vprintfmt+0x1b0>
+  800ce9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ced:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cf5:	8b 00                	mov    (%rax),%eax
+  800cf7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800cfb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800cff:	48 89 d6             	mov    %rdx,%rsi
+  800d02:	89 c7                	mov    %eax,%edi
+  800d04:	ff d1                	call   *%rcx
+        break;
+  800d06:	e9 37 03 00 00       	jmp    801042 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d11:	77 17                	ja     800d2a <vprintfmt+0x1e5>
+  800d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d17:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d1a:	89 d2                	mov    %edx,%edx
+  800d1c:	48 01 d0             	add    %rdx,%rax
+  800d1f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d22:	83 c2 08             	add    $0x8,%edx
+  800d25:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d28:	eb 0c                	jmp    800d36 <vprintfmt+0x1f1>
+  800d2a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d2e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d32:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d36:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800d38:	85 db                	test   %ebx,%ebx
+  800d3a:	79 02                	jns    800d3e <vprintfmt+0x1f9>
+          err = -err;
+  800d3c:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d3e:	83 fb 15             	cmp    $0x15,%ebx
+  800d41:	7f 16                	jg     800d59 <vprintfmt+0x214>
+  800d43:	48 ba c0 6a 80 00 00 	movabs $0x806ac0,%rdx
+  800d4a:	00 00 00 
+  800d4d:	48 63 c3             	movslq %ebx,%rax
+  800d50:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800d54:	4d 85 e4             	test   %r12,%r12
+  800d57:	75 2e                	jne    800d87 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800d59:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d5d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d61:	89 d9                	mov    %ebx,%ecx
+  800d63:	48 ba 81 6b 80 00 00 	movabs $0x806b81,%rdx
+  800d6a:	00 00 00 
+  800d6d:	48 89 c7             	mov    %rax,%rdi
+  800d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d75:	49 b8 51 10 80 00 00 	movabs $0x801051,%r8
+  800d7c:	00 00 00 
+  800d7f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800d82:	e9 bb 02 00 00       	jmp    801042 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800d87:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d8b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d8f:	4c 89 e1             	mov    %r12,%rcx
+  800d92:	48 ba 8a 6b 80 00 00 	movabs $0x806b8a,%rdx
+  800d99:	00 00 00 
+  800d9c:	48 89 c7             	mov    %rax,%rdi
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	49 b8 51 10 80 00 00 	movabs $0x801051,%r8
+  800dab:	00 00 00 
+  800dae:	41 ff d0             	call   *%r8
+        break;
+  800db1:	e9 8c 02 00 00       	jmp    801042 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800db6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbc:	77 17                	ja     800dd5 <vprintfmt+0x290>
+  800dbe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dc2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dc5:	89 d2                	mov    %edx,%edx
+  800dc7:	48 01 d0             	add    %rdx,%rax
+  800dca:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dcd:	83 c2 08             	add    $0x8,%edx
+  800dd0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800dd3:	eb 0c                	jmp    800de1 <vprintfmt+0x29c>
+  800dd5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800dd9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ddd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800de1:	4c 8b 20             	mov    (%rax),%r12
+  800de4:	4d 85 e4             	test   %r12,%r12
+  800de7:	75 0a                	jne    800df3 <vprintfmt+0x2ae>
+          p = "(null)";
+  800de9:	49 bc 8d 6b 80 00 00 	movabs $0x806b8d,%r12
+  800df0:	00 00 00 
+        if (width > 0 && padc != '-')
+  800df3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800df7:	7e 78                	jle    800e71 <vprintfmt+0x32c>
+  800df9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800dfd:	74 72                	je     800e71 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800dff:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e02:	48 98                	cltq
+  800e04:	48 89 c6             	mov    %rax,%rsi
+  800e07:	4c 89 e7             	mov    %r12,%rdi
+  800e0a:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  800e11:	00 00 00 
+  800e14:	ff d0                	call   *%rax
+  800e16:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800e19:	eb 17                	jmp    800e32 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800e1b:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800e1f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800e23:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800e27:	48 89 d6             	mov    %rdx,%rsi
+  800e2a:	89 c7                	mov    %eax,%edi
+  800e2c:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e2e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e32:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e36:	7f e3                	jg     800e1b <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e38:	eb 37                	jmp    800e71 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800e3a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e3e:	74 1e                	je     800e5e <vprintfmt+0x319>
+  800e40:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e43:	7e 05                	jle    800e4a <vprintfmt+0x305>
+  800e45:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e48:	7e 14                	jle    800e5e <vprintfmt+0x319>
+            putch('?', putdat);
+  800e4a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e4e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e52:	48 89 c6             	mov    %rax,%rsi
+  800e55:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e5a:	ff d2                	call   *%rdx
+  800e5c:	eb 0f                	jmp    800e6d <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800e5e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e62:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e66:	48 89 c6             	mov    %rax,%rsi
+  800e69:	89 df                	mov    %ebx,%edi
+  800e6b:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e6d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e71:	4c 89 e0             	mov    %r12,%rax
+  800e74:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800e78:	0f b6 00             	movzbl (%rax),%eax
+  800e7b:	0f be d8             	movsbl %al,%ebx
+  800e7e:	85 db                	test   %ebx,%ebx
+  800e80:	74 28                	je     800eaa <vprintfmt+0x365>
+  800e82:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800e86:	78 b2                	js     800e3a <vprintfmt+0x2f5>
+  800e88:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800e8c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800e90:	79 a8                	jns    800e3a <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800e92:	eb 16                	jmp    800eaa <vprintfmt+0x365>
+          putch(' ', putdat);
+  800e94:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e98:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e9c:	48 89 c6             	mov    %rax,%rsi
+  800e9f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ea4:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ea6:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800eaa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800eae:	7f e4                	jg     800e94 <vprintfmt+0x34f>
+        break;
+  800eb0:	e9 8d 01 00 00       	jmp    801042 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800eb5:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800eb8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ebc:	89 d6                	mov    %edx,%esi
+  800ebe:	48 89 c7             	mov    %rax,%rdi
+  800ec1:	48 b8 4e 0a 80 00 00 	movabs $0x800a4e,%rax
+  800ec8:	00 00 00 
+  800ecb:	ff d0                	call   *%rax
+  800ecd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800ed1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ed5:	48 85 c0             	test   %rax,%rax
+  800ed8:	79 1d                	jns    800ef7 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800eda:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ede:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ee2:	48 89 c6             	mov    %rax,%rsi
+  800ee5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800eea:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800eec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ef0:	48 f7 d8             	neg    %rax
+  800ef3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800ef7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800efe:	e9 d2 00 00 00       	jmp    800fd5 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f03:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f06:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f0a:	89 d6                	mov    %edx,%esi
+  800f0c:	48 89 c7             	mov    %rax,%rdi
+  800f0f:	48 b8 57 09 80 00 00 	movabs $0x800957,%rax
+  800f16:	00 00 00 
+  800f19:	ff d0                	call   *%rax
+  800f1b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800f1f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f26:	e9 aa 00 00 00       	jmp    800fd5 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800f2b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f2e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f32:	89 d6                	mov    %edx,%esi
+  800f34:	48 89 c7             	mov    %rax,%rdi
+  800f37:	48 b8 57 09 80 00 00 	movabs $0x800957,%rax
+  800f3e:	00 00 00 
+  800f41:	ff d0                	call   *%rax
+  800f43:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800f47:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800f4e:	e9 82 00 00 00       	jmp    800fd5 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800f53:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f57:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f5b:	48 89 c6             	mov    %rax,%rsi
+  800f5e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f63:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800f65:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f69:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f6d:	48 89 c6             	mov    %rax,%rsi
+  800f70:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f75:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800f77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7d:	77 17                	ja     800f96 <vprintfmt+0x451>
+  800f7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f83:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f86:	89 d2                	mov    %edx,%edx
+  800f88:	48 01 d0             	add    %rdx,%rax
+  800f8b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f8e:	83 c2 08             	add    $0x8,%edx
+  800f91:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800f94:	eb 0c                	jmp    800fa2 <vprintfmt+0x45d>
+  800f96:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f9a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f9e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800fa2:	48 8b 00             	mov    (%rax),%rax
+  800fa5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fa9:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800fb0:	eb 23                	jmp    800fd5 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800fb2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fb5:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800fb9:	89 d6                	mov    %edx,%esi
+  800fbb:	48 89 c7             	mov    %rax,%rdi
+  800fbe:	48 b8 57 09 80 00 00 	movabs $0x800957,%rax
+  800fc5:	00 00 00 
+  800fc8:	ff d0                	call   *%rax
+  800fca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fce:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800fd5:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800fda:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800fdd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800fe0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800fe4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800fe8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fec:	45 89 c1             	mov    %r8d,%r9d
+  800fef:	41 89 f8             	mov    %edi,%r8d
+  800ff2:	48 89 c7             	mov    %rax,%rdi
+  800ff5:	48 b8 9f 08 80 00 00 	movabs $0x80089f,%rax
+  800ffc:	00 00 00 
+  800fff:	ff d0                	call   *%rax
+        break;
+  801001:	eb 3f                	jmp    801042 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801003:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801007:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80100b:	48 89 c6             	mov    %rax,%rsi
+  80100e:	89 df                	mov    %ebx,%edi
+  801010:	ff d2                	call   *%rdx
+        break;
+  801012:	eb 2e                	jmp    801042 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801014:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801018:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80101c:	48 89 c6             	mov    %rax,%rsi
+  80101f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801024:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801026:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80102b:	eb 05                	jmp    801032 <vprintfmt+0x4ed>
+  80102d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801032:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801036:	48 83 e8 01          	sub    $0x1,%rax
+  80103a:	0f b6 00             	movzbl (%rax),%eax
+  80103d:	3c 25                	cmp    $0x25,%al
+  80103f:	75 ec                	jne    80102d <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  801041:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801042:	e9 50 fb ff ff       	jmp    800b97 <vprintfmt+0x52>
+        return;
+  801047:	90                   	nop
+    }
+  }
+}
+  801048:	48 83 c4 60          	add    $0x60,%rsp
+  80104c:	5b                   	pop    %rbx
+  80104d:	41 5c                	pop    %r12
+  80104f:	5d                   	pop    %rbp
+  801050:	c3                   	ret
+
+0000000000801051 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801051:	55                   	push   %rbp
+  801052:	48 89 e5             	mov    %rsp,%rbp
+  801055:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80105c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801063:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80106a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801071:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801078:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80107f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801086:	84 c0                	test   %al,%al
+  801088:	74 20                	je     8010aa <printfmt+0x59>
+  80108a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80108e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801092:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801096:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80109a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80109e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010a2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010a6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8010aa:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010b1:	00 00 00 
+  8010b4:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010bb:	00 00 00 
+  8010be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010c2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010c9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010d0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  8010d7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010de:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010e5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8010ec:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010f3:	48 89 c7             	mov    %rax,%rdi
+  8010f6:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  8010fd:	00 00 00 
+  801100:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801102:	90                   	nop
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+0000000000801105 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+  801109:	48 83 ec 10          	sub    $0x10,%rsp
+  80110d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801110:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801114:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801118:	8b 40 10             	mov    0x10(%rax),%eax
+  80111b:	8d 50 01             	lea    0x1(%rax),%edx
+  80111e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801122:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801129:	48 8b 10             	mov    (%rax),%rdx
+  80112c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801130:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801134:	48 39 c2             	cmp    %rax,%rdx
+  801137:	73 17                	jae    801150 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80113d:	48 8b 00             	mov    (%rax),%rax
+  801140:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801144:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801148:	48 89 0a             	mov    %rcx,(%rdx)
+  80114b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80114e:	88 10                	mov    %dl,(%rax)
+}
+  801150:	90                   	nop
+  801151:	c9                   	leave
+  801152:	c3                   	ret
+
+0000000000801153 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801153:	55                   	push   %rbp
+  801154:	48 89 e5             	mov    %rsp,%rbp
+  801157:	48 83 ec 40          	sub    $0x40,%rsp
+  80115b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80115f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801162:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801166:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  80116a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80116e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801172:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801175:	48 98                	cltq
+  801177:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80117b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80117f:	48 01 d0             	add    %rdx,%rax
+  801182:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801186:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80118d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801192:	74 06                	je     80119a <vsnprintf+0x47>
+  801194:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801198:	7f 07                	jg     8011a1 <vsnprintf+0x4e>
+    return -E_INVAL;
+  80119a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80119f:	eb 32                	jmp    8011d3 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8011a1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8011a5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8011a9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8011ad:	48 89 c6             	mov    %rax,%rsi
+  8011b0:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8011b7:	00 00 00 
+  8011ba:	48 89 c7             	mov    %rax,%rdi
+  8011bd:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  8011c4:	00 00 00 
+  8011c7:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8011c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011cd:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8011d0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8011d3:	c9                   	leave
+  8011d4:	c3                   	ret
+
+00000000008011d5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011e0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011e7:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  8011ed:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801202:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801209:	84 c0                	test   %al,%al
+  80120b:	74 20                	je     80122d <snprintf+0x58>
+  80120d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801211:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801215:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801219:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80121d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801221:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801225:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801229:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80122d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801234:	00 00 00 
+  801237:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80123e:	00 00 00 
+  801241:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801245:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80124c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801253:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80125a:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801261:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801268:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80126e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801275:	48 89 c7             	mov    %rax,%rdi
+  801278:	48 b8 53 11 80 00 00 	movabs $0x801153,%rax
+  80127f:	00 00 00 
+  801282:	ff d0                	call   *%rax
+  801284:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  80128a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801290:	c9                   	leave
+  801291:	c3                   	ret
+
+0000000000801292 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801292:	55                   	push   %rbp
+  801293:	48 89 e5             	mov    %rsp,%rbp
+  801296:	53                   	push   %rbx
+  801297:	48 83 ec 38          	sub    $0x38,%rsp
+  80129b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80129e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8012a2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8012a6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8012aa:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8012ae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b6:	89 d1                	mov    %edx,%ecx
+  8012b8:	0f a2                	cpuid
+  8012ba:	89 de                	mov    %ebx,%esi
+  8012bc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8012bf:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8012c2:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8012c5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8012c8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012cd:	74 09                	je     8012d8 <cpuid+0x46>
+}
+  8012cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012d3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8012d6:	89 10                	mov    %edx,(%rax)
+
+  8012d8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8012dd:	74 09                	je     8012e8 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8012df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012e3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8012e6:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8012e8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8012ed:	74 09                	je     8012f8 <cpuid+0x66>
+char *
+  8012ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012f3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8012f6:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8012f8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8012fd:	74 09                	je     801308 <cpuid+0x76>
+  for (; *s; s++)
+  8012ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801303:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801306:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801308:	90                   	nop
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	48 83 ec 18          	sub    $0x18,%rsp
+  801317:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80131a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80131d:	89 c1                	mov    %eax,%ecx
+  80131f:	0f 01 d0             	xgetbv
+  801322:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801325:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801328:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80132b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80132e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801332:	48 09 d0             	or     %rdx,%rax
+#else
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+
+0000000000801337 <string_cpu>:
+string_cpu(void) {
+  801337:	55                   	push   %rbp
+  801338:	48 89 e5             	mov    %rsp,%rbp
+  80133b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80133f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801346:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80134d:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801354:	00 00 00 
+  801357:	8b 00                	mov    (%rax),%eax
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	78 11                	js     80136e <string_cpu+0x37>
+    return string_features;
+  80135d:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801364:	00 00 00 
+  801367:	8b 00                	mov    (%rax),%eax
+  801369:	e9 df 00 00 00       	jmp    80144d <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80136e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801378:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801382:	48 89 c6             	mov    %rax,%rsi
+  801385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80138a:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  801391:	00 00 00 
+  801394:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801396:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801399:	83 f8 06             	cmp    $0x6,%eax
+  80139c:	76 28                	jbe    8013c6 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80139e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ad:	48 89 c2             	mov    %rax,%rdx
+  8013b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8013ba:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  8013c1:	00 00 00 
+  8013c4:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8013c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013c9:	25 00 02 00 00       	and    $0x200,%eax
+  8013ce:	85 c0                	test   %eax,%eax
+  8013d0:	74 04                	je     8013d6 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8013d2:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8013d6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8013da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e0:	48 89 c1             	mov    %rax,%rcx
+  8013e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  8013f2:	48 b8 92 12 80 00 00 	movabs $0x801292,%rax
+  8013f9:	00 00 00 
+  8013fc:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8013fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801401:	83 e0 20             	and    $0x20,%eax
+  801404:	85 c0                	test   %eax,%eax
+  801406:	74 2a                	je     801432 <string_cpu+0xfb>
+  801408:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80140b:	25 00 00 00 08       	and    $0x8000000,%eax
+  801410:	85 c0                	test   %eax,%eax
+  801412:	74 1e                	je     801432 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801414:	bf 00 00 00 00       	mov    $0x0,%edi
+  801419:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  801420:	00 00 00 
+  801423:	ff d0                	call   *%rax
+  801425:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801428:	48 83 f8 06          	cmp    $0x6,%rax
+  80142c:	75 04                	jne    801432 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80142e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801432:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  801439:	00 00 00 
+  80143c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80143f:	89 02                	mov    %eax,(%rdx)
+  801441:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801448:	00 00 00 
+  80144b:	8b 00                	mov    (%rax),%eax
+}
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+
+000000000080144f <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+  801453:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801457:	48 83 ec 60          	sub    $0x60,%rsp
+  80145b:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801460:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801465:	83 e0 1f             	and    $0x1f,%eax
+  801468:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80146c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801470:	48 f7 d8             	neg    %rax
+  801473:	48 89 c2             	mov    %rax,%rdx
+  801476:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80147b:	48 01 d0             	add    %rdx,%rax
+  80147e:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801483:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801487:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80148d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801492:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801496:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80149c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014a0:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014a4:	89 c2                	mov    %eax,%edx
+  8014a6:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014aa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014af:	89 c1                	mov    %eax,%ecx
+  8014b1:	d3 e6                	shl    %cl,%esi
+  8014b3:	89 f0                	mov    %esi,%eax
+  8014b5:	21 d0                	and    %edx,%eax
+  8014b7:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014bb:	eb 21                	jmp    8014de <strlen_avx2+0x8f>
+    p += 32;
+  8014bd:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8014c3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014c8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014cc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8014d2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014d6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014da:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014de:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8014e3:	74 d8                	je     8014bd <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8014e5:	31 c0                	xor    %eax,%eax
+  8014e7:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8014ed:	48 63 d0             	movslq %eax,%rdx
+  8014f0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014f5:	48 01 d0             	add    %rdx,%rax
+  8014f8:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+
+00000000008014ff <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801507:	48 83 ec 40          	sub    $0x40,%rsp
+  80150b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801510:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801515:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80151a:	eb 77                	jmp    801593 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80151c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801521:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801525:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801529:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80152e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801532:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801536:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80153a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80153e:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801543:	74 3c                	je     801581 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801545:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801549:	f7 d0                	not    %eax
+  80154b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80154f:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801553:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801557:	48 63 d0             	movslq %eax,%rdx
+  80155a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80155f:	48 01 d0             	add    %rdx,%rax
+  801562:	0f b6 00             	movzbl (%rax),%eax
+  801565:	0f b6 c0             	movzbl %al,%eax
+  801568:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80156c:	48 63 ca             	movslq %edx,%rcx
+  80156f:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801574:	48 01 ca             	add    %rcx,%rdx
+  801577:	0f b6 12             	movzbl (%rdx),%edx
+  80157a:	0f b6 d2             	movzbl %dl,%edx
+  80157d:	29 d0                	sub    %edx,%eax
+  80157f:	eb 6b                	jmp    8015ec <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801581:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801587:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80158d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801593:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801599:	77 81                	ja     80151c <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80159b:	eb 42                	jmp    8015df <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80159d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015a2:	0f b6 10             	movzbl (%rax),%edx
+  8015a5:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015aa:	0f b6 00             	movzbl (%rax),%eax
+  8015ad:	38 c2                	cmp    %al,%dl
+  8015af:	74 1c                	je     8015cd <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8015b1:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015b6:	0f b6 00             	movzbl (%rax),%eax
+  8015b9:	0f b6 c8             	movzbl %al,%ecx
+  8015bc:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015c1:	0f b6 00             	movzbl (%rax),%eax
+  8015c4:	0f b6 d0             	movzbl %al,%edx
+  8015c7:	89 c8                	mov    %ecx,%eax
+  8015c9:	29 d0                	sub    %edx,%eax
+  8015cb:	eb 1f                	jmp    8015ec <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8015cd:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8015d3:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8015d9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8015df:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8015e5:	75 b6                	jne    80159d <memcmp_avx2+0x9e>
+  return 0;
+  8015e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ec:	c9                   	leave
+  8015ed:	c3                   	ret
+
+00000000008015ee <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8015ee:	55                   	push   %rbp
+  8015ef:	48 89 e5             	mov    %rsp,%rbp
+  8015f2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8015f6:	48 83 ec 60          	sub    $0x60,%rsp
+  8015fa:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8015ff:	89 f0                	mov    %esi,%eax
+  801601:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801606:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80160a:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80160f:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801613:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801618:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80161e:	eb 47                	jmp    801667 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801620:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801625:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801629:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80162d:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801633:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801637:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80163b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80163f:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801644:	74 15                	je     80165b <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801646:	31 c0                	xor    %eax,%eax
+  801648:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80164e:	48 63 d0             	movslq %eax,%rdx
+  801651:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801656:	48 01 d0             	add    %rdx,%rax
+  801659:	eb 3d                	jmp    801698 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80165b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801661:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801667:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80166d:	77 b1                	ja     801620 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80166f:	eb 0c                	jmp    80167d <memfind_avx2+0x8f>
+  801671:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801677:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80167d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801683:	74 0e                	je     801693 <memfind_avx2+0xa5>
+  801685:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80168a:	0f b6 00             	movzbl (%rax),%eax
+  80168d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801691:	75 de                	jne    801671 <memfind_avx2+0x83>
+  return s;
+  801693:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+000000000080169a <strlen>:
+strlen(const char *s) {
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  80169e:	48 83 ec 40          	sub    $0x40,%rsp
+  8016a2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8016a6:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016aa:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8016ae:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  8016b5:	00 00 00 
+  8016b8:	ff d0                	call   *%rax
+  8016ba:	83 e0 02             	and    $0x2,%eax
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	74 18                	je     8016d9 <strlen+0x3f>
+    return strlen_avx2(s);
+  8016c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016c5:	48 89 c7             	mov    %rax,%rdi
+  8016c8:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  8016cf:	00 00 00 
+  8016d2:	ff d0                	call   *%rax
+  8016d4:	e9 82 00 00 00       	jmp    80175b <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8016d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016dd:	83 e0 0f             	and    $0xf,%eax
+  8016e0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8016e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8016e6:	48 f7 d8             	neg    %rax
+  8016e9:	48 89 c2             	mov    %rax,%rdx
+  8016ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f0:	48 01 d0             	add    %rdx,%rax
+  8016f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8016f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016fb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8016ff:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801704:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801708:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80170c:	89 c2                	mov    %eax,%edx
+  80170e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801711:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801716:	89 c1                	mov    %eax,%ecx
+  801718:	d3 e6                	shl    %cl,%esi
+  80171a:	89 f0                	mov    %esi,%eax
+  80171c:	21 d0                	and    %edx,%eax
+  80171e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801721:	eb 1d                	jmp    801740 <strlen+0xa6>
+    p += 16;
+  801723:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801728:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801730:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801735:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801739:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80173d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801740:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801744:	74 dd                	je     801723 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801746:	31 c0                	xor    %eax,%eax
+  801748:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80174d:	48 63 d0             	movslq %eax,%rdx
+  801750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801754:	48 01 d0             	add    %rdx,%rax
+  801757:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80175b:	c9                   	leave
+  80175c:	c3                   	ret
+
+000000000080175d <strnlen>:
+strnlen(const char *s, size_t size) {
+  80175d:	55                   	push   %rbp
+  80175e:	48 89 e5             	mov    %rsp,%rbp
+  801761:	48 83 ec 20          	sub    $0x20,%rsp
+  801765:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801769:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80176d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801774:	eb 0e                	jmp    801784 <strnlen+0x27>
+    n++;
+  801776:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80177a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80177f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801784:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801789:	74 0b                	je     801796 <strnlen+0x39>
+  80178b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80178f:	0f b6 00             	movzbl (%rax),%eax
+  801792:	84 c0                	test   %al,%al
+  801794:	75 e0                	jne    801776 <strnlen+0x19>
+  return n;
+  801796:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801799:	c9                   	leave
+  80179a:	c3                   	ret
+
+000000000080179b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80179b:	55                   	push   %rbp
+  80179c:	48 89 e5             	mov    %rsp,%rbp
+  80179f:	48 83 ec 20          	sub    $0x20,%rsp
+  8017a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8017ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8017b3:	90                   	nop
+  8017b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017b8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017cc:	0f b6 12             	movzbl (%rdx),%edx
+  8017cf:	88 10                	mov    %dl,(%rax)
+  8017d1:	0f b6 00             	movzbl (%rax),%eax
+  8017d4:	84 c0                	test   %al,%al
+  8017d6:	75 dc                	jne    8017b4 <strcpy+0x19>
+  return ret;
+  8017d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <strcat>:
+strcat(char *dst, const char *src) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8017e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8017ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f2:	48 89 c7             	mov    %rax,%rdi
+  8017f5:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+  801801:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801804:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801807:	48 63 d0             	movslq %eax,%rdx
+  80180a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180e:	48 01 c2             	add    %rax,%rdx
+  801811:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801815:	48 89 c6             	mov    %rax,%rsi
+  801818:	48 89 d7             	mov    %rdx,%rdi
+  80181b:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+  return dst;
+  801827:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+000000000080182d <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80182d:	55                   	push   %rbp
+  80182e:	48 89 e5             	mov    %rsp,%rbp
+  801831:	48 83 ec 28          	sub    $0x28,%rsp
+  801835:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801839:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80183d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801841:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801845:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801849:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801850:	00 
+  801851:	eb 2a                	jmp    80187d <strncpy+0x50>
+    *dst++ = *src;
+  801853:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801857:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80185b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80185f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801863:	0f b6 12             	movzbl (%rdx),%edx
+  801866:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801868:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80186c:	0f b6 00             	movzbl (%rax),%eax
+  80186f:	84 c0                	test   %al,%al
+  801871:	74 05                	je     801878 <strncpy+0x4b>
+      src++;
+  801873:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801878:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80187d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801881:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801885:	72 cc                	jb     801853 <strncpy+0x26>
+  return ret;
+  801887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+000000000080188d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	48 83 ec 28          	sub    $0x28,%rsp
+  801895:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801899:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80189d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8018a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8018a9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018ae:	74 3d                	je     8018ed <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8018b0:	eb 1d                	jmp    8018cf <strlcpy+0x42>
+      *dst++ = *src++;
+  8018b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018b6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018c6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018ca:	0f b6 12             	movzbl (%rdx),%edx
+  8018cd:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8018cf:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8018d4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018d9:	74 0b                	je     8018e6 <strlcpy+0x59>
+  8018db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018df:	0f b6 00             	movzbl (%rax),%eax
+  8018e2:	84 c0                	test   %al,%al
+  8018e4:	75 cc                	jne    8018b2 <strlcpy+0x25>
+    *dst = '\0';
+  8018e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ea:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8018ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+00000000008018f7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	48 83 ec 30          	sub    $0x30,%rsp
+  8018ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801903:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801907:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80190b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80190f:	48 89 c7             	mov    %rax,%rdi
+  801912:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  801919:	00 00 00 
+  80191c:	ff d0                	call   *%rax
+  80191e:	48 98                	cltq
+  801920:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801924:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80192c:	48 89 d6             	mov    %rdx,%rsi
+  80192f:	48 89 c7             	mov    %rax,%rdi
+  801932:	48 b8 5d 17 80 00 00 	movabs $0x80175d,%rax
+  801939:	00 00 00 
+  80193c:	ff d0                	call   *%rax
+  80193e:	48 98                	cltq
+  801940:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801944:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801948:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80194c:	75 10                	jne    80195e <strlcat+0x67>
+    return maxlen + srclen;
+  80194e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801956:	48 01 d0             	add    %rdx,%rax
+  801959:	e9 86 00 00 00       	jmp    8019e4 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801966:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80196a:	73 2b                	jae    801997 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80196c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801970:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801974:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197c:	48 01 c1             	add    %rax,%rcx
+  80197f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801983:	48 89 c6             	mov    %rax,%rsi
+  801986:	48 89 cf             	mov    %rcx,%rdi
+  801989:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  801990:	00 00 00 
+  801993:	ff d0                	call   *%rax
+  801995:	eb 42                	jmp    8019d9 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801997:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80199f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a7:	48 01 c1             	add    %rax,%rcx
+  8019aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019ae:	48 89 c6             	mov    %rax,%rsi
+  8019b1:	48 89 cf             	mov    %rcx,%rdi
+  8019b4:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8019c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c8:	48 01 d0             	add    %rdx,%rax
+  8019cb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019d3:	48 01 d0             	add    %rdx,%rax
+  8019d6:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8019d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e1:	48 01 d0             	add    %rdx,%rax
+}
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+00000000008019e6 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8019e6:	55                   	push   %rbp
+  8019e7:	48 89 e5             	mov    %rsp,%rbp
+  8019ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8019f6:	eb 0a                	jmp    801a02 <strcmp+0x1c>
+    p++, q++;
+  8019f8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019fd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a06:	0f b6 00             	movzbl (%rax),%eax
+  801a09:	84 c0                	test   %al,%al
+  801a0b:	74 12                	je     801a1f <strcmp+0x39>
+  801a0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a11:	0f b6 10             	movzbl (%rax),%edx
+  801a14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a18:	0f b6 00             	movzbl (%rax),%eax
+  801a1b:	38 c2                	cmp    %al,%dl
+  801a1d:	74 d9                	je     8019f8 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801a1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a23:	0f b6 00             	movzbl (%rax),%eax
+  801a26:	0f b6 d0             	movzbl %al,%edx
+  801a29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2d:	0f b6 00             	movzbl (%rax),%eax
+  801a30:	0f b6 c0             	movzbl %al,%eax
+  801a33:	29 c2                	sub    %eax,%edx
+  801a35:	89 d0                	mov    %edx,%eax
+}
+  801a37:	c9                   	leave
+  801a38:	c3                   	ret
+
+0000000000801a39 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801a39:	55                   	push   %rbp
+  801a3a:	48 89 e5             	mov    %rsp,%rbp
+  801a3d:	48 83 ec 18          	sub    $0x18,%rsp
+  801a41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a4d:	eb 0f                	jmp    801a5e <strncmp+0x25>
+    n--, p++, q++;
+  801a4f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801a54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a5e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a63:	74 1d                	je     801a82 <strncmp+0x49>
+  801a65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a69:	0f b6 00             	movzbl (%rax),%eax
+  801a6c:	84 c0                	test   %al,%al
+  801a6e:	74 12                	je     801a82 <strncmp+0x49>
+  801a70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a74:	0f b6 10             	movzbl (%rax),%edx
+  801a77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7b:	0f b6 00             	movzbl (%rax),%eax
+  801a7e:	38 c2                	cmp    %al,%dl
+  801a80:	74 cd                	je     801a4f <strncmp+0x16>
+  if (n == 0)
+  801a82:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a87:	75 07                	jne    801a90 <strncmp+0x57>
+    return 0;
+  801a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8e:	eb 16                	jmp    801aa6 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a94:	0f b6 00             	movzbl (%rax),%eax
+  801a97:	0f b6 d0             	movzbl %al,%edx
+  801a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9e:	0f b6 00             	movzbl (%rax),%eax
+  801aa1:	0f b6 c0             	movzbl %al,%eax
+  801aa4:	29 c2                	sub    %eax,%edx
+}
+  801aa6:	89 d0                	mov    %edx,%eax
+  801aa8:	c9                   	leave
+  801aa9:	c3                   	ret
+
+0000000000801aaa <strchr>:
+strchr(const char *s, char c) {
+  801aaa:	55                   	push   %rbp
+  801aab:	48 89 e5             	mov    %rsp,%rbp
+  801aae:	48 83 ec 60          	sub    $0x60,%rsp
+  801ab2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801ab6:	89 f0                	mov    %esi,%eax
+  801ab8:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801abb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801abf:	83 e0 0f             	and    $0xf,%eax
+  801ac2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801ac5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ac8:	48 f7 d8             	neg    %rax
+  801acb:	48 89 c2             	mov    %rax,%rdx
+  801ace:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ad2:	48 01 d0             	add    %rdx,%rax
+  801ad5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801ad9:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801add:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801ae1:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801ae5:	66 0f 6e c0          	movd   %eax,%xmm0
+  801ae9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801aed:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801af1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801af6:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801afa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801afe:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b02:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b06:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b0b:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b10:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b14:	89 c2                	mov    %eax,%edx
+  801b16:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b1b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b20:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b24:	09 c2                	or     %eax,%edx
+  801b26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b29:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801b2e:	89 c1                	mov    %eax,%ecx
+  801b30:	d3 e6                	shl    %cl,%esi
+  801b32:	89 f0                	mov    %esi,%eax
+  801b34:	21 d0                	and    %edx,%eax
+  801b36:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b39:	eb 34                	jmp    801b6f <strchr+0xc5>
+    p += 16;
+  801b3b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b44:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b48:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801b4c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b51:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b56:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b5a:	89 c2                	mov    %eax,%edx
+  801b5c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b61:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b66:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b6a:	09 d0                	or     %edx,%eax
+  801b6c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b6f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b73:	74 c6                	je     801b3b <strchr+0x91>
+  p += __builtin_ctz(m);
+  801b75:	31 c0                	xor    %eax,%eax
+  801b77:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801b7c:	48 98                	cltq
+  801b7e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b86:	0f b6 00             	movzbl (%rax),%eax
+  801b89:	84 c0                	test   %al,%al
+  801b8b:	74 06                	je     801b93 <strchr+0xe9>
+  801b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b91:	eb 05                	jmp    801b98 <strchr+0xee>
+  801b93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b98:	c9                   	leave
+  801b99:	c3                   	ret
+
+0000000000801b9a <strfind>:
+strfind(const char *s, char c) {
+  801b9a:	55                   	push   %rbp
+  801b9b:	48 89 e5             	mov    %rsp,%rbp
+  801b9e:	48 83 ec 10          	sub    $0x10,%rsp
+  801ba2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ba6:	89 f0                	mov    %esi,%eax
+  801ba8:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801bab:	eb 11                	jmp    801bbe <strfind+0x24>
+    if (*s == c)
+  801bad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bb1:	0f b6 00             	movzbl (%rax),%eax
+  801bb4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801bb7:	74 12                	je     801bcb <strfind+0x31>
+  for (; *s; s++)
+  801bb9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc2:	0f b6 00             	movzbl (%rax),%eax
+  801bc5:	84 c0                	test   %al,%al
+  801bc7:	75 e4                	jne    801bad <strfind+0x13>
+  801bc9:	eb 01                	jmp    801bcc <strfind+0x32>
+      break;
+  801bcb:	90                   	nop
+  return (char *)s;
+  801bcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bd0:	c9                   	leave
+  801bd1:	c3                   	ret
+
+0000000000801bd2 <memset>:
+memset(void *v, int c, size_t n) {
+  801bd2:	55                   	push   %rbp
+  801bd3:	48 89 e5             	mov    %rsp,%rbp
+  801bd6:	48 83 ec 38          	sub    $0x38,%rsp
+  801bda:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bde:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801be1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801be5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801bed:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801bf2:	76 41                	jbe    801c35 <memset+0x63>
+  801bf4:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	83 e0 01             	and    $0x1,%eax
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	74 2e                	je     801c35 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c07:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c0a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c0e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c12:	48 89 ce             	mov    %rcx,%rsi
+  801c15:	48 89 f7             	mov    %rsi,%rdi
+  801c18:	48 89 d1             	mov    %rdx,%rcx
+  801c1b:	fc                   	cld
+  801c1c:	f3 aa                	rep stos %al,%es:(%rdi)
+  801c1e:	48 89 ca             	mov    %rcx,%rdx
+  801c21:	48 89 fe             	mov    %rdi,%rsi
+  801c24:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801c28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801c2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c30:	e9 a7 00 00 00       	jmp    801cdc <memset+0x10a>
+  if (n >= 8) {
+  801c35:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c3a:	0f 86 87 00 00 00    	jbe    801cc7 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801c40:	eb 16                	jmp    801c58 <memset+0x86>
+      *p++ = c;
+  801c42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c46:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c4a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c4e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801c51:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801c53:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5c:	83 e0 07             	and    $0x7,%eax
+  801c5f:	48 85 c0             	test   %rax,%rax
+  801c62:	75 de                	jne    801c42 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801c64:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c67:	0f b6 c0             	movzbl %al,%eax
+  801c6a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801c71:	01 01 01 
+  801c74:	48 0f af c2          	imul   %rdx,%rax
+  801c78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801c7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c80:	48 c1 e8 03          	shr    $0x3,%rax
+  801c84:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801c88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c8c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c90:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c94:	48 89 ce             	mov    %rcx,%rsi
+  801c97:	48 89 f7             	mov    %rsi,%rdi
+  801c9a:	48 89 d1             	mov    %rdx,%rcx
+  801c9d:	fc                   	cld
+  801c9e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ca1:	48 89 ca             	mov    %rcx,%rdx
+  801ca4:	48 89 fe             	mov    %rdi,%rsi
+  801ca7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801cab:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801caf:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801cb4:	eb 11                	jmp    801cc7 <memset+0xf5>
+    *p++ = c;
+  801cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cbe:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cc2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cc5:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801cc7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ccb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ccf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cd3:	48 85 c0             	test   %rax,%rax
+  801cd6:	75 de                	jne    801cb6 <memset+0xe4>
+  return v;
+  801cd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801cdc:	c9                   	leave
+  801cdd:	c3                   	ret
+
+0000000000801cde <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801cde:	55                   	push   %rbp
+  801cdf:	48 89 e5             	mov    %rsp,%rbp
+  801ce2:	48 83 ec 38          	sub    $0x38,%rsp
+  801ce6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801cf2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801cfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d06:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d0a:	0f 83 da 00 00 00    	jae    801dea <memmove+0x10c>
+  801d10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d14:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d18:	48 01 d0             	add    %rdx,%rax
+  801d1b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801d1f:	0f 83 c5 00 00 00    	jae    801dea <memmove+0x10c>
+    s += n;
+  801d25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d29:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801d2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d31:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801d35:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d3a:	0f 86 94 00 00 00    	jbe    801dd4 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801d40:	eb 1c                	jmp    801d5e <memmove+0x80>
+        *--d = *--s;
+  801d42:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801d47:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801d4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d50:	0f b6 10             	movzbl (%rax),%edx
+  801d53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d57:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d59:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d62:	83 e0 07             	and    $0x7,%eax
+  801d65:	48 85 c0             	test   %rax,%rax
+  801d68:	75 d8                	jne    801d42 <memmove+0x64>
+      nq = n / 8;
+  801d6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d6e:	48 c1 e8 03          	shr    $0x3,%rax
+  801d72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d76:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801d7b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801d80:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801d85:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d91:	48 89 cf             	mov    %rcx,%rdi
+  801d94:	48 89 d6             	mov    %rdx,%rsi
+  801d97:	48 89 c1             	mov    %rax,%rcx
+  801d9a:	fd                   	std
+  801d9b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801d9e:	fc                   	cld
+  801d9f:	48 89 c8             	mov    %rcx,%rax
+  801da2:	48 89 f2             	mov    %rsi,%rdx
+  801da5:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801da9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801dad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801db1:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801db6:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801dbb:	eb 17                	jmp    801dd4 <memmove+0xf6>
+      *--d = *--s;
+  801dbd:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801dc2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801dc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dcb:	0f b6 10             	movzbl (%rax),%edx
+  801dce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dd2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801dd4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dd8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ddc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801de0:	48 85 c0             	test   %rax,%rax
+  801de3:	75 d8                	jne    801dbd <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801de5:	e9 f4 00 00 00       	jmp    801ede <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801dea:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801def:	76 46                	jbe    801e37 <memmove+0x159>
+  801df1:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+  801dfd:	83 e0 01             	and    $0x1,%eax
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	74 33                	je     801e37 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e04:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e10:	48 89 cf             	mov    %rcx,%rdi
+  801e13:	48 89 d6             	mov    %rdx,%rsi
+  801e16:	48 89 c1             	mov    %rax,%rcx
+  801e19:	fc                   	cld
+  801e1a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e1c:	48 89 c8             	mov    %rcx,%rax
+  801e1f:	48 89 f2             	mov    %rsi,%rdx
+  801e22:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e26:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801e2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e32:	e9 ab 00 00 00       	jmp    801ee2 <memmove+0x204>
+    if (n >= 8) {
+  801e37:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801e3c:	0f 86 8b 00 00 00    	jbe    801ecd <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801e42:	eb 22                	jmp    801e66 <memmove+0x188>
+        *d++ = *s++;
+  801e44:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e48:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e54:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e58:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801e5c:	0f b6 12             	movzbl (%rdx),%edx
+  801e5f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801e61:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801e66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e6a:	83 e0 07             	and    $0x7,%eax
+  801e6d:	48 85 c0             	test   %rax,%rax
+  801e70:	75 d2                	jne    801e44 <memmove+0x166>
+      nq = n / 8;
+  801e72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e76:	48 c1 e8 03          	shr    $0x3,%rax
+  801e7a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801e7e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e82:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e8a:	48 89 cf             	mov    %rcx,%rdi
+  801e8d:	48 89 d6             	mov    %rdx,%rsi
+  801e90:	48 89 c1             	mov    %rax,%rcx
+  801e93:	fc                   	cld
+  801e94:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801e97:	48 89 c8             	mov    %rcx,%rax
+  801e9a:	48 89 f2             	mov    %rsi,%rdx
+  801e9d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ea1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ea5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801ea9:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801eae:	eb 1d                	jmp    801ecd <memmove+0x1ef>
+      *d++ = *s++;
+  801eb0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eb4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801eb8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ebc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ec4:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ec8:	0f b6 12             	movzbl (%rdx),%edx
+  801ecb:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ed1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ed5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ed9:	48 85 c0             	test   %rax,%rax
+  801edc:	75 d2                	jne    801eb0 <memmove+0x1d2>
+  return dst;
+  801ede:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801ee2:	c9                   	leave
+  801ee3:	c3                   	ret
+
+0000000000801ee4 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ee4:	55                   	push   %rbp
+  801ee5:	48 89 e5             	mov    %rsp,%rbp
+  801ee8:	48 83 ec 18          	sub    $0x18,%rsp
+  801eec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ef0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ef4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801ef8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801efc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f04:	48 89 ce             	mov    %rcx,%rsi
+  801f07:	48 89 c7             	mov    %rax,%rdi
+  801f0a:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  801f11:	00 00 00 
+  801f14:	ff d0                	call   *%rax
+}
+  801f16:	c9                   	leave
+  801f17:	c3                   	ret
+
+0000000000801f18 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801f18:	55                   	push   %rbp
+  801f19:	48 89 e5             	mov    %rsp,%rbp
+  801f1c:	48 83 ec 40          	sub    $0x40,%rsp
+  801f20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f24:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801f2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f30:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801f34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f3c:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801f41:	0f 86 a7 00 00 00    	jbe    801fee <memcmp+0xd6>
+  801f47:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	83 e0 02             	and    $0x2,%eax
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	0f 84 90 00 00 00    	je     801fee <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801f5e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f62:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f6a:	48 89 ce             	mov    %rcx,%rsi
+  801f6d:	48 89 c7             	mov    %rax,%rdi
+  801f70:	48 b8 ff 14 80 00 00 	movabs $0x8014ff,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	e9 c2 00 00 00       	jmp    802043 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801f81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f85:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f89:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801f8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f91:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f95:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f99:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801fa0:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801fa7:	74 36                	je     801fdf <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801fa9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fac:	f7 d0                	not    %eax
+  801fae:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801fb2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801fb5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fb8:	48 63 d0             	movslq %eax,%rdx
+  801fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fbf:	48 01 d0             	add    %rdx,%rax
+  801fc2:	0f b6 00             	movzbl (%rax),%eax
+  801fc5:	0f b6 c0             	movzbl %al,%eax
+  801fc8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801fcb:	48 63 ca             	movslq %edx,%rcx
+  801fce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fd2:	48 01 ca             	add    %rcx,%rdx
+  801fd5:	0f b6 12             	movzbl (%rdx),%edx
+  801fd8:	0f b6 d2             	movzbl %dl,%edx
+  801fdb:	29 d0                	sub    %edx,%eax
+  801fdd:	eb 64                	jmp    802043 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801fdf:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801fe4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801fe9:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801fee:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801ff3:	77 8c                	ja     801f81 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801ff5:	eb 36                	jmp    80202d <memcmp+0x115>
+    if (*s1 != *s2)
+  801ff7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ffb:	0f b6 10             	movzbl (%rax),%edx
+  801ffe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802002:	0f b6 00             	movzbl (%rax),%eax
+  802005:	38 c2                	cmp    %al,%dl
+  802007:	74 1a                	je     802023 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802009:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80200d:	0f b6 00             	movzbl (%rax),%eax
+  802010:	0f b6 c8             	movzbl %al,%ecx
+  802013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802017:	0f b6 00             	movzbl (%rax),%eax
+  80201a:	0f b6 d0             	movzbl %al,%edx
+  80201d:	89 c8                	mov    %ecx,%eax
+  80201f:	29 d0                	sub    %edx,%eax
+  802021:	eb 20                	jmp    802043 <memcmp+0x12b>
+    s1++, s2++;
+  802023:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802028:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80202d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802031:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802035:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802039:	48 85 c0             	test   %rax,%rax
+  80203c:	75 b9                	jne    801ff7 <memcmp+0xdf>
+  }
+
+  return 0;
+  80203e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802043:	c9                   	leave
+  802044:	c3                   	ret
+
+0000000000802045 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+  802049:	48 83 ec 50          	sub    $0x50,%rsp
+  80204d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802051:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802054:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802058:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80205c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802060:	48 01 d0             	add    %rdx,%rax
+  802063:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802067:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80206a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80206e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  802072:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  802076:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80207b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80207f:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  802084:	76 73                	jbe    8020f9 <memfind+0xb4>
+  802086:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+  802092:	83 e0 02             	and    $0x2,%eax
+  802095:	85 c0                	test   %eax,%eax
+  802097:	74 60                	je     8020f9 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802099:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80209c:	0f b6 c8             	movzbl %al,%ecx
+  80209f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a7:	89 ce                	mov    %ecx,%esi
+  8020a9:	48 89 c7             	mov    %rax,%rdi
+  8020ac:	48 b8 ee 15 80 00 00 	movabs $0x8015ee,%rax
+  8020b3:	00 00 00 
+  8020b6:	ff d0                	call   *%rax
+  8020b8:	eb 6c                	jmp    802126 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8020ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020be:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8020c2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8020c6:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8020cb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8020cf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8020d3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8020d6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8020da:	74 13                	je     8020ef <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  8020dc:	31 c0                	xor    %eax,%eax
+  8020de:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  8020e3:	48 63 d0             	movslq %eax,%rdx
+  8020e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ea:	48 01 d0             	add    %rdx,%rax
+  8020ed:	eb 37                	jmp    802126 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  8020ef:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  8020f4:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  8020f9:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  8020fe:	77 ba                	ja     8020ba <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802100:	eb 13                	jmp    802115 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802102:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802106:	0f b6 00             	movzbl (%rax),%eax
+  802109:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80210c:	38 d0                	cmp    %dl,%al
+  80210e:	74 11                	je     802121 <memfind+0xdc>
+  for (; s < ends; s++)
+  802110:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802115:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802119:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80211d:	72 e3                	jb     802102 <memfind+0xbd>
+  80211f:	eb 01                	jmp    802122 <memfind+0xdd>
+      break;
+  802121:	90                   	nop
+  return (void *)s;
+  802122:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+
+0000000000802128 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802128:	55                   	push   %rbp
+  802129:	48 89 e5             	mov    %rsp,%rbp
+  80212c:	48 83 ec 38          	sub    $0x38,%rsp
+  802130:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802134:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802138:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  80213b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802142:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802149:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80214a:	eb 05                	jmp    802151 <strtol+0x29>
+    s++;
+  80214c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802151:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802155:	0f b6 00             	movzbl (%rax),%eax
+  802158:	3c 20                	cmp    $0x20,%al
+  80215a:	74 f0                	je     80214c <strtol+0x24>
+  80215c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802160:	0f b6 00             	movzbl (%rax),%eax
+  802163:	3c 09                	cmp    $0x9,%al
+  802165:	74 e5                	je     80214c <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802167:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80216b:	0f b6 00             	movzbl (%rax),%eax
+  80216e:	3c 2b                	cmp    $0x2b,%al
+  802170:	75 07                	jne    802179 <strtol+0x51>
+    s++;
+  802172:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802177:	eb 17                	jmp    802190 <strtol+0x68>
+  else if (*s == '-')
+  802179:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80217d:	0f b6 00             	movzbl (%rax),%eax
+  802180:	3c 2d                	cmp    $0x2d,%al
+  802182:	75 0c                	jne    802190 <strtol+0x68>
+    s++, neg = 1;
+  802184:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802189:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802190:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802194:	74 06                	je     80219c <strtol+0x74>
+  802196:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80219a:	75 28                	jne    8021c4 <strtol+0x9c>
+  80219c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a0:	0f b6 00             	movzbl (%rax),%eax
+  8021a3:	3c 30                	cmp    $0x30,%al
+  8021a5:	75 1d                	jne    8021c4 <strtol+0x9c>
+  8021a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ab:	48 83 c0 01          	add    $0x1,%rax
+  8021af:	0f b6 00             	movzbl (%rax),%eax
+  8021b2:	3c 78                	cmp    $0x78,%al
+  8021b4:	75 0e                	jne    8021c4 <strtol+0x9c>
+    s += 2, base = 16;
+  8021b6:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8021bb:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8021c2:	eb 2c                	jmp    8021f0 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8021c4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021c8:	75 19                	jne    8021e3 <strtol+0xbb>
+  8021ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ce:	0f b6 00             	movzbl (%rax),%eax
+  8021d1:	3c 30                	cmp    $0x30,%al
+  8021d3:	75 0e                	jne    8021e3 <strtol+0xbb>
+    s++, base = 8;
+  8021d5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021da:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8021e1:	eb 0d                	jmp    8021f0 <strtol+0xc8>
+  else if (base == 0)
+  8021e3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021e7:	75 07                	jne    8021f0 <strtol+0xc8>
+    base = 10;
+  8021e9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  8021f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021f4:	0f b6 00             	movzbl (%rax),%eax
+  8021f7:	3c 2f                	cmp    $0x2f,%al
+  8021f9:	7e 1d                	jle    802218 <strtol+0xf0>
+  8021fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ff:	0f b6 00             	movzbl (%rax),%eax
+  802202:	3c 39                	cmp    $0x39,%al
+  802204:	7f 12                	jg     802218 <strtol+0xf0>
+      dig = *s - '0';
+  802206:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80220a:	0f b6 00             	movzbl (%rax),%eax
+  80220d:	0f be c0             	movsbl %al,%eax
+  802210:	83 e8 30             	sub    $0x30,%eax
+  802213:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802216:	eb 4e                	jmp    802266 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802218:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80221c:	0f b6 00             	movzbl (%rax),%eax
+  80221f:	3c 60                	cmp    $0x60,%al
+  802221:	7e 1d                	jle    802240 <strtol+0x118>
+  802223:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802227:	0f b6 00             	movzbl (%rax),%eax
+  80222a:	3c 7a                	cmp    $0x7a,%al
+  80222c:	7f 12                	jg     802240 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80222e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802232:	0f b6 00             	movzbl (%rax),%eax
+  802235:	0f be c0             	movsbl %al,%eax
+  802238:	83 e8 57             	sub    $0x57,%eax
+  80223b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80223e:	eb 26                	jmp    802266 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802240:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802244:	0f b6 00             	movzbl (%rax),%eax
+  802247:	3c 40                	cmp    $0x40,%al
+  802249:	7e 47                	jle    802292 <strtol+0x16a>
+  80224b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224f:	0f b6 00             	movzbl (%rax),%eax
+  802252:	3c 5a                	cmp    $0x5a,%al
+  802254:	7f 3c                	jg     802292 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802256:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80225a:	0f b6 00             	movzbl (%rax),%eax
+  80225d:	0f be c0             	movsbl %al,%eax
+  802260:	83 e8 37             	sub    $0x37,%eax
+  802263:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802266:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802269:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80226c:	7d 23                	jge    802291 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80226e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802273:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802276:	48 98                	cltq
+  802278:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80227d:	48 89 c2             	mov    %rax,%rdx
+  802280:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802283:	48 98                	cltq
+  802285:	48 01 d0             	add    %rdx,%rax
+  802288:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80228c:	e9 5f ff ff ff       	jmp    8021f0 <strtol+0xc8>
+      break;
+  802291:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802292:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802297:	74 0b                	je     8022a4 <strtol+0x17c>
+    *endptr = (char *)s;
+  802299:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80229d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8022a1:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8022a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022a8:	74 09                	je     8022b3 <strtol+0x18b>
+  8022aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ae:	48 f7 d8             	neg    %rax
+  8022b1:	eb 04                	jmp    8022b7 <strtol+0x18f>
+  8022b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+
+00000000008022b9 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8022b9:	55                   	push   %rbp
+  8022ba:	48 89 e5             	mov    %rsp,%rbp
+  8022bd:	53                   	push   %rbx
+  8022be:	48 83 ec 48          	sub    $0x48,%rsp
+  8022c2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8022ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8022ce:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8022d2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8022d6:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8022da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8022e2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022e6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8022ea:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022ee:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8022f2:	4c 89 c3             	mov    %r8,%rbx
+  8022f5:	cd 30                	int    $0x30
+  8022f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8022fb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802300:	74 46                	je     802348 <syscall+0x8f>
+  802302:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802307:	7e 3f                	jle    802348 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802309:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80230d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802311:	49 89 d0             	mov    %rdx,%r8
+  802314:	48 89 c1             	mov    %rax,%rcx
+  802317:	48 b8 48 6e 80 00 00 	movabs $0x806e48,%rax
+  80231e:	00 00 00 
+  802321:	48 89 c2             	mov    %rax,%rdx
+  802324:	be 22 00 00 00       	mov    $0x22,%esi
+  802329:	48 b8 67 6e 80 00 00 	movabs $0x806e67,%rax
+  802330:	00 00 00 
+  802333:	48 89 c7             	mov    %rax,%rdi
+  802336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233b:	49 b9 cc 05 80 00 00 	movabs $0x8005cc,%r9
+  802342:	00 00 00 
+  802345:	41 ff d1             	call   *%r9
+
+  return ret;
+  802348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80234c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+
+0000000000802352 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  802356:	48 83 ec 10          	sub    $0x10,%rsp
+  80235a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80235e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802362:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802366:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80236a:	48 83 ec 08          	sub    $0x8,%rsp
+  80236e:	6a 00                	push   $0x0
+  802370:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80237c:	48 89 d1             	mov    %rdx,%rcx
+  80237f:	48 89 c2             	mov    %rax,%rdx
+  802382:	be 00 00 00 00       	mov    $0x0,%esi
+  802387:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238c:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802393:	00 00 00 
+  802396:	ff d0                	call   *%rax
+  802398:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80239c:	90                   	nop
+  80239d:	c9                   	leave
+  80239e:	c3                   	ret
+
+000000000080239f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80239f:	55                   	push   %rbp
+  8023a0:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8023a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a7:	6a 00                	push   $0x0
+  8023a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023c9:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+  8023d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+00000000008023db <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8023db:	55                   	push   %rbp
+  8023dc:	48 89 e5             	mov    %rsp,%rbp
+  8023df:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8023e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023e9:	48 98                	cltq
+  8023eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ef:	6a 00                	push   $0x0
+  8023f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802402:	48 89 c2             	mov    %rax,%rdx
+  802405:	be 01 00 00 00       	mov    $0x1,%esi
+  80240a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80240f:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+  80241b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80241f:	c9                   	leave
+  802420:	c3                   	ret
+
+0000000000802421 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802421:	55                   	push   %rbp
+  802422:	48 89 e5             	mov    %rsp,%rbp
+  802425:	48 83 ec 10          	sub    $0x10,%rsp
+  802429:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80242c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80242f:	48 98                	cltq
+  802431:	48 83 ec 08          	sub    $0x8,%rsp
+  802435:	6a 00                	push   $0x0
+  802437:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80243d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802443:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802448:	48 89 c2             	mov    %rax,%rdx
+  80244b:	be 00 00 00 00       	mov    $0x0,%esi
+  802450:	bf 04 00 00 00       	mov    $0x4,%edi
+  802455:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802465:	90                   	nop
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+
+0000000000802468 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+  80246c:	48 83 ec 20          	sub    $0x20,%rsp
+  802470:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802473:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802477:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80247a:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80247d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802482:	cd 30                	int    $0x30
+  802484:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802488:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80248c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802491:	7e 3d                	jle    8024d0 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802493:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802497:	49 89 c0             	mov    %rax,%r8
+  80249a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80249f:	48 b8 48 6e 80 00 00 	movabs $0x806e48,%rax
+  8024a6:	00 00 00 
+  8024a9:	48 89 c2             	mov    %rax,%rdx
+  8024ac:	be 49 00 00 00       	mov    $0x49,%esi
+  8024b1:	48 b8 67 6e 80 00 00 	movabs $0x806e67,%rax
+  8024b8:	00 00 00 
+  8024bb:	48 89 c7             	mov    %rax,%rdi
+  8024be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c3:	49 b9 cc 05 80 00 00 	movabs $0x8005cc,%r9
+  8024ca:	00 00 00 
+  8024cd:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8024d0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8024d5:	75 13                	jne    8024ea <sys_env_wait+0x82>
+  8024d7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8024dc:	74 0c                	je     8024ea <sys_env_wait+0x82>
+    *status = st;
+  8024de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024e2:	89 c2                	mov    %eax,%edx
+  8024e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024e8:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8024ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+00000000008024f0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8024f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802500:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802506:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80250b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802510:	be 00 00 00 00       	mov    $0x0,%esi
+  802515:	bf 02 00 00 00       	mov    $0x2,%edi
+  80251a:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+  802526:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+
+000000000080252c <sys_yield>:
+
+void
+sys_yield(void) {
+  80252c:	55                   	push   %rbp
+  80252d:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802530:	48 83 ec 08          	sub    $0x8,%rsp
+  802534:	6a 00                	push   $0x0
+  802536:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80253c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802542:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254c:	be 00 00 00 00       	mov    $0x0,%esi
+  802551:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802556:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802566:	90                   	nop
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+0000000000802569 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	48 83 ec 20          	sub    $0x20,%rsp
+  802571:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802574:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802578:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80257b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80257e:	48 63 c8             	movslq %eax,%rcx
+  802581:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802585:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802588:	48 98                	cltq
+  80258a:	48 83 ec 08          	sub    $0x8,%rsp
+  80258e:	6a 00                	push   $0x0
+  802590:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802596:	49 89 c8             	mov    %rcx,%r8
+  802599:	48 89 d1             	mov    %rdx,%rcx
+  80259c:	48 89 c2             	mov    %rax,%rdx
+  80259f:	be 01 00 00 00       	mov    $0x1,%esi
+  8025a4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8025a9:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+  8025b5:	48 83 c4 10          	add    $0x10,%rsp
+  8025b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8025bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8025bf:	c9                   	leave
+  8025c0:	c3                   	ret
+
+00000000008025c1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8025c1:	55                   	push   %rbp
+  8025c2:	48 89 e5             	mov    %rsp,%rbp
+  8025c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8025c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025d0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8025d3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025d7:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8025db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8025de:	48 63 c8             	movslq %eax,%rcx
+  8025e1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8025e8:	48 63 f0             	movslq %eax,%rsi
+  8025eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025f2:	48 98                	cltq
+  8025f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f8:	51                   	push   %rcx
+  8025f9:	49 89 f9             	mov    %rdi,%r9
+  8025fc:	49 89 f0             	mov    %rsi,%r8
+  8025ff:	48 89 d1             	mov    %rdx,%rcx
+  802602:	48 89 c2             	mov    %rax,%rdx
+  802605:	be 01 00 00 00       	mov    $0x1,%esi
+  80260a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80260f:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+  80261b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80261f:	c9                   	leave
+  802620:	c3                   	ret
+
+0000000000802621 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802621:	55                   	push   %rbp
+  802622:	48 89 e5             	mov    %rsp,%rbp
+  802625:	48 83 ec 10          	sub    $0x10,%rsp
+  802629:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80262c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802630:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802634:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802637:	48 98                	cltq
+  802639:	48 83 ec 08          	sub    $0x8,%rsp
+  80263d:	6a 00                	push   $0x0
+  80263f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80264b:	48 89 d1             	mov    %rdx,%rcx
+  80264e:	48 89 c2             	mov    %rax,%rdx
+  802651:	be 01 00 00 00       	mov    $0x1,%esi
+  802656:	bf 08 00 00 00       	mov    $0x8,%edi
+  80265b:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+  802667:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80266b:	c9                   	leave
+  80266c:	c3                   	ret
+
+000000000080266d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80266d:	55                   	push   %rbp
+  80266e:	48 89 e5             	mov    %rsp,%rbp
+  802671:	48 83 ec 10          	sub    $0x10,%rsp
+  802675:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802678:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80267b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80267e:	48 63 d0             	movslq %eax,%rdx
+  802681:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802684:	48 98                	cltq
+  802686:	48 83 ec 08          	sub    $0x8,%rsp
+  80268a:	6a 00                	push   $0x0
+  80268c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802692:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802698:	48 89 d1             	mov    %rdx,%rcx
+  80269b:	48 89 c2             	mov    %rax,%rdx
+  80269e:	be 01 00 00 00       	mov    $0x1,%esi
+  8026a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8026a8:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8026af:	00 00 00 
+  8026b2:	ff d0                	call   *%rax
+  8026b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b8:	c9                   	leave
+  8026b9:	c3                   	ret
+
+00000000008026ba <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8026ba:	55                   	push   %rbp
+  8026bb:	48 89 e5             	mov    %rsp,%rbp
+  8026be:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8026c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026d0:	48 98                	cltq
+  8026d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d6:	6a 00                	push   $0x0
+  8026d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026e4:	48 89 d1             	mov    %rdx,%rcx
+  8026e7:	48 89 c2             	mov    %rax,%rdx
+  8026ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ef:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8026f4:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+  802700:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802704:	c9                   	leave
+  802705:	c3                   	ret
+
+0000000000802706 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802706:	55                   	push   %rbp
+  802707:	48 89 e5             	mov    %rsp,%rbp
+  80270a:	48 83 ec 10          	sub    $0x10,%rsp
+  80270e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802711:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802715:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802719:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80271c:	48 98                	cltq
+  80271e:	48 83 ec 08          	sub    $0x8,%rsp
+  802722:	6a 00                	push   $0x0
+  802724:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80272a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802730:	48 89 d1             	mov    %rdx,%rcx
+  802733:	48 89 c2             	mov    %rax,%rdx
+  802736:	be 01 00 00 00       	mov    $0x1,%esi
+  80273b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802740:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802747:	00 00 00 
+  80274a:	ff d0                	call   *%rax
+  80274c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+0000000000802752 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802752:	55                   	push   %rbp
+  802753:	48 89 e5             	mov    %rsp,%rbp
+  802756:	48 83 ec 20          	sub    $0x20,%rsp
+  80275a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80275d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802761:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802765:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802768:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80276b:	48 63 f0             	movslq %eax,%rsi
+  80276e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802772:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802776:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802779:	48 98                	cltq
+  80277b:	48 83 ec 08          	sub    $0x8,%rsp
+  80277f:	6a 00                	push   $0x0
+  802781:	49 89 f1             	mov    %rsi,%r9
+  802784:	49 89 c8             	mov    %rcx,%r8
+  802787:	48 89 d1             	mov    %rdx,%rcx
+  80278a:	48 89 c2             	mov    %rax,%rdx
+  80278d:	be 00 00 00 00       	mov    $0x0,%esi
+  802792:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802797:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027a7:	c9                   	leave
+  8027a8:	c3                   	ret
+
+00000000008027a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8027b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bd:	6a 00                	push   $0x0
+  8027bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d0:	48 89 c2             	mov    %rax,%rdx
+  8027d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d8:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8027dd:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ed:	c9                   	leave
+  8027ee:	c3                   	ret
+
+00000000008027ef <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8027ef:	55                   	push   %rbp
+  8027f0:	48 89 e5             	mov    %rsp,%rbp
+  8027f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8027ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802807:	48 83 ec 08          	sub    $0x8,%rsp
+  80280b:	6a 00                	push   $0x0
+  80280d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802813:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802819:	48 89 d1             	mov    %rdx,%rcx
+  80281c:	48 89 c2             	mov    %rax,%rdx
+  80281f:	be 01 00 00 00       	mov    $0x1,%esi
+  802824:	bf 10 00 00 00       	mov    $0x10,%edi
+  802829:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802830:	00 00 00 
+  802833:	ff d0                	call   *%rax
+  802835:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802839:	c9                   	leave
+  80283a:	c3                   	ret
+
+000000000080283b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80283b:	55                   	push   %rbp
+  80283c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80283f:	48 83 ec 08          	sub    $0x8,%rsp
+  802843:	6a 00                	push   $0x0
+  802845:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802851:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802856:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285b:	be 00 00 00 00       	mov    $0x0,%esi
+  802860:	bf 11 00 00 00       	mov    $0x11,%edi
+  802865:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80286c:	00 00 00 
+  80286f:	ff d0                	call   *%rax
+  802871:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802875:	c9                   	leave
+  802876:	c3                   	ret
+
+0000000000802877 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802877:	55                   	push   %rbp
+  802878:	48 89 e5             	mov    %rsp,%rbp
+  80287b:	48 83 ec 10          	sub    $0x10,%rsp
+  80287f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802883:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802887:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80288b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80288f:	48 83 ec 08          	sub    $0x8,%rsp
+  802893:	6a 00                	push   $0x0
+  802895:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80289b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a1:	48 89 d1             	mov    %rdx,%rcx
+  8028a4:	48 89 c2             	mov    %rax,%rdx
+  8028a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ac:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028b1:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c1:	c9                   	leave
+  8028c2:	c3                   	ret
+
+00000000008028c3 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8028c3:	55                   	push   %rbp
+  8028c4:	48 89 e5             	mov    %rsp,%rbp
+  8028c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8028cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028d3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8028d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028d9:	48 63 c8             	movslq %eax,%rcx
+  8028dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e8:	6a 00                	push   $0x0
+  8028ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028f0:	49 89 c8             	mov    %rcx,%r8
+  8028f3:	48 89 d1             	mov    %rdx,%rcx
+  8028f6:	48 89 c2             	mov    %rax,%rdx
+  8028f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fe:	bf 13 00 00 00       	mov    $0x13,%edi
+  802903:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+  80290f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802913:	c9                   	leave
+  802914:	c3                   	ret
+
+0000000000802915 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802915:	55                   	push   %rbp
+  802916:	48 89 e5             	mov    %rsp,%rbp
+  802919:	48 83 ec 20          	sub    $0x20,%rsp
+  80291d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802921:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802924:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802928:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80292c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80292f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802933:	48 83 ec 08          	sub    $0x8,%rsp
+  802937:	6a 00                	push   $0x0
+  802939:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80293f:	49 89 c8             	mov    %rcx,%r8
+  802942:	48 89 d1             	mov    %rdx,%rcx
+  802945:	48 89 c2             	mov    %rax,%rdx
+  802948:	be 00 00 00 00       	mov    $0x0,%esi
+  80294d:	bf 14 00 00 00       	mov    $0x14,%edi
+  802952:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+  80295e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802962:	c9                   	leave
+  802963:	c3                   	ret
+
+0000000000802964 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802964:	55                   	push   %rbp
+  802965:	48 89 e5             	mov    %rsp,%rbp
+  802968:	48 83 ec 10          	sub    $0x10,%rsp
+  80296c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802970:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802973:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802976:	48 63 d0             	movslq %eax,%rdx
+  802979:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80297d:	48 83 ec 08          	sub    $0x8,%rsp
+  802981:	6a 00                	push   $0x0
+  802983:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802989:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80298f:	48 89 d1             	mov    %rdx,%rcx
+  802992:	48 89 c2             	mov    %rax,%rdx
+  802995:	be 00 00 00 00       	mov    $0x0,%esi
+  80299a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80299f:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+  8029ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029af:	c9                   	leave
+  8029b0:	c3                   	ret
+
+00000000008029b1 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8029b1:	55                   	push   %rbp
+  8029b2:	48 89 e5             	mov    %rsp,%rbp
+  8029b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8029b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029bd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8029c0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8029c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8029c7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8029cb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8029ce:	48 63 c8             	movslq %eax,%rcx
+  8029d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029d4:	48 63 d0             	movslq %eax,%rdx
+  8029d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029db:	48 83 ec 08          	sub    $0x8,%rsp
+  8029df:	6a 00                	push   $0x0
+  8029e1:	49 89 f1             	mov    %rsi,%r9
+  8029e4:	49 89 c8             	mov    %rcx,%r8
+  8029e7:	48 89 d1             	mov    %rdx,%rcx
+  8029ea:	48 89 c2             	mov    %rax,%rdx
+  8029ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8029f7:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a07:	c9                   	leave
+  802a08:	c3                   	ret
+
+0000000000802a09 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802a09:	55                   	push   %rbp
+  802a0a:	48 89 e5             	mov    %rsp,%rbp
+  802a0d:	48 83 ec 30          	sub    $0x30,%rsp
+  802a11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a15:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a19:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a1d:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802a21:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802a25:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802a29:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802a2d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a39:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3d:	51                   	push   %rcx
+  802a3e:	49 89 f9             	mov    %rdi,%r9
+  802a41:	49 89 f0             	mov    %rsi,%r8
+  802a44:	48 89 d1             	mov    %rdx,%rcx
+  802a47:	48 89 c2             	mov    %rax,%rdx
+  802a4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a4f:	bf 17 00 00 00       	mov    $0x17,%edi
+  802a54:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+  802a60:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+
+0000000000802a66 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802a66:	55                   	push   %rbp
+  802a67:	48 89 e5             	mov    %rsp,%rbp
+  802a6a:	48 83 ec 10          	sub    $0x10,%rsp
+  802a6e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802a71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a74:	48 98                	cltq
+  802a76:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7a:	6a 00                	push   $0x0
+  802a7c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a8d:	48 89 c2             	mov    %rax,%rdx
+  802a90:	be 00 00 00 00       	mov    $0x0,%esi
+  802a95:	bf 18 00 00 00       	mov    $0x18,%edi
+  802a9a:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802aa1:	00 00 00 
+  802aa4:	ff d0                	call   *%rax
+  802aa6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aaa:	90                   	nop
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+0000000000802aad <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	48 83 ec 30          	sub    $0x30,%rsp
+  802ab5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ab8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802abc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802ac0:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802ac3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802ac6:	48 63 f0             	movslq %eax,%rsi
+  802ac9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802acd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ad1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ad4:	48 98                	cltq
+  802ad6:	48 83 ec 08          	sub    $0x8,%rsp
+  802ada:	6a 00                	push   $0x0
+  802adc:	49 89 f1             	mov    %rsi,%r9
+  802adf:	49 89 c8             	mov    %rcx,%r8
+  802ae2:	48 89 d1             	mov    %rdx,%rcx
+  802ae5:	48 89 c2             	mov    %rax,%rdx
+  802ae8:	be 01 00 00 00       	mov    $0x1,%esi
+  802aed:	bf 19 00 00 00       	mov    $0x19,%edi
+  802af2:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+  802afe:	48 83 c4 10          	add    $0x10,%rsp
+  802b02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+
+0000000000802b0a <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802b0a:	55                   	push   %rbp
+  802b0b:	48 89 e5             	mov    %rsp,%rbp
+  802b0e:	48 83 ec 20          	sub    $0x20,%rsp
+  802b12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b1a:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802b1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b20:	48 63 c8             	movslq %eax,%rcx
+  802b23:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2f:	6a 00                	push   $0x0
+  802b31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b37:	49 89 c8             	mov    %rcx,%r8
+  802b3a:	48 89 d1             	mov    %rdx,%rcx
+  802b3d:	48 89 c2             	mov    %rax,%rdx
+  802b40:	be 01 00 00 00       	mov    $0x1,%esi
+  802b45:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802b4a:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+  802b56:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+
+0000000000802b5c <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802b5c:	55                   	push   %rbp
+  802b5d:	48 89 e5             	mov    %rsp,%rbp
+  802b60:	48 83 ec 20          	sub    $0x20,%rsp
+  802b64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b68:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b6c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802b70:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802b74:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b7c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b80:	6a 00                	push   $0x0
+  802b82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b88:	49 89 c8             	mov    %rcx,%r8
+  802b8b:	48 89 d1             	mov    %rdx,%rcx
+  802b8e:	48 89 c2             	mov    %rax,%rdx
+  802b91:	be 01 00 00 00       	mov    $0x1,%esi
+  802b96:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802b9b:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+  802ba7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+
+0000000000802bad <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802bad:	55                   	push   %rbp
+  802bae:	48 89 e5             	mov    %rsp,%rbp
+  802bb1:	48 83 ec 30          	sub    $0x30,%rsp
+  802bb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802bb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802bbd:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802bc0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802bc4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bc8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bcb:	48 63 c8             	movslq %eax,%rcx
+  802bce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bd6:	48 83 ec 08          	sub    $0x8,%rsp
+  802bda:	6a 00                	push   $0x0
+  802bdc:	49 89 f1             	mov    %rsi,%r9
+  802bdf:	49 89 c8             	mov    %rcx,%r8
+  802be2:	48 89 d1             	mov    %rdx,%rcx
+  802be5:	48 89 c2             	mov    %rax,%rdx
+  802be8:	be 01 00 00 00       	mov    $0x1,%esi
+  802bed:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802bf2:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+  802bfe:	48 83 c4 10          	add    $0x10,%rsp
+  802c02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802c05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+
+0000000000802c0a <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802c0a:	55                   	push   %rbp
+  802c0b:	48 89 e5             	mov    %rsp,%rbp
+  802c0e:	48 83 ec 10          	sub    $0x10,%rsp
+  802c12:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802c15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c18:	48 98                	cltq
+  802c1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1e:	6a 00                	push   $0x0
+  802c20:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c31:	48 89 c2             	mov    %rax,%rdx
+  802c34:	be 01 00 00 00       	mov    $0x1,%esi
+  802c39:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802c3e:	48 b8 b9 22 80 00 00 	movabs $0x8022b9,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+  802c4a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c4e:	c9                   	leave
+  802c4f:	c3                   	ret
+
+0000000000802c50 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802c50:	55                   	push   %rbp
+  802c51:	48 89 e5             	mov    %rsp,%rbp
+  802c54:	48 83 ec 40          	sub    $0x40,%rsp
+  802c58:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802c5c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c60:	48 8b 00             	mov    (%rax),%rax
+  802c63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802c67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c6b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802c6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c77:	83 e0 02             	and    $0x2,%eax
+  802c7a:	48 85 c0             	test   %rax,%rax
+  802c7d:	74 25                	je     802ca4 <pgfault+0x54>
+  802c7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c83:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c87:	48 89 c2             	mov    %rax,%rdx
+  802c8a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c91:	01 00 00 
+  802c94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c98:	83 e0 02             	and    $0x2,%eax
+  802c9b:	48 85 c0             	test   %rax,%rax
+  802c9e:	0f 85 fe 01 00 00    	jne    802ea2 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802ca4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca8:	83 e0 02             	and    $0x2,%eax
+  802cab:	48 85 c0             	test   %rax,%rax
+  802cae:	74 23                	je     802cd3 <pgfault+0x83>
+  802cb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cb4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cb8:	48 89 c2             	mov    %rax,%rdx
+  802cbb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cc2:	01 00 00 
+  802cc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cc9:	25 00 08 00 00       	and    $0x800,%eax
+  802cce:	48 85 c0             	test   %rax,%rax
+  802cd1:	75 3f                	jne    802d12 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802cd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cd7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802cdb:	49 89 d0             	mov    %rdx,%r8
+  802cde:	48 89 c1             	mov    %rax,%rcx
+  802ce1:	48 b8 78 6e 80 00 00 	movabs $0x806e78,%rax
+  802ce8:	00 00 00 
+  802ceb:	48 89 c2             	mov    %rax,%rdx
+  802cee:	be 26 00 00 00       	mov    $0x26,%esi
+  802cf3:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  802cfa:	00 00 00 
+  802cfd:	48 89 c7             	mov    %rax,%rdi
+  802d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d05:	49 b9 cc 05 80 00 00 	movabs $0x8005cc,%r9
+  802d0c:	00 00 00 
+  802d0f:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802d12:	48 b8 66 58 80 00 00 	movabs $0x805866,%rax
+  802d19:	00 00 00 
+  802d1c:	ff d0                	call   *%rax
+  802d1e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d26:	ba 07 00 00 00       	mov    $0x7,%edx
+  802d2b:	48 89 c6             	mov    %rax,%rsi
+  802d2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d33:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802d42:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d46:	79 36                	jns    802d7e <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802d48:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d4b:	89 c1                	mov    %eax,%ecx
+  802d4d:	48 b8 b8 6e 80 00 00 	movabs $0x806eb8,%rax
+  802d54:	00 00 00 
+  802d57:	48 89 c2             	mov    %rax,%rdx
+  802d5a:	be 35 00 00 00       	mov    $0x35,%esi
+  802d5f:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  802d66:	00 00 00 
+  802d69:	48 89 c7             	mov    %rax,%rdi
+  802d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d71:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  802d78:	00 00 00 
+  802d7b:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802d7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d82:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d8a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d90:	48 89 c1             	mov    %rax,%rcx
+  802d93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d9c:	48 89 ce             	mov    %rcx,%rsi
+  802d9f:	48 89 c7             	mov    %rax,%rdi
+  802da2:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  802da9:	00 00 00 
+  802dac:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802dae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802db2:	48 c1 e8 0c          	shr    $0xc,%rax
+  802db6:	48 89 c2             	mov    %rax,%rdx
+  802db9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dc0:	01 00 00 
+  802dc3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dc7:	25 00 08 00 00       	and    $0x800,%eax
+  802dcc:	48 85 c0             	test   %rax,%rax
+  802dcf:	74 7a                	je     802e4b <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802dd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dd5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802dd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ddd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802de3:	48 89 c2             	mov    %rax,%rdx
+  802de6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dea:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802df0:	48 89 d1             	mov    %rdx,%rcx
+  802df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df8:	48 89 c6             	mov    %rax,%rsi
+  802dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e00:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  802e07:	00 00 00 
+  802e0a:	ff d0                	call   *%rax
+  802e0c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802e0f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802e13:	79 36                	jns    802e4b <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802e15:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802e18:	89 c1                	mov    %eax,%ecx
+  802e1a:	48 b8 e0 6e 80 00 00 	movabs $0x806ee0,%rax
+  802e21:	00 00 00 
+  802e24:	48 89 c2             	mov    %rax,%rdx
+  802e27:	be 42 00 00 00       	mov    $0x42,%esi
+  802e2c:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  802e33:	00 00 00 
+  802e36:	48 89 c7             	mov    %rax,%rdi
+  802e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3e:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  802e45:	00 00 00 
+  802e48:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802e4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e4f:	48 89 c6             	mov    %rax,%rsi
+  802e52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e57:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  802e5e:	00 00 00 
+  802e61:	ff d0                	call   *%rax
+  802e63:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802e66:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802e6a:	79 37                	jns    802ea3 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802e6c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802e6f:	89 c1                	mov    %eax,%ecx
+  802e71:	48 b8 08 6f 80 00 00 	movabs $0x806f08,%rax
+  802e78:	00 00 00 
+  802e7b:	48 89 c2             	mov    %rax,%rdx
+  802e7e:	be 46 00 00 00       	mov    $0x46,%esi
+  802e83:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  802e8a:	00 00 00 
+  802e8d:	48 89 c7             	mov    %rax,%rdi
+  802e90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e95:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  802e9c:	00 00 00 
+  802e9f:	41 ff d0             	call   *%r8
+    return;
+  802ea2:	90                   	nop
+  }
+}
+  802ea3:	c9                   	leave
+  802ea4:	c3                   	ret
+
+0000000000802ea5 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802ea5:	55                   	push   %rbp
+  802ea6:	48 89 e5             	mov    %rsp,%rbp
+  802ea9:	48 83 ec 30          	sub    $0x30,%rsp
+  802ead:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802eb0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802eb4:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ebb:	01 00 00 
+  802ebe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ec2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ec6:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ecb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802ecf:	48 b8 f0 24 80 00 00 	movabs $0x8024f0,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+  802edb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802ede:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ee2:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ee6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802eea:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ef1:	01 00 00 
+  802ef4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ef8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802efc:	25 00 04 00 00       	and    $0x400,%eax
+  802f01:	48 85 c0             	test   %rax,%rax
+  802f04:	74 7b                	je     802f81 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802f06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f0a:	89 c1                	mov    %eax,%ecx
+  802f0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f10:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f14:	48 89 c2             	mov    %rax,%rdx
+  802f17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f1b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f1f:	48 89 c6             	mov    %rax,%rsi
+  802f22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f25:	41 89 c8             	mov    %ecx,%r8d
+  802f28:	48 89 d1             	mov    %rdx,%rcx
+  802f2b:	89 c2                	mov    %eax,%edx
+  802f2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f32:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f45:	0f 89 da 00 00 00    	jns    803025 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802f4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f4e:	89 c1                	mov    %eax,%ecx
+  802f50:	48 b8 30 6f 80 00 00 	movabs $0x806f30,%rax
+  802f57:	00 00 00 
+  802f5a:	48 89 c2             	mov    %rax,%rdx
+  802f5d:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802f62:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  802f69:	00 00 00 
+  802f6c:	48 89 c7             	mov    %rax,%rdi
+  802f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f74:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  802f7b:	00 00 00 
+  802f7e:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802f81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f85:	25 02 08 00 00       	and    $0x802,%eax
+  802f8a:	48 85 c0             	test   %rax,%rax
+  802f8d:	74 6e                	je     802ffd <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f93:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802f99:	80 cc 08             	or     $0x8,%ah
+  802f9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802fa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fa4:	89 c7                	mov    %eax,%edi
+  802fa6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802faa:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802fad:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802fb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fb4:	41 89 f8             	mov    %edi,%r8d
+  802fb7:	89 c7                	mov    %eax,%edi
+  802fb9:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  802fc0:	00 00 00 
+  802fc3:	ff d0                	call   *%rax
+  802fc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802fc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fcc:	79 05                	jns    802fd3 <duppage+0x12e>
+      return r;
+  802fce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fd1:	eb 55                	jmp    803028 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802fd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd7:	89 c7                	mov    %eax,%edi
+  802fd9:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802fdd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802fe0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802fe4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fe7:	41 89 f8             	mov    %edi,%r8d
+  802fea:	89 c7                	mov    %eax,%edi
+  802fec:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  802ff3:	00 00 00 
+  802ff6:	ff d0                	call   *%rax
+  802ff8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ffb:	eb 28                	jmp    803025 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802ffd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803001:	89 c7                	mov    %eax,%edi
+  803003:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803007:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80300a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80300e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803011:	41 89 f8             	mov    %edi,%r8d
+  803014:	89 c7                	mov    %eax,%edi
+  803016:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+  803022:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  803025:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803028:	c9                   	leave
+  803029:	c3                   	ret
+
+000000000080302a <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  80302a:	55                   	push   %rbp
+  80302b:	48 89 e5             	mov    %rsp,%rbp
+  80302e:	48 83 ec 20          	sub    $0x20,%rsp
+  803032:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803035:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  803039:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80303d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803041:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  803045:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  80304c:	01 00 00 
+  80304f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803053:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803057:	25 00 08 00 00       	and    $0x800,%eax
+  80305c:	48 85 c0             	test   %rax,%rax
+  80305f:	74 0d                	je     80306e <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  803061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803065:	0f b6 10             	movzbl (%rax),%edx
+  803068:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80306c:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  80306e:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  803075:	01 00 00 
+  803078:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80307c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803080:	25 07 0e 00 00       	and    $0xe07,%eax
+  803085:	89 c6                	mov    %eax,%esi
+  803087:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80308b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80308e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803092:	41 89 f0             	mov    %esi,%r8d
+  803095:	48 89 c6             	mov    %rax,%rsi
+  803098:	bf 00 00 00 00       	mov    $0x0,%edi
+  80309d:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+}
+  8030a9:	c9                   	leave
+  8030aa:	c3                   	ret
+
+00000000008030ab <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  8030ab:	55                   	push   %rbp
+  8030ac:	48 89 e5             	mov    %rsp,%rbp
+  8030af:	48 83 ec 40          	sub    $0x40,%rsp
+  8030b3:	89 f8                	mov    %edi,%eax
+  8030b5:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  8030b8:	48 b8 50 2c 80 00 00 	movabs $0x802c50,%rax
+  8030bf:	00 00 00 
+  8030c2:	48 89 c7             	mov    %rax,%rdi
+  8030c5:	48 b8 18 5d 80 00 00 	movabs $0x805d18,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  8030d1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8030d6:	cd 30                	int    $0x30
+  8030d8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  8030db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  8030de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030e5:	79 36                	jns    80311d <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  8030e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030ea:	89 c1                	mov    %eax,%ecx
+  8030ec:	48 b8 5b 6f 80 00 00 	movabs $0x806f5b,%rax
+  8030f3:	00 00 00 
+  8030f6:	48 89 c2             	mov    %rax,%rdx
+  8030f9:	be 8f 00 00 00       	mov    $0x8f,%esi
+  8030fe:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  803105:	00 00 00 
+  803108:	48 89 c7             	mov    %rax,%rdi
+  80310b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803110:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  803117:	00 00 00 
+  80311a:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  80311d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803121:	75 0a                	jne    80312d <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  803123:	b8 00 00 00 00       	mov    $0x0,%eax
+  803128:	e9 d3 02 00 00       	jmp    803400 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  80312d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803134:	00 
+  803135:	e9 7a 01 00 00       	jmp    8032b4 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  80313a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80313e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803142:	48 c1 e8 27          	shr    $0x27,%rax
+  803146:	48 89 c2             	mov    %rax,%rdx
+  803149:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803150:	01 00 00 
+  803153:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803157:	83 e0 01             	and    $0x1,%eax
+  80315a:	48 85 c0             	test   %rax,%rax
+  80315d:	0f 84 4c 01 00 00    	je     8032af <fork_common+0x204>
+  803163:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803167:	48 c1 e0 0c          	shl    $0xc,%rax
+  80316b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80316f:	48 89 c2             	mov    %rax,%rdx
+  803172:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803179:	01 00 00 
+  80317c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803180:	83 e0 01             	and    $0x1,%eax
+  803183:	48 85 c0             	test   %rax,%rax
+  803186:	0f 84 23 01 00 00    	je     8032af <fork_common+0x204>
+  80318c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803190:	48 c1 e0 0c          	shl    $0xc,%rax
+  803194:	48 c1 e8 15          	shr    $0x15,%rax
+  803198:	48 89 c2             	mov    %rax,%rdx
+  80319b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8031a2:	01 00 00 
+  8031a5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031a9:	83 e0 01             	and    $0x1,%eax
+  8031ac:	48 85 c0             	test   %rax,%rax
+  8031af:	0f 84 fa 00 00 00    	je     8032af <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  8031b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8031c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031c5:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  8031cc:	00 00 00 
+  8031cf:	48 39 c2             	cmp    %rax,%rdx
+  8031d2:	0f 82 d7 00 00 00    	jb     8032af <fork_common+0x204>
+  8031d8:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  8031df:	00 00 00 
+  8031e2:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8031e6:	0f 84 c3 00 00 00    	je     8032af <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  8031ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031f0:	48 89 c7             	mov    %rax,%rdi
+  8031f3:	48 b8 22 58 80 00 00 	movabs $0x805822,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803202:	84 c0                	test   %al,%al
+  803204:	0f 84 a5 00 00 00    	je     8032af <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  80320a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80320e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803212:	48 89 c2             	mov    %rax,%rdx
+  803215:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80321c:	01 00 00 
+  80321f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803223:	83 e0 01             	and    $0x1,%eax
+  803226:	48 85 c0             	test   %rax,%rax
+  803229:	0f 84 80 00 00 00    	je     8032af <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  80322f:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803233:	74 4a                	je     80327f <fork_common+0x1d4>
+  803235:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803239:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803240:	00 00 00 
+  803243:	48 39 c2             	cmp    %rax,%rdx
+  803246:	73 13                	jae    80325b <fork_common+0x1b0>
+  803248:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80324c:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803253:	00 00 00 
+  803256:	48 39 c2             	cmp    %rax,%rdx
+  803259:	73 24                	jae    80327f <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  80325b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803263:	48 89 c2             	mov    %rax,%rdx
+  803266:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803269:	48 89 d6             	mov    %rdx,%rsi
+  80326c:	89 c7                	mov    %eax,%edi
+  80326e:	48 b8 2a 30 80 00 00 	movabs $0x80302a,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+  80327a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80327d:	eb 22                	jmp    8032a1 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  80327f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803283:	48 c1 e8 0c          	shr    $0xc,%rax
+  803287:	48 89 c2             	mov    %rax,%rdx
+  80328a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80328d:	48 89 d6             	mov    %rdx,%rsi
+  803290:	89 c7                	mov    %eax,%edi
+  803292:	48 b8 a5 2e 80 00 00 	movabs $0x802ea5,%rax
+  803299:	00 00 00 
+  80329c:	ff d0                	call   *%rax
+  80329e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8032a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032a5:	79 08                	jns    8032af <fork_common+0x204>
+            return r;
+  8032a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032aa:	e9 51 01 00 00       	jmp    803400 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8032af:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8032b4:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8032bb:	07 
+  8032bc:	0f 86 78 fe ff ff    	jbe    80313a <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8032c2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8032c9:	00 00 00 
+  8032cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8032cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032d4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032db:	00 00 00 
+  8032de:	48 98                	cltq
+  8032e0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032e7:	48 01 d0             	add    %rdx,%rax
+  8032ea:	48 05 00 01 00 00    	add    $0x100,%rax
+  8032f0:	48 8b 10             	mov    (%rax),%rdx
+  8032f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032f6:	48 89 d6             	mov    %rdx,%rsi
+  8032f9:	89 c7                	mov    %eax,%edi
+  8032fb:	48 b8 06 27 80 00 00 	movabs $0x802706,%rax
+  803302:	00 00 00 
+  803305:	ff d0                	call   *%rax
+  803307:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80330a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80330e:	79 36                	jns    803346 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803310:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803313:	89 c1                	mov    %eax,%ecx
+  803315:	48 b8 70 6f 80 00 00 	movabs $0x806f70,%rax
+  80331c:	00 00 00 
+  80331f:	48 89 c2             	mov    %rax,%rdx
+  803322:	be be 00 00 00       	mov    $0xbe,%esi
+  803327:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  80332e:	00 00 00 
+  803331:	48 89 c7             	mov    %rax,%rdi
+  803334:	b8 00 00 00 00       	mov    $0x0,%eax
+  803339:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  803340:	00 00 00 
+  803343:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803346:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803349:	ba 02 00 00 00       	mov    $0x2,%edx
+  80334e:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803355:	00 00 00 
+  803358:	48 89 ce             	mov    %rcx,%rsi
+  80335b:	89 c7                	mov    %eax,%edi
+  80335d:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+  803369:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80336c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803370:	79 36                	jns    8033a8 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803372:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803375:	89 c1                	mov    %eax,%ecx
+  803377:	48 b8 a0 6f 80 00 00 	movabs $0x806fa0,%rax
+  80337e:	00 00 00 
+  803381:	48 89 c2             	mov    %rax,%rdx
+  803384:	be c1 00 00 00       	mov    $0xc1,%esi
+  803389:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  803390:	00 00 00 
+  803393:	48 89 c7             	mov    %rax,%rdi
+  803396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339b:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  8033a2:	00 00 00 
+  8033a5:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8033a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ab:	be 02 00 00 00       	mov    $0x2,%esi
+  8033b0:	89 c7                	mov    %eax,%edi
+  8033b2:	48 b8 6d 26 80 00 00 	movabs $0x80266d,%rax
+  8033b9:	00 00 00 
+  8033bc:	ff d0                	call   *%rax
+  8033be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033c5:	79 36                	jns    8033fd <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  8033c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033ca:	89 c1                	mov    %eax,%ecx
+  8033cc:	48 b8 c0 6f 80 00 00 	movabs $0x806fc0,%rax
+  8033d3:	00 00 00 
+  8033d6:	48 89 c2             	mov    %rax,%rdx
+  8033d9:	be d4 00 00 00       	mov    $0xd4,%esi
+  8033de:	48 b8 a6 6e 80 00 00 	movabs $0x806ea6,%rax
+  8033e5:	00 00 00 
+  8033e8:	48 89 c7             	mov    %rax,%rdi
+  8033eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f0:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  8033f7:	00 00 00 
+  8033fa:	41 ff d0             	call   *%r8
+    }
+    return e;
+  8033fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803400:	c9                   	leave
+  803401:	c3                   	ret
+
+0000000000803402 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803402:	55                   	push   %rbp
+  803403:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803406:	bf 00 00 00 00       	mov    $0x0,%edi
+  80340b:	48 b8 ab 30 80 00 00 	movabs $0x8030ab,%rax
+  803412:	00 00 00 
+  803415:	ff d0                	call   *%rax
+}
+  803417:	5d                   	pop    %rbp
+  803418:	c3                   	ret
+
+0000000000803419 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803419:	55                   	push   %rbp
+  80341a:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  80341d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803422:	48 b8 ab 30 80 00 00 	movabs $0x8030ab,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+}
+  80342e:	5d                   	pop    %rbp
+  80342f:	c3                   	ret
+
+0000000000803430 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803430:	55                   	push   %rbp
+  803431:	48 89 e5             	mov    %rsp,%rbp
+  803434:	48 83 ec 08          	sub    $0x8,%rsp
+  803438:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80343c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803440:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803447:	ff ff ff 
+  80344a:	48 01 d0             	add    %rdx,%rax
+  80344d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803451:	c9                   	leave
+  803452:	c3                   	ret
+
+0000000000803453 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803453:	55                   	push   %rbp
+  803454:	48 89 e5             	mov    %rsp,%rbp
+  803457:	48 83 ec 08          	sub    $0x8,%rsp
+  80345b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80345f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803463:	48 89 c7             	mov    %rax,%rdi
+  803466:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  80346d:	00 00 00 
+  803470:	ff d0                	call   *%rax
+  803472:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803478:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80347c:	c9                   	leave
+  80347d:	c3                   	ret
+
+000000000080347e <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80347e:	55                   	push   %rbp
+  80347f:	48 89 e5             	mov    %rsp,%rbp
+  803482:	48 83 ec 18          	sub    $0x18,%rsp
+  803486:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80348a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803491:	e9 ae 00 00 00       	jmp    803544 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803496:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803499:	c1 e0 0c             	shl    $0xc,%eax
+  80349c:	48 98                	cltq
+  80349e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8034a3:	48 01 d0             	add    %rdx,%rax
+  8034a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8034aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8034b2:	48 89 c2             	mov    %rax,%rdx
+  8034b5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8034bc:	01 00 00 
+  8034bf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c3:	83 e0 01             	and    $0x1,%eax
+  8034c6:	48 85 c0             	test   %rax,%rax
+  8034c9:	74 63                	je     80352e <fd_alloc+0xb0>
+  8034cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034d3:	48 89 c2             	mov    %rax,%rdx
+  8034d6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8034dd:	01 00 00 
+  8034e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e4:	83 e0 01             	and    $0x1,%eax
+  8034e7:	48 85 c0             	test   %rax,%rax
+  8034ea:	74 42                	je     80352e <fd_alloc+0xb0>
+  8034ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8034f4:	48 89 c2             	mov    %rax,%rdx
+  8034f7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8034fe:	01 00 00 
+  803501:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803505:	83 e0 01             	and    $0x1,%eax
+  803508:	48 85 c0             	test   %rax,%rax
+  80350b:	74 21                	je     80352e <fd_alloc+0xb0>
+  80350d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803511:	48 c1 e8 0c          	shr    $0xc,%rax
+  803515:	48 89 c2             	mov    %rax,%rdx
+  803518:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80351f:	01 00 00 
+  803522:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803526:	83 e0 01             	and    $0x1,%eax
+  803529:	48 85 c0             	test   %rax,%rax
+  80352c:	75 12                	jne    803540 <fd_alloc+0xc2>
+      *fd_store = fd;
+  80352e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803532:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803536:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  803539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353e:	eb 1e                	jmp    80355e <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803540:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803544:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803548:	0f 8e 48 ff ff ff    	jle    803496 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80354e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803552:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803559:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80355e:	c9                   	leave
+  80355f:	c3                   	ret
+
+0000000000803560 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803560:	55                   	push   %rbp
+  803561:	48 89 e5             	mov    %rsp,%rbp
+  803564:	48 83 ec 20          	sub    $0x20,%rsp
+  803568:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80356b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80356f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803573:	78 06                	js     80357b <fd_lookup+0x1b>
+  803575:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803579:	7e 0a                	jle    803585 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80357b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803580:	e9 af 00 00 00       	jmp    803634 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803585:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803588:	c1 e0 0c             	shl    $0xc,%eax
+  80358b:	48 98                	cltq
+  80358d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803592:	48 01 d0             	add    %rdx,%rax
+  803595:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80359d:	48 c1 e8 27          	shr    $0x27,%rax
+  8035a1:	48 89 c2             	mov    %rax,%rdx
+  8035a4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8035ab:	01 00 00 
+  8035ae:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035b2:	83 e0 01             	and    $0x1,%eax
+  8035b5:	48 85 c0             	test   %rax,%rax
+  8035b8:	74 63                	je     80361d <fd_lookup+0xbd>
+  8035ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035c2:	48 89 c2             	mov    %rax,%rdx
+  8035c5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8035cc:	01 00 00 
+  8035cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035d3:	83 e0 01             	and    $0x1,%eax
+  8035d6:	48 85 c0             	test   %rax,%rax
+  8035d9:	74 42                	je     80361d <fd_lookup+0xbd>
+  8035db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035df:	48 c1 e8 15          	shr    $0x15,%rax
+  8035e3:	48 89 c2             	mov    %rax,%rdx
+  8035e6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8035ed:	01 00 00 
+  8035f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035f4:	83 e0 01             	and    $0x1,%eax
+  8035f7:	48 85 c0             	test   %rax,%rax
+  8035fa:	74 21                	je     80361d <fd_lookup+0xbd>
+  8035fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803600:	48 c1 e8 0c          	shr    $0xc,%rax
+  803604:	48 89 c2             	mov    %rax,%rdx
+  803607:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80360e:	01 00 00 
+  803611:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803615:	83 e0 01             	and    $0x1,%eax
+  803618:	48 85 c0             	test   %rax,%rax
+  80361b:	75 07                	jne    803624 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80361d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803622:	eb 10                	jmp    803634 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803624:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803628:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80362c:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80362f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803634:	c9                   	leave
+  803635:	c3                   	ret
+
+0000000000803636 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803636:	55                   	push   %rbp
+  803637:	48 89 e5             	mov    %rsp,%rbp
+  80363a:	48 83 ec 30          	sub    $0x30,%rsp
+  80363e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803642:	89 f0                	mov    %esi,%eax
+  803644:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803647:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80364b:	48 89 c7             	mov    %rax,%rdi
+  80364e:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  803655:	00 00 00 
+  803658:	ff d0                	call   *%rax
+  80365a:	89 c2                	mov    %eax,%edx
+  80365c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803660:	48 89 c6             	mov    %rax,%rsi
+  803663:	89 d7                	mov    %edx,%edi
+  803665:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  80366c:	00 00 00 
+  80366f:	ff d0                	call   *%rax
+  803671:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803674:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803678:	78 0a                	js     803684 <fd_close+0x4e>
+  80367a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80367e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803682:	74 12                	je     803696 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803684:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803688:	74 05                	je     80368f <fd_close+0x59>
+  80368a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80368d:	eb 70                	jmp    8036ff <fd_close+0xc9>
+  80368f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803694:	eb 69                	jmp    8036ff <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803696:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80369a:	8b 00                	mov    (%rax),%eax
+  80369c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8036a0:	48 89 d6             	mov    %rdx,%rsi
+  8036a3:	89 c7                	mov    %eax,%edi
+  8036a5:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036b8:	78 2a                	js     8036e4 <fd_close+0xae>
+    if (dev->dev_close)
+  8036ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036be:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8036c2:	48 85 c0             	test   %rax,%rax
+  8036c5:	74 16                	je     8036dd <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8036c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036cb:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8036cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036d3:	48 89 c7             	mov    %rax,%rdi
+  8036d6:	ff d2                	call   *%rdx
+  8036d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036db:	eb 07                	jmp    8036e4 <fd_close+0xae>
+    else
+      r = 0;
+  8036dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8036e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036e8:	48 89 c6             	mov    %rax,%rsi
+  8036eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f0:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  8036f7:	00 00 00 
+  8036fa:	ff d0                	call   *%rax
+  return r;
+  8036fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8036ff:	c9                   	leave
+  803700:	c3                   	ret
+
+0000000000803701 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803701:	55                   	push   %rbp
+  803702:	48 89 e5             	mov    %rsp,%rbp
+  803705:	48 83 ec 20          	sub    $0x20,%rsp
+  803709:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80370c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803710:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803717:	eb 3f                	jmp    803758 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803719:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803720:	00 00 00 
+  803723:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803726:	48 98                	cltq
+  803728:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80372c:	8b 00                	mov    (%rax),%eax
+  80372e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803731:	75 21                	jne    803754 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803733:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  80373a:	00 00 00 
+  80373d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803740:	48 98                	cltq
+  803742:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803746:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80374a:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803752:	eb 7f                	jmp    8037d3 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803754:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803758:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  80375f:	00 00 00 
+  803762:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803765:	48 98                	cltq
+  803767:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80376b:	48 85 c0             	test   %rax,%rax
+  80376e:	75 a9                	jne    803719 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803770:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803777:	00 00 00 
+  80377a:	8b 40 04             	mov    0x4(%rax),%eax
+  80377d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803782:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803789:	00 00 00 
+  80378c:	48 98                	cltq
+  80378e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803795:	48 01 d0             	add    %rdx,%rax
+  803798:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80379e:	8b 00                	mov    (%rax),%eax
+  8037a0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8037a3:	89 c6                	mov    %eax,%esi
+  8037a5:	48 b8 e8 6f 80 00 00 	movabs $0x806fe8,%rax
+  8037ac:	00 00 00 
+  8037af:	48 89 c7             	mov    %rax,%rdi
+  8037b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b7:	48 b9 eb 07 80 00 00 	movabs $0x8007eb,%rcx
+  8037be:	00 00 00 
+  8037c1:	ff d1                	call   *%rcx
+  *dev = 0;
+  8037c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037c7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8037ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8037d3:	c9                   	leave
+  8037d4:	c3                   	ret
+
+00000000008037d5 <close>:
+
+int
+close(int fdnum) {
+  8037d5:	55                   	push   %rbp
+  8037d6:	48 89 e5             	mov    %rsp,%rbp
+  8037d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8037dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8037e0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8037e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037e7:	48 89 d6             	mov    %rdx,%rsi
+  8037ea:	89 c7                	mov    %eax,%edi
+  8037ec:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+  8037f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037ff:	79 05                	jns    803806 <close+0x31>
+    return r;
+  803801:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803804:	eb 18                	jmp    80381e <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80380a:	be 01 00 00 00       	mov    $0x1,%esi
+  80380f:	48 89 c7             	mov    %rax,%rdi
+  803812:	48 b8 36 36 80 00 00 	movabs $0x803636,%rax
+  803819:	00 00 00 
+  80381c:	ff d0                	call   *%rax
+}
+  80381e:	c9                   	leave
+  80381f:	c3                   	ret
+
+0000000000803820 <close_all>:
+
+void
+close_all(void) {
+  803820:	55                   	push   %rbp
+  803821:	48 89 e5             	mov    %rsp,%rbp
+  803824:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803828:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80382f:	eb 15                	jmp    803846 <close_all+0x26>
+    close(i);
+  803831:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803834:	89 c7                	mov    %eax,%edi
+  803836:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803842:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803846:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80384a:	7e e5                	jle    803831 <close_all+0x11>
+}
+  80384c:	90                   	nop
+  80384d:	90                   	nop
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+0000000000803850 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803850:	55                   	push   %rbp
+  803851:	48 89 e5             	mov    %rsp,%rbp
+  803854:	48 83 ec 40          	sub    $0x40,%rsp
+  803858:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80385b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80385e:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803862:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803865:	48 89 d6             	mov    %rdx,%rsi
+  803868:	89 c7                	mov    %eax,%edi
+  80386a:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803871:	00 00 00 
+  803874:	ff d0                	call   *%rax
+  803876:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803879:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80387d:	79 08                	jns    803887 <dup+0x37>
+    return r;
+  80387f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803882:	e9 33 02 00 00       	jmp    803aba <dup+0x26a>
+  close(newfdnum);
+  803887:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80388a:	89 c7                	mov    %eax,%edi
+  80388c:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803898:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80389b:	c1 e0 0c             	shl    $0xc,%eax
+  80389e:	48 98                	cltq
+  8038a0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8038a5:	48 01 d0             	add    %rdx,%rax
+  8038a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8038ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038b0:	48 89 c7             	mov    %rax,%rdi
+  8038b3:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  8038ba:	00 00 00 
+  8038bd:	ff d0                	call   *%rax
+  8038bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8038c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c7:	48 89 c7             	mov    %rax,%rdi
+  8038ca:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+  8038d6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8038da:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8038e1:	00 
+  8038e2:	e9 19 01 00 00       	jmp    803a00 <dup+0x1b0>
+    off -= PGSIZE;
+  8038e7:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8038ee:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8038ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038f7:	48 01 d0             	add    %rdx,%rax
+  8038fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8038fe:	48 89 c2             	mov    %rax,%rdx
+  803901:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803908:	01 00 00 
+  80390b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80390f:	83 e0 01             	and    $0x1,%eax
+  803912:	48 85 c0             	test   %rax,%rax
+  803915:	0f 84 e5 00 00 00    	je     803a00 <dup+0x1b0>
+  80391b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80391f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803923:	48 01 d0             	add    %rdx,%rax
+  803926:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80392a:	48 89 c2             	mov    %rax,%rdx
+  80392d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803934:	01 00 00 
+  803937:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80393b:	83 e0 01             	and    $0x1,%eax
+  80393e:	48 85 c0             	test   %rax,%rax
+  803941:	0f 84 b9 00 00 00    	je     803a00 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803947:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80394b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80394f:	48 01 d0             	add    %rdx,%rax
+  803952:	48 c1 e8 15          	shr    $0x15,%rax
+  803956:	48 89 c2             	mov    %rax,%rdx
+  803959:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803960:	01 00 00 
+  803963:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803967:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80396a:	48 85 c0             	test   %rax,%rax
+  80396d:	0f 84 8d 00 00 00    	je     803a00 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803973:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803977:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80397b:	48 01 d0             	add    %rdx,%rax
+  80397e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803982:	48 89 c2             	mov    %rax,%rdx
+  803985:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80398c:	01 00 00 
+  80398f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803993:	83 e0 01             	and    $0x1,%eax
+  803996:	48 85 c0             	test   %rax,%rax
+  803999:	74 65                	je     803a00 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80399b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80399f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039a3:	48 01 d0             	add    %rdx,%rax
+  8039a6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039aa:	48 89 c2             	mov    %rax,%rdx
+  8039ad:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8039b4:	01 00 00 
+  8039b7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8039c0:	89 c6                	mov    %eax,%esi
+  8039c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8039c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ca:	48 01 c2             	add    %rax,%rdx
+  8039cd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8039d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d5:	48 01 c8             	add    %rcx,%rax
+  8039d8:	41 89 f0             	mov    %esi,%r8d
+  8039db:	48 89 d1             	mov    %rdx,%rcx
+  8039de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039e3:	48 89 c6             	mov    %rax,%rsi
+  8039e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039eb:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  8039f2:	00 00 00 
+  8039f5:	ff d0                	call   *%rax
+  8039f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039fe:	78 60                	js     803a60 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803a00:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803a05:	0f 85 dc fe ff ff    	jne    8038e7 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803a0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a0f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a13:	48 89 c2             	mov    %rax,%rdx
+  803a16:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a1d:	01 00 00 
+  803a20:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a24:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a29:	89 c1                	mov    %eax,%ecx
+  803a2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a2f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a33:	41 89 c8             	mov    %ecx,%r8d
+  803a36:	48 89 d1             	mov    %rdx,%rcx
+  803a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3e:	48 89 c6             	mov    %rax,%rsi
+  803a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a46:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  803a4d:	00 00 00 
+  803a50:	ff d0                	call   *%rax
+  803a52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a59:	78 08                	js     803a63 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803a5b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803a5e:	eb 5a                	jmp    803aba <dup+0x26a>
+        goto err;
+  803a60:	90                   	nop
+  803a61:	eb 01                	jmp    803a64 <dup+0x214>
+    goto err;
+  803a63:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a68:	48 89 c6             	mov    %rax,%rsi
+  803a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a70:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803a7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803a83:	00 
+  803a84:	eb 27                	jmp    803aad <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803a86:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8e:	48 01 d0             	add    %rdx,%rax
+  803a91:	48 89 c6             	mov    %rax,%rsi
+  803a94:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a99:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  803aa0:	00 00 00 
+  803aa3:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803aa5:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803aac:	00 
+  803aad:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803ab4:	00 
+  803ab5:	76 cf                	jbe    803a86 <dup+0x236>
+  return r;
+  803ab7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803aba:	c9                   	leave
+  803abb:	c3                   	ret
+
+0000000000803abc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803abc:	55                   	push   %rbp
+  803abd:	48 89 e5             	mov    %rsp,%rbp
+  803ac0:	48 83 ec 40          	sub    $0x40,%rsp
+  803ac4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ac7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803acb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803acf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ad3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ad6:	48 89 d6             	mov    %rdx,%rsi
+  803ad9:	89 c7                	mov    %eax,%edi
+  803adb:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803ae2:	00 00 00 
+  803ae5:	ff d0                	call   *%rax
+  803ae7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aee:	78 24                	js     803b14 <read+0x58>
+  803af0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803af4:	8b 00                	mov    (%rax),%eax
+  803af6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803afa:	48 89 d6             	mov    %rdx,%rsi
+  803afd:	89 c7                	mov    %eax,%edi
+  803aff:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+  803b0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b0e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b12:	79 0a                	jns    803b1e <read+0x62>
+    return r;
+  803b14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b17:	48 98                	cltq
+  803b19:	e9 9e 00 00 00       	jmp    803bbc <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b22:	8b 40 08             	mov    0x8(%rax),%eax
+  803b25:	83 e0 03             	and    $0x3,%eax
+  803b28:	83 f8 01             	cmp    $0x1,%eax
+  803b2b:	75 5c                	jne    803b89 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b2d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b34:	00 00 00 
+  803b37:	8b 40 04             	mov    0x4(%rax),%eax
+  803b3a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b3f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b46:	00 00 00 
+  803b49:	48 98                	cltq
+  803b4b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b52:	48 01 d0             	add    %rdx,%rax
+  803b55:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b5b:	8b 00                	mov    (%rax),%eax
+  803b5d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b60:	89 c6                	mov    %eax,%esi
+  803b62:	48 b8 07 70 80 00 00 	movabs $0x807007,%rax
+  803b69:	00 00 00 
+  803b6c:	48 89 c7             	mov    %rax,%rdi
+  803b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b74:	48 b9 eb 07 80 00 00 	movabs $0x8007eb,%rcx
+  803b7b:	00 00 00 
+  803b7e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803b80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b87:	eb 33                	jmp    803bbc <read+0x100>
+  }
+  if (!dev->dev_read)
+  803b89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b8d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803b91:	48 85 c0             	test   %rax,%rax
+  803b94:	75 09                	jne    803b9f <read+0xe3>
+    return -E_NOT_SUPP;
+  803b96:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803b9d:	eb 1d                	jmp    803bbc <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803b9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bab:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803baf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803bb3:	48 89 ce             	mov    %rcx,%rsi
+  803bb6:	48 89 c7             	mov    %rax,%rdi
+  803bb9:	41 ff d0             	call   *%r8
+}
+  803bbc:	c9                   	leave
+  803bbd:	c3                   	ret
+
+0000000000803bbe <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803bbe:	55                   	push   %rbp
+  803bbf:	48 89 e5             	mov    %rsp,%rbp
+  803bc2:	48 83 ec 30          	sub    $0x30,%rsp
+  803bc6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803bc9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803bcd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803bd1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803bd8:	eb 49                	jmp    803c23 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803bda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bdd:	48 98                	cltq
+  803bdf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803be3:	48 29 c2             	sub    %rax,%rdx
+  803be6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803be9:	48 63 c8             	movslq %eax,%rcx
+  803bec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bf0:	48 01 c1             	add    %rax,%rcx
+  803bf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf6:	48 89 ce             	mov    %rcx,%rsi
+  803bf9:	89 c7                	mov    %eax,%edi
+  803bfb:	48 b8 bc 3a 80 00 00 	movabs $0x803abc,%rax
+  803c02:	00 00 00 
+  803c05:	ff d0                	call   *%rax
+  803c07:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803c0a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803c0e:	79 07                	jns    803c17 <readn+0x59>
+      return m;
+  803c10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803c13:	48 98                	cltq
+  803c15:	eb 1f                	jmp    803c36 <readn+0x78>
+    if (m == 0)
+  803c17:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803c1b:	74 13                	je     803c30 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803c1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803c20:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803c23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c26:	48 98                	cltq
+  803c28:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803c2c:	72 ac                	jb     803bda <readn+0x1c>
+  803c2e:	eb 01                	jmp    803c31 <readn+0x73>
+      break;
+  803c30:	90                   	nop
+  }
+  return tot;
+  803c31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c34:	48 98                	cltq
+}
+  803c36:	c9                   	leave
+  803c37:	c3                   	ret
+
+0000000000803c38 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803c38:	55                   	push   %rbp
+  803c39:	48 89 e5             	mov    %rsp,%rbp
+  803c3c:	48 83 ec 40          	sub    $0x40,%rsp
+  803c40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c43:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803c47:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c4b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c52:	48 89 d6             	mov    %rdx,%rsi
+  803c55:	89 c7                	mov    %eax,%edi
+  803c57:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+  803c63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6a:	78 24                	js     803c90 <write+0x58>
+  803c6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c70:	8b 00                	mov    (%rax),%eax
+  803c72:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c76:	48 89 d6             	mov    %rdx,%rsi
+  803c79:	89 c7                	mov    %eax,%edi
+  803c7b:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  803c82:	00 00 00 
+  803c85:	ff d0                	call   *%rax
+  803c87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c8e:	79 0a                	jns    803c9a <write+0x62>
+    return r;
+  803c90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c93:	48 98                	cltq
+  803c95:	e9 9d 00 00 00       	jmp    803d37 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c9e:	8b 40 08             	mov    0x8(%rax),%eax
+  803ca1:	83 e0 03             	and    $0x3,%eax
+  803ca4:	85 c0                	test   %eax,%eax
+  803ca6:	75 5c                	jne    803d04 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803ca8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803caf:	00 00 00 
+  803cb2:	8b 40 04             	mov    0x4(%rax),%eax
+  803cb5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803cba:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803cc1:	00 00 00 
+  803cc4:	48 98                	cltq
+  803cc6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ccd:	48 01 d0             	add    %rdx,%rax
+  803cd0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803cd6:	8b 00                	mov    (%rax),%eax
+  803cd8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803cdb:	89 c6                	mov    %eax,%esi
+  803cdd:	48 b8 23 70 80 00 00 	movabs $0x807023,%rax
+  803ce4:	00 00 00 
+  803ce7:	48 89 c7             	mov    %rax,%rdi
+  803cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cef:	48 b9 eb 07 80 00 00 	movabs $0x8007eb,%rcx
+  803cf6:	00 00 00 
+  803cf9:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803cfb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803d02:	eb 33                	jmp    803d37 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803d04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d08:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803d0c:	48 85 c0             	test   %rax,%rax
+  803d0f:	75 09                	jne    803d1a <write+0xe2>
+    return -E_NOT_SUPP;
+  803d11:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803d18:	eb 1d                	jmp    803d37 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803d1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d1e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d26:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d2a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803d2e:	48 89 ce             	mov    %rcx,%rsi
+  803d31:	48 89 c7             	mov    %rax,%rdi
+  803d34:	41 ff d0             	call   *%r8
+}
+  803d37:	c9                   	leave
+  803d38:	c3                   	ret
+
+0000000000803d39 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803d39:	55                   	push   %rbp
+  803d3a:	48 89 e5             	mov    %rsp,%rbp
+  803d3d:	48 83 ec 18          	sub    $0x18,%rsp
+  803d41:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803d44:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d47:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d4e:	48 89 d6             	mov    %rdx,%rsi
+  803d51:	89 c7                	mov    %eax,%edi
+  803d53:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803d5a:	00 00 00 
+  803d5d:	ff d0                	call   *%rax
+  803d5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d66:	79 05                	jns    803d6d <seek+0x34>
+    return r;
+  803d68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d6b:	eb 0f                	jmp    803d7c <seek+0x43>
+  fd->fd_offset = offset;
+  803d6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d71:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803d74:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803d77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d7c:	c9                   	leave
+  803d7d:	c3                   	ret
+
+0000000000803d7e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803d7e:	55                   	push   %rbp
+  803d7f:	48 89 e5             	mov    %rsp,%rbp
+  803d82:	48 83 ec 30          	sub    $0x30,%rsp
+  803d86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d89:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d8c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d93:	48 89 d6             	mov    %rdx,%rsi
+  803d96:	89 c7                	mov    %eax,%edi
+  803d98:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803d9f:	00 00 00 
+  803da2:	ff d0                	call   *%rax
+  803da4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803da7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dab:	78 24                	js     803dd1 <ftruncate+0x53>
+  803dad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db1:	8b 00                	mov    (%rax),%eax
+  803db3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803db7:	48 89 d6             	mov    %rdx,%rsi
+  803dba:	89 c7                	mov    %eax,%edi
+  803dbc:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  803dc3:	00 00 00 
+  803dc6:	ff d0                	call   *%rax
+  803dc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dcb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dcf:	79 08                	jns    803dd9 <ftruncate+0x5b>
+    return r;
+  803dd1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dd4:	e9 92 00 00 00       	jmp    803e6b <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ddd:	8b 40 08             	mov    0x8(%rax),%eax
+  803de0:	83 e0 03             	and    $0x3,%eax
+  803de3:	85 c0                	test   %eax,%eax
+  803de5:	75 5a                	jne    803e41 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803de7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803dee:	00 00 00 
+  803df1:	8b 40 04             	mov    0x4(%rax),%eax
+  803df4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803df9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e00:	00 00 00 
+  803e03:	48 98                	cltq
+  803e05:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803e0c:	48 01 d0             	add    %rdx,%rax
+  803e0f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803e15:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803e17:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803e1a:	89 c6                	mov    %eax,%esi
+  803e1c:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803e23:	00 00 00 
+  803e26:	48 89 c7             	mov    %rax,%rdi
+  803e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2e:	48 b9 eb 07 80 00 00 	movabs $0x8007eb,%rcx
+  803e35:	00 00 00 
+  803e38:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803e3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e3f:	eb 2a                	jmp    803e6b <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803e41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e45:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803e49:	48 85 c0             	test   %rax,%rax
+  803e4c:	75 07                	jne    803e55 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803e4e:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803e53:	eb 16                	jmp    803e6b <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803e55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e59:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803e5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e61:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803e64:	89 d6                	mov    %edx,%esi
+  803e66:	48 89 c7             	mov    %rax,%rdi
+  803e69:	ff d1                	call   *%rcx
+}
+  803e6b:	c9                   	leave
+  803e6c:	c3                   	ret
+
+0000000000803e6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803e6d:	55                   	push   %rbp
+  803e6e:	48 89 e5             	mov    %rsp,%rbp
+  803e71:	48 83 ec 30          	sub    $0x30,%rsp
+  803e75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e78:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e7c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803e80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e83:	48 89 d6             	mov    %rdx,%rsi
+  803e86:	89 c7                	mov    %eax,%edi
+  803e88:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  803e8f:	00 00 00 
+  803e92:	ff d0                	call   *%rax
+  803e94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e9b:	78 24                	js     803ec1 <fstat+0x54>
+  803e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ea1:	8b 00                	mov    (%rax),%eax
+  803ea3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ea7:	48 89 d6             	mov    %rdx,%rsi
+  803eaa:	89 c7                	mov    %eax,%edi
+  803eac:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ebb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ebf:	79 05                	jns    803ec6 <fstat+0x59>
+    return r;
+  803ec1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ec4:	eb 5e                	jmp    803f24 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803ec6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803eca:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803ece:	48 85 c0             	test   %rax,%rax
+  803ed1:	75 07                	jne    803eda <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803ed3:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803ed8:	eb 4a                	jmp    803f24 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803eda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ede:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803ee1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ee5:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803eec:	00 00 00 
+  stat->st_isdir   = 0;
+  803eef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ef3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803efa:	00 00 00 
+  stat->st_dev     = dev;
+  803efd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f05:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803f0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f10:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803f14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f18:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f1c:	48 89 d6             	mov    %rdx,%rsi
+  803f1f:	48 89 c7             	mov    %rax,%rdi
+  803f22:	ff d1                	call   *%rcx
+}
+  803f24:	c9                   	leave
+  803f25:	c3                   	ret
+
+0000000000803f26 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803f26:	55                   	push   %rbp
+  803f27:	48 89 e5             	mov    %rsp,%rbp
+  803f2a:	48 83 ec 10          	sub    $0x10,%rsp
+  803f2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803f32:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803f36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f3a:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803f40:	83 f8 20             	cmp    $0x20,%eax
+  803f43:	75 07                	jne    803f4c <pollwait_key+0x26>
+    return -E_INVAL;
+  803f45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f4a:	eb 5f                	jmp    803fab <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803f4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f50:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803f56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f5a:	48 63 d2             	movslq %edx,%rdx
+  803f5d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803f61:	48 01 c2             	add    %rax,%rdx
+  803f64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f68:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803f6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f6f:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803f75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f79:	8b 00                	mov    (%rax),%eax
+  803f7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f7f:	48 63 c9             	movslq %ecx,%rcx
+  803f82:	48 c1 e1 04          	shl    $0x4,%rcx
+  803f86:	48 01 ca             	add    %rcx,%rdx
+  803f89:	48 83 c2 08          	add    $0x8,%rdx
+  803f8d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803f8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f93:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803f99:	8d 50 01             	lea    0x1(%rax),%edx
+  803f9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fa0:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fab:	c9                   	leave
+  803fac:	c3                   	ret
+
+0000000000803fad <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803fad:	55                   	push   %rbp
+  803fae:	48 89 e5             	mov    %rsp,%rbp
+  803fb1:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803fb8:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803fbf:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803fc5:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803fcc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803fd3:	00 
+  int i, r, ready, ipc = 0;
+  803fd4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803fdb:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803fe2:	00 
+  803fe3:	74 45                	je     80402a <poll+0x7d>
+  803fe5:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803fec:	ff 
+  803fed:	74 3b                	je     80402a <poll+0x7d>
+    now      = vsys_clock_ns();
+  803fef:	48 b8 27 59 80 00 00 	movabs $0x805927,%rax
+  803ff6:	00 00 00 
+  803ff9:	ff d0                	call   *%rax
+  803ffb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803fff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804003:	48 f7 d0             	not    %rax
+  804006:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80400d:	73 10                	jae    80401f <poll+0x72>
+  80400f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804013:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80401a:	48 01 d0             	add    %rdx,%rax
+  80401d:	eb 07                	jmp    804026 <poll+0x79>
+  80401f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804026:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80402a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804031:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  804038:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80403f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  804046:	e9 46 02 00 00       	jmp    804291 <poll+0x2e4>
+      fds[i].revents = 0;
+  80404b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80404e:	48 63 d0             	movslq %eax,%rdx
+  804051:	48 89 d0             	mov    %rdx,%rax
+  804054:	48 01 c0             	add    %rax,%rax
+  804057:	48 01 d0             	add    %rdx,%rax
+  80405a:	48 c1 e0 02          	shl    $0x2,%rax
+  80405e:	48 89 c2             	mov    %rax,%rdx
+  804061:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804068:	48 01 d0             	add    %rdx,%rax
+  80406b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804072:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804075:	48 63 d0             	movslq %eax,%rdx
+  804078:	48 89 d0             	mov    %rdx,%rax
+  80407b:	48 01 c0             	add    %rax,%rax
+  80407e:	48 01 d0             	add    %rdx,%rax
+  804081:	48 c1 e0 02          	shl    $0x2,%rax
+  804085:	48 89 c2             	mov    %rax,%rdx
+  804088:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80408f:	48 01 d0             	add    %rdx,%rax
+  804092:	8b 00                	mov    (%rax),%eax
+  804094:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  804097:	75 62                	jne    8040fb <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  804099:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80409c:	48 63 d0             	movslq %eax,%rdx
+  80409f:	48 89 d0             	mov    %rdx,%rax
+  8040a2:	48 01 c0             	add    %rax,%rax
+  8040a5:	48 01 d0             	add    %rdx,%rax
+  8040a8:	48 c1 e0 02          	shl    $0x2,%rax
+  8040ac:	48 89 c2             	mov    %rax,%rdx
+  8040af:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040b6:	48 01 d0             	add    %rdx,%rax
+  8040b9:	8b 40 04             	mov    0x4(%rax),%eax
+  8040bc:	83 e0 01             	and    $0x1,%eax
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	0f 84 9b 01 00 00    	je     804262 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8040c7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040ca:	48 63 d0             	movslq %eax,%rdx
+  8040cd:	48 89 d0             	mov    %rdx,%rax
+  8040d0:	48 01 c0             	add    %rax,%rax
+  8040d3:	48 01 d0             	add    %rdx,%rax
+  8040d6:	48 c1 e0 02          	shl    $0x2,%rax
+  8040da:	48 89 c2             	mov    %rax,%rdx
+  8040dd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040e4:	48 01 c2             	add    %rax,%rdx
+  8040e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ea:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8040ed:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8040f0:	83 c8 04             	or     $0x4,%eax
+  8040f3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8040f6:	e9 67 01 00 00       	jmp    804262 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8040fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040fe:	48 63 d0             	movslq %eax,%rdx
+  804101:	48 89 d0             	mov    %rdx,%rax
+  804104:	48 01 c0             	add    %rax,%rax
+  804107:	48 01 d0             	add    %rdx,%rax
+  80410a:	48 c1 e0 02          	shl    $0x2,%rax
+  80410e:	48 89 c2             	mov    %rax,%rdx
+  804111:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804118:	48 01 d0             	add    %rdx,%rax
+  80411b:	8b 00                	mov    (%rax),%eax
+  80411d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804124:	48 89 d6             	mov    %rdx,%rsi
+  804127:	89 c7                	mov    %eax,%edi
+  804129:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  804130:	00 00 00 
+  804133:	ff d0                	call   *%rax
+  804135:	85 c0                	test   %eax,%eax
+  804137:	78 25                	js     80415e <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  804139:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804140:	8b 00                	mov    (%rax),%eax
+  804142:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804149:	48 89 d6             	mov    %rdx,%rsi
+  80414c:	89 c7                	mov    %eax,%edi
+  80414e:	48 b8 01 37 80 00 00 	movabs $0x803701,%rax
+  804155:	00 00 00 
+  804158:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80415a:	85 c0                	test   %eax,%eax
+  80415c:	79 2c                	jns    80418a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80415e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804161:	48 63 d0             	movslq %eax,%rdx
+  804164:	48 89 d0             	mov    %rdx,%rax
+  804167:	48 01 c0             	add    %rax,%rax
+  80416a:	48 01 d0             	add    %rdx,%rax
+  80416d:	48 c1 e0 02          	shl    $0x2,%rax
+  804171:	48 89 c2             	mov    %rax,%rdx
+  804174:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80417b:	48 01 d0             	add    %rdx,%rax
+  80417e:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804185:	e9 d8 00 00 00       	jmp    804262 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80418a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804191:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804195:	48 85 c0             	test   %rax,%rax
+  804198:	74 7d                	je     804217 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80419a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8041a1:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8041a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041a8:	48 63 d0             	movslq %eax,%rdx
+  8041ab:	48 89 d0             	mov    %rdx,%rax
+  8041ae:	48 01 c0             	add    %rax,%rax
+  8041b1:	48 01 d0             	add    %rdx,%rax
+  8041b4:	48 c1 e0 02          	shl    $0x2,%rax
+  8041b8:	48 89 c2             	mov    %rax,%rdx
+  8041bb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041c2:	48 01 d0             	add    %rdx,%rax
+  8041c5:	8b 48 04             	mov    0x4(%rax),%ecx
+  8041c8:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8041cf:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8041d6:	89 ce                	mov    %ecx,%esi
+  8041d8:	48 89 c7             	mov    %rax,%rdi
+  8041db:	41 ff d0             	call   *%r8
+  8041de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8041e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8041e5:	79 08                	jns    8041ef <poll+0x242>
+          return r;
+  8041e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041ea:	e9 45 01 00 00       	jmp    804334 <poll+0x387>
+        fds[i].revents = r;
+  8041ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041f2:	48 63 d0             	movslq %eax,%rdx
+  8041f5:	48 89 d0             	mov    %rdx,%rax
+  8041f8:	48 01 c0             	add    %rax,%rax
+  8041fb:	48 01 d0             	add    %rdx,%rax
+  8041fe:	48 c1 e0 02          	shl    $0x2,%rax
+  804202:	48 89 c2             	mov    %rax,%rdx
+  804205:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80420c:	48 01 c2             	add    %rax,%rdx
+  80420f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804212:	89 42 08             	mov    %eax,0x8(%rdx)
+  804215:	eb 4b                	jmp    804262 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804217:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80421a:	48 63 d0             	movslq %eax,%rdx
+  80421d:	48 89 d0             	mov    %rdx,%rax
+  804220:	48 01 c0             	add    %rax,%rax
+  804223:	48 01 d0             	add    %rdx,%rax
+  804226:	48 c1 e0 02          	shl    $0x2,%rax
+  80422a:	48 89 c2             	mov    %rax,%rdx
+  80422d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804234:	48 01 d0             	add    %rdx,%rax
+  804237:	8b 48 04             	mov    0x4(%rax),%ecx
+  80423a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80423d:	48 63 d0             	movslq %eax,%rdx
+  804240:	48 89 d0             	mov    %rdx,%rax
+  804243:	48 01 c0             	add    %rax,%rax
+  804246:	48 01 d0             	add    %rdx,%rax
+  804249:	48 c1 e0 02          	shl    $0x2,%rax
+  80424d:	48 89 c2             	mov    %rax,%rdx
+  804250:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804257:	48 01 d0             	add    %rdx,%rax
+  80425a:	83 e1 03             	and    $0x3,%ecx
+  80425d:	89 ca                	mov    %ecx,%edx
+  80425f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804262:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804265:	48 63 d0             	movslq %eax,%rdx
+  804268:	48 89 d0             	mov    %rdx,%rax
+  80426b:	48 01 c0             	add    %rax,%rax
+  80426e:	48 01 d0             	add    %rdx,%rax
+  804271:	48 c1 e0 02          	shl    $0x2,%rax
+  804275:	48 89 c2             	mov    %rax,%rdx
+  804278:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80427f:	48 01 d0             	add    %rdx,%rax
+  804282:	8b 40 08             	mov    0x8(%rax),%eax
+  804285:	85 c0                	test   %eax,%eax
+  804287:	74 04                	je     80428d <poll+0x2e0>
+        ready++;
+  804289:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80428d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804291:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804294:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80429a:	0f 8c ab fd ff ff    	jl     80404b <poll+0x9e>
+    }
+    if (ready)
+  8042a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8042a4:	74 08                	je     8042ae <poll+0x301>
+      return ready;
+  8042a6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8042a9:	e9 86 00 00 00       	jmp    804334 <poll+0x387>
+
+    if (deadline) {
+  8042ae:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8042b3:	74 30                	je     8042e5 <poll+0x338>
+      now     = vsys_clock_ns();
+  8042b5:	48 b8 27 59 80 00 00 	movabs $0x805927,%rax
+  8042bc:	00 00 00 
+  8042bf:	ff d0                	call   *%rax
+  8042c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8042c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042c9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8042cd:	73 0a                	jae    8042d9 <poll+0x32c>
+  8042cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d3:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8042d7:	eb 05                	jmp    8042de <poll+0x331>
+  8042d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042de:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8042e5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8042e8:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8042eb:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8042f2:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8042f9:	48 89 c7             	mov    %rax,%rdi
+  8042fc:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+  804308:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80430b:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80430f:	75 07                	jne    804318 <poll+0x36b>
+      return 0;
+  804311:	b8 00 00 00 00       	mov    $0x0,%eax
+  804316:	eb 1c                	jmp    804334 <poll+0x387>
+    if (r < 0)
+  804318:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80431c:	79 05                	jns    804323 <poll+0x376>
+      return r;
+  80431e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804321:	eb 11                	jmp    804334 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804323:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804326:	c1 f8 02             	sar    $0x2,%eax
+  804329:	83 e0 01             	and    $0x1,%eax
+  80432c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80432f:	e9 f6 fc ff ff       	jmp    80402a <poll+0x7d>
+  }
+}
+  804334:	c9                   	leave
+  804335:	c3                   	ret
+
+0000000000804336 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	48 83 ec 20          	sub    $0x20,%rsp
+  80433e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804342:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804346:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80434a:	be 00 00 00 00       	mov    $0x0,%esi
+  80434f:	48 89 c7             	mov    %rax,%rdi
+  804352:	48 b8 24 44 80 00 00 	movabs $0x804424,%rax
+  804359:	00 00 00 
+  80435c:	ff d0                	call   *%rax
+  80435e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804361:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804365:	79 05                	jns    80436c <stat+0x36>
+    return fd;
+  804367:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80436a:	eb 2f                	jmp    80439b <stat+0x65>
+  r = fstat(fd, stat);
+  80436c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804370:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804373:	48 89 d6             	mov    %rdx,%rsi
+  804376:	89 c7                	mov    %eax,%edi
+  804378:	48 b8 6d 3e 80 00 00 	movabs $0x803e6d,%rax
+  80437f:	00 00 00 
+  804382:	ff d0                	call   *%rax
+  804384:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804387:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80438a:	89 c7                	mov    %eax,%edi
+  80438c:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  804393:	00 00 00 
+  804396:	ff d0                	call   *%rax
+  return r;
+  804398:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80439b:	c9                   	leave
+  80439c:	c3                   	ret
+
+000000000080439d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80439d:	55                   	push   %rbp
+  80439e:	48 89 e5             	mov    %rsp,%rbp
+  8043a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8043a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8043a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8043ac:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8043b3:	00 00 00 
+  8043b6:	8b 00                	mov    (%rax),%eax
+  8043b8:	85 c0                	test   %eax,%eax
+  8043ba:	75 1d                	jne    8043d9 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8043bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8043c1:	48 b8 a8 60 80 00 00 	movabs $0x8060a8,%rax
+  8043c8:	00 00 00 
+  8043cb:	ff d0                	call   *%rax
+  8043cd:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  8043d4:	00 00 00 
+  8043d7:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8043d9:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8043e0:	00 00 00 
+  8043e3:	8b 00                	mov    (%rax),%eax
+  8043e5:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8043e8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8043ed:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8043f4:	00 00 00 
+  8043f7:	89 c7                	mov    %eax,%edi
+  8043f9:	48 b8 fb 5f 80 00 00 	movabs $0x805ffb,%rax
+  804400:	00 00 00 
+  804403:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804405:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440e:	48 89 c6             	mov    %rax,%rsi
+  804411:	bf 00 00 00 00       	mov    $0x0,%edi
+  804416:	48 b8 7e 5e 80 00 00 	movabs $0x805e7e,%rax
+  80441d:	00 00 00 
+  804420:	ff d0                	call   *%rax
+}
+  804422:	c9                   	leave
+  804423:	c3                   	ret
+
+0000000000804424 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804424:	55                   	push   %rbp
+  804425:	48 89 e5             	mov    %rsp,%rbp
+  804428:	48 83 ec 20          	sub    $0x20,%rsp
+  80442c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804430:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804433:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804437:	48 89 c7             	mov    %rax,%rdi
+  80443a:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  804441:	00 00 00 
+  804444:	ff d0                	call   *%rax
+  804446:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80444b:	7e 0a                	jle    804457 <open+0x33>
+    return -E_BAD_PATH;
+  80444d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804452:	e9 a8 00 00 00       	jmp    8044ff <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804457:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80445b:	48 89 c7             	mov    %rax,%rdi
+  80445e:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  804465:	00 00 00 
+  804468:	ff d0                	call   *%rax
+  80446a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80446d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804471:	79 08                	jns    80447b <open+0x57>
+    return r;
+  804473:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804476:	e9 84 00 00 00       	jmp    8044ff <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80447b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80447f:	48 89 c6             	mov    %rax,%rsi
+  804482:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804489:	00 00 00 
+  80448c:	48 89 c7             	mov    %rax,%rdi
+  80448f:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  804496:	00 00 00 
+  804499:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80449b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044a2:	00 00 00 
+  8044a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8044a8:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8044ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044b2:	48 89 c6             	mov    %rax,%rsi
+  8044b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044ba:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  8044c1:	00 00 00 
+  8044c4:	ff d0                	call   *%rax
+  8044c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044cd:	79 1d                	jns    8044ec <open+0xc8>
+    fd_close(fd, 0);
+  8044cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8044d8:	48 89 c7             	mov    %rax,%rdi
+  8044db:	48 b8 36 36 80 00 00 	movabs $0x803636,%rax
+  8044e2:	00 00 00 
+  8044e5:	ff d0                	call   *%rax
+    return r;
+  8044e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044ea:	eb 13                	jmp    8044ff <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8044ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f0:	48 89 c7             	mov    %rax,%rdi
+  8044f3:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  8044fa:	00 00 00 
+  8044fd:	ff d0                	call   *%rax
+}
+  8044ff:	c9                   	leave
+  804500:	c3                   	ret
+
+0000000000804501 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804501:	55                   	push   %rbp
+  804502:	48 89 e5             	mov    %rsp,%rbp
+  804505:	48 83 ec 10          	sub    $0x10,%rsp
+  804509:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80450d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804511:	8b 40 0c             	mov    0xc(%rax),%eax
+  804514:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80451b:	00 00 00 
+  80451e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804520:	be 00 00 00 00       	mov    $0x0,%esi
+  804525:	bf 06 00 00 00       	mov    $0x6,%edi
+  80452a:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804531:	00 00 00 
+  804534:	ff d0                	call   *%rax
+}
+  804536:	c9                   	leave
+  804537:	c3                   	ret
+
+0000000000804538 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804538:	55                   	push   %rbp
+  804539:	48 89 e5             	mov    %rsp,%rbp
+  80453c:	48 83 ec 30          	sub    $0x30,%rsp
+  804540:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804544:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804548:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80454c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804551:	74 07                	je     80455a <devfile_read+0x22>
+  804553:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804558:	75 0a                	jne    804564 <devfile_read+0x2c>
+  return E_INVAL;
+  80455a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80455f:	e9 b4 00 00 00       	jmp    804618 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804564:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80456b:	00 
+  while (n) {
+  80456c:	e9 98 00 00 00       	jmp    804609 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804571:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804575:	8b 40 0c             	mov    0xc(%rax),%eax
+  804578:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80457f:	00 00 00 
+  804582:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804584:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80458b:	00 00 00 
+  80458e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804592:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804596:	be 00 00 00 00       	mov    $0x0,%esi
+  80459b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8045a0:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  8045a7:	00 00 00 
+  8045aa:	ff d0                	call   *%rax
+  8045ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8045af:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8045b3:	7f 13                	jg     8045c8 <devfile_read+0x90>
+      return res ? res : res0;
+  8045b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8045b9:	74 07                	je     8045c2 <devfile_read+0x8a>
+  8045bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045be:	48 98                	cltq
+  8045c0:	eb 56                	jmp    804618 <devfile_read+0xe0>
+  8045c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c6:	eb 50                	jmp    804618 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8045c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045cb:	48 63 d0             	movslq %eax,%rdx
+  8045ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045d2:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8045d9:	00 00 00 
+  8045dc:	48 89 ce             	mov    %rcx,%rsi
+  8045df:	48 89 c7             	mov    %rax,%rdi
+  8045e2:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8045e9:	00 00 00 
+  8045ec:	ff d0                	call   *%rax
+
+    buf += res;
+  8045ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045f1:	48 98                	cltq
+  8045f3:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8045f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045fa:	48 98                	cltq
+  8045fc:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804600:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804603:	48 98                	cltq
+  804605:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804609:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80460e:	0f 85 5d ff ff ff    	jne    804571 <devfile_read+0x39>
+  }
+
+  return res0;
+  804614:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804618:	c9                   	leave
+  804619:	c3                   	ret
+
+000000000080461a <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80461a:	55                   	push   %rbp
+  80461b:	48 89 e5             	mov    %rsp,%rbp
+  80461e:	48 83 ec 50          	sub    $0x50,%rsp
+  804622:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804626:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80462a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80462e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804633:	74 07                	je     80463c <devfile_write+0x22>
+  804635:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80463a:	75 0a                	jne    804646 <devfile_write+0x2c>
+  return E_INVAL;
+  80463c:	b8 03 00 00 00       	mov    $0x3,%eax
+  804641:	e9 c9 00 00 00       	jmp    80470f <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804646:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80464d:	00 
+
+  while (n) {
+  80464e:	e9 ad 00 00 00       	jmp    804700 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804653:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804657:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80465b:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804662:	00 
+  804663:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804667:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80466b:	48 39 c2             	cmp    %rax,%rdx
+  80466e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804672:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804676:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80467a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80467e:	48 89 c6             	mov    %rax,%rsi
+  804681:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804688:	00 00 00 
+  80468b:	48 89 c7             	mov    %rax,%rdi
+  80468e:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  804695:	00 00 00 
+  804698:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80469a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80469e:	8b 40 0c             	mov    0xc(%rax),%eax
+  8046a1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8046a8:	00 00 00 
+  8046ab:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8046ad:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8046b4:	00 00 00 
+  8046b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046bb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8046bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8046c4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8046c9:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+  8046d5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8046d8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8046dc:	79 07                	jns    8046e5 <devfile_write+0xcb>
+      return res;
+  8046de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046e1:	48 98                	cltq
+  8046e3:	eb 2a                	jmp    80470f <devfile_write+0xf5>
+
+    buf += res;
+  8046e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046e8:	48 98                	cltq
+  8046ea:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8046ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046f1:	48 98                	cltq
+  8046f3:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8046f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046fa:	48 98                	cltq
+  8046fc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804700:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804705:	0f 85 48 ff ff ff    	jne    804653 <devfile_write+0x39>
+  }
+
+  return res0;
+  80470b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80470f:	c9                   	leave
+  804710:	c3                   	ret
+
+0000000000804711 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804711:	55                   	push   %rbp
+  804712:	48 89 e5             	mov    %rsp,%rbp
+  804715:	48 83 ec 20          	sub    $0x20,%rsp
+  804719:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80471d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804721:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804725:	8b 40 0c             	mov    0xc(%rax),%eax
+  804728:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80472f:	00 00 00 
+  804732:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804734:	be 00 00 00 00       	mov    $0x0,%esi
+  804739:	bf 05 00 00 00       	mov    $0x5,%edi
+  80473e:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804745:	00 00 00 
+  804748:	ff d0                	call   *%rax
+  80474a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80474d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804751:	79 05                	jns    804758 <devfile_stat+0x47>
+    return r;
+  804753:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804756:	eb 59                	jmp    8047b1 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804758:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80475c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804763:	00 00 00 
+  804766:	48 89 d6             	mov    %rdx,%rsi
+  804769:	48 89 c7             	mov    %rax,%rdi
+  80476c:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  804773:	00 00 00 
+  804776:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804778:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80477f:	00 00 00 
+  804782:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804788:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80478c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804792:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804799:	00 00 00 
+  80479c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8047a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047a6:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8047ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047b1:	c9                   	leave
+  8047b2:	c3                   	ret
+
+00000000008047b3 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8047b3:	55                   	push   %rbp
+  8047b4:	48 89 e5             	mov    %rsp,%rbp
+  8047b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8047bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8047bf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8047c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047c9:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047d0:	00 00 00 
+  8047d3:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8047d5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047dc:	00 00 00 
+  8047df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047e2:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8047e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8047ea:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047ef:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  8047f6:	00 00 00 
+  8047f9:	ff d0                	call   *%rax
+}
+  8047fb:	c9                   	leave
+  8047fc:	c3                   	ret
+
+00000000008047fd <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8047fd:	55                   	push   %rbp
+  8047fe:	48 89 e5             	mov    %rsp,%rbp
+  804801:	48 83 ec 18          	sub    $0x18,%rsp
+  804805:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804809:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80480c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804810:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804813:	83 e0 03             	and    $0x3,%eax
+}
+  804816:	c9                   	leave
+  804817:	c3                   	ret
+
+0000000000804818 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804818:	55                   	push   %rbp
+  804819:	48 89 e5             	mov    %rsp,%rbp
+  80481c:	48 83 ec 10          	sub    $0x10,%rsp
+  804820:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804828:	48 89 c7             	mov    %rax,%rdi
+  80482b:	48 b8 9a 16 80 00 00 	movabs $0x80169a,%rax
+  804832:	00 00 00 
+  804835:	ff d0                	call   *%rax
+  804837:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80483c:	7e 07                	jle    804845 <remove+0x2d>
+    return -E_BAD_PATH;
+  80483e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804843:	eb 36                	jmp    80487b <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804845:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804849:	48 89 c6             	mov    %rax,%rsi
+  80484c:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804853:	00 00 00 
+  804856:	48 89 c7             	mov    %rax,%rdi
+  804859:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  804860:	00 00 00 
+  804863:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804865:	be 00 00 00 00       	mov    $0x0,%esi
+  80486a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80486f:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804876:	00 00 00 
+  804879:	ff d0                	call   *%rax
+}
+  80487b:	c9                   	leave
+  80487c:	c3                   	ret
+
+000000000080487d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80487d:	55                   	push   %rbp
+  80487e:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804881:	be 00 00 00 00       	mov    $0x0,%esi
+  804886:	bf 08 00 00 00       	mov    $0x8,%edi
+  80488b:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804892:	00 00 00 
+  804895:	ff d0                	call   *%rax
+}
+  804897:	5d                   	pop    %rbp
+  804898:	c3                   	ret
+
+0000000000804899 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804899:	55                   	push   %rbp
+  80489a:	48 89 e5             	mov    %rsp,%rbp
+  80489d:	48 83 ec 20          	sub    $0x20,%rsp
+  8048a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8048a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8048aa:	bf 09 00 00 00       	mov    $0x9,%edi
+  8048af:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  8048b6:	00 00 00 
+  8048b9:	ff d0                	call   *%rax
+  8048bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048c2:	79 05                	jns    8048c9 <fs_stats+0x30>
+    return r;
+  8048c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048c7:	eb 2a                	jmp    8048f3 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8048c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048cd:	ba 68 00 00 00       	mov    $0x68,%edx
+  8048d2:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8048d9:	00 00 00 
+  8048dc:	48 89 ce             	mov    %rcx,%rsi
+  8048df:	48 89 c7             	mov    %rax,%rdi
+  8048e2:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  8048e9:	00 00 00 
+  8048ec:	ff d0                	call   *%rax
+  return 0;
+  8048ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048f3:	c9                   	leave
+  8048f4:	c3                   	ret
+
+00000000008048f5 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8048f5:	55                   	push   %rbp
+  8048f6:	48 89 e5             	mov    %rsp,%rbp
+  8048f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8048fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804900:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804907:	00 00 00 
+  80490a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80490d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80490f:	be 00 00 00 00       	mov    $0x0,%esi
+  804914:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804919:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804920:	00 00 00 
+  804923:	ff d0                	call   *%rax
+}
+  804925:	c9                   	leave
+  804926:	c3                   	ret
+
+0000000000804927 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804927:	55                   	push   %rbp
+  804928:	48 89 e5             	mov    %rsp,%rbp
+  80492b:	48 83 ec 10          	sub    $0x10,%rsp
+  80492f:	89 f8                	mov    %edi,%eax
+  804931:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804934:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804938:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80493f:	00 00 00 
+  804942:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804944:	be 00 00 00 00       	mov    $0x0,%esi
+  804949:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80494e:	48 b8 9d 43 80 00 00 	movabs $0x80439d,%rax
+  804955:	00 00 00 
+  804958:	ff d0                	call   *%rax
+}
+  80495a:	c9                   	leave
+  80495b:	c3                   	ret
+
+000000000080495c <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80495c:	55                   	push   %rbp
+  80495d:	48 89 e5             	mov    %rsp,%rbp
+  804960:	48 83 ec 10          	sub    $0x10,%rsp
+  804964:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804968:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80496c:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804971:	48 89 c7             	mov    %rax,%rdi
+  804974:	48 b8 82 49 80 00 00 	movabs $0x804982,%rax
+  80497b:	00 00 00 
+  80497e:	ff d0                	call   *%rax
+}
+  804980:	c9                   	leave
+  804981:	c3                   	ret
+
+0000000000804982 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804982:	55                   	push   %rbp
+  804983:	48 89 e5             	mov    %rsp,%rbp
+  804986:	48 83 ec 50          	sub    $0x50,%rsp
+  80498a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80498e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804992:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804999:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80499a:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80499f:	74 0a                	je     8049ab <pipe_size+0x29>
+  8049a1:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8049a8:	00 
+  8049a9:	76 0a                	jbe    8049b5 <pipe_size+0x33>
+    return -E_INVAL;
+  8049ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8049b0:	e9 cc 02 00 00       	jmp    804c81 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8049b5:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8049b9:	48 89 c7             	mov    %rax,%rdi
+  8049bc:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  8049c3:	00 00 00 
+  8049c6:	ff d0                	call   *%rax
+  8049c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049cf:	0f 88 a8 02 00 00    	js     804c7d <pipe_size+0x2fb>
+  8049d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049d9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8049de:	48 89 c6             	mov    %rax,%rsi
+  8049e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e6:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8049ed:	00 00 00 
+  8049f0:	ff d0                	call   *%rax
+  8049f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049f9:	0f 88 7e 02 00 00    	js     804c7d <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8049ff:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804a03:	48 89 c7             	mov    %rax,%rdi
+  804a06:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  804a0d:	00 00 00 
+  804a10:	ff d0                	call   *%rax
+  804a12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a15:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a19:	0f 88 43 02 00 00    	js     804c62 <pipe_size+0x2e0>
+  804a1f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a23:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a28:	48 89 c6             	mov    %rax,%rsi
+  804a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a30:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  804a37:	00 00 00 
+  804a3a:	ff d0                	call   *%rax
+  804a3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a43:	0f 88 19 02 00 00    	js     804c62 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804a49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4d:	48 89 c7             	mov    %rax,%rdi
+  804a50:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  804a57:	00 00 00 
+  804a5a:	ff d0                	call   *%rax
+  804a5c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804a60:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804a67:	00 
+  804a68:	e9 a2 00 00 00       	jmp    804b0f <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804a6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a71:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a75:	48 89 c2             	mov    %rax,%rdx
+  804a78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a7c:	48 01 d0             	add    %rdx,%rax
+  804a7f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a84:	48 89 c6             	mov    %rax,%rsi
+  804a87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a8c:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  804a93:	00 00 00 
+  804a96:	ff d0                	call   *%rax
+  804a98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a9f:	0f 88 37 01 00 00    	js     804bdc <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804aa5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aa9:	48 89 c7             	mov    %rax,%rdi
+  804aac:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  804ab3:	00 00 00 
+  804ab6:	ff d0                	call   *%rax
+  804ab8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804abc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804ac0:	48 01 c2             	add    %rax,%rdx
+  804ac3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ac7:	48 c1 e0 0c          	shl    $0xc,%rax
+  804acb:	48 89 c1             	mov    %rax,%rcx
+  804ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad2:	48 01 c8             	add    %rcx,%rax
+  804ad5:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804adb:	48 89 d1             	mov    %rdx,%rcx
+  804ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ae3:	48 89 c6             	mov    %rax,%rsi
+  804ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aeb:	48 b8 c1 25 80 00 00 	movabs $0x8025c1,%rax
+  804af2:	00 00 00 
+  804af5:	ff d0                	call   *%rax
+  804af7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804afa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804afe:	79 0a                	jns    804b0a <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804b00:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804b05:	e9 d3 00 00 00       	jmp    804bdd <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804b0a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804b0f:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804b16:	00 
+  804b17:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804b1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b1f:	48 01 d0             	add    %rdx,%rax
+  804b22:	48 83 c0 1f          	add    $0x1f,%rax
+  804b26:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b33:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804b37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b3b:	48 29 d0             	sub    %rdx,%rax
+  804b3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b42:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804b46:	0f 82 21 ff ff ff    	jb     804a6d <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804b54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b58:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804b5c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804b60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b64:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804b6b:	00 00 00 
+  804b6e:	8b 12                	mov    (%rdx),%edx
+  804b70:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804b72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b76:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804b7d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b81:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804b88:	00 00 00 
+  804b8b:	8b 12                	mov    (%rdx),%edx
+  804b8d:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804b8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804b9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b9e:	48 89 c7             	mov    %rax,%rdi
+  804ba1:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  804ba8:	00 00 00 
+  804bab:	ff d0                	call   *%rax
+  804bad:	89 c2                	mov    %eax,%edx
+  804baf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804bb3:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804bb5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804bb9:	48 89 c7             	mov    %rax,%rdi
+  804bbc:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804bcc:	48 83 c2 04          	add    $0x4,%rdx
+  804bd0:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd7:	e9 a5 00 00 00       	jmp    804c81 <pipe_size+0x2ff>
+      goto err2;
+  804bdc:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804bdd:	eb 58                	jmp    804c37 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804bdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804be3:	48 c1 e0 0c          	shl    $0xc,%rax
+  804be7:	48 89 c2             	mov    %rax,%rdx
+  804bea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bee:	48 01 d0             	add    %rdx,%rax
+  804bf1:	48 89 c6             	mov    %rax,%rsi
+  804bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bf9:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  804c00:	00 00 00 
+  804c03:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804c05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c09:	48 89 c7             	mov    %rax,%rdi
+  804c0c:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  804c13:	00 00 00 
+  804c16:	ff d0                	call   *%rax
+  804c18:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c1c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804c20:	48 01 d0             	add    %rdx,%rax
+  804c23:	48 89 c6             	mov    %rax,%rsi
+  804c26:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c2b:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  804c32:	00 00 00 
+  804c35:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804c37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c3b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804c3f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804c43:	48 85 c0             	test   %rax,%rax
+  804c46:	75 97                	jne    804bdf <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804c48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c4c:	48 89 c6             	mov    %rax,%rsi
+  804c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c54:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  804c5b:	00 00 00 
+  804c5e:	ff d0                	call   *%rax
+  804c60:	eb 01                	jmp    804c63 <pipe_size+0x2e1>
+    goto err1;
+  804c62:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804c63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c67:	48 89 c6             	mov    %rax,%rsi
+  804c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c6f:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  804c76:	00 00 00 
+  804c79:	ff d0                	call   *%rax
+  804c7b:	eb 01                	jmp    804c7e <pipe_size+0x2fc>
+    goto err;
+  804c7d:	90                   	nop
+err:
+  return r;
+  804c7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804c81:	c9                   	leave
+  804c82:	c3                   	ret
+
+0000000000804c83 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804c83:	55                   	push   %rbp
+  804c84:	48 89 e5             	mov    %rsp,%rbp
+  804c87:	53                   	push   %rbx
+  804c88:	48 83 ec 28          	sub    $0x28,%rsp
+  804c8c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804c90:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804c94:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c9b:	00 00 00 
+  804c9e:	8b 40 04             	mov    0x4(%rax),%eax
+  804ca1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ca6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804cad:	00 00 00 
+  804cb0:	48 98                	cltq
+  804cb2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804cb9:	48 01 d0             	add    %rdx,%rax
+  804cbc:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804cc2:	8b 00                	mov    (%rax),%eax
+  804cc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804cc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ccb:	48 89 c7             	mov    %rax,%rdi
+  804cce:	48 b8 19 61 80 00 00 	movabs $0x806119,%rax
+  804cd5:	00 00 00 
+  804cd8:	ff d0                	call   *%rax
+  804cda:	89 c3                	mov    %eax,%ebx
+  804cdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ce0:	48 89 c7             	mov    %rax,%rdi
+  804ce3:	48 b8 19 61 80 00 00 	movabs $0x806119,%rax
+  804cea:	00 00 00 
+  804ced:	ff d0                	call   *%rax
+  804cef:	39 c3                	cmp    %eax,%ebx
+  804cf1:	0f 94 c0             	sete   %al
+  804cf4:	0f b6 c0             	movzbl %al,%eax
+  804cf7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804cfa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d01:	00 00 00 
+  804d04:	8b 40 04             	mov    0x4(%rax),%eax
+  804d07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d13:	00 00 00 
+  804d16:	48 98                	cltq
+  804d18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d1f:	48 01 d0             	add    %rdx,%rax
+  804d22:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804d28:	8b 00                	mov    (%rax),%eax
+  804d2a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804d2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d30:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804d33:	75 05                	jne    804d3a <_pipeisclosed+0xb7>
+      return ret;
+  804d35:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d38:	eb 68                	jmp    804da2 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804d3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d3d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804d40:	0f 84 4e ff ff ff    	je     804c94 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804d46:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d4d:	00 00 00 
+  804d50:	8b 40 04             	mov    0x4(%rax),%eax
+  804d53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d5f:	00 00 00 
+  804d62:	48 98                	cltq
+  804d64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d6b:	48 01 d0             	add    %rdx,%rax
+  804d6e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804d74:	8b 10                	mov    (%rax),%edx
+  804d76:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804d79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d7c:	89 c6                	mov    %eax,%esi
+  804d7e:	48 b8 70 70 80 00 00 	movabs $0x807070,%rax
+  804d85:	00 00 00 
+  804d88:	48 89 c7             	mov    %rax,%rdi
+  804d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d90:	49 b8 eb 07 80 00 00 	movabs $0x8007eb,%r8
+  804d97:	00 00 00 
+  804d9a:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804d9d:	e9 f2 fe ff ff       	jmp    804c94 <_pipeisclosed+0x11>
+  }
+}
+  804da2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804da6:	c9                   	leave
+  804da7:	c3                   	ret
+
+0000000000804da8 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804da8:	55                   	push   %rbp
+  804da9:	48 89 e5             	mov    %rsp,%rbp
+  804dac:	48 83 ec 30          	sub    $0x30,%rsp
+  804db0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804db3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804db7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dba:	48 89 d6             	mov    %rdx,%rsi
+  804dbd:	89 c7                	mov    %eax,%edi
+  804dbf:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  804dc6:	00 00 00 
+  804dc9:	ff d0                	call   *%rax
+  804dcb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dd2:	79 05                	jns    804dd9 <pipeisclosed+0x31>
+    return r;
+  804dd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dd7:	eb 31                	jmp    804e0a <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ddd:	48 89 c7             	mov    %rax,%rdi
+  804de0:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  804de7:	00 00 00 
+  804dea:	ff d0                	call   *%rax
+  804dec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804df0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804df8:	48 89 d6             	mov    %rdx,%rsi
+  804dfb:	48 89 c7             	mov    %rax,%rdi
+  804dfe:	48 b8 83 4c 80 00 00 	movabs $0x804c83,%rax
+  804e05:	00 00 00 
+  804e08:	ff d0                	call   *%rax
+}
+  804e0a:	c9                   	leave
+  804e0b:	c3                   	ret
+
+0000000000804e0c <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804e0c:	55                   	push   %rbp
+  804e0d:	48 89 e5             	mov    %rsp,%rbp
+  804e10:	48 83 ec 10          	sub    $0x10,%rsp
+  804e14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e1c:	8b 40 18             	mov    0x18(%rax),%eax
+  804e1f:	8d 50 01             	lea    0x1(%rax),%edx
+  804e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e26:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804e29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e2d:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804e30:	85 c0                	test   %eax,%eax
+  804e32:	74 27                	je     804e5b <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804e34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e38:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804e3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e43:	48 83 c0 18          	add    $0x18,%rax
+  804e47:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804e4c:	48 89 c7             	mov    %rax,%rdi
+  804e4f:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  804e56:	00 00 00 
+  804e59:	ff d0                	call   *%rax
+  }
+}
+  804e5b:	90                   	nop
+  804e5c:	c9                   	leave
+  804e5d:	c3                   	ret
+
+0000000000804e5e <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804e5e:	55                   	push   %rbp
+  804e5f:	48 89 e5             	mov    %rsp,%rbp
+  804e62:	48 83 ec 10          	sub    $0x10,%rsp
+  804e66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804e6a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804e6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e71:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e7c:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804e80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e83:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804e8a:	89 c6                	mov    %eax,%esi
+  804e8c:	48 89 cf             	mov    %rcx,%rdi
+  804e8f:	48 b8 15 29 80 00 00 	movabs $0x802915,%rax
+  804e96:	00 00 00 
+  804e99:	ff d0                	call   *%rax
+}
+  804e9b:	90                   	nop
+  804e9c:	c9                   	leave
+  804e9d:	c3                   	ret
+
+0000000000804e9e <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804e9e:	55                   	push   %rbp
+  804e9f:	48 89 e5             	mov    %rsp,%rbp
+  804ea2:	48 83 ec 70          	sub    $0x70,%rsp
+  804ea6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804eaa:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804eae:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804eb2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804eb6:	48 89 c7             	mov    %rax,%rdi
+  804eb9:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  804ec0:	00 00 00 
+  804ec3:	ff d0                	call   *%rax
+  804ec5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804ec9:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804ece:	75 0a                	jne    804eda <devpipe_read+0x3c>
+    return 0;
+  804ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ed5:	e9 63 01 00 00       	jmp    80503d <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804eda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ede:	8b 40 18             	mov    0x18(%rax),%eax
+  804ee1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ee8:	48 8b 10             	mov    (%rax),%rdx
+  804eeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ef3:	48 39 c2             	cmp    %rax,%rdx
+  804ef6:	75 42                	jne    804f3a <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804ef8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804efc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f00:	48 89 d6             	mov    %rdx,%rsi
+  804f03:	48 89 c7             	mov    %rax,%rdi
+  804f06:	48 b8 83 4c 80 00 00 	movabs $0x804c83,%rax
+  804f0d:	00 00 00 
+  804f10:	ff d0                	call   *%rax
+  804f12:	85 c0                	test   %eax,%eax
+  804f14:	74 0a                	je     804f20 <devpipe_read+0x82>
+      return 0;
+  804f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f1b:	e9 1d 01 00 00       	jmp    80503d <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804f20:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804f23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f27:	89 d6                	mov    %edx,%esi
+  804f29:	48 89 c7             	mov    %rax,%rdi
+  804f2c:	48 b8 5e 4e 80 00 00 	movabs $0x804e5e,%rax
+  804f33:	00 00 00 
+  804f36:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804f38:	eb a0                	jmp    804eda <devpipe_read+0x3c>
+      break;
+  804f3a:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804f3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804f43:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f4f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f57:	48 8b 00             	mov    (%rax),%rax
+  804f5a:	48 29 c2             	sub    %rax,%rdx
+  804f5d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804f61:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f69:	48 39 c2             	cmp    %rax,%rdx
+  804f6c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f70:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804f74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f78:	48 8b 00             	mov    (%rax),%rax
+  804f7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f7f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f88:	48 f7 f1             	div    %rcx
+  804f8b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804f8f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f9b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f9f:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804fa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804fa7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804fab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804faf:	48 39 c2             	cmp    %rax,%rdx
+  804fb2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fb6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804fba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fbe:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804fc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804fca:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804fce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd2:	48 89 ce             	mov    %rcx,%rsi
+  804fd5:	48 89 c7             	mov    %rax,%rdi
+  804fd8:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  804fdf:	00 00 00 
+  804fe2:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804fe4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804fe8:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804fec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ff0:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804ff4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804ff8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ffc:	48 01 d1             	add    %rdx,%rcx
+  804fff:	48 89 c2             	mov    %rax,%rdx
+  805002:	48 89 cf             	mov    %rcx,%rdi
+  805005:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  80500c:	00 00 00 
+  80500f:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  805011:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805015:	48 8b 10             	mov    (%rax),%rdx
+  805018:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80501c:	48 01 c2             	add    %rax,%rdx
+  80501f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805023:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  805026:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80502a:	48 89 c7             	mov    %rax,%rdi
+  80502d:	48 b8 0c 4e 80 00 00 	movabs $0x804e0c,%rax
+  805034:	00 00 00 
+  805037:	ff d0                	call   *%rax
+  return n;
+  805039:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80503d:	c9                   	leave
+  80503e:	c3                   	ret
+
+000000000080503f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80503f:	55                   	push   %rbp
+  805040:	48 89 e5             	mov    %rsp,%rbp
+  805043:	48 83 ec 70          	sub    $0x70,%rsp
+  805047:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80504b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80504f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805053:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805057:	48 89 c7             	mov    %rax,%rdi
+  80505a:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  805061:	00 00 00 
+  805064:	ff d0                	call   *%rax
+  805066:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80506a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80506e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805072:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805079:	00 
+  80507a:	e9 b8 01 00 00       	jmp    805237 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80507f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805083:	8b 40 18             	mov    0x18(%rax),%eax
+  805086:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80508d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805095:	48 8b 00             	mov    (%rax),%rax
+  805098:	48 29 c2             	sub    %rax,%rdx
+  80509b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80509f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050a3:	48 39 c2             	cmp    %rax,%rdx
+  8050a6:	75 4d                	jne    8050f5 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8050a8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8050ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8050b0:	48 89 d6             	mov    %rdx,%rsi
+  8050b3:	48 89 c7             	mov    %rax,%rdi
+  8050b6:	48 b8 83 4c 80 00 00 	movabs $0x804c83,%rax
+  8050bd:	00 00 00 
+  8050c0:	ff d0                	call   *%rax
+  8050c2:	85 c0                	test   %eax,%eax
+  8050c4:	74 0a                	je     8050d0 <devpipe_write+0x91>
+        return 0;
+  8050c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050cb:	e9 79 01 00 00       	jmp    805249 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8050d0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8050d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050d7:	89 d6                	mov    %edx,%esi
+  8050d9:	48 89 c7             	mov    %rax,%rdi
+  8050dc:	48 b8 5e 4e 80 00 00 	movabs $0x804e5e,%rax
+  8050e3:	00 00 00 
+  8050e6:	ff d0                	call   *%rax
+      m = 0;
+  8050e8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8050ef:	00 
+      continue;
+  8050f0:	e9 3a 01 00 00       	jmp    80522f <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8050f5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8050f9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8050fd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805101:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805105:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805109:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510d:	48 8b 08             	mov    (%rax),%rcx
+  805110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805114:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805118:	48 29 c1             	sub    %rax,%rcx
+  80511b:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80511f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805123:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80512b:	48 39 c2             	cmp    %rax,%rdx
+  80512e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805132:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  805136:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80513a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80513e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805142:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80514b:	48 f7 f1             	div    %rcx
+  80514e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805156:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80515a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80515e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805162:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805166:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80516a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80516e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805172:	48 39 c2             	cmp    %rax,%rdx
+  805175:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805179:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80517d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805181:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805185:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805189:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80518d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805191:	48 01 d1             	add    %rdx,%rcx
+  805194:	48 89 c2             	mov    %rax,%rdx
+  805197:	48 89 cf             	mov    %rcx,%rdi
+  80519a:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  8051a1:	00 00 00 
+  8051a4:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8051a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051aa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051ae:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8051b2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8051b6:	73 4d                	jae    805205 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8051b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051bc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8051c4:	48 29 c2             	sub    %rax,%rdx
+  8051c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051cb:	48 01 c2             	add    %rax,%rdx
+  8051ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051d6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8051da:	48 89 c1             	mov    %rax,%rcx
+  8051dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e1:	48 01 c1             	add    %rax,%rcx
+  8051e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e8:	48 01 c1             	add    %rax,%rcx
+  8051eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051ef:	48 83 c0 20          	add    $0x20,%rax
+  8051f3:	48 89 ce             	mov    %rcx,%rsi
+  8051f6:	48 89 c7             	mov    %rax,%rdi
+  8051f9:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  805200:	00 00 00 
+  805203:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805209:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80520d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805211:	48 01 c2             	add    %rax,%rdx
+  805214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805218:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80521c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805220:	48 89 c7             	mov    %rax,%rdi
+  805223:	48 b8 0c 4e 80 00 00 	movabs $0x804e0c,%rax
+  80522a:	00 00 00 
+  80522d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80522f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805233:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805237:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80523b:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80523f:	0f 82 3a fe ff ff    	jb     80507f <devpipe_write+0x40>
+  }
+
+  return i;
+  805245:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805249:	c9                   	leave
+  80524a:	c3                   	ret
+
+000000000080524b <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80524b:	55                   	push   %rbp
+  80524c:	48 89 e5             	mov    %rsp,%rbp
+  80524f:	48 83 ec 40          	sub    $0x40,%rsp
+  805253:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805257:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80525a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80525e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805262:	48 89 c7             	mov    %rax,%rdi
+  805265:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  80526c:	00 00 00 
+  80526f:	ff d0                	call   *%rax
+  805271:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805275:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80527c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805280:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805284:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805288:	48 89 d6             	mov    %rdx,%rsi
+  80528b:	48 89 c7             	mov    %rax,%rdi
+  80528e:	48 b8 26 3f 80 00 00 	movabs $0x803f26,%rax
+  805295:	00 00 00 
+  805298:	ff d0                	call   *%rax
+  80529a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80529d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a1:	79 08                	jns    8052ab <devpipe_poll+0x60>
+    return r;
+  8052a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a6:	e9 85 00 00 00       	jmp    805330 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8052ab:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8052ae:	83 e0 01             	and    $0x1,%eax
+  8052b1:	85 c0                	test   %eax,%eax
+  8052b3:	74 18                	je     8052cd <devpipe_poll+0x82>
+  8052b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b9:	48 8b 10             	mov    (%rax),%rdx
+  8052bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8052c4:	48 39 c2             	cmp    %rax,%rdx
+  8052c7:	74 04                	je     8052cd <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8052c9:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8052cd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8052d0:	83 e0 02             	and    $0x2,%eax
+  8052d3:	85 c0                	test   %eax,%eax
+  8052d5:	74 23                	je     8052fa <devpipe_poll+0xaf>
+  8052d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8052df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052e3:	48 8b 00             	mov    (%rax),%rax
+  8052e6:	48 29 c2             	sub    %rax,%rdx
+  8052e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052ed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052f1:	48 39 c2             	cmp    %rax,%rdx
+  8052f4:	73 04                	jae    8052fa <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8052f6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8052fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8052fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805302:	48 89 d6             	mov    %rdx,%rsi
+  805305:	48 89 c7             	mov    %rax,%rdi
+  805308:	48 b8 83 4c 80 00 00 	movabs $0x804c83,%rax
+  80530f:	00 00 00 
+  805312:	ff d0                	call   *%rax
+  805314:	85 c0                	test   %eax,%eax
+  805316:	74 04                	je     80531c <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805318:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80531c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805320:	75 0b                	jne    80532d <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805326:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80532d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805330:	c9                   	leave
+  805331:	c3                   	ret
+
+0000000000805332 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805332:	55                   	push   %rbp
+  805333:	48 89 e5             	mov    %rsp,%rbp
+  805336:	48 83 ec 20          	sub    $0x20,%rsp
+  80533a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80533e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805342:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805346:	48 89 c7             	mov    %rax,%rdi
+  805349:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  805350:	00 00 00 
+  805353:	ff d0                	call   *%rax
+  805355:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805359:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80535d:	48 ba a1 70 80 00 00 	movabs $0x8070a1,%rdx
+  805364:	00 00 00 
+  805367:	48 89 d6             	mov    %rdx,%rsi
+  80536a:	48 89 c7             	mov    %rax,%rdi
+  80536d:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  805374:	00 00 00 
+  805377:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805379:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80537d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805381:	89 c1                	mov    %eax,%ecx
+  805383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805387:	48 8b 00             	mov    (%rax),%rax
+  80538a:	89 c2                	mov    %eax,%edx
+  80538c:	89 c8                	mov    %ecx,%eax
+  80538e:	29 d0                	sub    %edx,%eax
+  805390:	89 c2                	mov    %eax,%edx
+  805392:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805396:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80539c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8053a7:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8053aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053ae:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  8053b5:	00 00 00 
+  8053b8:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8053bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053c4:	c9                   	leave
+  8053c5:	c3                   	ret
+
+00000000008053c6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8053c6:	55                   	push   %rbp
+  8053c7:	48 89 e5             	mov    %rsp,%rbp
+  8053ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8053ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8053d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053d6:	48 89 c7             	mov    %rax,%rdi
+  8053d9:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  8053e0:	00 00 00 
+  8053e3:	ff d0                	call   *%rax
+  8053e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8053e9:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8053f0:	00 
+  8053f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053f5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8053f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053fd:	48 01 d0             	add    %rdx,%rax
+  805400:	48 83 c0 1f          	add    $0x1f,%rax
+  805404:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805408:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80540c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805411:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805415:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805419:	48 29 d0             	sub    %rdx,%rax
+  80541c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805420:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805424:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805428:	48 89 c6             	mov    %rax,%rsi
+  80542b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805430:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  805437:	00 00 00 
+  80543a:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80543c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805440:	48 89 c7             	mov    %rax,%rdi
+  805443:	48 b8 0c 4e 80 00 00 	movabs $0x804e0c,%rax
+  80544a:	00 00 00 
+  80544d:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80544f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805453:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805457:	eb 2f                	jmp    805488 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80545d:	48 83 e8 01          	sub    $0x1,%rax
+  805461:	48 c1 e0 0c          	shl    $0xc,%rax
+  805465:	48 89 c2             	mov    %rax,%rdx
+  805468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80546c:	48 01 d0             	add    %rdx,%rax
+  80546f:	48 89 c6             	mov    %rax,%rsi
+  805472:	bf 00 00 00 00       	mov    $0x0,%edi
+  805477:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  80547e:	00 00 00 
+  805481:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805483:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805488:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80548d:	77 ca                	ja     805459 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80548f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805493:	48 89 c6             	mov    %rax,%rsi
+  805496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80549b:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  8054a2:	00 00 00 
+  8054a5:	ff d0                	call   *%rax
+}
+  8054a7:	c9                   	leave
+  8054a8:	c3                   	ret
+
+00000000008054a9 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8054a9:	55                   	push   %rbp
+  8054aa:	48 89 e5             	mov    %rsp,%rbp
+  8054ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8054b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8054b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8054b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054c1:	48 89 c7             	mov    %rax,%rdi
+  8054c4:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8054c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054cb:	48 b8 0d 57 80 00 00 	movabs $0x80570d,%rax
+  8054d2:	00 00 00 
+  8054d5:	ff d0                	call   *%rax
+}
+  8054d7:	90                   	nop
+  8054d8:	c9                   	leave
+  8054d9:	c3                   	ret
+
+00000000008054da <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8054da:	55                   	push   %rbp
+  8054db:	48 89 e5             	mov    %rsp,%rbp
+  8054de:	48 83 ec 20          	sub    $0x20,%rsp
+  8054e2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8054e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054e8:	c1 e0 10             	shl    $0x10,%eax
+  8054eb:	48 98                	cltq
+  8054ed:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8054f2:	48 01 d0             	add    %rdx,%rax
+  8054f5:	48 89 c6             	mov    %rax,%rsi
+  8054f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054fd:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  805504:	00 00 00 
+  805507:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805509:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80550c:	83 c0 01             	add    $0x1,%eax
+  80550f:	c1 e0 10             	shl    $0x10,%eax
+  805512:	48 98                	cltq
+  805514:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805519:	48 01 d0             	add    %rdx,%rax
+  80551c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805520:	eb 20                	jmp    805542 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805526:	48 89 c6             	mov    %rax,%rsi
+  805529:	bf 00 00 00 00       	mov    $0x0,%edi
+  80552e:	48 b8 21 26 80 00 00 	movabs $0x802621,%rax
+  805535:	00 00 00 
+  805538:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80553a:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805541:	00 
+  805542:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805545:	83 c0 01             	add    $0x1,%eax
+  805548:	c1 e0 10             	shl    $0x10,%eax
+  80554b:	48 98                	cltq
+  80554d:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805552:	48 01 d0             	add    %rdx,%rax
+  805555:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805559:	72 c7                	jb     805522 <slot_unmap+0x48>
+}
+  80555b:	90                   	nop
+  80555c:	90                   	nop
+  80555d:	c9                   	leave
+  80555e:	c3                   	ret
+
+000000000080555f <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  80555f:	55                   	push   %rbp
+  805560:	48 89 e5             	mov    %rsp,%rbp
+  805563:	48 83 ec 30          	sub    $0x30,%rsp
+  805567:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80556b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80556f:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805576:	00 00 00 
+  805579:	48 89 c7             	mov    %rax,%rdi
+  80557c:	48 b8 3c 63 80 00 00 	movabs $0x80633c,%rax
+  805583:	00 00 00 
+  805586:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805588:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80558f:	eb 04                	jmp    805595 <thread_create+0x36>
+  805591:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805595:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805599:	7f 16                	jg     8055b1 <thread_create+0x52>
+  80559b:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8055a2:	00 00 00 
+  8055a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055a8:	48 98                	cltq
+  8055aa:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8055ad:	85 c0                	test   %eax,%eax
+  8055af:	75 e0                	jne    805591 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8055b1:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8055b5:	75 0c                	jne    8055c3 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8055b7:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8055be:	e9 2c 01 00 00       	jmp    8056ef <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8055c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055c6:	c1 e0 10             	shl    $0x10,%eax
+  8055c9:	48 98                	cltq
+  8055cb:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8055d0:	48 01 d0             	add    %rdx,%rax
+  8055d3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8055d8:	48 89 c6             	mov    %rax,%rsi
+  8055db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055e0:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8055e7:	00 00 00 
+  8055ea:	ff d0                	call   *%rax
+  8055ec:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8055ef:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8055f3:	0f 88 f5 00 00 00    	js     8056ee <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8055f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055fc:	83 c0 01             	add    $0x1,%eax
+  8055ff:	c1 e0 10             	shl    $0x10,%eax
+  805602:	48 98                	cltq
+  805604:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805609:	48 01 d0             	add    %rdx,%rax
+  80560c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805610:	eb 32                	jmp    805644 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805616:	ba 07 00 00 00       	mov    $0x7,%edx
+  80561b:	48 89 c6             	mov    %rax,%rsi
+  80561e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805623:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  80562a:	00 00 00 
+  80562d:	ff d0                	call   *%rax
+  80562f:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805632:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805636:	0f 88 9e 00 00 00    	js     8056da <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80563c:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805643:	00 
+  805644:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805647:	83 c0 01             	add    $0x1,%eax
+  80564a:	c1 e0 10             	shl    $0x10,%eax
+  80564d:	48 98                	cltq
+  80564f:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805654:	48 01 d0             	add    %rdx,%rax
+  805657:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80565b:	72 b5                	jb     805612 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  80565d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805665:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805668:	c1 e2 10             	shl    $0x10,%edx
+  80566b:	48 63 d2             	movslq %edx,%rdx
+  80566e:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805673:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805676:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805679:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80567c:	83 c2 01             	add    $0x1,%edx
+  80567f:	c1 e2 10             	shl    $0x10,%edx
+  805682:	48 63 d2             	movslq %edx,%rdx
+  805685:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  80568a:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  80568d:	48 bf a9 54 80 00 00 	movabs $0x8054a9,%rdi
+  805694:	00 00 00 
+  805697:	49 89 c8             	mov    %rcx,%r8
+  80569a:	48 89 c1             	mov    %rax,%rcx
+  80569d:	4c 89 ca             	mov    %r9,%rdx
+  8056a0:	48 b8 09 2a 80 00 00 	movabs $0x802a09,%rax
+  8056a7:	00 00 00 
+  8056aa:	ff d0                	call   *%rax
+  8056ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8056af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056b3:	79 08                	jns    8056bd <thread_create+0x15e>
+    r = id;
+  8056b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8056bb:	eb 1e                	jmp    8056db <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8056bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056c0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8056c3:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  8056ca:	00 00 00 
+  8056cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056d0:	48 98                	cltq
+  8056d2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8056d5:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8056d8:	eb 15                	jmp    8056ef <thread_create+0x190>
+      goto fail;
+  8056da:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8056db:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056de:	89 c7                	mov    %eax,%edi
+  8056e0:	48 b8 da 54 80 00 00 	movabs $0x8054da,%rax
+  8056e7:	00 00 00 
+  8056ea:	ff d0                	call   *%rax
+  8056ec:	eb 01                	jmp    8056ef <thread_create+0x190>
+    goto out;
+  8056ee:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8056ef:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8056f6:	00 00 00 
+  8056f9:	48 89 c7             	mov    %rax,%rdi
+  8056fc:	48 b8 11 64 80 00 00 	movabs $0x806411,%rax
+  805703:	00 00 00 
+  805706:	ff d0                	call   *%rax
+  return r;
+  805708:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80570b:	c9                   	leave
+  80570c:	c3                   	ret
+
+000000000080570d <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  80570d:	55                   	push   %rbp
+  80570e:	48 89 e5             	mov    %rsp,%rbp
+  805711:	48 83 ec 10          	sub    $0x10,%rsp
+  805715:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805718:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80571b:	89 c7                	mov    %eax,%edi
+  80571d:	48 b8 66 2a 80 00 00 	movabs $0x802a66,%rax
+  805724:	00 00 00 
+  805727:	ff d0                	call   *%rax
+}
+  805729:	90                   	nop
+  80572a:	c9                   	leave
+  80572b:	c3                   	ret
+
+000000000080572c <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80572c:	55                   	push   %rbp
+  80572d:	48 89 e5             	mov    %rsp,%rbp
+  805730:	48 83 ec 20          	sub    $0x20,%rsp
+  805734:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805737:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  80573b:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805742:	00 00 00 
+  805745:	48 89 c7             	mov    %rax,%rdi
+  805748:	48 b8 3c 63 80 00 00 	movabs $0x80633c,%rax
+  80574f:	00 00 00 
+  805752:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805754:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80575b:	eb 04                	jmp    805761 <thread_join+0x35>
+  80575d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805761:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805765:	7f 17                	jg     80577e <thread_join+0x52>
+  805767:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80576e:	00 00 00 
+  805771:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805774:	48 98                	cltq
+  805776:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805779:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80577c:	75 df                	jne    80575d <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  80577e:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805785:	00 00 00 
+  805788:	48 89 c7             	mov    %rax,%rdi
+  80578b:	48 b8 11 64 80 00 00 	movabs $0x806411,%rax
+  805792:	00 00 00 
+  805795:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805797:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80579b:	74 06                	je     8057a3 <thread_join+0x77>
+  80579d:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8057a1:	75 07                	jne    8057aa <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8057a3:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8057a8:	eb 76                	jmp    805820 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8057aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057b1:	48 89 d6             	mov    %rdx,%rsi
+  8057b4:	89 c7                	mov    %eax,%edi
+  8057b6:	48 b8 2e 62 80 00 00 	movabs $0x80622e,%rax
+  8057bd:	00 00 00 
+  8057c0:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8057c2:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8057c9:	00 00 00 
+  8057cc:	48 89 c7             	mov    %rax,%rdi
+  8057cf:	48 b8 3c 63 80 00 00 	movabs $0x80633c,%rax
+  8057d6:	00 00 00 
+  8057d9:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8057db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057de:	89 c7                	mov    %eax,%edi
+  8057e0:	48 b8 da 54 80 00 00 	movabs $0x8054da,%rax
+  8057e7:	00 00 00 
+  8057ea:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8057ec:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8057f3:	00 00 00 
+  8057f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057f9:	48 98                	cltq
+  8057fb:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805802:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805809:	00 00 00 
+  80580c:	48 89 c7             	mov    %rax,%rdi
+  80580f:	48 b8 11 64 80 00 00 	movabs $0x806411,%rax
+  805816:	00 00 00 
+  805819:	ff d0                	call   *%rax
+  return 0;
+  80581b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805820:	c9                   	leave
+  805821:	c3                   	ret
+
+0000000000805822 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805822:	55                   	push   %rbp
+  805823:	48 89 e5             	mov    %rsp,%rbp
+  805826:	48 83 ec 08          	sub    $0x8,%rsp
+  80582a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80582e:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805833:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805837:	73 23                	jae    80585c <thread_is_uxstack+0x3a>
+  805839:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80583e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805842:	72 18                	jb     80585c <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805848:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80584d:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805853:	75 07                	jne    80585c <thread_is_uxstack+0x3a>
+  805855:	b8 01 00 00 00       	mov    $0x1,%eax
+  80585a:	eb 05                	jmp    805861 <thread_is_uxstack+0x3f>
+  80585c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805861:	83 e0 01             	and    $0x1,%eax
+}
+  805864:	c9                   	leave
+  805865:	c3                   	ret
+
+0000000000805866 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805866:	55                   	push   %rbp
+  805867:	48 89 e5             	mov    %rsp,%rbp
+  80586a:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  80586e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805875:	00 00 00 
+  805878:	8b 40 04             	mov    0x4(%rax),%eax
+  80587b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805880:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805887:	00 00 00 
+  80588a:	48 98                	cltq
+  80588c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805893:	48 01 d0             	add    %rdx,%rax
+  805896:	48 05 08 01 00 00    	add    $0x108,%rax
+  80589c:	48 8b 00             	mov    (%rax),%rax
+  80589f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8058a3:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8058a8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8058ac:	73 0b                	jae    8058b9 <thread_pftemp+0x53>
+  8058ae:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8058b3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8058b7:	73 07                	jae    8058c0 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8058b9:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8058be:	eb 26                	jmp    8058e6 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8058c0:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8058c7:	ff ff ff 
+  8058ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058ce:	48 01 d0             	add    %rdx,%rax
+  8058d1:	48 c1 e8 10          	shr    $0x10,%rax
+  8058d5:	48 83 c0 01          	add    $0x1,%rax
+  8058d9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8058dd:	48 f7 d8             	neg    %rax
+  8058e0:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  8058e6:	c9                   	leave
+  8058e7:	c3                   	ret
+
+00000000008058e8 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8058e8:	55                   	push   %rbp
+  8058e9:	48 89 e5             	mov    %rsp,%rbp
+  8058ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8058f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8058f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058f7:	75 10                	jne    805909 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8058f9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805900:	00 00 00 
+  805903:	8b 00                	mov    (%rax),%eax
+  805905:	48 98                	cltq
+  805907:	eb 05                	jmp    80590e <vsyscall+0x26>
+  }
+  return 0;
+  805909:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80590e:	c9                   	leave
+  80590f:	c3                   	ret
+
+0000000000805910 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805910:	55                   	push   %rbp
+  805911:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805914:	bf 00 00 00 00       	mov    $0x0,%edi
+  805919:	48 b8 e8 58 80 00 00 	movabs $0x8058e8,%rax
+  805920:	00 00 00 
+  805923:	ff d0                	call   *%rax
+}
+  805925:	5d                   	pop    %rbp
+  805926:	c3                   	ret
+
+0000000000805927 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805927:	55                   	push   %rbp
+  805928:	48 89 e5             	mov    %rsp,%rbp
+  80592b:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80592f:	0f 31                	rdtsc
+  805931:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805934:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805937:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80593a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80593d:	48 c1 e2 20          	shl    $0x20,%rdx
+  805941:	48 09 d0             	or     %rdx,%rax
+  805944:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805948:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80594c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805950:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805957:	00 00 00 
+  80595a:	8b 40 08             	mov    0x8(%rax),%eax
+  80595d:	48 98                	cltq
+  80595f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805967:	ba 00 00 00 00       	mov    $0x0,%edx
+  80596c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805970:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80597b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805980:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805984:	48 89 d0             	mov    %rdx,%rax
+  805987:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80598e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805993:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805997:	48 01 c8             	add    %rcx,%rax
+}
+  80599a:	c9                   	leave
+  80599b:	c3                   	ret
+
+000000000080599c <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80599c:	55                   	push   %rbp
+  80599d:	48 89 e5             	mov    %rsp,%rbp
+  8059a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8059a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8059a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059aa:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8059ad:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8059b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8059b6:	48 89 c7             	mov    %rax,%rdi
+  8059b9:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  8059c0:	00 00 00 
+  8059c3:	ff d0                	call   *%rax
+}
+  8059c5:	90                   	nop
+  8059c6:	c9                   	leave
+  8059c7:	c3                   	ret
+
+00000000008059c8 <getchar>:
+
+int
+getchar(void) {
+  8059c8:	55                   	push   %rbp
+  8059c9:	48 89 e5             	mov    %rsp,%rbp
+  8059cc:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8059d0:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8059d4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8059d9:	48 89 c6             	mov    %rax,%rsi
+  8059dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059e1:	48 b8 bc 3a 80 00 00 	movabs $0x803abc,%rax
+  8059e8:	00 00 00 
+  8059eb:	ff d0                	call   *%rax
+  8059ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8059f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059f4:	79 05                	jns    8059fb <getchar+0x33>
+    return r;
+  8059f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059f9:	eb 14                	jmp    805a0f <getchar+0x47>
+  if (r < 1)
+  8059fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059ff:	7f 07                	jg     805a08 <getchar+0x40>
+    return -E_EOF;
+  805a01:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805a06:	eb 07                	jmp    805a0f <getchar+0x47>
+  return c;
+  805a08:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805a0c:	0f b6 c0             	movzbl %al,%eax
+}
+  805a0f:	c9                   	leave
+  805a10:	c3                   	ret
+
+0000000000805a11 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805a11:	55                   	push   %rbp
+  805a12:	48 89 e5             	mov    %rsp,%rbp
+  805a15:	48 83 ec 20          	sub    $0x20,%rsp
+  805a19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a1c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a23:	48 89 d6             	mov    %rdx,%rsi
+  805a26:	89 c7                	mov    %eax,%edi
+  805a28:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  805a2f:	00 00 00 
+  805a32:	ff d0                	call   *%rax
+  805a34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a3b:	79 05                	jns    805a42 <iscons+0x31>
+    return r;
+  805a3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a40:	eb 1a                	jmp    805a5c <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a46:	8b 10                	mov    (%rax),%edx
+  805a48:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805a4f:	00 00 00 
+  805a52:	8b 00                	mov    (%rax),%eax
+  805a54:	39 c2                	cmp    %eax,%edx
+  805a56:	0f 94 c0             	sete   %al
+  805a59:	0f b6 c0             	movzbl %al,%eax
+}
+  805a5c:	c9                   	leave
+  805a5d:	c3                   	ret
+
+0000000000805a5e <opencons>:
+
+int
+opencons(void) {
+  805a5e:	55                   	push   %rbp
+  805a5f:	48 89 e5             	mov    %rsp,%rbp
+  805a62:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805a66:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805a6a:	48 89 c7             	mov    %rax,%rdi
+  805a6d:	48 b8 7e 34 80 00 00 	movabs $0x80347e,%rax
+  805a74:	00 00 00 
+  805a77:	ff d0                	call   *%rax
+  805a79:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a80:	79 05                	jns    805a87 <opencons+0x29>
+    return r;
+  805a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a85:	eb 66                	jmp    805aed <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a8b:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a90:	48 89 c6             	mov    %rax,%rsi
+  805a93:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a98:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  805a9f:	00 00 00 
+  805aa2:	ff d0                	call   *%rax
+  805aa4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805aa7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805aab:	79 05                	jns    805ab2 <opencons+0x54>
+    return r;
+  805aad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ab0:	eb 3b                	jmp    805aed <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ab6:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  805abd:	00 00 00 
+  805ac0:	8b 12                	mov    (%rdx),%edx
+  805ac2:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ac8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805acf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ad3:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805ada:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ade:	48 89 c7             	mov    %rax,%rdi
+  805ae1:	48 b8 30 34 80 00 00 	movabs $0x803430,%rax
+  805ae8:	00 00 00 
+  805aeb:	ff d0                	call   *%rax
+}
+  805aed:	c9                   	leave
+  805aee:	c3                   	ret
+
+0000000000805aef <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805aef:	55                   	push   %rbp
+  805af0:	48 89 e5             	mov    %rsp,%rbp
+  805af3:	48 83 ec 20          	sub    $0x20,%rsp
+  805af7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805afa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805afd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805b01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b04:	48 89 d6             	mov    %rdx,%rsi
+  805b07:	89 c7                	mov    %eax,%edi
+  805b09:	48 b8 60 35 80 00 00 	movabs $0x803560,%rax
+  805b10:	00 00 00 
+  805b13:	ff d0                	call   *%rax
+  805b15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b18:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b1c:	79 05                	jns    805b23 <consmode+0x34>
+    return r;
+  805b1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b21:	eb 34                	jmp    805b57 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805b23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b27:	8b 10                	mov    (%rax),%edx
+  805b29:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805b30:	00 00 00 
+  805b33:	8b 00                	mov    (%rax),%eax
+  805b35:	39 c2                	cmp    %eax,%edx
+  805b37:	74 07                	je     805b40 <consmode+0x51>
+    return -E_INVAL;
+  805b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805b3e:	eb 17                	jmp    805b57 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b44:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b4e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b51:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805b54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805b57:	c9                   	leave
+  805b58:	c3                   	ret
+
+0000000000805b59 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805b59:	55                   	push   %rbp
+  805b5a:	48 89 e5             	mov    %rsp,%rbp
+  805b5d:	48 83 ec 20          	sub    $0x20,%rsp
+  805b61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b65:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805b69:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b71:	8b 50 0c             	mov    0xc(%rax),%edx
+  805b74:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805b78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b7c:	48 89 ce             	mov    %rcx,%rsi
+  805b7f:	48 89 c7             	mov    %rax,%rdi
+  805b82:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  805b89:	00 00 00 
+  805b8c:	ff d0                	call   *%rax
+  805b8e:	48 98                	cltq
+}
+  805b90:	c9                   	leave
+  805b91:	c3                   	ret
+
+0000000000805b92 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805b92:	55                   	push   %rbp
+  805b93:	48 89 e5             	mov    %rsp,%rbp
+  805b96:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805b9d:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805ba4:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805bab:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805bb2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805bb9:	eb 74                	jmp    805c2f <devcons_write+0x9d>
+    m = n - tot;
+  805bbb:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805bc2:	89 c2                	mov    %eax,%edx
+  805bc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bc7:	29 c2                	sub    %eax,%edx
+  805bc9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805bcc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805bcf:	83 f8 7f             	cmp    $0x7f,%eax
+  805bd2:	76 07                	jbe    805bdb <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805bd4:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805bdb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805bde:	48 63 d0             	movslq %eax,%rdx
+  805be1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805be4:	48 63 c8             	movslq %eax,%rcx
+  805be7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805bee:	48 01 c1             	add    %rax,%rcx
+  805bf1:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805bf8:	48 89 ce             	mov    %rcx,%rsi
+  805bfb:	48 89 c7             	mov    %rax,%rdi
+  805bfe:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  805c05:	00 00 00 
+  805c08:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805c0a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c0d:	48 63 d0             	movslq %eax,%rdx
+  805c10:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805c17:	48 89 d6             	mov    %rdx,%rsi
+  805c1a:	48 89 c7             	mov    %rax,%rdi
+  805c1d:	48 b8 52 23 80 00 00 	movabs $0x802352,%rax
+  805c24:	00 00 00 
+  805c27:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805c29:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c2c:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805c2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c32:	48 98                	cltq
+  805c34:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805c3b:	0f 82 7a ff ff ff    	jb     805bbb <devcons_write+0x29>
+  }
+  return tot;
+  805c41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c44:	48 98                	cltq
+}
+  805c46:	c9                   	leave
+  805c47:	c3                   	ret
+
+0000000000805c48 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805c48:	55                   	push   %rbp
+  805c49:	48 89 e5             	mov    %rsp,%rbp
+  805c4c:	48 83 ec 08          	sub    $0x8,%rsp
+  805c50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c59:	c9                   	leave
+  805c5a:	c3                   	ret
+
+0000000000805c5b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805c5b:	55                   	push   %rbp
+  805c5c:	48 89 e5             	mov    %rsp,%rbp
+  805c5f:	48 83 ec 10          	sub    $0x10,%rsp
+  805c63:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805c67:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805c6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c6f:	48 ba ad 70 80 00 00 	movabs $0x8070ad,%rdx
+  805c76:	00 00 00 
+  805c79:	48 89 d6             	mov    %rdx,%rsi
+  805c7c:	48 89 c7             	mov    %rax,%rdi
+  805c7f:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  805c86:	00 00 00 
+  805c89:	ff d0                	call   *%rax
+  return 0;
+  805c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c90:	c9                   	leave
+  805c91:	c3                   	ret
+
+0000000000805c92 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805c92:	55                   	push   %rbp
+  805c93:	48 89 e5             	mov    %rsp,%rbp
+  805c96:	48 83 ec 30          	sub    $0x30,%rsp
+  805c9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805c9e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ca1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805ca5:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805cac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805caf:	83 e0 02             	and    $0x2,%eax
+  805cb2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805cb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cb9:	8b 40 0c             	mov    0xc(%rax),%eax
+  805cbc:	83 f8 01             	cmp    $0x1,%eax
+  805cbf:	75 04                	jne    805cc5 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805cc1:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805cc5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805cc8:	83 e0 01             	and    $0x1,%eax
+  805ccb:	85 c0                	test   %eax,%eax
+  805ccd:	74 44                	je     805d13 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805ccf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805cd7:	89 c2                	mov    %eax,%edx
+  805cd9:	be 00 00 00 00       	mov    $0x0,%esi
+  805cde:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ce3:	48 b8 b1 29 80 00 00 	movabs $0x8029b1,%rax
+  805cea:	00 00 00 
+  805ced:	ff d0                	call   *%rax
+  805cef:	83 f8 01             	cmp    $0x1,%eax
+  805cf2:	75 06                	jne    805cfa <devcons_poll+0x68>
+      revents |= POLLIN;
+  805cf4:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805cf8:	eb 19                	jmp    805d13 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805cfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cfe:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805d04:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805d07:	89 c2                	mov    %eax,%edx
+  805d09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d0d:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805d13:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805d16:	c9                   	leave
+  805d17:	c3                   	ret
+
+0000000000805d18 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805d18:	55                   	push   %rbp
+  805d19:	48 89 e5             	mov    %rsp,%rbp
+  805d1c:	48 83 ec 20          	sub    $0x20,%rsp
+  805d20:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805d24:	48 b8 f0 24 80 00 00 	movabs $0x8024f0,%rax
+  805d2b:	00 00 00 
+  805d2e:	ff d0                	call   *%rax
+  805d30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805d33:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805d3a:	00 00 00 
+  805d3d:	48 8b 00             	mov    (%rax),%rax
+  805d40:	48 85 c0             	test   %rax,%rax
+  805d43:	75 62                	jne    805da7 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805d45:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d48:	ba 07 00 00 00       	mov    $0x7,%edx
+  805d4d:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805d54:	00 00 00 
+  805d57:	48 89 ce             	mov    %rcx,%rsi
+  805d5a:	89 c7                	mov    %eax,%edi
+  805d5c:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  805d63:	00 00 00 
+  805d66:	ff d0                	call   *%rax
+  805d68:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805d6b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805d6f:	79 36                	jns    805da7 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805d71:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d74:	89 c1                	mov    %eax,%ecx
+  805d76:	48 b8 b4 70 80 00 00 	movabs $0x8070b4,%rax
+  805d7d:	00 00 00 
+  805d80:	48 89 c2             	mov    %rax,%rdx
+  805d83:	be 23 00 00 00       	mov    $0x23,%esi
+  805d88:	48 b8 cc 70 80 00 00 	movabs $0x8070cc,%rax
+  805d8f:	00 00 00 
+  805d92:	48 89 c7             	mov    %rax,%rdi
+  805d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d9a:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  805da1:	00 00 00 
+  805da4:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805da7:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  805dae:	00 00 00 
+  805db1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805db5:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805db8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805dbb:	48 ba 18 5e 80 00 00 	movabs $0x805e18,%rdx
+  805dc2:	00 00 00 
+  805dc5:	48 89 d6             	mov    %rdx,%rsi
+  805dc8:	89 c7                	mov    %eax,%edi
+  805dca:	48 b8 06 27 80 00 00 	movabs $0x802706,%rax
+  805dd1:	00 00 00 
+  805dd4:	ff d0                	call   *%rax
+  805dd6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805dd9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805ddd:	79 36                	jns    805e15 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805ddf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805de2:	89 c1                	mov    %eax,%ecx
+  805de4:	48 b8 b4 70 80 00 00 	movabs $0x8070b4,%rax
+  805deb:	00 00 00 
+  805dee:	48 89 c2             	mov    %rax,%rdx
+  805df1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805df6:	48 b8 cc 70 80 00 00 	movabs $0x8070cc,%rax
+  805dfd:	00 00 00 
+  805e00:	48 89 c7             	mov    %rax,%rdi
+  805e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e08:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  805e0f:	00 00 00 
+  805e12:	41 ff d0             	call   *%r8
+}
+  805e15:	90                   	nop
+  805e16:	c9                   	leave
+  805e17:	c3                   	ret
+
+0000000000805e18 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805e18:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805e1b:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805e1e:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805e25:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805e29:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805e2e:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  805e35:	00 00 00 
+	call *%rax
+  805e38:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805e3a:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805e3f:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805e42:	41 5f                	pop    %r15
+	popq %r15
+  805e44:	41 5f                	pop    %r15
+	popq %r15
+  805e46:	41 5f                	pop    %r15
+	popq %r14
+  805e48:	41 5e                	pop    %r14
+	popq %r13
+  805e4a:	41 5d                	pop    %r13
+	popq %r12
+  805e4c:	41 5c                	pop    %r12
+	popq %r11
+  805e4e:	41 5b                	pop    %r11
+	popq %r10
+  805e50:	41 5a                	pop    %r10
+	popq %r9
+  805e52:	41 59                	pop    %r9
+	popq %r8
+  805e54:	41 58                	pop    %r8
+	popq %rsi
+  805e56:	5e                   	pop    %rsi
+	popq %rdi
+  805e57:	5f                   	pop    %rdi
+	popq %rbp
+  805e58:	5d                   	pop    %rbp
+	popq %rdx
+  805e59:	5a                   	pop    %rdx
+	popq %rcx
+  805e5a:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805e5b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805e60:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805e65:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805e69:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805e6c:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805e71:	5b                   	pop    %rbx
+	popq %rax
+  805e72:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805e73:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805e77:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805e78:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805e7d:	c3                   	ret
+
+0000000000805e7e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805e7e:	55                   	push   %rbp
+  805e7f:	48 89 e5             	mov    %rsp,%rbp
+  805e82:	48 83 ec 20          	sub    $0x20,%rsp
+  805e86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e8a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805e8e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805e92:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805e96:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805e9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e9e:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805ea5:	48 89 c7             	mov    %rax,%rdi
+  805ea8:	48 b8 b6 5e 80 00 00 	movabs $0x805eb6,%rax
+  805eaf:	00 00 00 
+  805eb2:	ff d0                	call   *%rax
+}
+  805eb4:	c9                   	leave
+  805eb5:	c3                   	ret
+
+0000000000805eb6 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805eb6:	55                   	push   %rbp
+  805eb7:	48 89 e5             	mov    %rsp,%rbp
+  805eba:	48 83 ec 30          	sub    $0x30,%rsp
+  805ebe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ec2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ec6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805eca:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805ece:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805ed3:	75 0e                	jne    805ee3 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805ed5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805edc:	00 00 00 
+  805edf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805ee3:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805ee8:	75 18                	jne    805f02 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805eea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eee:	48 89 c7             	mov    %rax,%rdi
+  805ef1:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  805ef8:	00 00 00 
+  805efb:	ff d0                	call   *%rax
+  805efd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f00:	eb 1d                	jmp    805f1f <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805f02:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805f06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f0a:	48 89 d6             	mov    %rdx,%rsi
+  805f0d:	48 89 c7             	mov    %rax,%rdi
+  805f10:	48 b8 ef 27 80 00 00 	movabs $0x8027ef,%rax
+  805f17:	00 00 00 
+  805f1a:	ff d0                	call   *%rax
+  805f1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805f1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f23:	79 2a                	jns    805f4f <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805f25:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805f2a:	74 0a                	je     805f36 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805f2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f30:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805f36:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805f3b:	74 0a                	je     805f47 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805f3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f41:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805f47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f4a:	e9 aa 00 00 00       	jmp    805ff9 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805f4f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805f54:	74 36                	je     805f8c <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805f56:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805f5d:	00 00 00 
+  805f60:	8b 40 04             	mov    0x4(%rax),%eax
+  805f63:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805f68:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805f6f:	00 00 00 
+  805f72:	48 98                	cltq
+  805f74:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805f7b:	48 01 d0             	add    %rdx,%rax
+  805f7e:	48 05 24 01 00 00    	add    $0x124,%rax
+  805f84:	8b 10                	mov    (%rax),%edx
+  805f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f8a:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805f8c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805f91:	74 36                	je     805fc9 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805f93:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805f9a:	00 00 00 
+  805f9d:	8b 40 04             	mov    0x4(%rax),%eax
+  805fa0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805fa5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805fac:	00 00 00 
+  805faf:	48 98                	cltq
+  805fb1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805fb8:	48 01 d0             	add    %rdx,%rax
+  805fbb:	48 05 28 01 00 00    	add    $0x128,%rax
+  805fc1:	8b 10                	mov    (%rax),%edx
+  805fc3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fc7:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805fc9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805fd0:	00 00 00 
+  805fd3:	8b 40 04             	mov    0x4(%rax),%eax
+  805fd6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805fdb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805fe2:	00 00 00 
+  805fe5:	48 98                	cltq
+  805fe7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805fee:	48 01 d0             	add    %rdx,%rax
+  805ff1:	48 05 20 01 00 00    	add    $0x120,%rax
+  805ff7:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805ff9:	c9                   	leave
+  805ffa:	c3                   	ret
+
+0000000000805ffb <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805ffb:	55                   	push   %rbp
+  805ffc:	48 89 e5             	mov    %rsp,%rbp
+  805fff:	48 83 ec 30          	sub    $0x30,%rsp
+  806003:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806006:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806009:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80600d:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806010:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806015:	75 5e                	jne    806075 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806017:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80601e:	00 00 00 
+  806021:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806025:	eb 4e                	jmp    806075 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806027:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80602b:	79 3c                	jns    806069 <ipc_send+0x6e>
+  80602d:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  806031:	74 36                	je     806069 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  806033:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806036:	89 c1                	mov    %eax,%ecx
+  806038:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  80603f:	00 00 00 
+  806042:	48 89 c2             	mov    %rax,%rdx
+  806045:	be 54 00 00 00       	mov    $0x54,%esi
+  80604a:	48 b8 06 71 80 00 00 	movabs $0x807106,%rax
+  806051:	00 00 00 
+  806054:	48 89 c7             	mov    %rax,%rdi
+  806057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80605c:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  806063:	00 00 00 
+  806066:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806069:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  806070:	00 00 00 
+  806073:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806075:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806078:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80607b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80607f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806082:	89 c7                	mov    %eax,%edi
+  806084:	48 b8 52 27 80 00 00 	movabs $0x802752,%rax
+  80608b:	00 00 00 
+  80608e:	ff d0                	call   *%rax
+  806090:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806093:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806097:	75 8e                	jne    806027 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806099:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8060a0:	00 00 00 
+  8060a3:	ff d0                	call   *%rax
+}
+  8060a5:	90                   	nop
+  8060a6:	c9                   	leave
+  8060a7:	c3                   	ret
+
+00000000008060a8 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8060a8:	55                   	push   %rbp
+  8060a9:	48 89 e5             	mov    %rsp,%rbp
+  8060ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8060b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8060b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8060ba:	eb 4d                	jmp    806109 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8060bc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8060c3:	00 00 00 
+  8060c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060c9:	48 98                	cltq
+  8060cb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8060d2:	48 01 d0             	add    %rdx,%rax
+  8060d5:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8060db:	8b 00                	mov    (%rax),%eax
+  8060dd:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8060e0:	75 23                	jne    806105 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8060e2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8060e9:	00 00 00 
+  8060ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060ef:	48 98                	cltq
+  8060f1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8060f8:	48 01 d0             	add    %rdx,%rax
+  8060fb:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806101:	8b 00                	mov    (%rax),%eax
+  806103:	eb 12                	jmp    806117 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806105:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806109:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806110:	7e aa                	jle    8060bc <ipc_find_env+0x14>
+  return 0;
+  806112:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806117:	c9                   	leave
+  806118:	c3                   	ret
+
+0000000000806119 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806119:	55                   	push   %rbp
+  80611a:	48 89 e5             	mov    %rsp,%rbp
+  80611d:	48 83 ec 18          	sub    $0x18,%rsp
+  806121:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806125:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806129:	48 c1 e8 27          	shr    $0x27,%rax
+  80612d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806132:	48 89 c2             	mov    %rax,%rdx
+  806135:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80613c:	01 00 00 
+  80613f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806143:	83 e0 01             	and    $0x1,%eax
+  806146:	48 85 c0             	test   %rax,%rax
+  806149:	74 63                	je     8061ae <pageref+0x95>
+  80614b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806153:	48 89 c2             	mov    %rax,%rdx
+  806156:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80615d:	01 00 00 
+  806160:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806164:	83 e0 01             	and    $0x1,%eax
+  806167:	48 85 c0             	test   %rax,%rax
+  80616a:	74 42                	je     8061ae <pageref+0x95>
+  80616c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806170:	48 c1 e8 15          	shr    $0x15,%rax
+  806174:	48 89 c2             	mov    %rax,%rdx
+  806177:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80617e:	01 00 00 
+  806181:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806185:	83 e0 01             	and    $0x1,%eax
+  806188:	48 85 c0             	test   %rax,%rax
+  80618b:	74 21                	je     8061ae <pageref+0x95>
+  80618d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806191:	48 c1 e8 0c          	shr    $0xc,%rax
+  806195:	48 89 c2             	mov    %rax,%rdx
+  806198:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80619f:	01 00 00 
+  8061a2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8061a6:	83 e0 01             	and    $0x1,%eax
+  8061a9:	48 85 c0             	test   %rax,%rax
+  8061ac:	75 07                	jne    8061b5 <pageref+0x9c>
+    return 0;
+  8061ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061b3:	eb 53                	jmp    806208 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8061b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8061bd:	48 89 c2             	mov    %rax,%rdx
+  8061c0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8061c7:	01 00 00 
+  8061ca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8061ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8061d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061d6:	83 e0 01             	and    $0x1,%eax
+  8061d9:	48 85 c0             	test   %rax,%rax
+  8061dc:	75 07                	jne    8061e5 <pageref+0xcc>
+    return 0;
+  8061de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061e3:	eb 23                	jmp    806208 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8061e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061e9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8061ed:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8061f4:	00 00 00 
+  8061f7:	48 c1 e0 04          	shl    $0x4,%rax
+  8061fb:	48 01 d0             	add    %rdx,%rax
+  8061fe:	48 83 c0 08          	add    $0x8,%rax
+  806202:	0f b7 00             	movzwl (%rax),%eax
+  806205:	0f b7 c0             	movzwl %ax,%eax
+}
+  806208:	c9                   	leave
+  806209:	c3                   	ret
+
+000000000080620a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  80620a:	55                   	push   %rbp
+  80620b:	48 89 e5             	mov    %rsp,%rbp
+  80620e:	48 83 ec 10          	sub    $0x10,%rsp
+  806212:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806218:	be 00 00 00 00       	mov    $0x0,%esi
+  80621d:	89 c7                	mov    %eax,%edi
+  80621f:	48 b8 2e 62 80 00 00 	movabs $0x80622e,%rax
+  806226:	00 00 00 
+  806229:	ff d0                	call   *%rax
+}
+  80622b:	90                   	nop
+  80622c:	c9                   	leave
+  80622d:	c3                   	ret
+
+000000000080622e <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  80622e:	55                   	push   %rbp
+  80622f:	48 89 e5             	mov    %rsp,%rbp
+  806232:	48 83 ec 10          	sub    $0x10,%rsp
+  806236:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806239:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80623d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806241:	75 3e                	jne    806281 <waitpid+0x53>
+  806243:	48 b8 10 71 80 00 00 	movabs $0x807110,%rax
+  80624a:	00 00 00 
+  80624d:	48 89 c1             	mov    %rax,%rcx
+  806250:	48 b8 1b 71 80 00 00 	movabs $0x80711b,%rax
+  806257:	00 00 00 
+  80625a:	48 89 c2             	mov    %rax,%rdx
+  80625d:	be 0e 00 00 00       	mov    $0xe,%esi
+  806262:	48 b8 30 71 80 00 00 	movabs $0x807130,%rax
+  806269:	00 00 00 
+  80626c:	48 89 c7             	mov    %rax,%rdi
+  80626f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806274:	49 b8 cc 05 80 00 00 	movabs $0x8005cc,%r8
+  80627b:	00 00 00 
+  80627e:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  806281:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  806286:	74 0a                	je     806292 <waitpid+0x64>
+    *status = 0;
+  806288:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80628c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  806292:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806299:	48 89 d6             	mov    %rdx,%rsi
+  80629c:	89 c7                	mov    %eax,%edi
+  80629e:	48 b8 68 24 80 00 00 	movabs $0x802468,%rax
+  8062a5:	00 00 00 
+  8062a8:	ff d0                	call   *%rax
+}
+  8062aa:	c9                   	leave
+  8062ab:	c3                   	ret
+
+00000000008062ac <xchg>:
+  8062ac:	55                   	push   %rbp
+  8062ad:	48 89 e5             	mov    %rsp,%rbp
+  8062b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8062b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062b8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8062bb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8062bf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8062c2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8062c6:	f0 87 02             	lock xchg %eax,(%rdx)
+  8062c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8062cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8062cf:	c9                   	leave
+  8062d0:	c3                   	ret
+
+00000000008062d1 <cmpxchg>:
+  8062d1:	55                   	push   %rbp
+  8062d2:	48 89 e5             	mov    %rsp,%rbp
+  8062d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8062d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062dd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8062e0:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8062e3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8062e7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8062ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8062ed:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8062f1:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  8062f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8062f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8062fb:	c9                   	leave
+  8062fc:	c3                   	ret
+
+00000000008062fd <xadd>:
+  8062fd:	55                   	push   %rbp
+  8062fe:	48 89 e5             	mov    %rsp,%rbp
+  806301:	48 83 ec 10          	sub    $0x10,%rsp
+  806305:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806309:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80630c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806310:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806317:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  80631b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80631e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806321:	c9                   	leave
+  806322:	c3                   	ret
+
+0000000000806323 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806323:	55                   	push   %rbp
+  806324:	48 89 e5             	mov    %rsp,%rbp
+  806327:	48 83 ec 08          	sub    $0x8,%rsp
+  80632b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80632f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806333:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806339:	90                   	nop
+  80633a:	c9                   	leave
+  80633b:	c3                   	ret
+
+000000000080633c <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  80633c:	55                   	push   %rbp
+  80633d:	48 89 e5             	mov    %rsp,%rbp
+  806340:	48 83 ec 20          	sub    $0x20,%rsp
+  806344:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80634c:	ba 01 00 00 00       	mov    $0x1,%edx
+  806351:	be 00 00 00 00       	mov    $0x0,%esi
+  806356:	48 89 c7             	mov    %rax,%rdi
+  806359:	48 b8 d1 62 80 00 00 	movabs $0x8062d1,%rax
+  806360:	00 00 00 
+  806363:	ff d0                	call   *%rax
+  806365:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806368:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80636c:	74 65                	je     8063d3 <mutex_lock+0x97>
+  if (c != 2)
+  80636e:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806372:	74 57                	je     8063cb <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806374:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806378:	be 02 00 00 00       	mov    $0x2,%esi
+  80637d:	48 89 c7             	mov    %rax,%rdi
+  806380:	48 b8 ac 62 80 00 00 	movabs $0x8062ac,%rax
+  806387:	00 00 00 
+  80638a:	ff d0                	call   *%rax
+  80638c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80638f:	eb 3a                	jmp    8063cb <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806391:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806395:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80639c:	be 02 00 00 00       	mov    $0x2,%esi
+  8063a1:	48 89 c7             	mov    %rax,%rdi
+  8063a4:	48 b8 15 29 80 00 00 	movabs $0x802915,%rax
+  8063ab:	00 00 00 
+  8063ae:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8063b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063b4:	be 02 00 00 00       	mov    $0x2,%esi
+  8063b9:	48 89 c7             	mov    %rax,%rdi
+  8063bc:	48 b8 ac 62 80 00 00 	movabs $0x8062ac,%rax
+  8063c3:	00 00 00 
+  8063c6:	ff d0                	call   *%rax
+  8063c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8063cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8063cf:	75 c0                	jne    806391 <mutex_lock+0x55>
+  8063d1:	eb 01                	jmp    8063d4 <mutex_lock+0x98>
+    return;
+  8063d3:	90                   	nop
+}
+  8063d4:	c9                   	leave
+  8063d5:	c3                   	ret
+
+00000000008063d6 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8063d6:	55                   	push   %rbp
+  8063d7:	48 89 e5             	mov    %rsp,%rbp
+  8063da:	48 83 ec 08          	sub    $0x8,%rsp
+  8063de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  8063e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8063eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8063f0:	48 89 c7             	mov    %rax,%rdi
+  8063f3:	48 b8 d1 62 80 00 00 	movabs $0x8062d1,%rax
+  8063fa:	00 00 00 
+  8063fd:	ff d0                	call   *%rax
+  8063ff:	85 c0                	test   %eax,%eax
+  806401:	75 07                	jne    80640a <mutex_trylock+0x34>
+  806403:	b8 00 00 00 00       	mov    $0x0,%eax
+  806408:	eb 05                	jmp    80640f <mutex_trylock+0x39>
+  80640a:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80640f:	c9                   	leave
+  806410:	c3                   	ret
+
+0000000000806411 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806411:	55                   	push   %rbp
+  806412:	48 89 e5             	mov    %rsp,%rbp
+  806415:	48 83 ec 10          	sub    $0x10,%rsp
+  806419:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80641d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806421:	be 00 00 00 00       	mov    $0x0,%esi
+  806426:	48 89 c7             	mov    %rax,%rdi
+  806429:	48 b8 ac 62 80 00 00 	movabs $0x8062ac,%rax
+  806430:	00 00 00 
+  806433:	ff d0                	call   *%rax
+  806435:	83 f8 02             	cmp    $0x2,%eax
+  806438:	75 18                	jne    806452 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  80643a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80643e:	be 01 00 00 00       	mov    $0x1,%esi
+  806443:	48 89 c7             	mov    %rax,%rdi
+  806446:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  80644d:	00 00 00 
+  806450:	ff d0                	call   *%rax
+}
+  806452:	90                   	nop
+  806453:	c9                   	leave
+  806454:	c3                   	ret
+
+0000000000806455 <cond_init>:
+cond_init(struct Cond *c) {
+  806455:	55                   	push   %rbp
+  806456:	48 89 e5             	mov    %rsp,%rbp
+  806459:	48 83 ec 08          	sub    $0x8,%rsp
+  80645d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806465:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80646b:	90                   	nop
+  80646c:	c9                   	leave
+  80646d:	c3                   	ret
+
+000000000080646e <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80646e:	55                   	push   %rbp
+  80646f:	48 89 e5             	mov    %rsp,%rbp
+  806472:	48 83 ec 30          	sub    $0x30,%rsp
+  806476:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80647a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80647e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  806482:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806486:	8b 00                	mov    (%rax),%eax
+  806488:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  80648b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80648f:	48 89 c7             	mov    %rax,%rdi
+  806492:	48 b8 11 64 80 00 00 	movabs $0x806411,%rax
+  806499:	00 00 00 
+  80649c:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  80649e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064a2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8064a6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8064a9:	89 ce                	mov    %ecx,%esi
+  8064ab:	48 89 c7             	mov    %rax,%rdi
+  8064ae:	48 b8 15 29 80 00 00 	movabs $0x802915,%rax
+  8064b5:	00 00 00 
+  8064b8:	ff d0                	call   *%rax
+  8064ba:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8064bd:	eb 1f                	jmp    8064de <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8064bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064c3:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8064ca:	be 02 00 00 00       	mov    $0x2,%esi
+  8064cf:	48 89 c7             	mov    %rax,%rdi
+  8064d2:	48 b8 15 29 80 00 00 	movabs $0x802915,%rax
+  8064d9:	00 00 00 
+  8064dc:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8064de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064e2:	be 02 00 00 00       	mov    $0x2,%esi
+  8064e7:	48 89 c7             	mov    %rax,%rdi
+  8064ea:	48 b8 ac 62 80 00 00 	movabs $0x8062ac,%rax
+  8064f1:	00 00 00 
+  8064f4:	ff d0                	call   *%rax
+  8064f6:	85 c0                	test   %eax,%eax
+  8064f8:	75 c5                	jne    8064bf <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  8064fa:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  8064fe:	75 07                	jne    806507 <cond_timedwait+0x99>
+  806500:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806505:	eb 05                	jmp    80650c <cond_timedwait+0x9e>
+  806507:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80650c:	c9                   	leave
+  80650d:	c3                   	ret
+
+000000000080650e <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80650e:	55                   	push   %rbp
+  80650f:	48 89 e5             	mov    %rsp,%rbp
+  806512:	48 83 ec 10          	sub    $0x10,%rsp
+  806516:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80651a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80651e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806526:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80652d:	48 89 ce             	mov    %rcx,%rsi
+  806530:	48 89 c7             	mov    %rax,%rdi
+  806533:	48 b8 6e 64 80 00 00 	movabs $0x80646e,%rax
+  80653a:	00 00 00 
+  80653d:	ff d0                	call   *%rax
+}
+  80653f:	90                   	nop
+  806540:	c9                   	leave
+  806541:	c3                   	ret
+
+0000000000806542 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806542:	55                   	push   %rbp
+  806543:	48 89 e5             	mov    %rsp,%rbp
+  806546:	48 83 ec 10          	sub    $0x10,%rsp
+  80654a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80654e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806552:	be 01 00 00 00       	mov    $0x1,%esi
+  806557:	48 89 c7             	mov    %rax,%rdi
+  80655a:	48 b8 fd 62 80 00 00 	movabs $0x8062fd,%rax
+  806561:	00 00 00 
+  806564:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80656a:	be 01 00 00 00       	mov    $0x1,%esi
+  80656f:	48 89 c7             	mov    %rax,%rdi
+  806572:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  806579:	00 00 00 
+  80657c:	ff d0                	call   *%rax
+}
+  80657e:	90                   	nop
+  80657f:	c9                   	leave
+  806580:	c3                   	ret
+
+0000000000806581 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  806581:	55                   	push   %rbp
+  806582:	48 89 e5             	mov    %rsp,%rbp
+  806585:	48 83 ec 10          	sub    $0x10,%rsp
+  806589:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80658d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806591:	be 01 00 00 00       	mov    $0x1,%esi
+  806596:	48 89 c7             	mov    %rax,%rdi
+  806599:	48 b8 fd 62 80 00 00 	movabs $0x8062fd,%rax
+  8065a0:	00 00 00 
+  8065a3:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8065a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065a9:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8065ae:	48 89 c7             	mov    %rax,%rdi
+  8065b1:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  8065b8:	00 00 00 
+  8065bb:	ff d0                	call   *%rax
+}
+  8065bd:	90                   	nop
+  8065be:	c9                   	leave
+  8065bf:	c3                   	ret
+
+00000000008065c0 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8065c0:	55                   	push   %rbp
+  8065c1:	48 89 e5             	mov    %rsp,%rbp
+  8065c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8065c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8065cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8065cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065d3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8065d6:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8065d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065dc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8065e3:	90                   	nop
+  8065e4:	c9                   	leave
+  8065e5:	c3                   	ret
+
+00000000008065e6 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8065e6:	55                   	push   %rbp
+  8065e7:	48 89 e5             	mov    %rsp,%rbp
+  8065ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8065ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8065f2:	eb 2a                	jmp    80661e <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8065f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8065f7:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8065fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065fe:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806601:	89 ce                	mov    %ecx,%esi
+  806603:	48 89 c7             	mov    %rax,%rdi
+  806606:	48 b8 d1 62 80 00 00 	movabs $0x8062d1,%rax
+  80660d:	00 00 00 
+  806610:	ff d0                	call   *%rax
+  806612:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806615:	75 07                	jne    80661e <sem_trywait+0x38>
+      return 0;
+  806617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80661c:	eb 14                	jmp    806632 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80661e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806622:	8b 00                	mov    (%rax),%eax
+  806624:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806627:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80662b:	75 c7                	jne    8065f4 <sem_trywait+0xe>
+  return -E_BUSY;
+  80662d:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806632:	c9                   	leave
+  806633:	c3                   	ret
+
+0000000000806634 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806634:	55                   	push   %rbp
+  806635:	48 89 e5             	mov    %rsp,%rbp
+  806638:	48 83 ec 30          	sub    $0x30,%rsp
+  80663c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806640:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806644:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80664b:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80664c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806651:	0f 84 fb 00 00 00    	je     806752 <sem_timedwait+0x11e>
+  806657:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80665c:	0f 84 f0 00 00 00    	je     806752 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806662:	48 b8 27 59 80 00 00 	movabs $0x805927,%rax
+  806669:	00 00 00 
+  80666c:	ff d0                	call   *%rax
+  80666e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806672:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806676:	48 f7 d0             	not    %rax
+  806679:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80667d:	73 0d                	jae    80668c <sem_timedwait+0x58>
+  80667f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806683:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806687:	48 01 d0             	add    %rdx,%rax
+  80668a:	eb 07                	jmp    806693 <sem_timedwait+0x5f>
+  80668c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  806693:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  806697:	e9 b6 00 00 00       	jmp    806752 <sem_timedwait+0x11e>
+    if (deadline) {
+  80669c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8066a1:	74 2d                	je     8066d0 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8066a3:	48 b8 27 59 80 00 00 	movabs $0x805927,%rax
+  8066aa:	00 00 00 
+  8066ad:	ff d0                	call   *%rax
+  8066af:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8066b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066b7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8066bb:	73 0a                	jae    8066c7 <sem_timedwait+0x93>
+  8066bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066c1:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8066c5:	eb 05                	jmp    8066cc <sem_timedwait+0x98>
+  8066c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066cc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8066d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066d4:	48 83 c0 04          	add    $0x4,%rax
+  8066d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8066dd:	48 89 c7             	mov    %rax,%rdi
+  8066e0:	48 b8 fd 62 80 00 00 	movabs $0x8062fd,%rax
+  8066e7:	00 00 00 
+  8066ea:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8066ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066f0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8066f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8066f9:	48 89 c7             	mov    %rax,%rdi
+  8066fc:	48 b8 15 29 80 00 00 	movabs $0x802915,%rax
+  806703:	00 00 00 
+  806706:	ff d0                	call   *%rax
+  806708:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80670b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80670f:	48 83 c0 04          	add    $0x4,%rax
+  806713:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806718:	48 89 c7             	mov    %rax,%rdi
+  80671b:	48 b8 fd 62 80 00 00 	movabs $0x8062fd,%rax
+  806722:	00 00 00 
+  806725:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806727:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80672b:	75 25                	jne    806752 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80672d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806731:	48 89 c7             	mov    %rax,%rdi
+  806734:	48 b8 e6 65 80 00 00 	movabs $0x8065e6,%rax
+  80673b:	00 00 00 
+  80673e:	ff d0                	call   *%rax
+  806740:	85 c0                	test   %eax,%eax
+  806742:	79 07                	jns    80674b <sem_timedwait+0x117>
+  806744:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806749:	eb 27                	jmp    806772 <sem_timedwait+0x13e>
+  80674b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806750:	eb 20                	jmp    806772 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806752:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806756:	48 89 c7             	mov    %rax,%rdi
+  806759:	48 b8 e6 65 80 00 00 	movabs $0x8065e6,%rax
+  806760:	00 00 00 
+  806763:	ff d0                	call   *%rax
+  806765:	85 c0                	test   %eax,%eax
+  806767:	0f 88 2f ff ff ff    	js     80669c <sem_timedwait+0x68>
+  return 0;
+  80676d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806772:	c9                   	leave
+  806773:	c3                   	ret
+
+0000000000806774 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806774:	55                   	push   %rbp
+  806775:	48 89 e5             	mov    %rsp,%rbp
+  806778:	48 83 ec 10          	sub    $0x10,%rsp
+  80677c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  806780:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806784:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  80678b:	48 89 c7             	mov    %rax,%rdi
+  80678e:	48 b8 34 66 80 00 00 	movabs $0x806634,%rax
+  806795:	00 00 00 
+  806798:	ff d0                	call   *%rax
+}
+  80679a:	90                   	nop
+  80679b:	c9                   	leave
+  80679c:	c3                   	ret
+
+000000000080679d <sem_post>:
+sem_post(struct Semaphore *s) {
+  80679d:	55                   	push   %rbp
+  80679e:	48 89 e5             	mov    %rsp,%rbp
+  8067a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8067a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8067a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8067b2:	48 89 c7             	mov    %rax,%rdi
+  8067b5:	48 b8 fd 62 80 00 00 	movabs $0x8062fd,%rax
+  8067bc:	00 00 00 
+  8067bf:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8067c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067c5:	8b 40 04             	mov    0x4(%rax),%eax
+  8067c8:	85 c0                	test   %eax,%eax
+  8067ca:	74 18                	je     8067e4 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8067cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8067d5:	48 89 c7             	mov    %rax,%rdi
+  8067d8:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  8067df:	00 00 00 
+  8067e2:	ff d0                	call   *%rax
+}
+  8067e4:	90                   	nop
+  8067e5:	c9                   	leave
+  8067e6:	c3                   	ret
+  8067e7:	90                   	nop
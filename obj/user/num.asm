@@ -0,0 +1,8515 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 af 02 00 00       	call   8002db <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <num>:
+
+int bol  = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  long n;
+  int r;
+  char c;
+
+  while ((n = read(f, &c, 1)) > 0) {
+  800041:	e9 e3 00 00 00       	jmp    800129 <num+0xf7>
+    if (bol) {
+  800046:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80004d:	00 00 00 
+  800050:	8b 00                	mov    (%rax),%eax
+  800052:	85 c0                	test   %eax,%eax
+  800054:	74 57                	je     8000ad <num+0x7b>
+      printf("%5d ", ++line);
+  800056:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80005d:	00 00 00 
+  800060:	8b 00                	mov    (%rax),%eax
+  800062:	8d 50 01             	lea    0x1(%rax),%edx
+  800065:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80006c:	00 00 00 
+  80006f:	89 10                	mov    %edx,(%rax)
+  800071:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800078:	00 00 00 
+  80007b:	8b 00                	mov    (%rax),%eax
+  80007d:	89 c6                	mov    %eax,%esi
+  80007f:	48 b8 60 55 80 00 00 	movabs $0x805560,%rax
+  800086:	00 00 00 
+  800089:	48 89 c7             	mov    %rax,%rdi
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	48 ba 95 41 80 00 00 	movabs $0x804195,%rdx
+  800098:	00 00 00 
+  80009b:	ff d2                	call   *%rdx
+      bol = 0;
+  80009d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8000a4:	00 00 00 
+  8000a7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if ((r = write(1, &c, 1)) != 1)
+  8000ad:	48 8d 45 f3          	lea    -0xd(%rbp),%rax
+  8000b1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000b6:	48 89 c6             	mov    %rax,%rsi
+  8000b9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000be:	48 b8 0e 32 80 00 00 	movabs $0x80320e,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+  8000ca:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8000cd:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8000d1:	74 3e                	je     800111 <num+0xdf>
+      panic("write error copying %s: %i", s, r);
+  8000d3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8000d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000da:	41 89 d0             	mov    %edx,%r8d
+  8000dd:	48 89 c1             	mov    %rax,%rcx
+  8000e0:	48 b8 65 55 80 00 00 	movabs $0x805565,%rax
+  8000e7:	00 00 00 
+  8000ea:	48 89 c2             	mov    %rax,%rdx
+  8000ed:	be 12 00 00 00       	mov    $0x12,%esi
+  8000f2:	48 b8 80 55 80 00 00 	movabs $0x805580,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 c7             	mov    %rax,%rdi
+  8000ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800104:	49 b9 82 03 80 00 00 	movabs $0x800382,%r9
+  80010b:	00 00 00 
+  80010e:	41 ff d1             	call   *%r9
+    if (c == '\n')
+  800111:	0f b6 45 f3          	movzbl -0xd(%rbp),%eax
+  800115:	3c 0a                	cmp    $0xa,%al
+  800117:	75 10                	jne    800129 <num+0xf7>
+      bol = 1;
+  800119:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800120:	00 00 00 
+  800123:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  while ((n = read(f, &c, 1)) > 0) {
+  800129:	48 8d 4d f3          	lea    -0xd(%rbp),%rcx
+  80012d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800130:	ba 01 00 00 00       	mov    $0x1,%edx
+  800135:	48 89 ce             	mov    %rcx,%rsi
+  800138:	89 c7                	mov    %eax,%edi
+  80013a:	48 b8 92 30 80 00 00 	movabs $0x803092,%rax
+  800141:	00 00 00 
+  800144:	ff d0                	call   *%rax
+  800146:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80014a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80014f:	0f 8f f1 fe ff ff    	jg     800046 <num+0x14>
+  }
+  if (n < 0)
+  800155:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80015a:	79 41                	jns    80019d <num+0x16b>
+    panic("error reading %s: %i", s, (int)n);
+  80015c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800160:	89 c2                	mov    %eax,%edx
+  800162:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800166:	41 89 d0             	mov    %edx,%r8d
+  800169:	48 89 c1             	mov    %rax,%rcx
+  80016c:	48 b8 8b 55 80 00 00 	movabs $0x80558b,%rax
+  800173:	00 00 00 
+  800176:	48 89 c2             	mov    %rax,%rdx
+  800179:	be 17 00 00 00       	mov    $0x17,%esi
+  80017e:	48 b8 80 55 80 00 00 	movabs $0x805580,%rax
+  800185:	00 00 00 
+  800188:	48 89 c7             	mov    %rax,%rdi
+  80018b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800190:	49 b9 82 03 80 00 00 	movabs $0x800382,%r9
+  800197:	00 00 00 
+  80019a:	41 ff d1             	call   *%r9
+}
+  80019d:	90                   	nop
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+
+00000000008001a0 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8001a0:	55                   	push   %rbp
+  8001a1:	48 89 e5             	mov    %rsp,%rbp
+  8001a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8001a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8001ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int f, i;
+
+  binaryname = "num";
+  8001af:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8001b6:	00 00 00 
+  8001b9:	48 b9 a0 55 80 00 00 	movabs $0x8055a0,%rcx
+  8001c0:	00 00 00 
+  8001c3:	48 89 08             	mov    %rcx,(%rax)
+  if (argc == 1)
+  8001c6:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  8001ca:	75 23                	jne    8001ef <umain+0x4f>
+    num(0, "<stdin>");
+  8001cc:	48 b8 a4 55 80 00 00 	movabs $0x8055a4,%rax
+  8001d3:	00 00 00 
+  8001d6:	48 89 c6             	mov    %rax,%rsi
+  8001d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001de:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+  8001ea:	e9 dd 00 00 00       	jmp    8002cc <umain+0x12c>
+  else
+    for (i = 1; i < argc; i++) {
+  8001ef:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  8001f6:	e9 c5 00 00 00       	jmp    8002c0 <umain+0x120>
+      f = open(argv[i], O_RDONLY);
+  8001fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001fe:	48 98                	cltq
+  800200:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800207:	00 
+  800208:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80020c:	48 01 d0             	add    %rdx,%rax
+  80020f:	48 8b 00             	mov    (%rax),%rax
+  800212:	be 00 00 00 00       	mov    $0x0,%esi
+  800217:	48 89 c7             	mov    %rax,%rdi
+  80021a:	48 b8 fa 39 80 00 00 	movabs $0x8039fa,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+  800226:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      if (f < 0)
+  800229:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80022d:	79 51                	jns    800280 <umain+0xe0>
+        panic("can't open %s: %i", argv[i], f);
+  80022f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800232:	48 98                	cltq
+  800234:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80023b:	00 
+  80023c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800240:	48 01 d0             	add    %rdx,%rax
+  800243:	48 8b 00             	mov    (%rax),%rax
+  800246:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800249:	41 89 d0             	mov    %edx,%r8d
+  80024c:	48 89 c1             	mov    %rax,%rcx
+  80024f:	48 b8 ac 55 80 00 00 	movabs $0x8055ac,%rax
+  800256:	00 00 00 
+  800259:	48 89 c2             	mov    %rax,%rdx
+  80025c:	be 25 00 00 00       	mov    $0x25,%esi
+  800261:	48 b8 80 55 80 00 00 	movabs $0x805580,%rax
+  800268:	00 00 00 
+  80026b:	48 89 c7             	mov    %rax,%rdi
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 82 03 80 00 00 	movabs $0x800382,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+      else {
+        num(f, argv[i]);
+  800280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800283:	48 98                	cltq
+  800285:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80028c:	00 
+  80028d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800291:	48 01 d0             	add    %rdx,%rax
+  800294:	48 8b 10             	mov    (%rax),%rdx
+  800297:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80029a:	48 89 d6             	mov    %rdx,%rsi
+  80029d:	89 c7                	mov    %eax,%edi
+  80029f:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        close(f);
+  8002ab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002ae:	89 c7                	mov    %eax,%edi
+  8002b0:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+    for (i = 1; i < argc; i++) {
+  8002bc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8002c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002c3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  8002c6:	0f 8c 2f ff ff ff    	jl     8001fb <umain+0x5b>
+      }
+    }
+  exit();
+  8002cc:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+}
+  8002d8:	90                   	nop
+  8002d9:	c9                   	leave
+  8002da:	c3                   	ret
+
+00000000008002db <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002db:	55                   	push   %rbp
+  8002dc:	48 89 e5             	mov    %rsp,%rbp
+  8002df:	48 83 ec 20          	sub    $0x20,%rsp
+  8002e3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002e6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8002ea:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8002f1:	00 00 00 
+  8002f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8002f8:	eb 13                	jmp    80030d <libmain+0x32>
+    (*ctor)();
+  8002fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002fe:	48 8b 10             	mov    (%rax),%rdx
+  800301:	b8 00 00 00 00       	mov    $0x0,%eax
+  800306:	ff d2                	call   *%rdx
+    ctor++;
+  800308:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80030d:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800314:	00 00 00 
+  800317:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80031b:	72 dd                	jb     8002fa <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80031d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800321:	7e 14                	jle    800337 <libmain+0x5c>
+    binaryname = argv[0];
+  800323:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800327:	48 8b 00             	mov    (%rax),%rax
+  80032a:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800331:	00 00 00 
+  800334:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800337:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80033b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80033e:	48 89 d6             	mov    %rdx,%rsi
+  800341:	89 c7                	mov    %eax,%edi
+  800343:	48 b8 a0 01 80 00 00 	movabs $0x8001a0,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80034f:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  800356:	00 00 00 
+  800359:	ff d0                	call   *%rax
+#endif
+}
+  80035b:	90                   	nop
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+
+000000000080035e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80035e:	55                   	push   %rbp
+  80035f:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800362:	48 b8 f6 2d 80 00 00 	movabs $0x802df6,%rax
+  800369:	00 00 00 
+  80036c:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80036e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800373:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+}
+  80037f:	90                   	nop
+  800380:	5d                   	pop    %rbp
+  800381:	c3                   	ret
+
+0000000000800382 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	53                   	push   %rbx
+  800387:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80038e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800395:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80039b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8003a2:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8003a9:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8003b0:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8003b7:	84 c0                	test   %al,%al
+  8003b9:	74 23                	je     8003de <_panic+0x5c>
+  8003bb:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8003c2:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8003c6:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8003ca:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8003ce:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8003d2:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8003d6:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8003da:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003de:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8003e5:	00 00 00 
+  8003e8:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8003ef:	00 00 00 
+  8003f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8003fd:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800404:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80040b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800412:	00 00 00 
+  800415:	48 8b 18             	mov    (%rax),%rbx
+  800418:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  80041f:	00 00 00 
+  800422:	ff d0                	call   *%rax
+  800424:	89 c6                	mov    %eax,%esi
+  800426:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80042c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800433:	41 89 d0             	mov    %edx,%r8d
+  800436:	48 89 c1             	mov    %rax,%rcx
+  800439:	48 89 da             	mov    %rbx,%rdx
+  80043c:	48 b8 c8 55 80 00 00 	movabs $0x8055c8,%rax
+  800443:	00 00 00 
+  800446:	48 89 c7             	mov    %rax,%rdi
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	49 b9 a1 05 80 00 00 	movabs $0x8005a1,%r9
+  800455:	00 00 00 
+  800458:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80045b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800462:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800469:	48 89 d6             	mov    %rdx,%rsi
+  80046c:	48 89 c7             	mov    %rax,%rdi
+  80046f:	48 b8 16 05 80 00 00 	movabs $0x800516,%rax
+  800476:	00 00 00 
+  800479:	ff d0                	call   *%rax
+  cprintf("\n");
+  80047b:	48 b8 eb 55 80 00 00 	movabs $0x8055eb,%rax
+  800482:	00 00 00 
+  800485:	48 89 c7             	mov    %rax,%rdi
+  800488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048d:	48 ba a1 05 80 00 00 	movabs $0x8005a1,%rdx
+  800494:	00 00 00 
+  800497:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800499:	cc                   	int3
+  80049a:	eb fd                	jmp    800499 <_panic+0x117>
+
+000000000080049c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80049c:	55                   	push   %rbp
+  80049d:	48 89 e5             	mov    %rsp,%rbp
+  8004a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8004a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004a7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8004ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004af:	8b 00                	mov    (%rax),%eax
+  8004b1:	8d 48 01             	lea    0x1(%rax),%ecx
+  8004b4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004b8:	89 0a                	mov    %ecx,(%rdx)
+  8004ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8004bd:	89 d1                	mov    %edx,%ecx
+  8004bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004c3:	48 98                	cltq
+  8004c5:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8004c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004cd:	8b 00                	mov    (%rax),%eax
+  8004cf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004d4:	75 2c                	jne    800502 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8004d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004da:	8b 00                	mov    (%rax),%eax
+  8004dc:	48 98                	cltq
+  8004de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004e2:	48 83 c2 08          	add    $0x8,%rdx
+  8004e6:	48 89 c6             	mov    %rax,%rsi
+  8004e9:	48 89 d7             	mov    %rdx,%rdi
+  8004ec:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  8004f3:	00 00 00 
+  8004f6:	ff d0                	call   *%rax
+    b->idx = 0;
+  8004f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004fc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800502:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800506:	8b 40 04             	mov    0x4(%rax),%eax
+  800509:	8d 50 01             	lea    0x1(%rax),%edx
+  80050c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800510:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800513:	90                   	nop
+  800514:	c9                   	leave
+  800515:	c3                   	ret
+
+0000000000800516 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800516:	55                   	push   %rbp
+  800517:	48 89 e5             	mov    %rsp,%rbp
+  80051a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800521:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800528:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80052f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800536:	00 00 00 
+  b.cnt = 0;
+  800539:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800540:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800543:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80054a:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800551:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800558:	48 89 c6             	mov    %rax,%rsi
+  80055b:	48 b8 9c 04 80 00 00 	movabs $0x80049c,%rax
+  800562:	00 00 00 
+  800565:	48 89 c7             	mov    %rax,%rdi
+  800568:	48 b8 fb 08 80 00 00 	movabs $0x8008fb,%rax
+  80056f:	00 00 00 
+  800572:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800574:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80057a:	48 98                	cltq
+  80057c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800583:	48 83 c2 08          	add    $0x8,%rdx
+  800587:	48 89 c6             	mov    %rax,%rsi
+  80058a:	48 89 d7             	mov    %rdx,%rdi
+  80058d:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  800594:	00 00 00 
+  800597:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800599:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80059f:	c9                   	leave
+  8005a0:	c3                   	ret
+
+00000000008005a1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005a1:	55                   	push   %rbp
+  8005a2:	48 89 e5             	mov    %rsp,%rbp
+  8005a5:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8005ac:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8005b3:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8005ba:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8005c1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8005c8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8005cf:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8005d6:	84 c0                	test   %al,%al
+  8005d8:	74 20                	je     8005fa <cprintf+0x59>
+  8005da:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8005de:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8005e2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8005e6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8005ea:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8005ee:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8005f2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8005f6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8005fa:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800601:	00 00 00 
+  800604:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80060b:	00 00 00 
+  80060e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800612:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800619:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800620:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800627:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80062e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800635:	48 89 d6             	mov    %rdx,%rsi
+  800638:	48 89 c7             	mov    %rax,%rdi
+  80063b:	48 b8 16 05 80 00 00 	movabs $0x800516,%rax
+  800642:	00 00 00 
+  800645:	ff d0                	call   *%rax
+  800647:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80064d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800653:	c9                   	leave
+  800654:	c3                   	ret
+
+0000000000800655 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	48 83 ec 30          	sub    $0x30,%rsp
+  80065d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800661:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800665:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800669:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80066c:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800670:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800674:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800677:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80067b:	72 54                	jb     8006d1 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80067d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800680:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800683:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800686:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068f:	48 f7 f6             	div    %rsi
+  800692:	49 89 c2             	mov    %rax,%r10
+  800695:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800698:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80069b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80069f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a3:	41 89 c9             	mov    %ecx,%r9d
+  8006a6:	41 89 f8             	mov    %edi,%r8d
+  8006a9:	89 d1                	mov    %edx,%ecx
+  8006ab:	4c 89 d2             	mov    %r10,%rdx
+  8006ae:	48 89 c7             	mov    %rax,%rdi
+  8006b1:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+  8006bd:	eb 1c                	jmp    8006db <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8006bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8006c6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8006ca:	48 89 d6             	mov    %rdx,%rsi
+  8006cd:	89 c7                	mov    %eax,%edi
+  8006cf:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8006d1:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8006d5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8006d9:	7f e4                	jg     8006bf <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8006db:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8006de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e7:	48 f7 f1             	div    %rcx
+  8006ea:	48 b8 30 58 80 00 00 	movabs $0x805830,%rax
+  8006f1:	00 00 00 
+  8006f4:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8006f8:	0f be c0             	movsbl %al,%eax
+  8006fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006ff:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800703:	48 89 d6             	mov    %rdx,%rsi
+  800706:	89 c7                	mov    %eax,%edi
+  800708:	ff d1                	call   *%rcx
+}
+  80070a:	90                   	nop
+  80070b:	c9                   	leave
+  80070c:	c3                   	ret
+
+000000000080070d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80070d:	55                   	push   %rbp
+  80070e:	48 89 e5             	mov    %rsp,%rbp
+  800711:	48 83 ec 10          	sub    $0x10,%rsp
+  800715:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800719:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80071c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800720:	7e 4b                	jle    80076d <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800722:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800726:	8b 00                	mov    (%rax),%eax
+  800728:	83 f8 2f             	cmp    $0x2f,%eax
+  80072b:	77 24                	ja     800751 <getuint+0x44>
+  80072d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800731:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800739:	8b 00                	mov    (%rax),%eax
+  80073b:	89 c0                	mov    %eax,%eax
+  80073d:	48 01 d0             	add    %rdx,%rax
+  800740:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800744:	8b 12                	mov    (%rdx),%edx
+  800746:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800749:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80074d:	89 0a                	mov    %ecx,(%rdx)
+  80074f:	eb 14                	jmp    800765 <getuint+0x58>
+  800751:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800755:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800759:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80075d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800761:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800765:	48 8b 00             	mov    (%rax),%rax
+  800768:	e9 95 00 00 00       	jmp    800802 <getuint+0xf5>
+  else if (lflag)
+  80076d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800771:	74 48                	je     8007bb <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800777:	8b 00                	mov    (%rax),%eax
+  800779:	83 f8 2f             	cmp    $0x2f,%eax
+  80077c:	77 24                	ja     8007a2 <getuint+0x95>
+  80077e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800782:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078a:	8b 00                	mov    (%rax),%eax
+  80078c:	89 c0                	mov    %eax,%eax
+  80078e:	48 01 d0             	add    %rdx,%rax
+  800791:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800795:	8b 12                	mov    (%rdx),%edx
+  800797:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80079a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80079e:	89 0a                	mov    %ecx,(%rdx)
+  8007a0:	eb 14                	jmp    8007b6 <getuint+0xa9>
+  8007a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007aa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007b2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007b6:	48 8b 00             	mov    (%rax),%rax
+  8007b9:	eb 47                	jmp    800802 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8007bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007bf:	8b 00                	mov    (%rax),%eax
+  8007c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c4:	77 24                	ja     8007ea <getuint+0xdd>
+  8007c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d2:	8b 00                	mov    (%rax),%eax
+  8007d4:	89 c0                	mov    %eax,%eax
+  8007d6:	48 01 d0             	add    %rdx,%rax
+  8007d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007dd:	8b 12                	mov    (%rdx),%edx
+  8007df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007e6:	89 0a                	mov    %ecx,(%rdx)
+  8007e8:	eb 14                	jmp    8007fe <getuint+0xf1>
+  8007ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007fe:	8b 00                	mov    (%rax),%eax
+  800800:	89 c0                	mov    %eax,%eax
+}
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+
+0000000000800804 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800804:	55                   	push   %rbp
+  800805:	48 89 e5             	mov    %rsp,%rbp
+  800808:	48 83 ec 10          	sub    $0x10,%rsp
+  80080c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800810:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800813:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800817:	7e 4b                	jle    800864 <getint+0x60>
+    return va_arg(*ap, long long);
+  800819:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081d:	8b 00                	mov    (%rax),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 24                	ja     800848 <getint+0x44>
+  800824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800828:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80082c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800830:	8b 00                	mov    (%rax),%eax
+  800832:	89 c0                	mov    %eax,%eax
+  800834:	48 01 d0             	add    %rdx,%rax
+  800837:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80083b:	8b 12                	mov    (%rdx),%edx
+  80083d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800840:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800844:	89 0a                	mov    %ecx,(%rdx)
+  800846:	eb 14                	jmp    80085c <getint+0x58>
+  800848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80084c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800850:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800854:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800858:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80085c:	48 8b 00             	mov    (%rax),%rax
+  80085f:	e9 95 00 00 00       	jmp    8008f9 <getint+0xf5>
+  else if (lflag)
+  800864:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800868:	74 48                	je     8008b2 <getint+0xae>
+    return va_arg(*ap, long);
+  80086a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086e:	8b 00                	mov    (%rax),%eax
+  800870:	83 f8 2f             	cmp    $0x2f,%eax
+  800873:	77 24                	ja     800899 <getint+0x95>
+  800875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800879:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80087d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800881:	8b 00                	mov    (%rax),%eax
+  800883:	89 c0                	mov    %eax,%eax
+  800885:	48 01 d0             	add    %rdx,%rax
+  800888:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80088c:	8b 12                	mov    (%rdx),%edx
+  80088e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800891:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800895:	89 0a                	mov    %ecx,(%rdx)
+  800897:	eb 14                	jmp    8008ad <getint+0xa9>
+  800899:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80089d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008a1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008ad:	48 8b 00             	mov    (%rax),%rax
+  8008b0:	eb 47                	jmp    8008f9 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8008b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b6:	8b 00                	mov    (%rax),%eax
+  8008b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bb:	77 24                	ja     8008e1 <getint+0xdd>
+  8008bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c9:	8b 00                	mov    (%rax),%eax
+  8008cb:	89 c0                	mov    %eax,%eax
+  8008cd:	48 01 d0             	add    %rdx,%rax
+  8008d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d4:	8b 12                	mov    (%rdx),%edx
+  8008d6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008dd:	89 0a                	mov    %ecx,(%rdx)
+  8008df:	eb 14                	jmp    8008f5 <getint+0xf1>
+  8008e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008e9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008f1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008f5:	8b 00                	mov    (%rax),%eax
+  8008f7:	48 98                	cltq
+}
+  8008f9:	c9                   	leave
+  8008fa:	c3                   	ret
+
+00000000008008fb <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8008fb:	55                   	push   %rbp
+  8008fc:	48 89 e5             	mov    %rsp,%rbp
+  8008ff:	41 54                	push   %r12
+  800901:	53                   	push   %rbx
+  800902:	48 83 ec 60          	sub    $0x60,%rsp
+  800906:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80090a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80090e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800912:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800916:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80091a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80091e:	48 8b 06             	mov    (%rsi),%rax
+  800921:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800925:	48 89 01             	mov    %rax,(%rcx)
+  800928:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80092c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800930:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800934:	eb 17                	jmp    80094d <vprintfmt+0x52>
+      if (ch == '\0')
+  800936:	85 db                	test   %ebx,%ebx
+  800938:	0f 84 bf 04 00 00    	je     800dfd <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80093e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800942:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800946:	48 89 c6             	mov    %rax,%rsi
+  800949:	89 df                	mov    %ebx,%edi
+  80094b:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80094d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800951:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800955:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800959:	0f b6 00             	movzbl (%rax),%eax
+  80095c:	0f b6 d8             	movzbl %al,%ebx
+  80095f:	83 fb 25             	cmp    $0x25,%ebx
+  800962:	75 d2                	jne    800936 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800964:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800968:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80096f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800976:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80097d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800984:	eb 04                	jmp    80098a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800986:	90                   	nop
+  800987:	eb 01                	jmp    80098a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800989:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80098a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80098e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800992:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800996:	0f b6 00             	movzbl (%rax),%eax
+  800999:	0f b6 d8             	movzbl %al,%ebx
+  80099c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80099f:	83 f8 55             	cmp    $0x55,%eax
+  8009a2:	0f 87 22 04 00 00    	ja     800dca <vprintfmt+0x4cf>
+  8009a8:	89 c0                	mov    %eax,%eax
+  8009aa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009b1:	00 
+  8009b2:	48 b8 58 58 80 00 00 	movabs $0x805858,%rax
+  8009b9:	00 00 00 
+  8009bc:	48 01 d0             	add    %rdx,%rax
+  8009bf:	48 8b 00             	mov    (%rax),%rax
+  8009c2:	ff e0                	jmp    *%rax
+        padc = '-';
+  8009c4:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8009c8:	eb c0                	jmp    80098a <vprintfmt+0x8f>
+        padc = '0';
+  8009ca:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8009ce:	eb ba                	jmp    80098a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8009d0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8009d7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8009da:	89 d0                	mov    %edx,%eax
+  8009dc:	c1 e0 02             	shl    $0x2,%eax
+  8009df:	01 d0                	add    %edx,%eax
+  8009e1:	01 c0                	add    %eax,%eax
+  8009e3:	01 d8                	add    %ebx,%eax
+  8009e5:	83 e8 30             	sub    $0x30,%eax
+  8009e8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8009eb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009ef:	0f b6 00             	movzbl (%rax),%eax
+  8009f2:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8009f5:	83 fb 2f             	cmp    $0x2f,%ebx
+  8009f8:	7e 60                	jle    800a5a <vprintfmt+0x15f>
+  8009fa:	83 fb 39             	cmp    $0x39,%ebx
+  8009fd:	7f 5b                	jg     800a5a <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8009ff:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a04:	eb d1                	jmp    8009d7 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a09:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0c:	77 17                	ja     800a25 <vprintfmt+0x12a>
+  800a0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a12:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a15:	89 d2                	mov    %edx,%edx
+  800a17:	48 01 d0             	add    %rdx,%rax
+  800a1a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a1d:	83 c2 08             	add    $0x8,%edx
+  800a20:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a23:	eb 0c                	jmp    800a31 <vprintfmt+0x136>
+  800a25:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a29:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a2d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a31:	8b 00                	mov    (%rax),%eax
+  800a33:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800a36:	eb 23                	jmp    800a5b <vprintfmt+0x160>
+        if (width < 0)
+  800a38:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a3c:	0f 89 44 ff ff ff    	jns    800986 <vprintfmt+0x8b>
+          width = 0;
+  800a42:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800a49:	e9 38 ff ff ff       	jmp    800986 <vprintfmt+0x8b>
+        altflag = 1;
+  800a4e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800a55:	e9 30 ff ff ff       	jmp    80098a <vprintfmt+0x8f>
+        goto process_precision;
+  800a5a:	90                   	nop
+        if (width < 0)
+  800a5b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a5f:	0f 89 24 ff ff ff    	jns    800989 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800a65:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a68:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800a6b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800a72:	e9 12 ff ff ff       	jmp    800989 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800a77:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800a7b:	e9 0a ff ff ff       	jmp    80098a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 17                	ja     800a9f <vprintfmt+0x1a4>
+  800a88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a8c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a8f:	89 d2                	mov    %edx,%edx
+  800a91:	48 01 d0             	add    %rdx,%rax
+  800a94:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a97:	83 c2 08             	add    $0x8,%edx
+  800a9a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a9d:	eb 0c                	jmp    800aab <vprintfmt+0x1b0>
+  800a9f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800aa3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800aa7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aab:	8b 00                	mov    (%rax),%eax
+  800aad:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800ab1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ab5:	48 89 d6             	mov    %rdx,%rsi
+  800ab8:	89 c7                	mov    %eax,%edi
+  800aba:	ff d1                	call   *%rcx
+        break;
+  800abc:	e9 37 03 00 00       	jmp    800df8 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800ac1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac7:	77 17                	ja     800ae0 <vprintfmt+0x1e5>
+  800ac9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800acd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ad0:	89 d2                	mov    %edx,%edx
+  800ad2:	48 01 d0             	add    %rdx,%rax
+  800ad5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ad8:	83 c2 08             	add    $0x8,%edx
+  800adb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ade:	eb 0c                	jmp    800aec <vprintfmt+0x1f1>
+  800ae0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ae4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ae8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aec:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800aee:	85 db                	test   %ebx,%ebx
+  800af0:	79 02                	jns    800af4 <vprintfmt+0x1f9>
+          err = -err;
+  800af2:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800af4:	83 fb 15             	cmp    $0x15,%ebx
+  800af7:	7f 16                	jg     800b0f <vprintfmt+0x214>
+  800af9:	48 ba 80 57 80 00 00 	movabs $0x805780,%rdx
+  800b00:	00 00 00 
+  800b03:	48 63 c3             	movslq %ebx,%rax
+  800b06:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b0a:	4d 85 e4             	test   %r12,%r12
+  800b0d:	75 2e                	jne    800b3d <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b0f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b13:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b17:	89 d9                	mov    %ebx,%ecx
+  800b19:	48 ba 41 58 80 00 00 	movabs $0x805841,%rdx
+  800b20:	00 00 00 
+  800b23:	48 89 c7             	mov    %rax,%rdi
+  800b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2b:	49 b8 07 0e 80 00 00 	movabs $0x800e07,%r8
+  800b32:	00 00 00 
+  800b35:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800b38:	e9 bb 02 00 00       	jmp    800df8 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800b3d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b41:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b45:	4c 89 e1             	mov    %r12,%rcx
+  800b48:	48 ba 4a 58 80 00 00 	movabs $0x80584a,%rdx
+  800b4f:	00 00 00 
+  800b52:	48 89 c7             	mov    %rax,%rdi
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	49 b8 07 0e 80 00 00 	movabs $0x800e07,%r8
+  800b61:	00 00 00 
+  800b64:	41 ff d0             	call   *%r8
+        break;
+  800b67:	e9 8c 02 00 00       	jmp    800df8 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800b6c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b72:	77 17                	ja     800b8b <vprintfmt+0x290>
+  800b74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b78:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b7b:	89 d2                	mov    %edx,%edx
+  800b7d:	48 01 d0             	add    %rdx,%rax
+  800b80:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b83:	83 c2 08             	add    $0x8,%edx
+  800b86:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b89:	eb 0c                	jmp    800b97 <vprintfmt+0x29c>
+  800b8b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b8f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b93:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b97:	4c 8b 20             	mov    (%rax),%r12
+  800b9a:	4d 85 e4             	test   %r12,%r12
+  800b9d:	75 0a                	jne    800ba9 <vprintfmt+0x2ae>
+          p = "(null)";
+  800b9f:	49 bc 4d 58 80 00 00 	movabs $0x80584d,%r12
+  800ba6:	00 00 00 
+        if (width > 0 && padc != '-')
+  800ba9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bad:	7e 78                	jle    800c27 <vprintfmt+0x32c>
+  800baf:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800bb3:	74 72                	je     800c27 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800bb5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800bb8:	48 98                	cltq
+  800bba:	48 89 c6             	mov    %rax,%rsi
+  800bbd:	4c 89 e7             	mov    %r12,%rdi
+  800bc0:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  800bc7:	00 00 00 
+  800bca:	ff d0                	call   *%rax
+  800bcc:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800bcf:	eb 17                	jmp    800be8 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800bd1:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800bd5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800bd9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800bdd:	48 89 d6             	mov    %rdx,%rsi
+  800be0:	89 c7                	mov    %eax,%edi
+  800be2:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800be4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800be8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bec:	7f e3                	jg     800bd1 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bee:	eb 37                	jmp    800c27 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800bf0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bf4:	74 1e                	je     800c14 <vprintfmt+0x319>
+  800bf6:	83 fb 1f             	cmp    $0x1f,%ebx
+  800bf9:	7e 05                	jle    800c00 <vprintfmt+0x305>
+  800bfb:	83 fb 7e             	cmp    $0x7e,%ebx
+  800bfe:	7e 14                	jle    800c14 <vprintfmt+0x319>
+            putch('?', putdat);
+  800c00:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c04:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c08:	48 89 c6             	mov    %rax,%rsi
+  800c0b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c10:	ff d2                	call   *%rdx
+  800c12:	eb 0f                	jmp    800c23 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800c14:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c18:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c1c:	48 89 c6             	mov    %rax,%rsi
+  800c1f:	89 df                	mov    %ebx,%edi
+  800c21:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c23:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c27:	4c 89 e0             	mov    %r12,%rax
+  800c2a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c2e:	0f b6 00             	movzbl (%rax),%eax
+  800c31:	0f be d8             	movsbl %al,%ebx
+  800c34:	85 db                	test   %ebx,%ebx
+  800c36:	74 28                	je     800c60 <vprintfmt+0x365>
+  800c38:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c3c:	78 b2                	js     800bf0 <vprintfmt+0x2f5>
+  800c3e:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800c42:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c46:	79 a8                	jns    800bf0 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800c48:	eb 16                	jmp    800c60 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800c4a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c4e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c52:	48 89 c6             	mov    %rax,%rsi
+  800c55:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c5a:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800c5c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c64:	7f e4                	jg     800c4a <vprintfmt+0x34f>
+        break;
+  800c66:	e9 8d 01 00 00       	jmp    800df8 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800c6b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c6e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c72:	89 d6                	mov    %edx,%esi
+  800c74:	48 89 c7             	mov    %rax,%rdi
+  800c77:	48 b8 04 08 80 00 00 	movabs $0x800804,%rax
+  800c7e:	00 00 00 
+  800c81:	ff d0                	call   *%rax
+  800c83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800c87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8b:	48 85 c0             	test   %rax,%rax
+  800c8e:	79 1d                	jns    800cad <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800c90:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c94:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c98:	48 89 c6             	mov    %rax,%rsi
+  800c9b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ca0:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800ca2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca6:	48 f7 d8             	neg    %rax
+  800ca9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800cad:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800cb4:	e9 d2 00 00 00       	jmp    800d8b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800cb9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cbc:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cc0:	89 d6                	mov    %edx,%esi
+  800cc2:	48 89 c7             	mov    %rax,%rdi
+  800cc5:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800ccc:	00 00 00 
+  800ccf:	ff d0                	call   *%rax
+  800cd1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800cd5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800cdc:	e9 aa 00 00 00       	jmp    800d8b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800ce1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ce4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ce8:	89 d6                	mov    %edx,%esi
+  800cea:	48 89 c7             	mov    %rax,%rdi
+  800ced:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800cf4:	00 00 00 
+  800cf7:	ff d0                	call   *%rax
+  800cf9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800cfd:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d04:	e9 82 00 00 00       	jmp    800d8b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d09:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d0d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d11:	48 89 c6             	mov    %rax,%rsi
+  800d14:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d19:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800d1b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d1f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d23:	48 89 c6             	mov    %rax,%rsi
+  800d26:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d2b:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d30:	83 f8 2f             	cmp    $0x2f,%eax
+  800d33:	77 17                	ja     800d4c <vprintfmt+0x451>
+  800d35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d39:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d3c:	89 d2                	mov    %edx,%edx
+  800d3e:	48 01 d0             	add    %rdx,%rax
+  800d41:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d44:	83 c2 08             	add    $0x8,%edx
+  800d47:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d4a:	eb 0c                	jmp    800d58 <vprintfmt+0x45d>
+  800d4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d50:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d54:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d58:	48 8b 00             	mov    (%rax),%rax
+  800d5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d5f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800d66:	eb 23                	jmp    800d8b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800d68:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d6b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d6f:	89 d6                	mov    %edx,%esi
+  800d71:	48 89 c7             	mov    %rax,%rdi
+  800d74:	48 b8 0d 07 80 00 00 	movabs $0x80070d,%rax
+  800d7b:	00 00 00 
+  800d7e:	ff d0                	call   *%rax
+  800d80:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d84:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800d8b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800d90:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800d93:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800d96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d9a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d9e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800da2:	45 89 c1             	mov    %r8d,%r9d
+  800da5:	41 89 f8             	mov    %edi,%r8d
+  800da8:	48 89 c7             	mov    %rax,%rdi
+  800dab:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  800db2:	00 00 00 
+  800db5:	ff d0                	call   *%rax
+        break;
+  800db7:	eb 3f                	jmp    800df8 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800db9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dbd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dc1:	48 89 c6             	mov    %rax,%rsi
+  800dc4:	89 df                	mov    %ebx,%edi
+  800dc6:	ff d2                	call   *%rdx
+        break;
+  800dc8:	eb 2e                	jmp    800df8 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800dca:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dd2:	48 89 c6             	mov    %rax,%rsi
+  800dd5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dda:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800ddc:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800de1:	eb 05                	jmp    800de8 <vprintfmt+0x4ed>
+  800de3:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800de8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dec:	48 83 e8 01          	sub    $0x1,%rax
+  800df0:	0f b6 00             	movzbl (%rax),%eax
+  800df3:	3c 25                	cmp    $0x25,%al
+  800df5:	75 ec                	jne    800de3 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800df7:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800df8:	e9 50 fb ff ff       	jmp    80094d <vprintfmt+0x52>
+        return;
+  800dfd:	90                   	nop
+    }
+  }
+}
+  800dfe:	48 83 c4 60          	add    $0x60,%rsp
+  800e02:	5b                   	pop    %rbx
+  800e03:	41 5c                	pop    %r12
+  800e05:	5d                   	pop    %rbp
+  800e06:	c3                   	ret
+
+0000000000800e07 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+  800e0b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e12:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e19:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e20:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e27:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e2e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e35:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e3c:	84 c0                	test   %al,%al
+  800e3e:	74 20                	je     800e60 <printfmt+0x59>
+  800e40:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e44:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e48:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e4c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e50:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e54:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e58:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e5c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800e60:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800e67:	00 00 00 
+  800e6a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800e71:	00 00 00 
+  800e74:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e78:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800e7f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e86:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800e8d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800e94:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e9b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800ea2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ea9:	48 89 c7             	mov    %rax,%rdi
+  800eac:	48 b8 fb 08 80 00 00 	movabs $0x8008fb,%rax
+  800eb3:	00 00 00 
+  800eb6:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800eb8:	90                   	nop
+  800eb9:	c9                   	leave
+  800eba:	c3                   	ret
+
+0000000000800ebb <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800ebb:	55                   	push   %rbp
+  800ebc:	48 89 e5             	mov    %rsp,%rbp
+  800ebf:	48 83 ec 10          	sub    $0x10,%rsp
+  800ec3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ec6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ece:	8b 40 10             	mov    0x10(%rax),%eax
+  800ed1:	8d 50 01             	lea    0x1(%rax),%edx
+  800ed4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ed8:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800edb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800edf:	48 8b 10             	mov    (%rax),%rdx
+  800ee2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ee6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800eea:	48 39 c2             	cmp    %rax,%rdx
+  800eed:	73 17                	jae    800f06 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800eef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ef3:	48 8b 00             	mov    (%rax),%rax
+  800ef6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800efa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800efe:	48 89 0a             	mov    %rcx,(%rdx)
+  800f01:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f04:	88 10                	mov    %dl,(%rax)
+}
+  800f06:	90                   	nop
+  800f07:	c9                   	leave
+  800f08:	c3                   	ret
+
+0000000000800f09 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f09:	55                   	push   %rbp
+  800f0a:	48 89 e5             	mov    %rsp,%rbp
+  800f0d:	48 83 ec 40          	sub    $0x40,%rsp
+  800f11:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800f15:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800f18:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f1c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f24:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f28:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f2b:	48 98                	cltq
+  800f2d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f35:	48 01 d0             	add    %rdx,%rax
+  800f38:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f3c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800f43:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f48:	74 06                	je     800f50 <vsnprintf+0x47>
+  800f4a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800f4e:	7f 07                	jg     800f57 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800f50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f55:	eb 32                	jmp    800f89 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800f57:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f5b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800f5f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800f63:	48 89 c6             	mov    %rax,%rsi
+  800f66:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  800f6d:	00 00 00 
+  800f70:	48 89 c7             	mov    %rax,%rdi
+  800f73:	48 b8 fb 08 80 00 00 	movabs $0x8008fb,%rax
+  800f7a:	00 00 00 
+  800f7d:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800f7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f83:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800f86:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f89:	c9                   	leave
+  800f8a:	c3                   	ret
+
+0000000000800f8b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800f8b:	55                   	push   %rbp
+  800f8c:	48 89 e5             	mov    %rsp,%rbp
+  800f8f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f96:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f9d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800fa3:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800faa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800fb1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800fb8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800fbf:	84 c0                	test   %al,%al
+  800fc1:	74 20                	je     800fe3 <snprintf+0x58>
+  800fc3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fc7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fcb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fcf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fd3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fd7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fdb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fdf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800fe3:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800fea:	00 00 00 
+  800fed:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ff4:	00 00 00 
+  800ff7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ffb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801002:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801009:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801010:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801017:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80101e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801024:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80102b:	48 89 c7             	mov    %rax,%rdi
+  80102e:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  801035:	00 00 00 
+  801038:	ff d0                	call   *%rax
+  80103a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801040:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801046:	c9                   	leave
+  801047:	c3                   	ret
+
+0000000000801048 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801048:	55                   	push   %rbp
+  801049:	48 89 e5             	mov    %rsp,%rbp
+  80104c:	53                   	push   %rbx
+  80104d:	48 83 ec 38          	sub    $0x38,%rsp
+  801051:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801054:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801058:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80105c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801060:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801064:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801067:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106c:	89 d1                	mov    %edx,%ecx
+  80106e:	0f a2                	cpuid
+  801070:	89 de                	mov    %ebx,%esi
+  801072:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801075:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801078:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80107b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  80107e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801083:	74 09                	je     80108e <cpuid+0x46>
+}
+  801085:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801089:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80108c:	89 10                	mov    %edx,(%rax)
+
+  80108e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801093:	74 09                	je     80109e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801095:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801099:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80109c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80109e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010a3:	74 09                	je     8010ae <cpuid+0x66>
+char *
+  8010a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010a9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8010ac:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8010ae:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8010b3:	74 09                	je     8010be <cpuid+0x76>
+  for (; *s; s++)
+  8010b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010b9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8010bc:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  8010be:	90                   	nop
+  8010bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c3:	c9                   	leave
+  8010c4:	c3                   	ret
+
+00000000008010c5 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8010cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  8010d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010d3:	89 c1                	mov    %eax,%ecx
+  8010d5:	0f 01 d0             	xgetbv
+  8010d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010db:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8010de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010e1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8010e4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8010e8:	48 09 d0             	or     %rdx,%rax
+#else
+  8010eb:	c9                   	leave
+  8010ec:	c3                   	ret
+
+00000000008010ed <string_cpu>:
+string_cpu(void) {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8010f5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8010fc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801103:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80110a:	00 00 00 
+  80110d:	8b 00                	mov    (%rax),%eax
+  80110f:	85 c0                	test   %eax,%eax
+  801111:	78 11                	js     801124 <string_cpu+0x37>
+    return string_features;
+  801113:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80111a:	00 00 00 
+  80111d:	8b 00                	mov    (%rax),%eax
+  80111f:	e9 df 00 00 00       	jmp    801203 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801124:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801128:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80112e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801133:	ba 00 00 00 00       	mov    $0x0,%edx
+  801138:	48 89 c6             	mov    %rax,%rsi
+  80113b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801140:	48 b8 48 10 80 00 00 	movabs $0x801048,%rax
+  801147:	00 00 00 
+  80114a:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  80114c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80114f:	83 f8 06             	cmp    $0x6,%eax
+  801152:	76 28                	jbe    80117c <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801154:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80115e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801163:	48 89 c2             	mov    %rax,%rdx
+  801166:	be 00 00 00 00       	mov    $0x0,%esi
+  80116b:	bf 07 00 00 00       	mov    $0x7,%edi
+  801170:	48 b8 48 10 80 00 00 	movabs $0x801048,%rax
+  801177:	00 00 00 
+  80117a:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80117c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80117f:	25 00 02 00 00       	and    $0x200,%eax
+  801184:	85 c0                	test   %eax,%eax
+  801186:	74 04                	je     80118c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801188:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80118c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801196:	48 89 c1             	mov    %rax,%rcx
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119e:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011a8:	48 b8 48 10 80 00 00 	movabs $0x801048,%rax
+  8011af:	00 00 00 
+  8011b2:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8011b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011b7:	83 e0 20             	and    $0x20,%eax
+  8011ba:	85 c0                	test   %eax,%eax
+  8011bc:	74 2a                	je     8011e8 <string_cpu+0xfb>
+  8011be:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8011c1:	25 00 00 00 08       	and    $0x8000000,%eax
+  8011c6:	85 c0                	test   %eax,%eax
+  8011c8:	74 1e                	je     8011e8 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8011ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011cf:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+  8011db:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8011de:	48 83 f8 06          	cmp    $0x6,%rax
+  8011e2:	75 04                	jne    8011e8 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8011e4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8011e8:	48 ba 10 60 80 00 00 	movabs $0x806010,%rdx
+  8011ef:	00 00 00 
+  8011f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011f5:	89 02                	mov    %eax,(%rdx)
+  8011f7:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  8011fe:	00 00 00 
+  801201:	8b 00                	mov    (%rax),%eax
+}
+  801203:	c9                   	leave
+  801204:	c3                   	ret
+
+0000000000801205 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+  801209:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80120d:	48 83 ec 60          	sub    $0x60,%rsp
+  801211:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801216:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80121b:	83 e0 1f             	and    $0x1f,%eax
+  80121e:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801222:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801226:	48 f7 d8             	neg    %rax
+  801229:	48 89 c2             	mov    %rax,%rdx
+  80122c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801231:	48 01 d0             	add    %rdx,%rax
+  801234:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801239:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  80123d:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801243:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801248:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80124c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801252:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801256:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80125a:	89 c2                	mov    %eax,%edx
+  80125c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801265:	89 c1                	mov    %eax,%ecx
+  801267:	d3 e6                	shl    %cl,%esi
+  801269:	89 f0                	mov    %esi,%eax
+  80126b:	21 d0                	and    %edx,%eax
+  80126d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801271:	eb 21                	jmp    801294 <strlen_avx2+0x8f>
+    p += 32;
+  801273:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801279:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80127e:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801282:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801288:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80128c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801290:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801294:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801299:	74 d8                	je     801273 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80129b:	31 c0                	xor    %eax,%eax
+  80129d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8012a3:	48 63 d0             	movslq %eax,%rdx
+  8012a6:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012ab:	48 01 d0             	add    %rdx,%rax
+  8012ae:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8012b3:	c9                   	leave
+  8012b4:	c3                   	ret
+
+00000000008012b5 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+  8012b9:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8012bd:	48 83 ec 40          	sub    $0x40,%rsp
+  8012c1:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8012c6:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8012cb:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8012d0:	eb 77                	jmp    801349 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8012d2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012d7:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012db:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8012df:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012e4:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012e8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012ec:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012f0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8012f4:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8012f9:	74 3c                	je     801337 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8012fb:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8012ff:	f7 d0                	not    %eax
+  801301:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801305:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801309:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80130d:	48 63 d0             	movslq %eax,%rdx
+  801310:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801315:	48 01 d0             	add    %rdx,%rax
+  801318:	0f b6 00             	movzbl (%rax),%eax
+  80131b:	0f b6 c0             	movzbl %al,%eax
+  80131e:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801322:	48 63 ca             	movslq %edx,%rcx
+  801325:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80132a:	48 01 ca             	add    %rcx,%rdx
+  80132d:	0f b6 12             	movzbl (%rdx),%edx
+  801330:	0f b6 d2             	movzbl %dl,%edx
+  801333:	29 d0                	sub    %edx,%eax
+  801335:	eb 6b                	jmp    8013a2 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801337:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80133d:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801343:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801349:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80134f:	77 81                	ja     8012d2 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801351:	eb 42                	jmp    801395 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801353:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801358:	0f b6 10             	movzbl (%rax),%edx
+  80135b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801360:	0f b6 00             	movzbl (%rax),%eax
+  801363:	38 c2                	cmp    %al,%dl
+  801365:	74 1c                	je     801383 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801367:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80136c:	0f b6 00             	movzbl (%rax),%eax
+  80136f:	0f b6 c8             	movzbl %al,%ecx
+  801372:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801377:	0f b6 00             	movzbl (%rax),%eax
+  80137a:	0f b6 d0             	movzbl %al,%edx
+  80137d:	89 c8                	mov    %ecx,%eax
+  80137f:	29 d0                	sub    %edx,%eax
+  801381:	eb 1f                	jmp    8013a2 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801383:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801389:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80138f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801395:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80139b:	75 b6                	jne    801353 <memcmp_avx2+0x9e>
+  return 0;
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+
+00000000008013a4 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013ac:	48 83 ec 60          	sub    $0x60,%rsp
+  8013b0:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8013b5:	89 f0                	mov    %esi,%eax
+  8013b7:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8013bc:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8013c0:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8013c5:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8013c9:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8013ce:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8013d4:	eb 47                	jmp    80141d <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8013d6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013db:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013df:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8013e3:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8013e9:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8013ed:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013f1:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8013f5:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8013fa:	74 15                	je     801411 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8013fc:	31 c0                	xor    %eax,%eax
+  8013fe:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801404:	48 63 d0             	movslq %eax,%rdx
+  801407:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80140c:	48 01 d0             	add    %rdx,%rax
+  80140f:	eb 3d                	jmp    80144e <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801411:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801417:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80141d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801423:	77 b1                	ja     8013d6 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801425:	eb 0c                	jmp    801433 <memfind_avx2+0x8f>
+  801427:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80142d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801433:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801439:	74 0e                	je     801449 <memfind_avx2+0xa5>
+  80143b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801440:	0f b6 00             	movzbl (%rax),%eax
+  801443:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801447:	75 de                	jne    801427 <memfind_avx2+0x83>
+  return s;
+  801449:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80144e:	c9                   	leave
+  80144f:	c3                   	ret
+
+0000000000801450 <strlen>:
+strlen(const char *s) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	48 83 ec 40          	sub    $0x40,%rsp
+  801458:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80145c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801460:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801464:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  80146b:	00 00 00 
+  80146e:	ff d0                	call   *%rax
+  801470:	83 e0 02             	and    $0x2,%eax
+  801473:	85 c0                	test   %eax,%eax
+  801475:	74 18                	je     80148f <strlen+0x3f>
+    return strlen_avx2(s);
+  801477:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80147b:	48 89 c7             	mov    %rax,%rdi
+  80147e:	48 b8 05 12 80 00 00 	movabs $0x801205,%rax
+  801485:	00 00 00 
+  801488:	ff d0                	call   *%rax
+  80148a:	e9 82 00 00 00       	jmp    801511 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80148f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801493:	83 e0 0f             	and    $0xf,%eax
+  801496:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801499:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80149c:	48 f7 d8             	neg    %rax
+  80149f:	48 89 c2             	mov    %rax,%rdx
+  8014a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014a6:	48 01 d0             	add    %rdx,%rax
+  8014a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8014ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014b1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8014b5:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8014ba:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8014be:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8014c2:	89 c2                	mov    %eax,%edx
+  8014c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014c7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014cc:	89 c1                	mov    %eax,%ecx
+  8014ce:	d3 e6                	shl    %cl,%esi
+  8014d0:	89 f0                	mov    %esi,%eax
+  8014d2:	21 d0                	and    %edx,%eax
+  8014d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8014d7:	eb 1d                	jmp    8014f6 <strlen+0xa6>
+    p += 16;
+  8014d9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8014de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014e2:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8014e6:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8014eb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8014ef:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8014f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8014f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014fa:	74 dd                	je     8014d9 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8014fc:	31 c0                	xor    %eax,%eax
+  8014fe:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801503:	48 63 d0             	movslq %eax,%rdx
+  801506:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80150a:	48 01 d0             	add    %rdx,%rax
+  80150d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801511:	c9                   	leave
+  801512:	c3                   	ret
+
+0000000000801513 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801513:	55                   	push   %rbp
+  801514:	48 89 e5             	mov    %rsp,%rbp
+  801517:	48 83 ec 20          	sub    $0x20,%rsp
+  80151b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80151f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801523:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80152a:	eb 0e                	jmp    80153a <strnlen+0x27>
+    n++;
+  80152c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801530:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801535:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80153a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80153f:	74 0b                	je     80154c <strnlen+0x39>
+  801541:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801545:	0f b6 00             	movzbl (%rax),%eax
+  801548:	84 c0                	test   %al,%al
+  80154a:	75 e0                	jne    80152c <strnlen+0x19>
+  return n;
+  80154c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80154f:	c9                   	leave
+  801550:	c3                   	ret
+
+0000000000801551 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801551:	55                   	push   %rbp
+  801552:	48 89 e5             	mov    %rsp,%rbp
+  801555:	48 83 ec 20          	sub    $0x20,%rsp
+  801559:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80155d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801561:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801565:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801569:	90                   	nop
+  80156a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80156e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801572:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80157e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801582:	0f b6 12             	movzbl (%rdx),%edx
+  801585:	88 10                	mov    %dl,(%rax)
+  801587:	0f b6 00             	movzbl (%rax),%eax
+  80158a:	84 c0                	test   %al,%al
+  80158c:	75 dc                	jne    80156a <strcpy+0x19>
+  return ret;
+  80158e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801592:	c9                   	leave
+  801593:	c3                   	ret
+
+0000000000801594 <strcat>:
+strcat(char *dst, const char *src) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	48 83 ec 20          	sub    $0x20,%rsp
+  80159c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8015a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a8:	48 89 c7             	mov    %rax,%rdi
+  8015ab:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+  8015b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8015ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8015bd:	48 63 d0             	movslq %eax,%rdx
+  8015c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c4:	48 01 c2             	add    %rax,%rdx
+  8015c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015cb:	48 89 c6             	mov    %rax,%rsi
+  8015ce:	48 89 d7             	mov    %rdx,%rdi
+  8015d1:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+  return dst;
+  8015dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8015e1:	c9                   	leave
+  8015e2:	c3                   	ret
+
+00000000008015e3 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8015e3:	55                   	push   %rbp
+  8015e4:	48 89 e5             	mov    %rsp,%rbp
+  8015e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8015eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015f3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8015f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8015ff:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801606:	00 
+  801607:	eb 2a                	jmp    801633 <strncpy+0x50>
+    *dst++ = *src;
+  801609:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801611:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801615:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801619:	0f b6 12             	movzbl (%rdx),%edx
+  80161c:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80161e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801622:	0f b6 00             	movzbl (%rax),%eax
+  801625:	84 c0                	test   %al,%al
+  801627:	74 05                	je     80162e <strncpy+0x4b>
+      src++;
+  801629:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80162e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801637:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80163b:	72 cc                	jb     801609 <strncpy+0x26>
+  return ret;
+  80163d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801641:	c9                   	leave
+  801642:	c3                   	ret
+
+0000000000801643 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801643:	55                   	push   %rbp
+  801644:	48 89 e5             	mov    %rsp,%rbp
+  801647:	48 83 ec 28          	sub    $0x28,%rsp
+  80164b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80164f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801653:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801657:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80165b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80165f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801664:	74 3d                	je     8016a3 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801666:	eb 1d                	jmp    801685 <strlcpy+0x42>
+      *dst++ = *src++;
+  801668:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80166c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801670:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801674:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801678:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80167c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801680:	0f b6 12             	movzbl (%rdx),%edx
+  801683:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801685:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80168a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80168f:	74 0b                	je     80169c <strlcpy+0x59>
+  801691:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801695:	0f b6 00             	movzbl (%rax),%eax
+  801698:	84 c0                	test   %al,%al
+  80169a:	75 cc                	jne    801668 <strlcpy+0x25>
+    *dst = '\0';
+  80169c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a0:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8016a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+00000000008016ad <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8016ad:	55                   	push   %rbp
+  8016ae:	48 89 e5             	mov    %rsp,%rbp
+  8016b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8016b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8016c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016c5:	48 89 c7             	mov    %rax,%rdi
+  8016c8:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  8016cf:	00 00 00 
+  8016d2:	ff d0                	call   *%rax
+  8016d4:	48 98                	cltq
+  8016d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8016da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e2:	48 89 d6             	mov    %rdx,%rsi
+  8016e5:	48 89 c7             	mov    %rax,%rdi
+  8016e8:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8016ef:	00 00 00 
+  8016f2:	ff d0                	call   *%rax
+  8016f4:	48 98                	cltq
+  8016f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8016fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016fe:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801702:	75 10                	jne    801714 <strlcat+0x67>
+    return maxlen + srclen;
+  801704:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80170c:	48 01 d0             	add    %rdx,%rax
+  80170f:	e9 86 00 00 00       	jmp    80179a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801714:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801718:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80171c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801720:	73 2b                	jae    80174d <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801722:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801726:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80172a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80172e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801732:	48 01 c1             	add    %rax,%rcx
+  801735:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801739:	48 89 c6             	mov    %rax,%rsi
+  80173c:	48 89 cf             	mov    %rcx,%rdi
+  80173f:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  801746:	00 00 00 
+  801749:	ff d0                	call   *%rax
+  80174b:	eb 42                	jmp    80178f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80174d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801751:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801755:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80175d:	48 01 c1             	add    %rax,%rcx
+  801760:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801764:	48 89 c6             	mov    %rax,%rsi
+  801767:	48 89 cf             	mov    %rcx,%rdi
+  80176a:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  801771:	00 00 00 
+  801774:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801776:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80177a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80177e:	48 01 d0             	add    %rdx,%rax
+  801781:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801785:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801789:	48 01 d0             	add    %rdx,%rax
+  80178c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80178f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801793:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801797:	48 01 d0             	add    %rdx,%rax
+}
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+000000000080179c <strcmp>:
+strcmp(const char *p, const char *q) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8017a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8017ac:	eb 0a                	jmp    8017b8 <strcmp+0x1c>
+    p++, q++;
+  8017ae:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017b3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8017b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bc:	0f b6 00             	movzbl (%rax),%eax
+  8017bf:	84 c0                	test   %al,%al
+  8017c1:	74 12                	je     8017d5 <strcmp+0x39>
+  8017c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c7:	0f b6 10             	movzbl (%rax),%edx
+  8017ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ce:	0f b6 00             	movzbl (%rax),%eax
+  8017d1:	38 c2                	cmp    %al,%dl
+  8017d3:	74 d9                	je     8017ae <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8017d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d9:	0f b6 00             	movzbl (%rax),%eax
+  8017dc:	0f b6 d0             	movzbl %al,%edx
+  8017df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017e3:	0f b6 00             	movzbl (%rax),%eax
+  8017e6:	0f b6 c0             	movzbl %al,%eax
+  8017e9:	29 c2                	sub    %eax,%edx
+  8017eb:	89 d0                	mov    %edx,%eax
+}
+  8017ed:	c9                   	leave
+  8017ee:	c3                   	ret
+
+00000000008017ef <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8017ef:	55                   	push   %rbp
+  8017f0:	48 89 e5             	mov    %rsp,%rbp
+  8017f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8017f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017ff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801803:	eb 0f                	jmp    801814 <strncmp+0x25>
+    n--, p++, q++;
+  801805:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80180a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80180f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801814:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801819:	74 1d                	je     801838 <strncmp+0x49>
+  80181b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181f:	0f b6 00             	movzbl (%rax),%eax
+  801822:	84 c0                	test   %al,%al
+  801824:	74 12                	je     801838 <strncmp+0x49>
+  801826:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182a:	0f b6 10             	movzbl (%rax),%edx
+  80182d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801831:	0f b6 00             	movzbl (%rax),%eax
+  801834:	38 c2                	cmp    %al,%dl
+  801836:	74 cd                	je     801805 <strncmp+0x16>
+  if (n == 0)
+  801838:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80183d:	75 07                	jne    801846 <strncmp+0x57>
+    return 0;
+  80183f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801844:	eb 16                	jmp    80185c <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801846:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184a:	0f b6 00             	movzbl (%rax),%eax
+  80184d:	0f b6 d0             	movzbl %al,%edx
+  801850:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801854:	0f b6 00             	movzbl (%rax),%eax
+  801857:	0f b6 c0             	movzbl %al,%eax
+  80185a:	29 c2                	sub    %eax,%edx
+}
+  80185c:	89 d0                	mov    %edx,%eax
+  80185e:	c9                   	leave
+  80185f:	c3                   	ret
+
+0000000000801860 <strchr>:
+strchr(const char *s, char c) {
+  801860:	55                   	push   %rbp
+  801861:	48 89 e5             	mov    %rsp,%rbp
+  801864:	48 83 ec 60          	sub    $0x60,%rsp
+  801868:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80186c:	89 f0                	mov    %esi,%eax
+  80186e:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801871:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801875:	83 e0 0f             	and    $0xf,%eax
+  801878:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80187b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80187e:	48 f7 d8             	neg    %rax
+  801881:	48 89 c2             	mov    %rax,%rdx
+  801884:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801888:	48 01 d0             	add    %rdx,%rax
+  80188b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80188f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801893:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801897:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80189b:	66 0f 6e c0          	movd   %eax,%xmm0
+  80189f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8018a3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8018a7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8018ac:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8018b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b4:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8018b8:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8018bc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018c1:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8018c6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018ca:	89 c2                	mov    %eax,%edx
+  8018cc:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018d1:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8018d6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018da:	09 c2                	or     %eax,%edx
+  8018dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018df:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8018e4:	89 c1                	mov    %eax,%ecx
+  8018e6:	d3 e6                	shl    %cl,%esi
+  8018e8:	89 f0                	mov    %esi,%eax
+  8018ea:	21 d0                	and    %edx,%eax
+  8018ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8018ef:	eb 34                	jmp    801925 <strchr+0xc5>
+    p += 16;
+  8018f1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8018f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018fa:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8018fe:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801902:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801907:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80190c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801910:	89 c2                	mov    %eax,%edx
+  801912:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801917:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80191c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801920:	09 d0                	or     %edx,%eax
+  801922:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801925:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801929:	74 c6                	je     8018f1 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80192b:	31 c0                	xor    %eax,%eax
+  80192d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801932:	48 98                	cltq
+  801934:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193c:	0f b6 00             	movzbl (%rax),%eax
+  80193f:	84 c0                	test   %al,%al
+  801941:	74 06                	je     801949 <strchr+0xe9>
+  801943:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801947:	eb 05                	jmp    80194e <strchr+0xee>
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+
+0000000000801950 <strfind>:
+strfind(const char *s, char c) {
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	48 83 ec 10          	sub    $0x10,%rsp
+  801958:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80195c:	89 f0                	mov    %esi,%eax
+  80195e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801961:	eb 11                	jmp    801974 <strfind+0x24>
+    if (*s == c)
+  801963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801967:	0f b6 00             	movzbl (%rax),%eax
+  80196a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80196d:	74 12                	je     801981 <strfind+0x31>
+  for (; *s; s++)
+  80196f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801974:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801978:	0f b6 00             	movzbl (%rax),%eax
+  80197b:	84 c0                	test   %al,%al
+  80197d:	75 e4                	jne    801963 <strfind+0x13>
+  80197f:	eb 01                	jmp    801982 <strfind+0x32>
+      break;
+  801981:	90                   	nop
+  return (char *)s;
+  801982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801986:	c9                   	leave
+  801987:	c3                   	ret
+
+0000000000801988 <memset>:
+memset(void *v, int c, size_t n) {
+  801988:	55                   	push   %rbp
+  801989:	48 89 e5             	mov    %rsp,%rbp
+  80198c:	48 83 ec 38          	sub    $0x38,%rsp
+  801990:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801994:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801997:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80199b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019a3:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8019a8:	76 41                	jbe    8019eb <memset+0x63>
+  8019aa:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	83 e0 01             	and    $0x1,%eax
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	74 2e                	je     8019eb <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8019bd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8019c0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8019c8:	48 89 ce             	mov    %rcx,%rsi
+  8019cb:	48 89 f7             	mov    %rsi,%rdi
+  8019ce:	48 89 d1             	mov    %rdx,%rcx
+  8019d1:	fc                   	cld
+  8019d2:	f3 aa                	rep stos %al,%es:(%rdi)
+  8019d4:	48 89 ca             	mov    %rcx,%rdx
+  8019d7:	48 89 fe             	mov    %rdi,%rsi
+  8019da:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8019de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8019e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e6:	e9 a7 00 00 00       	jmp    801a92 <memset+0x10a>
+  if (n >= 8) {
+  8019eb:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8019f0:	0f 86 87 00 00 00    	jbe    801a7d <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8019f6:	eb 16                	jmp    801a0e <memset+0x86>
+      *p++ = c;
+  8019f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019fc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a00:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a04:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a07:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a09:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a12:	83 e0 07             	and    $0x7,%eax
+  801a15:	48 85 c0             	test   %rax,%rax
+  801a18:	75 de                	jne    8019f8 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801a1a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a1d:	0f b6 c0             	movzbl %al,%eax
+  801a20:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a27:	01 01 01 
+  801a2a:	48 0f af c2          	imul   %rdx,%rax
+  801a2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a36:	48 c1 e8 03          	shr    $0x3,%rax
+  801a3a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801a3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a42:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a46:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a4a:	48 89 ce             	mov    %rcx,%rsi
+  801a4d:	48 89 f7             	mov    %rsi,%rdi
+  801a50:	48 89 d1             	mov    %rdx,%rcx
+  801a53:	fc                   	cld
+  801a54:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801a57:	48 89 ca             	mov    %rcx,%rdx
+  801a5a:	48 89 fe             	mov    %rdi,%rsi
+  801a5d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a61:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801a65:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801a6a:	eb 11                	jmp    801a7d <memset+0xf5>
+    *p++ = c;
+  801a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a70:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a74:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a78:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a7b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a81:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a85:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a89:	48 85 c0             	test   %rax,%rax
+  801a8c:	75 de                	jne    801a6c <memset+0xe4>
+  return v;
+  801a8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a92:	c9                   	leave
+  801a93:	c3                   	ret
+
+0000000000801a94 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801a94:	55                   	push   %rbp
+  801a95:	48 89 e5             	mov    %rsp,%rbp
+  801a98:	48 83 ec 38          	sub    $0x38,%rsp
+  801a9c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801aa0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801aa4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801aa8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801ab0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801ab8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801ac0:	0f 83 da 00 00 00    	jae    801ba0 <memmove+0x10c>
+  801ac6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ace:	48 01 d0             	add    %rdx,%rax
+  801ad1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801ad5:	0f 83 c5 00 00 00    	jae    801ba0 <memmove+0x10c>
+    s += n;
+  801adb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801adf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801ae3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ae7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801aeb:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801af0:	0f 86 94 00 00 00    	jbe    801b8a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801af6:	eb 1c                	jmp    801b14 <memmove+0x80>
+        *--d = *--s;
+  801af8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801afd:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b06:	0f b6 10             	movzbl (%rax),%edx
+  801b09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b0d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b0f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b18:	83 e0 07             	and    $0x7,%eax
+  801b1b:	48 85 c0             	test   %rax,%rax
+  801b1e:	75 d8                	jne    801af8 <memmove+0x64>
+      nq = n / 8;
+  801b20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b24:	48 c1 e8 03          	shr    $0x3,%rax
+  801b28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b2c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b31:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801b36:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801b3b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b3f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b47:	48 89 cf             	mov    %rcx,%rdi
+  801b4a:	48 89 d6             	mov    %rdx,%rsi
+  801b4d:	48 89 c1             	mov    %rax,%rcx
+  801b50:	fd                   	std
+  801b51:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b54:	fc                   	cld
+  801b55:	48 89 c8             	mov    %rcx,%rax
+  801b58:	48 89 f2             	mov    %rsi,%rdx
+  801b5b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b5f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b63:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801b67:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801b6c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801b71:	eb 17                	jmp    801b8a <memmove+0xf6>
+      *--d = *--s;
+  801b73:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b78:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b81:	0f b6 10             	movzbl (%rax),%edx
+  801b84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b88:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b92:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b96:	48 85 c0             	test   %rax,%rax
+  801b99:	75 d8                	jne    801b73 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801b9b:	e9 f4 00 00 00       	jmp    801c94 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801ba0:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801ba5:	76 46                	jbe    801bed <memmove+0x159>
+  801ba7:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+  801bb3:	83 e0 01             	and    $0x1,%eax
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	74 33                	je     801bed <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801bba:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc6:	48 89 cf             	mov    %rcx,%rdi
+  801bc9:	48 89 d6             	mov    %rdx,%rsi
+  801bcc:	48 89 c1             	mov    %rax,%rcx
+  801bcf:	fc                   	cld
+  801bd0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801bd2:	48 89 c8             	mov    %rcx,%rax
+  801bd5:	48 89 f2             	mov    %rsi,%rdx
+  801bd8:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bdc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801be0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801be4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be8:	e9 ab 00 00 00       	jmp    801c98 <memmove+0x204>
+    if (n >= 8) {
+  801bed:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801bf2:	0f 86 8b 00 00 00    	jbe    801c83 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801bf8:	eb 22                	jmp    801c1c <memmove+0x188>
+        *d++ = *s++;
+  801bfa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bfe:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c02:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c0a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c0e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c12:	0f b6 12             	movzbl (%rdx),%edx
+  801c15:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c17:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c20:	83 e0 07             	and    $0x7,%eax
+  801c23:	48 85 c0             	test   %rax,%rax
+  801c26:	75 d2                	jne    801bfa <memmove+0x166>
+      nq = n / 8;
+  801c28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2c:	48 c1 e8 03          	shr    $0x3,%rax
+  801c30:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c34:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c40:	48 89 cf             	mov    %rcx,%rdi
+  801c43:	48 89 d6             	mov    %rdx,%rsi
+  801c46:	48 89 c1             	mov    %rax,%rcx
+  801c49:	fc                   	cld
+  801c4a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c4d:	48 89 c8             	mov    %rcx,%rax
+  801c50:	48 89 f2             	mov    %rsi,%rdx
+  801c53:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c57:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c5f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801c64:	eb 1d                	jmp    801c83 <memmove+0x1ef>
+      *d++ = *s++;
+  801c66:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c6a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c6e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c76:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c7a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c7e:	0f b6 12             	movzbl (%rdx),%edx
+  801c81:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c87:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c8b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c8f:	48 85 c0             	test   %rax,%rax
+  801c92:	75 d2                	jne    801c66 <memmove+0x1d2>
+  return dst;
+  801c94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801c98:	c9                   	leave
+  801c99:	c3                   	ret
+
+0000000000801c9a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c9a:	55                   	push   %rbp
+  801c9b:	48 89 e5             	mov    %rsp,%rbp
+  801c9e:	48 83 ec 18          	sub    $0x18,%rsp
+  801ca2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ca6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801caa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801cae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cb2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cba:	48 89 ce             	mov    %rcx,%rsi
+  801cbd:	48 89 c7             	mov    %rax,%rdi
+  801cc0:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  801cc7:	00 00 00 
+  801cca:	ff d0                	call   *%rax
+}
+  801ccc:	c9                   	leave
+  801ccd:	c3                   	ret
+
+0000000000801cce <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	48 83 ec 40          	sub    $0x40,%rsp
+  801cd6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cda:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cde:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801ce2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801cea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801cf2:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801cf7:	0f 86 a7 00 00 00    	jbe    801da4 <memcmp+0xd6>
+  801cfd:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+  801d09:	83 e0 02             	and    $0x2,%eax
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	0f 84 90 00 00 00    	je     801da4 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801d14:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d18:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d20:	48 89 ce             	mov    %rcx,%rsi
+  801d23:	48 89 c7             	mov    %rax,%rdi
+  801d26:	48 b8 b5 12 80 00 00 	movabs $0x8012b5,%rax
+  801d2d:	00 00 00 
+  801d30:	ff d0                	call   *%rax
+  801d32:	e9 c2 00 00 00       	jmp    801df9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801d37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d3b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d3f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d47:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d4b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d4f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801d56:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801d5d:	74 36                	je     801d95 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801d5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d62:	f7 d0                	not    %eax
+  801d64:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801d68:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801d6b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801d6e:	48 63 d0             	movslq %eax,%rdx
+  801d71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d75:	48 01 d0             	add    %rdx,%rax
+  801d78:	0f b6 00             	movzbl (%rax),%eax
+  801d7b:	0f b6 c0             	movzbl %al,%eax
+  801d7e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801d81:	48 63 ca             	movslq %edx,%rcx
+  801d84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d88:	48 01 ca             	add    %rcx,%rdx
+  801d8b:	0f b6 12             	movzbl (%rdx),%edx
+  801d8e:	0f b6 d2             	movzbl %dl,%edx
+  801d91:	29 d0                	sub    %edx,%eax
+  801d93:	eb 64                	jmp    801df9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801d95:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801d9a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801d9f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801da4:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801da9:	77 8c                	ja     801d37 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801dab:	eb 36                	jmp    801de3 <memcmp+0x115>
+    if (*s1 != *s2)
+  801dad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801db1:	0f b6 10             	movzbl (%rax),%edx
+  801db4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801db8:	0f b6 00             	movzbl (%rax),%eax
+  801dbb:	38 c2                	cmp    %al,%dl
+  801dbd:	74 1a                	je     801dd9 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dc3:	0f b6 00             	movzbl (%rax),%eax
+  801dc6:	0f b6 c8             	movzbl %al,%ecx
+  801dc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dcd:	0f b6 00             	movzbl (%rax),%eax
+  801dd0:	0f b6 d0             	movzbl %al,%edx
+  801dd3:	89 c8                	mov    %ecx,%eax
+  801dd5:	29 d0                	sub    %edx,%eax
+  801dd7:	eb 20                	jmp    801df9 <memcmp+0x12b>
+    s1++, s2++;
+  801dd9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801dde:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801de3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801de7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801deb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801def:	48 85 c0             	test   %rax,%rax
+  801df2:	75 b9                	jne    801dad <memcmp+0xdf>
+  }
+
+  return 0;
+  801df4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df9:	c9                   	leave
+  801dfa:	c3                   	ret
+
+0000000000801dfb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801dfb:	55                   	push   %rbp
+  801dfc:	48 89 e5             	mov    %rsp,%rbp
+  801dff:	48 83 ec 50          	sub    $0x50,%rsp
+  801e03:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e07:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e0a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e0e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e12:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801e16:	48 01 d0             	add    %rdx,%rax
+  801e19:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801e1d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e20:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e24:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e28:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e2c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e31:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e35:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801e3a:	76 73                	jbe    801eaf <memfind+0xb4>
+  801e3c:	48 b8 ed 10 80 00 00 	movabs $0x8010ed,%rax
+  801e43:	00 00 00 
+  801e46:	ff d0                	call   *%rax
+  801e48:	83 e0 02             	and    $0x2,%eax
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	74 60                	je     801eaf <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801e4f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e52:	0f b6 c8             	movzbl %al,%ecx
+  801e55:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801e59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e5d:	89 ce                	mov    %ecx,%esi
+  801e5f:	48 89 c7             	mov    %rax,%rdi
+  801e62:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  801e69:	00 00 00 
+  801e6c:	ff d0                	call   *%rax
+  801e6e:	eb 6c                	jmp    801edc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801e70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e74:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e78:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e7c:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801e81:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e85:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e89:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801e8c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801e90:	74 13                	je     801ea5 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801e92:	31 c0                	xor    %eax,%eax
+  801e94:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801e99:	48 63 d0             	movslq %eax,%rdx
+  801e9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea0:	48 01 d0             	add    %rdx,%rax
+  801ea3:	eb 37                	jmp    801edc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801ea5:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801eaa:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801eaf:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801eb4:	77 ba                	ja     801e70 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801eb6:	eb 13                	jmp    801ecb <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801eb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ebc:	0f b6 00             	movzbl (%rax),%eax
+  801ebf:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801ec2:	38 d0                	cmp    %dl,%al
+  801ec4:	74 11                	je     801ed7 <memfind+0xdc>
+  for (; s < ends; s++)
+  801ec6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801ecb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801ed3:	72 e3                	jb     801eb8 <memfind+0xbd>
+  801ed5:	eb 01                	jmp    801ed8 <memfind+0xdd>
+      break;
+  801ed7:	90                   	nop
+  return (void *)s;
+  801ed8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+
+0000000000801ede <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	48 83 ec 38          	sub    $0x38,%rsp
+  801ee6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801eea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801eee:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801ef1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801ef8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801eff:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f00:	eb 05                	jmp    801f07 <strtol+0x29>
+    s++;
+  801f02:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0b:	0f b6 00             	movzbl (%rax),%eax
+  801f0e:	3c 20                	cmp    $0x20,%al
+  801f10:	74 f0                	je     801f02 <strtol+0x24>
+  801f12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f16:	0f b6 00             	movzbl (%rax),%eax
+  801f19:	3c 09                	cmp    $0x9,%al
+  801f1b:	74 e5                	je     801f02 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f21:	0f b6 00             	movzbl (%rax),%eax
+  801f24:	3c 2b                	cmp    $0x2b,%al
+  801f26:	75 07                	jne    801f2f <strtol+0x51>
+    s++;
+  801f28:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f2d:	eb 17                	jmp    801f46 <strtol+0x68>
+  else if (*s == '-')
+  801f2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f33:	0f b6 00             	movzbl (%rax),%eax
+  801f36:	3c 2d                	cmp    $0x2d,%al
+  801f38:	75 0c                	jne    801f46 <strtol+0x68>
+    s++, neg = 1;
+  801f3a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f3f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f46:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f4a:	74 06                	je     801f52 <strtol+0x74>
+  801f4c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f50:	75 28                	jne    801f7a <strtol+0x9c>
+  801f52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f56:	0f b6 00             	movzbl (%rax),%eax
+  801f59:	3c 30                	cmp    $0x30,%al
+  801f5b:	75 1d                	jne    801f7a <strtol+0x9c>
+  801f5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f61:	48 83 c0 01          	add    $0x1,%rax
+  801f65:	0f b6 00             	movzbl (%rax),%eax
+  801f68:	3c 78                	cmp    $0x78,%al
+  801f6a:	75 0e                	jne    801f7a <strtol+0x9c>
+    s += 2, base = 16;
+  801f6c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801f71:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801f78:	eb 2c                	jmp    801fa6 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801f7a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f7e:	75 19                	jne    801f99 <strtol+0xbb>
+  801f80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f84:	0f b6 00             	movzbl (%rax),%eax
+  801f87:	3c 30                	cmp    $0x30,%al
+  801f89:	75 0e                	jne    801f99 <strtol+0xbb>
+    s++, base = 8;
+  801f8b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f90:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f97:	eb 0d                	jmp    801fa6 <strtol+0xc8>
+  else if (base == 0)
+  801f99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f9d:	75 07                	jne    801fa6 <strtol+0xc8>
+    base = 10;
+  801f9f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801fa6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801faa:	0f b6 00             	movzbl (%rax),%eax
+  801fad:	3c 2f                	cmp    $0x2f,%al
+  801faf:	7e 1d                	jle    801fce <strtol+0xf0>
+  801fb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb5:	0f b6 00             	movzbl (%rax),%eax
+  801fb8:	3c 39                	cmp    $0x39,%al
+  801fba:	7f 12                	jg     801fce <strtol+0xf0>
+      dig = *s - '0';
+  801fbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc0:	0f b6 00             	movzbl (%rax),%eax
+  801fc3:	0f be c0             	movsbl %al,%eax
+  801fc6:	83 e8 30             	sub    $0x30,%eax
+  801fc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fcc:	eb 4e                	jmp    80201c <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801fce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd2:	0f b6 00             	movzbl (%rax),%eax
+  801fd5:	3c 60                	cmp    $0x60,%al
+  801fd7:	7e 1d                	jle    801ff6 <strtol+0x118>
+  801fd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fdd:	0f b6 00             	movzbl (%rax),%eax
+  801fe0:	3c 7a                	cmp    $0x7a,%al
+  801fe2:	7f 12                	jg     801ff6 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801fe4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe8:	0f b6 00             	movzbl (%rax),%eax
+  801feb:	0f be c0             	movsbl %al,%eax
+  801fee:	83 e8 57             	sub    $0x57,%eax
+  801ff1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ff4:	eb 26                	jmp    80201c <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801ff6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ffa:	0f b6 00             	movzbl (%rax),%eax
+  801ffd:	3c 40                	cmp    $0x40,%al
+  801fff:	7e 47                	jle    802048 <strtol+0x16a>
+  802001:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802005:	0f b6 00             	movzbl (%rax),%eax
+  802008:	3c 5a                	cmp    $0x5a,%al
+  80200a:	7f 3c                	jg     802048 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  80200c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802010:	0f b6 00             	movzbl (%rax),%eax
+  802013:	0f be c0             	movsbl %al,%eax
+  802016:	83 e8 37             	sub    $0x37,%eax
+  802019:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  80201c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80201f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802022:	7d 23                	jge    802047 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802024:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802029:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80202c:	48 98                	cltq
+  80202e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802033:	48 89 c2             	mov    %rax,%rdx
+  802036:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802039:	48 98                	cltq
+  80203b:	48 01 d0             	add    %rdx,%rax
+  80203e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802042:	e9 5f ff ff ff       	jmp    801fa6 <strtol+0xc8>
+      break;
+  802047:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802048:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80204d:	74 0b                	je     80205a <strtol+0x17c>
+    *endptr = (char *)s;
+  80204f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802053:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802057:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80205a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80205e:	74 09                	je     802069 <strtol+0x18b>
+  802060:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802064:	48 f7 d8             	neg    %rax
+  802067:	eb 04                	jmp    80206d <strtol+0x18f>
+  802069:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80206d:	c9                   	leave
+  80206e:	c3                   	ret
+
+000000000080206f <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80206f:	55                   	push   %rbp
+  802070:	48 89 e5             	mov    %rsp,%rbp
+  802073:	53                   	push   %rbx
+  802074:	48 83 ec 48          	sub    $0x48,%rsp
+  802078:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80207c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802080:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802084:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802088:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80208c:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802090:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802094:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802098:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80209c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8020a0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020a4:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8020a8:	4c 89 c3             	mov    %r8,%rbx
+  8020ab:	cd 30                	int    $0x30
+  8020ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8020b1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8020b6:	74 46                	je     8020fe <syscall+0x8f>
+  8020b8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8020bd:	7e 3f                	jle    8020fe <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8020bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020c7:	49 89 d0             	mov    %rdx,%r8
+  8020ca:	48 89 c1             	mov    %rax,%rcx
+  8020cd:	48 b8 08 5b 80 00 00 	movabs $0x805b08,%rax
+  8020d4:	00 00 00 
+  8020d7:	48 89 c2             	mov    %rax,%rdx
+  8020da:	be 22 00 00 00       	mov    $0x22,%esi
+  8020df:	48 b8 27 5b 80 00 00 	movabs $0x805b27,%rax
+  8020e6:	00 00 00 
+  8020e9:	48 89 c7             	mov    %rax,%rdi
+  8020ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f1:	49 b9 82 03 80 00 00 	movabs $0x800382,%r9
+  8020f8:	00 00 00 
+  8020fb:	41 ff d1             	call   *%r9
+
+  return ret;
+  8020fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802102:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802106:	c9                   	leave
+  802107:	c3                   	ret
+
+0000000000802108 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802108:	55                   	push   %rbp
+  802109:	48 89 e5             	mov    %rsp,%rbp
+  80210c:	48 83 ec 10          	sub    $0x10,%rsp
+  802110:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802114:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802118:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80211c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802120:	48 83 ec 08          	sub    $0x8,%rsp
+  802124:	6a 00                	push   $0x0
+  802126:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80212c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802132:	48 89 d1             	mov    %rdx,%rcx
+  802135:	48 89 c2             	mov    %rax,%rdx
+  802138:	be 00 00 00 00       	mov    $0x0,%esi
+  80213d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802142:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802149:	00 00 00 
+  80214c:	ff d0                	call   *%rax
+  80214e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802152:	90                   	nop
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+0000000000802155 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802155:	55                   	push   %rbp
+  802156:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802159:	48 83 ec 08          	sub    $0x8,%rsp
+  80215d:	6a 00                	push   $0x0
+  80215f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802170:	ba 00 00 00 00       	mov    $0x0,%edx
+  802175:	be 00 00 00 00       	mov    $0x0,%esi
+  80217a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80217f:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802186:	00 00 00 
+  802189:	ff d0                	call   *%rax
+  80218b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218f:	c9                   	leave
+  802190:	c3                   	ret
+
+0000000000802191 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802191:	55                   	push   %rbp
+  802192:	48 89 e5             	mov    %rsp,%rbp
+  802195:	48 83 ec 10          	sub    $0x10,%rsp
+  802199:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80219c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80219f:	48 98                	cltq
+  8021a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a5:	6a 00                	push   $0x0
+  8021a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021b8:	48 89 c2             	mov    %rax,%rdx
+  8021bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8021c0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021c5:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+  8021d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d5:	c9                   	leave
+  8021d6:	c3                   	ret
+
+00000000008021d7 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8021d7:	55                   	push   %rbp
+  8021d8:	48 89 e5             	mov    %rsp,%rbp
+  8021db:	48 83 ec 10          	sub    $0x10,%rsp
+  8021df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8021e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021e5:	48 98                	cltq
+  8021e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021eb:	6a 00                	push   $0x0
+  8021ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021fe:	48 89 c2             	mov    %rax,%rdx
+  802201:	be 00 00 00 00       	mov    $0x0,%esi
+  802206:	bf 04 00 00 00       	mov    $0x4,%edi
+  80220b:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221b:	90                   	nop
+  80221c:	c9                   	leave
+  80221d:	c3                   	ret
+
+000000000080221e <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80221e:	55                   	push   %rbp
+  80221f:	48 89 e5             	mov    %rsp,%rbp
+  802222:	48 83 ec 20          	sub    $0x20,%rsp
+  802226:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802229:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80222d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802230:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802233:	b8 05 00 00 00       	mov    $0x5,%eax
+  802238:	cd 30                	int    $0x30
+  80223a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80223e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802242:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802247:	7e 3d                	jle    802286 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80224d:	49 89 c0             	mov    %rax,%r8
+  802250:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802255:	48 b8 08 5b 80 00 00 	movabs $0x805b08,%rax
+  80225c:	00 00 00 
+  80225f:	48 89 c2             	mov    %rax,%rdx
+  802262:	be 49 00 00 00       	mov    $0x49,%esi
+  802267:	48 b8 27 5b 80 00 00 	movabs $0x805b27,%rax
+  80226e:	00 00 00 
+  802271:	48 89 c7             	mov    %rax,%rdi
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+  802279:	49 b9 82 03 80 00 00 	movabs $0x800382,%r9
+  802280:	00 00 00 
+  802283:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802286:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80228b:	75 13                	jne    8022a0 <sys_env_wait+0x82>
+  80228d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802292:	74 0c                	je     8022a0 <sys_env_wait+0x82>
+    *status = st;
+  802294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802298:	89 c2                	mov    %eax,%edx
+  80229a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80229e:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8022a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+00000000008022a6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8022aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ae:	6a 00                	push   $0x0
+  8022b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022d0:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+00000000008022e2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8022e2:	55                   	push   %rbp
+  8022e3:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8022e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802302:	be 00 00 00 00       	mov    $0x0,%esi
+  802307:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80230c:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  802318:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80231c:	90                   	nop
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+
+000000000080231f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80231f:	55                   	push   %rbp
+  802320:	48 89 e5             	mov    %rsp,%rbp
+  802323:	48 83 ec 20          	sub    $0x20,%rsp
+  802327:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80232a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80232e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802331:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802334:	48 63 c8             	movslq %eax,%rcx
+  802337:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80233b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80233e:	48 98                	cltq
+  802340:	48 83 ec 08          	sub    $0x8,%rsp
+  802344:	6a 00                	push   $0x0
+  802346:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80234c:	49 89 c8             	mov    %rcx,%r8
+  80234f:	48 89 d1             	mov    %rdx,%rcx
+  802352:	48 89 c2             	mov    %rax,%rdx
+  802355:	be 01 00 00 00       	mov    $0x1,%esi
+  80235a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80235f:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+  80236b:	48 83 c4 10          	add    $0x10,%rsp
+  80236f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802372:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+0000000000802377 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802377:	55                   	push   %rbp
+  802378:	48 89 e5             	mov    %rsp,%rbp
+  80237b:	48 83 ec 20          	sub    $0x20,%rsp
+  80237f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802382:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802386:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802389:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80238d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802391:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802394:	48 63 c8             	movslq %eax,%rcx
+  802397:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80239b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80239e:	48 63 f0             	movslq %eax,%rsi
+  8023a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023a8:	48 98                	cltq
+  8023aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ae:	51                   	push   %rcx
+  8023af:	49 89 f9             	mov    %rdi,%r9
+  8023b2:	49 89 f0             	mov    %rsi,%r8
+  8023b5:	48 89 d1             	mov    %rdx,%rcx
+  8023b8:	48 89 c2             	mov    %rax,%rdx
+  8023bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8023c5:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8023cc:	00 00 00 
+  8023cf:	ff d0                	call   *%rax
+  8023d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d5:	c9                   	leave
+  8023d6:	c3                   	ret
+
+00000000008023d7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8023d7:	55                   	push   %rbp
+  8023d8:	48 89 e5             	mov    %rsp,%rbp
+  8023db:	48 83 ec 10          	sub    $0x10,%rsp
+  8023df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8023e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023ed:	48 98                	cltq
+  8023ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f3:	6a 00                	push   $0x0
+  8023f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802401:	48 89 d1             	mov    %rdx,%rcx
+  802404:	48 89 c2             	mov    %rax,%rdx
+  802407:	be 01 00 00 00       	mov    $0x1,%esi
+  80240c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802411:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+
+0000000000802423 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	48 83 ec 10          	sub    $0x10,%rsp
+  80242b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802431:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802434:	48 63 d0             	movslq %eax,%rdx
+  802437:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80243a:	48 98                	cltq
+  80243c:	48 83 ec 08          	sub    $0x8,%rsp
+  802440:	6a 00                	push   $0x0
+  802442:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802448:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80244e:	48 89 d1             	mov    %rdx,%rcx
+  802451:	48 89 c2             	mov    %rax,%rdx
+  802454:	be 01 00 00 00       	mov    $0x1,%esi
+  802459:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80245e:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802465:	00 00 00 
+  802468:	ff d0                	call   *%rax
+  80246a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80246e:	c9                   	leave
+  80246f:	c3                   	ret
+
+0000000000802470 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	48 83 ec 10          	sub    $0x10,%rsp
+  802478:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80247b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80247f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802483:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802486:	48 98                	cltq
+  802488:	48 83 ec 08          	sub    $0x8,%rsp
+  80248c:	6a 00                	push   $0x0
+  80248e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80249a:	48 89 d1             	mov    %rdx,%rcx
+  80249d:	48 89 c2             	mov    %rax,%rdx
+  8024a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024aa:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8024b1:	00 00 00 
+  8024b4:	ff d0                	call   *%rax
+  8024b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ba:	c9                   	leave
+  8024bb:	c3                   	ret
+
+00000000008024bc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8024bc:	55                   	push   %rbp
+  8024bd:	48 89 e5             	mov    %rsp,%rbp
+  8024c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8024cb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024d2:	48 98                	cltq
+  8024d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d8:	6a 00                	push   $0x0
+  8024da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024e6:	48 89 d1             	mov    %rdx,%rcx
+  8024e9:	48 89 c2             	mov    %rax,%rdx
+  8024ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8024f6:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+  802502:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802506:	c9                   	leave
+  802507:	c3                   	ret
+
+0000000000802508 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802508:	55                   	push   %rbp
+  802509:	48 89 e5             	mov    %rsp,%rbp
+  80250c:	48 83 ec 20          	sub    $0x20,%rsp
+  802510:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802513:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802517:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80251b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80251e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802521:	48 63 f0             	movslq %eax,%rsi
+  802524:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802528:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80252c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80252f:	48 98                	cltq
+  802531:	48 83 ec 08          	sub    $0x8,%rsp
+  802535:	6a 00                	push   $0x0
+  802537:	49 89 f1             	mov    %rsi,%r9
+  80253a:	49 89 c8             	mov    %rcx,%r8
+  80253d:	48 89 d1             	mov    %rdx,%rcx
+  802540:	48 89 c2             	mov    %rax,%rdx
+  802543:	be 00 00 00 00       	mov    $0x0,%esi
+  802548:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80254d:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255d:	c9                   	leave
+  80255e:	c3                   	ret
+
+000000000080255f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80255f:	55                   	push   %rbp
+  802560:	48 89 e5             	mov    %rsp,%rbp
+  802563:	48 83 ec 10          	sub    $0x10,%rsp
+  802567:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80256b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80256f:	48 83 ec 08          	sub    $0x8,%rsp
+  802573:	6a 00                	push   $0x0
+  802575:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802581:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802586:	48 89 c2             	mov    %rax,%rdx
+  802589:	be 01 00 00 00       	mov    $0x1,%esi
+  80258e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802593:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  80259a:	00 00 00 
+  80259d:	ff d0                	call   *%rax
+  80259f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a3:	c9                   	leave
+  8025a4:	c3                   	ret
+
+00000000008025a5 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8025b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025cf:	48 89 d1             	mov    %rdx,%rcx
+  8025d2:	48 89 c2             	mov    %rax,%rdx
+  8025d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8025da:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025df:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ef:	c9                   	leave
+  8025f0:	c3                   	ret
+
+00000000008025f1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8025f1:	55                   	push   %rbp
+  8025f2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8025f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f9:	6a 00                	push   $0x0
+  8025fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802601:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802607:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80260c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802611:	be 00 00 00 00       	mov    $0x0,%esi
+  802616:	bf 11 00 00 00       	mov    $0x11,%edi
+  80261b:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802622:	00 00 00 
+  802625:	ff d0                	call   *%rax
+  802627:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80262b:	c9                   	leave
+  80262c:	c3                   	ret
+
+000000000080262d <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	48 83 ec 10          	sub    $0x10,%rsp
+  802635:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802639:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80263d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802645:	48 83 ec 08          	sub    $0x8,%rsp
+  802649:	6a 00                	push   $0x0
+  80264b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802651:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802657:	48 89 d1             	mov    %rdx,%rcx
+  80265a:	48 89 c2             	mov    %rax,%rdx
+  80265d:	be 00 00 00 00       	mov    $0x0,%esi
+  802662:	bf 12 00 00 00       	mov    $0x12,%edi
+  802667:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802677:	c9                   	leave
+  802678:	c3                   	ret
+
+0000000000802679 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802679:	55                   	push   %rbp
+  80267a:	48 89 e5             	mov    %rsp,%rbp
+  80267d:	48 83 ec 20          	sub    $0x20,%rsp
+  802681:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802685:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802689:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80268c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80268f:	48 63 c8             	movslq %eax,%rcx
+  802692:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80269a:	48 83 ec 08          	sub    $0x8,%rsp
+  80269e:	6a 00                	push   $0x0
+  8026a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a6:	49 89 c8             	mov    %rcx,%r8
+  8026a9:	48 89 d1             	mov    %rdx,%rcx
+  8026ac:	48 89 c2             	mov    %rax,%rdx
+  8026af:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b4:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026b9:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+  8026c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c9:	c9                   	leave
+  8026ca:	c3                   	ret
+
+00000000008026cb <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8026cb:	55                   	push   %rbp
+  8026cc:	48 89 e5             	mov    %rsp,%rbp
+  8026cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8026d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026d7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8026da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8026de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026e2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8026e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ed:	6a 00                	push   $0x0
+  8026ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f5:	49 89 c8             	mov    %rcx,%r8
+  8026f8:	48 89 d1             	mov    %rdx,%rcx
+  8026fb:	48 89 c2             	mov    %rax,%rdx
+  8026fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802703:	bf 14 00 00 00       	mov    $0x14,%edi
+  802708:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  80270f:	00 00 00 
+  802712:	ff d0                	call   *%rax
+  802714:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802718:	c9                   	leave
+  802719:	c3                   	ret
+
+000000000080271a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80271a:	55                   	push   %rbp
+  80271b:	48 89 e5             	mov    %rsp,%rbp
+  80271e:	48 83 ec 10          	sub    $0x10,%rsp
+  802722:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802726:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802729:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80272c:	48 63 d0             	movslq %eax,%rdx
+  80272f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802733:	48 83 ec 08          	sub    $0x8,%rsp
+  802737:	6a 00                	push   $0x0
+  802739:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802745:	48 89 d1             	mov    %rdx,%rcx
+  802748:	48 89 c2             	mov    %rax,%rdx
+  80274b:	be 00 00 00 00       	mov    $0x0,%esi
+  802750:	bf 15 00 00 00       	mov    $0x15,%edi
+  802755:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802765:	c9                   	leave
+  802766:	c3                   	ret
+
+0000000000802767 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	48 83 ec 20          	sub    $0x20,%rsp
+  80276f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802773:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802776:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802779:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80277d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802781:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802784:	48 63 c8             	movslq %eax,%rcx
+  802787:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80278a:	48 63 d0             	movslq %eax,%rdx
+  80278d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802791:	48 83 ec 08          	sub    $0x8,%rsp
+  802795:	6a 00                	push   $0x0
+  802797:	49 89 f1             	mov    %rsi,%r9
+  80279a:	49 89 c8             	mov    %rcx,%r8
+  80279d:	48 89 d1             	mov    %rdx,%rcx
+  8027a0:	48 89 c2             	mov    %rax,%rdx
+  8027a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a8:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027ad:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027bd:	c9                   	leave
+  8027be:	c3                   	ret
+
+00000000008027bf <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8027bf:	55                   	push   %rbp
+  8027c0:	48 89 e5             	mov    %rsp,%rbp
+  8027c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8027c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027d3:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8027d7:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8027db:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8027df:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8027e3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f3:	51                   	push   %rcx
+  8027f4:	49 89 f9             	mov    %rdi,%r9
+  8027f7:	49 89 f0             	mov    %rsi,%r8
+  8027fa:	48 89 d1             	mov    %rdx,%rcx
+  8027fd:	48 89 c2             	mov    %rax,%rdx
+  802800:	be 00 00 00 00       	mov    $0x0,%esi
+  802805:	bf 17 00 00 00       	mov    $0x17,%edi
+  80280a:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802811:	00 00 00 
+  802814:	ff d0                	call   *%rax
+  802816:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80281a:	c9                   	leave
+  80281b:	c3                   	ret
+
+000000000080281c <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80281c:	55                   	push   %rbp
+  80281d:	48 89 e5             	mov    %rsp,%rbp
+  802820:	48 83 ec 10          	sub    $0x10,%rsp
+  802824:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802827:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80282a:	48 98                	cltq
+  80282c:	48 83 ec 08          	sub    $0x8,%rsp
+  802830:	6a 00                	push   $0x0
+  802832:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802838:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80283e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802843:	48 89 c2             	mov    %rax,%rdx
+  802846:	be 00 00 00 00       	mov    $0x0,%esi
+  80284b:	bf 18 00 00 00       	mov    $0x18,%edi
+  802850:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802860:	90                   	nop
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+
+0000000000802863 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802863:	55                   	push   %rbp
+  802864:	48 89 e5             	mov    %rsp,%rbp
+  802867:	48 83 ec 30          	sub    $0x30,%rsp
+  80286b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80286e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802872:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802876:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802879:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80287c:	48 63 f0             	movslq %eax,%rsi
+  80287f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802883:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802887:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80288a:	48 98                	cltq
+  80288c:	48 83 ec 08          	sub    $0x8,%rsp
+  802890:	6a 00                	push   $0x0
+  802892:	49 89 f1             	mov    %rsi,%r9
+  802895:	49 89 c8             	mov    %rcx,%r8
+  802898:	48 89 d1             	mov    %rdx,%rcx
+  80289b:	48 89 c2             	mov    %rax,%rdx
+  80289e:	be 01 00 00 00       	mov    $0x1,%esi
+  8028a3:	bf 19 00 00 00       	mov    $0x19,%edi
+  8028a8:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	48 83 c4 10          	add    $0x10,%rsp
+  8028b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8028bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+
+00000000008028c0 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8028c0:	55                   	push   %rbp
+  8028c1:	48 89 e5             	mov    %rsp,%rbp
+  8028c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8028c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028d0:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8028d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028d6:	48 63 c8             	movslq %eax,%rcx
+  8028d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e5:	6a 00                	push   $0x0
+  8028e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ed:	49 89 c8             	mov    %rcx,%r8
+  8028f0:	48 89 d1             	mov    %rdx,%rcx
+  8028f3:	48 89 c2             	mov    %rax,%rdx
+  8028f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8028fb:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802900:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+  80290c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+
+0000000000802912 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802912:	55                   	push   %rbp
+  802913:	48 89 e5             	mov    %rsp,%rbp
+  802916:	48 83 ec 20          	sub    $0x20,%rsp
+  80291a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80291e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802922:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802926:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80292a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80292e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802932:	48 83 ec 08          	sub    $0x8,%rsp
+  802936:	6a 00                	push   $0x0
+  802938:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80293e:	49 89 c8             	mov    %rcx,%r8
+  802941:	48 89 d1             	mov    %rdx,%rcx
+  802944:	48 89 c2             	mov    %rax,%rdx
+  802947:	be 01 00 00 00       	mov    $0x1,%esi
+  80294c:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802951:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+  80295d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802961:	c9                   	leave
+  802962:	c3                   	ret
+
+0000000000802963 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802963:	55                   	push   %rbp
+  802964:	48 89 e5             	mov    %rsp,%rbp
+  802967:	48 83 ec 30          	sub    $0x30,%rsp
+  80296b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80296f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802973:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802976:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  80297a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80297e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802981:	48 63 c8             	movslq %eax,%rcx
+  802984:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802988:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80298c:	48 83 ec 08          	sub    $0x8,%rsp
+  802990:	6a 00                	push   $0x0
+  802992:	49 89 f1             	mov    %rsi,%r9
+  802995:	49 89 c8             	mov    %rcx,%r8
+  802998:	48 89 d1             	mov    %rdx,%rcx
+  80299b:	48 89 c2             	mov    %rax,%rdx
+  80299e:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a3:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8029a8:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	48 83 c4 10          	add    $0x10,%rsp
+  8029b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8029bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+00000000008029c0 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8029c8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8029cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029ce:	48 98                	cltq
+  8029d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d4:	6a 00                	push   $0x0
+  8029d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029e7:	48 89 c2             	mov    %rax,%rdx
+  8029ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ef:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8029f4:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a04:	c9                   	leave
+  802a05:	c3                   	ret
+
+0000000000802a06 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802a06:	55                   	push   %rbp
+  802a07:	48 89 e5             	mov    %rsp,%rbp
+  802a0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a16:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802a1d:	ff ff ff 
+  802a20:	48 01 d0             	add    %rdx,%rax
+  802a23:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a27:	c9                   	leave
+  802a28:	c3                   	ret
+
+0000000000802a29 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802a29:	55                   	push   %rbp
+  802a2a:	48 89 e5             	mov    %rsp,%rbp
+  802a2d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802a35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a39:	48 89 c7             	mov    %rax,%rdi
+  802a3c:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  802a43:	00 00 00 
+  802a46:	ff d0                	call   *%rax
+  802a48:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802a4e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802a52:	c9                   	leave
+  802a53:	c3                   	ret
+
+0000000000802a54 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802a54:	55                   	push   %rbp
+  802a55:	48 89 e5             	mov    %rsp,%rbp
+  802a58:	48 83 ec 18          	sub    $0x18,%rsp
+  802a5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802a60:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a67:	e9 ae 00 00 00       	jmp    802b1a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802a6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a6f:	c1 e0 0c             	shl    $0xc,%eax
+  802a72:	48 98                	cltq
+  802a74:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a79:	48 01 d0             	add    %rdx,%rax
+  802a7c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a84:	48 c1 e8 27          	shr    $0x27,%rax
+  802a88:	48 89 c2             	mov    %rax,%rdx
+  802a8b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a92:	01 00 00 
+  802a95:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a99:	83 e0 01             	and    $0x1,%eax
+  802a9c:	48 85 c0             	test   %rax,%rax
+  802a9f:	74 63                	je     802b04 <fd_alloc+0xb0>
+  802aa1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aa5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802aa9:	48 89 c2             	mov    %rax,%rdx
+  802aac:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802ab3:	01 00 00 
+  802ab6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aba:	83 e0 01             	and    $0x1,%eax
+  802abd:	48 85 c0             	test   %rax,%rax
+  802ac0:	74 42                	je     802b04 <fd_alloc+0xb0>
+  802ac2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac6:	48 c1 e8 15          	shr    $0x15,%rax
+  802aca:	48 89 c2             	mov    %rax,%rdx
+  802acd:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ad4:	01 00 00 
+  802ad7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802adb:	83 e0 01             	and    $0x1,%eax
+  802ade:	48 85 c0             	test   %rax,%rax
+  802ae1:	74 21                	je     802b04 <fd_alloc+0xb0>
+  802ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ae7:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aeb:	48 89 c2             	mov    %rax,%rdx
+  802aee:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802af5:	01 00 00 
+  802af8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802afc:	83 e0 01             	and    $0x1,%eax
+  802aff:	48 85 c0             	test   %rax,%rax
+  802b02:	75 12                	jne    802b16 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802b04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b0c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b14:	eb 1e                	jmp    802b34 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802b16:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b1a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b1e:	0f 8e 48 ff ff ff    	jle    802a6c <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b28:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802b2f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+
+0000000000802b36 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802b36:	55                   	push   %rbp
+  802b37:	48 89 e5             	mov    %rsp,%rbp
+  802b3a:	48 83 ec 20          	sub    $0x20,%rsp
+  802b3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802b45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b49:	78 06                	js     802b51 <fd_lookup+0x1b>
+  802b4b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b4f:	7e 0a                	jle    802b5b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802b51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b56:	e9 af 00 00 00       	jmp    802c0a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802b5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b5e:	c1 e0 0c             	shl    $0xc,%eax
+  802b61:	48 98                	cltq
+  802b63:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802b68:	48 01 d0             	add    %rdx,%rax
+  802b6b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b73:	48 c1 e8 27          	shr    $0x27,%rax
+  802b77:	48 89 c2             	mov    %rax,%rdx
+  802b7a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b81:	01 00 00 
+  802b84:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b88:	83 e0 01             	and    $0x1,%eax
+  802b8b:	48 85 c0             	test   %rax,%rax
+  802b8e:	74 63                	je     802bf3 <fd_lookup+0xbd>
+  802b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b94:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b98:	48 89 c2             	mov    %rax,%rdx
+  802b9b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802ba2:	01 00 00 
+  802ba5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ba9:	83 e0 01             	and    $0x1,%eax
+  802bac:	48 85 c0             	test   %rax,%rax
+  802baf:	74 42                	je     802bf3 <fd_lookup+0xbd>
+  802bb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb5:	48 c1 e8 15          	shr    $0x15,%rax
+  802bb9:	48 89 c2             	mov    %rax,%rdx
+  802bbc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bc3:	01 00 00 
+  802bc6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bca:	83 e0 01             	and    $0x1,%eax
+  802bcd:	48 85 c0             	test   %rax,%rax
+  802bd0:	74 21                	je     802bf3 <fd_lookup+0xbd>
+  802bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bd6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bda:	48 89 c2             	mov    %rax,%rdx
+  802bdd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802be4:	01 00 00 
+  802be7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802beb:	83 e0 01             	and    $0x1,%eax
+  802bee:	48 85 c0             	test   %rax,%rax
+  802bf1:	75 07                	jne    802bfa <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bf8:	eb 10                	jmp    802c0a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802bfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bfe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c02:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c0a:	c9                   	leave
+  802c0b:	c3                   	ret
+
+0000000000802c0c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802c0c:	55                   	push   %rbp
+  802c0d:	48 89 e5             	mov    %rsp,%rbp
+  802c10:	48 83 ec 30          	sub    $0x30,%rsp
+  802c14:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c18:	89 f0                	mov    %esi,%eax
+  802c1a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802c1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c21:	48 89 c7             	mov    %rax,%rdi
+  802c24:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	89 c2                	mov    %eax,%edx
+  802c32:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c36:	48 89 c6             	mov    %rax,%rsi
+  802c39:	89 d7                	mov    %edx,%edi
+  802c3b:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+  802c47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c4e:	78 0a                	js     802c5a <fd_close+0x4e>
+  802c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c54:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802c58:	74 12                	je     802c6c <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802c5a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802c5e:	74 05                	je     802c65 <fd_close+0x59>
+  802c60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c63:	eb 70                	jmp    802cd5 <fd_close+0xc9>
+  802c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6a:	eb 69                	jmp    802cd5 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c70:	8b 00                	mov    (%rax),%eax
+  802c72:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c76:	48 89 d6             	mov    %rdx,%rsi
+  802c79:	89 c7                	mov    %eax,%edi
+  802c7b:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c8e:	78 2a                	js     802cba <fd_close+0xae>
+    if (dev->dev_close)
+  802c90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c94:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c98:	48 85 c0             	test   %rax,%rax
+  802c9b:	74 16                	je     802cb3 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802ca5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ca9:	48 89 c7             	mov    %rax,%rdi
+  802cac:	ff d2                	call   *%rdx
+  802cae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cb1:	eb 07                	jmp    802cba <fd_close+0xae>
+    else
+      r = 0;
+  802cb3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802cba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cbe:	48 89 c6             	mov    %rax,%rsi
+  802cc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc6:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  802ccd:	00 00 00 
+  802cd0:	ff d0                	call   *%rax
+  return r;
+  802cd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802cd5:	c9                   	leave
+  802cd6:	c3                   	ret
+
+0000000000802cd7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	48 83 ec 20          	sub    $0x20,%rsp
+  802cdf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ce2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802ce6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ced:	eb 3f                	jmp    802d2e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802cef:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802cf6:	00 00 00 
+  802cf9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cfc:	48 98                	cltq
+  802cfe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d02:	8b 00                	mov    (%rax),%eax
+  802d04:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802d07:	75 21                	jne    802d2a <dev_lookup+0x53>
+      *dev = devtab[i];
+  802d09:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d10:	00 00 00 
+  802d13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d16:	48 98                	cltq
+  802d18:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d20:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d28:	eb 7f                	jmp    802da9 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802d2a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802d2e:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802d35:	00 00 00 
+  802d38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d3b:	48 98                	cltq
+  802d3d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d41:	48 85 c0             	test   %rax,%rax
+  802d44:	75 a9                	jne    802cef <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d46:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d4d:	00 00 00 
+  802d50:	8b 40 04             	mov    0x4(%rax),%eax
+  802d53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d5f:	00 00 00 
+  802d62:	48 98                	cltq
+  802d64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802d6b:	48 01 d0             	add    %rdx,%rax
+  802d6e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802d74:	8b 00                	mov    (%rax),%eax
+  802d76:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d79:	89 c6                	mov    %eax,%esi
+  802d7b:	48 b8 38 5b 80 00 00 	movabs $0x805b38,%rax
+  802d82:	00 00 00 
+  802d85:	48 89 c7             	mov    %rax,%rdi
+  802d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8d:	48 b9 a1 05 80 00 00 	movabs $0x8005a1,%rcx
+  802d94:	00 00 00 
+  802d97:	ff d1                	call   *%rcx
+  *dev = 0;
+  802d99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d9d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802da4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802da9:	c9                   	leave
+  802daa:	c3                   	ret
+
+0000000000802dab <close>:
+
+int
+close(int fdnum) {
+  802dab:	55                   	push   %rbp
+  802dac:	48 89 e5             	mov    %rsp,%rbp
+  802daf:	48 83 ec 20          	sub    $0x20,%rsp
+  802db3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802db6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802dba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dbd:	48 89 d6             	mov    %rdx,%rsi
+  802dc0:	89 c7                	mov    %eax,%edi
+  802dc2:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  802dc9:	00 00 00 
+  802dcc:	ff d0                	call   *%rax
+  802dce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dd1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dd5:	79 05                	jns    802ddc <close+0x31>
+    return r;
+  802dd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dda:	eb 18                	jmp    802df4 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802ddc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802de0:	be 01 00 00 00       	mov    $0x1,%esi
+  802de5:	48 89 c7             	mov    %rax,%rdi
+  802de8:	48 b8 0c 2c 80 00 00 	movabs $0x802c0c,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+}
+  802df4:	c9                   	leave
+  802df5:	c3                   	ret
+
+0000000000802df6 <close_all>:
+
+void
+close_all(void) {
+  802df6:	55                   	push   %rbp
+  802df7:	48 89 e5             	mov    %rsp,%rbp
+  802dfa:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802dfe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e05:	eb 15                	jmp    802e1c <close_all+0x26>
+    close(i);
+  802e07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e0a:	89 c7                	mov    %eax,%edi
+  802e0c:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802e13:	00 00 00 
+  802e16:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802e18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802e1c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802e20:	7e e5                	jle    802e07 <close_all+0x11>
+}
+  802e22:	90                   	nop
+  802e23:	90                   	nop
+  802e24:	c9                   	leave
+  802e25:	c3                   	ret
+
+0000000000802e26 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802e26:	55                   	push   %rbp
+  802e27:	48 89 e5             	mov    %rsp,%rbp
+  802e2a:	48 83 ec 40          	sub    $0x40,%rsp
+  802e2e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e31:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e34:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802e38:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e3b:	48 89 d6             	mov    %rdx,%rsi
+  802e3e:	89 c7                	mov    %eax,%edi
+  802e40:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  802e47:	00 00 00 
+  802e4a:	ff d0                	call   *%rax
+  802e4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e4f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e53:	79 08                	jns    802e5d <dup+0x37>
+    return r;
+  802e55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e58:	e9 33 02 00 00       	jmp    803090 <dup+0x26a>
+  close(newfdnum);
+  802e5d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e60:	89 c7                	mov    %eax,%edi
+  802e62:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802e6e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e71:	c1 e0 0c             	shl    $0xc,%eax
+  802e74:	48 98                	cltq
+  802e76:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802e7b:	48 01 d0             	add    %rdx,%rax
+  802e7e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802e82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e86:	48 89 c7             	mov    %rax,%rdi
+  802e89:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802e99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e9d:	48 89 c7             	mov    %rax,%rdi
+  802ea0:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+  802eac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802eb0:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802eb7:	00 
+  802eb8:	e9 19 01 00 00       	jmp    802fd6 <dup+0x1b0>
+    off -= PGSIZE;
+  802ebd:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802ec4:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ec5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ec9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ecd:	48 01 d0             	add    %rdx,%rax
+  802ed0:	48 c1 e8 27          	shr    $0x27,%rax
+  802ed4:	48 89 c2             	mov    %rax,%rdx
+  802ed7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ede:	01 00 00 
+  802ee1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ee5:	83 e0 01             	and    $0x1,%eax
+  802ee8:	48 85 c0             	test   %rax,%rax
+  802eeb:	0f 84 e5 00 00 00    	je     802fd6 <dup+0x1b0>
+  802ef1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ef5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ef9:	48 01 d0             	add    %rdx,%rax
+  802efc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f00:	48 89 c2             	mov    %rax,%rdx
+  802f03:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f0a:	01 00 00 
+  802f0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f11:	83 e0 01             	and    $0x1,%eax
+  802f14:	48 85 c0             	test   %rax,%rax
+  802f17:	0f 84 b9 00 00 00    	je     802fd6 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f1d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f25:	48 01 d0             	add    %rdx,%rax
+  802f28:	48 c1 e8 15          	shr    $0x15,%rax
+  802f2c:	48 89 c2             	mov    %rax,%rdx
+  802f2f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f36:	01 00 00 
+  802f39:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f3d:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802f40:	48 85 c0             	test   %rax,%rax
+  802f43:	0f 84 8d 00 00 00    	je     802fd6 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802f49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f51:	48 01 d0             	add    %rdx,%rax
+  802f54:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f58:	48 89 c2             	mov    %rax,%rdx
+  802f5b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f62:	01 00 00 
+  802f65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f69:	83 e0 01             	and    $0x1,%eax
+  802f6c:	48 85 c0             	test   %rax,%rax
+  802f6f:	74 65                	je     802fd6 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802f71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f79:	48 01 d0             	add    %rdx,%rax
+  802f7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f80:	48 89 c2             	mov    %rax,%rdx
+  802f83:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802f8a:	01 00 00 
+  802f8d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f91:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f96:	89 c6                	mov    %eax,%esi
+  802f98:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fa0:	48 01 c2             	add    %rax,%rdx
+  802fa3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802fa7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fab:	48 01 c8             	add    %rcx,%rax
+  802fae:	41 89 f0             	mov    %esi,%r8d
+  802fb1:	48 89 d1             	mov    %rdx,%rcx
+  802fb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb9:	48 89 c6             	mov    %rax,%rsi
+  802fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc1:	48 b8 77 23 80 00 00 	movabs $0x802377,%rax
+  802fc8:	00 00 00 
+  802fcb:	ff d0                	call   *%rax
+  802fcd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fd4:	78 60                	js     803036 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802fd6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802fdb:	0f 85 dc fe ff ff    	jne    802ebd <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802fe1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fe5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fe9:	48 89 c2             	mov    %rax,%rdx
+  802fec:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ff3:	01 00 00 
+  802ff6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ffa:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fff:	89 c1                	mov    %eax,%ecx
+  803001:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803005:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803009:	41 89 c8             	mov    %ecx,%r8d
+  80300c:	48 89 d1             	mov    %rdx,%rcx
+  80300f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803014:	48 89 c6             	mov    %rax,%rsi
+  803017:	bf 00 00 00 00       	mov    $0x0,%edi
+  80301c:	48 b8 77 23 80 00 00 	movabs $0x802377,%rax
+  803023:	00 00 00 
+  803026:	ff d0                	call   *%rax
+  803028:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80302b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80302f:	78 08                	js     803039 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803031:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803034:	eb 5a                	jmp    803090 <dup+0x26a>
+        goto err;
+  803036:	90                   	nop
+  803037:	eb 01                	jmp    80303a <dup+0x214>
+    goto err;
+  803039:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80303a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303e:	48 89 c6             	mov    %rax,%rsi
+  803041:	bf 00 00 00 00       	mov    $0x0,%edi
+  803046:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803052:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803059:	00 
+  80305a:	eb 27                	jmp    803083 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80305c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803060:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803064:	48 01 d0             	add    %rdx,%rax
+  803067:	48 89 c6             	mov    %rax,%rsi
+  80306a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80306f:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  803076:	00 00 00 
+  803079:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80307b:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803082:	00 
+  803083:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80308a:	00 
+  80308b:	76 cf                	jbe    80305c <dup+0x236>
+  return r;
+  80308d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803090:	c9                   	leave
+  803091:	c3                   	ret
+
+0000000000803092 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803092:	55                   	push   %rbp
+  803093:	48 89 e5             	mov    %rsp,%rbp
+  803096:	48 83 ec 40          	sub    $0x40,%rsp
+  80309a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80309d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030a1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030a5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030ac:	48 89 d6             	mov    %rdx,%rsi
+  8030af:	89 c7                	mov    %eax,%edi
+  8030b1:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  8030b8:	00 00 00 
+  8030bb:	ff d0                	call   *%rax
+  8030bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030c4:	78 24                	js     8030ea <read+0x58>
+  8030c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ca:	8b 00                	mov    (%rax),%eax
+  8030cc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030d0:	48 89 d6             	mov    %rdx,%rsi
+  8030d3:	89 c7                	mov    %eax,%edi
+  8030d5:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  8030dc:	00 00 00 
+  8030df:	ff d0                	call   *%rax
+  8030e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030e8:	79 0a                	jns    8030f4 <read+0x62>
+    return r;
+  8030ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ed:	48 98                	cltq
+  8030ef:	e9 9e 00 00 00       	jmp    803192 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8030f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f8:	8b 40 08             	mov    0x8(%rax),%eax
+  8030fb:	83 e0 03             	and    $0x3,%eax
+  8030fe:	83 f8 01             	cmp    $0x1,%eax
+  803101:	75 5c                	jne    80315f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803103:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80310a:	00 00 00 
+  80310d:	8b 40 04             	mov    0x4(%rax),%eax
+  803110:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803115:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80311c:	00 00 00 
+  80311f:	48 98                	cltq
+  803121:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803128:	48 01 d0             	add    %rdx,%rax
+  80312b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803131:	8b 00                	mov    (%rax),%eax
+  803133:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803136:	89 c6                	mov    %eax,%esi
+  803138:	48 b8 57 5b 80 00 00 	movabs $0x805b57,%rax
+  80313f:	00 00 00 
+  803142:	48 89 c7             	mov    %rax,%rdi
+  803145:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314a:	48 b9 a1 05 80 00 00 	movabs $0x8005a1,%rcx
+  803151:	00 00 00 
+  803154:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803156:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80315d:	eb 33                	jmp    803192 <read+0x100>
+  }
+  if (!dev->dev_read)
+  80315f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803163:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803167:	48 85 c0             	test   %rax,%rax
+  80316a:	75 09                	jne    803175 <read+0xe3>
+    return -E_NOT_SUPP;
+  80316c:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803173:	eb 1d                	jmp    803192 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803175:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803179:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80317d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803181:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803185:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803189:	48 89 ce             	mov    %rcx,%rsi
+  80318c:	48 89 c7             	mov    %rax,%rdi
+  80318f:	41 ff d0             	call   *%r8
+}
+  803192:	c9                   	leave
+  803193:	c3                   	ret
+
+0000000000803194 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803194:	55                   	push   %rbp
+  803195:	48 89 e5             	mov    %rsp,%rbp
+  803198:	48 83 ec 30          	sub    $0x30,%rsp
+  80319c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80319f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8031a3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8031a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8031ae:	eb 49                	jmp    8031f9 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8031b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031b3:	48 98                	cltq
+  8031b5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031b9:	48 29 c2             	sub    %rax,%rdx
+  8031bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031bf:	48 63 c8             	movslq %eax,%rcx
+  8031c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031c6:	48 01 c1             	add    %rax,%rcx
+  8031c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031cc:	48 89 ce             	mov    %rcx,%rsi
+  8031cf:	89 c7                	mov    %eax,%edi
+  8031d1:	48 b8 92 30 80 00 00 	movabs $0x803092,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8031e0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031e4:	79 07                	jns    8031ed <readn+0x59>
+      return m;
+  8031e6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031e9:	48 98                	cltq
+  8031eb:	eb 1f                	jmp    80320c <readn+0x78>
+    if (m == 0)
+  8031ed:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8031f1:	74 13                	je     803206 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8031f3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8031f6:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8031f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031fc:	48 98                	cltq
+  8031fe:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803202:	72 ac                	jb     8031b0 <readn+0x1c>
+  803204:	eb 01                	jmp    803207 <readn+0x73>
+      break;
+  803206:	90                   	nop
+  }
+  return tot;
+  803207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80320a:	48 98                	cltq
+}
+  80320c:	c9                   	leave
+  80320d:	c3                   	ret
+
+000000000080320e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80320e:	55                   	push   %rbp
+  80320f:	48 89 e5             	mov    %rsp,%rbp
+  803212:	48 83 ec 40          	sub    $0x40,%rsp
+  803216:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803219:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80321d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803221:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803225:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803228:	48 89 d6             	mov    %rdx,%rsi
+  80322b:	89 c7                	mov    %eax,%edi
+  80322d:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+  803239:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80323c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803240:	78 24                	js     803266 <write+0x58>
+  803242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803246:	8b 00                	mov    (%rax),%eax
+  803248:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80324c:	48 89 d6             	mov    %rdx,%rsi
+  80324f:	89 c7                	mov    %eax,%edi
+  803251:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+  80325d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803260:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803264:	79 0a                	jns    803270 <write+0x62>
+    return r;
+  803266:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803269:	48 98                	cltq
+  80326b:	e9 9d 00 00 00       	jmp    80330d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803274:	8b 40 08             	mov    0x8(%rax),%eax
+  803277:	83 e0 03             	and    $0x3,%eax
+  80327a:	85 c0                	test   %eax,%eax
+  80327c:	75 5c                	jne    8032da <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80327e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803285:	00 00 00 
+  803288:	8b 40 04             	mov    0x4(%rax),%eax
+  80328b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803290:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803297:	00 00 00 
+  80329a:	48 98                	cltq
+  80329c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032a3:	48 01 d0             	add    %rdx,%rax
+  8032a6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032ac:	8b 00                	mov    (%rax),%eax
+  8032ae:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8032b1:	89 c6                	mov    %eax,%esi
+  8032b3:	48 b8 73 5b 80 00 00 	movabs $0x805b73,%rax
+  8032ba:	00 00 00 
+  8032bd:	48 89 c7             	mov    %rax,%rdi
+  8032c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c5:	48 b9 a1 05 80 00 00 	movabs $0x8005a1,%rcx
+  8032cc:	00 00 00 
+  8032cf:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8032d1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032d8:	eb 33                	jmp    80330d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8032da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032de:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032e2:	48 85 c0             	test   %rax,%rax
+  8032e5:	75 09                	jne    8032f0 <write+0xe2>
+    return -E_NOT_SUPP;
+  8032e7:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8032ee:	eb 1d                	jmp    80330d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8032f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032f4:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8032f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803300:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803304:	48 89 ce             	mov    %rcx,%rsi
+  803307:	48 89 c7             	mov    %rax,%rdi
+  80330a:	41 ff d0             	call   *%r8
+}
+  80330d:	c9                   	leave
+  80330e:	c3                   	ret
+
+000000000080330f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80330f:	55                   	push   %rbp
+  803310:	48 89 e5             	mov    %rsp,%rbp
+  803313:	48 83 ec 18          	sub    $0x18,%rsp
+  803317:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80331a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80331d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803321:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803324:	48 89 d6             	mov    %rdx,%rsi
+  803327:	89 c7                	mov    %eax,%edi
+  803329:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  803330:	00 00 00 
+  803333:	ff d0                	call   *%rax
+  803335:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803338:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80333c:	79 05                	jns    803343 <seek+0x34>
+    return r;
+  80333e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803341:	eb 0f                	jmp    803352 <seek+0x43>
+  fd->fd_offset = offset;
+  803343:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803347:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80334a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80334d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+
+0000000000803354 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803354:	55                   	push   %rbp
+  803355:	48 89 e5             	mov    %rsp,%rbp
+  803358:	48 83 ec 30          	sub    $0x30,%rsp
+  80335c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80335f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803362:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803366:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803369:	48 89 d6             	mov    %rdx,%rsi
+  80336c:	89 c7                	mov    %eax,%edi
+  80336e:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+  80337a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80337d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803381:	78 24                	js     8033a7 <ftruncate+0x53>
+  803383:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803387:	8b 00                	mov    (%rax),%eax
+  803389:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80338d:	48 89 d6             	mov    %rdx,%rsi
+  803390:	89 c7                	mov    %eax,%edi
+  803392:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+  80339e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033a5:	79 08                	jns    8033af <ftruncate+0x5b>
+    return r;
+  8033a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033aa:	e9 92 00 00 00       	jmp    803441 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b3:	8b 40 08             	mov    0x8(%rax),%eax
+  8033b6:	83 e0 03             	and    $0x3,%eax
+  8033b9:	85 c0                	test   %eax,%eax
+  8033bb:	75 5a                	jne    803417 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8033bd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033c4:	00 00 00 
+  8033c7:	8b 40 04             	mov    0x4(%rax),%eax
+  8033ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033cf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033d6:	00 00 00 
+  8033d9:	48 98                	cltq
+  8033db:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033e2:	48 01 d0             	add    %rdx,%rax
+  8033e5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033eb:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033f0:	89 c6                	mov    %eax,%esi
+  8033f2:	48 b8 90 5b 80 00 00 	movabs $0x805b90,%rax
+  8033f9:	00 00 00 
+  8033fc:	48 89 c7             	mov    %rax,%rdi
+  8033ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803404:	48 b9 a1 05 80 00 00 	movabs $0x8005a1,%rcx
+  80340b:	00 00 00 
+  80340e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803410:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803415:	eb 2a                	jmp    803441 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803417:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80341b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80341f:	48 85 c0             	test   %rax,%rax
+  803422:	75 07                	jne    80342b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803424:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803429:	eb 16                	jmp    803441 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80342b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803433:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803437:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80343a:	89 d6                	mov    %edx,%esi
+  80343c:	48 89 c7             	mov    %rax,%rdi
+  80343f:	ff d1                	call   *%rcx
+}
+  803441:	c9                   	leave
+  803442:	c3                   	ret
+
+0000000000803443 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803443:	55                   	push   %rbp
+  803444:	48 89 e5             	mov    %rsp,%rbp
+  803447:	48 83 ec 30          	sub    $0x30,%rsp
+  80344b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80344e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803452:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803456:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803459:	48 89 d6             	mov    %rdx,%rsi
+  80345c:	89 c7                	mov    %eax,%edi
+  80345e:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+  80346a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80346d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803471:	78 24                	js     803497 <fstat+0x54>
+  803473:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803477:	8b 00                	mov    (%rax),%eax
+  803479:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80347d:	48 89 d6             	mov    %rdx,%rsi
+  803480:	89 c7                	mov    %eax,%edi
+  803482:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+  80348e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803491:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803495:	79 05                	jns    80349c <fstat+0x59>
+    return r;
+  803497:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80349a:	eb 5e                	jmp    8034fa <fstat+0xb7>
+  if (!dev->dev_stat)
+  80349c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034a0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034a4:	48 85 c0             	test   %rax,%rax
+  8034a7:	75 07                	jne    8034b0 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8034a9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8034ae:	eb 4a                	jmp    8034fa <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8034b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034b4:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8034b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034bb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034c2:	00 00 00 
+  stat->st_isdir   = 0;
+  8034c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034c9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034d0:	00 00 00 
+  stat->st_dev     = dev;
+  8034d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8034d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034db:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8034e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034e6:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ee:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034f2:	48 89 d6             	mov    %rdx,%rsi
+  8034f5:	48 89 c7             	mov    %rax,%rdi
+  8034f8:	ff d1                	call   *%rcx
+}
+  8034fa:	c9                   	leave
+  8034fb:	c3                   	ret
+
+00000000008034fc <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8034fc:	55                   	push   %rbp
+  8034fd:	48 89 e5             	mov    %rsp,%rbp
+  803500:	48 83 ec 10          	sub    $0x10,%rsp
+  803504:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803508:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80350c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803510:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803516:	83 f8 20             	cmp    $0x20,%eax
+  803519:	75 07                	jne    803522 <pollwait_key+0x26>
+    return -E_INVAL;
+  80351b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803520:	eb 5f                	jmp    803581 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803526:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80352c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803530:	48 63 d2             	movslq %edx,%rdx
+  803533:	48 c1 e2 04          	shl    $0x4,%rdx
+  803537:	48 01 c2             	add    %rax,%rdx
+  80353a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80353e:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803541:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803545:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80354b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80354f:	8b 00                	mov    (%rax),%eax
+  803551:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803555:	48 63 c9             	movslq %ecx,%rcx
+  803558:	48 c1 e1 04          	shl    $0x4,%rcx
+  80355c:	48 01 ca             	add    %rcx,%rdx
+  80355f:	48 83 c2 08          	add    $0x8,%rdx
+  803563:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803569:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80356f:	8d 50 01             	lea    0x1(%rax),%edx
+  803572:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803576:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80357c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803581:	c9                   	leave
+  803582:	c3                   	ret
+
+0000000000803583 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803583:	55                   	push   %rbp
+  803584:	48 89 e5             	mov    %rsp,%rbp
+  803587:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80358e:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803595:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80359b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8035a2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8035a9:	00 
+  int i, r, ready, ipc = 0;
+  8035aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8035b1:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8035b8:	00 
+  8035b9:	74 45                	je     803600 <poll+0x7d>
+  8035bb:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8035c2:	ff 
+  8035c3:	74 3b                	je     803600 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8035c5:	48 b8 d7 4d 80 00 00 	movabs $0x804dd7,%rax
+  8035cc:	00 00 00 
+  8035cf:	ff d0                	call   *%rax
+  8035d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8035d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035d9:	48 f7 d0             	not    %rax
+  8035dc:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8035e3:	73 10                	jae    8035f5 <poll+0x72>
+  8035e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035e9:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8035f0:	48 01 d0             	add    %rdx,%rax
+  8035f3:	eb 07                	jmp    8035fc <poll+0x79>
+  8035f5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8035fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803600:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803607:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80360e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803615:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80361c:	e9 46 02 00 00       	jmp    803867 <poll+0x2e4>
+      fds[i].revents = 0;
+  803621:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803624:	48 63 d0             	movslq %eax,%rdx
+  803627:	48 89 d0             	mov    %rdx,%rax
+  80362a:	48 01 c0             	add    %rax,%rax
+  80362d:	48 01 d0             	add    %rdx,%rax
+  803630:	48 c1 e0 02          	shl    $0x2,%rax
+  803634:	48 89 c2             	mov    %rax,%rdx
+  803637:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80363e:	48 01 d0             	add    %rdx,%rax
+  803641:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803648:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80364b:	48 63 d0             	movslq %eax,%rdx
+  80364e:	48 89 d0             	mov    %rdx,%rax
+  803651:	48 01 c0             	add    %rax,%rax
+  803654:	48 01 d0             	add    %rdx,%rax
+  803657:	48 c1 e0 02          	shl    $0x2,%rax
+  80365b:	48 89 c2             	mov    %rax,%rdx
+  80365e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803665:	48 01 d0             	add    %rdx,%rax
+  803668:	8b 00                	mov    (%rax),%eax
+  80366a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80366d:	75 62                	jne    8036d1 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80366f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803672:	48 63 d0             	movslq %eax,%rdx
+  803675:	48 89 d0             	mov    %rdx,%rax
+  803678:	48 01 c0             	add    %rax,%rax
+  80367b:	48 01 d0             	add    %rdx,%rax
+  80367e:	48 c1 e0 02          	shl    $0x2,%rax
+  803682:	48 89 c2             	mov    %rax,%rdx
+  803685:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80368c:	48 01 d0             	add    %rdx,%rax
+  80368f:	8b 40 04             	mov    0x4(%rax),%eax
+  803692:	83 e0 01             	and    $0x1,%eax
+  803695:	85 c0                	test   %eax,%eax
+  803697:	0f 84 9b 01 00 00    	je     803838 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80369d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036a0:	48 63 d0             	movslq %eax,%rdx
+  8036a3:	48 89 d0             	mov    %rdx,%rax
+  8036a6:	48 01 c0             	add    %rax,%rax
+  8036a9:	48 01 d0             	add    %rdx,%rax
+  8036ac:	48 c1 e0 02          	shl    $0x2,%rax
+  8036b0:	48 89 c2             	mov    %rax,%rdx
+  8036b3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036ba:	48 01 c2             	add    %rax,%rdx
+  8036bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036c0:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8036c3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8036c6:	83 c8 04             	or     $0x4,%eax
+  8036c9:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8036cc:	e9 67 01 00 00       	jmp    803838 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8036d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036d4:	48 63 d0             	movslq %eax,%rdx
+  8036d7:	48 89 d0             	mov    %rdx,%rax
+  8036da:	48 01 c0             	add    %rax,%rax
+  8036dd:	48 01 d0             	add    %rdx,%rax
+  8036e0:	48 c1 e0 02          	shl    $0x2,%rax
+  8036e4:	48 89 c2             	mov    %rax,%rdx
+  8036e7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036ee:	48 01 d0             	add    %rdx,%rax
+  8036f1:	8b 00                	mov    (%rax),%eax
+  8036f3:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8036fa:	48 89 d6             	mov    %rdx,%rsi
+  8036fd:	89 c7                	mov    %eax,%edi
+  8036ff:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  803706:	00 00 00 
+  803709:	ff d0                	call   *%rax
+  80370b:	85 c0                	test   %eax,%eax
+  80370d:	78 25                	js     803734 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80370f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803716:	8b 00                	mov    (%rax),%eax
+  803718:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80371f:	48 89 d6             	mov    %rdx,%rsi
+  803722:	89 c7                	mov    %eax,%edi
+  803724:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  80372b:	00 00 00 
+  80372e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803730:	85 c0                	test   %eax,%eax
+  803732:	79 2c                	jns    803760 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803734:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803737:	48 63 d0             	movslq %eax,%rdx
+  80373a:	48 89 d0             	mov    %rdx,%rax
+  80373d:	48 01 c0             	add    %rax,%rax
+  803740:	48 01 d0             	add    %rdx,%rax
+  803743:	48 c1 e0 02          	shl    $0x2,%rax
+  803747:	48 89 c2             	mov    %rax,%rdx
+  80374a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803751:	48 01 d0             	add    %rdx,%rax
+  803754:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80375b:	e9 d8 00 00 00       	jmp    803838 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803760:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803767:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80376b:	48 85 c0             	test   %rax,%rax
+  80376e:	74 7d                	je     8037ed <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803770:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803777:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80377b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80377e:	48 63 d0             	movslq %eax,%rdx
+  803781:	48 89 d0             	mov    %rdx,%rax
+  803784:	48 01 c0             	add    %rax,%rax
+  803787:	48 01 d0             	add    %rdx,%rax
+  80378a:	48 c1 e0 02          	shl    $0x2,%rax
+  80378e:	48 89 c2             	mov    %rax,%rdx
+  803791:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803798:	48 01 d0             	add    %rdx,%rax
+  80379b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80379e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8037a5:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8037ac:	89 ce                	mov    %ecx,%esi
+  8037ae:	48 89 c7             	mov    %rax,%rdi
+  8037b1:	41 ff d0             	call   *%r8
+  8037b4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8037b7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037bb:	79 08                	jns    8037c5 <poll+0x242>
+          return r;
+  8037bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037c0:	e9 45 01 00 00       	jmp    80390a <poll+0x387>
+        fds[i].revents = r;
+  8037c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037c8:	48 63 d0             	movslq %eax,%rdx
+  8037cb:	48 89 d0             	mov    %rdx,%rax
+  8037ce:	48 01 c0             	add    %rax,%rax
+  8037d1:	48 01 d0             	add    %rdx,%rax
+  8037d4:	48 c1 e0 02          	shl    $0x2,%rax
+  8037d8:	48 89 c2             	mov    %rax,%rdx
+  8037db:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037e2:	48 01 c2             	add    %rax,%rdx
+  8037e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037e8:	89 42 08             	mov    %eax,0x8(%rdx)
+  8037eb:	eb 4b                	jmp    803838 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8037ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037f0:	48 63 d0             	movslq %eax,%rdx
+  8037f3:	48 89 d0             	mov    %rdx,%rax
+  8037f6:	48 01 c0             	add    %rax,%rax
+  8037f9:	48 01 d0             	add    %rdx,%rax
+  8037fc:	48 c1 e0 02          	shl    $0x2,%rax
+  803800:	48 89 c2             	mov    %rax,%rdx
+  803803:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80380a:	48 01 d0             	add    %rdx,%rax
+  80380d:	8b 48 04             	mov    0x4(%rax),%ecx
+  803810:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803813:	48 63 d0             	movslq %eax,%rdx
+  803816:	48 89 d0             	mov    %rdx,%rax
+  803819:	48 01 c0             	add    %rax,%rax
+  80381c:	48 01 d0             	add    %rdx,%rax
+  80381f:	48 c1 e0 02          	shl    $0x2,%rax
+  803823:	48 89 c2             	mov    %rax,%rdx
+  803826:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80382d:	48 01 d0             	add    %rdx,%rax
+  803830:	83 e1 03             	and    $0x3,%ecx
+  803833:	89 ca                	mov    %ecx,%edx
+  803835:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803838:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80383b:	48 63 d0             	movslq %eax,%rdx
+  80383e:	48 89 d0             	mov    %rdx,%rax
+  803841:	48 01 c0             	add    %rax,%rax
+  803844:	48 01 d0             	add    %rdx,%rax
+  803847:	48 c1 e0 02          	shl    $0x2,%rax
+  80384b:	48 89 c2             	mov    %rax,%rdx
+  80384e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803855:	48 01 d0             	add    %rdx,%rax
+  803858:	8b 40 08             	mov    0x8(%rax),%eax
+  80385b:	85 c0                	test   %eax,%eax
+  80385d:	74 04                	je     803863 <poll+0x2e0>
+        ready++;
+  80385f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803863:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803867:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80386a:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803870:	0f 8c ab fd ff ff    	jl     803621 <poll+0x9e>
+    }
+    if (ready)
+  803876:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80387a:	74 08                	je     803884 <poll+0x301>
+      return ready;
+  80387c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80387f:	e9 86 00 00 00       	jmp    80390a <poll+0x387>
+
+    if (deadline) {
+  803884:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803889:	74 30                	je     8038bb <poll+0x338>
+      now     = vsys_clock_ns();
+  80388b:	48 b8 d7 4d 80 00 00 	movabs $0x804dd7,%rax
+  803892:	00 00 00 
+  803895:	ff d0                	call   *%rax
+  803897:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80389b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80389f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8038a3:	73 0a                	jae    8038af <poll+0x32c>
+  8038a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038a9:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8038ad:	eb 05                	jmp    8038b4 <poll+0x331>
+  8038af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b4:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8038bb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8038be:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8038c1:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8038c8:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8038cf:	48 89 c7             	mov    %rax,%rdi
+  8038d2:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8038d9:	00 00 00 
+  8038dc:	ff d0                	call   *%rax
+  8038de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8038e1:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8038e5:	75 07                	jne    8038ee <poll+0x36b>
+      return 0;
+  8038e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ec:	eb 1c                	jmp    80390a <poll+0x387>
+    if (r < 0)
+  8038ee:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038f2:	79 05                	jns    8038f9 <poll+0x376>
+      return r;
+  8038f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038f7:	eb 11                	jmp    80390a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8038f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038fc:	c1 f8 02             	sar    $0x2,%eax
+  8038ff:	83 e0 01             	and    $0x1,%eax
+  803902:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803905:	e9 f6 fc ff ff       	jmp    803600 <poll+0x7d>
+  }
+}
+  80390a:	c9                   	leave
+  80390b:	c3                   	ret
+
+000000000080390c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	48 83 ec 20          	sub    $0x20,%rsp
+  803914:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803918:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80391c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803920:	be 00 00 00 00       	mov    $0x0,%esi
+  803925:	48 89 c7             	mov    %rax,%rdi
+  803928:	48 b8 fa 39 80 00 00 	movabs $0x8039fa,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+  803934:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803937:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80393b:	79 05                	jns    803942 <stat+0x36>
+    return fd;
+  80393d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803940:	eb 2f                	jmp    803971 <stat+0x65>
+  r = fstat(fd, stat);
+  803942:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803946:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803949:	48 89 d6             	mov    %rdx,%rsi
+  80394c:	89 c7                	mov    %eax,%edi
+  80394e:	48 b8 43 34 80 00 00 	movabs $0x803443,%rax
+  803955:	00 00 00 
+  803958:	ff d0                	call   *%rax
+  80395a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80395d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803960:	89 c7                	mov    %eax,%edi
+  803962:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  803969:	00 00 00 
+  80396c:	ff d0                	call   *%rax
+  return r;
+  80396e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803971:	c9                   	leave
+  803972:	c3                   	ret
+
+0000000000803973 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803973:	55                   	push   %rbp
+  803974:	48 89 e5             	mov    %rsp,%rbp
+  803977:	48 83 ec 10          	sub    $0x10,%rsp
+  80397b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80397e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803982:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803989:	00 00 00 
+  80398c:	8b 00                	mov    (%rax),%eax
+  80398e:	85 c0                	test   %eax,%eax
+  803990:	75 1d                	jne    8039af <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803992:	bf 03 00 00 00       	mov    $0x3,%edi
+  803997:	48 b8 f2 53 80 00 00 	movabs $0x8053f2,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8039aa:	00 00 00 
+  8039ad:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8039af:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8039b6:	00 00 00 
+  8039b9:	8b 00                	mov    (%rax),%eax
+  8039bb:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8039be:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8039c3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8039ca:	00 00 00 
+  8039cd:	89 c7                	mov    %eax,%edi
+  8039cf:	48 b8 45 53 80 00 00 	movabs $0x805345,%rax
+  8039d6:	00 00 00 
+  8039d9:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8039db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039e4:	48 89 c6             	mov    %rax,%rsi
+  8039e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ec:	48 b8 c8 51 80 00 00 	movabs $0x8051c8,%rax
+  8039f3:	00 00 00 
+  8039f6:	ff d0                	call   *%rax
+}
+  8039f8:	c9                   	leave
+  8039f9:	c3                   	ret
+
+00000000008039fa <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8039fa:	55                   	push   %rbp
+  8039fb:	48 89 e5             	mov    %rsp,%rbp
+  8039fe:	48 83 ec 20          	sub    $0x20,%rsp
+  803a02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a06:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a0d:	48 89 c7             	mov    %rax,%rdi
+  803a10:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  803a17:	00 00 00 
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a21:	7e 0a                	jle    803a2d <open+0x33>
+    return -E_BAD_PATH;
+  803a23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a28:	e9 a8 00 00 00       	jmp    803ad5 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803a2d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a31:	48 89 c7             	mov    %rax,%rdi
+  803a34:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  803a3b:	00 00 00 
+  803a3e:	ff d0                	call   *%rax
+  803a40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a47:	79 08                	jns    803a51 <open+0x57>
+    return r;
+  803a49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a4c:	e9 84 00 00 00       	jmp    803ad5 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a55:	48 89 c6             	mov    %rax,%rsi
+  803a58:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803a5f:	00 00 00 
+  803a62:	48 89 c7             	mov    %rax,%rdi
+  803a65:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  803a6c:	00 00 00 
+  803a6f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803a71:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803a78:	00 00 00 
+  803a7b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a7e:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a88:	48 89 c6             	mov    %rax,%rsi
+  803a8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a90:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803a97:	00 00 00 
+  803a9a:	ff d0                	call   *%rax
+  803a9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aa3:	79 1d                	jns    803ac2 <open+0xc8>
+    fd_close(fd, 0);
+  803aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa9:	be 00 00 00 00       	mov    $0x0,%esi
+  803aae:	48 89 c7             	mov    %rax,%rdi
+  803ab1:	48 b8 0c 2c 80 00 00 	movabs $0x802c0c,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+    return r;
+  803abd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ac0:	eb 13                	jmp    803ad5 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803ac2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ac6:	48 89 c7             	mov    %rax,%rdi
+  803ac9:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  803ad0:	00 00 00 
+  803ad3:	ff d0                	call   *%rax
+}
+  803ad5:	c9                   	leave
+  803ad6:	c3                   	ret
+
+0000000000803ad7 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803ad7:	55                   	push   %rbp
+  803ad8:	48 89 e5             	mov    %rsp,%rbp
+  803adb:	48 83 ec 10          	sub    $0x10,%rsp
+  803adf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ae7:	8b 40 0c             	mov    0xc(%rax),%eax
+  803aea:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803af1:	00 00 00 
+  803af4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803af6:	be 00 00 00 00       	mov    $0x0,%esi
+  803afb:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b00:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+}
+  803b0c:	c9                   	leave
+  803b0d:	c3                   	ret
+
+0000000000803b0e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b0e:	55                   	push   %rbp
+  803b0f:	48 89 e5             	mov    %rsp,%rbp
+  803b12:	48 83 ec 30          	sub    $0x30,%rsp
+  803b16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b1e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803b22:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803b27:	74 07                	je     803b30 <devfile_read+0x22>
+  803b29:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803b2e:	75 0a                	jne    803b3a <devfile_read+0x2c>
+  return E_INVAL;
+  803b30:	b8 03 00 00 00       	mov    $0x3,%eax
+  803b35:	e9 b4 00 00 00       	jmp    803bee <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803b3a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803b41:	00 
+  while (n) {
+  803b42:	e9 98 00 00 00       	jmp    803bdf <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803b47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b4b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b4e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b55:	00 00 00 
+  803b58:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803b5a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b61:	00 00 00 
+  803b64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b68:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803b6c:	be 00 00 00 00       	mov    $0x0,%esi
+  803b71:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b76:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803b7d:	00 00 00 
+  803b80:	ff d0                	call   *%rax
+  803b82:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803b85:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b89:	7f 13                	jg     803b9e <devfile_read+0x90>
+      return res ? res : res0;
+  803b8b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803b8f:	74 07                	je     803b98 <devfile_read+0x8a>
+  803b91:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b94:	48 98                	cltq
+  803b96:	eb 56                	jmp    803bee <devfile_read+0xe0>
+  803b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b9c:	eb 50                	jmp    803bee <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b9e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba1:	48 63 d0             	movslq %eax,%rdx
+  803ba4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ba8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803baf:	00 00 00 
+  803bb2:	48 89 ce             	mov    %rcx,%rsi
+  803bb5:	48 89 c7             	mov    %rax,%rdi
+  803bb8:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  803bbf:	00 00 00 
+  803bc2:	ff d0                	call   *%rax
+
+    buf += res;
+  803bc4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bc7:	48 98                	cltq
+  803bc9:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803bcd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bd0:	48 98                	cltq
+  803bd2:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803bd6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bd9:	48 98                	cltq
+  803bdb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803bdf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803be4:	0f 85 5d ff ff ff    	jne    803b47 <devfile_read+0x39>
+  }
+
+  return res0;
+  803bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803bee:	c9                   	leave
+  803bef:	c3                   	ret
+
+0000000000803bf0 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bf0:	55                   	push   %rbp
+  803bf1:	48 89 e5             	mov    %rsp,%rbp
+  803bf4:	48 83 ec 50          	sub    $0x50,%rsp
+  803bf8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803bfc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c00:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803c04:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c09:	74 07                	je     803c12 <devfile_write+0x22>
+  803c0b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c10:	75 0a                	jne    803c1c <devfile_write+0x2c>
+  return E_INVAL;
+  803c12:	b8 03 00 00 00       	mov    $0x3,%eax
+  803c17:	e9 c9 00 00 00       	jmp    803ce5 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803c1c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c23:	00 
+
+  while (n) {
+  803c24:	e9 ad 00 00 00       	jmp    803cd6 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803c29:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c2d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803c31:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803c38:	00 
+  803c39:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c41:	48 39 c2             	cmp    %rax,%rdx
+  803c44:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803c48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803c4c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c50:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c54:	48 89 c6             	mov    %rax,%rsi
+  803c57:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803c5e:	00 00 00 
+  803c61:	48 89 c7             	mov    %rax,%rdi
+  803c64:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  803c6b:	00 00 00 
+  803c6e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c74:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c77:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c7e:	00 00 00 
+  803c81:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803c83:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c8a:	00 00 00 
+  803c8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c91:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803c95:	be 00 00 00 00       	mov    $0x0,%esi
+  803c9a:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c9f:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803ca6:	00 00 00 
+  803ca9:	ff d0                	call   *%rax
+  803cab:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803cae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803cb2:	79 07                	jns    803cbb <devfile_write+0xcb>
+      return res;
+  803cb4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cb7:	48 98                	cltq
+  803cb9:	eb 2a                	jmp    803ce5 <devfile_write+0xf5>
+
+    buf += res;
+  803cbb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cbe:	48 98                	cltq
+  803cc0:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803cc4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cc7:	48 98                	cltq
+  803cc9:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803ccd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cd0:	48 98                	cltq
+  803cd2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803cd6:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803cdb:	0f 85 48 ff ff ff    	jne    803c29 <devfile_write+0x39>
+  }
+
+  return res0;
+  803ce1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803ce5:	c9                   	leave
+  803ce6:	c3                   	ret
+
+0000000000803ce7 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803ce7:	55                   	push   %rbp
+  803ce8:	48 89 e5             	mov    %rsp,%rbp
+  803ceb:	48 83 ec 20          	sub    $0x20,%rsp
+  803cef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cf3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803cf7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cfb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cfe:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d05:	00 00 00 
+  803d08:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d0a:	be 00 00 00 00       	mov    $0x0,%esi
+  803d0f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d14:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803d1b:	00 00 00 
+  803d1e:	ff d0                	call   *%rax
+  803d20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d23:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d27:	79 05                	jns    803d2e <devfile_stat+0x47>
+    return r;
+  803d29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d2c:	eb 59                	jmp    803d87 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d32:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d39:	00 00 00 
+  803d3c:	48 89 d6             	mov    %rdx,%rsi
+  803d3f:	48 89 c7             	mov    %rax,%rdi
+  803d42:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  803d49:	00 00 00 
+  803d4c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803d4e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d55:	00 00 00 
+  803d58:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803d5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d62:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d68:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803d6f:	00 00 00 
+  803d72:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803d78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d7c:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803d82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d87:	c9                   	leave
+  803d88:	c3                   	ret
+
+0000000000803d89 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d89:	55                   	push   %rbp
+  803d8a:	48 89 e5             	mov    %rsp,%rbp
+  803d8d:	48 83 ec 10          	sub    $0x10,%rsp
+  803d91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d95:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d9c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d9f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803da6:	00 00 00 
+  803da9:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803dab:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803db2:	00 00 00 
+  803db5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803db8:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc0:	bf 02 00 00 00       	mov    $0x2,%edi
+  803dc5:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+}
+  803dd1:	c9                   	leave
+  803dd2:	c3                   	ret
+
+0000000000803dd3 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803dd3:	55                   	push   %rbp
+  803dd4:	48 89 e5             	mov    %rsp,%rbp
+  803dd7:	48 83 ec 18          	sub    $0x18,%rsp
+  803ddb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ddf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803de2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803de6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803de9:	83 e0 03             	and    $0x3,%eax
+}
+  803dec:	c9                   	leave
+  803ded:	c3                   	ret
+
+0000000000803dee <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803dee:	55                   	push   %rbp
+  803def:	48 89 e5             	mov    %rsp,%rbp
+  803df2:	48 83 ec 10          	sub    $0x10,%rsp
+  803df6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dfe:	48 89 c7             	mov    %rax,%rdi
+  803e01:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  803e08:	00 00 00 
+  803e0b:	ff d0                	call   *%rax
+  803e0d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e12:	7e 07                	jle    803e1b <remove+0x2d>
+    return -E_BAD_PATH;
+  803e14:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803e19:	eb 36                	jmp    803e51 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803e1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e1f:	48 89 c6             	mov    %rax,%rsi
+  803e22:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803e29:	00 00 00 
+  803e2c:	48 89 c7             	mov    %rax,%rdi
+  803e2f:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  803e36:	00 00 00 
+  803e39:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e40:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e45:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+}
+  803e51:	c9                   	leave
+  803e52:	c3                   	ret
+
+0000000000803e53 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803e53:	55                   	push   %rbp
+  803e54:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803e57:	be 00 00 00 00       	mov    $0x0,%esi
+  803e5c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e61:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803e68:	00 00 00 
+  803e6b:	ff d0                	call   *%rax
+}
+  803e6d:	5d                   	pop    %rbp
+  803e6e:	c3                   	ret
+
+0000000000803e6f <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803e6f:	55                   	push   %rbp
+  803e70:	48 89 e5             	mov    %rsp,%rbp
+  803e73:	48 83 ec 20          	sub    $0x20,%rsp
+  803e77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803e80:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e85:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803e8c:	00 00 00 
+  803e8f:	ff d0                	call   *%rax
+  803e91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e98:	79 05                	jns    803e9f <fs_stats+0x30>
+    return r;
+  803e9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e9d:	eb 2a                	jmp    803ec9 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803e9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ea3:	ba 68 00 00 00       	mov    $0x68,%edx
+  803ea8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803eaf:	00 00 00 
+  803eb2:	48 89 ce             	mov    %rcx,%rsi
+  803eb5:	48 89 c7             	mov    %rax,%rdi
+  803eb8:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  803ebf:	00 00 00 
+  803ec2:	ff d0                	call   *%rax
+  return 0;
+  803ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ec9:	c9                   	leave
+  803eca:	c3                   	ret
+
+0000000000803ecb <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803ecb:	55                   	push   %rbp
+  803ecc:	48 89 e5             	mov    %rsp,%rbp
+  803ecf:	48 83 ec 10          	sub    $0x10,%rsp
+  803ed3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803ed6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803edd:	00 00 00 
+  803ee0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ee3:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  803eea:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803eef:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803ef6:	00 00 00 
+  803ef9:	ff d0                	call   *%rax
+}
+  803efb:	c9                   	leave
+  803efc:	c3                   	ret
+
+0000000000803efd <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803efd:	55                   	push   %rbp
+  803efe:	48 89 e5             	mov    %rsp,%rbp
+  803f01:	48 83 ec 10          	sub    $0x10,%rsp
+  803f05:	89 f8                	mov    %edi,%eax
+  803f07:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803f0a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803f0e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f15:	00 00 00 
+  803f18:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803f1a:	be 00 00 00 00       	mov    $0x0,%esi
+  803f1f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803f24:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803f2b:	00 00 00 
+  803f2e:	ff d0                	call   *%rax
+}
+  803f30:	c9                   	leave
+  803f31:	c3                   	ret
+
+0000000000803f32 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  803f32:	55                   	push   %rbp
+  803f33:	48 89 e5             	mov    %rsp,%rbp
+  803f36:	48 83 ec 20          	sub    $0x20,%rsp
+  803f3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  803f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f42:	8b 40 10             	mov    0x10(%rax),%eax
+  803f45:	85 c0                	test   %eax,%eax
+  803f47:	7e 73                	jle    803fbc <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  803f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f4d:	8b 40 04             	mov    0x4(%rax),%eax
+  803f50:	48 63 d0             	movslq %eax,%rdx
+  803f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f57:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  803f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f5f:	8b 00                	mov    (%rax),%eax
+  803f61:	48 89 ce             	mov    %rcx,%rsi
+  803f64:	89 c7                	mov    %eax,%edi
+  803f66:	48 b8 0e 32 80 00 00 	movabs $0x80320e,%rax
+  803f6d:	00 00 00 
+  803f70:	ff d0                	call   *%rax
+  803f72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  803f76:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803f7b:	7e 17                	jle    803f94 <writebuf+0x62>
+      b->result += result;
+  803f7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f81:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803f85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f89:	48 01 c2             	add    %rax,%rdx
+  803f8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f90:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  803f94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f98:	8b 40 04             	mov    0x4(%rax),%eax
+  803f9b:	48 98                	cltq
+  803f9d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  803fa1:	74 19                	je     803fbc <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  803fa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fac:	48 85 c0             	test   %rax,%rax
+  803faf:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803fb3:	89 c2                	mov    %eax,%edx
+  803fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb9:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  803fbc:	90                   	nop
+  803fbd:	c9                   	leave
+  803fbe:	c3                   	ret
+
+0000000000803fbf <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  803fbf:	55                   	push   %rbp
+  803fc0:	48 89 e5             	mov    %rsp,%rbp
+  803fc3:	48 83 ec 20          	sub    $0x20,%rsp
+  803fc7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803fca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  803fce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  803fd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fda:	8b 40 04             	mov    0x4(%rax),%eax
+  803fdd:	8d 48 01             	lea    0x1(%rax),%ecx
+  803fe0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fe4:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  803fe7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803fea:	89 d1                	mov    %edx,%ecx
+  803fec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ff0:	48 98                	cltq
+  803ff2:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  803ff6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ffa:	8b 40 04             	mov    0x4(%rax),%eax
+  803ffd:	3d 00 01 00 00       	cmp    $0x100,%eax
+  804002:	75 1e                	jne    804022 <putch+0x63>
+    writebuf(b);
+  804004:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804008:	48 89 c7             	mov    %rax,%rdi
+  80400b:	48 b8 32 3f 80 00 00 	movabs $0x803f32,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+    b->idx = 0;
+  804017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80401b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  804022:	90                   	nop
+  804023:	c9                   	leave
+  804024:	c3                   	ret
+
+0000000000804025 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804025:	55                   	push   %rbp
+  804026:	48 89 e5             	mov    %rsp,%rbp
+  804029:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  804030:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  804036:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  80403d:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  804044:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  80404a:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  804050:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  804057:	00 00 00 
+  b.result = 0;
+  80405a:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  804061:	00 00 00 00 
+  b.error  = 1;
+  804065:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  80406c:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  80406f:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  804076:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  80407d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804084:	48 89 c6             	mov    %rax,%rsi
+  804087:	48 b8 bf 3f 80 00 00 	movabs $0x803fbf,%rax
+  80408e:	00 00 00 
+  804091:	48 89 c7             	mov    %rax,%rdi
+  804094:	48 b8 fb 08 80 00 00 	movabs $0x8008fb,%rax
+  80409b:	00 00 00 
+  80409e:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  8040a0:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8040a6:	85 c0                	test   %eax,%eax
+  8040a8:	7e 16                	jle    8040c0 <vfprintf+0x9b>
+    writebuf(&b);
+  8040aa:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8040b1:	48 89 c7             	mov    %rax,%rdi
+  8040b4:	48 b8 32 3f 80 00 00 	movabs $0x803f32,%rax
+  8040bb:	00 00 00 
+  8040be:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  8040c0:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8040c7:	48 85 c0             	test   %rax,%rax
+  8040ca:	74 09                	je     8040d5 <vfprintf+0xb0>
+  8040cc:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8040d3:	eb 06                	jmp    8040db <vfprintf+0xb6>
+  8040d5:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  8040db:	c9                   	leave
+  8040dc:	c3                   	ret
+
+00000000008040dd <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8040dd:	55                   	push   %rbp
+  8040de:	48 89 e5             	mov    %rsp,%rbp
+  8040e1:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8040e8:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  8040ee:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8040f5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8040fc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804103:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80410a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804111:	84 c0                	test   %al,%al
+  804113:	74 20                	je     804135 <fprintf+0x58>
+  804115:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804119:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80411d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804121:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804125:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804129:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80412d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804131:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804135:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80413c:	00 00 00 
+  80413f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804146:	00 00 00 
+  804149:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80414d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804154:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80415b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  804162:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804169:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  804170:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804176:	48 89 ce             	mov    %rcx,%rsi
+  804179:	89 c7                	mov    %eax,%edi
+  80417b:	48 b8 25 40 80 00 00 	movabs $0x804025,%rax
+  804182:	00 00 00 
+  804185:	ff d0                	call   *%rax
+  804187:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80418d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804193:	c9                   	leave
+  804194:	c3                   	ret
+
+0000000000804195 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804195:	55                   	push   %rbp
+  804196:	48 89 e5             	mov    %rsp,%rbp
+  804199:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8041a0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8041a7:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8041ae:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8041b5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8041bc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8041c3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8041ca:	84 c0                	test   %al,%al
+  8041cc:	74 20                	je     8041ee <printf+0x59>
+  8041ce:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8041d2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8041d6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8041da:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8041de:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8041e2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8041e6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8041ea:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8041ee:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8041f5:	00 00 00 
+  8041f8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8041ff:	00 00 00 
+  804202:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804206:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80420d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804214:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  80421b:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804222:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804229:	48 89 c6             	mov    %rax,%rsi
+  80422c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804231:	48 b8 25 40 80 00 00 	movabs $0x804025,%rax
+  804238:	00 00 00 
+  80423b:	ff d0                	call   *%rax
+  80423d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804243:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804249:	c9                   	leave
+  80424a:	c3                   	ret
+
+000000000080424b <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80424b:	55                   	push   %rbp
+  80424c:	48 89 e5             	mov    %rsp,%rbp
+  80424f:	48 83 ec 10          	sub    $0x10,%rsp
+  804253:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804257:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80425b:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804260:	48 89 c7             	mov    %rax,%rdi
+  804263:	48 b8 71 42 80 00 00 	movabs $0x804271,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+}
+  80426f:	c9                   	leave
+  804270:	c3                   	ret
+
+0000000000804271 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804271:	55                   	push   %rbp
+  804272:	48 89 e5             	mov    %rsp,%rbp
+  804275:	48 83 ec 50          	sub    $0x50,%rsp
+  804279:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80427d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804281:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804288:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804289:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80428e:	74 0a                	je     80429a <pipe_size+0x29>
+  804290:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804297:	00 
+  804298:	76 0a                	jbe    8042a4 <pipe_size+0x33>
+    return -E_INVAL;
+  80429a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80429f:	e9 cc 02 00 00       	jmp    804570 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8042a4:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8042a8:	48 89 c7             	mov    %rax,%rdi
+  8042ab:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  8042b2:	00 00 00 
+  8042b5:	ff d0                	call   *%rax
+  8042b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042be:	0f 88 a8 02 00 00    	js     80456c <pipe_size+0x2fb>
+  8042c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042c8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8042cd:	48 89 c6             	mov    %rax,%rsi
+  8042d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d5:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  8042dc:	00 00 00 
+  8042df:	ff d0                	call   *%rax
+  8042e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042e8:	0f 88 7e 02 00 00    	js     80456c <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8042ee:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8042f2:	48 89 c7             	mov    %rax,%rdi
+  8042f5:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+  804301:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804304:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804308:	0f 88 43 02 00 00    	js     804551 <pipe_size+0x2e0>
+  80430e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804312:	ba 07 04 00 00       	mov    $0x407,%edx
+  804317:	48 89 c6             	mov    %rax,%rsi
+  80431a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431f:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  804326:	00 00 00 
+  804329:	ff d0                	call   *%rax
+  80432b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80432e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804332:	0f 88 19 02 00 00    	js     804551 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804338:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80433c:	48 89 c7             	mov    %rax,%rdi
+  80433f:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+  80434b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80434f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804356:	00 
+  804357:	e9 a2 00 00 00       	jmp    8043fe <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80435c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804360:	48 c1 e0 0c          	shl    $0xc,%rax
+  804364:	48 89 c2             	mov    %rax,%rdx
+  804367:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80436b:	48 01 d0             	add    %rdx,%rax
+  80436e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804373:	48 89 c6             	mov    %rax,%rsi
+  804376:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437b:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+  804387:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80438a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80438e:	0f 88 37 01 00 00    	js     8044cb <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804394:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804398:	48 89 c7             	mov    %rax,%rdi
+  80439b:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  8043a2:	00 00 00 
+  8043a5:	ff d0                	call   *%rax
+  8043a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043ab:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8043af:	48 01 c2             	add    %rax,%rdx
+  8043b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043b6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8043ba:	48 89 c1             	mov    %rax,%rcx
+  8043bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043c1:	48 01 c8             	add    %rcx,%rax
+  8043c4:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8043ca:	48 89 d1             	mov    %rdx,%rcx
+  8043cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043d2:	48 89 c6             	mov    %rax,%rsi
+  8043d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043da:	48 b8 77 23 80 00 00 	movabs $0x802377,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+  8043e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043ed:	79 0a                	jns    8043f9 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8043ef:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8043f4:	e9 d3 00 00 00       	jmp    8044cc <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8043f9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8043fe:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804405:	00 
+  804406:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80440a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80440e:	48 01 d0             	add    %rdx,%rax
+  804411:	48 83 c0 1f          	add    $0x1f,%rax
+  804415:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804419:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80441d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804422:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804426:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80442a:	48 29 d0             	sub    %rdx,%rax
+  80442d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804431:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804435:	0f 82 21 ff ff ff    	jb     80435c <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80443b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804443:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804447:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80444b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80444f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804453:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80445a:	00 00 00 
+  80445d:	8b 12                	mov    (%rdx),%edx
+  80445f:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804461:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804465:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80446c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804470:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804477:	00 00 00 
+  80447a:	8b 12                	mov    (%rdx),%edx
+  80447c:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80447e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804482:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80448d:	48 89 c7             	mov    %rax,%rdi
+  804490:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  804497:	00 00 00 
+  80449a:	ff d0                	call   *%rax
+  80449c:	89 c2                	mov    %eax,%edx
+  80449e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8044a2:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8044a4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044a8:	48 89 c7             	mov    %rax,%rdi
+  8044ab:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  8044b2:	00 00 00 
+  8044b5:	ff d0                	call   *%rax
+  8044b7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044bb:	48 83 c2 04          	add    $0x4,%rdx
+  8044bf:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8044c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c6:	e9 a5 00 00 00       	jmp    804570 <pipe_size+0x2ff>
+      goto err2;
+  8044cb:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8044cc:	eb 58                	jmp    804526 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8044ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8044d6:	48 89 c2             	mov    %rax,%rdx
+  8044d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044dd:	48 01 d0             	add    %rdx,%rax
+  8044e0:	48 89 c6             	mov    %rax,%rsi
+  8044e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044e8:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8044f4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044f8:	48 89 c7             	mov    %rax,%rdi
+  8044fb:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804502:	00 00 00 
+  804505:	ff d0                	call   *%rax
+  804507:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80450b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80450f:	48 01 d0             	add    %rdx,%rax
+  804512:	48 89 c6             	mov    %rax,%rsi
+  804515:	bf 00 00 00 00       	mov    $0x0,%edi
+  80451a:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  804521:	00 00 00 
+  804524:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804526:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80452a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80452e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804532:	48 85 c0             	test   %rax,%rax
+  804535:	75 97                	jne    8044ce <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804537:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80453b:	48 89 c6             	mov    %rax,%rsi
+  80453e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804543:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  80454a:	00 00 00 
+  80454d:	ff d0                	call   *%rax
+  80454f:	eb 01                	jmp    804552 <pipe_size+0x2e1>
+    goto err1;
+  804551:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804552:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804556:	48 89 c6             	mov    %rax,%rsi
+  804559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80455e:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  804565:	00 00 00 
+  804568:	ff d0                	call   *%rax
+  80456a:	eb 01                	jmp    80456d <pipe_size+0x2fc>
+    goto err;
+  80456c:	90                   	nop
+err:
+  return r;
+  80456d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804570:	c9                   	leave
+  804571:	c3                   	ret
+
+0000000000804572 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804572:	55                   	push   %rbp
+  804573:	48 89 e5             	mov    %rsp,%rbp
+  804576:	53                   	push   %rbx
+  804577:	48 83 ec 28          	sub    $0x28,%rsp
+  80457b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80457f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804583:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80458a:	00 00 00 
+  80458d:	8b 40 04             	mov    0x4(%rax),%eax
+  804590:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804595:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80459c:	00 00 00 
+  80459f:	48 98                	cltq
+  8045a1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8045a8:	48 01 d0             	add    %rdx,%rax
+  8045ab:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8045b1:	8b 00                	mov    (%rax),%eax
+  8045b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8045b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045ba:	48 89 c7             	mov    %rax,%rdi
+  8045bd:	48 b8 63 54 80 00 00 	movabs $0x805463,%rax
+  8045c4:	00 00 00 
+  8045c7:	ff d0                	call   *%rax
+  8045c9:	89 c3                	mov    %eax,%ebx
+  8045cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045cf:	48 89 c7             	mov    %rax,%rdi
+  8045d2:	48 b8 63 54 80 00 00 	movabs $0x805463,%rax
+  8045d9:	00 00 00 
+  8045dc:	ff d0                	call   *%rax
+  8045de:	39 c3                	cmp    %eax,%ebx
+  8045e0:	0f 94 c0             	sete   %al
+  8045e3:	0f b6 c0             	movzbl %al,%eax
+  8045e6:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8045e9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8045f0:	00 00 00 
+  8045f3:	8b 40 04             	mov    0x4(%rax),%eax
+  8045f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045fb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804602:	00 00 00 
+  804605:	48 98                	cltq
+  804607:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80460e:	48 01 d0             	add    %rdx,%rax
+  804611:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804617:	8b 00                	mov    (%rax),%eax
+  804619:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80461c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80461f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804622:	75 05                	jne    804629 <_pipeisclosed+0xb7>
+      return ret;
+  804624:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804627:	eb 68                	jmp    804691 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804629:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80462f:	0f 84 4e ff ff ff    	je     804583 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804635:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80463c:	00 00 00 
+  80463f:	8b 40 04             	mov    0x4(%rax),%eax
+  804642:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804647:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80464e:	00 00 00 
+  804651:	48 98                	cltq
+  804653:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80465a:	48 01 d0             	add    %rdx,%rax
+  80465d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804663:	8b 10                	mov    (%rax),%edx
+  804665:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804668:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80466b:	89 c6                	mov    %eax,%esi
+  80466d:	48 b8 c0 5b 80 00 00 	movabs $0x805bc0,%rax
+  804674:	00 00 00 
+  804677:	48 89 c7             	mov    %rax,%rdi
+  80467a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80467f:	49 b8 a1 05 80 00 00 	movabs $0x8005a1,%r8
+  804686:	00 00 00 
+  804689:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80468c:	e9 f2 fe ff ff       	jmp    804583 <_pipeisclosed+0x11>
+  }
+}
+  804691:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804695:	c9                   	leave
+  804696:	c3                   	ret
+
+0000000000804697 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804697:	55                   	push   %rbp
+  804698:	48 89 e5             	mov    %rsp,%rbp
+  80469b:	48 83 ec 30          	sub    $0x30,%rsp
+  80469f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046a2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8046a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046a9:	48 89 d6             	mov    %rdx,%rsi
+  8046ac:	89 c7                	mov    %eax,%edi
+  8046ae:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  8046b5:	00 00 00 
+  8046b8:	ff d0                	call   *%rax
+  8046ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046c1:	79 05                	jns    8046c8 <pipeisclosed+0x31>
+    return r;
+  8046c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046c6:	eb 31                	jmp    8046f9 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8046c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046cc:	48 89 c7             	mov    %rax,%rdi
+  8046cf:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  8046d6:	00 00 00 
+  8046d9:	ff d0                	call   *%rax
+  8046db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8046df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8046e7:	48 89 d6             	mov    %rdx,%rsi
+  8046ea:	48 89 c7             	mov    %rax,%rdi
+  8046ed:	48 b8 72 45 80 00 00 	movabs $0x804572,%rax
+  8046f4:	00 00 00 
+  8046f7:	ff d0                	call   *%rax
+}
+  8046f9:	c9                   	leave
+  8046fa:	c3                   	ret
+
+00000000008046fb <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8046fb:	55                   	push   %rbp
+  8046fc:	48 89 e5             	mov    %rsp,%rbp
+  8046ff:	48 83 ec 10          	sub    $0x10,%rsp
+  804703:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804707:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80470b:	8b 40 18             	mov    0x18(%rax),%eax
+  80470e:	8d 50 01             	lea    0x1(%rax),%edx
+  804711:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804715:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80471c:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80471f:	85 c0                	test   %eax,%eax
+  804721:	74 27                	je     80474a <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804727:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80472e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804732:	48 83 c0 18          	add    $0x18,%rax
+  804736:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80473b:	48 89 c7             	mov    %rax,%rdi
+  80473e:	48 b8 1a 27 80 00 00 	movabs $0x80271a,%rax
+  804745:	00 00 00 
+  804748:	ff d0                	call   *%rax
+  }
+}
+  80474a:	90                   	nop
+  80474b:	c9                   	leave
+  80474c:	c3                   	ret
+
+000000000080474d <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80474d:	55                   	push   %rbp
+  80474e:	48 89 e5             	mov    %rsp,%rbp
+  804751:	48 83 ec 10          	sub    $0x10,%rsp
+  804755:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804759:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80475c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804760:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80476b:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80476f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804772:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804779:	89 c6                	mov    %eax,%esi
+  80477b:	48 89 cf             	mov    %rcx,%rdi
+  80477e:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  804785:	00 00 00 
+  804788:	ff d0                	call   *%rax
+}
+  80478a:	90                   	nop
+  80478b:	c9                   	leave
+  80478c:	c3                   	ret
+
+000000000080478d <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80478d:	55                   	push   %rbp
+  80478e:	48 89 e5             	mov    %rsp,%rbp
+  804791:	48 83 ec 70          	sub    $0x70,%rsp
+  804795:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804799:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80479d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8047a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047a5:	48 89 c7             	mov    %rax,%rdi
+  8047a8:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  8047af:	00 00 00 
+  8047b2:	ff d0                	call   *%rax
+  8047b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8047b8:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8047bd:	75 0a                	jne    8047c9 <devpipe_read+0x3c>
+    return 0;
+  8047bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c4:	e9 63 01 00 00       	jmp    80492c <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8047c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047cd:	8b 40 18             	mov    0x18(%rax),%eax
+  8047d0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8047d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047d7:	48 8b 10             	mov    (%rax),%rdx
+  8047da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047de:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047e2:	48 39 c2             	cmp    %rax,%rdx
+  8047e5:	75 42                	jne    804829 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8047e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047ef:	48 89 d6             	mov    %rdx,%rsi
+  8047f2:	48 89 c7             	mov    %rax,%rdi
+  8047f5:	48 b8 72 45 80 00 00 	movabs $0x804572,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+  804801:	85 c0                	test   %eax,%eax
+  804803:	74 0a                	je     80480f <devpipe_read+0x82>
+      return 0;
+  804805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80480a:	e9 1d 01 00 00       	jmp    80492c <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80480f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804816:	89 d6                	mov    %edx,%esi
+  804818:	48 89 c7             	mov    %rax,%rdi
+  80481b:	48 b8 4d 47 80 00 00 	movabs $0x80474d,%rax
+  804822:	00 00 00 
+  804825:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804827:	eb a0                	jmp    8047c9 <devpipe_read+0x3c>
+      break;
+  804829:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80482a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80482e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804832:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804836:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80483a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80483e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804842:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804846:	48 8b 00             	mov    (%rax),%rax
+  804849:	48 29 c2             	sub    %rax,%rdx
+  80484c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804850:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804854:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804858:	48 39 c2             	cmp    %rax,%rdx
+  80485b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80485f:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804867:	48 8b 00             	mov    (%rax),%rax
+  80486a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80486e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804872:	ba 00 00 00 00       	mov    $0x0,%edx
+  804877:	48 f7 f1             	div    %rcx
+  80487a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80487e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804882:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80488a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80488e:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804896:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80489a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80489e:	48 39 c2             	cmp    %rax,%rdx
+  8048a1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8048a5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8048a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ad:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8048b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8048b9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8048bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c1:	48 89 ce             	mov    %rcx,%rsi
+  8048c4:	48 89 c7             	mov    %rax,%rdi
+  8048c7:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  8048ce:	00 00 00 
+  8048d1:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8048d3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8048d7:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8048db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048df:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8048e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8048e7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8048eb:	48 01 d1             	add    %rdx,%rcx
+  8048ee:	48 89 c2             	mov    %rax,%rdx
+  8048f1:	48 89 cf             	mov    %rcx,%rdi
+  8048f4:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  8048fb:	00 00 00 
+  8048fe:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804900:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804904:	48 8b 10             	mov    (%rax),%rdx
+  804907:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80490b:	48 01 c2             	add    %rax,%rdx
+  80490e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804912:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804915:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804919:	48 89 c7             	mov    %rax,%rdi
+  80491c:	48 b8 fb 46 80 00 00 	movabs $0x8046fb,%rax
+  804923:	00 00 00 
+  804926:	ff d0                	call   *%rax
+  return n;
+  804928:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80492c:	c9                   	leave
+  80492d:	c3                   	ret
+
+000000000080492e <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80492e:	55                   	push   %rbp
+  80492f:	48 89 e5             	mov    %rsp,%rbp
+  804932:	48 83 ec 70          	sub    $0x70,%rsp
+  804936:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80493a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80493e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804942:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804946:	48 89 c7             	mov    %rax,%rdi
+  804949:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804950:	00 00 00 
+  804953:	ff d0                	call   *%rax
+  804955:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804959:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80495d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804961:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804968:	00 
+  804969:	e9 b8 01 00 00       	jmp    804b26 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80496e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804972:	8b 40 18             	mov    0x18(%rax),%eax
+  804975:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80497c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804980:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804984:	48 8b 00             	mov    (%rax),%rax
+  804987:	48 29 c2             	sub    %rax,%rdx
+  80498a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80498e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804992:	48 39 c2             	cmp    %rax,%rdx
+  804995:	75 4d                	jne    8049e4 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804997:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80499b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80499f:	48 89 d6             	mov    %rdx,%rsi
+  8049a2:	48 89 c7             	mov    %rax,%rdi
+  8049a5:	48 b8 72 45 80 00 00 	movabs $0x804572,%rax
+  8049ac:	00 00 00 
+  8049af:	ff d0                	call   *%rax
+  8049b1:	85 c0                	test   %eax,%eax
+  8049b3:	74 0a                	je     8049bf <devpipe_write+0x91>
+        return 0;
+  8049b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049ba:	e9 79 01 00 00       	jmp    804b38 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8049bf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8049c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049c6:	89 d6                	mov    %edx,%esi
+  8049c8:	48 89 c7             	mov    %rax,%rdi
+  8049cb:	48 b8 4d 47 80 00 00 	movabs $0x80474d,%rax
+  8049d2:	00 00 00 
+  8049d5:	ff d0                	call   *%rax
+      m = 0;
+  8049d7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8049de:	00 
+      continue;
+  8049df:	e9 3a 01 00 00       	jmp    804b1e <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8049e4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8049e8:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8049ec:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8049f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049fc:	48 8b 08             	mov    (%rax),%rcx
+  8049ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a03:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a07:	48 29 c1             	sub    %rax,%rcx
+  804a0a:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804a0e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804a12:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804a16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1a:	48 39 c2             	cmp    %rax,%rdx
+  804a1d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804a25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a29:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a2d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a31:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a3a:	48 f7 f1             	div    %rcx
+  804a3d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804a41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a45:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804a49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a4d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a51:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a55:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804a59:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a5d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804a61:	48 39 c2             	cmp    %rax,%rdx
+  804a64:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a68:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804a6c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a70:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804a74:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a78:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804a7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a80:	48 01 d1             	add    %rdx,%rcx
+  804a83:	48 89 c2             	mov    %rax,%rdx
+  804a86:	48 89 cf             	mov    %rcx,%rdi
+  804a89:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  804a90:	00 00 00 
+  804a93:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804a95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a99:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a9d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804aa1:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804aa5:	73 4d                	jae    804af4 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804ab3:	48 29 c2             	sub    %rax,%rdx
+  804ab6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aba:	48 01 c2             	add    %rax,%rdx
+  804abd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ac1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ac5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804ac9:	48 89 c1             	mov    %rax,%rcx
+  804acc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ad0:	48 01 c1             	add    %rax,%rcx
+  804ad3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ad7:	48 01 c1             	add    %rax,%rcx
+  804ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ade:	48 83 c0 20          	add    $0x20,%rax
+  804ae2:	48 89 ce             	mov    %rcx,%rsi
+  804ae5:	48 89 c7             	mov    %rax,%rdi
+  804ae8:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  804aef:	00 00 00 
+  804af2:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804af4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804af8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804afc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b00:	48 01 c2             	add    %rax,%rdx
+  804b03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b07:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804b0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b0f:	48 89 c7             	mov    %rax,%rdi
+  804b12:	48 b8 fb 46 80 00 00 	movabs $0x8046fb,%rax
+  804b19:	00 00 00 
+  804b1c:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b22:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804b26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b2a:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804b2e:	0f 82 3a fe ff ff    	jb     80496e <devpipe_write+0x40>
+  }
+
+  return i;
+  804b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804b38:	c9                   	leave
+  804b39:	c3                   	ret
+
+0000000000804b3a <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804b3a:	55                   	push   %rbp
+  804b3b:	48 89 e5             	mov    %rsp,%rbp
+  804b3e:	48 83 ec 40          	sub    $0x40,%rsp
+  804b42:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b46:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804b49:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b51:	48 89 c7             	mov    %rax,%rdi
+  804b54:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804b5b:	00 00 00 
+  804b5e:	ff d0                	call   *%rax
+  804b60:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804b64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b6f:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804b73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b77:	48 89 d6             	mov    %rdx,%rsi
+  804b7a:	48 89 c7             	mov    %rax,%rdi
+  804b7d:	48 b8 fc 34 80 00 00 	movabs $0x8034fc,%rax
+  804b84:	00 00 00 
+  804b87:	ff d0                	call   *%rax
+  804b89:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b8c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b90:	79 08                	jns    804b9a <devpipe_poll+0x60>
+    return r;
+  804b92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b95:	e9 85 00 00 00       	jmp    804c1f <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804b9a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b9d:	83 e0 01             	and    $0x1,%eax
+  804ba0:	85 c0                	test   %eax,%eax
+  804ba2:	74 18                	je     804bbc <devpipe_poll+0x82>
+  804ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ba8:	48 8b 10             	mov    (%rax),%rdx
+  804bab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804baf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bb3:	48 39 c2             	cmp    %rax,%rdx
+  804bb6:	74 04                	je     804bbc <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804bb8:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804bbc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804bbf:	83 e0 02             	and    $0x2,%eax
+  804bc2:	85 c0                	test   %eax,%eax
+  804bc4:	74 23                	je     804be9 <devpipe_poll+0xaf>
+  804bc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bca:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804bce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bd2:	48 8b 00             	mov    (%rax),%rax
+  804bd5:	48 29 c2             	sub    %rax,%rdx
+  804bd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bdc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804be0:	48 39 c2             	cmp    %rax,%rdx
+  804be3:	73 04                	jae    804be9 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804be5:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804be9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf1:	48 89 d6             	mov    %rdx,%rsi
+  804bf4:	48 89 c7             	mov    %rax,%rdi
+  804bf7:	48 b8 72 45 80 00 00 	movabs $0x804572,%rax
+  804bfe:	00 00 00 
+  804c01:	ff d0                	call   *%rax
+  804c03:	85 c0                	test   %eax,%eax
+  804c05:	74 04                	je     804c0b <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804c07:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804c0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c0f:	75 0b                	jne    804c1c <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804c11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c15:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804c1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804c1f:	c9                   	leave
+  804c20:	c3                   	ret
+
+0000000000804c21 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804c21:	55                   	push   %rbp
+  804c22:	48 89 e5             	mov    %rsp,%rbp
+  804c25:	48 83 ec 20          	sub    $0x20,%rsp
+  804c29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c2d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c35:	48 89 c7             	mov    %rax,%rdi
+  804c38:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804c3f:	00 00 00 
+  804c42:	ff d0                	call   *%rax
+  804c44:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804c48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c4c:	48 ba f1 5b 80 00 00 	movabs $0x805bf1,%rdx
+  804c53:	00 00 00 
+  804c56:	48 89 d6             	mov    %rdx,%rsi
+  804c59:	48 89 c7             	mov    %rax,%rdi
+  804c5c:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  804c63:	00 00 00 
+  804c66:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c70:	89 c1                	mov    %eax,%ecx
+  804c72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c76:	48 8b 00             	mov    (%rax),%rax
+  804c79:	89 c2                	mov    %eax,%edx
+  804c7b:	89 c8                	mov    %ecx,%eax
+  804c7d:	29 d0                	sub    %edx,%eax
+  804c7f:	89 c2                	mov    %eax,%edx
+  804c81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c85:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804c8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c8f:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804c96:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804c99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c9d:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804ca4:	00 00 00 
+  804ca7:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804cae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cb3:	c9                   	leave
+  804cb4:	c3                   	ret
+
+0000000000804cb5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804cb5:	55                   	push   %rbp
+  804cb6:	48 89 e5             	mov    %rsp,%rbp
+  804cb9:	48 83 ec 40          	sub    $0x40,%rsp
+  804cbd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804cc1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cc5:	48 89 c7             	mov    %rax,%rdi
+  804cc8:	48 b8 29 2a 80 00 00 	movabs $0x802a29,%rax
+  804ccf:	00 00 00 
+  804cd2:	ff d0                	call   *%rax
+  804cd4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804cd8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804cdf:	00 
+  804ce0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ce4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cec:	48 01 d0             	add    %rdx,%rax
+  804cef:	48 83 c0 1f          	add    $0x1f,%rax
+  804cf3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804cf7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d00:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804d04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d08:	48 29 d0             	sub    %rdx,%rax
+  804d0b:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d0f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d17:	48 89 c6             	mov    %rax,%rsi
+  804d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d1f:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  804d26:	00 00 00 
+  804d29:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804d2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d2f:	48 89 c7             	mov    %rax,%rdi
+  804d32:	48 b8 fb 46 80 00 00 	movabs $0x8046fb,%rax
+  804d39:	00 00 00 
+  804d3c:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d46:	eb 2f                	jmp    804d77 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804d48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d4c:	48 83 e8 01          	sub    $0x1,%rax
+  804d50:	48 c1 e0 0c          	shl    $0xc,%rax
+  804d54:	48 89 c2             	mov    %rax,%rdx
+  804d57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d5b:	48 01 d0             	add    %rdx,%rax
+  804d5e:	48 89 c6             	mov    %rax,%rsi
+  804d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d66:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  804d6d:	00 00 00 
+  804d70:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804d72:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804d77:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804d7c:	77 ca                	ja     804d48 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804d7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d82:	48 89 c6             	mov    %rax,%rsi
+  804d85:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d8a:	48 b8 d7 23 80 00 00 	movabs $0x8023d7,%rax
+  804d91:	00 00 00 
+  804d94:	ff d0                	call   *%rax
+}
+  804d96:	c9                   	leave
+  804d97:	c3                   	ret
+
+0000000000804d98 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804d98:	55                   	push   %rbp
+  804d99:	48 89 e5             	mov    %rsp,%rbp
+  804d9c:	48 83 ec 08          	sub    $0x8,%rsp
+  804da0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804da3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804da7:	75 10                	jne    804db9 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804da9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804db0:	00 00 00 
+  804db3:	8b 00                	mov    (%rax),%eax
+  804db5:	48 98                	cltq
+  804db7:	eb 05                	jmp    804dbe <vsyscall+0x26>
+  }
+  return 0;
+  804db9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dbe:	c9                   	leave
+  804dbf:	c3                   	ret
+
+0000000000804dc0 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804dc0:	55                   	push   %rbp
+  804dc1:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dc9:	48 b8 98 4d 80 00 00 	movabs $0x804d98,%rax
+  804dd0:	00 00 00 
+  804dd3:	ff d0                	call   *%rax
+}
+  804dd5:	5d                   	pop    %rbp
+  804dd6:	c3                   	ret
+
+0000000000804dd7 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804dd7:	55                   	push   %rbp
+  804dd8:	48 89 e5             	mov    %rsp,%rbp
+  804ddb:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804ddf:	0f 31                	rdtsc
+  804de1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804de4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804de7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dea:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ded:	48 c1 e2 20          	shl    $0x20,%rdx
+  804df1:	48 09 d0             	or     %rdx,%rax
+  804df4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804df8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804dfc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804e00:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e07:	00 00 00 
+  804e0a:	8b 40 08             	mov    0x8(%rax),%eax
+  804e0d:	48 98                	cltq
+  804e0f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e1c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804e20:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804e27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e30:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804e34:	48 89 d0             	mov    %rdx,%rax
+  804e37:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e43:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804e47:	48 01 c8             	add    %rcx,%rax
+}
+  804e4a:	c9                   	leave
+  804e4b:	c3                   	ret
+
+0000000000804e4c <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804e4c:	55                   	push   %rbp
+  804e4d:	48 89 e5             	mov    %rsp,%rbp
+  804e50:	48 83 ec 20          	sub    $0x20,%rsp
+  804e54:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804e57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e5a:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804e5d:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804e61:	be 01 00 00 00       	mov    $0x1,%esi
+  804e66:	48 89 c7             	mov    %rax,%rdi
+  804e69:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  804e70:	00 00 00 
+  804e73:	ff d0                	call   *%rax
+}
+  804e75:	90                   	nop
+  804e76:	c9                   	leave
+  804e77:	c3                   	ret
+
+0000000000804e78 <getchar>:
+
+int
+getchar(void) {
+  804e78:	55                   	push   %rbp
+  804e79:	48 89 e5             	mov    %rsp,%rbp
+  804e7c:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804e80:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804e84:	ba 01 00 00 00       	mov    $0x1,%edx
+  804e89:	48 89 c6             	mov    %rax,%rsi
+  804e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e91:	48 b8 92 30 80 00 00 	movabs $0x803092,%rax
+  804e98:	00 00 00 
+  804e9b:	ff d0                	call   *%rax
+  804e9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804ea0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ea4:	79 05                	jns    804eab <getchar+0x33>
+    return r;
+  804ea6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ea9:	eb 14                	jmp    804ebf <getchar+0x47>
+  if (r < 1)
+  804eab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804eaf:	7f 07                	jg     804eb8 <getchar+0x40>
+    return -E_EOF;
+  804eb1:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804eb6:	eb 07                	jmp    804ebf <getchar+0x47>
+  return c;
+  804eb8:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804ebc:	0f b6 c0             	movzbl %al,%eax
+}
+  804ebf:	c9                   	leave
+  804ec0:	c3                   	ret
+
+0000000000804ec1 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804ec1:	55                   	push   %rbp
+  804ec2:	48 89 e5             	mov    %rsp,%rbp
+  804ec5:	48 83 ec 20          	sub    $0x20,%rsp
+  804ec9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ecc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804ed0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ed3:	48 89 d6             	mov    %rdx,%rsi
+  804ed6:	89 c7                	mov    %eax,%edi
+  804ed8:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  804edf:	00 00 00 
+  804ee2:	ff d0                	call   *%rax
+  804ee4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ee7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804eeb:	79 05                	jns    804ef2 <iscons+0x31>
+    return r;
+  804eed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ef0:	eb 1a                	jmp    804f0c <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804ef2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ef6:	8b 10                	mov    (%rax),%edx
+  804ef8:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804eff:	00 00 00 
+  804f02:	8b 00                	mov    (%rax),%eax
+  804f04:	39 c2                	cmp    %eax,%edx
+  804f06:	0f 94 c0             	sete   %al
+  804f09:	0f b6 c0             	movzbl %al,%eax
+}
+  804f0c:	c9                   	leave
+  804f0d:	c3                   	ret
+
+0000000000804f0e <opencons>:
+
+int
+opencons(void) {
+  804f0e:	55                   	push   %rbp
+  804f0f:	48 89 e5             	mov    %rsp,%rbp
+  804f12:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804f16:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804f1a:	48 89 c7             	mov    %rax,%rdi
+  804f1d:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  804f24:	00 00 00 
+  804f27:	ff d0                	call   *%rax
+  804f29:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f30:	79 05                	jns    804f37 <opencons+0x29>
+    return r;
+  804f32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f35:	eb 66                	jmp    804f9d <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804f37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f3b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804f40:	48 89 c6             	mov    %rax,%rsi
+  804f43:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f48:	48 b8 1f 23 80 00 00 	movabs $0x80231f,%rax
+  804f4f:	00 00 00 
+  804f52:	ff d0                	call   *%rax
+  804f54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f5b:	79 05                	jns    804f62 <opencons+0x54>
+    return r;
+  804f5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f60:	eb 3b                	jmp    804f9d <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804f62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f66:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804f6d:	00 00 00 
+  804f70:	8b 12                	mov    (%rdx),%edx
+  804f72:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804f74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f78:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804f7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f83:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804f8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f8e:	48 89 c7             	mov    %rax,%rdi
+  804f91:	48 b8 06 2a 80 00 00 	movabs $0x802a06,%rax
+  804f98:	00 00 00 
+  804f9b:	ff d0                	call   *%rax
+}
+  804f9d:	c9                   	leave
+  804f9e:	c3                   	ret
+
+0000000000804f9f <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804f9f:	55                   	push   %rbp
+  804fa0:	48 89 e5             	mov    %rsp,%rbp
+  804fa3:	48 83 ec 20          	sub    $0x20,%rsp
+  804fa7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804faa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804fad:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804fb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fb4:	48 89 d6             	mov    %rdx,%rsi
+  804fb7:	89 c7                	mov    %eax,%edi
+  804fb9:	48 b8 36 2b 80 00 00 	movabs $0x802b36,%rax
+  804fc0:	00 00 00 
+  804fc3:	ff d0                	call   *%rax
+  804fc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804fc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fcc:	79 05                	jns    804fd3 <consmode+0x34>
+    return r;
+  804fce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fd1:	eb 34                	jmp    805007 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804fd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fd7:	8b 10                	mov    (%rax),%edx
+  804fd9:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804fe0:	00 00 00 
+  804fe3:	8b 00                	mov    (%rax),%eax
+  804fe5:	39 c2                	cmp    %eax,%edx
+  804fe7:	74 07                	je     804ff0 <consmode+0x51>
+    return -E_INVAL;
+  804fe9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804fee:	eb 17                	jmp    805007 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ff4:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ff7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804ffa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ffe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805001:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805004:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805007:	c9                   	leave
+  805008:	c3                   	ret
+
+0000000000805009 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805009:	55                   	push   %rbp
+  80500a:	48 89 e5             	mov    %rsp,%rbp
+  80500d:	48 83 ec 20          	sub    $0x20,%rsp
+  805011:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805015:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805019:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80501d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805021:	8b 50 0c             	mov    0xc(%rax),%edx
+  805024:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805028:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80502c:	48 89 ce             	mov    %rcx,%rsi
+  80502f:	48 89 c7             	mov    %rax,%rdi
+  805032:	48 b8 79 26 80 00 00 	movabs $0x802679,%rax
+  805039:	00 00 00 
+  80503c:	ff d0                	call   *%rax
+  80503e:	48 98                	cltq
+}
+  805040:	c9                   	leave
+  805041:	c3                   	ret
+
+0000000000805042 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805042:	55                   	push   %rbp
+  805043:	48 89 e5             	mov    %rsp,%rbp
+  805046:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80504d:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805054:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  80505b:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805062:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805069:	eb 74                	jmp    8050df <devcons_write+0x9d>
+    m = n - tot;
+  80506b:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805072:	89 c2                	mov    %eax,%edx
+  805074:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805077:	29 c2                	sub    %eax,%edx
+  805079:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  80507c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80507f:	83 f8 7f             	cmp    $0x7f,%eax
+  805082:	76 07                	jbe    80508b <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805084:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80508b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80508e:	48 63 d0             	movslq %eax,%rdx
+  805091:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805094:	48 63 c8             	movslq %eax,%rcx
+  805097:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  80509e:	48 01 c1             	add    %rax,%rcx
+  8050a1:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8050a8:	48 89 ce             	mov    %rcx,%rsi
+  8050ab:	48 89 c7             	mov    %rax,%rdi
+  8050ae:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  8050b5:	00 00 00 
+  8050b8:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8050ba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8050bd:	48 63 d0             	movslq %eax,%rdx
+  8050c0:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8050c7:	48 89 d6             	mov    %rdx,%rsi
+  8050ca:	48 89 c7             	mov    %rax,%rdi
+  8050cd:	48 b8 08 21 80 00 00 	movabs $0x802108,%rax
+  8050d4:	00 00 00 
+  8050d7:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  8050d9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8050dc:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8050df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050e2:	48 98                	cltq
+  8050e4:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8050eb:	0f 82 7a ff ff ff    	jb     80506b <devcons_write+0x29>
+  }
+  return tot;
+  8050f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050f4:	48 98                	cltq
+}
+  8050f6:	c9                   	leave
+  8050f7:	c3                   	ret
+
+00000000008050f8 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8050f8:	55                   	push   %rbp
+  8050f9:	48 89 e5             	mov    %rsp,%rbp
+  8050fc:	48 83 ec 08          	sub    $0x8,%rsp
+  805100:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805104:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805109:	c9                   	leave
+  80510a:	c3                   	ret
+
+000000000080510b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80510b:	55                   	push   %rbp
+  80510c:	48 89 e5             	mov    %rsp,%rbp
+  80510f:	48 83 ec 10          	sub    $0x10,%rsp
+  805113:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805117:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  80511b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80511f:	48 ba fd 5b 80 00 00 	movabs $0x805bfd,%rdx
+  805126:	00 00 00 
+  805129:	48 89 d6             	mov    %rdx,%rsi
+  80512c:	48 89 c7             	mov    %rax,%rdi
+  80512f:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  805136:	00 00 00 
+  805139:	ff d0                	call   *%rax
+  return 0;
+  80513b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805140:	c9                   	leave
+  805141:	c3                   	ret
+
+0000000000805142 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805142:	55                   	push   %rbp
+  805143:	48 89 e5             	mov    %rsp,%rbp
+  805146:	48 83 ec 30          	sub    $0x30,%rsp
+  80514a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80514e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805151:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805155:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  80515c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80515f:	83 e0 02             	and    $0x2,%eax
+  805162:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805165:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805169:	8b 40 0c             	mov    0xc(%rax),%eax
+  80516c:	83 f8 01             	cmp    $0x1,%eax
+  80516f:	75 04                	jne    805175 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805171:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805175:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805178:	83 e0 01             	and    $0x1,%eax
+  80517b:	85 c0                	test   %eax,%eax
+  80517d:	74 44                	je     8051c3 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  80517f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805182:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805187:	89 c2                	mov    %eax,%edx
+  805189:	be 00 00 00 00       	mov    $0x0,%esi
+  80518e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805193:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  80519a:	00 00 00 
+  80519d:	ff d0                	call   *%rax
+  80519f:	83 f8 01             	cmp    $0x1,%eax
+  8051a2:	75 06                	jne    8051aa <devcons_poll+0x68>
+      revents |= POLLIN;
+  8051a4:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8051a8:	eb 19                	jmp    8051c3 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  8051aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051ae:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8051b4:	0b 45 fc             	or     -0x4(%rbp),%eax
+  8051b7:	89 c2                	mov    %eax,%edx
+  8051b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051bd:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  8051c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8051c6:	c9                   	leave
+  8051c7:	c3                   	ret
+
+00000000008051c8 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8051c8:	55                   	push   %rbp
+  8051c9:	48 89 e5             	mov    %rsp,%rbp
+  8051cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8051d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8051d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8051d8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8051dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051e0:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8051e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e8:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8051ef:	48 89 c7             	mov    %rax,%rdi
+  8051f2:	48 b8 00 52 80 00 00 	movabs $0x805200,%rax
+  8051f9:	00 00 00 
+  8051fc:	ff d0                	call   *%rax
+}
+  8051fe:	c9                   	leave
+  8051ff:	c3                   	ret
+
+0000000000805200 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805200:	55                   	push   %rbp
+  805201:	48 89 e5             	mov    %rsp,%rbp
+  805204:	48 83 ec 30          	sub    $0x30,%rsp
+  805208:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80520c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805210:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805214:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805218:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80521d:	75 0e                	jne    80522d <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80521f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805226:	00 00 00 
+  805229:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80522d:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805232:	75 18                	jne    80524c <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805234:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805238:	48 89 c7             	mov    %rax,%rdi
+  80523b:	48 b8 5f 25 80 00 00 	movabs $0x80255f,%rax
+  805242:	00 00 00 
+  805245:	ff d0                	call   *%rax
+  805247:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80524a:	eb 1d                	jmp    805269 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  80524c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805250:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805254:	48 89 d6             	mov    %rdx,%rsi
+  805257:	48 89 c7             	mov    %rax,%rdi
+  80525a:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  805261:	00 00 00 
+  805264:	ff d0                	call   *%rax
+  805266:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805269:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80526d:	79 2a                	jns    805299 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  80526f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805274:	74 0a                	je     805280 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80527a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805280:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805285:	74 0a                	je     805291 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805287:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80528b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805291:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805294:	e9 aa 00 00 00       	jmp    805343 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805299:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80529e:	74 36                	je     8052d6 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  8052a0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8052a7:	00 00 00 
+  8052aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8052ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8052b2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8052b9:	00 00 00 
+  8052bc:	48 98                	cltq
+  8052be:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8052c5:	48 01 d0             	add    %rdx,%rax
+  8052c8:	48 05 24 01 00 00    	add    $0x124,%rax
+  8052ce:	8b 10                	mov    (%rax),%edx
+  8052d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052d4:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8052d6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8052db:	74 36                	je     805313 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8052dd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8052e4:	00 00 00 
+  8052e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8052ea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8052ef:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8052f6:	00 00 00 
+  8052f9:	48 98                	cltq
+  8052fb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805302:	48 01 d0             	add    %rdx,%rax
+  805305:	48 05 28 01 00 00    	add    $0x128,%rax
+  80530b:	8b 10                	mov    (%rax),%edx
+  80530d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805311:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805313:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80531a:	00 00 00 
+  80531d:	8b 40 04             	mov    0x4(%rax),%eax
+  805320:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805325:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80532c:	00 00 00 
+  80532f:	48 98                	cltq
+  805331:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805338:	48 01 d0             	add    %rdx,%rax
+  80533b:	48 05 20 01 00 00    	add    $0x120,%rax
+  805341:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805343:	c9                   	leave
+  805344:	c3                   	ret
+
+0000000000805345 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805345:	55                   	push   %rbp
+  805346:	48 89 e5             	mov    %rsp,%rbp
+  805349:	48 83 ec 30          	sub    $0x30,%rsp
+  80534d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805350:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805353:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805357:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80535a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80535f:	75 5e                	jne    8053bf <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805361:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805368:	00 00 00 
+  80536b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80536f:	eb 4e                	jmp    8053bf <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805371:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805375:	79 3c                	jns    8053b3 <ipc_send+0x6e>
+  805377:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80537b:	74 36                	je     8053b3 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80537d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805380:	89 c1                	mov    %eax,%ecx
+  805382:	48 b8 08 5c 80 00 00 	movabs $0x805c08,%rax
+  805389:	00 00 00 
+  80538c:	48 89 c2             	mov    %rax,%rdx
+  80538f:	be 54 00 00 00       	mov    $0x54,%esi
+  805394:	48 b8 2e 5c 80 00 00 	movabs $0x805c2e,%rax
+  80539b:	00 00 00 
+  80539e:	48 89 c7             	mov    %rax,%rdi
+  8053a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053a6:	49 b8 82 03 80 00 00 	movabs $0x800382,%r8
+  8053ad:	00 00 00 
+  8053b0:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8053b3:	48 b8 e2 22 80 00 00 	movabs $0x8022e2,%rax
+  8053ba:	00 00 00 
+  8053bd:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8053bf:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8053c2:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8053c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8053c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053cc:	89 c7                	mov    %eax,%edi
+  8053ce:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  8053d5:	00 00 00 
+  8053d8:	ff d0                	call   *%rax
+  8053da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053e1:	75 8e                	jne    805371 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8053e3:	48 b8 e2 22 80 00 00 	movabs $0x8022e2,%rax
+  8053ea:	00 00 00 
+  8053ed:	ff d0                	call   *%rax
+}
+  8053ef:	90                   	nop
+  8053f0:	c9                   	leave
+  8053f1:	c3                   	ret
+
+00000000008053f2 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8053f2:	55                   	push   %rbp
+  8053f3:	48 89 e5             	mov    %rsp,%rbp
+  8053f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8053fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8053fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805404:	eb 4d                	jmp    805453 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805406:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80540d:	00 00 00 
+  805410:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805413:	48 98                	cltq
+  805415:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80541c:	48 01 d0             	add    %rdx,%rax
+  80541f:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805425:	8b 00                	mov    (%rax),%eax
+  805427:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80542a:	75 23                	jne    80544f <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80542c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805433:	00 00 00 
+  805436:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805439:	48 98                	cltq
+  80543b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805442:	48 01 d0             	add    %rdx,%rax
+  805445:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80544b:	8b 00                	mov    (%rax),%eax
+  80544d:	eb 12                	jmp    805461 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80544f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805453:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80545a:	7e aa                	jle    805406 <ipc_find_env+0x14>
+  return 0;
+  80545c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805461:	c9                   	leave
+  805462:	c3                   	ret
+
+0000000000805463 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805463:	55                   	push   %rbp
+  805464:	48 89 e5             	mov    %rsp,%rbp
+  805467:	48 83 ec 18          	sub    $0x18,%rsp
+  80546b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80546f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805473:	48 c1 e8 27          	shr    $0x27,%rax
+  805477:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80547c:	48 89 c2             	mov    %rax,%rdx
+  80547f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805486:	01 00 00 
+  805489:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80548d:	83 e0 01             	and    $0x1,%eax
+  805490:	48 85 c0             	test   %rax,%rax
+  805493:	74 63                	je     8054f8 <pageref+0x95>
+  805495:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805499:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80549d:	48 89 c2             	mov    %rax,%rdx
+  8054a0:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8054a7:	01 00 00 
+  8054aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8054ae:	83 e0 01             	and    $0x1,%eax
+  8054b1:	48 85 c0             	test   %rax,%rax
+  8054b4:	74 42                	je     8054f8 <pageref+0x95>
+  8054b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054ba:	48 c1 e8 15          	shr    $0x15,%rax
+  8054be:	48 89 c2             	mov    %rax,%rdx
+  8054c1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8054c8:	01 00 00 
+  8054cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8054cf:	83 e0 01             	and    $0x1,%eax
+  8054d2:	48 85 c0             	test   %rax,%rax
+  8054d5:	74 21                	je     8054f8 <pageref+0x95>
+  8054d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054db:	48 c1 e8 0c          	shr    $0xc,%rax
+  8054df:	48 89 c2             	mov    %rax,%rdx
+  8054e2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8054e9:	01 00 00 
+  8054ec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8054f0:	83 e0 01             	and    $0x1,%eax
+  8054f3:	48 85 c0             	test   %rax,%rax
+  8054f6:	75 07                	jne    8054ff <pageref+0x9c>
+    return 0;
+  8054f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054fd:	eb 53                	jmp    805552 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8054ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805503:	48 c1 e8 0c          	shr    $0xc,%rax
+  805507:	48 89 c2             	mov    %rax,%rdx
+  80550a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805511:	01 00 00 
+  805514:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805518:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  80551c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805520:	83 e0 01             	and    $0x1,%eax
+  805523:	48 85 c0             	test   %rax,%rax
+  805526:	75 07                	jne    80552f <pageref+0xcc>
+    return 0;
+  805528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80552d:	eb 23                	jmp    805552 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80552f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805533:	48 c1 e8 0c          	shr    $0xc,%rax
+  805537:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80553e:	00 00 00 
+  805541:	48 c1 e0 04          	shl    $0x4,%rax
+  805545:	48 01 d0             	add    %rdx,%rax
+  805548:	48 83 c0 08          	add    $0x8,%rax
+  80554c:	0f b7 00             	movzwl (%rax),%eax
+  80554f:	0f b7 c0             	movzwl %ax,%eax
+}
+  805552:	c9                   	leave
+  805553:	c3                   	ret
@@ -0,0 +1,10092 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 11 01 00 00       	call   80013d <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// Only need to start one of these -- splits into two with fork.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	53                   	push   %rbx
+  800037:	48 83 ec 28          	sub    $0x28,%rsp
+  80003b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80003e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  envid_t who;
+
+  if ((who = fork()) != 0) {
+  800042:	48 b8 00 2f 80 00 00 	movabs $0x802f00,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+  80004e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800051:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800054:	85 c0                	test   %eax,%eax
+  800056:	74 51                	je     8000a9 <umain+0x77>
+    // get the ball rolling
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800058:	8b 5d e8             	mov    -0x18(%rbp),%ebx
+  80005b:	48 b8 ee 1f 80 00 00 	movabs $0x801fee,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 da                	mov    %ebx,%edx
+  800069:	89 c6                	mov    %eax,%esi
+  80006b:	48 b8 00 64 80 00 00 	movabs $0x806400,%rax
+  800072:	00 00 00 
+  800075:	48 89 c7             	mov    %rax,%rdi
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	48 b9 e9 02 80 00 00 	movabs $0x8002e9,%rcx
+  800084:	00 00 00 
+  800087:	ff d1                	call   *%rcx
+    ipc_send(who, 0, 0, 0);
+  800089:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80008c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800091:	ba 00 00 00 00       	mov    $0x0,%edx
+  800096:	be 00 00 00 00       	mov    $0x0,%esi
+  80009b:	89 c7                	mov    %eax,%edi
+  80009d:	48 b8 ab 30 80 00 00 	movabs $0x8030ab,%rax
+  8000a4:	00 00 00 
+  8000a7:	ff d0                	call   *%rax
+  }
+
+  while (1) {
+    uint32_t i = ipc_recv(&who, 0, 0);
+  8000a9:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8000ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b7:	48 89 c7             	mov    %rax,%rdi
+  8000ba:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+  8000c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  8000c9:	8b 5d e8             	mov    -0x18(%rbp),%ebx
+  8000cc:	48 b8 ee 1f 80 00 00 	movabs $0x801fee,%rax
+  8000d3:	00 00 00 
+  8000d6:	ff d0                	call   *%rax
+  8000d8:	89 c6                	mov    %eax,%esi
+  8000da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000dd:	89 d9                	mov    %ebx,%ecx
+  8000df:	89 c2                	mov    %eax,%edx
+  8000e1:	48 b8 16 64 80 00 00 	movabs $0x806416,%rax
+  8000e8:	00 00 00 
+  8000eb:	48 89 c7             	mov    %rax,%rdi
+  8000ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f3:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  8000fa:	00 00 00 
+  8000fd:	41 ff d0             	call   *%r8
+    if (i == 10)
+  800100:	83 7d ec 0a          	cmpl   $0xa,-0x14(%rbp)
+  800104:	74 2d                	je     800133 <umain+0x101>
+      return;
+    i++;
+  800106:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    ipc_send(who, i, 0, 0);
+  80010a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80010d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011a:	89 c7                	mov    %eax,%edi
+  80011c:	48 b8 ab 30 80 00 00 	movabs $0x8030ab,%rax
+  800123:	00 00 00 
+  800126:	ff d0                	call   *%rax
+    if (i == 10)
+  800128:	83 7d ec 0a          	cmpl   $0xa,-0x14(%rbp)
+  80012c:	74 08                	je     800136 <umain+0x104>
+  while (1) {
+  80012e:	e9 76 ff ff ff       	jmp    8000a9 <umain+0x77>
+      return;
+  800133:	90                   	nop
+  800134:	eb 01                	jmp    800137 <umain+0x105>
+      return;
+  800136:	90                   	nop
+  }
+}
+  800137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+
+000000000080013d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  800141:	48 83 ec 20          	sub    $0x20,%rsp
+  800145:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800148:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80014c:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800153:	00 00 00 
+  800156:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80015a:	eb 13                	jmp    80016f <libmain+0x32>
+    (*ctor)();
+  80015c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800160:	48 8b 10             	mov    (%rax),%rdx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff d2                	call   *%rdx
+    ctor++;
+  80016a:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80016f:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800176:	00 00 00 
+  800179:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80017d:	72 dd                	jb     80015c <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80017f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800183:	7e 14                	jle    800199 <libmain+0x5c>
+    binaryname = argv[0];
+  800185:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800189:	48 8b 00             	mov    (%rax),%rax
+  80018c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800193:	00 00 00 
+  800196:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800199:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80019d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001a0:	48 89 d6             	mov    %rdx,%rsi
+  8001a3:	89 c7                	mov    %eax,%edi
+  8001a5:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001b1:	48 b8 c0 01 80 00 00 	movabs $0x8001c0,%rax
+  8001b8:	00 00 00 
+  8001bb:	ff d0                	call   *%rax
+#endif
+}
+  8001bd:	90                   	nop
+  8001be:	c9                   	leave
+  8001bf:	c3                   	ret
+
+00000000008001c0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c0:	55                   	push   %rbp
+  8001c1:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001c4:	48 b8 b9 35 80 00 00 	movabs $0x8035b9,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d5:	48 b8 1f 1f 80 00 00 	movabs $0x801f1f,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+}
+  8001e1:	90                   	nop
+  8001e2:	5d                   	pop    %rbp
+  8001e3:	c3                   	ret
+
+00000000008001e4 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8001e4:	55                   	push   %rbp
+  8001e5:	48 89 e5             	mov    %rsp,%rbp
+  8001e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8001ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8001f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001f7:	8b 00                	mov    (%rax),%eax
+  8001f9:	8d 48 01             	lea    0x1(%rax),%ecx
+  8001fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800200:	89 0a                	mov    %ecx,(%rdx)
+  800202:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800205:	89 d1                	mov    %edx,%ecx
+  800207:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80020b:	48 98                	cltq
+  80020d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800211:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800215:	8b 00                	mov    (%rax),%eax
+  800217:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80021c:	75 2c                	jne    80024a <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80021e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800222:	8b 00                	mov    (%rax),%eax
+  800224:	48 98                	cltq
+  800226:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80022a:	48 83 c2 08          	add    $0x8,%rdx
+  80022e:	48 89 c6             	mov    %rax,%rsi
+  800231:	48 89 d7             	mov    %rdx,%rdi
+  800234:	48 b8 50 1e 80 00 00 	movabs $0x801e50,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+    b->idx = 0;
+  800240:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800244:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80024a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024e:	8b 40 04             	mov    0x4(%rax),%eax
+  800251:	8d 50 01             	lea    0x1(%rax),%edx
+  800254:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800258:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80025b:	90                   	nop
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+000000000080025e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800269:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800270:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800277:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80027e:	00 00 00 
+  b.cnt = 0;
+  800281:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800288:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80028b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800292:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800299:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002a0:	48 89 c6             	mov    %rax,%rsi
+  8002a3:	48 b8 e4 01 80 00 00 	movabs $0x8001e4,%rax
+  8002aa:	00 00 00 
+  8002ad:	48 89 c7             	mov    %rax,%rdi
+  8002b0:	48 b8 43 06 80 00 00 	movabs $0x800643,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8002bc:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002c2:	48 98                	cltq
+  8002c4:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002cb:	48 83 c2 08          	add    $0x8,%rdx
+  8002cf:	48 89 c6             	mov    %rax,%rsi
+  8002d2:	48 89 d7             	mov    %rdx,%rdi
+  8002d5:	48 b8 50 1e 80 00 00 	movabs $0x801e50,%rax
+  8002dc:	00 00 00 
+  8002df:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8002e1:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+00000000008002e9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8002f4:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8002fb:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800302:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800309:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800310:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800317:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80031e:	84 c0                	test   %al,%al
+  800320:	74 20                	je     800342 <cprintf+0x59>
+  800322:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800326:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80032a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80032e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800332:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800336:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80033a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80033e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800342:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800349:	00 00 00 
+  80034c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800353:	00 00 00 
+  800356:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80035a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800361:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800368:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80036f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800376:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80037d:	48 89 d6             	mov    %rdx,%rsi
+  800380:	48 89 c7             	mov    %rax,%rdi
+  800383:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+  80038f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800395:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+
+000000000080039d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80039d:	55                   	push   %rbp
+  80039e:	48 89 e5             	mov    %rsp,%rbp
+  8003a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8003a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003b1:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003b4:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003b8:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8003bc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003bf:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003c3:	72 54                	jb     800419 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003c5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003c8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003cb:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d7:	48 f7 f6             	div    %rsi
+  8003da:	49 89 c2             	mov    %rax,%r10
+  8003dd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003e0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003e3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8003e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003eb:	41 89 c9             	mov    %ecx,%r9d
+  8003ee:	41 89 f8             	mov    %edi,%r8d
+  8003f1:	89 d1                	mov    %edx,%ecx
+  8003f3:	4c 89 d2             	mov    %r10,%rdx
+  8003f6:	48 89 c7             	mov    %rax,%rdi
+  8003f9:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+  800405:	eb 1c                	jmp    800423 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800407:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80040b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80040e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800412:	48 89 d6             	mov    %rdx,%rsi
+  800415:	89 c7                	mov    %eax,%edi
+  800417:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800419:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80041d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800421:	7f e4                	jg     800407 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800423:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80042a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042f:	48 f7 f1             	div    %rcx
+  800432:	48 b8 70 66 80 00 00 	movabs $0x806670,%rax
+  800439:	00 00 00 
+  80043c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800440:	0f be c0             	movsbl %al,%eax
+  800443:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800447:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80044b:	48 89 d6             	mov    %rdx,%rsi
+  80044e:	89 c7                	mov    %eax,%edi
+  800450:	ff d1                	call   *%rcx
+}
+  800452:	90                   	nop
+  800453:	c9                   	leave
+  800454:	c3                   	ret
+
+0000000000800455 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800455:	55                   	push   %rbp
+  800456:	48 89 e5             	mov    %rsp,%rbp
+  800459:	48 83 ec 10          	sub    $0x10,%rsp
+  80045d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800461:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800464:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800468:	7e 4b                	jle    8004b5 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80046a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80046e:	8b 00                	mov    (%rax),%eax
+  800470:	83 f8 2f             	cmp    $0x2f,%eax
+  800473:	77 24                	ja     800499 <getuint+0x44>
+  800475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800479:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80047d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800481:	8b 00                	mov    (%rax),%eax
+  800483:	89 c0                	mov    %eax,%eax
+  800485:	48 01 d0             	add    %rdx,%rax
+  800488:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80048c:	8b 12                	mov    (%rdx),%edx
+  80048e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800491:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800495:	89 0a                	mov    %ecx,(%rdx)
+  800497:	eb 14                	jmp    8004ad <getuint+0x58>
+  800499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80049d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004a1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004a9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004ad:	48 8b 00             	mov    (%rax),%rax
+  8004b0:	e9 95 00 00 00       	jmp    80054a <getuint+0xf5>
+  else if (lflag)
+  8004b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004b9:	74 48                	je     800503 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8004bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004bf:	8b 00                	mov    (%rax),%eax
+  8004c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c4:	77 24                	ja     8004ea <getuint+0x95>
+  8004c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004d2:	8b 00                	mov    (%rax),%eax
+  8004d4:	89 c0                	mov    %eax,%eax
+  8004d6:	48 01 d0             	add    %rdx,%rax
+  8004d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004dd:	8b 12                	mov    (%rdx),%edx
+  8004df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e6:	89 0a                	mov    %ecx,(%rdx)
+  8004e8:	eb 14                	jmp    8004fe <getuint+0xa9>
+  8004ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004fe:	48 8b 00             	mov    (%rax),%rax
+  800501:	eb 47                	jmp    80054a <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800507:	8b 00                	mov    (%rax),%eax
+  800509:	83 f8 2f             	cmp    $0x2f,%eax
+  80050c:	77 24                	ja     800532 <getuint+0xdd>
+  80050e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800512:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800516:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80051a:	8b 00                	mov    (%rax),%eax
+  80051c:	89 c0                	mov    %eax,%eax
+  80051e:	48 01 d0             	add    %rdx,%rax
+  800521:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800525:	8b 12                	mov    (%rdx),%edx
+  800527:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80052a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80052e:	89 0a                	mov    %ecx,(%rdx)
+  800530:	eb 14                	jmp    800546 <getuint+0xf1>
+  800532:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800536:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80053a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80053e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800542:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800546:	8b 00                	mov    (%rax),%eax
+  800548:	89 c0                	mov    %eax,%eax
+}
+  80054a:	c9                   	leave
+  80054b:	c3                   	ret
+
+000000000080054c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80054c:	55                   	push   %rbp
+  80054d:	48 89 e5             	mov    %rsp,%rbp
+  800550:	48 83 ec 10          	sub    $0x10,%rsp
+  800554:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800558:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80055b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80055f:	7e 4b                	jle    8005ac <getint+0x60>
+    return va_arg(*ap, long long);
+  800561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800565:	8b 00                	mov    (%rax),%eax
+  800567:	83 f8 2f             	cmp    $0x2f,%eax
+  80056a:	77 24                	ja     800590 <getint+0x44>
+  80056c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800570:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800574:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800578:	8b 00                	mov    (%rax),%eax
+  80057a:	89 c0                	mov    %eax,%eax
+  80057c:	48 01 d0             	add    %rdx,%rax
+  80057f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800583:	8b 12                	mov    (%rdx),%edx
+  800585:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800588:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80058c:	89 0a                	mov    %ecx,(%rdx)
+  80058e:	eb 14                	jmp    8005a4 <getint+0x58>
+  800590:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800594:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800598:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80059c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005a0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005a4:	48 8b 00             	mov    (%rax),%rax
+  8005a7:	e9 95 00 00 00       	jmp    800641 <getint+0xf5>
+  else if (lflag)
+  8005ac:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005b0:	74 48                	je     8005fa <getint+0xae>
+    return va_arg(*ap, long);
+  8005b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b6:	8b 00                	mov    (%rax),%eax
+  8005b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005bb:	77 24                	ja     8005e1 <getint+0x95>
+  8005bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c9:	8b 00                	mov    (%rax),%eax
+  8005cb:	89 c0                	mov    %eax,%eax
+  8005cd:	48 01 d0             	add    %rdx,%rax
+  8005d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005d4:	8b 12                	mov    (%rdx),%edx
+  8005d6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005dd:	89 0a                	mov    %ecx,(%rdx)
+  8005df:	eb 14                	jmp    8005f5 <getint+0xa9>
+  8005e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005e9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005f1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005f5:	48 8b 00             	mov    (%rax),%rax
+  8005f8:	eb 47                	jmp    800641 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8005fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fe:	8b 00                	mov    (%rax),%eax
+  800600:	83 f8 2f             	cmp    $0x2f,%eax
+  800603:	77 24                	ja     800629 <getint+0xdd>
+  800605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800609:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80060d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800611:	8b 00                	mov    (%rax),%eax
+  800613:	89 c0                	mov    %eax,%eax
+  800615:	48 01 d0             	add    %rdx,%rax
+  800618:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80061c:	8b 12                	mov    (%rdx),%edx
+  80061e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800621:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800625:	89 0a                	mov    %ecx,(%rdx)
+  800627:	eb 14                	jmp    80063d <getint+0xf1>
+  800629:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80062d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800631:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800635:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800639:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80063d:	8b 00                	mov    (%rax),%eax
+  80063f:	48 98                	cltq
+}
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+
+0000000000800643 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800643:	55                   	push   %rbp
+  800644:	48 89 e5             	mov    %rsp,%rbp
+  800647:	41 54                	push   %r12
+  800649:	53                   	push   %rbx
+  80064a:	48 83 ec 60          	sub    $0x60,%rsp
+  80064e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800652:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800656:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80065a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80065e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800662:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800666:	48 8b 06             	mov    (%rsi),%rax
+  800669:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80066d:	48 89 01             	mov    %rax,(%rcx)
+  800670:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800674:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800678:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80067c:	eb 17                	jmp    800695 <vprintfmt+0x52>
+      if (ch == '\0')
+  80067e:	85 db                	test   %ebx,%ebx
+  800680:	0f 84 bf 04 00 00    	je     800b45 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800686:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80068a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80068e:	48 89 c6             	mov    %rax,%rsi
+  800691:	89 df                	mov    %ebx,%edi
+  800693:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800695:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800699:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80069d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006a1:	0f b6 00             	movzbl (%rax),%eax
+  8006a4:	0f b6 d8             	movzbl %al,%ebx
+  8006a7:	83 fb 25             	cmp    $0x25,%ebx
+  8006aa:	75 d2                	jne    80067e <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8006ac:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8006b0:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8006b7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8006be:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8006c5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8006cc:	eb 04                	jmp    8006d2 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8006ce:	90                   	nop
+  8006cf:	eb 01                	jmp    8006d2 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8006d1:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8006d2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006da:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006de:	0f b6 00             	movzbl (%rax),%eax
+  8006e1:	0f b6 d8             	movzbl %al,%ebx
+  8006e4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8006e7:	83 f8 55             	cmp    $0x55,%eax
+  8006ea:	0f 87 22 04 00 00    	ja     800b12 <vprintfmt+0x4cf>
+  8006f0:	89 c0                	mov    %eax,%eax
+  8006f2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8006f9:	00 
+  8006fa:	48 b8 98 66 80 00 00 	movabs $0x806698,%rax
+  800701:	00 00 00 
+  800704:	48 01 d0             	add    %rdx,%rax
+  800707:	48 8b 00             	mov    (%rax),%rax
+  80070a:	ff e0                	jmp    *%rax
+        padc = '-';
+  80070c:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800710:	eb c0                	jmp    8006d2 <vprintfmt+0x8f>
+        padc = '0';
+  800712:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800716:	eb ba                	jmp    8006d2 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800718:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80071f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800722:	89 d0                	mov    %edx,%eax
+  800724:	c1 e0 02             	shl    $0x2,%eax
+  800727:	01 d0                	add    %edx,%eax
+  800729:	01 c0                	add    %eax,%eax
+  80072b:	01 d8                	add    %ebx,%eax
+  80072d:	83 e8 30             	sub    $0x30,%eax
+  800730:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800733:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800737:	0f b6 00             	movzbl (%rax),%eax
+  80073a:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80073d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800740:	7e 60                	jle    8007a2 <vprintfmt+0x15f>
+  800742:	83 fb 39             	cmp    $0x39,%ebx
+  800745:	7f 5b                	jg     8007a2 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800747:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80074c:	eb d1                	jmp    80071f <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  80074e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800751:	83 f8 2f             	cmp    $0x2f,%eax
+  800754:	77 17                	ja     80076d <vprintfmt+0x12a>
+  800756:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80075a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80075d:	89 d2                	mov    %edx,%edx
+  80075f:	48 01 d0             	add    %rdx,%rax
+  800762:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800765:	83 c2 08             	add    $0x8,%edx
+  800768:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80076b:	eb 0c                	jmp    800779 <vprintfmt+0x136>
+  80076d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800771:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800775:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800779:	8b 00                	mov    (%rax),%eax
+  80077b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  80077e:	eb 23                	jmp    8007a3 <vprintfmt+0x160>
+        if (width < 0)
+  800780:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800784:	0f 89 44 ff ff ff    	jns    8006ce <vprintfmt+0x8b>
+          width = 0;
+  80078a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800791:	e9 38 ff ff ff       	jmp    8006ce <vprintfmt+0x8b>
+        altflag = 1;
+  800796:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80079d:	e9 30 ff ff ff       	jmp    8006d2 <vprintfmt+0x8f>
+        goto process_precision;
+  8007a2:	90                   	nop
+        if (width < 0)
+  8007a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007a7:	0f 89 24 ff ff ff    	jns    8006d1 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8007ad:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007b0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007b3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8007ba:	e9 12 ff ff ff       	jmp    8006d1 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8007bf:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8007c3:	e9 0a ff ff ff       	jmp    8006d2 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8007c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ce:	77 17                	ja     8007e7 <vprintfmt+0x1a4>
+  8007d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007d4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007d7:	89 d2                	mov    %edx,%edx
+  8007d9:	48 01 d0             	add    %rdx,%rax
+  8007dc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007df:	83 c2 08             	add    $0x8,%edx
+  8007e2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007e5:	eb 0c                	jmp    8007f3 <vprintfmt+0x1b0>
+  8007e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007eb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007ef:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007f3:	8b 00                	mov    (%rax),%eax
+  8007f5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8007f9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8007fd:	48 89 d6             	mov    %rdx,%rsi
+  800800:	89 c7                	mov    %eax,%edi
+  800802:	ff d1                	call   *%rcx
+        break;
+  800804:	e9 37 03 00 00       	jmp    800b40 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800809:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	77 17                	ja     800828 <vprintfmt+0x1e5>
+  800811:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800815:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800818:	89 d2                	mov    %edx,%edx
+  80081a:	48 01 d0             	add    %rdx,%rax
+  80081d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800820:	83 c2 08             	add    $0x8,%edx
+  800823:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800826:	eb 0c                	jmp    800834 <vprintfmt+0x1f1>
+  800828:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80082c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800830:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800834:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800836:	85 db                	test   %ebx,%ebx
+  800838:	79 02                	jns    80083c <vprintfmt+0x1f9>
+          err = -err;
+  80083a:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80083c:	83 fb 15             	cmp    $0x15,%ebx
+  80083f:	7f 16                	jg     800857 <vprintfmt+0x214>
+  800841:	48 ba c0 65 80 00 00 	movabs $0x8065c0,%rdx
+  800848:	00 00 00 
+  80084b:	48 63 c3             	movslq %ebx,%rax
+  80084e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800852:	4d 85 e4             	test   %r12,%r12
+  800855:	75 2e                	jne    800885 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800857:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80085b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80085f:	89 d9                	mov    %ebx,%ecx
+  800861:	48 ba 81 66 80 00 00 	movabs $0x806681,%rdx
+  800868:	00 00 00 
+  80086b:	48 89 c7             	mov    %rax,%rdi
+  80086e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800873:	49 b8 4f 0b 80 00 00 	movabs $0x800b4f,%r8
+  80087a:	00 00 00 
+  80087d:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800880:	e9 bb 02 00 00       	jmp    800b40 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800885:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800889:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80088d:	4c 89 e1             	mov    %r12,%rcx
+  800890:	48 ba 8a 66 80 00 00 	movabs $0x80668a,%rdx
+  800897:	00 00 00 
+  80089a:	48 89 c7             	mov    %rax,%rdi
+  80089d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a2:	49 b8 4f 0b 80 00 00 	movabs $0x800b4f,%r8
+  8008a9:	00 00 00 
+  8008ac:	41 ff d0             	call   *%r8
+        break;
+  8008af:	e9 8c 02 00 00       	jmp    800b40 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	77 17                	ja     8008d3 <vprintfmt+0x290>
+  8008bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008c0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008c3:	89 d2                	mov    %edx,%edx
+  8008c5:	48 01 d0             	add    %rdx,%rax
+  8008c8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008cb:	83 c2 08             	add    $0x8,%edx
+  8008ce:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008d1:	eb 0c                	jmp    8008df <vprintfmt+0x29c>
+  8008d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008d7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008db:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008df:	4c 8b 20             	mov    (%rax),%r12
+  8008e2:	4d 85 e4             	test   %r12,%r12
+  8008e5:	75 0a                	jne    8008f1 <vprintfmt+0x2ae>
+          p = "(null)";
+  8008e7:	49 bc 8d 66 80 00 00 	movabs $0x80668d,%r12
+  8008ee:	00 00 00 
+        if (width > 0 && padc != '-')
+  8008f1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008f5:	7e 78                	jle    80096f <vprintfmt+0x32c>
+  8008f7:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8008fb:	74 72                	je     80096f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8008fd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800900:	48 98                	cltq
+  800902:	48 89 c6             	mov    %rax,%rsi
+  800905:	4c 89 e7             	mov    %r12,%rdi
+  800908:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  80090f:	00 00 00 
+  800912:	ff d0                	call   *%rax
+  800914:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800917:	eb 17                	jmp    800930 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800919:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  80091d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800921:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800925:	48 89 d6             	mov    %rdx,%rsi
+  800928:	89 c7                	mov    %eax,%edi
+  80092a:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80092c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800930:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800934:	7f e3                	jg     800919 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800936:	eb 37                	jmp    80096f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800938:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80093c:	74 1e                	je     80095c <vprintfmt+0x319>
+  80093e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800941:	7e 05                	jle    800948 <vprintfmt+0x305>
+  800943:	83 fb 7e             	cmp    $0x7e,%ebx
+  800946:	7e 14                	jle    80095c <vprintfmt+0x319>
+            putch('?', putdat);
+  800948:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80094c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800950:	48 89 c6             	mov    %rax,%rsi
+  800953:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800958:	ff d2                	call   *%rdx
+  80095a:	eb 0f                	jmp    80096b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80095c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800960:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800964:	48 89 c6             	mov    %rax,%rsi
+  800967:	89 df                	mov    %ebx,%edi
+  800969:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80096b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80096f:	4c 89 e0             	mov    %r12,%rax
+  800972:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800976:	0f b6 00             	movzbl (%rax),%eax
+  800979:	0f be d8             	movsbl %al,%ebx
+  80097c:	85 db                	test   %ebx,%ebx
+  80097e:	74 28                	je     8009a8 <vprintfmt+0x365>
+  800980:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800984:	78 b2                	js     800938 <vprintfmt+0x2f5>
+  800986:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80098a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80098e:	79 a8                	jns    800938 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800990:	eb 16                	jmp    8009a8 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800992:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800996:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80099a:	48 89 c6             	mov    %rax,%rsi
+  80099d:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009a2:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8009a4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009a8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009ac:	7f e4                	jg     800992 <vprintfmt+0x34f>
+        break;
+  8009ae:	e9 8d 01 00 00       	jmp    800b40 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8009b3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009b6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009ba:	89 d6                	mov    %edx,%esi
+  8009bc:	48 89 c7             	mov    %rax,%rdi
+  8009bf:	48 b8 4c 05 80 00 00 	movabs $0x80054c,%rax
+  8009c6:	00 00 00 
+  8009c9:	ff d0                	call   *%rax
+  8009cb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8009cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d3:	48 85 c0             	test   %rax,%rax
+  8009d6:	79 1d                	jns    8009f5 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8009d8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009dc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009e0:	48 89 c6             	mov    %rax,%rsi
+  8009e3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009e8:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8009ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ee:	48 f7 d8             	neg    %rax
+  8009f1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8009f5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8009fc:	e9 d2 00 00 00       	jmp    800ad3 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800a01:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a04:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a08:	89 d6                	mov    %edx,%esi
+  800a0a:	48 89 c7             	mov    %rax,%rdi
+  800a0d:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  800a14:	00 00 00 
+  800a17:	ff d0                	call   *%rax
+  800a19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a1d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a24:	e9 aa 00 00 00       	jmp    800ad3 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800a29:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a2c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a30:	89 d6                	mov    %edx,%esi
+  800a32:	48 89 c7             	mov    %rax,%rdi
+  800a35:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+  800a41:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800a45:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800a4c:	e9 82 00 00 00       	jmp    800ad3 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800a51:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a55:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a59:	48 89 c6             	mov    %rax,%rsi
+  800a5c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a61:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800a63:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a67:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a6b:	48 89 c6             	mov    %rax,%rsi
+  800a6e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a73:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a78:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7b:	77 17                	ja     800a94 <vprintfmt+0x451>
+  800a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a81:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a84:	89 d2                	mov    %edx,%edx
+  800a86:	48 01 d0             	add    %rdx,%rax
+  800a89:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a8c:	83 c2 08             	add    $0x8,%edx
+  800a8f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a92:	eb 0c                	jmp    800aa0 <vprintfmt+0x45d>
+  800a94:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a98:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a9c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aa0:	48 8b 00             	mov    (%rax),%rax
+  800aa3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800aa7:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800aae:	eb 23                	jmp    800ad3 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ab0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ab3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ab7:	89 d6                	mov    %edx,%esi
+  800ab9:	48 89 c7             	mov    %rax,%rdi
+  800abc:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  800ac3:	00 00 00 
+  800ac6:	ff d0                	call   *%rax
+  800ac8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800acc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800ad3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ad8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800adb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ade:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ae6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800aea:	45 89 c1             	mov    %r8d,%r9d
+  800aed:	41 89 f8             	mov    %edi,%r8d
+  800af0:	48 89 c7             	mov    %rax,%rdi
+  800af3:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  800afa:	00 00 00 
+  800afd:	ff d0                	call   *%rax
+        break;
+  800aff:	eb 3f                	jmp    800b40 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800b01:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b05:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b09:	48 89 c6             	mov    %rax,%rsi
+  800b0c:	89 df                	mov    %ebx,%edi
+  800b0e:	ff d2                	call   *%rdx
+        break;
+  800b10:	eb 2e                	jmp    800b40 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b16:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b1a:	48 89 c6             	mov    %rax,%rsi
+  800b1d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b22:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800b24:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b29:	eb 05                	jmp    800b30 <vprintfmt+0x4ed>
+  800b2b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b30:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b34:	48 83 e8 01          	sub    $0x1,%rax
+  800b38:	0f b6 00             	movzbl (%rax),%eax
+  800b3b:	3c 25                	cmp    $0x25,%al
+  800b3d:	75 ec                	jne    800b2b <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800b3f:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b40:	e9 50 fb ff ff       	jmp    800695 <vprintfmt+0x52>
+        return;
+  800b45:	90                   	nop
+    }
+  }
+}
+  800b46:	48 83 c4 60          	add    $0x60,%rsp
+  800b4a:	5b                   	pop    %rbx
+  800b4b:	41 5c                	pop    %r12
+  800b4d:	5d                   	pop    %rbp
+  800b4e:	c3                   	ret
+
+0000000000800b4f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800b4f:	55                   	push   %rbp
+  800b50:	48 89 e5             	mov    %rsp,%rbp
+  800b53:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b5a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b61:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b68:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b6f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b76:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b7d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b84:	84 c0                	test   %al,%al
+  800b86:	74 20                	je     800ba8 <printfmt+0x59>
+  800b88:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b8c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b90:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b94:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b98:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b9c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ba0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ba4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ba8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800baf:	00 00 00 
+  800bb2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bb9:	00 00 00 
+  800bbc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bc0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bc7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bce:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800bd5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800bdc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800be3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800bea:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800bf1:	48 89 c7             	mov    %rax,%rdi
+  800bf4:	48 b8 43 06 80 00 00 	movabs $0x800643,%rax
+  800bfb:	00 00 00 
+  800bfe:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800c00:	90                   	nop
+  800c01:	c9                   	leave
+  800c02:	c3                   	ret
+
+0000000000800c03 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800c03:	55                   	push   %rbp
+  800c04:	48 89 e5             	mov    %rsp,%rbp
+  800c07:	48 83 ec 10          	sub    $0x10,%rsp
+  800c0b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c0e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c16:	8b 40 10             	mov    0x10(%rax),%eax
+  800c19:	8d 50 01             	lea    0x1(%rax),%edx
+  800c1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c20:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c27:	48 8b 10             	mov    (%rax),%rdx
+  800c2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c32:	48 39 c2             	cmp    %rax,%rdx
+  800c35:	73 17                	jae    800c4e <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800c37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c3b:	48 8b 00             	mov    (%rax),%rax
+  800c3e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c46:	48 89 0a             	mov    %rcx,(%rdx)
+  800c49:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c4c:	88 10                	mov    %dl,(%rax)
+}
+  800c4e:	90                   	nop
+  800c4f:	c9                   	leave
+  800c50:	c3                   	ret
+
+0000000000800c51 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800c51:	55                   	push   %rbp
+  800c52:	48 89 e5             	mov    %rsp,%rbp
+  800c55:	48 83 ec 40          	sub    $0x40,%rsp
+  800c59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c5d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800c60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c64:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c70:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c73:	48 98                	cltq
+  800c75:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c7d:	48 01 d0             	add    %rdx,%rax
+  800c80:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c84:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800c8b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c90:	74 06                	je     800c98 <vsnprintf+0x47>
+  800c92:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c96:	7f 07                	jg     800c9f <vsnprintf+0x4e>
+    return -E_INVAL;
+  800c98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c9d:	eb 32                	jmp    800cd1 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800c9f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800ca3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800ca7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800cab:	48 89 c6             	mov    %rax,%rsi
+  800cae:	48 b8 03 0c 80 00 00 	movabs $0x800c03,%rax
+  800cb5:	00 00 00 
+  800cb8:	48 89 c7             	mov    %rax,%rdi
+  800cbb:	48 b8 43 06 80 00 00 	movabs $0x800643,%rax
+  800cc2:	00 00 00 
+  800cc5:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800cc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ccb:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800cce:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cd1:	c9                   	leave
+  800cd2:	c3                   	ret
+
+0000000000800cd3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800cd3:	55                   	push   %rbp
+  800cd4:	48 89 e5             	mov    %rsp,%rbp
+  800cd7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800cde:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ce5:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800ceb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800cf2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800cf9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d00:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d07:	84 c0                	test   %al,%al
+  800d09:	74 20                	je     800d2b <snprintf+0x58>
+  800d0b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d0f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d13:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d17:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d1b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d1f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d23:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d27:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d2b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d32:	00 00 00 
+  800d35:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d3c:	00 00 00 
+  800d3f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d43:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d4a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d51:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d58:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800d5f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d66:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d6c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d73:	48 89 c7             	mov    %rax,%rdi
+  800d76:	48 b8 51 0c 80 00 00 	movabs $0x800c51,%rax
+  800d7d:	00 00 00 
+  800d80:	ff d0                	call   *%rax
+  800d82:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800d88:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800d8e:	c9                   	leave
+  800d8f:	c3                   	ret
+
+0000000000800d90 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800d90:	55                   	push   %rbp
+  800d91:	48 89 e5             	mov    %rsp,%rbp
+  800d94:	53                   	push   %rbx
+  800d95:	48 83 ec 38          	sub    $0x38,%rsp
+  800d99:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800d9c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800da0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800da4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800da8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800dac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db4:	89 d1                	mov    %edx,%ecx
+  800db6:	0f a2                	cpuid
+  800db8:	89 de                	mov    %ebx,%esi
+  800dba:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800dbd:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800dc0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800dc3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800dc6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800dcb:	74 09                	je     800dd6 <cpuid+0x46>
+}
+  800dcd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dd1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800dd4:	89 10                	mov    %edx,(%rax)
+
+  800dd6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ddb:	74 09                	je     800de6 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800ddd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800de1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800de4:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800de6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800deb:	74 09                	je     800df6 <cpuid+0x66>
+char *
+  800ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800df1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800df4:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800df6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800dfb:	74 09                	je     800e06 <cpuid+0x76>
+  for (; *s; s++)
+  800dfd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e01:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e04:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800e06:	90                   	nop
+  800e07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e0b:	c9                   	leave
+  800e0c:	c3                   	ret
+
+0000000000800e0d <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800e0d:	55                   	push   %rbp
+  800e0e:	48 89 e5             	mov    %rsp,%rbp
+  800e11:	48 83 ec 18          	sub    $0x18,%rsp
+  800e15:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e1b:	89 c1                	mov    %eax,%ecx
+  800e1d:	0f 01 d0             	xgetbv
+  800e20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e23:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800e26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e29:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800e2c:	48 c1 e2 20          	shl    $0x20,%rdx
+  800e30:	48 09 d0             	or     %rdx,%rax
+#else
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+
+0000000000800e35 <string_cpu>:
+string_cpu(void) {
+  800e35:	55                   	push   %rbp
+  800e36:	48 89 e5             	mov    %rsp,%rbp
+  800e39:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800e3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800e44:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800e4b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e52:	00 00 00 
+  800e55:	8b 00                	mov    (%rax),%eax
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	78 11                	js     800e6c <string_cpu+0x37>
+    return string_features;
+  800e5b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e62:	00 00 00 
+  800e65:	8b 00                	mov    (%rax),%eax
+  800e67:	e9 df 00 00 00       	jmp    800f4b <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e6c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e70:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e80:	48 89 c6             	mov    %rax,%rsi
+  800e83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e88:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800e8f:	00 00 00 
+  800e92:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800e94:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e97:	83 f8 06             	cmp    $0x6,%eax
+  800e9a:	76 28                	jbe    800ec4 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800e9c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800ea0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ea6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eab:	48 89 c2             	mov    %rax,%rdx
+  800eae:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb3:	bf 07 00 00 00       	mov    $0x7,%edi
+  800eb8:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800ebf:	00 00 00 
+  800ec2:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800ec4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800ec7:	25 00 02 00 00       	and    $0x200,%eax
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	74 04                	je     800ed4 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800ed0:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800ed4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800ed8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ede:	48 89 c1             	mov    %rax,%rcx
+  800ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  800eeb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ef0:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800ef7:	00 00 00 
+  800efa:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800efc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800eff:	83 e0 20             	and    $0x20,%eax
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	74 2a                	je     800f30 <string_cpu+0xfb>
+  800f06:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800f09:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f0e:	85 c0                	test   %eax,%eax
+  800f10:	74 1e                	je     800f30 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f12:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f17:	48 b8 0d 0e 80 00 00 	movabs $0x800e0d,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  800f23:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f26:	48 83 f8 06          	cmp    $0x6,%rax
+  800f2a:	75 04                	jne    800f30 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800f2c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800f30:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800f37:	00 00 00 
+  800f3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f3d:	89 02                	mov    %eax,(%rdx)
+  800f3f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f46:	00 00 00 
+  800f49:	8b 00                	mov    (%rax),%eax
+}
+  800f4b:	c9                   	leave
+  800f4c:	c3                   	ret
+
+0000000000800f4d <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800f4d:	55                   	push   %rbp
+  800f4e:	48 89 e5             	mov    %rsp,%rbp
+  800f51:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f55:	48 83 ec 60          	sub    $0x60,%rsp
+  800f59:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800f5e:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f63:	83 e0 1f             	and    $0x1f,%eax
+  800f66:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f6a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f6e:	48 f7 d8             	neg    %rax
+  800f71:	48 89 c2             	mov    %rax,%rdx
+  800f74:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f79:	48 01 d0             	add    %rdx,%rax
+  800f7c:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800f81:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800f85:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800f8b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f90:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f94:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f9a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f9e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800fa8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800fad:	89 c1                	mov    %eax,%ecx
+  800faf:	d3 e6                	shl    %cl,%esi
+  800fb1:	89 f0                	mov    %esi,%eax
+  800fb3:	21 d0                	and    %edx,%eax
+  800fb5:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fb9:	eb 21                	jmp    800fdc <strlen_avx2+0x8f>
+    p += 32;
+  800fbb:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800fc1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fc6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fca:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fd0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fd4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fd8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fdc:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800fe1:	74 d8                	je     800fbb <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800fe3:	31 c0                	xor    %eax,%eax
+  800fe5:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800feb:	48 63 d0             	movslq %eax,%rdx
+  800fee:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ff3:	48 01 d0             	add    %rdx,%rax
+  800ff6:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800ffb:	c9                   	leave
+  800ffc:	c3                   	ret
+
+0000000000800ffd <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800ffd:	55                   	push   %rbp
+  800ffe:	48 89 e5             	mov    %rsp,%rbp
+  801001:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801005:	48 83 ec 40          	sub    $0x40,%rsp
+  801009:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80100e:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801013:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801018:	eb 77                	jmp    801091 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80101a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80101f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801023:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801027:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80102c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801030:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801034:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801038:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80103c:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801041:	74 3c                	je     80107f <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801043:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801047:	f7 d0                	not    %eax
+  801049:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80104d:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801051:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801055:	48 63 d0             	movslq %eax,%rdx
+  801058:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80105d:	48 01 d0             	add    %rdx,%rax
+  801060:	0f b6 00             	movzbl (%rax),%eax
+  801063:	0f b6 c0             	movzbl %al,%eax
+  801066:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80106a:	48 63 ca             	movslq %edx,%rcx
+  80106d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801072:	48 01 ca             	add    %rcx,%rdx
+  801075:	0f b6 12             	movzbl (%rdx),%edx
+  801078:	0f b6 d2             	movzbl %dl,%edx
+  80107b:	29 d0                	sub    %edx,%eax
+  80107d:	eb 6b                	jmp    8010ea <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80107f:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801085:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80108b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801091:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801097:	77 81                	ja     80101a <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801099:	eb 42                	jmp    8010dd <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80109b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010a0:	0f b6 10             	movzbl (%rax),%edx
+  8010a3:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010a8:	0f b6 00             	movzbl (%rax),%eax
+  8010ab:	38 c2                	cmp    %al,%dl
+  8010ad:	74 1c                	je     8010cb <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8010af:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010b4:	0f b6 00             	movzbl (%rax),%eax
+  8010b7:	0f b6 c8             	movzbl %al,%ecx
+  8010ba:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010bf:	0f b6 00             	movzbl (%rax),%eax
+  8010c2:	0f b6 d0             	movzbl %al,%edx
+  8010c5:	89 c8                	mov    %ecx,%eax
+  8010c7:	29 d0                	sub    %edx,%eax
+  8010c9:	eb 1f                	jmp    8010ea <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8010cb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010d1:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8010d7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010dd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010e3:	75 b6                	jne    80109b <memcmp_avx2+0x9e>
+  return 0;
+  8010e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ea:	c9                   	leave
+  8010eb:	c3                   	ret
+
+00000000008010ec <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8010ec:	55                   	push   %rbp
+  8010ed:	48 89 e5             	mov    %rsp,%rbp
+  8010f0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010f4:	48 83 ec 60          	sub    $0x60,%rsp
+  8010f8:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8010fd:	89 f0                	mov    %esi,%eax
+  8010ff:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801104:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801108:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80110d:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801111:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801116:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80111c:	eb 47                	jmp    801165 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80111e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801123:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801127:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80112b:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801131:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801135:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801139:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80113d:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801142:	74 15                	je     801159 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801144:	31 c0                	xor    %eax,%eax
+  801146:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80114c:	48 63 d0             	movslq %eax,%rdx
+  80114f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801154:	48 01 d0             	add    %rdx,%rax
+  801157:	eb 3d                	jmp    801196 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801159:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80115f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801165:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80116b:	77 b1                	ja     80111e <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80116d:	eb 0c                	jmp    80117b <memfind_avx2+0x8f>
+  80116f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801175:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80117b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801181:	74 0e                	je     801191 <memfind_avx2+0xa5>
+  801183:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801188:	0f b6 00             	movzbl (%rax),%eax
+  80118b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80118f:	75 de                	jne    80116f <memfind_avx2+0x83>
+  return s;
+  801191:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801196:	c9                   	leave
+  801197:	c3                   	ret
+
+0000000000801198 <strlen>:
+strlen(const char *s) {
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+  80119c:	48 83 ec 40          	sub    $0x40,%rsp
+  8011a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8011a4:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8011a8:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8011ac:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  8011b3:	00 00 00 
+  8011b6:	ff d0                	call   *%rax
+  8011b8:	83 e0 02             	and    $0x2,%eax
+  8011bb:	85 c0                	test   %eax,%eax
+  8011bd:	74 18                	je     8011d7 <strlen+0x3f>
+    return strlen_avx2(s);
+  8011bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011c3:	48 89 c7             	mov    %rax,%rdi
+  8011c6:	48 b8 4d 0f 80 00 00 	movabs $0x800f4d,%rax
+  8011cd:	00 00 00 
+  8011d0:	ff d0                	call   *%rax
+  8011d2:	e9 82 00 00 00       	jmp    801259 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8011d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011db:	83 e0 0f             	and    $0xf,%eax
+  8011de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8011e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011e4:	48 f7 d8             	neg    %rax
+  8011e7:	48 89 c2             	mov    %rax,%rdx
+  8011ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011ee:	48 01 d0             	add    %rdx,%rax
+  8011f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8011f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011f9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8011fd:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801202:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801206:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80120a:	89 c2                	mov    %eax,%edx
+  80120c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80120f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801214:	89 c1                	mov    %eax,%ecx
+  801216:	d3 e6                	shl    %cl,%esi
+  801218:	89 f0                	mov    %esi,%eax
+  80121a:	21 d0                	and    %edx,%eax
+  80121c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80121f:	eb 1d                	jmp    80123e <strlen+0xa6>
+    p += 16;
+  801221:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801226:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80122a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80122e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801233:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801237:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80123b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80123e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801242:	74 dd                	je     801221 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801244:	31 c0                	xor    %eax,%eax
+  801246:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80124b:	48 63 d0             	movslq %eax,%rdx
+  80124e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801252:	48 01 d0             	add    %rdx,%rax
+  801255:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801259:	c9                   	leave
+  80125a:	c3                   	ret
+
+000000000080125b <strnlen>:
+strnlen(const char *s, size_t size) {
+  80125b:	55                   	push   %rbp
+  80125c:	48 89 e5             	mov    %rsp,%rbp
+  80125f:	48 83 ec 20          	sub    $0x20,%rsp
+  801263:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801267:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80126b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801272:	eb 0e                	jmp    801282 <strnlen+0x27>
+    n++;
+  801274:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801278:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80127d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801282:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801287:	74 0b                	je     801294 <strnlen+0x39>
+  801289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128d:	0f b6 00             	movzbl (%rax),%eax
+  801290:	84 c0                	test   %al,%al
+  801292:	75 e0                	jne    801274 <strnlen+0x19>
+  return n;
+  801294:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801297:	c9                   	leave
+  801298:	c3                   	ret
+
+0000000000801299 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801299:	55                   	push   %rbp
+  80129a:	48 89 e5             	mov    %rsp,%rbp
+  80129d:	48 83 ec 20          	sub    $0x20,%rsp
+  8012a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8012a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8012b1:	90                   	nop
+  8012b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012b6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012c6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012ca:	0f b6 12             	movzbl (%rdx),%edx
+  8012cd:	88 10                	mov    %dl,(%rax)
+  8012cf:	0f b6 00             	movzbl (%rax),%eax
+  8012d2:	84 c0                	test   %al,%al
+  8012d4:	75 dc                	jne    8012b2 <strcpy+0x19>
+  return ret;
+  8012d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012da:	c9                   	leave
+  8012db:	c3                   	ret
+
+00000000008012dc <strcat>:
+strcat(char *dst, const char *src) {
+  8012dc:	55                   	push   %rbp
+  8012dd:	48 89 e5             	mov    %rsp,%rbp
+  8012e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8012e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8012ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f0:	48 89 c7             	mov    %rax,%rdi
+  8012f3:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8012fa:	00 00 00 
+  8012fd:	ff d0                	call   *%rax
+  8012ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801302:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801305:	48 63 d0             	movslq %eax,%rdx
+  801308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130c:	48 01 c2             	add    %rax,%rdx
+  80130f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801313:	48 89 c6             	mov    %rax,%rsi
+  801316:	48 89 d7             	mov    %rdx,%rdi
+  801319:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  801320:	00 00 00 
+  801323:	ff d0                	call   *%rax
+  return dst;
+  801325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801329:	c9                   	leave
+  80132a:	c3                   	ret
+
+000000000080132b <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+  80132f:	48 83 ec 28          	sub    $0x28,%rsp
+  801333:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801337:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80133b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80133f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801343:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801347:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80134e:	00 
+  80134f:	eb 2a                	jmp    80137b <strncpy+0x50>
+    *dst++ = *src;
+  801351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801355:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801359:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80135d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801361:	0f b6 12             	movzbl (%rdx),%edx
+  801364:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801366:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80136a:	0f b6 00             	movzbl (%rax),%eax
+  80136d:	84 c0                	test   %al,%al
+  80136f:	74 05                	je     801376 <strncpy+0x4b>
+      src++;
+  801371:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801376:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80137b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80137f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801383:	72 cc                	jb     801351 <strncpy+0x26>
+  return ret;
+  801385:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801389:	c9                   	leave
+  80138a:	c3                   	ret
+
+000000000080138b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80138b:	55                   	push   %rbp
+  80138c:	48 89 e5             	mov    %rsp,%rbp
+  80138f:	48 83 ec 28          	sub    $0x28,%rsp
+  801393:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801397:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80139b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80139f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8013a7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013ac:	74 3d                	je     8013eb <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8013ae:	eb 1d                	jmp    8013cd <strlcpy+0x42>
+      *dst++ = *src++;
+  8013b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013b4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013b8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013c4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013c8:	0f b6 12             	movzbl (%rdx),%edx
+  8013cb:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8013cd:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013d2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013d7:	74 0b                	je     8013e4 <strlcpy+0x59>
+  8013d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013dd:	0f b6 00             	movzbl (%rax),%eax
+  8013e0:	84 c0                	test   %al,%al
+  8013e2:	75 cc                	jne    8013b0 <strlcpy+0x25>
+    *dst = '\0';
+  8013e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e8:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8013eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ef:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+
+00000000008013f5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8013f5:	55                   	push   %rbp
+  8013f6:	48 89 e5             	mov    %rsp,%rbp
+  8013f9:	48 83 ec 30          	sub    $0x30,%rsp
+  8013fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801401:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801405:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801409:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80140d:	48 89 c7             	mov    %rax,%rdi
+  801410:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  801417:	00 00 00 
+  80141a:	ff d0                	call   *%rax
+  80141c:	48 98                	cltq
+  80141e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801422:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142a:	48 89 d6             	mov    %rdx,%rsi
+  80142d:	48 89 c7             	mov    %rax,%rdi
+  801430:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  801437:	00 00 00 
+  80143a:	ff d0                	call   *%rax
+  80143c:	48 98                	cltq
+  80143e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801442:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801446:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80144a:	75 10                	jne    80145c <strlcat+0x67>
+    return maxlen + srclen;
+  80144c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801454:	48 01 d0             	add    %rdx,%rax
+  801457:	e9 86 00 00 00       	jmp    8014e2 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80145c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801460:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801464:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801468:	73 2b                	jae    801495 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80146a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80146e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801472:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801476:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80147a:	48 01 c1             	add    %rax,%rcx
+  80147d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801481:	48 89 c6             	mov    %rax,%rsi
+  801484:	48 89 cf             	mov    %rcx,%rdi
+  801487:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  80148e:	00 00 00 
+  801491:	ff d0                	call   *%rax
+  801493:	eb 42                	jmp    8014d7 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801495:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801499:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80149d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a5:	48 01 c1             	add    %rax,%rcx
+  8014a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014ac:	48 89 c6             	mov    %rax,%rsi
+  8014af:	48 89 cf             	mov    %rcx,%rdi
+  8014b2:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  8014b9:	00 00 00 
+  8014bc:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8014be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014c6:	48 01 d0             	add    %rdx,%rax
+  8014c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d1:	48 01 d0             	add    %rdx,%rax
+  8014d4:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8014d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014df:	48 01 d0             	add    %rdx,%rax
+}
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+
+00000000008014e4 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8014e4:	55                   	push   %rbp
+  8014e5:	48 89 e5             	mov    %rsp,%rbp
+  8014e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8014ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8014f4:	eb 0a                	jmp    801500 <strcmp+0x1c>
+    p++, q++;
+  8014f6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014fb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801500:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801504:	0f b6 00             	movzbl (%rax),%eax
+  801507:	84 c0                	test   %al,%al
+  801509:	74 12                	je     80151d <strcmp+0x39>
+  80150b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150f:	0f b6 10             	movzbl (%rax),%edx
+  801512:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801516:	0f b6 00             	movzbl (%rax),%eax
+  801519:	38 c2                	cmp    %al,%dl
+  80151b:	74 d9                	je     8014f6 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80151d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801521:	0f b6 00             	movzbl (%rax),%eax
+  801524:	0f b6 d0             	movzbl %al,%edx
+  801527:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152b:	0f b6 00             	movzbl (%rax),%eax
+  80152e:	0f b6 c0             	movzbl %al,%eax
+  801531:	29 c2                	sub    %eax,%edx
+  801533:	89 d0                	mov    %edx,%eax
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	48 83 ec 18          	sub    $0x18,%rsp
+  80153f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801543:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801547:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80154b:	eb 0f                	jmp    80155c <strncmp+0x25>
+    n--, p++, q++;
+  80154d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801552:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801557:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80155c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801561:	74 1d                	je     801580 <strncmp+0x49>
+  801563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801567:	0f b6 00             	movzbl (%rax),%eax
+  80156a:	84 c0                	test   %al,%al
+  80156c:	74 12                	je     801580 <strncmp+0x49>
+  80156e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801572:	0f b6 10             	movzbl (%rax),%edx
+  801575:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801579:	0f b6 00             	movzbl (%rax),%eax
+  80157c:	38 c2                	cmp    %al,%dl
+  80157e:	74 cd                	je     80154d <strncmp+0x16>
+  if (n == 0)
+  801580:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801585:	75 07                	jne    80158e <strncmp+0x57>
+    return 0;
+  801587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158c:	eb 16                	jmp    8015a4 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80158e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801592:	0f b6 00             	movzbl (%rax),%eax
+  801595:	0f b6 d0             	movzbl %al,%edx
+  801598:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80159c:	0f b6 00             	movzbl (%rax),%eax
+  80159f:	0f b6 c0             	movzbl %al,%eax
+  8015a2:	29 c2                	sub    %eax,%edx
+}
+  8015a4:	89 d0                	mov    %edx,%eax
+  8015a6:	c9                   	leave
+  8015a7:	c3                   	ret
+
+00000000008015a8 <strchr>:
+strchr(const char *s, char c) {
+  8015a8:	55                   	push   %rbp
+  8015a9:	48 89 e5             	mov    %rsp,%rbp
+  8015ac:	48 83 ec 60          	sub    $0x60,%rsp
+  8015b0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8015b4:	89 f0                	mov    %esi,%eax
+  8015b6:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8015b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015bd:	83 e0 0f             	and    $0xf,%eax
+  8015c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8015c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015c6:	48 f7 d8             	neg    %rax
+  8015c9:	48 89 c2             	mov    %rax,%rdx
+  8015cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015d0:	48 01 d0             	add    %rdx,%rax
+  8015d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8015d7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015db:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8015df:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8015e3:	66 0f 6e c0          	movd   %eax,%xmm0
+  8015e7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8015eb:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8015ef:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8015f4:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8015f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015fc:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801600:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801604:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801609:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80160e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801612:	89 c2                	mov    %eax,%edx
+  801614:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801619:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80161e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801622:	09 c2                	or     %eax,%edx
+  801624:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801627:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80162c:	89 c1                	mov    %eax,%ecx
+  80162e:	d3 e6                	shl    %cl,%esi
+  801630:	89 f0                	mov    %esi,%eax
+  801632:	21 d0                	and    %edx,%eax
+  801634:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801637:	eb 34                	jmp    80166d <strchr+0xc5>
+    p += 16;
+  801639:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80163e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801642:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801646:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80164a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80164f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801654:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801658:	89 c2                	mov    %eax,%edx
+  80165a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80165f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801664:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801668:	09 d0                	or     %edx,%eax
+  80166a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80166d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801671:	74 c6                	je     801639 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801673:	31 c0                	xor    %eax,%eax
+  801675:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80167a:	48 98                	cltq
+  80167c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801680:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801684:	0f b6 00             	movzbl (%rax),%eax
+  801687:	84 c0                	test   %al,%al
+  801689:	74 06                	je     801691 <strchr+0xe9>
+  80168b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80168f:	eb 05                	jmp    801696 <strchr+0xee>
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+
+0000000000801698 <strfind>:
+strfind(const char *s, char c) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+  80169c:	48 83 ec 10          	sub    $0x10,%rsp
+  8016a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016a4:	89 f0                	mov    %esi,%eax
+  8016a6:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8016a9:	eb 11                	jmp    8016bc <strfind+0x24>
+    if (*s == c)
+  8016ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016af:	0f b6 00             	movzbl (%rax),%eax
+  8016b2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016b5:	74 12                	je     8016c9 <strfind+0x31>
+  for (; *s; s++)
+  8016b7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c0:	0f b6 00             	movzbl (%rax),%eax
+  8016c3:	84 c0                	test   %al,%al
+  8016c5:	75 e4                	jne    8016ab <strfind+0x13>
+  8016c7:	eb 01                	jmp    8016ca <strfind+0x32>
+      break;
+  8016c9:	90                   	nop
+  return (char *)s;
+  8016ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <memset>:
+memset(void *v, int c, size_t n) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	48 83 ec 38          	sub    $0x38,%rsp
+  8016d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8016dc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8016df:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8016e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8016eb:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8016f0:	76 41                	jbe    801733 <memset+0x63>
+  8016f2:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  8016f9:	00 00 00 
+  8016fc:	ff d0                	call   *%rax
+  8016fe:	83 e0 01             	and    $0x1,%eax
+  801701:	85 c0                	test   %eax,%eax
+  801703:	74 2e                	je     801733 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801705:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801708:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80170c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801710:	48 89 ce             	mov    %rcx,%rsi
+  801713:	48 89 f7             	mov    %rsi,%rdi
+  801716:	48 89 d1             	mov    %rdx,%rcx
+  801719:	fc                   	cld
+  80171a:	f3 aa                	rep stos %al,%es:(%rdi)
+  80171c:	48 89 ca             	mov    %rcx,%rdx
+  80171f:	48 89 fe             	mov    %rdi,%rsi
+  801722:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801726:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80172a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80172e:	e9 a7 00 00 00       	jmp    8017da <memset+0x10a>
+  if (n >= 8) {
+  801733:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801738:	0f 86 87 00 00 00    	jbe    8017c5 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  80173e:	eb 16                	jmp    801756 <memset+0x86>
+      *p++ = c;
+  801740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801744:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801748:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80174c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80174f:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801751:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801756:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80175a:	83 e0 07             	and    $0x7,%eax
+  80175d:	48 85 c0             	test   %rax,%rax
+  801760:	75 de                	jne    801740 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801762:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801765:	0f b6 c0             	movzbl %al,%eax
+  801768:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80176f:	01 01 01 
+  801772:	48 0f af c2          	imul   %rdx,%rax
+  801776:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80177a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80177e:	48 c1 e8 03          	shr    $0x3,%rax
+  801782:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801786:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80178e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801792:	48 89 ce             	mov    %rcx,%rsi
+  801795:	48 89 f7             	mov    %rsi,%rdi
+  801798:	48 89 d1             	mov    %rdx,%rcx
+  80179b:	fc                   	cld
+  80179c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80179f:	48 89 ca             	mov    %rcx,%rdx
+  8017a2:	48 89 fe             	mov    %rdi,%rsi
+  8017a5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8017a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8017ad:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8017b2:	eb 11                	jmp    8017c5 <memset+0xf5>
+    *p++ = c;
+  8017b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017bc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017c0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017c3:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8017c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017d1:	48 85 c0             	test   %rax,%rax
+  8017d4:	75 de                	jne    8017b4 <memset+0xe4>
+  return v;
+  8017d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+
+00000000008017dc <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8017e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8017f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8017f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801804:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801808:	0f 83 da 00 00 00    	jae    8018e8 <memmove+0x10c>
+  80180e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801812:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801816:	48 01 d0             	add    %rdx,%rax
+  801819:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80181d:	0f 83 c5 00 00 00    	jae    8018e8 <memmove+0x10c>
+    s += n;
+  801823:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801827:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80182b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80182f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801833:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801838:	0f 86 94 00 00 00    	jbe    8018d2 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80183e:	eb 1c                	jmp    80185c <memmove+0x80>
+        *--d = *--s;
+  801840:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801845:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80184a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184e:	0f b6 10             	movzbl (%rax),%edx
+  801851:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801855:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801857:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80185c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801860:	83 e0 07             	and    $0x7,%eax
+  801863:	48 85 c0             	test   %rax,%rax
+  801866:	75 d8                	jne    801840 <memmove+0x64>
+      nq = n / 8;
+  801868:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80186c:	48 c1 e8 03          	shr    $0x3,%rax
+  801870:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801874:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801879:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  80187e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801883:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801887:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80188b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80188f:	48 89 cf             	mov    %rcx,%rdi
+  801892:	48 89 d6             	mov    %rdx,%rsi
+  801895:	48 89 c1             	mov    %rax,%rcx
+  801898:	fd                   	std
+  801899:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80189c:	fc                   	cld
+  80189d:	48 89 c8             	mov    %rcx,%rax
+  8018a0:	48 89 f2             	mov    %rsi,%rdx
+  8018a3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018a7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8018af:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8018b4:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8018b9:	eb 17                	jmp    8018d2 <memmove+0xf6>
+      *--d = *--s;
+  8018bb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018c0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c9:	0f b6 10             	movzbl (%rax),%edx
+  8018cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018d0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018d6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018de:	48 85 c0             	test   %rax,%rax
+  8018e1:	75 d8                	jne    8018bb <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8018e3:	e9 f4 00 00 00       	jmp    8019dc <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8018e8:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8018ed:	76 46                	jbe    801935 <memmove+0x159>
+  8018ef:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  8018f6:	00 00 00 
+  8018f9:	ff d0                	call   *%rax
+  8018fb:	83 e0 01             	and    $0x1,%eax
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	74 33                	je     801935 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801902:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801906:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80190a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190e:	48 89 cf             	mov    %rcx,%rdi
+  801911:	48 89 d6             	mov    %rdx,%rsi
+  801914:	48 89 c1             	mov    %rax,%rcx
+  801917:	fc                   	cld
+  801918:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80191a:	48 89 c8             	mov    %rcx,%rax
+  80191d:	48 89 f2             	mov    %rsi,%rdx
+  801920:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801924:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801928:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80192c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801930:	e9 ab 00 00 00       	jmp    8019e0 <memmove+0x204>
+    if (n >= 8) {
+  801935:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80193a:	0f 86 8b 00 00 00    	jbe    8019cb <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801940:	eb 22                	jmp    801964 <memmove+0x188>
+        *d++ = *s++;
+  801942:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801946:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80194a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80194e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801952:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801956:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80195a:	0f b6 12             	movzbl (%rdx),%edx
+  80195d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80195f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801964:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801968:	83 e0 07             	and    $0x7,%eax
+  80196b:	48 85 c0             	test   %rax,%rax
+  80196e:	75 d2                	jne    801942 <memmove+0x166>
+      nq = n / 8;
+  801970:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801974:	48 c1 e8 03          	shr    $0x3,%rax
+  801978:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80197c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801980:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801984:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801988:	48 89 cf             	mov    %rcx,%rdi
+  80198b:	48 89 d6             	mov    %rdx,%rsi
+  80198e:	48 89 c1             	mov    %rax,%rcx
+  801991:	fc                   	cld
+  801992:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801995:	48 89 c8             	mov    %rcx,%rax
+  801998:	48 89 f2             	mov    %rsi,%rdx
+  80199b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80199f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019a7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8019ac:	eb 1d                	jmp    8019cb <memmove+0x1ef>
+      *d++ = *s++;
+  8019ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019b2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019be:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019c2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019c6:	0f b6 12             	movzbl (%rdx),%edx
+  8019c9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019cf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019d3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019d7:	48 85 c0             	test   %rax,%rax
+  8019da:	75 d2                	jne    8019ae <memmove+0x1d2>
+  return dst;
+  8019dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+00000000008019e2 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019f2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8019f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019fa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a02:	48 89 ce             	mov    %rcx,%rsi
+  801a05:	48 89 c7             	mov    %rax,%rdi
+  801a08:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+}
+  801a14:	c9                   	leave
+  801a15:	c3                   	ret
+
+0000000000801a16 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	48 83 ec 40          	sub    $0x40,%rsp
+  801a1e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a22:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801a2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801a32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801a3a:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801a3f:	0f 86 a7 00 00 00    	jbe    801aec <memcmp+0xd6>
+  801a45:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  801a4c:	00 00 00 
+  801a4f:	ff d0                	call   *%rax
+  801a51:	83 e0 02             	and    $0x2,%eax
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	0f 84 90 00 00 00    	je     801aec <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801a5c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a60:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a68:	48 89 ce             	mov    %rcx,%rsi
+  801a6b:	48 89 c7             	mov    %rax,%rdi
+  801a6e:	48 b8 fd 0f 80 00 00 	movabs $0x800ffd,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+  801a7a:	e9 c2 00 00 00       	jmp    801b41 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a83:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a87:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801a8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a93:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801a97:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801a9e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801aa5:	74 36                	je     801add <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801aa7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801aaa:	f7 d0                	not    %eax
+  801aac:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ab0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ab3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ab6:	48 63 d0             	movslq %eax,%rdx
+  801ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abd:	48 01 d0             	add    %rdx,%rax
+  801ac0:	0f b6 00             	movzbl (%rax),%eax
+  801ac3:	0f b6 c0             	movzbl %al,%eax
+  801ac6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ac9:	48 63 ca             	movslq %edx,%rcx
+  801acc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ad0:	48 01 ca             	add    %rcx,%rdx
+  801ad3:	0f b6 12             	movzbl (%rdx),%edx
+  801ad6:	0f b6 d2             	movzbl %dl,%edx
+  801ad9:	29 d0                	sub    %edx,%eax
+  801adb:	eb 64                	jmp    801b41 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801add:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ae2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801ae7:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801aec:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801af1:	77 8c                	ja     801a7f <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801af3:	eb 36                	jmp    801b2b <memcmp+0x115>
+    if (*s1 != *s2)
+  801af5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af9:	0f b6 10             	movzbl (%rax),%edx
+  801afc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b00:	0f b6 00             	movzbl (%rax),%eax
+  801b03:	38 c2                	cmp    %al,%dl
+  801b05:	74 1a                	je     801b21 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b0b:	0f b6 00             	movzbl (%rax),%eax
+  801b0e:	0f b6 c8             	movzbl %al,%ecx
+  801b11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b15:	0f b6 00             	movzbl (%rax),%eax
+  801b18:	0f b6 d0             	movzbl %al,%edx
+  801b1b:	89 c8                	mov    %ecx,%eax
+  801b1d:	29 d0                	sub    %edx,%eax
+  801b1f:	eb 20                	jmp    801b41 <memcmp+0x12b>
+    s1++, s2++;
+  801b21:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b26:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801b2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b2f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b33:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b37:	48 85 c0             	test   %rax,%rax
+  801b3a:	75 b9                	jne    801af5 <memcmp+0xdf>
+  }
+
+  return 0;
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b41:	c9                   	leave
+  801b42:	c3                   	ret
+
+0000000000801b43 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801b43:	55                   	push   %rbp
+  801b44:	48 89 e5             	mov    %rsp,%rbp
+  801b47:	48 83 ec 50          	sub    $0x50,%rsp
+  801b4b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b4f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801b52:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801b56:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b5a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b5e:	48 01 d0             	add    %rdx,%rax
+  801b61:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801b65:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b68:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b6c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b70:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b74:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b79:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b7d:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801b82:	76 73                	jbe    801bf7 <memfind+0xb4>
+  801b84:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	83 e0 02             	and    $0x2,%eax
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	74 60                	je     801bf7 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801b97:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b9a:	0f b6 c8             	movzbl %al,%ecx
+  801b9d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ba1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ba5:	89 ce                	mov    %ecx,%esi
+  801ba7:	48 89 c7             	mov    %rax,%rdi
+  801baa:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  801bb1:	00 00 00 
+  801bb4:	ff d0                	call   *%rax
+  801bb6:	eb 6c                	jmp    801c24 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801bb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bbc:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bc0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bc4:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801bc9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bcd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bd1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bd4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801bd8:	74 13                	je     801bed <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801bda:	31 c0                	xor    %eax,%eax
+  801bdc:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801be1:	48 63 d0             	movslq %eax,%rdx
+  801be4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be8:	48 01 d0             	add    %rdx,%rax
+  801beb:	eb 37                	jmp    801c24 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801bed:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801bf2:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801bf7:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801bfc:	77 ba                	ja     801bb8 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801bfe:	eb 13                	jmp    801c13 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801c00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c04:	0f b6 00             	movzbl (%rax),%eax
+  801c07:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801c0a:	38 d0                	cmp    %dl,%al
+  801c0c:	74 11                	je     801c1f <memfind+0xdc>
+  for (; s < ends; s++)
+  801c0e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c17:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c1b:	72 e3                	jb     801c00 <memfind+0xbd>
+  801c1d:	eb 01                	jmp    801c20 <memfind+0xdd>
+      break;
+  801c1f:	90                   	nop
+  return (void *)s;
+  801c20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c24:	c9                   	leave
+  801c25:	c3                   	ret
+
+0000000000801c26 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801c26:	55                   	push   %rbp
+  801c27:	48 89 e5             	mov    %rsp,%rbp
+  801c2a:	48 83 ec 38          	sub    $0x38,%rsp
+  801c2e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c32:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c36:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801c39:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801c40:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c47:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801c48:	eb 05                	jmp    801c4f <strtol+0x29>
+    s++;
+  801c4a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c53:	0f b6 00             	movzbl (%rax),%eax
+  801c56:	3c 20                	cmp    $0x20,%al
+  801c58:	74 f0                	je     801c4a <strtol+0x24>
+  801c5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5e:	0f b6 00             	movzbl (%rax),%eax
+  801c61:	3c 09                	cmp    $0x9,%al
+  801c63:	74 e5                	je     801c4a <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801c65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c69:	0f b6 00             	movzbl (%rax),%eax
+  801c6c:	3c 2b                	cmp    $0x2b,%al
+  801c6e:	75 07                	jne    801c77 <strtol+0x51>
+    s++;
+  801c70:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c75:	eb 17                	jmp    801c8e <strtol+0x68>
+  else if (*s == '-')
+  801c77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7b:	0f b6 00             	movzbl (%rax),%eax
+  801c7e:	3c 2d                	cmp    $0x2d,%al
+  801c80:	75 0c                	jne    801c8e <strtol+0x68>
+    s++, neg = 1;
+  801c82:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c87:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c8e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c92:	74 06                	je     801c9a <strtol+0x74>
+  801c94:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c98:	75 28                	jne    801cc2 <strtol+0x9c>
+  801c9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9e:	0f b6 00             	movzbl (%rax),%eax
+  801ca1:	3c 30                	cmp    $0x30,%al
+  801ca3:	75 1d                	jne    801cc2 <strtol+0x9c>
+  801ca5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca9:	48 83 c0 01          	add    $0x1,%rax
+  801cad:	0f b6 00             	movzbl (%rax),%eax
+  801cb0:	3c 78                	cmp    $0x78,%al
+  801cb2:	75 0e                	jne    801cc2 <strtol+0x9c>
+    s += 2, base = 16;
+  801cb4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cb9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cc0:	eb 2c                	jmp    801cee <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801cc2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cc6:	75 19                	jne    801ce1 <strtol+0xbb>
+  801cc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ccc:	0f b6 00             	movzbl (%rax),%eax
+  801ccf:	3c 30                	cmp    $0x30,%al
+  801cd1:	75 0e                	jne    801ce1 <strtol+0xbb>
+    s++, base = 8;
+  801cd3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cd8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801cdf:	eb 0d                	jmp    801cee <strtol+0xc8>
+  else if (base == 0)
+  801ce1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ce5:	75 07                	jne    801cee <strtol+0xc8>
+    base = 10;
+  801ce7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801cee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf2:	0f b6 00             	movzbl (%rax),%eax
+  801cf5:	3c 2f                	cmp    $0x2f,%al
+  801cf7:	7e 1d                	jle    801d16 <strtol+0xf0>
+  801cf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfd:	0f b6 00             	movzbl (%rax),%eax
+  801d00:	3c 39                	cmp    $0x39,%al
+  801d02:	7f 12                	jg     801d16 <strtol+0xf0>
+      dig = *s - '0';
+  801d04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d08:	0f b6 00             	movzbl (%rax),%eax
+  801d0b:	0f be c0             	movsbl %al,%eax
+  801d0e:	83 e8 30             	sub    $0x30,%eax
+  801d11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d14:	eb 4e                	jmp    801d64 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d1a:	0f b6 00             	movzbl (%rax),%eax
+  801d1d:	3c 60                	cmp    $0x60,%al
+  801d1f:	7e 1d                	jle    801d3e <strtol+0x118>
+  801d21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d25:	0f b6 00             	movzbl (%rax),%eax
+  801d28:	3c 7a                	cmp    $0x7a,%al
+  801d2a:	7f 12                	jg     801d3e <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801d2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d30:	0f b6 00             	movzbl (%rax),%eax
+  801d33:	0f be c0             	movsbl %al,%eax
+  801d36:	83 e8 57             	sub    $0x57,%eax
+  801d39:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d3c:	eb 26                	jmp    801d64 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d42:	0f b6 00             	movzbl (%rax),%eax
+  801d45:	3c 40                	cmp    $0x40,%al
+  801d47:	7e 47                	jle    801d90 <strtol+0x16a>
+  801d49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4d:	0f b6 00             	movzbl (%rax),%eax
+  801d50:	3c 5a                	cmp    $0x5a,%al
+  801d52:	7f 3c                	jg     801d90 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801d54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d58:	0f b6 00             	movzbl (%rax),%eax
+  801d5b:	0f be c0             	movsbl %al,%eax
+  801d5e:	83 e8 37             	sub    $0x37,%eax
+  801d61:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801d64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d67:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d6a:	7d 23                	jge    801d8f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d6c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d71:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d74:	48 98                	cltq
+  801d76:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d7b:	48 89 c2             	mov    %rax,%rdx
+  801d7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d81:	48 98                	cltq
+  801d83:	48 01 d0             	add    %rdx,%rax
+  801d86:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801d8a:	e9 5f ff ff ff       	jmp    801cee <strtol+0xc8>
+      break;
+  801d8f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801d90:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d95:	74 0b                	je     801da2 <strtol+0x17c>
+    *endptr = (char *)s;
+  801d97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d9f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801da2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801da6:	74 09                	je     801db1 <strtol+0x18b>
+  801da8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dac:	48 f7 d8             	neg    %rax
+  801daf:	eb 04                	jmp    801db5 <strtol+0x18f>
+  801db1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801db5:	c9                   	leave
+  801db6:	c3                   	ret
+
+0000000000801db7 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801db7:	55                   	push   %rbp
+  801db8:	48 89 e5             	mov    %rsp,%rbp
+  801dbb:	53                   	push   %rbx
+  801dbc:	48 83 ec 48          	sub    $0x48,%rsp
+  801dc0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dc4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dc8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dcc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801dd0:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801dd4:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801dd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ddc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801de0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801de4:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801de8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801dec:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801df0:	4c 89 c3             	mov    %r8,%rbx
+  801df3:	cd 30                	int    $0x30
+  801df5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801df9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dfe:	74 46                	je     801e46 <syscall+0x8f>
+  801e00:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e05:	7e 3f                	jle    801e46 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801e07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e0f:	49 89 d0             	mov    %rdx,%r8
+  801e12:	48 89 c1             	mov    %rax,%rcx
+  801e15:	48 b8 48 69 80 00 00 	movabs $0x806948,%rax
+  801e1c:	00 00 00 
+  801e1f:	48 89 c2             	mov    %rax,%rdx
+  801e22:	be 22 00 00 00       	mov    $0x22,%esi
+  801e27:	48 b8 67 69 80 00 00 	movabs $0x806967,%rax
+  801e2e:	00 00 00 
+  801e31:	48 89 c7             	mov    %rax,%rdi
+  801e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e39:	49 b9 b1 5a 80 00 00 	movabs $0x805ab1,%r9
+  801e40:	00 00 00 
+  801e43:	41 ff d1             	call   *%r9
+
+  return ret;
+  801e46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e4e:	c9                   	leave
+  801e4f:	c3                   	ret
+
+0000000000801e50 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e50:	55                   	push   %rbp
+  801e51:	48 89 e5             	mov    %rsp,%rbp
+  801e54:	48 83 ec 10          	sub    $0x10,%rsp
+  801e58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e68:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6c:	6a 00                	push   $0x0
+  801e6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e7a:	48 89 d1             	mov    %rdx,%rcx
+  801e7d:	48 89 c2             	mov    %rax,%rdx
+  801e80:	be 00 00 00 00       	mov    $0x0,%esi
+  801e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8a:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  801e91:	00 00 00 
+  801e94:	ff d0                	call   *%rax
+  801e96:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e9a:	90                   	nop
+  801e9b:	c9                   	leave
+  801e9c:	c3                   	ret
+
+0000000000801e9d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ea1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ead:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ec7:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  801ece:	00 00 00 
+  801ed1:	ff d0                	call   *%rax
+  801ed3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+
+0000000000801ed9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ed9:	55                   	push   %rbp
+  801eda:	48 89 e5             	mov    %rsp,%rbp
+  801edd:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801ee4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ee7:	48 98                	cltq
+  801ee9:	48 83 ec 08          	sub    $0x8,%rsp
+  801eed:	6a 00                	push   $0x0
+  801eef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ef5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801efb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f00:	48 89 c2             	mov    %rax,%rdx
+  801f03:	be 01 00 00 00       	mov    $0x1,%esi
+  801f08:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f0d:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+0000000000801f1f <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f1f:	55                   	push   %rbp
+  801f20:	48 89 e5             	mov    %rsp,%rbp
+  801f23:	48 83 ec 10          	sub    $0x10,%rsp
+  801f27:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801f2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f2d:	48 98                	cltq
+  801f2f:	48 83 ec 08          	sub    $0x8,%rsp
+  801f33:	6a 00                	push   $0x0
+  801f35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f46:	48 89 c2             	mov    %rax,%rdx
+  801f49:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4e:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f53:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+  801f5f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f63:	90                   	nop
+  801f64:	c9                   	leave
+  801f65:	c3                   	ret
+
+0000000000801f66 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801f66:	55                   	push   %rbp
+  801f67:	48 89 e5             	mov    %rsp,%rbp
+  801f6a:	48 83 ec 20          	sub    $0x20,%rsp
+  801f6e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f71:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f75:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f78:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801f7b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f80:	cd 30                	int    $0x30
+  801f82:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f86:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801f8a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f8f:	7e 3d                	jle    801fce <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801f91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f95:	49 89 c0             	mov    %rax,%r8
+  801f98:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f9d:	48 b8 48 69 80 00 00 	movabs $0x806948,%rax
+  801fa4:	00 00 00 
+  801fa7:	48 89 c2             	mov    %rax,%rdx
+  801faa:	be 49 00 00 00       	mov    $0x49,%esi
+  801faf:	48 b8 67 69 80 00 00 	movabs $0x806967,%rax
+  801fb6:	00 00 00 
+  801fb9:	48 89 c7             	mov    %rax,%rdi
+  801fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc1:	49 b9 b1 5a 80 00 00 	movabs $0x805ab1,%r9
+  801fc8:	00 00 00 
+  801fcb:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801fce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fd3:	75 13                	jne    801fe8 <sys_env_wait+0x82>
+  801fd5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801fda:	74 0c                	je     801fe8 <sys_env_wait+0x82>
+    *status = st;
+  801fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fe0:	89 c2                	mov    %eax,%edx
+  801fe2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fe6:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801fe8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+
+0000000000801fee <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801fee:	55                   	push   %rbp
+  801fef:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801ff2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff6:	6a 00                	push   $0x0
+  801ff8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802004:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200e:	be 00 00 00 00       	mov    $0x0,%esi
+  802013:	bf 02 00 00 00       	mov    $0x2,%edi
+  802018:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80201f:	00 00 00 
+  802022:	ff d0                	call   *%rax
+  802024:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+000000000080202a <sys_yield>:
+
+void
+sys_yield(void) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80202e:	48 83 ec 08          	sub    $0x8,%rsp
+  802032:	6a 00                	push   $0x0
+  802034:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80203a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802040:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802045:	ba 00 00 00 00       	mov    $0x0,%edx
+  80204a:	be 00 00 00 00       	mov    $0x0,%esi
+  80204f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802054:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802064:	90                   	nop
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+
+0000000000802067 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802067:	55                   	push   %rbp
+  802068:	48 89 e5             	mov    %rsp,%rbp
+  80206b:	48 83 ec 20          	sub    $0x20,%rsp
+  80206f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802072:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802076:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802079:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80207c:	48 63 c8             	movslq %eax,%rcx
+  80207f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802083:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802086:	48 98                	cltq
+  802088:	48 83 ec 08          	sub    $0x8,%rsp
+  80208c:	6a 00                	push   $0x0
+  80208e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802094:	49 89 c8             	mov    %rcx,%r8
+  802097:	48 89 d1             	mov    %rdx,%rcx
+  80209a:	48 89 c2             	mov    %rax,%rdx
+  80209d:	be 01 00 00 00       	mov    $0x1,%esi
+  8020a2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020a7:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+  8020b3:	48 83 c4 10          	add    $0x10,%rsp
+  8020b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8020ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+
+00000000008020bf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8020bf:	55                   	push   %rbp
+  8020c0:	48 89 e5             	mov    %rsp,%rbp
+  8020c3:	48 83 ec 20          	sub    $0x20,%rsp
+  8020c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020ce:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020d1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020d5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8020d9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8020dc:	48 63 c8             	movslq %eax,%rcx
+  8020df:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020e6:	48 63 f0             	movslq %eax,%rsi
+  8020e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020f0:	48 98                	cltq
+  8020f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f6:	51                   	push   %rcx
+  8020f7:	49 89 f9             	mov    %rdi,%r9
+  8020fa:	49 89 f0             	mov    %rsi,%r8
+  8020fd:	48 89 d1             	mov    %rdx,%rcx
+  802100:	48 89 c2             	mov    %rax,%rdx
+  802103:	be 01 00 00 00       	mov    $0x1,%esi
+  802108:	bf 07 00 00 00       	mov    $0x7,%edi
+  80210d:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+  802119:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+000000000080211f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	48 83 ec 10          	sub    $0x10,%rsp
+  802127:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80212a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80212e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802132:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802135:	48 98                	cltq
+  802137:	48 83 ec 08          	sub    $0x8,%rsp
+  80213b:	6a 00                	push   $0x0
+  80213d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802149:	48 89 d1             	mov    %rdx,%rcx
+  80214c:	48 89 c2             	mov    %rax,%rdx
+  80214f:	be 01 00 00 00       	mov    $0x1,%esi
+  802154:	bf 08 00 00 00       	mov    $0x8,%edi
+  802159:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802160:	00 00 00 
+  802163:	ff d0                	call   *%rax
+  802165:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+
+000000000080216b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80216b:	55                   	push   %rbp
+  80216c:	48 89 e5             	mov    %rsp,%rbp
+  80216f:	48 83 ec 10          	sub    $0x10,%rsp
+  802173:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802176:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802179:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80217c:	48 63 d0             	movslq %eax,%rdx
+  80217f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802182:	48 98                	cltq
+  802184:	48 83 ec 08          	sub    $0x8,%rsp
+  802188:	6a 00                	push   $0x0
+  80218a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802196:	48 89 d1             	mov    %rdx,%rcx
+  802199:	48 89 c2             	mov    %rax,%rdx
+  80219c:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021a6:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+  8021b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021b6:	c9                   	leave
+  8021b7:	c3                   	ret
+
+00000000008021b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8021b8:	55                   	push   %rbp
+  8021b9:	48 89 e5             	mov    %rsp,%rbp
+  8021bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8021c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021ce:	48 98                	cltq
+  8021d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d4:	6a 00                	push   $0x0
+  8021d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021e2:	48 89 d1             	mov    %rdx,%rcx
+  8021e5:	48 89 c2             	mov    %rax,%rdx
+  8021e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8021ed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021f2:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+
+0000000000802204 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+  802208:	48 83 ec 10          	sub    $0x10,%rsp
+  80220c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802213:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80221a:	48 98                	cltq
+  80221c:	48 83 ec 08          	sub    $0x8,%rsp
+  802220:	6a 00                	push   $0x0
+  802222:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802228:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222e:	48 89 d1             	mov    %rdx,%rcx
+  802231:	48 89 c2             	mov    %rax,%rdx
+  802234:	be 01 00 00 00       	mov    $0x1,%esi
+  802239:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80223e:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802245:	00 00 00 
+  802248:	ff d0                	call   *%rax
+  80224a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+0000000000802250 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 83 ec 20          	sub    $0x20,%rsp
+  802258:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80225b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80225f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802263:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802266:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802269:	48 63 f0             	movslq %eax,%rsi
+  80226c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802270:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802274:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802277:	48 98                	cltq
+  802279:	48 83 ec 08          	sub    $0x8,%rsp
+  80227d:	6a 00                	push   $0x0
+  80227f:	49 89 f1             	mov    %rsi,%r9
+  802282:	49 89 c8             	mov    %rcx,%r8
+  802285:	48 89 d1             	mov    %rdx,%rcx
+  802288:	48 89 c2             	mov    %rax,%rdx
+  80228b:	be 00 00 00 00       	mov    $0x0,%esi
+  802290:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802295:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80229c:	00 00 00 
+  80229f:	ff d0                	call   *%rax
+  8022a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a5:	c9                   	leave
+  8022a6:	c3                   	ret
+
+00000000008022a7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8022a7:	55                   	push   %rbp
+  8022a8:	48 89 e5             	mov    %rsp,%rbp
+  8022ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8022af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8022b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022bb:	6a 00                	push   $0x0
+  8022bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ce:	48 89 c2             	mov    %rax,%rdx
+  8022d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8022d6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8022db:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8022e2:	00 00 00 
+  8022e5:	ff d0                	call   *%rax
+  8022e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+00000000008022ed <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8022ed:	55                   	push   %rbp
+  8022ee:	48 89 e5             	mov    %rsp,%rbp
+  8022f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8022fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802301:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802305:	48 83 ec 08          	sub    $0x8,%rsp
+  802309:	6a 00                	push   $0x0
+  80230b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802311:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802317:	48 89 d1             	mov    %rdx,%rcx
+  80231a:	48 89 c2             	mov    %rax,%rdx
+  80231d:	be 01 00 00 00       	mov    $0x1,%esi
+  802322:	bf 10 00 00 00       	mov    $0x10,%edi
+  802327:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80232e:	00 00 00 
+  802331:	ff d0                	call   *%rax
+  802333:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802337:	c9                   	leave
+  802338:	c3                   	ret
+
+0000000000802339 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80233d:	48 83 ec 08          	sub    $0x8,%rsp
+  802341:	6a 00                	push   $0x0
+  802343:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802349:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80234f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802354:	ba 00 00 00 00       	mov    $0x0,%edx
+  802359:	be 00 00 00 00       	mov    $0x0,%esi
+  80235e:	bf 11 00 00 00       	mov    $0x11,%edi
+  802363:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80236a:	00 00 00 
+  80236d:	ff d0                	call   *%rax
+  80236f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802373:	c9                   	leave
+  802374:	c3                   	ret
+
+0000000000802375 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802375:	55                   	push   %rbp
+  802376:	48 89 e5             	mov    %rsp,%rbp
+  802379:	48 83 ec 10          	sub    $0x10,%rsp
+  80237d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802381:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802385:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802389:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80238d:	48 83 ec 08          	sub    $0x8,%rsp
+  802391:	6a 00                	push   $0x0
+  802393:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802399:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80239f:	48 89 d1             	mov    %rdx,%rcx
+  8023a2:	48 89 c2             	mov    %rax,%rdx
+  8023a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023aa:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023af:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8023b6:	00 00 00 
+  8023b9:	ff d0                	call   *%rax
+  8023bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+00000000008023c1 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8023c1:	55                   	push   %rbp
+  8023c2:	48 89 e5             	mov    %rsp,%rbp
+  8023c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8023c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023cd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023d1:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8023d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023d7:	48 63 c8             	movslq %eax,%rcx
+  8023da:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e6:	6a 00                	push   $0x0
+  8023e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ee:	49 89 c8             	mov    %rcx,%r8
+  8023f1:	48 89 d1             	mov    %rdx,%rcx
+  8023f4:	48 89 c2             	mov    %rax,%rdx
+  8023f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fc:	bf 13 00 00 00       	mov    $0x13,%edi
+  802401:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+  80240d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802411:	c9                   	leave
+  802412:	c3                   	ret
+
+0000000000802413 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802413:	55                   	push   %rbp
+  802414:	48 89 e5             	mov    %rsp,%rbp
+  802417:	48 83 ec 20          	sub    $0x20,%rsp
+  80241b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80241f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802422:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802426:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80242a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80242d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802431:	48 83 ec 08          	sub    $0x8,%rsp
+  802435:	6a 00                	push   $0x0
+  802437:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80243d:	49 89 c8             	mov    %rcx,%r8
+  802440:	48 89 d1             	mov    %rdx,%rcx
+  802443:	48 89 c2             	mov    %rax,%rdx
+  802446:	be 00 00 00 00       	mov    $0x0,%esi
+  80244b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802450:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+  80245c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802460:	c9                   	leave
+  802461:	c3                   	ret
+
+0000000000802462 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802462:	55                   	push   %rbp
+  802463:	48 89 e5             	mov    %rsp,%rbp
+  802466:	48 83 ec 10          	sub    $0x10,%rsp
+  80246a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80246e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802471:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802474:	48 63 d0             	movslq %eax,%rdx
+  802477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247b:	48 83 ec 08          	sub    $0x8,%rsp
+  80247f:	6a 00                	push   $0x0
+  802481:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802487:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80248d:	48 89 d1             	mov    %rdx,%rcx
+  802490:	48 89 c2             	mov    %rax,%rdx
+  802493:	be 00 00 00 00       	mov    $0x0,%esi
+  802498:	bf 15 00 00 00       	mov    $0x15,%edi
+  80249d:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+00000000008024af <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8024af:	55                   	push   %rbp
+  8024b0:	48 89 e5             	mov    %rsp,%rbp
+  8024b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8024b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024bb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024be:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8024c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8024c5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024c9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8024cc:	48 63 c8             	movslq %eax,%rcx
+  8024cf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024d2:	48 63 d0             	movslq %eax,%rdx
+  8024d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024dd:	6a 00                	push   $0x0
+  8024df:	49 89 f1             	mov    %rsi,%r9
+  8024e2:	49 89 c8             	mov    %rcx,%r8
+  8024e5:	48 89 d1             	mov    %rdx,%rcx
+  8024e8:	48 89 c2             	mov    %rax,%rdx
+  8024eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f0:	bf 16 00 00 00       	mov    $0x16,%edi
+  8024f5:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802505:	c9                   	leave
+  802506:	c3                   	ret
+
+0000000000802507 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802507:	55                   	push   %rbp
+  802508:	48 89 e5             	mov    %rsp,%rbp
+  80250b:	48 83 ec 30          	sub    $0x30,%rsp
+  80250f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802513:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802517:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80251b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80251f:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802523:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802527:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80252b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80252f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802533:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802537:	48 83 ec 08          	sub    $0x8,%rsp
+  80253b:	51                   	push   %rcx
+  80253c:	49 89 f9             	mov    %rdi,%r9
+  80253f:	49 89 f0             	mov    %rsi,%r8
+  802542:	48 89 d1             	mov    %rdx,%rcx
+  802545:	48 89 c2             	mov    %rax,%rdx
+  802548:	be 00 00 00 00       	mov    $0x0,%esi
+  80254d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802552:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+  80255e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802562:	c9                   	leave
+  802563:	c3                   	ret
+
+0000000000802564 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802564:	55                   	push   %rbp
+  802565:	48 89 e5             	mov    %rsp,%rbp
+  802568:	48 83 ec 10          	sub    $0x10,%rsp
+  80256c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80256f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802572:	48 98                	cltq
+  802574:	48 83 ec 08          	sub    $0x8,%rsp
+  802578:	6a 00                	push   $0x0
+  80257a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802586:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258b:	48 89 c2             	mov    %rax,%rdx
+  80258e:	be 00 00 00 00       	mov    $0x0,%esi
+  802593:	bf 18 00 00 00       	mov    $0x18,%edi
+  802598:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a8:	90                   	nop
+  8025a9:	c9                   	leave
+  8025aa:	c3                   	ret
+
+00000000008025ab <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+  8025af:	48 83 ec 30          	sub    $0x30,%rsp
+  8025b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025ba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025be:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8025c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025c4:	48 63 f0             	movslq %eax,%rsi
+  8025c7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025d2:	48 98                	cltq
+  8025d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d8:	6a 00                	push   $0x0
+  8025da:	49 89 f1             	mov    %rsi,%r9
+  8025dd:	49 89 c8             	mov    %rcx,%r8
+  8025e0:	48 89 d1             	mov    %rdx,%rcx
+  8025e3:	48 89 c2             	mov    %rax,%rdx
+  8025e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8025eb:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025f0:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8025f7:	00 00 00 
+  8025fa:	ff d0                	call   *%rax
+  8025fc:	48 83 c4 10          	add    $0x10,%rsp
+  802600:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802603:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+0000000000802608 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	48 83 ec 20          	sub    $0x20,%rsp
+  802610:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802614:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802618:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80261b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80261e:	48 63 c8             	movslq %eax,%rcx
+  802621:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802629:	48 83 ec 08          	sub    $0x8,%rsp
+  80262d:	6a 00                	push   $0x0
+  80262f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802635:	49 89 c8             	mov    %rcx,%r8
+  802638:	48 89 d1             	mov    %rdx,%rcx
+  80263b:	48 89 c2             	mov    %rax,%rdx
+  80263e:	be 01 00 00 00       	mov    $0x1,%esi
+  802643:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802648:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+000000000080265a <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80265a:	55                   	push   %rbp
+  80265b:	48 89 e5             	mov    %rsp,%rbp
+  80265e:	48 83 ec 20          	sub    $0x20,%rsp
+  802662:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802666:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80266a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  80266e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802672:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267a:	48 83 ec 08          	sub    $0x8,%rsp
+  80267e:	6a 00                	push   $0x0
+  802680:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802686:	49 89 c8             	mov    %rcx,%r8
+  802689:	48 89 d1             	mov    %rdx,%rcx
+  80268c:	48 89 c2             	mov    %rax,%rdx
+  80268f:	be 01 00 00 00       	mov    $0x1,%esi
+  802694:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802699:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+
+00000000008026ab <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8026ab:	55                   	push   %rbp
+  8026ac:	48 89 e5             	mov    %rsp,%rbp
+  8026af:	48 83 ec 30          	sub    $0x30,%rsp
+  8026b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8026b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026bb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8026be:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8026c2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026c9:	48 63 c8             	movslq %eax,%rcx
+  8026cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d8:	6a 00                	push   $0x0
+  8026da:	49 89 f1             	mov    %rsi,%r9
+  8026dd:	49 89 c8             	mov    %rcx,%r8
+  8026e0:	48 89 d1             	mov    %rdx,%rcx
+  8026e3:	48 89 c2             	mov    %rax,%rdx
+  8026e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8026eb:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8026f0:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  8026f7:	00 00 00 
+  8026fa:	ff d0                	call   *%rax
+  8026fc:	48 83 c4 10          	add    $0x10,%rsp
+  802700:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802703:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802706:	c9                   	leave
+  802707:	c3                   	ret
+
+0000000000802708 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+  80270c:	48 83 ec 10          	sub    $0x10,%rsp
+  802710:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802713:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802716:	48 98                	cltq
+  802718:	48 83 ec 08          	sub    $0x8,%rsp
+  80271c:	6a 00                	push   $0x0
+  80271e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802724:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80272a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80272f:	48 89 c2             	mov    %rax,%rdx
+  802732:	be 01 00 00 00       	mov    $0x1,%esi
+  802737:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80273c:	48 b8 b7 1d 80 00 00 	movabs $0x801db7,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+000000000080274e <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	48 83 ec 40          	sub    $0x40,%rsp
+  802756:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  80275a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80275e:	48 8b 00             	mov    (%rax),%rax
+  802761:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802765:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802769:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80276d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802771:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802775:	83 e0 02             	and    $0x2,%eax
+  802778:	48 85 c0             	test   %rax,%rax
+  80277b:	74 25                	je     8027a2 <pgfault+0x54>
+  80277d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802781:	48 c1 e8 0c          	shr    $0xc,%rax
+  802785:	48 89 c2             	mov    %rax,%rdx
+  802788:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80278f:	01 00 00 
+  802792:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802796:	83 e0 02             	and    $0x2,%eax
+  802799:	48 85 c0             	test   %rax,%rax
+  80279c:	0f 85 fe 01 00 00    	jne    8029a0 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8027a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a6:	83 e0 02             	and    $0x2,%eax
+  8027a9:	48 85 c0             	test   %rax,%rax
+  8027ac:	74 23                	je     8027d1 <pgfault+0x83>
+  8027ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027b2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027b6:	48 89 c2             	mov    %rax,%rdx
+  8027b9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027c0:	01 00 00 
+  8027c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027c7:	25 00 08 00 00       	and    $0x800,%eax
+  8027cc:	48 85 c0             	test   %rax,%rax
+  8027cf:	75 3f                	jne    802810 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8027d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027d9:	49 89 d0             	mov    %rdx,%r8
+  8027dc:	48 89 c1             	mov    %rax,%rcx
+  8027df:	48 b8 78 69 80 00 00 	movabs $0x806978,%rax
+  8027e6:	00 00 00 
+  8027e9:	48 89 c2             	mov    %rax,%rdx
+  8027ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8027f1:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  8027f8:	00 00 00 
+  8027fb:	48 89 c7             	mov    %rax,%rdi
+  8027fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802803:	49 b9 b1 5a 80 00 00 	movabs $0x805ab1,%r9
+  80280a:	00 00 00 
+  80280d:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802810:	48 b8 ff 55 80 00 00 	movabs $0x8055ff,%rax
+  802817:	00 00 00 
+  80281a:	ff d0                	call   *%rax
+  80281c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802824:	ba 07 00 00 00       	mov    $0x7,%edx
+  802829:	48 89 c6             	mov    %rax,%rsi
+  80282c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802831:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802840:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802844:	79 36                	jns    80287c <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802846:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802849:	89 c1                	mov    %eax,%ecx
+  80284b:	48 b8 b8 69 80 00 00 	movabs $0x8069b8,%rax
+  802852:	00 00 00 
+  802855:	48 89 c2             	mov    %rax,%rdx
+  802858:	be 35 00 00 00       	mov    $0x35,%esi
+  80285d:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802864:	00 00 00 
+  802867:	48 89 c7             	mov    %rax,%rdi
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286f:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802876:	00 00 00 
+  802879:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  80287c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802880:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802884:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802888:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80288e:	48 89 c1             	mov    %rax,%rcx
+  802891:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802895:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80289a:	48 89 ce             	mov    %rcx,%rsi
+  80289d:	48 89 c7             	mov    %rax,%rdi
+  8028a0:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8028ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028b4:	48 89 c2             	mov    %rax,%rdx
+  8028b7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028be:	01 00 00 
+  8028c1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028c5:	25 00 08 00 00       	and    $0x800,%eax
+  8028ca:	48 85 c0             	test   %rax,%rax
+  8028cd:	74 7a                	je     802949 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8028cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028d3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8028d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028db:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8028e1:	48 89 c2             	mov    %rax,%rdx
+  8028e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028e8:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8028ee:	48 89 d1             	mov    %rdx,%rcx
+  8028f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f6:	48 89 c6             	mov    %rax,%rsi
+  8028f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fe:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  80290d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802911:	79 36                	jns    802949 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802913:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802916:	89 c1                	mov    %eax,%ecx
+  802918:	48 b8 e0 69 80 00 00 	movabs $0x8069e0,%rax
+  80291f:	00 00 00 
+  802922:	48 89 c2             	mov    %rax,%rdx
+  802925:	be 42 00 00 00       	mov    $0x42,%esi
+  80292a:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802931:	00 00 00 
+  802934:	48 89 c7             	mov    %rax,%rdi
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802943:	00 00 00 
+  802946:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802949:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80294d:	48 89 c6             	mov    %rax,%rsi
+  802950:	bf 00 00 00 00       	mov    $0x0,%edi
+  802955:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+  802961:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802964:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802968:	79 37                	jns    8029a1 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  80296a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80296d:	89 c1                	mov    %eax,%ecx
+  80296f:	48 b8 08 6a 80 00 00 	movabs $0x806a08,%rax
+  802976:	00 00 00 
+  802979:	48 89 c2             	mov    %rax,%rdx
+  80297c:	be 46 00 00 00       	mov    $0x46,%esi
+  802981:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802988:	00 00 00 
+  80298b:	48 89 c7             	mov    %rax,%rdi
+  80298e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802993:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  80299a:	00 00 00 
+  80299d:	41 ff d0             	call   *%r8
+    return;
+  8029a0:	90                   	nop
+  }
+}
+  8029a1:	c9                   	leave
+  8029a2:	c3                   	ret
+
+00000000008029a3 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  8029a3:	55                   	push   %rbp
+  8029a4:	48 89 e5             	mov    %rsp,%rbp
+  8029a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8029ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8029ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  8029b2:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8029b9:	01 00 00 
+  8029bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8029c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  8029cd:	48 b8 ee 1f 80 00 00 	movabs $0x801fee,%rax
+  8029d4:	00 00 00 
+  8029d7:	ff d0                	call   *%rax
+  8029d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  8029dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  8029e8:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8029ef:	01 00 00 
+  8029f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029fa:	25 00 04 00 00       	and    $0x400,%eax
+  8029ff:	48 85 c0             	test   %rax,%rax
+  802a02:	74 7b                	je     802a7f <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802a04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a08:	89 c1                	mov    %eax,%ecx
+  802a0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a0e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a12:	48 89 c2             	mov    %rax,%rdx
+  802a15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a19:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a1d:	48 89 c6             	mov    %rax,%rsi
+  802a20:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a23:	41 89 c8             	mov    %ecx,%r8d
+  802a26:	48 89 d1             	mov    %rdx,%rcx
+  802a29:	89 c2                	mov    %eax,%edx
+  802a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a30:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a43:	0f 89 da 00 00 00    	jns    802b23 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802a49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a4c:	89 c1                	mov    %eax,%ecx
+  802a4e:	48 b8 30 6a 80 00 00 	movabs $0x806a30,%rax
+  802a55:	00 00 00 
+  802a58:	48 89 c2             	mov    %rax,%rdx
+  802a5b:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802a60:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802a67:	00 00 00 
+  802a6a:	48 89 c7             	mov    %rax,%rdi
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a72:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802a79:	00 00 00 
+  802a7c:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a83:	25 02 08 00 00       	and    $0x802,%eax
+  802a88:	48 85 c0             	test   %rax,%rax
+  802a8b:	74 6e                	je     802afb <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a91:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802a97:	80 cc 08             	or     $0x8,%ah
+  802a9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aa2:	89 c7                	mov    %eax,%edi
+  802aa4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802aa8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802aab:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802aaf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ab2:	41 89 f8             	mov    %edi,%r8d
+  802ab5:	89 c7                	mov    %eax,%edi
+  802ab7:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+  802ac3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802ac6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802aca:	79 05                	jns    802ad1 <duppage+0x12e>
+      return r;
+  802acc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802acf:	eb 55                	jmp    802b26 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802ad1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ad5:	89 c7                	mov    %eax,%edi
+  802ad7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802adb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ade:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ae2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ae5:	41 89 f8             	mov    %edi,%r8d
+  802ae8:	89 c7                	mov    %eax,%edi
+  802aea:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  802af6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802af9:	eb 28                	jmp    802b23 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802afb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aff:	89 c7                	mov    %eax,%edi
+  802b01:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b05:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802b08:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802b0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b0f:	41 89 f8             	mov    %edi,%r8d
+  802b12:	89 c7                	mov    %eax,%edi
+  802b14:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+  802b20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802b23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b26:	c9                   	leave
+  802b27:	c3                   	ret
+
+0000000000802b28 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802b28:	55                   	push   %rbp
+  802b29:	48 89 e5             	mov    %rsp,%rbp
+  802b2c:	48 83 ec 20          	sub    $0x20,%rsp
+  802b30:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b33:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802b37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b3b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802b43:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b4a:	01 00 00 
+  802b4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b51:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b55:	25 00 08 00 00       	and    $0x800,%eax
+  802b5a:	48 85 c0             	test   %rax,%rax
+  802b5d:	74 0d                	je     802b6c <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802b5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b63:	0f b6 10             	movzbl (%rax),%edx
+  802b66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b6a:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802b6c:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b73:	01 00 00 
+  802b76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b7a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b7e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b83:	89 c6                	mov    %eax,%esi
+  802b85:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802b89:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802b8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b90:	41 89 f0             	mov    %esi,%r8d
+  802b93:	48 89 c6             	mov    %rax,%rsi
+  802b96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9b:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  802ba2:	00 00 00 
+  802ba5:	ff d0                	call   *%rax
+}
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+
+0000000000802ba9 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802ba9:	55                   	push   %rbp
+  802baa:	48 89 e5             	mov    %rsp,%rbp
+  802bad:	48 83 ec 40          	sub    $0x40,%rsp
+  802bb1:	89 f8                	mov    %edi,%eax
+  802bb3:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802bb6:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  802bbd:	00 00 00 
+  802bc0:	48 89 c7             	mov    %rax,%rdi
+  802bc3:	48 b8 cb 5b 80 00 00 	movabs $0x805bcb,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802bcf:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bd4:	cd 30                	int    $0x30
+  802bd6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802bd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802bdc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bdf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802be3:	79 36                	jns    802c1b <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802be5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802be8:	89 c1                	mov    %eax,%ecx
+  802bea:	48 b8 5b 6a 80 00 00 	movabs $0x806a5b,%rax
+  802bf1:	00 00 00 
+  802bf4:	48 89 c2             	mov    %rax,%rdx
+  802bf7:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802bfc:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802c03:	00 00 00 
+  802c06:	48 89 c7             	mov    %rax,%rdi
+  802c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0e:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802c15:	00 00 00 
+  802c18:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802c1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c1f:	75 0a                	jne    802c2b <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c26:	e9 d3 02 00 00       	jmp    802efe <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802c2b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c32:	00 
+  802c33:	e9 7a 01 00 00       	jmp    802db2 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802c38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c3c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c40:	48 c1 e8 27          	shr    $0x27,%rax
+  802c44:	48 89 c2             	mov    %rax,%rdx
+  802c47:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c4e:	01 00 00 
+  802c51:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c55:	83 e0 01             	and    $0x1,%eax
+  802c58:	48 85 c0             	test   %rax,%rax
+  802c5b:	0f 84 4c 01 00 00    	je     802dad <fork_common+0x204>
+  802c61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c65:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c69:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c6d:	48 89 c2             	mov    %rax,%rdx
+  802c70:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c77:	01 00 00 
+  802c7a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c7e:	83 e0 01             	and    $0x1,%eax
+  802c81:	48 85 c0             	test   %rax,%rax
+  802c84:	0f 84 23 01 00 00    	je     802dad <fork_common+0x204>
+  802c8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c8e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c92:	48 c1 e8 15          	shr    $0x15,%rax
+  802c96:	48 89 c2             	mov    %rax,%rdx
+  802c99:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ca0:	01 00 00 
+  802ca3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ca7:	83 e0 01             	and    $0x1,%eax
+  802caa:	48 85 c0             	test   %rax,%rax
+  802cad:	0f 84 fa 00 00 00    	je     802dad <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802cb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb7:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cbb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802cbf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cc3:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802cca:	00 00 00 
+  802ccd:	48 39 c2             	cmp    %rax,%rdx
+  802cd0:	0f 82 d7 00 00 00    	jb     802dad <fork_common+0x204>
+  802cd6:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802cdd:	00 00 00 
+  802ce0:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802ce4:	0f 84 c3 00 00 00    	je     802dad <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802cea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cee:	48 89 c7             	mov    %rax,%rdi
+  802cf1:	48 b8 bb 55 80 00 00 	movabs $0x8055bb,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+  802cfd:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802d00:	84 c0                	test   %al,%al
+  802d02:	0f 84 a5 00 00 00    	je     802dad <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802d08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d0c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d10:	48 89 c2             	mov    %rax,%rdx
+  802d13:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d1a:	01 00 00 
+  802d1d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d21:	83 e0 01             	and    $0x1,%eax
+  802d24:	48 85 c0             	test   %rax,%rax
+  802d27:	0f 84 80 00 00 00    	je     802dad <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802d2d:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802d31:	74 4a                	je     802d7d <fork_common+0x1d4>
+  802d33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d37:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802d3e:	00 00 00 
+  802d41:	48 39 c2             	cmp    %rax,%rdx
+  802d44:	73 13                	jae    802d59 <fork_common+0x1b0>
+  802d46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d4a:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802d51:	00 00 00 
+  802d54:	48 39 c2             	cmp    %rax,%rdx
+  802d57:	73 24                	jae    802d7d <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802d59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d5d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d61:	48 89 c2             	mov    %rax,%rdx
+  802d64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d67:	48 89 d6             	mov    %rdx,%rsi
+  802d6a:	89 c7                	mov    %eax,%edi
+  802d6c:	48 b8 28 2b 80 00 00 	movabs $0x802b28,%rax
+  802d73:	00 00 00 
+  802d76:	ff d0                	call   *%rax
+  802d78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d7b:	eb 22                	jmp    802d9f <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802d7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d81:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d85:	48 89 c2             	mov    %rax,%rdx
+  802d88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d8b:	48 89 d6             	mov    %rdx,%rsi
+  802d8e:	89 c7                	mov    %eax,%edi
+  802d90:	48 b8 a3 29 80 00 00 	movabs $0x8029a3,%rax
+  802d97:	00 00 00 
+  802d9a:	ff d0                	call   *%rax
+  802d9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802d9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802da3:	79 08                	jns    802dad <fork_common+0x204>
+            return r;
+  802da5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802da8:	e9 51 01 00 00       	jmp    802efe <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802dad:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802db2:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802db9:	07 
+  802dba:	0f 86 78 fe ff ff    	jbe    802c38 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802dc0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802dc7:	00 00 00 
+  802dca:	8b 40 04             	mov    0x4(%rax),%eax
+  802dcd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802dd2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802dd9:	00 00 00 
+  802ddc:	48 98                	cltq
+  802dde:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802de5:	48 01 d0             	add    %rdx,%rax
+  802de8:	48 05 00 01 00 00    	add    $0x100,%rax
+  802dee:	48 8b 10             	mov    (%rax),%rdx
+  802df1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802df4:	48 89 d6             	mov    %rdx,%rsi
+  802df7:	89 c7                	mov    %eax,%edi
+  802df9:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  802e00:	00 00 00 
+  802e03:	ff d0                	call   *%rax
+  802e05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e0c:	79 36                	jns    802e44 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802e0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e11:	89 c1                	mov    %eax,%ecx
+  802e13:	48 b8 70 6a 80 00 00 	movabs $0x806a70,%rax
+  802e1a:	00 00 00 
+  802e1d:	48 89 c2             	mov    %rax,%rdx
+  802e20:	be be 00 00 00       	mov    $0xbe,%esi
+  802e25:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802e2c:	00 00 00 
+  802e2f:	48 89 c7             	mov    %rax,%rdi
+  802e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e37:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802e3e:	00 00 00 
+  802e41:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802e44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e47:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e4c:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802e53:	00 00 00 
+  802e56:	48 89 ce             	mov    %rcx,%rsi
+  802e59:	89 c7                	mov    %eax,%edi
+  802e5b:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e6a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e6e:	79 36                	jns    802ea6 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  802e70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e73:	89 c1                	mov    %eax,%ecx
+  802e75:	48 b8 a0 6a 80 00 00 	movabs $0x806aa0,%rax
+  802e7c:	00 00 00 
+  802e7f:	48 89 c2             	mov    %rax,%rdx
+  802e82:	be c1 00 00 00       	mov    $0xc1,%esi
+  802e87:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802e8e:	00 00 00 
+  802e91:	48 89 c7             	mov    %rax,%rdi
+  802e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e99:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802ea0:	00 00 00 
+  802ea3:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  802ea6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ea9:	be 02 00 00 00       	mov    $0x2,%esi
+  802eae:	89 c7                	mov    %eax,%edi
+  802eb0:	48 b8 6b 21 80 00 00 	movabs $0x80216b,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ebf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ec3:	79 36                	jns    802efb <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  802ec5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ec8:	89 c1                	mov    %eax,%ecx
+  802eca:	48 b8 c0 6a 80 00 00 	movabs $0x806ac0,%rax
+  802ed1:	00 00 00 
+  802ed4:	48 89 c2             	mov    %rax,%rdx
+  802ed7:	be d4 00 00 00       	mov    $0xd4,%esi
+  802edc:	48 b8 a6 69 80 00 00 	movabs $0x8069a6,%rax
+  802ee3:	00 00 00 
+  802ee6:	48 89 c7             	mov    %rax,%rdi
+  802ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eee:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  802ef5:	00 00 00 
+  802ef8:	41 ff d0             	call   *%r8
+    }
+    return e;
+  802efb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+
+0000000000802f00 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  802f00:	55                   	push   %rbp
+  802f01:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  802f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f09:	48 b8 a9 2b 80 00 00 	movabs $0x802ba9,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+}
+  802f15:	5d                   	pop    %rbp
+  802f16:	c3                   	ret
+
+0000000000802f17 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  802f17:	55                   	push   %rbp
+  802f18:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  802f1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f20:	48 b8 a9 2b 80 00 00 	movabs $0x802ba9,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+}
+  802f2c:	5d                   	pop    %rbp
+  802f2d:	c3                   	ret
+
+0000000000802f2e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	48 83 ec 20          	sub    $0x20,%rsp
+  802f36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f3e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  802f42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f46:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  802f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f4e:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  802f55:	48 89 c7             	mov    %rax,%rdi
+  802f58:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  802f5f:	00 00 00 
+  802f62:	ff d0                	call   *%rax
+}
+  802f64:	c9                   	leave
+  802f65:	c3                   	ret
+
+0000000000802f66 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  802f66:	55                   	push   %rbp
+  802f67:	48 89 e5             	mov    %rsp,%rbp
+  802f6a:	48 83 ec 30          	sub    $0x30,%rsp
+  802f6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f72:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802f76:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802f7a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  802f7e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802f83:	75 0e                	jne    802f93 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  802f85:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f8c:	00 00 00 
+  802f8f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  802f93:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  802f98:	75 18                	jne    802fb2 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  802f9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f9e:	48 89 c7             	mov    %rax,%rdi
+  802fa1:	48 b8 a7 22 80 00 00 	movabs $0x8022a7,%rax
+  802fa8:	00 00 00 
+  802fab:	ff d0                	call   *%rax
+  802fad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb0:	eb 1d                	jmp    802fcf <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  802fb2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fba:	48 89 d6             	mov    %rdx,%rsi
+  802fbd:	48 89 c7             	mov    %rax,%rdi
+  802fc0:	48 b8 ed 22 80 00 00 	movabs $0x8022ed,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+  802fcc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  802fcf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fd3:	79 2a                	jns    802fff <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  802fd5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802fda:	74 0a                	je     802fe6 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  802fdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fe0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  802fe6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802feb:	74 0a                	je     802ff7 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  802fed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ff1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  802ff7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ffa:	e9 aa 00 00 00       	jmp    8030a9 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  802fff:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803004:	74 36                	je     80303c <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  803006:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80300d:	00 00 00 
+  803010:	8b 40 04             	mov    0x4(%rax),%eax
+  803013:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803018:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80301f:	00 00 00 
+  803022:	48 98                	cltq
+  803024:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80302b:	48 01 d0             	add    %rdx,%rax
+  80302e:	48 05 24 01 00 00    	add    $0x124,%rax
+  803034:	8b 10                	mov    (%rax),%edx
+  803036:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303a:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80303c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803041:	74 36                	je     803079 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  803043:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80304a:	00 00 00 
+  80304d:	8b 40 04             	mov    0x4(%rax),%eax
+  803050:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803055:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80305c:	00 00 00 
+  80305f:	48 98                	cltq
+  803061:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803068:	48 01 d0             	add    %rdx,%rax
+  80306b:	48 05 28 01 00 00    	add    $0x128,%rax
+  803071:	8b 10                	mov    (%rax),%edx
+  803073:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803077:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  803079:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803080:	00 00 00 
+  803083:	8b 40 04             	mov    0x4(%rax),%eax
+  803086:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80308b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803092:	00 00 00 
+  803095:	48 98                	cltq
+  803097:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80309e:	48 01 d0             	add    %rdx,%rax
+  8030a1:	48 05 20 01 00 00    	add    $0x120,%rax
+  8030a7:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8030a9:	c9                   	leave
+  8030aa:	c3                   	ret
+
+00000000008030ab <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8030ab:	55                   	push   %rbp
+  8030ac:	48 89 e5             	mov    %rsp,%rbp
+  8030af:	48 83 ec 30          	sub    $0x30,%rsp
+  8030b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8030b6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8030b9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8030bd:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8030c0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8030c5:	75 5e                	jne    803125 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8030c7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8030ce:	00 00 00 
+  8030d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8030d5:	eb 4e                	jmp    803125 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8030d7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030db:	79 3c                	jns    803119 <ipc_send+0x6e>
+  8030dd:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8030e1:	74 36                	je     803119 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8030e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030e6:	89 c1                	mov    %eax,%ecx
+  8030e8:	48 b8 e8 6a 80 00 00 	movabs $0x806ae8,%rax
+  8030ef:	00 00 00 
+  8030f2:	48 89 c2             	mov    %rax,%rdx
+  8030f5:	be 54 00 00 00       	mov    $0x54,%esi
+  8030fa:	48 b8 0e 6b 80 00 00 	movabs $0x806b0e,%rax
+  803101:	00 00 00 
+  803104:	48 89 c7             	mov    %rax,%rdi
+  803107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310c:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  803113:	00 00 00 
+  803116:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  803119:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803125:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803128:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80312b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80312f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803132:	89 c7                	mov    %eax,%edi
+  803134:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  80313b:	00 00 00 
+  80313e:	ff d0                	call   *%rax
+  803140:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803143:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803147:	75 8e                	jne    8030d7 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  803149:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  803150:	00 00 00 
+  803153:	ff d0                	call   *%rax
+}
+  803155:	90                   	nop
+  803156:	c9                   	leave
+  803157:	c3                   	ret
+
+0000000000803158 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  803158:	55                   	push   %rbp
+  803159:	48 89 e5             	mov    %rsp,%rbp
+  80315c:	48 83 ec 18          	sub    $0x18,%rsp
+  803160:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  803163:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80316a:	eb 4d                	jmp    8031b9 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80316c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803173:	00 00 00 
+  803176:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803179:	48 98                	cltq
+  80317b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803182:	48 01 d0             	add    %rdx,%rax
+  803185:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  80318b:	8b 00                	mov    (%rax),%eax
+  80318d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803190:	75 23                	jne    8031b5 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  803192:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803199:	00 00 00 
+  80319c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80319f:	48 98                	cltq
+  8031a1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031a8:	48 01 d0             	add    %rdx,%rax
+  8031ab:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8031b1:	8b 00                	mov    (%rax),%eax
+  8031b3:	eb 12                	jmp    8031c7 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8031b5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8031b9:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8031c0:	7e aa                	jle    80316c <ipc_find_env+0x14>
+  return 0;
+  8031c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031c7:	c9                   	leave
+  8031c8:	c3                   	ret
+
+00000000008031c9 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8031c9:	55                   	push   %rbp
+  8031ca:	48 89 e5             	mov    %rsp,%rbp
+  8031cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8031d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8031d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031d9:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8031e0:	ff ff ff 
+  8031e3:	48 01 d0             	add    %rdx,%rax
+  8031e6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8031ea:	c9                   	leave
+  8031eb:	c3                   	ret
+
+00000000008031ec <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8031ec:	55                   	push   %rbp
+  8031ed:	48 89 e5             	mov    %rsp,%rbp
+  8031f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8031f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031fc:	48 89 c7             	mov    %rax,%rdi
+  8031ff:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  803206:	00 00 00 
+  803209:	ff d0                	call   *%rax
+  80320b:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803211:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803215:	c9                   	leave
+  803216:	c3                   	ret
+
+0000000000803217 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803217:	55                   	push   %rbp
+  803218:	48 89 e5             	mov    %rsp,%rbp
+  80321b:	48 83 ec 18          	sub    $0x18,%rsp
+  80321f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803223:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80322a:	e9 ae 00 00 00       	jmp    8032dd <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80322f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803232:	c1 e0 0c             	shl    $0xc,%eax
+  803235:	48 98                	cltq
+  803237:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80323c:	48 01 d0             	add    %rdx,%rax
+  80323f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803243:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803247:	48 c1 e8 27          	shr    $0x27,%rax
+  80324b:	48 89 c2             	mov    %rax,%rdx
+  80324e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803255:	01 00 00 
+  803258:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80325c:	83 e0 01             	and    $0x1,%eax
+  80325f:	48 85 c0             	test   %rax,%rax
+  803262:	74 63                	je     8032c7 <fd_alloc+0xb0>
+  803264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803268:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80326c:	48 89 c2             	mov    %rax,%rdx
+  80326f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803276:	01 00 00 
+  803279:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80327d:	83 e0 01             	and    $0x1,%eax
+  803280:	48 85 c0             	test   %rax,%rax
+  803283:	74 42                	je     8032c7 <fd_alloc+0xb0>
+  803285:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803289:	48 c1 e8 15          	shr    $0x15,%rax
+  80328d:	48 89 c2             	mov    %rax,%rdx
+  803290:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803297:	01 00 00 
+  80329a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80329e:	83 e0 01             	and    $0x1,%eax
+  8032a1:	48 85 c0             	test   %rax,%rax
+  8032a4:	74 21                	je     8032c7 <fd_alloc+0xb0>
+  8032a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032aa:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032ae:	48 89 c2             	mov    %rax,%rdx
+  8032b1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032b8:	01 00 00 
+  8032bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032bf:	83 e0 01             	and    $0x1,%eax
+  8032c2:	48 85 c0             	test   %rax,%rax
+  8032c5:	75 12                	jne    8032d9 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8032c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032cb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032cf:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8032d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d7:	eb 1e                	jmp    8032f7 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8032d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032dd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8032e1:	0f 8e 48 ff ff ff    	jle    80322f <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8032e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032eb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8032f2:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8032f7:	c9                   	leave
+  8032f8:	c3                   	ret
+
+00000000008032f9 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8032f9:	55                   	push   %rbp
+  8032fa:	48 89 e5             	mov    %rsp,%rbp
+  8032fd:	48 83 ec 20          	sub    $0x20,%rsp
+  803301:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803304:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803308:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80330c:	78 06                	js     803314 <fd_lookup+0x1b>
+  80330e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803312:	7e 0a                	jle    80331e <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803314:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803319:	e9 af 00 00 00       	jmp    8033cd <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80331e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803321:	c1 e0 0c             	shl    $0xc,%eax
+  803324:	48 98                	cltq
+  803326:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80332b:	48 01 d0             	add    %rdx,%rax
+  80332e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803336:	48 c1 e8 27          	shr    $0x27,%rax
+  80333a:	48 89 c2             	mov    %rax,%rdx
+  80333d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803344:	01 00 00 
+  803347:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80334b:	83 e0 01             	and    $0x1,%eax
+  80334e:	48 85 c0             	test   %rax,%rax
+  803351:	74 63                	je     8033b6 <fd_lookup+0xbd>
+  803353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803357:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80335b:	48 89 c2             	mov    %rax,%rdx
+  80335e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803365:	01 00 00 
+  803368:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80336c:	83 e0 01             	and    $0x1,%eax
+  80336f:	48 85 c0             	test   %rax,%rax
+  803372:	74 42                	je     8033b6 <fd_lookup+0xbd>
+  803374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803378:	48 c1 e8 15          	shr    $0x15,%rax
+  80337c:	48 89 c2             	mov    %rax,%rdx
+  80337f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803386:	01 00 00 
+  803389:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80338d:	83 e0 01             	and    $0x1,%eax
+  803390:	48 85 c0             	test   %rax,%rax
+  803393:	74 21                	je     8033b6 <fd_lookup+0xbd>
+  803395:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803399:	48 c1 e8 0c          	shr    $0xc,%rax
+  80339d:	48 89 c2             	mov    %rax,%rdx
+  8033a0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033a7:	01 00 00 
+  8033aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ae:	83 e0 01             	and    $0x1,%eax
+  8033b1:	48 85 c0             	test   %rax,%rax
+  8033b4:	75 07                	jne    8033bd <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8033b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033bb:	eb 10                	jmp    8033cd <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8033bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c5:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8033c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033cd:	c9                   	leave
+  8033ce:	c3                   	ret
+
+00000000008033cf <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8033cf:	55                   	push   %rbp
+  8033d0:	48 89 e5             	mov    %rsp,%rbp
+  8033d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8033d7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8033db:	89 f0                	mov    %esi,%eax
+  8033dd:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8033e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033e4:	48 89 c7             	mov    %rax,%rdi
+  8033e7:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  8033ee:	00 00 00 
+  8033f1:	ff d0                	call   *%rax
+  8033f3:	89 c2                	mov    %eax,%edx
+  8033f5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8033f9:	48 89 c6             	mov    %rax,%rsi
+  8033fc:	89 d7                	mov    %edx,%edi
+  8033fe:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  803405:	00 00 00 
+  803408:	ff d0                	call   *%rax
+  80340a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80340d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803411:	78 0a                	js     80341d <fd_close+0x4e>
+  803413:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803417:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80341b:	74 12                	je     80342f <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80341d:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803421:	74 05                	je     803428 <fd_close+0x59>
+  803423:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803426:	eb 70                	jmp    803498 <fd_close+0xc9>
+  803428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342d:	eb 69                	jmp    803498 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80342f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803433:	8b 00                	mov    (%rax),%eax
+  803435:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803439:	48 89 d6             	mov    %rdx,%rsi
+  80343c:	89 c7                	mov    %eax,%edi
+  80343e:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803445:	00 00 00 
+  803448:	ff d0                	call   *%rax
+  80344a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80344d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803451:	78 2a                	js     80347d <fd_close+0xae>
+    if (dev->dev_close)
+  803453:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803457:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80345b:	48 85 c0             	test   %rax,%rax
+  80345e:	74 16                	je     803476 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803464:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803468:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80346c:	48 89 c7             	mov    %rax,%rdi
+  80346f:	ff d2                	call   *%rdx
+  803471:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803474:	eb 07                	jmp    80347d <fd_close+0xae>
+    else
+      r = 0;
+  803476:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80347d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803481:	48 89 c6             	mov    %rax,%rsi
+  803484:	bf 00 00 00 00       	mov    $0x0,%edi
+  803489:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+  return r;
+  803495:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803498:	c9                   	leave
+  803499:	c3                   	ret
+
+000000000080349a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80349a:	55                   	push   %rbp
+  80349b:	48 89 e5             	mov    %rsp,%rbp
+  80349e:	48 83 ec 20          	sub    $0x20,%rsp
+  8034a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8034a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8034b0:	eb 3f                	jmp    8034f1 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8034b2:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8034b9:	00 00 00 
+  8034bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034bf:	48 98                	cltq
+  8034c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034c5:	8b 00                	mov    (%rax),%eax
+  8034c7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8034ca:	75 21                	jne    8034ed <dev_lookup+0x53>
+      *dev = devtab[i];
+  8034cc:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8034d3:	00 00 00 
+  8034d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d9:	48 98                	cltq
+  8034db:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034e3:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8034e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034eb:	eb 7f                	jmp    80356c <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8034ed:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8034f1:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8034f8:	00 00 00 
+  8034fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034fe:	48 98                	cltq
+  803500:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803504:	48 85 c0             	test   %rax,%rax
+  803507:	75 a9                	jne    8034b2 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803509:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803510:	00 00 00 
+  803513:	8b 40 04             	mov    0x4(%rax),%eax
+  803516:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80351b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803522:	00 00 00 
+  803525:	48 98                	cltq
+  803527:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80352e:	48 01 d0             	add    %rdx,%rax
+  803531:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803537:	8b 00                	mov    (%rax),%eax
+  803539:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80353c:	89 c6                	mov    %eax,%esi
+  80353e:	48 b8 18 6b 80 00 00 	movabs $0x806b18,%rax
+  803545:	00 00 00 
+  803548:	48 89 c7             	mov    %rax,%rdi
+  80354b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803550:	48 b9 e9 02 80 00 00 	movabs $0x8002e9,%rcx
+  803557:	00 00 00 
+  80355a:	ff d1                	call   *%rcx
+  *dev = 0;
+  80355c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803560:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803567:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80356c:	c9                   	leave
+  80356d:	c3                   	ret
+
+000000000080356e <close>:
+
+int
+close(int fdnum) {
+  80356e:	55                   	push   %rbp
+  80356f:	48 89 e5             	mov    %rsp,%rbp
+  803572:	48 83 ec 20          	sub    $0x20,%rsp
+  803576:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803579:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80357d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803580:	48 89 d6             	mov    %rdx,%rsi
+  803583:	89 c7                	mov    %eax,%edi
+  803585:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  80358c:	00 00 00 
+  80358f:	ff d0                	call   *%rax
+  803591:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803594:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803598:	79 05                	jns    80359f <close+0x31>
+    return r;
+  80359a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80359d:	eb 18                	jmp    8035b7 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80359f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8035a8:	48 89 c7             	mov    %rax,%rdi
+  8035ab:	48 b8 cf 33 80 00 00 	movabs $0x8033cf,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+}
+  8035b7:	c9                   	leave
+  8035b8:	c3                   	ret
+
+00000000008035b9 <close_all>:
+
+void
+close_all(void) {
+  8035b9:	55                   	push   %rbp
+  8035ba:	48 89 e5             	mov    %rsp,%rbp
+  8035bd:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8035c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035c8:	eb 15                	jmp    8035df <close_all+0x26>
+    close(i);
+  8035ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035cd:	89 c7                	mov    %eax,%edi
+  8035cf:	48 b8 6e 35 80 00 00 	movabs $0x80356e,%rax
+  8035d6:	00 00 00 
+  8035d9:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8035db:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035df:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8035e3:	7e e5                	jle    8035ca <close_all+0x11>
+}
+  8035e5:	90                   	nop
+  8035e6:	90                   	nop
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+
+00000000008035e9 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	48 83 ec 40          	sub    $0x40,%rsp
+  8035f1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035f4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8035f7:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8035fb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8035fe:	48 89 d6             	mov    %rdx,%rsi
+  803601:	89 c7                	mov    %eax,%edi
+  803603:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  80360a:	00 00 00 
+  80360d:	ff d0                	call   *%rax
+  80360f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803612:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803616:	79 08                	jns    803620 <dup+0x37>
+    return r;
+  803618:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80361b:	e9 33 02 00 00       	jmp    803853 <dup+0x26a>
+  close(newfdnum);
+  803620:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803623:	89 c7                	mov    %eax,%edi
+  803625:	48 b8 6e 35 80 00 00 	movabs $0x80356e,%rax
+  80362c:	00 00 00 
+  80362f:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803631:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803634:	c1 e0 0c             	shl    $0xc,%eax
+  803637:	48 98                	cltq
+  803639:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80363e:	48 01 d0             	add    %rdx,%rax
+  803641:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803645:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803649:	48 89 c7             	mov    %rax,%rdi
+  80364c:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  803653:	00 00 00 
+  803656:	ff d0                	call   *%rax
+  803658:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  80365c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803660:	48 89 c7             	mov    %rax,%rdi
+  803663:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  80366a:	00 00 00 
+  80366d:	ff d0                	call   *%rax
+  80366f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803673:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80367a:	00 
+  80367b:	e9 19 01 00 00       	jmp    803799 <dup+0x1b0>
+    off -= PGSIZE;
+  803680:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803687:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803688:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80368c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803690:	48 01 d0             	add    %rdx,%rax
+  803693:	48 c1 e8 27          	shr    $0x27,%rax
+  803697:	48 89 c2             	mov    %rax,%rdx
+  80369a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8036a1:	01 00 00 
+  8036a4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036a8:	83 e0 01             	and    $0x1,%eax
+  8036ab:	48 85 c0             	test   %rax,%rax
+  8036ae:	0f 84 e5 00 00 00    	je     803799 <dup+0x1b0>
+  8036b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036bc:	48 01 d0             	add    %rdx,%rax
+  8036bf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036c3:	48 89 c2             	mov    %rax,%rdx
+  8036c6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8036cd:	01 00 00 
+  8036d0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036d4:	83 e0 01             	and    $0x1,%eax
+  8036d7:	48 85 c0             	test   %rax,%rax
+  8036da:	0f 84 b9 00 00 00    	je     803799 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8036e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036e8:	48 01 d0             	add    %rdx,%rax
+  8036eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8036ef:	48 89 c2             	mov    %rax,%rdx
+  8036f2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8036f9:	01 00 00 
+  8036fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803700:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803703:	48 85 c0             	test   %rax,%rax
+  803706:	0f 84 8d 00 00 00    	je     803799 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80370c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803710:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803714:	48 01 d0             	add    %rdx,%rax
+  803717:	48 c1 e8 0c          	shr    $0xc,%rax
+  80371b:	48 89 c2             	mov    %rax,%rdx
+  80371e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803725:	01 00 00 
+  803728:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80372c:	83 e0 01             	and    $0x1,%eax
+  80372f:	48 85 c0             	test   %rax,%rax
+  803732:	74 65                	je     803799 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803734:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803738:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80373c:	48 01 d0             	add    %rdx,%rax
+  80373f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803743:	48 89 c2             	mov    %rax,%rdx
+  803746:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80374d:	01 00 00 
+  803750:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803754:	25 07 0e 00 00       	and    $0xe07,%eax
+  803759:	89 c6                	mov    %eax,%esi
+  80375b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80375f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803763:	48 01 c2             	add    %rax,%rdx
+  803766:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80376a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80376e:	48 01 c8             	add    %rcx,%rax
+  803771:	41 89 f0             	mov    %esi,%r8d
+  803774:	48 89 d1             	mov    %rdx,%rcx
+  803777:	ba 00 00 00 00       	mov    $0x0,%edx
+  80377c:	48 89 c6             	mov    %rax,%rsi
+  80377f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803784:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+  803790:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803793:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803797:	78 60                	js     8037f9 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803799:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80379e:	0f 85 dc fe ff ff    	jne    803680 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8037a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037ac:	48 89 c2             	mov    %rax,%rdx
+  8037af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037b6:	01 00 00 
+  8037b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037c2:	89 c1                	mov    %eax,%ecx
+  8037c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8037cc:	41 89 c8             	mov    %ecx,%r8d
+  8037cf:	48 89 d1             	mov    %rdx,%rcx
+  8037d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037d7:	48 89 c6             	mov    %rax,%rsi
+  8037da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037df:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+  8037eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037f2:	78 08                	js     8037fc <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8037f4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037f7:	eb 5a                	jmp    803853 <dup+0x26a>
+        goto err;
+  8037f9:	90                   	nop
+  8037fa:	eb 01                	jmp    8037fd <dup+0x214>
+    goto err;
+  8037fc:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8037fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803801:	48 89 c6             	mov    %rax,%rsi
+  803804:	bf 00 00 00 00       	mov    $0x0,%edi
+  803809:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  803810:	00 00 00 
+  803813:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803815:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80381c:	00 
+  80381d:	eb 27                	jmp    803846 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80381f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803827:	48 01 d0             	add    %rdx,%rax
+  80382a:	48 89 c6             	mov    %rax,%rsi
+  80382d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803832:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  803839:	00 00 00 
+  80383c:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80383e:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803845:	00 
+  803846:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80384d:	00 
+  80384e:	76 cf                	jbe    80381f <dup+0x236>
+  return r;
+  803850:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803853:	c9                   	leave
+  803854:	c3                   	ret
+
+0000000000803855 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803855:	55                   	push   %rbp
+  803856:	48 89 e5             	mov    %rsp,%rbp
+  803859:	48 83 ec 40          	sub    $0x40,%rsp
+  80385d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803860:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803864:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803868:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80386c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80386f:	48 89 d6             	mov    %rdx,%rsi
+  803872:	89 c7                	mov    %eax,%edi
+  803874:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  80387b:	00 00 00 
+  80387e:	ff d0                	call   *%rax
+  803880:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803883:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803887:	78 24                	js     8038ad <read+0x58>
+  803889:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80388d:	8b 00                	mov    (%rax),%eax
+  80388f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803893:	48 89 d6             	mov    %rdx,%rsi
+  803896:	89 c7                	mov    %eax,%edi
+  803898:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038ab:	79 0a                	jns    8038b7 <read+0x62>
+    return r;
+  8038ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038b0:	48 98                	cltq
+  8038b2:	e9 9e 00 00 00       	jmp    803955 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8038b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038bb:	8b 40 08             	mov    0x8(%rax),%eax
+  8038be:	83 e0 03             	and    $0x3,%eax
+  8038c1:	83 f8 01             	cmp    $0x1,%eax
+  8038c4:	75 5c                	jne    803922 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038c6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8038cd:	00 00 00 
+  8038d0:	8b 40 04             	mov    0x4(%rax),%eax
+  8038d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038d8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8038df:	00 00 00 
+  8038e2:	48 98                	cltq
+  8038e4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8038eb:	48 01 d0             	add    %rdx,%rax
+  8038ee:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8038f4:	8b 00                	mov    (%rax),%eax
+  8038f6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038f9:	89 c6                	mov    %eax,%esi
+  8038fb:	48 b8 37 6b 80 00 00 	movabs $0x806b37,%rax
+  803902:	00 00 00 
+  803905:	48 89 c7             	mov    %rax,%rdi
+  803908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390d:	48 b9 e9 02 80 00 00 	movabs $0x8002e9,%rcx
+  803914:	00 00 00 
+  803917:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803919:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803920:	eb 33                	jmp    803955 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803922:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803926:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80392a:	48 85 c0             	test   %rax,%rax
+  80392d:	75 09                	jne    803938 <read+0xe3>
+    return -E_NOT_SUPP;
+  80392f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803936:	eb 1d                	jmp    803955 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80393c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803940:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803944:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803948:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80394c:	48 89 ce             	mov    %rcx,%rsi
+  80394f:	48 89 c7             	mov    %rax,%rdi
+  803952:	41 ff d0             	call   *%r8
+}
+  803955:	c9                   	leave
+  803956:	c3                   	ret
+
+0000000000803957 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803957:	55                   	push   %rbp
+  803958:	48 89 e5             	mov    %rsp,%rbp
+  80395b:	48 83 ec 30          	sub    $0x30,%rsp
+  80395f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803962:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803966:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80396a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803971:	eb 49                	jmp    8039bc <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803973:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803976:	48 98                	cltq
+  803978:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80397c:	48 29 c2             	sub    %rax,%rdx
+  80397f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803982:	48 63 c8             	movslq %eax,%rcx
+  803985:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803989:	48 01 c1             	add    %rax,%rcx
+  80398c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80398f:	48 89 ce             	mov    %rcx,%rsi
+  803992:	89 c7                	mov    %eax,%edi
+  803994:	48 b8 55 38 80 00 00 	movabs $0x803855,%rax
+  80399b:	00 00 00 
+  80399e:	ff d0                	call   *%rax
+  8039a0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8039a3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8039a7:	79 07                	jns    8039b0 <readn+0x59>
+      return m;
+  8039a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8039ac:	48 98                	cltq
+  8039ae:	eb 1f                	jmp    8039cf <readn+0x78>
+    if (m == 0)
+  8039b0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8039b4:	74 13                	je     8039c9 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8039b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8039b9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8039bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039bf:	48 98                	cltq
+  8039c1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8039c5:	72 ac                	jb     803973 <readn+0x1c>
+  8039c7:	eb 01                	jmp    8039ca <readn+0x73>
+      break;
+  8039c9:	90                   	nop
+  }
+  return tot;
+  8039ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039cd:	48 98                	cltq
+}
+  8039cf:	c9                   	leave
+  8039d0:	c3                   	ret
+
+00000000008039d1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8039d1:	55                   	push   %rbp
+  8039d2:	48 89 e5             	mov    %rsp,%rbp
+  8039d5:	48 83 ec 40          	sub    $0x40,%rsp
+  8039d9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039eb:	48 89 d6             	mov    %rdx,%rsi
+  8039ee:	89 c7                	mov    %eax,%edi
+  8039f0:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+  8039fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a03:	78 24                	js     803a29 <write+0x58>
+  803a05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a09:	8b 00                	mov    (%rax),%eax
+  803a0b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a0f:	48 89 d6             	mov    %rdx,%rsi
+  803a12:	89 c7                	mov    %eax,%edi
+  803a14:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803a1b:	00 00 00 
+  803a1e:	ff d0                	call   *%rax
+  803a20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a23:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a27:	79 0a                	jns    803a33 <write+0x62>
+    return r;
+  803a29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a2c:	48 98                	cltq
+  803a2e:	e9 9d 00 00 00       	jmp    803ad0 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a37:	8b 40 08             	mov    0x8(%rax),%eax
+  803a3a:	83 e0 03             	and    $0x3,%eax
+  803a3d:	85 c0                	test   %eax,%eax
+  803a3f:	75 5c                	jne    803a9d <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a41:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803a48:	00 00 00 
+  803a4b:	8b 40 04             	mov    0x4(%rax),%eax
+  803a4e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a53:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a5a:	00 00 00 
+  803a5d:	48 98                	cltq
+  803a5f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a66:	48 01 d0             	add    %rdx,%rax
+  803a69:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a6f:	8b 00                	mov    (%rax),%eax
+  803a71:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a74:	89 c6                	mov    %eax,%esi
+  803a76:	48 b8 53 6b 80 00 00 	movabs $0x806b53,%rax
+  803a7d:	00 00 00 
+  803a80:	48 89 c7             	mov    %rax,%rdi
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a88:	48 b9 e9 02 80 00 00 	movabs $0x8002e9,%rcx
+  803a8f:	00 00 00 
+  803a92:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a94:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a9b:	eb 33                	jmp    803ad0 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803a9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803aa5:	48 85 c0             	test   %rax,%rax
+  803aa8:	75 09                	jne    803ab3 <write+0xe2>
+    return -E_NOT_SUPP;
+  803aaa:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803ab1:	eb 1d                	jmp    803ad0 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab7:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ac3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803ac7:	48 89 ce             	mov    %rcx,%rsi
+  803aca:	48 89 c7             	mov    %rax,%rdi
+  803acd:	41 ff d0             	call   *%r8
+}
+  803ad0:	c9                   	leave
+  803ad1:	c3                   	ret
+
+0000000000803ad2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803ad2:	55                   	push   %rbp
+  803ad3:	48 89 e5             	mov    %rsp,%rbp
+  803ad6:	48 83 ec 18          	sub    $0x18,%rsp
+  803ada:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803add:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ae0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ae4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ae7:	48 89 d6             	mov    %rdx,%rsi
+  803aea:	89 c7                	mov    %eax,%edi
+  803aec:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+  803af8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803afb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aff:	79 05                	jns    803b06 <seek+0x34>
+    return r;
+  803b01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b04:	eb 0f                	jmp    803b15 <seek+0x43>
+  fd->fd_offset = offset;
+  803b06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b0a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b0d:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803b10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b15:	c9                   	leave
+  803b16:	c3                   	ret
+
+0000000000803b17 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b17:	55                   	push   %rbp
+  803b18:	48 89 e5             	mov    %rsp,%rbp
+  803b1b:	48 83 ec 30          	sub    $0x30,%rsp
+  803b1f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b22:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b25:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b29:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b2c:	48 89 d6             	mov    %rdx,%rsi
+  803b2f:	89 c7                	mov    %eax,%edi
+  803b31:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  803b38:	00 00 00 
+  803b3b:	ff d0                	call   *%rax
+  803b3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b40:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b44:	78 24                	js     803b6a <ftruncate+0x53>
+  803b46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b4a:	8b 00                	mov    (%rax),%eax
+  803b4c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b50:	48 89 d6             	mov    %rdx,%rsi
+  803b53:	89 c7                	mov    %eax,%edi
+  803b55:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803b5c:	00 00 00 
+  803b5f:	ff d0                	call   *%rax
+  803b61:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b64:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b68:	79 08                	jns    803b72 <ftruncate+0x5b>
+    return r;
+  803b6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b6d:	e9 92 00 00 00       	jmp    803c04 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b76:	8b 40 08             	mov    0x8(%rax),%eax
+  803b79:	83 e0 03             	and    $0x3,%eax
+  803b7c:	85 c0                	test   %eax,%eax
+  803b7e:	75 5a                	jne    803bda <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803b80:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b87:	00 00 00 
+  803b8a:	8b 40 04             	mov    0x4(%rax),%eax
+  803b8d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b92:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b99:	00 00 00 
+  803b9c:	48 98                	cltq
+  803b9e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ba5:	48 01 d0             	add    %rdx,%rax
+  803ba8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803bae:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803bb0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803bb3:	89 c6                	mov    %eax,%esi
+  803bb5:	48 b8 70 6b 80 00 00 	movabs $0x806b70,%rax
+  803bbc:	00 00 00 
+  803bbf:	48 89 c7             	mov    %rax,%rdi
+  803bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc7:	48 b9 e9 02 80 00 00 	movabs $0x8002e9,%rcx
+  803bce:	00 00 00 
+  803bd1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bd8:	eb 2a                	jmp    803c04 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bde:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803be2:	48 85 c0             	test   %rax,%rax
+  803be5:	75 07                	jne    803bee <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803be7:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803bec:	eb 16                	jmp    803c04 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803bee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bf2:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803bf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bfa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803bfd:	89 d6                	mov    %edx,%esi
+  803bff:	48 89 c7             	mov    %rax,%rdi
+  803c02:	ff d1                	call   *%rcx
+}
+  803c04:	c9                   	leave
+  803c05:	c3                   	ret
+
+0000000000803c06 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c06:	55                   	push   %rbp
+  803c07:	48 89 e5             	mov    %rsp,%rbp
+  803c0a:	48 83 ec 30          	sub    $0x30,%rsp
+  803c0e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c11:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c15:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c19:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c1c:	48 89 d6             	mov    %rdx,%rsi
+  803c1f:	89 c7                	mov    %eax,%edi
+  803c21:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  803c28:	00 00 00 
+  803c2b:	ff d0                	call   *%rax
+  803c2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c34:	78 24                	js     803c5a <fstat+0x54>
+  803c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c3a:	8b 00                	mov    (%rax),%eax
+  803c3c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c40:	48 89 d6             	mov    %rdx,%rsi
+  803c43:	89 c7                	mov    %eax,%edi
+  803c45:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803c4c:	00 00 00 
+  803c4f:	ff d0                	call   *%rax
+  803c51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c58:	79 05                	jns    803c5f <fstat+0x59>
+    return r;
+  803c5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c5d:	eb 5e                	jmp    803cbd <fstat+0xb7>
+  if (!dev->dev_stat)
+  803c5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c63:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803c67:	48 85 c0             	test   %rax,%rax
+  803c6a:	75 07                	jne    803c73 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803c6c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803c71:	eb 4a                	jmp    803cbd <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803c73:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c77:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803c7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c7e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803c85:	00 00 00 
+  stat->st_isdir   = 0;
+  803c88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c8c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803c93:	00 00 00 
+  stat->st_dev     = dev;
+  803c96:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c9e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803ca5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ca9:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803cad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cb1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803cb5:	48 89 d6             	mov    %rdx,%rsi
+  803cb8:	48 89 c7             	mov    %rax,%rdi
+  803cbb:	ff d1                	call   *%rcx
+}
+  803cbd:	c9                   	leave
+  803cbe:	c3                   	ret
+
+0000000000803cbf <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803cbf:	55                   	push   %rbp
+  803cc0:	48 89 e5             	mov    %rsp,%rbp
+  803cc3:	48 83 ec 10          	sub    $0x10,%rsp
+  803cc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ccb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803ccf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cd3:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803cd9:	83 f8 20             	cmp    $0x20,%eax
+  803cdc:	75 07                	jne    803ce5 <pollwait_key+0x26>
+    return -E_INVAL;
+  803cde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ce3:	eb 5f                	jmp    803d44 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803ce5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ce9:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803cef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cf3:	48 63 d2             	movslq %edx,%rdx
+  803cf6:	48 c1 e2 04          	shl    $0x4,%rdx
+  803cfa:	48 01 c2             	add    %rax,%rdx
+  803cfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d01:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803d04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d08:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803d0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d12:	8b 00                	mov    (%rax),%eax
+  803d14:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d18:	48 63 c9             	movslq %ecx,%rcx
+  803d1b:	48 c1 e1 04          	shl    $0x4,%rcx
+  803d1f:	48 01 ca             	add    %rcx,%rdx
+  803d22:	48 83 c2 08          	add    $0x8,%rdx
+  803d26:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803d28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d2c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d32:	8d 50 01             	lea    0x1(%rax),%edx
+  803d35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d39:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d44:	c9                   	leave
+  803d45:	c3                   	ret
+
+0000000000803d46 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803d46:	55                   	push   %rbp
+  803d47:	48 89 e5             	mov    %rsp,%rbp
+  803d4a:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803d51:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803d58:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803d5e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803d65:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803d6c:	00 
+  int i, r, ready, ipc = 0;
+  803d6d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803d74:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803d7b:	00 
+  803d7c:	74 45                	je     803dc3 <poll+0x7d>
+  803d7e:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803d85:	ff 
+  803d86:	74 3b                	je     803dc3 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803d88:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  803d8f:	00 00 00 
+  803d92:	ff d0                	call   *%rax
+  803d94:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803d98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d9c:	48 f7 d0             	not    %rax
+  803d9f:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803da6:	73 10                	jae    803db8 <poll+0x72>
+  803da8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803dac:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803db3:	48 01 d0             	add    %rdx,%rax
+  803db6:	eb 07                	jmp    803dbf <poll+0x79>
+  803db8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803dbf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803dc3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803dca:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803dd1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803dd8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803ddf:	e9 46 02 00 00       	jmp    80402a <poll+0x2e4>
+      fds[i].revents = 0;
+  803de4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803de7:	48 63 d0             	movslq %eax,%rdx
+  803dea:	48 89 d0             	mov    %rdx,%rax
+  803ded:	48 01 c0             	add    %rax,%rax
+  803df0:	48 01 d0             	add    %rdx,%rax
+  803df3:	48 c1 e0 02          	shl    $0x2,%rax
+  803df7:	48 89 c2             	mov    %rax,%rdx
+  803dfa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e01:	48 01 d0             	add    %rdx,%rax
+  803e04:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803e0b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e0e:	48 63 d0             	movslq %eax,%rdx
+  803e11:	48 89 d0             	mov    %rdx,%rax
+  803e14:	48 01 c0             	add    %rax,%rax
+  803e17:	48 01 d0             	add    %rdx,%rax
+  803e1a:	48 c1 e0 02          	shl    $0x2,%rax
+  803e1e:	48 89 c2             	mov    %rax,%rdx
+  803e21:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e28:	48 01 d0             	add    %rdx,%rax
+  803e2b:	8b 00                	mov    (%rax),%eax
+  803e2d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803e30:	75 62                	jne    803e94 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803e32:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e35:	48 63 d0             	movslq %eax,%rdx
+  803e38:	48 89 d0             	mov    %rdx,%rax
+  803e3b:	48 01 c0             	add    %rax,%rax
+  803e3e:	48 01 d0             	add    %rdx,%rax
+  803e41:	48 c1 e0 02          	shl    $0x2,%rax
+  803e45:	48 89 c2             	mov    %rax,%rdx
+  803e48:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e4f:	48 01 d0             	add    %rdx,%rax
+  803e52:	8b 40 04             	mov    0x4(%rax),%eax
+  803e55:	83 e0 01             	and    $0x1,%eax
+  803e58:	85 c0                	test   %eax,%eax
+  803e5a:	0f 84 9b 01 00 00    	je     803ffb <poll+0x2b5>
+          fds[i].revents = ipc;
+  803e60:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e63:	48 63 d0             	movslq %eax,%rdx
+  803e66:	48 89 d0             	mov    %rdx,%rax
+  803e69:	48 01 c0             	add    %rax,%rax
+  803e6c:	48 01 d0             	add    %rdx,%rax
+  803e6f:	48 c1 e0 02          	shl    $0x2,%rax
+  803e73:	48 89 c2             	mov    %rax,%rdx
+  803e76:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e7d:	48 01 c2             	add    %rax,%rdx
+  803e80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e83:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803e86:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803e89:	83 c8 04             	or     $0x4,%eax
+  803e8c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803e8f:	e9 67 01 00 00       	jmp    803ffb <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803e94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e97:	48 63 d0             	movslq %eax,%rdx
+  803e9a:	48 89 d0             	mov    %rdx,%rax
+  803e9d:	48 01 c0             	add    %rax,%rax
+  803ea0:	48 01 d0             	add    %rdx,%rax
+  803ea3:	48 c1 e0 02          	shl    $0x2,%rax
+  803ea7:	48 89 c2             	mov    %rax,%rdx
+  803eaa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eb1:	48 01 d0             	add    %rdx,%rax
+  803eb4:	8b 00                	mov    (%rax),%eax
+  803eb6:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803ebd:	48 89 d6             	mov    %rdx,%rsi
+  803ec0:	89 c7                	mov    %eax,%edi
+  803ec2:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  803ec9:	00 00 00 
+  803ecc:	ff d0                	call   *%rax
+  803ece:	85 c0                	test   %eax,%eax
+  803ed0:	78 25                	js     803ef7 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803ed2:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803ed9:	8b 00                	mov    (%rax),%eax
+  803edb:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803ee2:	48 89 d6             	mov    %rdx,%rsi
+  803ee5:	89 c7                	mov    %eax,%edi
+  803ee7:	48 b8 9a 34 80 00 00 	movabs $0x80349a,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803ef3:	85 c0                	test   %eax,%eax
+  803ef5:	79 2c                	jns    803f23 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803ef7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803efa:	48 63 d0             	movslq %eax,%rdx
+  803efd:	48 89 d0             	mov    %rdx,%rax
+  803f00:	48 01 c0             	add    %rax,%rax
+  803f03:	48 01 d0             	add    %rdx,%rax
+  803f06:	48 c1 e0 02          	shl    $0x2,%rax
+  803f0a:	48 89 c2             	mov    %rax,%rdx
+  803f0d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f14:	48 01 d0             	add    %rdx,%rax
+  803f17:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803f1e:	e9 d8 00 00 00       	jmp    803ffb <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803f23:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803f2a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803f2e:	48 85 c0             	test   %rax,%rax
+  803f31:	74 7d                	je     803fb0 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803f33:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803f3a:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803f3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f41:	48 63 d0             	movslq %eax,%rdx
+  803f44:	48 89 d0             	mov    %rdx,%rax
+  803f47:	48 01 c0             	add    %rax,%rax
+  803f4a:	48 01 d0             	add    %rdx,%rax
+  803f4d:	48 c1 e0 02          	shl    $0x2,%rax
+  803f51:	48 89 c2             	mov    %rax,%rdx
+  803f54:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f5b:	48 01 d0             	add    %rdx,%rax
+  803f5e:	8b 48 04             	mov    0x4(%rax),%ecx
+  803f61:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803f68:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803f6f:	89 ce                	mov    %ecx,%esi
+  803f71:	48 89 c7             	mov    %rax,%rdi
+  803f74:	41 ff d0             	call   *%r8
+  803f77:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803f7a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803f7e:	79 08                	jns    803f88 <poll+0x242>
+          return r;
+  803f80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f83:	e9 45 01 00 00       	jmp    8040cd <poll+0x387>
+        fds[i].revents = r;
+  803f88:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f8b:	48 63 d0             	movslq %eax,%rdx
+  803f8e:	48 89 d0             	mov    %rdx,%rax
+  803f91:	48 01 c0             	add    %rax,%rax
+  803f94:	48 01 d0             	add    %rdx,%rax
+  803f97:	48 c1 e0 02          	shl    $0x2,%rax
+  803f9b:	48 89 c2             	mov    %rax,%rdx
+  803f9e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fa5:	48 01 c2             	add    %rax,%rdx
+  803fa8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fab:	89 42 08             	mov    %eax,0x8(%rdx)
+  803fae:	eb 4b                	jmp    803ffb <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803fb0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fb3:	48 63 d0             	movslq %eax,%rdx
+  803fb6:	48 89 d0             	mov    %rdx,%rax
+  803fb9:	48 01 c0             	add    %rax,%rax
+  803fbc:	48 01 d0             	add    %rdx,%rax
+  803fbf:	48 c1 e0 02          	shl    $0x2,%rax
+  803fc3:	48 89 c2             	mov    %rax,%rdx
+  803fc6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fcd:	48 01 d0             	add    %rdx,%rax
+  803fd0:	8b 48 04             	mov    0x4(%rax),%ecx
+  803fd3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fd6:	48 63 d0             	movslq %eax,%rdx
+  803fd9:	48 89 d0             	mov    %rdx,%rax
+  803fdc:	48 01 c0             	add    %rax,%rax
+  803fdf:	48 01 d0             	add    %rdx,%rax
+  803fe2:	48 c1 e0 02          	shl    $0x2,%rax
+  803fe6:	48 89 c2             	mov    %rax,%rdx
+  803fe9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ff0:	48 01 d0             	add    %rdx,%rax
+  803ff3:	83 e1 03             	and    $0x3,%ecx
+  803ff6:	89 ca                	mov    %ecx,%edx
+  803ff8:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803ffb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ffe:	48 63 d0             	movslq %eax,%rdx
+  804001:	48 89 d0             	mov    %rdx,%rax
+  804004:	48 01 c0             	add    %rax,%rax
+  804007:	48 01 d0             	add    %rdx,%rax
+  80400a:	48 c1 e0 02          	shl    $0x2,%rax
+  80400e:	48 89 c2             	mov    %rax,%rdx
+  804011:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804018:	48 01 d0             	add    %rdx,%rax
+  80401b:	8b 40 08             	mov    0x8(%rax),%eax
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	74 04                	je     804026 <poll+0x2e0>
+        ready++;
+  804022:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804026:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80402a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80402d:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804033:	0f 8c ab fd ff ff    	jl     803de4 <poll+0x9e>
+    }
+    if (ready)
+  804039:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80403d:	74 08                	je     804047 <poll+0x301>
+      return ready;
+  80403f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804042:	e9 86 00 00 00       	jmp    8040cd <poll+0x387>
+
+    if (deadline) {
+  804047:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80404c:	74 30                	je     80407e <poll+0x338>
+      now     = vsys_clock_ns();
+  80404e:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  804055:	00 00 00 
+  804058:	ff d0                	call   *%rax
+  80405a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80405e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804062:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804066:	73 0a                	jae    804072 <poll+0x32c>
+  804068:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80406c:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804070:	eb 05                	jmp    804077 <poll+0x331>
+  804072:	b8 00 00 00 00       	mov    $0x0,%eax
+  804077:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80407e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804081:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804084:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80408b:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804092:	48 89 c7             	mov    %rax,%rdi
+  804095:	48 b8 af 24 80 00 00 	movabs $0x8024af,%rax
+  80409c:	00 00 00 
+  80409f:	ff d0                	call   *%rax
+  8040a1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8040a4:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8040a8:	75 07                	jne    8040b1 <poll+0x36b>
+      return 0;
+  8040aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040af:	eb 1c                	jmp    8040cd <poll+0x387>
+    if (r < 0)
+  8040b1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8040b5:	79 05                	jns    8040bc <poll+0x376>
+      return r;
+  8040b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040ba:	eb 11                	jmp    8040cd <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8040bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040bf:	c1 f8 02             	sar    $0x2,%eax
+  8040c2:	83 e0 01             	and    $0x1,%eax
+  8040c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8040c8:	e9 f6 fc ff ff       	jmp    803dc3 <poll+0x7d>
+  }
+}
+  8040cd:	c9                   	leave
+  8040ce:	c3                   	ret
+
+00000000008040cf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8040cf:	55                   	push   %rbp
+  8040d0:	48 89 e5             	mov    %rsp,%rbp
+  8040d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8040d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8040df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8040e8:	48 89 c7             	mov    %rax,%rdi
+  8040eb:	48 b8 bd 41 80 00 00 	movabs $0x8041bd,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+  8040f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040fe:	79 05                	jns    804105 <stat+0x36>
+    return fd;
+  804100:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804103:	eb 2f                	jmp    804134 <stat+0x65>
+  r = fstat(fd, stat);
+  804105:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804109:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80410c:	48 89 d6             	mov    %rdx,%rsi
+  80410f:	89 c7                	mov    %eax,%edi
+  804111:	48 b8 06 3c 80 00 00 	movabs $0x803c06,%rax
+  804118:	00 00 00 
+  80411b:	ff d0                	call   *%rax
+  80411d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804120:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804123:	89 c7                	mov    %eax,%edi
+  804125:	48 b8 6e 35 80 00 00 	movabs $0x80356e,%rax
+  80412c:	00 00 00 
+  80412f:	ff d0                	call   *%rax
+  return r;
+  804131:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804134:	c9                   	leave
+  804135:	c3                   	ret
+
+0000000000804136 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804136:	55                   	push   %rbp
+  804137:	48 89 e5             	mov    %rsp,%rbp
+  80413a:	48 83 ec 10          	sub    $0x10,%rsp
+  80413e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804141:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  804145:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80414c:	00 00 00 
+  80414f:	8b 00                	mov    (%rax),%eax
+  804151:	85 c0                	test   %eax,%eax
+  804153:	75 1d                	jne    804172 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804155:	bf 03 00 00 00       	mov    $0x3,%edi
+  80415a:	48 b8 58 31 80 00 00 	movabs $0x803158,%rax
+  804161:	00 00 00 
+  804164:	ff d0                	call   *%rax
+  804166:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80416d:	00 00 00 
+  804170:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804172:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804179:	00 00 00 
+  80417c:	8b 00                	mov    (%rax),%eax
+  80417e:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804181:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804186:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80418d:	00 00 00 
+  804190:	89 c7                	mov    %eax,%edi
+  804192:	48 b8 ab 30 80 00 00 	movabs $0x8030ab,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80419e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041a7:	48 89 c6             	mov    %rax,%rsi
+  8041aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041af:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  8041b6:	00 00 00 
+  8041b9:	ff d0                	call   *%rax
+}
+  8041bb:	c9                   	leave
+  8041bc:	c3                   	ret
+
+00000000008041bd <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8041bd:	55                   	push   %rbp
+  8041be:	48 89 e5             	mov    %rsp,%rbp
+  8041c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8041c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041c9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8041cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d0:	48 89 c7             	mov    %rax,%rdi
+  8041d3:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8041da:	00 00 00 
+  8041dd:	ff d0                	call   *%rax
+  8041df:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8041e4:	7e 0a                	jle    8041f0 <open+0x33>
+    return -E_BAD_PATH;
+  8041e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8041eb:	e9 a8 00 00 00       	jmp    804298 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8041f0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8041f4:	48 89 c7             	mov    %rax,%rdi
+  8041f7:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+  804203:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804206:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80420a:	79 08                	jns    804214 <open+0x57>
+    return r;
+  80420c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80420f:	e9 84 00 00 00       	jmp    804298 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804218:	48 89 c6             	mov    %rax,%rsi
+  80421b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804222:	00 00 00 
+  804225:	48 89 c7             	mov    %rax,%rdi
+  804228:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  80422f:	00 00 00 
+  804232:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804234:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80423b:	00 00 00 
+  80423e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804241:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804247:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80424b:	48 89 c6             	mov    %rax,%rsi
+  80424e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804253:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  80425a:	00 00 00 
+  80425d:	ff d0                	call   *%rax
+  80425f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804262:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804266:	79 1d                	jns    804285 <open+0xc8>
+    fd_close(fd, 0);
+  804268:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80426c:	be 00 00 00 00       	mov    $0x0,%esi
+  804271:	48 89 c7             	mov    %rax,%rdi
+  804274:	48 b8 cf 33 80 00 00 	movabs $0x8033cf,%rax
+  80427b:	00 00 00 
+  80427e:	ff d0                	call   *%rax
+    return r;
+  804280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804283:	eb 13                	jmp    804298 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804285:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804289:	48 89 c7             	mov    %rax,%rdi
+  80428c:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  804293:	00 00 00 
+  804296:	ff d0                	call   *%rax
+}
+  804298:	c9                   	leave
+  804299:	c3                   	ret
+
+000000000080429a <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80429a:	55                   	push   %rbp
+  80429b:	48 89 e5             	mov    %rsp,%rbp
+  80429e:	48 83 ec 10          	sub    $0x10,%rsp
+  8042a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8042a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042aa:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042ad:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042b4:	00 00 00 
+  8042b7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8042b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8042be:	bf 06 00 00 00       	mov    $0x6,%edi
+  8042c3:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  8042ca:	00 00 00 
+  8042cd:	ff d0                	call   *%rax
+}
+  8042cf:	c9                   	leave
+  8042d0:	c3                   	ret
+
+00000000008042d1 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	48 83 ec 30          	sub    $0x30,%rsp
+  8042d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8042e5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8042ea:	74 07                	je     8042f3 <devfile_read+0x22>
+  8042ec:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8042f1:	75 0a                	jne    8042fd <devfile_read+0x2c>
+  return E_INVAL;
+  8042f3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8042f8:	e9 b4 00 00 00       	jmp    8043b1 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8042fd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804304:	00 
+  while (n) {
+  804305:	e9 98 00 00 00       	jmp    8043a2 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80430a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80430e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804311:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804318:	00 00 00 
+  80431b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80431d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804324:	00 00 00 
+  804327:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80432b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80432f:	be 00 00 00 00       	mov    $0x0,%esi
+  804334:	bf 03 00 00 00       	mov    $0x3,%edi
+  804339:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  804345:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804348:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80434c:	7f 13                	jg     804361 <devfile_read+0x90>
+      return res ? res : res0;
+  80434e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804352:	74 07                	je     80435b <devfile_read+0x8a>
+  804354:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804357:	48 98                	cltq
+  804359:	eb 56                	jmp    8043b1 <devfile_read+0xe0>
+  80435b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435f:	eb 50                	jmp    8043b1 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804361:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804364:	48 63 d0             	movslq %eax,%rdx
+  804367:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80436b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804372:	00 00 00 
+  804375:	48 89 ce             	mov    %rcx,%rsi
+  804378:	48 89 c7             	mov    %rax,%rdi
+  80437b:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+
+    buf += res;
+  804387:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80438a:	48 98                	cltq
+  80438c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804390:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804393:	48 98                	cltq
+  804395:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804399:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80439c:	48 98                	cltq
+  80439e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8043a2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8043a7:	0f 85 5d ff ff ff    	jne    80430a <devfile_read+0x39>
+  }
+
+  return res0;
+  8043ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8043b1:	c9                   	leave
+  8043b2:	c3                   	ret
+
+00000000008043b3 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8043b3:	55                   	push   %rbp
+  8043b4:	48 89 e5             	mov    %rsp,%rbp
+  8043b7:	48 83 ec 50          	sub    $0x50,%rsp
+  8043bb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8043bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043c3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8043c7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8043cc:	74 07                	je     8043d5 <devfile_write+0x22>
+  8043ce:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8043d3:	75 0a                	jne    8043df <devfile_write+0x2c>
+  return E_INVAL;
+  8043d5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8043da:	e9 c9 00 00 00       	jmp    8044a8 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8043df:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043e6:	00 
+
+  while (n) {
+  8043e7:	e9 ad 00 00 00       	jmp    804499 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8043ec:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8043f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8043f4:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8043fb:	00 
+  8043fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804404:	48 39 c2             	cmp    %rax,%rdx
+  804407:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80440b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80440f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804413:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804417:	48 89 c6             	mov    %rax,%rsi
+  80441a:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  804421:	00 00 00 
+  804424:	48 89 c7             	mov    %rax,%rdi
+  804427:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  80442e:	00 00 00 
+  804431:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804433:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804437:	8b 40 0c             	mov    0xc(%rax),%eax
+  80443a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804441:	00 00 00 
+  804444:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804446:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80444d:	00 00 00 
+  804450:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804454:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804458:	be 00 00 00 00       	mov    $0x0,%esi
+  80445d:	bf 04 00 00 00       	mov    $0x4,%edi
+  804462:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  804469:	00 00 00 
+  80446c:	ff d0                	call   *%rax
+  80446e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804471:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804475:	79 07                	jns    80447e <devfile_write+0xcb>
+      return res;
+  804477:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80447a:	48 98                	cltq
+  80447c:	eb 2a                	jmp    8044a8 <devfile_write+0xf5>
+
+    buf += res;
+  80447e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804481:	48 98                	cltq
+  804483:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804487:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80448a:	48 98                	cltq
+  80448c:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804490:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804493:	48 98                	cltq
+  804495:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804499:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80449e:	0f 85 48 ff ff ff    	jne    8043ec <devfile_write+0x39>
+  }
+
+  return res0;
+  8044a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8044a8:	c9                   	leave
+  8044a9:	c3                   	ret
+
+00000000008044aa <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8044aa:	55                   	push   %rbp
+  8044ab:	48 89 e5             	mov    %rsp,%rbp
+  8044ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8044b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8044ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044be:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044c1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044c8:	00 00 00 
+  8044cb:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8044cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8044d2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8044d7:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+  8044e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044ea:	79 05                	jns    8044f1 <devfile_stat+0x47>
+    return r;
+  8044ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044ef:	eb 59                	jmp    80454a <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8044f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044f5:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044fc:	00 00 00 
+  8044ff:	48 89 d6             	mov    %rdx,%rsi
+  804502:	48 89 c7             	mov    %rax,%rdi
+  804505:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  80450c:	00 00 00 
+  80450f:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804511:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804518:	00 00 00 
+  80451b:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804521:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804525:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80452b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804532:	00 00 00 
+  804535:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  80453b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80453f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804545:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80454a:	c9                   	leave
+  80454b:	c3                   	ret
+
+000000000080454c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80454c:	55                   	push   %rbp
+  80454d:	48 89 e5             	mov    %rsp,%rbp
+  804550:	48 83 ec 10          	sub    $0x10,%rsp
+  804554:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804558:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80455b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80455f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804562:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804569:	00 00 00 
+  80456c:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80456e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804575:	00 00 00 
+  804578:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80457b:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80457e:	be 00 00 00 00       	mov    $0x0,%esi
+  804583:	bf 02 00 00 00       	mov    $0x2,%edi
+  804588:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  80458f:	00 00 00 
+  804592:	ff d0                	call   *%rax
+}
+  804594:	c9                   	leave
+  804595:	c3                   	ret
+
+0000000000804596 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804596:	55                   	push   %rbp
+  804597:	48 89 e5             	mov    %rsp,%rbp
+  80459a:	48 83 ec 18          	sub    $0x18,%rsp
+  80459e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8045a2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8045a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8045a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045ac:	83 e0 03             	and    $0x3,%eax
+}
+  8045af:	c9                   	leave
+  8045b0:	c3                   	ret
+
+00000000008045b1 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8045b1:	55                   	push   %rbp
+  8045b2:	48 89 e5             	mov    %rsp,%rbp
+  8045b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8045b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8045bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c1:	48 89 c7             	mov    %rax,%rdi
+  8045c4:	48 b8 98 11 80 00 00 	movabs $0x801198,%rax
+  8045cb:	00 00 00 
+  8045ce:	ff d0                	call   *%rax
+  8045d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8045d5:	7e 07                	jle    8045de <remove+0x2d>
+    return -E_BAD_PATH;
+  8045d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8045dc:	eb 36                	jmp    804614 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8045de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045e2:	48 89 c6             	mov    %rax,%rsi
+  8045e5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8045ec:	00 00 00 
+  8045ef:	48 89 c7             	mov    %rax,%rdi
+  8045f2:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  8045f9:	00 00 00 
+  8045fc:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8045fe:	be 00 00 00 00       	mov    $0x0,%esi
+  804603:	bf 07 00 00 00       	mov    $0x7,%edi
+  804608:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  80460f:	00 00 00 
+  804612:	ff d0                	call   *%rax
+}
+  804614:	c9                   	leave
+  804615:	c3                   	ret
+
+0000000000804616 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804616:	55                   	push   %rbp
+  804617:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80461a:	be 00 00 00 00       	mov    $0x0,%esi
+  80461f:	bf 08 00 00 00       	mov    $0x8,%edi
+  804624:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  80462b:	00 00 00 
+  80462e:	ff d0                	call   *%rax
+}
+  804630:	5d                   	pop    %rbp
+  804631:	c3                   	ret
+
+0000000000804632 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804632:	55                   	push   %rbp
+  804633:	48 89 e5             	mov    %rsp,%rbp
+  804636:	48 83 ec 20          	sub    $0x20,%rsp
+  80463a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80463e:	be 00 00 00 00       	mov    $0x0,%esi
+  804643:	bf 09 00 00 00       	mov    $0x9,%edi
+  804648:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+  804654:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804657:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80465b:	79 05                	jns    804662 <fs_stats+0x30>
+    return r;
+  80465d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804660:	eb 2a                	jmp    80468c <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804666:	ba 68 00 00 00       	mov    $0x68,%edx
+  80466b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804672:	00 00 00 
+  804675:	48 89 ce             	mov    %rcx,%rsi
+  804678:	48 89 c7             	mov    %rax,%rdi
+  80467b:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+  return 0;
+  804687:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80468c:	c9                   	leave
+  80468d:	c3                   	ret
+
+000000000080468e <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80468e:	55                   	push   %rbp
+  80468f:	48 89 e5             	mov    %rsp,%rbp
+  804692:	48 83 ec 10          	sub    $0x10,%rsp
+  804696:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804699:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046a0:	00 00 00 
+  8046a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046a6:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8046a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8046ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8046b2:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  8046b9:	00 00 00 
+  8046bc:	ff d0                	call   *%rax
+}
+  8046be:	c9                   	leave
+  8046bf:	c3                   	ret
+
+00000000008046c0 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8046c0:	55                   	push   %rbp
+  8046c1:	48 89 e5             	mov    %rsp,%rbp
+  8046c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8046c8:	89 f8                	mov    %edi,%eax
+  8046ca:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8046cd:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8046d1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046d8:	00 00 00 
+  8046db:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8046dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8046e2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8046e7:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  8046ee:	00 00 00 
+  8046f1:	ff d0                	call   *%rax
+}
+  8046f3:	c9                   	leave
+  8046f4:	c3                   	ret
+
+00000000008046f5 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8046f5:	55                   	push   %rbp
+  8046f6:	48 89 e5             	mov    %rsp,%rbp
+  8046f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8046fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804705:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80470a:	48 89 c7             	mov    %rax,%rdi
+  80470d:	48 b8 1b 47 80 00 00 	movabs $0x80471b,%rax
+  804714:	00 00 00 
+  804717:	ff d0                	call   *%rax
+}
+  804719:	c9                   	leave
+  80471a:	c3                   	ret
+
+000000000080471b <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  80471b:	55                   	push   %rbp
+  80471c:	48 89 e5             	mov    %rsp,%rbp
+  80471f:	48 83 ec 50          	sub    $0x50,%rsp
+  804723:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804727:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  80472b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804732:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804733:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804738:	74 0a                	je     804744 <pipe_size+0x29>
+  80473a:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804741:	00 
+  804742:	76 0a                	jbe    80474e <pipe_size+0x33>
+    return -E_INVAL;
+  804744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804749:	e9 cc 02 00 00       	jmp    804a1a <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80474e:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804752:	48 89 c7             	mov    %rax,%rdi
+  804755:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  80475c:	00 00 00 
+  80475f:	ff d0                	call   *%rax
+  804761:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804764:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804768:	0f 88 a8 02 00 00    	js     804a16 <pipe_size+0x2fb>
+  80476e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804772:	ba 07 04 00 00       	mov    $0x407,%edx
+  804777:	48 89 c6             	mov    %rax,%rsi
+  80477a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80477f:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  804786:	00 00 00 
+  804789:	ff d0                	call   *%rax
+  80478b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80478e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804792:	0f 88 7e 02 00 00    	js     804a16 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804798:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80479c:	48 89 c7             	mov    %rax,%rdi
+  80479f:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  8047a6:	00 00 00 
+  8047a9:	ff d0                	call   *%rax
+  8047ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047b2:	0f 88 43 02 00 00    	js     8049fb <pipe_size+0x2e0>
+  8047b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047bc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047c1:	48 89 c6             	mov    %rax,%rsi
+  8047c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047c9:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  8047d0:	00 00 00 
+  8047d3:	ff d0                	call   *%rax
+  8047d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047dc:	0f 88 19 02 00 00    	js     8049fb <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8047e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047e6:	48 89 c7             	mov    %rax,%rdi
+  8047e9:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  8047f0:	00 00 00 
+  8047f3:	ff d0                	call   *%rax
+  8047f5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8047f9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804800:	00 
+  804801:	e9 a2 00 00 00       	jmp    8048a8 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80480a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80480e:	48 89 c2             	mov    %rax,%rdx
+  804811:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804815:	48 01 d0             	add    %rdx,%rax
+  804818:	ba 07 04 00 00       	mov    $0x407,%edx
+  80481d:	48 89 c6             	mov    %rax,%rsi
+  804820:	bf 00 00 00 00       	mov    $0x0,%edi
+  804825:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  80482c:	00 00 00 
+  80482f:	ff d0                	call   *%rax
+  804831:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804834:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804838:	0f 88 37 01 00 00    	js     804975 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  80483e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804842:	48 89 c7             	mov    %rax,%rdi
+  804845:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  80484c:	00 00 00 
+  80484f:	ff d0                	call   *%rax
+  804851:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804855:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804859:	48 01 c2             	add    %rax,%rdx
+  80485c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804860:	48 c1 e0 0c          	shl    $0xc,%rax
+  804864:	48 89 c1             	mov    %rax,%rcx
+  804867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80486b:	48 01 c8             	add    %rcx,%rax
+  80486e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804874:	48 89 d1             	mov    %rdx,%rcx
+  804877:	ba 00 00 00 00       	mov    $0x0,%edx
+  80487c:	48 89 c6             	mov    %rax,%rsi
+  80487f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804884:	48 b8 bf 20 80 00 00 	movabs $0x8020bf,%rax
+  80488b:	00 00 00 
+  80488e:	ff d0                	call   *%rax
+  804890:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804893:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804897:	79 0a                	jns    8048a3 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804899:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80489e:	e9 d3 00 00 00       	jmp    804976 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8048a3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8048a8:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8048af:	00 
+  8048b0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8048b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048b8:	48 01 d0             	add    %rdx,%rax
+  8048bb:	48 83 c0 1f          	add    $0x1f,%rax
+  8048bf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8048c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048cc:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8048d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048d4:	48 29 d0             	sub    %rdx,%rax
+  8048d7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8048db:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8048df:	0f 82 21 ff ff ff    	jb     804806 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8048e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8048ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048f1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8048f5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8048f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048fd:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804904:	00 00 00 
+  804907:	8b 12                	mov    (%rdx),%edx
+  804909:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80490b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80490f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804916:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80491a:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804921:	00 00 00 
+  804924:	8b 12                	mov    (%rdx),%edx
+  804926:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804928:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80492c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804933:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804937:	48 89 c7             	mov    %rax,%rdi
+  80493a:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  804941:	00 00 00 
+  804944:	ff d0                	call   *%rax
+  804946:	89 c2                	mov    %eax,%edx
+  804948:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80494c:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80494e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804952:	48 89 c7             	mov    %rax,%rdi
+  804955:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  80495c:	00 00 00 
+  80495f:	ff d0                	call   *%rax
+  804961:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804965:	48 83 c2 04          	add    $0x4,%rdx
+  804969:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80496b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804970:	e9 a5 00 00 00       	jmp    804a1a <pipe_size+0x2ff>
+      goto err2;
+  804975:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804976:	eb 58                	jmp    8049d0 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804980:	48 89 c2             	mov    %rax,%rdx
+  804983:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804987:	48 01 d0             	add    %rdx,%rax
+  80498a:	48 89 c6             	mov    %rax,%rsi
+  80498d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804992:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  804999:	00 00 00 
+  80499c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80499e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049a2:	48 89 c7             	mov    %rax,%rdi
+  8049a5:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  8049ac:	00 00 00 
+  8049af:	ff d0                	call   *%rax
+  8049b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049b5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8049b9:	48 01 d0             	add    %rdx,%rax
+  8049bc:	48 89 c6             	mov    %rax,%rsi
+  8049bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049c4:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8049cb:	00 00 00 
+  8049ce:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8049d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049d4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8049d8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8049dc:	48 85 c0             	test   %rax,%rax
+  8049df:	75 97                	jne    804978 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8049e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049e5:	48 89 c6             	mov    %rax,%rsi
+  8049e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ed:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8049f4:	00 00 00 
+  8049f7:	ff d0                	call   *%rax
+  8049f9:	eb 01                	jmp    8049fc <pipe_size+0x2e1>
+    goto err1;
+  8049fb:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8049fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a00:	48 89 c6             	mov    %rax,%rsi
+  804a03:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a08:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  804a0f:	00 00 00 
+  804a12:	ff d0                	call   *%rax
+  804a14:	eb 01                	jmp    804a17 <pipe_size+0x2fc>
+    goto err;
+  804a16:	90                   	nop
+err:
+  return r;
+  804a17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804a1a:	c9                   	leave
+  804a1b:	c3                   	ret
+
+0000000000804a1c <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804a1c:	55                   	push   %rbp
+  804a1d:	48 89 e5             	mov    %rsp,%rbp
+  804a20:	53                   	push   %rbx
+  804a21:	48 83 ec 28          	sub    $0x28,%rsp
+  804a25:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a29:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804a2d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a34:	00 00 00 
+  804a37:	8b 40 04             	mov    0x4(%rax),%eax
+  804a3a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a3f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804a46:	00 00 00 
+  804a49:	48 98                	cltq
+  804a4b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804a52:	48 01 d0             	add    %rdx,%rax
+  804a55:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804a5b:	8b 00                	mov    (%rax),%eax
+  804a5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804a60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a64:	48 89 c7             	mov    %rax,%rdi
+  804a67:	48 b8 31 5d 80 00 00 	movabs $0x805d31,%rax
+  804a6e:	00 00 00 
+  804a71:	ff d0                	call   *%rax
+  804a73:	89 c3                	mov    %eax,%ebx
+  804a75:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a79:	48 89 c7             	mov    %rax,%rdi
+  804a7c:	48 b8 31 5d 80 00 00 	movabs $0x805d31,%rax
+  804a83:	00 00 00 
+  804a86:	ff d0                	call   *%rax
+  804a88:	39 c3                	cmp    %eax,%ebx
+  804a8a:	0f 94 c0             	sete   %al
+  804a8d:	0f b6 c0             	movzbl %al,%eax
+  804a90:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804a93:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a9a:	00 00 00 
+  804a9d:	8b 40 04             	mov    0x4(%rax),%eax
+  804aa0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804aa5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804aac:	00 00 00 
+  804aaf:	48 98                	cltq
+  804ab1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ab8:	48 01 d0             	add    %rdx,%rax
+  804abb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ac1:	8b 00                	mov    (%rax),%eax
+  804ac3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804ac6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ac9:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804acc:	75 05                	jne    804ad3 <_pipeisclosed+0xb7>
+      return ret;
+  804ace:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ad1:	eb 68                	jmp    804b3b <_pipeisclosed+0x11f>
+    if (n != nn)
+  804ad3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ad6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804ad9:	0f 84 4e ff ff ff    	je     804a2d <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804adf:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ae6:	00 00 00 
+  804ae9:	8b 40 04             	mov    0x4(%rax),%eax
+  804aec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804af1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804af8:	00 00 00 
+  804afb:	48 98                	cltq
+  804afd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b04:	48 01 d0             	add    %rdx,%rax
+  804b07:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b0d:	8b 10                	mov    (%rax),%edx
+  804b0f:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804b12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b15:	89 c6                	mov    %eax,%esi
+  804b17:	48 b8 a0 6b 80 00 00 	movabs $0x806ba0,%rax
+  804b1e:	00 00 00 
+  804b21:	48 89 c7             	mov    %rax,%rdi
+  804b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b29:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  804b30:	00 00 00 
+  804b33:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804b36:	e9 f2 fe ff ff       	jmp    804a2d <_pipeisclosed+0x11>
+  }
+}
+  804b3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b3f:	c9                   	leave
+  804b40:	c3                   	ret
+
+0000000000804b41 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804b41:	55                   	push   %rbp
+  804b42:	48 89 e5             	mov    %rsp,%rbp
+  804b45:	48 83 ec 30          	sub    $0x30,%rsp
+  804b49:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b4c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804b50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b53:	48 89 d6             	mov    %rdx,%rsi
+  804b56:	89 c7                	mov    %eax,%edi
+  804b58:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  804b5f:	00 00 00 
+  804b62:	ff d0                	call   *%rax
+  804b64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b6b:	79 05                	jns    804b72 <pipeisclosed+0x31>
+    return r;
+  804b6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b70:	eb 31                	jmp    804ba3 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804b72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b76:	48 89 c7             	mov    %rax,%rdi
+  804b79:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  804b80:	00 00 00 
+  804b83:	ff d0                	call   *%rax
+  804b85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804b89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b8d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b91:	48 89 d6             	mov    %rdx,%rsi
+  804b94:	48 89 c7             	mov    %rax,%rdi
+  804b97:	48 b8 1c 4a 80 00 00 	movabs $0x804a1c,%rax
+  804b9e:	00 00 00 
+  804ba1:	ff d0                	call   *%rax
+}
+  804ba3:	c9                   	leave
+  804ba4:	c3                   	ret
+
+0000000000804ba5 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804ba5:	55                   	push   %rbp
+  804ba6:	48 89 e5             	mov    %rsp,%rbp
+  804ba9:	48 83 ec 10          	sub    $0x10,%rsp
+  804bad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804bb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bb5:	8b 40 18             	mov    0x18(%rax),%eax
+  804bb8:	8d 50 01             	lea    0x1(%rax),%edx
+  804bbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bbf:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804bc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bc6:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804bc9:	85 c0                	test   %eax,%eax
+  804bcb:	74 27                	je     804bf4 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804bcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bd1:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804bd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bdc:	48 83 c0 18          	add    $0x18,%rax
+  804be0:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804be5:	48 89 c7             	mov    %rax,%rdi
+  804be8:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  804bef:	00 00 00 
+  804bf2:	ff d0                	call   *%rax
+  }
+}
+  804bf4:	90                   	nop
+  804bf5:	c9                   	leave
+  804bf6:	c3                   	ret
+
+0000000000804bf7 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804bf7:	55                   	push   %rbp
+  804bf8:	48 89 e5             	mov    %rsp,%rbp
+  804bfb:	48 83 ec 10          	sub    $0x10,%rsp
+  804bff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c03:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804c06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c0a:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804c11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c15:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804c19:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c1c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804c23:	89 c6                	mov    %eax,%esi
+  804c25:	48 89 cf             	mov    %rcx,%rdi
+  804c28:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  804c2f:	00 00 00 
+  804c32:	ff d0                	call   *%rax
+}
+  804c34:	90                   	nop
+  804c35:	c9                   	leave
+  804c36:	c3                   	ret
+
+0000000000804c37 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c37:	55                   	push   %rbp
+  804c38:	48 89 e5             	mov    %rsp,%rbp
+  804c3b:	48 83 ec 70          	sub    $0x70,%rsp
+  804c3f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804c43:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804c47:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804c4b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c4f:	48 89 c7             	mov    %rax,%rdi
+  804c52:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  804c59:	00 00 00 
+  804c5c:	ff d0                	call   *%rax
+  804c5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804c62:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804c67:	75 0a                	jne    804c73 <devpipe_read+0x3c>
+    return 0;
+  804c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c6e:	e9 63 01 00 00       	jmp    804dd6 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804c73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c77:	8b 40 18             	mov    0x18(%rax),%eax
+  804c7a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804c7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c81:	48 8b 10             	mov    (%rax),%rdx
+  804c84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c8c:	48 39 c2             	cmp    %rax,%rdx
+  804c8f:	75 42                	jne    804cd3 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804c91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c95:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c99:	48 89 d6             	mov    %rdx,%rsi
+  804c9c:	48 89 c7             	mov    %rax,%rdi
+  804c9f:	48 b8 1c 4a 80 00 00 	movabs $0x804a1c,%rax
+  804ca6:	00 00 00 
+  804ca9:	ff d0                	call   *%rax
+  804cab:	85 c0                	test   %eax,%eax
+  804cad:	74 0a                	je     804cb9 <devpipe_read+0x82>
+      return 0;
+  804caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cb4:	e9 1d 01 00 00       	jmp    804dd6 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804cb9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc0:	89 d6                	mov    %edx,%esi
+  804cc2:	48 89 c7             	mov    %rax,%rdi
+  804cc5:	48 b8 f7 4b 80 00 00 	movabs $0x804bf7,%rax
+  804ccc:	00 00 00 
+  804ccf:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804cd1:	eb a0                	jmp    804c73 <devpipe_read+0x3c>
+      break;
+  804cd3:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804cd4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804cd8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804cdc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ce0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804cec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cf0:	48 8b 00             	mov    (%rax),%rax
+  804cf3:	48 29 c2             	sub    %rax,%rdx
+  804cf6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804cfa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804cfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d02:	48 39 c2             	cmp    %rax,%rdx
+  804d05:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d09:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d11:	48 8b 00             	mov    (%rax),%rax
+  804d14:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d18:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d21:	48 f7 f1             	div    %rcx
+  804d24:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804d28:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804d38:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804d3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d40:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d44:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d48:	48 39 c2             	cmp    %rax,%rdx
+  804d4b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d4f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804d53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d57:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804d5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d5f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804d63:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d6b:	48 89 ce             	mov    %rcx,%rsi
+  804d6e:	48 89 c7             	mov    %rax,%rdi
+  804d71:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  804d78:	00 00 00 
+  804d7b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804d7d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d81:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804d85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d89:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804d8d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d91:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d95:	48 01 d1             	add    %rdx,%rcx
+  804d98:	48 89 c2             	mov    %rax,%rdx
+  804d9b:	48 89 cf             	mov    %rcx,%rdi
+  804d9e:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  804da5:	00 00 00 
+  804da8:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dae:	48 8b 10             	mov    (%rax),%rdx
+  804db1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804db5:	48 01 c2             	add    %rax,%rdx
+  804db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dbc:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc3:	48 89 c7             	mov    %rax,%rdi
+  804dc6:	48 b8 a5 4b 80 00 00 	movabs $0x804ba5,%rax
+  804dcd:	00 00 00 
+  804dd0:	ff d0                	call   *%rax
+  return n;
+  804dd2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804dd6:	c9                   	leave
+  804dd7:	c3                   	ret
+
+0000000000804dd8 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804dd8:	55                   	push   %rbp
+  804dd9:	48 89 e5             	mov    %rsp,%rbp
+  804ddc:	48 83 ec 70          	sub    $0x70,%rsp
+  804de0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804de4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804de8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804dec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804df0:	48 89 c7             	mov    %rax,%rdi
+  804df3:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  804dfa:	00 00 00 
+  804dfd:	ff d0                	call   *%rax
+  804dff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804e03:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804e0b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e12:	00 
+  804e13:	e9 b8 01 00 00       	jmp    804fd0 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e1c:	8b 40 18             	mov    0x18(%rax),%eax
+  804e1f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804e22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e26:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e2e:	48 8b 00             	mov    (%rax),%rax
+  804e31:	48 29 c2             	sub    %rax,%rdx
+  804e34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e38:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e3c:	48 39 c2             	cmp    %rax,%rdx
+  804e3f:	75 4d                	jne    804e8e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804e41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e45:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e49:	48 89 d6             	mov    %rdx,%rsi
+  804e4c:	48 89 c7             	mov    %rax,%rdi
+  804e4f:	48 b8 1c 4a 80 00 00 	movabs $0x804a1c,%rax
+  804e56:	00 00 00 
+  804e59:	ff d0                	call   *%rax
+  804e5b:	85 c0                	test   %eax,%eax
+  804e5d:	74 0a                	je     804e69 <devpipe_write+0x91>
+        return 0;
+  804e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e64:	e9 79 01 00 00       	jmp    804fe2 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804e69:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804e6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e70:	89 d6                	mov    %edx,%esi
+  804e72:	48 89 c7             	mov    %rax,%rdi
+  804e75:	48 b8 f7 4b 80 00 00 	movabs $0x804bf7,%rax
+  804e7c:	00 00 00 
+  804e7f:	ff d0                	call   *%rax
+      m = 0;
+  804e81:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804e88:	00 
+      continue;
+  804e89:	e9 3a 01 00 00       	jmp    804fc8 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804e8e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e92:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804e96:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e9e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804ea2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea6:	48 8b 08             	mov    (%rax),%rcx
+  804ea9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ead:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804eb1:	48 29 c1             	sub    %rax,%rcx
+  804eb4:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804eb8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ebc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ec0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec4:	48 39 c2             	cmp    %rax,%rdx
+  804ec7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ecb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804ecf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ed7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804edb:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ee4:	48 f7 f1             	div    %rcx
+  804ee7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804eeb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804eef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804ef3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804efb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804eff:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804f03:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f0b:	48 39 c2             	cmp    %rax,%rdx
+  804f0e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f12:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804f16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f1a:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804f1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f22:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804f26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f2a:	48 01 d1             	add    %rdx,%rcx
+  804f2d:	48 89 c2             	mov    %rax,%rdx
+  804f30:	48 89 cf             	mov    %rcx,%rdi
+  804f33:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  804f3a:	00 00 00 
+  804f3d:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804f3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f43:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f47:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f4b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804f4f:	73 4d                	jae    804f9e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804f51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f55:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f5d:	48 29 c2             	sub    %rax,%rdx
+  804f60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f64:	48 01 c2             	add    %rax,%rdx
+  804f67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f6b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f6f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f73:	48 89 c1             	mov    %rax,%rcx
+  804f76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f7a:	48 01 c1             	add    %rax,%rcx
+  804f7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f81:	48 01 c1             	add    %rax,%rcx
+  804f84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f88:	48 83 c0 20          	add    $0x20,%rax
+  804f8c:	48 89 ce             	mov    %rcx,%rsi
+  804f8f:	48 89 c7             	mov    %rax,%rdi
+  804f92:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  804f99:	00 00 00 
+  804f9c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804f9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804fa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804faa:	48 01 c2             	add    %rax,%rdx
+  804fad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb9:	48 89 c7             	mov    %rax,%rdi
+  804fbc:	48 b8 a5 4b 80 00 00 	movabs $0x804ba5,%rax
+  804fc3:	00 00 00 
+  804fc6:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804fc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fcc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804fd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fd4:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804fd8:	0f 82 3a fe ff ff    	jb     804e18 <devpipe_write+0x40>
+  }
+
+  return i;
+  804fde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804fe2:	c9                   	leave
+  804fe3:	c3                   	ret
+
+0000000000804fe4 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804fe4:	55                   	push   %rbp
+  804fe5:	48 89 e5             	mov    %rsp,%rbp
+  804fe8:	48 83 ec 40          	sub    $0x40,%rsp
+  804fec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ff0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804ff3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ff7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ffb:	48 89 c7             	mov    %rax,%rdi
+  804ffe:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  805005:	00 00 00 
+  805008:	ff d0                	call   *%rax
+  80500a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80500e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805015:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805019:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80501d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805021:	48 89 d6             	mov    %rdx,%rsi
+  805024:	48 89 c7             	mov    %rax,%rdi
+  805027:	48 b8 bf 3c 80 00 00 	movabs $0x803cbf,%rax
+  80502e:	00 00 00 
+  805031:	ff d0                	call   *%rax
+  805033:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805036:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80503a:	79 08                	jns    805044 <devpipe_poll+0x60>
+    return r;
+  80503c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80503f:	e9 85 00 00 00       	jmp    8050c9 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805044:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805047:	83 e0 01             	and    $0x1,%eax
+  80504a:	85 c0                	test   %eax,%eax
+  80504c:	74 18                	je     805066 <devpipe_poll+0x82>
+  80504e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805052:	48 8b 10             	mov    (%rax),%rdx
+  805055:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805059:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80505d:	48 39 c2             	cmp    %rax,%rdx
+  805060:	74 04                	je     805066 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805062:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805066:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805069:	83 e0 02             	and    $0x2,%eax
+  80506c:	85 c0                	test   %eax,%eax
+  80506e:	74 23                	je     805093 <devpipe_poll+0xaf>
+  805070:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805074:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805078:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80507c:	48 8b 00             	mov    (%rax),%rax
+  80507f:	48 29 c2             	sub    %rax,%rdx
+  805082:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805086:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80508a:	48 39 c2             	cmp    %rax,%rdx
+  80508d:	73 04                	jae    805093 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80508f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805093:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805097:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80509b:	48 89 d6             	mov    %rdx,%rsi
+  80509e:	48 89 c7             	mov    %rax,%rdi
+  8050a1:	48 b8 1c 4a 80 00 00 	movabs $0x804a1c,%rax
+  8050a8:	00 00 00 
+  8050ab:	ff d0                	call   *%rax
+  8050ad:	85 c0                	test   %eax,%eax
+  8050af:	74 04                	je     8050b5 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8050b1:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8050b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050b9:	75 0b                	jne    8050c6 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8050bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050bf:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8050c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8050c9:	c9                   	leave
+  8050ca:	c3                   	ret
+
+00000000008050cb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8050cb:	55                   	push   %rbp
+  8050cc:	48 89 e5             	mov    %rsp,%rbp
+  8050cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8050d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050df:	48 89 c7             	mov    %rax,%rdi
+  8050e2:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  8050e9:	00 00 00 
+  8050ec:	ff d0                	call   *%rax
+  8050ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8050f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f6:	48 ba d1 6b 80 00 00 	movabs $0x806bd1,%rdx
+  8050fd:	00 00 00 
+  805100:	48 89 d6             	mov    %rdx,%rsi
+  805103:	48 89 c7             	mov    %rax,%rdi
+  805106:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  80510d:	00 00 00 
+  805110:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805116:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80511a:	89 c1                	mov    %eax,%ecx
+  80511c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805120:	48 8b 00             	mov    (%rax),%rax
+  805123:	89 c2                	mov    %eax,%edx
+  805125:	89 c8                	mov    %ecx,%eax
+  805127:	29 d0                	sub    %edx,%eax
+  805129:	89 c2                	mov    %eax,%edx
+  80512b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80512f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805135:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805139:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805140:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805143:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805147:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  80514e:	00 00 00 
+  805151:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805158:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80515d:	c9                   	leave
+  80515e:	c3                   	ret
+
+000000000080515f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80515f:	55                   	push   %rbp
+  805160:	48 89 e5             	mov    %rsp,%rbp
+  805163:	48 83 ec 40          	sub    $0x40,%rsp
+  805167:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80516b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80516f:	48 89 c7             	mov    %rax,%rdi
+  805172:	48 b8 ec 31 80 00 00 	movabs $0x8031ec,%rax
+  805179:	00 00 00 
+  80517c:	ff d0                	call   *%rax
+  80517e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805182:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805189:	00 
+  80518a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80518e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805196:	48 01 d0             	add    %rdx,%rax
+  805199:	48 83 c0 1f          	add    $0x1f,%rax
+  80519d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8051a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051aa:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8051ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051b2:	48 29 d0             	sub    %rdx,%rax
+  8051b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051b9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8051bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051c1:	48 89 c6             	mov    %rax,%rsi
+  8051c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051c9:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8051d0:	00 00 00 
+  8051d3:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8051d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051d9:	48 89 c7             	mov    %rax,%rdi
+  8051dc:	48 b8 a5 4b 80 00 00 	movabs $0x804ba5,%rax
+  8051e3:	00 00 00 
+  8051e6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8051e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8051f0:	eb 2f                	jmp    805221 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8051f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051f6:	48 83 e8 01          	sub    $0x1,%rax
+  8051fa:	48 c1 e0 0c          	shl    $0xc,%rax
+  8051fe:	48 89 c2             	mov    %rax,%rdx
+  805201:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805205:	48 01 d0             	add    %rdx,%rax
+  805208:	48 89 c6             	mov    %rax,%rsi
+  80520b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805210:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  805217:	00 00 00 
+  80521a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80521c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805221:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805226:	77 ca                	ja     8051f2 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805228:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80522c:	48 89 c6             	mov    %rax,%rsi
+  80522f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805234:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  80523b:	00 00 00 
+  80523e:	ff d0                	call   *%rax
+}
+  805240:	c9                   	leave
+  805241:	c3                   	ret
+
+0000000000805242 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  805242:	55                   	push   %rbp
+  805243:	48 89 e5             	mov    %rsp,%rbp
+  805246:	48 83 ec 10          	sub    $0x10,%rsp
+  80524a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80524e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  805252:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805256:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80525a:	48 89 c7             	mov    %rax,%rdi
+  80525d:	ff d2                	call   *%rdx
+  thread_exit(0);
+  80525f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805264:	48 b8 a6 54 80 00 00 	movabs $0x8054a6,%rax
+  80526b:	00 00 00 
+  80526e:	ff d0                	call   *%rax
+}
+  805270:	90                   	nop
+  805271:	c9                   	leave
+  805272:	c3                   	ret
+
+0000000000805273 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805273:	55                   	push   %rbp
+  805274:	48 89 e5             	mov    %rsp,%rbp
+  805277:	48 83 ec 20          	sub    $0x20,%rsp
+  80527b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  80527e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805281:	c1 e0 10             	shl    $0x10,%eax
+  805284:	48 98                	cltq
+  805286:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  80528b:	48 01 d0             	add    %rdx,%rax
+  80528e:	48 89 c6             	mov    %rax,%rsi
+  805291:	bf 00 00 00 00       	mov    $0x0,%edi
+  805296:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  80529d:	00 00 00 
+  8052a0:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8052a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a5:	83 c0 01             	add    $0x1,%eax
+  8052a8:	c1 e0 10             	shl    $0x10,%eax
+  8052ab:	48 98                	cltq
+  8052ad:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8052b2:	48 01 d0             	add    %rdx,%rax
+  8052b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8052b9:	eb 20                	jmp    8052db <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  8052bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052bf:	48 89 c6             	mov    %rax,%rsi
+  8052c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052c7:	48 b8 1f 21 80 00 00 	movabs $0x80211f,%rax
+  8052ce:	00 00 00 
+  8052d1:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8052d3:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8052da:	00 
+  8052db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052de:	83 c0 01             	add    $0x1,%eax
+  8052e1:	c1 e0 10             	shl    $0x10,%eax
+  8052e4:	48 98                	cltq
+  8052e6:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8052eb:	48 01 d0             	add    %rdx,%rax
+  8052ee:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8052f2:	72 c7                	jb     8052bb <slot_unmap+0x48>
+}
+  8052f4:	90                   	nop
+  8052f5:	90                   	nop
+  8052f6:	c9                   	leave
+  8052f7:	c3                   	ret
+
+00000000008052f8 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  8052f8:	55                   	push   %rbp
+  8052f9:	48 89 e5             	mov    %rsp,%rbp
+  8052fc:	48 83 ec 30          	sub    $0x30,%rsp
+  805300:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805304:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805308:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80530f:	00 00 00 
+  805312:	48 89 c7             	mov    %rax,%rdi
+  805315:	48 b8 54 5f 80 00 00 	movabs $0x805f54,%rax
+  80531c:	00 00 00 
+  80531f:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805321:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805328:	eb 04                	jmp    80532e <thread_create+0x36>
+  80532a:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80532e:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805332:	7f 16                	jg     80534a <thread_create+0x52>
+  805334:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80533b:	00 00 00 
+  80533e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805341:	48 98                	cltq
+  805343:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805346:	85 c0                	test   %eax,%eax
+  805348:	75 e0                	jne    80532a <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  80534a:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  80534e:	75 0c                	jne    80535c <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  805350:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  805357:	e9 2c 01 00 00       	jmp    805488 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  80535c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80535f:	c1 e0 10             	shl    $0x10,%eax
+  805362:	48 98                	cltq
+  805364:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805369:	48 01 d0             	add    %rdx,%rax
+  80536c:	ba 07 00 00 00       	mov    $0x7,%edx
+  805371:	48 89 c6             	mov    %rax,%rsi
+  805374:	bf 00 00 00 00       	mov    $0x0,%edi
+  805379:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  805380:	00 00 00 
+  805383:	ff d0                	call   *%rax
+  805385:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805388:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80538c:	0f 88 f5 00 00 00    	js     805487 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805392:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805395:	83 c0 01             	add    $0x1,%eax
+  805398:	c1 e0 10             	shl    $0x10,%eax
+  80539b:	48 98                	cltq
+  80539d:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8053a2:	48 01 d0             	add    %rdx,%rax
+  8053a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8053a9:	eb 32                	jmp    8053dd <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  8053ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053af:	ba 07 00 00 00       	mov    $0x7,%edx
+  8053b4:	48 89 c6             	mov    %rax,%rsi
+  8053b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053bc:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  8053c3:	00 00 00 
+  8053c6:	ff d0                	call   *%rax
+  8053c8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8053cb:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8053cf:	0f 88 9e 00 00 00    	js     805473 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8053d5:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8053dc:	00 
+  8053dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053e0:	83 c0 01             	add    $0x1,%eax
+  8053e3:	c1 e0 10             	shl    $0x10,%eax
+  8053e6:	48 98                	cltq
+  8053e8:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8053ed:	48 01 d0             	add    %rdx,%rax
+  8053f0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8053f4:	72 b5                	jb     8053ab <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  8053f6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8053fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  8053fe:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805401:	c1 e2 10             	shl    $0x10,%edx
+  805404:	48 63 d2             	movslq %edx,%rdx
+  805407:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  80540c:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80540f:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805412:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805415:	83 c2 01             	add    $0x1,%edx
+  805418:	c1 e2 10             	shl    $0x10,%edx
+  80541b:	48 63 d2             	movslq %edx,%rdx
+  80541e:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805423:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805426:	48 bf 42 52 80 00 00 	movabs $0x805242,%rdi
+  80542d:	00 00 00 
+  805430:	49 89 c8             	mov    %rcx,%r8
+  805433:	48 89 c1             	mov    %rax,%rcx
+  805436:	4c 89 ca             	mov    %r9,%rdx
+  805439:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  805440:	00 00 00 
+  805443:	ff d0                	call   *%rax
+  805445:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805448:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80544c:	79 08                	jns    805456 <thread_create+0x15e>
+    r = id;
+  80544e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805451:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  805454:	eb 1e                	jmp    805474 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  805456:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805459:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80545c:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  805463:	00 00 00 
+  805466:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805469:	48 98                	cltq
+  80546b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80546e:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805471:	eb 15                	jmp    805488 <thread_create+0x190>
+      goto fail;
+  805473:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805474:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805477:	89 c7                	mov    %eax,%edi
+  805479:	48 b8 73 52 80 00 00 	movabs $0x805273,%rax
+  805480:	00 00 00 
+  805483:	ff d0                	call   *%rax
+  805485:	eb 01                	jmp    805488 <thread_create+0x190>
+    goto out;
+  805487:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805488:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80548f:	00 00 00 
+  805492:	48 89 c7             	mov    %rax,%rdi
+  805495:	48 b8 29 60 80 00 00 	movabs $0x806029,%rax
+  80549c:	00 00 00 
+  80549f:	ff d0                	call   *%rax
+  return r;
+  8054a1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8054a4:	c9                   	leave
+  8054a5:	c3                   	ret
+
+00000000008054a6 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  8054a6:	55                   	push   %rbp
+  8054a7:	48 89 e5             	mov    %rsp,%rbp
+  8054aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8054ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  8054b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054b4:	89 c7                	mov    %eax,%edi
+  8054b6:	48 b8 64 25 80 00 00 	movabs $0x802564,%rax
+  8054bd:	00 00 00 
+  8054c0:	ff d0                	call   *%rax
+}
+  8054c2:	90                   	nop
+  8054c3:	c9                   	leave
+  8054c4:	c3                   	ret
+
+00000000008054c5 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  8054c5:	55                   	push   %rbp
+  8054c6:	48 89 e5             	mov    %rsp,%rbp
+  8054c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8054cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  8054d4:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8054db:	00 00 00 
+  8054de:	48 89 c7             	mov    %rax,%rdi
+  8054e1:	48 b8 54 5f 80 00 00 	movabs $0x805f54,%rax
+  8054e8:	00 00 00 
+  8054eb:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  8054ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8054f4:	eb 04                	jmp    8054fa <thread_join+0x35>
+  8054f6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8054fa:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  8054fe:	7f 17                	jg     805517 <thread_join+0x52>
+  805500:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805507:	00 00 00 
+  80550a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80550d:	48 98                	cltq
+  80550f:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805512:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805515:	75 df                	jne    8054f6 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805517:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80551e:	00 00 00 
+  805521:	48 89 c7             	mov    %rax,%rdi
+  805524:	48 b8 29 60 80 00 00 	movabs $0x806029,%rax
+  80552b:	00 00 00 
+  80552e:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805530:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805534:	74 06                	je     80553c <thread_join+0x77>
+  805536:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  80553a:	75 07                	jne    805543 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  80553c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805541:	eb 76                	jmp    8055b9 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  805543:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805547:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80554a:	48 89 d6             	mov    %rdx,%rsi
+  80554d:	89 c7                	mov    %eax,%edi
+  80554f:	48 b8 46 5e 80 00 00 	movabs $0x805e46,%rax
+  805556:	00 00 00 
+  805559:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  80555b:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805562:	00 00 00 
+  805565:	48 89 c7             	mov    %rax,%rdi
+  805568:	48 b8 54 5f 80 00 00 	movabs $0x805f54,%rax
+  80556f:	00 00 00 
+  805572:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805574:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805577:	89 c7                	mov    %eax,%edi
+  805579:	48 b8 73 52 80 00 00 	movabs $0x805273,%rax
+  805580:	00 00 00 
+  805583:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805585:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80558c:	00 00 00 
+  80558f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805592:	48 98                	cltq
+  805594:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  80559b:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8055a2:	00 00 00 
+  8055a5:	48 89 c7             	mov    %rax,%rdi
+  8055a8:	48 b8 29 60 80 00 00 	movabs $0x806029,%rax
+  8055af:	00 00 00 
+  8055b2:	ff d0                	call   *%rax
+  return 0;
+  8055b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055b9:	c9                   	leave
+  8055ba:	c3                   	ret
+
+00000000008055bb <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  8055bb:	55                   	push   %rbp
+  8055bc:	48 89 e5             	mov    %rsp,%rbp
+  8055bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8055c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8055c7:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8055cc:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8055d0:	73 23                	jae    8055f5 <thread_is_uxstack+0x3a>
+  8055d2:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8055d7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8055db:	72 18                	jb     8055f5 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  8055dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055e1:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8055e6:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8055ec:	75 07                	jne    8055f5 <thread_is_uxstack+0x3a>
+  8055ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8055f3:	eb 05                	jmp    8055fa <thread_is_uxstack+0x3f>
+  8055f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055fa:	83 e0 01             	and    $0x1,%eax
+}
+  8055fd:	c9                   	leave
+  8055fe:	c3                   	ret
+
+00000000008055ff <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805607:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80560e:	00 00 00 
+  805611:	8b 40 04             	mov    0x4(%rax),%eax
+  805614:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805619:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805620:	00 00 00 
+  805623:	48 98                	cltq
+  805625:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80562c:	48 01 d0             	add    %rdx,%rax
+  80562f:	48 05 08 01 00 00    	add    $0x108,%rax
+  805635:	48 8b 00             	mov    (%rax),%rax
+  805638:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  80563c:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805641:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805645:	73 0b                	jae    805652 <thread_pftemp+0x53>
+  805647:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80564c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805650:	73 07                	jae    805659 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805652:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805657:	eb 26                	jmp    80567f <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805659:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805660:	ff ff ff 
+  805663:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805667:	48 01 d0             	add    %rdx,%rax
+  80566a:	48 c1 e8 10          	shr    $0x10,%rax
+  80566e:	48 83 c0 01          	add    $0x1,%rax
+  805672:	48 c1 e0 0c          	shl    $0xc,%rax
+  805676:	48 f7 d8             	neg    %rax
+  805679:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  80567f:	c9                   	leave
+  805680:	c3                   	ret
+
+0000000000805681 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805681:	55                   	push   %rbp
+  805682:	48 89 e5             	mov    %rsp,%rbp
+  805685:	48 83 ec 08          	sub    $0x8,%rsp
+  805689:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80568c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805690:	75 10                	jne    8056a2 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805692:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805699:	00 00 00 
+  80569c:	8b 00                	mov    (%rax),%eax
+  80569e:	48 98                	cltq
+  8056a0:	eb 05                	jmp    8056a7 <vsyscall+0x26>
+  }
+  return 0;
+  8056a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056a7:	c9                   	leave
+  8056a8:	c3                   	ret
+
+00000000008056a9 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8056a9:	55                   	push   %rbp
+  8056aa:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8056ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056b2:	48 b8 81 56 80 00 00 	movabs $0x805681,%rax
+  8056b9:	00 00 00 
+  8056bc:	ff d0                	call   *%rax
+}
+  8056be:	5d                   	pop    %rbp
+  8056bf:	c3                   	ret
+
+00000000008056c0 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8056c0:	55                   	push   %rbp
+  8056c1:	48 89 e5             	mov    %rsp,%rbp
+  8056c4:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8056c8:	0f 31                	rdtsc
+  8056ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056cd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8056d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056d3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8056d6:	48 c1 e2 20          	shl    $0x20,%rdx
+  8056da:	48 09 d0             	or     %rdx,%rax
+  8056dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8056e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8056e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8056e9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8056f0:	00 00 00 
+  8056f3:	8b 40 08             	mov    0x8(%rax),%eax
+  8056f6:	48 98                	cltq
+  8056f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8056fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805700:	ba 00 00 00 00       	mov    $0x0,%edx
+  805705:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805709:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805710:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805714:	ba 00 00 00 00       	mov    $0x0,%edx
+  805719:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80571d:	48 89 d0             	mov    %rdx,%rax
+  805720:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805727:	ba 00 00 00 00       	mov    $0x0,%edx
+  80572c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805730:	48 01 c8             	add    %rcx,%rax
+}
+  805733:	c9                   	leave
+  805734:	c3                   	ret
+
+0000000000805735 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805735:	55                   	push   %rbp
+  805736:	48 89 e5             	mov    %rsp,%rbp
+  805739:	48 83 ec 20          	sub    $0x20,%rsp
+  80573d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805740:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805743:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805746:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  80574a:	be 01 00 00 00       	mov    $0x1,%esi
+  80574f:	48 89 c7             	mov    %rax,%rdi
+  805752:	48 b8 50 1e 80 00 00 	movabs $0x801e50,%rax
+  805759:	00 00 00 
+  80575c:	ff d0                	call   *%rax
+}
+  80575e:	90                   	nop
+  80575f:	c9                   	leave
+  805760:	c3                   	ret
+
+0000000000805761 <getchar>:
+
+int
+getchar(void) {
+  805761:	55                   	push   %rbp
+  805762:	48 89 e5             	mov    %rsp,%rbp
+  805765:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805769:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  80576d:	ba 01 00 00 00       	mov    $0x1,%edx
+  805772:	48 89 c6             	mov    %rax,%rsi
+  805775:	bf 00 00 00 00       	mov    $0x0,%edi
+  80577a:	48 b8 55 38 80 00 00 	movabs $0x803855,%rax
+  805781:	00 00 00 
+  805784:	ff d0                	call   *%rax
+  805786:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805789:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80578d:	79 05                	jns    805794 <getchar+0x33>
+    return r;
+  80578f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805792:	eb 14                	jmp    8057a8 <getchar+0x47>
+  if (r < 1)
+  805794:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805798:	7f 07                	jg     8057a1 <getchar+0x40>
+    return -E_EOF;
+  80579a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80579f:	eb 07                	jmp    8057a8 <getchar+0x47>
+  return c;
+  8057a1:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8057a5:	0f b6 c0             	movzbl %al,%eax
+}
+  8057a8:	c9                   	leave
+  8057a9:	c3                   	ret
+
+00000000008057aa <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8057aa:	55                   	push   %rbp
+  8057ab:	48 89 e5             	mov    %rsp,%rbp
+  8057ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8057b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8057b5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8057b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057bc:	48 89 d6             	mov    %rdx,%rsi
+  8057bf:	89 c7                	mov    %eax,%edi
+  8057c1:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  8057c8:	00 00 00 
+  8057cb:	ff d0                	call   *%rax
+  8057cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8057d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057d4:	79 05                	jns    8057db <iscons+0x31>
+    return r;
+  8057d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057d9:	eb 1a                	jmp    8057f5 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8057db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057df:	8b 10                	mov    (%rax),%edx
+  8057e1:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8057e8:	00 00 00 
+  8057eb:	8b 00                	mov    (%rax),%eax
+  8057ed:	39 c2                	cmp    %eax,%edx
+  8057ef:	0f 94 c0             	sete   %al
+  8057f2:	0f b6 c0             	movzbl %al,%eax
+}
+  8057f5:	c9                   	leave
+  8057f6:	c3                   	ret
+
+00000000008057f7 <opencons>:
+
+int
+opencons(void) {
+  8057f7:	55                   	push   %rbp
+  8057f8:	48 89 e5             	mov    %rsp,%rbp
+  8057fb:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8057ff:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805803:	48 89 c7             	mov    %rax,%rdi
+  805806:	48 b8 17 32 80 00 00 	movabs $0x803217,%rax
+  80580d:	00 00 00 
+  805810:	ff d0                	call   *%rax
+  805812:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805815:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805819:	79 05                	jns    805820 <opencons+0x29>
+    return r;
+  80581b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80581e:	eb 66                	jmp    805886 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805820:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805824:	ba 07 04 00 00       	mov    $0x407,%edx
+  805829:	48 89 c6             	mov    %rax,%rsi
+  80582c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805831:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  805838:	00 00 00 
+  80583b:	ff d0                	call   *%rax
+  80583d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805840:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805844:	79 05                	jns    80584b <opencons+0x54>
+    return r;
+  805846:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805849:	eb 3b                	jmp    805886 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  80584b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80584f:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805856:	00 00 00 
+  805859:	8b 12                	mov    (%rdx),%edx
+  80585b:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  80585d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805861:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805868:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80586c:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805873:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805877:	48 89 c7             	mov    %rax,%rdi
+  80587a:	48 b8 c9 31 80 00 00 	movabs $0x8031c9,%rax
+  805881:	00 00 00 
+  805884:	ff d0                	call   *%rax
+}
+  805886:	c9                   	leave
+  805887:	c3                   	ret
+
+0000000000805888 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805888:	55                   	push   %rbp
+  805889:	48 89 e5             	mov    %rsp,%rbp
+  80588c:	48 83 ec 20          	sub    $0x20,%rsp
+  805890:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805893:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805896:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80589a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80589d:	48 89 d6             	mov    %rdx,%rsi
+  8058a0:	89 c7                	mov    %eax,%edi
+  8058a2:	48 b8 f9 32 80 00 00 	movabs $0x8032f9,%rax
+  8058a9:	00 00 00 
+  8058ac:	ff d0                	call   *%rax
+  8058ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058b5:	79 05                	jns    8058bc <consmode+0x34>
+    return r;
+  8058b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058ba:	eb 34                	jmp    8058f0 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8058bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058c0:	8b 10                	mov    (%rax),%edx
+  8058c2:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8058c9:	00 00 00 
+  8058cc:	8b 00                	mov    (%rax),%eax
+  8058ce:	39 c2                	cmp    %eax,%edx
+  8058d0:	74 07                	je     8058d9 <consmode+0x51>
+    return -E_INVAL;
+  8058d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8058d7:	eb 17                	jmp    8058f0 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8058d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058dd:	8b 40 0c             	mov    0xc(%rax),%eax
+  8058e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8058e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058e7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8058ea:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8058ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8058f0:	c9                   	leave
+  8058f1:	c3                   	ret
+
+00000000008058f2 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8058f2:	55                   	push   %rbp
+  8058f3:	48 89 e5             	mov    %rsp,%rbp
+  8058f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8058fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8058fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805902:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80590a:	8b 50 0c             	mov    0xc(%rax),%edx
+  80590d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805911:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805915:	48 89 ce             	mov    %rcx,%rsi
+  805918:	48 89 c7             	mov    %rax,%rdi
+  80591b:	48 b8 c1 23 80 00 00 	movabs $0x8023c1,%rax
+  805922:	00 00 00 
+  805925:	ff d0                	call   *%rax
+  805927:	48 98                	cltq
+}
+  805929:	c9                   	leave
+  80592a:	c3                   	ret
+
+000000000080592b <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80592b:	55                   	push   %rbp
+  80592c:	48 89 e5             	mov    %rsp,%rbp
+  80592f:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805936:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  80593d:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805944:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  80594b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805952:	eb 74                	jmp    8059c8 <devcons_write+0x9d>
+    m = n - tot;
+  805954:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80595b:	89 c2                	mov    %eax,%edx
+  80595d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805960:	29 c2                	sub    %eax,%edx
+  805962:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805965:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805968:	83 f8 7f             	cmp    $0x7f,%eax
+  80596b:	76 07                	jbe    805974 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  80596d:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805974:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805977:	48 63 d0             	movslq %eax,%rdx
+  80597a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80597d:	48 63 c8             	movslq %eax,%rcx
+  805980:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805987:	48 01 c1             	add    %rax,%rcx
+  80598a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805991:	48 89 ce             	mov    %rcx,%rsi
+  805994:	48 89 c7             	mov    %rax,%rdi
+  805997:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  80599e:	00 00 00 
+  8059a1:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8059a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059a6:	48 63 d0             	movslq %eax,%rdx
+  8059a9:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8059b0:	48 89 d6             	mov    %rdx,%rsi
+  8059b3:	48 89 c7             	mov    %rax,%rdi
+  8059b6:	48 b8 50 1e 80 00 00 	movabs $0x801e50,%rax
+  8059bd:	00 00 00 
+  8059c0:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  8059c2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059c5:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8059c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059cb:	48 98                	cltq
+  8059cd:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8059d4:	0f 82 7a ff ff ff    	jb     805954 <devcons_write+0x29>
+  }
+  return tot;
+  8059da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059dd:	48 98                	cltq
+}
+  8059df:	c9                   	leave
+  8059e0:	c3                   	ret
+
+00000000008059e1 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8059e1:	55                   	push   %rbp
+  8059e2:	48 89 e5             	mov    %rsp,%rbp
+  8059e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8059e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8059ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059f2:	c9                   	leave
+  8059f3:	c3                   	ret
+
+00000000008059f4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8059f4:	55                   	push   %rbp
+  8059f5:	48 89 e5             	mov    %rsp,%rbp
+  8059f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8059fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805a04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a08:	48 ba dd 6b 80 00 00 	movabs $0x806bdd,%rdx
+  805a0f:	00 00 00 
+  805a12:	48 89 d6             	mov    %rdx,%rsi
+  805a15:	48 89 c7             	mov    %rax,%rdi
+  805a18:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  805a1f:	00 00 00 
+  805a22:	ff d0                	call   *%rax
+  return 0;
+  805a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a29:	c9                   	leave
+  805a2a:	c3                   	ret
+
+0000000000805a2b <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805a2b:	55                   	push   %rbp
+  805a2c:	48 89 e5             	mov    %rsp,%rbp
+  805a2f:	48 83 ec 30          	sub    $0x30,%rsp
+  805a33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a37:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805a3a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805a3e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805a45:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805a48:	83 e0 02             	and    $0x2,%eax
+  805a4b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805a4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a52:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a55:	83 f8 01             	cmp    $0x1,%eax
+  805a58:	75 04                	jne    805a5e <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805a5a:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805a5e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805a61:	83 e0 01             	and    $0x1,%eax
+  805a64:	85 c0                	test   %eax,%eax
+  805a66:	74 44                	je     805aac <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805a70:	89 c2                	mov    %eax,%edx
+  805a72:	be 00 00 00 00       	mov    $0x0,%esi
+  805a77:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a7c:	48 b8 af 24 80 00 00 	movabs $0x8024af,%rax
+  805a83:	00 00 00 
+  805a86:	ff d0                	call   *%rax
+  805a88:	83 f8 01             	cmp    $0x1,%eax
+  805a8b:	75 06                	jne    805a93 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805a8d:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805a91:	eb 19                	jmp    805aac <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805a93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a97:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805a9d:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805aa0:	89 c2                	mov    %eax,%edx
+  805aa2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805aa6:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805aac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805aaf:	c9                   	leave
+  805ab0:	c3                   	ret
+
+0000000000805ab1 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805ab1:	55                   	push   %rbp
+  805ab2:	48 89 e5             	mov    %rsp,%rbp
+  805ab5:	53                   	push   %rbx
+  805ab6:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805abd:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  805ac4:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  805aca:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  805ad1:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  805ad8:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  805adf:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  805ae6:	84 c0                	test   %al,%al
+  805ae8:	74 23                	je     805b0d <_panic+0x5c>
+  805aea:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  805af1:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  805af5:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  805af9:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  805afd:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  805b01:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  805b05:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  805b09:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  805b0d:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  805b14:	00 00 00 
+  805b17:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  805b1e:	00 00 00 
+  805b21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805b25:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  805b2c:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  805b33:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  805b3a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  805b41:	00 00 00 
+  805b44:	48 8b 18             	mov    (%rax),%rbx
+  805b47:	48 b8 ee 1f 80 00 00 	movabs $0x801fee,%rax
+  805b4e:	00 00 00 
+  805b51:	ff d0                	call   *%rax
+  805b53:	89 c6                	mov    %eax,%esi
+  805b55:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  805b5b:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  805b62:	41 89 d0             	mov    %edx,%r8d
+  805b65:	48 89 c1             	mov    %rax,%rcx
+  805b68:	48 89 da             	mov    %rbx,%rdx
+  805b6b:	48 b8 e8 6b 80 00 00 	movabs $0x806be8,%rax
+  805b72:	00 00 00 
+  805b75:	48 89 c7             	mov    %rax,%rdi
+  805b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b7d:	49 b9 e9 02 80 00 00 	movabs $0x8002e9,%r9
+  805b84:	00 00 00 
+  805b87:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  805b8a:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  805b91:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805b98:	48 89 d6             	mov    %rdx,%rsi
+  805b9b:	48 89 c7             	mov    %rax,%rdi
+  805b9e:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  805ba5:	00 00 00 
+  805ba8:	ff d0                	call   *%rax
+  cprintf("\n");
+  805baa:	48 b8 0b 6c 80 00 00 	movabs $0x806c0b,%rax
+  805bb1:	00 00 00 
+  805bb4:	48 89 c7             	mov    %rax,%rdi
+  805bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bbc:	48 ba e9 02 80 00 00 	movabs $0x8002e9,%rdx
+  805bc3:	00 00 00 
+  805bc6:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805bc8:	cc                   	int3
+  805bc9:	eb fd                	jmp    805bc8 <_panic+0x117>
+
+0000000000805bcb <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805bcb:	55                   	push   %rbp
+  805bcc:	48 89 e5             	mov    %rsp,%rbp
+  805bcf:	48 83 ec 20          	sub    $0x20,%rsp
+  805bd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805bd7:	48 b8 ee 1f 80 00 00 	movabs $0x801fee,%rax
+  805bde:	00 00 00 
+  805be1:	ff d0                	call   *%rax
+  805be3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805be6:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805bed:	00 00 00 
+  805bf0:	48 8b 00             	mov    (%rax),%rax
+  805bf3:	48 85 c0             	test   %rax,%rax
+  805bf6:	75 62                	jne    805c5a <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805bf8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bfb:	ba 07 00 00 00       	mov    $0x7,%edx
+  805c00:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805c07:	00 00 00 
+  805c0a:	48 89 ce             	mov    %rcx,%rsi
+  805c0d:	89 c7                	mov    %eax,%edi
+  805c0f:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  805c16:	00 00 00 
+  805c19:	ff d0                	call   *%rax
+  805c1b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805c1e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c22:	79 36                	jns    805c5a <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805c24:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c27:	89 c1                	mov    %eax,%ecx
+  805c29:	48 b8 0d 6c 80 00 00 	movabs $0x806c0d,%rax
+  805c30:	00 00 00 
+  805c33:	48 89 c2             	mov    %rax,%rdx
+  805c36:	be 23 00 00 00       	mov    $0x23,%esi
+  805c3b:	48 b8 25 6c 80 00 00 	movabs $0x806c25,%rax
+  805c42:	00 00 00 
+  805c45:	48 89 c7             	mov    %rax,%rdi
+  805c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c4d:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  805c54:	00 00 00 
+  805c57:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805c5a:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  805c61:	00 00 00 
+  805c64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c68:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805c6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c6e:	48 ba cb 5c 80 00 00 	movabs $0x805ccb,%rdx
+  805c75:	00 00 00 
+  805c78:	48 89 d6             	mov    %rdx,%rsi
+  805c7b:	89 c7                	mov    %eax,%edi
+  805c7d:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  805c84:	00 00 00 
+  805c87:	ff d0                	call   *%rax
+  805c89:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805c8c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c90:	79 36                	jns    805cc8 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805c92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c95:	89 c1                	mov    %eax,%ecx
+  805c97:	48 b8 0d 6c 80 00 00 	movabs $0x806c0d,%rax
+  805c9e:	00 00 00 
+  805ca1:	48 89 c2             	mov    %rax,%rdx
+  805ca4:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805ca9:	48 b8 25 6c 80 00 00 	movabs $0x806c25,%rax
+  805cb0:	00 00 00 
+  805cb3:	48 89 c7             	mov    %rax,%rdi
+  805cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cbb:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  805cc2:	00 00 00 
+  805cc5:	41 ff d0             	call   *%r8
+}
+  805cc8:	90                   	nop
+  805cc9:	c9                   	leave
+  805cca:	c3                   	ret
+
+0000000000805ccb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805ccb:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805cce:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805cd1:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805cd8:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805cdc:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805ce1:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805ce8:	00 00 00 
+	call *%rax
+  805ceb:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805ced:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805cf2:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805cf5:	41 5f                	pop    %r15
+	popq %r15
+  805cf7:	41 5f                	pop    %r15
+	popq %r15
+  805cf9:	41 5f                	pop    %r15
+	popq %r14
+  805cfb:	41 5e                	pop    %r14
+	popq %r13
+  805cfd:	41 5d                	pop    %r13
+	popq %r12
+  805cff:	41 5c                	pop    %r12
+	popq %r11
+  805d01:	41 5b                	pop    %r11
+	popq %r10
+  805d03:	41 5a                	pop    %r10
+	popq %r9
+  805d05:	41 59                	pop    %r9
+	popq %r8
+  805d07:	41 58                	pop    %r8
+	popq %rsi
+  805d09:	5e                   	pop    %rsi
+	popq %rdi
+  805d0a:	5f                   	pop    %rdi
+	popq %rbp
+  805d0b:	5d                   	pop    %rbp
+	popq %rdx
+  805d0c:	5a                   	pop    %rdx
+	popq %rcx
+  805d0d:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805d0e:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805d13:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805d18:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805d1c:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805d1f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805d24:	5b                   	pop    %rbx
+	popq %rax
+  805d25:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805d26:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805d2a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805d2b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805d30:	c3                   	ret
+
+0000000000805d31 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805d31:	55                   	push   %rbp
+  805d32:	48 89 e5             	mov    %rsp,%rbp
+  805d35:	48 83 ec 18          	sub    $0x18,%rsp
+  805d39:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805d3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d41:	48 c1 e8 27          	shr    $0x27,%rax
+  805d45:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d4a:	48 89 c2             	mov    %rax,%rdx
+  805d4d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805d54:	01 00 00 
+  805d57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d5b:	83 e0 01             	and    $0x1,%eax
+  805d5e:	48 85 c0             	test   %rax,%rax
+  805d61:	74 63                	je     805dc6 <pageref+0x95>
+  805d63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d67:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805d6b:	48 89 c2             	mov    %rax,%rdx
+  805d6e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805d75:	01 00 00 
+  805d78:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d7c:	83 e0 01             	and    $0x1,%eax
+  805d7f:	48 85 c0             	test   %rax,%rax
+  805d82:	74 42                	je     805dc6 <pageref+0x95>
+  805d84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d88:	48 c1 e8 15          	shr    $0x15,%rax
+  805d8c:	48 89 c2             	mov    %rax,%rdx
+  805d8f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805d96:	01 00 00 
+  805d99:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d9d:	83 e0 01             	and    $0x1,%eax
+  805da0:	48 85 c0             	test   %rax,%rax
+  805da3:	74 21                	je     805dc6 <pageref+0x95>
+  805da5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805da9:	48 c1 e8 0c          	shr    $0xc,%rax
+  805dad:	48 89 c2             	mov    %rax,%rdx
+  805db0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805db7:	01 00 00 
+  805dba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dbe:	83 e0 01             	and    $0x1,%eax
+  805dc1:	48 85 c0             	test   %rax,%rax
+  805dc4:	75 07                	jne    805dcd <pageref+0x9c>
+    return 0;
+  805dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dcb:	eb 53                	jmp    805e20 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805dcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd1:	48 c1 e8 0c          	shr    $0xc,%rax
+  805dd5:	48 89 c2             	mov    %rax,%rdx
+  805dd8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805ddf:	01 00 00 
+  805de2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805de6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805dea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805dee:	83 e0 01             	and    $0x1,%eax
+  805df1:	48 85 c0             	test   %rax,%rax
+  805df4:	75 07                	jne    805dfd <pageref+0xcc>
+    return 0;
+  805df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dfb:	eb 23                	jmp    805e20 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805dfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e01:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e05:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e0c:	00 00 00 
+  805e0f:	48 c1 e0 04          	shl    $0x4,%rax
+  805e13:	48 01 d0             	add    %rdx,%rax
+  805e16:	48 83 c0 08          	add    $0x8,%rax
+  805e1a:	0f b7 00             	movzwl (%rax),%eax
+  805e1d:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e20:	c9                   	leave
+  805e21:	c3                   	ret
+
+0000000000805e22 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805e22:	55                   	push   %rbp
+  805e23:	48 89 e5             	mov    %rsp,%rbp
+  805e26:	48 83 ec 10          	sub    $0x10,%rsp
+  805e2a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805e2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e30:	be 00 00 00 00       	mov    $0x0,%esi
+  805e35:	89 c7                	mov    %eax,%edi
+  805e37:	48 b8 46 5e 80 00 00 	movabs $0x805e46,%rax
+  805e3e:	00 00 00 
+  805e41:	ff d0                	call   *%rax
+}
+  805e43:	90                   	nop
+  805e44:	c9                   	leave
+  805e45:	c3                   	ret
+
+0000000000805e46 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805e46:	55                   	push   %rbp
+  805e47:	48 89 e5             	mov    %rsp,%rbp
+  805e4a:	48 83 ec 10          	sub    $0x10,%rsp
+  805e4e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805e51:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805e55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e59:	75 3e                	jne    805e99 <waitpid+0x53>
+  805e5b:	48 b8 33 6c 80 00 00 	movabs $0x806c33,%rax
+  805e62:	00 00 00 
+  805e65:	48 89 c1             	mov    %rax,%rcx
+  805e68:	48 b8 3e 6c 80 00 00 	movabs $0x806c3e,%rax
+  805e6f:	00 00 00 
+  805e72:	48 89 c2             	mov    %rax,%rdx
+  805e75:	be 0e 00 00 00       	mov    $0xe,%esi
+  805e7a:	48 b8 53 6c 80 00 00 	movabs $0x806c53,%rax
+  805e81:	00 00 00 
+  805e84:	48 89 c7             	mov    %rax,%rdi
+  805e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e8c:	49 b8 b1 5a 80 00 00 	movabs $0x805ab1,%r8
+  805e93:	00 00 00 
+  805e96:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805e99:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805e9e:	74 0a                	je     805eaa <waitpid+0x64>
+    *status = 0;
+  805ea0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ea4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805eaa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805eae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eb1:	48 89 d6             	mov    %rdx,%rsi
+  805eb4:	89 c7                	mov    %eax,%edi
+  805eb6:	48 b8 66 1f 80 00 00 	movabs $0x801f66,%rax
+  805ebd:	00 00 00 
+  805ec0:	ff d0                	call   *%rax
+}
+  805ec2:	c9                   	leave
+  805ec3:	c3                   	ret
+
+0000000000805ec4 <xchg>:
+  805ec4:	55                   	push   %rbp
+  805ec5:	48 89 e5             	mov    %rsp,%rbp
+  805ec8:	48 83 ec 20          	sub    $0x20,%rsp
+  805ecc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ed0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ed3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ed7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805eda:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ede:	f0 87 02             	lock xchg %eax,(%rdx)
+  805ee1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ee4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ee7:	c9                   	leave
+  805ee8:	c3                   	ret
+
+0000000000805ee9 <cmpxchg>:
+  805ee9:	55                   	push   %rbp
+  805eea:	48 89 e5             	mov    %rsp,%rbp
+  805eed:	48 83 ec 20          	sub    $0x20,%rsp
+  805ef1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ef5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ef8:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805efb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805eff:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805f02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f05:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f09:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805f0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f13:	c9                   	leave
+  805f14:	c3                   	ret
+
+0000000000805f15 <xadd>:
+  805f15:	55                   	push   %rbp
+  805f16:	48 89 e5             	mov    %rsp,%rbp
+  805f19:	48 83 ec 10          	sub    $0x10,%rsp
+  805f1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f21:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805f24:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805f28:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f2f:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805f33:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  805f36:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f39:	c9                   	leave
+  805f3a:	c3                   	ret
+
+0000000000805f3b <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805f3b:	55                   	push   %rbp
+  805f3c:	48 89 e5             	mov    %rsp,%rbp
+  805f3f:	48 83 ec 08          	sub    $0x8,%rsp
+  805f43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  805f47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f4b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805f51:	90                   	nop
+  805f52:	c9                   	leave
+  805f53:	c3                   	ret
+
+0000000000805f54 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805f54:	55                   	push   %rbp
+  805f55:	48 89 e5             	mov    %rsp,%rbp
+  805f58:	48 83 ec 20          	sub    $0x20,%rsp
+  805f5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805f60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f64:	ba 01 00 00 00       	mov    $0x1,%edx
+  805f69:	be 00 00 00 00       	mov    $0x0,%esi
+  805f6e:	48 89 c7             	mov    %rax,%rdi
+  805f71:	48 b8 e9 5e 80 00 00 	movabs $0x805ee9,%rax
+  805f78:	00 00 00 
+  805f7b:	ff d0                	call   *%rax
+  805f7d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f80:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f84:	74 65                	je     805feb <mutex_lock+0x97>
+  if (c != 2)
+  805f86:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  805f8a:	74 57                	je     805fe3 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  805f8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f90:	be 02 00 00 00       	mov    $0x2,%esi
+  805f95:	48 89 c7             	mov    %rax,%rdi
+  805f98:	48 b8 c4 5e 80 00 00 	movabs $0x805ec4,%rax
+  805f9f:	00 00 00 
+  805fa2:	ff d0                	call   *%rax
+  805fa4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805fa7:	eb 3a                	jmp    805fe3 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  805fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fad:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805fb4:	be 02 00 00 00       	mov    $0x2,%esi
+  805fb9:	48 89 c7             	mov    %rax,%rdi
+  805fbc:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  805fc3:	00 00 00 
+  805fc6:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  805fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fcc:	be 02 00 00 00       	mov    $0x2,%esi
+  805fd1:	48 89 c7             	mov    %rax,%rdi
+  805fd4:	48 b8 c4 5e 80 00 00 	movabs $0x805ec4,%rax
+  805fdb:	00 00 00 
+  805fde:	ff d0                	call   *%rax
+  805fe0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805fe3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fe7:	75 c0                	jne    805fa9 <mutex_lock+0x55>
+  805fe9:	eb 01                	jmp    805fec <mutex_lock+0x98>
+    return;
+  805feb:	90                   	nop
+}
+  805fec:	c9                   	leave
+  805fed:	c3                   	ret
+
+0000000000805fee <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  805fee:	55                   	push   %rbp
+  805fef:	48 89 e5             	mov    %rsp,%rbp
+  805ff2:	48 83 ec 08          	sub    $0x8,%rsp
+  805ff6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  805ffa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ffe:	ba 01 00 00 00       	mov    $0x1,%edx
+  806003:	be 00 00 00 00       	mov    $0x0,%esi
+  806008:	48 89 c7             	mov    %rax,%rdi
+  80600b:	48 b8 e9 5e 80 00 00 	movabs $0x805ee9,%rax
+  806012:	00 00 00 
+  806015:	ff d0                	call   *%rax
+  806017:	85 c0                	test   %eax,%eax
+  806019:	75 07                	jne    806022 <mutex_trylock+0x34>
+  80601b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806020:	eb 05                	jmp    806027 <mutex_trylock+0x39>
+  806022:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806027:	c9                   	leave
+  806028:	c3                   	ret
+
+0000000000806029 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806029:	55                   	push   %rbp
+  80602a:	48 89 e5             	mov    %rsp,%rbp
+  80602d:	48 83 ec 10          	sub    $0x10,%rsp
+  806031:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806035:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806039:	be 00 00 00 00       	mov    $0x0,%esi
+  80603e:	48 89 c7             	mov    %rax,%rdi
+  806041:	48 b8 c4 5e 80 00 00 	movabs $0x805ec4,%rax
+  806048:	00 00 00 
+  80604b:	ff d0                	call   *%rax
+  80604d:	83 f8 02             	cmp    $0x2,%eax
+  806050:	75 18                	jne    80606a <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806052:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806056:	be 01 00 00 00       	mov    $0x1,%esi
+  80605b:	48 89 c7             	mov    %rax,%rdi
+  80605e:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  806065:	00 00 00 
+  806068:	ff d0                	call   *%rax
+}
+  80606a:	90                   	nop
+  80606b:	c9                   	leave
+  80606c:	c3                   	ret
+
+000000000080606d <cond_init>:
+cond_init(struct Cond *c) {
+  80606d:	55                   	push   %rbp
+  80606e:	48 89 e5             	mov    %rsp,%rbp
+  806071:	48 83 ec 08          	sub    $0x8,%rsp
+  806075:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806079:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80607d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806083:	90                   	nop
+  806084:	c9                   	leave
+  806085:	c3                   	ret
+
+0000000000806086 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  806086:	55                   	push   %rbp
+  806087:	48 89 e5             	mov    %rsp,%rbp
+  80608a:	48 83 ec 30          	sub    $0x30,%rsp
+  80608e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806092:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806096:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  80609a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80609e:	8b 00                	mov    (%rax),%eax
+  8060a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8060a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060a7:	48 89 c7             	mov    %rax,%rdi
+  8060aa:	48 b8 29 60 80 00 00 	movabs $0x806029,%rax
+  8060b1:	00 00 00 
+  8060b4:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8060b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8060be:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8060c1:	89 ce                	mov    %ecx,%esi
+  8060c3:	48 89 c7             	mov    %rax,%rdi
+  8060c6:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  8060cd:	00 00 00 
+  8060d0:	ff d0                	call   *%rax
+  8060d2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8060d5:	eb 1f                	jmp    8060f6 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8060d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060db:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8060e2:	be 02 00 00 00       	mov    $0x2,%esi
+  8060e7:	48 89 c7             	mov    %rax,%rdi
+  8060ea:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  8060f1:	00 00 00 
+  8060f4:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8060f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060fa:	be 02 00 00 00       	mov    $0x2,%esi
+  8060ff:	48 89 c7             	mov    %rax,%rdi
+  806102:	48 b8 c4 5e 80 00 00 	movabs $0x805ec4,%rax
+  806109:	00 00 00 
+  80610c:	ff d0                	call   *%rax
+  80610e:	85 c0                	test   %eax,%eax
+  806110:	75 c5                	jne    8060d7 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806112:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806116:	75 07                	jne    80611f <cond_timedwait+0x99>
+  806118:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80611d:	eb 05                	jmp    806124 <cond_timedwait+0x9e>
+  80611f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806124:	c9                   	leave
+  806125:	c3                   	ret
+
+0000000000806126 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806126:	55                   	push   %rbp
+  806127:	48 89 e5             	mov    %rsp,%rbp
+  80612a:	48 83 ec 10          	sub    $0x10,%rsp
+  80612e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806132:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806136:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80613a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80613e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806145:	48 89 ce             	mov    %rcx,%rsi
+  806148:	48 89 c7             	mov    %rax,%rdi
+  80614b:	48 b8 86 60 80 00 00 	movabs $0x806086,%rax
+  806152:	00 00 00 
+  806155:	ff d0                	call   *%rax
+}
+  806157:	90                   	nop
+  806158:	c9                   	leave
+  806159:	c3                   	ret
+
+000000000080615a <cond_signal>:
+cond_signal(struct Cond *c) {
+  80615a:	55                   	push   %rbp
+  80615b:	48 89 e5             	mov    %rsp,%rbp
+  80615e:	48 83 ec 10          	sub    $0x10,%rsp
+  806162:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806166:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80616a:	be 01 00 00 00       	mov    $0x1,%esi
+  80616f:	48 89 c7             	mov    %rax,%rdi
+  806172:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  806179:	00 00 00 
+  80617c:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  80617e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806182:	be 01 00 00 00       	mov    $0x1,%esi
+  806187:	48 89 c7             	mov    %rax,%rdi
+  80618a:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  806191:	00 00 00 
+  806194:	ff d0                	call   *%rax
+}
+  806196:	90                   	nop
+  806197:	c9                   	leave
+  806198:	c3                   	ret
+
+0000000000806199 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  806199:	55                   	push   %rbp
+  80619a:	48 89 e5             	mov    %rsp,%rbp
+  80619d:	48 83 ec 10          	sub    $0x10,%rsp
+  8061a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8061a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8061ae:	48 89 c7             	mov    %rax,%rdi
+  8061b1:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  8061b8:	00 00 00 
+  8061bb:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8061bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061c1:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8061c6:	48 89 c7             	mov    %rax,%rdi
+  8061c9:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  8061d0:	00 00 00 
+  8061d3:	ff d0                	call   *%rax
+}
+  8061d5:	90                   	nop
+  8061d6:	c9                   	leave
+  8061d7:	c3                   	ret
+
+00000000008061d8 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8061d8:	55                   	push   %rbp
+  8061d9:	48 89 e5             	mov    %rsp,%rbp
+  8061dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8061e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8061e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8061e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061eb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061ee:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8061f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061f4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8061fb:	90                   	nop
+  8061fc:	c9                   	leave
+  8061fd:	c3                   	ret
+
+00000000008061fe <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8061fe:	55                   	push   %rbp
+  8061ff:	48 89 e5             	mov    %rsp,%rbp
+  806202:	48 83 ec 18          	sub    $0x18,%rsp
+  806206:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80620a:	eb 2a                	jmp    806236 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80620c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80620f:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806212:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806216:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806219:	89 ce                	mov    %ecx,%esi
+  80621b:	48 89 c7             	mov    %rax,%rdi
+  80621e:	48 b8 e9 5e 80 00 00 	movabs $0x805ee9,%rax
+  806225:	00 00 00 
+  806228:	ff d0                	call   *%rax
+  80622a:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80622d:	75 07                	jne    806236 <sem_trywait+0x38>
+      return 0;
+  80622f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806234:	eb 14                	jmp    80624a <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80623a:	8b 00                	mov    (%rax),%eax
+  80623c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80623f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806243:	75 c7                	jne    80620c <sem_trywait+0xe>
+  return -E_BUSY;
+  806245:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80624a:	c9                   	leave
+  80624b:	c3                   	ret
+
+000000000080624c <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  80624c:	55                   	push   %rbp
+  80624d:	48 89 e5             	mov    %rsp,%rbp
+  806250:	48 83 ec 30          	sub    $0x30,%rsp
+  806254:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806258:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  80625c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806263:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  806264:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806269:	0f 84 fb 00 00 00    	je     80636a <sem_timedwait+0x11e>
+  80626f:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806274:	0f 84 f0 00 00 00    	je     80636a <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80627a:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  806281:	00 00 00 
+  806284:	ff d0                	call   *%rax
+  806286:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80628a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80628e:	48 f7 d0             	not    %rax
+  806291:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  806295:	73 0d                	jae    8062a4 <sem_timedwait+0x58>
+  806297:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80629b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80629f:	48 01 d0             	add    %rdx,%rax
+  8062a2:	eb 07                	jmp    8062ab <sem_timedwait+0x5f>
+  8062a4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8062ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8062af:	e9 b6 00 00 00       	jmp    80636a <sem_timedwait+0x11e>
+    if (deadline) {
+  8062b4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8062b9:	74 2d                	je     8062e8 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8062bb:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  8062c2:	00 00 00 
+  8062c5:	ff d0                	call   *%rax
+  8062c7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8062cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062cf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8062d3:	73 0a                	jae    8062df <sem_timedwait+0x93>
+  8062d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062d9:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8062dd:	eb 05                	jmp    8062e4 <sem_timedwait+0x98>
+  8062df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062e4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8062e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062ec:	48 83 c0 04          	add    $0x4,%rax
+  8062f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8062f5:	48 89 c7             	mov    %rax,%rdi
+  8062f8:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  8062ff:	00 00 00 
+  806302:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806304:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806308:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80630c:	be 00 00 00 00       	mov    $0x0,%esi
+  806311:	48 89 c7             	mov    %rax,%rdi
+  806314:	48 b8 13 24 80 00 00 	movabs $0x802413,%rax
+  80631b:	00 00 00 
+  80631e:	ff d0                	call   *%rax
+  806320:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806323:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806327:	48 83 c0 04          	add    $0x4,%rax
+  80632b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806330:	48 89 c7             	mov    %rax,%rdi
+  806333:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  80633a:	00 00 00 
+  80633d:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  80633f:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  806343:	75 25                	jne    80636a <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  806345:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806349:	48 89 c7             	mov    %rax,%rdi
+  80634c:	48 b8 fe 61 80 00 00 	movabs $0x8061fe,%rax
+  806353:	00 00 00 
+  806356:	ff d0                	call   *%rax
+  806358:	85 c0                	test   %eax,%eax
+  80635a:	79 07                	jns    806363 <sem_timedwait+0x117>
+  80635c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806361:	eb 27                	jmp    80638a <sem_timedwait+0x13e>
+  806363:	b8 00 00 00 00       	mov    $0x0,%eax
+  806368:	eb 20                	jmp    80638a <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80636a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80636e:	48 89 c7             	mov    %rax,%rdi
+  806371:	48 b8 fe 61 80 00 00 	movabs $0x8061fe,%rax
+  806378:	00 00 00 
+  80637b:	ff d0                	call   *%rax
+  80637d:	85 c0                	test   %eax,%eax
+  80637f:	0f 88 2f ff ff ff    	js     8062b4 <sem_timedwait+0x68>
+  return 0;
+  806385:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80638a:	c9                   	leave
+  80638b:	c3                   	ret
+
+000000000080638c <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  80638c:	55                   	push   %rbp
+  80638d:	48 89 e5             	mov    %rsp,%rbp
+  806390:	48 83 ec 10          	sub    $0x10,%rsp
+  806394:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  806398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80639c:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8063a3:	48 89 c7             	mov    %rax,%rdi
+  8063a6:	48 b8 4c 62 80 00 00 	movabs $0x80624c,%rax
+  8063ad:	00 00 00 
+  8063b0:	ff d0                	call   *%rax
+}
+  8063b2:	90                   	nop
+  8063b3:	c9                   	leave
+  8063b4:	c3                   	ret
+
+00000000008063b5 <sem_post>:
+sem_post(struct Semaphore *s) {
+  8063b5:	55                   	push   %rbp
+  8063b6:	48 89 e5             	mov    %rsp,%rbp
+  8063b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8063bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8063c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8063ca:	48 89 c7             	mov    %rax,%rdi
+  8063cd:	48 b8 15 5f 80 00 00 	movabs $0x805f15,%rax
+  8063d4:	00 00 00 
+  8063d7:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8063d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063dd:	8b 40 04             	mov    0x4(%rax),%eax
+  8063e0:	85 c0                	test   %eax,%eax
+  8063e2:	74 18                	je     8063fc <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8063e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8063ed:	48 89 c7             	mov    %rax,%rdi
+  8063f0:	48 b8 62 24 80 00 00 	movabs $0x802462,%rax
+  8063f7:	00 00 00 
+  8063fa:	ff d0                	call   *%rax
+}
+  8063fc:	90                   	nop
+  8063fd:	c9                   	leave
+  8063fe:	c3                   	ret
+  8063ff:	90                   	nop
@@ -0,0 +1,10159 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 18 02 00 00       	call   800244 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	41 56                	push   %r14
+  800038:	41 55                	push   %r13
+  80003a:	41 54                	push   %r12
+  80003c:	53                   	push   %rbx
+  80003d:	48 83 ec 20          	sub    $0x20,%rsp
+  800041:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800044:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  envid_t who;
+  uint32_t i;
+
+  i = 0;
+  800048:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+  if ((who = sfork()) != 0) {
+  80004f:	48 b8 1e 30 80 00 00 	movabs $0x80301e,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+  80005b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80005e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 84 a9 00 00 00    	je     800112 <umain+0xe0>
+    cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800069:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800070:	00 00 00 
+  800073:	8b 40 04             	mov    0x4(%rax),%eax
+  800076:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007b:	48 98                	cltq
+  80007d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800084:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80008b:	00 00 00 
+  80008e:	48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+  800092:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	48 89 da             	mov    %rbx,%rdx
+  8000a1:	89 c6                	mov    %eax,%esi
+  8000a3:	48 b8 20 65 80 00 00 	movabs $0x806520,%rax
+  8000aa:	00 00 00 
+  8000ad:	48 89 c7             	mov    %rax,%rdi
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  8000bc:	00 00 00 
+  8000bf:	ff d1                	call   *%rcx
+    // get the ball rolling
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000c1:	8b 5d d8             	mov    -0x28(%rbp),%ebx
+  8000c4:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8000cb:	00 00 00 
+  8000ce:	ff d0                	call   *%rax
+  8000d0:	89 da                	mov    %ebx,%edx
+  8000d2:	89 c6                	mov    %eax,%esi
+  8000d4:	48 b8 3a 65 80 00 00 	movabs $0x80653a,%rax
+  8000db:	00 00 00 
+  8000de:	48 89 c7             	mov    %rax,%rdi
+  8000e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e6:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  8000ed:	00 00 00 
+  8000f0:	ff d1                	call   *%rcx
+    ipc_send(who, 0, 0, 0);
+  8000f2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8000f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800104:	89 c7                	mov    %eax,%edi
+  800106:	48 b8 b2 31 80 00 00 	movabs $0x8031b2,%rax
+  80010d:	00 00 00 
+  800110:	ff d0                	call   *%rax
+  }
+
+  while (1) {
+    ipc_recv(&who, 0, 0);
+  800112:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  800116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011b:	be 00 00 00 00       	mov    $0x0,%esi
+  800120:	48 89 c7             	mov    %rax,%rdi
+  800123:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  80012a:	00 00 00 
+  80012d:	ff d0                	call   *%rax
+    cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80012f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800136:	00 00 00 
+  800139:	8b 40 04             	mov    0x4(%rax),%eax
+  80013c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800141:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800148:	00 00 00 
+  80014b:	48 98                	cltq
+  80014d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800154:	48 01 d0             	add    %rdx,%rax
+  800157:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80015d:	44 8b 28             	mov    (%rax),%r13d
+  800160:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800167:	00 00 00 
+  80016a:	8b 40 04             	mov    0x4(%rax),%eax
+  80016d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800172:	48 98                	cltq
+  800174:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80017b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800182:	00 00 00 
+  800185:	4c 8d 34 10          	lea    (%rax,%rdx,1),%r14
+  800189:	44 8b 65 d8          	mov    -0x28(%rbp),%r12d
+  80018d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800194:	00 00 00 
+  800197:	8b 18                	mov    (%rax),%ebx
+  800199:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+  8001a5:	45 89 e9             	mov    %r13d,%r9d
+  8001a8:	4d 89 f0             	mov    %r14,%r8
+  8001ab:	44 89 e1             	mov    %r12d,%ecx
+  8001ae:	89 da                	mov    %ebx,%edx
+  8001b0:	89 c6                	mov    %eax,%esi
+  8001b2:	48 b8 50 65 80 00 00 	movabs $0x806550,%rax
+  8001b9:	00 00 00 
+  8001bc:	48 89 c7             	mov    %rax,%rdi
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	49 ba f0 03 80 00 00 	movabs $0x8003f0,%r10
+  8001cb:	00 00 00 
+  8001ce:	41 ff d2             	call   *%r10
+    if (val == 10)
+  8001d1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8001d8:	00 00 00 
+  8001db:	8b 00                	mov    (%rax),%eax
+  8001dd:	83 f8 0a             	cmp    $0xa,%eax
+  8001e0:	74 51                	je     800233 <umain+0x201>
+      return;
+    ++val;
+  8001e2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8001e9:	00 00 00 
+  8001ec:	8b 00                	mov    (%rax),%eax
+  8001ee:	8d 50 01             	lea    0x1(%rax),%edx
+  8001f1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8001f8:	00 00 00 
+  8001fb:	89 10                	mov    %edx,(%rax)
+    ipc_send(who, 0, 0, 0);
+  8001fd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800200:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020a:	be 00 00 00 00       	mov    $0x0,%esi
+  80020f:	89 c7                	mov    %eax,%edi
+  800211:	48 b8 b2 31 80 00 00 	movabs $0x8031b2,%rax
+  800218:	00 00 00 
+  80021b:	ff d0                	call   *%rax
+    if (val == 10)
+  80021d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800224:	00 00 00 
+  800227:	8b 00                	mov    (%rax),%eax
+  800229:	83 f8 0a             	cmp    $0xa,%eax
+  80022c:	74 08                	je     800236 <umain+0x204>
+    ipc_recv(&who, 0, 0);
+  80022e:	e9 df fe ff ff       	jmp    800112 <umain+0xe0>
+      return;
+  800233:	90                   	nop
+  800234:	eb 01                	jmp    800237 <umain+0x205>
+      return;
+  800236:	90                   	nop
+  }
+}
+  800237:	48 83 c4 20          	add    $0x20,%rsp
+  80023b:	5b                   	pop    %rbx
+  80023c:	41 5c                	pop    %r12
+  80023e:	41 5d                	pop    %r13
+  800240:	41 5e                	pop    %r14
+  800242:	5d                   	pop    %rbp
+  800243:	c3                   	ret
+
+0000000000800244 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800244:	55                   	push   %rbp
+  800245:	48 89 e5             	mov    %rsp,%rbp
+  800248:	48 83 ec 20          	sub    $0x20,%rsp
+  80024c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80024f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800253:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80025a:	00 00 00 
+  80025d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800261:	eb 13                	jmp    800276 <libmain+0x32>
+    (*ctor)();
+  800263:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800267:	48 8b 10             	mov    (%rax),%rdx
+  80026a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026f:	ff d2                	call   *%rdx
+    ctor++;
+  800271:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800276:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80027d:	00 00 00 
+  800280:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800284:	72 dd                	jb     800263 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800286:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80028a:	7e 14                	jle    8002a0 <libmain+0x5c>
+    binaryname = argv[0];
+  80028c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800290:	48 8b 00             	mov    (%rax),%rax
+  800293:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80029a:	00 00 00 
+  80029d:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8002a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002a7:	48 89 d6             	mov    %rdx,%rsi
+  8002aa:	89 c7                	mov    %eax,%edi
+  8002ac:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8002b8:	48 b8 c7 02 80 00 00 	movabs $0x8002c7,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+#endif
+}
+  8002c4:	90                   	nop
+  8002c5:	c9                   	leave
+  8002c6:	c3                   	ret
+
+00000000008002c7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002c7:	55                   	push   %rbp
+  8002c8:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8002cb:	48 b8 c0 36 80 00 00 	movabs $0x8036c0,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8002d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002dc:	48 b8 26 20 80 00 00 	movabs $0x802026,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+}
+  8002e8:	90                   	nop
+  8002e9:	5d                   	pop    %rbp
+  8002ea:	c3                   	ret
+
+00000000008002eb <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8002eb:	55                   	push   %rbp
+  8002ec:	48 89 e5             	mov    %rsp,%rbp
+  8002ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8002f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8002f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8002fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002fe:	8b 00                	mov    (%rax),%eax
+  800300:	8d 48 01             	lea    0x1(%rax),%ecx
+  800303:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800307:	89 0a                	mov    %ecx,(%rdx)
+  800309:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80030c:	89 d1                	mov    %edx,%ecx
+  80030e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800312:	48 98                	cltq
+  800314:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80031c:	8b 00                	mov    (%rax),%eax
+  80031e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800323:	75 2c                	jne    800351 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800325:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800329:	8b 00                	mov    (%rax),%eax
+  80032b:	48 98                	cltq
+  80032d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800331:	48 83 c2 08          	add    $0x8,%rdx
+  800335:	48 89 c6             	mov    %rax,%rsi
+  800338:	48 89 d7             	mov    %rdx,%rdi
+  80033b:	48 b8 57 1f 80 00 00 	movabs $0x801f57,%rax
+  800342:	00 00 00 
+  800345:	ff d0                	call   *%rax
+    b->idx = 0;
+  800347:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80034b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800355:	8b 40 04             	mov    0x4(%rax),%eax
+  800358:	8d 50 01             	lea    0x1(%rax),%edx
+  80035b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80035f:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800362:	90                   	nop
+  800363:	c9                   	leave
+  800364:	c3                   	ret
+
+0000000000800365 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800365:	55                   	push   %rbp
+  800366:	48 89 e5             	mov    %rsp,%rbp
+  800369:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800370:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800377:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80037e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800385:	00 00 00 
+  b.cnt = 0;
+  800388:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80038f:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800392:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800399:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8003a0:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8003a7:	48 89 c6             	mov    %rax,%rsi
+  8003aa:	48 b8 eb 02 80 00 00 	movabs $0x8002eb,%rax
+  8003b1:	00 00 00 
+  8003b4:	48 89 c7             	mov    %rax,%rdi
+  8003b7:	48 b8 4a 07 80 00 00 	movabs $0x80074a,%rax
+  8003be:	00 00 00 
+  8003c1:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8003c3:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8003c9:	48 98                	cltq
+  8003cb:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8003d2:	48 83 c2 08          	add    $0x8,%rdx
+  8003d6:	48 89 c6             	mov    %rax,%rsi
+  8003d9:	48 89 d7             	mov    %rdx,%rdi
+  8003dc:	48 b8 57 1f 80 00 00 	movabs $0x801f57,%rax
+  8003e3:	00 00 00 
+  8003e6:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8003e8:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8003ee:	c9                   	leave
+  8003ef:	c3                   	ret
+
+00000000008003f0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003f0:	55                   	push   %rbp
+  8003f1:	48 89 e5             	mov    %rsp,%rbp
+  8003f4:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8003fb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800402:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800409:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800410:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800417:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80041e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800425:	84 c0                	test   %al,%al
+  800427:	74 20                	je     800449 <cprintf+0x59>
+  800429:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80042d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800431:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800435:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800439:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80043d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800441:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800445:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800449:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800450:	00 00 00 
+  800453:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80045a:	00 00 00 
+  80045d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800461:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800468:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80046f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800476:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80047d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800484:	48 89 d6             	mov    %rdx,%rsi
+  800487:	48 89 c7             	mov    %rax,%rdi
+  80048a:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  800491:	00 00 00 
+  800494:	ff d0                	call   *%rax
+  800496:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80049c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004a2:	c9                   	leave
+  8004a3:	c3                   	ret
+
+00000000008004a4 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8004a4:	55                   	push   %rbp
+  8004a5:	48 89 e5             	mov    %rsp,%rbp
+  8004a8:	48 83 ec 30          	sub    $0x30,%rsp
+  8004ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8004b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8004b8:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8004bb:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8004bf:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8004c3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004c6:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8004ca:	72 54                	jb     800520 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004cc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004cf:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8004d2:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8004d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004de:	48 f7 f6             	div    %rsi
+  8004e1:	49 89 c2             	mov    %rax,%r10
+  8004e4:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8004e7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8004ea:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8004ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f2:	41 89 c9             	mov    %ecx,%r9d
+  8004f5:	41 89 f8             	mov    %edi,%r8d
+  8004f8:	89 d1                	mov    %edx,%ecx
+  8004fa:	4c 89 d2             	mov    %r10,%rdx
+  8004fd:	48 89 c7             	mov    %rax,%rdi
+  800500:	48 b8 a4 04 80 00 00 	movabs $0x8004a4,%rax
+  800507:	00 00 00 
+  80050a:	ff d0                	call   *%rax
+  80050c:	eb 1c                	jmp    80052a <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80050e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800512:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800515:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800519:	48 89 d6             	mov    %rdx,%rsi
+  80051c:	89 c7                	mov    %eax,%edi
+  80051e:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800520:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800524:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800528:	7f e4                	jg     80050e <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80052a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80052d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800531:	ba 00 00 00 00       	mov    $0x0,%edx
+  800536:	48 f7 f1             	div    %rcx
+  800539:	48 b8 b0 67 80 00 00 	movabs $0x8067b0,%rax
+  800540:	00 00 00 
+  800543:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800547:	0f be c0             	movsbl %al,%eax
+  80054a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80054e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800552:	48 89 d6             	mov    %rdx,%rsi
+  800555:	89 c7                	mov    %eax,%edi
+  800557:	ff d1                	call   *%rcx
+}
+  800559:	90                   	nop
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+000000000080055c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	48 83 ec 10          	sub    $0x10,%rsp
+  800564:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800568:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80056b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80056f:	7e 4b                	jle    8005bc <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800571:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800575:	8b 00                	mov    (%rax),%eax
+  800577:	83 f8 2f             	cmp    $0x2f,%eax
+  80057a:	77 24                	ja     8005a0 <getuint+0x44>
+  80057c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800580:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800588:	8b 00                	mov    (%rax),%eax
+  80058a:	89 c0                	mov    %eax,%eax
+  80058c:	48 01 d0             	add    %rdx,%rax
+  80058f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800593:	8b 12                	mov    (%rdx),%edx
+  800595:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800598:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80059c:	89 0a                	mov    %ecx,(%rdx)
+  80059e:	eb 14                	jmp    8005b4 <getuint+0x58>
+  8005a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005a8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005b0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005b4:	48 8b 00             	mov    (%rax),%rax
+  8005b7:	e9 95 00 00 00       	jmp    800651 <getuint+0xf5>
+  else if (lflag)
+  8005bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005c0:	74 48                	je     80060a <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8005c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c6:	8b 00                	mov    (%rax),%eax
+  8005c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cb:	77 24                	ja     8005f1 <getuint+0x95>
+  8005cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d9:	8b 00                	mov    (%rax),%eax
+  8005db:	89 c0                	mov    %eax,%eax
+  8005dd:	48 01 d0             	add    %rdx,%rax
+  8005e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005e4:	8b 12                	mov    (%rdx),%edx
+  8005e6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005ed:	89 0a                	mov    %ecx,(%rdx)
+  8005ef:	eb 14                	jmp    800605 <getuint+0xa9>
+  8005f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005f9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800601:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800605:	48 8b 00             	mov    (%rax),%rax
+  800608:	eb 47                	jmp    800651 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80060a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060e:	8b 00                	mov    (%rax),%eax
+  800610:	83 f8 2f             	cmp    $0x2f,%eax
+  800613:	77 24                	ja     800639 <getuint+0xdd>
+  800615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800619:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80061d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800621:	8b 00                	mov    (%rax),%eax
+  800623:	89 c0                	mov    %eax,%eax
+  800625:	48 01 d0             	add    %rdx,%rax
+  800628:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80062c:	8b 12                	mov    (%rdx),%edx
+  80062e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800631:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800635:	89 0a                	mov    %ecx,(%rdx)
+  800637:	eb 14                	jmp    80064d <getuint+0xf1>
+  800639:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80063d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800641:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800645:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800649:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80064d:	8b 00                	mov    (%rax),%eax
+  80064f:	89 c0                	mov    %eax,%eax
+}
+  800651:	c9                   	leave
+  800652:	c3                   	ret
+
+0000000000800653 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800653:	55                   	push   %rbp
+  800654:	48 89 e5             	mov    %rsp,%rbp
+  800657:	48 83 ec 10          	sub    $0x10,%rsp
+  80065b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80065f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800662:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800666:	7e 4b                	jle    8006b3 <getint+0x60>
+    return va_arg(*ap, long long);
+  800668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80066c:	8b 00                	mov    (%rax),%eax
+  80066e:	83 f8 2f             	cmp    $0x2f,%eax
+  800671:	77 24                	ja     800697 <getint+0x44>
+  800673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800677:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80067b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80067f:	8b 00                	mov    (%rax),%eax
+  800681:	89 c0                	mov    %eax,%eax
+  800683:	48 01 d0             	add    %rdx,%rax
+  800686:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068a:	8b 12                	mov    (%rdx),%edx
+  80068c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80068f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800693:	89 0a                	mov    %ecx,(%rdx)
+  800695:	eb 14                	jmp    8006ab <getint+0x58>
+  800697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80069b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80069f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006a7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006ab:	48 8b 00             	mov    (%rax),%rax
+  8006ae:	e9 95 00 00 00       	jmp    800748 <getint+0xf5>
+  else if (lflag)
+  8006b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006b7:	74 48                	je     800701 <getint+0xae>
+    return va_arg(*ap, long);
+  8006b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006bd:	8b 00                	mov    (%rax),%eax
+  8006bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c2:	77 24                	ja     8006e8 <getint+0x95>
+  8006c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006d0:	8b 00                	mov    (%rax),%eax
+  8006d2:	89 c0                	mov    %eax,%eax
+  8006d4:	48 01 d0             	add    %rdx,%rax
+  8006d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006db:	8b 12                	mov    (%rdx),%edx
+  8006dd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e4:	89 0a                	mov    %ecx,(%rdx)
+  8006e6:	eb 14                	jmp    8006fc <getint+0xa9>
+  8006e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006f8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006fc:	48 8b 00             	mov    (%rax),%rax
+  8006ff:	eb 47                	jmp    800748 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800705:	8b 00                	mov    (%rax),%eax
+  800707:	83 f8 2f             	cmp    $0x2f,%eax
+  80070a:	77 24                	ja     800730 <getint+0xdd>
+  80070c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800710:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800718:	8b 00                	mov    (%rax),%eax
+  80071a:	89 c0                	mov    %eax,%eax
+  80071c:	48 01 d0             	add    %rdx,%rax
+  80071f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800723:	8b 12                	mov    (%rdx),%edx
+  800725:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800728:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80072c:	89 0a                	mov    %ecx,(%rdx)
+  80072e:	eb 14                	jmp    800744 <getint+0xf1>
+  800730:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800734:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800738:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80073c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800740:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800744:	8b 00                	mov    (%rax),%eax
+  800746:	48 98                	cltq
+}
+  800748:	c9                   	leave
+  800749:	c3                   	ret
+
+000000000080074a <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80074a:	55                   	push   %rbp
+  80074b:	48 89 e5             	mov    %rsp,%rbp
+  80074e:	41 54                	push   %r12
+  800750:	53                   	push   %rbx
+  800751:	48 83 ec 60          	sub    $0x60,%rsp
+  800755:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800759:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80075d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800761:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800765:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800769:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80076d:	48 8b 06             	mov    (%rsi),%rax
+  800770:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800774:	48 89 01             	mov    %rax,(%rcx)
+  800777:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80077b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80077f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800783:	eb 17                	jmp    80079c <vprintfmt+0x52>
+      if (ch == '\0')
+  800785:	85 db                	test   %ebx,%ebx
+  800787:	0f 84 bf 04 00 00    	je     800c4c <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80078d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800791:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800795:	48 89 c6             	mov    %rax,%rsi
+  800798:	89 df                	mov    %ebx,%edi
+  80079a:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80079c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007a0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007a4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007a8:	0f b6 00             	movzbl (%rax),%eax
+  8007ab:	0f b6 d8             	movzbl %al,%ebx
+  8007ae:	83 fb 25             	cmp    $0x25,%ebx
+  8007b1:	75 d2                	jne    800785 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8007b3:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8007b7:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8007be:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8007c5:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8007cc:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8007d3:	eb 04                	jmp    8007d9 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8007d5:	90                   	nop
+  8007d6:	eb 01                	jmp    8007d9 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8007d8:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8007d9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007e1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007e5:	0f b6 00             	movzbl (%rax),%eax
+  8007e8:	0f b6 d8             	movzbl %al,%ebx
+  8007eb:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8007ee:	83 f8 55             	cmp    $0x55,%eax
+  8007f1:	0f 87 22 04 00 00    	ja     800c19 <vprintfmt+0x4cf>
+  8007f7:	89 c0                	mov    %eax,%eax
+  8007f9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800800:	00 
+  800801:	48 b8 d8 67 80 00 00 	movabs $0x8067d8,%rax
+  800808:	00 00 00 
+  80080b:	48 01 d0             	add    %rdx,%rax
+  80080e:	48 8b 00             	mov    (%rax),%rax
+  800811:	ff e0                	jmp    *%rax
+        padc = '-';
+  800813:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800817:	eb c0                	jmp    8007d9 <vprintfmt+0x8f>
+        padc = '0';
+  800819:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80081d:	eb ba                	jmp    8007d9 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80081f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800826:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800829:	89 d0                	mov    %edx,%eax
+  80082b:	c1 e0 02             	shl    $0x2,%eax
+  80082e:	01 d0                	add    %edx,%eax
+  800830:	01 c0                	add    %eax,%eax
+  800832:	01 d8                	add    %ebx,%eax
+  800834:	83 e8 30             	sub    $0x30,%eax
+  800837:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80083a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80083e:	0f b6 00             	movzbl (%rax),%eax
+  800841:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800844:	83 fb 2f             	cmp    $0x2f,%ebx
+  800847:	7e 60                	jle    8008a9 <vprintfmt+0x15f>
+  800849:	83 fb 39             	cmp    $0x39,%ebx
+  80084c:	7f 5b                	jg     8008a9 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80084e:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800853:	eb d1                	jmp    800826 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 17                	ja     800874 <vprintfmt+0x12a>
+  80085d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800861:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800864:	89 d2                	mov    %edx,%edx
+  800866:	48 01 d0             	add    %rdx,%rax
+  800869:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80086c:	83 c2 08             	add    $0x8,%edx
+  80086f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800872:	eb 0c                	jmp    800880 <vprintfmt+0x136>
+  800874:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800878:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80087c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800880:	8b 00                	mov    (%rax),%eax
+  800882:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800885:	eb 23                	jmp    8008aa <vprintfmt+0x160>
+        if (width < 0)
+  800887:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80088b:	0f 89 44 ff ff ff    	jns    8007d5 <vprintfmt+0x8b>
+          width = 0;
+  800891:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800898:	e9 38 ff ff ff       	jmp    8007d5 <vprintfmt+0x8b>
+        altflag = 1;
+  80089d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8008a4:	e9 30 ff ff ff       	jmp    8007d9 <vprintfmt+0x8f>
+        goto process_precision;
+  8008a9:	90                   	nop
+        if (width < 0)
+  8008aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008ae:	0f 89 24 ff ff ff    	jns    8007d8 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8008b4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8008b7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8008ba:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8008c1:	e9 12 ff ff ff       	jmp    8007d8 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8008c6:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8008ca:	e9 0a ff ff ff       	jmp    8007d9 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8008cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d5:	77 17                	ja     8008ee <vprintfmt+0x1a4>
+  8008d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008db:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008de:	89 d2                	mov    %edx,%edx
+  8008e0:	48 01 d0             	add    %rdx,%rax
+  8008e3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008e6:	83 c2 08             	add    $0x8,%edx
+  8008e9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008ec:	eb 0c                	jmp    8008fa <vprintfmt+0x1b0>
+  8008ee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008f2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008f6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008fa:	8b 00                	mov    (%rax),%eax
+  8008fc:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800900:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800904:	48 89 d6             	mov    %rdx,%rsi
+  800907:	89 c7                	mov    %eax,%edi
+  800909:	ff d1                	call   *%rcx
+        break;
+  80090b:	e9 37 03 00 00       	jmp    800c47 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800910:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800913:	83 f8 2f             	cmp    $0x2f,%eax
+  800916:	77 17                	ja     80092f <vprintfmt+0x1e5>
+  800918:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80091c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80091f:	89 d2                	mov    %edx,%edx
+  800921:	48 01 d0             	add    %rdx,%rax
+  800924:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800927:	83 c2 08             	add    $0x8,%edx
+  80092a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80092d:	eb 0c                	jmp    80093b <vprintfmt+0x1f1>
+  80092f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800933:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800937:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80093b:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80093d:	85 db                	test   %ebx,%ebx
+  80093f:	79 02                	jns    800943 <vprintfmt+0x1f9>
+          err = -err;
+  800941:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800943:	83 fb 15             	cmp    $0x15,%ebx
+  800946:	7f 16                	jg     80095e <vprintfmt+0x214>
+  800948:	48 ba 00 67 80 00 00 	movabs $0x806700,%rdx
+  80094f:	00 00 00 
+  800952:	48 63 c3             	movslq %ebx,%rax
+  800955:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800959:	4d 85 e4             	test   %r12,%r12
+  80095c:	75 2e                	jne    80098c <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80095e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800962:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800966:	89 d9                	mov    %ebx,%ecx
+  800968:	48 ba c1 67 80 00 00 	movabs $0x8067c1,%rdx
+  80096f:	00 00 00 
+  800972:	48 89 c7             	mov    %rax,%rdi
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097a:	49 b8 56 0c 80 00 00 	movabs $0x800c56,%r8
+  800981:	00 00 00 
+  800984:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800987:	e9 bb 02 00 00       	jmp    800c47 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80098c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800990:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800994:	4c 89 e1             	mov    %r12,%rcx
+  800997:	48 ba ca 67 80 00 00 	movabs $0x8067ca,%rdx
+  80099e:	00 00 00 
+  8009a1:	48 89 c7             	mov    %rax,%rdi
+  8009a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a9:	49 b8 56 0c 80 00 00 	movabs $0x800c56,%r8
+  8009b0:	00 00 00 
+  8009b3:	41 ff d0             	call   *%r8
+        break;
+  8009b6:	e9 8c 02 00 00       	jmp    800c47 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8009bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009be:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c1:	77 17                	ja     8009da <vprintfmt+0x290>
+  8009c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009c7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ca:	89 d2                	mov    %edx,%edx
+  8009cc:	48 01 d0             	add    %rdx,%rax
+  8009cf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009d2:	83 c2 08             	add    $0x8,%edx
+  8009d5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009d8:	eb 0c                	jmp    8009e6 <vprintfmt+0x29c>
+  8009da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009de:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009e2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009e6:	4c 8b 20             	mov    (%rax),%r12
+  8009e9:	4d 85 e4             	test   %r12,%r12
+  8009ec:	75 0a                	jne    8009f8 <vprintfmt+0x2ae>
+          p = "(null)";
+  8009ee:	49 bc cd 67 80 00 00 	movabs $0x8067cd,%r12
+  8009f5:	00 00 00 
+        if (width > 0 && padc != '-')
+  8009f8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009fc:	7e 78                	jle    800a76 <vprintfmt+0x32c>
+  8009fe:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a02:	74 72                	je     800a76 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a04:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a07:	48 98                	cltq
+  800a09:	48 89 c6             	mov    %rax,%rsi
+  800a0c:	4c 89 e7             	mov    %r12,%rdi
+  800a0f:	48 b8 62 13 80 00 00 	movabs $0x801362,%rax
+  800a16:	00 00 00 
+  800a19:	ff d0                	call   *%rax
+  800a1b:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a1e:	eb 17                	jmp    800a37 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800a20:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a24:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a28:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a2c:	48 89 d6             	mov    %rdx,%rsi
+  800a2f:	89 c7                	mov    %eax,%edi
+  800a31:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a33:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a37:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a3b:	7f e3                	jg     800a20 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a3d:	eb 37                	jmp    800a76 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800a3f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800a43:	74 1e                	je     800a63 <vprintfmt+0x319>
+  800a45:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a48:	7e 05                	jle    800a4f <vprintfmt+0x305>
+  800a4a:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a4d:	7e 14                	jle    800a63 <vprintfmt+0x319>
+            putch('?', putdat);
+  800a4f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a53:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a57:	48 89 c6             	mov    %rax,%rsi
+  800a5a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a5f:	ff d2                	call   *%rdx
+  800a61:	eb 0f                	jmp    800a72 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800a63:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a67:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a6b:	48 89 c6             	mov    %rax,%rsi
+  800a6e:	89 df                	mov    %ebx,%edi
+  800a70:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a72:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a76:	4c 89 e0             	mov    %r12,%rax
+  800a79:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a7d:	0f b6 00             	movzbl (%rax),%eax
+  800a80:	0f be d8             	movsbl %al,%ebx
+  800a83:	85 db                	test   %ebx,%ebx
+  800a85:	74 28                	je     800aaf <vprintfmt+0x365>
+  800a87:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a8b:	78 b2                	js     800a3f <vprintfmt+0x2f5>
+  800a8d:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a91:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a95:	79 a8                	jns    800a3f <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800a97:	eb 16                	jmp    800aaf <vprintfmt+0x365>
+          putch(' ', putdat);
+  800a99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800aa1:	48 89 c6             	mov    %rax,%rsi
+  800aa4:	bf 20 00 00 00       	mov    $0x20,%edi
+  800aa9:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800aab:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800aaf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ab3:	7f e4                	jg     800a99 <vprintfmt+0x34f>
+        break;
+  800ab5:	e9 8d 01 00 00       	jmp    800c47 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800aba:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800abd:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ac1:	89 d6                	mov    %edx,%esi
+  800ac3:	48 89 c7             	mov    %rax,%rdi
+  800ac6:	48 b8 53 06 80 00 00 	movabs $0x800653,%rax
+  800acd:	00 00 00 
+  800ad0:	ff d0                	call   *%rax
+  800ad2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ada:	48 85 c0             	test   %rax,%rax
+  800add:	79 1d                	jns    800afc <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800adf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ae3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ae7:	48 89 c6             	mov    %rax,%rsi
+  800aea:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aef:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af5:	48 f7 d8             	neg    %rax
+  800af8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800afc:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b03:	e9 d2 00 00 00       	jmp    800bda <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b08:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b0b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b0f:	89 d6                	mov    %edx,%esi
+  800b11:	48 89 c7             	mov    %rax,%rdi
+  800b14:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  800b1b:	00 00 00 
+  800b1e:	ff d0                	call   *%rax
+  800b20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800b24:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b2b:	e9 aa 00 00 00       	jmp    800bda <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800b30:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b33:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b37:	89 d6                	mov    %edx,%esi
+  800b39:	48 89 c7             	mov    %rax,%rdi
+  800b3c:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  800b43:	00 00 00 
+  800b46:	ff d0                	call   *%rax
+  800b48:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800b4c:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800b53:	e9 82 00 00 00       	jmp    800bda <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800b58:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b5c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b60:	48 89 c6             	mov    %rax,%rsi
+  800b63:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b68:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800b6a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b6e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b72:	48 89 c6             	mov    %rax,%rsi
+  800b75:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b7a:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 17                	ja     800b9b <vprintfmt+0x451>
+  800b84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b88:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b8b:	89 d2                	mov    %edx,%edx
+  800b8d:	48 01 d0             	add    %rdx,%rax
+  800b90:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b93:	83 c2 08             	add    $0x8,%edx
+  800b96:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b99:	eb 0c                	jmp    800ba7 <vprintfmt+0x45d>
+  800b9b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b9f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ba3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ba7:	48 8b 00             	mov    (%rax),%rax
+  800baa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800bae:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800bb5:	eb 23                	jmp    800bda <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800bb7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bba:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bbe:	89 d6                	mov    %edx,%esi
+  800bc0:	48 89 c7             	mov    %rax,%rdi
+  800bc3:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  800bca:	00 00 00 
+  800bcd:	ff d0                	call   *%rax
+  800bcf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800bd3:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800bda:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800bdf:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800be2:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800be5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bf1:	45 89 c1             	mov    %r8d,%r9d
+  800bf4:	41 89 f8             	mov    %edi,%r8d
+  800bf7:	48 89 c7             	mov    %rax,%rdi
+  800bfa:	48 b8 a4 04 80 00 00 	movabs $0x8004a4,%rax
+  800c01:	00 00 00 
+  800c04:	ff d0                	call   *%rax
+        break;
+  800c06:	eb 3f                	jmp    800c47 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c08:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c0c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c10:	48 89 c6             	mov    %rax,%rsi
+  800c13:	89 df                	mov    %ebx,%edi
+  800c15:	ff d2                	call   *%rdx
+        break;
+  800c17:	eb 2e                	jmp    800c47 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800c19:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c1d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c21:	48 89 c6             	mov    %rax,%rsi
+  800c24:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c29:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800c2b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c30:	eb 05                	jmp    800c37 <vprintfmt+0x4ed>
+  800c32:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c37:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c3b:	48 83 e8 01          	sub    $0x1,%rax
+  800c3f:	0f b6 00             	movzbl (%rax),%eax
+  800c42:	3c 25                	cmp    $0x25,%al
+  800c44:	75 ec                	jne    800c32 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800c46:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c47:	e9 50 fb ff ff       	jmp    80079c <vprintfmt+0x52>
+        return;
+  800c4c:	90                   	nop
+    }
+  }
+}
+  800c4d:	48 83 c4 60          	add    $0x60,%rsp
+  800c51:	5b                   	pop    %rbx
+  800c52:	41 5c                	pop    %r12
+  800c54:	5d                   	pop    %rbp
+  800c55:	c3                   	ret
+
+0000000000800c56 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+  800c5a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c61:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c68:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c6f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c76:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c7d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c84:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c8b:	84 c0                	test   %al,%al
+  800c8d:	74 20                	je     800caf <printfmt+0x59>
+  800c8f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c93:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c97:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c9b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c9f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ca3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ca7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cab:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800caf:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800cb6:	00 00 00 
+  800cb9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800cc0:	00 00 00 
+  800cc3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cc7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800cce:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800cd5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800cdc:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ce3:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800cea:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800cf1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800cf8:	48 89 c7             	mov    %rax,%rdi
+  800cfb:	48 b8 4a 07 80 00 00 	movabs $0x80074a,%rax
+  800d02:	00 00 00 
+  800d05:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d07:	90                   	nop
+  800d08:	c9                   	leave
+  800d09:	c3                   	ret
+
+0000000000800d0a <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d0a:	55                   	push   %rbp
+  800d0b:	48 89 e5             	mov    %rsp,%rbp
+  800d0e:	48 83 ec 10          	sub    $0x10,%rsp
+  800d12:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d15:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800d19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d1d:	8b 40 10             	mov    0x10(%rax),%eax
+  800d20:	8d 50 01             	lea    0x1(%rax),%edx
+  800d23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d27:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800d2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d2e:	48 8b 10             	mov    (%rax),%rdx
+  800d31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d39:	48 39 c2             	cmp    %rax,%rdx
+  800d3c:	73 17                	jae    800d55 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800d3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d42:	48 8b 00             	mov    (%rax),%rax
+  800d45:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d49:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d4d:	48 89 0a             	mov    %rcx,(%rdx)
+  800d50:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d53:	88 10                	mov    %dl,(%rax)
+}
+  800d55:	90                   	nop
+  800d56:	c9                   	leave
+  800d57:	c3                   	ret
+
+0000000000800d58 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800d58:	55                   	push   %rbp
+  800d59:	48 89 e5             	mov    %rsp,%rbp
+  800d5c:	48 83 ec 40          	sub    $0x40,%rsp
+  800d60:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d64:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800d67:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d6b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d73:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800d77:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800d7a:	48 98                	cltq
+  800d7c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d84:	48 01 d0             	add    %rdx,%rax
+  800d87:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800d8b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800d92:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d97:	74 06                	je     800d9f <vsnprintf+0x47>
+  800d99:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d9d:	7f 07                	jg     800da6 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800d9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800da4:	eb 32                	jmp    800dd8 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800da6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800daa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800dae:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800db2:	48 89 c6             	mov    %rax,%rsi
+  800db5:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  800dbc:	00 00 00 
+  800dbf:	48 89 c7             	mov    %rax,%rdi
+  800dc2:	48 b8 4a 07 80 00 00 	movabs $0x80074a,%rax
+  800dc9:	00 00 00 
+  800dcc:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800dce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dd2:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800dd5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800dd8:	c9                   	leave
+  800dd9:	c3                   	ret
+
+0000000000800dda <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800dda:	55                   	push   %rbp
+  800ddb:	48 89 e5             	mov    %rsp,%rbp
+  800dde:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800de5:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800dec:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800df2:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800df9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e00:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e07:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e0e:	84 c0                	test   %al,%al
+  800e10:	74 20                	je     800e32 <snprintf+0x58>
+  800e12:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e16:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e1a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e1e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e22:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e26:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e2a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e2e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800e32:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e39:	00 00 00 
+  800e3c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e43:	00 00 00 
+  800e46:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e4a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e51:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e58:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800e5f:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800e66:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e6d:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800e73:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e7a:	48 89 c7             	mov    %rax,%rdi
+  800e7d:	48 b8 58 0d 80 00 00 	movabs $0x800d58,%rax
+  800e84:	00 00 00 
+  800e87:	ff d0                	call   *%rax
+  800e89:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800e8f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e95:	c9                   	leave
+  800e96:	c3                   	ret
+
+0000000000800e97 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800e97:	55                   	push   %rbp
+  800e98:	48 89 e5             	mov    %rsp,%rbp
+  800e9b:	53                   	push   %rbx
+  800e9c:	48 83 ec 38          	sub    $0x38,%rsp
+  800ea0:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ea3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ea7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800eab:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800eaf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800eb3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebb:	89 d1                	mov    %edx,%ecx
+  800ebd:	0f a2                	cpuid
+  800ebf:	89 de                	mov    %ebx,%esi
+  800ec1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ec4:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ec7:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800eca:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ecd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ed2:	74 09                	je     800edd <cpuid+0x46>
+}
+  800ed4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ed8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800edb:	89 10                	mov    %edx,(%rax)
+
+  800edd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ee2:	74 09                	je     800eed <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800ee4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ee8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800eeb:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800eed:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ef2:	74 09                	je     800efd <cpuid+0x66>
+char *
+  800ef4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ef8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800efb:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800efd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f02:	74 09                	je     800f0d <cpuid+0x76>
+  for (; *s; s++)
+  800f04:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f08:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f0b:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f0d:	90                   	nop
+  800f0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f12:	c9                   	leave
+  800f13:	c3                   	ret
+
+0000000000800f14 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800f14:	55                   	push   %rbp
+  800f15:	48 89 e5             	mov    %rsp,%rbp
+  800f18:	48 83 ec 18          	sub    $0x18,%rsp
+  800f1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800f1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f22:	89 c1                	mov    %eax,%ecx
+  800f24:	0f 01 d0             	xgetbv
+  800f27:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f2a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800f2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f30:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800f33:	48 c1 e2 20          	shl    $0x20,%rdx
+  800f37:	48 09 d0             	or     %rdx,%rax
+#else
+  800f3a:	c9                   	leave
+  800f3b:	c3                   	ret
+
+0000000000800f3c <string_cpu>:
+string_cpu(void) {
+  800f3c:	55                   	push   %rbp
+  800f3d:	48 89 e5             	mov    %rsp,%rbp
+  800f40:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800f44:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800f4b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800f52:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f59:	00 00 00 
+  800f5c:	8b 00                	mov    (%rax),%eax
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	78 11                	js     800f73 <string_cpu+0x37>
+    return string_features;
+  800f62:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f69:	00 00 00 
+  800f6c:	8b 00                	mov    (%rax),%eax
+  800f6e:	e9 df 00 00 00       	jmp    801052 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800f73:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800f77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f82:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f87:	48 89 c6             	mov    %rax,%rsi
+  800f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f8f:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  800f96:	00 00 00 
+  800f99:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800f9b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f9e:	83 f8 06             	cmp    $0x6,%eax
+  800fa1:	76 28                	jbe    800fcb <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800fa3:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb2:	48 89 c2             	mov    %rax,%rdx
+  800fb5:	be 00 00 00 00       	mov    $0x0,%esi
+  800fba:	bf 07 00 00 00       	mov    $0x7,%edi
+  800fbf:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800fcb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800fce:	25 00 02 00 00       	and    $0x200,%eax
+  800fd3:	85 c0                	test   %eax,%eax
+  800fd5:	74 04                	je     800fdb <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800fd7:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800fdb:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800fdf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe5:	48 89 c1             	mov    %rax,%rcx
+  800fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fed:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ff7:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  800ffe:	00 00 00 
+  801001:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801003:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801006:	83 e0 20             	and    $0x20,%eax
+  801009:	85 c0                	test   %eax,%eax
+  80100b:	74 2a                	je     801037 <string_cpu+0xfb>
+  80100d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801010:	25 00 00 00 08       	and    $0x8000000,%eax
+  801015:	85 c0                	test   %eax,%eax
+  801017:	74 1e                	je     801037 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801019:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101e:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  801025:	00 00 00 
+  801028:	ff d0                	call   *%rax
+  80102a:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80102d:	48 83 f8 06          	cmp    $0x6,%rax
+  801031:	75 04                	jne    801037 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801033:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801037:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80103e:	00 00 00 
+  801041:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801044:	89 02                	mov    %eax,(%rdx)
+  801046:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80104d:	00 00 00 
+  801050:	8b 00                	mov    (%rax),%eax
+}
+  801052:	c9                   	leave
+  801053:	c3                   	ret
+
+0000000000801054 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801054:	55                   	push   %rbp
+  801055:	48 89 e5             	mov    %rsp,%rbp
+  801058:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80105c:	48 83 ec 60          	sub    $0x60,%rsp
+  801060:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801065:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80106a:	83 e0 1f             	and    $0x1f,%eax
+  80106d:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801071:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801075:	48 f7 d8             	neg    %rax
+  801078:	48 89 c2             	mov    %rax,%rdx
+  80107b:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801080:	48 01 d0             	add    %rdx,%rax
+  801083:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801088:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  80108c:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801092:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801097:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80109b:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8010a1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010a5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010a9:	89 c2                	mov    %eax,%edx
+  8010ab:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010af:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8010b4:	89 c1                	mov    %eax,%ecx
+  8010b6:	d3 e6                	shl    %cl,%esi
+  8010b8:	89 f0                	mov    %esi,%eax
+  8010ba:	21 d0                	and    %edx,%eax
+  8010bc:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8010c0:	eb 21                	jmp    8010e3 <strlen_avx2+0x8f>
+    p += 32;
+  8010c2:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8010c8:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010cd:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010d1:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8010d7:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010db:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010df:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8010e3:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8010e8:	74 d8                	je     8010c2 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8010ea:	31 c0                	xor    %eax,%eax
+  8010ec:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8010f2:	48 63 d0             	movslq %eax,%rdx
+  8010f5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010fa:	48 01 d0             	add    %rdx,%rax
+  8010fd:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+
+0000000000801104 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801104:	55                   	push   %rbp
+  801105:	48 89 e5             	mov    %rsp,%rbp
+  801108:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80110c:	48 83 ec 40          	sub    $0x40,%rsp
+  801110:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801115:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80111a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80111f:	eb 77                	jmp    801198 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801121:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801126:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80112a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80112e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801133:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801137:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80113b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80113f:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801143:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801148:	74 3c                	je     801186 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80114a:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80114e:	f7 d0                	not    %eax
+  801150:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801154:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801158:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80115c:	48 63 d0             	movslq %eax,%rdx
+  80115f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801164:	48 01 d0             	add    %rdx,%rax
+  801167:	0f b6 00             	movzbl (%rax),%eax
+  80116a:	0f b6 c0             	movzbl %al,%eax
+  80116d:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801171:	48 63 ca             	movslq %edx,%rcx
+  801174:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801179:	48 01 ca             	add    %rcx,%rdx
+  80117c:	0f b6 12             	movzbl (%rdx),%edx
+  80117f:	0f b6 d2             	movzbl %dl,%edx
+  801182:	29 d0                	sub    %edx,%eax
+  801184:	eb 6b                	jmp    8011f1 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801186:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80118c:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801192:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801198:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80119e:	77 81                	ja     801121 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8011a0:	eb 42                	jmp    8011e4 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8011a2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011a7:	0f b6 10             	movzbl (%rax),%edx
+  8011aa:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011af:	0f b6 00             	movzbl (%rax),%eax
+  8011b2:	38 c2                	cmp    %al,%dl
+  8011b4:	74 1c                	je     8011d2 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8011b6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011bb:	0f b6 00             	movzbl (%rax),%eax
+  8011be:	0f b6 c8             	movzbl %al,%ecx
+  8011c1:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011c6:	0f b6 00             	movzbl (%rax),%eax
+  8011c9:	0f b6 d0             	movzbl %al,%edx
+  8011cc:	89 c8                	mov    %ecx,%eax
+  8011ce:	29 d0                	sub    %edx,%eax
+  8011d0:	eb 1f                	jmp    8011f1 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8011d2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8011d8:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8011de:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8011e4:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8011ea:	75 b6                	jne    8011a2 <memcmp_avx2+0x9e>
+  return 0;
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+
+00000000008011f3 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8011f3:	55                   	push   %rbp
+  8011f4:	48 89 e5             	mov    %rsp,%rbp
+  8011f7:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8011fb:	48 83 ec 60          	sub    $0x60,%rsp
+  8011ff:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801204:	89 f0                	mov    %esi,%eax
+  801206:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80120b:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80120f:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801214:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801218:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80121d:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801223:	eb 47                	jmp    80126c <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801225:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80122a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80122e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801232:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801238:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80123c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801240:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801244:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801249:	74 15                	je     801260 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80124b:	31 c0                	xor    %eax,%eax
+  80124d:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801253:	48 63 d0             	movslq %eax,%rdx
+  801256:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80125b:	48 01 d0             	add    %rdx,%rax
+  80125e:	eb 3d                	jmp    80129d <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801260:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801266:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80126c:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801272:	77 b1                	ja     801225 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801274:	eb 0c                	jmp    801282 <memfind_avx2+0x8f>
+  801276:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80127c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801282:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801288:	74 0e                	je     801298 <memfind_avx2+0xa5>
+  80128a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80128f:	0f b6 00             	movzbl (%rax),%eax
+  801292:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801296:	75 de                	jne    801276 <memfind_avx2+0x83>
+  return s;
+  801298:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80129d:	c9                   	leave
+  80129e:	c3                   	ret
+
+000000000080129f <strlen>:
+strlen(const char *s) {
+  80129f:	55                   	push   %rbp
+  8012a0:	48 89 e5             	mov    %rsp,%rbp
+  8012a3:	48 83 ec 40          	sub    $0x40,%rsp
+  8012a7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8012ab:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8012af:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8012b3:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  8012ba:	00 00 00 
+  8012bd:	ff d0                	call   *%rax
+  8012bf:	83 e0 02             	and    $0x2,%eax
+  8012c2:	85 c0                	test   %eax,%eax
+  8012c4:	74 18                	je     8012de <strlen+0x3f>
+    return strlen_avx2(s);
+  8012c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012ca:	48 89 c7             	mov    %rax,%rdi
+  8012cd:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8012d4:	00 00 00 
+  8012d7:	ff d0                	call   *%rax
+  8012d9:	e9 82 00 00 00       	jmp    801360 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8012de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012e2:	83 e0 0f             	and    $0xf,%eax
+  8012e5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8012e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012eb:	48 f7 d8             	neg    %rax
+  8012ee:	48 89 c2             	mov    %rax,%rdx
+  8012f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012f5:	48 01 d0             	add    %rdx,%rax
+  8012f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8012fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801300:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801304:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801309:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80130d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801311:	89 c2                	mov    %eax,%edx
+  801313:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801316:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80131b:	89 c1                	mov    %eax,%ecx
+  80131d:	d3 e6                	shl    %cl,%esi
+  80131f:	89 f0                	mov    %esi,%eax
+  801321:	21 d0                	and    %edx,%eax
+  801323:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801326:	eb 1d                	jmp    801345 <strlen+0xa6>
+    p += 16;
+  801328:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80132d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801331:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801335:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80133a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80133e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801342:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801345:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801349:	74 dd                	je     801328 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80134b:	31 c0                	xor    %eax,%eax
+  80134d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801352:	48 63 d0             	movslq %eax,%rdx
+  801355:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801359:	48 01 d0             	add    %rdx,%rax
+  80135c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801360:	c9                   	leave
+  801361:	c3                   	ret
+
+0000000000801362 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801362:	55                   	push   %rbp
+  801363:	48 89 e5             	mov    %rsp,%rbp
+  801366:	48 83 ec 20          	sub    $0x20,%rsp
+  80136a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80136e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801372:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801379:	eb 0e                	jmp    801389 <strnlen+0x27>
+    n++;
+  80137b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80137f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801384:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801389:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80138e:	74 0b                	je     80139b <strnlen+0x39>
+  801390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801394:	0f b6 00             	movzbl (%rax),%eax
+  801397:	84 c0                	test   %al,%al
+  801399:	75 e0                	jne    80137b <strnlen+0x19>
+  return n;
+  80139b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80139e:	c9                   	leave
+  80139f:	c3                   	ret
+
+00000000008013a0 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+  8013a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8013a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8013b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8013b8:	90                   	nop
+  8013b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013bd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013d1:	0f b6 12             	movzbl (%rdx),%edx
+  8013d4:	88 10                	mov    %dl,(%rax)
+  8013d6:	0f b6 00             	movzbl (%rax),%eax
+  8013d9:	84 c0                	test   %al,%al
+  8013db:	75 dc                	jne    8013b9 <strcpy+0x19>
+  return ret;
+  8013dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+
+00000000008013e3 <strcat>:
+strcat(char *dst, const char *src) {
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8013eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8013f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f7:	48 89 c7             	mov    %rax,%rdi
+  8013fa:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  801401:	00 00 00 
+  801404:	ff d0                	call   *%rax
+  801406:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801409:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80140c:	48 63 d0             	movslq %eax,%rdx
+  80140f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801413:	48 01 c2             	add    %rax,%rdx
+  801416:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80141a:	48 89 c6             	mov    %rax,%rsi
+  80141d:	48 89 d7             	mov    %rdx,%rdi
+  801420:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  801427:	00 00 00 
+  80142a:	ff d0                	call   *%rax
+  return dst;
+  80142c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801430:	c9                   	leave
+  801431:	c3                   	ret
+
+0000000000801432 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	48 83 ec 28          	sub    $0x28,%rsp
+  80143a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80143e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801442:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80144a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80144e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801455:	00 
+  801456:	eb 2a                	jmp    801482 <strncpy+0x50>
+    *dst++ = *src;
+  801458:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80145c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801460:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801464:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801468:	0f b6 12             	movzbl (%rdx),%edx
+  80146b:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80146d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801471:	0f b6 00             	movzbl (%rax),%eax
+  801474:	84 c0                	test   %al,%al
+  801476:	74 05                	je     80147d <strncpy+0x4b>
+      src++;
+  801478:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80147d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801482:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801486:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80148a:	72 cc                	jb     801458 <strncpy+0x26>
+  return ret;
+  80148c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801490:	c9                   	leave
+  801491:	c3                   	ret
+
+0000000000801492 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801492:	55                   	push   %rbp
+  801493:	48 89 e5             	mov    %rsp,%rbp
+  801496:	48 83 ec 28          	sub    $0x28,%rsp
+  80149a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80149e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8014a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014aa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8014ae:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014b3:	74 3d                	je     8014f2 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8014b5:	eb 1d                	jmp    8014d4 <strlcpy+0x42>
+      *dst++ = *src++;
+  8014b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014bb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014cb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014cf:	0f b6 12             	movzbl (%rdx),%edx
+  8014d2:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8014d4:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8014d9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014de:	74 0b                	je     8014eb <strlcpy+0x59>
+  8014e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014e4:	0f b6 00             	movzbl (%rax),%eax
+  8014e7:	84 c0                	test   %al,%al
+  8014e9:	75 cc                	jne    8014b7 <strlcpy+0x25>
+    *dst = '\0';
+  8014eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ef:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8014f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f6:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8014fa:	c9                   	leave
+  8014fb:	c3                   	ret
+
+00000000008014fc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014fc:	55                   	push   %rbp
+  8014fd:	48 89 e5             	mov    %rsp,%rbp
+  801500:	48 83 ec 30          	sub    $0x30,%rsp
+  801504:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801508:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80150c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801510:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801514:	48 89 c7             	mov    %rax,%rdi
+  801517:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+  801523:	48 98                	cltq
+  801525:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801529:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80152d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801531:	48 89 d6             	mov    %rdx,%rsi
+  801534:	48 89 c7             	mov    %rax,%rdi
+  801537:	48 b8 62 13 80 00 00 	movabs $0x801362,%rax
+  80153e:	00 00 00 
+  801541:	ff d0                	call   *%rax
+  801543:	48 98                	cltq
+  801545:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801549:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80154d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801551:	75 10                	jne    801563 <strlcat+0x67>
+    return maxlen + srclen;
+  801553:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80155b:	48 01 d0             	add    %rdx,%rax
+  80155e:	e9 86 00 00 00       	jmp    8015e9 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801563:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801567:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80156b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80156f:	73 2b                	jae    80159c <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801571:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801575:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801579:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80157d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801581:	48 01 c1             	add    %rax,%rcx
+  801584:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801588:	48 89 c6             	mov    %rax,%rsi
+  80158b:	48 89 cf             	mov    %rcx,%rdi
+  80158e:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  801595:	00 00 00 
+  801598:	ff d0                	call   *%rax
+  80159a:	eb 42                	jmp    8015de <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80159c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015a0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015a4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ac:	48 01 c1             	add    %rax,%rcx
+  8015af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b3:	48 89 c6             	mov    %rax,%rsi
+  8015b6:	48 89 cf             	mov    %rcx,%rdi
+  8015b9:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  8015c0:	00 00 00 
+  8015c3:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8015c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015cd:	48 01 d0             	add    %rdx,%rax
+  8015d0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d8:	48 01 d0             	add    %rdx,%rax
+  8015db:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8015de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e6:	48 01 d0             	add    %rdx,%rax
+}
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+00000000008015eb <strcmp>:
+strcmp(const char *p, const char *q) {
+  8015eb:	55                   	push   %rbp
+  8015ec:	48 89 e5             	mov    %rsp,%rbp
+  8015ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8015f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8015fb:	eb 0a                	jmp    801607 <strcmp+0x1c>
+    p++, q++;
+  8015fd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801602:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80160b:	0f b6 00             	movzbl (%rax),%eax
+  80160e:	84 c0                	test   %al,%al
+  801610:	74 12                	je     801624 <strcmp+0x39>
+  801612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801616:	0f b6 10             	movzbl (%rax),%edx
+  801619:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161d:	0f b6 00             	movzbl (%rax),%eax
+  801620:	38 c2                	cmp    %al,%dl
+  801622:	74 d9                	je     8015fd <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801628:	0f b6 00             	movzbl (%rax),%eax
+  80162b:	0f b6 d0             	movzbl %al,%edx
+  80162e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801632:	0f b6 00             	movzbl (%rax),%eax
+  801635:	0f b6 c0             	movzbl %al,%eax
+  801638:	29 c2                	sub    %eax,%edx
+  80163a:	89 d0                	mov    %edx,%eax
+}
+  80163c:	c9                   	leave
+  80163d:	c3                   	ret
+
+000000000080163e <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80163e:	55                   	push   %rbp
+  80163f:	48 89 e5             	mov    %rsp,%rbp
+  801642:	48 83 ec 18          	sub    $0x18,%rsp
+  801646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80164a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80164e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801652:	eb 0f                	jmp    801663 <strncmp+0x25>
+    n--, p++, q++;
+  801654:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801659:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80165e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801663:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801668:	74 1d                	je     801687 <strncmp+0x49>
+  80166a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166e:	0f b6 00             	movzbl (%rax),%eax
+  801671:	84 c0                	test   %al,%al
+  801673:	74 12                	je     801687 <strncmp+0x49>
+  801675:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801679:	0f b6 10             	movzbl (%rax),%edx
+  80167c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801680:	0f b6 00             	movzbl (%rax),%eax
+  801683:	38 c2                	cmp    %al,%dl
+  801685:	74 cd                	je     801654 <strncmp+0x16>
+  if (n == 0)
+  801687:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80168c:	75 07                	jne    801695 <strncmp+0x57>
+    return 0;
+  80168e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801693:	eb 16                	jmp    8016ab <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801699:	0f b6 00             	movzbl (%rax),%eax
+  80169c:	0f b6 d0             	movzbl %al,%edx
+  80169f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016a3:	0f b6 00             	movzbl (%rax),%eax
+  8016a6:	0f b6 c0             	movzbl %al,%eax
+  8016a9:	29 c2                	sub    %eax,%edx
+}
+  8016ab:	89 d0                	mov    %edx,%eax
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+
+00000000008016af <strchr>:
+strchr(const char *s, char c) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+  8016b3:	48 83 ec 60          	sub    $0x60,%rsp
+  8016b7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8016bb:	89 f0                	mov    %esi,%eax
+  8016bd:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8016c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016c4:	83 e0 0f             	and    $0xf,%eax
+  8016c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8016ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8016cd:	48 f7 d8             	neg    %rax
+  8016d0:	48 89 c2             	mov    %rax,%rdx
+  8016d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016d7:	48 01 d0             	add    %rdx,%rax
+  8016da:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8016de:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016e2:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8016e6:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8016ea:	66 0f 6e c0          	movd   %eax,%xmm0
+  8016ee:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8016f2:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8016f6:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8016fb:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8016ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801703:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801707:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80170b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801710:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801715:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801719:	89 c2                	mov    %eax,%edx
+  80171b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801720:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801725:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801729:	09 c2                	or     %eax,%edx
+  80172b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80172e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801733:	89 c1                	mov    %eax,%ecx
+  801735:	d3 e6                	shl    %cl,%esi
+  801737:	89 f0                	mov    %esi,%eax
+  801739:	21 d0                	and    %edx,%eax
+  80173b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80173e:	eb 34                	jmp    801774 <strchr+0xc5>
+    p += 16;
+  801740:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801745:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801749:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80174d:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801751:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801756:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80175b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80175f:	89 c2                	mov    %eax,%edx
+  801761:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801766:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80176b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80176f:	09 d0                	or     %edx,%eax
+  801771:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801774:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801778:	74 c6                	je     801740 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80177a:	31 c0                	xor    %eax,%eax
+  80177c:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801781:	48 98                	cltq
+  801783:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801787:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178b:	0f b6 00             	movzbl (%rax),%eax
+  80178e:	84 c0                	test   %al,%al
+  801790:	74 06                	je     801798 <strchr+0xe9>
+  801792:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801796:	eb 05                	jmp    80179d <strchr+0xee>
+  801798:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80179d:	c9                   	leave
+  80179e:	c3                   	ret
+
+000000000080179f <strfind>:
+strfind(const char *s, char c) {
+  80179f:	55                   	push   %rbp
+  8017a0:	48 89 e5             	mov    %rsp,%rbp
+  8017a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8017a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ab:	89 f0                	mov    %esi,%eax
+  8017ad:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8017b0:	eb 11                	jmp    8017c3 <strfind+0x24>
+    if (*s == c)
+  8017b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b6:	0f b6 00             	movzbl (%rax),%eax
+  8017b9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017bc:	74 12                	je     8017d0 <strfind+0x31>
+  for (; *s; s++)
+  8017be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c7:	0f b6 00             	movzbl (%rax),%eax
+  8017ca:	84 c0                	test   %al,%al
+  8017cc:	75 e4                	jne    8017b2 <strfind+0x13>
+  8017ce:	eb 01                	jmp    8017d1 <strfind+0x32>
+      break;
+  8017d0:	90                   	nop
+  return (char *)s;
+  8017d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017d5:	c9                   	leave
+  8017d6:	c3                   	ret
+
+00000000008017d7 <memset>:
+memset(void *v, int c, size_t n) {
+  8017d7:	55                   	push   %rbp
+  8017d8:	48 89 e5             	mov    %rsp,%rbp
+  8017db:	48 83 ec 38          	sub    $0x38,%rsp
+  8017df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017e3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8017e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8017ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8017f2:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8017f7:	76 41                	jbe    80183a <memset+0x63>
+  8017f9:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+  801805:	83 e0 01             	and    $0x1,%eax
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	74 2e                	je     80183a <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80180c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80180f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801813:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801817:	48 89 ce             	mov    %rcx,%rsi
+  80181a:	48 89 f7             	mov    %rsi,%rdi
+  80181d:	48 89 d1             	mov    %rdx,%rcx
+  801820:	fc                   	cld
+  801821:	f3 aa                	rep stos %al,%es:(%rdi)
+  801823:	48 89 ca             	mov    %rcx,%rdx
+  801826:	48 89 fe             	mov    %rdi,%rsi
+  801829:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80182d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801831:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801835:	e9 a7 00 00 00       	jmp    8018e1 <memset+0x10a>
+  if (n >= 8) {
+  80183a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80183f:	0f 86 87 00 00 00    	jbe    8018cc <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801845:	eb 16                	jmp    80185d <memset+0x86>
+      *p++ = c;
+  801847:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80184f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801853:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801856:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801858:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80185d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801861:	83 e0 07             	and    $0x7,%eax
+  801864:	48 85 c0             	test   %rax,%rax
+  801867:	75 de                	jne    801847 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801869:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80186c:	0f b6 c0             	movzbl %al,%eax
+  80186f:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801876:	01 01 01 
+  801879:	48 0f af c2          	imul   %rdx,%rax
+  80187d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801881:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801885:	48 c1 e8 03          	shr    $0x3,%rax
+  801889:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80188d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801891:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801895:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801899:	48 89 ce             	mov    %rcx,%rsi
+  80189c:	48 89 f7             	mov    %rsi,%rdi
+  80189f:	48 89 d1             	mov    %rdx,%rcx
+  8018a2:	fc                   	cld
+  8018a3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8018a6:	48 89 ca             	mov    %rcx,%rdx
+  8018a9:	48 89 fe             	mov    %rdi,%rsi
+  8018ac:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8018b0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8018b4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8018b9:	eb 11                	jmp    8018cc <memset+0xf5>
+    *p++ = c;
+  8018bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018bf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018c3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018c7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018ca:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8018cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018d0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018d8:	48 85 c0             	test   %rax,%rax
+  8018db:	75 de                	jne    8018bb <memset+0xe4>
+  return v;
+  8018dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+00000000008018e3 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8018e3:	55                   	push   %rbp
+  8018e4:	48 89 e5             	mov    %rsp,%rbp
+  8018e7:	48 83 ec 38          	sub    $0x38,%rsp
+  8018eb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018ef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8018f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018fb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8018ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801903:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801907:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80190f:	0f 83 da 00 00 00    	jae    8019ef <memmove+0x10c>
+  801915:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801919:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80191d:	48 01 d0             	add    %rdx,%rax
+  801920:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801924:	0f 83 c5 00 00 00    	jae    8019ef <memmove+0x10c>
+    s += n;
+  80192a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801932:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801936:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80193a:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80193f:	0f 86 94 00 00 00    	jbe    8019d9 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801945:	eb 1c                	jmp    801963 <memmove+0x80>
+        *--d = *--s;
+  801947:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80194c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801951:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801955:	0f b6 10             	movzbl (%rax),%edx
+  801958:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195c:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80195e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801963:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801967:	83 e0 07             	and    $0x7,%eax
+  80196a:	48 85 c0             	test   %rax,%rax
+  80196d:	75 d8                	jne    801947 <memmove+0x64>
+      nq = n / 8;
+  80196f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801973:	48 c1 e8 03          	shr    $0x3,%rax
+  801977:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80197b:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801980:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801985:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80198a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80198e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801996:	48 89 cf             	mov    %rcx,%rdi
+  801999:	48 89 d6             	mov    %rdx,%rsi
+  80199c:	48 89 c1             	mov    %rax,%rcx
+  80199f:	fd                   	std
+  8019a0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019a3:	fc                   	cld
+  8019a4:	48 89 c8             	mov    %rcx,%rax
+  8019a7:	48 89 f2             	mov    %rsi,%rdx
+  8019aa:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019ae:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8019b6:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8019bb:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8019c0:	eb 17                	jmp    8019d9 <memmove+0xf6>
+      *--d = *--s;
+  8019c2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019c7:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d0:	0f b6 10             	movzbl (%rax),%edx
+  8019d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d7:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019dd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019e5:	48 85 c0             	test   %rax,%rax
+  8019e8:	75 d8                	jne    8019c2 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8019ea:	e9 f4 00 00 00       	jmp    801ae3 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019ef:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8019f4:	76 46                	jbe    801a3c <memmove+0x159>
+  8019f6:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+  801a02:	83 e0 01             	and    $0x1,%eax
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	74 33                	je     801a3c <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a09:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a15:	48 89 cf             	mov    %rcx,%rdi
+  801a18:	48 89 d6             	mov    %rdx,%rsi
+  801a1b:	48 89 c1             	mov    %rax,%rcx
+  801a1e:	fc                   	cld
+  801a1f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a21:	48 89 c8             	mov    %rcx,%rax
+  801a24:	48 89 f2             	mov    %rsi,%rdx
+  801a27:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a2b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801a33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a37:	e9 ab 00 00 00       	jmp    801ae7 <memmove+0x204>
+    if (n >= 8) {
+  801a3c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a41:	0f 86 8b 00 00 00    	jbe    801ad2 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801a47:	eb 22                	jmp    801a6b <memmove+0x188>
+        *d++ = *s++;
+  801a49:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a4d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a59:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a5d:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801a61:	0f b6 12             	movzbl (%rdx),%edx
+  801a64:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a66:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6f:	83 e0 07             	and    $0x7,%eax
+  801a72:	48 85 c0             	test   %rax,%rax
+  801a75:	75 d2                	jne    801a49 <memmove+0x166>
+      nq = n / 8;
+  801a77:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a7b:	48 c1 e8 03          	shr    $0x3,%rax
+  801a7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801a83:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a87:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a8f:	48 89 cf             	mov    %rcx,%rdi
+  801a92:	48 89 d6             	mov    %rdx,%rsi
+  801a95:	48 89 c1             	mov    %rax,%rcx
+  801a98:	fc                   	cld
+  801a99:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a9c:	48 89 c8             	mov    %rcx,%rax
+  801a9f:	48 89 f2             	mov    %rsi,%rdx
+  801aa2:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801aa6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801aaa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801aae:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801ab3:	eb 1d                	jmp    801ad2 <memmove+0x1ef>
+      *d++ = *s++;
+  801ab5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ab9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801abd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ac1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ac9:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801acd:	0f b6 12             	movzbl (%rdx),%edx
+  801ad0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ad2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ad6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ada:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ade:	48 85 c0             	test   %rax,%rax
+  801ae1:	75 d2                	jne    801ab5 <memmove+0x1d2>
+  return dst;
+  801ae3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+0000000000801ae9 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ae9:	55                   	push   %rbp
+  801aea:	48 89 e5             	mov    %rsp,%rbp
+  801aed:	48 83 ec 18          	sub    $0x18,%rsp
+  801af1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801af5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801af9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801afd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b01:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b09:	48 89 ce             	mov    %rcx,%rsi
+  801b0c:	48 89 c7             	mov    %rax,%rdi
+  801b0f:	48 b8 e3 18 80 00 00 	movabs $0x8018e3,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+}
+  801b1b:	c9                   	leave
+  801b1c:	c3                   	ret
+
+0000000000801b1d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801b1d:	55                   	push   %rbp
+  801b1e:	48 89 e5             	mov    %rsp,%rbp
+  801b21:	48 83 ec 40          	sub    $0x40,%rsp
+  801b25:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b29:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b2d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801b31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801b39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b41:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801b46:	0f 86 a7 00 00 00    	jbe    801bf3 <memcmp+0xd6>
+  801b4c:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	83 e0 02             	and    $0x2,%eax
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	0f 84 90 00 00 00    	je     801bf3 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801b63:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b67:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b6f:	48 89 ce             	mov    %rcx,%rsi
+  801b72:	48 89 c7             	mov    %rax,%rdi
+  801b75:	48 b8 04 11 80 00 00 	movabs $0x801104,%rax
+  801b7c:	00 00 00 
+  801b7f:	ff d0                	call   *%rax
+  801b81:	e9 c2 00 00 00       	jmp    801c48 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b8a:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b8e:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801b92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b96:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b9a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b9e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ba2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801ba5:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801bac:	74 36                	je     801be4 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bb1:	f7 d0                	not    %eax
+  801bb3:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801bb7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801bba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801bbd:	48 63 d0             	movslq %eax,%rdx
+  801bc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc4:	48 01 d0             	add    %rdx,%rax
+  801bc7:	0f b6 00             	movzbl (%rax),%eax
+  801bca:	0f b6 c0             	movzbl %al,%eax
+  801bcd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801bd0:	48 63 ca             	movslq %edx,%rcx
+  801bd3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bd7:	48 01 ca             	add    %rcx,%rdx
+  801bda:	0f b6 12             	movzbl (%rdx),%edx
+  801bdd:	0f b6 d2             	movzbl %dl,%edx
+  801be0:	29 d0                	sub    %edx,%eax
+  801be2:	eb 64                	jmp    801c48 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801be4:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801be9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801bee:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801bf3:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801bf8:	77 8c                	ja     801b86 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801bfa:	eb 36                	jmp    801c32 <memcmp+0x115>
+    if (*s1 != *s2)
+  801bfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c00:	0f b6 10             	movzbl (%rax),%edx
+  801c03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c07:	0f b6 00             	movzbl (%rax),%eax
+  801c0a:	38 c2                	cmp    %al,%dl
+  801c0c:	74 1a                	je     801c28 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c12:	0f b6 00             	movzbl (%rax),%eax
+  801c15:	0f b6 c8             	movzbl %al,%ecx
+  801c18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c1c:	0f b6 00             	movzbl (%rax),%eax
+  801c1f:	0f b6 d0             	movzbl %al,%edx
+  801c22:	89 c8                	mov    %ecx,%eax
+  801c24:	29 d0                	sub    %edx,%eax
+  801c26:	eb 20                	jmp    801c48 <memcmp+0x12b>
+    s1++, s2++;
+  801c28:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c2d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801c32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c36:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c3a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c3e:	48 85 c0             	test   %rax,%rax
+  801c41:	75 b9                	jne    801bfc <memcmp+0xdf>
+  }
+
+  return 0;
+  801c43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c48:	c9                   	leave
+  801c49:	c3                   	ret
+
+0000000000801c4a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	48 83 ec 50          	sub    $0x50,%rsp
+  801c52:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c56:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801c59:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801c5d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801c65:	48 01 d0             	add    %rdx,%rax
+  801c68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801c6c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801c6f:	66 0f 6e c0          	movd   %eax,%xmm0
+  801c73:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801c77:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801c7b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801c80:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801c84:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801c89:	76 73                	jbe    801cfe <memfind+0xb4>
+  801c8b:	48 b8 3c 0f 80 00 00 	movabs $0x800f3c,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	83 e0 02             	and    $0x2,%eax
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	74 60                	je     801cfe <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801c9e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ca1:	0f b6 c8             	movzbl %al,%ecx
+  801ca4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ca8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cac:	89 ce                	mov    %ecx,%esi
+  801cae:	48 89 c7             	mov    %rax,%rdi
+  801cb1:	48 b8 f3 11 80 00 00 	movabs $0x8011f3,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+  801cbd:	eb 6c                	jmp    801d2b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801cbf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc3:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cc7:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ccb:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801cd0:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801cd4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801cd8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801cdb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801cdf:	74 13                	je     801cf4 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801ce1:	31 c0                	xor    %eax,%eax
+  801ce3:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801ce8:	48 63 d0             	movslq %eax,%rdx
+  801ceb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cef:	48 01 d0             	add    %rdx,%rax
+  801cf2:	eb 37                	jmp    801d2b <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801cf4:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801cf9:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801cfe:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d03:	77 ba                	ja     801cbf <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d05:	eb 13                	jmp    801d1a <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d0b:	0f b6 00             	movzbl (%rax),%eax
+  801d0e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d11:	38 d0                	cmp    %dl,%al
+  801d13:	74 11                	je     801d26 <memfind+0xdc>
+  for (; s < ends; s++)
+  801d15:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801d1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d22:	72 e3                	jb     801d07 <memfind+0xbd>
+  801d24:	eb 01                	jmp    801d27 <memfind+0xdd>
+      break;
+  801d26:	90                   	nop
+  return (void *)s;
+  801d27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d2b:	c9                   	leave
+  801d2c:	c3                   	ret
+
+0000000000801d2d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d2d:	55                   	push   %rbp
+  801d2e:	48 89 e5             	mov    %rsp,%rbp
+  801d31:	48 83 ec 38          	sub    $0x38,%rsp
+  801d35:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d39:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d3d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801d40:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801d47:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d4e:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801d4f:	eb 05                	jmp    801d56 <strtol+0x29>
+    s++;
+  801d51:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801d56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5a:	0f b6 00             	movzbl (%rax),%eax
+  801d5d:	3c 20                	cmp    $0x20,%al
+  801d5f:	74 f0                	je     801d51 <strtol+0x24>
+  801d61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d65:	0f b6 00             	movzbl (%rax),%eax
+  801d68:	3c 09                	cmp    $0x9,%al
+  801d6a:	74 e5                	je     801d51 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801d6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d70:	0f b6 00             	movzbl (%rax),%eax
+  801d73:	3c 2b                	cmp    $0x2b,%al
+  801d75:	75 07                	jne    801d7e <strtol+0x51>
+    s++;
+  801d77:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d7c:	eb 17                	jmp    801d95 <strtol+0x68>
+  else if (*s == '-')
+  801d7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d82:	0f b6 00             	movzbl (%rax),%eax
+  801d85:	3c 2d                	cmp    $0x2d,%al
+  801d87:	75 0c                	jne    801d95 <strtol+0x68>
+    s++, neg = 1;
+  801d89:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d8e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801d95:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d99:	74 06                	je     801da1 <strtol+0x74>
+  801d9b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d9f:	75 28                	jne    801dc9 <strtol+0x9c>
+  801da1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da5:	0f b6 00             	movzbl (%rax),%eax
+  801da8:	3c 30                	cmp    $0x30,%al
+  801daa:	75 1d                	jne    801dc9 <strtol+0x9c>
+  801dac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db0:	48 83 c0 01          	add    $0x1,%rax
+  801db4:	0f b6 00             	movzbl (%rax),%eax
+  801db7:	3c 78                	cmp    $0x78,%al
+  801db9:	75 0e                	jne    801dc9 <strtol+0x9c>
+    s += 2, base = 16;
+  801dbb:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801dc0:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801dc7:	eb 2c                	jmp    801df5 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801dc9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dcd:	75 19                	jne    801de8 <strtol+0xbb>
+  801dcf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd3:	0f b6 00             	movzbl (%rax),%eax
+  801dd6:	3c 30                	cmp    $0x30,%al
+  801dd8:	75 0e                	jne    801de8 <strtol+0xbb>
+    s++, base = 8;
+  801dda:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ddf:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801de6:	eb 0d                	jmp    801df5 <strtol+0xc8>
+  else if (base == 0)
+  801de8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dec:	75 07                	jne    801df5 <strtol+0xc8>
+    base = 10;
+  801dee:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801df5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df9:	0f b6 00             	movzbl (%rax),%eax
+  801dfc:	3c 2f                	cmp    $0x2f,%al
+  801dfe:	7e 1d                	jle    801e1d <strtol+0xf0>
+  801e00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e04:	0f b6 00             	movzbl (%rax),%eax
+  801e07:	3c 39                	cmp    $0x39,%al
+  801e09:	7f 12                	jg     801e1d <strtol+0xf0>
+      dig = *s - '0';
+  801e0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e0f:	0f b6 00             	movzbl (%rax),%eax
+  801e12:	0f be c0             	movsbl %al,%eax
+  801e15:	83 e8 30             	sub    $0x30,%eax
+  801e18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e1b:	eb 4e                	jmp    801e6b <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801e1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e21:	0f b6 00             	movzbl (%rax),%eax
+  801e24:	3c 60                	cmp    $0x60,%al
+  801e26:	7e 1d                	jle    801e45 <strtol+0x118>
+  801e28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e2c:	0f b6 00             	movzbl (%rax),%eax
+  801e2f:	3c 7a                	cmp    $0x7a,%al
+  801e31:	7f 12                	jg     801e45 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801e33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e37:	0f b6 00             	movzbl (%rax),%eax
+  801e3a:	0f be c0             	movsbl %al,%eax
+  801e3d:	83 e8 57             	sub    $0x57,%eax
+  801e40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e43:	eb 26                	jmp    801e6b <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801e45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e49:	0f b6 00             	movzbl (%rax),%eax
+  801e4c:	3c 40                	cmp    $0x40,%al
+  801e4e:	7e 47                	jle    801e97 <strtol+0x16a>
+  801e50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e54:	0f b6 00             	movzbl (%rax),%eax
+  801e57:	3c 5a                	cmp    $0x5a,%al
+  801e59:	7f 3c                	jg     801e97 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801e5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e5f:	0f b6 00             	movzbl (%rax),%eax
+  801e62:	0f be c0             	movsbl %al,%eax
+  801e65:	83 e8 37             	sub    $0x37,%eax
+  801e68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801e6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e6e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e71:	7d 23                	jge    801e96 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801e73:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e78:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e7b:	48 98                	cltq
+  801e7d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801e82:	48 89 c2             	mov    %rax,%rdx
+  801e85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e88:	48 98                	cltq
+  801e8a:	48 01 d0             	add    %rdx,%rax
+  801e8d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801e91:	e9 5f ff ff ff       	jmp    801df5 <strtol+0xc8>
+      break;
+  801e96:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801e97:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e9c:	74 0b                	je     801ea9 <strtol+0x17c>
+    *endptr = (char *)s;
+  801e9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ea6:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801ea9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ead:	74 09                	je     801eb8 <strtol+0x18b>
+  801eaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801eb3:	48 f7 d8             	neg    %rax
+  801eb6:	eb 04                	jmp    801ebc <strtol+0x18f>
+  801eb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+
+0000000000801ebe <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801ebe:	55                   	push   %rbp
+  801ebf:	48 89 e5             	mov    %rsp,%rbp
+  801ec2:	53                   	push   %rbx
+  801ec3:	48 83 ec 48          	sub    $0x48,%rsp
+  801ec7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ecb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ecf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ed3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801ed7:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801edb:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801edf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ee7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801eeb:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801eef:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801ef3:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ef7:	4c 89 c3             	mov    %r8,%rbx
+  801efa:	cd 30                	int    $0x30
+  801efc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f00:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f05:	74 46                	je     801f4d <syscall+0x8f>
+  801f07:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f0c:	7e 3f                	jle    801f4d <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f16:	49 89 d0             	mov    %rdx,%r8
+  801f19:	48 89 c1             	mov    %rax,%rcx
+  801f1c:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  801f23:	00 00 00 
+  801f26:	48 89 c2             	mov    %rax,%rdx
+  801f29:	be 22 00 00 00       	mov    $0x22,%esi
+  801f2e:	48 b8 a7 6a 80 00 00 	movabs $0x806aa7,%rax
+  801f35:	00 00 00 
+  801f38:	48 89 c7             	mov    %rax,%rdi
+  801f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f40:	49 b9 b8 5b 80 00 00 	movabs $0x805bb8,%r9
+  801f47:	00 00 00 
+  801f4a:	41 ff d1             	call   *%r9
+
+  return ret;
+  801f4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+
+0000000000801f57 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801f57:	55                   	push   %rbp
+  801f58:	48 89 e5             	mov    %rsp,%rbp
+  801f5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f67:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f6f:	48 83 ec 08          	sub    $0x8,%rsp
+  801f73:	6a 00                	push   $0x0
+  801f75:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f81:	48 89 d1             	mov    %rdx,%rcx
+  801f84:	48 89 c2             	mov    %rax,%rdx
+  801f87:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f91:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+  801f9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fa1:	90                   	nop
+  801fa2:	c9                   	leave
+  801fa3:	c3                   	ret
+
+0000000000801fa4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801fa4:	55                   	push   %rbp
+  801fa5:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801fa8:	48 83 ec 08          	sub    $0x8,%rsp
+  801fac:	6a 00                	push   $0x0
+  801fae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc9:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fce:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801feb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fee:	48 98                	cltq
+  801ff0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802007:	48 89 c2             	mov    %rax,%rdx
+  80200a:	be 01 00 00 00       	mov    $0x1,%esi
+  80200f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802014:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+0000000000802026 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	48 83 ec 10          	sub    $0x10,%rsp
+  80202e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802031:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802034:	48 98                	cltq
+  802036:	48 83 ec 08          	sub    $0x8,%rsp
+  80203a:	6a 00                	push   $0x0
+  80203c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204d:	48 89 c2             	mov    %rax,%rdx
+  802050:	be 00 00 00 00       	mov    $0x0,%esi
+  802055:	bf 04 00 00 00       	mov    $0x4,%edi
+  80205a:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80206a:	90                   	nop
+  80206b:	c9                   	leave
+  80206c:	c3                   	ret
+
+000000000080206d <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80206d:	55                   	push   %rbp
+  80206e:	48 89 e5             	mov    %rsp,%rbp
+  802071:	48 83 ec 20          	sub    $0x20,%rsp
+  802075:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802078:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80207c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80207f:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802082:	b8 05 00 00 00       	mov    $0x5,%eax
+  802087:	cd 30                	int    $0x30
+  802089:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80208d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802091:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802096:	7e 3d                	jle    8020d5 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802098:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80209c:	49 89 c0             	mov    %rax,%r8
+  80209f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8020a4:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  8020ab:	00 00 00 
+  8020ae:	48 89 c2             	mov    %rax,%rdx
+  8020b1:	be 49 00 00 00       	mov    $0x49,%esi
+  8020b6:	48 b8 a7 6a 80 00 00 	movabs $0x806aa7,%rax
+  8020bd:	00 00 00 
+  8020c0:	48 89 c7             	mov    %rax,%rdi
+  8020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c8:	49 b9 b8 5b 80 00 00 	movabs $0x805bb8,%r9
+  8020cf:	00 00 00 
+  8020d2:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8020d5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8020da:	75 13                	jne    8020ef <sys_env_wait+0x82>
+  8020dc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8020e1:	74 0c                	je     8020ef <sys_env_wait+0x82>
+    *status = st;
+  8020e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020e7:	89 c2                	mov    %eax,%edx
+  8020e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020ed:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8020ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8020f3:	c9                   	leave
+  8020f4:	c3                   	ret
+
+00000000008020f5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8020f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020fd:	6a 00                	push   $0x0
+  8020ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802105:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80210b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802110:	ba 00 00 00 00       	mov    $0x0,%edx
+  802115:	be 00 00 00 00       	mov    $0x0,%esi
+  80211a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80211f:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802126:	00 00 00 
+  802129:	ff d0                	call   *%rax
+  80212b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80212f:	c9                   	leave
+  802130:	c3                   	ret
+
+0000000000802131 <sys_yield>:
+
+void
+sys_yield(void) {
+  802131:	55                   	push   %rbp
+  802132:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802135:	48 83 ec 08          	sub    $0x8,%rsp
+  802139:	6a 00                	push   $0x0
+  80213b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802147:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80214c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802151:	be 00 00 00 00       	mov    $0x0,%esi
+  802156:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80215b:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216b:	90                   	nop
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+
+000000000080216e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80216e:	55                   	push   %rbp
+  80216f:	48 89 e5             	mov    %rsp,%rbp
+  802172:	48 83 ec 20          	sub    $0x20,%rsp
+  802176:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802179:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80217d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802180:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802183:	48 63 c8             	movslq %eax,%rcx
+  802186:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80218a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80218d:	48 98                	cltq
+  80218f:	48 83 ec 08          	sub    $0x8,%rsp
+  802193:	6a 00                	push   $0x0
+  802195:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219b:	49 89 c8             	mov    %rcx,%r8
+  80219e:	48 89 d1             	mov    %rdx,%rcx
+  8021a1:	48 89 c2             	mov    %rax,%rdx
+  8021a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021ae:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+  8021ba:	48 83 c4 10          	add    $0x10,%rsp
+  8021be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8021c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+
+00000000008021c6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8021c6:	55                   	push   %rbp
+  8021c7:	48 89 e5             	mov    %rsp,%rbp
+  8021ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8021ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021d5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8021d8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021dc:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8021e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8021e3:	48 63 c8             	movslq %eax,%rcx
+  8021e6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021ed:	48 63 f0             	movslq %eax,%rsi
+  8021f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021f7:	48 98                	cltq
+  8021f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fd:	51                   	push   %rcx
+  8021fe:	49 89 f9             	mov    %rdi,%r9
+  802201:	49 89 f0             	mov    %rsi,%r8
+  802204:	48 89 d1             	mov    %rdx,%rcx
+  802207:	48 89 c2             	mov    %rax,%rdx
+  80220a:	be 01 00 00 00       	mov    $0x1,%esi
+  80220f:	bf 07 00 00 00       	mov    $0x7,%edi
+  802214:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+
+0000000000802226 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802226:	55                   	push   %rbp
+  802227:	48 89 e5             	mov    %rsp,%rbp
+  80222a:	48 83 ec 10          	sub    $0x10,%rsp
+  80222e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802231:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802235:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802239:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80223c:	48 98                	cltq
+  80223e:	48 83 ec 08          	sub    $0x8,%rsp
+  802242:	6a 00                	push   $0x0
+  802244:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802250:	48 89 d1             	mov    %rdx,%rcx
+  802253:	48 89 c2             	mov    %rax,%rdx
+  802256:	be 01 00 00 00       	mov    $0x1,%esi
+  80225b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802260:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802270:	c9                   	leave
+  802271:	c3                   	ret
+
+0000000000802272 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802272:	55                   	push   %rbp
+  802273:	48 89 e5             	mov    %rsp,%rbp
+  802276:	48 83 ec 10          	sub    $0x10,%rsp
+  80227a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80227d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802280:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802283:	48 63 d0             	movslq %eax,%rdx
+  802286:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802289:	48 98                	cltq
+  80228b:	48 83 ec 08          	sub    $0x8,%rsp
+  80228f:	6a 00                	push   $0x0
+  802291:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80229d:	48 89 d1             	mov    %rdx,%rcx
+  8022a0:	48 89 c2             	mov    %rax,%rdx
+  8022a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022ad:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022bd:	c9                   	leave
+  8022be:	c3                   	ret
+
+00000000008022bf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8022bf:	55                   	push   %rbp
+  8022c0:	48 89 e5             	mov    %rsp,%rbp
+  8022c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8022ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022d5:	48 98                	cltq
+  8022d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022db:	6a 00                	push   $0x0
+  8022dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e9:	48 89 d1             	mov    %rdx,%rcx
+  8022ec:	48 89 c2             	mov    %rax,%rdx
+  8022ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022f9:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+  802305:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802309:	c9                   	leave
+  80230a:	c3                   	ret
+
+000000000080230b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80230b:	55                   	push   %rbp
+  80230c:	48 89 e5             	mov    %rsp,%rbp
+  80230f:	48 83 ec 10          	sub    $0x10,%rsp
+  802313:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802316:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80231a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80231e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802321:	48 98                	cltq
+  802323:	48 83 ec 08          	sub    $0x8,%rsp
+  802327:	6a 00                	push   $0x0
+  802329:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802335:	48 89 d1             	mov    %rdx,%rcx
+  802338:	48 89 c2             	mov    %rax,%rdx
+  80233b:	be 01 00 00 00       	mov    $0x1,%esi
+  802340:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802345:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+
+0000000000802357 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	48 83 ec 20          	sub    $0x20,%rsp
+  80235f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802366:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80236a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80236d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802370:	48 63 f0             	movslq %eax,%rsi
+  802373:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802377:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80237b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80237e:	48 98                	cltq
+  802380:	48 83 ec 08          	sub    $0x8,%rsp
+  802384:	6a 00                	push   $0x0
+  802386:	49 89 f1             	mov    %rsi,%r9
+  802389:	49 89 c8             	mov    %rcx,%r8
+  80238c:	48 89 d1             	mov    %rdx,%rcx
+  80238f:	48 89 c2             	mov    %rax,%rdx
+  802392:	be 00 00 00 00       	mov    $0x0,%esi
+  802397:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80239c:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8023a3:	00 00 00 
+  8023a6:	ff d0                	call   *%rax
+  8023a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ac:	c9                   	leave
+  8023ad:	c3                   	ret
+
+00000000008023ae <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8023ae:	55                   	push   %rbp
+  8023af:	48 89 e5             	mov    %rsp,%rbp
+  8023b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8023ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023be:	48 83 ec 08          	sub    $0x8,%rsp
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023d5:	48 89 c2             	mov    %rax,%rdx
+  8023d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023dd:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8023e2:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+  8023ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023f2:	c9                   	leave
+  8023f3:	c3                   	ret
+
+00000000008023f4 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8023f4:	55                   	push   %rbp
+  8023f5:	48 89 e5             	mov    %rsp,%rbp
+  8023f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8023fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802400:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802404:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80240c:	48 83 ec 08          	sub    $0x8,%rsp
+  802410:	6a 00                	push   $0x0
+  802412:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80241e:	48 89 d1             	mov    %rdx,%rcx
+  802421:	48 89 c2             	mov    %rax,%rdx
+  802424:	be 01 00 00 00       	mov    $0x1,%esi
+  802429:	bf 10 00 00 00       	mov    $0x10,%edi
+  80242e:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802435:	00 00 00 
+  802438:	ff d0                	call   *%rax
+  80243a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+0000000000802440 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802440:	55                   	push   %rbp
+  802441:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802444:	48 83 ec 08          	sub    $0x8,%rsp
+  802448:	6a 00                	push   $0x0
+  80244a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802450:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802456:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80245b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802460:	be 00 00 00 00       	mov    $0x0,%esi
+  802465:	bf 11 00 00 00       	mov    $0x11,%edi
+  80246a:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+  802476:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+000000000080247c <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	48 83 ec 10          	sub    $0x10,%rsp
+  802484:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802488:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80248c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802494:	48 83 ec 08          	sub    $0x8,%rsp
+  802498:	6a 00                	push   $0x0
+  80249a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a6:	48 89 d1             	mov    %rdx,%rcx
+  8024a9:	48 89 c2             	mov    %rax,%rdx
+  8024ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b1:	bf 12 00 00 00       	mov    $0x12,%edi
+  8024b6:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+  8024c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c6:	c9                   	leave
+  8024c7:	c3                   	ret
+
+00000000008024c8 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8024d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024d8:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8024db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024de:	48 63 c8             	movslq %eax,%rcx
+  8024e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f5:	49 89 c8             	mov    %rcx,%r8
+  8024f8:	48 89 d1             	mov    %rdx,%rcx
+  8024fb:	48 89 c2             	mov    %rax,%rdx
+  8024fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802503:	bf 13 00 00 00       	mov    $0x13,%edi
+  802508:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+  802514:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802518:	c9                   	leave
+  802519:	c3                   	ret
+
+000000000080251a <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	48 83 ec 20          	sub    $0x20,%rsp
+  802522:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802526:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802529:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80252d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802531:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802534:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802538:	48 83 ec 08          	sub    $0x8,%rsp
+  80253c:	6a 00                	push   $0x0
+  80253e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802544:	49 89 c8             	mov    %rcx,%r8
+  802547:	48 89 d1             	mov    %rdx,%rcx
+  80254a:	48 89 c2             	mov    %rax,%rdx
+  80254d:	be 00 00 00 00       	mov    $0x0,%esi
+  802552:	bf 14 00 00 00       	mov    $0x14,%edi
+  802557:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80255e:	00 00 00 
+  802561:	ff d0                	call   *%rax
+  802563:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+0000000000802569 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	48 83 ec 10          	sub    $0x10,%rsp
+  802571:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802575:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802578:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80257b:	48 63 d0             	movslq %eax,%rdx
+  80257e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802582:	48 83 ec 08          	sub    $0x8,%rsp
+  802586:	6a 00                	push   $0x0
+  802588:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80258e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802594:	48 89 d1             	mov    %rdx,%rcx
+  802597:	48 89 c2             	mov    %rax,%rdx
+  80259a:	be 00 00 00 00       	mov    $0x0,%esi
+  80259f:	bf 15 00 00 00       	mov    $0x15,%edi
+  8025a4:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8025ab:	00 00 00 
+  8025ae:	ff d0                	call   *%rax
+  8025b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+
+00000000008025b6 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8025b6:	55                   	push   %rbp
+  8025b7:	48 89 e5             	mov    %rsp,%rbp
+  8025ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8025be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025c2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8025c5:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8025c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8025cc:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025d0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8025d3:	48 63 c8             	movslq %eax,%rcx
+  8025d6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025d9:	48 63 d0             	movslq %eax,%rdx
+  8025dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e4:	6a 00                	push   $0x0
+  8025e6:	49 89 f1             	mov    %rsi,%r9
+  8025e9:	49 89 c8             	mov    %rcx,%r8
+  8025ec:	48 89 d1             	mov    %rdx,%rcx
+  8025ef:	48 89 c2             	mov    %rax,%rdx
+  8025f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f7:	bf 16 00 00 00       	mov    $0x16,%edi
+  8025fc:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802603:	00 00 00 
+  802606:	ff d0                	call   *%rax
+  802608:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80260c:	c9                   	leave
+  80260d:	c3                   	ret
+
+000000000080260e <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80260e:	55                   	push   %rbp
+  80260f:	48 89 e5             	mov    %rsp,%rbp
+  802612:	48 83 ec 30          	sub    $0x30,%rsp
+  802616:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80261a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80261e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802622:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802626:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80262a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80262e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802632:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802636:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80263a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80263e:	48 83 ec 08          	sub    $0x8,%rsp
+  802642:	51                   	push   %rcx
+  802643:	49 89 f9             	mov    %rdi,%r9
+  802646:	49 89 f0             	mov    %rsi,%r8
+  802649:	48 89 d1             	mov    %rdx,%rcx
+  80264c:	48 89 c2             	mov    %rax,%rdx
+  80264f:	be 00 00 00 00       	mov    $0x0,%esi
+  802654:	bf 17 00 00 00       	mov    $0x17,%edi
+  802659:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802660:	00 00 00 
+  802663:	ff d0                	call   *%rax
+  802665:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802669:	c9                   	leave
+  80266a:	c3                   	ret
+
+000000000080266b <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80266b:	55                   	push   %rbp
+  80266c:	48 89 e5             	mov    %rsp,%rbp
+  80266f:	48 83 ec 10          	sub    $0x10,%rsp
+  802673:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802676:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802679:	48 98                	cltq
+  80267b:	48 83 ec 08          	sub    $0x8,%rsp
+  80267f:	6a 00                	push   $0x0
+  802681:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80268d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802692:	48 89 c2             	mov    %rax,%rdx
+  802695:	be 00 00 00 00       	mov    $0x0,%esi
+  80269a:	bf 18 00 00 00       	mov    $0x18,%edi
+  80269f:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+  8026ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026af:	90                   	nop
+  8026b0:	c9                   	leave
+  8026b1:	c3                   	ret
+
+00000000008026b2 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8026b2:	55                   	push   %rbp
+  8026b3:	48 89 e5             	mov    %rsp,%rbp
+  8026b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8026ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026c1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8026c5:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8026c8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026cb:	48 63 f0             	movslq %eax,%rsi
+  8026ce:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026d9:	48 98                	cltq
+  8026db:	48 83 ec 08          	sub    $0x8,%rsp
+  8026df:	6a 00                	push   $0x0
+  8026e1:	49 89 f1             	mov    %rsi,%r9
+  8026e4:	49 89 c8             	mov    %rcx,%r8
+  8026e7:	48 89 d1             	mov    %rdx,%rcx
+  8026ea:	48 89 c2             	mov    %rax,%rdx
+  8026ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8026f2:	bf 19 00 00 00       	mov    $0x19,%edi
+  8026f7:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8026fe:	00 00 00 
+  802701:	ff d0                	call   *%rax
+  802703:	48 83 c4 10          	add    $0x10,%rsp
+  802707:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80270a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80270d:	c9                   	leave
+  80270e:	c3                   	ret
+
+000000000080270f <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80270f:	55                   	push   %rbp
+  802710:	48 89 e5             	mov    %rsp,%rbp
+  802713:	48 83 ec 20          	sub    $0x20,%rsp
+  802717:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80271b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80271f:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802722:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802725:	48 63 c8             	movslq %eax,%rcx
+  802728:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80272c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802730:	48 83 ec 08          	sub    $0x8,%rsp
+  802734:	6a 00                	push   $0x0
+  802736:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273c:	49 89 c8             	mov    %rcx,%r8
+  80273f:	48 89 d1             	mov    %rdx,%rcx
+  802742:	48 89 c2             	mov    %rax,%rdx
+  802745:	be 01 00 00 00       	mov    $0x1,%esi
+  80274a:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80274f:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  802756:	00 00 00 
+  802759:	ff d0                	call   *%rax
+  80275b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80275f:	c9                   	leave
+  802760:	c3                   	ret
+
+0000000000802761 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	48 83 ec 20          	sub    $0x20,%rsp
+  802769:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80276d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802771:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802775:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802779:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80277d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802781:	48 83 ec 08          	sub    $0x8,%rsp
+  802785:	6a 00                	push   $0x0
+  802787:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278d:	49 89 c8             	mov    %rcx,%r8
+  802790:	48 89 d1             	mov    %rdx,%rcx
+  802793:	48 89 c2             	mov    %rax,%rdx
+  802796:	be 01 00 00 00       	mov    $0x1,%esi
+  80279b:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8027a0:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b0:	c9                   	leave
+  8027b1:	c3                   	ret
+
+00000000008027b2 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8027b2:	55                   	push   %rbp
+  8027b3:	48 89 e5             	mov    %rsp,%rbp
+  8027b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8027ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8027be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027c2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8027c5:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8027c9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027d0:	48 63 c8             	movslq %eax,%rcx
+  8027d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8027d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027db:	48 83 ec 08          	sub    $0x8,%rsp
+  8027df:	6a 00                	push   $0x0
+  8027e1:	49 89 f1             	mov    %rsi,%r9
+  8027e4:	49 89 c8             	mov    %rcx,%r8
+  8027e7:	48 89 d1             	mov    %rdx,%rcx
+  8027ea:	48 89 c2             	mov    %rax,%rdx
+  8027ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8027f2:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8027f7:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  8027fe:	00 00 00 
+  802801:	ff d0                	call   *%rax
+  802803:	48 83 c4 10          	add    $0x10,%rsp
+  802807:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80280a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+000000000080280f <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+  802813:	48 83 ec 10          	sub    $0x10,%rsp
+  802817:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80281a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80281d:	48 98                	cltq
+  80281f:	48 83 ec 08          	sub    $0x8,%rsp
+  802823:	6a 00                	push   $0x0
+  802825:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802831:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802836:	48 89 c2             	mov    %rax,%rdx
+  802839:	be 01 00 00 00       	mov    $0x1,%esi
+  80283e:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802843:	48 b8 be 1e 80 00 00 	movabs $0x801ebe,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+  80284f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+
+0000000000802855 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802855:	55                   	push   %rbp
+  802856:	48 89 e5             	mov    %rsp,%rbp
+  802859:	48 83 ec 40          	sub    $0x40,%rsp
+  80285d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802861:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802865:	48 8b 00             	mov    (%rax),%rax
+  802868:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  80286c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802870:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802874:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802878:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80287c:	83 e0 02             	and    $0x2,%eax
+  80287f:	48 85 c0             	test   %rax,%rax
+  802882:	74 25                	je     8028a9 <pgfault+0x54>
+  802884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802888:	48 c1 e8 0c          	shr    $0xc,%rax
+  80288c:	48 89 c2             	mov    %rax,%rdx
+  80288f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802896:	01 00 00 
+  802899:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80289d:	83 e0 02             	and    $0x2,%eax
+  8028a0:	48 85 c0             	test   %rax,%rax
+  8028a3:	0f 85 fe 01 00 00    	jne    802aa7 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8028a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ad:	83 e0 02             	and    $0x2,%eax
+  8028b0:	48 85 c0             	test   %rax,%rax
+  8028b3:	74 23                	je     8028d8 <pgfault+0x83>
+  8028b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028bd:	48 89 c2             	mov    %rax,%rdx
+  8028c0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028c7:	01 00 00 
+  8028ca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028ce:	25 00 08 00 00       	and    $0x800,%eax
+  8028d3:	48 85 c0             	test   %rax,%rax
+  8028d6:	75 3f                	jne    802917 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8028d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028e0:	49 89 d0             	mov    %rdx,%r8
+  8028e3:	48 89 c1             	mov    %rax,%rcx
+  8028e6:	48 b8 b8 6a 80 00 00 	movabs $0x806ab8,%rax
+  8028ed:	00 00 00 
+  8028f0:	48 89 c2             	mov    %rax,%rdx
+  8028f3:	be 26 00 00 00       	mov    $0x26,%esi
+  8028f8:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  8028ff:	00 00 00 
+  802902:	48 89 c7             	mov    %rax,%rdi
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	49 b9 b8 5b 80 00 00 	movabs $0x805bb8,%r9
+  802911:	00 00 00 
+  802914:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802917:	48 b8 06 57 80 00 00 	movabs $0x805706,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+  802923:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802927:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80292b:	ba 07 00 00 00       	mov    $0x7,%edx
+  802930:	48 89 c6             	mov    %rax,%rsi
+  802933:	bf 00 00 00 00       	mov    $0x0,%edi
+  802938:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802947:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80294b:	79 36                	jns    802983 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  80294d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802950:	89 c1                	mov    %eax,%ecx
+  802952:	48 b8 f8 6a 80 00 00 	movabs $0x806af8,%rax
+  802959:	00 00 00 
+  80295c:	48 89 c2             	mov    %rax,%rdx
+  80295f:	be 35 00 00 00       	mov    $0x35,%esi
+  802964:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  80296b:	00 00 00 
+  80296e:	48 89 c7             	mov    %rax,%rdi
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  80297d:	00 00 00 
+  802980:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802987:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80298b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80298f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802995:	48 89 c1             	mov    %rax,%rcx
+  802998:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029a1:	48 89 ce             	mov    %rcx,%rsi
+  8029a4:	48 89 c7             	mov    %rax,%rdi
+  8029a7:	48 b8 e3 18 80 00 00 	movabs $0x8018e3,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8029b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029b7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8029bb:	48 89 c2             	mov    %rax,%rdx
+  8029be:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029c5:	01 00 00 
+  8029c8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029cc:	25 00 08 00 00       	and    $0x800,%eax
+  8029d1:	48 85 c0             	test   %rax,%rax
+  8029d4:	74 7a                	je     802a50 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8029d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029da:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8029de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029e8:	48 89 c2             	mov    %rax,%rdx
+  8029eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029ef:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8029f5:	48 89 d1             	mov    %rdx,%rcx
+  8029f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029fd:	48 89 c6             	mov    %rax,%rsi
+  802a00:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a05:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802a14:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802a18:	79 36                	jns    802a50 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802a1a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a1d:	89 c1                	mov    %eax,%ecx
+  802a1f:	48 b8 20 6b 80 00 00 	movabs $0x806b20,%rax
+  802a26:	00 00 00 
+  802a29:	48 89 c2             	mov    %rax,%rdx
+  802a2c:	be 42 00 00 00       	mov    $0x42,%esi
+  802a31:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802a38:	00 00 00 
+  802a3b:	48 89 c7             	mov    %rax,%rdi
+  802a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a43:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802a4a:	00 00 00 
+  802a4d:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802a50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a54:	48 89 c6             	mov    %rax,%rsi
+  802a57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a5c:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  802a63:	00 00 00 
+  802a66:	ff d0                	call   *%rax
+  802a68:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802a6b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802a6f:	79 37                	jns    802aa8 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802a71:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a74:	89 c1                	mov    %eax,%ecx
+  802a76:	48 b8 48 6b 80 00 00 	movabs $0x806b48,%rax
+  802a7d:	00 00 00 
+  802a80:	48 89 c2             	mov    %rax,%rdx
+  802a83:	be 46 00 00 00       	mov    $0x46,%esi
+  802a88:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802a8f:	00 00 00 
+  802a92:	48 89 c7             	mov    %rax,%rdi
+  802a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9a:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802aa1:	00 00 00 
+  802aa4:	41 ff d0             	call   *%r8
+    return;
+  802aa7:	90                   	nop
+  }
+}
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+
+0000000000802aaa <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	48 83 ec 30          	sub    $0x30,%rsp
+  802ab2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ab5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802ab9:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ac0:	01 00 00 
+  802ac3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ac7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802acb:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ad0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802ad4:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802ae3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ae7:	48 c1 e0 0c          	shl    $0xc,%rax
+  802aeb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802aef:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802af6:	01 00 00 
+  802af9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802afd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b01:	25 00 04 00 00       	and    $0x400,%eax
+  802b06:	48 85 c0             	test   %rax,%rax
+  802b09:	74 7b                	je     802b86 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b0f:	89 c1                	mov    %eax,%ecx
+  802b11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b15:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b19:	48 89 c2             	mov    %rax,%rdx
+  802b1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b20:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b24:	48 89 c6             	mov    %rax,%rsi
+  802b27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b2a:	41 89 c8             	mov    %ecx,%r8d
+  802b2d:	48 89 d1             	mov    %rdx,%rcx
+  802b30:	89 c2                	mov    %eax,%edx
+  802b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b37:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+  802b43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b4a:	0f 89 da 00 00 00    	jns    802c2a <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802b50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b53:	89 c1                	mov    %eax,%ecx
+  802b55:	48 b8 70 6b 80 00 00 	movabs $0x806b70,%rax
+  802b5c:	00 00 00 
+  802b5f:	48 89 c2             	mov    %rax,%rdx
+  802b62:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802b67:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802b6e:	00 00 00 
+  802b71:	48 89 c7             	mov    %rax,%rdi
+  802b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b79:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802b80:	00 00 00 
+  802b83:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802b86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b8a:	25 02 08 00 00       	and    $0x802,%eax
+  802b8f:	48 85 c0             	test   %rax,%rax
+  802b92:	74 6e                	je     802c02 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802b94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b98:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802b9e:	80 cc 08             	or     $0x8,%ah
+  802ba1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802ba5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba9:	89 c7                	mov    %eax,%edi
+  802bab:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802baf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802bb2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802bb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bb9:	41 89 f8             	mov    %edi,%r8d
+  802bbc:	89 c7                	mov    %eax,%edi
+  802bbe:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+  802bca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802bcd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bd1:	79 05                	jns    802bd8 <duppage+0x12e>
+      return r;
+  802bd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bd6:	eb 55                	jmp    802c2d <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802bd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bdc:	89 c7                	mov    %eax,%edi
+  802bde:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802be2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802be5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802be9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bec:	41 89 f8             	mov    %edi,%r8d
+  802bef:	89 c7                	mov    %eax,%edi
+  802bf1:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c00:	eb 28                	jmp    802c2a <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802c02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c06:	89 c7                	mov    %eax,%edi
+  802c08:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c0c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c0f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802c13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c16:	41 89 f8             	mov    %edi,%r8d
+  802c19:	89 c7                	mov    %eax,%edi
+  802c1b:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+  802c27:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802c2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+
+0000000000802c2f <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802c2f:	55                   	push   %rbp
+  802c30:	48 89 e5             	mov    %rsp,%rbp
+  802c33:	48 83 ec 20          	sub    $0x20,%rsp
+  802c37:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c3a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802c3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c42:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802c4a:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802c51:	01 00 00 
+  802c54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c58:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c5c:	25 00 08 00 00       	and    $0x800,%eax
+  802c61:	48 85 c0             	test   %rax,%rax
+  802c64:	74 0d                	je     802c73 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802c66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c6a:	0f b6 10             	movzbl (%rax),%edx
+  802c6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c71:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802c73:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802c7a:	01 00 00 
+  802c7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c85:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c8a:	89 c6                	mov    %eax,%esi
+  802c8c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802c90:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c97:	41 89 f0             	mov    %esi,%r8d
+  802c9a:	48 89 c6             	mov    %rax,%rsi
+  802c9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca2:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  802ca9:	00 00 00 
+  802cac:	ff d0                	call   *%rax
+}
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+
+0000000000802cb0 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802cb0:	55                   	push   %rbp
+  802cb1:	48 89 e5             	mov    %rsp,%rbp
+  802cb4:	48 83 ec 40          	sub    $0x40,%rsp
+  802cb8:	89 f8                	mov    %edi,%eax
+  802cba:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802cbd:	48 b8 55 28 80 00 00 	movabs $0x802855,%rax
+  802cc4:	00 00 00 
+  802cc7:	48 89 c7             	mov    %rax,%rdi
+  802cca:	48 b8 d2 5c 80 00 00 	movabs $0x805cd2,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802cd6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cdb:	cd 30                	int    $0x30
+  802cdd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802ce0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802ce3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ce6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cea:	79 36                	jns    802d22 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802cec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cef:	89 c1                	mov    %eax,%ecx
+  802cf1:	48 b8 9b 6b 80 00 00 	movabs $0x806b9b,%rax
+  802cf8:	00 00 00 
+  802cfb:	48 89 c2             	mov    %rax,%rdx
+  802cfe:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802d03:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802d0a:	00 00 00 
+  802d0d:	48 89 c7             	mov    %rax,%rdi
+  802d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d15:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802d1c:	00 00 00 
+  802d1f:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802d22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d26:	75 0a                	jne    802d32 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2d:	e9 d3 02 00 00       	jmp    803005 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802d32:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802d39:	00 
+  802d3a:	e9 7a 01 00 00       	jmp    802eb9 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802d3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d43:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d47:	48 c1 e8 27          	shr    $0x27,%rax
+  802d4b:	48 89 c2             	mov    %rax,%rdx
+  802d4e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d55:	01 00 00 
+  802d58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d5c:	83 e0 01             	and    $0x1,%eax
+  802d5f:	48 85 c0             	test   %rax,%rax
+  802d62:	0f 84 4c 01 00 00    	je     802eb4 <fork_common+0x204>
+  802d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d70:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d74:	48 89 c2             	mov    %rax,%rdx
+  802d77:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802d7e:	01 00 00 
+  802d81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d85:	83 e0 01             	and    $0x1,%eax
+  802d88:	48 85 c0             	test   %rax,%rax
+  802d8b:	0f 84 23 01 00 00    	je     802eb4 <fork_common+0x204>
+  802d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d95:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d99:	48 c1 e8 15          	shr    $0x15,%rax
+  802d9d:	48 89 c2             	mov    %rax,%rdx
+  802da0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802da7:	01 00 00 
+  802daa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dae:	83 e0 01             	and    $0x1,%eax
+  802db1:	48 85 c0             	test   %rax,%rax
+  802db4:	0f 84 fa 00 00 00    	je     802eb4 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802dba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dbe:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dc2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802dc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dca:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802dd1:	00 00 00 
+  802dd4:	48 39 c2             	cmp    %rax,%rdx
+  802dd7:	0f 82 d7 00 00 00    	jb     802eb4 <fork_common+0x204>
+  802ddd:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802de4:	00 00 00 
+  802de7:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802deb:	0f 84 c3 00 00 00    	je     802eb4 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802df1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802df5:	48 89 c7             	mov    %rax,%rdi
+  802df8:	48 b8 c2 56 80 00 00 	movabs $0x8056c2,%rax
+  802dff:	00 00 00 
+  802e02:	ff d0                	call   *%rax
+  802e04:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802e07:	84 c0                	test   %al,%al
+  802e09:	0f 84 a5 00 00 00    	je     802eb4 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802e0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e13:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e17:	48 89 c2             	mov    %rax,%rdx
+  802e1a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e21:	01 00 00 
+  802e24:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e28:	83 e0 01             	and    $0x1,%eax
+  802e2b:	48 85 c0             	test   %rax,%rax
+  802e2e:	0f 84 80 00 00 00    	je     802eb4 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802e34:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802e38:	74 4a                	je     802e84 <fork_common+0x1d4>
+  802e3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e3e:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802e45:	00 00 00 
+  802e48:	48 39 c2             	cmp    %rax,%rdx
+  802e4b:	73 13                	jae    802e60 <fork_common+0x1b0>
+  802e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e51:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802e58:	00 00 00 
+  802e5b:	48 39 c2             	cmp    %rax,%rdx
+  802e5e:	73 24                	jae    802e84 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802e60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e64:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e68:	48 89 c2             	mov    %rax,%rdx
+  802e6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e6e:	48 89 d6             	mov    %rdx,%rsi
+  802e71:	89 c7                	mov    %eax,%edi
+  802e73:	48 b8 2f 2c 80 00 00 	movabs $0x802c2f,%rax
+  802e7a:	00 00 00 
+  802e7d:	ff d0                	call   *%rax
+  802e7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e82:	eb 22                	jmp    802ea6 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802e84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e88:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e8c:	48 89 c2             	mov    %rax,%rdx
+  802e8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e92:	48 89 d6             	mov    %rdx,%rsi
+  802e95:	89 c7                	mov    %eax,%edi
+  802e97:	48 b8 aa 2a 80 00 00 	movabs $0x802aaa,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802ea6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eaa:	79 08                	jns    802eb4 <fork_common+0x204>
+            return r;
+  802eac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eaf:	e9 51 01 00 00       	jmp    803005 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802eb4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802eb9:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802ec0:	07 
+  802ec1:	0f 86 78 fe ff ff    	jbe    802d3f <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802ec7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802ece:	00 00 00 
+  802ed1:	8b 40 04             	mov    0x4(%rax),%eax
+  802ed4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ed9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802ee0:	00 00 00 
+  802ee3:	48 98                	cltq
+  802ee5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802eec:	48 01 d0             	add    %rdx,%rax
+  802eef:	48 05 00 01 00 00    	add    $0x100,%rax
+  802ef5:	48 8b 10             	mov    (%rax),%rdx
+  802ef8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802efb:	48 89 d6             	mov    %rdx,%rsi
+  802efe:	89 c7                	mov    %eax,%edi
+  802f00:	48 b8 0b 23 80 00 00 	movabs $0x80230b,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+  802f0c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f0f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f13:	79 36                	jns    802f4b <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802f15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f18:	89 c1                	mov    %eax,%ecx
+  802f1a:	48 b8 b0 6b 80 00 00 	movabs $0x806bb0,%rax
+  802f21:	00 00 00 
+  802f24:	48 89 c2             	mov    %rax,%rdx
+  802f27:	be be 00 00 00       	mov    $0xbe,%esi
+  802f2c:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802f33:	00 00 00 
+  802f36:	48 89 c7             	mov    %rax,%rdi
+  802f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3e:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802f45:	00 00 00 
+  802f48:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802f4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f4e:	ba 02 00 00 00       	mov    $0x2,%edx
+  802f53:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802f5a:	00 00 00 
+  802f5d:	48 89 ce             	mov    %rcx,%rsi
+  802f60:	89 c7                	mov    %eax,%edi
+  802f62:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f71:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f75:	79 36                	jns    802fad <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  802f77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f7a:	89 c1                	mov    %eax,%ecx
+  802f7c:	48 b8 e0 6b 80 00 00 	movabs $0x806be0,%rax
+  802f83:	00 00 00 
+  802f86:	48 89 c2             	mov    %rax,%rdx
+  802f89:	be c1 00 00 00       	mov    $0xc1,%esi
+  802f8e:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802f95:	00 00 00 
+  802f98:	48 89 c7             	mov    %rax,%rdi
+  802f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa0:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802fa7:	00 00 00 
+  802faa:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  802fad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fb0:	be 02 00 00 00       	mov    $0x2,%esi
+  802fb5:	89 c7                	mov    %eax,%edi
+  802fb7:	48 b8 72 22 80 00 00 	movabs $0x802272,%rax
+  802fbe:	00 00 00 
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fc6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fca:	79 36                	jns    803002 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  802fcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fcf:	89 c1                	mov    %eax,%ecx
+  802fd1:	48 b8 00 6c 80 00 00 	movabs $0x806c00,%rax
+  802fd8:	00 00 00 
+  802fdb:	48 89 c2             	mov    %rax,%rdx
+  802fde:	be d4 00 00 00       	mov    $0xd4,%esi
+  802fe3:	48 b8 e6 6a 80 00 00 	movabs $0x806ae6,%rax
+  802fea:	00 00 00 
+  802fed:	48 89 c7             	mov    %rax,%rdi
+  802ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff5:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  802ffc:	00 00 00 
+  802fff:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803002:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803005:	c9                   	leave
+  803006:	c3                   	ret
+
+0000000000803007 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803007:	55                   	push   %rbp
+  803008:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80300b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803010:	48 b8 b0 2c 80 00 00 	movabs $0x802cb0,%rax
+  803017:	00 00 00 
+  80301a:	ff d0                	call   *%rax
+}
+  80301c:	5d                   	pop    %rbp
+  80301d:	c3                   	ret
+
+000000000080301e <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  80301e:	55                   	push   %rbp
+  80301f:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803022:	bf 01 00 00 00       	mov    $0x1,%edi
+  803027:	48 b8 b0 2c 80 00 00 	movabs $0x802cb0,%rax
+  80302e:	00 00 00 
+  803031:	ff d0                	call   *%rax
+}
+  803033:	5d                   	pop    %rbp
+  803034:	c3                   	ret
+
+0000000000803035 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  803035:	55                   	push   %rbp
+  803036:	48 89 e5             	mov    %rsp,%rbp
+  803039:	48 83 ec 20          	sub    $0x20,%rsp
+  80303d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803041:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803045:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  803049:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80304d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803051:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803055:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  80305c:	48 89 c7             	mov    %rax,%rdi
+  80305f:	48 b8 6d 30 80 00 00 	movabs $0x80306d,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+}
+  80306b:	c9                   	leave
+  80306c:	c3                   	ret
+
+000000000080306d <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  80306d:	55                   	push   %rbp
+  80306e:	48 89 e5             	mov    %rsp,%rbp
+  803071:	48 83 ec 30          	sub    $0x30,%rsp
+  803075:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803079:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80307d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  803081:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  803085:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80308a:	75 0e                	jne    80309a <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80308c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803093:	00 00 00 
+  803096:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80309a:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80309f:	75 18                	jne    8030b9 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8030a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030a5:	48 89 c7             	mov    %rax,%rdi
+  8030a8:	48 b8 ae 23 80 00 00 	movabs $0x8023ae,%rax
+  8030af:	00 00 00 
+  8030b2:	ff d0                	call   *%rax
+  8030b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030b7:	eb 1d                	jmp    8030d6 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8030b9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030c1:	48 89 d6             	mov    %rdx,%rsi
+  8030c4:	48 89 c7             	mov    %rax,%rdi
+  8030c7:	48 b8 f4 23 80 00 00 	movabs $0x8023f4,%rax
+  8030ce:	00 00 00 
+  8030d1:	ff d0                	call   *%rax
+  8030d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8030d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030da:	79 2a                	jns    803106 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8030dc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8030e1:	74 0a                	je     8030ed <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8030e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030e7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8030ed:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8030f2:	74 0a                	je     8030fe <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8030f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030f8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  8030fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803101:	e9 aa 00 00 00       	jmp    8031b0 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  803106:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80310b:	74 36                	je     803143 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  80310d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803114:	00 00 00 
+  803117:	8b 40 04             	mov    0x4(%rax),%eax
+  80311a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80311f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803126:	00 00 00 
+  803129:	48 98                	cltq
+  80312b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803132:	48 01 d0             	add    %rdx,%rax
+  803135:	48 05 24 01 00 00    	add    $0x124,%rax
+  80313b:	8b 10                	mov    (%rax),%edx
+  80313d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803141:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  803143:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803148:	74 36                	je     803180 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80314a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803151:	00 00 00 
+  803154:	8b 40 04             	mov    0x4(%rax),%eax
+  803157:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80315c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803163:	00 00 00 
+  803166:	48 98                	cltq
+  803168:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80316f:	48 01 d0             	add    %rdx,%rax
+  803172:	48 05 28 01 00 00    	add    $0x128,%rax
+  803178:	8b 10                	mov    (%rax),%edx
+  80317a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80317e:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  803180:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803187:	00 00 00 
+  80318a:	8b 40 04             	mov    0x4(%rax),%eax
+  80318d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803192:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803199:	00 00 00 
+  80319c:	48 98                	cltq
+  80319e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031a5:	48 01 d0             	add    %rdx,%rax
+  8031a8:	48 05 20 01 00 00    	add    $0x120,%rax
+  8031ae:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8031b0:	c9                   	leave
+  8031b1:	c3                   	ret
+
+00000000008031b2 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8031b2:	55                   	push   %rbp
+  8031b3:	48 89 e5             	mov    %rsp,%rbp
+  8031b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8031ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031bd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8031c0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8031c4:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8031c7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8031cc:	75 5e                	jne    80322c <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8031ce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8031d5:	00 00 00 
+  8031d8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8031dc:	eb 4e                	jmp    80322c <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8031de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031e2:	79 3c                	jns    803220 <ipc_send+0x6e>
+  8031e4:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8031e8:	74 36                	je     803220 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8031ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031ed:	89 c1                	mov    %eax,%ecx
+  8031ef:	48 b8 28 6c 80 00 00 	movabs $0x806c28,%rax
+  8031f6:	00 00 00 
+  8031f9:	48 89 c2             	mov    %rax,%rdx
+  8031fc:	be 54 00 00 00       	mov    $0x54,%esi
+  803201:	48 b8 4e 6c 80 00 00 	movabs $0x806c4e,%rax
+  803208:	00 00 00 
+  80320b:	48 89 c7             	mov    %rax,%rdi
+  80320e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803213:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  80321a:	00 00 00 
+  80321d:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  803220:	48 b8 31 21 80 00 00 	movabs $0x802131,%rax
+  803227:	00 00 00 
+  80322a:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80322c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80322f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803232:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803236:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803239:	89 c7                	mov    %eax,%edi
+  80323b:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+  803247:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80324a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80324e:	75 8e                	jne    8031de <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  803250:	48 b8 31 21 80 00 00 	movabs $0x802131,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+}
+  80325c:	90                   	nop
+  80325d:	c9                   	leave
+  80325e:	c3                   	ret
+
+000000000080325f <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	48 83 ec 18          	sub    $0x18,%rsp
+  803267:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  80326a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803271:	eb 4d                	jmp    8032c0 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  803273:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80327a:	00 00 00 
+  80327d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803280:	48 98                	cltq
+  803282:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803289:	48 01 d0             	add    %rdx,%rax
+  80328c:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  803292:	8b 00                	mov    (%rax),%eax
+  803294:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803297:	75 23                	jne    8032bc <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  803299:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032a0:	00 00 00 
+  8032a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032a6:	48 98                	cltq
+  8032a8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032af:	48 01 d0             	add    %rdx,%rax
+  8032b2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032b8:	8b 00                	mov    (%rax),%eax
+  8032ba:	eb 12                	jmp    8032ce <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8032bc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032c0:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8032c7:	7e aa                	jle    803273 <ipc_find_env+0x14>
+  return 0;
+  8032c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ce:	c9                   	leave
+  8032cf:	c3                   	ret
+
+00000000008032d0 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8032d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8032dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e0:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8032e7:	ff ff ff 
+  8032ea:	48 01 d0             	add    %rdx,%rax
+  8032ed:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8032f1:	c9                   	leave
+  8032f2:	c3                   	ret
+
+00000000008032f3 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8032f3:	55                   	push   %rbp
+  8032f4:	48 89 e5             	mov    %rsp,%rbp
+  8032f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8032fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8032ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803303:	48 89 c7             	mov    %rax,%rdi
+  803306:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  80330d:	00 00 00 
+  803310:	ff d0                	call   *%rax
+  803312:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803318:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80331c:	c9                   	leave
+  80331d:	c3                   	ret
+
+000000000080331e <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80331e:	55                   	push   %rbp
+  80331f:	48 89 e5             	mov    %rsp,%rbp
+  803322:	48 83 ec 18          	sub    $0x18,%rsp
+  803326:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80332a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803331:	e9 ae 00 00 00       	jmp    8033e4 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803336:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803339:	c1 e0 0c             	shl    $0xc,%eax
+  80333c:	48 98                	cltq
+  80333e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803343:	48 01 d0             	add    %rdx,%rax
+  803346:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80334a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80334e:	48 c1 e8 27          	shr    $0x27,%rax
+  803352:	48 89 c2             	mov    %rax,%rdx
+  803355:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80335c:	01 00 00 
+  80335f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803363:	83 e0 01             	and    $0x1,%eax
+  803366:	48 85 c0             	test   %rax,%rax
+  803369:	74 63                	je     8033ce <fd_alloc+0xb0>
+  80336b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80336f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803373:	48 89 c2             	mov    %rax,%rdx
+  803376:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80337d:	01 00 00 
+  803380:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803384:	83 e0 01             	and    $0x1,%eax
+  803387:	48 85 c0             	test   %rax,%rax
+  80338a:	74 42                	je     8033ce <fd_alloc+0xb0>
+  80338c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803390:	48 c1 e8 15          	shr    $0x15,%rax
+  803394:	48 89 c2             	mov    %rax,%rdx
+  803397:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80339e:	01 00 00 
+  8033a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033a5:	83 e0 01             	and    $0x1,%eax
+  8033a8:	48 85 c0             	test   %rax,%rax
+  8033ab:	74 21                	je     8033ce <fd_alloc+0xb0>
+  8033ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033b1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033b5:	48 89 c2             	mov    %rax,%rdx
+  8033b8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033bf:	01 00 00 
+  8033c2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c6:	83 e0 01             	and    $0x1,%eax
+  8033c9:	48 85 c0             	test   %rax,%rax
+  8033cc:	75 12                	jne    8033e0 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8033ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033d6:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8033d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033de:	eb 1e                	jmp    8033fe <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8033e0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8033e4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8033e8:	0f 8e 48 ff ff ff    	jle    803336 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8033ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8033f9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+
+0000000000803400 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803400:	55                   	push   %rbp
+  803401:	48 89 e5             	mov    %rsp,%rbp
+  803404:	48 83 ec 20          	sub    $0x20,%rsp
+  803408:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80340b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80340f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803413:	78 06                	js     80341b <fd_lookup+0x1b>
+  803415:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803419:	7e 0a                	jle    803425 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80341b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803420:	e9 af 00 00 00       	jmp    8034d4 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803425:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803428:	c1 e0 0c             	shl    $0xc,%eax
+  80342b:	48 98                	cltq
+  80342d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803432:	48 01 d0             	add    %rdx,%rax
+  803435:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343d:	48 c1 e8 27          	shr    $0x27,%rax
+  803441:	48 89 c2             	mov    %rax,%rdx
+  803444:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80344b:	01 00 00 
+  80344e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803452:	83 e0 01             	and    $0x1,%eax
+  803455:	48 85 c0             	test   %rax,%rax
+  803458:	74 63                	je     8034bd <fd_lookup+0xbd>
+  80345a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803462:	48 89 c2             	mov    %rax,%rdx
+  803465:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80346c:	01 00 00 
+  80346f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803473:	83 e0 01             	and    $0x1,%eax
+  803476:	48 85 c0             	test   %rax,%rax
+  803479:	74 42                	je     8034bd <fd_lookup+0xbd>
+  80347b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347f:	48 c1 e8 15          	shr    $0x15,%rax
+  803483:	48 89 c2             	mov    %rax,%rdx
+  803486:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80348d:	01 00 00 
+  803490:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803494:	83 e0 01             	and    $0x1,%eax
+  803497:	48 85 c0             	test   %rax,%rax
+  80349a:	74 21                	je     8034bd <fd_lookup+0xbd>
+  80349c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034a4:	48 89 c2             	mov    %rax,%rdx
+  8034a7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034ae:	01 00 00 
+  8034b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034b5:	83 e0 01             	and    $0x1,%eax
+  8034b8:	48 85 c0             	test   %rax,%rax
+  8034bb:	75 07                	jne    8034c4 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8034bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c2:	eb 10                	jmp    8034d4 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8034c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034cc:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8034cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d4:	c9                   	leave
+  8034d5:	c3                   	ret
+
+00000000008034d6 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8034d6:	55                   	push   %rbp
+  8034d7:	48 89 e5             	mov    %rsp,%rbp
+  8034da:	48 83 ec 30          	sub    $0x30,%rsp
+  8034de:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8034e2:	89 f0                	mov    %esi,%eax
+  8034e4:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8034e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034eb:	48 89 c7             	mov    %rax,%rdi
+  8034ee:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  8034f5:	00 00 00 
+  8034f8:	ff d0                	call   *%rax
+  8034fa:	89 c2                	mov    %eax,%edx
+  8034fc:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803500:	48 89 c6             	mov    %rax,%rsi
+  803503:	89 d7                	mov    %edx,%edi
+  803505:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+  803511:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803514:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803518:	78 0a                	js     803524 <fd_close+0x4e>
+  80351a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80351e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803522:	74 12                	je     803536 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803524:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803528:	74 05                	je     80352f <fd_close+0x59>
+  80352a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80352d:	eb 70                	jmp    80359f <fd_close+0xc9>
+  80352f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803534:	eb 69                	jmp    80359f <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803536:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80353a:	8b 00                	mov    (%rax),%eax
+  80353c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803540:	48 89 d6             	mov    %rdx,%rsi
+  803543:	89 c7                	mov    %eax,%edi
+  803545:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  80354c:	00 00 00 
+  80354f:	ff d0                	call   *%rax
+  803551:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803554:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803558:	78 2a                	js     803584 <fd_close+0xae>
+    if (dev->dev_close)
+  80355a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80355e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803562:	48 85 c0             	test   %rax,%rax
+  803565:	74 16                	je     80357d <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80356b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80356f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803573:	48 89 c7             	mov    %rax,%rdi
+  803576:	ff d2                	call   *%rdx
+  803578:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80357b:	eb 07                	jmp    803584 <fd_close+0xae>
+    else
+      r = 0;
+  80357d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803584:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803588:	48 89 c6             	mov    %rax,%rsi
+  80358b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803590:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+  return r;
+  80359c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80359f:	c9                   	leave
+  8035a0:	c3                   	ret
+
+00000000008035a1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8035a1:	55                   	push   %rbp
+  8035a2:	48 89 e5             	mov    %rsp,%rbp
+  8035a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8035a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8035b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035b7:	eb 3f                	jmp    8035f8 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8035b9:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035c0:	00 00 00 
+  8035c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c6:	48 98                	cltq
+  8035c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035cc:	8b 00                	mov    (%rax),%eax
+  8035ce:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8035d1:	75 21                	jne    8035f4 <dev_lookup+0x53>
+      *dev = devtab[i];
+  8035d3:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035da:	00 00 00 
+  8035dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035e0:	48 98                	cltq
+  8035e2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ea:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8035ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f2:	eb 7f                	jmp    803673 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8035f4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035f8:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035ff:	00 00 00 
+  803602:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803605:	48 98                	cltq
+  803607:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80360b:	48 85 c0             	test   %rax,%rax
+  80360e:	75 a9                	jne    8035b9 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803610:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803617:	00 00 00 
+  80361a:	8b 40 04             	mov    0x4(%rax),%eax
+  80361d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803622:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803629:	00 00 00 
+  80362c:	48 98                	cltq
+  80362e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803635:	48 01 d0             	add    %rdx,%rax
+  803638:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80363e:	8b 00                	mov    (%rax),%eax
+  803640:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803643:	89 c6                	mov    %eax,%esi
+  803645:	48 b8 58 6c 80 00 00 	movabs $0x806c58,%rax
+  80364c:	00 00 00 
+  80364f:	48 89 c7             	mov    %rax,%rdi
+  803652:	b8 00 00 00 00       	mov    $0x0,%eax
+  803657:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  80365e:	00 00 00 
+  803661:	ff d1                	call   *%rcx
+  *dev = 0;
+  803663:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803667:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80366e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803673:	c9                   	leave
+  803674:	c3                   	ret
+
+0000000000803675 <close>:
+
+int
+close(int fdnum) {
+  803675:	55                   	push   %rbp
+  803676:	48 89 e5             	mov    %rsp,%rbp
+  803679:	48 83 ec 20          	sub    $0x20,%rsp
+  80367d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803680:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803684:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803687:	48 89 d6             	mov    %rdx,%rsi
+  80368a:	89 c7                	mov    %eax,%edi
+  80368c:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+  803698:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80369b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80369f:	79 05                	jns    8036a6 <close+0x31>
+    return r;
+  8036a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036a4:	eb 18                	jmp    8036be <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8036a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8036af:	48 89 c7             	mov    %rax,%rdi
+  8036b2:	48 b8 d6 34 80 00 00 	movabs $0x8034d6,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+}
+  8036be:	c9                   	leave
+  8036bf:	c3                   	ret
+
+00000000008036c0 <close_all>:
+
+void
+close_all(void) {
+  8036c0:	55                   	push   %rbp
+  8036c1:	48 89 e5             	mov    %rsp,%rbp
+  8036c4:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8036c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036cf:	eb 15                	jmp    8036e6 <close_all+0x26>
+    close(i);
+  8036d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036d4:	89 c7                	mov    %eax,%edi
+  8036d6:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  8036dd:	00 00 00 
+  8036e0:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8036e2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8036e6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8036ea:	7e e5                	jle    8036d1 <close_all+0x11>
+}
+  8036ec:	90                   	nop
+  8036ed:	90                   	nop
+  8036ee:	c9                   	leave
+  8036ef:	c3                   	ret
+
+00000000008036f0 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8036f0:	55                   	push   %rbp
+  8036f1:	48 89 e5             	mov    %rsp,%rbp
+  8036f4:	48 83 ec 40          	sub    $0x40,%rsp
+  8036f8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036fb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036fe:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803702:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803705:	48 89 d6             	mov    %rdx,%rsi
+  803708:	89 c7                	mov    %eax,%edi
+  80370a:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803711:	00 00 00 
+  803714:	ff d0                	call   *%rax
+  803716:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803719:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80371d:	79 08                	jns    803727 <dup+0x37>
+    return r;
+  80371f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803722:	e9 33 02 00 00       	jmp    80395a <dup+0x26a>
+  close(newfdnum);
+  803727:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80372a:	89 c7                	mov    %eax,%edi
+  80372c:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803738:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80373b:	c1 e0 0c             	shl    $0xc,%eax
+  80373e:	48 98                	cltq
+  803740:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803745:	48 01 d0             	add    %rdx,%rax
+  803748:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80374c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803750:	48 89 c7             	mov    %rax,%rdi
+  803753:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  80375a:	00 00 00 
+  80375d:	ff d0                	call   *%rax
+  80375f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803767:	48 89 c7             	mov    %rax,%rdi
+  80376a:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  803771:	00 00 00 
+  803774:	ff d0                	call   *%rax
+  803776:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  80377a:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803781:	00 
+  803782:	e9 19 01 00 00       	jmp    8038a0 <dup+0x1b0>
+    off -= PGSIZE;
+  803787:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80378e:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80378f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803797:	48 01 d0             	add    %rdx,%rax
+  80379a:	48 c1 e8 27          	shr    $0x27,%rax
+  80379e:	48 89 c2             	mov    %rax,%rdx
+  8037a1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8037a8:	01 00 00 
+  8037ab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037af:	83 e0 01             	and    $0x1,%eax
+  8037b2:	48 85 c0             	test   %rax,%rax
+  8037b5:	0f 84 e5 00 00 00    	je     8038a0 <dup+0x1b0>
+  8037bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c3:	48 01 d0             	add    %rdx,%rax
+  8037c6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037ca:	48 89 c2             	mov    %rax,%rdx
+  8037cd:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8037d4:	01 00 00 
+  8037d7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037db:	83 e0 01             	and    $0x1,%eax
+  8037de:	48 85 c0             	test   %rax,%rax
+  8037e1:	0f 84 b9 00 00 00    	je     8038a0 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8037e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037ef:	48 01 d0             	add    %rdx,%rax
+  8037f2:	48 c1 e8 15          	shr    $0x15,%rax
+  8037f6:	48 89 c2             	mov    %rax,%rdx
+  8037f9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803800:	01 00 00 
+  803803:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803807:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80380a:	48 85 c0             	test   %rax,%rax
+  80380d:	0f 84 8d 00 00 00    	je     8038a0 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803813:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80381b:	48 01 d0             	add    %rdx,%rax
+  80381e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803822:	48 89 c2             	mov    %rax,%rdx
+  803825:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80382c:	01 00 00 
+  80382f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803833:	83 e0 01             	and    $0x1,%eax
+  803836:	48 85 c0             	test   %rax,%rax
+  803839:	74 65                	je     8038a0 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80383b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80383f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803843:	48 01 d0             	add    %rdx,%rax
+  803846:	48 c1 e8 0c          	shr    $0xc,%rax
+  80384a:	48 89 c2             	mov    %rax,%rdx
+  80384d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803854:	01 00 00 
+  803857:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80385b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803860:	89 c6                	mov    %eax,%esi
+  803862:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80386a:	48 01 c2             	add    %rax,%rdx
+  80386d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803871:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803875:	48 01 c8             	add    %rcx,%rax
+  803878:	41 89 f0             	mov    %esi,%r8d
+  80387b:	48 89 d1             	mov    %rdx,%rcx
+  80387e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803883:	48 89 c6             	mov    %rax,%rsi
+  803886:	bf 00 00 00 00       	mov    $0x0,%edi
+  80388b:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  803892:	00 00 00 
+  803895:	ff d0                	call   *%rax
+  803897:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80389a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80389e:	78 60                	js     803900 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8038a0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8038a5:	0f 85 dc fe ff ff    	jne    803787 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8038ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038b3:	48 89 c2             	mov    %rax,%rdx
+  8038b6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038bd:	01 00 00 
+  8038c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038c9:	89 c1                	mov    %eax,%ecx
+  8038cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038d3:	41 89 c8             	mov    %ecx,%r8d
+  8038d6:	48 89 d1             	mov    %rdx,%rcx
+  8038d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038de:	48 89 c6             	mov    %rax,%rsi
+  8038e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e6:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  8038ed:	00 00 00 
+  8038f0:	ff d0                	call   *%rax
+  8038f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038f9:	78 08                	js     803903 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8038fb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8038fe:	eb 5a                	jmp    80395a <dup+0x26a>
+        goto err;
+  803900:	90                   	nop
+  803901:	eb 01                	jmp    803904 <dup+0x214>
+    goto err;
+  803903:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803904:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803908:	48 89 c6             	mov    %rax,%rsi
+  80390b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803910:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80391c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803923:	00 
+  803924:	eb 27                	jmp    80394d <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803926:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80392a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80392e:	48 01 d0             	add    %rdx,%rax
+  803931:	48 89 c6             	mov    %rax,%rsi
+  803934:	bf 00 00 00 00       	mov    $0x0,%edi
+  803939:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  803940:	00 00 00 
+  803943:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803945:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80394c:	00 
+  80394d:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803954:	00 
+  803955:	76 cf                	jbe    803926 <dup+0x236>
+  return r;
+  803957:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80395a:	c9                   	leave
+  80395b:	c3                   	ret
+
+000000000080395c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80395c:	55                   	push   %rbp
+  80395d:	48 89 e5             	mov    %rsp,%rbp
+  803960:	48 83 ec 40          	sub    $0x40,%rsp
+  803964:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803967:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80396b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80396f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803973:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803976:	48 89 d6             	mov    %rdx,%rsi
+  803979:	89 c7                	mov    %eax,%edi
+  80397b:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803982:	00 00 00 
+  803985:	ff d0                	call   *%rax
+  803987:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80398a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80398e:	78 24                	js     8039b4 <read+0x58>
+  803990:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803994:	8b 00                	mov    (%rax),%eax
+  803996:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80399a:	48 89 d6             	mov    %rdx,%rsi
+  80399d:	89 c7                	mov    %eax,%edi
+  80399f:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+  8039ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039b2:	79 0a                	jns    8039be <read+0x62>
+    return r;
+  8039b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039b7:	48 98                	cltq
+  8039b9:	e9 9e 00 00 00       	jmp    803a5c <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8039be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c2:	8b 40 08             	mov    0x8(%rax),%eax
+  8039c5:	83 e0 03             	and    $0x3,%eax
+  8039c8:	83 f8 01             	cmp    $0x1,%eax
+  8039cb:	75 5c                	jne    803a29 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039cd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8039d4:	00 00 00 
+  8039d7:	8b 40 04             	mov    0x4(%rax),%eax
+  8039da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8039df:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8039e6:	00 00 00 
+  8039e9:	48 98                	cltq
+  8039eb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8039f2:	48 01 d0             	add    %rdx,%rax
+  8039f5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8039fb:	8b 00                	mov    (%rax),%eax
+  8039fd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a00:	89 c6                	mov    %eax,%esi
+  803a02:	48 b8 77 6c 80 00 00 	movabs $0x806c77,%rax
+  803a09:	00 00 00 
+  803a0c:	48 89 c7             	mov    %rax,%rdi
+  803a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a14:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  803a1b:	00 00 00 
+  803a1e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a20:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a27:	eb 33                	jmp    803a5c <read+0x100>
+  }
+  if (!dev->dev_read)
+  803a29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a2d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803a31:	48 85 c0             	test   %rax,%rax
+  803a34:	75 09                	jne    803a3f <read+0xe3>
+    return -E_NOT_SUPP;
+  803a36:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803a3d:	eb 1d                	jmp    803a5c <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803a3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a43:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a4b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a4f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803a53:	48 89 ce             	mov    %rcx,%rsi
+  803a56:	48 89 c7             	mov    %rax,%rdi
+  803a59:	41 ff d0             	call   *%r8
+}
+  803a5c:	c9                   	leave
+  803a5d:	c3                   	ret
+
+0000000000803a5e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a5e:	55                   	push   %rbp
+  803a5f:	48 89 e5             	mov    %rsp,%rbp
+  803a62:	48 83 ec 30          	sub    $0x30,%rsp
+  803a66:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803a69:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a6d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803a71:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a78:	eb 49                	jmp    803ac3 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803a7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a7d:	48 98                	cltq
+  803a7f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a83:	48 29 c2             	sub    %rax,%rdx
+  803a86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a89:	48 63 c8             	movslq %eax,%rcx
+  803a8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a90:	48 01 c1             	add    %rax,%rcx
+  803a93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a96:	48 89 ce             	mov    %rcx,%rsi
+  803a99:	89 c7                	mov    %eax,%edi
+  803a9b:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  803aa2:	00 00 00 
+  803aa5:	ff d0                	call   *%rax
+  803aa7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803aaa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803aae:	79 07                	jns    803ab7 <readn+0x59>
+      return m;
+  803ab0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ab3:	48 98                	cltq
+  803ab5:	eb 1f                	jmp    803ad6 <readn+0x78>
+    if (m == 0)
+  803ab7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803abb:	74 13                	je     803ad0 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803abd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ac0:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803ac3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ac6:	48 98                	cltq
+  803ac8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803acc:	72 ac                	jb     803a7a <readn+0x1c>
+  803ace:	eb 01                	jmp    803ad1 <readn+0x73>
+      break;
+  803ad0:	90                   	nop
+  }
+  return tot;
+  803ad1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ad4:	48 98                	cltq
+}
+  803ad6:	c9                   	leave
+  803ad7:	c3                   	ret
+
+0000000000803ad8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803ad8:	55                   	push   %rbp
+  803ad9:	48 89 e5             	mov    %rsp,%rbp
+  803adc:	48 83 ec 40          	sub    $0x40,%rsp
+  803ae0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ae3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ae7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803aeb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803aef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803af2:	48 89 d6             	mov    %rdx,%rsi
+  803af5:	89 c7                	mov    %eax,%edi
+  803af7:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803afe:	00 00 00 
+  803b01:	ff d0                	call   *%rax
+  803b03:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b06:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b0a:	78 24                	js     803b30 <write+0x58>
+  803b0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b10:	8b 00                	mov    (%rax),%eax
+  803b12:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b16:	48 89 d6             	mov    %rdx,%rsi
+  803b19:	89 c7                	mov    %eax,%edi
+  803b1b:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  803b22:	00 00 00 
+  803b25:	ff d0                	call   *%rax
+  803b27:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b2a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b2e:	79 0a                	jns    803b3a <write+0x62>
+    return r;
+  803b30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b33:	48 98                	cltq
+  803b35:	e9 9d 00 00 00       	jmp    803bd7 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b3e:	8b 40 08             	mov    0x8(%rax),%eax
+  803b41:	83 e0 03             	and    $0x3,%eax
+  803b44:	85 c0                	test   %eax,%eax
+  803b46:	75 5c                	jne    803ba4 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b48:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b4f:	00 00 00 
+  803b52:	8b 40 04             	mov    0x4(%rax),%eax
+  803b55:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b5a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b61:	00 00 00 
+  803b64:	48 98                	cltq
+  803b66:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b6d:	48 01 d0             	add    %rdx,%rax
+  803b70:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b76:	8b 00                	mov    (%rax),%eax
+  803b78:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b7b:	89 c6                	mov    %eax,%esi
+  803b7d:	48 b8 93 6c 80 00 00 	movabs $0x806c93,%rax
+  803b84:	00 00 00 
+  803b87:	48 89 c7             	mov    %rax,%rdi
+  803b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8f:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  803b96:	00 00 00 
+  803b99:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803b9b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ba2:	eb 33                	jmp    803bd7 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803bac:	48 85 c0             	test   %rax,%rax
+  803baf:	75 09                	jne    803bba <write+0xe2>
+    return -E_NOT_SUPP;
+  803bb1:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803bb8:	eb 1d                	jmp    803bd7 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803bba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bbe:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803bc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bc6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bca:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803bce:	48 89 ce             	mov    %rcx,%rsi
+  803bd1:	48 89 c7             	mov    %rax,%rdi
+  803bd4:	41 ff d0             	call   *%r8
+}
+  803bd7:	c9                   	leave
+  803bd8:	c3                   	ret
+
+0000000000803bd9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803bd9:	55                   	push   %rbp
+  803bda:	48 89 e5             	mov    %rsp,%rbp
+  803bdd:	48 83 ec 18          	sub    $0x18,%rsp
+  803be1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803be4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803be7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803beb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bee:	48 89 d6             	mov    %rdx,%rsi
+  803bf1:	89 c7                	mov    %eax,%edi
+  803bf3:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+  803bff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c02:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c06:	79 05                	jns    803c0d <seek+0x34>
+    return r;
+  803c08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c0b:	eb 0f                	jmp    803c1c <seek+0x43>
+  fd->fd_offset = offset;
+  803c0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c11:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c14:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803c17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1c:	c9                   	leave
+  803c1d:	c3                   	ret
+
+0000000000803c1e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803c1e:	55                   	push   %rbp
+  803c1f:	48 89 e5             	mov    %rsp,%rbp
+  803c22:	48 83 ec 30          	sub    $0x30,%rsp
+  803c26:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c29:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c2c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c33:	48 89 d6             	mov    %rdx,%rsi
+  803c36:	89 c7                	mov    %eax,%edi
+  803c38:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+  803c44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c4b:	78 24                	js     803c71 <ftruncate+0x53>
+  803c4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c51:	8b 00                	mov    (%rax),%eax
+  803c53:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c57:	48 89 d6             	mov    %rdx,%rsi
+  803c5a:	89 c7                	mov    %eax,%edi
+  803c5c:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+  803c68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6f:	79 08                	jns    803c79 <ftruncate+0x5b>
+    return r;
+  803c71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c74:	e9 92 00 00 00       	jmp    803d0b <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c7d:	8b 40 08             	mov    0x8(%rax),%eax
+  803c80:	83 e0 03             	and    $0x3,%eax
+  803c83:	85 c0                	test   %eax,%eax
+  803c85:	75 5a                	jne    803ce1 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803c87:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c8e:	00 00 00 
+  803c91:	8b 40 04             	mov    0x4(%rax),%eax
+  803c94:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c99:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803ca0:	00 00 00 
+  803ca3:	48 98                	cltq
+  803ca5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803cac:	48 01 d0             	add    %rdx,%rax
+  803caf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803cb5:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803cb7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803cba:	89 c6                	mov    %eax,%esi
+  803cbc:	48 b8 b0 6c 80 00 00 	movabs $0x806cb0,%rax
+  803cc3:	00 00 00 
+  803cc6:	48 89 c7             	mov    %rax,%rdi
+  803cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cce:	48 b9 f0 03 80 00 00 	movabs $0x8003f0,%rcx
+  803cd5:	00 00 00 
+  803cd8:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803cda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cdf:	eb 2a                	jmp    803d0b <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ce5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803ce9:	48 85 c0             	test   %rax,%rax
+  803cec:	75 07                	jne    803cf5 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803cee:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803cf3:	eb 16                	jmp    803d0b <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803cf5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cf9:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803cfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d01:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803d04:	89 d6                	mov    %edx,%esi
+  803d06:	48 89 c7             	mov    %rax,%rdi
+  803d09:	ff d1                	call   *%rcx
+}
+  803d0b:	c9                   	leave
+  803d0c:	c3                   	ret
+
+0000000000803d0d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d0d:	55                   	push   %rbp
+  803d0e:	48 89 e5             	mov    %rsp,%rbp
+  803d11:	48 83 ec 30          	sub    $0x30,%rsp
+  803d15:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d1c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d20:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d23:	48 89 d6             	mov    %rdx,%rsi
+  803d26:	89 c7                	mov    %eax,%edi
+  803d28:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803d2f:	00 00 00 
+  803d32:	ff d0                	call   *%rax
+  803d34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d3b:	78 24                	js     803d61 <fstat+0x54>
+  803d3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d41:	8b 00                	mov    (%rax),%eax
+  803d43:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d47:	48 89 d6             	mov    %rdx,%rsi
+  803d4a:	89 c7                	mov    %eax,%edi
+  803d4c:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+  803d58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d5f:	79 05                	jns    803d66 <fstat+0x59>
+    return r;
+  803d61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d64:	eb 5e                	jmp    803dc4 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d6a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d6e:	48 85 c0             	test   %rax,%rax
+  803d71:	75 07                	jne    803d7a <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803d73:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d78:	eb 4a                	jmp    803dc4 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803d7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d7e:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803d81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d85:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d8c:	00 00 00 
+  stat->st_isdir   = 0;
+  803d8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d93:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d9a:	00 00 00 
+  stat->st_dev     = dev;
+  803d9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803da1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da5:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803db0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803dbc:	48 89 d6             	mov    %rdx,%rsi
+  803dbf:	48 89 c7             	mov    %rax,%rdi
+  803dc2:	ff d1                	call   *%rcx
+}
+  803dc4:	c9                   	leave
+  803dc5:	c3                   	ret
+
+0000000000803dc6 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803dc6:	55                   	push   %rbp
+  803dc7:	48 89 e5             	mov    %rsp,%rbp
+  803dca:	48 83 ec 10          	sub    $0x10,%rsp
+  803dce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dd2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803dd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dda:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803de0:	83 f8 20             	cmp    $0x20,%eax
+  803de3:	75 07                	jne    803dec <pollwait_key+0x26>
+    return -E_INVAL;
+  803de5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803dea:	eb 5f                	jmp    803e4b <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803dec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df0:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dfa:	48 63 d2             	movslq %edx,%rdx
+  803dfd:	48 c1 e2 04          	shl    $0x4,%rdx
+  803e01:	48 01 c2             	add    %rax,%rdx
+  803e04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e08:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803e0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e0f:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803e15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e19:	8b 00                	mov    (%rax),%eax
+  803e1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e1f:	48 63 c9             	movslq %ecx,%rcx
+  803e22:	48 c1 e1 04          	shl    $0x4,%rcx
+  803e26:	48 01 ca             	add    %rcx,%rdx
+  803e29:	48 83 c2 08          	add    $0x8,%rdx
+  803e2d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803e2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e33:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e39:	8d 50 01             	lea    0x1(%rax),%edx
+  803e3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e40:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803e46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4b:	c9                   	leave
+  803e4c:	c3                   	ret
+
+0000000000803e4d <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803e4d:	55                   	push   %rbp
+  803e4e:	48 89 e5             	mov    %rsp,%rbp
+  803e51:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803e58:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803e5f:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803e65:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803e6c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e73:	00 
+  int i, r, ready, ipc = 0;
+  803e74:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803e7b:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803e82:	00 
+  803e83:	74 45                	je     803eca <poll+0x7d>
+  803e85:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803e8c:	ff 
+  803e8d:	74 3b                	je     803eca <poll+0x7d>
+    now      = vsys_clock_ns();
+  803e8f:	48 b8 c7 57 80 00 00 	movabs $0x8057c7,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+  803e9b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803e9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ea3:	48 f7 d0             	not    %rax
+  803ea6:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803ead:	73 10                	jae    803ebf <poll+0x72>
+  803eaf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803eb3:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803eba:	48 01 d0             	add    %rdx,%rax
+  803ebd:	eb 07                	jmp    803ec6 <poll+0x79>
+  803ebf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803ec6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803eca:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803ed1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803ed8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803edf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803ee6:	e9 46 02 00 00       	jmp    804131 <poll+0x2e4>
+      fds[i].revents = 0;
+  803eeb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803eee:	48 63 d0             	movslq %eax,%rdx
+  803ef1:	48 89 d0             	mov    %rdx,%rax
+  803ef4:	48 01 c0             	add    %rax,%rax
+  803ef7:	48 01 d0             	add    %rdx,%rax
+  803efa:	48 c1 e0 02          	shl    $0x2,%rax
+  803efe:	48 89 c2             	mov    %rax,%rdx
+  803f01:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f08:	48 01 d0             	add    %rdx,%rax
+  803f0b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803f12:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f15:	48 63 d0             	movslq %eax,%rdx
+  803f18:	48 89 d0             	mov    %rdx,%rax
+  803f1b:	48 01 c0             	add    %rax,%rax
+  803f1e:	48 01 d0             	add    %rdx,%rax
+  803f21:	48 c1 e0 02          	shl    $0x2,%rax
+  803f25:	48 89 c2             	mov    %rax,%rdx
+  803f28:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f2f:	48 01 d0             	add    %rdx,%rax
+  803f32:	8b 00                	mov    (%rax),%eax
+  803f34:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803f37:	75 62                	jne    803f9b <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803f39:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f3c:	48 63 d0             	movslq %eax,%rdx
+  803f3f:	48 89 d0             	mov    %rdx,%rax
+  803f42:	48 01 c0             	add    %rax,%rax
+  803f45:	48 01 d0             	add    %rdx,%rax
+  803f48:	48 c1 e0 02          	shl    $0x2,%rax
+  803f4c:	48 89 c2             	mov    %rax,%rdx
+  803f4f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f56:	48 01 d0             	add    %rdx,%rax
+  803f59:	8b 40 04             	mov    0x4(%rax),%eax
+  803f5c:	83 e0 01             	and    $0x1,%eax
+  803f5f:	85 c0                	test   %eax,%eax
+  803f61:	0f 84 9b 01 00 00    	je     804102 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803f67:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f6a:	48 63 d0             	movslq %eax,%rdx
+  803f6d:	48 89 d0             	mov    %rdx,%rax
+  803f70:	48 01 c0             	add    %rax,%rax
+  803f73:	48 01 d0             	add    %rdx,%rax
+  803f76:	48 c1 e0 02          	shl    $0x2,%rax
+  803f7a:	48 89 c2             	mov    %rax,%rdx
+  803f7d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f84:	48 01 c2             	add    %rax,%rdx
+  803f87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f8a:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803f8d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f90:	83 c8 04             	or     $0x4,%eax
+  803f93:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803f96:	e9 67 01 00 00       	jmp    804102 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f9b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f9e:	48 63 d0             	movslq %eax,%rdx
+  803fa1:	48 89 d0             	mov    %rdx,%rax
+  803fa4:	48 01 c0             	add    %rax,%rax
+  803fa7:	48 01 d0             	add    %rdx,%rax
+  803faa:	48 c1 e0 02          	shl    $0x2,%rax
+  803fae:	48 89 c2             	mov    %rax,%rdx
+  803fb1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fb8:	48 01 d0             	add    %rdx,%rax
+  803fbb:	8b 00                	mov    (%rax),%eax
+  803fbd:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803fc4:	48 89 d6             	mov    %rdx,%rsi
+  803fc7:	89 c7                	mov    %eax,%edi
+  803fc9:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+  803fd5:	85 c0                	test   %eax,%eax
+  803fd7:	78 25                	js     803ffe <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803fd9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803fe0:	8b 00                	mov    (%rax),%eax
+  803fe2:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803fe9:	48 89 d6             	mov    %rdx,%rsi
+  803fec:	89 c7                	mov    %eax,%edi
+  803fee:	48 b8 a1 35 80 00 00 	movabs $0x8035a1,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803ffa:	85 c0                	test   %eax,%eax
+  803ffc:	79 2c                	jns    80402a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803ffe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804001:	48 63 d0             	movslq %eax,%rdx
+  804004:	48 89 d0             	mov    %rdx,%rax
+  804007:	48 01 c0             	add    %rax,%rax
+  80400a:	48 01 d0             	add    %rdx,%rax
+  80400d:	48 c1 e0 02          	shl    $0x2,%rax
+  804011:	48 89 c2             	mov    %rax,%rdx
+  804014:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80401b:	48 01 d0             	add    %rdx,%rax
+  80401e:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804025:	e9 d8 00 00 00       	jmp    804102 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80402a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804031:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804035:	48 85 c0             	test   %rax,%rax
+  804038:	74 7d                	je     8040b7 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80403a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804041:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  804045:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804048:	48 63 d0             	movslq %eax,%rdx
+  80404b:	48 89 d0             	mov    %rdx,%rax
+  80404e:	48 01 c0             	add    %rax,%rax
+  804051:	48 01 d0             	add    %rdx,%rax
+  804054:	48 c1 e0 02          	shl    $0x2,%rax
+  804058:	48 89 c2             	mov    %rax,%rdx
+  80405b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804062:	48 01 d0             	add    %rdx,%rax
+  804065:	8b 48 04             	mov    0x4(%rax),%ecx
+  804068:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80406f:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  804076:	89 ce                	mov    %ecx,%esi
+  804078:	48 89 c7             	mov    %rax,%rdi
+  80407b:	41 ff d0             	call   *%r8
+  80407e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804081:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804085:	79 08                	jns    80408f <poll+0x242>
+          return r;
+  804087:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80408a:	e9 45 01 00 00       	jmp    8041d4 <poll+0x387>
+        fds[i].revents = r;
+  80408f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804092:	48 63 d0             	movslq %eax,%rdx
+  804095:	48 89 d0             	mov    %rdx,%rax
+  804098:	48 01 c0             	add    %rax,%rax
+  80409b:	48 01 d0             	add    %rdx,%rax
+  80409e:	48 c1 e0 02          	shl    $0x2,%rax
+  8040a2:	48 89 c2             	mov    %rax,%rdx
+  8040a5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040ac:	48 01 c2             	add    %rax,%rdx
+  8040af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b2:	89 42 08             	mov    %eax,0x8(%rdx)
+  8040b5:	eb 4b                	jmp    804102 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8040b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040ba:	48 63 d0             	movslq %eax,%rdx
+  8040bd:	48 89 d0             	mov    %rdx,%rax
+  8040c0:	48 01 c0             	add    %rax,%rax
+  8040c3:	48 01 d0             	add    %rdx,%rax
+  8040c6:	48 c1 e0 02          	shl    $0x2,%rax
+  8040ca:	48 89 c2             	mov    %rax,%rdx
+  8040cd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040d4:	48 01 d0             	add    %rdx,%rax
+  8040d7:	8b 48 04             	mov    0x4(%rax),%ecx
+  8040da:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040dd:	48 63 d0             	movslq %eax,%rdx
+  8040e0:	48 89 d0             	mov    %rdx,%rax
+  8040e3:	48 01 c0             	add    %rax,%rax
+  8040e6:	48 01 d0             	add    %rdx,%rax
+  8040e9:	48 c1 e0 02          	shl    $0x2,%rax
+  8040ed:	48 89 c2             	mov    %rax,%rdx
+  8040f0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040f7:	48 01 d0             	add    %rdx,%rax
+  8040fa:	83 e1 03             	and    $0x3,%ecx
+  8040fd:	89 ca                	mov    %ecx,%edx
+  8040ff:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804102:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804105:	48 63 d0             	movslq %eax,%rdx
+  804108:	48 89 d0             	mov    %rdx,%rax
+  80410b:	48 01 c0             	add    %rax,%rax
+  80410e:	48 01 d0             	add    %rdx,%rax
+  804111:	48 c1 e0 02          	shl    $0x2,%rax
+  804115:	48 89 c2             	mov    %rax,%rdx
+  804118:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80411f:	48 01 d0             	add    %rdx,%rax
+  804122:	8b 40 08             	mov    0x8(%rax),%eax
+  804125:	85 c0                	test   %eax,%eax
+  804127:	74 04                	je     80412d <poll+0x2e0>
+        ready++;
+  804129:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80412d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804131:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804134:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80413a:	0f 8c ab fd ff ff    	jl     803eeb <poll+0x9e>
+    }
+    if (ready)
+  804140:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  804144:	74 08                	je     80414e <poll+0x301>
+      return ready;
+  804146:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804149:	e9 86 00 00 00       	jmp    8041d4 <poll+0x387>
+
+    if (deadline) {
+  80414e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804153:	74 30                	je     804185 <poll+0x338>
+      now     = vsys_clock_ns();
+  804155:	48 b8 c7 57 80 00 00 	movabs $0x8057c7,%rax
+  80415c:	00 00 00 
+  80415f:	ff d0                	call   *%rax
+  804161:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  804165:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804169:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80416d:	73 0a                	jae    804179 <poll+0x32c>
+  80416f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804173:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804177:	eb 05                	jmp    80417e <poll+0x331>
+  804179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417e:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  804185:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804188:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80418b:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804192:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804199:	48 89 c7             	mov    %rax,%rdi
+  80419c:	48 b8 b6 25 80 00 00 	movabs $0x8025b6,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8041ab:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8041af:	75 07                	jne    8041b8 <poll+0x36b>
+      return 0;
+  8041b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b6:	eb 1c                	jmp    8041d4 <poll+0x387>
+    if (r < 0)
+  8041b8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8041bc:	79 05                	jns    8041c3 <poll+0x376>
+      return r;
+  8041be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041c1:	eb 11                	jmp    8041d4 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8041c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041c6:	c1 f8 02             	sar    $0x2,%eax
+  8041c9:	83 e0 01             	and    $0x1,%eax
+  8041cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8041cf:	e9 f6 fc ff ff       	jmp    803eca <poll+0x7d>
+  }
+}
+  8041d4:	c9                   	leave
+  8041d5:	c3                   	ret
+
+00000000008041d6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8041d6:	55                   	push   %rbp
+  8041d7:	48 89 e5             	mov    %rsp,%rbp
+  8041da:	48 83 ec 20          	sub    $0x20,%rsp
+  8041de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8041e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8041ef:	48 89 c7             	mov    %rax,%rdi
+  8041f2:	48 b8 c4 42 80 00 00 	movabs $0x8042c4,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+  8041fe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804201:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804205:	79 05                	jns    80420c <stat+0x36>
+    return fd;
+  804207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80420a:	eb 2f                	jmp    80423b <stat+0x65>
+  r = fstat(fd, stat);
+  80420c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804210:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804213:	48 89 d6             	mov    %rdx,%rsi
+  804216:	89 c7                	mov    %eax,%edi
+  804218:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+  804224:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804227:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80422a:	89 c7                	mov    %eax,%edi
+  80422c:	48 b8 75 36 80 00 00 	movabs $0x803675,%rax
+  804233:	00 00 00 
+  804236:	ff d0                	call   *%rax
+  return r;
+  804238:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80423b:	c9                   	leave
+  80423c:	c3                   	ret
+
+000000000080423d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80423d:	55                   	push   %rbp
+  80423e:	48 89 e5             	mov    %rsp,%rbp
+  804241:	48 83 ec 10          	sub    $0x10,%rsp
+  804245:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804248:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80424c:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804253:	00 00 00 
+  804256:	8b 00                	mov    (%rax),%eax
+  804258:	85 c0                	test   %eax,%eax
+  80425a:	75 1d                	jne    804279 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80425c:	bf 03 00 00 00       	mov    $0x3,%edi
+  804261:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  804268:	00 00 00 
+  80426b:	ff d0                	call   *%rax
+  80426d:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804274:	00 00 00 
+  804277:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804279:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804280:	00 00 00 
+  804283:	8b 00                	mov    (%rax),%eax
+  804285:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804288:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80428d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804294:	00 00 00 
+  804297:	89 c7                	mov    %eax,%edi
+  804299:	48 b8 b2 31 80 00 00 	movabs $0x8031b2,%rax
+  8042a0:	00 00 00 
+  8042a3:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8042a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ae:	48 89 c6             	mov    %rax,%rsi
+  8042b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b6:	48 b8 35 30 80 00 00 	movabs $0x803035,%rax
+  8042bd:	00 00 00 
+  8042c0:	ff d0                	call   *%rax
+}
+  8042c2:	c9                   	leave
+  8042c3:	c3                   	ret
+
+00000000008042c4 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8042c4:	55                   	push   %rbp
+  8042c5:	48 89 e5             	mov    %rsp,%rbp
+  8042c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8042cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042d0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8042d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d7:	48 89 c7             	mov    %rax,%rdi
+  8042da:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8042e1:	00 00 00 
+  8042e4:	ff d0                	call   *%rax
+  8042e6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8042eb:	7e 0a                	jle    8042f7 <open+0x33>
+    return -E_BAD_PATH;
+  8042ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8042f2:	e9 a8 00 00 00       	jmp    80439f <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8042f7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8042fb:	48 89 c7             	mov    %rax,%rdi
+  8042fe:	48 b8 1e 33 80 00 00 	movabs $0x80331e,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+  80430a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80430d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804311:	79 08                	jns    80431b <open+0x57>
+    return r;
+  804313:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804316:	e9 84 00 00 00       	jmp    80439f <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80431b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80431f:	48 89 c6             	mov    %rax,%rsi
+  804322:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804329:	00 00 00 
+  80432c:	48 89 c7             	mov    %rax,%rdi
+  80432f:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80433b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804342:	00 00 00 
+  804345:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804348:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80434e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804352:	48 89 c6             	mov    %rax,%rsi
+  804355:	bf 01 00 00 00       	mov    $0x1,%edi
+  80435a:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804361:	00 00 00 
+  804364:	ff d0                	call   *%rax
+  804366:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804369:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80436d:	79 1d                	jns    80438c <open+0xc8>
+    fd_close(fd, 0);
+  80436f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804373:	be 00 00 00 00       	mov    $0x0,%esi
+  804378:	48 89 c7             	mov    %rax,%rdi
+  80437b:	48 b8 d6 34 80 00 00 	movabs $0x8034d6,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+    return r;
+  804387:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80438a:	eb 13                	jmp    80439f <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80438c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804390:	48 89 c7             	mov    %rax,%rdi
+  804393:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  80439a:	00 00 00 
+  80439d:	ff d0                	call   *%rax
+}
+  80439f:	c9                   	leave
+  8043a0:	c3                   	ret
+
+00000000008043a1 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8043a1:	55                   	push   %rbp
+  8043a2:	48 89 e5             	mov    %rsp,%rbp
+  8043a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8043a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8043ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043b1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8043b4:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8043bb:	00 00 00 
+  8043be:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8043c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8043c5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8043ca:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  8043d1:	00 00 00 
+  8043d4:	ff d0                	call   *%rax
+}
+  8043d6:	c9                   	leave
+  8043d7:	c3                   	ret
+
+00000000008043d8 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8043d8:	55                   	push   %rbp
+  8043d9:	48 89 e5             	mov    %rsp,%rbp
+  8043dc:	48 83 ec 30          	sub    $0x30,%rsp
+  8043e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043e8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8043ec:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043f1:	74 07                	je     8043fa <devfile_read+0x22>
+  8043f3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8043f8:	75 0a                	jne    804404 <devfile_read+0x2c>
+  return E_INVAL;
+  8043fa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8043ff:	e9 b4 00 00 00       	jmp    8044b8 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804404:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80440b:	00 
+  while (n) {
+  80440c:	e9 98 00 00 00       	jmp    8044a9 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804415:	8b 40 0c             	mov    0xc(%rax),%eax
+  804418:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80441f:	00 00 00 
+  804422:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804424:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80442b:	00 00 00 
+  80442e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804432:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804436:	be 00 00 00 00       	mov    $0x0,%esi
+  80443b:	bf 03 00 00 00       	mov    $0x3,%edi
+  804440:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  80444f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804453:	7f 13                	jg     804468 <devfile_read+0x90>
+      return res ? res : res0;
+  804455:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804459:	74 07                	je     804462 <devfile_read+0x8a>
+  80445b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80445e:	48 98                	cltq
+  804460:	eb 56                	jmp    8044b8 <devfile_read+0xe0>
+  804462:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804466:	eb 50                	jmp    8044b8 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804468:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80446b:	48 63 d0             	movslq %eax,%rdx
+  80446e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804472:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804479:	00 00 00 
+  80447c:	48 89 ce             	mov    %rcx,%rsi
+  80447f:	48 89 c7             	mov    %rax,%rdi
+  804482:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+
+    buf += res;
+  80448e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804491:	48 98                	cltq
+  804493:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804497:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80449a:	48 98                	cltq
+  80449c:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8044a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044a3:	48 98                	cltq
+  8044a5:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8044a9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8044ae:	0f 85 5d ff ff ff    	jne    804411 <devfile_read+0x39>
+  }
+
+  return res0;
+  8044b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8044b8:	c9                   	leave
+  8044b9:	c3                   	ret
+
+00000000008044ba <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8044ba:	55                   	push   %rbp
+  8044bb:	48 89 e5             	mov    %rsp,%rbp
+  8044be:	48 83 ec 50          	sub    $0x50,%rsp
+  8044c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8044c6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044ca:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8044ce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044d3:	74 07                	je     8044dc <devfile_write+0x22>
+  8044d5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8044da:	75 0a                	jne    8044e6 <devfile_write+0x2c>
+  return E_INVAL;
+  8044dc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8044e1:	e9 c9 00 00 00       	jmp    8045af <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8044e6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8044ed:	00 
+
+  while (n) {
+  8044ee:	e9 ad 00 00 00       	jmp    8045a0 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8044f3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8044f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8044fb:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804502:	00 
+  804503:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804507:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80450b:	48 39 c2             	cmp    %rax,%rdx
+  80450e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804512:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804516:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80451a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80451e:	48 89 c6             	mov    %rax,%rsi
+  804521:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804528:	00 00 00 
+  80452b:	48 89 c7             	mov    %rax,%rdi
+  80452e:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  804535:	00 00 00 
+  804538:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80453a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80453e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804541:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804548:	00 00 00 
+  80454b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  80454d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804554:	00 00 00 
+  804557:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80455b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  80455f:	be 00 00 00 00       	mov    $0x0,%esi
+  804564:	bf 04 00 00 00       	mov    $0x4,%edi
+  804569:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+  804575:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804578:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80457c:	79 07                	jns    804585 <devfile_write+0xcb>
+      return res;
+  80457e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804581:	48 98                	cltq
+  804583:	eb 2a                	jmp    8045af <devfile_write+0xf5>
+
+    buf += res;
+  804585:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804588:	48 98                	cltq
+  80458a:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80458e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804591:	48 98                	cltq
+  804593:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804597:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80459a:	48 98                	cltq
+  80459c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8045a0:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8045a5:	0f 85 48 ff ff ff    	jne    8044f3 <devfile_write+0x39>
+  }
+
+  return res0;
+  8045ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8045af:	c9                   	leave
+  8045b0:	c3                   	ret
+
+00000000008045b1 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8045b1:	55                   	push   %rbp
+  8045b2:	48 89 e5             	mov    %rsp,%rbp
+  8045b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8045b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8045c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045c5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045c8:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045cf:	00 00 00 
+  8045d2:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8045d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8045de:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  8045e5:	00 00 00 
+  8045e8:	ff d0                	call   *%rax
+  8045ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045f1:	79 05                	jns    8045f8 <devfile_stat+0x47>
+    return r;
+  8045f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8045f6:	eb 59                	jmp    804651 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8045f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045fc:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804603:	00 00 00 
+  804606:	48 89 d6             	mov    %rdx,%rsi
+  804609:	48 89 c7             	mov    %rax,%rdi
+  80460c:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  804613:	00 00 00 
+  804616:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804618:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80461f:	00 00 00 
+  804622:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804628:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80462c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804632:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804639:	00 00 00 
+  80463c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804642:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804646:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  80464c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804651:	c9                   	leave
+  804652:	c3                   	ret
+
+0000000000804653 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804653:	55                   	push   %rbp
+  804654:	48 89 e5             	mov    %rsp,%rbp
+  804657:	48 83 ec 10          	sub    $0x10,%rsp
+  80465b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80465f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804666:	8b 40 0c             	mov    0xc(%rax),%eax
+  804669:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804670:	00 00 00 
+  804673:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804675:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80467c:	00 00 00 
+  80467f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804682:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804685:	be 00 00 00 00       	mov    $0x0,%esi
+  80468a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80468f:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804696:	00 00 00 
+  804699:	ff d0                	call   *%rax
+}
+  80469b:	c9                   	leave
+  80469c:	c3                   	ret
+
+000000000080469d <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80469d:	55                   	push   %rbp
+  80469e:	48 89 e5             	mov    %rsp,%rbp
+  8046a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8046a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8046ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8046b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046b3:	83 e0 03             	and    $0x3,%eax
+}
+  8046b6:	c9                   	leave
+  8046b7:	c3                   	ret
+
+00000000008046b8 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8046b8:	55                   	push   %rbp
+  8046b9:	48 89 e5             	mov    %rsp,%rbp
+  8046bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8046c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8046c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c8:	48 89 c7             	mov    %rax,%rdi
+  8046cb:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8046d2:	00 00 00 
+  8046d5:	ff d0                	call   *%rax
+  8046d7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8046dc:	7e 07                	jle    8046e5 <remove+0x2d>
+    return -E_BAD_PATH;
+  8046de:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8046e3:	eb 36                	jmp    80471b <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8046e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e9:	48 89 c6             	mov    %rax,%rsi
+  8046ec:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8046f3:	00 00 00 
+  8046f6:	48 89 c7             	mov    %rax,%rdi
+  8046f9:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  804700:	00 00 00 
+  804703:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804705:	be 00 00 00 00       	mov    $0x0,%esi
+  80470a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80470f:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804716:	00 00 00 
+  804719:	ff d0                	call   *%rax
+}
+  80471b:	c9                   	leave
+  80471c:	c3                   	ret
+
+000000000080471d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80471d:	55                   	push   %rbp
+  80471e:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804721:	be 00 00 00 00       	mov    $0x0,%esi
+  804726:	bf 08 00 00 00       	mov    $0x8,%edi
+  80472b:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804732:	00 00 00 
+  804735:	ff d0                	call   *%rax
+}
+  804737:	5d                   	pop    %rbp
+  804738:	c3                   	ret
+
+0000000000804739 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804739:	55                   	push   %rbp
+  80473a:	48 89 e5             	mov    %rsp,%rbp
+  80473d:	48 83 ec 20          	sub    $0x20,%rsp
+  804741:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804745:	be 00 00 00 00       	mov    $0x0,%esi
+  80474a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80474f:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  804756:	00 00 00 
+  804759:	ff d0                	call   *%rax
+  80475b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80475e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804762:	79 05                	jns    804769 <fs_stats+0x30>
+    return r;
+  804764:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804767:	eb 2a                	jmp    804793 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80476d:	ba 68 00 00 00       	mov    $0x68,%edx
+  804772:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804779:	00 00 00 
+  80477c:	48 89 ce             	mov    %rcx,%rsi
+  80477f:	48 89 c7             	mov    %rax,%rdi
+  804782:	48 b8 e3 18 80 00 00 	movabs $0x8018e3,%rax
+  804789:	00 00 00 
+  80478c:	ff d0                	call   *%rax
+  return 0;
+  80478e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804793:	c9                   	leave
+  804794:	c3                   	ret
+
+0000000000804795 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804795:	55                   	push   %rbp
+  804796:	48 89 e5             	mov    %rsp,%rbp
+  804799:	48 83 ec 10          	sub    $0x10,%rsp
+  80479d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  8047a0:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047a7:	00 00 00 
+  8047aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047ad:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8047af:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8047b9:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  8047c0:	00 00 00 
+  8047c3:	ff d0                	call   *%rax
+}
+  8047c5:	c9                   	leave
+  8047c6:	c3                   	ret
+
+00000000008047c7 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8047c7:	55                   	push   %rbp
+  8047c8:	48 89 e5             	mov    %rsp,%rbp
+  8047cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8047cf:	89 f8                	mov    %edi,%eax
+  8047d1:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8047d4:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8047d8:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047df:	00 00 00 
+  8047e2:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8047e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8047e9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8047ee:	48 b8 3d 42 80 00 00 	movabs $0x80423d,%rax
+  8047f5:	00 00 00 
+  8047f8:	ff d0                	call   *%rax
+}
+  8047fa:	c9                   	leave
+  8047fb:	c3                   	ret
+
+00000000008047fc <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8047fc:	55                   	push   %rbp
+  8047fd:	48 89 e5             	mov    %rsp,%rbp
+  804800:	48 83 ec 10          	sub    $0x10,%rsp
+  804804:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80480c:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804811:	48 89 c7             	mov    %rax,%rdi
+  804814:	48 b8 22 48 80 00 00 	movabs $0x804822,%rax
+  80481b:	00 00 00 
+  80481e:	ff d0                	call   *%rax
+}
+  804820:	c9                   	leave
+  804821:	c3                   	ret
+
+0000000000804822 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804822:	55                   	push   %rbp
+  804823:	48 89 e5             	mov    %rsp,%rbp
+  804826:	48 83 ec 50          	sub    $0x50,%rsp
+  80482a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80482e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804832:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804839:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80483a:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80483f:	74 0a                	je     80484b <pipe_size+0x29>
+  804841:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804848:	00 
+  804849:	76 0a                	jbe    804855 <pipe_size+0x33>
+    return -E_INVAL;
+  80484b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804850:	e9 cc 02 00 00       	jmp    804b21 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804855:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804859:	48 89 c7             	mov    %rax,%rdi
+  80485c:	48 b8 1e 33 80 00 00 	movabs $0x80331e,%rax
+  804863:	00 00 00 
+  804866:	ff d0                	call   *%rax
+  804868:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80486b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80486f:	0f 88 a8 02 00 00    	js     804b1d <pipe_size+0x2fb>
+  804875:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804879:	ba 07 04 00 00       	mov    $0x407,%edx
+  80487e:	48 89 c6             	mov    %rax,%rsi
+  804881:	bf 00 00 00 00       	mov    $0x0,%edi
+  804886:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  80488d:	00 00 00 
+  804890:	ff d0                	call   *%rax
+  804892:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804895:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804899:	0f 88 7e 02 00 00    	js     804b1d <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80489f:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8048a3:	48 89 c7             	mov    %rax,%rdi
+  8048a6:	48 b8 1e 33 80 00 00 	movabs $0x80331e,%rax
+  8048ad:	00 00 00 
+  8048b0:	ff d0                	call   *%rax
+  8048b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048b9:	0f 88 43 02 00 00    	js     804b02 <pipe_size+0x2e0>
+  8048bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048c3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048c8:	48 89 c6             	mov    %rax,%rsi
+  8048cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d0:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  8048d7:	00 00 00 
+  8048da:	ff d0                	call   *%rax
+  8048dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048e3:	0f 88 19 02 00 00    	js     804b02 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8048e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ed:	48 89 c7             	mov    %rax,%rdi
+  8048f0:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  8048f7:	00 00 00 
+  8048fa:	ff d0                	call   *%rax
+  8048fc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804900:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804907:	00 
+  804908:	e9 a2 00 00 00       	jmp    8049af <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80490d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804911:	48 c1 e0 0c          	shl    $0xc,%rax
+  804915:	48 89 c2             	mov    %rax,%rdx
+  804918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80491c:	48 01 d0             	add    %rdx,%rax
+  80491f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804924:	48 89 c6             	mov    %rax,%rsi
+  804927:	bf 00 00 00 00       	mov    $0x0,%edi
+  80492c:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  804933:	00 00 00 
+  804936:	ff d0                	call   *%rax
+  804938:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80493b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80493f:	0f 88 37 01 00 00    	js     804a7c <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804945:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804949:	48 89 c7             	mov    %rax,%rdi
+  80494c:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  804953:	00 00 00 
+  804956:	ff d0                	call   *%rax
+  804958:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80495c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804960:	48 01 c2             	add    %rax,%rdx
+  804963:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804967:	48 c1 e0 0c          	shl    $0xc,%rax
+  80496b:	48 89 c1             	mov    %rax,%rcx
+  80496e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804972:	48 01 c8             	add    %rcx,%rax
+  804975:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80497b:	48 89 d1             	mov    %rdx,%rcx
+  80497e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804983:	48 89 c6             	mov    %rax,%rsi
+  804986:	bf 00 00 00 00       	mov    $0x0,%edi
+  80498b:	48 b8 c6 21 80 00 00 	movabs $0x8021c6,%rax
+  804992:	00 00 00 
+  804995:	ff d0                	call   *%rax
+  804997:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80499a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80499e:	79 0a                	jns    8049aa <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8049a0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8049a5:	e9 d3 00 00 00       	jmp    804a7d <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8049aa:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8049af:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8049b6:	00 
+  8049b7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049bf:	48 01 d0             	add    %rdx,%rax
+  8049c2:	48 83 c0 1f          	add    $0x1f,%rax
+  8049c6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8049ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d3:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8049d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049db:	48 29 d0             	sub    %rdx,%rax
+  8049de:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049e2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8049e6:	0f 82 21 ff ff ff    	jb     80490d <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8049ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049f0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8049f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049f8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049fc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804a00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a04:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a0b:	00 00 00 
+  804a0e:	8b 12                	mov    (%rdx),%edx
+  804a10:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804a12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a16:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804a1d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a21:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a28:	00 00 00 
+  804a2b:	8b 12                	mov    (%rdx),%edx
+  804a2d:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804a2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a33:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804a3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a3e:	48 89 c7             	mov    %rax,%rdi
+  804a41:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  804a48:	00 00 00 
+  804a4b:	ff d0                	call   *%rax
+  804a4d:	89 c2                	mov    %eax,%edx
+  804a4f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a53:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804a55:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a59:	48 89 c7             	mov    %rax,%rdi
+  804a5c:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  804a63:	00 00 00 
+  804a66:	ff d0                	call   *%rax
+  804a68:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a6c:	48 83 c2 04          	add    $0x4,%rdx
+  804a70:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a77:	e9 a5 00 00 00       	jmp    804b21 <pipe_size+0x2ff>
+      goto err2;
+  804a7c:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804a7d:	eb 58                	jmp    804ad7 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a83:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a87:	48 89 c2             	mov    %rax,%rdx
+  804a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a8e:	48 01 d0             	add    %rdx,%rax
+  804a91:	48 89 c6             	mov    %rax,%rsi
+  804a94:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a99:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  804aa0:	00 00 00 
+  804aa3:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804aa5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aa9:	48 89 c7             	mov    %rax,%rdi
+  804aac:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  804ab3:	00 00 00 
+  804ab6:	ff d0                	call   *%rax
+  804ab8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804abc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804ac0:	48 01 d0             	add    %rdx,%rax
+  804ac3:	48 89 c6             	mov    %rax,%rsi
+  804ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804acb:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  804ad2:	00 00 00 
+  804ad5:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804ad7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804adb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804adf:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804ae3:	48 85 c0             	test   %rax,%rax
+  804ae6:	75 97                	jne    804a7f <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804ae8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aec:	48 89 c6             	mov    %rax,%rsi
+  804aef:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af4:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  804afb:	00 00 00 
+  804afe:	ff d0                	call   *%rax
+  804b00:	eb 01                	jmp    804b03 <pipe_size+0x2e1>
+    goto err1;
+  804b02:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804b03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b07:	48 89 c6             	mov    %rax,%rsi
+  804b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b0f:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  804b16:	00 00 00 
+  804b19:	ff d0                	call   *%rax
+  804b1b:	eb 01                	jmp    804b1e <pipe_size+0x2fc>
+    goto err;
+  804b1d:	90                   	nop
+err:
+  return r;
+  804b1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b21:	c9                   	leave
+  804b22:	c3                   	ret
+
+0000000000804b23 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804b23:	55                   	push   %rbp
+  804b24:	48 89 e5             	mov    %rsp,%rbp
+  804b27:	53                   	push   %rbx
+  804b28:	48 83 ec 28          	sub    $0x28,%rsp
+  804b2c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b30:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804b34:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b3b:	00 00 00 
+  804b3e:	8b 40 04             	mov    0x4(%rax),%eax
+  804b41:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b46:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b4d:	00 00 00 
+  804b50:	48 98                	cltq
+  804b52:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b59:	48 01 d0             	add    %rdx,%rax
+  804b5c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b62:	8b 00                	mov    (%rax),%eax
+  804b64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804b67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6b:	48 89 c7             	mov    %rax,%rdi
+  804b6e:	48 b8 38 5e 80 00 00 	movabs $0x805e38,%rax
+  804b75:	00 00 00 
+  804b78:	ff d0                	call   *%rax
+  804b7a:	89 c3                	mov    %eax,%ebx
+  804b7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b80:	48 89 c7             	mov    %rax,%rdi
+  804b83:	48 b8 38 5e 80 00 00 	movabs $0x805e38,%rax
+  804b8a:	00 00 00 
+  804b8d:	ff d0                	call   *%rax
+  804b8f:	39 c3                	cmp    %eax,%ebx
+  804b91:	0f 94 c0             	sete   %al
+  804b94:	0f b6 c0             	movzbl %al,%eax
+  804b97:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804b9a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ba1:	00 00 00 
+  804ba4:	8b 40 04             	mov    0x4(%rax),%eax
+  804ba7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bac:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bb3:	00 00 00 
+  804bb6:	48 98                	cltq
+  804bb8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bbf:	48 01 d0             	add    %rdx,%rax
+  804bc2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bc8:	8b 00                	mov    (%rax),%eax
+  804bca:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804bcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bd0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804bd3:	75 05                	jne    804bda <_pipeisclosed+0xb7>
+      return ret;
+  804bd5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bd8:	eb 68                	jmp    804c42 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804bda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bdd:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804be0:	0f 84 4e ff ff ff    	je     804b34 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804be6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804bed:	00 00 00 
+  804bf0:	8b 40 04             	mov    0x4(%rax),%eax
+  804bf3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bf8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bff:	00 00 00 
+  804c02:	48 98                	cltq
+  804c04:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c0b:	48 01 d0             	add    %rdx,%rax
+  804c0e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c14:	8b 10                	mov    (%rax),%edx
+  804c16:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804c19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c1c:	89 c6                	mov    %eax,%esi
+  804c1e:	48 b8 e0 6c 80 00 00 	movabs $0x806ce0,%rax
+  804c25:	00 00 00 
+  804c28:	48 89 c7             	mov    %rax,%rdi
+  804c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c30:	49 b8 f0 03 80 00 00 	movabs $0x8003f0,%r8
+  804c37:	00 00 00 
+  804c3a:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804c3d:	e9 f2 fe ff ff       	jmp    804b34 <_pipeisclosed+0x11>
+  }
+}
+  804c42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c46:	c9                   	leave
+  804c47:	c3                   	ret
+
+0000000000804c48 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804c48:	55                   	push   %rbp
+  804c49:	48 89 e5             	mov    %rsp,%rbp
+  804c4c:	48 83 ec 30          	sub    $0x30,%rsp
+  804c50:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c53:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804c57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c5a:	48 89 d6             	mov    %rdx,%rsi
+  804c5d:	89 c7                	mov    %eax,%edi
+  804c5f:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  804c66:	00 00 00 
+  804c69:	ff d0                	call   *%rax
+  804c6b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c6e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c72:	79 05                	jns    804c79 <pipeisclosed+0x31>
+    return r;
+  804c74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c77:	eb 31                	jmp    804caa <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804c79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c7d:	48 89 c7             	mov    %rax,%rdi
+  804c80:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  804c87:	00 00 00 
+  804c8a:	ff d0                	call   *%rax
+  804c8c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804c90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c94:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c98:	48 89 d6             	mov    %rdx,%rsi
+  804c9b:	48 89 c7             	mov    %rax,%rdi
+  804c9e:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  804ca5:	00 00 00 
+  804ca8:	ff d0                	call   *%rax
+}
+  804caa:	c9                   	leave
+  804cab:	c3                   	ret
+
+0000000000804cac <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804cac:	55                   	push   %rbp
+  804cad:	48 89 e5             	mov    %rsp,%rbp
+  804cb0:	48 83 ec 10          	sub    $0x10,%rsp
+  804cb4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804cb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cbc:	8b 40 18             	mov    0x18(%rax),%eax
+  804cbf:	8d 50 01             	lea    0x1(%rax),%edx
+  804cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc6:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804cc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ccd:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804cd0:	85 c0                	test   %eax,%eax
+  804cd2:	74 27                	je     804cfb <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804cd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cd8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804cdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce3:	48 83 c0 18          	add    $0x18,%rax
+  804ce7:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804cec:	48 89 c7             	mov    %rax,%rdi
+  804cef:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  804cf6:	00 00 00 
+  804cf9:	ff d0                	call   *%rax
+  }
+}
+  804cfb:	90                   	nop
+  804cfc:	c9                   	leave
+  804cfd:	c3                   	ret
+
+0000000000804cfe <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804cfe:	55                   	push   %rbp
+  804cff:	48 89 e5             	mov    %rsp,%rbp
+  804d02:	48 83 ec 10          	sub    $0x10,%rsp
+  804d06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d0a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d11:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804d18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d1c:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804d20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804d23:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804d2a:	89 c6                	mov    %eax,%esi
+  804d2c:	48 89 cf             	mov    %rcx,%rdi
+  804d2f:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  804d36:	00 00 00 
+  804d39:	ff d0                	call   *%rax
+}
+  804d3b:	90                   	nop
+  804d3c:	c9                   	leave
+  804d3d:	c3                   	ret
+
+0000000000804d3e <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d3e:	55                   	push   %rbp
+  804d3f:	48 89 e5             	mov    %rsp,%rbp
+  804d42:	48 83 ec 70          	sub    $0x70,%rsp
+  804d46:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804d4a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804d4e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804d52:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d56:	48 89 c7             	mov    %rax,%rdi
+  804d59:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  804d60:	00 00 00 
+  804d63:	ff d0                	call   *%rax
+  804d65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804d69:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804d6e:	75 0a                	jne    804d7a <devpipe_read+0x3c>
+    return 0;
+  804d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d75:	e9 63 01 00 00       	jmp    804edd <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804d7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d7e:	8b 40 18             	mov    0x18(%rax),%eax
+  804d81:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804d84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d88:	48 8b 10             	mov    (%rax),%rdx
+  804d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d8f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d93:	48 39 c2             	cmp    %rax,%rdx
+  804d96:	75 42                	jne    804dda <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804d98:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d9c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804da0:	48 89 d6             	mov    %rdx,%rsi
+  804da3:	48 89 c7             	mov    %rax,%rdi
+  804da6:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  804dad:	00 00 00 
+  804db0:	ff d0                	call   *%rax
+  804db2:	85 c0                	test   %eax,%eax
+  804db4:	74 0a                	je     804dc0 <devpipe_read+0x82>
+      return 0;
+  804db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dbb:	e9 1d 01 00 00       	jmp    804edd <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804dc0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc7:	89 d6                	mov    %edx,%esi
+  804dc9:	48 89 c7             	mov    %rax,%rdi
+  804dcc:	48 b8 fe 4c 80 00 00 	movabs $0x804cfe,%rax
+  804dd3:	00 00 00 
+  804dd6:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804dd8:	eb a0                	jmp    804d7a <devpipe_read+0x3c>
+      break;
+  804dda:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804ddb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ddf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804de3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804de7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804deb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804def:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804df3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df7:	48 8b 00             	mov    (%rax),%rax
+  804dfa:	48 29 c2             	sub    %rax,%rdx
+  804dfd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804e01:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e09:	48 39 c2             	cmp    %rax,%rdx
+  804e0c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e10:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e18:	48 8b 00             	mov    (%rax),%rax
+  804e1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e1f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e28:	48 f7 f1             	div    %rcx
+  804e2b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804e2f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e3b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e3f:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e47:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e4f:	48 39 c2             	cmp    %rax,%rdx
+  804e52:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e56:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804e5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5e:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804e62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e66:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e6a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e72:	48 89 ce             	mov    %rcx,%rsi
+  804e75:	48 89 c7             	mov    %rax,%rdi
+  804e78:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  804e7f:	00 00 00 
+  804e82:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804e84:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e88:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804e8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e90:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804e94:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e98:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e9c:	48 01 d1             	add    %rdx,%rcx
+  804e9f:	48 89 c2             	mov    %rax,%rdx
+  804ea2:	48 89 cf             	mov    %rcx,%rdi
+  804ea5:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  804eac:	00 00 00 
+  804eaf:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804eb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eb5:	48 8b 10             	mov    (%rax),%rdx
+  804eb8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ebc:	48 01 c2             	add    %rax,%rdx
+  804ebf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec3:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804ec6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eca:	48 89 c7             	mov    %rax,%rdi
+  804ecd:	48 b8 ac 4c 80 00 00 	movabs $0x804cac,%rax
+  804ed4:	00 00 00 
+  804ed7:	ff d0                	call   *%rax
+  return n;
+  804ed9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804edd:	c9                   	leave
+  804ede:	c3                   	ret
+
+0000000000804edf <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804edf:	55                   	push   %rbp
+  804ee0:	48 89 e5             	mov    %rsp,%rbp
+  804ee3:	48 83 ec 70          	sub    $0x70,%rsp
+  804ee7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804eeb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804eef:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804ef3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ef7:	48 89 c7             	mov    %rax,%rdi
+  804efa:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  804f01:	00 00 00 
+  804f04:	ff d0                	call   *%rax
+  804f06:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804f0a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f0e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804f12:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804f19:	00 
+  804f1a:	e9 b8 01 00 00       	jmp    8050d7 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804f1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f23:	8b 40 18             	mov    0x18(%rax),%eax
+  804f26:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804f29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f35:	48 8b 00             	mov    (%rax),%rax
+  804f38:	48 29 c2             	sub    %rax,%rdx
+  804f3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f43:	48 39 c2             	cmp    %rax,%rdx
+  804f46:	75 4d                	jne    804f95 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804f48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f4c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f50:	48 89 d6             	mov    %rdx,%rsi
+  804f53:	48 89 c7             	mov    %rax,%rdi
+  804f56:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  804f5d:	00 00 00 
+  804f60:	ff d0                	call   *%rax
+  804f62:	85 c0                	test   %eax,%eax
+  804f64:	74 0a                	je     804f70 <devpipe_write+0x91>
+        return 0;
+  804f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6b:	e9 79 01 00 00       	jmp    8050e9 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804f70:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f77:	89 d6                	mov    %edx,%esi
+  804f79:	48 89 c7             	mov    %rax,%rdi
+  804f7c:	48 b8 fe 4c 80 00 00 	movabs $0x804cfe,%rax
+  804f83:	00 00 00 
+  804f86:	ff d0                	call   *%rax
+      m = 0;
+  804f88:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804f8f:	00 
+      continue;
+  804f90:	e9 3a 01 00 00       	jmp    8050cf <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804f95:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f99:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804f9d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804fa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fad:	48 8b 08             	mov    (%rax),%rcx
+  804fb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fb8:	48 29 c1             	sub    %rax,%rcx
+  804fbb:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804fbf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804fc3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804fc7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fcb:	48 39 c2             	cmp    %rax,%rdx
+  804fce:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fd2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804fd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fda:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fde:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fe2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  804feb:	48 f7 f1             	div    %rcx
+  804fee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ff6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804ffa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ffe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805002:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805006:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80500a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80500e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805012:	48 39 c2             	cmp    %rax,%rdx
+  805015:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805019:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80501d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805021:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805025:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805029:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80502d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805031:	48 01 d1             	add    %rdx,%rcx
+  805034:	48 89 c2             	mov    %rax,%rdx
+  805037:	48 89 cf             	mov    %rcx,%rdi
+  80503a:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  805041:	00 00 00 
+  805044:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805046:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80504a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80504e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805052:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805056:	73 4d                	jae    8050a5 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805058:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80505c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805060:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805064:	48 29 c2             	sub    %rax,%rdx
+  805067:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80506b:	48 01 c2             	add    %rax,%rdx
+  80506e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805072:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805076:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80507a:	48 89 c1             	mov    %rax,%rcx
+  80507d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805081:	48 01 c1             	add    %rax,%rcx
+  805084:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805088:	48 01 c1             	add    %rax,%rcx
+  80508b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80508f:	48 83 c0 20          	add    $0x20,%rax
+  805093:	48 89 ce             	mov    %rcx,%rsi
+  805096:	48 89 c7             	mov    %rax,%rdi
+  805099:	48 b8 e9 1a 80 00 00 	movabs $0x801ae9,%rax
+  8050a0:	00 00 00 
+  8050a3:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8050a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050a9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8050ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050b1:	48 01 c2             	add    %rax,%rdx
+  8050b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050b8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8050bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050c0:	48 89 c7             	mov    %rax,%rdi
+  8050c3:	48 b8 ac 4c 80 00 00 	movabs $0x804cac,%rax
+  8050ca:	00 00 00 
+  8050cd:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8050cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050d3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8050d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050db:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8050df:	0f 82 3a fe ff ff    	jb     804f1f <devpipe_write+0x40>
+  }
+
+  return i;
+  8050e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8050e9:	c9                   	leave
+  8050ea:	c3                   	ret
+
+00000000008050eb <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8050eb:	55                   	push   %rbp
+  8050ec:	48 89 e5             	mov    %rsp,%rbp
+  8050ef:	48 83 ec 40          	sub    $0x40,%rsp
+  8050f3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8050f7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8050fa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805102:	48 89 c7             	mov    %rax,%rdi
+  805105:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  80510c:	00 00 00 
+  80510f:	ff d0                	call   *%rax
+  805111:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805115:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80511c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805120:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805124:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805128:	48 89 d6             	mov    %rdx,%rsi
+  80512b:	48 89 c7             	mov    %rax,%rdi
+  80512e:	48 b8 c6 3d 80 00 00 	movabs $0x803dc6,%rax
+  805135:	00 00 00 
+  805138:	ff d0                	call   *%rax
+  80513a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80513d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805141:	79 08                	jns    80514b <devpipe_poll+0x60>
+    return r;
+  805143:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805146:	e9 85 00 00 00       	jmp    8051d0 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80514b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80514e:	83 e0 01             	and    $0x1,%eax
+  805151:	85 c0                	test   %eax,%eax
+  805153:	74 18                	je     80516d <devpipe_poll+0x82>
+  805155:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805159:	48 8b 10             	mov    (%rax),%rdx
+  80515c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805160:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805164:	48 39 c2             	cmp    %rax,%rdx
+  805167:	74 04                	je     80516d <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805169:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80516d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805170:	83 e0 02             	and    $0x2,%eax
+  805173:	85 c0                	test   %eax,%eax
+  805175:	74 23                	je     80519a <devpipe_poll+0xaf>
+  805177:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80517b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80517f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805183:	48 8b 00             	mov    (%rax),%rax
+  805186:	48 29 c2             	sub    %rax,%rdx
+  805189:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80518d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805191:	48 39 c2             	cmp    %rax,%rdx
+  805194:	73 04                	jae    80519a <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805196:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80519a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80519e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051a2:	48 89 d6             	mov    %rdx,%rsi
+  8051a5:	48 89 c7             	mov    %rax,%rdi
+  8051a8:	48 b8 23 4b 80 00 00 	movabs $0x804b23,%rax
+  8051af:	00 00 00 
+  8051b2:	ff d0                	call   *%rax
+  8051b4:	85 c0                	test   %eax,%eax
+  8051b6:	74 04                	je     8051bc <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8051b8:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8051bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051c0:	75 0b                	jne    8051cd <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8051c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c6:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8051cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8051d0:	c9                   	leave
+  8051d1:	c3                   	ret
+
+00000000008051d2 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8051d2:	55                   	push   %rbp
+  8051d3:	48 89 e5             	mov    %rsp,%rbp
+  8051d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8051da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8051e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051e6:	48 89 c7             	mov    %rax,%rdi
+  8051e9:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  8051f0:	00 00 00 
+  8051f3:	ff d0                	call   *%rax
+  8051f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8051f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051fd:	48 ba 11 6d 80 00 00 	movabs $0x806d11,%rdx
+  805204:	00 00 00 
+  805207:	48 89 d6             	mov    %rdx,%rsi
+  80520a:	48 89 c7             	mov    %rax,%rdi
+  80520d:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  805214:	00 00 00 
+  805217:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805219:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80521d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805221:	89 c1                	mov    %eax,%ecx
+  805223:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805227:	48 8b 00             	mov    (%rax),%rax
+  80522a:	89 c2                	mov    %eax,%edx
+  80522c:	89 c8                	mov    %ecx,%eax
+  80522e:	29 d0                	sub    %edx,%eax
+  805230:	89 c2                	mov    %eax,%edx
+  805232:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805236:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80523c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805240:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805247:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80524a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80524e:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805255:	00 00 00 
+  805258:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80525f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805264:	c9                   	leave
+  805265:	c3                   	ret
+
+0000000000805266 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805266:	55                   	push   %rbp
+  805267:	48 89 e5             	mov    %rsp,%rbp
+  80526a:	48 83 ec 40          	sub    $0x40,%rsp
+  80526e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805272:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805276:	48 89 c7             	mov    %rax,%rdi
+  805279:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  805280:	00 00 00 
+  805283:	ff d0                	call   *%rax
+  805285:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805289:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805290:	00 
+  805291:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805295:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805299:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80529d:	48 01 d0             	add    %rdx,%rax
+  8052a0:	48 83 c0 1f          	add    $0x1f,%rax
+  8052a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8052a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052b1:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8052b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052b9:	48 29 d0             	sub    %rdx,%rax
+  8052bc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052c0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8052c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052c8:	48 89 c6             	mov    %rax,%rsi
+  8052cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052d0:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  8052d7:	00 00 00 
+  8052da:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8052dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052e0:	48 89 c7             	mov    %rax,%rdi
+  8052e3:	48 b8 ac 4c 80 00 00 	movabs $0x804cac,%rax
+  8052ea:	00 00 00 
+  8052ed:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8052ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8052f7:	eb 2f                	jmp    805328 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8052f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052fd:	48 83 e8 01          	sub    $0x1,%rax
+  805301:	48 c1 e0 0c          	shl    $0xc,%rax
+  805305:	48 89 c2             	mov    %rax,%rdx
+  805308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80530c:	48 01 d0             	add    %rdx,%rax
+  80530f:	48 89 c6             	mov    %rax,%rsi
+  805312:	bf 00 00 00 00       	mov    $0x0,%edi
+  805317:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  80531e:	00 00 00 
+  805321:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805323:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805328:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80532d:	77 ca                	ja     8052f9 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80532f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805333:	48 89 c6             	mov    %rax,%rsi
+  805336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80533b:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  805342:	00 00 00 
+  805345:	ff d0                	call   *%rax
+}
+  805347:	c9                   	leave
+  805348:	c3                   	ret
+
+0000000000805349 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  805349:	55                   	push   %rbp
+  80534a:	48 89 e5             	mov    %rsp,%rbp
+  80534d:	48 83 ec 10          	sub    $0x10,%rsp
+  805351:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805355:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  805359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80535d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805361:	48 89 c7             	mov    %rax,%rdi
+  805364:	ff d2                	call   *%rdx
+  thread_exit(0);
+  805366:	bf 00 00 00 00       	mov    $0x0,%edi
+  80536b:	48 b8 ad 55 80 00 00 	movabs $0x8055ad,%rax
+  805372:	00 00 00 
+  805375:	ff d0                	call   *%rax
+}
+  805377:	90                   	nop
+  805378:	c9                   	leave
+  805379:	c3                   	ret
+
+000000000080537a <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  80537a:	55                   	push   %rbp
+  80537b:	48 89 e5             	mov    %rsp,%rbp
+  80537e:	48 83 ec 20          	sub    $0x20,%rsp
+  805382:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805385:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805388:	c1 e0 10             	shl    $0x10,%eax
+  80538b:	48 98                	cltq
+  80538d:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805392:	48 01 d0             	add    %rdx,%rax
+  805395:	48 89 c6             	mov    %rax,%rsi
+  805398:	bf 00 00 00 00       	mov    $0x0,%edi
+  80539d:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  8053a4:	00 00 00 
+  8053a7:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8053a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053ac:	83 c0 01             	add    $0x1,%eax
+  8053af:	c1 e0 10             	shl    $0x10,%eax
+  8053b2:	48 98                	cltq
+  8053b4:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8053b9:	48 01 d0             	add    %rdx,%rax
+  8053bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8053c0:	eb 20                	jmp    8053e2 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  8053c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053c6:	48 89 c6             	mov    %rax,%rsi
+  8053c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053ce:	48 b8 26 22 80 00 00 	movabs $0x802226,%rax
+  8053d5:	00 00 00 
+  8053d8:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8053da:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8053e1:	00 
+  8053e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e5:	83 c0 01             	add    $0x1,%eax
+  8053e8:	c1 e0 10             	shl    $0x10,%eax
+  8053eb:	48 98                	cltq
+  8053ed:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8053f2:	48 01 d0             	add    %rdx,%rax
+  8053f5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8053f9:	72 c7                	jb     8053c2 <slot_unmap+0x48>
+}
+  8053fb:	90                   	nop
+  8053fc:	90                   	nop
+  8053fd:	c9                   	leave
+  8053fe:	c3                   	ret
+
+00000000008053ff <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  8053ff:	55                   	push   %rbp
+  805400:	48 89 e5             	mov    %rsp,%rbp
+  805403:	48 83 ec 30          	sub    $0x30,%rsp
+  805407:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80540b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80540f:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805416:	00 00 00 
+  805419:	48 89 c7             	mov    %rax,%rdi
+  80541c:	48 b8 5b 60 80 00 00 	movabs $0x80605b,%rax
+  805423:	00 00 00 
+  805426:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805428:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80542f:	eb 04                	jmp    805435 <thread_create+0x36>
+  805431:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805435:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805439:	7f 16                	jg     805451 <thread_create+0x52>
+  80543b:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805442:	00 00 00 
+  805445:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805448:	48 98                	cltq
+  80544a:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80544d:	85 c0                	test   %eax,%eax
+  80544f:	75 e0                	jne    805431 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  805451:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  805455:	75 0c                	jne    805463 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  805457:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  80545e:	e9 2c 01 00 00       	jmp    80558f <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805463:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805466:	c1 e0 10             	shl    $0x10,%eax
+  805469:	48 98                	cltq
+  80546b:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805470:	48 01 d0             	add    %rdx,%rax
+  805473:	ba 07 00 00 00       	mov    $0x7,%edx
+  805478:	48 89 c6             	mov    %rax,%rsi
+  80547b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805480:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  805487:	00 00 00 
+  80548a:	ff d0                	call   *%rax
+  80548c:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80548f:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805493:	0f 88 f5 00 00 00    	js     80558e <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805499:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80549c:	83 c0 01             	add    $0x1,%eax
+  80549f:	c1 e0 10             	shl    $0x10,%eax
+  8054a2:	48 98                	cltq
+  8054a4:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8054a9:	48 01 d0             	add    %rdx,%rax
+  8054ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8054b0:	eb 32                	jmp    8054e4 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  8054b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054b6:	ba 07 00 00 00       	mov    $0x7,%edx
+  8054bb:	48 89 c6             	mov    %rax,%rsi
+  8054be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c3:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  8054ca:	00 00 00 
+  8054cd:	ff d0                	call   *%rax
+  8054cf:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8054d2:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8054d6:	0f 88 9e 00 00 00    	js     80557a <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8054dc:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8054e3:	00 
+  8054e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054e7:	83 c0 01             	add    $0x1,%eax
+  8054ea:	c1 e0 10             	shl    $0x10,%eax
+  8054ed:	48 98                	cltq
+  8054ef:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8054f4:	48 01 d0             	add    %rdx,%rax
+  8054f7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8054fb:	72 b5                	jb     8054b2 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  8054fd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805501:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805505:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805508:	c1 e2 10             	shl    $0x10,%edx
+  80550b:	48 63 d2             	movslq %edx,%rdx
+  80550e:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805513:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805516:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805519:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80551c:	83 c2 01             	add    $0x1,%edx
+  80551f:	c1 e2 10             	shl    $0x10,%edx
+  805522:	48 63 d2             	movslq %edx,%rdx
+  805525:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  80552a:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  80552d:	48 bf 49 53 80 00 00 	movabs $0x805349,%rdi
+  805534:	00 00 00 
+  805537:	49 89 c8             	mov    %rcx,%r8
+  80553a:	48 89 c1             	mov    %rax,%rcx
+  80553d:	4c 89 ca             	mov    %r9,%rdx
+  805540:	48 b8 0e 26 80 00 00 	movabs $0x80260e,%rax
+  805547:	00 00 00 
+  80554a:	ff d0                	call   *%rax
+  80554c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  80554f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805553:	79 08                	jns    80555d <thread_create+0x15e>
+    r = id;
+  805555:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805558:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  80555b:	eb 1e                	jmp    80557b <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  80555d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805560:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805563:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  80556a:	00 00 00 
+  80556d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805570:	48 98                	cltq
+  805572:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805575:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805578:	eb 15                	jmp    80558f <thread_create+0x190>
+      goto fail;
+  80557a:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  80557b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80557e:	89 c7                	mov    %eax,%edi
+  805580:	48 b8 7a 53 80 00 00 	movabs $0x80537a,%rax
+  805587:	00 00 00 
+  80558a:	ff d0                	call   *%rax
+  80558c:	eb 01                	jmp    80558f <thread_create+0x190>
+    goto out;
+  80558e:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  80558f:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805596:	00 00 00 
+  805599:	48 89 c7             	mov    %rax,%rdi
+  80559c:	48 b8 30 61 80 00 00 	movabs $0x806130,%rax
+  8055a3:	00 00 00 
+  8055a6:	ff d0                	call   *%rax
+  return r;
+  8055a8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8055ab:	c9                   	leave
+  8055ac:	c3                   	ret
+
+00000000008055ad <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  8055ad:	55                   	push   %rbp
+  8055ae:	48 89 e5             	mov    %rsp,%rbp
+  8055b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8055b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  8055b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055bb:	89 c7                	mov    %eax,%edi
+  8055bd:	48 b8 6b 26 80 00 00 	movabs $0x80266b,%rax
+  8055c4:	00 00 00 
+  8055c7:	ff d0                	call   *%rax
+}
+  8055c9:	90                   	nop
+  8055ca:	c9                   	leave
+  8055cb:	c3                   	ret
+
+00000000008055cc <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  8055cc:	55                   	push   %rbp
+  8055cd:	48 89 e5             	mov    %rsp,%rbp
+  8055d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8055d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  8055db:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8055e2:	00 00 00 
+  8055e5:	48 89 c7             	mov    %rax,%rdi
+  8055e8:	48 b8 5b 60 80 00 00 	movabs $0x80605b,%rax
+  8055ef:	00 00 00 
+  8055f2:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  8055f4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8055fb:	eb 04                	jmp    805601 <thread_join+0x35>
+  8055fd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805601:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805605:	7f 17                	jg     80561e <thread_join+0x52>
+  805607:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80560e:	00 00 00 
+  805611:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805614:	48 98                	cltq
+  805616:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805619:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80561c:	75 df                	jne    8055fd <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  80561e:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805625:	00 00 00 
+  805628:	48 89 c7             	mov    %rax,%rdi
+  80562b:	48 b8 30 61 80 00 00 	movabs $0x806130,%rax
+  805632:	00 00 00 
+  805635:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805637:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80563b:	74 06                	je     805643 <thread_join+0x77>
+  80563d:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805641:	75 07                	jne    80564a <thread_join+0x7e>
+    return -E_BAD_ENV;
+  805643:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805648:	eb 76                	jmp    8056c0 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  80564a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80564e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805651:	48 89 d6             	mov    %rdx,%rsi
+  805654:	89 c7                	mov    %eax,%edi
+  805656:	48 b8 4d 5f 80 00 00 	movabs $0x805f4d,%rax
+  80565d:	00 00 00 
+  805660:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  805662:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805669:	00 00 00 
+  80566c:	48 89 c7             	mov    %rax,%rdi
+  80566f:	48 b8 5b 60 80 00 00 	movabs $0x80605b,%rax
+  805676:	00 00 00 
+  805679:	ff d0                	call   *%rax
+  slot_unmap(i);
+  80567b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80567e:	89 c7                	mov    %eax,%edi
+  805680:	48 b8 7a 53 80 00 00 	movabs $0x80537a,%rax
+  805687:	00 00 00 
+  80568a:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  80568c:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805693:	00 00 00 
+  805696:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805699:	48 98                	cltq
+  80569b:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  8056a2:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8056a9:	00 00 00 
+  8056ac:	48 89 c7             	mov    %rax,%rdi
+  8056af:	48 b8 30 61 80 00 00 	movabs $0x806130,%rax
+  8056b6:	00 00 00 
+  8056b9:	ff d0                	call   *%rax
+  return 0;
+  8056bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056c0:	c9                   	leave
+  8056c1:	c3                   	ret
+
+00000000008056c2 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  8056c2:	55                   	push   %rbp
+  8056c3:	48 89 e5             	mov    %rsp,%rbp
+  8056c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8056ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8056ce:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8056d3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056d7:	73 23                	jae    8056fc <thread_is_uxstack+0x3a>
+  8056d9:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8056de:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056e2:	72 18                	jb     8056fc <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  8056e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056e8:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8056ed:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8056f3:	75 07                	jne    8056fc <thread_is_uxstack+0x3a>
+  8056f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8056fa:	eb 05                	jmp    805701 <thread_is_uxstack+0x3f>
+  8056fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805701:	83 e0 01             	and    $0x1,%eax
+}
+  805704:	c9                   	leave
+  805705:	c3                   	ret
+
+0000000000805706 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805706:	55                   	push   %rbp
+  805707:	48 89 e5             	mov    %rsp,%rbp
+  80570a:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  80570e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805715:	00 00 00 
+  805718:	8b 40 04             	mov    0x4(%rax),%eax
+  80571b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805720:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805727:	00 00 00 
+  80572a:	48 98                	cltq
+  80572c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805733:	48 01 d0             	add    %rdx,%rax
+  805736:	48 05 08 01 00 00    	add    $0x108,%rax
+  80573c:	48 8b 00             	mov    (%rax),%rax
+  80573f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805743:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805748:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80574c:	73 0b                	jae    805759 <thread_pftemp+0x53>
+  80574e:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805753:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805757:	73 07                	jae    805760 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805759:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  80575e:	eb 26                	jmp    805786 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805760:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805767:	ff ff ff 
+  80576a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80576e:	48 01 d0             	add    %rdx,%rax
+  805771:	48 c1 e8 10          	shr    $0x10,%rax
+  805775:	48 83 c0 01          	add    $0x1,%rax
+  805779:	48 c1 e0 0c          	shl    $0xc,%rax
+  80577d:	48 f7 d8             	neg    %rax
+  805780:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805786:	c9                   	leave
+  805787:	c3                   	ret
+
+0000000000805788 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805788:	55                   	push   %rbp
+  805789:	48 89 e5             	mov    %rsp,%rbp
+  80578c:	48 83 ec 08          	sub    $0x8,%rsp
+  805790:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805793:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805797:	75 10                	jne    8057a9 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805799:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057a0:	00 00 00 
+  8057a3:	8b 00                	mov    (%rax),%eax
+  8057a5:	48 98                	cltq
+  8057a7:	eb 05                	jmp    8057ae <vsyscall+0x26>
+  }
+  return 0;
+  8057a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057ae:	c9                   	leave
+  8057af:	c3                   	ret
+
+00000000008057b0 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8057b0:	55                   	push   %rbp
+  8057b1:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8057b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057b9:	48 b8 88 57 80 00 00 	movabs $0x805788,%rax
+  8057c0:	00 00 00 
+  8057c3:	ff d0                	call   *%rax
+}
+  8057c5:	5d                   	pop    %rbp
+  8057c6:	c3                   	ret
+
+00000000008057c7 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8057c7:	55                   	push   %rbp
+  8057c8:	48 89 e5             	mov    %rsp,%rbp
+  8057cb:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8057cf:	0f 31                	rdtsc
+  8057d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057d4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8057d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057da:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8057dd:	48 c1 e2 20          	shl    $0x20,%rdx
+  8057e1:	48 09 d0             	or     %rdx,%rax
+  8057e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8057e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8057ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8057f0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057f7:	00 00 00 
+  8057fa:	8b 40 08             	mov    0x8(%rax),%eax
+  8057fd:	48 98                	cltq
+  8057ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80580c:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805810:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80581b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805820:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805824:	48 89 d0             	mov    %rdx,%rax
+  805827:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80582e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805833:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805837:	48 01 c8             	add    %rcx,%rax
+}
+  80583a:	c9                   	leave
+  80583b:	c3                   	ret
+
+000000000080583c <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80583c:	55                   	push   %rbp
+  80583d:	48 89 e5             	mov    %rsp,%rbp
+  805840:	48 83 ec 20          	sub    $0x20,%rsp
+  805844:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805847:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80584a:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  80584d:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805851:	be 01 00 00 00       	mov    $0x1,%esi
+  805856:	48 89 c7             	mov    %rax,%rdi
+  805859:	48 b8 57 1f 80 00 00 	movabs $0x801f57,%rax
+  805860:	00 00 00 
+  805863:	ff d0                	call   *%rax
+}
+  805865:	90                   	nop
+  805866:	c9                   	leave
+  805867:	c3                   	ret
+
+0000000000805868 <getchar>:
+
+int
+getchar(void) {
+  805868:	55                   	push   %rbp
+  805869:	48 89 e5             	mov    %rsp,%rbp
+  80586c:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805870:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805874:	ba 01 00 00 00       	mov    $0x1,%edx
+  805879:	48 89 c6             	mov    %rax,%rsi
+  80587c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805881:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  805888:	00 00 00 
+  80588b:	ff d0                	call   *%rax
+  80588d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805890:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805894:	79 05                	jns    80589b <getchar+0x33>
+    return r;
+  805896:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805899:	eb 14                	jmp    8058af <getchar+0x47>
+  if (r < 1)
+  80589b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80589f:	7f 07                	jg     8058a8 <getchar+0x40>
+    return -E_EOF;
+  8058a1:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8058a6:	eb 07                	jmp    8058af <getchar+0x47>
+  return c;
+  8058a8:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8058ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8058af:	c9                   	leave
+  8058b0:	c3                   	ret
+
+00000000008058b1 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8058b1:	55                   	push   %rbp
+  8058b2:	48 89 e5             	mov    %rsp,%rbp
+  8058b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8058b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8058bc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8058c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058c3:	48 89 d6             	mov    %rdx,%rsi
+  8058c6:	89 c7                	mov    %eax,%edi
+  8058c8:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  8058cf:	00 00 00 
+  8058d2:	ff d0                	call   *%rax
+  8058d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058d7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058db:	79 05                	jns    8058e2 <iscons+0x31>
+    return r;
+  8058dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058e0:	eb 1a                	jmp    8058fc <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8058e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058e6:	8b 10                	mov    (%rax),%edx
+  8058e8:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8058ef:	00 00 00 
+  8058f2:	8b 00                	mov    (%rax),%eax
+  8058f4:	39 c2                	cmp    %eax,%edx
+  8058f6:	0f 94 c0             	sete   %al
+  8058f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8058fc:	c9                   	leave
+  8058fd:	c3                   	ret
+
+00000000008058fe <opencons>:
+
+int
+opencons(void) {
+  8058fe:	55                   	push   %rbp
+  8058ff:	48 89 e5             	mov    %rsp,%rbp
+  805902:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805906:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80590a:	48 89 c7             	mov    %rax,%rdi
+  80590d:	48 b8 1e 33 80 00 00 	movabs $0x80331e,%rax
+  805914:	00 00 00 
+  805917:	ff d0                	call   *%rax
+  805919:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80591c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805920:	79 05                	jns    805927 <opencons+0x29>
+    return r;
+  805922:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805925:	eb 66                	jmp    80598d <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805927:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80592b:	ba 07 04 00 00       	mov    $0x407,%edx
+  805930:	48 89 c6             	mov    %rax,%rsi
+  805933:	bf 00 00 00 00       	mov    $0x0,%edi
+  805938:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  80593f:	00 00 00 
+  805942:	ff d0                	call   *%rax
+  805944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805947:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80594b:	79 05                	jns    805952 <opencons+0x54>
+    return r;
+  80594d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805950:	eb 3b                	jmp    80598d <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805952:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805956:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  80595d:	00 00 00 
+  805960:	8b 12                	mov    (%rdx),%edx
+  805962:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805964:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805968:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  80596f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805973:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80597a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80597e:	48 89 c7             	mov    %rax,%rdi
+  805981:	48 b8 d0 32 80 00 00 	movabs $0x8032d0,%rax
+  805988:	00 00 00 
+  80598b:	ff d0                	call   *%rax
+}
+  80598d:	c9                   	leave
+  80598e:	c3                   	ret
+
+000000000080598f <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  80598f:	55                   	push   %rbp
+  805990:	48 89 e5             	mov    %rsp,%rbp
+  805993:	48 83 ec 20          	sub    $0x20,%rsp
+  805997:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80599a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80599d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8059a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059a4:	48 89 d6             	mov    %rdx,%rsi
+  8059a7:	89 c7                	mov    %eax,%edi
+  8059a9:	48 b8 00 34 80 00 00 	movabs $0x803400,%rax
+  8059b0:	00 00 00 
+  8059b3:	ff d0                	call   *%rax
+  8059b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059bc:	79 05                	jns    8059c3 <consmode+0x34>
+    return r;
+  8059be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059c1:	eb 34                	jmp    8059f7 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8059c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059c7:	8b 10                	mov    (%rax),%edx
+  8059c9:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8059d0:	00 00 00 
+  8059d3:	8b 00                	mov    (%rax),%eax
+  8059d5:	39 c2                	cmp    %eax,%edx
+  8059d7:	74 07                	je     8059e0 <consmode+0x51>
+    return -E_INVAL;
+  8059d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059de:	eb 17                	jmp    8059f7 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8059e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059e4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8059e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8059ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059ee:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059f1:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8059f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8059f7:	c9                   	leave
+  8059f8:	c3                   	ret
+
+00000000008059f9 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8059f9:	55                   	push   %rbp
+  8059fa:	48 89 e5             	mov    %rsp,%rbp
+  8059fd:	48 83 ec 20          	sub    $0x20,%rsp
+  805a01:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a05:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a09:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805a0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a11:	8b 50 0c             	mov    0xc(%rax),%edx
+  805a14:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805a18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a1c:	48 89 ce             	mov    %rcx,%rsi
+  805a1f:	48 89 c7             	mov    %rax,%rdi
+  805a22:	48 b8 c8 24 80 00 00 	movabs $0x8024c8,%rax
+  805a29:	00 00 00 
+  805a2c:	ff d0                	call   *%rax
+  805a2e:	48 98                	cltq
+}
+  805a30:	c9                   	leave
+  805a31:	c3                   	ret
+
+0000000000805a32 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805a32:	55                   	push   %rbp
+  805a33:	48 89 e5             	mov    %rsp,%rbp
+  805a36:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805a3d:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805a44:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805a4b:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805a52:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805a59:	eb 74                	jmp    805acf <devcons_write+0x9d>
+    m = n - tot;
+  805a5b:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805a62:	89 c2                	mov    %eax,%edx
+  805a64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a67:	29 c2                	sub    %eax,%edx
+  805a69:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805a6c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a6f:	83 f8 7f             	cmp    $0x7f,%eax
+  805a72:	76 07                	jbe    805a7b <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805a74:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805a7b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a7e:	48 63 d0             	movslq %eax,%rdx
+  805a81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a84:	48 63 c8             	movslq %eax,%rcx
+  805a87:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805a8e:	48 01 c1             	add    %rax,%rcx
+  805a91:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a98:	48 89 ce             	mov    %rcx,%rsi
+  805a9b:	48 89 c7             	mov    %rax,%rdi
+  805a9e:	48 b8 e3 18 80 00 00 	movabs $0x8018e3,%rax
+  805aa5:	00 00 00 
+  805aa8:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805aaa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805aad:	48 63 d0             	movslq %eax,%rdx
+  805ab0:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805ab7:	48 89 d6             	mov    %rdx,%rsi
+  805aba:	48 89 c7             	mov    %rax,%rdi
+  805abd:	48 b8 57 1f 80 00 00 	movabs $0x801f57,%rax
+  805ac4:	00 00 00 
+  805ac7:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805ac9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805acc:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805acf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ad2:	48 98                	cltq
+  805ad4:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805adb:	0f 82 7a ff ff ff    	jb     805a5b <devcons_write+0x29>
+  }
+  return tot;
+  805ae1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ae4:	48 98                	cltq
+}
+  805ae6:	c9                   	leave
+  805ae7:	c3                   	ret
+
+0000000000805ae8 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805ae8:	55                   	push   %rbp
+  805ae9:	48 89 e5             	mov    %rsp,%rbp
+  805aec:	48 83 ec 08          	sub    $0x8,%rsp
+  805af0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805af4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805af9:	c9                   	leave
+  805afa:	c3                   	ret
+
+0000000000805afb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805afb:	55                   	push   %rbp
+  805afc:	48 89 e5             	mov    %rsp,%rbp
+  805aff:	48 83 ec 10          	sub    $0x10,%rsp
+  805b03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b0f:	48 ba 1d 6d 80 00 00 	movabs $0x806d1d,%rdx
+  805b16:	00 00 00 
+  805b19:	48 89 d6             	mov    %rdx,%rsi
+  805b1c:	48 89 c7             	mov    %rax,%rdi
+  805b1f:	48 b8 a0 13 80 00 00 	movabs $0x8013a0,%rax
+  805b26:	00 00 00 
+  805b29:	ff d0                	call   *%rax
+  return 0;
+  805b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b30:	c9                   	leave
+  805b31:	c3                   	ret
+
+0000000000805b32 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805b32:	55                   	push   %rbp
+  805b33:	48 89 e5             	mov    %rsp,%rbp
+  805b36:	48 83 ec 30          	sub    $0x30,%rsp
+  805b3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b3e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805b41:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805b45:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805b4c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b4f:	83 e0 02             	and    $0x2,%eax
+  805b52:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805b55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b59:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b5c:	83 f8 01             	cmp    $0x1,%eax
+  805b5f:	75 04                	jne    805b65 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805b61:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805b65:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b68:	83 e0 01             	and    $0x1,%eax
+  805b6b:	85 c0                	test   %eax,%eax
+  805b6d:	74 44                	je     805bb3 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805b6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b77:	89 c2                	mov    %eax,%edx
+  805b79:	be 00 00 00 00       	mov    $0x0,%esi
+  805b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b83:	48 b8 b6 25 80 00 00 	movabs $0x8025b6,%rax
+  805b8a:	00 00 00 
+  805b8d:	ff d0                	call   *%rax
+  805b8f:	83 f8 01             	cmp    $0x1,%eax
+  805b92:	75 06                	jne    805b9a <devcons_poll+0x68>
+      revents |= POLLIN;
+  805b94:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805b98:	eb 19                	jmp    805bb3 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805b9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b9e:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805ba4:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805ba7:	89 c2                	mov    %eax,%edx
+  805ba9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bad:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805bb3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805bb6:	c9                   	leave
+  805bb7:	c3                   	ret
+
+0000000000805bb8 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  805bb8:	55                   	push   %rbp
+  805bb9:	48 89 e5             	mov    %rsp,%rbp
+  805bbc:	53                   	push   %rbx
+  805bbd:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805bc4:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  805bcb:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  805bd1:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  805bd8:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  805bdf:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  805be6:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  805bed:	84 c0                	test   %al,%al
+  805bef:	74 23                	je     805c14 <_panic+0x5c>
+  805bf1:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  805bf8:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  805bfc:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  805c00:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  805c04:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  805c08:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  805c0c:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  805c10:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  805c14:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  805c1b:	00 00 00 
+  805c1e:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  805c25:	00 00 00 
+  805c28:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805c2c:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  805c33:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  805c3a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  805c41:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  805c48:	00 00 00 
+  805c4b:	48 8b 18             	mov    (%rax),%rbx
+  805c4e:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  805c55:	00 00 00 
+  805c58:	ff d0                	call   *%rax
+  805c5a:	89 c6                	mov    %eax,%esi
+  805c5c:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  805c62:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  805c69:	41 89 d0             	mov    %edx,%r8d
+  805c6c:	48 89 c1             	mov    %rax,%rcx
+  805c6f:	48 89 da             	mov    %rbx,%rdx
+  805c72:	48 b8 28 6d 80 00 00 	movabs $0x806d28,%rax
+  805c79:	00 00 00 
+  805c7c:	48 89 c7             	mov    %rax,%rdi
+  805c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c84:	49 b9 f0 03 80 00 00 	movabs $0x8003f0,%r9
+  805c8b:	00 00 00 
+  805c8e:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  805c91:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  805c98:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805c9f:	48 89 d6             	mov    %rdx,%rsi
+  805ca2:	48 89 c7             	mov    %rax,%rdi
+  805ca5:	48 b8 65 03 80 00 00 	movabs $0x800365,%rax
+  805cac:	00 00 00 
+  805caf:	ff d0                	call   *%rax
+  cprintf("\n");
+  805cb1:	48 b8 4b 6d 80 00 00 	movabs $0x806d4b,%rax
+  805cb8:	00 00 00 
+  805cbb:	48 89 c7             	mov    %rax,%rdi
+  805cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cc3:	48 ba f0 03 80 00 00 	movabs $0x8003f0,%rdx
+  805cca:	00 00 00 
+  805ccd:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805ccf:	cc                   	int3
+  805cd0:	eb fd                	jmp    805ccf <_panic+0x117>
+
+0000000000805cd2 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805cd2:	55                   	push   %rbp
+  805cd3:	48 89 e5             	mov    %rsp,%rbp
+  805cd6:	48 83 ec 20          	sub    $0x20,%rsp
+  805cda:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805cde:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  805ce5:	00 00 00 
+  805ce8:	ff d0                	call   *%rax
+  805cea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805ced:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805cf4:	00 00 00 
+  805cf7:	48 8b 00             	mov    (%rax),%rax
+  805cfa:	48 85 c0             	test   %rax,%rax
+  805cfd:	75 62                	jne    805d61 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d02:	ba 07 00 00 00       	mov    $0x7,%edx
+  805d07:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805d0e:	00 00 00 
+  805d11:	48 89 ce             	mov    %rcx,%rsi
+  805d14:	89 c7                	mov    %eax,%edi
+  805d16:	48 b8 6e 21 80 00 00 	movabs $0x80216e,%rax
+  805d1d:	00 00 00 
+  805d20:	ff d0                	call   *%rax
+  805d22:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805d25:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805d29:	79 36                	jns    805d61 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805d2b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d2e:	89 c1                	mov    %eax,%ecx
+  805d30:	48 b8 4d 6d 80 00 00 	movabs $0x806d4d,%rax
+  805d37:	00 00 00 
+  805d3a:	48 89 c2             	mov    %rax,%rdx
+  805d3d:	be 23 00 00 00       	mov    $0x23,%esi
+  805d42:	48 b8 65 6d 80 00 00 	movabs $0x806d65,%rax
+  805d49:	00 00 00 
+  805d4c:	48 89 c7             	mov    %rax,%rdi
+  805d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d54:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  805d5b:	00 00 00 
+  805d5e:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805d61:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  805d68:	00 00 00 
+  805d6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d6f:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805d72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d75:	48 ba d2 5d 80 00 00 	movabs $0x805dd2,%rdx
+  805d7c:	00 00 00 
+  805d7f:	48 89 d6             	mov    %rdx,%rsi
+  805d82:	89 c7                	mov    %eax,%edi
+  805d84:	48 b8 0b 23 80 00 00 	movabs $0x80230b,%rax
+  805d8b:	00 00 00 
+  805d8e:	ff d0                	call   *%rax
+  805d90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805d93:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805d97:	79 36                	jns    805dcf <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805d99:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d9c:	89 c1                	mov    %eax,%ecx
+  805d9e:	48 b8 4d 6d 80 00 00 	movabs $0x806d4d,%rax
+  805da5:	00 00 00 
+  805da8:	48 89 c2             	mov    %rax,%rdx
+  805dab:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805db0:	48 b8 65 6d 80 00 00 	movabs $0x806d65,%rax
+  805db7:	00 00 00 
+  805dba:	48 89 c7             	mov    %rax,%rdi
+  805dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dc2:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  805dc9:	00 00 00 
+  805dcc:	41 ff d0             	call   *%r8
+}
+  805dcf:	90                   	nop
+  805dd0:	c9                   	leave
+  805dd1:	c3                   	ret
+
+0000000000805dd2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805dd2:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805dd5:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805dd8:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805ddf:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805de3:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805de8:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  805def:	00 00 00 
+	call *%rax
+  805df2:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805df4:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805df9:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805dfc:	41 5f                	pop    %r15
+	popq %r15
+  805dfe:	41 5f                	pop    %r15
+	popq %r15
+  805e00:	41 5f                	pop    %r15
+	popq %r14
+  805e02:	41 5e                	pop    %r14
+	popq %r13
+  805e04:	41 5d                	pop    %r13
+	popq %r12
+  805e06:	41 5c                	pop    %r12
+	popq %r11
+  805e08:	41 5b                	pop    %r11
+	popq %r10
+  805e0a:	41 5a                	pop    %r10
+	popq %r9
+  805e0c:	41 59                	pop    %r9
+	popq %r8
+  805e0e:	41 58                	pop    %r8
+	popq %rsi
+  805e10:	5e                   	pop    %rsi
+	popq %rdi
+  805e11:	5f                   	pop    %rdi
+	popq %rbp
+  805e12:	5d                   	pop    %rbp
+	popq %rdx
+  805e13:	5a                   	pop    %rdx
+	popq %rcx
+  805e14:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805e15:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805e1a:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805e1f:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805e23:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805e26:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805e2b:	5b                   	pop    %rbx
+	popq %rax
+  805e2c:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805e2d:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805e31:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805e32:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805e37:	c3                   	ret
+
+0000000000805e38 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805e38:	55                   	push   %rbp
+  805e39:	48 89 e5             	mov    %rsp,%rbp
+  805e3c:	48 83 ec 18          	sub    $0x18,%rsp
+  805e40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805e44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e48:	48 c1 e8 27          	shr    $0x27,%rax
+  805e4c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805e51:	48 89 c2             	mov    %rax,%rdx
+  805e54:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805e5b:	01 00 00 
+  805e5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e62:	83 e0 01             	and    $0x1,%eax
+  805e65:	48 85 c0             	test   %rax,%rax
+  805e68:	74 63                	je     805ecd <pageref+0x95>
+  805e6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e6e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805e72:	48 89 c2             	mov    %rax,%rdx
+  805e75:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805e7c:	01 00 00 
+  805e7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e83:	83 e0 01             	and    $0x1,%eax
+  805e86:	48 85 c0             	test   %rax,%rax
+  805e89:	74 42                	je     805ecd <pageref+0x95>
+  805e8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e8f:	48 c1 e8 15          	shr    $0x15,%rax
+  805e93:	48 89 c2             	mov    %rax,%rdx
+  805e96:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805e9d:	01 00 00 
+  805ea0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805ea4:	83 e0 01             	and    $0x1,%eax
+  805ea7:	48 85 c0             	test   %rax,%rax
+  805eaa:	74 21                	je     805ecd <pageref+0x95>
+  805eac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805eb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  805eb4:	48 89 c2             	mov    %rax,%rdx
+  805eb7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805ebe:	01 00 00 
+  805ec1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805ec5:	83 e0 01             	and    $0x1,%eax
+  805ec8:	48 85 c0             	test   %rax,%rax
+  805ecb:	75 07                	jne    805ed4 <pageref+0x9c>
+    return 0;
+  805ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ed2:	eb 53                	jmp    805f27 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805ed4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ed8:	48 c1 e8 0c          	shr    $0xc,%rax
+  805edc:	48 89 c2             	mov    %rax,%rdx
+  805edf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805ee6:	01 00 00 
+  805ee9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805eed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805ef1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ef5:	83 e0 01             	and    $0x1,%eax
+  805ef8:	48 85 c0             	test   %rax,%rax
+  805efb:	75 07                	jne    805f04 <pageref+0xcc>
+    return 0;
+  805efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f02:	eb 23                	jmp    805f27 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f08:	48 c1 e8 0c          	shr    $0xc,%rax
+  805f0c:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805f13:	00 00 00 
+  805f16:	48 c1 e0 04          	shl    $0x4,%rax
+  805f1a:	48 01 d0             	add    %rdx,%rax
+  805f1d:	48 83 c0 08          	add    $0x8,%rax
+  805f21:	0f b7 00             	movzwl (%rax),%eax
+  805f24:	0f b7 c0             	movzwl %ax,%eax
+}
+  805f27:	c9                   	leave
+  805f28:	c3                   	ret
+
+0000000000805f29 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805f29:	55                   	push   %rbp
+  805f2a:	48 89 e5             	mov    %rsp,%rbp
+  805f2d:	48 83 ec 10          	sub    $0x10,%rsp
+  805f31:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805f34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f37:	be 00 00 00 00       	mov    $0x0,%esi
+  805f3c:	89 c7                	mov    %eax,%edi
+  805f3e:	48 b8 4d 5f 80 00 00 	movabs $0x805f4d,%rax
+  805f45:	00 00 00 
+  805f48:	ff d0                	call   *%rax
+}
+  805f4a:	90                   	nop
+  805f4b:	c9                   	leave
+  805f4c:	c3                   	ret
+
+0000000000805f4d <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805f4d:	55                   	push   %rbp
+  805f4e:	48 89 e5             	mov    %rsp,%rbp
+  805f51:	48 83 ec 10          	sub    $0x10,%rsp
+  805f55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805f58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805f5c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f60:	75 3e                	jne    805fa0 <waitpid+0x53>
+  805f62:	48 b8 73 6d 80 00 00 	movabs $0x806d73,%rax
+  805f69:	00 00 00 
+  805f6c:	48 89 c1             	mov    %rax,%rcx
+  805f6f:	48 b8 7e 6d 80 00 00 	movabs $0x806d7e,%rax
+  805f76:	00 00 00 
+  805f79:	48 89 c2             	mov    %rax,%rdx
+  805f7c:	be 0e 00 00 00       	mov    $0xe,%esi
+  805f81:	48 b8 93 6d 80 00 00 	movabs $0x806d93,%rax
+  805f88:	00 00 00 
+  805f8b:	48 89 c7             	mov    %rax,%rdi
+  805f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f93:	49 b8 b8 5b 80 00 00 	movabs $0x805bb8,%r8
+  805f9a:	00 00 00 
+  805f9d:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805fa0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805fa5:	74 0a                	je     805fb1 <waitpid+0x64>
+    *status = 0;
+  805fa7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805fab:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805fb1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805fb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fb8:	48 89 d6             	mov    %rdx,%rsi
+  805fbb:	89 c7                	mov    %eax,%edi
+  805fbd:	48 b8 6d 20 80 00 00 	movabs $0x80206d,%rax
+  805fc4:	00 00 00 
+  805fc7:	ff d0                	call   *%rax
+}
+  805fc9:	c9                   	leave
+  805fca:	c3                   	ret
+
+0000000000805fcb <xchg>:
+  805fcb:	55                   	push   %rbp
+  805fcc:	48 89 e5             	mov    %rsp,%rbp
+  805fcf:	48 83 ec 20          	sub    $0x20,%rsp
+  805fd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805fd7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805fda:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805fde:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805fe1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805fe5:	f0 87 02             	lock xchg %eax,(%rdx)
+  805fe8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805feb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fee:	c9                   	leave
+  805fef:	c3                   	ret
+
+0000000000805ff0 <cmpxchg>:
+  805ff0:	55                   	push   %rbp
+  805ff1:	48 89 e5             	mov    %rsp,%rbp
+  805ff4:	48 83 ec 20          	sub    $0x20,%rsp
+  805ff8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ffc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805fff:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  806002:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806006:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806009:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80600c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806010:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806014:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806017:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80601a:	c9                   	leave
+  80601b:	c3                   	ret
+
+000000000080601c <xadd>:
+  80601c:	55                   	push   %rbp
+  80601d:	48 89 e5             	mov    %rsp,%rbp
+  806020:	48 83 ec 10          	sub    $0x10,%rsp
+  806024:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806028:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80602b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80602f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806032:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806036:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  80603a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80603d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806040:	c9                   	leave
+  806041:	c3                   	ret
+
+0000000000806042 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806042:	55                   	push   %rbp
+  806043:	48 89 e5             	mov    %rsp,%rbp
+  806046:	48 83 ec 08          	sub    $0x8,%rsp
+  80604a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80604e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806052:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806058:	90                   	nop
+  806059:	c9                   	leave
+  80605a:	c3                   	ret
+
+000000000080605b <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  80605b:	55                   	push   %rbp
+  80605c:	48 89 e5             	mov    %rsp,%rbp
+  80605f:	48 83 ec 20          	sub    $0x20,%rsp
+  806063:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806067:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80606b:	ba 01 00 00 00       	mov    $0x1,%edx
+  806070:	be 00 00 00 00       	mov    $0x0,%esi
+  806075:	48 89 c7             	mov    %rax,%rdi
+  806078:	48 b8 f0 5f 80 00 00 	movabs $0x805ff0,%rax
+  80607f:	00 00 00 
+  806082:	ff d0                	call   *%rax
+  806084:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806087:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80608b:	74 65                	je     8060f2 <mutex_lock+0x97>
+  if (c != 2)
+  80608d:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806091:	74 57                	je     8060ea <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806097:	be 02 00 00 00       	mov    $0x2,%esi
+  80609c:	48 89 c7             	mov    %rax,%rdi
+  80609f:	48 b8 cb 5f 80 00 00 	movabs $0x805fcb,%rax
+  8060a6:	00 00 00 
+  8060a9:	ff d0                	call   *%rax
+  8060ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8060ae:	eb 3a                	jmp    8060ea <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8060b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060b4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8060bb:	be 02 00 00 00       	mov    $0x2,%esi
+  8060c0:	48 89 c7             	mov    %rax,%rdi
+  8060c3:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  8060ca:	00 00 00 
+  8060cd:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8060cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060d3:	be 02 00 00 00       	mov    $0x2,%esi
+  8060d8:	48 89 c7             	mov    %rax,%rdi
+  8060db:	48 b8 cb 5f 80 00 00 	movabs $0x805fcb,%rax
+  8060e2:	00 00 00 
+  8060e5:	ff d0                	call   *%rax
+  8060e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8060ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8060ee:	75 c0                	jne    8060b0 <mutex_lock+0x55>
+  8060f0:	eb 01                	jmp    8060f3 <mutex_lock+0x98>
+    return;
+  8060f2:	90                   	nop
+}
+  8060f3:	c9                   	leave
+  8060f4:	c3                   	ret
+
+00000000008060f5 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8060f5:	55                   	push   %rbp
+  8060f6:	48 89 e5             	mov    %rsp,%rbp
+  8060f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8060fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806101:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806105:	ba 01 00 00 00       	mov    $0x1,%edx
+  80610a:	be 00 00 00 00       	mov    $0x0,%esi
+  80610f:	48 89 c7             	mov    %rax,%rdi
+  806112:	48 b8 f0 5f 80 00 00 	movabs $0x805ff0,%rax
+  806119:	00 00 00 
+  80611c:	ff d0                	call   *%rax
+  80611e:	85 c0                	test   %eax,%eax
+  806120:	75 07                	jne    806129 <mutex_trylock+0x34>
+  806122:	b8 00 00 00 00       	mov    $0x0,%eax
+  806127:	eb 05                	jmp    80612e <mutex_trylock+0x39>
+  806129:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80612e:	c9                   	leave
+  80612f:	c3                   	ret
+
+0000000000806130 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806130:	55                   	push   %rbp
+  806131:	48 89 e5             	mov    %rsp,%rbp
+  806134:	48 83 ec 10          	sub    $0x10,%rsp
+  806138:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80613c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806140:	be 00 00 00 00       	mov    $0x0,%esi
+  806145:	48 89 c7             	mov    %rax,%rdi
+  806148:	48 b8 cb 5f 80 00 00 	movabs $0x805fcb,%rax
+  80614f:	00 00 00 
+  806152:	ff d0                	call   *%rax
+  806154:	83 f8 02             	cmp    $0x2,%eax
+  806157:	75 18                	jne    806171 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80615d:	be 01 00 00 00       	mov    $0x1,%esi
+  806162:	48 89 c7             	mov    %rax,%rdi
+  806165:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  80616c:	00 00 00 
+  80616f:	ff d0                	call   *%rax
+}
+  806171:	90                   	nop
+  806172:	c9                   	leave
+  806173:	c3                   	ret
+
+0000000000806174 <cond_init>:
+cond_init(struct Cond *c) {
+  806174:	55                   	push   %rbp
+  806175:	48 89 e5             	mov    %rsp,%rbp
+  806178:	48 83 ec 08          	sub    $0x8,%rsp
+  80617c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806180:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806184:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80618a:	90                   	nop
+  80618b:	c9                   	leave
+  80618c:	c3                   	ret
+
+000000000080618d <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80618d:	55                   	push   %rbp
+  80618e:	48 89 e5             	mov    %rsp,%rbp
+  806191:	48 83 ec 30          	sub    $0x30,%rsp
+  806195:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806199:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80619d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8061a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061a5:	8b 00                	mov    (%rax),%eax
+  8061a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8061aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061ae:	48 89 c7             	mov    %rax,%rdi
+  8061b1:	48 b8 30 61 80 00 00 	movabs $0x806130,%rax
+  8061b8:	00 00 00 
+  8061bb:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8061bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8061c5:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8061c8:	89 ce                	mov    %ecx,%esi
+  8061ca:	48 89 c7             	mov    %rax,%rdi
+  8061cd:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  8061d4:	00 00 00 
+  8061d7:	ff d0                	call   *%rax
+  8061d9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8061dc:	eb 1f                	jmp    8061fd <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8061de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061e2:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8061e9:	be 02 00 00 00       	mov    $0x2,%esi
+  8061ee:	48 89 c7             	mov    %rax,%rdi
+  8061f1:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  8061f8:	00 00 00 
+  8061fb:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8061fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806201:	be 02 00 00 00       	mov    $0x2,%esi
+  806206:	48 89 c7             	mov    %rax,%rdi
+  806209:	48 b8 cb 5f 80 00 00 	movabs $0x805fcb,%rax
+  806210:	00 00 00 
+  806213:	ff d0                	call   *%rax
+  806215:	85 c0                	test   %eax,%eax
+  806217:	75 c5                	jne    8061de <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806219:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80621d:	75 07                	jne    806226 <cond_timedwait+0x99>
+  80621f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806224:	eb 05                	jmp    80622b <cond_timedwait+0x9e>
+  806226:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80622b:	c9                   	leave
+  80622c:	c3                   	ret
+
+000000000080622d <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80622d:	55                   	push   %rbp
+  80622e:	48 89 e5             	mov    %rsp,%rbp
+  806231:	48 83 ec 10          	sub    $0x10,%rsp
+  806235:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806239:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80623d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806241:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806245:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80624c:	48 89 ce             	mov    %rcx,%rsi
+  80624f:	48 89 c7             	mov    %rax,%rdi
+  806252:	48 b8 8d 61 80 00 00 	movabs $0x80618d,%rax
+  806259:	00 00 00 
+  80625c:	ff d0                	call   *%rax
+}
+  80625e:	90                   	nop
+  80625f:	c9                   	leave
+  806260:	c3                   	ret
+
+0000000000806261 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806261:	55                   	push   %rbp
+  806262:	48 89 e5             	mov    %rsp,%rbp
+  806265:	48 83 ec 10          	sub    $0x10,%rsp
+  806269:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80626d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806271:	be 01 00 00 00       	mov    $0x1,%esi
+  806276:	48 89 c7             	mov    %rax,%rdi
+  806279:	48 b8 1c 60 80 00 00 	movabs $0x80601c,%rax
+  806280:	00 00 00 
+  806283:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806285:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806289:	be 01 00 00 00       	mov    $0x1,%esi
+  80628e:	48 89 c7             	mov    %rax,%rdi
+  806291:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  806298:	00 00 00 
+  80629b:	ff d0                	call   *%rax
+}
+  80629d:	90                   	nop
+  80629e:	c9                   	leave
+  80629f:	c3                   	ret
+
+00000000008062a0 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8062a0:	55                   	push   %rbp
+  8062a1:	48 89 e5             	mov    %rsp,%rbp
+  8062a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8062a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8062ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8062b5:	48 89 c7             	mov    %rax,%rdi
+  8062b8:	48 b8 1c 60 80 00 00 	movabs $0x80601c,%rax
+  8062bf:	00 00 00 
+  8062c2:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8062c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062c8:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8062cd:	48 89 c7             	mov    %rax,%rdi
+  8062d0:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8062d7:	00 00 00 
+  8062da:	ff d0                	call   *%rax
+}
+  8062dc:	90                   	nop
+  8062dd:	c9                   	leave
+  8062de:	c3                   	ret
+
+00000000008062df <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8062df:	55                   	push   %rbp
+  8062e0:	48 89 e5             	mov    %rsp,%rbp
+  8062e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8062e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8062eb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8062ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062f2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062f5:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8062f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062fb:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806302:	90                   	nop
+  806303:	c9                   	leave
+  806304:	c3                   	ret
+
+0000000000806305 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806305:	55                   	push   %rbp
+  806306:	48 89 e5             	mov    %rsp,%rbp
+  806309:	48 83 ec 18          	sub    $0x18,%rsp
+  80630d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806311:	eb 2a                	jmp    80633d <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806313:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806316:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80631d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806320:	89 ce                	mov    %ecx,%esi
+  806322:	48 89 c7             	mov    %rax,%rdi
+  806325:	48 b8 f0 5f 80 00 00 	movabs $0x805ff0,%rax
+  80632c:	00 00 00 
+  80632f:	ff d0                	call   *%rax
+  806331:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806334:	75 07                	jne    80633d <sem_trywait+0x38>
+      return 0;
+  806336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80633b:	eb 14                	jmp    806351 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80633d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806341:	8b 00                	mov    (%rax),%eax
+  806343:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806346:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80634a:	75 c7                	jne    806313 <sem_trywait+0xe>
+  return -E_BUSY;
+  80634c:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806351:	c9                   	leave
+  806352:	c3                   	ret
+
+0000000000806353 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806353:	55                   	push   %rbp
+  806354:	48 89 e5             	mov    %rsp,%rbp
+  806357:	48 83 ec 30          	sub    $0x30,%rsp
+  80635b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80635f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806363:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80636a:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80636b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806370:	0f 84 fb 00 00 00    	je     806471 <sem_timedwait+0x11e>
+  806376:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80637b:	0f 84 f0 00 00 00    	je     806471 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806381:	48 b8 c7 57 80 00 00 	movabs $0x8057c7,%rax
+  806388:	00 00 00 
+  80638b:	ff d0                	call   *%rax
+  80638d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806395:	48 f7 d0             	not    %rax
+  806398:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80639c:	73 0d                	jae    8063ab <sem_timedwait+0x58>
+  80639e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8063a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063a6:	48 01 d0             	add    %rdx,%rax
+  8063a9:	eb 07                	jmp    8063b2 <sem_timedwait+0x5f>
+  8063ab:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8063b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8063b6:	e9 b6 00 00 00       	jmp    806471 <sem_timedwait+0x11e>
+    if (deadline) {
+  8063bb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8063c0:	74 2d                	je     8063ef <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8063c2:	48 b8 c7 57 80 00 00 	movabs $0x8057c7,%rax
+  8063c9:	00 00 00 
+  8063cc:	ff d0                	call   *%rax
+  8063ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8063d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8063d6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8063da:	73 0a                	jae    8063e6 <sem_timedwait+0x93>
+  8063dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e0:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8063e4:	eb 05                	jmp    8063eb <sem_timedwait+0x98>
+  8063e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063eb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8063ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063f3:	48 83 c0 04          	add    $0x4,%rax
+  8063f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8063fc:	48 89 c7             	mov    %rax,%rdi
+  8063ff:	48 b8 1c 60 80 00 00 	movabs $0x80601c,%rax
+  806406:	00 00 00 
+  806409:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  80640b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80640f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806413:	be 00 00 00 00       	mov    $0x0,%esi
+  806418:	48 89 c7             	mov    %rax,%rdi
+  80641b:	48 b8 1a 25 80 00 00 	movabs $0x80251a,%rax
+  806422:	00 00 00 
+  806425:	ff d0                	call   *%rax
+  806427:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80642a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80642e:	48 83 c0 04          	add    $0x4,%rax
+  806432:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806437:	48 89 c7             	mov    %rax,%rdi
+  80643a:	48 b8 1c 60 80 00 00 	movabs $0x80601c,%rax
+  806441:	00 00 00 
+  806444:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806446:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80644a:	75 25                	jne    806471 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80644c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806450:	48 89 c7             	mov    %rax,%rdi
+  806453:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  80645a:	00 00 00 
+  80645d:	ff d0                	call   *%rax
+  80645f:	85 c0                	test   %eax,%eax
+  806461:	79 07                	jns    80646a <sem_timedwait+0x117>
+  806463:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806468:	eb 27                	jmp    806491 <sem_timedwait+0x13e>
+  80646a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80646f:	eb 20                	jmp    806491 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806471:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806475:	48 89 c7             	mov    %rax,%rdi
+  806478:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  80647f:	00 00 00 
+  806482:	ff d0                	call   *%rax
+  806484:	85 c0                	test   %eax,%eax
+  806486:	0f 88 2f ff ff ff    	js     8063bb <sem_timedwait+0x68>
+  return 0;
+  80648c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806491:	c9                   	leave
+  806492:	c3                   	ret
+
+0000000000806493 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806493:	55                   	push   %rbp
+  806494:	48 89 e5             	mov    %rsp,%rbp
+  806497:	48 83 ec 10          	sub    $0x10,%rsp
+  80649b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  80649f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064a3:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8064aa:	48 89 c7             	mov    %rax,%rdi
+  8064ad:	48 b8 53 63 80 00 00 	movabs $0x806353,%rax
+  8064b4:	00 00 00 
+  8064b7:	ff d0                	call   *%rax
+}
+  8064b9:	90                   	nop
+  8064ba:	c9                   	leave
+  8064bb:	c3                   	ret
+
+00000000008064bc <sem_post>:
+sem_post(struct Semaphore *s) {
+  8064bc:	55                   	push   %rbp
+  8064bd:	48 89 e5             	mov    %rsp,%rbp
+  8064c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8064c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8064c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8064d1:	48 89 c7             	mov    %rax,%rdi
+  8064d4:	48 b8 1c 60 80 00 00 	movabs $0x80601c,%rax
+  8064db:	00 00 00 
+  8064de:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8064e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064e4:	8b 40 04             	mov    0x4(%rax),%eax
+  8064e7:	85 c0                	test   %eax,%eax
+  8064e9:	74 18                	je     806503 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8064eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8064f4:	48 89 c7             	mov    %rax,%rdi
+  8064f7:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8064fe:	00 00 00 
+  806501:	ff d0                	call   *%rax
+}
+  806503:	90                   	nop
+  806504:	c9                   	leave
+  806505:	c3                   	ret
+  806506:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,10140 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 8c 01 00 00       	call   8001b8 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <primeproc>:
+// of main and user/idle.
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, id, p;
+  envid_t envid;
+
+  // fetch a prime from our left neighbor
+top:
+  p = ipc_recv(&envid, 0, 0);
+  80003a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80003e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800043:	be 00 00 00 00       	mov    $0x0,%esi
+  800048:	48 89 c7             	mov    %rax,%rdi
+  80004b:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  800052:	00 00 00 
+  800055:	ff d0                	call   *%rax
+  800057:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  cprintf("%d ", p);
+  80005a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80005d:	89 c6                	mov    %eax,%esi
+  80005f:	48 b8 80 64 80 00 00 	movabs $0x806480,%rax
+  800066:	00 00 00 
+  800069:	48 89 c7             	mov    %rax,%rdi
+  80006c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800071:	48 ba 7e 04 80 00 00 	movabs $0x80047e,%rdx
+  800078:	00 00 00 
+  80007b:	ff d2                	call   *%rdx
+
+  // fork a right neighbor to continue the chain
+  if ((id = fork()) < 0)
+  80007d:	48 b8 95 30 80 00 00 	movabs $0x803095,%rax
+  800084:	00 00 00 
+  800087:	ff d0                	call   *%rax
+  800089:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80008c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800090:	79 36                	jns    8000c8 <primeproc+0x96>
+    panic("fork: %i", id);
+  800092:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800095:	89 c1                	mov    %eax,%ecx
+  800097:	48 b8 84 64 80 00 00 	movabs $0x806484,%rax
+  80009e:	00 00 00 
+  8000a1:	48 89 c2             	mov    %rax,%rdx
+  8000a4:	be 19 00 00 00       	mov    $0x19,%esi
+  8000a9:	48 b8 8d 64 80 00 00 	movabs $0x80648d,%rax
+  8000b0:	00 00 00 
+  8000b3:	48 89 c7             	mov    %rax,%rdi
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  8000c2:	00 00 00 
+  8000c5:	41 ff d0             	call   *%r8
+  if (id == 0)
+  8000c8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000cc:	75 05                	jne    8000d3 <primeproc+0xa1>
+    goto top;
+  8000ce:	e9 67 ff ff ff       	jmp    80003a <primeproc+0x8>
+
+  // filter out multiples of our prime
+  while (1) {
+    i = ipc_recv(&envid, 0, 0);
+  8000d3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8000d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e1:	48 89 c7             	mov    %rax,%rdi
+  8000e4:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+  8000f0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (i % p)
+  8000f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000f6:	99                   	cltd
+  8000f7:	f7 7d fc             	idivl  -0x4(%rbp)
+  8000fa:	89 d0                	mov    %edx,%eax
+  8000fc:	85 c0                	test   %eax,%eax
+  8000fe:	74 d3                	je     8000d3 <primeproc+0xa1>
+      ipc_send(id, i, 0, 0);
+  800100:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  800103:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800106:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800110:	89 c7                	mov    %eax,%edi
+  800112:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  800119:	00 00 00 
+  80011c:	ff d0                	call   *%rax
+    i = ipc_recv(&envid, 0, 0);
+  80011e:	eb b3                	jmp    8000d3 <primeproc+0xa1>
+
+0000000000800120 <umain>:
+  }
+}
+
+void
+umain(int argc, char **argv) {
+  800120:	55                   	push   %rbp
+  800121:	48 89 e5             	mov    %rsp,%rbp
+  800124:	48 83 ec 20          	sub    $0x20,%rsp
+  800128:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80012b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, id;
+
+  // fork the first prime process in the chain
+  if ((id = fork()) < 0)
+  80012f:	48 b8 95 30 80 00 00 	movabs $0x803095,%rax
+  800136:	00 00 00 
+  800139:	ff d0                	call   *%rax
+  80013b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80013e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800142:	79 36                	jns    80017a <umain+0x5a>
+    panic("fork: %i", id);
+  800144:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800147:	89 c1                	mov    %eax,%ecx
+  800149:	48 b8 84 64 80 00 00 	movabs $0x806484,%rax
+  800150:	00 00 00 
+  800153:	48 89 c2             	mov    %rax,%rdx
+  800156:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80015b:	48 b8 8d 64 80 00 00 	movabs $0x80648d,%rax
+  800162:	00 00 00 
+  800165:	48 89 c7             	mov    %rax,%rdi
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  800174:	00 00 00 
+  800177:	41 ff d0             	call   *%r8
+  if (id == 0)
+  80017a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80017e:	75 0c                	jne    80018c <umain+0x6c>
+    primeproc();
+  800180:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+
+  // feed all the integers through
+  for (i = 2;; i++)
+  80018c:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+    ipc_send(id, i, 0, 0);
+  800193:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  800196:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80019e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a3:	89 c7                	mov    %eax,%edi
+  8001a5:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+  for (i = 2;; i++)
+  8001b1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    ipc_send(id, i, 0, 0);
+  8001b5:	90                   	nop
+  8001b6:	eb db                	jmp    800193 <umain+0x73>
+
+00000000008001b8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001b8:	55                   	push   %rbp
+  8001b9:	48 89 e5             	mov    %rsp,%rbp
+  8001bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8001c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8001c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8001c7:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8001ce:	00 00 00 
+  8001d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001d5:	eb 13                	jmp    8001ea <libmain+0x32>
+    (*ctor)();
+  8001d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001db:	48 8b 10             	mov    (%rax),%rdx
+  8001de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e3:	ff d2                	call   *%rdx
+    ctor++;
+  8001e5:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001ea:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8001f1:	00 00 00 
+  8001f4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8001f8:	72 dd                	jb     8001d7 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001fe:	7e 14                	jle    800214 <libmain+0x5c>
+    binaryname = argv[0];
+  800200:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800204:	48 8b 00             	mov    (%rax),%rax
+  800207:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80020e:	00 00 00 
+  800211:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800214:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800218:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80021b:	48 89 d6             	mov    %rdx,%rsi
+  80021e:	89 c7                	mov    %eax,%edi
+  800220:	48 b8 20 01 80 00 00 	movabs $0x800120,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80022c:	48 b8 3b 02 80 00 00 	movabs $0x80023b,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+#endif
+}
+  800238:	90                   	nop
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+000000000080023b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80023b:	55                   	push   %rbp
+  80023c:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80023f:	48 b8 4e 37 80 00 00 	movabs $0x80374e,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80024b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800250:	48 b8 b4 20 80 00 00 	movabs $0x8020b4,%rax
+  800257:	00 00 00 
+  80025a:	ff d0                	call   *%rax
+}
+  80025c:	90                   	nop
+  80025d:	5d                   	pop    %rbp
+  80025e:	c3                   	ret
+
+000000000080025f <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+  800263:	53                   	push   %rbx
+  800264:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80026b:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800272:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800278:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80027f:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800286:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80028d:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800294:	84 c0                	test   %al,%al
+  800296:	74 23                	je     8002bb <_panic+0x5c>
+  800298:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80029f:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8002a3:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8002a7:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8002ab:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8002af:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8002b3:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8002b7:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8002bb:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8002c2:	00 00 00 
+  8002c5:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8002cc:	00 00 00 
+  8002cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d3:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8002da:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8002e1:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002e8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8002ef:	00 00 00 
+  8002f2:	48 8b 18             	mov    (%rax),%rbx
+  8002f5:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+  800301:	89 c6                	mov    %eax,%esi
+  800303:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800309:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800310:	41 89 d0             	mov    %edx,%r8d
+  800313:	48 89 c1             	mov    %rax,%rcx
+  800316:	48 89 da             	mov    %rbx,%rdx
+  800319:	48 b8 a8 64 80 00 00 	movabs $0x8064a8,%rax
+  800320:	00 00 00 
+  800323:	48 89 c7             	mov    %rax,%rdi
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	49 b9 7e 04 80 00 00 	movabs $0x80047e,%r9
+  800332:	00 00 00 
+  800335:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800338:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80033f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800346:	48 89 d6             	mov    %rdx,%rsi
+  800349:	48 89 c7             	mov    %rax,%rdi
+  80034c:	48 b8 f3 03 80 00 00 	movabs $0x8003f3,%rax
+  800353:	00 00 00 
+  800356:	ff d0                	call   *%rax
+  cprintf("\n");
+  800358:	48 b8 cb 64 80 00 00 	movabs $0x8064cb,%rax
+  80035f:	00 00 00 
+  800362:	48 89 c7             	mov    %rax,%rdi
+  800365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036a:	48 ba 7e 04 80 00 00 	movabs $0x80047e,%rdx
+  800371:	00 00 00 
+  800374:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800376:	cc                   	int3
+  800377:	eb fd                	jmp    800376 <_panic+0x117>
+
+0000000000800379 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	48 83 ec 10          	sub    $0x10,%rsp
+  800381:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800384:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800388:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80038c:	8b 00                	mov    (%rax),%eax
+  80038e:	8d 48 01             	lea    0x1(%rax),%ecx
+  800391:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800395:	89 0a                	mov    %ecx,(%rdx)
+  800397:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80039a:	89 d1                	mov    %edx,%ecx
+  80039c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003a0:	48 98                	cltq
+  8003a2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8003a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003aa:	8b 00                	mov    (%rax),%eax
+  8003ac:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003b1:	75 2c                	jne    8003df <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8003b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003b7:	8b 00                	mov    (%rax),%eax
+  8003b9:	48 98                	cltq
+  8003bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003bf:	48 83 c2 08          	add    $0x8,%rdx
+  8003c3:	48 89 c6             	mov    %rax,%rsi
+  8003c6:	48 89 d7             	mov    %rdx,%rdi
+  8003c9:	48 b8 e5 1f 80 00 00 	movabs $0x801fe5,%rax
+  8003d0:	00 00 00 
+  8003d3:	ff d0                	call   *%rax
+    b->idx = 0;
+  8003d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8003df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003e3:	8b 40 04             	mov    0x4(%rax),%eax
+  8003e6:	8d 50 01             	lea    0x1(%rax),%edx
+  8003e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003ed:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003f0:	90                   	nop
+  8003f1:	c9                   	leave
+  8003f2:	c3                   	ret
+
+00000000008003f3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003f3:	55                   	push   %rbp
+  8003f4:	48 89 e5             	mov    %rsp,%rbp
+  8003f7:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8003fe:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800405:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80040c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800413:	00 00 00 
+  b.cnt = 0;
+  800416:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80041d:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800420:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800427:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80042e:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800435:	48 89 c6             	mov    %rax,%rsi
+  800438:	48 b8 79 03 80 00 00 	movabs $0x800379,%rax
+  80043f:	00 00 00 
+  800442:	48 89 c7             	mov    %rax,%rdi
+  800445:	48 b8 d8 07 80 00 00 	movabs $0x8007d8,%rax
+  80044c:	00 00 00 
+  80044f:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800451:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800457:	48 98                	cltq
+  800459:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800460:	48 83 c2 08          	add    $0x8,%rdx
+  800464:	48 89 c6             	mov    %rax,%rsi
+  800467:	48 89 d7             	mov    %rdx,%rdi
+  80046a:	48 b8 e5 1f 80 00 00 	movabs $0x801fe5,%rax
+  800471:	00 00 00 
+  800474:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800476:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80047c:	c9                   	leave
+  80047d:	c3                   	ret
+
+000000000080047e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80047e:	55                   	push   %rbp
+  80047f:	48 89 e5             	mov    %rsp,%rbp
+  800482:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800489:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800490:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800497:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80049e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004a5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004ac:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004b3:	84 c0                	test   %al,%al
+  8004b5:	74 20                	je     8004d7 <cprintf+0x59>
+  8004b7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004bb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004bf:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004c3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004c7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004cb:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004cf:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004d3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004d7:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004de:	00 00 00 
+  8004e1:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004e8:	00 00 00 
+  8004eb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ef:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8004f6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004fd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800504:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80050b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800512:	48 89 d6             	mov    %rdx,%rsi
+  800515:	48 89 c7             	mov    %rax,%rdi
+  800518:	48 b8 f3 03 80 00 00 	movabs $0x8003f3,%rax
+  80051f:	00 00 00 
+  800522:	ff d0                	call   *%rax
+  800524:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80052a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800530:	c9                   	leave
+  800531:	c3                   	ret
+
+0000000000800532 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800532:	55                   	push   %rbp
+  800533:	48 89 e5             	mov    %rsp,%rbp
+  800536:	48 83 ec 30          	sub    $0x30,%rsp
+  80053a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80053e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800542:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800546:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800549:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80054d:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800551:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800554:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800558:	72 54                	jb     8005ae <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80055a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80055d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800560:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800563:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056c:	48 f7 f6             	div    %rsi
+  80056f:	49 89 c2             	mov    %rax,%r10
+  800572:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800575:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800578:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80057c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800580:	41 89 c9             	mov    %ecx,%r9d
+  800583:	41 89 f8             	mov    %edi,%r8d
+  800586:	89 d1                	mov    %edx,%ecx
+  800588:	4c 89 d2             	mov    %r10,%rdx
+  80058b:	48 89 c7             	mov    %rax,%rdi
+  80058e:	48 b8 32 05 80 00 00 	movabs $0x800532,%rax
+  800595:	00 00 00 
+  800598:	ff d0                	call   *%rax
+  80059a:	eb 1c                	jmp    8005b8 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80059c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8005a3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005a7:	48 89 d6             	mov    %rdx,%rsi
+  8005aa:	89 c7                	mov    %eax,%edi
+  8005ac:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8005ae:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8005b2:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8005b6:	7f e4                	jg     80059c <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8005b8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8005bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c4:	48 f7 f1             	div    %rcx
+  8005c7:	48 b8 10 67 80 00 00 	movabs $0x806710,%rax
+  8005ce:	00 00 00 
+  8005d1:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8005d5:	0f be c0             	movsbl %al,%eax
+  8005d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005dc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005e0:	48 89 d6             	mov    %rdx,%rsi
+  8005e3:	89 c7                	mov    %eax,%edi
+  8005e5:	ff d1                	call   *%rcx
+}
+  8005e7:	90                   	nop
+  8005e8:	c9                   	leave
+  8005e9:	c3                   	ret
+
+00000000008005ea <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8005ea:	55                   	push   %rbp
+  8005eb:	48 89 e5             	mov    %rsp,%rbp
+  8005ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8005f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005f6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8005f9:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8005fd:	7e 4b                	jle    80064a <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8005ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800603:	8b 00                	mov    (%rax),%eax
+  800605:	83 f8 2f             	cmp    $0x2f,%eax
+  800608:	77 24                	ja     80062e <getuint+0x44>
+  80060a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800616:	8b 00                	mov    (%rax),%eax
+  800618:	89 c0                	mov    %eax,%eax
+  80061a:	48 01 d0             	add    %rdx,%rax
+  80061d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800621:	8b 12                	mov    (%rdx),%edx
+  800623:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800626:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80062a:	89 0a                	mov    %ecx,(%rdx)
+  80062c:	eb 14                	jmp    800642 <getuint+0x58>
+  80062e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800632:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800636:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80063a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80063e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800642:	48 8b 00             	mov    (%rax),%rax
+  800645:	e9 95 00 00 00       	jmp    8006df <getuint+0xf5>
+  else if (lflag)
+  80064a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80064e:	74 48                	je     800698 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800654:	8b 00                	mov    (%rax),%eax
+  800656:	83 f8 2f             	cmp    $0x2f,%eax
+  800659:	77 24                	ja     80067f <getuint+0x95>
+  80065b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80065f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800663:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800667:	8b 00                	mov    (%rax),%eax
+  800669:	89 c0                	mov    %eax,%eax
+  80066b:	48 01 d0             	add    %rdx,%rax
+  80066e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800672:	8b 12                	mov    (%rdx),%edx
+  800674:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800677:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80067b:	89 0a                	mov    %ecx,(%rdx)
+  80067d:	eb 14                	jmp    800693 <getuint+0xa9>
+  80067f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800683:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800687:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80068b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800693:	48 8b 00             	mov    (%rax),%rax
+  800696:	eb 47                	jmp    8006df <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800698:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80069c:	8b 00                	mov    (%rax),%eax
+  80069e:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a1:	77 24                	ja     8006c7 <getuint+0xdd>
+  8006a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006af:	8b 00                	mov    (%rax),%eax
+  8006b1:	89 c0                	mov    %eax,%eax
+  8006b3:	48 01 d0             	add    %rdx,%rax
+  8006b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ba:	8b 12                	mov    (%rdx),%edx
+  8006bc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006c3:	89 0a                	mov    %ecx,(%rdx)
+  8006c5:	eb 14                	jmp    8006db <getuint+0xf1>
+  8006c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006cf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006d7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006db:	8b 00                	mov    (%rax),%eax
+  8006dd:	89 c0                	mov    %eax,%eax
+}
+  8006df:	c9                   	leave
+  8006e0:	c3                   	ret
+
+00000000008006e1 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8006e1:	55                   	push   %rbp
+  8006e2:	48 89 e5             	mov    %rsp,%rbp
+  8006e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8006e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006ed:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8006f0:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8006f4:	7e 4b                	jle    800741 <getint+0x60>
+    return va_arg(*ap, long long);
+  8006f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fa:	8b 00                	mov    (%rax),%eax
+  8006fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ff:	77 24                	ja     800725 <getint+0x44>
+  800701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800705:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800709:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80070d:	8b 00                	mov    (%rax),%eax
+  80070f:	89 c0                	mov    %eax,%eax
+  800711:	48 01 d0             	add    %rdx,%rax
+  800714:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800718:	8b 12                	mov    (%rdx),%edx
+  80071a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80071d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800721:	89 0a                	mov    %ecx,(%rdx)
+  800723:	eb 14                	jmp    800739 <getint+0x58>
+  800725:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800729:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80072d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800731:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800735:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800739:	48 8b 00             	mov    (%rax),%rax
+  80073c:	e9 95 00 00 00       	jmp    8007d6 <getint+0xf5>
+  else if (lflag)
+  800741:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800745:	74 48                	je     80078f <getint+0xae>
+    return va_arg(*ap, long);
+  800747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074b:	8b 00                	mov    (%rax),%eax
+  80074d:	83 f8 2f             	cmp    $0x2f,%eax
+  800750:	77 24                	ja     800776 <getint+0x95>
+  800752:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800756:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80075a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80075e:	8b 00                	mov    (%rax),%eax
+  800760:	89 c0                	mov    %eax,%eax
+  800762:	48 01 d0             	add    %rdx,%rax
+  800765:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800769:	8b 12                	mov    (%rdx),%edx
+  80076b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80076e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800772:	89 0a                	mov    %ecx,(%rdx)
+  800774:	eb 14                	jmp    80078a <getint+0xa9>
+  800776:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80077a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80077e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800782:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800786:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80078a:	48 8b 00             	mov    (%rax),%rax
+  80078d:	eb 47                	jmp    8007d6 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80078f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800793:	8b 00                	mov    (%rax),%eax
+  800795:	83 f8 2f             	cmp    $0x2f,%eax
+  800798:	77 24                	ja     8007be <getint+0xdd>
+  80079a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80079e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a6:	8b 00                	mov    (%rax),%eax
+  8007a8:	89 c0                	mov    %eax,%eax
+  8007aa:	48 01 d0             	add    %rdx,%rax
+  8007ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007b1:	8b 12                	mov    (%rdx),%edx
+  8007b3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ba:	89 0a                	mov    %ecx,(%rdx)
+  8007bc:	eb 14                	jmp    8007d2 <getint+0xf1>
+  8007be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007d2:	8b 00                	mov    (%rax),%eax
+  8007d4:	48 98                	cltq
+}
+  8007d6:	c9                   	leave
+  8007d7:	c3                   	ret
+
+00000000008007d8 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8007d8:	55                   	push   %rbp
+  8007d9:	48 89 e5             	mov    %rsp,%rbp
+  8007dc:	41 54                	push   %r12
+  8007de:	53                   	push   %rbx
+  8007df:	48 83 ec 60          	sub    $0x60,%rsp
+  8007e3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8007e7:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8007eb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007ef:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8007f3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007f7:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8007fb:	48 8b 06             	mov    (%rsi),%rax
+  8007fe:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800802:	48 89 01             	mov    %rax,(%rcx)
+  800805:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800809:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80080d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800811:	eb 17                	jmp    80082a <vprintfmt+0x52>
+      if (ch == '\0')
+  800813:	85 db                	test   %ebx,%ebx
+  800815:	0f 84 bf 04 00 00    	je     800cda <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80081b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80081f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800823:	48 89 c6             	mov    %rax,%rsi
+  800826:	89 df                	mov    %ebx,%edi
+  800828:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80082a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80082e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800832:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800836:	0f b6 00             	movzbl (%rax),%eax
+  800839:	0f b6 d8             	movzbl %al,%ebx
+  80083c:	83 fb 25             	cmp    $0x25,%ebx
+  80083f:	75 d2                	jne    800813 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800841:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800845:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80084c:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800853:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80085a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800861:	eb 04                	jmp    800867 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800863:	90                   	nop
+  800864:	eb 01                	jmp    800867 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800866:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800867:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80086b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80086f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800873:	0f b6 00             	movzbl (%rax),%eax
+  800876:	0f b6 d8             	movzbl %al,%ebx
+  800879:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80087c:	83 f8 55             	cmp    $0x55,%eax
+  80087f:	0f 87 22 04 00 00    	ja     800ca7 <vprintfmt+0x4cf>
+  800885:	89 c0                	mov    %eax,%eax
+  800887:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80088e:	00 
+  80088f:	48 b8 38 67 80 00 00 	movabs $0x806738,%rax
+  800896:	00 00 00 
+  800899:	48 01 d0             	add    %rdx,%rax
+  80089c:	48 8b 00             	mov    (%rax),%rax
+  80089f:	ff e0                	jmp    *%rax
+        padc = '-';
+  8008a1:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8008a5:	eb c0                	jmp    800867 <vprintfmt+0x8f>
+        padc = '0';
+  8008a7:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8008ab:	eb ba                	jmp    800867 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8008ad:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8008b4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8008b7:	89 d0                	mov    %edx,%eax
+  8008b9:	c1 e0 02             	shl    $0x2,%eax
+  8008bc:	01 d0                	add    %edx,%eax
+  8008be:	01 c0                	add    %eax,%eax
+  8008c0:	01 d8                	add    %ebx,%eax
+  8008c2:	83 e8 30             	sub    $0x30,%eax
+  8008c5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8008c8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008cc:	0f b6 00             	movzbl (%rax),%eax
+  8008cf:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8008d2:	83 fb 2f             	cmp    $0x2f,%ebx
+  8008d5:	7e 60                	jle    800937 <vprintfmt+0x15f>
+  8008d7:	83 fb 39             	cmp    $0x39,%ebx
+  8008da:	7f 5b                	jg     800937 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8008dc:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8008e1:	eb d1                	jmp    8008b4 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8008e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e9:	77 17                	ja     800902 <vprintfmt+0x12a>
+  8008eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008ef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f2:	89 d2                	mov    %edx,%edx
+  8008f4:	48 01 d0             	add    %rdx,%rax
+  8008f7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008fa:	83 c2 08             	add    $0x8,%edx
+  8008fd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800900:	eb 0c                	jmp    80090e <vprintfmt+0x136>
+  800902:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800906:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80090a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80090e:	8b 00                	mov    (%rax),%eax
+  800910:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800913:	eb 23                	jmp    800938 <vprintfmt+0x160>
+        if (width < 0)
+  800915:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800919:	0f 89 44 ff ff ff    	jns    800863 <vprintfmt+0x8b>
+          width = 0;
+  80091f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800926:	e9 38 ff ff ff       	jmp    800863 <vprintfmt+0x8b>
+        altflag = 1;
+  80092b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800932:	e9 30 ff ff ff       	jmp    800867 <vprintfmt+0x8f>
+        goto process_precision;
+  800937:	90                   	nop
+        if (width < 0)
+  800938:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80093c:	0f 89 24 ff ff ff    	jns    800866 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800942:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800945:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800948:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80094f:	e9 12 ff ff ff       	jmp    800866 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800954:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800958:	e9 0a ff ff ff       	jmp    800867 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80095d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800960:	83 f8 2f             	cmp    $0x2f,%eax
+  800963:	77 17                	ja     80097c <vprintfmt+0x1a4>
+  800965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800969:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80096c:	89 d2                	mov    %edx,%edx
+  80096e:	48 01 d0             	add    %rdx,%rax
+  800971:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800974:	83 c2 08             	add    $0x8,%edx
+  800977:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80097a:	eb 0c                	jmp    800988 <vprintfmt+0x1b0>
+  80097c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800980:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800984:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800988:	8b 00                	mov    (%rax),%eax
+  80098a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80098e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800992:	48 89 d6             	mov    %rdx,%rsi
+  800995:	89 c7                	mov    %eax,%edi
+  800997:	ff d1                	call   *%rcx
+        break;
+  800999:	e9 37 03 00 00       	jmp    800cd5 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80099e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 17                	ja     8009bd <vprintfmt+0x1e5>
+  8009a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009aa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ad:	89 d2                	mov    %edx,%edx
+  8009af:	48 01 d0             	add    %rdx,%rax
+  8009b2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009b5:	83 c2 08             	add    $0x8,%edx
+  8009b8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009bb:	eb 0c                	jmp    8009c9 <vprintfmt+0x1f1>
+  8009bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009c1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009c5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009c9:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8009cb:	85 db                	test   %ebx,%ebx
+  8009cd:	79 02                	jns    8009d1 <vprintfmt+0x1f9>
+          err = -err;
+  8009cf:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009d1:	83 fb 15             	cmp    $0x15,%ebx
+  8009d4:	7f 16                	jg     8009ec <vprintfmt+0x214>
+  8009d6:	48 ba 60 66 80 00 00 	movabs $0x806660,%rdx
+  8009dd:	00 00 00 
+  8009e0:	48 63 c3             	movslq %ebx,%rax
+  8009e3:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8009e7:	4d 85 e4             	test   %r12,%r12
+  8009ea:	75 2e                	jne    800a1a <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8009ec:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009f0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009f4:	89 d9                	mov    %ebx,%ecx
+  8009f6:	48 ba 21 67 80 00 00 	movabs $0x806721,%rdx
+  8009fd:	00 00 00 
+  800a00:	48 89 c7             	mov    %rax,%rdi
+  800a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a08:	49 b8 e4 0c 80 00 00 	movabs $0x800ce4,%r8
+  800a0f:	00 00 00 
+  800a12:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800a15:	e9 bb 02 00 00       	jmp    800cd5 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800a1a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a22:	4c 89 e1             	mov    %r12,%rcx
+  800a25:	48 ba 2a 67 80 00 00 	movabs $0x80672a,%rdx
+  800a2c:	00 00 00 
+  800a2f:	48 89 c7             	mov    %rax,%rdi
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a37:	49 b8 e4 0c 80 00 00 	movabs $0x800ce4,%r8
+  800a3e:	00 00 00 
+  800a41:	41 ff d0             	call   *%r8
+        break;
+  800a44:	e9 8c 02 00 00       	jmp    800cd5 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800a49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4f:	77 17                	ja     800a68 <vprintfmt+0x290>
+  800a51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a55:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a58:	89 d2                	mov    %edx,%edx
+  800a5a:	48 01 d0             	add    %rdx,%rax
+  800a5d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a60:	83 c2 08             	add    $0x8,%edx
+  800a63:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a66:	eb 0c                	jmp    800a74 <vprintfmt+0x29c>
+  800a68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a6c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a70:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a74:	4c 8b 20             	mov    (%rax),%r12
+  800a77:	4d 85 e4             	test   %r12,%r12
+  800a7a:	75 0a                	jne    800a86 <vprintfmt+0x2ae>
+          p = "(null)";
+  800a7c:	49 bc 2d 67 80 00 00 	movabs $0x80672d,%r12
+  800a83:	00 00 00 
+        if (width > 0 && padc != '-')
+  800a86:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a8a:	7e 78                	jle    800b04 <vprintfmt+0x32c>
+  800a8c:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a90:	74 72                	je     800b04 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a92:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a95:	48 98                	cltq
+  800a97:	48 89 c6             	mov    %rax,%rsi
+  800a9a:	4c 89 e7             	mov    %r12,%rdi
+  800a9d:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+  800aa9:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800aac:	eb 17                	jmp    800ac5 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800aae:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800ab2:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800ab6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800aba:	48 89 d6             	mov    %rdx,%rsi
+  800abd:	89 c7                	mov    %eax,%edi
+  800abf:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ac1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ac5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ac9:	7f e3                	jg     800aae <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800acb:	eb 37                	jmp    800b04 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800acd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ad1:	74 1e                	je     800af1 <vprintfmt+0x319>
+  800ad3:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ad6:	7e 05                	jle    800add <vprintfmt+0x305>
+  800ad8:	83 fb 7e             	cmp    $0x7e,%ebx
+  800adb:	7e 14                	jle    800af1 <vprintfmt+0x319>
+            putch('?', putdat);
+  800add:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ae1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ae5:	48 89 c6             	mov    %rax,%rsi
+  800ae8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800aed:	ff d2                	call   *%rdx
+  800aef:	eb 0f                	jmp    800b00 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800af1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800af5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800af9:	48 89 c6             	mov    %rax,%rsi
+  800afc:	89 df                	mov    %ebx,%edi
+  800afe:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b00:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b04:	4c 89 e0             	mov    %r12,%rax
+  800b07:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b0b:	0f b6 00             	movzbl (%rax),%eax
+  800b0e:	0f be d8             	movsbl %al,%ebx
+  800b11:	85 db                	test   %ebx,%ebx
+  800b13:	74 28                	je     800b3d <vprintfmt+0x365>
+  800b15:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b19:	78 b2                	js     800acd <vprintfmt+0x2f5>
+  800b1b:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800b1f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b23:	79 a8                	jns    800acd <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800b25:	eb 16                	jmp    800b3d <vprintfmt+0x365>
+          putch(' ', putdat);
+  800b27:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b2f:	48 89 c6             	mov    %rax,%rsi
+  800b32:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b37:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800b39:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b3d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b41:	7f e4                	jg     800b27 <vprintfmt+0x34f>
+        break;
+  800b43:	e9 8d 01 00 00       	jmp    800cd5 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800b48:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b4b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b4f:	89 d6                	mov    %edx,%esi
+  800b51:	48 89 c7             	mov    %rax,%rdi
+  800b54:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+  800b60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800b64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b68:	48 85 c0             	test   %rax,%rax
+  800b6b:	79 1d                	jns    800b8a <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800b6d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b71:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b75:	48 89 c6             	mov    %rax,%rsi
+  800b78:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b7d:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b83:	48 f7 d8             	neg    %rax
+  800b86:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800b8a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b91:	e9 d2 00 00 00       	jmp    800c68 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b96:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b99:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b9d:	89 d6                	mov    %edx,%esi
+  800b9f:	48 89 c7             	mov    %rax,%rdi
+  800ba2:	48 b8 ea 05 80 00 00 	movabs $0x8005ea,%rax
+  800ba9:	00 00 00 
+  800bac:	ff d0                	call   *%rax
+  800bae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800bb2:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800bb9:	e9 aa 00 00 00       	jmp    800c68 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800bbe:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bc1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bc5:	89 d6                	mov    %edx,%esi
+  800bc7:	48 89 c7             	mov    %rax,%rdi
+  800bca:	48 b8 ea 05 80 00 00 	movabs $0x8005ea,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+  800bd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800bda:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800be1:	e9 82 00 00 00       	jmp    800c68 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800be6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bea:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bee:	48 89 c6             	mov    %rax,%rsi
+  800bf1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bf6:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800bf8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bfc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c00:	48 89 c6             	mov    %rax,%rsi
+  800c03:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c08:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c10:	77 17                	ja     800c29 <vprintfmt+0x451>
+  800c12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c16:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c19:	89 d2                	mov    %edx,%edx
+  800c1b:	48 01 d0             	add    %rdx,%rax
+  800c1e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c21:	83 c2 08             	add    $0x8,%edx
+  800c24:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c27:	eb 0c                	jmp    800c35 <vprintfmt+0x45d>
+  800c29:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c2d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c31:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c35:	48 8b 00             	mov    (%rax),%rax
+  800c38:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c3c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800c43:	eb 23                	jmp    800c68 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800c45:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c48:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c4c:	89 d6                	mov    %edx,%esi
+  800c4e:	48 89 c7             	mov    %rax,%rdi
+  800c51:	48 b8 ea 05 80 00 00 	movabs $0x8005ea,%rax
+  800c58:	00 00 00 
+  800c5b:	ff d0                	call   *%rax
+  800c5d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c61:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800c68:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c6d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c70:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c73:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c77:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c7b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c7f:	45 89 c1             	mov    %r8d,%r9d
+  800c82:	41 89 f8             	mov    %edi,%r8d
+  800c85:	48 89 c7             	mov    %rax,%rdi
+  800c88:	48 b8 32 05 80 00 00 	movabs $0x800532,%rax
+  800c8f:	00 00 00 
+  800c92:	ff d0                	call   *%rax
+        break;
+  800c94:	eb 3f                	jmp    800cd5 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c9a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c9e:	48 89 c6             	mov    %rax,%rsi
+  800ca1:	89 df                	mov    %ebx,%edi
+  800ca3:	ff d2                	call   *%rdx
+        break;
+  800ca5:	eb 2e                	jmp    800cd5 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800ca7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cab:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800caf:	48 89 c6             	mov    %rax,%rsi
+  800cb2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb7:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800cb9:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cbe:	eb 05                	jmp    800cc5 <vprintfmt+0x4ed>
+  800cc0:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cc5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cc9:	48 83 e8 01          	sub    $0x1,%rax
+  800ccd:	0f b6 00             	movzbl (%rax),%eax
+  800cd0:	3c 25                	cmp    $0x25,%al
+  800cd2:	75 ec                	jne    800cc0 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800cd4:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800cd5:	e9 50 fb ff ff       	jmp    80082a <vprintfmt+0x52>
+        return;
+  800cda:	90                   	nop
+    }
+  }
+}
+  800cdb:	48 83 c4 60          	add    $0x60,%rsp
+  800cdf:	5b                   	pop    %rbx
+  800ce0:	41 5c                	pop    %r12
+  800ce2:	5d                   	pop    %rbp
+  800ce3:	c3                   	ret
+
+0000000000800ce4 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ce4:	55                   	push   %rbp
+  800ce5:	48 89 e5             	mov    %rsp,%rbp
+  800ce8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800cef:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800cf6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800cfd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d04:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d0b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d12:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d19:	84 c0                	test   %al,%al
+  800d1b:	74 20                	je     800d3d <printfmt+0x59>
+  800d1d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d21:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d25:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d29:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d2d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d31:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d35:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d39:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800d3d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d44:	00 00 00 
+  800d47:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d4e:	00 00 00 
+  800d51:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d55:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d5c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d63:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800d6a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d71:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d78:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d7f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d86:	48 89 c7             	mov    %rax,%rdi
+  800d89:	48 b8 d8 07 80 00 00 	movabs $0x8007d8,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d95:	90                   	nop
+  800d96:	c9                   	leave
+  800d97:	c3                   	ret
+
+0000000000800d98 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	48 83 ec 10          	sub    $0x10,%rsp
+  800da0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800da3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800da7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dab:	8b 40 10             	mov    0x10(%rax),%eax
+  800dae:	8d 50 01             	lea    0x1(%rax),%edx
+  800db1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800db5:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800db8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dbc:	48 8b 10             	mov    (%rax),%rdx
+  800dbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dc3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800dc7:	48 39 c2             	cmp    %rax,%rdx
+  800dca:	73 17                	jae    800de3 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800dcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dd0:	48 8b 00             	mov    (%rax),%rax
+  800dd3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800dd7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ddb:	48 89 0a             	mov    %rcx,(%rdx)
+  800dde:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800de1:	88 10                	mov    %dl,(%rax)
+}
+  800de3:	90                   	nop
+  800de4:	c9                   	leave
+  800de5:	c3                   	ret
+
+0000000000800de6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800de6:	55                   	push   %rbp
+  800de7:	48 89 e5             	mov    %rsp,%rbp
+  800dea:	48 83 ec 40          	sub    $0x40,%rsp
+  800dee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800df2:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800df5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800df9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800dfd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e01:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800e05:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800e08:	48 98                	cltq
+  800e0a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e12:	48 01 d0             	add    %rdx,%rax
+  800e15:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800e19:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800e20:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e25:	74 06                	je     800e2d <vsnprintf+0x47>
+  800e27:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e2b:	7f 07                	jg     800e34 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800e2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e32:	eb 32                	jmp    800e66 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800e34:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800e38:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800e3c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800e40:	48 89 c6             	mov    %rax,%rsi
+  800e43:	48 b8 98 0d 80 00 00 	movabs $0x800d98,%rax
+  800e4a:	00 00 00 
+  800e4d:	48 89 c7             	mov    %rax,%rdi
+  800e50:	48 b8 d8 07 80 00 00 	movabs $0x8007d8,%rax
+  800e57:	00 00 00 
+  800e5a:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800e5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e60:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800e63:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800e66:	c9                   	leave
+  800e67:	c3                   	ret
+
+0000000000800e68 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800e68:	55                   	push   %rbp
+  800e69:	48 89 e5             	mov    %rsp,%rbp
+  800e6c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e73:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e7a:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800e80:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e87:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e8e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e95:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e9c:	84 c0                	test   %al,%al
+  800e9e:	74 20                	je     800ec0 <snprintf+0x58>
+  800ea0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ea4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ea8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800eac:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800eb0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800eb4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800eb8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ebc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800ec0:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800ec7:	00 00 00 
+  800eca:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ed1:	00 00 00 
+  800ed4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ed8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800edf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ee6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800eed:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800ef4:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800efb:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800f01:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f08:	48 89 c7             	mov    %rax,%rdi
+  800f0b:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+  800f17:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800f1d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800f23:	c9                   	leave
+  800f24:	c3                   	ret
+
+0000000000800f25 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800f25:	55                   	push   %rbp
+  800f26:	48 89 e5             	mov    %rsp,%rbp
+  800f29:	53                   	push   %rbx
+  800f2a:	48 83 ec 38          	sub    $0x38,%rsp
+  800f2e:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f31:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f35:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800f39:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800f3d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800f41:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	89 d1                	mov    %edx,%ecx
+  800f4b:	0f a2                	cpuid
+  800f4d:	89 de                	mov    %ebx,%esi
+  800f4f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f52:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f55:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f58:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800f5b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f60:	74 09                	je     800f6b <cpuid+0x46>
+}
+  800f62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f66:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f69:	89 10                	mov    %edx,(%rax)
+
+  800f6b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f70:	74 09                	je     800f7b <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800f72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f76:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f79:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800f7b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f80:	74 09                	je     800f8b <cpuid+0x66>
+char *
+  800f82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f86:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f89:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800f8b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f90:	74 09                	je     800f9b <cpuid+0x76>
+  for (; *s; s++)
+  800f92:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f96:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f99:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f9b:	90                   	nop
+  800f9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa0:	c9                   	leave
+  800fa1:	c3                   	ret
+
+0000000000800fa2 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800fa2:	55                   	push   %rbp
+  800fa3:	48 89 e5             	mov    %rsp,%rbp
+  800fa6:	48 83 ec 18          	sub    $0x18,%rsp
+  800faa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800fad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800fb0:	89 c1                	mov    %eax,%ecx
+  800fb2:	0f 01 d0             	xgetbv
+  800fb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800fb8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800fbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fbe:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800fc1:	48 c1 e2 20          	shl    $0x20,%rdx
+  800fc5:	48 09 d0             	or     %rdx,%rax
+#else
+  800fc8:	c9                   	leave
+  800fc9:	c3                   	ret
+
+0000000000800fca <string_cpu>:
+string_cpu(void) {
+  800fca:	55                   	push   %rbp
+  800fcb:	48 89 e5             	mov    %rsp,%rbp
+  800fce:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800fd2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800fd9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800fe0:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800fe7:	00 00 00 
+  800fea:	8b 00                	mov    (%rax),%eax
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	78 11                	js     801001 <string_cpu+0x37>
+    return string_features;
+  800ff0:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800ff7:	00 00 00 
+  800ffa:	8b 00                	mov    (%rax),%eax
+  800ffc:	e9 df 00 00 00       	jmp    8010e0 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801001:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801005:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80100b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801010:	ba 00 00 00 00       	mov    $0x0,%edx
+  801015:	48 89 c6             	mov    %rax,%rsi
+  801018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101d:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  801024:	00 00 00 
+  801027:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801029:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80102c:	83 f8 06             	cmp    $0x6,%eax
+  80102f:	76 28                	jbe    801059 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801031:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801035:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80103b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801040:	48 89 c2             	mov    %rax,%rdx
+  801043:	be 00 00 00 00       	mov    $0x0,%esi
+  801048:	bf 07 00 00 00       	mov    $0x7,%edi
+  80104d:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  801054:	00 00 00 
+  801057:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801059:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80105c:	25 00 02 00 00       	and    $0x200,%eax
+  801061:	85 c0                	test   %eax,%eax
+  801063:	74 04                	je     801069 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801065:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801069:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80106d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801073:	48 89 c1             	mov    %rax,%rcx
+  801076:	ba 00 00 00 00       	mov    $0x0,%edx
+  80107b:	be 00 00 00 00       	mov    $0x0,%esi
+  801080:	bf 01 00 00 00       	mov    $0x1,%edi
+  801085:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801091:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801094:	83 e0 20             	and    $0x20,%eax
+  801097:	85 c0                	test   %eax,%eax
+  801099:	74 2a                	je     8010c5 <string_cpu+0xfb>
+  80109b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80109e:	25 00 00 00 08       	and    $0x8000000,%eax
+  8010a3:	85 c0                	test   %eax,%eax
+  8010a5:	74 1e                	je     8010c5 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8010a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ac:	48 b8 a2 0f 80 00 00 	movabs $0x800fa2,%rax
+  8010b3:	00 00 00 
+  8010b6:	ff d0                	call   *%rax
+  8010b8:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8010bb:	48 83 f8 06          	cmp    $0x6,%rax
+  8010bf:	75 04                	jne    8010c5 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8010c1:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8010c5:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8010cc:	00 00 00 
+  8010cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010d2:	89 02                	mov    %eax,(%rdx)
+  8010d4:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8010db:	00 00 00 
+  8010de:	8b 00                	mov    (%rax),%eax
+}
+  8010e0:	c9                   	leave
+  8010e1:	c3                   	ret
+
+00000000008010e2 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8010e2:	55                   	push   %rbp
+  8010e3:	48 89 e5             	mov    %rsp,%rbp
+  8010e6:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010ea:	48 83 ec 60          	sub    $0x60,%rsp
+  8010ee:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8010f3:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010f8:	83 e0 1f             	and    $0x1f,%eax
+  8010fb:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8010ff:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801103:	48 f7 d8             	neg    %rax
+  801106:	48 89 c2             	mov    %rax,%rdx
+  801109:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80110e:	48 01 d0             	add    %rdx,%rax
+  801111:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801116:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  80111a:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801120:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801125:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801129:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80112f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801133:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801137:	89 c2                	mov    %eax,%edx
+  801139:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80113d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801142:	89 c1                	mov    %eax,%ecx
+  801144:	d3 e6                	shl    %cl,%esi
+  801146:	89 f0                	mov    %esi,%eax
+  801148:	21 d0                	and    %edx,%eax
+  80114a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80114e:	eb 21                	jmp    801171 <strlen_avx2+0x8f>
+    p += 32;
+  801150:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801156:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80115b:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80115f:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801165:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801169:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80116d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801171:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801176:	74 d8                	je     801150 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801178:	31 c0                	xor    %eax,%eax
+  80117a:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801180:	48 63 d0             	movslq %eax,%rdx
+  801183:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801188:	48 01 d0             	add    %rdx,%rax
+  80118b:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801190:	c9                   	leave
+  801191:	c3                   	ret
+
+0000000000801192 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801192:	55                   	push   %rbp
+  801193:	48 89 e5             	mov    %rsp,%rbp
+  801196:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80119a:	48 83 ec 40          	sub    $0x40,%rsp
+  80119e:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8011a3:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8011a8:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8011ad:	eb 77                	jmp    801226 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8011af:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011b4:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8011b8:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8011bc:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011c1:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8011c5:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8011c9:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8011cd:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8011d1:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8011d6:	74 3c                	je     801214 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8011d8:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8011dc:	f7 d0                	not    %eax
+  8011de:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8011e2:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8011e6:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8011ea:	48 63 d0             	movslq %eax,%rdx
+  8011ed:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011f2:	48 01 d0             	add    %rdx,%rax
+  8011f5:	0f b6 00             	movzbl (%rax),%eax
+  8011f8:	0f b6 c0             	movzbl %al,%eax
+  8011fb:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8011ff:	48 63 ca             	movslq %edx,%rcx
+  801202:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801207:	48 01 ca             	add    %rcx,%rdx
+  80120a:	0f b6 12             	movzbl (%rdx),%edx
+  80120d:	0f b6 d2             	movzbl %dl,%edx
+  801210:	29 d0                	sub    %edx,%eax
+  801212:	eb 6b                	jmp    80127f <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801214:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80121a:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801220:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801226:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80122c:	77 81                	ja     8011af <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80122e:	eb 42                	jmp    801272 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801230:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801235:	0f b6 10             	movzbl (%rax),%edx
+  801238:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80123d:	0f b6 00             	movzbl (%rax),%eax
+  801240:	38 c2                	cmp    %al,%dl
+  801242:	74 1c                	je     801260 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801244:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801249:	0f b6 00             	movzbl (%rax),%eax
+  80124c:	0f b6 c8             	movzbl %al,%ecx
+  80124f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801254:	0f b6 00             	movzbl (%rax),%eax
+  801257:	0f b6 d0             	movzbl %al,%edx
+  80125a:	89 c8                	mov    %ecx,%eax
+  80125c:	29 d0                	sub    %edx,%eax
+  80125e:	eb 1f                	jmp    80127f <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801260:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801266:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80126c:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801272:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801278:	75 b6                	jne    801230 <memcmp_avx2+0x9e>
+  return 0;
+  80127a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80127f:	c9                   	leave
+  801280:	c3                   	ret
+
+0000000000801281 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801289:	48 83 ec 60          	sub    $0x60,%rsp
+  80128d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801292:	89 f0                	mov    %esi,%eax
+  801294:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801299:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80129d:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8012a2:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8012a6:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8012ab:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8012b1:	eb 47                	jmp    8012fa <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8012b3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012b8:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012bc:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8012c0:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8012c6:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8012ca:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012ce:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8012d2:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8012d7:	74 15                	je     8012ee <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8012d9:	31 c0                	xor    %eax,%eax
+  8012db:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8012e1:	48 63 d0             	movslq %eax,%rdx
+  8012e4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012e9:	48 01 d0             	add    %rdx,%rax
+  8012ec:	eb 3d                	jmp    80132b <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8012ee:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8012f4:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8012fa:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801300:	77 b1                	ja     8012b3 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801302:	eb 0c                	jmp    801310 <memfind_avx2+0x8f>
+  801304:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80130a:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801310:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801316:	74 0e                	je     801326 <memfind_avx2+0xa5>
+  801318:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80131d:	0f b6 00             	movzbl (%rax),%eax
+  801320:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801324:	75 de                	jne    801304 <memfind_avx2+0x83>
+  return s;
+  801326:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80132b:	c9                   	leave
+  80132c:	c3                   	ret
+
+000000000080132d <strlen>:
+strlen(const char *s) {
+  80132d:	55                   	push   %rbp
+  80132e:	48 89 e5             	mov    %rsp,%rbp
+  801331:	48 83 ec 40          	sub    $0x40,%rsp
+  801335:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801339:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80133d:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801341:	48 b8 ca 0f 80 00 00 	movabs $0x800fca,%rax
+  801348:	00 00 00 
+  80134b:	ff d0                	call   *%rax
+  80134d:	83 e0 02             	and    $0x2,%eax
+  801350:	85 c0                	test   %eax,%eax
+  801352:	74 18                	je     80136c <strlen+0x3f>
+    return strlen_avx2(s);
+  801354:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801358:	48 89 c7             	mov    %rax,%rdi
+  80135b:	48 b8 e2 10 80 00 00 	movabs $0x8010e2,%rax
+  801362:	00 00 00 
+  801365:	ff d0                	call   *%rax
+  801367:	e9 82 00 00 00       	jmp    8013ee <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80136c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801370:	83 e0 0f             	and    $0xf,%eax
+  801373:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801376:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801379:	48 f7 d8             	neg    %rax
+  80137c:	48 89 c2             	mov    %rax,%rdx
+  80137f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801383:	48 01 d0             	add    %rdx,%rax
+  801386:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80138a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80138e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801392:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801397:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80139b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80139f:	89 c2                	mov    %eax,%edx
+  8013a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013a4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8013a9:	89 c1                	mov    %eax,%ecx
+  8013ab:	d3 e6                	shl    %cl,%esi
+  8013ad:	89 f0                	mov    %esi,%eax
+  8013af:	21 d0                	and    %edx,%eax
+  8013b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8013b4:	eb 1d                	jmp    8013d3 <strlen+0xa6>
+    p += 16;
+  8013b6:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8013bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013bf:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8013c3:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8013c8:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8013cc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8013d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8013d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013d7:	74 dd                	je     8013b6 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8013d9:	31 c0                	xor    %eax,%eax
+  8013db:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8013e0:	48 63 d0             	movslq %eax,%rdx
+  8013e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e7:	48 01 d0             	add    %rdx,%rax
+  8013ea:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8013ee:	c9                   	leave
+  8013ef:	c3                   	ret
+
+00000000008013f0 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8013f0:	55                   	push   %rbp
+  8013f1:	48 89 e5             	mov    %rsp,%rbp
+  8013f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8013f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801400:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801407:	eb 0e                	jmp    801417 <strnlen+0x27>
+    n++;
+  801409:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80140d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801412:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801417:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80141c:	74 0b                	je     801429 <strnlen+0x39>
+  80141e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801422:	0f b6 00             	movzbl (%rax),%eax
+  801425:	84 c0                	test   %al,%al
+  801427:	75 e0                	jne    801409 <strnlen+0x19>
+  return n;
+  801429:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80142c:	c9                   	leave
+  80142d:	c3                   	ret
+
+000000000080142e <strcpy>:
+strcpy(char *dst, const char *src) {
+  80142e:	55                   	push   %rbp
+  80142f:	48 89 e5             	mov    %rsp,%rbp
+  801432:	48 83 ec 20          	sub    $0x20,%rsp
+  801436:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80143a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80143e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801442:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801446:	90                   	nop
+  801447:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80144b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80144f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801453:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801457:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80145b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80145f:	0f b6 12             	movzbl (%rdx),%edx
+  801462:	88 10                	mov    %dl,(%rax)
+  801464:	0f b6 00             	movzbl (%rax),%eax
+  801467:	84 c0                	test   %al,%al
+  801469:	75 dc                	jne    801447 <strcpy+0x19>
+  return ret;
+  80146b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+
+0000000000801471 <strcat>:
+strcat(char *dst, const char *src) {
+  801471:	55                   	push   %rbp
+  801472:	48 89 e5             	mov    %rsp,%rbp
+  801475:	48 83 ec 20          	sub    $0x20,%rsp
+  801479:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80147d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801481:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801485:	48 89 c7             	mov    %rax,%rdi
+  801488:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  80148f:	00 00 00 
+  801492:	ff d0                	call   *%rax
+  801494:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801497:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80149a:	48 63 d0             	movslq %eax,%rdx
+  80149d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a1:	48 01 c2             	add    %rax,%rdx
+  8014a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014a8:	48 89 c6             	mov    %rax,%rsi
+  8014ab:	48 89 d7             	mov    %rdx,%rdi
+  8014ae:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  8014b5:	00 00 00 
+  8014b8:	ff d0                	call   *%rax
+  return dst;
+  8014ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8014c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014d0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8014d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8014dc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014e3:	00 
+  8014e4:	eb 2a                	jmp    801510 <strncpy+0x50>
+    *dst++ = *src;
+  8014e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014f6:	0f b6 12             	movzbl (%rdx),%edx
+  8014f9:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8014fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014ff:	0f b6 00             	movzbl (%rax),%eax
+  801502:	84 c0                	test   %al,%al
+  801504:	74 05                	je     80150b <strncpy+0x4b>
+      src++;
+  801506:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80150b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801510:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801514:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801518:	72 cc                	jb     8014e6 <strncpy+0x26>
+  return ret;
+  80151a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80151e:	c9                   	leave
+  80151f:	c3                   	ret
+
+0000000000801520 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801520:	55                   	push   %rbp
+  801521:	48 89 e5             	mov    %rsp,%rbp
+  801524:	48 83 ec 28          	sub    $0x28,%rsp
+  801528:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80152c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801530:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801534:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801538:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80153c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801541:	74 3d                	je     801580 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801543:	eb 1d                	jmp    801562 <strlcpy+0x42>
+      *dst++ = *src++;
+  801545:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801549:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80154d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801551:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801555:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801559:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80155d:	0f b6 12             	movzbl (%rdx),%edx
+  801560:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801562:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801567:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80156c:	74 0b                	je     801579 <strlcpy+0x59>
+  80156e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801572:	0f b6 00             	movzbl (%rax),%eax
+  801575:	84 c0                	test   %al,%al
+  801577:	75 cc                	jne    801545 <strlcpy+0x25>
+    *dst = '\0';
+  801579:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157d:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801580:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801584:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801588:	c9                   	leave
+  801589:	c3                   	ret
+
+000000000080158a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80158a:	55                   	push   %rbp
+  80158b:	48 89 e5             	mov    %rsp,%rbp
+  80158e:	48 83 ec 30          	sub    $0x30,%rsp
+  801592:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801596:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80159a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80159e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015a2:	48 89 c7             	mov    %rax,%rdi
+  8015a5:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  8015ac:	00 00 00 
+  8015af:	ff d0                	call   *%rax
+  8015b1:	48 98                	cltq
+  8015b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8015b7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015bf:	48 89 d6             	mov    %rdx,%rsi
+  8015c2:	48 89 c7             	mov    %rax,%rdi
+  8015c5:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	48 98                	cltq
+  8015d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8015d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015db:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015df:	75 10                	jne    8015f1 <strlcat+0x67>
+    return maxlen + srclen;
+  8015e1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e9:	48 01 d0             	add    %rdx,%rax
+  8015ec:	e9 86 00 00 00       	jmp    801677 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8015f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f5:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8015f9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015fd:	73 2b                	jae    80162a <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8015ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801603:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801607:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80160b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160f:	48 01 c1             	add    %rax,%rcx
+  801612:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801616:	48 89 c6             	mov    %rax,%rsi
+  801619:	48 89 cf             	mov    %rcx,%rdi
+  80161c:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  801623:	00 00 00 
+  801626:	ff d0                	call   *%rax
+  801628:	eb 42                	jmp    80166c <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80162a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80162e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801632:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801636:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163a:	48 01 c1             	add    %rax,%rcx
+  80163d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801641:	48 89 c6             	mov    %rax,%rsi
+  801644:	48 89 cf             	mov    %rcx,%rdi
+  801647:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  80164e:	00 00 00 
+  801651:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801653:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801657:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165b:	48 01 d0             	add    %rdx,%rax
+  80165e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801666:	48 01 d0             	add    %rdx,%rax
+  801669:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80166c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801670:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801674:	48 01 d0             	add    %rdx,%rax
+}
+  801677:	c9                   	leave
+  801678:	c3                   	ret
+
+0000000000801679 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801679:	55                   	push   %rbp
+  80167a:	48 89 e5             	mov    %rsp,%rbp
+  80167d:	48 83 ec 10          	sub    $0x10,%rsp
+  801681:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801685:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801689:	eb 0a                	jmp    801695 <strcmp+0x1c>
+    p++, q++;
+  80168b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801690:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801699:	0f b6 00             	movzbl (%rax),%eax
+  80169c:	84 c0                	test   %al,%al
+  80169e:	74 12                	je     8016b2 <strcmp+0x39>
+  8016a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a4:	0f b6 10             	movzbl (%rax),%edx
+  8016a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ab:	0f b6 00             	movzbl (%rax),%eax
+  8016ae:	38 c2                	cmp    %al,%dl
+  8016b0:	74 d9                	je     80168b <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8016b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b6:	0f b6 00             	movzbl (%rax),%eax
+  8016b9:	0f b6 d0             	movzbl %al,%edx
+  8016bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c0:	0f b6 00             	movzbl (%rax),%eax
+  8016c3:	0f b6 c0             	movzbl %al,%eax
+  8016c6:	29 c2                	sub    %eax,%edx
+  8016c8:	89 d0                	mov    %edx,%eax
+}
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+
+00000000008016cc <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8016d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016e0:	eb 0f                	jmp    8016f1 <strncmp+0x25>
+    n--, p++, q++;
+  8016e2:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8016e7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ec:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016f1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016f6:	74 1d                	je     801715 <strncmp+0x49>
+  8016f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fc:	0f b6 00             	movzbl (%rax),%eax
+  8016ff:	84 c0                	test   %al,%al
+  801701:	74 12                	je     801715 <strncmp+0x49>
+  801703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801707:	0f b6 10             	movzbl (%rax),%edx
+  80170a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80170e:	0f b6 00             	movzbl (%rax),%eax
+  801711:	38 c2                	cmp    %al,%dl
+  801713:	74 cd                	je     8016e2 <strncmp+0x16>
+  if (n == 0)
+  801715:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80171a:	75 07                	jne    801723 <strncmp+0x57>
+    return 0;
+  80171c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801721:	eb 16                	jmp    801739 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801727:	0f b6 00             	movzbl (%rax),%eax
+  80172a:	0f b6 d0             	movzbl %al,%edx
+  80172d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801731:	0f b6 00             	movzbl (%rax),%eax
+  801734:	0f b6 c0             	movzbl %al,%eax
+  801737:	29 c2                	sub    %eax,%edx
+}
+  801739:	89 d0                	mov    %edx,%eax
+  80173b:	c9                   	leave
+  80173c:	c3                   	ret
+
+000000000080173d <strchr>:
+strchr(const char *s, char c) {
+  80173d:	55                   	push   %rbp
+  80173e:	48 89 e5             	mov    %rsp,%rbp
+  801741:	48 83 ec 60          	sub    $0x60,%rsp
+  801745:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801749:	89 f0                	mov    %esi,%eax
+  80174b:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80174e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801752:	83 e0 0f             	and    $0xf,%eax
+  801755:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801758:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80175b:	48 f7 d8             	neg    %rax
+  80175e:	48 89 c2             	mov    %rax,%rdx
+  801761:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801765:	48 01 d0             	add    %rdx,%rax
+  801768:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80176c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801770:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801774:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801778:	66 0f 6e c0          	movd   %eax,%xmm0
+  80177c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801780:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801784:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801789:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80178d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801791:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801795:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801799:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80179e:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8017a3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017a7:	89 c2                	mov    %eax,%edx
+  8017a9:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017ae:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8017b3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017b7:	09 c2                	or     %eax,%edx
+  8017b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8017c1:	89 c1                	mov    %eax,%ecx
+  8017c3:	d3 e6                	shl    %cl,%esi
+  8017c5:	89 f0                	mov    %esi,%eax
+  8017c7:	21 d0                	and    %edx,%eax
+  8017c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017cc:	eb 34                	jmp    801802 <strchr+0xc5>
+    p += 16;
+  8017ce:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8017d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d7:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8017db:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8017df:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017e4:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8017e9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017ed:	89 c2                	mov    %eax,%edx
+  8017ef:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017f4:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8017f9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017fd:	09 d0                	or     %edx,%eax
+  8017ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801802:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801806:	74 c6                	je     8017ce <strchr+0x91>
+  p += __builtin_ctz(m);
+  801808:	31 c0                	xor    %eax,%eax
+  80180a:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80180f:	48 98                	cltq
+  801811:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801815:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801819:	0f b6 00             	movzbl (%rax),%eax
+  80181c:	84 c0                	test   %al,%al
+  80181e:	74 06                	je     801826 <strchr+0xe9>
+  801820:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801824:	eb 05                	jmp    80182b <strchr+0xee>
+  801826:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+
+000000000080182d <strfind>:
+strfind(const char *s, char c) {
+  80182d:	55                   	push   %rbp
+  80182e:	48 89 e5             	mov    %rsp,%rbp
+  801831:	48 83 ec 10          	sub    $0x10,%rsp
+  801835:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801839:	89 f0                	mov    %esi,%eax
+  80183b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80183e:	eb 11                	jmp    801851 <strfind+0x24>
+    if (*s == c)
+  801840:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801844:	0f b6 00             	movzbl (%rax),%eax
+  801847:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80184a:	74 12                	je     80185e <strfind+0x31>
+  for (; *s; s++)
+  80184c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801851:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801855:	0f b6 00             	movzbl (%rax),%eax
+  801858:	84 c0                	test   %al,%al
+  80185a:	75 e4                	jne    801840 <strfind+0x13>
+  80185c:	eb 01                	jmp    80185f <strfind+0x32>
+      break;
+  80185e:	90                   	nop
+  return (char *)s;
+  80185f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+0000000000801865 <memset>:
+memset(void *v, int c, size_t n) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	48 83 ec 38          	sub    $0x38,%rsp
+  80186d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801871:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801874:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801880:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801885:	76 41                	jbe    8018c8 <memset+0x63>
+  801887:	48 b8 ca 0f 80 00 00 	movabs $0x800fca,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+  801893:	83 e0 01             	and    $0x1,%eax
+  801896:	85 c0                	test   %eax,%eax
+  801898:	74 2e                	je     8018c8 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80189a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80189d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018a1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8018a5:	48 89 ce             	mov    %rcx,%rsi
+  8018a8:	48 89 f7             	mov    %rsi,%rdi
+  8018ab:	48 89 d1             	mov    %rdx,%rcx
+  8018ae:	fc                   	cld
+  8018af:	f3 aa                	rep stos %al,%es:(%rdi)
+  8018b1:	48 89 ca             	mov    %rcx,%rdx
+  8018b4:	48 89 fe             	mov    %rdi,%rsi
+  8018b7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8018bb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8018bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c3:	e9 a7 00 00 00       	jmp    80196f <memset+0x10a>
+  if (n >= 8) {
+  8018c8:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8018cd:	0f 86 87 00 00 00    	jbe    80195a <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8018d3:	eb 16                	jmp    8018eb <memset+0x86>
+      *p++ = c;
+  8018d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018dd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018e1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018e4:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8018e6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ef:	83 e0 07             	and    $0x7,%eax
+  8018f2:	48 85 c0             	test   %rax,%rax
+  8018f5:	75 de                	jne    8018d5 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8018f7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8018fa:	0f b6 c0             	movzbl %al,%eax
+  8018fd:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801904:	01 01 01 
+  801907:	48 0f af c2          	imul   %rdx,%rax
+  80190b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80190f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801913:	48 c1 e8 03          	shr    $0x3,%rax
+  801917:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80191b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80191f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801923:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801927:	48 89 ce             	mov    %rcx,%rsi
+  80192a:	48 89 f7             	mov    %rsi,%rdi
+  80192d:	48 89 d1             	mov    %rdx,%rcx
+  801930:	fc                   	cld
+  801931:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801934:	48 89 ca             	mov    %rcx,%rdx
+  801937:	48 89 fe             	mov    %rdi,%rsi
+  80193a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80193e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801942:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801947:	eb 11                	jmp    80195a <memset+0xf5>
+    *p++ = c;
+  801949:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801951:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801955:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801958:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  80195a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80195e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801962:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801966:	48 85 c0             	test   %rax,%rax
+  801969:	75 de                	jne    801949 <memset+0xe4>
+  return v;
+  80196b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+0000000000801971 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801971:	55                   	push   %rbp
+  801972:	48 89 e5             	mov    %rsp,%rbp
+  801975:	48 83 ec 38          	sub    $0x38,%rsp
+  801979:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80197d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801981:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801985:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801989:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80198d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801991:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801995:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801999:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80199d:	0f 83 da 00 00 00    	jae    801a7d <memmove+0x10c>
+  8019a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019ab:	48 01 d0             	add    %rdx,%rax
+  8019ae:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8019b2:	0f 83 c5 00 00 00    	jae    801a7d <memmove+0x10c>
+    s += n;
+  8019b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019bc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8019c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019c4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8019c8:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8019cd:	0f 86 94 00 00 00    	jbe    801a67 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8019d3:	eb 1c                	jmp    8019f1 <memmove+0x80>
+        *--d = *--s;
+  8019d5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019da:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e3:	0f b6 10             	movzbl (%rax),%edx
+  8019e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ea:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8019ec:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8019f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f5:	83 e0 07             	and    $0x7,%eax
+  8019f8:	48 85 c0             	test   %rax,%rax
+  8019fb:	75 d8                	jne    8019d5 <memmove+0x64>
+      nq = n / 8;
+  8019fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a01:	48 c1 e8 03          	shr    $0x3,%rax
+  801a05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801a09:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801a0e:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801a13:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801a18:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a24:	48 89 cf             	mov    %rcx,%rdi
+  801a27:	48 89 d6             	mov    %rdx,%rsi
+  801a2a:	48 89 c1             	mov    %rax,%rcx
+  801a2d:	fd                   	std
+  801a2e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a31:	fc                   	cld
+  801a32:	48 89 c8             	mov    %rcx,%rax
+  801a35:	48 89 f2             	mov    %rsi,%rdx
+  801a38:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a3c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a40:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801a44:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801a49:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801a4e:	eb 17                	jmp    801a67 <memmove+0xf6>
+      *--d = *--s;
+  801a50:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801a55:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a5e:	0f b6 10             	movzbl (%rax),%edx
+  801a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a65:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a6b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a6f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a73:	48 85 c0             	test   %rax,%rax
+  801a76:	75 d8                	jne    801a50 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801a78:	e9 f4 00 00 00       	jmp    801b71 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a7d:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a82:	76 46                	jbe    801aca <memmove+0x159>
+  801a84:	48 b8 ca 0f 80 00 00 	movabs $0x800fca,%rax
+  801a8b:	00 00 00 
+  801a8e:	ff d0                	call   *%rax
+  801a90:	83 e0 01             	and    $0x1,%eax
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	74 33                	je     801aca <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a97:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa3:	48 89 cf             	mov    %rcx,%rdi
+  801aa6:	48 89 d6             	mov    %rdx,%rsi
+  801aa9:	48 89 c1             	mov    %rax,%rcx
+  801aac:	fc                   	cld
+  801aad:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801aaf:	48 89 c8             	mov    %rcx,%rax
+  801ab2:	48 89 f2             	mov    %rsi,%rdx
+  801ab5:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ab9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801abd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801ac1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac5:	e9 ab 00 00 00       	jmp    801b75 <memmove+0x204>
+    if (n >= 8) {
+  801aca:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801acf:	0f 86 8b 00 00 00    	jbe    801b60 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801ad5:	eb 22                	jmp    801af9 <memmove+0x188>
+        *d++ = *s++;
+  801ad7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801adb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801adf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ae7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801aeb:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801aef:	0f b6 12             	movzbl (%rdx),%edx
+  801af2:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801af4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801af9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801afd:	83 e0 07             	and    $0x7,%eax
+  801b00:	48 85 c0             	test   %rax,%rax
+  801b03:	75 d2                	jne    801ad7 <memmove+0x166>
+      nq = n / 8;
+  801b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b09:	48 c1 e8 03          	shr    $0x3,%rax
+  801b0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801b11:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b1d:	48 89 cf             	mov    %rcx,%rdi
+  801b20:	48 89 d6             	mov    %rdx,%rsi
+  801b23:	48 89 c1             	mov    %rax,%rcx
+  801b26:	fc                   	cld
+  801b27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b2a:	48 89 c8             	mov    %rcx,%rax
+  801b2d:	48 89 f2             	mov    %rsi,%rdx
+  801b30:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b34:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b38:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b3c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801b41:	eb 1d                	jmp    801b60 <memmove+0x1ef>
+      *d++ = *s++;
+  801b43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b47:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801b4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b53:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b57:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b5b:	0f b6 12             	movzbl (%rdx),%edx
+  801b5e:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b64:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b68:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b6c:	48 85 c0             	test   %rax,%rax
+  801b6f:	75 d2                	jne    801b43 <memmove+0x1d2>
+  return dst;
+  801b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b75:	c9                   	leave
+  801b76:	c3                   	ret
+
+0000000000801b77 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801b77:	55                   	push   %rbp
+  801b78:	48 89 e5             	mov    %rsp,%rbp
+  801b7b:	48 83 ec 18          	sub    $0x18,%rsp
+  801b7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b87:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801b8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b8f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b97:	48 89 ce             	mov    %rcx,%rsi
+  801b9a:	48 89 c7             	mov    %rax,%rdi
+  801b9d:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+}
+  801ba9:	c9                   	leave
+  801baa:	c3                   	ret
+
+0000000000801bab <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801bab:	55                   	push   %rbp
+  801bac:	48 89 e5             	mov    %rsp,%rbp
+  801baf:	48 83 ec 40          	sub    $0x40,%rsp
+  801bb3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bb7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801bbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801bc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bcb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801bcf:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801bd4:	0f 86 a7 00 00 00    	jbe    801c81 <memcmp+0xd6>
+  801bda:	48 b8 ca 0f 80 00 00 	movabs $0x800fca,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	83 e0 02             	and    $0x2,%eax
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	0f 84 90 00 00 00    	je     801c81 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801bf1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bf5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bfd:	48 89 ce             	mov    %rcx,%rsi
+  801c00:	48 89 c7             	mov    %rax,%rdi
+  801c03:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	e9 c2 00 00 00       	jmp    801cd6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801c14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c18:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801c1c:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801c20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c24:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801c28:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801c2c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801c30:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801c33:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801c3a:	74 36                	je     801c72 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801c3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c3f:	f7 d0                	not    %eax
+  801c41:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801c45:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801c48:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801c4b:	48 63 d0             	movslq %eax,%rdx
+  801c4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c52:	48 01 d0             	add    %rdx,%rax
+  801c55:	0f b6 00             	movzbl (%rax),%eax
+  801c58:	0f b6 c0             	movzbl %al,%eax
+  801c5b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801c5e:	48 63 ca             	movslq %edx,%rcx
+  801c61:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c65:	48 01 ca             	add    %rcx,%rdx
+  801c68:	0f b6 12             	movzbl (%rdx),%edx
+  801c6b:	0f b6 d2             	movzbl %dl,%edx
+  801c6e:	29 d0                	sub    %edx,%eax
+  801c70:	eb 64                	jmp    801cd6 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801c72:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801c77:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801c7c:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801c81:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801c86:	77 8c                	ja     801c14 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801c88:	eb 36                	jmp    801cc0 <memcmp+0x115>
+    if (*s1 != *s2)
+  801c8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8e:	0f b6 10             	movzbl (%rax),%edx
+  801c91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c95:	0f b6 00             	movzbl (%rax),%eax
+  801c98:	38 c2                	cmp    %al,%dl
+  801c9a:	74 1a                	je     801cb6 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca0:	0f b6 00             	movzbl (%rax),%eax
+  801ca3:	0f b6 c8             	movzbl %al,%ecx
+  801ca6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801caa:	0f b6 00             	movzbl (%rax),%eax
+  801cad:	0f b6 d0             	movzbl %al,%edx
+  801cb0:	89 c8                	mov    %ecx,%eax
+  801cb2:	29 d0                	sub    %edx,%eax
+  801cb4:	eb 20                	jmp    801cd6 <memcmp+0x12b>
+    s1++, s2++;
+  801cb6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cbb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801cc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cc8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ccc:	48 85 c0             	test   %rax,%rax
+  801ccf:	75 b9                	jne    801c8a <memcmp+0xdf>
+  }
+
+  return 0;
+  801cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd6:	c9                   	leave
+  801cd7:	c3                   	ret
+
+0000000000801cd8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801cd8:	55                   	push   %rbp
+  801cd9:	48 89 e5             	mov    %rsp,%rbp
+  801cdc:	48 83 ec 50          	sub    $0x50,%rsp
+  801ce0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ce4:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801ce7:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801ceb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801cef:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cf3:	48 01 d0             	add    %rdx,%rax
+  801cf6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801cfa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801cfd:	66 0f 6e c0          	movd   %eax,%xmm0
+  801d01:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801d05:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801d09:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801d0e:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d12:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801d17:	76 73                	jbe    801d8c <memfind+0xb4>
+  801d19:	48 b8 ca 0f 80 00 00 	movabs $0x800fca,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+  801d25:	83 e0 02             	and    $0x2,%eax
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	74 60                	je     801d8c <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801d2c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801d2f:	0f b6 c8             	movzbl %al,%ecx
+  801d32:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801d36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3a:	89 ce                	mov    %ecx,%esi
+  801d3c:	48 89 c7             	mov    %rax,%rdi
+  801d3f:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	eb 6c                	jmp    801db9 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801d4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d51:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d55:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d59:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801d5e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d62:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d66:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d69:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d6d:	74 13                	je     801d82 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801d6f:	31 c0                	xor    %eax,%eax
+  801d71:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801d76:	48 63 d0             	movslq %eax,%rdx
+  801d79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d7d:	48 01 d0             	add    %rdx,%rax
+  801d80:	eb 37                	jmp    801db9 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801d82:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801d87:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801d8c:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d91:	77 ba                	ja     801d4d <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d93:	eb 13                	jmp    801da8 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d99:	0f b6 00             	movzbl (%rax),%eax
+  801d9c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d9f:	38 d0                	cmp    %dl,%al
+  801da1:	74 11                	je     801db4 <memfind+0xdc>
+  for (; s < ends; s++)
+  801da3:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801da8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dac:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801db0:	72 e3                	jb     801d95 <memfind+0xbd>
+  801db2:	eb 01                	jmp    801db5 <memfind+0xdd>
+      break;
+  801db4:	90                   	nop
+  return (void *)s;
+  801db5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+0000000000801dbb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801dbb:	55                   	push   %rbp
+  801dbc:	48 89 e5             	mov    %rsp,%rbp
+  801dbf:	48 83 ec 38          	sub    $0x38,%rsp
+  801dc3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dc7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dcb:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801dce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801dd5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ddc:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801ddd:	eb 05                	jmp    801de4 <strtol+0x29>
+    s++;
+  801ddf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801de4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de8:	0f b6 00             	movzbl (%rax),%eax
+  801deb:	3c 20                	cmp    $0x20,%al
+  801ded:	74 f0                	je     801ddf <strtol+0x24>
+  801def:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df3:	0f b6 00             	movzbl (%rax),%eax
+  801df6:	3c 09                	cmp    $0x9,%al
+  801df8:	74 e5                	je     801ddf <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801dfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dfe:	0f b6 00             	movzbl (%rax),%eax
+  801e01:	3c 2b                	cmp    $0x2b,%al
+  801e03:	75 07                	jne    801e0c <strtol+0x51>
+    s++;
+  801e05:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e0a:	eb 17                	jmp    801e23 <strtol+0x68>
+  else if (*s == '-')
+  801e0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e10:	0f b6 00             	movzbl (%rax),%eax
+  801e13:	3c 2d                	cmp    $0x2d,%al
+  801e15:	75 0c                	jne    801e23 <strtol+0x68>
+    s++, neg = 1;
+  801e17:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e1c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e23:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e27:	74 06                	je     801e2f <strtol+0x74>
+  801e29:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801e2d:	75 28                	jne    801e57 <strtol+0x9c>
+  801e2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e33:	0f b6 00             	movzbl (%rax),%eax
+  801e36:	3c 30                	cmp    $0x30,%al
+  801e38:	75 1d                	jne    801e57 <strtol+0x9c>
+  801e3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3e:	48 83 c0 01          	add    $0x1,%rax
+  801e42:	0f b6 00             	movzbl (%rax),%eax
+  801e45:	3c 78                	cmp    $0x78,%al
+  801e47:	75 0e                	jne    801e57 <strtol+0x9c>
+    s += 2, base = 16;
+  801e49:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801e4e:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801e55:	eb 2c                	jmp    801e83 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801e57:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e5b:	75 19                	jne    801e76 <strtol+0xbb>
+  801e5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e61:	0f b6 00             	movzbl (%rax),%eax
+  801e64:	3c 30                	cmp    $0x30,%al
+  801e66:	75 0e                	jne    801e76 <strtol+0xbb>
+    s++, base = 8;
+  801e68:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e6d:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801e74:	eb 0d                	jmp    801e83 <strtol+0xc8>
+  else if (base == 0)
+  801e76:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e7a:	75 07                	jne    801e83 <strtol+0xc8>
+    base = 10;
+  801e7c:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801e83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e87:	0f b6 00             	movzbl (%rax),%eax
+  801e8a:	3c 2f                	cmp    $0x2f,%al
+  801e8c:	7e 1d                	jle    801eab <strtol+0xf0>
+  801e8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e92:	0f b6 00             	movzbl (%rax),%eax
+  801e95:	3c 39                	cmp    $0x39,%al
+  801e97:	7f 12                	jg     801eab <strtol+0xf0>
+      dig = *s - '0';
+  801e99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e9d:	0f b6 00             	movzbl (%rax),%eax
+  801ea0:	0f be c0             	movsbl %al,%eax
+  801ea3:	83 e8 30             	sub    $0x30,%eax
+  801ea6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ea9:	eb 4e                	jmp    801ef9 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801eab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eaf:	0f b6 00             	movzbl (%rax),%eax
+  801eb2:	3c 60                	cmp    $0x60,%al
+  801eb4:	7e 1d                	jle    801ed3 <strtol+0x118>
+  801eb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eba:	0f b6 00             	movzbl (%rax),%eax
+  801ebd:	3c 7a                	cmp    $0x7a,%al
+  801ebf:	7f 12                	jg     801ed3 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ec5:	0f b6 00             	movzbl (%rax),%eax
+  801ec8:	0f be c0             	movsbl %al,%eax
+  801ecb:	83 e8 57             	sub    $0x57,%eax
+  801ece:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ed1:	eb 26                	jmp    801ef9 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801ed3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed7:	0f b6 00             	movzbl (%rax),%eax
+  801eda:	3c 40                	cmp    $0x40,%al
+  801edc:	7e 47                	jle    801f25 <strtol+0x16a>
+  801ede:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee2:	0f b6 00             	movzbl (%rax),%eax
+  801ee5:	3c 5a                	cmp    $0x5a,%al
+  801ee7:	7f 3c                	jg     801f25 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801ee9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eed:	0f b6 00             	movzbl (%rax),%eax
+  801ef0:	0f be c0             	movsbl %al,%eax
+  801ef3:	83 e8 37             	sub    $0x37,%eax
+  801ef6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801ef9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801efc:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801eff:	7d 23                	jge    801f24 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801f01:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f06:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801f09:	48 98                	cltq
+  801f0b:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801f10:	48 89 c2             	mov    %rax,%rdx
+  801f13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f16:	48 98                	cltq
+  801f18:	48 01 d0             	add    %rdx,%rax
+  801f1b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801f1f:	e9 5f ff ff ff       	jmp    801e83 <strtol+0xc8>
+      break;
+  801f24:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801f25:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f2a:	74 0b                	je     801f37 <strtol+0x17c>
+    *endptr = (char *)s;
+  801f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f30:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801f34:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801f37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f3b:	74 09                	je     801f46 <strtol+0x18b>
+  801f3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f41:	48 f7 d8             	neg    %rax
+  801f44:	eb 04                	jmp    801f4a <strtol+0x18f>
+  801f46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801f4a:	c9                   	leave
+  801f4b:	c3                   	ret
+
+0000000000801f4c <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801f4c:	55                   	push   %rbp
+  801f4d:	48 89 e5             	mov    %rsp,%rbp
+  801f50:	53                   	push   %rbx
+  801f51:	48 83 ec 48          	sub    $0x48,%rsp
+  801f55:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f59:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f5d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f61:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801f65:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801f69:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801f6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f71:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f75:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f79:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801f7d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f81:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f85:	4c 89 c3             	mov    %r8,%rbx
+  801f88:	cd 30                	int    $0x30
+  801f8a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f8e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f93:	74 46                	je     801fdb <syscall+0x8f>
+  801f95:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f9a:	7e 3f                	jle    801fdb <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801fa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa4:	49 89 d0             	mov    %rdx,%r8
+  801fa7:	48 89 c1             	mov    %rax,%rcx
+  801faa:	48 b8 e8 69 80 00 00 	movabs $0x8069e8,%rax
+  801fb1:	00 00 00 
+  801fb4:	48 89 c2             	mov    %rax,%rdx
+  801fb7:	be 22 00 00 00       	mov    $0x22,%esi
+  801fbc:	48 b8 07 6a 80 00 00 	movabs $0x806a07,%rax
+  801fc3:	00 00 00 
+  801fc6:	48 89 c7             	mov    %rax,%rdi
+  801fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fce:	49 b9 5f 02 80 00 00 	movabs $0x80025f,%r9
+  801fd5:	00 00 00 
+  801fd8:	41 ff d1             	call   *%r9
+
+  return ret;
+  801fdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801fdf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fe3:	c9                   	leave
+  801fe4:	c3                   	ret
+
+0000000000801fe5 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+  801fe9:	48 83 ec 10          	sub    $0x10,%rsp
+  801fed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ff1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ff5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ff9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ffd:	48 83 ec 08          	sub    $0x8,%rsp
+  802001:	6a 00                	push   $0x0
+  802003:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802009:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80200f:	48 89 d1             	mov    %rdx,%rcx
+  802012:	48 89 c2             	mov    %rax,%rdx
+  802015:	be 00 00 00 00       	mov    $0x0,%esi
+  80201a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201f:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+  80202b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80202f:	90                   	nop
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+
+0000000000802032 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802036:	48 83 ec 08          	sub    $0x8,%rsp
+  80203a:	6a 00                	push   $0x0
+  80203c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802052:	be 00 00 00 00       	mov    $0x0,%esi
+  802057:	bf 01 00 00 00       	mov    $0x1,%edi
+  80205c:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+  802068:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80206c:	c9                   	leave
+  80206d:	c3                   	ret
+
+000000000080206e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80206e:	55                   	push   %rbp
+  80206f:	48 89 e5             	mov    %rsp,%rbp
+  802072:	48 83 ec 10          	sub    $0x10,%rsp
+  802076:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802079:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80207c:	48 98                	cltq
+  80207e:	48 83 ec 08          	sub    $0x8,%rsp
+  802082:	6a 00                	push   $0x0
+  802084:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80208a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802095:	48 89 c2             	mov    %rax,%rdx
+  802098:	be 01 00 00 00       	mov    $0x1,%esi
+  80209d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020a2:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b2:	c9                   	leave
+  8020b3:	c3                   	ret
+
+00000000008020b4 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8020b4:	55                   	push   %rbp
+  8020b5:	48 89 e5             	mov    %rsp,%rbp
+  8020b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8020bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020c2:	48 98                	cltq
+  8020c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020db:	48 89 c2             	mov    %rax,%rdx
+  8020de:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020e8:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+  8020f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020f8:	90                   	nop
+  8020f9:	c9                   	leave
+  8020fa:	c3                   	ret
+
+00000000008020fb <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8020fb:	55                   	push   %rbp
+  8020fc:	48 89 e5             	mov    %rsp,%rbp
+  8020ff:	48 83 ec 20          	sub    $0x20,%rsp
+  802103:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802106:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80210a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80210d:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802110:	b8 05 00 00 00       	mov    $0x5,%eax
+  802115:	cd 30                	int    $0x30
+  802117:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80211b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80211f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802124:	7e 3d                	jle    802163 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802126:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80212a:	49 89 c0             	mov    %rax,%r8
+  80212d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802132:	48 b8 e8 69 80 00 00 	movabs $0x8069e8,%rax
+  802139:	00 00 00 
+  80213c:	48 89 c2             	mov    %rax,%rdx
+  80213f:	be 49 00 00 00       	mov    $0x49,%esi
+  802144:	48 b8 07 6a 80 00 00 	movabs $0x806a07,%rax
+  80214b:	00 00 00 
+  80214e:	48 89 c7             	mov    %rax,%rdi
+  802151:	b8 00 00 00 00       	mov    $0x0,%eax
+  802156:	49 b9 5f 02 80 00 00 	movabs $0x80025f,%r9
+  80215d:	00 00 00 
+  802160:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802163:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802168:	75 13                	jne    80217d <sys_env_wait+0x82>
+  80216a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80216f:	74 0c                	je     80217d <sys_env_wait+0x82>
+    *status = st;
+  802171:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802175:	89 c2                	mov    %eax,%edx
+  802177:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80217b:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80217d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802181:	c9                   	leave
+  802182:	c3                   	ret
+
+0000000000802183 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802183:	55                   	push   %rbp
+  802184:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802187:	48 83 ec 08          	sub    $0x8,%rsp
+  80218b:	6a 00                	push   $0x0
+  80218d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802193:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80219e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021ad:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bd:	c9                   	leave
+  8021be:	c3                   	ret
+
+00000000008021bf <sys_yield>:
+
+void
+sys_yield(void) {
+  8021bf:	55                   	push   %rbp
+  8021c0:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c7:	6a 00                	push   $0x0
+  8021c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021e9:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+  8021f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f9:	90                   	nop
+  8021fa:	c9                   	leave
+  8021fb:	c3                   	ret
+
+00000000008021fc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8021fc:	55                   	push   %rbp
+  8021fd:	48 89 e5             	mov    %rsp,%rbp
+  802200:	48 83 ec 20          	sub    $0x20,%rsp
+  802204:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802207:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80220b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80220e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802211:	48 63 c8             	movslq %eax,%rcx
+  802214:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802218:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80221b:	48 98                	cltq
+  80221d:	48 83 ec 08          	sub    $0x8,%rsp
+  802221:	6a 00                	push   $0x0
+  802223:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802229:	49 89 c8             	mov    %rcx,%r8
+  80222c:	48 89 d1             	mov    %rdx,%rcx
+  80222f:	48 89 c2             	mov    %rax,%rdx
+  802232:	be 01 00 00 00       	mov    $0x1,%esi
+  802237:	bf 06 00 00 00       	mov    $0x6,%edi
+  80223c:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802243:	00 00 00 
+  802246:	ff d0                	call   *%rax
+  802248:	48 83 c4 10          	add    $0x10,%rsp
+  80224c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80224f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+
+0000000000802254 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	48 83 ec 20          	sub    $0x20,%rsp
+  80225c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80225f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802263:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802266:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80226a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80226e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802271:	48 63 c8             	movslq %eax,%rcx
+  802274:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802278:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80227b:	48 63 f0             	movslq %eax,%rsi
+  80227e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802282:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802285:	48 98                	cltq
+  802287:	48 83 ec 08          	sub    $0x8,%rsp
+  80228b:	51                   	push   %rcx
+  80228c:	49 89 f9             	mov    %rdi,%r9
+  80228f:	49 89 f0             	mov    %rsi,%r8
+  802292:	48 89 d1             	mov    %rdx,%rcx
+  802295:	48 89 c2             	mov    %rax,%rdx
+  802298:	be 01 00 00 00       	mov    $0x1,%esi
+  80229d:	bf 07 00 00 00       	mov    $0x7,%edi
+  8022a2:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8022a9:	00 00 00 
+  8022ac:	ff d0                	call   *%rax
+  8022ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+00000000008022b4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+  8022b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022bc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8022c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022ca:	48 98                	cltq
+  8022cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d0:	6a 00                	push   $0x0
+  8022d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022de:	48 89 d1             	mov    %rdx,%rcx
+  8022e1:	48 89 c2             	mov    %rax,%rdx
+  8022e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022ee:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+
+0000000000802300 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+  802304:	48 83 ec 10          	sub    $0x10,%rsp
+  802308:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80230e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802311:	48 63 d0             	movslq %eax,%rdx
+  802314:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802317:	48 98                	cltq
+  802319:	48 83 ec 08          	sub    $0x8,%rsp
+  80231d:	6a 00                	push   $0x0
+  80231f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802325:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232b:	48 89 d1             	mov    %rdx,%rcx
+  80232e:	48 89 c2             	mov    %rax,%rdx
+  802331:	be 01 00 00 00       	mov    $0x1,%esi
+  802336:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80233b:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+000000000080234d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+  802351:	48 83 ec 10          	sub    $0x10,%rsp
+  802355:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802358:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80235c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802360:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802363:	48 98                	cltq
+  802365:	48 83 ec 08          	sub    $0x8,%rsp
+  802369:	6a 00                	push   $0x0
+  80236b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802377:	48 89 d1             	mov    %rdx,%rcx
+  80237a:	48 89 c2             	mov    %rax,%rdx
+  80237d:	be 01 00 00 00       	mov    $0x1,%esi
+  802382:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802387:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+  802393:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+
+0000000000802399 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+  80239d:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8023a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023af:	48 98                	cltq
+  8023b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b5:	6a 00                	push   $0x0
+  8023b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c3:	48 89 d1             	mov    %rdx,%rcx
+  8023c6:	48 89 c2             	mov    %rax,%rdx
+  8023c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ce:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023d3:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8023da:	00 00 00 
+  8023dd:	ff d0                	call   *%rax
+  8023df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e3:	c9                   	leave
+  8023e4:	c3                   	ret
+
+00000000008023e5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8023e5:	55                   	push   %rbp
+  8023e6:	48 89 e5             	mov    %rsp,%rbp
+  8023e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8023ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023f8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8023fb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023fe:	48 63 f0             	movslq %eax,%rsi
+  802401:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802405:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802409:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80240c:	48 98                	cltq
+  80240e:	48 83 ec 08          	sub    $0x8,%rsp
+  802412:	6a 00                	push   $0x0
+  802414:	49 89 f1             	mov    %rsi,%r9
+  802417:	49 89 c8             	mov    %rcx,%r8
+  80241a:	48 89 d1             	mov    %rdx,%rcx
+  80241d:	48 89 c2             	mov    %rax,%rdx
+  802420:	be 00 00 00 00       	mov    $0x0,%esi
+  802425:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80242a:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+  802436:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+
+000000000080243c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80243c:	55                   	push   %rbp
+  80243d:	48 89 e5             	mov    %rsp,%rbp
+  802440:	48 83 ec 10          	sub    $0x10,%rsp
+  802444:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80244c:	48 83 ec 08          	sub    $0x8,%rsp
+  802450:	6a 00                	push   $0x0
+  802452:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802458:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80245e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802463:	48 89 c2             	mov    %rax,%rdx
+  802466:	be 01 00 00 00       	mov    $0x1,%esi
+  80246b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802470:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+  80247c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802480:	c9                   	leave
+  802481:	c3                   	ret
+
+0000000000802482 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802482:	55                   	push   %rbp
+  802483:	48 89 e5             	mov    %rsp,%rbp
+  802486:	48 83 ec 10          	sub    $0x10,%rsp
+  80248a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80248e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802492:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80249a:	48 83 ec 08          	sub    $0x8,%rsp
+  80249e:	6a 00                	push   $0x0
+  8024a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024ac:	48 89 d1             	mov    %rdx,%rcx
+  8024af:	48 89 c2             	mov    %rax,%rdx
+  8024b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8024b7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024bc:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+  8024c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+00000000008024ce <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8024ce:	55                   	push   %rbp
+  8024cf:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8024d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d6:	6a 00                	push   $0x0
+  8024d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f3:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024f8:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+  802504:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802508:	c9                   	leave
+  802509:	c3                   	ret
+
+000000000080250a <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80250a:	55                   	push   %rbp
+  80250b:	48 89 e5             	mov    %rsp,%rbp
+  80250e:	48 83 ec 10          	sub    $0x10,%rsp
+  802512:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802516:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80251a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80251e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802522:	48 83 ec 08          	sub    $0x8,%rsp
+  802526:	6a 00                	push   $0x0
+  802528:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80252e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802534:	48 89 d1             	mov    %rdx,%rcx
+  802537:	48 89 c2             	mov    %rax,%rdx
+  80253a:	be 00 00 00 00       	mov    $0x0,%esi
+  80253f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802544:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+
+0000000000802556 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802556:	55                   	push   %rbp
+  802557:	48 89 e5             	mov    %rsp,%rbp
+  80255a:	48 83 ec 20          	sub    $0x20,%rsp
+  80255e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802562:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802566:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802569:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80256c:	48 63 c8             	movslq %eax,%rcx
+  80256f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802577:	48 83 ec 08          	sub    $0x8,%rsp
+  80257b:	6a 00                	push   $0x0
+  80257d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802583:	49 89 c8             	mov    %rcx,%r8
+  802586:	48 89 d1             	mov    %rdx,%rcx
+  802589:	48 89 c2             	mov    %rax,%rdx
+  80258c:	be 00 00 00 00       	mov    $0x0,%esi
+  802591:	bf 13 00 00 00       	mov    $0x13,%edi
+  802596:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  80259d:	00 00 00 
+  8025a0:	ff d0                	call   *%rax
+  8025a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+
+00000000008025a8 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8025b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025b4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8025b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8025bb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025bf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8025c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025d2:	49 89 c8             	mov    %rcx,%r8
+  8025d5:	48 89 d1             	mov    %rdx,%rcx
+  8025d8:	48 89 c2             	mov    %rax,%rdx
+  8025db:	be 00 00 00 00       	mov    $0x0,%esi
+  8025e0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8025e5:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+  8025f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f5:	c9                   	leave
+  8025f6:	c3                   	ret
+
+00000000008025f7 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802603:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802606:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802609:	48 63 d0             	movslq %eax,%rdx
+  80260c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802610:	48 83 ec 08          	sub    $0x8,%rsp
+  802614:	6a 00                	push   $0x0
+  802616:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80261c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802622:	48 89 d1             	mov    %rdx,%rcx
+  802625:	48 89 c2             	mov    %rax,%rdx
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+  80262d:	bf 15 00 00 00       	mov    $0x15,%edi
+  802632:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+  802648:	48 83 ec 20          	sub    $0x20,%rsp
+  80264c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802650:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802653:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802656:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80265a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80265e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802661:	48 63 c8             	movslq %eax,%rcx
+  802664:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802667:	48 63 d0             	movslq %eax,%rdx
+  80266a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80266e:	48 83 ec 08          	sub    $0x8,%rsp
+  802672:	6a 00                	push   $0x0
+  802674:	49 89 f1             	mov    %rsi,%r9
+  802677:	49 89 c8             	mov    %rcx,%r8
+  80267a:	48 89 d1             	mov    %rdx,%rcx
+  80267d:	48 89 c2             	mov    %rax,%rdx
+  802680:	be 00 00 00 00       	mov    $0x0,%esi
+  802685:	bf 16 00 00 00       	mov    $0x16,%edi
+  80268a:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269a:	c9                   	leave
+  80269b:	c3                   	ret
+
+000000000080269c <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80269c:	55                   	push   %rbp
+  80269d:	48 89 e5             	mov    %rsp,%rbp
+  8026a0:	48 83 ec 30          	sub    $0x30,%rsp
+  8026a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026b0:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8026b4:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8026b8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026bc:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8026c0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8026c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d0:	51                   	push   %rcx
+  8026d1:	49 89 f9             	mov    %rdi,%r9
+  8026d4:	49 89 f0             	mov    %rsi,%r8
+  8026d7:	48 89 d1             	mov    %rdx,%rcx
+  8026da:	48 89 c2             	mov    %rax,%rdx
+  8026dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e2:	bf 17 00 00 00       	mov    $0x17,%edi
+  8026e7:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f7:	c9                   	leave
+  8026f8:	c3                   	ret
+
+00000000008026f9 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8026f9:	55                   	push   %rbp
+  8026fa:	48 89 e5             	mov    %rsp,%rbp
+  8026fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802701:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802704:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802707:	48 98                	cltq
+  802709:	48 83 ec 08          	sub    $0x8,%rsp
+  80270d:	6a 00                	push   $0x0
+  80270f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802715:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802720:	48 89 c2             	mov    %rax,%rdx
+  802723:	be 00 00 00 00       	mov    $0x0,%esi
+  802728:	bf 18 00 00 00       	mov    $0x18,%edi
+  80272d:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802734:	00 00 00 
+  802737:	ff d0                	call   *%rax
+  802739:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80273d:	90                   	nop
+  80273e:	c9                   	leave
+  80273f:	c3                   	ret
+
+0000000000802740 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	48 83 ec 30          	sub    $0x30,%rsp
+  802748:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80274b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80274f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802753:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802756:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802759:	48 63 f0             	movslq %eax,%rsi
+  80275c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802760:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802764:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802767:	48 98                	cltq
+  802769:	48 83 ec 08          	sub    $0x8,%rsp
+  80276d:	6a 00                	push   $0x0
+  80276f:	49 89 f1             	mov    %rsi,%r9
+  802772:	49 89 c8             	mov    %rcx,%r8
+  802775:	48 89 d1             	mov    %rdx,%rcx
+  802778:	48 89 c2             	mov    %rax,%rdx
+  80277b:	be 01 00 00 00       	mov    $0x1,%esi
+  802780:	bf 19 00 00 00       	mov    $0x19,%edi
+  802785:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  80278c:	00 00 00 
+  80278f:	ff d0                	call   *%rax
+  802791:	48 83 c4 10          	add    $0x10,%rsp
+  802795:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802798:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80279b:	c9                   	leave
+  80279c:	c3                   	ret
+
+000000000080279d <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+  8027a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8027a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027ad:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8027b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027b3:	48 63 c8             	movslq %eax,%rcx
+  8027b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027be:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c2:	6a 00                	push   $0x0
+  8027c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ca:	49 89 c8             	mov    %rcx,%r8
+  8027cd:	48 89 d1             	mov    %rdx,%rcx
+  8027d0:	48 89 c2             	mov    %rax,%rdx
+  8027d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d8:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8027dd:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ed:	c9                   	leave
+  8027ee:	c3                   	ret
+
+00000000008027ef <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8027ef:	55                   	push   %rbp
+  8027f0:	48 89 e5             	mov    %rsp,%rbp
+  8027f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8027f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027ff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802803:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802807:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80280b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80280f:	48 83 ec 08          	sub    $0x8,%rsp
+  802813:	6a 00                	push   $0x0
+  802815:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80281b:	49 89 c8             	mov    %rcx,%r8
+  80281e:	48 89 d1             	mov    %rdx,%rcx
+  802821:	48 89 c2             	mov    %rax,%rdx
+  802824:	be 01 00 00 00       	mov    $0x1,%esi
+  802829:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80282e:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  802835:	00 00 00 
+  802838:	ff d0                	call   *%rax
+  80283a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80283e:	c9                   	leave
+  80283f:	c3                   	ret
+
+0000000000802840 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802840:	55                   	push   %rbp
+  802841:	48 89 e5             	mov    %rsp,%rbp
+  802844:	48 83 ec 30          	sub    $0x30,%rsp
+  802848:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80284c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802850:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802853:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802857:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80285b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80285e:	48 63 c8             	movslq %eax,%rcx
+  802861:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802869:	48 83 ec 08          	sub    $0x8,%rsp
+  80286d:	6a 00                	push   $0x0
+  80286f:	49 89 f1             	mov    %rsi,%r9
+  802872:	49 89 c8             	mov    %rcx,%r8
+  802875:	48 89 d1             	mov    %rdx,%rcx
+  802878:	48 89 c2             	mov    %rax,%rdx
+  80287b:	be 01 00 00 00       	mov    $0x1,%esi
+  802880:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802885:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  80288c:	00 00 00 
+  80288f:	ff d0                	call   *%rax
+  802891:	48 83 c4 10          	add    $0x10,%rsp
+  802895:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802898:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80289b:	c9                   	leave
+  80289c:	c3                   	ret
+
+000000000080289d <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+  8028a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8028a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028ab:	48 98                	cltq
+  8028ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b1:	6a 00                	push   $0x0
+  8028b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028c4:	48 89 c2             	mov    %rax,%rdx
+  8028c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028cc:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8028d1:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+  8028dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028e1:	c9                   	leave
+  8028e2:	c3                   	ret
+
+00000000008028e3 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  8028e3:	55                   	push   %rbp
+  8028e4:	48 89 e5             	mov    %rsp,%rbp
+  8028e7:	48 83 ec 40          	sub    $0x40,%rsp
+  8028eb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  8028ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028f3:	48 8b 00             	mov    (%rax),%rax
+  8028f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  8028fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802902:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80290a:	83 e0 02             	and    $0x2,%eax
+  80290d:	48 85 c0             	test   %rax,%rax
+  802910:	74 25                	je     802937 <pgfault+0x54>
+  802912:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802916:	48 c1 e8 0c          	shr    $0xc,%rax
+  80291a:	48 89 c2             	mov    %rax,%rdx
+  80291d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802924:	01 00 00 
+  802927:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80292b:	83 e0 02             	and    $0x2,%eax
+  80292e:	48 85 c0             	test   %rax,%rax
+  802931:	0f 85 fe 01 00 00    	jne    802b35 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80293b:	83 e0 02             	and    $0x2,%eax
+  80293e:	48 85 c0             	test   %rax,%rax
+  802941:	74 23                	je     802966 <pgfault+0x83>
+  802943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802947:	48 c1 e8 0c          	shr    $0xc,%rax
+  80294b:	48 89 c2             	mov    %rax,%rdx
+  80294e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802955:	01 00 00 
+  802958:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80295c:	25 00 08 00 00       	and    $0x800,%eax
+  802961:	48 85 c0             	test   %rax,%rax
+  802964:	75 3f                	jne    8029a5 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802966:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80296a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80296e:	49 89 d0             	mov    %rdx,%r8
+  802971:	48 89 c1             	mov    %rax,%rcx
+  802974:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  80297b:	00 00 00 
+  80297e:	48 89 c2             	mov    %rax,%rdx
+  802981:	be 26 00 00 00       	mov    $0x26,%esi
+  802986:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  80298d:	00 00 00 
+  802990:	48 89 c7             	mov    %rax,%rdi
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+  802998:	49 b9 5f 02 80 00 00 	movabs $0x80025f,%r9
+  80299f:	00 00 00 
+  8029a2:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  8029a5:	48 b8 94 57 80 00 00 	movabs $0x805794,%rax
+  8029ac:	00 00 00 
+  8029af:	ff d0                	call   *%rax
+  8029b1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  8029b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b9:	ba 07 00 00 00       	mov    $0x7,%edx
+  8029be:	48 89 c6             	mov    %rax,%rsi
+  8029c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029c6:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  8029cd:	00 00 00 
+  8029d0:	ff d0                	call   *%rax
+  8029d2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8029d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8029d9:	79 36                	jns    802a11 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  8029db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029de:	89 c1                	mov    %eax,%ecx
+  8029e0:	48 b8 58 6a 80 00 00 	movabs $0x806a58,%rax
+  8029e7:	00 00 00 
+  8029ea:	48 89 c2             	mov    %rax,%rdx
+  8029ed:	be 35 00 00 00       	mov    $0x35,%esi
+  8029f2:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  8029f9:	00 00 00 
+  8029fc:	48 89 c7             	mov    %rax,%rdi
+  8029ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a04:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802a0b:	00 00 00 
+  802a0e:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802a11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a15:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802a19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a1d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a23:	48 89 c1             	mov    %rax,%rcx
+  802a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a2f:	48 89 ce             	mov    %rcx,%rsi
+  802a32:	48 89 c7             	mov    %rax,%rdi
+  802a35:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  802a3c:	00 00 00 
+  802a3f:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802a41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a45:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a49:	48 89 c2             	mov    %rax,%rdx
+  802a4c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a53:	01 00 00 
+  802a56:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a5a:	25 00 08 00 00       	and    $0x800,%eax
+  802a5f:	48 85 c0             	test   %rax,%rax
+  802a62:	74 7a                	je     802ade <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a68:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a70:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a76:	48 89 c2             	mov    %rax,%rdx
+  802a79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a7d:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802a83:	48 89 d1             	mov    %rdx,%rcx
+  802a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8b:	48 89 c6             	mov    %rax,%rsi
+  802a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a93:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+  802a9f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802aa2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802aa6:	79 36                	jns    802ade <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802aa8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802aab:	89 c1                	mov    %eax,%ecx
+  802aad:	48 b8 80 6a 80 00 00 	movabs $0x806a80,%rax
+  802ab4:	00 00 00 
+  802ab7:	48 89 c2             	mov    %rax,%rdx
+  802aba:	be 42 00 00 00       	mov    $0x42,%esi
+  802abf:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802ac6:	00 00 00 
+  802ac9:	48 89 c7             	mov    %rax,%rdi
+  802acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad1:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802ad8:	00 00 00 
+  802adb:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802ade:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae2:	48 89 c6             	mov    %rax,%rsi
+  802ae5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aea:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  802af6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802af9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802afd:	79 37                	jns    802b36 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802aff:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802b02:	89 c1                	mov    %eax,%ecx
+  802b04:	48 b8 a8 6a 80 00 00 	movabs $0x806aa8,%rax
+  802b0b:	00 00 00 
+  802b0e:	48 89 c2             	mov    %rax,%rdx
+  802b11:	be 46 00 00 00       	mov    $0x46,%esi
+  802b16:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802b1d:	00 00 00 
+  802b20:	48 89 c7             	mov    %rax,%rdi
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b28:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802b2f:	00 00 00 
+  802b32:	41 ff d0             	call   *%r8
+    return;
+  802b35:	90                   	nop
+  }
+}
+  802b36:	c9                   	leave
+  802b37:	c3                   	ret
+
+0000000000802b38 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802b38:	55                   	push   %rbp
+  802b39:	48 89 e5             	mov    %rsp,%rbp
+  802b3c:	48 83 ec 30          	sub    $0x30,%rsp
+  802b40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b43:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802b47:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b4e:	01 00 00 
+  802b51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b59:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b5e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802b62:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  802b69:	00 00 00 
+  802b6c:	ff d0                	call   *%rax
+  802b6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802b71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b75:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b79:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802b7d:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b84:	01 00 00 
+  802b87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b8f:	25 00 04 00 00       	and    $0x400,%eax
+  802b94:	48 85 c0             	test   %rax,%rax
+  802b97:	74 7b                	je     802c14 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802b99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b9d:	89 c1                	mov    %eax,%ecx
+  802b9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ba3:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ba7:	48 89 c2             	mov    %rax,%rdx
+  802baa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bae:	48 c1 e0 0c          	shl    $0xc,%rax
+  802bb2:	48 89 c6             	mov    %rax,%rsi
+  802bb5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bb8:	41 89 c8             	mov    %ecx,%r8d
+  802bbb:	48 89 d1             	mov    %rdx,%rcx
+  802bbe:	89 c2                	mov    %eax,%edx
+  802bc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc5:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+  802bd1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bd4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bd8:	0f 89 da 00 00 00    	jns    802cb8 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802bde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802be1:	89 c1                	mov    %eax,%ecx
+  802be3:	48 b8 d0 6a 80 00 00 	movabs $0x806ad0,%rax
+  802bea:	00 00 00 
+  802bed:	48 89 c2             	mov    %rax,%rdx
+  802bf0:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802bf5:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802bfc:	00 00 00 
+  802bff:	48 89 c7             	mov    %rax,%rdi
+  802c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c07:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802c0e:	00 00 00 
+  802c11:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802c14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c18:	25 02 08 00 00       	and    $0x802,%eax
+  802c1d:	48 85 c0             	test   %rax,%rax
+  802c20:	74 6e                	je     802c90 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802c22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c26:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802c2c:	80 cc 08             	or     $0x8,%ah
+  802c2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802c33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c37:	89 c7                	mov    %eax,%edi
+  802c39:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c3d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c40:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802c44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c47:	41 89 f8             	mov    %edi,%r8d
+  802c4a:	89 c7                	mov    %eax,%edi
+  802c4c:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802c53:	00 00 00 
+  802c56:	ff d0                	call   *%rax
+  802c58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802c5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c5f:	79 05                	jns    802c66 <duppage+0x12e>
+      return r;
+  802c61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c64:	eb 55                	jmp    802cbb <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802c66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c6a:	89 c7                	mov    %eax,%edi
+  802c6c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c70:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c73:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802c77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7a:	41 89 f8             	mov    %edi,%r8d
+  802c7d:	89 c7                	mov    %eax,%edi
+  802c7f:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802c86:	00 00 00 
+  802c89:	ff d0                	call   *%rax
+  802c8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c8e:	eb 28                	jmp    802cb8 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802c90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c94:	89 c7                	mov    %eax,%edi
+  802c96:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c9a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c9d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ca1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ca4:	41 89 f8             	mov    %edi,%r8d
+  802ca7:	89 c7                	mov    %eax,%edi
+  802ca9:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802cb0:	00 00 00 
+  802cb3:	ff d0                	call   *%rax
+  802cb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802cb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802cbb:	c9                   	leave
+  802cbc:	c3                   	ret
+
+0000000000802cbd <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+  802cc1:	48 83 ec 20          	sub    $0x20,%rsp
+  802cc5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802ccc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cd0:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cd4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802cd8:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802cdf:	01 00 00 
+  802ce2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ce6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cea:	25 00 08 00 00       	and    $0x800,%eax
+  802cef:	48 85 c0             	test   %rax,%rax
+  802cf2:	74 0d                	je     802d01 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802cf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cf8:	0f b6 10             	movzbl (%rax),%edx
+  802cfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cff:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802d01:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d08:	01 00 00 
+  802d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d0f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d13:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d18:	89 c6                	mov    %eax,%esi
+  802d1a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802d1e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d25:	41 89 f0             	mov    %esi,%r8d
+  802d28:	48 89 c6             	mov    %rax,%rsi
+  802d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d30:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  802d37:	00 00 00 
+  802d3a:	ff d0                	call   *%rax
+}
+  802d3c:	c9                   	leave
+  802d3d:	c3                   	ret
+
+0000000000802d3e <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	48 83 ec 40          	sub    $0x40,%rsp
+  802d46:	89 f8                	mov    %edi,%eax
+  802d48:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802d4b:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  802d52:	00 00 00 
+  802d55:	48 89 c7             	mov    %rax,%rdi
+  802d58:	48 b8 46 5c 80 00 00 	movabs $0x805c46,%rax
+  802d5f:	00 00 00 
+  802d62:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802d64:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d69:	cd 30                	int    $0x30
+  802d6b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802d6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802d71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d78:	79 36                	jns    802db0 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802d7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d7d:	89 c1                	mov    %eax,%ecx
+  802d7f:	48 b8 fb 6a 80 00 00 	movabs $0x806afb,%rax
+  802d86:	00 00 00 
+  802d89:	48 89 c2             	mov    %rax,%rdx
+  802d8c:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802d91:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802d98:	00 00 00 
+  802d9b:	48 89 c7             	mov    %rax,%rdi
+  802d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da3:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802daa:	00 00 00 
+  802dad:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802db0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802db4:	75 0a                	jne    802dc0 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbb:	e9 d3 02 00 00       	jmp    803093 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802dc0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802dc7:	00 
+  802dc8:	e9 7a 01 00 00       	jmp    802f47 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802dcd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dd5:	48 c1 e8 27          	shr    $0x27,%rax
+  802dd9:	48 89 c2             	mov    %rax,%rdx
+  802ddc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802de3:	01 00 00 
+  802de6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dea:	83 e0 01             	and    $0x1,%eax
+  802ded:	48 85 c0             	test   %rax,%rax
+  802df0:	0f 84 4c 01 00 00    	je     802f42 <fork_common+0x204>
+  802df6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dfa:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dfe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e02:	48 89 c2             	mov    %rax,%rdx
+  802e05:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802e0c:	01 00 00 
+  802e0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e13:	83 e0 01             	and    $0x1,%eax
+  802e16:	48 85 c0             	test   %rax,%rax
+  802e19:	0f 84 23 01 00 00    	je     802f42 <fork_common+0x204>
+  802e1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e23:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e27:	48 c1 e8 15          	shr    $0x15,%rax
+  802e2b:	48 89 c2             	mov    %rax,%rdx
+  802e2e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802e35:	01 00 00 
+  802e38:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e3c:	83 e0 01             	and    $0x1,%eax
+  802e3f:	48 85 c0             	test   %rax,%rax
+  802e42:	0f 84 fa 00 00 00    	je     802f42 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802e48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e4c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e50:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802e54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e58:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802e5f:	00 00 00 
+  802e62:	48 39 c2             	cmp    %rax,%rdx
+  802e65:	0f 82 d7 00 00 00    	jb     802f42 <fork_common+0x204>
+  802e6b:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802e72:	00 00 00 
+  802e75:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802e79:	0f 84 c3 00 00 00    	je     802f42 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802e7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e83:	48 89 c7             	mov    %rax,%rdi
+  802e86:	48 b8 50 57 80 00 00 	movabs $0x805750,%rax
+  802e8d:	00 00 00 
+  802e90:	ff d0                	call   *%rax
+  802e92:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802e95:	84 c0                	test   %al,%al
+  802e97:	0f 84 a5 00 00 00    	je     802f42 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802e9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ea1:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ea5:	48 89 c2             	mov    %rax,%rdx
+  802ea8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802eaf:	01 00 00 
+  802eb2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eb6:	83 e0 01             	and    $0x1,%eax
+  802eb9:	48 85 c0             	test   %rax,%rax
+  802ebc:	0f 84 80 00 00 00    	je     802f42 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802ec2:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802ec6:	74 4a                	je     802f12 <fork_common+0x1d4>
+  802ec8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ecc:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802ed3:	00 00 00 
+  802ed6:	48 39 c2             	cmp    %rax,%rdx
+  802ed9:	73 13                	jae    802eee <fork_common+0x1b0>
+  802edb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802edf:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802ee6:	00 00 00 
+  802ee9:	48 39 c2             	cmp    %rax,%rdx
+  802eec:	73 24                	jae    802f12 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802eee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ef2:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef6:	48 89 c2             	mov    %rax,%rdx
+  802ef9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802efc:	48 89 d6             	mov    %rdx,%rsi
+  802eff:	89 c7                	mov    %eax,%edi
+  802f01:	48 b8 bd 2c 80 00 00 	movabs $0x802cbd,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f10:	eb 22                	jmp    802f34 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802f12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f16:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f1a:	48 89 c2             	mov    %rax,%rdx
+  802f1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f20:	48 89 d6             	mov    %rdx,%rsi
+  802f23:	89 c7                	mov    %eax,%edi
+  802f25:	48 b8 38 2b 80 00 00 	movabs $0x802b38,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802f34:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f38:	79 08                	jns    802f42 <fork_common+0x204>
+            return r;
+  802f3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f3d:	e9 51 01 00 00       	jmp    803093 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802f42:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802f47:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802f4e:	07 
+  802f4f:	0f 86 78 fe ff ff    	jbe    802dcd <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802f55:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f5c:	00 00 00 
+  802f5f:	8b 40 04             	mov    0x4(%rax),%eax
+  802f62:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f67:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f6e:	00 00 00 
+  802f71:	48 98                	cltq
+  802f73:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f7a:	48 01 d0             	add    %rdx,%rax
+  802f7d:	48 05 00 01 00 00    	add    $0x100,%rax
+  802f83:	48 8b 10             	mov    (%rax),%rdx
+  802f86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f89:	48 89 d6             	mov    %rdx,%rsi
+  802f8c:	89 c7                	mov    %eax,%edi
+  802f8e:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+  802f9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fa1:	79 36                	jns    802fd9 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802fa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fa6:	89 c1                	mov    %eax,%ecx
+  802fa8:	48 b8 10 6b 80 00 00 	movabs $0x806b10,%rax
+  802faf:	00 00 00 
+  802fb2:	48 89 c2             	mov    %rax,%rdx
+  802fb5:	be be 00 00 00       	mov    $0xbe,%esi
+  802fba:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802fc1:	00 00 00 
+  802fc4:	48 89 c7             	mov    %rax,%rdi
+  802fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcc:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  802fd3:	00 00 00 
+  802fd6:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fdc:	ba 02 00 00 00       	mov    $0x2,%edx
+  802fe1:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802fe8:	00 00 00 
+  802feb:	48 89 ce             	mov    %rcx,%rsi
+  802fee:	89 c7                	mov    %eax,%edi
+  802ff0:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+  802ffc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803003:	79 36                	jns    80303b <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803005:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803008:	89 c1                	mov    %eax,%ecx
+  80300a:	48 b8 40 6b 80 00 00 	movabs $0x806b40,%rax
+  803011:	00 00 00 
+  803014:	48 89 c2             	mov    %rax,%rdx
+  803017:	be c1 00 00 00       	mov    $0xc1,%esi
+  80301c:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  803023:	00 00 00 
+  803026:	48 89 c7             	mov    %rax,%rdi
+  803029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302e:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  803035:	00 00 00 
+  803038:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  80303b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80303e:	be 02 00 00 00       	mov    $0x2,%esi
+  803043:	89 c7                	mov    %eax,%edi
+  803045:	48 b8 00 23 80 00 00 	movabs $0x802300,%rax
+  80304c:	00 00 00 
+  80304f:	ff d0                	call   *%rax
+  803051:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803054:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803058:	79 36                	jns    803090 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  80305a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80305d:	89 c1                	mov    %eax,%ecx
+  80305f:	48 b8 60 6b 80 00 00 	movabs $0x806b60,%rax
+  803066:	00 00 00 
+  803069:	48 89 c2             	mov    %rax,%rdx
+  80306c:	be d4 00 00 00       	mov    $0xd4,%esi
+  803071:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  803078:	00 00 00 
+  80307b:	48 89 c7             	mov    %rax,%rdi
+  80307e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803083:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  80308a:	00 00 00 
+  80308d:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803090:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+
+0000000000803095 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803095:	55                   	push   %rbp
+  803096:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803099:	bf 00 00 00 00       	mov    $0x0,%edi
+  80309e:	48 b8 3e 2d 80 00 00 	movabs $0x802d3e,%rax
+  8030a5:	00 00 00 
+  8030a8:	ff d0                	call   *%rax
+}
+  8030aa:	5d                   	pop    %rbp
+  8030ab:	c3                   	ret
+
+00000000008030ac <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  8030ac:	55                   	push   %rbp
+  8030ad:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  8030b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8030b5:	48 b8 3e 2d 80 00 00 	movabs $0x802d3e,%rax
+  8030bc:	00 00 00 
+  8030bf:	ff d0                	call   *%rax
+}
+  8030c1:	5d                   	pop    %rbp
+  8030c2:	c3                   	ret
+
+00000000008030c3 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8030c3:	55                   	push   %rbp
+  8030c4:	48 89 e5             	mov    %rsp,%rbp
+  8030c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8030cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8030cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8030d3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8030d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8030db:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8030df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030e3:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8030ea:	48 89 c7             	mov    %rax,%rdi
+  8030ed:	48 b8 fb 30 80 00 00 	movabs $0x8030fb,%rax
+  8030f4:	00 00 00 
+  8030f7:	ff d0                	call   *%rax
+}
+  8030f9:	c9                   	leave
+  8030fa:	c3                   	ret
+
+00000000008030fb <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8030fb:	55                   	push   %rbp
+  8030fc:	48 89 e5             	mov    %rsp,%rbp
+  8030ff:	48 83 ec 30          	sub    $0x30,%rsp
+  803103:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803107:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80310b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80310f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  803113:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803118:	75 0e                	jne    803128 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  80311a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803121:	00 00 00 
+  803124:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  803128:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80312d:	75 18                	jne    803147 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  80312f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803133:	48 89 c7             	mov    %rax,%rdi
+  803136:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  80313d:	00 00 00 
+  803140:	ff d0                	call   *%rax
+  803142:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803145:	eb 1d                	jmp    803164 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  803147:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80314b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80314f:	48 89 d6             	mov    %rdx,%rsi
+  803152:	48 89 c7             	mov    %rax,%rdi
+  803155:	48 b8 82 24 80 00 00 	movabs $0x802482,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+  803161:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  803164:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803168:	79 2a                	jns    803194 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  80316a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80316f:	74 0a                	je     80317b <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  803171:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803175:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  80317b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803180:	74 0a                	je     80318c <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  803182:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803186:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  80318c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80318f:	e9 aa 00 00 00       	jmp    80323e <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  803194:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803199:	74 36                	je     8031d1 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  80319b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031a2:	00 00 00 
+  8031a5:	8b 40 04             	mov    0x4(%rax),%eax
+  8031a8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031ad:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031b4:	00 00 00 
+  8031b7:	48 98                	cltq
+  8031b9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031c0:	48 01 d0             	add    %rdx,%rax
+  8031c3:	48 05 24 01 00 00    	add    $0x124,%rax
+  8031c9:	8b 10                	mov    (%rax),%edx
+  8031cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031cf:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8031d1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8031d6:	74 36                	je     80320e <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8031d8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031df:	00 00 00 
+  8031e2:	8b 40 04             	mov    0x4(%rax),%eax
+  8031e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031ea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031f1:	00 00 00 
+  8031f4:	48 98                	cltq
+  8031f6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031fd:	48 01 d0             	add    %rdx,%rax
+  803200:	48 05 28 01 00 00    	add    $0x128,%rax
+  803206:	8b 10                	mov    (%rax),%edx
+  803208:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80320c:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80320e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803215:	00 00 00 
+  803218:	8b 40 04             	mov    0x4(%rax),%eax
+  80321b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803220:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803227:	00 00 00 
+  80322a:	48 98                	cltq
+  80322c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803233:	48 01 d0             	add    %rdx,%rax
+  803236:	48 05 20 01 00 00    	add    $0x120,%rax
+  80323c:	8b 00                	mov    (%rax),%eax
+  }
+}
+  80323e:	c9                   	leave
+  80323f:	c3                   	ret
+
+0000000000803240 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  803240:	55                   	push   %rbp
+  803241:	48 89 e5             	mov    %rsp,%rbp
+  803244:	48 83 ec 30          	sub    $0x30,%rsp
+  803248:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80324b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80324e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803252:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  803255:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80325a:	75 5e                	jne    8032ba <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  80325c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803263:	00 00 00 
+  803266:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80326a:	eb 4e                	jmp    8032ba <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  80326c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803270:	79 3c                	jns    8032ae <ipc_send+0x6e>
+  803272:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  803276:	74 36                	je     8032ae <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  803278:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80327b:	89 c1                	mov    %eax,%ecx
+  80327d:	48 b8 88 6b 80 00 00 	movabs $0x806b88,%rax
+  803284:	00 00 00 
+  803287:	48 89 c2             	mov    %rax,%rdx
+  80328a:	be 54 00 00 00       	mov    $0x54,%esi
+  80328f:	48 b8 ae 6b 80 00 00 	movabs $0x806bae,%rax
+  803296:	00 00 00 
+  803299:	48 89 c7             	mov    %rax,%rdi
+  80329c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a1:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  8032a8:	00 00 00 
+  8032ab:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8032ae:	48 b8 bf 21 80 00 00 	movabs $0x8021bf,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8032ba:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8032bd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8032c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8032c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032c7:	89 c7                	mov    %eax,%edi
+  8032c9:	48 b8 e5 23 80 00 00 	movabs $0x8023e5,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+  8032d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032dc:	75 8e                	jne    80326c <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8032de:	48 b8 bf 21 80 00 00 	movabs $0x8021bf,%rax
+  8032e5:	00 00 00 
+  8032e8:	ff d0                	call   *%rax
+}
+  8032ea:	90                   	nop
+  8032eb:	c9                   	leave
+  8032ec:	c3                   	ret
+
+00000000008032ed <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8032ed:	55                   	push   %rbp
+  8032ee:	48 89 e5             	mov    %rsp,%rbp
+  8032f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8032f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032ff:	eb 4d                	jmp    80334e <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  803301:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803308:	00 00 00 
+  80330b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80330e:	48 98                	cltq
+  803310:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803317:	48 01 d0             	add    %rdx,%rax
+  80331a:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  803320:	8b 00                	mov    (%rax),%eax
+  803322:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803325:	75 23                	jne    80334a <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  803327:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80332e:	00 00 00 
+  803331:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803334:	48 98                	cltq
+  803336:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80333d:	48 01 d0             	add    %rdx,%rax
+  803340:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803346:	8b 00                	mov    (%rax),%eax
+  803348:	eb 12                	jmp    80335c <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80334a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80334e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803355:	7e aa                	jle    803301 <ipc_find_env+0x14>
+  return 0;
+  803357:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80335c:	c9                   	leave
+  80335d:	c3                   	ret
+
+000000000080335e <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80335e:	55                   	push   %rbp
+  80335f:	48 89 e5             	mov    %rsp,%rbp
+  803362:	48 83 ec 08          	sub    $0x8,%rsp
+  803366:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80336a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803375:	ff ff ff 
+  803378:	48 01 d0             	add    %rdx,%rax
+  80337b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80337f:	c9                   	leave
+  803380:	c3                   	ret
+
+0000000000803381 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803381:	55                   	push   %rbp
+  803382:	48 89 e5             	mov    %rsp,%rbp
+  803385:	48 83 ec 08          	sub    $0x8,%rsp
+  803389:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80338d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803391:	48 89 c7             	mov    %rax,%rdi
+  803394:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  80339b:	00 00 00 
+  80339e:	ff d0                	call   *%rax
+  8033a0:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8033a6:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8033aa:	c9                   	leave
+  8033ab:	c3                   	ret
+
+00000000008033ac <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8033ac:	55                   	push   %rbp
+  8033ad:	48 89 e5             	mov    %rsp,%rbp
+  8033b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8033b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8033b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8033bf:	e9 ae 00 00 00       	jmp    803472 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8033c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033c7:	c1 e0 0c             	shl    $0xc,%eax
+  8033ca:	48 98                	cltq
+  8033cc:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033d1:	48 01 d0             	add    %rdx,%rax
+  8033d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8033d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033dc:	48 c1 e8 27          	shr    $0x27,%rax
+  8033e0:	48 89 c2             	mov    %rax,%rdx
+  8033e3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033ea:	01 00 00 
+  8033ed:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f1:	83 e0 01             	and    $0x1,%eax
+  8033f4:	48 85 c0             	test   %rax,%rax
+  8033f7:	74 63                	je     80345c <fd_alloc+0xb0>
+  8033f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033fd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803401:	48 89 c2             	mov    %rax,%rdx
+  803404:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80340b:	01 00 00 
+  80340e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803412:	83 e0 01             	and    $0x1,%eax
+  803415:	48 85 c0             	test   %rax,%rax
+  803418:	74 42                	je     80345c <fd_alloc+0xb0>
+  80341a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80341e:	48 c1 e8 15          	shr    $0x15,%rax
+  803422:	48 89 c2             	mov    %rax,%rdx
+  803425:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80342c:	01 00 00 
+  80342f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803433:	83 e0 01             	and    $0x1,%eax
+  803436:	48 85 c0             	test   %rax,%rax
+  803439:	74 21                	je     80345c <fd_alloc+0xb0>
+  80343b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80343f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803443:	48 89 c2             	mov    %rax,%rdx
+  803446:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80344d:	01 00 00 
+  803450:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803454:	83 e0 01             	and    $0x1,%eax
+  803457:	48 85 c0             	test   %rax,%rax
+  80345a:	75 12                	jne    80346e <fd_alloc+0xc2>
+      *fd_store = fd;
+  80345c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803460:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803464:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  803467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346c:	eb 1e                	jmp    80348c <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80346e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803472:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803476:	0f 8e 48 ff ff ff    	jle    8033c4 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80347c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803480:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803487:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+
+000000000080348e <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80348e:	55                   	push   %rbp
+  80348f:	48 89 e5             	mov    %rsp,%rbp
+  803492:	48 83 ec 20          	sub    $0x20,%rsp
+  803496:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803499:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80349d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034a1:	78 06                	js     8034a9 <fd_lookup+0x1b>
+  8034a3:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8034a7:	7e 0a                	jle    8034b3 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8034a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034ae:	e9 af 00 00 00       	jmp    803562 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8034b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034b6:	c1 e0 0c             	shl    $0xc,%eax
+  8034b9:	48 98                	cltq
+  8034bb:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8034c0:	48 01 d0             	add    %rdx,%rax
+  8034c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8034c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034cb:	48 c1 e8 27          	shr    $0x27,%rax
+  8034cf:	48 89 c2             	mov    %rax,%rdx
+  8034d2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8034d9:	01 00 00 
+  8034dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e0:	83 e0 01             	and    $0x1,%eax
+  8034e3:	48 85 c0             	test   %rax,%rax
+  8034e6:	74 63                	je     80354b <fd_lookup+0xbd>
+  8034e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034f0:	48 89 c2             	mov    %rax,%rdx
+  8034f3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8034fa:	01 00 00 
+  8034fd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803501:	83 e0 01             	and    $0x1,%eax
+  803504:	48 85 c0             	test   %rax,%rax
+  803507:	74 42                	je     80354b <fd_lookup+0xbd>
+  803509:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80350d:	48 c1 e8 15          	shr    $0x15,%rax
+  803511:	48 89 c2             	mov    %rax,%rdx
+  803514:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80351b:	01 00 00 
+  80351e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803522:	83 e0 01             	and    $0x1,%eax
+  803525:	48 85 c0             	test   %rax,%rax
+  803528:	74 21                	je     80354b <fd_lookup+0xbd>
+  80352a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80352e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803532:	48 89 c2             	mov    %rax,%rdx
+  803535:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80353c:	01 00 00 
+  80353f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803543:	83 e0 01             	and    $0x1,%eax
+  803546:	48 85 c0             	test   %rax,%rax
+  803549:	75 07                	jne    803552 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80354b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803550:	eb 10                	jmp    803562 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803552:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803556:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80355a:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80355d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803562:	c9                   	leave
+  803563:	c3                   	ret
+
+0000000000803564 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803564:	55                   	push   %rbp
+  803565:	48 89 e5             	mov    %rsp,%rbp
+  803568:	48 83 ec 30          	sub    $0x30,%rsp
+  80356c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803570:	89 f0                	mov    %esi,%eax
+  803572:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803575:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803579:	48 89 c7             	mov    %rax,%rdi
+  80357c:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+  803588:	89 c2                	mov    %eax,%edx
+  80358a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80358e:	48 89 c6             	mov    %rax,%rsi
+  803591:	89 d7                	mov    %edx,%edi
+  803593:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+  80359f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035a6:	78 0a                	js     8035b2 <fd_close+0x4e>
+  8035a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035ac:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8035b0:	74 12                	je     8035c4 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8035b2:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8035b6:	74 05                	je     8035bd <fd_close+0x59>
+  8035b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035bb:	eb 70                	jmp    80362d <fd_close+0xc9>
+  8035bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c2:	eb 69                	jmp    80362d <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8035c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035c8:	8b 00                	mov    (%rax),%eax
+  8035ca:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8035ce:	48 89 d6             	mov    %rdx,%rsi
+  8035d1:	89 c7                	mov    %eax,%edi
+  8035d3:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035e6:	78 2a                	js     803612 <fd_close+0xae>
+    if (dev->dev_close)
+  8035e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035ec:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8035f0:	48 85 c0             	test   %rax,%rax
+  8035f3:	74 16                	je     80360b <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8035f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035f9:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8035fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803601:	48 89 c7             	mov    %rax,%rdi
+  803604:	ff d2                	call   *%rdx
+  803606:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803609:	eb 07                	jmp    803612 <fd_close+0xae>
+    else
+      r = 0;
+  80360b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803612:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803616:	48 89 c6             	mov    %rax,%rsi
+  803619:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361e:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+  return r;
+  80362a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80362d:	c9                   	leave
+  80362e:	c3                   	ret
+
+000000000080362f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80362f:	55                   	push   %rbp
+  803630:	48 89 e5             	mov    %rsp,%rbp
+  803633:	48 83 ec 20          	sub    $0x20,%rsp
+  803637:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80363a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  80363e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803645:	eb 3f                	jmp    803686 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803647:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80364e:	00 00 00 
+  803651:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803654:	48 98                	cltq
+  803656:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80365a:	8b 00                	mov    (%rax),%eax
+  80365c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80365f:	75 21                	jne    803682 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803661:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803668:	00 00 00 
+  80366b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80366e:	48 98                	cltq
+  803670:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803674:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803678:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80367b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803680:	eb 7f                	jmp    803701 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803682:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803686:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80368d:	00 00 00 
+  803690:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803693:	48 98                	cltq
+  803695:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803699:	48 85 c0             	test   %rax,%rax
+  80369c:	75 a9                	jne    803647 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80369e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8036a5:	00 00 00 
+  8036a8:	8b 40 04             	mov    0x4(%rax),%eax
+  8036ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036b0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8036b7:	00 00 00 
+  8036ba:	48 98                	cltq
+  8036bc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036c3:	48 01 d0             	add    %rdx,%rax
+  8036c6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8036cc:	8b 00                	mov    (%rax),%eax
+  8036ce:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036d1:	89 c6                	mov    %eax,%esi
+  8036d3:	48 b8 b8 6b 80 00 00 	movabs $0x806bb8,%rax
+  8036da:	00 00 00 
+  8036dd:	48 89 c7             	mov    %rax,%rdi
+  8036e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e5:	48 b9 7e 04 80 00 00 	movabs $0x80047e,%rcx
+  8036ec:	00 00 00 
+  8036ef:	ff d1                	call   *%rcx
+  *dev = 0;
+  8036f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036f5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8036fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803701:	c9                   	leave
+  803702:	c3                   	ret
+
+0000000000803703 <close>:
+
+int
+close(int fdnum) {
+  803703:	55                   	push   %rbp
+  803704:	48 89 e5             	mov    %rsp,%rbp
+  803707:	48 83 ec 20          	sub    $0x20,%rsp
+  80370b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80370e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803712:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803715:	48 89 d6             	mov    %rdx,%rsi
+  803718:	89 c7                	mov    %eax,%edi
+  80371a:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803721:	00 00 00 
+  803724:	ff d0                	call   *%rax
+  803726:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803729:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80372d:	79 05                	jns    803734 <close+0x31>
+    return r;
+  80372f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803732:	eb 18                	jmp    80374c <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803734:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803738:	be 01 00 00 00       	mov    $0x1,%esi
+  80373d:	48 89 c7             	mov    %rax,%rdi
+  803740:	48 b8 64 35 80 00 00 	movabs $0x803564,%rax
+  803747:	00 00 00 
+  80374a:	ff d0                	call   *%rax
+}
+  80374c:	c9                   	leave
+  80374d:	c3                   	ret
+
+000000000080374e <close_all>:
+
+void
+close_all(void) {
+  80374e:	55                   	push   %rbp
+  80374f:	48 89 e5             	mov    %rsp,%rbp
+  803752:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803756:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80375d:	eb 15                	jmp    803774 <close_all+0x26>
+    close(i);
+  80375f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803762:	89 c7                	mov    %eax,%edi
+  803764:	48 b8 03 37 80 00 00 	movabs $0x803703,%rax
+  80376b:	00 00 00 
+  80376e:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803770:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803774:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803778:	7e e5                	jle    80375f <close_all+0x11>
+}
+  80377a:	90                   	nop
+  80377b:	90                   	nop
+  80377c:	c9                   	leave
+  80377d:	c3                   	ret
+
+000000000080377e <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  80377e:	55                   	push   %rbp
+  80377f:	48 89 e5             	mov    %rsp,%rbp
+  803782:	48 83 ec 40          	sub    $0x40,%rsp
+  803786:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803789:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80378c:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803790:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803793:	48 89 d6             	mov    %rdx,%rsi
+  803796:	89 c7                	mov    %eax,%edi
+  803798:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  80379f:	00 00 00 
+  8037a2:	ff d0                	call   *%rax
+  8037a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037ab:	79 08                	jns    8037b5 <dup+0x37>
+    return r;
+  8037ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037b0:	e9 33 02 00 00       	jmp    8039e8 <dup+0x26a>
+  close(newfdnum);
+  8037b5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037b8:	89 c7                	mov    %eax,%edi
+  8037ba:	48 b8 03 37 80 00 00 	movabs $0x803703,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8037c6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037c9:	c1 e0 0c             	shl    $0xc,%eax
+  8037cc:	48 98                	cltq
+  8037ce:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8037d3:	48 01 d0             	add    %rdx,%rax
+  8037d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8037da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037de:	48 89 c7             	mov    %rax,%rdi
+  8037e1:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  8037e8:	00 00 00 
+  8037eb:	ff d0                	call   *%rax
+  8037ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8037f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037f5:	48 89 c7             	mov    %rax,%rdi
+  8037f8:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803808:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80380f:	00 
+  803810:	e9 19 01 00 00       	jmp    80392e <dup+0x1b0>
+    off -= PGSIZE;
+  803815:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80381c:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80381d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803821:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803825:	48 01 d0             	add    %rdx,%rax
+  803828:	48 c1 e8 27          	shr    $0x27,%rax
+  80382c:	48 89 c2             	mov    %rax,%rdx
+  80382f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803836:	01 00 00 
+  803839:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80383d:	83 e0 01             	and    $0x1,%eax
+  803840:	48 85 c0             	test   %rax,%rax
+  803843:	0f 84 e5 00 00 00    	je     80392e <dup+0x1b0>
+  803849:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80384d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803851:	48 01 d0             	add    %rdx,%rax
+  803854:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803858:	48 89 c2             	mov    %rax,%rdx
+  80385b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803862:	01 00 00 
+  803865:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803869:	83 e0 01             	and    $0x1,%eax
+  80386c:	48 85 c0             	test   %rax,%rax
+  80386f:	0f 84 b9 00 00 00    	je     80392e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803875:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80387d:	48 01 d0             	add    %rdx,%rax
+  803880:	48 c1 e8 15          	shr    $0x15,%rax
+  803884:	48 89 c2             	mov    %rax,%rdx
+  803887:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80388e:	01 00 00 
+  803891:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803895:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803898:	48 85 c0             	test   %rax,%rax
+  80389b:	0f 84 8d 00 00 00    	je     80392e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8038a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038a9:	48 01 d0             	add    %rdx,%rax
+  8038ac:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038b0:	48 89 c2             	mov    %rax,%rdx
+  8038b3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038ba:	01 00 00 
+  8038bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038c1:	83 e0 01             	and    $0x1,%eax
+  8038c4:	48 85 c0             	test   %rax,%rax
+  8038c7:	74 65                	je     80392e <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8038c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038d1:	48 01 d0             	add    %rdx,%rax
+  8038d4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038d8:	48 89 c2             	mov    %rax,%rdx
+  8038db:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038e2:	01 00 00 
+  8038e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038e9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038ee:	89 c6                	mov    %eax,%esi
+  8038f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038f8:	48 01 c2             	add    %rax,%rdx
+  8038fb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8038ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803903:	48 01 c8             	add    %rcx,%rax
+  803906:	41 89 f0             	mov    %esi,%r8d
+  803909:	48 89 d1             	mov    %rdx,%rcx
+  80390c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803911:	48 89 c6             	mov    %rax,%rsi
+  803914:	bf 00 00 00 00       	mov    $0x0,%edi
+  803919:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+  803925:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803928:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80392c:	78 60                	js     80398e <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80392e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803933:	0f 85 dc fe ff ff    	jne    803815 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803939:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80393d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803941:	48 89 c2             	mov    %rax,%rdx
+  803944:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80394b:	01 00 00 
+  80394e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803952:	25 07 0e 00 00       	and    $0xe07,%eax
+  803957:	89 c1                	mov    %eax,%ecx
+  803959:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80395d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803961:	41 89 c8             	mov    %ecx,%r8d
+  803964:	48 89 d1             	mov    %rdx,%rcx
+  803967:	ba 00 00 00 00       	mov    $0x0,%edx
+  80396c:	48 89 c6             	mov    %rax,%rsi
+  80396f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803974:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  80397b:	00 00 00 
+  80397e:	ff d0                	call   *%rax
+  803980:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803983:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803987:	78 08                	js     803991 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803989:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80398c:	eb 5a                	jmp    8039e8 <dup+0x26a>
+        goto err;
+  80398e:	90                   	nop
+  80398f:	eb 01                	jmp    803992 <dup+0x214>
+    goto err;
+  803991:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803996:	48 89 c6             	mov    %rax,%rsi
+  803999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80399e:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8039aa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8039b1:	00 
+  8039b2:	eb 27                	jmp    8039db <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8039b4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8039b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039bc:	48 01 d0             	add    %rdx,%rax
+  8039bf:	48 89 c6             	mov    %rax,%rsi
+  8039c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c7:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  8039ce:	00 00 00 
+  8039d1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8039d3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8039da:	00 
+  8039db:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8039e2:	00 
+  8039e3:	76 cf                	jbe    8039b4 <dup+0x236>
+  return r;
+  8039e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8039e8:	c9                   	leave
+  8039e9:	c3                   	ret
+
+00000000008039ea <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8039ea:	55                   	push   %rbp
+  8039eb:	48 89 e5             	mov    %rsp,%rbp
+  8039ee:	48 83 ec 40          	sub    $0x40,%rsp
+  8039f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039fd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a04:	48 89 d6             	mov    %rdx,%rsi
+  803a07:	89 c7                	mov    %eax,%edi
+  803a09:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a18:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a1c:	78 24                	js     803a42 <read+0x58>
+  803a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a22:	8b 00                	mov    (%rax),%eax
+  803a24:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a28:	48 89 d6             	mov    %rdx,%rsi
+  803a2b:	89 c7                	mov    %eax,%edi
+  803a2d:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  803a34:	00 00 00 
+  803a37:	ff d0                	call   *%rax
+  803a39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a40:	79 0a                	jns    803a4c <read+0x62>
+    return r;
+  803a42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a45:	48 98                	cltq
+  803a47:	e9 9e 00 00 00       	jmp    803aea <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803a4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a50:	8b 40 08             	mov    0x8(%rax),%eax
+  803a53:	83 e0 03             	and    $0x3,%eax
+  803a56:	83 f8 01             	cmp    $0x1,%eax
+  803a59:	75 5c                	jne    803ab7 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a5b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803a62:	00 00 00 
+  803a65:	8b 40 04             	mov    0x4(%rax),%eax
+  803a68:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a6d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a74:	00 00 00 
+  803a77:	48 98                	cltq
+  803a79:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a80:	48 01 d0             	add    %rdx,%rax
+  803a83:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a89:	8b 00                	mov    (%rax),%eax
+  803a8b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a8e:	89 c6                	mov    %eax,%esi
+  803a90:	48 b8 d7 6b 80 00 00 	movabs $0x806bd7,%rax
+  803a97:	00 00 00 
+  803a9a:	48 89 c7             	mov    %rax,%rdi
+  803a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa2:	48 b9 7e 04 80 00 00 	movabs $0x80047e,%rcx
+  803aa9:	00 00 00 
+  803aac:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803aae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ab5:	eb 33                	jmp    803aea <read+0x100>
+  }
+  if (!dev->dev_read)
+  803ab7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803abb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803abf:	48 85 c0             	test   %rax,%rax
+  803ac2:	75 09                	jne    803acd <read+0xe3>
+    return -E_NOT_SUPP;
+  803ac4:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803acb:	eb 1d                	jmp    803aea <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803acd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ad1:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803ad5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ad9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803add:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803ae1:	48 89 ce             	mov    %rcx,%rsi
+  803ae4:	48 89 c7             	mov    %rax,%rdi
+  803ae7:	41 ff d0             	call   *%r8
+}
+  803aea:	c9                   	leave
+  803aeb:	c3                   	ret
+
+0000000000803aec <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803aec:	55                   	push   %rbp
+  803aed:	48 89 e5             	mov    %rsp,%rbp
+  803af0:	48 83 ec 30          	sub    $0x30,%rsp
+  803af4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803af7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803afb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803aff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803b06:	eb 49                	jmp    803b51 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803b08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b0b:	48 98                	cltq
+  803b0d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b11:	48 29 c2             	sub    %rax,%rdx
+  803b14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b17:	48 63 c8             	movslq %eax,%rcx
+  803b1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b1e:	48 01 c1             	add    %rax,%rcx
+  803b21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b24:	48 89 ce             	mov    %rcx,%rsi
+  803b27:	89 c7                	mov    %eax,%edi
+  803b29:	48 b8 ea 39 80 00 00 	movabs $0x8039ea,%rax
+  803b30:	00 00 00 
+  803b33:	ff d0                	call   *%rax
+  803b35:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803b38:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803b3c:	79 07                	jns    803b45 <readn+0x59>
+      return m;
+  803b3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803b41:	48 98                	cltq
+  803b43:	eb 1f                	jmp    803b64 <readn+0x78>
+    if (m == 0)
+  803b45:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803b49:	74 13                	je     803b5e <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803b4b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803b4e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803b51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b54:	48 98                	cltq
+  803b56:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803b5a:	72 ac                	jb     803b08 <readn+0x1c>
+  803b5c:	eb 01                	jmp    803b5f <readn+0x73>
+      break;
+  803b5e:	90                   	nop
+  }
+  return tot;
+  803b5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b62:	48 98                	cltq
+}
+  803b64:	c9                   	leave
+  803b65:	c3                   	ret
+
+0000000000803b66 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803b66:	55                   	push   %rbp
+  803b67:	48 89 e5             	mov    %rsp,%rbp
+  803b6a:	48 83 ec 40          	sub    $0x40,%rsp
+  803b6e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803b75:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b79:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b80:	48 89 d6             	mov    %rdx,%rsi
+  803b83:	89 c7                	mov    %eax,%edi
+  803b85:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+  803b91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b98:	78 24                	js     803bbe <write+0x58>
+  803b9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b9e:	8b 00                	mov    (%rax),%eax
+  803ba0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ba4:	48 89 d6             	mov    %rdx,%rsi
+  803ba7:	89 c7                	mov    %eax,%edi
+  803ba9:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+  803bb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bbc:	79 0a                	jns    803bc8 <write+0x62>
+    return r;
+  803bbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bc1:	48 98                	cltq
+  803bc3:	e9 9d 00 00 00       	jmp    803c65 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803bc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bcc:	8b 40 08             	mov    0x8(%rax),%eax
+  803bcf:	83 e0 03             	and    $0x3,%eax
+  803bd2:	85 c0                	test   %eax,%eax
+  803bd4:	75 5c                	jne    803c32 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803bd6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803bdd:	00 00 00 
+  803be0:	8b 40 04             	mov    0x4(%rax),%eax
+  803be3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803be8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803bef:	00 00 00 
+  803bf2:	48 98                	cltq
+  803bf4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803bfb:	48 01 d0             	add    %rdx,%rax
+  803bfe:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c04:	8b 00                	mov    (%rax),%eax
+  803c06:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c09:	89 c6                	mov    %eax,%esi
+  803c0b:	48 b8 f3 6b 80 00 00 	movabs $0x806bf3,%rax
+  803c12:	00 00 00 
+  803c15:	48 89 c7             	mov    %rax,%rdi
+  803c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1d:	48 b9 7e 04 80 00 00 	movabs $0x80047e,%rcx
+  803c24:	00 00 00 
+  803c27:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c29:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c30:	eb 33                	jmp    803c65 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c36:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803c3a:	48 85 c0             	test   %rax,%rax
+  803c3d:	75 09                	jne    803c48 <write+0xe2>
+    return -E_NOT_SUPP;
+  803c3f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803c46:	eb 1d                	jmp    803c65 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803c48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c4c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803c50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c54:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c58:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803c5c:	48 89 ce             	mov    %rcx,%rsi
+  803c5f:	48 89 c7             	mov    %rax,%rdi
+  803c62:	41 ff d0             	call   *%r8
+}
+  803c65:	c9                   	leave
+  803c66:	c3                   	ret
+
+0000000000803c67 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803c67:	55                   	push   %rbp
+  803c68:	48 89 e5             	mov    %rsp,%rbp
+  803c6b:	48 83 ec 18          	sub    $0x18,%rsp
+  803c6f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c72:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c75:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c7c:	48 89 d6             	mov    %rdx,%rsi
+  803c7f:	89 c7                	mov    %eax,%edi
+  803c81:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803c88:	00 00 00 
+  803c8b:	ff d0                	call   *%rax
+  803c8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c94:	79 05                	jns    803c9b <seek+0x34>
+    return r;
+  803c96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c99:	eb 0f                	jmp    803caa <seek+0x43>
+  fd->fd_offset = offset;
+  803c9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c9f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803ca2:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803caa:	c9                   	leave
+  803cab:	c3                   	ret
+
+0000000000803cac <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803cac:	55                   	push   %rbp
+  803cad:	48 89 e5             	mov    %rsp,%rbp
+  803cb0:	48 83 ec 30          	sub    $0x30,%rsp
+  803cb4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803cb7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803cba:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803cbe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cc1:	48 89 d6             	mov    %rdx,%rsi
+  803cc4:	89 c7                	mov    %eax,%edi
+  803cc6:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803ccd:	00 00 00 
+  803cd0:	ff d0                	call   *%rax
+  803cd2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cd9:	78 24                	js     803cff <ftruncate+0x53>
+  803cdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cdf:	8b 00                	mov    (%rax),%eax
+  803ce1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ce5:	48 89 d6             	mov    %rdx,%rsi
+  803ce8:	89 c7                	mov    %eax,%edi
+  803cea:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  803cf1:	00 00 00 
+  803cf4:	ff d0                	call   *%rax
+  803cf6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cf9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cfd:	79 08                	jns    803d07 <ftruncate+0x5b>
+    return r;
+  803cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d02:	e9 92 00 00 00       	jmp    803d99 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803d07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d0b:	8b 40 08             	mov    0x8(%rax),%eax
+  803d0e:	83 e0 03             	and    $0x3,%eax
+  803d11:	85 c0                	test   %eax,%eax
+  803d13:	75 5a                	jne    803d6f <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803d15:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803d1c:	00 00 00 
+  803d1f:	8b 40 04             	mov    0x4(%rax),%eax
+  803d22:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803d27:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803d2e:	00 00 00 
+  803d31:	48 98                	cltq
+  803d33:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803d3a:	48 01 d0             	add    %rdx,%rax
+  803d3d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803d43:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803d45:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803d48:	89 c6                	mov    %eax,%esi
+  803d4a:	48 b8 10 6c 80 00 00 	movabs $0x806c10,%rax
+  803d51:	00 00 00 
+  803d54:	48 89 c7             	mov    %rax,%rdi
+  803d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d5c:	48 b9 7e 04 80 00 00 	movabs $0x80047e,%rcx
+  803d63:	00 00 00 
+  803d66:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d6d:	eb 2a                	jmp    803d99 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803d6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d73:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803d77:	48 85 c0             	test   %rax,%rax
+  803d7a:	75 07                	jne    803d83 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803d7c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d81:	eb 16                	jmp    803d99 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803d83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d87:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803d8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d8f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803d92:	89 d6                	mov    %edx,%esi
+  803d94:	48 89 c7             	mov    %rax,%rdi
+  803d97:	ff d1                	call   *%rcx
+}
+  803d99:	c9                   	leave
+  803d9a:	c3                   	ret
+
+0000000000803d9b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d9b:	55                   	push   %rbp
+  803d9c:	48 89 e5             	mov    %rsp,%rbp
+  803d9f:	48 83 ec 30          	sub    $0x30,%rsp
+  803da3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803da6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803daa:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803dae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803db1:	48 89 d6             	mov    %rdx,%rsi
+  803db4:	89 c7                	mov    %eax,%edi
+  803db6:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+  803dc2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dc5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dc9:	78 24                	js     803def <fstat+0x54>
+  803dcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dcf:	8b 00                	mov    (%rax),%eax
+  803dd1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803dd5:	48 89 d6             	mov    %rdx,%rsi
+  803dd8:	89 c7                	mov    %eax,%edi
+  803dda:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+  803de6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803de9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ded:	79 05                	jns    803df4 <fstat+0x59>
+    return r;
+  803def:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803df2:	eb 5e                	jmp    803e52 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803df4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803df8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803dfc:	48 85 c0             	test   %rax,%rax
+  803dff:	75 07                	jne    803e08 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803e01:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803e06:	eb 4a                	jmp    803e52 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803e08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e0c:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803e0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e13:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803e1a:	00 00 00 
+  stat->st_isdir   = 0;
+  803e1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e21:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803e28:	00 00 00 
+  stat->st_dev     = dev;
+  803e2b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e33:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803e3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e3e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e46:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e4a:	48 89 d6             	mov    %rdx,%rsi
+  803e4d:	48 89 c7             	mov    %rax,%rdi
+  803e50:	ff d1                	call   *%rcx
+}
+  803e52:	c9                   	leave
+  803e53:	c3                   	ret
+
+0000000000803e54 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803e54:	55                   	push   %rbp
+  803e55:	48 89 e5             	mov    %rsp,%rbp
+  803e58:	48 83 ec 10          	sub    $0x10,%rsp
+  803e5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e60:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803e64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e68:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e6e:	83 f8 20             	cmp    $0x20,%eax
+  803e71:	75 07                	jne    803e7a <pollwait_key+0x26>
+    return -E_INVAL;
+  803e73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e78:	eb 5f                	jmp    803ed9 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803e7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e7e:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803e84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e88:	48 63 d2             	movslq %edx,%rdx
+  803e8b:	48 c1 e2 04          	shl    $0x4,%rdx
+  803e8f:	48 01 c2             	add    %rax,%rdx
+  803e92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e96:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e9d:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803ea3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ea7:	8b 00                	mov    (%rax),%eax
+  803ea9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ead:	48 63 c9             	movslq %ecx,%rcx
+  803eb0:	48 c1 e1 04          	shl    $0x4,%rcx
+  803eb4:	48 01 ca             	add    %rcx,%rdx
+  803eb7:	48 83 c2 08          	add    $0x8,%rdx
+  803ebb:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803ebd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ec1:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803ec7:	8d 50 01             	lea    0x1(%rax),%edx
+  803eca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ece:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed9:	c9                   	leave
+  803eda:	c3                   	ret
+
+0000000000803edb <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803edb:	55                   	push   %rbp
+  803edc:	48 89 e5             	mov    %rsp,%rbp
+  803edf:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803ee6:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803eed:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803ef3:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803efa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803f01:	00 
+  int i, r, ready, ipc = 0;
+  803f02:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803f09:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803f10:	00 
+  803f11:	74 45                	je     803f58 <poll+0x7d>
+  803f13:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803f1a:	ff 
+  803f1b:	74 3b                	je     803f58 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803f1d:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  803f24:	00 00 00 
+  803f27:	ff d0                	call   *%rax
+  803f29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803f2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f31:	48 f7 d0             	not    %rax
+  803f34:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803f3b:	73 10                	jae    803f4d <poll+0x72>
+  803f3d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f41:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803f48:	48 01 d0             	add    %rdx,%rax
+  803f4b:	eb 07                	jmp    803f54 <poll+0x79>
+  803f4d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803f54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803f58:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803f5f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803f66:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803f6d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803f74:	e9 46 02 00 00       	jmp    8041bf <poll+0x2e4>
+      fds[i].revents = 0;
+  803f79:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f7c:	48 63 d0             	movslq %eax,%rdx
+  803f7f:	48 89 d0             	mov    %rdx,%rax
+  803f82:	48 01 c0             	add    %rax,%rax
+  803f85:	48 01 d0             	add    %rdx,%rax
+  803f88:	48 c1 e0 02          	shl    $0x2,%rax
+  803f8c:	48 89 c2             	mov    %rax,%rdx
+  803f8f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f96:	48 01 d0             	add    %rdx,%rax
+  803f99:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803fa0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fa3:	48 63 d0             	movslq %eax,%rdx
+  803fa6:	48 89 d0             	mov    %rdx,%rax
+  803fa9:	48 01 c0             	add    %rax,%rax
+  803fac:	48 01 d0             	add    %rdx,%rax
+  803faf:	48 c1 e0 02          	shl    $0x2,%rax
+  803fb3:	48 89 c2             	mov    %rax,%rdx
+  803fb6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fbd:	48 01 d0             	add    %rdx,%rax
+  803fc0:	8b 00                	mov    (%rax),%eax
+  803fc2:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803fc5:	75 62                	jne    804029 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803fc7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fca:	48 63 d0             	movslq %eax,%rdx
+  803fcd:	48 89 d0             	mov    %rdx,%rax
+  803fd0:	48 01 c0             	add    %rax,%rax
+  803fd3:	48 01 d0             	add    %rdx,%rax
+  803fd6:	48 c1 e0 02          	shl    $0x2,%rax
+  803fda:	48 89 c2             	mov    %rax,%rdx
+  803fdd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fe4:	48 01 d0             	add    %rdx,%rax
+  803fe7:	8b 40 04             	mov    0x4(%rax),%eax
+  803fea:	83 e0 01             	and    $0x1,%eax
+  803fed:	85 c0                	test   %eax,%eax
+  803fef:	0f 84 9b 01 00 00    	je     804190 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803ff5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ff8:	48 63 d0             	movslq %eax,%rdx
+  803ffb:	48 89 d0             	mov    %rdx,%rax
+  803ffe:	48 01 c0             	add    %rax,%rax
+  804001:	48 01 d0             	add    %rdx,%rax
+  804004:	48 c1 e0 02          	shl    $0x2,%rax
+  804008:	48 89 c2             	mov    %rax,%rdx
+  80400b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804012:	48 01 c2             	add    %rax,%rdx
+  804015:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804018:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80401b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80401e:	83 c8 04             	or     $0x4,%eax
+  804021:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  804024:	e9 67 01 00 00       	jmp    804190 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804029:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80402c:	48 63 d0             	movslq %eax,%rdx
+  80402f:	48 89 d0             	mov    %rdx,%rax
+  804032:	48 01 c0             	add    %rax,%rax
+  804035:	48 01 d0             	add    %rdx,%rax
+  804038:	48 c1 e0 02          	shl    $0x2,%rax
+  80403c:	48 89 c2             	mov    %rax,%rdx
+  80403f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804046:	48 01 d0             	add    %rdx,%rax
+  804049:	8b 00                	mov    (%rax),%eax
+  80404b:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804052:	48 89 d6             	mov    %rdx,%rsi
+  804055:	89 c7                	mov    %eax,%edi
+  804057:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+  804063:	85 c0                	test   %eax,%eax
+  804065:	78 25                	js     80408c <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  804067:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80406e:	8b 00                	mov    (%rax),%eax
+  804070:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804077:	48 89 d6             	mov    %rdx,%rsi
+  80407a:	89 c7                	mov    %eax,%edi
+  80407c:	48 b8 2f 36 80 00 00 	movabs $0x80362f,%rax
+  804083:	00 00 00 
+  804086:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804088:	85 c0                	test   %eax,%eax
+  80408a:	79 2c                	jns    8040b8 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80408c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80408f:	48 63 d0             	movslq %eax,%rdx
+  804092:	48 89 d0             	mov    %rdx,%rax
+  804095:	48 01 c0             	add    %rax,%rax
+  804098:	48 01 d0             	add    %rdx,%rax
+  80409b:	48 c1 e0 02          	shl    $0x2,%rax
+  80409f:	48 89 c2             	mov    %rax,%rdx
+  8040a2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040a9:	48 01 d0             	add    %rdx,%rax
+  8040ac:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8040b3:	e9 d8 00 00 00       	jmp    804190 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8040b8:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8040bf:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8040c3:	48 85 c0             	test   %rax,%rax
+  8040c6:	74 7d                	je     804145 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8040c8:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8040cf:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8040d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040d6:	48 63 d0             	movslq %eax,%rdx
+  8040d9:	48 89 d0             	mov    %rdx,%rax
+  8040dc:	48 01 c0             	add    %rax,%rax
+  8040df:	48 01 d0             	add    %rdx,%rax
+  8040e2:	48 c1 e0 02          	shl    $0x2,%rax
+  8040e6:	48 89 c2             	mov    %rax,%rdx
+  8040e9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040f0:	48 01 d0             	add    %rdx,%rax
+  8040f3:	8b 48 04             	mov    0x4(%rax),%ecx
+  8040f6:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8040fd:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  804104:	89 ce                	mov    %ecx,%esi
+  804106:	48 89 c7             	mov    %rax,%rdi
+  804109:	41 ff d0             	call   *%r8
+  80410c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80410f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804113:	79 08                	jns    80411d <poll+0x242>
+          return r;
+  804115:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804118:	e9 45 01 00 00       	jmp    804262 <poll+0x387>
+        fds[i].revents = r;
+  80411d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804120:	48 63 d0             	movslq %eax,%rdx
+  804123:	48 89 d0             	mov    %rdx,%rax
+  804126:	48 01 c0             	add    %rax,%rax
+  804129:	48 01 d0             	add    %rdx,%rax
+  80412c:	48 c1 e0 02          	shl    $0x2,%rax
+  804130:	48 89 c2             	mov    %rax,%rdx
+  804133:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80413a:	48 01 c2             	add    %rax,%rdx
+  80413d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804140:	89 42 08             	mov    %eax,0x8(%rdx)
+  804143:	eb 4b                	jmp    804190 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804145:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804148:	48 63 d0             	movslq %eax,%rdx
+  80414b:	48 89 d0             	mov    %rdx,%rax
+  80414e:	48 01 c0             	add    %rax,%rax
+  804151:	48 01 d0             	add    %rdx,%rax
+  804154:	48 c1 e0 02          	shl    $0x2,%rax
+  804158:	48 89 c2             	mov    %rax,%rdx
+  80415b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804162:	48 01 d0             	add    %rdx,%rax
+  804165:	8b 48 04             	mov    0x4(%rax),%ecx
+  804168:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80416b:	48 63 d0             	movslq %eax,%rdx
+  80416e:	48 89 d0             	mov    %rdx,%rax
+  804171:	48 01 c0             	add    %rax,%rax
+  804174:	48 01 d0             	add    %rdx,%rax
+  804177:	48 c1 e0 02          	shl    $0x2,%rax
+  80417b:	48 89 c2             	mov    %rax,%rdx
+  80417e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804185:	48 01 d0             	add    %rdx,%rax
+  804188:	83 e1 03             	and    $0x3,%ecx
+  80418b:	89 ca                	mov    %ecx,%edx
+  80418d:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804190:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804193:	48 63 d0             	movslq %eax,%rdx
+  804196:	48 89 d0             	mov    %rdx,%rax
+  804199:	48 01 c0             	add    %rax,%rax
+  80419c:	48 01 d0             	add    %rdx,%rax
+  80419f:	48 c1 e0 02          	shl    $0x2,%rax
+  8041a3:	48 89 c2             	mov    %rax,%rdx
+  8041a6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041ad:	48 01 d0             	add    %rdx,%rax
+  8041b0:	8b 40 08             	mov    0x8(%rax),%eax
+  8041b3:	85 c0                	test   %eax,%eax
+  8041b5:	74 04                	je     8041bb <poll+0x2e0>
+        ready++;
+  8041b7:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8041bb:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8041bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041c2:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8041c8:	0f 8c ab fd ff ff    	jl     803f79 <poll+0x9e>
+    }
+    if (ready)
+  8041ce:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8041d2:	74 08                	je     8041dc <poll+0x301>
+      return ready;
+  8041d4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8041d7:	e9 86 00 00 00       	jmp    804262 <poll+0x387>
+
+    if (deadline) {
+  8041dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8041e1:	74 30                	je     804213 <poll+0x338>
+      now     = vsys_clock_ns();
+  8041e3:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+  8041ef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8041f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041f7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8041fb:	73 0a                	jae    804207 <poll+0x32c>
+  8041fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804201:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804205:	eb 05                	jmp    80420c <poll+0x331>
+  804207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420c:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  804213:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804216:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804219:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804220:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804227:	48 89 c7             	mov    %rax,%rdi
+  80422a:	48 b8 44 26 80 00 00 	movabs $0x802644,%rax
+  804231:	00 00 00 
+  804234:	ff d0                	call   *%rax
+  804236:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804239:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80423d:	75 07                	jne    804246 <poll+0x36b>
+      return 0;
+  80423f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804244:	eb 1c                	jmp    804262 <poll+0x387>
+    if (r < 0)
+  804246:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80424a:	79 05                	jns    804251 <poll+0x376>
+      return r;
+  80424c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80424f:	eb 11                	jmp    804262 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804251:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804254:	c1 f8 02             	sar    $0x2,%eax
+  804257:	83 e0 01             	and    $0x1,%eax
+  80425a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80425d:	e9 f6 fc ff ff       	jmp    803f58 <poll+0x7d>
+  }
+}
+  804262:	c9                   	leave
+  804263:	c3                   	ret
+
+0000000000804264 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804264:	55                   	push   %rbp
+  804265:	48 89 e5             	mov    %rsp,%rbp
+  804268:	48 83 ec 20          	sub    $0x20,%rsp
+  80426c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804270:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804274:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804278:	be 00 00 00 00       	mov    $0x0,%esi
+  80427d:	48 89 c7             	mov    %rax,%rdi
+  804280:	48 b8 52 43 80 00 00 	movabs $0x804352,%rax
+  804287:	00 00 00 
+  80428a:	ff d0                	call   *%rax
+  80428c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80428f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804293:	79 05                	jns    80429a <stat+0x36>
+    return fd;
+  804295:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804298:	eb 2f                	jmp    8042c9 <stat+0x65>
+  r = fstat(fd, stat);
+  80429a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80429e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042a1:	48 89 d6             	mov    %rdx,%rsi
+  8042a4:	89 c7                	mov    %eax,%edi
+  8042a6:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  8042ad:	00 00 00 
+  8042b0:	ff d0                	call   *%rax
+  8042b2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8042b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042b8:	89 c7                	mov    %eax,%edi
+  8042ba:	48 b8 03 37 80 00 00 	movabs $0x803703,%rax
+  8042c1:	00 00 00 
+  8042c4:	ff d0                	call   *%rax
+  return r;
+  8042c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8042c9:	c9                   	leave
+  8042ca:	c3                   	ret
+
+00000000008042cb <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8042cb:	55                   	push   %rbp
+  8042cc:	48 89 e5             	mov    %rsp,%rbp
+  8042cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8042d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8042d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8042da:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042e1:	00 00 00 
+  8042e4:	8b 00                	mov    (%rax),%eax
+  8042e6:	85 c0                	test   %eax,%eax
+  8042e8:	75 1d                	jne    804307 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8042ef:	48 b8 ed 32 80 00 00 	movabs $0x8032ed,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+  8042fb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804302:	00 00 00 
+  804305:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804307:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80430e:	00 00 00 
+  804311:	8b 00                	mov    (%rax),%eax
+  804313:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804316:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80431b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804322:	00 00 00 
+  804325:	89 c7                	mov    %eax,%edi
+  804327:	48 b8 40 32 80 00 00 	movabs $0x803240,%rax
+  80432e:	00 00 00 
+  804331:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80433c:	48 89 c6             	mov    %rax,%rsi
+  80433f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804344:	48 b8 c3 30 80 00 00 	movabs $0x8030c3,%rax
+  80434b:	00 00 00 
+  80434e:	ff d0                	call   *%rax
+}
+  804350:	c9                   	leave
+  804351:	c3                   	ret
+
+0000000000804352 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804352:	55                   	push   %rbp
+  804353:	48 89 e5             	mov    %rsp,%rbp
+  804356:	48 83 ec 20          	sub    $0x20,%rsp
+  80435a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80435e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804365:	48 89 c7             	mov    %rax,%rdi
+  804368:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+  804374:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804379:	7e 0a                	jle    804385 <open+0x33>
+    return -E_BAD_PATH;
+  80437b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804380:	e9 a8 00 00 00       	jmp    80442d <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804385:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804389:	48 89 c7             	mov    %rax,%rdi
+  80438c:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  804393:	00 00 00 
+  804396:	ff d0                	call   *%rax
+  804398:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80439b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80439f:	79 08                	jns    8043a9 <open+0x57>
+    return r;
+  8043a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043a4:	e9 84 00 00 00       	jmp    80442d <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8043a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ad:	48 89 c6             	mov    %rax,%rsi
+  8043b0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8043b7:	00 00 00 
+  8043ba:	48 89 c7             	mov    %rax,%rdi
+  8043bd:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  8043c4:	00 00 00 
+  8043c7:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8043c9:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043d0:	00 00 00 
+  8043d3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8043d6:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8043dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e0:	48 89 c6             	mov    %rax,%rsi
+  8043e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043e8:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+  8043f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043fb:	79 1d                	jns    80441a <open+0xc8>
+    fd_close(fd, 0);
+  8043fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804401:	be 00 00 00 00       	mov    $0x0,%esi
+  804406:	48 89 c7             	mov    %rax,%rdi
+  804409:	48 b8 64 35 80 00 00 	movabs $0x803564,%rax
+  804410:	00 00 00 
+  804413:	ff d0                	call   *%rax
+    return r;
+  804415:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804418:	eb 13                	jmp    80442d <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80441a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441e:	48 89 c7             	mov    %rax,%rdi
+  804421:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  804428:	00 00 00 
+  80442b:	ff d0                	call   *%rax
+}
+  80442d:	c9                   	leave
+  80442e:	c3                   	ret
+
+000000000080442f <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80442f:	55                   	push   %rbp
+  804430:	48 89 e5             	mov    %rsp,%rbp
+  804433:	48 83 ec 10          	sub    $0x10,%rsp
+  804437:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80443b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80443f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804442:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804449:	00 00 00 
+  80444c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80444e:	be 00 00 00 00       	mov    $0x0,%esi
+  804453:	bf 06 00 00 00       	mov    $0x6,%edi
+  804458:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  80445f:	00 00 00 
+  804462:	ff d0                	call   *%rax
+}
+  804464:	c9                   	leave
+  804465:	c3                   	ret
+
+0000000000804466 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804466:	55                   	push   %rbp
+  804467:	48 89 e5             	mov    %rsp,%rbp
+  80446a:	48 83 ec 30          	sub    $0x30,%rsp
+  80446e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804472:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804476:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80447a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80447f:	74 07                	je     804488 <devfile_read+0x22>
+  804481:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804486:	75 0a                	jne    804492 <devfile_read+0x2c>
+  return E_INVAL;
+  804488:	b8 03 00 00 00       	mov    $0x3,%eax
+  80448d:	e9 b4 00 00 00       	jmp    804546 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804492:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804499:	00 
+  while (n) {
+  80449a:	e9 98 00 00 00       	jmp    804537 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80449f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044a3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044a6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044ad:	00 00 00 
+  8044b0:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8044b2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044b9:	00 00 00 
+  8044bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c0:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8044c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8044c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044ce:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8044d5:	00 00 00 
+  8044d8:	ff d0                	call   *%rax
+  8044da:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8044dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8044e1:	7f 13                	jg     8044f6 <devfile_read+0x90>
+      return res ? res : res0;
+  8044e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8044e7:	74 07                	je     8044f0 <devfile_read+0x8a>
+  8044e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044ec:	48 98                	cltq
+  8044ee:	eb 56                	jmp    804546 <devfile_read+0xe0>
+  8044f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044f4:	eb 50                	jmp    804546 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8044f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044f9:	48 63 d0             	movslq %eax,%rdx
+  8044fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804500:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804507:	00 00 00 
+  80450a:	48 89 ce             	mov    %rcx,%rsi
+  80450d:	48 89 c7             	mov    %rax,%rdi
+  804510:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  804517:	00 00 00 
+  80451a:	ff d0                	call   *%rax
+
+    buf += res;
+  80451c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80451f:	48 98                	cltq
+  804521:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804525:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804528:	48 98                	cltq
+  80452a:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  80452e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804531:	48 98                	cltq
+  804533:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804537:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80453c:	0f 85 5d ff ff ff    	jne    80449f <devfile_read+0x39>
+  }
+
+  return res0;
+  804542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804546:	c9                   	leave
+  804547:	c3                   	ret
+
+0000000000804548 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804548:	55                   	push   %rbp
+  804549:	48 89 e5             	mov    %rsp,%rbp
+  80454c:	48 83 ec 50          	sub    $0x50,%rsp
+  804550:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804554:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804558:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80455c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804561:	74 07                	je     80456a <devfile_write+0x22>
+  804563:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804568:	75 0a                	jne    804574 <devfile_write+0x2c>
+  return E_INVAL;
+  80456a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80456f:	e9 c9 00 00 00       	jmp    80463d <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804574:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80457b:	00 
+
+  while (n) {
+  80457c:	e9 ad 00 00 00       	jmp    80462e <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804581:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804585:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804589:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804590:	00 
+  804591:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804595:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804599:	48 39 c2             	cmp    %rax,%rdx
+  80459c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8045a0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8045a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8045a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045ac:	48 89 c6             	mov    %rax,%rsi
+  8045af:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8045b6:	00 00 00 
+  8045b9:	48 89 c7             	mov    %rax,%rdi
+  8045bc:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  8045c3:	00 00 00 
+  8045c6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8045c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045cc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045cf:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045d6:	00 00 00 
+  8045d9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8045db:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045e2:	00 00 00 
+  8045e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8045ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8045f2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8045f7:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8045fe:	00 00 00 
+  804601:	ff d0                	call   *%rax
+  804603:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804606:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80460a:	79 07                	jns    804613 <devfile_write+0xcb>
+      return res;
+  80460c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80460f:	48 98                	cltq
+  804611:	eb 2a                	jmp    80463d <devfile_write+0xf5>
+
+    buf += res;
+  804613:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804616:	48 98                	cltq
+  804618:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80461c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80461f:	48 98                	cltq
+  804621:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804625:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804628:	48 98                	cltq
+  80462a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80462e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804633:	0f 85 48 ff ff ff    	jne    804581 <devfile_write+0x39>
+  }
+
+  return res0;
+  804639:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80463d:	c9                   	leave
+  80463e:	c3                   	ret
+
+000000000080463f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	48 83 ec 20          	sub    $0x20,%rsp
+  804647:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80464b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80464f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804653:	8b 40 0c             	mov    0xc(%rax),%eax
+  804656:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80465d:	00 00 00 
+  804660:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804662:	be 00 00 00 00       	mov    $0x0,%esi
+  804667:	bf 05 00 00 00       	mov    $0x5,%edi
+  80466c:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  804673:	00 00 00 
+  804676:	ff d0                	call   *%rax
+  804678:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80467b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80467f:	79 05                	jns    804686 <devfile_stat+0x47>
+    return r;
+  804681:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804684:	eb 59                	jmp    8046df <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804686:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80468a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804691:	00 00 00 
+  804694:	48 89 d6             	mov    %rdx,%rsi
+  804697:	48 89 c7             	mov    %rax,%rdi
+  80469a:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  8046a1:	00 00 00 
+  8046a4:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8046a6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8046ad:	00 00 00 
+  8046b0:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8046b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046ba:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8046c0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8046c7:	00 00 00 
+  8046ca:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8046d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046d4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8046da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046df:	c9                   	leave
+  8046e0:	c3                   	ret
+
+00000000008046e1 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8046e1:	55                   	push   %rbp
+  8046e2:	48 89 e5             	mov    %rsp,%rbp
+  8046e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8046e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046ed:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8046f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046f4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8046f7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046fe:	00 00 00 
+  804701:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804703:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80470a:	00 00 00 
+  80470d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804710:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804713:	be 00 00 00 00       	mov    $0x0,%esi
+  804718:	bf 02 00 00 00       	mov    $0x2,%edi
+  80471d:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  804724:	00 00 00 
+  804727:	ff d0                	call   *%rax
+}
+  804729:	c9                   	leave
+  80472a:	c3                   	ret
+
+000000000080472b <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80472b:	55                   	push   %rbp
+  80472c:	48 89 e5             	mov    %rsp,%rbp
+  80472f:	48 83 ec 18          	sub    $0x18,%rsp
+  804733:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804737:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80473a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  80473e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804741:	83 e0 03             	and    $0x3,%eax
+}
+  804744:	c9                   	leave
+  804745:	c3                   	ret
+
+0000000000804746 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804746:	55                   	push   %rbp
+  804747:	48 89 e5             	mov    %rsp,%rbp
+  80474a:	48 83 ec 10          	sub    $0x10,%rsp
+  80474e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804752:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804756:	48 89 c7             	mov    %rax,%rdi
+  804759:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  804760:	00 00 00 
+  804763:	ff d0                	call   *%rax
+  804765:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80476a:	7e 07                	jle    804773 <remove+0x2d>
+    return -E_BAD_PATH;
+  80476c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804771:	eb 36                	jmp    8047a9 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804777:	48 89 c6             	mov    %rax,%rsi
+  80477a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804781:	00 00 00 
+  804784:	48 89 c7             	mov    %rax,%rdi
+  804787:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  80478e:	00 00 00 
+  804791:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804793:	be 00 00 00 00       	mov    $0x0,%esi
+  804798:	bf 07 00 00 00       	mov    $0x7,%edi
+  80479d:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8047a4:	00 00 00 
+  8047a7:	ff d0                	call   *%rax
+}
+  8047a9:	c9                   	leave
+  8047aa:	c3                   	ret
+
+00000000008047ab <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8047ab:	55                   	push   %rbp
+  8047ac:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8047af:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8047b9:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8047c0:	00 00 00 
+  8047c3:	ff d0                	call   *%rax
+}
+  8047c5:	5d                   	pop    %rbp
+  8047c6:	c3                   	ret
+
+00000000008047c7 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8047c7:	55                   	push   %rbp
+  8047c8:	48 89 e5             	mov    %rsp,%rbp
+  8047cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8047cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8047d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8047d8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8047dd:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  8047e4:	00 00 00 
+  8047e7:	ff d0                	call   *%rax
+  8047e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047f0:	79 05                	jns    8047f7 <fs_stats+0x30>
+    return r;
+  8047f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047f5:	eb 2a                	jmp    804821 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8047f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047fb:	ba 68 00 00 00       	mov    $0x68,%edx
+  804800:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804807:	00 00 00 
+  80480a:	48 89 ce             	mov    %rcx,%rsi
+  80480d:	48 89 c7             	mov    %rax,%rdi
+  804810:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  804817:	00 00 00 
+  80481a:	ff d0                	call   *%rax
+  return 0;
+  80481c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804821:	c9                   	leave
+  804822:	c3                   	ret
+
+0000000000804823 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804823:	55                   	push   %rbp
+  804824:	48 89 e5             	mov    %rsp,%rbp
+  804827:	48 83 ec 10          	sub    $0x10,%rsp
+  80482b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80482e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804835:	00 00 00 
+  804838:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80483b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80483d:	be 00 00 00 00       	mov    $0x0,%esi
+  804842:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804847:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  80484e:	00 00 00 
+  804851:	ff d0                	call   *%rax
+}
+  804853:	c9                   	leave
+  804854:	c3                   	ret
+
+0000000000804855 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804855:	55                   	push   %rbp
+  804856:	48 89 e5             	mov    %rsp,%rbp
+  804859:	48 83 ec 10          	sub    $0x10,%rsp
+  80485d:	89 f8                	mov    %edi,%eax
+  80485f:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804862:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804866:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80486d:	00 00 00 
+  804870:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804872:	be 00 00 00 00       	mov    $0x0,%esi
+  804877:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80487c:	48 b8 cb 42 80 00 00 	movabs $0x8042cb,%rax
+  804883:	00 00 00 
+  804886:	ff d0                	call   *%rax
+}
+  804888:	c9                   	leave
+  804889:	c3                   	ret
+
+000000000080488a <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80488a:	55                   	push   %rbp
+  80488b:	48 89 e5             	mov    %rsp,%rbp
+  80488e:	48 83 ec 10          	sub    $0x10,%rsp
+  804892:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80489a:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80489f:	48 89 c7             	mov    %rax,%rdi
+  8048a2:	48 b8 b0 48 80 00 00 	movabs $0x8048b0,%rax
+  8048a9:	00 00 00 
+  8048ac:	ff d0                	call   *%rax
+}
+  8048ae:	c9                   	leave
+  8048af:	c3                   	ret
+
+00000000008048b0 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8048b0:	55                   	push   %rbp
+  8048b1:	48 89 e5             	mov    %rsp,%rbp
+  8048b4:	48 83 ec 50          	sub    $0x50,%rsp
+  8048b8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8048bc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8048c0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8048c7:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8048c8:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8048cd:	74 0a                	je     8048d9 <pipe_size+0x29>
+  8048cf:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8048d6:	00 
+  8048d7:	76 0a                	jbe    8048e3 <pipe_size+0x33>
+    return -E_INVAL;
+  8048d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8048de:	e9 cc 02 00 00       	jmp    804baf <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8048e3:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8048e7:	48 89 c7             	mov    %rax,%rdi
+  8048ea:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8048f1:	00 00 00 
+  8048f4:	ff d0                	call   *%rax
+  8048f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048fd:	0f 88 a8 02 00 00    	js     804bab <pipe_size+0x2fb>
+  804903:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804907:	ba 07 04 00 00       	mov    $0x407,%edx
+  80490c:	48 89 c6             	mov    %rax,%rsi
+  80490f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804914:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  80491b:	00 00 00 
+  80491e:	ff d0                	call   *%rax
+  804920:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804923:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804927:	0f 88 7e 02 00 00    	js     804bab <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80492d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804931:	48 89 c7             	mov    %rax,%rdi
+  804934:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  80493b:	00 00 00 
+  80493e:	ff d0                	call   *%rax
+  804940:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804943:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804947:	0f 88 43 02 00 00    	js     804b90 <pipe_size+0x2e0>
+  80494d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804951:	ba 07 04 00 00       	mov    $0x407,%edx
+  804956:	48 89 c6             	mov    %rax,%rsi
+  804959:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495e:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  804965:	00 00 00 
+  804968:	ff d0                	call   *%rax
+  80496a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80496d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804971:	0f 88 19 02 00 00    	js     804b90 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804977:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80497b:	48 89 c7             	mov    %rax,%rdi
+  80497e:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804985:	00 00 00 
+  804988:	ff d0                	call   *%rax
+  80498a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80498e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804995:	00 
+  804996:	e9 a2 00 00 00       	jmp    804a3d <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80499b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80499f:	48 c1 e0 0c          	shl    $0xc,%rax
+  8049a3:	48 89 c2             	mov    %rax,%rdx
+  8049a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049aa:	48 01 d0             	add    %rdx,%rax
+  8049ad:	ba 07 04 00 00       	mov    $0x407,%edx
+  8049b2:	48 89 c6             	mov    %rax,%rsi
+  8049b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ba:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  8049c1:	00 00 00 
+  8049c4:	ff d0                	call   *%rax
+  8049c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049cd:	0f 88 37 01 00 00    	js     804b0a <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8049d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049d7:	48 89 c7             	mov    %rax,%rdi
+  8049da:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  8049e1:	00 00 00 
+  8049e4:	ff d0                	call   *%rax
+  8049e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049ea:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8049ee:	48 01 c2             	add    %rax,%rdx
+  8049f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8049f9:	48 89 c1             	mov    %rax,%rcx
+  8049fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a00:	48 01 c8             	add    %rcx,%rax
+  804a03:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804a09:	48 89 d1             	mov    %rdx,%rcx
+  804a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a11:	48 89 c6             	mov    %rax,%rsi
+  804a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a19:	48 b8 54 22 80 00 00 	movabs $0x802254,%rax
+  804a20:	00 00 00 
+  804a23:	ff d0                	call   *%rax
+  804a25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a2c:	79 0a                	jns    804a38 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804a2e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804a33:	e9 d3 00 00 00       	jmp    804b0b <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804a38:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804a3d:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804a44:	00 
+  804a45:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804a49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a4d:	48 01 d0             	add    %rdx,%rax
+  804a50:	48 83 c0 1f          	add    $0x1f,%rax
+  804a54:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804a58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a61:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804a65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a69:	48 29 d0             	sub    %rdx,%rax
+  804a6c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a70:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804a74:	0f 82 21 ff ff ff    	jb     80499b <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a7e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804a82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a86:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804a8a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804a8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a92:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a99:	00 00 00 
+  804a9c:	8b 12                	mov    (%rdx),%edx
+  804a9e:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aa4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804aab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aaf:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804ab6:	00 00 00 
+  804ab9:	8b 12                	mov    (%rdx),%edx
+  804abb:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804abd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ac1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804ac8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804acc:	48 89 c7             	mov    %rax,%rdi
+  804acf:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  804ad6:	00 00 00 
+  804ad9:	ff d0                	call   *%rax
+  804adb:	89 c2                	mov    %eax,%edx
+  804add:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804ae1:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804ae3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ae7:	48 89 c7             	mov    %rax,%rdi
+  804aea:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  804af1:	00 00 00 
+  804af4:	ff d0                	call   *%rax
+  804af6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804afa:	48 83 c2 04          	add    $0x4,%rdx
+  804afe:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b05:	e9 a5 00 00 00       	jmp    804baf <pipe_size+0x2ff>
+      goto err2;
+  804b0a:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804b0b:	eb 58                	jmp    804b65 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804b0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b11:	48 c1 e0 0c          	shl    $0xc,%rax
+  804b15:	48 89 c2             	mov    %rax,%rdx
+  804b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b1c:	48 01 d0             	add    %rdx,%rax
+  804b1f:	48 89 c6             	mov    %rax,%rsi
+  804b22:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b27:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  804b2e:	00 00 00 
+  804b31:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804b33:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b37:	48 89 c7             	mov    %rax,%rdi
+  804b3a:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804b41:	00 00 00 
+  804b44:	ff d0                	call   *%rax
+  804b46:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b4a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804b4e:	48 01 d0             	add    %rdx,%rax
+  804b51:	48 89 c6             	mov    %rax,%rsi
+  804b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b59:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  804b60:	00 00 00 
+  804b63:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b69:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804b6d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804b71:	48 85 c0             	test   %rax,%rax
+  804b74:	75 97                	jne    804b0d <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804b76:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b7a:	48 89 c6             	mov    %rax,%rsi
+  804b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b82:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  804b89:	00 00 00 
+  804b8c:	ff d0                	call   *%rax
+  804b8e:	eb 01                	jmp    804b91 <pipe_size+0x2e1>
+    goto err1;
+  804b90:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804b91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b95:	48 89 c6             	mov    %rax,%rsi
+  804b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b9d:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  804ba4:	00 00 00 
+  804ba7:	ff d0                	call   *%rax
+  804ba9:	eb 01                	jmp    804bac <pipe_size+0x2fc>
+    goto err;
+  804bab:	90                   	nop
+err:
+  return r;
+  804bac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804baf:	c9                   	leave
+  804bb0:	c3                   	ret
+
+0000000000804bb1 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804bb1:	55                   	push   %rbp
+  804bb2:	48 89 e5             	mov    %rsp,%rbp
+  804bb5:	53                   	push   %rbx
+  804bb6:	48 83 ec 28          	sub    $0x28,%rsp
+  804bba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804bbe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804bc2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804bc9:	00 00 00 
+  804bcc:	8b 40 04             	mov    0x4(%rax),%eax
+  804bcf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bd4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bdb:	00 00 00 
+  804bde:	48 98                	cltq
+  804be0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804be7:	48 01 d0             	add    %rdx,%rax
+  804bea:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bf0:	8b 00                	mov    (%rax),%eax
+  804bf2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804bf5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf9:	48 89 c7             	mov    %rax,%rdi
+  804bfc:	48 b8 ac 5d 80 00 00 	movabs $0x805dac,%rax
+  804c03:	00 00 00 
+  804c06:	ff d0                	call   *%rax
+  804c08:	89 c3                	mov    %eax,%ebx
+  804c0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c0e:	48 89 c7             	mov    %rax,%rdi
+  804c11:	48 b8 ac 5d 80 00 00 	movabs $0x805dac,%rax
+  804c18:	00 00 00 
+  804c1b:	ff d0                	call   *%rax
+  804c1d:	39 c3                	cmp    %eax,%ebx
+  804c1f:	0f 94 c0             	sete   %al
+  804c22:	0f b6 c0             	movzbl %al,%eax
+  804c25:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804c28:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c2f:	00 00 00 
+  804c32:	8b 40 04             	mov    0x4(%rax),%eax
+  804c35:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c3a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804c41:	00 00 00 
+  804c44:	48 98                	cltq
+  804c46:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c4d:	48 01 d0             	add    %rdx,%rax
+  804c50:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c56:	8b 00                	mov    (%rax),%eax
+  804c58:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804c5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c5e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c61:	75 05                	jne    804c68 <_pipeisclosed+0xb7>
+      return ret;
+  804c63:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c66:	eb 68                	jmp    804cd0 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804c68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c6b:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c6e:	0f 84 4e ff ff ff    	je     804bc2 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804c74:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c7b:	00 00 00 
+  804c7e:	8b 40 04             	mov    0x4(%rax),%eax
+  804c81:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c86:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804c8d:	00 00 00 
+  804c90:	48 98                	cltq
+  804c92:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c99:	48 01 d0             	add    %rdx,%rax
+  804c9c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ca2:	8b 10                	mov    (%rax),%edx
+  804ca4:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804ca7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804caa:	89 c6                	mov    %eax,%esi
+  804cac:	48 b8 40 6c 80 00 00 	movabs $0x806c40,%rax
+  804cb3:	00 00 00 
+  804cb6:	48 89 c7             	mov    %rax,%rdi
+  804cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cbe:	49 b8 7e 04 80 00 00 	movabs $0x80047e,%r8
+  804cc5:	00 00 00 
+  804cc8:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804ccb:	e9 f2 fe ff ff       	jmp    804bc2 <_pipeisclosed+0x11>
+  }
+}
+  804cd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804cd4:	c9                   	leave
+  804cd5:	c3                   	ret
+
+0000000000804cd6 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804cd6:	55                   	push   %rbp
+  804cd7:	48 89 e5             	mov    %rsp,%rbp
+  804cda:	48 83 ec 30          	sub    $0x30,%rsp
+  804cde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ce1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804ce5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ce8:	48 89 d6             	mov    %rdx,%rsi
+  804ceb:	89 c7                	mov    %eax,%edi
+  804ced:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  804cf4:	00 00 00 
+  804cf7:	ff d0                	call   *%rax
+  804cf9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cfc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d00:	79 05                	jns    804d07 <pipeisclosed+0x31>
+    return r;
+  804d02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d05:	eb 31                	jmp    804d38 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804d07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0b:	48 89 c7             	mov    %rax,%rdi
+  804d0e:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804d15:	00 00 00 
+  804d18:	ff d0                	call   *%rax
+  804d1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d22:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d26:	48 89 d6             	mov    %rdx,%rsi
+  804d29:	48 89 c7             	mov    %rax,%rdi
+  804d2c:	48 b8 b1 4b 80 00 00 	movabs $0x804bb1,%rax
+  804d33:	00 00 00 
+  804d36:	ff d0                	call   *%rax
+}
+  804d38:	c9                   	leave
+  804d39:	c3                   	ret
+
+0000000000804d3a <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804d3a:	55                   	push   %rbp
+  804d3b:	48 89 e5             	mov    %rsp,%rbp
+  804d3e:	48 83 ec 10          	sub    $0x10,%rsp
+  804d42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d4a:	8b 40 18             	mov    0x18(%rax),%eax
+  804d4d:	8d 50 01             	lea    0x1(%rax),%edx
+  804d50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d54:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804d57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d5b:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804d5e:	85 c0                	test   %eax,%eax
+  804d60:	74 27                	je     804d89 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804d62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d66:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d71:	48 83 c0 18          	add    $0x18,%rax
+  804d75:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804d7a:	48 89 c7             	mov    %rax,%rdi
+  804d7d:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  804d84:	00 00 00 
+  804d87:	ff d0                	call   *%rax
+  }
+}
+  804d89:	90                   	nop
+  804d8a:	c9                   	leave
+  804d8b:	c3                   	ret
+
+0000000000804d8c <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804d8c:	55                   	push   %rbp
+  804d8d:	48 89 e5             	mov    %rsp,%rbp
+  804d90:	48 83 ec 10          	sub    $0x10,%rsp
+  804d94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d98:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804d9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9f:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804da6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804daa:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804dae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804db1:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804db8:	89 c6                	mov    %eax,%esi
+  804dba:	48 89 cf             	mov    %rcx,%rdi
+  804dbd:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  804dc4:	00 00 00 
+  804dc7:	ff d0                	call   *%rax
+}
+  804dc9:	90                   	nop
+  804dca:	c9                   	leave
+  804dcb:	c3                   	ret
+
+0000000000804dcc <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804dcc:	55                   	push   %rbp
+  804dcd:	48 89 e5             	mov    %rsp,%rbp
+  804dd0:	48 83 ec 70          	sub    $0x70,%rsp
+  804dd4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804dd8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804ddc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804de0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804de4:	48 89 c7             	mov    %rax,%rdi
+  804de7:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804dee:	00 00 00 
+  804df1:	ff d0                	call   *%rax
+  804df3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804df7:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804dfc:	75 0a                	jne    804e08 <devpipe_read+0x3c>
+    return 0;
+  804dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e03:	e9 63 01 00 00       	jmp    804f6b <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804e08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e0c:	8b 40 18             	mov    0x18(%rax),%eax
+  804e0f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804e12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e16:	48 8b 10             	mov    (%rax),%rdx
+  804e19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e21:	48 39 c2             	cmp    %rax,%rdx
+  804e24:	75 42                	jne    804e68 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804e26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e2a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e2e:	48 89 d6             	mov    %rdx,%rsi
+  804e31:	48 89 c7             	mov    %rax,%rdi
+  804e34:	48 b8 b1 4b 80 00 00 	movabs $0x804bb1,%rax
+  804e3b:	00 00 00 
+  804e3e:	ff d0                	call   *%rax
+  804e40:	85 c0                	test   %eax,%eax
+  804e42:	74 0a                	je     804e4e <devpipe_read+0x82>
+      return 0;
+  804e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e49:	e9 1d 01 00 00       	jmp    804f6b <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804e4e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804e51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e55:	89 d6                	mov    %edx,%esi
+  804e57:	48 89 c7             	mov    %rax,%rdi
+  804e5a:	48 b8 8c 4d 80 00 00 	movabs $0x804d8c,%rax
+  804e61:	00 00 00 
+  804e64:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804e66:	eb a0                	jmp    804e08 <devpipe_read+0x3c>
+      break;
+  804e68:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804e69:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e6d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804e71:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e75:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e7d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e85:	48 8b 00             	mov    (%rax),%rax
+  804e88:	48 29 c2             	sub    %rax,%rdx
+  804e8b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804e8f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e97:	48 39 c2             	cmp    %rax,%rdx
+  804e9a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e9e:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804ea2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ea6:	48 8b 00             	mov    (%rax),%rax
+  804ea9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ead:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eb6:	48 f7 f1             	div    %rcx
+  804eb9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804ebd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ec1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ec5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ecd:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804ed1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ed5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ed9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804edd:	48 39 c2             	cmp    %rax,%rdx
+  804ee0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ee4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804ee8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eec:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804ef0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ef4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804ef8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804efc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f00:	48 89 ce             	mov    %rcx,%rsi
+  804f03:	48 89 c7             	mov    %rax,%rdi
+  804f06:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  804f0d:	00 00 00 
+  804f10:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804f12:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f16:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804f1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f1e:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804f22:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804f26:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f2a:	48 01 d1             	add    %rdx,%rcx
+  804f2d:	48 89 c2             	mov    %rax,%rdx
+  804f30:	48 89 cf             	mov    %rcx,%rdi
+  804f33:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  804f3a:	00 00 00 
+  804f3d:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f43:	48 8b 10             	mov    (%rax),%rdx
+  804f46:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f4a:	48 01 c2             	add    %rax,%rdx
+  804f4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f51:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804f54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f58:	48 89 c7             	mov    %rax,%rdi
+  804f5b:	48 b8 3a 4d 80 00 00 	movabs $0x804d3a,%rax
+  804f62:	00 00 00 
+  804f65:	ff d0                	call   *%rax
+  return n;
+  804f67:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804f6b:	c9                   	leave
+  804f6c:	c3                   	ret
+
+0000000000804f6d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804f6d:	55                   	push   %rbp
+  804f6e:	48 89 e5             	mov    %rsp,%rbp
+  804f71:	48 83 ec 70          	sub    $0x70,%rsp
+  804f75:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f79:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f7d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804f81:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f85:	48 89 c7             	mov    %rax,%rdi
+  804f88:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804f8f:	00 00 00 
+  804f92:	ff d0                	call   *%rax
+  804f94:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804f98:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f9c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804fa0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804fa7:	00 
+  804fa8:	e9 b8 01 00 00       	jmp    805165 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804fad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb1:	8b 40 18             	mov    0x18(%rax),%eax
+  804fb4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804fb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fbb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804fbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc3:	48 8b 00             	mov    (%rax),%rax
+  804fc6:	48 29 c2             	sub    %rax,%rdx
+  804fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fd1:	48 39 c2             	cmp    %rax,%rdx
+  804fd4:	75 4d                	jne    805023 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804fd6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fda:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fde:	48 89 d6             	mov    %rdx,%rsi
+  804fe1:	48 89 c7             	mov    %rax,%rdi
+  804fe4:	48 b8 b1 4b 80 00 00 	movabs $0x804bb1,%rax
+  804feb:	00 00 00 
+  804fee:	ff d0                	call   *%rax
+  804ff0:	85 c0                	test   %eax,%eax
+  804ff2:	74 0a                	je     804ffe <devpipe_write+0x91>
+        return 0;
+  804ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff9:	e9 79 01 00 00       	jmp    805177 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804ffe:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805001:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805005:	89 d6                	mov    %edx,%esi
+  805007:	48 89 c7             	mov    %rax,%rdi
+  80500a:	48 b8 8c 4d 80 00 00 	movabs $0x804d8c,%rax
+  805011:	00 00 00 
+  805014:	ff d0                	call   *%rax
+      m = 0;
+  805016:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80501d:	00 
+      continue;
+  80501e:	e9 3a 01 00 00       	jmp    80515d <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  805023:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805027:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80502b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80502f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805033:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805037:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80503b:	48 8b 08             	mov    (%rax),%rcx
+  80503e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805042:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805046:	48 29 c1             	sub    %rax,%rcx
+  805049:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80504d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805051:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805055:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805059:	48 39 c2             	cmp    %rax,%rdx
+  80505c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805060:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  805064:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805068:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80506c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805070:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805074:	ba 00 00 00 00       	mov    $0x0,%edx
+  805079:	48 f7 f1             	div    %rcx
+  80507c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805080:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805084:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805088:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80508c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805090:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805094:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805098:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80509c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8050a0:	48 39 c2             	cmp    %rax,%rdx
+  8050a3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8050a7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8050ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050af:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8050b3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8050b7:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8050bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8050bf:	48 01 d1             	add    %rdx,%rcx
+  8050c2:	48 89 c2             	mov    %rax,%rdx
+  8050c5:	48 89 cf             	mov    %rcx,%rdi
+  8050c8:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  8050cf:	00 00 00 
+  8050d2:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8050d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050d8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050dc:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8050e0:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8050e4:	73 4d                	jae    805133 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8050e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8050f2:	48 29 c2             	sub    %rax,%rdx
+  8050f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050f9:	48 01 c2             	add    %rax,%rdx
+  8050fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805100:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805104:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805108:	48 89 c1             	mov    %rax,%rcx
+  80510b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80510f:	48 01 c1             	add    %rax,%rcx
+  805112:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805116:	48 01 c1             	add    %rax,%rcx
+  805119:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80511d:	48 83 c0 20          	add    $0x20,%rax
+  805121:	48 89 ce             	mov    %rcx,%rsi
+  805124:	48 89 c7             	mov    %rax,%rdi
+  805127:	48 b8 77 1b 80 00 00 	movabs $0x801b77,%rax
+  80512e:	00 00 00 
+  805131:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805137:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80513b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80513f:	48 01 c2             	add    %rax,%rdx
+  805142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805146:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80514a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80514e:	48 89 c7             	mov    %rax,%rdi
+  805151:	48 b8 3a 4d 80 00 00 	movabs $0x804d3a,%rax
+  805158:	00 00 00 
+  80515b:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80515d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805161:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805165:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805169:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80516d:	0f 82 3a fe ff ff    	jb     804fad <devpipe_write+0x40>
+  }
+
+  return i;
+  805173:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805177:	c9                   	leave
+  805178:	c3                   	ret
+
+0000000000805179 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805179:	55                   	push   %rbp
+  80517a:	48 89 e5             	mov    %rsp,%rbp
+  80517d:	48 83 ec 40          	sub    $0x40,%rsp
+  805181:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805185:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805188:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80518c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805190:	48 89 c7             	mov    %rax,%rdi
+  805193:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  80519a:	00 00 00 
+  80519d:	ff d0                	call   *%rax
+  80519f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8051a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8051aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051ae:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8051b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051b6:	48 89 d6             	mov    %rdx,%rsi
+  8051b9:	48 89 c7             	mov    %rax,%rdi
+  8051bc:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  8051c3:	00 00 00 
+  8051c6:	ff d0                	call   *%rax
+  8051c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051cf:	79 08                	jns    8051d9 <devpipe_poll+0x60>
+    return r;
+  8051d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051d4:	e9 85 00 00 00       	jmp    80525e <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8051d9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8051dc:	83 e0 01             	and    $0x1,%eax
+  8051df:	85 c0                	test   %eax,%eax
+  8051e1:	74 18                	je     8051fb <devpipe_poll+0x82>
+  8051e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051e7:	48 8b 10             	mov    (%rax),%rdx
+  8051ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051f2:	48 39 c2             	cmp    %rax,%rdx
+  8051f5:	74 04                	je     8051fb <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8051f7:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8051fb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8051fe:	83 e0 02             	and    $0x2,%eax
+  805201:	85 c0                	test   %eax,%eax
+  805203:	74 23                	je     805228 <devpipe_poll+0xaf>
+  805205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805209:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80520d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805211:	48 8b 00             	mov    (%rax),%rax
+  805214:	48 29 c2             	sub    %rax,%rdx
+  805217:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80521b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80521f:	48 39 c2             	cmp    %rax,%rdx
+  805222:	73 04                	jae    805228 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805224:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805228:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80522c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805230:	48 89 d6             	mov    %rdx,%rsi
+  805233:	48 89 c7             	mov    %rax,%rdi
+  805236:	48 b8 b1 4b 80 00 00 	movabs $0x804bb1,%rax
+  80523d:	00 00 00 
+  805240:	ff d0                	call   *%rax
+  805242:	85 c0                	test   %eax,%eax
+  805244:	74 04                	je     80524a <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805246:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80524a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80524e:	75 0b                	jne    80525b <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805254:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80525b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80525e:	c9                   	leave
+  80525f:	c3                   	ret
+
+0000000000805260 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805260:	55                   	push   %rbp
+  805261:	48 89 e5             	mov    %rsp,%rbp
+  805264:	48 83 ec 20          	sub    $0x20,%rsp
+  805268:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80526c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805274:	48 89 c7             	mov    %rax,%rdi
+  805277:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  80527e:	00 00 00 
+  805281:	ff d0                	call   *%rax
+  805283:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805287:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80528b:	48 ba 71 6c 80 00 00 	movabs $0x806c71,%rdx
+  805292:	00 00 00 
+  805295:	48 89 d6             	mov    %rdx,%rsi
+  805298:	48 89 c7             	mov    %rax,%rdi
+  80529b:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  8052a2:	00 00 00 
+  8052a5:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8052a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8052af:	89 c1                	mov    %eax,%ecx
+  8052b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052b5:	48 8b 00             	mov    (%rax),%rax
+  8052b8:	89 c2                	mov    %eax,%edx
+  8052ba:	89 c8                	mov    %ecx,%eax
+  8052bc:	29 d0                	sub    %edx,%eax
+  8052be:	89 c2                	mov    %eax,%edx
+  8052c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052c4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8052ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052ce:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8052d5:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8052d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052dc:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8052e3:	00 00 00 
+  8052e6:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8052ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052f2:	c9                   	leave
+  8052f3:	c3                   	ret
+
+00000000008052f4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8052f4:	55                   	push   %rbp
+  8052f5:	48 89 e5             	mov    %rsp,%rbp
+  8052f8:	48 83 ec 40          	sub    $0x40,%rsp
+  8052fc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805304:	48 89 c7             	mov    %rax,%rdi
+  805307:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  80530e:	00 00 00 
+  805311:	ff d0                	call   *%rax
+  805313:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805317:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80531e:	00 
+  80531f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805323:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805327:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80532b:	48 01 d0             	add    %rdx,%rax
+  80532e:	48 83 c0 1f          	add    $0x1f,%rax
+  805332:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805336:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80533a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80533f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805343:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805347:	48 29 d0             	sub    %rdx,%rax
+  80534a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80534e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805352:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805356:	48 89 c6             	mov    %rax,%rsi
+  805359:	bf 00 00 00 00       	mov    $0x0,%edi
+  80535e:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  805365:	00 00 00 
+  805368:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80536a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80536e:	48 89 c7             	mov    %rax,%rdi
+  805371:	48 b8 3a 4d 80 00 00 	movabs $0x804d3a,%rax
+  805378:	00 00 00 
+  80537b:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80537d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805381:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805385:	eb 2f                	jmp    8053b6 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80538b:	48 83 e8 01          	sub    $0x1,%rax
+  80538f:	48 c1 e0 0c          	shl    $0xc,%rax
+  805393:	48 89 c2             	mov    %rax,%rdx
+  805396:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80539a:	48 01 d0             	add    %rdx,%rax
+  80539d:	48 89 c6             	mov    %rax,%rsi
+  8053a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053a5:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  8053ac:	00 00 00 
+  8053af:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8053b1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8053b6:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8053bb:	77 ca                	ja     805387 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8053bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053c1:	48 89 c6             	mov    %rax,%rsi
+  8053c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053c9:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  8053d0:	00 00 00 
+  8053d3:	ff d0                	call   *%rax
+}
+  8053d5:	c9                   	leave
+  8053d6:	c3                   	ret
+
+00000000008053d7 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8053d7:	55                   	push   %rbp
+  8053d8:	48 89 e5             	mov    %rsp,%rbp
+  8053db:	48 83 ec 10          	sub    $0x10,%rsp
+  8053df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8053e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8053e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053ef:	48 89 c7             	mov    %rax,%rdi
+  8053f2:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8053f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053f9:	48 b8 3b 56 80 00 00 	movabs $0x80563b,%rax
+  805400:	00 00 00 
+  805403:	ff d0                	call   *%rax
+}
+  805405:	90                   	nop
+  805406:	c9                   	leave
+  805407:	c3                   	ret
+
+0000000000805408 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805408:	55                   	push   %rbp
+  805409:	48 89 e5             	mov    %rsp,%rbp
+  80540c:	48 83 ec 20          	sub    $0x20,%rsp
+  805410:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805413:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805416:	c1 e0 10             	shl    $0x10,%eax
+  805419:	48 98                	cltq
+  80541b:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805420:	48 01 d0             	add    %rdx,%rax
+  805423:	48 89 c6             	mov    %rax,%rsi
+  805426:	bf 00 00 00 00       	mov    $0x0,%edi
+  80542b:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  805432:	00 00 00 
+  805435:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805437:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80543a:	83 c0 01             	add    $0x1,%eax
+  80543d:	c1 e0 10             	shl    $0x10,%eax
+  805440:	48 98                	cltq
+  805442:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805447:	48 01 d0             	add    %rdx,%rax
+  80544a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80544e:	eb 20                	jmp    805470 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805450:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805454:	48 89 c6             	mov    %rax,%rsi
+  805457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80545c:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  805463:	00 00 00 
+  805466:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805468:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80546f:	00 
+  805470:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805473:	83 c0 01             	add    $0x1,%eax
+  805476:	c1 e0 10             	shl    $0x10,%eax
+  805479:	48 98                	cltq
+  80547b:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805480:	48 01 d0             	add    %rdx,%rax
+  805483:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805487:	72 c7                	jb     805450 <slot_unmap+0x48>
+}
+  805489:	90                   	nop
+  80548a:	90                   	nop
+  80548b:	c9                   	leave
+  80548c:	c3                   	ret
+
+000000000080548d <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  80548d:	55                   	push   %rbp
+  80548e:	48 89 e5             	mov    %rsp,%rbp
+  805491:	48 83 ec 30          	sub    $0x30,%rsp
+  805495:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805499:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80549d:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8054a4:	00 00 00 
+  8054a7:	48 89 c7             	mov    %rax,%rdi
+  8054aa:	48 b8 cf 5f 80 00 00 	movabs $0x805fcf,%rax
+  8054b1:	00 00 00 
+  8054b4:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8054b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8054bd:	eb 04                	jmp    8054c3 <thread_create+0x36>
+  8054bf:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8054c3:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8054c7:	7f 16                	jg     8054df <thread_create+0x52>
+  8054c9:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8054d0:	00 00 00 
+  8054d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054d6:	48 98                	cltq
+  8054d8:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8054db:	85 c0                	test   %eax,%eax
+  8054dd:	75 e0                	jne    8054bf <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8054df:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8054e3:	75 0c                	jne    8054f1 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8054e5:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8054ec:	e9 2c 01 00 00       	jmp    80561d <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8054f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054f4:	c1 e0 10             	shl    $0x10,%eax
+  8054f7:	48 98                	cltq
+  8054f9:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8054fe:	48 01 d0             	add    %rdx,%rax
+  805501:	ba 07 00 00 00       	mov    $0x7,%edx
+  805506:	48 89 c6             	mov    %rax,%rsi
+  805509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80550e:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  805515:	00 00 00 
+  805518:	ff d0                	call   *%rax
+  80551a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80551d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805521:	0f 88 f5 00 00 00    	js     80561c <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805527:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80552a:	83 c0 01             	add    $0x1,%eax
+  80552d:	c1 e0 10             	shl    $0x10,%eax
+  805530:	48 98                	cltq
+  805532:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805537:	48 01 d0             	add    %rdx,%rax
+  80553a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80553e:	eb 32                	jmp    805572 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805544:	ba 07 00 00 00       	mov    $0x7,%edx
+  805549:	48 89 c6             	mov    %rax,%rsi
+  80554c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805551:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  805558:	00 00 00 
+  80555b:	ff d0                	call   *%rax
+  80555d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805560:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805564:	0f 88 9e 00 00 00    	js     805608 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80556a:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805571:	00 
+  805572:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805575:	83 c0 01             	add    $0x1,%eax
+  805578:	c1 e0 10             	shl    $0x10,%eax
+  80557b:	48 98                	cltq
+  80557d:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805582:	48 01 d0             	add    %rdx,%rax
+  805585:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805589:	72 b5                	jb     805540 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  80558b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80558f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805593:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805596:	c1 e2 10             	shl    $0x10,%edx
+  805599:	48 63 d2             	movslq %edx,%rdx
+  80559c:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  8055a1:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  8055a4:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  8055a7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8055aa:	83 c2 01             	add    $0x1,%edx
+  8055ad:	c1 e2 10             	shl    $0x10,%edx
+  8055b0:	48 63 d2             	movslq %edx,%rdx
+  8055b3:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8055b8:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  8055bb:	48 bf d7 53 80 00 00 	movabs $0x8053d7,%rdi
+  8055c2:	00 00 00 
+  8055c5:	49 89 c8             	mov    %rcx,%r8
+  8055c8:	48 89 c1             	mov    %rax,%rcx
+  8055cb:	4c 89 ca             	mov    %r9,%rdx
+  8055ce:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8055d5:	00 00 00 
+  8055d8:	ff d0                	call   *%rax
+  8055da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8055dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055e1:	79 08                	jns    8055eb <thread_create+0x15e>
+    r = id;
+  8055e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055e6:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8055e9:	eb 1e                	jmp    805609 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8055eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ee:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8055f1:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8055f8:	00 00 00 
+  8055fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055fe:	48 98                	cltq
+  805600:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805603:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805606:	eb 15                	jmp    80561d <thread_create+0x190>
+      goto fail;
+  805608:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805609:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80560c:	89 c7                	mov    %eax,%edi
+  80560e:	48 b8 08 54 80 00 00 	movabs $0x805408,%rax
+  805615:	00 00 00 
+  805618:	ff d0                	call   *%rax
+  80561a:	eb 01                	jmp    80561d <thread_create+0x190>
+    goto out;
+  80561c:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  80561d:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805624:	00 00 00 
+  805627:	48 89 c7             	mov    %rax,%rdi
+  80562a:	48 b8 a4 60 80 00 00 	movabs $0x8060a4,%rax
+  805631:	00 00 00 
+  805634:	ff d0                	call   *%rax
+  return r;
+  805636:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805639:	c9                   	leave
+  80563a:	c3                   	ret
+
+000000000080563b <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  80563b:	55                   	push   %rbp
+  80563c:	48 89 e5             	mov    %rsp,%rbp
+  80563f:	48 83 ec 10          	sub    $0x10,%rsp
+  805643:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805646:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805649:	89 c7                	mov    %eax,%edi
+  80564b:	48 b8 f9 26 80 00 00 	movabs $0x8026f9,%rax
+  805652:	00 00 00 
+  805655:	ff d0                	call   *%rax
+}
+  805657:	90                   	nop
+  805658:	c9                   	leave
+  805659:	c3                   	ret
+
+000000000080565a <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80565a:	55                   	push   %rbp
+  80565b:	48 89 e5             	mov    %rsp,%rbp
+  80565e:	48 83 ec 20          	sub    $0x20,%rsp
+  805662:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805665:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805669:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805670:	00 00 00 
+  805673:	48 89 c7             	mov    %rax,%rdi
+  805676:	48 b8 cf 5f 80 00 00 	movabs $0x805fcf,%rax
+  80567d:	00 00 00 
+  805680:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805682:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805689:	eb 04                	jmp    80568f <thread_join+0x35>
+  80568b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80568f:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805693:	7f 17                	jg     8056ac <thread_join+0x52>
+  805695:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80569c:	00 00 00 
+  80569f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056a2:	48 98                	cltq
+  8056a4:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8056a7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8056aa:	75 df                	jne    80568b <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8056ac:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8056b3:	00 00 00 
+  8056b6:	48 89 c7             	mov    %rax,%rdi
+  8056b9:	48 b8 a4 60 80 00 00 	movabs $0x8060a4,%rax
+  8056c0:	00 00 00 
+  8056c3:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8056c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056c9:	74 06                	je     8056d1 <thread_join+0x77>
+  8056cb:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8056cf:	75 07                	jne    8056d8 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8056d1:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8056d6:	eb 76                	jmp    80574e <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8056d8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056df:	48 89 d6             	mov    %rdx,%rsi
+  8056e2:	89 c7                	mov    %eax,%edi
+  8056e4:	48 b8 c1 5e 80 00 00 	movabs $0x805ec1,%rax
+  8056eb:	00 00 00 
+  8056ee:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8056f0:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8056f7:	00 00 00 
+  8056fa:	48 89 c7             	mov    %rax,%rdi
+  8056fd:	48 b8 cf 5f 80 00 00 	movabs $0x805fcf,%rax
+  805704:	00 00 00 
+  805707:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805709:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80570c:	89 c7                	mov    %eax,%edi
+  80570e:	48 b8 08 54 80 00 00 	movabs $0x805408,%rax
+  805715:	00 00 00 
+  805718:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  80571a:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805721:	00 00 00 
+  805724:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805727:	48 98                	cltq
+  805729:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805730:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805737:	00 00 00 
+  80573a:	48 89 c7             	mov    %rax,%rdi
+  80573d:	48 b8 a4 60 80 00 00 	movabs $0x8060a4,%rax
+  805744:	00 00 00 
+  805747:	ff d0                	call   *%rax
+  return 0;
+  805749:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80574e:	c9                   	leave
+  80574f:	c3                   	ret
+
+0000000000805750 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805750:	55                   	push   %rbp
+  805751:	48 89 e5             	mov    %rsp,%rbp
+  805754:	48 83 ec 08          	sub    $0x8,%rsp
+  805758:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80575c:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805761:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805765:	73 23                	jae    80578a <thread_is_uxstack+0x3a>
+  805767:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80576c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805770:	72 18                	jb     80578a <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805772:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805776:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80577b:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805781:	75 07                	jne    80578a <thread_is_uxstack+0x3a>
+  805783:	b8 01 00 00 00       	mov    $0x1,%eax
+  805788:	eb 05                	jmp    80578f <thread_is_uxstack+0x3f>
+  80578a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578f:	83 e0 01             	and    $0x1,%eax
+}
+  805792:	c9                   	leave
+  805793:	c3                   	ret
+
+0000000000805794 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805794:	55                   	push   %rbp
+  805795:	48 89 e5             	mov    %rsp,%rbp
+  805798:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  80579c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057a3:	00 00 00 
+  8057a6:	8b 40 04             	mov    0x4(%rax),%eax
+  8057a9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8057ae:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8057b5:	00 00 00 
+  8057b8:	48 98                	cltq
+  8057ba:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057c1:	48 01 d0             	add    %rdx,%rax
+  8057c4:	48 05 08 01 00 00    	add    $0x108,%rax
+  8057ca:	48 8b 00             	mov    (%rax),%rax
+  8057cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8057d1:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8057d6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8057da:	73 0b                	jae    8057e7 <thread_pftemp+0x53>
+  8057dc:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8057e1:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8057e5:	73 07                	jae    8057ee <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8057e7:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8057ec:	eb 26                	jmp    805814 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8057ee:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8057f5:	ff ff ff 
+  8057f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057fc:	48 01 d0             	add    %rdx,%rax
+  8057ff:	48 c1 e8 10          	shr    $0x10,%rax
+  805803:	48 83 c0 01          	add    $0x1,%rax
+  805807:	48 c1 e0 0c          	shl    $0xc,%rax
+  80580b:	48 f7 d8             	neg    %rax
+  80580e:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805814:	c9                   	leave
+  805815:	c3                   	ret
+
+0000000000805816 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805816:	55                   	push   %rbp
+  805817:	48 89 e5             	mov    %rsp,%rbp
+  80581a:	48 83 ec 08          	sub    $0x8,%rsp
+  80581e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805821:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805825:	75 10                	jne    805837 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805827:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80582e:	00 00 00 
+  805831:	8b 00                	mov    (%rax),%eax
+  805833:	48 98                	cltq
+  805835:	eb 05                	jmp    80583c <vsyscall+0x26>
+  }
+  return 0;
+  805837:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80583c:	c9                   	leave
+  80583d:	c3                   	ret
+
+000000000080583e <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80583e:	55                   	push   %rbp
+  80583f:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805842:	bf 00 00 00 00       	mov    $0x0,%edi
+  805847:	48 b8 16 58 80 00 00 	movabs $0x805816,%rax
+  80584e:	00 00 00 
+  805851:	ff d0                	call   *%rax
+}
+  805853:	5d                   	pop    %rbp
+  805854:	c3                   	ret
+
+0000000000805855 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805855:	55                   	push   %rbp
+  805856:	48 89 e5             	mov    %rsp,%rbp
+  805859:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80585d:	0f 31                	rdtsc
+  80585f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805862:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805865:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805868:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80586b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80586f:	48 09 d0             	or     %rdx,%rax
+  805872:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805876:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80587a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80587e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805885:	00 00 00 
+  805888:	8b 40 08             	mov    0x8(%rax),%eax
+  80588b:	48 98                	cltq
+  80588d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805891:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80589a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80589e:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8058a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058ae:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058b2:	48 89 d0             	mov    %rdx,%rax
+  8058b5:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8058bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058c1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058c5:	48 01 c8             	add    %rcx,%rax
+}
+  8058c8:	c9                   	leave
+  8058c9:	c3                   	ret
+
+00000000008058ca <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8058ca:	55                   	push   %rbp
+  8058cb:	48 89 e5             	mov    %rsp,%rbp
+  8058ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8058d2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8058d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058d8:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8058db:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8058df:	be 01 00 00 00       	mov    $0x1,%esi
+  8058e4:	48 89 c7             	mov    %rax,%rdi
+  8058e7:	48 b8 e5 1f 80 00 00 	movabs $0x801fe5,%rax
+  8058ee:	00 00 00 
+  8058f1:	ff d0                	call   *%rax
+}
+  8058f3:	90                   	nop
+  8058f4:	c9                   	leave
+  8058f5:	c3                   	ret
+
+00000000008058f6 <getchar>:
+
+int
+getchar(void) {
+  8058f6:	55                   	push   %rbp
+  8058f7:	48 89 e5             	mov    %rsp,%rbp
+  8058fa:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8058fe:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805902:	ba 01 00 00 00       	mov    $0x1,%edx
+  805907:	48 89 c6             	mov    %rax,%rsi
+  80590a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80590f:	48 b8 ea 39 80 00 00 	movabs $0x8039ea,%rax
+  805916:	00 00 00 
+  805919:	ff d0                	call   *%rax
+  80591b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  80591e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805922:	79 05                	jns    805929 <getchar+0x33>
+    return r;
+  805924:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805927:	eb 14                	jmp    80593d <getchar+0x47>
+  if (r < 1)
+  805929:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80592d:	7f 07                	jg     805936 <getchar+0x40>
+    return -E_EOF;
+  80592f:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805934:	eb 07                	jmp    80593d <getchar+0x47>
+  return c;
+  805936:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80593a:	0f b6 c0             	movzbl %al,%eax
+}
+  80593d:	c9                   	leave
+  80593e:	c3                   	ret
+
+000000000080593f <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80593f:	55                   	push   %rbp
+  805940:	48 89 e5             	mov    %rsp,%rbp
+  805943:	48 83 ec 20          	sub    $0x20,%rsp
+  805947:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80594a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80594e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805951:	48 89 d6             	mov    %rdx,%rsi
+  805954:	89 c7                	mov    %eax,%edi
+  805956:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  80595d:	00 00 00 
+  805960:	ff d0                	call   *%rax
+  805962:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805965:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805969:	79 05                	jns    805970 <iscons+0x31>
+    return r;
+  80596b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80596e:	eb 1a                	jmp    80598a <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805970:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805974:	8b 10                	mov    (%rax),%edx
+  805976:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80597d:	00 00 00 
+  805980:	8b 00                	mov    (%rax),%eax
+  805982:	39 c2                	cmp    %eax,%edx
+  805984:	0f 94 c0             	sete   %al
+  805987:	0f b6 c0             	movzbl %al,%eax
+}
+  80598a:	c9                   	leave
+  80598b:	c3                   	ret
+
+000000000080598c <opencons>:
+
+int
+opencons(void) {
+  80598c:	55                   	push   %rbp
+  80598d:	48 89 e5             	mov    %rsp,%rbp
+  805990:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805994:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805998:	48 89 c7             	mov    %rax,%rdi
+  80599b:	48 b8 ac 33 80 00 00 	movabs $0x8033ac,%rax
+  8059a2:	00 00 00 
+  8059a5:	ff d0                	call   *%rax
+  8059a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059ae:	79 05                	jns    8059b5 <opencons+0x29>
+    return r;
+  8059b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059b3:	eb 66                	jmp    805a1b <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8059b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059b9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059be:	48 89 c6             	mov    %rax,%rsi
+  8059c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059c6:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  8059cd:	00 00 00 
+  8059d0:	ff d0                	call   *%rax
+  8059d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059d9:	79 05                	jns    8059e0 <opencons+0x54>
+    return r;
+  8059db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059de:	eb 3b                	jmp    805a1b <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8059e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059e4:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8059eb:	00 00 00 
+  8059ee:	8b 12                	mov    (%rdx),%edx
+  8059f0:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8059f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059f6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8059fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a01:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805a08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a0c:	48 89 c7             	mov    %rax,%rdi
+  805a0f:	48 b8 5e 33 80 00 00 	movabs $0x80335e,%rax
+  805a16:	00 00 00 
+  805a19:	ff d0                	call   *%rax
+}
+  805a1b:	c9                   	leave
+  805a1c:	c3                   	ret
+
+0000000000805a1d <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805a1d:	55                   	push   %rbp
+  805a1e:	48 89 e5             	mov    %rsp,%rbp
+  805a21:	48 83 ec 20          	sub    $0x20,%rsp
+  805a25:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a28:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a2b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a32:	48 89 d6             	mov    %rdx,%rsi
+  805a35:	89 c7                	mov    %eax,%edi
+  805a37:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  805a3e:	00 00 00 
+  805a41:	ff d0                	call   *%rax
+  805a43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a4a:	79 05                	jns    805a51 <consmode+0x34>
+    return r;
+  805a4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a4f:	eb 34                	jmp    805a85 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805a51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a55:	8b 10                	mov    (%rax),%edx
+  805a57:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805a5e:	00 00 00 
+  805a61:	8b 00                	mov    (%rax),%eax
+  805a63:	39 c2                	cmp    %eax,%edx
+  805a65:	74 07                	je     805a6e <consmode+0x51>
+    return -E_INVAL;
+  805a67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a6c:	eb 17                	jmp    805a85 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805a6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a72:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a7c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a7f:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805a85:	c9                   	leave
+  805a86:	c3                   	ret
+
+0000000000805a87 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a87:	55                   	push   %rbp
+  805a88:	48 89 e5             	mov    %rsp,%rbp
+  805a8b:	48 83 ec 20          	sub    $0x20,%rsp
+  805a8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a93:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a97:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805a9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a9f:	8b 50 0c             	mov    0xc(%rax),%edx
+  805aa2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805aa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805aaa:	48 89 ce             	mov    %rcx,%rsi
+  805aad:	48 89 c7             	mov    %rax,%rdi
+  805ab0:	48 b8 56 25 80 00 00 	movabs $0x802556,%rax
+  805ab7:	00 00 00 
+  805aba:	ff d0                	call   *%rax
+  805abc:	48 98                	cltq
+}
+  805abe:	c9                   	leave
+  805abf:	c3                   	ret
+
+0000000000805ac0 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805ac0:	55                   	push   %rbp
+  805ac1:	48 89 e5             	mov    %rsp,%rbp
+  805ac4:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805acb:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805ad2:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805ad9:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805ae0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805ae7:	eb 74                	jmp    805b5d <devcons_write+0x9d>
+    m = n - tot;
+  805ae9:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805af0:	89 c2                	mov    %eax,%edx
+  805af2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805af5:	29 c2                	sub    %eax,%edx
+  805af7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805afa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805afd:	83 f8 7f             	cmp    $0x7f,%eax
+  805b00:	76 07                	jbe    805b09 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805b02:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805b09:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b0c:	48 63 d0             	movslq %eax,%rdx
+  805b0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b12:	48 63 c8             	movslq %eax,%rcx
+  805b15:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805b1c:	48 01 c1             	add    %rax,%rcx
+  805b1f:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b26:	48 89 ce             	mov    %rcx,%rsi
+  805b29:	48 89 c7             	mov    %rax,%rdi
+  805b2c:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  805b33:	00 00 00 
+  805b36:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805b38:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b3b:	48 63 d0             	movslq %eax,%rdx
+  805b3e:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b45:	48 89 d6             	mov    %rdx,%rsi
+  805b48:	48 89 c7             	mov    %rax,%rdi
+  805b4b:	48 b8 e5 1f 80 00 00 	movabs $0x801fe5,%rax
+  805b52:	00 00 00 
+  805b55:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805b57:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b5a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805b5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b60:	48 98                	cltq
+  805b62:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805b69:	0f 82 7a ff ff ff    	jb     805ae9 <devcons_write+0x29>
+  }
+  return tot;
+  805b6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b72:	48 98                	cltq
+}
+  805b74:	c9                   	leave
+  805b75:	c3                   	ret
+
+0000000000805b76 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805b76:	55                   	push   %rbp
+  805b77:	48 89 e5             	mov    %rsp,%rbp
+  805b7a:	48 83 ec 08          	sub    $0x8,%rsp
+  805b7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805b82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b87:	c9                   	leave
+  805b88:	c3                   	ret
+
+0000000000805b89 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805b89:	55                   	push   %rbp
+  805b8a:	48 89 e5             	mov    %rsp,%rbp
+  805b8d:	48 83 ec 10          	sub    $0x10,%rsp
+  805b91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b95:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805b99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b9d:	48 ba 7d 6c 80 00 00 	movabs $0x806c7d,%rdx
+  805ba4:	00 00 00 
+  805ba7:	48 89 d6             	mov    %rdx,%rsi
+  805baa:	48 89 c7             	mov    %rax,%rdi
+  805bad:	48 b8 2e 14 80 00 00 	movabs $0x80142e,%rax
+  805bb4:	00 00 00 
+  805bb7:	ff d0                	call   *%rax
+  return 0;
+  805bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805bbe:	c9                   	leave
+  805bbf:	c3                   	ret
+
+0000000000805bc0 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805bc0:	55                   	push   %rbp
+  805bc1:	48 89 e5             	mov    %rsp,%rbp
+  805bc4:	48 83 ec 30          	sub    $0x30,%rsp
+  805bc8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805bcc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805bcf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805bd3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805bda:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bdd:	83 e0 02             	and    $0x2,%eax
+  805be0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805be7:	8b 40 0c             	mov    0xc(%rax),%eax
+  805bea:	83 f8 01             	cmp    $0x1,%eax
+  805bed:	75 04                	jne    805bf3 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805bef:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805bf3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bf6:	83 e0 01             	and    $0x1,%eax
+  805bf9:	85 c0                	test   %eax,%eax
+  805bfb:	74 44                	je     805c41 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805bfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805c05:	89 c2                	mov    %eax,%edx
+  805c07:	be 00 00 00 00       	mov    $0x0,%esi
+  805c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c11:	48 b8 44 26 80 00 00 	movabs $0x802644,%rax
+  805c18:	00 00 00 
+  805c1b:	ff d0                	call   *%rax
+  805c1d:	83 f8 01             	cmp    $0x1,%eax
+  805c20:	75 06                	jne    805c28 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805c22:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805c26:	eb 19                	jmp    805c41 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805c28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c2c:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805c32:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805c35:	89 c2                	mov    %eax,%edx
+  805c37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c3b:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805c41:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805c44:	c9                   	leave
+  805c45:	c3                   	ret
+
+0000000000805c46 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805c46:	55                   	push   %rbp
+  805c47:	48 89 e5             	mov    %rsp,%rbp
+  805c4a:	48 83 ec 20          	sub    $0x20,%rsp
+  805c4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805c52:	48 b8 83 21 80 00 00 	movabs $0x802183,%rax
+  805c59:	00 00 00 
+  805c5c:	ff d0                	call   *%rax
+  805c5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805c61:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805c68:	00 00 00 
+  805c6b:	48 8b 00             	mov    (%rax),%rax
+  805c6e:	48 85 c0             	test   %rax,%rax
+  805c71:	75 62                	jne    805cd5 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805c73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c76:	ba 07 00 00 00       	mov    $0x7,%edx
+  805c7b:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805c82:	00 00 00 
+  805c85:	48 89 ce             	mov    %rcx,%rsi
+  805c88:	89 c7                	mov    %eax,%edi
+  805c8a:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  805c91:	00 00 00 
+  805c94:	ff d0                	call   *%rax
+  805c96:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805c99:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c9d:	79 36                	jns    805cd5 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805c9f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ca2:	89 c1                	mov    %eax,%ecx
+  805ca4:	48 b8 84 6c 80 00 00 	movabs $0x806c84,%rax
+  805cab:	00 00 00 
+  805cae:	48 89 c2             	mov    %rax,%rdx
+  805cb1:	be 23 00 00 00       	mov    $0x23,%esi
+  805cb6:	48 b8 9c 6c 80 00 00 	movabs $0x806c9c,%rax
+  805cbd:	00 00 00 
+  805cc0:	48 89 c7             	mov    %rax,%rdi
+  805cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cc8:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  805ccf:	00 00 00 
+  805cd2:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805cd5:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  805cdc:	00 00 00 
+  805cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ce3:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805ce6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ce9:	48 ba 46 5d 80 00 00 	movabs $0x805d46,%rdx
+  805cf0:	00 00 00 
+  805cf3:	48 89 d6             	mov    %rdx,%rsi
+  805cf6:	89 c7                	mov    %eax,%edi
+  805cf8:	48 b8 99 23 80 00 00 	movabs $0x802399,%rax
+  805cff:	00 00 00 
+  805d02:	ff d0                	call   *%rax
+  805d04:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805d07:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805d0b:	79 36                	jns    805d43 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805d0d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d10:	89 c1                	mov    %eax,%ecx
+  805d12:	48 b8 84 6c 80 00 00 	movabs $0x806c84,%rax
+  805d19:	00 00 00 
+  805d1c:	48 89 c2             	mov    %rax,%rdx
+  805d1f:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805d24:	48 b8 9c 6c 80 00 00 	movabs $0x806c9c,%rax
+  805d2b:	00 00 00 
+  805d2e:	48 89 c7             	mov    %rax,%rdi
+  805d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d36:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  805d3d:	00 00 00 
+  805d40:	41 ff d0             	call   *%r8
+}
+  805d43:	90                   	nop
+  805d44:	c9                   	leave
+  805d45:	c3                   	ret
+
+0000000000805d46 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805d46:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805d49:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805d4c:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805d53:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805d57:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805d5c:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805d63:	00 00 00 
+	call *%rax
+  805d66:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805d68:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805d6d:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805d70:	41 5f                	pop    %r15
+	popq %r15
+  805d72:	41 5f                	pop    %r15
+	popq %r15
+  805d74:	41 5f                	pop    %r15
+	popq %r14
+  805d76:	41 5e                	pop    %r14
+	popq %r13
+  805d78:	41 5d                	pop    %r13
+	popq %r12
+  805d7a:	41 5c                	pop    %r12
+	popq %r11
+  805d7c:	41 5b                	pop    %r11
+	popq %r10
+  805d7e:	41 5a                	pop    %r10
+	popq %r9
+  805d80:	41 59                	pop    %r9
+	popq %r8
+  805d82:	41 58                	pop    %r8
+	popq %rsi
+  805d84:	5e                   	pop    %rsi
+	popq %rdi
+  805d85:	5f                   	pop    %rdi
+	popq %rbp
+  805d86:	5d                   	pop    %rbp
+	popq %rdx
+  805d87:	5a                   	pop    %rdx
+	popq %rcx
+  805d88:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805d89:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805d8e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805d93:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805d97:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805d9a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805d9f:	5b                   	pop    %rbx
+	popq %rax
+  805da0:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805da1:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805da5:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805da6:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805dab:	c3                   	ret
+
+0000000000805dac <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805dac:	55                   	push   %rbp
+  805dad:	48 89 e5             	mov    %rsp,%rbp
+  805db0:	48 83 ec 18          	sub    $0x18,%rsp
+  805db4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805db8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dbc:	48 c1 e8 27          	shr    $0x27,%rax
+  805dc0:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805dc5:	48 89 c2             	mov    %rax,%rdx
+  805dc8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805dcf:	01 00 00 
+  805dd2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dd6:	83 e0 01             	and    $0x1,%eax
+  805dd9:	48 85 c0             	test   %rax,%rax
+  805ddc:	74 63                	je     805e41 <pageref+0x95>
+  805dde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805de2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805de6:	48 89 c2             	mov    %rax,%rdx
+  805de9:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805df0:	01 00 00 
+  805df3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805df7:	83 e0 01             	and    $0x1,%eax
+  805dfa:	48 85 c0             	test   %rax,%rax
+  805dfd:	74 42                	je     805e41 <pageref+0x95>
+  805dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e03:	48 c1 e8 15          	shr    $0x15,%rax
+  805e07:	48 89 c2             	mov    %rax,%rdx
+  805e0a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805e11:	01 00 00 
+  805e14:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e18:	83 e0 01             	and    $0x1,%eax
+  805e1b:	48 85 c0             	test   %rax,%rax
+  805e1e:	74 21                	je     805e41 <pageref+0x95>
+  805e20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e24:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e28:	48 89 c2             	mov    %rax,%rdx
+  805e2b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e32:	01 00 00 
+  805e35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e39:	83 e0 01             	and    $0x1,%eax
+  805e3c:	48 85 c0             	test   %rax,%rax
+  805e3f:	75 07                	jne    805e48 <pageref+0x9c>
+    return 0;
+  805e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e46:	eb 53                	jmp    805e9b <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e4c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e50:	48 89 c2             	mov    %rax,%rdx
+  805e53:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e5a:	01 00 00 
+  805e5d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e61:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e69:	83 e0 01             	and    $0x1,%eax
+  805e6c:	48 85 c0             	test   %rax,%rax
+  805e6f:	75 07                	jne    805e78 <pageref+0xcc>
+    return 0;
+  805e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e76:	eb 23                	jmp    805e9b <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e80:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e87:	00 00 00 
+  805e8a:	48 c1 e0 04          	shl    $0x4,%rax
+  805e8e:	48 01 d0             	add    %rdx,%rax
+  805e91:	48 83 c0 08          	add    $0x8,%rax
+  805e95:	0f b7 00             	movzwl (%rax),%eax
+  805e98:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e9b:	c9                   	leave
+  805e9c:	c3                   	ret
+
+0000000000805e9d <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805e9d:	55                   	push   %rbp
+  805e9e:	48 89 e5             	mov    %rsp,%rbp
+  805ea1:	48 83 ec 10          	sub    $0x10,%rsp
+  805ea5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805ea8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eab:	be 00 00 00 00       	mov    $0x0,%esi
+  805eb0:	89 c7                	mov    %eax,%edi
+  805eb2:	48 b8 c1 5e 80 00 00 	movabs $0x805ec1,%rax
+  805eb9:	00 00 00 
+  805ebc:	ff d0                	call   *%rax
+}
+  805ebe:	90                   	nop
+  805ebf:	c9                   	leave
+  805ec0:	c3                   	ret
+
+0000000000805ec1 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805ec1:	55                   	push   %rbp
+  805ec2:	48 89 e5             	mov    %rsp,%rbp
+  805ec5:	48 83 ec 10          	sub    $0x10,%rsp
+  805ec9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805ecc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805ed0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ed4:	75 3e                	jne    805f14 <waitpid+0x53>
+  805ed6:	48 b8 aa 6c 80 00 00 	movabs $0x806caa,%rax
+  805edd:	00 00 00 
+  805ee0:	48 89 c1             	mov    %rax,%rcx
+  805ee3:	48 b8 b5 6c 80 00 00 	movabs $0x806cb5,%rax
+  805eea:	00 00 00 
+  805eed:	48 89 c2             	mov    %rax,%rdx
+  805ef0:	be 0e 00 00 00       	mov    $0xe,%esi
+  805ef5:	48 b8 ca 6c 80 00 00 	movabs $0x806cca,%rax
+  805efc:	00 00 00 
+  805eff:	48 89 c7             	mov    %rax,%rdi
+  805f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f07:	49 b8 5f 02 80 00 00 	movabs $0x80025f,%r8
+  805f0e:	00 00 00 
+  805f11:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805f14:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805f19:	74 0a                	je     805f25 <waitpid+0x64>
+    *status = 0;
+  805f1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f1f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805f25:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805f29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f2c:	48 89 d6             	mov    %rdx,%rsi
+  805f2f:	89 c7                	mov    %eax,%edi
+  805f31:	48 b8 fb 20 80 00 00 	movabs $0x8020fb,%rax
+  805f38:	00 00 00 
+  805f3b:	ff d0                	call   *%rax
+}
+  805f3d:	c9                   	leave
+  805f3e:	c3                   	ret
+
+0000000000805f3f <xchg>:
+  805f3f:	55                   	push   %rbp
+  805f40:	48 89 e5             	mov    %rsp,%rbp
+  805f43:	48 83 ec 20          	sub    $0x20,%rsp
+  805f47:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f4b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f4e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f52:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f55:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f59:	f0 87 02             	lock xchg %eax,(%rdx)
+  805f5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f62:	c9                   	leave
+  805f63:	c3                   	ret
+
+0000000000805f64 <cmpxchg>:
+  805f64:	55                   	push   %rbp
+  805f65:	48 89 e5             	mov    %rsp,%rbp
+  805f68:	48 83 ec 20          	sub    $0x20,%rsp
+  805f6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f70:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f73:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805f76:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805f7a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805f7d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f80:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f84:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805f88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f8e:	c9                   	leave
+  805f8f:	c3                   	ret
+
+0000000000805f90 <xadd>:
+  805f90:	55                   	push   %rbp
+  805f91:	48 89 e5             	mov    %rsp,%rbp
+  805f94:	48 83 ec 10          	sub    $0x10,%rsp
+  805f98:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f9c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805f9f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805fa3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805fa6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805faa:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805fae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  805fb1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805fb4:	c9                   	leave
+  805fb5:	c3                   	ret
+
+0000000000805fb6 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805fb6:	55                   	push   %rbp
+  805fb7:	48 89 e5             	mov    %rsp,%rbp
+  805fba:	48 83 ec 08          	sub    $0x8,%rsp
+  805fbe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  805fc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fc6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805fcc:	90                   	nop
+  805fcd:	c9                   	leave
+  805fce:	c3                   	ret
+
+0000000000805fcf <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805fcf:	55                   	push   %rbp
+  805fd0:	48 89 e5             	mov    %rsp,%rbp
+  805fd3:	48 83 ec 20          	sub    $0x20,%rsp
+  805fd7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805fdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fdf:	ba 01 00 00 00       	mov    $0x1,%edx
+  805fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  805fe9:	48 89 c7             	mov    %rax,%rdi
+  805fec:	48 b8 64 5f 80 00 00 	movabs $0x805f64,%rax
+  805ff3:	00 00 00 
+  805ff6:	ff d0                	call   *%rax
+  805ff8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ffb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fff:	74 65                	je     806066 <mutex_lock+0x97>
+  if (c != 2)
+  806001:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806005:	74 57                	je     80605e <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80600b:	be 02 00 00 00       	mov    $0x2,%esi
+  806010:	48 89 c7             	mov    %rax,%rdi
+  806013:	48 b8 3f 5f 80 00 00 	movabs $0x805f3f,%rax
+  80601a:	00 00 00 
+  80601d:	ff d0                	call   *%rax
+  80601f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806022:	eb 3a                	jmp    80605e <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806024:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806028:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80602f:	be 02 00 00 00       	mov    $0x2,%esi
+  806034:	48 89 c7             	mov    %rax,%rdi
+  806037:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  80603e:	00 00 00 
+  806041:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  806043:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806047:	be 02 00 00 00       	mov    $0x2,%esi
+  80604c:	48 89 c7             	mov    %rax,%rdi
+  80604f:	48 b8 3f 5f 80 00 00 	movabs $0x805f3f,%rax
+  806056:	00 00 00 
+  806059:	ff d0                	call   *%rax
+  80605b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80605e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806062:	75 c0                	jne    806024 <mutex_lock+0x55>
+  806064:	eb 01                	jmp    806067 <mutex_lock+0x98>
+    return;
+  806066:	90                   	nop
+}
+  806067:	c9                   	leave
+  806068:	c3                   	ret
+
+0000000000806069 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806069:	55                   	push   %rbp
+  80606a:	48 89 e5             	mov    %rsp,%rbp
+  80606d:	48 83 ec 08          	sub    $0x8,%rsp
+  806071:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806075:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806079:	ba 01 00 00 00       	mov    $0x1,%edx
+  80607e:	be 00 00 00 00       	mov    $0x0,%esi
+  806083:	48 89 c7             	mov    %rax,%rdi
+  806086:	48 b8 64 5f 80 00 00 	movabs $0x805f64,%rax
+  80608d:	00 00 00 
+  806090:	ff d0                	call   *%rax
+  806092:	85 c0                	test   %eax,%eax
+  806094:	75 07                	jne    80609d <mutex_trylock+0x34>
+  806096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80609b:	eb 05                	jmp    8060a2 <mutex_trylock+0x39>
+  80609d:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8060a2:	c9                   	leave
+  8060a3:	c3                   	ret
+
+00000000008060a4 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  8060a4:	55                   	push   %rbp
+  8060a5:	48 89 e5             	mov    %rsp,%rbp
+  8060a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8060ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  8060b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8060b9:	48 89 c7             	mov    %rax,%rdi
+  8060bc:	48 b8 3f 5f 80 00 00 	movabs $0x805f3f,%rax
+  8060c3:	00 00 00 
+  8060c6:	ff d0                	call   *%rax
+  8060c8:	83 f8 02             	cmp    $0x2,%eax
+  8060cb:	75 18                	jne    8060e5 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  8060cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8060d6:	48 89 c7             	mov    %rax,%rdi
+  8060d9:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  8060e0:	00 00 00 
+  8060e3:	ff d0                	call   *%rax
+}
+  8060e5:	90                   	nop
+  8060e6:	c9                   	leave
+  8060e7:	c3                   	ret
+
+00000000008060e8 <cond_init>:
+cond_init(struct Cond *c) {
+  8060e8:	55                   	push   %rbp
+  8060e9:	48 89 e5             	mov    %rsp,%rbp
+  8060ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8060f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  8060f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060f8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8060fe:	90                   	nop
+  8060ff:	c9                   	leave
+  806100:	c3                   	ret
+
+0000000000806101 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  806101:	55                   	push   %rbp
+  806102:	48 89 e5             	mov    %rsp,%rbp
+  806105:	48 83 ec 30          	sub    $0x30,%rsp
+  806109:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80610d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806111:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  806115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806119:	8b 00                	mov    (%rax),%eax
+  80611b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  80611e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806122:	48 89 c7             	mov    %rax,%rdi
+  806125:	48 b8 a4 60 80 00 00 	movabs $0x8060a4,%rax
+  80612c:	00 00 00 
+  80612f:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  806131:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806135:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806139:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80613c:	89 ce                	mov    %ecx,%esi
+  80613e:	48 89 c7             	mov    %rax,%rdi
+  806141:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  806148:	00 00 00 
+  80614b:	ff d0                	call   *%rax
+  80614d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  806150:	eb 1f                	jmp    806171 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806152:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806156:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80615d:	be 02 00 00 00       	mov    $0x2,%esi
+  806162:	48 89 c7             	mov    %rax,%rdi
+  806165:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  80616c:	00 00 00 
+  80616f:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806171:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806175:	be 02 00 00 00       	mov    $0x2,%esi
+  80617a:	48 89 c7             	mov    %rax,%rdi
+  80617d:	48 b8 3f 5f 80 00 00 	movabs $0x805f3f,%rax
+  806184:	00 00 00 
+  806187:	ff d0                	call   *%rax
+  806189:	85 c0                	test   %eax,%eax
+  80618b:	75 c5                	jne    806152 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  80618d:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806191:	75 07                	jne    80619a <cond_timedwait+0x99>
+  806193:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806198:	eb 05                	jmp    80619f <cond_timedwait+0x9e>
+  80619a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80619f:	c9                   	leave
+  8061a0:	c3                   	ret
+
+00000000008061a1 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  8061a1:	55                   	push   %rbp
+  8061a2:	48 89 e5             	mov    %rsp,%rbp
+  8061a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8061a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8061ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  8061b1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8061b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061b9:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8061c0:	48 89 ce             	mov    %rcx,%rsi
+  8061c3:	48 89 c7             	mov    %rax,%rdi
+  8061c6:	48 b8 01 61 80 00 00 	movabs $0x806101,%rax
+  8061cd:	00 00 00 
+  8061d0:	ff d0                	call   *%rax
+}
+  8061d2:	90                   	nop
+  8061d3:	c9                   	leave
+  8061d4:	c3                   	ret
+
+00000000008061d5 <cond_signal>:
+cond_signal(struct Cond *c) {
+  8061d5:	55                   	push   %rbp
+  8061d6:	48 89 e5             	mov    %rsp,%rbp
+  8061d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8061dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8061e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8061ea:	48 89 c7             	mov    %rax,%rdi
+  8061ed:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  8061f4:	00 00 00 
+  8061f7:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8061f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061fd:	be 01 00 00 00       	mov    $0x1,%esi
+  806202:	48 89 c7             	mov    %rax,%rdi
+  806205:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  80620c:	00 00 00 
+  80620f:	ff d0                	call   *%rax
+}
+  806211:	90                   	nop
+  806212:	c9                   	leave
+  806213:	c3                   	ret
+
+0000000000806214 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  806214:	55                   	push   %rbp
+  806215:	48 89 e5             	mov    %rsp,%rbp
+  806218:	48 83 ec 10          	sub    $0x10,%rsp
+  80621c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806224:	be 01 00 00 00       	mov    $0x1,%esi
+  806229:	48 89 c7             	mov    %rax,%rdi
+  80622c:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  806233:	00 00 00 
+  806236:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  806238:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80623c:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  806241:	48 89 c7             	mov    %rax,%rdi
+  806244:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  80624b:	00 00 00 
+  80624e:	ff d0                	call   *%rax
+}
+  806250:	90                   	nop
+  806251:	c9                   	leave
+  806252:	c3                   	ret
+
+0000000000806253 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  806253:	55                   	push   %rbp
+  806254:	48 89 e5             	mov    %rsp,%rbp
+  806257:	48 83 ec 10          	sub    $0x10,%rsp
+  80625b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80625f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  806262:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806266:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806269:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  80626b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80626f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806276:	90                   	nop
+  806277:	c9                   	leave
+  806278:	c3                   	ret
+
+0000000000806279 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806279:	55                   	push   %rbp
+  80627a:	48 89 e5             	mov    %rsp,%rbp
+  80627d:	48 83 ec 18          	sub    $0x18,%rsp
+  806281:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806285:	eb 2a                	jmp    8062b1 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80628a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  80628d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806291:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806294:	89 ce                	mov    %ecx,%esi
+  806296:	48 89 c7             	mov    %rax,%rdi
+  806299:	48 b8 64 5f 80 00 00 	movabs $0x805f64,%rax
+  8062a0:	00 00 00 
+  8062a3:	ff d0                	call   *%rax
+  8062a5:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8062a8:	75 07                	jne    8062b1 <sem_trywait+0x38>
+      return 0;
+  8062aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062af:	eb 14                	jmp    8062c5 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8062b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062b5:	8b 00                	mov    (%rax),%eax
+  8062b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8062ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8062be:	75 c7                	jne    806287 <sem_trywait+0xe>
+  return -E_BUSY;
+  8062c0:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8062c5:	c9                   	leave
+  8062c6:	c3                   	ret
+
+00000000008062c7 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  8062c7:	55                   	push   %rbp
+  8062c8:	48 89 e5             	mov    %rsp,%rbp
+  8062cb:	48 83 ec 30          	sub    $0x30,%rsp
+  8062cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8062d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  8062d7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8062de:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  8062df:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8062e4:	0f 84 fb 00 00 00    	je     8063e5 <sem_timedwait+0x11e>
+  8062ea:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8062ef:	0f 84 f0 00 00 00    	je     8063e5 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  8062f5:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  8062fc:	00 00 00 
+  8062ff:	ff d0                	call   *%rax
+  806301:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806305:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806309:	48 f7 d0             	not    %rax
+  80630c:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  806310:	73 0d                	jae    80631f <sem_timedwait+0x58>
+  806312:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806316:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80631a:	48 01 d0             	add    %rdx,%rax
+  80631d:	eb 07                	jmp    806326 <sem_timedwait+0x5f>
+  80631f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  806326:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  80632a:	e9 b6 00 00 00       	jmp    8063e5 <sem_timedwait+0x11e>
+    if (deadline) {
+  80632f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  806334:	74 2d                	je     806363 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  806336:	48 b8 55 58 80 00 00 	movabs $0x805855,%rax
+  80633d:	00 00 00 
+  806340:	ff d0                	call   *%rax
+  806342:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  806346:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80634a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80634e:	73 0a                	jae    80635a <sem_timedwait+0x93>
+  806350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806354:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  806358:	eb 05                	jmp    80635f <sem_timedwait+0x98>
+  80635a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80635f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  806363:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806367:	48 83 c0 04          	add    $0x4,%rax
+  80636b:	be 01 00 00 00       	mov    $0x1,%esi
+  806370:	48 89 c7             	mov    %rax,%rdi
+  806373:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  80637a:	00 00 00 
+  80637d:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  80637f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806383:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806387:	be 00 00 00 00       	mov    $0x0,%esi
+  80638c:	48 89 c7             	mov    %rax,%rdi
+  80638f:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  806396:	00 00 00 
+  806399:	ff d0                	call   *%rax
+  80639b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80639e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063a2:	48 83 c0 04          	add    $0x4,%rax
+  8063a6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8063ab:	48 89 c7             	mov    %rax,%rdi
+  8063ae:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  8063b5:	00 00 00 
+  8063b8:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8063ba:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8063be:	75 25                	jne    8063e5 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8063c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063c4:	48 89 c7             	mov    %rax,%rdi
+  8063c7:	48 b8 79 62 80 00 00 	movabs $0x806279,%rax
+  8063ce:	00 00 00 
+  8063d1:	ff d0                	call   *%rax
+  8063d3:	85 c0                	test   %eax,%eax
+  8063d5:	79 07                	jns    8063de <sem_timedwait+0x117>
+  8063d7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8063dc:	eb 27                	jmp    806405 <sem_timedwait+0x13e>
+  8063de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063e3:	eb 20                	jmp    806405 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  8063e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063e9:	48 89 c7             	mov    %rax,%rdi
+  8063ec:	48 b8 79 62 80 00 00 	movabs $0x806279,%rax
+  8063f3:	00 00 00 
+  8063f6:	ff d0                	call   *%rax
+  8063f8:	85 c0                	test   %eax,%eax
+  8063fa:	0f 88 2f ff ff ff    	js     80632f <sem_timedwait+0x68>
+  return 0;
+  806400:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806405:	c9                   	leave
+  806406:	c3                   	ret
+
+0000000000806407 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806407:	55                   	push   %rbp
+  806408:	48 89 e5             	mov    %rsp,%rbp
+  80640b:	48 83 ec 10          	sub    $0x10,%rsp
+  80640f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  806413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806417:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  80641e:	48 89 c7             	mov    %rax,%rdi
+  806421:	48 b8 c7 62 80 00 00 	movabs $0x8062c7,%rax
+  806428:	00 00 00 
+  80642b:	ff d0                	call   *%rax
+}
+  80642d:	90                   	nop
+  80642e:	c9                   	leave
+  80642f:	c3                   	ret
+
+0000000000806430 <sem_post>:
+sem_post(struct Semaphore *s) {
+  806430:	55                   	push   %rbp
+  806431:	48 89 e5             	mov    %rsp,%rbp
+  806434:	48 83 ec 10          	sub    $0x10,%rsp
+  806438:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  80643c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806440:	be 01 00 00 00       	mov    $0x1,%esi
+  806445:	48 89 c7             	mov    %rax,%rdi
+  806448:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  80644f:	00 00 00 
+  806452:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  806454:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806458:	8b 40 04             	mov    0x4(%rax),%eax
+  80645b:	85 c0                	test   %eax,%eax
+  80645d:	74 18                	je     806477 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  80645f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806463:	be 01 00 00 00       	mov    $0x1,%esi
+  806468:	48 89 c7             	mov    %rax,%rdi
+  80646b:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  806472:	00 00 00 
+  806475:	ff d0                	call   *%rax
+}
+  806477:	90                   	nop
+  806478:	c9                   	leave
+  806479:	c3                   	ret
+  80647a:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,10336 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 08 04 00 00       	call   800434 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <primeproc>:
+// of main and user/idle.
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  80003a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  int i, id, p, pfd[2], wfd, r;
+
+  // fetch a prime from our left neighbor
+top:
+  if ((r = readn(fd, &p, 4)) != 4)
+  80003d:	48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+  800041:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800044:	ba 04 00 00 00       	mov    $0x4,%edx
+  800049:	48 89 ce             	mov    %rcx,%rsi
+  80004c:	89 c7                	mov    %eax,%edi
+  80004e:	48 b8 cd 3a 80 00 00 	movabs $0x803acd,%rax
+  800055:	00 00 00 
+  800058:	ff d0                	call   *%rax
+  80005a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80005d:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+  800061:	74 46                	je     8000a9 <primeproc+0x77>
+    panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  800063:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80006b:	85 c0                	test   %eax,%eax
+  80006d:	0f 4e d0             	cmovle %eax,%edx
+  800070:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800073:	41 89 d0             	mov    %edx,%r8d
+  800076:	89 c1                	mov    %eax,%ecx
+  800078:	48 b8 00 67 80 00 00 	movabs $0x806700,%rax
+  80007f:	00 00 00 
+  800082:	48 89 c2             	mov    %rax,%rdx
+  800085:	be 14 00 00 00       	mov    $0x14,%esi
+  80008a:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800091:	00 00 00 
+  800094:	48 89 c7             	mov    %rax,%rdi
+  800097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009c:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8000a3:	00 00 00 
+  8000a6:	41 ff d1             	call   *%r9
+
+  cprintf("%d\n", p);
+  8000a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ac:	89 c6                	mov    %eax,%esi
+  8000ae:	48 b8 41 67 80 00 00 	movabs $0x806741,%rax
+  8000b5:	00 00 00 
+  8000b8:	48 89 c7             	mov    %rax,%rdi
+  8000bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c0:	48 ba fa 06 80 00 00 	movabs $0x8006fa,%rdx
+  8000c7:	00 00 00 
+  8000ca:	ff d2                	call   *%rdx
+
+  // fork a right neighbor to continue the chain
+  if ((i = pipe(pfd)) < 0)
+  8000cc:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+  8000d0:	48 89 c7             	mov    %rax,%rdi
+  8000d3:	48 b8 6b 48 80 00 00 	movabs $0x80486b,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+  8000df:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8000e2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	79 36                	jns    80011f <primeproc+0xed>
+    panic("pipe: %i", i);
+  8000e9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8000ec:	89 c1                	mov    %eax,%ecx
+  8000ee:	48 b8 45 67 80 00 00 	movabs $0x806745,%rax
+  8000f5:	00 00 00 
+  8000f8:	48 89 c2             	mov    %rax,%rdx
+  8000fb:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800100:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800107:	00 00 00 
+  80010a:	48 89 c7             	mov    %rax,%rdi
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800112:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  800119:	00 00 00 
+  80011c:	41 ff d0             	call   *%r8
+  if ((id = fork()) < 0)
+  80011f:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  800126:	00 00 00 
+  800129:	ff d0                	call   *%rax
+  80012b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80012e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800132:	79 36                	jns    80016a <primeproc+0x138>
+    panic("fork: %i", id);
+  800134:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800137:	89 c1                	mov    %eax,%ecx
+  800139:	48 b8 4e 67 80 00 00 	movabs $0x80674e,%rax
+  800140:	00 00 00 
+  800143:	48 89 c2             	mov    %rax,%rdx
+  800146:	be 1c 00 00 00       	mov    $0x1c,%esi
+  80014b:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800152:	00 00 00 
+  800155:	48 89 c7             	mov    %rax,%rdi
+  800158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015d:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  800164:	00 00 00 
+  800167:	41 ff d0             	call   *%r8
+  if (id == 0) {
+  80016a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80016e:	75 2d                	jne    80019d <primeproc+0x16b>
+    close(fd);
+  800170:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  80017c:	00 00 00 
+  80017f:	ff d0                	call   *%rax
+    close(pfd[1]);
+  800181:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800184:	89 c7                	mov    %eax,%edi
+  800186:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  80018d:	00 00 00 
+  800190:	ff d0                	call   *%rax
+    fd = pfd[0];
+  800192:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800195:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    goto top;
+  800198:	e9 a0 fe ff ff       	jmp    80003d <primeproc+0xb>
+  }
+
+  close(pfd[0]);
+  80019d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001a0:	89 c7                	mov    %eax,%edi
+  8001a2:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  8001a9:	00 00 00 
+  8001ac:	ff d0                	call   *%rax
+  wfd = pfd[1];
+  8001ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001b1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+
+  // filter out multiples of our prime
+  for (;;) {
+    if ((r = readn(fd, &i, 4)) != 4)
+  8001b4:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8001b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001bb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8001c0:	48 89 ce             	mov    %rcx,%rsi
+  8001c3:	89 c7                	mov    %eax,%edi
+  8001c5:	48 b8 cd 3a 80 00 00 	movabs $0x803acd,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+  8001d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8001d4:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+  8001d8:	74 54                	je     80022e <primeproc+0x1fc>
+      panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e2:	85 c0                	test   %eax,%eax
+  8001e4:	0f 4e d0             	cmovle %eax,%edx
+  8001e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001ea:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8001ed:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8001f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 f1             	mov    %esi,%r9d
+  8001f8:	41 89 c8             	mov    %ecx,%r8d
+  8001fb:	89 c1                	mov    %eax,%ecx
+  8001fd:	48 b8 57 67 80 00 00 	movabs $0x806757,%rax
+  800204:	00 00 00 
+  800207:	48 89 c2             	mov    %rax,%rdx
+  80020a:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020f:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800216:	00 00 00 
+  800219:	48 89 c7             	mov    %rax,%rdi
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	49 ba db 04 80 00 00 	movabs $0x8004db,%r10
+  800228:	00 00 00 
+  80022b:	41 ff d2             	call   *%r10
+    if (i % p)
+  80022e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800231:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800234:	99                   	cltd
+  800235:	f7 f9                	idiv   %ecx
+  800237:	89 d0                	mov    %edx,%eax
+  800239:	85 c0                	test   %eax,%eax
+  80023b:	0f 84 73 ff ff ff    	je     8001b4 <primeproc+0x182>
+      if ((r = write(wfd, &i, 4)) != 4)
+  800241:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  800245:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800248:	ba 04 00 00 00       	mov    $0x4,%edx
+  80024d:	48 89 ce             	mov    %rcx,%rsi
+  800250:	89 c7                	mov    %eax,%edi
+  800252:	48 b8 47 3b 80 00 00 	movabs $0x803b47,%rax
+  800259:	00 00 00 
+  80025c:	ff d0                	call   *%rax
+  80025e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800261:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+  800265:	0f 84 49 ff ff ff    	je     8001b4 <primeproc+0x182>
+        panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  80026b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80026e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800273:	85 c0                	test   %eax,%eax
+  800275:	89 d1                	mov    %edx,%ecx
+  800277:	0f 4e c8             	cmovle %eax,%ecx
+  80027a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80027d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800280:	41 89 c9             	mov    %ecx,%r9d
+  800283:	41 89 d0             	mov    %edx,%r8d
+  800286:	89 c1                	mov    %eax,%ecx
+  800288:	48 b8 73 67 80 00 00 	movabs $0x806773,%rax
+  80028f:	00 00 00 
+  800292:	48 89 c2             	mov    %rax,%rdx
+  800295:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80029a:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  8002a1:	00 00 00 
+  8002a4:	48 89 c7             	mov    %rax,%rdi
+  8002a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ac:	49 ba db 04 80 00 00 	movabs $0x8004db,%r10
+  8002b3:	00 00 00 
+  8002b6:	41 ff d2             	call   *%r10
+
+00000000008002b9 <umain>:
+  }
+}
+
+void
+umain(int argc, char **argv) {
+  8002b9:	55                   	push   %rbp
+  8002ba:	48 89 e5             	mov    %rsp,%rbp
+  8002bd:	48 83 ec 30          	sub    $0x30,%rsp
+  8002c1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8002c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int i, id, p[2], r;
+
+  binaryname = "primespipe";
+  8002c8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8002cf:	00 00 00 
+  8002d2:	48 b9 8d 67 80 00 00 	movabs $0x80678d,%rcx
+  8002d9:	00 00 00 
+  8002dc:	48 89 08             	mov    %rcx,(%rax)
+
+  if ((i = pipe(p)) < 0)
+  8002df:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  8002e3:	48 89 c7             	mov    %rax,%rdi
+  8002e6:	48 b8 6b 48 80 00 00 	movabs $0x80486b,%rax
+  8002ed:	00 00 00 
+  8002f0:	ff d0                	call   *%rax
+  8002f2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8002f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8002f8:	85 c0                	test   %eax,%eax
+  8002fa:	79 36                	jns    800332 <umain+0x79>
+    panic("pipe: %i", i);
+  8002fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8002ff:	89 c1                	mov    %eax,%ecx
+  800301:	48 b8 45 67 80 00 00 	movabs $0x806745,%rax
+  800308:	00 00 00 
+  80030b:	48 89 c2             	mov    %rax,%rdx
+  80030e:	be 38 00 00 00       	mov    $0x38,%esi
+  800313:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  80031a:	00 00 00 
+  80031d:	48 89 c7             	mov    %rax,%rdi
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  80032c:	00 00 00 
+  80032f:	41 ff d0             	call   *%r8
+
+  // fork the first prime process in the chain
+  if ((id = fork()) < 0)
+  800332:	48 b8 11 33 80 00 00 	movabs $0x803311,%rax
+  800339:	00 00 00 
+  80033c:	ff d0                	call   *%rax
+  80033e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800341:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800345:	79 36                	jns    80037d <umain+0xc4>
+    panic("fork: %i", id);
+  800347:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80034a:	89 c1                	mov    %eax,%ecx
+  80034c:	48 b8 4e 67 80 00 00 	movabs $0x80674e,%rax
+  800353:	00 00 00 
+  800356:	48 89 c2             	mov    %rax,%rdx
+  800359:	be 3c 00 00 00       	mov    $0x3c,%esi
+  80035e:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800365:	00 00 00 
+  800368:	48 89 c7             	mov    %rax,%rdi
+  80036b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800370:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  800377:	00 00 00 
+  80037a:	41 ff d0             	call   *%r8
+
+  if (id == 0) {
+  80037d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800381:	75 22                	jne    8003a5 <umain+0xec>
+    close(p[1]);
+  800383:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800386:	89 c7                	mov    %eax,%edi
+  800388:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  80038f:	00 00 00 
+  800392:	ff d0                	call   *%rax
+    primeproc(p[0]);
+  800394:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800397:	89 c7                	mov    %eax,%edi
+  800399:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003a0:	00 00 00 
+  8003a3:	ff d0                	call   *%rax
+  }
+
+  close(p[0]);
+  8003a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003a8:	89 c7                	mov    %eax,%edi
+  8003aa:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+
+  // feed all the integers through
+  for (i = 2;; i++)
+  8003b6:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%rbp)
+    if ((r = write(p[1], &i, 4)) != 4)
+  8003bd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8003c0:	48 8d 4d f4          	lea    -0xc(%rbp),%rcx
+  8003c4:	ba 04 00 00 00       	mov    $0x4,%edx
+  8003c9:	48 89 ce             	mov    %rcx,%rsi
+  8003cc:	89 c7                	mov    %eax,%edi
+  8003ce:	48 b8 47 3b 80 00 00 	movabs $0x803b47,%rax
+  8003d5:	00 00 00 
+  8003d8:	ff d0                	call   *%rax
+  8003da:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8003dd:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+  8003e1:	74 46                	je     800429 <umain+0x170>
+      panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  8003e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8003e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003eb:	85 c0                	test   %eax,%eax
+  8003ed:	0f 4e d0             	cmovle %eax,%edx
+  8003f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8003f3:	41 89 d0             	mov    %edx,%r8d
+  8003f6:	89 c1                	mov    %eax,%ecx
+  8003f8:	48 b8 98 67 80 00 00 	movabs $0x806798,%rax
+  8003ff:	00 00 00 
+  800402:	48 89 c2             	mov    %rax,%rdx
+  800405:	be 48 00 00 00       	mov    $0x48,%esi
+  80040a:	48 b8 2f 67 80 00 00 	movabs $0x80672f,%rax
+  800411:	00 00 00 
+  800414:	48 89 c7             	mov    %rax,%rdi
+  800417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041c:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  800423:	00 00 00 
+  800426:	41 ff d1             	call   *%r9
+  for (i = 2;; i++)
+  800429:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80042c:	83 c0 01             	add    $0x1,%eax
+  80042f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if ((r = write(p[1], &i, 4)) != 4)
+  800432:	eb 89                	jmp    8003bd <umain+0x104>
+
+0000000000800434 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+  800438:	48 83 ec 20          	sub    $0x20,%rsp
+  80043c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80043f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800443:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80044a:	00 00 00 
+  80044d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800451:	eb 13                	jmp    800466 <libmain+0x32>
+    (*ctor)();
+  800453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800457:	48 8b 10             	mov    (%rax),%rdx
+  80045a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045f:	ff d2                	call   *%rdx
+    ctor++;
+  800461:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800466:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80046d:	00 00 00 
+  800470:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800474:	72 dd                	jb     800453 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800476:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80047a:	7e 14                	jle    800490 <libmain+0x5c>
+    binaryname = argv[0];
+  80047c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800480:	48 8b 00             	mov    (%rax),%rax
+  800483:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80048a:	00 00 00 
+  80048d:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800490:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800494:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800497:	48 89 d6             	mov    %rdx,%rsi
+  80049a:	89 c7                	mov    %eax,%edi
+  80049c:	48 b8 b9 02 80 00 00 	movabs $0x8002b9,%rax
+  8004a3:	00 00 00 
+  8004a6:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8004a8:	48 b8 b7 04 80 00 00 	movabs $0x8004b7,%rax
+  8004af:	00 00 00 
+  8004b2:	ff d0                	call   *%rax
+#endif
+}
+  8004b4:	90                   	nop
+  8004b5:	c9                   	leave
+  8004b6:	c3                   	ret
+
+00000000008004b7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004b7:	55                   	push   %rbp
+  8004b8:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8004bb:	48 b8 2f 37 80 00 00 	movabs $0x80372f,%rax
+  8004c2:	00 00 00 
+  8004c5:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8004c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004cc:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+}
+  8004d8:	90                   	nop
+  8004d9:	5d                   	pop    %rbp
+  8004da:	c3                   	ret
+
+00000000008004db <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004db:	55                   	push   %rbp
+  8004dc:	48 89 e5             	mov    %rsp,%rbp
+  8004df:	53                   	push   %rbx
+  8004e0:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004e7:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8004ee:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8004f4:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8004fb:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800502:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800509:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800510:	84 c0                	test   %al,%al
+  800512:	74 23                	je     800537 <_panic+0x5c>
+  800514:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80051b:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80051f:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800523:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800527:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80052b:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80052f:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800533:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800537:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80053e:	00 00 00 
+  800541:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800548:	00 00 00 
+  80054b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054f:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800556:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80055d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800564:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80056b:	00 00 00 
+  80056e:	48 8b 18             	mov    (%rax),%rbx
+  800571:	48 b8 ff 23 80 00 00 	movabs $0x8023ff,%rax
+  800578:	00 00 00 
+  80057b:	ff d0                	call   *%rax
+  80057d:	89 c6                	mov    %eax,%esi
+  80057f:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800585:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80058c:	41 89 d0             	mov    %edx,%r8d
+  80058f:	48 89 c1             	mov    %rax,%rcx
+  800592:	48 89 da             	mov    %rbx,%rdx
+  800595:	48 b8 c0 67 80 00 00 	movabs $0x8067c0,%rax
+  80059c:	00 00 00 
+  80059f:	48 89 c7             	mov    %rax,%rdi
+  8005a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a7:	49 b9 fa 06 80 00 00 	movabs $0x8006fa,%r9
+  8005ae:	00 00 00 
+  8005b1:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8005b4:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8005bb:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005c2:	48 89 d6             	mov    %rdx,%rsi
+  8005c5:	48 89 c7             	mov    %rax,%rdi
+  8005c8:	48 b8 6f 06 80 00 00 	movabs $0x80066f,%rax
+  8005cf:	00 00 00 
+  8005d2:	ff d0                	call   *%rax
+  cprintf("\n");
+  8005d4:	48 b8 e3 67 80 00 00 	movabs $0x8067e3,%rax
+  8005db:	00 00 00 
+  8005de:	48 89 c7             	mov    %rax,%rdi
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e6:	48 ba fa 06 80 00 00 	movabs $0x8006fa,%rdx
+  8005ed:	00 00 00 
+  8005f0:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8005f2:	cc                   	int3
+  8005f3:	eb fd                	jmp    8005f2 <_panic+0x117>
+
+00000000008005f5 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8005f5:	55                   	push   %rbp
+  8005f6:	48 89 e5             	mov    %rsp,%rbp
+  8005f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8005fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800600:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800604:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800608:	8b 00                	mov    (%rax),%eax
+  80060a:	8d 48 01             	lea    0x1(%rax),%ecx
+  80060d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800611:	89 0a                	mov    %ecx,(%rdx)
+  800613:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800616:	89 d1                	mov    %edx,%ecx
+  800618:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80061c:	48 98                	cltq
+  80061e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800622:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800626:	8b 00                	mov    (%rax),%eax
+  800628:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80062d:	75 2c                	jne    80065b <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80062f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800633:	8b 00                	mov    (%rax),%eax
+  800635:	48 98                	cltq
+  800637:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80063b:	48 83 c2 08          	add    $0x8,%rdx
+  80063f:	48 89 c6             	mov    %rax,%rsi
+  800642:	48 89 d7             	mov    %rdx,%rdi
+  800645:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  80064c:	00 00 00 
+  80064f:	ff d0                	call   *%rax
+    b->idx = 0;
+  800651:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800655:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80065b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80065f:	8b 40 04             	mov    0x4(%rax),%eax
+  800662:	8d 50 01             	lea    0x1(%rax),%edx
+  800665:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800669:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80066c:	90                   	nop
+  80066d:	c9                   	leave
+  80066e:	c3                   	ret
+
+000000000080066f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80067a:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800681:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800688:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80068f:	00 00 00 
+  b.cnt = 0;
+  800692:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800699:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80069c:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8006a3:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8006aa:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8006b1:	48 89 c6             	mov    %rax,%rsi
+  8006b4:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  8006bb:	00 00 00 
+  8006be:	48 89 c7             	mov    %rax,%rdi
+  8006c1:	48 b8 54 0a 80 00 00 	movabs $0x800a54,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8006cd:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8006d3:	48 98                	cltq
+  8006d5:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8006dc:	48 83 c2 08          	add    $0x8,%rdx
+  8006e0:	48 89 c6             	mov    %rax,%rsi
+  8006e3:	48 89 d7             	mov    %rdx,%rdi
+  8006e6:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  8006ed:	00 00 00 
+  8006f0:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8006f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8006f8:	c9                   	leave
+  8006f9:	c3                   	ret
+
+00000000008006fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006fa:	55                   	push   %rbp
+  8006fb:	48 89 e5             	mov    %rsp,%rbp
+  8006fe:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800705:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80070c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800713:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80071a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800721:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800728:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80072f:	84 c0                	test   %al,%al
+  800731:	74 20                	je     800753 <cprintf+0x59>
+  800733:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800737:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80073b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80073f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800743:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800747:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80074b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80074f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800753:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80075a:	00 00 00 
+  80075d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800764:	00 00 00 
+  800767:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80076b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800772:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800779:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800780:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800787:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80078e:	48 89 d6             	mov    %rdx,%rsi
+  800791:	48 89 c7             	mov    %rax,%rdi
+  800794:	48 b8 6f 06 80 00 00 	movabs $0x80066f,%rax
+  80079b:	00 00 00 
+  80079e:	ff d0                	call   *%rax
+  8007a0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8007a6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+
+00000000008007ae <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8007ae:	55                   	push   %rbp
+  8007af:	48 89 e5             	mov    %rsp,%rbp
+  8007b2:	48 83 ec 30          	sub    $0x30,%rsp
+  8007b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8007be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8007c2:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8007c5:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8007c9:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8007cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8007d0:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8007d4:	72 54                	jb     80082a <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007d6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8007d9:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8007dc:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8007df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007e8:	48 f7 f6             	div    %rsi
+  8007eb:	49 89 c2             	mov    %rax,%r10
+  8007ee:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8007f1:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8007f4:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8007f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007fc:	41 89 c9             	mov    %ecx,%r9d
+  8007ff:	41 89 f8             	mov    %edi,%r8d
+  800802:	89 d1                	mov    %edx,%ecx
+  800804:	4c 89 d2             	mov    %r10,%rdx
+  800807:	48 89 c7             	mov    %rax,%rdi
+  80080a:	48 b8 ae 07 80 00 00 	movabs $0x8007ae,%rax
+  800811:	00 00 00 
+  800814:	ff d0                	call   *%rax
+  800816:	eb 1c                	jmp    800834 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800818:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80081c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80081f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800823:	48 89 d6             	mov    %rdx,%rsi
+  800826:	89 c7                	mov    %eax,%edi
+  800828:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80082a:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80082e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800832:	7f e4                	jg     800818 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800834:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800837:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800840:	48 f7 f1             	div    %rcx
+  800843:	48 b8 30 6a 80 00 00 	movabs $0x806a30,%rax
+  80084a:	00 00 00 
+  80084d:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800851:	0f be c0             	movsbl %al,%eax
+  800854:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800858:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80085c:	48 89 d6             	mov    %rdx,%rsi
+  80085f:	89 c7                	mov    %eax,%edi
+  800861:	ff d1                	call   *%rcx
+}
+  800863:	90                   	nop
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+
+0000000000800866 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800866:	55                   	push   %rbp
+  800867:	48 89 e5             	mov    %rsp,%rbp
+  80086a:	48 83 ec 10          	sub    $0x10,%rsp
+  80086e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800872:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800875:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800879:	7e 4b                	jle    8008c6 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80087b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087f:	8b 00                	mov    (%rax),%eax
+  800881:	83 f8 2f             	cmp    $0x2f,%eax
+  800884:	77 24                	ja     8008aa <getuint+0x44>
+  800886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80088e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800892:	8b 00                	mov    (%rax),%eax
+  800894:	89 c0                	mov    %eax,%eax
+  800896:	48 01 d0             	add    %rdx,%rax
+  800899:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80089d:	8b 12                	mov    (%rdx),%edx
+  80089f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a6:	89 0a                	mov    %ecx,(%rdx)
+  8008a8:	eb 14                	jmp    8008be <getuint+0x58>
+  8008aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008b2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ba:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008be:	48 8b 00             	mov    (%rax),%rax
+  8008c1:	e9 95 00 00 00       	jmp    80095b <getuint+0xf5>
+  else if (lflag)
+  8008c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008ca:	74 48                	je     800914 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8008cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d0:	8b 00                	mov    (%rax),%eax
+  8008d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d5:	77 24                	ja     8008fb <getuint+0x95>
+  8008d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e3:	8b 00                	mov    (%rax),%eax
+  8008e5:	89 c0                	mov    %eax,%eax
+  8008e7:	48 01 d0             	add    %rdx,%rax
+  8008ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ee:	8b 12                	mov    (%rdx),%edx
+  8008f0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008f7:	89 0a                	mov    %ecx,(%rdx)
+  8008f9:	eb 14                	jmp    80090f <getuint+0xa9>
+  8008fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800903:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800907:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80090b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80090f:	48 8b 00             	mov    (%rax),%rax
+  800912:	eb 47                	jmp    80095b <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800918:	8b 00                	mov    (%rax),%eax
+  80091a:	83 f8 2f             	cmp    $0x2f,%eax
+  80091d:	77 24                	ja     800943 <getuint+0xdd>
+  80091f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800923:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80092b:	8b 00                	mov    (%rax),%eax
+  80092d:	89 c0                	mov    %eax,%eax
+  80092f:	48 01 d0             	add    %rdx,%rax
+  800932:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800936:	8b 12                	mov    (%rdx),%edx
+  800938:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80093b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80093f:	89 0a                	mov    %ecx,(%rdx)
+  800941:	eb 14                	jmp    800957 <getuint+0xf1>
+  800943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800947:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80094b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80094f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800953:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800957:	8b 00                	mov    (%rax),%eax
+  800959:	89 c0                	mov    %eax,%eax
+}
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+000000000080095d <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80095d:	55                   	push   %rbp
+  80095e:	48 89 e5             	mov    %rsp,%rbp
+  800961:	48 83 ec 10          	sub    $0x10,%rsp
+  800965:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800969:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80096c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800970:	7e 4b                	jle    8009bd <getint+0x60>
+    return va_arg(*ap, long long);
+  800972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800976:	8b 00                	mov    (%rax),%eax
+  800978:	83 f8 2f             	cmp    $0x2f,%eax
+  80097b:	77 24                	ja     8009a1 <getint+0x44>
+  80097d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800981:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800985:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800989:	8b 00                	mov    (%rax),%eax
+  80098b:	89 c0                	mov    %eax,%eax
+  80098d:	48 01 d0             	add    %rdx,%rax
+  800990:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800994:	8b 12                	mov    (%rdx),%edx
+  800996:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800999:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80099d:	89 0a                	mov    %ecx,(%rdx)
+  80099f:	eb 14                	jmp    8009b5 <getint+0x58>
+  8009a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009a9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009b5:	48 8b 00             	mov    (%rax),%rax
+  8009b8:	e9 95 00 00 00       	jmp    800a52 <getint+0xf5>
+  else if (lflag)
+  8009bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009c1:	74 48                	je     800a0b <getint+0xae>
+    return va_arg(*ap, long);
+  8009c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009c7:	8b 00                	mov    (%rax),%eax
+  8009c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cc:	77 24                	ja     8009f2 <getint+0x95>
+  8009ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009da:	8b 00                	mov    (%rax),%eax
+  8009dc:	89 c0                	mov    %eax,%eax
+  8009de:	48 01 d0             	add    %rdx,%rax
+  8009e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009e5:	8b 12                	mov    (%rdx),%edx
+  8009e7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009ee:	89 0a                	mov    %ecx,(%rdx)
+  8009f0:	eb 14                	jmp    800a06 <getint+0xa9>
+  8009f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009fa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a02:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a06:	48 8b 00             	mov    (%rax),%rax
+  800a09:	eb 47                	jmp    800a52 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800a0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a0f:	8b 00                	mov    (%rax),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 24                	ja     800a3a <getint+0xdd>
+  800a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a22:	8b 00                	mov    (%rax),%eax
+  800a24:	89 c0                	mov    %eax,%eax
+  800a26:	48 01 d0             	add    %rdx,%rax
+  800a29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a2d:	8b 12                	mov    (%rdx),%edx
+  800a2f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a32:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a36:	89 0a                	mov    %ecx,(%rdx)
+  800a38:	eb 14                	jmp    800a4e <getint+0xf1>
+  800a3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a3e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a42:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a4a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a4e:	8b 00                	mov    (%rax),%eax
+  800a50:	48 98                	cltq
+}
+  800a52:	c9                   	leave
+  800a53:	c3                   	ret
+
+0000000000800a54 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800a54:	55                   	push   %rbp
+  800a55:	48 89 e5             	mov    %rsp,%rbp
+  800a58:	41 54                	push   %r12
+  800a5a:	53                   	push   %rbx
+  800a5b:	48 83 ec 60          	sub    $0x60,%rsp
+  800a5f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800a63:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800a67:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a6b:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800a6f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a73:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a77:	48 8b 06             	mov    (%rsi),%rax
+  800a7a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a7e:	48 89 01             	mov    %rax,(%rcx)
+  800a81:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a85:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a89:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a8d:	eb 17                	jmp    800aa6 <vprintfmt+0x52>
+      if (ch == '\0')
+  800a8f:	85 db                	test   %ebx,%ebx
+  800a91:	0f 84 bf 04 00 00    	je     800f56 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800a97:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a9f:	48 89 c6             	mov    %rax,%rsi
+  800aa2:	89 df                	mov    %ebx,%edi
+  800aa4:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800aa6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800aaa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aae:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800ab2:	0f b6 00             	movzbl (%rax),%eax
+  800ab5:	0f b6 d8             	movzbl %al,%ebx
+  800ab8:	83 fb 25             	cmp    $0x25,%ebx
+  800abb:	75 d2                	jne    800a8f <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800abd:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800ac1:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800ac8:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800acf:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800ad6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800add:	eb 04                	jmp    800ae3 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800adf:	90                   	nop
+  800ae0:	eb 01                	jmp    800ae3 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800ae2:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800ae3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ae7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aeb:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800aef:	0f b6 00             	movzbl (%rax),%eax
+  800af2:	0f b6 d8             	movzbl %al,%ebx
+  800af5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800af8:	83 f8 55             	cmp    $0x55,%eax
+  800afb:	0f 87 22 04 00 00    	ja     800f23 <vprintfmt+0x4cf>
+  800b01:	89 c0                	mov    %eax,%eax
+  800b03:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b0a:	00 
+  800b0b:	48 b8 58 6a 80 00 00 	movabs $0x806a58,%rax
+  800b12:	00 00 00 
+  800b15:	48 01 d0             	add    %rdx,%rax
+  800b18:	48 8b 00             	mov    (%rax),%rax
+  800b1b:	ff e0                	jmp    *%rax
+        padc = '-';
+  800b1d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800b21:	eb c0                	jmp    800ae3 <vprintfmt+0x8f>
+        padc = '0';
+  800b23:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800b27:	eb ba                	jmp    800ae3 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800b29:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b30:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800b33:	89 d0                	mov    %edx,%eax
+  800b35:	c1 e0 02             	shl    $0x2,%eax
+  800b38:	01 d0                	add    %edx,%eax
+  800b3a:	01 c0                	add    %eax,%eax
+  800b3c:	01 d8                	add    %ebx,%eax
+  800b3e:	83 e8 30             	sub    $0x30,%eax
+  800b41:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800b44:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b48:	0f b6 00             	movzbl (%rax),%eax
+  800b4b:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800b4e:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b51:	7e 60                	jle    800bb3 <vprintfmt+0x15f>
+  800b53:	83 fb 39             	cmp    $0x39,%ebx
+  800b56:	7f 5b                	jg     800bb3 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800b58:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b5d:	eb d1                	jmp    800b30 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b62:	83 f8 2f             	cmp    $0x2f,%eax
+  800b65:	77 17                	ja     800b7e <vprintfmt+0x12a>
+  800b67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b6b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b6e:	89 d2                	mov    %edx,%edx
+  800b70:	48 01 d0             	add    %rdx,%rax
+  800b73:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b76:	83 c2 08             	add    $0x8,%edx
+  800b79:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b7c:	eb 0c                	jmp    800b8a <vprintfmt+0x136>
+  800b7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b82:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b86:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b8a:	8b 00                	mov    (%rax),%eax
+  800b8c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800b8f:	eb 23                	jmp    800bb4 <vprintfmt+0x160>
+        if (width < 0)
+  800b91:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b95:	0f 89 44 ff ff ff    	jns    800adf <vprintfmt+0x8b>
+          width = 0;
+  800b9b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800ba2:	e9 38 ff ff ff       	jmp    800adf <vprintfmt+0x8b>
+        altflag = 1;
+  800ba7:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800bae:	e9 30 ff ff ff       	jmp    800ae3 <vprintfmt+0x8f>
+        goto process_precision;
+  800bb3:	90                   	nop
+        if (width < 0)
+  800bb4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bb8:	0f 89 24 ff ff ff    	jns    800ae2 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800bbe:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800bc1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800bc4:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800bcb:	e9 12 ff ff ff       	jmp    800ae2 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800bd0:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800bd4:	e9 0a ff ff ff       	jmp    800ae3 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 17                	ja     800bf8 <vprintfmt+0x1a4>
+  800be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800be5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800be8:	89 d2                	mov    %edx,%edx
+  800bea:	48 01 d0             	add    %rdx,%rax
+  800bed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bf0:	83 c2 08             	add    $0x8,%edx
+  800bf3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bf6:	eb 0c                	jmp    800c04 <vprintfmt+0x1b0>
+  800bf8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bfc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c00:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c04:	8b 00                	mov    (%rax),%eax
+  800c06:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c0a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c0e:	48 89 d6             	mov    %rdx,%rsi
+  800c11:	89 c7                	mov    %eax,%edi
+  800c13:	ff d1                	call   *%rcx
+        break;
+  800c15:	e9 37 03 00 00       	jmp    800f51 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800c1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c20:	77 17                	ja     800c39 <vprintfmt+0x1e5>
+  800c22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c26:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c29:	89 d2                	mov    %edx,%edx
+  800c2b:	48 01 d0             	add    %rdx,%rax
+  800c2e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c31:	83 c2 08             	add    $0x8,%edx
+  800c34:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c37:	eb 0c                	jmp    800c45 <vprintfmt+0x1f1>
+  800c39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c41:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c45:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800c47:	85 db                	test   %ebx,%ebx
+  800c49:	79 02                	jns    800c4d <vprintfmt+0x1f9>
+          err = -err;
+  800c4b:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c4d:	83 fb 15             	cmp    $0x15,%ebx
+  800c50:	7f 16                	jg     800c68 <vprintfmt+0x214>
+  800c52:	48 ba 80 69 80 00 00 	movabs $0x806980,%rdx
+  800c59:	00 00 00 
+  800c5c:	48 63 c3             	movslq %ebx,%rax
+  800c5f:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800c63:	4d 85 e4             	test   %r12,%r12
+  800c66:	75 2e                	jne    800c96 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800c68:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c6c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c70:	89 d9                	mov    %ebx,%ecx
+  800c72:	48 ba 41 6a 80 00 00 	movabs $0x806a41,%rdx
+  800c79:	00 00 00 
+  800c7c:	48 89 c7             	mov    %rax,%rdi
+  800c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c84:	49 b8 60 0f 80 00 00 	movabs $0x800f60,%r8
+  800c8b:	00 00 00 
+  800c8e:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800c91:	e9 bb 02 00 00       	jmp    800f51 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800c96:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c9e:	4c 89 e1             	mov    %r12,%rcx
+  800ca1:	48 ba 4a 6a 80 00 00 	movabs $0x806a4a,%rdx
+  800ca8:	00 00 00 
+  800cab:	48 89 c7             	mov    %rax,%rdi
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb3:	49 b8 60 0f 80 00 00 	movabs $0x800f60,%r8
+  800cba:	00 00 00 
+  800cbd:	41 ff d0             	call   *%r8
+        break;
+  800cc0:	e9 8c 02 00 00       	jmp    800f51 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800cc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ccb:	77 17                	ja     800ce4 <vprintfmt+0x290>
+  800ccd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cd1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cd4:	89 d2                	mov    %edx,%edx
+  800cd6:	48 01 d0             	add    %rdx,%rax
+  800cd9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cdc:	83 c2 08             	add    $0x8,%edx
+  800cdf:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ce2:	eb 0c                	jmp    800cf0 <vprintfmt+0x29c>
+  800ce4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ce8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cf0:	4c 8b 20             	mov    (%rax),%r12
+  800cf3:	4d 85 e4             	test   %r12,%r12
+  800cf6:	75 0a                	jne    800d02 <vprintfmt+0x2ae>
+          p = "(null)";
+  800cf8:	49 bc 4d 6a 80 00 00 	movabs $0x806a4d,%r12
+  800cff:	00 00 00 
+        if (width > 0 && padc != '-')
+  800d02:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d06:	7e 78                	jle    800d80 <vprintfmt+0x32c>
+  800d08:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800d0c:	74 72                	je     800d80 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800d0e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800d11:	48 98                	cltq
+  800d13:	48 89 c6             	mov    %rax,%rsi
+  800d16:	4c 89 e7             	mov    %r12,%rdi
+  800d19:	48 b8 6c 16 80 00 00 	movabs $0x80166c,%rax
+  800d20:	00 00 00 
+  800d23:	ff d0                	call   *%rax
+  800d25:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800d28:	eb 17                	jmp    800d41 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800d2a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800d2e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d32:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d36:	48 89 d6             	mov    %rdx,%rsi
+  800d39:	89 c7                	mov    %eax,%edi
+  800d3b:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800d3d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d41:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d45:	7f e3                	jg     800d2a <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d47:	eb 37                	jmp    800d80 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800d49:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d4d:	74 1e                	je     800d6d <vprintfmt+0x319>
+  800d4f:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d52:	7e 05                	jle    800d59 <vprintfmt+0x305>
+  800d54:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d57:	7e 14                	jle    800d6d <vprintfmt+0x319>
+            putch('?', putdat);
+  800d59:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d5d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d61:	48 89 c6             	mov    %rax,%rsi
+  800d64:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d69:	ff d2                	call   *%rdx
+  800d6b:	eb 0f                	jmp    800d7c <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800d6d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d71:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d75:	48 89 c6             	mov    %rax,%rsi
+  800d78:	89 df                	mov    %ebx,%edi
+  800d7a:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d7c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d80:	4c 89 e0             	mov    %r12,%rax
+  800d83:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d87:	0f b6 00             	movzbl (%rax),%eax
+  800d8a:	0f be d8             	movsbl %al,%ebx
+  800d8d:	85 db                	test   %ebx,%ebx
+  800d8f:	74 28                	je     800db9 <vprintfmt+0x365>
+  800d91:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d95:	78 b2                	js     800d49 <vprintfmt+0x2f5>
+  800d97:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d9b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d9f:	79 a8                	jns    800d49 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800da1:	eb 16                	jmp    800db9 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800da3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800da7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dab:	48 89 c6             	mov    %rax,%rsi
+  800dae:	bf 20 00 00 00       	mov    $0x20,%edi
+  800db3:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800db5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800db9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800dbd:	7f e4                	jg     800da3 <vprintfmt+0x34f>
+        break;
+  800dbf:	e9 8d 01 00 00       	jmp    800f51 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800dc4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dc7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dcb:	89 d6                	mov    %edx,%esi
+  800dcd:	48 89 c7             	mov    %rax,%rdi
+  800dd0:	48 b8 5d 09 80 00 00 	movabs $0x80095d,%rax
+  800dd7:	00 00 00 
+  800dda:	ff d0                	call   *%rax
+  800ddc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800de0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800de4:	48 85 c0             	test   %rax,%rax
+  800de7:	79 1d                	jns    800e06 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800de9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ded:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800df1:	48 89 c6             	mov    %rax,%rsi
+  800df4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800df9:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800dfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dff:	48 f7 d8             	neg    %rax
+  800e02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800e06:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800e0d:	e9 d2 00 00 00       	jmp    800ee4 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800e12:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e15:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e19:	89 d6                	mov    %edx,%esi
+  800e1b:	48 89 c7             	mov    %rax,%rdi
+  800e1e:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  800e25:	00 00 00 
+  800e28:	ff d0                	call   *%rax
+  800e2a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800e2e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800e35:	e9 aa 00 00 00       	jmp    800ee4 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800e3a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e3d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e41:	89 d6                	mov    %edx,%esi
+  800e43:	48 89 c7             	mov    %rax,%rdi
+  800e46:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  800e4d:	00 00 00 
+  800e50:	ff d0                	call   *%rax
+  800e52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800e56:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800e5d:	e9 82 00 00 00       	jmp    800ee4 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800e62:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e66:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e6a:	48 89 c6             	mov    %rax,%rsi
+  800e6d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e72:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800e74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e78:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e7c:	48 89 c6             	mov    %rax,%rsi
+  800e7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e84:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800e86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e89:	83 f8 2f             	cmp    $0x2f,%eax
+  800e8c:	77 17                	ja     800ea5 <vprintfmt+0x451>
+  800e8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e92:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e95:	89 d2                	mov    %edx,%edx
+  800e97:	48 01 d0             	add    %rdx,%rax
+  800e9a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e9d:	83 c2 08             	add    $0x8,%edx
+  800ea0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ea3:	eb 0c                	jmp    800eb1 <vprintfmt+0x45d>
+  800ea5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ea9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ead:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800eb1:	48 8b 00             	mov    (%rax),%rax
+  800eb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800eb8:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800ebf:	eb 23                	jmp    800ee4 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ec1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ec4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ec8:	89 d6                	mov    %edx,%esi
+  800eca:	48 89 c7             	mov    %rax,%rdi
+  800ecd:	48 b8 66 08 80 00 00 	movabs $0x800866,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+  800ed9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800edd:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800ee4:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ee9:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800eec:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800eef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ef3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ef7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800efb:	45 89 c1             	mov    %r8d,%r9d
+  800efe:	41 89 f8             	mov    %edi,%r8d
+  800f01:	48 89 c7             	mov    %rax,%rdi
+  800f04:	48 b8 ae 07 80 00 00 	movabs $0x8007ae,%rax
+  800f0b:	00 00 00 
+  800f0e:	ff d0                	call   *%rax
+        break;
+  800f10:	eb 3f                	jmp    800f51 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800f12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f16:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f1a:	48 89 c6             	mov    %rax,%rsi
+  800f1d:	89 df                	mov    %ebx,%edi
+  800f1f:	ff d2                	call   *%rdx
+        break;
+  800f21:	eb 2e                	jmp    800f51 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800f23:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f27:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f2b:	48 89 c6             	mov    %rax,%rsi
+  800f2e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f33:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800f35:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f3a:	eb 05                	jmp    800f41 <vprintfmt+0x4ed>
+  800f3c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f41:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f45:	48 83 e8 01          	sub    $0x1,%rax
+  800f49:	0f b6 00             	movzbl (%rax),%eax
+  800f4c:	3c 25                	cmp    $0x25,%al
+  800f4e:	75 ec                	jne    800f3c <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800f50:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800f51:	e9 50 fb ff ff       	jmp    800aa6 <vprintfmt+0x52>
+        return;
+  800f56:	90                   	nop
+    }
+  }
+}
+  800f57:	48 83 c4 60          	add    $0x60,%rsp
+  800f5b:	5b                   	pop    %rbx
+  800f5c:	41 5c                	pop    %r12
+  800f5e:	5d                   	pop    %rbp
+  800f5f:	c3                   	ret
+
+0000000000800f60 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800f60:	55                   	push   %rbp
+  800f61:	48 89 e5             	mov    %rsp,%rbp
+  800f64:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f6b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f72:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f79:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f80:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f87:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f8e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f95:	84 c0                	test   %al,%al
+  800f97:	74 20                	je     800fb9 <printfmt+0x59>
+  800f99:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f9d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fa1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fa5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fa9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fad:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fb1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fb5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800fb9:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800fc0:	00 00 00 
+  800fc3:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fca:	00 00 00 
+  800fcd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fd1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fd8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fdf:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800fe6:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fed:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ff4:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800ffb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801002:	48 89 c7             	mov    %rax,%rdi
+  801005:	48 b8 54 0a 80 00 00 	movabs $0x800a54,%rax
+  80100c:	00 00 00 
+  80100f:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801011:	90                   	nop
+  801012:	c9                   	leave
+  801013:	c3                   	ret
+
+0000000000801014 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801014:	55                   	push   %rbp
+  801015:	48 89 e5             	mov    %rsp,%rbp
+  801018:	48 83 ec 10          	sub    $0x10,%rsp
+  80101c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80101f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801023:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801027:	8b 40 10             	mov    0x10(%rax),%eax
+  80102a:	8d 50 01             	lea    0x1(%rax),%edx
+  80102d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801031:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801034:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801038:	48 8b 10             	mov    (%rax),%rdx
+  80103b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801043:	48 39 c2             	cmp    %rax,%rdx
+  801046:	73 17                	jae    80105f <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801048:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80104c:	48 8b 00             	mov    (%rax),%rax
+  80104f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801053:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801057:	48 89 0a             	mov    %rcx,(%rdx)
+  80105a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80105d:	88 10                	mov    %dl,(%rax)
+}
+  80105f:	90                   	nop
+  801060:	c9                   	leave
+  801061:	c3                   	ret
+
+0000000000801062 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801062:	55                   	push   %rbp
+  801063:	48 89 e5             	mov    %rsp,%rbp
+  801066:	48 83 ec 40          	sub    $0x40,%rsp
+  80106a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80106e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801071:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801075:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801079:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80107d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801081:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801084:	48 98                	cltq
+  801086:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80108a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80108e:	48 01 d0             	add    %rdx,%rax
+  801091:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801095:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80109c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010a1:	74 06                	je     8010a9 <vsnprintf+0x47>
+  8010a3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8010a7:	7f 07                	jg     8010b0 <vsnprintf+0x4e>
+    return -E_INVAL;
+  8010a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010ae:	eb 32                	jmp    8010e2 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8010b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8010b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8010b8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8010bc:	48 89 c6             	mov    %rax,%rsi
+  8010bf:	48 b8 14 10 80 00 00 	movabs $0x801014,%rax
+  8010c6:	00 00 00 
+  8010c9:	48 89 c7             	mov    %rax,%rdi
+  8010cc:	48 b8 54 0a 80 00 00 	movabs $0x800a54,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8010d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010dc:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8010df:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8010e2:	c9                   	leave
+  8010e3:	c3                   	ret
+
+00000000008010e4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8010e4:	55                   	push   %rbp
+  8010e5:	48 89 e5             	mov    %rsp,%rbp
+  8010e8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010ef:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010f6:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  8010fc:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801103:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80110a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801111:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801118:	84 c0                	test   %al,%al
+  80111a:	74 20                	je     80113c <snprintf+0x58>
+  80111c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801120:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801124:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801128:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80112c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801130:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801134:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801138:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80113c:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801143:	00 00 00 
+  801146:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80114d:	00 00 00 
+  801150:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801154:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80115b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801162:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801169:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801170:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801177:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80117d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801184:	48 89 c7             	mov    %rax,%rdi
+  801187:	48 b8 62 10 80 00 00 	movabs $0x801062,%rax
+  80118e:	00 00 00 
+  801191:	ff d0                	call   *%rax
+  801193:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801199:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80119f:	c9                   	leave
+  8011a0:	c3                   	ret
+
+00000000008011a1 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8011a1:	55                   	push   %rbp
+  8011a2:	48 89 e5             	mov    %rsp,%rbp
+  8011a5:	53                   	push   %rbx
+  8011a6:	48 83 ec 38          	sub    $0x38,%rsp
+  8011aa:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8011ad:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8011b1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8011b5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8011b9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8011bd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8011c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c5:	89 d1                	mov    %edx,%ecx
+  8011c7:	0f a2                	cpuid
+  8011c9:	89 de                	mov    %ebx,%esi
+  8011cb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8011ce:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8011d1:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8011d4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8011d7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011dc:	74 09                	je     8011e7 <cpuid+0x46>
+}
+  8011de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011e2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8011e5:	89 10                	mov    %edx,(%rax)
+
+  8011e7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8011ec:	74 09                	je     8011f7 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8011ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011f2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8011f5:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8011f7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8011fc:	74 09                	je     801207 <cpuid+0x66>
+char *
+  8011fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801202:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801205:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801207:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80120c:	74 09                	je     801217 <cpuid+0x76>
+  for (; *s; s++)
+  80120e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801212:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801215:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801217:	90                   	nop
+  801218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121c:	c9                   	leave
+  80121d:	c3                   	ret
+
+000000000080121e <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	48 83 ec 18          	sub    $0x18,%rsp
+  801226:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801229:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80122c:	89 c1                	mov    %eax,%ecx
+  80122e:	0f 01 d0             	xgetbv
+  801231:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801234:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801237:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80123d:	48 c1 e2 20          	shl    $0x20,%rdx
+  801241:	48 09 d0             	or     %rdx,%rax
+#else
+  801244:	c9                   	leave
+  801245:	c3                   	ret
+
+0000000000801246 <string_cpu>:
+string_cpu(void) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+  80124a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80124e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801255:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80125c:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801263:	00 00 00 
+  801266:	8b 00                	mov    (%rax),%eax
+  801268:	85 c0                	test   %eax,%eax
+  80126a:	78 11                	js     80127d <string_cpu+0x37>
+    return string_features;
+  80126c:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801273:	00 00 00 
+  801276:	8b 00                	mov    (%rax),%eax
+  801278:	e9 df 00 00 00       	jmp    80135c <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80127d:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801281:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801287:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801291:	48 89 c6             	mov    %rax,%rsi
+  801294:	bf 00 00 00 00       	mov    $0x0,%edi
+  801299:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  8012a0:	00 00 00 
+  8012a3:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8012a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012a8:	83 f8 06             	cmp    $0x6,%eax
+  8012ab:	76 28                	jbe    8012d5 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8012ad:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bc:	48 89 c2             	mov    %rax,%rdx
+  8012bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c4:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012c9:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  8012d0:	00 00 00 
+  8012d3:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8012d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012d8:	25 00 02 00 00       	and    $0x200,%eax
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	74 04                	je     8012e5 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8012e1:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8012e5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8012e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ef:	48 89 c1             	mov    %rax,%rcx
+  8012f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  801301:	48 b8 a1 11 80 00 00 	movabs $0x8011a1,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80130d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801310:	83 e0 20             	and    $0x20,%eax
+  801313:	85 c0                	test   %eax,%eax
+  801315:	74 2a                	je     801341 <string_cpu+0xfb>
+  801317:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80131a:	25 00 00 00 08       	and    $0x8000000,%eax
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	74 1e                	je     801341 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801323:	bf 00 00 00 00       	mov    $0x0,%edi
+  801328:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80132f:	00 00 00 
+  801332:	ff d0                	call   *%rax
+  801334:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801337:	48 83 f8 06          	cmp    $0x6,%rax
+  80133b:	75 04                	jne    801341 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80133d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801341:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801348:	00 00 00 
+  80134b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80134e:	89 02                	mov    %eax,(%rdx)
+  801350:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801357:	00 00 00 
+  80135a:	8b 00                	mov    (%rax),%eax
+}
+  80135c:	c9                   	leave
+  80135d:	c3                   	ret
+
+000000000080135e <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80135e:	55                   	push   %rbp
+  80135f:	48 89 e5             	mov    %rsp,%rbp
+  801362:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801366:	48 83 ec 60          	sub    $0x60,%rsp
+  80136a:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80136f:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801374:	83 e0 1f             	and    $0x1f,%eax
+  801377:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80137b:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80137f:	48 f7 d8             	neg    %rax
+  801382:	48 89 c2             	mov    %rax,%rdx
+  801385:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80138a:	48 01 d0             	add    %rdx,%rax
+  80138d:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801392:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801396:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80139c:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013a1:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8013a5:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8013ab:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013af:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013b3:	89 c2                	mov    %eax,%edx
+  8013b5:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8013b9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8013be:	89 c1                	mov    %eax,%ecx
+  8013c0:	d3 e6                	shl    %cl,%esi
+  8013c2:	89 f0                	mov    %esi,%eax
+  8013c4:	21 d0                	and    %edx,%eax
+  8013c6:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8013ca:	eb 21                	jmp    8013ed <strlen_avx2+0x8f>
+    p += 32;
+  8013cc:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8013d2:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013d7:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8013db:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8013e1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013e5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013e9:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8013ed:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8013f2:	74 d8                	je     8013cc <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8013f4:	31 c0                	xor    %eax,%eax
+  8013f6:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8013fc:	48 63 d0             	movslq %eax,%rdx
+  8013ff:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801404:	48 01 d0             	add    %rdx,%rax
+  801407:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80140c:	c9                   	leave
+  80140d:	c3                   	ret
+
+000000000080140e <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801416:	48 83 ec 40          	sub    $0x40,%rsp
+  80141a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80141f:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801424:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801429:	eb 77                	jmp    8014a2 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80142b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801430:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801434:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801438:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80143d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801441:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801445:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801449:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80144d:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801452:	74 3c                	je     801490 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801454:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801458:	f7 d0                	not    %eax
+  80145a:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80145e:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801462:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801466:	48 63 d0             	movslq %eax,%rdx
+  801469:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80146e:	48 01 d0             	add    %rdx,%rax
+  801471:	0f b6 00             	movzbl (%rax),%eax
+  801474:	0f b6 c0             	movzbl %al,%eax
+  801477:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80147b:	48 63 ca             	movslq %edx,%rcx
+  80147e:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801483:	48 01 ca             	add    %rcx,%rdx
+  801486:	0f b6 12             	movzbl (%rdx),%edx
+  801489:	0f b6 d2             	movzbl %dl,%edx
+  80148c:	29 d0                	sub    %edx,%eax
+  80148e:	eb 6b                	jmp    8014fb <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801490:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801496:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80149c:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8014a2:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8014a8:	77 81                	ja     80142b <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8014aa:	eb 42                	jmp    8014ee <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8014ac:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014b1:	0f b6 10             	movzbl (%rax),%edx
+  8014b4:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8014b9:	0f b6 00             	movzbl (%rax),%eax
+  8014bc:	38 c2                	cmp    %al,%dl
+  8014be:	74 1c                	je     8014dc <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8014c0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014c5:	0f b6 00             	movzbl (%rax),%eax
+  8014c8:	0f b6 c8             	movzbl %al,%ecx
+  8014cb:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8014d0:	0f b6 00             	movzbl (%rax),%eax
+  8014d3:	0f b6 d0             	movzbl %al,%edx
+  8014d6:	89 c8                	mov    %ecx,%eax
+  8014d8:	29 d0                	sub    %edx,%eax
+  8014da:	eb 1f                	jmp    8014fb <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8014dc:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8014e2:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8014e8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8014ee:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014f4:	75 b6                	jne    8014ac <memcmp_avx2+0x9e>
+  return 0;
+  8014f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+
+00000000008014fd <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8014fd:	55                   	push   %rbp
+  8014fe:	48 89 e5             	mov    %rsp,%rbp
+  801501:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801505:	48 83 ec 60          	sub    $0x60,%rsp
+  801509:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80150e:	89 f0                	mov    %esi,%eax
+  801510:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801515:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801519:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80151e:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801522:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801527:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80152d:	eb 47                	jmp    801576 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80152f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801534:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801538:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80153c:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801542:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801546:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80154a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80154e:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801553:	74 15                	je     80156a <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801555:	31 c0                	xor    %eax,%eax
+  801557:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80155d:	48 63 d0             	movslq %eax,%rdx
+  801560:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801565:	48 01 d0             	add    %rdx,%rax
+  801568:	eb 3d                	jmp    8015a7 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80156a:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801570:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801576:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80157c:	77 b1                	ja     80152f <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80157e:	eb 0c                	jmp    80158c <memfind_avx2+0x8f>
+  801580:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801586:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80158c:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801592:	74 0e                	je     8015a2 <memfind_avx2+0xa5>
+  801594:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801599:	0f b6 00             	movzbl (%rax),%eax
+  80159c:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8015a0:	75 de                	jne    801580 <memfind_avx2+0x83>
+  return s;
+  8015a2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+00000000008015a9 <strlen>:
+strlen(const char *s) {
+  8015a9:	55                   	push   %rbp
+  8015aa:	48 89 e5             	mov    %rsp,%rbp
+  8015ad:	48 83 ec 40          	sub    $0x40,%rsp
+  8015b1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8015b5:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015b9:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8015bd:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  8015c4:	00 00 00 
+  8015c7:	ff d0                	call   *%rax
+  8015c9:	83 e0 02             	and    $0x2,%eax
+  8015cc:	85 c0                	test   %eax,%eax
+  8015ce:	74 18                	je     8015e8 <strlen+0x3f>
+    return strlen_avx2(s);
+  8015d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015d4:	48 89 c7             	mov    %rax,%rdi
+  8015d7:	48 b8 5e 13 80 00 00 	movabs $0x80135e,%rax
+  8015de:	00 00 00 
+  8015e1:	ff d0                	call   *%rax
+  8015e3:	e9 82 00 00 00       	jmp    80166a <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8015e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015ec:	83 e0 0f             	and    $0xf,%eax
+  8015ef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8015f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015f5:	48 f7 d8             	neg    %rax
+  8015f8:	48 89 c2             	mov    %rax,%rdx
+  8015fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015ff:	48 01 d0             	add    %rdx,%rax
+  801602:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801606:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80160e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801613:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801617:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80161b:	89 c2                	mov    %eax,%edx
+  80161d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801620:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801625:	89 c1                	mov    %eax,%ecx
+  801627:	d3 e6                	shl    %cl,%esi
+  801629:	89 f0                	mov    %esi,%eax
+  80162b:	21 d0                	and    %edx,%eax
+  80162d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801630:	eb 1d                	jmp    80164f <strlen+0xa6>
+    p += 16;
+  801632:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801637:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80163f:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801644:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801648:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80164c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80164f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801653:	74 dd                	je     801632 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801655:	31 c0                	xor    %eax,%eax
+  801657:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80165c:	48 63 d0             	movslq %eax,%rdx
+  80165f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801663:	48 01 d0             	add    %rdx,%rax
+  801666:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+
+000000000080166c <strnlen>:
+strnlen(const char *s, size_t size) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	48 83 ec 20          	sub    $0x20,%rsp
+  801674:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801678:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80167c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801683:	eb 0e                	jmp    801693 <strnlen+0x27>
+    n++;
+  801685:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801689:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80168e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801693:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801698:	74 0b                	je     8016a5 <strnlen+0x39>
+  80169a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169e:	0f b6 00             	movzbl (%rax),%eax
+  8016a1:	84 c0                	test   %al,%al
+  8016a3:	75 e0                	jne    801685 <strnlen+0x19>
+  return n;
+  8016a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8016a8:	c9                   	leave
+  8016a9:	c3                   	ret
+
+00000000008016aa <strcpy>:
+strcpy(char *dst, const char *src) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+  8016ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8016b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8016ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8016c2:	90                   	nop
+  8016c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016d7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016db:	0f b6 12             	movzbl (%rdx),%edx
+  8016de:	88 10                	mov    %dl,(%rax)
+  8016e0:	0f b6 00             	movzbl (%rax),%eax
+  8016e3:	84 c0                	test   %al,%al
+  8016e5:	75 dc                	jne    8016c3 <strcpy+0x19>
+  return ret;
+  8016e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+00000000008016ed <strcat>:
+strcat(char *dst, const char *src) {
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+  8016f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8016f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8016fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801701:	48 89 c7             	mov    %rax,%rdi
+  801704:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  80170b:	00 00 00 
+  80170e:	ff d0                	call   *%rax
+  801710:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801713:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801716:	48 63 d0             	movslq %eax,%rdx
+  801719:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80171d:	48 01 c2             	add    %rax,%rdx
+  801720:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801724:	48 89 c6             	mov    %rax,%rsi
+  801727:	48 89 d7             	mov    %rdx,%rdi
+  80172a:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+  return dst;
+  801736:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+000000000080173c <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80173c:	55                   	push   %rbp
+  80173d:	48 89 e5             	mov    %rsp,%rbp
+  801740:	48 83 ec 28          	sub    $0x28,%rsp
+  801744:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801748:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80174c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801754:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801758:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80175f:	00 
+  801760:	eb 2a                	jmp    80178c <strncpy+0x50>
+    *dst++ = *src;
+  801762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801766:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80176a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80176e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801772:	0f b6 12             	movzbl (%rdx),%edx
+  801775:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801777:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80177b:	0f b6 00             	movzbl (%rax),%eax
+  80177e:	84 c0                	test   %al,%al
+  801780:	74 05                	je     801787 <strncpy+0x4b>
+      src++;
+  801782:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801787:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80178c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801790:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801794:	72 cc                	jb     801762 <strncpy+0x26>
+  return ret;
+  801796:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+000000000080179c <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8017a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8017b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8017b8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017bd:	74 3d                	je     8017fc <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8017bf:	eb 1d                	jmp    8017de <strlcpy+0x42>
+      *dst++ = *src++;
+  8017c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017c5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017c9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d9:	0f b6 12             	movzbl (%rdx),%edx
+  8017dc:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8017de:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017e8:	74 0b                	je     8017f5 <strlcpy+0x59>
+  8017ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017ee:	0f b6 00             	movzbl (%rax),%eax
+  8017f1:	84 c0                	test   %al,%al
+  8017f3:	75 cc                	jne    8017c1 <strlcpy+0x25>
+    *dst = '\0';
+  8017f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f9:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8017fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801800:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+
+0000000000801806 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801806:	55                   	push   %rbp
+  801807:	48 89 e5             	mov    %rsp,%rbp
+  80180a:	48 83 ec 30          	sub    $0x30,%rsp
+  80180e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801812:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801816:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80181a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80181e:	48 89 c7             	mov    %rax,%rdi
+  801821:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  801828:	00 00 00 
+  80182b:	ff d0                	call   *%rax
+  80182d:	48 98                	cltq
+  80182f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801833:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801837:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80183b:	48 89 d6             	mov    %rdx,%rsi
+  80183e:	48 89 c7             	mov    %rax,%rdi
+  801841:	48 b8 6c 16 80 00 00 	movabs $0x80166c,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+  80184d:	48 98                	cltq
+  80184f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801853:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801857:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80185b:	75 10                	jne    80186d <strlcat+0x67>
+    return maxlen + srclen;
+  80185d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801865:	48 01 d0             	add    %rdx,%rax
+  801868:	e9 86 00 00 00       	jmp    8018f3 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80186d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801871:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801875:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801879:	73 2b                	jae    8018a6 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80187b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801883:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188b:	48 01 c1             	add    %rax,%rcx
+  80188e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801892:	48 89 c6             	mov    %rax,%rsi
+  801895:	48 89 cf             	mov    %rcx,%rdi
+  801898:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  80189f:	00 00 00 
+  8018a2:	ff d0                	call   *%rax
+  8018a4:	eb 42                	jmp    8018e8 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8018a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018aa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018ae:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b6:	48 01 c1             	add    %rax,%rcx
+  8018b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018bd:	48 89 c6             	mov    %rax,%rsi
+  8018c0:	48 89 cf             	mov    %rcx,%rdi
+  8018c3:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8018cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d7:	48 01 d0             	add    %rdx,%rax
+  8018da:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e2:	48 01 d0             	add    %rdx,%rax
+  8018e5:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8018e8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f0:	48 01 d0             	add    %rdx,%rax
+}
+  8018f3:	c9                   	leave
+  8018f4:	c3                   	ret
+
+00000000008018f5 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8018f5:	55                   	push   %rbp
+  8018f6:	48 89 e5             	mov    %rsp,%rbp
+  8018f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8018fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801901:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801905:	eb 0a                	jmp    801911 <strcmp+0x1c>
+    p++, q++;
+  801907:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80190c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801911:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801915:	0f b6 00             	movzbl (%rax),%eax
+  801918:	84 c0                	test   %al,%al
+  80191a:	74 12                	je     80192e <strcmp+0x39>
+  80191c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801920:	0f b6 10             	movzbl (%rax),%edx
+  801923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801927:	0f b6 00             	movzbl (%rax),%eax
+  80192a:	38 c2                	cmp    %al,%dl
+  80192c:	74 d9                	je     801907 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80192e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801932:	0f b6 00             	movzbl (%rax),%eax
+  801935:	0f b6 d0             	movzbl %al,%edx
+  801938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193c:	0f b6 00             	movzbl (%rax),%eax
+  80193f:	0f b6 c0             	movzbl %al,%eax
+  801942:	29 c2                	sub    %eax,%edx
+  801944:	89 d0                	mov    %edx,%eax
+}
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+0000000000801948 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801948:	55                   	push   %rbp
+  801949:	48 89 e5             	mov    %rsp,%rbp
+  80194c:	48 83 ec 18          	sub    $0x18,%rsp
+  801950:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801954:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801958:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80195c:	eb 0f                	jmp    80196d <strncmp+0x25>
+    n--, p++, q++;
+  80195e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801963:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801968:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80196d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801972:	74 1d                	je     801991 <strncmp+0x49>
+  801974:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801978:	0f b6 00             	movzbl (%rax),%eax
+  80197b:	84 c0                	test   %al,%al
+  80197d:	74 12                	je     801991 <strncmp+0x49>
+  80197f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801983:	0f b6 10             	movzbl (%rax),%edx
+  801986:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198a:	0f b6 00             	movzbl (%rax),%eax
+  80198d:	38 c2                	cmp    %al,%dl
+  80198f:	74 cd                	je     80195e <strncmp+0x16>
+  if (n == 0)
+  801991:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801996:	75 07                	jne    80199f <strncmp+0x57>
+    return 0;
+  801998:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199d:	eb 16                	jmp    8019b5 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80199f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a3:	0f b6 00             	movzbl (%rax),%eax
+  8019a6:	0f b6 d0             	movzbl %al,%edx
+  8019a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ad:	0f b6 00             	movzbl (%rax),%eax
+  8019b0:	0f b6 c0             	movzbl %al,%eax
+  8019b3:	29 c2                	sub    %eax,%edx
+}
+  8019b5:	89 d0                	mov    %edx,%eax
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+00000000008019b9 <strchr>:
+strchr(const char *s, char c) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	48 83 ec 60          	sub    $0x60,%rsp
+  8019c1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019c5:	89 f0                	mov    %esi,%eax
+  8019c7:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8019ca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019ce:	83 e0 0f             	and    $0xf,%eax
+  8019d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8019d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019d7:	48 f7 d8             	neg    %rax
+  8019da:	48 89 c2             	mov    %rax,%rdx
+  8019dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019e1:	48 01 d0             	add    %rdx,%rax
+  8019e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8019e8:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8019ec:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8019f0:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8019f4:	66 0f 6e c0          	movd   %eax,%xmm0
+  8019f8:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8019fc:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801a00:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801a05:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a0d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a11:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801a15:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a1a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a1f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a23:	89 c2                	mov    %eax,%edx
+  801a25:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a2a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a2f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a33:	09 c2                	or     %eax,%edx
+  801a35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a38:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801a3d:	89 c1                	mov    %eax,%ecx
+  801a3f:	d3 e6                	shl    %cl,%esi
+  801a41:	89 f0                	mov    %esi,%eax
+  801a43:	21 d0                	and    %edx,%eax
+  801a45:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a48:	eb 34                	jmp    801a7e <strchr+0xc5>
+    p += 16;
+  801a4a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801a4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a53:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a57:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801a5b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a60:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a65:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a69:	89 c2                	mov    %eax,%edx
+  801a6b:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a70:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a75:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a79:	09 d0                	or     %edx,%eax
+  801a7b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a7e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a82:	74 c6                	je     801a4a <strchr+0x91>
+  p += __builtin_ctz(m);
+  801a84:	31 c0                	xor    %eax,%eax
+  801a86:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801a8b:	48 98                	cltq
+  801a8d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801a91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a95:	0f b6 00             	movzbl (%rax),%eax
+  801a98:	84 c0                	test   %al,%al
+  801a9a:	74 06                	je     801aa2 <strchr+0xe9>
+  801a9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa0:	eb 05                	jmp    801aa7 <strchr+0xee>
+  801aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aa7:	c9                   	leave
+  801aa8:	c3                   	ret
+
+0000000000801aa9 <strfind>:
+strfind(const char *s, char c) {
+  801aa9:	55                   	push   %rbp
+  801aaa:	48 89 e5             	mov    %rsp,%rbp
+  801aad:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ab5:	89 f0                	mov    %esi,%eax
+  801ab7:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801aba:	eb 11                	jmp    801acd <strfind+0x24>
+    if (*s == c)
+  801abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac0:	0f b6 00             	movzbl (%rax),%eax
+  801ac3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801ac6:	74 12                	je     801ada <strfind+0x31>
+  for (; *s; s++)
+  801ac8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad1:	0f b6 00             	movzbl (%rax),%eax
+  801ad4:	84 c0                	test   %al,%al
+  801ad6:	75 e4                	jne    801abc <strfind+0x13>
+  801ad8:	eb 01                	jmp    801adb <strfind+0x32>
+      break;
+  801ada:	90                   	nop
+  return (char *)s;
+  801adb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801adf:	c9                   	leave
+  801ae0:	c3                   	ret
+
+0000000000801ae1 <memset>:
+memset(void *v, int c, size_t n) {
+  801ae1:	55                   	push   %rbp
+  801ae2:	48 89 e5             	mov    %rsp,%rbp
+  801ae5:	48 83 ec 38          	sub    $0x38,%rsp
+  801ae9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801aed:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801af0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801af4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801afc:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801b01:	76 41                	jbe    801b44 <memset+0x63>
+  801b03:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+  801b0f:	83 e0 01             	and    $0x1,%eax
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	74 2e                	je     801b44 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801b16:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b19:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b1d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b21:	48 89 ce             	mov    %rcx,%rsi
+  801b24:	48 89 f7             	mov    %rsi,%rdi
+  801b27:	48 89 d1             	mov    %rdx,%rcx
+  801b2a:	fc                   	cld
+  801b2b:	f3 aa                	rep stos %al,%es:(%rdi)
+  801b2d:	48 89 ca             	mov    %rcx,%rdx
+  801b30:	48 89 fe             	mov    %rdi,%rsi
+  801b33:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801b3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3f:	e9 a7 00 00 00       	jmp    801beb <memset+0x10a>
+  if (n >= 8) {
+  801b44:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b49:	0f 86 87 00 00 00    	jbe    801bd6 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801b4f:	eb 16                	jmp    801b67 <memset+0x86>
+      *p++ = c;
+  801b51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b55:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b59:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b5d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b60:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801b62:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b6b:	83 e0 07             	and    $0x7,%eax
+  801b6e:	48 85 c0             	test   %rax,%rax
+  801b71:	75 de                	jne    801b51 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801b73:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b76:	0f b6 c0             	movzbl %al,%eax
+  801b79:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801b80:	01 01 01 
+  801b83:	48 0f af c2          	imul   %rdx,%rax
+  801b87:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801b8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8f:	48 c1 e8 03          	shr    $0x3,%rax
+  801b93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801b97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b9b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b9f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ba3:	48 89 ce             	mov    %rcx,%rsi
+  801ba6:	48 89 f7             	mov    %rsi,%rdi
+  801ba9:	48 89 d1             	mov    %rdx,%rcx
+  801bac:	fc                   	cld
+  801bad:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801bb0:	48 89 ca             	mov    %rcx,%rdx
+  801bb3:	48 89 fe             	mov    %rdi,%rsi
+  801bb6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801bba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801bbe:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801bc3:	eb 11                	jmp    801bd6 <memset+0xf5>
+    *p++ = c;
+  801bc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bcd:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bd1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801bd4:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801bd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bda:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bde:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801be2:	48 85 c0             	test   %rax,%rax
+  801be5:	75 de                	jne    801bc5 <memset+0xe4>
+  return v;
+  801be7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801beb:	c9                   	leave
+  801bec:	c3                   	ret
+
+0000000000801bed <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801bed:	55                   	push   %rbp
+  801bee:	48 89 e5             	mov    %rsp,%rbp
+  801bf1:	48 83 ec 38          	sub    $0x38,%rsp
+  801bf5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bf9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bfd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801c01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801c09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801c11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c15:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801c19:	0f 83 da 00 00 00    	jae    801cf9 <memmove+0x10c>
+  801c1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c27:	48 01 d0             	add    %rdx,%rax
+  801c2a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801c2e:	0f 83 c5 00 00 00    	jae    801cf9 <memmove+0x10c>
+    s += n;
+  801c34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c38:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801c3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c40:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801c44:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c49:	0f 86 94 00 00 00    	jbe    801ce3 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801c4f:	eb 1c                	jmp    801c6d <memmove+0x80>
+        *--d = *--s;
+  801c51:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c56:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5f:	0f b6 10             	movzbl (%rax),%edx
+  801c62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c66:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c68:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c71:	83 e0 07             	and    $0x7,%eax
+  801c74:	48 85 c0             	test   %rax,%rax
+  801c77:	75 d8                	jne    801c51 <memmove+0x64>
+      nq = n / 8;
+  801c79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c7d:	48 c1 e8 03          	shr    $0x3,%rax
+  801c81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c85:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801c8a:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801c8f:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801c94:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c98:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ca0:	48 89 cf             	mov    %rcx,%rdi
+  801ca3:	48 89 d6             	mov    %rdx,%rsi
+  801ca6:	48 89 c1             	mov    %rax,%rcx
+  801ca9:	fd                   	std
+  801caa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801cad:	fc                   	cld
+  801cae:	48 89 c8             	mov    %rcx,%rax
+  801cb1:	48 89 f2             	mov    %rsi,%rdx
+  801cb4:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801cb8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cbc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801cc0:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801cc5:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801cca:	eb 17                	jmp    801ce3 <memmove+0xf6>
+      *--d = *--s;
+  801ccc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801cd1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801cd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cda:	0f b6 10             	movzbl (%rax),%edx
+  801cdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ce3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ceb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cef:	48 85 c0             	test   %rax,%rax
+  801cf2:	75 d8                	jne    801ccc <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801cf4:	e9 f4 00 00 00       	jmp    801ded <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801cf9:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801cfe:	76 46                	jbe    801d46 <memmove+0x159>
+  801d00:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+  801d0c:	83 e0 01             	and    $0x1,%eax
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	74 33                	je     801d46 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801d13:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1f:	48 89 cf             	mov    %rcx,%rdi
+  801d22:	48 89 d6             	mov    %rdx,%rsi
+  801d25:	48 89 c1             	mov    %rax,%rcx
+  801d28:	fc                   	cld
+  801d29:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801d2b:	48 89 c8             	mov    %rcx,%rax
+  801d2e:	48 89 f2             	mov    %rsi,%rdx
+  801d31:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d35:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801d3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d41:	e9 ab 00 00 00       	jmp    801df1 <memmove+0x204>
+    if (n >= 8) {
+  801d46:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d4b:	0f 86 8b 00 00 00    	jbe    801ddc <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801d51:	eb 22                	jmp    801d75 <memmove+0x188>
+        *d++ = *s++;
+  801d53:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d57:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d5b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d63:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d67:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d6b:	0f b6 12             	movzbl (%rdx),%edx
+  801d6e:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d70:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d79:	83 e0 07             	and    $0x7,%eax
+  801d7c:	48 85 c0             	test   %rax,%rax
+  801d7f:	75 d2                	jne    801d53 <memmove+0x166>
+      nq = n / 8;
+  801d81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d85:	48 c1 e8 03          	shr    $0x3,%rax
+  801d89:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801d8d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d99:	48 89 cf             	mov    %rcx,%rdi
+  801d9c:	48 89 d6             	mov    %rdx,%rsi
+  801d9f:	48 89 c1             	mov    %rax,%rcx
+  801da2:	fc                   	cld
+  801da3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801da6:	48 89 c8             	mov    %rcx,%rax
+  801da9:	48 89 f2             	mov    %rsi,%rdx
+  801dac:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801db0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801db4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801db8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801dbd:	eb 1d                	jmp    801ddc <memmove+0x1ef>
+      *d++ = *s++;
+  801dbf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dc3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801dc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801dcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dcf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801dd3:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801dd7:	0f b6 12             	movzbl (%rdx),%edx
+  801dda:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ddc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801de0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801de4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801de8:	48 85 c0             	test   %rax,%rax
+  801deb:	75 d2                	jne    801dbf <memmove+0x1d2>
+  return dst;
+  801ded:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801df1:	c9                   	leave
+  801df2:	c3                   	ret
+
+0000000000801df3 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801df3:	55                   	push   %rbp
+  801df4:	48 89 e5             	mov    %rsp,%rbp
+  801df7:	48 83 ec 18          	sub    $0x18,%rsp
+  801dfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801dff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e03:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801e07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e0b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e13:	48 89 ce             	mov    %rcx,%rsi
+  801e16:	48 89 c7             	mov    %rax,%rdi
+  801e19:	48 b8 ed 1b 80 00 00 	movabs $0x801bed,%rax
+  801e20:	00 00 00 
+  801e23:	ff d0                	call   *%rax
+}
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+0000000000801e27 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801e27:	55                   	push   %rbp
+  801e28:	48 89 e5             	mov    %rsp,%rbp
+  801e2b:	48 83 ec 40          	sub    $0x40,%rsp
+  801e2f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e33:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801e3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801e43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e4b:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801e50:	0f 86 a7 00 00 00    	jbe    801efd <memcmp+0xd6>
+  801e56:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+  801e62:	83 e0 02             	and    $0x2,%eax
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	0f 84 90 00 00 00    	je     801efd <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801e6d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e71:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e79:	48 89 ce             	mov    %rcx,%rsi
+  801e7c:	48 89 c7             	mov    %rax,%rdi
+  801e7f:	48 b8 0e 14 80 00 00 	movabs $0x80140e,%rax
+  801e86:	00 00 00 
+  801e89:	ff d0                	call   *%rax
+  801e8b:	e9 c2 00 00 00       	jmp    801f52 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801e90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e94:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e98:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ea0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ea4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ea8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801eac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801eaf:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801eb6:	74 36                	je     801eee <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801eb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ebb:	f7 d0                	not    %eax
+  801ebd:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ec1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ec4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ec7:	48 63 d0             	movslq %eax,%rdx
+  801eca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ece:	48 01 d0             	add    %rdx,%rax
+  801ed1:	0f b6 00             	movzbl (%rax),%eax
+  801ed4:	0f b6 c0             	movzbl %al,%eax
+  801ed7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801eda:	48 63 ca             	movslq %edx,%rcx
+  801edd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ee1:	48 01 ca             	add    %rcx,%rdx
+  801ee4:	0f b6 12             	movzbl (%rdx),%edx
+  801ee7:	0f b6 d2             	movzbl %dl,%edx
+  801eea:	29 d0                	sub    %edx,%eax
+  801eec:	eb 64                	jmp    801f52 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801eee:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ef3:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801ef8:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801efd:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801f02:	77 8c                	ja     801e90 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801f04:	eb 36                	jmp    801f3c <memcmp+0x115>
+    if (*s1 != *s2)
+  801f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f0a:	0f b6 10             	movzbl (%rax),%edx
+  801f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f11:	0f b6 00             	movzbl (%rax),%eax
+  801f14:	38 c2                	cmp    %al,%dl
+  801f16:	74 1a                	je     801f32 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801f18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f1c:	0f b6 00             	movzbl (%rax),%eax
+  801f1f:	0f b6 c8             	movzbl %al,%ecx
+  801f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f26:	0f b6 00             	movzbl (%rax),%eax
+  801f29:	0f b6 d0             	movzbl %al,%edx
+  801f2c:	89 c8                	mov    %ecx,%eax
+  801f2e:	29 d0                	sub    %edx,%eax
+  801f30:	eb 20                	jmp    801f52 <memcmp+0x12b>
+    s1++, s2++;
+  801f32:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f37:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801f3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f40:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f44:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f48:	48 85 c0             	test   %rax,%rax
+  801f4b:	75 b9                	jne    801f06 <memcmp+0xdf>
+  }
+
+  return 0;
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+0000000000801f54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801f54:	55                   	push   %rbp
+  801f55:	48 89 e5             	mov    %rsp,%rbp
+  801f58:	48 83 ec 50          	sub    $0x50,%rsp
+  801f5c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f60:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801f63:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801f67:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f6b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801f6f:	48 01 d0             	add    %rdx,%rax
+  801f72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801f76:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f79:	66 0f 6e c0          	movd   %eax,%xmm0
+  801f7d:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801f81:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801f85:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801f8a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f8e:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801f93:	76 73                	jbe    802008 <memfind+0xb4>
+  801f95:	48 b8 46 12 80 00 00 	movabs $0x801246,%rax
+  801f9c:	00 00 00 
+  801f9f:	ff d0                	call   *%rax
+  801fa1:	83 e0 02             	and    $0x2,%eax
+  801fa4:	85 c0                	test   %eax,%eax
+  801fa6:	74 60                	je     802008 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801fa8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801fab:	0f b6 c8             	movzbl %al,%ecx
+  801fae:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801fb2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fb6:	89 ce                	mov    %ecx,%esi
+  801fb8:	48 89 c7             	mov    %rax,%rdi
+  801fbb:	48 b8 fd 14 80 00 00 	movabs $0x8014fd,%rax
+  801fc2:	00 00 00 
+  801fc5:	ff d0                	call   *%rax
+  801fc7:	eb 6c                	jmp    802035 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801fc9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fcd:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fd1:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801fd5:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801fda:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fde:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fe2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801fe5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801fe9:	74 13                	je     801ffe <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801feb:	31 c0                	xor    %eax,%eax
+  801fed:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801ff2:	48 63 d0             	movslq %eax,%rdx
+  801ff5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ff9:	48 01 d0             	add    %rdx,%rax
+  801ffc:	eb 37                	jmp    802035 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801ffe:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802003:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802008:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  80200d:	77 ba                	ja     801fc9 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80200f:	eb 13                	jmp    802024 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802011:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802015:	0f b6 00             	movzbl (%rax),%eax
+  802018:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80201b:	38 d0                	cmp    %dl,%al
+  80201d:	74 11                	je     802030 <memfind+0xdc>
+  for (; s < ends; s++)
+  80201f:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802024:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802028:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80202c:	72 e3                	jb     802011 <memfind+0xbd>
+  80202e:	eb 01                	jmp    802031 <memfind+0xdd>
+      break;
+  802030:	90                   	nop
+  return (void *)s;
+  802031:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+0000000000802037 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	48 83 ec 38          	sub    $0x38,%rsp
+  80203f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802043:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802047:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  80204a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802051:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802058:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802059:	eb 05                	jmp    802060 <strtol+0x29>
+    s++;
+  80205b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802060:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802064:	0f b6 00             	movzbl (%rax),%eax
+  802067:	3c 20                	cmp    $0x20,%al
+  802069:	74 f0                	je     80205b <strtol+0x24>
+  80206b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206f:	0f b6 00             	movzbl (%rax),%eax
+  802072:	3c 09                	cmp    $0x9,%al
+  802074:	74 e5                	je     80205b <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802076:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80207a:	0f b6 00             	movzbl (%rax),%eax
+  80207d:	3c 2b                	cmp    $0x2b,%al
+  80207f:	75 07                	jne    802088 <strtol+0x51>
+    s++;
+  802081:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802086:	eb 17                	jmp    80209f <strtol+0x68>
+  else if (*s == '-')
+  802088:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208c:	0f b6 00             	movzbl (%rax),%eax
+  80208f:	3c 2d                	cmp    $0x2d,%al
+  802091:	75 0c                	jne    80209f <strtol+0x68>
+    s++, neg = 1;
+  802093:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802098:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80209f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020a3:	74 06                	je     8020ab <strtol+0x74>
+  8020a5:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8020a9:	75 28                	jne    8020d3 <strtol+0x9c>
+  8020ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020af:	0f b6 00             	movzbl (%rax),%eax
+  8020b2:	3c 30                	cmp    $0x30,%al
+  8020b4:	75 1d                	jne    8020d3 <strtol+0x9c>
+  8020b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ba:	48 83 c0 01          	add    $0x1,%rax
+  8020be:	0f b6 00             	movzbl (%rax),%eax
+  8020c1:	3c 78                	cmp    $0x78,%al
+  8020c3:	75 0e                	jne    8020d3 <strtol+0x9c>
+    s += 2, base = 16;
+  8020c5:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8020ca:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8020d1:	eb 2c                	jmp    8020ff <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8020d3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020d7:	75 19                	jne    8020f2 <strtol+0xbb>
+  8020d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020dd:	0f b6 00             	movzbl (%rax),%eax
+  8020e0:	3c 30                	cmp    $0x30,%al
+  8020e2:	75 0e                	jne    8020f2 <strtol+0xbb>
+    s++, base = 8;
+  8020e4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020e9:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8020f0:	eb 0d                	jmp    8020ff <strtol+0xc8>
+  else if (base == 0)
+  8020f2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020f6:	75 07                	jne    8020ff <strtol+0xc8>
+    base = 10;
+  8020f8:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  8020ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802103:	0f b6 00             	movzbl (%rax),%eax
+  802106:	3c 2f                	cmp    $0x2f,%al
+  802108:	7e 1d                	jle    802127 <strtol+0xf0>
+  80210a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80210e:	0f b6 00             	movzbl (%rax),%eax
+  802111:	3c 39                	cmp    $0x39,%al
+  802113:	7f 12                	jg     802127 <strtol+0xf0>
+      dig = *s - '0';
+  802115:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802119:	0f b6 00             	movzbl (%rax),%eax
+  80211c:	0f be c0             	movsbl %al,%eax
+  80211f:	83 e8 30             	sub    $0x30,%eax
+  802122:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802125:	eb 4e                	jmp    802175 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802127:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80212b:	0f b6 00             	movzbl (%rax),%eax
+  80212e:	3c 60                	cmp    $0x60,%al
+  802130:	7e 1d                	jle    80214f <strtol+0x118>
+  802132:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802136:	0f b6 00             	movzbl (%rax),%eax
+  802139:	3c 7a                	cmp    $0x7a,%al
+  80213b:	7f 12                	jg     80214f <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80213d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802141:	0f b6 00             	movzbl (%rax),%eax
+  802144:	0f be c0             	movsbl %al,%eax
+  802147:	83 e8 57             	sub    $0x57,%eax
+  80214a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80214d:	eb 26                	jmp    802175 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80214f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802153:	0f b6 00             	movzbl (%rax),%eax
+  802156:	3c 40                	cmp    $0x40,%al
+  802158:	7e 47                	jle    8021a1 <strtol+0x16a>
+  80215a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80215e:	0f b6 00             	movzbl (%rax),%eax
+  802161:	3c 5a                	cmp    $0x5a,%al
+  802163:	7f 3c                	jg     8021a1 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802165:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802169:	0f b6 00             	movzbl (%rax),%eax
+  80216c:	0f be c0             	movsbl %al,%eax
+  80216f:	83 e8 37             	sub    $0x37,%eax
+  802172:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802175:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802178:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80217b:	7d 23                	jge    8021a0 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80217d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802182:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802185:	48 98                	cltq
+  802187:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80218c:	48 89 c2             	mov    %rax,%rdx
+  80218f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802192:	48 98                	cltq
+  802194:	48 01 d0             	add    %rdx,%rax
+  802197:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80219b:	e9 5f ff ff ff       	jmp    8020ff <strtol+0xc8>
+      break;
+  8021a0:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8021a1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8021a6:	74 0b                	je     8021b3 <strtol+0x17c>
+    *endptr = (char *)s;
+  8021a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8021b0:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8021b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021b7:	74 09                	je     8021c2 <strtol+0x18b>
+  8021b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021bd:	48 f7 d8             	neg    %rax
+  8021c0:	eb 04                	jmp    8021c6 <strtol+0x18f>
+  8021c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+
+00000000008021c8 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8021c8:	55                   	push   %rbp
+  8021c9:	48 89 e5             	mov    %rsp,%rbp
+  8021cc:	53                   	push   %rbx
+  8021cd:	48 83 ec 48          	sub    $0x48,%rsp
+  8021d1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8021d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8021d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021dd:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8021e1:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8021e5:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8021e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ed:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8021f1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8021f5:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8021f9:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021fd:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802201:	4c 89 c3             	mov    %r8,%rbx
+  802204:	cd 30                	int    $0x30
+  802206:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80220a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80220f:	74 46                	je     802257 <syscall+0x8f>
+  802211:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802216:	7e 3f                	jle    802257 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802218:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80221c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802220:	49 89 d0             	mov    %rdx,%r8
+  802223:	48 89 c1             	mov    %rax,%rcx
+  802226:	48 b8 08 6d 80 00 00 	movabs $0x806d08,%rax
+  80222d:	00 00 00 
+  802230:	48 89 c2             	mov    %rax,%rdx
+  802233:	be 22 00 00 00       	mov    $0x22,%esi
+  802238:	48 b8 27 6d 80 00 00 	movabs $0x806d27,%rax
+  80223f:	00 00 00 
+  802242:	48 89 c7             	mov    %rax,%rdi
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224a:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  802251:	00 00 00 
+  802254:	41 ff d1             	call   *%r9
+
+  return ret;
+  802257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80225b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80225f:	c9                   	leave
+  802260:	c3                   	ret
+
+0000000000802261 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802261:	55                   	push   %rbp
+  802262:	48 89 e5             	mov    %rsp,%rbp
+  802265:	48 83 ec 10          	sub    $0x10,%rsp
+  802269:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80226d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802271:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802275:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802279:	48 83 ec 08          	sub    $0x8,%rsp
+  80227d:	6a 00                	push   $0x0
+  80227f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228b:	48 89 d1             	mov    %rdx,%rcx
+  80228e:	48 89 c2             	mov    %rax,%rdx
+  802291:	be 00 00 00 00       	mov    $0x0,%esi
+  802296:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229b:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8022a2:	00 00 00 
+  8022a5:	ff d0                	call   *%rax
+  8022a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ab:	90                   	nop
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+00000000008022ae <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8022ae:	55                   	push   %rbp
+  8022af:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8022b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8022d8:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8022df:	00 00 00 
+  8022e2:	ff d0                	call   *%rax
+  8022e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e8:	c9                   	leave
+  8022e9:	c3                   	ret
+
+00000000008022ea <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8022ea:	55                   	push   %rbp
+  8022eb:	48 89 e5             	mov    %rsp,%rbp
+  8022ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8022f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022f8:	48 98                	cltq
+  8022fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fe:	6a 00                	push   $0x0
+  802300:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802306:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80230c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802311:	48 89 c2             	mov    %rax,%rdx
+  802314:	be 01 00 00 00       	mov    $0x1,%esi
+  802319:	bf 03 00 00 00       	mov    $0x3,%edi
+  80231e:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+
+0000000000802330 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802330:	55                   	push   %rbp
+  802331:	48 89 e5             	mov    %rsp,%rbp
+  802334:	48 83 ec 10          	sub    $0x10,%rsp
+  802338:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80233b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80233e:	48 98                	cltq
+  802340:	48 83 ec 08          	sub    $0x8,%rsp
+  802344:	6a 00                	push   $0x0
+  802346:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80234c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802352:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802357:	48 89 c2             	mov    %rax,%rdx
+  80235a:	be 00 00 00 00       	mov    $0x0,%esi
+  80235f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802364:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+  802370:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802374:	90                   	nop
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+0000000000802377 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802377:	55                   	push   %rbp
+  802378:	48 89 e5             	mov    %rsp,%rbp
+  80237b:	48 83 ec 20          	sub    $0x20,%rsp
+  80237f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802382:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802386:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802389:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80238c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802391:	cd 30                	int    $0x30
+  802393:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802397:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80239b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8023a0:	7e 3d                	jle    8023df <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8023a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a6:	49 89 c0             	mov    %rax,%r8
+  8023a9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8023ae:	48 b8 08 6d 80 00 00 	movabs $0x806d08,%rax
+  8023b5:	00 00 00 
+  8023b8:	48 89 c2             	mov    %rax,%rdx
+  8023bb:	be 49 00 00 00       	mov    $0x49,%esi
+  8023c0:	48 b8 27 6d 80 00 00 	movabs $0x806d27,%rax
+  8023c7:	00 00 00 
+  8023ca:	48 89 c7             	mov    %rax,%rdi
+  8023cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d2:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8023d9:	00 00 00 
+  8023dc:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8023df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8023e4:	75 13                	jne    8023f9 <sys_env_wait+0x82>
+  8023e6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8023eb:	74 0c                	je     8023f9 <sys_env_wait+0x82>
+    *status = st;
+  8023ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023f1:	89 c2                	mov    %eax,%edx
+  8023f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023f7:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8023f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+
+00000000008023ff <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8023ff:	55                   	push   %rbp
+  802400:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802403:	48 83 ec 08          	sub    $0x8,%rsp
+  802407:	6a 00                	push   $0x0
+  802409:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80240f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802415:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241f:	be 00 00 00 00       	mov    $0x0,%esi
+  802424:	bf 02 00 00 00       	mov    $0x2,%edi
+  802429:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+  802435:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <sys_yield>:
+
+void
+sys_yield(void) {
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80243f:	48 83 ec 08          	sub    $0x8,%rsp
+  802443:	6a 00                	push   $0x0
+  802445:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80244b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802451:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245b:	be 00 00 00 00       	mov    $0x0,%esi
+  802460:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802465:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+  802471:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802475:	90                   	nop
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+0000000000802478 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802478:	55                   	push   %rbp
+  802479:	48 89 e5             	mov    %rsp,%rbp
+  80247c:	48 83 ec 20          	sub    $0x20,%rsp
+  802480:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802483:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802487:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80248a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80248d:	48 63 c8             	movslq %eax,%rcx
+  802490:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802494:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802497:	48 98                	cltq
+  802499:	48 83 ec 08          	sub    $0x8,%rsp
+  80249d:	6a 00                	push   $0x0
+  80249f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a5:	49 89 c8             	mov    %rcx,%r8
+  8024a8:	48 89 d1             	mov    %rdx,%rcx
+  8024ab:	48 89 c2             	mov    %rax,%rdx
+  8024ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8024b3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024b8:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+  8024c4:	48 83 c4 10          	add    $0x10,%rsp
+  8024c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8024cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+
+00000000008024d0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8024d0:	55                   	push   %rbp
+  8024d1:	48 89 e5             	mov    %rsp,%rbp
+  8024d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8024d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024df:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8024e2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024e6:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8024ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8024ed:	48 63 c8             	movslq %eax,%rcx
+  8024f0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024f7:	48 63 f0             	movslq %eax,%rsi
+  8024fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802501:	48 98                	cltq
+  802503:	48 83 ec 08          	sub    $0x8,%rsp
+  802507:	51                   	push   %rcx
+  802508:	49 89 f9             	mov    %rdi,%r9
+  80250b:	49 89 f0             	mov    %rsi,%r8
+  80250e:	48 89 d1             	mov    %rdx,%rcx
+  802511:	48 89 c2             	mov    %rax,%rdx
+  802514:	be 01 00 00 00       	mov    $0x1,%esi
+  802519:	bf 07 00 00 00       	mov    $0x7,%edi
+  80251e:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+  80252a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80252e:	c9                   	leave
+  80252f:	c3                   	ret
+
+0000000000802530 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802530:	55                   	push   %rbp
+  802531:	48 89 e5             	mov    %rsp,%rbp
+  802534:	48 83 ec 10          	sub    $0x10,%rsp
+  802538:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80253b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80253f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802543:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802546:	48 98                	cltq
+  802548:	48 83 ec 08          	sub    $0x8,%rsp
+  80254c:	6a 00                	push   $0x0
+  80254e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802554:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80255a:	48 89 d1             	mov    %rdx,%rcx
+  80255d:	48 89 c2             	mov    %rax,%rdx
+  802560:	be 01 00 00 00       	mov    $0x1,%esi
+  802565:	bf 08 00 00 00       	mov    $0x8,%edi
+  80256a:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+  802576:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80257a:	c9                   	leave
+  80257b:	c3                   	ret
+
+000000000080257c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80257c:	55                   	push   %rbp
+  80257d:	48 89 e5             	mov    %rsp,%rbp
+  802580:	48 83 ec 10          	sub    $0x10,%rsp
+  802584:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802587:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80258a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80258d:	48 63 d0             	movslq %eax,%rdx
+  802590:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802593:	48 98                	cltq
+  802595:	48 83 ec 08          	sub    $0x8,%rsp
+  802599:	6a 00                	push   $0x0
+  80259b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025a7:	48 89 d1             	mov    %rdx,%rcx
+  8025aa:	48 89 c2             	mov    %rax,%rdx
+  8025ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8025b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8025b7:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8025be:	00 00 00 
+  8025c1:	ff d0                	call   *%rax
+  8025c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c7:	c9                   	leave
+  8025c8:	c3                   	ret
+
+00000000008025c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8025c9:	55                   	push   %rbp
+  8025ca:	48 89 e5             	mov    %rsp,%rbp
+  8025cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8025d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025df:	48 98                	cltq
+  8025e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e5:	6a 00                	push   $0x0
+  8025e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025f3:	48 89 d1             	mov    %rdx,%rcx
+  8025f6:	48 89 c2             	mov    %rax,%rdx
+  8025f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025fe:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802603:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+  80260f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802613:	c9                   	leave
+  802614:	c3                   	ret
+
+0000000000802615 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802615:	55                   	push   %rbp
+  802616:	48 89 e5             	mov    %rsp,%rbp
+  802619:	48 83 ec 10          	sub    $0x10,%rsp
+  80261d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802620:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802624:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802628:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80262b:	48 98                	cltq
+  80262d:	48 83 ec 08          	sub    $0x8,%rsp
+  802631:	6a 00                	push   $0x0
+  802633:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802639:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80263f:	48 89 d1             	mov    %rdx,%rcx
+  802642:	48 89 c2             	mov    %rax,%rdx
+  802645:	be 01 00 00 00       	mov    $0x1,%esi
+  80264a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80264f:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+
+0000000000802661 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802661:	55                   	push   %rbp
+  802662:	48 89 e5             	mov    %rsp,%rbp
+  802665:	48 83 ec 20          	sub    $0x20,%rsp
+  802669:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80266c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802670:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802674:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802677:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80267a:	48 63 f0             	movslq %eax,%rsi
+  80267d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802681:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802685:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802688:	48 98                	cltq
+  80268a:	48 83 ec 08          	sub    $0x8,%rsp
+  80268e:	6a 00                	push   $0x0
+  802690:	49 89 f1             	mov    %rsi,%r9
+  802693:	49 89 c8             	mov    %rcx,%r8
+  802696:	48 89 d1             	mov    %rdx,%rcx
+  802699:	48 89 c2             	mov    %rax,%rdx
+  80269c:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a1:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026a6:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8026ad:	00 00 00 
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b6:	c9                   	leave
+  8026b7:	c3                   	ret
+
+00000000008026b8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8026b8:	55                   	push   %rbp
+  8026b9:	48 89 e5             	mov    %rsp,%rbp
+  8026bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8026c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026df:	48 89 c2             	mov    %rax,%rdx
+  8026e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8026e7:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026ec:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8026f3:	00 00 00 
+  8026f6:	ff d0                	call   *%rax
+  8026f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026fc:	c9                   	leave
+  8026fd:	c3                   	ret
+
+00000000008026fe <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8026fe:	55                   	push   %rbp
+  8026ff:	48 89 e5             	mov    %rsp,%rbp
+  802702:	48 83 ec 10          	sub    $0x10,%rsp
+  802706:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80270a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80270e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802716:	48 83 ec 08          	sub    $0x8,%rsp
+  80271a:	6a 00                	push   $0x0
+  80271c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802722:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802728:	48 89 d1             	mov    %rdx,%rcx
+  80272b:	48 89 c2             	mov    %rax,%rdx
+  80272e:	be 01 00 00 00       	mov    $0x1,%esi
+  802733:	bf 10 00 00 00       	mov    $0x10,%edi
+  802738:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+  802744:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802748:	c9                   	leave
+  802749:	c3                   	ret
+
+000000000080274a <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80274a:	55                   	push   %rbp
+  80274b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80274e:	48 83 ec 08          	sub    $0x8,%rsp
+  802752:	6a 00                	push   $0x0
+  802754:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80275a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802760:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802765:	ba 00 00 00 00       	mov    $0x0,%edx
+  80276a:	be 00 00 00 00       	mov    $0x0,%esi
+  80276f:	bf 11 00 00 00       	mov    $0x11,%edi
+  802774:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80277b:	00 00 00 
+  80277e:	ff d0                	call   *%rax
+  802780:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802784:	c9                   	leave
+  802785:	c3                   	ret
+
+0000000000802786 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802786:	55                   	push   %rbp
+  802787:	48 89 e5             	mov    %rsp,%rbp
+  80278a:	48 83 ec 10          	sub    $0x10,%rsp
+  80278e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802792:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802796:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80279a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80279e:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b0:	48 89 d1             	mov    %rdx,%rcx
+  8027b3:	48 89 c2             	mov    %rax,%rdx
+  8027b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bb:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027c0:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+
+00000000008027d2 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8027d2:	55                   	push   %rbp
+  8027d3:	48 89 e5             	mov    %rsp,%rbp
+  8027d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8027da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027e2:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8027e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027e8:	48 63 c8             	movslq %eax,%rcx
+  8027eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ff:	49 89 c8             	mov    %rcx,%r8
+  802802:	48 89 d1             	mov    %rdx,%rcx
+  802805:	48 89 c2             	mov    %rax,%rdx
+  802808:	be 00 00 00 00       	mov    $0x0,%esi
+  80280d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802812:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+0000000000802824 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	48 83 ec 20          	sub    $0x20,%rsp
+  80282c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802830:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802833:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802837:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80283b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80283e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802842:	48 83 ec 08          	sub    $0x8,%rsp
+  802846:	6a 00                	push   $0x0
+  802848:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284e:	49 89 c8             	mov    %rcx,%r8
+  802851:	48 89 d1             	mov    %rdx,%rcx
+  802854:	48 89 c2             	mov    %rax,%rdx
+  802857:	be 00 00 00 00       	mov    $0x0,%esi
+  80285c:	bf 14 00 00 00       	mov    $0x14,%edi
+  802861:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802868:	00 00 00 
+  80286b:	ff d0                	call   *%rax
+  80286d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+
+0000000000802873 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802873:	55                   	push   %rbp
+  802874:	48 89 e5             	mov    %rsp,%rbp
+  802877:	48 83 ec 10          	sub    $0x10,%rsp
+  80287b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80287f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802882:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802885:	48 63 d0             	movslq %eax,%rdx
+  802888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80288c:	48 83 ec 08          	sub    $0x8,%rsp
+  802890:	6a 00                	push   $0x0
+  802892:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802898:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80289e:	48 89 d1             	mov    %rdx,%rcx
+  8028a1:	48 89 c2             	mov    %rax,%rdx
+  8028a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a9:	bf 15 00 00 00       	mov    $0x15,%edi
+  8028ae:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+  8028ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028be:	c9                   	leave
+  8028bf:	c3                   	ret
+
+00000000008028c0 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8028c0:	55                   	push   %rbp
+  8028c1:	48 89 e5             	mov    %rsp,%rbp
+  8028c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8028c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028cc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8028cf:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8028d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8028d6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8028da:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8028dd:	48 63 c8             	movslq %eax,%rcx
+  8028e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8028e3:	48 63 d0             	movslq %eax,%rdx
+  8028e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ee:	6a 00                	push   $0x0
+  8028f0:	49 89 f1             	mov    %rsi,%r9
+  8028f3:	49 89 c8             	mov    %rcx,%r8
+  8028f6:	48 89 d1             	mov    %rdx,%rcx
+  8028f9:	48 89 c2             	mov    %rax,%rdx
+  8028fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802901:	bf 16 00 00 00       	mov    $0x16,%edi
+  802906:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+  802912:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802916:	c9                   	leave
+  802917:	c3                   	ret
+
+0000000000802918 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802918:	55                   	push   %rbp
+  802919:	48 89 e5             	mov    %rsp,%rbp
+  80291c:	48 83 ec 30          	sub    $0x30,%rsp
+  802920:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802924:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802928:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80292c:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802930:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802934:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802938:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80293c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802940:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802944:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802948:	48 83 ec 08          	sub    $0x8,%rsp
+  80294c:	51                   	push   %rcx
+  80294d:	49 89 f9             	mov    %rdi,%r9
+  802950:	49 89 f0             	mov    %rsi,%r8
+  802953:	48 89 d1             	mov    %rdx,%rcx
+  802956:	48 89 c2             	mov    %rax,%rdx
+  802959:	be 00 00 00 00       	mov    $0x0,%esi
+  80295e:	bf 17 00 00 00       	mov    $0x17,%edi
+  802963:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  80296a:	00 00 00 
+  80296d:	ff d0                	call   *%rax
+  80296f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802973:	c9                   	leave
+  802974:	c3                   	ret
+
+0000000000802975 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802975:	55                   	push   %rbp
+  802976:	48 89 e5             	mov    %rsp,%rbp
+  802979:	48 83 ec 10          	sub    $0x10,%rsp
+  80297d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802983:	48 98                	cltq
+  802985:	48 83 ec 08          	sub    $0x8,%rsp
+  802989:	6a 00                	push   $0x0
+  80298b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802991:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802997:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80299c:	48 89 c2             	mov    %rax,%rdx
+  80299f:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a4:	bf 18 00 00 00       	mov    $0x18,%edi
+  8029a9:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  8029b0:	00 00 00 
+  8029b3:	ff d0                	call   *%rax
+  8029b5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029b9:	90                   	nop
+  8029ba:	c9                   	leave
+  8029bb:	c3                   	ret
+
+00000000008029bc <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8029bc:	55                   	push   %rbp
+  8029bd:	48 89 e5             	mov    %rsp,%rbp
+  8029c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8029c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8029cf:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8029d2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8029d5:	48 63 f0             	movslq %eax,%rsi
+  8029d8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8029dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029e3:	48 98                	cltq
+  8029e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e9:	6a 00                	push   $0x0
+  8029eb:	49 89 f1             	mov    %rsi,%r9
+  8029ee:	49 89 c8             	mov    %rcx,%r8
+  8029f1:	48 89 d1             	mov    %rdx,%rcx
+  8029f4:	48 89 c2             	mov    %rax,%rdx
+  8029f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8029fc:	bf 19 00 00 00       	mov    $0x19,%edi
+  802a01:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	48 83 c4 10          	add    $0x10,%rsp
+  802a11:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a17:	c9                   	leave
+  802a18:	c3                   	ret
+
+0000000000802a19 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802a19:	55                   	push   %rbp
+  802a1a:	48 89 e5             	mov    %rsp,%rbp
+  802a1d:	48 83 ec 20          	sub    $0x20,%rsp
+  802a21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a25:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a29:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802a2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a2f:	48 63 c8             	movslq %eax,%rcx
+  802a32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3e:	6a 00                	push   $0x0
+  802a40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a46:	49 89 c8             	mov    %rcx,%r8
+  802a49:	48 89 d1             	mov    %rdx,%rcx
+  802a4c:	48 89 c2             	mov    %rax,%rdx
+  802a4f:	be 01 00 00 00       	mov    $0x1,%esi
+  802a54:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802a59:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802a60:	00 00 00 
+  802a63:	ff d0                	call   *%rax
+  802a65:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+
+0000000000802a6b <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802a6b:	55                   	push   %rbp
+  802a6c:	48 89 e5             	mov    %rsp,%rbp
+  802a6f:	48 83 ec 20          	sub    $0x20,%rsp
+  802a73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a7b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802a7f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802a83:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8f:	6a 00                	push   $0x0
+  802a91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a97:	49 89 c8             	mov    %rcx,%r8
+  802a9a:	48 89 d1             	mov    %rdx,%rcx
+  802a9d:	48 89 c2             	mov    %rax,%rdx
+  802aa0:	be 01 00 00 00       	mov    $0x1,%esi
+  802aa5:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802aaa:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802ab1:	00 00 00 
+  802ab4:	ff d0                	call   *%rax
+  802ab6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+
+0000000000802abc <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802abc:	55                   	push   %rbp
+  802abd:	48 89 e5             	mov    %rsp,%rbp
+  802ac0:	48 83 ec 30          	sub    $0x30,%rsp
+  802ac4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ac8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802acc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802acf:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802ad3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ad7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ada:	48 63 c8             	movslq %eax,%rcx
+  802add:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ae1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae9:	6a 00                	push   $0x0
+  802aeb:	49 89 f1             	mov    %rsi,%r9
+  802aee:	49 89 c8             	mov    %rcx,%r8
+  802af1:	48 89 d1             	mov    %rdx,%rcx
+  802af4:	48 89 c2             	mov    %rax,%rdx
+  802af7:	be 01 00 00 00       	mov    $0x1,%esi
+  802afc:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802b01:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+  802b0d:	48 83 c4 10          	add    $0x10,%rsp
+  802b11:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+0000000000802b19 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802b19:	55                   	push   %rbp
+  802b1a:	48 89 e5             	mov    %rsp,%rbp
+  802b1d:	48 83 ec 10          	sub    $0x10,%rsp
+  802b21:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802b24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b27:	48 98                	cltq
+  802b29:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2d:	6a 00                	push   $0x0
+  802b2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b40:	48 89 c2             	mov    %rax,%rdx
+  802b43:	be 01 00 00 00       	mov    $0x1,%esi
+  802b48:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802b4d:	48 b8 c8 21 80 00 00 	movabs $0x8021c8,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+  802b59:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b5d:	c9                   	leave
+  802b5e:	c3                   	ret
+
+0000000000802b5f <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802b5f:	55                   	push   %rbp
+  802b60:	48 89 e5             	mov    %rsp,%rbp
+  802b63:	48 83 ec 40          	sub    $0x40,%rsp
+  802b67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802b6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b6f:	48 8b 00             	mov    (%rax),%rax
+  802b72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802b76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b7a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b86:	83 e0 02             	and    $0x2,%eax
+  802b89:	48 85 c0             	test   %rax,%rax
+  802b8c:	74 25                	je     802bb3 <pgfault+0x54>
+  802b8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b92:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b96:	48 89 c2             	mov    %rax,%rdx
+  802b99:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ba0:	01 00 00 
+  802ba3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ba7:	83 e0 02             	and    $0x2,%eax
+  802baa:	48 85 c0             	test   %rax,%rax
+  802bad:	0f 85 fe 01 00 00    	jne    802db1 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802bb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bb7:	83 e0 02             	and    $0x2,%eax
+  802bba:	48 85 c0             	test   %rax,%rax
+  802bbd:	74 23                	je     802be2 <pgfault+0x83>
+  802bbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bc3:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bc7:	48 89 c2             	mov    %rax,%rdx
+  802bca:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bd1:	01 00 00 
+  802bd4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bd8:	25 00 08 00 00       	and    $0x800,%eax
+  802bdd:	48 85 c0             	test   %rax,%rax
+  802be0:	75 3f                	jne    802c21 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802be2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802be6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802bea:	49 89 d0             	mov    %rdx,%r8
+  802bed:	48 89 c1             	mov    %rax,%rcx
+  802bf0:	48 b8 38 6d 80 00 00 	movabs $0x806d38,%rax
+  802bf7:	00 00 00 
+  802bfa:	48 89 c2             	mov    %rax,%rdx
+  802bfd:	be 26 00 00 00       	mov    $0x26,%esi
+  802c02:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  802c09:	00 00 00 
+  802c0c:	48 89 c7             	mov    %rax,%rdi
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  802c1b:	00 00 00 
+  802c1e:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802c21:	48 b8 75 57 80 00 00 	movabs $0x805775,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802c31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c35:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c3a:	48 89 c6             	mov    %rax,%rsi
+  802c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c42:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+  802c4e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802c51:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c55:	79 36                	jns    802c8d <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802c57:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c5a:	89 c1                	mov    %eax,%ecx
+  802c5c:	48 b8 78 6d 80 00 00 	movabs $0x806d78,%rax
+  802c63:	00 00 00 
+  802c66:	48 89 c2             	mov    %rax,%rdx
+  802c69:	be 35 00 00 00       	mov    $0x35,%esi
+  802c6e:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  802c75:	00 00 00 
+  802c78:	48 89 c7             	mov    %rax,%rdi
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  802c87:	00 00 00 
+  802c8a:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802c8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c91:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802c95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c99:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c9f:	48 89 c1             	mov    %rax,%rcx
+  802ca2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cab:	48 89 ce             	mov    %rcx,%rsi
+  802cae:	48 89 c7             	mov    %rax,%rdi
+  802cb1:	48 b8 ed 1b 80 00 00 	movabs $0x801bed,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802cbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cc1:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cc5:	48 89 c2             	mov    %rax,%rdx
+  802cc8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ccf:	01 00 00 
+  802cd2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cd6:	25 00 08 00 00       	and    $0x800,%eax
+  802cdb:	48 85 c0             	test   %rax,%rax
+  802cde:	74 7a                	je     802d5a <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802ce0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ce4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802ce8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cec:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802cf2:	48 89 c2             	mov    %rax,%rdx
+  802cf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf9:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802cff:	48 89 d1             	mov    %rdx,%rcx
+  802d02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d07:	48 89 c6             	mov    %rax,%rsi
+  802d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0f:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802d16:	00 00 00 
+  802d19:	ff d0                	call   *%rax
+  802d1b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802d1e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d22:	79 36                	jns    802d5a <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802d24:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d27:	89 c1                	mov    %eax,%ecx
+  802d29:	48 b8 a0 6d 80 00 00 	movabs $0x806da0,%rax
+  802d30:	00 00 00 
+  802d33:	48 89 c2             	mov    %rax,%rdx
+  802d36:	be 42 00 00 00       	mov    $0x42,%esi
+  802d3b:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  802d42:	00 00 00 
+  802d45:	48 89 c7             	mov    %rax,%rdi
+  802d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4d:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  802d54:	00 00 00 
+  802d57:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802d5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d5e:	48 89 c6             	mov    %rax,%rsi
+  802d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d66:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+  802d72:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802d75:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d79:	79 37                	jns    802db2 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802d7b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d7e:	89 c1                	mov    %eax,%ecx
+  802d80:	48 b8 c8 6d 80 00 00 	movabs $0x806dc8,%rax
+  802d87:	00 00 00 
+  802d8a:	48 89 c2             	mov    %rax,%rdx
+  802d8d:	be 46 00 00 00       	mov    $0x46,%esi
+  802d92:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  802d99:	00 00 00 
+  802d9c:	48 89 c7             	mov    %rax,%rdi
+  802d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da4:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  802dab:	00 00 00 
+  802dae:	41 ff d0             	call   *%r8
+    return;
+  802db1:	90                   	nop
+  }
+}
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+
+0000000000802db4 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802db4:	55                   	push   %rbp
+  802db5:	48 89 e5             	mov    %rsp,%rbp
+  802db8:	48 83 ec 30          	sub    $0x30,%rsp
+  802dbc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802dbf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802dc3:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802dca:	01 00 00 
+  802dcd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dd1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802dd5:	25 07 0e 00 00       	and    $0xe07,%eax
+  802dda:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802dde:	48 b8 ff 23 80 00 00 	movabs $0x8023ff,%rax
+  802de5:	00 00 00 
+  802de8:	ff d0                	call   *%rax
+  802dea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802ded:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802df1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802df5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802df9:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e00:	01 00 00 
+  802e03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e07:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e0b:	25 00 04 00 00       	and    $0x400,%eax
+  802e10:	48 85 c0             	test   %rax,%rax
+  802e13:	74 7b                	je     802e90 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802e15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e19:	89 c1                	mov    %eax,%ecx
+  802e1b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e1f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e23:	48 89 c2             	mov    %rax,%rdx
+  802e26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e2a:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e2e:	48 89 c6             	mov    %rax,%rsi
+  802e31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e34:	41 89 c8             	mov    %ecx,%r8d
+  802e37:	48 89 d1             	mov    %rdx,%rcx
+  802e3a:	89 c2                	mov    %eax,%edx
+  802e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e41:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+  802e4d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e50:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e54:	0f 89 da 00 00 00    	jns    802f34 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802e5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e5d:	89 c1                	mov    %eax,%ecx
+  802e5f:	48 b8 f0 6d 80 00 00 	movabs $0x806df0,%rax
+  802e66:	00 00 00 
+  802e69:	48 89 c2             	mov    %rax,%rdx
+  802e6c:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802e71:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  802e78:	00 00 00 
+  802e7b:	48 89 c7             	mov    %rax,%rdi
+  802e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e83:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  802e8a:	00 00 00 
+  802e8d:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802e90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e94:	25 02 08 00 00       	and    $0x802,%eax
+  802e99:	48 85 c0             	test   %rax,%rax
+  802e9c:	74 6e                	je     802f0c <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802e9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea2:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802ea8:	80 cc 08             	or     $0x8,%ah
+  802eab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802eaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eb3:	89 c7                	mov    %eax,%edi
+  802eb5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802eb9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ebc:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ec0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ec3:	41 89 f8             	mov    %edi,%r8d
+  802ec6:	89 c7                	mov    %eax,%edi
+  802ec8:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802ecf:	00 00 00 
+  802ed2:	ff d0                	call   *%rax
+  802ed4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802ed7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802edb:	79 05                	jns    802ee2 <duppage+0x12e>
+      return r;
+  802edd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee0:	eb 55                	jmp    802f37 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802ee2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ee6:	89 c7                	mov    %eax,%edi
+  802ee8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802eec:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802eef:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ef3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ef6:	41 89 f8             	mov    %edi,%r8d
+  802ef9:	89 c7                	mov    %eax,%edi
+  802efb:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802f02:	00 00 00 
+  802f05:	ff d0                	call   *%rax
+  802f07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f0a:	eb 28                	jmp    802f34 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802f0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f10:	89 c7                	mov    %eax,%edi
+  802f12:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f16:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f19:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802f1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f20:	41 89 f8             	mov    %edi,%r8d
+  802f23:	89 c7                	mov    %eax,%edi
+  802f25:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802f34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f37:	c9                   	leave
+  802f38:	c3                   	ret
+
+0000000000802f39 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802f39:	55                   	push   %rbp
+  802f3a:	48 89 e5             	mov    %rsp,%rbp
+  802f3d:	48 83 ec 20          	sub    $0x20,%rsp
+  802f41:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f44:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802f48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f4c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f50:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802f54:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f5b:	01 00 00 
+  802f5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f62:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f66:	25 00 08 00 00       	and    $0x800,%eax
+  802f6b:	48 85 c0             	test   %rax,%rax
+  802f6e:	74 0d                	je     802f7d <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f74:	0f b6 10             	movzbl (%rax),%edx
+  802f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f7b:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802f7d:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f84:	01 00 00 
+  802f87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f8f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f94:	89 c6                	mov    %eax,%esi
+  802f96:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802f9a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa1:	41 89 f0             	mov    %esi,%r8d
+  802fa4:	48 89 c6             	mov    %rax,%rsi
+  802fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fac:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+}
+  802fb8:	c9                   	leave
+  802fb9:	c3                   	ret
+
+0000000000802fba <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+  802fbe:	48 83 ec 40          	sub    $0x40,%rsp
+  802fc2:	89 f8                	mov    %edi,%eax
+  802fc4:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802fc7:	48 b8 5f 2b 80 00 00 	movabs $0x802b5f,%rax
+  802fce:	00 00 00 
+  802fd1:	48 89 c7             	mov    %rax,%rdi
+  802fd4:	48 b8 27 5c 80 00 00 	movabs $0x805c27,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802fe0:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fe5:	cd 30                	int    $0x30
+  802fe7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802fea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802fed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ff0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ff4:	79 36                	jns    80302c <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802ff6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ff9:	89 c1                	mov    %eax,%ecx
+  802ffb:	48 b8 1b 6e 80 00 00 	movabs $0x806e1b,%rax
+  803002:	00 00 00 
+  803005:	48 89 c2             	mov    %rax,%rdx
+  803008:	be 8f 00 00 00       	mov    $0x8f,%esi
+  80300d:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  803014:	00 00 00 
+  803017:	48 89 c7             	mov    %rax,%rdi
+  80301a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301f:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  803026:	00 00 00 
+  803029:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  80302c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803030:	75 0a                	jne    80303c <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+  803037:	e9 d3 02 00 00       	jmp    80330f <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  80303c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803043:	00 
+  803044:	e9 7a 01 00 00       	jmp    8031c3 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  803049:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80304d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803051:	48 c1 e8 27          	shr    $0x27,%rax
+  803055:	48 89 c2             	mov    %rax,%rdx
+  803058:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80305f:	01 00 00 
+  803062:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803066:	83 e0 01             	and    $0x1,%eax
+  803069:	48 85 c0             	test   %rax,%rax
+  80306c:	0f 84 4c 01 00 00    	je     8031be <fork_common+0x204>
+  803072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803076:	48 c1 e0 0c          	shl    $0xc,%rax
+  80307a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80307e:	48 89 c2             	mov    %rax,%rdx
+  803081:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803088:	01 00 00 
+  80308b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80308f:	83 e0 01             	and    $0x1,%eax
+  803092:	48 85 c0             	test   %rax,%rax
+  803095:	0f 84 23 01 00 00    	je     8031be <fork_common+0x204>
+  80309b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80309f:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030a3:	48 c1 e8 15          	shr    $0x15,%rax
+  8030a7:	48 89 c2             	mov    %rax,%rdx
+  8030aa:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8030b1:	01 00 00 
+  8030b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030b8:	83 e0 01             	and    $0x1,%eax
+  8030bb:	48 85 c0             	test   %rax,%rax
+  8030be:	0f 84 fa 00 00 00    	je     8031be <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  8030c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030cc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8030d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030d4:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  8030db:	00 00 00 
+  8030de:	48 39 c2             	cmp    %rax,%rdx
+  8030e1:	0f 82 d7 00 00 00    	jb     8031be <fork_common+0x204>
+  8030e7:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  8030ee:	00 00 00 
+  8030f1:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8030f5:	0f 84 c3 00 00 00    	je     8031be <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  8030fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ff:	48 89 c7             	mov    %rax,%rdi
+  803102:	48 b8 31 57 80 00 00 	movabs $0x805731,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803111:	84 c0                	test   %al,%al
+  803113:	0f 84 a5 00 00 00    	je     8031be <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803119:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80311d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803121:	48 89 c2             	mov    %rax,%rdx
+  803124:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80312b:	01 00 00 
+  80312e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803132:	83 e0 01             	and    $0x1,%eax
+  803135:	48 85 c0             	test   %rax,%rax
+  803138:	0f 84 80 00 00 00    	je     8031be <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  80313e:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803142:	74 4a                	je     80318e <fork_common+0x1d4>
+  803144:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803148:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  80314f:	00 00 00 
+  803152:	48 39 c2             	cmp    %rax,%rdx
+  803155:	73 13                	jae    80316a <fork_common+0x1b0>
+  803157:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80315b:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803162:	00 00 00 
+  803165:	48 39 c2             	cmp    %rax,%rdx
+  803168:	73 24                	jae    80318e <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  80316a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80316e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803172:	48 89 c2             	mov    %rax,%rdx
+  803175:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803178:	48 89 d6             	mov    %rdx,%rsi
+  80317b:	89 c7                	mov    %eax,%edi
+  80317d:	48 b8 39 2f 80 00 00 	movabs $0x802f39,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+  803189:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80318c:	eb 22                	jmp    8031b0 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  80318e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803192:	48 c1 e8 0c          	shr    $0xc,%rax
+  803196:	48 89 c2             	mov    %rax,%rdx
+  803199:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80319c:	48 89 d6             	mov    %rdx,%rsi
+  80319f:	89 c7                	mov    %eax,%edi
+  8031a1:	48 b8 b4 2d 80 00 00 	movabs $0x802db4,%rax
+  8031a8:	00 00 00 
+  8031ab:	ff d0                	call   *%rax
+  8031ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8031b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031b4:	79 08                	jns    8031be <fork_common+0x204>
+            return r;
+  8031b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031b9:	e9 51 01 00 00       	jmp    80330f <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8031be:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8031c3:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8031ca:	07 
+  8031cb:	0f 86 78 fe ff ff    	jbe    803049 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8031d1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031d8:	00 00 00 
+  8031db:	8b 40 04             	mov    0x4(%rax),%eax
+  8031de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031e3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031ea:	00 00 00 
+  8031ed:	48 98                	cltq
+  8031ef:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031f6:	48 01 d0             	add    %rdx,%rax
+  8031f9:	48 05 00 01 00 00    	add    $0x100,%rax
+  8031ff:	48 8b 10             	mov    (%rax),%rdx
+  803202:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803205:	48 89 d6             	mov    %rdx,%rsi
+  803208:	89 c7                	mov    %eax,%edi
+  80320a:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  803211:	00 00 00 
+  803214:	ff d0                	call   *%rax
+  803216:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803219:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80321d:	79 36                	jns    803255 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  80321f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803222:	89 c1                	mov    %eax,%ecx
+  803224:	48 b8 30 6e 80 00 00 	movabs $0x806e30,%rax
+  80322b:	00 00 00 
+  80322e:	48 89 c2             	mov    %rax,%rdx
+  803231:	be be 00 00 00       	mov    $0xbe,%esi
+  803236:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  80323d:	00 00 00 
+  803240:	48 89 c7             	mov    %rax,%rdi
+  803243:	b8 00 00 00 00       	mov    $0x0,%eax
+  803248:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  80324f:	00 00 00 
+  803252:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803255:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803258:	ba 02 00 00 00       	mov    $0x2,%edx
+  80325d:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803264:	00 00 00 
+  803267:	48 89 ce             	mov    %rcx,%rsi
+  80326a:	89 c7                	mov    %eax,%edi
+  80326c:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  803273:	00 00 00 
+  803276:	ff d0                	call   *%rax
+  803278:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80327b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80327f:	79 36                	jns    8032b7 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803281:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803284:	89 c1                	mov    %eax,%ecx
+  803286:	48 b8 60 6e 80 00 00 	movabs $0x806e60,%rax
+  80328d:	00 00 00 
+  803290:	48 89 c2             	mov    %rax,%rdx
+  803293:	be c1 00 00 00       	mov    $0xc1,%esi
+  803298:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  80329f:	00 00 00 
+  8032a2:	48 89 c7             	mov    %rax,%rdi
+  8032a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032aa:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8032b1:	00 00 00 
+  8032b4:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8032b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032ba:	be 02 00 00 00       	mov    $0x2,%esi
+  8032bf:	89 c7                	mov    %eax,%edi
+  8032c1:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  8032c8:	00 00 00 
+  8032cb:	ff d0                	call   *%rax
+  8032cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032d4:	79 36                	jns    80330c <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  8032d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032d9:	89 c1                	mov    %eax,%ecx
+  8032db:	48 b8 80 6e 80 00 00 	movabs $0x806e80,%rax
+  8032e2:	00 00 00 
+  8032e5:	48 89 c2             	mov    %rax,%rdx
+  8032e8:	be d4 00 00 00       	mov    $0xd4,%esi
+  8032ed:	48 b8 66 6d 80 00 00 	movabs $0x806d66,%rax
+  8032f4:	00 00 00 
+  8032f7:	48 89 c7             	mov    %rax,%rdi
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ff:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  803306:	00 00 00 
+  803309:	41 ff d0             	call   *%r8
+    }
+    return e;
+  80330c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  80330f:	c9                   	leave
+  803310:	c3                   	ret
+
+0000000000803311 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803311:	55                   	push   %rbp
+  803312:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331a:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+}
+  803326:	5d                   	pop    %rbp
+  803327:	c3                   	ret
+
+0000000000803328 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803328:	55                   	push   %rbp
+  803329:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  80332c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803331:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803338:	00 00 00 
+  80333b:	ff d0                	call   *%rax
+}
+  80333d:	5d                   	pop    %rbp
+  80333e:	c3                   	ret
+
+000000000080333f <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80333f:	55                   	push   %rbp
+  803340:	48 89 e5             	mov    %rsp,%rbp
+  803343:	48 83 ec 08          	sub    $0x8,%rsp
+  803347:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80334b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80334f:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803356:	ff ff ff 
+  803359:	48 01 d0             	add    %rdx,%rax
+  80335c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+0000000000803362 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803362:	55                   	push   %rbp
+  803363:	48 89 e5             	mov    %rsp,%rbp
+  803366:	48 83 ec 08          	sub    $0x8,%rsp
+  80336a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80336e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803372:	48 89 c7             	mov    %rax,%rdi
+  803375:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+  803381:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803387:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80338b:	c9                   	leave
+  80338c:	c3                   	ret
+
+000000000080338d <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80338d:	55                   	push   %rbp
+  80338e:	48 89 e5             	mov    %rsp,%rbp
+  803391:	48 83 ec 18          	sub    $0x18,%rsp
+  803395:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803399:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8033a0:	e9 ae 00 00 00       	jmp    803453 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8033a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033a8:	c1 e0 0c             	shl    $0xc,%eax
+  8033ab:	48 98                	cltq
+  8033ad:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033b2:	48 01 d0             	add    %rdx,%rax
+  8033b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8033b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033bd:	48 c1 e8 27          	shr    $0x27,%rax
+  8033c1:	48 89 c2             	mov    %rax,%rdx
+  8033c4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033cb:	01 00 00 
+  8033ce:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033d2:	83 e0 01             	and    $0x1,%eax
+  8033d5:	48 85 c0             	test   %rax,%rax
+  8033d8:	74 63                	je     80343d <fd_alloc+0xb0>
+  8033da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033de:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033e2:	48 89 c2             	mov    %rax,%rdx
+  8033e5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033ec:	01 00 00 
+  8033ef:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f3:	83 e0 01             	and    $0x1,%eax
+  8033f6:	48 85 c0             	test   %rax,%rax
+  8033f9:	74 42                	je     80343d <fd_alloc+0xb0>
+  8033fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033ff:	48 c1 e8 15          	shr    $0x15,%rax
+  803403:	48 89 c2             	mov    %rax,%rdx
+  803406:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80340d:	01 00 00 
+  803410:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803414:	83 e0 01             	and    $0x1,%eax
+  803417:	48 85 c0             	test   %rax,%rax
+  80341a:	74 21                	je     80343d <fd_alloc+0xb0>
+  80341c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803420:	48 c1 e8 0c          	shr    $0xc,%rax
+  803424:	48 89 c2             	mov    %rax,%rdx
+  803427:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80342e:	01 00 00 
+  803431:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803435:	83 e0 01             	and    $0x1,%eax
+  803438:	48 85 c0             	test   %rax,%rax
+  80343b:	75 12                	jne    80344f <fd_alloc+0xc2>
+      *fd_store = fd;
+  80343d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803441:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803445:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  803448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344d:	eb 1e                	jmp    80346d <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80344f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803453:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803457:	0f 8e 48 ff ff ff    	jle    8033a5 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80345d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803461:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803468:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80346d:	c9                   	leave
+  80346e:	c3                   	ret
+
+000000000080346f <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80346f:	55                   	push   %rbp
+  803470:	48 89 e5             	mov    %rsp,%rbp
+  803473:	48 83 ec 20          	sub    $0x20,%rsp
+  803477:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80347a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80347e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803482:	78 06                	js     80348a <fd_lookup+0x1b>
+  803484:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803488:	7e 0a                	jle    803494 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80348a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80348f:	e9 af 00 00 00       	jmp    803543 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803494:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803497:	c1 e0 0c             	shl    $0xc,%eax
+  80349a:	48 98                	cltq
+  80349c:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8034a1:	48 01 d0             	add    %rdx,%rax
+  8034a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8034a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ac:	48 c1 e8 27          	shr    $0x27,%rax
+  8034b0:	48 89 c2             	mov    %rax,%rdx
+  8034b3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8034ba:	01 00 00 
+  8034bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c1:	83 e0 01             	and    $0x1,%eax
+  8034c4:	48 85 c0             	test   %rax,%rax
+  8034c7:	74 63                	je     80352c <fd_lookup+0xbd>
+  8034c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034cd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034d1:	48 89 c2             	mov    %rax,%rdx
+  8034d4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8034db:	01 00 00 
+  8034de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e2:	83 e0 01             	and    $0x1,%eax
+  8034e5:	48 85 c0             	test   %rax,%rax
+  8034e8:	74 42                	je     80352c <fd_lookup+0xbd>
+  8034ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ee:	48 c1 e8 15          	shr    $0x15,%rax
+  8034f2:	48 89 c2             	mov    %rax,%rdx
+  8034f5:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8034fc:	01 00 00 
+  8034ff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803503:	83 e0 01             	and    $0x1,%eax
+  803506:	48 85 c0             	test   %rax,%rax
+  803509:	74 21                	je     80352c <fd_lookup+0xbd>
+  80350b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80350f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803513:	48 89 c2             	mov    %rax,%rdx
+  803516:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80351d:	01 00 00 
+  803520:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803524:	83 e0 01             	and    $0x1,%eax
+  803527:	48 85 c0             	test   %rax,%rax
+  80352a:	75 07                	jne    803533 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80352c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803531:	eb 10                	jmp    803543 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803533:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803537:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80353b:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80353e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803543:	c9                   	leave
+  803544:	c3                   	ret
+
+0000000000803545 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803545:	55                   	push   %rbp
+  803546:	48 89 e5             	mov    %rsp,%rbp
+  803549:	48 83 ec 30          	sub    $0x30,%rsp
+  80354d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803551:	89 f0                	mov    %esi,%eax
+  803553:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803556:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80355a:	48 89 c7             	mov    %rax,%rdi
+  80355d:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  803564:	00 00 00 
+  803567:	ff d0                	call   *%rax
+  803569:	89 c2                	mov    %eax,%edx
+  80356b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80356f:	48 89 c6             	mov    %rax,%rsi
+  803572:	89 d7                	mov    %edx,%edi
+  803574:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+  803580:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803583:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803587:	78 0a                	js     803593 <fd_close+0x4e>
+  803589:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80358d:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803591:	74 12                	je     8035a5 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803593:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803597:	74 05                	je     80359e <fd_close+0x59>
+  803599:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80359c:	eb 70                	jmp    80360e <fd_close+0xc9>
+  80359e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a3:	eb 69                	jmp    80360e <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8035a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035a9:	8b 00                	mov    (%rax),%eax
+  8035ab:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8035af:	48 89 d6             	mov    %rdx,%rsi
+  8035b2:	89 c7                	mov    %eax,%edi
+  8035b4:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  8035bb:	00 00 00 
+  8035be:	ff d0                	call   *%rax
+  8035c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035c7:	78 2a                	js     8035f3 <fd_close+0xae>
+    if (dev->dev_close)
+  8035c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035cd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8035d1:	48 85 c0             	test   %rax,%rax
+  8035d4:	74 16                	je     8035ec <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8035d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035da:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8035de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035e2:	48 89 c7             	mov    %rax,%rdi
+  8035e5:	ff d2                	call   *%rdx
+  8035e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035ea:	eb 07                	jmp    8035f3 <fd_close+0xae>
+    else
+      r = 0;
+  8035ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8035f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035f7:	48 89 c6             	mov    %rax,%rsi
+  8035fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ff:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+  return r;
+  80360b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80360e:	c9                   	leave
+  80360f:	c3                   	ret
+
+0000000000803610 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803610:	55                   	push   %rbp
+  803611:	48 89 e5             	mov    %rsp,%rbp
+  803614:	48 83 ec 20          	sub    $0x20,%rsp
+  803618:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80361b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  80361f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803626:	eb 3f                	jmp    803667 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803628:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80362f:	00 00 00 
+  803632:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803635:	48 98                	cltq
+  803637:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80363b:	8b 00                	mov    (%rax),%eax
+  80363d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803640:	75 21                	jne    803663 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803642:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803649:	00 00 00 
+  80364c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80364f:	48 98                	cltq
+  803651:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803655:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803659:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80365c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803661:	eb 7f                	jmp    8036e2 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803663:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803667:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80366e:	00 00 00 
+  803671:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803674:	48 98                	cltq
+  803676:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80367a:	48 85 c0             	test   %rax,%rax
+  80367d:	75 a9                	jne    803628 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80367f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803686:	00 00 00 
+  803689:	8b 40 04             	mov    0x4(%rax),%eax
+  80368c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803691:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803698:	00 00 00 
+  80369b:	48 98                	cltq
+  80369d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036a4:	48 01 d0             	add    %rdx,%rax
+  8036a7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8036ad:	8b 00                	mov    (%rax),%eax
+  8036af:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036b2:	89 c6                	mov    %eax,%esi
+  8036b4:	48 b8 a8 6e 80 00 00 	movabs $0x806ea8,%rax
+  8036bb:	00 00 00 
+  8036be:	48 89 c7             	mov    %rax,%rdi
+  8036c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c6:	48 b9 fa 06 80 00 00 	movabs $0x8006fa,%rcx
+  8036cd:	00 00 00 
+  8036d0:	ff d1                	call   *%rcx
+  *dev = 0;
+  8036d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036d6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8036dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8036e2:	c9                   	leave
+  8036e3:	c3                   	ret
+
+00000000008036e4 <close>:
+
+int
+close(int fdnum) {
+  8036e4:	55                   	push   %rbp
+  8036e5:	48 89 e5             	mov    %rsp,%rbp
+  8036e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8036ec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036ef:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8036f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036f6:	48 89 d6             	mov    %rdx,%rsi
+  8036f9:	89 c7                	mov    %eax,%edi
+  8036fb:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803702:	00 00 00 
+  803705:	ff d0                	call   *%rax
+  803707:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80370a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80370e:	79 05                	jns    803715 <close+0x31>
+    return r;
+  803710:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803713:	eb 18                	jmp    80372d <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803715:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803719:	be 01 00 00 00       	mov    $0x1,%esi
+  80371e:	48 89 c7             	mov    %rax,%rdi
+  803721:	48 b8 45 35 80 00 00 	movabs $0x803545,%rax
+  803728:	00 00 00 
+  80372b:	ff d0                	call   *%rax
+}
+  80372d:	c9                   	leave
+  80372e:	c3                   	ret
+
+000000000080372f <close_all>:
+
+void
+close_all(void) {
+  80372f:	55                   	push   %rbp
+  803730:	48 89 e5             	mov    %rsp,%rbp
+  803733:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803737:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80373e:	eb 15                	jmp    803755 <close_all+0x26>
+    close(i);
+  803740:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803743:	89 c7                	mov    %eax,%edi
+  803745:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  80374c:	00 00 00 
+  80374f:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803751:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803755:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803759:	7e e5                	jle    803740 <close_all+0x11>
+}
+  80375b:	90                   	nop
+  80375c:	90                   	nop
+  80375d:	c9                   	leave
+  80375e:	c3                   	ret
+
+000000000080375f <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  80375f:	55                   	push   %rbp
+  803760:	48 89 e5             	mov    %rsp,%rbp
+  803763:	48 83 ec 40          	sub    $0x40,%rsp
+  803767:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80376a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80376d:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803771:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803774:	48 89 d6             	mov    %rdx,%rsi
+  803777:	89 c7                	mov    %eax,%edi
+  803779:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  803785:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803788:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80378c:	79 08                	jns    803796 <dup+0x37>
+    return r;
+  80378e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803791:	e9 33 02 00 00       	jmp    8039c9 <dup+0x26a>
+  close(newfdnum);
+  803796:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803799:	89 c7                	mov    %eax,%edi
+  80379b:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  8037a2:	00 00 00 
+  8037a5:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8037a7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037aa:	c1 e0 0c             	shl    $0xc,%eax
+  8037ad:	48 98                	cltq
+  8037af:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8037b4:	48 01 d0             	add    %rdx,%rax
+  8037b7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8037bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037bf:	48 89 c7             	mov    %rax,%rdi
+  8037c2:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8037c9:	00 00 00 
+  8037cc:	ff d0                	call   *%rax
+  8037ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8037d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037d6:	48 89 c7             	mov    %rax,%rdi
+  8037d9:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+  8037e5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8037e9:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8037f0:	00 
+  8037f1:	e9 19 01 00 00       	jmp    80390f <dup+0x1b0>
+    off -= PGSIZE;
+  8037f6:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8037fd:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8037fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803802:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803806:	48 01 d0             	add    %rdx,%rax
+  803809:	48 c1 e8 27          	shr    $0x27,%rax
+  80380d:	48 89 c2             	mov    %rax,%rdx
+  803810:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803817:	01 00 00 
+  80381a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80381e:	83 e0 01             	and    $0x1,%eax
+  803821:	48 85 c0             	test   %rax,%rax
+  803824:	0f 84 e5 00 00 00    	je     80390f <dup+0x1b0>
+  80382a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80382e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803832:	48 01 d0             	add    %rdx,%rax
+  803835:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803839:	48 89 c2             	mov    %rax,%rdx
+  80383c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803843:	01 00 00 
+  803846:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80384a:	83 e0 01             	and    $0x1,%eax
+  80384d:	48 85 c0             	test   %rax,%rax
+  803850:	0f 84 b9 00 00 00    	je     80390f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803856:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80385a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80385e:	48 01 d0             	add    %rdx,%rax
+  803861:	48 c1 e8 15          	shr    $0x15,%rax
+  803865:	48 89 c2             	mov    %rax,%rdx
+  803868:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80386f:	01 00 00 
+  803872:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803876:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803879:	48 85 c0             	test   %rax,%rax
+  80387c:	0f 84 8d 00 00 00    	je     80390f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803882:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803886:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80388a:	48 01 d0             	add    %rdx,%rax
+  80388d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803891:	48 89 c2             	mov    %rax,%rdx
+  803894:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80389b:	01 00 00 
+  80389e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038a2:	83 e0 01             	and    $0x1,%eax
+  8038a5:	48 85 c0             	test   %rax,%rax
+  8038a8:	74 65                	je     80390f <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8038aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038b2:	48 01 d0             	add    %rdx,%rax
+  8038b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038b9:	48 89 c2             	mov    %rax,%rdx
+  8038bc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038c3:	01 00 00 
+  8038c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038ca:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038cf:	89 c6                	mov    %eax,%esi
+  8038d1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038d9:	48 01 c2             	add    %rax,%rdx
+  8038dc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8038e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038e4:	48 01 c8             	add    %rcx,%rax
+  8038e7:	41 89 f0             	mov    %esi,%r8d
+  8038ea:	48 89 d1             	mov    %rdx,%rcx
+  8038ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038f2:	48 89 c6             	mov    %rax,%rsi
+  8038f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038fa:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+  803906:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803909:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80390d:	78 60                	js     80396f <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80390f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803914:	0f 85 dc fe ff ff    	jne    8037f6 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80391a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80391e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803922:	48 89 c2             	mov    %rax,%rdx
+  803925:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80392c:	01 00 00 
+  80392f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803933:	25 07 0e 00 00       	and    $0xe07,%eax
+  803938:	89 c1                	mov    %eax,%ecx
+  80393a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80393e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803942:	41 89 c8             	mov    %ecx,%r8d
+  803945:	48 89 d1             	mov    %rdx,%rcx
+  803948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80394d:	48 89 c6             	mov    %rax,%rsi
+  803950:	bf 00 00 00 00       	mov    $0x0,%edi
+  803955:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+  803961:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803964:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803968:	78 08                	js     803972 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80396a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80396d:	eb 5a                	jmp    8039c9 <dup+0x26a>
+        goto err;
+  80396f:	90                   	nop
+  803970:	eb 01                	jmp    803973 <dup+0x214>
+    goto err;
+  803972:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803973:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803977:	48 89 c6             	mov    %rax,%rsi
+  80397a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80397f:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80398b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803992:	00 
+  803993:	eb 27                	jmp    8039bc <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803995:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803999:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80399d:	48 01 d0             	add    %rdx,%rax
+  8039a0:	48 89 c6             	mov    %rax,%rsi
+  8039a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a8:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  8039af:	00 00 00 
+  8039b2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8039b4:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8039bb:	00 
+  8039bc:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8039c3:	00 
+  8039c4:	76 cf                	jbe    803995 <dup+0x236>
+  return r;
+  8039c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8039c9:	c9                   	leave
+  8039ca:	c3                   	ret
+
+00000000008039cb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8039cb:	55                   	push   %rbp
+  8039cc:	48 89 e5             	mov    %rsp,%rbp
+  8039cf:	48 83 ec 40          	sub    $0x40,%rsp
+  8039d3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039d6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039de:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039e5:	48 89 d6             	mov    %rdx,%rsi
+  8039e8:	89 c7                	mov    %eax,%edi
+  8039ea:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  8039f1:	00 00 00 
+  8039f4:	ff d0                	call   *%rax
+  8039f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039fd:	78 24                	js     803a23 <read+0x58>
+  8039ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a03:	8b 00                	mov    (%rax),%eax
+  803a05:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a09:	48 89 d6             	mov    %rdx,%rsi
+  803a0c:	89 c7                	mov    %eax,%edi
+  803a0e:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803a15:	00 00 00 
+  803a18:	ff d0                	call   *%rax
+  803a1a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a21:	79 0a                	jns    803a2d <read+0x62>
+    return r;
+  803a23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a26:	48 98                	cltq
+  803a28:	e9 9e 00 00 00       	jmp    803acb <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a31:	8b 40 08             	mov    0x8(%rax),%eax
+  803a34:	83 e0 03             	and    $0x3,%eax
+  803a37:	83 f8 01             	cmp    $0x1,%eax
+  803a3a:	75 5c                	jne    803a98 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a3c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803a43:	00 00 00 
+  803a46:	8b 40 04             	mov    0x4(%rax),%eax
+  803a49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a4e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a55:	00 00 00 
+  803a58:	48 98                	cltq
+  803a5a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a61:	48 01 d0             	add    %rdx,%rax
+  803a64:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a6a:	8b 00                	mov    (%rax),%eax
+  803a6c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a6f:	89 c6                	mov    %eax,%esi
+  803a71:	48 b8 c7 6e 80 00 00 	movabs $0x806ec7,%rax
+  803a78:	00 00 00 
+  803a7b:	48 89 c7             	mov    %rax,%rdi
+  803a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a83:	48 b9 fa 06 80 00 00 	movabs $0x8006fa,%rcx
+  803a8a:	00 00 00 
+  803a8d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a96:	eb 33                	jmp    803acb <read+0x100>
+  }
+  if (!dev->dev_read)
+  803a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803aa0:	48 85 c0             	test   %rax,%rax
+  803aa3:	75 09                	jne    803aae <read+0xe3>
+    return -E_NOT_SUPP;
+  803aa5:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803aac:	eb 1d                	jmp    803acb <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803aae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab2:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803ab6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803abe:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803ac2:	48 89 ce             	mov    %rcx,%rsi
+  803ac5:	48 89 c7             	mov    %rax,%rdi
+  803ac8:	41 ff d0             	call   *%r8
+}
+  803acb:	c9                   	leave
+  803acc:	c3                   	ret
+
+0000000000803acd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803acd:	55                   	push   %rbp
+  803ace:	48 89 e5             	mov    %rsp,%rbp
+  803ad1:	48 83 ec 30          	sub    $0x30,%rsp
+  803ad5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803ad8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803adc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803ae0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803ae7:	eb 49                	jmp    803b32 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803ae9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803aec:	48 98                	cltq
+  803aee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803af2:	48 29 c2             	sub    %rax,%rdx
+  803af5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803af8:	48 63 c8             	movslq %eax,%rcx
+  803afb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aff:	48 01 c1             	add    %rax,%rcx
+  803b02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b05:	48 89 ce             	mov    %rcx,%rsi
+  803b08:	89 c7                	mov    %eax,%edi
+  803b0a:	48 b8 cb 39 80 00 00 	movabs $0x8039cb,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+  803b16:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803b19:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803b1d:	79 07                	jns    803b26 <readn+0x59>
+      return m;
+  803b1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803b22:	48 98                	cltq
+  803b24:	eb 1f                	jmp    803b45 <readn+0x78>
+    if (m == 0)
+  803b26:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803b2a:	74 13                	je     803b3f <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803b2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803b2f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803b32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b35:	48 98                	cltq
+  803b37:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803b3b:	72 ac                	jb     803ae9 <readn+0x1c>
+  803b3d:	eb 01                	jmp    803b40 <readn+0x73>
+      break;
+  803b3f:	90                   	nop
+  }
+  return tot;
+  803b40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b43:	48 98                	cltq
+}
+  803b45:	c9                   	leave
+  803b46:	c3                   	ret
+
+0000000000803b47 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803b47:	55                   	push   %rbp
+  803b48:	48 89 e5             	mov    %rsp,%rbp
+  803b4b:	48 83 ec 40          	sub    $0x40,%rsp
+  803b4f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b52:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803b56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b5a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b61:	48 89 d6             	mov    %rdx,%rsi
+  803b64:	89 c7                	mov    %eax,%edi
+  803b66:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b79:	78 24                	js     803b9f <write+0x58>
+  803b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b7f:	8b 00                	mov    (%rax),%eax
+  803b81:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b85:	48 89 d6             	mov    %rdx,%rsi
+  803b88:	89 c7                	mov    %eax,%edi
+  803b8a:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803b91:	00 00 00 
+  803b94:	ff d0                	call   *%rax
+  803b96:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b99:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b9d:	79 0a                	jns    803ba9 <write+0x62>
+    return r;
+  803b9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ba2:	48 98                	cltq
+  803ba4:	e9 9d 00 00 00       	jmp    803c46 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ba9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bad:	8b 40 08             	mov    0x8(%rax),%eax
+  803bb0:	83 e0 03             	and    $0x3,%eax
+  803bb3:	85 c0                	test   %eax,%eax
+  803bb5:	75 5c                	jne    803c13 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803bb7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803bbe:	00 00 00 
+  803bc1:	8b 40 04             	mov    0x4(%rax),%eax
+  803bc4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803bc9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803bd0:	00 00 00 
+  803bd3:	48 98                	cltq
+  803bd5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803bdc:	48 01 d0             	add    %rdx,%rax
+  803bdf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803be5:	8b 00                	mov    (%rax),%eax
+  803be7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803bea:	89 c6                	mov    %eax,%esi
+  803bec:	48 b8 e3 6e 80 00 00 	movabs $0x806ee3,%rax
+  803bf3:	00 00 00 
+  803bf6:	48 89 c7             	mov    %rax,%rdi
+  803bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfe:	48 b9 fa 06 80 00 00 	movabs $0x8006fa,%rcx
+  803c05:	00 00 00 
+  803c08:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c0a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c11:	eb 33                	jmp    803c46 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803c13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c17:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803c1b:	48 85 c0             	test   %rax,%rax
+  803c1e:	75 09                	jne    803c29 <write+0xe2>
+    return -E_NOT_SUPP;
+  803c20:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803c27:	eb 1d                	jmp    803c46 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803c29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c2d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803c31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c35:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c39:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803c3d:	48 89 ce             	mov    %rcx,%rsi
+  803c40:	48 89 c7             	mov    %rax,%rdi
+  803c43:	41 ff d0             	call   *%r8
+}
+  803c46:	c9                   	leave
+  803c47:	c3                   	ret
+
+0000000000803c48 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803c48:	55                   	push   %rbp
+  803c49:	48 89 e5             	mov    %rsp,%rbp
+  803c4c:	48 83 ec 18          	sub    $0x18,%rsp
+  803c50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c53:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c56:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c5d:	48 89 d6             	mov    %rdx,%rsi
+  803c60:	89 c7                	mov    %eax,%edi
+  803c62:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803c69:	00 00 00 
+  803c6c:	ff d0                	call   *%rax
+  803c6e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c71:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c75:	79 05                	jns    803c7c <seek+0x34>
+    return r;
+  803c77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c7a:	eb 0f                	jmp    803c8b <seek+0x43>
+  fd->fd_offset = offset;
+  803c7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c80:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c83:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c8b:	c9                   	leave
+  803c8c:	c3                   	ret
+
+0000000000803c8d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803c8d:	55                   	push   %rbp
+  803c8e:	48 89 e5             	mov    %rsp,%rbp
+  803c91:	48 83 ec 30          	sub    $0x30,%rsp
+  803c95:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c98:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c9b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ca2:	48 89 d6             	mov    %rdx,%rsi
+  803ca5:	89 c7                	mov    %eax,%edi
+  803ca7:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803cae:	00 00 00 
+  803cb1:	ff d0                	call   *%rax
+  803cb3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cb6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cba:	78 24                	js     803ce0 <ftruncate+0x53>
+  803cbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc0:	8b 00                	mov    (%rax),%eax
+  803cc2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803cc6:	48 89 d6             	mov    %rdx,%rsi
+  803cc9:	89 c7                	mov    %eax,%edi
+  803ccb:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803cd2:	00 00 00 
+  803cd5:	ff d0                	call   *%rax
+  803cd7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cda:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cde:	79 08                	jns    803ce8 <ftruncate+0x5b>
+    return r;
+  803ce0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ce3:	e9 92 00 00 00       	jmp    803d7a <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cec:	8b 40 08             	mov    0x8(%rax),%eax
+  803cef:	83 e0 03             	and    $0x3,%eax
+  803cf2:	85 c0                	test   %eax,%eax
+  803cf4:	75 5a                	jne    803d50 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803cf6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803cfd:	00 00 00 
+  803d00:	8b 40 04             	mov    0x4(%rax),%eax
+  803d03:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803d08:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803d0f:	00 00 00 
+  803d12:	48 98                	cltq
+  803d14:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803d1b:	48 01 d0             	add    %rdx,%rax
+  803d1e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803d24:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803d26:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803d29:	89 c6                	mov    %eax,%esi
+  803d2b:	48 b8 00 6f 80 00 00 	movabs $0x806f00,%rax
+  803d32:	00 00 00 
+  803d35:	48 89 c7             	mov    %rax,%rdi
+  803d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3d:	48 b9 fa 06 80 00 00 	movabs $0x8006fa,%rcx
+  803d44:	00 00 00 
+  803d47:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803d49:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d4e:	eb 2a                	jmp    803d7a <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803d50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d54:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803d58:	48 85 c0             	test   %rax,%rax
+  803d5b:	75 07                	jne    803d64 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803d5d:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d62:	eb 16                	jmp    803d7a <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803d64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d68:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803d6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d70:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803d73:	89 d6                	mov    %edx,%esi
+  803d75:	48 89 c7             	mov    %rax,%rdi
+  803d78:	ff d1                	call   *%rcx
+}
+  803d7a:	c9                   	leave
+  803d7b:	c3                   	ret
+
+0000000000803d7c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d7c:	55                   	push   %rbp
+  803d7d:	48 89 e5             	mov    %rsp,%rbp
+  803d80:	48 83 ec 30          	sub    $0x30,%rsp
+  803d84:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d87:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d8b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d8f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d92:	48 89 d6             	mov    %rdx,%rsi
+  803d95:	89 c7                	mov    %eax,%edi
+  803d97:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803d9e:	00 00 00 
+  803da1:	ff d0                	call   *%rax
+  803da3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803da6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803daa:	78 24                	js     803dd0 <fstat+0x54>
+  803dac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db0:	8b 00                	mov    (%rax),%eax
+  803db2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803db6:	48 89 d6             	mov    %rdx,%rsi
+  803db9:	89 c7                	mov    %eax,%edi
+  803dbb:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  803dc2:	00 00 00 
+  803dc5:	ff d0                	call   *%rax
+  803dc7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dce:	79 05                	jns    803dd5 <fstat+0x59>
+    return r;
+  803dd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dd3:	eb 5e                	jmp    803e33 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803dd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dd9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803ddd:	48 85 c0             	test   %rax,%rax
+  803de0:	75 07                	jne    803de9 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803de2:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803de7:	eb 4a                	jmp    803e33 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803de9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ded:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803df0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803df4:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803dfb:	00 00 00 
+  stat->st_isdir   = 0;
+  803dfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e02:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803e09:	00 00 00 
+  stat->st_dev     = dev;
+  803e0c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e14:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803e1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e1f:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803e23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e27:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e2b:	48 89 d6             	mov    %rdx,%rsi
+  803e2e:	48 89 c7             	mov    %rax,%rdi
+  803e31:	ff d1                	call   *%rcx
+}
+  803e33:	c9                   	leave
+  803e34:	c3                   	ret
+
+0000000000803e35 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803e35:	55                   	push   %rbp
+  803e36:	48 89 e5             	mov    %rsp,%rbp
+  803e39:	48 83 ec 10          	sub    $0x10,%rsp
+  803e3d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e41:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803e45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e49:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e4f:	83 f8 20             	cmp    $0x20,%eax
+  803e52:	75 07                	jne    803e5b <pollwait_key+0x26>
+    return -E_INVAL;
+  803e54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e59:	eb 5f                	jmp    803eba <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803e5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e5f:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e69:	48 63 d2             	movslq %edx,%rdx
+  803e6c:	48 c1 e2 04          	shl    $0x4,%rdx
+  803e70:	48 01 c2             	add    %rax,%rdx
+  803e73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e77:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803e7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e7e:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803e84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e88:	8b 00                	mov    (%rax),%eax
+  803e8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e8e:	48 63 c9             	movslq %ecx,%rcx
+  803e91:	48 c1 e1 04          	shl    $0x4,%rcx
+  803e95:	48 01 ca             	add    %rcx,%rdx
+  803e98:	48 83 c2 08          	add    $0x8,%rdx
+  803e9c:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803e9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ea2:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803ea8:	8d 50 01             	lea    0x1(%rax),%edx
+  803eab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803eaf:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eba:	c9                   	leave
+  803ebb:	c3                   	ret
+
+0000000000803ebc <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803ebc:	55                   	push   %rbp
+  803ebd:	48 89 e5             	mov    %rsp,%rbp
+  803ec0:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803ec7:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803ece:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803ed4:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803edb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ee2:	00 
+  int i, r, ready, ipc = 0;
+  803ee3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803eea:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803ef1:	00 
+  803ef2:	74 45                	je     803f39 <poll+0x7d>
+  803ef4:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803efb:	ff 
+  803efc:	74 3b                	je     803f39 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803efe:	48 b8 36 58 80 00 00 	movabs $0x805836,%rax
+  803f05:	00 00 00 
+  803f08:	ff d0                	call   *%rax
+  803f0a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803f0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f12:	48 f7 d0             	not    %rax
+  803f15:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803f1c:	73 10                	jae    803f2e <poll+0x72>
+  803f1e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f22:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803f29:	48 01 d0             	add    %rdx,%rax
+  803f2c:	eb 07                	jmp    803f35 <poll+0x79>
+  803f2e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803f35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803f39:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803f40:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803f47:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803f4e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803f55:	e9 46 02 00 00       	jmp    8041a0 <poll+0x2e4>
+      fds[i].revents = 0;
+  803f5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f5d:	48 63 d0             	movslq %eax,%rdx
+  803f60:	48 89 d0             	mov    %rdx,%rax
+  803f63:	48 01 c0             	add    %rax,%rax
+  803f66:	48 01 d0             	add    %rdx,%rax
+  803f69:	48 c1 e0 02          	shl    $0x2,%rax
+  803f6d:	48 89 c2             	mov    %rax,%rdx
+  803f70:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f77:	48 01 d0             	add    %rdx,%rax
+  803f7a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803f81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f84:	48 63 d0             	movslq %eax,%rdx
+  803f87:	48 89 d0             	mov    %rdx,%rax
+  803f8a:	48 01 c0             	add    %rax,%rax
+  803f8d:	48 01 d0             	add    %rdx,%rax
+  803f90:	48 c1 e0 02          	shl    $0x2,%rax
+  803f94:	48 89 c2             	mov    %rax,%rdx
+  803f97:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f9e:	48 01 d0             	add    %rdx,%rax
+  803fa1:	8b 00                	mov    (%rax),%eax
+  803fa3:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803fa6:	75 62                	jne    80400a <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803fa8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fab:	48 63 d0             	movslq %eax,%rdx
+  803fae:	48 89 d0             	mov    %rdx,%rax
+  803fb1:	48 01 c0             	add    %rax,%rax
+  803fb4:	48 01 d0             	add    %rdx,%rax
+  803fb7:	48 c1 e0 02          	shl    $0x2,%rax
+  803fbb:	48 89 c2             	mov    %rax,%rdx
+  803fbe:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fc5:	48 01 d0             	add    %rdx,%rax
+  803fc8:	8b 40 04             	mov    0x4(%rax),%eax
+  803fcb:	83 e0 01             	and    $0x1,%eax
+  803fce:	85 c0                	test   %eax,%eax
+  803fd0:	0f 84 9b 01 00 00    	je     804171 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803fd6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fd9:	48 63 d0             	movslq %eax,%rdx
+  803fdc:	48 89 d0             	mov    %rdx,%rax
+  803fdf:	48 01 c0             	add    %rax,%rax
+  803fe2:	48 01 d0             	add    %rdx,%rax
+  803fe5:	48 c1 e0 02          	shl    $0x2,%rax
+  803fe9:	48 89 c2             	mov    %rax,%rdx
+  803fec:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ff3:	48 01 c2             	add    %rax,%rdx
+  803ff6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ff9:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803ffc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803fff:	83 c8 04             	or     $0x4,%eax
+  804002:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  804005:	e9 67 01 00 00       	jmp    804171 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80400a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80400d:	48 63 d0             	movslq %eax,%rdx
+  804010:	48 89 d0             	mov    %rdx,%rax
+  804013:	48 01 c0             	add    %rax,%rax
+  804016:	48 01 d0             	add    %rdx,%rax
+  804019:	48 c1 e0 02          	shl    $0x2,%rax
+  80401d:	48 89 c2             	mov    %rax,%rdx
+  804020:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804027:	48 01 d0             	add    %rdx,%rax
+  80402a:	8b 00                	mov    (%rax),%eax
+  80402c:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804033:	48 89 d6             	mov    %rdx,%rsi
+  804036:	89 c7                	mov    %eax,%edi
+  804038:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80403f:	00 00 00 
+  804042:	ff d0                	call   *%rax
+  804044:	85 c0                	test   %eax,%eax
+  804046:	78 25                	js     80406d <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  804048:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80404f:	8b 00                	mov    (%rax),%eax
+  804051:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804058:	48 89 d6             	mov    %rdx,%rsi
+  80405b:	89 c7                	mov    %eax,%edi
+  80405d:	48 b8 10 36 80 00 00 	movabs $0x803610,%rax
+  804064:	00 00 00 
+  804067:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804069:	85 c0                	test   %eax,%eax
+  80406b:	79 2c                	jns    804099 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80406d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804070:	48 63 d0             	movslq %eax,%rdx
+  804073:	48 89 d0             	mov    %rdx,%rax
+  804076:	48 01 c0             	add    %rax,%rax
+  804079:	48 01 d0             	add    %rdx,%rax
+  80407c:	48 c1 e0 02          	shl    $0x2,%rax
+  804080:	48 89 c2             	mov    %rax,%rdx
+  804083:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80408a:	48 01 d0             	add    %rdx,%rax
+  80408d:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804094:	e9 d8 00 00 00       	jmp    804171 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804099:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8040a0:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8040a4:	48 85 c0             	test   %rax,%rax
+  8040a7:	74 7d                	je     804126 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8040a9:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8040b0:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8040b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b7:	48 63 d0             	movslq %eax,%rdx
+  8040ba:	48 89 d0             	mov    %rdx,%rax
+  8040bd:	48 01 c0             	add    %rax,%rax
+  8040c0:	48 01 d0             	add    %rdx,%rax
+  8040c3:	48 c1 e0 02          	shl    $0x2,%rax
+  8040c7:	48 89 c2             	mov    %rax,%rdx
+  8040ca:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040d1:	48 01 d0             	add    %rdx,%rax
+  8040d4:	8b 48 04             	mov    0x4(%rax),%ecx
+  8040d7:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8040de:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8040e5:	89 ce                	mov    %ecx,%esi
+  8040e7:	48 89 c7             	mov    %rax,%rdi
+  8040ea:	41 ff d0             	call   *%r8
+  8040ed:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8040f0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8040f4:	79 08                	jns    8040fe <poll+0x242>
+          return r;
+  8040f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040f9:	e9 45 01 00 00       	jmp    804243 <poll+0x387>
+        fds[i].revents = r;
+  8040fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804101:	48 63 d0             	movslq %eax,%rdx
+  804104:	48 89 d0             	mov    %rdx,%rax
+  804107:	48 01 c0             	add    %rax,%rax
+  80410a:	48 01 d0             	add    %rdx,%rax
+  80410d:	48 c1 e0 02          	shl    $0x2,%rax
+  804111:	48 89 c2             	mov    %rax,%rdx
+  804114:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80411b:	48 01 c2             	add    %rax,%rdx
+  80411e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804121:	89 42 08             	mov    %eax,0x8(%rdx)
+  804124:	eb 4b                	jmp    804171 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804126:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804129:	48 63 d0             	movslq %eax,%rdx
+  80412c:	48 89 d0             	mov    %rdx,%rax
+  80412f:	48 01 c0             	add    %rax,%rax
+  804132:	48 01 d0             	add    %rdx,%rax
+  804135:	48 c1 e0 02          	shl    $0x2,%rax
+  804139:	48 89 c2             	mov    %rax,%rdx
+  80413c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804143:	48 01 d0             	add    %rdx,%rax
+  804146:	8b 48 04             	mov    0x4(%rax),%ecx
+  804149:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80414c:	48 63 d0             	movslq %eax,%rdx
+  80414f:	48 89 d0             	mov    %rdx,%rax
+  804152:	48 01 c0             	add    %rax,%rax
+  804155:	48 01 d0             	add    %rdx,%rax
+  804158:	48 c1 e0 02          	shl    $0x2,%rax
+  80415c:	48 89 c2             	mov    %rax,%rdx
+  80415f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804166:	48 01 d0             	add    %rdx,%rax
+  804169:	83 e1 03             	and    $0x3,%ecx
+  80416c:	89 ca                	mov    %ecx,%edx
+  80416e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804171:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804174:	48 63 d0             	movslq %eax,%rdx
+  804177:	48 89 d0             	mov    %rdx,%rax
+  80417a:	48 01 c0             	add    %rax,%rax
+  80417d:	48 01 d0             	add    %rdx,%rax
+  804180:	48 c1 e0 02          	shl    $0x2,%rax
+  804184:	48 89 c2             	mov    %rax,%rdx
+  804187:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80418e:	48 01 d0             	add    %rdx,%rax
+  804191:	8b 40 08             	mov    0x8(%rax),%eax
+  804194:	85 c0                	test   %eax,%eax
+  804196:	74 04                	je     80419c <poll+0x2e0>
+        ready++;
+  804198:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80419c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8041a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041a3:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8041a9:	0f 8c ab fd ff ff    	jl     803f5a <poll+0x9e>
+    }
+    if (ready)
+  8041af:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8041b3:	74 08                	je     8041bd <poll+0x301>
+      return ready;
+  8041b5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8041b8:	e9 86 00 00 00       	jmp    804243 <poll+0x387>
+
+    if (deadline) {
+  8041bd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8041c2:	74 30                	je     8041f4 <poll+0x338>
+      now     = vsys_clock_ns();
+  8041c4:	48 b8 36 58 80 00 00 	movabs $0x805836,%rax
+  8041cb:	00 00 00 
+  8041ce:	ff d0                	call   *%rax
+  8041d0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8041d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8041dc:	73 0a                	jae    8041e8 <poll+0x32c>
+  8041de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e2:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8041e6:	eb 05                	jmp    8041ed <poll+0x331>
+  8041e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ed:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8041f4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8041f7:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8041fa:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804201:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804208:	48 89 c7             	mov    %rax,%rdi
+  80420b:	48 b8 c0 28 80 00 00 	movabs $0x8028c0,%rax
+  804212:	00 00 00 
+  804215:	ff d0                	call   *%rax
+  804217:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80421a:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80421e:	75 07                	jne    804227 <poll+0x36b>
+      return 0;
+  804220:	b8 00 00 00 00       	mov    $0x0,%eax
+  804225:	eb 1c                	jmp    804243 <poll+0x387>
+    if (r < 0)
+  804227:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80422b:	79 05                	jns    804232 <poll+0x376>
+      return r;
+  80422d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804230:	eb 11                	jmp    804243 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804232:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804235:	c1 f8 02             	sar    $0x2,%eax
+  804238:	83 e0 01             	and    $0x1,%eax
+  80423b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80423e:	e9 f6 fc ff ff       	jmp    803f39 <poll+0x7d>
+  }
+}
+  804243:	c9                   	leave
+  804244:	c3                   	ret
+
+0000000000804245 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804245:	55                   	push   %rbp
+  804246:	48 89 e5             	mov    %rsp,%rbp
+  804249:	48 83 ec 20          	sub    $0x20,%rsp
+  80424d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804251:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804255:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804259:	be 00 00 00 00       	mov    $0x0,%esi
+  80425e:	48 89 c7             	mov    %rax,%rdi
+  804261:	48 b8 33 43 80 00 00 	movabs $0x804333,%rax
+  804268:	00 00 00 
+  80426b:	ff d0                	call   *%rax
+  80426d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804270:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804274:	79 05                	jns    80427b <stat+0x36>
+    return fd;
+  804276:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804279:	eb 2f                	jmp    8042aa <stat+0x65>
+  r = fstat(fd, stat);
+  80427b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80427f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804282:	48 89 d6             	mov    %rdx,%rsi
+  804285:	89 c7                	mov    %eax,%edi
+  804287:	48 b8 7c 3d 80 00 00 	movabs $0x803d7c,%rax
+  80428e:	00 00 00 
+  804291:	ff d0                	call   *%rax
+  804293:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804296:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804299:	89 c7                	mov    %eax,%edi
+  80429b:	48 b8 e4 36 80 00 00 	movabs $0x8036e4,%rax
+  8042a2:	00 00 00 
+  8042a5:	ff d0                	call   *%rax
+  return r;
+  8042a7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8042aa:	c9                   	leave
+  8042ab:	c3                   	ret
+
+00000000008042ac <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8042ac:	55                   	push   %rbp
+  8042ad:	48 89 e5             	mov    %rsp,%rbp
+  8042b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8042b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8042b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8042bb:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042c2:	00 00 00 
+  8042c5:	8b 00                	mov    (%rax),%eax
+  8042c7:	85 c0                	test   %eax,%eax
+  8042c9:	75 1d                	jne    8042e8 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8042d0:	48 b8 b7 5f 80 00 00 	movabs $0x805fb7,%rax
+  8042d7:	00 00 00 
+  8042da:	ff d0                	call   *%rax
+  8042dc:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8042e3:	00 00 00 
+  8042e6:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8042e8:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042ef:	00 00 00 
+  8042f2:	8b 00                	mov    (%rax),%eax
+  8042f4:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8042f7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8042fc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804303:	00 00 00 
+  804306:	89 c7                	mov    %eax,%edi
+  804308:	48 b8 0a 5f 80 00 00 	movabs $0x805f0a,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804314:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80431d:	48 89 c6             	mov    %rax,%rsi
+  804320:	bf 00 00 00 00       	mov    $0x0,%edi
+  804325:	48 b8 8d 5d 80 00 00 	movabs $0x805d8d,%rax
+  80432c:	00 00 00 
+  80432f:	ff d0                	call   *%rax
+}
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+
+0000000000804333 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804333:	55                   	push   %rbp
+  804334:	48 89 e5             	mov    %rsp,%rbp
+  804337:	48 83 ec 20          	sub    $0x20,%rsp
+  80433b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80433f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804342:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804346:	48 89 c7             	mov    %rax,%rdi
+  804349:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+  804355:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80435a:	7e 0a                	jle    804366 <open+0x33>
+    return -E_BAD_PATH;
+  80435c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804361:	e9 a8 00 00 00       	jmp    80440e <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804366:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80436a:	48 89 c7             	mov    %rax,%rdi
+  80436d:	48 b8 8d 33 80 00 00 	movabs $0x80338d,%rax
+  804374:	00 00 00 
+  804377:	ff d0                	call   *%rax
+  804379:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80437c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804380:	79 08                	jns    80438a <open+0x57>
+    return r;
+  804382:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804385:	e9 84 00 00 00       	jmp    80440e <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80438a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80438e:	48 89 c6             	mov    %rax,%rsi
+  804391:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804398:	00 00 00 
+  80439b:	48 89 c7             	mov    %rax,%rdi
+  80439e:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  8043a5:	00 00 00 
+  8043a8:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8043aa:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043b1:	00 00 00 
+  8043b4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8043b7:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8043bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043c1:	48 89 c6             	mov    %rax,%rsi
+  8043c4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043c9:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  8043d0:	00 00 00 
+  8043d3:	ff d0                	call   *%rax
+  8043d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043dc:	79 1d                	jns    8043fb <open+0xc8>
+    fd_close(fd, 0);
+  8043de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8043e7:	48 89 c7             	mov    %rax,%rdi
+  8043ea:	48 b8 45 35 80 00 00 	movabs $0x803545,%rax
+  8043f1:	00 00 00 
+  8043f4:	ff d0                	call   *%rax
+    return r;
+  8043f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043f9:	eb 13                	jmp    80440e <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8043fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ff:	48 89 c7             	mov    %rax,%rdi
+  804402:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+}
+  80440e:	c9                   	leave
+  80440f:	c3                   	ret
+
+0000000000804410 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804410:	55                   	push   %rbp
+  804411:	48 89 e5             	mov    %rsp,%rbp
+  804414:	48 83 ec 10          	sub    $0x10,%rsp
+  804418:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80441c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804420:	8b 40 0c             	mov    0xc(%rax),%eax
+  804423:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80442a:	00 00 00 
+  80442d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80442f:	be 00 00 00 00       	mov    $0x0,%esi
+  804434:	bf 06 00 00 00       	mov    $0x6,%edi
+  804439:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  804440:	00 00 00 
+  804443:	ff d0                	call   *%rax
+}
+  804445:	c9                   	leave
+  804446:	c3                   	ret
+
+0000000000804447 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804447:	55                   	push   %rbp
+  804448:	48 89 e5             	mov    %rsp,%rbp
+  80444b:	48 83 ec 30          	sub    $0x30,%rsp
+  80444f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804453:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804457:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80445b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804460:	74 07                	je     804469 <devfile_read+0x22>
+  804462:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804467:	75 0a                	jne    804473 <devfile_read+0x2c>
+  return E_INVAL;
+  804469:	b8 03 00 00 00       	mov    $0x3,%eax
+  80446e:	e9 b4 00 00 00       	jmp    804527 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804473:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80447a:	00 
+  while (n) {
+  80447b:	e9 98 00 00 00       	jmp    804518 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804480:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804484:	8b 40 0c             	mov    0xc(%rax),%eax
+  804487:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80448e:	00 00 00 
+  804491:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804493:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80449a:	00 00 00 
+  80449d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044a1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8044a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8044aa:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044af:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  8044b6:	00 00 00 
+  8044b9:	ff d0                	call   *%rax
+  8044bb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8044be:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8044c2:	7f 13                	jg     8044d7 <devfile_read+0x90>
+      return res ? res : res0;
+  8044c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8044c8:	74 07                	je     8044d1 <devfile_read+0x8a>
+  8044ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044cd:	48 98                	cltq
+  8044cf:	eb 56                	jmp    804527 <devfile_read+0xe0>
+  8044d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044d5:	eb 50                	jmp    804527 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8044d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044da:	48 63 d0             	movslq %eax,%rdx
+  8044dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044e1:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8044e8:	00 00 00 
+  8044eb:	48 89 ce             	mov    %rcx,%rsi
+  8044ee:	48 89 c7             	mov    %rax,%rdi
+  8044f1:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  8044f8:	00 00 00 
+  8044fb:	ff d0                	call   *%rax
+
+    buf += res;
+  8044fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804500:	48 98                	cltq
+  804502:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804506:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804509:	48 98                	cltq
+  80450b:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  80450f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804512:	48 98                	cltq
+  804514:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804518:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80451d:	0f 85 5d ff ff ff    	jne    804480 <devfile_read+0x39>
+  }
+
+  return res0;
+  804523:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804527:	c9                   	leave
+  804528:	c3                   	ret
+
+0000000000804529 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804529:	55                   	push   %rbp
+  80452a:	48 89 e5             	mov    %rsp,%rbp
+  80452d:	48 83 ec 50          	sub    $0x50,%rsp
+  804531:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804535:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804539:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80453d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804542:	74 07                	je     80454b <devfile_write+0x22>
+  804544:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804549:	75 0a                	jne    804555 <devfile_write+0x2c>
+  return E_INVAL;
+  80454b:	b8 03 00 00 00       	mov    $0x3,%eax
+  804550:	e9 c9 00 00 00       	jmp    80461e <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804555:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80455c:	00 
+
+  while (n) {
+  80455d:	e9 ad 00 00 00       	jmp    80460f <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804562:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804566:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80456a:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804571:	00 
+  804572:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80457a:	48 39 c2             	cmp    %rax,%rdx
+  80457d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804581:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804585:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804589:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80458d:	48 89 c6             	mov    %rax,%rsi
+  804590:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  804597:	00 00 00 
+  80459a:	48 89 c7             	mov    %rax,%rdi
+  80459d:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  8045a4:	00 00 00 
+  8045a7:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8045a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045ad:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045b0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045b7:	00 00 00 
+  8045ba:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8045bc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045c3:	00 00 00 
+  8045c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ca:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8045ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8045d8:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+  8045e4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8045e7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8045eb:	79 07                	jns    8045f4 <devfile_write+0xcb>
+      return res;
+  8045ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045f0:	48 98                	cltq
+  8045f2:	eb 2a                	jmp    80461e <devfile_write+0xf5>
+
+    buf += res;
+  8045f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045f7:	48 98                	cltq
+  8045f9:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8045fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804600:	48 98                	cltq
+  804602:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804606:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804609:	48 98                	cltq
+  80460b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80460f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804614:	0f 85 48 ff ff ff    	jne    804562 <devfile_write+0x39>
+  }
+
+  return res0;
+  80461a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80461e:	c9                   	leave
+  80461f:	c3                   	ret
+
+0000000000804620 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804620:	55                   	push   %rbp
+  804621:	48 89 e5             	mov    %rsp,%rbp
+  804624:	48 83 ec 20          	sub    $0x20,%rsp
+  804628:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80462c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804630:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804634:	8b 40 0c             	mov    0xc(%rax),%eax
+  804637:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80463e:	00 00 00 
+  804641:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804643:	be 00 00 00 00       	mov    $0x0,%esi
+  804648:	bf 05 00 00 00       	mov    $0x5,%edi
+  80464d:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  804654:	00 00 00 
+  804657:	ff d0                	call   *%rax
+  804659:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80465c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804660:	79 05                	jns    804667 <devfile_stat+0x47>
+    return r;
+  804662:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804665:	eb 59                	jmp    8046c0 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804667:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80466b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804672:	00 00 00 
+  804675:	48 89 d6             	mov    %rdx,%rsi
+  804678:	48 89 c7             	mov    %rax,%rdi
+  80467b:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804687:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80468e:	00 00 00 
+  804691:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804697:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80469b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8046a1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8046a8:	00 00 00 
+  8046ab:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8046b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046b5:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8046bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046c0:	c9                   	leave
+  8046c1:	c3                   	ret
+
+00000000008046c2 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8046c2:	55                   	push   %rbp
+  8046c3:	48 89 e5             	mov    %rsp,%rbp
+  8046c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8046ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046ce:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8046d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046d5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8046d8:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046df:	00 00 00 
+  8046e2:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8046e4:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046eb:	00 00 00 
+  8046ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046f1:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8046f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8046f9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8046fe:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  804705:	00 00 00 
+  804708:	ff d0                	call   *%rax
+}
+  80470a:	c9                   	leave
+  80470b:	c3                   	ret
+
+000000000080470c <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80470c:	55                   	push   %rbp
+  80470d:	48 89 e5             	mov    %rsp,%rbp
+  804710:	48 83 ec 18          	sub    $0x18,%rsp
+  804714:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804718:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80471b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  80471f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804722:	83 e0 03             	and    $0x3,%eax
+}
+  804725:	c9                   	leave
+  804726:	c3                   	ret
+
+0000000000804727 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804727:	55                   	push   %rbp
+  804728:	48 89 e5             	mov    %rsp,%rbp
+  80472b:	48 83 ec 10          	sub    $0x10,%rsp
+  80472f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804737:	48 89 c7             	mov    %rax,%rdi
+  80473a:	48 b8 a9 15 80 00 00 	movabs $0x8015a9,%rax
+  804741:	00 00 00 
+  804744:	ff d0                	call   *%rax
+  804746:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80474b:	7e 07                	jle    804754 <remove+0x2d>
+    return -E_BAD_PATH;
+  80474d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804752:	eb 36                	jmp    80478a <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804754:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804758:	48 89 c6             	mov    %rax,%rsi
+  80475b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804762:	00 00 00 
+  804765:	48 89 c7             	mov    %rax,%rdi
+  804768:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  80476f:	00 00 00 
+  804772:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804774:	be 00 00 00 00       	mov    $0x0,%esi
+  804779:	bf 07 00 00 00       	mov    $0x7,%edi
+  80477e:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  804785:	00 00 00 
+  804788:	ff d0                	call   *%rax
+}
+  80478a:	c9                   	leave
+  80478b:	c3                   	ret
+
+000000000080478c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80478c:	55                   	push   %rbp
+  80478d:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804790:	be 00 00 00 00       	mov    $0x0,%esi
+  804795:	bf 08 00 00 00       	mov    $0x8,%edi
+  80479a:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  8047a1:	00 00 00 
+  8047a4:	ff d0                	call   *%rax
+}
+  8047a6:	5d                   	pop    %rbp
+  8047a7:	c3                   	ret
+
+00000000008047a8 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8047a8:	55                   	push   %rbp
+  8047a9:	48 89 e5             	mov    %rsp,%rbp
+  8047ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8047b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8047b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b9:	bf 09 00 00 00       	mov    $0x9,%edi
+  8047be:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  8047c5:	00 00 00 
+  8047c8:	ff d0                	call   *%rax
+  8047ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047d1:	79 05                	jns    8047d8 <fs_stats+0x30>
+    return r;
+  8047d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047d6:	eb 2a                	jmp    804802 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8047d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047dc:	ba 68 00 00 00       	mov    $0x68,%edx
+  8047e1:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8047e8:	00 00 00 
+  8047eb:	48 89 ce             	mov    %rcx,%rsi
+  8047ee:	48 89 c7             	mov    %rax,%rdi
+  8047f1:	48 b8 ed 1b 80 00 00 	movabs $0x801bed,%rax
+  8047f8:	00 00 00 
+  8047fb:	ff d0                	call   *%rax
+  return 0;
+  8047fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804802:	c9                   	leave
+  804803:	c3                   	ret
+
+0000000000804804 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804804:	55                   	push   %rbp
+  804805:	48 89 e5             	mov    %rsp,%rbp
+  804808:	48 83 ec 10          	sub    $0x10,%rsp
+  80480c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80480f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804816:	00 00 00 
+  804819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80481c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80481e:	be 00 00 00 00       	mov    $0x0,%esi
+  804823:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804828:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  80482f:	00 00 00 
+  804832:	ff d0                	call   *%rax
+}
+  804834:	c9                   	leave
+  804835:	c3                   	ret
+
+0000000000804836 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804836:	55                   	push   %rbp
+  804837:	48 89 e5             	mov    %rsp,%rbp
+  80483a:	48 83 ec 10          	sub    $0x10,%rsp
+  80483e:	89 f8                	mov    %edi,%eax
+  804840:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804843:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804847:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80484e:	00 00 00 
+  804851:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804853:	be 00 00 00 00       	mov    $0x0,%esi
+  804858:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80485d:	48 b8 ac 42 80 00 00 	movabs $0x8042ac,%rax
+  804864:	00 00 00 
+  804867:	ff d0                	call   *%rax
+}
+  804869:	c9                   	leave
+  80486a:	c3                   	ret
+
+000000000080486b <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80486b:	55                   	push   %rbp
+  80486c:	48 89 e5             	mov    %rsp,%rbp
+  80486f:	48 83 ec 10          	sub    $0x10,%rsp
+  804873:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804877:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80487b:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804880:	48 89 c7             	mov    %rax,%rdi
+  804883:	48 b8 91 48 80 00 00 	movabs $0x804891,%rax
+  80488a:	00 00 00 
+  80488d:	ff d0                	call   *%rax
+}
+  80488f:	c9                   	leave
+  804890:	c3                   	ret
+
+0000000000804891 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804891:	55                   	push   %rbp
+  804892:	48 89 e5             	mov    %rsp,%rbp
+  804895:	48 83 ec 50          	sub    $0x50,%rsp
+  804899:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80489d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8048a1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8048a8:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8048a9:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8048ae:	74 0a                	je     8048ba <pipe_size+0x29>
+  8048b0:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8048b7:	00 
+  8048b8:	76 0a                	jbe    8048c4 <pipe_size+0x33>
+    return -E_INVAL;
+  8048ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8048bf:	e9 cc 02 00 00       	jmp    804b90 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8048c4:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8048c8:	48 89 c7             	mov    %rax,%rdi
+  8048cb:	48 b8 8d 33 80 00 00 	movabs $0x80338d,%rax
+  8048d2:	00 00 00 
+  8048d5:	ff d0                	call   *%rax
+  8048d7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048da:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048de:	0f 88 a8 02 00 00    	js     804b8c <pipe_size+0x2fb>
+  8048e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048e8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048ed:	48 89 c6             	mov    %rax,%rsi
+  8048f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f5:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  8048fc:	00 00 00 
+  8048ff:	ff d0                	call   *%rax
+  804901:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804904:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804908:	0f 88 7e 02 00 00    	js     804b8c <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80490e:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804912:	48 89 c7             	mov    %rax,%rdi
+  804915:	48 b8 8d 33 80 00 00 	movabs $0x80338d,%rax
+  80491c:	00 00 00 
+  80491f:	ff d0                	call   *%rax
+  804921:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804924:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804928:	0f 88 43 02 00 00    	js     804b71 <pipe_size+0x2e0>
+  80492e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804932:	ba 07 04 00 00       	mov    $0x407,%edx
+  804937:	48 89 c6             	mov    %rax,%rsi
+  80493a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80493f:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  804946:	00 00 00 
+  804949:	ff d0                	call   *%rax
+  80494b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80494e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804952:	0f 88 19 02 00 00    	js     804b71 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804958:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80495c:	48 89 c7             	mov    %rax,%rdi
+  80495f:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804966:	00 00 00 
+  804969:	ff d0                	call   *%rax
+  80496b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80496f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804976:	00 
+  804977:	e9 a2 00 00 00       	jmp    804a1e <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80497c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804980:	48 c1 e0 0c          	shl    $0xc,%rax
+  804984:	48 89 c2             	mov    %rax,%rdx
+  804987:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80498b:	48 01 d0             	add    %rdx,%rax
+  80498e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804993:	48 89 c6             	mov    %rax,%rsi
+  804996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499b:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  8049a2:	00 00 00 
+  8049a5:	ff d0                	call   *%rax
+  8049a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049ae:	0f 88 37 01 00 00    	js     804aeb <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8049b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049b8:	48 89 c7             	mov    %rax,%rdi
+  8049bb:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8049c2:	00 00 00 
+  8049c5:	ff d0                	call   *%rax
+  8049c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049cb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8049cf:	48 01 c2             	add    %rax,%rdx
+  8049d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049d6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8049da:	48 89 c1             	mov    %rax,%rcx
+  8049dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049e1:	48 01 c8             	add    %rcx,%rax
+  8049e4:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8049ea:	48 89 d1             	mov    %rdx,%rcx
+  8049ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f2:	48 89 c6             	mov    %rax,%rsi
+  8049f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049fa:	48 b8 d0 24 80 00 00 	movabs $0x8024d0,%rax
+  804a01:	00 00 00 
+  804a04:	ff d0                	call   *%rax
+  804a06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a09:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a0d:	79 0a                	jns    804a19 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804a0f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804a14:	e9 d3 00 00 00       	jmp    804aec <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804a19:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804a1e:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804a25:	00 
+  804a26:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804a2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a2e:	48 01 d0             	add    %rdx,%rax
+  804a31:	48 83 c0 1f          	add    $0x1f,%rax
+  804a35:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804a39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a42:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804a46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a4a:	48 29 d0             	sub    %rdx,%rax
+  804a4d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a51:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804a55:	0f 82 21 ff ff ff    	jb     80497c <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a5f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804a63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a67:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804a6b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804a6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a73:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a7a:	00 00 00 
+  804a7d:	8b 12                	mov    (%rdx),%edx
+  804a7f:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804a81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a85:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804a8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a90:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a97:	00 00 00 
+  804a9a:	8b 12                	mov    (%rdx),%edx
+  804a9c:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804a9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aa2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804aa9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aad:	48 89 c7             	mov    %rax,%rdi
+  804ab0:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  804ab7:	00 00 00 
+  804aba:	ff d0                	call   *%rax
+  804abc:	89 c2                	mov    %eax,%edx
+  804abe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804ac2:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804ac4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ac8:	48 89 c7             	mov    %rax,%rdi
+  804acb:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  804ad2:	00 00 00 
+  804ad5:	ff d0                	call   *%rax
+  804ad7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804adb:	48 83 c2 04          	add    $0x4,%rdx
+  804adf:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae6:	e9 a5 00 00 00       	jmp    804b90 <pipe_size+0x2ff>
+      goto err2;
+  804aeb:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804aec:	eb 58                	jmp    804b46 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804aee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804af2:	48 c1 e0 0c          	shl    $0xc,%rax
+  804af6:	48 89 c2             	mov    %rax,%rdx
+  804af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804afd:	48 01 d0             	add    %rdx,%rax
+  804b00:	48 89 c6             	mov    %rax,%rsi
+  804b03:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b08:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804b0f:	00 00 00 
+  804b12:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804b14:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b18:	48 89 c7             	mov    %rax,%rdi
+  804b1b:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804b22:	00 00 00 
+  804b25:	ff d0                	call   *%rax
+  804b27:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b2b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804b2f:	48 01 d0             	add    %rdx,%rax
+  804b32:	48 89 c6             	mov    %rax,%rsi
+  804b35:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b3a:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804b41:	00 00 00 
+  804b44:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804b46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b4a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804b4e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804b52:	48 85 c0             	test   %rax,%rax
+  804b55:	75 97                	jne    804aee <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804b57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b5b:	48 89 c6             	mov    %rax,%rsi
+  804b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b63:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804b6a:	00 00 00 
+  804b6d:	ff d0                	call   *%rax
+  804b6f:	eb 01                	jmp    804b72 <pipe_size+0x2e1>
+    goto err1;
+  804b71:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804b72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b76:	48 89 c6             	mov    %rax,%rsi
+  804b79:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b7e:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  804b85:	00 00 00 
+  804b88:	ff d0                	call   *%rax
+  804b8a:	eb 01                	jmp    804b8d <pipe_size+0x2fc>
+    goto err;
+  804b8c:	90                   	nop
+err:
+  return r;
+  804b8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b90:	c9                   	leave
+  804b91:	c3                   	ret
+
+0000000000804b92 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804b92:	55                   	push   %rbp
+  804b93:	48 89 e5             	mov    %rsp,%rbp
+  804b96:	53                   	push   %rbx
+  804b97:	48 83 ec 28          	sub    $0x28,%rsp
+  804b9b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b9f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804ba3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804baa:	00 00 00 
+  804bad:	8b 40 04             	mov    0x4(%rax),%eax
+  804bb0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bb5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bbc:	00 00 00 
+  804bbf:	48 98                	cltq
+  804bc1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bc8:	48 01 d0             	add    %rdx,%rax
+  804bcb:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bd1:	8b 00                	mov    (%rax),%eax
+  804bd3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bda:	48 89 c7             	mov    %rax,%rdi
+  804bdd:	48 b8 28 60 80 00 00 	movabs $0x806028,%rax
+  804be4:	00 00 00 
+  804be7:	ff d0                	call   *%rax
+  804be9:	89 c3                	mov    %eax,%ebx
+  804beb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bef:	48 89 c7             	mov    %rax,%rdi
+  804bf2:	48 b8 28 60 80 00 00 	movabs $0x806028,%rax
+  804bf9:	00 00 00 
+  804bfc:	ff d0                	call   *%rax
+  804bfe:	39 c3                	cmp    %eax,%ebx
+  804c00:	0f 94 c0             	sete   %al
+  804c03:	0f b6 c0             	movzbl %al,%eax
+  804c06:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804c09:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c10:	00 00 00 
+  804c13:	8b 40 04             	mov    0x4(%rax),%eax
+  804c16:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c1b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804c22:	00 00 00 
+  804c25:	48 98                	cltq
+  804c27:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c2e:	48 01 d0             	add    %rdx,%rax
+  804c31:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c37:	8b 00                	mov    (%rax),%eax
+  804c39:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804c3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c3f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c42:	75 05                	jne    804c49 <_pipeisclosed+0xb7>
+      return ret;
+  804c44:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c47:	eb 68                	jmp    804cb1 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804c49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c4c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c4f:	0f 84 4e ff ff ff    	je     804ba3 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804c55:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c5c:	00 00 00 
+  804c5f:	8b 40 04             	mov    0x4(%rax),%eax
+  804c62:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c67:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804c6e:	00 00 00 
+  804c71:	48 98                	cltq
+  804c73:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c7a:	48 01 d0             	add    %rdx,%rax
+  804c7d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c83:	8b 10                	mov    (%rax),%edx
+  804c85:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804c88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c8b:	89 c6                	mov    %eax,%esi
+  804c8d:	48 b8 30 6f 80 00 00 	movabs $0x806f30,%rax
+  804c94:	00 00 00 
+  804c97:	48 89 c7             	mov    %rax,%rdi
+  804c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c9f:	49 b8 fa 06 80 00 00 	movabs $0x8006fa,%r8
+  804ca6:	00 00 00 
+  804ca9:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804cac:	e9 f2 fe ff ff       	jmp    804ba3 <_pipeisclosed+0x11>
+  }
+}
+  804cb1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804cb5:	c9                   	leave
+  804cb6:	c3                   	ret
+
+0000000000804cb7 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804cb7:	55                   	push   %rbp
+  804cb8:	48 89 e5             	mov    %rsp,%rbp
+  804cbb:	48 83 ec 30          	sub    $0x30,%rsp
+  804cbf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804cc2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804cc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cc9:	48 89 d6             	mov    %rdx,%rsi
+  804ccc:	89 c7                	mov    %eax,%edi
+  804cce:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  804cd5:	00 00 00 
+  804cd8:	ff d0                	call   *%rax
+  804cda:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cdd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ce1:	79 05                	jns    804ce8 <pipeisclosed+0x31>
+    return r;
+  804ce3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ce6:	eb 31                	jmp    804d19 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cec:	48 89 c7             	mov    %rax,%rdi
+  804cef:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804cf6:	00 00 00 
+  804cf9:	ff d0                	call   *%rax
+  804cfb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804cff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d03:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d07:	48 89 d6             	mov    %rdx,%rsi
+  804d0a:	48 89 c7             	mov    %rax,%rdi
+  804d0d:	48 b8 92 4b 80 00 00 	movabs $0x804b92,%rax
+  804d14:	00 00 00 
+  804d17:	ff d0                	call   *%rax
+}
+  804d19:	c9                   	leave
+  804d1a:	c3                   	ret
+
+0000000000804d1b <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804d1b:	55                   	push   %rbp
+  804d1c:	48 89 e5             	mov    %rsp,%rbp
+  804d1f:	48 83 ec 10          	sub    $0x10,%rsp
+  804d23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d2b:	8b 40 18             	mov    0x18(%rax),%eax
+  804d2e:	8d 50 01             	lea    0x1(%rax),%edx
+  804d31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d35:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d3c:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804d3f:	85 c0                	test   %eax,%eax
+  804d41:	74 27                	je     804d6a <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804d43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d47:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804d4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d52:	48 83 c0 18          	add    $0x18,%rax
+  804d56:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804d5b:	48 89 c7             	mov    %rax,%rdi
+  804d5e:	48 b8 73 28 80 00 00 	movabs $0x802873,%rax
+  804d65:	00 00 00 
+  804d68:	ff d0                	call   *%rax
+  }
+}
+  804d6a:	90                   	nop
+  804d6b:	c9                   	leave
+  804d6c:	c3                   	ret
+
+0000000000804d6d <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804d6d:	55                   	push   %rbp
+  804d6e:	48 89 e5             	mov    %rsp,%rbp
+  804d71:	48 83 ec 10          	sub    $0x10,%rsp
+  804d75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d79:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d80:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d8b:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804d8f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804d92:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804d99:	89 c6                	mov    %eax,%esi
+  804d9b:	48 89 cf             	mov    %rcx,%rdi
+  804d9e:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  804da5:	00 00 00 
+  804da8:	ff d0                	call   *%rax
+}
+  804daa:	90                   	nop
+  804dab:	c9                   	leave
+  804dac:	c3                   	ret
+
+0000000000804dad <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804dad:	55                   	push   %rbp
+  804dae:	48 89 e5             	mov    %rsp,%rbp
+  804db1:	48 83 ec 70          	sub    $0x70,%rsp
+  804db5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804db9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804dbd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804dc1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804dc5:	48 89 c7             	mov    %rax,%rdi
+  804dc8:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804dcf:	00 00 00 
+  804dd2:	ff d0                	call   *%rax
+  804dd4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804dd8:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804ddd:	75 0a                	jne    804de9 <devpipe_read+0x3c>
+    return 0;
+  804ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de4:	e9 63 01 00 00       	jmp    804f4c <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804de9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ded:	8b 40 18             	mov    0x18(%rax),%eax
+  804df0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804df3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df7:	48 8b 10             	mov    (%rax),%rdx
+  804dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dfe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e02:	48 39 c2             	cmp    %rax,%rdx
+  804e05:	75 42                	jne    804e49 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804e07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e0b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e0f:	48 89 d6             	mov    %rdx,%rsi
+  804e12:	48 89 c7             	mov    %rax,%rdi
+  804e15:	48 b8 92 4b 80 00 00 	movabs $0x804b92,%rax
+  804e1c:	00 00 00 
+  804e1f:	ff d0                	call   *%rax
+  804e21:	85 c0                	test   %eax,%eax
+  804e23:	74 0a                	je     804e2f <devpipe_read+0x82>
+      return 0;
+  804e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e2a:	e9 1d 01 00 00       	jmp    804f4c <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804e2f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e36:	89 d6                	mov    %edx,%esi
+  804e38:	48 89 c7             	mov    %rax,%rdi
+  804e3b:	48 b8 6d 4d 80 00 00 	movabs $0x804d6d,%rax
+  804e42:	00 00 00 
+  804e45:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804e47:	eb a0                	jmp    804de9 <devpipe_read+0x3c>
+      break;
+  804e49:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804e4a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e4e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804e52:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e56:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e66:	48 8b 00             	mov    (%rax),%rax
+  804e69:	48 29 c2             	sub    %rax,%rdx
+  804e6c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804e70:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e78:	48 39 c2             	cmp    %rax,%rdx
+  804e7b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e7f:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804e83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e87:	48 8b 00             	mov    (%rax),%rax
+  804e8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e8e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804e92:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e97:	48 f7 f1             	div    %rcx
+  804e9a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804e9e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ea2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eaa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804eae:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804eb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804eb6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804eba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ebe:	48 39 c2             	cmp    %rax,%rdx
+  804ec1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ec5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ecd:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804ed1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ed5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804ed9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804edd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee1:	48 89 ce             	mov    %rcx,%rsi
+  804ee4:	48 89 c7             	mov    %rax,%rdi
+  804ee7:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  804eee:	00 00 00 
+  804ef1:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804ef3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ef7:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804efb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804eff:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804f03:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804f07:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f0b:	48 01 d1             	add    %rdx,%rcx
+  804f0e:	48 89 c2             	mov    %rax,%rdx
+  804f11:	48 89 cf             	mov    %rcx,%rdi
+  804f14:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  804f1b:	00 00 00 
+  804f1e:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f24:	48 8b 10             	mov    (%rax),%rdx
+  804f27:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f2b:	48 01 c2             	add    %rax,%rdx
+  804f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f32:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804f35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f39:	48 89 c7             	mov    %rax,%rdi
+  804f3c:	48 b8 1b 4d 80 00 00 	movabs $0x804d1b,%rax
+  804f43:	00 00 00 
+  804f46:	ff d0                	call   *%rax
+  return n;
+  804f48:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804f4c:	c9                   	leave
+  804f4d:	c3                   	ret
+
+0000000000804f4e <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804f4e:	55                   	push   %rbp
+  804f4f:	48 89 e5             	mov    %rsp,%rbp
+  804f52:	48 83 ec 70          	sub    $0x70,%rsp
+  804f56:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f5a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f5e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804f62:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f66:	48 89 c7             	mov    %rax,%rdi
+  804f69:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804f70:	00 00 00 
+  804f73:	ff d0                	call   *%rax
+  804f75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804f79:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f7d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804f81:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804f88:	00 
+  804f89:	e9 b8 01 00 00       	jmp    805146 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804f8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f92:	8b 40 18             	mov    0x18(%rax),%eax
+  804f95:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804f98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f9c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804fa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa4:	48 8b 00             	mov    (%rax),%rax
+  804fa7:	48 29 c2             	sub    %rax,%rdx
+  804faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fb2:	48 39 c2             	cmp    %rax,%rdx
+  804fb5:	75 4d                	jne    805004 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804fb7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fbb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fbf:	48 89 d6             	mov    %rdx,%rsi
+  804fc2:	48 89 c7             	mov    %rax,%rdi
+  804fc5:	48 b8 92 4b 80 00 00 	movabs $0x804b92,%rax
+  804fcc:	00 00 00 
+  804fcf:	ff d0                	call   *%rax
+  804fd1:	85 c0                	test   %eax,%eax
+  804fd3:	74 0a                	je     804fdf <devpipe_write+0x91>
+        return 0;
+  804fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fda:	e9 79 01 00 00       	jmp    805158 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804fdf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804fe2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fe6:	89 d6                	mov    %edx,%esi
+  804fe8:	48 89 c7             	mov    %rax,%rdi
+  804feb:	48 b8 6d 4d 80 00 00 	movabs $0x804d6d,%rax
+  804ff2:	00 00 00 
+  804ff5:	ff d0                	call   *%rax
+      m = 0;
+  804ff7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ffe:	00 
+      continue;
+  804fff:	e9 3a 01 00 00       	jmp    80513e <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  805004:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805008:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80500c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805014:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501c:	48 8b 08             	mov    (%rax),%rcx
+  80501f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805023:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805027:	48 29 c1             	sub    %rax,%rcx
+  80502a:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80502e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805032:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805036:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80503a:	48 39 c2             	cmp    %rax,%rdx
+  80503d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805041:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  805045:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805049:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80504d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805051:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80505a:	48 f7 f1             	div    %rcx
+  80505d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805061:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805065:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805069:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80506d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805071:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805075:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805079:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80507d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805081:	48 39 c2             	cmp    %rax,%rdx
+  805084:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805088:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80508c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805090:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805094:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805098:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80509c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8050a0:	48 01 d1             	add    %rdx,%rcx
+  8050a3:	48 89 c2             	mov    %rax,%rdx
+  8050a6:	48 89 cf             	mov    %rcx,%rdi
+  8050a9:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  8050b0:	00 00 00 
+  8050b3:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8050b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050b9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050bd:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8050c1:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8050c5:	73 4d                	jae    805114 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8050c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050cb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8050d3:	48 29 c2             	sub    %rax,%rdx
+  8050d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050da:	48 01 c2             	add    %rax,%rdx
+  8050dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050e1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050e5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8050e9:	48 89 c1             	mov    %rax,%rcx
+  8050ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050f0:	48 01 c1             	add    %rax,%rcx
+  8050f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f7:	48 01 c1             	add    %rax,%rcx
+  8050fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050fe:	48 83 c0 20          	add    $0x20,%rax
+  805102:	48 89 ce             	mov    %rcx,%rsi
+  805105:	48 89 c7             	mov    %rax,%rdi
+  805108:	48 b8 f3 1d 80 00 00 	movabs $0x801df3,%rax
+  80510f:	00 00 00 
+  805112:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805114:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805118:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80511c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805120:	48 01 c2             	add    %rax,%rdx
+  805123:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805127:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80512b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80512f:	48 89 c7             	mov    %rax,%rdi
+  805132:	48 b8 1b 4d 80 00 00 	movabs $0x804d1b,%rax
+  805139:	00 00 00 
+  80513c:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80513e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805142:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805146:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80514a:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80514e:	0f 82 3a fe ff ff    	jb     804f8e <devpipe_write+0x40>
+  }
+
+  return i;
+  805154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805158:	c9                   	leave
+  805159:	c3                   	ret
+
+000000000080515a <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80515a:	55                   	push   %rbp
+  80515b:	48 89 e5             	mov    %rsp,%rbp
+  80515e:	48 83 ec 40          	sub    $0x40,%rsp
+  805162:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805166:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805169:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80516d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805171:	48 89 c7             	mov    %rax,%rdi
+  805174:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  80517b:	00 00 00 
+  80517e:	ff d0                	call   *%rax
+  805180:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805184:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80518b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80518f:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805193:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805197:	48 89 d6             	mov    %rdx,%rsi
+  80519a:	48 89 c7             	mov    %rax,%rdi
+  80519d:	48 b8 35 3e 80 00 00 	movabs $0x803e35,%rax
+  8051a4:	00 00 00 
+  8051a7:	ff d0                	call   *%rax
+  8051a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051b0:	79 08                	jns    8051ba <devpipe_poll+0x60>
+    return r;
+  8051b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051b5:	e9 85 00 00 00       	jmp    80523f <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8051ba:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8051bd:	83 e0 01             	and    $0x1,%eax
+  8051c0:	85 c0                	test   %eax,%eax
+  8051c2:	74 18                	je     8051dc <devpipe_poll+0x82>
+  8051c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c8:	48 8b 10             	mov    (%rax),%rdx
+  8051cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051d3:	48 39 c2             	cmp    %rax,%rdx
+  8051d6:	74 04                	je     8051dc <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8051d8:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8051dc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8051df:	83 e0 02             	and    $0x2,%eax
+  8051e2:	85 c0                	test   %eax,%eax
+  8051e4:	74 23                	je     805209 <devpipe_poll+0xaf>
+  8051e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051ea:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8051ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f2:	48 8b 00             	mov    (%rax),%rax
+  8051f5:	48 29 c2             	sub    %rax,%rdx
+  8051f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805200:	48 39 c2             	cmp    %rax,%rdx
+  805203:	73 04                	jae    805209 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805205:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805209:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80520d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805211:	48 89 d6             	mov    %rdx,%rsi
+  805214:	48 89 c7             	mov    %rax,%rdi
+  805217:	48 b8 92 4b 80 00 00 	movabs $0x804b92,%rax
+  80521e:	00 00 00 
+  805221:	ff d0                	call   *%rax
+  805223:	85 c0                	test   %eax,%eax
+  805225:	74 04                	je     80522b <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805227:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80522b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80522f:	75 0b                	jne    80523c <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805231:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805235:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80523c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80523f:	c9                   	leave
+  805240:	c3                   	ret
+
+0000000000805241 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805241:	55                   	push   %rbp
+  805242:	48 89 e5             	mov    %rsp,%rbp
+  805245:	48 83 ec 20          	sub    $0x20,%rsp
+  805249:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80524d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805255:	48 89 c7             	mov    %rax,%rdi
+  805258:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  80525f:	00 00 00 
+  805262:	ff d0                	call   *%rax
+  805264:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805268:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80526c:	48 ba 61 6f 80 00 00 	movabs $0x806f61,%rdx
+  805273:	00 00 00 
+  805276:	48 89 d6             	mov    %rdx,%rsi
+  805279:	48 89 c7             	mov    %rax,%rdi
+  80527c:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  805283:	00 00 00 
+  805286:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80528c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805290:	89 c1                	mov    %eax,%ecx
+  805292:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805296:	48 8b 00             	mov    (%rax),%rax
+  805299:	89 c2                	mov    %eax,%edx
+  80529b:	89 c8                	mov    %ecx,%eax
+  80529d:	29 d0                	sub    %edx,%eax
+  80529f:	89 c2                	mov    %eax,%edx
+  8052a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052a5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8052ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052af:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8052b6:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8052b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052bd:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8052c4:	00 00 00 
+  8052c7:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8052ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052d3:	c9                   	leave
+  8052d4:	c3                   	ret
+
+00000000008052d5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8052d5:	55                   	push   %rbp
+  8052d6:	48 89 e5             	mov    %rsp,%rbp
+  8052d9:	48 83 ec 40          	sub    $0x40,%rsp
+  8052dd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8052e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052e5:	48 89 c7             	mov    %rax,%rdi
+  8052e8:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8052ef:	00 00 00 
+  8052f2:	ff d0                	call   *%rax
+  8052f4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8052f8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8052ff:	00 
+  805300:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805304:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80530c:	48 01 d0             	add    %rdx,%rax
+  80530f:	48 83 c0 1f          	add    $0x1f,%rax
+  805313:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805317:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80531b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805320:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805324:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805328:	48 29 d0             	sub    %rdx,%rax
+  80532b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80532f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805333:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805337:	48 89 c6             	mov    %rax,%rsi
+  80533a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80533f:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  805346:	00 00 00 
+  805349:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80534b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80534f:	48 89 c7             	mov    %rax,%rdi
+  805352:	48 b8 1b 4d 80 00 00 	movabs $0x804d1b,%rax
+  805359:	00 00 00 
+  80535c:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80535e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805362:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805366:	eb 2f                	jmp    805397 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80536c:	48 83 e8 01          	sub    $0x1,%rax
+  805370:	48 c1 e0 0c          	shl    $0xc,%rax
+  805374:	48 89 c2             	mov    %rax,%rdx
+  805377:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80537b:	48 01 d0             	add    %rdx,%rax
+  80537e:	48 89 c6             	mov    %rax,%rsi
+  805381:	bf 00 00 00 00       	mov    $0x0,%edi
+  805386:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  80538d:	00 00 00 
+  805390:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805392:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805397:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80539c:	77 ca                	ja     805368 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80539e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053a2:	48 89 c6             	mov    %rax,%rsi
+  8053a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053aa:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  8053b1:	00 00 00 
+  8053b4:	ff d0                	call   *%rax
+}
+  8053b6:	c9                   	leave
+  8053b7:	c3                   	ret
+
+00000000008053b8 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8053b8:	55                   	push   %rbp
+  8053b9:	48 89 e5             	mov    %rsp,%rbp
+  8053bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8053c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8053c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8053c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053d0:	48 89 c7             	mov    %rax,%rdi
+  8053d3:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8053d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053da:	48 b8 1c 56 80 00 00 	movabs $0x80561c,%rax
+  8053e1:	00 00 00 
+  8053e4:	ff d0                	call   *%rax
+}
+  8053e6:	90                   	nop
+  8053e7:	c9                   	leave
+  8053e8:	c3                   	ret
+
+00000000008053e9 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8053e9:	55                   	push   %rbp
+  8053ea:	48 89 e5             	mov    %rsp,%rbp
+  8053ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8053f1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8053f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053f7:	c1 e0 10             	shl    $0x10,%eax
+  8053fa:	48 98                	cltq
+  8053fc:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805401:	48 01 d0             	add    %rdx,%rax
+  805404:	48 89 c6             	mov    %rax,%rsi
+  805407:	bf 00 00 00 00       	mov    $0x0,%edi
+  80540c:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  805413:	00 00 00 
+  805416:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805418:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80541b:	83 c0 01             	add    $0x1,%eax
+  80541e:	c1 e0 10             	shl    $0x10,%eax
+  805421:	48 98                	cltq
+  805423:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805428:	48 01 d0             	add    %rdx,%rax
+  80542b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80542f:	eb 20                	jmp    805451 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805435:	48 89 c6             	mov    %rax,%rsi
+  805438:	bf 00 00 00 00       	mov    $0x0,%edi
+  80543d:	48 b8 30 25 80 00 00 	movabs $0x802530,%rax
+  805444:	00 00 00 
+  805447:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805449:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805450:	00 
+  805451:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805454:	83 c0 01             	add    $0x1,%eax
+  805457:	c1 e0 10             	shl    $0x10,%eax
+  80545a:	48 98                	cltq
+  80545c:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805461:	48 01 d0             	add    %rdx,%rax
+  805464:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805468:	72 c7                	jb     805431 <slot_unmap+0x48>
+}
+  80546a:	90                   	nop
+  80546b:	90                   	nop
+  80546c:	c9                   	leave
+  80546d:	c3                   	ret
+
+000000000080546e <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  80546e:	55                   	push   %rbp
+  80546f:	48 89 e5             	mov    %rsp,%rbp
+  805472:	48 83 ec 30          	sub    $0x30,%rsp
+  805476:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80547a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80547e:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805485:	00 00 00 
+  805488:	48 89 c7             	mov    %rax,%rdi
+  80548b:	48 b8 4b 62 80 00 00 	movabs $0x80624b,%rax
+  805492:	00 00 00 
+  805495:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805497:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80549e:	eb 04                	jmp    8054a4 <thread_create+0x36>
+  8054a0:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8054a4:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8054a8:	7f 16                	jg     8054c0 <thread_create+0x52>
+  8054aa:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8054b1:	00 00 00 
+  8054b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054b7:	48 98                	cltq
+  8054b9:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8054bc:	85 c0                	test   %eax,%eax
+  8054be:	75 e0                	jne    8054a0 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8054c0:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8054c4:	75 0c                	jne    8054d2 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8054c6:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8054cd:	e9 2c 01 00 00       	jmp    8055fe <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8054d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054d5:	c1 e0 10             	shl    $0x10,%eax
+  8054d8:	48 98                	cltq
+  8054da:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8054df:	48 01 d0             	add    %rdx,%rax
+  8054e2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8054e7:	48 89 c6             	mov    %rax,%rsi
+  8054ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054ef:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  8054f6:	00 00 00 
+  8054f9:	ff d0                	call   *%rax
+  8054fb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8054fe:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805502:	0f 88 f5 00 00 00    	js     8055fd <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805508:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80550b:	83 c0 01             	add    $0x1,%eax
+  80550e:	c1 e0 10             	shl    $0x10,%eax
+  805511:	48 98                	cltq
+  805513:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805518:	48 01 d0             	add    %rdx,%rax
+  80551b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80551f:	eb 32                	jmp    805553 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805521:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805525:	ba 07 00 00 00       	mov    $0x7,%edx
+  80552a:	48 89 c6             	mov    %rax,%rsi
+  80552d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805532:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  805539:	00 00 00 
+  80553c:	ff d0                	call   *%rax
+  80553e:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805541:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805545:	0f 88 9e 00 00 00    	js     8055e9 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80554b:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805552:	00 
+  805553:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805556:	83 c0 01             	add    $0x1,%eax
+  805559:	c1 e0 10             	shl    $0x10,%eax
+  80555c:	48 98                	cltq
+  80555e:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805563:	48 01 d0             	add    %rdx,%rax
+  805566:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80556a:	72 b5                	jb     805521 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  80556c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805570:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805574:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805577:	c1 e2 10             	shl    $0x10,%edx
+  80557a:	48 63 d2             	movslq %edx,%rdx
+  80557d:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805582:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805585:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805588:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80558b:	83 c2 01             	add    $0x1,%edx
+  80558e:	c1 e2 10             	shl    $0x10,%edx
+  805591:	48 63 d2             	movslq %edx,%rdx
+  805594:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805599:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  80559c:	48 bf b8 53 80 00 00 	movabs $0x8053b8,%rdi
+  8055a3:	00 00 00 
+  8055a6:	49 89 c8             	mov    %rcx,%r8
+  8055a9:	48 89 c1             	mov    %rax,%rcx
+  8055ac:	4c 89 ca             	mov    %r9,%rdx
+  8055af:	48 b8 18 29 80 00 00 	movabs $0x802918,%rax
+  8055b6:	00 00 00 
+  8055b9:	ff d0                	call   *%rax
+  8055bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8055be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055c2:	79 08                	jns    8055cc <thread_create+0x15e>
+    r = id;
+  8055c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055c7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8055ca:	eb 1e                	jmp    8055ea <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8055cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055cf:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8055d2:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8055d9:	00 00 00 
+  8055dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055df:	48 98                	cltq
+  8055e1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8055e4:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8055e7:	eb 15                	jmp    8055fe <thread_create+0x190>
+      goto fail;
+  8055e9:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8055ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055ed:	89 c7                	mov    %eax,%edi
+  8055ef:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  8055f6:	00 00 00 
+  8055f9:	ff d0                	call   *%rax
+  8055fb:	eb 01                	jmp    8055fe <thread_create+0x190>
+    goto out;
+  8055fd:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8055fe:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805605:	00 00 00 
+  805608:	48 89 c7             	mov    %rax,%rdi
+  80560b:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  805612:	00 00 00 
+  805615:	ff d0                	call   *%rax
+  return r;
+  805617:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80561a:	c9                   	leave
+  80561b:	c3                   	ret
+
+000000000080561c <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  80561c:	55                   	push   %rbp
+  80561d:	48 89 e5             	mov    %rsp,%rbp
+  805620:	48 83 ec 10          	sub    $0x10,%rsp
+  805624:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805627:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80562a:	89 c7                	mov    %eax,%edi
+  80562c:	48 b8 75 29 80 00 00 	movabs $0x802975,%rax
+  805633:	00 00 00 
+  805636:	ff d0                	call   *%rax
+}
+  805638:	90                   	nop
+  805639:	c9                   	leave
+  80563a:	c3                   	ret
+
+000000000080563b <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80563b:	55                   	push   %rbp
+  80563c:	48 89 e5             	mov    %rsp,%rbp
+  80563f:	48 83 ec 20          	sub    $0x20,%rsp
+  805643:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805646:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  80564a:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805651:	00 00 00 
+  805654:	48 89 c7             	mov    %rax,%rdi
+  805657:	48 b8 4b 62 80 00 00 	movabs $0x80624b,%rax
+  80565e:	00 00 00 
+  805661:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805663:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80566a:	eb 04                	jmp    805670 <thread_join+0x35>
+  80566c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805670:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805674:	7f 17                	jg     80568d <thread_join+0x52>
+  805676:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80567d:	00 00 00 
+  805680:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805683:	48 98                	cltq
+  805685:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805688:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80568b:	75 df                	jne    80566c <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  80568d:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805694:	00 00 00 
+  805697:	48 89 c7             	mov    %rax,%rdi
+  80569a:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  8056a1:	00 00 00 
+  8056a4:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8056a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056aa:	74 06                	je     8056b2 <thread_join+0x77>
+  8056ac:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8056b0:	75 07                	jne    8056b9 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8056b2:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8056b7:	eb 76                	jmp    80572f <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8056b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056c0:	48 89 d6             	mov    %rdx,%rsi
+  8056c3:	89 c7                	mov    %eax,%edi
+  8056c5:	48 b8 3d 61 80 00 00 	movabs $0x80613d,%rax
+  8056cc:	00 00 00 
+  8056cf:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8056d1:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8056d8:	00 00 00 
+  8056db:	48 89 c7             	mov    %rax,%rdi
+  8056de:	48 b8 4b 62 80 00 00 	movabs $0x80624b,%rax
+  8056e5:	00 00 00 
+  8056e8:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8056ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056ed:	89 c7                	mov    %eax,%edi
+  8056ef:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  8056f6:	00 00 00 
+  8056f9:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8056fb:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805702:	00 00 00 
+  805705:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805708:	48 98                	cltq
+  80570a:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805711:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805718:	00 00 00 
+  80571b:	48 89 c7             	mov    %rax,%rdi
+  80571e:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  805725:	00 00 00 
+  805728:	ff d0                	call   *%rax
+  return 0;
+  80572a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80572f:	c9                   	leave
+  805730:	c3                   	ret
+
+0000000000805731 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805731:	55                   	push   %rbp
+  805732:	48 89 e5             	mov    %rsp,%rbp
+  805735:	48 83 ec 08          	sub    $0x8,%rsp
+  805739:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80573d:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805742:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805746:	73 23                	jae    80576b <thread_is_uxstack+0x3a>
+  805748:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80574d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805751:	72 18                	jb     80576b <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805753:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805757:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80575c:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805762:	75 07                	jne    80576b <thread_is_uxstack+0x3a>
+  805764:	b8 01 00 00 00       	mov    $0x1,%eax
+  805769:	eb 05                	jmp    805770 <thread_is_uxstack+0x3f>
+  80576b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805770:	83 e0 01             	and    $0x1,%eax
+}
+  805773:	c9                   	leave
+  805774:	c3                   	ret
+
+0000000000805775 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805775:	55                   	push   %rbp
+  805776:	48 89 e5             	mov    %rsp,%rbp
+  805779:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  80577d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805784:	00 00 00 
+  805787:	8b 40 04             	mov    0x4(%rax),%eax
+  80578a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80578f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805796:	00 00 00 
+  805799:	48 98                	cltq
+  80579b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057a2:	48 01 d0             	add    %rdx,%rax
+  8057a5:	48 05 08 01 00 00    	add    $0x108,%rax
+  8057ab:	48 8b 00             	mov    (%rax),%rax
+  8057ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8057b2:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8057b7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8057bb:	73 0b                	jae    8057c8 <thread_pftemp+0x53>
+  8057bd:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8057c2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8057c6:	73 07                	jae    8057cf <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8057c8:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8057cd:	eb 26                	jmp    8057f5 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8057cf:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8057d6:	ff ff ff 
+  8057d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057dd:	48 01 d0             	add    %rdx,%rax
+  8057e0:	48 c1 e8 10          	shr    $0x10,%rax
+  8057e4:	48 83 c0 01          	add    $0x1,%rax
+  8057e8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8057ec:	48 f7 d8             	neg    %rax
+  8057ef:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  8057f5:	c9                   	leave
+  8057f6:	c3                   	ret
+
+00000000008057f7 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8057f7:	55                   	push   %rbp
+  8057f8:	48 89 e5             	mov    %rsp,%rbp
+  8057fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8057ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805802:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805806:	75 10                	jne    805818 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805808:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80580f:	00 00 00 
+  805812:	8b 00                	mov    (%rax),%eax
+  805814:	48 98                	cltq
+  805816:	eb 05                	jmp    80581d <vsyscall+0x26>
+  }
+  return 0;
+  805818:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80581d:	c9                   	leave
+  80581e:	c3                   	ret
+
+000000000080581f <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80581f:	55                   	push   %rbp
+  805820:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805823:	bf 00 00 00 00       	mov    $0x0,%edi
+  805828:	48 b8 f7 57 80 00 00 	movabs $0x8057f7,%rax
+  80582f:	00 00 00 
+  805832:	ff d0                	call   *%rax
+}
+  805834:	5d                   	pop    %rbp
+  805835:	c3                   	ret
+
+0000000000805836 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805836:	55                   	push   %rbp
+  805837:	48 89 e5             	mov    %rsp,%rbp
+  80583a:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80583e:	0f 31                	rdtsc
+  805840:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805843:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805846:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805849:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80584c:	48 c1 e2 20          	shl    $0x20,%rdx
+  805850:	48 09 d0             	or     %rdx,%rax
+  805853:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805857:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80585b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80585f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805866:	00 00 00 
+  805869:	8b 40 08             	mov    0x8(%rax),%eax
+  80586c:	48 98                	cltq
+  80586e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805872:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80587b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80587f:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80588a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80588f:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805893:	48 89 d0             	mov    %rdx,%rax
+  805896:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80589d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058a2:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8058a6:	48 01 c8             	add    %rcx,%rax
+}
+  8058a9:	c9                   	leave
+  8058aa:	c3                   	ret
+
+00000000008058ab <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8058ab:	55                   	push   %rbp
+  8058ac:	48 89 e5             	mov    %rsp,%rbp
+  8058af:	48 83 ec 20          	sub    $0x20,%rsp
+  8058b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8058b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058b9:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8058bc:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8058c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8058c5:	48 89 c7             	mov    %rax,%rdi
+  8058c8:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  8058cf:	00 00 00 
+  8058d2:	ff d0                	call   *%rax
+}
+  8058d4:	90                   	nop
+  8058d5:	c9                   	leave
+  8058d6:	c3                   	ret
+
+00000000008058d7 <getchar>:
+
+int
+getchar(void) {
+  8058d7:	55                   	push   %rbp
+  8058d8:	48 89 e5             	mov    %rsp,%rbp
+  8058db:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8058df:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8058e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8058e8:	48 89 c6             	mov    %rax,%rsi
+  8058eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058f0:	48 b8 cb 39 80 00 00 	movabs $0x8039cb,%rax
+  8058f7:	00 00 00 
+  8058fa:	ff d0                	call   *%rax
+  8058fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8058ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805903:	79 05                	jns    80590a <getchar+0x33>
+    return r;
+  805905:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805908:	eb 14                	jmp    80591e <getchar+0x47>
+  if (r < 1)
+  80590a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80590e:	7f 07                	jg     805917 <getchar+0x40>
+    return -E_EOF;
+  805910:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805915:	eb 07                	jmp    80591e <getchar+0x47>
+  return c;
+  805917:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80591b:	0f b6 c0             	movzbl %al,%eax
+}
+  80591e:	c9                   	leave
+  80591f:	c3                   	ret
+
+0000000000805920 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805920:	55                   	push   %rbp
+  805921:	48 89 e5             	mov    %rsp,%rbp
+  805924:	48 83 ec 20          	sub    $0x20,%rsp
+  805928:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80592b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80592f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805932:	48 89 d6             	mov    %rdx,%rsi
+  805935:	89 c7                	mov    %eax,%edi
+  805937:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80593e:	00 00 00 
+  805941:	ff d0                	call   *%rax
+  805943:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805946:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80594a:	79 05                	jns    805951 <iscons+0x31>
+    return r;
+  80594c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80594f:	eb 1a                	jmp    80596b <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805951:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805955:	8b 10                	mov    (%rax),%edx
+  805957:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80595e:	00 00 00 
+  805961:	8b 00                	mov    (%rax),%eax
+  805963:	39 c2                	cmp    %eax,%edx
+  805965:	0f 94 c0             	sete   %al
+  805968:	0f b6 c0             	movzbl %al,%eax
+}
+  80596b:	c9                   	leave
+  80596c:	c3                   	ret
+
+000000000080596d <opencons>:
+
+int
+opencons(void) {
+  80596d:	55                   	push   %rbp
+  80596e:	48 89 e5             	mov    %rsp,%rbp
+  805971:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805975:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805979:	48 89 c7             	mov    %rax,%rdi
+  80597c:	48 b8 8d 33 80 00 00 	movabs $0x80338d,%rax
+  805983:	00 00 00 
+  805986:	ff d0                	call   *%rax
+  805988:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80598b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80598f:	79 05                	jns    805996 <opencons+0x29>
+    return r;
+  805991:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805994:	eb 66                	jmp    8059fc <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80599a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80599f:	48 89 c6             	mov    %rax,%rsi
+  8059a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059a7:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  8059ae:	00 00 00 
+  8059b1:	ff d0                	call   *%rax
+  8059b3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059ba:	79 05                	jns    8059c1 <opencons+0x54>
+    return r;
+  8059bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059bf:	eb 3b                	jmp    8059fc <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8059c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059c5:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8059cc:	00 00 00 
+  8059cf:	8b 12                	mov    (%rdx),%edx
+  8059d1:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8059d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059d7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8059de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059e2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8059e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059ed:	48 89 c7             	mov    %rax,%rdi
+  8059f0:	48 b8 3f 33 80 00 00 	movabs $0x80333f,%rax
+  8059f7:	00 00 00 
+  8059fa:	ff d0                	call   *%rax
+}
+  8059fc:	c9                   	leave
+  8059fd:	c3                   	ret
+
+00000000008059fe <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8059fe:	55                   	push   %rbp
+  8059ff:	48 89 e5             	mov    %rsp,%rbp
+  805a02:	48 83 ec 20          	sub    $0x20,%rsp
+  805a06:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a09:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805a0c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805a10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a13:	48 89 d6             	mov    %rdx,%rsi
+  805a16:	89 c7                	mov    %eax,%edi
+  805a18:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  805a1f:	00 00 00 
+  805a22:	ff d0                	call   *%rax
+  805a24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a2b:	79 05                	jns    805a32 <consmode+0x34>
+    return r;
+  805a2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a30:	eb 34                	jmp    805a66 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a36:	8b 10                	mov    (%rax),%edx
+  805a38:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805a3f:	00 00 00 
+  805a42:	8b 00                	mov    (%rax),%eax
+  805a44:	39 c2                	cmp    %eax,%edx
+  805a46:	74 07                	je     805a4f <consmode+0x51>
+    return -E_INVAL;
+  805a48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a4d:	eb 17                	jmp    805a66 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805a4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a53:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805a59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a5d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a60:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805a63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805a66:	c9                   	leave
+  805a67:	c3                   	ret
+
+0000000000805a68 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a68:	55                   	push   %rbp
+  805a69:	48 89 e5             	mov    %rsp,%rbp
+  805a6c:	48 83 ec 20          	sub    $0x20,%rsp
+  805a70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a78:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a80:	8b 50 0c             	mov    0xc(%rax),%edx
+  805a83:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a8b:	48 89 ce             	mov    %rcx,%rsi
+  805a8e:	48 89 c7             	mov    %rax,%rdi
+  805a91:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  805a98:	00 00 00 
+  805a9b:	ff d0                	call   *%rax
+  805a9d:	48 98                	cltq
+}
+  805a9f:	c9                   	leave
+  805aa0:	c3                   	ret
+
+0000000000805aa1 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805aa1:	55                   	push   %rbp
+  805aa2:	48 89 e5             	mov    %rsp,%rbp
+  805aa5:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805aac:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805ab3:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805aba:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805ac1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805ac8:	eb 74                	jmp    805b3e <devcons_write+0x9d>
+    m = n - tot;
+  805aca:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805ad1:	89 c2                	mov    %eax,%edx
+  805ad3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ad6:	29 c2                	sub    %eax,%edx
+  805ad8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805adb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ade:	83 f8 7f             	cmp    $0x7f,%eax
+  805ae1:	76 07                	jbe    805aea <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805ae3:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805aea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805aed:	48 63 d0             	movslq %eax,%rdx
+  805af0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805af3:	48 63 c8             	movslq %eax,%rcx
+  805af6:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805afd:	48 01 c1             	add    %rax,%rcx
+  805b00:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b07:	48 89 ce             	mov    %rcx,%rsi
+  805b0a:	48 89 c7             	mov    %rax,%rdi
+  805b0d:	48 b8 ed 1b 80 00 00 	movabs $0x801bed,%rax
+  805b14:	00 00 00 
+  805b17:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805b19:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b1c:	48 63 d0             	movslq %eax,%rdx
+  805b1f:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805b26:	48 89 d6             	mov    %rdx,%rsi
+  805b29:	48 89 c7             	mov    %rax,%rdi
+  805b2c:	48 b8 61 22 80 00 00 	movabs $0x802261,%rax
+  805b33:	00 00 00 
+  805b36:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805b38:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b3b:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805b3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b41:	48 98                	cltq
+  805b43:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805b4a:	0f 82 7a ff ff ff    	jb     805aca <devcons_write+0x29>
+  }
+  return tot;
+  805b50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b53:	48 98                	cltq
+}
+  805b55:	c9                   	leave
+  805b56:	c3                   	ret
+
+0000000000805b57 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805b57:	55                   	push   %rbp
+  805b58:	48 89 e5             	mov    %rsp,%rbp
+  805b5b:	48 83 ec 08          	sub    $0x8,%rsp
+  805b5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805b63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b68:	c9                   	leave
+  805b69:	c3                   	ret
+
+0000000000805b6a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805b6a:	55                   	push   %rbp
+  805b6b:	48 89 e5             	mov    %rsp,%rbp
+  805b6e:	48 83 ec 10          	sub    $0x10,%rsp
+  805b72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805b7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b7e:	48 ba 6d 6f 80 00 00 	movabs $0x806f6d,%rdx
+  805b85:	00 00 00 
+  805b88:	48 89 d6             	mov    %rdx,%rsi
+  805b8b:	48 89 c7             	mov    %rax,%rdi
+  805b8e:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  805b95:	00 00 00 
+  805b98:	ff d0                	call   *%rax
+  return 0;
+  805b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b9f:	c9                   	leave
+  805ba0:	c3                   	ret
+
+0000000000805ba1 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805ba1:	55                   	push   %rbp
+  805ba2:	48 89 e5             	mov    %rsp,%rbp
+  805ba5:	48 83 ec 30          	sub    $0x30,%rsp
+  805ba9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805bad:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805bb0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805bb4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805bbb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bbe:	83 e0 02             	and    $0x2,%eax
+  805bc1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805bc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bc8:	8b 40 0c             	mov    0xc(%rax),%eax
+  805bcb:	83 f8 01             	cmp    $0x1,%eax
+  805bce:	75 04                	jne    805bd4 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805bd0:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805bd4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bd7:	83 e0 01             	and    $0x1,%eax
+  805bda:	85 c0                	test   %eax,%eax
+  805bdc:	74 44                	je     805c22 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805bde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805be6:	89 c2                	mov    %eax,%edx
+  805be8:	be 00 00 00 00       	mov    $0x0,%esi
+  805bed:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bf2:	48 b8 c0 28 80 00 00 	movabs $0x8028c0,%rax
+  805bf9:	00 00 00 
+  805bfc:	ff d0                	call   *%rax
+  805bfe:	83 f8 01             	cmp    $0x1,%eax
+  805c01:	75 06                	jne    805c09 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805c03:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805c07:	eb 19                	jmp    805c22 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805c09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c0d:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805c13:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805c16:	89 c2                	mov    %eax,%edx
+  805c18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c1c:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805c22:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805c25:	c9                   	leave
+  805c26:	c3                   	ret
+
+0000000000805c27 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805c27:	55                   	push   %rbp
+  805c28:	48 89 e5             	mov    %rsp,%rbp
+  805c2b:	48 83 ec 20          	sub    $0x20,%rsp
+  805c2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805c33:	48 b8 ff 23 80 00 00 	movabs $0x8023ff,%rax
+  805c3a:	00 00 00 
+  805c3d:	ff d0                	call   *%rax
+  805c3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805c42:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805c49:	00 00 00 
+  805c4c:	48 8b 00             	mov    (%rax),%rax
+  805c4f:	48 85 c0             	test   %rax,%rax
+  805c52:	75 62                	jne    805cb6 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805c54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c57:	ba 07 00 00 00       	mov    $0x7,%edx
+  805c5c:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805c63:	00 00 00 
+  805c66:	48 89 ce             	mov    %rcx,%rsi
+  805c69:	89 c7                	mov    %eax,%edi
+  805c6b:	48 b8 78 24 80 00 00 	movabs $0x802478,%rax
+  805c72:	00 00 00 
+  805c75:	ff d0                	call   *%rax
+  805c77:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805c7a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c7e:	79 36                	jns    805cb6 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805c80:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c83:	89 c1                	mov    %eax,%ecx
+  805c85:	48 b8 74 6f 80 00 00 	movabs $0x806f74,%rax
+  805c8c:	00 00 00 
+  805c8f:	48 89 c2             	mov    %rax,%rdx
+  805c92:	be 23 00 00 00       	mov    $0x23,%esi
+  805c97:	48 b8 8c 6f 80 00 00 	movabs $0x806f8c,%rax
+  805c9e:	00 00 00 
+  805ca1:	48 89 c7             	mov    %rax,%rdi
+  805ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ca9:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  805cb0:	00 00 00 
+  805cb3:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805cb6:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  805cbd:	00 00 00 
+  805cc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cc4:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805cc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cca:	48 ba 27 5d 80 00 00 	movabs $0x805d27,%rdx
+  805cd1:	00 00 00 
+  805cd4:	48 89 d6             	mov    %rdx,%rsi
+  805cd7:	89 c7                	mov    %eax,%edi
+  805cd9:	48 b8 15 26 80 00 00 	movabs $0x802615,%rax
+  805ce0:	00 00 00 
+  805ce3:	ff d0                	call   *%rax
+  805ce5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805ce8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805cec:	79 36                	jns    805d24 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805cee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805cf1:	89 c1                	mov    %eax,%ecx
+  805cf3:	48 b8 74 6f 80 00 00 	movabs $0x806f74,%rax
+  805cfa:	00 00 00 
+  805cfd:	48 89 c2             	mov    %rax,%rdx
+  805d00:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805d05:	48 b8 8c 6f 80 00 00 	movabs $0x806f8c,%rax
+  805d0c:	00 00 00 
+  805d0f:	48 89 c7             	mov    %rax,%rdi
+  805d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d17:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  805d1e:	00 00 00 
+  805d21:	41 ff d0             	call   *%r8
+}
+  805d24:	90                   	nop
+  805d25:	c9                   	leave
+  805d26:	c3                   	ret
+
+0000000000805d27 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805d27:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805d2a:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805d2d:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805d34:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805d38:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805d3d:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805d44:	00 00 00 
+	call *%rax
+  805d47:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805d49:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805d4e:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805d51:	41 5f                	pop    %r15
+	popq %r15
+  805d53:	41 5f                	pop    %r15
+	popq %r15
+  805d55:	41 5f                	pop    %r15
+	popq %r14
+  805d57:	41 5e                	pop    %r14
+	popq %r13
+  805d59:	41 5d                	pop    %r13
+	popq %r12
+  805d5b:	41 5c                	pop    %r12
+	popq %r11
+  805d5d:	41 5b                	pop    %r11
+	popq %r10
+  805d5f:	41 5a                	pop    %r10
+	popq %r9
+  805d61:	41 59                	pop    %r9
+	popq %r8
+  805d63:	41 58                	pop    %r8
+	popq %rsi
+  805d65:	5e                   	pop    %rsi
+	popq %rdi
+  805d66:	5f                   	pop    %rdi
+	popq %rbp
+  805d67:	5d                   	pop    %rbp
+	popq %rdx
+  805d68:	5a                   	pop    %rdx
+	popq %rcx
+  805d69:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805d6a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805d6f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805d74:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805d78:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805d7b:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805d80:	5b                   	pop    %rbx
+	popq %rax
+  805d81:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805d82:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805d86:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805d87:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805d8c:	c3                   	ret
+
+0000000000805d8d <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805d8d:	55                   	push   %rbp
+  805d8e:	48 89 e5             	mov    %rsp,%rbp
+  805d91:	48 83 ec 20          	sub    $0x20,%rsp
+  805d95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805d9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805da1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805da5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805da9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805dad:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805db4:	48 89 c7             	mov    %rax,%rdi
+  805db7:	48 b8 c5 5d 80 00 00 	movabs $0x805dc5,%rax
+  805dbe:	00 00 00 
+  805dc1:	ff d0                	call   *%rax
+}
+  805dc3:	c9                   	leave
+  805dc4:	c3                   	ret
+
+0000000000805dc5 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805dc5:	55                   	push   %rbp
+  805dc6:	48 89 e5             	mov    %rsp,%rbp
+  805dc9:	48 83 ec 30          	sub    $0x30,%rsp
+  805dcd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805dd1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805dd5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805dd9:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805ddd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805de2:	75 0e                	jne    805df2 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805de4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805deb:	00 00 00 
+  805dee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805df2:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805df7:	75 18                	jne    805e11 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dfd:	48 89 c7             	mov    %rax,%rdi
+  805e00:	48 b8 b8 26 80 00 00 	movabs $0x8026b8,%rax
+  805e07:	00 00 00 
+  805e0a:	ff d0                	call   *%rax
+  805e0c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e0f:	eb 1d                	jmp    805e2e <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805e11:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e19:	48 89 d6             	mov    %rdx,%rsi
+  805e1c:	48 89 c7             	mov    %rax,%rdi
+  805e1f:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  805e26:	00 00 00 
+  805e29:	ff d0                	call   *%rax
+  805e2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805e2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e32:	79 2a                	jns    805e5e <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805e34:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e39:	74 0a                	je     805e45 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805e3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e3f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805e45:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e4a:	74 0a                	je     805e56 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805e4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e50:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805e56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e59:	e9 aa 00 00 00       	jmp    805f08 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805e5e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e63:	74 36                	je     805e9b <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805e65:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e6c:	00 00 00 
+  805e6f:	8b 40 04             	mov    0x4(%rax),%eax
+  805e72:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e77:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e7e:	00 00 00 
+  805e81:	48 98                	cltq
+  805e83:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e8a:	48 01 d0             	add    %rdx,%rax
+  805e8d:	48 05 24 01 00 00    	add    $0x124,%rax
+  805e93:	8b 10                	mov    (%rax),%edx
+  805e95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e99:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805e9b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805ea0:	74 36                	je     805ed8 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805ea2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805ea9:	00 00 00 
+  805eac:	8b 40 04             	mov    0x4(%rax),%eax
+  805eaf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805eb4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ebb:	00 00 00 
+  805ebe:	48 98                	cltq
+  805ec0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ec7:	48 01 d0             	add    %rdx,%rax
+  805eca:	48 05 28 01 00 00    	add    $0x128,%rax
+  805ed0:	8b 10                	mov    (%rax),%edx
+  805ed2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ed6:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805ed8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805edf:	00 00 00 
+  805ee2:	8b 40 04             	mov    0x4(%rax),%eax
+  805ee5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805eea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ef1:	00 00 00 
+  805ef4:	48 98                	cltq
+  805ef6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805efd:	48 01 d0             	add    %rdx,%rax
+  805f00:	48 05 20 01 00 00    	add    $0x120,%rax
+  805f06:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805f08:	c9                   	leave
+  805f09:	c3                   	ret
+
+0000000000805f0a <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805f0a:	55                   	push   %rbp
+  805f0b:	48 89 e5             	mov    %rsp,%rbp
+  805f0e:	48 83 ec 30          	sub    $0x30,%rsp
+  805f12:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f15:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805f18:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805f1c:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805f1f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805f24:	75 5e                	jne    805f84 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805f26:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805f2d:	00 00 00 
+  805f30:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f34:	eb 4e                	jmp    805f84 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805f36:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f3a:	79 3c                	jns    805f78 <ipc_send+0x6e>
+  805f3c:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805f40:	74 36                	je     805f78 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805f42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f45:	89 c1                	mov    %eax,%ecx
+  805f47:	48 b8 a0 6f 80 00 00 	movabs $0x806fa0,%rax
+  805f4e:	00 00 00 
+  805f51:	48 89 c2             	mov    %rax,%rdx
+  805f54:	be 54 00 00 00       	mov    $0x54,%esi
+  805f59:	48 b8 c6 6f 80 00 00 	movabs $0x806fc6,%rax
+  805f60:	00 00 00 
+  805f63:	48 89 c7             	mov    %rax,%rdi
+  805f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f6b:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  805f72:	00 00 00 
+  805f75:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805f78:	48 b8 3b 24 80 00 00 	movabs $0x80243b,%rax
+  805f7f:	00 00 00 
+  805f82:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f84:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805f87:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805f8a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f91:	89 c7                	mov    %eax,%edi
+  805f93:	48 b8 61 26 80 00 00 	movabs $0x802661,%rax
+  805f9a:	00 00 00 
+  805f9d:	ff d0                	call   *%rax
+  805f9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805fa2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fa6:	75 8e                	jne    805f36 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805fa8:	48 b8 3b 24 80 00 00 	movabs $0x80243b,%rax
+  805faf:	00 00 00 
+  805fb2:	ff d0                	call   *%rax
+}
+  805fb4:	90                   	nop
+  805fb5:	c9                   	leave
+  805fb6:	c3                   	ret
+
+0000000000805fb7 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805fb7:	55                   	push   %rbp
+  805fb8:	48 89 e5             	mov    %rsp,%rbp
+  805fbb:	48 83 ec 18          	sub    $0x18,%rsp
+  805fbf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805fc2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805fc9:	eb 4d                	jmp    806018 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805fcb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805fd2:	00 00 00 
+  805fd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fd8:	48 98                	cltq
+  805fda:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805fe1:	48 01 d0             	add    %rdx,%rax
+  805fe4:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805fea:	8b 00                	mov    (%rax),%eax
+  805fec:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805fef:	75 23                	jne    806014 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805ff1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ff8:	00 00 00 
+  805ffb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ffe:	48 98                	cltq
+  806000:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806007:	48 01 d0             	add    %rdx,%rax
+  80600a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806010:	8b 00                	mov    (%rax),%eax
+  806012:	eb 12                	jmp    806026 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806014:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806018:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80601f:	7e aa                	jle    805fcb <ipc_find_env+0x14>
+  return 0;
+  806021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806026:	c9                   	leave
+  806027:	c3                   	ret
+
+0000000000806028 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806028:	55                   	push   %rbp
+  806029:	48 89 e5             	mov    %rsp,%rbp
+  80602c:	48 83 ec 18          	sub    $0x18,%rsp
+  806030:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806034:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806038:	48 c1 e8 27          	shr    $0x27,%rax
+  80603c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806041:	48 89 c2             	mov    %rax,%rdx
+  806044:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80604b:	01 00 00 
+  80604e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806052:	83 e0 01             	and    $0x1,%eax
+  806055:	48 85 c0             	test   %rax,%rax
+  806058:	74 63                	je     8060bd <pageref+0x95>
+  80605a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80605e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806062:	48 89 c2             	mov    %rax,%rdx
+  806065:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80606c:	01 00 00 
+  80606f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806073:	83 e0 01             	and    $0x1,%eax
+  806076:	48 85 c0             	test   %rax,%rax
+  806079:	74 42                	je     8060bd <pageref+0x95>
+  80607b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80607f:	48 c1 e8 15          	shr    $0x15,%rax
+  806083:	48 89 c2             	mov    %rax,%rdx
+  806086:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80608d:	01 00 00 
+  806090:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806094:	83 e0 01             	and    $0x1,%eax
+  806097:	48 85 c0             	test   %rax,%rax
+  80609a:	74 21                	je     8060bd <pageref+0x95>
+  80609c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060a0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060a4:	48 89 c2             	mov    %rax,%rdx
+  8060a7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8060ae:	01 00 00 
+  8060b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060b5:	83 e0 01             	and    $0x1,%eax
+  8060b8:	48 85 c0             	test   %rax,%rax
+  8060bb:	75 07                	jne    8060c4 <pageref+0x9c>
+    return 0;
+  8060bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060c2:	eb 53                	jmp    806117 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8060c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060c8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060cc:	48 89 c2             	mov    %rax,%rdx
+  8060cf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8060d6:	01 00 00 
+  8060d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8060e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060e5:	83 e0 01             	and    $0x1,%eax
+  8060e8:	48 85 c0             	test   %rax,%rax
+  8060eb:	75 07                	jne    8060f4 <pageref+0xcc>
+    return 0;
+  8060ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060f2:	eb 23                	jmp    806117 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8060f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060f8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060fc:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  806103:	00 00 00 
+  806106:	48 c1 e0 04          	shl    $0x4,%rax
+  80610a:	48 01 d0             	add    %rdx,%rax
+  80610d:	48 83 c0 08          	add    $0x8,%rax
+  806111:	0f b7 00             	movzwl (%rax),%eax
+  806114:	0f b7 c0             	movzwl %ax,%eax
+}
+  806117:	c9                   	leave
+  806118:	c3                   	ret
+
+0000000000806119 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  806119:	55                   	push   %rbp
+  80611a:	48 89 e5             	mov    %rsp,%rbp
+  80611d:	48 83 ec 10          	sub    $0x10,%rsp
+  806121:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806124:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806127:	be 00 00 00 00       	mov    $0x0,%esi
+  80612c:	89 c7                	mov    %eax,%edi
+  80612e:	48 b8 3d 61 80 00 00 	movabs $0x80613d,%rax
+  806135:	00 00 00 
+  806138:	ff d0                	call   *%rax
+}
+  80613a:	90                   	nop
+  80613b:	c9                   	leave
+  80613c:	c3                   	ret
+
+000000000080613d <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  80613d:	55                   	push   %rbp
+  80613e:	48 89 e5             	mov    %rsp,%rbp
+  806141:	48 83 ec 10          	sub    $0x10,%rsp
+  806145:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806148:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80614c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806150:	75 3e                	jne    806190 <waitpid+0x53>
+  806152:	48 b8 d0 6f 80 00 00 	movabs $0x806fd0,%rax
+  806159:	00 00 00 
+  80615c:	48 89 c1             	mov    %rax,%rcx
+  80615f:	48 b8 db 6f 80 00 00 	movabs $0x806fdb,%rax
+  806166:	00 00 00 
+  806169:	48 89 c2             	mov    %rax,%rdx
+  80616c:	be 0e 00 00 00       	mov    $0xe,%esi
+  806171:	48 b8 f0 6f 80 00 00 	movabs $0x806ff0,%rax
+  806178:	00 00 00 
+  80617b:	48 89 c7             	mov    %rax,%rdi
+  80617e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806183:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  80618a:	00 00 00 
+  80618d:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  806190:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  806195:	74 0a                	je     8061a1 <waitpid+0x64>
+    *status = 0;
+  806197:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80619b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  8061a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8061a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8061a8:	48 89 d6             	mov    %rdx,%rsi
+  8061ab:	89 c7                	mov    %eax,%edi
+  8061ad:	48 b8 77 23 80 00 00 	movabs $0x802377,%rax
+  8061b4:	00 00 00 
+  8061b7:	ff d0                	call   *%rax
+}
+  8061b9:	c9                   	leave
+  8061ba:	c3                   	ret
+
+00000000008061bb <xchg>:
+  8061bb:	55                   	push   %rbp
+  8061bc:	48 89 e5             	mov    %rsp,%rbp
+  8061bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8061c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8061c7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8061ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8061d1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8061d5:	f0 87 02             	lock xchg %eax,(%rdx)
+  8061d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8061db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8061de:	c9                   	leave
+  8061df:	c3                   	ret
+
+00000000008061e0 <cmpxchg>:
+  8061e0:	55                   	push   %rbp
+  8061e1:	48 89 e5             	mov    %rsp,%rbp
+  8061e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8061e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8061ec:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8061ef:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8061f2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8061f6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8061f9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8061fc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806200:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806204:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80620a:	c9                   	leave
+  80620b:	c3                   	ret
+
+000000000080620c <xadd>:
+  80620c:	55                   	push   %rbp
+  80620d:	48 89 e5             	mov    %rsp,%rbp
+  806210:	48 83 ec 10          	sub    $0x10,%rsp
+  806214:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806218:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80621b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80621f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806222:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806226:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  80622a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80622d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806230:	c9                   	leave
+  806231:	c3                   	ret
+
+0000000000806232 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806232:	55                   	push   %rbp
+  806233:	48 89 e5             	mov    %rsp,%rbp
+  806236:	48 83 ec 08          	sub    $0x8,%rsp
+  80623a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80623e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806242:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806248:	90                   	nop
+  806249:	c9                   	leave
+  80624a:	c3                   	ret
+
+000000000080624b <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  80624b:	55                   	push   %rbp
+  80624c:	48 89 e5             	mov    %rsp,%rbp
+  80624f:	48 83 ec 20          	sub    $0x20,%rsp
+  806253:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80625b:	ba 01 00 00 00       	mov    $0x1,%edx
+  806260:	be 00 00 00 00       	mov    $0x0,%esi
+  806265:	48 89 c7             	mov    %rax,%rdi
+  806268:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  80626f:	00 00 00 
+  806272:	ff d0                	call   *%rax
+  806274:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806277:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80627b:	74 65                	je     8062e2 <mutex_lock+0x97>
+  if (c != 2)
+  80627d:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806281:	74 57                	je     8062da <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806287:	be 02 00 00 00       	mov    $0x2,%esi
+  80628c:	48 89 c7             	mov    %rax,%rdi
+  80628f:	48 b8 bb 61 80 00 00 	movabs $0x8061bb,%rax
+  806296:	00 00 00 
+  806299:	ff d0                	call   *%rax
+  80629b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80629e:	eb 3a                	jmp    8062da <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8062a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062a4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8062ab:	be 02 00 00 00       	mov    $0x2,%esi
+  8062b0:	48 89 c7             	mov    %rax,%rdi
+  8062b3:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  8062ba:	00 00 00 
+  8062bd:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8062bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062c3:	be 02 00 00 00       	mov    $0x2,%esi
+  8062c8:	48 89 c7             	mov    %rax,%rdi
+  8062cb:	48 b8 bb 61 80 00 00 	movabs $0x8061bb,%rax
+  8062d2:	00 00 00 
+  8062d5:	ff d0                	call   *%rax
+  8062d7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8062da:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8062de:	75 c0                	jne    8062a0 <mutex_lock+0x55>
+  8062e0:	eb 01                	jmp    8062e3 <mutex_lock+0x98>
+    return;
+  8062e2:	90                   	nop
+}
+  8062e3:	c9                   	leave
+  8062e4:	c3                   	ret
+
+00000000008062e5 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8062e5:	55                   	push   %rbp
+  8062e6:	48 89 e5             	mov    %rsp,%rbp
+  8062e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8062ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  8062f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8062fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8062ff:	48 89 c7             	mov    %rax,%rdi
+  806302:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  806309:	00 00 00 
+  80630c:	ff d0                	call   *%rax
+  80630e:	85 c0                	test   %eax,%eax
+  806310:	75 07                	jne    806319 <mutex_trylock+0x34>
+  806312:	b8 00 00 00 00       	mov    $0x0,%eax
+  806317:	eb 05                	jmp    80631e <mutex_trylock+0x39>
+  806319:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80631e:	c9                   	leave
+  80631f:	c3                   	ret
+
+0000000000806320 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806320:	55                   	push   %rbp
+  806321:	48 89 e5             	mov    %rsp,%rbp
+  806324:	48 83 ec 10          	sub    $0x10,%rsp
+  806328:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80632c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806330:	be 00 00 00 00       	mov    $0x0,%esi
+  806335:	48 89 c7             	mov    %rax,%rdi
+  806338:	48 b8 bb 61 80 00 00 	movabs $0x8061bb,%rax
+  80633f:	00 00 00 
+  806342:	ff d0                	call   *%rax
+  806344:	83 f8 02             	cmp    $0x2,%eax
+  806347:	75 18                	jne    806361 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806349:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80634d:	be 01 00 00 00       	mov    $0x1,%esi
+  806352:	48 89 c7             	mov    %rax,%rdi
+  806355:	48 b8 73 28 80 00 00 	movabs $0x802873,%rax
+  80635c:	00 00 00 
+  80635f:	ff d0                	call   *%rax
+}
+  806361:	90                   	nop
+  806362:	c9                   	leave
+  806363:	c3                   	ret
+
+0000000000806364 <cond_init>:
+cond_init(struct Cond *c) {
+  806364:	55                   	push   %rbp
+  806365:	48 89 e5             	mov    %rsp,%rbp
+  806368:	48 83 ec 08          	sub    $0x8,%rsp
+  80636c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806374:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80637a:	90                   	nop
+  80637b:	c9                   	leave
+  80637c:	c3                   	ret
+
+000000000080637d <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80637d:	55                   	push   %rbp
+  80637e:	48 89 e5             	mov    %rsp,%rbp
+  806381:	48 83 ec 30          	sub    $0x30,%rsp
+  806385:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806389:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80638d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  806391:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806395:	8b 00                	mov    (%rax),%eax
+  806397:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  80639a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80639e:	48 89 c7             	mov    %rax,%rdi
+  8063a1:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  8063a8:	00 00 00 
+  8063ab:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8063ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8063b5:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8063b8:	89 ce                	mov    %ecx,%esi
+  8063ba:	48 89 c7             	mov    %rax,%rdi
+  8063bd:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  8063c4:	00 00 00 
+  8063c7:	ff d0                	call   *%rax
+  8063c9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8063cc:	eb 1f                	jmp    8063ed <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8063ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063d2:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8063d9:	be 02 00 00 00       	mov    $0x2,%esi
+  8063de:	48 89 c7             	mov    %rax,%rdi
+  8063e1:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  8063e8:	00 00 00 
+  8063eb:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8063ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063f1:	be 02 00 00 00       	mov    $0x2,%esi
+  8063f6:	48 89 c7             	mov    %rax,%rdi
+  8063f9:	48 b8 bb 61 80 00 00 	movabs $0x8061bb,%rax
+  806400:	00 00 00 
+  806403:	ff d0                	call   *%rax
+  806405:	85 c0                	test   %eax,%eax
+  806407:	75 c5                	jne    8063ce <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806409:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80640d:	75 07                	jne    806416 <cond_timedwait+0x99>
+  80640f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806414:	eb 05                	jmp    80641b <cond_timedwait+0x9e>
+  806416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80641b:	c9                   	leave
+  80641c:	c3                   	ret
+
+000000000080641d <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80641d:	55                   	push   %rbp
+  80641e:	48 89 e5             	mov    %rsp,%rbp
+  806421:	48 83 ec 10          	sub    $0x10,%rsp
+  806425:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806429:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80642d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806435:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80643c:	48 89 ce             	mov    %rcx,%rsi
+  80643f:	48 89 c7             	mov    %rax,%rdi
+  806442:	48 b8 7d 63 80 00 00 	movabs $0x80637d,%rax
+  806449:	00 00 00 
+  80644c:	ff d0                	call   *%rax
+}
+  80644e:	90                   	nop
+  80644f:	c9                   	leave
+  806450:	c3                   	ret
+
+0000000000806451 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806451:	55                   	push   %rbp
+  806452:	48 89 e5             	mov    %rsp,%rbp
+  806455:	48 83 ec 10          	sub    $0x10,%rsp
+  806459:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80645d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806461:	be 01 00 00 00       	mov    $0x1,%esi
+  806466:	48 89 c7             	mov    %rax,%rdi
+  806469:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  806470:	00 00 00 
+  806473:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806479:	be 01 00 00 00       	mov    $0x1,%esi
+  80647e:	48 89 c7             	mov    %rax,%rdi
+  806481:	48 b8 73 28 80 00 00 	movabs $0x802873,%rax
+  806488:	00 00 00 
+  80648b:	ff d0                	call   *%rax
+}
+  80648d:	90                   	nop
+  80648e:	c9                   	leave
+  80648f:	c3                   	ret
+
+0000000000806490 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  806490:	55                   	push   %rbp
+  806491:	48 89 e5             	mov    %rsp,%rbp
+  806494:	48 83 ec 10          	sub    $0x10,%rsp
+  806498:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80649c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8064a5:	48 89 c7             	mov    %rax,%rdi
+  8064a8:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  8064af:	00 00 00 
+  8064b2:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8064b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064b8:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8064bd:	48 89 c7             	mov    %rax,%rdi
+  8064c0:	48 b8 73 28 80 00 00 	movabs $0x802873,%rax
+  8064c7:	00 00 00 
+  8064ca:	ff d0                	call   *%rax
+}
+  8064cc:	90                   	nop
+  8064cd:	c9                   	leave
+  8064ce:	c3                   	ret
+
+00000000008064cf <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8064cf:	55                   	push   %rbp
+  8064d0:	48 89 e5             	mov    %rsp,%rbp
+  8064d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8064d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8064db:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8064de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064e2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8064e5:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8064e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064eb:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8064f2:	90                   	nop
+  8064f3:	c9                   	leave
+  8064f4:	c3                   	ret
+
+00000000008064f5 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8064f5:	55                   	push   %rbp
+  8064f6:	48 89 e5             	mov    %rsp,%rbp
+  8064f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8064fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806501:	eb 2a                	jmp    80652d <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806503:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806506:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806509:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80650d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806510:	89 ce                	mov    %ecx,%esi
+  806512:	48 89 c7             	mov    %rax,%rdi
+  806515:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  80651c:	00 00 00 
+  80651f:	ff d0                	call   *%rax
+  806521:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806524:	75 07                	jne    80652d <sem_trywait+0x38>
+      return 0;
+  806526:	b8 00 00 00 00       	mov    $0x0,%eax
+  80652b:	eb 14                	jmp    806541 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80652d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806531:	8b 00                	mov    (%rax),%eax
+  806533:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806536:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80653a:	75 c7                	jne    806503 <sem_trywait+0xe>
+  return -E_BUSY;
+  80653c:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806541:	c9                   	leave
+  806542:	c3                   	ret
+
+0000000000806543 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806543:	55                   	push   %rbp
+  806544:	48 89 e5             	mov    %rsp,%rbp
+  806547:	48 83 ec 30          	sub    $0x30,%rsp
+  80654b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80654f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806553:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80655a:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80655b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806560:	0f 84 fb 00 00 00    	je     806661 <sem_timedwait+0x11e>
+  806566:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80656b:	0f 84 f0 00 00 00    	je     806661 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806571:	48 b8 36 58 80 00 00 	movabs $0x805836,%rax
+  806578:	00 00 00 
+  80657b:	ff d0                	call   *%rax
+  80657d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806581:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806585:	48 f7 d0             	not    %rax
+  806588:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80658c:	73 0d                	jae    80659b <sem_timedwait+0x58>
+  80658e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806592:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806596:	48 01 d0             	add    %rdx,%rax
+  806599:	eb 07                	jmp    8065a2 <sem_timedwait+0x5f>
+  80659b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8065a2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8065a6:	e9 b6 00 00 00       	jmp    806661 <sem_timedwait+0x11e>
+    if (deadline) {
+  8065ab:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8065b0:	74 2d                	je     8065df <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8065b2:	48 b8 36 58 80 00 00 	movabs $0x805836,%rax
+  8065b9:	00 00 00 
+  8065bc:	ff d0                	call   *%rax
+  8065be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8065c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065c6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8065ca:	73 0a                	jae    8065d6 <sem_timedwait+0x93>
+  8065cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065d0:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8065d4:	eb 05                	jmp    8065db <sem_timedwait+0x98>
+  8065d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065db:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8065df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065e3:	48 83 c0 04          	add    $0x4,%rax
+  8065e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8065ec:	48 89 c7             	mov    %rax,%rdi
+  8065ef:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  8065f6:	00 00 00 
+  8065f9:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8065fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065ff:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806603:	be 00 00 00 00       	mov    $0x0,%esi
+  806608:	48 89 c7             	mov    %rax,%rdi
+  80660b:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  806612:	00 00 00 
+  806615:	ff d0                	call   *%rax
+  806617:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80661a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80661e:	48 83 c0 04          	add    $0x4,%rax
+  806622:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806627:	48 89 c7             	mov    %rax,%rdi
+  80662a:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  806631:	00 00 00 
+  806634:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806636:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80663a:	75 25                	jne    806661 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80663c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806640:	48 89 c7             	mov    %rax,%rdi
+  806643:	48 b8 f5 64 80 00 00 	movabs $0x8064f5,%rax
+  80664a:	00 00 00 
+  80664d:	ff d0                	call   *%rax
+  80664f:	85 c0                	test   %eax,%eax
+  806651:	79 07                	jns    80665a <sem_timedwait+0x117>
+  806653:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806658:	eb 27                	jmp    806681 <sem_timedwait+0x13e>
+  80665a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80665f:	eb 20                	jmp    806681 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806665:	48 89 c7             	mov    %rax,%rdi
+  806668:	48 b8 f5 64 80 00 00 	movabs $0x8064f5,%rax
+  80666f:	00 00 00 
+  806672:	ff d0                	call   *%rax
+  806674:	85 c0                	test   %eax,%eax
+  806676:	0f 88 2f ff ff ff    	js     8065ab <sem_timedwait+0x68>
+  return 0;
+  80667c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806681:	c9                   	leave
+  806682:	c3                   	ret
+
+0000000000806683 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806683:	55                   	push   %rbp
+  806684:	48 89 e5             	mov    %rsp,%rbp
+  806687:	48 83 ec 10          	sub    $0x10,%rsp
+  80668b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  80668f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806693:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  80669a:	48 89 c7             	mov    %rax,%rdi
+  80669d:	48 b8 43 65 80 00 00 	movabs $0x806543,%rax
+  8066a4:	00 00 00 
+  8066a7:	ff d0                	call   *%rax
+}
+  8066a9:	90                   	nop
+  8066aa:	c9                   	leave
+  8066ab:	c3                   	ret
+
+00000000008066ac <sem_post>:
+sem_post(struct Semaphore *s) {
+  8066ac:	55                   	push   %rbp
+  8066ad:	48 89 e5             	mov    %rsp,%rbp
+  8066b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8066b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8066b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8066c1:	48 89 c7             	mov    %rax,%rdi
+  8066c4:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  8066cb:	00 00 00 
+  8066ce:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8066d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066d4:	8b 40 04             	mov    0x4(%rax),%eax
+  8066d7:	85 c0                	test   %eax,%eax
+  8066d9:	74 18                	je     8066f3 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8066db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066df:	be 01 00 00 00       	mov    $0x1,%esi
+  8066e4:	48 89 c7             	mov    %rax,%rdi
+  8066e7:	48 b8 73 28 80 00 00 	movabs $0x802873,%rax
+  8066ee:	00 00 00 
+  8066f1:	ff d0                	call   *%rax
+}
+  8066f3:	90                   	nop
+  8066f4:	c9                   	leave
+  8066f5:	c3                   	ret
+  8066f6:	66 90                	xchg   %ax,%ax
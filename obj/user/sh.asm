@@ -0,0 +1,12845 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 86 0d 00 00       	call   800db2 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <runcmd>:
+// Do not return until the shell command is finished.
+// runcmd() is called in a forked child,
+// so it's OK to manipulate file descriptor state.
+#define MAXARGS 16
+void
+runcmd(char *s) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 81 ec d0 04 00 00 	sub    $0x4d0,%rsp
+  80003d:	48 89 bd 38 fb ff ff 	mov    %rdi,-0x4c8(%rbp)
+  char *argv[MAXARGS], *t, argv0buf[BUFSIZ];
+  int argc, c, i, r, p[2], fd, pipe_child;
+
+  pipe_child = 0;
+  800044:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  gettoken(s, 0);
+  80004b:	48 8b 85 38 fb ff ff 	mov    -0x4c8(%rbp),%rax
+  800052:	be 00 00 00 00       	mov    $0x0,%esi
+  800057:	48 89 c7             	mov    %rax,%rdi
+  80005a:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  800061:	00 00 00 
+  800064:	ff d0                	call   *%rax
+
+again:
+  argc = 0;
+  800066:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while (1) {
+    switch ((c = gettoken(0, &t))) {
+  80006d:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+  800074:	48 89 c6             	mov    %rax,%rsi
+  800077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007c:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+  800088:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80008b:	83 7d f4 7c          	cmpl   $0x7c,-0xc(%rbp)
+  80008f:	0f 84 48 02 00 00    	je     8002dd <runcmd+0x2ab>
+  800095:	83 7d f4 7c          	cmpl   $0x7c,-0xc(%rbp)
+  800099:	0f 8f 7a 03 00 00    	jg     800419 <runcmd+0x3e7>
+  80009f:	83 7d f4 77          	cmpl   $0x77,-0xc(%rbp)
+  8000a3:	74 33                	je     8000d8 <runcmd+0xa6>
+  8000a5:	83 7d f4 77          	cmpl   $0x77,-0xc(%rbp)
+  8000a9:	0f 8f 6a 03 00 00    	jg     800419 <runcmd+0x3e7>
+  8000af:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%rbp)
+  8000b3:	0f 84 49 01 00 00    	je     800202 <runcmd+0x1d0>
+  8000b9:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%rbp)
+  8000bd:	0f 8f 56 03 00 00    	jg     800419 <runcmd+0x3e7>
+  8000c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8000c7:	0f 84 8e 03 00 00    	je     80045b <runcmd+0x429>
+  8000cd:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%rbp)
+  8000d1:	74 54                	je     800127 <runcmd+0xf5>
+  8000d3:	e9 41 03 00 00       	jmp    800419 <runcmd+0x3e7>
+
+      case 'w': // Add an argument
+        if (argc == MAXARGS) {
+  8000d8:	83 7d fc 10          	cmpl   $0x10,-0x4(%rbp)
+  8000dc:	75 2a                	jne    800108 <runcmd+0xd6>
+          cprintf("too many arguments\n");
+  8000de:	48 b8 c0 82 80 00 00 	movabs $0x8082c0,%rax
+  8000e5:	00 00 00 
+  8000e8:	48 89 c7             	mov    %rax,%rdi
+  8000eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f0:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  8000f7:	00 00 00 
+  8000fa:	ff d2                	call   *%rdx
+          exit();
+  8000fc:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800103:	00 00 00 
+  800106:	ff d0                	call   *%rax
+        }
+        argv[argc++] = t;
+  800108:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80010b:	8d 50 01             	lea    0x1(%rax),%edx
+  80010e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  800111:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  800118:	48 98                	cltq
+  80011a:	48 89 94 c5 60 ff ff 	mov    %rdx,-0xa0(%rbp,%rax,8)
+  800121:	ff 
+        break;
+  800122:	e9 2f 03 00 00       	jmp    800456 <runcmd+0x424>
+
+      case '<': // Input redirection
+        // Grab the filename from the argument list
+        if (gettoken(0, &t) != 'w') {
+  800127:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+  80012e:	48 89 c6             	mov    %rax,%rsi
+  800131:	bf 00 00 00 00       	mov    $0x0,%edi
+  800136:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  80013d:	00 00 00 
+  800140:	ff d0                	call   *%rax
+  800142:	83 f8 77             	cmp    $0x77,%eax
+  800145:	74 2a                	je     800171 <runcmd+0x13f>
+          cprintf("syntax error: < not followed by word\n");
+  800147:	48 b8 d8 82 80 00 00 	movabs $0x8082d8,%rax
+  80014e:	00 00 00 
+  800151:	48 89 c7             	mov    %rax,%rdi
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+          exit();
+  800165:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80016c:	00 00 00 
+  80016f:	ff d0                	call   *%rax
+        // then check whether 'fd' is 0.
+        // If not, dup 'fd' onto file descriptor 0,
+        // then close the original 'fd'.
+
+        // LAB 11: Your code here.
+        if ((fd = open(t, O_RDONLY)) < 0) {
+  800171:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800178:	be 00 00 00 00       	mov    $0x0,%esi
+  80017d:	48 89 c7             	mov    %rax,%rdi
+  800180:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+  80018c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80018f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800193:	79 37                	jns    8001cc <runcmd+0x19a>
+          cprintf("open %s for read: %i", t, fd);
+  800195:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80019c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80019f:	48 89 c6             	mov    %rax,%rsi
+  8001a2:	48 b8 fe 82 80 00 00 	movabs $0x8082fe,%rax
+  8001a9:	00 00 00 
+  8001ac:	48 89 c7             	mov    %rax,%rdi
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  8001bb:	00 00 00 
+  8001be:	ff d1                	call   *%rcx
+          exit();
+  8001c0:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+        }
+        if (fd != 0) {
+  8001cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001d0:	0f 84 79 02 00 00    	je     80044f <runcmd+0x41d>
+          dup(fd, 0);
+  8001d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001de:	89 c7                	mov    %eax,%edi
+  8001e0:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+          close(fd);
+  8001ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001ef:	89 c7                	mov    %eax,%edi
+  8001f1:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+        }
+        break;
+  8001fd:	e9 4d 02 00 00       	jmp    80044f <runcmd+0x41d>
+
+      case '>': // Output redirection
+        // Grab the filename from the argument list
+        if (gettoken(0, &t) != 'w') {
+  800202:	48 8d 85 58 ff ff ff 	lea    -0xa8(%rbp),%rax
+  800209:	48 89 c6             	mov    %rax,%rsi
+  80020c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800211:	48 b8 a2 06 80 00 00 	movabs $0x8006a2,%rax
+  800218:	00 00 00 
+  80021b:	ff d0                	call   *%rax
+  80021d:	83 f8 77             	cmp    $0x77,%eax
+  800220:	74 2a                	je     80024c <runcmd+0x21a>
+          cprintf("syntax error: > not followed by word\n");
+  800222:	48 b8 18 83 80 00 00 	movabs $0x808318,%rax
+  800229:	00 00 00 
+  80022c:	48 89 c7             	mov    %rax,%rdi
+  80022f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800234:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  80023b:	00 00 00 
+  80023e:	ff d2                	call   *%rdx
+          exit();
+  800240:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+        }
+        if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  80024c:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800253:	be 01 03 00 00       	mov    $0x301,%esi
+  800258:	48 89 c7             	mov    %rax,%rdi
+  80025b:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+  800267:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80026a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80026e:	79 37                	jns    8002a7 <runcmd+0x275>
+          cprintf("open %s for write: %i", t, fd);
+  800270:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800277:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80027a:	48 89 c6             	mov    %rax,%rsi
+  80027d:	48 b8 3e 83 80 00 00 	movabs $0x80833e,%rax
+  800284:	00 00 00 
+  800287:	48 89 c7             	mov    %rax,%rdi
+  80028a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028f:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  800296:	00 00 00 
+  800299:	ff d1                	call   *%rcx
+          exit();
+  80029b:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+        }
+        if (fd != 1) {
+  8002a7:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  8002ab:	0f 84 a4 01 00 00    	je     800455 <runcmd+0x423>
+          dup(fd, 1);
+  8002b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8002b9:	89 c7                	mov    %eax,%edi
+  8002bb:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  8002c2:	00 00 00 
+  8002c5:	ff d0                	call   *%rax
+          close(fd);
+  8002c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ca:	89 c7                	mov    %eax,%edi
+  8002cc:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+        }
+        break;
+  8002d8:	e9 78 01 00 00       	jmp    800455 <runcmd+0x423>
+
+      case '|': // Pipe
+        if ((r = pipe(p)) < 0) {
+  8002dd:	48 8d 85 48 fb ff ff 	lea    -0x4b8(%rbp),%rax
+  8002e4:	48 89 c7             	mov    %rax,%rdi
+  8002e7:	48 b8 9f 67 80 00 00 	movabs $0x80679f,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8002f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8002fa:	79 2f                	jns    80032b <runcmd+0x2f9>
+          cprintf("pipe: %i", r);
+  8002fc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8002ff:	89 c6                	mov    %eax,%esi
+  800301:	48 b8 54 83 80 00 00 	movabs $0x808354,%rax
+  800308:	00 00 00 
+  80030b:	48 89 c7             	mov    %rax,%rdi
+  80030e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800313:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  80031a:	00 00 00 
+  80031d:	ff d2                	call   *%rdx
+          exit();
+  80031f:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800326:	00 00 00 
+  800329:	ff d0                	call   *%rax
+        }
+        if (debug)
+          cprintf("PIPE: %d %d\n", p[0], p[1]);
+        if ((r = fork()) < 0) {
+  80032b:	48 b8 0f 3f 80 00 00 	movabs $0x803f0f,%rax
+  800332:	00 00 00 
+  800335:	ff d0                	call   *%rax
+  800337:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80033a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80033e:	79 2f                	jns    80036f <runcmd+0x33d>
+          cprintf("fork: %i", r);
+  800340:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800343:	89 c6                	mov    %eax,%esi
+  800345:	48 b8 5d 83 80 00 00 	movabs $0x80835d,%rax
+  80034c:	00 00 00 
+  80034f:	48 89 c7             	mov    %rax,%rdi
+  800352:	b8 00 00 00 00       	mov    $0x0,%eax
+  800357:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  80035e:	00 00 00 
+  800361:	ff d2                	call   *%rdx
+          exit();
+  800363:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80036a:	00 00 00 
+  80036d:	ff d0                	call   *%rax
+        }
+        if (r == 0) {
+  80036f:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800373:	75 50                	jne    8003c5 <runcmd+0x393>
+          if (p[0] != 0) {
+  800375:	8b 85 48 fb ff ff    	mov    -0x4b8(%rbp),%eax
+  80037b:	85 c0                	test   %eax,%eax
+  80037d:	74 2d                	je     8003ac <runcmd+0x37a>
+            dup(p[0], 0);
+  80037f:	8b 85 48 fb ff ff    	mov    -0x4b8(%rbp),%eax
+  800385:	be 00 00 00 00       	mov    $0x0,%esi
+  80038a:	89 c7                	mov    %eax,%edi
+  80038c:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  800393:	00 00 00 
+  800396:	ff d0                	call   *%rax
+            close(p[0]);
+  800398:	8b 85 48 fb ff ff    	mov    -0x4b8(%rbp),%eax
+  80039e:	89 c7                	mov    %eax,%edi
+  8003a0:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+          }
+          close(p[1]);
+  8003ac:	8b 85 4c fb ff ff    	mov    -0x4b4(%rbp),%eax
+  8003b2:	89 c7                	mov    %eax,%edi
+  8003b4:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8003bb:	00 00 00 
+  8003be:	ff d0                	call   *%rax
+          goto again;
+  8003c0:	e9 a1 fc ff ff       	jmp    800066 <runcmd+0x34>
+        } else {
+          pipe_child = r;
+  8003c5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8003c8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+          if (p[1] != 1) {
+  8003cb:	8b 85 4c fb ff ff    	mov    -0x4b4(%rbp),%eax
+  8003d1:	83 f8 01             	cmp    $0x1,%eax
+  8003d4:	74 2d                	je     800403 <runcmd+0x3d1>
+            dup(p[1], 1);
+  8003d6:	8b 85 4c fb ff ff    	mov    -0x4b4(%rbp),%eax
+  8003dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e1:	89 c7                	mov    %eax,%edi
+  8003e3:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  8003ea:	00 00 00 
+  8003ed:	ff d0                	call   *%rax
+            close(p[1]);
+  8003ef:	8b 85 4c fb ff ff    	mov    -0x4b4(%rbp),%eax
+  8003f5:	89 c7                	mov    %eax,%edi
+  8003f7:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8003fe:	00 00 00 
+  800401:	ff d0                	call   *%rax
+          }
+          close(p[0]);
+  800403:	8b 85 48 fb ff ff    	mov    -0x4b8(%rbp),%eax
+  800409:	89 c7                	mov    %eax,%edi
+  80040b:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+          goto runit;
+  800417:	eb 43                	jmp    80045c <runcmd+0x42a>
+      case 0: // String is complete
+        // Run the current command!
+        goto runit;
+
+      default:
+        panic("bad return %d from gettoken", c);
+  800419:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80041c:	89 c1                	mov    %eax,%ecx
+  80041e:	48 b8 66 83 80 00 00 	movabs $0x808366,%rax
+  800425:	00 00 00 
+  800428:	48 89 c2             	mov    %rax,%rdx
+  80042b:	be 73 00 00 00       	mov    $0x73,%esi
+  800430:	48 b8 82 83 80 00 00 	movabs $0x808382,%rax
+  800437:	00 00 00 
+  80043a:	48 89 c7             	mov    %rax,%rdi
+  80043d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800442:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  800449:	00 00 00 
+  80044c:	41 ff d0             	call   *%r8
+        break;
+  80044f:	90                   	nop
+  800450:	e9 18 fc ff ff       	jmp    80006d <runcmd+0x3b>
+        break;
+  800455:	90                   	nop
+    switch ((c = gettoken(0, &t))) {
+  800456:	e9 12 fc ff ff       	jmp    80006d <runcmd+0x3b>
+        goto runit;
+  80045b:	90                   	nop
+    }
+  }
+
+runit:
+  // Return immediately if command line was empty.
+  if (argc == 0) {
+  80045c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800460:	0f 84 f4 00 00 00    	je     80055a <runcmd+0x528>
+
+  // Clean up command line.
+  // Read all commands from the filesystem: add an initial '/' to
+  // the command name.
+  // This essentially acts like 'PATH=/'.
+  if (argv[0][0] != '/') {
+  800466:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  80046d:	0f b6 00             	movzbl (%rax),%eax
+  800470:	3c 2f                	cmp    $0x2f,%al
+  800472:	74 39                	je     8004ad <runcmd+0x47b>
+    argv0buf[0] = '/';
+  800474:	c6 85 50 fb ff ff 2f 	movb   $0x2f,-0x4b0(%rbp)
+    strcpy(argv0buf + 1, argv[0]);
+  80047b:	48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+  800482:	48 8d 85 50 fb ff ff 	lea    -0x4b0(%rbp),%rax
+  800489:	48 83 c0 01          	add    $0x1,%rax
+  80048d:	48 89 d6             	mov    %rdx,%rsi
+  800490:	48 89 c7             	mov    %rax,%rdi
+  800493:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+    argv[0] = argv0buf;
+  80049f:	48 8d 85 50 fb ff ff 	lea    -0x4b0(%rbp),%rax
+  8004a6:	48 89 85 60 ff ff ff 	mov    %rax,-0xa0(%rbp)
+  }
+  argv[argc] = 0;
+  8004ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004b0:	48 98                	cltq
+  8004b2:	48 c7 84 c5 60 ff ff 	movq   $0x0,-0xa0(%rbp,%rax,8)
+  8004b9:	ff 00 00 00 00 
+      cprintf(" %s", argv[i]);
+    cprintf("\n");
+  }
+
+  // Spawn the command!
+  if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8004be:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8004c5:	48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+  8004cc:	48 89 d6             	mov    %rdx,%rsi
+  8004cf:	48 89 c7             	mov    %rax,%rdi
+  8004d2:	48 b8 64 5a 80 00 00 	movabs $0x805a64,%rax
+  8004d9:	00 00 00 
+  8004dc:	ff d0                	call   *%rax
+  8004de:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8004e1:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8004e5:	79 2b                	jns    800512 <runcmd+0x4e0>
+    cprintf("spawn %s: %i\n", argv[0], r);
+  8004e7:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8004ee:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8004f1:	48 89 c6             	mov    %rax,%rsi
+  8004f4:	48 b8 8c 83 80 00 00 	movabs $0x80838c,%rax
+  8004fb:	00 00 00 
+  8004fe:	48 89 c7             	mov    %rax,%rdi
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  80050d:	00 00 00 
+  800510:	ff d1                	call   *%rcx
+
+  // In the parent, close all file descriptors and wait for the
+  // spawned command to exit.
+  close_all();
+  800512:	48 b8 0f 46 80 00 00 	movabs $0x80460f,%rax
+  800519:	00 00 00 
+  80051c:	ff d0                	call   *%rax
+  if (r >= 0) {
+  80051e:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  800522:	78 11                	js     800535 <runcmd+0x503>
+    if (debug)
+      cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+    wait(r);
+  800524:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800527:	89 c7                	mov    %eax,%edi
+  800529:	48 b8 ec 72 80 00 00 	movabs $0x8072ec,%rax
+  800530:	00 00 00 
+  800533:	ff d0                	call   *%rax
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  }
+
+  // If we were the left-hand part of a pipe,
+  // wait for the right-hand part to finish.
+  if (pipe_child) {
+  800535:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800539:	74 11                	je     80054c <runcmd+0x51a>
+    if (debug)
+      cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+    wait(pipe_child);
+  80053b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80053e:	89 c7                	mov    %eax,%edi
+  800540:	48 b8 ec 72 80 00 00 	movabs $0x8072ec,%rax
+  800547:	00 00 00 
+  80054a:	ff d0                	call   *%rax
+    if (debug)
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  }
+
+  // Done!
+  exit();
+  80054c:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800553:	00 00 00 
+  800556:	ff d0                	call   *%rax
+  800558:	eb 01                	jmp    80055b <runcmd+0x529>
+    return;
+  80055a:	90                   	nop
+}
+  80055b:	c9                   	leave
+  80055c:	c3                   	ret
+
+000000000080055d <_gettoken>:
+// words get nul-terminated.
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS    "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	48 83 ec 30          	sub    $0x30,%rsp
+  800565:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800569:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80056d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int t;
+
+  if (s == 0) {
+  800571:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800576:	75 0a                	jne    800582 <_gettoken+0x25>
+    if (debug > 1)
+      cprintf("GETTOKEN NULL\n");
+    return 0;
+  800578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057d:	e9 1e 01 00 00       	jmp    8006a0 <_gettoken+0x143>
+  }
+
+  if (debug > 1)
+    cprintf("GETTOKEN: %s\n", s);
+
+  *p1 = 0;
+  800582:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800586:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  *p2 = 0;
+  80058d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800591:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+
+  while (strchr(WHITESPACE, *s))
+  800598:	eb 0f                	jmp    8005a9 <_gettoken+0x4c>
+    *s++ = 0;
+  80059a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80059e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8005a6:	c6 00 00             	movb   $0x0,(%rax)
+  while (strchr(WHITESPACE, *s))
+  8005a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ad:	0f b6 00             	movzbl (%rax),%eax
+  8005b0:	0f be c0             	movsbl %al,%eax
+  8005b3:	89 c6                	mov    %eax,%esi
+  8005b5:	48 b8 9a 83 80 00 00 	movabs $0x80839a,%rax
+  8005bc:	00 00 00 
+  8005bf:	48 89 c7             	mov    %rax,%rdi
+  8005c2:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+  8005ce:	48 85 c0             	test   %rax,%rax
+  8005d1:	75 c7                	jne    80059a <_gettoken+0x3d>
+  if (*s == 0) {
+  8005d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005d7:	0f b6 00             	movzbl (%rax),%eax
+  8005da:	84 c0                	test   %al,%al
+  8005dc:	75 0a                	jne    8005e8 <_gettoken+0x8b>
+    if (debug > 1)
+      cprintf("EOL\n");
+    return 0;
+  8005de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e3:	e9 b8 00 00 00       	jmp    8006a0 <_gettoken+0x143>
+  }
+  if (strchr(SYMBOLS, *s)) {
+  8005e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ec:	0f b6 00             	movzbl (%rax),%eax
+  8005ef:	0f be c0             	movsbl %al,%eax
+  8005f2:	89 c6                	mov    %eax,%esi
+  8005f4:	48 b8 9f 83 80 00 00 	movabs $0x80839f,%rax
+  8005fb:	00 00 00 
+  8005fe:	48 89 c7             	mov    %rax,%rdi
+  800601:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  800608:	00 00 00 
+  80060b:	ff d0                	call   *%rax
+  80060d:	48 85 c0             	test   %rax,%rax
+  800610:	74 37                	je     800649 <_gettoken+0xec>
+    t    = *s;
+  800612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800616:	0f b6 00             	movzbl (%rax),%eax
+  800619:	0f be c0             	movsbl %al,%eax
+  80061c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    *p1  = s;
+  80061f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800623:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800627:	48 89 10             	mov    %rdx,(%rax)
+    *s++ = 0;
+  80062a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80062e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800632:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800636:	c6 00 00             	movb   $0x0,(%rax)
+    *p2  = s;
+  800639:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80063d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800641:	48 89 10             	mov    %rdx,(%rax)
+    if (debug > 1)
+      cprintf("TOK %c\n", t);
+    return t;
+  800644:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800647:	eb 57                	jmp    8006a0 <_gettoken+0x143>
+  }
+  *p1 = s;
+  800649:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80064d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800651:	48 89 10             	mov    %rdx,(%rax)
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800654:	eb 05                	jmp    80065b <_gettoken+0xfe>
+    s++;
+  800656:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80065b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065f:	0f b6 00             	movzbl (%rax),%eax
+  800662:	84 c0                	test   %al,%al
+  800664:	74 2a                	je     800690 <_gettoken+0x133>
+  800666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066a:	0f b6 00             	movzbl (%rax),%eax
+  80066d:	0f be c0             	movsbl %al,%eax
+  800670:	89 c6                	mov    %eax,%esi
+  800672:	48 b8 a7 83 80 00 00 	movabs $0x8083a7,%rax
+  800679:	00 00 00 
+  80067c:	48 89 c7             	mov    %rax,%rdi
+  80067f:	48 b8 37 23 80 00 00 	movabs $0x802337,%rax
+  800686:	00 00 00 
+  800689:	ff d0                	call   *%rax
+  80068b:	48 85 c0             	test   %rax,%rax
+  80068e:	74 c6                	je     800656 <_gettoken+0xf9>
+  *p2 = s;
+  800690:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800694:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800698:	48 89 10             	mov    %rdx,(%rax)
+    t    = **p2;
+    **p2 = 0;
+    cprintf("WORD: %s\n", *p1);
+    **p2 = t;
+  }
+  return 'w';
+  80069b:	b8 77 00 00 00       	mov    $0x77,%eax
+}
+  8006a0:	c9                   	leave
+  8006a1:	c3                   	ret
+
+00000000008006a2 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  8006a2:	55                   	push   %rbp
+  8006a3:	48 89 e5             	mov    %rsp,%rbp
+  8006a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8006aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static int c, nc;
+  static char *np1, *np2;
+
+  if (s) {
+  8006b2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8006b7:	74 3d                	je     8006f6 <gettoken+0x54>
+    nc = _gettoken(s, &np1, &np2);
+  8006b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006bd:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  8006c4:	00 00 00 
+  8006c7:	48 b9 00 a0 80 00 00 	movabs $0x80a000,%rcx
+  8006ce:	00 00 00 
+  8006d1:	48 89 ce             	mov    %rcx,%rsi
+  8006d4:	48 89 c7             	mov    %rax,%rdi
+  8006d7:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  8006de:	00 00 00 
+  8006e1:	ff d0                	call   *%rax
+  8006e3:	48 ba 10 a0 80 00 00 	movabs $0x80a010,%rdx
+  8006ea:	00 00 00 
+  8006ed:	89 02                	mov    %eax,(%rdx)
+    return 0;
+  8006ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f4:	eb 77                	jmp    80076d <gettoken+0xcb>
+  }
+  c   = nc;
+  8006f6:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  8006fd:	00 00 00 
+  800700:	8b 00                	mov    (%rax),%eax
+  800702:	48 ba 14 a0 80 00 00 	movabs $0x80a014,%rdx
+  800709:	00 00 00 
+  80070c:	89 02                	mov    %eax,(%rdx)
+  *p1 = np1;
+  80070e:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  800715:	00 00 00 
+  800718:	48 8b 10             	mov    (%rax),%rdx
+  80071b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80071f:	48 89 10             	mov    %rdx,(%rax)
+  nc  = _gettoken(np2, &np1, &np2);
+  800722:	48 b8 08 a0 80 00 00 	movabs $0x80a008,%rax
+  800729:	00 00 00 
+  80072c:	48 8b 00             	mov    (%rax),%rax
+  80072f:	48 ba 08 a0 80 00 00 	movabs $0x80a008,%rdx
+  800736:	00 00 00 
+  800739:	48 b9 00 a0 80 00 00 	movabs $0x80a000,%rcx
+  800740:	00 00 00 
+  800743:	48 89 ce             	mov    %rcx,%rsi
+  800746:	48 89 c7             	mov    %rax,%rdi
+  800749:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	48 ba 10 a0 80 00 00 	movabs $0x80a010,%rdx
+  80075c:	00 00 00 
+  80075f:	89 02                	mov    %eax,(%rdx)
+  return c;
+  800761:	48 b8 14 a0 80 00 00 	movabs $0x80a014,%rax
+  800768:	00 00 00 
+  80076b:	8b 00                	mov    (%rax),%eax
+}
+  80076d:	c9                   	leave
+  80076e:	c3                   	ret
+
+000000000080076f <usage>:
+
+void
+usage(void) {
+  80076f:	55                   	push   %rbp
+  800770:	48 89 e5             	mov    %rsp,%rbp
+  cprintf("usage: sh [-dix] [command-file]\n");
+  800773:	48 b8 b8 83 80 00 00 	movabs $0x8083b8,%rax
+  80077a:	00 00 00 
+  80077d:	48 89 c7             	mov    %rax,%rdi
+  800780:	b8 00 00 00 00       	mov    $0x0,%eax
+  800785:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  80078c:	00 00 00 
+  80078f:	ff d2                	call   *%rdx
+  exit();
+  800791:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800798:	00 00 00 
+  80079b:	ff d0                	call   *%rax
+}
+  80079d:	90                   	nop
+  80079e:	5d                   	pop    %rbp
+  80079f:	c3                   	ret
+
+00000000008007a0 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8007a0:	55                   	push   %rbp
+  8007a1:	48 89 e5             	mov    %rsp,%rbp
+  8007a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8007a8:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8007ab:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r, interactive, echocmds;
+  struct Argstate args;
+
+  interactive = '?';
+  8007af:	c7 45 fc 3f 00 00 00 	movl   $0x3f,-0x4(%rbp)
+  echocmds    = 0;
+  8007b6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  argstart(&argc, argv, &args);
+  8007bd:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8007c1:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8007c5:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+  8007c9:	48 89 ce             	mov    %rcx,%rsi
+  8007cc:	48 89 c7             	mov    %rax,%rdi
+  8007cf:	48 b8 3d 3f 80 00 00 	movabs $0x803f3d,%rax
+  8007d6:	00 00 00 
+  8007d9:	ff d0                	call   *%rax
+  while ((r = argnext(&args)) >= 0)
+  8007db:	eb 39                	jmp    800816 <umain+0x76>
+    switch (r) {
+  8007dd:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  8007e1:	74 1b                	je     8007fe <umain+0x5e>
+  8007e3:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  8007e7:	7f 1e                	jg     800807 <umain+0x67>
+  8007e9:	83 7d f4 64          	cmpl   $0x64,-0xc(%rbp)
+  8007ed:	74 26                	je     800815 <umain+0x75>
+  8007ef:	83 7d f4 69          	cmpl   $0x69,-0xc(%rbp)
+  8007f3:	75 12                	jne    800807 <umain+0x67>
+      case 'd':
+        break;
+      case 'i':
+        interactive = 1;
+  8007f5:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+        break;
+  8007fc:	eb 18                	jmp    800816 <umain+0x76>
+      case 'x':
+        echocmds = 1;
+  8007fe:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+        break;
+  800805:	eb 0f                	jmp    800816 <umain+0x76>
+      default:
+        usage();
+  800807:	48 b8 6f 07 80 00 00 	movabs $0x80076f,%rax
+  80080e:	00 00 00 
+  800811:	ff d0                	call   *%rax
+  800813:	eb 01                	jmp    800816 <umain+0x76>
+        break;
+  800815:	90                   	nop
+  while ((r = argnext(&args)) >= 0)
+  800816:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80081a:	48 89 c7             	mov    %rax,%rdi
+  80081d:	48 b8 a2 3f 80 00 00 	movabs $0x803fa2,%rax
+  800824:	00 00 00 
+  800827:	ff d0                	call   *%rax
+  800829:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80082c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800830:	79 ab                	jns    8007dd <umain+0x3d>
+    }
+
+  if (argc > 2)
+  800832:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800835:	83 f8 02             	cmp    $0x2,%eax
+  800838:	7e 0c                	jle    800846 <umain+0xa6>
+    usage();
+  80083a:	48 b8 6f 07 80 00 00 	movabs $0x80076f,%rax
+  800841:	00 00 00 
+  800844:	ff d0                	call   *%rax
+  if (argc == 2) {
+  800846:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800849:	83 f8 02             	cmp    $0x2,%eax
+  80084c:	0f 85 c2 00 00 00    	jne    800914 <umain+0x174>
+    close(0);
+  800852:	bf 00 00 00 00       	mov    $0x0,%edi
+  800857:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  80085e:	00 00 00 
+  800861:	ff d0                	call   *%rax
+    if ((r = open(argv[1], O_RDONLY)) < 0)
+  800863:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800867:	48 83 c0 08          	add    $0x8,%rax
+  80086b:	48 8b 00             	mov    (%rax),%rax
+  80086e:	be 00 00 00 00       	mov    $0x0,%esi
+  800873:	48 89 c7             	mov    %rax,%rdi
+  800876:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  80087d:	00 00 00 
+  800880:	ff d0                	call   *%rax
+  800882:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800885:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800889:	79 45                	jns    8008d0 <umain+0x130>
+      panic("open %s: %i", argv[1], r);
+  80088b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80088f:	48 83 c0 08          	add    $0x8,%rax
+  800893:	48 8b 00             	mov    (%rax),%rax
+  800896:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800899:	41 89 d0             	mov    %edx,%r8d
+  80089c:	48 89 c1             	mov    %rax,%rcx
+  80089f:	48 b8 d9 83 80 00 00 	movabs $0x8083d9,%rax
+  8008a6:	00 00 00 
+  8008a9:	48 89 c2             	mov    %rax,%rdx
+  8008ac:	be 1b 01 00 00       	mov    $0x11b,%esi
+  8008b1:	48 b8 82 83 80 00 00 	movabs $0x808382,%rax
+  8008b8:	00 00 00 
+  8008bb:	48 89 c7             	mov    %rax,%rdi
+  8008be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c3:	49 b9 59 0e 80 00 00 	movabs $0x800e59,%r9
+  8008ca:	00 00 00 
+  8008cd:	41 ff d1             	call   *%r9
+    assert(r == 0);
+  8008d0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008d4:	74 3e                	je     800914 <umain+0x174>
+  8008d6:	48 b8 e5 83 80 00 00 	movabs $0x8083e5,%rax
+  8008dd:	00 00 00 
+  8008e0:	48 89 c1             	mov    %rax,%rcx
+  8008e3:	48 b8 ec 83 80 00 00 	movabs $0x8083ec,%rax
+  8008ea:	00 00 00 
+  8008ed:	48 89 c2             	mov    %rax,%rdx
+  8008f0:	be 1c 01 00 00       	mov    $0x11c,%esi
+  8008f5:	48 b8 82 83 80 00 00 	movabs $0x808382,%rax
+  8008fc:	00 00 00 
+  8008ff:	48 89 c7             	mov    %rax,%rdi
+  800902:	b8 00 00 00 00       	mov    $0x0,%eax
+  800907:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  80090e:	00 00 00 
+  800911:	41 ff d0             	call   *%r8
+  }
+  if (interactive == '?')
+  800914:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  800918:	75 14                	jne    80092e <umain+0x18e>
+    interactive = iscons(0);
+  80091a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80091f:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800926:	00 00 00 
+  800929:	ff d0                	call   *%rax
+  80092b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  while (1) {
+    char *buf;
+
+    buf = readline(interactive ? "$ " : NULL);
+  80092e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800932:	74 0c                	je     800940 <umain+0x1a0>
+  800934:	48 b8 01 84 80 00 00 	movabs $0x808401,%rax
+  80093b:	00 00 00 
+  80093e:	eb 05                	jmp    800945 <umain+0x1a5>
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+  800945:	48 89 c7             	mov    %rax,%rdi
+  800948:	48 b8 07 2c 80 00 00 	movabs $0x802c07,%rax
+  80094f:	00 00 00 
+  800952:	ff d0                	call   *%rax
+  800954:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if (buf == NULL) {
+  800958:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80095d:	75 0c                	jne    80096b <umain+0x1cb>
+      if (debug)
+        cprintf("EXITING\n");
+      exit(); // end of file
+  80095f:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800966:	00 00 00 
+  800969:	ff d0                	call   *%rax
+    }
+    if (debug)
+      cprintf("LINE: %s\n", buf);
+    if (buf[0] == '#')
+  80096b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096f:	0f b6 00             	movzbl (%rax),%eax
+  800972:	3c 23                	cmp    $0x23,%al
+  800974:	0f 84 b6 00 00 00    	je     800a30 <umain+0x290>
+      continue;
+    if (echocmds)
+  80097a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80097e:	74 25                	je     8009a5 <umain+0x205>
+      printf("# %s\n", buf);
+  800980:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800984:	48 89 c6             	mov    %rax,%rsi
+  800987:	48 b8 04 84 80 00 00 	movabs $0x808404,%rax
+  80098e:	00 00 00 
+  800991:	48 89 c7             	mov    %rax,%rdi
+  800994:	b8 00 00 00 00       	mov    $0x0,%eax
+  800999:	48 ba ae 59 80 00 00 	movabs $0x8059ae,%rdx
+  8009a0:	00 00 00 
+  8009a3:	ff d2                	call   *%rdx
+    if (debug)
+      cprintf("BEFORE FORK\n");
+    if ((r = fork()) < 0)
+  8009a5:	48 b8 0f 3f 80 00 00 	movabs $0x803f0f,%rax
+  8009ac:	00 00 00 
+  8009af:	ff d0                	call   *%rax
+  8009b1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8009b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009b8:	79 36                	jns    8009f0 <umain+0x250>
+      panic("fork: %i", r);
+  8009ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8009bd:	89 c1                	mov    %eax,%ecx
+  8009bf:	48 b8 5d 83 80 00 00 	movabs $0x80835d,%rax
+  8009c6:	00 00 00 
+  8009c9:	48 89 c2             	mov    %rax,%rdx
+  8009cc:	be 33 01 00 00       	mov    $0x133,%esi
+  8009d1:	48 b8 82 83 80 00 00 	movabs $0x808382,%rax
+  8009d8:	00 00 00 
+  8009db:	48 89 c7             	mov    %rax,%rdi
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e3:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  8009ea:	00 00 00 
+  8009ed:	41 ff d0             	call   *%r8
+    if (debug)
+      cprintf("FORK: %d\n", r);
+    if (r == 0) {
+  8009f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009f4:	75 24                	jne    800a1a <umain+0x27a>
+      runcmd(buf);
+  8009f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fa:	48 89 c7             	mov    %rax,%rdi
+  8009fd:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800a04:	00 00 00 
+  800a07:	ff d0                	call   *%rax
+      exit();
+  800a09:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800a10:	00 00 00 
+  800a13:	ff d0                	call   *%rax
+  800a15:	e9 14 ff ff ff       	jmp    80092e <umain+0x18e>
+    } else
+      wait(r);
+  800a1a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800a1d:	89 c7                	mov    %eax,%edi
+  800a1f:	48 b8 ec 72 80 00 00 	movabs $0x8072ec,%rax
+  800a26:	00 00 00 
+  800a29:	ff d0                	call   *%rax
+  800a2b:	e9 fe fe ff ff       	jmp    80092e <umain+0x18e>
+      continue;
+  800a30:	90                   	nop
+  while (1) {
+  800a31:	e9 f8 fe ff ff       	jmp    80092e <umain+0x18e>
+
+0000000000800a36 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  800a36:	55                   	push   %rbp
+  800a37:	48 89 e5             	mov    %rsp,%rbp
+  800a3a:	48 83 ec 20          	sub    $0x20,%rsp
+  800a3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  800a41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800a44:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  800a47:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  800a4b:	be 01 00 00 00       	mov    $0x1,%esi
+  800a50:	48 89 c7             	mov    %rax,%rdi
+  800a53:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  800a5a:	00 00 00 
+  800a5d:	ff d0                	call   *%rax
+}
+  800a5f:	90                   	nop
+  800a60:	c9                   	leave
+  800a61:	c3                   	ret
+
+0000000000800a62 <getchar>:
+
+int
+getchar(void) {
+  800a62:	55                   	push   %rbp
+  800a63:	48 89 e5             	mov    %rsp,%rbp
+  800a66:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  800a6a:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  800a6e:	ba 01 00 00 00       	mov    $0x1,%edx
+  800a73:	48 89 c6             	mov    %rax,%rsi
+  800a76:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a7b:	48 b8 ab 48 80 00 00 	movabs $0x8048ab,%rax
+  800a82:	00 00 00 
+  800a85:	ff d0                	call   *%rax
+  800a87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  800a8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800a8e:	79 05                	jns    800a95 <getchar+0x33>
+    return r;
+  800a90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a93:	eb 14                	jmp    800aa9 <getchar+0x47>
+  if (r < 1)
+  800a95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800a99:	7f 07                	jg     800aa2 <getchar+0x40>
+    return -E_EOF;
+  800a9b:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800aa0:	eb 07                	jmp    800aa9 <getchar+0x47>
+  return c;
+  800aa2:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  800aa6:	0f b6 c0             	movzbl %al,%eax
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  800aab:	55                   	push   %rbp
+  800aac:	48 89 e5             	mov    %rsp,%rbp
+  800aaf:	48 83 ec 20          	sub    $0x20,%rsp
+  800ab3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ab6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800aba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800abd:	48 89 d6             	mov    %rdx,%rsi
+  800ac0:	89 c7                	mov    %eax,%edi
+  800ac2:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  800ac9:	00 00 00 
+  800acc:	ff d0                	call   *%rax
+  800ace:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ad1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ad5:	79 05                	jns    800adc <iscons+0x31>
+    return r;
+  800ad7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ada:	eb 1a                	jmp    800af6 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  800adc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ae0:	8b 10                	mov    (%rax),%edx
+  800ae2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800ae9:	00 00 00 
+  800aec:	8b 00                	mov    (%rax),%eax
+  800aee:	39 c2                	cmp    %eax,%edx
+  800af0:	0f 94 c0             	sete   %al
+  800af3:	0f b6 c0             	movzbl %al,%eax
+}
+  800af6:	c9                   	leave
+  800af7:	c3                   	ret
+
+0000000000800af8 <opencons>:
+
+int
+opencons(void) {
+  800af8:	55                   	push   %rbp
+  800af9:	48 89 e5             	mov    %rsp,%rbp
+  800afc:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  800b00:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800b04:	48 89 c7             	mov    %rax,%rdi
+  800b07:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  800b0e:	00 00 00 
+  800b11:	ff d0                	call   *%rax
+  800b13:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800b16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800b1a:	79 05                	jns    800b21 <opencons+0x29>
+    return r;
+  800b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b1f:	eb 66                	jmp    800b87 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  800b21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b25:	ba 07 04 00 00       	mov    $0x407,%edx
+  800b2a:	48 89 c6             	mov    %rax,%rsi
+  800b2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b32:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  800b39:	00 00 00 
+  800b3c:	ff d0                	call   *%rax
+  800b3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800b41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800b45:	79 05                	jns    800b4c <opencons+0x54>
+    return r;
+  800b47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800b4a:	eb 3b                	jmp    800b87 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  800b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b50:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  800b57:	00 00 00 
+  800b5a:	8b 12                	mov    (%rdx),%edx
+  800b5c:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  800b5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b62:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  800b69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  800b74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b78:	48 89 c7             	mov    %rax,%rdi
+  800b7b:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  800b82:	00 00 00 
+  800b85:	ff d0                	call   *%rax
+}
+  800b87:	c9                   	leave
+  800b88:	c3                   	ret
+
+0000000000800b89 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  800b89:	55                   	push   %rbp
+  800b8a:	48 89 e5             	mov    %rsp,%rbp
+  800b8d:	48 83 ec 20          	sub    $0x20,%rsp
+  800b91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800b94:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b97:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800b9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800b9e:	48 89 d6             	mov    %rdx,%rsi
+  800ba1:	89 c7                	mov    %eax,%edi
+  800ba3:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  800baa:	00 00 00 
+  800bad:	ff d0                	call   *%rax
+  800baf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800bb2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800bb6:	79 05                	jns    800bbd <consmode+0x34>
+    return r;
+  800bb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800bbb:	eb 34                	jmp    800bf1 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  800bbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bc1:	8b 10                	mov    (%rax),%edx
+  800bc3:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800bca:	00 00 00 
+  800bcd:	8b 00                	mov    (%rax),%eax
+  800bcf:	39 c2                	cmp    %eax,%edx
+  800bd1:	74 07                	je     800bda <consmode+0x51>
+    return -E_INVAL;
+  800bd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd8:	eb 17                	jmp    800bf1 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  800bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bde:	8b 40 0c             	mov    0xc(%rax),%eax
+  800be1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  800be4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800be8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800beb:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  800bee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800bf3:	55                   	push   %rbp
+  800bf4:	48 89 e5             	mov    %rsp,%rbp
+  800bf7:	48 83 ec 20          	sub    $0x20,%rsp
+  800bfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800bff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800c03:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  800c07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c0b:	8b 50 0c             	mov    0xc(%rax),%edx
+  800c0e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c16:	48 89 ce             	mov    %rcx,%rsi
+  800c19:	48 89 c7             	mov    %rax,%rdi
+  800c1c:	48 b8 d0 33 80 00 00 	movabs $0x8033d0,%rax
+  800c23:	00 00 00 
+  800c26:	ff d0                	call   *%rax
+  800c28:	48 98                	cltq
+}
+  800c2a:	c9                   	leave
+  800c2b:	c3                   	ret
+
+0000000000800c2c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800c2c:	55                   	push   %rbp
+  800c2d:	48 89 e5             	mov    %rsp,%rbp
+  800c30:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800c37:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  800c3e:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  800c45:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  800c4c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800c53:	eb 74                	jmp    800cc9 <devcons_write+0x9d>
+    m = n - tot;
+  800c55:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800c5c:	89 c2                	mov    %eax,%edx
+  800c5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800c61:	29 c2                	sub    %eax,%edx
+  800c63:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  800c66:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800c69:	83 f8 7f             	cmp    $0x7f,%eax
+  800c6c:	76 07                	jbe    800c75 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  800c6e:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  800c75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800c78:	48 63 d0             	movslq %eax,%rdx
+  800c7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800c7e:	48 63 c8             	movslq %eax,%rcx
+  800c81:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  800c88:	48 01 c1             	add    %rax,%rcx
+  800c8b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  800c92:	48 89 ce             	mov    %rcx,%rsi
+  800c95:	48 89 c7             	mov    %rax,%rdi
+  800c98:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  800c9f:	00 00 00 
+  800ca2:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  800ca4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800ca7:	48 63 d0             	movslq %eax,%rdx
+  800caa:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  800cb1:	48 89 d6             	mov    %rdx,%rsi
+  800cb4:	48 89 c7             	mov    %rax,%rdi
+  800cb7:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  800cbe:	00 00 00 
+  800cc1:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  800cc3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800cc6:	01 45 fc             	add    %eax,-0x4(%rbp)
+  800cc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ccc:	48 98                	cltq
+  800cce:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  800cd5:	0f 82 7a ff ff ff    	jb     800c55 <devcons_write+0x29>
+  }
+  return tot;
+  800cdb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800cde:	48 98                	cltq
+}
+  800ce0:	c9                   	leave
+  800ce1:	c3                   	ret
+
+0000000000800ce2 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  800ce2:	55                   	push   %rbp
+  800ce3:	48 89 e5             	mov    %rsp,%rbp
+  800ce6:	48 83 ec 08          	sub    $0x8,%rsp
+  800cea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  800cee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf3:	c9                   	leave
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800cf5:	55                   	push   %rbp
+  800cf6:	48 89 e5             	mov    %rsp,%rbp
+  800cf9:	48 83 ec 10          	sub    $0x10,%rsp
+  800cfd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  800d05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d09:	48 ba 0f 84 80 00 00 	movabs $0x80840f,%rdx
+  800d10:	00 00 00 
+  800d13:	48 89 d6             	mov    %rdx,%rsi
+  800d16:	48 89 c7             	mov    %rax,%rdi
+  800d19:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  800d20:	00 00 00 
+  800d23:	ff d0                	call   *%rax
+  return 0;
+  800d25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d2a:	c9                   	leave
+  800d2b:	c3                   	ret
+
+0000000000800d2c <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  800d2c:	55                   	push   %rbp
+  800d2d:	48 89 e5             	mov    %rsp,%rbp
+  800d30:	48 83 ec 30          	sub    $0x30,%rsp
+  800d34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d38:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800d3b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  800d3f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  800d46:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800d49:	83 e0 02             	and    $0x2,%eax
+  800d4c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  800d4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d53:	8b 40 0c             	mov    0xc(%rax),%eax
+  800d56:	83 f8 01             	cmp    $0x1,%eax
+  800d59:	75 04                	jne    800d5f <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  800d5b:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  800d5f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800d62:	83 e0 01             	and    $0x1,%eax
+  800d65:	85 c0                	test   %eax,%eax
+  800d67:	74 44                	je     800dad <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  800d69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d71:	89 c2                	mov    %eax,%edx
+  800d73:	be 00 00 00 00       	mov    $0x0,%esi
+  800d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d7d:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  800d84:	00 00 00 
+  800d87:	ff d0                	call   *%rax
+  800d89:	83 f8 01             	cmp    $0x1,%eax
+  800d8c:	75 06                	jne    800d94 <devcons_poll+0x68>
+      revents |= POLLIN;
+  800d8e:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  800d92:	eb 19                	jmp    800dad <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  800d94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d98:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  800d9e:	0b 45 fc             	or     -0x4(%rbp),%eax
+  800da1:	89 c2                	mov    %eax,%edx
+  800da3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800da7:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  800dad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800db0:	c9                   	leave
+  800db1:	c3                   	ret
+
+0000000000800db2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800db2:	55                   	push   %rbp
+  800db3:	48 89 e5             	mov    %rsp,%rbp
+  800db6:	48 83 ec 20          	sub    $0x20,%rsp
+  800dba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800dbd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800dc1:	48 b8 00 91 80 00 00 	movabs $0x809100,%rax
+  800dc8:	00 00 00 
+  800dcb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800dcf:	eb 13                	jmp    800de4 <libmain+0x32>
+    (*ctor)();
+  800dd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800dd5:	48 8b 10             	mov    (%rax),%rdx
+  800dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddd:	ff d2                	call   *%rdx
+    ctor++;
+  800ddf:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800de4:	48 b8 00 91 80 00 00 	movabs $0x809100,%rax
+  800deb:	00 00 00 
+  800dee:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800df2:	72 dd                	jb     800dd1 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800df4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800df8:	7e 14                	jle    800e0e <libmain+0x5c>
+    binaryname = argv[0];
+  800dfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dfe:	48 8b 00             	mov    (%rax),%rax
+  800e01:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  800e08:	00 00 00 
+  800e0b:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800e0e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800e12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e15:	48 89 d6             	mov    %rdx,%rsi
+  800e18:	89 c7                	mov    %eax,%edi
+  800e1a:	48 b8 a0 07 80 00 00 	movabs $0x8007a0,%rax
+  800e21:	00 00 00 
+  800e24:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800e26:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800e2d:	00 00 00 
+  800e30:	ff d0                	call   *%rax
+#endif
+}
+  800e32:	90                   	nop
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+
+0000000000800e35 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800e35:	55                   	push   %rbp
+  800e36:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800e39:	48 b8 0f 46 80 00 00 	movabs $0x80460f,%rax
+  800e40:	00 00 00 
+  800e43:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800e45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4a:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  800e51:	00 00 00 
+  800e54:	ff d0                	call   *%rax
+}
+  800e56:	90                   	nop
+  800e57:	5d                   	pop    %rbp
+  800e58:	c3                   	ret
+
+0000000000800e59 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800e59:	55                   	push   %rbp
+  800e5a:	48 89 e5             	mov    %rsp,%rbp
+  800e5d:	53                   	push   %rbx
+  800e5e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800e65:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800e6c:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800e72:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800e79:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800e80:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800e87:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800e8e:	84 c0                	test   %al,%al
+  800e90:	74 23                	je     800eb5 <_panic+0x5c>
+  800e92:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800e99:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800e9d:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800ea1:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800ea5:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800ea9:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800ead:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800eb1:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800eb5:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800ebc:	00 00 00 
+  800ebf:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800ec6:	00 00 00 
+  800ec9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ecd:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800ed4:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800edb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800ee2:	48 b8 40 90 80 00 00 	movabs $0x809040,%rax
+  800ee9:	00 00 00 
+  800eec:	48 8b 18             	mov    (%rax),%rbx
+  800eef:	48 b8 fd 2f 80 00 00 	movabs $0x802ffd,%rax
+  800ef6:	00 00 00 
+  800ef9:	ff d0                	call   *%rax
+  800efb:	89 c6                	mov    %eax,%esi
+  800efd:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800f03:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800f0a:	41 89 d0             	mov    %edx,%r8d
+  800f0d:	48 89 c1             	mov    %rax,%rcx
+  800f10:	48 89 da             	mov    %rbx,%rdx
+  800f13:	48 b8 20 84 80 00 00 	movabs $0x808420,%rax
+  800f1a:	00 00 00 
+  800f1d:	48 89 c7             	mov    %rax,%rdi
+  800f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f25:	49 b9 78 10 80 00 00 	movabs $0x801078,%r9
+  800f2c:	00 00 00 
+  800f2f:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800f32:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800f39:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f40:	48 89 d6             	mov    %rdx,%rsi
+  800f43:	48 89 c7             	mov    %rax,%rdi
+  800f46:	48 b8 ed 0f 80 00 00 	movabs $0x800fed,%rax
+  800f4d:	00 00 00 
+  800f50:	ff d0                	call   *%rax
+  cprintf("\n");
+  800f52:	48 b8 43 84 80 00 00 	movabs $0x808443,%rax
+  800f59:	00 00 00 
+  800f5c:	48 89 c7             	mov    %rax,%rdi
+  800f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f64:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  800f6b:	00 00 00 
+  800f6e:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800f70:	cc                   	int3
+  800f71:	eb fd                	jmp    800f70 <_panic+0x117>
+
+0000000000800f73 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+  800f77:	48 83 ec 10          	sub    $0x10,%rsp
+  800f7b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800f82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f86:	8b 00                	mov    (%rax),%eax
+  800f88:	8d 48 01             	lea    0x1(%rax),%ecx
+  800f8b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f8f:	89 0a                	mov    %ecx,(%rdx)
+  800f91:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f94:	89 d1                	mov    %edx,%ecx
+  800f96:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f9a:	48 98                	cltq
+  800f9c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800fa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa4:	8b 00                	mov    (%rax),%eax
+  800fa6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800fab:	75 2c                	jne    800fd9 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800fad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb1:	8b 00                	mov    (%rax),%eax
+  800fb3:	48 98                	cltq
+  800fb5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fb9:	48 83 c2 08          	add    $0x8,%rdx
+  800fbd:	48 89 c6             	mov    %rax,%rsi
+  800fc0:	48 89 d7             	mov    %rdx,%rdi
+  800fc3:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  800fca:	00 00 00 
+  800fcd:	ff d0                	call   *%rax
+    b->idx = 0;
+  800fcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800fd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fdd:	8b 40 04             	mov    0x4(%rax),%eax
+  800fe0:	8d 50 01             	lea    0x1(%rax),%edx
+  800fe3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe7:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800fea:	90                   	nop
+  800feb:	c9                   	leave
+  800fec:	c3                   	ret
+
+0000000000800fed <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800fed:	55                   	push   %rbp
+  800fee:	48 89 e5             	mov    %rsp,%rbp
+  800ff1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800ff8:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800fff:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  801006:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80100d:	00 00 00 
+  b.cnt = 0;
+  801010:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  801017:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80101a:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  801021:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  801028:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80102f:	48 89 c6             	mov    %rax,%rsi
+  801032:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  801039:	00 00 00 
+  80103c:	48 89 c7             	mov    %rax,%rdi
+  80103f:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  801046:	00 00 00 
+  801049:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80104b:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  801051:	48 98                	cltq
+  801053:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80105a:	48 83 c2 08          	add    $0x8,%rdx
+  80105e:	48 89 c6             	mov    %rax,%rsi
+  801061:	48 89 d7             	mov    %rdx,%rdi
+  801064:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  80106b:	00 00 00 
+  80106e:	ff d0                	call   *%rax
+
+  return b.cnt;
+  801070:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  801076:	c9                   	leave
+  801077:	c3                   	ret
+
+0000000000801078 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801078:	55                   	push   %rbp
+  801079:	48 89 e5             	mov    %rsp,%rbp
+  80107c:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  801083:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80108a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  801091:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  801098:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80109f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010a6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010ad:	84 c0                	test   %al,%al
+  8010af:	74 20                	je     8010d1 <cprintf+0x59>
+  8010b1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010b5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010b9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010bd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010c1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010c5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010c9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010cd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8010d1:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8010d8:	00 00 00 
+  8010db:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8010e2:	00 00 00 
+  8010e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010e9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8010f0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010f7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8010fe:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  801105:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80110c:	48 89 d6             	mov    %rdx,%rsi
+  80110f:	48 89 c7             	mov    %rax,%rdi
+  801112:	48 b8 ed 0f 80 00 00 	movabs $0x800fed,%rax
+  801119:	00 00 00 
+  80111c:	ff d0                	call   *%rax
+  80111e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  801124:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+000000000080112c <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80112c:	55                   	push   %rbp
+  80112d:	48 89 e5             	mov    %rsp,%rbp
+  801130:	48 83 ec 30          	sub    $0x30,%rsp
+  801134:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801138:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80113c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801140:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  801143:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  801147:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80114b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80114e:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  801152:	72 54                	jb     8011a8 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  801154:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801157:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80115a:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80115d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801161:	ba 00 00 00 00       	mov    $0x0,%edx
+  801166:	48 f7 f6             	div    %rsi
+  801169:	49 89 c2             	mov    %rax,%r10
+  80116c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80116f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801172:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801176:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80117a:	41 89 c9             	mov    %ecx,%r9d
+  80117d:	41 89 f8             	mov    %edi,%r8d
+  801180:	89 d1                	mov    %edx,%ecx
+  801182:	4c 89 d2             	mov    %r10,%rdx
+  801185:	48 89 c7             	mov    %rax,%rdi
+  801188:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  80118f:	00 00 00 
+  801192:	ff d0                	call   *%rax
+  801194:	eb 1c                	jmp    8011b2 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  801196:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80119a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80119d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8011a1:	48 89 d6             	mov    %rdx,%rsi
+  8011a4:	89 c7                	mov    %eax,%edi
+  8011a6:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8011a8:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8011ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8011b0:	7f e4                	jg     801196 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8011b2:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8011b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011be:	48 f7 f1             	div    %rcx
+  8011c1:	48 b8 90 86 80 00 00 	movabs $0x808690,%rax
+  8011c8:	00 00 00 
+  8011cb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8011cf:	0f be c0             	movsbl %al,%eax
+  8011d2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011d6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8011da:	48 89 d6             	mov    %rdx,%rsi
+  8011dd:	89 c7                	mov    %eax,%edi
+  8011df:	ff d1                	call   *%rcx
+}
+  8011e1:	90                   	nop
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+
+00000000008011e4 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8011e4:	55                   	push   %rbp
+  8011e5:	48 89 e5             	mov    %rsp,%rbp
+  8011e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8011ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011f0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8011f3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8011f7:	7e 4b                	jle    801244 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8011f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011fd:	8b 00                	mov    (%rax),%eax
+  8011ff:	83 f8 2f             	cmp    $0x2f,%eax
+  801202:	77 24                	ja     801228 <getuint+0x44>
+  801204:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801208:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80120c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801210:	8b 00                	mov    (%rax),%eax
+  801212:	89 c0                	mov    %eax,%eax
+  801214:	48 01 d0             	add    %rdx,%rax
+  801217:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80121b:	8b 12                	mov    (%rdx),%edx
+  80121d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801220:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801224:	89 0a                	mov    %ecx,(%rdx)
+  801226:	eb 14                	jmp    80123c <getuint+0x58>
+  801228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80122c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801230:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801234:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801238:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80123c:	48 8b 00             	mov    (%rax),%rax
+  80123f:	e9 95 00 00 00       	jmp    8012d9 <getuint+0xf5>
+  else if (lflag)
+  801244:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801248:	74 48                	je     801292 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80124a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80124e:	8b 00                	mov    (%rax),%eax
+  801250:	83 f8 2f             	cmp    $0x2f,%eax
+  801253:	77 24                	ja     801279 <getuint+0x95>
+  801255:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801259:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80125d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801261:	8b 00                	mov    (%rax),%eax
+  801263:	89 c0                	mov    %eax,%eax
+  801265:	48 01 d0             	add    %rdx,%rax
+  801268:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80126c:	8b 12                	mov    (%rdx),%edx
+  80126e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801271:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801275:	89 0a                	mov    %ecx,(%rdx)
+  801277:	eb 14                	jmp    80128d <getuint+0xa9>
+  801279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80127d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801281:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801285:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801289:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80128d:	48 8b 00             	mov    (%rax),%rax
+  801290:	eb 47                	jmp    8012d9 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  801292:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801296:	8b 00                	mov    (%rax),%eax
+  801298:	83 f8 2f             	cmp    $0x2f,%eax
+  80129b:	77 24                	ja     8012c1 <getuint+0xdd>
+  80129d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012a1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012a9:	8b 00                	mov    (%rax),%eax
+  8012ab:	89 c0                	mov    %eax,%eax
+  8012ad:	48 01 d0             	add    %rdx,%rax
+  8012b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012b4:	8b 12                	mov    (%rdx),%edx
+  8012b6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012bd:	89 0a                	mov    %ecx,(%rdx)
+  8012bf:	eb 14                	jmp    8012d5 <getuint+0xf1>
+  8012c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012c9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012d1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012d5:	8b 00                	mov    (%rax),%eax
+  8012d7:	89 c0                	mov    %eax,%eax
+}
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+
+00000000008012db <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	48 83 ec 10          	sub    $0x10,%rsp
+  8012e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012e7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8012ea:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8012ee:	7e 4b                	jle    80133b <getint+0x60>
+    return va_arg(*ap, long long);
+  8012f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f4:	8b 00                	mov    (%rax),%eax
+  8012f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f9:	77 24                	ja     80131f <getint+0x44>
+  8012fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ff:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801303:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801307:	8b 00                	mov    (%rax),%eax
+  801309:	89 c0                	mov    %eax,%eax
+  80130b:	48 01 d0             	add    %rdx,%rax
+  80130e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801312:	8b 12                	mov    (%rdx),%edx
+  801314:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801317:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80131b:	89 0a                	mov    %ecx,(%rdx)
+  80131d:	eb 14                	jmp    801333 <getint+0x58>
+  80131f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801323:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801327:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80132b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80132f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801333:	48 8b 00             	mov    (%rax),%rax
+  801336:	e9 95 00 00 00       	jmp    8013d0 <getint+0xf5>
+  else if (lflag)
+  80133b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80133f:	74 48                	je     801389 <getint+0xae>
+    return va_arg(*ap, long);
+  801341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801345:	8b 00                	mov    (%rax),%eax
+  801347:	83 f8 2f             	cmp    $0x2f,%eax
+  80134a:	77 24                	ja     801370 <getint+0x95>
+  80134c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801350:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801358:	8b 00                	mov    (%rax),%eax
+  80135a:	89 c0                	mov    %eax,%eax
+  80135c:	48 01 d0             	add    %rdx,%rax
+  80135f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801363:	8b 12                	mov    (%rdx),%edx
+  801365:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801368:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80136c:	89 0a                	mov    %ecx,(%rdx)
+  80136e:	eb 14                	jmp    801384 <getint+0xa9>
+  801370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801374:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801378:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80137c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801380:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801384:	48 8b 00             	mov    (%rax),%rax
+  801387:	eb 47                	jmp    8013d0 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  801389:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138d:	8b 00                	mov    (%rax),%eax
+  80138f:	83 f8 2f             	cmp    $0x2f,%eax
+  801392:	77 24                	ja     8013b8 <getint+0xdd>
+  801394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801398:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80139c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a0:	8b 00                	mov    (%rax),%eax
+  8013a2:	89 c0                	mov    %eax,%eax
+  8013a4:	48 01 d0             	add    %rdx,%rax
+  8013a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013ab:	8b 12                	mov    (%rdx),%edx
+  8013ad:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013b4:	89 0a                	mov    %ecx,(%rdx)
+  8013b6:	eb 14                	jmp    8013cc <getint+0xf1>
+  8013b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013c0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013c8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013cc:	8b 00                	mov    (%rax),%eax
+  8013ce:	48 98                	cltq
+}
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+
+00000000008013d2 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	41 54                	push   %r12
+  8013d8:	53                   	push   %rbx
+  8013d9:	48 83 ec 60          	sub    $0x60,%rsp
+  8013dd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8013e1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8013e5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8013e9:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8013ed:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8013f1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8013f5:	48 8b 06             	mov    (%rsi),%rax
+  8013f8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013fc:	48 89 01             	mov    %rax,(%rcx)
+  8013ff:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801403:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801407:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80140b:	eb 17                	jmp    801424 <vprintfmt+0x52>
+      if (ch == '\0')
+  80140d:	85 db                	test   %ebx,%ebx
+  80140f:	0f 84 bf 04 00 00    	je     8018d4 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  801415:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801419:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80141d:	48 89 c6             	mov    %rax,%rsi
+  801420:	89 df                	mov    %ebx,%edi
+  801422:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801424:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801428:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80142c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801430:	0f b6 00             	movzbl (%rax),%eax
+  801433:	0f b6 d8             	movzbl %al,%ebx
+  801436:	83 fb 25             	cmp    $0x25,%ebx
+  801439:	75 d2                	jne    80140d <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80143b:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  80143f:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  801446:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80144d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  801454:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80145b:	eb 04                	jmp    801461 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80145d:	90                   	nop
+  80145e:	eb 01                	jmp    801461 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  801460:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  801461:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801465:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801469:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80146d:	0f b6 00             	movzbl (%rax),%eax
+  801470:	0f b6 d8             	movzbl %al,%ebx
+  801473:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801476:	83 f8 55             	cmp    $0x55,%eax
+  801479:	0f 87 22 04 00 00    	ja     8018a1 <vprintfmt+0x4cf>
+  80147f:	89 c0                	mov    %eax,%eax
+  801481:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801488:	00 
+  801489:	48 b8 b8 86 80 00 00 	movabs $0x8086b8,%rax
+  801490:	00 00 00 
+  801493:	48 01 d0             	add    %rdx,%rax
+  801496:	48 8b 00             	mov    (%rax),%rax
+  801499:	ff e0                	jmp    *%rax
+        padc = '-';
+  80149b:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80149f:	eb c0                	jmp    801461 <vprintfmt+0x8f>
+        padc = '0';
+  8014a1:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8014a5:	eb ba                	jmp    801461 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8014a7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8014ae:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014b1:	89 d0                	mov    %edx,%eax
+  8014b3:	c1 e0 02             	shl    $0x2,%eax
+  8014b6:	01 d0                	add    %edx,%eax
+  8014b8:	01 c0                	add    %eax,%eax
+  8014ba:	01 d8                	add    %ebx,%eax
+  8014bc:	83 e8 30             	sub    $0x30,%eax
+  8014bf:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8014c2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8014c6:	0f b6 00             	movzbl (%rax),%eax
+  8014c9:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8014cc:	83 fb 2f             	cmp    $0x2f,%ebx
+  8014cf:	7e 60                	jle    801531 <vprintfmt+0x15f>
+  8014d1:	83 fb 39             	cmp    $0x39,%ebx
+  8014d4:	7f 5b                	jg     801531 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8014d6:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8014db:	eb d1                	jmp    8014ae <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8014dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8014e3:	77 17                	ja     8014fc <vprintfmt+0x12a>
+  8014e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8014ec:	89 d2                	mov    %edx,%edx
+  8014ee:	48 01 d0             	add    %rdx,%rax
+  8014f1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8014f4:	83 c2 08             	add    $0x8,%edx
+  8014f7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8014fa:	eb 0c                	jmp    801508 <vprintfmt+0x136>
+  8014fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801500:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801504:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801508:	8b 00                	mov    (%rax),%eax
+  80150a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  80150d:	eb 23                	jmp    801532 <vprintfmt+0x160>
+        if (width < 0)
+  80150f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801513:	0f 89 44 ff ff ff    	jns    80145d <vprintfmt+0x8b>
+          width = 0;
+  801519:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  801520:	e9 38 ff ff ff       	jmp    80145d <vprintfmt+0x8b>
+        altflag = 1;
+  801525:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80152c:	e9 30 ff ff ff       	jmp    801461 <vprintfmt+0x8f>
+        goto process_precision;
+  801531:	90                   	nop
+        if (width < 0)
+  801532:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801536:	0f 89 24 ff ff ff    	jns    801460 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80153c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80153f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801542:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  801549:	e9 12 ff ff ff       	jmp    801460 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80154e:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  801552:	e9 0a ff ff ff       	jmp    801461 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  801557:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80155a:	83 f8 2f             	cmp    $0x2f,%eax
+  80155d:	77 17                	ja     801576 <vprintfmt+0x1a4>
+  80155f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801563:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801566:	89 d2                	mov    %edx,%edx
+  801568:	48 01 d0             	add    %rdx,%rax
+  80156b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80156e:	83 c2 08             	add    $0x8,%edx
+  801571:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801574:	eb 0c                	jmp    801582 <vprintfmt+0x1b0>
+  801576:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80157a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80157e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801582:	8b 00                	mov    (%rax),%eax
+  801584:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801588:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80158c:	48 89 d6             	mov    %rdx,%rsi
+  80158f:	89 c7                	mov    %eax,%edi
+  801591:	ff d1                	call   *%rcx
+        break;
+  801593:	e9 37 03 00 00       	jmp    8018cf <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  801598:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80159b:	83 f8 2f             	cmp    $0x2f,%eax
+  80159e:	77 17                	ja     8015b7 <vprintfmt+0x1e5>
+  8015a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015a4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015a7:	89 d2                	mov    %edx,%edx
+  8015a9:	48 01 d0             	add    %rdx,%rax
+  8015ac:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015af:	83 c2 08             	add    $0x8,%edx
+  8015b2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8015b5:	eb 0c                	jmp    8015c3 <vprintfmt+0x1f1>
+  8015b7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8015bb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8015bf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8015c3:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8015c5:	85 db                	test   %ebx,%ebx
+  8015c7:	79 02                	jns    8015cb <vprintfmt+0x1f9>
+          err = -err;
+  8015c9:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8015cb:	83 fb 15             	cmp    $0x15,%ebx
+  8015ce:	7f 16                	jg     8015e6 <vprintfmt+0x214>
+  8015d0:	48 ba e0 85 80 00 00 	movabs $0x8085e0,%rdx
+  8015d7:	00 00 00 
+  8015da:	48 63 c3             	movslq %ebx,%rax
+  8015dd:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8015e1:	4d 85 e4             	test   %r12,%r12
+  8015e4:	75 2e                	jne    801614 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8015e6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8015ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015ee:	89 d9                	mov    %ebx,%ecx
+  8015f0:	48 ba a1 86 80 00 00 	movabs $0x8086a1,%rdx
+  8015f7:	00 00 00 
+  8015fa:	48 89 c7             	mov    %rax,%rdi
+  8015fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801602:	49 b8 de 18 80 00 00 	movabs $0x8018de,%r8
+  801609:	00 00 00 
+  80160c:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  80160f:	e9 bb 02 00 00       	jmp    8018cf <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  801614:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801618:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80161c:	4c 89 e1             	mov    %r12,%rcx
+  80161f:	48 ba aa 86 80 00 00 	movabs $0x8086aa,%rdx
+  801626:	00 00 00 
+  801629:	48 89 c7             	mov    %rax,%rdi
+  80162c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801631:	49 b8 de 18 80 00 00 	movabs $0x8018de,%r8
+  801638:	00 00 00 
+  80163b:	41 ff d0             	call   *%r8
+        break;
+  80163e:	e9 8c 02 00 00       	jmp    8018cf <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  801643:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801646:	83 f8 2f             	cmp    $0x2f,%eax
+  801649:	77 17                	ja     801662 <vprintfmt+0x290>
+  80164b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80164f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801652:	89 d2                	mov    %edx,%edx
+  801654:	48 01 d0             	add    %rdx,%rax
+  801657:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80165a:	83 c2 08             	add    $0x8,%edx
+  80165d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801660:	eb 0c                	jmp    80166e <vprintfmt+0x29c>
+  801662:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801666:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80166a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80166e:	4c 8b 20             	mov    (%rax),%r12
+  801671:	4d 85 e4             	test   %r12,%r12
+  801674:	75 0a                	jne    801680 <vprintfmt+0x2ae>
+          p = "(null)";
+  801676:	49 bc ad 86 80 00 00 	movabs $0x8086ad,%r12
+  80167d:	00 00 00 
+        if (width > 0 && padc != '-')
+  801680:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801684:	7e 78                	jle    8016fe <vprintfmt+0x32c>
+  801686:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80168a:	74 72                	je     8016fe <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80168c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80168f:	48 98                	cltq
+  801691:	48 89 c6             	mov    %rax,%rsi
+  801694:	4c 89 e7             	mov    %r12,%rdi
+  801697:	48 b8 ea 1f 80 00 00 	movabs $0x801fea,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+  8016a3:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8016a6:	eb 17                	jmp    8016bf <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8016a8:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8016ac:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8016b0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8016b4:	48 89 d6             	mov    %rdx,%rsi
+  8016b7:	89 c7                	mov    %eax,%edi
+  8016b9:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8016bb:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8016bf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8016c3:	7f e3                	jg     8016a8 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8016c5:	eb 37                	jmp    8016fe <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  8016c7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8016cb:	74 1e                	je     8016eb <vprintfmt+0x319>
+  8016cd:	83 fb 1f             	cmp    $0x1f,%ebx
+  8016d0:	7e 05                	jle    8016d7 <vprintfmt+0x305>
+  8016d2:	83 fb 7e             	cmp    $0x7e,%ebx
+  8016d5:	7e 14                	jle    8016eb <vprintfmt+0x319>
+            putch('?', putdat);
+  8016d7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8016db:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8016df:	48 89 c6             	mov    %rax,%rsi
+  8016e2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8016e7:	ff d2                	call   *%rdx
+  8016e9:	eb 0f                	jmp    8016fa <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8016eb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8016ef:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8016f3:	48 89 c6             	mov    %rax,%rsi
+  8016f6:	89 df                	mov    %ebx,%edi
+  8016f8:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8016fa:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8016fe:	4c 89 e0             	mov    %r12,%rax
+  801701:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801705:	0f b6 00             	movzbl (%rax),%eax
+  801708:	0f be d8             	movsbl %al,%ebx
+  80170b:	85 db                	test   %ebx,%ebx
+  80170d:	74 28                	je     801737 <vprintfmt+0x365>
+  80170f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801713:	78 b2                	js     8016c7 <vprintfmt+0x2f5>
+  801715:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  801719:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80171d:	79 a8                	jns    8016c7 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  80171f:	eb 16                	jmp    801737 <vprintfmt+0x365>
+          putch(' ', putdat);
+  801721:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801725:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801729:	48 89 c6             	mov    %rax,%rsi
+  80172c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801731:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  801733:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801737:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80173b:	7f e4                	jg     801721 <vprintfmt+0x34f>
+        break;
+  80173d:	e9 8d 01 00 00       	jmp    8018cf <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  801742:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801745:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801749:	89 d6                	mov    %edx,%esi
+  80174b:	48 89 c7             	mov    %rax,%rdi
+  80174e:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  801755:	00 00 00 
+  801758:	ff d0                	call   *%rax
+  80175a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80175e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801762:	48 85 c0             	test   %rax,%rax
+  801765:	79 1d                	jns    801784 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  801767:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80176b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80176f:	48 89 c6             	mov    %rax,%rsi
+  801772:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801777:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  801779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80177d:	48 f7 d8             	neg    %rax
+  801780:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  801784:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80178b:	e9 d2 00 00 00       	jmp    801862 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  801790:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801793:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801797:	89 d6                	mov    %edx,%esi
+  801799:	48 89 c7             	mov    %rax,%rdi
+  80179c:	48 b8 e4 11 80 00 00 	movabs $0x8011e4,%rax
+  8017a3:	00 00 00 
+  8017a6:	ff d0                	call   *%rax
+  8017a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8017ac:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8017b3:	e9 aa 00 00 00       	jmp    801862 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  8017b8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8017bb:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8017bf:	89 d6                	mov    %edx,%esi
+  8017c1:	48 89 c7             	mov    %rax,%rdi
+  8017c4:	48 b8 e4 11 80 00 00 	movabs $0x8011e4,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+  8017d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8017d4:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8017db:	e9 82 00 00 00       	jmp    801862 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8017e0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8017e4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8017e8:	48 89 c6             	mov    %rax,%rsi
+  8017eb:	bf 30 00 00 00       	mov    $0x30,%edi
+  8017f0:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8017f2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8017f6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8017fa:	48 89 c6             	mov    %rax,%rsi
+  8017fd:	bf 78 00 00 00       	mov    $0x78,%edi
+  801802:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801807:	83 f8 2f             	cmp    $0x2f,%eax
+  80180a:	77 17                	ja     801823 <vprintfmt+0x451>
+  80180c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801810:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801813:	89 d2                	mov    %edx,%edx
+  801815:	48 01 d0             	add    %rdx,%rax
+  801818:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80181b:	83 c2 08             	add    $0x8,%edx
+  80181e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801821:	eb 0c                	jmp    80182f <vprintfmt+0x45d>
+  801823:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801827:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80182b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80182f:	48 8b 00             	mov    (%rax),%rax
+  801832:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801836:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80183d:	eb 23                	jmp    801862 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  80183f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801842:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801846:	89 d6                	mov    %edx,%esi
+  801848:	48 89 c7             	mov    %rax,%rdi
+  80184b:	48 b8 e4 11 80 00 00 	movabs $0x8011e4,%rax
+  801852:	00 00 00 
+  801855:	ff d0                	call   *%rax
+  801857:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80185b:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  801862:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801867:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80186a:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80186d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801871:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801875:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801879:	45 89 c1             	mov    %r8d,%r9d
+  80187c:	41 89 f8             	mov    %edi,%r8d
+  80187f:	48 89 c7             	mov    %rax,%rdi
+  801882:	48 b8 2c 11 80 00 00 	movabs $0x80112c,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+        break;
+  80188e:	eb 3f                	jmp    8018cf <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801890:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801894:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801898:	48 89 c6             	mov    %rax,%rsi
+  80189b:	89 df                	mov    %ebx,%edi
+  80189d:	ff d2                	call   *%rdx
+        break;
+  80189f:	eb 2e                	jmp    8018cf <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  8018a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018a5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018a9:	48 89 c6             	mov    %rax,%rsi
+  8018ac:	bf 25 00 00 00       	mov    $0x25,%edi
+  8018b1:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8018b3:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8018b8:	eb 05                	jmp    8018bf <vprintfmt+0x4ed>
+  8018ba:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8018bf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8018c3:	48 83 e8 01          	sub    $0x1,%rax
+  8018c7:	0f b6 00             	movzbl (%rax),%eax
+  8018ca:	3c 25                	cmp    $0x25,%al
+  8018cc:	75 ec                	jne    8018ba <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8018ce:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8018cf:	e9 50 fb ff ff       	jmp    801424 <vprintfmt+0x52>
+        return;
+  8018d4:	90                   	nop
+    }
+  }
+}
+  8018d5:	48 83 c4 60          	add    $0x60,%rsp
+  8018d9:	5b                   	pop    %rbx
+  8018da:	41 5c                	pop    %r12
+  8018dc:	5d                   	pop    %rbp
+  8018dd:	c3                   	ret
+
+00000000008018de <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8018de:	55                   	push   %rbp
+  8018df:	48 89 e5             	mov    %rsp,%rbp
+  8018e2:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8018e9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8018f0:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8018f7:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8018fe:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801905:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80190c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801913:	84 c0                	test   %al,%al
+  801915:	74 20                	je     801937 <printfmt+0x59>
+  801917:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80191b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80191f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801923:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801927:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80192b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80192f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801933:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801937:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80193e:	00 00 00 
+  801941:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801948:	00 00 00 
+  80194b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80194f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801956:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80195d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801964:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80196b:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801972:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801979:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801980:	48 89 c7             	mov    %rax,%rdi
+  801983:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  80198a:	00 00 00 
+  80198d:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  80198f:	90                   	nop
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+0000000000801992 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	48 83 ec 10          	sub    $0x10,%rsp
+  80199a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80199d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  8019a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a5:	8b 40 10             	mov    0x10(%rax),%eax
+  8019a8:	8d 50 01             	lea    0x1(%rax),%edx
+  8019ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019af:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  8019b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b6:	48 8b 10             	mov    (%rax),%rdx
+  8019b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019bd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8019c1:	48 39 c2             	cmp    %rax,%rdx
+  8019c4:	73 17                	jae    8019dd <sprintputch+0x4b>
+    *b->buf++ = ch;
+  8019c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ca:	48 8b 00             	mov    (%rax),%rax
+  8019cd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019d1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019d5:	48 89 0a             	mov    %rcx,(%rdx)
+  8019d8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8019db:	88 10                	mov    %dl,(%rax)
+}
+  8019dd:	90                   	nop
+  8019de:	c9                   	leave
+  8019df:	c3                   	ret
+
+00000000008019e0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	48 83 ec 40          	sub    $0x40,%rsp
+  8019e8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019ec:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8019ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019f3:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8019f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8019ff:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a02:	48 98                	cltq
+  801a04:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0c:	48 01 d0             	add    %rdx,%rax
+  801a0f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801a13:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801a1a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801a1f:	74 06                	je     801a27 <vsnprintf+0x47>
+  801a21:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801a25:	7f 07                	jg     801a2e <vsnprintf+0x4e>
+    return -E_INVAL;
+  801a27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2c:	eb 32                	jmp    801a60 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801a2e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a32:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a36:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801a3a:	48 89 c6             	mov    %rax,%rsi
+  801a3d:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  801a44:	00 00 00 
+  801a47:	48 89 c7             	mov    %rax,%rdi
+  801a4a:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  801a51:	00 00 00 
+  801a54:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801a56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a5a:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801a5d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801a60:	c9                   	leave
+  801a61:	c3                   	ret
+
+0000000000801a62 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801a62:	55                   	push   %rbp
+  801a63:	48 89 e5             	mov    %rsp,%rbp
+  801a66:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801a6d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801a74:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801a7a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801a81:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801a88:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801a8f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801a96:	84 c0                	test   %al,%al
+  801a98:	74 20                	je     801aba <snprintf+0x58>
+  801a9a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801a9e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801aa2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801aa6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801aaa:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801aae:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801ab2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801ab6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801aba:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801ac1:	00 00 00 
+  801ac4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801acb:	00 00 00 
+  801ace:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ad2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801ad9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801ae0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801ae7:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801aee:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801af5:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801afb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801b02:	48 89 c7             	mov    %rax,%rdi
+  801b05:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  801b0c:	00 00 00 
+  801b0f:	ff d0                	call   *%rax
+  801b11:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801b17:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+
+0000000000801b1f <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801b1f:	55                   	push   %rbp
+  801b20:	48 89 e5             	mov    %rsp,%rbp
+  801b23:	53                   	push   %rbx
+  801b24:	48 83 ec 38          	sub    $0x38,%rsp
+  801b28:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801b2b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801b2f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b33:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b37:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801b3b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b43:	89 d1                	mov    %edx,%ecx
+  801b45:	0f a2                	cpuid
+  801b47:	89 de                	mov    %ebx,%esi
+  801b49:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801b4c:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801b4f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801b52:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801b55:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b5a:	74 09                	je     801b65 <cpuid+0x46>
+}
+  801b5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b60:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801b63:	89 10                	mov    %edx,(%rax)
+
+  801b65:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b6a:	74 09                	je     801b75 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801b6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b70:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801b73:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801b75:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801b7a:	74 09                	je     801b85 <cpuid+0x66>
+char *
+  801b7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b80:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801b83:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801b85:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801b8a:	74 09                	je     801b95 <cpuid+0x76>
+  for (; *s; s++)
+  801b8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b90:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801b93:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801b95:	90                   	nop
+  801b96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+
+0000000000801b9c <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801ba7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801baa:	89 c1                	mov    %eax,%ecx
+  801bac:	0f 01 d0             	xgetbv
+  801baf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801bb2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801bb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801bb8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801bbb:	48 c1 e2 20          	shl    $0x20,%rdx
+  801bbf:	48 09 d0             	or     %rdx,%rax
+#else
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+0000000000801bc4 <string_cpu>:
+string_cpu(void) {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801bcc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801bd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801bda:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  801be1:	00 00 00 
+  801be4:	8b 00                	mov    (%rax),%eax
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 11                	js     801bfb <string_cpu+0x37>
+    return string_features;
+  801bea:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  801bf1:	00 00 00 
+  801bf4:	8b 00                	mov    (%rax),%eax
+  801bf6:	e9 df 00 00 00       	jmp    801cda <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801bfb:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801bff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c05:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0f:	48 89 c6             	mov    %rax,%rsi
+  801c12:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c17:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801c1e:	00 00 00 
+  801c21:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801c23:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c26:	83 f8 06             	cmp    $0x6,%eax
+  801c29:	76 28                	jbe    801c53 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801c2b:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801c2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c3a:	48 89 c2             	mov    %rax,%rdx
+  801c3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c42:	bf 07 00 00 00       	mov    $0x7,%edi
+  801c47:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801c53:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c56:	25 00 02 00 00       	and    $0x200,%eax
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	74 04                	je     801c63 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801c5f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801c63:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801c67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c6d:	48 89 c1             	mov    %rax,%rcx
+  801c70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c75:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801c7f:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801c8b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c8e:	83 e0 20             	and    $0x20,%eax
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	74 2a                	je     801cbf <string_cpu+0xfb>
+  801c95:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801c98:	25 00 00 00 08       	and    $0x8000000,%eax
+  801c9d:	85 c0                	test   %eax,%eax
+  801c9f:	74 1e                	je     801cbf <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca6:	48 b8 9c 1b 80 00 00 	movabs $0x801b9c,%rax
+  801cad:	00 00 00 
+  801cb0:	ff d0                	call   *%rax
+  801cb2:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801cb5:	48 83 f8 06          	cmp    $0x6,%rax
+  801cb9:	75 04                	jne    801cbf <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801cbb:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801cbf:	48 ba 48 90 80 00 00 	movabs $0x809048,%rdx
+  801cc6:	00 00 00 
+  801cc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801ccc:	89 02                	mov    %eax,(%rdx)
+  801cce:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  801cd5:	00 00 00 
+  801cd8:	8b 00                	mov    (%rax),%eax
+}
+  801cda:	c9                   	leave
+  801cdb:	c3                   	ret
+
+0000000000801cdc <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801cdc:	55                   	push   %rbp
+  801cdd:	48 89 e5             	mov    %rsp,%rbp
+  801ce0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801ce4:	48 83 ec 60          	sub    $0x60,%rsp
+  801ce8:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801ced:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801cf2:	83 e0 1f             	and    $0x1f,%eax
+  801cf5:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801cf9:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801cfd:	48 f7 d8             	neg    %rax
+  801d00:	48 89 c2             	mov    %rax,%rdx
+  801d03:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801d08:	48 01 d0             	add    %rdx,%rax
+  801d0b:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801d10:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801d14:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801d1a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801d1f:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801d23:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801d29:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801d2d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801d31:	89 c2                	mov    %eax,%edx
+  801d33:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801d37:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801d3c:	89 c1                	mov    %eax,%ecx
+  801d3e:	d3 e6                	shl    %cl,%esi
+  801d40:	89 f0                	mov    %esi,%eax
+  801d42:	21 d0                	and    %edx,%eax
+  801d44:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801d48:	eb 21                	jmp    801d6b <strlen_avx2+0x8f>
+    p += 32;
+  801d4a:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801d50:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801d55:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801d59:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801d5f:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801d63:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801d67:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801d6b:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801d70:	74 d8                	je     801d4a <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801d72:	31 c0                	xor    %eax,%eax
+  801d74:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801d7a:	48 63 d0             	movslq %eax,%rdx
+  801d7d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801d82:	48 01 d0             	add    %rdx,%rax
+  801d85:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+0000000000801d8c <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801d8c:	55                   	push   %rbp
+  801d8d:	48 89 e5             	mov    %rsp,%rbp
+  801d90:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801d94:	48 83 ec 40          	sub    $0x40,%rsp
+  801d98:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801d9d:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801da2:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801da7:	eb 77                	jmp    801e20 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801da9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801dae:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801db2:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801db6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801dbb:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801dbf:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801dc3:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801dc7:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801dcb:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801dd0:	74 3c                	je     801e0e <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801dd2:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801dd6:	f7 d0                	not    %eax
+  801dd8:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ddc:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801de0:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801de4:	48 63 d0             	movslq %eax,%rdx
+  801de7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801dec:	48 01 d0             	add    %rdx,%rax
+  801def:	0f b6 00             	movzbl (%rax),%eax
+  801df2:	0f b6 c0             	movzbl %al,%eax
+  801df5:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801df9:	48 63 ca             	movslq %edx,%rcx
+  801dfc:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801e01:	48 01 ca             	add    %rcx,%rdx
+  801e04:	0f b6 12             	movzbl (%rdx),%edx
+  801e07:	0f b6 d2             	movzbl %dl,%edx
+  801e0a:	29 d0                	sub    %edx,%eax
+  801e0c:	eb 6b                	jmp    801e79 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801e0e:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801e14:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801e1a:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801e20:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801e26:	77 81                	ja     801da9 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801e28:	eb 42                	jmp    801e6c <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801e2a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e2f:	0f b6 10             	movzbl (%rax),%edx
+  801e32:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801e37:	0f b6 00             	movzbl (%rax),%eax
+  801e3a:	38 c2                	cmp    %al,%dl
+  801e3c:	74 1c                	je     801e5a <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801e3e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e43:	0f b6 00             	movzbl (%rax),%eax
+  801e46:	0f b6 c8             	movzbl %al,%ecx
+  801e49:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801e4e:	0f b6 00             	movzbl (%rax),%eax
+  801e51:	0f b6 d0             	movzbl %al,%edx
+  801e54:	89 c8                	mov    %ecx,%eax
+  801e56:	29 d0                	sub    %edx,%eax
+  801e58:	eb 1f                	jmp    801e79 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801e5a:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801e60:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801e66:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801e6c:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801e72:	75 b6                	jne    801e2a <memcmp_avx2+0x9e>
+  return 0;
+  801e74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e79:	c9                   	leave
+  801e7a:	c3                   	ret
+
+0000000000801e7b <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801e7b:	55                   	push   %rbp
+  801e7c:	48 89 e5             	mov    %rsp,%rbp
+  801e7f:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801e83:	48 83 ec 60          	sub    $0x60,%rsp
+  801e87:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801e8c:	89 f0                	mov    %esi,%eax
+  801e8e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801e93:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801e97:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801e9c:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801ea0:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801ea5:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801eab:	eb 47                	jmp    801ef4 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801ead:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801eb2:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801eb6:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801eba:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801ec0:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801ec4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801ec8:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801ecc:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801ed1:	74 15                	je     801ee8 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801ed3:	31 c0                	xor    %eax,%eax
+  801ed5:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801edb:	48 63 d0             	movslq %eax,%rdx
+  801ede:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801ee3:	48 01 d0             	add    %rdx,%rax
+  801ee6:	eb 3d                	jmp    801f25 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801ee8:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801eee:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801ef4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801efa:	77 b1                	ja     801ead <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801efc:	eb 0c                	jmp    801f0a <memfind_avx2+0x8f>
+  801efe:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801f04:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801f0a:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801f10:	74 0e                	je     801f20 <memfind_avx2+0xa5>
+  801f12:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f17:	0f b6 00             	movzbl (%rax),%eax
+  801f1a:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801f1e:	75 de                	jne    801efe <memfind_avx2+0x83>
+  return s;
+  801f20:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801f25:	c9                   	leave
+  801f26:	c3                   	ret
+
+0000000000801f27 <strlen>:
+strlen(const char *s) {
+  801f27:	55                   	push   %rbp
+  801f28:	48 89 e5             	mov    %rsp,%rbp
+  801f2b:	48 83 ec 40          	sub    $0x40,%rsp
+  801f2f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801f33:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801f37:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801f3b:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+  801f47:	83 e0 02             	and    $0x2,%eax
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	74 18                	je     801f66 <strlen+0x3f>
+    return strlen_avx2(s);
+  801f4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f52:	48 89 c7             	mov    %rax,%rdi
+  801f55:	48 b8 dc 1c 80 00 00 	movabs $0x801cdc,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  801f61:	e9 82 00 00 00       	jmp    801fe8 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801f66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f6a:	83 e0 0f             	and    $0xf,%eax
+  801f6d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801f70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f73:	48 f7 d8             	neg    %rax
+  801f76:	48 89 c2             	mov    %rax,%rdx
+  801f79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f7d:	48 01 d0             	add    %rdx,%rax
+  801f80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f88:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801f8c:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801f91:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f95:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f99:	89 c2                	mov    %eax,%edx
+  801f9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f9e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801fa3:	89 c1                	mov    %eax,%ecx
+  801fa5:	d3 e6                	shl    %cl,%esi
+  801fa7:	89 f0                	mov    %esi,%eax
+  801fa9:	21 d0                	and    %edx,%eax
+  801fab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801fae:	eb 1d                	jmp    801fcd <strlen+0xa6>
+    p += 16;
+  801fb0:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801fb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fb9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801fbd:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801fc2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fc6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801fcd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801fd1:	74 dd                	je     801fb0 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801fd3:	31 c0                	xor    %eax,%eax
+  801fd5:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801fda:	48 63 d0             	movslq %eax,%rdx
+  801fdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fe1:	48 01 d0             	add    %rdx,%rax
+  801fe4:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+
+0000000000801fea <strnlen>:
+strnlen(const char *s, size_t size) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+  801fee:	48 83 ec 20          	sub    $0x20,%rsp
+  801ff2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ff6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801ffa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802001:	eb 0e                	jmp    802011 <strnlen+0x27>
+    n++;
+  802003:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802007:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80200c:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  802011:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802016:	74 0b                	je     802023 <strnlen+0x39>
+  802018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80201c:	0f b6 00             	movzbl (%rax),%eax
+  80201f:	84 c0                	test   %al,%al
+  802021:	75 e0                	jne    802003 <strnlen+0x19>
+  return n;
+  802023:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802026:	c9                   	leave
+  802027:	c3                   	ret
+
+0000000000802028 <strcpy>:
+strcpy(char *dst, const char *src) {
+  802028:	55                   	push   %rbp
+  802029:	48 89 e5             	mov    %rsp,%rbp
+  80202c:	48 83 ec 20          	sub    $0x20,%rsp
+  802030:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802034:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  802038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80203c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  802040:	90                   	nop
+  802041:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802045:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802049:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80204d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802051:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802055:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802059:	0f b6 12             	movzbl (%rdx),%edx
+  80205c:	88 10                	mov    %dl,(%rax)
+  80205e:	0f b6 00             	movzbl (%rax),%eax
+  802061:	84 c0                	test   %al,%al
+  802063:	75 dc                	jne    802041 <strcpy+0x19>
+  return ret;
+  802065:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802069:	c9                   	leave
+  80206a:	c3                   	ret
+
+000000000080206b <strcat>:
+strcat(char *dst, const char *src) {
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+  80206f:	48 83 ec 20          	sub    $0x20,%rsp
+  802073:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802077:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80207b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80207f:	48 89 c7             	mov    %rax,%rdi
+  802082:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  802091:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802094:	48 63 d0             	movslq %eax,%rdx
+  802097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80209b:	48 01 c2             	add    %rax,%rdx
+  80209e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020a2:	48 89 c6             	mov    %rax,%rsi
+  8020a5:	48 89 d7             	mov    %rdx,%rdi
+  8020a8:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+  return dst;
+  8020b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8020b8:	c9                   	leave
+  8020b9:	c3                   	ret
+
+00000000008020ba <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8020ba:	55                   	push   %rbp
+  8020bb:	48 89 e5             	mov    %rsp,%rbp
+  8020be:	48 83 ec 28          	sub    $0x28,%rsp
+  8020c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8020ca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8020ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8020d6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8020dd:	00 
+  8020de:	eb 2a                	jmp    80210a <strncpy+0x50>
+    *dst++ = *src;
+  8020e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8020e8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020f0:	0f b6 12             	movzbl (%rdx),%edx
+  8020f3:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8020f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020f9:	0f b6 00             	movzbl (%rax),%eax
+  8020fc:	84 c0                	test   %al,%al
+  8020fe:	74 05                	je     802105 <strncpy+0x4b>
+      src++;
+  802100:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  802105:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80210a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80210e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802112:	72 cc                	jb     8020e0 <strncpy+0x26>
+  return ret;
+  802114:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+000000000080211a <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	48 83 ec 28          	sub    $0x28,%rsp
+  802122:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802126:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80212a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80212e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802132:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  802136:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80213b:	74 3d                	je     80217a <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80213d:	eb 1d                	jmp    80215c <strlcpy+0x42>
+      *dst++ = *src++;
+  80213f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802143:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802147:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80214b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80214f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802153:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802157:	0f b6 12             	movzbl (%rdx),%edx
+  80215a:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80215c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  802161:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802166:	74 0b                	je     802173 <strlcpy+0x59>
+  802168:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80216c:	0f b6 00             	movzbl (%rax),%eax
+  80216f:	84 c0                	test   %al,%al
+  802171:	75 cc                	jne    80213f <strlcpy+0x25>
+    *dst = '\0';
+  802173:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802177:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80217a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80217e:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+
+0000000000802184 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	48 83 ec 30          	sub    $0x30,%rsp
+  80218c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802190:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802194:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  802198:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80219c:	48 89 c7             	mov    %rax,%rdi
+  80219f:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+  8021ab:	48 98                	cltq
+  8021ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8021b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8021b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021b9:	48 89 d6             	mov    %rdx,%rsi
+  8021bc:	48 89 c7             	mov    %rax,%rdi
+  8021bf:	48 b8 ea 1f 80 00 00 	movabs $0x801fea,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+  8021cb:	48 98                	cltq
+  8021cd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8021d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021d5:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8021d9:	75 10                	jne    8021eb <strlcat+0x67>
+    return maxlen + srclen;
+  8021db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8021df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e3:	48 01 d0             	add    %rdx,%rax
+  8021e6:	e9 86 00 00 00       	jmp    802271 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8021eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ef:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8021f3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8021f7:	73 2b                	jae    802224 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8021f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021fd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802201:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802209:	48 01 c1             	add    %rax,%rcx
+  80220c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802210:	48 89 c6             	mov    %rax,%rsi
+  802213:	48 89 cf             	mov    %rcx,%rdi
+  802216:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+  802222:	eb 42                	jmp    802266 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  802224:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802228:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80222c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802230:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802234:	48 01 c1             	add    %rax,%rcx
+  802237:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80223b:	48 89 c6             	mov    %rax,%rsi
+  80223e:	48 89 cf             	mov    %rcx,%rdi
+  802241:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80224d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802251:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802255:	48 01 d0             	add    %rdx,%rax
+  802258:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80225c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802260:	48 01 d0             	add    %rdx,%rax
+  802263:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  802266:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80226a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80226e:	48 01 d0             	add    %rdx,%rax
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+0000000000802273 <strcmp>:
+strcmp(const char *p, const char *q) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	48 83 ec 10          	sub    $0x10,%rsp
+  80227b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80227f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  802283:	eb 0a                	jmp    80228f <strcmp+0x1c>
+    p++, q++;
+  802285:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80228a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80228f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802293:	0f b6 00             	movzbl (%rax),%eax
+  802296:	84 c0                	test   %al,%al
+  802298:	74 12                	je     8022ac <strcmp+0x39>
+  80229a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80229e:	0f b6 10             	movzbl (%rax),%edx
+  8022a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022a5:	0f b6 00             	movzbl (%rax),%eax
+  8022a8:	38 c2                	cmp    %al,%dl
+  8022aa:	74 d9                	je     802285 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8022ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022b0:	0f b6 00             	movzbl (%rax),%eax
+  8022b3:	0f b6 d0             	movzbl %al,%edx
+  8022b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022ba:	0f b6 00             	movzbl (%rax),%eax
+  8022bd:	0f b6 c0             	movzbl %al,%eax
+  8022c0:	29 c2                	sub    %eax,%edx
+  8022c2:	89 d0                	mov    %edx,%eax
+}
+  8022c4:	c9                   	leave
+  8022c5:	c3                   	ret
+
+00000000008022c6 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8022c6:	55                   	push   %rbp
+  8022c7:	48 89 e5             	mov    %rsp,%rbp
+  8022ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022d6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8022da:	eb 0f                	jmp    8022eb <strncmp+0x25>
+    n--, p++, q++;
+  8022dc:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8022e1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8022e6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8022eb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8022f0:	74 1d                	je     80230f <strncmp+0x49>
+  8022f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022f6:	0f b6 00             	movzbl (%rax),%eax
+  8022f9:	84 c0                	test   %al,%al
+  8022fb:	74 12                	je     80230f <strncmp+0x49>
+  8022fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802301:	0f b6 10             	movzbl (%rax),%edx
+  802304:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802308:	0f b6 00             	movzbl (%rax),%eax
+  80230b:	38 c2                	cmp    %al,%dl
+  80230d:	74 cd                	je     8022dc <strncmp+0x16>
+  if (n == 0)
+  80230f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802314:	75 07                	jne    80231d <strncmp+0x57>
+    return 0;
+  802316:	ba 00 00 00 00       	mov    $0x0,%edx
+  80231b:	eb 16                	jmp    802333 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80231d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802321:	0f b6 00             	movzbl (%rax),%eax
+  802324:	0f b6 d0             	movzbl %al,%edx
+  802327:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80232b:	0f b6 00             	movzbl (%rax),%eax
+  80232e:	0f b6 c0             	movzbl %al,%eax
+  802331:	29 c2                	sub    %eax,%edx
+}
+  802333:	89 d0                	mov    %edx,%eax
+  802335:	c9                   	leave
+  802336:	c3                   	ret
+
+0000000000802337 <strchr>:
+strchr(const char *s, char c) {
+  802337:	55                   	push   %rbp
+  802338:	48 89 e5             	mov    %rsp,%rbp
+  80233b:	48 83 ec 60          	sub    $0x60,%rsp
+  80233f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802343:	89 f0                	mov    %esi,%eax
+  802345:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  802348:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80234c:	83 e0 0f             	and    $0xf,%eax
+  80234f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  802352:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802355:	48 f7 d8             	neg    %rax
+  802358:	48 89 c2             	mov    %rax,%rdx
+  80235b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80235f:	48 01 d0             	add    %rdx,%rax
+  802362:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  802366:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80236a:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80236e:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  802372:	66 0f 6e c0          	movd   %eax,%xmm0
+  802376:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80237a:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80237e:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802383:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  802387:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80238b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80238f:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  802393:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802398:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80239d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023a1:	89 c2                	mov    %eax,%edx
+  8023a3:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8023a8:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8023ad:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023b1:	09 c2                	or     %eax,%edx
+  8023b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023b6:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8023bb:	89 c1                	mov    %eax,%ecx
+  8023bd:	d3 e6                	shl    %cl,%esi
+  8023bf:	89 f0                	mov    %esi,%eax
+  8023c1:	21 d0                	and    %edx,%eax
+  8023c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8023c6:	eb 34                	jmp    8023fc <strchr+0xc5>
+    p += 16;
+  8023c8:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8023cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023d1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8023d5:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8023d9:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8023de:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8023e3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023e7:	89 c2                	mov    %eax,%edx
+  8023e9:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8023ee:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8023f3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023f7:	09 d0                	or     %edx,%eax
+  8023f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8023fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802400:	74 c6                	je     8023c8 <strchr+0x91>
+  p += __builtin_ctz(m);
+  802402:	31 c0                	xor    %eax,%eax
+  802404:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  802409:	48 98                	cltq
+  80240b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  80240f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802413:	0f b6 00             	movzbl (%rax),%eax
+  802416:	84 c0                	test   %al,%al
+  802418:	74 06                	je     802420 <strchr+0xe9>
+  80241a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80241e:	eb 05                	jmp    802425 <strchr+0xee>
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802425:	c9                   	leave
+  802426:	c3                   	ret
+
+0000000000802427 <strfind>:
+strfind(const char *s, char c) {
+  802427:	55                   	push   %rbp
+  802428:	48 89 e5             	mov    %rsp,%rbp
+  80242b:	48 83 ec 10          	sub    $0x10,%rsp
+  80242f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802433:	89 f0                	mov    %esi,%eax
+  802435:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  802438:	eb 11                	jmp    80244b <strfind+0x24>
+    if (*s == c)
+  80243a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80243e:	0f b6 00             	movzbl (%rax),%eax
+  802441:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802444:	74 12                	je     802458 <strfind+0x31>
+  for (; *s; s++)
+  802446:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80244b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80244f:	0f b6 00             	movzbl (%rax),%eax
+  802452:	84 c0                	test   %al,%al
+  802454:	75 e4                	jne    80243a <strfind+0x13>
+  802456:	eb 01                	jmp    802459 <strfind+0x32>
+      break;
+  802458:	90                   	nop
+  return (char *)s;
+  802459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80245d:	c9                   	leave
+  80245e:	c3                   	ret
+
+000000000080245f <memset>:
+memset(void *v, int c, size_t n) {
+  80245f:	55                   	push   %rbp
+  802460:	48 89 e5             	mov    %rsp,%rbp
+  802463:	48 83 ec 38          	sub    $0x38,%rsp
+  802467:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80246b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80246e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  802472:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802476:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80247a:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80247f:	76 41                	jbe    8024c2 <memset+0x63>
+  802481:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  802488:	00 00 00 
+  80248b:	ff d0                	call   *%rax
+  80248d:	83 e0 01             	and    $0x1,%eax
+  802490:	85 c0                	test   %eax,%eax
+  802492:	74 2e                	je     8024c2 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  802494:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802497:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80249b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80249f:	48 89 ce             	mov    %rcx,%rsi
+  8024a2:	48 89 f7             	mov    %rsi,%rdi
+  8024a5:	48 89 d1             	mov    %rdx,%rcx
+  8024a8:	fc                   	cld
+  8024a9:	f3 aa                	rep stos %al,%es:(%rdi)
+  8024ab:	48 89 ca             	mov    %rcx,%rdx
+  8024ae:	48 89 fe             	mov    %rdi,%rsi
+  8024b1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8024b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8024b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024bd:	e9 a7 00 00 00       	jmp    802569 <memset+0x10a>
+  if (n >= 8) {
+  8024c2:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8024c7:	0f 86 87 00 00 00    	jbe    802554 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8024cd:	eb 16                	jmp    8024e5 <memset+0x86>
+      *p++ = c;
+  8024cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8024d7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8024db:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8024de:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8024e0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8024e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e9:	83 e0 07             	and    $0x7,%eax
+  8024ec:	48 85 c0             	test   %rax,%rax
+  8024ef:	75 de                	jne    8024cf <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8024f1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8024f4:	0f b6 c0             	movzbl %al,%eax
+  8024f7:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8024fe:	01 01 01 
+  802501:	48 0f af c2          	imul   %rdx,%rax
+  802505:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  802509:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80250d:	48 c1 e8 03          	shr    $0x3,%rax
+  802511:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  802515:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802519:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80251d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802521:	48 89 ce             	mov    %rcx,%rsi
+  802524:	48 89 f7             	mov    %rsi,%rdi
+  802527:	48 89 d1             	mov    %rdx,%rcx
+  80252a:	fc                   	cld
+  80252b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80252e:	48 89 ca             	mov    %rcx,%rdx
+  802531:	48 89 fe             	mov    %rdi,%rsi
+  802534:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  802538:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80253c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  802541:	eb 11                	jmp    802554 <memset+0xf5>
+    *p++ = c;
+  802543:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802547:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80254b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80254f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802552:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  802554:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802558:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80255c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802560:	48 85 c0             	test   %rax,%rax
+  802563:	75 de                	jne    802543 <memset+0xe4>
+  return v;
+  802565:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  802569:	c9                   	leave
+  80256a:	c3                   	ret
+
+000000000080256b <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80256b:	55                   	push   %rbp
+  80256c:	48 89 e5             	mov    %rsp,%rbp
+  80256f:	48 83 ec 38          	sub    $0x38,%rsp
+  802573:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802577:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80257b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80257f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802583:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  802587:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80258b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80258f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802593:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802597:	0f 83 da 00 00 00    	jae    802677 <memmove+0x10c>
+  80259d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025a5:	48 01 d0             	add    %rdx,%rax
+  8025a8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8025ac:	0f 83 c5 00 00 00    	jae    802677 <memmove+0x10c>
+    s += n;
+  8025b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025b6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8025ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025be:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8025c2:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8025c7:	0f 86 94 00 00 00    	jbe    802661 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8025cd:	eb 1c                	jmp    8025eb <memmove+0x80>
+        *--d = *--s;
+  8025cf:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8025d4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8025d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025dd:	0f b6 10             	movzbl (%rax),%edx
+  8025e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025e4:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8025e6:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8025eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025ef:	83 e0 07             	and    $0x7,%eax
+  8025f2:	48 85 c0             	test   %rax,%rax
+  8025f5:	75 d8                	jne    8025cf <memmove+0x64>
+      nq = n / 8;
+  8025f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025fb:	48 c1 e8 03          	shr    $0x3,%rax
+  8025ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  802603:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  802608:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  80260d:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  802612:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802616:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80261a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80261e:	48 89 cf             	mov    %rcx,%rdi
+  802621:	48 89 d6             	mov    %rdx,%rsi
+  802624:	48 89 c1             	mov    %rax,%rcx
+  802627:	fd                   	std
+  802628:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80262b:	fc                   	cld
+  80262c:	48 89 c8             	mov    %rcx,%rax
+  80262f:	48 89 f2             	mov    %rsi,%rdx
+  802632:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802636:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80263a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80263e:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  802643:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  802648:	eb 17                	jmp    802661 <memmove+0xf6>
+      *--d = *--s;
+  80264a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80264f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  802654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802658:	0f b6 10             	movzbl (%rax),%edx
+  80265b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80265f:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  802661:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802665:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802669:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80266d:	48 85 c0             	test   %rax,%rax
+  802670:	75 d8                	jne    80264a <memmove+0xdf>
+  if (s < d && s + n > d) {
+  802672:	e9 f4 00 00 00       	jmp    80276b <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802677:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80267c:	76 46                	jbe    8026c4 <memmove+0x159>
+  80267e:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	83 e0 01             	and    $0x1,%eax
+  80268d:	85 c0                	test   %eax,%eax
+  80268f:	74 33                	je     8026c4 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  802691:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802695:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802699:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80269d:	48 89 cf             	mov    %rcx,%rdi
+  8026a0:	48 89 d6             	mov    %rdx,%rsi
+  8026a3:	48 89 c1             	mov    %rax,%rcx
+  8026a6:	fc                   	cld
+  8026a7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8026a9:	48 89 c8             	mov    %rcx,%rax
+  8026ac:	48 89 f2             	mov    %rsi,%rdx
+  8026af:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8026b3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8026b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  8026bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026bf:	e9 ab 00 00 00       	jmp    80276f <memmove+0x204>
+    if (n >= 8) {
+  8026c4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8026c9:	0f 86 8b 00 00 00    	jbe    80275a <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8026cf:	eb 22                	jmp    8026f3 <memmove+0x188>
+        *d++ = *s++;
+  8026d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026d5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8026d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8026dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026e1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8026e5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8026e9:	0f b6 12             	movzbl (%rdx),%edx
+  8026ec:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8026ee:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8026f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026f7:	83 e0 07             	and    $0x7,%eax
+  8026fa:	48 85 c0             	test   %rax,%rax
+  8026fd:	75 d2                	jne    8026d1 <memmove+0x166>
+      nq = n / 8;
+  8026ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802703:	48 c1 e8 03          	shr    $0x3,%rax
+  802707:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80270b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80270f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802713:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802717:	48 89 cf             	mov    %rcx,%rdi
+  80271a:	48 89 d6             	mov    %rdx,%rsi
+  80271d:	48 89 c1             	mov    %rax,%rcx
+  802720:	fc                   	cld
+  802721:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802724:	48 89 c8             	mov    %rcx,%rax
+  802727:	48 89 f2             	mov    %rsi,%rdx
+  80272a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80272e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802732:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  802736:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80273b:	eb 1d                	jmp    80275a <memmove+0x1ef>
+      *d++ = *s++;
+  80273d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802741:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802745:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802749:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80274d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802751:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802755:	0f b6 12             	movzbl (%rdx),%edx
+  802758:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80275a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80275e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802762:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802766:	48 85 c0             	test   %rax,%rax
+  802769:	75 d2                	jne    80273d <memmove+0x1d2>
+  return dst;
+  80276b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80276f:	c9                   	leave
+  802770:	c3                   	ret
+
+0000000000802771 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802771:	55                   	push   %rbp
+  802772:	48 89 e5             	mov    %rsp,%rbp
+  802775:	48 83 ec 18          	sub    $0x18,%rsp
+  802779:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80277d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802781:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  802785:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802789:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80278d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802791:	48 89 ce             	mov    %rcx,%rsi
+  802794:	48 89 c7             	mov    %rax,%rdi
+  802797:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+}
+  8027a3:	c9                   	leave
+  8027a4:	c3                   	ret
+
+00000000008027a5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  8027a5:	55                   	push   %rbp
+  8027a6:	48 89 e5             	mov    %rsp,%rbp
+  8027a9:	48 83 ec 40          	sub    $0x40,%rsp
+  8027ad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8027b1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8027b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  8027b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  8027c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8027c9:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8027ce:	0f 86 a7 00 00 00    	jbe    80287b <memcmp+0xd6>
+  8027d4:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  8027db:	00 00 00 
+  8027de:	ff d0                	call   *%rax
+  8027e0:	83 e0 02             	and    $0x2,%eax
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	0f 84 90 00 00 00    	je     80287b <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8027eb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8027ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f7:	48 89 ce             	mov    %rcx,%rsi
+  8027fa:	48 89 c7             	mov    %rax,%rdi
+  8027fd:	48 b8 8c 1d 80 00 00 	movabs $0x801d8c,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+  802809:	e9 c2 00 00 00       	jmp    8028d0 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  80280e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802812:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802816:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80281a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80281e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802822:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802826:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80282a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80282d:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  802834:	74 36                	je     80286c <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  802836:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802839:	f7 d0                	not    %eax
+  80283b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80283f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  802842:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802845:	48 63 d0             	movslq %eax,%rdx
+  802848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80284c:	48 01 d0             	add    %rdx,%rax
+  80284f:	0f b6 00             	movzbl (%rax),%eax
+  802852:	0f b6 c0             	movzbl %al,%eax
+  802855:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802858:	48 63 ca             	movslq %edx,%rcx
+  80285b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80285f:	48 01 ca             	add    %rcx,%rdx
+  802862:	0f b6 12             	movzbl (%rdx),%edx
+  802865:	0f b6 d2             	movzbl %dl,%edx
+  802868:	29 d0                	sub    %edx,%eax
+  80286a:	eb 64                	jmp    8028d0 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80286c:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  802871:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802876:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80287b:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802880:	77 8c                	ja     80280e <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802882:	eb 36                	jmp    8028ba <memcmp+0x115>
+    if (*s1 != *s2)
+  802884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802888:	0f b6 10             	movzbl (%rax),%edx
+  80288b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80288f:	0f b6 00             	movzbl (%rax),%eax
+  802892:	38 c2                	cmp    %al,%dl
+  802894:	74 1a                	je     8028b0 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289a:	0f b6 00             	movzbl (%rax),%eax
+  80289d:	0f b6 c8             	movzbl %al,%ecx
+  8028a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028a4:	0f b6 00             	movzbl (%rax),%eax
+  8028a7:	0f b6 d0             	movzbl %al,%edx
+  8028aa:	89 c8                	mov    %ecx,%eax
+  8028ac:	29 d0                	sub    %edx,%eax
+  8028ae:	eb 20                	jmp    8028d0 <memcmp+0x12b>
+    s1++, s2++;
+  8028b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8028b5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8028ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028be:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8028c2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8028c6:	48 85 c0             	test   %rax,%rax
+  8028c9:	75 b9                	jne    802884 <memcmp+0xdf>
+  }
+
+  return 0;
+  8028cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+
+00000000008028d2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8028d2:	55                   	push   %rbp
+  8028d3:	48 89 e5             	mov    %rsp,%rbp
+  8028d6:	48 83 ec 50          	sub    $0x50,%rsp
+  8028da:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028de:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8028e1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8028e5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8028e9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8028ed:	48 01 d0             	add    %rdx,%rax
+  8028f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8028f4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8028f7:	66 0f 6e c0          	movd   %eax,%xmm0
+  8028fb:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8028ff:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  802903:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802908:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80290c:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  802911:	76 73                	jbe    802986 <memfind+0xb4>
+  802913:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+  80291f:	83 e0 02             	and    $0x2,%eax
+  802922:	85 c0                	test   %eax,%eax
+  802924:	74 60                	je     802986 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802926:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802929:	0f b6 c8             	movzbl %al,%ecx
+  80292c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802930:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802934:	89 ce                	mov    %ecx,%esi
+  802936:	48 89 c7             	mov    %rax,%rdi
+  802939:	48 b8 7b 1e 80 00 00 	movabs $0x801e7b,%rax
+  802940:	00 00 00 
+  802943:	ff d0                	call   *%rax
+  802945:	eb 6c                	jmp    8029b3 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  802947:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80294f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802953:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802958:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80295c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802960:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802963:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802967:	74 13                	je     80297c <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802969:	31 c0                	xor    %eax,%eax
+  80296b:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802970:	48 63 d0             	movslq %eax,%rdx
+  802973:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802977:	48 01 d0             	add    %rdx,%rax
+  80297a:	eb 37                	jmp    8029b3 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  80297c:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802981:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802986:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  80298b:	77 ba                	ja     802947 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80298d:	eb 13                	jmp    8029a2 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  80298f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802993:	0f b6 00             	movzbl (%rax),%eax
+  802996:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802999:	38 d0                	cmp    %dl,%al
+  80299b:	74 11                	je     8029ae <memfind+0xdc>
+  for (; s < ends; s++)
+  80299d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8029a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029a6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8029aa:	72 e3                	jb     80298f <memfind+0xbd>
+  8029ac:	eb 01                	jmp    8029af <memfind+0xdd>
+      break;
+  8029ae:	90                   	nop
+  return (void *)s;
+  8029af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8029b3:	c9                   	leave
+  8029b4:	c3                   	ret
+
+00000000008029b5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8029b5:	55                   	push   %rbp
+  8029b6:	48 89 e5             	mov    %rsp,%rbp
+  8029b9:	48 83 ec 38          	sub    $0x38,%rsp
+  8029bd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8029c1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8029c5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  8029c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  8029cf:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8029d6:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8029d7:	eb 05                	jmp    8029de <strtol+0x29>
+    s++;
+  8029d9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  8029de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029e2:	0f b6 00             	movzbl (%rax),%eax
+  8029e5:	3c 20                	cmp    $0x20,%al
+  8029e7:	74 f0                	je     8029d9 <strtol+0x24>
+  8029e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029ed:	0f b6 00             	movzbl (%rax),%eax
+  8029f0:	3c 09                	cmp    $0x9,%al
+  8029f2:	74 e5                	je     8029d9 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029f8:	0f b6 00             	movzbl (%rax),%eax
+  8029fb:	3c 2b                	cmp    $0x2b,%al
+  8029fd:	75 07                	jne    802a06 <strtol+0x51>
+    s++;
+  8029ff:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802a04:	eb 17                	jmp    802a1d <strtol+0x68>
+  else if (*s == '-')
+  802a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a0a:	0f b6 00             	movzbl (%rax),%eax
+  802a0d:	3c 2d                	cmp    $0x2d,%al
+  802a0f:	75 0c                	jne    802a1d <strtol+0x68>
+    s++, neg = 1;
+  802a11:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802a16:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802a1d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a21:	74 06                	je     802a29 <strtol+0x74>
+  802a23:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802a27:	75 28                	jne    802a51 <strtol+0x9c>
+  802a29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a2d:	0f b6 00             	movzbl (%rax),%eax
+  802a30:	3c 30                	cmp    $0x30,%al
+  802a32:	75 1d                	jne    802a51 <strtol+0x9c>
+  802a34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a38:	48 83 c0 01          	add    $0x1,%rax
+  802a3c:	0f b6 00             	movzbl (%rax),%eax
+  802a3f:	3c 78                	cmp    $0x78,%al
+  802a41:	75 0e                	jne    802a51 <strtol+0x9c>
+    s += 2, base = 16;
+  802a43:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802a48:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802a4f:	eb 2c                	jmp    802a7d <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802a51:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a55:	75 19                	jne    802a70 <strtol+0xbb>
+  802a57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a5b:	0f b6 00             	movzbl (%rax),%eax
+  802a5e:	3c 30                	cmp    $0x30,%al
+  802a60:	75 0e                	jne    802a70 <strtol+0xbb>
+    s++, base = 8;
+  802a62:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802a67:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802a6e:	eb 0d                	jmp    802a7d <strtol+0xc8>
+  else if (base == 0)
+  802a70:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a74:	75 07                	jne    802a7d <strtol+0xc8>
+    base = 10;
+  802a76:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802a7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a81:	0f b6 00             	movzbl (%rax),%eax
+  802a84:	3c 2f                	cmp    $0x2f,%al
+  802a86:	7e 1d                	jle    802aa5 <strtol+0xf0>
+  802a88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a8c:	0f b6 00             	movzbl (%rax),%eax
+  802a8f:	3c 39                	cmp    $0x39,%al
+  802a91:	7f 12                	jg     802aa5 <strtol+0xf0>
+      dig = *s - '0';
+  802a93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a97:	0f b6 00             	movzbl (%rax),%eax
+  802a9a:	0f be c0             	movsbl %al,%eax
+  802a9d:	83 e8 30             	sub    $0x30,%eax
+  802aa0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802aa3:	eb 4e                	jmp    802af3 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802aa5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aa9:	0f b6 00             	movzbl (%rax),%eax
+  802aac:	3c 60                	cmp    $0x60,%al
+  802aae:	7e 1d                	jle    802acd <strtol+0x118>
+  802ab0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab4:	0f b6 00             	movzbl (%rax),%eax
+  802ab7:	3c 7a                	cmp    $0x7a,%al
+  802ab9:	7f 12                	jg     802acd <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802abb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802abf:	0f b6 00             	movzbl (%rax),%eax
+  802ac2:	0f be c0             	movsbl %al,%eax
+  802ac5:	83 e8 57             	sub    $0x57,%eax
+  802ac8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802acb:	eb 26                	jmp    802af3 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802acd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ad1:	0f b6 00             	movzbl (%rax),%eax
+  802ad4:	3c 40                	cmp    $0x40,%al
+  802ad6:	7e 47                	jle    802b1f <strtol+0x16a>
+  802ad8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802adc:	0f b6 00             	movzbl (%rax),%eax
+  802adf:	3c 5a                	cmp    $0x5a,%al
+  802ae1:	7f 3c                	jg     802b1f <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802ae3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ae7:	0f b6 00             	movzbl (%rax),%eax
+  802aea:	0f be c0             	movsbl %al,%eax
+  802aed:	83 e8 37             	sub    $0x37,%eax
+  802af0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802af3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802af6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802af9:	7d 23                	jge    802b1e <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802afb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802b00:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b03:	48 98                	cltq
+  802b05:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802b0a:	48 89 c2             	mov    %rax,%rdx
+  802b0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b10:	48 98                	cltq
+  802b12:	48 01 d0             	add    %rdx,%rax
+  802b15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802b19:	e9 5f ff ff ff       	jmp    802a7d <strtol+0xc8>
+      break;
+  802b1e:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802b1f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802b24:	74 0b                	je     802b31 <strtol+0x17c>
+    *endptr = (char *)s;
+  802b26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b2a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b2e:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802b31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b35:	74 09                	je     802b40 <strtol+0x18b>
+  802b37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b3b:	48 f7 d8             	neg    %rax
+  802b3e:	eb 04                	jmp    802b44 <strtol+0x18f>
+  802b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+0000000000802b46 <readline_cooked>:
+
+#if !JOS_KERNEL
+// Read a line from a console in cooked mode: the kernel does the
+// echoing and editing and returns the whole line in one read.
+static char *
+readline_cooked(int mode) {
+  802b46:	55                   	push   %rbp
+  802b47:	48 89 e5             	mov    %rsp,%rbp
+  802b4a:	48 83 ec 20          	sub    $0x20,%rsp
+  802b4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+
+  r = read(0, buf, BUFLEN - 1);
+  802b51:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  802b56:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802b5d:	00 00 00 
+  802b60:	48 89 c6             	mov    %rax,%rsi
+  802b63:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b68:	48 b8 ab 48 80 00 00 	movabs $0x8048ab,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+  802b74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  consmode(0, mode);
+  802b77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b7a:	89 c6                	mov    %eax,%esi
+  802b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b81:	48 b8 89 0b 80 00 00 	movabs $0x800b89,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+  if (r < 0) {
+  802b8d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b91:	79 2a                	jns    802bbd <readline_cooked+0x77>
+    cprintf("read error: %i\n", r);
+  802b93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b96:	89 c6                	mov    %eax,%esi
+  802b98:	48 b8 68 89 80 00 00 	movabs $0x808968,%rax
+  802b9f:	00 00 00 
+  802ba2:	48 89 c7             	mov    %rax,%rdi
+  802ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baa:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  802bb1:	00 00 00 
+  802bb4:	ff d2                	call   *%rdx
+    return NULL;
+  802bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbb:	eb 48                	jmp    802c05 <readline_cooked+0xbf>
+  }
+  if (r == 0)
+  802bbd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bc1:	75 07                	jne    802bca <readline_cooked+0x84>
+    return NULL;
+  802bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc8:	eb 3b                	jmp    802c05 <readline_cooked+0xbf>
+  if (buf[r - 1] == '\n')
+  802bca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bcd:	83 e8 01             	sub    $0x1,%eax
+  802bd0:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  802bd7:	00 00 00 
+  802bda:	48 98                	cltq
+  802bdc:	0f b6 04 02          	movzbl (%rdx,%rax,1),%eax
+  802be0:	3c 0a                	cmp    $0xa,%al
+  802be2:	75 04                	jne    802be8 <readline_cooked+0xa2>
+    r--;
+  802be4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+  buf[r] = 0;
+  802be8:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  802bef:	00 00 00 
+  802bf2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bf5:	48 98                	cltq
+  802bf7:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+  return buf;
+  802bfb:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802c02:	00 00 00 
+}
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+
+0000000000802c07 <readline>:
+#endif
+
+char *
+readline(const char *prompt) {
+  802c07:	55                   	push   %rbp
+  802c08:	48 89 e5             	mov    %rsp,%rbp
+  802c0b:	48 83 ec 20          	sub    $0x20,%rsp
+  802c0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i, c, echoing;
+
+  if (prompt != NULL) {
+  802c13:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802c18:	74 2a                	je     802c44 <readline+0x3d>
+#if JOS_KERNEL
+    cprintf("%s", prompt);
+#else
+    fprintf(1, "%s", prompt);
+  802c1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c1e:	48 89 c2             	mov    %rax,%rdx
+  802c21:	48 b8 78 89 80 00 00 	movabs $0x808978,%rax
+  802c28:	00 00 00 
+  802c2b:	48 89 c6             	mov    %rax,%rsi
+  802c2e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c38:	48 b9 f6 58 80 00 00 	movabs $0x8058f6,%rcx
+  802c3f:	00 00 00 
+  802c42:	ff d1                	call   *%rcx
+#endif
+  }
+
+#if !JOS_KERNEL
+  if ((c = consmode(0, CONS_COOKED)) >= 0)
+  802c44:	be 01 00 00 00       	mov    $0x1,%esi
+  802c49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4e:	48 b8 89 0b 80 00 00 	movabs $0x800b89,%rax
+  802c55:	00 00 00 
+  802c58:	ff d0                	call   *%rax
+  802c5a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  802c5d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802c61:	78 16                	js     802c79 <readline+0x72>
+    return readline_cooked(c);
+  802c63:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802c66:	89 c7                	mov    %eax,%edi
+  802c68:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+  802c74:	e9 4b 01 00 00       	jmp    802dc4 <readline+0x1bd>
+#endif
+
+  i       = 0;
+  802c79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  echoing = iscons(0);
+  802c80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c85:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  802c8c:	00 00 00 
+  802c8f:	ff d0                	call   *%rax
+  802c91:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  while (1) {
+    c = getchar();
+  802c94:	48 b8 62 0a 80 00 00 	movabs $0x800a62,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+  802ca0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (c < 0) {
+  802ca3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802ca7:	79 33                	jns    802cdc <readline+0xd5>
+      if (c != -E_EOF)
+  802ca9:	83 7d f8 f5          	cmpl   $0xfffffff5,-0x8(%rbp)
+  802cad:	74 23                	je     802cd2 <readline+0xcb>
+        cprintf("read error: %i\n", c);
+  802caf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802cb2:	89 c6                	mov    %eax,%esi
+  802cb4:	48 b8 68 89 80 00 00 	movabs $0x808968,%rax
+  802cbb:	00 00 00 
+  802cbe:	48 89 c7             	mov    %rax,%rdi
+  802cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc6:	48 ba 78 10 80 00 00 	movabs $0x801078,%rdx
+  802ccd:	00 00 00 
+  802cd0:	ff d2                	call   *%rdx
+      return NULL;
+  802cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd7:	e9 e8 00 00 00       	jmp    802dc4 <readline+0x1bd>
+    } else if ((c == '\b' || c == '\x7f')) {
+  802cdc:	83 7d f8 08          	cmpl   $0x8,-0x8(%rbp)
+  802ce0:	74 06                	je     802ce8 <readline+0xe1>
+  802ce2:	83 7d f8 7f          	cmpl   $0x7f,-0x8(%rbp)
+  802ce6:	75 4c                	jne    802d34 <readline+0x12d>
+      if (i > 0) {
+  802ce8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cec:	0f 8e cd 00 00 00    	jle    802dbf <readline+0x1b8>
+        if (echoing) {
+  802cf2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802cf6:	74 33                	je     802d2b <readline+0x124>
+          cputchar('\b');
+  802cf8:	bf 08 00 00 00       	mov    $0x8,%edi
+  802cfd:	48 b8 36 0a 80 00 00 	movabs $0x800a36,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+          cputchar(' ');
+  802d09:	bf 20 00 00 00       	mov    $0x20,%edi
+  802d0e:	48 b8 36 0a 80 00 00 	movabs $0x800a36,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+          cputchar('\b');
+  802d1a:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d1f:	48 b8 36 0a 80 00 00 	movabs $0x800a36,%rax
+  802d26:	00 00 00 
+  802d29:	ff d0                	call   *%rax
+        }
+        i--;
+  802d2b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+      if (i > 0) {
+  802d2f:	e9 8b 00 00 00       	jmp    802dbf <readline+0x1b8>
+      }
+    } else if (c >= ' ' && i < BUFLEN - 1) {
+  802d34:	83 7d f8 1f          	cmpl   $0x1f,-0x8(%rbp)
+  802d38:	7e 3f                	jle    802d79 <readline+0x172>
+  802d3a:	81 7d fc fe 03 00 00 	cmpl   $0x3fe,-0x4(%rbp)
+  802d41:	7f 36                	jg     802d79 <readline+0x172>
+      if (echoing)
+  802d43:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802d47:	74 11                	je     802d5a <readline+0x153>
+        cputchar(c);
+  802d49:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802d4c:	89 c7                	mov    %eax,%edi
+  802d4e:	48 b8 36 0a 80 00 00 	movabs $0x800a36,%rax
+  802d55:	00 00 00 
+  802d58:	ff d0                	call   *%rax
+      buf[i++] = c;
+  802d5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d5d:	8d 50 01             	lea    0x1(%rax),%edx
+  802d60:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  802d63:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d66:	89 d1                	mov    %edx,%ecx
+  802d68:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  802d6f:	00 00 00 
+  802d72:	48 98                	cltq
+  802d74:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  802d77:	eb 46                	jmp    802dbf <readline+0x1b8>
+    } else if (c == '\n' || c == '\r') {
+  802d79:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+  802d7d:	74 0a                	je     802d89 <readline+0x182>
+  802d7f:	83 7d f8 0d          	cmpl   $0xd,-0x8(%rbp)
+  802d83:	0f 85 0b ff ff ff    	jne    802c94 <readline+0x8d>
+      if (echoing)
+  802d89:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802d8d:	74 11                	je     802da0 <readline+0x199>
+        cputchar('\n');
+  802d8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802d94:	48 b8 36 0a 80 00 00 	movabs $0x800a36,%rax
+  802d9b:	00 00 00 
+  802d9e:	ff d0                	call   *%rax
+      buf[i] = 0;
+  802da0:	48 ba 20 a0 80 00 00 	movabs $0x80a020,%rdx
+  802da7:	00 00 00 
+  802daa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dad:	48 98                	cltq
+  802daf:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+      return buf;
+  802db3:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  802dba:	00 00 00 
+  802dbd:	eb 05                	jmp    802dc4 <readline+0x1bd>
+    c = getchar();
+  802dbf:	e9 d0 fe ff ff       	jmp    802c94 <readline+0x8d>
+    }
+  }
+}
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+
+0000000000802dc6 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802dc6:	55                   	push   %rbp
+  802dc7:	48 89 e5             	mov    %rsp,%rbp
+  802dca:	53                   	push   %rbx
+  802dcb:	48 83 ec 48          	sub    $0x48,%rsp
+  802dcf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802dd3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802dd7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802ddb:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802ddf:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802de3:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802de7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802deb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802def:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802df3:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802df7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802dfb:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802dff:	4c 89 c3             	mov    %r8,%rbx
+  802e02:	cd 30                	int    $0x30
+  802e04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802e08:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802e0d:	74 46                	je     802e55 <syscall+0x8f>
+  802e0f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802e14:	7e 3f                	jle    802e55 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802e16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802e1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e1e:	49 89 d0             	mov    %rdx,%r8
+  802e21:	48 89 c1             	mov    %rax,%rcx
+  802e24:	48 b8 80 89 80 00 00 	movabs $0x808980,%rax
+  802e2b:	00 00 00 
+  802e2e:	48 89 c2             	mov    %rax,%rdx
+  802e31:	be 22 00 00 00       	mov    $0x22,%esi
+  802e36:	48 b8 9f 89 80 00 00 	movabs $0x80899f,%rax
+  802e3d:	00 00 00 
+  802e40:	48 89 c7             	mov    %rax,%rdi
+  802e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e48:	49 b9 59 0e 80 00 00 	movabs $0x800e59,%r9
+  802e4f:	00 00 00 
+  802e52:	41 ff d1             	call   *%r9
+
+  return ret;
+  802e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802e59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e5d:	c9                   	leave
+  802e5e:	c3                   	ret
+
+0000000000802e5f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802e5f:	55                   	push   %rbp
+  802e60:	48 89 e5             	mov    %rsp,%rbp
+  802e63:	48 83 ec 10          	sub    $0x10,%rsp
+  802e67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802e6f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802e73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e77:	48 83 ec 08          	sub    $0x8,%rsp
+  802e7b:	6a 00                	push   $0x0
+  802e7d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e89:	48 89 d1             	mov    %rdx,%rcx
+  802e8c:	48 89 c2             	mov    %rax,%rdx
+  802e8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e99:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  802ea0:	00 00 00 
+  802ea3:	ff d0                	call   *%rax
+  802ea5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ea9:	90                   	nop
+  802eaa:	c9                   	leave
+  802eab:	c3                   	ret
+
+0000000000802eac <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802eac:	55                   	push   %rbp
+  802ead:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802eb0:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb4:	6a 00                	push   $0x0
+  802eb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ebc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ec2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ecc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed1:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ed6:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  802edd:	00 00 00 
+  802ee0:	ff d0                	call   *%rax
+  802ee2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ee6:	c9                   	leave
+  802ee7:	c3                   	ret
+
+0000000000802ee8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802ee8:	55                   	push   %rbp
+  802ee9:	48 89 e5             	mov    %rsp,%rbp
+  802eec:	48 83 ec 10          	sub    $0x10,%rsp
+  802ef0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802ef3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ef6:	48 98                	cltq
+  802ef8:	48 83 ec 08          	sub    $0x8,%rsp
+  802efc:	6a 00                	push   $0x0
+  802efe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f0f:	48 89 c2             	mov    %rax,%rdx
+  802f12:	be 01 00 00 00       	mov    $0x1,%esi
+  802f17:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f1c:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  802f23:	00 00 00 
+  802f26:	ff d0                	call   *%rax
+  802f28:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f2c:	c9                   	leave
+  802f2d:	c3                   	ret
+
+0000000000802f2e <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	48 83 ec 10          	sub    $0x10,%rsp
+  802f36:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802f39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f3c:	48 98                	cltq
+  802f3e:	48 83 ec 08          	sub    $0x8,%rsp
+  802f42:	6a 00                	push   $0x0
+  802f44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f55:	48 89 c2             	mov    %rax,%rdx
+  802f58:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802f62:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f72:	90                   	nop
+  802f73:	c9                   	leave
+  802f74:	c3                   	ret
+
+0000000000802f75 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	48 83 ec 20          	sub    $0x20,%rsp
+  802f7d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f80:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802f84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f87:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802f8a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802f8f:	cd 30                	int    $0x30
+  802f91:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802f95:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802f99:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802f9e:	7e 3d                	jle    802fdd <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802fa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa4:	49 89 c0             	mov    %rax,%r8
+  802fa7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802fac:	48 b8 80 89 80 00 00 	movabs $0x808980,%rax
+  802fb3:	00 00 00 
+  802fb6:	48 89 c2             	mov    %rax,%rdx
+  802fb9:	be 49 00 00 00       	mov    $0x49,%esi
+  802fbe:	48 b8 9f 89 80 00 00 	movabs $0x80899f,%rax
+  802fc5:	00 00 00 
+  802fc8:	48 89 c7             	mov    %rax,%rdi
+  802fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd0:	49 b9 59 0e 80 00 00 	movabs $0x800e59,%r9
+  802fd7:	00 00 00 
+  802fda:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802fdd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802fe2:	75 13                	jne    802ff7 <sys_env_wait+0x82>
+  802fe4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802fe9:	74 0c                	je     802ff7 <sys_env_wait+0x82>
+    *status = st;
+  802feb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fef:	89 c2                	mov    %eax,%edx
+  802ff1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ff5:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802ff7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802ffb:	c9                   	leave
+  802ffc:	c3                   	ret
+
+0000000000802ffd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802ffd:	55                   	push   %rbp
+  802ffe:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  803001:	48 83 ec 08          	sub    $0x8,%rsp
+  803005:	6a 00                	push   $0x0
+  803007:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80300d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803013:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301d:	be 00 00 00 00       	mov    $0x0,%esi
+  803022:	bf 02 00 00 00       	mov    $0x2,%edi
+  803027:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80302e:	00 00 00 
+  803031:	ff d0                	call   *%rax
+  803033:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803037:	c9                   	leave
+  803038:	c3                   	ret
+
+0000000000803039 <sys_yield>:
+
+void
+sys_yield(void) {
+  803039:	55                   	push   %rbp
+  80303a:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80303d:	48 83 ec 08          	sub    $0x8,%rsp
+  803041:	6a 00                	push   $0x0
+  803043:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803049:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80304f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803054:	ba 00 00 00 00       	mov    $0x0,%edx
+  803059:	be 00 00 00 00       	mov    $0x0,%esi
+  80305e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803063:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+  80306f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803073:	90                   	nop
+  803074:	c9                   	leave
+  803075:	c3                   	ret
+
+0000000000803076 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  803076:	55                   	push   %rbp
+  803077:	48 89 e5             	mov    %rsp,%rbp
+  80307a:	48 83 ec 20          	sub    $0x20,%rsp
+  80307e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803081:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803085:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  803088:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80308b:	48 63 c8             	movslq %eax,%rcx
+  80308e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803092:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803095:	48 98                	cltq
+  803097:	48 83 ec 08          	sub    $0x8,%rsp
+  80309b:	6a 00                	push   $0x0
+  80309d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030a3:	49 89 c8             	mov    %rcx,%r8
+  8030a6:	48 89 d1             	mov    %rdx,%rcx
+  8030a9:	48 89 c2             	mov    %rax,%rdx
+  8030ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8030b1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8030b6:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+  8030c2:	48 83 c4 10          	add    $0x10,%rsp
+  8030c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8030c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030cc:	c9                   	leave
+  8030cd:	c3                   	ret
+
+00000000008030ce <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8030ce:	55                   	push   %rbp
+  8030cf:	48 89 e5             	mov    %rsp,%rbp
+  8030d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8030d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8030dd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8030e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8030e4:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8030e8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030eb:	48 63 c8             	movslq %eax,%rcx
+  8030ee:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8030f2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8030f5:	48 63 f0             	movslq %eax,%rsi
+  8030f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ff:	48 98                	cltq
+  803101:	48 83 ec 08          	sub    $0x8,%rsp
+  803105:	51                   	push   %rcx
+  803106:	49 89 f9             	mov    %rdi,%r9
+  803109:	49 89 f0             	mov    %rsi,%r8
+  80310c:	48 89 d1             	mov    %rdx,%rcx
+  80310f:	48 89 c2             	mov    %rax,%rdx
+  803112:	be 01 00 00 00       	mov    $0x1,%esi
+  803117:	bf 07 00 00 00       	mov    $0x7,%edi
+  80311c:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  803128:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+
+000000000080312e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80312e:	55                   	push   %rbp
+  80312f:	48 89 e5             	mov    %rsp,%rbp
+  803132:	48 83 ec 10          	sub    $0x10,%rsp
+  803136:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803139:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80313d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803141:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803144:	48 98                	cltq
+  803146:	48 83 ec 08          	sub    $0x8,%rsp
+  80314a:	6a 00                	push   $0x0
+  80314c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803158:	48 89 d1             	mov    %rdx,%rcx
+  80315b:	48 89 c2             	mov    %rax,%rdx
+  80315e:	be 01 00 00 00       	mov    $0x1,%esi
+  803163:	bf 08 00 00 00       	mov    $0x8,%edi
+  803168:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80316f:	00 00 00 
+  803172:	ff d0                	call   *%rax
+  803174:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803178:	c9                   	leave
+  803179:	c3                   	ret
+
+000000000080317a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80317a:	55                   	push   %rbp
+  80317b:	48 89 e5             	mov    %rsp,%rbp
+  80317e:	48 83 ec 10          	sub    $0x10,%rsp
+  803182:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803185:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  803188:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80318b:	48 63 d0             	movslq %eax,%rdx
+  80318e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803191:	48 98                	cltq
+  803193:	48 83 ec 08          	sub    $0x8,%rsp
+  803197:	6a 00                	push   $0x0
+  803199:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80319f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031a5:	48 89 d1             	mov    %rdx,%rcx
+  8031a8:	48 89 c2             	mov    %rax,%rdx
+  8031ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8031b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8031b5:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8031bc:	00 00 00 
+  8031bf:	ff d0                	call   *%rax
+  8031c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031c5:	c9                   	leave
+  8031c6:	c3                   	ret
+
+00000000008031c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8031c7:	55                   	push   %rbp
+  8031c8:	48 89 e5             	mov    %rsp,%rbp
+  8031cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8031cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8031d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8031d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8031da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031dd:	48 98                	cltq
+  8031df:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e3:	6a 00                	push   $0x0
+  8031e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031f1:	48 89 d1             	mov    %rdx,%rcx
+  8031f4:	48 89 c2             	mov    %rax,%rdx
+  8031f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8031fc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803201:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803208:	00 00 00 
+  80320b:	ff d0                	call   *%rax
+  80320d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803211:	c9                   	leave
+  803212:	c3                   	ret
+
+0000000000803213 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803213:	55                   	push   %rbp
+  803214:	48 89 e5             	mov    %rsp,%rbp
+  803217:	48 83 ec 10          	sub    $0x10,%rsp
+  80321b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80321e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  803222:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803226:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803229:	48 98                	cltq
+  80322b:	48 83 ec 08          	sub    $0x8,%rsp
+  80322f:	6a 00                	push   $0x0
+  803231:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803237:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80323d:	48 89 d1             	mov    %rdx,%rcx
+  803240:	48 89 c2             	mov    %rax,%rdx
+  803243:	be 01 00 00 00       	mov    $0x1,%esi
+  803248:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80324d:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+  803259:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80325d:	c9                   	leave
+  80325e:	c3                   	ret
+
+000000000080325f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	48 83 ec 20          	sub    $0x20,%rsp
+  803267:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80326a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80326e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803272:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  803275:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803278:	48 63 f0             	movslq %eax,%rsi
+  80327b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80327f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803283:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803286:	48 98                	cltq
+  803288:	48 83 ec 08          	sub    $0x8,%rsp
+  80328c:	6a 00                	push   $0x0
+  80328e:	49 89 f1             	mov    %rsi,%r9
+  803291:	49 89 c8             	mov    %rcx,%r8
+  803294:	48 89 d1             	mov    %rdx,%rcx
+  803297:	48 89 c2             	mov    %rax,%rdx
+  80329a:	be 00 00 00 00       	mov    $0x0,%esi
+  80329f:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8032a4:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8032ab:	00 00 00 
+  8032ae:	ff d0                	call   *%rax
+  8032b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032b4:	c9                   	leave
+  8032b5:	c3                   	ret
+
+00000000008032b6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8032b6:	55                   	push   %rbp
+  8032b7:	48 89 e5             	mov    %rsp,%rbp
+  8032ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8032be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8032c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8032ca:	6a 00                	push   $0x0
+  8032cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8032d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032dd:	48 89 c2             	mov    %rax,%rdx
+  8032e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8032e5:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8032ea:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8032f1:	00 00 00 
+  8032f4:	ff d0                	call   *%rax
+  8032f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032fa:	c9                   	leave
+  8032fb:	c3                   	ret
+
+00000000008032fc <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8032fc:	55                   	push   %rbp
+  8032fd:	48 89 e5             	mov    %rsp,%rbp
+  803300:	48 83 ec 10          	sub    $0x10,%rsp
+  803304:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803308:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80330c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803314:	48 83 ec 08          	sub    $0x8,%rsp
+  803318:	6a 00                	push   $0x0
+  80331a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803320:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803326:	48 89 d1             	mov    %rdx,%rcx
+  803329:	48 89 c2             	mov    %rax,%rdx
+  80332c:	be 01 00 00 00       	mov    $0x1,%esi
+  803331:	bf 10 00 00 00       	mov    $0x10,%edi
+  803336:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+  803342:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803346:	c9                   	leave
+  803347:	c3                   	ret
+
+0000000000803348 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803348:	55                   	push   %rbp
+  803349:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80334c:	48 83 ec 08          	sub    $0x8,%rsp
+  803350:	6a 00                	push   $0x0
+  803352:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80335e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803363:	ba 00 00 00 00       	mov    $0x0,%edx
+  803368:	be 00 00 00 00       	mov    $0x0,%esi
+  80336d:	bf 11 00 00 00       	mov    $0x11,%edi
+  803372:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+  80337e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803382:	c9                   	leave
+  803383:	c3                   	ret
+
+0000000000803384 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  803384:	55                   	push   %rbp
+  803385:	48 89 e5             	mov    %rsp,%rbp
+  803388:	48 83 ec 10          	sub    $0x10,%rsp
+  80338c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803390:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  803394:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339c:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a0:	6a 00                	push   $0x0
+  8033a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033ae:	48 89 d1             	mov    %rdx,%rcx
+  8033b1:	48 89 c2             	mov    %rax,%rdx
+  8033b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b9:	bf 12 00 00 00       	mov    $0x12,%edi
+  8033be:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8033c5:	00 00 00 
+  8033c8:	ff d0                	call   *%rax
+  8033ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+
+00000000008033d0 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8033d0:	55                   	push   %rbp
+  8033d1:	48 89 e5             	mov    %rsp,%rbp
+  8033d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8033d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8033e0:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8033e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033e6:	48 63 c8             	movslq %eax,%rcx
+  8033e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f5:	6a 00                	push   $0x0
+  8033f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033fd:	49 89 c8             	mov    %rcx,%r8
+  803400:	48 89 d1             	mov    %rdx,%rcx
+  803403:	48 89 c2             	mov    %rax,%rdx
+  803406:	be 00 00 00 00       	mov    $0x0,%esi
+  80340b:	bf 13 00 00 00       	mov    $0x13,%edi
+  803410:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+  80341c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803420:	c9                   	leave
+  803421:	c3                   	ret
+
+0000000000803422 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  803422:	55                   	push   %rbp
+  803423:	48 89 e5             	mov    %rsp,%rbp
+  803426:	48 83 ec 20          	sub    $0x20,%rsp
+  80342a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80342e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803431:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  803435:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803439:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80343c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803440:	48 83 ec 08          	sub    $0x8,%rsp
+  803444:	6a 00                	push   $0x0
+  803446:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80344c:	49 89 c8             	mov    %rcx,%r8
+  80344f:	48 89 d1             	mov    %rdx,%rcx
+  803452:	48 89 c2             	mov    %rax,%rdx
+  803455:	be 00 00 00 00       	mov    $0x0,%esi
+  80345a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80345f:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+  80346b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80346f:	c9                   	leave
+  803470:	c3                   	ret
+
+0000000000803471 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  803471:	55                   	push   %rbp
+  803472:	48 89 e5             	mov    %rsp,%rbp
+  803475:	48 83 ec 10          	sub    $0x10,%rsp
+  803479:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80347d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  803480:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803483:	48 63 d0             	movslq %eax,%rdx
+  803486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80348a:	48 83 ec 08          	sub    $0x8,%rsp
+  80348e:	6a 00                	push   $0x0
+  803490:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803496:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80349c:	48 89 d1             	mov    %rdx,%rcx
+  80349f:	48 89 c2             	mov    %rax,%rdx
+  8034a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a7:	bf 15 00 00 00       	mov    $0x15,%edi
+  8034ac:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8034b3:	00 00 00 
+  8034b6:	ff d0                	call   *%rax
+  8034b8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8034bc:	c9                   	leave
+  8034bd:	c3                   	ret
+
+00000000008034be <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8034be:	55                   	push   %rbp
+  8034bf:	48 89 e5             	mov    %rsp,%rbp
+  8034c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8034c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8034ca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8034cd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8034d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8034d4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8034d8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8034db:	48 63 c8             	movslq %eax,%rcx
+  8034de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034e1:	48 63 d0             	movslq %eax,%rdx
+  8034e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ec:	6a 00                	push   $0x0
+  8034ee:	49 89 f1             	mov    %rsi,%r9
+  8034f1:	49 89 c8             	mov    %rcx,%r8
+  8034f4:	48 89 d1             	mov    %rdx,%rcx
+  8034f7:	48 89 c2             	mov    %rax,%rdx
+  8034fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8034ff:	bf 16 00 00 00       	mov    $0x16,%edi
+  803504:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80350b:	00 00 00 
+  80350e:	ff d0                	call   *%rax
+  803510:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803514:	c9                   	leave
+  803515:	c3                   	ret
+
+0000000000803516 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  803516:	55                   	push   %rbp
+  803517:	48 89 e5             	mov    %rsp,%rbp
+  80351a:	48 83 ec 30          	sub    $0x30,%rsp
+  80351e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803522:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803526:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80352a:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80352e:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  803532:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803536:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80353a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80353e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803546:	48 83 ec 08          	sub    $0x8,%rsp
+  80354a:	51                   	push   %rcx
+  80354b:	49 89 f9             	mov    %rdi,%r9
+  80354e:	49 89 f0             	mov    %rsi,%r8
+  803551:	48 89 d1             	mov    %rdx,%rcx
+  803554:	48 89 c2             	mov    %rax,%rdx
+  803557:	be 00 00 00 00       	mov    $0x0,%esi
+  80355c:	bf 17 00 00 00       	mov    $0x17,%edi
+  803561:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+  80356d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803571:	c9                   	leave
+  803572:	c3                   	ret
+
+0000000000803573 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+  803577:	48 83 ec 10          	sub    $0x10,%rsp
+  80357b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80357e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803581:	48 98                	cltq
+  803583:	48 83 ec 08          	sub    $0x8,%rsp
+  803587:	6a 00                	push   $0x0
+  803589:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80358f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803595:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80359a:	48 89 c2             	mov    %rax,%rdx
+  80359d:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a2:	bf 18 00 00 00       	mov    $0x18,%edi
+  8035a7:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8035ae:	00 00 00 
+  8035b1:	ff d0                	call   *%rax
+  8035b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8035b7:	90                   	nop
+  8035b8:	c9                   	leave
+  8035b9:	c3                   	ret
+
+00000000008035ba <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8035ba:	55                   	push   %rbp
+  8035bb:	48 89 e5             	mov    %rsp,%rbp
+  8035be:	48 83 ec 30          	sub    $0x30,%rsp
+  8035c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035c9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8035cd:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8035d0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8035d3:	48 63 f0             	movslq %eax,%rsi
+  8035d6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8035da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035e1:	48 98                	cltq
+  8035e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	49 89 f1             	mov    %rsi,%r9
+  8035ec:	49 89 c8             	mov    %rcx,%r8
+  8035ef:	48 89 d1             	mov    %rdx,%rcx
+  8035f2:	48 89 c2             	mov    %rax,%rdx
+  8035f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8035fa:	bf 19 00 00 00       	mov    $0x19,%edi
+  8035ff:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+  80360b:	48 83 c4 10          	add    $0x10,%rsp
+  80360f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  803612:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803615:	c9                   	leave
+  803616:	c3                   	ret
+
+0000000000803617 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  803617:	55                   	push   %rbp
+  803618:	48 89 e5             	mov    %rsp,%rbp
+  80361b:	48 83 ec 20          	sub    $0x20,%rsp
+  80361f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803623:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803627:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80362a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80362d:	48 63 c8             	movslq %eax,%rcx
+  803630:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803638:	48 83 ec 08          	sub    $0x8,%rsp
+  80363c:	6a 00                	push   $0x0
+  80363e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803644:	49 89 c8             	mov    %rcx,%r8
+  803647:	48 89 d1             	mov    %rdx,%rcx
+  80364a:	48 89 c2             	mov    %rax,%rdx
+  80364d:	be 01 00 00 00       	mov    $0x1,%esi
+  803652:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  803657:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  80365e:	00 00 00 
+  803661:	ff d0                	call   *%rax
+  803663:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803667:	c9                   	leave
+  803668:	c3                   	ret
+
+0000000000803669 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  803669:	55                   	push   %rbp
+  80366a:	48 89 e5             	mov    %rsp,%rbp
+  80366d:	48 83 ec 20          	sub    $0x20,%rsp
+  803671:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803675:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803679:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  80367d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803681:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803689:	48 83 ec 08          	sub    $0x8,%rsp
+  80368d:	6a 00                	push   $0x0
+  80368f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803695:	49 89 c8             	mov    %rcx,%r8
+  803698:	48 89 d1             	mov    %rdx,%rcx
+  80369b:	48 89 c2             	mov    %rax,%rdx
+  80369e:	be 01 00 00 00       	mov    $0x1,%esi
+  8036a3:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8036a8:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  8036af:	00 00 00 
+  8036b2:	ff d0                	call   *%rax
+  8036b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8036b8:	c9                   	leave
+  8036b9:	c3                   	ret
+
+00000000008036ba <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8036ba:	55                   	push   %rbp
+  8036bb:	48 89 e5             	mov    %rsp,%rbp
+  8036be:	48 83 ec 30          	sub    $0x30,%rsp
+  8036c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8036c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8036ca:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8036cd:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8036d1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8036d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036d8:	48 63 c8             	movslq %eax,%rcx
+  8036db:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8036e7:	6a 00                	push   $0x0
+  8036e9:	49 89 f1             	mov    %rsi,%r9
+  8036ec:	49 89 c8             	mov    %rcx,%r8
+  8036ef:	48 89 d1             	mov    %rdx,%rcx
+  8036f2:	48 89 c2             	mov    %rax,%rdx
+  8036f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8036fa:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8036ff:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803706:	00 00 00 
+  803709:	ff d0                	call   *%rax
+  80370b:	48 83 c4 10          	add    $0x10,%rsp
+  80370f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  803712:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803715:	c9                   	leave
+  803716:	c3                   	ret
+
+0000000000803717 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  803717:	55                   	push   %rbp
+  803718:	48 89 e5             	mov    %rsp,%rbp
+  80371b:	48 83 ec 10          	sub    $0x10,%rsp
+  80371f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  803722:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803725:	48 98                	cltq
+  803727:	48 83 ec 08          	sub    $0x8,%rsp
+  80372b:	6a 00                	push   $0x0
+  80372d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803733:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80373e:	48 89 c2             	mov    %rax,%rdx
+  803741:	be 01 00 00 00       	mov    $0x1,%esi
+  803746:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80374b:	48 b8 c6 2d 80 00 00 	movabs $0x802dc6,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+  803757:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80375b:	c9                   	leave
+  80375c:	c3                   	ret
+
+000000000080375d <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  80375d:	55                   	push   %rbp
+  80375e:	48 89 e5             	mov    %rsp,%rbp
+  803761:	48 83 ec 40          	sub    $0x40,%rsp
+  803765:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  803769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80376d:	48 8b 00             	mov    (%rax),%rax
+  803770:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  803774:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803778:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80377c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  803780:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803784:	83 e0 02             	and    $0x2,%eax
+  803787:	48 85 c0             	test   %rax,%rax
+  80378a:	74 25                	je     8037b1 <pgfault+0x54>
+  80378c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803790:	48 c1 e8 0c          	shr    $0xc,%rax
+  803794:	48 89 c2             	mov    %rax,%rdx
+  803797:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80379e:	01 00 00 
+  8037a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037a5:	83 e0 02             	and    $0x2,%eax
+  8037a8:	48 85 c0             	test   %rax,%rax
+  8037ab:	0f 85 fe 01 00 00    	jne    8039af <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8037b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037b5:	83 e0 02             	and    $0x2,%eax
+  8037b8:	48 85 c0             	test   %rax,%rax
+  8037bb:	74 23                	je     8037e0 <pgfault+0x83>
+  8037bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037c1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037c5:	48 89 c2             	mov    %rax,%rdx
+  8037c8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037cf:	01 00 00 
+  8037d2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037d6:	25 00 08 00 00       	and    $0x800,%eax
+  8037db:	48 85 c0             	test   %rax,%rax
+  8037de:	75 3f                	jne    80381f <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8037e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037e8:	49 89 d0             	mov    %rdx,%r8
+  8037eb:	48 89 c1             	mov    %rax,%rcx
+  8037ee:	48 b8 b0 89 80 00 00 	movabs $0x8089b0,%rax
+  8037f5:	00 00 00 
+  8037f8:	48 89 c2             	mov    %rax,%rdx
+  8037fb:	be 26 00 00 00       	mov    $0x26,%esi
+  803800:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803807:	00 00 00 
+  80380a:	48 89 c7             	mov    %rax,%rdi
+  80380d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803812:	49 b9 59 0e 80 00 00 	movabs $0x800e59,%r9
+  803819:	00 00 00 
+  80381c:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  80381f:	48 b8 4b 77 80 00 00 	movabs $0x80774b,%rax
+  803826:	00 00 00 
+  803829:	ff d0                	call   *%rax
+  80382b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  80382f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803833:	ba 07 00 00 00       	mov    $0x7,%edx
+  803838:	48 89 c6             	mov    %rax,%rsi
+  80383b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803840:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  803847:	00 00 00 
+  80384a:	ff d0                	call   *%rax
+  80384c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80384f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803853:	79 36                	jns    80388b <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  803855:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803858:	89 c1                	mov    %eax,%ecx
+  80385a:	48 b8 f0 89 80 00 00 	movabs $0x8089f0,%rax
+  803861:	00 00 00 
+  803864:	48 89 c2             	mov    %rax,%rdx
+  803867:	be 35 00 00 00       	mov    $0x35,%esi
+  80386c:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803873:	00 00 00 
+  803876:	48 89 c7             	mov    %rax,%rdi
+  803879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387e:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803885:	00 00 00 
+  803888:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  80388b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80388f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803893:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803897:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80389d:	48 89 c1             	mov    %rax,%rcx
+  8038a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038a9:	48 89 ce             	mov    %rcx,%rsi
+  8038ac:	48 89 c7             	mov    %rax,%rdi
+  8038af:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8038bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038bf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038c3:	48 89 c2             	mov    %rax,%rdx
+  8038c6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038cd:	01 00 00 
+  8038d0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038d4:	25 00 08 00 00       	and    $0x800,%eax
+  8038d9:	48 85 c0             	test   %rax,%rax
+  8038dc:	74 7a                	je     803958 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8038de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038e2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8038e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ea:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8038f0:	48 89 c2             	mov    %rax,%rdx
+  8038f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038f7:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8038fd:	48 89 d1             	mov    %rdx,%rcx
+  803900:	ba 00 00 00 00       	mov    $0x0,%edx
+  803905:	48 89 c6             	mov    %rax,%rsi
+  803908:	bf 00 00 00 00       	mov    $0x0,%edi
+  80390d:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803914:	00 00 00 
+  803917:	ff d0                	call   *%rax
+  803919:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  80391c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803920:	79 36                	jns    803958 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  803922:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803925:	89 c1                	mov    %eax,%ecx
+  803927:	48 b8 18 8a 80 00 00 	movabs $0x808a18,%rax
+  80392e:	00 00 00 
+  803931:	48 89 c2             	mov    %rax,%rdx
+  803934:	be 42 00 00 00       	mov    $0x42,%esi
+  803939:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803940:	00 00 00 
+  803943:	48 89 c7             	mov    %rax,%rdi
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803952:	00 00 00 
+  803955:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  803958:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395c:	48 89 c6             	mov    %rax,%rsi
+  80395f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803964:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+  803970:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803973:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803977:	79 37                	jns    8039b0 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  803979:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80397c:	89 c1                	mov    %eax,%ecx
+  80397e:	48 b8 40 8a 80 00 00 	movabs $0x808a40,%rax
+  803985:	00 00 00 
+  803988:	48 89 c2             	mov    %rax,%rdx
+  80398b:	be 46 00 00 00       	mov    $0x46,%esi
+  803990:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803997:	00 00 00 
+  80399a:	48 89 c7             	mov    %rax,%rdi
+  80399d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a2:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  8039a9:	00 00 00 
+  8039ac:	41 ff d0             	call   *%r8
+    return;
+  8039af:	90                   	nop
+  }
+}
+  8039b0:	c9                   	leave
+  8039b1:	c3                   	ret
+
+00000000008039b2 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  8039b2:	55                   	push   %rbp
+  8039b3:	48 89 e5             	mov    %rsp,%rbp
+  8039b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8039ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  8039c1:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8039c8:	01 00 00 
+  8039cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8039d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  8039dc:	48 b8 fd 2f 80 00 00 	movabs $0x802ffd,%rax
+  8039e3:	00 00 00 
+  8039e6:	ff d0                	call   *%rax
+  8039e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  8039eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039ef:	48 c1 e0 0c          	shl    $0xc,%rax
+  8039f3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  8039f7:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8039fe:	01 00 00 
+  803a01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a05:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a09:	25 00 04 00 00       	and    $0x400,%eax
+  803a0e:	48 85 c0             	test   %rax,%rax
+  803a11:	74 7b                	je     803a8e <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  803a13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a17:	89 c1                	mov    %eax,%ecx
+  803a19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a1d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a21:	48 89 c2             	mov    %rax,%rdx
+  803a24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a28:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a2c:	48 89 c6             	mov    %rax,%rsi
+  803a2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a32:	41 89 c8             	mov    %ecx,%r8d
+  803a35:	48 89 d1             	mov    %rdx,%rcx
+  803a38:	89 c2                	mov    %eax,%edx
+  803a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3f:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803a46:	00 00 00 
+  803a49:	ff d0                	call   *%rax
+  803a4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a52:	0f 89 da 00 00 00    	jns    803b32 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  803a58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a5b:	89 c1                	mov    %eax,%ecx
+  803a5d:	48 b8 68 8a 80 00 00 	movabs $0x808a68,%rax
+  803a64:	00 00 00 
+  803a67:	48 89 c2             	mov    %rax,%rdx
+  803a6a:	be 5f 00 00 00       	mov    $0x5f,%esi
+  803a6f:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803a76:	00 00 00 
+  803a79:	48 89 c7             	mov    %rax,%rdi
+  803a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a81:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803a88:	00 00 00 
+  803a8b:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  803a8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a92:	25 02 08 00 00       	and    $0x802,%eax
+  803a97:	48 85 c0             	test   %rax,%rax
+  803a9a:	74 6e                	je     803b0a <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  803a9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa0:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  803aa6:	80 cc 08             	or     $0x8,%ah
+  803aa9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  803aad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab1:	89 c7                	mov    %eax,%edi
+  803ab3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803ab7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803aba:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803abe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ac1:	41 89 f8             	mov    %edi,%r8d
+  803ac4:	89 c7                	mov    %eax,%edi
+  803ac6:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803acd:	00 00 00 
+  803ad0:	ff d0                	call   *%rax
+  803ad2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  803ad5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ad9:	79 05                	jns    803ae0 <duppage+0x12e>
+      return r;
+  803adb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ade:	eb 55                	jmp    803b35 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  803ae0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ae4:	89 c7                	mov    %eax,%edi
+  803ae6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803aea:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803aed:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803af1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803af4:	41 89 f8             	mov    %edi,%r8d
+  803af7:	89 c7                	mov    %eax,%edi
+  803af9:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803b00:	00 00 00 
+  803b03:	ff d0                	call   *%rax
+  803b05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b08:	eb 28                	jmp    803b32 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  803b0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b0e:	89 c7                	mov    %eax,%edi
+  803b10:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803b14:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b17:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803b1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b1e:	41 89 f8             	mov    %edi,%r8d
+  803b21:	89 c7                	mov    %eax,%edi
+  803b23:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803b2a:	00 00 00 
+  803b2d:	ff d0                	call   *%rax
+  803b2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  803b32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803b35:	c9                   	leave
+  803b36:	c3                   	ret
+
+0000000000803b37 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  803b37:	55                   	push   %rbp
+  803b38:	48 89 e5             	mov    %rsp,%rbp
+  803b3b:	48 83 ec 20          	sub    $0x20,%rsp
+  803b3f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b42:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  803b46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b4a:	48 c1 e0 0c          	shl    $0xc,%rax
+  803b4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  803b52:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  803b59:	01 00 00 
+  803b5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b60:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b64:	25 00 08 00 00       	and    $0x800,%eax
+  803b69:	48 85 c0             	test   %rax,%rax
+  803b6c:	74 0d                	je     803b7b <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  803b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b72:	0f b6 10             	movzbl (%rax),%edx
+  803b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b79:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  803b7b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  803b82:	01 00 00 
+  803b85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b89:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b8d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b92:	89 c6                	mov    %eax,%esi
+  803b94:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803b98:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803b9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b9f:	41 89 f0             	mov    %esi,%r8d
+  803ba2:	48 89 c6             	mov    %rax,%rsi
+  803ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803baa:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  803bb1:	00 00 00 
+  803bb4:	ff d0                	call   *%rax
+}
+  803bb6:	c9                   	leave
+  803bb7:	c3                   	ret
+
+0000000000803bb8 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  803bb8:	55                   	push   %rbp
+  803bb9:	48 89 e5             	mov    %rsp,%rbp
+  803bbc:	48 83 ec 40          	sub    $0x40,%rsp
+  803bc0:	89 f8                	mov    %edi,%eax
+  803bc2:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  803bc5:	48 b8 5d 37 80 00 00 	movabs $0x80375d,%rax
+  803bcc:	00 00 00 
+  803bcf:	48 89 c7             	mov    %rax,%rdi
+  803bd2:	48 b8 81 78 80 00 00 	movabs $0x807881,%rax
+  803bd9:	00 00 00 
+  803bdc:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  803bde:	b8 09 00 00 00       	mov    $0x9,%eax
+  803be3:	cd 30                	int    $0x30
+  803be5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  803be8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  803beb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bf2:	79 36                	jns    803c2a <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  803bf4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf7:	89 c1                	mov    %eax,%ecx
+  803bf9:	48 b8 93 8a 80 00 00 	movabs $0x808a93,%rax
+  803c00:	00 00 00 
+  803c03:	48 89 c2             	mov    %rax,%rdx
+  803c06:	be 8f 00 00 00       	mov    $0x8f,%esi
+  803c0b:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803c12:	00 00 00 
+  803c15:	48 89 c7             	mov    %rax,%rdi
+  803c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c1d:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803c24:	00 00 00 
+  803c27:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  803c2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c2e:	75 0a                	jne    803c3a <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  803c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c35:	e9 d3 02 00 00       	jmp    803f0d <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803c3a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803c41:	00 
+  803c42:	e9 7a 01 00 00       	jmp    803dc1 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  803c47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c4b:	48 c1 e0 0c          	shl    $0xc,%rax
+  803c4f:	48 c1 e8 27          	shr    $0x27,%rax
+  803c53:	48 89 c2             	mov    %rax,%rdx
+  803c56:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803c5d:	01 00 00 
+  803c60:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c64:	83 e0 01             	and    $0x1,%eax
+  803c67:	48 85 c0             	test   %rax,%rax
+  803c6a:	0f 84 4c 01 00 00    	je     803dbc <fork_common+0x204>
+  803c70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c74:	48 c1 e0 0c          	shl    $0xc,%rax
+  803c78:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c7c:	48 89 c2             	mov    %rax,%rdx
+  803c7f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803c86:	01 00 00 
+  803c89:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c8d:	83 e0 01             	and    $0x1,%eax
+  803c90:	48 85 c0             	test   %rax,%rax
+  803c93:	0f 84 23 01 00 00    	je     803dbc <fork_common+0x204>
+  803c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c9d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803ca1:	48 c1 e8 15          	shr    $0x15,%rax
+  803ca5:	48 89 c2             	mov    %rax,%rdx
+  803ca8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803caf:	01 00 00 
+  803cb2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803cb6:	83 e0 01             	and    $0x1,%eax
+  803cb9:	48 85 c0             	test   %rax,%rax
+  803cbc:	0f 84 fa 00 00 00    	je     803dbc <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  803cc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cc6:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803cce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cd2:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  803cd9:	00 00 00 
+  803cdc:	48 39 c2             	cmp    %rax,%rdx
+  803cdf:	0f 82 d7 00 00 00    	jb     803dbc <fork_common+0x204>
+  803ce5:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  803cec:	00 00 00 
+  803cef:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803cf3:	0f 84 c3 00 00 00    	je     803dbc <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803cf9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cfd:	48 89 c7             	mov    %rax,%rdi
+  803d00:	48 b8 07 77 80 00 00 	movabs $0x807707,%rax
+  803d07:	00 00 00 
+  803d0a:	ff d0                	call   *%rax
+  803d0c:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803d0f:	84 c0                	test   %al,%al
+  803d11:	0f 84 a5 00 00 00    	je     803dbc <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803d17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d1b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d1f:	48 89 c2             	mov    %rax,%rdx
+  803d22:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803d29:	01 00 00 
+  803d2c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d30:	83 e0 01             	and    $0x1,%eax
+  803d33:	48 85 c0             	test   %rax,%rax
+  803d36:	0f 84 80 00 00 00    	je     803dbc <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  803d3c:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803d40:	74 4a                	je     803d8c <fork_common+0x1d4>
+  803d42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d46:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803d4d:	00 00 00 
+  803d50:	48 39 c2             	cmp    %rax,%rdx
+  803d53:	73 13                	jae    803d68 <fork_common+0x1b0>
+  803d55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d59:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803d60:	00 00 00 
+  803d63:	48 39 c2             	cmp    %rax,%rdx
+  803d66:	73 24                	jae    803d8c <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  803d68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d6c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d70:	48 89 c2             	mov    %rax,%rdx
+  803d73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d76:	48 89 d6             	mov    %rdx,%rsi
+  803d79:	89 c7                	mov    %eax,%edi
+  803d7b:	48 b8 37 3b 80 00 00 	movabs $0x803b37,%rax
+  803d82:	00 00 00 
+  803d85:	ff d0                	call   *%rax
+  803d87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d8a:	eb 22                	jmp    803dae <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  803d8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d90:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d94:	48 89 c2             	mov    %rax,%rdx
+  803d97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d9a:	48 89 d6             	mov    %rdx,%rsi
+  803d9d:	89 c7                	mov    %eax,%edi
+  803d9f:	48 b8 b2 39 80 00 00 	movabs $0x8039b2,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+  803dab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  803dae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803db2:	79 08                	jns    803dbc <fork_common+0x204>
+            return r;
+  803db4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803db7:	e9 51 01 00 00       	jmp    803f0d <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803dbc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803dc1:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803dc8:	07 
+  803dc9:	0f 86 78 fe ff ff    	jbe    803c47 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  803dcf:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803dd6:	00 00 00 
+  803dd9:	8b 40 04             	mov    0x4(%rax),%eax
+  803ddc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803de1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803de8:	00 00 00 
+  803deb:	48 98                	cltq
+  803ded:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803df4:	48 01 d0             	add    %rdx,%rax
+  803df7:	48 05 00 01 00 00    	add    $0x100,%rax
+  803dfd:	48 8b 10             	mov    (%rax),%rdx
+  803e00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e03:	48 89 d6             	mov    %rdx,%rsi
+  803e06:	89 c7                	mov    %eax,%edi
+  803e08:	48 b8 13 32 80 00 00 	movabs $0x803213,%rax
+  803e0f:	00 00 00 
+  803e12:	ff d0                	call   *%rax
+  803e14:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e1b:	79 36                	jns    803e53 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803e1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e20:	89 c1                	mov    %eax,%ecx
+  803e22:	48 b8 a8 8a 80 00 00 	movabs $0x808aa8,%rax
+  803e29:	00 00 00 
+  803e2c:	48 89 c2             	mov    %rax,%rdx
+  803e2f:	be be 00 00 00       	mov    $0xbe,%esi
+  803e34:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803e3b:	00 00 00 
+  803e3e:	48 89 c7             	mov    %rax,%rdi
+  803e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e46:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803e4d:	00 00 00 
+  803e50:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803e53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e56:	ba 02 00 00 00       	mov    $0x2,%edx
+  803e5b:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803e62:	00 00 00 
+  803e65:	48 89 ce             	mov    %rcx,%rsi
+  803e68:	89 c7                	mov    %eax,%edi
+  803e6a:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  803e71:	00 00 00 
+  803e74:	ff d0                	call   *%rax
+  803e76:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e7d:	79 36                	jns    803eb5 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803e7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e82:	89 c1                	mov    %eax,%ecx
+  803e84:	48 b8 d8 8a 80 00 00 	movabs $0x808ad8,%rax
+  803e8b:	00 00 00 
+  803e8e:	48 89 c2             	mov    %rax,%rdx
+  803e91:	be c1 00 00 00       	mov    $0xc1,%esi
+  803e96:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803e9d:	00 00 00 
+  803ea0:	48 89 c7             	mov    %rax,%rdi
+  803ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea8:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803eaf:	00 00 00 
+  803eb2:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  803eb5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eb8:	be 02 00 00 00       	mov    $0x2,%esi
+  803ebd:	89 c7                	mov    %eax,%edi
+  803ebf:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+  803ecb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ece:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ed2:	79 36                	jns    803f0a <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ed7:	89 c1                	mov    %eax,%ecx
+  803ed9:	48 b8 f8 8a 80 00 00 	movabs $0x808af8,%rax
+  803ee0:	00 00 00 
+  803ee3:	48 89 c2             	mov    %rax,%rdx
+  803ee6:	be d4 00 00 00       	mov    $0xd4,%esi
+  803eeb:	48 b8 de 89 80 00 00 	movabs $0x8089de,%rax
+  803ef2:	00 00 00 
+  803ef5:	48 89 c7             	mov    %rax,%rdi
+  803ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efd:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  803f04:	00 00 00 
+  803f07:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803f0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803f0d:	c9                   	leave
+  803f0e:	c3                   	ret
+
+0000000000803f0f <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803f0f:	55                   	push   %rbp
+  803f10:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f18:	48 b8 b8 3b 80 00 00 	movabs $0x803bb8,%rax
+  803f1f:	00 00 00 
+  803f22:	ff d0                	call   *%rax
+}
+  803f24:	5d                   	pop    %rbp
+  803f25:	c3                   	ret
+
+0000000000803f26 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803f26:	55                   	push   %rbp
+  803f27:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803f2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f2f:	48 b8 b8 3b 80 00 00 	movabs $0x803bb8,%rax
+  803f36:	00 00 00 
+  803f39:	ff d0                	call   *%rax
+}
+  803f3b:	5d                   	pop    %rbp
+  803f3c:	c3                   	ret
+
+0000000000803f3d <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+  803f3d:	55                   	push   %rbp
+  803f3e:	48 89 e5             	mov    %rsp,%rbp
+  803f41:	48 83 ec 18          	sub    $0x18,%rsp
+  803f45:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803f49:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803f4d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  args->argc     = argc;
+  803f51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f59:	48 89 10             	mov    %rdx,(%rax)
+  args->argv     = (const char **)argv;
+  803f5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f64:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  args->curarg   = (*argc > 1 && argv ? "" : 0);
+  803f68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f6c:	8b 00                	mov    (%rax),%eax
+  803f6e:	83 f8 01             	cmp    $0x1,%eax
+  803f71:	7e 13                	jle    803f86 <argstart+0x49>
+  803f73:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803f78:	74 0c                	je     803f86 <argstart+0x49>
+  803f7a:	48 ba 1c 8b 80 00 00 	movabs $0x808b1c,%rdx
+  803f81:	00 00 00 
+  803f84:	eb 05                	jmp    803f8b <argstart+0x4e>
+  803f86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f8f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  args->argvalue = 0;
+  803f93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f97:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  803f9e:	00 
+}
+  803f9f:	90                   	nop
+  803fa0:	c9                   	leave
+  803fa1:	c3                   	ret
+
+0000000000803fa2 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+  803fa2:	55                   	push   %rbp
+  803fa3:	48 89 e5             	mov    %rsp,%rbp
+  803fa6:	48 83 ec 20          	sub    $0x20,%rsp
+  803faa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int arg;
+
+  args->argvalue = 0;
+  803fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb2:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  803fb9:	00 
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  803fba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fbe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803fc2:	48 85 c0             	test   %rax,%rax
+  803fc5:	75 0a                	jne    803fd1 <argnext+0x2f>
+    return -1;
+  803fc7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803fcc:	e9 27 01 00 00       	jmp    8040f8 <argnext+0x156>
+
+  if (!*args->curarg) {
+  803fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fd5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803fd9:	0f b6 00             	movzbl (%rax),%eax
+  803fdc:	84 c0                	test   %al,%al
+  803fde:	0f 85 d5 00 00 00    	jne    8040b9 <argnext+0x117>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1 || args->argv[1][0] != '-' || args->argv[1][1] == '\0')
+  803fe4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fe8:	48 8b 00             	mov    (%rax),%rax
+  803feb:	8b 00                	mov    (%rax),%eax
+  803fed:	83 f8 01             	cmp    $0x1,%eax
+  803ff0:	0f 84 ed 00 00 00    	je     8040e3 <argnext+0x141>
+  803ff6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ffa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803ffe:	48 83 c0 08          	add    $0x8,%rax
+  804002:	48 8b 00             	mov    (%rax),%rax
+  804005:	0f b6 00             	movzbl (%rax),%eax
+  804008:	3c 2d                	cmp    $0x2d,%al
+  80400a:	0f 85 d3 00 00 00    	jne    8040e3 <argnext+0x141>
+  804010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804014:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804018:	48 83 c0 08          	add    $0x8,%rax
+  80401c:	48 8b 00             	mov    (%rax),%rax
+  80401f:	48 83 c0 01          	add    $0x1,%rax
+  804023:	0f b6 00             	movzbl (%rax),%eax
+  804026:	84 c0                	test   %al,%al
+  804028:	0f 84 b5 00 00 00    	je     8040e3 <argnext+0x141>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  80402e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804032:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804036:	48 83 c0 08          	add    $0x8,%rax
+  80403a:	48 8b 00             	mov    (%rax),%rax
+  80403d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804041:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804045:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  804049:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80404d:	48 8b 00             	mov    (%rax),%rax
+  804050:	8b 00                	mov    (%rax),%eax
+  804052:	83 e8 01             	sub    $0x1,%eax
+  804055:	48 98                	cltq
+  804057:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80405e:	00 
+  80405f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804063:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804067:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  80406b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80406f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804073:	48 83 c0 08          	add    $0x8,%rax
+  804077:	48 89 ce             	mov    %rcx,%rsi
+  80407a:	48 89 c7             	mov    %rax,%rdi
+  80407d:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  804084:	00 00 00 
+  804087:	ff d0                	call   *%rax
+    (*args->argc)--;
+  804089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80408d:	48 8b 00             	mov    (%rax),%rax
+  804090:	8b 10                	mov    (%rax),%edx
+  804092:	83 ea 01             	sub    $0x1,%edx
+  804095:	89 10                	mov    %edx,(%rax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  804097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80409b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80409f:	0f b6 00             	movzbl (%rax),%eax
+  8040a2:	3c 2d                	cmp    $0x2d,%al
+  8040a4:	75 13                	jne    8040b9 <argnext+0x117>
+  8040a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040aa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8040ae:	48 83 c0 01          	add    $0x1,%rax
+  8040b2:	0f b6 00             	movzbl (%rax),%eax
+  8040b5:	84 c0                	test   %al,%al
+  8040b7:	74 2d                	je     8040e6 <argnext+0x144>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  8040b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040bd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8040c1:	0f b6 00             	movzbl (%rax),%eax
+  8040c4:	0f b6 c0             	movzbl %al,%eax
+  8040c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  args->curarg++;
+  8040ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8040d2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8040d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040da:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return arg;
+  8040de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8040e1:	eb 15                	jmp    8040f8 <argnext+0x156>
+      goto endofargs;
+  8040e3:	90                   	nop
+  8040e4:	eb 01                	jmp    8040e7 <argnext+0x145>
+      goto endofargs;
+  8040e6:	90                   	nop
+
+endofargs:
+  args->curarg = 0;
+  8040e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040eb:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8040f2:	00 
+  return -1;
+  8040f3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8040f8:	c9                   	leave
+  8040f9:	c3                   	ret
+
+00000000008040fa <argvalue>:
+
+char *
+argvalue(struct Argstate *args) {
+  8040fa:	55                   	push   %rbp
+  8040fb:	48 89 e5             	mov    %rsp,%rbp
+  8040fe:	48 83 ec 10          	sub    $0x10,%rsp
+  804102:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  804106:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80410a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80410e:	48 85 c0             	test   %rax,%rax
+  804111:	74 0a                	je     80411d <argvalue+0x23>
+  804113:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804117:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80411b:	eb 13                	jmp    804130 <argvalue+0x36>
+  80411d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804121:	48 89 c7             	mov    %rax,%rdi
+  804124:	48 b8 32 41 80 00 00 	movabs $0x804132,%rax
+  80412b:	00 00 00 
+  80412e:	ff d0                	call   *%rax
+}
+  804130:	c9                   	leave
+  804131:	c3                   	ret
+
+0000000000804132 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args) {
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+  804136:	48 83 ec 10          	sub    $0x10,%rsp
+  80413a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (!args->curarg)
+  80413e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804142:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804146:	48 85 c0             	test   %rax,%rax
+  804149:	75 0a                	jne    804155 <argnextvalue+0x23>
+    return 0;
+  80414b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804150:	e9 c8 00 00 00       	jmp    80421d <argnextvalue+0xeb>
+  if (*args->curarg) {
+  804155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804159:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80415d:	0f b6 00             	movzbl (%rax),%eax
+  804160:	84 c0                	test   %al,%al
+  804162:	74 27                	je     80418b <argnextvalue+0x59>
+    args->argvalue = args->curarg;
+  804164:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804168:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80416c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804170:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    args->curarg   = "";
+  804174:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804178:	48 be 1c 8b 80 00 00 	movabs $0x808b1c,%rsi
+  80417f:	00 00 00 
+  804182:	48 89 70 10          	mov    %rsi,0x10(%rax)
+  804186:	e9 8a 00 00 00       	jmp    804215 <argnextvalue+0xe3>
+  } else if (*args->argc > 1) {
+  80418b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80418f:	48 8b 00             	mov    (%rax),%rax
+  804192:	8b 00                	mov    (%rax),%eax
+  804194:	83 f8 01             	cmp    $0x1,%eax
+  804197:	7e 64                	jle    8041fd <argnextvalue+0xcb>
+    args->argvalue = args->argv[1];
+  804199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80419d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041a1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a9:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8041ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041b1:	48 8b 00             	mov    (%rax),%rax
+  8041b4:	8b 00                	mov    (%rax),%eax
+  8041b6:	83 e8 01             	sub    $0x1,%eax
+  8041b9:	48 98                	cltq
+  8041bb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8041c2:	00 
+  8041c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041cb:	48 8d 48 10          	lea    0x10(%rax),%rcx
+  8041cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041d7:	48 83 c0 08          	add    $0x8,%rax
+  8041db:	48 89 ce             	mov    %rcx,%rsi
+  8041de:	48 89 c7             	mov    %rax,%rdi
+  8041e1:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  8041e8:	00 00 00 
+  8041eb:	ff d0                	call   *%rax
+    (*args->argc)--;
+  8041ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041f1:	48 8b 00             	mov    (%rax),%rax
+  8041f4:	8b 10                	mov    (%rax),%edx
+  8041f6:	83 ea 01             	sub    $0x1,%edx
+  8041f9:	89 10                	mov    %edx,(%rax)
+  8041fb:	eb 18                	jmp    804215 <argnextvalue+0xe3>
+  } else {
+    args->argvalue = 0;
+  8041fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804201:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  804208:	00 
+    args->curarg   = 0;
+  804209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  804214:	00 
+  }
+  return (char *)args->argvalue;
+  804215:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804219:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  80421d:	c9                   	leave
+  80421e:	c3                   	ret
+
+000000000080421f <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80421f:	55                   	push   %rbp
+  804220:	48 89 e5             	mov    %rsp,%rbp
+  804223:	48 83 ec 08          	sub    $0x8,%rsp
+  804227:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80422b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80422f:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  804236:	ff ff ff 
+  804239:	48 01 d0             	add    %rdx,%rax
+  80423c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  804240:	c9                   	leave
+  804241:	c3                   	ret
+
+0000000000804242 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  804242:	55                   	push   %rbp
+  804243:	48 89 e5             	mov    %rsp,%rbp
+  804246:	48 83 ec 08          	sub    $0x8,%rsp
+  80424a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80424e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804252:	48 89 c7             	mov    %rax,%rdi
+  804255:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  80425c:	00 00 00 
+  80425f:	ff d0                	call   *%rax
+  804261:	48 05 01 68 00 00    	add    $0x6801,%rax
+  804267:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80426b:	c9                   	leave
+  80426c:	c3                   	ret
+
+000000000080426d <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	48 83 ec 18          	sub    $0x18,%rsp
+  804275:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  804279:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804280:	e9 ae 00 00 00       	jmp    804333 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  804285:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804288:	c1 e0 0c             	shl    $0xc,%eax
+  80428b:	48 98                	cltq
+  80428d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  804292:	48 01 d0             	add    %rdx,%rax
+  804295:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  804299:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80429d:	48 c1 e8 27          	shr    $0x27,%rax
+  8042a1:	48 89 c2             	mov    %rax,%rdx
+  8042a4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8042ab:	01 00 00 
+  8042ae:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042b2:	83 e0 01             	and    $0x1,%eax
+  8042b5:	48 85 c0             	test   %rax,%rax
+  8042b8:	74 63                	je     80431d <fd_alloc+0xb0>
+  8042ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042c2:	48 89 c2             	mov    %rax,%rdx
+  8042c5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8042cc:	01 00 00 
+  8042cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042d3:	83 e0 01             	and    $0x1,%eax
+  8042d6:	48 85 c0             	test   %rax,%rax
+  8042d9:	74 42                	je     80431d <fd_alloc+0xb0>
+  8042db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042df:	48 c1 e8 15          	shr    $0x15,%rax
+  8042e3:	48 89 c2             	mov    %rax,%rdx
+  8042e6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8042ed:	01 00 00 
+  8042f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042f4:	83 e0 01             	and    $0x1,%eax
+  8042f7:	48 85 c0             	test   %rax,%rax
+  8042fa:	74 21                	je     80431d <fd_alloc+0xb0>
+  8042fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804300:	48 c1 e8 0c          	shr    $0xc,%rax
+  804304:	48 89 c2             	mov    %rax,%rdx
+  804307:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80430e:	01 00 00 
+  804311:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804315:	83 e0 01             	and    $0x1,%eax
+  804318:	48 85 c0             	test   %rax,%rax
+  80431b:	75 12                	jne    80432f <fd_alloc+0xc2>
+      *fd_store = fd;
+  80431d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804321:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804325:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  804328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432d:	eb 1e                	jmp    80434d <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80432f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804333:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  804337:	0f 8e 48 ff ff ff    	jle    804285 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80433d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804341:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  804348:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80434d:	c9                   	leave
+  80434e:	c3                   	ret
+
+000000000080434f <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80434f:	55                   	push   %rbp
+  804350:	48 89 e5             	mov    %rsp,%rbp
+  804353:	48 83 ec 20          	sub    $0x20,%rsp
+  804357:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80435a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80435e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804362:	78 06                	js     80436a <fd_lookup+0x1b>
+  804364:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804368:	7e 0a                	jle    804374 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80436a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80436f:	e9 af 00 00 00       	jmp    804423 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  804374:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804377:	c1 e0 0c             	shl    $0xc,%eax
+  80437a:	48 98                	cltq
+  80437c:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  804381:	48 01 d0             	add    %rdx,%rax
+  804384:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  804388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80438c:	48 c1 e8 27          	shr    $0x27,%rax
+  804390:	48 89 c2             	mov    %rax,%rdx
+  804393:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80439a:	01 00 00 
+  80439d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043a1:	83 e0 01             	and    $0x1,%eax
+  8043a4:	48 85 c0             	test   %rax,%rax
+  8043a7:	74 63                	je     80440c <fd_lookup+0xbd>
+  8043a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ad:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8043b1:	48 89 c2             	mov    %rax,%rdx
+  8043b4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8043bb:	01 00 00 
+  8043be:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043c2:	83 e0 01             	and    $0x1,%eax
+  8043c5:	48 85 c0             	test   %rax,%rax
+  8043c8:	74 42                	je     80440c <fd_lookup+0xbd>
+  8043ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ce:	48 c1 e8 15          	shr    $0x15,%rax
+  8043d2:	48 89 c2             	mov    %rax,%rdx
+  8043d5:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8043dc:	01 00 00 
+  8043df:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043e3:	83 e0 01             	and    $0x1,%eax
+  8043e6:	48 85 c0             	test   %rax,%rax
+  8043e9:	74 21                	je     80440c <fd_lookup+0xbd>
+  8043eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ef:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043f3:	48 89 c2             	mov    %rax,%rdx
+  8043f6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8043fd:	01 00 00 
+  804400:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804404:	83 e0 01             	and    $0x1,%eax
+  804407:	48 85 c0             	test   %rax,%rax
+  80440a:	75 07                	jne    804413 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80440c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804411:	eb 10                	jmp    804423 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  804413:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804417:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80441b:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80441e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804423:	c9                   	leave
+  804424:	c3                   	ret
+
+0000000000804425 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  804425:	55                   	push   %rbp
+  804426:	48 89 e5             	mov    %rsp,%rbp
+  804429:	48 83 ec 30          	sub    $0x30,%rsp
+  80442d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804431:	89 f0                	mov    %esi,%eax
+  804433:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  804436:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80443a:	48 89 c7             	mov    %rax,%rdi
+  80443d:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  804444:	00 00 00 
+  804447:	ff d0                	call   *%rax
+  804449:	89 c2                	mov    %eax,%edx
+  80444b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80444f:	48 89 c6             	mov    %rax,%rsi
+  804452:	89 d7                	mov    %edx,%edi
+  804454:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  80445b:	00 00 00 
+  80445e:	ff d0                	call   *%rax
+  804460:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804463:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804467:	78 0a                	js     804473 <fd_close+0x4e>
+  804469:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80446d:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  804471:	74 12                	je     804485 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  804473:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  804477:	74 05                	je     80447e <fd_close+0x59>
+  804479:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80447c:	eb 70                	jmp    8044ee <fd_close+0xc9>
+  80447e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804483:	eb 69                	jmp    8044ee <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804485:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804489:	8b 00                	mov    (%rax),%eax
+  80448b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80448f:	48 89 d6             	mov    %rdx,%rsi
+  804492:	89 c7                	mov    %eax,%edi
+  804494:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  80449b:	00 00 00 
+  80449e:	ff d0                	call   *%rax
+  8044a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044a7:	78 2a                	js     8044d3 <fd_close+0xae>
+    if (dev->dev_close)
+  8044a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ad:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8044b1:	48 85 c0             	test   %rax,%rax
+  8044b4:	74 16                	je     8044cc <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8044b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044ba:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8044be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c2:	48 89 c7             	mov    %rax,%rdi
+  8044c5:	ff d2                	call   *%rdx
+  8044c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044ca:	eb 07                	jmp    8044d3 <fd_close+0xae>
+    else
+      r = 0;
+  8044cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8044d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044d7:	48 89 c6             	mov    %rax,%rsi
+  8044da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044df:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  8044e6:	00 00 00 
+  8044e9:	ff d0                	call   *%rax
+  return r;
+  8044eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8044ee:	c9                   	leave
+  8044ef:	c3                   	ret
+
+00000000008044f0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8044f0:	55                   	push   %rbp
+  8044f1:	48 89 e5             	mov    %rsp,%rbp
+  8044f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8044f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8044fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8044ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804506:	eb 3f                	jmp    804547 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  804508:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  80450f:	00 00 00 
+  804512:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804515:	48 98                	cltq
+  804517:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80451b:	8b 00                	mov    (%rax),%eax
+  80451d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804520:	75 21                	jne    804543 <dev_lookup+0x53>
+      *dev = devtab[i];
+  804522:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  804529:	00 00 00 
+  80452c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80452f:	48 98                	cltq
+  804531:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804535:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804539:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80453c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804541:	eb 7f                	jmp    8045c2 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  804543:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804547:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  80454e:	00 00 00 
+  804551:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804554:	48 98                	cltq
+  804556:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80455a:	48 85 c0             	test   %rax,%rax
+  80455d:	75 a9                	jne    804508 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80455f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804566:	00 00 00 
+  804569:	8b 40 04             	mov    0x4(%rax),%eax
+  80456c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804571:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804578:	00 00 00 
+  80457b:	48 98                	cltq
+  80457d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804584:	48 01 d0             	add    %rdx,%rax
+  804587:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80458d:	8b 00                	mov    (%rax),%eax
+  80458f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804592:	89 c6                	mov    %eax,%esi
+  804594:	48 b8 20 8b 80 00 00 	movabs $0x808b20,%rax
+  80459b:	00 00 00 
+  80459e:	48 89 c7             	mov    %rax,%rdi
+  8045a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a6:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  8045ad:	00 00 00 
+  8045b0:	ff d1                	call   *%rcx
+  *dev = 0;
+  8045b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045b6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8045bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8045c2:	c9                   	leave
+  8045c3:	c3                   	ret
+
+00000000008045c4 <close>:
+
+int
+close(int fdnum) {
+  8045c4:	55                   	push   %rbp
+  8045c5:	48 89 e5             	mov    %rsp,%rbp
+  8045c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8045cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8045cf:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8045d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045d6:	48 89 d6             	mov    %rdx,%rsi
+  8045d9:	89 c7                	mov    %eax,%edi
+  8045db:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  8045e2:	00 00 00 
+  8045e5:	ff d0                	call   *%rax
+  8045e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045ee:	79 05                	jns    8045f5 <close+0x31>
+    return r;
+  8045f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8045f3:	eb 18                	jmp    80460d <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8045f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8045fe:	48 89 c7             	mov    %rax,%rdi
+  804601:	48 b8 25 44 80 00 00 	movabs $0x804425,%rax
+  804608:	00 00 00 
+  80460b:	ff d0                	call   *%rax
+}
+  80460d:	c9                   	leave
+  80460e:	c3                   	ret
+
+000000000080460f <close_all>:
+
+void
+close_all(void) {
+  80460f:	55                   	push   %rbp
+  804610:	48 89 e5             	mov    %rsp,%rbp
+  804613:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  804617:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80461e:	eb 15                	jmp    804635 <close_all+0x26>
+    close(i);
+  804620:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804623:	89 c7                	mov    %eax,%edi
+  804625:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  80462c:	00 00 00 
+  80462f:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  804631:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804635:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  804639:	7e e5                	jle    804620 <close_all+0x11>
+}
+  80463b:	90                   	nop
+  80463c:	90                   	nop
+  80463d:	c9                   	leave
+  80463e:	c3                   	ret
+
+000000000080463f <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	48 83 ec 40          	sub    $0x40,%rsp
+  804647:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80464a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80464d:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  804651:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804654:	48 89 d6             	mov    %rdx,%rsi
+  804657:	89 c7                	mov    %eax,%edi
+  804659:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804660:	00 00 00 
+  804663:	ff d0                	call   *%rax
+  804665:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804668:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80466c:	79 08                	jns    804676 <dup+0x37>
+    return r;
+  80466e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804671:	e9 33 02 00 00       	jmp    8048a9 <dup+0x26a>
+  close(newfdnum);
+  804676:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804679:	89 c7                	mov    %eax,%edi
+  80467b:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  804687:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80468a:	c1 e0 0c             	shl    $0xc,%eax
+  80468d:	48 98                	cltq
+  80468f:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  804694:	48 01 d0             	add    %rdx,%rax
+  804697:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80469b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80469f:	48 89 c7             	mov    %rax,%rdi
+  8046a2:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  8046a9:	00 00 00 
+  8046ac:	ff d0                	call   *%rax
+  8046ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8046b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b6:	48 89 c7             	mov    %rax,%rdi
+  8046b9:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  8046c0:	00 00 00 
+  8046c3:	ff d0                	call   *%rax
+  8046c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8046c9:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8046d0:	00 
+  8046d1:	e9 19 01 00 00       	jmp    8047ef <dup+0x1b0>
+    off -= PGSIZE;
+  8046d6:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8046dd:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8046de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e6:	48 01 d0             	add    %rdx,%rax
+  8046e9:	48 c1 e8 27          	shr    $0x27,%rax
+  8046ed:	48 89 c2             	mov    %rax,%rdx
+  8046f0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8046f7:	01 00 00 
+  8046fa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8046fe:	83 e0 01             	and    $0x1,%eax
+  804701:	48 85 c0             	test   %rax,%rax
+  804704:	0f 84 e5 00 00 00    	je     8047ef <dup+0x1b0>
+  80470a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80470e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804712:	48 01 d0             	add    %rdx,%rax
+  804715:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804719:	48 89 c2             	mov    %rax,%rdx
+  80471c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804723:	01 00 00 
+  804726:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80472a:	83 e0 01             	and    $0x1,%eax
+  80472d:	48 85 c0             	test   %rax,%rax
+  804730:	0f 84 b9 00 00 00    	je     8047ef <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  804736:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80473a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80473e:	48 01 d0             	add    %rdx,%rax
+  804741:	48 c1 e8 15          	shr    $0x15,%rax
+  804745:	48 89 c2             	mov    %rax,%rdx
+  804748:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80474f:	01 00 00 
+  804752:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804756:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  804759:	48 85 c0             	test   %rax,%rax
+  80475c:	0f 84 8d 00 00 00    	je     8047ef <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  804762:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80476a:	48 01 d0             	add    %rdx,%rax
+  80476d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804771:	48 89 c2             	mov    %rax,%rdx
+  804774:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80477b:	01 00 00 
+  80477e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804782:	83 e0 01             	and    $0x1,%eax
+  804785:	48 85 c0             	test   %rax,%rax
+  804788:	74 65                	je     8047ef <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80478a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80478e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804792:	48 01 d0             	add    %rdx,%rax
+  804795:	48 c1 e8 0c          	shr    $0xc,%rax
+  804799:	48 89 c2             	mov    %rax,%rdx
+  80479c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8047a3:	01 00 00 
+  8047a6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8047aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8047af:	89 c6                	mov    %eax,%esi
+  8047b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8047b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b9:	48 01 c2             	add    %rax,%rdx
+  8047bc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8047c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047c4:	48 01 c8             	add    %rcx,%rax
+  8047c7:	41 89 f0             	mov    %esi,%r8d
+  8047ca:	48 89 d1             	mov    %rdx,%rcx
+  8047cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047d2:	48 89 c6             	mov    %rax,%rsi
+  8047d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047da:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  8047e1:	00 00 00 
+  8047e4:	ff d0                	call   *%rax
+  8047e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047ed:	78 60                	js     80484f <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8047ef:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8047f4:	0f 85 dc fe ff ff    	jne    8046d6 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8047fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  804802:	48 89 c2             	mov    %rax,%rdx
+  804805:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80480c:	01 00 00 
+  80480f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804813:	25 07 0e 00 00       	and    $0xe07,%eax
+  804818:	89 c1                	mov    %eax,%ecx
+  80481a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80481e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804822:	41 89 c8             	mov    %ecx,%r8d
+  804825:	48 89 d1             	mov    %rdx,%rcx
+  804828:	ba 00 00 00 00       	mov    $0x0,%edx
+  80482d:	48 89 c6             	mov    %rax,%rsi
+  804830:	bf 00 00 00 00       	mov    $0x0,%edi
+  804835:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  80483c:	00 00 00 
+  80483f:	ff d0                	call   *%rax
+  804841:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804844:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804848:	78 08                	js     804852 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80484a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80484d:	eb 5a                	jmp    8048a9 <dup+0x26a>
+        goto err;
+  80484f:	90                   	nop
+  804850:	eb 01                	jmp    804853 <dup+0x214>
+    goto err;
+  804852:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  804853:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804857:	48 89 c6             	mov    %rax,%rsi
+  80485a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80485f:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  804866:	00 00 00 
+  804869:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80486b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804872:	00 
+  804873:	eb 27                	jmp    80489c <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  804875:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80487d:	48 01 d0             	add    %rdx,%rax
+  804880:	48 89 c6             	mov    %rax,%rsi
+  804883:	bf 00 00 00 00       	mov    $0x0,%edi
+  804888:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80488f:	00 00 00 
+  804892:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  804894:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80489b:	00 
+  80489c:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8048a3:	00 
+  8048a4:	76 cf                	jbe    804875 <dup+0x236>
+  return r;
+  8048a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8048a9:	c9                   	leave
+  8048aa:	c3                   	ret
+
+00000000008048ab <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8048ab:	55                   	push   %rbp
+  8048ac:	48 89 e5             	mov    %rsp,%rbp
+  8048af:	48 83 ec 40          	sub    $0x40,%rsp
+  8048b3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8048b6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8048be:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8048c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048c5:	48 89 d6             	mov    %rdx,%rsi
+  8048c8:	89 c7                	mov    %eax,%edi
+  8048ca:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  8048d1:	00 00 00 
+  8048d4:	ff d0                	call   *%rax
+  8048d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048dd:	78 24                	js     804903 <read+0x58>
+  8048df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e3:	8b 00                	mov    (%rax),%eax
+  8048e5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8048e9:	48 89 d6             	mov    %rdx,%rsi
+  8048ec:	89 c7                	mov    %eax,%edi
+  8048ee:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  8048f5:	00 00 00 
+  8048f8:	ff d0                	call   *%rax
+  8048fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804901:	79 0a                	jns    80490d <read+0x62>
+    return r;
+  804903:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804906:	48 98                	cltq
+  804908:	e9 9e 00 00 00       	jmp    8049ab <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80490d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804911:	8b 40 08             	mov    0x8(%rax),%eax
+  804914:	83 e0 03             	and    $0x3,%eax
+  804917:	83 f8 01             	cmp    $0x1,%eax
+  80491a:	75 5c                	jne    804978 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80491c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804923:	00 00 00 
+  804926:	8b 40 04             	mov    0x4(%rax),%eax
+  804929:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80492e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804935:	00 00 00 
+  804938:	48 98                	cltq
+  80493a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804941:	48 01 d0             	add    %rdx,%rax
+  804944:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80494a:	8b 00                	mov    (%rax),%eax
+  80494c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80494f:	89 c6                	mov    %eax,%esi
+  804951:	48 b8 3f 8b 80 00 00 	movabs $0x808b3f,%rax
+  804958:	00 00 00 
+  80495b:	48 89 c7             	mov    %rax,%rdi
+  80495e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804963:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  80496a:	00 00 00 
+  80496d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80496f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804976:	eb 33                	jmp    8049ab <read+0x100>
+  }
+  if (!dev->dev_read)
+  804978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80497c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804980:	48 85 c0             	test   %rax,%rax
+  804983:	75 09                	jne    80498e <read+0xe3>
+    return -E_NOT_SUPP;
+  804985:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80498c:	eb 1d                	jmp    8049ab <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80498e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804992:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80499a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80499e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8049a2:	48 89 ce             	mov    %rcx,%rsi
+  8049a5:	48 89 c7             	mov    %rax,%rdi
+  8049a8:	41 ff d0             	call   *%r8
+}
+  8049ab:	c9                   	leave
+  8049ac:	c3                   	ret
+
+00000000008049ad <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8049ad:	55                   	push   %rbp
+  8049ae:	48 89 e5             	mov    %rsp,%rbp
+  8049b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8049b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8049bc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8049c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049c7:	eb 49                	jmp    804a12 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8049c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049cc:	48 98                	cltq
+  8049ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8049d2:	48 29 c2             	sub    %rax,%rdx
+  8049d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049d8:	48 63 c8             	movslq %eax,%rcx
+  8049db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049df:	48 01 c1             	add    %rax,%rcx
+  8049e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049e5:	48 89 ce             	mov    %rcx,%rsi
+  8049e8:	89 c7                	mov    %eax,%edi
+  8049ea:	48 b8 ab 48 80 00 00 	movabs $0x8048ab,%rax
+  8049f1:	00 00 00 
+  8049f4:	ff d0                	call   *%rax
+  8049f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8049f9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8049fd:	79 07                	jns    804a06 <readn+0x59>
+      return m;
+  8049ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a02:	48 98                	cltq
+  804a04:	eb 1f                	jmp    804a25 <readn+0x78>
+    if (m == 0)
+  804a06:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804a0a:	74 13                	je     804a1f <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  804a0c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a0f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a15:	48 98                	cltq
+  804a17:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804a1b:	72 ac                	jb     8049c9 <readn+0x1c>
+  804a1d:	eb 01                	jmp    804a20 <readn+0x73>
+      break;
+  804a1f:	90                   	nop
+  }
+  return tot;
+  804a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a23:	48 98                	cltq
+}
+  804a25:	c9                   	leave
+  804a26:	c3                   	ret
+
+0000000000804a27 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  804a27:	55                   	push   %rbp
+  804a28:	48 89 e5             	mov    %rsp,%rbp
+  804a2b:	48 83 ec 40          	sub    $0x40,%rsp
+  804a2f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a32:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a36:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804a3a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804a3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a41:	48 89 d6             	mov    %rdx,%rsi
+  804a44:	89 c7                	mov    %eax,%edi
+  804a46:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804a4d:	00 00 00 
+  804a50:	ff d0                	call   *%rax
+  804a52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a59:	78 24                	js     804a7f <write+0x58>
+  804a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a5f:	8b 00                	mov    (%rax),%eax
+  804a61:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804a65:	48 89 d6             	mov    %rdx,%rsi
+  804a68:	89 c7                	mov    %eax,%edi
+  804a6a:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  804a71:	00 00 00 
+  804a74:	ff d0                	call   *%rax
+  804a76:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a7d:	79 0a                	jns    804a89 <write+0x62>
+    return r;
+  804a7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a82:	48 98                	cltq
+  804a84:	e9 9d 00 00 00       	jmp    804b26 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804a89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a8d:	8b 40 08             	mov    0x8(%rax),%eax
+  804a90:	83 e0 03             	and    $0x3,%eax
+  804a93:	85 c0                	test   %eax,%eax
+  804a95:	75 5c                	jne    804af3 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804a97:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a9e:	00 00 00 
+  804aa1:	8b 40 04             	mov    0x4(%rax),%eax
+  804aa4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804aa9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ab0:	00 00 00 
+  804ab3:	48 98                	cltq
+  804ab5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804abc:	48 01 d0             	add    %rdx,%rax
+  804abf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ac5:	8b 00                	mov    (%rax),%eax
+  804ac7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804aca:	89 c6                	mov    %eax,%esi
+  804acc:	48 b8 5b 8b 80 00 00 	movabs $0x808b5b,%rax
+  804ad3:	00 00 00 
+  804ad6:	48 89 c7             	mov    %rax,%rdi
+  804ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ade:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  804ae5:	00 00 00 
+  804ae8:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804aea:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804af1:	eb 33                	jmp    804b26 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  804af3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804af7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804afb:	48 85 c0             	test   %rax,%rax
+  804afe:	75 09                	jne    804b09 <write+0xe2>
+    return -E_NOT_SUPP;
+  804b00:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  804b07:	eb 1d                	jmp    804b26 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  804b09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b0d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804b11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b15:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b19:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804b1d:	48 89 ce             	mov    %rcx,%rsi
+  804b20:	48 89 c7             	mov    %rax,%rdi
+  804b23:	41 ff d0             	call   *%r8
+}
+  804b26:	c9                   	leave
+  804b27:	c3                   	ret
+
+0000000000804b28 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  804b28:	55                   	push   %rbp
+  804b29:	48 89 e5             	mov    %rsp,%rbp
+  804b2c:	48 83 ec 18          	sub    $0x18,%rsp
+  804b30:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b33:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b36:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804b3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b3d:	48 89 d6             	mov    %rdx,%rsi
+  804b40:	89 c7                	mov    %eax,%edi
+  804b42:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804b49:	00 00 00 
+  804b4c:	ff d0                	call   *%rax
+  804b4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b55:	79 05                	jns    804b5c <seek+0x34>
+    return r;
+  804b57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b5a:	eb 0f                	jmp    804b6b <seek+0x43>
+  fd->fd_offset = offset;
+  804b5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b60:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b63:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  804b66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b6b:	c9                   	leave
+  804b6c:	c3                   	ret
+
+0000000000804b6d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804b6d:	55                   	push   %rbp
+  804b6e:	48 89 e5             	mov    %rsp,%rbp
+  804b71:	48 83 ec 30          	sub    $0x30,%rsp
+  804b75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b78:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804b7b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804b7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b82:	48 89 d6             	mov    %rdx,%rsi
+  804b85:	89 c7                	mov    %eax,%edi
+  804b87:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804b8e:	00 00 00 
+  804b91:	ff d0                	call   *%rax
+  804b93:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b96:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b9a:	78 24                	js     804bc0 <ftruncate+0x53>
+  804b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba0:	8b 00                	mov    (%rax),%eax
+  804ba2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804ba6:	48 89 d6             	mov    %rdx,%rsi
+  804ba9:	89 c7                	mov    %eax,%edi
+  804bab:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  804bb2:	00 00 00 
+  804bb5:	ff d0                	call   *%rax
+  804bb7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bbe:	79 08                	jns    804bc8 <ftruncate+0x5b>
+    return r;
+  804bc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bc3:	e9 92 00 00 00       	jmp    804c5a <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804bc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bcc:	8b 40 08             	mov    0x8(%rax),%eax
+  804bcf:	83 e0 03             	and    $0x3,%eax
+  804bd2:	85 c0                	test   %eax,%eax
+  804bd4:	75 5a                	jne    804c30 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  804bd6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804bdd:	00 00 00 
+  804be0:	8b 40 04             	mov    0x4(%rax),%eax
+  804be3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804be8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bef:	00 00 00 
+  804bf2:	48 98                	cltq
+  804bf4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bfb:	48 01 d0             	add    %rdx,%rax
+  804bfe:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804c04:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804c06:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804c09:	89 c6                	mov    %eax,%esi
+  804c0b:	48 b8 78 8b 80 00 00 	movabs $0x808b78,%rax
+  804c12:	00 00 00 
+  804c15:	48 89 c7             	mov    %rax,%rdi
+  804c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c1d:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  804c24:	00 00 00 
+  804c27:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804c29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804c2e:	eb 2a                	jmp    804c5a <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  804c30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c34:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804c38:	48 85 c0             	test   %rax,%rax
+  804c3b:	75 07                	jne    804c44 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  804c3d:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  804c42:	eb 16                	jmp    804c5a <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  804c44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c48:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804c4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c50:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c53:	89 d6                	mov    %edx,%esi
+  804c55:	48 89 c7             	mov    %rax,%rdi
+  804c58:	ff d1                	call   *%rcx
+}
+  804c5a:	c9                   	leave
+  804c5b:	c3                   	ret
+
+0000000000804c5c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804c5c:	55                   	push   %rbp
+  804c5d:	48 89 e5             	mov    %rsp,%rbp
+  804c60:	48 83 ec 30          	sub    $0x30,%rsp
+  804c64:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c67:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804c6b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804c6f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c72:	48 89 d6             	mov    %rdx,%rsi
+  804c75:	89 c7                	mov    %eax,%edi
+  804c77:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804c7e:	00 00 00 
+  804c81:	ff d0                	call   *%rax
+  804c83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c86:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c8a:	78 24                	js     804cb0 <fstat+0x54>
+  804c8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c90:	8b 00                	mov    (%rax),%eax
+  804c92:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804c96:	48 89 d6             	mov    %rdx,%rsi
+  804c99:	89 c7                	mov    %eax,%edi
+  804c9b:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  804ca2:	00 00 00 
+  804ca5:	ff d0                	call   *%rax
+  804ca7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804caa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cae:	79 05                	jns    804cb5 <fstat+0x59>
+    return r;
+  804cb0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cb3:	eb 5e                	jmp    804d13 <fstat+0xb7>
+  if (!dev->dev_stat)
+  804cb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cb9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804cbd:	48 85 c0             	test   %rax,%rax
+  804cc0:	75 07                	jne    804cc9 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  804cc2:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  804cc7:	eb 4a                	jmp    804d13 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  804cc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ccd:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  804cd0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cd4:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804cdb:	00 00 00 
+  stat->st_isdir   = 0;
+  804cde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ce2:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804ce9:	00 00 00 
+  stat->st_dev     = dev;
+  804cec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804cf0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cf4:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  804cfb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cff:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804d03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804d0b:	48 89 d6             	mov    %rdx,%rsi
+  804d0e:	48 89 c7             	mov    %rax,%rdi
+  804d11:	ff d1                	call   *%rcx
+}
+  804d13:	c9                   	leave
+  804d14:	c3                   	ret
+
+0000000000804d15 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  804d15:	55                   	push   %rbp
+  804d16:	48 89 e5             	mov    %rsp,%rbp
+  804d19:	48 83 ec 10          	sub    $0x10,%rsp
+  804d1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  804d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d29:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804d2f:	83 f8 20             	cmp    $0x20,%eax
+  804d32:	75 07                	jne    804d3b <pollwait_key+0x26>
+    return -E_INVAL;
+  804d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d39:	eb 5f                	jmp    804d9a <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  804d3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d3f:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  804d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d49:	48 63 d2             	movslq %edx,%rdx
+  804d4c:	48 c1 e2 04          	shl    $0x4,%rdx
+  804d50:	48 01 c2             	add    %rax,%rdx
+  804d53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d57:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804d5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d5e:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  804d64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d68:	8b 00                	mov    (%rax),%eax
+  804d6a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d6e:	48 63 c9             	movslq %ecx,%rcx
+  804d71:	48 c1 e1 04          	shl    $0x4,%rcx
+  804d75:	48 01 ca             	add    %rcx,%rdx
+  804d78:	48 83 c2 08          	add    $0x8,%rdx
+  804d7c:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  804d7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d82:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804d88:	8d 50 01             	lea    0x1(%rax),%edx
+  804d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d8f:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  804d95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d9a:	c9                   	leave
+  804d9b:	c3                   	ret
+
+0000000000804d9c <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  804d9c:	55                   	push   %rbp
+  804d9d:	48 89 e5             	mov    %rsp,%rbp
+  804da0:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  804da7:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  804dae:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  804db4:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  804dbb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804dc2:	00 
+  int i, r, ready, ipc = 0;
+  804dc3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  804dca:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  804dd1:	00 
+  804dd2:	74 45                	je     804e19 <poll+0x7d>
+  804dd4:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  804ddb:	ff 
+  804ddc:	74 3b                	je     804e19 <poll+0x7d>
+    now      = vsys_clock_ns();
+  804dde:	48 b8 0c 78 80 00 00 	movabs $0x80780c,%rax
+  804de5:	00 00 00 
+  804de8:	ff d0                	call   *%rax
+  804dea:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  804dee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804df2:	48 f7 d0             	not    %rax
+  804df5:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  804dfc:	73 10                	jae    804e0e <poll+0x72>
+  804dfe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e02:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  804e09:	48 01 d0             	add    %rdx,%rax
+  804e0c:	eb 07                	jmp    804e15 <poll+0x79>
+  804e0e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e15:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  804e19:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804e20:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  804e27:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804e2e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  804e35:	e9 46 02 00 00       	jmp    805080 <poll+0x2e4>
+      fds[i].revents = 0;
+  804e3a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e3d:	48 63 d0             	movslq %eax,%rdx
+  804e40:	48 89 d0             	mov    %rdx,%rax
+  804e43:	48 01 c0             	add    %rax,%rax
+  804e46:	48 01 d0             	add    %rdx,%rax
+  804e49:	48 c1 e0 02          	shl    $0x2,%rax
+  804e4d:	48 89 c2             	mov    %rax,%rdx
+  804e50:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804e57:	48 01 d0             	add    %rdx,%rax
+  804e5a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804e61:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e64:	48 63 d0             	movslq %eax,%rdx
+  804e67:	48 89 d0             	mov    %rdx,%rax
+  804e6a:	48 01 c0             	add    %rax,%rax
+  804e6d:	48 01 d0             	add    %rdx,%rax
+  804e70:	48 c1 e0 02          	shl    $0x2,%rax
+  804e74:	48 89 c2             	mov    %rax,%rdx
+  804e77:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804e7e:	48 01 d0             	add    %rdx,%rax
+  804e81:	8b 00                	mov    (%rax),%eax
+  804e83:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  804e86:	75 62                	jne    804eea <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  804e88:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e8b:	48 63 d0             	movslq %eax,%rdx
+  804e8e:	48 89 d0             	mov    %rdx,%rax
+  804e91:	48 01 c0             	add    %rax,%rax
+  804e94:	48 01 d0             	add    %rdx,%rax
+  804e97:	48 c1 e0 02          	shl    $0x2,%rax
+  804e9b:	48 89 c2             	mov    %rax,%rdx
+  804e9e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804ea5:	48 01 d0             	add    %rdx,%rax
+  804ea8:	8b 40 04             	mov    0x4(%rax),%eax
+  804eab:	83 e0 01             	and    $0x1,%eax
+  804eae:	85 c0                	test   %eax,%eax
+  804eb0:	0f 84 9b 01 00 00    	je     805051 <poll+0x2b5>
+          fds[i].revents = ipc;
+  804eb6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804eb9:	48 63 d0             	movslq %eax,%rdx
+  804ebc:	48 89 d0             	mov    %rdx,%rax
+  804ebf:	48 01 c0             	add    %rax,%rax
+  804ec2:	48 01 d0             	add    %rdx,%rax
+  804ec5:	48 c1 e0 02          	shl    $0x2,%rax
+  804ec9:	48 89 c2             	mov    %rax,%rdx
+  804ecc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804ed3:	48 01 c2             	add    %rax,%rdx
+  804ed6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ed9:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  804edc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804edf:	83 c8 04             	or     $0x4,%eax
+  804ee2:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  804ee5:	e9 67 01 00 00       	jmp    805051 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804eea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804eed:	48 63 d0             	movslq %eax,%rdx
+  804ef0:	48 89 d0             	mov    %rdx,%rax
+  804ef3:	48 01 c0             	add    %rax,%rax
+  804ef6:	48 01 d0             	add    %rdx,%rax
+  804ef9:	48 c1 e0 02          	shl    $0x2,%rax
+  804efd:	48 89 c2             	mov    %rax,%rdx
+  804f00:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804f07:	48 01 d0             	add    %rdx,%rax
+  804f0a:	8b 00                	mov    (%rax),%eax
+  804f0c:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804f13:	48 89 d6             	mov    %rdx,%rsi
+  804f16:	89 c7                	mov    %eax,%edi
+  804f18:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  804f1f:	00 00 00 
+  804f22:	ff d0                	call   *%rax
+  804f24:	85 c0                	test   %eax,%eax
+  804f26:	78 25                	js     804f4d <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  804f28:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804f2f:	8b 00                	mov    (%rax),%eax
+  804f31:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804f38:	48 89 d6             	mov    %rdx,%rsi
+  804f3b:	89 c7                	mov    %eax,%edi
+  804f3d:	48 b8 f0 44 80 00 00 	movabs $0x8044f0,%rax
+  804f44:	00 00 00 
+  804f47:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804f49:	85 c0                	test   %eax,%eax
+  804f4b:	79 2c                	jns    804f79 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  804f4d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f50:	48 63 d0             	movslq %eax,%rdx
+  804f53:	48 89 d0             	mov    %rdx,%rax
+  804f56:	48 01 c0             	add    %rax,%rax
+  804f59:	48 01 d0             	add    %rdx,%rax
+  804f5c:	48 c1 e0 02          	shl    $0x2,%rax
+  804f60:	48 89 c2             	mov    %rax,%rdx
+  804f63:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804f6a:	48 01 d0             	add    %rdx,%rax
+  804f6d:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804f74:	e9 d8 00 00 00       	jmp    805051 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804f79:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804f80:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804f84:	48 85 c0             	test   %rax,%rax
+  804f87:	74 7d                	je     805006 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  804f89:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804f90:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  804f94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f97:	48 63 d0             	movslq %eax,%rdx
+  804f9a:	48 89 d0             	mov    %rdx,%rax
+  804f9d:	48 01 c0             	add    %rax,%rax
+  804fa0:	48 01 d0             	add    %rdx,%rax
+  804fa3:	48 c1 e0 02          	shl    $0x2,%rax
+  804fa7:	48 89 c2             	mov    %rax,%rdx
+  804faa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804fb1:	48 01 d0             	add    %rdx,%rax
+  804fb4:	8b 48 04             	mov    0x4(%rax),%ecx
+  804fb7:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804fbe:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  804fc5:	89 ce                	mov    %ecx,%esi
+  804fc7:	48 89 c7             	mov    %rax,%rdi
+  804fca:	41 ff d0             	call   *%r8
+  804fcd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804fd0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804fd4:	79 08                	jns    804fde <poll+0x242>
+          return r;
+  804fd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fd9:	e9 45 01 00 00       	jmp    805123 <poll+0x387>
+        fds[i].revents = r;
+  804fde:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804fe1:	48 63 d0             	movslq %eax,%rdx
+  804fe4:	48 89 d0             	mov    %rdx,%rax
+  804fe7:	48 01 c0             	add    %rax,%rax
+  804fea:	48 01 d0             	add    %rdx,%rax
+  804fed:	48 c1 e0 02          	shl    $0x2,%rax
+  804ff1:	48 89 c2             	mov    %rax,%rdx
+  804ff4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804ffb:	48 01 c2             	add    %rax,%rdx
+  804ffe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805001:	89 42 08             	mov    %eax,0x8(%rdx)
+  805004:	eb 4b                	jmp    805051 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  805006:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805009:	48 63 d0             	movslq %eax,%rdx
+  80500c:	48 89 d0             	mov    %rdx,%rax
+  80500f:	48 01 c0             	add    %rax,%rax
+  805012:	48 01 d0             	add    %rdx,%rax
+  805015:	48 c1 e0 02          	shl    $0x2,%rax
+  805019:	48 89 c2             	mov    %rax,%rdx
+  80501c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  805023:	48 01 d0             	add    %rdx,%rax
+  805026:	8b 48 04             	mov    0x4(%rax),%ecx
+  805029:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80502c:	48 63 d0             	movslq %eax,%rdx
+  80502f:	48 89 d0             	mov    %rdx,%rax
+  805032:	48 01 c0             	add    %rax,%rax
+  805035:	48 01 d0             	add    %rdx,%rax
+  805038:	48 c1 e0 02          	shl    $0x2,%rax
+  80503c:	48 89 c2             	mov    %rax,%rdx
+  80503f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  805046:	48 01 d0             	add    %rdx,%rax
+  805049:	83 e1 03             	and    $0x3,%ecx
+  80504c:	89 ca                	mov    %ecx,%edx
+  80504e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  805051:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805054:	48 63 d0             	movslq %eax,%rdx
+  805057:	48 89 d0             	mov    %rdx,%rax
+  80505a:	48 01 c0             	add    %rax,%rax
+  80505d:	48 01 d0             	add    %rdx,%rax
+  805060:	48 c1 e0 02          	shl    $0x2,%rax
+  805064:	48 89 c2             	mov    %rax,%rdx
+  805067:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80506e:	48 01 d0             	add    %rdx,%rax
+  805071:	8b 40 08             	mov    0x8(%rax),%eax
+  805074:	85 c0                	test   %eax,%eax
+  805076:	74 04                	je     80507c <poll+0x2e0>
+        ready++;
+  805078:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80507c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805080:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805083:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  805089:	0f 8c ab fd ff ff    	jl     804e3a <poll+0x9e>
+    }
+    if (ready)
+  80508f:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805093:	74 08                	je     80509d <poll+0x301>
+      return ready;
+  805095:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805098:	e9 86 00 00 00       	jmp    805123 <poll+0x387>
+
+    if (deadline) {
+  80509d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8050a2:	74 30                	je     8050d4 <poll+0x338>
+      now     = vsys_clock_ns();
+  8050a4:	48 b8 0c 78 80 00 00 	movabs $0x80780c,%rax
+  8050ab:	00 00 00 
+  8050ae:	ff d0                	call   *%rax
+  8050b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8050b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050b8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8050bc:	73 0a                	jae    8050c8 <poll+0x32c>
+  8050be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050c2:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8050c6:	eb 05                	jmp    8050cd <poll+0x331>
+  8050c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050cd:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8050d4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8050d7:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8050da:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8050e1:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8050e8:	48 89 c7             	mov    %rax,%rdi
+  8050eb:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  8050f2:	00 00 00 
+  8050f5:	ff d0                	call   *%rax
+  8050f7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8050fa:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8050fe:	75 07                	jne    805107 <poll+0x36b>
+      return 0;
+  805100:	b8 00 00 00 00       	mov    $0x0,%eax
+  805105:	eb 1c                	jmp    805123 <poll+0x387>
+    if (r < 0)
+  805107:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80510b:	79 05                	jns    805112 <poll+0x376>
+      return r;
+  80510d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805110:	eb 11                	jmp    805123 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  805112:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805115:	c1 f8 02             	sar    $0x2,%eax
+  805118:	83 e0 01             	and    $0x1,%eax
+  80511b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80511e:	e9 f6 fc ff ff       	jmp    804e19 <poll+0x7d>
+  }
+}
+  805123:	c9                   	leave
+  805124:	c3                   	ret
+
+0000000000805125 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  805125:	55                   	push   %rbp
+  805126:	48 89 e5             	mov    %rsp,%rbp
+  805129:	48 83 ec 20          	sub    $0x20,%rsp
+  80512d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805131:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  805135:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805139:	be 00 00 00 00       	mov    $0x0,%esi
+  80513e:	48 89 c7             	mov    %rax,%rdi
+  805141:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  805148:	00 00 00 
+  80514b:	ff d0                	call   *%rax
+  80514d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805150:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805154:	79 05                	jns    80515b <stat+0x36>
+    return fd;
+  805156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805159:	eb 2f                	jmp    80518a <stat+0x65>
+  r = fstat(fd, stat);
+  80515b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80515f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805162:	48 89 d6             	mov    %rdx,%rsi
+  805165:	89 c7                	mov    %eax,%edi
+  805167:	48 b8 5c 4c 80 00 00 	movabs $0x804c5c,%rax
+  80516e:	00 00 00 
+  805171:	ff d0                	call   *%rax
+  805173:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  805176:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805179:	89 c7                	mov    %eax,%edi
+  80517b:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  805182:	00 00 00 
+  805185:	ff d0                	call   *%rax
+  return r;
+  805187:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80518a:	c9                   	leave
+  80518b:	c3                   	ret
+
+000000000080518c <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80518c:	55                   	push   %rbp
+  80518d:	48 89 e5             	mov    %rsp,%rbp
+  805190:	48 83 ec 10          	sub    $0x10,%rsp
+  805194:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805197:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80519b:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  8051a2:	00 00 00 
+  8051a5:	8b 00                	mov    (%rax),%eax
+  8051a7:	85 c0                	test   %eax,%eax
+  8051a9:	75 1d                	jne    8051c8 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8051ab:	bf 03 00 00 00       	mov    $0x3,%edi
+  8051b0:	48 b8 11 7c 80 00 00 	movabs $0x807c11,%rax
+  8051b7:	00 00 00 
+  8051ba:	ff d0                	call   *%rax
+  8051bc:	48 ba 00 c0 80 00 00 	movabs $0x80c000,%rdx
+  8051c3:	00 00 00 
+  8051c6:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8051c8:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  8051cf:	00 00 00 
+  8051d2:	8b 00                	mov    (%rax),%eax
+  8051d4:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8051d7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8051dc:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8051e3:	00 00 00 
+  8051e6:	89 c7                	mov    %eax,%edi
+  8051e8:	48 b8 64 7b 80 00 00 	movabs $0x807b64,%rax
+  8051ef:	00 00 00 
+  8051f2:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8051f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051fd:	48 89 c6             	mov    %rax,%rsi
+  805200:	bf 00 00 00 00       	mov    $0x0,%edi
+  805205:	48 b8 e7 79 80 00 00 	movabs $0x8079e7,%rax
+  80520c:	00 00 00 
+  80520f:	ff d0                	call   *%rax
+}
+  805211:	c9                   	leave
+  805212:	c3                   	ret
+
+0000000000805213 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  805213:	55                   	push   %rbp
+  805214:	48 89 e5             	mov    %rsp,%rbp
+  805217:	48 83 ec 20          	sub    $0x20,%rsp
+  80521b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80521f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  805222:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805226:	48 89 c7             	mov    %rax,%rdi
+  805229:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  805230:	00 00 00 
+  805233:	ff d0                	call   *%rax
+  805235:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80523a:	7e 0a                	jle    805246 <open+0x33>
+    return -E_BAD_PATH;
+  80523c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  805241:	e9 a8 00 00 00       	jmp    8052ee <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805246:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80524a:	48 89 c7             	mov    %rax,%rdi
+  80524d:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  805254:	00 00 00 
+  805257:	ff d0                	call   *%rax
+  805259:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80525c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805260:	79 08                	jns    80526a <open+0x57>
+    return r;
+  805262:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805265:	e9 84 00 00 00       	jmp    8052ee <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80526a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80526e:	48 89 c6             	mov    %rax,%rsi
+  805271:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  805278:	00 00 00 
+  80527b:	48 89 c7             	mov    %rax,%rdi
+  80527e:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  805285:	00 00 00 
+  805288:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80528a:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  805291:	00 00 00 
+  805294:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805297:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80529d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052a1:	48 89 c6             	mov    %rax,%rsi
+  8052a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8052a9:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  8052b0:	00 00 00 
+  8052b3:	ff d0                	call   *%rax
+  8052b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8052b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8052bc:	79 1d                	jns    8052db <open+0xc8>
+    fd_close(fd, 0);
+  8052be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8052c7:	48 89 c7             	mov    %rax,%rdi
+  8052ca:	48 b8 25 44 80 00 00 	movabs $0x804425,%rax
+  8052d1:	00 00 00 
+  8052d4:	ff d0                	call   *%rax
+    return r;
+  8052d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052d9:	eb 13                	jmp    8052ee <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8052db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052df:	48 89 c7             	mov    %rax,%rdi
+  8052e2:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  8052e9:	00 00 00 
+  8052ec:	ff d0                	call   *%rax
+}
+  8052ee:	c9                   	leave
+  8052ef:	c3                   	ret
+
+00000000008052f0 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8052f0:	55                   	push   %rbp
+  8052f1:	48 89 e5             	mov    %rsp,%rbp
+  8052f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8052f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8052fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805300:	8b 40 0c             	mov    0xc(%rax),%eax
+  805303:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80530a:	00 00 00 
+  80530d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80530f:	be 00 00 00 00       	mov    $0x0,%esi
+  805314:	bf 06 00 00 00       	mov    $0x6,%edi
+  805319:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805320:	00 00 00 
+  805323:	ff d0                	call   *%rax
+}
+  805325:	c9                   	leave
+  805326:	c3                   	ret
+
+0000000000805327 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  805327:	55                   	push   %rbp
+  805328:	48 89 e5             	mov    %rsp,%rbp
+  80532b:	48 83 ec 30          	sub    $0x30,%rsp
+  80532f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805333:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805337:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80533b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805340:	74 07                	je     805349 <devfile_read+0x22>
+  805342:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805347:	75 0a                	jne    805353 <devfile_read+0x2c>
+  return E_INVAL;
+  805349:	b8 03 00 00 00       	mov    $0x3,%eax
+  80534e:	e9 b4 00 00 00       	jmp    805407 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  805353:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80535a:	00 
+  while (n) {
+  80535b:	e9 98 00 00 00       	jmp    8053f8 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  805360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805364:	8b 40 0c             	mov    0xc(%rax),%eax
+  805367:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80536e:	00 00 00 
+  805371:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  805373:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80537a:	00 00 00 
+  80537d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805381:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  805385:	be 00 00 00 00       	mov    $0x0,%esi
+  80538a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80538f:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805396:	00 00 00 
+  805399:	ff d0                	call   *%rax
+  80539b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  80539e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8053a2:	7f 13                	jg     8053b7 <devfile_read+0x90>
+      return res ? res : res0;
+  8053a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8053a8:	74 07                	je     8053b1 <devfile_read+0x8a>
+  8053aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053ad:	48 98                	cltq
+  8053af:	eb 56                	jmp    805407 <devfile_read+0xe0>
+  8053b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053b5:	eb 50                	jmp    805407 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8053b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053ba:	48 63 d0             	movslq %eax,%rdx
+  8053bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053c1:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  8053c8:	00 00 00 
+  8053cb:	48 89 ce             	mov    %rcx,%rsi
+  8053ce:	48 89 c7             	mov    %rax,%rdi
+  8053d1:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  8053d8:	00 00 00 
+  8053db:	ff d0                	call   *%rax
+
+    buf += res;
+  8053dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053e0:	48 98                	cltq
+  8053e2:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8053e6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053e9:	48 98                	cltq
+  8053eb:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8053ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053f2:	48 98                	cltq
+  8053f4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8053f8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8053fd:	0f 85 5d ff ff ff    	jne    805360 <devfile_read+0x39>
+  }
+
+  return res0;
+  805403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  805407:	c9                   	leave
+  805408:	c3                   	ret
+
+0000000000805409 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  805409:	55                   	push   %rbp
+  80540a:	48 89 e5             	mov    %rsp,%rbp
+  80540d:	48 83 ec 50          	sub    $0x50,%rsp
+  805411:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805415:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805419:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80541d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805422:	74 07                	je     80542b <devfile_write+0x22>
+  805424:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805429:	75 0a                	jne    805435 <devfile_write+0x2c>
+  return E_INVAL;
+  80542b:	b8 03 00 00 00       	mov    $0x3,%eax
+  805430:	e9 c9 00 00 00       	jmp    8054fe <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  805435:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80543c:	00 
+
+  while (n) {
+  80543d:	e9 ad 00 00 00       	jmp    8054ef <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  805442:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805446:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80544a:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  805451:	00 
+  805452:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805456:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80545a:	48 39 c2             	cmp    %rax,%rdx
+  80545d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805461:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  805465:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805469:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80546d:	48 89 c6             	mov    %rax,%rsi
+  805470:	48 b8 10 b0 80 00 00 	movabs $0x80b010,%rax
+  805477:	00 00 00 
+  80547a:	48 89 c7             	mov    %rax,%rdi
+  80547d:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  805484:	00 00 00 
+  805487:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  805489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80548d:	8b 40 0c             	mov    0xc(%rax),%eax
+  805490:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  805497:	00 00 00 
+  80549a:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  80549c:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8054a3:	00 00 00 
+  8054a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054aa:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8054ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8054b3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8054b8:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  8054bf:	00 00 00 
+  8054c2:	ff d0                	call   *%rax
+  8054c4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8054c7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8054cb:	79 07                	jns    8054d4 <devfile_write+0xcb>
+      return res;
+  8054cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054d0:	48 98                	cltq
+  8054d2:	eb 2a                	jmp    8054fe <devfile_write+0xf5>
+
+    buf += res;
+  8054d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054d7:	48 98                	cltq
+  8054d9:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8054dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054e0:	48 98                	cltq
+  8054e2:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8054e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054e9:	48 98                	cltq
+  8054eb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8054ef:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8054f4:	0f 85 48 ff ff ff    	jne    805442 <devfile_write+0x39>
+  }
+
+  return res0;
+  8054fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8054fe:	c9                   	leave
+  8054ff:	c3                   	ret
+
+0000000000805500 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  805500:	55                   	push   %rbp
+  805501:	48 89 e5             	mov    %rsp,%rbp
+  805504:	48 83 ec 20          	sub    $0x20,%rsp
+  805508:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80550c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  805510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805514:	8b 40 0c             	mov    0xc(%rax),%eax
+  805517:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80551e:	00 00 00 
+  805521:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  805523:	be 00 00 00 00       	mov    $0x0,%esi
+  805528:	bf 05 00 00 00       	mov    $0x5,%edi
+  80552d:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805534:	00 00 00 
+  805537:	ff d0                	call   *%rax
+  805539:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80553c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805540:	79 05                	jns    805547 <devfile_stat+0x47>
+    return r;
+  805542:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805545:	eb 59                	jmp    8055a0 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805547:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80554b:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  805552:	00 00 00 
+  805555:	48 89 d6             	mov    %rdx,%rsi
+  805558:	48 89 c7             	mov    %rax,%rdi
+  80555b:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  805562:	00 00 00 
+  805565:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  805567:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  80556e:	00 00 00 
+  805571:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  805577:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80557b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805581:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  805588:	00 00 00 
+  80558b:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  805591:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805595:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  80559b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055a0:	c9                   	leave
+  8055a1:	c3                   	ret
+
+00000000008055a2 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8055a2:	55                   	push   %rbp
+  8055a3:	48 89 e5             	mov    %rsp,%rbp
+  8055a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8055aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8055ae:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8055b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055b5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8055b8:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8055bf:	00 00 00 
+  8055c2:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8055c4:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8055cb:	00 00 00 
+  8055ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055d1:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8055d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8055d9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8055de:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  8055e5:	00 00 00 
+  8055e8:	ff d0                	call   *%rax
+}
+  8055ea:	c9                   	leave
+  8055eb:	c3                   	ret
+
+00000000008055ec <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8055ec:	55                   	push   %rbp
+  8055ed:	48 89 e5             	mov    %rsp,%rbp
+  8055f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8055f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8055f8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8055fb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8055ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805602:	83 e0 03             	and    $0x3,%eax
+}
+  805605:	c9                   	leave
+  805606:	c3                   	ret
+
+0000000000805607 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  805607:	55                   	push   %rbp
+  805608:	48 89 e5             	mov    %rsp,%rbp
+  80560b:	48 83 ec 10          	sub    $0x10,%rsp
+  80560f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  805613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805617:	48 89 c7             	mov    %rax,%rdi
+  80561a:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  805621:	00 00 00 
+  805624:	ff d0                	call   *%rax
+  805626:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80562b:	7e 07                	jle    805634 <remove+0x2d>
+    return -E_BAD_PATH;
+  80562d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  805632:	eb 36                	jmp    80566a <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  805634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805638:	48 89 c6             	mov    %rax,%rsi
+  80563b:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  805642:	00 00 00 
+  805645:	48 89 c7             	mov    %rax,%rdi
+  805648:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  80564f:	00 00 00 
+  805652:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  805654:	be 00 00 00 00       	mov    $0x0,%esi
+  805659:	bf 07 00 00 00       	mov    $0x7,%edi
+  80565e:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805665:	00 00 00 
+  805668:	ff d0                	call   *%rax
+}
+  80566a:	c9                   	leave
+  80566b:	c3                   	ret
+
+000000000080566c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80566c:	55                   	push   %rbp
+  80566d:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  805670:	be 00 00 00 00       	mov    $0x0,%esi
+  805675:	bf 08 00 00 00       	mov    $0x8,%edi
+  80567a:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805681:	00 00 00 
+  805684:	ff d0                	call   *%rax
+}
+  805686:	5d                   	pop    %rbp
+  805687:	c3                   	ret
+
+0000000000805688 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  805688:	55                   	push   %rbp
+  805689:	48 89 e5             	mov    %rsp,%rbp
+  80568c:	48 83 ec 20          	sub    $0x20,%rsp
+  805690:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  805694:	be 00 00 00 00       	mov    $0x0,%esi
+  805699:	bf 09 00 00 00       	mov    $0x9,%edi
+  80569e:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  8056a5:	00 00 00 
+  8056a8:	ff d0                	call   *%rax
+  8056aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b1:	79 05                	jns    8056b8 <fs_stats+0x30>
+    return r;
+  8056b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056b6:	eb 2a                	jmp    8056e2 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8056b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056bc:	ba 68 00 00 00       	mov    $0x68,%edx
+  8056c1:	48 b9 00 b0 80 00 00 	movabs $0x80b000,%rcx
+  8056c8:	00 00 00 
+  8056cb:	48 89 ce             	mov    %rcx,%rsi
+  8056ce:	48 89 c7             	mov    %rax,%rdi
+  8056d1:	48 b8 6b 25 80 00 00 	movabs $0x80256b,%rax
+  8056d8:	00 00 00 
+  8056db:	ff d0                	call   *%rax
+  return 0;
+  8056dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056e2:	c9                   	leave
+  8056e3:	c3                   	ret
+
+00000000008056e4 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8056e4:	55                   	push   %rbp
+  8056e5:	48 89 e5             	mov    %rsp,%rbp
+  8056e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8056ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  8056ef:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8056f6:	00 00 00 
+  8056f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056fc:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8056fe:	be 00 00 00 00       	mov    $0x0,%esi
+  805703:	bf 0a 00 00 00       	mov    $0xa,%edi
+  805708:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  80570f:	00 00 00 
+  805712:	ff d0                	call   *%rax
+}
+  805714:	c9                   	leave
+  805715:	c3                   	ret
+
+0000000000805716 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  805716:	55                   	push   %rbp
+  805717:	48 89 e5             	mov    %rsp,%rbp
+  80571a:	48 83 ec 10          	sub    $0x10,%rsp
+  80571e:	89 f8                	mov    %edi,%eax
+  805720:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  805723:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  805727:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  80572e:	00 00 00 
+  805731:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  805733:	be 00 00 00 00       	mov    $0x0,%esi
+  805738:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80573d:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  805744:	00 00 00 
+  805747:	ff d0                	call   *%rax
+}
+  805749:	c9                   	leave
+  80574a:	c3                   	ret
+
+000000000080574b <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  80574b:	55                   	push   %rbp
+  80574c:	48 89 e5             	mov    %rsp,%rbp
+  80574f:	48 83 ec 20          	sub    $0x20,%rsp
+  805753:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  805757:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80575b:	8b 40 10             	mov    0x10(%rax),%eax
+  80575e:	85 c0                	test   %eax,%eax
+  805760:	7e 73                	jle    8057d5 <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  805762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805766:	8b 40 04             	mov    0x4(%rax),%eax
+  805769:	48 63 d0             	movslq %eax,%rdx
+  80576c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805770:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  805774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805778:	8b 00                	mov    (%rax),%eax
+  80577a:	48 89 ce             	mov    %rcx,%rsi
+  80577d:	89 c7                	mov    %eax,%edi
+  80577f:	48 b8 27 4a 80 00 00 	movabs $0x804a27,%rax
+  805786:	00 00 00 
+  805789:	ff d0                	call   *%rax
+  80578b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  80578f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  805794:	7e 17                	jle    8057ad <writebuf+0x62>
+      b->result += result;
+  805796:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80579a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80579e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057a2:	48 01 c2             	add    %rax,%rdx
+  8057a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057a9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  8057ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057b1:	8b 40 04             	mov    0x4(%rax),%eax
+  8057b4:	48 98                	cltq
+  8057b6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8057ba:	74 19                	je     8057d5 <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  8057bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057c5:	48 85 c0             	test   %rax,%rax
+  8057c8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8057cc:	89 c2                	mov    %eax,%edx
+  8057ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057d2:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  8057d5:	90                   	nop
+  8057d6:	c9                   	leave
+  8057d7:	c3                   	ret
+
+00000000008057d8 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  8057d8:	55                   	push   %rbp
+  8057d9:	48 89 e5             	mov    %rsp,%rbp
+  8057dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8057e0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  8057e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  8057ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057f3:	8b 40 04             	mov    0x4(%rax),%eax
+  8057f6:	8d 48 01             	lea    0x1(%rax),%ecx
+  8057f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8057fd:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  805800:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805803:	89 d1                	mov    %edx,%ecx
+  805805:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805809:	48 98                	cltq
+  80580b:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  80580f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805813:	8b 40 04             	mov    0x4(%rax),%eax
+  805816:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80581b:	75 1e                	jne    80583b <putch+0x63>
+    writebuf(b);
+  80581d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805821:	48 89 c7             	mov    %rax,%rdi
+  805824:	48 b8 4b 57 80 00 00 	movabs $0x80574b,%rax
+  80582b:	00 00 00 
+  80582e:	ff d0                	call   *%rax
+    b->idx = 0;
+  805830:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805834:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  80583b:	90                   	nop
+  80583c:	c9                   	leave
+  80583d:	c3                   	ret
+
+000000000080583e <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80583e:	55                   	push   %rbp
+  80583f:	48 89 e5             	mov    %rsp,%rbp
+  805842:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  805849:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  80584f:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  805856:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  80585d:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  805863:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  805869:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  805870:	00 00 00 
+  b.result = 0;
+  805873:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  80587a:	00 00 00 00 
+  b.error  = 1;
+  80587e:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  805885:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  805888:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  80588f:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  805896:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80589d:	48 89 c6             	mov    %rax,%rsi
+  8058a0:	48 b8 d8 57 80 00 00 	movabs $0x8057d8,%rax
+  8058a7:	00 00 00 
+  8058aa:	48 89 c7             	mov    %rax,%rdi
+  8058ad:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  8058b4:	00 00 00 
+  8058b7:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  8058b9:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8058bf:	85 c0                	test   %eax,%eax
+  8058c1:	7e 16                	jle    8058d9 <vfprintf+0x9b>
+    writebuf(&b);
+  8058c3:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8058ca:	48 89 c7             	mov    %rax,%rdi
+  8058cd:	48 b8 4b 57 80 00 00 	movabs $0x80574b,%rax
+  8058d4:	00 00 00 
+  8058d7:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  8058d9:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8058e0:	48 85 c0             	test   %rax,%rax
+  8058e3:	74 09                	je     8058ee <vfprintf+0xb0>
+  8058e5:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8058ec:	eb 06                	jmp    8058f4 <vfprintf+0xb6>
+  8058ee:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  8058f4:	c9                   	leave
+  8058f5:	c3                   	ret
+
+00000000008058f6 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8058f6:	55                   	push   %rbp
+  8058f7:	48 89 e5             	mov    %rsp,%rbp
+  8058fa:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  805901:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  805907:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80590e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  805915:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80591c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  805923:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80592a:	84 c0                	test   %al,%al
+  80592c:	74 20                	je     80594e <fprintf+0x58>
+  80592e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  805932:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  805936:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80593a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80593e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  805942:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  805946:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80594a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80594e:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  805955:	00 00 00 
+  805958:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80595f:	00 00 00 
+  805962:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805966:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80596d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805974:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  80597b:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  805982:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  805989:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80598f:	48 89 ce             	mov    %rcx,%rsi
+  805992:	89 c7                	mov    %eax,%edi
+  805994:	48 b8 3e 58 80 00 00 	movabs $0x80583e,%rax
+  80599b:	00 00 00 
+  80599e:	ff d0                	call   *%rax
+  8059a0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8059a6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8059ac:	c9                   	leave
+  8059ad:	c3                   	ret
+
+00000000008059ae <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8059ae:	55                   	push   %rbp
+  8059af:	48 89 e5             	mov    %rsp,%rbp
+  8059b2:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8059b9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8059c0:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8059c7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8059ce:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8059d5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8059dc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8059e3:	84 c0                	test   %al,%al
+  8059e5:	74 20                	je     805a07 <printf+0x59>
+  8059e7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8059eb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8059ef:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8059f3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8059f7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8059fb:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8059ff:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  805a03:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  805a07:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  805a0e:	00 00 00 
+  805a11:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  805a18:	00 00 00 
+  805a1b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805a1f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  805a26:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805a2d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  805a34:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  805a3b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  805a42:	48 89 c6             	mov    %rax,%rsi
+  805a45:	bf 01 00 00 00       	mov    $0x1,%edi
+  805a4a:	48 b8 3e 58 80 00 00 	movabs $0x80583e,%rax
+  805a51:	00 00 00 
+  805a54:	ff d0                	call   *%rax
+  805a56:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  805a5c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  805a62:	c9                   	leave
+  805a63:	c3                   	ret
+
+0000000000805a64 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  805a64:	55                   	push   %rbp
+  805a65:	48 89 e5             	mov    %rsp,%rbp
+  805a68:	53                   	push   %rbx
+  805a69:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  805a70:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  805a77:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  805a7e:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  805a85:	be 00 00 00 00       	mov    $0x0,%esi
+  805a8a:	48 89 c7             	mov    %rax,%rdi
+  805a8d:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  805a94:	00 00 00 
+  805a97:	ff d0                	call   *%rax
+  805a99:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805a9c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805aa0:	79 08                	jns    805aaa <spawn+0x46>
+    return r;
+  805aa2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805aa5:	e9 35 04 00 00       	jmp    805edf <spawn+0x47b>
+  fd = r;
+  805aaa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805aad:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  805ab0:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  805ab7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  805abb:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  805ac2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805ac5:	ba 00 02 00 00       	mov    $0x200,%edx
+  805aca:	48 89 ce             	mov    %rcx,%rsi
+  805acd:	89 c7                	mov    %eax,%edi
+  805acf:	48 b8 ad 49 80 00 00 	movabs $0x8049ad,%rax
+  805ad6:	00 00 00 
+  805ad9:	ff d0                	call   *%rax
+  805adb:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  805ae1:	75 0d                	jne    805af0 <spawn+0x8c>
+  805ae3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ae7:	8b 00                	mov    (%rax),%eax
+  805ae9:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  805aee:	74 46                	je     805b36 <spawn+0xd2>
+    close(fd);
+  805af0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805af3:	89 c7                	mov    %eax,%edi
+  805af5:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  805afc:	00 00 00 
+  805aff:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  805b01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b05:	8b 00                	mov    (%rax),%eax
+  805b07:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  805b0c:	89 c6                	mov    %eax,%esi
+  805b0e:	48 b8 a0 8b 80 00 00 	movabs $0x808ba0,%rax
+  805b15:	00 00 00 
+  805b18:	48 89 c7             	mov    %rax,%rdi
+  805b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b20:	48 b9 78 10 80 00 00 	movabs $0x801078,%rcx
+  805b27:	00 00 00 
+  805b2a:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  805b2c:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  805b31:	e9 a9 03 00 00       	jmp    805edf <spawn+0x47b>
+  __asm __volatile("int %2"
+  805b36:	b8 09 00 00 00       	mov    $0x9,%eax
+  805b3b:	cd 30                	int    $0x30
+  805b3d:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  return ret;
+  805b40:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  805b43:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805b46:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805b4a:	79 08                	jns    805b54 <spawn+0xf0>
+    return r;
+  805b4c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805b4f:	e9 8b 03 00 00       	jmp    805edf <spawn+0x47b>
+  child = r;
+  805b54:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805b57:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  805b5a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805b5d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b62:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b69:	00 00 00 
+  805b6c:	48 98                	cltq
+  805b6e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b75:	48 01 d0             	add    %rdx,%rax
+  805b78:	48 8b 08             	mov    (%rax),%rcx
+  805b7b:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  805b7f:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  805b86:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  805b8d:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  805b91:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  805b95:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  805b9c:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  805ba3:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  805ba7:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  805bab:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  805bb2:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  805bb9:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  805bbd:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  805bc1:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  805bc8:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  805bcf:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  805bd3:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  805bd7:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  805bde:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  805be5:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  805be9:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  805bed:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  805bf4:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  805bfb:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  805bff:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  805c03:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  805c0a:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  805c11:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  805c15:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  805c19:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  805c20:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  805c27:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  805c2e:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  805c35:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  805c3c:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  805c43:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  805c4a:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  805c51:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  805c58:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  805c5f:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  805c66:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  805c6d:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  805c74:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  805c7b:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  805c82:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  805c89:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  805c90:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  805c97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c9b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  805c9f:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  805ca6:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  805cad:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  805cb3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  805cb7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805cbb:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  805cc2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805cc5:	48 89 ce             	mov    %rcx,%rsi
+  805cc8:	89 c7                	mov    %eax,%edi
+  805cca:	48 b8 47 61 80 00 00 	movabs $0x806147,%rax
+  805cd1:	00 00 00 
+  805cd4:	ff d0                	call   *%rax
+  805cd6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805cd9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805cdd:	79 08                	jns    805ce7 <spawn+0x283>
+    return r;
+  805cdf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805ce2:	e9 f8 01 00 00       	jmp    805edf <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  805ce7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ceb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  805cef:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  805cf6:	48 01 d0             	add    %rdx,%rax
+  805cf9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  805cfd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805d04:	e9 80 00 00 00       	jmp    805d89 <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  805d09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d0d:	8b 00                	mov    (%rax),%eax
+  805d0f:	83 f8 01             	cmp    $0x1,%eax
+  805d12:	75 6b                	jne    805d7f <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  805d14:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  805d1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d1f:	8b 40 04             	mov    0x4(%rax),%eax
+  805d22:	83 e0 02             	and    $0x2,%eax
+  805d25:	85 c0                	test   %eax,%eax
+  805d27:	74 04                	je     805d2d <spawn+0x2c9>
+      perm |= PTE_W;
+  805d29:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  805d2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d31:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  805d35:	41 89 c1             	mov    %eax,%r9d
+  805d38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d3c:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  805d40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d44:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  805d48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d4c:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  805d50:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  805d53:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805d56:	48 83 ec 08          	sub    $0x8,%rsp
+  805d5a:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  805d5d:	57                   	push   %rdi
+  805d5e:	89 c7                	mov    %eax,%edi
+  805d60:	48 b8 8f 64 80 00 00 	movabs $0x80648f,%rax
+  805d67:	00 00 00 
+  805d6a:	ff d0                	call   *%rax
+  805d6c:	48 83 c4 10          	add    $0x10,%rsp
+  805d70:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805d73:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805d77:	0f 88 3c 01 00 00    	js     805eb9 <spawn+0x455>
+  805d7d:	eb 01                	jmp    805d80 <spawn+0x31c>
+      continue;
+  805d7f:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  805d80:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805d84:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  805d89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d8d:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  805d91:	0f b7 c0             	movzwl %ax,%eax
+  805d94:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805d97:	0f 8c 6c ff ff ff    	jl     805d09 <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  805d9d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805da0:	89 c7                	mov    %eax,%edi
+  805da2:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  805da9:	00 00 00 
+  805dac:	ff d0                	call   *%rax
+  fd = -1;
+  805dae:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  805db5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805db8:	89 c7                	mov    %eax,%edi
+  805dba:	48 b8 7d 66 80 00 00 	movabs $0x80667d,%rax
+  805dc1:	00 00 00 
+  805dc4:	ff d0                	call   *%rax
+  805dc6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805dc9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805dcd:	79 36                	jns    805e05 <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  805dcf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805dd2:	89 c1                	mov    %eax,%ecx
+  805dd4:	48 b8 ba 8b 80 00 00 	movabs $0x808bba,%rax
+  805ddb:	00 00 00 
+  805dde:	48 89 c2             	mov    %rax,%rdx
+  805de1:	be 9f 00 00 00       	mov    $0x9f,%esi
+  805de6:	48 b8 d0 8b 80 00 00 	movabs $0x808bd0,%rax
+  805ded:	00 00 00 
+  805df0:	48 89 c7             	mov    %rax,%rdi
+  805df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805df8:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  805dff:	00 00 00 
+  805e02:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  805e05:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  805e0c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805e0f:	48 89 d6             	mov    %rdx,%rsi
+  805e12:	89 c7                	mov    %eax,%edi
+  805e14:	48 b8 c7 31 80 00 00 	movabs $0x8031c7,%rax
+  805e1b:	00 00 00 
+  805e1e:	ff d0                	call   *%rax
+  805e20:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805e23:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805e27:	79 36                	jns    805e5f <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  805e29:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805e2c:	89 c1                	mov    %eax,%ecx
+  805e2e:	48 b8 dc 8b 80 00 00 	movabs $0x808bdc,%rax
+  805e35:	00 00 00 
+  805e38:	48 89 c2             	mov    %rax,%rdx
+  805e3b:	be a2 00 00 00       	mov    $0xa2,%esi
+  805e40:	48 b8 d0 8b 80 00 00 	movabs $0x808bd0,%rax
+  805e47:	00 00 00 
+  805e4a:	48 89 c7             	mov    %rax,%rdi
+  805e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e52:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  805e59:	00 00 00 
+  805e5c:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  805e5f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805e62:	be 02 00 00 00       	mov    $0x2,%esi
+  805e67:	89 c7                	mov    %eax,%edi
+  805e69:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  805e70:	00 00 00 
+  805e73:	ff d0                	call   *%rax
+  805e75:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805e78:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805e7c:	79 36                	jns    805eb4 <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  805e7e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805e81:	89 c1                	mov    %eax,%ecx
+  805e83:	48 b8 f6 8b 80 00 00 	movabs $0x808bf6,%rax
+  805e8a:	00 00 00 
+  805e8d:	48 89 c2             	mov    %rax,%rdx
+  805e90:	be a5 00 00 00       	mov    $0xa5,%esi
+  805e95:	48 b8 d0 8b 80 00 00 	movabs $0x808bd0,%rax
+  805e9c:	00 00 00 
+  805e9f:	48 89 c7             	mov    %rax,%rdi
+  805ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ea7:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  805eae:	00 00 00 
+  805eb1:	41 ff d0             	call   *%r8
+
+  return child;
+  805eb4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805eb7:	eb 26                	jmp    805edf <spawn+0x47b>
+      goto error;
+  805eb9:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  805eba:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805ebd:	89 c7                	mov    %eax,%edi
+  805ebf:	48 b8 e8 2e 80 00 00 	movabs $0x802ee8,%rax
+  805ec6:	00 00 00 
+  805ec9:	ff d0                	call   *%rax
+  close(fd);
+  805ecb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805ece:	89 c7                	mov    %eax,%edi
+  805ed0:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  805ed7:	00 00 00 
+  805eda:	ff d0                	call   *%rax
+  return r;
+  805edc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  805edf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ee3:	c9                   	leave
+  805ee4:	c3                   	ret
+
+0000000000805ee5 <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  805ee5:	55                   	push   %rbp
+  805ee6:	48 89 e5             	mov    %rsp,%rbp
+  805ee9:	41 55                	push   %r13
+  805eeb:	41 54                	push   %r12
+  805eed:	53                   	push   %rbx
+  805eee:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805ef5:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  805efc:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  805f03:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  805f0a:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  805f11:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  805f18:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  805f1f:	84 c0                	test   %al,%al
+  805f21:	74 26                	je     805f49 <spawnl+0x64>
+  805f23:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  805f2a:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  805f31:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  805f35:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  805f39:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805f3d:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805f41:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  805f45:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  805f49:	48 89 e0             	mov    %rsp,%rax
+  805f4c:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  805f4f:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  805f56:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  805f59:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  805f60:	00 00 00 
+  805f63:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  805f6a:	00 00 00 
+  805f6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805f71:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  805f78:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  805f7f:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  805f86:	eb 07                	jmp    805f8f <spawnl+0xaa>
+    argc++;
+  805f88:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  805f8f:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  805f95:	83 f8 2f             	cmp    $0x2f,%eax
+  805f98:	77 23                	ja     805fbd <spawnl+0xd8>
+  805f9a:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  805fa1:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  805fa7:	89 d2                	mov    %edx,%edx
+  805fa9:	48 01 d0             	add    %rdx,%rax
+  805fac:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  805fb2:	83 c2 08             	add    $0x8,%edx
+  805fb5:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  805fbb:	eb 12                	jmp    805fcf <spawnl+0xea>
+  805fbd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805fc4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805fc8:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  805fcf:	48 8b 00             	mov    (%rax),%rax
+  805fd2:	48 85 c0             	test   %rax,%rax
+  805fd5:	75 b1                	jne    805f88 <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  805fd7:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  805fdd:	83 c0 02             	add    $0x2,%eax
+  805fe0:	48 63 d0             	movslq %eax,%rdx
+  805fe3:	48 83 ea 01          	sub    $0x1,%rdx
+  805fe7:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  805fee:	48 63 d0             	movslq %eax,%rdx
+  805ff1:	49 89 d4             	mov    %rdx,%r12
+  805ff4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  805ffa:	48 63 d0             	movslq %eax,%rdx
+  805ffd:	49 89 d2             	mov    %rdx,%r10
+  806000:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  806006:	48 98                	cltq
+  806008:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80600f:	00 
+  806010:	b8 10 00 00 00       	mov    $0x10,%eax
+  806015:	48 83 e8 01          	sub    $0x1,%rax
+  806019:	48 01 d0             	add    %rdx,%rax
+  80601c:	be 10 00 00 00       	mov    $0x10,%esi
+  806021:	ba 00 00 00 00       	mov    $0x0,%edx
+  806026:	48 f7 f6             	div    %rsi
+  806029:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  80602d:	48 29 c4             	sub    %rax,%rsp
+  806030:	48 89 e0             	mov    %rsp,%rax
+  806033:	48 83 c0 07          	add    $0x7,%rax
+  806037:	48 c1 e8 03          	shr    $0x3,%rax
+  80603b:	48 c1 e0 03          	shl    $0x3,%rax
+  80603f:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  806046:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80604d:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  806054:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  806057:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80605d:	8d 50 01             	lea    0x1(%rax),%edx
+  806060:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  806067:	48 63 d2             	movslq %edx,%rdx
+  80606a:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  806071:	00 
+
+  va_start(vl, arg0);
+  806072:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  806079:	00 00 00 
+  80607c:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  806083:	00 00 00 
+  806086:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80608a:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  806091:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  806098:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  80609f:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  8060a6:	00 00 00 
+  8060a9:	eb 60                	jmp    80610b <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  8060ab:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  8060b1:	8d 48 01             	lea    0x1(%rax),%ecx
+  8060b4:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8060ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8060bd:	77 23                	ja     8060e2 <spawnl+0x1fd>
+  8060bf:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8060c6:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8060cc:	89 d2                	mov    %edx,%edx
+  8060ce:	48 01 d0             	add    %rdx,%rax
+  8060d1:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8060d7:	83 c2 08             	add    $0x8,%edx
+  8060da:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8060e0:	eb 12                	jmp    8060f4 <spawnl+0x20f>
+  8060e2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8060e9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8060ed:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8060f4:	48 8b 10             	mov    (%rax),%rdx
+  8060f7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8060fe:	89 c9                	mov    %ecx,%ecx
+  806100:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  806104:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  80610b:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  806111:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  806117:	72 92                	jb     8060ab <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  806119:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  806120:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806127:	48 89 d6             	mov    %rdx,%rsi
+  80612a:	48 89 c7             	mov    %rax,%rdi
+  80612d:	48 b8 64 5a 80 00 00 	movabs $0x805a64,%rax
+  806134:	00 00 00 
+  806137:	ff d0                	call   *%rax
+  806139:	48 89 dc             	mov    %rbx,%rsp
+}
+  80613c:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  806140:	5b                   	pop    %rbx
+  806141:	41 5c                	pop    %r12
+  806143:	41 5d                	pop    %r13
+  806145:	5d                   	pop    %rbp
+  806146:	c3                   	ret
+
+0000000000806147 <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  806147:	55                   	push   %rbp
+  806148:	48 89 e5             	mov    %rsp,%rbp
+  80614b:	48 83 ec 50          	sub    $0x50,%rsp
+  80614f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806152:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806156:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  80615a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806161:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  806162:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  806169:	eb 33                	jmp    80619e <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  80616b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80616e:	48 98                	cltq
+  806170:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  806177:	00 
+  806178:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80617c:	48 01 d0             	add    %rdx,%rax
+  80617f:	48 8b 00             	mov    (%rax),%rax
+  806182:	48 89 c7             	mov    %rax,%rdi
+  806185:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  80618c:	00 00 00 
+  80618f:	ff d0                	call   *%rax
+  806191:	83 c0 01             	add    $0x1,%eax
+  806194:	48 98                	cltq
+  806196:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  80619a:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80619e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8061a1:	48 98                	cltq
+  8061a3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8061aa:	00 
+  8061ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8061af:	48 01 d0             	add    %rdx,%rax
+  8061b2:	48 8b 00             	mov    (%rax),%rax
+  8061b5:	48 85 c0             	test   %rax,%rax
+  8061b8:	75 b1                	jne    80616b <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  8061ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061be:	48 f7 d8             	neg    %rax
+  8061c1:	48 05 00 40 40 00    	add    $0x404000,%rax
+  8061c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  8061cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061cf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8061d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061d7:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8061db:	48 89 c2             	mov    %rax,%rdx
+  8061de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8061e1:	83 c0 01             	add    $0x1,%eax
+  8061e4:	c1 e0 03             	shl    $0x3,%eax
+  8061e7:	48 98                	cltq
+  8061e9:	48 f7 d8             	neg    %rax
+  8061ec:	48 01 d0             	add    %rdx,%rax
+  8061ef:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  8061f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8061f7:	48 83 e8 10          	sub    $0x10,%rax
+  8061fb:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  806201:	77 0a                	ja     80620d <init_stack+0xc6>
+    return -E_NO_MEM;
+  806203:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  806208:	e9 80 02 00 00       	jmp    80648d <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  80620d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  806214:	eb 3c                	jmp    806252 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  806216:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  806219:	48 98                	cltq
+  80621b:	48 05 00 00 40 00    	add    $0x400000,%rax
+  806221:	ba 07 00 00 00       	mov    $0x7,%edx
+  806226:	48 89 c6             	mov    %rax,%rsi
+  806229:	bf 00 00 00 00       	mov    $0x0,%edi
+  80622e:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  806235:	00 00 00 
+  806238:	ff d0                	call   *%rax
+  80623a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80623d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806241:	79 08                	jns    80624b <init_stack+0x104>
+      return r;
+  806243:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806246:	e9 42 02 00 00       	jmp    80648d <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  80624b:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  806252:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  806259:	7e bb                	jle    806216 <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80625b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  806262:	e9 8f 00 00 00       	jmp    8062f6 <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  806267:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80626e:	00 00 00 
+  806271:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806275:	48 01 d0             	add    %rdx,%rax
+  806278:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80627f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  806282:	48 98                	cltq
+  806284:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  80628b:	00 
+  80628c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806290:	48 01 c8             	add    %rcx,%rax
+  806293:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  806296:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  806299:	48 98                	cltq
+  80629b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8062a2:	00 
+  8062a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8062a7:	48 01 d0             	add    %rdx,%rax
+  8062aa:	48 8b 10             	mov    (%rax),%rdx
+  8062ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062b1:	48 89 d6             	mov    %rdx,%rsi
+  8062b4:	48 89 c7             	mov    %rax,%rdi
+  8062b7:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8062be:	00 00 00 
+  8062c1:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  8062c3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8062c6:	48 98                	cltq
+  8062c8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8062cf:	00 
+  8062d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8062d4:	48 01 d0             	add    %rdx,%rax
+  8062d7:	48 8b 00             	mov    (%rax),%rax
+  8062da:	48 89 c7             	mov    %rax,%rdi
+  8062dd:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  8062e4:	00 00 00 
+  8062e7:	ff d0                	call   *%rax
+  8062e9:	83 c0 01             	add    $0x1,%eax
+  8062ec:	48 98                	cltq
+  8062ee:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  8062f2:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  8062f6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8062f9:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  8062fc:	0f 8c 65 ff ff ff    	jl     806267 <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  806302:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806305:	48 98                	cltq
+  806307:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80630e:	00 
+  80630f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806313:	48 01 d0             	add    %rdx,%rax
+  806316:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  80631d:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  806324:	00 
+  806325:	74 3e                	je     806365 <init_stack+0x21e>
+  806327:	48 b8 10 8c 80 00 00 	movabs $0x808c10,%rax
+  80632e:	00 00 00 
+  806331:	48 89 c1             	mov    %rax,%rcx
+  806334:	48 b8 3b 8c 80 00 00 	movabs $0x808c3b,%rax
+  80633b:	00 00 00 
+  80633e:	48 89 c2             	mov    %rax,%rdx
+  806341:	be 0c 01 00 00       	mov    $0x10c,%esi
+  806346:	48 b8 d0 8b 80 00 00 	movabs $0x808bd0,%rax
+  80634d:	00 00 00 
+  806350:	48 89 c7             	mov    %rax,%rdi
+  806353:	b8 00 00 00 00       	mov    $0x0,%eax
+  806358:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  80635f:	00 00 00 
+  806362:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  806365:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80636c:	00 00 00 
+  80636f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806373:	48 01 d0             	add    %rdx,%rax
+  806376:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80637d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806381:	48 83 e8 08          	sub    $0x8,%rax
+  806385:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  806388:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80638c:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  806390:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806393:	48 98                	cltq
+  806395:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  806398:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  80639f:	00 00 00 
+  8063a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063a6:	48 01 d0             	add    %rdx,%rax
+  8063a9:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  8063af:	48 89 c2             	mov    %rax,%rdx
+  8063b2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8063b6:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  8063b9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8063c0:	eb 78                	jmp    80643a <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  8063c2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8063c5:	48 98                	cltq
+  8063c7:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  8063ce:	00 00 00 
+  8063d1:	48 01 d0             	add    %rdx,%rax
+  8063d4:	48 89 c2             	mov    %rax,%rdx
+  8063d7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8063da:	48 98                	cltq
+  8063dc:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8063e3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8063e6:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8063ec:	48 89 d1             	mov    %rdx,%rcx
+  8063ef:	89 c2                	mov    %eax,%edx
+  8063f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063f6:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  8063fd:	00 00 00 
+  806400:	ff d0                	call   *%rax
+  806402:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806405:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806409:	78 43                	js     80644e <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  80640b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80640e:	48 98                	cltq
+  806410:	48 05 00 00 40 00    	add    $0x400000,%rax
+  806416:	48 89 c6             	mov    %rax,%rsi
+  806419:	bf 00 00 00 00       	mov    $0x0,%edi
+  80641e:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806425:	00 00 00 
+  806428:	ff d0                	call   *%rax
+  80642a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80642d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806431:	78 1e                	js     806451 <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  806433:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  80643a:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  806441:	0f 8e 7b ff ff ff    	jle    8063c2 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  806447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80644c:	eb 3f                	jmp    80648d <init_stack+0x346>
+      goto error;
+  80644e:	90                   	nop
+  80644f:	eb 01                	jmp    806452 <init_stack+0x30b>
+      goto error;
+  806451:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  806452:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  806459:	eb 26                	jmp    806481 <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  80645b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80645e:	48 98                	cltq
+  806460:	48 05 00 00 40 00    	add    $0x400000,%rax
+  806466:	48 89 c6             	mov    %rax,%rsi
+  806469:	bf 00 00 00 00       	mov    $0x0,%edi
+  80646e:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806475:	00 00 00 
+  806478:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  80647a:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  806481:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  806488:	7e d1                	jle    80645b <init_stack+0x314>
+  return r;
+  80648a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80648d:	c9                   	leave
+  80648e:	c3                   	ret
+
+000000000080648f <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  80648f:	55                   	push   %rbp
+  806490:	48 89 e5             	mov    %rsp,%rbp
+  806493:	48 83 ec 50          	sub    $0x50,%rsp
+  806497:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80649a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80649e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8064a2:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  8064a5:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8064a9:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  8064ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064b1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8064b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8064b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8064bd:	74 21                	je     8064e0 <map_segment+0x51>
+    va -= i;
+  8064bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064c2:	48 98                	cltq
+  8064c4:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  8064c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064cb:	48 98                	cltq
+  8064cd:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  8064d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064d4:	48 98                	cltq
+  8064d6:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  8064da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064dd:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  8064e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8064e7:	e9 7b 01 00 00       	jmp    806667 <map_segment+0x1d8>
+    if (i >= filesz) {
+  8064ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064ef:	48 98                	cltq
+  8064f1:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8064f5:	72 3c                	jb     806533 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  8064f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064fa:	48 63 d0             	movslq %eax,%rdx
+  8064fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806501:	48 01 d0             	add    %rdx,%rax
+  806504:	48 89 c1             	mov    %rax,%rcx
+  806507:	8b 55 10             	mov    0x10(%rbp),%edx
+  80650a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80650d:	48 89 ce             	mov    %rcx,%rsi
+  806510:	89 c7                	mov    %eax,%edi
+  806512:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  806519:	00 00 00 
+  80651c:	ff d0                	call   *%rax
+  80651e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  806521:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806525:	0f 89 35 01 00 00    	jns    806660 <map_segment+0x1d1>
+        return r;
+  80652b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80652e:	e9 48 01 00 00       	jmp    80667b <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  806533:	ba 07 00 00 00       	mov    $0x7,%edx
+  806538:	be 00 00 40 00       	mov    $0x400000,%esi
+  80653d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806542:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  806549:	00 00 00 
+  80654c:	ff d0                	call   *%rax
+  80654e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  806551:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806555:	79 08                	jns    80655f <map_segment+0xd0>
+        return r;
+  806557:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80655a:	e9 1c 01 00 00       	jmp    80667b <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  80655f:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  806562:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806565:	01 c2                	add    %eax,%edx
+  806567:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80656a:	89 d6                	mov    %edx,%esi
+  80656c:	89 c7                	mov    %eax,%edi
+  80656e:	48 b8 28 4b 80 00 00 	movabs $0x804b28,%rax
+  806575:	00 00 00 
+  806578:	ff d0                	call   *%rax
+  80657a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80657d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806581:	79 08                	jns    80658b <map_segment+0xfc>
+        return r;
+  806583:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806586:	e9 f0 00 00 00       	jmp    80667b <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  80658b:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  806592:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806595:	48 98                	cltq
+  806597:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80659b:	48 29 c2             	sub    %rax,%rdx
+  80659e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8065a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8065a5:	48 63 d0             	movslq %eax,%rdx
+  8065a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065ac:	48 39 c2             	cmp    %rax,%rdx
+  8065af:	48 0f 47 d0          	cmova  %rax,%rdx
+  8065b3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8065b6:	be 00 00 40 00       	mov    $0x400000,%esi
+  8065bb:	89 c7                	mov    %eax,%edi
+  8065bd:	48 b8 ad 49 80 00 00 	movabs $0x8049ad,%rax
+  8065c4:	00 00 00 
+  8065c7:	ff d0                	call   *%rax
+  8065c9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8065cc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8065d0:	79 08                	jns    8065da <map_segment+0x14b>
+        return r;
+  8065d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8065d5:	e9 a1 00 00 00       	jmp    80667b <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  8065da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8065dd:	48 63 d0             	movslq %eax,%rdx
+  8065e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065e4:	48 01 d0             	add    %rdx,%rax
+  8065e7:	48 89 c1             	mov    %rax,%rcx
+  8065ea:	8b 55 10             	mov    0x10(%rbp),%edx
+  8065ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8065f0:	41 89 d0             	mov    %edx,%r8d
+  8065f3:	89 c2                	mov    %eax,%edx
+  8065f5:	be 00 00 40 00       	mov    $0x400000,%esi
+  8065fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065ff:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  806606:	00 00 00 
+  806609:	ff d0                	call   *%rax
+  80660b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80660e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806612:	79 36                	jns    80664a <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  806614:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806617:	89 c1                	mov    %eax,%ecx
+  806619:	48 b8 50 8c 80 00 00 	movabs $0x808c50,%rax
+  806620:	00 00 00 
+  806623:	48 89 c2             	mov    %rax,%rdx
+  806626:	be 40 01 00 00       	mov    $0x140,%esi
+  80662b:	48 b8 d0 8b 80 00 00 	movabs $0x808bd0,%rax
+  806632:	00 00 00 
+  806635:	48 89 c7             	mov    %rax,%rdi
+  806638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80663d:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  806644:	00 00 00 
+  806647:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  80664a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80664f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806654:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80665b:	00 00 00 
+  80665e:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  806660:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  806667:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80666a:	48 98                	cltq
+  80666c:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  806670:	0f 82 76 fe ff ff    	jb     8064ec <map_segment+0x5d>
+    }
+  }
+  return 0;
+  806676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80667b:	c9                   	leave
+  80667c:	c3                   	ret
+
+000000000080667d <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  80667d:	55                   	push   %rbp
+  80667e:	48 89 e5             	mov    %rsp,%rbp
+  806681:	48 83 ec 20          	sub    $0x20,%rsp
+  806685:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  806688:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  80668f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  806696:	00 
+  806697:	e9 e7 00 00 00       	jmp    806783 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  80669c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066a0:	48 c1 e8 27          	shr    $0x27,%rax
+  8066a4:	48 89 c2             	mov    %rax,%rdx
+  8066a7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8066ae:	01 00 00 
+  8066b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8066b5:	83 e0 01             	and    $0x1,%eax
+  8066b8:	48 85 c0             	test   %rax,%rax
+  8066bb:	0f 84 b9 00 00 00    	je     80677a <copy_shared_pages+0xfd>
+  8066c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066c5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8066c9:	48 89 c2             	mov    %rax,%rdx
+  8066cc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8066d3:	01 00 00 
+  8066d6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8066da:	83 e0 01             	and    $0x1,%eax
+  8066dd:	48 85 c0             	test   %rax,%rax
+  8066e0:	0f 84 94 00 00 00    	je     80677a <copy_shared_pages+0xfd>
+  8066e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066ea:	48 c1 e8 15          	shr    $0x15,%rax
+  8066ee:	48 89 c2             	mov    %rax,%rdx
+  8066f1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8066f8:	01 00 00 
+  8066fb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8066ff:	83 e0 01             	and    $0x1,%eax
+  806702:	48 85 c0             	test   %rax,%rax
+  806705:	74 73                	je     80677a <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  806707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80670b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80670f:	48 89 c2             	mov    %rax,%rdx
+  806712:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806719:	01 00 00 
+  80671c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806720:	25 01 04 00 00       	and    $0x401,%eax
+  806725:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  80672b:	75 4e                	jne    80677b <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  80672d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806731:	48 c1 e8 0c          	shr    $0xc,%rax
+  806735:	48 89 c2             	mov    %rax,%rdx
+  806738:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80673f:	01 00 00 
+  806742:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806746:	25 07 0e 00 00       	and    $0xe07,%eax
+  80674b:	89 c6                	mov    %eax,%esi
+  80674d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806751:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806755:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806758:	41 89 f0             	mov    %esi,%r8d
+  80675b:	48 89 c6             	mov    %rax,%rsi
+  80675e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806763:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  80676a:	00 00 00 
+  80676d:	ff d0                	call   *%rax
+  80676f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  806772:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806776:	78 21                	js     806799 <copy_shared_pages+0x11c>
+  806778:	eb 01                	jmp    80677b <copy_shared_pages+0xfe>
+      continue;
+  80677a:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  80677b:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  806782:	00 
+  806783:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  80678a:	00 00 00 
+  80678d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  806791:	0f 83 05 ff ff ff    	jae    80669c <copy_shared_pages+0x1f>
+  806797:	eb 01                	jmp    80679a <copy_shared_pages+0x11d>
+        break;
+  806799:	90                   	nop
+    }
+  }
+  return err;
+  80679a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80679d:	c9                   	leave
+  80679e:	c3                   	ret
+
+000000000080679f <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80679f:	55                   	push   %rbp
+  8067a0:	48 89 e5             	mov    %rsp,%rbp
+  8067a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8067a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8067ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8067af:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8067b4:	48 89 c7             	mov    %rax,%rdi
+  8067b7:	48 b8 c5 67 80 00 00 	movabs $0x8067c5,%rax
+  8067be:	00 00 00 
+  8067c1:	ff d0                	call   *%rax
+}
+  8067c3:	c9                   	leave
+  8067c4:	c3                   	ret
+
+00000000008067c5 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8067c5:	55                   	push   %rbp
+  8067c6:	48 89 e5             	mov    %rsp,%rbp
+  8067c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8067cd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8067d1:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8067d5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8067dc:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8067dd:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8067e2:	74 0a                	je     8067ee <pipe_size+0x29>
+  8067e4:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8067eb:	00 
+  8067ec:	76 0a                	jbe    8067f8 <pipe_size+0x33>
+    return -E_INVAL;
+  8067ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8067f3:	e9 cc 02 00 00       	jmp    806ac4 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8067f8:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8067fc:	48 89 c7             	mov    %rax,%rdi
+  8067ff:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  806806:	00 00 00 
+  806809:	ff d0                	call   *%rax
+  80680b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80680e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806812:	0f 88 a8 02 00 00    	js     806ac0 <pipe_size+0x2fb>
+  806818:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80681c:	ba 07 04 00 00       	mov    $0x407,%edx
+  806821:	48 89 c6             	mov    %rax,%rsi
+  806824:	bf 00 00 00 00       	mov    $0x0,%edi
+  806829:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  806830:	00 00 00 
+  806833:	ff d0                	call   *%rax
+  806835:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806838:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80683c:	0f 88 7e 02 00 00    	js     806ac0 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  806842:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  806846:	48 89 c7             	mov    %rax,%rdi
+  806849:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  806850:	00 00 00 
+  806853:	ff d0                	call   *%rax
+  806855:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806858:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80685c:	0f 88 43 02 00 00    	js     806aa5 <pipe_size+0x2e0>
+  806862:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806866:	ba 07 04 00 00       	mov    $0x407,%edx
+  80686b:	48 89 c6             	mov    %rax,%rsi
+  80686e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806873:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  80687a:	00 00 00 
+  80687d:	ff d0                	call   *%rax
+  80687f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806882:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806886:	0f 88 19 02 00 00    	js     806aa5 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80688c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806890:	48 89 c7             	mov    %rax,%rdi
+  806893:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  80689a:	00 00 00 
+  80689d:	ff d0                	call   *%rax
+  80689f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8068a3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8068aa:	00 
+  8068ab:	e9 a2 00 00 00       	jmp    806952 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8068b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8068b4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8068b8:	48 89 c2             	mov    %rax,%rdx
+  8068bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068bf:	48 01 d0             	add    %rdx,%rax
+  8068c2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8068c7:	48 89 c6             	mov    %rax,%rsi
+  8068ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068cf:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  8068d6:	00 00 00 
+  8068d9:	ff d0                	call   *%rax
+  8068db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8068de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8068e2:	0f 88 37 01 00 00    	js     806a1f <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8068e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8068ec:	48 89 c7             	mov    %rax,%rdi
+  8068ef:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  8068f6:	00 00 00 
+  8068f9:	ff d0                	call   *%rax
+  8068fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8068ff:	48 c1 e2 0c          	shl    $0xc,%rdx
+  806903:	48 01 c2             	add    %rax,%rdx
+  806906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80690a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80690e:	48 89 c1             	mov    %rax,%rcx
+  806911:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806915:	48 01 c8             	add    %rcx,%rax
+  806918:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80691e:	48 89 d1             	mov    %rdx,%rcx
+  806921:	ba 00 00 00 00       	mov    $0x0,%edx
+  806926:	48 89 c6             	mov    %rax,%rsi
+  806929:	bf 00 00 00 00       	mov    $0x0,%edi
+  80692e:	48 b8 ce 30 80 00 00 	movabs $0x8030ce,%rax
+  806935:	00 00 00 
+  806938:	ff d0                	call   *%rax
+  80693a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80693d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806941:	79 0a                	jns    80694d <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  806943:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  806948:	e9 d3 00 00 00       	jmp    806a20 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80694d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  806952:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  806959:	00 
+  80695a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80695e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806962:	48 01 d0             	add    %rdx,%rax
+  806965:	48 83 c0 1f          	add    $0x1f,%rax
+  806969:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80696d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806971:	ba 00 00 00 00       	mov    $0x0,%edx
+  806976:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80697a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80697e:	48 29 d0             	sub    %rdx,%rax
+  806981:	48 c1 e8 0c          	shr    $0xc,%rax
+  806985:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  806989:	0f 82 21 ff ff ff    	jb     8068b0 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80698f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806993:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  806997:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80699b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80699f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8069a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8069a7:	48 ba c0 90 80 00 00 	movabs $0x8090c0,%rdx
+  8069ae:	00 00 00 
+  8069b1:	8b 12                	mov    (%rdx),%edx
+  8069b3:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8069b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8069b9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8069c0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8069c4:	48 ba c0 90 80 00 00 	movabs $0x8090c0,%rdx
+  8069cb:	00 00 00 
+  8069ce:	8b 12                	mov    (%rdx),%edx
+  8069d0:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8069d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8069d6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8069dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8069e1:	48 89 c7             	mov    %rax,%rdi
+  8069e4:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  8069eb:	00 00 00 
+  8069ee:	ff d0                	call   *%rax
+  8069f0:	89 c2                	mov    %eax,%edx
+  8069f2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8069f6:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8069f8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8069fc:	48 89 c7             	mov    %rax,%rdi
+  8069ff:	48 b8 1f 42 80 00 00 	movabs $0x80421f,%rax
+  806a06:	00 00 00 
+  806a09:	ff d0                	call   *%rax
+  806a0b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806a0f:	48 83 c2 04          	add    $0x4,%rdx
+  806a13:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  806a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a1a:	e9 a5 00 00 00       	jmp    806ac4 <pipe_size+0x2ff>
+      goto err2;
+  806a1f:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  806a20:	eb 58                	jmp    806a7a <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  806a22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806a26:	48 c1 e0 0c          	shl    $0xc,%rax
+  806a2a:	48 89 c2             	mov    %rax,%rdx
+  806a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a31:	48 01 d0             	add    %rdx,%rax
+  806a34:	48 89 c6             	mov    %rax,%rsi
+  806a37:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a3c:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806a43:	00 00 00 
+  806a46:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  806a48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806a4c:	48 89 c7             	mov    %rax,%rdi
+  806a4f:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  806a56:	00 00 00 
+  806a59:	ff d0                	call   *%rax
+  806a5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806a5f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  806a63:	48 01 d0             	add    %rdx,%rax
+  806a66:	48 89 c6             	mov    %rax,%rsi
+  806a69:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a6e:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806a75:	00 00 00 
+  806a78:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  806a7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806a7e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  806a82:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  806a86:	48 85 c0             	test   %rax,%rax
+  806a89:	75 97                	jne    806a22 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  806a8b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806a8f:	48 89 c6             	mov    %rax,%rsi
+  806a92:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a97:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806a9e:	00 00 00 
+  806aa1:	ff d0                	call   *%rax
+  806aa3:	eb 01                	jmp    806aa6 <pipe_size+0x2e1>
+    goto err1;
+  806aa5:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  806aa6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806aaa:	48 89 c6             	mov    %rax,%rsi
+  806aad:	bf 00 00 00 00       	mov    $0x0,%edi
+  806ab2:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  806ab9:	00 00 00 
+  806abc:	ff d0                	call   *%rax
+  806abe:	eb 01                	jmp    806ac1 <pipe_size+0x2fc>
+    goto err;
+  806ac0:	90                   	nop
+err:
+  return r;
+  806ac1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  806ac4:	c9                   	leave
+  806ac5:	c3                   	ret
+
+0000000000806ac6 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  806ac6:	55                   	push   %rbp
+  806ac7:	48 89 e5             	mov    %rsp,%rbp
+  806aca:	53                   	push   %rbx
+  806acb:	48 83 ec 28          	sub    $0x28,%rsp
+  806acf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806ad3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  806ad7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806ade:	00 00 00 
+  806ae1:	8b 40 04             	mov    0x4(%rax),%eax
+  806ae4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806ae9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806af0:	00 00 00 
+  806af3:	48 98                	cltq
+  806af5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806afc:	48 01 d0             	add    %rdx,%rax
+  806aff:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  806b05:	8b 00                	mov    (%rax),%eax
+  806b07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  806b0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b0e:	48 89 c7             	mov    %rax,%rdi
+  806b11:	48 b8 82 7c 80 00 00 	movabs $0x807c82,%rax
+  806b18:	00 00 00 
+  806b1b:	ff d0                	call   *%rax
+  806b1d:	89 c3                	mov    %eax,%ebx
+  806b1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806b23:	48 89 c7             	mov    %rax,%rdi
+  806b26:	48 b8 82 7c 80 00 00 	movabs $0x807c82,%rax
+  806b2d:	00 00 00 
+  806b30:	ff d0                	call   *%rax
+  806b32:	39 c3                	cmp    %eax,%ebx
+  806b34:	0f 94 c0             	sete   %al
+  806b37:	0f b6 c0             	movzbl %al,%eax
+  806b3a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  806b3d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806b44:	00 00 00 
+  806b47:	8b 40 04             	mov    0x4(%rax),%eax
+  806b4a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806b4f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806b56:	00 00 00 
+  806b59:	48 98                	cltq
+  806b5b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806b62:	48 01 d0             	add    %rdx,%rax
+  806b65:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  806b6b:	8b 00                	mov    (%rax),%eax
+  806b6d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  806b70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b73:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  806b76:	75 05                	jne    806b7d <_pipeisclosed+0xb7>
+      return ret;
+  806b78:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806b7b:	eb 68                	jmp    806be5 <_pipeisclosed+0x11f>
+    if (n != nn)
+  806b7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b80:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  806b83:	0f 84 4e ff ff ff    	je     806ad7 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  806b89:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806b90:	00 00 00 
+  806b93:	8b 40 04             	mov    0x4(%rax),%eax
+  806b96:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806b9b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806ba2:	00 00 00 
+  806ba5:	48 98                	cltq
+  806ba7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806bae:	48 01 d0             	add    %rdx,%rax
+  806bb1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  806bb7:	8b 10                	mov    (%rax),%edx
+  806bb9:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  806bbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bbf:	89 c6                	mov    %eax,%esi
+  806bc1:	48 b8 78 8c 80 00 00 	movabs $0x808c78,%rax
+  806bc8:	00 00 00 
+  806bcb:	48 89 c7             	mov    %rax,%rdi
+  806bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bd3:	49 b8 78 10 80 00 00 	movabs $0x801078,%r8
+  806bda:	00 00 00 
+  806bdd:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  806be0:	e9 f2 fe ff ff       	jmp    806ad7 <_pipeisclosed+0x11>
+  }
+}
+  806be5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806be9:	c9                   	leave
+  806bea:	c3                   	ret
+
+0000000000806beb <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  806beb:	55                   	push   %rbp
+  806bec:	48 89 e5             	mov    %rsp,%rbp
+  806bef:	48 83 ec 30          	sub    $0x30,%rsp
+  806bf3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806bf6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  806bfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806bfd:	48 89 d6             	mov    %rdx,%rsi
+  806c00:	89 c7                	mov    %eax,%edi
+  806c02:	48 b8 4f 43 80 00 00 	movabs $0x80434f,%rax
+  806c09:	00 00 00 
+  806c0c:	ff d0                	call   *%rax
+  806c0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806c11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806c15:	79 05                	jns    806c1c <pipeisclosed+0x31>
+    return r;
+  806c17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806c1a:	eb 31                	jmp    806c4d <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  806c1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c20:	48 89 c7             	mov    %rax,%rdi
+  806c23:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  806c2a:	00 00 00 
+  806c2d:	ff d0                	call   *%rax
+  806c2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  806c33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c37:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806c3b:	48 89 d6             	mov    %rdx,%rsi
+  806c3e:	48 89 c7             	mov    %rax,%rdi
+  806c41:	48 b8 c6 6a 80 00 00 	movabs $0x806ac6,%rax
+  806c48:	00 00 00 
+  806c4b:	ff d0                	call   *%rax
+}
+  806c4d:	c9                   	leave
+  806c4e:	c3                   	ret
+
+0000000000806c4f <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  806c4f:	55                   	push   %rbp
+  806c50:	48 89 e5             	mov    %rsp,%rbp
+  806c53:	48 83 ec 10          	sub    $0x10,%rsp
+  806c57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  806c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806c5f:	8b 40 18             	mov    0x18(%rax),%eax
+  806c62:	8d 50 01             	lea    0x1(%rax),%edx
+  806c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806c69:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  806c6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806c70:	8b 40 1c             	mov    0x1c(%rax),%eax
+  806c73:	85 c0                	test   %eax,%eax
+  806c75:	74 27                	je     806c9e <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  806c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806c7b:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  806c82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806c86:	48 83 c0 18          	add    $0x18,%rax
+  806c8a:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  806c8f:	48 89 c7             	mov    %rax,%rdi
+  806c92:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  806c99:	00 00 00 
+  806c9c:	ff d0                	call   *%rax
+  }
+}
+  806c9e:	90                   	nop
+  806c9f:	c9                   	leave
+  806ca0:	c3                   	ret
+
+0000000000806ca1 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  806ca1:	55                   	push   %rbp
+  806ca2:	48 89 e5             	mov    %rsp,%rbp
+  806ca5:	48 83 ec 10          	sub    $0x10,%rsp
+  806ca9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806cad:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  806cb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806cb4:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  806cbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806cbf:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  806cc3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806cc6:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806ccd:	89 c6                	mov    %eax,%esi
+  806ccf:	48 89 cf             	mov    %rcx,%rdi
+  806cd2:	48 b8 22 34 80 00 00 	movabs $0x803422,%rax
+  806cd9:	00 00 00 
+  806cdc:	ff d0                	call   *%rax
+}
+  806cde:	90                   	nop
+  806cdf:	c9                   	leave
+  806ce0:	c3                   	ret
+
+0000000000806ce1 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  806ce1:	55                   	push   %rbp
+  806ce2:	48 89 e5             	mov    %rsp,%rbp
+  806ce5:	48 83 ec 70          	sub    $0x70,%rsp
+  806ce9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  806ced:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  806cf1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  806cf5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806cf9:	48 89 c7             	mov    %rax,%rdi
+  806cfc:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  806d03:	00 00 00 
+  806d06:	ff d0                	call   *%rax
+  806d08:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  806d0c:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  806d11:	75 0a                	jne    806d1d <devpipe_read+0x3c>
+    return 0;
+  806d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d18:	e9 63 01 00 00       	jmp    806e80 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  806d1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d21:	8b 40 18             	mov    0x18(%rax),%eax
+  806d24:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  806d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d2b:	48 8b 10             	mov    (%rax),%rdx
+  806d2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806d36:	48 39 c2             	cmp    %rax,%rdx
+  806d39:	75 42                	jne    806d7d <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  806d3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806d3f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806d43:	48 89 d6             	mov    %rdx,%rsi
+  806d46:	48 89 c7             	mov    %rax,%rdi
+  806d49:	48 b8 c6 6a 80 00 00 	movabs $0x806ac6,%rax
+  806d50:	00 00 00 
+  806d53:	ff d0                	call   *%rax
+  806d55:	85 c0                	test   %eax,%eax
+  806d57:	74 0a                	je     806d63 <devpipe_read+0x82>
+      return 0;
+  806d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d5e:	e9 1d 01 00 00       	jmp    806e80 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  806d63:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806d66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d6a:	89 d6                	mov    %edx,%esi
+  806d6c:	48 89 c7             	mov    %rax,%rdi
+  806d6f:	48 b8 a1 6c 80 00 00 	movabs $0x806ca1,%rax
+  806d76:	00 00 00 
+  806d79:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  806d7b:	eb a0                	jmp    806d1d <devpipe_read+0x3c>
+      break;
+  806d7d:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  806d7e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  806d82:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  806d86:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806d8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806d8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d92:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  806d96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d9a:	48 8b 00             	mov    (%rax),%rax
+  806d9d:	48 29 c2             	sub    %rax,%rdx
+  806da0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  806da4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806da8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806dac:	48 39 c2             	cmp    %rax,%rdx
+  806daf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806db3:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  806db7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806dbb:	48 8b 00             	mov    (%rax),%rax
+  806dbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806dc2:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  806dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  806dcb:	48 f7 f1             	div    %rcx
+  806dce:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  806dd2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806dd6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  806dda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806dde:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806de2:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  806de6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806dea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806dee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806df2:	48 39 c2             	cmp    %rax,%rdx
+  806df5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806df9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  806dfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806e01:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  806e05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806e09:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806e0d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e15:	48 89 ce             	mov    %rcx,%rsi
+  806e18:	48 89 c7             	mov    %rax,%rdi
+  806e1b:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  806e22:	00 00 00 
+  806e25:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  806e27:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806e2b:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  806e2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806e33:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  806e37:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806e3b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806e3f:	48 01 d1             	add    %rdx,%rcx
+  806e42:	48 89 c2             	mov    %rax,%rdx
+  806e45:	48 89 cf             	mov    %rcx,%rdi
+  806e48:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  806e4f:	00 00 00 
+  806e52:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  806e54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806e58:	48 8b 10             	mov    (%rax),%rdx
+  806e5b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806e5f:	48 01 c2             	add    %rax,%rdx
+  806e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806e66:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  806e69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806e6d:	48 89 c7             	mov    %rax,%rdi
+  806e70:	48 b8 4f 6c 80 00 00 	movabs $0x806c4f,%rax
+  806e77:	00 00 00 
+  806e7a:	ff d0                	call   *%rax
+  return n;
+  806e7c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  806e80:	c9                   	leave
+  806e81:	c3                   	ret
+
+0000000000806e82 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  806e82:	55                   	push   %rbp
+  806e83:	48 89 e5             	mov    %rsp,%rbp
+  806e86:	48 83 ec 70          	sub    $0x70,%rsp
+  806e8a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  806e8e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  806e92:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  806e96:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806e9a:	48 89 c7             	mov    %rax,%rdi
+  806e9d:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  806ea4:	00 00 00 
+  806ea7:	ff d0                	call   *%rax
+  806ea9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  806ead:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  806eb1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  806eb5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806ebc:	00 
+  806ebd:	e9 b8 01 00 00       	jmp    80707a <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  806ec2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ec6:	8b 40 18             	mov    0x18(%rax),%eax
+  806ec9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  806ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ed0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  806ed4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ed8:	48 8b 00             	mov    (%rax),%rax
+  806edb:	48 29 c2             	sub    %rax,%rdx
+  806ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ee2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806ee6:	48 39 c2             	cmp    %rax,%rdx
+  806ee9:	75 4d                	jne    806f38 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  806eeb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806eef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806ef3:	48 89 d6             	mov    %rdx,%rsi
+  806ef6:	48 89 c7             	mov    %rax,%rdi
+  806ef9:	48 b8 c6 6a 80 00 00 	movabs $0x806ac6,%rax
+  806f00:	00 00 00 
+  806f03:	ff d0                	call   *%rax
+  806f05:	85 c0                	test   %eax,%eax
+  806f07:	74 0a                	je     806f13 <devpipe_write+0x91>
+        return 0;
+  806f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f0e:	e9 79 01 00 00       	jmp    80708c <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  806f13:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806f16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f1a:	89 d6                	mov    %edx,%esi
+  806f1c:	48 89 c7             	mov    %rax,%rdi
+  806f1f:	48 b8 a1 6c 80 00 00 	movabs $0x806ca1,%rax
+  806f26:	00 00 00 
+  806f29:	ff d0                	call   *%rax
+      m = 0;
+  806f2b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  806f32:	00 
+      continue;
+  806f33:	e9 3a 01 00 00       	jmp    807072 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  806f38:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806f3c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  806f40:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806f44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f48:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  806f4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f50:	48 8b 08             	mov    (%rax),%rcx
+  806f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f57:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806f5b:	48 29 c1             	sub    %rax,%rcx
+  806f5e:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  806f62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  806f66:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806f6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806f6e:	48 39 c2             	cmp    %rax,%rdx
+  806f71:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806f75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  806f79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f7d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806f81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f85:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  806f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  806f8e:	48 f7 f1             	div    %rcx
+  806f91:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  806f95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806f99:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  806f9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fa1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806fa5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  806fa9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  806fad:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806fb1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806fb5:	48 39 c2             	cmp    %rax,%rdx
+  806fb8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806fbc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  806fc0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806fc4:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  806fc8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806fcc:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  806fd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806fd4:	48 01 d1             	add    %rdx,%rcx
+  806fd7:	48 89 c2             	mov    %rax,%rdx
+  806fda:	48 89 cf             	mov    %rcx,%rdi
+  806fdd:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  806fe4:	00 00 00 
+  806fe7:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  806fe9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806ff1:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  806ff5:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  806ff9:	73 4d                	jae    807048 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  806ffb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fff:	48 8b 40 10          	mov    0x10(%rax),%rax
+  807003:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807007:	48 29 c2             	sub    %rax,%rdx
+  80700a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80700e:	48 01 c2             	add    %rax,%rdx
+  807011:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807015:	48 8b 40 10          	mov    0x10(%rax),%rax
+  807019:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80701d:	48 89 c1             	mov    %rax,%rcx
+  807020:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807024:	48 01 c1             	add    %rax,%rcx
+  807027:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80702b:	48 01 c1             	add    %rax,%rcx
+  80702e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807032:	48 83 c0 20          	add    $0x20,%rax
+  807036:	48 89 ce             	mov    %rcx,%rsi
+  807039:	48 89 c7             	mov    %rax,%rdi
+  80703c:	48 b8 71 27 80 00 00 	movabs $0x802771,%rax
+  807043:	00 00 00 
+  807046:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  807048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80704c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  807050:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807054:	48 01 c2             	add    %rax,%rdx
+  807057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80705b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80705f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807063:	48 89 c7             	mov    %rax,%rdi
+  807066:	48 b8 4f 6c 80 00 00 	movabs $0x806c4f,%rax
+  80706d:	00 00 00 
+  807070:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  807072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807076:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80707a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80707e:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  807082:	0f 82 3a fe ff ff    	jb     806ec2 <devpipe_write+0x40>
+  }
+
+  return i;
+  807088:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80708c:	c9                   	leave
+  80708d:	c3                   	ret
+
+000000000080708e <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80708e:	55                   	push   %rbp
+  80708f:	48 89 e5             	mov    %rsp,%rbp
+  807092:	48 83 ec 40          	sub    $0x40,%rsp
+  807096:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80709a:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80709d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8070a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8070a5:	48 89 c7             	mov    %rax,%rdi
+  8070a8:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  8070af:	00 00 00 
+  8070b2:	ff d0                	call   *%rax
+  8070b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8070b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8070bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8070c3:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8070c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8070cb:	48 89 d6             	mov    %rdx,%rsi
+  8070ce:	48 89 c7             	mov    %rax,%rdi
+  8070d1:	48 b8 15 4d 80 00 00 	movabs $0x804d15,%rax
+  8070d8:	00 00 00 
+  8070db:	ff d0                	call   *%rax
+  8070dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8070e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8070e4:	79 08                	jns    8070ee <devpipe_poll+0x60>
+    return r;
+  8070e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8070e9:	e9 85 00 00 00       	jmp    807173 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8070ee:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8070f1:	83 e0 01             	and    $0x1,%eax
+  8070f4:	85 c0                	test   %eax,%eax
+  8070f6:	74 18                	je     807110 <devpipe_poll+0x82>
+  8070f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8070fc:	48 8b 10             	mov    (%rax),%rdx
+  8070ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807103:	48 8b 40 08          	mov    0x8(%rax),%rax
+  807107:	48 39 c2             	cmp    %rax,%rdx
+  80710a:	74 04                	je     807110 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80710c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  807110:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  807113:	83 e0 02             	and    $0x2,%eax
+  807116:	85 c0                	test   %eax,%eax
+  807118:	74 23                	je     80713d <devpipe_poll+0xaf>
+  80711a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80711e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  807122:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807126:	48 8b 00             	mov    (%rax),%rax
+  807129:	48 29 c2             	sub    %rax,%rdx
+  80712c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807130:	48 8b 40 10          	mov    0x10(%rax),%rax
+  807134:	48 39 c2             	cmp    %rax,%rdx
+  807137:	73 04                	jae    80713d <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  807139:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80713d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  807141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807145:	48 89 d6             	mov    %rdx,%rsi
+  807148:	48 89 c7             	mov    %rax,%rdi
+  80714b:	48 b8 c6 6a 80 00 00 	movabs $0x806ac6,%rax
+  807152:	00 00 00 
+  807155:	ff d0                	call   *%rax
+  807157:	85 c0                	test   %eax,%eax
+  807159:	74 04                	je     80715f <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80715b:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80715f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807163:	75 0b                	jne    807170 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  807165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807169:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  807170:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  807173:	c9                   	leave
+  807174:	c3                   	ret
+
+0000000000807175 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  807175:	55                   	push   %rbp
+  807176:	48 89 e5             	mov    %rsp,%rbp
+  807179:	48 83 ec 20          	sub    $0x20,%rsp
+  80717d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807181:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  807185:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807189:	48 89 c7             	mov    %rax,%rdi
+  80718c:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  807193:	00 00 00 
+  807196:	ff d0                	call   *%rax
+  807198:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80719c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8071a0:	48 ba a9 8c 80 00 00 	movabs $0x808ca9,%rdx
+  8071a7:	00 00 00 
+  8071aa:	48 89 d6             	mov    %rdx,%rsi
+  8071ad:	48 89 c7             	mov    %rax,%rdi
+  8071b0:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8071b7:	00 00 00 
+  8071ba:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8071bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8071c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8071c4:	89 c1                	mov    %eax,%ecx
+  8071c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8071ca:	48 8b 00             	mov    (%rax),%rax
+  8071cd:	89 c2                	mov    %eax,%edx
+  8071cf:	89 c8                	mov    %ecx,%eax
+  8071d1:	29 d0                	sub    %edx,%eax
+  8071d3:	89 c2                	mov    %eax,%edx
+  8071d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8071d9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8071df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8071e3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8071ea:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8071ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8071f1:	48 b9 c0 90 80 00 00 	movabs $0x8090c0,%rcx
+  8071f8:	00 00 00 
+  8071fb:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  807202:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807207:	c9                   	leave
+  807208:	c3                   	ret
+
+0000000000807209 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  807209:	55                   	push   %rbp
+  80720a:	48 89 e5             	mov    %rsp,%rbp
+  80720d:	48 83 ec 40          	sub    $0x40,%rsp
+  807211:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  807215:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807219:	48 89 c7             	mov    %rax,%rdi
+  80721c:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  807223:	00 00 00 
+  807226:	ff d0                	call   *%rax
+  807228:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80722c:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  807233:	00 
+  807234:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807238:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80723c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807240:	48 01 d0             	add    %rdx,%rax
+  807243:	48 83 c0 1f          	add    $0x1f,%rax
+  807247:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80724b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80724f:	ba 00 00 00 00       	mov    $0x0,%edx
+  807254:	48 f7 75 e8          	divq   -0x18(%rbp)
+  807258:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80725c:	48 29 d0             	sub    %rdx,%rax
+  80725f:	48 c1 e8 0c          	shr    $0xc,%rax
+  807263:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  807267:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80726b:	48 89 c6             	mov    %rax,%rsi
+  80726e:	bf 00 00 00 00       	mov    $0x0,%edi
+  807273:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80727a:	00 00 00 
+  80727d:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80727f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807283:	48 89 c7             	mov    %rax,%rdi
+  807286:	48 b8 4f 6c 80 00 00 	movabs $0x806c4f,%rax
+  80728d:	00 00 00 
+  807290:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  807292:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807296:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80729a:	eb 2f                	jmp    8072cb <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80729c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8072a0:	48 83 e8 01          	sub    $0x1,%rax
+  8072a4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8072a8:	48 89 c2             	mov    %rax,%rdx
+  8072ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8072af:	48 01 d0             	add    %rdx,%rax
+  8072b2:	48 89 c6             	mov    %rax,%rsi
+  8072b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8072ba:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  8072c1:	00 00 00 
+  8072c4:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8072c6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8072cb:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8072d0:	77 ca                	ja     80729c <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8072d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8072d6:	48 89 c6             	mov    %rax,%rsi
+  8072d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8072de:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  8072e5:	00 00 00 
+  8072e8:	ff d0                	call   *%rax
+}
+  8072ea:	c9                   	leave
+  8072eb:	c3                   	ret
+
+00000000008072ec <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  8072ec:	55                   	push   %rbp
+  8072ed:	48 89 e5             	mov    %rsp,%rbp
+  8072f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8072f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  8072f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8072fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8072ff:	89 c7                	mov    %eax,%edi
+  807301:	48 b8 10 73 80 00 00 	movabs $0x807310,%rax
+  807308:	00 00 00 
+  80730b:	ff d0                	call   *%rax
+}
+  80730d:	90                   	nop
+  80730e:	c9                   	leave
+  80730f:	c3                   	ret
+
+0000000000807310 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  807310:	55                   	push   %rbp
+  807311:	48 89 e5             	mov    %rsp,%rbp
+  807314:	48 83 ec 10          	sub    $0x10,%rsp
+  807318:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80731b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80731f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807323:	75 3e                	jne    807363 <waitpid+0x53>
+  807325:	48 b8 b0 8c 80 00 00 	movabs $0x808cb0,%rax
+  80732c:	00 00 00 
+  80732f:	48 89 c1             	mov    %rax,%rcx
+  807332:	48 b8 bb 8c 80 00 00 	movabs $0x808cbb,%rax
+  807339:	00 00 00 
+  80733c:	48 89 c2             	mov    %rax,%rdx
+  80733f:	be 0e 00 00 00       	mov    $0xe,%esi
+  807344:	48 b8 d0 8c 80 00 00 	movabs $0x808cd0,%rax
+  80734b:	00 00 00 
+  80734e:	48 89 c7             	mov    %rax,%rdi
+  807351:	b8 00 00 00 00       	mov    $0x0,%eax
+  807356:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  80735d:	00 00 00 
+  807360:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  807363:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  807368:	74 0a                	je     807374 <waitpid+0x64>
+    *status = 0;
+  80736a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80736e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  807374:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  807378:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80737b:	48 89 d6             	mov    %rdx,%rsi
+  80737e:	89 c7                	mov    %eax,%edi
+  807380:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  807387:	00 00 00 
+  80738a:	ff d0                	call   *%rax
+}
+  80738c:	c9                   	leave
+  80738d:	c3                   	ret
+
+000000000080738e <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  80738e:	55                   	push   %rbp
+  80738f:	48 89 e5             	mov    %rsp,%rbp
+  807392:	48 83 ec 10          	sub    $0x10,%rsp
+  807396:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80739a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  80739e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8073a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8073a6:	48 89 c7             	mov    %rax,%rdi
+  8073a9:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8073ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8073b0:	48 b8 f2 75 80 00 00 	movabs $0x8075f2,%rax
+  8073b7:	00 00 00 
+  8073ba:	ff d0                	call   *%rax
+}
+  8073bc:	90                   	nop
+  8073bd:	c9                   	leave
+  8073be:	c3                   	ret
+
+00000000008073bf <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8073bf:	55                   	push   %rbp
+  8073c0:	48 89 e5             	mov    %rsp,%rbp
+  8073c3:	48 83 ec 20          	sub    $0x20,%rsp
+  8073c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8073ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8073cd:	c1 e0 10             	shl    $0x10,%eax
+  8073d0:	48 98                	cltq
+  8073d2:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8073d7:	48 01 d0             	add    %rdx,%rax
+  8073da:	48 89 c6             	mov    %rax,%rsi
+  8073dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8073e2:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  8073e9:	00 00 00 
+  8073ec:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8073ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8073f1:	83 c0 01             	add    $0x1,%eax
+  8073f4:	c1 e0 10             	shl    $0x10,%eax
+  8073f7:	48 98                	cltq
+  8073f9:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8073fe:	48 01 d0             	add    %rdx,%rax
+  807401:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  807405:	eb 20                	jmp    807427 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  807407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80740b:	48 89 c6             	mov    %rax,%rsi
+  80740e:	bf 00 00 00 00       	mov    $0x0,%edi
+  807413:	48 b8 2e 31 80 00 00 	movabs $0x80312e,%rax
+  80741a:	00 00 00 
+  80741d:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80741f:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  807426:	00 
+  807427:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80742a:	83 c0 01             	add    $0x1,%eax
+  80742d:	c1 e0 10             	shl    $0x10,%eax
+  807430:	48 98                	cltq
+  807432:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  807437:	48 01 d0             	add    %rdx,%rax
+  80743a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80743e:	72 c7                	jb     807407 <slot_unmap+0x48>
+}
+  807440:	90                   	nop
+  807441:	90                   	nop
+  807442:	c9                   	leave
+  807443:	c3                   	ret
+
+0000000000807444 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  807444:	55                   	push   %rbp
+  807445:	48 89 e5             	mov    %rsp,%rbp
+  807448:	48 83 ec 30          	sub    $0x30,%rsp
+  80744c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807450:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  807454:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  80745b:	00 00 00 
+  80745e:	48 89 c7             	mov    %rax,%rdi
+  807461:	48 b8 03 7e 80 00 00 	movabs $0x807e03,%rax
+  807468:	00 00 00 
+  80746b:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  80746d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  807474:	eb 04                	jmp    80747a <thread_create+0x36>
+  807476:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80747a:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  80747e:	7f 16                	jg     807496 <thread_create+0x52>
+  807480:	48 ba 40 c0 80 00 00 	movabs $0x80c040,%rdx
+  807487:	00 00 00 
+  80748a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80748d:	48 98                	cltq
+  80748f:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  807492:	85 c0                	test   %eax,%eax
+  807494:	75 e0                	jne    807476 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  807496:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  80749a:	75 0c                	jne    8074a8 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  80749c:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8074a3:	e9 2c 01 00 00       	jmp    8075d4 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8074a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8074ab:	c1 e0 10             	shl    $0x10,%eax
+  8074ae:	48 98                	cltq
+  8074b0:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8074b5:	48 01 d0             	add    %rdx,%rax
+  8074b8:	ba 07 00 00 00       	mov    $0x7,%edx
+  8074bd:	48 89 c6             	mov    %rax,%rsi
+  8074c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8074c5:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  8074cc:	00 00 00 
+  8074cf:	ff d0                	call   *%rax
+  8074d1:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8074d4:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8074d8:	0f 88 f5 00 00 00    	js     8075d3 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8074de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8074e1:	83 c0 01             	add    $0x1,%eax
+  8074e4:	c1 e0 10             	shl    $0x10,%eax
+  8074e7:	48 98                	cltq
+  8074e9:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8074ee:	48 01 d0             	add    %rdx,%rax
+  8074f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8074f5:	eb 32                	jmp    807529 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  8074f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8074fb:	ba 07 00 00 00       	mov    $0x7,%edx
+  807500:	48 89 c6             	mov    %rax,%rsi
+  807503:	bf 00 00 00 00       	mov    $0x0,%edi
+  807508:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  80750f:	00 00 00 
+  807512:	ff d0                	call   *%rax
+  807514:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  807517:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80751b:	0f 88 9e 00 00 00    	js     8075bf <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  807521:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  807528:	00 
+  807529:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80752c:	83 c0 01             	add    $0x1,%eax
+  80752f:	c1 e0 10             	shl    $0x10,%eax
+  807532:	48 98                	cltq
+  807534:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  807539:	48 01 d0             	add    %rdx,%rax
+  80753c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  807540:	72 b5                	jb     8074f7 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  807542:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  807546:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80754a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80754d:	c1 e2 10             	shl    $0x10,%edx
+  807550:	48 63 d2             	movslq %edx,%rdx
+  807553:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  807558:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80755b:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80755e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807561:	83 c2 01             	add    $0x1,%edx
+  807564:	c1 e2 10             	shl    $0x10,%edx
+  807567:	48 63 d2             	movslq %edx,%rdx
+  80756a:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  80756f:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  807572:	48 bf 8e 73 80 00 00 	movabs $0x80738e,%rdi
+  807579:	00 00 00 
+  80757c:	49 89 c8             	mov    %rcx,%r8
+  80757f:	48 89 c1             	mov    %rax,%rcx
+  807582:	4c 89 ca             	mov    %r9,%rdx
+  807585:	48 b8 16 35 80 00 00 	movabs $0x803516,%rax
+  80758c:	00 00 00 
+  80758f:	ff d0                	call   *%rax
+  807591:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  807594:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807598:	79 08                	jns    8075a2 <thread_create+0x15e>
+    r = id;
+  80759a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80759d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8075a0:	eb 1e                	jmp    8075c0 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8075a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8075a5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8075a8:	48 b9 40 c0 80 00 00 	movabs $0x80c040,%rcx
+  8075af:	00 00 00 
+  8075b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8075b5:	48 98                	cltq
+  8075b7:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8075ba:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8075bd:	eb 15                	jmp    8075d4 <thread_create+0x190>
+      goto fail;
+  8075bf:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8075c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8075c3:	89 c7                	mov    %eax,%edi
+  8075c5:	48 b8 bf 73 80 00 00 	movabs $0x8073bf,%rax
+  8075cc:	00 00 00 
+  8075cf:	ff d0                	call   *%rax
+  8075d1:	eb 01                	jmp    8075d4 <thread_create+0x190>
+    goto out;
+  8075d3:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8075d4:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  8075db:	00 00 00 
+  8075de:	48 89 c7             	mov    %rax,%rdi
+  8075e1:	48 b8 d8 7e 80 00 00 	movabs $0x807ed8,%rax
+  8075e8:	00 00 00 
+  8075eb:	ff d0                	call   *%rax
+  return r;
+  8075ed:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8075f0:	c9                   	leave
+  8075f1:	c3                   	ret
+
+00000000008075f2 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  8075f2:	55                   	push   %rbp
+  8075f3:	48 89 e5             	mov    %rsp,%rbp
+  8075f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8075fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  8075fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807600:	89 c7                	mov    %eax,%edi
+  807602:	48 b8 73 35 80 00 00 	movabs $0x803573,%rax
+  807609:	00 00 00 
+  80760c:	ff d0                	call   *%rax
+}
+  80760e:	90                   	nop
+  80760f:	c9                   	leave
+  807610:	c3                   	ret
+
+0000000000807611 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  807611:	55                   	push   %rbp
+  807612:	48 89 e5             	mov    %rsp,%rbp
+  807615:	48 83 ec 20          	sub    $0x20,%rsp
+  807619:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80761c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  807620:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  807627:	00 00 00 
+  80762a:	48 89 c7             	mov    %rax,%rdi
+  80762d:	48 b8 03 7e 80 00 00 	movabs $0x807e03,%rax
+  807634:	00 00 00 
+  807637:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  807639:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  807640:	eb 04                	jmp    807646 <thread_join+0x35>
+  807642:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807646:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80764a:	7f 17                	jg     807663 <thread_join+0x52>
+  80764c:	48 ba 40 c0 80 00 00 	movabs $0x80c040,%rdx
+  807653:	00 00 00 
+  807656:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807659:	48 98                	cltq
+  80765b:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80765e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  807661:	75 df                	jne    807642 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  807663:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  80766a:	00 00 00 
+  80766d:	48 89 c7             	mov    %rax,%rdi
+  807670:	48 b8 d8 7e 80 00 00 	movabs $0x807ed8,%rax
+  807677:	00 00 00 
+  80767a:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80767c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807680:	74 06                	je     807688 <thread_join+0x77>
+  807682:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  807686:	75 07                	jne    80768f <thread_join+0x7e>
+    return -E_BAD_ENV;
+  807688:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80768d:	eb 76                	jmp    807705 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  80768f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807693:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807696:	48 89 d6             	mov    %rdx,%rsi
+  807699:	89 c7                	mov    %eax,%edi
+  80769b:	48 b8 10 73 80 00 00 	movabs $0x807310,%rax
+  8076a2:	00 00 00 
+  8076a5:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8076a7:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  8076ae:	00 00 00 
+  8076b1:	48 89 c7             	mov    %rax,%rdi
+  8076b4:	48 b8 03 7e 80 00 00 	movabs $0x807e03,%rax
+  8076bb:	00 00 00 
+  8076be:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8076c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8076c3:	89 c7                	mov    %eax,%edi
+  8076c5:	48 b8 bf 73 80 00 00 	movabs $0x8073bf,%rax
+  8076cc:	00 00 00 
+  8076cf:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8076d1:	48 ba 40 c0 80 00 00 	movabs $0x80c040,%rdx
+  8076d8:	00 00 00 
+  8076db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8076de:	48 98                	cltq
+  8076e0:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  8076e7:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  8076ee:	00 00 00 
+  8076f1:	48 89 c7             	mov    %rax,%rdi
+  8076f4:	48 b8 d8 7e 80 00 00 	movabs $0x807ed8,%rax
+  8076fb:	00 00 00 
+  8076fe:	ff d0                	call   *%rax
+  return 0;
+  807700:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807705:	c9                   	leave
+  807706:	c3                   	ret
+
+0000000000807707 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  807707:	55                   	push   %rbp
+  807708:	48 89 e5             	mov    %rsp,%rbp
+  80770b:	48 83 ec 08          	sub    $0x8,%rsp
+  80770f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  807713:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  807718:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80771c:	73 23                	jae    807741 <thread_is_uxstack+0x3a>
+  80771e:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  807723:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  807727:	72 18                	jb     807741 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  807729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80772d:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  807732:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  807738:	75 07                	jne    807741 <thread_is_uxstack+0x3a>
+  80773a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80773f:	eb 05                	jmp    807746 <thread_is_uxstack+0x3f>
+  807741:	b8 00 00 00 00       	mov    $0x0,%eax
+  807746:	83 e0 01             	and    $0x1,%eax
+}
+  807749:	c9                   	leave
+  80774a:	c3                   	ret
+
+000000000080774b <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80774b:	55                   	push   %rbp
+  80774c:	48 89 e5             	mov    %rsp,%rbp
+  80774f:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  807753:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80775a:	00 00 00 
+  80775d:	8b 40 04             	mov    0x4(%rax),%eax
+  807760:	25 ff 03 00 00       	and    $0x3ff,%eax
+  807765:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80776c:	00 00 00 
+  80776f:	48 98                	cltq
+  807771:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807778:	48 01 d0             	add    %rdx,%rax
+  80777b:	48 05 08 01 00 00    	add    $0x108,%rax
+  807781:	48 8b 00             	mov    (%rax),%rax
+  807784:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  807788:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80778d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  807791:	73 0b                	jae    80779e <thread_pftemp+0x53>
+  807793:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  807798:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80779c:	73 07                	jae    8077a5 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  80779e:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8077a3:	eb 26                	jmp    8077cb <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8077a5:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8077ac:	ff ff ff 
+  8077af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8077b3:	48 01 d0             	add    %rdx,%rax
+  8077b6:	48 c1 e8 10          	shr    $0x10,%rax
+  8077ba:	48 83 c0 01          	add    $0x1,%rax
+  8077be:	48 c1 e0 0c          	shl    $0xc,%rax
+  8077c2:	48 f7 d8             	neg    %rax
+  8077c5:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  8077cb:	c9                   	leave
+  8077cc:	c3                   	ret
+
+00000000008077cd <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8077cd:	55                   	push   %rbp
+  8077ce:	48 89 e5             	mov    %rsp,%rbp
+  8077d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8077d5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8077d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8077dc:	75 10                	jne    8077ee <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8077de:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8077e5:	00 00 00 
+  8077e8:	8b 00                	mov    (%rax),%eax
+  8077ea:	48 98                	cltq
+  8077ec:	eb 05                	jmp    8077f3 <vsyscall+0x26>
+  }
+  return 0;
+  8077ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8077f3:	c9                   	leave
+  8077f4:	c3                   	ret
+
+00000000008077f5 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8077f5:	55                   	push   %rbp
+  8077f6:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8077f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8077fe:	48 b8 cd 77 80 00 00 	movabs $0x8077cd,%rax
+  807805:	00 00 00 
+  807808:	ff d0                	call   *%rax
+}
+  80780a:	5d                   	pop    %rbp
+  80780b:	c3                   	ret
+
+000000000080780c <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80780c:	55                   	push   %rbp
+  80780d:	48 89 e5             	mov    %rsp,%rbp
+  807810:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  807814:	0f 31                	rdtsc
+  807816:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807819:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80781c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80781f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  807822:	48 c1 e2 20          	shl    $0x20,%rdx
+  807826:	48 09 d0             	or     %rdx,%rax
+  807829:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80782d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  807831:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  807835:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80783c:	00 00 00 
+  80783f:	8b 40 08             	mov    0x8(%rax),%eax
+  807842:	48 98                	cltq
+  807844:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  807848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80784c:	ba 00 00 00 00       	mov    $0x0,%edx
+  807851:	48 f7 75 f0          	divq   -0x10(%rbp)
+  807855:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80785c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807860:	ba 00 00 00 00       	mov    $0x0,%edx
+  807865:	48 f7 75 f0          	divq   -0x10(%rbp)
+  807869:	48 89 d0             	mov    %rdx,%rax
+  80786c:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  807873:	ba 00 00 00 00       	mov    $0x0,%edx
+  807878:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80787c:	48 01 c8             	add    %rcx,%rax
+}
+  80787f:	c9                   	leave
+  807880:	c3                   	ret
+
+0000000000807881 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  807881:	55                   	push   %rbp
+  807882:	48 89 e5             	mov    %rsp,%rbp
+  807885:	48 83 ec 20          	sub    $0x20,%rsp
+  807889:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80788d:	48 b8 fd 2f 80 00 00 	movabs $0x802ffd,%rax
+  807894:	00 00 00 
+  807897:	ff d0                	call   *%rax
+  807899:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  80789c:	48 b8 40 c1 80 00 00 	movabs $0x80c140,%rax
+  8078a3:	00 00 00 
+  8078a6:	48 8b 00             	mov    (%rax),%rax
+  8078a9:	48 85 c0             	test   %rax,%rax
+  8078ac:	75 62                	jne    807910 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  8078ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8078b1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8078b6:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8078bd:	00 00 00 
+  8078c0:	48 89 ce             	mov    %rcx,%rsi
+  8078c3:	89 c7                	mov    %eax,%edi
+  8078c5:	48 b8 76 30 80 00 00 	movabs $0x803076,%rax
+  8078cc:	00 00 00 
+  8078cf:	ff d0                	call   *%rax
+  8078d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8078d4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8078d8:	79 36                	jns    807910 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8078da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8078dd:	89 c1                	mov    %eax,%ecx
+  8078df:	48 b8 db 8c 80 00 00 	movabs $0x808cdb,%rax
+  8078e6:	00 00 00 
+  8078e9:	48 89 c2             	mov    %rax,%rdx
+  8078ec:	be 23 00 00 00       	mov    $0x23,%esi
+  8078f1:	48 b8 f3 8c 80 00 00 	movabs $0x808cf3,%rax
+  8078f8:	00 00 00 
+  8078fb:	48 89 c7             	mov    %rax,%rdi
+  8078fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  807903:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  80790a:	00 00 00 
+  80790d:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  807910:	48 ba 40 c1 80 00 00 	movabs $0x80c140,%rdx
+  807917:	00 00 00 
+  80791a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80791e:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  807921:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807924:	48 ba 81 79 80 00 00 	movabs $0x807981,%rdx
+  80792b:	00 00 00 
+  80792e:	48 89 d6             	mov    %rdx,%rsi
+  807931:	89 c7                	mov    %eax,%edi
+  807933:	48 b8 13 32 80 00 00 	movabs $0x803213,%rax
+  80793a:	00 00 00 
+  80793d:	ff d0                	call   *%rax
+  80793f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  807942:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  807946:	79 36                	jns    80797e <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  807948:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80794b:	89 c1                	mov    %eax,%ecx
+  80794d:	48 b8 db 8c 80 00 00 	movabs $0x808cdb,%rax
+  807954:	00 00 00 
+  807957:	48 89 c2             	mov    %rax,%rdx
+  80795a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80795f:	48 b8 f3 8c 80 00 00 	movabs $0x808cf3,%rax
+  807966:	00 00 00 
+  807969:	48 89 c7             	mov    %rax,%rdi
+  80796c:	b8 00 00 00 00       	mov    $0x0,%eax
+  807971:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  807978:	00 00 00 
+  80797b:	41 ff d0             	call   *%r8
+}
+  80797e:	90                   	nop
+  80797f:	c9                   	leave
+  807980:	c3                   	ret
+
+0000000000807981 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  807981:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  807984:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  807987:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  80798e:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  807992:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  807997:	48 a1 40 c1 80 00 00 	movabs 0x80c140,%rax
+  80799e:	00 00 00 
+	call *%rax
+  8079a1:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8079a3:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8079a8:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8079ab:	41 5f                	pop    %r15
+	popq %r15
+  8079ad:	41 5f                	pop    %r15
+	popq %r15
+  8079af:	41 5f                	pop    %r15
+	popq %r14
+  8079b1:	41 5e                	pop    %r14
+	popq %r13
+  8079b3:	41 5d                	pop    %r13
+	popq %r12
+  8079b5:	41 5c                	pop    %r12
+	popq %r11
+  8079b7:	41 5b                	pop    %r11
+	popq %r10
+  8079b9:	41 5a                	pop    %r10
+	popq %r9
+  8079bb:	41 59                	pop    %r9
+	popq %r8
+  8079bd:	41 58                	pop    %r8
+	popq %rsi
+  8079bf:	5e                   	pop    %rsi
+	popq %rdi
+  8079c0:	5f                   	pop    %rdi
+	popq %rbp
+  8079c1:	5d                   	pop    %rbp
+	popq %rdx
+  8079c2:	5a                   	pop    %rdx
+	popq %rcx
+  8079c3:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8079c4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8079c9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8079ce:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8079d2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8079d5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8079da:	5b                   	pop    %rbx
+	popq %rax
+  8079db:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8079dc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8079e0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8079e1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8079e6:	c3                   	ret
+
+00000000008079e7 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8079e7:	55                   	push   %rbp
+  8079e8:	48 89 e5             	mov    %rsp,%rbp
+  8079eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8079ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8079f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8079f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8079fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8079ff:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  807a03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807a07:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  807a0e:	48 89 c7             	mov    %rax,%rdi
+  807a11:	48 b8 1f 7a 80 00 00 	movabs $0x807a1f,%rax
+  807a18:	00 00 00 
+  807a1b:	ff d0                	call   *%rax
+}
+  807a1d:	c9                   	leave
+  807a1e:	c3                   	ret
+
+0000000000807a1f <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  807a1f:	55                   	push   %rbp
+  807a20:	48 89 e5             	mov    %rsp,%rbp
+  807a23:	48 83 ec 30          	sub    $0x30,%rsp
+  807a27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807a2b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807a2f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  807a33:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  807a37:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  807a3c:	75 0e                	jne    807a4c <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  807a3e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  807a45:	00 00 00 
+  807a48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  807a4c:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  807a51:	75 18                	jne    807a6b <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  807a53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a57:	48 89 c7             	mov    %rax,%rdi
+  807a5a:	48 b8 b6 32 80 00 00 	movabs $0x8032b6,%rax
+  807a61:	00 00 00 
+  807a64:	ff d0                	call   *%rax
+  807a66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807a69:	eb 1d                	jmp    807a88 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  807a6b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807a6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a73:	48 89 d6             	mov    %rdx,%rsi
+  807a76:	48 89 c7             	mov    %rax,%rdi
+  807a79:	48 b8 fc 32 80 00 00 	movabs $0x8032fc,%rax
+  807a80:	00 00 00 
+  807a83:	ff d0                	call   *%rax
+  807a85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  807a88:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807a8c:	79 2a                	jns    807ab8 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  807a8e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  807a93:	74 0a                	je     807a9f <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  807a95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807a99:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  807a9f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  807aa4:	74 0a                	je     807ab0 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  807aa6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807aaa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  807ab0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807ab3:	e9 aa 00 00 00       	jmp    807b62 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  807ab8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  807abd:	74 36                	je     807af5 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  807abf:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  807ac6:	00 00 00 
+  807ac9:	8b 40 04             	mov    0x4(%rax),%eax
+  807acc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  807ad1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  807ad8:	00 00 00 
+  807adb:	48 98                	cltq
+  807add:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807ae4:	48 01 d0             	add    %rdx,%rax
+  807ae7:	48 05 24 01 00 00    	add    $0x124,%rax
+  807aed:	8b 10                	mov    (%rax),%edx
+  807aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807af3:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  807af5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  807afa:	74 36                	je     807b32 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  807afc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  807b03:	00 00 00 
+  807b06:	8b 40 04             	mov    0x4(%rax),%eax
+  807b09:	25 ff 03 00 00       	and    $0x3ff,%eax
+  807b0e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  807b15:	00 00 00 
+  807b18:	48 98                	cltq
+  807b1a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807b21:	48 01 d0             	add    %rdx,%rax
+  807b24:	48 05 28 01 00 00    	add    $0x128,%rax
+  807b2a:	8b 10                	mov    (%rax),%edx
+  807b2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807b30:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  807b32:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  807b39:	00 00 00 
+  807b3c:	8b 40 04             	mov    0x4(%rax),%eax
+  807b3f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  807b44:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  807b4b:	00 00 00 
+  807b4e:	48 98                	cltq
+  807b50:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807b57:	48 01 d0             	add    %rdx,%rax
+  807b5a:	48 05 20 01 00 00    	add    $0x120,%rax
+  807b60:	8b 00                	mov    (%rax),%eax
+  }
+}
+  807b62:	c9                   	leave
+  807b63:	c3                   	ret
+
+0000000000807b64 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  807b64:	55                   	push   %rbp
+  807b65:	48 89 e5             	mov    %rsp,%rbp
+  807b68:	48 83 ec 30          	sub    $0x30,%rsp
+  807b6c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  807b6f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  807b72:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  807b76:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  807b79:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  807b7e:	75 5e                	jne    807bde <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  807b80:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  807b87:	00 00 00 
+  807b8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  807b8e:	eb 4e                	jmp    807bde <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  807b90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807b94:	79 3c                	jns    807bd2 <ipc_send+0x6e>
+  807b96:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  807b9a:	74 36                	je     807bd2 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  807b9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807b9f:	89 c1                	mov    %eax,%ecx
+  807ba1:	48 b8 08 8d 80 00 00 	movabs $0x808d08,%rax
+  807ba8:	00 00 00 
+  807bab:	48 89 c2             	mov    %rax,%rdx
+  807bae:	be 54 00 00 00       	mov    $0x54,%esi
+  807bb3:	48 b8 2e 8d 80 00 00 	movabs $0x808d2e,%rax
+  807bba:	00 00 00 
+  807bbd:	48 89 c7             	mov    %rax,%rdi
+  807bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  807bc5:	49 b8 59 0e 80 00 00 	movabs $0x800e59,%r8
+  807bcc:	00 00 00 
+  807bcf:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  807bd2:	48 b8 39 30 80 00 00 	movabs $0x803039,%rax
+  807bd9:	00 00 00 
+  807bdc:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  807bde:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  807be1:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  807be4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807be8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807beb:	89 c7                	mov    %eax,%edi
+  807bed:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  807bf4:	00 00 00 
+  807bf7:	ff d0                	call   *%rax
+  807bf9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807bfc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807c00:	75 8e                	jne    807b90 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  807c02:	48 b8 39 30 80 00 00 	movabs $0x803039,%rax
+  807c09:	00 00 00 
+  807c0c:	ff d0                	call   *%rax
+}
+  807c0e:	90                   	nop
+  807c0f:	c9                   	leave
+  807c10:	c3                   	ret
+
+0000000000807c11 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  807c11:	55                   	push   %rbp
+  807c12:	48 89 e5             	mov    %rsp,%rbp
+  807c15:	48 83 ec 18          	sub    $0x18,%rsp
+  807c19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  807c1c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  807c23:	eb 4d                	jmp    807c72 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  807c25:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  807c2c:	00 00 00 
+  807c2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807c32:	48 98                	cltq
+  807c34:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807c3b:	48 01 d0             	add    %rdx,%rax
+  807c3e:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  807c44:	8b 00                	mov    (%rax),%eax
+  807c46:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  807c49:	75 23                	jne    807c6e <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  807c4b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  807c52:	00 00 00 
+  807c55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807c58:	48 98                	cltq
+  807c5a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  807c61:	48 01 d0             	add    %rdx,%rax
+  807c64:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807c6a:	8b 00                	mov    (%rax),%eax
+  807c6c:	eb 12                	jmp    807c80 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  807c6e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807c72:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  807c79:	7e aa                	jle    807c25 <ipc_find_env+0x14>
+  return 0;
+  807c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807c80:	c9                   	leave
+  807c81:	c3                   	ret
+
+0000000000807c82 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  807c82:	55                   	push   %rbp
+  807c83:	48 89 e5             	mov    %rsp,%rbp
+  807c86:	48 83 ec 18          	sub    $0x18,%rsp
+  807c8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  807c8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807c92:	48 c1 e8 27          	shr    $0x27,%rax
+  807c96:	25 ff 01 00 00       	and    $0x1ff,%eax
+  807c9b:	48 89 c2             	mov    %rax,%rdx
+  807c9e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  807ca5:	01 00 00 
+  807ca8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807cac:	83 e0 01             	and    $0x1,%eax
+  807caf:	48 85 c0             	test   %rax,%rax
+  807cb2:	74 63                	je     807d17 <pageref+0x95>
+  807cb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807cb8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  807cbc:	48 89 c2             	mov    %rax,%rdx
+  807cbf:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  807cc6:	01 00 00 
+  807cc9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807ccd:	83 e0 01             	and    $0x1,%eax
+  807cd0:	48 85 c0             	test   %rax,%rax
+  807cd3:	74 42                	je     807d17 <pageref+0x95>
+  807cd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807cd9:	48 c1 e8 15          	shr    $0x15,%rax
+  807cdd:	48 89 c2             	mov    %rax,%rdx
+  807ce0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  807ce7:	01 00 00 
+  807cea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807cee:	83 e0 01             	and    $0x1,%eax
+  807cf1:	48 85 c0             	test   %rax,%rax
+  807cf4:	74 21                	je     807d17 <pageref+0x95>
+  807cf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807cfa:	48 c1 e8 0c          	shr    $0xc,%rax
+  807cfe:	48 89 c2             	mov    %rax,%rdx
+  807d01:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  807d08:	01 00 00 
+  807d0b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807d0f:	83 e0 01             	and    $0x1,%eax
+  807d12:	48 85 c0             	test   %rax,%rax
+  807d15:	75 07                	jne    807d1e <pageref+0x9c>
+    return 0;
+  807d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d1c:	eb 53                	jmp    807d71 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  807d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807d22:	48 c1 e8 0c          	shr    $0xc,%rax
+  807d26:	48 89 c2             	mov    %rax,%rdx
+  807d29:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  807d30:	01 00 00 
+  807d33:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807d37:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  807d3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807d3f:	83 e0 01             	and    $0x1,%eax
+  807d42:	48 85 c0             	test   %rax,%rax
+  807d45:	75 07                	jne    807d4e <pageref+0xcc>
+    return 0;
+  807d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d4c:	eb 23                	jmp    807d71 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  807d4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807d52:	48 c1 e8 0c          	shr    $0xc,%rax
+  807d56:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  807d5d:	00 00 00 
+  807d60:	48 c1 e0 04          	shl    $0x4,%rax
+  807d64:	48 01 d0             	add    %rdx,%rax
+  807d67:	48 83 c0 08          	add    $0x8,%rax
+  807d6b:	0f b7 00             	movzwl (%rax),%eax
+  807d6e:	0f b7 c0             	movzwl %ax,%eax
+}
+  807d71:	c9                   	leave
+  807d72:	c3                   	ret
+
+0000000000807d73 <xchg>:
+  807d73:	55                   	push   %rbp
+  807d74:	48 89 e5             	mov    %rsp,%rbp
+  807d77:	48 83 ec 20          	sub    $0x20,%rsp
+  807d7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807d7f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  807d82:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807d86:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807d89:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  807d8d:	f0 87 02             	lock xchg %eax,(%rdx)
+  807d90:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807d93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807d96:	c9                   	leave
+  807d97:	c3                   	ret
+
+0000000000807d98 <cmpxchg>:
+  807d98:	55                   	push   %rbp
+  807d99:	48 89 e5             	mov    %rsp,%rbp
+  807d9c:	48 83 ec 20          	sub    $0x20,%rsp
+  807da0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807da4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  807da7:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  807daa:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  807dae:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  807db1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807db4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  807db8:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  807dbc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807dc2:	c9                   	leave
+  807dc3:	c3                   	ret
+
+0000000000807dc4 <xadd>:
+  807dc4:	55                   	push   %rbp
+  807dc5:	48 89 e5             	mov    %rsp,%rbp
+  807dc8:	48 83 ec 10          	sub    $0x10,%rsp
+  807dcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807dd0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  807dd3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  807dd7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  807dda:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807dde:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  807de2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  807de5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  807de8:	c9                   	leave
+  807de9:	c3                   	ret
+
+0000000000807dea <mutex_init>:
+mutex_init(struct Mutex *m) {
+  807dea:	55                   	push   %rbp
+  807deb:	48 89 e5             	mov    %rsp,%rbp
+  807dee:	48 83 ec 08          	sub    $0x8,%rsp
+  807df2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  807df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807dfa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  807e00:	90                   	nop
+  807e01:	c9                   	leave
+  807e02:	c3                   	ret
+
+0000000000807e03 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  807e03:	55                   	push   %rbp
+  807e04:	48 89 e5             	mov    %rsp,%rbp
+  807e07:	48 83 ec 20          	sub    $0x20,%rsp
+  807e0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  807e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807e13:	ba 01 00 00 00       	mov    $0x1,%edx
+  807e18:	be 00 00 00 00       	mov    $0x0,%esi
+  807e1d:	48 89 c7             	mov    %rax,%rdi
+  807e20:	48 b8 98 7d 80 00 00 	movabs $0x807d98,%rax
+  807e27:	00 00 00 
+  807e2a:	ff d0                	call   *%rax
+  807e2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807e2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807e33:	74 65                	je     807e9a <mutex_lock+0x97>
+  if (c != 2)
+  807e35:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  807e39:	74 57                	je     807e92 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  807e3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807e3f:	be 02 00 00 00       	mov    $0x2,%esi
+  807e44:	48 89 c7             	mov    %rax,%rdi
+  807e47:	48 b8 73 7d 80 00 00 	movabs $0x807d73,%rax
+  807e4e:	00 00 00 
+  807e51:	ff d0                	call   *%rax
+  807e53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  807e56:	eb 3a                	jmp    807e92 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  807e58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807e5c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  807e63:	be 02 00 00 00       	mov    $0x2,%esi
+  807e68:	48 89 c7             	mov    %rax,%rdi
+  807e6b:	48 b8 22 34 80 00 00 	movabs $0x803422,%rax
+  807e72:	00 00 00 
+  807e75:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  807e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807e7b:	be 02 00 00 00       	mov    $0x2,%esi
+  807e80:	48 89 c7             	mov    %rax,%rdi
+  807e83:	48 b8 73 7d 80 00 00 	movabs $0x807d73,%rax
+  807e8a:	00 00 00 
+  807e8d:	ff d0                	call   *%rax
+  807e8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  807e92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807e96:	75 c0                	jne    807e58 <mutex_lock+0x55>
+  807e98:	eb 01                	jmp    807e9b <mutex_lock+0x98>
+    return;
+  807e9a:	90                   	nop
+}
+  807e9b:	c9                   	leave
+  807e9c:	c3                   	ret
+
+0000000000807e9d <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  807e9d:	55                   	push   %rbp
+  807e9e:	48 89 e5             	mov    %rsp,%rbp
+  807ea1:	48 83 ec 08          	sub    $0x8,%rsp
+  807ea5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  807ea9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807ead:	ba 01 00 00 00       	mov    $0x1,%edx
+  807eb2:	be 00 00 00 00       	mov    $0x0,%esi
+  807eb7:	48 89 c7             	mov    %rax,%rdi
+  807eba:	48 b8 98 7d 80 00 00 	movabs $0x807d98,%rax
+  807ec1:	00 00 00 
+  807ec4:	ff d0                	call   *%rax
+  807ec6:	85 c0                	test   %eax,%eax
+  807ec8:	75 07                	jne    807ed1 <mutex_trylock+0x34>
+  807eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ecf:	eb 05                	jmp    807ed6 <mutex_trylock+0x39>
+  807ed1:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  807ed6:	c9                   	leave
+  807ed7:	c3                   	ret
+
+0000000000807ed8 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  807ed8:	55                   	push   %rbp
+  807ed9:	48 89 e5             	mov    %rsp,%rbp
+  807edc:	48 83 ec 10          	sub    $0x10,%rsp
+  807ee0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  807ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  807eed:	48 89 c7             	mov    %rax,%rdi
+  807ef0:	48 b8 73 7d 80 00 00 	movabs $0x807d73,%rax
+  807ef7:	00 00 00 
+  807efa:	ff d0                	call   *%rax
+  807efc:	83 f8 02             	cmp    $0x2,%eax
+  807eff:	75 18                	jne    807f19 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  807f01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807f05:	be 01 00 00 00       	mov    $0x1,%esi
+  807f0a:	48 89 c7             	mov    %rax,%rdi
+  807f0d:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  807f14:	00 00 00 
+  807f17:	ff d0                	call   *%rax
+}
+  807f19:	90                   	nop
+  807f1a:	c9                   	leave
+  807f1b:	c3                   	ret
+
+0000000000807f1c <cond_init>:
+cond_init(struct Cond *c) {
+  807f1c:	55                   	push   %rbp
+  807f1d:	48 89 e5             	mov    %rsp,%rbp
+  807f20:	48 83 ec 08          	sub    $0x8,%rsp
+  807f24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  807f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807f2c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  807f32:	90                   	nop
+  807f33:	c9                   	leave
+  807f34:	c3                   	ret
+
+0000000000807f35 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  807f35:	55                   	push   %rbp
+  807f36:	48 89 e5             	mov    %rsp,%rbp
+  807f39:	48 83 ec 30          	sub    $0x30,%rsp
+  807f3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807f41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807f45:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  807f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807f4d:	8b 00                	mov    (%rax),%eax
+  807f4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  807f52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807f56:	48 89 c7             	mov    %rax,%rdi
+  807f59:	48 b8 d8 7e 80 00 00 	movabs $0x807ed8,%rax
+  807f60:	00 00 00 
+  807f63:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  807f65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807f69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  807f6d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  807f70:	89 ce                	mov    %ecx,%esi
+  807f72:	48 89 c7             	mov    %rax,%rdi
+  807f75:	48 b8 22 34 80 00 00 	movabs $0x803422,%rax
+  807f7c:	00 00 00 
+  807f7f:	ff d0                	call   *%rax
+  807f81:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  807f84:	eb 1f                	jmp    807fa5 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  807f86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807f8a:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  807f91:	be 02 00 00 00       	mov    $0x2,%esi
+  807f96:	48 89 c7             	mov    %rax,%rdi
+  807f99:	48 b8 22 34 80 00 00 	movabs $0x803422,%rax
+  807fa0:	00 00 00 
+  807fa3:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  807fa5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807fa9:	be 02 00 00 00       	mov    $0x2,%esi
+  807fae:	48 89 c7             	mov    %rax,%rdi
+  807fb1:	48 b8 73 7d 80 00 00 	movabs $0x807d73,%rax
+  807fb8:	00 00 00 
+  807fbb:	ff d0                	call   *%rax
+  807fbd:	85 c0                	test   %eax,%eax
+  807fbf:	75 c5                	jne    807f86 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  807fc1:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  807fc5:	75 07                	jne    807fce <cond_timedwait+0x99>
+  807fc7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  807fcc:	eb 05                	jmp    807fd3 <cond_timedwait+0x9e>
+  807fce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807fd3:	c9                   	leave
+  807fd4:	c3                   	ret
+
+0000000000807fd5 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  807fd5:	55                   	push   %rbp
+  807fd6:	48 89 e5             	mov    %rsp,%rbp
+  807fd9:	48 83 ec 10          	sub    $0x10,%rsp
+  807fdd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807fe1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  807fe5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  807fe9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807fed:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  807ff4:	48 89 ce             	mov    %rcx,%rsi
+  807ff7:	48 89 c7             	mov    %rax,%rdi
+  807ffa:	48 b8 35 7f 80 00 00 	movabs $0x807f35,%rax
+  808001:	00 00 00 
+  808004:	ff d0                	call   *%rax
+}
+  808006:	90                   	nop
+  808007:	c9                   	leave
+  808008:	c3                   	ret
+
+0000000000808009 <cond_signal>:
+cond_signal(struct Cond *c) {
+  808009:	55                   	push   %rbp
+  80800a:	48 89 e5             	mov    %rsp,%rbp
+  80800d:	48 83 ec 10          	sub    $0x10,%rsp
+  808011:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  808015:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808019:	be 01 00 00 00       	mov    $0x1,%esi
+  80801e:	48 89 c7             	mov    %rax,%rdi
+  808021:	48 b8 c4 7d 80 00 00 	movabs $0x807dc4,%rax
+  808028:	00 00 00 
+  80802b:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  80802d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808031:	be 01 00 00 00       	mov    $0x1,%esi
+  808036:	48 89 c7             	mov    %rax,%rdi
+  808039:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  808040:	00 00 00 
+  808043:	ff d0                	call   *%rax
+}
+  808045:	90                   	nop
+  808046:	c9                   	leave
+  808047:	c3                   	ret
+
+0000000000808048 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  808048:	55                   	push   %rbp
+  808049:	48 89 e5             	mov    %rsp,%rbp
+  80804c:	48 83 ec 10          	sub    $0x10,%rsp
+  808050:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  808054:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808058:	be 01 00 00 00       	mov    $0x1,%esi
+  80805d:	48 89 c7             	mov    %rax,%rdi
+  808060:	48 b8 c4 7d 80 00 00 	movabs $0x807dc4,%rax
+  808067:	00 00 00 
+  80806a:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  80806c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808070:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  808075:	48 89 c7             	mov    %rax,%rdi
+  808078:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  80807f:	00 00 00 
+  808082:	ff d0                	call   *%rax
+}
+  808084:	90                   	nop
+  808085:	c9                   	leave
+  808086:	c3                   	ret
+
+0000000000808087 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  808087:	55                   	push   %rbp
+  808088:	48 89 e5             	mov    %rsp,%rbp
+  80808b:	48 83 ec 10          	sub    $0x10,%rsp
+  80808f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  808093:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  808096:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80809a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80809d:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  80809f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8080a3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8080aa:	90                   	nop
+  8080ab:	c9                   	leave
+  8080ac:	c3                   	ret
+
+00000000008080ad <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8080ad:	55                   	push   %rbp
+  8080ae:	48 89 e5             	mov    %rsp,%rbp
+  8080b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8080b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8080b9:	eb 2a                	jmp    8080e5 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8080bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8080be:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8080c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8080c5:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8080c8:	89 ce                	mov    %ecx,%esi
+  8080ca:	48 89 c7             	mov    %rax,%rdi
+  8080cd:	48 b8 98 7d 80 00 00 	movabs $0x807d98,%rax
+  8080d4:	00 00 00 
+  8080d7:	ff d0                	call   *%rax
+  8080d9:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8080dc:	75 07                	jne    8080e5 <sem_trywait+0x38>
+      return 0;
+  8080de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8080e3:	eb 14                	jmp    8080f9 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8080e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8080e9:	8b 00                	mov    (%rax),%eax
+  8080eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8080ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8080f2:	75 c7                	jne    8080bb <sem_trywait+0xe>
+  return -E_BUSY;
+  8080f4:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8080f9:	c9                   	leave
+  8080fa:	c3                   	ret
+
+00000000008080fb <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  8080fb:	55                   	push   %rbp
+  8080fc:	48 89 e5             	mov    %rsp,%rbp
+  8080ff:	48 83 ec 30          	sub    $0x30,%rsp
+  808103:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  808107:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  80810b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  808112:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  808113:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  808118:	0f 84 fb 00 00 00    	je     808219 <sem_timedwait+0x11e>
+  80811e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  808123:	0f 84 f0 00 00 00    	je     808219 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  808129:	48 b8 0c 78 80 00 00 	movabs $0x80780c,%rax
+  808130:	00 00 00 
+  808133:	ff d0                	call   *%rax
+  808135:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  808139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80813d:	48 f7 d0             	not    %rax
+  808140:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  808144:	73 0d                	jae    808153 <sem_timedwait+0x58>
+  808146:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80814a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80814e:	48 01 d0             	add    %rdx,%rax
+  808151:	eb 07                	jmp    80815a <sem_timedwait+0x5f>
+  808153:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80815a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  80815e:	e9 b6 00 00 00       	jmp    808219 <sem_timedwait+0x11e>
+    if (deadline) {
+  808163:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  808168:	74 2d                	je     808197 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  80816a:	48 b8 0c 78 80 00 00 	movabs $0x80780c,%rax
+  808171:	00 00 00 
+  808174:	ff d0                	call   *%rax
+  808176:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80817a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80817e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  808182:	73 0a                	jae    80818e <sem_timedwait+0x93>
+  808184:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808188:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80818c:	eb 05                	jmp    808193 <sem_timedwait+0x98>
+  80818e:	b8 00 00 00 00       	mov    $0x0,%eax
+  808193:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  808197:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80819b:	48 83 c0 04          	add    $0x4,%rax
+  80819f:	be 01 00 00 00       	mov    $0x1,%esi
+  8081a4:	48 89 c7             	mov    %rax,%rdi
+  8081a7:	48 b8 c4 7d 80 00 00 	movabs $0x807dc4,%rax
+  8081ae:	00 00 00 
+  8081b1:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8081b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8081b7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8081bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8081c0:	48 89 c7             	mov    %rax,%rdi
+  8081c3:	48 b8 22 34 80 00 00 	movabs $0x803422,%rax
+  8081ca:	00 00 00 
+  8081cd:	ff d0                	call   *%rax
+  8081cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  8081d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8081d6:	48 83 c0 04          	add    $0x4,%rax
+  8081da:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8081df:	48 89 c7             	mov    %rax,%rdi
+  8081e2:	48 b8 c4 7d 80 00 00 	movabs $0x807dc4,%rax
+  8081e9:	00 00 00 
+  8081ec:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8081ee:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8081f2:	75 25                	jne    808219 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8081f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8081f8:	48 89 c7             	mov    %rax,%rdi
+  8081fb:	48 b8 ad 80 80 00 00 	movabs $0x8080ad,%rax
+  808202:	00 00 00 
+  808205:	ff d0                	call   *%rax
+  808207:	85 c0                	test   %eax,%eax
+  808209:	79 07                	jns    808212 <sem_timedwait+0x117>
+  80820b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  808210:	eb 27                	jmp    808239 <sem_timedwait+0x13e>
+  808212:	b8 00 00 00 00       	mov    $0x0,%eax
+  808217:	eb 20                	jmp    808239 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  808219:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80821d:	48 89 c7             	mov    %rax,%rdi
+  808220:	48 b8 ad 80 80 00 00 	movabs $0x8080ad,%rax
+  808227:	00 00 00 
+  80822a:	ff d0                	call   *%rax
+  80822c:	85 c0                	test   %eax,%eax
+  80822e:	0f 88 2f ff ff ff    	js     808163 <sem_timedwait+0x68>
+  return 0;
+  808234:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808239:	c9                   	leave
+  80823a:	c3                   	ret
+
+000000000080823b <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  80823b:	55                   	push   %rbp
+  80823c:	48 89 e5             	mov    %rsp,%rbp
+  80823f:	48 83 ec 10          	sub    $0x10,%rsp
+  808243:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  808247:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80824b:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  808252:	48 89 c7             	mov    %rax,%rdi
+  808255:	48 b8 fb 80 80 00 00 	movabs $0x8080fb,%rax
+  80825c:	00 00 00 
+  80825f:	ff d0                	call   *%rax
+}
+  808261:	90                   	nop
+  808262:	c9                   	leave
+  808263:	c3                   	ret
+
+0000000000808264 <sem_post>:
+sem_post(struct Semaphore *s) {
+  808264:	55                   	push   %rbp
+  808265:	48 89 e5             	mov    %rsp,%rbp
+  808268:	48 83 ec 10          	sub    $0x10,%rsp
+  80826c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  808270:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808274:	be 01 00 00 00       	mov    $0x1,%esi
+  808279:	48 89 c7             	mov    %rax,%rdi
+  80827c:	48 b8 c4 7d 80 00 00 	movabs $0x807dc4,%rax
+  808283:	00 00 00 
+  808286:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  808288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80828c:	8b 40 04             	mov    0x4(%rax),%eax
+  80828f:	85 c0                	test   %eax,%eax
+  808291:	74 18                	je     8082ab <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  808293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  808297:	be 01 00 00 00       	mov    $0x1,%esi
+  80829c:	48 89 c7             	mov    %rax,%rdi
+  80829f:	48 b8 71 34 80 00 00 	movabs $0x803471,%rax
+  8082a6:	00 00 00 
+  8082a9:	ff d0                	call   *%rax
+}
+  8082ab:	90                   	nop
+  8082ac:	c9                   	leave
+  8082ad:	c3                   	ret
+  8082ae:	66 90                	xchg   %ax,%ax
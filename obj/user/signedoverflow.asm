@@ -0,0 +1,8054 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 45 00 00 00       	call   800071 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+//Test for UBSAN support - signed integer overflow
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  //Creating a 32-bit integer variable with the maximum integer value it can contain
+  int a = 2147483647;
+  800041:	c7 45 fc ff ff ff 7f 	movl   $0x7fffffff,-0x4(%rbp)
+  //Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior).
+  //The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+  cprintf("%d\n", a + 1);
+  800048:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80004b:	83 c0 01             	add    $0x1,%eax
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  800057:	00 00 00 
+  80005a:	48 89 c7             	mov    %rax,%rdi
+  80005d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800062:	48 ba 1d 02 80 00 00 	movabs $0x80021d,%rdx
+  800069:	00 00 00 
+  80006c:	ff d2                	call   *%rdx
+}
+  80006e:	90                   	nop
+  80006f:	c9                   	leave
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	48 83 ec 20          	sub    $0x20,%rsp
+  800079:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80007c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800080:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800087:	00 00 00 
+  80008a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80008e:	eb 13                	jmp    8000a3 <libmain+0x32>
+    (*ctor)();
+  800090:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800094:	48 8b 10             	mov    (%rax),%rdx
+  800097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009c:	ff d2                	call   *%rdx
+    ctor++;
+  80009e:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8000a3:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8000aa:	00 00 00 
+  8000ad:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8000b1:	72 dd                	jb     800090 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000b7:	7e 14                	jle    8000cd <libmain+0x5c>
+    binaryname = argv[0];
+  8000b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000bd:	48 8b 00             	mov    (%rax),%rax
+  8000c0:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8000c7:	00 00 00 
+  8000ca:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000d4:	48 89 d6             	mov    %rdx,%rsi
+  8000d7:	89 c7                	mov    %eax,%edi
+  8000d9:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000e5:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+#endif
+}
+  8000f1:	90                   	nop
+  8000f2:	c9                   	leave
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000f8:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 53 1e 80 00 00 	movabs $0x801e53,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	90                   	nop
+  800116:	5d                   	pop    %rbp
+  800117:	c3                   	ret
+
+0000000000800118 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800118:	55                   	push   %rbp
+  800119:	48 89 e5             	mov    %rsp,%rbp
+  80011c:	48 83 ec 10          	sub    $0x10,%rsp
+  800120:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800123:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800127:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80012b:	8b 00                	mov    (%rax),%eax
+  80012d:	8d 48 01             	lea    0x1(%rax),%ecx
+  800130:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800134:	89 0a                	mov    %ecx,(%rdx)
+  800136:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800139:	89 d1                	mov    %edx,%ecx
+  80013b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80013f:	48 98                	cltq
+  800141:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800145:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800149:	8b 00                	mov    (%rax),%eax
+  80014b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800150:	75 2c                	jne    80017e <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800156:	8b 00                	mov    (%rax),%eax
+  800158:	48 98                	cltq
+  80015a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80015e:	48 83 c2 08          	add    $0x8,%rdx
+  800162:	48 89 c6             	mov    %rax,%rsi
+  800165:	48 89 d7             	mov    %rdx,%rdi
+  800168:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+    b->idx = 0;
+  800174:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800178:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80017e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800182:	8b 40 04             	mov    0x4(%rax),%eax
+  800185:	8d 50 01             	lea    0x1(%rax),%edx
+  800188:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80018c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80018f:	90                   	nop
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+0000000000800192 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800192:	55                   	push   %rbp
+  800193:	48 89 e5             	mov    %rsp,%rbp
+  800196:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80019d:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8001a4:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8001b2:	00 00 00 
+  b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8001bc:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8001bf:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8001c6:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8001cd:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8001d4:	48 89 c6             	mov    %rax,%rsi
+  8001d7:	48 b8 18 01 80 00 00 	movabs $0x800118,%rax
+  8001de:	00 00 00 
+  8001e1:	48 89 c7             	mov    %rax,%rdi
+  8001e4:	48 b8 77 05 80 00 00 	movabs $0x800577,%rax
+  8001eb:	00 00 00 
+  8001ee:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8001f0:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8001f6:	48 98                	cltq
+  8001f8:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8001ff:	48 83 c2 08          	add    $0x8,%rdx
+  800203:	48 89 c6             	mov    %rax,%rsi
+  800206:	48 89 d7             	mov    %rdx,%rdi
+  800209:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  800210:	00 00 00 
+  800213:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800215:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80021b:	c9                   	leave
+  80021c:	c3                   	ret
+
+000000000080021d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80021d:	55                   	push   %rbp
+  80021e:	48 89 e5             	mov    %rsp,%rbp
+  800221:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800228:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80022f:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800236:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80023d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800244:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80024b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800252:	84 c0                	test   %al,%al
+  800254:	74 20                	je     800276 <cprintf+0x59>
+  800256:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80025a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80025e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800262:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800266:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80026a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80026e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800272:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800276:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80027d:	00 00 00 
+  800280:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800287:	00 00 00 
+  80028a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800295:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80029c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8002a3:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8002aa:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8002b1:	48 89 d6             	mov    %rdx,%rsi
+  8002b4:	48 89 c7             	mov    %rax,%rdi
+  8002b7:	48 b8 92 01 80 00 00 	movabs $0x800192,%rax
+  8002be:	00 00 00 
+  8002c1:	ff d0                	call   *%rax
+  8002c3:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8002c9:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8002cf:	c9                   	leave
+  8002d0:	c3                   	ret
+
+00000000008002d1 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8002d1:	55                   	push   %rbp
+  8002d2:	48 89 e5             	mov    %rsp,%rbp
+  8002d5:	48 83 ec 30          	sub    $0x30,%rsp
+  8002d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8002dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8002e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8002e5:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8002e8:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8002ec:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8002f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002f3:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8002f7:	72 54                	jb     80034d <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002fc:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8002ff:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030b:	48 f7 f6             	div    %rsi
+  80030e:	49 89 c2             	mov    %rax,%r10
+  800311:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800314:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800317:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80031b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80031f:	41 89 c9             	mov    %ecx,%r9d
+  800322:	41 89 f8             	mov    %edi,%r8d
+  800325:	89 d1                	mov    %edx,%ecx
+  800327:	4c 89 d2             	mov    %r10,%rdx
+  80032a:	48 89 c7             	mov    %rax,%rdi
+  80032d:	48 b8 d1 02 80 00 00 	movabs $0x8002d1,%rax
+  800334:	00 00 00 
+  800337:	ff d0                	call   *%rax
+  800339:	eb 1c                	jmp    800357 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80033b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80033f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800342:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800346:	48 89 d6             	mov    %rdx,%rsi
+  800349:	89 c7                	mov    %eax,%edi
+  80034b:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80034d:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800351:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800355:	7f e4                	jg     80033b <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800357:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80035a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80035e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800363:	48 f7 f1             	div    %rcx
+  800366:	48 b8 30 52 80 00 00 	movabs $0x805230,%rax
+  80036d:	00 00 00 
+  800370:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800374:	0f be c0             	movsbl %al,%eax
+  800377:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80037b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80037f:	48 89 d6             	mov    %rdx,%rsi
+  800382:	89 c7                	mov    %eax,%edi
+  800384:	ff d1                	call   *%rcx
+}
+  800386:	90                   	nop
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+0000000000800389 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800389:	55                   	push   %rbp
+  80038a:	48 89 e5             	mov    %rsp,%rbp
+  80038d:	48 83 ec 10          	sub    $0x10,%rsp
+  800391:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800395:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800398:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80039c:	7e 4b                	jle    8003e9 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80039e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003a2:	8b 00                	mov    (%rax),%eax
+  8003a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8003a7:	77 24                	ja     8003cd <getuint+0x44>
+  8003a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003ad:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8003b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003b5:	8b 00                	mov    (%rax),%eax
+  8003b7:	89 c0                	mov    %eax,%eax
+  8003b9:	48 01 d0             	add    %rdx,%rax
+  8003bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c0:	8b 12                	mov    (%rdx),%edx
+  8003c2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8003c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003c9:	89 0a                	mov    %ecx,(%rdx)
+  8003cb:	eb 14                	jmp    8003e1 <getuint+0x58>
+  8003cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003d5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8003d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8003dd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8003e1:	48 8b 00             	mov    (%rax),%rax
+  8003e4:	e9 95 00 00 00       	jmp    80047e <getuint+0xf5>
+  else if (lflag)
+  8003e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8003ed:	74 48                	je     800437 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8003ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f3:	8b 00                	mov    (%rax),%eax
+  8003f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f8:	77 24                	ja     80041e <getuint+0x95>
+  8003fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003fe:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800402:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800406:	8b 00                	mov    (%rax),%eax
+  800408:	89 c0                	mov    %eax,%eax
+  80040a:	48 01 d0             	add    %rdx,%rax
+  80040d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800411:	8b 12                	mov    (%rdx),%edx
+  800413:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800416:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80041a:	89 0a                	mov    %ecx,(%rdx)
+  80041c:	eb 14                	jmp    800432 <getuint+0xa9>
+  80041e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800422:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800426:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80042a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80042e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800432:	48 8b 00             	mov    (%rax),%rax
+  800435:	eb 47                	jmp    80047e <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800437:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80043b:	8b 00                	mov    (%rax),%eax
+  80043d:	83 f8 2f             	cmp    $0x2f,%eax
+  800440:	77 24                	ja     800466 <getuint+0xdd>
+  800442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800446:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80044a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80044e:	8b 00                	mov    (%rax),%eax
+  800450:	89 c0                	mov    %eax,%eax
+  800452:	48 01 d0             	add    %rdx,%rax
+  800455:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800459:	8b 12                	mov    (%rdx),%edx
+  80045b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80045e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800462:	89 0a                	mov    %ecx,(%rdx)
+  800464:	eb 14                	jmp    80047a <getuint+0xf1>
+  800466:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80046a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80046e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800472:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800476:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80047a:	8b 00                	mov    (%rax),%eax
+  80047c:	89 c0                	mov    %eax,%eax
+}
+  80047e:	c9                   	leave
+  80047f:	c3                   	ret
+
+0000000000800480 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800480:	55                   	push   %rbp
+  800481:	48 89 e5             	mov    %rsp,%rbp
+  800484:	48 83 ec 10          	sub    $0x10,%rsp
+  800488:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80048c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80048f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800493:	7e 4b                	jle    8004e0 <getint+0x60>
+    return va_arg(*ap, long long);
+  800495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800499:	8b 00                	mov    (%rax),%eax
+  80049b:	83 f8 2f             	cmp    $0x2f,%eax
+  80049e:	77 24                	ja     8004c4 <getint+0x44>
+  8004a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ac:	8b 00                	mov    (%rax),%eax
+  8004ae:	89 c0                	mov    %eax,%eax
+  8004b0:	48 01 d0             	add    %rdx,%rax
+  8004b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b7:	8b 12                	mov    (%rdx),%edx
+  8004b9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004c0:	89 0a                	mov    %ecx,(%rdx)
+  8004c2:	eb 14                	jmp    8004d8 <getint+0x58>
+  8004c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004cc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004d4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004d8:	48 8b 00             	mov    (%rax),%rax
+  8004db:	e9 95 00 00 00       	jmp    800575 <getint+0xf5>
+  else if (lflag)
+  8004e0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004e4:	74 48                	je     80052e <getint+0xae>
+    return va_arg(*ap, long);
+  8004e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004ea:	8b 00                	mov    (%rax),%eax
+  8004ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ef:	77 24                	ja     800515 <getint+0x95>
+  8004f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004fd:	8b 00                	mov    (%rax),%eax
+  8004ff:	89 c0                	mov    %eax,%eax
+  800501:	48 01 d0             	add    %rdx,%rax
+  800504:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800508:	8b 12                	mov    (%rdx),%edx
+  80050a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80050d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800511:	89 0a                	mov    %ecx,(%rdx)
+  800513:	eb 14                	jmp    800529 <getint+0xa9>
+  800515:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800519:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80051d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800521:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800525:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800529:	48 8b 00             	mov    (%rax),%rax
+  80052c:	eb 47                	jmp    800575 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80052e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800532:	8b 00                	mov    (%rax),%eax
+  800534:	83 f8 2f             	cmp    $0x2f,%eax
+  800537:	77 24                	ja     80055d <getint+0xdd>
+  800539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800541:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800545:	8b 00                	mov    (%rax),%eax
+  800547:	89 c0                	mov    %eax,%eax
+  800549:	48 01 d0             	add    %rdx,%rax
+  80054c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800550:	8b 12                	mov    (%rdx),%edx
+  800552:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800555:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800559:	89 0a                	mov    %ecx,(%rdx)
+  80055b:	eb 14                	jmp    800571 <getint+0xf1>
+  80055d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800561:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800565:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800569:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80056d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800571:	8b 00                	mov    (%rax),%eax
+  800573:	48 98                	cltq
+}
+  800575:	c9                   	leave
+  800576:	c3                   	ret
+
+0000000000800577 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800577:	55                   	push   %rbp
+  800578:	48 89 e5             	mov    %rsp,%rbp
+  80057b:	41 54                	push   %r12
+  80057d:	53                   	push   %rbx
+  80057e:	48 83 ec 60          	sub    $0x60,%rsp
+  800582:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800586:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80058a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80058e:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800592:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800596:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80059a:	48 8b 06             	mov    (%rsi),%rax
+  80059d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005a1:	48 89 01             	mov    %rax,(%rcx)
+  8005a4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005a8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005ac:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005b0:	eb 17                	jmp    8005c9 <vprintfmt+0x52>
+      if (ch == '\0')
+  8005b2:	85 db                	test   %ebx,%ebx
+  8005b4:	0f 84 bf 04 00 00    	je     800a79 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8005ba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005be:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8005c2:	48 89 c6             	mov    %rax,%rsi
+  8005c5:	89 df                	mov    %ebx,%edi
+  8005c7:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8005c9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8005cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005d1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8005d5:	0f b6 00             	movzbl (%rax),%eax
+  8005d8:	0f b6 d8             	movzbl %al,%ebx
+  8005db:	83 fb 25             	cmp    $0x25,%ebx
+  8005de:	75 d2                	jne    8005b2 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8005e0:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8005e4:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8005eb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8005f2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8005f9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800600:	eb 04                	jmp    800606 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800602:	90                   	nop
+  800603:	eb 01                	jmp    800606 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800605:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800606:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80060a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80060e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800612:	0f b6 00             	movzbl (%rax),%eax
+  800615:	0f b6 d8             	movzbl %al,%ebx
+  800618:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80061b:	83 f8 55             	cmp    $0x55,%eax
+  80061e:	0f 87 22 04 00 00    	ja     800a46 <vprintfmt+0x4cf>
+  800624:	89 c0                	mov    %eax,%eax
+  800626:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80062d:	00 
+  80062e:	48 b8 58 52 80 00 00 	movabs $0x805258,%rax
+  800635:	00 00 00 
+  800638:	48 01 d0             	add    %rdx,%rax
+  80063b:	48 8b 00             	mov    (%rax),%rax
+  80063e:	ff e0                	jmp    *%rax
+        padc = '-';
+  800640:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800644:	eb c0                	jmp    800606 <vprintfmt+0x8f>
+        padc = '0';
+  800646:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80064a:	eb ba                	jmp    800606 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80064c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800653:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800656:	89 d0                	mov    %edx,%eax
+  800658:	c1 e0 02             	shl    $0x2,%eax
+  80065b:	01 d0                	add    %edx,%eax
+  80065d:	01 c0                	add    %eax,%eax
+  80065f:	01 d8                	add    %ebx,%eax
+  800661:	83 e8 30             	sub    $0x30,%eax
+  800664:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800667:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80066b:	0f b6 00             	movzbl (%rax),%eax
+  80066e:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800671:	83 fb 2f             	cmp    $0x2f,%ebx
+  800674:	7e 60                	jle    8006d6 <vprintfmt+0x15f>
+  800676:	83 fb 39             	cmp    $0x39,%ebx
+  800679:	7f 5b                	jg     8006d6 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80067b:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800680:	eb d1                	jmp    800653 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800682:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800685:	83 f8 2f             	cmp    $0x2f,%eax
+  800688:	77 17                	ja     8006a1 <vprintfmt+0x12a>
+  80068a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80068e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800691:	89 d2                	mov    %edx,%edx
+  800693:	48 01 d0             	add    %rdx,%rax
+  800696:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800699:	83 c2 08             	add    $0x8,%edx
+  80069c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80069f:	eb 0c                	jmp    8006ad <vprintfmt+0x136>
+  8006a1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8006a5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8006a9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8006ad:	8b 00                	mov    (%rax),%eax
+  8006af:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8006b2:	eb 23                	jmp    8006d7 <vprintfmt+0x160>
+        if (width < 0)
+  8006b4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006b8:	0f 89 44 ff ff ff    	jns    800602 <vprintfmt+0x8b>
+          width = 0;
+  8006be:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8006c5:	e9 38 ff ff ff       	jmp    800602 <vprintfmt+0x8b>
+        altflag = 1;
+  8006ca:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8006d1:	e9 30 ff ff ff       	jmp    800606 <vprintfmt+0x8f>
+        goto process_precision;
+  8006d6:	90                   	nop
+        if (width < 0)
+  8006d7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006db:	0f 89 24 ff ff ff    	jns    800605 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8006e1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8006e4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8006e7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8006ee:	e9 12 ff ff ff       	jmp    800605 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8006f3:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8006f7:	e9 0a ff ff ff       	jmp    800606 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8006fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800702:	77 17                	ja     80071b <vprintfmt+0x1a4>
+  800704:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800708:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80070b:	89 d2                	mov    %edx,%edx
+  80070d:	48 01 d0             	add    %rdx,%rax
+  800710:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800713:	83 c2 08             	add    $0x8,%edx
+  800716:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800719:	eb 0c                	jmp    800727 <vprintfmt+0x1b0>
+  80071b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80071f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800723:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800727:	8b 00                	mov    (%rax),%eax
+  800729:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80072d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800731:	48 89 d6             	mov    %rdx,%rsi
+  800734:	89 c7                	mov    %eax,%edi
+  800736:	ff d1                	call   *%rcx
+        break;
+  800738:	e9 37 03 00 00       	jmp    800a74 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80073d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800740:	83 f8 2f             	cmp    $0x2f,%eax
+  800743:	77 17                	ja     80075c <vprintfmt+0x1e5>
+  800745:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800749:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80074c:	89 d2                	mov    %edx,%edx
+  80074e:	48 01 d0             	add    %rdx,%rax
+  800751:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800754:	83 c2 08             	add    $0x8,%edx
+  800757:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80075a:	eb 0c                	jmp    800768 <vprintfmt+0x1f1>
+  80075c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800760:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800764:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800768:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80076a:	85 db                	test   %ebx,%ebx
+  80076c:	79 02                	jns    800770 <vprintfmt+0x1f9>
+          err = -err;
+  80076e:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800770:	83 fb 15             	cmp    $0x15,%ebx
+  800773:	7f 16                	jg     80078b <vprintfmt+0x214>
+  800775:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  80077c:	00 00 00 
+  80077f:	48 63 c3             	movslq %ebx,%rax
+  800782:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800786:	4d 85 e4             	test   %r12,%r12
+  800789:	75 2e                	jne    8007b9 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80078b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80078f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800793:	89 d9                	mov    %ebx,%ecx
+  800795:	48 ba 41 52 80 00 00 	movabs $0x805241,%rdx
+  80079c:	00 00 00 
+  80079f:	48 89 c7             	mov    %rax,%rdi
+  8007a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a7:	49 b8 83 0a 80 00 00 	movabs $0x800a83,%r8
+  8007ae:	00 00 00 
+  8007b1:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8007b4:	e9 bb 02 00 00       	jmp    800a74 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8007b9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8007bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8007c1:	4c 89 e1             	mov    %r12,%rcx
+  8007c4:	48 ba 4a 52 80 00 00 	movabs $0x80524a,%rdx
+  8007cb:	00 00 00 
+  8007ce:	48 89 c7             	mov    %rax,%rdi
+  8007d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d6:	49 b8 83 0a 80 00 00 	movabs $0x800a83,%r8
+  8007dd:	00 00 00 
+  8007e0:	41 ff d0             	call   *%r8
+        break;
+  8007e3:	e9 8c 02 00 00       	jmp    800a74 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8007e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ee:	77 17                	ja     800807 <vprintfmt+0x290>
+  8007f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007f4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f7:	89 d2                	mov    %edx,%edx
+  8007f9:	48 01 d0             	add    %rdx,%rax
+  8007fc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007ff:	83 c2 08             	add    $0x8,%edx
+  800802:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800805:	eb 0c                	jmp    800813 <vprintfmt+0x29c>
+  800807:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80080b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80080f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800813:	4c 8b 20             	mov    (%rax),%r12
+  800816:	4d 85 e4             	test   %r12,%r12
+  800819:	75 0a                	jne    800825 <vprintfmt+0x2ae>
+          p = "(null)";
+  80081b:	49 bc 4d 52 80 00 00 	movabs $0x80524d,%r12
+  800822:	00 00 00 
+        if (width > 0 && padc != '-')
+  800825:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800829:	7e 78                	jle    8008a3 <vprintfmt+0x32c>
+  80082b:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80082f:	74 72                	je     8008a3 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800831:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800834:	48 98                	cltq
+  800836:	48 89 c6             	mov    %rax,%rsi
+  800839:	4c 89 e7             	mov    %r12,%rdi
+  80083c:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  800843:	00 00 00 
+  800846:	ff d0                	call   *%rax
+  800848:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80084b:	eb 17                	jmp    800864 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80084d:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800851:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800855:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800859:	48 89 d6             	mov    %rdx,%rsi
+  80085c:	89 c7                	mov    %eax,%edi
+  80085e:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800860:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800864:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800868:	7f e3                	jg     80084d <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80086a:	eb 37                	jmp    8008a3 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80086c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800870:	74 1e                	je     800890 <vprintfmt+0x319>
+  800872:	83 fb 1f             	cmp    $0x1f,%ebx
+  800875:	7e 05                	jle    80087c <vprintfmt+0x305>
+  800877:	83 fb 7e             	cmp    $0x7e,%ebx
+  80087a:	7e 14                	jle    800890 <vprintfmt+0x319>
+            putch('?', putdat);
+  80087c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800880:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800884:	48 89 c6             	mov    %rax,%rsi
+  800887:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80088c:	ff d2                	call   *%rdx
+  80088e:	eb 0f                	jmp    80089f <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800890:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800894:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800898:	48 89 c6             	mov    %rax,%rsi
+  80089b:	89 df                	mov    %ebx,%edi
+  80089d:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80089f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008a3:	4c 89 e0             	mov    %r12,%rax
+  8008a6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008aa:	0f b6 00             	movzbl (%rax),%eax
+  8008ad:	0f be d8             	movsbl %al,%ebx
+  8008b0:	85 db                	test   %ebx,%ebx
+  8008b2:	74 28                	je     8008dc <vprintfmt+0x365>
+  8008b4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008b8:	78 b2                	js     80086c <vprintfmt+0x2f5>
+  8008ba:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8008be:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8008c2:	79 a8                	jns    80086c <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8008c4:	eb 16                	jmp    8008dc <vprintfmt+0x365>
+          putch(' ', putdat);
+  8008c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008ca:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8008ce:	48 89 c6             	mov    %rax,%rsi
+  8008d1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d6:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8008d8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8008dc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008e0:	7f e4                	jg     8008c6 <vprintfmt+0x34f>
+        break;
+  8008e2:	e9 8d 01 00 00       	jmp    800a74 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8008e7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8008ea:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8008ee:	89 d6                	mov    %edx,%esi
+  8008f0:	48 89 c7             	mov    %rax,%rdi
+  8008f3:	48 b8 80 04 80 00 00 	movabs $0x800480,%rax
+  8008fa:	00 00 00 
+  8008fd:	ff d0                	call   *%rax
+  8008ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800903:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800907:	48 85 c0             	test   %rax,%rax
+  80090a:	79 1d                	jns    800929 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80090c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800910:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800914:	48 89 c6             	mov    %rax,%rsi
+  800917:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80091c:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80091e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800922:	48 f7 d8             	neg    %rax
+  800925:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800929:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800930:	e9 d2 00 00 00       	jmp    800a07 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800935:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800938:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80093c:	89 d6                	mov    %edx,%esi
+  80093e:	48 89 c7             	mov    %rax,%rdi
+  800941:	48 b8 89 03 80 00 00 	movabs $0x800389,%rax
+  800948:	00 00 00 
+  80094b:	ff d0                	call   *%rax
+  80094d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800951:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800958:	e9 aa 00 00 00       	jmp    800a07 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80095d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800960:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800964:	89 d6                	mov    %edx,%esi
+  800966:	48 89 c7             	mov    %rax,%rdi
+  800969:	48 b8 89 03 80 00 00 	movabs $0x800389,%rax
+  800970:	00 00 00 
+  800973:	ff d0                	call   *%rax
+  800975:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800979:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800980:	e9 82 00 00 00       	jmp    800a07 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800985:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800989:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80098d:	48 89 c6             	mov    %rax,%rsi
+  800990:	bf 30 00 00 00       	mov    $0x30,%edi
+  800995:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800997:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80099b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80099f:	48 89 c6             	mov    %rax,%rsi
+  8009a2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a7:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 17                	ja     8009c8 <vprintfmt+0x451>
+  8009b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009b5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009b8:	89 d2                	mov    %edx,%edx
+  8009ba:	48 01 d0             	add    %rdx,%rax
+  8009bd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009c0:	83 c2 08             	add    $0x8,%edx
+  8009c3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009c6:	eb 0c                	jmp    8009d4 <vprintfmt+0x45d>
+  8009c8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009cc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009d0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009d4:	48 8b 00             	mov    (%rax),%rax
+  8009d7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8009db:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8009e2:	eb 23                	jmp    800a07 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8009e4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009e7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009eb:	89 d6                	mov    %edx,%esi
+  8009ed:	48 89 c7             	mov    %rax,%rdi
+  8009f0:	48 b8 89 03 80 00 00 	movabs $0x800389,%rax
+  8009f7:	00 00 00 
+  8009fa:	ff d0                	call   *%rax
+  8009fc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800a00:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800a07:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800a0c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800a0f:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800a12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a16:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a1a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a1e:	45 89 c1             	mov    %r8d,%r9d
+  800a21:	41 89 f8             	mov    %edi,%r8d
+  800a24:	48 89 c7             	mov    %rax,%rdi
+  800a27:	48 b8 d1 02 80 00 00 	movabs $0x8002d1,%rax
+  800a2e:	00 00 00 
+  800a31:	ff d0                	call   *%rax
+        break;
+  800a33:	eb 3f                	jmp    800a74 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800a35:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a39:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a3d:	48 89 c6             	mov    %rax,%rsi
+  800a40:	89 df                	mov    %ebx,%edi
+  800a42:	ff d2                	call   *%rdx
+        break;
+  800a44:	eb 2e                	jmp    800a74 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800a46:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a4a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a4e:	48 89 c6             	mov    %rax,%rsi
+  800a51:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a56:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800a58:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a5d:	eb 05                	jmp    800a64 <vprintfmt+0x4ed>
+  800a5f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800a64:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a68:	48 83 e8 01          	sub    $0x1,%rax
+  800a6c:	0f b6 00             	movzbl (%rax),%eax
+  800a6f:	3c 25                	cmp    $0x25,%al
+  800a71:	75 ec                	jne    800a5f <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800a73:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a74:	e9 50 fb ff ff       	jmp    8005c9 <vprintfmt+0x52>
+        return;
+  800a79:	90                   	nop
+    }
+  }
+}
+  800a7a:	48 83 c4 60          	add    $0x60,%rsp
+  800a7e:	5b                   	pop    %rbx
+  800a7f:	41 5c                	pop    %r12
+  800a81:	5d                   	pop    %rbp
+  800a82:	c3                   	ret
+
+0000000000800a83 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a83:	55                   	push   %rbp
+  800a84:	48 89 e5             	mov    %rsp,%rbp
+  800a87:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800a8e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800a95:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800a9c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800aa3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800aaa:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ab1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ab8:	84 c0                	test   %al,%al
+  800aba:	74 20                	je     800adc <printfmt+0x59>
+  800abc:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ac0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ac4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ac8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800acc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ad0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ad4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ad8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800adc:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ae3:	00 00 00 
+  800ae6:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800aed:	00 00 00 
+  800af0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800af4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800afb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b02:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800b09:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800b10:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800b17:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800b1e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800b25:	48 89 c7             	mov    %rax,%rdi
+  800b28:	48 b8 77 05 80 00 00 	movabs $0x800577,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800b34:	90                   	nop
+  800b35:	c9                   	leave
+  800b36:	c3                   	ret
+
+0000000000800b37 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800b37:	55                   	push   %rbp
+  800b38:	48 89 e5             	mov    %rsp,%rbp
+  800b3b:	48 83 ec 10          	sub    $0x10,%rsp
+  800b3f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800b46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b4a:	8b 40 10             	mov    0x10(%rax),%eax
+  800b4d:	8d 50 01             	lea    0x1(%rax),%edx
+  800b50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b54:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800b57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5b:	48 8b 10             	mov    (%rax),%rdx
+  800b5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b66:	48 39 c2             	cmp    %rax,%rdx
+  800b69:	73 17                	jae    800b82 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6f:	48 8b 00             	mov    (%rax),%rax
+  800b72:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800b76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b7a:	48 89 0a             	mov    %rcx,(%rdx)
+  800b7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b80:	88 10                	mov    %dl,(%rax)
+}
+  800b82:	90                   	nop
+  800b83:	c9                   	leave
+  800b84:	c3                   	ret
+
+0000000000800b85 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800b85:	55                   	push   %rbp
+  800b86:	48 89 e5             	mov    %rsp,%rbp
+  800b89:	48 83 ec 40          	sub    $0x40,%rsp
+  800b8d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800b91:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800b94:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b98:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800b9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ba0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800ba4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800ba7:	48 98                	cltq
+  800ba9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800bad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb1:	48 01 d0             	add    %rdx,%rax
+  800bb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800bb8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800bbf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800bc4:	74 06                	je     800bcc <vsnprintf+0x47>
+  800bc6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bca:	7f 07                	jg     800bd3 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800bcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd1:	eb 32                	jmp    800c05 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800bd3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800bd7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800bdb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800bdf:	48 89 c6             	mov    %rax,%rsi
+  800be2:	48 b8 37 0b 80 00 00 	movabs $0x800b37,%rax
+  800be9:	00 00 00 
+  800bec:	48 89 c7             	mov    %rax,%rdi
+  800bef:	48 b8 77 05 80 00 00 	movabs $0x800577,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800bfb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800bff:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800c02:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800c05:	c9                   	leave
+  800c06:	c3                   	ret
+
+0000000000800c07 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800c07:	55                   	push   %rbp
+  800c08:	48 89 e5             	mov    %rsp,%rbp
+  800c0b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c12:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c19:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800c1f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c26:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c2d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c34:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c3b:	84 c0                	test   %al,%al
+  800c3d:	74 20                	je     800c5f <snprintf+0x58>
+  800c3f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c43:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c47:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c4b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c4f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c53:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c57:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c5b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c5f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800c66:	00 00 00 
+  800c69:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c70:	00 00 00 
+  800c73:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c77:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c7e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c85:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c8c:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800c93:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800c9a:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ca0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ca7:	48 89 c7             	mov    %rax,%rdi
+  800caa:	48 b8 85 0b 80 00 00 	movabs $0x800b85,%rax
+  800cb1:	00 00 00 
+  800cb4:	ff d0                	call   *%rax
+  800cb6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800cbc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+
+0000000000800cc4 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800cc4:	55                   	push   %rbp
+  800cc5:	48 89 e5             	mov    %rsp,%rbp
+  800cc8:	53                   	push   %rbx
+  800cc9:	48 83 ec 38          	sub    $0x38,%rsp
+  800ccd:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800cd0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cd4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800cd8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800cdc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800ce0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce8:	89 d1                	mov    %edx,%ecx
+  800cea:	0f a2                	cpuid
+  800cec:	89 de                	mov    %ebx,%esi
+  800cee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800cf1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800cf4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800cf7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800cfa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800cff:	74 09                	je     800d0a <cpuid+0x46>
+}
+  800d01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d05:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800d08:	89 10                	mov    %edx,(%rax)
+
+  800d0a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d0f:	74 09                	je     800d1a <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800d11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d15:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800d18:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800d1a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800d1f:	74 09                	je     800d2a <cpuid+0x66>
+char *
+  800d21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d25:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800d28:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800d2a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800d2f:	74 09                	je     800d3a <cpuid+0x76>
+  for (; *s; s++)
+  800d31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d35:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800d38:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800d3a:	90                   	nop
+  800d3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+0000000000800d41 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800d41:	55                   	push   %rbp
+  800d42:	48 89 e5             	mov    %rsp,%rbp
+  800d45:	48 83 ec 18          	sub    $0x18,%rsp
+  800d49:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800d4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d4f:	89 c1                	mov    %eax,%ecx
+  800d51:	0f 01 d0             	xgetbv
+  800d54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d57:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800d5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d5d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800d60:	48 c1 e2 20          	shl    $0x20,%rdx
+  800d64:	48 09 d0             	or     %rdx,%rax
+#else
+  800d67:	c9                   	leave
+  800d68:	c3                   	ret
+
+0000000000800d69 <string_cpu>:
+string_cpu(void) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+  800d6d:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800d71:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800d78:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800d7f:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d86:	00 00 00 
+  800d89:	8b 00                	mov    (%rax),%eax
+  800d8b:	85 c0                	test   %eax,%eax
+  800d8d:	78 11                	js     800da0 <string_cpu+0x37>
+    return string_features;
+  800d8f:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800d96:	00 00 00 
+  800d99:	8b 00                	mov    (%rax),%eax
+  800d9b:	e9 df 00 00 00       	jmp    800e7f <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800da0:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800da4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800daa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db4:	48 89 c6             	mov    %rax,%rsi
+  800db7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dbc:	48 b8 c4 0c 80 00 00 	movabs $0x800cc4,%rax
+  800dc3:	00 00 00 
+  800dc6:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800dc8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800dcb:	83 f8 06             	cmp    $0x6,%eax
+  800dce:	76 28                	jbe    800df8 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800dd0:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800dd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800dda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ddf:	48 89 c2             	mov    %rax,%rdx
+  800de2:	be 00 00 00 00       	mov    $0x0,%esi
+  800de7:	bf 07 00 00 00       	mov    $0x7,%edi
+  800dec:	48 b8 c4 0c 80 00 00 	movabs $0x800cc4,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800df8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800dfb:	25 00 02 00 00       	and    $0x200,%eax
+  800e00:	85 c0                	test   %eax,%eax
+  800e02:	74 04                	je     800e08 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800e04:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800e08:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800e0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e12:	48 89 c1             	mov    %rax,%rcx
+  800e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e24:	48 b8 c4 0c 80 00 00 	movabs $0x800cc4,%rax
+  800e2b:	00 00 00 
+  800e2e:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800e33:	83 e0 20             	and    $0x20,%eax
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	74 2a                	je     800e64 <string_cpu+0xfb>
+  800e3a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800e3d:	25 00 00 00 08       	and    $0x8000000,%eax
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	74 1e                	je     800e64 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800e46:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4b:	48 b8 41 0d 80 00 00 	movabs $0x800d41,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+  800e57:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800e5a:	48 83 f8 06          	cmp    $0x6,%rax
+  800e5e:	75 04                	jne    800e64 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800e60:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800e64:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800e6b:	00 00 00 
+  800e6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e71:	89 02                	mov    %eax,(%rdx)
+  800e73:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e7a:	00 00 00 
+  800e7d:	8b 00                	mov    (%rax),%eax
+}
+  800e7f:	c9                   	leave
+  800e80:	c3                   	ret
+
+0000000000800e81 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800e81:	55                   	push   %rbp
+  800e82:	48 89 e5             	mov    %rsp,%rbp
+  800e85:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800e89:	48 83 ec 60          	sub    $0x60,%rsp
+  800e8d:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800e92:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800e97:	83 e0 1f             	and    $0x1f,%eax
+  800e9a:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800e9e:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800ea2:	48 f7 d8             	neg    %rax
+  800ea5:	48 89 c2             	mov    %rax,%rdx
+  800ea8:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800ead:	48 01 d0             	add    %rdx,%rax
+  800eb0:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800eb5:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800eb9:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800ebf:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ec4:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800ec8:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800ece:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800ed2:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800ed6:	89 c2                	mov    %eax,%edx
+  800ed8:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800edc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800ee1:	89 c1                	mov    %eax,%ecx
+  800ee3:	d3 e6                	shl    %cl,%esi
+  800ee5:	89 f0                	mov    %esi,%eax
+  800ee7:	21 d0                	and    %edx,%eax
+  800ee9:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800eed:	eb 21                	jmp    800f10 <strlen_avx2+0x8f>
+    p += 32;
+  800eef:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800ef5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800efa:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800efe:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800f04:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f08:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f0c:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800f10:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800f15:	74 d8                	je     800eef <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800f17:	31 c0                	xor    %eax,%eax
+  800f19:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800f1f:	48 63 d0             	movslq %eax,%rdx
+  800f22:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f27:	48 01 d0             	add    %rdx,%rax
+  800f2a:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  800f2f:	c9                   	leave
+  800f30:	c3                   	ret
+
+0000000000800f31 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  800f31:	55                   	push   %rbp
+  800f32:	48 89 e5             	mov    %rsp,%rbp
+  800f35:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f39:	48 83 ec 40          	sub    $0x40,%rsp
+  800f3d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  800f42:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  800f47:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800f4c:	eb 77                	jmp    800fc5 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  800f4e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f53:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f57:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  800f5b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800f60:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  800f64:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800f68:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800f6c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  800f70:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  800f75:	74 3c                	je     800fb3 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  800f77:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  800f7b:	f7 d0                	not    %eax
+  800f7d:	f3 0f bc c0          	tzcnt  %eax,%eax
+  800f81:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  800f85:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  800f89:	48 63 d0             	movslq %eax,%rdx
+  800f8c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800f91:	48 01 d0             	add    %rdx,%rax
+  800f94:	0f b6 00             	movzbl (%rax),%eax
+  800f97:	0f b6 c0             	movzbl %al,%eax
+  800f9a:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  800f9e:	48 63 ca             	movslq %edx,%rcx
+  800fa1:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  800fa6:	48 01 ca             	add    %rcx,%rdx
+  800fa9:	0f b6 12             	movzbl (%rdx),%edx
+  800fac:	0f b6 d2             	movzbl %dl,%edx
+  800faf:	29 d0                	sub    %edx,%eax
+  800fb1:	eb 6b                	jmp    80101e <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  800fb3:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  800fb9:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  800fbf:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  800fc5:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  800fcb:	77 81                	ja     800f4e <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  800fcd:	eb 42                	jmp    801011 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  800fcf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fd4:	0f b6 10             	movzbl (%rax),%edx
+  800fd7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800fdc:	0f b6 00             	movzbl (%rax),%eax
+  800fdf:	38 c2                	cmp    %al,%dl
+  800fe1:	74 1c                	je     800fff <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  800fe3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  800fe8:	0f b6 00             	movzbl (%rax),%eax
+  800feb:	0f b6 c8             	movzbl %al,%ecx
+  800fee:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  800ff3:	0f b6 00             	movzbl (%rax),%eax
+  800ff6:	0f b6 d0             	movzbl %al,%edx
+  800ff9:	89 c8                	mov    %ecx,%eax
+  800ffb:	29 d0                	sub    %edx,%eax
+  800ffd:	eb 1f                	jmp    80101e <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  800fff:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801005:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80100b:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801011:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801017:	75 b6                	jne    800fcf <memcmp_avx2+0x9e>
+  return 0;
+  801019:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80101e:	c9                   	leave
+  80101f:	c3                   	ret
+
+0000000000801020 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801020:	55                   	push   %rbp
+  801021:	48 89 e5             	mov    %rsp,%rbp
+  801024:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801028:	48 83 ec 60          	sub    $0x60,%rsp
+  80102c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801031:	89 f0                	mov    %esi,%eax
+  801033:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801038:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80103c:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801041:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801045:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80104a:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801050:	eb 47                	jmp    801099 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801052:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801057:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80105b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80105f:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801065:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801069:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80106d:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801071:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801076:	74 15                	je     80108d <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801078:	31 c0                	xor    %eax,%eax
+  80107a:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801080:	48 63 d0             	movslq %eax,%rdx
+  801083:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801088:	48 01 d0             	add    %rdx,%rax
+  80108b:	eb 3d                	jmp    8010ca <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80108d:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801093:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801099:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80109f:	77 b1                	ja     801052 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8010a1:	eb 0c                	jmp    8010af <memfind_avx2+0x8f>
+  8010a3:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010a9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010af:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010b5:	74 0e                	je     8010c5 <memfind_avx2+0xa5>
+  8010b7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010bc:	0f b6 00             	movzbl (%rax),%eax
+  8010bf:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8010c3:	75 de                	jne    8010a3 <memfind_avx2+0x83>
+  return s;
+  8010c5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8010ca:	c9                   	leave
+  8010cb:	c3                   	ret
+
+00000000008010cc <strlen>:
+strlen(const char *s) {
+  8010cc:	55                   	push   %rbp
+  8010cd:	48 89 e5             	mov    %rsp,%rbp
+  8010d0:	48 83 ec 40          	sub    $0x40,%rsp
+  8010d4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8010d8:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8010dc:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8010e0:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8010e7:	00 00 00 
+  8010ea:	ff d0                	call   *%rax
+  8010ec:	83 e0 02             	and    $0x2,%eax
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	74 18                	je     80110b <strlen+0x3f>
+    return strlen_avx2(s);
+  8010f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010f7:	48 89 c7             	mov    %rax,%rdi
+  8010fa:	48 b8 81 0e 80 00 00 	movabs $0x800e81,%rax
+  801101:	00 00 00 
+  801104:	ff d0                	call   *%rax
+  801106:	e9 82 00 00 00       	jmp    80118d <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80110b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80110f:	83 e0 0f             	and    $0xf,%eax
+  801112:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801115:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801118:	48 f7 d8             	neg    %rax
+  80111b:	48 89 c2             	mov    %rax,%rdx
+  80111e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801122:	48 01 d0             	add    %rdx,%rax
+  801125:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801129:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80112d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801131:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801136:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80113a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80113e:	89 c2                	mov    %eax,%edx
+  801140:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801143:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801148:	89 c1                	mov    %eax,%ecx
+  80114a:	d3 e6                	shl    %cl,%esi
+  80114c:	89 f0                	mov    %esi,%eax
+  80114e:	21 d0                	and    %edx,%eax
+  801150:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801153:	eb 1d                	jmp    801172 <strlen+0xa6>
+    p += 16;
+  801155:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80115a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80115e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801162:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801167:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80116b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80116f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801172:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801176:	74 dd                	je     801155 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801178:	31 c0                	xor    %eax,%eax
+  80117a:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80117f:	48 63 d0             	movslq %eax,%rdx
+  801182:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801186:	48 01 d0             	add    %rdx,%rax
+  801189:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80118d:	c9                   	leave
+  80118e:	c3                   	ret
+
+000000000080118f <strnlen>:
+strnlen(const char *s, size_t size) {
+  80118f:	55                   	push   %rbp
+  801190:	48 89 e5             	mov    %rsp,%rbp
+  801193:	48 83 ec 20          	sub    $0x20,%rsp
+  801197:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80119b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80119f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011a6:	eb 0e                	jmp    8011b6 <strnlen+0x27>
+    n++;
+  8011a8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011ac:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011b1:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8011b6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8011bb:	74 0b                	je     8011c8 <strnlen+0x39>
+  8011bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c1:	0f b6 00             	movzbl (%rax),%eax
+  8011c4:	84 c0                	test   %al,%al
+  8011c6:	75 e0                	jne    8011a8 <strnlen+0x19>
+  return n;
+  8011c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+
+00000000008011cd <strcpy>:
+strcpy(char *dst, const char *src) {
+  8011cd:	55                   	push   %rbp
+  8011ce:	48 89 e5             	mov    %rsp,%rbp
+  8011d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8011d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8011dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8011e5:	90                   	nop
+  8011e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011ea:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011ee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011fe:	0f b6 12             	movzbl (%rdx),%edx
+  801201:	88 10                	mov    %dl,(%rax)
+  801203:	0f b6 00             	movzbl (%rax),%eax
+  801206:	84 c0                	test   %al,%al
+  801208:	75 dc                	jne    8011e6 <strcpy+0x19>
+  return ret;
+  80120a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80120e:	c9                   	leave
+  80120f:	c3                   	ret
+
+0000000000801210 <strcat>:
+strcat(char *dst, const char *src) {
+  801210:	55                   	push   %rbp
+  801211:	48 89 e5             	mov    %rsp,%rbp
+  801214:	48 83 ec 20          	sub    $0x20,%rsp
+  801218:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80121c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801220:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801224:	48 89 c7             	mov    %rax,%rdi
+  801227:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  80122e:	00 00 00 
+  801231:	ff d0                	call   *%rax
+  801233:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801236:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801239:	48 63 d0             	movslq %eax,%rdx
+  80123c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801240:	48 01 c2             	add    %rax,%rdx
+  801243:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801247:	48 89 c6             	mov    %rax,%rsi
+  80124a:	48 89 d7             	mov    %rdx,%rdi
+  80124d:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  801254:	00 00 00 
+  801257:	ff d0                	call   *%rax
+  return dst;
+  801259:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80125d:	c9                   	leave
+  80125e:	c3                   	ret
+
+000000000080125f <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80125f:	55                   	push   %rbp
+  801260:	48 89 e5             	mov    %rsp,%rbp
+  801263:	48 83 ec 28          	sub    $0x28,%rsp
+  801267:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80126b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80126f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801273:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801277:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80127b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801282:	00 
+  801283:	eb 2a                	jmp    8012af <strncpy+0x50>
+    *dst++ = *src;
+  801285:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801289:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80128d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801291:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801295:	0f b6 12             	movzbl (%rdx),%edx
+  801298:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80129a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80129e:	0f b6 00             	movzbl (%rax),%eax
+  8012a1:	84 c0                	test   %al,%al
+  8012a3:	74 05                	je     8012aa <strncpy+0x4b>
+      src++;
+  8012a5:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8012aa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012b7:	72 cc                	jb     801285 <strncpy+0x26>
+  return ret;
+  8012b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012bd:	c9                   	leave
+  8012be:	c3                   	ret
+
+00000000008012bf <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8012bf:	55                   	push   %rbp
+  8012c0:	48 89 e5             	mov    %rsp,%rbp
+  8012c3:	48 83 ec 28          	sub    $0x28,%rsp
+  8012c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012cf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8012d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8012db:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012e0:	74 3d                	je     80131f <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8012e2:	eb 1d                	jmp    801301 <strlcpy+0x42>
+      *dst++ = *src++;
+  8012e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012e8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012fc:	0f b6 12             	movzbl (%rdx),%edx
+  8012ff:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801301:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801306:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80130b:	74 0b                	je     801318 <strlcpy+0x59>
+  80130d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801311:	0f b6 00             	movzbl (%rax),%eax
+  801314:	84 c0                	test   %al,%al
+  801316:	75 cc                	jne    8012e4 <strlcpy+0x25>
+    *dst = '\0';
+  801318:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131c:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80131f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801323:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+0000000000801329 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801329:	55                   	push   %rbp
+  80132a:	48 89 e5             	mov    %rsp,%rbp
+  80132d:	48 83 ec 30          	sub    $0x30,%rsp
+  801331:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801335:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801339:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80133d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801341:	48 89 c7             	mov    %rax,%rdi
+  801344:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  80134b:	00 00 00 
+  80134e:	ff d0                	call   *%rax
+  801350:	48 98                	cltq
+  801352:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801356:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80135a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135e:	48 89 d6             	mov    %rdx,%rsi
+  801361:	48 89 c7             	mov    %rax,%rdi
+  801364:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  80136b:	00 00 00 
+  80136e:	ff d0                	call   *%rax
+  801370:	48 98                	cltq
+  801372:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801376:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80137a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80137e:	75 10                	jne    801390 <strlcat+0x67>
+    return maxlen + srclen;
+  801380:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801384:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801388:	48 01 d0             	add    %rdx,%rax
+  80138b:	e9 86 00 00 00       	jmp    801416 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801390:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801394:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801398:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80139c:	73 2b                	jae    8013c9 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80139e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ae:	48 01 c1             	add    %rax,%rcx
+  8013b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013b5:	48 89 c6             	mov    %rax,%rsi
+  8013b8:	48 89 cf             	mov    %rcx,%rdi
+  8013bb:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  8013c2:	00 00 00 
+  8013c5:	ff d0                	call   *%rax
+  8013c7:	eb 42                	jmp    80140b <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8013c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013cd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8013d1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8013d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d9:	48 01 c1             	add    %rax,%rcx
+  8013dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013e0:	48 89 c6             	mov    %rax,%rsi
+  8013e3:	48 89 cf             	mov    %rcx,%rdi
+  8013e6:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  8013ed:	00 00 00 
+  8013f0:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8013f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8013fa:	48 01 d0             	add    %rdx,%rax
+  8013fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801405:	48 01 d0             	add    %rdx,%rax
+  801408:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80140b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80140f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801413:	48 01 d0             	add    %rdx,%rax
+}
+  801416:	c9                   	leave
+  801417:	c3                   	ret
+
+0000000000801418 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801418:	55                   	push   %rbp
+  801419:	48 89 e5             	mov    %rsp,%rbp
+  80141c:	48 83 ec 10          	sub    $0x10,%rsp
+  801420:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801424:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801428:	eb 0a                	jmp    801434 <strcmp+0x1c>
+    p++, q++;
+  80142a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80142f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801434:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801438:	0f b6 00             	movzbl (%rax),%eax
+  80143b:	84 c0                	test   %al,%al
+  80143d:	74 12                	je     801451 <strcmp+0x39>
+  80143f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801443:	0f b6 10             	movzbl (%rax),%edx
+  801446:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80144a:	0f b6 00             	movzbl (%rax),%eax
+  80144d:	38 c2                	cmp    %al,%dl
+  80144f:	74 d9                	je     80142a <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801451:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801455:	0f b6 00             	movzbl (%rax),%eax
+  801458:	0f b6 d0             	movzbl %al,%edx
+  80145b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80145f:	0f b6 00             	movzbl (%rax),%eax
+  801462:	0f b6 c0             	movzbl %al,%eax
+  801465:	29 c2                	sub    %eax,%edx
+  801467:	89 d0                	mov    %edx,%eax
+}
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+000000000080146b <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	48 83 ec 18          	sub    $0x18,%rsp
+  801473:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801477:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80147b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80147f:	eb 0f                	jmp    801490 <strncmp+0x25>
+    n--, p++, q++;
+  801481:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801486:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80148b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801490:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801495:	74 1d                	je     8014b4 <strncmp+0x49>
+  801497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80149b:	0f b6 00             	movzbl (%rax),%eax
+  80149e:	84 c0                	test   %al,%al
+  8014a0:	74 12                	je     8014b4 <strncmp+0x49>
+  8014a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a6:	0f b6 10             	movzbl (%rax),%edx
+  8014a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ad:	0f b6 00             	movzbl (%rax),%eax
+  8014b0:	38 c2                	cmp    %al,%dl
+  8014b2:	74 cd                	je     801481 <strncmp+0x16>
+  if (n == 0)
+  8014b4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014b9:	75 07                	jne    8014c2 <strncmp+0x57>
+    return 0;
+  8014bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c0:	eb 16                	jmp    8014d8 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8014c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c6:	0f b6 00             	movzbl (%rax),%eax
+  8014c9:	0f b6 d0             	movzbl %al,%edx
+  8014cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d0:	0f b6 00             	movzbl (%rax),%eax
+  8014d3:	0f b6 c0             	movzbl %al,%eax
+  8014d6:	29 c2                	sub    %eax,%edx
+}
+  8014d8:	89 d0                	mov    %edx,%eax
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <strchr>:
+strchr(const char *s, char c) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	48 83 ec 60          	sub    $0x60,%rsp
+  8014e4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8014e8:	89 f0                	mov    %esi,%eax
+  8014ea:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8014ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014f1:	83 e0 0f             	and    $0xf,%eax
+  8014f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8014f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8014fa:	48 f7 d8             	neg    %rax
+  8014fd:	48 89 c2             	mov    %rax,%rdx
+  801500:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801504:	48 01 d0             	add    %rdx,%rax
+  801507:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80150b:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80150f:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801513:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801517:	66 0f 6e c0          	movd   %eax,%xmm0
+  80151b:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80151f:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801523:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801528:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80152c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801530:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801534:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801538:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80153d:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801542:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801546:	89 c2                	mov    %eax,%edx
+  801548:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80154d:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801552:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801556:	09 c2                	or     %eax,%edx
+  801558:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80155b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801560:	89 c1                	mov    %eax,%ecx
+  801562:	d3 e6                	shl    %cl,%esi
+  801564:	89 f0                	mov    %esi,%eax
+  801566:	21 d0                	and    %edx,%eax
+  801568:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80156b:	eb 34                	jmp    8015a1 <strchr+0xc5>
+    p += 16;
+  80156d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801572:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801576:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80157a:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80157e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801583:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801588:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80158c:	89 c2                	mov    %eax,%edx
+  80158e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801593:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801598:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80159c:	09 d0                	or     %edx,%eax
+  80159e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015a5:	74 c6                	je     80156d <strchr+0x91>
+  p += __builtin_ctz(m);
+  8015a7:	31 c0                	xor    %eax,%eax
+  8015a9:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015ae:	48 98                	cltq
+  8015b0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8015b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b8:	0f b6 00             	movzbl (%rax),%eax
+  8015bb:	84 c0                	test   %al,%al
+  8015bd:	74 06                	je     8015c5 <strchr+0xe9>
+  8015bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015c3:	eb 05                	jmp    8015ca <strchr+0xee>
+  8015c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+
+00000000008015cc <strfind>:
+strfind(const char *s, char c) {
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8015d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d8:	89 f0                	mov    %esi,%eax
+  8015da:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8015dd:	eb 11                	jmp    8015f0 <strfind+0x24>
+    if (*s == c)
+  8015df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e3:	0f b6 00             	movzbl (%rax),%eax
+  8015e6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015e9:	74 12                	je     8015fd <strfind+0x31>
+  for (; *s; s++)
+  8015eb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f4:	0f b6 00             	movzbl (%rax),%eax
+  8015f7:	84 c0                	test   %al,%al
+  8015f9:	75 e4                	jne    8015df <strfind+0x13>
+  8015fb:	eb 01                	jmp    8015fe <strfind+0x32>
+      break;
+  8015fd:	90                   	nop
+  return (char *)s;
+  8015fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801602:	c9                   	leave
+  801603:	c3                   	ret
+
+0000000000801604 <memset>:
+memset(void *v, int c, size_t n) {
+  801604:	55                   	push   %rbp
+  801605:	48 89 e5             	mov    %rsp,%rbp
+  801608:	48 83 ec 38          	sub    $0x38,%rsp
+  80160c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801610:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801613:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801617:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80161b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80161f:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801624:	76 41                	jbe    801667 <memset+0x63>
+  801626:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+  801632:	83 e0 01             	and    $0x1,%eax
+  801635:	85 c0                	test   %eax,%eax
+  801637:	74 2e                	je     801667 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801639:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80163c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801640:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801644:	48 89 ce             	mov    %rcx,%rsi
+  801647:	48 89 f7             	mov    %rsi,%rdi
+  80164a:	48 89 d1             	mov    %rdx,%rcx
+  80164d:	fc                   	cld
+  80164e:	f3 aa                	rep stos %al,%es:(%rdi)
+  801650:	48 89 ca             	mov    %rcx,%rdx
+  801653:	48 89 fe             	mov    %rdi,%rsi
+  801656:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80165a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80165e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801662:	e9 a7 00 00 00       	jmp    80170e <memset+0x10a>
+  if (n >= 8) {
+  801667:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80166c:	0f 86 87 00 00 00    	jbe    8016f9 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801672:	eb 16                	jmp    80168a <memset+0x86>
+      *p++ = c;
+  801674:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801678:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80167c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801680:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801683:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801685:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80168a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168e:	83 e0 07             	and    $0x7,%eax
+  801691:	48 85 c0             	test   %rax,%rax
+  801694:	75 de                	jne    801674 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801696:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801699:	0f b6 c0             	movzbl %al,%eax
+  80169c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8016a3:	01 01 01 
+  8016a6:	48 0f af c2          	imul   %rdx,%rax
+  8016aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8016ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016b2:	48 c1 e8 03          	shr    $0x3,%rax
+  8016b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8016ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016be:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016c6:	48 89 ce             	mov    %rcx,%rsi
+  8016c9:	48 89 f7             	mov    %rsi,%rdi
+  8016cc:	48 89 d1             	mov    %rdx,%rcx
+  8016cf:	fc                   	cld
+  8016d0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8016d3:	48 89 ca             	mov    %rcx,%rdx
+  8016d6:	48 89 fe             	mov    %rdi,%rsi
+  8016d9:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8016dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8016e1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8016e6:	eb 11                	jmp    8016f9 <memset+0xf5>
+    *p++ = c;
+  8016e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ec:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016f0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8016f4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8016f7:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8016f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801701:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801705:	48 85 c0             	test   %rax,%rax
+  801708:	75 de                	jne    8016e8 <memset+0xe4>
+  return v;
+  80170a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+0000000000801710 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	48 83 ec 38          	sub    $0x38,%rsp
+  801718:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80171c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801720:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801724:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801728:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80172c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801730:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801738:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80173c:	0f 83 da 00 00 00    	jae    80181c <memmove+0x10c>
+  801742:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174a:	48 01 d0             	add    %rdx,%rax
+  80174d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801751:	0f 83 c5 00 00 00    	jae    80181c <memmove+0x10c>
+    s += n;
+  801757:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80175f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801763:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801767:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80176c:	0f 86 94 00 00 00    	jbe    801806 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801772:	eb 1c                	jmp    801790 <memmove+0x80>
+        *--d = *--s;
+  801774:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801779:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80177e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801782:	0f b6 10             	movzbl (%rax),%edx
+  801785:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801789:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80178b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801794:	83 e0 07             	and    $0x7,%eax
+  801797:	48 85 c0             	test   %rax,%rax
+  80179a:	75 d8                	jne    801774 <memmove+0x64>
+      nq = n / 8;
+  80179c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017a0:	48 c1 e8 03          	shr    $0x3,%rax
+  8017a4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8017a8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8017ad:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8017b2:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8017b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8017bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c3:	48 89 cf             	mov    %rcx,%rdi
+  8017c6:	48 89 d6             	mov    %rdx,%rsi
+  8017c9:	48 89 c1             	mov    %rax,%rcx
+  8017cc:	fd                   	std
+  8017cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8017d0:	fc                   	cld
+  8017d1:	48 89 c8             	mov    %rcx,%rax
+  8017d4:	48 89 f2             	mov    %rsi,%rdx
+  8017d7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8017db:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8017e3:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8017e8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8017ed:	eb 17                	jmp    801806 <memmove+0xf6>
+      *--d = *--s;
+  8017ef:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8017f4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8017f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fd:	0f b6 10             	movzbl (%rax),%edx
+  801800:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801804:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801806:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80180a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80180e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801812:	48 85 c0             	test   %rax,%rax
+  801815:	75 d8                	jne    8017ef <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801817:	e9 f4 00 00 00       	jmp    801910 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80181c:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801821:	76 46                	jbe    801869 <memmove+0x159>
+  801823:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	83 e0 01             	and    $0x1,%eax
+  801832:	85 c0                	test   %eax,%eax
+  801834:	74 33                	je     801869 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801836:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80183a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80183e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801842:	48 89 cf             	mov    %rcx,%rdi
+  801845:	48 89 d6             	mov    %rdx,%rsi
+  801848:	48 89 c1             	mov    %rax,%rcx
+  80184b:	fc                   	cld
+  80184c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80184e:	48 89 c8             	mov    %rcx,%rax
+  801851:	48 89 f2             	mov    %rsi,%rdx
+  801854:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801858:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80185c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801860:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801864:	e9 ab 00 00 00       	jmp    801914 <memmove+0x204>
+    if (n >= 8) {
+  801869:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80186e:	0f 86 8b 00 00 00    	jbe    8018ff <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801874:	eb 22                	jmp    801898 <memmove+0x188>
+        *d++ = *s++;
+  801876:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80187a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80187e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801882:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801886:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80188a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80188e:	0f b6 12             	movzbl (%rdx),%edx
+  801891:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801893:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801898:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80189c:	83 e0 07             	and    $0x7,%eax
+  80189f:	48 85 c0             	test   %rax,%rax
+  8018a2:	75 d2                	jne    801876 <memmove+0x166>
+      nq = n / 8;
+  8018a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a8:	48 c1 e8 03          	shr    $0x3,%rax
+  8018ac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8018b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bc:	48 89 cf             	mov    %rcx,%rdi
+  8018bf:	48 89 d6             	mov    %rdx,%rsi
+  8018c2:	48 89 c1             	mov    %rax,%rcx
+  8018c5:	fc                   	cld
+  8018c6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018c9:	48 89 c8             	mov    %rcx,%rax
+  8018cc:	48 89 f2             	mov    %rsi,%rdx
+  8018cf:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018d3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018d7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8018db:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8018e0:	eb 1d                	jmp    8018ff <memmove+0x1ef>
+      *d++ = *s++;
+  8018e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8018ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018f6:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8018fa:	0f b6 12             	movzbl (%rdx),%edx
+  8018fd:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801903:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801907:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80190b:	48 85 c0             	test   %rax,%rax
+  80190e:	75 d2                	jne    8018e2 <memmove+0x1d2>
+  return dst;
+  801910:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801914:	c9                   	leave
+  801915:	c3                   	ret
+
+0000000000801916 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	48 83 ec 18          	sub    $0x18,%rsp
+  80191e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801922:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801926:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80192a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80192e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801932:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801936:	48 89 ce             	mov    %rcx,%rsi
+  801939:	48 89 c7             	mov    %rax,%rdi
+  80193c:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  801943:	00 00 00 
+  801946:	ff d0                	call   *%rax
+}
+  801948:	c9                   	leave
+  801949:	c3                   	ret
+
+000000000080194a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	48 83 ec 40          	sub    $0x40,%rsp
+  801952:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801956:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80195a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801966:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80196e:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801973:	0f 86 a7 00 00 00    	jbe    801a20 <memcmp+0xd6>
+  801979:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  801980:	00 00 00 
+  801983:	ff d0                	call   *%rax
+  801985:	83 e0 02             	and    $0x2,%eax
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	0f 84 90 00 00 00    	je     801a20 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801990:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801994:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199c:	48 89 ce             	mov    %rcx,%rsi
+  80199f:	48 89 c7             	mov    %rax,%rdi
+  8019a2:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  8019a9:	00 00 00 
+  8019ac:	ff d0                	call   *%rax
+  8019ae:	e9 c2 00 00 00       	jmp    801a75 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8019b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019bb:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8019bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c3:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8019c7:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8019cb:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8019d2:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8019d9:	74 36                	je     801a11 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8019db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019de:	f7 d0                	not    %eax
+  8019e0:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8019e4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8019e7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8019ea:	48 63 d0             	movslq %eax,%rdx
+  8019ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f1:	48 01 d0             	add    %rdx,%rax
+  8019f4:	0f b6 00             	movzbl (%rax),%eax
+  8019f7:	0f b6 c0             	movzbl %al,%eax
+  8019fa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8019fd:	48 63 ca             	movslq %edx,%rcx
+  801a00:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a04:	48 01 ca             	add    %rcx,%rdx
+  801a07:	0f b6 12             	movzbl (%rdx),%edx
+  801a0a:	0f b6 d2             	movzbl %dl,%edx
+  801a0d:	29 d0                	sub    %edx,%eax
+  801a0f:	eb 64                	jmp    801a75 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801a11:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801a16:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801a1b:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801a20:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801a25:	77 8c                	ja     8019b3 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801a27:	eb 36                	jmp    801a5f <memcmp+0x115>
+    if (*s1 != *s2)
+  801a29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2d:	0f b6 10             	movzbl (%rax),%edx
+  801a30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a34:	0f b6 00             	movzbl (%rax),%eax
+  801a37:	38 c2                	cmp    %al,%dl
+  801a39:	74 1a                	je     801a55 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801a3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3f:	0f b6 00             	movzbl (%rax),%eax
+  801a42:	0f b6 c8             	movzbl %al,%ecx
+  801a45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a49:	0f b6 00             	movzbl (%rax),%eax
+  801a4c:	0f b6 d0             	movzbl %al,%edx
+  801a4f:	89 c8                	mov    %ecx,%eax
+  801a51:	29 d0                	sub    %edx,%eax
+  801a53:	eb 20                	jmp    801a75 <memcmp+0x12b>
+    s1++, s2++;
+  801a55:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a5a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801a5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a63:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a67:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a6b:	48 85 c0             	test   %rax,%rax
+  801a6e:	75 b9                	jne    801a29 <memcmp+0xdf>
+  }
+
+  return 0;
+  801a70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a75:	c9                   	leave
+  801a76:	c3                   	ret
+
+0000000000801a77 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801a77:	55                   	push   %rbp
+  801a78:	48 89 e5             	mov    %rsp,%rbp
+  801a7b:	48 83 ec 50          	sub    $0x50,%rsp
+  801a7f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801a83:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801a86:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801a8a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a8e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801a92:	48 01 d0             	add    %rdx,%rax
+  801a95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801a99:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801a9c:	66 0f 6e c0          	movd   %eax,%xmm0
+  801aa0:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801aa4:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801aa8:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801aad:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ab1:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ab6:	76 73                	jbe    801b2b <memfind+0xb4>
+  801ab8:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	83 e0 02             	and    $0x2,%eax
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	74 60                	je     801b2b <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801acb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ace:	0f b6 c8             	movzbl %al,%ecx
+  801ad1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ad5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ad9:	89 ce                	mov    %ecx,%esi
+  801adb:	48 89 c7             	mov    %rax,%rdi
+  801ade:	48 b8 20 10 80 00 00 	movabs $0x801020,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+  801aea:	eb 6c                	jmp    801b58 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801aec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801af0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801af4:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801af8:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801afd:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b01:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b05:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801b08:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801b0c:	74 13                	je     801b21 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801b0e:	31 c0                	xor    %eax,%eax
+  801b10:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801b15:	48 63 d0             	movslq %eax,%rdx
+  801b18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1c:	48 01 d0             	add    %rdx,%rax
+  801b1f:	eb 37                	jmp    801b58 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801b21:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801b26:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801b2b:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801b30:	77 ba                	ja     801aec <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801b32:	eb 13                	jmp    801b47 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801b34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b38:	0f b6 00             	movzbl (%rax),%eax
+  801b3b:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801b3e:	38 d0                	cmp    %dl,%al
+  801b40:	74 11                	je     801b53 <memfind+0xdc>
+  for (; s < ends; s++)
+  801b42:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801b47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b4b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b4f:	72 e3                	jb     801b34 <memfind+0xbd>
+  801b51:	eb 01                	jmp    801b54 <memfind+0xdd>
+      break;
+  801b53:	90                   	nop
+  return (void *)s;
+  801b54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801b58:	c9                   	leave
+  801b59:	c3                   	ret
+
+0000000000801b5a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	48 83 ec 38          	sub    $0x38,%rsp
+  801b62:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b66:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b6a:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801b6d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801b74:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b7b:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801b7c:	eb 05                	jmp    801b83 <strtol+0x29>
+    s++;
+  801b7e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801b83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b87:	0f b6 00             	movzbl (%rax),%eax
+  801b8a:	3c 20                	cmp    $0x20,%al
+  801b8c:	74 f0                	je     801b7e <strtol+0x24>
+  801b8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b92:	0f b6 00             	movzbl (%rax),%eax
+  801b95:	3c 09                	cmp    $0x9,%al
+  801b97:	74 e5                	je     801b7e <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801b99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9d:	0f b6 00             	movzbl (%rax),%eax
+  801ba0:	3c 2b                	cmp    $0x2b,%al
+  801ba2:	75 07                	jne    801bab <strtol+0x51>
+    s++;
+  801ba4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ba9:	eb 17                	jmp    801bc2 <strtol+0x68>
+  else if (*s == '-')
+  801bab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801baf:	0f b6 00             	movzbl (%rax),%eax
+  801bb2:	3c 2d                	cmp    $0x2d,%al
+  801bb4:	75 0c                	jne    801bc2 <strtol+0x68>
+    s++, neg = 1;
+  801bb6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bbb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bc2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bc6:	74 06                	je     801bce <strtol+0x74>
+  801bc8:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bcc:	75 28                	jne    801bf6 <strtol+0x9c>
+  801bce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd2:	0f b6 00             	movzbl (%rax),%eax
+  801bd5:	3c 30                	cmp    $0x30,%al
+  801bd7:	75 1d                	jne    801bf6 <strtol+0x9c>
+  801bd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdd:	48 83 c0 01          	add    $0x1,%rax
+  801be1:	0f b6 00             	movzbl (%rax),%eax
+  801be4:	3c 78                	cmp    $0x78,%al
+  801be6:	75 0e                	jne    801bf6 <strtol+0x9c>
+    s += 2, base = 16;
+  801be8:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bed:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bf4:	eb 2c                	jmp    801c22 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801bf6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bfa:	75 19                	jne    801c15 <strtol+0xbb>
+  801bfc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c00:	0f b6 00             	movzbl (%rax),%eax
+  801c03:	3c 30                	cmp    $0x30,%al
+  801c05:	75 0e                	jne    801c15 <strtol+0xbb>
+    s++, base = 8;
+  801c07:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c0c:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c13:	eb 0d                	jmp    801c22 <strtol+0xc8>
+  else if (base == 0)
+  801c15:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c19:	75 07                	jne    801c22 <strtol+0xc8>
+    base = 10;
+  801c1b:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801c22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c26:	0f b6 00             	movzbl (%rax),%eax
+  801c29:	3c 2f                	cmp    $0x2f,%al
+  801c2b:	7e 1d                	jle    801c4a <strtol+0xf0>
+  801c2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c31:	0f b6 00             	movzbl (%rax),%eax
+  801c34:	3c 39                	cmp    $0x39,%al
+  801c36:	7f 12                	jg     801c4a <strtol+0xf0>
+      dig = *s - '0';
+  801c38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c3c:	0f b6 00             	movzbl (%rax),%eax
+  801c3f:	0f be c0             	movsbl %al,%eax
+  801c42:	83 e8 30             	sub    $0x30,%eax
+  801c45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c48:	eb 4e                	jmp    801c98 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801c4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c4e:	0f b6 00             	movzbl (%rax),%eax
+  801c51:	3c 60                	cmp    $0x60,%al
+  801c53:	7e 1d                	jle    801c72 <strtol+0x118>
+  801c55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c59:	0f b6 00             	movzbl (%rax),%eax
+  801c5c:	3c 7a                	cmp    $0x7a,%al
+  801c5e:	7f 12                	jg     801c72 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801c60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c64:	0f b6 00             	movzbl (%rax),%eax
+  801c67:	0f be c0             	movsbl %al,%eax
+  801c6a:	83 e8 57             	sub    $0x57,%eax
+  801c6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c70:	eb 26                	jmp    801c98 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801c72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c76:	0f b6 00             	movzbl (%rax),%eax
+  801c79:	3c 40                	cmp    $0x40,%al
+  801c7b:	7e 47                	jle    801cc4 <strtol+0x16a>
+  801c7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c81:	0f b6 00             	movzbl (%rax),%eax
+  801c84:	3c 5a                	cmp    $0x5a,%al
+  801c86:	7f 3c                	jg     801cc4 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801c88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8c:	0f b6 00             	movzbl (%rax),%eax
+  801c8f:	0f be c0             	movsbl %al,%eax
+  801c92:	83 e8 37             	sub    $0x37,%eax
+  801c95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801c98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c9b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c9e:	7d 23                	jge    801cc3 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ca0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ca5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ca8:	48 98                	cltq
+  801caa:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801caf:	48 89 c2             	mov    %rax,%rdx
+  801cb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cb5:	48 98                	cltq
+  801cb7:	48 01 d0             	add    %rdx,%rax
+  801cba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801cbe:	e9 5f ff ff ff       	jmp    801c22 <strtol+0xc8>
+      break;
+  801cc3:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801cc4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cc9:	74 0b                	je     801cd6 <strtol+0x17c>
+    *endptr = (char *)s;
+  801ccb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ccf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cd3:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801cd6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cda:	74 09                	je     801ce5 <strtol+0x18b>
+  801cdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce0:	48 f7 d8             	neg    %rax
+  801ce3:	eb 04                	jmp    801ce9 <strtol+0x18f>
+  801ce5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ce9:	c9                   	leave
+  801cea:	c3                   	ret
+
+0000000000801ceb <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801ceb:	55                   	push   %rbp
+  801cec:	48 89 e5             	mov    %rsp,%rbp
+  801cef:	53                   	push   %rbx
+  801cf0:	48 83 ec 48          	sub    $0x48,%rsp
+  801cf4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cf8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cfc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d00:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801d04:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801d08:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801d0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d10:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d14:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d18:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801d1c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801d20:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d24:	4c 89 c3             	mov    %r8,%rbx
+  801d27:	cd 30                	int    $0x30
+  801d29:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801d2d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d32:	74 46                	je     801d7a <syscall+0x8f>
+  801d34:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d39:	7e 3f                	jle    801d7a <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801d3b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d43:	49 89 d0             	mov    %rdx,%r8
+  801d46:	48 89 c1             	mov    %rax,%rcx
+  801d49:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801d50:	00 00 00 
+  801d53:	48 89 c2             	mov    %rax,%rdx
+  801d56:	be 22 00 00 00       	mov    $0x22,%esi
+  801d5b:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801d62:	00 00 00 
+  801d65:	48 89 c7             	mov    %rax,%rdi
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6d:	49 b9 2b 4b 80 00 00 	movabs $0x804b2b,%r9
+  801d74:	00 00 00 
+  801d77:	41 ff d1             	call   *%r9
+
+  return ret;
+  801d7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+0000000000801d84 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	48 83 ec 10          	sub    $0x10,%rsp
+  801d8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d94:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d9c:	48 83 ec 08          	sub    $0x8,%rsp
+  801da0:	6a 00                	push   $0x0
+  801da2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801da8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dae:	48 89 d1             	mov    %rdx,%rcx
+  801db1:	48 89 c2             	mov    %rax,%rdx
+  801db4:	be 00 00 00 00       	mov    $0x0,%esi
+  801db9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbe:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801dc5:	00 00 00 
+  801dc8:	ff d0                	call   *%rax
+  801dca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dce:	90                   	nop
+  801dcf:	c9                   	leave
+  801dd0:	c3                   	ret
+
+0000000000801dd1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801dd1:	55                   	push   %rbp
+  801dd2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801dd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd9:	6a 00                	push   $0x0
+  801ddb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801de1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df1:	be 00 00 00 00       	mov    $0x0,%esi
+  801df6:	bf 01 00 00 00       	mov    $0x1,%edi
+  801dfb:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801e02:	00 00 00 
+  801e05:	ff d0                	call   *%rax
+  801e07:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+
+0000000000801e0d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801e0d:	55                   	push   %rbp
+  801e0e:	48 89 e5             	mov    %rsp,%rbp
+  801e11:	48 83 ec 10          	sub    $0x10,%rsp
+  801e15:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e1b:	48 98                	cltq
+  801e1d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e21:	6a 00                	push   $0x0
+  801e23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e34:	48 89 c2             	mov    %rax,%rdx
+  801e37:	be 01 00 00 00       	mov    $0x1,%esi
+  801e3c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e41:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801e48:	00 00 00 
+  801e4b:	ff d0                	call   *%rax
+  801e4d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+
+0000000000801e53 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801e53:	55                   	push   %rbp
+  801e54:	48 89 e5             	mov    %rsp,%rbp
+  801e57:	48 83 ec 10          	sub    $0x10,%rsp
+  801e5b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801e5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801e61:	48 98                	cltq
+  801e63:	48 83 ec 08          	sub    $0x8,%rsp
+  801e67:	6a 00                	push   $0x0
+  801e69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e7a:	48 89 c2             	mov    %rax,%rdx
+  801e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e82:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e87:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801e8e:	00 00 00 
+  801e91:	ff d0                	call   *%rax
+  801e93:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e97:	90                   	nop
+  801e98:	c9                   	leave
+  801e99:	c3                   	ret
+
+0000000000801e9a <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+  801e9e:	48 83 ec 20          	sub    $0x20,%rsp
+  801ea2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801ea5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801ea9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801eac:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801eaf:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eb4:	cd 30                	int    $0x30
+  801eb6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801eba:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801ebe:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801ec3:	7e 3d                	jle    801f02 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801ec5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec9:	49 89 c0             	mov    %rax,%r8
+  801ecc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801ed1:	48 b8 08 55 80 00 00 	movabs $0x805508,%rax
+  801ed8:	00 00 00 
+  801edb:	48 89 c2             	mov    %rax,%rdx
+  801ede:	be 49 00 00 00       	mov    $0x49,%esi
+  801ee3:	48 b8 27 55 80 00 00 	movabs $0x805527,%rax
+  801eea:	00 00 00 
+  801eed:	48 89 c7             	mov    %rax,%rdi
+  801ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef5:	49 b9 2b 4b 80 00 00 	movabs $0x804b2b,%r9
+  801efc:	00 00 00 
+  801eff:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801f02:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f07:	75 13                	jne    801f1c <sys_env_wait+0x82>
+  801f09:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801f0e:	74 0c                	je     801f1c <sys_env_wait+0x82>
+    *status = st;
+  801f10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f14:	89 c2                	mov    %eax,%edx
+  801f16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f1a:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801f1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+0000000000801f22 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801f22:	55                   	push   %rbp
+  801f23:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f26:	48 83 ec 08          	sub    $0x8,%rsp
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f42:	be 00 00 00 00       	mov    $0x0,%esi
+  801f47:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f4c:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801f53:	00 00 00 
+  801f56:	ff d0                	call   *%rax
+  801f58:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+0000000000801f5e <sys_yield>:
+
+void
+sys_yield(void) {
+  801f5e:	55                   	push   %rbp
+  801f5f:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f62:	48 83 ec 08          	sub    $0x8,%rsp
+  801f66:	6a 00                	push   $0x0
+  801f68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f83:	bf 0d 00 00 00       	mov    $0xd,%edi
+  801f88:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+  801f94:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f98:	90                   	nop
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+
+0000000000801f9b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	48 83 ec 20          	sub    $0x20,%rsp
+  801fa3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801fa6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801faa:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  801fad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fb0:	48 63 c8             	movslq %eax,%rcx
+  801fb3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fb7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fba:	48 98                	cltq
+  801fbc:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc0:	6a 00                	push   $0x0
+  801fc2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fc8:	49 89 c8             	mov    %rcx,%r8
+  801fcb:	48 89 d1             	mov    %rdx,%rcx
+  801fce:	48 89 c2             	mov    %rax,%rdx
+  801fd1:	be 01 00 00 00       	mov    $0x1,%esi
+  801fd6:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fdb:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  801fe2:	00 00 00 
+  801fe5:	ff d0                	call   *%rax
+  801fe7:	48 83 c4 10          	add    $0x10,%rsp
+  801feb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  801fee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801ff1:	c9                   	leave
+  801ff2:	c3                   	ret
+
+0000000000801ff3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  801ff3:	55                   	push   %rbp
+  801ff4:	48 89 e5             	mov    %rsp,%rbp
+  801ff7:	48 83 ec 20          	sub    $0x20,%rsp
+  801ffb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ffe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802002:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802005:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802009:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80200d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802010:	48 63 c8             	movslq %eax,%rcx
+  802013:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802017:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80201a:	48 63 f0             	movslq %eax,%rsi
+  80201d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802021:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802024:	48 98                	cltq
+  802026:	48 83 ec 08          	sub    $0x8,%rsp
+  80202a:	51                   	push   %rcx
+  80202b:	49 89 f9             	mov    %rdi,%r9
+  80202e:	49 89 f0             	mov    %rsi,%r8
+  802031:	48 89 d1             	mov    %rdx,%rcx
+  802034:	48 89 c2             	mov    %rax,%rdx
+  802037:	be 01 00 00 00       	mov    $0x1,%esi
+  80203c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802041:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802051:	c9                   	leave
+  802052:	c3                   	ret
+
+0000000000802053 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802053:	55                   	push   %rbp
+  802054:	48 89 e5             	mov    %rsp,%rbp
+  802057:	48 83 ec 10          	sub    $0x10,%rsp
+  80205b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80205e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802062:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802066:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802069:	48 98                	cltq
+  80206b:	48 83 ec 08          	sub    $0x8,%rsp
+  80206f:	6a 00                	push   $0x0
+  802071:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802077:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80207d:	48 89 d1             	mov    %rdx,%rcx
+  802080:	48 89 c2             	mov    %rax,%rdx
+  802083:	be 01 00 00 00       	mov    $0x1,%esi
+  802088:	bf 08 00 00 00       	mov    $0x8,%edi
+  80208d:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+  802099:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+000000000080209f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80209f:	55                   	push   %rbp
+  8020a0:	48 89 e5             	mov    %rsp,%rbp
+  8020a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020aa:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020ad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020b0:	48 63 d0             	movslq %eax,%rdx
+  8020b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b6:	48 98                	cltq
+  8020b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8020bc:	6a 00                	push   $0x0
+  8020be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020ca:	48 89 d1             	mov    %rdx,%rcx
+  8020cd:	48 89 c2             	mov    %rax,%rdx
+  8020d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8020d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020da:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+  8020e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ea:	c9                   	leave
+  8020eb:	c3                   	ret
+
+00000000008020ec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020ec:	55                   	push   %rbp
+  8020ed:	48 89 e5             	mov    %rsp,%rbp
+  8020f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8020fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802102:	48 98                	cltq
+  802104:	48 83 ec 08          	sub    $0x8,%rsp
+  802108:	6a 00                	push   $0x0
+  80210a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802116:	48 89 d1             	mov    %rdx,%rcx
+  802119:	48 89 c2             	mov    %rax,%rdx
+  80211c:	be 01 00 00 00       	mov    $0x1,%esi
+  802121:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802126:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+  802132:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+0000000000802138 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	48 83 ec 10          	sub    $0x10,%rsp
+  802140:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802143:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802147:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80214b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80214e:	48 98                	cltq
+  802150:	48 83 ec 08          	sub    $0x8,%rsp
+  802154:	6a 00                	push   $0x0
+  802156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80215c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802162:	48 89 d1             	mov    %rdx,%rcx
+  802165:	48 89 c2             	mov    %rax,%rdx
+  802168:	be 01 00 00 00       	mov    $0x1,%esi
+  80216d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802172:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+
+0000000000802184 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	48 83 ec 20          	sub    $0x20,%rsp
+  80218c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80218f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802193:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802197:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80219a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80219d:	48 63 f0             	movslq %eax,%rsi
+  8021a0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021ab:	48 98                	cltq
+  8021ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b1:	6a 00                	push   $0x0
+  8021b3:	49 89 f1             	mov    %rsi,%r9
+  8021b6:	49 89 c8             	mov    %rcx,%r8
+  8021b9:	48 89 d1             	mov    %rdx,%rcx
+  8021bc:	48 89 c2             	mov    %rax,%rdx
+  8021bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8021c9:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+  8021d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d9:	c9                   	leave
+  8021da:	c3                   	ret
+
+00000000008021db <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8021db:	55                   	push   %rbp
+  8021dc:	48 89 e5             	mov    %rsp,%rbp
+  8021df:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8021e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ef:	6a 00                	push   $0x0
+  8021f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802202:	48 89 c2             	mov    %rax,%rdx
+  802205:	be 01 00 00 00       	mov    $0x1,%esi
+  80220a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80220f:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802216:	00 00 00 
+  802219:	ff d0                	call   *%rax
+  80221b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+
+0000000000802221 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802221:	55                   	push   %rbp
+  802222:	48 89 e5             	mov    %rsp,%rbp
+  802225:	48 83 ec 10          	sub    $0x10,%rsp
+  802229:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80222d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802231:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802235:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802239:	48 83 ec 08          	sub    $0x8,%rsp
+  80223d:	6a 00                	push   $0x0
+  80223f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80224b:	48 89 d1             	mov    %rdx,%rcx
+  80224e:	48 89 c2             	mov    %rax,%rdx
+  802251:	be 01 00 00 00       	mov    $0x1,%esi
+  802256:	bf 10 00 00 00       	mov    $0x10,%edi
+  80225b:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+  802267:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+
+000000000080226d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80226d:	55                   	push   %rbp
+  80226e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802271:	48 83 ec 08          	sub    $0x8,%rsp
+  802275:	6a 00                	push   $0x0
+  802277:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802283:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802288:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228d:	be 00 00 00 00       	mov    $0x0,%esi
+  802292:	bf 11 00 00 00       	mov    $0x11,%edi
+  802297:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80229e:	00 00 00 
+  8022a1:	ff d0                	call   *%rax
+  8022a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a7:	c9                   	leave
+  8022a8:	c3                   	ret
+
+00000000008022a9 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8022a9:	55                   	push   %rbp
+  8022aa:	48 89 e5             	mov    %rsp,%rbp
+  8022ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8022b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c5:	6a 00                	push   $0x0
+  8022c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d3:	48 89 d1             	mov    %rdx,%rcx
+  8022d6:	48 89 c2             	mov    %rax,%rdx
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	bf 12 00 00 00       	mov    $0x12,%edi
+  8022e3:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f3:	c9                   	leave
+  8022f4:	c3                   	ret
+
+00000000008022f5 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8022f5:	55                   	push   %rbp
+  8022f6:	48 89 e5             	mov    %rsp,%rbp
+  8022f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8022fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802301:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802305:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802308:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80230b:	48 63 c8             	movslq %eax,%rcx
+  80230e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802312:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802316:	48 83 ec 08          	sub    $0x8,%rsp
+  80231a:	6a 00                	push   $0x0
+  80231c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802322:	49 89 c8             	mov    %rcx,%r8
+  802325:	48 89 d1             	mov    %rdx,%rcx
+  802328:	48 89 c2             	mov    %rax,%rdx
+  80232b:	be 00 00 00 00       	mov    $0x0,%esi
+  802330:	bf 13 00 00 00       	mov    $0x13,%edi
+  802335:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+  802341:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802345:	c9                   	leave
+  802346:	c3                   	ret
+
+0000000000802347 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	48 83 ec 20          	sub    $0x20,%rsp
+  80234f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802353:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802356:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80235a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80235e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802361:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802365:	48 83 ec 08          	sub    $0x8,%rsp
+  802369:	6a 00                	push   $0x0
+  80236b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802371:	49 89 c8             	mov    %rcx,%r8
+  802374:	48 89 d1             	mov    %rdx,%rcx
+  802377:	48 89 c2             	mov    %rax,%rdx
+  80237a:	be 00 00 00 00       	mov    $0x0,%esi
+  80237f:	bf 14 00 00 00       	mov    $0x14,%edi
+  802384:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80238b:	00 00 00 
+  80238e:	ff d0                	call   *%rax
+  802390:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802394:	c9                   	leave
+  802395:	c3                   	ret
+
+0000000000802396 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802396:	55                   	push   %rbp
+  802397:	48 89 e5             	mov    %rsp,%rbp
+  80239a:	48 83 ec 10          	sub    $0x10,%rsp
+  80239e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8023a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8023a8:	48 63 d0             	movslq %eax,%rdx
+  8023ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023af:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b3:	6a 00                	push   $0x0
+  8023b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c1:	48 89 d1             	mov    %rdx,%rcx
+  8023c4:	48 89 c2             	mov    %rax,%rdx
+  8023c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cc:	bf 15 00 00 00       	mov    $0x15,%edi
+  8023d1:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+00000000008023e3 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8023e3:	55                   	push   %rbp
+  8023e4:	48 89 e5             	mov    %rsp,%rbp
+  8023e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8023eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023ef:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8023f2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8023f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8023f9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023fd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802400:	48 63 c8             	movslq %eax,%rcx
+  802403:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802406:	48 63 d0             	movslq %eax,%rdx
+  802409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80240d:	48 83 ec 08          	sub    $0x8,%rsp
+  802411:	6a 00                	push   $0x0
+  802413:	49 89 f1             	mov    %rsi,%r9
+  802416:	49 89 c8             	mov    %rcx,%r8
+  802419:	48 89 d1             	mov    %rdx,%rcx
+  80241c:	48 89 c2             	mov    %rax,%rdx
+  80241f:	be 00 00 00 00       	mov    $0x0,%esi
+  802424:	bf 16 00 00 00       	mov    $0x16,%edi
+  802429:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+  802435:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	48 83 ec 30          	sub    $0x30,%rsp
+  802443:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802447:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80244b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80244f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802453:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802457:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80245b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80245f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802463:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246b:	48 83 ec 08          	sub    $0x8,%rsp
+  80246f:	51                   	push   %rcx
+  802470:	49 89 f9             	mov    %rdi,%r9
+  802473:	49 89 f0             	mov    %rsi,%r8
+  802476:	48 89 d1             	mov    %rdx,%rcx
+  802479:	48 89 c2             	mov    %rax,%rdx
+  80247c:	be 00 00 00 00       	mov    $0x0,%esi
+  802481:	bf 17 00 00 00       	mov    $0x17,%edi
+  802486:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+  802492:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802496:	c9                   	leave
+  802497:	c3                   	ret
+
+0000000000802498 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802498:	55                   	push   %rbp
+  802499:	48 89 e5             	mov    %rsp,%rbp
+  80249c:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8024a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024a6:	48 98                	cltq
+  8024a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ac:	6a 00                	push   $0x0
+  8024ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024bf:	48 89 c2             	mov    %rax,%rdx
+  8024c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c7:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024cc:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024dc:	90                   	nop
+  8024dd:	c9                   	leave
+  8024de:	c3                   	ret
+
+00000000008024df <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8024df:	55                   	push   %rbp
+  8024e0:	48 89 e5             	mov    %rsp,%rbp
+  8024e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8024e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024ee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024f2:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8024f5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024f8:	48 63 f0             	movslq %eax,%rsi
+  8024fb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8024ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802503:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802506:	48 98                	cltq
+  802508:	48 83 ec 08          	sub    $0x8,%rsp
+  80250c:	6a 00                	push   $0x0
+  80250e:	49 89 f1             	mov    %rsi,%r9
+  802511:	49 89 c8             	mov    %rcx,%r8
+  802514:	48 89 d1             	mov    %rdx,%rcx
+  802517:	48 89 c2             	mov    %rax,%rdx
+  80251a:	be 01 00 00 00       	mov    $0x1,%esi
+  80251f:	bf 19 00 00 00       	mov    $0x19,%edi
+  802524:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+  802530:	48 83 c4 10          	add    $0x10,%rsp
+  802534:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802537:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+
+000000000080253c <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80253c:	55                   	push   %rbp
+  80253d:	48 89 e5             	mov    %rsp,%rbp
+  802540:	48 83 ec 20          	sub    $0x20,%rsp
+  802544:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802548:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80254c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80254f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802552:	48 63 c8             	movslq %eax,%rcx
+  802555:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802559:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255d:	48 83 ec 08          	sub    $0x8,%rsp
+  802561:	6a 00                	push   $0x0
+  802563:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802569:	49 89 c8             	mov    %rcx,%r8
+  80256c:	48 89 d1             	mov    %rdx,%rcx
+  80256f:	48 89 c2             	mov    %rax,%rdx
+  802572:	be 01 00 00 00       	mov    $0x1,%esi
+  802577:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80257c:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+  802588:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80258c:	c9                   	leave
+  80258d:	c3                   	ret
+
+000000000080258e <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80258e:	55                   	push   %rbp
+  80258f:	48 89 e5             	mov    %rsp,%rbp
+  802592:	48 83 ec 20          	sub    $0x20,%rsp
+  802596:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80259a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80259e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8025a2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b2:	6a 00                	push   $0x0
+  8025b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ba:	49 89 c8             	mov    %rcx,%r8
+  8025bd:	48 89 d1             	mov    %rdx,%rcx
+  8025c0:	48 89 c2             	mov    %rax,%rdx
+  8025c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c8:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8025cd:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+
+00000000008025df <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8025e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025eb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025ef:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8025f2:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8025f6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8025fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025fd:	48 63 c8             	movslq %eax,%rcx
+  802600:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802608:	48 83 ec 08          	sub    $0x8,%rsp
+  80260c:	6a 00                	push   $0x0
+  80260e:	49 89 f1             	mov    %rsi,%r9
+  802611:	49 89 c8             	mov    %rcx,%r8
+  802614:	48 89 d1             	mov    %rdx,%rcx
+  802617:	48 89 c2             	mov    %rax,%rdx
+  80261a:	be 01 00 00 00       	mov    $0x1,%esi
+  80261f:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802624:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  80262b:	00 00 00 
+  80262e:	ff d0                	call   *%rax
+  802630:	48 83 c4 10          	add    $0x10,%rsp
+  802634:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802637:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+000000000080263c <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	48 83 ec 10          	sub    $0x10,%rsp
+  802644:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802647:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80264a:	48 98                	cltq
+  80264c:	48 83 ec 08          	sub    $0x8,%rsp
+  802650:	6a 00                	push   $0x0
+  802652:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802658:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802663:	48 89 c2             	mov    %rax,%rdx
+  802666:	be 01 00 00 00       	mov    $0x1,%esi
+  80266b:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802670:	48 b8 eb 1c 80 00 00 	movabs $0x801ceb,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+  80267c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802680:	c9                   	leave
+  802681:	c3                   	ret
+
+0000000000802682 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802682:	55                   	push   %rbp
+  802683:	48 89 e5             	mov    %rsp,%rbp
+  802686:	48 83 ec 08          	sub    $0x8,%rsp
+  80268a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80268e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802692:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802699:	ff ff ff 
+  80269c:	48 01 d0             	add    %rdx,%rax
+  80269f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+00000000008026a5 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8026a5:	55                   	push   %rbp
+  8026a6:	48 89 e5             	mov    %rsp,%rbp
+  8026a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8026b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b5:	48 89 c7             	mov    %rax,%rdi
+  8026b8:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8026bf:	00 00 00 
+  8026c2:	ff d0                	call   *%rax
+  8026c4:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8026ca:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8026ce:	c9                   	leave
+  8026cf:	c3                   	ret
+
+00000000008026d0 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+  8026d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8026dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026e3:	e9 ae 00 00 00       	jmp    802796 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8026e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026eb:	c1 e0 0c             	shl    $0xc,%eax
+  8026ee:	48 98                	cltq
+  8026f0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8026f5:	48 01 d0             	add    %rdx,%rax
+  8026f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8026fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802700:	48 c1 e8 27          	shr    $0x27,%rax
+  802704:	48 89 c2             	mov    %rax,%rdx
+  802707:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80270e:	01 00 00 
+  802711:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802715:	83 e0 01             	and    $0x1,%eax
+  802718:	48 85 c0             	test   %rax,%rax
+  80271b:	74 63                	je     802780 <fd_alloc+0xb0>
+  80271d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802721:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802725:	48 89 c2             	mov    %rax,%rdx
+  802728:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80272f:	01 00 00 
+  802732:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802736:	83 e0 01             	and    $0x1,%eax
+  802739:	48 85 c0             	test   %rax,%rax
+  80273c:	74 42                	je     802780 <fd_alloc+0xb0>
+  80273e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802742:	48 c1 e8 15          	shr    $0x15,%rax
+  802746:	48 89 c2             	mov    %rax,%rdx
+  802749:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802750:	01 00 00 
+  802753:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802757:	83 e0 01             	and    $0x1,%eax
+  80275a:	48 85 c0             	test   %rax,%rax
+  80275d:	74 21                	je     802780 <fd_alloc+0xb0>
+  80275f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802763:	48 c1 e8 0c          	shr    $0xc,%rax
+  802767:	48 89 c2             	mov    %rax,%rdx
+  80276a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802771:	01 00 00 
+  802774:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802778:	83 e0 01             	and    $0x1,%eax
+  80277b:	48 85 c0             	test   %rax,%rax
+  80277e:	75 12                	jne    802792 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802784:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802788:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802790:	eb 1e                	jmp    8027b0 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802792:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802796:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80279a:	0f 8e 48 ff ff ff    	jle    8026e8 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8027a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027a4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8027ab:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8027b0:	c9                   	leave
+  8027b1:	c3                   	ret
+
+00000000008027b2 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8027b2:	55                   	push   %rbp
+  8027b3:	48 89 e5             	mov    %rsp,%rbp
+  8027b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8027ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8027bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8027c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027c5:	78 06                	js     8027cd <fd_lookup+0x1b>
+  8027c7:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8027cb:	7e 0a                	jle    8027d7 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8027cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d2:	e9 af 00 00 00       	jmp    802886 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8027d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027da:	c1 e0 0c             	shl    $0xc,%eax
+  8027dd:	48 98                	cltq
+  8027df:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027e4:	48 01 d0             	add    %rdx,%rax
+  8027e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8027eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ef:	48 c1 e8 27          	shr    $0x27,%rax
+  8027f3:	48 89 c2             	mov    %rax,%rdx
+  8027f6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027fd:	01 00 00 
+  802800:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802804:	83 e0 01             	and    $0x1,%eax
+  802807:	48 85 c0             	test   %rax,%rax
+  80280a:	74 63                	je     80286f <fd_lookup+0xbd>
+  80280c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802810:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802814:	48 89 c2             	mov    %rax,%rdx
+  802817:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80281e:	01 00 00 
+  802821:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802825:	83 e0 01             	and    $0x1,%eax
+  802828:	48 85 c0             	test   %rax,%rax
+  80282b:	74 42                	je     80286f <fd_lookup+0xbd>
+  80282d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802831:	48 c1 e8 15          	shr    $0x15,%rax
+  802835:	48 89 c2             	mov    %rax,%rdx
+  802838:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80283f:	01 00 00 
+  802842:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802846:	83 e0 01             	and    $0x1,%eax
+  802849:	48 85 c0             	test   %rax,%rax
+  80284c:	74 21                	je     80286f <fd_lookup+0xbd>
+  80284e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802852:	48 c1 e8 0c          	shr    $0xc,%rax
+  802856:	48 89 c2             	mov    %rax,%rdx
+  802859:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802860:	01 00 00 
+  802863:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802867:	83 e0 01             	and    $0x1,%eax
+  80286a:	48 85 c0             	test   %rax,%rax
+  80286d:	75 07                	jne    802876 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80286f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802874:	eb 10                	jmp    802886 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802876:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80287a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80287e:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+0000000000802888 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	48 83 ec 30          	sub    $0x30,%rsp
+  802890:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802894:	89 f0                	mov    %esi,%eax
+  802896:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802899:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80289d:	48 89 c7             	mov    %rax,%rdi
+  8028a0:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+  8028ac:	89 c2                	mov    %eax,%edx
+  8028ae:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8028b2:	48 89 c6             	mov    %rax,%rsi
+  8028b5:	89 d7                	mov    %edx,%edi
+  8028b7:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+  8028c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8028c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8028ca:	78 0a                	js     8028d6 <fd_close+0x4e>
+  8028cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d0:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8028d4:	74 12                	je     8028e8 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8028d6:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8028da:	74 05                	je     8028e1 <fd_close+0x59>
+  8028dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028df:	eb 70                	jmp    802951 <fd_close+0xc9>
+  8028e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e6:	eb 69                	jmp    802951 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8028e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028ec:	8b 00                	mov    (%rax),%eax
+  8028ee:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8028f2:	48 89 d6             	mov    %rdx,%rsi
+  8028f5:	89 c7                	mov    %eax,%edi
+  8028f7:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  8028fe:	00 00 00 
+  802901:	ff d0                	call   *%rax
+  802903:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802906:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80290a:	78 2a                	js     802936 <fd_close+0xae>
+    if (dev->dev_close)
+  80290c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802910:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802914:	48 85 c0             	test   %rax,%rax
+  802917:	74 16                	je     80292f <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802919:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802921:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802925:	48 89 c7             	mov    %rax,%rdi
+  802928:	ff d2                	call   *%rdx
+  80292a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80292d:	eb 07                	jmp    802936 <fd_close+0xae>
+    else
+      r = 0;
+  80292f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802936:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80293a:	48 89 c6             	mov    %rax,%rsi
+  80293d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802942:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  802949:	00 00 00 
+  80294c:	ff d0                	call   *%rax
+  return r;
+  80294e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+0000000000802953 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+  802957:	48 83 ec 20          	sub    $0x20,%rsp
+  80295b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80295e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802962:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802969:	eb 3f                	jmp    8029aa <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80296b:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802972:	00 00 00 
+  802975:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802978:	48 98                	cltq
+  80297a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80297e:	8b 00                	mov    (%rax),%eax
+  802980:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802983:	75 21                	jne    8029a6 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802985:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80298c:	00 00 00 
+  80298f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802992:	48 98                	cltq
+  802994:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802998:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80299c:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80299f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a4:	eb 7f                	jmp    802a25 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8029a6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029aa:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8029b1:	00 00 00 
+  8029b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b7:	48 98                	cltq
+  8029b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029bd:	48 85 c0             	test   %rax,%rax
+  8029c0:	75 a9                	jne    80296b <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8029c2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8029c9:	00 00 00 
+  8029cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8029cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8029d4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8029db:	00 00 00 
+  8029de:	48 98                	cltq
+  8029e0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8029e7:	48 01 d0             	add    %rdx,%rax
+  8029ea:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8029f0:	8b 00                	mov    (%rax),%eax
+  8029f2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029f5:	89 c6                	mov    %eax,%esi
+  8029f7:	48 b8 38 55 80 00 00 	movabs $0x805538,%rax
+  8029fe:	00 00 00 
+  802a01:	48 89 c7             	mov    %rax,%rdi
+  802a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a09:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  802a10:	00 00 00 
+  802a13:	ff d1                	call   *%rcx
+  *dev = 0;
+  802a15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a19:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802a20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802a25:	c9                   	leave
+  802a26:	c3                   	ret
+
+0000000000802a27 <close>:
+
+int
+close(int fdnum) {
+  802a27:	55                   	push   %rbp
+  802a28:	48 89 e5             	mov    %rsp,%rbp
+  802a2b:	48 83 ec 20          	sub    $0x20,%rsp
+  802a2f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a32:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802a36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a39:	48 89 d6             	mov    %rdx,%rsi
+  802a3c:	89 c7                	mov    %eax,%edi
+  802a3e:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+  802a4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a4d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a51:	79 05                	jns    802a58 <close+0x31>
+    return r;
+  802a53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a56:	eb 18                	jmp    802a70 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802a58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a5c:	be 01 00 00 00       	mov    $0x1,%esi
+  802a61:	48 89 c7             	mov    %rax,%rdi
+  802a64:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  802a6b:	00 00 00 
+  802a6e:	ff d0                	call   *%rax
+}
+  802a70:	c9                   	leave
+  802a71:	c3                   	ret
+
+0000000000802a72 <close_all>:
+
+void
+close_all(void) {
+  802a72:	55                   	push   %rbp
+  802a73:	48 89 e5             	mov    %rsp,%rbp
+  802a76:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802a7a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a81:	eb 15                	jmp    802a98 <close_all+0x26>
+    close(i);
+  802a83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a86:	89 c7                	mov    %eax,%edi
+  802a88:	48 b8 27 2a 80 00 00 	movabs $0x802a27,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802a94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a98:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a9c:	7e e5                	jle    802a83 <close_all+0x11>
+}
+  802a9e:	90                   	nop
+  802a9f:	90                   	nop
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+0000000000802aa2 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802aa2:	55                   	push   %rbp
+  802aa3:	48 89 e5             	mov    %rsp,%rbp
+  802aa6:	48 83 ec 40          	sub    $0x40,%rsp
+  802aaa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802aad:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802ab0:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802ab4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ab7:	48 89 d6             	mov    %rdx,%rsi
+  802aba:	89 c7                	mov    %eax,%edi
+  802abc:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+  802ac8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802acb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802acf:	79 08                	jns    802ad9 <dup+0x37>
+    return r;
+  802ad1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ad4:	e9 33 02 00 00       	jmp    802d0c <dup+0x26a>
+  close(newfdnum);
+  802ad9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802adc:	89 c7                	mov    %eax,%edi
+  802ade:	48 b8 27 2a 80 00 00 	movabs $0x802a27,%rax
+  802ae5:	00 00 00 
+  802ae8:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802aea:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802aed:	c1 e0 0c             	shl    $0xc,%eax
+  802af0:	48 98                	cltq
+  802af2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802af7:	48 01 d0             	add    %rdx,%rax
+  802afa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802afe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b02:	48 89 c7             	mov    %rax,%rdi
+  802b05:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  802b0c:	00 00 00 
+  802b0f:	ff d0                	call   *%rax
+  802b11:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802b15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b19:	48 89 c7             	mov    %rax,%rdi
+  802b1c:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+  802b28:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802b2c:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802b33:	00 
+  802b34:	e9 19 01 00 00       	jmp    802c52 <dup+0x1b0>
+    off -= PGSIZE;
+  802b39:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802b40:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802b41:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b49:	48 01 d0             	add    %rdx,%rax
+  802b4c:	48 c1 e8 27          	shr    $0x27,%rax
+  802b50:	48 89 c2             	mov    %rax,%rdx
+  802b53:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802b5a:	01 00 00 
+  802b5d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b61:	83 e0 01             	and    $0x1,%eax
+  802b64:	48 85 c0             	test   %rax,%rax
+  802b67:	0f 84 e5 00 00 00    	je     802c52 <dup+0x1b0>
+  802b6d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b75:	48 01 d0             	add    %rdx,%rax
+  802b78:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b7c:	48 89 c2             	mov    %rax,%rdx
+  802b7f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802b86:	01 00 00 
+  802b89:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b8d:	83 e0 01             	and    $0x1,%eax
+  802b90:	48 85 c0             	test   %rax,%rax
+  802b93:	0f 84 b9 00 00 00    	je     802c52 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802b99:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ba1:	48 01 d0             	add    %rdx,%rax
+  802ba4:	48 c1 e8 15          	shr    $0x15,%rax
+  802ba8:	48 89 c2             	mov    %rax,%rdx
+  802bab:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802bb2:	01 00 00 
+  802bb5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bb9:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802bbc:	48 85 c0             	test   %rax,%rax
+  802bbf:	0f 84 8d 00 00 00    	je     802c52 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802bc5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bcd:	48 01 d0             	add    %rdx,%rax
+  802bd0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bd4:	48 89 c2             	mov    %rax,%rdx
+  802bd7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bde:	01 00 00 
+  802be1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be5:	83 e0 01             	and    $0x1,%eax
+  802be8:	48 85 c0             	test   %rax,%rax
+  802beb:	74 65                	je     802c52 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802bed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bf5:	48 01 d0             	add    %rdx,%rax
+  802bf8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bfc:	48 89 c2             	mov    %rax,%rdx
+  802bff:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c06:	01 00 00 
+  802c09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c0d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c12:	89 c6                	mov    %eax,%esi
+  802c14:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c1c:	48 01 c2             	add    %rax,%rdx
+  802c1f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c27:	48 01 c8             	add    %rcx,%rax
+  802c2a:	41 89 f0             	mov    %esi,%r8d
+  802c2d:	48 89 d1             	mov    %rdx,%rcx
+  802c30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c35:	48 89 c6             	mov    %rax,%rsi
+  802c38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3d:	48 b8 f3 1f 80 00 00 	movabs $0x801ff3,%rax
+  802c44:	00 00 00 
+  802c47:	ff d0                	call   *%rax
+  802c49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c50:	78 60                	js     802cb2 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802c52:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802c57:	0f 85 dc fe ff ff    	jne    802b39 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802c5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c61:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c65:	48 89 c2             	mov    %rax,%rdx
+  802c68:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c6f:	01 00 00 
+  802c72:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c76:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c7b:	89 c1                	mov    %eax,%ecx
+  802c7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c85:	41 89 c8             	mov    %ecx,%r8d
+  802c88:	48 89 d1             	mov    %rdx,%rcx
+  802c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c90:	48 89 c6             	mov    %rax,%rsi
+  802c93:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c98:	48 b8 f3 1f 80 00 00 	movabs $0x801ff3,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+  802ca4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cab:	78 08                	js     802cb5 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802cad:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cb0:	eb 5a                	jmp    802d0c <dup+0x26a>
+        goto err;
+  802cb2:	90                   	nop
+  802cb3:	eb 01                	jmp    802cb6 <dup+0x214>
+    goto err;
+  802cb5:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802cb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cba:	48 89 c6             	mov    %rax,%rsi
+  802cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc2:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cce:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802cd5:	00 
+  802cd6:	eb 27                	jmp    802cff <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802cd8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce0:	48 01 d0             	add    %rdx,%rax
+  802ce3:	48 89 c6             	mov    %rax,%rsi
+  802ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ceb:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802cf7:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802cfe:	00 
+  802cff:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802d06:	00 
+  802d07:	76 cf                	jbe    802cd8 <dup+0x236>
+  return r;
+  802d09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d0c:	c9                   	leave
+  802d0d:	c3                   	ret
+
+0000000000802d0e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802d0e:	55                   	push   %rbp
+  802d0f:	48 89 e5             	mov    %rsp,%rbp
+  802d12:	48 83 ec 40          	sub    $0x40,%rsp
+  802d16:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d19:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d1d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d21:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802d25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d28:	48 89 d6             	mov    %rdx,%rsi
+  802d2b:	89 c7                	mov    %eax,%edi
+  802d2d:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802d34:	00 00 00 
+  802d37:	ff d0                	call   *%rax
+  802d39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d40:	78 24                	js     802d66 <read+0x58>
+  802d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d46:	8b 00                	mov    (%rax),%eax
+  802d48:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d4c:	48 89 d6             	mov    %rdx,%rsi
+  802d4f:	89 c7                	mov    %eax,%edi
+  802d51:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d60:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d64:	79 0a                	jns    802d70 <read+0x62>
+    return r;
+  802d66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d69:	48 98                	cltq
+  802d6b:	e9 9e 00 00 00       	jmp    802e0e <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d74:	8b 40 08             	mov    0x8(%rax),%eax
+  802d77:	83 e0 03             	and    $0x3,%eax
+  802d7a:	83 f8 01             	cmp    $0x1,%eax
+  802d7d:	75 5c                	jne    802ddb <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d7f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802d86:	00 00 00 
+  802d89:	8b 40 04             	mov    0x4(%rax),%eax
+  802d8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d91:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802d98:	00 00 00 
+  802d9b:	48 98                	cltq
+  802d9d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802da4:	48 01 d0             	add    %rdx,%rax
+  802da7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802dad:	8b 00                	mov    (%rax),%eax
+  802daf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db2:	89 c6                	mov    %eax,%esi
+  802db4:	48 b8 57 55 80 00 00 	movabs $0x805557,%rax
+  802dbb:	00 00 00 
+  802dbe:	48 89 c7             	mov    %rax,%rdi
+  802dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc6:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  802dcd:	00 00 00 
+  802dd0:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802dd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802dd9:	eb 33                	jmp    802e0e <read+0x100>
+  }
+  if (!dev->dev_read)
+  802ddb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ddf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802de3:	48 85 c0             	test   %rax,%rax
+  802de6:	75 09                	jne    802df1 <read+0xe3>
+    return -E_NOT_SUPP;
+  802de8:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802def:	eb 1d                	jmp    802e0e <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802df1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df5:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802df9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dfd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802e01:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e05:	48 89 ce             	mov    %rcx,%rsi
+  802e08:	48 89 c7             	mov    %rax,%rdi
+  802e0b:	41 ff d0             	call   *%r8
+}
+  802e0e:	c9                   	leave
+  802e0f:	c3                   	ret
+
+0000000000802e10 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802e10:	55                   	push   %rbp
+  802e11:	48 89 e5             	mov    %rsp,%rbp
+  802e14:	48 83 ec 30          	sub    $0x30,%rsp
+  802e18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e1b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e1f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802e23:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e2a:	eb 49                	jmp    802e75 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802e2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e2f:	48 98                	cltq
+  802e31:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e35:	48 29 c2             	sub    %rax,%rdx
+  802e38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e3b:	48 63 c8             	movslq %eax,%rcx
+  802e3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e42:	48 01 c1             	add    %rax,%rcx
+  802e45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e48:	48 89 ce             	mov    %rcx,%rsi
+  802e4b:	89 c7                	mov    %eax,%edi
+  802e4d:	48 b8 0e 2d 80 00 00 	movabs $0x802d0e,%rax
+  802e54:	00 00 00 
+  802e57:	ff d0                	call   *%rax
+  802e59:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802e5c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e60:	79 07                	jns    802e69 <readn+0x59>
+      return m;
+  802e62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e65:	48 98                	cltq
+  802e67:	eb 1f                	jmp    802e88 <readn+0x78>
+    if (m == 0)
+  802e69:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802e6d:	74 13                	je     802e82 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802e6f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e72:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e78:	48 98                	cltq
+  802e7a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802e7e:	72 ac                	jb     802e2c <readn+0x1c>
+  802e80:	eb 01                	jmp    802e83 <readn+0x73>
+      break;
+  802e82:	90                   	nop
+  }
+  return tot;
+  802e83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e86:	48 98                	cltq
+}
+  802e88:	c9                   	leave
+  802e89:	c3                   	ret
+
+0000000000802e8a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802e8a:	55                   	push   %rbp
+  802e8b:	48 89 e5             	mov    %rsp,%rbp
+  802e8e:	48 83 ec 40          	sub    $0x40,%rsp
+  802e92:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e95:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e99:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e9d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ea1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ea4:	48 89 d6             	mov    %rdx,%rsi
+  802ea7:	89 c7                	mov    %eax,%edi
+  802ea9:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802eb0:	00 00 00 
+  802eb3:	ff d0                	call   *%rax
+  802eb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802eb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ebc:	78 24                	js     802ee2 <write+0x58>
+  802ebe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ec2:	8b 00                	mov    (%rax),%eax
+  802ec4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ec8:	48 89 d6             	mov    %rdx,%rsi
+  802ecb:	89 c7                	mov    %eax,%edi
+  802ecd:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802ed4:	00 00 00 
+  802ed7:	ff d0                	call   *%rax
+  802ed9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802edc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ee0:	79 0a                	jns    802eec <write+0x62>
+    return r;
+  802ee2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee5:	48 98                	cltq
+  802ee7:	e9 9d 00 00 00       	jmp    802f89 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802eec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef0:	8b 40 08             	mov    0x8(%rax),%eax
+  802ef3:	83 e0 03             	and    $0x3,%eax
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	75 5c                	jne    802f56 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802efa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f01:	00 00 00 
+  802f04:	8b 40 04             	mov    0x4(%rax),%eax
+  802f07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f13:	00 00 00 
+  802f16:	48 98                	cltq
+  802f18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f1f:	48 01 d0             	add    %rdx,%rax
+  802f22:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f28:	8b 00                	mov    (%rax),%eax
+  802f2a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f2d:	89 c6                	mov    %eax,%esi
+  802f2f:	48 b8 73 55 80 00 00 	movabs $0x805573,%rax
+  802f36:	00 00 00 
+  802f39:	48 89 c7             	mov    %rax,%rdi
+  802f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f41:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  802f48:	00 00 00 
+  802f4b:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f4d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f54:	eb 33                	jmp    802f89 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  802f56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f5a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f5e:	48 85 c0             	test   %rax,%rax
+  802f61:	75 09                	jne    802f6c <write+0xe2>
+    return -E_NOT_SUPP;
+  802f63:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f6a:	eb 1d                	jmp    802f89 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  802f6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f70:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f78:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f7c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802f80:	48 89 ce             	mov    %rcx,%rsi
+  802f83:	48 89 c7             	mov    %rax,%rdi
+  802f86:	41 ff d0             	call   *%r8
+}
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+
+0000000000802f8b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802f8b:	55                   	push   %rbp
+  802f8c:	48 89 e5             	mov    %rsp,%rbp
+  802f8f:	48 83 ec 18          	sub    $0x18,%rsp
+  802f93:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f96:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f99:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802f9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fa0:	48 89 d6             	mov    %rdx,%rsi
+  802fa3:	89 c7                	mov    %eax,%edi
+  802fa5:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+  802fb1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fb8:	79 05                	jns    802fbf <seek+0x34>
+    return r;
+  802fba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fbd:	eb 0f                	jmp    802fce <seek+0x43>
+  fd->fd_offset = offset;
+  802fbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802fc6:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  802fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fce:	c9                   	leave
+  802fcf:	c3                   	ret
+
+0000000000802fd0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802fd0:	55                   	push   %rbp
+  802fd1:	48 89 e5             	mov    %rsp,%rbp
+  802fd4:	48 83 ec 30          	sub    $0x30,%rsp
+  802fd8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fdb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fde:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802fe2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fe5:	48 89 d6             	mov    %rdx,%rsi
+  802fe8:	89 c7                	mov    %eax,%edi
+  802fea:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ffd:	78 24                	js     803023 <ftruncate+0x53>
+  802fff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803003:	8b 00                	mov    (%rax),%eax
+  803005:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803009:	48 89 d6             	mov    %rdx,%rsi
+  80300c:	89 c7                	mov    %eax,%edi
+  80300e:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+  80301a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80301d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803021:	79 08                	jns    80302b <ftruncate+0x5b>
+    return r;
+  803023:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803026:	e9 92 00 00 00       	jmp    8030bd <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80302b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80302f:	8b 40 08             	mov    0x8(%rax),%eax
+  803032:	83 e0 03             	and    $0x3,%eax
+  803035:	85 c0                	test   %eax,%eax
+  803037:	75 5a                	jne    803093 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803039:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803040:	00 00 00 
+  803043:	8b 40 04             	mov    0x4(%rax),%eax
+  803046:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80304b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803052:	00 00 00 
+  803055:	48 98                	cltq
+  803057:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80305e:	48 01 d0             	add    %rdx,%rax
+  803061:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803067:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803069:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80306c:	89 c6                	mov    %eax,%esi
+  80306e:	48 b8 90 55 80 00 00 	movabs $0x805590,%rax
+  803075:	00 00 00 
+  803078:	48 89 c7             	mov    %rax,%rdi
+  80307b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803080:	48 b9 1d 02 80 00 00 	movabs $0x80021d,%rcx
+  803087:	00 00 00 
+  80308a:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80308c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803091:	eb 2a                	jmp    8030bd <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803093:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803097:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80309b:	48 85 c0             	test   %rax,%rax
+  80309e:	75 07                	jne    8030a7 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8030a0:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8030a5:	eb 16                	jmp    8030bd <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8030a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ab:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8030af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030b3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030b6:	89 d6                	mov    %edx,%esi
+  8030b8:	48 89 c7             	mov    %rax,%rdi
+  8030bb:	ff d1                	call   *%rcx
+}
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+
+00000000008030bf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8030bf:	55                   	push   %rbp
+  8030c0:	48 89 e5             	mov    %rsp,%rbp
+  8030c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8030c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030ca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030ce:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030d5:	48 89 d6             	mov    %rdx,%rsi
+  8030d8:	89 c7                	mov    %eax,%edi
+  8030da:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+  8030e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030ed:	78 24                	js     803113 <fstat+0x54>
+  8030ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f3:	8b 00                	mov    (%rax),%eax
+  8030f5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030f9:	48 89 d6             	mov    %rdx,%rsi
+  8030fc:	89 c7                	mov    %eax,%edi
+  8030fe:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  803105:	00 00 00 
+  803108:	ff d0                	call   *%rax
+  80310a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80310d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803111:	79 05                	jns    803118 <fstat+0x59>
+    return r;
+  803113:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803116:	eb 5e                	jmp    803176 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803118:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80311c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803120:	48 85 c0             	test   %rax,%rax
+  803123:	75 07                	jne    80312c <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803125:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80312a:	eb 4a                	jmp    803176 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80312c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803130:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803133:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803137:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80313e:	00 00 00 
+  stat->st_isdir   = 0;
+  803141:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803145:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80314c:	00 00 00 
+  stat->st_dev     = dev;
+  80314f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803153:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803157:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80315e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803162:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80316a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80316e:	48 89 d6             	mov    %rdx,%rsi
+  803171:	48 89 c7             	mov    %rax,%rdi
+  803174:	ff d1                	call   *%rcx
+}
+  803176:	c9                   	leave
+  803177:	c3                   	ret
+
+0000000000803178 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803178:	55                   	push   %rbp
+  803179:	48 89 e5             	mov    %rsp,%rbp
+  80317c:	48 83 ec 10          	sub    $0x10,%rsp
+  803180:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803184:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803188:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80318c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803192:	83 f8 20             	cmp    $0x20,%eax
+  803195:	75 07                	jne    80319e <pollwait_key+0x26>
+    return -E_INVAL;
+  803197:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80319c:	eb 5f                	jmp    8031fd <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80319e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031a2:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8031a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ac:	48 63 d2             	movslq %edx,%rdx
+  8031af:	48 c1 e2 04          	shl    $0x4,%rdx
+  8031b3:	48 01 c2             	add    %rax,%rdx
+  8031b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031ba:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8031bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c1:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8031c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031cb:	8b 00                	mov    (%rax),%eax
+  8031cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d1:	48 63 c9             	movslq %ecx,%rcx
+  8031d4:	48 c1 e1 04          	shl    $0x4,%rcx
+  8031d8:	48 01 ca             	add    %rcx,%rdx
+  8031db:	48 83 c2 08          	add    $0x8,%rdx
+  8031df:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8031e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031e5:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8031eb:	8d 50 01             	lea    0x1(%rax),%edx
+  8031ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f2:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8031f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031fd:	c9                   	leave
+  8031fe:	c3                   	ret
+
+00000000008031ff <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8031ff:	55                   	push   %rbp
+  803200:	48 89 e5             	mov    %rsp,%rbp
+  803203:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80320a:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803211:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803217:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80321e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803225:	00 
+  int i, r, ready, ipc = 0;
+  803226:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80322d:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803234:	00 
+  803235:	74 45                	je     80327c <poll+0x7d>
+  803237:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80323e:	ff 
+  80323f:	74 3b                	je     80327c <poll+0x7d>
+    now      = vsys_clock_ns();
+  803241:	48 b8 3a 47 80 00 00 	movabs $0x80473a,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+  80324d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803251:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803255:	48 f7 d0             	not    %rax
+  803258:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80325f:	73 10                	jae    803271 <poll+0x72>
+  803261:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803265:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80326c:	48 01 d0             	add    %rdx,%rax
+  80326f:	eb 07                	jmp    803278 <poll+0x79>
+  803271:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803278:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80327c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803283:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80328a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803291:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803298:	e9 46 02 00 00       	jmp    8034e3 <poll+0x2e4>
+      fds[i].revents = 0;
+  80329d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032a0:	48 63 d0             	movslq %eax,%rdx
+  8032a3:	48 89 d0             	mov    %rdx,%rax
+  8032a6:	48 01 c0             	add    %rax,%rax
+  8032a9:	48 01 d0             	add    %rdx,%rax
+  8032ac:	48 c1 e0 02          	shl    $0x2,%rax
+  8032b0:	48 89 c2             	mov    %rax,%rdx
+  8032b3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032ba:	48 01 d0             	add    %rdx,%rax
+  8032bd:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8032c4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032c7:	48 63 d0             	movslq %eax,%rdx
+  8032ca:	48 89 d0             	mov    %rdx,%rax
+  8032cd:	48 01 c0             	add    %rax,%rax
+  8032d0:	48 01 d0             	add    %rdx,%rax
+  8032d3:	48 c1 e0 02          	shl    $0x2,%rax
+  8032d7:	48 89 c2             	mov    %rax,%rdx
+  8032da:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8032e1:	48 01 d0             	add    %rdx,%rax
+  8032e4:	8b 00                	mov    (%rax),%eax
+  8032e6:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8032e9:	75 62                	jne    80334d <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8032eb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032ee:	48 63 d0             	movslq %eax,%rdx
+  8032f1:	48 89 d0             	mov    %rdx,%rax
+  8032f4:	48 01 c0             	add    %rax,%rax
+  8032f7:	48 01 d0             	add    %rdx,%rax
+  8032fa:	48 c1 e0 02          	shl    $0x2,%rax
+  8032fe:	48 89 c2             	mov    %rax,%rdx
+  803301:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803308:	48 01 d0             	add    %rdx,%rax
+  80330b:	8b 40 04             	mov    0x4(%rax),%eax
+  80330e:	83 e0 01             	and    $0x1,%eax
+  803311:	85 c0                	test   %eax,%eax
+  803313:	0f 84 9b 01 00 00    	je     8034b4 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803319:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80331c:	48 63 d0             	movslq %eax,%rdx
+  80331f:	48 89 d0             	mov    %rdx,%rax
+  803322:	48 01 c0             	add    %rax,%rax
+  803325:	48 01 d0             	add    %rdx,%rax
+  803328:	48 c1 e0 02          	shl    $0x2,%rax
+  80332c:	48 89 c2             	mov    %rax,%rdx
+  80332f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803336:	48 01 c2             	add    %rax,%rdx
+  803339:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80333c:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80333f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803342:	83 c8 04             	or     $0x4,%eax
+  803345:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803348:	e9 67 01 00 00       	jmp    8034b4 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80334d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803350:	48 63 d0             	movslq %eax,%rdx
+  803353:	48 89 d0             	mov    %rdx,%rax
+  803356:	48 01 c0             	add    %rax,%rax
+  803359:	48 01 d0             	add    %rdx,%rax
+  80335c:	48 c1 e0 02          	shl    $0x2,%rax
+  803360:	48 89 c2             	mov    %rax,%rdx
+  803363:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80336a:	48 01 d0             	add    %rdx,%rax
+  80336d:	8b 00                	mov    (%rax),%eax
+  80336f:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803376:	48 89 d6             	mov    %rdx,%rsi
+  803379:	89 c7                	mov    %eax,%edi
+  80337b:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+  803387:	85 c0                	test   %eax,%eax
+  803389:	78 25                	js     8033b0 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80338b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803392:	8b 00                	mov    (%rax),%eax
+  803394:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80339b:	48 89 d6             	mov    %rdx,%rsi
+  80339e:	89 c7                	mov    %eax,%edi
+  8033a0:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	79 2c                	jns    8033dc <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8033b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033b3:	48 63 d0             	movslq %eax,%rdx
+  8033b6:	48 89 d0             	mov    %rdx,%rax
+  8033b9:	48 01 c0             	add    %rax,%rax
+  8033bc:	48 01 d0             	add    %rdx,%rax
+  8033bf:	48 c1 e0 02          	shl    $0x2,%rax
+  8033c3:	48 89 c2             	mov    %rax,%rdx
+  8033c6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033cd:	48 01 d0             	add    %rdx,%rax
+  8033d0:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8033d7:	e9 d8 00 00 00       	jmp    8034b4 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8033dc:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033e3:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8033e7:	48 85 c0             	test   %rax,%rax
+  8033ea:	74 7d                	je     803469 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8033ec:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8033f3:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8033f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033fa:	48 63 d0             	movslq %eax,%rdx
+  8033fd:	48 89 d0             	mov    %rdx,%rax
+  803400:	48 01 c0             	add    %rax,%rax
+  803403:	48 01 d0             	add    %rdx,%rax
+  803406:	48 c1 e0 02          	shl    $0x2,%rax
+  80340a:	48 89 c2             	mov    %rax,%rdx
+  80340d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803414:	48 01 d0             	add    %rdx,%rax
+  803417:	8b 48 04             	mov    0x4(%rax),%ecx
+  80341a:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803421:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803428:	89 ce                	mov    %ecx,%esi
+  80342a:	48 89 c7             	mov    %rax,%rdi
+  80342d:	41 ff d0             	call   *%r8
+  803430:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803433:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803437:	79 08                	jns    803441 <poll+0x242>
+          return r;
+  803439:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80343c:	e9 45 01 00 00       	jmp    803586 <poll+0x387>
+        fds[i].revents = r;
+  803441:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803444:	48 63 d0             	movslq %eax,%rdx
+  803447:	48 89 d0             	mov    %rdx,%rax
+  80344a:	48 01 c0             	add    %rax,%rax
+  80344d:	48 01 d0             	add    %rdx,%rax
+  803450:	48 c1 e0 02          	shl    $0x2,%rax
+  803454:	48 89 c2             	mov    %rax,%rdx
+  803457:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80345e:	48 01 c2             	add    %rax,%rdx
+  803461:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803464:	89 42 08             	mov    %eax,0x8(%rdx)
+  803467:	eb 4b                	jmp    8034b4 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803469:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80346c:	48 63 d0             	movslq %eax,%rdx
+  80346f:	48 89 d0             	mov    %rdx,%rax
+  803472:	48 01 c0             	add    %rax,%rax
+  803475:	48 01 d0             	add    %rdx,%rax
+  803478:	48 c1 e0 02          	shl    $0x2,%rax
+  80347c:	48 89 c2             	mov    %rax,%rdx
+  80347f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803486:	48 01 d0             	add    %rdx,%rax
+  803489:	8b 48 04             	mov    0x4(%rax),%ecx
+  80348c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80348f:	48 63 d0             	movslq %eax,%rdx
+  803492:	48 89 d0             	mov    %rdx,%rax
+  803495:	48 01 c0             	add    %rax,%rax
+  803498:	48 01 d0             	add    %rdx,%rax
+  80349b:	48 c1 e0 02          	shl    $0x2,%rax
+  80349f:	48 89 c2             	mov    %rax,%rdx
+  8034a2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034a9:	48 01 d0             	add    %rdx,%rax
+  8034ac:	83 e1 03             	and    $0x3,%ecx
+  8034af:	89 ca                	mov    %ecx,%edx
+  8034b1:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8034b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034b7:	48 63 d0             	movslq %eax,%rdx
+  8034ba:	48 89 d0             	mov    %rdx,%rax
+  8034bd:	48 01 c0             	add    %rax,%rax
+  8034c0:	48 01 d0             	add    %rdx,%rax
+  8034c3:	48 c1 e0 02          	shl    $0x2,%rax
+  8034c7:	48 89 c2             	mov    %rax,%rdx
+  8034ca:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034d1:	48 01 d0             	add    %rdx,%rax
+  8034d4:	8b 40 08             	mov    0x8(%rax),%eax
+  8034d7:	85 c0                	test   %eax,%eax
+  8034d9:	74 04                	je     8034df <poll+0x2e0>
+        ready++;
+  8034db:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034df:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8034e3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034e6:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8034ec:	0f 8c ab fd ff ff    	jl     80329d <poll+0x9e>
+    }
+    if (ready)
+  8034f2:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8034f6:	74 08                	je     803500 <poll+0x301>
+      return ready;
+  8034f8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8034fb:	e9 86 00 00 00       	jmp    803586 <poll+0x387>
+
+    if (deadline) {
+  803500:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803505:	74 30                	je     803537 <poll+0x338>
+      now     = vsys_clock_ns();
+  803507:	48 b8 3a 47 80 00 00 	movabs $0x80473a,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803517:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80351b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80351f:	73 0a                	jae    80352b <poll+0x32c>
+  803521:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803525:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803529:	eb 05                	jmp    803530 <poll+0x331>
+  80352b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803530:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803537:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80353a:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80353d:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803544:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80354b:	48 89 c7             	mov    %rax,%rdi
+  80354e:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  803555:	00 00 00 
+  803558:	ff d0                	call   *%rax
+  80355a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80355d:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803561:	75 07                	jne    80356a <poll+0x36b>
+      return 0;
+  803563:	b8 00 00 00 00       	mov    $0x0,%eax
+  803568:	eb 1c                	jmp    803586 <poll+0x387>
+    if (r < 0)
+  80356a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80356e:	79 05                	jns    803575 <poll+0x376>
+      return r;
+  803570:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803573:	eb 11                	jmp    803586 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803575:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803578:	c1 f8 02             	sar    $0x2,%eax
+  80357b:	83 e0 01             	and    $0x1,%eax
+  80357e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803581:	e9 f6 fc ff ff       	jmp    80327c <poll+0x7d>
+  }
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+0000000000803588 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	48 83 ec 20          	sub    $0x20,%rsp
+  803590:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803594:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803598:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80359c:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a1:	48 89 c7             	mov    %rax,%rdi
+  8035a4:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  8035ab:	00 00 00 
+  8035ae:	ff d0                	call   *%rax
+  8035b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035b7:	79 05                	jns    8035be <stat+0x36>
+    return fd;
+  8035b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035bc:	eb 2f                	jmp    8035ed <stat+0x65>
+  r = fstat(fd, stat);
+  8035be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c5:	48 89 d6             	mov    %rdx,%rsi
+  8035c8:	89 c7                	mov    %eax,%edi
+  8035ca:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+  8035d6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8035d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035dc:	89 c7                	mov    %eax,%edi
+  8035de:	48 b8 27 2a 80 00 00 	movabs $0x802a27,%rax
+  8035e5:	00 00 00 
+  8035e8:	ff d0                	call   *%rax
+  return r;
+  8035ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8035ed:	c9                   	leave
+  8035ee:	c3                   	ret
+
+00000000008035ef <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8035ef:	55                   	push   %rbp
+  8035f0:	48 89 e5             	mov    %rsp,%rbp
+  8035f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8035fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8035fe:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803605:	00 00 00 
+  803608:	8b 00                	mov    (%rax),%eax
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	75 1d                	jne    80362b <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80360e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803613:	48 b8 6f 4e 80 00 00 	movabs $0x804e6f,%rax
+  80361a:	00 00 00 
+  80361d:	ff d0                	call   *%rax
+  80361f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803626:	00 00 00 
+  803629:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80362b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803632:	00 00 00 
+  803635:	8b 00                	mov    (%rax),%eax
+  803637:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80363a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80363f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803646:	00 00 00 
+  803649:	89 c7                	mov    %eax,%edi
+  80364b:	48 b8 c2 4d 80 00 00 	movabs $0x804dc2,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803657:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80365b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803660:	48 89 c6             	mov    %rax,%rsi
+  803663:	bf 00 00 00 00       	mov    $0x0,%edi
+  803668:	48 b8 45 4c 80 00 00 	movabs $0x804c45,%rax
+  80366f:	00 00 00 
+  803672:	ff d0                	call   *%rax
+}
+  803674:	c9                   	leave
+  803675:	c3                   	ret
+
+0000000000803676 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	48 83 ec 20          	sub    $0x20,%rsp
+  80367e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803682:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803685:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803689:	48 89 c7             	mov    %rax,%rdi
+  80368c:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+  803698:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80369d:	7e 0a                	jle    8036a9 <open+0x33>
+    return -E_BAD_PATH;
+  80369f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8036a4:	e9 a8 00 00 00       	jmp    803751 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8036a9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036ad:	48 89 c7             	mov    %rax,%rdi
+  8036b0:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+  8036bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036c3:	79 08                	jns    8036cd <open+0x57>
+    return r;
+  8036c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c8:	e9 84 00 00 00       	jmp    803751 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8036cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036d1:	48 89 c6             	mov    %rax,%rsi
+  8036d4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8036db:	00 00 00 
+  8036de:	48 89 c7             	mov    %rax,%rdi
+  8036e1:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8036e8:	00 00 00 
+  8036eb:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8036ed:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8036f4:	00 00 00 
+  8036f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036fa:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803700:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803704:	48 89 c6             	mov    %rax,%rsi
+  803707:	bf 01 00 00 00       	mov    $0x1,%edi
+  80370c:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803713:	00 00 00 
+  803716:	ff d0                	call   *%rax
+  803718:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80371b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80371f:	79 1d                	jns    80373e <open+0xc8>
+    fd_close(fd, 0);
+  803721:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803725:	be 00 00 00 00       	mov    $0x0,%esi
+  80372a:	48 89 c7             	mov    %rax,%rdi
+  80372d:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  803734:	00 00 00 
+  803737:	ff d0                	call   *%rax
+    return r;
+  803739:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80373c:	eb 13                	jmp    803751 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80373e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803742:	48 89 c7             	mov    %rax,%rdi
+  803745:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  80374c:	00 00 00 
+  80374f:	ff d0                	call   *%rax
+}
+  803751:	c9                   	leave
+  803752:	c3                   	ret
+
+0000000000803753 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	48 83 ec 10          	sub    $0x10,%rsp
+  80375b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80375f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803763:	8b 40 0c             	mov    0xc(%rax),%eax
+  803766:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80376d:	00 00 00 
+  803770:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803772:	be 00 00 00 00       	mov    $0x0,%esi
+  803777:	bf 06 00 00 00       	mov    $0x6,%edi
+  80377c:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803783:	00 00 00 
+  803786:	ff d0                	call   *%rax
+}
+  803788:	c9                   	leave
+  803789:	c3                   	ret
+
+000000000080378a <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80378a:	55                   	push   %rbp
+  80378b:	48 89 e5             	mov    %rsp,%rbp
+  80378e:	48 83 ec 30          	sub    $0x30,%rsp
+  803792:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803796:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80379a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80379e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8037a3:	74 07                	je     8037ac <devfile_read+0x22>
+  8037a5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037aa:	75 0a                	jne    8037b6 <devfile_read+0x2c>
+  return E_INVAL;
+  8037ac:	b8 03 00 00 00       	mov    $0x3,%eax
+  8037b1:	e9 b4 00 00 00       	jmp    80386a <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8037b6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8037bd:	00 
+  while (n) {
+  8037be:	e9 98 00 00 00       	jmp    80385b <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037c7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8037ca:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037d1:	00 00 00 
+  8037d4:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8037d6:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037dd:	00 00 00 
+  8037e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037e4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8037e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ed:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037f2:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  8037f9:	00 00 00 
+  8037fc:	ff d0                	call   *%rax
+  8037fe:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803801:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803805:	7f 13                	jg     80381a <devfile_read+0x90>
+      return res ? res : res0;
+  803807:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80380b:	74 07                	je     803814 <devfile_read+0x8a>
+  80380d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803810:	48 98                	cltq
+  803812:	eb 56                	jmp    80386a <devfile_read+0xe0>
+  803814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803818:	eb 50                	jmp    80386a <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80381a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80381d:	48 63 d0             	movslq %eax,%rdx
+  803820:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803824:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  80382b:	00 00 00 
+  80382e:	48 89 ce             	mov    %rcx,%rsi
+  803831:	48 89 c7             	mov    %rax,%rdi
+  803834:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  80383b:	00 00 00 
+  80383e:	ff d0                	call   *%rax
+
+    buf += res;
+  803840:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803843:	48 98                	cltq
+  803845:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803849:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80384c:	48 98                	cltq
+  80384e:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803852:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803855:	48 98                	cltq
+  803857:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80385b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803860:	0f 85 5d ff ff ff    	jne    8037c3 <devfile_read+0x39>
+  }
+
+  return res0;
+  803866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80386a:	c9                   	leave
+  80386b:	c3                   	ret
+
+000000000080386c <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80386c:	55                   	push   %rbp
+  80386d:	48 89 e5             	mov    %rsp,%rbp
+  803870:	48 83 ec 50          	sub    $0x50,%rsp
+  803874:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803878:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80387c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803880:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803885:	74 07                	je     80388e <devfile_write+0x22>
+  803887:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80388c:	75 0a                	jne    803898 <devfile_write+0x2c>
+  return E_INVAL;
+  80388e:	b8 03 00 00 00       	mov    $0x3,%eax
+  803893:	e9 c9 00 00 00       	jmp    803961 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803898:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80389f:	00 
+
+  while (n) {
+  8038a0:	e9 ad 00 00 00       	jmp    803952 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8038a5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8038ad:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8038b4:	00 
+  8038b5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8038b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038bd:	48 39 c2             	cmp    %rax,%rdx
+  8038c0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8038c8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038cc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038d0:	48 89 c6             	mov    %rax,%rsi
+  8038d3:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8038da:	00 00 00 
+  8038dd:	48 89 c7             	mov    %rax,%rdi
+  8038e0:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  8038e7:	00 00 00 
+  8038ea:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8038fa:	00 00 00 
+  8038fd:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8038ff:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803906:	00 00 00 
+  803909:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80390d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803911:	be 00 00 00 00       	mov    $0x0,%esi
+  803916:	bf 04 00 00 00       	mov    $0x4,%edi
+  80391b:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+  803927:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80392a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80392e:	79 07                	jns    803937 <devfile_write+0xcb>
+      return res;
+  803930:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803933:	48 98                	cltq
+  803935:	eb 2a                	jmp    803961 <devfile_write+0xf5>
+
+    buf += res;
+  803937:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80393a:	48 98                	cltq
+  80393c:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803940:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803943:	48 98                	cltq
+  803945:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803949:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80394c:	48 98                	cltq
+  80394e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803952:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803957:	0f 85 48 ff ff ff    	jne    8038a5 <devfile_write+0x39>
+  }
+
+  return res0;
+  80395d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803961:	c9                   	leave
+  803962:	c3                   	ret
+
+0000000000803963 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803963:	55                   	push   %rbp
+  803964:	48 89 e5             	mov    %rsp,%rbp
+  803967:	48 83 ec 20          	sub    $0x20,%rsp
+  80396b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80396f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803973:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803977:	8b 40 0c             	mov    0xc(%rax),%eax
+  80397a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803981:	00 00 00 
+  803984:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803986:	be 00 00 00 00       	mov    $0x0,%esi
+  80398b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803990:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803997:	00 00 00 
+  80399a:	ff d0                	call   *%rax
+  80399c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80399f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039a3:	79 05                	jns    8039aa <devfile_stat+0x47>
+    return r;
+  8039a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a8:	eb 59                	jmp    803a03 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ae:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039b5:	00 00 00 
+  8039b8:	48 89 d6             	mov    %rdx,%rsi
+  8039bb:	48 89 c7             	mov    %rax,%rdi
+  8039be:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8039c5:	00 00 00 
+  8039c8:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8039ca:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039d1:	00 00 00 
+  8039d4:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8039da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039de:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039e4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8039eb:	00 00 00 
+  8039ee:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8039f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f8:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8039fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a03:	c9                   	leave
+  803a04:	c3                   	ret
+
+0000000000803a05 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a05:	55                   	push   %rbp
+  803a06:	48 89 e5             	mov    %rsp,%rbp
+  803a09:	48 83 ec 10          	sub    $0x10,%rsp
+  803a0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a11:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803a14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a18:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a1b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a22:	00 00 00 
+  803a25:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803a27:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a2e:	00 00 00 
+  803a31:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a34:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803a37:	be 00 00 00 00       	mov    $0x0,%esi
+  803a3c:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a41:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+}
+  803a4d:	c9                   	leave
+  803a4e:	c3                   	ret
+
+0000000000803a4f <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803a4f:	55                   	push   %rbp
+  803a50:	48 89 e5             	mov    %rsp,%rbp
+  803a53:	48 83 ec 18          	sub    $0x18,%rsp
+  803a57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a5b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803a5e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803a62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a65:	83 e0 03             	and    $0x3,%eax
+}
+  803a68:	c9                   	leave
+  803a69:	c3                   	ret
+
+0000000000803a6a <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803a6a:	55                   	push   %rbp
+  803a6b:	48 89 e5             	mov    %rsp,%rbp
+  803a6e:	48 83 ec 10          	sub    $0x10,%rsp
+  803a72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803a76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a7a:	48 89 c7             	mov    %rax,%rdi
+  803a7d:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+  803a89:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803a8e:	7e 07                	jle    803a97 <remove+0x2d>
+    return -E_BAD_PATH;
+  803a90:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803a95:	eb 36                	jmp    803acd <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803a97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a9b:	48 89 c6             	mov    %rax,%rsi
+  803a9e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803aa5:	00 00 00 
+  803aa8:	48 89 c7             	mov    %rax,%rdi
+  803aab:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  803ab2:	00 00 00 
+  803ab5:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  803abc:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ac1:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803ac8:	00 00 00 
+  803acb:	ff d0                	call   *%rax
+}
+  803acd:	c9                   	leave
+  803ace:	c3                   	ret
+
+0000000000803acf <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803acf:	55                   	push   %rbp
+  803ad0:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803ad3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad8:	bf 08 00 00 00       	mov    $0x8,%edi
+  803add:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+}
+  803ae9:	5d                   	pop    %rbp
+  803aea:	c3                   	ret
+
+0000000000803aeb <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803aeb:	55                   	push   %rbp
+  803aec:	48 89 e5             	mov    %rsp,%rbp
+  803aef:	48 83 ec 20          	sub    $0x20,%rsp
+  803af3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803af7:	be 00 00 00 00       	mov    $0x0,%esi
+  803afc:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b01:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803b08:	00 00 00 
+  803b0b:	ff d0                	call   *%rax
+  803b0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b14:	79 05                	jns    803b1b <fs_stats+0x30>
+    return r;
+  803b16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b19:	eb 2a                	jmp    803b45 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b1f:	ba 68 00 00 00       	mov    $0x68,%edx
+  803b24:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803b2b:	00 00 00 
+  803b2e:	48 89 ce             	mov    %rcx,%rsi
+  803b31:	48 89 c7             	mov    %rax,%rdi
+  803b34:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  803b3b:	00 00 00 
+  803b3e:	ff d0                	call   *%rax
+  return 0;
+  803b40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b45:	c9                   	leave
+  803b46:	c3                   	ret
+
+0000000000803b47 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803b47:	55                   	push   %rbp
+  803b48:	48 89 e5             	mov    %rsp,%rbp
+  803b4b:	48 83 ec 10          	sub    $0x10,%rsp
+  803b4f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803b52:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b59:	00 00 00 
+  803b5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b5f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803b61:	be 00 00 00 00       	mov    $0x0,%esi
+  803b66:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b6b:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+}
+  803b77:	c9                   	leave
+  803b78:	c3                   	ret
+
+0000000000803b79 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+  803b7d:	48 83 ec 10          	sub    $0x10,%rsp
+  803b81:	89 f8                	mov    %edi,%eax
+  803b83:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803b86:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803b8a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b91:	00 00 00 
+  803b94:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803b96:	be 00 00 00 00       	mov    $0x0,%esi
+  803b9b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ba0:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803ba7:	00 00 00 
+  803baa:	ff d0                	call   *%rax
+}
+  803bac:	c9                   	leave
+  803bad:	c3                   	ret
+
+0000000000803bae <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803bae:	55                   	push   %rbp
+  803baf:	48 89 e5             	mov    %rsp,%rbp
+  803bb2:	48 83 ec 10          	sub    $0x10,%rsp
+  803bb6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803bba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bbe:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803bc3:	48 89 c7             	mov    %rax,%rdi
+  803bc6:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+}
+  803bd2:	c9                   	leave
+  803bd3:	c3                   	ret
+
+0000000000803bd4 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803bd4:	55                   	push   %rbp
+  803bd5:	48 89 e5             	mov    %rsp,%rbp
+  803bd8:	48 83 ec 50          	sub    $0x50,%rsp
+  803bdc:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803be0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803be4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803beb:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803bec:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803bf1:	74 0a                	je     803bfd <pipe_size+0x29>
+  803bf3:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803bfa:	00 
+  803bfb:	76 0a                	jbe    803c07 <pipe_size+0x33>
+    return -E_INVAL;
+  803bfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c02:	e9 cc 02 00 00       	jmp    803ed3 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c07:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803c0b:	48 89 c7             	mov    %rax,%rdi
+  803c0e:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  803c15:	00 00 00 
+  803c18:	ff d0                	call   *%rax
+  803c1a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c21:	0f 88 a8 02 00 00    	js     803ecf <pipe_size+0x2fb>
+  803c27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c2b:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c30:	48 89 c6             	mov    %rax,%rsi
+  803c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c38:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+  803c44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c4b:	0f 88 7e 02 00 00    	js     803ecf <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803c51:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803c55:	48 89 c7             	mov    %rax,%rdi
+  803c58:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  803c5f:	00 00 00 
+  803c62:	ff d0                	call   *%rax
+  803c64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6b:	0f 88 43 02 00 00    	js     803eb4 <pipe_size+0x2e0>
+  803c71:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c75:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c7a:	48 89 c6             	mov    %rax,%rsi
+  803c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c82:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  803c89:	00 00 00 
+  803c8c:	ff d0                	call   *%rax
+  803c8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c95:	0f 88 19 02 00 00    	js     803eb4 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803c9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c9f:	48 89 c7             	mov    %rax,%rdi
+  803ca2:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  803ca9:	00 00 00 
+  803cac:	ff d0                	call   *%rax
+  803cae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803cb2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cb9:	00 
+  803cba:	e9 a2 00 00 00       	jmp    803d61 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cc3:	48 c1 e0 0c          	shl    $0xc,%rax
+  803cc7:	48 89 c2             	mov    %rax,%rdx
+  803cca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cce:	48 01 d0             	add    %rdx,%rax
+  803cd1:	ba 07 04 00 00       	mov    $0x407,%edx
+  803cd6:	48 89 c6             	mov    %rax,%rsi
+  803cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cde:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  803ce5:	00 00 00 
+  803ce8:	ff d0                	call   *%rax
+  803cea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ced:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cf1:	0f 88 37 01 00 00    	js     803e2e <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803cf7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfb:	48 89 c7             	mov    %rax,%rdi
+  803cfe:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  803d05:	00 00 00 
+  803d08:	ff d0                	call   *%rax
+  803d0a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d0e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d12:	48 01 c2             	add    %rax,%rdx
+  803d15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d19:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d1d:	48 89 c1             	mov    %rax,%rcx
+  803d20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d24:	48 01 c8             	add    %rcx,%rax
+  803d27:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803d2d:	48 89 d1             	mov    %rdx,%rcx
+  803d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d35:	48 89 c6             	mov    %rax,%rsi
+  803d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d3d:	48 b8 f3 1f 80 00 00 	movabs $0x801ff3,%rax
+  803d44:	00 00 00 
+  803d47:	ff d0                	call   *%rax
+  803d49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d50:	79 0a                	jns    803d5c <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803d52:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803d57:	e9 d3 00 00 00       	jmp    803e2f <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d5c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803d61:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803d68:	00 
+  803d69:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803d6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d71:	48 01 d0             	add    %rdx,%rax
+  803d74:	48 83 c0 1f          	add    $0x1f,%rax
+  803d78:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803d7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d80:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d85:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803d89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d8d:	48 29 d0             	sub    %rdx,%rax
+  803d90:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d94:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803d98:	0f 82 21 ff ff ff    	jb     803cbf <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803d9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803da2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803da6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803daa:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803dae:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803db2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803db6:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dbd:	00 00 00 
+  803dc0:	8b 12                	mov    (%rdx),%edx
+  803dc2:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803dc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dc8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803dcf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803dd3:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803dda:	00 00 00 
+  803ddd:	8b 12                	mov    (%rdx),%edx
+  803ddf:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803de1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803de5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803dec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803df0:	48 89 c7             	mov    %rax,%rdi
+  803df3:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+  803dff:	89 c2                	mov    %eax,%edx
+  803e01:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e05:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803e07:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e0b:	48 89 c7             	mov    %rax,%rdi
+  803e0e:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  803e15:	00 00 00 
+  803e18:	ff d0                	call   *%rax
+  803e1a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e1e:	48 83 c2 04          	add    $0x4,%rdx
+  803e22:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e29:	e9 a5 00 00 00       	jmp    803ed3 <pipe_size+0x2ff>
+      goto err2;
+  803e2e:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803e2f:	eb 58                	jmp    803e89 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803e31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e35:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e39:	48 89 c2             	mov    %rax,%rdx
+  803e3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e40:	48 01 d0             	add    %rdx,%rax
+  803e43:	48 89 c6             	mov    %rax,%rsi
+  803e46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4b:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  803e52:	00 00 00 
+  803e55:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803e57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e5b:	48 89 c7             	mov    %rax,%rdi
+  803e5e:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  803e65:	00 00 00 
+  803e68:	ff d0                	call   *%rax
+  803e6a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e6e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e72:	48 01 d0             	add    %rdx,%rax
+  803e75:	48 89 c6             	mov    %rax,%rsi
+  803e78:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7d:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  803e84:	00 00 00 
+  803e87:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803e89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e8d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803e91:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803e95:	48 85 c0             	test   %rax,%rax
+  803e98:	75 97                	jne    803e31 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803e9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e9e:	48 89 c6             	mov    %rax,%rsi
+  803ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea6:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  803ead:	00 00 00 
+  803eb0:	ff d0                	call   *%rax
+  803eb2:	eb 01                	jmp    803eb5 <pipe_size+0x2e1>
+    goto err1;
+  803eb4:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803eb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eb9:	48 89 c6             	mov    %rax,%rsi
+  803ebc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec1:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  803ec8:	00 00 00 
+  803ecb:	ff d0                	call   *%rax
+  803ecd:	eb 01                	jmp    803ed0 <pipe_size+0x2fc>
+    goto err;
+  803ecf:	90                   	nop
+err:
+  return r;
+  803ed0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ed3:	c9                   	leave
+  803ed4:	c3                   	ret
+
+0000000000803ed5 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ed5:	55                   	push   %rbp
+  803ed6:	48 89 e5             	mov    %rsp,%rbp
+  803ed9:	53                   	push   %rbx
+  803eda:	48 83 ec 28          	sub    $0x28,%rsp
+  803ede:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ee2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803ee6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803eed:	00 00 00 
+  803ef0:	8b 40 04             	mov    0x4(%rax),%eax
+  803ef3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ef8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803eff:	00 00 00 
+  803f02:	48 98                	cltq
+  803f04:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f0b:	48 01 d0             	add    %rdx,%rax
+  803f0e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f14:	8b 00                	mov    (%rax),%eax
+  803f16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803f19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f1d:	48 89 c7             	mov    %rax,%rdi
+  803f20:	48 b8 e0 4e 80 00 00 	movabs $0x804ee0,%rax
+  803f27:	00 00 00 
+  803f2a:	ff d0                	call   *%rax
+  803f2c:	89 c3                	mov    %eax,%ebx
+  803f2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f32:	48 89 c7             	mov    %rax,%rdi
+  803f35:	48 b8 e0 4e 80 00 00 	movabs $0x804ee0,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+  803f41:	39 c3                	cmp    %eax,%ebx
+  803f43:	0f 94 c0             	sete   %al
+  803f46:	0f b6 c0             	movzbl %al,%eax
+  803f49:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  803f4c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f53:	00 00 00 
+  803f56:	8b 40 04             	mov    0x4(%rax),%eax
+  803f59:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f5e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f65:	00 00 00 
+  803f68:	48 98                	cltq
+  803f6a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f71:	48 01 d0             	add    %rdx,%rax
+  803f74:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803f7a:	8b 00                	mov    (%rax),%eax
+  803f7c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  803f7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f82:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f85:	75 05                	jne    803f8c <_pipeisclosed+0xb7>
+      return ret;
+  803f87:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f8a:	eb 68                	jmp    803ff4 <_pipeisclosed+0x11f>
+    if (n != nn)
+  803f8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f8f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  803f92:	0f 84 4e ff ff ff    	je     803ee6 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  803f98:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f9f:	00 00 00 
+  803fa2:	8b 40 04             	mov    0x4(%rax),%eax
+  803fa5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803faa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fb1:	00 00 00 
+  803fb4:	48 98                	cltq
+  803fb6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fbd:	48 01 d0             	add    %rdx,%rax
+  803fc0:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803fc6:	8b 10                	mov    (%rax),%edx
+  803fc8:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  803fcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fce:	89 c6                	mov    %eax,%esi
+  803fd0:	48 b8 c0 55 80 00 00 	movabs $0x8055c0,%rax
+  803fd7:	00 00 00 
+  803fda:	48 89 c7             	mov    %rax,%rdi
+  803fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe2:	49 b8 1d 02 80 00 00 	movabs $0x80021d,%r8
+  803fe9:	00 00 00 
+  803fec:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  803fef:	e9 f2 fe ff ff       	jmp    803ee6 <_pipeisclosed+0x11>
+  }
+}
+  803ff4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ff8:	c9                   	leave
+  803ff9:	c3                   	ret
+
+0000000000803ffa <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  803ffa:	55                   	push   %rbp
+  803ffb:	48 89 e5             	mov    %rsp,%rbp
+  803ffe:	48 83 ec 30          	sub    $0x30,%rsp
+  804002:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804005:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804009:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80400c:	48 89 d6             	mov    %rdx,%rsi
+  80400f:	89 c7                	mov    %eax,%edi
+  804011:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804020:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804024:	79 05                	jns    80402b <pipeisclosed+0x31>
+    return r;
+  804026:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804029:	eb 31                	jmp    80405c <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80402b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80402f:	48 89 c7             	mov    %rax,%rdi
+  804032:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+  80403e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804042:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804046:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80404a:	48 89 d6             	mov    %rdx,%rsi
+  80404d:	48 89 c7             	mov    %rax,%rdi
+  804050:	48 b8 d5 3e 80 00 00 	movabs $0x803ed5,%rax
+  804057:	00 00 00 
+  80405a:	ff d0                	call   *%rax
+}
+  80405c:	c9                   	leave
+  80405d:	c3                   	ret
+
+000000000080405e <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80405e:	55                   	push   %rbp
+  80405f:	48 89 e5             	mov    %rsp,%rbp
+  804062:	48 83 ec 10          	sub    $0x10,%rsp
+  804066:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80406a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80406e:	8b 40 18             	mov    0x18(%rax),%eax
+  804071:	8d 50 01             	lea    0x1(%rax),%edx
+  804074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804078:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80407b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407f:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804082:	85 c0                	test   %eax,%eax
+  804084:	74 27                	je     8040ad <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804086:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80408a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804091:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804095:	48 83 c0 18          	add    $0x18,%rax
+  804099:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80409e:	48 89 c7             	mov    %rax,%rdi
+  8040a1:	48 b8 96 23 80 00 00 	movabs $0x802396,%rax
+  8040a8:	00 00 00 
+  8040ab:	ff d0                	call   *%rax
+  }
+}
+  8040ad:	90                   	nop
+  8040ae:	c9                   	leave
+  8040af:	c3                   	ret
+
+00000000008040b0 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8040b0:	55                   	push   %rbp
+  8040b1:	48 89 e5             	mov    %rsp,%rbp
+  8040b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8040b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040bc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8040bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c3:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8040ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040ce:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8040d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040d5:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8040dc:	89 c6                	mov    %eax,%esi
+  8040de:	48 89 cf             	mov    %rcx,%rdi
+  8040e1:	48 b8 47 23 80 00 00 	movabs $0x802347,%rax
+  8040e8:	00 00 00 
+  8040eb:	ff d0                	call   *%rax
+}
+  8040ed:	90                   	nop
+  8040ee:	c9                   	leave
+  8040ef:	c3                   	ret
+
+00000000008040f0 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040f0:	55                   	push   %rbp
+  8040f1:	48 89 e5             	mov    %rsp,%rbp
+  8040f4:	48 83 ec 70          	sub    $0x70,%rsp
+  8040f8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8040fc:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804100:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804104:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804108:	48 89 c7             	mov    %rax,%rdi
+  80410b:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  804112:	00 00 00 
+  804115:	ff d0                	call   *%rax
+  804117:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80411b:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804120:	75 0a                	jne    80412c <devpipe_read+0x3c>
+    return 0;
+  804122:	b8 00 00 00 00       	mov    $0x0,%eax
+  804127:	e9 63 01 00 00       	jmp    80428f <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80412c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804130:	8b 40 18             	mov    0x18(%rax),%eax
+  804133:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804136:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80413a:	48 8b 10             	mov    (%rax),%rdx
+  80413d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804141:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804145:	48 39 c2             	cmp    %rax,%rdx
+  804148:	75 42                	jne    80418c <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80414a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80414e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804152:	48 89 d6             	mov    %rdx,%rsi
+  804155:	48 89 c7             	mov    %rax,%rdi
+  804158:	48 b8 d5 3e 80 00 00 	movabs $0x803ed5,%rax
+  80415f:	00 00 00 
+  804162:	ff d0                	call   *%rax
+  804164:	85 c0                	test   %eax,%eax
+  804166:	74 0a                	je     804172 <devpipe_read+0x82>
+      return 0;
+  804168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416d:	e9 1d 01 00 00       	jmp    80428f <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804172:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804179:	89 d6                	mov    %edx,%esi
+  80417b:	48 89 c7             	mov    %rax,%rdi
+  80417e:	48 b8 b0 40 80 00 00 	movabs $0x8040b0,%rax
+  804185:	00 00 00 
+  804188:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80418a:	eb a0                	jmp    80412c <devpipe_read+0x3c>
+      break;
+  80418c:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80418d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804191:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804195:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804199:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80419d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8041a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a9:	48 8b 00             	mov    (%rax),%rax
+  8041ac:	48 29 c2             	sub    %rax,%rdx
+  8041af:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8041b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041bb:	48 39 c2             	cmp    %rax,%rdx
+  8041be:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8041c2:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8041c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ca:	48 8b 00             	mov    (%rax),%rax
+  8041cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041d1:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8041d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041da:	48 f7 f1             	div    %rcx
+  8041dd:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8041e1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8041e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8041e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041ed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041f1:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8041f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041f9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804201:	48 39 c2             	cmp    %rax,%rdx
+  804204:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804208:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80420c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804210:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804214:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804218:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80421c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804220:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804224:	48 89 ce             	mov    %rcx,%rsi
+  804227:	48 89 c7             	mov    %rax,%rdi
+  80422a:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  804231:	00 00 00 
+  804234:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804236:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80423a:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80423e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804242:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804246:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80424a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80424e:	48 01 d1             	add    %rdx,%rcx
+  804251:	48 89 c2             	mov    %rax,%rdx
+  804254:	48 89 cf             	mov    %rcx,%rdi
+  804257:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  80425e:	00 00 00 
+  804261:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804263:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804267:	48 8b 10             	mov    (%rax),%rdx
+  80426a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80426e:	48 01 c2             	add    %rax,%rdx
+  804271:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804275:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804278:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80427c:	48 89 c7             	mov    %rax,%rdi
+  80427f:	48 b8 5e 40 80 00 00 	movabs $0x80405e,%rax
+  804286:	00 00 00 
+  804289:	ff d0                	call   *%rax
+  return n;
+  80428b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80428f:	c9                   	leave
+  804290:	c3                   	ret
+
+0000000000804291 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804291:	55                   	push   %rbp
+  804292:	48 89 e5             	mov    %rsp,%rbp
+  804295:	48 83 ec 70          	sub    $0x70,%rsp
+  804299:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80429d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8042a1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8042a5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042a9:	48 89 c7             	mov    %rax,%rdi
+  8042ac:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  8042b3:	00 00 00 
+  8042b6:	ff d0                	call   *%rax
+  8042b8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8042bc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8042c4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8042cb:	00 
+  8042cc:	e9 b8 01 00 00       	jmp    804489 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8042d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d5:	8b 40 18             	mov    0x18(%rax),%eax
+  8042d8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8042db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042df:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8042e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e7:	48 8b 00             	mov    (%rax),%rax
+  8042ea:	48 29 c2             	sub    %rax,%rdx
+  8042ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042f5:	48 39 c2             	cmp    %rax,%rdx
+  8042f8:	75 4d                	jne    804347 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8042fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804302:	48 89 d6             	mov    %rdx,%rsi
+  804305:	48 89 c7             	mov    %rax,%rdi
+  804308:	48 b8 d5 3e 80 00 00 	movabs $0x803ed5,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+  804314:	85 c0                	test   %eax,%eax
+  804316:	74 0a                	je     804322 <devpipe_write+0x91>
+        return 0;
+  804318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431d:	e9 79 01 00 00       	jmp    80449b <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804322:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804329:	89 d6                	mov    %edx,%esi
+  80432b:	48 89 c7             	mov    %rax,%rdi
+  80432e:	48 b8 b0 40 80 00 00 	movabs $0x8040b0,%rax
+  804335:	00 00 00 
+  804338:	ff d0                	call   *%rax
+      m = 0;
+  80433a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804341:	00 
+      continue;
+  804342:	e9 3a 01 00 00       	jmp    804481 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804347:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80434b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80434f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804353:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804357:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80435b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435f:	48 8b 08             	mov    (%rax),%rcx
+  804362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804366:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80436a:	48 29 c1             	sub    %rax,%rcx
+  80436d:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804371:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804375:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804379:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80437d:	48 39 c2             	cmp    %rax,%rdx
+  804380:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804384:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804388:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80438c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804390:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804394:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80439d:	48 f7 f1             	div    %rcx
+  8043a0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8043a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043a8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8043ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043b0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043b4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8043b8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8043bc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043c0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8043c4:	48 39 c2             	cmp    %rax,%rdx
+  8043c7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043cb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8043cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043d3:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8043d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043db:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8043df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043e3:	48 01 d1             	add    %rdx,%rcx
+  8043e6:	48 89 c2             	mov    %rax,%rdx
+  8043e9:	48 89 cf             	mov    %rcx,%rdi
+  8043ec:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  8043f3:	00 00 00 
+  8043f6:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8043f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804400:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804404:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804408:	73 4d                	jae    804457 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80440a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80440e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804412:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804416:	48 29 c2             	sub    %rax,%rdx
+  804419:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80441d:	48 01 c2             	add    %rax,%rdx
+  804420:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804424:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804428:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80442c:	48 89 c1             	mov    %rax,%rcx
+  80442f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804433:	48 01 c1             	add    %rax,%rcx
+  804436:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80443a:	48 01 c1             	add    %rax,%rcx
+  80443d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804441:	48 83 c0 20          	add    $0x20,%rax
+  804445:	48 89 ce             	mov    %rcx,%rsi
+  804448:	48 89 c7             	mov    %rax,%rdi
+  80444b:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  804452:	00 00 00 
+  804455:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804457:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80445b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80445f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804463:	48 01 c2             	add    %rax,%rdx
+  804466:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80446a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80446e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804472:	48 89 c7             	mov    %rax,%rdi
+  804475:	48 b8 5e 40 80 00 00 	movabs $0x80405e,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804481:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804485:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80448d:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804491:	0f 82 3a fe ff ff    	jb     8042d1 <devpipe_write+0x40>
+  }
+
+  return i;
+  804497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+
+000000000080449d <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80449d:	55                   	push   %rbp
+  80449e:	48 89 e5             	mov    %rsp,%rbp
+  8044a1:	48 83 ec 40          	sub    $0x40,%rsp
+  8044a5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044a9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8044ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044b4:	48 89 c7             	mov    %rax,%rdi
+  8044b7:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  8044be:	00 00 00 
+  8044c1:	ff d0                	call   *%rax
+  8044c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8044c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8044ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044d2:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8044d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044da:	48 89 d6             	mov    %rdx,%rsi
+  8044dd:	48 89 c7             	mov    %rax,%rdi
+  8044e0:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  8044e7:	00 00 00 
+  8044ea:	ff d0                	call   *%rax
+  8044ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f3:	79 08                	jns    8044fd <devpipe_poll+0x60>
+    return r;
+  8044f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f8:	e9 85 00 00 00       	jmp    804582 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8044fd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804500:	83 e0 01             	and    $0x1,%eax
+  804503:	85 c0                	test   %eax,%eax
+  804505:	74 18                	je     80451f <devpipe_poll+0x82>
+  804507:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80450b:	48 8b 10             	mov    (%rax),%rdx
+  80450e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804512:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804516:	48 39 c2             	cmp    %rax,%rdx
+  804519:	74 04                	je     80451f <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80451b:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80451f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804522:	83 e0 02             	and    $0x2,%eax
+  804525:	85 c0                	test   %eax,%eax
+  804527:	74 23                	je     80454c <devpipe_poll+0xaf>
+  804529:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80452d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804531:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804535:	48 8b 00             	mov    (%rax),%rax
+  804538:	48 29 c2             	sub    %rax,%rdx
+  80453b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804543:	48 39 c2             	cmp    %rax,%rdx
+  804546:	73 04                	jae    80454c <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804548:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80454c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804550:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804554:	48 89 d6             	mov    %rdx,%rsi
+  804557:	48 89 c7             	mov    %rax,%rdi
+  80455a:	48 b8 d5 3e 80 00 00 	movabs $0x803ed5,%rax
+  804561:	00 00 00 
+  804564:	ff d0                	call   *%rax
+  804566:	85 c0                	test   %eax,%eax
+  804568:	74 04                	je     80456e <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80456a:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80456e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804572:	75 0b                	jne    80457f <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804574:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804578:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80457f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804582:	c9                   	leave
+  804583:	c3                   	ret
+
+0000000000804584 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804584:	55                   	push   %rbp
+  804585:	48 89 e5             	mov    %rsp,%rbp
+  804588:	48 83 ec 20          	sub    $0x20,%rsp
+  80458c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804590:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804594:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804598:	48 89 c7             	mov    %rax,%rdi
+  80459b:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  8045a2:	00 00 00 
+  8045a5:	ff d0                	call   *%rax
+  8045a7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8045ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045af:	48 ba f1 55 80 00 00 	movabs $0x8055f1,%rdx
+  8045b6:	00 00 00 
+  8045b9:	48 89 d6             	mov    %rdx,%rsi
+  8045bc:	48 89 c7             	mov    %rax,%rdi
+  8045bf:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8045c6:	00 00 00 
+  8045c9:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8045cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045d3:	89 c1                	mov    %eax,%ecx
+  8045d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045d9:	48 8b 00             	mov    (%rax),%rax
+  8045dc:	89 c2                	mov    %eax,%edx
+  8045de:	89 c8                	mov    %ecx,%eax
+  8045e0:	29 d0                	sub    %edx,%eax
+  8045e2:	89 c2                	mov    %eax,%edx
+  8045e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8045ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f2:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8045f9:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8045fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804600:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804607:	00 00 00 
+  80460a:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804611:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804616:	c9                   	leave
+  804617:	c3                   	ret
+
+0000000000804618 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804618:	55                   	push   %rbp
+  804619:	48 89 e5             	mov    %rsp,%rbp
+  80461c:	48 83 ec 40          	sub    $0x40,%rsp
+  804620:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804624:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804628:	48 89 c7             	mov    %rax,%rdi
+  80462b:	48 b8 a5 26 80 00 00 	movabs $0x8026a5,%rax
+  804632:	00 00 00 
+  804635:	ff d0                	call   *%rax
+  804637:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80463b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804642:	00 
+  804643:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804647:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80464b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464f:	48 01 d0             	add    %rdx,%rax
+  804652:	48 83 c0 1f          	add    $0x1f,%rax
+  804656:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80465a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80465e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804663:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804667:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80466b:	48 29 d0             	sub    %rdx,%rax
+  80466e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804672:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804676:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80467a:	48 89 c6             	mov    %rax,%rsi
+  80467d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804682:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  804689:	00 00 00 
+  80468c:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80468e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804692:	48 89 c7             	mov    %rax,%rdi
+  804695:	48 b8 5e 40 80 00 00 	movabs $0x80405e,%rax
+  80469c:	00 00 00 
+  80469f:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8046a9:	eb 2f                	jmp    8046da <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8046ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046af:	48 83 e8 01          	sub    $0x1,%rax
+  8046b3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046b7:	48 89 c2             	mov    %rax,%rdx
+  8046ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046be:	48 01 d0             	add    %rdx,%rax
+  8046c1:	48 89 c6             	mov    %rax,%rsi
+  8046c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c9:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8046d5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046da:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8046df:	77 ca                	ja     8046ab <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8046e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e5:	48 89 c6             	mov    %rax,%rsi
+  8046e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ed:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  8046f4:	00 00 00 
+  8046f7:	ff d0                	call   *%rax
+}
+  8046f9:	c9                   	leave
+  8046fa:	c3                   	ret
+
+00000000008046fb <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8046fb:	55                   	push   %rbp
+  8046fc:	48 89 e5             	mov    %rsp,%rbp
+  8046ff:	48 83 ec 08          	sub    $0x8,%rsp
+  804703:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804706:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80470a:	75 10                	jne    80471c <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80470c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804713:	00 00 00 
+  804716:	8b 00                	mov    (%rax),%eax
+  804718:	48 98                	cltq
+  80471a:	eb 05                	jmp    804721 <vsyscall+0x26>
+  }
+  return 0;
+  80471c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804721:	c9                   	leave
+  804722:	c3                   	ret
+
+0000000000804723 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804723:	55                   	push   %rbp
+  804724:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80472c:	48 b8 fb 46 80 00 00 	movabs $0x8046fb,%rax
+  804733:	00 00 00 
+  804736:	ff d0                	call   *%rax
+}
+  804738:	5d                   	pop    %rbp
+  804739:	c3                   	ret
+
+000000000080473a <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80473a:	55                   	push   %rbp
+  80473b:	48 89 e5             	mov    %rsp,%rbp
+  80473e:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804742:	0f 31                	rdtsc
+  804744:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804747:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80474a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80474d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804750:	48 c1 e2 20          	shl    $0x20,%rdx
+  804754:	48 09 d0             	or     %rdx,%rax
+  804757:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80475b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80475f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804763:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80476a:	00 00 00 
+  80476d:	8b 40 08             	mov    0x8(%rax),%eax
+  804770:	48 98                	cltq
+  804772:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804776:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80477a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80477f:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804783:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80478a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80478e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804793:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804797:	48 89 d0             	mov    %rdx,%rax
+  80479a:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8047a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a6:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8047aa:	48 01 c8             	add    %rcx,%rax
+}
+  8047ad:	c9                   	leave
+  8047ae:	c3                   	ret
+
+00000000008047af <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8047af:	55                   	push   %rbp
+  8047b0:	48 89 e5             	mov    %rsp,%rbp
+  8047b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8047b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8047ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047bd:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8047c0:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8047c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8047c9:	48 89 c7             	mov    %rax,%rdi
+  8047cc:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  8047d3:	00 00 00 
+  8047d6:	ff d0                	call   *%rax
+}
+  8047d8:	90                   	nop
+  8047d9:	c9                   	leave
+  8047da:	c3                   	ret
+
+00000000008047db <getchar>:
+
+int
+getchar(void) {
+  8047db:	55                   	push   %rbp
+  8047dc:	48 89 e5             	mov    %rsp,%rbp
+  8047df:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8047e3:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8047e7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047ec:	48 89 c6             	mov    %rax,%rsi
+  8047ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f4:	48 b8 0e 2d 80 00 00 	movabs $0x802d0e,%rax
+  8047fb:	00 00 00 
+  8047fe:	ff d0                	call   *%rax
+  804800:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804803:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804807:	79 05                	jns    80480e <getchar+0x33>
+    return r;
+  804809:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80480c:	eb 14                	jmp    804822 <getchar+0x47>
+  if (r < 1)
+  80480e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804812:	7f 07                	jg     80481b <getchar+0x40>
+    return -E_EOF;
+  804814:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804819:	eb 07                	jmp    804822 <getchar+0x47>
+  return c;
+  80481b:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80481f:	0f b6 c0             	movzbl %al,%eax
+}
+  804822:	c9                   	leave
+  804823:	c3                   	ret
+
+0000000000804824 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804824:	55                   	push   %rbp
+  804825:	48 89 e5             	mov    %rsp,%rbp
+  804828:	48 83 ec 20          	sub    $0x20,%rsp
+  80482c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80482f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804833:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804836:	48 89 d6             	mov    %rdx,%rsi
+  804839:	89 c7                	mov    %eax,%edi
+  80483b:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  804842:	00 00 00 
+  804845:	ff d0                	call   *%rax
+  804847:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80484a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80484e:	79 05                	jns    804855 <iscons+0x31>
+    return r;
+  804850:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804853:	eb 1a                	jmp    80486f <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804855:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804859:	8b 10                	mov    (%rax),%edx
+  80485b:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804862:	00 00 00 
+  804865:	8b 00                	mov    (%rax),%eax
+  804867:	39 c2                	cmp    %eax,%edx
+  804869:	0f 94 c0             	sete   %al
+  80486c:	0f b6 c0             	movzbl %al,%eax
+}
+  80486f:	c9                   	leave
+  804870:	c3                   	ret
+
+0000000000804871 <opencons>:
+
+int
+opencons(void) {
+  804871:	55                   	push   %rbp
+  804872:	48 89 e5             	mov    %rsp,%rbp
+  804875:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804879:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80487d:	48 89 c7             	mov    %rax,%rdi
+  804880:	48 b8 d0 26 80 00 00 	movabs $0x8026d0,%rax
+  804887:	00 00 00 
+  80488a:	ff d0                	call   *%rax
+  80488c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80488f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804893:	79 05                	jns    80489a <opencons+0x29>
+    return r;
+  804895:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804898:	eb 66                	jmp    804900 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80489a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80489e:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048a3:	48 89 c6             	mov    %rax,%rsi
+  8048a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ab:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8048b2:	00 00 00 
+  8048b5:	ff d0                	call   *%rax
+  8048b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048be:	79 05                	jns    8048c5 <opencons+0x54>
+    return r;
+  8048c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048c3:	eb 3b                	jmp    804900 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8048c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c9:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8048d0:	00 00 00 
+  8048d3:	8b 12                	mov    (%rdx),%edx
+  8048d5:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8048d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8048e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8048ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f1:	48 89 c7             	mov    %rax,%rdi
+  8048f4:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8048fb:	00 00 00 
+  8048fe:	ff d0                	call   *%rax
+}
+  804900:	c9                   	leave
+  804901:	c3                   	ret
+
+0000000000804902 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804902:	55                   	push   %rbp
+  804903:	48 89 e5             	mov    %rsp,%rbp
+  804906:	48 83 ec 20          	sub    $0x20,%rsp
+  80490a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80490d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804910:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804914:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804917:	48 89 d6             	mov    %rdx,%rsi
+  80491a:	89 c7                	mov    %eax,%edi
+  80491c:	48 b8 b2 27 80 00 00 	movabs $0x8027b2,%rax
+  804923:	00 00 00 
+  804926:	ff d0                	call   *%rax
+  804928:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80492b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80492f:	79 05                	jns    804936 <consmode+0x34>
+    return r;
+  804931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804934:	eb 34                	jmp    80496a <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804936:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80493a:	8b 10                	mov    (%rax),%edx
+  80493c:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804943:	00 00 00 
+  804946:	8b 00                	mov    (%rax),%eax
+  804948:	39 c2                	cmp    %eax,%edx
+  80494a:	74 07                	je     804953 <consmode+0x51>
+    return -E_INVAL;
+  80494c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804951:	eb 17                	jmp    80496a <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804953:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804957:	8b 40 0c             	mov    0xc(%rax),%eax
+  80495a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80495d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804961:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804964:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804967:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80496a:	c9                   	leave
+  80496b:	c3                   	ret
+
+000000000080496c <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80496c:	55                   	push   %rbp
+  80496d:	48 89 e5             	mov    %rsp,%rbp
+  804970:	48 83 ec 20          	sub    $0x20,%rsp
+  804974:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804978:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80497c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804980:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804984:	8b 50 0c             	mov    0xc(%rax),%edx
+  804987:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80498b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80498f:	48 89 ce             	mov    %rcx,%rsi
+  804992:	48 89 c7             	mov    %rax,%rdi
+  804995:	48 b8 f5 22 80 00 00 	movabs $0x8022f5,%rax
+  80499c:	00 00 00 
+  80499f:	ff d0                	call   *%rax
+  8049a1:	48 98                	cltq
+}
+  8049a3:	c9                   	leave
+  8049a4:	c3                   	ret
+
+00000000008049a5 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8049a5:	55                   	push   %rbp
+  8049a6:	48 89 e5             	mov    %rsp,%rbp
+  8049a9:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8049b0:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8049b7:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8049be:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8049c5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8049cc:	eb 74                	jmp    804a42 <devcons_write+0x9d>
+    m = n - tot;
+  8049ce:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8049d5:	89 c2                	mov    %eax,%edx
+  8049d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049da:	29 c2                	sub    %eax,%edx
+  8049dc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8049df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049e2:	83 f8 7f             	cmp    $0x7f,%eax
+  8049e5:	76 07                	jbe    8049ee <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8049e7:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8049ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8049f1:	48 63 d0             	movslq %eax,%rdx
+  8049f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049f7:	48 63 c8             	movslq %eax,%rcx
+  8049fa:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804a01:	48 01 c1             	add    %rax,%rcx
+  804a04:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a0b:	48 89 ce             	mov    %rcx,%rsi
+  804a0e:	48 89 c7             	mov    %rax,%rdi
+  804a11:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  804a18:	00 00 00 
+  804a1b:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804a1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a20:	48 63 d0             	movslq %eax,%rdx
+  804a23:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804a2a:	48 89 d6             	mov    %rdx,%rsi
+  804a2d:	48 89 c7             	mov    %rax,%rdi
+  804a30:	48 b8 84 1d 80 00 00 	movabs $0x801d84,%rax
+  804a37:	00 00 00 
+  804a3a:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804a3c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804a3f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804a42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a45:	48 98                	cltq
+  804a47:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804a4e:	0f 82 7a ff ff ff    	jb     8049ce <devcons_write+0x29>
+  }
+  return tot;
+  804a54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a57:	48 98                	cltq
+}
+  804a59:	c9                   	leave
+  804a5a:	c3                   	ret
+
+0000000000804a5b <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804a5b:	55                   	push   %rbp
+  804a5c:	48 89 e5             	mov    %rsp,%rbp
+  804a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  804a63:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804a67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a6c:	c9                   	leave
+  804a6d:	c3                   	ret
+
+0000000000804a6e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804a6e:	55                   	push   %rbp
+  804a6f:	48 89 e5             	mov    %rsp,%rbp
+  804a72:	48 83 ec 10          	sub    $0x10,%rsp
+  804a76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804a7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a82:	48 ba fd 55 80 00 00 	movabs $0x8055fd,%rdx
+  804a89:	00 00 00 
+  804a8c:	48 89 d6             	mov    %rdx,%rsi
+  804a8f:	48 89 c7             	mov    %rax,%rdi
+  804a92:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  804a99:	00 00 00 
+  804a9c:	ff d0                	call   *%rax
+  return 0;
+  804a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804aa3:	c9                   	leave
+  804aa4:	c3                   	ret
+
+0000000000804aa5 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aa5:	55                   	push   %rbp
+  804aa6:	48 89 e5             	mov    %rsp,%rbp
+  804aa9:	48 83 ec 30          	sub    $0x30,%rsp
+  804aad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ab1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804ab4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804ab8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804abf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ac2:	83 e0 02             	and    $0x2,%eax
+  804ac5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804ac8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804acc:	8b 40 0c             	mov    0xc(%rax),%eax
+  804acf:	83 f8 01             	cmp    $0x1,%eax
+  804ad2:	75 04                	jne    804ad8 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804ad4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804ad8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804adb:	83 e0 01             	and    $0x1,%eax
+  804ade:	85 c0                	test   %eax,%eax
+  804ae0:	74 44                	je     804b26 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804ae2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ae5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804aea:	89 c2                	mov    %eax,%edx
+  804aec:	be 00 00 00 00       	mov    $0x0,%esi
+  804af1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af6:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  804afd:	00 00 00 
+  804b00:	ff d0                	call   *%rax
+  804b02:	83 f8 01             	cmp    $0x1,%eax
+  804b05:	75 06                	jne    804b0d <devcons_poll+0x68>
+      revents |= POLLIN;
+  804b07:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804b0b:	eb 19                	jmp    804b26 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804b0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b11:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804b17:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804b1a:	89 c2                	mov    %eax,%edx
+  804b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b20:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804b26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804b29:	c9                   	leave
+  804b2a:	c3                   	ret
+
+0000000000804b2b <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804b2b:	55                   	push   %rbp
+  804b2c:	48 89 e5             	mov    %rsp,%rbp
+  804b2f:	53                   	push   %rbx
+  804b30:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b37:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804b3e:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804b44:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804b4b:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804b52:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804b59:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804b60:	84 c0                	test   %al,%al
+  804b62:	74 23                	je     804b87 <_panic+0x5c>
+  804b64:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804b6b:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804b6f:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804b73:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804b77:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804b7b:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804b7f:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804b83:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804b87:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804b8e:	00 00 00 
+  804b91:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804b98:	00 00 00 
+  804b9b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b9f:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804ba6:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804bad:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804bb4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804bbb:	00 00 00 
+  804bbe:	48 8b 18             	mov    (%rax),%rbx
+  804bc1:	48 b8 22 1f 80 00 00 	movabs $0x801f22,%rax
+  804bc8:	00 00 00 
+  804bcb:	ff d0                	call   *%rax
+  804bcd:	89 c6                	mov    %eax,%esi
+  804bcf:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804bd5:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804bdc:	41 89 d0             	mov    %edx,%r8d
+  804bdf:	48 89 c1             	mov    %rax,%rcx
+  804be2:	48 89 da             	mov    %rbx,%rdx
+  804be5:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804bec:	00 00 00 
+  804bef:	48 89 c7             	mov    %rax,%rdi
+  804bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bf7:	49 b9 1d 02 80 00 00 	movabs $0x80021d,%r9
+  804bfe:	00 00 00 
+  804c01:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804c04:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804c0b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c12:	48 89 d6             	mov    %rdx,%rsi
+  804c15:	48 89 c7             	mov    %rax,%rdi
+  804c18:	48 b8 92 01 80 00 00 	movabs $0x800192,%rax
+  804c1f:	00 00 00 
+  804c22:	ff d0                	call   *%rax
+  cprintf("\n");
+  804c24:	48 b8 2b 56 80 00 00 	movabs $0x80562b,%rax
+  804c2b:	00 00 00 
+  804c2e:	48 89 c7             	mov    %rax,%rdi
+  804c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c36:	48 ba 1d 02 80 00 00 	movabs $0x80021d,%rdx
+  804c3d:	00 00 00 
+  804c40:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804c42:	cc                   	int3
+  804c43:	eb fd                	jmp    804c42 <_panic+0x117>
+
+0000000000804c45 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c45:	55                   	push   %rbp
+  804c46:	48 89 e5             	mov    %rsp,%rbp
+  804c49:	48 83 ec 20          	sub    $0x20,%rsp
+  804c4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c51:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c55:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c59:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c5d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c65:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c6c:	48 89 c7             	mov    %rax,%rdi
+  804c6f:	48 b8 7d 4c 80 00 00 	movabs $0x804c7d,%rax
+  804c76:	00 00 00 
+  804c79:	ff d0                	call   *%rax
+}
+  804c7b:	c9                   	leave
+  804c7c:	c3                   	ret
+
+0000000000804c7d <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c7d:	55                   	push   %rbp
+  804c7e:	48 89 e5             	mov    %rsp,%rbp
+  804c81:	48 83 ec 30          	sub    $0x30,%rsp
+  804c85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c8d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c91:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c95:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c9a:	75 0e                	jne    804caa <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ca3:	00 00 00 
+  804ca6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804caa:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804caf:	75 18                	jne    804cc9 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804cb1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cb5:	48 89 c7             	mov    %rax,%rdi
+  804cb8:	48 b8 db 21 80 00 00 	movabs $0x8021db,%rax
+  804cbf:	00 00 00 
+  804cc2:	ff d0                	call   *%rax
+  804cc4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cc7:	eb 1d                	jmp    804ce6 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804cc9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ccd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd1:	48 89 d6             	mov    %rdx,%rsi
+  804cd4:	48 89 c7             	mov    %rax,%rdi
+  804cd7:	48 b8 21 22 80 00 00 	movabs $0x802221,%rax
+  804cde:	00 00 00 
+  804ce1:	ff d0                	call   *%rax
+  804ce3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804ce6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cea:	79 2a                	jns    804d16 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cec:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf1:	74 0a                	je     804cfd <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cfd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d02:	74 0a                	je     804d0e <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804d04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d08:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804d0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d11:	e9 aa 00 00 00       	jmp    804dc0 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804d16:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804d1b:	74 36                	je     804d53 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804d1d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d24:	00 00 00 
+  804d27:	8b 40 04             	mov    0x4(%rax),%eax
+  804d2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d2f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d36:	00 00 00 
+  804d39:	48 98                	cltq
+  804d3b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d42:	48 01 d0             	add    %rdx,%rax
+  804d45:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d4b:	8b 10                	mov    (%rax),%edx
+  804d4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d51:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d53:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d58:	74 36                	je     804d90 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d5a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d61:	00 00 00 
+  804d64:	8b 40 04             	mov    0x4(%rax),%eax
+  804d67:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d6c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d73:	00 00 00 
+  804d76:	48 98                	cltq
+  804d78:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d7f:	48 01 d0             	add    %rdx,%rax
+  804d82:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d88:	8b 10                	mov    (%rax),%edx
+  804d8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d8e:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d90:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d97:	00 00 00 
+  804d9a:	8b 40 04             	mov    0x4(%rax),%eax
+  804d9d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804da2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804da9:	00 00 00 
+  804dac:	48 98                	cltq
+  804dae:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804db5:	48 01 d0             	add    %rdx,%rax
+  804db8:	48 05 20 01 00 00    	add    $0x120,%rax
+  804dbe:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804dc0:	c9                   	leave
+  804dc1:	c3                   	ret
+
+0000000000804dc2 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804dc2:	55                   	push   %rbp
+  804dc3:	48 89 e5             	mov    %rsp,%rbp
+  804dc6:	48 83 ec 30          	sub    $0x30,%rsp
+  804dca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dcd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804dd0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804dd4:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dd7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ddc:	75 5e                	jne    804e3c <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804dde:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804de5:	00 00 00 
+  804de8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dec:	eb 4e                	jmp    804e3c <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804df2:	79 3c                	jns    804e30 <ipc_send+0x6e>
+  804df4:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804df8:	74 36                	je     804e30 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dfd:	89 c1                	mov    %eax,%ecx
+  804dff:	48 b8 30 56 80 00 00 	movabs $0x805630,%rax
+  804e06:	00 00 00 
+  804e09:	48 89 c2             	mov    %rax,%rdx
+  804e0c:	be 54 00 00 00       	mov    $0x54,%esi
+  804e11:	48 b8 56 56 80 00 00 	movabs $0x805656,%rax
+  804e18:	00 00 00 
+  804e1b:	48 89 c7             	mov    %rax,%rdi
+  804e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e23:	49 b8 2b 4b 80 00 00 	movabs $0x804b2b,%r8
+  804e2a:	00 00 00 
+  804e2d:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e30:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  804e37:	00 00 00 
+  804e3a:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e3c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e3f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e42:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e49:	89 c7                	mov    %eax,%edi
+  804e4b:	48 b8 84 21 80 00 00 	movabs $0x802184,%rax
+  804e52:	00 00 00 
+  804e55:	ff d0                	call   *%rax
+  804e57:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e5a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e5e:	75 8e                	jne    804dee <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e60:	48 b8 5e 1f 80 00 00 	movabs $0x801f5e,%rax
+  804e67:	00 00 00 
+  804e6a:	ff d0                	call   *%rax
+}
+  804e6c:	90                   	nop
+  804e6d:	c9                   	leave
+  804e6e:	c3                   	ret
+
+0000000000804e6f <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e6f:	55                   	push   %rbp
+  804e70:	48 89 e5             	mov    %rsp,%rbp
+  804e73:	48 83 ec 18          	sub    $0x18,%rsp
+  804e77:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e7a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e81:	eb 4d                	jmp    804ed0 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e83:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e8a:	00 00 00 
+  804e8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e90:	48 98                	cltq
+  804e92:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e99:	48 01 d0             	add    %rdx,%rax
+  804e9c:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804ea2:	8b 00                	mov    (%rax),%eax
+  804ea4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804ea7:	75 23                	jne    804ecc <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804ea9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eb0:	00 00 00 
+  804eb3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804eb6:	48 98                	cltq
+  804eb8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ebf:	48 01 d0             	add    %rdx,%rax
+  804ec2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804ec8:	8b 00                	mov    (%rax),%eax
+  804eca:	eb 12                	jmp    804ede <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ecc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ed0:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804ed7:	7e aa                	jle    804e83 <ipc_find_env+0x14>
+  return 0;
+  804ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ede:	c9                   	leave
+  804edf:	c3                   	ret
+
+0000000000804ee0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804ee0:	55                   	push   %rbp
+  804ee1:	48 89 e5             	mov    %rsp,%rbp
+  804ee4:	48 83 ec 18          	sub    $0x18,%rsp
+  804ee8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804eec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef0:	48 c1 e8 27          	shr    $0x27,%rax
+  804ef4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ef9:	48 89 c2             	mov    %rax,%rdx
+  804efc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804f03:	01 00 00 
+  804f06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f0a:	83 e0 01             	and    $0x1,%eax
+  804f0d:	48 85 c0             	test   %rax,%rax
+  804f10:	74 63                	je     804f75 <pageref+0x95>
+  804f12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f16:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804f1a:	48 89 c2             	mov    %rax,%rdx
+  804f1d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804f24:	01 00 00 
+  804f27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f2b:	83 e0 01             	and    $0x1,%eax
+  804f2e:	48 85 c0             	test   %rax,%rax
+  804f31:	74 42                	je     804f75 <pageref+0x95>
+  804f33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f37:	48 c1 e8 15          	shr    $0x15,%rax
+  804f3b:	48 89 c2             	mov    %rax,%rdx
+  804f3e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f45:	01 00 00 
+  804f48:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f4c:	83 e0 01             	and    $0x1,%eax
+  804f4f:	48 85 c0             	test   %rax,%rax
+  804f52:	74 21                	je     804f75 <pageref+0x95>
+  804f54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f58:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f5c:	48 89 c2             	mov    %rax,%rdx
+  804f5f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f66:	01 00 00 
+  804f69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f6d:	83 e0 01             	and    $0x1,%eax
+  804f70:	48 85 c0             	test   %rax,%rax
+  804f73:	75 07                	jne    804f7c <pageref+0x9c>
+    return 0;
+  804f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7a:	eb 53                	jmp    804fcf <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f80:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f84:	48 89 c2             	mov    %rax,%rdx
+  804f87:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f8e:	01 00 00 
+  804f91:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f9d:	83 e0 01             	and    $0x1,%eax
+  804fa0:	48 85 c0             	test   %rax,%rax
+  804fa3:	75 07                	jne    804fac <pageref+0xcc>
+    return 0;
+  804fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804faa:	eb 23                	jmp    804fcf <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804fac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fb4:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804fbb:	00 00 00 
+  804fbe:	48 c1 e0 04          	shl    $0x4,%rax
+  804fc2:	48 01 d0             	add    %rdx,%rax
+  804fc5:	48 83 c0 08          	add    $0x8,%rax
+  804fc9:	0f b7 00             	movzwl (%rax),%eax
+  804fcc:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fcf:	c9                   	leave
+  804fd0:	c3                   	ret
+  804fd1:	0f 1f 00             	nopl   (%rax)
@@ -0,0 +1,8040 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 1a 00 00 00       	call   800046 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// buggy program - causes an illegal software interrupt
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 10          	sub    $0x10,%rsp
+  80003a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80003d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  asm volatile("int $14"); // page fault
+  800041:	cd 0e                	int    $0xe
+}
+  800043:	90                   	nop
+  800044:	c9                   	leave
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800051:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800055:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80005c:	00 00 00 
+  80005f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800063:	eb 13                	jmp    800078 <libmain+0x32>
+    (*ctor)();
+  800065:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800069:	48 8b 10             	mov    (%rax),%rdx
+  80006c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800071:	ff d2                	call   *%rdx
+    ctor++;
+  800073:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800078:	48 b8 04 61 80 00 00 	movabs $0x806104,%rax
+  80007f:	00 00 00 
+  800082:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800086:	72 dd                	jb     800065 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800088:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80008c:	7e 14                	jle    8000a2 <libmain+0x5c>
+    binaryname = argv[0];
+  80008e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800092:	48 8b 00             	mov    (%rax),%rax
+  800095:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80009c:	00 00 00 
+  80009f:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8000a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8000a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000a9:	48 89 d6             	mov    %rdx,%rsi
+  8000ac:	89 c7                	mov    %eax,%edi
+  8000ae:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000b5:	00 00 00 
+  8000b8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8000ba:	48 b8 c9 00 80 00 00 	movabs $0x8000c9,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+#endif
+}
+  8000c6:	90                   	nop
+  8000c7:	c9                   	leave
+  8000c8:	c3                   	ret
+
+00000000008000c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000c9:	55                   	push   %rbp
+  8000ca:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8000cd:	48 b8 74 0e 80 00 00 	movabs $0x800e74,%rax
+  8000d4:	00 00 00 
+  8000d7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8000d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000de:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+}
+  8000ea:	90                   	nop
+  8000eb:	5d                   	pop    %rbp
+  8000ec:	c3                   	ret
+
+00000000008000ed <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8000ed:	55                   	push   %rbp
+  8000ee:	48 89 e5             	mov    %rsp,%rbp
+  8000f1:	53                   	push   %rbx
+  8000f2:	48 83 ec 48          	sub    $0x48,%rsp
+  8000f6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8000fa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8000fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800102:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800106:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80010a:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80010e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800112:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800116:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80011a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80011e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  800122:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800126:	4c 89 c3             	mov    %r8,%rbx
+  800129:	cd 30                	int    $0x30
+  80012b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80012f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800134:	74 46                	je     80017c <syscall+0x8f>
+  800136:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80013b:	7e 3f                	jle    80017c <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80013d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800145:	49 89 d0             	mov    %rdx,%r8
+  800148:	48 89 c1             	mov    %rax,%rcx
+  80014b:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  800152:	00 00 00 
+  800155:	48 89 c2             	mov    %rax,%rdx
+  800158:	be 22 00 00 00       	mov    $0x22,%esi
+  80015d:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  800164:	00 00 00 
+  800167:	48 89 c7             	mov    %rax,%rdi
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	49 b9 2d 2f 80 00 00 	movabs $0x802f2d,%r9
+  800176:	00 00 00 
+  800179:	41 ff d1             	call   *%r9
+
+  return ret;
+  80017c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800180:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+0000000000800186 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  800186:	55                   	push   %rbp
+  800187:	48 89 e5             	mov    %rsp,%rbp
+  80018a:	48 83 ec 10          	sub    $0x10,%rsp
+  80018e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800192:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800196:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80019a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80019e:	48 83 ec 08          	sub    $0x8,%rsp
+  8001a2:	6a 00                	push   $0x0
+  8001a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001b0:	48 89 d1             	mov    %rdx,%rcx
+  8001b3:	48 89 c2             	mov    %rax,%rdx
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c0:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+  8001cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8001d0:	90                   	nop
+  8001d1:	c9                   	leave
+  8001d2:	c3                   	ret
+
+00000000008001d3 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8001d3:	55                   	push   %rbp
+  8001d4:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8001d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8001db:	6a 00                	push   $0x0
+  8001dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001fd:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+  800209:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+000000000080020f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	48 83 ec 10          	sub    $0x10,%rsp
+  800217:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80021a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80021d:	48 98                	cltq
+  80021f:	48 83 ec 08          	sub    $0x8,%rsp
+  800223:	6a 00                	push   $0x0
+  800225:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80022b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800231:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800236:	48 89 c2             	mov    %rax,%rdx
+  800239:	be 01 00 00 00       	mov    $0x1,%esi
+  80023e:	bf 03 00 00 00       	mov    $0x3,%edi
+  800243:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+  80024f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+
+0000000000800255 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	48 83 ec 10          	sub    $0x10,%rsp
+  80025d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  800260:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800263:	48 98                	cltq
+  800265:	48 83 ec 08          	sub    $0x8,%rsp
+  800269:	6a 00                	push   $0x0
+  80026b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800277:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80027c:	48 89 c2             	mov    %rax,%rdx
+  80027f:	be 00 00 00 00       	mov    $0x0,%esi
+  800284:	bf 04 00 00 00       	mov    $0x4,%edi
+  800289:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800290:	00 00 00 
+  800293:	ff d0                	call   *%rax
+  800295:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800299:	90                   	nop
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+000000000080029c <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80029c:	55                   	push   %rbp
+  80029d:	48 89 e5             	mov    %rsp,%rbp
+  8002a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8002a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8002ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ae:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8002b1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8002b6:	cd 30                	int    $0x30
+  8002b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8002bc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8002c0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8002c5:	7e 3d                	jle    800304 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8002c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002cb:	49 89 c0             	mov    %rax,%r8
+  8002ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002d3:	48 b8 d0 4f 80 00 00 	movabs $0x804fd0,%rax
+  8002da:	00 00 00 
+  8002dd:	48 89 c2             	mov    %rax,%rdx
+  8002e0:	be 49 00 00 00       	mov    $0x49,%esi
+  8002e5:	48 b8 ef 4f 80 00 00 	movabs $0x804fef,%rax
+  8002ec:	00 00 00 
+  8002ef:	48 89 c7             	mov    %rax,%rdi
+  8002f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f7:	49 b9 2d 2f 80 00 00 	movabs $0x802f2d,%r9
+  8002fe:	00 00 00 
+  800301:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  800304:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  800309:	75 13                	jne    80031e <sys_env_wait+0x82>
+  80030b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800310:	74 0c                	je     80031e <sys_env_wait+0x82>
+    *status = st;
+  800312:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800316:	89 c2                	mov    %eax,%edx
+  800318:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80031c:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80031e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+0000000000800324 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800324:	55                   	push   %rbp
+  800325:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800328:	48 83 ec 08          	sub    $0x8,%rsp
+  80032c:	6a 00                	push   $0x0
+  80032e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800334:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80033a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80033f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800344:	be 00 00 00 00       	mov    $0x0,%esi
+  800349:	bf 02 00 00 00       	mov    $0x2,%edi
+  80034e:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+  80035a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80035e:	c9                   	leave
+  80035f:	c3                   	ret
+
+0000000000800360 <sys_yield>:
+
+void
+sys_yield(void) {
+  800360:	55                   	push   %rbp
+  800361:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800364:	48 83 ec 08          	sub    $0x8,%rsp
+  800368:	6a 00                	push   $0x0
+  80036a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800376:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80037b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800380:	be 00 00 00 00       	mov    $0x0,%esi
+  800385:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80038a:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800391:	00 00 00 
+  800394:	ff d0                	call   *%rax
+  800396:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80039a:	90                   	nop
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+
+000000000080039d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80039d:	55                   	push   %rbp
+  80039e:	48 89 e5             	mov    %rsp,%rbp
+  8003a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8003a5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8003ac:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8003af:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003b2:	48 63 c8             	movslq %eax,%rcx
+  8003b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003bc:	48 98                	cltq
+  8003be:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c2:	6a 00                	push   $0x0
+  8003c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8003ca:	49 89 c8             	mov    %rcx,%r8
+  8003cd:	48 89 d1             	mov    %rdx,%rcx
+  8003d0:	48 89 c2             	mov    %rax,%rdx
+  8003d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8003dd:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8003e4:	00 00 00 
+  8003e7:	ff d0                	call   *%rax
+  8003e9:	48 83 c4 10          	add    $0x10,%rsp
+  8003ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8003f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+
+00000000008003f5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+  8003f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8003fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800400:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800404:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800407:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80040b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80040f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800412:	48 63 c8             	movslq %eax,%rcx
+  800415:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800419:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80041c:	48 63 f0             	movslq %eax,%rsi
+  80041f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800423:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800426:	48 98                	cltq
+  800428:	48 83 ec 08          	sub    $0x8,%rsp
+  80042c:	51                   	push   %rcx
+  80042d:	49 89 f9             	mov    %rdi,%r9
+  800430:	49 89 f0             	mov    %rsi,%r8
+  800433:	48 89 d1             	mov    %rdx,%rcx
+  800436:	48 89 c2             	mov    %rax,%rdx
+  800439:	be 01 00 00 00       	mov    $0x1,%esi
+  80043e:	bf 07 00 00 00       	mov    $0x7,%edi
+  800443:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80044a:	00 00 00 
+  80044d:	ff d0                	call   *%rax
+  80044f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800453:	c9                   	leave
+  800454:	c3                   	ret
+
+0000000000800455 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  800455:	55                   	push   %rbp
+  800456:	48 89 e5             	mov    %rsp,%rbp
+  800459:	48 83 ec 10          	sub    $0x10,%rsp
+  80045d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800460:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  800464:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800468:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046b:	48 98                	cltq
+  80046d:	48 83 ec 08          	sub    $0x8,%rsp
+  800471:	6a 00                	push   $0x0
+  800473:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800479:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80047f:	48 89 d1             	mov    %rdx,%rcx
+  800482:	48 89 c2             	mov    %rax,%rdx
+  800485:	be 01 00 00 00       	mov    $0x1,%esi
+  80048a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80048f:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800496:	00 00 00 
+  800499:	ff d0                	call   *%rax
+  80049b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80049f:	c9                   	leave
+  8004a0:	c3                   	ret
+
+00000000008004a1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8004a1:	55                   	push   %rbp
+  8004a2:	48 89 e5             	mov    %rsp,%rbp
+  8004a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8004a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004ac:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8004af:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8004b2:	48 63 d0             	movslq %eax,%rdx
+  8004b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004b8:	48 98                	cltq
+  8004ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8004be:	6a 00                	push   $0x0
+  8004c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004cc:	48 89 d1             	mov    %rdx,%rcx
+  8004cf:	48 89 c2             	mov    %rax,%rdx
+  8004d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8004d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8004dc:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8004e3:	00 00 00 
+  8004e6:	ff d0                	call   *%rax
+  8004e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004ec:	c9                   	leave
+  8004ed:	c3                   	ret
+
+00000000008004ee <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8004f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8004fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800501:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800504:	48 98                	cltq
+  800506:	48 83 ec 08          	sub    $0x8,%rsp
+  80050a:	6a 00                	push   $0x0
+  80050c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800512:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800518:	48 89 d1             	mov    %rdx,%rcx
+  80051b:	48 89 c2             	mov    %rax,%rdx
+  80051e:	be 01 00 00 00       	mov    $0x1,%esi
+  800523:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800528:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80052f:	00 00 00 
+  800532:	ff d0                	call   *%rax
+  800534:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800538:	c9                   	leave
+  800539:	c3                   	ret
+
+000000000080053a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80053a:	55                   	push   %rbp
+  80053b:	48 89 e5             	mov    %rsp,%rbp
+  80053e:	48 83 ec 10          	sub    $0x10,%rsp
+  800542:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800545:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  800549:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80054d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800550:	48 98                	cltq
+  800552:	48 83 ec 08          	sub    $0x8,%rsp
+  800556:	6a 00                	push   $0x0
+  800558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80055e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800564:	48 89 d1             	mov    %rdx,%rcx
+  800567:	48 89 c2             	mov    %rax,%rdx
+  80056a:	be 01 00 00 00       	mov    $0x1,%esi
+  80056f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800574:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80057b:	00 00 00 
+  80057e:	ff d0                	call   *%rax
+  800580:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800584:	c9                   	leave
+  800585:	c3                   	ret
+
+0000000000800586 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  800586:	55                   	push   %rbp
+  800587:	48 89 e5             	mov    %rsp,%rbp
+  80058a:	48 83 ec 20          	sub    $0x20,%rsp
+  80058e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800591:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800595:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800599:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80059c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80059f:	48 63 f0             	movslq %eax,%rsi
+  8005a2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8005ad:	48 98                	cltq
+  8005af:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b3:	6a 00                	push   $0x0
+  8005b5:	49 89 f1             	mov    %rsi,%r9
+  8005b8:	49 89 c8             	mov    %rcx,%r8
+  8005bb:	48 89 d1             	mov    %rdx,%rcx
+  8005be:	48 89 c2             	mov    %rax,%rdx
+  8005c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c6:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8005cb:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8005d2:	00 00 00 
+  8005d5:	ff d0                	call   *%rax
+  8005d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005db:	c9                   	leave
+  8005dc:	c3                   	ret
+
+00000000008005dd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8005dd:	55                   	push   %rbp
+  8005de:	48 89 e5             	mov    %rsp,%rbp
+  8005e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8005e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8005e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f1:	6a 00                	push   $0x0
+  8005f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800604:	48 89 c2             	mov    %rax,%rdx
+  800607:	be 01 00 00 00       	mov    $0x1,%esi
+  80060c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800611:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800618:	00 00 00 
+  80061b:	ff d0                	call   *%rax
+  80061d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800621:	c9                   	leave
+  800622:	c3                   	ret
+
+0000000000800623 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  800623:	55                   	push   %rbp
+  800624:	48 89 e5             	mov    %rsp,%rbp
+  800627:	48 83 ec 10          	sub    $0x10,%rsp
+  80062b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80062f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  800633:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80063b:	48 83 ec 08          	sub    $0x8,%rsp
+  80063f:	6a 00                	push   $0x0
+  800641:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800647:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80064d:	48 89 d1             	mov    %rdx,%rcx
+  800650:	48 89 c2             	mov    %rax,%rdx
+  800653:	be 01 00 00 00       	mov    $0x1,%esi
+  800658:	bf 10 00 00 00       	mov    $0x10,%edi
+  80065d:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800664:	00 00 00 
+  800667:	ff d0                	call   *%rax
+  800669:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80066d:	c9                   	leave
+  80066e:	c3                   	ret
+
+000000000080066f <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  800673:	48 83 ec 08          	sub    $0x8,%rsp
+  800677:	6a 00                	push   $0x0
+  800679:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80067f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068f:	be 00 00 00 00       	mov    $0x0,%esi
+  800694:	bf 11 00 00 00       	mov    $0x11,%edi
+  800699:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8006a0:	00 00 00 
+  8006a3:	ff d0                	call   *%rax
+  8006a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006a9:	c9                   	leave
+  8006aa:	c3                   	ret
+
+00000000008006ab <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8006ab:	55                   	push   %rbp
+  8006ac:	48 89 e5             	mov    %rsp,%rbp
+  8006af:	48 83 ec 10          	sub    $0x10,%rsp
+  8006b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8006bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c7:	6a 00                	push   $0x0
+  8006c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006d5:	48 89 d1             	mov    %rdx,%rcx
+  8006d8:	48 89 c2             	mov    %rax,%rdx
+  8006db:	be 00 00 00 00       	mov    $0x0,%esi
+  8006e0:	bf 12 00 00 00       	mov    $0x12,%edi
+  8006e5:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8006ec:	00 00 00 
+  8006ef:	ff d0                	call   *%rax
+  8006f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006f5:	c9                   	leave
+  8006f6:	c3                   	ret
+
+00000000008006f7 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8006f7:	55                   	push   %rbp
+  8006f8:	48 89 e5             	mov    %rsp,%rbp
+  8006fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8006ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800703:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800707:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80070a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80070d:	48 63 c8             	movslq %eax,%rcx
+  800710:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800718:	48 83 ec 08          	sub    $0x8,%rsp
+  80071c:	6a 00                	push   $0x0
+  80071e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800724:	49 89 c8             	mov    %rcx,%r8
+  800727:	48 89 d1             	mov    %rdx,%rcx
+  80072a:	48 89 c2             	mov    %rax,%rdx
+  80072d:	be 00 00 00 00       	mov    $0x0,%esi
+  800732:	bf 13 00 00 00       	mov    $0x13,%edi
+  800737:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80073e:	00 00 00 
+  800741:	ff d0                	call   *%rax
+  800743:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800747:	c9                   	leave
+  800748:	c3                   	ret
+
+0000000000800749 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  800749:	55                   	push   %rbp
+  80074a:	48 89 e5             	mov    %rsp,%rbp
+  80074d:	48 83 ec 20          	sub    $0x20,%rsp
+  800751:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800755:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800758:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80075c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800760:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800767:	48 83 ec 08          	sub    $0x8,%rsp
+  80076b:	6a 00                	push   $0x0
+  80076d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800773:	49 89 c8             	mov    %rcx,%r8
+  800776:	48 89 d1             	mov    %rdx,%rcx
+  800779:	48 89 c2             	mov    %rax,%rdx
+  80077c:	be 00 00 00 00       	mov    $0x0,%esi
+  800781:	bf 14 00 00 00       	mov    $0x14,%edi
+  800786:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80078d:	00 00 00 
+  800790:	ff d0                	call   *%rax
+  800792:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800796:	c9                   	leave
+  800797:	c3                   	ret
+
+0000000000800798 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  800798:	55                   	push   %rbp
+  800799:	48 89 e5             	mov    %rsp,%rbp
+  80079c:	48 83 ec 10          	sub    $0x10,%rsp
+  8007a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007a4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8007a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8007aa:	48 63 d0             	movslq %eax,%rdx
+  8007ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8007b5:	6a 00                	push   $0x0
+  8007b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007c3:	48 89 d1             	mov    %rdx,%rcx
+  8007c6:	48 89 c2             	mov    %rax,%rdx
+  8007c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8007ce:	bf 15 00 00 00       	mov    $0x15,%edi
+  8007d3:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8007da:	00 00 00 
+  8007dd:	ff d0                	call   *%rax
+  8007df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007e3:	c9                   	leave
+  8007e4:	c3                   	ret
+
+00000000008007e5 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8007e5:	55                   	push   %rbp
+  8007e6:	48 89 e5             	mov    %rsp,%rbp
+  8007e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8007ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007f1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8007f4:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8007f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8007fb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8007ff:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800802:	48 63 c8             	movslq %eax,%rcx
+  800805:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800808:	48 63 d0             	movslq %eax,%rdx
+  80080b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080f:	48 83 ec 08          	sub    $0x8,%rsp
+  800813:	6a 00                	push   $0x0
+  800815:	49 89 f1             	mov    %rsi,%r9
+  800818:	49 89 c8             	mov    %rcx,%r8
+  80081b:	48 89 d1             	mov    %rdx,%rcx
+  80081e:	48 89 c2             	mov    %rax,%rdx
+  800821:	be 00 00 00 00       	mov    $0x0,%esi
+  800826:	bf 16 00 00 00       	mov    $0x16,%edi
+  80082b:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800832:	00 00 00 
+  800835:	ff d0                	call   *%rax
+  800837:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80083b:	c9                   	leave
+  80083c:	c3                   	ret
+
+000000000080083d <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+  800841:	48 83 ec 30          	sub    $0x30,%rsp
+  800845:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800849:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80084d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800851:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  800855:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  800859:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80085d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  800861:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800865:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800869:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086d:	48 83 ec 08          	sub    $0x8,%rsp
+  800871:	51                   	push   %rcx
+  800872:	49 89 f9             	mov    %rdi,%r9
+  800875:	49 89 f0             	mov    %rsi,%r8
+  800878:	48 89 d1             	mov    %rdx,%rcx
+  80087b:	48 89 c2             	mov    %rax,%rdx
+  80087e:	be 00 00 00 00       	mov    $0x0,%esi
+  800883:	bf 17 00 00 00       	mov    $0x17,%edi
+  800888:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80088f:	00 00 00 
+  800892:	ff d0                	call   *%rax
+  800894:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800898:	c9                   	leave
+  800899:	c3                   	ret
+
+000000000080089a <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80089a:	55                   	push   %rbp
+  80089b:	48 89 e5             	mov    %rsp,%rbp
+  80089e:	48 83 ec 10          	sub    $0x10,%rsp
+  8008a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8008a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008a8:	48 98                	cltq
+  8008aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ae:	6a 00                	push   $0x0
+  8008b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8008b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c1:	48 89 c2             	mov    %rax,%rdx
+  8008c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8008c9:	bf 18 00 00 00       	mov    $0x18,%edi
+  8008ce:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8008d5:	00 00 00 
+  8008d8:	ff d0                	call   *%rax
+  8008da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008de:	90                   	nop
+  8008df:	c9                   	leave
+  8008e0:	c3                   	ret
+
+00000000008008e1 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8008e1:	55                   	push   %rbp
+  8008e2:	48 89 e5             	mov    %rsp,%rbp
+  8008e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8008e9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8008f4:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8008f7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8008fa:	48 63 f0             	movslq %eax,%rsi
+  8008fd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800901:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800905:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800908:	48 98                	cltq
+  80090a:	48 83 ec 08          	sub    $0x8,%rsp
+  80090e:	6a 00                	push   $0x0
+  800910:	49 89 f1             	mov    %rsi,%r9
+  800913:	49 89 c8             	mov    %rcx,%r8
+  800916:	48 89 d1             	mov    %rdx,%rcx
+  800919:	48 89 c2             	mov    %rax,%rdx
+  80091c:	be 01 00 00 00       	mov    $0x1,%esi
+  800921:	bf 19 00 00 00       	mov    $0x19,%edi
+  800926:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  80092d:	00 00 00 
+  800930:	ff d0                	call   *%rax
+  800932:	48 83 c4 10          	add    $0x10,%rsp
+  800936:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800939:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80093c:	c9                   	leave
+  80093d:	c3                   	ret
+
+000000000080093e <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80093e:	55                   	push   %rbp
+  80093f:	48 89 e5             	mov    %rsp,%rbp
+  800942:	48 83 ec 20          	sub    $0x20,%rsp
+  800946:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80094a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80094e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  800951:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800954:	48 63 c8             	movslq %eax,%rcx
+  800957:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80095b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80095f:	48 83 ec 08          	sub    $0x8,%rsp
+  800963:	6a 00                	push   $0x0
+  800965:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80096b:	49 89 c8             	mov    %rcx,%r8
+  80096e:	48 89 d1             	mov    %rdx,%rcx
+  800971:	48 89 c2             	mov    %rax,%rdx
+  800974:	be 01 00 00 00       	mov    $0x1,%esi
+  800979:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80097e:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800985:	00 00 00 
+  800988:	ff d0                	call   *%rax
+  80098a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+
+0000000000800990 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  800990:	55                   	push   %rbp
+  800991:	48 89 e5             	mov    %rsp,%rbp
+  800994:	48 83 ec 20          	sub    $0x20,%rsp
+  800998:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80099c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009a0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8009a4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b4:	6a 00                	push   $0x0
+  8009b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8009bc:	49 89 c8             	mov    %rcx,%r8
+  8009bf:	48 89 d1             	mov    %rdx,%rcx
+  8009c2:	48 89 c2             	mov    %rax,%rdx
+  8009c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8009ca:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8009cf:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  8009d6:	00 00 00 
+  8009d9:	ff d0                	call   *%rax
+  8009db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8009df:	c9                   	leave
+  8009e0:	c3                   	ret
+
+00000000008009e1 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8009e1:	55                   	push   %rbp
+  8009e2:	48 89 e5             	mov    %rsp,%rbp
+  8009e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8009e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009f1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8009f4:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8009f8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8009fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8009ff:	48 63 c8             	movslq %eax,%rcx
+  800a02:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0a:	48 83 ec 08          	sub    $0x8,%rsp
+  800a0e:	6a 00                	push   $0x0
+  800a10:	49 89 f1             	mov    %rsi,%r9
+  800a13:	49 89 c8             	mov    %rcx,%r8
+  800a16:	48 89 d1             	mov    %rdx,%rcx
+  800a19:	48 89 c2             	mov    %rax,%rdx
+  800a1c:	be 01 00 00 00       	mov    $0x1,%esi
+  800a21:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  800a26:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800a2d:	00 00 00 
+  800a30:	ff d0                	call   *%rax
+  800a32:	48 83 c4 10          	add    $0x10,%rsp
+  800a36:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  800a39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800a3c:	c9                   	leave
+  800a3d:	c3                   	ret
+
+0000000000800a3e <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  800a3e:	55                   	push   %rbp
+  800a3f:	48 89 e5             	mov    %rsp,%rbp
+  800a42:	48 83 ec 10          	sub    $0x10,%rsp
+  800a46:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  800a49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800a4c:	48 98                	cltq
+  800a4e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a52:	6a 00                	push   $0x0
+  800a54:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a65:	48 89 c2             	mov    %rax,%rdx
+  800a68:	be 01 00 00 00       	mov    $0x1,%esi
+  800a6d:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  800a72:	48 b8 ed 00 80 00 00 	movabs $0x8000ed,%rax
+  800a79:	00 00 00 
+  800a7c:	ff d0                	call   *%rax
+  800a7e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a82:	c9                   	leave
+  800a83:	c3                   	ret
+
+0000000000800a84 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  800a84:	55                   	push   %rbp
+  800a85:	48 89 e5             	mov    %rsp,%rbp
+  800a88:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a94:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800a9b:	ff ff ff 
+  800a9e:	48 01 d0             	add    %rdx,%rax
+  800aa1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+0000000000800aa7 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  800aa7:	55                   	push   %rbp
+  800aa8:	48 89 e5             	mov    %rsp,%rbp
+  800aab:	48 83 ec 08          	sub    $0x8,%rsp
+  800aaf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  800ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab7:	48 89 c7             	mov    %rax,%rdi
+  800aba:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+  800ac6:	48 05 01 68 00 00    	add    $0x6801,%rax
+  800acc:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  800ad0:	c9                   	leave
+  800ad1:	c3                   	ret
+
+0000000000800ad2 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  800ad2:	55                   	push   %rbp
+  800ad3:	48 89 e5             	mov    %rsp,%rbp
+  800ad6:	48 83 ec 18          	sub    $0x18,%rsp
+  800ada:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800ade:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800ae5:	e9 ae 00 00 00       	jmp    800b98 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  800aea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800aed:	c1 e0 0c             	shl    $0xc,%eax
+  800af0:	48 98                	cltq
+  800af2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800af7:	48 01 d0             	add    %rdx,%rax
+  800afa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800afe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b02:	48 c1 e8 27          	shr    $0x27,%rax
+  800b06:	48 89 c2             	mov    %rax,%rdx
+  800b09:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800b10:	01 00 00 
+  800b13:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b17:	83 e0 01             	and    $0x1,%eax
+  800b1a:	48 85 c0             	test   %rax,%rax
+  800b1d:	74 63                	je     800b82 <fd_alloc+0xb0>
+  800b1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b23:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800b27:	48 89 c2             	mov    %rax,%rdx
+  800b2a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800b31:	01 00 00 
+  800b34:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b38:	83 e0 01             	and    $0x1,%eax
+  800b3b:	48 85 c0             	test   %rax,%rax
+  800b3e:	74 42                	je     800b82 <fd_alloc+0xb0>
+  800b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b44:	48 c1 e8 15          	shr    $0x15,%rax
+  800b48:	48 89 c2             	mov    %rax,%rdx
+  800b4b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800b52:	01 00 00 
+  800b55:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b59:	83 e0 01             	and    $0x1,%eax
+  800b5c:	48 85 c0             	test   %rax,%rax
+  800b5f:	74 21                	je     800b82 <fd_alloc+0xb0>
+  800b61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b65:	48 c1 e8 0c          	shr    $0xc,%rax
+  800b69:	48 89 c2             	mov    %rax,%rdx
+  800b6c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800b73:	01 00 00 
+  800b76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800b7a:	83 e0 01             	and    $0x1,%eax
+  800b7d:	48 85 c0             	test   %rax,%rax
+  800b80:	75 12                	jne    800b94 <fd_alloc+0xc2>
+      *fd_store = fd;
+  800b82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b8a:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  800b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b92:	eb 1e                	jmp    800bb2 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  800b94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800b98:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800b9c:	0f 8e 48 ff ff ff    	jle    800aea <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  800ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  800bad:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  800bb2:	c9                   	leave
+  800bb3:	c3                   	ret
+
+0000000000800bb4 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800bb4:	55                   	push   %rbp
+  800bb5:	48 89 e5             	mov    %rsp,%rbp
+  800bb8:	48 83 ec 20          	sub    $0x20,%rsp
+  800bbc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bbf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800bc3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800bc7:	78 06                	js     800bcf <fd_lookup+0x1b>
+  800bc9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800bcd:	7e 0a                	jle    800bd9 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800bcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd4:	e9 af 00 00 00       	jmp    800c88 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  800bd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bdc:	c1 e0 0c             	shl    $0xc,%eax
+  800bdf:	48 98                	cltq
+  800be1:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800be6:	48 01 d0             	add    %rdx,%rax
+  800be9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800bed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bf1:	48 c1 e8 27          	shr    $0x27,%rax
+  800bf5:	48 89 c2             	mov    %rax,%rdx
+  800bf8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800bff:	01 00 00 
+  800c02:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c06:	83 e0 01             	and    $0x1,%eax
+  800c09:	48 85 c0             	test   %rax,%rax
+  800c0c:	74 63                	je     800c71 <fd_lookup+0xbd>
+  800c0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c12:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800c16:	48 89 c2             	mov    %rax,%rdx
+  800c19:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800c20:	01 00 00 
+  800c23:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c27:	83 e0 01             	and    $0x1,%eax
+  800c2a:	48 85 c0             	test   %rax,%rax
+  800c2d:	74 42                	je     800c71 <fd_lookup+0xbd>
+  800c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c33:	48 c1 e8 15          	shr    $0x15,%rax
+  800c37:	48 89 c2             	mov    %rax,%rdx
+  800c3a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800c41:	01 00 00 
+  800c44:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c48:	83 e0 01             	and    $0x1,%eax
+  800c4b:	48 85 c0             	test   %rax,%rax
+  800c4e:	74 21                	je     800c71 <fd_lookup+0xbd>
+  800c50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c54:	48 c1 e8 0c          	shr    $0xc,%rax
+  800c58:	48 89 c2             	mov    %rax,%rdx
+  800c5b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800c62:	01 00 00 
+  800c65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800c69:	83 e0 01             	and    $0x1,%eax
+  800c6c:	48 85 c0             	test   %rax,%rax
+  800c6f:	75 07                	jne    800c78 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  800c71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c76:	eb 10                	jmp    800c88 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  800c78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c80:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c88:	c9                   	leave
+  800c89:	c3                   	ret
+
+0000000000800c8a <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  800c8a:	55                   	push   %rbp
+  800c8b:	48 89 e5             	mov    %rsp,%rbp
+  800c8e:	48 83 ec 30          	sub    $0x30,%rsp
+  800c92:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c96:	89 f0                	mov    %esi,%eax
+  800c98:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  800c9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c9f:	48 89 c7             	mov    %rax,%rdi
+  800ca2:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  800ca9:	00 00 00 
+  800cac:	ff d0                	call   *%rax
+  800cae:	89 c2                	mov    %eax,%edx
+  800cb0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800cb4:	48 89 c6             	mov    %rax,%rsi
+  800cb7:	89 d7                	mov    %edx,%edi
+  800cb9:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  800cc0:	00 00 00 
+  800cc3:	ff d0                	call   *%rax
+  800cc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800cc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ccc:	78 0a                	js     800cd8 <fd_close+0x4e>
+  800cce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cd2:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800cd6:	74 12                	je     800cea <fd_close+0x60>
+    return (must_exist ? r : 0);
+  800cd8:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800cdc:	74 05                	je     800ce3 <fd_close+0x59>
+  800cde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ce1:	eb 70                	jmp    800d53 <fd_close+0xc9>
+  800ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce8:	eb 69                	jmp    800d53 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cee:	8b 00                	mov    (%rax),%eax
+  800cf0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800cf4:	48 89 d6             	mov    %rdx,%rsi
+  800cf7:	89 c7                	mov    %eax,%edi
+  800cf9:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+  800d05:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800d0c:	78 2a                	js     800d38 <fd_close+0xae>
+    if (dev->dev_close)
+  800d0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d12:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d16:	48 85 c0             	test   %rax,%rax
+  800d19:	74 16                	je     800d31 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  800d1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1f:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800d23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d27:	48 89 c7             	mov    %rax,%rdi
+  800d2a:	ff d2                	call   *%rdx
+  800d2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800d2f:	eb 07                	jmp    800d38 <fd_close+0xae>
+    else
+      r = 0;
+  800d31:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  800d38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d3c:	48 89 c6             	mov    %rax,%rsi
+  800d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d44:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  800d4b:	00 00 00 
+  800d4e:	ff d0                	call   *%rax
+  return r;
+  800d50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800d53:	c9                   	leave
+  800d54:	c3                   	ret
+
+0000000000800d55 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800d55:	55                   	push   %rbp
+  800d56:	48 89 e5             	mov    %rsp,%rbp
+  800d59:	48 83 ec 20          	sub    $0x20,%rsp
+  800d5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d60:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  800d64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800d6b:	eb 3f                	jmp    800dac <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  800d6d:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d74:	00 00 00 
+  800d77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d7a:	48 98                	cltq
+  800d7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800d80:	8b 00                	mov    (%rax),%eax
+  800d82:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800d85:	75 21                	jne    800da8 <dev_lookup+0x53>
+      *dev = devtab[i];
+  800d87:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800d8e:	00 00 00 
+  800d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800d94:	48 98                	cltq
+  800d96:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800d9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d9e:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  800da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da6:	eb 7f                	jmp    800e27 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  800da8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800dac:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  800db3:	00 00 00 
+  800db6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800db9:	48 98                	cltq
+  800dbb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800dbf:	48 85 c0             	test   %rax,%rax
+  800dc2:	75 a9                	jne    800d6d <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800dc4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800dcb:	00 00 00 
+  800dce:	8b 40 04             	mov    0x4(%rax),%eax
+  800dd1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800dd6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800ddd:	00 00 00 
+  800de0:	48 98                	cltq
+  800de2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800de9:	48 01 d0             	add    %rdx,%rax
+  800dec:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800df2:	8b 00                	mov    (%rax),%eax
+  800df4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800df7:	89 c6                	mov    %eax,%esi
+  800df9:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800e00:	00 00 00 
+  800e03:	48 89 c7             	mov    %rax,%rdi
+  800e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0b:	48 b9 4c 31 80 00 00 	movabs $0x80314c,%rcx
+  800e12:	00 00 00 
+  800e15:	ff d1                	call   *%rcx
+  *dev = 0;
+  800e17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e1b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  800e22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800e27:	c9                   	leave
+  800e28:	c3                   	ret
+
+0000000000800e29 <close>:
+
+int
+close(int fdnum) {
+  800e29:	55                   	push   %rbp
+  800e2a:	48 89 e5             	mov    %rsp,%rbp
+  800e2d:	48 83 ec 20          	sub    $0x20,%rsp
+  800e31:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e34:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800e38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e3b:	48 89 d6             	mov    %rdx,%rsi
+  800e3e:	89 c7                	mov    %eax,%edi
+  800e40:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+  800e4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e4f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800e53:	79 05                	jns    800e5a <close+0x31>
+    return r;
+  800e55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e58:	eb 18                	jmp    800e72 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  800e5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800e5e:	be 01 00 00 00       	mov    $0x1,%esi
+  800e63:	48 89 c7             	mov    %rax,%rdi
+  800e66:	48 b8 8a 0c 80 00 00 	movabs $0x800c8a,%rax
+  800e6d:	00 00 00 
+  800e70:	ff d0                	call   *%rax
+}
+  800e72:	c9                   	leave
+  800e73:	c3                   	ret
+
+0000000000800e74 <close_all>:
+
+void
+close_all(void) {
+  800e74:	55                   	push   %rbp
+  800e75:	48 89 e5             	mov    %rsp,%rbp
+  800e78:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  800e7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e83:	eb 15                	jmp    800e9a <close_all+0x26>
+    close(i);
+  800e85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e88:	89 c7                	mov    %eax,%edi
+  800e8a:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  800e91:	00 00 00 
+  800e94:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  800e96:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e9a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800e9e:	7e e5                	jle    800e85 <close_all+0x11>
+}
+  800ea0:	90                   	nop
+  800ea1:	90                   	nop
+  800ea2:	c9                   	leave
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  800ea4:	55                   	push   %rbp
+  800ea5:	48 89 e5             	mov    %rsp,%rbp
+  800ea8:	48 83 ec 40          	sub    $0x40,%rsp
+  800eac:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800eaf:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800eb2:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800eb6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800eb9:	48 89 d6             	mov    %rdx,%rsi
+  800ebc:	89 c7                	mov    %eax,%edi
+  800ebe:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+  800eca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800ecd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800ed1:	79 08                	jns    800edb <dup+0x37>
+    return r;
+  800ed3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800ed6:	e9 33 02 00 00       	jmp    80110e <dup+0x26a>
+  close(newfdnum);
+  800edb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ede:	89 c7                	mov    %eax,%edi
+  800ee0:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  800ee7:	00 00 00 
+  800eea:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  800eec:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800eef:	c1 e0 0c             	shl    $0xc,%eax
+  800ef2:	48 98                	cltq
+  800ef4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  800ef9:	48 01 d0             	add    %rdx,%rax
+  800efc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  800f00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f04:	48 89 c7             	mov    %rax,%rdi
+  800f07:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800f0e:	00 00 00 
+  800f11:	ff d0                	call   *%rax
+  800f13:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  800f17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f1b:	48 89 c7             	mov    %rax,%rdi
+  800f1e:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800f25:	00 00 00 
+  800f28:	ff d0                	call   *%rax
+  800f2a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  800f2e:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  800f35:	00 
+  800f36:	e9 19 01 00 00       	jmp    801054 <dup+0x1b0>
+    off -= PGSIZE;
+  800f3b:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  800f42:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800f43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f4b:	48 01 d0             	add    %rdx,%rax
+  800f4e:	48 c1 e8 27          	shr    $0x27,%rax
+  800f52:	48 89 c2             	mov    %rax,%rdx
+  800f55:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  800f5c:	01 00 00 
+  800f5f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f63:	83 e0 01             	and    $0x1,%eax
+  800f66:	48 85 c0             	test   %rax,%rax
+  800f69:	0f 84 e5 00 00 00    	je     801054 <dup+0x1b0>
+  800f6f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f77:	48 01 d0             	add    %rdx,%rax
+  800f7a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  800f7e:	48 89 c2             	mov    %rax,%rdx
+  800f81:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  800f88:	01 00 00 
+  800f8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f8f:	83 e0 01             	and    $0x1,%eax
+  800f92:	48 85 c0             	test   %rax,%rax
+  800f95:	0f 84 b9 00 00 00    	je     801054 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800f9b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa3:	48 01 d0             	add    %rdx,%rax
+  800fa6:	48 c1 e8 15          	shr    $0x15,%rax
+  800faa:	48 89 c2             	mov    %rax,%rdx
+  800fad:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  800fb4:	01 00 00 
+  800fb7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fbb:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  800fbe:	48 85 c0             	test   %rax,%rax
+  800fc1:	0f 84 8d 00 00 00    	je     801054 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800fc7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fcf:	48 01 d0             	add    %rdx,%rax
+  800fd2:	48 c1 e8 0c          	shr    $0xc,%rax
+  800fd6:	48 89 c2             	mov    %rax,%rdx
+  800fd9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  800fe0:	01 00 00 
+  800fe3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fe7:	83 e0 01             	and    $0x1,%eax
+  800fea:	48 85 c0             	test   %rax,%rax
+  800fed:	74 65                	je     801054 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800fef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ff3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ff7:	48 01 d0             	add    %rdx,%rax
+  800ffa:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ffe:	48 89 c2             	mov    %rax,%rdx
+  801001:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801008:	01 00 00 
+  80100b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80100f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801014:	89 c6                	mov    %eax,%esi
+  801016:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80101a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80101e:	48 01 c2             	add    %rax,%rdx
+  801021:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801025:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801029:	48 01 c8             	add    %rcx,%rax
+  80102c:	41 89 f0             	mov    %esi,%r8d
+  80102f:	48 89 d1             	mov    %rdx,%rcx
+  801032:	ba 00 00 00 00       	mov    $0x0,%edx
+  801037:	48 89 c6             	mov    %rax,%rsi
+  80103a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103f:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  801046:	00 00 00 
+  801049:	ff d0                	call   *%rax
+  80104b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80104e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801052:	78 60                	js     8010b4 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  801054:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  801059:	0f 85 dc fe ff ff    	jne    800f3b <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80105f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801063:	48 c1 e8 0c          	shr    $0xc,%rax
+  801067:	48 89 c2             	mov    %rax,%rdx
+  80106a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801071:	01 00 00 
+  801074:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801078:	25 07 0e 00 00       	and    $0xe07,%eax
+  80107d:	89 c1                	mov    %eax,%ecx
+  80107f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801083:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801087:	41 89 c8             	mov    %ecx,%r8d
+  80108a:	48 89 d1             	mov    %rdx,%rcx
+  80108d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801092:	48 89 c6             	mov    %rax,%rsi
+  801095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80109a:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  8010a1:	00 00 00 
+  8010a4:	ff d0                	call   *%rax
+  8010a6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8010ad:	78 08                	js     8010b7 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8010af:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8010b2:	eb 5a                	jmp    80110e <dup+0x26a>
+        goto err;
+  8010b4:	90                   	nop
+  8010b5:	eb 01                	jmp    8010b8 <dup+0x214>
+    goto err;
+  8010b7:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8010b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010bc:	48 89 c6             	mov    %rax,%rsi
+  8010bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c4:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  8010cb:	00 00 00 
+  8010ce:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010d0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8010d7:	00 
+  8010d8:	eb 27                	jmp    801101 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8010da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010e2:	48 01 d0             	add    %rdx,%rax
+  8010e5:	48 89 c6             	mov    %rax,%rsi
+  8010e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ed:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  8010f4:	00 00 00 
+  8010f7:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8010f9:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  801100:	00 
+  801101:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  801108:	00 
+  801109:	76 cf                	jbe    8010da <dup+0x236>
+  return r;
+  80110b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80110e:	c9                   	leave
+  80110f:	c3                   	ret
+
+0000000000801110 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801110:	55                   	push   %rbp
+  801111:	48 89 e5             	mov    %rsp,%rbp
+  801114:	48 83 ec 40          	sub    $0x40,%rsp
+  801118:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80111b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80111f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801123:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801127:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80112a:	48 89 d6             	mov    %rdx,%rsi
+  80112d:	89 c7                	mov    %eax,%edi
+  80112f:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  801136:	00 00 00 
+  801139:	ff d0                	call   *%rax
+  80113b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80113e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801142:	78 24                	js     801168 <read+0x58>
+  801144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801148:	8b 00                	mov    (%rax),%eax
+  80114a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80114e:	48 89 d6             	mov    %rdx,%rsi
+  801151:	89 c7                	mov    %eax,%edi
+  801153:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  80115a:	00 00 00 
+  80115d:	ff d0                	call   *%rax
+  80115f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801162:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801166:	79 0a                	jns    801172 <read+0x62>
+    return r;
+  801168:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80116b:	48 98                	cltq
+  80116d:	e9 9e 00 00 00       	jmp    801210 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801172:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801176:	8b 40 08             	mov    0x8(%rax),%eax
+  801179:	83 e0 03             	and    $0x3,%eax
+  80117c:	83 f8 01             	cmp    $0x1,%eax
+  80117f:	75 5c                	jne    8011dd <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801181:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801188:	00 00 00 
+  80118b:	8b 40 04             	mov    0x4(%rax),%eax
+  80118e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801193:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80119a:	00 00 00 
+  80119d:	48 98                	cltq
+  80119f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8011a6:	48 01 d0             	add    %rdx,%rax
+  8011a9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8011af:	8b 00                	mov    (%rax),%eax
+  8011b1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8011b4:	89 c6                	mov    %eax,%esi
+  8011b6:	48 b8 1f 50 80 00 00 	movabs $0x80501f,%rax
+  8011bd:	00 00 00 
+  8011c0:	48 89 c7             	mov    %rax,%rdi
+  8011c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c8:	48 b9 4c 31 80 00 00 	movabs $0x80314c,%rcx
+  8011cf:	00 00 00 
+  8011d2:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8011d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8011db:	eb 33                	jmp    801210 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8011dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8011e5:	48 85 c0             	test   %rax,%rax
+  8011e8:	75 09                	jne    8011f3 <read+0xe3>
+    return -E_NOT_SUPP;
+  8011ea:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8011f1:	eb 1d                	jmp    801210 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8011f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011f7:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8011fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801203:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801207:	48 89 ce             	mov    %rcx,%rsi
+  80120a:	48 89 c7             	mov    %rax,%rdi
+  80120d:	41 ff d0             	call   *%r8
+}
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+
+0000000000801212 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801212:	55                   	push   %rbp
+  801213:	48 89 e5             	mov    %rsp,%rbp
+  801216:	48 83 ec 30          	sub    $0x30,%rsp
+  80121a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80121d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801221:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801225:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80122c:	eb 49                	jmp    801277 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  80122e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801231:	48 98                	cltq
+  801233:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801237:	48 29 c2             	sub    %rax,%rdx
+  80123a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80123d:	48 63 c8             	movslq %eax,%rcx
+  801240:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801244:	48 01 c1             	add    %rax,%rcx
+  801247:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80124a:	48 89 ce             	mov    %rcx,%rsi
+  80124d:	89 c7                	mov    %eax,%edi
+  80124f:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  801256:	00 00 00 
+  801259:	ff d0                	call   *%rax
+  80125b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  80125e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  801262:	79 07                	jns    80126b <readn+0x59>
+      return m;
+  801264:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801267:	48 98                	cltq
+  801269:	eb 1f                	jmp    80128a <readn+0x78>
+    if (m == 0)
+  80126b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80126f:	74 13                	je     801284 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  801271:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801274:	01 45 fc             	add    %eax,-0x4(%rbp)
+  801277:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80127a:	48 98                	cltq
+  80127c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801280:	72 ac                	jb     80122e <readn+0x1c>
+  801282:	eb 01                	jmp    801285 <readn+0x73>
+      break;
+  801284:	90                   	nop
+  }
+  return tot;
+  801285:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801288:	48 98                	cltq
+}
+  80128a:	c9                   	leave
+  80128b:	c3                   	ret
+
+000000000080128c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80128c:	55                   	push   %rbp
+  80128d:	48 89 e5             	mov    %rsp,%rbp
+  801290:	48 83 ec 40          	sub    $0x40,%rsp
+  801294:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801297:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80129b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80129f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8012a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012a6:	48 89 d6             	mov    %rdx,%rsi
+  8012a9:	89 c7                	mov    %eax,%edi
+  8012ab:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  8012b2:	00 00 00 
+  8012b5:	ff d0                	call   *%rax
+  8012b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012be:	78 24                	js     8012e4 <write+0x58>
+  8012c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c4:	8b 00                	mov    (%rax),%eax
+  8012c6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8012ca:	48 89 d6             	mov    %rdx,%rsi
+  8012cd:	89 c7                	mov    %eax,%edi
+  8012cf:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  8012d6:	00 00 00 
+  8012d9:	ff d0                	call   *%rax
+  8012db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8012de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8012e2:	79 0a                	jns    8012ee <write+0x62>
+    return r;
+  8012e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012e7:	48 98                	cltq
+  8012e9:	e9 9d 00 00 00       	jmp    80138b <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8012ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f2:	8b 40 08             	mov    0x8(%rax),%eax
+  8012f5:	83 e0 03             	and    $0x3,%eax
+  8012f8:	85 c0                	test   %eax,%eax
+  8012fa:	75 5c                	jne    801358 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012fc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801303:	00 00 00 
+  801306:	8b 40 04             	mov    0x4(%rax),%eax
+  801309:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80130e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801315:	00 00 00 
+  801318:	48 98                	cltq
+  80131a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801321:	48 01 d0             	add    %rdx,%rax
+  801324:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80132a:	8b 00                	mov    (%rax),%eax
+  80132c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80132f:	89 c6                	mov    %eax,%esi
+  801331:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  801338:	00 00 00 
+  80133b:	48 89 c7             	mov    %rax,%rdi
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801343:	48 b9 4c 31 80 00 00 	movabs $0x80314c,%rcx
+  80134a:	00 00 00 
+  80134d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80134f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801356:	eb 33                	jmp    80138b <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  801358:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801360:	48 85 c0             	test   %rax,%rax
+  801363:	75 09                	jne    80136e <write+0xe2>
+    return -E_NOT_SUPP;
+  801365:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80136c:	eb 1d                	jmp    80138b <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80136e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801372:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801376:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80137e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  801382:	48 89 ce             	mov    %rcx,%rsi
+  801385:	48 89 c7             	mov    %rax,%rdi
+  801388:	41 ff d0             	call   *%r8
+}
+  80138b:	c9                   	leave
+  80138c:	c3                   	ret
+
+000000000080138d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80138d:	55                   	push   %rbp
+  80138e:	48 89 e5             	mov    %rsp,%rbp
+  801391:	48 83 ec 18          	sub    $0x18,%rsp
+  801395:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801398:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80139b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80139f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013a2:	48 89 d6             	mov    %rdx,%rsi
+  8013a5:	89 c7                	mov    %eax,%edi
+  8013a7:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  8013ae:	00 00 00 
+  8013b1:	ff d0                	call   *%rax
+  8013b3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013ba:	79 05                	jns    8013c1 <seek+0x34>
+    return r;
+  8013bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013bf:	eb 0f                	jmp    8013d0 <seek+0x43>
+  fd->fd_offset = offset;
+  8013c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8013c8:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8013cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d0:	c9                   	leave
+  8013d1:	c3                   	ret
+
+00000000008013d2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8013d2:	55                   	push   %rbp
+  8013d3:	48 89 e5             	mov    %rsp,%rbp
+  8013d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8013da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8013dd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013e0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8013e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013e7:	48 89 d6             	mov    %rdx,%rsi
+  8013ea:	89 c7                	mov    %eax,%edi
+  8013ec:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  8013f3:	00 00 00 
+  8013f6:	ff d0                	call   *%rax
+  8013f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013ff:	78 24                	js     801425 <ftruncate+0x53>
+  801401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801405:	8b 00                	mov    (%rax),%eax
+  801407:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80140b:	48 89 d6             	mov    %rdx,%rsi
+  80140e:	89 c7                	mov    %eax,%edi
+  801410:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  801417:	00 00 00 
+  80141a:	ff d0                	call   *%rax
+  80141c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80141f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801423:	79 08                	jns    80142d <ftruncate+0x5b>
+    return r;
+  801425:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801428:	e9 92 00 00 00       	jmp    8014bf <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80142d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801431:	8b 40 08             	mov    0x8(%rax),%eax
+  801434:	83 e0 03             	and    $0x3,%eax
+  801437:	85 c0                	test   %eax,%eax
+  801439:	75 5a                	jne    801495 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80143b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  801442:	00 00 00 
+  801445:	8b 40 04             	mov    0x4(%rax),%eax
+  801448:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80144d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  801454:	00 00 00 
+  801457:	48 98                	cltq
+  801459:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  801460:	48 01 d0             	add    %rdx,%rax
+  801463:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  801469:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80146b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80146e:	89 c6                	mov    %eax,%esi
+  801470:	48 b8 58 50 80 00 00 	movabs $0x805058,%rax
+  801477:	00 00 00 
+  80147a:	48 89 c7             	mov    %rax,%rdi
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	48 b9 4c 31 80 00 00 	movabs $0x80314c,%rcx
+  801489:	00 00 00 
+  80148c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80148e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801493:	eb 2a                	jmp    8014bf <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  801495:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801499:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80149d:	48 85 c0             	test   %rax,%rax
+  8014a0:	75 07                	jne    8014a9 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8014a2:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8014a7:	eb 16                	jmp    8014bf <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8014a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ad:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8014b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8014b8:	89 d6                	mov    %edx,%esi
+  8014ba:	48 89 c7             	mov    %rax,%rdi
+  8014bd:	ff d1                	call   *%rcx
+}
+  8014bf:	c9                   	leave
+  8014c0:	c3                   	ret
+
+00000000008014c1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8014c1:	55                   	push   %rbp
+  8014c2:	48 89 e5             	mov    %rsp,%rbp
+  8014c5:	48 83 ec 30          	sub    $0x30,%rsp
+  8014c9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8014cc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8014d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014d7:	48 89 d6             	mov    %rdx,%rsi
+  8014da:	89 c7                	mov    %eax,%edi
+  8014dc:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  8014e3:	00 00 00 
+  8014e6:	ff d0                	call   *%rax
+  8014e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8014eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014ef:	78 24                	js     801515 <fstat+0x54>
+  8014f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f5:	8b 00                	mov    (%rax),%eax
+  8014f7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8014fb:	48 89 d6             	mov    %rdx,%rsi
+  8014fe:	89 c7                	mov    %eax,%edi
+  801500:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  801507:	00 00 00 
+  80150a:	ff d0                	call   *%rax
+  80150c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80150f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801513:	79 05                	jns    80151a <fstat+0x59>
+    return r;
+  801515:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801518:	eb 5e                	jmp    801578 <fstat+0xb7>
+  if (!dev->dev_stat)
+  80151a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801522:	48 85 c0             	test   %rax,%rax
+  801525:	75 07                	jne    80152e <fstat+0x6d>
+    return -E_NOT_SUPP;
+  801527:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80152c:	eb 4a                	jmp    801578 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  80152e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801532:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  801535:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801539:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  801540:	00 00 00 
+  stat->st_isdir   = 0;
+  801543:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801547:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80154e:	00 00 00 
+  stat->st_dev     = dev;
+  801551:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801555:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801559:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  801560:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801564:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801570:	48 89 d6             	mov    %rdx,%rsi
+  801573:	48 89 c7             	mov    %rax,%rdi
+  801576:	ff d1                	call   *%rcx
+}
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+
+000000000080157a <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80157a:	55                   	push   %rbp
+  80157b:	48 89 e5             	mov    %rsp,%rbp
+  80157e:	48 83 ec 10          	sub    $0x10,%rsp
+  801582:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801586:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80158a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158e:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  801594:	83 f8 20             	cmp    $0x20,%eax
+  801597:	75 07                	jne    8015a0 <pollwait_key+0x26>
+    return -E_INVAL;
+  801599:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159e:	eb 5f                	jmp    8015ff <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8015a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a4:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8015aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ae:	48 63 d2             	movslq %edx,%rdx
+  8015b1:	48 c1 e2 04          	shl    $0x4,%rdx
+  8015b5:	48 01 c2             	add    %rax,%rdx
+  8015b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015bc:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8015bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c3:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8015c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015cd:	8b 00                	mov    (%rax),%eax
+  8015cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015d3:	48 63 c9             	movslq %ecx,%rcx
+  8015d6:	48 c1 e1 04          	shl    $0x4,%rcx
+  8015da:	48 01 ca             	add    %rcx,%rdx
+  8015dd:	48 83 c2 08          	add    $0x8,%rdx
+  8015e1:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8015e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e7:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8015ed:	8d 50 01             	lea    0x1(%rax),%edx
+  8015f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f4:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8015fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+
+0000000000801601 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80160c:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  801613:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  801619:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  801620:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801627:	00 
+  int i, r, ready, ipc = 0;
+  801628:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80162f:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  801636:	00 
+  801637:	74 45                	je     80167e <poll+0x7d>
+  801639:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  801640:	ff 
+  801641:	74 3b                	je     80167e <poll+0x7d>
+    now      = vsys_clock_ns();
+  801643:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  80164a:	00 00 00 
+  80164d:	ff d0                	call   *%rax
+  80164f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  801653:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801657:	48 f7 d0             	not    %rax
+  80165a:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  801661:	73 10                	jae    801673 <poll+0x72>
+  801663:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801667:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80166e:	48 01 d0             	add    %rdx,%rax
+  801671:	eb 07                	jmp    80167a <poll+0x79>
+  801673:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80167a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80167e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  801685:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80168c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  801693:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80169a:	e9 46 02 00 00       	jmp    8018e5 <poll+0x2e4>
+      fds[i].revents = 0;
+  80169f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016a2:	48 63 d0             	movslq %eax,%rdx
+  8016a5:	48 89 d0             	mov    %rdx,%rax
+  8016a8:	48 01 c0             	add    %rax,%rax
+  8016ab:	48 01 d0             	add    %rdx,%rax
+  8016ae:	48 c1 e0 02          	shl    $0x2,%rax
+  8016b2:	48 89 c2             	mov    %rax,%rdx
+  8016b5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016bc:	48 01 d0             	add    %rdx,%rax
+  8016bf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8016c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016c9:	48 63 d0             	movslq %eax,%rdx
+  8016cc:	48 89 d0             	mov    %rdx,%rax
+  8016cf:	48 01 c0             	add    %rax,%rax
+  8016d2:	48 01 d0             	add    %rdx,%rax
+  8016d5:	48 c1 e0 02          	shl    $0x2,%rax
+  8016d9:	48 89 c2             	mov    %rax,%rdx
+  8016dc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8016e3:	48 01 d0             	add    %rdx,%rax
+  8016e6:	8b 00                	mov    (%rax),%eax
+  8016e8:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8016eb:	75 62                	jne    80174f <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8016ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016f0:	48 63 d0             	movslq %eax,%rdx
+  8016f3:	48 89 d0             	mov    %rdx,%rax
+  8016f6:	48 01 c0             	add    %rax,%rax
+  8016f9:	48 01 d0             	add    %rdx,%rax
+  8016fc:	48 c1 e0 02          	shl    $0x2,%rax
+  801700:	48 89 c2             	mov    %rax,%rdx
+  801703:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80170a:	48 01 d0             	add    %rdx,%rax
+  80170d:	8b 40 04             	mov    0x4(%rax),%eax
+  801710:	83 e0 01             	and    $0x1,%eax
+  801713:	85 c0                	test   %eax,%eax
+  801715:	0f 84 9b 01 00 00    	je     8018b6 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80171b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80171e:	48 63 d0             	movslq %eax,%rdx
+  801721:	48 89 d0             	mov    %rdx,%rax
+  801724:	48 01 c0             	add    %rax,%rax
+  801727:	48 01 d0             	add    %rdx,%rax
+  80172a:	48 c1 e0 02          	shl    $0x2,%rax
+  80172e:	48 89 c2             	mov    %rax,%rdx
+  801731:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801738:	48 01 c2             	add    %rax,%rdx
+  80173b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80173e:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  801741:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801744:	83 c8 04             	or     $0x4,%eax
+  801747:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80174a:	e9 67 01 00 00       	jmp    8018b6 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80174f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801752:	48 63 d0             	movslq %eax,%rdx
+  801755:	48 89 d0             	mov    %rdx,%rax
+  801758:	48 01 c0             	add    %rax,%rax
+  80175b:	48 01 d0             	add    %rdx,%rax
+  80175e:	48 c1 e0 02          	shl    $0x2,%rax
+  801762:	48 89 c2             	mov    %rax,%rdx
+  801765:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80176c:	48 01 d0             	add    %rdx,%rax
+  80176f:	8b 00                	mov    (%rax),%eax
+  801771:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  801778:	48 89 d6             	mov    %rdx,%rsi
+  80177b:	89 c7                	mov    %eax,%edi
+  80177d:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  801784:	00 00 00 
+  801787:	ff d0                	call   *%rax
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 25                	js     8017b2 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80178d:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801794:	8b 00                	mov    (%rax),%eax
+  801796:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80179d:	48 89 d6             	mov    %rdx,%rsi
+  8017a0:	89 c7                	mov    %eax,%edi
+  8017a2:	48 b8 55 0d 80 00 00 	movabs $0x800d55,%rax
+  8017a9:	00 00 00 
+  8017ac:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	79 2c                	jns    8017de <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8017b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017b5:	48 63 d0             	movslq %eax,%rdx
+  8017b8:	48 89 d0             	mov    %rdx,%rax
+  8017bb:	48 01 c0             	add    %rax,%rax
+  8017be:	48 01 d0             	add    %rdx,%rax
+  8017c1:	48 c1 e0 02          	shl    $0x2,%rax
+  8017c5:	48 89 c2             	mov    %rax,%rdx
+  8017c8:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8017cf:	48 01 d0             	add    %rdx,%rax
+  8017d2:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8017d9:	e9 d8 00 00 00       	jmp    8018b6 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8017de:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017e5:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8017e9:	48 85 c0             	test   %rax,%rax
+  8017ec:	74 7d                	je     80186b <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8017ee:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8017f5:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8017f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017fc:	48 63 d0             	movslq %eax,%rdx
+  8017ff:	48 89 d0             	mov    %rdx,%rax
+  801802:	48 01 c0             	add    %rax,%rax
+  801805:	48 01 d0             	add    %rdx,%rax
+  801808:	48 c1 e0 02          	shl    $0x2,%rax
+  80180c:	48 89 c2             	mov    %rax,%rdx
+  80180f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801816:	48 01 d0             	add    %rdx,%rax
+  801819:	8b 48 04             	mov    0x4(%rax),%ecx
+  80181c:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  801823:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80182a:	89 ce                	mov    %ecx,%esi
+  80182c:	48 89 c7             	mov    %rax,%rdi
+  80182f:	41 ff d0             	call   *%r8
+  801832:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801835:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801839:	79 08                	jns    801843 <poll+0x242>
+          return r;
+  80183b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80183e:	e9 45 01 00 00       	jmp    801988 <poll+0x387>
+        fds[i].revents = r;
+  801843:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801846:	48 63 d0             	movslq %eax,%rdx
+  801849:	48 89 d0             	mov    %rdx,%rax
+  80184c:	48 01 c0             	add    %rax,%rax
+  80184f:	48 01 d0             	add    %rdx,%rax
+  801852:	48 c1 e0 02          	shl    $0x2,%rax
+  801856:	48 89 c2             	mov    %rax,%rdx
+  801859:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801860:	48 01 c2             	add    %rax,%rdx
+  801863:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801866:	89 42 08             	mov    %eax,0x8(%rdx)
+  801869:	eb 4b                	jmp    8018b6 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80186b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80186e:	48 63 d0             	movslq %eax,%rdx
+  801871:	48 89 d0             	mov    %rdx,%rax
+  801874:	48 01 c0             	add    %rax,%rax
+  801877:	48 01 d0             	add    %rdx,%rax
+  80187a:	48 c1 e0 02          	shl    $0x2,%rax
+  80187e:	48 89 c2             	mov    %rax,%rdx
+  801881:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  801888:	48 01 d0             	add    %rdx,%rax
+  80188b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80188e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801891:	48 63 d0             	movslq %eax,%rdx
+  801894:	48 89 d0             	mov    %rdx,%rax
+  801897:	48 01 c0             	add    %rax,%rax
+  80189a:	48 01 d0             	add    %rdx,%rax
+  80189d:	48 c1 e0 02          	shl    $0x2,%rax
+  8018a1:	48 89 c2             	mov    %rax,%rdx
+  8018a4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018ab:	48 01 d0             	add    %rdx,%rax
+  8018ae:	83 e1 03             	and    $0x3,%ecx
+  8018b1:	89 ca                	mov    %ecx,%edx
+  8018b3:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8018b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b9:	48 63 d0             	movslq %eax,%rdx
+  8018bc:	48 89 d0             	mov    %rdx,%rax
+  8018bf:	48 01 c0             	add    %rax,%rax
+  8018c2:	48 01 d0             	add    %rdx,%rax
+  8018c5:	48 c1 e0 02          	shl    $0x2,%rax
+  8018c9:	48 89 c2             	mov    %rax,%rdx
+  8018cc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8018d3:	48 01 d0             	add    %rdx,%rax
+  8018d6:	8b 40 08             	mov    0x8(%rax),%eax
+  8018d9:	85 c0                	test   %eax,%eax
+  8018db:	74 04                	je     8018e1 <poll+0x2e0>
+        ready++;
+  8018dd:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8018e1:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8018e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018e8:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8018ee:	0f 8c ab fd ff ff    	jl     80169f <poll+0x9e>
+    }
+    if (ready)
+  8018f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8018f8:	74 08                	je     801902 <poll+0x301>
+      return ready;
+  8018fa:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8018fd:	e9 86 00 00 00       	jmp    801988 <poll+0x387>
+
+    if (deadline) {
+  801902:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801907:	74 30                	je     801939 <poll+0x338>
+      now     = vsys_clock_ns();
+  801909:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  801910:	00 00 00 
+  801913:	ff d0                	call   *%rax
+  801915:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  801919:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80191d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801921:	73 0a                	jae    80192d <poll+0x32c>
+  801923:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801927:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80192b:	eb 05                	jmp    801932 <poll+0x331>
+  80192d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801932:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  801939:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80193c:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80193f:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  801946:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80194d:	48 89 c7             	mov    %rax,%rdi
+  801950:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  801957:	00 00 00 
+  80195a:	ff d0                	call   *%rax
+  80195c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80195f:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  801963:	75 07                	jne    80196c <poll+0x36b>
+      return 0;
+  801965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196a:	eb 1c                	jmp    801988 <poll+0x387>
+    if (r < 0)
+  80196c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801970:	79 05                	jns    801977 <poll+0x376>
+      return r;
+  801972:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801975:	eb 11                	jmp    801988 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  801977:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80197a:	c1 f8 02             	sar    $0x2,%eax
+  80197d:	83 e0 01             	and    $0x1,%eax
+  801980:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  801983:	e9 f6 fc ff ff       	jmp    80167e <poll+0x7d>
+  }
+}
+  801988:	c9                   	leave
+  801989:	c3                   	ret
+
+000000000080198a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	48 83 ec 20          	sub    $0x20,%rsp
+  801992:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801996:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80199a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80199e:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a3:	48 89 c7             	mov    %rax,%rdi
+  8019a6:	48 b8 78 1a 80 00 00 	movabs $0x801a78,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+  8019b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8019b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019b9:	79 05                	jns    8019c0 <stat+0x36>
+    return fd;
+  8019bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019be:	eb 2f                	jmp    8019ef <stat+0x65>
+  r = fstat(fd, stat);
+  8019c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019c7:	48 89 d6             	mov    %rdx,%rsi
+  8019ca:	89 c7                	mov    %eax,%edi
+  8019cc:	48 b8 c1 14 80 00 00 	movabs $0x8014c1,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+  8019d8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8019db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8019de:	89 c7                	mov    %eax,%edi
+  8019e0:	48 b8 29 0e 80 00 00 	movabs $0x800e29,%rax
+  8019e7:	00 00 00 
+  8019ea:	ff d0                	call   *%rax
+  return r;
+  8019ec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8019ef:	c9                   	leave
+  8019f0:	c3                   	ret
+
+00000000008019f1 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8019f1:	55                   	push   %rbp
+  8019f2:	48 89 e5             	mov    %rsp,%rbp
+  8019f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8019f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8019fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  801a00:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a07:	00 00 00 
+  801a0a:	8b 00                	mov    (%rax),%eax
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	75 1d                	jne    801a2d <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a10:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a15:	48 b8 44 4e 80 00 00 	movabs $0x804e44,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+  801a21:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  801a28:	00 00 00 
+  801a2b:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a2d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801a34:	00 00 00 
+  801a37:	8b 00                	mov    (%rax),%eax
+  801a39:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  801a3c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a41:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801a48:	00 00 00 
+  801a4b:	89 c7                	mov    %eax,%edi
+  801a4d:	48 b8 97 4d 80 00 00 	movabs $0x804d97,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  801a59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	48 89 c6             	mov    %rax,%rsi
+  801a65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6a:	48 b8 1a 4c 80 00 00 	movabs $0x804c1a,%rax
+  801a71:	00 00 00 
+  801a74:	ff d0                	call   *%rax
+}
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+0000000000801a78 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  801a78:	55                   	push   %rbp
+  801a79:	48 89 e5             	mov    %rsp,%rbp
+  801a7c:	48 83 ec 20          	sub    $0x20,%rsp
+  801a80:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a84:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  801a87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a8b:	48 89 c7             	mov    %rax,%rdi
+  801a8e:	48 b8 fb 3f 80 00 00 	movabs $0x803ffb,%rax
+  801a95:	00 00 00 
+  801a98:	ff d0                	call   *%rax
+  801a9a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a9f:	7e 0a                	jle    801aab <open+0x33>
+    return -E_BAD_PATH;
+  801aa1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aa6:	e9 a8 00 00 00       	jmp    801b53 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  801aab:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801aaf:	48 89 c7             	mov    %rax,%rdi
+  801ab2:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  801ab9:	00 00 00 
+  801abc:	ff d0                	call   *%rax
+  801abe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801ac1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ac5:	79 08                	jns    801acf <open+0x57>
+    return r;
+  801ac7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801aca:	e9 84 00 00 00       	jmp    801b53 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  801acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad3:	48 89 c6             	mov    %rax,%rsi
+  801ad6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801add:	00 00 00 
+  801ae0:	48 89 c7             	mov    %rax,%rdi
+  801ae3:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  801aef:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801af6:	00 00 00 
+  801af9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801afc:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b06:	48 89 c6             	mov    %rax,%rsi
+  801b09:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b0e:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801b15:	00 00 00 
+  801b18:	ff d0                	call   *%rax
+  801b1a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801b1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b21:	79 1d                	jns    801b40 <open+0xc8>
+    fd_close(fd, 0);
+  801b23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b27:	be 00 00 00 00       	mov    $0x0,%esi
+  801b2c:	48 89 c7             	mov    %rax,%rdi
+  801b2f:	48 b8 8a 0c 80 00 00 	movabs $0x800c8a,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+    return r;
+  801b3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801b3e:	eb 13                	jmp    801b53 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  801b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b44:	48 89 c7             	mov    %rax,%rdi
+  801b47:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  801b4e:	00 00 00 
+  801b51:	ff d0                	call   *%rax
+}
+  801b53:	c9                   	leave
+  801b54:	c3                   	ret
+
+0000000000801b55 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  801b55:	55                   	push   %rbp
+  801b56:	48 89 e5             	mov    %rsp,%rbp
+  801b59:	48 83 ec 10          	sub    $0x10,%rsp
+  801b5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b65:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b68:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801b6f:	00 00 00 
+  801b72:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b74:	be 00 00 00 00       	mov    $0x0,%esi
+  801b79:	bf 06 00 00 00       	mov    $0x6,%edi
+  801b7e:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801b85:	00 00 00 
+  801b88:	ff d0                	call   *%rax
+}
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+0000000000801b8c <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801b8c:	55                   	push   %rbp
+  801b8d:	48 89 e5             	mov    %rsp,%rbp
+  801b90:	48 83 ec 30          	sub    $0x30,%rsp
+  801b94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b98:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b9c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801ba0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ba5:	74 07                	je     801bae <devfile_read+0x22>
+  801ba7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801bac:	75 0a                	jne    801bb8 <devfile_read+0x2c>
+  return E_INVAL;
+  801bae:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bb3:	e9 b4 00 00 00       	jmp    801c6c <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  801bb8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bbf:	00 
+  while (n) {
+  801bc0:	e9 98 00 00 00       	jmp    801c5d <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc9:	8b 40 0c             	mov    0xc(%rax),%eax
+  801bcc:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bd3:	00 00 00 
+  801bd6:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  801bd8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801bdf:	00 00 00 
+  801be2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  801bea:	be 00 00 00 00       	mov    $0x0,%esi
+  801bef:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bf4:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  801c03:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c07:	7f 13                	jg     801c1c <devfile_read+0x90>
+      return res ? res : res0;
+  801c09:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801c0d:	74 07                	je     801c16 <devfile_read+0x8a>
+  801c0f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c12:	48 98                	cltq
+  801c14:	eb 56                	jmp    801c6c <devfile_read+0xe0>
+  801c16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c1a:	eb 50                	jmp    801c6c <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801c1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c1f:	48 63 d0             	movslq %eax,%rdx
+  801c22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c26:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801c2d:	00 00 00 
+  801c30:	48 89 ce             	mov    %rcx,%rsi
+  801c33:	48 89 c7             	mov    %rax,%rdi
+  801c36:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  801c3d:	00 00 00 
+  801c40:	ff d0                	call   *%rax
+
+    buf += res;
+  801c42:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c45:	48 98                	cltq
+  801c47:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  801c4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c4e:	48 98                	cltq
+  801c50:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  801c54:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c57:	48 98                	cltq
+  801c59:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801c5d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c62:	0f 85 5d ff ff ff    	jne    801bc5 <devfile_read+0x39>
+  }
+
+  return res0;
+  801c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+
+0000000000801c6e <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	48 83 ec 50          	sub    $0x50,%rsp
+  801c76:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c7a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801c7e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  801c82:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c87:	74 07                	je     801c90 <devfile_write+0x22>
+  801c89:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c8e:	75 0a                	jne    801c9a <devfile_write+0x2c>
+  return E_INVAL;
+  801c90:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c95:	e9 c9 00 00 00       	jmp    801d63 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  801c9a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ca1:	00 
+
+  while (n) {
+  801ca2:	e9 ad 00 00 00       	jmp    801d54 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801ca7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801caf:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  801cb6:	00 
+  801cb7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801cbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cbf:	48 39 c2             	cmp    %rax,%rdx
+  801cc2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801cc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  801cca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801cd2:	48 89 c6             	mov    %rax,%rsi
+  801cd5:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801cdc:	00 00 00 
+  801cdf:	48 89 c7             	mov    %rax,%rdi
+  801ce2:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf2:	8b 40 0c             	mov    0xc(%rax),%eax
+  801cf5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801cfc:	00 00 00 
+  801cff:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  801d01:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d08:	00 00 00 
+  801d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d0f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  801d13:	be 00 00 00 00       	mov    $0x0,%esi
+  801d18:	bf 04 00 00 00       	mov    $0x4,%edi
+  801d1d:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  801d2c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d30:	79 07                	jns    801d39 <devfile_write+0xcb>
+      return res;
+  801d32:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d35:	48 98                	cltq
+  801d37:	eb 2a                	jmp    801d63 <devfile_write+0xf5>
+
+    buf += res;
+  801d39:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d3c:	48 98                	cltq
+  801d3e:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  801d42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d45:	48 98                	cltq
+  801d47:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  801d4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d4e:	48 98                	cltq
+  801d50:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  801d54:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d59:	0f 85 48 ff ff ff    	jne    801ca7 <devfile_write+0x39>
+  }
+
+  return res0;
+  801d5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  801d63:	c9                   	leave
+  801d64:	c3                   	ret
+
+0000000000801d65 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d65:	55                   	push   %rbp
+  801d66:	48 89 e5             	mov    %rsp,%rbp
+  801d69:	48 83 ec 20          	sub    $0x20,%rsp
+  801d6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d71:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d79:	8b 40 0c             	mov    0xc(%rax),%eax
+  801d7c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801d83:	00 00 00 
+  801d86:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d88:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8d:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d92:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801d99:	00 00 00 
+  801d9c:	ff d0                	call   *%rax
+  801d9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801da1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801da5:	79 05                	jns    801dac <devfile_stat+0x47>
+    return r;
+  801da7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801daa:	eb 59                	jmp    801e05 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801db0:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801db7:	00 00 00 
+  801dba:	48 89 d6             	mov    %rdx,%rsi
+  801dbd:	48 89 c7             	mov    %rax,%rdi
+  801dc0:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  801dcc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801dd3:	00 00 00 
+  801dd6:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  801ddc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801de0:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801de6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ded:	00 00 00 
+  801df0:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  801df6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dfa:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  801e00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e05:	c9                   	leave
+  801e06:	c3                   	ret
+
+0000000000801e07 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e13:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1a:	8b 40 0c             	mov    0xc(%rax),%eax
+  801e1d:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e24:	00 00 00 
+  801e27:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  801e29:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e30:	00 00 00 
+  801e33:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e36:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e39:	be 00 00 00 00       	mov    $0x0,%esi
+  801e3e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e43:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+0000000000801e51 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  801e51:	55                   	push   %rbp
+  801e52:	48 89 e5             	mov    %rsp,%rbp
+  801e55:	48 83 ec 18          	sub    $0x18,%rsp
+  801e59:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e5d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e60:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  801e64:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e67:	83 e0 03             	and    $0x3,%eax
+}
+  801e6a:	c9                   	leave
+  801e6b:	c3                   	ret
+
+0000000000801e6c <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  801e6c:	55                   	push   %rbp
+  801e6d:	48 89 e5             	mov    %rsp,%rbp
+  801e70:	48 83 ec 10          	sub    $0x10,%rsp
+  801e74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  801e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7c:	48 89 c7             	mov    %rax,%rdi
+  801e7f:	48 b8 fb 3f 80 00 00 	movabs $0x803ffb,%rax
+  801e86:	00 00 00 
+  801e89:	ff d0                	call   *%rax
+  801e8b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e90:	7e 07                	jle    801e99 <remove+0x2d>
+    return -E_BAD_PATH;
+  801e92:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e97:	eb 36                	jmp    801ecf <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  801e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9d:	48 89 c6             	mov    %rax,%rsi
+  801ea0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ea7:	00 00 00 
+  801eaa:	48 89 c7             	mov    %rax,%rdi
+  801ead:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  801eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebe:	bf 07 00 00 00       	mov    $0x7,%edi
+  801ec3:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801eca:	00 00 00 
+  801ecd:	ff d0                	call   *%rax
+}
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+
+0000000000801ed1 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  801ed1:	55                   	push   %rbp
+  801ed2:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eda:	bf 08 00 00 00       	mov    $0x8,%edi
+  801edf:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801ee6:	00 00 00 
+  801ee9:	ff d0                	call   *%rax
+}
+  801eeb:	5d                   	pop    %rbp
+  801eec:	c3                   	ret
+
+0000000000801eed <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  801eed:	55                   	push   %rbp
+  801eee:	48 89 e5             	mov    %rsp,%rbp
+  801ef1:	48 83 ec 20          	sub    $0x20,%rsp
+  801ef5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801ef9:	be 00 00 00 00       	mov    $0x0,%esi
+  801efe:	bf 09 00 00 00       	mov    $0x9,%edi
+  801f03:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801f0a:	00 00 00 
+  801f0d:	ff d0                	call   *%rax
+  801f0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801f12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f16:	79 05                	jns    801f1d <fs_stats+0x30>
+    return r;
+  801f18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f1b:	eb 2a                	jmp    801f47 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  801f1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f21:	ba 68 00 00 00       	mov    $0x68,%edx
+  801f26:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  801f2d:	00 00 00 
+  801f30:	48 89 ce             	mov    %rcx,%rsi
+  801f33:	48 89 c7             	mov    %rax,%rdi
+  801f36:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  801f3d:	00 00 00 
+  801f40:	ff d0                	call   *%rax
+  return 0;
+  801f42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+0000000000801f49 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f51:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  801f54:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f5b:	00 00 00 
+  801f5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f61:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  801f63:	be 00 00 00 00       	mov    $0x0,%esi
+  801f68:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801f6d:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801f74:	00 00 00 
+  801f77:	ff d0                	call   *%rax
+}
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+0000000000801f7b <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  801f7b:	55                   	push   %rbp
+  801f7c:	48 89 e5             	mov    %rsp,%rbp
+  801f7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801f83:	89 f8                	mov    %edi,%eax
+  801f85:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  801f88:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  801f8c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801f93:	00 00 00 
+  801f96:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  801f98:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801fa2:	48 b8 f1 19 80 00 00 	movabs $0x8019f1,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+0000000000801fb0 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  801fbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc0:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  801fc5:	48 89 c7             	mov    %rax,%rdi
+  801fc8:	48 b8 d6 1f 80 00 00 	movabs $0x801fd6,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+}
+  801fd4:	c9                   	leave
+  801fd5:	c3                   	ret
+
+0000000000801fd6 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  801fd6:	55                   	push   %rbp
+  801fd7:	48 89 e5             	mov    %rsp,%rbp
+  801fda:	48 83 ec 50          	sub    $0x50,%rsp
+  801fde:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801fe2:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  801fe6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801fed:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  801fee:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  801ff3:	74 0a                	je     801fff <pipe_size+0x29>
+  801ff5:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  801ffc:	00 
+  801ffd:	76 0a                	jbe    802009 <pipe_size+0x33>
+    return -E_INVAL;
+  801fff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802004:	e9 cc 02 00 00       	jmp    8022d5 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802009:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80200d:	48 89 c7             	mov    %rax,%rdi
+  802010:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+  80201c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80201f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802023:	0f 88 a8 02 00 00    	js     8022d1 <pipe_size+0x2fb>
+  802029:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80202d:	ba 07 04 00 00       	mov    $0x407,%edx
+  802032:	48 89 c6             	mov    %rax,%rsi
+  802035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203a:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802049:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80204d:	0f 88 7e 02 00 00    	js     8022d1 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  802053:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  802057:	48 89 c7             	mov    %rax,%rdi
+  80205a:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802069:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80206d:	0f 88 43 02 00 00    	js     8022b6 <pipe_size+0x2e0>
+  802073:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802077:	ba 07 04 00 00       	mov    $0x407,%edx
+  80207c:	48 89 c6             	mov    %rax,%rsi
+  80207f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802084:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802093:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802097:	0f 88 19 02 00 00    	js     8022b6 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80209d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a1:	48 89 c7             	mov    %rax,%rdi
+  8020a4:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+  8020b0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8020b4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8020bb:	00 
+  8020bc:	e9 a2 00 00 00       	jmp    802163 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8020c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020c5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020c9:	48 89 c2             	mov    %rax,%rdx
+  8020cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d0:	48 01 d0             	add    %rdx,%rax
+  8020d3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8020d8:	48 89 c6             	mov    %rax,%rsi
+  8020db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e0:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8020ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020f3:	0f 88 37 01 00 00    	js     802230 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8020f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8020fd:	48 89 c7             	mov    %rax,%rdi
+  802100:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+  80210c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802110:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802114:	48 01 c2             	add    %rax,%rdx
+  802117:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80211b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80211f:	48 89 c1             	mov    %rax,%rcx
+  802122:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802126:	48 01 c8             	add    %rcx,%rax
+  802129:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80212f:	48 89 d1             	mov    %rdx,%rcx
+  802132:	ba 00 00 00 00       	mov    $0x0,%edx
+  802137:	48 89 c6             	mov    %rax,%rsi
+  80213a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213f:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+  80214b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80214e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802152:	79 0a                	jns    80215e <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  802154:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  802159:	e9 d3 00 00 00       	jmp    802231 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80215e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802163:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80216a:	00 
+  80216b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80216f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802173:	48 01 d0             	add    %rdx,%rax
+  802176:	48 83 c0 1f          	add    $0x1f,%rax
+  80217a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80217e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802182:	ba 00 00 00 00       	mov    $0x0,%edx
+  802187:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80218b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218f:	48 29 d0             	sub    %rdx,%rax
+  802192:	48 c1 e8 0c          	shr    $0xc,%rax
+  802196:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80219a:	0f 82 21 ff ff ff    	jb     8020c1 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8021a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8021a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ac:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021b0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8021b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021b8:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021bf:	00 00 00 
+  8021c2:	8b 12                	mov    (%rdx),%edx
+  8021c4:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8021c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ca:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8021d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021d5:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8021dc:	00 00 00 
+  8021df:	8b 12                	mov    (%rdx),%edx
+  8021e1:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8021e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8021ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f2:	48 89 c7             	mov    %rax,%rdi
+  8021f5:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  8021fc:	00 00 00 
+  8021ff:	ff d0                	call   *%rax
+  802201:	89 c2                	mov    %eax,%edx
+  802203:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802207:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  802209:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80220d:	48 89 c7             	mov    %rax,%rdi
+  802210:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+  80221c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802220:	48 83 c2 04          	add    $0x4,%rdx
+  802224:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222b:	e9 a5 00 00 00       	jmp    8022d5 <pipe_size+0x2ff>
+      goto err2;
+  802230:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  802231:	eb 58                	jmp    80228b <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  802233:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802237:	48 c1 e0 0c          	shl    $0xc,%rax
+  80223b:	48 89 c2             	mov    %rax,%rdx
+  80223e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802242:	48 01 d0             	add    %rdx,%rax
+  802245:	48 89 c6             	mov    %rax,%rsi
+  802248:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224d:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  802259:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80225d:	48 89 c7             	mov    %rax,%rdi
+  802260:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802270:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802274:	48 01 d0             	add    %rdx,%rax
+  802277:	48 89 c6             	mov    %rax,%rsi
+  80227a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227f:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80228b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80228f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802293:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  802297:	48 85 c0             	test   %rax,%rax
+  80229a:	75 97                	jne    802233 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  80229c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a0:	48 89 c6             	mov    %rax,%rsi
+  8022a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a8:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  8022af:	00 00 00 
+  8022b2:	ff d0                	call   *%rax
+  8022b4:	eb 01                	jmp    8022b7 <pipe_size+0x2e1>
+    goto err1;
+  8022b6:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  8022b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022bb:	48 89 c6             	mov    %rax,%rsi
+  8022be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c3:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	eb 01                	jmp    8022d2 <pipe_size+0x2fc>
+    goto err;
+  8022d1:	90                   	nop
+err:
+  return r;
+  8022d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+
+00000000008022d7 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8022d7:	55                   	push   %rbp
+  8022d8:	48 89 e5             	mov    %rsp,%rbp
+  8022db:	53                   	push   %rbx
+  8022dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8022e0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8022e8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8022ef:	00 00 00 
+  8022f2:	8b 40 04             	mov    0x4(%rax),%eax
+  8022f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022fa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802301:	00 00 00 
+  802304:	48 98                	cltq
+  802306:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80230d:	48 01 d0             	add    %rdx,%rax
+  802310:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  802316:	8b 00                	mov    (%rax),%eax
+  802318:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  80231b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80231f:	48 89 c7             	mov    %rax,%rdi
+  802322:	48 b8 b5 4e 80 00 00 	movabs $0x804eb5,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+  80232e:	89 c3                	mov    %eax,%ebx
+  802330:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802334:	48 89 c7             	mov    %rax,%rdi
+  802337:	48 b8 b5 4e 80 00 00 	movabs $0x804eb5,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+  802343:	39 c3                	cmp    %eax,%ebx
+  802345:	0f 94 c0             	sete   %al
+  802348:	0f b6 c0             	movzbl %al,%eax
+  80234b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  80234e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802355:	00 00 00 
+  802358:	8b 40 04             	mov    0x4(%rax),%eax
+  80235b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802360:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802367:	00 00 00 
+  80236a:	48 98                	cltq
+  80236c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802373:	48 01 d0             	add    %rdx,%rax
+  802376:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80237c:	8b 00                	mov    (%rax),%eax
+  80237e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  802381:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802384:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802387:	75 05                	jne    80238e <_pipeisclosed+0xb7>
+      return ret;
+  802389:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80238c:	eb 68                	jmp    8023f6 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80238e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802391:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  802394:	0f 84 4e ff ff ff    	je     8022e8 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80239a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8023a1:	00 00 00 
+  8023a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8023a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023ac:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8023b3:	00 00 00 
+  8023b6:	48 98                	cltq
+  8023b8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8023bf:	48 01 d0             	add    %rdx,%rax
+  8023c2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8023c8:	8b 10                	mov    (%rax),%edx
+  8023ca:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8023cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023d0:	89 c6                	mov    %eax,%esi
+  8023d2:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  8023d9:	00 00 00 
+  8023dc:	48 89 c7             	mov    %rax,%rdi
+  8023df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e4:	49 b8 4c 31 80 00 00 	movabs $0x80314c,%r8
+  8023eb:	00 00 00 
+  8023ee:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8023f1:	e9 f2 fe ff ff       	jmp    8022e8 <_pipeisclosed+0x11>
+  }
+}
+  8023f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023fa:	c9                   	leave
+  8023fb:	c3                   	ret
+
+00000000008023fc <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8023fc:	55                   	push   %rbp
+  8023fd:	48 89 e5             	mov    %rsp,%rbp
+  802400:	48 83 ec 30          	sub    $0x30,%rsp
+  802404:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802407:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80240b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80240e:	48 89 d6             	mov    %rdx,%rsi
+  802411:	89 c7                	mov    %eax,%edi
+  802413:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  80241a:	00 00 00 
+  80241d:	ff d0                	call   *%rax
+  80241f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802422:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802426:	79 05                	jns    80242d <pipeisclosed+0x31>
+    return r;
+  802428:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80242b:	eb 31                	jmp    80245e <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  80242d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802431:	48 89 c7             	mov    %rax,%rdi
+  802434:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+  802440:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  802444:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802448:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80244c:	48 89 d6             	mov    %rdx,%rsi
+  80244f:	48 89 c7             	mov    %rax,%rdi
+  802452:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+}
+  80245e:	c9                   	leave
+  80245f:	c3                   	ret
+
+0000000000802460 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  802460:	55                   	push   %rbp
+  802461:	48 89 e5             	mov    %rsp,%rbp
+  802464:	48 83 ec 10          	sub    $0x10,%rsp
+  802468:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80246c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802470:	8b 40 18             	mov    0x18(%rax),%eax
+  802473:	8d 50 01             	lea    0x1(%rax),%edx
+  802476:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80247a:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80247d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802481:	8b 40 1c             	mov    0x1c(%rax),%eax
+  802484:	85 c0                	test   %eax,%eax
+  802486:	74 27                	je     8024af <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  802488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248c:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  802493:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802497:	48 83 c0 18          	add    $0x18,%rax
+  80249b:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8024a0:	48 89 c7             	mov    %rax,%rdi
+  8024a3:	48 b8 98 07 80 00 00 	movabs $0x800798,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+  }
+}
+  8024af:	90                   	nop
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+
+00000000008024b2 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024be:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8024c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c5:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8024cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d0:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8024d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024d7:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8024de:	89 c6                	mov    %eax,%esi
+  8024e0:	48 89 cf             	mov    %rcx,%rdi
+  8024e3:	48 b8 49 07 80 00 00 	movabs $0x800749,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+}
+  8024ef:	90                   	nop
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+
+00000000008024f2 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8024f2:	55                   	push   %rbp
+  8024f3:	48 89 e5             	mov    %rsp,%rbp
+  8024f6:	48 83 ec 70          	sub    $0x70,%rsp
+  8024fa:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8024fe:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  802502:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  802506:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80250a:	48 89 c7             	mov    %rax,%rdi
+  80250d:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+  802519:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80251d:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  802522:	75 0a                	jne    80252e <devpipe_read+0x3c>
+    return 0;
+  802524:	b8 00 00 00 00       	mov    $0x0,%eax
+  802529:	e9 63 01 00 00       	jmp    802691 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80252e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802532:	8b 40 18             	mov    0x18(%rax),%eax
+  802535:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  802538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253c:	48 8b 10             	mov    (%rax),%rdx
+  80253f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802543:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802547:	48 39 c2             	cmp    %rax,%rdx
+  80254a:	75 42                	jne    80258e <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80254c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802550:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802554:	48 89 d6             	mov    %rdx,%rsi
+  802557:	48 89 c7             	mov    %rax,%rdi
+  80255a:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+  802566:	85 c0                	test   %eax,%eax
+  802568:	74 0a                	je     802574 <devpipe_read+0x82>
+      return 0;
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	e9 1d 01 00 00       	jmp    802691 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  802574:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802577:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80257b:	89 d6                	mov    %edx,%esi
+  80257d:	48 89 c7             	mov    %rax,%rdi
+  802580:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80258c:	eb a0                	jmp    80252e <devpipe_read+0x3c>
+      break;
+  80258e:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80258f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802593:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  802597:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80259b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80259f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025a3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8025a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ab:	48 8b 00             	mov    (%rax),%rax
+  8025ae:	48 29 c2             	sub    %rax,%rdx
+  8025b1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025bd:	48 39 c2             	cmp    %rax,%rdx
+  8025c0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8025c4:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8025c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025cc:	48 8b 00             	mov    (%rax),%rax
+  8025cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d3:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8025d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025dc:	48 f7 f1             	div    %rcx
+  8025df:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8025e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8025e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8025eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025f3:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8025f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025fb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8025ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802603:	48 39 c2             	cmp    %rax,%rdx
+  802606:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80260a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80260e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802612:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  802616:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80261a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80261e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802622:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802626:	48 89 ce             	mov    %rcx,%rsi
+  802629:	48 89 c7             	mov    %rax,%rdi
+  80262c:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  802638:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80263c:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  802640:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802644:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  802648:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80264c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802650:	48 01 d1             	add    %rdx,%rcx
+  802653:	48 89 c2             	mov    %rax,%rdx
+  802656:	48 89 cf             	mov    %rcx,%rdi
+  802659:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  802660:	00 00 00 
+  802663:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  802665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802669:	48 8b 10             	mov    (%rax),%rdx
+  80266c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802670:	48 01 c2             	add    %rax,%rdx
+  802673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802677:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80267a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267e:	48 89 c7             	mov    %rax,%rdi
+  802681:	48 b8 60 24 80 00 00 	movabs $0x802460,%rax
+  802688:	00 00 00 
+  80268b:	ff d0                	call   *%rax
+  return n;
+  80268d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+0000000000802693 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802693:	55                   	push   %rbp
+  802694:	48 89 e5             	mov    %rsp,%rbp
+  802697:	48 83 ec 70          	sub    $0x70,%rsp
+  80269b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80269f:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8026a3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8026a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026ab:	48 89 c7             	mov    %rax,%rdi
+  8026ae:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8026b5:	00 00 00 
+  8026b8:	ff d0                	call   *%rax
+  8026ba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8026be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026c2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8026c6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8026cd:	00 
+  8026ce:	e9 b8 01 00 00       	jmp    80288b <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8026d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026d7:	8b 40 18             	mov    0x18(%rax),%eax
+  8026da:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8026dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8026e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e9:	48 8b 00             	mov    (%rax),%rax
+  8026ec:	48 29 c2             	sub    %rax,%rdx
+  8026ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026f7:	48 39 c2             	cmp    %rax,%rdx
+  8026fa:	75 4d                	jne    802749 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8026fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802700:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802704:	48 89 d6             	mov    %rdx,%rsi
+  802707:	48 89 c7             	mov    %rax,%rdi
+  80270a:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  802711:	00 00 00 
+  802714:	ff d0                	call   *%rax
+  802716:	85 c0                	test   %eax,%eax
+  802718:	74 0a                	je     802724 <devpipe_write+0x91>
+        return 0;
+  80271a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271f:	e9 79 01 00 00       	jmp    80289d <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  802724:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802727:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80272b:	89 d6                	mov    %edx,%esi
+  80272d:	48 89 c7             	mov    %rax,%rdi
+  802730:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+      m = 0;
+  80273c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802743:	00 
+      continue;
+  802744:	e9 3a 01 00 00       	jmp    802883 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  802749:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80274d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  802751:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802759:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80275d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802761:	48 8b 08             	mov    (%rax),%rcx
+  802764:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802768:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80276c:	48 29 c1             	sub    %rax,%rcx
+  80276f:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802773:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802777:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80277b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277f:	48 39 c2             	cmp    %rax,%rdx
+  802782:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802786:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80278a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80278e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802792:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802796:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80279a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279f:	48 f7 f1             	div    %rcx
+  8027a2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8027a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027aa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027b6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8027ba:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8027be:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8027c2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8027c6:	48 39 c2             	cmp    %rax,%rdx
+  8027c9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8027cd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8027d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027d5:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8027d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027dd:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8027e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027e5:	48 01 d1             	add    %rdx,%rcx
+  8027e8:	48 89 c2             	mov    %rax,%rdx
+  8027eb:	48 89 cf             	mov    %rcx,%rdi
+  8027ee:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8027fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027fe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802802:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  802806:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80280a:	73 4d                	jae    802859 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80280c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802810:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802814:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802818:	48 29 c2             	sub    %rax,%rdx
+  80281b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80281f:	48 01 c2             	add    %rax,%rdx
+  802822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802826:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80282a:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80282e:	48 89 c1             	mov    %rax,%rcx
+  802831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802835:	48 01 c1             	add    %rax,%rcx
+  802838:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80283c:	48 01 c1             	add    %rax,%rcx
+  80283f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802843:	48 83 c0 20          	add    $0x20,%rax
+  802847:	48 89 ce             	mov    %rcx,%rsi
+  80284a:	48 89 c7             	mov    %rax,%rdi
+  80284d:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  802859:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80285d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802861:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802865:	48 01 c2             	add    %rax,%rdx
+  802868:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80286c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  802870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802874:	48 89 c7             	mov    %rax,%rdi
+  802877:	48 b8 60 24 80 00 00 	movabs $0x802460,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  802883:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802887:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80288b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80288f:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  802893:	0f 82 3a fe ff ff    	jb     8026d3 <devpipe_write+0x40>
+  }
+
+  return i;
+  802899:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80289d:	c9                   	leave
+  80289e:	c3                   	ret
+
+000000000080289f <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+  8028a3:	48 83 ec 40          	sub    $0x40,%rsp
+  8028a7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8028ab:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8028ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028b6:	48 89 c7             	mov    %rax,%rdi
+  8028b9:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+  8028c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8028c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8028d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028d4:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8028d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028dc:	48 89 d6             	mov    %rdx,%rsi
+  8028df:	48 89 c7             	mov    %rax,%rdi
+  8028e2:	48 b8 7a 15 80 00 00 	movabs $0x80157a,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028f5:	79 08                	jns    8028ff <devpipe_poll+0x60>
+    return r;
+  8028f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028fa:	e9 85 00 00 00       	jmp    802984 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8028ff:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802902:	83 e0 01             	and    $0x1,%eax
+  802905:	85 c0                	test   %eax,%eax
+  802907:	74 18                	je     802921 <devpipe_poll+0x82>
+  802909:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80290d:	48 8b 10             	mov    (%rax),%rdx
+  802910:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802914:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802918:	48 39 c2             	cmp    %rax,%rdx
+  80291b:	74 04                	je     802921 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80291d:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  802921:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802924:	83 e0 02             	and    $0x2,%eax
+  802927:	85 c0                	test   %eax,%eax
+  802929:	74 23                	je     80294e <devpipe_poll+0xaf>
+  80292b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80292f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802933:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802937:	48 8b 00             	mov    (%rax),%rax
+  80293a:	48 29 c2             	sub    %rax,%rdx
+  80293d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802941:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802945:	48 39 c2             	cmp    %rax,%rdx
+  802948:	73 04                	jae    80294e <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80294a:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80294e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802952:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802956:	48 89 d6             	mov    %rdx,%rsi
+  802959:	48 89 c7             	mov    %rax,%rdi
+  80295c:	48 b8 d7 22 80 00 00 	movabs $0x8022d7,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+  802968:	85 c0                	test   %eax,%eax
+  80296a:	74 04                	je     802970 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80296c:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  802970:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802974:	75 0b                	jne    802981 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  802976:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80297a:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  802981:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+0000000000802986 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802986:	55                   	push   %rbp
+  802987:	48 89 e5             	mov    %rsp,%rbp
+  80298a:	48 83 ec 20          	sub    $0x20,%rsp
+  80298e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802992:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299a:	48 89 c7             	mov    %rax,%rdi
+  80299d:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+  8029a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8029ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029b1:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8029b8:	00 00 00 
+  8029bb:	48 89 d6             	mov    %rdx,%rsi
+  8029be:	48 89 c7             	mov    %rax,%rdi
+  8029c1:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8029cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029d5:	89 c1                	mov    %eax,%ecx
+  8029d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029db:	48 8b 00             	mov    (%rax),%rax
+  8029de:	89 c2                	mov    %eax,%edx
+  8029e0:	89 c8                	mov    %ecx,%eax
+  8029e2:	29 d0                	sub    %edx,%eax
+  8029e4:	89 c2                	mov    %eax,%edx
+  8029e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ea:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8029f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029f4:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8029fb:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8029fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a02:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  802a09:	00 00 00 
+  802a0c:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  802a13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a18:	c9                   	leave
+  802a19:	c3                   	ret
+
+0000000000802a1a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802a1a:	55                   	push   %rbp
+  802a1b:	48 89 e5             	mov    %rsp,%rbp
+  802a1e:	48 83 ec 40          	sub    $0x40,%rsp
+  802a22:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a2a:	48 89 c7             	mov    %rax,%rdi
+  802a2d:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+  802a39:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  802a3d:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802a44:	00 
+  802a45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a49:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802a4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a51:	48 01 d0             	add    %rdx,%rax
+  802a54:	48 83 c0 1f          	add    $0x1f,%rax
+  802a58:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a60:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a65:	48 f7 75 e8          	divq   -0x18(%rbp)
+  802a69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a6d:	48 29 d0             	sub    %rdx,%rax
+  802a70:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a74:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  802a78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a7c:	48 89 c6             	mov    %rax,%rsi
+  802a7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a84:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  802a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a94:	48 89 c7             	mov    %rax,%rdi
+  802a97:	48 b8 60 24 80 00 00 	movabs $0x802460,%rax
+  802a9e:	00 00 00 
+  802aa1:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802aa3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aa7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802aab:	eb 2f                	jmp    802adc <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  802aad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab1:	48 83 e8 01          	sub    $0x1,%rax
+  802ab5:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ab9:	48 89 c2             	mov    %rax,%rdx
+  802abc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac0:	48 01 d0             	add    %rdx,%rax
+  802ac3:	48 89 c6             	mov    %rax,%rsi
+  802ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802acb:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  802ad2:	00 00 00 
+  802ad5:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  802ad7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802adc:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  802ae1:	77 ca                	ja     802aad <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  802ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ae7:	48 89 c6             	mov    %rax,%rsi
+  802aea:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aef:	48 b8 55 04 80 00 00 	movabs $0x800455,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+}
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+0000000000802afd <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  802afd:	55                   	push   %rbp
+  802afe:	48 89 e5             	mov    %rsp,%rbp
+  802b01:	48 83 ec 08          	sub    $0x8,%rsp
+  802b05:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  802b08:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b0c:	75 10                	jne    802b1e <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  802b0e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b15:	00 00 00 
+  802b18:	8b 00                	mov    (%rax),%eax
+  802b1a:	48 98                	cltq
+  802b1c:	eb 05                	jmp    802b23 <vsyscall+0x26>
+  }
+  return 0;
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b23:	c9                   	leave
+  802b24:	c3                   	ret
+
+0000000000802b25 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  802b25:	55                   	push   %rbp
+  802b26:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  802b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b2e:	48 b8 fd 2a 80 00 00 	movabs $0x802afd,%rax
+  802b35:	00 00 00 
+  802b38:	ff d0                	call   *%rax
+}
+  802b3a:	5d                   	pop    %rbp
+  802b3b:	c3                   	ret
+
+0000000000802b3c <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+  802b40:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  802b44:	0f 31                	rdtsc
+  802b46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b49:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  802b4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802b52:	48 c1 e2 20          	shl    $0x20,%rdx
+  802b56:	48 09 d0             	or     %rdx,%rax
+  802b59:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  802b5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  802b61:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802b65:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b6c:	00 00 00 
+  802b6f:	8b 40 08             	mov    0x8(%rax),%eax
+  802b72:	48 98                	cltq
+  802b74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  802b78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b81:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b85:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  802b8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b95:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802b99:	48 89 d0             	mov    %rdx,%rax
+  802b9c:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  802ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  802bac:	48 01 c8             	add    %rcx,%rax
+}
+  802baf:	c9                   	leave
+  802bb0:	c3                   	ret
+
+0000000000802bb1 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  802bb1:	55                   	push   %rbp
+  802bb2:	48 89 e5             	mov    %rsp,%rbp
+  802bb5:	48 83 ec 20          	sub    $0x20,%rsp
+  802bb9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  802bbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bbf:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  802bc2:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  802bc6:	be 01 00 00 00       	mov    $0x1,%esi
+  802bcb:	48 89 c7             	mov    %rax,%rdi
+  802bce:	48 b8 86 01 80 00 00 	movabs $0x800186,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+}
+  802bda:	90                   	nop
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+
+0000000000802bdd <getchar>:
+
+int
+getchar(void) {
+  802bdd:	55                   	push   %rbp
+  802bde:	48 89 e5             	mov    %rsp,%rbp
+  802be1:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  802be5:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  802be9:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bee:	48 89 c6             	mov    %rax,%rsi
+  802bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf6:	48 b8 10 11 80 00 00 	movabs $0x801110,%rax
+  802bfd:	00 00 00 
+  802c00:	ff d0                	call   *%rax
+  802c02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  802c05:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c09:	79 05                	jns    802c10 <getchar+0x33>
+    return r;
+  802c0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c0e:	eb 14                	jmp    802c24 <getchar+0x47>
+  if (r < 1)
+  802c10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c14:	7f 07                	jg     802c1d <getchar+0x40>
+    return -E_EOF;
+  802c16:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  802c1b:	eb 07                	jmp    802c24 <getchar+0x47>
+  return c;
+  802c1d:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  802c21:	0f b6 c0             	movzbl %al,%eax
+}
+  802c24:	c9                   	leave
+  802c25:	c3                   	ret
+
+0000000000802c26 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  802c26:	55                   	push   %rbp
+  802c27:	48 89 e5             	mov    %rsp,%rbp
+  802c2a:	48 83 ec 20          	sub    $0x20,%rsp
+  802c2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c31:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c38:	48 89 d6             	mov    %rdx,%rsi
+  802c3b:	89 c7                	mov    %eax,%edi
+  802c3d:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  802c44:	00 00 00 
+  802c47:	ff d0                	call   *%rax
+  802c49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c50:	79 05                	jns    802c57 <iscons+0x31>
+    return r;
+  802c52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c55:	eb 1a                	jmp    802c71 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5b:	8b 10                	mov    (%rax),%edx
+  802c5d:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802c64:	00 00 00 
+  802c67:	8b 00                	mov    (%rax),%eax
+  802c69:	39 c2                	cmp    %eax,%edx
+  802c6b:	0f 94 c0             	sete   %al
+  802c6e:	0f b6 c0             	movzbl %al,%eax
+}
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+
+0000000000802c73 <opencons>:
+
+int
+opencons(void) {
+  802c73:	55                   	push   %rbp
+  802c74:	48 89 e5             	mov    %rsp,%rbp
+  802c77:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  802c7b:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802c7f:	48 89 c7             	mov    %rax,%rdi
+  802c82:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  802c89:	00 00 00 
+  802c8c:	ff d0                	call   *%rax
+  802c8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c95:	79 05                	jns    802c9c <opencons+0x29>
+    return r;
+  802c97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c9a:	eb 66                	jmp    802d02 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  802c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca0:	ba 07 04 00 00       	mov    $0x407,%edx
+  802ca5:	48 89 c6             	mov    %rax,%rsi
+  802ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cad:	48 b8 9d 03 80 00 00 	movabs $0x80039d,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+  802cb9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cbc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cc0:	79 05                	jns    802cc7 <opencons+0x54>
+    return r;
+  802cc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc5:	eb 3b                	jmp    802d02 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  802cc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ccb:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  802cd2:	00 00 00 
+  802cd5:	8b 12                	mov    (%rdx),%edx
+  802cd7:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  802cd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cdd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  802ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ce8:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  802cef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf3:	48 89 c7             	mov    %rax,%rdi
+  802cf6:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  802cfd:	00 00 00 
+  802d00:	ff d0                	call   *%rax
+}
+  802d02:	c9                   	leave
+  802d03:	c3                   	ret
+
+0000000000802d04 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  802d04:	55                   	push   %rbp
+  802d05:	48 89 e5             	mov    %rsp,%rbp
+  802d08:	48 83 ec 20          	sub    $0x20,%rsp
+  802d0c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d0f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d12:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802d16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d19:	48 89 d6             	mov    %rdx,%rsi
+  802d1c:	89 c7                	mov    %eax,%edi
+  802d1e:	48 b8 b4 0b 80 00 00 	movabs $0x800bb4,%rax
+  802d25:	00 00 00 
+  802d28:	ff d0                	call   *%rax
+  802d2a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d2d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d31:	79 05                	jns    802d38 <consmode+0x34>
+    return r;
+  802d33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d36:	eb 34                	jmp    802d6c <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  802d38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3c:	8b 10                	mov    (%rax),%edx
+  802d3e:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  802d45:	00 00 00 
+  802d48:	8b 00                	mov    (%rax),%eax
+  802d4a:	39 c2                	cmp    %eax,%edx
+  802d4c:	74 07                	je     802d55 <consmode+0x51>
+    return -E_INVAL;
+  802d4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d53:	eb 17                	jmp    802d6c <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  802d55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d59:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  802d5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d63:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d66:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  802d69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802d6c:	c9                   	leave
+  802d6d:	c3                   	ret
+
+0000000000802d6e <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d6e:	55                   	push   %rbp
+  802d6f:	48 89 e5             	mov    %rsp,%rbp
+  802d72:	48 83 ec 20          	sub    $0x20,%rsp
+  802d76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d7e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  802d82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d86:	8b 50 0c             	mov    0xc(%rax),%edx
+  802d89:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d91:	48 89 ce             	mov    %rcx,%rsi
+  802d94:	48 89 c7             	mov    %rax,%rdi
+  802d97:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  802d9e:	00 00 00 
+  802da1:	ff d0                	call   *%rax
+  802da3:	48 98                	cltq
+}
+  802da5:	c9                   	leave
+  802da6:	c3                   	ret
+
+0000000000802da7 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802da7:	55                   	push   %rbp
+  802da8:	48 89 e5             	mov    %rsp,%rbp
+  802dab:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  802db2:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  802db9:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  802dc0:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  802dc7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802dce:	eb 74                	jmp    802e44 <devcons_write+0x9d>
+    m = n - tot;
+  802dd0:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  802dd7:	89 c2                	mov    %eax,%edx
+  802dd9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ddc:	29 c2                	sub    %eax,%edx
+  802dde:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  802de1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802de4:	83 f8 7f             	cmp    $0x7f,%eax
+  802de7:	76 07                	jbe    802df0 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  802de9:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  802df0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802df3:	48 63 d0             	movslq %eax,%rdx
+  802df6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802df9:	48 63 c8             	movslq %eax,%rcx
+  802dfc:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  802e03:	48 01 c1             	add    %rax,%rcx
+  802e06:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e0d:	48 89 ce             	mov    %rcx,%rsi
+  802e10:	48 89 c7             	mov    %rax,%rdi
+  802e13:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  802e1a:	00 00 00 
+  802e1d:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  802e1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e22:	48 63 d0             	movslq %eax,%rdx
+  802e25:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  802e2c:	48 89 d6             	mov    %rdx,%rsi
+  802e2f:	48 89 c7             	mov    %rax,%rdi
+  802e32:	48 b8 86 01 80 00 00 	movabs $0x800186,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  802e3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802e41:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802e44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e47:	48 98                	cltq
+  802e49:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  802e50:	0f 82 7a ff ff ff    	jb     802dd0 <devcons_write+0x29>
+  }
+  return tot;
+  802e56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e59:	48 98                	cltq
+}
+  802e5b:	c9                   	leave
+  802e5c:	c3                   	ret
+
+0000000000802e5d <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  802e5d:	55                   	push   %rbp
+  802e5e:	48 89 e5             	mov    %rsp,%rbp
+  802e61:	48 83 ec 08          	sub    $0x8,%rsp
+  802e65:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  802e69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+0000000000802e70 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+  802e74:	48 83 ec 10          	sub    $0x10,%rsp
+  802e78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e7c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  802e80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e84:	48 ba c5 50 80 00 00 	movabs $0x8050c5,%rdx
+  802e8b:	00 00 00 
+  802e8e:	48 89 d6             	mov    %rdx,%rsi
+  802e91:	48 89 c7             	mov    %rax,%rdi
+  802e94:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  802e9b:	00 00 00 
+  802e9e:	ff d0                	call   *%rax
+  return 0;
+  802ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+
+0000000000802ea7 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  802ea7:	55                   	push   %rbp
+  802ea8:	48 89 e5             	mov    %rsp,%rbp
+  802eab:	48 83 ec 30          	sub    $0x30,%rsp
+  802eaf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802eb3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802eb6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  802eba:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  802ec1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ec4:	83 e0 02             	and    $0x2,%eax
+  802ec7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  802eca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ece:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ed1:	83 f8 01             	cmp    $0x1,%eax
+  802ed4:	75 04                	jne    802eda <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  802ed6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  802eda:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802edd:	83 e0 01             	and    $0x1,%eax
+  802ee0:	85 c0                	test   %eax,%eax
+  802ee2:	74 44                	je     802f28 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  802ee4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eec:	89 c2                	mov    %eax,%edx
+  802eee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef8:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+  802f04:	83 f8 01             	cmp    $0x1,%eax
+  802f07:	75 06                	jne    802f0f <devcons_poll+0x68>
+      revents |= POLLIN;
+  802f09:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  802f0d:	eb 19                	jmp    802f28 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  802f0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f13:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  802f19:	0b 45 fc             	or     -0x4(%rbp),%eax
+  802f1c:	89 c2                	mov    %eax,%edx
+  802f1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f22:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  802f28:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802f2b:	c9                   	leave
+  802f2c:	c3                   	ret
+
+0000000000802f2d <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802f2d:	55                   	push   %rbp
+  802f2e:	48 89 e5             	mov    %rsp,%rbp
+  802f31:	53                   	push   %rbx
+  802f32:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  802f39:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  802f40:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  802f46:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  802f4d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  802f54:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  802f5b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  802f62:	84 c0                	test   %al,%al
+  802f64:	74 23                	je     802f89 <_panic+0x5c>
+  802f66:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  802f6d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  802f71:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  802f75:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  802f79:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  802f7d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  802f81:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  802f85:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  802f89:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  802f90:	00 00 00 
+  802f93:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  802f9a:	00 00 00 
+  802f9d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802fa1:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  802fa8:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  802faf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802fb6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802fbd:	00 00 00 
+  802fc0:	48 8b 18             	mov    (%rax),%rbx
+  802fc3:	48 b8 24 03 80 00 00 	movabs $0x800324,%rax
+  802fca:	00 00 00 
+  802fcd:	ff d0                	call   *%rax
+  802fcf:	89 c6                	mov    %eax,%esi
+  802fd1:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  802fd7:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  802fde:	41 89 d0             	mov    %edx,%r8d
+  802fe1:	48 89 c1             	mov    %rax,%rcx
+  802fe4:	48 89 da             	mov    %rbx,%rdx
+  802fe7:	48 b8 d0 50 80 00 00 	movabs $0x8050d0,%rax
+  802fee:	00 00 00 
+  802ff1:	48 89 c7             	mov    %rax,%rdi
+  802ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff9:	49 b9 4c 31 80 00 00 	movabs $0x80314c,%r9
+  803000:	00 00 00 
+  803003:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803006:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80300d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803014:	48 89 d6             	mov    %rdx,%rsi
+  803017:	48 89 c7             	mov    %rax,%rdi
+  80301a:	48 b8 c1 30 80 00 00 	movabs $0x8030c1,%rax
+  803021:	00 00 00 
+  803024:	ff d0                	call   *%rax
+  cprintf("\n");
+  803026:	48 b8 f3 50 80 00 00 	movabs $0x8050f3,%rax
+  80302d:	00 00 00 
+  803030:	48 89 c7             	mov    %rax,%rdi
+  803033:	b8 00 00 00 00       	mov    $0x0,%eax
+  803038:	48 ba 4c 31 80 00 00 	movabs $0x80314c,%rdx
+  80303f:	00 00 00 
+  803042:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  803044:	cc                   	int3
+  803045:	eb fd                	jmp    803044 <_panic+0x117>
+
+0000000000803047 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  803047:	55                   	push   %rbp
+  803048:	48 89 e5             	mov    %rsp,%rbp
+  80304b:	48 83 ec 10          	sub    $0x10,%rsp
+  80304f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803052:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  803056:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80305a:	8b 00                	mov    (%rax),%eax
+  80305c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80305f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803063:	89 0a                	mov    %ecx,(%rdx)
+  803065:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803068:	89 d1                	mov    %edx,%ecx
+  80306a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80306e:	48 98                	cltq
+  803070:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  803074:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803078:	8b 00                	mov    (%rax),%eax
+  80307a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80307f:	75 2c                	jne    8030ad <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  803081:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803085:	8b 00                	mov    (%rax),%eax
+  803087:	48 98                	cltq
+  803089:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80308d:	48 83 c2 08          	add    $0x8,%rdx
+  803091:	48 89 c6             	mov    %rax,%rsi
+  803094:	48 89 d7             	mov    %rdx,%rdi
+  803097:	48 b8 86 01 80 00 00 	movabs $0x800186,%rax
+  80309e:	00 00 00 
+  8030a1:	ff d0                	call   *%rax
+    b->idx = 0;
+  8030a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8030ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b1:	8b 40 04             	mov    0x4(%rax),%eax
+  8030b4:	8d 50 01             	lea    0x1(%rax),%edx
+  8030b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030bb:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8030be:	90                   	nop
+  8030bf:	c9                   	leave
+  8030c0:	c3                   	ret
+
+00000000008030c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8030c1:	55                   	push   %rbp
+  8030c2:	48 89 e5             	mov    %rsp,%rbp
+  8030c5:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8030cc:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8030d3:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8030da:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8030e1:	00 00 00 
+  b.cnt = 0;
+  8030e4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8030eb:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8030ee:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8030f5:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8030fc:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  803103:	48 89 c6             	mov    %rax,%rsi
+  803106:	48 b8 47 30 80 00 00 	movabs $0x803047,%rax
+  80310d:	00 00 00 
+  803110:	48 89 c7             	mov    %rax,%rdi
+  803113:	48 b8 a6 34 80 00 00 	movabs $0x8034a6,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80311f:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  803125:	48 98                	cltq
+  803127:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80312e:	48 83 c2 08          	add    $0x8,%rdx
+  803132:	48 89 c6             	mov    %rax,%rsi
+  803135:	48 89 d7             	mov    %rdx,%rdi
+  803138:	48 b8 86 01 80 00 00 	movabs $0x800186,%rax
+  80313f:	00 00 00 
+  803142:	ff d0                	call   *%rax
+
+  return b.cnt;
+  803144:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80314a:	c9                   	leave
+  80314b:	c3                   	ret
+
+000000000080314c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80314c:	55                   	push   %rbp
+  80314d:	48 89 e5             	mov    %rsp,%rbp
+  803150:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  803157:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80315e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803165:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80316c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803173:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80317a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803181:	84 c0                	test   %al,%al
+  803183:	74 20                	je     8031a5 <cprintf+0x59>
+  803185:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803189:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80318d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803191:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803195:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803199:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80319d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8031a1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8031a5:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8031ac:	00 00 00 
+  8031af:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8031b6:	00 00 00 
+  8031b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8031bd:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8031c4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8031cb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8031d2:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8031d9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8031e0:	48 89 d6             	mov    %rdx,%rsi
+  8031e3:	48 89 c7             	mov    %rax,%rdi
+  8031e6:	48 b8 c1 30 80 00 00 	movabs $0x8030c1,%rax
+  8031ed:	00 00 00 
+  8031f0:	ff d0                	call   *%rax
+  8031f2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8031f8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8031fe:	c9                   	leave
+  8031ff:	c3                   	ret
+
+0000000000803200 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  803200:	55                   	push   %rbp
+  803201:	48 89 e5             	mov    %rsp,%rbp
+  803204:	48 83 ec 30          	sub    $0x30,%rsp
+  803208:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80320c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803210:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803214:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  803217:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80321b:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80321f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803222:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  803226:	72 54                	jb     80327c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  803228:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80322b:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80322e:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  803231:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323a:	48 f7 f6             	div    %rsi
+  80323d:	49 89 c2             	mov    %rax,%r10
+  803240:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803243:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803246:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80324a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80324e:	41 89 c9             	mov    %ecx,%r9d
+  803251:	41 89 f8             	mov    %edi,%r8d
+  803254:	89 d1                	mov    %edx,%ecx
+  803256:	4c 89 d2             	mov    %r10,%rdx
+  803259:	48 89 c7             	mov    %rax,%rdi
+  80325c:	48 b8 00 32 80 00 00 	movabs $0x803200,%rax
+  803263:	00 00 00 
+  803266:	ff d0                	call   *%rax
+  803268:	eb 1c                	jmp    803286 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80326a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80326e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803271:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803275:	48 89 d6             	mov    %rdx,%rsi
+  803278:	89 c7                	mov    %eax,%edi
+  80327a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80327c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  803280:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803284:	7f e4                	jg     80326a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  803286:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  803289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80328d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803292:	48 f7 f1             	div    %rcx
+  803295:	48 b8 30 53 80 00 00 	movabs $0x805330,%rax
+  80329c:	00 00 00 
+  80329f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8032a3:	0f be c0             	movsbl %al,%eax
+  8032a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032aa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8032ae:	48 89 d6             	mov    %rdx,%rsi
+  8032b1:	89 c7                	mov    %eax,%edi
+  8032b3:	ff d1                	call   *%rcx
+}
+  8032b5:	90                   	nop
+  8032b6:	c9                   	leave
+  8032b7:	c3                   	ret
+
+00000000008032b8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8032b8:	55                   	push   %rbp
+  8032b9:	48 89 e5             	mov    %rsp,%rbp
+  8032bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8032c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032c4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8032c7:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8032cb:	7e 4b                	jle    803318 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8032cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d1:	8b 00                	mov    (%rax),%eax
+  8032d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8032d6:	77 24                	ja     8032fc <getuint+0x44>
+  8032d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032dc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e4:	8b 00                	mov    (%rax),%eax
+  8032e6:	89 c0                	mov    %eax,%eax
+  8032e8:	48 01 d0             	add    %rdx,%rax
+  8032eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032ef:	8b 12                	mov    (%rdx),%edx
+  8032f1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8032f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f8:	89 0a                	mov    %ecx,(%rdx)
+  8032fa:	eb 14                	jmp    803310 <getuint+0x58>
+  8032fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803300:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803304:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803308:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80330c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803310:	48 8b 00             	mov    (%rax),%rax
+  803313:	e9 95 00 00 00       	jmp    8033ad <getuint+0xf5>
+  else if (lflag)
+  803318:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80331c:	74 48                	je     803366 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80331e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803322:	8b 00                	mov    (%rax),%eax
+  803324:	83 f8 2f             	cmp    $0x2f,%eax
+  803327:	77 24                	ja     80334d <getuint+0x95>
+  803329:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80332d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803331:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803335:	8b 00                	mov    (%rax),%eax
+  803337:	89 c0                	mov    %eax,%eax
+  803339:	48 01 d0             	add    %rdx,%rax
+  80333c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803340:	8b 12                	mov    (%rdx),%edx
+  803342:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803345:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803349:	89 0a                	mov    %ecx,(%rdx)
+  80334b:	eb 14                	jmp    803361 <getuint+0xa9>
+  80334d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803351:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803355:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803359:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80335d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803361:	48 8b 00             	mov    (%rax),%rax
+  803364:	eb 47                	jmp    8033ad <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  803366:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336a:	8b 00                	mov    (%rax),%eax
+  80336c:	83 f8 2f             	cmp    $0x2f,%eax
+  80336f:	77 24                	ja     803395 <getuint+0xdd>
+  803371:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803375:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803379:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80337d:	8b 00                	mov    (%rax),%eax
+  80337f:	89 c0                	mov    %eax,%eax
+  803381:	48 01 d0             	add    %rdx,%rax
+  803384:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803388:	8b 12                	mov    (%rdx),%edx
+  80338a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80338d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803391:	89 0a                	mov    %ecx,(%rdx)
+  803393:	eb 14                	jmp    8033a9 <getuint+0xf1>
+  803395:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803399:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80339d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8033a9:	8b 00                	mov    (%rax),%eax
+  8033ab:	89 c0                	mov    %eax,%eax
+}
+  8033ad:	c9                   	leave
+  8033ae:	c3                   	ret
+
+00000000008033af <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8033af:	55                   	push   %rbp
+  8033b0:	48 89 e5             	mov    %rsp,%rbp
+  8033b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8033b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033bb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8033be:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8033c2:	7e 4b                	jle    80340f <getint+0x60>
+    return va_arg(*ap, long long);
+  8033c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c8:	8b 00                	mov    (%rax),%eax
+  8033ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8033cd:	77 24                	ja     8033f3 <getint+0x44>
+  8033cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033db:	8b 00                	mov    (%rax),%eax
+  8033dd:	89 c0                	mov    %eax,%eax
+  8033df:	48 01 d0             	add    %rdx,%rax
+  8033e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033e6:	8b 12                	mov    (%rdx),%edx
+  8033e8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8033eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ef:	89 0a                	mov    %ecx,(%rdx)
+  8033f1:	eb 14                	jmp    803407 <getint+0x58>
+  8033f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033fb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8033ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803403:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803407:	48 8b 00             	mov    (%rax),%rax
+  80340a:	e9 95 00 00 00       	jmp    8034a4 <getint+0xf5>
+  else if (lflag)
+  80340f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803413:	74 48                	je     80345d <getint+0xae>
+    return va_arg(*ap, long);
+  803415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803419:	8b 00                	mov    (%rax),%eax
+  80341b:	83 f8 2f             	cmp    $0x2f,%eax
+  80341e:	77 24                	ja     803444 <getint+0x95>
+  803420:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803424:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803428:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80342c:	8b 00                	mov    (%rax),%eax
+  80342e:	89 c0                	mov    %eax,%eax
+  803430:	48 01 d0             	add    %rdx,%rax
+  803433:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803437:	8b 12                	mov    (%rdx),%edx
+  803439:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80343c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803440:	89 0a                	mov    %ecx,(%rdx)
+  803442:	eb 14                	jmp    803458 <getint+0xa9>
+  803444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803448:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80344c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803450:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803454:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  803458:	48 8b 00             	mov    (%rax),%rax
+  80345b:	eb 47                	jmp    8034a4 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80345d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803461:	8b 00                	mov    (%rax),%eax
+  803463:	83 f8 2f             	cmp    $0x2f,%eax
+  803466:	77 24                	ja     80348c <getint+0xdd>
+  803468:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803474:	8b 00                	mov    (%rax),%eax
+  803476:	89 c0                	mov    %eax,%eax
+  803478:	48 01 d0             	add    %rdx,%rax
+  80347b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80347f:	8b 12                	mov    (%rdx),%edx
+  803481:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  803484:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803488:	89 0a                	mov    %ecx,(%rdx)
+  80348a:	eb 14                	jmp    8034a0 <getint+0xf1>
+  80348c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803490:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803494:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  803498:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80349c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8034a0:	8b 00                	mov    (%rax),%eax
+  8034a2:	48 98                	cltq
+}
+  8034a4:	c9                   	leave
+  8034a5:	c3                   	ret
+
+00000000008034a6 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8034a6:	55                   	push   %rbp
+  8034a7:	48 89 e5             	mov    %rsp,%rbp
+  8034aa:	41 54                	push   %r12
+  8034ac:	53                   	push   %rbx
+  8034ad:	48 83 ec 60          	sub    $0x60,%rsp
+  8034b1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8034b5:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8034b9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8034bd:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8034c1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8034c5:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8034c9:	48 8b 06             	mov    (%rsi),%rax
+  8034cc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8034d0:	48 89 01             	mov    %rax,(%rcx)
+  8034d3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8034d7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8034db:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034df:	eb 17                	jmp    8034f8 <vprintfmt+0x52>
+      if (ch == '\0')
+  8034e1:	85 db                	test   %ebx,%ebx
+  8034e3:	0f 84 bf 04 00 00    	je     8039a8 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8034e9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8034ed:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8034f1:	48 89 c6             	mov    %rax,%rsi
+  8034f4:	89 df                	mov    %ebx,%edi
+  8034f6:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8034f8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8034fc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803500:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803504:	0f b6 00             	movzbl (%rax),%eax
+  803507:	0f b6 d8             	movzbl %al,%ebx
+  80350a:	83 fb 25             	cmp    $0x25,%ebx
+  80350d:	75 d2                	jne    8034e1 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80350f:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  803513:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80351a:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  803521:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  803528:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80352f:	eb 04                	jmp    803535 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  803531:	90                   	nop
+  803532:	eb 01                	jmp    803535 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  803534:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  803535:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803539:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80353d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  803541:	0f b6 00             	movzbl (%rax),%eax
+  803544:	0f b6 d8             	movzbl %al,%ebx
+  803547:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80354a:	83 f8 55             	cmp    $0x55,%eax
+  80354d:	0f 87 22 04 00 00    	ja     803975 <vprintfmt+0x4cf>
+  803553:	89 c0                	mov    %eax,%eax
+  803555:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80355c:	00 
+  80355d:	48 b8 58 53 80 00 00 	movabs $0x805358,%rax
+  803564:	00 00 00 
+  803567:	48 01 d0             	add    %rdx,%rax
+  80356a:	48 8b 00             	mov    (%rax),%rax
+  80356d:	ff e0                	jmp    *%rax
+        padc = '-';
+  80356f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  803573:	eb c0                	jmp    803535 <vprintfmt+0x8f>
+        padc = '0';
+  803575:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  803579:	eb ba                	jmp    803535 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  80357b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  803582:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803585:	89 d0                	mov    %edx,%eax
+  803587:	c1 e0 02             	shl    $0x2,%eax
+  80358a:	01 d0                	add    %edx,%eax
+  80358c:	01 c0                	add    %eax,%eax
+  80358e:	01 d8                	add    %ebx,%eax
+  803590:	83 e8 30             	sub    $0x30,%eax
+  803593:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  803596:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80359a:	0f b6 00             	movzbl (%rax),%eax
+  80359d:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8035a0:	83 fb 2f             	cmp    $0x2f,%ebx
+  8035a3:	7e 60                	jle    803605 <vprintfmt+0x15f>
+  8035a5:	83 fb 39             	cmp    $0x39,%ebx
+  8035a8:	7f 5b                	jg     803605 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8035aa:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8035af:	eb d1                	jmp    803582 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8035b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8035b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8035b7:	77 17                	ja     8035d0 <vprintfmt+0x12a>
+  8035b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035bd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035c0:	89 d2                	mov    %edx,%edx
+  8035c2:	48 01 d0             	add    %rdx,%rax
+  8035c5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8035c8:	83 c2 08             	add    $0x8,%edx
+  8035cb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8035ce:	eb 0c                	jmp    8035dc <vprintfmt+0x136>
+  8035d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8035d8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035dc:	8b 00                	mov    (%rax),%eax
+  8035de:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8035e1:	eb 23                	jmp    803606 <vprintfmt+0x160>
+        if (width < 0)
+  8035e3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035e7:	0f 89 44 ff ff ff    	jns    803531 <vprintfmt+0x8b>
+          width = 0;
+  8035ed:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8035f4:	e9 38 ff ff ff       	jmp    803531 <vprintfmt+0x8b>
+        altflag = 1;
+  8035f9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  803600:	e9 30 ff ff ff       	jmp    803535 <vprintfmt+0x8f>
+        goto process_precision;
+  803605:	90                   	nop
+        if (width < 0)
+  803606:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80360a:	0f 89 24 ff ff ff    	jns    803534 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  803610:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803613:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803616:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80361d:	e9 12 ff ff ff       	jmp    803534 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  803622:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  803626:	e9 0a ff ff ff       	jmp    803535 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  80362b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80362e:	83 f8 2f             	cmp    $0x2f,%eax
+  803631:	77 17                	ja     80364a <vprintfmt+0x1a4>
+  803633:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803637:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80363a:	89 d2                	mov    %edx,%edx
+  80363c:	48 01 d0             	add    %rdx,%rax
+  80363f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803642:	83 c2 08             	add    $0x8,%edx
+  803645:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803648:	eb 0c                	jmp    803656 <vprintfmt+0x1b0>
+  80364a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80364e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803652:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803656:	8b 00                	mov    (%rax),%eax
+  803658:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80365c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803660:	48 89 d6             	mov    %rdx,%rsi
+  803663:	89 c7                	mov    %eax,%edi
+  803665:	ff d1                	call   *%rcx
+        break;
+  803667:	e9 37 03 00 00       	jmp    8039a3 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  80366c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80366f:	83 f8 2f             	cmp    $0x2f,%eax
+  803672:	77 17                	ja     80368b <vprintfmt+0x1e5>
+  803674:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803678:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80367b:	89 d2                	mov    %edx,%edx
+  80367d:	48 01 d0             	add    %rdx,%rax
+  803680:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803683:	83 c2 08             	add    $0x8,%edx
+  803686:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803689:	eb 0c                	jmp    803697 <vprintfmt+0x1f1>
+  80368b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80368f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  803693:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803697:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  803699:	85 db                	test   %ebx,%ebx
+  80369b:	79 02                	jns    80369f <vprintfmt+0x1f9>
+          err = -err;
+  80369d:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80369f:	83 fb 15             	cmp    $0x15,%ebx
+  8036a2:	7f 16                	jg     8036ba <vprintfmt+0x214>
+  8036a4:	48 ba 80 52 80 00 00 	movabs $0x805280,%rdx
+  8036ab:	00 00 00 
+  8036ae:	48 63 c3             	movslq %ebx,%rax
+  8036b1:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8036b5:	4d 85 e4             	test   %r12,%r12
+  8036b8:	75 2e                	jne    8036e8 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8036ba:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036c2:	89 d9                	mov    %ebx,%ecx
+  8036c4:	48 ba 41 53 80 00 00 	movabs $0x805341,%rdx
+  8036cb:	00 00 00 
+  8036ce:	48 89 c7             	mov    %rax,%rdi
+  8036d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d6:	49 b8 b2 39 80 00 00 	movabs $0x8039b2,%r8
+  8036dd:	00 00 00 
+  8036e0:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8036e3:	e9 bb 02 00 00       	jmp    8039a3 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8036e8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8036ec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8036f0:	4c 89 e1             	mov    %r12,%rcx
+  8036f3:	48 ba 4a 53 80 00 00 	movabs $0x80534a,%rdx
+  8036fa:	00 00 00 
+  8036fd:	48 89 c7             	mov    %rax,%rdi
+  803700:	b8 00 00 00 00       	mov    $0x0,%eax
+  803705:	49 b8 b2 39 80 00 00 	movabs $0x8039b2,%r8
+  80370c:	00 00 00 
+  80370f:	41 ff d0             	call   *%r8
+        break;
+  803712:	e9 8c 02 00 00       	jmp    8039a3 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  803717:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80371a:	83 f8 2f             	cmp    $0x2f,%eax
+  80371d:	77 17                	ja     803736 <vprintfmt+0x290>
+  80371f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803723:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803726:	89 d2                	mov    %edx,%edx
+  803728:	48 01 d0             	add    %rdx,%rax
+  80372b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80372e:	83 c2 08             	add    $0x8,%edx
+  803731:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803734:	eb 0c                	jmp    803742 <vprintfmt+0x29c>
+  803736:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80373a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80373e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803742:	4c 8b 20             	mov    (%rax),%r12
+  803745:	4d 85 e4             	test   %r12,%r12
+  803748:	75 0a                	jne    803754 <vprintfmt+0x2ae>
+          p = "(null)";
+  80374a:	49 bc 4d 53 80 00 00 	movabs $0x80534d,%r12
+  803751:	00 00 00 
+        if (width > 0 && padc != '-')
+  803754:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803758:	7e 78                	jle    8037d2 <vprintfmt+0x32c>
+  80375a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  80375e:	74 72                	je     8037d2 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  803760:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803763:	48 98                	cltq
+  803765:	48 89 c6             	mov    %rax,%rsi
+  803768:	4c 89 e7             	mov    %r12,%rdi
+  80376b:	48 b8 be 40 80 00 00 	movabs $0x8040be,%rax
+  803772:	00 00 00 
+  803775:	ff d0                	call   *%rax
+  803777:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80377a:	eb 17                	jmp    803793 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  80377c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  803780:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  803784:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803788:	48 89 d6             	mov    %rdx,%rsi
+  80378b:	89 c7                	mov    %eax,%edi
+  80378d:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80378f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  803793:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803797:	7f e3                	jg     80377c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803799:	eb 37                	jmp    8037d2 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80379b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80379f:	74 1e                	je     8037bf <vprintfmt+0x319>
+  8037a1:	83 fb 1f             	cmp    $0x1f,%ebx
+  8037a4:	7e 05                	jle    8037ab <vprintfmt+0x305>
+  8037a6:	83 fb 7e             	cmp    $0x7e,%ebx
+  8037a9:	7e 14                	jle    8037bf <vprintfmt+0x319>
+            putch('?', putdat);
+  8037ab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037af:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037b3:	48 89 c6             	mov    %rax,%rsi
+  8037b6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8037bb:	ff d2                	call   *%rdx
+  8037bd:	eb 0f                	jmp    8037ce <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  8037bf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037c3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037c7:	48 89 c6             	mov    %rax,%rsi
+  8037ca:	89 df                	mov    %ebx,%edi
+  8037cc:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8037ce:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8037d2:	4c 89 e0             	mov    %r12,%rax
+  8037d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8037d9:	0f b6 00             	movzbl (%rax),%eax
+  8037dc:	0f be d8             	movsbl %al,%ebx
+  8037df:	85 db                	test   %ebx,%ebx
+  8037e1:	74 28                	je     80380b <vprintfmt+0x365>
+  8037e3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037e7:	78 b2                	js     80379b <vprintfmt+0x2f5>
+  8037e9:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8037ed:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8037f1:	79 a8                	jns    80379b <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8037f3:	eb 16                	jmp    80380b <vprintfmt+0x365>
+          putch(' ', putdat);
+  8037f5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037f9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8037fd:	48 89 c6             	mov    %rax,%rsi
+  803800:	bf 20 00 00 00       	mov    $0x20,%edi
+  803805:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  803807:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80380b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80380f:	7f e4                	jg     8037f5 <vprintfmt+0x34f>
+        break;
+  803811:	e9 8d 01 00 00       	jmp    8039a3 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  803816:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803819:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80381d:	89 d6                	mov    %edx,%esi
+  80381f:	48 89 c7             	mov    %rax,%rdi
+  803822:	48 b8 af 33 80 00 00 	movabs $0x8033af,%rax
+  803829:	00 00 00 
+  80382c:	ff d0                	call   *%rax
+  80382e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  803832:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803836:	48 85 c0             	test   %rax,%rax
+  803839:	79 1d                	jns    803858 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  80383b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80383f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  803843:	48 89 c6             	mov    %rax,%rsi
+  803846:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80384b:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  80384d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803851:	48 f7 d8             	neg    %rax
+  803854:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  803858:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80385f:	e9 d2 00 00 00       	jmp    803936 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  803864:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803867:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80386b:	89 d6                	mov    %edx,%esi
+  80386d:	48 89 c7             	mov    %rax,%rdi
+  803870:	48 b8 b8 32 80 00 00 	movabs $0x8032b8,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+  80387c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  803880:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  803887:	e9 aa 00 00 00       	jmp    803936 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80388c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80388f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  803893:	89 d6                	mov    %edx,%esi
+  803895:	48 89 c7             	mov    %rax,%rdi
+  803898:	48 b8 b8 32 80 00 00 	movabs $0x8032b8,%rax
+  80389f:	00 00 00 
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  8038a8:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  8038af:	e9 82 00 00 00       	jmp    803936 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  8038b4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038b8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038bc:	48 89 c6             	mov    %rax,%rsi
+  8038bf:	bf 30 00 00 00       	mov    $0x30,%edi
+  8038c4:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  8038c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038ca:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8038ce:	48 89 c6             	mov    %rax,%rsi
+  8038d1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8038d6:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8038d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038db:	83 f8 2f             	cmp    $0x2f,%eax
+  8038de:	77 17                	ja     8038f7 <vprintfmt+0x451>
+  8038e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038e7:	89 d2                	mov    %edx,%edx
+  8038e9:	48 01 d0             	add    %rdx,%rax
+  8038ec:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8038ef:	83 c2 08             	add    $0x8,%edx
+  8038f2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8038f5:	eb 0c                	jmp    803903 <vprintfmt+0x45d>
+  8038f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8038fb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8038ff:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803903:	48 8b 00             	mov    (%rax),%rax
+  803906:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80390a:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  803911:	eb 23                	jmp    803936 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  803913:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  803916:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80391a:	89 d6                	mov    %edx,%esi
+  80391c:	48 89 c7             	mov    %rax,%rdi
+  80391f:	48 b8 b8 32 80 00 00 	movabs $0x8032b8,%rax
+  803926:	00 00 00 
+  803929:	ff d0                	call   *%rax
+  80392b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80392f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  803936:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  80393b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80393e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  803941:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803945:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  803949:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80394d:	45 89 c1             	mov    %r8d,%r9d
+  803950:	41 89 f8             	mov    %edi,%r8d
+  803953:	48 89 c7             	mov    %rax,%rdi
+  803956:	48 b8 00 32 80 00 00 	movabs $0x803200,%rax
+  80395d:	00 00 00 
+  803960:	ff d0                	call   *%rax
+        break;
+  803962:	eb 3f                	jmp    8039a3 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  803964:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803968:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80396c:	48 89 c6             	mov    %rax,%rsi
+  80396f:	89 df                	mov    %ebx,%edi
+  803971:	ff d2                	call   *%rdx
+        break;
+  803973:	eb 2e                	jmp    8039a3 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  803975:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803979:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80397d:	48 89 c6             	mov    %rax,%rsi
+  803980:	bf 25 00 00 00       	mov    $0x25,%edi
+  803985:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  803987:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80398c:	eb 05                	jmp    803993 <vprintfmt+0x4ed>
+  80398e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  803993:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  803997:	48 83 e8 01          	sub    $0x1,%rax
+  80399b:	0f b6 00             	movzbl (%rax),%eax
+  80399e:	3c 25                	cmp    $0x25,%al
+  8039a0:	75 ec                	jne    80398e <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8039a2:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8039a3:	e9 50 fb ff ff       	jmp    8034f8 <vprintfmt+0x52>
+        return;
+  8039a8:	90                   	nop
+    }
+  }
+}
+  8039a9:	48 83 c4 60          	add    $0x60,%rsp
+  8039ad:	5b                   	pop    %rbx
+  8039ae:	41 5c                	pop    %r12
+  8039b0:	5d                   	pop    %rbp
+  8039b1:	c3                   	ret
+
+00000000008039b2 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8039b2:	55                   	push   %rbp
+  8039b3:	48 89 e5             	mov    %rsp,%rbp
+  8039b6:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8039bd:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8039c4:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8039cb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8039d2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8039d9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8039e0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8039e7:	84 c0                	test   %al,%al
+  8039e9:	74 20                	je     803a0b <printfmt+0x59>
+  8039eb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8039ef:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8039f3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8039f7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8039fb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8039ff:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803a03:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803a07:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  803a0b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  803a12:	00 00 00 
+  803a15:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  803a1c:	00 00 00 
+  803a1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a23:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  803a2a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803a31:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  803a38:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  803a3f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803a46:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  803a4d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803a54:	48 89 c7             	mov    %rax,%rdi
+  803a57:	48 b8 a6 34 80 00 00 	movabs $0x8034a6,%rax
+  803a5e:	00 00 00 
+  803a61:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  803a63:	90                   	nop
+  803a64:	c9                   	leave
+  803a65:	c3                   	ret
+
+0000000000803a66 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+  803a6a:	48 83 ec 10          	sub    $0x10,%rsp
+  803a6e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  803a75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a79:	8b 40 10             	mov    0x10(%rax),%eax
+  803a7c:	8d 50 01             	lea    0x1(%rax),%edx
+  803a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a83:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  803a86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a8a:	48 8b 10             	mov    (%rax),%rdx
+  803a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a91:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803a95:	48 39 c2             	cmp    %rax,%rdx
+  803a98:	73 17                	jae    803ab1 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  803a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9e:	48 8b 00             	mov    (%rax),%rax
+  803aa1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  803aa5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803aa9:	48 89 0a             	mov    %rcx,(%rdx)
+  803aac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803aaf:	88 10                	mov    %dl,(%rax)
+}
+  803ab1:	90                   	nop
+  803ab2:	c9                   	leave
+  803ab3:	c3                   	ret
+
+0000000000803ab4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  803ab4:	55                   	push   %rbp
+  803ab5:	48 89 e5             	mov    %rsp,%rbp
+  803ab8:	48 83 ec 40          	sub    $0x40,%rsp
+  803abc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ac0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  803ac3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803ac7:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  803acb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803acf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ad3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ad6:	48 98                	cltq
+  803ad8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803adc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae0:	48 01 d0             	add    %rdx,%rax
+  803ae3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803ae7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  803aee:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803af3:	74 06                	je     803afb <vsnprintf+0x47>
+  803af5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  803af9:	7f 07                	jg     803b02 <vsnprintf+0x4e>
+    return -E_INVAL;
+  803afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b00:	eb 32                	jmp    803b34 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  803b02:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b06:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b0a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803b0e:	48 89 c6             	mov    %rax,%rsi
+  803b11:	48 b8 66 3a 80 00 00 	movabs $0x803a66,%rax
+  803b18:	00 00 00 
+  803b1b:	48 89 c7             	mov    %rax,%rdi
+  803b1e:	48 b8 a6 34 80 00 00 	movabs $0x8034a6,%rax
+  803b25:	00 00 00 
+  803b28:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  803b2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b2e:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  803b31:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  803b34:	c9                   	leave
+  803b35:	c3                   	ret
+
+0000000000803b36 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  803b36:	55                   	push   %rbp
+  803b37:	48 89 e5             	mov    %rsp,%rbp
+  803b3a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  803b41:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  803b48:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  803b4e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  803b55:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803b5c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803b63:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803b6a:	84 c0                	test   %al,%al
+  803b6c:	74 20                	je     803b8e <snprintf+0x58>
+  803b6e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803b72:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803b76:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803b7a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803b7e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803b82:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803b86:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803b8a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  803b8e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  803b95:	00 00 00 
+  803b98:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803b9f:	00 00 00 
+  803ba2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ba6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803bad:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803bb4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  803bbb:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  803bc2:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  803bc9:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  803bcf:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bd6:	48 89 c7             	mov    %rax,%rdi
+  803bd9:	48 b8 b4 3a 80 00 00 	movabs $0x803ab4,%rax
+  803be0:	00 00 00 
+  803be3:	ff d0                	call   *%rax
+  803be5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  803beb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  803bf1:	c9                   	leave
+  803bf2:	c3                   	ret
+
+0000000000803bf3 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  803bf3:	55                   	push   %rbp
+  803bf4:	48 89 e5             	mov    %rsp,%rbp
+  803bf7:	53                   	push   %rbx
+  803bf8:	48 83 ec 38          	sub    $0x38,%rsp
+  803bfc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  803bff:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803c03:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803c07:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803c0b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  803c0f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c17:	89 d1                	mov    %edx,%ecx
+  803c19:	0f a2                	cpuid
+  803c1b:	89 de                	mov    %ebx,%esi
+  803c1d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  803c20:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  803c23:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  803c26:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  803c29:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803c2e:	74 09                	je     803c39 <cpuid+0x46>
+}
+  803c30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c34:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c37:	89 10                	mov    %edx,(%rax)
+
+  803c39:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c3e:	74 09                	je     803c49 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  803c40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c44:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  803c47:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  803c49:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803c4e:	74 09                	je     803c59 <cpuid+0x66>
+char *
+  803c50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c54:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803c57:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  803c59:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c5e:	74 09                	je     803c69 <cpuid+0x76>
+  for (; *s; s++)
+  803c60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c64:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c67:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  803c69:	90                   	nop
+  803c6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c6e:	c9                   	leave
+  803c6f:	c3                   	ret
+
+0000000000803c70 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  803c70:	55                   	push   %rbp
+  803c71:	48 89 e5             	mov    %rsp,%rbp
+  803c74:	48 83 ec 18          	sub    $0x18,%rsp
+  803c78:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  803c7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c7e:	89 c1                	mov    %eax,%ecx
+  803c80:	0f 01 d0             	xgetbv
+  803c83:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c86:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  803c89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c8c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803c8f:	48 c1 e2 20          	shl    $0x20,%rdx
+  803c93:	48 09 d0             	or     %rdx,%rax
+#else
+  803c96:	c9                   	leave
+  803c97:	c3                   	ret
+
+0000000000803c98 <string_cpu>:
+string_cpu(void) {
+  803c98:	55                   	push   %rbp
+  803c99:	48 89 e5             	mov    %rsp,%rbp
+  803c9c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  803ca0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  803ca7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  803cae:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cb5:	00 00 00 
+  803cb8:	8b 00                	mov    (%rax),%eax
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	78 11                	js     803ccf <string_cpu+0x37>
+    return string_features;
+  803cbe:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803cc5:	00 00 00 
+  803cc8:	8b 00                	mov    (%rax),%eax
+  803cca:	e9 df 00 00 00       	jmp    803dae <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  803ccf:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  803cd3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce3:	48 89 c6             	mov    %rax,%rsi
+  803ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ceb:	48 b8 f3 3b 80 00 00 	movabs $0x803bf3,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  803cf7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803cfa:	83 f8 06             	cmp    $0x6,%eax
+  803cfd:	76 28                	jbe    803d27 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  803cff:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  803d03:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d0e:	48 89 c2             	mov    %rax,%rdx
+  803d11:	be 00 00 00 00       	mov    $0x0,%esi
+  803d16:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d1b:	48 b8 f3 3b 80 00 00 	movabs $0x803bf3,%rax
+  803d22:	00 00 00 
+  803d25:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  803d27:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d2a:	25 00 02 00 00       	and    $0x200,%eax
+  803d2f:	85 c0                	test   %eax,%eax
+  803d31:	74 04                	je     803d37 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  803d33:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  803d37:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803d3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d41:	48 89 c1             	mov    %rax,%rcx
+  803d44:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d49:	be 00 00 00 00       	mov    $0x0,%esi
+  803d4e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d53:	48 b8 f3 3b 80 00 00 	movabs $0x803bf3,%rax
+  803d5a:	00 00 00 
+  803d5d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d5f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d62:	83 e0 20             	and    $0x20,%eax
+  803d65:	85 c0                	test   %eax,%eax
+  803d67:	74 2a                	je     803d93 <string_cpu+0xfb>
+  803d69:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d6c:	25 00 00 00 08       	and    $0x8000000,%eax
+  803d71:	85 c0                	test   %eax,%eax
+  803d73:	74 1e                	je     803d93 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  803d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7a:	48 b8 70 3c 80 00 00 	movabs $0x803c70,%rax
+  803d81:	00 00 00 
+  803d84:	ff d0                	call   *%rax
+  803d86:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  803d89:	48 83 f8 06          	cmp    $0x6,%rax
+  803d8d:	75 04                	jne    803d93 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  803d8f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  803d93:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  803d9a:	00 00 00 
+  803d9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803da0:	89 02                	mov    %eax,(%rdx)
+  803da2:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  803da9:	00 00 00 
+  803dac:	8b 00                	mov    (%rax),%eax
+}
+  803dae:	c9                   	leave
+  803daf:	c3                   	ret
+
+0000000000803db0 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  803db0:	55                   	push   %rbp
+  803db1:	48 89 e5             	mov    %rsp,%rbp
+  803db4:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803db8:	48 83 ec 60          	sub    $0x60,%rsp
+  803dbc:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  803dc1:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803dc6:	83 e0 1f             	and    $0x1f,%eax
+  803dc9:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  803dcd:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803dd1:	48 f7 d8             	neg    %rax
+  803dd4:	48 89 c2             	mov    %rax,%rdx
+  803dd7:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  803ddc:	48 01 d0             	add    %rdx,%rax
+  803ddf:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  803de4:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  803de8:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  803dee:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803df3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803df7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803dfd:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e01:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e05:	89 c2                	mov    %eax,%edx
+  803e07:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  803e0b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  803e10:	89 c1                	mov    %eax,%ecx
+  803e12:	d3 e6                	shl    %cl,%esi
+  803e14:	89 f0                	mov    %esi,%eax
+  803e16:	21 d0                	and    %edx,%eax
+  803e18:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e1c:	eb 21                	jmp    803e3f <strlen_avx2+0x8f>
+    p += 32;
+  803e1e:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  803e24:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e29:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  803e2d:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  803e33:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e37:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e3b:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  803e3f:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  803e44:	74 d8                	je     803e1e <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  803e46:	31 c0                	xor    %eax,%eax
+  803e48:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  803e4e:	48 63 d0             	movslq %eax,%rdx
+  803e51:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  803e56:	48 01 d0             	add    %rdx,%rax
+  803e59:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  803e5e:	c9                   	leave
+  803e5f:	c3                   	ret
+
+0000000000803e60 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  803e60:	55                   	push   %rbp
+  803e61:	48 89 e5             	mov    %rsp,%rbp
+  803e64:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803e68:	48 83 ec 40          	sub    $0x40,%rsp
+  803e6c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803e71:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  803e76:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803e7b:	eb 77                	jmp    803ef4 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  803e7d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803e82:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e86:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803e8a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803e8f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803e93:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  803e97:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803e9b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  803e9f:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  803ea4:	74 3c                	je     803ee2 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  803ea6:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  803eaa:	f7 d0                	not    %eax
+  803eac:	f3 0f bc c0          	tzcnt  %eax,%eax
+  803eb0:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  803eb4:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  803eb8:	48 63 d0             	movslq %eax,%rdx
+  803ebb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803ec0:	48 01 d0             	add    %rdx,%rax
+  803ec3:	0f b6 00             	movzbl (%rax),%eax
+  803ec6:	0f b6 c0             	movzbl %al,%eax
+  803ec9:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  803ecd:	48 63 ca             	movslq %edx,%rcx
+  803ed0:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  803ed5:	48 01 ca             	add    %rcx,%rdx
+  803ed8:	0f b6 12             	movzbl (%rdx),%edx
+  803edb:	0f b6 d2             	movzbl %dl,%edx
+  803ede:	29 d0                	sub    %edx,%eax
+  803ee0:	eb 6b                	jmp    803f4d <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  803ee2:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803ee8:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  803eee:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803ef4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803efa:	77 81                	ja     803e7d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  803efc:	eb 42                	jmp    803f40 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  803efe:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f03:	0f b6 10             	movzbl (%rax),%edx
+  803f06:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f0b:	0f b6 00             	movzbl (%rax),%eax
+  803f0e:	38 c2                	cmp    %al,%dl
+  803f10:	74 1c                	je     803f2e <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  803f12:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f17:	0f b6 00             	movzbl (%rax),%eax
+  803f1a:	0f b6 c8             	movzbl %al,%ecx
+  803f1d:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  803f22:	0f b6 00             	movzbl (%rax),%eax
+  803f25:	0f b6 d0             	movzbl %al,%edx
+  803f28:	89 c8                	mov    %ecx,%eax
+  803f2a:	29 d0                	sub    %edx,%eax
+  803f2c:	eb 1f                	jmp    803f4d <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  803f2e:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803f34:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  803f3a:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803f40:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803f46:	75 b6                	jne    803efe <memcmp_avx2+0x9e>
+  return 0;
+  803f48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f4d:	c9                   	leave
+  803f4e:	c3                   	ret
+
+0000000000803f4f <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  803f4f:	55                   	push   %rbp
+  803f50:	48 89 e5             	mov    %rsp,%rbp
+  803f53:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  803f57:	48 83 ec 60          	sub    $0x60,%rsp
+  803f5b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  803f60:	89 f0                	mov    %esi,%eax
+  803f62:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  803f67:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  803f6b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  803f70:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  803f74:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  803f79:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  803f7f:	eb 47                	jmp    803fc8 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  803f81:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803f86:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  803f8a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  803f8e:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  803f94:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  803f98:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  803f9c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  803fa0:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  803fa5:	74 15                	je     803fbc <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  803fa7:	31 c0                	xor    %eax,%eax
+  803fa9:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  803faf:	48 63 d0             	movslq %eax,%rdx
+  803fb2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803fb7:	48 01 d0             	add    %rdx,%rax
+  803fba:	eb 3d                	jmp    803ff9 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  803fbc:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  803fc2:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  803fc8:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  803fce:	77 b1                	ja     803f81 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  803fd0:	eb 0c                	jmp    803fde <memfind_avx2+0x8f>
+  803fd2:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  803fd8:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  803fde:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  803fe4:	74 0e                	je     803ff4 <memfind_avx2+0xa5>
+  803fe6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  803feb:	0f b6 00             	movzbl (%rax),%eax
+  803fee:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  803ff2:	75 de                	jne    803fd2 <memfind_avx2+0x83>
+  return s;
+  803ff4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  803ff9:	c9                   	leave
+  803ffa:	c3                   	ret
+
+0000000000803ffb <strlen>:
+strlen(const char *s) {
+  803ffb:	55                   	push   %rbp
+  803ffc:	48 89 e5             	mov    %rsp,%rbp
+  803fff:	48 83 ec 40          	sub    $0x40,%rsp
+  804003:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  804007:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80400b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80400f:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  804016:	00 00 00 
+  804019:	ff d0                	call   *%rax
+  80401b:	83 e0 02             	and    $0x2,%eax
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	74 18                	je     80403a <strlen+0x3f>
+    return strlen_avx2(s);
+  804022:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804026:	48 89 c7             	mov    %rax,%rdi
+  804029:	48 b8 b0 3d 80 00 00 	movabs $0x803db0,%rax
+  804030:	00 00 00 
+  804033:	ff d0                	call   *%rax
+  804035:	e9 82 00 00 00       	jmp    8040bc <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80403a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80403e:	83 e0 0f             	and    $0xf,%eax
+  804041:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  804044:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804047:	48 f7 d8             	neg    %rax
+  80404a:	48 89 c2             	mov    %rax,%rdx
+  80404d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804051:	48 01 d0             	add    %rdx,%rax
+  804054:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  804058:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80405c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804060:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804065:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804069:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80406d:	89 c2                	mov    %eax,%edx
+  80406f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804072:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  804077:	89 c1                	mov    %eax,%ecx
+  804079:	d3 e6                	shl    %cl,%esi
+  80407b:	89 f0                	mov    %esi,%eax
+  80407d:	21 d0                	and    %edx,%eax
+  80407f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  804082:	eb 1d                	jmp    8040a1 <strlen+0xa6>
+    p += 16;
+  804084:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  804089:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80408d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804091:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  804096:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80409a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80409e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8040a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a5:	74 dd                	je     804084 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8040a7:	31 c0                	xor    %eax,%eax
+  8040a9:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8040ae:	48 63 d0             	movslq %eax,%rdx
+  8040b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040b5:	48 01 d0             	add    %rdx,%rax
+  8040b8:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8040bc:	c9                   	leave
+  8040bd:	c3                   	ret
+
+00000000008040be <strnlen>:
+strnlen(const char *s, size_t size) {
+  8040be:	55                   	push   %rbp
+  8040bf:	48 89 e5             	mov    %rsp,%rbp
+  8040c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8040c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8040d5:	eb 0e                	jmp    8040e5 <strnlen+0x27>
+    n++;
+  8040d7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8040db:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8040e0:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8040e5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8040ea:	74 0b                	je     8040f7 <strnlen+0x39>
+  8040ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040f0:	0f b6 00             	movzbl (%rax),%eax
+  8040f3:	84 c0                	test   %al,%al
+  8040f5:	75 e0                	jne    8040d7 <strnlen+0x19>
+  return n;
+  8040f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8040fa:	c9                   	leave
+  8040fb:	c3                   	ret
+
+00000000008040fc <strcpy>:
+strcpy(char *dst, const char *src) {
+  8040fc:	55                   	push   %rbp
+  8040fd:	48 89 e5             	mov    %rsp,%rbp
+  804100:	48 83 ec 20          	sub    $0x20,%rsp
+  804104:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804108:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80410c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804110:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  804114:	90                   	nop
+  804115:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804119:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80411d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804121:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804125:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804129:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80412d:	0f b6 12             	movzbl (%rdx),%edx
+  804130:	88 10                	mov    %dl,(%rax)
+  804132:	0f b6 00             	movzbl (%rax),%eax
+  804135:	84 c0                	test   %al,%al
+  804137:	75 dc                	jne    804115 <strcpy+0x19>
+  return ret;
+  804139:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80413d:	c9                   	leave
+  80413e:	c3                   	ret
+
+000000000080413f <strcat>:
+strcat(char *dst, const char *src) {
+  80413f:	55                   	push   %rbp
+  804140:	48 89 e5             	mov    %rsp,%rbp
+  804143:	48 83 ec 20          	sub    $0x20,%rsp
+  804147:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80414b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80414f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804153:	48 89 c7             	mov    %rax,%rdi
+  804156:	48 b8 fb 3f 80 00 00 	movabs $0x803ffb,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+  804162:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  804165:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804168:	48 63 d0             	movslq %eax,%rdx
+  80416b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416f:	48 01 c2             	add    %rax,%rdx
+  804172:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804176:	48 89 c6             	mov    %rax,%rsi
+  804179:	48 89 d7             	mov    %rdx,%rdi
+  80417c:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  804183:	00 00 00 
+  804186:	ff d0                	call   *%rax
+  return dst;
+  804188:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80418c:	c9                   	leave
+  80418d:	c3                   	ret
+
+000000000080418e <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+  804192:	48 83 ec 28          	sub    $0x28,%rsp
+  804196:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80419a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80419e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8041a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8041aa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041b1:	00 
+  8041b2:	eb 2a                	jmp    8041de <strncpy+0x50>
+    *dst++ = *src;
+  8041b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8041bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8041c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041c4:	0f b6 12             	movzbl (%rdx),%edx
+  8041c7:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8041c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041cd:	0f b6 00             	movzbl (%rax),%eax
+  8041d0:	84 c0                	test   %al,%al
+  8041d2:	74 05                	je     8041d9 <strncpy+0x4b>
+      src++;
+  8041d4:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8041d9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8041de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041e2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8041e6:	72 cc                	jb     8041b4 <strncpy+0x26>
+  return ret;
+  8041e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8041ec:	c9                   	leave
+  8041ed:	c3                   	ret
+
+00000000008041ee <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8041ee:	55                   	push   %rbp
+  8041ef:	48 89 e5             	mov    %rsp,%rbp
+  8041f2:	48 83 ec 28          	sub    $0x28,%rsp
+  8041f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041fa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041fe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  804202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804206:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80420a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80420f:	74 3d                	je     80424e <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  804211:	eb 1d                	jmp    804230 <strlcpy+0x42>
+      *dst++ = *src++;
+  804213:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804217:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80421b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80421f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804223:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804227:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80422b:	0f b6 12             	movzbl (%rdx),%edx
+  80422e:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  804230:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804235:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80423a:	74 0b                	je     804247 <strlcpy+0x59>
+  80423c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804240:	0f b6 00             	movzbl (%rax),%eax
+  804243:	84 c0                	test   %al,%al
+  804245:	75 cc                	jne    804213 <strlcpy+0x25>
+    *dst = '\0';
+  804247:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80424b:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80424e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804252:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804256:	c9                   	leave
+  804257:	c3                   	ret
+
+0000000000804258 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804258:	55                   	push   %rbp
+  804259:	48 89 e5             	mov    %rsp,%rbp
+  80425c:	48 83 ec 30          	sub    $0x30,%rsp
+  804260:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804264:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804268:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80426c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804270:	48 89 c7             	mov    %rax,%rdi
+  804273:	48 b8 fb 3f 80 00 00 	movabs $0x803ffb,%rax
+  80427a:	00 00 00 
+  80427d:	ff d0                	call   *%rax
+  80427f:	48 98                	cltq
+  804281:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  804285:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80428d:	48 89 d6             	mov    %rdx,%rsi
+  804290:	48 89 c7             	mov    %rax,%rdi
+  804293:	48 b8 be 40 80 00 00 	movabs $0x8040be,%rax
+  80429a:	00 00 00 
+  80429d:	ff d0                	call   *%rax
+  80429f:	48 98                	cltq
+  8042a1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8042a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042a9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8042ad:	75 10                	jne    8042bf <strlcat+0x67>
+    return maxlen + srclen;
+  8042af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042b7:	48 01 d0             	add    %rdx,%rax
+  8042ba:	e9 86 00 00 00       	jmp    804345 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8042bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042c3:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8042c7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8042cb:	73 2b                	jae    8042f8 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8042cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042d5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8042d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042dd:	48 01 c1             	add    %rax,%rcx
+  8042e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042e4:	48 89 c6             	mov    %rax,%rsi
+  8042e7:	48 89 cf             	mov    %rcx,%rdi
+  8042ea:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  8042f1:	00 00 00 
+  8042f4:	ff d0                	call   *%rax
+  8042f6:	eb 42                	jmp    80433a <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8042f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042fc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804300:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804304:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804308:	48 01 c1             	add    %rax,%rcx
+  80430b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80430f:	48 89 c6             	mov    %rax,%rsi
+  804312:	48 89 cf             	mov    %rcx,%rdi
+  804315:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  80431c:	00 00 00 
+  80431f:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  804321:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804325:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804329:	48 01 d0             	add    %rdx,%rax
+  80432c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804334:	48 01 d0             	add    %rdx,%rax
+  804337:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80433a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80433e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804342:	48 01 d0             	add    %rdx,%rax
+}
+  804345:	c9                   	leave
+  804346:	c3                   	ret
+
+0000000000804347 <strcmp>:
+strcmp(const char *p, const char *q) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	48 83 ec 10          	sub    $0x10,%rsp
+  80434f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804353:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  804357:	eb 0a                	jmp    804363 <strcmp+0x1c>
+    p++, q++;
+  804359:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80435e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  804363:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804367:	0f b6 00             	movzbl (%rax),%eax
+  80436a:	84 c0                	test   %al,%al
+  80436c:	74 12                	je     804380 <strcmp+0x39>
+  80436e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804372:	0f b6 10             	movzbl (%rax),%edx
+  804375:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804379:	0f b6 00             	movzbl (%rax),%eax
+  80437c:	38 c2                	cmp    %al,%dl
+  80437e:	74 d9                	je     804359 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  804380:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804384:	0f b6 00             	movzbl (%rax),%eax
+  804387:	0f b6 d0             	movzbl %al,%edx
+  80438a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80438e:	0f b6 00             	movzbl (%rax),%eax
+  804391:	0f b6 c0             	movzbl %al,%eax
+  804394:	29 c2                	sub    %eax,%edx
+  804396:	89 d0                	mov    %edx,%eax
+}
+  804398:	c9                   	leave
+  804399:	c3                   	ret
+
+000000000080439a <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80439a:	55                   	push   %rbp
+  80439b:	48 89 e5             	mov    %rsp,%rbp
+  80439e:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8043aa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043ae:	eb 0f                	jmp    8043bf <strncmp+0x25>
+    n--, p++, q++;
+  8043b0:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8043b5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8043ba:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8043bf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043c4:	74 1d                	je     8043e3 <strncmp+0x49>
+  8043c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043ca:	0f b6 00             	movzbl (%rax),%eax
+  8043cd:	84 c0                	test   %al,%al
+  8043cf:	74 12                	je     8043e3 <strncmp+0x49>
+  8043d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d5:	0f b6 10             	movzbl (%rax),%edx
+  8043d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043dc:	0f b6 00             	movzbl (%rax),%eax
+  8043df:	38 c2                	cmp    %al,%dl
+  8043e1:	74 cd                	je     8043b0 <strncmp+0x16>
+  if (n == 0)
+  8043e3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043e8:	75 07                	jne    8043f1 <strncmp+0x57>
+    return 0;
+  8043ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ef:	eb 16                	jmp    804407 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8043f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f5:	0f b6 00             	movzbl (%rax),%eax
+  8043f8:	0f b6 d0             	movzbl %al,%edx
+  8043fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043ff:	0f b6 00             	movzbl (%rax),%eax
+  804402:	0f b6 c0             	movzbl %al,%eax
+  804405:	29 c2                	sub    %eax,%edx
+}
+  804407:	89 d0                	mov    %edx,%eax
+  804409:	c9                   	leave
+  80440a:	c3                   	ret
+
+000000000080440b <strchr>:
+strchr(const char *s, char c) {
+  80440b:	55                   	push   %rbp
+  80440c:	48 89 e5             	mov    %rsp,%rbp
+  80440f:	48 83 ec 60          	sub    $0x60,%rsp
+  804413:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804417:	89 f0                	mov    %esi,%eax
+  804419:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80441c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804420:	83 e0 0f             	and    $0xf,%eax
+  804423:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  804426:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804429:	48 f7 d8             	neg    %rax
+  80442c:	48 89 c2             	mov    %rax,%rdx
+  80442f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804433:	48 01 d0             	add    %rdx,%rax
+  804436:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80443a:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80443e:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804442:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  804446:	66 0f 6e c0          	movd   %eax,%xmm0
+  80444a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80444e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  804452:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  804457:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80445b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80445f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  804463:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  804467:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80446c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  804471:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804475:	89 c2                	mov    %eax,%edx
+  804477:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80447c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  804481:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804485:	09 c2                	or     %eax,%edx
+  804487:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80448a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80448f:	89 c1                	mov    %eax,%ecx
+  804491:	d3 e6                	shl    %cl,%esi
+  804493:	89 f0                	mov    %esi,%eax
+  804495:	21 d0                	and    %edx,%eax
+  804497:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80449a:	eb 34                	jmp    8044d0 <strchr+0xc5>
+    p += 16;
+  80449c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8044a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044a5:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8044a9:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8044ad:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044b2:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8044b7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044bb:	89 c2                	mov    %eax,%edx
+  8044bd:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8044c2:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8044c7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8044cb:	09 d0                	or     %edx,%eax
+  8044cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8044d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044d4:	74 c6                	je     80449c <strchr+0x91>
+  p += __builtin_ctz(m);
+  8044d6:	31 c0                	xor    %eax,%eax
+  8044d8:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8044dd:	48 98                	cltq
+  8044df:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8044e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044e7:	0f b6 00             	movzbl (%rax),%eax
+  8044ea:	84 c0                	test   %al,%al
+  8044ec:	74 06                	je     8044f4 <strchr+0xe9>
+  8044ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044f2:	eb 05                	jmp    8044f9 <strchr+0xee>
+  8044f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044f9:	c9                   	leave
+  8044fa:	c3                   	ret
+
+00000000008044fb <strfind>:
+strfind(const char *s, char c) {
+  8044fb:	55                   	push   %rbp
+  8044fc:	48 89 e5             	mov    %rsp,%rbp
+  8044ff:	48 83 ec 10          	sub    $0x10,%rsp
+  804503:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804507:	89 f0                	mov    %esi,%eax
+  804509:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80450c:	eb 11                	jmp    80451f <strfind+0x24>
+    if (*s == c)
+  80450e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804512:	0f b6 00             	movzbl (%rax),%eax
+  804515:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804518:	74 12                	je     80452c <strfind+0x31>
+  for (; *s; s++)
+  80451a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80451f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804523:	0f b6 00             	movzbl (%rax),%eax
+  804526:	84 c0                	test   %al,%al
+  804528:	75 e4                	jne    80450e <strfind+0x13>
+  80452a:	eb 01                	jmp    80452d <strfind+0x32>
+      break;
+  80452c:	90                   	nop
+  return (char *)s;
+  80452d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804531:	c9                   	leave
+  804532:	c3                   	ret
+
+0000000000804533 <memset>:
+memset(void *v, int c, size_t n) {
+  804533:	55                   	push   %rbp
+  804534:	48 89 e5             	mov    %rsp,%rbp
+  804537:	48 83 ec 38          	sub    $0x38,%rsp
+  80453b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80453f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804542:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  804546:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80454a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80454e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804553:	76 41                	jbe    804596 <memset+0x63>
+  804555:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  80455c:	00 00 00 
+  80455f:	ff d0                	call   *%rax
+  804561:	83 e0 01             	and    $0x1,%eax
+  804564:	85 c0                	test   %eax,%eax
+  804566:	74 2e                	je     804596 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  804568:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80456b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80456f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804573:	48 89 ce             	mov    %rcx,%rsi
+  804576:	48 89 f7             	mov    %rsi,%rdi
+  804579:	48 89 d1             	mov    %rdx,%rcx
+  80457c:	fc                   	cld
+  80457d:	f3 aa                	rep stos %al,%es:(%rdi)
+  80457f:	48 89 ca             	mov    %rcx,%rdx
+  804582:	48 89 fe             	mov    %rdi,%rsi
+  804585:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  804589:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80458d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804591:	e9 a7 00 00 00       	jmp    80463d <memset+0x10a>
+  if (n >= 8) {
+  804596:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80459b:	0f 86 87 00 00 00    	jbe    804628 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8045a1:	eb 16                	jmp    8045b9 <memset+0x86>
+      *p++ = c;
+  8045a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8045ab:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8045af:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045b2:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8045b4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8045b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045bd:	83 e0 07             	and    $0x7,%eax
+  8045c0:	48 85 c0             	test   %rax,%rax
+  8045c3:	75 de                	jne    8045a3 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8045c5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045c8:	0f b6 c0             	movzbl %al,%eax
+  8045cb:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8045d2:	01 01 01 
+  8045d5:	48 0f af c2          	imul   %rdx,%rax
+  8045d9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8045dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045e1:	48 c1 e8 03          	shr    $0x3,%rax
+  8045e5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8045e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045ed:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045f5:	48 89 ce             	mov    %rcx,%rsi
+  8045f8:	48 89 f7             	mov    %rsi,%rdi
+  8045fb:	48 89 d1             	mov    %rdx,%rcx
+  8045fe:	fc                   	cld
+  8045ff:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804602:	48 89 ca             	mov    %rcx,%rdx
+  804605:	48 89 fe             	mov    %rdi,%rsi
+  804608:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80460c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  804610:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  804615:	eb 11                	jmp    804628 <memset+0xf5>
+    *p++ = c;
+  804617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80461b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80461f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804623:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804626:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  804628:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80462c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804630:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804634:	48 85 c0             	test   %rax,%rax
+  804637:	75 de                	jne    804617 <memset+0xe4>
+  return v;
+  804639:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80463d:	c9                   	leave
+  80463e:	c3                   	ret
+
+000000000080463f <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	48 83 ec 38          	sub    $0x38,%rsp
+  804647:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80464b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80464f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  804653:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804657:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  80465b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80465f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  804663:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804667:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80466b:	0f 83 da 00 00 00    	jae    80474b <memmove+0x10c>
+  804671:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804675:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804679:	48 01 d0             	add    %rdx,%rax
+  80467c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804680:	0f 83 c5 00 00 00    	jae    80474b <memmove+0x10c>
+    s += n;
+  804686:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80468a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80468e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804692:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  804696:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80469b:	0f 86 94 00 00 00    	jbe    804735 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8046a1:	eb 1c                	jmp    8046bf <memmove+0x80>
+        *--d = *--s;
+  8046a3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8046a8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8046ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b1:	0f b6 10             	movzbl (%rax),%edx
+  8046b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046b8:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8046ba:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8046bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c3:	83 e0 07             	and    $0x7,%eax
+  8046c6:	48 85 c0             	test   %rax,%rax
+  8046c9:	75 d8                	jne    8046a3 <memmove+0x64>
+      nq = n / 8;
+  8046cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046cf:	48 c1 e8 03          	shr    $0x3,%rax
+  8046d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8046d7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8046dc:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8046e1:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8046e6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8046ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f2:	48 89 cf             	mov    %rcx,%rdi
+  8046f5:	48 89 d6             	mov    %rdx,%rsi
+  8046f8:	48 89 c1             	mov    %rax,%rcx
+  8046fb:	fd                   	std
+  8046fc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8046ff:	fc                   	cld
+  804700:	48 89 c8             	mov    %rcx,%rax
+  804703:	48 89 f2             	mov    %rsi,%rdx
+  804706:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80470a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80470e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  804712:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  804717:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80471c:	eb 17                	jmp    804735 <memmove+0xf6>
+      *--d = *--s;
+  80471e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804723:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  804728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80472c:	0f b6 10             	movzbl (%rax),%edx
+  80472f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804733:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  804735:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804739:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80473d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804741:	48 85 c0             	test   %rax,%rax
+  804744:	75 d8                	jne    80471e <memmove+0xdf>
+  if (s < d && s + n > d) {
+  804746:	e9 f4 00 00 00       	jmp    80483f <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  80474b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  804750:	76 46                	jbe    804798 <memmove+0x159>
+  804752:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  804759:	00 00 00 
+  80475c:	ff d0                	call   *%rax
+  80475e:	83 e0 01             	and    $0x1,%eax
+  804761:	85 c0                	test   %eax,%eax
+  804763:	74 33                	je     804798 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  804765:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804769:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80476d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804771:	48 89 cf             	mov    %rcx,%rdi
+  804774:	48 89 d6             	mov    %rdx,%rsi
+  804777:	48 89 c1             	mov    %rax,%rcx
+  80477a:	fc                   	cld
+  80477b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80477d:	48 89 c8             	mov    %rcx,%rax
+  804780:	48 89 f2             	mov    %rsi,%rdx
+  804783:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804787:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80478b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80478f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804793:	e9 ab 00 00 00       	jmp    804843 <memmove+0x204>
+    if (n >= 8) {
+  804798:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80479d:	0f 86 8b 00 00 00    	jbe    80482e <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  8047a3:	eb 22                	jmp    8047c7 <memmove+0x188>
+        *d++ = *s++;
+  8047a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047a9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047b5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047b9:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8047bd:	0f b6 12             	movzbl (%rdx),%edx
+  8047c0:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8047c2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8047c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047cb:	83 e0 07             	and    $0x7,%eax
+  8047ce:	48 85 c0             	test   %rax,%rax
+  8047d1:	75 d2                	jne    8047a5 <memmove+0x166>
+      nq = n / 8;
+  8047d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047d7:	48 c1 e8 03          	shr    $0x3,%rax
+  8047db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8047df:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8047e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047eb:	48 89 cf             	mov    %rcx,%rdi
+  8047ee:	48 89 d6             	mov    %rdx,%rsi
+  8047f1:	48 89 c1             	mov    %rax,%rcx
+  8047f4:	fc                   	cld
+  8047f5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8047f8:	48 89 c8             	mov    %rcx,%rax
+  8047fb:	48 89 f2             	mov    %rsi,%rdx
+  8047fe:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  804802:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  804806:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80480a:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80480f:	eb 1d                	jmp    80482e <memmove+0x1ef>
+      *d++ = *s++;
+  804811:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804815:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804819:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80481d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804821:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804825:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  804829:	0f b6 12             	movzbl (%rdx),%edx
+  80482c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80482e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804832:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804836:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80483a:	48 85 c0             	test   %rax,%rax
+  80483d:	75 d2                	jne    804811 <memmove+0x1d2>
+  return dst;
+  80483f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  804843:	c9                   	leave
+  804844:	c3                   	ret
+
+0000000000804845 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804845:	55                   	push   %rbp
+  804846:	48 89 e5             	mov    %rsp,%rbp
+  804849:	48 83 ec 18          	sub    $0x18,%rsp
+  80484d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804851:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804855:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  804859:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80485d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804865:	48 89 ce             	mov    %rcx,%rsi
+  804868:	48 89 c7             	mov    %rax,%rdi
+  80486b:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  804872:	00 00 00 
+  804875:	ff d0                	call   *%rax
+}
+  804877:	c9                   	leave
+  804878:	c3                   	ret
+
+0000000000804879 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  804879:	55                   	push   %rbp
+  80487a:	48 89 e5             	mov    %rsp,%rbp
+  80487d:	48 83 ec 40          	sub    $0x40,%rsp
+  804881:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804885:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804889:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80488d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804891:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  804895:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804899:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80489d:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  8048a2:	0f 86 a7 00 00 00    	jbe    80494f <memcmp+0xd6>
+  8048a8:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  8048af:	00 00 00 
+  8048b2:	ff d0                	call   *%rax
+  8048b4:	83 e0 02             	and    $0x2,%eax
+  8048b7:	85 c0                	test   %eax,%eax
+  8048b9:	0f 84 90 00 00 00    	je     80494f <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  8048bf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048c3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8048c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048cb:	48 89 ce             	mov    %rcx,%rsi
+  8048ce:	48 89 c7             	mov    %rax,%rdi
+  8048d1:	48 b8 60 3e 80 00 00 	movabs $0x803e60,%rax
+  8048d8:	00 00 00 
+  8048db:	ff d0                	call   *%rax
+  8048dd:	e9 c2 00 00 00       	jmp    8049a4 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8048e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048e6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048ea:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8048ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8048f6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8048fa:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8048fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  804901:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  804908:	74 36                	je     804940 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  80490a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80490d:	f7 d0                	not    %eax
+  80490f:	f3 0f bc c0          	tzcnt  %eax,%eax
+  804913:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  804916:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804919:	48 63 d0             	movslq %eax,%rdx
+  80491c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804920:	48 01 d0             	add    %rdx,%rax
+  804923:	0f b6 00             	movzbl (%rax),%eax
+  804926:	0f b6 c0             	movzbl %al,%eax
+  804929:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80492c:	48 63 ca             	movslq %edx,%rcx
+  80492f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804933:	48 01 ca             	add    %rcx,%rdx
+  804936:	0f b6 12             	movzbl (%rdx),%edx
+  804939:	0f b6 d2             	movzbl %dl,%edx
+  80493c:	29 d0                	sub    %edx,%eax
+  80493e:	eb 64                	jmp    8049a4 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  804940:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  804945:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  80494a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80494f:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  804954:	77 8c                	ja     8048e2 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  804956:	eb 36                	jmp    80498e <memcmp+0x115>
+    if (*s1 != *s2)
+  804958:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495c:	0f b6 10             	movzbl (%rax),%edx
+  80495f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804963:	0f b6 00             	movzbl (%rax),%eax
+  804966:	38 c2                	cmp    %al,%dl
+  804968:	74 1a                	je     804984 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80496a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80496e:	0f b6 00             	movzbl (%rax),%eax
+  804971:	0f b6 c8             	movzbl %al,%ecx
+  804974:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804978:	0f b6 00             	movzbl (%rax),%eax
+  80497b:	0f b6 d0             	movzbl %al,%edx
+  80497e:	89 c8                	mov    %ecx,%eax
+  804980:	29 d0                	sub    %edx,%eax
+  804982:	eb 20                	jmp    8049a4 <memcmp+0x12b>
+    s1++, s2++;
+  804984:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804989:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80498e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804992:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804996:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80499a:	48 85 c0             	test   %rax,%rax
+  80499d:	75 b9                	jne    804958 <memcmp+0xdf>
+  }
+
+  return 0;
+  80499f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049a4:	c9                   	leave
+  8049a5:	c3                   	ret
+
+00000000008049a6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8049a6:	55                   	push   %rbp
+  8049a7:	48 89 e5             	mov    %rsp,%rbp
+  8049aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8049ae:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8049b2:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8049b5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8049b9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049bd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049c1:	48 01 d0             	add    %rdx,%rax
+  8049c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8049c8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049cb:	66 0f 6e c0          	movd   %eax,%xmm0
+  8049cf:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8049d3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8049d7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8049dc:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8049e0:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8049e5:	76 73                	jbe    804a5a <memfind+0xb4>
+  8049e7:	48 b8 98 3c 80 00 00 	movabs $0x803c98,%rax
+  8049ee:	00 00 00 
+  8049f1:	ff d0                	call   *%rax
+  8049f3:	83 e0 02             	and    $0x2,%eax
+  8049f6:	85 c0                	test   %eax,%eax
+  8049f8:	74 60                	je     804a5a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8049fa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049fd:	0f b6 c8             	movzbl %al,%ecx
+  804a00:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a08:	89 ce                	mov    %ecx,%esi
+  804a0a:	48 89 c7             	mov    %rax,%rdi
+  804a0d:	48 b8 4f 3f 80 00 00 	movabs $0x803f4f,%rax
+  804a14:	00 00 00 
+  804a17:	ff d0                	call   *%rax
+  804a19:	eb 6c                	jmp    804a87 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  804a1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  804a23:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  804a27:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  804a2c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  804a30:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  804a34:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a37:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a3b:	74 13                	je     804a50 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  804a3d:	31 c0                	xor    %eax,%eax
+  804a3f:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  804a44:	48 63 d0             	movslq %eax,%rdx
+  804a47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4b:	48 01 d0             	add    %rdx,%rax
+  804a4e:	eb 37                	jmp    804a87 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  804a50:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  804a55:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  804a5a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  804a5f:	77 ba                	ja     804a1b <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  804a61:	eb 13                	jmp    804a76 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  804a63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a67:	0f b6 00             	movzbl (%rax),%eax
+  804a6a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a6d:	38 d0                	cmp    %dl,%al
+  804a6f:	74 11                	je     804a82 <memfind+0xdc>
+  for (; s < ends; s++)
+  804a71:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  804a76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a7a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804a7e:	72 e3                	jb     804a63 <memfind+0xbd>
+  804a80:	eb 01                	jmp    804a83 <memfind+0xdd>
+      break;
+  804a82:	90                   	nop
+  return (void *)s;
+  804a83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804a87:	c9                   	leave
+  804a88:	c3                   	ret
+
+0000000000804a89 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804a89:	55                   	push   %rbp
+  804a8a:	48 89 e5             	mov    %rsp,%rbp
+  804a8d:	48 83 ec 38          	sub    $0x38,%rsp
+  804a91:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a95:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a99:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  804a9c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  804aa3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804aaa:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  804aab:	eb 05                	jmp    804ab2 <strtol+0x29>
+    s++;
+  804aad:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  804ab2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ab6:	0f b6 00             	movzbl (%rax),%eax
+  804ab9:	3c 20                	cmp    $0x20,%al
+  804abb:	74 f0                	je     804aad <strtol+0x24>
+  804abd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac1:	0f b6 00             	movzbl (%rax),%eax
+  804ac4:	3c 09                	cmp    $0x9,%al
+  804ac6:	74 e5                	je     804aad <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  804ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acc:	0f b6 00             	movzbl (%rax),%eax
+  804acf:	3c 2b                	cmp    $0x2b,%al
+  804ad1:	75 07                	jne    804ada <strtol+0x51>
+    s++;
+  804ad3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804ad8:	eb 17                	jmp    804af1 <strtol+0x68>
+  else if (*s == '-')
+  804ada:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ade:	0f b6 00             	movzbl (%rax),%eax
+  804ae1:	3c 2d                	cmp    $0x2d,%al
+  804ae3:	75 0c                	jne    804af1 <strtol+0x68>
+    s++, neg = 1;
+  804ae5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804aea:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  804af1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804af5:	74 06                	je     804afd <strtol+0x74>
+  804af7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  804afb:	75 28                	jne    804b25 <strtol+0x9c>
+  804afd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b01:	0f b6 00             	movzbl (%rax),%eax
+  804b04:	3c 30                	cmp    $0x30,%al
+  804b06:	75 1d                	jne    804b25 <strtol+0x9c>
+  804b08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0c:	48 83 c0 01          	add    $0x1,%rax
+  804b10:	0f b6 00             	movzbl (%rax),%eax
+  804b13:	3c 78                	cmp    $0x78,%al
+  804b15:	75 0e                	jne    804b25 <strtol+0x9c>
+    s += 2, base = 16;
+  804b17:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  804b1c:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  804b23:	eb 2c                	jmp    804b51 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  804b25:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b29:	75 19                	jne    804b44 <strtol+0xbb>
+  804b2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b2f:	0f b6 00             	movzbl (%rax),%eax
+  804b32:	3c 30                	cmp    $0x30,%al
+  804b34:	75 0e                	jne    804b44 <strtol+0xbb>
+    s++, base = 8;
+  804b36:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804b3b:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  804b42:	eb 0d                	jmp    804b51 <strtol+0xc8>
+  else if (base == 0)
+  804b44:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b48:	75 07                	jne    804b51 <strtol+0xc8>
+    base = 10;
+  804b4a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  804b51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b55:	0f b6 00             	movzbl (%rax),%eax
+  804b58:	3c 2f                	cmp    $0x2f,%al
+  804b5a:	7e 1d                	jle    804b79 <strtol+0xf0>
+  804b5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b60:	0f b6 00             	movzbl (%rax),%eax
+  804b63:	3c 39                	cmp    $0x39,%al
+  804b65:	7f 12                	jg     804b79 <strtol+0xf0>
+      dig = *s - '0';
+  804b67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6b:	0f b6 00             	movzbl (%rax),%eax
+  804b6e:	0f be c0             	movsbl %al,%eax
+  804b71:	83 e8 30             	sub    $0x30,%eax
+  804b74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b77:	eb 4e                	jmp    804bc7 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  804b79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b7d:	0f b6 00             	movzbl (%rax),%eax
+  804b80:	3c 60                	cmp    $0x60,%al
+  804b82:	7e 1d                	jle    804ba1 <strtol+0x118>
+  804b84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b88:	0f b6 00             	movzbl (%rax),%eax
+  804b8b:	3c 7a                	cmp    $0x7a,%al
+  804b8d:	7f 12                	jg     804ba1 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  804b8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b93:	0f b6 00             	movzbl (%rax),%eax
+  804b96:	0f be c0             	movsbl %al,%eax
+  804b99:	83 e8 57             	sub    $0x57,%eax
+  804b9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b9f:	eb 26                	jmp    804bc7 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  804ba1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba5:	0f b6 00             	movzbl (%rax),%eax
+  804ba8:	3c 40                	cmp    $0x40,%al
+  804baa:	7e 47                	jle    804bf3 <strtol+0x16a>
+  804bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb0:	0f b6 00             	movzbl (%rax),%eax
+  804bb3:	3c 5a                	cmp    $0x5a,%al
+  804bb5:	7f 3c                	jg     804bf3 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  804bb7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bbb:	0f b6 00             	movzbl (%rax),%eax
+  804bbe:	0f be c0             	movsbl %al,%eax
+  804bc1:	83 e8 37             	sub    $0x37,%eax
+  804bc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  804bc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bca:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  804bcd:	7d 23                	jge    804bf2 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  804bcf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  804bd4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804bd7:	48 98                	cltq
+  804bd9:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  804bde:	48 89 c2             	mov    %rax,%rdx
+  804be1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be4:	48 98                	cltq
+  804be6:	48 01 d0             	add    %rdx,%rax
+  804be9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  804bed:	e9 5f ff ff ff       	jmp    804b51 <strtol+0xc8>
+      break;
+  804bf2:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  804bf3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  804bf8:	74 0b                	je     804c05 <strtol+0x17c>
+    *endptr = (char *)s;
+  804bfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bfe:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804c02:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  804c05:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c09:	74 09                	je     804c14 <strtol+0x18b>
+  804c0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c0f:	48 f7 d8             	neg    %rax
+  804c12:	eb 04                	jmp    804c18 <strtol+0x18f>
+  804c14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804c18:	c9                   	leave
+  804c19:	c3                   	ret
+
+0000000000804c1a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804c1a:	55                   	push   %rbp
+  804c1b:	48 89 e5             	mov    %rsp,%rbp
+  804c1e:	48 83 ec 20          	sub    $0x20,%rsp
+  804c22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c26:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c2a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804c2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c32:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3a:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804c41:	48 89 c7             	mov    %rax,%rdi
+  804c44:	48 b8 52 4c 80 00 00 	movabs $0x804c52,%rax
+  804c4b:	00 00 00 
+  804c4e:	ff d0                	call   *%rax
+}
+  804c50:	c9                   	leave
+  804c51:	c3                   	ret
+
+0000000000804c52 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804c52:	55                   	push   %rbp
+  804c53:	48 89 e5             	mov    %rsp,%rbp
+  804c56:	48 83 ec 30          	sub    $0x30,%rsp
+  804c5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804c5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c62:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804c66:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804c6a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804c6f:	75 0e                	jne    804c7f <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804c71:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c78:	00 00 00 
+  804c7b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804c7f:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804c84:	75 18                	jne    804c9e <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804c86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c8a:	48 89 c7             	mov    %rax,%rdi
+  804c8d:	48 b8 dd 05 80 00 00 	movabs $0x8005dd,%rax
+  804c94:	00 00 00 
+  804c97:	ff d0                	call   *%rax
+  804c99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c9c:	eb 1d                	jmp    804cbb <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804c9e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ca2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca6:	48 89 d6             	mov    %rdx,%rsi
+  804ca9:	48 89 c7             	mov    %rax,%rdi
+  804cac:	48 b8 23 06 80 00 00 	movabs $0x800623,%rax
+  804cb3:	00 00 00 
+  804cb6:	ff d0                	call   *%rax
+  804cb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804cbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cbf:	79 2a                	jns    804ceb <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804cc1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cc6:	74 0a                	je     804cd2 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804cc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ccc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804cd2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804cd7:	74 0a                	je     804ce3 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804cd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cdd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804ce3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ce6:	e9 aa 00 00 00       	jmp    804d95 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804ceb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804cf0:	74 36                	je     804d28 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804cf2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804cf9:	00 00 00 
+  804cfc:	8b 40 04             	mov    0x4(%rax),%eax
+  804cff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d04:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d0b:	00 00 00 
+  804d0e:	48 98                	cltq
+  804d10:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d17:	48 01 d0             	add    %rdx,%rax
+  804d1a:	48 05 24 01 00 00    	add    $0x124,%rax
+  804d20:	8b 10                	mov    (%rax),%edx
+  804d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d26:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804d28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804d2d:	74 36                	je     804d65 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804d2f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d36:	00 00 00 
+  804d39:	8b 40 04             	mov    0x4(%rax),%eax
+  804d3c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d41:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d48:	00 00 00 
+  804d4b:	48 98                	cltq
+  804d4d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d54:	48 01 d0             	add    %rdx,%rax
+  804d57:	48 05 28 01 00 00    	add    $0x128,%rax
+  804d5d:	8b 10                	mov    (%rax),%edx
+  804d5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d63:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804d65:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d6c:	00 00 00 
+  804d6f:	8b 40 04             	mov    0x4(%rax),%eax
+  804d72:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d77:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d7e:	00 00 00 
+  804d81:	48 98                	cltq
+  804d83:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d8a:	48 01 d0             	add    %rdx,%rax
+  804d8d:	48 05 20 01 00 00    	add    $0x120,%rax
+  804d93:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804d95:	c9                   	leave
+  804d96:	c3                   	ret
+
+0000000000804d97 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804d97:	55                   	push   %rbp
+  804d98:	48 89 e5             	mov    %rsp,%rbp
+  804d9b:	48 83 ec 30          	sub    $0x30,%rsp
+  804d9f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804da2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804da5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804da9:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dac:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804db1:	75 5e                	jne    804e11 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804db3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dba:	00 00 00 
+  804dbd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804dc1:	eb 4e                	jmp    804e11 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804dc3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dc7:	79 3c                	jns    804e05 <ipc_send+0x6e>
+  804dc9:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804dcd:	74 36                	je     804e05 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804dcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dd2:	89 c1                	mov    %eax,%ecx
+  804dd4:	48 b8 08 56 80 00 00 	movabs $0x805608,%rax
+  804ddb:	00 00 00 
+  804dde:	48 89 c2             	mov    %rax,%rdx
+  804de1:	be 54 00 00 00       	mov    $0x54,%esi
+  804de6:	48 b8 2e 56 80 00 00 	movabs $0x80562e,%rax
+  804ded:	00 00 00 
+  804df0:	48 89 c7             	mov    %rax,%rdi
+  804df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df8:	49 b8 2d 2f 80 00 00 	movabs $0x802f2d,%r8
+  804dff:	00 00 00 
+  804e02:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804e05:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  804e0c:	00 00 00 
+  804e0f:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804e11:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804e14:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804e17:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e1e:	89 c7                	mov    %eax,%edi
+  804e20:	48 b8 86 05 80 00 00 	movabs $0x800586,%rax
+  804e27:	00 00 00 
+  804e2a:	ff d0                	call   *%rax
+  804e2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e33:	75 8e                	jne    804dc3 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804e35:	48 b8 60 03 80 00 00 	movabs $0x800360,%rax
+  804e3c:	00 00 00 
+  804e3f:	ff d0                	call   *%rax
+}
+  804e41:	90                   	nop
+  804e42:	c9                   	leave
+  804e43:	c3                   	ret
+
+0000000000804e44 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804e44:	55                   	push   %rbp
+  804e45:	48 89 e5             	mov    %rsp,%rbp
+  804e48:	48 83 ec 18          	sub    $0x18,%rsp
+  804e4c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804e4f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804e56:	eb 4d                	jmp    804ea5 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804e58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e5f:	00 00 00 
+  804e62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e65:	48 98                	cltq
+  804e67:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e6e:	48 01 d0             	add    %rdx,%rax
+  804e71:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804e77:	8b 00                	mov    (%rax),%eax
+  804e79:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804e7c:	75 23                	jne    804ea1 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804e7e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e85:	00 00 00 
+  804e88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e8b:	48 98                	cltq
+  804e8d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e94:	48 01 d0             	add    %rdx,%rax
+  804e97:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804e9d:	8b 00                	mov    (%rax),%eax
+  804e9f:	eb 12                	jmp    804eb3 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804ea1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ea5:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804eac:	7e aa                	jle    804e58 <ipc_find_env+0x14>
+  return 0;
+  804eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eb3:	c9                   	leave
+  804eb4:	c3                   	ret
+
+0000000000804eb5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804eb5:	55                   	push   %rbp
+  804eb6:	48 89 e5             	mov    %rsp,%rbp
+  804eb9:	48 83 ec 18          	sub    $0x18,%rsp
+  804ebd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804ec1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec5:	48 c1 e8 27          	shr    $0x27,%rax
+  804ec9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804ece:	48 89 c2             	mov    %rax,%rdx
+  804ed1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804ed8:	01 00 00 
+  804edb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804edf:	83 e0 01             	and    $0x1,%eax
+  804ee2:	48 85 c0             	test   %rax,%rax
+  804ee5:	74 63                	je     804f4a <pageref+0x95>
+  804ee7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eeb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804eef:	48 89 c2             	mov    %rax,%rdx
+  804ef2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804ef9:	01 00 00 
+  804efc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f00:	83 e0 01             	and    $0x1,%eax
+  804f03:	48 85 c0             	test   %rax,%rax
+  804f06:	74 42                	je     804f4a <pageref+0x95>
+  804f08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0c:	48 c1 e8 15          	shr    $0x15,%rax
+  804f10:	48 89 c2             	mov    %rax,%rdx
+  804f13:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804f1a:	01 00 00 
+  804f1d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f21:	83 e0 01             	and    $0x1,%eax
+  804f24:	48 85 c0             	test   %rax,%rax
+  804f27:	74 21                	je     804f4a <pageref+0x95>
+  804f29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f31:	48 89 c2             	mov    %rax,%rdx
+  804f34:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f3b:	01 00 00 
+  804f3e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f42:	83 e0 01             	and    $0x1,%eax
+  804f45:	48 85 c0             	test   %rax,%rax
+  804f48:	75 07                	jne    804f51 <pageref+0x9c>
+    return 0;
+  804f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f4f:	eb 53                	jmp    804fa4 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804f51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f55:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f59:	48 89 c2             	mov    %rax,%rdx
+  804f5c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804f63:	01 00 00 
+  804f66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f72:	83 e0 01             	and    $0x1,%eax
+  804f75:	48 85 c0             	test   %rax,%rax
+  804f78:	75 07                	jne    804f81 <pageref+0xcc>
+    return 0;
+  804f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7f:	eb 23                	jmp    804fa4 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804f81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f85:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f89:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804f90:	00 00 00 
+  804f93:	48 c1 e0 04          	shl    $0x4,%rax
+  804f97:	48 01 d0             	add    %rdx,%rax
+  804f9a:	48 83 c0 08          	add    $0x8,%rax
+  804f9e:	0f b7 00             	movzwl (%rax),%eax
+  804fa1:	0f b7 c0             	movzwl %ax,%eax
+}
+  804fa4:	c9                   	leave
+  804fa5:	c3                   	ret
+  804fa6:	66 90                	xchg   %ax,%ax
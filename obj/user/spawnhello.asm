@@ -0,0 +1,9195 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 d7 00 00 00       	call   800103 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+  cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800041:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800048:	00 00 00 
+  80004b:	8b 40 04             	mov    0x4(%rax),%eax
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80005a:	00 00 00 
+  80005d:	48 98                	cltq
+  80005f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800066:	48 01 d0             	add    %rdx,%rax
+  800069:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80006f:	8b 00                	mov    (%rax),%eax
+  800071:	89 c6                	mov    %eax,%esi
+  800073:	48 b8 a0 5d 80 00 00 	movabs $0x805da0,%rax
+  80007a:	00 00 00 
+  80007d:	48 89 c7             	mov    %rax,%rdi
+  800080:	b8 00 00 00 00       	mov    $0x0,%eax
+  800085:	48 ba c9 03 80 00 00 	movabs $0x8003c9,%rdx
+  80008c:	00 00 00 
+  80008f:	ff d2                	call   *%rdx
+  if ((r = spawnl("hello", "hello", 0)) < 0)
+  800091:	ba 00 00 00 00       	mov    $0x0,%edx
+  800096:	48 b8 be 5d 80 00 00 	movabs $0x805dbe,%rax
+  80009d:	00 00 00 
+  8000a0:	48 89 c6             	mov    %rax,%rsi
+  8000a3:	48 b8 be 5d 80 00 00 	movabs $0x805dbe,%rax
+  8000aa:	00 00 00 
+  8000ad:	48 89 c7             	mov    %rax,%rdi
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	48 b9 db 41 80 00 00 	movabs $0x8041db,%rcx
+  8000bc:	00 00 00 
+  8000bf:	ff d1                	call   *%rcx
+  8000c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000c8:	79 36                	jns    800100 <umain+0xce>
+    panic("spawn(hello) failed: %i", r);
+  8000ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000cd:	89 c1                	mov    %eax,%ecx
+  8000cf:	48 b8 c4 5d 80 00 00 	movabs $0x805dc4,%rax
+  8000d6:	00 00 00 
+  8000d9:	48 89 c2             	mov    %rax,%rdx
+  8000dc:	be 08 00 00 00       	mov    $0x8,%esi
+  8000e1:	48 b8 dc 5d 80 00 00 	movabs $0x805ddc,%rax
+  8000e8:	00 00 00 
+  8000eb:	48 89 c7             	mov    %rax,%rdi
+  8000ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f3:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  8000fa:	00 00 00 
+  8000fd:	41 ff d0             	call   *%r8
+}
+  800100:	90                   	nop
+  800101:	c9                   	leave
+  800102:	c3                   	ret
+
+0000000000800103 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800103:	55                   	push   %rbp
+  800104:	48 89 e5             	mov    %rsp,%rbp
+  800107:	48 83 ec 20          	sub    $0x20,%rsp
+  80010b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80010e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800112:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800119:	00 00 00 
+  80011c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800120:	eb 13                	jmp    800135 <libmain+0x32>
+    (*ctor)();
+  800122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800126:	48 8b 10             	mov    (%rax),%rdx
+  800129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012e:	ff d2                	call   *%rdx
+    ctor++;
+  800130:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800135:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80013c:	00 00 00 
+  80013f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800143:	72 dd                	jb     800122 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800145:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800149:	7e 14                	jle    80015f <libmain+0x5c>
+    binaryname = argv[0];
+  80014b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80014f:	48 8b 00             	mov    (%rax),%rax
+  800152:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800159:	00 00 00 
+  80015c:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80015f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800166:	48 89 d6             	mov    %rdx,%rsi
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800177:	48 b8 86 01 80 00 00 	movabs $0x800186,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+#endif
+}
+  800183:	90                   	nop
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+0000000000800186 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800186:	55                   	push   %rbp
+  800187:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80018a:	48 b8 1e 2c 80 00 00 	movabs $0x802c1e,%rax
+  800191:	00 00 00 
+  800194:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800196:	bf 00 00 00 00       	mov    $0x0,%edi
+  80019b:	48 b8 ff 1f 80 00 00 	movabs $0x801fff,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+}
+  8001a7:	90                   	nop
+  8001a8:	5d                   	pop    %rbp
+  8001a9:	c3                   	ret
+
+00000000008001aa <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001aa:	55                   	push   %rbp
+  8001ab:	48 89 e5             	mov    %rsp,%rbp
+  8001ae:	53                   	push   %rbx
+  8001af:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8001b6:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8001bd:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8001c3:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8001ca:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8001d1:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8001d8:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8001df:	84 c0                	test   %al,%al
+  8001e1:	74 23                	je     800206 <_panic+0x5c>
+  8001e3:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8001ea:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8001ee:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8001f2:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8001f6:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8001fa:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8001fe:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800202:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800206:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80020d:	00 00 00 
+  800210:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800217:	00 00 00 
+  80021a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80021e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800225:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80022c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800233:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80023a:	00 00 00 
+  80023d:	48 8b 18             	mov    (%rax),%rbx
+  800240:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+  80024c:	89 c6                	mov    %eax,%esi
+  80024e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800254:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80025b:	41 89 d0             	mov    %edx,%r8d
+  80025e:	48 89 c1             	mov    %rax,%rcx
+  800261:	48 89 da             	mov    %rbx,%rdx
+  800264:	48 b8 f8 5d 80 00 00 	movabs $0x805df8,%rax
+  80026b:	00 00 00 
+  80026e:	48 89 c7             	mov    %rax,%rdi
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+  800276:	49 b9 c9 03 80 00 00 	movabs $0x8003c9,%r9
+  80027d:	00 00 00 
+  800280:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800283:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80028a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800291:	48 89 d6             	mov    %rdx,%rsi
+  800294:	48 89 c7             	mov    %rax,%rdi
+  800297:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+  cprintf("\n");
+  8002a3:	48 b8 1b 5e 80 00 00 	movabs $0x805e1b,%rax
+  8002aa:	00 00 00 
+  8002ad:	48 89 c7             	mov    %rax,%rdi
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 ba c9 03 80 00 00 	movabs $0x8003c9,%rdx
+  8002bc:	00 00 00 
+  8002bf:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8002c1:	cc                   	int3
+  8002c2:	eb fd                	jmp    8002c1 <_panic+0x117>
+
+00000000008002c4 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8002c4:	55                   	push   %rbp
+  8002c5:	48 89 e5             	mov    %rsp,%rbp
+  8002c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8002cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8002cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8002d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002d7:	8b 00                	mov    (%rax),%eax
+  8002d9:	8d 48 01             	lea    0x1(%rax),%ecx
+  8002dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002e0:	89 0a                	mov    %ecx,(%rdx)
+  8002e2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8002e5:	89 d1                	mov    %edx,%ecx
+  8002e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8002eb:	48 98                	cltq
+  8002ed:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8002f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002f5:	8b 00                	mov    (%rax),%eax
+  8002f7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fc:	75 2c                	jne    80032a <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8002fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800302:	8b 00                	mov    (%rax),%eax
+  800304:	48 98                	cltq
+  800306:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80030a:	48 83 c2 08          	add    $0x8,%rdx
+  80030e:	48 89 c6             	mov    %rax,%rsi
+  800311:	48 89 d7             	mov    %rdx,%rdi
+  800314:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  80031b:	00 00 00 
+  80031e:	ff d0                	call   *%rax
+    b->idx = 0;
+  800320:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800324:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80032a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80032e:	8b 40 04             	mov    0x4(%rax),%eax
+  800331:	8d 50 01             	lea    0x1(%rax),%edx
+  800334:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800338:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80033b:	90                   	nop
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+000000000080033e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80033e:	55                   	push   %rbp
+  80033f:	48 89 e5             	mov    %rsp,%rbp
+  800342:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800349:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800350:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800357:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80035e:	00 00 00 
+  b.cnt = 0;
+  800361:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800368:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80036b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800372:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800379:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800380:	48 89 c6             	mov    %rax,%rsi
+  800383:	48 b8 c4 02 80 00 00 	movabs $0x8002c4,%rax
+  80038a:	00 00 00 
+  80038d:	48 89 c7             	mov    %rax,%rdi
+  800390:	48 b8 23 07 80 00 00 	movabs $0x800723,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80039c:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8003a2:	48 98                	cltq
+  8003a4:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8003ab:	48 83 c2 08          	add    $0x8,%rdx
+  8003af:	48 89 c6             	mov    %rax,%rsi
+  8003b2:	48 89 d7             	mov    %rdx,%rdi
+  8003b5:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  8003bc:	00 00 00 
+  8003bf:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8003c1:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8003c7:	c9                   	leave
+  8003c8:	c3                   	ret
+
+00000000008003c9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003c9:	55                   	push   %rbp
+  8003ca:	48 89 e5             	mov    %rsp,%rbp
+  8003cd:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8003d4:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8003db:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003e2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003e9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8003f0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003f7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003fe:	84 c0                	test   %al,%al
+  800400:	74 20                	je     800422 <cprintf+0x59>
+  800402:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800406:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80040a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80040e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800412:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800416:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80041a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80041e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800422:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800429:	00 00 00 
+  80042c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800433:	00 00 00 
+  800436:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800441:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800448:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80044f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800456:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80045d:	48 89 d6             	mov    %rdx,%rsi
+  800460:	48 89 c7             	mov    %rax,%rdi
+  800463:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  80046a:	00 00 00 
+  80046d:	ff d0                	call   *%rax
+  80046f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800475:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80047b:	c9                   	leave
+  80047c:	c3                   	ret
+
+000000000080047d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80047d:	55                   	push   %rbp
+  80047e:	48 89 e5             	mov    %rsp,%rbp
+  800481:	48 83 ec 30          	sub    $0x30,%rsp
+  800485:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800489:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80048d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800491:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800494:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800498:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80049c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80049f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8004a3:	72 54                	jb     8004f9 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004a5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004a8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8004ab:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8004ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b7:	48 f7 f6             	div    %rsi
+  8004ba:	49 89 c2             	mov    %rax,%r10
+  8004bd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8004c0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8004c3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8004c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004cb:	41 89 c9             	mov    %ecx,%r9d
+  8004ce:	41 89 f8             	mov    %edi,%r8d
+  8004d1:	89 d1                	mov    %edx,%ecx
+  8004d3:	4c 89 d2             	mov    %r10,%rdx
+  8004d6:	48 89 c7             	mov    %rax,%rdi
+  8004d9:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  8004e0:	00 00 00 
+  8004e3:	ff d0                	call   *%rax
+  8004e5:	eb 1c                	jmp    800503 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8004e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004ee:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8004f2:	48 89 d6             	mov    %rdx,%rsi
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8004f9:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8004fd:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800501:	7f e4                	jg     8004e7 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800503:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800506:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80050a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050f:	48 f7 f1             	div    %rcx
+  800512:	48 b8 50 60 80 00 00 	movabs $0x806050,%rax
+  800519:	00 00 00 
+  80051c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800520:	0f be c0             	movsbl %al,%eax
+  800523:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800527:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80052b:	48 89 d6             	mov    %rdx,%rsi
+  80052e:	89 c7                	mov    %eax,%edi
+  800530:	ff d1                	call   *%rcx
+}
+  800532:	90                   	nop
+  800533:	c9                   	leave
+  800534:	c3                   	ret
+
+0000000000800535 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	48 83 ec 10          	sub    $0x10,%rsp
+  80053d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800541:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800544:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800548:	7e 4b                	jle    800595 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80054a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054e:	8b 00                	mov    (%rax),%eax
+  800550:	83 f8 2f             	cmp    $0x2f,%eax
+  800553:	77 24                	ja     800579 <getuint+0x44>
+  800555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800559:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80055d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800561:	8b 00                	mov    (%rax),%eax
+  800563:	89 c0                	mov    %eax,%eax
+  800565:	48 01 d0             	add    %rdx,%rax
+  800568:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80056c:	8b 12                	mov    (%rdx),%edx
+  80056e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800571:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800575:	89 0a                	mov    %ecx,(%rdx)
+  800577:	eb 14                	jmp    80058d <getuint+0x58>
+  800579:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80057d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800581:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800585:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800589:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80058d:	48 8b 00             	mov    (%rax),%rax
+  800590:	e9 95 00 00 00       	jmp    80062a <getuint+0xf5>
+  else if (lflag)
+  800595:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800599:	74 48                	je     8005e3 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80059b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80059f:	8b 00                	mov    (%rax),%eax
+  8005a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8005a4:	77 24                	ja     8005ca <getuint+0x95>
+  8005a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b2:	8b 00                	mov    (%rax),%eax
+  8005b4:	89 c0                	mov    %eax,%eax
+  8005b6:	48 01 d0             	add    %rdx,%rax
+  8005b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005bd:	8b 12                	mov    (%rdx),%edx
+  8005bf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c6:	89 0a                	mov    %ecx,(%rdx)
+  8005c8:	eb 14                	jmp    8005de <getuint+0xa9>
+  8005ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005d2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005da:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005de:	48 8b 00             	mov    (%rax),%rax
+  8005e1:	eb 47                	jmp    80062a <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8005e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e7:	8b 00                	mov    (%rax),%eax
+  8005e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ec:	77 24                	ja     800612 <getuint+0xdd>
+  8005ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fa:	8b 00                	mov    (%rax),%eax
+  8005fc:	89 c0                	mov    %eax,%eax
+  8005fe:	48 01 d0             	add    %rdx,%rax
+  800601:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800605:	8b 12                	mov    (%rdx),%edx
+  800607:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80060a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80060e:	89 0a                	mov    %ecx,(%rdx)
+  800610:	eb 14                	jmp    800626 <getuint+0xf1>
+  800612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800616:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80061a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80061e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800622:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800626:	8b 00                	mov    (%rax),%eax
+  800628:	89 c0                	mov    %eax,%eax
+}
+  80062a:	c9                   	leave
+  80062b:	c3                   	ret
+
+000000000080062c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80062c:	55                   	push   %rbp
+  80062d:	48 89 e5             	mov    %rsp,%rbp
+  800630:	48 83 ec 10          	sub    $0x10,%rsp
+  800634:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800638:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80063b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80063f:	7e 4b                	jle    80068c <getint+0x60>
+    return va_arg(*ap, long long);
+  800641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800645:	8b 00                	mov    (%rax),%eax
+  800647:	83 f8 2f             	cmp    $0x2f,%eax
+  80064a:	77 24                	ja     800670 <getint+0x44>
+  80064c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800650:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800658:	8b 00                	mov    (%rax),%eax
+  80065a:	89 c0                	mov    %eax,%eax
+  80065c:	48 01 d0             	add    %rdx,%rax
+  80065f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800663:	8b 12                	mov    (%rdx),%edx
+  800665:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800668:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80066c:	89 0a                	mov    %ecx,(%rdx)
+  80066e:	eb 14                	jmp    800684 <getint+0x58>
+  800670:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800674:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800678:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80067c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800680:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800684:	48 8b 00             	mov    (%rax),%rax
+  800687:	e9 95 00 00 00       	jmp    800721 <getint+0xf5>
+  else if (lflag)
+  80068c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800690:	74 48                	je     8006da <getint+0xae>
+    return va_arg(*ap, long);
+  800692:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800696:	8b 00                	mov    (%rax),%eax
+  800698:	83 f8 2f             	cmp    $0x2f,%eax
+  80069b:	77 24                	ja     8006c1 <getint+0x95>
+  80069d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a9:	8b 00                	mov    (%rax),%eax
+  8006ab:	89 c0                	mov    %eax,%eax
+  8006ad:	48 01 d0             	add    %rdx,%rax
+  8006b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006b4:	8b 12                	mov    (%rdx),%edx
+  8006b6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006bd:	89 0a                	mov    %ecx,(%rdx)
+  8006bf:	eb 14                	jmp    8006d5 <getint+0xa9>
+  8006c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006c9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006d1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006d5:	48 8b 00             	mov    (%rax),%rax
+  8006d8:	eb 47                	jmp    800721 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8006da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006de:	8b 00                	mov    (%rax),%eax
+  8006e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e3:	77 24                	ja     800709 <getint+0xdd>
+  8006e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006e9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f1:	8b 00                	mov    (%rax),%eax
+  8006f3:	89 c0                	mov    %eax,%eax
+  8006f5:	48 01 d0             	add    %rdx,%rax
+  8006f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006fc:	8b 12                	mov    (%rdx),%edx
+  8006fe:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800701:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800705:	89 0a                	mov    %ecx,(%rdx)
+  800707:	eb 14                	jmp    80071d <getint+0xf1>
+  800709:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80070d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800711:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800715:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800719:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80071d:	8b 00                	mov    (%rax),%eax
+  80071f:	48 98                	cltq
+}
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+
+0000000000800723 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800723:	55                   	push   %rbp
+  800724:	48 89 e5             	mov    %rsp,%rbp
+  800727:	41 54                	push   %r12
+  800729:	53                   	push   %rbx
+  80072a:	48 83 ec 60          	sub    $0x60,%rsp
+  80072e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800732:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800736:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80073a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80073e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800742:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800746:	48 8b 06             	mov    (%rsi),%rax
+  800749:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80074d:	48 89 01             	mov    %rax,(%rcx)
+  800750:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800754:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800758:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80075c:	eb 17                	jmp    800775 <vprintfmt+0x52>
+      if (ch == '\0')
+  80075e:	85 db                	test   %ebx,%ebx
+  800760:	0f 84 bf 04 00 00    	je     800c25 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800766:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80076a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80076e:	48 89 c6             	mov    %rax,%rsi
+  800771:	89 df                	mov    %ebx,%edi
+  800773:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800775:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800779:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80077d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800781:	0f b6 00             	movzbl (%rax),%eax
+  800784:	0f b6 d8             	movzbl %al,%ebx
+  800787:	83 fb 25             	cmp    $0x25,%ebx
+  80078a:	75 d2                	jne    80075e <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80078c:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800790:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800797:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80079e:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8007a5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8007ac:	eb 04                	jmp    8007b2 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8007ae:	90                   	nop
+  8007af:	eb 01                	jmp    8007b2 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8007b1:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8007b2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007ba:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007be:	0f b6 00             	movzbl (%rax),%eax
+  8007c1:	0f b6 d8             	movzbl %al,%ebx
+  8007c4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8007c7:	83 f8 55             	cmp    $0x55,%eax
+  8007ca:	0f 87 22 04 00 00    	ja     800bf2 <vprintfmt+0x4cf>
+  8007d0:	89 c0                	mov    %eax,%eax
+  8007d2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8007d9:	00 
+  8007da:	48 b8 78 60 80 00 00 	movabs $0x806078,%rax
+  8007e1:	00 00 00 
+  8007e4:	48 01 d0             	add    %rdx,%rax
+  8007e7:	48 8b 00             	mov    (%rax),%rax
+  8007ea:	ff e0                	jmp    *%rax
+        padc = '-';
+  8007ec:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8007f0:	eb c0                	jmp    8007b2 <vprintfmt+0x8f>
+        padc = '0';
+  8007f2:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8007f6:	eb ba                	jmp    8007b2 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8007f8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8007ff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800802:	89 d0                	mov    %edx,%eax
+  800804:	c1 e0 02             	shl    $0x2,%eax
+  800807:	01 d0                	add    %edx,%eax
+  800809:	01 c0                	add    %eax,%eax
+  80080b:	01 d8                	add    %ebx,%eax
+  80080d:	83 e8 30             	sub    $0x30,%eax
+  800810:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800813:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800817:	0f b6 00             	movzbl (%rax),%eax
+  80081a:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80081d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800820:	7e 60                	jle    800882 <vprintfmt+0x15f>
+  800822:	83 fb 39             	cmp    $0x39,%ebx
+  800825:	7f 5b                	jg     800882 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800827:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80082c:	eb d1                	jmp    8007ff <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	77 17                	ja     80084d <vprintfmt+0x12a>
+  800836:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80083a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80083d:	89 d2                	mov    %edx,%edx
+  80083f:	48 01 d0             	add    %rdx,%rax
+  800842:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800845:	83 c2 08             	add    $0x8,%edx
+  800848:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80084b:	eb 0c                	jmp    800859 <vprintfmt+0x136>
+  80084d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800851:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800855:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800859:	8b 00                	mov    (%rax),%eax
+  80085b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  80085e:	eb 23                	jmp    800883 <vprintfmt+0x160>
+        if (width < 0)
+  800860:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800864:	0f 89 44 ff ff ff    	jns    8007ae <vprintfmt+0x8b>
+          width = 0;
+  80086a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800871:	e9 38 ff ff ff       	jmp    8007ae <vprintfmt+0x8b>
+        altflag = 1;
+  800876:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80087d:	e9 30 ff ff ff       	jmp    8007b2 <vprintfmt+0x8f>
+        goto process_precision;
+  800882:	90                   	nop
+        if (width < 0)
+  800883:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800887:	0f 89 24 ff ff ff    	jns    8007b1 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80088d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800890:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800893:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80089a:	e9 12 ff ff ff       	jmp    8007b1 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80089f:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8008a3:	e9 0a ff ff ff       	jmp    8007b2 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8008a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ae:	77 17                	ja     8008c7 <vprintfmt+0x1a4>
+  8008b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008b4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008b7:	89 d2                	mov    %edx,%edx
+  8008b9:	48 01 d0             	add    %rdx,%rax
+  8008bc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008bf:	83 c2 08             	add    $0x8,%edx
+  8008c2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008c5:	eb 0c                	jmp    8008d3 <vprintfmt+0x1b0>
+  8008c7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008cb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008cf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008d3:	8b 00                	mov    (%rax),%eax
+  8008d5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8008d9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8008dd:	48 89 d6             	mov    %rdx,%rsi
+  8008e0:	89 c7                	mov    %eax,%edi
+  8008e2:	ff d1                	call   *%rcx
+        break;
+  8008e4:	e9 37 03 00 00       	jmp    800c20 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8008e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ef:	77 17                	ja     800908 <vprintfmt+0x1e5>
+  8008f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008f5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f8:	89 d2                	mov    %edx,%edx
+  8008fa:	48 01 d0             	add    %rdx,%rax
+  8008fd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800900:	83 c2 08             	add    $0x8,%edx
+  800903:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800906:	eb 0c                	jmp    800914 <vprintfmt+0x1f1>
+  800908:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80090c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800910:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800914:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800916:	85 db                	test   %ebx,%ebx
+  800918:	79 02                	jns    80091c <vprintfmt+0x1f9>
+          err = -err;
+  80091a:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80091c:	83 fb 15             	cmp    $0x15,%ebx
+  80091f:	7f 16                	jg     800937 <vprintfmt+0x214>
+  800921:	48 ba a0 5f 80 00 00 	movabs $0x805fa0,%rdx
+  800928:	00 00 00 
+  80092b:	48 63 c3             	movslq %ebx,%rax
+  80092e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800932:	4d 85 e4             	test   %r12,%r12
+  800935:	75 2e                	jne    800965 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800937:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80093b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80093f:	89 d9                	mov    %ebx,%ecx
+  800941:	48 ba 61 60 80 00 00 	movabs $0x806061,%rdx
+  800948:	00 00 00 
+  80094b:	48 89 c7             	mov    %rax,%rdi
+  80094e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800953:	49 b8 2f 0c 80 00 00 	movabs $0x800c2f,%r8
+  80095a:	00 00 00 
+  80095d:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800960:	e9 bb 02 00 00       	jmp    800c20 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800965:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800969:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80096d:	4c 89 e1             	mov    %r12,%rcx
+  800970:	48 ba 6a 60 80 00 00 	movabs $0x80606a,%rdx
+  800977:	00 00 00 
+  80097a:	48 89 c7             	mov    %rax,%rdi
+  80097d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800982:	49 b8 2f 0c 80 00 00 	movabs $0x800c2f,%r8
+  800989:	00 00 00 
+  80098c:	41 ff d0             	call   *%r8
+        break;
+  80098f:	e9 8c 02 00 00       	jmp    800c20 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800997:	83 f8 2f             	cmp    $0x2f,%eax
+  80099a:	77 17                	ja     8009b3 <vprintfmt+0x290>
+  80099c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009a0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009a3:	89 d2                	mov    %edx,%edx
+  8009a5:	48 01 d0             	add    %rdx,%rax
+  8009a8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ab:	83 c2 08             	add    $0x8,%edx
+  8009ae:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009b1:	eb 0c                	jmp    8009bf <vprintfmt+0x29c>
+  8009b3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009b7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009bb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009bf:	4c 8b 20             	mov    (%rax),%r12
+  8009c2:	4d 85 e4             	test   %r12,%r12
+  8009c5:	75 0a                	jne    8009d1 <vprintfmt+0x2ae>
+          p = "(null)";
+  8009c7:	49 bc 6d 60 80 00 00 	movabs $0x80606d,%r12
+  8009ce:	00 00 00 
+        if (width > 0 && padc != '-')
+  8009d1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009d5:	7e 78                	jle    800a4f <vprintfmt+0x32c>
+  8009d7:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8009db:	74 72                	je     800a4f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8009dd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8009e0:	48 98                	cltq
+  8009e2:	48 89 c6             	mov    %rax,%rsi
+  8009e5:	4c 89 e7             	mov    %r12,%rdi
+  8009e8:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  8009ef:	00 00 00 
+  8009f2:	ff d0                	call   *%rax
+  8009f4:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8009f7:	eb 17                	jmp    800a10 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8009f9:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8009fd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a01:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a05:	48 89 d6             	mov    %rdx,%rsi
+  800a08:	89 c7                	mov    %eax,%edi
+  800a0a:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a0c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a10:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a14:	7f e3                	jg     8009f9 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a16:	eb 37                	jmp    800a4f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800a18:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800a1c:	74 1e                	je     800a3c <vprintfmt+0x319>
+  800a1e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a21:	7e 05                	jle    800a28 <vprintfmt+0x305>
+  800a23:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a26:	7e 14                	jle    800a3c <vprintfmt+0x319>
+            putch('?', putdat);
+  800a28:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a2c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a30:	48 89 c6             	mov    %rax,%rsi
+  800a33:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a38:	ff d2                	call   *%rdx
+  800a3a:	eb 0f                	jmp    800a4b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800a3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a44:	48 89 c6             	mov    %rax,%rsi
+  800a47:	89 df                	mov    %ebx,%edi
+  800a49:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a4b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a4f:	4c 89 e0             	mov    %r12,%rax
+  800a52:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a56:	0f b6 00             	movzbl (%rax),%eax
+  800a59:	0f be d8             	movsbl %al,%ebx
+  800a5c:	85 db                	test   %ebx,%ebx
+  800a5e:	74 28                	je     800a88 <vprintfmt+0x365>
+  800a60:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a64:	78 b2                	js     800a18 <vprintfmt+0x2f5>
+  800a66:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800a6a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800a6e:	79 a8                	jns    800a18 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800a70:	eb 16                	jmp    800a88 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800a72:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a76:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a7a:	48 89 c6             	mov    %rax,%rsi
+  800a7d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a82:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800a84:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a88:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a8c:	7f e4                	jg     800a72 <vprintfmt+0x34f>
+        break;
+  800a8e:	e9 8d 01 00 00       	jmp    800c20 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800a93:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a96:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a9a:	89 d6                	mov    %edx,%esi
+  800a9c:	48 89 c7             	mov    %rax,%rdi
+  800a9f:	48 b8 2c 06 80 00 00 	movabs $0x80062c,%rax
+  800aa6:	00 00 00 
+  800aa9:	ff d0                	call   *%rax
+  800aab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab3:	48 85 c0             	test   %rax,%rax
+  800ab6:	79 1d                	jns    800ad5 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800ab8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800abc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ac0:	48 89 c6             	mov    %rax,%rsi
+  800ac3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ac8:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800aca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ace:	48 f7 d8             	neg    %rax
+  800ad1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800ad5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800adc:	e9 d2 00 00 00       	jmp    800bb3 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800ae1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ae4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ae8:	89 d6                	mov    %edx,%esi
+  800aea:	48 89 c7             	mov    %rax,%rdi
+  800aed:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  800af4:	00 00 00 
+  800af7:	ff d0                	call   *%rax
+  800af9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800afd:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b04:	e9 aa 00 00 00       	jmp    800bb3 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800b09:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b0c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b10:	89 d6                	mov    %edx,%esi
+  800b12:	48 89 c7             	mov    %rax,%rdi
+  800b15:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  800b1c:	00 00 00 
+  800b1f:	ff d0                	call   *%rax
+  800b21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800b25:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800b2c:	e9 82 00 00 00       	jmp    800bb3 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800b31:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b35:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b39:	48 89 c6             	mov    %rax,%rsi
+  800b3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b41:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800b43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b47:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b4b:	48 89 c6             	mov    %rax,%rsi
+  800b4e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b53:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 17                	ja     800b74 <vprintfmt+0x451>
+  800b5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b61:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b64:	89 d2                	mov    %edx,%edx
+  800b66:	48 01 d0             	add    %rdx,%rax
+  800b69:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b6c:	83 c2 08             	add    $0x8,%edx
+  800b6f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b72:	eb 0c                	jmp    800b80 <vprintfmt+0x45d>
+  800b74:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b78:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b7c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b80:	48 8b 00             	mov    (%rax),%rax
+  800b83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800b87:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800b8e:	eb 23                	jmp    800bb3 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800b90:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b93:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b97:	89 d6                	mov    %edx,%esi
+  800b99:	48 89 c7             	mov    %rax,%rdi
+  800b9c:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  800ba3:	00 00 00 
+  800ba6:	ff d0                	call   *%rax
+  800ba8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800bac:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800bb3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800bb8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800bbb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800bbe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bc2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bc6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bca:	45 89 c1             	mov    %r8d,%r9d
+  800bcd:	41 89 f8             	mov    %edi,%r8d
+  800bd0:	48 89 c7             	mov    %rax,%rdi
+  800bd3:	48 b8 7d 04 80 00 00 	movabs $0x80047d,%rax
+  800bda:	00 00 00 
+  800bdd:	ff d0                	call   *%rax
+        break;
+  800bdf:	eb 3f                	jmp    800c20 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800be1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800be5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800be9:	48 89 c6             	mov    %rax,%rsi
+  800bec:	89 df                	mov    %ebx,%edi
+  800bee:	ff d2                	call   *%rdx
+        break;
+  800bf0:	eb 2e                	jmp    800c20 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800bf2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bf6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bfa:	48 89 c6             	mov    %rax,%rsi
+  800bfd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c02:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800c04:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c09:	eb 05                	jmp    800c10 <vprintfmt+0x4ed>
+  800c0b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c10:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c14:	48 83 e8 01          	sub    $0x1,%rax
+  800c18:	0f b6 00             	movzbl (%rax),%eax
+  800c1b:	3c 25                	cmp    $0x25,%al
+  800c1d:	75 ec                	jne    800c0b <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800c1f:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c20:	e9 50 fb ff ff       	jmp    800775 <vprintfmt+0x52>
+        return;
+  800c25:	90                   	nop
+    }
+  }
+}
+  800c26:	48 83 c4 60          	add    $0x60,%rsp
+  800c2a:	5b                   	pop    %rbx
+  800c2b:	41 5c                	pop    %r12
+  800c2d:	5d                   	pop    %rbp
+  800c2e:	c3                   	ret
+
+0000000000800c2f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c2f:	55                   	push   %rbp
+  800c30:	48 89 e5             	mov    %rsp,%rbp
+  800c33:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c3a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c41:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800c48:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800c4f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c56:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c5d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c64:	84 c0                	test   %al,%al
+  800c66:	74 20                	je     800c88 <printfmt+0x59>
+  800c68:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c6c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c70:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c74:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c78:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c7c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c80:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c84:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800c88:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800c8f:	00 00 00 
+  800c92:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800c99:	00 00 00 
+  800c9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ca0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ca7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800cae:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800cb5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800cbc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800cc3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800cca:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800cd1:	48 89 c7             	mov    %rax,%rdi
+  800cd4:	48 b8 23 07 80 00 00 	movabs $0x800723,%rax
+  800cdb:	00 00 00 
+  800cde:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800ce0:	90                   	nop
+  800ce1:	c9                   	leave
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800ce3:	55                   	push   %rbp
+  800ce4:	48 89 e5             	mov    %rsp,%rbp
+  800ce7:	48 83 ec 10          	sub    $0x10,%rsp
+  800ceb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800cee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800cf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800cf6:	8b 40 10             	mov    0x10(%rax),%eax
+  800cf9:	8d 50 01             	lea    0x1(%rax),%edx
+  800cfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d00:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800d03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d07:	48 8b 10             	mov    (%rax),%rdx
+  800d0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d0e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d12:	48 39 c2             	cmp    %rax,%rdx
+  800d15:	73 17                	jae    800d2e <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800d17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d1b:	48 8b 00             	mov    (%rax),%rax
+  800d1e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d22:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d26:	48 89 0a             	mov    %rcx,(%rdx)
+  800d29:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d2c:	88 10                	mov    %dl,(%rax)
+}
+  800d2e:	90                   	nop
+  800d2f:	c9                   	leave
+  800d30:	c3                   	ret
+
+0000000000800d31 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800d31:	55                   	push   %rbp
+  800d32:	48 89 e5             	mov    %rsp,%rbp
+  800d35:	48 83 ec 40          	sub    $0x40,%rsp
+  800d39:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d3d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800d40:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d44:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800d48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d4c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800d50:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800d53:	48 98                	cltq
+  800d55:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d5d:	48 01 d0             	add    %rdx,%rax
+  800d60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800d64:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800d6b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800d70:	74 06                	je     800d78 <vsnprintf+0x47>
+  800d72:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d76:	7f 07                	jg     800d7f <vsnprintf+0x4e>
+    return -E_INVAL;
+  800d78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d7d:	eb 32                	jmp    800db1 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800d7f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800d83:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800d87:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800d8b:	48 89 c6             	mov    %rax,%rsi
+  800d8e:	48 b8 e3 0c 80 00 00 	movabs $0x800ce3,%rax
+  800d95:	00 00 00 
+  800d98:	48 89 c7             	mov    %rax,%rdi
+  800d9b:	48 b8 23 07 80 00 00 	movabs $0x800723,%rax
+  800da2:	00 00 00 
+  800da5:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800da7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dab:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800dae:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800db1:	c9                   	leave
+  800db2:	c3                   	ret
+
+0000000000800db3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800db3:	55                   	push   %rbp
+  800db4:	48 89 e5             	mov    %rsp,%rbp
+  800db7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800dbe:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800dc5:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800dcb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800dd2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800dd9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800de0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800de7:	84 c0                	test   %al,%al
+  800de9:	74 20                	je     800e0b <snprintf+0x58>
+  800deb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800def:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800df3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800df7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800dfb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800dff:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e03:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e07:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800e0b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e12:	00 00 00 
+  800e15:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e1c:	00 00 00 
+  800e1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e23:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e2a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e31:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800e38:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800e3f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e46:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800e4c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e53:	48 89 c7             	mov    %rax,%rdi
+  800e56:	48 b8 31 0d 80 00 00 	movabs $0x800d31,%rax
+  800e5d:	00 00 00 
+  800e60:	ff d0                	call   *%rax
+  800e62:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800e68:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800e6e:	c9                   	leave
+  800e6f:	c3                   	ret
+
+0000000000800e70 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800e70:	55                   	push   %rbp
+  800e71:	48 89 e5             	mov    %rsp,%rbp
+  800e74:	53                   	push   %rbx
+  800e75:	48 83 ec 38          	sub    $0x38,%rsp
+  800e79:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800e7c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800e80:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800e84:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800e88:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800e8c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	89 d1                	mov    %edx,%ecx
+  800e96:	0f a2                	cpuid
+  800e98:	89 de                	mov    %ebx,%esi
+  800e9a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800e9d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800ea0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ea3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ea6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800eab:	74 09                	je     800eb6 <cpuid+0x46>
+}
+  800ead:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800eb4:	89 10                	mov    %edx,(%rax)
+
+  800eb6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ebb:	74 09                	je     800ec6 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800ebd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ec1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800ec4:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800ec6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800ecb:	74 09                	je     800ed6 <cpuid+0x66>
+char *
+  800ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ed1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ed4:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800ed6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800edb:	74 09                	je     800ee6 <cpuid+0x76>
+  for (; *s; s++)
+  800edd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ee1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800ee4:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800ee6:	90                   	nop
+  800ee7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800eeb:	c9                   	leave
+  800eec:	c3                   	ret
+
+0000000000800eed <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800eed:	55                   	push   %rbp
+  800eee:	48 89 e5             	mov    %rsp,%rbp
+  800ef1:	48 83 ec 18          	sub    $0x18,%rsp
+  800ef5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800ef8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800efb:	89 c1                	mov    %eax,%ecx
+  800efd:	0f 01 d0             	xgetbv
+  800f00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f03:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800f06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f09:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800f0c:	48 c1 e2 20          	shl    $0x20,%rdx
+  800f10:	48 09 d0             	or     %rdx,%rax
+#else
+  800f13:	c9                   	leave
+  800f14:	c3                   	ret
+
+0000000000800f15 <string_cpu>:
+string_cpu(void) {
+  800f15:	55                   	push   %rbp
+  800f16:	48 89 e5             	mov    %rsp,%rbp
+  800f19:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800f1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800f24:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800f2b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f32:	00 00 00 
+  800f35:	8b 00                	mov    (%rax),%eax
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	78 11                	js     800f4c <string_cpu+0x37>
+    return string_features;
+  800f3b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f42:	00 00 00 
+  800f45:	8b 00                	mov    (%rax),%eax
+  800f47:	e9 df 00 00 00       	jmp    80102b <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800f4c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800f50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f60:	48 89 c6             	mov    %rax,%rsi
+  800f63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f68:	48 b8 70 0e 80 00 00 	movabs $0x800e70,%rax
+  800f6f:	00 00 00 
+  800f72:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800f74:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800f77:	83 f8 06             	cmp    $0x6,%eax
+  800f7a:	76 28                	jbe    800fa4 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800f7c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800f80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8b:	48 89 c2             	mov    %rax,%rdx
+  800f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f93:	bf 07 00 00 00       	mov    $0x7,%edi
+  800f98:	48 b8 70 0e 80 00 00 	movabs $0x800e70,%rax
+  800f9f:	00 00 00 
+  800fa2:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800fa4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800fa7:	25 00 02 00 00       	and    $0x200,%eax
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	74 04                	je     800fb4 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800fb0:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800fb4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800fb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fbe:	48 89 c1             	mov    %rax,%rcx
+  800fc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcb:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fd0:	48 b8 70 0e 80 00 00 	movabs $0x800e70,%rax
+  800fd7:	00 00 00 
+  800fda:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800fdc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800fdf:	83 e0 20             	and    $0x20,%eax
+  800fe2:	85 c0                	test   %eax,%eax
+  800fe4:	74 2a                	je     801010 <string_cpu+0xfb>
+  800fe6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800fe9:	25 00 00 00 08       	and    $0x8000000,%eax
+  800fee:	85 c0                	test   %eax,%eax
+  800ff0:	74 1e                	je     801010 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff7:	48 b8 ed 0e 80 00 00 	movabs $0x800eed,%rax
+  800ffe:	00 00 00 
+  801001:	ff d0                	call   *%rax
+  801003:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801006:	48 83 f8 06          	cmp    $0x6,%rax
+  80100a:	75 04                	jne    801010 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80100c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801010:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801017:	00 00 00 
+  80101a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80101d:	89 02                	mov    %eax,(%rdx)
+  80101f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801026:	00 00 00 
+  801029:	8b 00                	mov    (%rax),%eax
+}
+  80102b:	c9                   	leave
+  80102c:	c3                   	ret
+
+000000000080102d <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80102d:	55                   	push   %rbp
+  80102e:	48 89 e5             	mov    %rsp,%rbp
+  801031:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801035:	48 83 ec 60          	sub    $0x60,%rsp
+  801039:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80103e:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801043:	83 e0 1f             	and    $0x1f,%eax
+  801046:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80104a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80104e:	48 f7 d8             	neg    %rax
+  801051:	48 89 c2             	mov    %rax,%rdx
+  801054:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801059:	48 01 d0             	add    %rdx,%rax
+  80105c:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801061:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801065:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80106b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801070:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801074:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80107a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80107e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801082:	89 c2                	mov    %eax,%edx
+  801084:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801088:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80108d:	89 c1                	mov    %eax,%ecx
+  80108f:	d3 e6                	shl    %cl,%esi
+  801091:	89 f0                	mov    %esi,%eax
+  801093:	21 d0                	and    %edx,%eax
+  801095:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801099:	eb 21                	jmp    8010bc <strlen_avx2+0x8f>
+    p += 32;
+  80109b:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8010a1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010a6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010aa:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8010b0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010b4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010b8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8010bc:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8010c1:	74 d8                	je     80109b <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8010c3:	31 c0                	xor    %eax,%eax
+  8010c5:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8010cb:	48 63 d0             	movslq %eax,%rdx
+  8010ce:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010d3:	48 01 d0             	add    %rdx,%rax
+  8010d6:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8010db:	c9                   	leave
+  8010dc:	c3                   	ret
+
+00000000008010dd <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8010dd:	55                   	push   %rbp
+  8010de:	48 89 e5             	mov    %rsp,%rbp
+  8010e1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010e5:	48 83 ec 40          	sub    $0x40,%rsp
+  8010e9:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8010ee:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8010f3:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8010f8:	eb 77                	jmp    801171 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8010fa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010ff:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801103:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801107:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80110c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801110:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801114:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801118:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80111c:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801121:	74 3c                	je     80115f <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801123:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801127:	f7 d0                	not    %eax
+  801129:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80112d:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801131:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801135:	48 63 d0             	movslq %eax,%rdx
+  801138:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80113d:	48 01 d0             	add    %rdx,%rax
+  801140:	0f b6 00             	movzbl (%rax),%eax
+  801143:	0f b6 c0             	movzbl %al,%eax
+  801146:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80114a:	48 63 ca             	movslq %edx,%rcx
+  80114d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801152:	48 01 ca             	add    %rcx,%rdx
+  801155:	0f b6 12             	movzbl (%rdx),%edx
+  801158:	0f b6 d2             	movzbl %dl,%edx
+  80115b:	29 d0                	sub    %edx,%eax
+  80115d:	eb 6b                	jmp    8011ca <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80115f:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801165:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80116b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801171:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801177:	77 81                	ja     8010fa <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801179:	eb 42                	jmp    8011bd <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80117b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801180:	0f b6 10             	movzbl (%rax),%edx
+  801183:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801188:	0f b6 00             	movzbl (%rax),%eax
+  80118b:	38 c2                	cmp    %al,%dl
+  80118d:	74 1c                	je     8011ab <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80118f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801194:	0f b6 00             	movzbl (%rax),%eax
+  801197:	0f b6 c8             	movzbl %al,%ecx
+  80119a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80119f:	0f b6 00             	movzbl (%rax),%eax
+  8011a2:	0f b6 d0             	movzbl %al,%edx
+  8011a5:	89 c8                	mov    %ecx,%eax
+  8011a7:	29 d0                	sub    %edx,%eax
+  8011a9:	eb 1f                	jmp    8011ca <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8011ab:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8011b1:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8011b7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8011bd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8011c3:	75 b6                	jne    80117b <memcmp_avx2+0x9e>
+  return 0;
+  8011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+
+00000000008011cc <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+  8011d0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8011d4:	48 83 ec 60          	sub    $0x60,%rsp
+  8011d8:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8011dd:	89 f0                	mov    %esi,%eax
+  8011df:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8011e4:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8011e8:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8011ed:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8011f1:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8011f6:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8011fc:	eb 47                	jmp    801245 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8011fe:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801203:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801207:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80120b:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801211:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801215:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801219:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80121d:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801222:	74 15                	je     801239 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801224:	31 c0                	xor    %eax,%eax
+  801226:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80122c:	48 63 d0             	movslq %eax,%rdx
+  80122f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801234:	48 01 d0             	add    %rdx,%rax
+  801237:	eb 3d                	jmp    801276 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801239:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80123f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801245:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80124b:	77 b1                	ja     8011fe <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80124d:	eb 0c                	jmp    80125b <memfind_avx2+0x8f>
+  80124f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801255:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80125b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801261:	74 0e                	je     801271 <memfind_avx2+0xa5>
+  801263:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801268:	0f b6 00             	movzbl (%rax),%eax
+  80126b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80126f:	75 de                	jne    80124f <memfind_avx2+0x83>
+  return s;
+  801271:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+
+0000000000801278 <strlen>:
+strlen(const char *s) {
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	48 83 ec 40          	sub    $0x40,%rsp
+  801280:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801284:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801288:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80128c:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  801293:	00 00 00 
+  801296:	ff d0                	call   *%rax
+  801298:	83 e0 02             	and    $0x2,%eax
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	74 18                	je     8012b7 <strlen+0x3f>
+    return strlen_avx2(s);
+  80129f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012a3:	48 89 c7             	mov    %rax,%rdi
+  8012a6:	48 b8 2d 10 80 00 00 	movabs $0x80102d,%rax
+  8012ad:	00 00 00 
+  8012b0:	ff d0                	call   *%rax
+  8012b2:	e9 82 00 00 00       	jmp    801339 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8012b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012bb:	83 e0 0f             	and    $0xf,%eax
+  8012be:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8012c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012c4:	48 f7 d8             	neg    %rax
+  8012c7:	48 89 c2             	mov    %rax,%rdx
+  8012ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012ce:	48 01 d0             	add    %rdx,%rax
+  8012d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8012d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8012dd:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8012e2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8012e6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8012ea:	89 c2                	mov    %eax,%edx
+  8012ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8012ef:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8012f4:	89 c1                	mov    %eax,%ecx
+  8012f6:	d3 e6                	shl    %cl,%esi
+  8012f8:	89 f0                	mov    %esi,%eax
+  8012fa:	21 d0                	and    %edx,%eax
+  8012fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8012ff:	eb 1d                	jmp    80131e <strlen+0xa6>
+    p += 16;
+  801301:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801306:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80130a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80130e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801313:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801317:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80131b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80131e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801322:	74 dd                	je     801301 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801324:	31 c0                	xor    %eax,%eax
+  801326:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80132b:	48 63 d0             	movslq %eax,%rdx
+  80132e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801332:	48 01 d0             	add    %rdx,%rax
+  801335:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+
+000000000080133b <strnlen>:
+strnlen(const char *s, size_t size) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	48 83 ec 20          	sub    $0x20,%rsp
+  801343:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801347:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80134b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801352:	eb 0e                	jmp    801362 <strnlen+0x27>
+    n++;
+  801354:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801358:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80135d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801362:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801367:	74 0b                	je     801374 <strnlen+0x39>
+  801369:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80136d:	0f b6 00             	movzbl (%rax),%eax
+  801370:	84 c0                	test   %al,%al
+  801372:	75 e0                	jne    801354 <strnlen+0x19>
+  return n;
+  801374:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801377:	c9                   	leave
+  801378:	c3                   	ret
+
+0000000000801379 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801379:	55                   	push   %rbp
+  80137a:	48 89 e5             	mov    %rsp,%rbp
+  80137d:	48 83 ec 20          	sub    $0x20,%rsp
+  801381:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801385:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801389:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80138d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801391:	90                   	nop
+  801392:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801396:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80139a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80139e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013aa:	0f b6 12             	movzbl (%rdx),%edx
+  8013ad:	88 10                	mov    %dl,(%rax)
+  8013af:	0f b6 00             	movzbl (%rax),%eax
+  8013b2:	84 c0                	test   %al,%al
+  8013b4:	75 dc                	jne    801392 <strcpy+0x19>
+  return ret;
+  8013b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013ba:	c9                   	leave
+  8013bb:	c3                   	ret
+
+00000000008013bc <strcat>:
+strcat(char *dst, const char *src) {
+  8013bc:	55                   	push   %rbp
+  8013bd:	48 89 e5             	mov    %rsp,%rbp
+  8013c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8013c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8013cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d0:	48 89 c7             	mov    %rax,%rdi
+  8013d3:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8013da:	00 00 00 
+  8013dd:	ff d0                	call   *%rax
+  8013df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8013e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013e5:	48 63 d0             	movslq %eax,%rdx
+  8013e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ec:	48 01 c2             	add    %rax,%rdx
+  8013ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013f3:	48 89 c6             	mov    %rax,%rsi
+  8013f6:	48 89 d7             	mov    %rdx,%rdi
+  8013f9:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  801400:	00 00 00 
+  801403:	ff d0                	call   *%rax
+  return dst;
+  801405:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801409:	c9                   	leave
+  80140a:	c3                   	ret
+
+000000000080140b <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80140b:	55                   	push   %rbp
+  80140c:	48 89 e5             	mov    %rsp,%rbp
+  80140f:	48 83 ec 28          	sub    $0x28,%rsp
+  801413:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801417:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80141b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80141f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801423:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801427:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80142e:	00 
+  80142f:	eb 2a                	jmp    80145b <strncpy+0x50>
+    *dst++ = *src;
+  801431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801435:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801439:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80143d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801441:	0f b6 12             	movzbl (%rdx),%edx
+  801444:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801446:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80144a:	0f b6 00             	movzbl (%rax),%eax
+  80144d:	84 c0                	test   %al,%al
+  80144f:	74 05                	je     801456 <strncpy+0x4b>
+      src++;
+  801451:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801456:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80145b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801463:	72 cc                	jb     801431 <strncpy+0x26>
+  return ret;
+  801465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+000000000080146b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	48 83 ec 28          	sub    $0x28,%rsp
+  801473:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801477:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80147b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80147f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801483:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801487:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80148c:	74 3d                	je     8014cb <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80148e:	eb 1d                	jmp    8014ad <strlcpy+0x42>
+      *dst++ = *src++;
+  801490:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801494:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801498:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80149c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014a4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014a8:	0f b6 12             	movzbl (%rdx),%edx
+  8014ab:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8014ad:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8014b2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014b7:	74 0b                	je     8014c4 <strlcpy+0x59>
+  8014b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014bd:	0f b6 00             	movzbl (%rax),%eax
+  8014c0:	84 c0                	test   %al,%al
+  8014c2:	75 cc                	jne    801490 <strlcpy+0x25>
+    *dst = '\0';
+  8014c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c8:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8014cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014cf:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8014d3:	c9                   	leave
+  8014d4:	c3                   	ret
+
+00000000008014d5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014d5:	55                   	push   %rbp
+  8014d6:	48 89 e5             	mov    %rsp,%rbp
+  8014d9:	48 83 ec 30          	sub    $0x30,%rsp
+  8014dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014e5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8014e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014ed:	48 89 c7             	mov    %rax,%rdi
+  8014f0:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8014f7:	00 00 00 
+  8014fa:	ff d0                	call   *%rax
+  8014fc:	48 98                	cltq
+  8014fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801502:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801506:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150a:	48 89 d6             	mov    %rdx,%rsi
+  80150d:	48 89 c7             	mov    %rax,%rdi
+  801510:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  801517:	00 00 00 
+  80151a:	ff d0                	call   *%rax
+  80151c:	48 98                	cltq
+  80151e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801522:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801526:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80152a:	75 10                	jne    80153c <strlcat+0x67>
+    return maxlen + srclen;
+  80152c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801530:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801534:	48 01 d0             	add    %rdx,%rax
+  801537:	e9 86 00 00 00       	jmp    8015c2 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80153c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801540:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801544:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801548:	73 2b                	jae    801575 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80154a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80154e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801552:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801556:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80155a:	48 01 c1             	add    %rax,%rcx
+  80155d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801561:	48 89 c6             	mov    %rax,%rsi
+  801564:	48 89 cf             	mov    %rcx,%rdi
+  801567:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  80156e:	00 00 00 
+  801571:	ff d0                	call   *%rax
+  801573:	eb 42                	jmp    8015b7 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801575:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801579:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80157d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801581:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801585:	48 01 c1             	add    %rax,%rcx
+  801588:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80158c:	48 89 c6             	mov    %rax,%rsi
+  80158f:	48 89 cf             	mov    %rcx,%rdi
+  801592:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  801599:	00 00 00 
+  80159c:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80159e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015a6:	48 01 d0             	add    %rdx,%rax
+  8015a9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b1:	48 01 d0             	add    %rdx,%rax
+  8015b4:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8015b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015bf:	48 01 d0             	add    %rdx,%rax
+}
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+
+00000000008015c4 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8015c4:	55                   	push   %rbp
+  8015c5:	48 89 e5             	mov    %rsp,%rbp
+  8015c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8015cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8015d4:	eb 0a                	jmp    8015e0 <strcmp+0x1c>
+    p++, q++;
+  8015d6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015db:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8015e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e4:	0f b6 00             	movzbl (%rax),%eax
+  8015e7:	84 c0                	test   %al,%al
+  8015e9:	74 12                	je     8015fd <strcmp+0x39>
+  8015eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ef:	0f b6 10             	movzbl (%rax),%edx
+  8015f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f6:	0f b6 00             	movzbl (%rax),%eax
+  8015f9:	38 c2                	cmp    %al,%dl
+  8015fb:	74 d9                	je     8015d6 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8015fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801601:	0f b6 00             	movzbl (%rax),%eax
+  801604:	0f b6 d0             	movzbl %al,%edx
+  801607:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160b:	0f b6 00             	movzbl (%rax),%eax
+  80160e:	0f b6 c0             	movzbl %al,%eax
+  801611:	29 c2                	sub    %eax,%edx
+  801613:	89 d0                	mov    %edx,%eax
+}
+  801615:	c9                   	leave
+  801616:	c3                   	ret
+
+0000000000801617 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801617:	55                   	push   %rbp
+  801618:	48 89 e5             	mov    %rsp,%rbp
+  80161b:	48 83 ec 18          	sub    $0x18,%rsp
+  80161f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801623:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801627:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80162b:	eb 0f                	jmp    80163c <strncmp+0x25>
+    n--, p++, q++;
+  80162d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801632:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801637:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80163c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801641:	74 1d                	je     801660 <strncmp+0x49>
+  801643:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801647:	0f b6 00             	movzbl (%rax),%eax
+  80164a:	84 c0                	test   %al,%al
+  80164c:	74 12                	je     801660 <strncmp+0x49>
+  80164e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801652:	0f b6 10             	movzbl (%rax),%edx
+  801655:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801659:	0f b6 00             	movzbl (%rax),%eax
+  80165c:	38 c2                	cmp    %al,%dl
+  80165e:	74 cd                	je     80162d <strncmp+0x16>
+  if (n == 0)
+  801660:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801665:	75 07                	jne    80166e <strncmp+0x57>
+    return 0;
+  801667:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166c:	eb 16                	jmp    801684 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80166e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801672:	0f b6 00             	movzbl (%rax),%eax
+  801675:	0f b6 d0             	movzbl %al,%edx
+  801678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167c:	0f b6 00             	movzbl (%rax),%eax
+  80167f:	0f b6 c0             	movzbl %al,%eax
+  801682:	29 c2                	sub    %eax,%edx
+}
+  801684:	89 d0                	mov    %edx,%eax
+  801686:	c9                   	leave
+  801687:	c3                   	ret
+
+0000000000801688 <strchr>:
+strchr(const char *s, char c) {
+  801688:	55                   	push   %rbp
+  801689:	48 89 e5             	mov    %rsp,%rbp
+  80168c:	48 83 ec 60          	sub    $0x60,%rsp
+  801690:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801694:	89 f0                	mov    %esi,%eax
+  801696:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801699:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80169d:	83 e0 0f             	and    $0xf,%eax
+  8016a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8016a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8016a6:	48 f7 d8             	neg    %rax
+  8016a9:	48 89 c2             	mov    %rax,%rdx
+  8016ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016b0:	48 01 d0             	add    %rdx,%rax
+  8016b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8016b7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016bb:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8016bf:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8016c3:	66 0f 6e c0          	movd   %eax,%xmm0
+  8016c7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8016cb:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8016cf:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8016d4:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8016d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016dc:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8016e0:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8016e4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8016e9:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8016ee:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8016f2:	89 c2                	mov    %eax,%edx
+  8016f4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8016f9:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8016fe:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801702:	09 c2                	or     %eax,%edx
+  801704:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801707:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80170c:	89 c1                	mov    %eax,%ecx
+  80170e:	d3 e6                	shl    %cl,%esi
+  801710:	89 f0                	mov    %esi,%eax
+  801712:	21 d0                	and    %edx,%eax
+  801714:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801717:	eb 34                	jmp    80174d <strchr+0xc5>
+    p += 16;
+  801719:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80171e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801722:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801726:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80172a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80172f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801734:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801738:	89 c2                	mov    %eax,%edx
+  80173a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80173f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801744:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801748:	09 d0                	or     %edx,%eax
+  80174a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80174d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801751:	74 c6                	je     801719 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801753:	31 c0                	xor    %eax,%eax
+  801755:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80175a:	48 98                	cltq
+  80175c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801760:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801764:	0f b6 00             	movzbl (%rax),%eax
+  801767:	84 c0                	test   %al,%al
+  801769:	74 06                	je     801771 <strchr+0xe9>
+  80176b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176f:	eb 05                	jmp    801776 <strchr+0xee>
+  801771:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801776:	c9                   	leave
+  801777:	c3                   	ret
+
+0000000000801778 <strfind>:
+strfind(const char *s, char c) {
+  801778:	55                   	push   %rbp
+  801779:	48 89 e5             	mov    %rsp,%rbp
+  80177c:	48 83 ec 10          	sub    $0x10,%rsp
+  801780:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801784:	89 f0                	mov    %esi,%eax
+  801786:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801789:	eb 11                	jmp    80179c <strfind+0x24>
+    if (*s == c)
+  80178b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80178f:	0f b6 00             	movzbl (%rax),%eax
+  801792:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801795:	74 12                	je     8017a9 <strfind+0x31>
+  for (; *s; s++)
+  801797:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80179c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a0:	0f b6 00             	movzbl (%rax),%eax
+  8017a3:	84 c0                	test   %al,%al
+  8017a5:	75 e4                	jne    80178b <strfind+0x13>
+  8017a7:	eb 01                	jmp    8017aa <strfind+0x32>
+      break;
+  8017a9:	90                   	nop
+  return (char *)s;
+  8017aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+
+00000000008017b0 <memset>:
+memset(void *v, int c, size_t n) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	48 83 ec 38          	sub    $0x38,%rsp
+  8017b8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017bc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8017bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8017c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8017cb:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8017d0:	76 41                	jbe    801813 <memset+0x63>
+  8017d2:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  8017d9:	00 00 00 
+  8017dc:	ff d0                	call   *%rax
+  8017de:	83 e0 01             	and    $0x1,%eax
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	74 2e                	je     801813 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8017e5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8017e8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017ec:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8017f0:	48 89 ce             	mov    %rcx,%rsi
+  8017f3:	48 89 f7             	mov    %rsi,%rdi
+  8017f6:	48 89 d1             	mov    %rdx,%rcx
+  8017f9:	fc                   	cld
+  8017fa:	f3 aa                	rep stos %al,%es:(%rdi)
+  8017fc:	48 89 ca             	mov    %rcx,%rdx
+  8017ff:	48 89 fe             	mov    %rdi,%rsi
+  801802:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801806:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80180a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180e:	e9 a7 00 00 00       	jmp    8018ba <memset+0x10a>
+  if (n >= 8) {
+  801813:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801818:	0f 86 87 00 00 00    	jbe    8018a5 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  80181e:	eb 16                	jmp    801836 <memset+0x86>
+      *p++ = c;
+  801820:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801824:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801828:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80182c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80182f:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801831:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80183a:	83 e0 07             	and    $0x7,%eax
+  80183d:	48 85 c0             	test   %rax,%rax
+  801840:	75 de                	jne    801820 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801842:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801845:	0f b6 c0             	movzbl %al,%eax
+  801848:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80184f:	01 01 01 
+  801852:	48 0f af c2          	imul   %rdx,%rax
+  801856:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80185a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80185e:	48 c1 e8 03          	shr    $0x3,%rax
+  801862:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80186e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801872:	48 89 ce             	mov    %rcx,%rsi
+  801875:	48 89 f7             	mov    %rsi,%rdi
+  801878:	48 89 d1             	mov    %rdx,%rcx
+  80187b:	fc                   	cld
+  80187c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80187f:	48 89 ca             	mov    %rcx,%rdx
+  801882:	48 89 fe             	mov    %rdi,%rsi
+  801885:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801889:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80188d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801892:	eb 11                	jmp    8018a5 <memset+0xf5>
+    *p++ = c;
+  801894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801898:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80189c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018a0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018a3:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8018a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018a9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018ad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018b1:	48 85 c0             	test   %rax,%rax
+  8018b4:	75 de                	jne    801894 <memset+0xe4>
+  return v;
+  8018b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8018ba:	c9                   	leave
+  8018bb:	c3                   	ret
+
+00000000008018bc <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	48 83 ec 38          	sub    $0x38,%rsp
+  8018c4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8018d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8018d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8018e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8018e8:	0f 83 da 00 00 00    	jae    8019c8 <memmove+0x10c>
+  8018ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018f6:	48 01 d0             	add    %rdx,%rax
+  8018f9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8018fd:	0f 83 c5 00 00 00    	jae    8019c8 <memmove+0x10c>
+    s += n;
+  801903:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801907:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80190b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801913:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801918:	0f 86 94 00 00 00    	jbe    8019b2 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80191e:	eb 1c                	jmp    80193c <memmove+0x80>
+        *--d = *--s;
+  801920:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801925:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80192a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192e:	0f b6 10             	movzbl (%rax),%edx
+  801931:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801935:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801937:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80193c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801940:	83 e0 07             	and    $0x7,%eax
+  801943:	48 85 c0             	test   %rax,%rax
+  801946:	75 d8                	jne    801920 <memmove+0x64>
+      nq = n / 8;
+  801948:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80194c:	48 c1 e8 03          	shr    $0x3,%rax
+  801950:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801954:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801959:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  80195e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801963:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801967:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80196b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80196f:	48 89 cf             	mov    %rcx,%rdi
+  801972:	48 89 d6             	mov    %rdx,%rsi
+  801975:	48 89 c1             	mov    %rax,%rcx
+  801978:	fd                   	std
+  801979:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80197c:	fc                   	cld
+  80197d:	48 89 c8             	mov    %rcx,%rax
+  801980:	48 89 f2             	mov    %rsi,%rdx
+  801983:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801987:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80198b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  80198f:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801994:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801999:	eb 17                	jmp    8019b2 <memmove+0xf6>
+      *--d = *--s;
+  80199b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019a0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a9:	0f b6 10             	movzbl (%rax),%edx
+  8019ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019be:	48 85 c0             	test   %rax,%rax
+  8019c1:	75 d8                	jne    80199b <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8019c3:	e9 f4 00 00 00       	jmp    801abc <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019c8:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8019cd:	76 46                	jbe    801a15 <memmove+0x159>
+  8019cf:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+  8019db:	83 e0 01             	and    $0x1,%eax
+  8019de:	85 c0                	test   %eax,%eax
+  8019e0:	74 33                	je     801a15 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8019e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019ee:	48 89 cf             	mov    %rcx,%rdi
+  8019f1:	48 89 d6             	mov    %rdx,%rsi
+  8019f4:	48 89 c1             	mov    %rax,%rcx
+  8019f7:	fc                   	cld
+  8019f8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8019fa:	48 89 c8             	mov    %rcx,%rax
+  8019fd:	48 89 f2             	mov    %rsi,%rdx
+  801a00:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a04:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801a0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a10:	e9 ab 00 00 00       	jmp    801ac0 <memmove+0x204>
+    if (n >= 8) {
+  801a15:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a1a:	0f 86 8b 00 00 00    	jbe    801aab <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801a20:	eb 22                	jmp    801a44 <memmove+0x188>
+        *d++ = *s++;
+  801a22:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a26:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a2a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a32:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a36:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801a3a:	0f b6 12             	movzbl (%rdx),%edx
+  801a3d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a3f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a48:	83 e0 07             	and    $0x7,%eax
+  801a4b:	48 85 c0             	test   %rax,%rax
+  801a4e:	75 d2                	jne    801a22 <memmove+0x166>
+      nq = n / 8;
+  801a50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a54:	48 c1 e8 03          	shr    $0x3,%rax
+  801a58:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801a5c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a68:	48 89 cf             	mov    %rcx,%rdi
+  801a6b:	48 89 d6             	mov    %rdx,%rsi
+  801a6e:	48 89 c1             	mov    %rax,%rcx
+  801a71:	fc                   	cld
+  801a72:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a75:	48 89 c8             	mov    %rcx,%rax
+  801a78:	48 89 f2             	mov    %rsi,%rdx
+  801a7b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a7f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801a87:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801a8c:	eb 1d                	jmp    801aab <memmove+0x1ef>
+      *d++ = *s++;
+  801a8e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a92:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801aa2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801aa6:	0f b6 12             	movzbl (%rdx),%edx
+  801aa9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801aab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aaf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ab3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ab7:	48 85 c0             	test   %rax,%rax
+  801aba:	75 d2                	jne    801a8e <memmove+0x1d2>
+  return dst;
+  801abc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801ac0:	c9                   	leave
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ac2:	55                   	push   %rbp
+  801ac3:	48 89 e5             	mov    %rsp,%rbp
+  801ac6:	48 83 ec 18          	sub    $0x18,%rsp
+  801aca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ace:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ad2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801ad6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ada:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ade:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae2:	48 89 ce             	mov    %rcx,%rsi
+  801ae5:	48 89 c7             	mov    %rax,%rdi
+  801ae8:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801aef:	00 00 00 
+  801af2:	ff d0                	call   *%rax
+}
+  801af4:	c9                   	leave
+  801af5:	c3                   	ret
+
+0000000000801af6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801af6:	55                   	push   %rbp
+  801af7:	48 89 e5             	mov    %rsp,%rbp
+  801afa:	48 83 ec 40          	sub    $0x40,%rsp
+  801afe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b02:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b06:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801b0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b0e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801b12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b1a:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801b1f:	0f 86 a7 00 00 00    	jbe    801bcc <memcmp+0xd6>
+  801b25:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  801b2c:	00 00 00 
+  801b2f:	ff d0                	call   *%rax
+  801b31:	83 e0 02             	and    $0x2,%eax
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	0f 84 90 00 00 00    	je     801bcc <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801b3c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b40:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b48:	48 89 ce             	mov    %rcx,%rsi
+  801b4b:	48 89 c7             	mov    %rax,%rdi
+  801b4e:	48 b8 dd 10 80 00 00 	movabs $0x8010dd,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+  801b5a:	e9 c2 00 00 00       	jmp    801c21 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801b5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b63:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b67:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b6f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801b73:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b77:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801b7e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801b85:	74 36                	je     801bbd <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801b87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b8a:	f7 d0                	not    %eax
+  801b8c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801b90:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801b93:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801b96:	48 63 d0             	movslq %eax,%rdx
+  801b99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b9d:	48 01 d0             	add    %rdx,%rax
+  801ba0:	0f b6 00             	movzbl (%rax),%eax
+  801ba3:	0f b6 c0             	movzbl %al,%eax
+  801ba6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ba9:	48 63 ca             	movslq %edx,%rcx
+  801bac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801bb0:	48 01 ca             	add    %rcx,%rdx
+  801bb3:	0f b6 12             	movzbl (%rdx),%edx
+  801bb6:	0f b6 d2             	movzbl %dl,%edx
+  801bb9:	29 d0                	sub    %edx,%eax
+  801bbb:	eb 64                	jmp    801c21 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801bbd:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801bc2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801bc7:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801bcc:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801bd1:	77 8c                	ja     801b5f <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801bd3:	eb 36                	jmp    801c0b <memcmp+0x115>
+    if (*s1 != *s2)
+  801bd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd9:	0f b6 10             	movzbl (%rax),%edx
+  801bdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be0:	0f b6 00             	movzbl (%rax),%eax
+  801be3:	38 c2                	cmp    %al,%dl
+  801be5:	74 1a                	je     801c01 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801be7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801beb:	0f b6 00             	movzbl (%rax),%eax
+  801bee:	0f b6 c8             	movzbl %al,%ecx
+  801bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf5:	0f b6 00             	movzbl (%rax),%eax
+  801bf8:	0f b6 d0             	movzbl %al,%edx
+  801bfb:	89 c8                	mov    %ecx,%eax
+  801bfd:	29 d0                	sub    %edx,%eax
+  801bff:	eb 20                	jmp    801c21 <memcmp+0x12b>
+    s1++, s2++;
+  801c01:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c06:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801c0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c0f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c13:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c17:	48 85 c0             	test   %rax,%rax
+  801c1a:	75 b9                	jne    801bd5 <memcmp+0xdf>
+  }
+
+  return 0;
+  801c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+0000000000801c23 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801c23:	55                   	push   %rbp
+  801c24:	48 89 e5             	mov    %rsp,%rbp
+  801c27:	48 83 ec 50          	sub    $0x50,%rsp
+  801c2b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c2f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801c32:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801c36:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c3a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801c3e:	48 01 d0             	add    %rdx,%rax
+  801c41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801c45:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801c48:	66 0f 6e c0          	movd   %eax,%xmm0
+  801c4c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801c50:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801c54:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801c59:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801c5d:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801c62:	76 73                	jbe    801cd7 <memfind+0xb4>
+  801c64:	48 b8 15 0f 80 00 00 	movabs $0x800f15,%rax
+  801c6b:	00 00 00 
+  801c6e:	ff d0                	call   *%rax
+  801c70:	83 e0 02             	and    $0x2,%eax
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	74 60                	je     801cd7 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801c77:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801c7a:	0f b6 c8             	movzbl %al,%ecx
+  801c7d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801c81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c85:	89 ce                	mov    %ecx,%esi
+  801c87:	48 89 c7             	mov    %rax,%rdi
+  801c8a:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  801c91:	00 00 00 
+  801c94:	ff d0                	call   *%rax
+  801c96:	eb 6c                	jmp    801d04 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801c98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c9c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ca0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ca4:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801ca9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801cad:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801cb1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801cb4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801cb8:	74 13                	je     801ccd <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801cba:	31 c0                	xor    %eax,%eax
+  801cbc:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801cc1:	48 63 d0             	movslq %eax,%rdx
+  801cc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc8:	48 01 d0             	add    %rdx,%rax
+  801ccb:	eb 37                	jmp    801d04 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801ccd:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801cd2:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801cd7:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801cdc:	77 ba                	ja     801c98 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801cde:	eb 13                	jmp    801cf3 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801ce0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce4:	0f b6 00             	movzbl (%rax),%eax
+  801ce7:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801cea:	38 d0                	cmp    %dl,%al
+  801cec:	74 11                	je     801cff <memfind+0xdc>
+  for (; s < ends; s++)
+  801cee:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801cf3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801cfb:	72 e3                	jb     801ce0 <memfind+0xbd>
+  801cfd:	eb 01                	jmp    801d00 <memfind+0xdd>
+      break;
+  801cff:	90                   	nop
+  return (void *)s;
+  801d00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d04:	c9                   	leave
+  801d05:	c3                   	ret
+
+0000000000801d06 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d06:	55                   	push   %rbp
+  801d07:	48 89 e5             	mov    %rsp,%rbp
+  801d0a:	48 83 ec 38          	sub    $0x38,%rsp
+  801d0e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d12:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d16:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801d19:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801d20:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d27:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801d28:	eb 05                	jmp    801d2f <strtol+0x29>
+    s++;
+  801d2a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d33:	0f b6 00             	movzbl (%rax),%eax
+  801d36:	3c 20                	cmp    $0x20,%al
+  801d38:	74 f0                	je     801d2a <strtol+0x24>
+  801d3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3e:	0f b6 00             	movzbl (%rax),%eax
+  801d41:	3c 09                	cmp    $0x9,%al
+  801d43:	74 e5                	je     801d2a <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801d45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d49:	0f b6 00             	movzbl (%rax),%eax
+  801d4c:	3c 2b                	cmp    $0x2b,%al
+  801d4e:	75 07                	jne    801d57 <strtol+0x51>
+    s++;
+  801d50:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d55:	eb 17                	jmp    801d6e <strtol+0x68>
+  else if (*s == '-')
+  801d57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5b:	0f b6 00             	movzbl (%rax),%eax
+  801d5e:	3c 2d                	cmp    $0x2d,%al
+  801d60:	75 0c                	jne    801d6e <strtol+0x68>
+    s++, neg = 1;
+  801d62:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d67:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801d6e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d72:	74 06                	je     801d7a <strtol+0x74>
+  801d74:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d78:	75 28                	jne    801da2 <strtol+0x9c>
+  801d7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7e:	0f b6 00             	movzbl (%rax),%eax
+  801d81:	3c 30                	cmp    $0x30,%al
+  801d83:	75 1d                	jne    801da2 <strtol+0x9c>
+  801d85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d89:	48 83 c0 01          	add    $0x1,%rax
+  801d8d:	0f b6 00             	movzbl (%rax),%eax
+  801d90:	3c 78                	cmp    $0x78,%al
+  801d92:	75 0e                	jne    801da2 <strtol+0x9c>
+    s += 2, base = 16;
+  801d94:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801d99:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801da0:	eb 2c                	jmp    801dce <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801da2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801da6:	75 19                	jne    801dc1 <strtol+0xbb>
+  801da8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dac:	0f b6 00             	movzbl (%rax),%eax
+  801daf:	3c 30                	cmp    $0x30,%al
+  801db1:	75 0e                	jne    801dc1 <strtol+0xbb>
+    s++, base = 8;
+  801db3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801db8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801dbf:	eb 0d                	jmp    801dce <strtol+0xc8>
+  else if (base == 0)
+  801dc1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dc5:	75 07                	jne    801dce <strtol+0xc8>
+    base = 10;
+  801dc7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801dce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd2:	0f b6 00             	movzbl (%rax),%eax
+  801dd5:	3c 2f                	cmp    $0x2f,%al
+  801dd7:	7e 1d                	jle    801df6 <strtol+0xf0>
+  801dd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ddd:	0f b6 00             	movzbl (%rax),%eax
+  801de0:	3c 39                	cmp    $0x39,%al
+  801de2:	7f 12                	jg     801df6 <strtol+0xf0>
+      dig = *s - '0';
+  801de4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de8:	0f b6 00             	movzbl (%rax),%eax
+  801deb:	0f be c0             	movsbl %al,%eax
+  801dee:	83 e8 30             	sub    $0x30,%eax
+  801df1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801df4:	eb 4e                	jmp    801e44 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801df6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dfa:	0f b6 00             	movzbl (%rax),%eax
+  801dfd:	3c 60                	cmp    $0x60,%al
+  801dff:	7e 1d                	jle    801e1e <strtol+0x118>
+  801e01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e05:	0f b6 00             	movzbl (%rax),%eax
+  801e08:	3c 7a                	cmp    $0x7a,%al
+  801e0a:	7f 12                	jg     801e1e <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801e0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e10:	0f b6 00             	movzbl (%rax),%eax
+  801e13:	0f be c0             	movsbl %al,%eax
+  801e16:	83 e8 57             	sub    $0x57,%eax
+  801e19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e1c:	eb 26                	jmp    801e44 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801e1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e22:	0f b6 00             	movzbl (%rax),%eax
+  801e25:	3c 40                	cmp    $0x40,%al
+  801e27:	7e 47                	jle    801e70 <strtol+0x16a>
+  801e29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e2d:	0f b6 00             	movzbl (%rax),%eax
+  801e30:	3c 5a                	cmp    $0x5a,%al
+  801e32:	7f 3c                	jg     801e70 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801e34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e38:	0f b6 00             	movzbl (%rax),%eax
+  801e3b:	0f be c0             	movsbl %al,%eax
+  801e3e:	83 e8 37             	sub    $0x37,%eax
+  801e41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801e44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e47:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e4a:	7d 23                	jge    801e6f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801e4c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e51:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e54:	48 98                	cltq
+  801e56:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801e5b:	48 89 c2             	mov    %rax,%rdx
+  801e5e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e61:	48 98                	cltq
+  801e63:	48 01 d0             	add    %rdx,%rax
+  801e66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801e6a:	e9 5f ff ff ff       	jmp    801dce <strtol+0xc8>
+      break;
+  801e6f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801e70:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e75:	74 0b                	je     801e82 <strtol+0x17c>
+    *endptr = (char *)s;
+  801e77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e7b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e7f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801e82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e86:	74 09                	je     801e91 <strtol+0x18b>
+  801e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e8c:	48 f7 d8             	neg    %rax
+  801e8f:	eb 04                	jmp    801e95 <strtol+0x18f>
+  801e91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e95:	c9                   	leave
+  801e96:	c3                   	ret
+
+0000000000801e97 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801e97:	55                   	push   %rbp
+  801e98:	48 89 e5             	mov    %rsp,%rbp
+  801e9b:	53                   	push   %rbx
+  801e9c:	48 83 ec 48          	sub    $0x48,%rsp
+  801ea0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ea4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ea8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801eac:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801eb0:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801eb4:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801eb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ebc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ec0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801ec4:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801ec8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801ecc:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ed0:	4c 89 c3             	mov    %r8,%rbx
+  801ed3:	cd 30                	int    $0x30
+  801ed5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801ed9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ede:	74 46                	je     801f26 <syscall+0x8f>
+  801ee0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ee5:	7e 3f                	jle    801f26 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801ee7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eeb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eef:	49 89 d0             	mov    %rdx,%r8
+  801ef2:	48 89 c1             	mov    %rax,%rcx
+  801ef5:	48 b8 28 63 80 00 00 	movabs $0x806328,%rax
+  801efc:	00 00 00 
+  801eff:	48 89 c2             	mov    %rax,%rdx
+  801f02:	be 22 00 00 00       	mov    $0x22,%esi
+  801f07:	48 b8 47 63 80 00 00 	movabs $0x806347,%rax
+  801f0e:	00 00 00 
+  801f11:	48 89 c7             	mov    %rax,%rdi
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f19:	49 b9 aa 01 80 00 00 	movabs $0x8001aa,%r9
+  801f20:	00 00 00 
+  801f23:	41 ff d1             	call   *%r9
+
+  return ret;
+  801f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f2e:	c9                   	leave
+  801f2f:	c3                   	ret
+
+0000000000801f30 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+  801f34:	48 83 ec 10          	sub    $0x10,%rsp
+  801f38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f3c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f40:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f48:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5a:	48 89 d1             	mov    %rdx,%rcx
+  801f5d:	48 89 c2             	mov    %rax,%rdx
+  801f60:	be 00 00 00 00       	mov    $0x0,%esi
+  801f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6a:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  801f71:	00 00 00 
+  801f74:	ff d0                	call   *%rax
+  801f76:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f7a:	90                   	nop
+  801f7b:	c9                   	leave
+  801f7c:	c3                   	ret
+
+0000000000801f7d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f81:	48 83 ec 08          	sub    $0x8,%rsp
+  801f85:	6a 00                	push   $0x0
+  801f87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9d:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fa7:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb7:	c9                   	leave
+  801fb8:	c3                   	ret
+
+0000000000801fb9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801fb9:	55                   	push   %rbp
+  801fba:	48 89 e5             	mov    %rsp,%rbp
+  801fbd:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801fc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801fc7:	48 98                	cltq
+  801fc9:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe0:	48 89 c2             	mov    %rax,%rdx
+  801fe3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fe8:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fed:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+0000000000801fff <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+  802003:	48 83 ec 10          	sub    $0x10,%rsp
+  802007:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80200a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80200d:	48 98                	cltq
+  80200f:	48 83 ec 08          	sub    $0x8,%rsp
+  802013:	6a 00                	push   $0x0
+  802015:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80201b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802021:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802026:	48 89 c2             	mov    %rax,%rdx
+  802029:	be 00 00 00 00       	mov    $0x0,%esi
+  80202e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802033:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80203a:	00 00 00 
+  80203d:	ff d0                	call   *%rax
+  80203f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802043:	90                   	nop
+  802044:	c9                   	leave
+  802045:	c3                   	ret
+
+0000000000802046 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802046:	55                   	push   %rbp
+  802047:	48 89 e5             	mov    %rsp,%rbp
+  80204a:	48 83 ec 20          	sub    $0x20,%rsp
+  80204e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802051:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802055:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802058:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80205b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802060:	cd 30                	int    $0x30
+  802062:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802066:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80206a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80206f:	7e 3d                	jle    8020ae <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802071:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802075:	49 89 c0             	mov    %rax,%r8
+  802078:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80207d:	48 b8 28 63 80 00 00 	movabs $0x806328,%rax
+  802084:	00 00 00 
+  802087:	48 89 c2             	mov    %rax,%rdx
+  80208a:	be 49 00 00 00       	mov    $0x49,%esi
+  80208f:	48 b8 47 63 80 00 00 	movabs $0x806347,%rax
+  802096:	00 00 00 
+  802099:	48 89 c7             	mov    %rax,%rdi
+  80209c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a1:	49 b9 aa 01 80 00 00 	movabs $0x8001aa,%r9
+  8020a8:	00 00 00 
+  8020ab:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8020ae:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8020b3:	75 13                	jne    8020c8 <sys_env_wait+0x82>
+  8020b5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8020ba:	74 0c                	je     8020c8 <sys_env_wait+0x82>
+    *status = st;
+  8020bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020c0:	89 c2                	mov    %eax,%edx
+  8020c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020c6:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8020c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+00000000008020ce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8020d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d6:	6a 00                	push   $0x0
+  8020d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020f8:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+  802104:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802108:	c9                   	leave
+  802109:	c3                   	ret
+
+000000000080210a <sys_yield>:
+
+void
+sys_yield(void) {
+  80210a:	55                   	push   %rbp
+  80210b:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80210e:	48 83 ec 08          	sub    $0x8,%rsp
+  802112:	6a 00                	push   $0x0
+  802114:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80211a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802120:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212a:	be 00 00 00 00       	mov    $0x0,%esi
+  80212f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802134:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+  802140:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802144:	90                   	nop
+  802145:	c9                   	leave
+  802146:	c3                   	ret
+
+0000000000802147 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802147:	55                   	push   %rbp
+  802148:	48 89 e5             	mov    %rsp,%rbp
+  80214b:	48 83 ec 20          	sub    $0x20,%rsp
+  80214f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802152:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802156:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802159:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80215c:	48 63 c8             	movslq %eax,%rcx
+  80215f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802166:	48 98                	cltq
+  802168:	48 83 ec 08          	sub    $0x8,%rsp
+  80216c:	6a 00                	push   $0x0
+  80216e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802174:	49 89 c8             	mov    %rcx,%r8
+  802177:	48 89 d1             	mov    %rdx,%rcx
+  80217a:	48 89 c2             	mov    %rax,%rdx
+  80217d:	be 01 00 00 00       	mov    $0x1,%esi
+  802182:	bf 06 00 00 00       	mov    $0x6,%edi
+  802187:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+  802193:	48 83 c4 10          	add    $0x10,%rsp
+  802197:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80219a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+
+000000000080219f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021ae:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8021b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021b5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8021b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8021bc:	48 63 c8             	movslq %eax,%rcx
+  8021bf:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8021c6:	48 63 f0             	movslq %eax,%rsi
+  8021c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021d0:	48 98                	cltq
+  8021d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d6:	51                   	push   %rcx
+  8021d7:	49 89 f9             	mov    %rdi,%r9
+  8021da:	49 89 f0             	mov    %rsi,%r8
+  8021dd:	48 89 d1             	mov    %rdx,%rcx
+  8021e0:	48 89 c2             	mov    %rax,%rdx
+  8021e3:	be 01 00 00 00       	mov    $0x1,%esi
+  8021e8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8021ed:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+  8021f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+
+00000000008021ff <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8021ff:	55                   	push   %rbp
+  802200:	48 89 e5             	mov    %rsp,%rbp
+  802203:	48 83 ec 10          	sub    $0x10,%rsp
+  802207:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80220e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802215:	48 98                	cltq
+  802217:	48 83 ec 08          	sub    $0x8,%rsp
+  80221b:	6a 00                	push   $0x0
+  80221d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802229:	48 89 d1             	mov    %rdx,%rcx
+  80222c:	48 89 c2             	mov    %rax,%rdx
+  80222f:	be 01 00 00 00       	mov    $0x1,%esi
+  802234:	bf 08 00 00 00       	mov    $0x8,%edi
+  802239:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802240:	00 00 00 
+  802243:	ff d0                	call   *%rax
+  802245:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802249:	c9                   	leave
+  80224a:	c3                   	ret
+
+000000000080224b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80224b:	55                   	push   %rbp
+  80224c:	48 89 e5             	mov    %rsp,%rbp
+  80224f:	48 83 ec 10          	sub    $0x10,%rsp
+  802253:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802256:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802259:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80225c:	48 63 d0             	movslq %eax,%rdx
+  80225f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802262:	48 98                	cltq
+  802264:	48 83 ec 08          	sub    $0x8,%rsp
+  802268:	6a 00                	push   $0x0
+  80226a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802276:	48 89 d1             	mov    %rdx,%rcx
+  802279:	48 89 c2             	mov    %rax,%rdx
+  80227c:	be 01 00 00 00       	mov    $0x1,%esi
+  802281:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802286:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+  802292:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802296:	c9                   	leave
+  802297:	c3                   	ret
+
+0000000000802298 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802298:	55                   	push   %rbp
+  802299:	48 89 e5             	mov    %rsp,%rbp
+  80229c:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8022a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022ae:	48 98                	cltq
+  8022b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b4:	6a 00                	push   $0x0
+  8022b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022c2:	48 89 d1             	mov    %rdx,%rcx
+  8022c5:	48 89 c2             	mov    %rax,%rdx
+  8022c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022cd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022d2:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8022d9:	00 00 00 
+  8022dc:	ff d0                	call   *%rax
+  8022de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e2:	c9                   	leave
+  8022e3:	c3                   	ret
+
+00000000008022e4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+  8022e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8022f3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022fa:	48 98                	cltq
+  8022fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802300:	6a 00                	push   $0x0
+  802302:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80230e:	48 89 d1             	mov    %rdx,%rcx
+  802311:	48 89 c2             	mov    %rax,%rdx
+  802314:	be 01 00 00 00       	mov    $0x1,%esi
+  802319:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80231e:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+
+0000000000802330 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802330:	55                   	push   %rbp
+  802331:	48 89 e5             	mov    %rsp,%rbp
+  802334:	48 83 ec 20          	sub    $0x20,%rsp
+  802338:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80233b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80233f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802343:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802346:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802349:	48 63 f0             	movslq %eax,%rsi
+  80234c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802350:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802354:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802357:	48 98                	cltq
+  802359:	48 83 ec 08          	sub    $0x8,%rsp
+  80235d:	6a 00                	push   $0x0
+  80235f:	49 89 f1             	mov    %rsi,%r9
+  802362:	49 89 c8             	mov    %rcx,%r8
+  802365:	48 89 d1             	mov    %rdx,%rcx
+  802368:	48 89 c2             	mov    %rax,%rdx
+  80236b:	be 00 00 00 00       	mov    $0x0,%esi
+  802370:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802375:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80237c:	00 00 00 
+  80237f:	ff d0                	call   *%rax
+  802381:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+0000000000802387 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	48 83 ec 10          	sub    $0x10,%rsp
+  80238f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802393:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802397:	48 83 ec 08          	sub    $0x8,%rsp
+  80239b:	6a 00                	push   $0x0
+  80239d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ae:	48 89 c2             	mov    %rax,%rdx
+  8023b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8023b6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8023bb:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023cb:	c9                   	leave
+  8023cc:	c3                   	ret
+
+00000000008023cd <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8023cd:	55                   	push   %rbp
+  8023ce:	48 89 e5             	mov    %rsp,%rbp
+  8023d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8023d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8023dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f7:	48 89 d1             	mov    %rdx,%rcx
+  8023fa:	48 89 c2             	mov    %rax,%rdx
+  8023fd:	be 01 00 00 00       	mov    $0x1,%esi
+  802402:	bf 10 00 00 00       	mov    $0x10,%edi
+  802407:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80240e:	00 00 00 
+  802411:	ff d0                	call   *%rax
+  802413:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+
+0000000000802419 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80241d:	48 83 ec 08          	sub    $0x8,%rsp
+  802421:	6a 00                	push   $0x0
+  802423:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802434:	ba 00 00 00 00       	mov    $0x0,%edx
+  802439:	be 00 00 00 00       	mov    $0x0,%esi
+  80243e:	bf 11 00 00 00       	mov    $0x11,%edi
+  802443:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+  80244f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+
+0000000000802455 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802455:	55                   	push   %rbp
+  802456:	48 89 e5             	mov    %rsp,%rbp
+  802459:	48 83 ec 10          	sub    $0x10,%rsp
+  80245d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802461:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802465:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802469:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246d:	48 83 ec 08          	sub    $0x8,%rsp
+  802471:	6a 00                	push   $0x0
+  802473:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802479:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247f:	48 89 d1             	mov    %rdx,%rcx
+  802482:	48 89 c2             	mov    %rax,%rdx
+  802485:	be 00 00 00 00       	mov    $0x0,%esi
+  80248a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80248f:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802496:	00 00 00 
+  802499:	ff d0                	call   *%rax
+  80249b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249f:	c9                   	leave
+  8024a0:	c3                   	ret
+
+00000000008024a1 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+  8024a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8024a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024b1:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8024b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024b7:	48 63 c8             	movslq %eax,%rcx
+  8024ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c6:	6a 00                	push   $0x0
+  8024c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ce:	49 89 c8             	mov    %rcx,%r8
+  8024d1:	48 89 d1             	mov    %rdx,%rcx
+  8024d4:	48 89 c2             	mov    %rax,%rdx
+  8024d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8024dc:	bf 13 00 00 00       	mov    $0x13,%edi
+  8024e1:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8024e8:	00 00 00 
+  8024eb:	ff d0                	call   *%rax
+  8024ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+00000000008024f3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8024f3:	55                   	push   %rbp
+  8024f4:	48 89 e5             	mov    %rsp,%rbp
+  8024f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8024fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024ff:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802502:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802506:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80250a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80250d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802511:	48 83 ec 08          	sub    $0x8,%rsp
+  802515:	6a 00                	push   $0x0
+  802517:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80251d:	49 89 c8             	mov    %rcx,%r8
+  802520:	48 89 d1             	mov    %rdx,%rcx
+  802523:	48 89 c2             	mov    %rax,%rdx
+  802526:	be 00 00 00 00       	mov    $0x0,%esi
+  80252b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802530:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+0000000000802542 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	48 83 ec 10          	sub    $0x10,%rsp
+  80254a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80254e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802551:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802554:	48 63 d0             	movslq %eax,%rdx
+  802557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80255b:	48 83 ec 08          	sub    $0x8,%rsp
+  80255f:	6a 00                	push   $0x0
+  802561:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80256d:	48 89 d1             	mov    %rdx,%rcx
+  802570:	48 89 c2             	mov    %rax,%rdx
+  802573:	be 00 00 00 00       	mov    $0x0,%esi
+  802578:	bf 15 00 00 00       	mov    $0x15,%edi
+  80257d:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+  802589:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80258d:	c9                   	leave
+  80258e:	c3                   	ret
+
+000000000080258f <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	48 83 ec 20          	sub    $0x20,%rsp
+  802597:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80259b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80259e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8025a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8025a5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025a9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8025ac:	48 63 c8             	movslq %eax,%rcx
+  8025af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025b2:	48 63 d0             	movslq %eax,%rdx
+  8025b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	49 89 f1             	mov    %rsi,%r9
+  8025c2:	49 89 c8             	mov    %rcx,%r8
+  8025c5:	48 89 d1             	mov    %rdx,%rcx
+  8025c8:	48 89 c2             	mov    %rax,%rdx
+  8025cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d0:	bf 16 00 00 00       	mov    $0x16,%edi
+  8025d5:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+  8025e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e5:	c9                   	leave
+  8025e6:	c3                   	ret
+
+00000000008025e7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+  8025eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025fb:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8025ff:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802603:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802607:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80260b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80260f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802617:	48 83 ec 08          	sub    $0x8,%rsp
+  80261b:	51                   	push   %rcx
+  80261c:	49 89 f9             	mov    %rdi,%r9
+  80261f:	49 89 f0             	mov    %rsi,%r8
+  802622:	48 89 d1             	mov    %rdx,%rcx
+  802625:	48 89 c2             	mov    %rax,%rdx
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+  80262d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802632:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+  802648:	48 83 ec 10          	sub    $0x10,%rsp
+  80264c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80264f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802652:	48 98                	cltq
+  802654:	48 83 ec 08          	sub    $0x8,%rsp
+  802658:	6a 00                	push   $0x0
+  80265a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266b:	48 89 c2             	mov    %rax,%rdx
+  80266e:	be 00 00 00 00       	mov    $0x0,%esi
+  802673:	bf 18 00 00 00       	mov    $0x18,%edi
+  802678:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+  802684:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802688:	90                   	nop
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+000000000080268b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	48 83 ec 30          	sub    $0x30,%rsp
+  802693:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802696:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80269a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80269e:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8026a1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026a4:	48 63 f0             	movslq %eax,%rsi
+  8026a7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026b2:	48 98                	cltq
+  8026b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b8:	6a 00                	push   $0x0
+  8026ba:	49 89 f1             	mov    %rsi,%r9
+  8026bd:	49 89 c8             	mov    %rcx,%r8
+  8026c0:	48 89 d1             	mov    %rdx,%rcx
+  8026c3:	48 89 c2             	mov    %rax,%rdx
+  8026c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8026cb:	bf 19 00 00 00       	mov    $0x19,%edi
+  8026d0:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+  8026dc:	48 83 c4 10          	add    $0x10,%rsp
+  8026e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8026e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8026e6:	c9                   	leave
+  8026e7:	c3                   	ret
+
+00000000008026e8 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8026e8:	55                   	push   %rbp
+  8026e9:	48 89 e5             	mov    %rsp,%rbp
+  8026ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8026f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026f8:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8026fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026fe:	48 63 c8             	movslq %eax,%rcx
+  802701:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802705:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802709:	48 83 ec 08          	sub    $0x8,%rsp
+  80270d:	6a 00                	push   $0x0
+  80270f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802715:	49 89 c8             	mov    %rcx,%r8
+  802718:	48 89 d1             	mov    %rdx,%rcx
+  80271b:	48 89 c2             	mov    %rax,%rdx
+  80271e:	be 01 00 00 00       	mov    $0x1,%esi
+  802723:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802728:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  80272f:	00 00 00 
+  802732:	ff d0                	call   *%rax
+  802734:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802738:	c9                   	leave
+  802739:	c3                   	ret
+
+000000000080273a <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+  80273e:	48 83 ec 20          	sub    $0x20,%rsp
+  802742:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802746:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  80274e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802752:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802756:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80275a:	48 83 ec 08          	sub    $0x8,%rsp
+  80275e:	6a 00                	push   $0x0
+  802760:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802766:	49 89 c8             	mov    %rcx,%r8
+  802769:	48 89 d1             	mov    %rdx,%rcx
+  80276c:	48 89 c2             	mov    %rax,%rdx
+  80276f:	be 01 00 00 00       	mov    $0x1,%esi
+  802774:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802779:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+
+000000000080278b <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  80278b:	55                   	push   %rbp
+  80278c:	48 89 e5             	mov    %rsp,%rbp
+  80278f:	48 83 ec 30          	sub    $0x30,%rsp
+  802793:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802797:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80279b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  80279e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8027a2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8027a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027a9:	48 63 c8             	movslq %eax,%rcx
+  8027ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8027b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b8:	6a 00                	push   $0x0
+  8027ba:	49 89 f1             	mov    %rsi,%r9
+  8027bd:	49 89 c8             	mov    %rcx,%r8
+  8027c0:	48 89 d1             	mov    %rdx,%rcx
+  8027c3:	48 89 c2             	mov    %rax,%rdx
+  8027c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8027cb:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8027d0:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+  8027dc:	48 83 c4 10          	add    $0x10,%rsp
+  8027e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8027e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+00000000008027e8 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8027f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027f6:	48 98                	cltq
+  8027f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fc:	6a 00                	push   $0x0
+  8027fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802804:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80280a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80280f:	48 89 c2             	mov    %rax,%rdx
+  802812:	be 01 00 00 00       	mov    $0x1,%esi
+  802817:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80281c:	48 b8 97 1e 80 00 00 	movabs $0x801e97,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+  802828:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+000000000080282e <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	48 83 ec 08          	sub    $0x8,%rsp
+  802836:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80283a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802845:	ff ff ff 
+  802848:	48 01 d0             	add    %rdx,%rax
+  80284b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80284f:	c9                   	leave
+  802850:	c3                   	ret
+
+0000000000802851 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802851:	55                   	push   %rbp
+  802852:	48 89 e5             	mov    %rsp,%rbp
+  802855:	48 83 ec 08          	sub    $0x8,%rsp
+  802859:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80285d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802861:	48 89 c7             	mov    %rax,%rdi
+  802864:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802876:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+
+000000000080287c <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80287c:	55                   	push   %rbp
+  80287d:	48 89 e5             	mov    %rsp,%rbp
+  802880:	48 83 ec 18          	sub    $0x18,%rsp
+  802884:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802888:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80288f:	e9 ae 00 00 00       	jmp    802942 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802894:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802897:	c1 e0 0c             	shl    $0xc,%eax
+  80289a:	48 98                	cltq
+  80289c:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8028a1:	48 01 d0             	add    %rdx,%rax
+  8028a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8028a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ac:	48 c1 e8 27          	shr    $0x27,%rax
+  8028b0:	48 89 c2             	mov    %rax,%rdx
+  8028b3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8028ba:	01 00 00 
+  8028bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028c1:	83 e0 01             	and    $0x1,%eax
+  8028c4:	48 85 c0             	test   %rax,%rax
+  8028c7:	74 63                	je     80292c <fd_alloc+0xb0>
+  8028c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028cd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028d1:	48 89 c2             	mov    %rax,%rdx
+  8028d4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8028db:	01 00 00 
+  8028de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028e2:	83 e0 01             	and    $0x1,%eax
+  8028e5:	48 85 c0             	test   %rax,%rax
+  8028e8:	74 42                	je     80292c <fd_alloc+0xb0>
+  8028ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028ee:	48 c1 e8 15          	shr    $0x15,%rax
+  8028f2:	48 89 c2             	mov    %rax,%rdx
+  8028f5:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8028fc:	01 00 00 
+  8028ff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802903:	83 e0 01             	and    $0x1,%eax
+  802906:	48 85 c0             	test   %rax,%rax
+  802909:	74 21                	je     80292c <fd_alloc+0xb0>
+  80290b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80290f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802913:	48 89 c2             	mov    %rax,%rdx
+  802916:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80291d:	01 00 00 
+  802920:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802924:	83 e0 01             	and    $0x1,%eax
+  802927:	48 85 c0             	test   %rax,%rax
+  80292a:	75 12                	jne    80293e <fd_alloc+0xc2>
+      *fd_store = fd;
+  80292c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802930:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802934:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	eb 1e                	jmp    80295c <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  80293e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802942:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802946:	0f 8e 48 ff ff ff    	jle    802894 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80294c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802950:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802957:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+
+000000000080295e <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80295e:	55                   	push   %rbp
+  80295f:	48 89 e5             	mov    %rsp,%rbp
+  802962:	48 83 ec 20          	sub    $0x20,%rsp
+  802966:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802969:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80296d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802971:	78 06                	js     802979 <fd_lookup+0x1b>
+  802973:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802977:	7e 0a                	jle    802983 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802979:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80297e:	e9 af 00 00 00       	jmp    802a32 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802983:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802986:	c1 e0 0c             	shl    $0xc,%eax
+  802989:	48 98                	cltq
+  80298b:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802990:	48 01 d0             	add    %rdx,%rax
+  802993:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80299b:	48 c1 e8 27          	shr    $0x27,%rax
+  80299f:	48 89 c2             	mov    %rax,%rdx
+  8029a2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8029a9:	01 00 00 
+  8029ac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029b0:	83 e0 01             	and    $0x1,%eax
+  8029b3:	48 85 c0             	test   %rax,%rax
+  8029b6:	74 63                	je     802a1b <fd_lookup+0xbd>
+  8029b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029bc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029c0:	48 89 c2             	mov    %rax,%rdx
+  8029c3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8029ca:	01 00 00 
+  8029cd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029d1:	83 e0 01             	and    $0x1,%eax
+  8029d4:	48 85 c0             	test   %rax,%rax
+  8029d7:	74 42                	je     802a1b <fd_lookup+0xbd>
+  8029d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029dd:	48 c1 e8 15          	shr    $0x15,%rax
+  8029e1:	48 89 c2             	mov    %rax,%rdx
+  8029e4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8029eb:	01 00 00 
+  8029ee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029f2:	83 e0 01             	and    $0x1,%eax
+  8029f5:	48 85 c0             	test   %rax,%rax
+  8029f8:	74 21                	je     802a1b <fd_lookup+0xbd>
+  8029fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a02:	48 89 c2             	mov    %rax,%rdx
+  802a05:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a0c:	01 00 00 
+  802a0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a13:	83 e0 01             	and    $0x1,%eax
+  802a16:	48 85 c0             	test   %rax,%rax
+  802a19:	75 07                	jne    802a22 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802a1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a20:	eb 10                	jmp    802a32 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802a22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a2a:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a32:	c9                   	leave
+  802a33:	c3                   	ret
+
+0000000000802a34 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802a34:	55                   	push   %rbp
+  802a35:	48 89 e5             	mov    %rsp,%rbp
+  802a38:	48 83 ec 30          	sub    $0x30,%rsp
+  802a3c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a40:	89 f0                	mov    %esi,%eax
+  802a42:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802a45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a49:	48 89 c7             	mov    %rax,%rdi
+  802a4c:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+  802a58:	89 c2                	mov    %eax,%edx
+  802a5a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802a5e:	48 89 c6             	mov    %rax,%rsi
+  802a61:	89 d7                	mov    %edx,%edi
+  802a63:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802a6a:	00 00 00 
+  802a6d:	ff d0                	call   *%rax
+  802a6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a72:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a76:	78 0a                	js     802a82 <fd_close+0x4e>
+  802a78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a7c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802a80:	74 12                	je     802a94 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802a82:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802a86:	74 05                	je     802a8d <fd_close+0x59>
+  802a88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a8b:	eb 70                	jmp    802afd <fd_close+0xc9>
+  802a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a92:	eb 69                	jmp    802afd <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802a94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a98:	8b 00                	mov    (%rax),%eax
+  802a9a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802a9e:	48 89 d6             	mov    %rdx,%rsi
+  802aa1:	89 c7                	mov    %eax,%edi
+  802aa3:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+  802aaf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ab2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ab6:	78 2a                	js     802ae2 <fd_close+0xae>
+    if (dev->dev_close)
+  802ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802abc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802ac0:	48 85 c0             	test   %rax,%rax
+  802ac3:	74 16                	je     802adb <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802ac5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac9:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802acd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ad1:	48 89 c7             	mov    %rax,%rdi
+  802ad4:	ff d2                	call   *%rdx
+  802ad6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ad9:	eb 07                	jmp    802ae2 <fd_close+0xae>
+    else
+      r = 0;
+  802adb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802ae2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ae6:	48 89 c6             	mov    %rax,%rsi
+  802ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aee:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802af5:	00 00 00 
+  802af8:	ff d0                	call   *%rax
+  return r;
+  802afa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802afd:	c9                   	leave
+  802afe:	c3                   	ret
+
+0000000000802aff <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802aff:	55                   	push   %rbp
+  802b00:	48 89 e5             	mov    %rsp,%rbp
+  802b03:	48 83 ec 20          	sub    $0x20,%rsp
+  802b07:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802b0e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b15:	eb 3f                	jmp    802b56 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802b17:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802b1e:	00 00 00 
+  802b21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b24:	48 98                	cltq
+  802b26:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b2a:	8b 00                	mov    (%rax),%eax
+  802b2c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802b2f:	75 21                	jne    802b52 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802b31:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802b38:	00 00 00 
+  802b3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b3e:	48 98                	cltq
+  802b40:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b48:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b50:	eb 7f                	jmp    802bd1 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802b52:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b56:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802b5d:	00 00 00 
+  802b60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b63:	48 98                	cltq
+  802b65:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b69:	48 85 c0             	test   %rax,%rax
+  802b6c:	75 a9                	jne    802b17 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802b6e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802b75:	00 00 00 
+  802b78:	8b 40 04             	mov    0x4(%rax),%eax
+  802b7b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b80:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802b87:	00 00 00 
+  802b8a:	48 98                	cltq
+  802b8c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802b93:	48 01 d0             	add    %rdx,%rax
+  802b96:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802b9c:	8b 00                	mov    (%rax),%eax
+  802b9e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ba1:	89 c6                	mov    %eax,%esi
+  802ba3:	48 b8 58 63 80 00 00 	movabs $0x806358,%rax
+  802baa:	00 00 00 
+  802bad:	48 89 c7             	mov    %rax,%rdi
+  802bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb5:	48 b9 c9 03 80 00 00 	movabs $0x8003c9,%rcx
+  802bbc:	00 00 00 
+  802bbf:	ff d1                	call   *%rcx
+  *dev = 0;
+  802bc1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bc5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802bcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802bd1:	c9                   	leave
+  802bd2:	c3                   	ret
+
+0000000000802bd3 <close>:
+
+int
+close(int fdnum) {
+  802bd3:	55                   	push   %rbp
+  802bd4:	48 89 e5             	mov    %rsp,%rbp
+  802bd7:	48 83 ec 20          	sub    $0x20,%rsp
+  802bdb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bde:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802be2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802be5:	48 89 d6             	mov    %rdx,%rsi
+  802be8:	89 c7                	mov    %eax,%edi
+  802bea:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bf9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bfd:	79 05                	jns    802c04 <close+0x31>
+    return r;
+  802bff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c02:	eb 18                	jmp    802c1c <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802c04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c08:	be 01 00 00 00       	mov    $0x1,%esi
+  802c0d:	48 89 c7             	mov    %rax,%rdi
+  802c10:	48 b8 34 2a 80 00 00 	movabs $0x802a34,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+}
+  802c1c:	c9                   	leave
+  802c1d:	c3                   	ret
+
+0000000000802c1e <close_all>:
+
+void
+close_all(void) {
+  802c1e:	55                   	push   %rbp
+  802c1f:	48 89 e5             	mov    %rsp,%rbp
+  802c22:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802c26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802c2d:	eb 15                	jmp    802c44 <close_all+0x26>
+    close(i);
+  802c2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c32:	89 c7                	mov    %eax,%edi
+  802c34:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  802c3b:	00 00 00 
+  802c3e:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802c40:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c44:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802c48:	7e e5                	jle    802c2f <close_all+0x11>
+}
+  802c4a:	90                   	nop
+  802c4b:	90                   	nop
+  802c4c:	c9                   	leave
+  802c4d:	c3                   	ret
+
+0000000000802c4e <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802c4e:	55                   	push   %rbp
+  802c4f:	48 89 e5             	mov    %rsp,%rbp
+  802c52:	48 83 ec 40          	sub    $0x40,%rsp
+  802c56:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802c59:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802c5c:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802c60:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c63:	48 89 d6             	mov    %rdx,%rsi
+  802c66:	89 c7                	mov    %eax,%edi
+  802c68:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802c6f:	00 00 00 
+  802c72:	ff d0                	call   *%rax
+  802c74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c77:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c7b:	79 08                	jns    802c85 <dup+0x37>
+    return r;
+  802c7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c80:	e9 33 02 00 00       	jmp    802eb8 <dup+0x26a>
+  close(newfdnum);
+  802c85:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802c88:	89 c7                	mov    %eax,%edi
+  802c8a:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  802c91:	00 00 00 
+  802c94:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802c96:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802c99:	c1 e0 0c             	shl    $0xc,%eax
+  802c9c:	48 98                	cltq
+  802c9e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ca3:	48 01 d0             	add    %rdx,%rax
+  802ca6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802caa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cae:	48 89 c7             	mov    %rax,%rdi
+  802cb1:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  802cb8:	00 00 00 
+  802cbb:	ff d0                	call   *%rax
+  802cbd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cc5:	48 89 c7             	mov    %rax,%rdi
+  802cc8:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+  802cd4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802cd8:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802cdf:	00 
+  802ce0:	e9 19 01 00 00       	jmp    802dfe <dup+0x1b0>
+    off -= PGSIZE;
+  802ce5:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802cec:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ced:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802cf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cf5:	48 01 d0             	add    %rdx,%rax
+  802cf8:	48 c1 e8 27          	shr    $0x27,%rax
+  802cfc:	48 89 c2             	mov    %rax,%rdx
+  802cff:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d06:	01 00 00 
+  802d09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d0d:	83 e0 01             	and    $0x1,%eax
+  802d10:	48 85 c0             	test   %rax,%rax
+  802d13:	0f 84 e5 00 00 00    	je     802dfe <dup+0x1b0>
+  802d19:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d21:	48 01 d0             	add    %rdx,%rax
+  802d24:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d28:	48 89 c2             	mov    %rax,%rdx
+  802d2b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802d32:	01 00 00 
+  802d35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d39:	83 e0 01             	and    $0x1,%eax
+  802d3c:	48 85 c0             	test   %rax,%rax
+  802d3f:	0f 84 b9 00 00 00    	je     802dfe <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802d45:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d4d:	48 01 d0             	add    %rdx,%rax
+  802d50:	48 c1 e8 15          	shr    $0x15,%rax
+  802d54:	48 89 c2             	mov    %rax,%rdx
+  802d57:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802d5e:	01 00 00 
+  802d61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d65:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802d68:	48 85 c0             	test   %rax,%rax
+  802d6b:	0f 84 8d 00 00 00    	je     802dfe <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802d71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d79:	48 01 d0             	add    %rdx,%rax
+  802d7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d80:	48 89 c2             	mov    %rax,%rdx
+  802d83:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d8a:	01 00 00 
+  802d8d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d91:	83 e0 01             	and    $0x1,%eax
+  802d94:	48 85 c0             	test   %rax,%rax
+  802d97:	74 65                	je     802dfe <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802d99:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da1:	48 01 d0             	add    %rdx,%rax
+  802da4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802da8:	48 89 c2             	mov    %rax,%rdx
+  802dab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802db2:	01 00 00 
+  802db5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802db9:	25 07 0e 00 00       	and    $0xe07,%eax
+  802dbe:	89 c6                	mov    %eax,%esi
+  802dc0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc8:	48 01 c2             	add    %rax,%rdx
+  802dcb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802dcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd3:	48 01 c8             	add    %rcx,%rax
+  802dd6:	41 89 f0             	mov    %esi,%r8d
+  802dd9:	48 89 d1             	mov    %rdx,%rcx
+  802ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de1:	48 89 c6             	mov    %rax,%rsi
+  802de4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de9:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  802df0:	00 00 00 
+  802df3:	ff d0                	call   *%rax
+  802df5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802df8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dfc:	78 60                	js     802e5e <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802dfe:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802e03:	0f 85 dc fe ff ff    	jne    802ce5 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802e09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e0d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e11:	48 89 c2             	mov    %rax,%rdx
+  802e14:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e1b:	01 00 00 
+  802e1e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e22:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e27:	89 c1                	mov    %eax,%ecx
+  802e29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e2d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802e31:	41 89 c8             	mov    %ecx,%r8d
+  802e34:	48 89 d1             	mov    %rdx,%rcx
+  802e37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3c:	48 89 c6             	mov    %rax,%rsi
+  802e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e44:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  802e4b:	00 00 00 
+  802e4e:	ff d0                	call   *%rax
+  802e50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e57:	78 08                	js     802e61 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802e59:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802e5c:	eb 5a                	jmp    802eb8 <dup+0x26a>
+        goto err;
+  802e5e:	90                   	nop
+  802e5f:	eb 01                	jmp    802e62 <dup+0x214>
+    goto err;
+  802e61:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802e62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e66:	48 89 c6             	mov    %rax,%rsi
+  802e69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6e:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802e7a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802e81:	00 
+  802e82:	eb 27                	jmp    802eab <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802e84:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e8c:	48 01 d0             	add    %rdx,%rax
+  802e8f:	48 89 c6             	mov    %rax,%rsi
+  802e92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e97:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802ea3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802eaa:	00 
+  802eab:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802eb2:	00 
+  802eb3:	76 cf                	jbe    802e84 <dup+0x236>
+  return r;
+  802eb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+0000000000802eba <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	48 83 ec 40          	sub    $0x40,%rsp
+  802ec2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ec5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ec9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ecd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802ed1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ed4:	48 89 d6             	mov    %rdx,%rsi
+  802ed7:	89 c7                	mov    %eax,%edi
+  802ed9:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+  802ee5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ee8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eec:	78 24                	js     802f12 <read+0x58>
+  802eee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ef2:	8b 00                	mov    (%rax),%eax
+  802ef4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ef8:	48 89 d6             	mov    %rdx,%rsi
+  802efb:	89 c7                	mov    %eax,%edi
+  802efd:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f0c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f10:	79 0a                	jns    802f1c <read+0x62>
+    return r;
+  802f12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f15:	48 98                	cltq
+  802f17:	e9 9e 00 00 00       	jmp    802fba <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f20:	8b 40 08             	mov    0x8(%rax),%eax
+  802f23:	83 e0 03             	and    $0x3,%eax
+  802f26:	83 f8 01             	cmp    $0x1,%eax
+  802f29:	75 5c                	jne    802f87 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f2b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f32:	00 00 00 
+  802f35:	8b 40 04             	mov    0x4(%rax),%eax
+  802f38:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f3d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f44:	00 00 00 
+  802f47:	48 98                	cltq
+  802f49:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f50:	48 01 d0             	add    %rdx,%rax
+  802f53:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802f59:	8b 00                	mov    (%rax),%eax
+  802f5b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f5e:	89 c6                	mov    %eax,%esi
+  802f60:	48 b8 77 63 80 00 00 	movabs $0x806377,%rax
+  802f67:	00 00 00 
+  802f6a:	48 89 c7             	mov    %rax,%rdi
+  802f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f72:	48 b9 c9 03 80 00 00 	movabs $0x8003c9,%rcx
+  802f79:	00 00 00 
+  802f7c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802f7e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802f85:	eb 33                	jmp    802fba <read+0x100>
+  }
+  if (!dev->dev_read)
+  802f87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f8b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802f8f:	48 85 c0             	test   %rax,%rax
+  802f92:	75 09                	jne    802f9d <read+0xe3>
+    return -E_NOT_SUPP;
+  802f94:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802f9b:	eb 1d                	jmp    802fba <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802f9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fa1:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802fa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fa9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fad:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802fb1:	48 89 ce             	mov    %rcx,%rsi
+  802fb4:	48 89 c7             	mov    %rax,%rdi
+  802fb7:	41 ff d0             	call   *%r8
+}
+  802fba:	c9                   	leave
+  802fbb:	c3                   	ret
+
+0000000000802fbc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802fbc:	55                   	push   %rbp
+  802fbd:	48 89 e5             	mov    %rsp,%rbp
+  802fc0:	48 83 ec 30          	sub    $0x30,%rsp
+  802fc4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802fcb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802fcf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fd6:	eb 49                	jmp    803021 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802fd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fdb:	48 98                	cltq
+  802fdd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802fe1:	48 29 c2             	sub    %rax,%rdx
+  802fe4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fe7:	48 63 c8             	movslq %eax,%rcx
+  802fea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fee:	48 01 c1             	add    %rax,%rcx
+  802ff1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ff4:	48 89 ce             	mov    %rcx,%rsi
+  802ff7:	89 c7                	mov    %eax,%edi
+  802ff9:	48 b8 ba 2e 80 00 00 	movabs $0x802eba,%rax
+  803000:	00 00 00 
+  803003:	ff d0                	call   *%rax
+  803005:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803008:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80300c:	79 07                	jns    803015 <readn+0x59>
+      return m;
+  80300e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803011:	48 98                	cltq
+  803013:	eb 1f                	jmp    803034 <readn+0x78>
+    if (m == 0)
+  803015:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803019:	74 13                	je     80302e <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80301b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80301e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803021:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803024:	48 98                	cltq
+  803026:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80302a:	72 ac                	jb     802fd8 <readn+0x1c>
+  80302c:	eb 01                	jmp    80302f <readn+0x73>
+      break;
+  80302e:	90                   	nop
+  }
+  return tot;
+  80302f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803032:	48 98                	cltq
+}
+  803034:	c9                   	leave
+  803035:	c3                   	ret
+
+0000000000803036 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803036:	55                   	push   %rbp
+  803037:	48 89 e5             	mov    %rsp,%rbp
+  80303a:	48 83 ec 40          	sub    $0x40,%rsp
+  80303e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803041:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803045:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803049:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80304d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803050:	48 89 d6             	mov    %rdx,%rsi
+  803053:	89 c7                	mov    %eax,%edi
+  803055:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  80305c:	00 00 00 
+  80305f:	ff d0                	call   *%rax
+  803061:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803064:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803068:	78 24                	js     80308e <write+0x58>
+  80306a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80306e:	8b 00                	mov    (%rax),%eax
+  803070:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803074:	48 89 d6             	mov    %rdx,%rsi
+  803077:	89 c7                	mov    %eax,%edi
+  803079:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  803080:	00 00 00 
+  803083:	ff d0                	call   *%rax
+  803085:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803088:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80308c:	79 0a                	jns    803098 <write+0x62>
+    return r;
+  80308e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803091:	48 98                	cltq
+  803093:	e9 9d 00 00 00       	jmp    803135 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803098:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80309c:	8b 40 08             	mov    0x8(%rax),%eax
+  80309f:	83 e0 03             	and    $0x3,%eax
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	75 5c                	jne    803102 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030a6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030ad:	00 00 00 
+  8030b0:	8b 40 04             	mov    0x4(%rax),%eax
+  8030b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030b8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030bf:	00 00 00 
+  8030c2:	48 98                	cltq
+  8030c4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8030cb:	48 01 d0             	add    %rdx,%rax
+  8030ce:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8030d4:	8b 00                	mov    (%rax),%eax
+  8030d6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030d9:	89 c6                	mov    %eax,%esi
+  8030db:	48 b8 93 63 80 00 00 	movabs $0x806393,%rax
+  8030e2:	00 00 00 
+  8030e5:	48 89 c7             	mov    %rax,%rdi
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ed:	48 b9 c9 03 80 00 00 	movabs $0x8003c9,%rcx
+  8030f4:	00 00 00 
+  8030f7:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8030f9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803100:	eb 33                	jmp    803135 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803102:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803106:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80310a:	48 85 c0             	test   %rax,%rax
+  80310d:	75 09                	jne    803118 <write+0xe2>
+    return -E_NOT_SUPP;
+  80310f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803116:	eb 1d                	jmp    803135 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803118:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80311c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803124:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803128:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80312c:	48 89 ce             	mov    %rcx,%rsi
+  80312f:	48 89 c7             	mov    %rax,%rdi
+  803132:	41 ff d0             	call   *%r8
+}
+  803135:	c9                   	leave
+  803136:	c3                   	ret
+
+0000000000803137 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803137:	55                   	push   %rbp
+  803138:	48 89 e5             	mov    %rsp,%rbp
+  80313b:	48 83 ec 18          	sub    $0x18,%rsp
+  80313f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803142:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803145:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803149:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80314c:	48 89 d6             	mov    %rdx,%rsi
+  80314f:	89 c7                	mov    %eax,%edi
+  803151:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  803158:	00 00 00 
+  80315b:	ff d0                	call   *%rax
+  80315d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803160:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803164:	79 05                	jns    80316b <seek+0x34>
+    return r;
+  803166:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803169:	eb 0f                	jmp    80317a <seek+0x43>
+  fd->fd_offset = offset;
+  80316b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80316f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803172:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803175:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80317a:	c9                   	leave
+  80317b:	c3                   	ret
+
+000000000080317c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80317c:	55                   	push   %rbp
+  80317d:	48 89 e5             	mov    %rsp,%rbp
+  803180:	48 83 ec 30          	sub    $0x30,%rsp
+  803184:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803187:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80318a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80318e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803191:	48 89 d6             	mov    %rdx,%rsi
+  803194:	89 c7                	mov    %eax,%edi
+  803196:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031a9:	78 24                	js     8031cf <ftruncate+0x53>
+  8031ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031af:	8b 00                	mov    (%rax),%eax
+  8031b1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031b5:	48 89 d6             	mov    %rdx,%rsi
+  8031b8:	89 c7                	mov    %eax,%edi
+  8031ba:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+  8031c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031cd:	79 08                	jns    8031d7 <ftruncate+0x5b>
+    return r;
+  8031cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031d2:	e9 92 00 00 00       	jmp    803269 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031db:	8b 40 08             	mov    0x8(%rax),%eax
+  8031de:	83 e0 03             	and    $0x3,%eax
+  8031e1:	85 c0                	test   %eax,%eax
+  8031e3:	75 5a                	jne    80323f <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8031e5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8031ec:	00 00 00 
+  8031ef:	8b 40 04             	mov    0x4(%rax),%eax
+  8031f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031f7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8031fe:	00 00 00 
+  803201:	48 98                	cltq
+  803203:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80320a:	48 01 d0             	add    %rdx,%rax
+  80320d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803213:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803215:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803218:	89 c6                	mov    %eax,%esi
+  80321a:	48 b8 b0 63 80 00 00 	movabs $0x8063b0,%rax
+  803221:	00 00 00 
+  803224:	48 89 c7             	mov    %rax,%rdi
+  803227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322c:	48 b9 c9 03 80 00 00 	movabs $0x8003c9,%rcx
+  803233:	00 00 00 
+  803236:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803238:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80323d:	eb 2a                	jmp    803269 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80323f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803243:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803247:	48 85 c0             	test   %rax,%rax
+  80324a:	75 07                	jne    803253 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80324c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803251:	eb 16                	jmp    803269 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803253:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803257:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80325b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80325f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803262:	89 d6                	mov    %edx,%esi
+  803264:	48 89 c7             	mov    %rax,%rdi
+  803267:	ff d1                	call   *%rcx
+}
+  803269:	c9                   	leave
+  80326a:	c3                   	ret
+
+000000000080326b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80326b:	55                   	push   %rbp
+  80326c:	48 89 e5             	mov    %rsp,%rbp
+  80326f:	48 83 ec 30          	sub    $0x30,%rsp
+  803273:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803276:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80327a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80327e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803281:	48 89 d6             	mov    %rdx,%rsi
+  803284:	89 c7                	mov    %eax,%edi
+  803286:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  80328d:	00 00 00 
+  803290:	ff d0                	call   *%rax
+  803292:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803295:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803299:	78 24                	js     8032bf <fstat+0x54>
+  80329b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329f:	8b 00                	mov    (%rax),%eax
+  8032a1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032a5:	48 89 d6             	mov    %rdx,%rsi
+  8032a8:	89 c7                	mov    %eax,%edi
+  8032aa:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  8032b1:	00 00 00 
+  8032b4:	ff d0                	call   *%rax
+  8032b6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032bd:	79 05                	jns    8032c4 <fstat+0x59>
+    return r;
+  8032bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032c2:	eb 5e                	jmp    803322 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8032c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032c8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032cc:	48 85 c0             	test   %rax,%rax
+  8032cf:	75 07                	jne    8032d8 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8032d1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8032d6:	eb 4a                	jmp    803322 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8032d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032dc:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8032df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032e3:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8032ea:	00 00 00 
+  stat->st_isdir   = 0;
+  8032ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032f1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8032f8:	00 00 00 
+  stat->st_dev     = dev;
+  8032fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803303:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80330a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80330e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803316:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80331a:	48 89 d6             	mov    %rdx,%rsi
+  80331d:	48 89 c7             	mov    %rax,%rdi
+  803320:	ff d1                	call   *%rcx
+}
+  803322:	c9                   	leave
+  803323:	c3                   	ret
+
+0000000000803324 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803324:	55                   	push   %rbp
+  803325:	48 89 e5             	mov    %rsp,%rbp
+  803328:	48 83 ec 10          	sub    $0x10,%rsp
+  80332c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803330:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803334:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803338:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80333e:	83 f8 20             	cmp    $0x20,%eax
+  803341:	75 07                	jne    80334a <pollwait_key+0x26>
+    return -E_INVAL;
+  803343:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803348:	eb 5f                	jmp    8033a9 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80334a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80334e:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803358:	48 63 d2             	movslq %edx,%rdx
+  80335b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80335f:	48 01 c2             	add    %rax,%rdx
+  803362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803366:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80336d:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803373:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803377:	8b 00                	mov    (%rax),%eax
+  803379:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80337d:	48 63 c9             	movslq %ecx,%rcx
+  803380:	48 c1 e1 04          	shl    $0x4,%rcx
+  803384:	48 01 ca             	add    %rcx,%rdx
+  803387:	48 83 c2 08          	add    $0x8,%rdx
+  80338b:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80338d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803391:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803397:	8d 50 01             	lea    0x1(%rax),%edx
+  80339a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339e:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8033a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a9:	c9                   	leave
+  8033aa:	c3                   	ret
+
+00000000008033ab <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8033ab:	55                   	push   %rbp
+  8033ac:	48 89 e5             	mov    %rsp,%rbp
+  8033af:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8033b6:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8033bd:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8033c3:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8033ca:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8033d1:	00 
+  int i, r, ready, ipc = 0;
+  8033d2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8033d9:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8033e0:	00 
+  8033e1:	74 45                	je     803428 <poll+0x7d>
+  8033e3:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8033ea:	ff 
+  8033eb:	74 3b                	je     803428 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8033ed:	48 b8 21 56 80 00 00 	movabs $0x805621,%rax
+  8033f4:	00 00 00 
+  8033f7:	ff d0                	call   *%rax
+  8033f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8033fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803401:	48 f7 d0             	not    %rax
+  803404:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80340b:	73 10                	jae    80341d <poll+0x72>
+  80340d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803411:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803418:	48 01 d0             	add    %rdx,%rax
+  80341b:	eb 07                	jmp    803424 <poll+0x79>
+  80341d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803424:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803428:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80342f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803436:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80343d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803444:	e9 46 02 00 00       	jmp    80368f <poll+0x2e4>
+      fds[i].revents = 0;
+  803449:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80344c:	48 63 d0             	movslq %eax,%rdx
+  80344f:	48 89 d0             	mov    %rdx,%rax
+  803452:	48 01 c0             	add    %rax,%rax
+  803455:	48 01 d0             	add    %rdx,%rax
+  803458:	48 c1 e0 02          	shl    $0x2,%rax
+  80345c:	48 89 c2             	mov    %rax,%rdx
+  80345f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803466:	48 01 d0             	add    %rdx,%rax
+  803469:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803470:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803473:	48 63 d0             	movslq %eax,%rdx
+  803476:	48 89 d0             	mov    %rdx,%rax
+  803479:	48 01 c0             	add    %rax,%rax
+  80347c:	48 01 d0             	add    %rdx,%rax
+  80347f:	48 c1 e0 02          	shl    $0x2,%rax
+  803483:	48 89 c2             	mov    %rax,%rdx
+  803486:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80348d:	48 01 d0             	add    %rdx,%rax
+  803490:	8b 00                	mov    (%rax),%eax
+  803492:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803495:	75 62                	jne    8034f9 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803497:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80349a:	48 63 d0             	movslq %eax,%rdx
+  80349d:	48 89 d0             	mov    %rdx,%rax
+  8034a0:	48 01 c0             	add    %rax,%rax
+  8034a3:	48 01 d0             	add    %rdx,%rax
+  8034a6:	48 c1 e0 02          	shl    $0x2,%rax
+  8034aa:	48 89 c2             	mov    %rax,%rdx
+  8034ad:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034b4:	48 01 d0             	add    %rdx,%rax
+  8034b7:	8b 40 04             	mov    0x4(%rax),%eax
+  8034ba:	83 e0 01             	and    $0x1,%eax
+  8034bd:	85 c0                	test   %eax,%eax
+  8034bf:	0f 84 9b 01 00 00    	je     803660 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8034c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034c8:	48 63 d0             	movslq %eax,%rdx
+  8034cb:	48 89 d0             	mov    %rdx,%rax
+  8034ce:	48 01 c0             	add    %rax,%rax
+  8034d1:	48 01 d0             	add    %rdx,%rax
+  8034d4:	48 c1 e0 02          	shl    $0x2,%rax
+  8034d8:	48 89 c2             	mov    %rax,%rdx
+  8034db:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034e2:	48 01 c2             	add    %rax,%rdx
+  8034e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034e8:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8034eb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8034ee:	83 c8 04             	or     $0x4,%eax
+  8034f1:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8034f4:	e9 67 01 00 00       	jmp    803660 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8034f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034fc:	48 63 d0             	movslq %eax,%rdx
+  8034ff:	48 89 d0             	mov    %rdx,%rax
+  803502:	48 01 c0             	add    %rax,%rax
+  803505:	48 01 d0             	add    %rdx,%rax
+  803508:	48 c1 e0 02          	shl    $0x2,%rax
+  80350c:	48 89 c2             	mov    %rax,%rdx
+  80350f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803516:	48 01 d0             	add    %rdx,%rax
+  803519:	8b 00                	mov    (%rax),%eax
+  80351b:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803522:	48 89 d6             	mov    %rdx,%rsi
+  803525:	89 c7                	mov    %eax,%edi
+  803527:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  80352e:	00 00 00 
+  803531:	ff d0                	call   *%rax
+  803533:	85 c0                	test   %eax,%eax
+  803535:	78 25                	js     80355c <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803537:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80353e:	8b 00                	mov    (%rax),%eax
+  803540:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803547:	48 89 d6             	mov    %rdx,%rsi
+  80354a:	89 c7                	mov    %eax,%edi
+  80354c:	48 b8 ff 2a 80 00 00 	movabs $0x802aff,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803558:	85 c0                	test   %eax,%eax
+  80355a:	79 2c                	jns    803588 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80355c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80355f:	48 63 d0             	movslq %eax,%rdx
+  803562:	48 89 d0             	mov    %rdx,%rax
+  803565:	48 01 c0             	add    %rax,%rax
+  803568:	48 01 d0             	add    %rdx,%rax
+  80356b:	48 c1 e0 02          	shl    $0x2,%rax
+  80356f:	48 89 c2             	mov    %rax,%rdx
+  803572:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803579:	48 01 d0             	add    %rdx,%rax
+  80357c:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803583:	e9 d8 00 00 00       	jmp    803660 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803588:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80358f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803593:	48 85 c0             	test   %rax,%rax
+  803596:	74 7d                	je     803615 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803598:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80359f:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8035a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035a6:	48 63 d0             	movslq %eax,%rdx
+  8035a9:	48 89 d0             	mov    %rdx,%rax
+  8035ac:	48 01 c0             	add    %rax,%rax
+  8035af:	48 01 d0             	add    %rdx,%rax
+  8035b2:	48 c1 e0 02          	shl    $0x2,%rax
+  8035b6:	48 89 c2             	mov    %rax,%rdx
+  8035b9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035c0:	48 01 d0             	add    %rdx,%rax
+  8035c3:	8b 48 04             	mov    0x4(%rax),%ecx
+  8035c6:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8035cd:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8035d4:	89 ce                	mov    %ecx,%esi
+  8035d6:	48 89 c7             	mov    %rax,%rdi
+  8035d9:	41 ff d0             	call   *%r8
+  8035dc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8035df:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035e3:	79 08                	jns    8035ed <poll+0x242>
+          return r;
+  8035e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035e8:	e9 45 01 00 00       	jmp    803732 <poll+0x387>
+        fds[i].revents = r;
+  8035ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035f0:	48 63 d0             	movslq %eax,%rdx
+  8035f3:	48 89 d0             	mov    %rdx,%rax
+  8035f6:	48 01 c0             	add    %rax,%rax
+  8035f9:	48 01 d0             	add    %rdx,%rax
+  8035fc:	48 c1 e0 02          	shl    $0x2,%rax
+  803600:	48 89 c2             	mov    %rax,%rdx
+  803603:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80360a:	48 01 c2             	add    %rax,%rdx
+  80360d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803610:	89 42 08             	mov    %eax,0x8(%rdx)
+  803613:	eb 4b                	jmp    803660 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803615:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803618:	48 63 d0             	movslq %eax,%rdx
+  80361b:	48 89 d0             	mov    %rdx,%rax
+  80361e:	48 01 c0             	add    %rax,%rax
+  803621:	48 01 d0             	add    %rdx,%rax
+  803624:	48 c1 e0 02          	shl    $0x2,%rax
+  803628:	48 89 c2             	mov    %rax,%rdx
+  80362b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803632:	48 01 d0             	add    %rdx,%rax
+  803635:	8b 48 04             	mov    0x4(%rax),%ecx
+  803638:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80363b:	48 63 d0             	movslq %eax,%rdx
+  80363e:	48 89 d0             	mov    %rdx,%rax
+  803641:	48 01 c0             	add    %rax,%rax
+  803644:	48 01 d0             	add    %rdx,%rax
+  803647:	48 c1 e0 02          	shl    $0x2,%rax
+  80364b:	48 89 c2             	mov    %rax,%rdx
+  80364e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803655:	48 01 d0             	add    %rdx,%rax
+  803658:	83 e1 03             	and    $0x3,%ecx
+  80365b:	89 ca                	mov    %ecx,%edx
+  80365d:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803660:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803663:	48 63 d0             	movslq %eax,%rdx
+  803666:	48 89 d0             	mov    %rdx,%rax
+  803669:	48 01 c0             	add    %rax,%rax
+  80366c:	48 01 d0             	add    %rdx,%rax
+  80366f:	48 c1 e0 02          	shl    $0x2,%rax
+  803673:	48 89 c2             	mov    %rax,%rdx
+  803676:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80367d:	48 01 d0             	add    %rdx,%rax
+  803680:	8b 40 08             	mov    0x8(%rax),%eax
+  803683:	85 c0                	test   %eax,%eax
+  803685:	74 04                	je     80368b <poll+0x2e0>
+        ready++;
+  803687:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80368b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80368f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803692:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803698:	0f 8c ab fd ff ff    	jl     803449 <poll+0x9e>
+    }
+    if (ready)
+  80369e:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8036a2:	74 08                	je     8036ac <poll+0x301>
+      return ready;
+  8036a4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8036a7:	e9 86 00 00 00       	jmp    803732 <poll+0x387>
+
+    if (deadline) {
+  8036ac:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8036b1:	74 30                	je     8036e3 <poll+0x338>
+      now     = vsys_clock_ns();
+  8036b3:	48 b8 21 56 80 00 00 	movabs $0x805621,%rax
+  8036ba:	00 00 00 
+  8036bd:	ff d0                	call   *%rax
+  8036bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8036c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036c7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8036cb:	73 0a                	jae    8036d7 <poll+0x32c>
+  8036cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036d1:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8036d5:	eb 05                	jmp    8036dc <poll+0x331>
+  8036d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036dc:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8036e3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8036e6:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8036e9:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8036f0:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8036f7:	48 89 c7             	mov    %rax,%rdi
+  8036fa:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803709:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80370d:	75 07                	jne    803716 <poll+0x36b>
+      return 0;
+  80370f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803714:	eb 1c                	jmp    803732 <poll+0x387>
+    if (r < 0)
+  803716:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80371a:	79 05                	jns    803721 <poll+0x376>
+      return r;
+  80371c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80371f:	eb 11                	jmp    803732 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803721:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803724:	c1 f8 02             	sar    $0x2,%eax
+  803727:	83 e0 01             	and    $0x1,%eax
+  80372a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80372d:	e9 f6 fc ff ff       	jmp    803428 <poll+0x7d>
+  }
+}
+  803732:	c9                   	leave
+  803733:	c3                   	ret
+
+0000000000803734 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803734:	55                   	push   %rbp
+  803735:	48 89 e5             	mov    %rsp,%rbp
+  803738:	48 83 ec 20          	sub    $0x20,%rsp
+  80373c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803740:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803748:	be 00 00 00 00       	mov    $0x0,%esi
+  80374d:	48 89 c7             	mov    %rax,%rdi
+  803750:	48 b8 22 38 80 00 00 	movabs $0x803822,%rax
+  803757:	00 00 00 
+  80375a:	ff d0                	call   *%rax
+  80375c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80375f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803763:	79 05                	jns    80376a <stat+0x36>
+    return fd;
+  803765:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803768:	eb 2f                	jmp    803799 <stat+0x65>
+  r = fstat(fd, stat);
+  80376a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80376e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803771:	48 89 d6             	mov    %rdx,%rsi
+  803774:	89 c7                	mov    %eax,%edi
+  803776:	48 b8 6b 32 80 00 00 	movabs $0x80326b,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+  803782:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803785:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803788:	89 c7                	mov    %eax,%edi
+  80378a:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+  return r;
+  803796:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803799:	c9                   	leave
+  80379a:	c3                   	ret
+
+000000000080379b <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80379b:	55                   	push   %rbp
+  80379c:	48 89 e5             	mov    %rsp,%rbp
+  80379f:	48 83 ec 10          	sub    $0x10,%rsp
+  8037a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8037a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8037aa:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8037b1:	00 00 00 
+  8037b4:	8b 00                	mov    (%rax),%eax
+  8037b6:	85 c0                	test   %eax,%eax
+  8037b8:	75 1d                	jne    8037d7 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8037ba:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037bf:	48 b8 3c 5c 80 00 00 	movabs $0x805c3c,%rax
+  8037c6:	00 00 00 
+  8037c9:	ff d0                	call   *%rax
+  8037cb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8037d2:	00 00 00 
+  8037d5:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8037d7:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8037de:	00 00 00 
+  8037e1:	8b 00                	mov    (%rax),%eax
+  8037e3:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8037e6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8037eb:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8037f2:	00 00 00 
+  8037f5:	89 c7                	mov    %eax,%edi
+  8037f7:	48 b8 8f 5b 80 00 00 	movabs $0x805b8f,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803803:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80380c:	48 89 c6             	mov    %rax,%rsi
+  80380f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803814:	48 b8 12 5a 80 00 00 	movabs $0x805a12,%rax
+  80381b:	00 00 00 
+  80381e:	ff d0                	call   *%rax
+}
+  803820:	c9                   	leave
+  803821:	c3                   	ret
+
+0000000000803822 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803822:	55                   	push   %rbp
+  803823:	48 89 e5             	mov    %rsp,%rbp
+  803826:	48 83 ec 20          	sub    $0x20,%rsp
+  80382a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80382e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803831:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803835:	48 89 c7             	mov    %rax,%rdi
+  803838:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+  803844:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803849:	7e 0a                	jle    803855 <open+0x33>
+    return -E_BAD_PATH;
+  80384b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803850:	e9 a8 00 00 00       	jmp    8038fd <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803855:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803859:	48 89 c7             	mov    %rax,%rdi
+  80385c:	48 b8 7c 28 80 00 00 	movabs $0x80287c,%rax
+  803863:	00 00 00 
+  803866:	ff d0                	call   *%rax
+  803868:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80386b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80386f:	79 08                	jns    803879 <open+0x57>
+    return r;
+  803871:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803874:	e9 84 00 00 00       	jmp    8038fd <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803879:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80387d:	48 89 c6             	mov    %rax,%rsi
+  803880:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803887:	00 00 00 
+  80388a:	48 89 c7             	mov    %rax,%rdi
+  80388d:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  803894:	00 00 00 
+  803897:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803899:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8038a0:	00 00 00 
+  8038a3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038a6:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8038ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038b0:	48 89 c6             	mov    %rax,%rsi
+  8038b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038b8:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+  8038c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038cb:	79 1d                	jns    8038ea <open+0xc8>
+    fd_close(fd, 0);
+  8038cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d6:	48 89 c7             	mov    %rax,%rdi
+  8038d9:	48 b8 34 2a 80 00 00 	movabs $0x802a34,%rax
+  8038e0:	00 00 00 
+  8038e3:	ff d0                	call   *%rax
+    return r;
+  8038e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038e8:	eb 13                	jmp    8038fd <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8038ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038ee:	48 89 c7             	mov    %rax,%rdi
+  8038f1:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  8038f8:	00 00 00 
+  8038fb:	ff d0                	call   *%rax
+}
+  8038fd:	c9                   	leave
+  8038fe:	c3                   	ret
+
+00000000008038ff <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8038ff:	55                   	push   %rbp
+  803900:	48 89 e5             	mov    %rsp,%rbp
+  803903:	48 83 ec 10          	sub    $0x10,%rsp
+  803907:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80390b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80390f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803912:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803919:	00 00 00 
+  80391c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  80391e:	be 00 00 00 00       	mov    $0x0,%esi
+  803923:	bf 06 00 00 00       	mov    $0x6,%edi
+  803928:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+}
+  803934:	c9                   	leave
+  803935:	c3                   	ret
+
+0000000000803936 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803936:	55                   	push   %rbp
+  803937:	48 89 e5             	mov    %rsp,%rbp
+  80393a:	48 83 ec 30          	sub    $0x30,%rsp
+  80393e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803942:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803946:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80394a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80394f:	74 07                	je     803958 <devfile_read+0x22>
+  803951:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803956:	75 0a                	jne    803962 <devfile_read+0x2c>
+  return E_INVAL;
+  803958:	b8 03 00 00 00       	mov    $0x3,%eax
+  80395d:	e9 b4 00 00 00       	jmp    803a16 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803962:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803969:	00 
+  while (n) {
+  80396a:	e9 98 00 00 00       	jmp    803a07 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80396f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803973:	8b 40 0c             	mov    0xc(%rax),%eax
+  803976:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80397d:	00 00 00 
+  803980:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803982:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803989:	00 00 00 
+  80398c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803990:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803994:	be 00 00 00 00       	mov    $0x0,%esi
+  803999:	bf 03 00 00 00       	mov    $0x3,%edi
+  80399e:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+  8039aa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8039ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8039b1:	7f 13                	jg     8039c6 <devfile_read+0x90>
+      return res ? res : res0;
+  8039b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8039b7:	74 07                	je     8039c0 <devfile_read+0x8a>
+  8039b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039bc:	48 98                	cltq
+  8039be:	eb 56                	jmp    803a16 <devfile_read+0xe0>
+  8039c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039c4:	eb 50                	jmp    803a16 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8039c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039c9:	48 63 d0             	movslq %eax,%rdx
+  8039cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d0:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8039d7:	00 00 00 
+  8039da:	48 89 ce             	mov    %rcx,%rsi
+  8039dd:	48 89 c7             	mov    %rax,%rdi
+  8039e0:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  8039e7:	00 00 00 
+  8039ea:	ff d0                	call   *%rax
+
+    buf += res;
+  8039ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039ef:	48 98                	cltq
+  8039f1:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8039f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039f8:	48 98                	cltq
+  8039fa:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8039fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a01:	48 98                	cltq
+  803a03:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803a07:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803a0c:	0f 85 5d ff ff ff    	jne    80396f <devfile_read+0x39>
+  }
+
+  return res0;
+  803a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803a16:	c9                   	leave
+  803a17:	c3                   	ret
+
+0000000000803a18 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803a18:	55                   	push   %rbp
+  803a19:	48 89 e5             	mov    %rsp,%rbp
+  803a1c:	48 83 ec 50          	sub    $0x50,%rsp
+  803a20:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a28:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803a2c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803a31:	74 07                	je     803a3a <devfile_write+0x22>
+  803a33:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803a38:	75 0a                	jne    803a44 <devfile_write+0x2c>
+  return E_INVAL;
+  803a3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  803a3f:	e9 c9 00 00 00       	jmp    803b0d <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803a44:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a4b:	00 
+
+  while (n) {
+  803a4c:	e9 ad 00 00 00       	jmp    803afe <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803a51:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a55:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803a59:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803a60:	00 
+  803a61:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a69:	48 39 c2             	cmp    %rax,%rdx
+  803a6c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803a74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a7c:	48 89 c6             	mov    %rax,%rsi
+  803a7f:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  803a86:	00 00 00 
+  803a89:	48 89 c7             	mov    %rax,%rdi
+  803a8c:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803a98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a9c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a9f:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803aa6:	00 00 00 
+  803aa9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803aab:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ab2:	00 00 00 
+  803ab5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ab9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803abd:	be 00 00 00 00       	mov    $0x0,%esi
+  803ac2:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ac7:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803ace:	00 00 00 
+  803ad1:	ff d0                	call   *%rax
+  803ad3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803ad6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803ada:	79 07                	jns    803ae3 <devfile_write+0xcb>
+      return res;
+  803adc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803adf:	48 98                	cltq
+  803ae1:	eb 2a                	jmp    803b0d <devfile_write+0xf5>
+
+    buf += res;
+  803ae3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ae6:	48 98                	cltq
+  803ae8:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803aec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803aef:	48 98                	cltq
+  803af1:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803af5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803af8:	48 98                	cltq
+  803afa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803afe:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803b03:	0f 85 48 ff ff ff    	jne    803a51 <devfile_write+0x39>
+  }
+
+  return res0;
+  803b09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803b0d:	c9                   	leave
+  803b0e:	c3                   	ret
+
+0000000000803b0f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803b0f:	55                   	push   %rbp
+  803b10:	48 89 e5             	mov    %rsp,%rbp
+  803b13:	48 83 ec 20          	sub    $0x20,%rsp
+  803b17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b1b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b23:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b26:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b2d:	00 00 00 
+  803b30:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803b32:	be 00 00 00 00       	mov    $0x0,%esi
+  803b37:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b3c:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803b43:	00 00 00 
+  803b46:	ff d0                	call   *%rax
+  803b48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b4f:	79 05                	jns    803b56 <devfile_stat+0x47>
+    return r;
+  803b51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b54:	eb 59                	jmp    803baf <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b5a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803b61:	00 00 00 
+  803b64:	48 89 d6             	mov    %rdx,%rsi
+  803b67:	48 89 c7             	mov    %rax,%rdi
+  803b6a:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803b76:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803b7d:	00 00 00 
+  803b80:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803b86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b8a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b90:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803b97:	00 00 00 
+  803b9a:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803ba0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ba4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803baa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803baf:	c9                   	leave
+  803bb0:	c3                   	ret
+
+0000000000803bb1 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803bb1:	55                   	push   %rbp
+  803bb2:	48 89 e5             	mov    %rsp,%rbp
+  803bb5:	48 83 ec 10          	sub    $0x10,%rsp
+  803bb9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803bbd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803bc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bc4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bc7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bce:	00 00 00 
+  803bd1:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803bd3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803bda:	00 00 00 
+  803bdd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803be0:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803be3:	be 00 00 00 00       	mov    $0x0,%esi
+  803be8:	bf 02 00 00 00       	mov    $0x2,%edi
+  803bed:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803bf4:	00 00 00 
+  803bf7:	ff d0                	call   *%rax
+}
+  803bf9:	c9                   	leave
+  803bfa:	c3                   	ret
+
+0000000000803bfb <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+  803bff:	48 83 ec 18          	sub    $0x18,%rsp
+  803c03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c07:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803c0a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803c0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c11:	83 e0 03             	and    $0x3,%eax
+}
+  803c14:	c9                   	leave
+  803c15:	c3                   	ret
+
+0000000000803c16 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803c16:	55                   	push   %rbp
+  803c17:	48 89 e5             	mov    %rsp,%rbp
+  803c1a:	48 83 ec 10          	sub    $0x10,%rsp
+  803c1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803c22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c26:	48 89 c7             	mov    %rax,%rdi
+  803c29:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+  803c35:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803c3a:	7e 07                	jle    803c43 <remove+0x2d>
+    return -E_BAD_PATH;
+  803c3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803c41:	eb 36                	jmp    803c79 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c47:	48 89 c6             	mov    %rax,%rsi
+  803c4a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803c51:	00 00 00 
+  803c54:	48 89 c7             	mov    %rax,%rdi
+  803c57:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803c63:	be 00 00 00 00       	mov    $0x0,%esi
+  803c68:	bf 07 00 00 00       	mov    $0x7,%edi
+  803c6d:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803c74:	00 00 00 
+  803c77:	ff d0                	call   *%rax
+}
+  803c79:	c9                   	leave
+  803c7a:	c3                   	ret
+
+0000000000803c7b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803c7b:	55                   	push   %rbp
+  803c7c:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803c7f:	be 00 00 00 00       	mov    $0x0,%esi
+  803c84:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c89:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803c90:	00 00 00 
+  803c93:	ff d0                	call   *%rax
+}
+  803c95:	5d                   	pop    %rbp
+  803c96:	c3                   	ret
+
+0000000000803c97 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	48 83 ec 20          	sub    $0x20,%rsp
+  803c9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803ca3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ca8:	bf 09 00 00 00       	mov    $0x9,%edi
+  803cad:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803cb4:	00 00 00 
+  803cb7:	ff d0                	call   *%rax
+  803cb9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cbc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cc0:	79 05                	jns    803cc7 <fs_stats+0x30>
+    return r;
+  803cc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cc5:	eb 2a                	jmp    803cf1 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803cc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ccb:	ba 68 00 00 00       	mov    $0x68,%edx
+  803cd0:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  803cd7:	00 00 00 
+  803cda:	48 89 ce             	mov    %rcx,%rsi
+  803cdd:	48 89 c7             	mov    %rax,%rdi
+  803ce0:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803ce7:	00 00 00 
+  803cea:	ff d0                	call   *%rax
+  return 0;
+  803cec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cf1:	c9                   	leave
+  803cf2:	c3                   	ret
+
+0000000000803cf3 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803cf3:	55                   	push   %rbp
+  803cf4:	48 89 e5             	mov    %rsp,%rbp
+  803cf7:	48 83 ec 10          	sub    $0x10,%rsp
+  803cfb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803cfe:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d05:	00 00 00 
+  803d08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d0b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803d0d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d12:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d17:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803d1e:	00 00 00 
+  803d21:	ff d0                	call   *%rax
+}
+  803d23:	c9                   	leave
+  803d24:	c3                   	ret
+
+0000000000803d25 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803d25:	55                   	push   %rbp
+  803d26:	48 89 e5             	mov    %rsp,%rbp
+  803d29:	48 83 ec 10          	sub    $0x10,%rsp
+  803d2d:	89 f8                	mov    %edi,%eax
+  803d2f:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803d32:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803d36:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803d3d:	00 00 00 
+  803d40:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803d42:	be 00 00 00 00       	mov    $0x0,%esi
+  803d47:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803d4c:	48 b8 9b 37 80 00 00 	movabs $0x80379b,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+}
+  803d58:	c9                   	leave
+  803d59:	c3                   	ret
+
+0000000000803d5a <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  803d5a:	55                   	push   %rbp
+  803d5b:	48 89 e5             	mov    %rsp,%rbp
+  803d5e:	53                   	push   %rbx
+  803d5f:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  803d66:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  803d6d:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  803d74:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d80:	48 89 c7             	mov    %rax,%rdi
+  803d83:	48 b8 22 38 80 00 00 	movabs $0x803822,%rax
+  803d8a:	00 00 00 
+  803d8d:	ff d0                	call   *%rax
+  803d8f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d92:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803d96:	79 08                	jns    803da0 <spawn+0x46>
+    return r;
+  803d98:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803d9b:	e9 35 04 00 00       	jmp    8041d5 <spawn+0x47b>
+  fd = r;
+  803da0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803da3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  803da6:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  803dad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  803db1:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  803db8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803dbb:	ba 00 02 00 00       	mov    $0x200,%edx
+  803dc0:	48 89 ce             	mov    %rcx,%rsi
+  803dc3:	89 c7                	mov    %eax,%edi
+  803dc5:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  803dcc:	00 00 00 
+  803dcf:	ff d0                	call   *%rax
+  803dd1:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  803dd7:	75 0d                	jne    803de6 <spawn+0x8c>
+  803dd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ddd:	8b 00                	mov    (%rax),%eax
+  803ddf:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  803de4:	74 46                	je     803e2c <spawn+0xd2>
+    close(fd);
+  803de6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803de9:	89 c7                	mov    %eax,%edi
+  803deb:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  803df2:	00 00 00 
+  803df5:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803df7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dfb:	8b 00                	mov    (%rax),%eax
+  803dfd:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803e02:	89 c6                	mov    %eax,%esi
+  803e04:	48 b8 d8 63 80 00 00 	movabs $0x8063d8,%rax
+  803e0b:	00 00 00 
+  803e0e:	48 89 c7             	mov    %rax,%rdi
+  803e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e16:	48 b9 c9 03 80 00 00 	movabs $0x8003c9,%rcx
+  803e1d:	00 00 00 
+  803e20:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  803e22:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  803e27:	e9 a9 03 00 00       	jmp    8041d5 <spawn+0x47b>
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  803e2c:	b8 09 00 00 00       	mov    $0x9,%eax
+  803e31:	cd 30                	int    $0x30
+  803e33:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  803e36:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  803e39:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803e3c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803e40:	79 08                	jns    803e4a <spawn+0xf0>
+    return r;
+  803e42:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803e45:	e9 8b 03 00 00       	jmp    8041d5 <spawn+0x47b>
+  child = r;
+  803e4a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803e4d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  803e50:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803e53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e5f:	00 00 00 
+  803e62:	48 98                	cltq
+  803e64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803e6b:	48 01 d0             	add    %rdx,%rax
+  803e6e:	48 8b 08             	mov    (%rax),%rcx
+  803e71:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  803e75:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  803e7c:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  803e83:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  803e87:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  803e8b:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  803e92:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  803e99:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  803e9d:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  803ea1:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  803ea8:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  803eaf:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803eb3:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  803eb7:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  803ebe:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  803ec5:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  803ec9:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  803ecd:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  803ed4:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  803edb:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  803edf:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  803ee3:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  803eea:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  803ef1:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  803ef5:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  803ef9:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  803f00:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  803f07:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  803f0b:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  803f0f:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  803f16:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  803f1d:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  803f24:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  803f2b:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  803f32:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  803f39:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  803f40:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  803f47:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  803f4e:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  803f55:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  803f5c:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  803f63:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  803f6a:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  803f71:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  803f78:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  803f7f:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  803f86:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  803f8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f91:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803f95:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  803f9c:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  803fa3:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  803fa9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  803fad:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803fb1:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  803fb8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803fbb:	48 89 ce             	mov    %rcx,%rsi
+  803fbe:	89 c7                	mov    %eax,%edi
+  803fc0:	48 b8 3d 44 80 00 00 	movabs $0x80443d,%rax
+  803fc7:	00 00 00 
+  803fca:	ff d0                	call   *%rax
+  803fcc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803fcf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803fd3:	79 08                	jns    803fdd <spawn+0x283>
+    return r;
+  803fd5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803fd8:	e9 f8 01 00 00       	jmp    8041d5 <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803fdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fe1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803fe5:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  803fec:	48 01 d0             	add    %rdx,%rax
+  803fef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  803ff3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803ffa:	e9 80 00 00 00       	jmp    80407f <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  803fff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804003:	8b 00                	mov    (%rax),%eax
+  804005:	83 f8 01             	cmp    $0x1,%eax
+  804008:	75 6b                	jne    804075 <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  80400a:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  804011:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804015:	8b 40 04             	mov    0x4(%rax),%eax
+  804018:	83 e0 02             	and    $0x2,%eax
+  80401b:	85 c0                	test   %eax,%eax
+  80401d:	74 04                	je     804023 <spawn+0x2c9>
+      perm |= PTE_W;
+  80401f:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  804023:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804027:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80402b:	41 89 c1             	mov    %eax,%r9d
+  80402e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804032:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  804036:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80403a:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  80403e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804042:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804046:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804049:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80404c:	48 83 ec 08          	sub    $0x8,%rsp
+  804050:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  804053:	57                   	push   %rdi
+  804054:	89 c7                	mov    %eax,%edi
+  804056:	48 b8 85 47 80 00 00 	movabs $0x804785,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+  804062:	48 83 c4 10          	add    $0x10,%rsp
+  804066:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804069:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80406d:	0f 88 3c 01 00 00    	js     8041af <spawn+0x455>
+  804073:	eb 01                	jmp    804076 <spawn+0x31c>
+      continue;
+  804075:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804076:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80407a:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  80407f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804083:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  804087:	0f b7 c0             	movzwl %ax,%eax
+  80408a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80408d:	0f 8c 6c ff ff ff    	jl     803fff <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  804093:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804096:	89 c7                	mov    %eax,%edi
+  804098:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+  fd = -1;
+  8040a4:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  8040ab:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8040ae:	89 c7                	mov    %eax,%edi
+  8040b0:	48 b8 73 49 80 00 00 	movabs $0x804973,%rax
+  8040b7:	00 00 00 
+  8040ba:	ff d0                	call   *%rax
+  8040bc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040bf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8040c3:	79 36                	jns    8040fb <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  8040c5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8040c8:	89 c1                	mov    %eax,%ecx
+  8040ca:	48 b8 f2 63 80 00 00 	movabs $0x8063f2,%rax
+  8040d1:	00 00 00 
+  8040d4:	48 89 c2             	mov    %rax,%rdx
+  8040d7:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8040dc:	48 b8 08 64 80 00 00 	movabs $0x806408,%rax
+  8040e3:	00 00 00 
+  8040e6:	48 89 c7             	mov    %rax,%rdi
+  8040e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ee:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  8040f5:	00 00 00 
+  8040f8:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8040fb:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  804102:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804105:	48 89 d6             	mov    %rdx,%rsi
+  804108:	89 c7                	mov    %eax,%edi
+  80410a:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  804111:	00 00 00 
+  804114:	ff d0                	call   *%rax
+  804116:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804119:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80411d:	79 36                	jns    804155 <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  80411f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804122:	89 c1                	mov    %eax,%ecx
+  804124:	48 b8 14 64 80 00 00 	movabs $0x806414,%rax
+  80412b:	00 00 00 
+  80412e:	48 89 c2             	mov    %rax,%rdx
+  804131:	be a2 00 00 00       	mov    $0xa2,%esi
+  804136:	48 b8 08 64 80 00 00 	movabs $0x806408,%rax
+  80413d:	00 00 00 
+  804140:	48 89 c7             	mov    %rax,%rdi
+  804143:	b8 00 00 00 00       	mov    $0x0,%eax
+  804148:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  80414f:	00 00 00 
+  804152:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804155:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804158:	be 02 00 00 00       	mov    $0x2,%esi
+  80415d:	89 c7                	mov    %eax,%edi
+  80415f:	48 b8 4b 22 80 00 00 	movabs $0x80224b,%rax
+  804166:	00 00 00 
+  804169:	ff d0                	call   *%rax
+  80416b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80416e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804172:	79 36                	jns    8041aa <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  804174:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804177:	89 c1                	mov    %eax,%ecx
+  804179:	48 b8 2e 64 80 00 00 	movabs $0x80642e,%rax
+  804180:	00 00 00 
+  804183:	48 89 c2             	mov    %rax,%rdx
+  804186:	be a5 00 00 00       	mov    $0xa5,%esi
+  80418b:	48 b8 08 64 80 00 00 	movabs $0x806408,%rax
+  804192:	00 00 00 
+  804195:	48 89 c7             	mov    %rax,%rdi
+  804198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419d:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  8041a4:	00 00 00 
+  8041a7:	41 ff d0             	call   *%r8
+
+  return child;
+  8041aa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8041ad:	eb 26                	jmp    8041d5 <spawn+0x47b>
+      goto error;
+  8041af:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  8041b0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8041b3:	89 c7                	mov    %eax,%edi
+  8041b5:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  8041bc:	00 00 00 
+  8041bf:	ff d0                	call   *%rax
+  close(fd);
+  8041c1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8041c4:	89 c7                	mov    %eax,%edi
+  8041c6:	48 b8 d3 2b 80 00 00 	movabs $0x802bd3,%rax
+  8041cd:	00 00 00 
+  8041d0:	ff d0                	call   *%rax
+  return r;
+  8041d2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  8041d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041d9:	c9                   	leave
+  8041da:	c3                   	ret
+
+00000000008041db <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  8041db:	55                   	push   %rbp
+  8041dc:	48 89 e5             	mov    %rsp,%rbp
+  8041df:	41 55                	push   %r13
+  8041e1:	41 54                	push   %r12
+  8041e3:	53                   	push   %rbx
+  8041e4:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8041eb:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  8041f2:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  8041f9:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  804200:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  804207:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80420e:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  804215:	84 c0                	test   %al,%al
+  804217:	74 26                	je     80423f <spawnl+0x64>
+  804219:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  804220:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  804227:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80422b:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80422f:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  804233:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  804237:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80423b:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  80423f:	48 89 e0             	mov    %rsp,%rax
+  804242:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  804245:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  80424c:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  80424f:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  804256:	00 00 00 
+  804259:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  804260:	00 00 00 
+  804263:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804267:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  80426e:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  804275:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  80427c:	eb 07                	jmp    804285 <spawnl+0xaa>
+    argc++;
+  80427e:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  804285:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  80428b:	83 f8 2f             	cmp    $0x2f,%eax
+  80428e:	77 23                	ja     8042b3 <spawnl+0xd8>
+  804290:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  804297:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  80429d:	89 d2                	mov    %edx,%edx
+  80429f:	48 01 d0             	add    %rdx,%rax
+  8042a2:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8042a8:	83 c2 08             	add    $0x8,%edx
+  8042ab:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8042b1:	eb 12                	jmp    8042c5 <spawnl+0xea>
+  8042b3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8042ba:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8042be:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8042c5:	48 8b 00             	mov    (%rax),%rax
+  8042c8:	48 85 c0             	test   %rax,%rax
+  8042cb:	75 b1                	jne    80427e <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  8042cd:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8042d3:	83 c0 02             	add    $0x2,%eax
+  8042d6:	48 63 d0             	movslq %eax,%rdx
+  8042d9:	48 83 ea 01          	sub    $0x1,%rdx
+  8042dd:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  8042e4:	48 63 d0             	movslq %eax,%rdx
+  8042e7:	49 89 d4             	mov    %rdx,%r12
+  8042ea:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8042f0:	48 63 d0             	movslq %eax,%rdx
+  8042f3:	49 89 d2             	mov    %rdx,%r10
+  8042f6:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  8042fc:	48 98                	cltq
+  8042fe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804305:	00 
+  804306:	b8 10 00 00 00       	mov    $0x10,%eax
+  80430b:	48 83 e8 01          	sub    $0x1,%rax
+  80430f:	48 01 d0             	add    %rdx,%rax
+  804312:	be 10 00 00 00       	mov    $0x10,%esi
+  804317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80431c:	48 f7 f6             	div    %rsi
+  80431f:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  804323:	48 29 c4             	sub    %rax,%rsp
+  804326:	48 89 e0             	mov    %rsp,%rax
+  804329:	48 83 c0 07          	add    $0x7,%rax
+  80432d:	48 c1 e8 03          	shr    $0x3,%rax
+  804331:	48 c1 e0 03          	shl    $0x3,%rax
+  804335:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  80433c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804343:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  80434a:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  80434d:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804353:	8d 50 01             	lea    0x1(%rax),%edx
+  804356:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80435d:	48 63 d2             	movslq %edx,%rdx
+  804360:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  804367:	00 
+
+  va_start(vl, arg0);
+  804368:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  80436f:	00 00 00 
+  804372:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  804379:	00 00 00 
+  80437c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804380:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  804387:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80438e:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  804395:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  80439c:	00 00 00 
+  80439f:	eb 60                	jmp    804401 <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  8043a1:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  8043a7:	8d 48 01             	lea    0x1(%rax),%ecx
+  8043aa:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8043b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8043b3:	77 23                	ja     8043d8 <spawnl+0x1fd>
+  8043b5:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8043bc:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8043c2:	89 d2                	mov    %edx,%edx
+  8043c4:	48 01 d0             	add    %rdx,%rax
+  8043c7:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8043cd:	83 c2 08             	add    $0x8,%edx
+  8043d0:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8043d6:	eb 12                	jmp    8043ea <spawnl+0x20f>
+  8043d8:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8043df:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8043e3:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8043ea:	48 8b 10             	mov    (%rax),%rdx
+  8043ed:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8043f4:	89 c9                	mov    %ecx,%ecx
+  8043f6:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  8043fa:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  804401:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804407:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  80440d:	72 92                	jb     8043a1 <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  80440f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804416:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80441d:	48 89 d6             	mov    %rdx,%rsi
+  804420:	48 89 c7             	mov    %rax,%rdi
+  804423:	48 b8 5a 3d 80 00 00 	movabs $0x803d5a,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+  80442f:	48 89 dc             	mov    %rbx,%rsp
+}
+  804432:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  804436:	5b                   	pop    %rbx
+  804437:	41 5c                	pop    %r12
+  804439:	41 5d                	pop    %r13
+  80443b:	5d                   	pop    %rbp
+  80443c:	c3                   	ret
+
+000000000080443d <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  80443d:	55                   	push   %rbp
+  80443e:	48 89 e5             	mov    %rsp,%rbp
+  804441:	48 83 ec 50          	sub    $0x50,%rsp
+  804445:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804448:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80444c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  804450:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804457:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  804458:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80445f:	eb 33                	jmp    804494 <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  804461:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804464:	48 98                	cltq
+  804466:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80446d:	00 
+  80446e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804472:	48 01 d0             	add    %rdx,%rax
+  804475:	48 8b 00             	mov    (%rax),%rax
+  804478:	48 89 c7             	mov    %rax,%rdi
+  80447b:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+  804487:	83 c0 01             	add    $0x1,%eax
+  80448a:	48 98                	cltq
+  80448c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  804490:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804494:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804497:	48 98                	cltq
+  804499:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044a0:	00 
+  8044a1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044a5:	48 01 d0             	add    %rdx,%rax
+  8044a8:	48 8b 00             	mov    (%rax),%rax
+  8044ab:	48 85 c0             	test   %rax,%rax
+  8044ae:	75 b1                	jne    804461 <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  8044b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044b4:	48 f7 d8             	neg    %rax
+  8044b7:	48 05 00 40 40 00    	add    $0x404000,%rax
+  8044bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  8044c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8044c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044cd:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8044d1:	48 89 c2             	mov    %rax,%rdx
+  8044d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044d7:	83 c0 01             	add    $0x1,%eax
+  8044da:	c1 e0 03             	shl    $0x3,%eax
+  8044dd:	48 98                	cltq
+  8044df:	48 f7 d8             	neg    %rax
+  8044e2:	48 01 d0             	add    %rdx,%rax
+  8044e5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  8044e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044ed:	48 83 e8 10          	sub    $0x10,%rax
+  8044f1:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8044f7:	77 0a                	ja     804503 <init_stack+0xc6>
+    return -E_NO_MEM;
+  8044f9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8044fe:	e9 80 02 00 00       	jmp    804783 <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804503:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  80450a:	eb 3c                	jmp    804548 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  80450c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80450f:	48 98                	cltq
+  804511:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804517:	ba 07 00 00 00       	mov    $0x7,%edx
+  80451c:	48 89 c6             	mov    %rax,%rsi
+  80451f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804524:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  80452b:	00 00 00 
+  80452e:	ff d0                	call   *%rax
+  804530:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804533:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804537:	79 08                	jns    804541 <init_stack+0x104>
+      return r;
+  804539:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80453c:	e9 42 02 00 00       	jmp    804783 <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804541:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804548:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  80454f:	7e bb                	jle    80450c <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  804551:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804558:	e9 8f 00 00 00       	jmp    8045ec <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80455d:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804564:	00 00 00 
+  804567:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80456b:	48 01 d0             	add    %rdx,%rax
+  80456e:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804575:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804578:	48 98                	cltq
+  80457a:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  804581:	00 
+  804582:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804586:	48 01 c8             	add    %rcx,%rax
+  804589:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  80458c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80458f:	48 98                	cltq
+  804591:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804598:	00 
+  804599:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80459d:	48 01 d0             	add    %rdx,%rax
+  8045a0:	48 8b 10             	mov    (%rax),%rdx
+  8045a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a7:	48 89 d6             	mov    %rdx,%rsi
+  8045aa:	48 89 c7             	mov    %rax,%rdi
+  8045ad:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  8045b4:	00 00 00 
+  8045b7:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  8045b9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8045bc:	48 98                	cltq
+  8045be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8045c5:	00 
+  8045c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045ca:	48 01 d0             	add    %rdx,%rax
+  8045cd:	48 8b 00             	mov    (%rax),%rax
+  8045d0:	48 89 c7             	mov    %rax,%rdi
+  8045d3:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  8045da:	00 00 00 
+  8045dd:	ff d0                	call   *%rax
+  8045df:	83 c0 01             	add    $0x1,%eax
+  8045e2:	48 98                	cltq
+  8045e4:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  8045e8:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  8045ec:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8045ef:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  8045f2:	0f 8c 65 ff ff ff    	jl     80455d <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  8045f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045fb:	48 98                	cltq
+  8045fd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804604:	00 
+  804605:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804609:	48 01 d0             	add    %rdx,%rax
+  80460c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  804613:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  80461a:	00 
+  80461b:	74 3e                	je     80465b <init_stack+0x21e>
+  80461d:	48 b8 48 64 80 00 00 	movabs $0x806448,%rax
+  804624:	00 00 00 
+  804627:	48 89 c1             	mov    %rax,%rcx
+  80462a:	48 b8 73 64 80 00 00 	movabs $0x806473,%rax
+  804631:	00 00 00 
+  804634:	48 89 c2             	mov    %rax,%rdx
+  804637:	be 0c 01 00 00       	mov    $0x10c,%esi
+  80463c:	48 b8 08 64 80 00 00 	movabs $0x806408,%rax
+  804643:	00 00 00 
+  804646:	48 89 c7             	mov    %rax,%rdi
+  804649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464e:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  804655:	00 00 00 
+  804658:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80465b:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804662:	00 00 00 
+  804665:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804669:	48 01 d0             	add    %rdx,%rax
+  80466c:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804673:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804677:	48 83 e8 08          	sub    $0x8,%rax
+  80467b:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  80467e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804682:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  804686:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804689:	48 98                	cltq
+  80468b:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80468e:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  804695:	00 00 00 
+  804698:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80469c:	48 01 d0             	add    %rdx,%rax
+  80469f:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  8046a5:	48 89 c2             	mov    %rax,%rdx
+  8046a8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8046ac:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  8046af:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8046b6:	eb 78                	jmp    804730 <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  8046b8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8046bb:	48 98                	cltq
+  8046bd:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  8046c4:	00 00 00 
+  8046c7:	48 01 d0             	add    %rdx,%rax
+  8046ca:	48 89 c2             	mov    %rax,%rdx
+  8046cd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8046d0:	48 98                	cltq
+  8046d2:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8046d9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8046dc:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8046e2:	48 89 d1             	mov    %rdx,%rcx
+  8046e5:	89 c2                	mov    %eax,%edx
+  8046e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ec:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8046f3:	00 00 00 
+  8046f6:	ff d0                	call   *%rax
+  8046f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046ff:	78 43                	js     804744 <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  804701:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804704:	48 98                	cltq
+  804706:	48 05 00 00 40 00    	add    $0x400000,%rax
+  80470c:	48 89 c6             	mov    %rax,%rsi
+  80470f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804714:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  80471b:	00 00 00 
+  80471e:	ff d0                	call   *%rax
+  804720:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804723:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804727:	78 1e                	js     804747 <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804729:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804730:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  804737:	0f 8e 7b ff ff ff    	jle    8046b8 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  80473d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804742:	eb 3f                	jmp    804783 <init_stack+0x346>
+      goto error;
+  804744:	90                   	nop
+  804745:	eb 01                	jmp    804748 <init_stack+0x30b>
+      goto error;
+  804747:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  804748:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  80474f:	eb 26                	jmp    804777 <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  804751:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804754:	48 98                	cltq
+  804756:	48 05 00 00 40 00    	add    $0x400000,%rax
+  80475c:	48 89 c6             	mov    %rax,%rsi
+  80475f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804764:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  80476b:	00 00 00 
+  80476e:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  804770:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804777:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  80477e:	7e d1                	jle    804751 <init_stack+0x314>
+  return r;
+  804780:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804783:	c9                   	leave
+  804784:	c3                   	ret
+
+0000000000804785 <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  804785:	55                   	push   %rbp
+  804786:	48 89 e5             	mov    %rsp,%rbp
+  804789:	48 83 ec 50          	sub    $0x50,%rsp
+  80478d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804790:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804794:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804798:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  80479b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80479f:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  8047a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047a7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8047ac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047af:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047b3:	74 21                	je     8047d6 <map_segment+0x51>
+    va -= i;
+  8047b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047b8:	48 98                	cltq
+  8047ba:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  8047be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047c1:	48 98                	cltq
+  8047c3:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  8047c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047ca:	48 98                	cltq
+  8047cc:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  8047d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047d3:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  8047d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8047dd:	e9 7b 01 00 00       	jmp    80495d <map_segment+0x1d8>
+    if (i >= filesz) {
+  8047e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047e5:	48 98                	cltq
+  8047e7:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  8047eb:	72 3c                	jb     804829 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  8047ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047f0:	48 63 d0             	movslq %eax,%rdx
+  8047f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047f7:	48 01 d0             	add    %rdx,%rax
+  8047fa:	48 89 c1             	mov    %rax,%rcx
+  8047fd:	8b 55 10             	mov    0x10(%rbp),%edx
+  804800:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804803:	48 89 ce             	mov    %rcx,%rsi
+  804806:	89 c7                	mov    %eax,%edi
+  804808:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  80480f:	00 00 00 
+  804812:	ff d0                	call   *%rax
+  804814:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804817:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80481b:	0f 89 35 01 00 00    	jns    804956 <map_segment+0x1d1>
+        return r;
+  804821:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804824:	e9 48 01 00 00       	jmp    804971 <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  804829:	ba 07 00 00 00       	mov    $0x7,%edx
+  80482e:	be 00 00 40 00       	mov    $0x400000,%esi
+  804833:	bf 00 00 00 00       	mov    $0x0,%edi
+  804838:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  80483f:	00 00 00 
+  804842:	ff d0                	call   *%rax
+  804844:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804847:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80484b:	79 08                	jns    804855 <map_segment+0xd0>
+        return r;
+  80484d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804850:	e9 1c 01 00 00       	jmp    804971 <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  804855:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  804858:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80485b:	01 c2                	add    %eax,%edx
+  80485d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804860:	89 d6                	mov    %edx,%esi
+  804862:	89 c7                	mov    %eax,%edi
+  804864:	48 b8 37 31 80 00 00 	movabs $0x803137,%rax
+  80486b:	00 00 00 
+  80486e:	ff d0                	call   *%rax
+  804870:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804873:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804877:	79 08                	jns    804881 <map_segment+0xfc>
+        return r;
+  804879:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80487c:	e9 f0 00 00 00       	jmp    804971 <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  804881:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  804888:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80488b:	48 98                	cltq
+  80488d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804891:	48 29 c2             	sub    %rax,%rdx
+  804894:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804898:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80489b:	48 63 d0             	movslq %eax,%rdx
+  80489e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048a2:	48 39 c2             	cmp    %rax,%rdx
+  8048a5:	48 0f 47 d0          	cmova  %rax,%rdx
+  8048a9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8048ac:	be 00 00 40 00       	mov    $0x400000,%esi
+  8048b1:	89 c7                	mov    %eax,%edi
+  8048b3:	48 b8 bc 2f 80 00 00 	movabs $0x802fbc,%rax
+  8048ba:	00 00 00 
+  8048bd:	ff d0                	call   *%rax
+  8048bf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8048c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8048c6:	79 08                	jns    8048d0 <map_segment+0x14b>
+        return r;
+  8048c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8048cb:	e9 a1 00 00 00       	jmp    804971 <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  8048d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048d3:	48 63 d0             	movslq %eax,%rdx
+  8048d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048da:	48 01 d0             	add    %rdx,%rax
+  8048dd:	48 89 c1             	mov    %rax,%rcx
+  8048e0:	8b 55 10             	mov    0x10(%rbp),%edx
+  8048e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048e6:	41 89 d0             	mov    %edx,%r8d
+  8048e9:	89 c2                	mov    %eax,%edx
+  8048eb:	be 00 00 40 00       	mov    $0x400000,%esi
+  8048f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f5:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  8048fc:	00 00 00 
+  8048ff:	ff d0                	call   *%rax
+  804901:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  804904:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804908:	79 36                	jns    804940 <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  80490a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80490d:	89 c1                	mov    %eax,%ecx
+  80490f:	48 b8 88 64 80 00 00 	movabs $0x806488,%rax
+  804916:	00 00 00 
+  804919:	48 89 c2             	mov    %rax,%rdx
+  80491c:	be 40 01 00 00       	mov    $0x140,%esi
+  804921:	48 b8 08 64 80 00 00 	movabs $0x806408,%rax
+  804928:	00 00 00 
+  80492b:	48 89 c7             	mov    %rax,%rdi
+  80492e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804933:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  80493a:	00 00 00 
+  80493d:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  804940:	be 00 00 40 00       	mov    $0x400000,%esi
+  804945:	bf 00 00 00 00       	mov    $0x0,%edi
+  80494a:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804951:	00 00 00 
+  804954:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  804956:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  80495d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804960:	48 98                	cltq
+  804962:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804966:	0f 82 76 fe ff ff    	jb     8047e2 <map_segment+0x5d>
+    }
+  }
+  return 0;
+  80496c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804971:	c9                   	leave
+  804972:	c3                   	ret
+
+0000000000804973 <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  804973:	55                   	push   %rbp
+  804974:	48 89 e5             	mov    %rsp,%rbp
+  804977:	48 83 ec 20          	sub    $0x20,%rsp
+  80497b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  80497e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  804985:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80498c:	00 
+  80498d:	e9 e7 00 00 00       	jmp    804a79 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  804992:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804996:	48 c1 e8 27          	shr    $0x27,%rax
+  80499a:	48 89 c2             	mov    %rax,%rdx
+  80499d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8049a4:	01 00 00 
+  8049a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8049ab:	83 e0 01             	and    $0x1,%eax
+  8049ae:	48 85 c0             	test   %rax,%rax
+  8049b1:	0f 84 b9 00 00 00    	je     804a70 <copy_shared_pages+0xfd>
+  8049b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049bb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8049bf:	48 89 c2             	mov    %rax,%rdx
+  8049c2:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8049c9:	01 00 00 
+  8049cc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8049d0:	83 e0 01             	and    $0x1,%eax
+  8049d3:	48 85 c0             	test   %rax,%rax
+  8049d6:	0f 84 94 00 00 00    	je     804a70 <copy_shared_pages+0xfd>
+  8049dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049e0:	48 c1 e8 15          	shr    $0x15,%rax
+  8049e4:	48 89 c2             	mov    %rax,%rdx
+  8049e7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8049ee:	01 00 00 
+  8049f1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8049f5:	83 e0 01             	and    $0x1,%eax
+  8049f8:	48 85 c0             	test   %rax,%rax
+  8049fb:	74 73                	je     804a70 <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  8049fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a01:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a05:	48 89 c2             	mov    %rax,%rdx
+  804a08:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804a0f:	01 00 00 
+  804a12:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804a16:	25 01 04 00 00       	and    $0x401,%eax
+  804a1b:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  804a21:	75 4e                	jne    804a71 <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  804a23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a27:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a2b:	48 89 c2             	mov    %rax,%rdx
+  804a2e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804a35:	01 00 00 
+  804a38:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804a3c:	25 07 0e 00 00       	and    $0xe07,%eax
+  804a41:	89 c6                	mov    %eax,%esi
+  804a43:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804a47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a4b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804a4e:	41 89 f0             	mov    %esi,%r8d
+  804a51:	48 89 c6             	mov    %rax,%rsi
+  804a54:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a59:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804a60:	00 00 00 
+  804a63:	ff d0                	call   *%rax
+  804a65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  804a68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a6c:	78 21                	js     804a8f <copy_shared_pages+0x11c>
+  804a6e:	eb 01                	jmp    804a71 <copy_shared_pages+0xfe>
+      continue;
+  804a70:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  804a71:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  804a78:	00 
+  804a79:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  804a80:	00 00 00 
+  804a83:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804a87:	0f 83 05 ff ff ff    	jae    804992 <copy_shared_pages+0x1f>
+  804a8d:	eb 01                	jmp    804a90 <copy_shared_pages+0x11d>
+        break;
+  804a8f:	90                   	nop
+    }
+  }
+  return err;
+  804a90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a93:	c9                   	leave
+  804a94:	c3                   	ret
+
+0000000000804a95 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804a95:	55                   	push   %rbp
+  804a96:	48 89 e5             	mov    %rsp,%rbp
+  804a99:	48 83 ec 10          	sub    $0x10,%rsp
+  804a9d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804aa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804aa5:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804aaa:	48 89 c7             	mov    %rax,%rdi
+  804aad:	48 b8 bb 4a 80 00 00 	movabs $0x804abb,%rax
+  804ab4:	00 00 00 
+  804ab7:	ff d0                	call   *%rax
+}
+  804ab9:	c9                   	leave
+  804aba:	c3                   	ret
+
+0000000000804abb <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804abb:	55                   	push   %rbp
+  804abc:	48 89 e5             	mov    %rsp,%rbp
+  804abf:	48 83 ec 50          	sub    $0x50,%rsp
+  804ac3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804ac7:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804acb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ad2:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804ad3:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804ad8:	74 0a                	je     804ae4 <pipe_size+0x29>
+  804ada:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804ae1:	00 
+  804ae2:	76 0a                	jbe    804aee <pipe_size+0x33>
+    return -E_INVAL;
+  804ae4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804ae9:	e9 cc 02 00 00       	jmp    804dba <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804aee:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804af2:	48 89 c7             	mov    %rax,%rdi
+  804af5:	48 b8 7c 28 80 00 00 	movabs $0x80287c,%rax
+  804afc:	00 00 00 
+  804aff:	ff d0                	call   *%rax
+  804b01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b08:	0f 88 a8 02 00 00    	js     804db6 <pipe_size+0x2fb>
+  804b0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b12:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b17:	48 89 c6             	mov    %rax,%rsi
+  804b1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b1f:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  804b26:	00 00 00 
+  804b29:	ff d0                	call   *%rax
+  804b2b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b32:	0f 88 7e 02 00 00    	js     804db6 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804b38:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804b3c:	48 89 c7             	mov    %rax,%rdi
+  804b3f:	48 b8 7c 28 80 00 00 	movabs $0x80287c,%rax
+  804b46:	00 00 00 
+  804b49:	ff d0                	call   *%rax
+  804b4b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b4e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b52:	0f 88 43 02 00 00    	js     804d9b <pipe_size+0x2e0>
+  804b58:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b5c:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b61:	48 89 c6             	mov    %rax,%rsi
+  804b64:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b69:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  804b70:	00 00 00 
+  804b73:	ff d0                	call   *%rax
+  804b75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b78:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b7c:	0f 88 19 02 00 00    	js     804d9b <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804b82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b86:	48 89 c7             	mov    %rax,%rdi
+  804b89:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  804b90:	00 00 00 
+  804b93:	ff d0                	call   *%rax
+  804b95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804b99:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ba0:	00 
+  804ba1:	e9 a2 00 00 00       	jmp    804c48 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804ba6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804baa:	48 c1 e0 0c          	shl    $0xc,%rax
+  804bae:	48 89 c2             	mov    %rax,%rdx
+  804bb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb5:	48 01 d0             	add    %rdx,%rax
+  804bb8:	ba 07 04 00 00       	mov    $0x407,%edx
+  804bbd:	48 89 c6             	mov    %rax,%rsi
+  804bc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bc5:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  804bcc:	00 00 00 
+  804bcf:	ff d0                	call   *%rax
+  804bd1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bd4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bd8:	0f 88 37 01 00 00    	js     804d15 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804bde:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804be2:	48 89 c7             	mov    %rax,%rdi
+  804be5:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  804bec:	00 00 00 
+  804bef:	ff d0                	call   *%rax
+  804bf1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bf5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804bf9:	48 01 c2             	add    %rax,%rdx
+  804bfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c00:	48 c1 e0 0c          	shl    $0xc,%rax
+  804c04:	48 89 c1             	mov    %rax,%rcx
+  804c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c0b:	48 01 c8             	add    %rcx,%rax
+  804c0e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804c14:	48 89 d1             	mov    %rdx,%rcx
+  804c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c1c:	48 89 c6             	mov    %rax,%rsi
+  804c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c24:	48 b8 9f 21 80 00 00 	movabs $0x80219f,%rax
+  804c2b:	00 00 00 
+  804c2e:	ff d0                	call   *%rax
+  804c30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c37:	79 0a                	jns    804c43 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804c39:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804c3e:	e9 d3 00 00 00       	jmp    804d16 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804c43:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804c48:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804c4f:	00 
+  804c50:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804c54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c58:	48 01 d0             	add    %rdx,%rax
+  804c5b:	48 83 c0 1f          	add    $0x1f,%rax
+  804c5f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804c63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c6c:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804c70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c74:	48 29 d0             	sub    %rdx,%rax
+  804c77:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c7b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804c7f:	0f 82 21 ff ff ff    	jb     804ba6 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804c85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c89:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804c8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c91:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804c95:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804c99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c9d:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804ca4:	00 00 00 
+  804ca7:	8b 12                	mov    (%rdx),%edx
+  804ca9:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804cab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804caf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804cb6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cba:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804cc1:	00 00 00 
+  804cc4:	8b 12                	mov    (%rdx),%edx
+  804cc6:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804cc8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ccc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804cd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cd7:	48 89 c7             	mov    %rax,%rdi
+  804cda:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  804ce1:	00 00 00 
+  804ce4:	ff d0                	call   *%rax
+  804ce6:	89 c2                	mov    %eax,%edx
+  804ce8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804cec:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804cee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cf2:	48 89 c7             	mov    %rax,%rdi
+  804cf5:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  804cfc:	00 00 00 
+  804cff:	ff d0                	call   *%rax
+  804d01:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d05:	48 83 c2 04          	add    $0x4,%rdx
+  804d09:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d10:	e9 a5 00 00 00       	jmp    804dba <pipe_size+0x2ff>
+      goto err2;
+  804d15:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804d16:	eb 58                	jmp    804d70 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804d18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d1c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804d20:	48 89 c2             	mov    %rax,%rdx
+  804d23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d27:	48 01 d0             	add    %rdx,%rax
+  804d2a:	48 89 c6             	mov    %rax,%rsi
+  804d2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d32:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804d39:	00 00 00 
+  804d3c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804d3e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d42:	48 89 c7             	mov    %rax,%rdi
+  804d45:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  804d4c:	00 00 00 
+  804d4f:	ff d0                	call   *%rax
+  804d51:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d55:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804d59:	48 01 d0             	add    %rdx,%rax
+  804d5c:	48 89 c6             	mov    %rax,%rsi
+  804d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d64:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804d6b:	00 00 00 
+  804d6e:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804d70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d74:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804d78:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804d7c:	48 85 c0             	test   %rax,%rax
+  804d7f:	75 97                	jne    804d18 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804d81:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d85:	48 89 c6             	mov    %rax,%rsi
+  804d88:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d8d:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804d94:	00 00 00 
+  804d97:	ff d0                	call   *%rax
+  804d99:	eb 01                	jmp    804d9c <pipe_size+0x2e1>
+    goto err1;
+  804d9b:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804d9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804da0:	48 89 c6             	mov    %rax,%rsi
+  804da3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da8:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  804daf:	00 00 00 
+  804db2:	ff d0                	call   *%rax
+  804db4:	eb 01                	jmp    804db7 <pipe_size+0x2fc>
+    goto err;
+  804db6:	90                   	nop
+err:
+  return r;
+  804db7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804dba:	c9                   	leave
+  804dbb:	c3                   	ret
+
+0000000000804dbc <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804dbc:	55                   	push   %rbp
+  804dbd:	48 89 e5             	mov    %rsp,%rbp
+  804dc0:	53                   	push   %rbx
+  804dc1:	48 83 ec 28          	sub    $0x28,%rsp
+  804dc5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804dc9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804dcd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804dd4:	00 00 00 
+  804dd7:	8b 40 04             	mov    0x4(%rax),%eax
+  804dda:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ddf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804de6:	00 00 00 
+  804de9:	48 98                	cltq
+  804deb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804df2:	48 01 d0             	add    %rdx,%rax
+  804df5:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804dfb:	8b 00                	mov    (%rax),%eax
+  804dfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804e00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e04:	48 89 c7             	mov    %rax,%rdi
+  804e07:	48 b8 ad 5c 80 00 00 	movabs $0x805cad,%rax
+  804e0e:	00 00 00 
+  804e11:	ff d0                	call   *%rax
+  804e13:	89 c3                	mov    %eax,%ebx
+  804e15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e19:	48 89 c7             	mov    %rax,%rdi
+  804e1c:	48 b8 ad 5c 80 00 00 	movabs $0x805cad,%rax
+  804e23:	00 00 00 
+  804e26:	ff d0                	call   *%rax
+  804e28:	39 c3                	cmp    %eax,%ebx
+  804e2a:	0f 94 c0             	sete   %al
+  804e2d:	0f b6 c0             	movzbl %al,%eax
+  804e30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804e33:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e3a:	00 00 00 
+  804e3d:	8b 40 04             	mov    0x4(%rax),%eax
+  804e40:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e45:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e4c:	00 00 00 
+  804e4f:	48 98                	cltq
+  804e51:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e58:	48 01 d0             	add    %rdx,%rax
+  804e5b:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804e61:	8b 00                	mov    (%rax),%eax
+  804e63:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804e66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e69:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e6c:	75 05                	jne    804e73 <_pipeisclosed+0xb7>
+      return ret;
+  804e6e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e71:	eb 68                	jmp    804edb <_pipeisclosed+0x11f>
+    if (n != nn)
+  804e73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e76:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e79:	0f 84 4e ff ff ff    	je     804dcd <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804e7f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e86:	00 00 00 
+  804e89:	8b 40 04             	mov    0x4(%rax),%eax
+  804e8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e91:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e98:	00 00 00 
+  804e9b:	48 98                	cltq
+  804e9d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ea4:	48 01 d0             	add    %rdx,%rax
+  804ea7:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ead:	8b 10                	mov    (%rax),%edx
+  804eaf:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804eb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804eb5:	89 c6                	mov    %eax,%esi
+  804eb7:	48 b8 b0 64 80 00 00 	movabs $0x8064b0,%rax
+  804ebe:	00 00 00 
+  804ec1:	48 89 c7             	mov    %rax,%rdi
+  804ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ec9:	49 b8 c9 03 80 00 00 	movabs $0x8003c9,%r8
+  804ed0:	00 00 00 
+  804ed3:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804ed6:	e9 f2 fe ff ff       	jmp    804dcd <_pipeisclosed+0x11>
+  }
+}
+  804edb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804edf:	c9                   	leave
+  804ee0:	c3                   	ret
+
+0000000000804ee1 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804ee1:	55                   	push   %rbp
+  804ee2:	48 89 e5             	mov    %rsp,%rbp
+  804ee5:	48 83 ec 30          	sub    $0x30,%rsp
+  804ee9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804eec:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804ef0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ef3:	48 89 d6             	mov    %rdx,%rsi
+  804ef6:	89 c7                	mov    %eax,%edi
+  804ef8:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  804eff:	00 00 00 
+  804f02:	ff d0                	call   *%rax
+  804f04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f0b:	79 05                	jns    804f12 <pipeisclosed+0x31>
+    return r;
+  804f0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f10:	eb 31                	jmp    804f43 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804f12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f16:	48 89 c7             	mov    %rax,%rdi
+  804f19:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  804f20:	00 00 00 
+  804f23:	ff d0                	call   *%rax
+  804f25:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804f29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804f31:	48 89 d6             	mov    %rdx,%rsi
+  804f34:	48 89 c7             	mov    %rax,%rdi
+  804f37:	48 b8 bc 4d 80 00 00 	movabs $0x804dbc,%rax
+  804f3e:	00 00 00 
+  804f41:	ff d0                	call   *%rax
+}
+  804f43:	c9                   	leave
+  804f44:	c3                   	ret
+
+0000000000804f45 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804f45:	55                   	push   %rbp
+  804f46:	48 89 e5             	mov    %rsp,%rbp
+  804f49:	48 83 ec 10          	sub    $0x10,%rsp
+  804f4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804f51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f55:	8b 40 18             	mov    0x18(%rax),%eax
+  804f58:	8d 50 01             	lea    0x1(%rax),%edx
+  804f5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f5f:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804f62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f66:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804f69:	85 c0                	test   %eax,%eax
+  804f6b:	74 27                	je     804f94 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804f6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f71:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f7c:	48 83 c0 18          	add    $0x18,%rax
+  804f80:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804f85:	48 89 c7             	mov    %rax,%rdi
+  804f88:	48 b8 42 25 80 00 00 	movabs $0x802542,%rax
+  804f8f:	00 00 00 
+  804f92:	ff d0                	call   *%rax
+  }
+}
+  804f94:	90                   	nop
+  804f95:	c9                   	leave
+  804f96:	c3                   	ret
+
+0000000000804f97 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804f97:	55                   	push   %rbp
+  804f98:	48 89 e5             	mov    %rsp,%rbp
+  804f9b:	48 83 ec 10          	sub    $0x10,%rsp
+  804f9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fa3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804faa:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb5:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804fb9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804fbc:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804fc3:	89 c6                	mov    %eax,%esi
+  804fc5:	48 89 cf             	mov    %rcx,%rdi
+  804fc8:	48 b8 f3 24 80 00 00 	movabs $0x8024f3,%rax
+  804fcf:	00 00 00 
+  804fd2:	ff d0                	call   *%rax
+}
+  804fd4:	90                   	nop
+  804fd5:	c9                   	leave
+  804fd6:	c3                   	ret
+
+0000000000804fd7 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fd7:	55                   	push   %rbp
+  804fd8:	48 89 e5             	mov    %rsp,%rbp
+  804fdb:	48 83 ec 70          	sub    $0x70,%rsp
+  804fdf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804fe3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804fe7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804feb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fef:	48 89 c7             	mov    %rax,%rdi
+  804ff2:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  804ff9:	00 00 00 
+  804ffc:	ff d0                	call   *%rax
+  804ffe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  805002:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  805007:	75 0a                	jne    805013 <devpipe_read+0x3c>
+    return 0;
+  805009:	b8 00 00 00 00       	mov    $0x0,%eax
+  80500e:	e9 63 01 00 00       	jmp    805176 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  805013:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805017:	8b 40 18             	mov    0x18(%rax),%eax
+  80501a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80501d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805021:	48 8b 10             	mov    (%rax),%rdx
+  805024:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805028:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80502c:	48 39 c2             	cmp    %rax,%rdx
+  80502f:	75 42                	jne    805073 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  805031:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805035:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805039:	48 89 d6             	mov    %rdx,%rsi
+  80503c:	48 89 c7             	mov    %rax,%rdi
+  80503f:	48 b8 bc 4d 80 00 00 	movabs $0x804dbc,%rax
+  805046:	00 00 00 
+  805049:	ff d0                	call   *%rax
+  80504b:	85 c0                	test   %eax,%eax
+  80504d:	74 0a                	je     805059 <devpipe_read+0x82>
+      return 0;
+  80504f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805054:	e9 1d 01 00 00       	jmp    805176 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  805059:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80505c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805060:	89 d6                	mov    %edx,%esi
+  805062:	48 89 c7             	mov    %rax,%rdi
+  805065:	48 b8 97 4f 80 00 00 	movabs $0x804f97,%rax
+  80506c:	00 00 00 
+  80506f:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  805071:	eb a0                	jmp    805013 <devpipe_read+0x3c>
+      break;
+  805073:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  805074:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805078:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80507c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805080:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805088:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80508c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805090:	48 8b 00             	mov    (%rax),%rax
+  805093:	48 29 c2             	sub    %rax,%rdx
+  805096:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80509a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80509e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050a2:	48 39 c2             	cmp    %rax,%rdx
+  8050a5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8050a9:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8050ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050b1:	48 8b 00             	mov    (%rax),%rax
+  8050b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050b8:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8050bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050c1:	48 f7 f1             	div    %rcx
+  8050c4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8050c8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8050cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8050d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050d4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050d8:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8050dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8050e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8050e8:	48 39 c2             	cmp    %rax,%rdx
+  8050eb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8050ef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8050f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050f7:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8050fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050ff:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805103:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805107:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510b:	48 89 ce             	mov    %rcx,%rsi
+  80510e:	48 89 c7             	mov    %rax,%rdi
+  805111:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  805118:	00 00 00 
+  80511b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80511d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805121:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  805125:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805129:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80512d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805131:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805135:	48 01 d1             	add    %rdx,%rcx
+  805138:	48 89 c2             	mov    %rax,%rdx
+  80513b:	48 89 cf             	mov    %rcx,%rdi
+  80513e:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  805145:	00 00 00 
+  805148:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80514a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80514e:	48 8b 10             	mov    (%rax),%rdx
+  805151:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805155:	48 01 c2             	add    %rax,%rdx
+  805158:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80515c:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80515f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805163:	48 89 c7             	mov    %rax,%rdi
+  805166:	48 b8 45 4f 80 00 00 	movabs $0x804f45,%rax
+  80516d:	00 00 00 
+  805170:	ff d0                	call   *%rax
+  return n;
+  805172:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  805176:	c9                   	leave
+  805177:	c3                   	ret
+
+0000000000805178 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805178:	55                   	push   %rbp
+  805179:	48 89 e5             	mov    %rsp,%rbp
+  80517c:	48 83 ec 70          	sub    $0x70,%rsp
+  805180:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805184:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805188:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80518c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805190:	48 89 c7             	mov    %rax,%rdi
+  805193:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  80519a:	00 00 00 
+  80519d:	ff d0                	call   *%rax
+  80519f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8051a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8051a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8051ab:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8051b2:	00 
+  8051b3:	e9 b8 01 00 00       	jmp    805370 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8051b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051bc:	8b 40 18             	mov    0x18(%rax),%eax
+  8051bf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8051c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051c6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8051ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051ce:	48 8b 00             	mov    (%rax),%rax
+  8051d1:	48 29 c2             	sub    %rax,%rdx
+  8051d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051dc:	48 39 c2             	cmp    %rax,%rdx
+  8051df:	75 4d                	jne    80522e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8051e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051e5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8051e9:	48 89 d6             	mov    %rdx,%rsi
+  8051ec:	48 89 c7             	mov    %rax,%rdi
+  8051ef:	48 b8 bc 4d 80 00 00 	movabs $0x804dbc,%rax
+  8051f6:	00 00 00 
+  8051f9:	ff d0                	call   *%rax
+  8051fb:	85 c0                	test   %eax,%eax
+  8051fd:	74 0a                	je     805209 <devpipe_write+0x91>
+        return 0;
+  8051ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  805204:	e9 79 01 00 00       	jmp    805382 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805209:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80520c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805210:	89 d6                	mov    %edx,%esi
+  805212:	48 89 c7             	mov    %rax,%rdi
+  805215:	48 b8 97 4f 80 00 00 	movabs $0x804f97,%rax
+  80521c:	00 00 00 
+  80521f:	ff d0                	call   *%rax
+      m = 0;
+  805221:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805228:	00 
+      continue;
+  805229:	e9 3a 01 00 00       	jmp    805368 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80522e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805232:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  805236:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80523a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80523e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805246:	48 8b 08             	mov    (%rax),%rcx
+  805249:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80524d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805251:	48 29 c1             	sub    %rax,%rcx
+  805254:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  805258:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80525c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805260:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805264:	48 39 c2             	cmp    %rax,%rdx
+  805267:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80526b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80526f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805273:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805277:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80527b:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80527f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805284:	48 f7 f1             	div    %rcx
+  805287:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  80528b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80528f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805297:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80529b:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80529f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8052a3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8052a7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8052ab:	48 39 c2             	cmp    %rax,%rdx
+  8052ae:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8052b2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8052b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052ba:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8052be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8052c2:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8052c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8052ca:	48 01 d1             	add    %rdx,%rcx
+  8052cd:	48 89 c2             	mov    %rax,%rdx
+  8052d0:	48 89 cf             	mov    %rcx,%rdi
+  8052d3:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  8052da:	00 00 00 
+  8052dd:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8052df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052e3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052e7:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8052eb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8052ef:	73 4d                	jae    80533e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8052f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052f5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8052fd:	48 29 c2             	sub    %rax,%rdx
+  805300:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805304:	48 01 c2             	add    %rax,%rdx
+  805307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80530b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80530f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805313:	48 89 c1             	mov    %rax,%rcx
+  805316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80531a:	48 01 c1             	add    %rax,%rcx
+  80531d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805321:	48 01 c1             	add    %rax,%rcx
+  805324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805328:	48 83 c0 20          	add    $0x20,%rax
+  80532c:	48 89 ce             	mov    %rcx,%rsi
+  80532f:	48 89 c7             	mov    %rax,%rdi
+  805332:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  805339:	00 00 00 
+  80533c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80533e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805342:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805346:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80534a:	48 01 c2             	add    %rax,%rdx
+  80534d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805351:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805355:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805359:	48 89 c7             	mov    %rax,%rdi
+  80535c:	48 b8 45 4f 80 00 00 	movabs $0x804f45,%rax
+  805363:	00 00 00 
+  805366:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805368:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80536c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805374:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805378:	0f 82 3a fe ff ff    	jb     8051b8 <devpipe_write+0x40>
+  }
+
+  return i;
+  80537e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805382:	c9                   	leave
+  805383:	c3                   	ret
+
+0000000000805384 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805384:	55                   	push   %rbp
+  805385:	48 89 e5             	mov    %rsp,%rbp
+  805388:	48 83 ec 40          	sub    $0x40,%rsp
+  80538c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805390:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805393:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805397:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80539b:	48 89 c7             	mov    %rax,%rdi
+  80539e:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  8053a5:	00 00 00 
+  8053a8:	ff d0                	call   *%rax
+  8053aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8053ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8053b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053b9:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8053bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053c1:	48 89 d6             	mov    %rdx,%rsi
+  8053c4:	48 89 c7             	mov    %rax,%rdi
+  8053c7:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  8053ce:	00 00 00 
+  8053d1:	ff d0                	call   *%rax
+  8053d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053da:	79 08                	jns    8053e4 <devpipe_poll+0x60>
+    return r;
+  8053dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053df:	e9 85 00 00 00       	jmp    805469 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8053e4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8053e7:	83 e0 01             	and    $0x1,%eax
+  8053ea:	85 c0                	test   %eax,%eax
+  8053ec:	74 18                	je     805406 <devpipe_poll+0x82>
+  8053ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053f2:	48 8b 10             	mov    (%rax),%rdx
+  8053f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8053fd:	48 39 c2             	cmp    %rax,%rdx
+  805400:	74 04                	je     805406 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805402:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805406:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805409:	83 e0 02             	and    $0x2,%eax
+  80540c:	85 c0                	test   %eax,%eax
+  80540e:	74 23                	je     805433 <devpipe_poll+0xaf>
+  805410:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805414:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805418:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80541c:	48 8b 00             	mov    (%rax),%rax
+  80541f:	48 29 c2             	sub    %rax,%rdx
+  805422:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805426:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80542a:	48 39 c2             	cmp    %rax,%rdx
+  80542d:	73 04                	jae    805433 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80542f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805433:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805437:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80543b:	48 89 d6             	mov    %rdx,%rsi
+  80543e:	48 89 c7             	mov    %rax,%rdi
+  805441:	48 b8 bc 4d 80 00 00 	movabs $0x804dbc,%rax
+  805448:	00 00 00 
+  80544b:	ff d0                	call   *%rax
+  80544d:	85 c0                	test   %eax,%eax
+  80544f:	74 04                	je     805455 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805451:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805455:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805459:	75 0b                	jne    805466 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  80545b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80545f:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805466:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805469:	c9                   	leave
+  80546a:	c3                   	ret
+
+000000000080546b <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80546b:	55                   	push   %rbp
+  80546c:	48 89 e5             	mov    %rsp,%rbp
+  80546f:	48 83 ec 20          	sub    $0x20,%rsp
+  805473:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805477:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80547b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80547f:	48 89 c7             	mov    %rax,%rdi
+  805482:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  805489:	00 00 00 
+  80548c:	ff d0                	call   *%rax
+  80548e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805492:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805496:	48 ba e1 64 80 00 00 	movabs $0x8064e1,%rdx
+  80549d:	00 00 00 
+  8054a0:	48 89 d6             	mov    %rdx,%rsi
+  8054a3:	48 89 c7             	mov    %rax,%rdi
+  8054a6:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  8054ad:	00 00 00 
+  8054b0:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8054b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054ba:	89 c1                	mov    %eax,%ecx
+  8054bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054c0:	48 8b 00             	mov    (%rax),%rax
+  8054c3:	89 c2                	mov    %eax,%edx
+  8054c5:	89 c8                	mov    %ecx,%eax
+  8054c7:	29 d0                	sub    %edx,%eax
+  8054c9:	89 c2                	mov    %eax,%edx
+  8054cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054cf:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8054d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054d9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8054e0:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8054e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054e7:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8054ee:	00 00 00 
+  8054f1:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8054f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054fd:	c9                   	leave
+  8054fe:	c3                   	ret
+
+00000000008054ff <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8054ff:	55                   	push   %rbp
+  805500:	48 89 e5             	mov    %rsp,%rbp
+  805503:	48 83 ec 40          	sub    $0x40,%rsp
+  805507:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80550b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80550f:	48 89 c7             	mov    %rax,%rdi
+  805512:	48 b8 51 28 80 00 00 	movabs $0x802851,%rax
+  805519:	00 00 00 
+  80551c:	ff d0                	call   *%rax
+  80551e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805522:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805529:	00 
+  80552a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80552e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805532:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805536:	48 01 d0             	add    %rdx,%rax
+  805539:	48 83 c0 1f          	add    $0x1f,%rax
+  80553d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805541:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80554a:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80554e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805552:	48 29 d0             	sub    %rdx,%rax
+  805555:	48 c1 e8 0c          	shr    $0xc,%rax
+  805559:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80555d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805561:	48 89 c6             	mov    %rax,%rsi
+  805564:	bf 00 00 00 00       	mov    $0x0,%edi
+  805569:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  805570:	00 00 00 
+  805573:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805575:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805579:	48 89 c7             	mov    %rax,%rdi
+  80557c:	48 b8 45 4f 80 00 00 	movabs $0x804f45,%rax
+  805583:	00 00 00 
+  805586:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805588:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80558c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805590:	eb 2f                	jmp    8055c1 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805596:	48 83 e8 01          	sub    $0x1,%rax
+  80559a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80559e:	48 89 c2             	mov    %rax,%rdx
+  8055a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055a5:	48 01 d0             	add    %rdx,%rax
+  8055a8:	48 89 c6             	mov    %rax,%rsi
+  8055ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055b0:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8055b7:	00 00 00 
+  8055ba:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8055bc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8055c1:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8055c6:	77 ca                	ja     805592 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8055c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055cc:	48 89 c6             	mov    %rax,%rsi
+  8055cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055d4:	48 b8 ff 21 80 00 00 	movabs $0x8021ff,%rax
+  8055db:	00 00 00 
+  8055de:	ff d0                	call   *%rax
+}
+  8055e0:	c9                   	leave
+  8055e1:	c3                   	ret
+
+00000000008055e2 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8055e2:	55                   	push   %rbp
+  8055e3:	48 89 e5             	mov    %rsp,%rbp
+  8055e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8055ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8055ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055f1:	75 10                	jne    805603 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8055f3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8055fa:	00 00 00 
+  8055fd:	8b 00                	mov    (%rax),%eax
+  8055ff:	48 98                	cltq
+  805601:	eb 05                	jmp    805608 <vsyscall+0x26>
+  }
+  return 0;
+  805603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805608:	c9                   	leave
+  805609:	c3                   	ret
+
+000000000080560a <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80560a:	55                   	push   %rbp
+  80560b:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80560e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805613:	48 b8 e2 55 80 00 00 	movabs $0x8055e2,%rax
+  80561a:	00 00 00 
+  80561d:	ff d0                	call   *%rax
+}
+  80561f:	5d                   	pop    %rbp
+  805620:	c3                   	ret
+
+0000000000805621 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805621:	55                   	push   %rbp
+  805622:	48 89 e5             	mov    %rsp,%rbp
+  805625:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805629:	0f 31                	rdtsc
+  80562b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80562e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805631:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805634:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805637:	48 c1 e2 20          	shl    $0x20,%rdx
+  80563b:	48 09 d0             	or     %rdx,%rax
+  80563e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805642:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805646:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80564a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805651:	00 00 00 
+  805654:	8b 40 08             	mov    0x8(%rax),%eax
+  805657:	48 98                	cltq
+  805659:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80565d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805661:	ba 00 00 00 00       	mov    $0x0,%edx
+  805666:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80566a:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80567a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80567e:	48 89 d0             	mov    %rdx,%rax
+  805681:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80568d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805691:	48 01 c8             	add    %rcx,%rax
+}
+  805694:	c9                   	leave
+  805695:	c3                   	ret
+
+0000000000805696 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805696:	55                   	push   %rbp
+  805697:	48 89 e5             	mov    %rsp,%rbp
+  80569a:	48 83 ec 20          	sub    $0x20,%rsp
+  80569e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8056a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056a4:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8056a7:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8056ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8056b0:	48 89 c7             	mov    %rax,%rdi
+  8056b3:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  8056ba:	00 00 00 
+  8056bd:	ff d0                	call   *%rax
+}
+  8056bf:	90                   	nop
+  8056c0:	c9                   	leave
+  8056c1:	c3                   	ret
+
+00000000008056c2 <getchar>:
+
+int
+getchar(void) {
+  8056c2:	55                   	push   %rbp
+  8056c3:	48 89 e5             	mov    %rsp,%rbp
+  8056c6:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8056ca:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8056ce:	ba 01 00 00 00       	mov    $0x1,%edx
+  8056d3:	48 89 c6             	mov    %rax,%rsi
+  8056d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056db:	48 b8 ba 2e 80 00 00 	movabs $0x802eba,%rax
+  8056e2:	00 00 00 
+  8056e5:	ff d0                	call   *%rax
+  8056e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8056ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056ee:	79 05                	jns    8056f5 <getchar+0x33>
+    return r;
+  8056f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056f3:	eb 14                	jmp    805709 <getchar+0x47>
+  if (r < 1)
+  8056f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056f9:	7f 07                	jg     805702 <getchar+0x40>
+    return -E_EOF;
+  8056fb:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805700:	eb 07                	jmp    805709 <getchar+0x47>
+  return c;
+  805702:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805706:	0f b6 c0             	movzbl %al,%eax
+}
+  805709:	c9                   	leave
+  80570a:	c3                   	ret
+
+000000000080570b <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  80570b:	55                   	push   %rbp
+  80570c:	48 89 e5             	mov    %rsp,%rbp
+  80570f:	48 83 ec 20          	sub    $0x20,%rsp
+  805713:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805716:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80571a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80571d:	48 89 d6             	mov    %rdx,%rsi
+  805720:	89 c7                	mov    %eax,%edi
+  805722:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  805729:	00 00 00 
+  80572c:	ff d0                	call   *%rax
+  80572e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805731:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805735:	79 05                	jns    80573c <iscons+0x31>
+    return r;
+  805737:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80573a:	eb 1a                	jmp    805756 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80573c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805740:	8b 10                	mov    (%rax),%edx
+  805742:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805749:	00 00 00 
+  80574c:	8b 00                	mov    (%rax),%eax
+  80574e:	39 c2                	cmp    %eax,%edx
+  805750:	0f 94 c0             	sete   %al
+  805753:	0f b6 c0             	movzbl %al,%eax
+}
+  805756:	c9                   	leave
+  805757:	c3                   	ret
+
+0000000000805758 <opencons>:
+
+int
+opencons(void) {
+  805758:	55                   	push   %rbp
+  805759:	48 89 e5             	mov    %rsp,%rbp
+  80575c:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805760:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805764:	48 89 c7             	mov    %rax,%rdi
+  805767:	48 b8 7c 28 80 00 00 	movabs $0x80287c,%rax
+  80576e:	00 00 00 
+  805771:	ff d0                	call   *%rax
+  805773:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805776:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80577a:	79 05                	jns    805781 <opencons+0x29>
+    return r;
+  80577c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80577f:	eb 66                	jmp    8057e7 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805785:	ba 07 04 00 00       	mov    $0x407,%edx
+  80578a:	48 89 c6             	mov    %rax,%rsi
+  80578d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805792:	48 b8 47 21 80 00 00 	movabs $0x802147,%rax
+  805799:	00 00 00 
+  80579c:	ff d0                	call   *%rax
+  80579e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8057a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057a5:	79 05                	jns    8057ac <opencons+0x54>
+    return r;
+  8057a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057aa:	eb 3b                	jmp    8057e7 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8057ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057b0:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8057b7:	00 00 00 
+  8057ba:	8b 12                	mov    (%rdx),%edx
+  8057bc:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8057be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057c2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8057c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057cd:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8057d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057d8:	48 89 c7             	mov    %rax,%rdi
+  8057db:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  8057e2:	00 00 00 
+  8057e5:	ff d0                	call   *%rax
+}
+  8057e7:	c9                   	leave
+  8057e8:	c3                   	ret
+
+00000000008057e9 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8057e9:	55                   	push   %rbp
+  8057ea:	48 89 e5             	mov    %rsp,%rbp
+  8057ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8057f1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057f4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8057f7:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8057fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057fe:	48 89 d6             	mov    %rdx,%rsi
+  805801:	89 c7                	mov    %eax,%edi
+  805803:	48 b8 5e 29 80 00 00 	movabs $0x80295e,%rax
+  80580a:	00 00 00 
+  80580d:	ff d0                	call   *%rax
+  80580f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805812:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805816:	79 05                	jns    80581d <consmode+0x34>
+    return r;
+  805818:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80581b:	eb 34                	jmp    805851 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80581d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805821:	8b 10                	mov    (%rax),%edx
+  805823:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80582a:	00 00 00 
+  80582d:	8b 00                	mov    (%rax),%eax
+  80582f:	39 c2                	cmp    %eax,%edx
+  805831:	74 07                	je     80583a <consmode+0x51>
+    return -E_INVAL;
+  805833:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805838:	eb 17                	jmp    805851 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80583a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80583e:	8b 40 0c             	mov    0xc(%rax),%eax
+  805841:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805844:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805848:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80584b:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80584e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805851:	c9                   	leave
+  805852:	c3                   	ret
+
+0000000000805853 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805853:	55                   	push   %rbp
+  805854:	48 89 e5             	mov    %rsp,%rbp
+  805857:	48 83 ec 20          	sub    $0x20,%rsp
+  80585b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80585f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805863:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805867:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80586b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80586e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805872:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805876:	48 89 ce             	mov    %rcx,%rsi
+  805879:	48 89 c7             	mov    %rax,%rdi
+  80587c:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  805883:	00 00 00 
+  805886:	ff d0                	call   *%rax
+  805888:	48 98                	cltq
+}
+  80588a:	c9                   	leave
+  80588b:	c3                   	ret
+
+000000000080588c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80588c:	55                   	push   %rbp
+  80588d:	48 89 e5             	mov    %rsp,%rbp
+  805890:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805897:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  80589e:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8058a5:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8058ac:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8058b3:	eb 74                	jmp    805929 <devcons_write+0x9d>
+    m = n - tot;
+  8058b5:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8058bc:	89 c2                	mov    %eax,%edx
+  8058be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058c1:	29 c2                	sub    %eax,%edx
+  8058c3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8058c6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8058c9:	83 f8 7f             	cmp    $0x7f,%eax
+  8058cc:	76 07                	jbe    8058d5 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8058ce:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8058d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8058d8:	48 63 d0             	movslq %eax,%rdx
+  8058db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058de:	48 63 c8             	movslq %eax,%rcx
+  8058e1:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8058e8:	48 01 c1             	add    %rax,%rcx
+  8058eb:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8058f2:	48 89 ce             	mov    %rcx,%rsi
+  8058f5:	48 89 c7             	mov    %rax,%rdi
+  8058f8:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8058ff:	00 00 00 
+  805902:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805904:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805907:	48 63 d0             	movslq %eax,%rdx
+  80590a:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805911:	48 89 d6             	mov    %rdx,%rsi
+  805914:	48 89 c7             	mov    %rax,%rdi
+  805917:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  80591e:	00 00 00 
+  805921:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805923:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805926:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805929:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80592c:	48 98                	cltq
+  80592e:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805935:	0f 82 7a ff ff ff    	jb     8058b5 <devcons_write+0x29>
+  }
+  return tot;
+  80593b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80593e:	48 98                	cltq
+}
+  805940:	c9                   	leave
+  805941:	c3                   	ret
+
+0000000000805942 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805942:	55                   	push   %rbp
+  805943:	48 89 e5             	mov    %rsp,%rbp
+  805946:	48 83 ec 08          	sub    $0x8,%rsp
+  80594a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80594e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805953:	c9                   	leave
+  805954:	c3                   	ret
+
+0000000000805955 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805955:	55                   	push   %rbp
+  805956:	48 89 e5             	mov    %rsp,%rbp
+  805959:	48 83 ec 10          	sub    $0x10,%rsp
+  80595d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805961:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805965:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805969:	48 ba ed 64 80 00 00 	movabs $0x8064ed,%rdx
+  805970:	00 00 00 
+  805973:	48 89 d6             	mov    %rdx,%rsi
+  805976:	48 89 c7             	mov    %rax,%rdi
+  805979:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  805980:	00 00 00 
+  805983:	ff d0                	call   *%rax
+  return 0;
+  805985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80598a:	c9                   	leave
+  80598b:	c3                   	ret
+
+000000000080598c <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80598c:	55                   	push   %rbp
+  80598d:	48 89 e5             	mov    %rsp,%rbp
+  805990:	48 83 ec 30          	sub    $0x30,%rsp
+  805994:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805998:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80599b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  80599f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8059a6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8059a9:	83 e0 02             	and    $0x2,%eax
+  8059ac:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8059af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059b3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8059b6:	83 f8 01             	cmp    $0x1,%eax
+  8059b9:	75 04                	jne    8059bf <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8059bb:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8059bf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8059c2:	83 e0 01             	and    $0x1,%eax
+  8059c5:	85 c0                	test   %eax,%eax
+  8059c7:	74 44                	je     805a0d <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8059c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8059d1:	89 c2                	mov    %eax,%edx
+  8059d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8059d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059dd:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  8059e4:	00 00 00 
+  8059e7:	ff d0                	call   *%rax
+  8059e9:	83 f8 01             	cmp    $0x1,%eax
+  8059ec:	75 06                	jne    8059f4 <devcons_poll+0x68>
+      revents |= POLLIN;
+  8059ee:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8059f2:	eb 19                	jmp    805a0d <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  8059f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059f8:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8059fe:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805a01:	89 c2                	mov    %eax,%edx
+  805a03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a07:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805a0d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805a10:	c9                   	leave
+  805a11:	c3                   	ret
+
+0000000000805a12 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805a12:	55                   	push   %rbp
+  805a13:	48 89 e5             	mov    %rsp,%rbp
+  805a16:	48 83 ec 20          	sub    $0x20,%rsp
+  805a1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a1e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a22:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805a26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805a2a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805a2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a32:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805a39:	48 89 c7             	mov    %rax,%rdi
+  805a3c:	48 b8 4a 5a 80 00 00 	movabs $0x805a4a,%rax
+  805a43:	00 00 00 
+  805a46:	ff d0                	call   *%rax
+}
+  805a48:	c9                   	leave
+  805a49:	c3                   	ret
+
+0000000000805a4a <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805a4a:	55                   	push   %rbp
+  805a4b:	48 89 e5             	mov    %rsp,%rbp
+  805a4e:	48 83 ec 30          	sub    $0x30,%rsp
+  805a52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a56:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a5a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805a5e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805a62:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805a67:	75 0e                	jne    805a77 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805a69:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a70:	00 00 00 
+  805a73:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805a77:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805a7c:	75 18                	jne    805a96 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805a7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a82:	48 89 c7             	mov    %rax,%rdi
+  805a85:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  805a8c:	00 00 00 
+  805a8f:	ff d0                	call   *%rax
+  805a91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a94:	eb 1d                	jmp    805ab3 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805a96:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a9e:	48 89 d6             	mov    %rdx,%rsi
+  805aa1:	48 89 c7             	mov    %rax,%rdi
+  805aa4:	48 b8 cd 23 80 00 00 	movabs $0x8023cd,%rax
+  805aab:	00 00 00 
+  805aae:	ff d0                	call   *%rax
+  805ab0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805ab3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ab7:	79 2a                	jns    805ae3 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805ab9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805abe:	74 0a                	je     805aca <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805ac0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ac4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805aca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805acf:	74 0a                	je     805adb <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805ad1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ad5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805adb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ade:	e9 aa 00 00 00       	jmp    805b8d <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805ae3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805ae8:	74 36                	je     805b20 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805aea:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805af1:	00 00 00 
+  805af4:	8b 40 04             	mov    0x4(%rax),%eax
+  805af7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805afc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b03:	00 00 00 
+  805b06:	48 98                	cltq
+  805b08:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b0f:	48 01 d0             	add    %rdx,%rax
+  805b12:	48 05 24 01 00 00    	add    $0x124,%rax
+  805b18:	8b 10                	mov    (%rax),%edx
+  805b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b1e:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805b20:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805b25:	74 36                	je     805b5d <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805b27:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b2e:	00 00 00 
+  805b31:	8b 40 04             	mov    0x4(%rax),%eax
+  805b34:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b39:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b40:	00 00 00 
+  805b43:	48 98                	cltq
+  805b45:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b4c:	48 01 d0             	add    %rdx,%rax
+  805b4f:	48 05 28 01 00 00    	add    $0x128,%rax
+  805b55:	8b 10                	mov    (%rax),%edx
+  805b57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b5b:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805b5d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b64:	00 00 00 
+  805b67:	8b 40 04             	mov    0x4(%rax),%eax
+  805b6a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b6f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b76:	00 00 00 
+  805b79:	48 98                	cltq
+  805b7b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b82:	48 01 d0             	add    %rdx,%rax
+  805b85:	48 05 20 01 00 00    	add    $0x120,%rax
+  805b8b:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805b8d:	c9                   	leave
+  805b8e:	c3                   	ret
+
+0000000000805b8f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805b8f:	55                   	push   %rbp
+  805b90:	48 89 e5             	mov    %rsp,%rbp
+  805b93:	48 83 ec 30          	sub    $0x30,%rsp
+  805b97:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b9a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805b9d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805ba1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805ba4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805ba9:	75 5e                	jne    805c09 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805bab:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805bb2:	00 00 00 
+  805bb5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805bb9:	eb 4e                	jmp    805c09 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805bbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bbf:	79 3c                	jns    805bfd <ipc_send+0x6e>
+  805bc1:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805bc5:	74 36                	je     805bfd <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805bc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bca:	89 c1                	mov    %eax,%ecx
+  805bcc:	48 b8 f8 64 80 00 00 	movabs $0x8064f8,%rax
+  805bd3:	00 00 00 
+  805bd6:	48 89 c2             	mov    %rax,%rdx
+  805bd9:	be 54 00 00 00       	mov    $0x54,%esi
+  805bde:	48 b8 1e 65 80 00 00 	movabs $0x80651e,%rax
+  805be5:	00 00 00 
+  805be8:	48 89 c7             	mov    %rax,%rdi
+  805beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bf0:	49 b8 aa 01 80 00 00 	movabs $0x8001aa,%r8
+  805bf7:	00 00 00 
+  805bfa:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805bfd:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  805c04:	00 00 00 
+  805c07:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c09:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805c0c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805c0f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c16:	89 c7                	mov    %eax,%edi
+  805c18:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  805c1f:	00 00 00 
+  805c22:	ff d0                	call   *%rax
+  805c24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c27:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c2b:	75 8e                	jne    805bbb <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805c2d:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  805c34:	00 00 00 
+  805c37:	ff d0                	call   *%rax
+}
+  805c39:	90                   	nop
+  805c3a:	c9                   	leave
+  805c3b:	c3                   	ret
+
+0000000000805c3c <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805c3c:	55                   	push   %rbp
+  805c3d:	48 89 e5             	mov    %rsp,%rbp
+  805c40:	48 83 ec 18          	sub    $0x18,%rsp
+  805c44:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805c47:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805c4e:	eb 4d                	jmp    805c9d <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805c50:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c57:	00 00 00 
+  805c5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c5d:	48 98                	cltq
+  805c5f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c66:	48 01 d0             	add    %rdx,%rax
+  805c69:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805c6f:	8b 00                	mov    (%rax),%eax
+  805c71:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805c74:	75 23                	jne    805c99 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805c76:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c7d:	00 00 00 
+  805c80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c83:	48 98                	cltq
+  805c85:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c8c:	48 01 d0             	add    %rdx,%rax
+  805c8f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805c95:	8b 00                	mov    (%rax),%eax
+  805c97:	eb 12                	jmp    805cab <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805c99:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805c9d:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805ca4:	7e aa                	jle    805c50 <ipc_find_env+0x14>
+  return 0;
+  805ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805cab:	c9                   	leave
+  805cac:	c3                   	ret
+
+0000000000805cad <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805cad:	55                   	push   %rbp
+  805cae:	48 89 e5             	mov    %rsp,%rbp
+  805cb1:	48 83 ec 18          	sub    $0x18,%rsp
+  805cb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805cb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cbd:	48 c1 e8 27          	shr    $0x27,%rax
+  805cc1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805cc6:	48 89 c2             	mov    %rax,%rdx
+  805cc9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805cd0:	01 00 00 
+  805cd3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805cd7:	83 e0 01             	and    $0x1,%eax
+  805cda:	48 85 c0             	test   %rax,%rax
+  805cdd:	74 63                	je     805d42 <pageref+0x95>
+  805cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ce3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805ce7:	48 89 c2             	mov    %rax,%rdx
+  805cea:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805cf1:	01 00 00 
+  805cf4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805cf8:	83 e0 01             	and    $0x1,%eax
+  805cfb:	48 85 c0             	test   %rax,%rax
+  805cfe:	74 42                	je     805d42 <pageref+0x95>
+  805d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d04:	48 c1 e8 15          	shr    $0x15,%rax
+  805d08:	48 89 c2             	mov    %rax,%rdx
+  805d0b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805d12:	01 00 00 
+  805d15:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d19:	83 e0 01             	and    $0x1,%eax
+  805d1c:	48 85 c0             	test   %rax,%rax
+  805d1f:	74 21                	je     805d42 <pageref+0x95>
+  805d21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d25:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d29:	48 89 c2             	mov    %rax,%rdx
+  805d2c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805d33:	01 00 00 
+  805d36:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d3a:	83 e0 01             	and    $0x1,%eax
+  805d3d:	48 85 c0             	test   %rax,%rax
+  805d40:	75 07                	jne    805d49 <pageref+0x9c>
+    return 0;
+  805d42:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d47:	eb 53                	jmp    805d9c <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d4d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d51:	48 89 c2             	mov    %rax,%rdx
+  805d54:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805d5b:	01 00 00 
+  805d5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805d66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d6a:	83 e0 01             	and    $0x1,%eax
+  805d6d:	48 85 c0             	test   %rax,%rax
+  805d70:	75 07                	jne    805d79 <pageref+0xcc>
+    return 0;
+  805d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d77:	eb 23                	jmp    805d9c <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805d79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d7d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d81:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805d88:	00 00 00 
+  805d8b:	48 c1 e0 04          	shl    $0x4,%rax
+  805d8f:	48 01 d0             	add    %rdx,%rax
+  805d92:	48 83 c0 08          	add    $0x8,%rax
+  805d96:	0f b7 00             	movzwl (%rax),%eax
+  805d99:	0f b7 c0             	movzwl %ax,%eax
+}
+  805d9c:	c9                   	leave
+  805d9d:	c3                   	ret
+  805d9e:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,10089 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 19 01 00 00       	call   800145 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// Let it run for a couple time slices, then kill it.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  envid_t env;
+
+  cprintf("I am the parent.  Forking the child...\n");
+  800041:	48 b8 20 64 80 00 00 	movabs $0x806420,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c7             	mov    %rax,%rdi
+  80004e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800053:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  80005a:	00 00 00 
+  80005d:	ff d2                	call   *%rdx
+  if ((env = fork()) == 0) {
+  80005f:	48 b8 08 2f 80 00 00 	movabs $0x802f08,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+  80006b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80006e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800072:	75 21                	jne    800095 <umain+0x63>
+    cprintf("I am the child.  Spinning...\n");
+  800074:	48 b8 48 64 80 00 00 	movabs $0x806448,%rax
+  80007b:	00 00 00 
+  80007e:	48 89 c7             	mov    %rax,%rdi
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  80008d:	00 00 00 
+  800090:	ff d2                	call   *%rdx
+    while (1)
+  800092:	90                   	nop
+  800093:	eb fd                	jmp    800092 <umain+0x60>
+      /* do nothing */;
+  }
+
+  cprintf("I am the parent.  Running the child...\n");
+  800095:	48 b8 68 64 80 00 00 	movabs $0x806468,%rax
+  80009c:	00 00 00 
+  80009f:	48 89 c7             	mov    %rax,%rdi
+  8000a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a7:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  8000ae:	00 00 00 
+  8000b1:	ff d2                	call   *%rdx
+  sys_yield();
+  8000b3:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+  sys_yield();
+  8000bf:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000c6:	00 00 00 
+  8000c9:	ff d0                	call   *%rax
+  sys_yield();
+  8000cb:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+  sys_yield();
+  8000d7:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+  sys_yield();
+  8000e3:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+  sys_yield();
+  8000ef:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  sys_yield();
+  8000fb:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+  sys_yield();
+  800107:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  80010e:	00 00 00 
+  800111:	ff d0                	call   *%rax
+
+  cprintf("I am the parent.  Killing the child...\n");
+  800113:	48 b8 90 64 80 00 00 	movabs $0x806490,%rax
+  80011a:	00 00 00 
+  80011d:	48 89 c7             	mov    %rax,%rdi
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  80012c:	00 00 00 
+  80012f:	ff d2                	call   *%rdx
+  sys_env_destroy(env);
+  800131:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800134:	89 c7                	mov    %eax,%edi
+  800136:	48 b8 e1 1e 80 00 00 	movabs $0x801ee1,%rax
+  80013d:	00 00 00 
+  800140:	ff d0                	call   *%rax
+}
+  800142:	90                   	nop
+  800143:	c9                   	leave
+  800144:	c3                   	ret
+
+0000000000800145 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800145:	55                   	push   %rbp
+  800146:	48 89 e5             	mov    %rsp,%rbp
+  800149:	48 83 ec 20          	sub    $0x20,%rsp
+  80014d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800150:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800154:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80015b:	00 00 00 
+  80015e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800162:	eb 13                	jmp    800177 <libmain+0x32>
+    (*ctor)();
+  800164:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800168:	48 8b 10             	mov    (%rax),%rdx
+  80016b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800170:	ff d2                	call   *%rdx
+    ctor++;
+  800172:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800177:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80017e:	00 00 00 
+  800181:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800185:	72 dd                	jb     800164 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800187:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80018b:	7e 14                	jle    8001a1 <libmain+0x5c>
+    binaryname = argv[0];
+  80018d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800191:	48 8b 00             	mov    (%rax),%rax
+  800194:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80019b:	00 00 00 
+  80019e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001a8:	48 89 d6             	mov    %rdx,%rsi
+  8001ab:	89 c7                	mov    %eax,%edi
+  8001ad:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001b9:	48 b8 c8 01 80 00 00 	movabs $0x8001c8,%rax
+  8001c0:	00 00 00 
+  8001c3:	ff d0                	call   *%rax
+#endif
+}
+  8001c5:	90                   	nop
+  8001c6:	c9                   	leave
+  8001c7:	c3                   	ret
+
+00000000008001c8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c8:	55                   	push   %rbp
+  8001c9:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001cc:	48 b8 26 33 80 00 00 	movabs $0x803326,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001dd:	48 b8 27 1f 80 00 00 	movabs $0x801f27,%rax
+  8001e4:	00 00 00 
+  8001e7:	ff d0                	call   *%rax
+}
+  8001e9:	90                   	nop
+  8001ea:	5d                   	pop    %rbp
+  8001eb:	c3                   	ret
+
+00000000008001ec <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8001f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8001fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ff:	8b 00                	mov    (%rax),%eax
+  800201:	8d 48 01             	lea    0x1(%rax),%ecx
+  800204:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800208:	89 0a                	mov    %ecx,(%rdx)
+  80020a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80020d:	89 d1                	mov    %edx,%ecx
+  80020f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800213:	48 98                	cltq
+  800215:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800219:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80021d:	8b 00                	mov    (%rax),%eax
+  80021f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800224:	75 2c                	jne    800252 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800226:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80022a:	8b 00                	mov    (%rax),%eax
+  80022c:	48 98                	cltq
+  80022e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800232:	48 83 c2 08          	add    $0x8,%rdx
+  800236:	48 89 c6             	mov    %rax,%rsi
+  800239:	48 89 d7             	mov    %rdx,%rdi
+  80023c:	48 b8 58 1e 80 00 00 	movabs $0x801e58,%rax
+  800243:	00 00 00 
+  800246:	ff d0                	call   *%rax
+    b->idx = 0;
+  800248:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800252:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800256:	8b 40 04             	mov    0x4(%rax),%eax
+  800259:	8d 50 01             	lea    0x1(%rax),%edx
+  80025c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800260:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800263:	90                   	nop
+  800264:	c9                   	leave
+  800265:	c3                   	ret
+
+0000000000800266 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800266:	55                   	push   %rbp
+  800267:	48 89 e5             	mov    %rsp,%rbp
+  80026a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800271:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800278:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80027f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800286:	00 00 00 
+  b.cnt = 0;
+  800289:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800290:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800293:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80029a:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8002a1:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002a8:	48 89 c6             	mov    %rax,%rsi
+  8002ab:	48 b8 ec 01 80 00 00 	movabs $0x8001ec,%rax
+  8002b2:	00 00 00 
+  8002b5:	48 89 c7             	mov    %rax,%rdi
+  8002b8:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8002c4:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002ca:	48 98                	cltq
+  8002cc:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002d3:	48 83 c2 08          	add    $0x8,%rdx
+  8002d7:	48 89 c6             	mov    %rax,%rsi
+  8002da:	48 89 d7             	mov    %rdx,%rdi
+  8002dd:	48 b8 58 1e 80 00 00 	movabs $0x801e58,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8002e9:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8002ef:	c9                   	leave
+  8002f0:	c3                   	ret
+
+00000000008002f1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002f1:	55                   	push   %rbp
+  8002f2:	48 89 e5             	mov    %rsp,%rbp
+  8002f5:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8002fc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800303:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80030a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800311:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800318:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80031f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800326:	84 c0                	test   %al,%al
+  800328:	74 20                	je     80034a <cprintf+0x59>
+  80032a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80032e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800332:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800336:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80033a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80033e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800342:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800346:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80034a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800351:	00 00 00 
+  800354:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80035b:	00 00 00 
+  80035e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800362:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800369:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800370:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800377:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80037e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800385:	48 89 d6             	mov    %rdx,%rsi
+  800388:	48 89 c7             	mov    %rax,%rdi
+  80038b:	48 b8 66 02 80 00 00 	movabs $0x800266,%rax
+  800392:	00 00 00 
+  800395:	ff d0                	call   *%rax
+  800397:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80039d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+
+00000000008003a5 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+  8003a9:	48 83 ec 30          	sub    $0x30,%rsp
+  8003ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003b9:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003bc:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003c0:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8003c4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003c7:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003cb:	72 54                	jb     800421 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003cd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d0:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003d3:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003df:	48 f7 f6             	div    %rsi
+  8003e2:	49 89 c2             	mov    %rax,%r10
+  8003e5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003e8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003eb:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8003ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003f3:	41 89 c9             	mov    %ecx,%r9d
+  8003f6:	41 89 f8             	mov    %edi,%r8d
+  8003f9:	89 d1                	mov    %edx,%ecx
+  8003fb:	4c 89 d2             	mov    %r10,%rdx
+  8003fe:	48 89 c7             	mov    %rax,%rdi
+  800401:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800408:	00 00 00 
+  80040b:	ff d0                	call   *%rax
+  80040d:	eb 1c                	jmp    80042b <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80040f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800413:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800416:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80041a:	48 89 d6             	mov    %rdx,%rsi
+  80041d:	89 c7                	mov    %eax,%edi
+  80041f:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800421:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800425:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800429:	7f e4                	jg     80040f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80042b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80042e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800432:	ba 00 00 00 00       	mov    $0x0,%edx
+  800437:	48 f7 f1             	div    %rcx
+  80043a:	48 b8 10 67 80 00 00 	movabs $0x806710,%rax
+  800441:	00 00 00 
+  800444:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800448:	0f be c0             	movsbl %al,%eax
+  80044b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80044f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800453:	48 89 d6             	mov    %rdx,%rsi
+  800456:	89 c7                	mov    %eax,%edi
+  800458:	ff d1                	call   *%rcx
+}
+  80045a:	90                   	nop
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+
+000000000080045d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80045d:	55                   	push   %rbp
+  80045e:	48 89 e5             	mov    %rsp,%rbp
+  800461:	48 83 ec 10          	sub    $0x10,%rsp
+  800465:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800469:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80046c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800470:	7e 4b                	jle    8004bd <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800476:	8b 00                	mov    (%rax),%eax
+  800478:	83 f8 2f             	cmp    $0x2f,%eax
+  80047b:	77 24                	ja     8004a1 <getuint+0x44>
+  80047d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800481:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800485:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800489:	8b 00                	mov    (%rax),%eax
+  80048b:	89 c0                	mov    %eax,%eax
+  80048d:	48 01 d0             	add    %rdx,%rax
+  800490:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800494:	8b 12                	mov    (%rdx),%edx
+  800496:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800499:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80049d:	89 0a                	mov    %ecx,(%rdx)
+  80049f:	eb 14                	jmp    8004b5 <getuint+0x58>
+  8004a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004a9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004b5:	48 8b 00             	mov    (%rax),%rax
+  8004b8:	e9 95 00 00 00       	jmp    800552 <getuint+0xf5>
+  else if (lflag)
+  8004bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004c1:	74 48                	je     80050b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8004c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c7:	8b 00                	mov    (%rax),%eax
+  8004c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8004cc:	77 24                	ja     8004f2 <getuint+0x95>
+  8004ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004da:	8b 00                	mov    (%rax),%eax
+  8004dc:	89 c0                	mov    %eax,%eax
+  8004de:	48 01 d0             	add    %rdx,%rax
+  8004e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e5:	8b 12                	mov    (%rdx),%edx
+  8004e7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ee:	89 0a                	mov    %ecx,(%rdx)
+  8004f0:	eb 14                	jmp    800506 <getuint+0xa9>
+  8004f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004fa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800502:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800506:	48 8b 00             	mov    (%rax),%rax
+  800509:	eb 47                	jmp    800552 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80050b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80050f:	8b 00                	mov    (%rax),%eax
+  800511:	83 f8 2f             	cmp    $0x2f,%eax
+  800514:	77 24                	ja     80053a <getuint+0xdd>
+  800516:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80051a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80051e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800522:	8b 00                	mov    (%rax),%eax
+  800524:	89 c0                	mov    %eax,%eax
+  800526:	48 01 d0             	add    %rdx,%rax
+  800529:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80052d:	8b 12                	mov    (%rdx),%edx
+  80052f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800532:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800536:	89 0a                	mov    %ecx,(%rdx)
+  800538:	eb 14                	jmp    80054e <getuint+0xf1>
+  80053a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800542:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800546:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80054a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80054e:	8b 00                	mov    (%rax),%eax
+  800550:	89 c0                	mov    %eax,%eax
+}
+  800552:	c9                   	leave
+  800553:	c3                   	ret
+
+0000000000800554 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800554:	55                   	push   %rbp
+  800555:	48 89 e5             	mov    %rsp,%rbp
+  800558:	48 83 ec 10          	sub    $0x10,%rsp
+  80055c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800560:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800563:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800567:	7e 4b                	jle    8005b4 <getint+0x60>
+    return va_arg(*ap, long long);
+  800569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80056d:	8b 00                	mov    (%rax),%eax
+  80056f:	83 f8 2f             	cmp    $0x2f,%eax
+  800572:	77 24                	ja     800598 <getint+0x44>
+  800574:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800578:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80057c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800580:	8b 00                	mov    (%rax),%eax
+  800582:	89 c0                	mov    %eax,%eax
+  800584:	48 01 d0             	add    %rdx,%rax
+  800587:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80058b:	8b 12                	mov    (%rdx),%edx
+  80058d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800590:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800594:	89 0a                	mov    %ecx,(%rdx)
+  800596:	eb 14                	jmp    8005ac <getint+0x58>
+  800598:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80059c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005a0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005a8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005ac:	48 8b 00             	mov    (%rax),%rax
+  8005af:	e9 95 00 00 00       	jmp    800649 <getint+0xf5>
+  else if (lflag)
+  8005b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005b8:	74 48                	je     800602 <getint+0xae>
+    return va_arg(*ap, long);
+  8005ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005be:	8b 00                	mov    (%rax),%eax
+  8005c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c3:	77 24                	ja     8005e9 <getint+0x95>
+  8005c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d1:	8b 00                	mov    (%rax),%eax
+  8005d3:	89 c0                	mov    %eax,%eax
+  8005d5:	48 01 d0             	add    %rdx,%rax
+  8005d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005dc:	8b 12                	mov    (%rdx),%edx
+  8005de:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005e5:	89 0a                	mov    %ecx,(%rdx)
+  8005e7:	eb 14                	jmp    8005fd <getint+0xa9>
+  8005e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005f1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005f9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005fd:	48 8b 00             	mov    (%rax),%rax
+  800600:	eb 47                	jmp    800649 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800606:	8b 00                	mov    (%rax),%eax
+  800608:	83 f8 2f             	cmp    $0x2f,%eax
+  80060b:	77 24                	ja     800631 <getint+0xdd>
+  80060d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800611:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800619:	8b 00                	mov    (%rax),%eax
+  80061b:	89 c0                	mov    %eax,%eax
+  80061d:	48 01 d0             	add    %rdx,%rax
+  800620:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800624:	8b 12                	mov    (%rdx),%edx
+  800626:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800629:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80062d:	89 0a                	mov    %ecx,(%rdx)
+  80062f:	eb 14                	jmp    800645 <getint+0xf1>
+  800631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800635:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800639:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80063d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800641:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800645:	8b 00                	mov    (%rax),%eax
+  800647:	48 98                	cltq
+}
+  800649:	c9                   	leave
+  80064a:	c3                   	ret
+
+000000000080064b <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	41 54                	push   %r12
+  800651:	53                   	push   %rbx
+  800652:	48 83 ec 60          	sub    $0x60,%rsp
+  800656:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80065a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80065e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800662:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800666:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80066a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80066e:	48 8b 06             	mov    (%rsi),%rax
+  800671:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800675:	48 89 01             	mov    %rax,(%rcx)
+  800678:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80067c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800680:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800684:	eb 17                	jmp    80069d <vprintfmt+0x52>
+      if (ch == '\0')
+  800686:	85 db                	test   %ebx,%ebx
+  800688:	0f 84 bf 04 00 00    	je     800b4d <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80068e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800692:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800696:	48 89 c6             	mov    %rax,%rsi
+  800699:	89 df                	mov    %ebx,%edi
+  80069b:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80069d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006a1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006a5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006a9:	0f b6 00             	movzbl (%rax),%eax
+  8006ac:	0f b6 d8             	movzbl %al,%ebx
+  8006af:	83 fb 25             	cmp    $0x25,%ebx
+  8006b2:	75 d2                	jne    800686 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8006b4:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8006b8:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8006bf:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8006c6:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8006cd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8006d4:	eb 04                	jmp    8006da <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8006d6:	90                   	nop
+  8006d7:	eb 01                	jmp    8006da <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8006d9:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8006da:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006de:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006e2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006e6:	0f b6 00             	movzbl (%rax),%eax
+  8006e9:	0f b6 d8             	movzbl %al,%ebx
+  8006ec:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8006ef:	83 f8 55             	cmp    $0x55,%eax
+  8006f2:	0f 87 22 04 00 00    	ja     800b1a <vprintfmt+0x4cf>
+  8006f8:	89 c0                	mov    %eax,%eax
+  8006fa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800701:	00 
+  800702:	48 b8 38 67 80 00 00 	movabs $0x806738,%rax
+  800709:	00 00 00 
+  80070c:	48 01 d0             	add    %rdx,%rax
+  80070f:	48 8b 00             	mov    (%rax),%rax
+  800712:	ff e0                	jmp    *%rax
+        padc = '-';
+  800714:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800718:	eb c0                	jmp    8006da <vprintfmt+0x8f>
+        padc = '0';
+  80071a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80071e:	eb ba                	jmp    8006da <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800720:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800727:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80072a:	89 d0                	mov    %edx,%eax
+  80072c:	c1 e0 02             	shl    $0x2,%eax
+  80072f:	01 d0                	add    %edx,%eax
+  800731:	01 c0                	add    %eax,%eax
+  800733:	01 d8                	add    %ebx,%eax
+  800735:	83 e8 30             	sub    $0x30,%eax
+  800738:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80073b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80073f:	0f b6 00             	movzbl (%rax),%eax
+  800742:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800745:	83 fb 2f             	cmp    $0x2f,%ebx
+  800748:	7e 60                	jle    8007aa <vprintfmt+0x15f>
+  80074a:	83 fb 39             	cmp    $0x39,%ebx
+  80074d:	7f 5b                	jg     8007aa <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80074f:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800754:	eb d1                	jmp    800727 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800756:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800759:	83 f8 2f             	cmp    $0x2f,%eax
+  80075c:	77 17                	ja     800775 <vprintfmt+0x12a>
+  80075e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800762:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800765:	89 d2                	mov    %edx,%edx
+  800767:	48 01 d0             	add    %rdx,%rax
+  80076a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80076d:	83 c2 08             	add    $0x8,%edx
+  800770:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800773:	eb 0c                	jmp    800781 <vprintfmt+0x136>
+  800775:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800779:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80077d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800781:	8b 00                	mov    (%rax),%eax
+  800783:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800786:	eb 23                	jmp    8007ab <vprintfmt+0x160>
+        if (width < 0)
+  800788:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80078c:	0f 89 44 ff ff ff    	jns    8006d6 <vprintfmt+0x8b>
+          width = 0;
+  800792:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800799:	e9 38 ff ff ff       	jmp    8006d6 <vprintfmt+0x8b>
+        altflag = 1;
+  80079e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8007a5:	e9 30 ff ff ff       	jmp    8006da <vprintfmt+0x8f>
+        goto process_precision;
+  8007aa:	90                   	nop
+        if (width < 0)
+  8007ab:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007af:	0f 89 24 ff ff ff    	jns    8006d9 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8007b5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007b8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007bb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8007c2:	e9 12 ff ff ff       	jmp    8006d9 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8007c7:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8007cb:	e9 0a ff ff ff       	jmp    8006da <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8007d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d6:	77 17                	ja     8007ef <vprintfmt+0x1a4>
+  8007d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007dc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007df:	89 d2                	mov    %edx,%edx
+  8007e1:	48 01 d0             	add    %rdx,%rax
+  8007e4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007e7:	83 c2 08             	add    $0x8,%edx
+  8007ea:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007ed:	eb 0c                	jmp    8007fb <vprintfmt+0x1b0>
+  8007ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8007f3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8007f7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8007fb:	8b 00                	mov    (%rax),%eax
+  8007fd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800801:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800805:	48 89 d6             	mov    %rdx,%rsi
+  800808:	89 c7                	mov    %eax,%edi
+  80080a:	ff d1                	call   *%rcx
+        break;
+  80080c:	e9 37 03 00 00       	jmp    800b48 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800811:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800814:	83 f8 2f             	cmp    $0x2f,%eax
+  800817:	77 17                	ja     800830 <vprintfmt+0x1e5>
+  800819:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80081d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800820:	89 d2                	mov    %edx,%edx
+  800822:	48 01 d0             	add    %rdx,%rax
+  800825:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800828:	83 c2 08             	add    $0x8,%edx
+  80082b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80082e:	eb 0c                	jmp    80083c <vprintfmt+0x1f1>
+  800830:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800834:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800838:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80083c:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80083e:	85 db                	test   %ebx,%ebx
+  800840:	79 02                	jns    800844 <vprintfmt+0x1f9>
+          err = -err;
+  800842:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800844:	83 fb 15             	cmp    $0x15,%ebx
+  800847:	7f 16                	jg     80085f <vprintfmt+0x214>
+  800849:	48 ba 60 66 80 00 00 	movabs $0x806660,%rdx
+  800850:	00 00 00 
+  800853:	48 63 c3             	movslq %ebx,%rax
+  800856:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80085a:	4d 85 e4             	test   %r12,%r12
+  80085d:	75 2e                	jne    80088d <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80085f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800863:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800867:	89 d9                	mov    %ebx,%ecx
+  800869:	48 ba 21 67 80 00 00 	movabs $0x806721,%rdx
+  800870:	00 00 00 
+  800873:	48 89 c7             	mov    %rax,%rdi
+  800876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087b:	49 b8 57 0b 80 00 00 	movabs $0x800b57,%r8
+  800882:	00 00 00 
+  800885:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800888:	e9 bb 02 00 00       	jmp    800b48 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80088d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800891:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800895:	4c 89 e1             	mov    %r12,%rcx
+  800898:	48 ba 2a 67 80 00 00 	movabs $0x80672a,%rdx
+  80089f:	00 00 00 
+  8008a2:	48 89 c7             	mov    %rax,%rdi
+  8008a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008aa:	49 b8 57 0b 80 00 00 	movabs $0x800b57,%r8
+  8008b1:	00 00 00 
+  8008b4:	41 ff d0             	call   *%r8
+        break;
+  8008b7:	e9 8c 02 00 00       	jmp    800b48 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8008bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c2:	77 17                	ja     8008db <vprintfmt+0x290>
+  8008c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008c8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008cb:	89 d2                	mov    %edx,%edx
+  8008cd:	48 01 d0             	add    %rdx,%rax
+  8008d0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008d3:	83 c2 08             	add    $0x8,%edx
+  8008d6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008d9:	eb 0c                	jmp    8008e7 <vprintfmt+0x29c>
+  8008db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008df:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008e3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008e7:	4c 8b 20             	mov    (%rax),%r12
+  8008ea:	4d 85 e4             	test   %r12,%r12
+  8008ed:	75 0a                	jne    8008f9 <vprintfmt+0x2ae>
+          p = "(null)";
+  8008ef:	49 bc 2d 67 80 00 00 	movabs $0x80672d,%r12
+  8008f6:	00 00 00 
+        if (width > 0 && padc != '-')
+  8008f9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008fd:	7e 78                	jle    800977 <vprintfmt+0x32c>
+  8008ff:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800903:	74 72                	je     800977 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800905:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800908:	48 98                	cltq
+  80090a:	48 89 c6             	mov    %rax,%rsi
+  80090d:	4c 89 e7             	mov    %r12,%rdi
+  800910:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  800917:	00 00 00 
+  80091a:	ff d0                	call   *%rax
+  80091c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80091f:	eb 17                	jmp    800938 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800921:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800925:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800929:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80092d:	48 89 d6             	mov    %rdx,%rsi
+  800930:	89 c7                	mov    %eax,%edi
+  800932:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800934:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800938:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80093c:	7f e3                	jg     800921 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80093e:	eb 37                	jmp    800977 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800940:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800944:	74 1e                	je     800964 <vprintfmt+0x319>
+  800946:	83 fb 1f             	cmp    $0x1f,%ebx
+  800949:	7e 05                	jle    800950 <vprintfmt+0x305>
+  80094b:	83 fb 7e             	cmp    $0x7e,%ebx
+  80094e:	7e 14                	jle    800964 <vprintfmt+0x319>
+            putch('?', putdat);
+  800950:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800954:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800958:	48 89 c6             	mov    %rax,%rsi
+  80095b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800960:	ff d2                	call   *%rdx
+  800962:	eb 0f                	jmp    800973 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800964:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800968:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80096c:	48 89 c6             	mov    %rax,%rsi
+  80096f:	89 df                	mov    %ebx,%edi
+  800971:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800973:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800977:	4c 89 e0             	mov    %r12,%rax
+  80097a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80097e:	0f b6 00             	movzbl (%rax),%eax
+  800981:	0f be d8             	movsbl %al,%ebx
+  800984:	85 db                	test   %ebx,%ebx
+  800986:	74 28                	je     8009b0 <vprintfmt+0x365>
+  800988:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80098c:	78 b2                	js     800940 <vprintfmt+0x2f5>
+  80098e:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800992:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800996:	79 a8                	jns    800940 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800998:	eb 16                	jmp    8009b0 <vprintfmt+0x365>
+          putch(' ', putdat);
+  80099a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80099e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009a2:	48 89 c6             	mov    %rax,%rsi
+  8009a5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009aa:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8009ac:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009b0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009b4:	7f e4                	jg     80099a <vprintfmt+0x34f>
+        break;
+  8009b6:	e9 8d 01 00 00       	jmp    800b48 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8009bb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009be:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009c2:	89 d6                	mov    %edx,%esi
+  8009c4:	48 89 c7             	mov    %rax,%rdi
+  8009c7:	48 b8 54 05 80 00 00 	movabs $0x800554,%rax
+  8009ce:	00 00 00 
+  8009d1:	ff d0                	call   *%rax
+  8009d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8009d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009db:	48 85 c0             	test   %rax,%rax
+  8009de:	79 1d                	jns    8009fd <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8009e0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009e4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009e8:	48 89 c6             	mov    %rax,%rsi
+  8009eb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009f0:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8009f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f6:	48 f7 d8             	neg    %rax
+  8009f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8009fd:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a04:	e9 d2 00 00 00       	jmp    800adb <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800a09:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a0c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a10:	89 d6                	mov    %edx,%esi
+  800a12:	48 89 c7             	mov    %rax,%rdi
+  800a15:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800a1c:	00 00 00 
+  800a1f:	ff d0                	call   *%rax
+  800a21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a25:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a2c:	e9 aa 00 00 00       	jmp    800adb <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800a31:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a34:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a38:	89 d6                	mov    %edx,%esi
+  800a3a:	48 89 c7             	mov    %rax,%rdi
+  800a3d:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800a44:	00 00 00 
+  800a47:	ff d0                	call   *%rax
+  800a49:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800a4d:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800a54:	e9 82 00 00 00       	jmp    800adb <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800a59:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a5d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a61:	48 89 c6             	mov    %rax,%rsi
+  800a64:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a69:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800a6b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a6f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a73:	48 89 c6             	mov    %rax,%rsi
+  800a76:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a7b:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	77 17                	ja     800a9c <vprintfmt+0x451>
+  800a85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a89:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a8c:	89 d2                	mov    %edx,%edx
+  800a8e:	48 01 d0             	add    %rdx,%rax
+  800a91:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a94:	83 c2 08             	add    $0x8,%edx
+  800a97:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a9a:	eb 0c                	jmp    800aa8 <vprintfmt+0x45d>
+  800a9c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800aa0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800aa4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800aa8:	48 8b 00             	mov    (%rax),%rax
+  800aab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800aaf:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800ab6:	eb 23                	jmp    800adb <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ab8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800abb:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800abf:	89 d6                	mov    %edx,%esi
+  800ac1:	48 89 c7             	mov    %rax,%rdi
+  800ac4:	48 b8 5d 04 80 00 00 	movabs $0x80045d,%rax
+  800acb:	00 00 00 
+  800ace:	ff d0                	call   *%rax
+  800ad0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ad4:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800adb:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ae0:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800ae3:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ae6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aea:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800aee:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800af2:	45 89 c1             	mov    %r8d,%r9d
+  800af5:	41 89 f8             	mov    %edi,%r8d
+  800af8:	48 89 c7             	mov    %rax,%rdi
+  800afb:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800b02:	00 00 00 
+  800b05:	ff d0                	call   *%rax
+        break;
+  800b07:	eb 3f                	jmp    800b48 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800b09:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b0d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b11:	48 89 c6             	mov    %rax,%rsi
+  800b14:	89 df                	mov    %ebx,%edi
+  800b16:	ff d2                	call   *%rdx
+        break;
+  800b18:	eb 2e                	jmp    800b48 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b1a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b1e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b22:	48 89 c6             	mov    %rax,%rsi
+  800b25:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b2a:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800b2c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b31:	eb 05                	jmp    800b38 <vprintfmt+0x4ed>
+  800b33:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b38:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b3c:	48 83 e8 01          	sub    $0x1,%rax
+  800b40:	0f b6 00             	movzbl (%rax),%eax
+  800b43:	3c 25                	cmp    $0x25,%al
+  800b45:	75 ec                	jne    800b33 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800b47:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b48:	e9 50 fb ff ff       	jmp    80069d <vprintfmt+0x52>
+        return;
+  800b4d:	90                   	nop
+    }
+  }
+}
+  800b4e:	48 83 c4 60          	add    $0x60,%rsp
+  800b52:	5b                   	pop    %rbx
+  800b53:	41 5c                	pop    %r12
+  800b55:	5d                   	pop    %rbp
+  800b56:	c3                   	ret
+
+0000000000800b57 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800b57:	55                   	push   %rbp
+  800b58:	48 89 e5             	mov    %rsp,%rbp
+  800b5b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b62:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b69:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b70:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b77:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b7e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b85:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b8c:	84 c0                	test   %al,%al
+  800b8e:	74 20                	je     800bb0 <printfmt+0x59>
+  800b90:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b94:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b98:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b9c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ba0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ba4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ba8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bac:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800bb0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bb7:	00 00 00 
+  800bba:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bc1:	00 00 00 
+  800bc4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bc8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800bcf:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800bd6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800bdd:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800be4:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800beb:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800bf2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800bf9:	48 89 c7             	mov    %rax,%rdi
+  800bfc:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  800c03:	00 00 00 
+  800c06:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800c08:	90                   	nop
+  800c09:	c9                   	leave
+  800c0a:	c3                   	ret
+
+0000000000800c0b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800c0b:	55                   	push   %rbp
+  800c0c:	48 89 e5             	mov    %rsp,%rbp
+  800c0f:	48 83 ec 10          	sub    $0x10,%rsp
+  800c13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c1e:	8b 40 10             	mov    0x10(%rax),%eax
+  800c21:	8d 50 01             	lea    0x1(%rax),%edx
+  800c24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c28:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800c2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2f:	48 8b 10             	mov    (%rax),%rdx
+  800c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c36:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c3a:	48 39 c2             	cmp    %rax,%rdx
+  800c3d:	73 17                	jae    800c56 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c43:	48 8b 00             	mov    (%rax),%rax
+  800c46:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c4a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c4e:	48 89 0a             	mov    %rcx,(%rdx)
+  800c51:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c54:	88 10                	mov    %dl,(%rax)
+}
+  800c56:	90                   	nop
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+0000000000800c59 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800c59:	55                   	push   %rbp
+  800c5a:	48 89 e5             	mov    %rsp,%rbp
+  800c5d:	48 83 ec 40          	sub    $0x40,%rsp
+  800c61:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c65:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800c68:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c6c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c78:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c7b:	48 98                	cltq
+  800c7d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c85:	48 01 d0             	add    %rdx,%rax
+  800c88:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c8c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800c93:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c98:	74 06                	je     800ca0 <vsnprintf+0x47>
+  800c9a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c9e:	7f 07                	jg     800ca7 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800ca0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ca5:	eb 32                	jmp    800cd9 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800ca7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800cab:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800caf:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800cb3:	48 89 c6             	mov    %rax,%rsi
+  800cb6:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  800cbd:	00 00 00 
+  800cc0:	48 89 c7             	mov    %rax,%rdi
+  800cc3:	48 b8 4b 06 80 00 00 	movabs $0x80064b,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800ccf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cd3:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800cd6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cd9:	c9                   	leave
+  800cda:	c3                   	ret
+
+0000000000800cdb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800cdb:	55                   	push   %rbp
+  800cdc:	48 89 e5             	mov    %rsp,%rbp
+  800cdf:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ce6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ced:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800cf3:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800cfa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d01:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d08:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d0f:	84 c0                	test   %al,%al
+  800d11:	74 20                	je     800d33 <snprintf+0x58>
+  800d13:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d17:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d1b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d1f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d23:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d27:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d2b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d2f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d33:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d3a:	00 00 00 
+  800d3d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d44:	00 00 00 
+  800d47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d4b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d52:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d59:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d60:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800d67:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d6e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d74:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d7b:	48 89 c7             	mov    %rax,%rdi
+  800d7e:	48 b8 59 0c 80 00 00 	movabs $0x800c59,%rax
+  800d85:	00 00 00 
+  800d88:	ff d0                	call   *%rax
+  800d8a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800d90:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800d96:	c9                   	leave
+  800d97:	c3                   	ret
+
+0000000000800d98 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	53                   	push   %rbx
+  800d9d:	48 83 ec 38          	sub    $0x38,%rsp
+  800da1:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800da4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800da8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800dac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800db0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800db4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbc:	89 d1                	mov    %edx,%ecx
+  800dbe:	0f a2                	cpuid
+  800dc0:	89 de                	mov    %ebx,%esi
+  800dc2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800dc5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800dc8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800dcb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800dce:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800dd3:	74 09                	je     800dde <cpuid+0x46>
+}
+  800dd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dd9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ddc:	89 10                	mov    %edx,(%rax)
+
+  800dde:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800de3:	74 09                	je     800dee <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800de5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800de9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800dec:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800dee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800df3:	74 09                	je     800dfe <cpuid+0x66>
+char *
+  800df5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800df9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800dfc:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800dfe:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e03:	74 09                	je     800e0e <cpuid+0x76>
+  for (; *s; s++)
+  800e05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e09:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e0c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800e0e:	90                   	nop
+  800e0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e13:	c9                   	leave
+  800e14:	c3                   	ret
+
+0000000000800e15 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800e15:	55                   	push   %rbp
+  800e16:	48 89 e5             	mov    %rsp,%rbp
+  800e19:	48 83 ec 18          	sub    $0x18,%rsp
+  800e1d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e23:	89 c1                	mov    %eax,%ecx
+  800e25:	0f 01 d0             	xgetbv
+  800e28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e2b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800e2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e31:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800e34:	48 c1 e2 20          	shl    $0x20,%rdx
+  800e38:	48 09 d0             	or     %rdx,%rax
+#else
+  800e3b:	c9                   	leave
+  800e3c:	c3                   	ret
+
+0000000000800e3d <string_cpu>:
+string_cpu(void) {
+  800e3d:	55                   	push   %rbp
+  800e3e:	48 89 e5             	mov    %rsp,%rbp
+  800e41:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800e45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800e4c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800e53:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e5a:	00 00 00 
+  800e5d:	8b 00                	mov    (%rax),%eax
+  800e5f:	85 c0                	test   %eax,%eax
+  800e61:	78 11                	js     800e74 <string_cpu+0x37>
+    return string_features;
+  800e63:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800e6a:	00 00 00 
+  800e6d:	8b 00                	mov    (%rax),%eax
+  800e6f:	e9 df 00 00 00       	jmp    800f53 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e74:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e88:	48 89 c6             	mov    %rax,%rsi
+  800e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e90:	48 b8 98 0d 80 00 00 	movabs $0x800d98,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800e9c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800e9f:	83 f8 06             	cmp    $0x6,%eax
+  800ea2:	76 28                	jbe    800ecc <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800ea4:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800ea8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800eae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb3:	48 89 c2             	mov    %rax,%rdx
+  800eb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebb:	bf 07 00 00 00       	mov    $0x7,%edi
+  800ec0:	48 b8 98 0d 80 00 00 	movabs $0x800d98,%rax
+  800ec7:	00 00 00 
+  800eca:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800ecc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800ecf:	25 00 02 00 00       	and    $0x200,%eax
+  800ed4:	85 c0                	test   %eax,%eax
+  800ed6:	74 04                	je     800edc <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800ed8:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800edc:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800ee0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ee6:	48 89 c1             	mov    %rax,%rcx
+  800ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ef8:	48 b8 98 0d 80 00 00 	movabs $0x800d98,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800f07:	83 e0 20             	and    $0x20,%eax
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	74 2a                	je     800f38 <string_cpu+0xfb>
+  800f0e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800f11:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f16:	85 c0                	test   %eax,%eax
+  800f18:	74 1e                	je     800f38 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f1f:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  800f26:	00 00 00 
+  800f29:	ff d0                	call   *%rax
+  800f2b:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f2e:	48 83 f8 06          	cmp    $0x6,%rax
+  800f32:	75 04                	jne    800f38 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800f34:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800f38:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800f3f:	00 00 00 
+  800f42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f45:	89 02                	mov    %eax,(%rdx)
+  800f47:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f4e:	00 00 00 
+  800f51:	8b 00                	mov    (%rax),%eax
+}
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+
+0000000000800f55 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f5d:	48 83 ec 60          	sub    $0x60,%rsp
+  800f61:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800f66:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f6b:	83 e0 1f             	and    $0x1f,%eax
+  800f6e:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f72:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f76:	48 f7 d8             	neg    %rax
+  800f79:	48 89 c2             	mov    %rax,%rdx
+  800f7c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f81:	48 01 d0             	add    %rdx,%rax
+  800f84:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800f89:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800f8d:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800f93:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800f98:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800f9c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fa2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fa6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800faa:	89 c2                	mov    %eax,%edx
+  800fac:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800fb0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800fb5:	89 c1                	mov    %eax,%ecx
+  800fb7:	d3 e6                	shl    %cl,%esi
+  800fb9:	89 f0                	mov    %esi,%eax
+  800fbb:	21 d0                	and    %edx,%eax
+  800fbd:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fc1:	eb 21                	jmp    800fe4 <strlen_avx2+0x8f>
+    p += 32;
+  800fc3:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800fc9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fce:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fd2:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fd8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fdc:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fe0:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fe4:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800fe9:	74 d8                	je     800fc3 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800feb:	31 c0                	xor    %eax,%eax
+  800fed:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  800ff3:	48 63 d0             	movslq %eax,%rdx
+  800ff6:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800ffb:	48 01 d0             	add    %rdx,%rax
+  800ffe:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801003:	c9                   	leave
+  801004:	c3                   	ret
+
+0000000000801005 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801005:	55                   	push   %rbp
+  801006:	48 89 e5             	mov    %rsp,%rbp
+  801009:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80100d:	48 83 ec 40          	sub    $0x40,%rsp
+  801011:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801016:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80101b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801020:	eb 77                	jmp    801099 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801022:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801027:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80102b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80102f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801034:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801038:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80103c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801040:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801044:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801049:	74 3c                	je     801087 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80104b:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80104f:	f7 d0                	not    %eax
+  801051:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801055:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801059:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80105d:	48 63 d0             	movslq %eax,%rdx
+  801060:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801065:	48 01 d0             	add    %rdx,%rax
+  801068:	0f b6 00             	movzbl (%rax),%eax
+  80106b:	0f b6 c0             	movzbl %al,%eax
+  80106e:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801072:	48 63 ca             	movslq %edx,%rcx
+  801075:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80107a:	48 01 ca             	add    %rcx,%rdx
+  80107d:	0f b6 12             	movzbl (%rdx),%edx
+  801080:	0f b6 d2             	movzbl %dl,%edx
+  801083:	29 d0                	sub    %edx,%eax
+  801085:	eb 6b                	jmp    8010f2 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801087:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80108d:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801093:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801099:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80109f:	77 81                	ja     801022 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8010a1:	eb 42                	jmp    8010e5 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8010a3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010a8:	0f b6 10             	movzbl (%rax),%edx
+  8010ab:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010b0:	0f b6 00             	movzbl (%rax),%eax
+  8010b3:	38 c2                	cmp    %al,%dl
+  8010b5:	74 1c                	je     8010d3 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8010b7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010bc:	0f b6 00             	movzbl (%rax),%eax
+  8010bf:	0f b6 c8             	movzbl %al,%ecx
+  8010c2:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010c7:	0f b6 00             	movzbl (%rax),%eax
+  8010ca:	0f b6 d0             	movzbl %al,%edx
+  8010cd:	89 c8                	mov    %ecx,%eax
+  8010cf:	29 d0                	sub    %edx,%eax
+  8010d1:	eb 1f                	jmp    8010f2 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8010d3:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010d9:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8010df:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010e5:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010eb:	75 b6                	jne    8010a3 <memcmp_avx2+0x9e>
+  return 0;
+  8010ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f2:	c9                   	leave
+  8010f3:	c3                   	ret
+
+00000000008010f4 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8010f4:	55                   	push   %rbp
+  8010f5:	48 89 e5             	mov    %rsp,%rbp
+  8010f8:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010fc:	48 83 ec 60          	sub    $0x60,%rsp
+  801100:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801105:	89 f0                	mov    %esi,%eax
+  801107:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80110c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801110:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801115:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801119:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80111e:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801124:	eb 47                	jmp    80116d <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801126:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80112b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80112f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801133:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801139:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80113d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801141:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801145:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80114a:	74 15                	je     801161 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80114c:	31 c0                	xor    %eax,%eax
+  80114e:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801154:	48 63 d0             	movslq %eax,%rdx
+  801157:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80115c:	48 01 d0             	add    %rdx,%rax
+  80115f:	eb 3d                	jmp    80119e <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801161:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801167:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80116d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801173:	77 b1                	ja     801126 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801175:	eb 0c                	jmp    801183 <memfind_avx2+0x8f>
+  801177:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80117d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801183:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801189:	74 0e                	je     801199 <memfind_avx2+0xa5>
+  80118b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801190:	0f b6 00             	movzbl (%rax),%eax
+  801193:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801197:	75 de                	jne    801177 <memfind_avx2+0x83>
+  return s;
+  801199:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80119e:	c9                   	leave
+  80119f:	c3                   	ret
+
+00000000008011a0 <strlen>:
+strlen(const char *s) {
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+  8011a4:	48 83 ec 40          	sub    $0x40,%rsp
+  8011a8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8011ac:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8011b0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8011b4:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  8011bb:	00 00 00 
+  8011be:	ff d0                	call   *%rax
+  8011c0:	83 e0 02             	and    $0x2,%eax
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	74 18                	je     8011df <strlen+0x3f>
+    return strlen_avx2(s);
+  8011c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011cb:	48 89 c7             	mov    %rax,%rdi
+  8011ce:	48 b8 55 0f 80 00 00 	movabs $0x800f55,%rax
+  8011d5:	00 00 00 
+  8011d8:	ff d0                	call   *%rax
+  8011da:	e9 82 00 00 00       	jmp    801261 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8011df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011e3:	83 e0 0f             	and    $0xf,%eax
+  8011e6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8011e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011ec:	48 f7 d8             	neg    %rax
+  8011ef:	48 89 c2             	mov    %rax,%rdx
+  8011f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011f6:	48 01 d0             	add    %rdx,%rax
+  8011f9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8011fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801201:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801205:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80120a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80120e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801212:	89 c2                	mov    %eax,%edx
+  801214:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801217:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80121c:	89 c1                	mov    %eax,%ecx
+  80121e:	d3 e6                	shl    %cl,%esi
+  801220:	89 f0                	mov    %esi,%eax
+  801222:	21 d0                	and    %edx,%eax
+  801224:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801227:	eb 1d                	jmp    801246 <strlen+0xa6>
+    p += 16;
+  801229:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80122e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801232:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801236:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80123b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80123f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801243:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801246:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80124a:	74 dd                	je     801229 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80124c:	31 c0                	xor    %eax,%eax
+  80124e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801253:	48 63 d0             	movslq %eax,%rdx
+  801256:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80125a:	48 01 d0             	add    %rdx,%rax
+  80125d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+
+0000000000801263 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	48 83 ec 20          	sub    $0x20,%rsp
+  80126b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80126f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801273:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80127a:	eb 0e                	jmp    80128a <strnlen+0x27>
+    n++;
+  80127c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801280:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801285:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80128a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80128f:	74 0b                	je     80129c <strnlen+0x39>
+  801291:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801295:	0f b6 00             	movzbl (%rax),%eax
+  801298:	84 c0                	test   %al,%al
+  80129a:	75 e0                	jne    80127c <strnlen+0x19>
+  return n;
+  80129c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80129f:	c9                   	leave
+  8012a0:	c3                   	ret
+
+00000000008012a1 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8012a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012ad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8012b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8012b9:	90                   	nop
+  8012ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012be:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012c2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ca:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012ce:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012d2:	0f b6 12             	movzbl (%rdx),%edx
+  8012d5:	88 10                	mov    %dl,(%rax)
+  8012d7:	0f b6 00             	movzbl (%rax),%eax
+  8012da:	84 c0                	test   %al,%al
+  8012dc:	75 dc                	jne    8012ba <strcpy+0x19>
+  return ret;
+  8012de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012e2:	c9                   	leave
+  8012e3:	c3                   	ret
+
+00000000008012e4 <strcat>:
+strcat(char *dst, const char *src) {
+  8012e4:	55                   	push   %rbp
+  8012e5:	48 89 e5             	mov    %rsp,%rbp
+  8012e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8012f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f8:	48 89 c7             	mov    %rax,%rdi
+  8012fb:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  801302:	00 00 00 
+  801305:	ff d0                	call   *%rax
+  801307:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80130a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80130d:	48 63 d0             	movslq %eax,%rdx
+  801310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801314:	48 01 c2             	add    %rax,%rdx
+  801317:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80131b:	48 89 c6             	mov    %rax,%rsi
+  80131e:	48 89 d7             	mov    %rdx,%rdi
+  801321:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  801328:	00 00 00 
+  80132b:	ff d0                	call   *%rax
+  return dst;
+  80132d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+0000000000801333 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+  801337:	48 83 ec 28          	sub    $0x28,%rsp
+  80133b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80133f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801343:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801347:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80134b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80134f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801356:	00 
+  801357:	eb 2a                	jmp    801383 <strncpy+0x50>
+    *dst++ = *src;
+  801359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801361:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801365:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801369:	0f b6 12             	movzbl (%rdx),%edx
+  80136c:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80136e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801372:	0f b6 00             	movzbl (%rax),%eax
+  801375:	84 c0                	test   %al,%al
+  801377:	74 05                	je     80137e <strncpy+0x4b>
+      src++;
+  801379:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80137e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801383:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801387:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80138b:	72 cc                	jb     801359 <strncpy+0x26>
+  return ret;
+  80138d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801391:	c9                   	leave
+  801392:	c3                   	ret
+
+0000000000801393 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801393:	55                   	push   %rbp
+  801394:	48 89 e5             	mov    %rsp,%rbp
+  801397:	48 83 ec 28          	sub    $0x28,%rsp
+  80139b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80139f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013a3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8013a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8013af:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013b4:	74 3d                	je     8013f3 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8013b6:	eb 1d                	jmp    8013d5 <strlcpy+0x42>
+      *dst++ = *src++;
+  8013b8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013bc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013cc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013d0:	0f b6 12             	movzbl (%rdx),%edx
+  8013d3:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8013d5:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013da:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013df:	74 0b                	je     8013ec <strlcpy+0x59>
+  8013e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013e5:	0f b6 00             	movzbl (%rax),%eax
+  8013e8:	84 c0                	test   %al,%al
+  8013ea:	75 cc                	jne    8013b8 <strlcpy+0x25>
+    *dst = '\0';
+  8013ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f0:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8013f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+
+00000000008013fd <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	48 83 ec 30          	sub    $0x30,%rsp
+  801405:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801409:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80140d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801411:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801415:	48 89 c7             	mov    %rax,%rdi
+  801418:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  80141f:	00 00 00 
+  801422:	ff d0                	call   *%rax
+  801424:	48 98                	cltq
+  801426:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80142a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80142e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801432:	48 89 d6             	mov    %rdx,%rsi
+  801435:	48 89 c7             	mov    %rax,%rdi
+  801438:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  80143f:	00 00 00 
+  801442:	ff d0                	call   *%rax
+  801444:	48 98                	cltq
+  801446:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80144a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80144e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801452:	75 10                	jne    801464 <strlcat+0x67>
+    return maxlen + srclen;
+  801454:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145c:	48 01 d0             	add    %rdx,%rax
+  80145f:	e9 86 00 00 00       	jmp    8014ea <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801464:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801468:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80146c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801470:	73 2b                	jae    80149d <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801476:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80147a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80147e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801482:	48 01 c1             	add    %rax,%rcx
+  801485:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801489:	48 89 c6             	mov    %rax,%rsi
+  80148c:	48 89 cf             	mov    %rcx,%rdi
+  80148f:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  801496:	00 00 00 
+  801499:	ff d0                	call   *%rax
+  80149b:	eb 42                	jmp    8014df <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80149d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014a1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ad:	48 01 c1             	add    %rax,%rcx
+  8014b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014b4:	48 89 c6             	mov    %rax,%rsi
+  8014b7:	48 89 cf             	mov    %rcx,%rdi
+  8014ba:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  8014c1:	00 00 00 
+  8014c4:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8014c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ce:	48 01 d0             	add    %rdx,%rax
+  8014d1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d9:	48 01 d0             	add    %rdx,%rax
+  8014dc:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8014df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e7:	48 01 d0             	add    %rdx,%rax
+}
+  8014ea:	c9                   	leave
+  8014eb:	c3                   	ret
+
+00000000008014ec <strcmp>:
+strcmp(const char *p, const char *q) {
+  8014ec:	55                   	push   %rbp
+  8014ed:	48 89 e5             	mov    %rsp,%rbp
+  8014f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8014f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8014fc:	eb 0a                	jmp    801508 <strcmp+0x1c>
+    p++, q++;
+  8014fe:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801503:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801508:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150c:	0f b6 00             	movzbl (%rax),%eax
+  80150f:	84 c0                	test   %al,%al
+  801511:	74 12                	je     801525 <strcmp+0x39>
+  801513:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801517:	0f b6 10             	movzbl (%rax),%edx
+  80151a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151e:	0f b6 00             	movzbl (%rax),%eax
+  801521:	38 c2                	cmp    %al,%dl
+  801523:	74 d9                	je     8014fe <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801525:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801529:	0f b6 00             	movzbl (%rax),%eax
+  80152c:	0f b6 d0             	movzbl %al,%edx
+  80152f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801533:	0f b6 00             	movzbl (%rax),%eax
+  801536:	0f b6 c0             	movzbl %al,%eax
+  801539:	29 c2                	sub    %eax,%edx
+  80153b:	89 d0                	mov    %edx,%eax
+}
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+
+000000000080153f <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80153f:	55                   	push   %rbp
+  801540:	48 89 e5             	mov    %rsp,%rbp
+  801543:	48 83 ec 18          	sub    $0x18,%rsp
+  801547:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80154b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80154f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801553:	eb 0f                	jmp    801564 <strncmp+0x25>
+    n--, p++, q++;
+  801555:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80155a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80155f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801564:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801569:	74 1d                	je     801588 <strncmp+0x49>
+  80156b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156f:	0f b6 00             	movzbl (%rax),%eax
+  801572:	84 c0                	test   %al,%al
+  801574:	74 12                	je     801588 <strncmp+0x49>
+  801576:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80157a:	0f b6 10             	movzbl (%rax),%edx
+  80157d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801581:	0f b6 00             	movzbl (%rax),%eax
+  801584:	38 c2                	cmp    %al,%dl
+  801586:	74 cd                	je     801555 <strncmp+0x16>
+  if (n == 0)
+  801588:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80158d:	75 07                	jne    801596 <strncmp+0x57>
+    return 0;
+  80158f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801594:	eb 16                	jmp    8015ac <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80159a:	0f b6 00             	movzbl (%rax),%eax
+  80159d:	0f b6 d0             	movzbl %al,%edx
+  8015a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a4:	0f b6 00             	movzbl (%rax),%eax
+  8015a7:	0f b6 c0             	movzbl %al,%eax
+  8015aa:	29 c2                	sub    %eax,%edx
+}
+  8015ac:	89 d0                	mov    %edx,%eax
+  8015ae:	c9                   	leave
+  8015af:	c3                   	ret
+
+00000000008015b0 <strchr>:
+strchr(const char *s, char c) {
+  8015b0:	55                   	push   %rbp
+  8015b1:	48 89 e5             	mov    %rsp,%rbp
+  8015b4:	48 83 ec 60          	sub    $0x60,%rsp
+  8015b8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8015bc:	89 f0                	mov    %esi,%eax
+  8015be:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8015c1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015c5:	83 e0 0f             	and    $0xf,%eax
+  8015c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8015cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015ce:	48 f7 d8             	neg    %rax
+  8015d1:	48 89 c2             	mov    %rax,%rdx
+  8015d4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015d8:	48 01 d0             	add    %rdx,%rax
+  8015db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8015df:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015e3:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8015e7:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8015eb:	66 0f 6e c0          	movd   %eax,%xmm0
+  8015ef:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8015f3:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8015f7:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8015fc:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801600:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801604:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801608:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80160c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801611:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801616:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80161a:	89 c2                	mov    %eax,%edx
+  80161c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801621:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801626:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80162a:	09 c2                	or     %eax,%edx
+  80162c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80162f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801634:	89 c1                	mov    %eax,%ecx
+  801636:	d3 e6                	shl    %cl,%esi
+  801638:	89 f0                	mov    %esi,%eax
+  80163a:	21 d0                	and    %edx,%eax
+  80163c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80163f:	eb 34                	jmp    801675 <strchr+0xc5>
+    p += 16;
+  801641:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80164a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80164e:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801652:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801657:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80165c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801660:	89 c2                	mov    %eax,%edx
+  801662:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801667:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80166c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801670:	09 d0                	or     %edx,%eax
+  801672:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801675:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801679:	74 c6                	je     801641 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80167b:	31 c0                	xor    %eax,%eax
+  80167d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801682:	48 98                	cltq
+  801684:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801688:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80168c:	0f b6 00             	movzbl (%rax),%eax
+  80168f:	84 c0                	test   %al,%al
+  801691:	74 06                	je     801699 <strchr+0xe9>
+  801693:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801697:	eb 05                	jmp    80169e <strchr+0xee>
+  801699:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+
+00000000008016a0 <strfind>:
+strfind(const char *s, char c) {
+  8016a0:	55                   	push   %rbp
+  8016a1:	48 89 e5             	mov    %rsp,%rbp
+  8016a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8016a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016ac:	89 f0                	mov    %esi,%eax
+  8016ae:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8016b1:	eb 11                	jmp    8016c4 <strfind+0x24>
+    if (*s == c)
+  8016b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b7:	0f b6 00             	movzbl (%rax),%eax
+  8016ba:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016bd:	74 12                	je     8016d1 <strfind+0x31>
+  for (; *s; s++)
+  8016bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c8:	0f b6 00             	movzbl (%rax),%eax
+  8016cb:	84 c0                	test   %al,%al
+  8016cd:	75 e4                	jne    8016b3 <strfind+0x13>
+  8016cf:	eb 01                	jmp    8016d2 <strfind+0x32>
+      break;
+  8016d1:	90                   	nop
+  return (char *)s;
+  8016d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016d6:	c9                   	leave
+  8016d7:	c3                   	ret
+
+00000000008016d8 <memset>:
+memset(void *v, int c, size_t n) {
+  8016d8:	55                   	push   %rbp
+  8016d9:	48 89 e5             	mov    %rsp,%rbp
+  8016dc:	48 83 ec 38          	sub    $0x38,%rsp
+  8016e0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8016e4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8016e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8016eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8016f3:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8016f8:	76 41                	jbe    80173b <memset+0x63>
+  8016fa:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  801701:	00 00 00 
+  801704:	ff d0                	call   *%rax
+  801706:	83 e0 01             	and    $0x1,%eax
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	74 2e                	je     80173b <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80170d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801710:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801714:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801718:	48 89 ce             	mov    %rcx,%rsi
+  80171b:	48 89 f7             	mov    %rsi,%rdi
+  80171e:	48 89 d1             	mov    %rdx,%rcx
+  801721:	fc                   	cld
+  801722:	f3 aa                	rep stos %al,%es:(%rdi)
+  801724:	48 89 ca             	mov    %rcx,%rdx
+  801727:	48 89 fe             	mov    %rdi,%rsi
+  80172a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80172e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801732:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801736:	e9 a7 00 00 00       	jmp    8017e2 <memset+0x10a>
+  if (n >= 8) {
+  80173b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801740:	0f 86 87 00 00 00    	jbe    8017cd <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801746:	eb 16                	jmp    80175e <memset+0x86>
+      *p++ = c;
+  801748:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801750:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801754:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801757:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801759:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80175e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801762:	83 e0 07             	and    $0x7,%eax
+  801765:	48 85 c0             	test   %rax,%rax
+  801768:	75 de                	jne    801748 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80176a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80176d:	0f b6 c0             	movzbl %al,%eax
+  801770:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801777:	01 01 01 
+  80177a:	48 0f af c2          	imul   %rdx,%rax
+  80177e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801782:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801786:	48 c1 e8 03          	shr    $0x3,%rax
+  80178a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80178e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801792:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801796:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80179a:	48 89 ce             	mov    %rcx,%rsi
+  80179d:	48 89 f7             	mov    %rsi,%rdi
+  8017a0:	48 89 d1             	mov    %rdx,%rcx
+  8017a3:	fc                   	cld
+  8017a4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8017a7:	48 89 ca             	mov    %rcx,%rdx
+  8017aa:	48 89 fe             	mov    %rdi,%rsi
+  8017ad:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8017b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8017b5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8017ba:	eb 11                	jmp    8017cd <memset+0xf5>
+    *p++ = c;
+  8017bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017c4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017c8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017cb:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8017cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017d1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017d5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017d9:	48 85 c0             	test   %rax,%rax
+  8017dc:	75 de                	jne    8017bc <memset+0xe4>
+  return v;
+  8017de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+
+00000000008017e4 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8017e4:	55                   	push   %rbp
+  8017e5:	48 89 e5             	mov    %rsp,%rbp
+  8017e8:	48 83 ec 38          	sub    $0x38,%rsp
+  8017ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017f0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8017f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801800:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801804:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801810:	0f 83 da 00 00 00    	jae    8018f0 <memmove+0x10c>
+  801816:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80181a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80181e:	48 01 d0             	add    %rdx,%rax
+  801821:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801825:	0f 83 c5 00 00 00    	jae    8018f0 <memmove+0x10c>
+    s += n;
+  80182b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80182f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801833:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801837:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80183b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801840:	0f 86 94 00 00 00    	jbe    8018da <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801846:	eb 1c                	jmp    801864 <memmove+0x80>
+        *--d = *--s;
+  801848:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80184d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801852:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801856:	0f b6 10             	movzbl (%rax),%edx
+  801859:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80185f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801864:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801868:	83 e0 07             	and    $0x7,%eax
+  80186b:	48 85 c0             	test   %rax,%rax
+  80186e:	75 d8                	jne    801848 <memmove+0x64>
+      nq = n / 8;
+  801870:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801874:	48 c1 e8 03          	shr    $0x3,%rax
+  801878:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80187c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801881:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801886:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80188b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80188f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801893:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801897:	48 89 cf             	mov    %rcx,%rdi
+  80189a:	48 89 d6             	mov    %rdx,%rsi
+  80189d:	48 89 c1             	mov    %rax,%rcx
+  8018a0:	fd                   	std
+  8018a1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018a4:	fc                   	cld
+  8018a5:	48 89 c8             	mov    %rcx,%rax
+  8018a8:	48 89 f2             	mov    %rsi,%rdx
+  8018ab:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018af:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8018b7:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8018bc:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8018c1:	eb 17                	jmp    8018da <memmove+0xf6>
+      *--d = *--s;
+  8018c3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018c8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d1:	0f b6 10             	movzbl (%rax),%edx
+  8018d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018d8:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018de:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018e6:	48 85 c0             	test   %rax,%rax
+  8018e9:	75 d8                	jne    8018c3 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8018eb:	e9 f4 00 00 00       	jmp    8019e4 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8018f0:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8018f5:	76 46                	jbe    80193d <memmove+0x159>
+  8018f7:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+  801903:	83 e0 01             	and    $0x1,%eax
+  801906:	85 c0                	test   %eax,%eax
+  801908:	74 33                	je     80193d <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80190a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80190e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801912:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801916:	48 89 cf             	mov    %rcx,%rdi
+  801919:	48 89 d6             	mov    %rdx,%rsi
+  80191c:	48 89 c1             	mov    %rax,%rcx
+  80191f:	fc                   	cld
+  801920:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801922:	48 89 c8             	mov    %rcx,%rax
+  801925:	48 89 f2             	mov    %rsi,%rdx
+  801928:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80192c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801930:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801934:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801938:	e9 ab 00 00 00       	jmp    8019e8 <memmove+0x204>
+    if (n >= 8) {
+  80193d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801942:	0f 86 8b 00 00 00    	jbe    8019d3 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801948:	eb 22                	jmp    80196c <memmove+0x188>
+        *d++ = *s++;
+  80194a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80194e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801952:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80195e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801962:	0f b6 12             	movzbl (%rdx),%edx
+  801965:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801967:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80196c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801970:	83 e0 07             	and    $0x7,%eax
+  801973:	48 85 c0             	test   %rax,%rax
+  801976:	75 d2                	jne    80194a <memmove+0x166>
+      nq = n / 8;
+  801978:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80197c:	48 c1 e8 03          	shr    $0x3,%rax
+  801980:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801984:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801988:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80198c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801990:	48 89 cf             	mov    %rcx,%rdi
+  801993:	48 89 d6             	mov    %rdx,%rsi
+  801996:	48 89 c1             	mov    %rax,%rcx
+  801999:	fc                   	cld
+  80199a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80199d:	48 89 c8             	mov    %rcx,%rax
+  8019a0:	48 89 f2             	mov    %rsi,%rdx
+  8019a3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019a7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019af:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8019b4:	eb 1d                	jmp    8019d3 <memmove+0x1ef>
+      *d++ = *s++;
+  8019b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ba:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019ca:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019ce:	0f b6 12             	movzbl (%rdx),%edx
+  8019d1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019d7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019df:	48 85 c0             	test   %rax,%rax
+  8019e2:	75 d2                	jne    8019b6 <memmove+0x1d2>
+  return dst;
+  8019e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+00000000008019ea <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8019f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019fa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8019fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a02:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a0a:	48 89 ce             	mov    %rcx,%rsi
+  801a0d:	48 89 c7             	mov    %rax,%rdi
+  801a10:	48 b8 e4 17 80 00 00 	movabs $0x8017e4,%rax
+  801a17:	00 00 00 
+  801a1a:	ff d0                	call   *%rax
+}
+  801a1c:	c9                   	leave
+  801a1d:	c3                   	ret
+
+0000000000801a1e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a1e:	55                   	push   %rbp
+  801a1f:	48 89 e5             	mov    %rsp,%rbp
+  801a22:	48 83 ec 40          	sub    $0x40,%rsp
+  801a26:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a2a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a2e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801a32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801a3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801a42:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801a47:	0f 86 a7 00 00 00    	jbe    801af4 <memcmp+0xd6>
+  801a4d:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	83 e0 02             	and    $0x2,%eax
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	0f 84 90 00 00 00    	je     801af4 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801a64:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a68:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a70:	48 89 ce             	mov    %rcx,%rsi
+  801a73:	48 89 c7             	mov    %rax,%rdi
+  801a76:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  801a7d:	00 00 00 
+  801a80:	ff d0                	call   *%rax
+  801a82:	e9 c2 00 00 00       	jmp    801b49 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a8f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801a93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a97:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801a9b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801a9f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801aa3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801aa6:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801aad:	74 36                	je     801ae5 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801aaf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ab2:	f7 d0                	not    %eax
+  801ab4:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ab8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801abb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801abe:	48 63 d0             	movslq %eax,%rdx
+  801ac1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac5:	48 01 d0             	add    %rdx,%rax
+  801ac8:	0f b6 00             	movzbl (%rax),%eax
+  801acb:	0f b6 c0             	movzbl %al,%eax
+  801ace:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ad1:	48 63 ca             	movslq %edx,%rcx
+  801ad4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ad8:	48 01 ca             	add    %rcx,%rdx
+  801adb:	0f b6 12             	movzbl (%rdx),%edx
+  801ade:	0f b6 d2             	movzbl %dl,%edx
+  801ae1:	29 d0                	sub    %edx,%eax
+  801ae3:	eb 64                	jmp    801b49 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801ae5:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801aea:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801aef:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801af4:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801af9:	77 8c                	ja     801a87 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801afb:	eb 36                	jmp    801b33 <memcmp+0x115>
+    if (*s1 != *s2)
+  801afd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b01:	0f b6 10             	movzbl (%rax),%edx
+  801b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b08:	0f b6 00             	movzbl (%rax),%eax
+  801b0b:	38 c2                	cmp    %al,%dl
+  801b0d:	74 1a                	je     801b29 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801b0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b13:	0f b6 00             	movzbl (%rax),%eax
+  801b16:	0f b6 c8             	movzbl %al,%ecx
+  801b19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b1d:	0f b6 00             	movzbl (%rax),%eax
+  801b20:	0f b6 d0             	movzbl %al,%edx
+  801b23:	89 c8                	mov    %ecx,%eax
+  801b25:	29 d0                	sub    %edx,%eax
+  801b27:	eb 20                	jmp    801b49 <memcmp+0x12b>
+    s1++, s2++;
+  801b29:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b2e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801b33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b37:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b3b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b3f:	48 85 c0             	test   %rax,%rax
+  801b42:	75 b9                	jne    801afd <memcmp+0xdf>
+  }
+
+  return 0;
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b49:	c9                   	leave
+  801b4a:	c3                   	ret
+
+0000000000801b4b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801b4b:	55                   	push   %rbp
+  801b4c:	48 89 e5             	mov    %rsp,%rbp
+  801b4f:	48 83 ec 50          	sub    $0x50,%rsp
+  801b53:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b57:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801b5a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801b5e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b62:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b66:	48 01 d0             	add    %rdx,%rax
+  801b69:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801b6d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b70:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b74:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b78:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b7c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b81:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b85:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801b8a:	76 73                	jbe    801bff <memfind+0xb4>
+  801b8c:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  801b93:	00 00 00 
+  801b96:	ff d0                	call   *%rax
+  801b98:	83 e0 02             	and    $0x2,%eax
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	74 60                	je     801bff <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801b9f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ba2:	0f b6 c8             	movzbl %al,%ecx
+  801ba5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ba9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bad:	89 ce                	mov    %ecx,%esi
+  801baf:	48 89 c7             	mov    %rax,%rdi
+  801bb2:	48 b8 f4 10 80 00 00 	movabs $0x8010f4,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	eb 6c                	jmp    801c2c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801bc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc4:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bc8:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bcc:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801bd1:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bd5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bd9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bdc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801be0:	74 13                	je     801bf5 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801be2:	31 c0                	xor    %eax,%eax
+  801be4:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801be9:	48 63 d0             	movslq %eax,%rdx
+  801bec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf0:	48 01 d0             	add    %rdx,%rax
+  801bf3:	eb 37                	jmp    801c2c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801bf5:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801bfa:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801bff:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801c04:	77 ba                	ja     801bc0 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801c06:	eb 13                	jmp    801c1b <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801c08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c0c:	0f b6 00             	movzbl (%rax),%eax
+  801c0f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801c12:	38 d0                	cmp    %dl,%al
+  801c14:	74 11                	je     801c27 <memfind+0xdc>
+  for (; s < ends; s++)
+  801c16:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c23:	72 e3                	jb     801c08 <memfind+0xbd>
+  801c25:	eb 01                	jmp    801c28 <memfind+0xdd>
+      break;
+  801c27:	90                   	nop
+  return (void *)s;
+  801c28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+
+0000000000801c2e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801c2e:	55                   	push   %rbp
+  801c2f:	48 89 e5             	mov    %rsp,%rbp
+  801c32:	48 83 ec 38          	sub    $0x38,%rsp
+  801c36:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c3a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c3e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801c41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801c48:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c4f:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801c50:	eb 05                	jmp    801c57 <strtol+0x29>
+    s++;
+  801c52:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801c57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5b:	0f b6 00             	movzbl (%rax),%eax
+  801c5e:	3c 20                	cmp    $0x20,%al
+  801c60:	74 f0                	je     801c52 <strtol+0x24>
+  801c62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c66:	0f b6 00             	movzbl (%rax),%eax
+  801c69:	3c 09                	cmp    $0x9,%al
+  801c6b:	74 e5                	je     801c52 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801c6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c71:	0f b6 00             	movzbl (%rax),%eax
+  801c74:	3c 2b                	cmp    $0x2b,%al
+  801c76:	75 07                	jne    801c7f <strtol+0x51>
+    s++;
+  801c78:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c7d:	eb 17                	jmp    801c96 <strtol+0x68>
+  else if (*s == '-')
+  801c7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c83:	0f b6 00             	movzbl (%rax),%eax
+  801c86:	3c 2d                	cmp    $0x2d,%al
+  801c88:	75 0c                	jne    801c96 <strtol+0x68>
+    s++, neg = 1;
+  801c8a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c8f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c96:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c9a:	74 06                	je     801ca2 <strtol+0x74>
+  801c9c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ca0:	75 28                	jne    801cca <strtol+0x9c>
+  801ca2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca6:	0f b6 00             	movzbl (%rax),%eax
+  801ca9:	3c 30                	cmp    $0x30,%al
+  801cab:	75 1d                	jne    801cca <strtol+0x9c>
+  801cad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb1:	48 83 c0 01          	add    $0x1,%rax
+  801cb5:	0f b6 00             	movzbl (%rax),%eax
+  801cb8:	3c 78                	cmp    $0x78,%al
+  801cba:	75 0e                	jne    801cca <strtol+0x9c>
+    s += 2, base = 16;
+  801cbc:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cc1:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cc8:	eb 2c                	jmp    801cf6 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801cca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cce:	75 19                	jne    801ce9 <strtol+0xbb>
+  801cd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd4:	0f b6 00             	movzbl (%rax),%eax
+  801cd7:	3c 30                	cmp    $0x30,%al
+  801cd9:	75 0e                	jne    801ce9 <strtol+0xbb>
+    s++, base = 8;
+  801cdb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ce0:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ce7:	eb 0d                	jmp    801cf6 <strtol+0xc8>
+  else if (base == 0)
+  801ce9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ced:	75 07                	jne    801cf6 <strtol+0xc8>
+    base = 10;
+  801cef:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801cf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfa:	0f b6 00             	movzbl (%rax),%eax
+  801cfd:	3c 2f                	cmp    $0x2f,%al
+  801cff:	7e 1d                	jle    801d1e <strtol+0xf0>
+  801d01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d05:	0f b6 00             	movzbl (%rax),%eax
+  801d08:	3c 39                	cmp    $0x39,%al
+  801d0a:	7f 12                	jg     801d1e <strtol+0xf0>
+      dig = *s - '0';
+  801d0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d10:	0f b6 00             	movzbl (%rax),%eax
+  801d13:	0f be c0             	movsbl %al,%eax
+  801d16:	83 e8 30             	sub    $0x30,%eax
+  801d19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d1c:	eb 4e                	jmp    801d6c <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d22:	0f b6 00             	movzbl (%rax),%eax
+  801d25:	3c 60                	cmp    $0x60,%al
+  801d27:	7e 1d                	jle    801d46 <strtol+0x118>
+  801d29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2d:	0f b6 00             	movzbl (%rax),%eax
+  801d30:	3c 7a                	cmp    $0x7a,%al
+  801d32:	7f 12                	jg     801d46 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801d34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d38:	0f b6 00             	movzbl (%rax),%eax
+  801d3b:	0f be c0             	movsbl %al,%eax
+  801d3e:	83 e8 57             	sub    $0x57,%eax
+  801d41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d44:	eb 26                	jmp    801d6c <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801d46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4a:	0f b6 00             	movzbl (%rax),%eax
+  801d4d:	3c 40                	cmp    $0x40,%al
+  801d4f:	7e 47                	jle    801d98 <strtol+0x16a>
+  801d51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d55:	0f b6 00             	movzbl (%rax),%eax
+  801d58:	3c 5a                	cmp    $0x5a,%al
+  801d5a:	7f 3c                	jg     801d98 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801d5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d60:	0f b6 00             	movzbl (%rax),%eax
+  801d63:	0f be c0             	movsbl %al,%eax
+  801d66:	83 e8 37             	sub    $0x37,%eax
+  801d69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801d6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d6f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d72:	7d 23                	jge    801d97 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d74:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d79:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d7c:	48 98                	cltq
+  801d7e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d83:	48 89 c2             	mov    %rax,%rdx
+  801d86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d89:	48 98                	cltq
+  801d8b:	48 01 d0             	add    %rdx,%rax
+  801d8e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801d92:	e9 5f ff ff ff       	jmp    801cf6 <strtol+0xc8>
+      break;
+  801d97:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801d98:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d9d:	74 0b                	je     801daa <strtol+0x17c>
+    *endptr = (char *)s;
+  801d9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801da7:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801daa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dae:	74 09                	je     801db9 <strtol+0x18b>
+  801db0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801db4:	48 f7 d8             	neg    %rax
+  801db7:	eb 04                	jmp    801dbd <strtol+0x18f>
+  801db9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+
+0000000000801dbf <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801dbf:	55                   	push   %rbp
+  801dc0:	48 89 e5             	mov    %rsp,%rbp
+  801dc3:	53                   	push   %rbx
+  801dc4:	48 83 ec 48          	sub    $0x48,%rsp
+  801dc8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dcc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dd0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dd4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801dd8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801ddc:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801de0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801de8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801dec:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801df0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801df4:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801df8:	4c 89 c3             	mov    %r8,%rbx
+  801dfb:	cd 30                	int    $0x30
+  801dfd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801e01:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e06:	74 46                	je     801e4e <syscall+0x8f>
+  801e08:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e0d:	7e 3f                	jle    801e4e <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801e0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e17:	49 89 d0             	mov    %rdx,%r8
+  801e1a:	48 89 c1             	mov    %rax,%rcx
+  801e1d:	48 b8 e8 69 80 00 00 	movabs $0x8069e8,%rax
+  801e24:	00 00 00 
+  801e27:	48 89 c2             	mov    %rax,%rdx
+  801e2a:	be 22 00 00 00       	mov    $0x22,%esi
+  801e2f:	48 b8 07 6a 80 00 00 	movabs $0x806a07,%rax
+  801e36:	00 00 00 
+  801e39:	48 89 c7             	mov    %rax,%rdi
+  801e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e41:	49 b9 1e 58 80 00 00 	movabs $0x80581e,%r9
+  801e48:	00 00 00 
+  801e4b:	41 ff d1             	call   *%r9
+
+  return ret;
+  801e4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e56:	c9                   	leave
+  801e57:	c3                   	ret
+
+0000000000801e58 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e58:	55                   	push   %rbp
+  801e59:	48 89 e5             	mov    %rsp,%rbp
+  801e5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e70:	48 83 ec 08          	sub    $0x8,%rsp
+  801e74:	6a 00                	push   $0x0
+  801e76:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e82:	48 89 d1             	mov    %rdx,%rcx
+  801e85:	48 89 c2             	mov    %rax,%rdx
+  801e88:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e92:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  801e99:	00 00 00 
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea2:	90                   	nop
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+0000000000801ea5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ea9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ead:	6a 00                	push   $0x0
+  801eaf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ebb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ec0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eca:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ecf:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  801ed6:	00 00 00 
+  801ed9:	ff d0                	call   *%rax
+  801edb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+0000000000801ee1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ee1:	55                   	push   %rbp
+  801ee2:	48 89 e5             	mov    %rsp,%rbp
+  801ee5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801eec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801eef:	48 98                	cltq
+  801ef1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef5:	6a 00                	push   $0x0
+  801ef7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801efd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f08:	48 89 c2             	mov    %rax,%rdx
+  801f0b:	be 01 00 00 00       	mov    $0x1,%esi
+  801f10:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f15:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+  801f21:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f25:	c9                   	leave
+  801f26:	c3                   	ret
+
+0000000000801f27 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f27:	55                   	push   %rbp
+  801f28:	48 89 e5             	mov    %rsp,%rbp
+  801f2b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f2f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801f32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f35:	48 98                	cltq
+  801f37:	48 83 ec 08          	sub    $0x8,%rsp
+  801f3b:	6a 00                	push   $0x0
+  801f3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f4e:	48 89 c2             	mov    %rax,%rdx
+  801f51:	be 00 00 00 00       	mov    $0x0,%esi
+  801f56:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f5b:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+  801f67:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f6b:	90                   	nop
+  801f6c:	c9                   	leave
+  801f6d:	c3                   	ret
+
+0000000000801f6e <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801f6e:	55                   	push   %rbp
+  801f6f:	48 89 e5             	mov    %rsp,%rbp
+  801f72:	48 83 ec 20          	sub    $0x20,%rsp
+  801f76:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f79:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f80:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801f83:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f88:	cd 30                	int    $0x30
+  801f8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f8e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801f92:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801f97:	7e 3d                	jle    801fd6 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801f99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f9d:	49 89 c0             	mov    %rax,%r8
+  801fa0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801fa5:	48 b8 e8 69 80 00 00 	movabs $0x8069e8,%rax
+  801fac:	00 00 00 
+  801faf:	48 89 c2             	mov    %rax,%rdx
+  801fb2:	be 49 00 00 00       	mov    $0x49,%esi
+  801fb7:	48 b8 07 6a 80 00 00 	movabs $0x806a07,%rax
+  801fbe:	00 00 00 
+  801fc1:	48 89 c7             	mov    %rax,%rdi
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc9:	49 b9 1e 58 80 00 00 	movabs $0x80581e,%r9
+  801fd0:	00 00 00 
+  801fd3:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801fd6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fdb:	75 13                	jne    801ff0 <sys_env_wait+0x82>
+  801fdd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801fe2:	74 0c                	je     801ff0 <sys_env_wait+0x82>
+    *status = st;
+  801fe4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fe8:	89 c2                	mov    %eax,%edx
+  801fea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fee:	89 10                	mov    %edx,(%rax)
+  return ret;
+  801ff0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801ff4:	c9                   	leave
+  801ff5:	c3                   	ret
+
+0000000000801ff6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801ffa:	48 83 ec 08          	sub    $0x8,%rsp
+  801ffe:	6a 00                	push   $0x0
+  802000:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802006:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80200c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802011:	ba 00 00 00 00       	mov    $0x0,%edx
+  802016:	be 00 00 00 00       	mov    $0x0,%esi
+  80201b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802020:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802027:	00 00 00 
+  80202a:	ff d0                	call   *%rax
+  80202c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802030:	c9                   	leave
+  802031:	c3                   	ret
+
+0000000000802032 <sys_yield>:
+
+void
+sys_yield(void) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802036:	48 83 ec 08          	sub    $0x8,%rsp
+  80203a:	6a 00                	push   $0x0
+  80203c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80204d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802052:	be 00 00 00 00       	mov    $0x0,%esi
+  802057:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80205c:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+  802068:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80206c:	90                   	nop
+  80206d:	c9                   	leave
+  80206e:	c3                   	ret
+
+000000000080206f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80206f:	55                   	push   %rbp
+  802070:	48 89 e5             	mov    %rsp,%rbp
+  802073:	48 83 ec 20          	sub    $0x20,%rsp
+  802077:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80207a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80207e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802081:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802084:	48 63 c8             	movslq %eax,%rcx
+  802087:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80208b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80208e:	48 98                	cltq
+  802090:	48 83 ec 08          	sub    $0x8,%rsp
+  802094:	6a 00                	push   $0x0
+  802096:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80209c:	49 89 c8             	mov    %rcx,%r8
+  80209f:	48 89 d1             	mov    %rdx,%rcx
+  8020a2:	48 89 c2             	mov    %rax,%rdx
+  8020a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8020aa:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020af:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8020b6:	00 00 00 
+  8020b9:	ff d0                	call   *%rax
+  8020bb:	48 83 c4 10          	add    $0x10,%rsp
+  8020bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8020c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+
+00000000008020c7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8020c7:	55                   	push   %rbp
+  8020c8:	48 89 e5             	mov    %rsp,%rbp
+  8020cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8020cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020d6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020dd:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8020e1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8020e4:	48 63 c8             	movslq %eax,%rcx
+  8020e7:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020eb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020ee:	48 63 f0             	movslq %eax,%rsi
+  8020f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020f8:	48 98                	cltq
+  8020fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8020fe:	51                   	push   %rcx
+  8020ff:	49 89 f9             	mov    %rdi,%r9
+  802102:	49 89 f0             	mov    %rsi,%r8
+  802105:	48 89 d1             	mov    %rdx,%rcx
+  802108:	48 89 c2             	mov    %rax,%rdx
+  80210b:	be 01 00 00 00       	mov    $0x1,%esi
+  802110:	bf 07 00 00 00       	mov    $0x7,%edi
+  802115:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+  802121:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802125:	c9                   	leave
+  802126:	c3                   	ret
+
+0000000000802127 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802127:	55                   	push   %rbp
+  802128:	48 89 e5             	mov    %rsp,%rbp
+  80212b:	48 83 ec 10          	sub    $0x10,%rsp
+  80212f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802132:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802136:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80213a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80213d:	48 98                	cltq
+  80213f:	48 83 ec 08          	sub    $0x8,%rsp
+  802143:	6a 00                	push   $0x0
+  802145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802151:	48 89 d1             	mov    %rdx,%rcx
+  802154:	48 89 c2             	mov    %rax,%rdx
+  802157:	be 01 00 00 00       	mov    $0x1,%esi
+  80215c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802161:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+  80216d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+0000000000802173 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802173:	55                   	push   %rbp
+  802174:	48 89 e5             	mov    %rsp,%rbp
+  802177:	48 83 ec 10          	sub    $0x10,%rsp
+  80217b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80217e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802181:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802184:	48 63 d0             	movslq %eax,%rdx
+  802187:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80218a:	48 98                	cltq
+  80218c:	48 83 ec 08          	sub    $0x8,%rsp
+  802190:	6a 00                	push   $0x0
+  802192:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80219e:	48 89 d1             	mov    %rdx,%rcx
+  8021a1:	48 89 c2             	mov    %rax,%rdx
+  8021a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021ae:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8021b5:	00 00 00 
+  8021b8:	ff d0                	call   *%rax
+  8021ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+
+00000000008021c0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8021c0:	55                   	push   %rbp
+  8021c1:	48 89 e5             	mov    %rsp,%rbp
+  8021c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8021cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021d6:	48 98                	cltq
+  8021d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8021dc:	6a 00                	push   $0x0
+  8021de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ea:	48 89 d1             	mov    %rdx,%rcx
+  8021ed:	48 89 c2             	mov    %rax,%rdx
+  8021f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8021f5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021fa:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802201:	00 00 00 
+  802204:	ff d0                	call   *%rax
+  802206:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80220a:	c9                   	leave
+  80220b:	c3                   	ret
+
+000000000080220c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80220c:	55                   	push   %rbp
+  80220d:	48 89 e5             	mov    %rsp,%rbp
+  802210:	48 83 ec 10          	sub    $0x10,%rsp
+  802214:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802217:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80221b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80221f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802222:	48 98                	cltq
+  802224:	48 83 ec 08          	sub    $0x8,%rsp
+  802228:	6a 00                	push   $0x0
+  80222a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802236:	48 89 d1             	mov    %rdx,%rcx
+  802239:	48 89 c2             	mov    %rax,%rdx
+  80223c:	be 01 00 00 00       	mov    $0x1,%esi
+  802241:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802246:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+  802252:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+0000000000802258 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802258:	55                   	push   %rbp
+  802259:	48 89 e5             	mov    %rsp,%rbp
+  80225c:	48 83 ec 20          	sub    $0x20,%rsp
+  802260:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802263:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802267:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80226b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80226e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802271:	48 63 f0             	movslq %eax,%rsi
+  802274:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802278:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80227c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80227f:	48 98                	cltq
+  802281:	48 83 ec 08          	sub    $0x8,%rsp
+  802285:	6a 00                	push   $0x0
+  802287:	49 89 f1             	mov    %rsi,%r9
+  80228a:	49 89 c8             	mov    %rcx,%r8
+  80228d:	48 89 d1             	mov    %rdx,%rcx
+  802290:	48 89 c2             	mov    %rax,%rdx
+  802293:	be 00 00 00 00       	mov    $0x0,%esi
+  802298:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80229d:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+00000000008022af <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8022bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c3:	6a 00                	push   $0x0
+  8022c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d6:	48 89 c2             	mov    %rax,%rdx
+  8022d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8022de:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8022e3:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8022ea:	00 00 00 
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f3:	c9                   	leave
+  8022f4:	c3                   	ret
+
+00000000008022f5 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8022f5:	55                   	push   %rbp
+  8022f6:	48 89 e5             	mov    %rsp,%rbp
+  8022f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802301:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802305:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802309:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80230d:	48 83 ec 08          	sub    $0x8,%rsp
+  802311:	6a 00                	push   $0x0
+  802313:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802319:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80231f:	48 89 d1             	mov    %rdx,%rcx
+  802322:	48 89 c2             	mov    %rax,%rdx
+  802325:	be 01 00 00 00       	mov    $0x1,%esi
+  80232a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80232f:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+  80233b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+
+0000000000802341 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802345:	48 83 ec 08          	sub    $0x8,%rsp
+  802349:	6a 00                	push   $0x0
+  80234b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802351:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802357:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80235c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802361:	be 00 00 00 00       	mov    $0x0,%esi
+  802366:	bf 11 00 00 00       	mov    $0x11,%edi
+  80236b:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802372:	00 00 00 
+  802375:	ff d0                	call   *%rax
+  802377:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80237b:	c9                   	leave
+  80237c:	c3                   	ret
+
+000000000080237d <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80237d:	55                   	push   %rbp
+  80237e:	48 89 e5             	mov    %rsp,%rbp
+  802381:	48 83 ec 10          	sub    $0x10,%rsp
+  802385:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802389:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80238d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802395:	48 83 ec 08          	sub    $0x8,%rsp
+  802399:	6a 00                	push   $0x0
+  80239b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a7:	48 89 d1             	mov    %rdx,%rcx
+  8023aa:	48 89 c2             	mov    %rax,%rdx
+  8023ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b2:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023b7:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+00000000008023c9 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8023c9:	55                   	push   %rbp
+  8023ca:	48 89 e5             	mov    %rsp,%rbp
+  8023cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8023d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023d5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023d9:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8023dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023df:	48 63 c8             	movslq %eax,%rcx
+  8023e2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ee:	6a 00                	push   $0x0
+  8023f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f6:	49 89 c8             	mov    %rcx,%r8
+  8023f9:	48 89 d1             	mov    %rdx,%rcx
+  8023fc:	48 89 c2             	mov    %rax,%rdx
+  8023ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802404:	bf 13 00 00 00       	mov    $0x13,%edi
+  802409:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+  802415:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802419:	c9                   	leave
+  80241a:	c3                   	ret
+
+000000000080241b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80241b:	55                   	push   %rbp
+  80241c:	48 89 e5             	mov    %rsp,%rbp
+  80241f:	48 83 ec 20          	sub    $0x20,%rsp
+  802423:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802427:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80242a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80242e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802432:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802439:	48 83 ec 08          	sub    $0x8,%rsp
+  80243d:	6a 00                	push   $0x0
+  80243f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802445:	49 89 c8             	mov    %rcx,%r8
+  802448:	48 89 d1             	mov    %rdx,%rcx
+  80244b:	48 89 c2             	mov    %rax,%rdx
+  80244e:	be 00 00 00 00       	mov    $0x0,%esi
+  802453:	bf 14 00 00 00       	mov    $0x14,%edi
+  802458:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  80245f:	00 00 00 
+  802462:	ff d0                	call   *%rax
+  802464:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802468:	c9                   	leave
+  802469:	c3                   	ret
+
+000000000080246a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80246a:	55                   	push   %rbp
+  80246b:	48 89 e5             	mov    %rsp,%rbp
+  80246e:	48 83 ec 10          	sub    $0x10,%rsp
+  802472:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802476:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802479:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80247c:	48 63 d0             	movslq %eax,%rdx
+  80247f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802483:	48 83 ec 08          	sub    $0x8,%rsp
+  802487:	6a 00                	push   $0x0
+  802489:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80248f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802495:	48 89 d1             	mov    %rdx,%rcx
+  802498:	48 89 c2             	mov    %rax,%rdx
+  80249b:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a0:	bf 15 00 00 00       	mov    $0x15,%edi
+  8024a5:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+  8024b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024b5:	c9                   	leave
+  8024b6:	c3                   	ret
+
+00000000008024b7 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8024b7:	55                   	push   %rbp
+  8024b8:	48 89 e5             	mov    %rsp,%rbp
+  8024bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8024bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024c6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8024c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8024cd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024d1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8024d4:	48 63 c8             	movslq %eax,%rcx
+  8024d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024da:	48 63 d0             	movslq %eax,%rdx
+  8024dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e5:	6a 00                	push   $0x0
+  8024e7:	49 89 f1             	mov    %rsi,%r9
+  8024ea:	49 89 c8             	mov    %rcx,%r8
+  8024ed:	48 89 d1             	mov    %rdx,%rcx
+  8024f0:	48 89 c2             	mov    %rax,%rdx
+  8024f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f8:	bf 16 00 00 00       	mov    $0x16,%edi
+  8024fd:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80250d:	c9                   	leave
+  80250e:	c3                   	ret
+
+000000000080250f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80250f:	55                   	push   %rbp
+  802510:	48 89 e5             	mov    %rsp,%rbp
+  802513:	48 83 ec 30          	sub    $0x30,%rsp
+  802517:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80251b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80251f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802523:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802527:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80252b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80252f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802533:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802537:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80253b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253f:	48 83 ec 08          	sub    $0x8,%rsp
+  802543:	51                   	push   %rcx
+  802544:	49 89 f9             	mov    %rdi,%r9
+  802547:	49 89 f0             	mov    %rsi,%r8
+  80254a:	48 89 d1             	mov    %rdx,%rcx
+  80254d:	48 89 c2             	mov    %rax,%rdx
+  802550:	be 00 00 00 00       	mov    $0x0,%esi
+  802555:	bf 17 00 00 00       	mov    $0x17,%edi
+  80255a:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+  802566:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+
+000000000080256c <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80256c:	55                   	push   %rbp
+  80256d:	48 89 e5             	mov    %rsp,%rbp
+  802570:	48 83 ec 10          	sub    $0x10,%rsp
+  802574:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802577:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80257a:	48 98                	cltq
+  80257c:	48 83 ec 08          	sub    $0x8,%rsp
+  802580:	6a 00                	push   $0x0
+  802582:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80258e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802593:	48 89 c2             	mov    %rax,%rdx
+  802596:	be 00 00 00 00       	mov    $0x0,%esi
+  80259b:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025a0:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8025a7:	00 00 00 
+  8025aa:	ff d0                	call   *%rax
+  8025ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b0:	90                   	nop
+  8025b1:	c9                   	leave
+  8025b2:	c3                   	ret
+
+00000000008025b3 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8025b3:	55                   	push   %rbp
+  8025b4:	48 89 e5             	mov    %rsp,%rbp
+  8025b7:	48 83 ec 30          	sub    $0x30,%rsp
+  8025bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025c2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025c6:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8025c9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025cc:	48 63 f0             	movslq %eax,%rsi
+  8025cf:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025da:	48 98                	cltq
+  8025dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e0:	6a 00                	push   $0x0
+  8025e2:	49 89 f1             	mov    %rsi,%r9
+  8025e5:	49 89 c8             	mov    %rcx,%r8
+  8025e8:	48 89 d1             	mov    %rdx,%rcx
+  8025eb:	48 89 c2             	mov    %rax,%rdx
+  8025ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8025f3:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025f8:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	48 83 c4 10          	add    $0x10,%rsp
+  802608:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80260b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+0000000000802610 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	48 83 ec 20          	sub    $0x20,%rsp
+  802618:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80261c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802620:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802623:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802626:	48 63 c8             	movslq %eax,%rcx
+  802629:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80262d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802631:	48 83 ec 08          	sub    $0x8,%rsp
+  802635:	6a 00                	push   $0x0
+  802637:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80263d:	49 89 c8             	mov    %rcx,%r8
+  802640:	48 89 d1             	mov    %rdx,%rcx
+  802643:	48 89 c2             	mov    %rax,%rdx
+  802646:	be 01 00 00 00       	mov    $0x1,%esi
+  80264b:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802650:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802657:	00 00 00 
+  80265a:	ff d0                	call   *%rax
+  80265c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802660:	c9                   	leave
+  802661:	c3                   	ret
+
+0000000000802662 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802662:	55                   	push   %rbp
+  802663:	48 89 e5             	mov    %rsp,%rbp
+  802666:	48 83 ec 20          	sub    $0x20,%rsp
+  80266a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80266e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802672:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802676:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80267a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80267e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802682:	48 83 ec 08          	sub    $0x8,%rsp
+  802686:	6a 00                	push   $0x0
+  802688:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80268e:	49 89 c8             	mov    %rcx,%r8
+  802691:	48 89 d1             	mov    %rdx,%rcx
+  802694:	48 89 c2             	mov    %rax,%rdx
+  802697:	be 01 00 00 00       	mov    $0x1,%esi
+  80269c:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8026a1:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+  8026ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b1:	c9                   	leave
+  8026b2:	c3                   	ret
+
+00000000008026b3 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8026b3:	55                   	push   %rbp
+  8026b4:	48 89 e5             	mov    %rsp,%rbp
+  8026b7:	48 83 ec 30          	sub    $0x30,%rsp
+  8026bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8026bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026c3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8026c6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8026ca:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026d1:	48 63 c8             	movslq %eax,%rcx
+  8026d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e0:	6a 00                	push   $0x0
+  8026e2:	49 89 f1             	mov    %rsi,%r9
+  8026e5:	49 89 c8             	mov    %rcx,%r8
+  8026e8:	48 89 d1             	mov    %rdx,%rcx
+  8026eb:	48 89 c2             	mov    %rax,%rdx
+  8026ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8026f3:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8026f8:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  8026ff:	00 00 00 
+  802702:	ff d0                	call   *%rax
+  802704:	48 83 c4 10          	add    $0x10,%rsp
+  802708:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80270b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80270e:	c9                   	leave
+  80270f:	c3                   	ret
+
+0000000000802710 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802710:	55                   	push   %rbp
+  802711:	48 89 e5             	mov    %rsp,%rbp
+  802714:	48 83 ec 10          	sub    $0x10,%rsp
+  802718:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80271b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80271e:	48 98                	cltq
+  802720:	48 83 ec 08          	sub    $0x8,%rsp
+  802724:	6a 00                	push   $0x0
+  802726:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80272c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802732:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802737:	48 89 c2             	mov    %rax,%rdx
+  80273a:	be 01 00 00 00       	mov    $0x1,%esi
+  80273f:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802744:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  80274b:	00 00 00 
+  80274e:	ff d0                	call   *%rax
+  802750:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802754:	c9                   	leave
+  802755:	c3                   	ret
+
+0000000000802756 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802756:	55                   	push   %rbp
+  802757:	48 89 e5             	mov    %rsp,%rbp
+  80275a:	48 83 ec 40          	sub    $0x40,%rsp
+  80275e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802762:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802766:	48 8b 00             	mov    (%rax),%rax
+  802769:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  80276d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802771:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802775:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80277d:	83 e0 02             	and    $0x2,%eax
+  802780:	48 85 c0             	test   %rax,%rax
+  802783:	74 25                	je     8027aa <pgfault+0x54>
+  802785:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802789:	48 c1 e8 0c          	shr    $0xc,%rax
+  80278d:	48 89 c2             	mov    %rax,%rdx
+  802790:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802797:	01 00 00 
+  80279a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80279e:	83 e0 02             	and    $0x2,%eax
+  8027a1:	48 85 c0             	test   %rax,%rax
+  8027a4:	0f 85 fe 01 00 00    	jne    8029a8 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8027aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027ae:	83 e0 02             	and    $0x2,%eax
+  8027b1:	48 85 c0             	test   %rax,%rax
+  8027b4:	74 23                	je     8027d9 <pgfault+0x83>
+  8027b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8027be:	48 89 c2             	mov    %rax,%rdx
+  8027c1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027c8:	01 00 00 
+  8027cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027cf:	25 00 08 00 00       	and    $0x800,%eax
+  8027d4:	48 85 c0             	test   %rax,%rax
+  8027d7:	75 3f                	jne    802818 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8027d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027e1:	49 89 d0             	mov    %rdx,%r8
+  8027e4:	48 89 c1             	mov    %rax,%rcx
+  8027e7:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  8027ee:	00 00 00 
+  8027f1:	48 89 c2             	mov    %rax,%rdx
+  8027f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8027f9:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802800:	00 00 00 
+  802803:	48 89 c7             	mov    %rax,%rdi
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280b:	49 b9 1e 58 80 00 00 	movabs $0x80581e,%r9
+  802812:	00 00 00 
+  802815:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802818:	48 b8 6c 53 80 00 00 	movabs $0x80536c,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+  802824:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80282c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802831:	48 89 c6             	mov    %rax,%rsi
+  802834:	bf 00 00 00 00       	mov    $0x0,%edi
+  802839:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802848:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80284c:	79 36                	jns    802884 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  80284e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802851:	89 c1                	mov    %eax,%ecx
+  802853:	48 b8 58 6a 80 00 00 	movabs $0x806a58,%rax
+  80285a:	00 00 00 
+  80285d:	48 89 c2             	mov    %rax,%rdx
+  802860:	be 35 00 00 00       	mov    $0x35,%esi
+  802865:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  80286c:	00 00 00 
+  80286f:	48 89 c7             	mov    %rax,%rdi
+  802872:	b8 00 00 00 00       	mov    $0x0,%eax
+  802877:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  80287e:	00 00 00 
+  802881:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802888:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80288c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802890:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802896:	48 89 c1             	mov    %rax,%rcx
+  802899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80289d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028a2:	48 89 ce             	mov    %rcx,%rsi
+  8028a5:	48 89 c7             	mov    %rax,%rdi
+  8028a8:	48 b8 e4 17 80 00 00 	movabs $0x8017e4,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8028b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028bc:	48 89 c2             	mov    %rax,%rdx
+  8028bf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028c6:	01 00 00 
+  8028c9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028cd:	25 00 08 00 00       	and    $0x800,%eax
+  8028d2:	48 85 c0             	test   %rax,%rax
+  8028d5:	74 7a                	je     802951 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8028d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028db:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8028df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8028e9:	48 89 c2             	mov    %rax,%rdx
+  8028ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028f0:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8028f6:	48 89 d1             	mov    %rdx,%rcx
+  8028f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fe:	48 89 c6             	mov    %rax,%rsi
+  802901:	bf 00 00 00 00       	mov    $0x0,%edi
+  802906:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+  802912:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802915:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802919:	79 36                	jns    802951 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  80291b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80291e:	89 c1                	mov    %eax,%ecx
+  802920:	48 b8 80 6a 80 00 00 	movabs $0x806a80,%rax
+  802927:	00 00 00 
+  80292a:	48 89 c2             	mov    %rax,%rdx
+  80292d:	be 42 00 00 00       	mov    $0x42,%esi
+  802932:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802939:	00 00 00 
+  80293c:	48 89 c7             	mov    %rax,%rdi
+  80293f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802944:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  80294b:	00 00 00 
+  80294e:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802955:	48 89 c6             	mov    %rax,%rsi
+  802958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295d:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+  802969:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80296c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802970:	79 37                	jns    8029a9 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802972:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802975:	89 c1                	mov    %eax,%ecx
+  802977:	48 b8 a8 6a 80 00 00 	movabs $0x806aa8,%rax
+  80297e:	00 00 00 
+  802981:	48 89 c2             	mov    %rax,%rdx
+  802984:	be 46 00 00 00       	mov    $0x46,%esi
+  802989:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802990:	00 00 00 
+  802993:	48 89 c7             	mov    %rax,%rdi
+  802996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299b:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  8029a2:	00 00 00 
+  8029a5:	41 ff d0             	call   *%r8
+    return;
+  8029a8:	90                   	nop
+  }
+}
+  8029a9:	c9                   	leave
+  8029aa:	c3                   	ret
+
+00000000008029ab <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  8029ab:	55                   	push   %rbp
+  8029ac:	48 89 e5             	mov    %rsp,%rbp
+  8029af:	48 83 ec 30          	sub    $0x30,%rsp
+  8029b3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8029b6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  8029ba:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8029c1:	01 00 00 
+  8029c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029c8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8029d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  8029d5:	48 b8 f6 1f 80 00 00 	movabs $0x801ff6,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  8029e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8029ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  8029f0:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8029f7:	01 00 00 
+  8029fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a02:	25 00 04 00 00       	and    $0x400,%eax
+  802a07:	48 85 c0             	test   %rax,%rax
+  802a0a:	74 7b                	je     802a87 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802a0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a10:	89 c1                	mov    %eax,%ecx
+  802a12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a16:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a1a:	48 89 c2             	mov    %rax,%rdx
+  802a1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a21:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a25:	48 89 c6             	mov    %rax,%rsi
+  802a28:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a2b:	41 89 c8             	mov    %ecx,%r8d
+  802a2e:	48 89 d1             	mov    %rdx,%rcx
+  802a31:	89 c2                	mov    %eax,%edx
+  802a33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a38:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802a4b:	0f 89 da 00 00 00    	jns    802b2b <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802a51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a54:	89 c1                	mov    %eax,%ecx
+  802a56:	48 b8 d0 6a 80 00 00 	movabs $0x806ad0,%rax
+  802a5d:	00 00 00 
+  802a60:	48 89 c2             	mov    %rax,%rdx
+  802a63:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802a68:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802a6f:	00 00 00 
+  802a72:	48 89 c7             	mov    %rax,%rdi
+  802a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a7a:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  802a81:	00 00 00 
+  802a84:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a8b:	25 02 08 00 00       	and    $0x802,%eax
+  802a90:	48 85 c0             	test   %rax,%rax
+  802a93:	74 6e                	je     802b03 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a99:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802a9f:	80 cc 08             	or     $0x8,%ah
+  802aa2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802aa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aaa:	89 c7                	mov    %eax,%edi
+  802aac:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ab0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ab3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ab7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802aba:	41 89 f8             	mov    %edi,%r8d
+  802abd:	89 c7                	mov    %eax,%edi
+  802abf:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  802ac6:	00 00 00 
+  802ac9:	ff d0                	call   *%rax
+  802acb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802ace:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ad2:	79 05                	jns    802ad9 <duppage+0x12e>
+      return r;
+  802ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ad7:	eb 55                	jmp    802b2e <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802ad9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802add:	89 c7                	mov    %eax,%edi
+  802adf:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ae3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ae6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802aea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802aed:	41 89 f8             	mov    %edi,%r8d
+  802af0:	89 c7                	mov    %eax,%edi
+  802af2:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+  802afe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b01:	eb 28                	jmp    802b2b <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b07:	89 c7                	mov    %eax,%edi
+  802b09:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b0d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802b10:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802b14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b17:	41 89 f8             	mov    %edi,%r8d
+  802b1a:	89 c7                	mov    %eax,%edi
+  802b1c:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+  802b28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802b2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b2e:	c9                   	leave
+  802b2f:	c3                   	ret
+
+0000000000802b30 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802b30:	55                   	push   %rbp
+  802b31:	48 89 e5             	mov    %rsp,%rbp
+  802b34:	48 83 ec 20          	sub    $0x20,%rsp
+  802b38:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b3b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802b3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b43:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802b4b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b52:	01 00 00 
+  802b55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b5d:	25 00 08 00 00       	and    $0x800,%eax
+  802b62:	48 85 c0             	test   %rax,%rax
+  802b65:	74 0d                	je     802b74 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b6b:	0f b6 10             	movzbl (%rax),%edx
+  802b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b72:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802b74:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b7b:	01 00 00 
+  802b7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b82:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b86:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b8b:	89 c6                	mov    %eax,%esi
+  802b8d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802b91:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802b94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b98:	41 89 f0             	mov    %esi,%r8d
+  802b9b:	48 89 c6             	mov    %rax,%rsi
+  802b9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba3:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  802baa:	00 00 00 
+  802bad:	ff d0                	call   *%rax
+}
+  802baf:	c9                   	leave
+  802bb0:	c3                   	ret
+
+0000000000802bb1 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802bb1:	55                   	push   %rbp
+  802bb2:	48 89 e5             	mov    %rsp,%rbp
+  802bb5:	48 83 ec 40          	sub    $0x40,%rsp
+  802bb9:	89 f8                	mov    %edi,%eax
+  802bbb:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802bbe:	48 b8 56 27 80 00 00 	movabs $0x802756,%rax
+  802bc5:	00 00 00 
+  802bc8:	48 89 c7             	mov    %rax,%rdi
+  802bcb:	48 b8 38 59 80 00 00 	movabs $0x805938,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802bd7:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bdc:	cd 30                	int    $0x30
+  802bde:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802be1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802be4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802be7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802beb:	79 36                	jns    802c23 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bf0:	89 c1                	mov    %eax,%ecx
+  802bf2:	48 b8 fb 6a 80 00 00 	movabs $0x806afb,%rax
+  802bf9:	00 00 00 
+  802bfc:	48 89 c2             	mov    %rax,%rdx
+  802bff:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802c04:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802c0b:	00 00 00 
+  802c0e:	48 89 c7             	mov    %rax,%rdi
+  802c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c16:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  802c1d:	00 00 00 
+  802c20:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802c23:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c27:	75 0a                	jne    802c33 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2e:	e9 d3 02 00 00       	jmp    802f06 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802c33:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802c3a:	00 
+  802c3b:	e9 7a 01 00 00       	jmp    802dba <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802c40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c44:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c48:	48 c1 e8 27          	shr    $0x27,%rax
+  802c4c:	48 89 c2             	mov    %rax,%rdx
+  802c4f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c56:	01 00 00 
+  802c59:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c5d:	83 e0 01             	and    $0x1,%eax
+  802c60:	48 85 c0             	test   %rax,%rax
+  802c63:	0f 84 4c 01 00 00    	je     802db5 <fork_common+0x204>
+  802c69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c6d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c71:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c75:	48 89 c2             	mov    %rax,%rdx
+  802c78:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c7f:	01 00 00 
+  802c82:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c86:	83 e0 01             	and    $0x1,%eax
+  802c89:	48 85 c0             	test   %rax,%rax
+  802c8c:	0f 84 23 01 00 00    	je     802db5 <fork_common+0x204>
+  802c92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c96:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c9a:	48 c1 e8 15          	shr    $0x15,%rax
+  802c9e:	48 89 c2             	mov    %rax,%rdx
+  802ca1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802ca8:	01 00 00 
+  802cab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802caf:	83 e0 01             	and    $0x1,%eax
+  802cb2:	48 85 c0             	test   %rax,%rax
+  802cb5:	0f 84 fa 00 00 00    	je     802db5 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802cbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cbf:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cc3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802cc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ccb:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802cd2:	00 00 00 
+  802cd5:	48 39 c2             	cmp    %rax,%rdx
+  802cd8:	0f 82 d7 00 00 00    	jb     802db5 <fork_common+0x204>
+  802cde:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802ce5:	00 00 00 
+  802ce8:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802cec:	0f 84 c3 00 00 00    	je     802db5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802cf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cf6:	48 89 c7             	mov    %rax,%rdi
+  802cf9:	48 b8 28 53 80 00 00 	movabs $0x805328,%rax
+  802d00:	00 00 00 
+  802d03:	ff d0                	call   *%rax
+  802d05:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802d08:	84 c0                	test   %al,%al
+  802d0a:	0f 84 a5 00 00 00    	je     802db5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802d10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d14:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d18:	48 89 c2             	mov    %rax,%rdx
+  802d1b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d22:	01 00 00 
+  802d25:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d29:	83 e0 01             	and    $0x1,%eax
+  802d2c:	48 85 c0             	test   %rax,%rax
+  802d2f:	0f 84 80 00 00 00    	je     802db5 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802d35:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802d39:	74 4a                	je     802d85 <fork_common+0x1d4>
+  802d3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d3f:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802d46:	00 00 00 
+  802d49:	48 39 c2             	cmp    %rax,%rdx
+  802d4c:	73 13                	jae    802d61 <fork_common+0x1b0>
+  802d4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d52:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802d59:	00 00 00 
+  802d5c:	48 39 c2             	cmp    %rax,%rdx
+  802d5f:	73 24                	jae    802d85 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802d61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d65:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d69:	48 89 c2             	mov    %rax,%rdx
+  802d6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d6f:	48 89 d6             	mov    %rdx,%rsi
+  802d72:	89 c7                	mov    %eax,%edi
+  802d74:	48 b8 30 2b 80 00 00 	movabs $0x802b30,%rax
+  802d7b:	00 00 00 
+  802d7e:	ff d0                	call   *%rax
+  802d80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d83:	eb 22                	jmp    802da7 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802d85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d89:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d8d:	48 89 c2             	mov    %rax,%rdx
+  802d90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d93:	48 89 d6             	mov    %rdx,%rsi
+  802d96:	89 c7                	mov    %eax,%edi
+  802d98:	48 b8 ab 29 80 00 00 	movabs $0x8029ab,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+  802da4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802da7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dab:	79 08                	jns    802db5 <fork_common+0x204>
+            return r;
+  802dad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802db0:	e9 51 01 00 00       	jmp    802f06 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802db5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802dba:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802dc1:	07 
+  802dc2:	0f 86 78 fe ff ff    	jbe    802c40 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802dc8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802dcf:	00 00 00 
+  802dd2:	8b 40 04             	mov    0x4(%rax),%eax
+  802dd5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802dda:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802de1:	00 00 00 
+  802de4:	48 98                	cltq
+  802de6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802ded:	48 01 d0             	add    %rdx,%rax
+  802df0:	48 05 00 01 00 00    	add    $0x100,%rax
+  802df6:	48 8b 10             	mov    (%rax),%rdx
+  802df9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dfc:	48 89 d6             	mov    %rdx,%rsi
+  802dff:	89 c7                	mov    %eax,%edi
+  802e01:	48 b8 0c 22 80 00 00 	movabs $0x80220c,%rax
+  802e08:	00 00 00 
+  802e0b:	ff d0                	call   *%rax
+  802e0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e14:	79 36                	jns    802e4c <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802e16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e19:	89 c1                	mov    %eax,%ecx
+  802e1b:	48 b8 10 6b 80 00 00 	movabs $0x806b10,%rax
+  802e22:	00 00 00 
+  802e25:	48 89 c2             	mov    %rax,%rdx
+  802e28:	be be 00 00 00       	mov    $0xbe,%esi
+  802e2d:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802e34:	00 00 00 
+  802e37:	48 89 c7             	mov    %rax,%rdi
+  802e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3f:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  802e46:	00 00 00 
+  802e49:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e4f:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e54:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802e5b:	00 00 00 
+  802e5e:	48 89 ce             	mov    %rcx,%rsi
+  802e61:	89 c7                	mov    %eax,%edi
+  802e63:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e72:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e76:	79 36                	jns    802eae <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  802e78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e7b:	89 c1                	mov    %eax,%ecx
+  802e7d:	48 b8 40 6b 80 00 00 	movabs $0x806b40,%rax
+  802e84:	00 00 00 
+  802e87:	48 89 c2             	mov    %rax,%rdx
+  802e8a:	be c1 00 00 00       	mov    $0xc1,%esi
+  802e8f:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802e96:	00 00 00 
+  802e99:	48 89 c7             	mov    %rax,%rdi
+  802e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea1:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  802ea8:	00 00 00 
+  802eab:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  802eae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eb1:	be 02 00 00 00       	mov    $0x2,%esi
+  802eb6:	89 c7                	mov    %eax,%edi
+  802eb8:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  802ebf:	00 00 00 
+  802ec2:	ff d0                	call   *%rax
+  802ec4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ec7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ecb:	79 36                	jns    802f03 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  802ecd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ed0:	89 c1                	mov    %eax,%ecx
+  802ed2:	48 b8 60 6b 80 00 00 	movabs $0x806b60,%rax
+  802ed9:	00 00 00 
+  802edc:	48 89 c2             	mov    %rax,%rdx
+  802edf:	be d4 00 00 00       	mov    $0xd4,%esi
+  802ee4:	48 b8 46 6a 80 00 00 	movabs $0x806a46,%rax
+  802eeb:	00 00 00 
+  802eee:	48 89 c7             	mov    %rax,%rdi
+  802ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef6:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  802efd:	00 00 00 
+  802f00:	41 ff d0             	call   *%r8
+    }
+    return e;
+  802f03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  802f06:	c9                   	leave
+  802f07:	c3                   	ret
+
+0000000000802f08 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  802f08:	55                   	push   %rbp
+  802f09:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  802f0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f11:	48 b8 b1 2b 80 00 00 	movabs $0x802bb1,%rax
+  802f18:	00 00 00 
+  802f1b:	ff d0                	call   *%rax
+}
+  802f1d:	5d                   	pop    %rbp
+  802f1e:	c3                   	ret
+
+0000000000802f1f <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  802f1f:	55                   	push   %rbp
+  802f20:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  802f23:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f28:	48 b8 b1 2b 80 00 00 	movabs $0x802bb1,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+}
+  802f34:	5d                   	pop    %rbp
+  802f35:	c3                   	ret
+
+0000000000802f36 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802f36:	55                   	push   %rbp
+  802f37:	48 89 e5             	mov    %rsp,%rbp
+  802f3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802f42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f46:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802f4d:	ff ff ff 
+  802f50:	48 01 d0             	add    %rdx,%rax
+  802f53:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f57:	c9                   	leave
+  802f58:	c3                   	ret
+
+0000000000802f59 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802f59:	55                   	push   %rbp
+  802f5a:	48 89 e5             	mov    %rsp,%rbp
+  802f5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802f61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802f65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f69:	48 89 c7             	mov    %rax,%rdi
+  802f6c:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+  802f78:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802f7e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802f82:	c9                   	leave
+  802f83:	c3                   	ret
+
+0000000000802f84 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802f84:	55                   	push   %rbp
+  802f85:	48 89 e5             	mov    %rsp,%rbp
+  802f88:	48 83 ec 18          	sub    $0x18,%rsp
+  802f8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802f90:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f97:	e9 ae 00 00 00       	jmp    80304a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802f9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f9f:	c1 e0 0c             	shl    $0xc,%eax
+  802fa2:	48 98                	cltq
+  802fa4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802fa9:	48 01 d0             	add    %rdx,%rax
+  802fac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802fb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb4:	48 c1 e8 27          	shr    $0x27,%rax
+  802fb8:	48 89 c2             	mov    %rax,%rdx
+  802fbb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802fc2:	01 00 00 
+  802fc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fc9:	83 e0 01             	and    $0x1,%eax
+  802fcc:	48 85 c0             	test   %rax,%rax
+  802fcf:	74 63                	je     803034 <fd_alloc+0xb0>
+  802fd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fd9:	48 89 c2             	mov    %rax,%rdx
+  802fdc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802fe3:	01 00 00 
+  802fe6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fea:	83 e0 01             	and    $0x1,%eax
+  802fed:	48 85 c0             	test   %rax,%rax
+  802ff0:	74 42                	je     803034 <fd_alloc+0xb0>
+  802ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ff6:	48 c1 e8 15          	shr    $0x15,%rax
+  802ffa:	48 89 c2             	mov    %rax,%rdx
+  802ffd:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803004:	01 00 00 
+  803007:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80300b:	83 e0 01             	and    $0x1,%eax
+  80300e:	48 85 c0             	test   %rax,%rax
+  803011:	74 21                	je     803034 <fd_alloc+0xb0>
+  803013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803017:	48 c1 e8 0c          	shr    $0xc,%rax
+  80301b:	48 89 c2             	mov    %rax,%rdx
+  80301e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803025:	01 00 00 
+  803028:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80302c:	83 e0 01             	and    $0x1,%eax
+  80302f:	48 85 c0             	test   %rax,%rax
+  803032:	75 12                	jne    803046 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803034:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803038:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80303c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	eb 1e                	jmp    803064 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803046:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80304a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80304e:	0f 8e 48 ff ff ff    	jle    802f9c <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803054:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803058:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80305f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803064:	c9                   	leave
+  803065:	c3                   	ret
+
+0000000000803066 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803066:	55                   	push   %rbp
+  803067:	48 89 e5             	mov    %rsp,%rbp
+  80306a:	48 83 ec 20          	sub    $0x20,%rsp
+  80306e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803071:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803075:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803079:	78 06                	js     803081 <fd_lookup+0x1b>
+  80307b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80307f:	7e 0a                	jle    80308b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803081:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803086:	e9 af 00 00 00       	jmp    80313a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80308b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80308e:	c1 e0 0c             	shl    $0xc,%eax
+  803091:	48 98                	cltq
+  803093:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803098:	48 01 d0             	add    %rdx,%rax
+  80309b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80309f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030a3:	48 c1 e8 27          	shr    $0x27,%rax
+  8030a7:	48 89 c2             	mov    %rax,%rdx
+  8030aa:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8030b1:	01 00 00 
+  8030b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030b8:	83 e0 01             	and    $0x1,%eax
+  8030bb:	48 85 c0             	test   %rax,%rax
+  8030be:	74 63                	je     803123 <fd_lookup+0xbd>
+  8030c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030c4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030c8:	48 89 c2             	mov    %rax,%rdx
+  8030cb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8030d2:	01 00 00 
+  8030d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030d9:	83 e0 01             	and    $0x1,%eax
+  8030dc:	48 85 c0             	test   %rax,%rax
+  8030df:	74 42                	je     803123 <fd_lookup+0xbd>
+  8030e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8030e9:	48 89 c2             	mov    %rax,%rdx
+  8030ec:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8030f3:	01 00 00 
+  8030f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030fa:	83 e0 01             	and    $0x1,%eax
+  8030fd:	48 85 c0             	test   %rax,%rax
+  803100:	74 21                	je     803123 <fd_lookup+0xbd>
+  803102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803106:	48 c1 e8 0c          	shr    $0xc,%rax
+  80310a:	48 89 c2             	mov    %rax,%rdx
+  80310d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803114:	01 00 00 
+  803117:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80311b:	83 e0 01             	and    $0x1,%eax
+  80311e:	48 85 c0             	test   %rax,%rax
+  803121:	75 07                	jne    80312a <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803123:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803128:	eb 10                	jmp    80313a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80312a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80312e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803132:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80313a:	c9                   	leave
+  80313b:	c3                   	ret
+
+000000000080313c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80313c:	55                   	push   %rbp
+  80313d:	48 89 e5             	mov    %rsp,%rbp
+  803140:	48 83 ec 30          	sub    $0x30,%rsp
+  803144:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803148:	89 f0                	mov    %esi,%eax
+  80314a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80314d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803151:	48 89 c7             	mov    %rax,%rdi
+  803154:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+  803160:	89 c2                	mov    %eax,%edx
+  803162:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803166:	48 89 c6             	mov    %rax,%rsi
+  803169:	89 d7                	mov    %edx,%edi
+  80316b:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803172:	00 00 00 
+  803175:	ff d0                	call   *%rax
+  803177:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80317a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80317e:	78 0a                	js     80318a <fd_close+0x4e>
+  803180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803184:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803188:	74 12                	je     80319c <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80318a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80318e:	74 05                	je     803195 <fd_close+0x59>
+  803190:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803193:	eb 70                	jmp    803205 <fd_close+0xc9>
+  803195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319a:	eb 69                	jmp    803205 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80319c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a0:	8b 00                	mov    (%rax),%eax
+  8031a2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031a6:	48 89 d6             	mov    %rdx,%rsi
+  8031a9:	89 c7                	mov    %eax,%edi
+  8031ab:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  8031b2:	00 00 00 
+  8031b5:	ff d0                	call   *%rax
+  8031b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031be:	78 2a                	js     8031ea <fd_close+0xae>
+    if (dev->dev_close)
+  8031c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031c4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031c8:	48 85 c0             	test   %rax,%rax
+  8031cb:	74 16                	je     8031e3 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8031cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031d1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8031d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031d9:	48 89 c7             	mov    %rax,%rdi
+  8031dc:	ff d2                	call   *%rdx
+  8031de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e1:	eb 07                	jmp    8031ea <fd_close+0xae>
+    else
+      r = 0;
+  8031e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8031ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ee:	48 89 c6             	mov    %rax,%rsi
+  8031f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f6:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+  return r;
+  803202:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803205:	c9                   	leave
+  803206:	c3                   	ret
+
+0000000000803207 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803207:	55                   	push   %rbp
+  803208:	48 89 e5             	mov    %rsp,%rbp
+  80320b:	48 83 ec 20          	sub    $0x20,%rsp
+  80320f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803212:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803216:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80321d:	eb 3f                	jmp    80325e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80321f:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803226:	00 00 00 
+  803229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80322c:	48 98                	cltq
+  80322e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803232:	8b 00                	mov    (%rax),%eax
+  803234:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803237:	75 21                	jne    80325a <dev_lookup+0x53>
+      *dev = devtab[i];
+  803239:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803240:	00 00 00 
+  803243:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803246:	48 98                	cltq
+  803248:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80324c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803250:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803253:	b8 00 00 00 00       	mov    $0x0,%eax
+  803258:	eb 7f                	jmp    8032d9 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80325a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80325e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803265:	00 00 00 
+  803268:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80326b:	48 98                	cltq
+  80326d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803271:	48 85 c0             	test   %rax,%rax
+  803274:	75 a9                	jne    80321f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803276:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80327d:	00 00 00 
+  803280:	8b 40 04             	mov    0x4(%rax),%eax
+  803283:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803288:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80328f:	00 00 00 
+  803292:	48 98                	cltq
+  803294:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80329b:	48 01 d0             	add    %rdx,%rax
+  80329e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032a4:	8b 00                	mov    (%rax),%eax
+  8032a6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032a9:	89 c6                	mov    %eax,%esi
+  8032ab:	48 b8 88 6b 80 00 00 	movabs $0x806b88,%rax
+  8032b2:	00 00 00 
+  8032b5:	48 89 c7             	mov    %rax,%rdi
+  8032b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032bd:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  8032c4:	00 00 00 
+  8032c7:	ff d1                	call   *%rcx
+  *dev = 0;
+  8032c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032cd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8032d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032d9:	c9                   	leave
+  8032da:	c3                   	ret
+
+00000000008032db <close>:
+
+int
+close(int fdnum) {
+  8032db:	55                   	push   %rbp
+  8032dc:	48 89 e5             	mov    %rsp,%rbp
+  8032df:	48 83 ec 20          	sub    $0x20,%rsp
+  8032e3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032e6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8032ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032ed:	48 89 d6             	mov    %rdx,%rsi
+  8032f0:	89 c7                	mov    %eax,%edi
+  8032f2:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8032f9:	00 00 00 
+  8032fc:	ff d0                	call   *%rax
+  8032fe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803301:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803305:	79 05                	jns    80330c <close+0x31>
+    return r;
+  803307:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80330a:	eb 18                	jmp    803324 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80330c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803310:	be 01 00 00 00       	mov    $0x1,%esi
+  803315:	48 89 c7             	mov    %rax,%rdi
+  803318:	48 b8 3c 31 80 00 00 	movabs $0x80313c,%rax
+  80331f:	00 00 00 
+  803322:	ff d0                	call   *%rax
+}
+  803324:	c9                   	leave
+  803325:	c3                   	ret
+
+0000000000803326 <close_all>:
+
+void
+close_all(void) {
+  803326:	55                   	push   %rbp
+  803327:	48 89 e5             	mov    %rsp,%rbp
+  80332a:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80332e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803335:	eb 15                	jmp    80334c <close_all+0x26>
+    close(i);
+  803337:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80333a:	89 c7                	mov    %eax,%edi
+  80333c:	48 b8 db 32 80 00 00 	movabs $0x8032db,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803348:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80334c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803350:	7e e5                	jle    803337 <close_all+0x11>
+}
+  803352:	90                   	nop
+  803353:	90                   	nop
+  803354:	c9                   	leave
+  803355:	c3                   	ret
+
+0000000000803356 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803356:	55                   	push   %rbp
+  803357:	48 89 e5             	mov    %rsp,%rbp
+  80335a:	48 83 ec 40          	sub    $0x40,%rsp
+  80335e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803361:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803364:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803368:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80336b:	48 89 d6             	mov    %rdx,%rsi
+  80336e:	89 c7                	mov    %eax,%edi
+  803370:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803377:	00 00 00 
+  80337a:	ff d0                	call   *%rax
+  80337c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80337f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803383:	79 08                	jns    80338d <dup+0x37>
+    return r;
+  803385:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803388:	e9 33 02 00 00       	jmp    8035c0 <dup+0x26a>
+  close(newfdnum);
+  80338d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803390:	89 c7                	mov    %eax,%edi
+  803392:	48 b8 db 32 80 00 00 	movabs $0x8032db,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  80339e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033a1:	c1 e0 0c             	shl    $0xc,%eax
+  8033a4:	48 98                	cltq
+  8033a6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033ab:	48 01 d0             	add    %rdx,%rax
+  8033ae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8033b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033b6:	48 89 c7             	mov    %rax,%rdi
+  8033b9:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  8033c0:	00 00 00 
+  8033c3:	ff d0                	call   *%rax
+  8033c5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8033c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033cd:	48 89 c7             	mov    %rax,%rdi
+  8033d0:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+  8033dc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8033e0:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8033e7:	00 
+  8033e8:	e9 19 01 00 00       	jmp    803506 <dup+0x1b0>
+    off -= PGSIZE;
+  8033ed:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8033f4:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8033f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033fd:	48 01 d0             	add    %rdx,%rax
+  803400:	48 c1 e8 27          	shr    $0x27,%rax
+  803404:	48 89 c2             	mov    %rax,%rdx
+  803407:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80340e:	01 00 00 
+  803411:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803415:	83 e0 01             	and    $0x1,%eax
+  803418:	48 85 c0             	test   %rax,%rax
+  80341b:	0f 84 e5 00 00 00    	je     803506 <dup+0x1b0>
+  803421:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803425:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803429:	48 01 d0             	add    %rdx,%rax
+  80342c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803430:	48 89 c2             	mov    %rax,%rdx
+  803433:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80343a:	01 00 00 
+  80343d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803441:	83 e0 01             	and    $0x1,%eax
+  803444:	48 85 c0             	test   %rax,%rax
+  803447:	0f 84 b9 00 00 00    	je     803506 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80344d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803451:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803455:	48 01 d0             	add    %rdx,%rax
+  803458:	48 c1 e8 15          	shr    $0x15,%rax
+  80345c:	48 89 c2             	mov    %rax,%rdx
+  80345f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803466:	01 00 00 
+  803469:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80346d:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803470:	48 85 c0             	test   %rax,%rax
+  803473:	0f 84 8d 00 00 00    	je     803506 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803479:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80347d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803481:	48 01 d0             	add    %rdx,%rax
+  803484:	48 c1 e8 0c          	shr    $0xc,%rax
+  803488:	48 89 c2             	mov    %rax,%rdx
+  80348b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803492:	01 00 00 
+  803495:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803499:	83 e0 01             	and    $0x1,%eax
+  80349c:	48 85 c0             	test   %rax,%rax
+  80349f:	74 65                	je     803506 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8034a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034a9:	48 01 d0             	add    %rdx,%rax
+  8034ac:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034b0:	48 89 c2             	mov    %rax,%rdx
+  8034b3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034ba:	01 00 00 
+  8034bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034c6:	89 c6                	mov    %eax,%esi
+  8034c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8034cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034d0:	48 01 c2             	add    %rax,%rdx
+  8034d3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8034d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034db:	48 01 c8             	add    %rcx,%rax
+  8034de:	41 89 f0             	mov    %esi,%r8d
+  8034e1:	48 89 d1             	mov    %rdx,%rcx
+  8034e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034e9:	48 89 c6             	mov    %rax,%rsi
+  8034ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f1:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803500:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803504:	78 60                	js     803566 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803506:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80350b:	0f 85 dc fe ff ff    	jne    8033ed <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803511:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803515:	48 c1 e8 0c          	shr    $0xc,%rax
+  803519:	48 89 c2             	mov    %rax,%rdx
+  80351c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803523:	01 00 00 
+  803526:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80352a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80352f:	89 c1                	mov    %eax,%ecx
+  803531:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803535:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803539:	41 89 c8             	mov    %ecx,%r8d
+  80353c:	48 89 d1             	mov    %rdx,%rcx
+  80353f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803544:	48 89 c6             	mov    %rax,%rsi
+  803547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80354c:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+  803558:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80355b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80355f:	78 08                	js     803569 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803561:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803564:	eb 5a                	jmp    8035c0 <dup+0x26a>
+        goto err;
+  803566:	90                   	nop
+  803567:	eb 01                	jmp    80356a <dup+0x214>
+    goto err;
+  803569:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80356a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80356e:	48 89 c6             	mov    %rax,%rsi
+  803571:	bf 00 00 00 00       	mov    $0x0,%edi
+  803576:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803582:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803589:	00 
+  80358a:	eb 27                	jmp    8035b3 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80358c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803590:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803594:	48 01 d0             	add    %rdx,%rax
+  803597:	48 89 c6             	mov    %rax,%rsi
+  80359a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359f:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  8035a6:	00 00 00 
+  8035a9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8035ab:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8035b2:	00 
+  8035b3:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8035ba:	00 
+  8035bb:	76 cf                	jbe    80358c <dup+0x236>
+  return r;
+  8035bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8035c0:	c9                   	leave
+  8035c1:	c3                   	ret
+
+00000000008035c2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8035c2:	55                   	push   %rbp
+  8035c3:	48 89 e5             	mov    %rsp,%rbp
+  8035c6:	48 83 ec 40          	sub    $0x40,%rsp
+  8035ca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8035cd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8035d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8035d5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8035d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035dc:	48 89 d6             	mov    %rdx,%rsi
+  8035df:	89 c7                	mov    %eax,%edi
+  8035e1:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8035e8:	00 00 00 
+  8035eb:	ff d0                	call   *%rax
+  8035ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035f4:	78 24                	js     80361a <read+0x58>
+  8035f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035fa:	8b 00                	mov    (%rax),%eax
+  8035fc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803600:	48 89 d6             	mov    %rdx,%rsi
+  803603:	89 c7                	mov    %eax,%edi
+  803605:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  80360c:	00 00 00 
+  80360f:	ff d0                	call   *%rax
+  803611:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803614:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803618:	79 0a                	jns    803624 <read+0x62>
+    return r;
+  80361a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80361d:	48 98                	cltq
+  80361f:	e9 9e 00 00 00       	jmp    8036c2 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803624:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803628:	8b 40 08             	mov    0x8(%rax),%eax
+  80362b:	83 e0 03             	and    $0x3,%eax
+  80362e:	83 f8 01             	cmp    $0x1,%eax
+  803631:	75 5c                	jne    80368f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803633:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80363a:	00 00 00 
+  80363d:	8b 40 04             	mov    0x4(%rax),%eax
+  803640:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803645:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80364c:	00 00 00 
+  80364f:	48 98                	cltq
+  803651:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803658:	48 01 d0             	add    %rdx,%rax
+  80365b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803661:	8b 00                	mov    (%rax),%eax
+  803663:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803666:	89 c6                	mov    %eax,%esi
+  803668:	48 b8 a7 6b 80 00 00 	movabs $0x806ba7,%rax
+  80366f:	00 00 00 
+  803672:	48 89 c7             	mov    %rax,%rdi
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367a:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  803681:	00 00 00 
+  803684:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803686:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80368d:	eb 33                	jmp    8036c2 <read+0x100>
+  }
+  if (!dev->dev_read)
+  80368f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803693:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803697:	48 85 c0             	test   %rax,%rax
+  80369a:	75 09                	jne    8036a5 <read+0xe3>
+    return -E_NOT_SUPP;
+  80369c:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8036a3:	eb 1d                	jmp    8036c2 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8036a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036a9:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8036ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036b1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036b5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8036b9:	48 89 ce             	mov    %rcx,%rsi
+  8036bc:	48 89 c7             	mov    %rax,%rdi
+  8036bf:	41 ff d0             	call   *%r8
+}
+  8036c2:	c9                   	leave
+  8036c3:	c3                   	ret
+
+00000000008036c4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036c4:	55                   	push   %rbp
+  8036c5:	48 89 e5             	mov    %rsp,%rbp
+  8036c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8036cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8036d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8036d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036de:	eb 49                	jmp    803729 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8036e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036e3:	48 98                	cltq
+  8036e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8036e9:	48 29 c2             	sub    %rax,%rdx
+  8036ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036ef:	48 63 c8             	movslq %eax,%rcx
+  8036f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036f6:	48 01 c1             	add    %rax,%rcx
+  8036f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036fc:	48 89 ce             	mov    %rcx,%rsi
+  8036ff:	89 c7                	mov    %eax,%edi
+  803701:	48 b8 c2 35 80 00 00 	movabs $0x8035c2,%rax
+  803708:	00 00 00 
+  80370b:	ff d0                	call   *%rax
+  80370d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803710:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803714:	79 07                	jns    80371d <readn+0x59>
+      return m;
+  803716:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803719:	48 98                	cltq
+  80371b:	eb 1f                	jmp    80373c <readn+0x78>
+    if (m == 0)
+  80371d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803721:	74 13                	je     803736 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803723:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803726:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803729:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80372c:	48 98                	cltq
+  80372e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803732:	72 ac                	jb     8036e0 <readn+0x1c>
+  803734:	eb 01                	jmp    803737 <readn+0x73>
+      break;
+  803736:	90                   	nop
+  }
+  return tot;
+  803737:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80373a:	48 98                	cltq
+}
+  80373c:	c9                   	leave
+  80373d:	c3                   	ret
+
+000000000080373e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80373e:	55                   	push   %rbp
+  80373f:	48 89 e5             	mov    %rsp,%rbp
+  803742:	48 83 ec 40          	sub    $0x40,%rsp
+  803746:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803749:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80374d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803751:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803755:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803758:	48 89 d6             	mov    %rdx,%rsi
+  80375b:	89 c7                	mov    %eax,%edi
+  80375d:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803764:	00 00 00 
+  803767:	ff d0                	call   *%rax
+  803769:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80376c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803770:	78 24                	js     803796 <write+0x58>
+  803772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803776:	8b 00                	mov    (%rax),%eax
+  803778:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80377c:	48 89 d6             	mov    %rdx,%rsi
+  80377f:	89 c7                	mov    %eax,%edi
+  803781:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  803788:	00 00 00 
+  80378b:	ff d0                	call   *%rax
+  80378d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803790:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803794:	79 0a                	jns    8037a0 <write+0x62>
+    return r;
+  803796:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803799:	48 98                	cltq
+  80379b:	e9 9d 00 00 00       	jmp    80383d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037a4:	8b 40 08             	mov    0x8(%rax),%eax
+  8037a7:	83 e0 03             	and    $0x3,%eax
+  8037aa:	85 c0                	test   %eax,%eax
+  8037ac:	75 5c                	jne    80380a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037ae:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8037b5:	00 00 00 
+  8037b8:	8b 40 04             	mov    0x4(%rax),%eax
+  8037bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037c0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8037c7:	00 00 00 
+  8037ca:	48 98                	cltq
+  8037cc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8037d3:	48 01 d0             	add    %rdx,%rax
+  8037d6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8037dc:	8b 00                	mov    (%rax),%eax
+  8037de:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8037e1:	89 c6                	mov    %eax,%esi
+  8037e3:	48 b8 c3 6b 80 00 00 	movabs $0x806bc3,%rax
+  8037ea:	00 00 00 
+  8037ed:	48 89 c7             	mov    %rax,%rdi
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f5:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  8037fc:	00 00 00 
+  8037ff:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803801:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803808:	eb 33                	jmp    80383d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80380a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80380e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803812:	48 85 c0             	test   %rax,%rax
+  803815:	75 09                	jne    803820 <write+0xe2>
+    return -E_NOT_SUPP;
+  803817:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80381e:	eb 1d                	jmp    80383d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803820:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803824:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80382c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803830:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803834:	48 89 ce             	mov    %rcx,%rsi
+  803837:	48 89 c7             	mov    %rax,%rdi
+  80383a:	41 ff d0             	call   *%r8
+}
+  80383d:	c9                   	leave
+  80383e:	c3                   	ret
+
+000000000080383f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80383f:	55                   	push   %rbp
+  803840:	48 89 e5             	mov    %rsp,%rbp
+  803843:	48 83 ec 18          	sub    $0x18,%rsp
+  803847:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80384a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80384d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803851:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803854:	48 89 d6             	mov    %rdx,%rsi
+  803857:	89 c7                	mov    %eax,%edi
+  803859:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+  803865:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803868:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80386c:	79 05                	jns    803873 <seek+0x34>
+    return r;
+  80386e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803871:	eb 0f                	jmp    803882 <seek+0x43>
+  fd->fd_offset = offset;
+  803873:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803877:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80387a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80387d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803882:	c9                   	leave
+  803883:	c3                   	ret
+
+0000000000803884 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803884:	55                   	push   %rbp
+  803885:	48 89 e5             	mov    %rsp,%rbp
+  803888:	48 83 ec 30          	sub    $0x30,%rsp
+  80388c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80388f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803892:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803896:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803899:	48 89 d6             	mov    %rdx,%rsi
+  80389c:	89 c7                	mov    %eax,%edi
+  80389e:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+  8038aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038b1:	78 24                	js     8038d7 <ftruncate+0x53>
+  8038b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038b7:	8b 00                	mov    (%rax),%eax
+  8038b9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038bd:	48 89 d6             	mov    %rdx,%rsi
+  8038c0:	89 c7                	mov    %eax,%edi
+  8038c2:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  8038c9:	00 00 00 
+  8038cc:	ff d0                	call   *%rax
+  8038ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038d5:	79 08                	jns    8038df <ftruncate+0x5b>
+    return r;
+  8038d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038da:	e9 92 00 00 00       	jmp    803971 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e3:	8b 40 08             	mov    0x8(%rax),%eax
+  8038e6:	83 e0 03             	and    $0x3,%eax
+  8038e9:	85 c0                	test   %eax,%eax
+  8038eb:	75 5a                	jne    803947 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8038ed:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8038f4:	00 00 00 
+  8038f7:	8b 40 04             	mov    0x4(%rax),%eax
+  8038fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038ff:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803906:	00 00 00 
+  803909:	48 98                	cltq
+  80390b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803912:	48 01 d0             	add    %rdx,%rax
+  803915:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80391b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80391d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803920:	89 c6                	mov    %eax,%esi
+  803922:	48 b8 e0 6b 80 00 00 	movabs $0x806be0,%rax
+  803929:	00 00 00 
+  80392c:	48 89 c7             	mov    %rax,%rdi
+  80392f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803934:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  80393b:	00 00 00 
+  80393e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803940:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803945:	eb 2a                	jmp    803971 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80394b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80394f:	48 85 c0             	test   %rax,%rax
+  803952:	75 07                	jne    80395b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803954:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803959:	eb 16                	jmp    803971 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80395b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80395f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803967:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80396a:	89 d6                	mov    %edx,%esi
+  80396c:	48 89 c7             	mov    %rax,%rdi
+  80396f:	ff d1                	call   *%rcx
+}
+  803971:	c9                   	leave
+  803972:	c3                   	ret
+
+0000000000803973 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803973:	55                   	push   %rbp
+  803974:	48 89 e5             	mov    %rsp,%rbp
+  803977:	48 83 ec 30          	sub    $0x30,%rsp
+  80397b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80397e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803982:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803986:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803989:	48 89 d6             	mov    %rdx,%rsi
+  80398c:	89 c7                	mov    %eax,%edi
+  80398e:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803995:	00 00 00 
+  803998:	ff d0                	call   *%rax
+  80399a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80399d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039a1:	78 24                	js     8039c7 <fstat+0x54>
+  8039a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039a7:	8b 00                	mov    (%rax),%eax
+  8039a9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039ad:	48 89 d6             	mov    %rdx,%rsi
+  8039b0:	89 c7                	mov    %eax,%edi
+  8039b2:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  8039b9:	00 00 00 
+  8039bc:	ff d0                	call   *%rax
+  8039be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039c5:	79 05                	jns    8039cc <fstat+0x59>
+    return r;
+  8039c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039ca:	eb 5e                	jmp    803a2a <fstat+0xb7>
+  if (!dev->dev_stat)
+  8039cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8039d4:	48 85 c0             	test   %rax,%rax
+  8039d7:	75 07                	jne    8039e0 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8039d9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8039de:	eb 4a                	jmp    803a2a <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8039e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039e4:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8039e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039eb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8039f2:	00 00 00 
+  stat->st_isdir   = 0;
+  8039f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039f9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803a00:	00 00 00 
+  stat->st_dev     = dev;
+  803a03:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803a07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a0b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a16:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803a1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a1e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a22:	48 89 d6             	mov    %rdx,%rsi
+  803a25:	48 89 c7             	mov    %rax,%rdi
+  803a28:	ff d1                	call   *%rcx
+}
+  803a2a:	c9                   	leave
+  803a2b:	c3                   	ret
+
+0000000000803a2c <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803a2c:	55                   	push   %rbp
+  803a2d:	48 89 e5             	mov    %rsp,%rbp
+  803a30:	48 83 ec 10          	sub    $0x10,%rsp
+  803a34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a40:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a46:	83 f8 20             	cmp    $0x20,%eax
+  803a49:	75 07                	jne    803a52 <pollwait_key+0x26>
+    return -E_INVAL;
+  803a4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a50:	eb 5f                	jmp    803ab1 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803a52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a56:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a60:	48 63 d2             	movslq %edx,%rdx
+  803a63:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a67:	48 01 c2             	add    %rax,%rdx
+  803a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a6e:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803a71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a75:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803a7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a7f:	8b 00                	mov    (%rax),%eax
+  803a81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a85:	48 63 c9             	movslq %ecx,%rcx
+  803a88:	48 c1 e1 04          	shl    $0x4,%rcx
+  803a8c:	48 01 ca             	add    %rcx,%rdx
+  803a8f:	48 83 c2 08          	add    $0x8,%rdx
+  803a93:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803a95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a99:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a9f:	8d 50 01             	lea    0x1(%rax),%edx
+  803aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa6:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803aac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ab1:	c9                   	leave
+  803ab2:	c3                   	ret
+
+0000000000803ab3 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803ab3:	55                   	push   %rbp
+  803ab4:	48 89 e5             	mov    %rsp,%rbp
+  803ab7:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803abe:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803ac5:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803acb:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803ad2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803ad9:	00 
+  int i, r, ready, ipc = 0;
+  803ada:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803ae1:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803ae8:	00 
+  803ae9:	74 45                	je     803b30 <poll+0x7d>
+  803aeb:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803af2:	ff 
+  803af3:	74 3b                	je     803b30 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803af5:	48 b8 2d 54 80 00 00 	movabs $0x80542d,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+  803b01:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803b05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b09:	48 f7 d0             	not    %rax
+  803b0c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803b13:	73 10                	jae    803b25 <poll+0x72>
+  803b15:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b19:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803b20:	48 01 d0             	add    %rdx,%rax
+  803b23:	eb 07                	jmp    803b2c <poll+0x79>
+  803b25:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803b2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803b30:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803b37:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803b3e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803b45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803b4c:	e9 46 02 00 00       	jmp    803d97 <poll+0x2e4>
+      fds[i].revents = 0;
+  803b51:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b54:	48 63 d0             	movslq %eax,%rdx
+  803b57:	48 89 d0             	mov    %rdx,%rax
+  803b5a:	48 01 c0             	add    %rax,%rax
+  803b5d:	48 01 d0             	add    %rdx,%rax
+  803b60:	48 c1 e0 02          	shl    $0x2,%rax
+  803b64:	48 89 c2             	mov    %rax,%rdx
+  803b67:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b6e:	48 01 d0             	add    %rdx,%rax
+  803b71:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803b78:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b7b:	48 63 d0             	movslq %eax,%rdx
+  803b7e:	48 89 d0             	mov    %rdx,%rax
+  803b81:	48 01 c0             	add    %rax,%rax
+  803b84:	48 01 d0             	add    %rdx,%rax
+  803b87:	48 c1 e0 02          	shl    $0x2,%rax
+  803b8b:	48 89 c2             	mov    %rax,%rdx
+  803b8e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b95:	48 01 d0             	add    %rdx,%rax
+  803b98:	8b 00                	mov    (%rax),%eax
+  803b9a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803b9d:	75 62                	jne    803c01 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803b9f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ba2:	48 63 d0             	movslq %eax,%rdx
+  803ba5:	48 89 d0             	mov    %rdx,%rax
+  803ba8:	48 01 c0             	add    %rax,%rax
+  803bab:	48 01 d0             	add    %rdx,%rax
+  803bae:	48 c1 e0 02          	shl    $0x2,%rax
+  803bb2:	48 89 c2             	mov    %rax,%rdx
+  803bb5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bbc:	48 01 d0             	add    %rdx,%rax
+  803bbf:	8b 40 04             	mov    0x4(%rax),%eax
+  803bc2:	83 e0 01             	and    $0x1,%eax
+  803bc5:	85 c0                	test   %eax,%eax
+  803bc7:	0f 84 9b 01 00 00    	je     803d68 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803bcd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bd0:	48 63 d0             	movslq %eax,%rdx
+  803bd3:	48 89 d0             	mov    %rdx,%rax
+  803bd6:	48 01 c0             	add    %rax,%rax
+  803bd9:	48 01 d0             	add    %rdx,%rax
+  803bdc:	48 c1 e0 02          	shl    $0x2,%rax
+  803be0:	48 89 c2             	mov    %rax,%rdx
+  803be3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bea:	48 01 c2             	add    %rax,%rdx
+  803bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf0:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803bf3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803bf6:	83 c8 04             	or     $0x4,%eax
+  803bf9:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803bfc:	e9 67 01 00 00       	jmp    803d68 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c01:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c04:	48 63 d0             	movslq %eax,%rdx
+  803c07:	48 89 d0             	mov    %rdx,%rax
+  803c0a:	48 01 c0             	add    %rax,%rax
+  803c0d:	48 01 d0             	add    %rdx,%rax
+  803c10:	48 c1 e0 02          	shl    $0x2,%rax
+  803c14:	48 89 c2             	mov    %rax,%rdx
+  803c17:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c1e:	48 01 d0             	add    %rdx,%rax
+  803c21:	8b 00                	mov    (%rax),%eax
+  803c23:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803c2a:	48 89 d6             	mov    %rdx,%rsi
+  803c2d:	89 c7                	mov    %eax,%edi
+  803c2f:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  803c36:	00 00 00 
+  803c39:	ff d0                	call   *%rax
+  803c3b:	85 c0                	test   %eax,%eax
+  803c3d:	78 25                	js     803c64 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803c3f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c46:	8b 00                	mov    (%rax),%eax
+  803c48:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803c4f:	48 89 d6             	mov    %rdx,%rsi
+  803c52:	89 c7                	mov    %eax,%edi
+  803c54:	48 b8 07 32 80 00 00 	movabs $0x803207,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c60:	85 c0                	test   %eax,%eax
+  803c62:	79 2c                	jns    803c90 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803c64:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c67:	48 63 d0             	movslq %eax,%rdx
+  803c6a:	48 89 d0             	mov    %rdx,%rax
+  803c6d:	48 01 c0             	add    %rax,%rax
+  803c70:	48 01 d0             	add    %rdx,%rax
+  803c73:	48 c1 e0 02          	shl    $0x2,%rax
+  803c77:	48 89 c2             	mov    %rax,%rdx
+  803c7a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c81:	48 01 d0             	add    %rdx,%rax
+  803c84:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803c8b:	e9 d8 00 00 00       	jmp    803d68 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803c90:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803c97:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803c9b:	48 85 c0             	test   %rax,%rax
+  803c9e:	74 7d                	je     803d1d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803ca0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803ca7:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803cab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cae:	48 63 d0             	movslq %eax,%rdx
+  803cb1:	48 89 d0             	mov    %rdx,%rax
+  803cb4:	48 01 c0             	add    %rax,%rax
+  803cb7:	48 01 d0             	add    %rdx,%rax
+  803cba:	48 c1 e0 02          	shl    $0x2,%rax
+  803cbe:	48 89 c2             	mov    %rax,%rdx
+  803cc1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cc8:	48 01 d0             	add    %rdx,%rax
+  803ccb:	8b 48 04             	mov    0x4(%rax),%ecx
+  803cce:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803cd5:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803cdc:	89 ce                	mov    %ecx,%esi
+  803cde:	48 89 c7             	mov    %rax,%rdi
+  803ce1:	41 ff d0             	call   *%r8
+  803ce4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803ce7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803ceb:	79 08                	jns    803cf5 <poll+0x242>
+          return r;
+  803ced:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cf0:	e9 45 01 00 00       	jmp    803e3a <poll+0x387>
+        fds[i].revents = r;
+  803cf5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cf8:	48 63 d0             	movslq %eax,%rdx
+  803cfb:	48 89 d0             	mov    %rdx,%rax
+  803cfe:	48 01 c0             	add    %rax,%rax
+  803d01:	48 01 d0             	add    %rdx,%rax
+  803d04:	48 c1 e0 02          	shl    $0x2,%rax
+  803d08:	48 89 c2             	mov    %rax,%rdx
+  803d0b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d12:	48 01 c2             	add    %rax,%rdx
+  803d15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d18:	89 42 08             	mov    %eax,0x8(%rdx)
+  803d1b:	eb 4b                	jmp    803d68 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803d1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d20:	48 63 d0             	movslq %eax,%rdx
+  803d23:	48 89 d0             	mov    %rdx,%rax
+  803d26:	48 01 c0             	add    %rax,%rax
+  803d29:	48 01 d0             	add    %rdx,%rax
+  803d2c:	48 c1 e0 02          	shl    $0x2,%rax
+  803d30:	48 89 c2             	mov    %rax,%rdx
+  803d33:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d3a:	48 01 d0             	add    %rdx,%rax
+  803d3d:	8b 48 04             	mov    0x4(%rax),%ecx
+  803d40:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d43:	48 63 d0             	movslq %eax,%rdx
+  803d46:	48 89 d0             	mov    %rdx,%rax
+  803d49:	48 01 c0             	add    %rax,%rax
+  803d4c:	48 01 d0             	add    %rdx,%rax
+  803d4f:	48 c1 e0 02          	shl    $0x2,%rax
+  803d53:	48 89 c2             	mov    %rax,%rdx
+  803d56:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d5d:	48 01 d0             	add    %rdx,%rax
+  803d60:	83 e1 03             	and    $0x3,%ecx
+  803d63:	89 ca                	mov    %ecx,%edx
+  803d65:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803d68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d6b:	48 63 d0             	movslq %eax,%rdx
+  803d6e:	48 89 d0             	mov    %rdx,%rax
+  803d71:	48 01 c0             	add    %rax,%rax
+  803d74:	48 01 d0             	add    %rdx,%rax
+  803d77:	48 c1 e0 02          	shl    $0x2,%rax
+  803d7b:	48 89 c2             	mov    %rax,%rdx
+  803d7e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d85:	48 01 d0             	add    %rdx,%rax
+  803d88:	8b 40 08             	mov    0x8(%rax),%eax
+  803d8b:	85 c0                	test   %eax,%eax
+  803d8d:	74 04                	je     803d93 <poll+0x2e0>
+        ready++;
+  803d8f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803d93:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803d97:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d9a:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803da0:	0f 8c ab fd ff ff    	jl     803b51 <poll+0x9e>
+    }
+    if (ready)
+  803da6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803daa:	74 08                	je     803db4 <poll+0x301>
+      return ready;
+  803dac:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803daf:	e9 86 00 00 00       	jmp    803e3a <poll+0x387>
+
+    if (deadline) {
+  803db4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803db9:	74 30                	je     803deb <poll+0x338>
+      now     = vsys_clock_ns();
+  803dbb:	48 b8 2d 54 80 00 00 	movabs $0x80542d,%rax
+  803dc2:	00 00 00 
+  803dc5:	ff d0                	call   *%rax
+  803dc7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803dcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dcf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803dd3:	73 0a                	jae    803ddf <poll+0x32c>
+  803dd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dd9:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803ddd:	eb 05                	jmp    803de4 <poll+0x331>
+  803ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de4:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803deb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803dee:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803df1:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803df8:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803dff:	48 89 c7             	mov    %rax,%rdi
+  803e02:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+  803e0e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803e11:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803e15:	75 07                	jne    803e1e <poll+0x36b>
+      return 0;
+  803e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1c:	eb 1c                	jmp    803e3a <poll+0x387>
+    if (r < 0)
+  803e1e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803e22:	79 05                	jns    803e29 <poll+0x376>
+      return r;
+  803e24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e27:	eb 11                	jmp    803e3a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803e29:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e2c:	c1 f8 02             	sar    $0x2,%eax
+  803e2f:	83 e0 01             	and    $0x1,%eax
+  803e32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803e35:	e9 f6 fc ff ff       	jmp    803b30 <poll+0x7d>
+  }
+}
+  803e3a:	c9                   	leave
+  803e3b:	c3                   	ret
+
+0000000000803e3c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	48 83 ec 20          	sub    $0x20,%rsp
+  803e44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e48:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803e4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e50:	be 00 00 00 00       	mov    $0x0,%esi
+  803e55:	48 89 c7             	mov    %rax,%rdi
+  803e58:	48 b8 2a 3f 80 00 00 	movabs $0x803f2a,%rax
+  803e5f:	00 00 00 
+  803e62:	ff d0                	call   *%rax
+  803e64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e6b:	79 05                	jns    803e72 <stat+0x36>
+    return fd;
+  803e6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e70:	eb 2f                	jmp    803ea1 <stat+0x65>
+  r = fstat(fd, stat);
+  803e72:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e79:	48 89 d6             	mov    %rdx,%rsi
+  803e7c:	89 c7                	mov    %eax,%edi
+  803e7e:	48 b8 73 39 80 00 00 	movabs $0x803973,%rax
+  803e85:	00 00 00 
+  803e88:	ff d0                	call   *%rax
+  803e8a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803e8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e90:	89 c7                	mov    %eax,%edi
+  803e92:	48 b8 db 32 80 00 00 	movabs $0x8032db,%rax
+  803e99:	00 00 00 
+  803e9c:	ff d0                	call   *%rax
+  return r;
+  803e9e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803ea1:	c9                   	leave
+  803ea2:	c3                   	ret
+
+0000000000803ea3 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803ea3:	55                   	push   %rbp
+  803ea4:	48 89 e5             	mov    %rsp,%rbp
+  803ea7:	48 83 ec 10          	sub    $0x10,%rsp
+  803eab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803eae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803eb2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803eb9:	00 00 00 
+  803ebc:	8b 00                	mov    (%rax),%eax
+  803ebe:	85 c0                	test   %eax,%eax
+  803ec0:	75 1d                	jne    803edf <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ec2:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ec7:	48 b8 c8 5c 80 00 00 	movabs $0x805cc8,%rax
+  803ece:	00 00 00 
+  803ed1:	ff d0                	call   *%rax
+  803ed3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803eda:	00 00 00 
+  803edd:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803edf:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803ee6:	00 00 00 
+  803ee9:	8b 00                	mov    (%rax),%eax
+  803eeb:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803eee:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ef3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803efa:	00 00 00 
+  803efd:	89 c7                	mov    %eax,%edi
+  803eff:	48 b8 1b 5c 80 00 00 	movabs $0x805c1b,%rax
+  803f06:	00 00 00 
+  803f09:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803f0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f14:	48 89 c6             	mov    %rax,%rsi
+  803f17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f1c:	48 b8 9e 5a 80 00 00 	movabs $0x805a9e,%rax
+  803f23:	00 00 00 
+  803f26:	ff d0                	call   *%rax
+}
+  803f28:	c9                   	leave
+  803f29:	c3                   	ret
+
+0000000000803f2a <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803f2a:	55                   	push   %rbp
+  803f2b:	48 89 e5             	mov    %rsp,%rbp
+  803f2e:	48 83 ec 20          	sub    $0x20,%rsp
+  803f32:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803f36:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f3d:	48 89 c7             	mov    %rax,%rdi
+  803f40:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  803f47:	00 00 00 
+  803f4a:	ff d0                	call   *%rax
+  803f4c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f51:	7e 0a                	jle    803f5d <open+0x33>
+    return -E_BAD_PATH;
+  803f53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f58:	e9 a8 00 00 00       	jmp    804005 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803f5d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803f61:	48 89 c7             	mov    %rax,%rdi
+  803f64:	48 b8 84 2f 80 00 00 	movabs $0x802f84,%rax
+  803f6b:	00 00 00 
+  803f6e:	ff d0                	call   *%rax
+  803f70:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f73:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f77:	79 08                	jns    803f81 <open+0x57>
+    return r;
+  803f79:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f7c:	e9 84 00 00 00       	jmp    804005 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803f81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f85:	48 89 c6             	mov    %rax,%rsi
+  803f88:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803f8f:	00 00 00 
+  803f92:	48 89 c7             	mov    %rax,%rdi
+  803f95:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  803f9c:	00 00 00 
+  803f9f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803fa1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803fa8:	00 00 00 
+  803fab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fae:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803fb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fb8:	48 89 c6             	mov    %rax,%rsi
+  803fbb:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fc0:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  803fc7:	00 00 00 
+  803fca:	ff d0                	call   *%rax
+  803fcc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fcf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fd3:	79 1d                	jns    803ff2 <open+0xc8>
+    fd_close(fd, 0);
+  803fd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  803fde:	48 89 c7             	mov    %rax,%rdi
+  803fe1:	48 b8 3c 31 80 00 00 	movabs $0x80313c,%rax
+  803fe8:	00 00 00 
+  803feb:	ff d0                	call   *%rax
+    return r;
+  803fed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ff0:	eb 13                	jmp    804005 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803ff2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ff6:	48 89 c7             	mov    %rax,%rdi
+  803ff9:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  804000:	00 00 00 
+  804003:	ff d0                	call   *%rax
+}
+  804005:	c9                   	leave
+  804006:	c3                   	ret
+
+0000000000804007 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804007:	55                   	push   %rbp
+  804008:	48 89 e5             	mov    %rsp,%rbp
+  80400b:	48 83 ec 10          	sub    $0x10,%rsp
+  80400f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804013:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804017:	8b 40 0c             	mov    0xc(%rax),%eax
+  80401a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804021:	00 00 00 
+  804024:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804026:	be 00 00 00 00       	mov    $0x0,%esi
+  80402b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804030:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  804037:	00 00 00 
+  80403a:	ff d0                	call   *%rax
+}
+  80403c:	c9                   	leave
+  80403d:	c3                   	ret
+
+000000000080403e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80403e:	55                   	push   %rbp
+  80403f:	48 89 e5             	mov    %rsp,%rbp
+  804042:	48 83 ec 30          	sub    $0x30,%rsp
+  804046:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80404a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80404e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804052:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804057:	74 07                	je     804060 <devfile_read+0x22>
+  804059:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80405e:	75 0a                	jne    80406a <devfile_read+0x2c>
+  return E_INVAL;
+  804060:	b8 03 00 00 00       	mov    $0x3,%eax
+  804065:	e9 b4 00 00 00       	jmp    80411e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80406a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804071:	00 
+  while (n) {
+  804072:	e9 98 00 00 00       	jmp    80410f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804077:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80407b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80407e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804085:	00 00 00 
+  804088:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80408a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804091:	00 00 00 
+  804094:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804098:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80409c:	be 00 00 00 00       	mov    $0x0,%esi
+  8040a1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8040a6:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  8040ad:	00 00 00 
+  8040b0:	ff d0                	call   *%rax
+  8040b2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8040b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040b9:	7f 13                	jg     8040ce <devfile_read+0x90>
+      return res ? res : res0;
+  8040bb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8040bf:	74 07                	je     8040c8 <devfile_read+0x8a>
+  8040c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040c4:	48 98                	cltq
+  8040c6:	eb 56                	jmp    80411e <devfile_read+0xe0>
+  8040c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040cc:	eb 50                	jmp    80411e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8040ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040d1:	48 63 d0             	movslq %eax,%rdx
+  8040d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040d8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8040df:	00 00 00 
+  8040e2:	48 89 ce             	mov    %rcx,%rsi
+  8040e5:	48 89 c7             	mov    %rax,%rdi
+  8040e8:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+
+    buf += res;
+  8040f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040f7:	48 98                	cltq
+  8040f9:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8040fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804100:	48 98                	cltq
+  804102:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804106:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804109:	48 98                	cltq
+  80410b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80410f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804114:	0f 85 5d ff ff ff    	jne    804077 <devfile_read+0x39>
+  }
+
+  return res0;
+  80411a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80411e:	c9                   	leave
+  80411f:	c3                   	ret
+
+0000000000804120 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804120:	55                   	push   %rbp
+  804121:	48 89 e5             	mov    %rsp,%rbp
+  804124:	48 83 ec 50          	sub    $0x50,%rsp
+  804128:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80412c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804130:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804134:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804139:	74 07                	je     804142 <devfile_write+0x22>
+  80413b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804140:	75 0a                	jne    80414c <devfile_write+0x2c>
+  return E_INVAL;
+  804142:	b8 03 00 00 00       	mov    $0x3,%eax
+  804147:	e9 c9 00 00 00       	jmp    804215 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80414c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804153:	00 
+
+  while (n) {
+  804154:	e9 ad 00 00 00       	jmp    804206 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804159:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80415d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804161:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804168:	00 
+  804169:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80416d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804171:	48 39 c2             	cmp    %rax,%rdx
+  804174:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804178:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80417c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804180:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804184:	48 89 c6             	mov    %rax,%rsi
+  804187:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80418e:	00 00 00 
+  804191:	48 89 c7             	mov    %rax,%rdi
+  804194:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  80419b:	00 00 00 
+  80419e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8041a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041a4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041a7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8041ae:	00 00 00 
+  8041b1:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8041b3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8041ba:	00 00 00 
+  8041bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041c1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8041c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8041ca:	bf 04 00 00 00       	mov    $0x4,%edi
+  8041cf:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  8041d6:	00 00 00 
+  8041d9:	ff d0                	call   *%rax
+  8041db:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8041de:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8041e2:	79 07                	jns    8041eb <devfile_write+0xcb>
+      return res;
+  8041e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041e7:	48 98                	cltq
+  8041e9:	eb 2a                	jmp    804215 <devfile_write+0xf5>
+
+    buf += res;
+  8041eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041ee:	48 98                	cltq
+  8041f0:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8041f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041f7:	48 98                	cltq
+  8041f9:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8041fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804200:	48 98                	cltq
+  804202:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804206:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80420b:	0f 85 48 ff ff ff    	jne    804159 <devfile_write+0x39>
+  }
+
+  return res0;
+  804211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804215:	c9                   	leave
+  804216:	c3                   	ret
+
+0000000000804217 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804217:	55                   	push   %rbp
+  804218:	48 89 e5             	mov    %rsp,%rbp
+  80421b:	48 83 ec 20          	sub    $0x20,%rsp
+  80421f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804223:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80422e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804235:	00 00 00 
+  804238:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80423a:	be 00 00 00 00       	mov    $0x0,%esi
+  80423f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804244:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+  804250:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804253:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804257:	79 05                	jns    80425e <devfile_stat+0x47>
+    return r;
+  804259:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80425c:	eb 59                	jmp    8042b7 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80425e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804262:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804269:	00 00 00 
+  80426c:	48 89 d6             	mov    %rdx,%rsi
+  80426f:	48 89 c7             	mov    %rax,%rdi
+  804272:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80427e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804285:	00 00 00 
+  804288:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80428e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804292:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804298:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80429f:	00 00 00 
+  8042a2:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8042a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042ac:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8042b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042b7:	c9                   	leave
+  8042b8:	c3                   	ret
+
+00000000008042b9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8042b9:	55                   	push   %rbp
+  8042ba:	48 89 e5             	mov    %rsp,%rbp
+  8042bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8042c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042c5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8042c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042cc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042cf:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042d6:	00 00 00 
+  8042d9:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8042db:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042e2:	00 00 00 
+  8042e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042e8:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8042eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8042f0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8042f5:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+}
+  804301:	c9                   	leave
+  804302:	c3                   	ret
+
+0000000000804303 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	48 83 ec 18          	sub    $0x18,%rsp
+  80430b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80430f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804312:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804316:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804319:	83 e0 03             	and    $0x3,%eax
+}
+  80431c:	c9                   	leave
+  80431d:	c3                   	ret
+
+000000000080431e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80431e:	55                   	push   %rbp
+  80431f:	48 89 e5             	mov    %rsp,%rbp
+  804322:	48 83 ec 10          	sub    $0x10,%rsp
+  804326:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  80432a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80432e:	48 89 c7             	mov    %rax,%rdi
+  804331:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  804338:	00 00 00 
+  80433b:	ff d0                	call   *%rax
+  80433d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804342:	7e 07                	jle    80434b <remove+0x2d>
+    return -E_BAD_PATH;
+  804344:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804349:	eb 36                	jmp    804381 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  80434b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80434f:	48 89 c6             	mov    %rax,%rsi
+  804352:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804359:	00 00 00 
+  80435c:	48 89 c7             	mov    %rax,%rdi
+  80435f:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  804366:	00 00 00 
+  804369:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  80436b:	be 00 00 00 00       	mov    $0x0,%esi
+  804370:	bf 07 00 00 00       	mov    $0x7,%edi
+  804375:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  80437c:	00 00 00 
+  80437f:	ff d0                	call   *%rax
+}
+  804381:	c9                   	leave
+  804382:	c3                   	ret
+
+0000000000804383 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804383:	55                   	push   %rbp
+  804384:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804387:	be 00 00 00 00       	mov    $0x0,%esi
+  80438c:	bf 08 00 00 00       	mov    $0x8,%edi
+  804391:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+}
+  80439d:	5d                   	pop    %rbp
+  80439e:	c3                   	ret
+
+000000000080439f <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  80439f:	55                   	push   %rbp
+  8043a0:	48 89 e5             	mov    %rsp,%rbp
+  8043a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8043a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8043ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8043b0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8043b5:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  8043bc:	00 00 00 
+  8043bf:	ff d0                	call   *%rax
+  8043c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043c8:	79 05                	jns    8043cf <fs_stats+0x30>
+    return r;
+  8043ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043cd:	eb 2a                	jmp    8043f9 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8043cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043d3:	ba 68 00 00 00       	mov    $0x68,%edx
+  8043d8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8043df:	00 00 00 
+  8043e2:	48 89 ce             	mov    %rcx,%rsi
+  8043e5:	48 89 c7             	mov    %rax,%rdi
+  8043e8:	48 b8 e4 17 80 00 00 	movabs $0x8017e4,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+  return 0;
+  8043f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043f9:	c9                   	leave
+  8043fa:	c3                   	ret
+
+00000000008043fb <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8043fb:	55                   	push   %rbp
+  8043fc:	48 89 e5             	mov    %rsp,%rbp
+  8043ff:	48 83 ec 10          	sub    $0x10,%rsp
+  804403:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804406:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80440d:	00 00 00 
+  804410:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804413:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804415:	be 00 00 00 00       	mov    $0x0,%esi
+  80441a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80441f:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+}
+  80442b:	c9                   	leave
+  80442c:	c3                   	ret
+
+000000000080442d <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  80442d:	55                   	push   %rbp
+  80442e:	48 89 e5             	mov    %rsp,%rbp
+  804431:	48 83 ec 10          	sub    $0x10,%rsp
+  804435:	89 f8                	mov    %edi,%eax
+  804437:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  80443a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  80443e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804445:	00 00 00 
+  804448:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  80444a:	be 00 00 00 00       	mov    $0x0,%esi
+  80444f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804454:	48 b8 a3 3e 80 00 00 	movabs $0x803ea3,%rax
+  80445b:	00 00 00 
+  80445e:	ff d0                	call   *%rax
+}
+  804460:	c9                   	leave
+  804461:	c3                   	ret
+
+0000000000804462 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804462:	55                   	push   %rbp
+  804463:	48 89 e5             	mov    %rsp,%rbp
+  804466:	48 83 ec 10          	sub    $0x10,%rsp
+  80446a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  80446e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804472:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804477:	48 89 c7             	mov    %rax,%rdi
+  80447a:	48 b8 88 44 80 00 00 	movabs $0x804488,%rax
+  804481:	00 00 00 
+  804484:	ff d0                	call   *%rax
+}
+  804486:	c9                   	leave
+  804487:	c3                   	ret
+
+0000000000804488 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804488:	55                   	push   %rbp
+  804489:	48 89 e5             	mov    %rsp,%rbp
+  80448c:	48 83 ec 50          	sub    $0x50,%rsp
+  804490:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804494:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804498:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80449f:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8044a0:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8044a5:	74 0a                	je     8044b1 <pipe_size+0x29>
+  8044a7:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8044ae:	00 
+  8044af:	76 0a                	jbe    8044bb <pipe_size+0x33>
+    return -E_INVAL;
+  8044b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044b6:	e9 cc 02 00 00       	jmp    804787 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8044bb:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8044bf:	48 89 c7             	mov    %rax,%rdi
+  8044c2:	48 b8 84 2f 80 00 00 	movabs $0x802f84,%rax
+  8044c9:	00 00 00 
+  8044cc:	ff d0                	call   *%rax
+  8044ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044d5:	0f 88 a8 02 00 00    	js     804783 <pipe_size+0x2fb>
+  8044db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044df:	ba 07 04 00 00       	mov    $0x407,%edx
+  8044e4:	48 89 c6             	mov    %rax,%rsi
+  8044e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ec:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8044f3:	00 00 00 
+  8044f6:	ff d0                	call   *%rax
+  8044f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044ff:	0f 88 7e 02 00 00    	js     804783 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804505:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804509:	48 89 c7             	mov    %rax,%rdi
+  80450c:	48 b8 84 2f 80 00 00 	movabs $0x802f84,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+  804518:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80451b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80451f:	0f 88 43 02 00 00    	js     804768 <pipe_size+0x2e0>
+  804525:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804529:	ba 07 04 00 00       	mov    $0x407,%edx
+  80452e:	48 89 c6             	mov    %rax,%rsi
+  804531:	bf 00 00 00 00       	mov    $0x0,%edi
+  804536:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  80453d:	00 00 00 
+  804540:	ff d0                	call   *%rax
+  804542:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804545:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804549:	0f 88 19 02 00 00    	js     804768 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80454f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804553:	48 89 c7             	mov    %rax,%rdi
+  804556:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  80455d:	00 00 00 
+  804560:	ff d0                	call   *%rax
+  804562:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804566:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80456d:	00 
+  80456e:	e9 a2 00 00 00       	jmp    804615 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804573:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804577:	48 c1 e0 0c          	shl    $0xc,%rax
+  80457b:	48 89 c2             	mov    %rax,%rdx
+  80457e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804582:	48 01 d0             	add    %rdx,%rax
+  804585:	ba 07 04 00 00       	mov    $0x407,%edx
+  80458a:	48 89 c6             	mov    %rax,%rsi
+  80458d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804592:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  804599:	00 00 00 
+  80459c:	ff d0                	call   *%rax
+  80459e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045a1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045a5:	0f 88 37 01 00 00    	js     8046e2 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8045ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045af:	48 89 c7             	mov    %rax,%rdi
+  8045b2:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  8045b9:	00 00 00 
+  8045bc:	ff d0                	call   *%rax
+  8045be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8045c2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8045c6:	48 01 c2             	add    %rax,%rdx
+  8045c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045cd:	48 c1 e0 0c          	shl    $0xc,%rax
+  8045d1:	48 89 c1             	mov    %rax,%rcx
+  8045d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045d8:	48 01 c8             	add    %rcx,%rax
+  8045db:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8045e1:	48 89 d1             	mov    %rdx,%rcx
+  8045e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045e9:	48 89 c6             	mov    %rax,%rsi
+  8045ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045f1:	48 b8 c7 20 80 00 00 	movabs $0x8020c7,%rax
+  8045f8:	00 00 00 
+  8045fb:	ff d0                	call   *%rax
+  8045fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804600:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804604:	79 0a                	jns    804610 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804606:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80460b:	e9 d3 00 00 00       	jmp    8046e3 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804610:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804615:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80461c:	00 
+  80461d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804621:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804625:	48 01 d0             	add    %rdx,%rax
+  804628:	48 83 c0 1f          	add    $0x1f,%rax
+  80462c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804630:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804634:	ba 00 00 00 00       	mov    $0x0,%edx
+  804639:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80463d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804641:	48 29 d0             	sub    %rdx,%rax
+  804644:	48 c1 e8 0c          	shr    $0xc,%rax
+  804648:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80464c:	0f 82 21 ff ff ff    	jb     804573 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804656:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80465a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80465e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804662:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804666:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80466a:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804671:	00 00 00 
+  804674:	8b 12                	mov    (%rdx),%edx
+  804676:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80467c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804683:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804687:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  80468e:	00 00 00 
+  804691:	8b 12                	mov    (%rdx),%edx
+  804693:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804695:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804699:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8046a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a4:	48 89 c7             	mov    %rax,%rdi
+  8046a7:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  8046ae:	00 00 00 
+  8046b1:	ff d0                	call   *%rax
+  8046b3:	89 c2                	mov    %eax,%edx
+  8046b5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8046b9:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8046bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046bf:	48 89 c7             	mov    %rax,%rdi
+  8046c2:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  8046c9:	00 00 00 
+  8046cc:	ff d0                	call   *%rax
+  8046ce:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8046d2:	48 83 c2 04          	add    $0x4,%rdx
+  8046d6:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8046d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046dd:	e9 a5 00 00 00       	jmp    804787 <pipe_size+0x2ff>
+      goto err2;
+  8046e2:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8046e3:	eb 58                	jmp    80473d <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8046e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046e9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046ed:	48 89 c2             	mov    %rax,%rdx
+  8046f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f4:	48 01 d0             	add    %rdx,%rax
+  8046f7:	48 89 c6             	mov    %rax,%rsi
+  8046fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046ff:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804706:	00 00 00 
+  804709:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80470b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80470f:	48 89 c7             	mov    %rax,%rdi
+  804712:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  804719:	00 00 00 
+  80471c:	ff d0                	call   *%rax
+  80471e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804722:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804726:	48 01 d0             	add    %rdx,%rax
+  804729:	48 89 c6             	mov    %rax,%rsi
+  80472c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804731:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804738:	00 00 00 
+  80473b:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80473d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804741:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804745:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804749:	48 85 c0             	test   %rax,%rax
+  80474c:	75 97                	jne    8046e5 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  80474e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804752:	48 89 c6             	mov    %rax,%rsi
+  804755:	bf 00 00 00 00       	mov    $0x0,%edi
+  80475a:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804761:	00 00 00 
+  804764:	ff d0                	call   *%rax
+  804766:	eb 01                	jmp    804769 <pipe_size+0x2e1>
+    goto err1;
+  804768:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80476d:	48 89 c6             	mov    %rax,%rsi
+  804770:	bf 00 00 00 00       	mov    $0x0,%edi
+  804775:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80477c:	00 00 00 
+  80477f:	ff d0                	call   *%rax
+  804781:	eb 01                	jmp    804784 <pipe_size+0x2fc>
+    goto err;
+  804783:	90                   	nop
+err:
+  return r;
+  804784:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804787:	c9                   	leave
+  804788:	c3                   	ret
+
+0000000000804789 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804789:	55                   	push   %rbp
+  80478a:	48 89 e5             	mov    %rsp,%rbp
+  80478d:	53                   	push   %rbx
+  80478e:	48 83 ec 28          	sub    $0x28,%rsp
+  804792:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804796:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80479a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8047a1:	00 00 00 
+  8047a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8047a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8047ac:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8047b3:	00 00 00 
+  8047b6:	48 98                	cltq
+  8047b8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8047bf:	48 01 d0             	add    %rdx,%rax
+  8047c2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8047c8:	8b 00                	mov    (%rax),%eax
+  8047ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8047cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047d1:	48 89 c7             	mov    %rax,%rdi
+  8047d4:	48 b8 39 5d 80 00 00 	movabs $0x805d39,%rax
+  8047db:	00 00 00 
+  8047de:	ff d0                	call   *%rax
+  8047e0:	89 c3                	mov    %eax,%ebx
+  8047e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047e6:	48 89 c7             	mov    %rax,%rdi
+  8047e9:	48 b8 39 5d 80 00 00 	movabs $0x805d39,%rax
+  8047f0:	00 00 00 
+  8047f3:	ff d0                	call   *%rax
+  8047f5:	39 c3                	cmp    %eax,%ebx
+  8047f7:	0f 94 c0             	sete   %al
+  8047fa:	0f b6 c0             	movzbl %al,%eax
+  8047fd:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804800:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804807:	00 00 00 
+  80480a:	8b 40 04             	mov    0x4(%rax),%eax
+  80480d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804812:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804819:	00 00 00 
+  80481c:	48 98                	cltq
+  80481e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804825:	48 01 d0             	add    %rdx,%rax
+  804828:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80482e:	8b 00                	mov    (%rax),%eax
+  804830:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804833:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804836:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804839:	75 05                	jne    804840 <_pipeisclosed+0xb7>
+      return ret;
+  80483b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80483e:	eb 68                	jmp    8048a8 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804840:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804843:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804846:	0f 84 4e ff ff ff    	je     80479a <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80484c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804853:	00 00 00 
+  804856:	8b 40 04             	mov    0x4(%rax),%eax
+  804859:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80485e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804865:	00 00 00 
+  804868:	48 98                	cltq
+  80486a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804871:	48 01 d0             	add    %rdx,%rax
+  804874:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80487a:	8b 10                	mov    (%rax),%edx
+  80487c:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80487f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804882:	89 c6                	mov    %eax,%esi
+  804884:	48 b8 10 6c 80 00 00 	movabs $0x806c10,%rax
+  80488b:	00 00 00 
+  80488e:	48 89 c7             	mov    %rax,%rdi
+  804891:	b8 00 00 00 00       	mov    $0x0,%eax
+  804896:	49 b8 f1 02 80 00 00 	movabs $0x8002f1,%r8
+  80489d:	00 00 00 
+  8048a0:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8048a3:	e9 f2 fe ff ff       	jmp    80479a <_pipeisclosed+0x11>
+  }
+}
+  8048a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8048ac:	c9                   	leave
+  8048ad:	c3                   	ret
+
+00000000008048ae <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8048ae:	55                   	push   %rbp
+  8048af:	48 89 e5             	mov    %rsp,%rbp
+  8048b2:	48 83 ec 30          	sub    $0x30,%rsp
+  8048b6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8048b9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8048bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048c0:	48 89 d6             	mov    %rdx,%rsi
+  8048c3:	89 c7                	mov    %eax,%edi
+  8048c5:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8048cc:	00 00 00 
+  8048cf:	ff d0                	call   *%rax
+  8048d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d8:	79 05                	jns    8048df <pipeisclosed+0x31>
+    return r;
+  8048da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048dd:	eb 31                	jmp    804910 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8048df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e3:	48 89 c7             	mov    %rax,%rdi
+  8048e6:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  8048ed:	00 00 00 
+  8048f0:	ff d0                	call   *%rax
+  8048f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8048f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048fe:	48 89 d6             	mov    %rdx,%rsi
+  804901:	48 89 c7             	mov    %rax,%rdi
+  804904:	48 b8 89 47 80 00 00 	movabs $0x804789,%rax
+  80490b:	00 00 00 
+  80490e:	ff d0                	call   *%rax
+}
+  804910:	c9                   	leave
+  804911:	c3                   	ret
+
+0000000000804912 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804912:	55                   	push   %rbp
+  804913:	48 89 e5             	mov    %rsp,%rbp
+  804916:	48 83 ec 10          	sub    $0x10,%rsp
+  80491a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80491e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804922:	8b 40 18             	mov    0x18(%rax),%eax
+  804925:	8d 50 01             	lea    0x1(%rax),%edx
+  804928:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80492c:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80492f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804933:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804936:	85 c0                	test   %eax,%eax
+  804938:	74 27                	je     804961 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80493a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804949:	48 83 c0 18          	add    $0x18,%rax
+  80494d:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804952:	48 89 c7             	mov    %rax,%rdi
+  804955:	48 b8 6a 24 80 00 00 	movabs $0x80246a,%rax
+  80495c:	00 00 00 
+  80495f:	ff d0                	call   *%rax
+  }
+}
+  804961:	90                   	nop
+  804962:	c9                   	leave
+  804963:	c3                   	ret
+
+0000000000804964 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804964:	55                   	push   %rbp
+  804965:	48 89 e5             	mov    %rsp,%rbp
+  804968:	48 83 ec 10          	sub    $0x10,%rsp
+  80496c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804970:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804977:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80497e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804982:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804986:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804989:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804990:	89 c6                	mov    %eax,%esi
+  804992:	48 89 cf             	mov    %rcx,%rdi
+  804995:	48 b8 1b 24 80 00 00 	movabs $0x80241b,%rax
+  80499c:	00 00 00 
+  80499f:	ff d0                	call   *%rax
+}
+  8049a1:	90                   	nop
+  8049a2:	c9                   	leave
+  8049a3:	c3                   	ret
+
+00000000008049a4 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8049a4:	55                   	push   %rbp
+  8049a5:	48 89 e5             	mov    %rsp,%rbp
+  8049a8:	48 83 ec 70          	sub    $0x70,%rsp
+  8049ac:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8049b0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8049b4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8049b8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8049bc:	48 89 c7             	mov    %rax,%rdi
+  8049bf:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  8049c6:	00 00 00 
+  8049c9:	ff d0                	call   *%rax
+  8049cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8049cf:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8049d4:	75 0a                	jne    8049e0 <devpipe_read+0x3c>
+    return 0;
+  8049d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049db:	e9 63 01 00 00       	jmp    804b43 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8049e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049e4:	8b 40 18             	mov    0x18(%rax),%eax
+  8049e7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8049ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049ee:	48 8b 10             	mov    (%rax),%rdx
+  8049f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049f9:	48 39 c2             	cmp    %rax,%rdx
+  8049fc:	75 42                	jne    804a40 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8049fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a02:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a06:	48 89 d6             	mov    %rdx,%rsi
+  804a09:	48 89 c7             	mov    %rax,%rdi
+  804a0c:	48 b8 89 47 80 00 00 	movabs $0x804789,%rax
+  804a13:	00 00 00 
+  804a16:	ff d0                	call   *%rax
+  804a18:	85 c0                	test   %eax,%eax
+  804a1a:	74 0a                	je     804a26 <devpipe_read+0x82>
+      return 0;
+  804a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a21:	e9 1d 01 00 00       	jmp    804b43 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804a26:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804a29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a2d:	89 d6                	mov    %edx,%esi
+  804a2f:	48 89 c7             	mov    %rax,%rdi
+  804a32:	48 b8 64 49 80 00 00 	movabs $0x804964,%rax
+  804a39:	00 00 00 
+  804a3c:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804a3e:	eb a0                	jmp    8049e0 <devpipe_read+0x3c>
+      break;
+  804a40:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804a41:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804a45:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804a49:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804a4d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a55:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804a59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a5d:	48 8b 00             	mov    (%rax),%rax
+  804a60:	48 29 c2             	sub    %rax,%rdx
+  804a63:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804a67:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a6f:	48 39 c2             	cmp    %rax,%rdx
+  804a72:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a76:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804a7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a7e:	48 8b 00             	mov    (%rax),%rax
+  804a81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a85:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a8e:	48 f7 f1             	div    %rcx
+  804a91:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804a95:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804a99:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804a9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804aa1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804aa5:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804aad:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ab1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ab5:	48 39 c2             	cmp    %rax,%rdx
+  804ab8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804abc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804ac0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ac4:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804ac8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804acc:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804ad0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad8:	48 89 ce             	mov    %rcx,%rsi
+  804adb:	48 89 c7             	mov    %rax,%rdi
+  804ade:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  804ae5:	00 00 00 
+  804ae8:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804aea:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804aee:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804af2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804af6:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804afa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804afe:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b02:	48 01 d1             	add    %rdx,%rcx
+  804b05:	48 89 c2             	mov    %rax,%rdx
+  804b08:	48 89 cf             	mov    %rcx,%rdi
+  804b0b:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  804b12:	00 00 00 
+  804b15:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804b17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b1b:	48 8b 10             	mov    (%rax),%rdx
+  804b1e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804b22:	48 01 c2             	add    %rax,%rdx
+  804b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b29:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804b2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b30:	48 89 c7             	mov    %rax,%rdi
+  804b33:	48 b8 12 49 80 00 00 	movabs $0x804912,%rax
+  804b3a:	00 00 00 
+  804b3d:	ff d0                	call   *%rax
+  return n;
+  804b3f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804b43:	c9                   	leave
+  804b44:	c3                   	ret
+
+0000000000804b45 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804b45:	55                   	push   %rbp
+  804b46:	48 89 e5             	mov    %rsp,%rbp
+  804b49:	48 83 ec 70          	sub    $0x70,%rsp
+  804b4d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804b51:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804b55:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804b59:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804b5d:	48 89 c7             	mov    %rax,%rdi
+  804b60:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  804b67:	00 00 00 
+  804b6a:	ff d0                	call   *%rax
+  804b6c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804b70:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804b74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804b78:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804b7f:	00 
+  804b80:	e9 b8 01 00 00       	jmp    804d3d <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804b85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b89:	8b 40 18             	mov    0x18(%rax),%eax
+  804b8c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b93:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b9b:	48 8b 00             	mov    (%rax),%rax
+  804b9e:	48 29 c2             	sub    %rax,%rdx
+  804ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ba9:	48 39 c2             	cmp    %rax,%rdx
+  804bac:	75 4d                	jne    804bfb <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804bae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bb2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804bb6:	48 89 d6             	mov    %rdx,%rsi
+  804bb9:	48 89 c7             	mov    %rax,%rdi
+  804bbc:	48 b8 89 47 80 00 00 	movabs $0x804789,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	85 c0                	test   %eax,%eax
+  804bca:	74 0a                	je     804bd6 <devpipe_write+0x91>
+        return 0;
+  804bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd1:	e9 79 01 00 00       	jmp    804d4f <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804bd6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bdd:	89 d6                	mov    %edx,%esi
+  804bdf:	48 89 c7             	mov    %rax,%rdi
+  804be2:	48 b8 64 49 80 00 00 	movabs $0x804964,%rax
+  804be9:	00 00 00 
+  804bec:	ff d0                	call   *%rax
+      m = 0;
+  804bee:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804bf5:	00 
+      continue;
+  804bf6:	e9 3a 01 00 00       	jmp    804d35 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804bfb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804bff:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804c03:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c0b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c13:	48 8b 08             	mov    (%rax),%rcx
+  804c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c1e:	48 29 c1             	sub    %rax,%rcx
+  804c21:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804c25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804c29:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804c2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c31:	48 39 c2             	cmp    %rax,%rdx
+  804c34:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804c38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c40:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c44:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c48:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c51:	48 f7 f1             	div    %rcx
+  804c54:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804c58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c5c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804c60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c64:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804c68:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804c6c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804c70:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c74:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c78:	48 39 c2             	cmp    %rax,%rdx
+  804c7b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804c7f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804c83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c87:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804c8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c8f:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804c93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804c97:	48 01 d1             	add    %rdx,%rcx
+  804c9a:	48 89 c2             	mov    %rax,%rdx
+  804c9d:	48 89 cf             	mov    %rcx,%rdi
+  804ca0:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  804ca7:	00 00 00 
+  804caa:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804cac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cb0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cb4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804cb8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804cbc:	73 4d                	jae    804d0b <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cc2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804cca:	48 29 c2             	sub    %rax,%rdx
+  804ccd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cd1:	48 01 c2             	add    %rax,%rdx
+  804cd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cdc:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804ce0:	48 89 c1             	mov    %rax,%rcx
+  804ce3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce7:	48 01 c1             	add    %rax,%rcx
+  804cea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cee:	48 01 c1             	add    %rax,%rcx
+  804cf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf5:	48 83 c0 20          	add    $0x20,%rax
+  804cf9:	48 89 ce             	mov    %rcx,%rsi
+  804cfc:	48 89 c7             	mov    %rax,%rdi
+  804cff:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  804d06:	00 00 00 
+  804d09:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d17:	48 01 c2             	add    %rax,%rdx
+  804d1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d1e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d26:	48 89 c7             	mov    %rax,%rdi
+  804d29:	48 b8 12 49 80 00 00 	movabs $0x804912,%rax
+  804d30:	00 00 00 
+  804d33:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804d35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d39:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804d3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d41:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804d45:	0f 82 3a fe ff ff    	jb     804b85 <devpipe_write+0x40>
+  }
+
+  return i;
+  804d4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804d4f:	c9                   	leave
+  804d50:	c3                   	ret
+
+0000000000804d51 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804d51:	55                   	push   %rbp
+  804d52:	48 89 e5             	mov    %rsp,%rbp
+  804d55:	48 83 ec 40          	sub    $0x40,%rsp
+  804d59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804d5d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804d60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d68:	48 89 c7             	mov    %rax,%rdi
+  804d6b:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  804d72:	00 00 00 
+  804d75:	ff d0                	call   *%rax
+  804d77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804d7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804d82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d86:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804d8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d8e:	48 89 d6             	mov    %rdx,%rsi
+  804d91:	48 89 c7             	mov    %rax,%rdi
+  804d94:	48 b8 2c 3a 80 00 00 	movabs $0x803a2c,%rax
+  804d9b:	00 00 00 
+  804d9e:	ff d0                	call   *%rax
+  804da0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804da3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da7:	79 08                	jns    804db1 <devpipe_poll+0x60>
+    return r;
+  804da9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dac:	e9 85 00 00 00       	jmp    804e36 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804db1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804db4:	83 e0 01             	and    $0x1,%eax
+  804db7:	85 c0                	test   %eax,%eax
+  804db9:	74 18                	je     804dd3 <devpipe_poll+0x82>
+  804dbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dbf:	48 8b 10             	mov    (%rax),%rdx
+  804dc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dc6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804dca:	48 39 c2             	cmp    %rax,%rdx
+  804dcd:	74 04                	je     804dd3 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804dcf:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804dd3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804dd6:	83 e0 02             	and    $0x2,%eax
+  804dd9:	85 c0                	test   %eax,%eax
+  804ddb:	74 23                	je     804e00 <devpipe_poll+0xaf>
+  804ddd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804de1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804de5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804de9:	48 8b 00             	mov    (%rax),%rax
+  804dec:	48 29 c2             	sub    %rax,%rdx
+  804def:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804df3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804df7:	48 39 c2             	cmp    %rax,%rdx
+  804dfa:	73 04                	jae    804e00 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804dfc:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804e00:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e08:	48 89 d6             	mov    %rdx,%rsi
+  804e0b:	48 89 c7             	mov    %rax,%rdi
+  804e0e:	48 b8 89 47 80 00 00 	movabs $0x804789,%rax
+  804e15:	00 00 00 
+  804e18:	ff d0                	call   *%rax
+  804e1a:	85 c0                	test   %eax,%eax
+  804e1c:	74 04                	je     804e22 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804e1e:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804e22:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e26:	75 0b                	jne    804e33 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804e28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e2c:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804e33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804e36:	c9                   	leave
+  804e37:	c3                   	ret
+
+0000000000804e38 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804e38:	55                   	push   %rbp
+  804e39:	48 89 e5             	mov    %rsp,%rbp
+  804e3c:	48 83 ec 20          	sub    $0x20,%rsp
+  804e40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e44:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e4c:	48 89 c7             	mov    %rax,%rdi
+  804e4f:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  804e56:	00 00 00 
+  804e59:	ff d0                	call   *%rax
+  804e5b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804e5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e63:	48 ba 41 6c 80 00 00 	movabs $0x806c41,%rdx
+  804e6a:	00 00 00 
+  804e6d:	48 89 d6             	mov    %rdx,%rsi
+  804e70:	48 89 c7             	mov    %rax,%rdi
+  804e73:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  804e7a:	00 00 00 
+  804e7d:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804e7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804e87:	89 c1                	mov    %eax,%ecx
+  804e89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e8d:	48 8b 00             	mov    (%rax),%rax
+  804e90:	89 c2                	mov    %eax,%edx
+  804e92:	89 c8                	mov    %ecx,%eax
+  804e94:	29 d0                	sub    %edx,%eax
+  804e96:	89 c2                	mov    %eax,%edx
+  804e98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e9c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804ea2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ea6:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804ead:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804eb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb4:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  804ebb:	00 00 00 
+  804ebe:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eca:	c9                   	leave
+  804ecb:	c3                   	ret
+
+0000000000804ecc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804ecc:	55                   	push   %rbp
+  804ecd:	48 89 e5             	mov    %rsp,%rbp
+  804ed0:	48 83 ec 40          	sub    $0x40,%rsp
+  804ed4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ed8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804edc:	48 89 c7             	mov    %rax,%rdi
+  804edf:	48 b8 59 2f 80 00 00 	movabs $0x802f59,%rax
+  804ee6:	00 00 00 
+  804ee9:	ff d0                	call   *%rax
+  804eeb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804eef:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804ef6:	00 
+  804ef7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804efb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804eff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f03:	48 01 d0             	add    %rdx,%rax
+  804f06:	48 83 c0 1f          	add    $0x1f,%rax
+  804f0a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f17:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804f1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f1f:	48 29 d0             	sub    %rdx,%rax
+  804f22:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f26:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804f2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f2e:	48 89 c6             	mov    %rax,%rsi
+  804f31:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f36:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804f3d:	00 00 00 
+  804f40:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804f42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f46:	48 89 c7             	mov    %rax,%rdi
+  804f49:	48 b8 12 49 80 00 00 	movabs $0x804912,%rax
+  804f50:	00 00 00 
+  804f53:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804f55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f59:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804f5d:	eb 2f                	jmp    804f8e <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804f5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f63:	48 83 e8 01          	sub    $0x1,%rax
+  804f67:	48 c1 e0 0c          	shl    $0xc,%rax
+  804f6b:	48 89 c2             	mov    %rax,%rdx
+  804f6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f72:	48 01 d0             	add    %rdx,%rax
+  804f75:	48 89 c6             	mov    %rax,%rsi
+  804f78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f7d:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804f84:	00 00 00 
+  804f87:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804f89:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804f8e:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804f93:	77 ca                	ja     804f5f <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804f95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f99:	48 89 c6             	mov    %rax,%rsi
+  804f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fa1:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  804fa8:	00 00 00 
+  804fab:	ff d0                	call   *%rax
+}
+  804fad:	c9                   	leave
+  804fae:	c3                   	ret
+
+0000000000804faf <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  804faf:	55                   	push   %rbp
+  804fb0:	48 89 e5             	mov    %rsp,%rbp
+  804fb3:	48 83 ec 10          	sub    $0x10,%rsp
+  804fb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fbb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  804fbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fc3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fc7:	48 89 c7             	mov    %rax,%rdi
+  804fca:	ff d2                	call   *%rdx
+  thread_exit(0);
+  804fcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd1:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  804fd8:	00 00 00 
+  804fdb:	ff d0                	call   *%rax
+}
+  804fdd:	90                   	nop
+  804fde:	c9                   	leave
+  804fdf:	c3                   	ret
+
+0000000000804fe0 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  804fe0:	55                   	push   %rbp
+  804fe1:	48 89 e5             	mov    %rsp,%rbp
+  804fe4:	48 83 ec 20          	sub    $0x20,%rsp
+  804fe8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  804feb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fee:	c1 e0 10             	shl    $0x10,%eax
+  804ff1:	48 98                	cltq
+  804ff3:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  804ff8:	48 01 d0             	add    %rdx,%rax
+  804ffb:	48 89 c6             	mov    %rax,%rsi
+  804ffe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805003:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80500a:	00 00 00 
+  80500d:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80500f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805012:	83 c0 01             	add    $0x1,%eax
+  805015:	c1 e0 10             	shl    $0x10,%eax
+  805018:	48 98                	cltq
+  80501a:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80501f:	48 01 d0             	add    %rdx,%rax
+  805022:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805026:	eb 20                	jmp    805048 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805028:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80502c:	48 89 c6             	mov    %rax,%rsi
+  80502f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805034:	48 b8 27 21 80 00 00 	movabs $0x802127,%rax
+  80503b:	00 00 00 
+  80503e:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805040:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805047:	00 
+  805048:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80504b:	83 c0 01             	add    $0x1,%eax
+  80504e:	c1 e0 10             	shl    $0x10,%eax
+  805051:	48 98                	cltq
+  805053:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805058:	48 01 d0             	add    %rdx,%rax
+  80505b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80505f:	72 c7                	jb     805028 <slot_unmap+0x48>
+}
+  805061:	90                   	nop
+  805062:	90                   	nop
+  805063:	c9                   	leave
+  805064:	c3                   	ret
+
+0000000000805065 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805065:	55                   	push   %rbp
+  805066:	48 89 e5             	mov    %rsp,%rbp
+  805069:	48 83 ec 30          	sub    $0x30,%rsp
+  80506d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805071:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805075:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80507c:	00 00 00 
+  80507f:	48 89 c7             	mov    %rax,%rdi
+  805082:	48 b8 5c 5f 80 00 00 	movabs $0x805f5c,%rax
+  805089:	00 00 00 
+  80508c:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  80508e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805095:	eb 04                	jmp    80509b <thread_create+0x36>
+  805097:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80509b:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  80509f:	7f 16                	jg     8050b7 <thread_create+0x52>
+  8050a1:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8050a8:	00 00 00 
+  8050ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050ae:	48 98                	cltq
+  8050b0:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8050b3:	85 c0                	test   %eax,%eax
+  8050b5:	75 e0                	jne    805097 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8050b7:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8050bb:	75 0c                	jne    8050c9 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8050bd:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8050c4:	e9 2c 01 00 00       	jmp    8051f5 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8050c9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050cc:	c1 e0 10             	shl    $0x10,%eax
+  8050cf:	48 98                	cltq
+  8050d1:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8050d6:	48 01 d0             	add    %rdx,%rax
+  8050d9:	ba 07 00 00 00       	mov    $0x7,%edx
+  8050de:	48 89 c6             	mov    %rax,%rsi
+  8050e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050e6:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8050ed:	00 00 00 
+  8050f0:	ff d0                	call   *%rax
+  8050f2:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8050f5:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8050f9:	0f 88 f5 00 00 00    	js     8051f4 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8050ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805102:	83 c0 01             	add    $0x1,%eax
+  805105:	c1 e0 10             	shl    $0x10,%eax
+  805108:	48 98                	cltq
+  80510a:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80510f:	48 01 d0             	add    %rdx,%rax
+  805112:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805116:	eb 32                	jmp    80514a <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805118:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80511c:	ba 07 00 00 00       	mov    $0x7,%edx
+  805121:	48 89 c6             	mov    %rax,%rsi
+  805124:	bf 00 00 00 00       	mov    $0x0,%edi
+  805129:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  805130:	00 00 00 
+  805133:	ff d0                	call   *%rax
+  805135:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805138:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80513c:	0f 88 9e 00 00 00    	js     8051e0 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805142:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805149:	00 
+  80514a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80514d:	83 c0 01             	add    $0x1,%eax
+  805150:	c1 e0 10             	shl    $0x10,%eax
+  805153:	48 98                	cltq
+  805155:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80515a:	48 01 d0             	add    %rdx,%rax
+  80515d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805161:	72 b5                	jb     805118 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805163:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805167:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80516b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80516e:	c1 e2 10             	shl    $0x10,%edx
+  805171:	48 63 d2             	movslq %edx,%rdx
+  805174:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805179:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80517c:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80517f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805182:	83 c2 01             	add    $0x1,%edx
+  805185:	c1 e2 10             	shl    $0x10,%edx
+  805188:	48 63 d2             	movslq %edx,%rdx
+  80518b:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805190:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805193:	48 bf af 4f 80 00 00 	movabs $0x804faf,%rdi
+  80519a:	00 00 00 
+  80519d:	49 89 c8             	mov    %rcx,%r8
+  8051a0:	48 89 c1             	mov    %rax,%rcx
+  8051a3:	4c 89 ca             	mov    %r9,%rdx
+  8051a6:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  8051ad:	00 00 00 
+  8051b0:	ff d0                	call   *%rax
+  8051b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8051b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051b9:	79 08                	jns    8051c3 <thread_create+0x15e>
+    r = id;
+  8051bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051be:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8051c1:	eb 1e                	jmp    8051e1 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8051c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051c6:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8051c9:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8051d0:	00 00 00 
+  8051d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8051d6:	48 98                	cltq
+  8051d8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8051db:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8051de:	eb 15                	jmp    8051f5 <thread_create+0x190>
+      goto fail;
+  8051e0:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8051e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8051e4:	89 c7                	mov    %eax,%edi
+  8051e6:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  8051ed:	00 00 00 
+  8051f0:	ff d0                	call   *%rax
+  8051f2:	eb 01                	jmp    8051f5 <thread_create+0x190>
+    goto out;
+  8051f4:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8051f5:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8051fc:	00 00 00 
+  8051ff:	48 89 c7             	mov    %rax,%rdi
+  805202:	48 b8 31 60 80 00 00 	movabs $0x806031,%rax
+  805209:	00 00 00 
+  80520c:	ff d0                	call   *%rax
+  return r;
+  80520e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805211:	c9                   	leave
+  805212:	c3                   	ret
+
+0000000000805213 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805213:	55                   	push   %rbp
+  805214:	48 89 e5             	mov    %rsp,%rbp
+  805217:	48 83 ec 10          	sub    $0x10,%rsp
+  80521b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  80521e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805221:	89 c7                	mov    %eax,%edi
+  805223:	48 b8 6c 25 80 00 00 	movabs $0x80256c,%rax
+  80522a:	00 00 00 
+  80522d:	ff d0                	call   *%rax
+}
+  80522f:	90                   	nop
+  805230:	c9                   	leave
+  805231:	c3                   	ret
+
+0000000000805232 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805232:	55                   	push   %rbp
+  805233:	48 89 e5             	mov    %rsp,%rbp
+  805236:	48 83 ec 20          	sub    $0x20,%rsp
+  80523a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80523d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805241:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805248:	00 00 00 
+  80524b:	48 89 c7             	mov    %rax,%rdi
+  80524e:	48 b8 5c 5f 80 00 00 	movabs $0x805f5c,%rax
+  805255:	00 00 00 
+  805258:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  80525a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805261:	eb 04                	jmp    805267 <thread_join+0x35>
+  805263:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805267:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80526b:	7f 17                	jg     805284 <thread_join+0x52>
+  80526d:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805274:	00 00 00 
+  805277:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80527a:	48 98                	cltq
+  80527c:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80527f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805282:	75 df                	jne    805263 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805284:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80528b:	00 00 00 
+  80528e:	48 89 c7             	mov    %rax,%rdi
+  805291:	48 b8 31 60 80 00 00 	movabs $0x806031,%rax
+  805298:	00 00 00 
+  80529b:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80529d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a1:	74 06                	je     8052a9 <thread_join+0x77>
+  8052a3:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8052a7:	75 07                	jne    8052b0 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8052a9:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8052ae:	eb 76                	jmp    805326 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8052b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052b7:	48 89 d6             	mov    %rdx,%rsi
+  8052ba:	89 c7                	mov    %eax,%edi
+  8052bc:	48 b8 4e 5e 80 00 00 	movabs $0x805e4e,%rax
+  8052c3:	00 00 00 
+  8052c6:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8052c8:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8052cf:	00 00 00 
+  8052d2:	48 89 c7             	mov    %rax,%rdi
+  8052d5:	48 b8 5c 5f 80 00 00 	movabs $0x805f5c,%rax
+  8052dc:	00 00 00 
+  8052df:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8052e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052e4:	89 c7                	mov    %eax,%edi
+  8052e6:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  8052ed:	00 00 00 
+  8052f0:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8052f2:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8052f9:	00 00 00 
+  8052fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052ff:	48 98                	cltq
+  805301:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805308:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80530f:	00 00 00 
+  805312:	48 89 c7             	mov    %rax,%rdi
+  805315:	48 b8 31 60 80 00 00 	movabs $0x806031,%rax
+  80531c:	00 00 00 
+  80531f:	ff d0                	call   *%rax
+  return 0;
+  805321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805326:	c9                   	leave
+  805327:	c3                   	ret
+
+0000000000805328 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805328:	55                   	push   %rbp
+  805329:	48 89 e5             	mov    %rsp,%rbp
+  80532c:	48 83 ec 08          	sub    $0x8,%rsp
+  805330:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805334:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805339:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80533d:	73 23                	jae    805362 <thread_is_uxstack+0x3a>
+  80533f:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805344:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805348:	72 18                	jb     805362 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  80534a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80534e:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805353:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805359:	75 07                	jne    805362 <thread_is_uxstack+0x3a>
+  80535b:	b8 01 00 00 00       	mov    $0x1,%eax
+  805360:	eb 05                	jmp    805367 <thread_is_uxstack+0x3f>
+  805362:	b8 00 00 00 00       	mov    $0x0,%eax
+  805367:	83 e0 01             	and    $0x1,%eax
+}
+  80536a:	c9                   	leave
+  80536b:	c3                   	ret
+
+000000000080536c <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80536c:	55                   	push   %rbp
+  80536d:	48 89 e5             	mov    %rsp,%rbp
+  805370:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805374:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80537b:	00 00 00 
+  80537e:	8b 40 04             	mov    0x4(%rax),%eax
+  805381:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805386:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80538d:	00 00 00 
+  805390:	48 98                	cltq
+  805392:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805399:	48 01 d0             	add    %rdx,%rax
+  80539c:	48 05 08 01 00 00    	add    $0x108,%rax
+  8053a2:	48 8b 00             	mov    (%rax),%rax
+  8053a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8053a9:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8053ae:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8053b2:	73 0b                	jae    8053bf <thread_pftemp+0x53>
+  8053b4:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8053b9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8053bd:	73 07                	jae    8053c6 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8053bf:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8053c4:	eb 26                	jmp    8053ec <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8053c6:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8053cd:	ff ff ff 
+  8053d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053d4:	48 01 d0             	add    %rdx,%rax
+  8053d7:	48 c1 e8 10          	shr    $0x10,%rax
+  8053db:	48 83 c0 01          	add    $0x1,%rax
+  8053df:	48 c1 e0 0c          	shl    $0xc,%rax
+  8053e3:	48 f7 d8             	neg    %rax
+  8053e6:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  8053ec:	c9                   	leave
+  8053ed:	c3                   	ret
+
+00000000008053ee <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8053ee:	55                   	push   %rbp
+  8053ef:	48 89 e5             	mov    %rsp,%rbp
+  8053f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8053f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8053f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053fd:	75 10                	jne    80540f <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8053ff:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805406:	00 00 00 
+  805409:	8b 00                	mov    (%rax),%eax
+  80540b:	48 98                	cltq
+  80540d:	eb 05                	jmp    805414 <vsyscall+0x26>
+  }
+  return 0;
+  80540f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805414:	c9                   	leave
+  805415:	c3                   	ret
+
+0000000000805416 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805416:	55                   	push   %rbp
+  805417:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80541a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80541f:	48 b8 ee 53 80 00 00 	movabs $0x8053ee,%rax
+  805426:	00 00 00 
+  805429:	ff d0                	call   *%rax
+}
+  80542b:	5d                   	pop    %rbp
+  80542c:	c3                   	ret
+
+000000000080542d <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80542d:	55                   	push   %rbp
+  80542e:	48 89 e5             	mov    %rsp,%rbp
+  805431:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805435:	0f 31                	rdtsc
+  805437:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80543a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80543d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805440:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805443:	48 c1 e2 20          	shl    $0x20,%rdx
+  805447:	48 09 d0             	or     %rdx,%rax
+  80544a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  80544e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805452:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805456:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80545d:	00 00 00 
+  805460:	8b 40 08             	mov    0x8(%rax),%eax
+  805463:	48 98                	cltq
+  805465:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805469:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80546d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805472:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805476:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80547d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805481:	ba 00 00 00 00       	mov    $0x0,%edx
+  805486:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80548a:	48 89 d0             	mov    %rdx,%rax
+  80548d:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805494:	ba 00 00 00 00       	mov    $0x0,%edx
+  805499:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80549d:	48 01 c8             	add    %rcx,%rax
+}
+  8054a0:	c9                   	leave
+  8054a1:	c3                   	ret
+
+00000000008054a2 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8054a2:	55                   	push   %rbp
+  8054a3:	48 89 e5             	mov    %rsp,%rbp
+  8054a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8054aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8054ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054b0:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8054b3:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8054b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8054bc:	48 89 c7             	mov    %rax,%rdi
+  8054bf:	48 b8 58 1e 80 00 00 	movabs $0x801e58,%rax
+  8054c6:	00 00 00 
+  8054c9:	ff d0                	call   *%rax
+}
+  8054cb:	90                   	nop
+  8054cc:	c9                   	leave
+  8054cd:	c3                   	ret
+
+00000000008054ce <getchar>:
+
+int
+getchar(void) {
+  8054ce:	55                   	push   %rbp
+  8054cf:	48 89 e5             	mov    %rsp,%rbp
+  8054d2:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8054d6:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8054da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054df:	48 89 c6             	mov    %rax,%rsi
+  8054e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054e7:	48 b8 c2 35 80 00 00 	movabs $0x8035c2,%rax
+  8054ee:	00 00 00 
+  8054f1:	ff d0                	call   *%rax
+  8054f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8054f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054fa:	79 05                	jns    805501 <getchar+0x33>
+    return r;
+  8054fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054ff:	eb 14                	jmp    805515 <getchar+0x47>
+  if (r < 1)
+  805501:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805505:	7f 07                	jg     80550e <getchar+0x40>
+    return -E_EOF;
+  805507:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80550c:	eb 07                	jmp    805515 <getchar+0x47>
+  return c;
+  80550e:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805512:	0f b6 c0             	movzbl %al,%eax
+}
+  805515:	c9                   	leave
+  805516:	c3                   	ret
+
+0000000000805517 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805517:	55                   	push   %rbp
+  805518:	48 89 e5             	mov    %rsp,%rbp
+  80551b:	48 83 ec 20          	sub    $0x20,%rsp
+  80551f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805522:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805526:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805529:	48 89 d6             	mov    %rdx,%rsi
+  80552c:	89 c7                	mov    %eax,%edi
+  80552e:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  805535:	00 00 00 
+  805538:	ff d0                	call   *%rax
+  80553a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80553d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805541:	79 05                	jns    805548 <iscons+0x31>
+    return r;
+  805543:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805546:	eb 1a                	jmp    805562 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805548:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80554c:	8b 10                	mov    (%rax),%edx
+  80554e:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805555:	00 00 00 
+  805558:	8b 00                	mov    (%rax),%eax
+  80555a:	39 c2                	cmp    %eax,%edx
+  80555c:	0f 94 c0             	sete   %al
+  80555f:	0f b6 c0             	movzbl %al,%eax
+}
+  805562:	c9                   	leave
+  805563:	c3                   	ret
+
+0000000000805564 <opencons>:
+
+int
+opencons(void) {
+  805564:	55                   	push   %rbp
+  805565:	48 89 e5             	mov    %rsp,%rbp
+  805568:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80556c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805570:	48 89 c7             	mov    %rax,%rdi
+  805573:	48 b8 84 2f 80 00 00 	movabs $0x802f84,%rax
+  80557a:	00 00 00 
+  80557d:	ff d0                	call   *%rax
+  80557f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805582:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805586:	79 05                	jns    80558d <opencons+0x29>
+    return r;
+  805588:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80558b:	eb 66                	jmp    8055f3 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80558d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805591:	ba 07 04 00 00       	mov    $0x407,%edx
+  805596:	48 89 c6             	mov    %rax,%rsi
+  805599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80559e:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  8055a5:	00 00 00 
+  8055a8:	ff d0                	call   *%rax
+  8055aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055b1:	79 05                	jns    8055b8 <opencons+0x54>
+    return r;
+  8055b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055b6:	eb 3b                	jmp    8055f3 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8055b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055bc:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8055c3:	00 00 00 
+  8055c6:	8b 12                	mov    (%rdx),%edx
+  8055c8:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8055ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055ce:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8055d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055d9:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8055e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055e4:	48 89 c7             	mov    %rax,%rdi
+  8055e7:	48 b8 36 2f 80 00 00 	movabs $0x802f36,%rax
+  8055ee:	00 00 00 
+  8055f1:	ff d0                	call   *%rax
+}
+  8055f3:	c9                   	leave
+  8055f4:	c3                   	ret
+
+00000000008055f5 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8055f5:	55                   	push   %rbp
+  8055f6:	48 89 e5             	mov    %rsp,%rbp
+  8055f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8055fd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805600:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805603:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805607:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80560a:	48 89 d6             	mov    %rdx,%rsi
+  80560d:	89 c7                	mov    %eax,%edi
+  80560f:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  805616:	00 00 00 
+  805619:	ff d0                	call   *%rax
+  80561b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80561e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805622:	79 05                	jns    805629 <consmode+0x34>
+    return r;
+  805624:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805627:	eb 34                	jmp    80565d <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805629:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80562d:	8b 10                	mov    (%rax),%edx
+  80562f:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805636:	00 00 00 
+  805639:	8b 00                	mov    (%rax),%eax
+  80563b:	39 c2                	cmp    %eax,%edx
+  80563d:	74 07                	je     805646 <consmode+0x51>
+    return -E_INVAL;
+  80563f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805644:	eb 17                	jmp    80565d <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80564a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80564d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805650:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805654:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805657:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80565a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80565d:	c9                   	leave
+  80565e:	c3                   	ret
+
+000000000080565f <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80565f:	55                   	push   %rbp
+  805660:	48 89 e5             	mov    %rsp,%rbp
+  805663:	48 83 ec 20          	sub    $0x20,%rsp
+  805667:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80566b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80566f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805677:	8b 50 0c             	mov    0xc(%rax),%edx
+  80567a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80567e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805682:	48 89 ce             	mov    %rcx,%rsi
+  805685:	48 89 c7             	mov    %rax,%rdi
+  805688:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  80568f:	00 00 00 
+  805692:	ff d0                	call   *%rax
+  805694:	48 98                	cltq
+}
+  805696:	c9                   	leave
+  805697:	c3                   	ret
+
+0000000000805698 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805698:	55                   	push   %rbp
+  805699:	48 89 e5             	mov    %rsp,%rbp
+  80569c:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8056a3:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8056aa:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8056b1:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8056b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8056bf:	eb 74                	jmp    805735 <devcons_write+0x9d>
+    m = n - tot;
+  8056c1:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8056c8:	89 c2                	mov    %eax,%edx
+  8056ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056cd:	29 c2                	sub    %eax,%edx
+  8056cf:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8056d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8056d5:	83 f8 7f             	cmp    $0x7f,%eax
+  8056d8:	76 07                	jbe    8056e1 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8056da:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8056e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8056e4:	48 63 d0             	movslq %eax,%rdx
+  8056e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056ea:	48 63 c8             	movslq %eax,%rcx
+  8056ed:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8056f4:	48 01 c1             	add    %rax,%rcx
+  8056f7:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8056fe:	48 89 ce             	mov    %rcx,%rsi
+  805701:	48 89 c7             	mov    %rax,%rdi
+  805704:	48 b8 e4 17 80 00 00 	movabs $0x8017e4,%rax
+  80570b:	00 00 00 
+  80570e:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805710:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805713:	48 63 d0             	movslq %eax,%rdx
+  805716:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80571d:	48 89 d6             	mov    %rdx,%rsi
+  805720:	48 89 c7             	mov    %rax,%rdi
+  805723:	48 b8 58 1e 80 00 00 	movabs $0x801e58,%rax
+  80572a:	00 00 00 
+  80572d:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80572f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805732:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805735:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805738:	48 98                	cltq
+  80573a:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805741:	0f 82 7a ff ff ff    	jb     8056c1 <devcons_write+0x29>
+  }
+  return tot;
+  805747:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80574a:	48 98                	cltq
+}
+  80574c:	c9                   	leave
+  80574d:	c3                   	ret
+
+000000000080574e <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80574e:	55                   	push   %rbp
+  80574f:	48 89 e5             	mov    %rsp,%rbp
+  805752:	48 83 ec 08          	sub    $0x8,%rsp
+  805756:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80575a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80575f:	c9                   	leave
+  805760:	c3                   	ret
+
+0000000000805761 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805761:	55                   	push   %rbp
+  805762:	48 89 e5             	mov    %rsp,%rbp
+  805765:	48 83 ec 10          	sub    $0x10,%rsp
+  805769:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80576d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805771:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805775:	48 ba 4d 6c 80 00 00 	movabs $0x806c4d,%rdx
+  80577c:	00 00 00 
+  80577f:	48 89 d6             	mov    %rdx,%rsi
+  805782:	48 89 c7             	mov    %rax,%rdi
+  805785:	48 b8 a1 12 80 00 00 	movabs $0x8012a1,%rax
+  80578c:	00 00 00 
+  80578f:	ff d0                	call   *%rax
+  return 0;
+  805791:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805796:	c9                   	leave
+  805797:	c3                   	ret
+
+0000000000805798 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805798:	55                   	push   %rbp
+  805799:	48 89 e5             	mov    %rsp,%rbp
+  80579c:	48 83 ec 30          	sub    $0x30,%rsp
+  8057a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8057a4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8057a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8057ab:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8057b2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8057b5:	83 e0 02             	and    $0x2,%eax
+  8057b8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8057bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057bf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8057c2:	83 f8 01             	cmp    $0x1,%eax
+  8057c5:	75 04                	jne    8057cb <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8057c7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8057cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8057ce:	83 e0 01             	and    $0x1,%eax
+  8057d1:	85 c0                	test   %eax,%eax
+  8057d3:	74 44                	je     805819 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8057d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8057dd:	89 c2                	mov    %eax,%edx
+  8057df:	be 00 00 00 00       	mov    $0x0,%esi
+  8057e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057e9:	48 b8 b7 24 80 00 00 	movabs $0x8024b7,%rax
+  8057f0:	00 00 00 
+  8057f3:	ff d0                	call   *%rax
+  8057f5:	83 f8 01             	cmp    $0x1,%eax
+  8057f8:	75 06                	jne    805800 <devcons_poll+0x68>
+      revents |= POLLIN;
+  8057fa:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8057fe:	eb 19                	jmp    805819 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805800:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805804:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80580a:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80580d:	89 c2                	mov    %eax,%edx
+  80580f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805813:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805819:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80581c:	c9                   	leave
+  80581d:	c3                   	ret
+
+000000000080581e <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80581e:	55                   	push   %rbp
+  80581f:	48 89 e5             	mov    %rsp,%rbp
+  805822:	53                   	push   %rbx
+  805823:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80582a:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  805831:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  805837:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80583e:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  805845:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80584c:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  805853:	84 c0                	test   %al,%al
+  805855:	74 23                	je     80587a <_panic+0x5c>
+  805857:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80585e:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  805862:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  805866:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80586a:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80586e:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  805872:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  805876:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80587a:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  805881:	00 00 00 
+  805884:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80588b:	00 00 00 
+  80588e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805892:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  805899:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8058a0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8058a7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8058ae:	00 00 00 
+  8058b1:	48 8b 18             	mov    (%rax),%rbx
+  8058b4:	48 b8 f6 1f 80 00 00 	movabs $0x801ff6,%rax
+  8058bb:	00 00 00 
+  8058be:	ff d0                	call   *%rax
+  8058c0:	89 c6                	mov    %eax,%esi
+  8058c2:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8058c8:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8058cf:	41 89 d0             	mov    %edx,%r8d
+  8058d2:	48 89 c1             	mov    %rax,%rcx
+  8058d5:	48 89 da             	mov    %rbx,%rdx
+  8058d8:	48 b8 58 6c 80 00 00 	movabs $0x806c58,%rax
+  8058df:	00 00 00 
+  8058e2:	48 89 c7             	mov    %rax,%rdi
+  8058e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058ea:	49 b9 f1 02 80 00 00 	movabs $0x8002f1,%r9
+  8058f1:	00 00 00 
+  8058f4:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8058f7:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8058fe:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805905:	48 89 d6             	mov    %rdx,%rsi
+  805908:	48 89 c7             	mov    %rax,%rdi
+  80590b:	48 b8 66 02 80 00 00 	movabs $0x800266,%rax
+  805912:	00 00 00 
+  805915:	ff d0                	call   *%rax
+  cprintf("\n");
+  805917:	48 b8 7b 6c 80 00 00 	movabs $0x806c7b,%rax
+  80591e:	00 00 00 
+  805921:	48 89 c7             	mov    %rax,%rdi
+  805924:	b8 00 00 00 00       	mov    $0x0,%eax
+  805929:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  805930:	00 00 00 
+  805933:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  805935:	cc                   	int3
+  805936:	eb fd                	jmp    805935 <_panic+0x117>
+
+0000000000805938 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805938:	55                   	push   %rbp
+  805939:	48 89 e5             	mov    %rsp,%rbp
+  80593c:	48 83 ec 20          	sub    $0x20,%rsp
+  805940:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805944:	48 b8 f6 1f 80 00 00 	movabs $0x801ff6,%rax
+  80594b:	00 00 00 
+  80594e:	ff d0                	call   *%rax
+  805950:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805953:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  80595a:	00 00 00 
+  80595d:	48 8b 00             	mov    (%rax),%rax
+  805960:	48 85 c0             	test   %rax,%rax
+  805963:	75 62                	jne    8059c7 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805965:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805968:	ba 07 00 00 00       	mov    $0x7,%edx
+  80596d:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805974:	00 00 00 
+  805977:	48 89 ce             	mov    %rcx,%rsi
+  80597a:	89 c7                	mov    %eax,%edi
+  80597c:	48 b8 6f 20 80 00 00 	movabs $0x80206f,%rax
+  805983:	00 00 00 
+  805986:	ff d0                	call   *%rax
+  805988:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  80598b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80598f:	79 36                	jns    8059c7 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805991:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805994:	89 c1                	mov    %eax,%ecx
+  805996:	48 b8 7d 6c 80 00 00 	movabs $0x806c7d,%rax
+  80599d:	00 00 00 
+  8059a0:	48 89 c2             	mov    %rax,%rdx
+  8059a3:	be 23 00 00 00       	mov    $0x23,%esi
+  8059a8:	48 b8 95 6c 80 00 00 	movabs $0x806c95,%rax
+  8059af:	00 00 00 
+  8059b2:	48 89 c7             	mov    %rax,%rdi
+  8059b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ba:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  8059c1:	00 00 00 
+  8059c4:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8059c7:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  8059ce:	00 00 00 
+  8059d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059d5:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  8059d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059db:	48 ba 38 5a 80 00 00 	movabs $0x805a38,%rdx
+  8059e2:	00 00 00 
+  8059e5:	48 89 d6             	mov    %rdx,%rsi
+  8059e8:	89 c7                	mov    %eax,%edi
+  8059ea:	48 b8 0c 22 80 00 00 	movabs $0x80220c,%rax
+  8059f1:	00 00 00 
+  8059f4:	ff d0                	call   *%rax
+  8059f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  8059f9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8059fd:	79 36                	jns    805a35 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  8059ff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a02:	89 c1                	mov    %eax,%ecx
+  805a04:	48 b8 7d 6c 80 00 00 	movabs $0x806c7d,%rax
+  805a0b:	00 00 00 
+  805a0e:	48 89 c2             	mov    %rax,%rdx
+  805a11:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805a16:	48 b8 95 6c 80 00 00 	movabs $0x806c95,%rax
+  805a1d:	00 00 00 
+  805a20:	48 89 c7             	mov    %rax,%rdi
+  805a23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a28:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  805a2f:	00 00 00 
+  805a32:	41 ff d0             	call   *%r8
+}
+  805a35:	90                   	nop
+  805a36:	c9                   	leave
+  805a37:	c3                   	ret
+
+0000000000805a38 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805a38:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805a3b:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805a3e:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805a45:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805a49:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805a4e:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805a55:	00 00 00 
+	call *%rax
+  805a58:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805a5a:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805a5f:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805a62:	41 5f                	pop    %r15
+	popq %r15
+  805a64:	41 5f                	pop    %r15
+	popq %r15
+  805a66:	41 5f                	pop    %r15
+	popq %r14
+  805a68:	41 5e                	pop    %r14
+	popq %r13
+  805a6a:	41 5d                	pop    %r13
+	popq %r12
+  805a6c:	41 5c                	pop    %r12
+	popq %r11
+  805a6e:	41 5b                	pop    %r11
+	popq %r10
+  805a70:	41 5a                	pop    %r10
+	popq %r9
+  805a72:	41 59                	pop    %r9
+	popq %r8
+  805a74:	41 58                	pop    %r8
+	popq %rsi
+  805a76:	5e                   	pop    %rsi
+	popq %rdi
+  805a77:	5f                   	pop    %rdi
+	popq %rbp
+  805a78:	5d                   	pop    %rbp
+	popq %rdx
+  805a79:	5a                   	pop    %rdx
+	popq %rcx
+  805a7a:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805a7b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805a80:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805a85:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805a89:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805a8c:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805a91:	5b                   	pop    %rbx
+	popq %rax
+  805a92:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805a93:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805a97:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805a98:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805a9d:	c3                   	ret
+
+0000000000805a9e <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805a9e:	55                   	push   %rbp
+  805a9f:	48 89 e5             	mov    %rsp,%rbp
+  805aa2:	48 83 ec 20          	sub    $0x20,%rsp
+  805aa6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805aaa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805aae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805ab2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ab6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805aba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805abe:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805ac5:	48 89 c7             	mov    %rax,%rdi
+  805ac8:	48 b8 d6 5a 80 00 00 	movabs $0x805ad6,%rax
+  805acf:	00 00 00 
+  805ad2:	ff d0                	call   *%rax
+}
+  805ad4:	c9                   	leave
+  805ad5:	c3                   	ret
+
+0000000000805ad6 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805ad6:	55                   	push   %rbp
+  805ad7:	48 89 e5             	mov    %rsp,%rbp
+  805ada:	48 83 ec 30          	sub    $0x30,%rsp
+  805ade:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ae2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ae6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805aea:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805aee:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805af3:	75 0e                	jne    805b03 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805af5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805afc:	00 00 00 
+  805aff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805b03:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805b08:	75 18                	jne    805b22 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805b0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b0e:	48 89 c7             	mov    %rax,%rdi
+  805b11:	48 b8 af 22 80 00 00 	movabs $0x8022af,%rax
+  805b18:	00 00 00 
+  805b1b:	ff d0                	call   *%rax
+  805b1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b20:	eb 1d                	jmp    805b3f <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805b22:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b26:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b2a:	48 89 d6             	mov    %rdx,%rsi
+  805b2d:	48 89 c7             	mov    %rax,%rdi
+  805b30:	48 b8 f5 22 80 00 00 	movabs $0x8022f5,%rax
+  805b37:	00 00 00 
+  805b3a:	ff d0                	call   *%rax
+  805b3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805b3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b43:	79 2a                	jns    805b6f <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805b45:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b4a:	74 0a                	je     805b56 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b50:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805b56:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805b5b:	74 0a                	je     805b67 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805b5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b61:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805b67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b6a:	e9 aa 00 00 00       	jmp    805c19 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805b6f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b74:	74 36                	je     805bac <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805b76:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b7d:	00 00 00 
+  805b80:	8b 40 04             	mov    0x4(%rax),%eax
+  805b83:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b88:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b8f:	00 00 00 
+  805b92:	48 98                	cltq
+  805b94:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b9b:	48 01 d0             	add    %rdx,%rax
+  805b9e:	48 05 24 01 00 00    	add    $0x124,%rax
+  805ba4:	8b 10                	mov    (%rax),%edx
+  805ba6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805baa:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805bac:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805bb1:	74 36                	je     805be9 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805bb3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bba:	00 00 00 
+  805bbd:	8b 40 04             	mov    0x4(%rax),%eax
+  805bc0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805bc5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805bcc:	00 00 00 
+  805bcf:	48 98                	cltq
+  805bd1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bd8:	48 01 d0             	add    %rdx,%rax
+  805bdb:	48 05 28 01 00 00    	add    $0x128,%rax
+  805be1:	8b 10                	mov    (%rax),%edx
+  805be3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805be7:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805be9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bf0:	00 00 00 
+  805bf3:	8b 40 04             	mov    0x4(%rax),%eax
+  805bf6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805bfb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c02:	00 00 00 
+  805c05:	48 98                	cltq
+  805c07:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c0e:	48 01 d0             	add    %rdx,%rax
+  805c11:	48 05 20 01 00 00    	add    $0x120,%rax
+  805c17:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805c19:	c9                   	leave
+  805c1a:	c3                   	ret
+
+0000000000805c1b <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805c1b:	55                   	push   %rbp
+  805c1c:	48 89 e5             	mov    %rsp,%rbp
+  805c1f:	48 83 ec 30          	sub    $0x30,%rsp
+  805c23:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c26:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805c29:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805c2d:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805c30:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805c35:	75 5e                	jne    805c95 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805c37:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c3e:	00 00 00 
+  805c41:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c45:	eb 4e                	jmp    805c95 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805c47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c4b:	79 3c                	jns    805c89 <ipc_send+0x6e>
+  805c4d:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805c51:	74 36                	je     805c89 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805c53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c56:	89 c1                	mov    %eax,%ecx
+  805c58:	48 b8 a8 6c 80 00 00 	movabs $0x806ca8,%rax
+  805c5f:	00 00 00 
+  805c62:	48 89 c2             	mov    %rax,%rdx
+  805c65:	be 54 00 00 00       	mov    $0x54,%esi
+  805c6a:	48 b8 ce 6c 80 00 00 	movabs $0x806cce,%rax
+  805c71:	00 00 00 
+  805c74:	48 89 c7             	mov    %rax,%rdi
+  805c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c7c:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  805c83:	00 00 00 
+  805c86:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805c89:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  805c90:	00 00 00 
+  805c93:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c95:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805c98:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805c9b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ca2:	89 c7                	mov    %eax,%edi
+  805ca4:	48 b8 58 22 80 00 00 	movabs $0x802258,%rax
+  805cab:	00 00 00 
+  805cae:	ff d0                	call   *%rax
+  805cb0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805cb3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cb7:	75 8e                	jne    805c47 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805cb9:	48 b8 32 20 80 00 00 	movabs $0x802032,%rax
+  805cc0:	00 00 00 
+  805cc3:	ff d0                	call   *%rax
+}
+  805cc5:	90                   	nop
+  805cc6:	c9                   	leave
+  805cc7:	c3                   	ret
+
+0000000000805cc8 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805cc8:	55                   	push   %rbp
+  805cc9:	48 89 e5             	mov    %rsp,%rbp
+  805ccc:	48 83 ec 18          	sub    $0x18,%rsp
+  805cd0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805cd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805cda:	eb 4d                	jmp    805d29 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805cdc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ce3:	00 00 00 
+  805ce6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ce9:	48 98                	cltq
+  805ceb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805cf2:	48 01 d0             	add    %rdx,%rax
+  805cf5:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805cfb:	8b 00                	mov    (%rax),%eax
+  805cfd:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805d00:	75 23                	jne    805d25 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805d02:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d09:	00 00 00 
+  805d0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d0f:	48 98                	cltq
+  805d11:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d18:	48 01 d0             	add    %rdx,%rax
+  805d1b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d21:	8b 00                	mov    (%rax),%eax
+  805d23:	eb 12                	jmp    805d37 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805d25:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d29:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d30:	7e aa                	jle    805cdc <ipc_find_env+0x14>
+  return 0;
+  805d32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d37:	c9                   	leave
+  805d38:	c3                   	ret
+
+0000000000805d39 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805d39:	55                   	push   %rbp
+  805d3a:	48 89 e5             	mov    %rsp,%rbp
+  805d3d:	48 83 ec 18          	sub    $0x18,%rsp
+  805d41:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805d45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d49:	48 c1 e8 27          	shr    $0x27,%rax
+  805d4d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d52:	48 89 c2             	mov    %rax,%rdx
+  805d55:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805d5c:	01 00 00 
+  805d5f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d63:	83 e0 01             	and    $0x1,%eax
+  805d66:	48 85 c0             	test   %rax,%rax
+  805d69:	74 63                	je     805dce <pageref+0x95>
+  805d6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d6f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805d73:	48 89 c2             	mov    %rax,%rdx
+  805d76:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805d7d:	01 00 00 
+  805d80:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d84:	83 e0 01             	and    $0x1,%eax
+  805d87:	48 85 c0             	test   %rax,%rax
+  805d8a:	74 42                	je     805dce <pageref+0x95>
+  805d8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d90:	48 c1 e8 15          	shr    $0x15,%rax
+  805d94:	48 89 c2             	mov    %rax,%rdx
+  805d97:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805d9e:	01 00 00 
+  805da1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805da5:	83 e0 01             	and    $0x1,%eax
+  805da8:	48 85 c0             	test   %rax,%rax
+  805dab:	74 21                	je     805dce <pageref+0x95>
+  805dad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805db1:	48 c1 e8 0c          	shr    $0xc,%rax
+  805db5:	48 89 c2             	mov    %rax,%rdx
+  805db8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805dbf:	01 00 00 
+  805dc2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dc6:	83 e0 01             	and    $0x1,%eax
+  805dc9:	48 85 c0             	test   %rax,%rax
+  805dcc:	75 07                	jne    805dd5 <pageref+0x9c>
+    return 0;
+  805dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dd3:	eb 53                	jmp    805e28 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805dd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd9:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ddd:	48 89 c2             	mov    %rax,%rdx
+  805de0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805de7:	01 00 00 
+  805dea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805df2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805df6:	83 e0 01             	and    $0x1,%eax
+  805df9:	48 85 c0             	test   %rax,%rax
+  805dfc:	75 07                	jne    805e05 <pageref+0xcc>
+    return 0;
+  805dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e03:	eb 23                	jmp    805e28 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805e05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e09:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e0d:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e14:	00 00 00 
+  805e17:	48 c1 e0 04          	shl    $0x4,%rax
+  805e1b:	48 01 d0             	add    %rdx,%rax
+  805e1e:	48 83 c0 08          	add    $0x8,%rax
+  805e22:	0f b7 00             	movzwl (%rax),%eax
+  805e25:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e28:	c9                   	leave
+  805e29:	c3                   	ret
+
+0000000000805e2a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805e2a:	55                   	push   %rbp
+  805e2b:	48 89 e5             	mov    %rsp,%rbp
+  805e2e:	48 83 ec 10          	sub    $0x10,%rsp
+  805e32:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805e35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e38:	be 00 00 00 00       	mov    $0x0,%esi
+  805e3d:	89 c7                	mov    %eax,%edi
+  805e3f:	48 b8 4e 5e 80 00 00 	movabs $0x805e4e,%rax
+  805e46:	00 00 00 
+  805e49:	ff d0                	call   *%rax
+}
+  805e4b:	90                   	nop
+  805e4c:	c9                   	leave
+  805e4d:	c3                   	ret
+
+0000000000805e4e <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805e4e:	55                   	push   %rbp
+  805e4f:	48 89 e5             	mov    %rsp,%rbp
+  805e52:	48 83 ec 10          	sub    $0x10,%rsp
+  805e56:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805e59:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805e5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e61:	75 3e                	jne    805ea1 <waitpid+0x53>
+  805e63:	48 b8 d8 6c 80 00 00 	movabs $0x806cd8,%rax
+  805e6a:	00 00 00 
+  805e6d:	48 89 c1             	mov    %rax,%rcx
+  805e70:	48 b8 e3 6c 80 00 00 	movabs $0x806ce3,%rax
+  805e77:	00 00 00 
+  805e7a:	48 89 c2             	mov    %rax,%rdx
+  805e7d:	be 0e 00 00 00       	mov    $0xe,%esi
+  805e82:	48 b8 f8 6c 80 00 00 	movabs $0x806cf8,%rax
+  805e89:	00 00 00 
+  805e8c:	48 89 c7             	mov    %rax,%rdi
+  805e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e94:	49 b8 1e 58 80 00 00 	movabs $0x80581e,%r8
+  805e9b:	00 00 00 
+  805e9e:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805ea1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805ea6:	74 0a                	je     805eb2 <waitpid+0x64>
+    *status = 0;
+  805ea8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805eac:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805eb2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805eb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eb9:	48 89 d6             	mov    %rdx,%rsi
+  805ebc:	89 c7                	mov    %eax,%edi
+  805ebe:	48 b8 6e 1f 80 00 00 	movabs $0x801f6e,%rax
+  805ec5:	00 00 00 
+  805ec8:	ff d0                	call   *%rax
+}
+  805eca:	c9                   	leave
+  805ecb:	c3                   	ret
+
+0000000000805ecc <xchg>:
+  805ecc:	55                   	push   %rbp
+  805ecd:	48 89 e5             	mov    %rsp,%rbp
+  805ed0:	48 83 ec 20          	sub    $0x20,%rsp
+  805ed4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ed8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805edb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805edf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ee2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ee6:	f0 87 02             	lock xchg %eax,(%rdx)
+  805ee9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805eec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eef:	c9                   	leave
+  805ef0:	c3                   	ret
+
+0000000000805ef1 <cmpxchg>:
+  805ef1:	55                   	push   %rbp
+  805ef2:	48 89 e5             	mov    %rsp,%rbp
+  805ef5:	48 83 ec 20          	sub    $0x20,%rsp
+  805ef9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805efd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f00:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805f03:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805f07:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805f0a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f0d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f11:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805f15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f1b:	c9                   	leave
+  805f1c:	c3                   	ret
+
+0000000000805f1d <xadd>:
+  805f1d:	55                   	push   %rbp
+  805f1e:	48 89 e5             	mov    %rsp,%rbp
+  805f21:	48 83 ec 10          	sub    $0x10,%rsp
+  805f25:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f29:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805f2c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805f30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f33:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f37:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805f3b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  805f3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f41:	c9                   	leave
+  805f42:	c3                   	ret
+
+0000000000805f43 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805f43:	55                   	push   %rbp
+  805f44:	48 89 e5             	mov    %rsp,%rbp
+  805f47:	48 83 ec 08          	sub    $0x8,%rsp
+  805f4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  805f4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f53:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805f59:	90                   	nop
+  805f5a:	c9                   	leave
+  805f5b:	c3                   	ret
+
+0000000000805f5c <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805f5c:	55                   	push   %rbp
+  805f5d:	48 89 e5             	mov    %rsp,%rbp
+  805f60:	48 83 ec 20          	sub    $0x20,%rsp
+  805f64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805f68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f6c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805f71:	be 00 00 00 00       	mov    $0x0,%esi
+  805f76:	48 89 c7             	mov    %rax,%rdi
+  805f79:	48 b8 f1 5e 80 00 00 	movabs $0x805ef1,%rax
+  805f80:	00 00 00 
+  805f83:	ff d0                	call   *%rax
+  805f85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f88:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f8c:	74 65                	je     805ff3 <mutex_lock+0x97>
+  if (c != 2)
+  805f8e:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  805f92:	74 57                	je     805feb <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  805f94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f98:	be 02 00 00 00       	mov    $0x2,%esi
+  805f9d:	48 89 c7             	mov    %rax,%rdi
+  805fa0:	48 b8 cc 5e 80 00 00 	movabs $0x805ecc,%rax
+  805fa7:	00 00 00 
+  805faa:	ff d0                	call   *%rax
+  805fac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805faf:	eb 3a                	jmp    805feb <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  805fb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb5:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805fbc:	be 02 00 00 00       	mov    $0x2,%esi
+  805fc1:	48 89 c7             	mov    %rax,%rdi
+  805fc4:	48 b8 1b 24 80 00 00 	movabs $0x80241b,%rax
+  805fcb:	00 00 00 
+  805fce:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  805fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fd4:	be 02 00 00 00       	mov    $0x2,%esi
+  805fd9:	48 89 c7             	mov    %rax,%rdi
+  805fdc:	48 b8 cc 5e 80 00 00 	movabs $0x805ecc,%rax
+  805fe3:	00 00 00 
+  805fe6:	ff d0                	call   *%rax
+  805fe8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805feb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fef:	75 c0                	jne    805fb1 <mutex_lock+0x55>
+  805ff1:	eb 01                	jmp    805ff4 <mutex_lock+0x98>
+    return;
+  805ff3:	90                   	nop
+}
+  805ff4:	c9                   	leave
+  805ff5:	c3                   	ret
+
+0000000000805ff6 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  805ff6:	55                   	push   %rbp
+  805ff7:	48 89 e5             	mov    %rsp,%rbp
+  805ffa:	48 83 ec 08          	sub    $0x8,%rsp
+  805ffe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806002:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806006:	ba 01 00 00 00       	mov    $0x1,%edx
+  80600b:	be 00 00 00 00       	mov    $0x0,%esi
+  806010:	48 89 c7             	mov    %rax,%rdi
+  806013:	48 b8 f1 5e 80 00 00 	movabs $0x805ef1,%rax
+  80601a:	00 00 00 
+  80601d:	ff d0                	call   *%rax
+  80601f:	85 c0                	test   %eax,%eax
+  806021:	75 07                	jne    80602a <mutex_trylock+0x34>
+  806023:	b8 00 00 00 00       	mov    $0x0,%eax
+  806028:	eb 05                	jmp    80602f <mutex_trylock+0x39>
+  80602a:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80602f:	c9                   	leave
+  806030:	c3                   	ret
+
+0000000000806031 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806031:	55                   	push   %rbp
+  806032:	48 89 e5             	mov    %rsp,%rbp
+  806035:	48 83 ec 10          	sub    $0x10,%rsp
+  806039:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80603d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806041:	be 00 00 00 00       	mov    $0x0,%esi
+  806046:	48 89 c7             	mov    %rax,%rdi
+  806049:	48 b8 cc 5e 80 00 00 	movabs $0x805ecc,%rax
+  806050:	00 00 00 
+  806053:	ff d0                	call   *%rax
+  806055:	83 f8 02             	cmp    $0x2,%eax
+  806058:	75 18                	jne    806072 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  80605a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80605e:	be 01 00 00 00       	mov    $0x1,%esi
+  806063:	48 89 c7             	mov    %rax,%rdi
+  806066:	48 b8 6a 24 80 00 00 	movabs $0x80246a,%rax
+  80606d:	00 00 00 
+  806070:	ff d0                	call   *%rax
+}
+  806072:	90                   	nop
+  806073:	c9                   	leave
+  806074:	c3                   	ret
+
+0000000000806075 <cond_init>:
+cond_init(struct Cond *c) {
+  806075:	55                   	push   %rbp
+  806076:	48 89 e5             	mov    %rsp,%rbp
+  806079:	48 83 ec 08          	sub    $0x8,%rsp
+  80607d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806085:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80608b:	90                   	nop
+  80608c:	c9                   	leave
+  80608d:	c3                   	ret
+
+000000000080608e <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80608e:	55                   	push   %rbp
+  80608f:	48 89 e5             	mov    %rsp,%rbp
+  806092:	48 83 ec 30          	sub    $0x30,%rsp
+  806096:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80609a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80609e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8060a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060a6:	8b 00                	mov    (%rax),%eax
+  8060a8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8060ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060af:	48 89 c7             	mov    %rax,%rdi
+  8060b2:	48 b8 31 60 80 00 00 	movabs $0x806031,%rax
+  8060b9:	00 00 00 
+  8060bc:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8060be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8060c6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8060c9:	89 ce                	mov    %ecx,%esi
+  8060cb:	48 89 c7             	mov    %rax,%rdi
+  8060ce:	48 b8 1b 24 80 00 00 	movabs $0x80241b,%rax
+  8060d5:	00 00 00 
+  8060d8:	ff d0                	call   *%rax
+  8060da:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8060dd:	eb 1f                	jmp    8060fe <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8060df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060e3:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8060ea:	be 02 00 00 00       	mov    $0x2,%esi
+  8060ef:	48 89 c7             	mov    %rax,%rdi
+  8060f2:	48 b8 1b 24 80 00 00 	movabs $0x80241b,%rax
+  8060f9:	00 00 00 
+  8060fc:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8060fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806102:	be 02 00 00 00       	mov    $0x2,%esi
+  806107:	48 89 c7             	mov    %rax,%rdi
+  80610a:	48 b8 cc 5e 80 00 00 	movabs $0x805ecc,%rax
+  806111:	00 00 00 
+  806114:	ff d0                	call   *%rax
+  806116:	85 c0                	test   %eax,%eax
+  806118:	75 c5                	jne    8060df <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  80611a:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80611e:	75 07                	jne    806127 <cond_timedwait+0x99>
+  806120:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806125:	eb 05                	jmp    80612c <cond_timedwait+0x9e>
+  806127:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80612c:	c9                   	leave
+  80612d:	c3                   	ret
+
+000000000080612e <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80612e:	55                   	push   %rbp
+  80612f:	48 89 e5             	mov    %rsp,%rbp
+  806132:	48 83 ec 10          	sub    $0x10,%rsp
+  806136:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80613a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80613e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806142:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806146:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80614d:	48 89 ce             	mov    %rcx,%rsi
+  806150:	48 89 c7             	mov    %rax,%rdi
+  806153:	48 b8 8e 60 80 00 00 	movabs $0x80608e,%rax
+  80615a:	00 00 00 
+  80615d:	ff d0                	call   *%rax
+}
+  80615f:	90                   	nop
+  806160:	c9                   	leave
+  806161:	c3                   	ret
+
+0000000000806162 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806162:	55                   	push   %rbp
+  806163:	48 89 e5             	mov    %rsp,%rbp
+  806166:	48 83 ec 10          	sub    $0x10,%rsp
+  80616a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80616e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806172:	be 01 00 00 00       	mov    $0x1,%esi
+  806177:	48 89 c7             	mov    %rax,%rdi
+  80617a:	48 b8 1d 5f 80 00 00 	movabs $0x805f1d,%rax
+  806181:	00 00 00 
+  806184:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806186:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80618a:	be 01 00 00 00       	mov    $0x1,%esi
+  80618f:	48 89 c7             	mov    %rax,%rdi
+  806192:	48 b8 6a 24 80 00 00 	movabs $0x80246a,%rax
+  806199:	00 00 00 
+  80619c:	ff d0                	call   *%rax
+}
+  80619e:	90                   	nop
+  80619f:	c9                   	leave
+  8061a0:	c3                   	ret
+
+00000000008061a1 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8061a1:	55                   	push   %rbp
+  8061a2:	48 89 e5             	mov    %rsp,%rbp
+  8061a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8061a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8061ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8061b6:	48 89 c7             	mov    %rax,%rdi
+  8061b9:	48 b8 1d 5f 80 00 00 	movabs $0x805f1d,%rax
+  8061c0:	00 00 00 
+  8061c3:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8061c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061c9:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8061ce:	48 89 c7             	mov    %rax,%rdi
+  8061d1:	48 b8 6a 24 80 00 00 	movabs $0x80246a,%rax
+  8061d8:	00 00 00 
+  8061db:	ff d0                	call   *%rax
+}
+  8061dd:	90                   	nop
+  8061de:	c9                   	leave
+  8061df:	c3                   	ret
+
+00000000008061e0 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8061e0:	55                   	push   %rbp
+  8061e1:	48 89 e5             	mov    %rsp,%rbp
+  8061e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8061e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8061ec:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8061ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061f3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061f6:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8061f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061fc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806203:	90                   	nop
+  806204:	c9                   	leave
+  806205:	c3                   	ret
+
+0000000000806206 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806206:	55                   	push   %rbp
+  806207:	48 89 e5             	mov    %rsp,%rbp
+  80620a:	48 83 ec 18          	sub    $0x18,%rsp
+  80620e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806212:	eb 2a                	jmp    80623e <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806214:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806217:	8d 50 ff             	lea    -0x1(%rax),%edx
+  80621a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80621e:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806221:	89 ce                	mov    %ecx,%esi
+  806223:	48 89 c7             	mov    %rax,%rdi
+  806226:	48 b8 f1 5e 80 00 00 	movabs $0x805ef1,%rax
+  80622d:	00 00 00 
+  806230:	ff d0                	call   *%rax
+  806232:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806235:	75 07                	jne    80623e <sem_trywait+0x38>
+      return 0;
+  806237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80623c:	eb 14                	jmp    806252 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80623e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806242:	8b 00                	mov    (%rax),%eax
+  806244:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806247:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80624b:	75 c7                	jne    806214 <sem_trywait+0xe>
+  return -E_BUSY;
+  80624d:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806252:	c9                   	leave
+  806253:	c3                   	ret
+
+0000000000806254 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806254:	55                   	push   %rbp
+  806255:	48 89 e5             	mov    %rsp,%rbp
+  806258:	48 83 ec 30          	sub    $0x30,%rsp
+  80625c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806260:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806264:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80626b:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80626c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806271:	0f 84 fb 00 00 00    	je     806372 <sem_timedwait+0x11e>
+  806277:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80627c:	0f 84 f0 00 00 00    	je     806372 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806282:	48 b8 2d 54 80 00 00 	movabs $0x80542d,%rax
+  806289:	00 00 00 
+  80628c:	ff d0                	call   *%rax
+  80628e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806292:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806296:	48 f7 d0             	not    %rax
+  806299:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80629d:	73 0d                	jae    8062ac <sem_timedwait+0x58>
+  80629f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8062a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062a7:	48 01 d0             	add    %rdx,%rax
+  8062aa:	eb 07                	jmp    8062b3 <sem_timedwait+0x5f>
+  8062ac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8062b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8062b7:	e9 b6 00 00 00       	jmp    806372 <sem_timedwait+0x11e>
+    if (deadline) {
+  8062bc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8062c1:	74 2d                	je     8062f0 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8062c3:	48 b8 2d 54 80 00 00 	movabs $0x80542d,%rax
+  8062ca:	00 00 00 
+  8062cd:	ff d0                	call   *%rax
+  8062cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8062d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062d7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8062db:	73 0a                	jae    8062e7 <sem_timedwait+0x93>
+  8062dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062e1:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8062e5:	eb 05                	jmp    8062ec <sem_timedwait+0x98>
+  8062e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062ec:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8062f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062f4:	48 83 c0 04          	add    $0x4,%rax
+  8062f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8062fd:	48 89 c7             	mov    %rax,%rdi
+  806300:	48 b8 1d 5f 80 00 00 	movabs $0x805f1d,%rax
+  806307:	00 00 00 
+  80630a:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  80630c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806310:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806314:	be 00 00 00 00       	mov    $0x0,%esi
+  806319:	48 89 c7             	mov    %rax,%rdi
+  80631c:	48 b8 1b 24 80 00 00 	movabs $0x80241b,%rax
+  806323:	00 00 00 
+  806326:	ff d0                	call   *%rax
+  806328:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80632b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80632f:	48 83 c0 04          	add    $0x4,%rax
+  806333:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806338:	48 89 c7             	mov    %rax,%rdi
+  80633b:	48 b8 1d 5f 80 00 00 	movabs $0x805f1d,%rax
+  806342:	00 00 00 
+  806345:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806347:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80634b:	75 25                	jne    806372 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80634d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806351:	48 89 c7             	mov    %rax,%rdi
+  806354:	48 b8 06 62 80 00 00 	movabs $0x806206,%rax
+  80635b:	00 00 00 
+  80635e:	ff d0                	call   *%rax
+  806360:	85 c0                	test   %eax,%eax
+  806362:	79 07                	jns    80636b <sem_timedwait+0x117>
+  806364:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806369:	eb 27                	jmp    806392 <sem_timedwait+0x13e>
+  80636b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806370:	eb 20                	jmp    806392 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806372:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806376:	48 89 c7             	mov    %rax,%rdi
+  806379:	48 b8 06 62 80 00 00 	movabs $0x806206,%rax
+  806380:	00 00 00 
+  806383:	ff d0                	call   *%rax
+  806385:	85 c0                	test   %eax,%eax
+  806387:	0f 88 2f ff ff ff    	js     8062bc <sem_timedwait+0x68>
+  return 0;
+  80638d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806392:	c9                   	leave
+  806393:	c3                   	ret
+
+0000000000806394 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806394:	55                   	push   %rbp
+  806395:	48 89 e5             	mov    %rsp,%rbp
+  806398:	48 83 ec 10          	sub    $0x10,%rsp
+  80639c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8063a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063a4:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8063ab:	48 89 c7             	mov    %rax,%rdi
+  8063ae:	48 b8 54 62 80 00 00 	movabs $0x806254,%rax
+  8063b5:	00 00 00 
+  8063b8:	ff d0                	call   *%rax
+}
+  8063ba:	90                   	nop
+  8063bb:	c9                   	leave
+  8063bc:	c3                   	ret
+
+00000000008063bd <sem_post>:
+sem_post(struct Semaphore *s) {
+  8063bd:	55                   	push   %rbp
+  8063be:	48 89 e5             	mov    %rsp,%rbp
+  8063c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8063c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8063c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8063d2:	48 89 c7             	mov    %rax,%rdi
+  8063d5:	48 b8 1d 5f 80 00 00 	movabs $0x805f1d,%rax
+  8063dc:	00 00 00 
+  8063df:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8063e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e5:	8b 40 04             	mov    0x4(%rax),%eax
+  8063e8:	85 c0                	test   %eax,%eax
+  8063ea:	74 18                	je     806404 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8063ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8063f5:	48 89 c7             	mov    %rax,%rdi
+  8063f8:	48 b8 6a 24 80 00 00 	movabs $0x80246a,%rax
+  8063ff:	00 00 00 
+  806402:	ff d0                	call   *%rax
+}
+  806404:	90                   	nop
+  806405:	c9                   	leave
+  806406:	c3                   	ret
+  806407:	90                   	nop
@@ -0,0 +1,10108 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 31 01 00 00       	call   80015d <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, j;
+  envid_t parent = sys_getenvid();
+  800041:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  800048:	00 00 00 
+  80004b:	ff d0                	call   *%rax
+  80004d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+
+  // Fork several environments
+  for (i = 0; i < 20; i++)
+  800050:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800057:	eb 14                	jmp    80006d <umain+0x3b>
+    if (fork() == 0)
+  800059:	48 b8 3a 30 80 00 00 	movabs $0x80303a,%rax
+  800060:	00 00 00 
+  800063:	ff d0                	call   *%rax
+  800065:	85 c0                	test   %eax,%eax
+  800067:	74 0c                	je     800075 <umain+0x43>
+  for (i = 0; i < 20; i++)
+  800069:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80006d:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+  800071:	7e e6                	jle    800059 <umain+0x27>
+  800073:	eb 01                	jmp    800076 <umain+0x44>
+      break;
+  800075:	90                   	nop
+  if (i == 20) {
+  800076:	83 7d fc 14          	cmpl   $0x14,-0x4(%rbp)
+  80007a:	75 13                	jne    80008f <umain+0x5d>
+    sys_yield();
+  80007c:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    return;
+  800088:	e9 ce 00 00 00       	jmp    80015b <umain+0x129>
+  }
+
+  // Wait for the parent to finish forking
+  while (envs[ENVX(parent)].env_status != ENV_FREE)
+    asm volatile("pause");
+  80008d:	f3 90                	pause
+  while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80008f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800092:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800097:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80009e:	00 00 00 
+  8000a1:	48 98                	cltq
+  8000a3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8000aa:	48 01 d0             	add    %rdx,%rax
+  8000ad:	48 05 d4 00 00 00    	add    $0xd4,%rax
+  8000b3:	8b 00                	mov    (%rax),%eax
+  8000b5:	85 c0                	test   %eax,%eax
+  8000b7:	75 d4                	jne    80008d <umain+0x5b>
+
+  // Check that one environment doesn't run on two CPUs at once
+  for (i = 0; i < 10; i++) {
+  8000b9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000c0:	eb 41                	jmp    800103 <umain+0xd1>
+    sys_yield();
+  8000c2:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  8000c9:	00 00 00 
+  8000cc:	ff d0                	call   *%rax
+    for (j = 0; j < 10000; j++)
+  8000ce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  8000d5:	eb 1f                	jmp    8000f6 <umain+0xc4>
+      counter++;
+  8000d7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000de:	00 00 00 
+  8000e1:	8b 00                	mov    (%rax),%eax
+  8000e3:	8d 50 01             	lea    0x1(%rax),%edx
+  8000e6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000ed:	00 00 00 
+  8000f0:	89 10                	mov    %edx,(%rax)
+    for (j = 0; j < 10000; j++)
+  8000f2:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  8000f6:	81 7d f8 0f 27 00 00 	cmpl   $0x270f,-0x8(%rbp)
+  8000fd:	7e d8                	jle    8000d7 <umain+0xa5>
+  for (i = 0; i < 10; i++) {
+  8000ff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800103:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+  800107:	7e b9                	jle    8000c2 <umain+0x90>
+  }
+
+  if (counter != 10 * 10000)
+  800109:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800110:	00 00 00 
+  800113:	8b 00                	mov    (%rax),%eax
+  800115:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  80011a:	74 3f                	je     80015b <umain+0x129>
+    panic("ran on two CPUs at once (counter is %d)", counter);
+  80011c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800123:	00 00 00 
+  800126:	8b 00                	mov    (%rax),%eax
+  800128:	89 c1                	mov    %eax,%ecx
+  80012a:	48 b8 20 64 80 00 00 	movabs $0x806420,%rax
+  800131:	00 00 00 
+  800134:	48 89 c2             	mov    %rax,%rdx
+  800137:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80013c:	48 b8 48 64 80 00 00 	movabs $0x806448,%rax
+  800143:	00 00 00 
+  800146:	48 89 c7             	mov    %rax,%rdi
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+
+  // Check that we see environments running on different CPUs
+  //cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  80015b:	c9                   	leave
+  80015c:	c3                   	ret
+
+000000000080015d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80015d:	55                   	push   %rbp
+  80015e:	48 89 e5             	mov    %rsp,%rbp
+  800161:	48 83 ec 20          	sub    $0x20,%rsp
+  800165:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800168:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80016c:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800173:	00 00 00 
+  800176:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80017a:	eb 13                	jmp    80018f <libmain+0x32>
+    (*ctor)();
+  80017c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800180:	48 8b 10             	mov    (%rax),%rdx
+  800183:	b8 00 00 00 00       	mov    $0x0,%eax
+  800188:	ff d2                	call   *%rdx
+    ctor++;
+  80018a:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80018f:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800196:	00 00 00 
+  800199:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80019d:	72 dd                	jb     80017c <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80019f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001a3:	7e 14                	jle    8001b9 <libmain+0x5c>
+    binaryname = argv[0];
+  8001a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001a9:	48 8b 00             	mov    (%rax),%rax
+  8001ac:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8001b3:	00 00 00 
+  8001b6:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001c0:	48 89 d6             	mov    %rdx,%rsi
+  8001c3:	89 c7                	mov    %eax,%edi
+  8001c5:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001d1:	48 b8 e0 01 80 00 00 	movabs $0x8001e0,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+#endif
+}
+  8001dd:	90                   	nop
+  8001de:	c9                   	leave
+  8001df:	c3                   	ret
+
+00000000008001e0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001e0:	55                   	push   %rbp
+  8001e1:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001e4:	48 b8 58 34 80 00 00 	movabs $0x803458,%rax
+  8001eb:	00 00 00 
+  8001ee:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f5:	48 b8 59 20 80 00 00 	movabs $0x802059,%rax
+  8001fc:	00 00 00 
+  8001ff:	ff d0                	call   *%rax
+}
+  800201:	90                   	nop
+  800202:	5d                   	pop    %rbp
+  800203:	c3                   	ret
+
+0000000000800204 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800204:	55                   	push   %rbp
+  800205:	48 89 e5             	mov    %rsp,%rbp
+  800208:	53                   	push   %rbx
+  800209:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800210:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800217:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80021d:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800224:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80022b:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800232:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800239:	84 c0                	test   %al,%al
+  80023b:	74 23                	je     800260 <_panic+0x5c>
+  80023d:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800244:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800248:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80024c:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800250:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800254:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800258:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80025c:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800260:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800267:	00 00 00 
+  80026a:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800271:	00 00 00 
+  800274:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800278:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80027f:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800286:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80028d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800294:	00 00 00 
+  800297:	48 8b 18             	mov    (%rax),%rbx
+  80029a:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  8002a1:	00 00 00 
+  8002a4:	ff d0                	call   *%rax
+  8002a6:	89 c6                	mov    %eax,%esi
+  8002a8:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8002ae:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8002b5:	41 89 d0             	mov    %edx,%r8d
+  8002b8:	48 89 c1             	mov    %rax,%rcx
+  8002bb:	48 89 da             	mov    %rbx,%rdx
+  8002be:	48 b8 68 64 80 00 00 	movabs $0x806468,%rax
+  8002c5:	00 00 00 
+  8002c8:	48 89 c7             	mov    %rax,%rdi
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d0:	49 b9 23 04 80 00 00 	movabs $0x800423,%r9
+  8002d7:	00 00 00 
+  8002da:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8002dd:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8002e4:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8002eb:	48 89 d6             	mov    %rdx,%rsi
+  8002ee:	48 89 c7             	mov    %rax,%rdi
+  8002f1:	48 b8 98 03 80 00 00 	movabs $0x800398,%rax
+  8002f8:	00 00 00 
+  8002fb:	ff d0                	call   *%rax
+  cprintf("\n");
+  8002fd:	48 b8 8b 64 80 00 00 	movabs $0x80648b,%rax
+  800304:	00 00 00 
+  800307:	48 89 c7             	mov    %rax,%rdi
+  80030a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030f:	48 ba 23 04 80 00 00 	movabs $0x800423,%rdx
+  800316:	00 00 00 
+  800319:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80031b:	cc                   	int3
+  80031c:	eb fd                	jmp    80031b <_panic+0x117>
+
+000000000080031e <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80031e:	55                   	push   %rbp
+  80031f:	48 89 e5             	mov    %rsp,%rbp
+  800322:	48 83 ec 10          	sub    $0x10,%rsp
+  800326:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800329:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80032d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800331:	8b 00                	mov    (%rax),%eax
+  800333:	8d 48 01             	lea    0x1(%rax),%ecx
+  800336:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80033a:	89 0a                	mov    %ecx,(%rdx)
+  80033c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80033f:	89 d1                	mov    %edx,%ecx
+  800341:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800345:	48 98                	cltq
+  800347:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80034b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80034f:	8b 00                	mov    (%rax),%eax
+  800351:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800356:	75 2c                	jne    800384 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800358:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80035c:	8b 00                	mov    (%rax),%eax
+  80035e:	48 98                	cltq
+  800360:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800364:	48 83 c2 08          	add    $0x8,%rdx
+  800368:	48 89 c6             	mov    %rax,%rsi
+  80036b:	48 89 d7             	mov    %rdx,%rdi
+  80036e:	48 b8 8a 1f 80 00 00 	movabs $0x801f8a,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+    b->idx = 0;
+  80037a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80037e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800384:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800388:	8b 40 04             	mov    0x4(%rax),%eax
+  80038b:	8d 50 01             	lea    0x1(%rax),%edx
+  80038e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800392:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800395:	90                   	nop
+  800396:	c9                   	leave
+  800397:	c3                   	ret
+
+0000000000800398 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800398:	55                   	push   %rbp
+  800399:	48 89 e5             	mov    %rsp,%rbp
+  80039c:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8003a3:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8003aa:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8003b1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8003b8:	00 00 00 
+  b.cnt = 0;
+  8003bb:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8003c2:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8003c5:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8003cc:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8003d3:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8003da:	48 89 c6             	mov    %rax,%rsi
+  8003dd:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  8003e4:	00 00 00 
+  8003e7:	48 89 c7             	mov    %rax,%rdi
+  8003ea:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  8003f1:	00 00 00 
+  8003f4:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8003f6:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8003fc:	48 98                	cltq
+  8003fe:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800405:	48 83 c2 08          	add    $0x8,%rdx
+  800409:	48 89 c6             	mov    %rax,%rsi
+  80040c:	48 89 d7             	mov    %rdx,%rdi
+  80040f:	48 b8 8a 1f 80 00 00 	movabs $0x801f8a,%rax
+  800416:	00 00 00 
+  800419:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80041b:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+0000000000800423 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800423:	55                   	push   %rbp
+  800424:	48 89 e5             	mov    %rsp,%rbp
+  800427:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80042e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800435:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80043c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800443:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80044a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800451:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800458:	84 c0                	test   %al,%al
+  80045a:	74 20                	je     80047c <cprintf+0x59>
+  80045c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800460:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800464:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800468:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80046c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800470:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800474:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800478:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80047c:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800483:	00 00 00 
+  800486:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80048d:	00 00 00 
+  800490:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800494:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80049b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004a2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8004a9:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8004b0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8004b7:	48 89 d6             	mov    %rdx,%rsi
+  8004ba:	48 89 c7             	mov    %rax,%rdi
+  8004bd:	48 b8 98 03 80 00 00 	movabs $0x800398,%rax
+  8004c4:	00 00 00 
+  8004c7:	ff d0                	call   *%rax
+  8004c9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8004cf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+00000000008004d7 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8004d7:	55                   	push   %rbp
+  8004d8:	48 89 e5             	mov    %rsp,%rbp
+  8004db:	48 83 ec 30          	sub    $0x30,%rsp
+  8004df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8004e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8004e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8004eb:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8004ee:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8004f2:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8004f6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004f9:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8004fd:	72 54                	jb     800553 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004ff:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800502:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800505:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800508:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80050c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800511:	48 f7 f6             	div    %rsi
+  800514:	49 89 c2             	mov    %rax,%r10
+  800517:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80051a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80051d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800521:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800525:	41 89 c9             	mov    %ecx,%r9d
+  800528:	41 89 f8             	mov    %edi,%r8d
+  80052b:	89 d1                	mov    %edx,%ecx
+  80052d:	4c 89 d2             	mov    %r10,%rdx
+  800530:	48 89 c7             	mov    %rax,%rdi
+  800533:	48 b8 d7 04 80 00 00 	movabs $0x8004d7,%rax
+  80053a:	00 00 00 
+  80053d:	ff d0                	call   *%rax
+  80053f:	eb 1c                	jmp    80055d <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800541:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800545:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800548:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80054c:	48 89 d6             	mov    %rdx,%rsi
+  80054f:	89 c7                	mov    %eax,%edi
+  800551:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800553:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800557:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80055b:	7f e4                	jg     800541 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80055d:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800560:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800564:	ba 00 00 00 00       	mov    $0x0,%edx
+  800569:	48 f7 f1             	div    %rcx
+  80056c:	48 b8 d0 66 80 00 00 	movabs $0x8066d0,%rax
+  800573:	00 00 00 
+  800576:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80057a:	0f be c0             	movsbl %al,%eax
+  80057d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800581:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800585:	48 89 d6             	mov    %rdx,%rsi
+  800588:	89 c7                	mov    %eax,%edi
+  80058a:	ff d1                	call   *%rcx
+}
+  80058c:	90                   	nop
+  80058d:	c9                   	leave
+  80058e:	c3                   	ret
+
+000000000080058f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80058f:	55                   	push   %rbp
+  800590:	48 89 e5             	mov    %rsp,%rbp
+  800593:	48 83 ec 10          	sub    $0x10,%rsp
+  800597:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80059b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80059e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8005a2:	7e 4b                	jle    8005ef <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8005a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a8:	8b 00                	mov    (%rax),%eax
+  8005aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ad:	77 24                	ja     8005d3 <getuint+0x44>
+  8005af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005bb:	8b 00                	mov    (%rax),%eax
+  8005bd:	89 c0                	mov    %eax,%eax
+  8005bf:	48 01 d0             	add    %rdx,%rax
+  8005c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005c6:	8b 12                	mov    (%rdx),%edx
+  8005c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005cf:	89 0a                	mov    %ecx,(%rdx)
+  8005d1:	eb 14                	jmp    8005e7 <getuint+0x58>
+  8005d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005e7:	48 8b 00             	mov    (%rax),%rax
+  8005ea:	e9 95 00 00 00       	jmp    800684 <getuint+0xf5>
+  else if (lflag)
+  8005ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005f3:	74 48                	je     80063d <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8005f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005f9:	8b 00                	mov    (%rax),%eax
+  8005fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fe:	77 24                	ja     800624 <getuint+0x95>
+  800600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800604:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060c:	8b 00                	mov    (%rax),%eax
+  80060e:	89 c0                	mov    %eax,%eax
+  800610:	48 01 d0             	add    %rdx,%rax
+  800613:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800617:	8b 12                	mov    (%rdx),%edx
+  800619:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80061c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800620:	89 0a                	mov    %ecx,(%rdx)
+  800622:	eb 14                	jmp    800638 <getuint+0xa9>
+  800624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800628:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80062c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800630:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800634:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800638:	48 8b 00             	mov    (%rax),%rax
+  80063b:	eb 47                	jmp    800684 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80063d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800641:	8b 00                	mov    (%rax),%eax
+  800643:	83 f8 2f             	cmp    $0x2f,%eax
+  800646:	77 24                	ja     80066c <getuint+0xdd>
+  800648:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80064c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800654:	8b 00                	mov    (%rax),%eax
+  800656:	89 c0                	mov    %eax,%eax
+  800658:	48 01 d0             	add    %rdx,%rax
+  80065b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80065f:	8b 12                	mov    (%rdx),%edx
+  800661:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800664:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800668:	89 0a                	mov    %ecx,(%rdx)
+  80066a:	eb 14                	jmp    800680 <getuint+0xf1>
+  80066c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800670:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800674:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800678:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80067c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800680:	8b 00                	mov    (%rax),%eax
+  800682:	89 c0                	mov    %eax,%eax
+}
+  800684:	c9                   	leave
+  800685:	c3                   	ret
+
+0000000000800686 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800686:	55                   	push   %rbp
+  800687:	48 89 e5             	mov    %rsp,%rbp
+  80068a:	48 83 ec 10          	sub    $0x10,%rsp
+  80068e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800692:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800695:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800699:	7e 4b                	jle    8006e6 <getint+0x60>
+    return va_arg(*ap, long long);
+  80069b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80069f:	8b 00                	mov    (%rax),%eax
+  8006a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a4:	77 24                	ja     8006ca <getint+0x44>
+  8006a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006b2:	8b 00                	mov    (%rax),%eax
+  8006b4:	89 c0                	mov    %eax,%eax
+  8006b6:	48 01 d0             	add    %rdx,%rax
+  8006b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006bd:	8b 12                	mov    (%rdx),%edx
+  8006bf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006c6:	89 0a                	mov    %ecx,(%rdx)
+  8006c8:	eb 14                	jmp    8006de <getint+0x58>
+  8006ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006d2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006da:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006de:	48 8b 00             	mov    (%rax),%rax
+  8006e1:	e9 95 00 00 00       	jmp    80077b <getint+0xf5>
+  else if (lflag)
+  8006e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8006ea:	74 48                	je     800734 <getint+0xae>
+    return va_arg(*ap, long);
+  8006ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f0:	8b 00                	mov    (%rax),%eax
+  8006f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f5:	77 24                	ja     80071b <getint+0x95>
+  8006f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800703:	8b 00                	mov    (%rax),%eax
+  800705:	89 c0                	mov    %eax,%eax
+  800707:	48 01 d0             	add    %rdx,%rax
+  80070a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80070e:	8b 12                	mov    (%rdx),%edx
+  800710:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800713:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800717:	89 0a                	mov    %ecx,(%rdx)
+  800719:	eb 14                	jmp    80072f <getint+0xa9>
+  80071b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80071f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800723:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800727:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80072b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80072f:	48 8b 00             	mov    (%rax),%rax
+  800732:	eb 47                	jmp    80077b <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800738:	8b 00                	mov    (%rax),%eax
+  80073a:	83 f8 2f             	cmp    $0x2f,%eax
+  80073d:	77 24                	ja     800763 <getint+0xdd>
+  80073f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800743:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074b:	8b 00                	mov    (%rax),%eax
+  80074d:	89 c0                	mov    %eax,%eax
+  80074f:	48 01 d0             	add    %rdx,%rax
+  800752:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800756:	8b 12                	mov    (%rdx),%edx
+  800758:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80075b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80075f:	89 0a                	mov    %ecx,(%rdx)
+  800761:	eb 14                	jmp    800777 <getint+0xf1>
+  800763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800767:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80076b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80076f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800773:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800777:	8b 00                	mov    (%rax),%eax
+  800779:	48 98                	cltq
+}
+  80077b:	c9                   	leave
+  80077c:	c3                   	ret
+
+000000000080077d <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80077d:	55                   	push   %rbp
+  80077e:	48 89 e5             	mov    %rsp,%rbp
+  800781:	41 54                	push   %r12
+  800783:	53                   	push   %rbx
+  800784:	48 83 ec 60          	sub    $0x60,%rsp
+  800788:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80078c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800790:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800794:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800798:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80079c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8007a0:	48 8b 06             	mov    (%rsi),%rax
+  8007a3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007a7:	48 89 01             	mov    %rax,(%rcx)
+  8007aa:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007ae:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007b2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007b6:	eb 17                	jmp    8007cf <vprintfmt+0x52>
+      if (ch == '\0')
+  8007b8:	85 db                	test   %ebx,%ebx
+  8007ba:	0f 84 bf 04 00 00    	je     800c7f <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8007c0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007c4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8007c8:	48 89 c6             	mov    %rax,%rsi
+  8007cb:	89 df                	mov    %ebx,%edi
+  8007cd:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8007cf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8007d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007d7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007db:	0f b6 00             	movzbl (%rax),%eax
+  8007de:	0f b6 d8             	movzbl %al,%ebx
+  8007e1:	83 fb 25             	cmp    $0x25,%ebx
+  8007e4:	75 d2                	jne    8007b8 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8007e6:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8007ea:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8007f1:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8007f8:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8007ff:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800806:	eb 04                	jmp    80080c <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800808:	90                   	nop
+  800809:	eb 01                	jmp    80080c <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80080b:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80080c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800810:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800814:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800818:	0f b6 00             	movzbl (%rax),%eax
+  80081b:	0f b6 d8             	movzbl %al,%ebx
+  80081e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800821:	83 f8 55             	cmp    $0x55,%eax
+  800824:	0f 87 22 04 00 00    	ja     800c4c <vprintfmt+0x4cf>
+  80082a:	89 c0                	mov    %eax,%eax
+  80082c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800833:	00 
+  800834:	48 b8 f8 66 80 00 00 	movabs $0x8066f8,%rax
+  80083b:	00 00 00 
+  80083e:	48 01 d0             	add    %rdx,%rax
+  800841:	48 8b 00             	mov    (%rax),%rax
+  800844:	ff e0                	jmp    *%rax
+        padc = '-';
+  800846:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80084a:	eb c0                	jmp    80080c <vprintfmt+0x8f>
+        padc = '0';
+  80084c:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800850:	eb ba                	jmp    80080c <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800852:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800859:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80085c:	89 d0                	mov    %edx,%eax
+  80085e:	c1 e0 02             	shl    $0x2,%eax
+  800861:	01 d0                	add    %edx,%eax
+  800863:	01 c0                	add    %eax,%eax
+  800865:	01 d8                	add    %ebx,%eax
+  800867:	83 e8 30             	sub    $0x30,%eax
+  80086a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80086d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800871:	0f b6 00             	movzbl (%rax),%eax
+  800874:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800877:	83 fb 2f             	cmp    $0x2f,%ebx
+  80087a:	7e 60                	jle    8008dc <vprintfmt+0x15f>
+  80087c:	83 fb 39             	cmp    $0x39,%ebx
+  80087f:	7f 5b                	jg     8008dc <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800881:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800886:	eb d1                	jmp    800859 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800888:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088b:	83 f8 2f             	cmp    $0x2f,%eax
+  80088e:	77 17                	ja     8008a7 <vprintfmt+0x12a>
+  800890:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800894:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800897:	89 d2                	mov    %edx,%edx
+  800899:	48 01 d0             	add    %rdx,%rax
+  80089c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80089f:	83 c2 08             	add    $0x8,%edx
+  8008a2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008a5:	eb 0c                	jmp    8008b3 <vprintfmt+0x136>
+  8008a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008ab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008af:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008b3:	8b 00                	mov    (%rax),%eax
+  8008b5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8008b8:	eb 23                	jmp    8008dd <vprintfmt+0x160>
+        if (width < 0)
+  8008ba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008be:	0f 89 44 ff ff ff    	jns    800808 <vprintfmt+0x8b>
+          width = 0;
+  8008c4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8008cb:	e9 38 ff ff ff       	jmp    800808 <vprintfmt+0x8b>
+        altflag = 1;
+  8008d0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8008d7:	e9 30 ff ff ff       	jmp    80080c <vprintfmt+0x8f>
+        goto process_precision;
+  8008dc:	90                   	nop
+        if (width < 0)
+  8008dd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8008e1:	0f 89 24 ff ff ff    	jns    80080b <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8008e7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8008ea:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8008ed:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8008f4:	e9 12 ff ff ff       	jmp    80080b <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8008f9:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8008fd:	e9 0a ff ff ff       	jmp    80080c <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800902:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800905:	83 f8 2f             	cmp    $0x2f,%eax
+  800908:	77 17                	ja     800921 <vprintfmt+0x1a4>
+  80090a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80090e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800911:	89 d2                	mov    %edx,%edx
+  800913:	48 01 d0             	add    %rdx,%rax
+  800916:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800919:	83 c2 08             	add    $0x8,%edx
+  80091c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80091f:	eb 0c                	jmp    80092d <vprintfmt+0x1b0>
+  800921:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800925:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800929:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80092d:	8b 00                	mov    (%rax),%eax
+  80092f:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800933:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800937:	48 89 d6             	mov    %rdx,%rsi
+  80093a:	89 c7                	mov    %eax,%edi
+  80093c:	ff d1                	call   *%rcx
+        break;
+  80093e:	e9 37 03 00 00       	jmp    800c7a <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800943:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800946:	83 f8 2f             	cmp    $0x2f,%eax
+  800949:	77 17                	ja     800962 <vprintfmt+0x1e5>
+  80094b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80094f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800952:	89 d2                	mov    %edx,%edx
+  800954:	48 01 d0             	add    %rdx,%rax
+  800957:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80095a:	83 c2 08             	add    $0x8,%edx
+  80095d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800960:	eb 0c                	jmp    80096e <vprintfmt+0x1f1>
+  800962:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800966:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80096a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80096e:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800970:	85 db                	test   %ebx,%ebx
+  800972:	79 02                	jns    800976 <vprintfmt+0x1f9>
+          err = -err;
+  800974:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800976:	83 fb 15             	cmp    $0x15,%ebx
+  800979:	7f 16                	jg     800991 <vprintfmt+0x214>
+  80097b:	48 ba 20 66 80 00 00 	movabs $0x806620,%rdx
+  800982:	00 00 00 
+  800985:	48 63 c3             	movslq %ebx,%rax
+  800988:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80098c:	4d 85 e4             	test   %r12,%r12
+  80098f:	75 2e                	jne    8009bf <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800991:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800995:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800999:	89 d9                	mov    %ebx,%ecx
+  80099b:	48 ba e1 66 80 00 00 	movabs $0x8066e1,%rdx
+  8009a2:	00 00 00 
+  8009a5:	48 89 c7             	mov    %rax,%rdi
+  8009a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ad:	49 b8 89 0c 80 00 00 	movabs $0x800c89,%r8
+  8009b4:	00 00 00 
+  8009b7:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8009ba:	e9 bb 02 00 00       	jmp    800c7a <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8009bf:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009c7:	4c 89 e1             	mov    %r12,%rcx
+  8009ca:	48 ba ea 66 80 00 00 	movabs $0x8066ea,%rdx
+  8009d1:	00 00 00 
+  8009d4:	48 89 c7             	mov    %rax,%rdi
+  8009d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009dc:	49 b8 89 0c 80 00 00 	movabs $0x800c89,%r8
+  8009e3:	00 00 00 
+  8009e6:	41 ff d0             	call   *%r8
+        break;
+  8009e9:	e9 8c 02 00 00       	jmp    800c7a <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8009ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 17                	ja     800a0d <vprintfmt+0x290>
+  8009f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009fa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009fd:	89 d2                	mov    %edx,%edx
+  8009ff:	48 01 d0             	add    %rdx,%rax
+  800a02:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a05:	83 c2 08             	add    $0x8,%edx
+  800a08:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a0b:	eb 0c                	jmp    800a19 <vprintfmt+0x29c>
+  800a0d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a11:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a15:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a19:	4c 8b 20             	mov    (%rax),%r12
+  800a1c:	4d 85 e4             	test   %r12,%r12
+  800a1f:	75 0a                	jne    800a2b <vprintfmt+0x2ae>
+          p = "(null)";
+  800a21:	49 bc ed 66 80 00 00 	movabs $0x8066ed,%r12
+  800a28:	00 00 00 
+        if (width > 0 && padc != '-')
+  800a2b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a2f:	7e 78                	jle    800aa9 <vprintfmt+0x32c>
+  800a31:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a35:	74 72                	je     800aa9 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a37:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a3a:	48 98                	cltq
+  800a3c:	48 89 c6             	mov    %rax,%rsi
+  800a3f:	4c 89 e7             	mov    %r12,%rdi
+  800a42:	48 b8 95 13 80 00 00 	movabs $0x801395,%rax
+  800a49:	00 00 00 
+  800a4c:	ff d0                	call   *%rax
+  800a4e:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800a51:	eb 17                	jmp    800a6a <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800a53:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800a57:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a5b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a5f:	48 89 d6             	mov    %rdx,%rsi
+  800a62:	89 c7                	mov    %eax,%edi
+  800a64:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a66:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800a6a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a6e:	7f e3                	jg     800a53 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a70:	eb 37                	jmp    800aa9 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800a72:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800a76:	74 1e                	je     800a96 <vprintfmt+0x319>
+  800a78:	83 fb 1f             	cmp    $0x1f,%ebx
+  800a7b:	7e 05                	jle    800a82 <vprintfmt+0x305>
+  800a7d:	83 fb 7e             	cmp    $0x7e,%ebx
+  800a80:	7e 14                	jle    800a96 <vprintfmt+0x319>
+            putch('?', putdat);
+  800a82:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a86:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a8a:	48 89 c6             	mov    %rax,%rsi
+  800a8d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a92:	ff d2                	call   *%rdx
+  800a94:	eb 0f                	jmp    800aa5 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800a96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a9a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a9e:	48 89 c6             	mov    %rax,%rsi
+  800aa1:	89 df                	mov    %ebx,%edi
+  800aa3:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800aa5:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800aa9:	4c 89 e0             	mov    %r12,%rax
+  800aac:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800ab0:	0f b6 00             	movzbl (%rax),%eax
+  800ab3:	0f be d8             	movsbl %al,%ebx
+  800ab6:	85 db                	test   %ebx,%ebx
+  800ab8:	74 28                	je     800ae2 <vprintfmt+0x365>
+  800aba:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800abe:	78 b2                	js     800a72 <vprintfmt+0x2f5>
+  800ac0:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800ac4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ac8:	79 a8                	jns    800a72 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800aca:	eb 16                	jmp    800ae2 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800acc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ad0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ad4:	48 89 c6             	mov    %rax,%rsi
+  800ad7:	bf 20 00 00 00       	mov    $0x20,%edi
+  800adc:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ade:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ae2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ae6:	7f e4                	jg     800acc <vprintfmt+0x34f>
+        break;
+  800ae8:	e9 8d 01 00 00       	jmp    800c7a <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800aed:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800af0:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800af4:	89 d6                	mov    %edx,%esi
+  800af6:	48 89 c7             	mov    %rax,%rdi
+  800af9:	48 b8 86 06 80 00 00 	movabs $0x800686,%rax
+  800b00:	00 00 00 
+  800b03:	ff d0                	call   *%rax
+  800b05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800b09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b0d:	48 85 c0             	test   %rax,%rax
+  800b10:	79 1d                	jns    800b2f <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800b12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b16:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b1a:	48 89 c6             	mov    %rax,%rsi
+  800b1d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b22:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b28:	48 f7 d8             	neg    %rax
+  800b2b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800b2f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b36:	e9 d2 00 00 00       	jmp    800c0d <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b3b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b3e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b42:	89 d6                	mov    %edx,%esi
+  800b44:	48 89 c7             	mov    %rax,%rdi
+  800b47:	48 b8 8f 05 80 00 00 	movabs $0x80058f,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+  800b53:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800b57:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b5e:	e9 aa 00 00 00       	jmp    800c0d <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800b63:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b66:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b6a:	89 d6                	mov    %edx,%esi
+  800b6c:	48 89 c7             	mov    %rax,%rdi
+  800b6f:	48 b8 8f 05 80 00 00 	movabs $0x80058f,%rax
+  800b76:	00 00 00 
+  800b79:	ff d0                	call   *%rax
+  800b7b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800b7f:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800b86:	e9 82 00 00 00       	jmp    800c0d <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800b8b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b8f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b93:	48 89 c6             	mov    %rax,%rsi
+  800b96:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b9b:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800b9d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ba1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ba5:	48 89 c6             	mov    %rax,%rsi
+  800ba8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bad:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800baf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb5:	77 17                	ja     800bce <vprintfmt+0x451>
+  800bb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bbb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bbe:	89 d2                	mov    %edx,%edx
+  800bc0:	48 01 d0             	add    %rdx,%rax
+  800bc3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bc6:	83 c2 08             	add    $0x8,%edx
+  800bc9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bcc:	eb 0c                	jmp    800bda <vprintfmt+0x45d>
+  800bce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bd2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bd6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bda:	48 8b 00             	mov    (%rax),%rax
+  800bdd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800be1:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800be8:	eb 23                	jmp    800c0d <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800bea:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bed:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bf1:	89 d6                	mov    %edx,%esi
+  800bf3:	48 89 c7             	mov    %rax,%rdi
+  800bf6:	48 b8 8f 05 80 00 00 	movabs $0x80058f,%rax
+  800bfd:	00 00 00 
+  800c00:	ff d0                	call   *%rax
+  800c02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c06:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800c0d:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c12:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c15:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c1c:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c20:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c24:	45 89 c1             	mov    %r8d,%r9d
+  800c27:	41 89 f8             	mov    %edi,%r8d
+  800c2a:	48 89 c7             	mov    %rax,%rdi
+  800c2d:	48 b8 d7 04 80 00 00 	movabs $0x8004d7,%rax
+  800c34:	00 00 00 
+  800c37:	ff d0                	call   *%rax
+        break;
+  800c39:	eb 3f                	jmp    800c7a <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c3f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c43:	48 89 c6             	mov    %rax,%rsi
+  800c46:	89 df                	mov    %ebx,%edi
+  800c48:	ff d2                	call   *%rdx
+        break;
+  800c4a:	eb 2e                	jmp    800c7a <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800c4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c50:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c54:	48 89 c6             	mov    %rax,%rsi
+  800c57:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c5c:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800c5e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c63:	eb 05                	jmp    800c6a <vprintfmt+0x4ed>
+  800c65:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800c6a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c6e:	48 83 e8 01          	sub    $0x1,%rax
+  800c72:	0f b6 00             	movzbl (%rax),%eax
+  800c75:	3c 25                	cmp    $0x25,%al
+  800c77:	75 ec                	jne    800c65 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800c79:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c7a:	e9 50 fb ff ff       	jmp    8007cf <vprintfmt+0x52>
+        return;
+  800c7f:	90                   	nop
+    }
+  }
+}
+  800c80:	48 83 c4 60          	add    $0x60,%rsp
+  800c84:	5b                   	pop    %rbx
+  800c85:	41 5c                	pop    %r12
+  800c87:	5d                   	pop    %rbp
+  800c88:	c3                   	ret
+
+0000000000800c89 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800c89:	55                   	push   %rbp
+  800c8a:	48 89 e5             	mov    %rsp,%rbp
+  800c8d:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800c94:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c9b:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800ca2:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ca9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800cb0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800cb7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800cbe:	84 c0                	test   %al,%al
+  800cc0:	74 20                	je     800ce2 <printfmt+0x59>
+  800cc2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800cc6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800cca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800cce:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800cd2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800cd6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800cda:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800cde:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ce2:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ce9:	00 00 00 
+  800cec:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800cf3:	00 00 00 
+  800cf6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cfa:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d01:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d08:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800d0f:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d16:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d1d:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d24:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d2b:	48 89 c7             	mov    %rax,%rdi
+  800d2e:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800d35:	00 00 00 
+  800d38:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d3a:	90                   	nop
+  800d3b:	c9                   	leave
+  800d3c:	c3                   	ret
+
+0000000000800d3d <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d3d:	55                   	push   %rbp
+  800d3e:	48 89 e5             	mov    %rsp,%rbp
+  800d41:	48 83 ec 10          	sub    $0x10,%rsp
+  800d45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800d4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d50:	8b 40 10             	mov    0x10(%rax),%eax
+  800d53:	8d 50 01             	lea    0x1(%rax),%edx
+  800d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d5a:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800d5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d61:	48 8b 10             	mov    (%rax),%rdx
+  800d64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d68:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d6c:	48 39 c2             	cmp    %rax,%rdx
+  800d6f:	73 17                	jae    800d88 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800d71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d75:	48 8b 00             	mov    (%rax),%rax
+  800d78:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800d7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d80:	48 89 0a             	mov    %rcx,(%rdx)
+  800d83:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800d86:	88 10                	mov    %dl,(%rax)
+}
+  800d88:	90                   	nop
+  800d89:	c9                   	leave
+  800d8a:	c3                   	ret
+
+0000000000800d8b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800d8b:	55                   	push   %rbp
+  800d8c:	48 89 e5             	mov    %rsp,%rbp
+  800d8f:	48 83 ec 40          	sub    $0x40,%rsp
+  800d93:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800d97:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800d9a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d9e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800da2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800da6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800daa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800dad:	48 98                	cltq
+  800daf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800db3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800db7:	48 01 d0             	add    %rdx,%rax
+  800dba:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800dbe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800dc5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800dca:	74 06                	je     800dd2 <vsnprintf+0x47>
+  800dcc:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800dd0:	7f 07                	jg     800dd9 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800dd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dd7:	eb 32                	jmp    800e0b <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800dd9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800ddd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800de1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800de5:	48 89 c6             	mov    %rax,%rsi
+  800de8:	48 b8 3d 0d 80 00 00 	movabs $0x800d3d,%rax
+  800def:	00 00 00 
+  800df2:	48 89 c7             	mov    %rax,%rdi
+  800df5:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800dfc:	00 00 00 
+  800dff:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800e01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e05:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800e08:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800e0b:	c9                   	leave
+  800e0c:	c3                   	ret
+
+0000000000800e0d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800e0d:	55                   	push   %rbp
+  800e0e:	48 89 e5             	mov    %rsp,%rbp
+  800e11:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e18:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e1f:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800e25:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e2c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e33:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e3a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e41:	84 c0                	test   %al,%al
+  800e43:	74 20                	je     800e65 <snprintf+0x58>
+  800e45:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e49:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e4d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e51:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e55:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e59:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e5d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e61:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800e65:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800e6c:	00 00 00 
+  800e6f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800e76:	00 00 00 
+  800e79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e7d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800e84:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e8b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800e92:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800e99:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ea0:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ea6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ead:	48 89 c7             	mov    %rax,%rdi
+  800eb0:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  800eb7:	00 00 00 
+  800eba:	ff d0                	call   *%rax
+  800ebc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800ec2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ec8:	c9                   	leave
+  800ec9:	c3                   	ret
+
+0000000000800eca <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800eca:	55                   	push   %rbp
+  800ecb:	48 89 e5             	mov    %rsp,%rbp
+  800ece:	53                   	push   %rbx
+  800ecf:	48 83 ec 38          	sub    $0x38,%rsp
+  800ed3:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800ed6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800eda:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800ede:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ee2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800ee6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eee:	89 d1                	mov    %edx,%ecx
+  800ef0:	0f a2                	cpuid
+  800ef2:	89 de                	mov    %ebx,%esi
+  800ef4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800ef7:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800efa:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800efd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800f00:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f05:	74 09                	je     800f10 <cpuid+0x46>
+}
+  800f07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f0b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f0e:	89 10                	mov    %edx,(%rax)
+
+  800f10:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f15:	74 09                	je     800f20 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800f17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f1b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f1e:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800f20:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f25:	74 09                	je     800f30 <cpuid+0x66>
+char *
+  800f27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f2b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f2e:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800f30:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f35:	74 09                	je     800f40 <cpuid+0x76>
+  for (; *s; s++)
+  800f37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f3b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f3e:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f40:	90                   	nop
+  800f41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+0000000000800f47 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800f47:	55                   	push   %rbp
+  800f48:	48 89 e5             	mov    %rsp,%rbp
+  800f4b:	48 83 ec 18          	sub    $0x18,%rsp
+  800f4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800f52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800f55:	89 c1                	mov    %eax,%ecx
+  800f57:	0f 01 d0             	xgetbv
+  800f5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800f5d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800f60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f63:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800f66:	48 c1 e2 20          	shl    $0x20,%rdx
+  800f6a:	48 09 d0             	or     %rdx,%rax
+#else
+  800f6d:	c9                   	leave
+  800f6e:	c3                   	ret
+
+0000000000800f6f <string_cpu>:
+string_cpu(void) {
+  800f6f:	55                   	push   %rbp
+  800f70:	48 89 e5             	mov    %rsp,%rbp
+  800f73:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800f77:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800f7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800f85:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f8c:	00 00 00 
+  800f8f:	8b 00                	mov    (%rax),%eax
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	78 11                	js     800fa6 <string_cpu+0x37>
+    return string_features;
+  800f95:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f9c:	00 00 00 
+  800f9f:	8b 00                	mov    (%rax),%eax
+  800fa1:	e9 df 00 00 00       	jmp    801085 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800fa6:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800faa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fba:	48 89 c6             	mov    %rax,%rsi
+  800fbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fc2:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  800fc9:	00 00 00 
+  800fcc:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800fce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800fd1:	83 f8 06             	cmp    $0x6,%eax
+  800fd4:	76 28                	jbe    800ffe <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800fd6:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800fda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe5:	48 89 c2             	mov    %rax,%rdx
+  800fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fed:	bf 07 00 00 00       	mov    $0x7,%edi
+  800ff2:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  800ff9:	00 00 00 
+  800ffc:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800ffe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801001:	25 00 02 00 00       	and    $0x200,%eax
+  801006:	85 c0                	test   %eax,%eax
+  801008:	74 04                	je     80100e <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80100a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80100e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801012:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801018:	48 89 c1             	mov    %rax,%rcx
+  80101b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	bf 01 00 00 00       	mov    $0x1,%edi
+  80102a:	48 b8 ca 0e 80 00 00 	movabs $0x800eca,%rax
+  801031:	00 00 00 
+  801034:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801036:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801039:	83 e0 20             	and    $0x20,%eax
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	74 2a                	je     80106a <string_cpu+0xfb>
+  801040:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801043:	25 00 00 00 08       	and    $0x8000000,%eax
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	74 1e                	je     80106a <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80104c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801051:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  801058:	00 00 00 
+  80105b:	ff d0                	call   *%rax
+  80105d:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801060:	48 83 f8 06          	cmp    $0x6,%rax
+  801064:	75 04                	jne    80106a <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801066:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80106a:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801071:	00 00 00 
+  801074:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801077:	89 02                	mov    %eax,(%rdx)
+  801079:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801080:	00 00 00 
+  801083:	8b 00                	mov    (%rax),%eax
+}
+  801085:	c9                   	leave
+  801086:	c3                   	ret
+
+0000000000801087 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801087:	55                   	push   %rbp
+  801088:	48 89 e5             	mov    %rsp,%rbp
+  80108b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80108f:	48 83 ec 60          	sub    $0x60,%rsp
+  801093:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801098:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80109d:	83 e0 1f             	and    $0x1f,%eax
+  8010a0:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8010a4:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010a8:	48 f7 d8             	neg    %rax
+  8010ab:	48 89 c2             	mov    %rax,%rdx
+  8010ae:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010b3:	48 01 d0             	add    %rdx,%rax
+  8010b6:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8010bb:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8010bf:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8010c5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8010ca:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8010ce:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8010d4:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8010d8:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8010dc:	89 c2                	mov    %eax,%edx
+  8010de:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010e2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8010e7:	89 c1                	mov    %eax,%ecx
+  8010e9:	d3 e6                	shl    %cl,%esi
+  8010eb:	89 f0                	mov    %esi,%eax
+  8010ed:	21 d0                	and    %edx,%eax
+  8010ef:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8010f3:	eb 21                	jmp    801116 <strlen_avx2+0x8f>
+    p += 32;
+  8010f5:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8010fb:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801100:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801104:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80110a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80110e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801112:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801116:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80111b:	74 d8                	je     8010f5 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80111d:	31 c0                	xor    %eax,%eax
+  80111f:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801125:	48 63 d0             	movslq %eax,%rdx
+  801128:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80112d:	48 01 d0             	add    %rdx,%rax
+  801130:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+
+0000000000801137 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80113f:	48 83 ec 40          	sub    $0x40,%rsp
+  801143:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801148:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80114d:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801152:	eb 77                	jmp    8011cb <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801154:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801159:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80115d:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801161:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801166:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80116a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80116e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801172:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801176:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80117b:	74 3c                	je     8011b9 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80117d:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801181:	f7 d0                	not    %eax
+  801183:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801187:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80118b:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80118f:	48 63 d0             	movslq %eax,%rdx
+  801192:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801197:	48 01 d0             	add    %rdx,%rax
+  80119a:	0f b6 00             	movzbl (%rax),%eax
+  80119d:	0f b6 c0             	movzbl %al,%eax
+  8011a0:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8011a4:	48 63 ca             	movslq %edx,%rcx
+  8011a7:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8011ac:	48 01 ca             	add    %rcx,%rdx
+  8011af:	0f b6 12             	movzbl (%rdx),%edx
+  8011b2:	0f b6 d2             	movzbl %dl,%edx
+  8011b5:	29 d0                	sub    %edx,%eax
+  8011b7:	eb 6b                	jmp    801224 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8011b9:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8011bf:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8011c5:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8011cb:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8011d1:	77 81                	ja     801154 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8011d3:	eb 42                	jmp    801217 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8011d5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011da:	0f b6 10             	movzbl (%rax),%edx
+  8011dd:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011e2:	0f b6 00             	movzbl (%rax),%eax
+  8011e5:	38 c2                	cmp    %al,%dl
+  8011e7:	74 1c                	je     801205 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8011e9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011ee:	0f b6 00             	movzbl (%rax),%eax
+  8011f1:	0f b6 c8             	movzbl %al,%ecx
+  8011f4:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011f9:	0f b6 00             	movzbl (%rax),%eax
+  8011fc:	0f b6 d0             	movzbl %al,%edx
+  8011ff:	89 c8                	mov    %ecx,%eax
+  801201:	29 d0                	sub    %edx,%eax
+  801203:	eb 1f                	jmp    801224 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801205:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80120b:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801211:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801217:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80121d:	75 b6                	jne    8011d5 <memcmp_avx2+0x9e>
+  return 0;
+  80121f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+0000000000801226 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+  80122a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80122e:	48 83 ec 60          	sub    $0x60,%rsp
+  801232:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801237:	89 f0                	mov    %esi,%eax
+  801239:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80123e:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801242:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801247:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80124b:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801250:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801256:	eb 47                	jmp    80129f <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801258:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80125d:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801261:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801265:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80126b:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80126f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801273:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801277:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80127c:	74 15                	je     801293 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80127e:	31 c0                	xor    %eax,%eax
+  801280:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801286:	48 63 d0             	movslq %eax,%rdx
+  801289:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80128e:	48 01 d0             	add    %rdx,%rax
+  801291:	eb 3d                	jmp    8012d0 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801293:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801299:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80129f:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8012a5:	77 b1                	ja     801258 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8012a7:	eb 0c                	jmp    8012b5 <memfind_avx2+0x8f>
+  8012a9:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8012af:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8012b5:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8012bb:	74 0e                	je     8012cb <memfind_avx2+0xa5>
+  8012bd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012c2:	0f b6 00             	movzbl (%rax),%eax
+  8012c5:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8012c9:	75 de                	jne    8012a9 <memfind_avx2+0x83>
+  return s;
+  8012cb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+
+00000000008012d2 <strlen>:
+strlen(const char *s) {
+  8012d2:	55                   	push   %rbp
+  8012d3:	48 89 e5             	mov    %rsp,%rbp
+  8012d6:	48 83 ec 40          	sub    $0x40,%rsp
+  8012da:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8012de:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8012e2:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8012e6:	48 b8 6f 0f 80 00 00 	movabs $0x800f6f,%rax
+  8012ed:	00 00 00 
+  8012f0:	ff d0                	call   *%rax
+  8012f2:	83 e0 02             	and    $0x2,%eax
+  8012f5:	85 c0                	test   %eax,%eax
+  8012f7:	74 18                	je     801311 <strlen+0x3f>
+    return strlen_avx2(s);
+  8012f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012fd:	48 89 c7             	mov    %rax,%rdi
+  801300:	48 b8 87 10 80 00 00 	movabs $0x801087,%rax
+  801307:	00 00 00 
+  80130a:	ff d0                	call   *%rax
+  80130c:	e9 82 00 00 00       	jmp    801393 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801311:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801315:	83 e0 0f             	and    $0xf,%eax
+  801318:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80131b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80131e:	48 f7 d8             	neg    %rax
+  801321:	48 89 c2             	mov    %rax,%rdx
+  801324:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801328:	48 01 d0             	add    %rdx,%rax
+  80132b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80132f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801333:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801337:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80133c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801340:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801349:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80134e:	89 c1                	mov    %eax,%ecx
+  801350:	d3 e6                	shl    %cl,%esi
+  801352:	89 f0                	mov    %esi,%eax
+  801354:	21 d0                	and    %edx,%eax
+  801356:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801359:	eb 1d                	jmp    801378 <strlen+0xa6>
+    p += 16;
+  80135b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801360:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801364:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801368:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80136d:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801371:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801375:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801378:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80137c:	74 dd                	je     80135b <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80137e:	31 c0                	xor    %eax,%eax
+  801380:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801385:	48 63 d0             	movslq %eax,%rdx
+  801388:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80138c:	48 01 d0             	add    %rdx,%rax
+  80138f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801393:	c9                   	leave
+  801394:	c3                   	ret
+
+0000000000801395 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801395:	55                   	push   %rbp
+  801396:	48 89 e5             	mov    %rsp,%rbp
+  801399:	48 83 ec 20          	sub    $0x20,%rsp
+  80139d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013a5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013ac:	eb 0e                	jmp    8013bc <strnlen+0x27>
+    n++;
+  8013ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013b2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013b7:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013bc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013c1:	74 0b                	je     8013ce <strnlen+0x39>
+  8013c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c7:	0f b6 00             	movzbl (%rax),%eax
+  8013ca:	84 c0                	test   %al,%al
+  8013cc:	75 e0                	jne    8013ae <strnlen+0x19>
+  return n;
+  8013ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013d1:	c9                   	leave
+  8013d2:	c3                   	ret
+
+00000000008013d3 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8013d3:	55                   	push   %rbp
+  8013d4:	48 89 e5             	mov    %rsp,%rbp
+  8013d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8013db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8013e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8013eb:	90                   	nop
+  8013ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013f0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013f4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801400:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801404:	0f b6 12             	movzbl (%rdx),%edx
+  801407:	88 10                	mov    %dl,(%rax)
+  801409:	0f b6 00             	movzbl (%rax),%eax
+  80140c:	84 c0                	test   %al,%al
+  80140e:	75 dc                	jne    8013ec <strcpy+0x19>
+  return ret;
+  801410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+
+0000000000801416 <strcat>:
+strcat(char *dst, const char *src) {
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	48 83 ec 20          	sub    $0x20,%rsp
+  80141e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801422:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80142a:	48 89 c7             	mov    %rax,%rdi
+  80142d:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  801434:	00 00 00 
+  801437:	ff d0                	call   *%rax
+  801439:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80143c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80143f:	48 63 d0             	movslq %eax,%rdx
+  801442:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801446:	48 01 c2             	add    %rax,%rdx
+  801449:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80144d:	48 89 c6             	mov    %rax,%rsi
+  801450:	48 89 d7             	mov    %rdx,%rdi
+  801453:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  80145a:	00 00 00 
+  80145d:	ff d0                	call   *%rax
+  return dst;
+  80145f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801463:	c9                   	leave
+  801464:	c3                   	ret
+
+0000000000801465 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801465:	55                   	push   %rbp
+  801466:	48 89 e5             	mov    %rsp,%rbp
+  801469:	48 83 ec 28          	sub    $0x28,%rsp
+  80146d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801471:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801475:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801479:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80147d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801481:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801488:	00 
+  801489:	eb 2a                	jmp    8014b5 <strncpy+0x50>
+    *dst++ = *src;
+  80148b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80148f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801493:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801497:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80149b:	0f b6 12             	movzbl (%rdx),%edx
+  80149e:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8014a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014a4:	0f b6 00             	movzbl (%rax),%eax
+  8014a7:	84 c0                	test   %al,%al
+  8014a9:	74 05                	je     8014b0 <strncpy+0x4b>
+      src++;
+  8014ab:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8014b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014bd:	72 cc                	jb     80148b <strncpy+0x26>
+  return ret;
+  8014bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+00000000008014c5 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8014cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014d5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8014d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8014e1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014e6:	74 3d                	je     801525 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8014e8:	eb 1d                	jmp    801507 <strlcpy+0x42>
+      *dst++ = *src++;
+  8014ea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014ee:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801502:	0f b6 12             	movzbl (%rdx),%edx
+  801505:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801507:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80150c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801511:	74 0b                	je     80151e <strlcpy+0x59>
+  801513:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801517:	0f b6 00             	movzbl (%rax),%eax
+  80151a:	84 c0                	test   %al,%al
+  80151c:	75 cc                	jne    8014ea <strlcpy+0x25>
+    *dst = '\0';
+  80151e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801522:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801525:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801529:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80152d:	c9                   	leave
+  80152e:	c3                   	ret
+
+000000000080152f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	48 83 ec 30          	sub    $0x30,%rsp
+  801537:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80153b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80153f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801543:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801547:	48 89 c7             	mov    %rax,%rdi
+  80154a:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+  801556:	48 98                	cltq
+  801558:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80155c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801560:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801564:	48 89 d6             	mov    %rdx,%rsi
+  801567:	48 89 c7             	mov    %rax,%rdi
+  80156a:	48 b8 95 13 80 00 00 	movabs $0x801395,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+  801576:	48 98                	cltq
+  801578:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80157c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801580:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801584:	75 10                	jne    801596 <strlcat+0x67>
+    return maxlen + srclen;
+  801586:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80158a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158e:	48 01 d0             	add    %rdx,%rax
+  801591:	e9 86 00 00 00       	jmp    80161c <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801596:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80159a:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80159e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015a2:	73 2b                	jae    8015cf <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8015a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015ac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b4:	48 01 c1             	add    %rax,%rcx
+  8015b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015bb:	48 89 c6             	mov    %rax,%rsi
+  8015be:	48 89 cf             	mov    %rcx,%rdi
+  8015c1:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  8015c8:	00 00 00 
+  8015cb:	ff d0                	call   *%rax
+  8015cd:	eb 42                	jmp    801611 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8015cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015d3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015d7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015df:	48 01 c1             	add    %rax,%rcx
+  8015e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015e6:	48 89 c6             	mov    %rax,%rsi
+  8015e9:	48 89 cf             	mov    %rcx,%rdi
+  8015ec:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  8015f3:	00 00 00 
+  8015f6:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8015f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801600:	48 01 d0             	add    %rdx,%rax
+  801603:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160b:	48 01 d0             	add    %rdx,%rax
+  80160e:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801611:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801619:	48 01 d0             	add    %rdx,%rax
+}
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+000000000080161e <strcmp>:
+strcmp(const char *p, const char *q) {
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	48 83 ec 10          	sub    $0x10,%rsp
+  801626:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80162a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80162e:	eb 0a                	jmp    80163a <strcmp+0x1c>
+    p++, q++;
+  801630:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801635:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80163a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80163e:	0f b6 00             	movzbl (%rax),%eax
+  801641:	84 c0                	test   %al,%al
+  801643:	74 12                	je     801657 <strcmp+0x39>
+  801645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801649:	0f b6 10             	movzbl (%rax),%edx
+  80164c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801650:	0f b6 00             	movzbl (%rax),%eax
+  801653:	38 c2                	cmp    %al,%dl
+  801655:	74 d9                	je     801630 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165b:	0f b6 00             	movzbl (%rax),%eax
+  80165e:	0f b6 d0             	movzbl %al,%edx
+  801661:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801665:	0f b6 00             	movzbl (%rax),%eax
+  801668:	0f b6 c0             	movzbl %al,%eax
+  80166b:	29 c2                	sub    %eax,%edx
+  80166d:	89 d0                	mov    %edx,%eax
+}
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+
+0000000000801671 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801671:	55                   	push   %rbp
+  801672:	48 89 e5             	mov    %rsp,%rbp
+  801675:	48 83 ec 18          	sub    $0x18,%rsp
+  801679:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80167d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801681:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801685:	eb 0f                	jmp    801696 <strncmp+0x25>
+    n--, p++, q++;
+  801687:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80168c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801691:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801696:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80169b:	74 1d                	je     8016ba <strncmp+0x49>
+  80169d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a1:	0f b6 00             	movzbl (%rax),%eax
+  8016a4:	84 c0                	test   %al,%al
+  8016a6:	74 12                	je     8016ba <strncmp+0x49>
+  8016a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ac:	0f b6 10             	movzbl (%rax),%edx
+  8016af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b3:	0f b6 00             	movzbl (%rax),%eax
+  8016b6:	38 c2                	cmp    %al,%dl
+  8016b8:	74 cd                	je     801687 <strncmp+0x16>
+  if (n == 0)
+  8016ba:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016bf:	75 07                	jne    8016c8 <strncmp+0x57>
+    return 0;
+  8016c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c6:	eb 16                	jmp    8016de <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016cc:	0f b6 00             	movzbl (%rax),%eax
+  8016cf:	0f b6 d0             	movzbl %al,%edx
+  8016d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016d6:	0f b6 00             	movzbl (%rax),%eax
+  8016d9:	0f b6 c0             	movzbl %al,%eax
+  8016dc:	29 c2                	sub    %eax,%edx
+}
+  8016de:	89 d0                	mov    %edx,%eax
+  8016e0:	c9                   	leave
+  8016e1:	c3                   	ret
+
+00000000008016e2 <strchr>:
+strchr(const char *s, char c) {
+  8016e2:	55                   	push   %rbp
+  8016e3:	48 89 e5             	mov    %rsp,%rbp
+  8016e6:	48 83 ec 60          	sub    $0x60,%rsp
+  8016ea:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8016ee:	89 f0                	mov    %esi,%eax
+  8016f0:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8016f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016f7:	83 e0 0f             	and    $0xf,%eax
+  8016fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8016fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801700:	48 f7 d8             	neg    %rax
+  801703:	48 89 c2             	mov    %rax,%rdx
+  801706:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80170a:	48 01 d0             	add    %rdx,%rax
+  80170d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801711:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801715:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801719:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80171d:	66 0f 6e c0          	movd   %eax,%xmm0
+  801721:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801725:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801729:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80172e:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801732:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801736:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80173a:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80173e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801743:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801748:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80174c:	89 c2                	mov    %eax,%edx
+  80174e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801753:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801758:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80175c:	09 c2                	or     %eax,%edx
+  80175e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801761:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801766:	89 c1                	mov    %eax,%ecx
+  801768:	d3 e6                	shl    %cl,%esi
+  80176a:	89 f0                	mov    %esi,%eax
+  80176c:	21 d0                	and    %edx,%eax
+  80176e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801771:	eb 34                	jmp    8017a7 <strchr+0xc5>
+    p += 16;
+  801773:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801780:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801784:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801789:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80178e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801792:	89 c2                	mov    %eax,%edx
+  801794:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801799:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80179e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017a2:	09 d0                	or     %edx,%eax
+  8017a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017ab:	74 c6                	je     801773 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8017ad:	31 c0                	xor    %eax,%eax
+  8017af:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8017b4:	48 98                	cltq
+  8017b6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8017ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017be:	0f b6 00             	movzbl (%rax),%eax
+  8017c1:	84 c0                	test   %al,%al
+  8017c3:	74 06                	je     8017cb <strchr+0xe9>
+  8017c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c9:	eb 05                	jmp    8017d0 <strchr+0xee>
+  8017cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+
+00000000008017d2 <strfind>:
+strfind(const char *s, char c) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+  8017d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8017da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017de:	89 f0                	mov    %esi,%eax
+  8017e0:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8017e3:	eb 11                	jmp    8017f6 <strfind+0x24>
+    if (*s == c)
+  8017e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e9:	0f b6 00             	movzbl (%rax),%eax
+  8017ec:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017ef:	74 12                	je     801803 <strfind+0x31>
+  for (; *s; s++)
+  8017f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fa:	0f b6 00             	movzbl (%rax),%eax
+  8017fd:	84 c0                	test   %al,%al
+  8017ff:	75 e4                	jne    8017e5 <strfind+0x13>
+  801801:	eb 01                	jmp    801804 <strfind+0x32>
+      break;
+  801803:	90                   	nop
+  return (char *)s;
+  801804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+
+000000000080180a <memset>:
+memset(void *v, int c, size_t n) {
+  80180a:	55                   	push   %rbp
+  80180b:	48 89 e5             	mov    %rsp,%rbp
+  80180e:	48 83 ec 38          	sub    $0x38,%rsp
+  801812:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801816:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801819:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80181d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801821:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801825:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80182a:	76 41                	jbe    80186d <memset+0x63>
+  80182c:	48 b8 6f 0f 80 00 00 	movabs $0x800f6f,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+  801838:	83 e0 01             	and    $0x1,%eax
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	74 2e                	je     80186d <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80183f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801842:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801846:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80184a:	48 89 ce             	mov    %rcx,%rsi
+  80184d:	48 89 f7             	mov    %rsi,%rdi
+  801850:	48 89 d1             	mov    %rdx,%rcx
+  801853:	fc                   	cld
+  801854:	f3 aa                	rep stos %al,%es:(%rdi)
+  801856:	48 89 ca             	mov    %rcx,%rdx
+  801859:	48 89 fe             	mov    %rdi,%rsi
+  80185c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801860:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801864:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801868:	e9 a7 00 00 00       	jmp    801914 <memset+0x10a>
+  if (n >= 8) {
+  80186d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801872:	0f 86 87 00 00 00    	jbe    8018ff <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801878:	eb 16                	jmp    801890 <memset+0x86>
+      *p++ = c;
+  80187a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801882:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801886:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801889:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80188b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801890:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801894:	83 e0 07             	and    $0x7,%eax
+  801897:	48 85 c0             	test   %rax,%rax
+  80189a:	75 de                	jne    80187a <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80189c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80189f:	0f b6 c0             	movzbl %al,%eax
+  8018a2:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8018a9:	01 01 01 
+  8018ac:	48 0f af c2          	imul   %rdx,%rax
+  8018b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8018b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018b8:	48 c1 e8 03          	shr    $0x3,%rax
+  8018bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8018c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018cc:	48 89 ce             	mov    %rcx,%rsi
+  8018cf:	48 89 f7             	mov    %rsi,%rdi
+  8018d2:	48 89 d1             	mov    %rdx,%rcx
+  8018d5:	fc                   	cld
+  8018d6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8018d9:	48 89 ca             	mov    %rcx,%rdx
+  8018dc:	48 89 fe             	mov    %rdi,%rsi
+  8018df:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8018e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8018e7:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8018ec:	eb 11                	jmp    8018ff <memset+0xf5>
+    *p++ = c;
+  8018ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018f6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018fa:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018fd:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8018ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801903:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801907:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80190b:	48 85 c0             	test   %rax,%rax
+  80190e:	75 de                	jne    8018ee <memset+0xe4>
+  return v;
+  801910:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801914:	c9                   	leave
+  801915:	c3                   	ret
+
+0000000000801916 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	48 83 ec 38          	sub    $0x38,%rsp
+  80191e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801922:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801926:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80192a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80192e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801932:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801936:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80193a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80193e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801942:	0f 83 da 00 00 00    	jae    801a22 <memmove+0x10c>
+  801948:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80194c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801950:	48 01 d0             	add    %rdx,%rax
+  801953:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801957:	0f 83 c5 00 00 00    	jae    801a22 <memmove+0x10c>
+    s += n;
+  80195d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801961:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801965:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801969:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80196d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801972:	0f 86 94 00 00 00    	jbe    801a0c <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801978:	eb 1c                	jmp    801996 <memmove+0x80>
+        *--d = *--s;
+  80197a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80197f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801988:	0f b6 10             	movzbl (%rax),%edx
+  80198b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801991:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80199a:	83 e0 07             	and    $0x7,%eax
+  80199d:	48 85 c0             	test   %rax,%rax
+  8019a0:	75 d8                	jne    80197a <memmove+0x64>
+      nq = n / 8;
+  8019a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019a6:	48 c1 e8 03          	shr    $0x3,%rax
+  8019aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019ae:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8019b3:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8019b8:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8019bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8019c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c9:	48 89 cf             	mov    %rcx,%rdi
+  8019cc:	48 89 d6             	mov    %rdx,%rsi
+  8019cf:	48 89 c1             	mov    %rax,%rcx
+  8019d2:	fd                   	std
+  8019d3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019d6:	fc                   	cld
+  8019d7:	48 89 c8             	mov    %rcx,%rax
+  8019da:	48 89 f2             	mov    %rsi,%rdx
+  8019dd:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019e1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019e5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8019e9:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8019ee:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8019f3:	eb 17                	jmp    801a0c <memmove+0xf6>
+      *--d = *--s;
+  8019f5:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019fa:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a03:	0f b6 10             	movzbl (%rax),%edx
+  801a06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a0a:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a10:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a14:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a18:	48 85 c0             	test   %rax,%rax
+  801a1b:	75 d8                	jne    8019f5 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801a1d:	e9 f4 00 00 00       	jmp    801b16 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a22:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a27:	76 46                	jbe    801a6f <memmove+0x159>
+  801a29:	48 b8 6f 0f 80 00 00 	movabs $0x800f6f,%rax
+  801a30:	00 00 00 
+  801a33:	ff d0                	call   *%rax
+  801a35:	83 e0 01             	and    $0x1,%eax
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	74 33                	je     801a6f <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a3c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a48:	48 89 cf             	mov    %rcx,%rdi
+  801a4b:	48 89 d6             	mov    %rdx,%rsi
+  801a4e:	48 89 c1             	mov    %rax,%rcx
+  801a51:	fc                   	cld
+  801a52:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a54:	48 89 c8             	mov    %rcx,%rax
+  801a57:	48 89 f2             	mov    %rsi,%rdx
+  801a5a:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a5e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801a66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a6a:	e9 ab 00 00 00       	jmp    801b1a <memmove+0x204>
+    if (n >= 8) {
+  801a6f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a74:	0f 86 8b 00 00 00    	jbe    801b05 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801a7a:	eb 22                	jmp    801a9e <memmove+0x188>
+        *d++ = *s++;
+  801a7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a80:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801a88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a90:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801a94:	0f b6 12             	movzbl (%rdx),%edx
+  801a97:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801a99:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa2:	83 e0 07             	and    $0x7,%eax
+  801aa5:	48 85 c0             	test   %rax,%rax
+  801aa8:	75 d2                	jne    801a7c <memmove+0x166>
+      nq = n / 8;
+  801aaa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aae:	48 c1 e8 03          	shr    $0x3,%rax
+  801ab2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801ab6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801aba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801abe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac2:	48 89 cf             	mov    %rcx,%rdi
+  801ac5:	48 89 d6             	mov    %rdx,%rsi
+  801ac8:	48 89 c1             	mov    %rax,%rcx
+  801acb:	fc                   	cld
+  801acc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801acf:	48 89 c8             	mov    %rcx,%rax
+  801ad2:	48 89 f2             	mov    %rsi,%rdx
+  801ad5:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ad9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801add:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801ae1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801ae6:	eb 1d                	jmp    801b05 <memmove+0x1ef>
+      *d++ = *s++;
+  801ae8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aec:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801af0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801af4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801afc:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b00:	0f b6 12             	movzbl (%rdx),%edx
+  801b03:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b09:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b0d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b11:	48 85 c0             	test   %rax,%rax
+  801b14:	75 d2                	jne    801ae8 <memmove+0x1d2>
+  return dst;
+  801b16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b1a:	c9                   	leave
+  801b1b:	c3                   	ret
+
+0000000000801b1c <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801b1c:	55                   	push   %rbp
+  801b1d:	48 89 e5             	mov    %rsp,%rbp
+  801b20:	48 83 ec 18          	sub    $0x18,%rsp
+  801b24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b2c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801b30:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b34:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b3c:	48 89 ce             	mov    %rcx,%rsi
+  801b3f:	48 89 c7             	mov    %rax,%rdi
+  801b42:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  801b49:	00 00 00 
+  801b4c:	ff d0                	call   *%rax
+}
+  801b4e:	c9                   	leave
+  801b4f:	c3                   	ret
+
+0000000000801b50 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801b50:	55                   	push   %rbp
+  801b51:	48 89 e5             	mov    %rsp,%rbp
+  801b54:	48 83 ec 40          	sub    $0x40,%rsp
+  801b58:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b5c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801b64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801b6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b74:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801b79:	0f 86 a7 00 00 00    	jbe    801c26 <memcmp+0xd6>
+  801b7f:	48 b8 6f 0f 80 00 00 	movabs $0x800f6f,%rax
+  801b86:	00 00 00 
+  801b89:	ff d0                	call   *%rax
+  801b8b:	83 e0 02             	and    $0x2,%eax
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	0f 84 90 00 00 00    	je     801c26 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801b96:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b9a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba2:	48 89 ce             	mov    %rcx,%rsi
+  801ba5:	48 89 c7             	mov    %rax,%rdi
+  801ba8:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  801baf:	00 00 00 
+  801bb2:	ff d0                	call   *%rax
+  801bb4:	e9 c2 00 00 00       	jmp    801c7b <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bbd:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bc1:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc9:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bcd:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801bd1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bd5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801bd8:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801bdf:	74 36                	je     801c17 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801be1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801be4:	f7 d0                	not    %eax
+  801be6:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801bea:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801bed:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801bf0:	48 63 d0             	movslq %eax,%rdx
+  801bf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf7:	48 01 d0             	add    %rdx,%rax
+  801bfa:	0f b6 00             	movzbl (%rax),%eax
+  801bfd:	0f b6 c0             	movzbl %al,%eax
+  801c00:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801c03:	48 63 ca             	movslq %edx,%rcx
+  801c06:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c0a:	48 01 ca             	add    %rcx,%rdx
+  801c0d:	0f b6 12             	movzbl (%rdx),%edx
+  801c10:	0f b6 d2             	movzbl %dl,%edx
+  801c13:	29 d0                	sub    %edx,%eax
+  801c15:	eb 64                	jmp    801c7b <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801c17:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801c1c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801c21:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801c26:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801c2b:	77 8c                	ja     801bb9 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801c2d:	eb 36                	jmp    801c65 <memcmp+0x115>
+    if (*s1 != *s2)
+  801c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c33:	0f b6 10             	movzbl (%rax),%edx
+  801c36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c3a:	0f b6 00             	movzbl (%rax),%eax
+  801c3d:	38 c2                	cmp    %al,%dl
+  801c3f:	74 1a                	je     801c5b <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c45:	0f b6 00             	movzbl (%rax),%eax
+  801c48:	0f b6 c8             	movzbl %al,%ecx
+  801c4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c4f:	0f b6 00             	movzbl (%rax),%eax
+  801c52:	0f b6 d0             	movzbl %al,%edx
+  801c55:	89 c8                	mov    %ecx,%eax
+  801c57:	29 d0                	sub    %edx,%eax
+  801c59:	eb 20                	jmp    801c7b <memcmp+0x12b>
+    s1++, s2++;
+  801c5b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c60:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801c65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c69:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c71:	48 85 c0             	test   %rax,%rax
+  801c74:	75 b9                	jne    801c2f <memcmp+0xdf>
+  }
+
+  return 0;
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c7b:	c9                   	leave
+  801c7c:	c3                   	ret
+
+0000000000801c7d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801c7d:	55                   	push   %rbp
+  801c7e:	48 89 e5             	mov    %rsp,%rbp
+  801c81:	48 83 ec 50          	sub    $0x50,%rsp
+  801c85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801c89:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801c8c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801c90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c94:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801c98:	48 01 d0             	add    %rdx,%rax
+  801c9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801c9f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ca2:	66 0f 6e c0          	movd   %eax,%xmm0
+  801ca6:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801caa:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801cae:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801cb3:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801cb7:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801cbc:	76 73                	jbe    801d31 <memfind+0xb4>
+  801cbe:	48 b8 6f 0f 80 00 00 	movabs $0x800f6f,%rax
+  801cc5:	00 00 00 
+  801cc8:	ff d0                	call   *%rax
+  801cca:	83 e0 02             	and    $0x2,%eax
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	74 60                	je     801d31 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801cd1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801cd4:	0f b6 c8             	movzbl %al,%ecx
+  801cd7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801cdb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cdf:	89 ce                	mov    %ecx,%esi
+  801ce1:	48 89 c7             	mov    %rax,%rdi
+  801ce4:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+  801cf0:	eb 6c                	jmp    801d5e <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801cf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801cfa:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801cfe:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801d03:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d07:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d0b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d0e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d12:	74 13                	je     801d27 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801d14:	31 c0                	xor    %eax,%eax
+  801d16:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801d1b:	48 63 d0             	movslq %eax,%rdx
+  801d1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d22:	48 01 d0             	add    %rdx,%rax
+  801d25:	eb 37                	jmp    801d5e <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801d27:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801d2c:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801d31:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d36:	77 ba                	ja     801cf2 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d38:	eb 13                	jmp    801d4d <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3e:	0f b6 00             	movzbl (%rax),%eax
+  801d41:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d44:	38 d0                	cmp    %dl,%al
+  801d46:	74 11                	je     801d59 <memfind+0xdc>
+  for (; s < ends; s++)
+  801d48:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801d4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d51:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d55:	72 e3                	jb     801d3a <memfind+0xbd>
+  801d57:	eb 01                	jmp    801d5a <memfind+0xdd>
+      break;
+  801d59:	90                   	nop
+  return (void *)s;
+  801d5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+
+0000000000801d60 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801d60:	55                   	push   %rbp
+  801d61:	48 89 e5             	mov    %rsp,%rbp
+  801d64:	48 83 ec 38          	sub    $0x38,%rsp
+  801d68:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d6c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d70:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801d73:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801d7a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d81:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801d82:	eb 05                	jmp    801d89 <strtol+0x29>
+    s++;
+  801d84:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801d89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d8d:	0f b6 00             	movzbl (%rax),%eax
+  801d90:	3c 20                	cmp    $0x20,%al
+  801d92:	74 f0                	je     801d84 <strtol+0x24>
+  801d94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d98:	0f b6 00             	movzbl (%rax),%eax
+  801d9b:	3c 09                	cmp    $0x9,%al
+  801d9d:	74 e5                	je     801d84 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801d9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da3:	0f b6 00             	movzbl (%rax),%eax
+  801da6:	3c 2b                	cmp    $0x2b,%al
+  801da8:	75 07                	jne    801db1 <strtol+0x51>
+    s++;
+  801daa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801daf:	eb 17                	jmp    801dc8 <strtol+0x68>
+  else if (*s == '-')
+  801db1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db5:	0f b6 00             	movzbl (%rax),%eax
+  801db8:	3c 2d                	cmp    $0x2d,%al
+  801dba:	75 0c                	jne    801dc8 <strtol+0x68>
+    s++, neg = 1;
+  801dbc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801dc1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801dc8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dcc:	74 06                	je     801dd4 <strtol+0x74>
+  801dce:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801dd2:	75 28                	jne    801dfc <strtol+0x9c>
+  801dd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dd8:	0f b6 00             	movzbl (%rax),%eax
+  801ddb:	3c 30                	cmp    $0x30,%al
+  801ddd:	75 1d                	jne    801dfc <strtol+0x9c>
+  801ddf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de3:	48 83 c0 01          	add    $0x1,%rax
+  801de7:	0f b6 00             	movzbl (%rax),%eax
+  801dea:	3c 78                	cmp    $0x78,%al
+  801dec:	75 0e                	jne    801dfc <strtol+0x9c>
+    s += 2, base = 16;
+  801dee:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801df3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801dfa:	eb 2c                	jmp    801e28 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801dfc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e00:	75 19                	jne    801e1b <strtol+0xbb>
+  801e02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e06:	0f b6 00             	movzbl (%rax),%eax
+  801e09:	3c 30                	cmp    $0x30,%al
+  801e0b:	75 0e                	jne    801e1b <strtol+0xbb>
+    s++, base = 8;
+  801e0d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e12:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801e19:	eb 0d                	jmp    801e28 <strtol+0xc8>
+  else if (base == 0)
+  801e1b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e1f:	75 07                	jne    801e28 <strtol+0xc8>
+    base = 10;
+  801e21:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801e28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e2c:	0f b6 00             	movzbl (%rax),%eax
+  801e2f:	3c 2f                	cmp    $0x2f,%al
+  801e31:	7e 1d                	jle    801e50 <strtol+0xf0>
+  801e33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e37:	0f b6 00             	movzbl (%rax),%eax
+  801e3a:	3c 39                	cmp    $0x39,%al
+  801e3c:	7f 12                	jg     801e50 <strtol+0xf0>
+      dig = *s - '0';
+  801e3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e42:	0f b6 00             	movzbl (%rax),%eax
+  801e45:	0f be c0             	movsbl %al,%eax
+  801e48:	83 e8 30             	sub    $0x30,%eax
+  801e4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e4e:	eb 4e                	jmp    801e9e <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801e50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e54:	0f b6 00             	movzbl (%rax),%eax
+  801e57:	3c 60                	cmp    $0x60,%al
+  801e59:	7e 1d                	jle    801e78 <strtol+0x118>
+  801e5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e5f:	0f b6 00             	movzbl (%rax),%eax
+  801e62:	3c 7a                	cmp    $0x7a,%al
+  801e64:	7f 12                	jg     801e78 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801e66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6a:	0f b6 00             	movzbl (%rax),%eax
+  801e6d:	0f be c0             	movsbl %al,%eax
+  801e70:	83 e8 57             	sub    $0x57,%eax
+  801e73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e76:	eb 26                	jmp    801e9e <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801e78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e7c:	0f b6 00             	movzbl (%rax),%eax
+  801e7f:	3c 40                	cmp    $0x40,%al
+  801e81:	7e 47                	jle    801eca <strtol+0x16a>
+  801e83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e87:	0f b6 00             	movzbl (%rax),%eax
+  801e8a:	3c 5a                	cmp    $0x5a,%al
+  801e8c:	7f 3c                	jg     801eca <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801e8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e92:	0f b6 00             	movzbl (%rax),%eax
+  801e95:	0f be c0             	movsbl %al,%eax
+  801e98:	83 e8 37             	sub    $0x37,%eax
+  801e9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801e9e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ea1:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ea4:	7d 23                	jge    801ec9 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ea6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801eab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801eae:	48 98                	cltq
+  801eb0:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801eb5:	48 89 c2             	mov    %rax,%rdx
+  801eb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ebb:	48 98                	cltq
+  801ebd:	48 01 d0             	add    %rdx,%rax
+  801ec0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801ec4:	e9 5f ff ff ff       	jmp    801e28 <strtol+0xc8>
+      break;
+  801ec9:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801eca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ecf:	74 0b                	je     801edc <strtol+0x17c>
+    *endptr = (char *)s;
+  801ed1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ed9:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801edc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ee0:	74 09                	je     801eeb <strtol+0x18b>
+  801ee2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ee6:	48 f7 d8             	neg    %rax
+  801ee9:	eb 04                	jmp    801eef <strtol+0x18f>
+  801eeb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+
+0000000000801ef1 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801ef1:	55                   	push   %rbp
+  801ef2:	48 89 e5             	mov    %rsp,%rbp
+  801ef5:	53                   	push   %rbx
+  801ef6:	48 83 ec 48          	sub    $0x48,%rsp
+  801efa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801efe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f02:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f06:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801f0a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801f0e:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801f12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f16:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f1a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f1e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801f22:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f26:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f2a:	4c 89 c3             	mov    %r8,%rbx
+  801f2d:	cd 30                	int    $0x30
+  801f2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f33:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f38:	74 46                	je     801f80 <syscall+0x8f>
+  801f3a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f3f:	7e 3f                	jle    801f80 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f49:	49 89 d0             	mov    %rdx,%r8
+  801f4c:	48 89 c1             	mov    %rax,%rcx
+  801f4f:	48 b8 a8 69 80 00 00 	movabs $0x8069a8,%rax
+  801f56:	00 00 00 
+  801f59:	48 89 c2             	mov    %rax,%rdx
+  801f5c:	be 22 00 00 00       	mov    $0x22,%esi
+  801f61:	48 b8 c7 69 80 00 00 	movabs $0x8069c7,%rax
+  801f68:	00 00 00 
+  801f6b:	48 89 c7             	mov    %rax,%rdi
+  801f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f73:	49 b9 04 02 80 00 00 	movabs $0x800204,%r9
+  801f7a:	00 00 00 
+  801f7d:	41 ff d1             	call   *%r9
+
+  return ret;
+  801f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+
+0000000000801f8a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f96:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fa2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa6:	6a 00                	push   $0x0
+  801fa8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb4:	48 89 d1             	mov    %rdx,%rcx
+  801fb7:	48 89 c2             	mov    %rax,%rdx
+  801fba:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fc4:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd4:	90                   	nop
+  801fd5:	c9                   	leave
+  801fd6:	c3                   	ret
+
+0000000000801fd7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801fdb:	48 83 ec 08          	sub    $0x8,%rsp
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffc:	bf 01 00 00 00       	mov    $0x1,%edi
+  802001:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+  80200d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+
+0000000000802013 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802013:	55                   	push   %rbp
+  802014:	48 89 e5             	mov    %rsp,%rbp
+  802017:	48 83 ec 10          	sub    $0x10,%rsp
+  80201b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80201e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802021:	48 98                	cltq
+  802023:	48 83 ec 08          	sub    $0x8,%rsp
+  802027:	6a 00                	push   $0x0
+  802029:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80202f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802035:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80203a:	48 89 c2             	mov    %rax,%rdx
+  80203d:	be 01 00 00 00       	mov    $0x1,%esi
+  802042:	bf 03 00 00 00       	mov    $0x3,%edi
+  802047:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80204e:	00 00 00 
+  802051:	ff d0                	call   *%rax
+  802053:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802057:	c9                   	leave
+  802058:	c3                   	ret
+
+0000000000802059 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802059:	55                   	push   %rbp
+  80205a:	48 89 e5             	mov    %rsp,%rbp
+  80205d:	48 83 ec 10          	sub    $0x10,%rsp
+  802061:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802064:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802067:	48 98                	cltq
+  802069:	48 83 ec 08          	sub    $0x8,%rsp
+  80206d:	6a 00                	push   $0x0
+  80206f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802075:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80207b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802080:	48 89 c2             	mov    %rax,%rdx
+  802083:	be 00 00 00 00       	mov    $0x0,%esi
+  802088:	bf 04 00 00 00       	mov    $0x4,%edi
+  80208d:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+  802099:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209d:	90                   	nop
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+
+00000000008020a0 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8020a0:	55                   	push   %rbp
+  8020a1:	48 89 e5             	mov    %rsp,%rbp
+  8020a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8020af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020b2:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8020b5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020ba:	cd 30                	int    $0x30
+  8020bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8020c0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8020c4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8020c9:	7e 3d                	jle    802108 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8020cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020cf:	49 89 c0             	mov    %rax,%r8
+  8020d2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8020d7:	48 b8 a8 69 80 00 00 	movabs $0x8069a8,%rax
+  8020de:	00 00 00 
+  8020e1:	48 89 c2             	mov    %rax,%rdx
+  8020e4:	be 49 00 00 00       	mov    $0x49,%esi
+  8020e9:	48 b8 c7 69 80 00 00 	movabs $0x8069c7,%rax
+  8020f0:	00 00 00 
+  8020f3:	48 89 c7             	mov    %rax,%rdi
+  8020f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fb:	49 b9 04 02 80 00 00 	movabs $0x800204,%r9
+  802102:	00 00 00 
+  802105:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802108:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80210d:	75 13                	jne    802122 <sys_env_wait+0x82>
+  80210f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802114:	74 0c                	je     802122 <sys_env_wait+0x82>
+    *status = st;
+  802116:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80211a:	89 c2                	mov    %eax,%edx
+  80211c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802120:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+
+0000000000802128 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802128:	55                   	push   %rbp
+  802129:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80212c:	48 83 ec 08          	sub    $0x8,%rsp
+  802130:	6a 00                	push   $0x0
+  802132:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80213e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802143:	ba 00 00 00 00       	mov    $0x0,%edx
+  802148:	be 00 00 00 00       	mov    $0x0,%esi
+  80214d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802152:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+  80215e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+0000000000802164 <sys_yield>:
+
+void
+sys_yield(void) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802168:	48 83 ec 08          	sub    $0x8,%rsp
+  80216c:	6a 00                	push   $0x0
+  80216e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80217f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802184:	be 00 00 00 00       	mov    $0x0,%esi
+  802189:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80218e:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+  80219a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219e:	90                   	nop
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+00000000008021a1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8021a1:	55                   	push   %rbp
+  8021a2:	48 89 e5             	mov    %rsp,%rbp
+  8021a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8021ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021b0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8021b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8021b6:	48 63 c8             	movslq %eax,%rcx
+  8021b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8021bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021c0:	48 98                	cltq
+  8021c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c6:	6a 00                	push   $0x0
+  8021c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ce:	49 89 c8             	mov    %rcx,%r8
+  8021d1:	48 89 d1             	mov    %rdx,%rcx
+  8021d4:	48 89 c2             	mov    %rax,%rdx
+  8021d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8021dc:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021e1:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8021e8:	00 00 00 
+  8021eb:	ff d0                	call   *%rax
+  8021ed:	48 83 c4 10          	add    $0x10,%rsp
+  8021f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8021f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021f7:	c9                   	leave
+  8021f8:	c3                   	ret
+
+00000000008021f9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8021f9:	55                   	push   %rbp
+  8021fa:	48 89 e5             	mov    %rsp,%rbp
+  8021fd:	48 83 ec 20          	sub    $0x20,%rsp
+  802201:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802204:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802208:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80220b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80220f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802213:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802216:	48 63 c8             	movslq %eax,%rcx
+  802219:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80221d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802220:	48 63 f0             	movslq %eax,%rsi
+  802223:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802227:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80222a:	48 98                	cltq
+  80222c:	48 83 ec 08          	sub    $0x8,%rsp
+  802230:	51                   	push   %rcx
+  802231:	49 89 f9             	mov    %rdi,%r9
+  802234:	49 89 f0             	mov    %rsi,%r8
+  802237:	48 89 d1             	mov    %rdx,%rcx
+  80223a:	48 89 c2             	mov    %rax,%rdx
+  80223d:	be 01 00 00 00       	mov    $0x1,%esi
+  802242:	bf 07 00 00 00       	mov    $0x7,%edi
+  802247:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80224e:	00 00 00 
+  802251:	ff d0                	call   *%rax
+  802253:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802257:	c9                   	leave
+  802258:	c3                   	ret
+
+0000000000802259 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802259:	55                   	push   %rbp
+  80225a:	48 89 e5             	mov    %rsp,%rbp
+  80225d:	48 83 ec 10          	sub    $0x10,%rsp
+  802261:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802264:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802268:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80226c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80226f:	48 98                	cltq
+  802271:	48 83 ec 08          	sub    $0x8,%rsp
+  802275:	6a 00                	push   $0x0
+  802277:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802283:	48 89 d1             	mov    %rdx,%rcx
+  802286:	48 89 c2             	mov    %rax,%rdx
+  802289:	be 01 00 00 00       	mov    $0x1,%esi
+  80228e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802293:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a3:	c9                   	leave
+  8022a4:	c3                   	ret
+
+00000000008022a5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8022a5:	55                   	push   %rbp
+  8022a6:	48 89 e5             	mov    %rsp,%rbp
+  8022a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022b3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8022b6:	48 63 d0             	movslq %eax,%rdx
+  8022b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022bc:	48 98                	cltq
+  8022be:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c2:	6a 00                	push   $0x0
+  8022c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d0:	48 89 d1             	mov    %rdx,%rcx
+  8022d3:	48 89 c2             	mov    %rax,%rdx
+  8022d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8022db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022e0:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8022e7:	00 00 00 
+  8022ea:	ff d0                	call   *%rax
+  8022ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+00000000008022f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8022f2:	55                   	push   %rbp
+  8022f3:	48 89 e5             	mov    %rsp,%rbp
+  8022f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8022fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802301:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802305:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802308:	48 98                	cltq
+  80230a:	48 83 ec 08          	sub    $0x8,%rsp
+  80230e:	6a 00                	push   $0x0
+  802310:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802316:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80231c:	48 89 d1             	mov    %rdx,%rcx
+  80231f:	48 89 c2             	mov    %rax,%rdx
+  802322:	be 01 00 00 00       	mov    $0x1,%esi
+  802327:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80232c:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+  802338:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+
+000000000080233e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80233e:	55                   	push   %rbp
+  80233f:	48 89 e5             	mov    %rsp,%rbp
+  802342:	48 83 ec 10          	sub    $0x10,%rsp
+  802346:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802349:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80234d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802351:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802354:	48 98                	cltq
+  802356:	48 83 ec 08          	sub    $0x8,%rsp
+  80235a:	6a 00                	push   $0x0
+  80235c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802362:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802368:	48 89 d1             	mov    %rdx,%rcx
+  80236b:	48 89 c2             	mov    %rax,%rdx
+  80236e:	be 01 00 00 00       	mov    $0x1,%esi
+  802373:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802378:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+  802384:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+
+000000000080238a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	48 83 ec 20          	sub    $0x20,%rsp
+  802392:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802395:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802399:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80239d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8023a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023a3:	48 63 f0             	movslq %eax,%rsi
+  8023a6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023aa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023b1:	48 98                	cltq
+  8023b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b7:	6a 00                	push   $0x0
+  8023b9:	49 89 f1             	mov    %rsi,%r9
+  8023bc:	49 89 c8             	mov    %rcx,%r8
+  8023bf:	48 89 d1             	mov    %rdx,%rcx
+  8023c2:	48 89 c2             	mov    %rax,%rdx
+  8023c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ca:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8023cf:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+00000000008023e1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8023ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f5:	6a 00                	push   $0x0
+  8023f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802403:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802408:	48 89 c2             	mov    %rax,%rdx
+  80240b:	be 01 00 00 00       	mov    $0x1,%esi
+  802410:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802415:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+  802421:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802425:	c9                   	leave
+  802426:	c3                   	ret
+
+0000000000802427 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802427:	55                   	push   %rbp
+  802428:	48 89 e5             	mov    %rsp,%rbp
+  80242b:	48 83 ec 10          	sub    $0x10,%rsp
+  80242f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802433:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802437:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80243b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80243f:	48 83 ec 08          	sub    $0x8,%rsp
+  802443:	6a 00                	push   $0x0
+  802445:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80244b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802451:	48 89 d1             	mov    %rdx,%rcx
+  802454:	48 89 c2             	mov    %rax,%rdx
+  802457:	be 01 00 00 00       	mov    $0x1,%esi
+  80245c:	bf 10 00 00 00       	mov    $0x10,%edi
+  802461:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+  80246d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802471:	c9                   	leave
+  802472:	c3                   	ret
+
+0000000000802473 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802473:	55                   	push   %rbp
+  802474:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802477:	48 83 ec 08          	sub    $0x8,%rsp
+  80247b:	6a 00                	push   $0x0
+  80247d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802483:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80248e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802493:	be 00 00 00 00       	mov    $0x0,%esi
+  802498:	bf 11 00 00 00       	mov    $0x11,%edi
+  80249d:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+00000000008024af <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8024af:	55                   	push   %rbp
+  8024b0:	48 89 e5             	mov    %rsp,%rbp
+  8024b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8024bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cb:	6a 00                	push   $0x0
+  8024cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024d9:	48 89 d1             	mov    %rdx,%rcx
+  8024dc:	48 89 c2             	mov    %rax,%rdx
+  8024df:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e4:	bf 12 00 00 00       	mov    $0x12,%edi
+  8024e9:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+  8024f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+
+00000000008024fb <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8024fb:	55                   	push   %rbp
+  8024fc:	48 89 e5             	mov    %rsp,%rbp
+  8024ff:	48 83 ec 20          	sub    $0x20,%rsp
+  802503:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802507:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80250b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80250e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802511:	48 63 c8             	movslq %eax,%rcx
+  802514:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802518:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80251c:	48 83 ec 08          	sub    $0x8,%rsp
+  802520:	6a 00                	push   $0x0
+  802522:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802528:	49 89 c8             	mov    %rcx,%r8
+  80252b:	48 89 d1             	mov    %rdx,%rcx
+  80252e:	48 89 c2             	mov    %rax,%rdx
+  802531:	be 00 00 00 00       	mov    $0x0,%esi
+  802536:	bf 13 00 00 00       	mov    $0x13,%edi
+  80253b:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+  802547:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80254b:	c9                   	leave
+  80254c:	c3                   	ret
+
+000000000080254d <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80254d:	55                   	push   %rbp
+  80254e:	48 89 e5             	mov    %rsp,%rbp
+  802551:	48 83 ec 20          	sub    $0x20,%rsp
+  802555:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802559:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80255c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802560:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802564:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802567:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80256b:	48 83 ec 08          	sub    $0x8,%rsp
+  80256f:	6a 00                	push   $0x0
+  802571:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802577:	49 89 c8             	mov    %rcx,%r8
+  80257a:	48 89 d1             	mov    %rdx,%rcx
+  80257d:	48 89 c2             	mov    %rax,%rdx
+  802580:	be 00 00 00 00       	mov    $0x0,%esi
+  802585:	bf 14 00 00 00       	mov    $0x14,%edi
+  80258a:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+000000000080259c <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80259c:	55                   	push   %rbp
+  80259d:	48 89 e5             	mov    %rsp,%rbp
+  8025a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8025ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025ae:	48 63 d0             	movslq %eax,%rdx
+  8025b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b9:	6a 00                	push   $0x0
+  8025bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c7:	48 89 d1             	mov    %rdx,%rcx
+  8025ca:	48 89 c2             	mov    %rax,%rdx
+  8025cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d2:	bf 15 00 00 00       	mov    $0x15,%edi
+  8025d7:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e7:	c9                   	leave
+  8025e8:	c3                   	ret
+
+00000000008025e9 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8025e9:	55                   	push   %rbp
+  8025ea:	48 89 e5             	mov    %rsp,%rbp
+  8025ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8025f8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8025fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8025ff:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802603:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802606:	48 63 c8             	movslq %eax,%rcx
+  802609:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80260c:	48 63 d0             	movslq %eax,%rdx
+  80260f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802613:	48 83 ec 08          	sub    $0x8,%rsp
+  802617:	6a 00                	push   $0x0
+  802619:	49 89 f1             	mov    %rsi,%r9
+  80261c:	49 89 c8             	mov    %rcx,%r8
+  80261f:	48 89 d1             	mov    %rdx,%rcx
+  802622:	48 89 c2             	mov    %rax,%rdx
+  802625:	be 00 00 00 00       	mov    $0x0,%esi
+  80262a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80262f:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+  80263b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+
+0000000000802641 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	48 83 ec 30          	sub    $0x30,%rsp
+  802649:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80264d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802651:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802655:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802659:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80265d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802661:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802665:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802669:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80266d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802671:	48 83 ec 08          	sub    $0x8,%rsp
+  802675:	51                   	push   %rcx
+  802676:	49 89 f9             	mov    %rdi,%r9
+  802679:	49 89 f0             	mov    %rsi,%r8
+  80267c:	48 89 d1             	mov    %rdx,%rcx
+  80267f:	48 89 c2             	mov    %rax,%rdx
+  802682:	be 00 00 00 00       	mov    $0x0,%esi
+  802687:	bf 17 00 00 00       	mov    $0x17,%edi
+  80268c:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269c:	c9                   	leave
+  80269d:	c3                   	ret
+
+000000000080269e <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80269e:	55                   	push   %rbp
+  80269f:	48 89 e5             	mov    %rsp,%rbp
+  8026a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8026a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026ac:	48 98                	cltq
+  8026ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c5:	48 89 c2             	mov    %rax,%rdx
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026d2:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8026d9:	00 00 00 
+  8026dc:	ff d0                	call   *%rax
+  8026de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e2:	90                   	nop
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+
+00000000008026e5 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+  8026e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8026ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026f4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8026f8:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8026fb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8026fe:	48 63 f0             	movslq %eax,%rsi
+  802701:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802705:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802709:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80270c:	48 98                	cltq
+  80270e:	48 83 ec 08          	sub    $0x8,%rsp
+  802712:	6a 00                	push   $0x0
+  802714:	49 89 f1             	mov    %rsi,%r9
+  802717:	49 89 c8             	mov    %rcx,%r8
+  80271a:	48 89 d1             	mov    %rdx,%rcx
+  80271d:	48 89 c2             	mov    %rax,%rdx
+  802720:	be 01 00 00 00       	mov    $0x1,%esi
+  802725:	bf 19 00 00 00       	mov    $0x19,%edi
+  80272a:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	48 83 c4 10          	add    $0x10,%rsp
+  80273a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80273d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802740:	c9                   	leave
+  802741:	c3                   	ret
+
+0000000000802742 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802742:	55                   	push   %rbp
+  802743:	48 89 e5             	mov    %rsp,%rbp
+  802746:	48 83 ec 20          	sub    $0x20,%rsp
+  80274a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80274e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802752:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802755:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802758:	48 63 c8             	movslq %eax,%rcx
+  80275b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80275f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802763:	48 83 ec 08          	sub    $0x8,%rsp
+  802767:	6a 00                	push   $0x0
+  802769:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80276f:	49 89 c8             	mov    %rcx,%r8
+  802772:	48 89 d1             	mov    %rdx,%rcx
+  802775:	48 89 c2             	mov    %rax,%rdx
+  802778:	be 01 00 00 00       	mov    $0x1,%esi
+  80277d:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802782:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+  80278e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802792:	c9                   	leave
+  802793:	c3                   	ret
+
+0000000000802794 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802794:	55                   	push   %rbp
+  802795:	48 89 e5             	mov    %rsp,%rbp
+  802798:	48 83 ec 20          	sub    $0x20,%rsp
+  80279c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027a4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8027a8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b8:	6a 00                	push   $0x0
+  8027ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c0:	49 89 c8             	mov    %rcx,%r8
+  8027c3:	48 89 d1             	mov    %rdx,%rcx
+  8027c6:	48 89 c2             	mov    %rax,%rdx
+  8027c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8027ce:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8027d3:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  8027da:	00 00 00 
+  8027dd:	ff d0                	call   *%rax
+  8027df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027e3:	c9                   	leave
+  8027e4:	c3                   	ret
+
+00000000008027e5 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8027e5:	55                   	push   %rbp
+  8027e6:	48 89 e5             	mov    %rsp,%rbp
+  8027e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8027ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8027f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8027f5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8027f8:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8027fc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802800:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802803:	48 63 c8             	movslq %eax,%rcx
+  802806:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80280a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80280e:	48 83 ec 08          	sub    $0x8,%rsp
+  802812:	6a 00                	push   $0x0
+  802814:	49 89 f1             	mov    %rsi,%r9
+  802817:	49 89 c8             	mov    %rcx,%r8
+  80281a:	48 89 d1             	mov    %rdx,%rcx
+  80281d:	48 89 c2             	mov    %rax,%rdx
+  802820:	be 01 00 00 00       	mov    $0x1,%esi
+  802825:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80282a:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+  802836:	48 83 c4 10          	add    $0x10,%rsp
+  80283a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80283d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802840:	c9                   	leave
+  802841:	c3                   	ret
+
+0000000000802842 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802842:	55                   	push   %rbp
+  802843:	48 89 e5             	mov    %rsp,%rbp
+  802846:	48 83 ec 10          	sub    $0x10,%rsp
+  80284a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80284d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802850:	48 98                	cltq
+  802852:	48 83 ec 08          	sub    $0x8,%rsp
+  802856:	6a 00                	push   $0x0
+  802858:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80285e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802864:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802869:	48 89 c2             	mov    %rax,%rdx
+  80286c:	be 01 00 00 00       	mov    $0x1,%esi
+  802871:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802876:	48 b8 f1 1e 80 00 00 	movabs $0x801ef1,%rax
+  80287d:	00 00 00 
+  802880:	ff d0                	call   *%rax
+  802882:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+0000000000802888 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802888:	55                   	push   %rbp
+  802889:	48 89 e5             	mov    %rsp,%rbp
+  80288c:	48 83 ec 40          	sub    $0x40,%rsp
+  802890:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802894:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802898:	48 8b 00             	mov    (%rax),%rax
+  80289b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  80289f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8028a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  8028ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028af:	83 e0 02             	and    $0x2,%eax
+  8028b2:	48 85 c0             	test   %rax,%rax
+  8028b5:	74 25                	je     8028dc <pgfault+0x54>
+  8028b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028bb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028bf:	48 89 c2             	mov    %rax,%rdx
+  8028c2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028c9:	01 00 00 
+  8028cc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028d0:	83 e0 02             	and    $0x2,%eax
+  8028d3:	48 85 c0             	test   %rax,%rax
+  8028d6:	0f 85 fe 01 00 00    	jne    802ada <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8028dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028e0:	83 e0 02             	and    $0x2,%eax
+  8028e3:	48 85 c0             	test   %rax,%rax
+  8028e6:	74 23                	je     80290b <pgfault+0x83>
+  8028e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ec:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028f0:	48 89 c2             	mov    %rax,%rdx
+  8028f3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028fa:	01 00 00 
+  8028fd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802901:	25 00 08 00 00       	and    $0x800,%eax
+  802906:	48 85 c0             	test   %rax,%rax
+  802909:	75 3f                	jne    80294a <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  80290b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80290f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802913:	49 89 d0             	mov    %rdx,%r8
+  802916:	48 89 c1             	mov    %rax,%rcx
+  802919:	48 b8 d8 69 80 00 00 	movabs $0x8069d8,%rax
+  802920:	00 00 00 
+  802923:	48 89 c2             	mov    %rax,%rdx
+  802926:	be 26 00 00 00       	mov    $0x26,%esi
+  80292b:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802932:	00 00 00 
+  802935:	48 89 c7             	mov    %rax,%rdi
+  802938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293d:	49 b9 04 02 80 00 00 	movabs $0x800204,%r9
+  802944:	00 00 00 
+  802947:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  80294a:	48 b8 9e 54 80 00 00 	movabs $0x80549e,%rax
+  802951:	00 00 00 
+  802954:	ff d0                	call   *%rax
+  802956:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  80295a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80295e:	ba 07 00 00 00       	mov    $0x7,%edx
+  802963:	48 89 c6             	mov    %rax,%rsi
+  802966:	bf 00 00 00 00       	mov    $0x0,%edi
+  80296b:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+  802977:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80297a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80297e:	79 36                	jns    8029b6 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802980:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802983:	89 c1                	mov    %eax,%ecx
+  802985:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  80298c:	00 00 00 
+  80298f:	48 89 c2             	mov    %rax,%rdx
+  802992:	be 35 00 00 00       	mov    $0x35,%esi
+  802997:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  80299e:	00 00 00 
+  8029a1:	48 89 c7             	mov    %rax,%rdi
+  8029a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a9:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  8029b0:	00 00 00 
+  8029b3:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8029b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ba:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8029be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029c2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029c8:	48 89 c1             	mov    %rax,%rcx
+  8029cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029d4:	48 89 ce             	mov    %rcx,%rsi
+  8029d7:	48 89 c7             	mov    %rax,%rdi
+  8029da:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  8029e1:	00 00 00 
+  8029e4:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8029e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ea:	48 c1 e8 0c          	shr    $0xc,%rax
+  8029ee:	48 89 c2             	mov    %rax,%rdx
+  8029f1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029f8:	01 00 00 
+  8029fb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029ff:	25 00 08 00 00       	and    $0x800,%eax
+  802a04:	48 85 c0             	test   %rax,%rax
+  802a07:	74 7a                	je     802a83 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a0d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a15:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a1b:	48 89 c2             	mov    %rax,%rdx
+  802a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a22:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802a28:	48 89 d1             	mov    %rdx,%rcx
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	48 89 c6             	mov    %rax,%rsi
+  802a33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a38:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802a47:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802a4b:	79 36                	jns    802a83 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802a4d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a50:	89 c1                	mov    %eax,%ecx
+  802a52:	48 b8 40 6a 80 00 00 	movabs $0x806a40,%rax
+  802a59:	00 00 00 
+  802a5c:	48 89 c2             	mov    %rax,%rdx
+  802a5f:	be 42 00 00 00       	mov    $0x42,%esi
+  802a64:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802a6b:	00 00 00 
+  802a6e:	48 89 c7             	mov    %rax,%rdi
+  802a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a76:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802a7d:	00 00 00 
+  802a80:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802a83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a87:	48 89 c6             	mov    %rax,%rsi
+  802a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a8f:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+  802a9b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802a9e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802aa2:	79 37                	jns    802adb <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802aa4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802aa7:	89 c1                	mov    %eax,%ecx
+  802aa9:	48 b8 68 6a 80 00 00 	movabs $0x806a68,%rax
+  802ab0:	00 00 00 
+  802ab3:	48 89 c2             	mov    %rax,%rdx
+  802ab6:	be 46 00 00 00       	mov    $0x46,%esi
+  802abb:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802ac2:	00 00 00 
+  802ac5:	48 89 c7             	mov    %rax,%rdi
+  802ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acd:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802ad4:	00 00 00 
+  802ad7:	41 ff d0             	call   *%r8
+    return;
+  802ada:	90                   	nop
+  }
+}
+  802adb:	c9                   	leave
+  802adc:	c3                   	ret
+
+0000000000802add <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802add:	55                   	push   %rbp
+  802ade:	48 89 e5             	mov    %rsp,%rbp
+  802ae1:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ae8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802aec:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802af3:	01 00 00 
+  802af6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802afa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802afe:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802b07:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  802b0e:	00 00 00 
+  802b11:	ff d0                	call   *%rax
+  802b13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802b16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b1a:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b1e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802b22:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802b29:	01 00 00 
+  802b2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b30:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b34:	25 00 04 00 00       	and    $0x400,%eax
+  802b39:	48 85 c0             	test   %rax,%rax
+  802b3c:	74 7b                	je     802bb9 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802b3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b42:	89 c1                	mov    %eax,%ecx
+  802b44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b48:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b4c:	48 89 c2             	mov    %rax,%rdx
+  802b4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b53:	48 c1 e0 0c          	shl    $0xc,%rax
+  802b57:	48 89 c6             	mov    %rax,%rsi
+  802b5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b5d:	41 89 c8             	mov    %ecx,%r8d
+  802b60:	48 89 d1             	mov    %rdx,%rcx
+  802b63:	89 c2                	mov    %eax,%edx
+  802b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6a:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802b71:	00 00 00 
+  802b74:	ff d0                	call   *%rax
+  802b76:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b7d:	0f 89 da 00 00 00    	jns    802c5d <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802b83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b86:	89 c1                	mov    %eax,%ecx
+  802b88:	48 b8 90 6a 80 00 00 	movabs $0x806a90,%rax
+  802b8f:	00 00 00 
+  802b92:	48 89 c2             	mov    %rax,%rdx
+  802b95:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802b9a:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802ba1:	00 00 00 
+  802ba4:	48 89 c7             	mov    %rax,%rdi
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802bb3:	00 00 00 
+  802bb6:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802bb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bbd:	25 02 08 00 00       	and    $0x802,%eax
+  802bc2:	48 85 c0             	test   %rax,%rax
+  802bc5:	74 6e                	je     802c35 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802bc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bcb:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802bd1:	80 cc 08             	or     $0x8,%ah
+  802bd4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802bd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bdc:	89 c7                	mov    %eax,%edi
+  802bde:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802be2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802be5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802be9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bec:	41 89 f8             	mov    %edi,%r8d
+  802bef:	89 c7                	mov    %eax,%edi
+  802bf1:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802bf8:	00 00 00 
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802c04:	79 05                	jns    802c0b <duppage+0x12e>
+      return r;
+  802c06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c09:	eb 55                	jmp    802c60 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802c0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c0f:	89 c7                	mov    %eax,%edi
+  802c11:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c15:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c18:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802c1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c1f:	41 89 f8             	mov    %edi,%r8d
+  802c22:	89 c7                	mov    %eax,%edi
+  802c24:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802c33:	eb 28                	jmp    802c5d <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802c35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c39:	89 c7                	mov    %eax,%edi
+  802c3b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c3f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c42:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802c46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c49:	41 89 f8             	mov    %edi,%r8d
+  802c4c:	89 c7                	mov    %eax,%edi
+  802c4e:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802c55:	00 00 00 
+  802c58:	ff d0                	call   *%rax
+  802c5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802c5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+0000000000802c62 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802c62:	55                   	push   %rbp
+  802c63:	48 89 e5             	mov    %rsp,%rbp
+  802c66:	48 83 ec 20          	sub    $0x20,%rsp
+  802c6a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c6d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802c71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c75:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c79:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802c7d:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802c84:	01 00 00 
+  802c87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c8f:	25 00 08 00 00       	and    $0x800,%eax
+  802c94:	48 85 c0             	test   %rax,%rax
+  802c97:	74 0d                	je     802ca6 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802c99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c9d:	0f b6 10             	movzbl (%rax),%edx
+  802ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ca4:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802ca6:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802cad:	01 00 00 
+  802cb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cb4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cb8:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cbd:	89 c6                	mov    %eax,%esi
+  802cbf:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802cc3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802cc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cca:	41 89 f0             	mov    %esi,%r8d
+  802ccd:	48 89 c6             	mov    %rax,%rsi
+  802cd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd5:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+}
+  802ce1:	c9                   	leave
+  802ce2:	c3                   	ret
+
+0000000000802ce3 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802ce3:	55                   	push   %rbp
+  802ce4:	48 89 e5             	mov    %rsp,%rbp
+  802ce7:	48 83 ec 40          	sub    $0x40,%rsp
+  802ceb:	89 f8                	mov    %edi,%eax
+  802ced:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802cf0:	48 b8 88 28 80 00 00 	movabs $0x802888,%rax
+  802cf7:	00 00 00 
+  802cfa:	48 89 c7             	mov    %rax,%rdi
+  802cfd:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802d09:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d0e:	cd 30                	int    $0x30
+  802d10:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802d13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802d16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d1d:	79 36                	jns    802d55 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802d1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d22:	89 c1                	mov    %eax,%ecx
+  802d24:	48 b8 bb 6a 80 00 00 	movabs $0x806abb,%rax
+  802d2b:	00 00 00 
+  802d2e:	48 89 c2             	mov    %rax,%rdx
+  802d31:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802d36:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802d3d:	00 00 00 
+  802d40:	48 89 c7             	mov    %rax,%rdi
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d48:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802d4f:	00 00 00 
+  802d52:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802d55:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d59:	75 0a                	jne    802d65 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	e9 d3 02 00 00       	jmp    803038 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802d65:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802d6c:	00 
+  802d6d:	e9 7a 01 00 00       	jmp    802eec <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802d72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d76:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d7a:	48 c1 e8 27          	shr    $0x27,%rax
+  802d7e:	48 89 c2             	mov    %rax,%rdx
+  802d81:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d88:	01 00 00 
+  802d8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d8f:	83 e0 01             	and    $0x1,%eax
+  802d92:	48 85 c0             	test   %rax,%rax
+  802d95:	0f 84 4c 01 00 00    	je     802ee7 <fork_common+0x204>
+  802d9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d9f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802da3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802da7:	48 89 c2             	mov    %rax,%rdx
+  802daa:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802db1:	01 00 00 
+  802db4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802db8:	83 e0 01             	and    $0x1,%eax
+  802dbb:	48 85 c0             	test   %rax,%rax
+  802dbe:	0f 84 23 01 00 00    	je     802ee7 <fork_common+0x204>
+  802dc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dcc:	48 c1 e8 15          	shr    $0x15,%rax
+  802dd0:	48 89 c2             	mov    %rax,%rdx
+  802dd3:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802dda:	01 00 00 
+  802ddd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802de1:	83 e0 01             	and    $0x1,%eax
+  802de4:	48 85 c0             	test   %rax,%rax
+  802de7:	0f 84 fa 00 00 00    	je     802ee7 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802ded:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802df5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dfd:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802e04:	00 00 00 
+  802e07:	48 39 c2             	cmp    %rax,%rdx
+  802e0a:	0f 82 d7 00 00 00    	jb     802ee7 <fork_common+0x204>
+  802e10:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802e17:	00 00 00 
+  802e1a:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802e1e:	0f 84 c3 00 00 00    	je     802ee7 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802e24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e28:	48 89 c7             	mov    %rax,%rdi
+  802e2b:	48 b8 5a 54 80 00 00 	movabs $0x80545a,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+  802e37:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802e3a:	84 c0                	test   %al,%al
+  802e3c:	0f 84 a5 00 00 00    	je     802ee7 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802e42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e46:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e4a:	48 89 c2             	mov    %rax,%rdx
+  802e4d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e54:	01 00 00 
+  802e57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e5b:	83 e0 01             	and    $0x1,%eax
+  802e5e:	48 85 c0             	test   %rax,%rax
+  802e61:	0f 84 80 00 00 00    	je     802ee7 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802e67:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802e6b:	74 4a                	je     802eb7 <fork_common+0x1d4>
+  802e6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e71:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802e78:	00 00 00 
+  802e7b:	48 39 c2             	cmp    %rax,%rdx
+  802e7e:	73 13                	jae    802e93 <fork_common+0x1b0>
+  802e80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e84:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802e8b:	00 00 00 
+  802e8e:	48 39 c2             	cmp    %rax,%rdx
+  802e91:	73 24                	jae    802eb7 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802e93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e97:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e9b:	48 89 c2             	mov    %rax,%rdx
+  802e9e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ea1:	48 89 d6             	mov    %rdx,%rsi
+  802ea4:	89 c7                	mov    %eax,%edi
+  802ea6:	48 b8 62 2c 80 00 00 	movabs $0x802c62,%rax
+  802ead:	00 00 00 
+  802eb0:	ff d0                	call   *%rax
+  802eb2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802eb5:	eb 22                	jmp    802ed9 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  802eb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ebb:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ebf:	48 89 c2             	mov    %rax,%rdx
+  802ec2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ec5:	48 89 d6             	mov    %rdx,%rsi
+  802ec8:	89 c7                	mov    %eax,%edi
+  802eca:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+  802ed6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  802ed9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802edd:	79 08                	jns    802ee7 <fork_common+0x204>
+            return r;
+  802edf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ee2:	e9 51 01 00 00       	jmp    803038 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802ee7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  802eec:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  802ef3:	07 
+  802ef4:	0f 86 78 fe ff ff    	jbe    802d72 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  802efa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802f01:	00 00 00 
+  802f04:	8b 40 04             	mov    0x4(%rax),%eax
+  802f07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802f13:	00 00 00 
+  802f16:	48 98                	cltq
+  802f18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802f1f:	48 01 d0             	add    %rdx,%rax
+  802f22:	48 05 00 01 00 00    	add    $0x100,%rax
+  802f28:	48 8b 10             	mov    (%rax),%rdx
+  802f2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f2e:	48 89 d6             	mov    %rdx,%rsi
+  802f31:	89 c7                	mov    %eax,%edi
+  802f33:	48 b8 3e 23 80 00 00 	movabs $0x80233e,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+  802f3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f46:	79 36                	jns    802f7e <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  802f48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f4b:	89 c1                	mov    %eax,%ecx
+  802f4d:	48 b8 d0 6a 80 00 00 	movabs $0x806ad0,%rax
+  802f54:	00 00 00 
+  802f57:	48 89 c2             	mov    %rax,%rdx
+  802f5a:	be be 00 00 00       	mov    $0xbe,%esi
+  802f5f:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802f66:	00 00 00 
+  802f69:	48 89 c7             	mov    %rax,%rdi
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f71:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802f78:	00 00 00 
+  802f7b:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  802f7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f81:	ba 02 00 00 00       	mov    $0x2,%edx
+  802f86:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  802f8d:	00 00 00 
+  802f90:	48 89 ce             	mov    %rcx,%rsi
+  802f93:	89 c7                	mov    %eax,%edi
+  802f95:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  802f9c:	00 00 00 
+  802f9f:	ff d0                	call   *%rax
+  802fa1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fa4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fa8:	79 36                	jns    802fe0 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  802faa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fad:	89 c1                	mov    %eax,%ecx
+  802faf:	48 b8 00 6b 80 00 00 	movabs $0x806b00,%rax
+  802fb6:	00 00 00 
+  802fb9:	48 89 c2             	mov    %rax,%rdx
+  802fbc:	be c1 00 00 00       	mov    $0xc1,%esi
+  802fc1:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  802fc8:	00 00 00 
+  802fcb:	48 89 c7             	mov    %rax,%rdi
+  802fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd3:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  802fda:	00 00 00 
+  802fdd:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  802fe0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fe3:	be 02 00 00 00       	mov    $0x2,%esi
+  802fe8:	89 c7                	mov    %eax,%edi
+  802fea:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+  802ff6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ff9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ffd:	79 36                	jns    803035 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  802fff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803002:	89 c1                	mov    %eax,%ecx
+  803004:	48 b8 20 6b 80 00 00 	movabs $0x806b20,%rax
+  80300b:	00 00 00 
+  80300e:	48 89 c2             	mov    %rax,%rdx
+  803011:	be d4 00 00 00       	mov    $0xd4,%esi
+  803016:	48 b8 06 6a 80 00 00 	movabs $0x806a06,%rax
+  80301d:	00 00 00 
+  803020:	48 89 c7             	mov    %rax,%rdi
+  803023:	b8 00 00 00 00       	mov    $0x0,%eax
+  803028:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  80302f:	00 00 00 
+  803032:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803035:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803038:	c9                   	leave
+  803039:	c3                   	ret
+
+000000000080303a <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80303a:	55                   	push   %rbp
+  80303b:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80303e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803043:	48 b8 e3 2c 80 00 00 	movabs $0x802ce3,%rax
+  80304a:	00 00 00 
+  80304d:	ff d0                	call   *%rax
+}
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803055:	bf 01 00 00 00       	mov    $0x1,%edi
+  80305a:	48 b8 e3 2c 80 00 00 	movabs $0x802ce3,%rax
+  803061:	00 00 00 
+  803064:	ff d0                	call   *%rax
+}
+  803066:	5d                   	pop    %rbp
+  803067:	c3                   	ret
+
+0000000000803068 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803068:	55                   	push   %rbp
+  803069:	48 89 e5             	mov    %rsp,%rbp
+  80306c:	48 83 ec 08          	sub    $0x8,%rsp
+  803070:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803078:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80307f:	ff ff ff 
+  803082:	48 01 d0             	add    %rdx,%rax
+  803085:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803089:	c9                   	leave
+  80308a:	c3                   	ret
+
+000000000080308b <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  80308b:	55                   	push   %rbp
+  80308c:	48 89 e5             	mov    %rsp,%rbp
+  80308f:	48 83 ec 08          	sub    $0x8,%rsp
+  803093:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80309b:	48 89 c7             	mov    %rax,%rdi
+  80309e:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  8030a5:	00 00 00 
+  8030a8:	ff d0                	call   *%rax
+  8030aa:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8030b0:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8030b4:	c9                   	leave
+  8030b5:	c3                   	ret
+
+00000000008030b6 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8030b6:	55                   	push   %rbp
+  8030b7:	48 89 e5             	mov    %rsp,%rbp
+  8030ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8030be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8030c2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8030c9:	e9 ae 00 00 00       	jmp    80317c <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8030ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030d1:	c1 e0 0c             	shl    $0xc,%eax
+  8030d4:	48 98                	cltq
+  8030d6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8030db:	48 01 d0             	add    %rdx,%rax
+  8030de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8030e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e6:	48 c1 e8 27          	shr    $0x27,%rax
+  8030ea:	48 89 c2             	mov    %rax,%rdx
+  8030ed:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8030f4:	01 00 00 
+  8030f7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030fb:	83 e0 01             	and    $0x1,%eax
+  8030fe:	48 85 c0             	test   %rax,%rax
+  803101:	74 63                	je     803166 <fd_alloc+0xb0>
+  803103:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803107:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80310b:	48 89 c2             	mov    %rax,%rdx
+  80310e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803115:	01 00 00 
+  803118:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80311c:	83 e0 01             	and    $0x1,%eax
+  80311f:	48 85 c0             	test   %rax,%rax
+  803122:	74 42                	je     803166 <fd_alloc+0xb0>
+  803124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803128:	48 c1 e8 15          	shr    $0x15,%rax
+  80312c:	48 89 c2             	mov    %rax,%rdx
+  80312f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803136:	01 00 00 
+  803139:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80313d:	83 e0 01             	and    $0x1,%eax
+  803140:	48 85 c0             	test   %rax,%rax
+  803143:	74 21                	je     803166 <fd_alloc+0xb0>
+  803145:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803149:	48 c1 e8 0c          	shr    $0xc,%rax
+  80314d:	48 89 c2             	mov    %rax,%rdx
+  803150:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803157:	01 00 00 
+  80315a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80315e:	83 e0 01             	and    $0x1,%eax
+  803161:	48 85 c0             	test   %rax,%rax
+  803164:	75 12                	jne    803178 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80316a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80316e:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  803171:	b8 00 00 00 00       	mov    $0x0,%eax
+  803176:	eb 1e                	jmp    803196 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803178:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80317c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803180:	0f 8e 48 ff ff ff    	jle    8030ce <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803186:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80318a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803191:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803196:	c9                   	leave
+  803197:	c3                   	ret
+
+0000000000803198 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803198:	55                   	push   %rbp
+  803199:	48 89 e5             	mov    %rsp,%rbp
+  80319c:	48 83 ec 20          	sub    $0x20,%rsp
+  8031a0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8031a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031ab:	78 06                	js     8031b3 <fd_lookup+0x1b>
+  8031ad:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8031b1:	7e 0a                	jle    8031bd <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8031b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031b8:	e9 af 00 00 00       	jmp    80326c <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8031bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031c0:	c1 e0 0c             	shl    $0xc,%eax
+  8031c3:	48 98                	cltq
+  8031c5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8031ca:	48 01 d0             	add    %rdx,%rax
+  8031cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8031d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031d5:	48 c1 e8 27          	shr    $0x27,%rax
+  8031d9:	48 89 c2             	mov    %rax,%rdx
+  8031dc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8031e3:	01 00 00 
+  8031e6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031ea:	83 e0 01             	and    $0x1,%eax
+  8031ed:	48 85 c0             	test   %rax,%rax
+  8031f0:	74 63                	je     803255 <fd_lookup+0xbd>
+  8031f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031fa:	48 89 c2             	mov    %rax,%rdx
+  8031fd:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803204:	01 00 00 
+  803207:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80320b:	83 e0 01             	and    $0x1,%eax
+  80320e:	48 85 c0             	test   %rax,%rax
+  803211:	74 42                	je     803255 <fd_lookup+0xbd>
+  803213:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803217:	48 c1 e8 15          	shr    $0x15,%rax
+  80321b:	48 89 c2             	mov    %rax,%rdx
+  80321e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803225:	01 00 00 
+  803228:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80322c:	83 e0 01             	and    $0x1,%eax
+  80322f:	48 85 c0             	test   %rax,%rax
+  803232:	74 21                	je     803255 <fd_lookup+0xbd>
+  803234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803238:	48 c1 e8 0c          	shr    $0xc,%rax
+  80323c:	48 89 c2             	mov    %rax,%rdx
+  80323f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803246:	01 00 00 
+  803249:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80324d:	83 e0 01             	and    $0x1,%eax
+  803250:	48 85 c0             	test   %rax,%rax
+  803253:	75 07                	jne    80325c <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803255:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80325a:	eb 10                	jmp    80326c <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80325c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803260:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803264:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80326c:	c9                   	leave
+  80326d:	c3                   	ret
+
+000000000080326e <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80326e:	55                   	push   %rbp
+  80326f:	48 89 e5             	mov    %rsp,%rbp
+  803272:	48 83 ec 30          	sub    $0x30,%rsp
+  803276:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80327a:	89 f0                	mov    %esi,%eax
+  80327c:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80327f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803283:	48 89 c7             	mov    %rax,%rdi
+  803286:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  80328d:	00 00 00 
+  803290:	ff d0                	call   *%rax
+  803292:	89 c2                	mov    %eax,%edx
+  803294:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803298:	48 89 c6             	mov    %rax,%rsi
+  80329b:	89 d7                	mov    %edx,%edi
+  80329d:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032b0:	78 0a                	js     8032bc <fd_close+0x4e>
+  8032b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8032ba:	74 12                	je     8032ce <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8032bc:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8032c0:	74 05                	je     8032c7 <fd_close+0x59>
+  8032c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032c5:	eb 70                	jmp    803337 <fd_close+0xc9>
+  8032c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cc:	eb 69                	jmp    803337 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8032ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032d2:	8b 00                	mov    (%rax),%eax
+  8032d4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8032d8:	48 89 d6             	mov    %rdx,%rsi
+  8032db:	89 c7                	mov    %eax,%edi
+  8032dd:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032f0:	78 2a                	js     80331c <fd_close+0xae>
+    if (dev->dev_close)
+  8032f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8032fa:	48 85 c0             	test   %rax,%rax
+  8032fd:	74 16                	je     803315 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8032ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803303:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803307:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80330b:	48 89 c7             	mov    %rax,%rdi
+  80330e:	ff d2                	call   *%rdx
+  803310:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803313:	eb 07                	jmp    80331c <fd_close+0xae>
+    else
+      r = 0;
+  803315:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80331c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803320:	48 89 c6             	mov    %rax,%rsi
+  803323:	bf 00 00 00 00       	mov    $0x0,%edi
+  803328:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  80332f:	00 00 00 
+  803332:	ff d0                	call   *%rax
+  return r;
+  803334:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+0000000000803339 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803339:	55                   	push   %rbp
+  80333a:	48 89 e5             	mov    %rsp,%rbp
+  80333d:	48 83 ec 20          	sub    $0x20,%rsp
+  803341:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803344:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803348:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80334f:	eb 3f                	jmp    803390 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803351:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803358:	00 00 00 
+  80335b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80335e:	48 98                	cltq
+  803360:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803364:	8b 00                	mov    (%rax),%eax
+  803366:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803369:	75 21                	jne    80338c <dev_lookup+0x53>
+      *dev = devtab[i];
+  80336b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803372:	00 00 00 
+  803375:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803378:	48 98                	cltq
+  80337a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80337e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803382:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338a:	eb 7f                	jmp    80340b <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80338c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803390:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803397:	00 00 00 
+  80339a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80339d:	48 98                	cltq
+  80339f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8033a3:	48 85 c0             	test   %rax,%rax
+  8033a6:	75 a9                	jne    803351 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8033a8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033af:	00 00 00 
+  8033b2:	8b 40 04             	mov    0x4(%rax),%eax
+  8033b5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033ba:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033c1:	00 00 00 
+  8033c4:	48 98                	cltq
+  8033c6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033cd:	48 01 d0             	add    %rdx,%rax
+  8033d0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033d6:	8b 00                	mov    (%rax),%eax
+  8033d8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033db:	89 c6                	mov    %eax,%esi
+  8033dd:	48 b8 48 6b 80 00 00 	movabs $0x806b48,%rax
+  8033e4:	00 00 00 
+  8033e7:	48 89 c7             	mov    %rax,%rdi
+  8033ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ef:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  8033f6:	00 00 00 
+  8033f9:	ff d1                	call   *%rcx
+  *dev = 0;
+  8033fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033ff:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803406:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80340b:	c9                   	leave
+  80340c:	c3                   	ret
+
+000000000080340d <close>:
+
+int
+close(int fdnum) {
+  80340d:	55                   	push   %rbp
+  80340e:	48 89 e5             	mov    %rsp,%rbp
+  803411:	48 83 ec 20          	sub    $0x20,%rsp
+  803415:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803418:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80341c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80341f:	48 89 d6             	mov    %rdx,%rsi
+  803422:	89 c7                	mov    %eax,%edi
+  803424:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  80342b:	00 00 00 
+  80342e:	ff d0                	call   *%rax
+  803430:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803433:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803437:	79 05                	jns    80343e <close+0x31>
+    return r;
+  803439:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80343c:	eb 18                	jmp    803456 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80343e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803442:	be 01 00 00 00       	mov    $0x1,%esi
+  803447:	48 89 c7             	mov    %rax,%rdi
+  80344a:	48 b8 6e 32 80 00 00 	movabs $0x80326e,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+}
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+
+0000000000803458 <close_all>:
+
+void
+close_all(void) {
+  803458:	55                   	push   %rbp
+  803459:	48 89 e5             	mov    %rsp,%rbp
+  80345c:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803460:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803467:	eb 15                	jmp    80347e <close_all+0x26>
+    close(i);
+  803469:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80346c:	89 c7                	mov    %eax,%edi
+  80346e:	48 b8 0d 34 80 00 00 	movabs $0x80340d,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  80347a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80347e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803482:	7e e5                	jle    803469 <close_all+0x11>
+}
+  803484:	90                   	nop
+  803485:	90                   	nop
+  803486:	c9                   	leave
+  803487:	c3                   	ret
+
+0000000000803488 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803488:	55                   	push   %rbp
+  803489:	48 89 e5             	mov    %rsp,%rbp
+  80348c:	48 83 ec 40          	sub    $0x40,%rsp
+  803490:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803493:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803496:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80349a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80349d:	48 89 d6             	mov    %rdx,%rsi
+  8034a0:	89 c7                	mov    %eax,%edi
+  8034a2:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  8034a9:	00 00 00 
+  8034ac:	ff d0                	call   *%rax
+  8034ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034b5:	79 08                	jns    8034bf <dup+0x37>
+    return r;
+  8034b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034ba:	e9 33 02 00 00       	jmp    8036f2 <dup+0x26a>
+  close(newfdnum);
+  8034bf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8034c2:	89 c7                	mov    %eax,%edi
+  8034c4:	48 b8 0d 34 80 00 00 	movabs $0x80340d,%rax
+  8034cb:	00 00 00 
+  8034ce:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8034d0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8034d3:	c1 e0 0c             	shl    $0xc,%eax
+  8034d6:	48 98                	cltq
+  8034d8:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8034dd:	48 01 d0             	add    %rdx,%rax
+  8034e0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8034e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034e8:	48 89 c7             	mov    %rax,%rdi
+  8034eb:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  8034f2:	00 00 00 
+  8034f5:	ff d0                	call   *%rax
+  8034f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8034fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ff:	48 89 c7             	mov    %rax,%rdi
+  803502:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  803509:	00 00 00 
+  80350c:	ff d0                	call   *%rax
+  80350e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803512:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803519:	00 
+  80351a:	e9 19 01 00 00       	jmp    803638 <dup+0x1b0>
+    off -= PGSIZE;
+  80351f:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803526:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803527:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80352b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80352f:	48 01 d0             	add    %rdx,%rax
+  803532:	48 c1 e8 27          	shr    $0x27,%rax
+  803536:	48 89 c2             	mov    %rax,%rdx
+  803539:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803540:	01 00 00 
+  803543:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803547:	83 e0 01             	and    $0x1,%eax
+  80354a:	48 85 c0             	test   %rax,%rax
+  80354d:	0f 84 e5 00 00 00    	je     803638 <dup+0x1b0>
+  803553:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803557:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80355b:	48 01 d0             	add    %rdx,%rax
+  80355e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803562:	48 89 c2             	mov    %rax,%rdx
+  803565:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80356c:	01 00 00 
+  80356f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803573:	83 e0 01             	and    $0x1,%eax
+  803576:	48 85 c0             	test   %rax,%rax
+  803579:	0f 84 b9 00 00 00    	je     803638 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80357f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803583:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803587:	48 01 d0             	add    %rdx,%rax
+  80358a:	48 c1 e8 15          	shr    $0x15,%rax
+  80358e:	48 89 c2             	mov    %rax,%rdx
+  803591:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803598:	01 00 00 
+  80359b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80359f:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8035a2:	48 85 c0             	test   %rax,%rax
+  8035a5:	0f 84 8d 00 00 00    	je     803638 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8035ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035b3:	48 01 d0             	add    %rdx,%rax
+  8035b6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035ba:	48 89 c2             	mov    %rax,%rdx
+  8035bd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8035c4:	01 00 00 
+  8035c7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035cb:	83 e0 01             	and    $0x1,%eax
+  8035ce:	48 85 c0             	test   %rax,%rax
+  8035d1:	74 65                	je     803638 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8035d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035db:	48 01 d0             	add    %rdx,%rax
+  8035de:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035e2:	48 89 c2             	mov    %rax,%rdx
+  8035e5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8035ec:	01 00 00 
+  8035ef:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035f3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8035f8:	89 c6                	mov    %eax,%esi
+  8035fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8035fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803602:	48 01 c2             	add    %rax,%rdx
+  803605:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803609:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80360d:	48 01 c8             	add    %rcx,%rax
+  803610:	41 89 f0             	mov    %esi,%r8d
+  803613:	48 89 d1             	mov    %rdx,%rcx
+  803616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80361b:	48 89 c6             	mov    %rax,%rsi
+  80361e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803623:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803632:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803636:	78 60                	js     803698 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803638:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80363d:	0f 85 dc fe ff ff    	jne    80351f <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803643:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803647:	48 c1 e8 0c          	shr    $0xc,%rax
+  80364b:	48 89 c2             	mov    %rax,%rdx
+  80364e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803655:	01 00 00 
+  803658:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80365c:	25 07 0e 00 00       	and    $0xe07,%eax
+  803661:	89 c1                	mov    %eax,%ecx
+  803663:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803667:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80366b:	41 89 c8             	mov    %ecx,%r8d
+  80366e:	48 89 d1             	mov    %rdx,%rcx
+  803671:	ba 00 00 00 00       	mov    $0x0,%edx
+  803676:	48 89 c6             	mov    %rax,%rsi
+  803679:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367e:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  803685:	00 00 00 
+  803688:	ff d0                	call   *%rax
+  80368a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80368d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803691:	78 08                	js     80369b <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803693:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803696:	eb 5a                	jmp    8036f2 <dup+0x26a>
+        goto err;
+  803698:	90                   	nop
+  803699:	eb 01                	jmp    80369c <dup+0x214>
+    goto err;
+  80369b:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80369c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036a0:	48 89 c6             	mov    %rax,%rsi
+  8036a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a8:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8036af:	00 00 00 
+  8036b2:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8036b4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8036bb:	00 
+  8036bc:	eb 27                	jmp    8036e5 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8036be:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8036c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036c6:	48 01 d0             	add    %rdx,%rax
+  8036c9:	48 89 c6             	mov    %rax,%rsi
+  8036cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036d1:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8036d8:	00 00 00 
+  8036db:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8036dd:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8036e4:	00 
+  8036e5:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8036ec:	00 
+  8036ed:	76 cf                	jbe    8036be <dup+0x236>
+  return r;
+  8036ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8036f2:	c9                   	leave
+  8036f3:	c3                   	ret
+
+00000000008036f4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8036f4:	55                   	push   %rbp
+  8036f5:	48 89 e5             	mov    %rsp,%rbp
+  8036f8:	48 83 ec 40          	sub    $0x40,%rsp
+  8036fc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036ff:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803703:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803707:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80370b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80370e:	48 89 d6             	mov    %rdx,%rsi
+  803711:	89 c7                	mov    %eax,%edi
+  803713:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+  80371f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803722:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803726:	78 24                	js     80374c <read+0x58>
+  803728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80372c:	8b 00                	mov    (%rax),%eax
+  80372e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803732:	48 89 d6             	mov    %rdx,%rsi
+  803735:	89 c7                	mov    %eax,%edi
+  803737:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  80373e:	00 00 00 
+  803741:	ff d0                	call   *%rax
+  803743:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803746:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80374a:	79 0a                	jns    803756 <read+0x62>
+    return r;
+  80374c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80374f:	48 98                	cltq
+  803751:	e9 9e 00 00 00       	jmp    8037f4 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803756:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80375a:	8b 40 08             	mov    0x8(%rax),%eax
+  80375d:	83 e0 03             	and    $0x3,%eax
+  803760:	83 f8 01             	cmp    $0x1,%eax
+  803763:	75 5c                	jne    8037c1 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803765:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80376c:	00 00 00 
+  80376f:	8b 40 04             	mov    0x4(%rax),%eax
+  803772:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803777:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80377e:	00 00 00 
+  803781:	48 98                	cltq
+  803783:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80378a:	48 01 d0             	add    %rdx,%rax
+  80378d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803793:	8b 00                	mov    (%rax),%eax
+  803795:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803798:	89 c6                	mov    %eax,%esi
+  80379a:	48 b8 67 6b 80 00 00 	movabs $0x806b67,%rax
+  8037a1:	00 00 00 
+  8037a4:	48 89 c7             	mov    %rax,%rdi
+  8037a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ac:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  8037b3:	00 00 00 
+  8037b6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8037b8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037bf:	eb 33                	jmp    8037f4 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8037c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8037c9:	48 85 c0             	test   %rax,%rax
+  8037cc:	75 09                	jne    8037d7 <read+0xe3>
+    return -E_NOT_SUPP;
+  8037ce:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8037d5:	eb 1d                	jmp    8037f4 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8037d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037db:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8037df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037e7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8037eb:	48 89 ce             	mov    %rcx,%rsi
+  8037ee:	48 89 c7             	mov    %rax,%rdi
+  8037f1:	41 ff d0             	call   *%r8
+}
+  8037f4:	c9                   	leave
+  8037f5:	c3                   	ret
+
+00000000008037f6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8037f6:	55                   	push   %rbp
+  8037f7:	48 89 e5             	mov    %rsp,%rbp
+  8037fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8037fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803801:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803805:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803809:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803810:	eb 49                	jmp    80385b <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803812:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803815:	48 98                	cltq
+  803817:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80381b:	48 29 c2             	sub    %rax,%rdx
+  80381e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803821:	48 63 c8             	movslq %eax,%rcx
+  803824:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803828:	48 01 c1             	add    %rax,%rcx
+  80382b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80382e:	48 89 ce             	mov    %rcx,%rsi
+  803831:	89 c7                	mov    %eax,%edi
+  803833:	48 b8 f4 36 80 00 00 	movabs $0x8036f4,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+  80383f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803842:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803846:	79 07                	jns    80384f <readn+0x59>
+      return m;
+  803848:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80384b:	48 98                	cltq
+  80384d:	eb 1f                	jmp    80386e <readn+0x78>
+    if (m == 0)
+  80384f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803853:	74 13                	je     803868 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803855:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803858:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80385b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80385e:	48 98                	cltq
+  803860:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803864:	72 ac                	jb     803812 <readn+0x1c>
+  803866:	eb 01                	jmp    803869 <readn+0x73>
+      break;
+  803868:	90                   	nop
+  }
+  return tot;
+  803869:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80386c:	48 98                	cltq
+}
+  80386e:	c9                   	leave
+  80386f:	c3                   	ret
+
+0000000000803870 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803870:	55                   	push   %rbp
+  803871:	48 89 e5             	mov    %rsp,%rbp
+  803874:	48 83 ec 40          	sub    $0x40,%rsp
+  803878:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80387b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80387f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803883:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803887:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80388a:	48 89 d6             	mov    %rdx,%rsi
+  80388d:	89 c7                	mov    %eax,%edi
+  80388f:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  803896:	00 00 00 
+  803899:	ff d0                	call   *%rax
+  80389b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80389e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038a2:	78 24                	js     8038c8 <write+0x58>
+  8038a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a8:	8b 00                	mov    (%rax),%eax
+  8038aa:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038ae:	48 89 d6             	mov    %rdx,%rsi
+  8038b1:	89 c7                	mov    %eax,%edi
+  8038b3:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  8038ba:	00 00 00 
+  8038bd:	ff d0                	call   *%rax
+  8038bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038c6:	79 0a                	jns    8038d2 <write+0x62>
+    return r;
+  8038c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038cb:	48 98                	cltq
+  8038cd:	e9 9d 00 00 00       	jmp    80396f <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038d6:	8b 40 08             	mov    0x8(%rax),%eax
+  8038d9:	83 e0 03             	and    $0x3,%eax
+  8038dc:	85 c0                	test   %eax,%eax
+  8038de:	75 5c                	jne    80393c <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038e0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8038e7:	00 00 00 
+  8038ea:	8b 40 04             	mov    0x4(%rax),%eax
+  8038ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038f2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8038f9:	00 00 00 
+  8038fc:	48 98                	cltq
+  8038fe:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803905:	48 01 d0             	add    %rdx,%rax
+  803908:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80390e:	8b 00                	mov    (%rax),%eax
+  803910:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803913:	89 c6                	mov    %eax,%esi
+  803915:	48 b8 83 6b 80 00 00 	movabs $0x806b83,%rax
+  80391c:	00 00 00 
+  80391f:	48 89 c7             	mov    %rax,%rdi
+  803922:	b8 00 00 00 00       	mov    $0x0,%eax
+  803927:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  80392e:	00 00 00 
+  803931:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803933:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80393a:	eb 33                	jmp    80396f <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80393c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803940:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803944:	48 85 c0             	test   %rax,%rax
+  803947:	75 09                	jne    803952 <write+0xe2>
+    return -E_NOT_SUPP;
+  803949:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803950:	eb 1d                	jmp    80396f <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803952:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803956:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80395a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803962:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803966:	48 89 ce             	mov    %rcx,%rsi
+  803969:	48 89 c7             	mov    %rax,%rdi
+  80396c:	41 ff d0             	call   *%r8
+}
+  80396f:	c9                   	leave
+  803970:	c3                   	ret
+
+0000000000803971 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803971:	55                   	push   %rbp
+  803972:	48 89 e5             	mov    %rsp,%rbp
+  803975:	48 83 ec 18          	sub    $0x18,%rsp
+  803979:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80397c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80397f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803983:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803986:	48 89 d6             	mov    %rdx,%rsi
+  803989:	89 c7                	mov    %eax,%edi
+  80398b:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  803992:	00 00 00 
+  803995:	ff d0                	call   *%rax
+  803997:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80399a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80399e:	79 05                	jns    8039a5 <seek+0x34>
+    return r;
+  8039a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a3:	eb 0f                	jmp    8039b4 <seek+0x43>
+  fd->fd_offset = offset;
+  8039a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039a9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8039ac:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8039af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b4:	c9                   	leave
+  8039b5:	c3                   	ret
+
+00000000008039b6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8039be:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039c1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039c4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039cb:	48 89 d6             	mov    %rdx,%rsi
+  8039ce:	89 c7                	mov    %eax,%edi
+  8039d0:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+  8039dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039e3:	78 24                	js     803a09 <ftruncate+0x53>
+  8039e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039e9:	8b 00                	mov    (%rax),%eax
+  8039eb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039ef:	48 89 d6             	mov    %rdx,%rsi
+  8039f2:	89 c7                	mov    %eax,%edi
+  8039f4:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  8039fb:	00 00 00 
+  8039fe:	ff d0                	call   *%rax
+  803a00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a07:	79 08                	jns    803a11 <ftruncate+0x5b>
+    return r;
+  803a09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a0c:	e9 92 00 00 00       	jmp    803aa3 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a15:	8b 40 08             	mov    0x8(%rax),%eax
+  803a18:	83 e0 03             	and    $0x3,%eax
+  803a1b:	85 c0                	test   %eax,%eax
+  803a1d:	75 5a                	jne    803a79 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803a1f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803a26:	00 00 00 
+  803a29:	8b 40 04             	mov    0x4(%rax),%eax
+  803a2c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a31:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a38:	00 00 00 
+  803a3b:	48 98                	cltq
+  803a3d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a44:	48 01 d0             	add    %rdx,%rax
+  803a47:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a4d:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803a4f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a52:	89 c6                	mov    %eax,%esi
+  803a54:	48 b8 a0 6b 80 00 00 	movabs $0x806ba0,%rax
+  803a5b:	00 00 00 
+  803a5e:	48 89 c7             	mov    %rax,%rdi
+  803a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a66:	48 b9 23 04 80 00 00 	movabs $0x800423,%rcx
+  803a6d:	00 00 00 
+  803a70:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a77:	eb 2a                	jmp    803aa3 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a7d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803a81:	48 85 c0             	test   %rax,%rax
+  803a84:	75 07                	jne    803a8d <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803a86:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803a8b:	eb 16                	jmp    803aa3 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a91:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803a95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a99:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803a9c:	89 d6                	mov    %edx,%esi
+  803a9e:	48 89 c7             	mov    %rax,%rdi
+  803aa1:	ff d1                	call   *%rcx
+}
+  803aa3:	c9                   	leave
+  803aa4:	c3                   	ret
+
+0000000000803aa5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803aa5:	55                   	push   %rbp
+  803aa6:	48 89 e5             	mov    %rsp,%rbp
+  803aa9:	48 83 ec 30          	sub    $0x30,%rsp
+  803aad:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ab0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ab4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ab8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803abb:	48 89 d6             	mov    %rdx,%rsi
+  803abe:	89 c7                	mov    %eax,%edi
+  803ac0:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+  803acc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803acf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ad3:	78 24                	js     803af9 <fstat+0x54>
+  803ad5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ad9:	8b 00                	mov    (%rax),%eax
+  803adb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803adf:	48 89 d6             	mov    %rdx,%rsi
+  803ae2:	89 c7                	mov    %eax,%edi
+  803ae4:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803aeb:	00 00 00 
+  803aee:	ff d0                	call   *%rax
+  803af0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803af3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803af7:	79 05                	jns    803afe <fstat+0x59>
+    return r;
+  803af9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803afc:	eb 5e                	jmp    803b5c <fstat+0xb7>
+  if (!dev->dev_stat)
+  803afe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b02:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803b06:	48 85 c0             	test   %rax,%rax
+  803b09:	75 07                	jne    803b12 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803b0b:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803b10:	eb 4a                	jmp    803b5c <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803b12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b16:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803b19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b1d:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803b24:	00 00 00 
+  stat->st_isdir   = 0;
+  803b27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b2b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803b32:	00 00 00 
+  stat->st_dev     = dev;
+  803b35:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b3d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b48:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b50:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803b54:	48 89 d6             	mov    %rdx,%rsi
+  803b57:	48 89 c7             	mov    %rax,%rdi
+  803b5a:	ff d1                	call   *%rcx
+}
+  803b5c:	c9                   	leave
+  803b5d:	c3                   	ret
+
+0000000000803b5e <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803b5e:	55                   	push   %rbp
+  803b5f:	48 89 e5             	mov    %rsp,%rbp
+  803b62:	48 83 ec 10          	sub    $0x10,%rsp
+  803b66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803b6a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b72:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803b78:	83 f8 20             	cmp    $0x20,%eax
+  803b7b:	75 07                	jne    803b84 <pollwait_key+0x26>
+    return -E_INVAL;
+  803b7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b82:	eb 5f                	jmp    803be3 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803b84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b88:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803b8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b92:	48 63 d2             	movslq %edx,%rdx
+  803b95:	48 c1 e2 04          	shl    $0x4,%rdx
+  803b99:	48 01 c2             	add    %rax,%rdx
+  803b9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba0:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ba7:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803bad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bb1:	8b 00                	mov    (%rax),%eax
+  803bb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bb7:	48 63 c9             	movslq %ecx,%rcx
+  803bba:	48 c1 e1 04          	shl    $0x4,%rcx
+  803bbe:	48 01 ca             	add    %rcx,%rdx
+  803bc1:	48 83 c2 08          	add    $0x8,%rdx
+  803bc5:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803bc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bcb:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803bd1:	8d 50 01             	lea    0x1(%rax),%edx
+  803bd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bd8:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803bde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be3:	c9                   	leave
+  803be4:	c3                   	ret
+
+0000000000803be5 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803be5:	55                   	push   %rbp
+  803be6:	48 89 e5             	mov    %rsp,%rbp
+  803be9:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803bf0:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803bf7:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803bfd:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803c04:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c0b:	00 
+  int i, r, ready, ipc = 0;
+  803c0c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803c13:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803c1a:	00 
+  803c1b:	74 45                	je     803c62 <poll+0x7d>
+  803c1d:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803c24:	ff 
+  803c25:	74 3b                	je     803c62 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803c27:	48 b8 5f 55 80 00 00 	movabs $0x80555f,%rax
+  803c2e:	00 00 00 
+  803c31:	ff d0                	call   *%rax
+  803c33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803c37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c3b:	48 f7 d0             	not    %rax
+  803c3e:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803c45:	73 10                	jae    803c57 <poll+0x72>
+  803c47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c4b:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803c52:	48 01 d0             	add    %rdx,%rax
+  803c55:	eb 07                	jmp    803c5e <poll+0x79>
+  803c57:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803c5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803c62:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803c69:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803c70:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803c77:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803c7e:	e9 46 02 00 00       	jmp    803ec9 <poll+0x2e4>
+      fds[i].revents = 0;
+  803c83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c86:	48 63 d0             	movslq %eax,%rdx
+  803c89:	48 89 d0             	mov    %rdx,%rax
+  803c8c:	48 01 c0             	add    %rax,%rax
+  803c8f:	48 01 d0             	add    %rdx,%rax
+  803c92:	48 c1 e0 02          	shl    $0x2,%rax
+  803c96:	48 89 c2             	mov    %rax,%rdx
+  803c99:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ca0:	48 01 d0             	add    %rdx,%rax
+  803ca3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803caa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cad:	48 63 d0             	movslq %eax,%rdx
+  803cb0:	48 89 d0             	mov    %rdx,%rax
+  803cb3:	48 01 c0             	add    %rax,%rax
+  803cb6:	48 01 d0             	add    %rdx,%rax
+  803cb9:	48 c1 e0 02          	shl    $0x2,%rax
+  803cbd:	48 89 c2             	mov    %rax,%rdx
+  803cc0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cc7:	48 01 d0             	add    %rdx,%rax
+  803cca:	8b 00                	mov    (%rax),%eax
+  803ccc:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803ccf:	75 62                	jne    803d33 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803cd1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cd4:	48 63 d0             	movslq %eax,%rdx
+  803cd7:	48 89 d0             	mov    %rdx,%rax
+  803cda:	48 01 c0             	add    %rax,%rax
+  803cdd:	48 01 d0             	add    %rdx,%rax
+  803ce0:	48 c1 e0 02          	shl    $0x2,%rax
+  803ce4:	48 89 c2             	mov    %rax,%rdx
+  803ce7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cee:	48 01 d0             	add    %rdx,%rax
+  803cf1:	8b 40 04             	mov    0x4(%rax),%eax
+  803cf4:	83 e0 01             	and    $0x1,%eax
+  803cf7:	85 c0                	test   %eax,%eax
+  803cf9:	0f 84 9b 01 00 00    	je     803e9a <poll+0x2b5>
+          fds[i].revents = ipc;
+  803cff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d02:	48 63 d0             	movslq %eax,%rdx
+  803d05:	48 89 d0             	mov    %rdx,%rax
+  803d08:	48 01 c0             	add    %rax,%rax
+  803d0b:	48 01 d0             	add    %rdx,%rax
+  803d0e:	48 c1 e0 02          	shl    $0x2,%rax
+  803d12:	48 89 c2             	mov    %rax,%rdx
+  803d15:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d1c:	48 01 c2             	add    %rax,%rdx
+  803d1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d22:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803d25:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803d28:	83 c8 04             	or     $0x4,%eax
+  803d2b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803d2e:	e9 67 01 00 00       	jmp    803e9a <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803d33:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d36:	48 63 d0             	movslq %eax,%rdx
+  803d39:	48 89 d0             	mov    %rdx,%rax
+  803d3c:	48 01 c0             	add    %rax,%rax
+  803d3f:	48 01 d0             	add    %rdx,%rax
+  803d42:	48 c1 e0 02          	shl    $0x2,%rax
+  803d46:	48 89 c2             	mov    %rax,%rdx
+  803d49:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d50:	48 01 d0             	add    %rdx,%rax
+  803d53:	8b 00                	mov    (%rax),%eax
+  803d55:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803d5c:	48 89 d6             	mov    %rdx,%rsi
+  803d5f:	89 c7                	mov    %eax,%edi
+  803d61:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  803d68:	00 00 00 
+  803d6b:	ff d0                	call   *%rax
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	78 25                	js     803d96 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803d71:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803d78:	8b 00                	mov    (%rax),%eax
+  803d7a:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803d81:	48 89 d6             	mov    %rdx,%rsi
+  803d84:	89 c7                	mov    %eax,%edi
+  803d86:	48 b8 39 33 80 00 00 	movabs $0x803339,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803d92:	85 c0                	test   %eax,%eax
+  803d94:	79 2c                	jns    803dc2 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803d96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d99:	48 63 d0             	movslq %eax,%rdx
+  803d9c:	48 89 d0             	mov    %rdx,%rax
+  803d9f:	48 01 c0             	add    %rax,%rax
+  803da2:	48 01 d0             	add    %rdx,%rax
+  803da5:	48 c1 e0 02          	shl    $0x2,%rax
+  803da9:	48 89 c2             	mov    %rax,%rdx
+  803dac:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803db3:	48 01 d0             	add    %rdx,%rax
+  803db6:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803dbd:	e9 d8 00 00 00       	jmp    803e9a <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803dc2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803dc9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803dcd:	48 85 c0             	test   %rax,%rax
+  803dd0:	74 7d                	je     803e4f <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803dd2:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803dd9:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803ddd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803de0:	48 63 d0             	movslq %eax,%rdx
+  803de3:	48 89 d0             	mov    %rdx,%rax
+  803de6:	48 01 c0             	add    %rax,%rax
+  803de9:	48 01 d0             	add    %rdx,%rax
+  803dec:	48 c1 e0 02          	shl    $0x2,%rax
+  803df0:	48 89 c2             	mov    %rax,%rdx
+  803df3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803dfa:	48 01 d0             	add    %rdx,%rax
+  803dfd:	8b 48 04             	mov    0x4(%rax),%ecx
+  803e00:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803e07:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803e0e:	89 ce                	mov    %ecx,%esi
+  803e10:	48 89 c7             	mov    %rax,%rdi
+  803e13:	41 ff d0             	call   *%r8
+  803e16:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803e19:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803e1d:	79 08                	jns    803e27 <poll+0x242>
+          return r;
+  803e1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e22:	e9 45 01 00 00       	jmp    803f6c <poll+0x387>
+        fds[i].revents = r;
+  803e27:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e2a:	48 63 d0             	movslq %eax,%rdx
+  803e2d:	48 89 d0             	mov    %rdx,%rax
+  803e30:	48 01 c0             	add    %rax,%rax
+  803e33:	48 01 d0             	add    %rdx,%rax
+  803e36:	48 c1 e0 02          	shl    $0x2,%rax
+  803e3a:	48 89 c2             	mov    %rax,%rdx
+  803e3d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e44:	48 01 c2             	add    %rax,%rdx
+  803e47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e4a:	89 42 08             	mov    %eax,0x8(%rdx)
+  803e4d:	eb 4b                	jmp    803e9a <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803e4f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e52:	48 63 d0             	movslq %eax,%rdx
+  803e55:	48 89 d0             	mov    %rdx,%rax
+  803e58:	48 01 c0             	add    %rax,%rax
+  803e5b:	48 01 d0             	add    %rdx,%rax
+  803e5e:	48 c1 e0 02          	shl    $0x2,%rax
+  803e62:	48 89 c2             	mov    %rax,%rdx
+  803e65:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e6c:	48 01 d0             	add    %rdx,%rax
+  803e6f:	8b 48 04             	mov    0x4(%rax),%ecx
+  803e72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e75:	48 63 d0             	movslq %eax,%rdx
+  803e78:	48 89 d0             	mov    %rdx,%rax
+  803e7b:	48 01 c0             	add    %rax,%rax
+  803e7e:	48 01 d0             	add    %rdx,%rax
+  803e81:	48 c1 e0 02          	shl    $0x2,%rax
+  803e85:	48 89 c2             	mov    %rax,%rdx
+  803e88:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e8f:	48 01 d0             	add    %rdx,%rax
+  803e92:	83 e1 03             	and    $0x3,%ecx
+  803e95:	89 ca                	mov    %ecx,%edx
+  803e97:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803e9a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e9d:	48 63 d0             	movslq %eax,%rdx
+  803ea0:	48 89 d0             	mov    %rdx,%rax
+  803ea3:	48 01 c0             	add    %rax,%rax
+  803ea6:	48 01 d0             	add    %rdx,%rax
+  803ea9:	48 c1 e0 02          	shl    $0x2,%rax
+  803ead:	48 89 c2             	mov    %rax,%rdx
+  803eb0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eb7:	48 01 d0             	add    %rdx,%rax
+  803eba:	8b 40 08             	mov    0x8(%rax),%eax
+  803ebd:	85 c0                	test   %eax,%eax
+  803ebf:	74 04                	je     803ec5 <poll+0x2e0>
+        ready++;
+  803ec1:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803ec5:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803ec9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ecc:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803ed2:	0f 8c ab fd ff ff    	jl     803c83 <poll+0x9e>
+    }
+    if (ready)
+  803ed8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803edc:	74 08                	je     803ee6 <poll+0x301>
+      return ready;
+  803ede:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803ee1:	e9 86 00 00 00       	jmp    803f6c <poll+0x387>
+
+    if (deadline) {
+  803ee6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803eeb:	74 30                	je     803f1d <poll+0x338>
+      now     = vsys_clock_ns();
+  803eed:	48 b8 5f 55 80 00 00 	movabs $0x80555f,%rax
+  803ef4:	00 00 00 
+  803ef7:	ff d0                	call   *%rax
+  803ef9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803efd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f01:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803f05:	73 0a                	jae    803f11 <poll+0x32c>
+  803f07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f0b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803f0f:	eb 05                	jmp    803f16 <poll+0x331>
+  803f11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f16:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803f1d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803f20:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803f23:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803f2a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803f31:	48 89 c7             	mov    %rax,%rdi
+  803f34:	48 b8 e9 25 80 00 00 	movabs $0x8025e9,%rax
+  803f3b:	00 00 00 
+  803f3e:	ff d0                	call   *%rax
+  803f40:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803f43:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803f47:	75 07                	jne    803f50 <poll+0x36b>
+      return 0;
+  803f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4e:	eb 1c                	jmp    803f6c <poll+0x387>
+    if (r < 0)
+  803f50:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803f54:	79 05                	jns    803f5b <poll+0x376>
+      return r;
+  803f56:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f59:	eb 11                	jmp    803f6c <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803f5b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f5e:	c1 f8 02             	sar    $0x2,%eax
+  803f61:	83 e0 01             	and    $0x1,%eax
+  803f64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803f67:	e9 f6 fc ff ff       	jmp    803c62 <poll+0x7d>
+  }
+}
+  803f6c:	c9                   	leave
+  803f6d:	c3                   	ret
+
+0000000000803f6e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803f6e:	55                   	push   %rbp
+  803f6f:	48 89 e5             	mov    %rsp,%rbp
+  803f72:	48 83 ec 20          	sub    $0x20,%rsp
+  803f76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803f7a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f82:	be 00 00 00 00       	mov    $0x0,%esi
+  803f87:	48 89 c7             	mov    %rax,%rdi
+  803f8a:	48 b8 5c 40 80 00 00 	movabs $0x80405c,%rax
+  803f91:	00 00 00 
+  803f94:	ff d0                	call   *%rax
+  803f96:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f99:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f9d:	79 05                	jns    803fa4 <stat+0x36>
+    return fd;
+  803f9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fa2:	eb 2f                	jmp    803fd3 <stat+0x65>
+  r = fstat(fd, stat);
+  803fa4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803fa8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fab:	48 89 d6             	mov    %rdx,%rsi
+  803fae:	89 c7                	mov    %eax,%edi
+  803fb0:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803fb7:	00 00 00 
+  803fba:	ff d0                	call   *%rax
+  803fbc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803fbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fc2:	89 c7                	mov    %eax,%edi
+  803fc4:	48 b8 0d 34 80 00 00 	movabs $0x80340d,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+  return r;
+  803fd0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803fd3:	c9                   	leave
+  803fd4:	c3                   	ret
+
+0000000000803fd5 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803fd5:	55                   	push   %rbp
+  803fd6:	48 89 e5             	mov    %rsp,%rbp
+  803fd9:	48 83 ec 10          	sub    $0x10,%rsp
+  803fdd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803fe0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803fe4:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803feb:	00 00 00 
+  803fee:	8b 00                	mov    (%rax),%eax
+  803ff0:	85 c0                	test   %eax,%eax
+  803ff2:	75 1d                	jne    804011 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ff4:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ff9:	48 b8 e0 5c 80 00 00 	movabs $0x805ce0,%rax
+  804000:	00 00 00 
+  804003:	ff d0                	call   *%rax
+  804005:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80400c:	00 00 00 
+  80400f:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804011:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804018:	00 00 00 
+  80401b:	8b 00                	mov    (%rax),%eax
+  80401d:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804020:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804025:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80402c:	00 00 00 
+  80402f:	89 c7                	mov    %eax,%edi
+  804031:	48 b8 33 5c 80 00 00 	movabs $0x805c33,%rax
+  804038:	00 00 00 
+  80403b:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80403d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804041:	ba 00 00 00 00       	mov    $0x0,%edx
+  804046:	48 89 c6             	mov    %rax,%rsi
+  804049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404e:	48 b8 b6 5a 80 00 00 	movabs $0x805ab6,%rax
+  804055:	00 00 00 
+  804058:	ff d0                	call   *%rax
+}
+  80405a:	c9                   	leave
+  80405b:	c3                   	ret
+
+000000000080405c <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80405c:	55                   	push   %rbp
+  80405d:	48 89 e5             	mov    %rsp,%rbp
+  804060:	48 83 ec 20          	sub    $0x20,%rsp
+  804064:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804068:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80406b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80406f:	48 89 c7             	mov    %rax,%rdi
+  804072:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804083:	7e 0a                	jle    80408f <open+0x33>
+    return -E_BAD_PATH;
+  804085:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80408a:	e9 a8 00 00 00       	jmp    804137 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80408f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804093:	48 89 c7             	mov    %rax,%rdi
+  804096:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  80409d:	00 00 00 
+  8040a0:	ff d0                	call   *%rax
+  8040a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a9:	79 08                	jns    8040b3 <open+0x57>
+    return r;
+  8040ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8040ae:	e9 84 00 00 00       	jmp    804137 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8040b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040b7:	48 89 c6             	mov    %rax,%rsi
+  8040ba:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8040c1:	00 00 00 
+  8040c4:	48 89 c7             	mov    %rax,%rdi
+  8040c7:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8040d3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8040da:	00 00 00 
+  8040dd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040e0:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8040e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040ea:	48 89 c6             	mov    %rax,%rsi
+  8040ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  8040f2:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8040f9:	00 00 00 
+  8040fc:	ff d0                	call   *%rax
+  8040fe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804101:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804105:	79 1d                	jns    804124 <open+0xc8>
+    fd_close(fd, 0);
+  804107:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80410b:	be 00 00 00 00       	mov    $0x0,%esi
+  804110:	48 89 c7             	mov    %rax,%rdi
+  804113:	48 b8 6e 32 80 00 00 	movabs $0x80326e,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    return r;
+  80411f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804122:	eb 13                	jmp    804137 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804128:	48 89 c7             	mov    %rax,%rdi
+  80412b:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  804132:	00 00 00 
+  804135:	ff d0                	call   *%rax
+}
+  804137:	c9                   	leave
+  804138:	c3                   	ret
+
+0000000000804139 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804139:	55                   	push   %rbp
+  80413a:	48 89 e5             	mov    %rsp,%rbp
+  80413d:	48 83 ec 10          	sub    $0x10,%rsp
+  804141:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804145:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804149:	8b 40 0c             	mov    0xc(%rax),%eax
+  80414c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804153:	00 00 00 
+  804156:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804158:	be 00 00 00 00       	mov    $0x0,%esi
+  80415d:	bf 06 00 00 00       	mov    $0x6,%edi
+  804162:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  804169:	00 00 00 
+  80416c:	ff d0                	call   *%rax
+}
+  80416e:	c9                   	leave
+  80416f:	c3                   	ret
+
+0000000000804170 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804170:	55                   	push   %rbp
+  804171:	48 89 e5             	mov    %rsp,%rbp
+  804174:	48 83 ec 30          	sub    $0x30,%rsp
+  804178:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80417c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804180:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804184:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804189:	74 07                	je     804192 <devfile_read+0x22>
+  80418b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804190:	75 0a                	jne    80419c <devfile_read+0x2c>
+  return E_INVAL;
+  804192:	b8 03 00 00 00       	mov    $0x3,%eax
+  804197:	e9 b4 00 00 00       	jmp    804250 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80419c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041a3:	00 
+  while (n) {
+  8041a4:	e9 98 00 00 00       	jmp    804241 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8041a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ad:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041b0:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8041b7:	00 00 00 
+  8041ba:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8041bc:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8041c3:	00 00 00 
+  8041c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041ca:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8041ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8041d3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8041d8:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8041df:	00 00 00 
+  8041e2:	ff d0                	call   *%rax
+  8041e4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8041e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8041eb:	7f 13                	jg     804200 <devfile_read+0x90>
+      return res ? res : res0;
+  8041ed:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8041f1:	74 07                	je     8041fa <devfile_read+0x8a>
+  8041f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041f6:	48 98                	cltq
+  8041f8:	eb 56                	jmp    804250 <devfile_read+0xe0>
+  8041fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041fe:	eb 50                	jmp    804250 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804200:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804203:	48 63 d0             	movslq %eax,%rdx
+  804206:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80420a:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804211:	00 00 00 
+  804214:	48 89 ce             	mov    %rcx,%rsi
+  804217:	48 89 c7             	mov    %rax,%rdi
+  80421a:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+
+    buf += res;
+  804226:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804229:	48 98                	cltq
+  80422b:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80422f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804232:	48 98                	cltq
+  804234:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804238:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80423b:	48 98                	cltq
+  80423d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804241:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804246:	0f 85 5d ff ff ff    	jne    8041a9 <devfile_read+0x39>
+  }
+
+  return res0;
+  80424c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804250:	c9                   	leave
+  804251:	c3                   	ret
+
+0000000000804252 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	48 83 ec 50          	sub    $0x50,%rsp
+  80425a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80425e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804262:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804266:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80426b:	74 07                	je     804274 <devfile_write+0x22>
+  80426d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804272:	75 0a                	jne    80427e <devfile_write+0x2c>
+  return E_INVAL;
+  804274:	b8 03 00 00 00       	mov    $0x3,%eax
+  804279:	e9 c9 00 00 00       	jmp    804347 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80427e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804285:	00 
+
+  while (n) {
+  804286:	e9 ad 00 00 00       	jmp    804338 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80428b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80428f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804293:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  80429a:	00 
+  80429b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80429f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a3:	48 39 c2             	cmp    %rax,%rdx
+  8042a6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8042aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8042ae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8042b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042b6:	48 89 c6             	mov    %rax,%rsi
+  8042b9:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8042c0:	00 00 00 
+  8042c3:	48 89 c7             	mov    %rax,%rdi
+  8042c6:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  8042cd:	00 00 00 
+  8042d0:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8042d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042d6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042d9:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8042e0:	00 00 00 
+  8042e3:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8042e5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8042ec:	00 00 00 
+  8042ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8042f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8042fc:	bf 04 00 00 00       	mov    $0x4,%edi
+  804301:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  804308:	00 00 00 
+  80430b:	ff d0                	call   *%rax
+  80430d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804310:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804314:	79 07                	jns    80431d <devfile_write+0xcb>
+      return res;
+  804316:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804319:	48 98                	cltq
+  80431b:	eb 2a                	jmp    804347 <devfile_write+0xf5>
+
+    buf += res;
+  80431d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804320:	48 98                	cltq
+  804322:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804326:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804329:	48 98                	cltq
+  80432b:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80432f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804332:	48 98                	cltq
+  804334:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804338:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80433d:	0f 85 48 ff ff ff    	jne    80428b <devfile_write+0x39>
+  }
+
+  return res0;
+  804343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804347:	c9                   	leave
+  804348:	c3                   	ret
+
+0000000000804349 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804349:	55                   	push   %rbp
+  80434a:	48 89 e5             	mov    %rsp,%rbp
+  80434d:	48 83 ec 20          	sub    $0x20,%rsp
+  804351:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804355:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804360:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804367:	00 00 00 
+  80436a:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80436c:	be 00 00 00 00       	mov    $0x0,%esi
+  804371:	bf 05 00 00 00       	mov    $0x5,%edi
+  804376:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  80437d:	00 00 00 
+  804380:	ff d0                	call   *%rax
+  804382:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804385:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804389:	79 05                	jns    804390 <devfile_stat+0x47>
+    return r;
+  80438b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80438e:	eb 59                	jmp    8043e9 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804390:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804394:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80439b:	00 00 00 
+  80439e:	48 89 d6             	mov    %rdx,%rsi
+  8043a1:	48 89 c7             	mov    %rax,%rdi
+  8043a4:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  8043ab:	00 00 00 
+  8043ae:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8043b0:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8043b7:	00 00 00 
+  8043ba:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8043c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043c4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8043ca:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8043d1:	00 00 00 
+  8043d4:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8043da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043de:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8043e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043e9:	c9                   	leave
+  8043ea:	c3                   	ret
+
+00000000008043eb <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8043eb:	55                   	push   %rbp
+  8043ec:	48 89 e5             	mov    %rsp,%rbp
+  8043ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8043f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8043f7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8043fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043fe:	8b 40 0c             	mov    0xc(%rax),%eax
+  804401:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804408:	00 00 00 
+  80440b:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80440d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804414:	00 00 00 
+  804417:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80441a:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80441d:	be 00 00 00 00       	mov    $0x0,%esi
+  804422:	bf 02 00 00 00       	mov    $0x2,%edi
+  804427:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  80442e:	00 00 00 
+  804431:	ff d0                	call   *%rax
+}
+  804433:	c9                   	leave
+  804434:	c3                   	ret
+
+0000000000804435 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804435:	55                   	push   %rbp
+  804436:	48 89 e5             	mov    %rsp,%rbp
+  804439:	48 83 ec 18          	sub    $0x18,%rsp
+  80443d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804441:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804444:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804448:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80444b:	83 e0 03             	and    $0x3,%eax
+}
+  80444e:	c9                   	leave
+  80444f:	c3                   	ret
+
+0000000000804450 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804450:	55                   	push   %rbp
+  804451:	48 89 e5             	mov    %rsp,%rbp
+  804454:	48 83 ec 10          	sub    $0x10,%rsp
+  804458:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  80445c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804460:	48 89 c7             	mov    %rax,%rdi
+  804463:	48 b8 d2 12 80 00 00 	movabs $0x8012d2,%rax
+  80446a:	00 00 00 
+  80446d:	ff d0                	call   *%rax
+  80446f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804474:	7e 07                	jle    80447d <remove+0x2d>
+    return -E_BAD_PATH;
+  804476:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80447b:	eb 36                	jmp    8044b3 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  80447d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804481:	48 89 c6             	mov    %rax,%rsi
+  804484:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80448b:	00 00 00 
+  80448e:	48 89 c7             	mov    %rax,%rdi
+  804491:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  804498:	00 00 00 
+  80449b:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  80449d:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8044a7:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8044ae:	00 00 00 
+  8044b1:	ff d0                	call   *%rax
+}
+  8044b3:	c9                   	leave
+  8044b4:	c3                   	ret
+
+00000000008044b5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8044b5:	55                   	push   %rbp
+  8044b6:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8044b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8044be:	bf 08 00 00 00       	mov    $0x8,%edi
+  8044c3:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+}
+  8044cf:	5d                   	pop    %rbp
+  8044d0:	c3                   	ret
+
+00000000008044d1 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8044d1:	55                   	push   %rbp
+  8044d2:	48 89 e5             	mov    %rsp,%rbp
+  8044d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8044d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8044dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8044e2:	bf 09 00 00 00       	mov    $0x9,%edi
+  8044e7:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  8044ee:	00 00 00 
+  8044f1:	ff d0                	call   *%rax
+  8044f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044fa:	79 05                	jns    804501 <fs_stats+0x30>
+    return r;
+  8044fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044ff:	eb 2a                	jmp    80452b <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804501:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804505:	ba 68 00 00 00       	mov    $0x68,%edx
+  80450a:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804511:	00 00 00 
+  804514:	48 89 ce             	mov    %rcx,%rsi
+  804517:	48 89 c7             	mov    %rax,%rdi
+  80451a:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  804521:	00 00 00 
+  804524:	ff d0                	call   *%rax
+  return 0;
+  804526:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80452b:	c9                   	leave
+  80452c:	c3                   	ret
+
+000000000080452d <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80452d:	55                   	push   %rbp
+  80452e:	48 89 e5             	mov    %rsp,%rbp
+  804531:	48 83 ec 10          	sub    $0x10,%rsp
+  804535:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804538:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80453f:	00 00 00 
+  804542:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804545:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804547:	be 00 00 00 00       	mov    $0x0,%esi
+  80454c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804551:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  804558:	00 00 00 
+  80455b:	ff d0                	call   *%rax
+}
+  80455d:	c9                   	leave
+  80455e:	c3                   	ret
+
+000000000080455f <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  80455f:	55                   	push   %rbp
+  804560:	48 89 e5             	mov    %rsp,%rbp
+  804563:	48 83 ec 10          	sub    $0x10,%rsp
+  804567:	89 f8                	mov    %edi,%eax
+  804569:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  80456c:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804570:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804577:	00 00 00 
+  80457a:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  80457c:	be 00 00 00 00       	mov    $0x0,%esi
+  804581:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804586:	48 b8 d5 3f 80 00 00 	movabs $0x803fd5,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+}
+  804592:	c9                   	leave
+  804593:	c3                   	ret
+
+0000000000804594 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804594:	55                   	push   %rbp
+  804595:	48 89 e5             	mov    %rsp,%rbp
+  804598:	48 83 ec 10          	sub    $0x10,%rsp
+  80459c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8045a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045a4:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8045a9:	48 89 c7             	mov    %rax,%rdi
+  8045ac:	48 b8 ba 45 80 00 00 	movabs $0x8045ba,%rax
+  8045b3:	00 00 00 
+  8045b6:	ff d0                	call   *%rax
+}
+  8045b8:	c9                   	leave
+  8045b9:	c3                   	ret
+
+00000000008045ba <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8045ba:	55                   	push   %rbp
+  8045bb:	48 89 e5             	mov    %rsp,%rbp
+  8045be:	48 83 ec 50          	sub    $0x50,%rsp
+  8045c2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8045c6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8045ca:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8045d1:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8045d2:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8045d7:	74 0a                	je     8045e3 <pipe_size+0x29>
+  8045d9:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8045e0:	00 
+  8045e1:	76 0a                	jbe    8045ed <pipe_size+0x33>
+    return -E_INVAL;
+  8045e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045e8:	e9 cc 02 00 00       	jmp    8048b9 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8045ed:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8045f1:	48 89 c7             	mov    %rax,%rdi
+  8045f4:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  8045fb:	00 00 00 
+  8045fe:	ff d0                	call   *%rax
+  804600:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804603:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804607:	0f 88 a8 02 00 00    	js     8048b5 <pipe_size+0x2fb>
+  80460d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804611:	ba 07 04 00 00       	mov    $0x407,%edx
+  804616:	48 89 c6             	mov    %rax,%rsi
+  804619:	bf 00 00 00 00       	mov    $0x0,%edi
+  80461e:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  804625:	00 00 00 
+  804628:	ff d0                	call   *%rax
+  80462a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80462d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804631:	0f 88 7e 02 00 00    	js     8048b5 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804637:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80463b:	48 89 c7             	mov    %rax,%rdi
+  80463e:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  804645:	00 00 00 
+  804648:	ff d0                	call   *%rax
+  80464a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80464d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804651:	0f 88 43 02 00 00    	js     80489a <pipe_size+0x2e0>
+  804657:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80465b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804660:	48 89 c6             	mov    %rax,%rsi
+  804663:	bf 00 00 00 00       	mov    $0x0,%edi
+  804668:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80466f:	00 00 00 
+  804672:	ff d0                	call   *%rax
+  804674:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804677:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80467b:	0f 88 19 02 00 00    	js     80489a <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804681:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804685:	48 89 c7             	mov    %rax,%rdi
+  804688:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  80468f:	00 00 00 
+  804692:	ff d0                	call   *%rax
+  804694:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804698:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80469f:	00 
+  8046a0:	e9 a2 00 00 00       	jmp    804747 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8046a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046a9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8046ad:	48 89 c2             	mov    %rax,%rdx
+  8046b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b4:	48 01 d0             	add    %rdx,%rax
+  8046b7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8046bc:	48 89 c6             	mov    %rax,%rsi
+  8046bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c4:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8046cb:	00 00 00 
+  8046ce:	ff d0                	call   *%rax
+  8046d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046d7:	0f 88 37 01 00 00    	js     804814 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8046dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046e1:	48 89 c7             	mov    %rax,%rdi
+  8046e4:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  8046eb:	00 00 00 
+  8046ee:	ff d0                	call   *%rax
+  8046f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8046f4:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8046f8:	48 01 c2             	add    %rax,%rdx
+  8046fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046ff:	48 c1 e0 0c          	shl    $0xc,%rax
+  804703:	48 89 c1             	mov    %rax,%rcx
+  804706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80470a:	48 01 c8             	add    %rcx,%rax
+  80470d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804713:	48 89 d1             	mov    %rdx,%rcx
+  804716:	ba 00 00 00 00       	mov    $0x0,%edx
+  80471b:	48 89 c6             	mov    %rax,%rsi
+  80471e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804723:	48 b8 f9 21 80 00 00 	movabs $0x8021f9,%rax
+  80472a:	00 00 00 
+  80472d:	ff d0                	call   *%rax
+  80472f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804732:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804736:	79 0a                	jns    804742 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804738:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80473d:	e9 d3 00 00 00       	jmp    804815 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804742:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804747:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80474e:	00 
+  80474f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804753:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804757:	48 01 d0             	add    %rdx,%rax
+  80475a:	48 83 c0 1f          	add    $0x1f,%rax
+  80475e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804762:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804766:	ba 00 00 00 00       	mov    $0x0,%edx
+  80476b:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80476f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804773:	48 29 d0             	sub    %rdx,%rax
+  804776:	48 c1 e8 0c          	shr    $0xc,%rax
+  80477a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80477e:	0f 82 21 ff ff ff    	jb     8046a5 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804788:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80478c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804790:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804794:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804798:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80479c:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8047a3:	00 00 00 
+  8047a6:	8b 12                	mov    (%rdx),%edx
+  8047a8:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8047aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047ae:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8047b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047b9:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8047c0:	00 00 00 
+  8047c3:	8b 12                	mov    (%rdx),%edx
+  8047c5:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8047c7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047cb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8047d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047d6:	48 89 c7             	mov    %rax,%rdi
+  8047d9:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  8047e0:	00 00 00 
+  8047e3:	ff d0                	call   *%rax
+  8047e5:	89 c2                	mov    %eax,%edx
+  8047e7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8047eb:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8047ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047f1:	48 89 c7             	mov    %rax,%rdi
+  8047f4:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  8047fb:	00 00 00 
+  8047fe:	ff d0                	call   *%rax
+  804800:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804804:	48 83 c2 04          	add    $0x4,%rdx
+  804808:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80480a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80480f:	e9 a5 00 00 00       	jmp    8048b9 <pipe_size+0x2ff>
+      goto err2;
+  804814:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804815:	eb 58                	jmp    80486f <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80481b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80481f:	48 89 c2             	mov    %rax,%rdx
+  804822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804826:	48 01 d0             	add    %rdx,%rax
+  804829:	48 89 c6             	mov    %rax,%rsi
+  80482c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804831:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  804838:	00 00 00 
+  80483b:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  80483d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804841:	48 89 c7             	mov    %rax,%rdi
+  804844:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  80484b:	00 00 00 
+  80484e:	ff d0                	call   *%rax
+  804850:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804854:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804858:	48 01 d0             	add    %rdx,%rax
+  80485b:	48 89 c6             	mov    %rax,%rsi
+  80485e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804863:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  80486a:	00 00 00 
+  80486d:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80486f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804873:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804877:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  80487b:	48 85 c0             	test   %rax,%rax
+  80487e:	75 97                	jne    804817 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804880:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804884:	48 89 c6             	mov    %rax,%rsi
+  804887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488c:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  804893:	00 00 00 
+  804896:	ff d0                	call   *%rax
+  804898:	eb 01                	jmp    80489b <pipe_size+0x2e1>
+    goto err1;
+  80489a:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80489b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489f:	48 89 c6             	mov    %rax,%rsi
+  8048a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048a7:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8048ae:	00 00 00 
+  8048b1:	ff d0                	call   *%rax
+  8048b3:	eb 01                	jmp    8048b6 <pipe_size+0x2fc>
+    goto err;
+  8048b5:	90                   	nop
+err:
+  return r;
+  8048b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8048b9:	c9                   	leave
+  8048ba:	c3                   	ret
+
+00000000008048bb <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8048bb:	55                   	push   %rbp
+  8048bc:	48 89 e5             	mov    %rsp,%rbp
+  8048bf:	53                   	push   %rbx
+  8048c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8048c4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8048cc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8048d3:	00 00 00 
+  8048d6:	8b 40 04             	mov    0x4(%rax),%eax
+  8048d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8048de:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8048e5:	00 00 00 
+  8048e8:	48 98                	cltq
+  8048ea:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8048f1:	48 01 d0             	add    %rdx,%rax
+  8048f4:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8048fa:	8b 00                	mov    (%rax),%eax
+  8048fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8048ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804903:	48 89 c7             	mov    %rax,%rdi
+  804906:	48 b8 51 5d 80 00 00 	movabs $0x805d51,%rax
+  80490d:	00 00 00 
+  804910:	ff d0                	call   *%rax
+  804912:	89 c3                	mov    %eax,%ebx
+  804914:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804918:	48 89 c7             	mov    %rax,%rdi
+  80491b:	48 b8 51 5d 80 00 00 	movabs $0x805d51,%rax
+  804922:	00 00 00 
+  804925:	ff d0                	call   *%rax
+  804927:	39 c3                	cmp    %eax,%ebx
+  804929:	0f 94 c0             	sete   %al
+  80492c:	0f b6 c0             	movzbl %al,%eax
+  80492f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804932:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804939:	00 00 00 
+  80493c:	8b 40 04             	mov    0x4(%rax),%eax
+  80493f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804944:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80494b:	00 00 00 
+  80494e:	48 98                	cltq
+  804950:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804957:	48 01 d0             	add    %rdx,%rax
+  80495a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804960:	8b 00                	mov    (%rax),%eax
+  804962:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804965:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804968:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80496b:	75 05                	jne    804972 <_pipeisclosed+0xb7>
+      return ret;
+  80496d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804970:	eb 68                	jmp    8049da <_pipeisclosed+0x11f>
+    if (n != nn)
+  804972:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804975:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804978:	0f 84 4e ff ff ff    	je     8048cc <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80497e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804985:	00 00 00 
+  804988:	8b 40 04             	mov    0x4(%rax),%eax
+  80498b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804990:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804997:	00 00 00 
+  80499a:	48 98                	cltq
+  80499c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8049a3:	48 01 d0             	add    %rdx,%rax
+  8049a6:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8049ac:	8b 10                	mov    (%rax),%edx
+  8049ae:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8049b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049b4:	89 c6                	mov    %eax,%esi
+  8049b6:	48 b8 d0 6b 80 00 00 	movabs $0x806bd0,%rax
+  8049bd:	00 00 00 
+  8049c0:	48 89 c7             	mov    %rax,%rdi
+  8049c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049c8:	49 b8 23 04 80 00 00 	movabs $0x800423,%r8
+  8049cf:	00 00 00 
+  8049d2:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8049d5:	e9 f2 fe ff ff       	jmp    8048cc <_pipeisclosed+0x11>
+  }
+}
+  8049da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8049de:	c9                   	leave
+  8049df:	c3                   	ret
+
+00000000008049e0 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8049e0:	55                   	push   %rbp
+  8049e1:	48 89 e5             	mov    %rsp,%rbp
+  8049e4:	48 83 ec 30          	sub    $0x30,%rsp
+  8049e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8049eb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8049ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049f2:	48 89 d6             	mov    %rdx,%rsi
+  8049f5:	89 c7                	mov    %eax,%edi
+  8049f7:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  8049fe:	00 00 00 
+  804a01:	ff d0                	call   *%rax
+  804a03:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a06:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a0a:	79 05                	jns    804a11 <pipeisclosed+0x31>
+    return r;
+  804a0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a0f:	eb 31                	jmp    804a42 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a15:	48 89 c7             	mov    %rax,%rdi
+  804a18:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  804a1f:	00 00 00 
+  804a22:	ff d0                	call   *%rax
+  804a24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804a28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a30:	48 89 d6             	mov    %rdx,%rsi
+  804a33:	48 89 c7             	mov    %rax,%rdi
+  804a36:	48 b8 bb 48 80 00 00 	movabs $0x8048bb,%rax
+  804a3d:	00 00 00 
+  804a40:	ff d0                	call   *%rax
+}
+  804a42:	c9                   	leave
+  804a43:	c3                   	ret
+
+0000000000804a44 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804a44:	55                   	push   %rbp
+  804a45:	48 89 e5             	mov    %rsp,%rbp
+  804a48:	48 83 ec 10          	sub    $0x10,%rsp
+  804a4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804a50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a54:	8b 40 18             	mov    0x18(%rax),%eax
+  804a57:	8d 50 01             	lea    0x1(%rax),%edx
+  804a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a5e:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804a61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a65:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804a68:	85 c0                	test   %eax,%eax
+  804a6a:	74 27                	je     804a93 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a70:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804a77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a7b:	48 83 c0 18          	add    $0x18,%rax
+  804a7f:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804a84:	48 89 c7             	mov    %rax,%rdi
+  804a87:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  804a8e:	00 00 00 
+  804a91:	ff d0                	call   *%rax
+  }
+}
+  804a93:	90                   	nop
+  804a94:	c9                   	leave
+  804a95:	c3                   	ret
+
+0000000000804a96 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804a96:	55                   	push   %rbp
+  804a97:	48 89 e5             	mov    %rsp,%rbp
+  804a9a:	48 83 ec 10          	sub    $0x10,%rsp
+  804a9e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804aa2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804aa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804aa9:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ab4:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804ab8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804abb:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804ac2:	89 c6                	mov    %eax,%esi
+  804ac4:	48 89 cf             	mov    %rcx,%rdi
+  804ac7:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  804ace:	00 00 00 
+  804ad1:	ff d0                	call   *%rax
+}
+  804ad3:	90                   	nop
+  804ad4:	c9                   	leave
+  804ad5:	c3                   	ret
+
+0000000000804ad6 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804ad6:	55                   	push   %rbp
+  804ad7:	48 89 e5             	mov    %rsp,%rbp
+  804ada:	48 83 ec 70          	sub    $0x70,%rsp
+  804ade:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804ae2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804ae6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804aea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804aee:	48 89 c7             	mov    %rax,%rdi
+  804af1:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  804af8:	00 00 00 
+  804afb:	ff d0                	call   *%rax
+  804afd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804b01:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804b06:	75 0a                	jne    804b12 <devpipe_read+0x3c>
+    return 0;
+  804b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b0d:	e9 63 01 00 00       	jmp    804c75 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b16:	8b 40 18             	mov    0x18(%rax),%eax
+  804b19:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804b1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b20:	48 8b 10             	mov    (%rax),%rdx
+  804b23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b27:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b2b:	48 39 c2             	cmp    %rax,%rdx
+  804b2e:	75 42                	jne    804b72 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804b30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804b34:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804b38:	48 89 d6             	mov    %rdx,%rsi
+  804b3b:	48 89 c7             	mov    %rax,%rdi
+  804b3e:	48 b8 bb 48 80 00 00 	movabs $0x8048bb,%rax
+  804b45:	00 00 00 
+  804b48:	ff d0                	call   *%rax
+  804b4a:	85 c0                	test   %eax,%eax
+  804b4c:	74 0a                	je     804b58 <devpipe_read+0x82>
+      return 0;
+  804b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b53:	e9 1d 01 00 00       	jmp    804c75 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804b58:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b5f:	89 d6                	mov    %edx,%esi
+  804b61:	48 89 c7             	mov    %rax,%rdi
+  804b64:	48 b8 96 4a 80 00 00 	movabs $0x804a96,%rax
+  804b6b:	00 00 00 
+  804b6e:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804b70:	eb a0                	jmp    804b12 <devpipe_read+0x3c>
+      break;
+  804b72:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804b73:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804b77:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804b7b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804b7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804b83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b87:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804b8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b8f:	48 8b 00             	mov    (%rax),%rax
+  804b92:	48 29 c2             	sub    %rax,%rdx
+  804b95:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804b99:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba1:	48 39 c2             	cmp    %rax,%rdx
+  804ba4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ba8:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804bac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bb0:	48 8b 00             	mov    (%rax),%rax
+  804bb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804bb7:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804bbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc0:	48 f7 f1             	div    %rcx
+  804bc3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804bc7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804bcb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804bcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bd3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804bd7:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804bdf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804be3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804be7:	48 39 c2             	cmp    %rax,%rdx
+  804bea:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804bee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804bf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bf6:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804bfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bfe:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804c02:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c0a:	48 89 ce             	mov    %rcx,%rsi
+  804c0d:	48 89 c7             	mov    %rax,%rdi
+  804c10:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  804c17:	00 00 00 
+  804c1a:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804c1c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804c20:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804c24:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c28:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804c2c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804c30:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c34:	48 01 d1             	add    %rdx,%rcx
+  804c37:	48 89 c2             	mov    %rax,%rdx
+  804c3a:	48 89 cf             	mov    %rcx,%rdi
+  804c3d:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  804c44:	00 00 00 
+  804c47:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804c49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c4d:	48 8b 10             	mov    (%rax),%rdx
+  804c50:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804c54:	48 01 c2             	add    %rax,%rdx
+  804c57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c5b:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804c5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c62:	48 89 c7             	mov    %rax,%rdi
+  804c65:	48 b8 44 4a 80 00 00 	movabs $0x804a44,%rax
+  804c6c:	00 00 00 
+  804c6f:	ff d0                	call   *%rax
+  return n;
+  804c71:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804c75:	c9                   	leave
+  804c76:	c3                   	ret
+
+0000000000804c77 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804c77:	55                   	push   %rbp
+  804c78:	48 89 e5             	mov    %rsp,%rbp
+  804c7b:	48 83 ec 70          	sub    $0x70,%rsp
+  804c7f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804c83:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804c87:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804c8b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c8f:	48 89 c7             	mov    %rax,%rdi
+  804c92:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  804c99:	00 00 00 
+  804c9c:	ff d0                	call   *%rax
+  804c9e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804ca2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ca6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804caa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804cb1:	00 
+  804cb2:	e9 b8 01 00 00       	jmp    804e6f <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804cb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cbb:	8b 40 18             	mov    0x18(%rax),%eax
+  804cbe:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cc5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804cc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ccd:	48 8b 00             	mov    (%rax),%rax
+  804cd0:	48 29 c2             	sub    %rax,%rdx
+  804cd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804cdb:	48 39 c2             	cmp    %rax,%rdx
+  804cde:	75 4d                	jne    804d2d <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804ce0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ce4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ce8:	48 89 d6             	mov    %rdx,%rsi
+  804ceb:	48 89 c7             	mov    %rax,%rdi
+  804cee:	48 b8 bb 48 80 00 00 	movabs $0x8048bb,%rax
+  804cf5:	00 00 00 
+  804cf8:	ff d0                	call   *%rax
+  804cfa:	85 c0                	test   %eax,%eax
+  804cfc:	74 0a                	je     804d08 <devpipe_write+0x91>
+        return 0;
+  804cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d03:	e9 79 01 00 00       	jmp    804e81 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804d08:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0f:	89 d6                	mov    %edx,%esi
+  804d11:	48 89 c7             	mov    %rax,%rdi
+  804d14:	48 b8 96 4a 80 00 00 	movabs $0x804a96,%rax
+  804d1b:	00 00 00 
+  804d1e:	ff d0                	call   *%rax
+      m = 0;
+  804d20:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804d27:	00 
+      continue;
+  804d28:	e9 3a 01 00 00       	jmp    804e67 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804d2d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d31:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804d35:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804d39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d45:	48 8b 08             	mov    (%rax),%rcx
+  804d48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d50:	48 29 c1             	sub    %rax,%rcx
+  804d53:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804d57:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d5b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804d5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d63:	48 39 c2             	cmp    %rax,%rdx
+  804d66:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d6a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804d6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d7a:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d83:	48 f7 f1             	div    %rcx
+  804d86:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804d8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d8e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804d92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d96:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804d9a:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804d9e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804da2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804da6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804daa:	48 39 c2             	cmp    %rax,%rdx
+  804dad:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804db1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804db5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804db9:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804dbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dc1:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804dc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804dc9:	48 01 d1             	add    %rdx,%rcx
+  804dcc:	48 89 c2             	mov    %rax,%rdx
+  804dcf:	48 89 cf             	mov    %rcx,%rdi
+  804dd2:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  804dd9:	00 00 00 
+  804ddc:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804dde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804de2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804de6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804dea:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804dee:	73 4d                	jae    804e3d <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804df0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804df8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804dfc:	48 29 c2             	sub    %rax,%rdx
+  804dff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e03:	48 01 c2             	add    %rax,%rdx
+  804e06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e0a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e0e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804e12:	48 89 c1             	mov    %rax,%rcx
+  804e15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e19:	48 01 c1             	add    %rax,%rcx
+  804e1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e20:	48 01 c1             	add    %rax,%rcx
+  804e23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e27:	48 83 c0 20          	add    $0x20,%rax
+  804e2b:	48 89 ce             	mov    %rcx,%rsi
+  804e2e:	48 89 c7             	mov    %rax,%rdi
+  804e31:	48 b8 1c 1b 80 00 00 	movabs $0x801b1c,%rax
+  804e38:	00 00 00 
+  804e3b:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804e3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e41:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e49:	48 01 c2             	add    %rax,%rdx
+  804e4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e50:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804e54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e58:	48 89 c7             	mov    %rax,%rdi
+  804e5b:	48 b8 44 4a 80 00 00 	movabs $0x804a44,%rax
+  804e62:	00 00 00 
+  804e65:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804e67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e6b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804e6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e73:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804e77:	0f 82 3a fe ff ff    	jb     804cb7 <devpipe_write+0x40>
+  }
+
+  return i;
+  804e7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804e81:	c9                   	leave
+  804e82:	c3                   	ret
+
+0000000000804e83 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804e83:	55                   	push   %rbp
+  804e84:	48 89 e5             	mov    %rsp,%rbp
+  804e87:	48 83 ec 40          	sub    $0x40,%rsp
+  804e8b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804e8f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804e92:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804e96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e9a:	48 89 c7             	mov    %rax,%rdi
+  804e9d:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  804ea4:	00 00 00 
+  804ea7:	ff d0                	call   *%rax
+  804ea9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804ead:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804eb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804eb8:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804ebc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec0:	48 89 d6             	mov    %rdx,%rsi
+  804ec3:	48 89 c7             	mov    %rax,%rdi
+  804ec6:	48 b8 5e 3b 80 00 00 	movabs $0x803b5e,%rax
+  804ecd:	00 00 00 
+  804ed0:	ff d0                	call   *%rax
+  804ed2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ed5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ed9:	79 08                	jns    804ee3 <devpipe_poll+0x60>
+    return r;
+  804edb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ede:	e9 85 00 00 00       	jmp    804f68 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804ee3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804ee6:	83 e0 01             	and    $0x1,%eax
+  804ee9:	85 c0                	test   %eax,%eax
+  804eeb:	74 18                	je     804f05 <devpipe_poll+0x82>
+  804eed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ef1:	48 8b 10             	mov    (%rax),%rdx
+  804ef4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ef8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804efc:	48 39 c2             	cmp    %rax,%rdx
+  804eff:	74 04                	je     804f05 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804f01:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804f05:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804f08:	83 e0 02             	and    $0x2,%eax
+  804f0b:	85 c0                	test   %eax,%eax
+  804f0d:	74 23                	je     804f32 <devpipe_poll+0xaf>
+  804f0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f13:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f1b:	48 8b 00             	mov    (%rax),%rax
+  804f1e:	48 29 c2             	sub    %rax,%rdx
+  804f21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f25:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f29:	48 39 c2             	cmp    %rax,%rdx
+  804f2c:	73 04                	jae    804f32 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804f2e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804f32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804f36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f3a:	48 89 d6             	mov    %rdx,%rsi
+  804f3d:	48 89 c7             	mov    %rax,%rdi
+  804f40:	48 b8 bb 48 80 00 00 	movabs $0x8048bb,%rax
+  804f47:	00 00 00 
+  804f4a:	ff d0                	call   *%rax
+  804f4c:	85 c0                	test   %eax,%eax
+  804f4e:	74 04                	je     804f54 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804f50:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804f54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f58:	75 0b                	jne    804f65 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804f5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f5e:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804f65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804f68:	c9                   	leave
+  804f69:	c3                   	ret
+
+0000000000804f6a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804f6a:	55                   	push   %rbp
+  804f6b:	48 89 e5             	mov    %rsp,%rbp
+  804f6e:	48 83 ec 20          	sub    $0x20,%rsp
+  804f72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804f76:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804f7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7e:	48 89 c7             	mov    %rax,%rdi
+  804f81:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  804f88:	00 00 00 
+  804f8b:	ff d0                	call   *%rax
+  804f8d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804f91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f95:	48 ba 01 6c 80 00 00 	movabs $0x806c01,%rdx
+  804f9c:	00 00 00 
+  804f9f:	48 89 d6             	mov    %rdx,%rsi
+  804fa2:	48 89 c7             	mov    %rax,%rdi
+  804fa5:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  804fac:	00 00 00 
+  804faf:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fb9:	89 c1                	mov    %eax,%ecx
+  804fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fbf:	48 8b 00             	mov    (%rax),%rax
+  804fc2:	89 c2                	mov    %eax,%edx
+  804fc4:	89 c8                	mov    %ecx,%eax
+  804fc6:	29 d0                	sub    %edx,%eax
+  804fc8:	89 c2                	mov    %eax,%edx
+  804fca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fce:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804fd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fd8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804fdf:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804fe2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fe6:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  804fed:	00 00 00 
+  804ff0:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ffc:	c9                   	leave
+  804ffd:	c3                   	ret
+
+0000000000804ffe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804ffe:	55                   	push   %rbp
+  804fff:	48 89 e5             	mov    %rsp,%rbp
+  805002:	48 83 ec 40          	sub    $0x40,%rsp
+  805006:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80500a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80500e:	48 89 c7             	mov    %rax,%rdi
+  805011:	48 b8 8b 30 80 00 00 	movabs $0x80308b,%rax
+  805018:	00 00 00 
+  80501b:	ff d0                	call   *%rax
+  80501d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805021:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805028:	00 
+  805029:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80502d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805035:	48 01 d0             	add    %rdx,%rax
+  805038:	48 83 c0 1f          	add    $0x1f,%rax
+  80503c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805040:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805044:	ba 00 00 00 00       	mov    $0x0,%edx
+  805049:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80504d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805051:	48 29 d0             	sub    %rdx,%rax
+  805054:	48 c1 e8 0c          	shr    $0xc,%rax
+  805058:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80505c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805060:	48 89 c6             	mov    %rax,%rsi
+  805063:	bf 00 00 00 00       	mov    $0x0,%edi
+  805068:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  80506f:	00 00 00 
+  805072:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805074:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805078:	48 89 c7             	mov    %rax,%rdi
+  80507b:	48 b8 44 4a 80 00 00 	movabs $0x804a44,%rax
+  805082:	00 00 00 
+  805085:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805087:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80508b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80508f:	eb 2f                	jmp    8050c0 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805091:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805095:	48 83 e8 01          	sub    $0x1,%rax
+  805099:	48 c1 e0 0c          	shl    $0xc,%rax
+  80509d:	48 89 c2             	mov    %rax,%rdx
+  8050a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050a4:	48 01 d0             	add    %rdx,%rax
+  8050a7:	48 89 c6             	mov    %rax,%rsi
+  8050aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050af:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8050b6:	00 00 00 
+  8050b9:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8050bb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8050c0:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8050c5:	77 ca                	ja     805091 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8050c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050cb:	48 89 c6             	mov    %rax,%rsi
+  8050ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050d3:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  8050da:	00 00 00 
+  8050dd:	ff d0                	call   *%rax
+}
+  8050df:	c9                   	leave
+  8050e0:	c3                   	ret
+
+00000000008050e1 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8050e1:	55                   	push   %rbp
+  8050e2:	48 89 e5             	mov    %rsp,%rbp
+  8050e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8050e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8050ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8050f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050f9:	48 89 c7             	mov    %rax,%rdi
+  8050fc:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8050fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805103:	48 b8 45 53 80 00 00 	movabs $0x805345,%rax
+  80510a:	00 00 00 
+  80510d:	ff d0                	call   *%rax
+}
+  80510f:	90                   	nop
+  805110:	c9                   	leave
+  805111:	c3                   	ret
+
+0000000000805112 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805112:	55                   	push   %rbp
+  805113:	48 89 e5             	mov    %rsp,%rbp
+  805116:	48 83 ec 20          	sub    $0x20,%rsp
+  80511a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  80511d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805120:	c1 e0 10             	shl    $0x10,%eax
+  805123:	48 98                	cltq
+  805125:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  80512a:	48 01 d0             	add    %rdx,%rax
+  80512d:	48 89 c6             	mov    %rax,%rsi
+  805130:	bf 00 00 00 00       	mov    $0x0,%edi
+  805135:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  80513c:	00 00 00 
+  80513f:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805141:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805144:	83 c0 01             	add    $0x1,%eax
+  805147:	c1 e0 10             	shl    $0x10,%eax
+  80514a:	48 98                	cltq
+  80514c:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805151:	48 01 d0             	add    %rdx,%rax
+  805154:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805158:	eb 20                	jmp    80517a <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80515a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80515e:	48 89 c6             	mov    %rax,%rsi
+  805161:	bf 00 00 00 00       	mov    $0x0,%edi
+  805166:	48 b8 59 22 80 00 00 	movabs $0x802259,%rax
+  80516d:	00 00 00 
+  805170:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805172:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805179:	00 
+  80517a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80517d:	83 c0 01             	add    $0x1,%eax
+  805180:	c1 e0 10             	shl    $0x10,%eax
+  805183:	48 98                	cltq
+  805185:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80518a:	48 01 d0             	add    %rdx,%rax
+  80518d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805191:	72 c7                	jb     80515a <slot_unmap+0x48>
+}
+  805193:	90                   	nop
+  805194:	90                   	nop
+  805195:	c9                   	leave
+  805196:	c3                   	ret
+
+0000000000805197 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805197:	55                   	push   %rbp
+  805198:	48 89 e5             	mov    %rsp,%rbp
+  80519b:	48 83 ec 30          	sub    $0x30,%rsp
+  80519f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8051a3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  8051a7:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8051ae:	00 00 00 
+  8051b1:	48 89 c7             	mov    %rax,%rdi
+  8051b4:	48 b8 74 5f 80 00 00 	movabs $0x805f74,%rax
+  8051bb:	00 00 00 
+  8051be:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8051c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8051c7:	eb 04                	jmp    8051cd <thread_create+0x36>
+  8051c9:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8051cd:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8051d1:	7f 16                	jg     8051e9 <thread_create+0x52>
+  8051d3:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8051da:	00 00 00 
+  8051dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8051e0:	48 98                	cltq
+  8051e2:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8051e5:	85 c0                	test   %eax,%eax
+  8051e7:	75 e0                	jne    8051c9 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8051e9:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8051ed:	75 0c                	jne    8051fb <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8051ef:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8051f6:	e9 2c 01 00 00       	jmp    805327 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8051fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8051fe:	c1 e0 10             	shl    $0x10,%eax
+  805201:	48 98                	cltq
+  805203:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805208:	48 01 d0             	add    %rdx,%rax
+  80520b:	ba 07 00 00 00       	mov    $0x7,%edx
+  805210:	48 89 c6             	mov    %rax,%rsi
+  805213:	bf 00 00 00 00       	mov    $0x0,%edi
+  805218:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80521f:	00 00 00 
+  805222:	ff d0                	call   *%rax
+  805224:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805227:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80522b:	0f 88 f5 00 00 00    	js     805326 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805231:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805234:	83 c0 01             	add    $0x1,%eax
+  805237:	c1 e0 10             	shl    $0x10,%eax
+  80523a:	48 98                	cltq
+  80523c:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805241:	48 01 d0             	add    %rdx,%rax
+  805244:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805248:	eb 32                	jmp    80527c <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  80524a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80524e:	ba 07 00 00 00       	mov    $0x7,%edx
+  805253:	48 89 c6             	mov    %rax,%rsi
+  805256:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525b:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  805262:	00 00 00 
+  805265:	ff d0                	call   *%rax
+  805267:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80526a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80526e:	0f 88 9e 00 00 00    	js     805312 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805274:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80527b:	00 
+  80527c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80527f:	83 c0 01             	add    $0x1,%eax
+  805282:	c1 e0 10             	shl    $0x10,%eax
+  805285:	48 98                	cltq
+  805287:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80528c:	48 01 d0             	add    %rdx,%rax
+  80528f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805293:	72 b5                	jb     80524a <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805295:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805299:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80529d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8052a0:	c1 e2 10             	shl    $0x10,%edx
+  8052a3:	48 63 d2             	movslq %edx,%rdx
+  8052a6:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  8052ab:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  8052ae:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  8052b1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8052b4:	83 c2 01             	add    $0x1,%edx
+  8052b7:	c1 e2 10             	shl    $0x10,%edx
+  8052ba:	48 63 d2             	movslq %edx,%rdx
+  8052bd:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8052c2:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  8052c5:	48 bf e1 50 80 00 00 	movabs $0x8050e1,%rdi
+  8052cc:	00 00 00 
+  8052cf:	49 89 c8             	mov    %rcx,%r8
+  8052d2:	48 89 c1             	mov    %rax,%rcx
+  8052d5:	4c 89 ca             	mov    %r9,%rdx
+  8052d8:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  8052df:	00 00 00 
+  8052e2:	ff d0                	call   *%rax
+  8052e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8052e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052eb:	79 08                	jns    8052f5 <thread_create+0x15e>
+    r = id;
+  8052ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052f0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8052f3:	eb 1e                	jmp    805313 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8052f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052f8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8052fb:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  805302:	00 00 00 
+  805305:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805308:	48 98                	cltq
+  80530a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80530d:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805310:	eb 15                	jmp    805327 <thread_create+0x190>
+      goto fail;
+  805312:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805313:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805316:	89 c7                	mov    %eax,%edi
+  805318:	48 b8 12 51 80 00 00 	movabs $0x805112,%rax
+  80531f:	00 00 00 
+  805322:	ff d0                	call   *%rax
+  805324:	eb 01                	jmp    805327 <thread_create+0x190>
+    goto out;
+  805326:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805327:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80532e:	00 00 00 
+  805331:	48 89 c7             	mov    %rax,%rdi
+  805334:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  80533b:	00 00 00 
+  80533e:	ff d0                	call   *%rax
+  return r;
+  805340:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805343:	c9                   	leave
+  805344:	c3                   	ret
+
+0000000000805345 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805345:	55                   	push   %rbp
+  805346:	48 89 e5             	mov    %rsp,%rbp
+  805349:	48 83 ec 10          	sub    $0x10,%rsp
+  80534d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805350:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805353:	89 c7                	mov    %eax,%edi
+  805355:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  80535c:	00 00 00 
+  80535f:	ff d0                	call   *%rax
+}
+  805361:	90                   	nop
+  805362:	c9                   	leave
+  805363:	c3                   	ret
+
+0000000000805364 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805364:	55                   	push   %rbp
+  805365:	48 89 e5             	mov    %rsp,%rbp
+  805368:	48 83 ec 20          	sub    $0x20,%rsp
+  80536c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80536f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805373:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80537a:	00 00 00 
+  80537d:	48 89 c7             	mov    %rax,%rdi
+  805380:	48 b8 74 5f 80 00 00 	movabs $0x805f74,%rax
+  805387:	00 00 00 
+  80538a:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  80538c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805393:	eb 04                	jmp    805399 <thread_join+0x35>
+  805395:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805399:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80539d:	7f 17                	jg     8053b6 <thread_join+0x52>
+  80539f:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8053a6:	00 00 00 
+  8053a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053ac:	48 98                	cltq
+  8053ae:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8053b1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8053b4:	75 df                	jne    805395 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8053b6:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8053bd:	00 00 00 
+  8053c0:	48 89 c7             	mov    %rax,%rdi
+  8053c3:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  8053ca:	00 00 00 
+  8053cd:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8053cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053d3:	74 06                	je     8053db <thread_join+0x77>
+  8053d5:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8053d9:	75 07                	jne    8053e2 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8053db:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8053e0:	eb 76                	jmp    805458 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8053e2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8053e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e9:	48 89 d6             	mov    %rdx,%rsi
+  8053ec:	89 c7                	mov    %eax,%edi
+  8053ee:	48 b8 66 5e 80 00 00 	movabs $0x805e66,%rax
+  8053f5:	00 00 00 
+  8053f8:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8053fa:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805401:	00 00 00 
+  805404:	48 89 c7             	mov    %rax,%rdi
+  805407:	48 b8 74 5f 80 00 00 	movabs $0x805f74,%rax
+  80540e:	00 00 00 
+  805411:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805413:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805416:	89 c7                	mov    %eax,%edi
+  805418:	48 b8 12 51 80 00 00 	movabs $0x805112,%rax
+  80541f:	00 00 00 
+  805422:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805424:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80542b:	00 00 00 
+  80542e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805431:	48 98                	cltq
+  805433:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  80543a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805441:	00 00 00 
+  805444:	48 89 c7             	mov    %rax,%rdi
+  805447:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  80544e:	00 00 00 
+  805451:	ff d0                	call   *%rax
+  return 0;
+  805453:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805458:	c9                   	leave
+  805459:	c3                   	ret
+
+000000000080545a <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  80545a:	55                   	push   %rbp
+  80545b:	48 89 e5             	mov    %rsp,%rbp
+  80545e:	48 83 ec 08          	sub    $0x8,%rsp
+  805462:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805466:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80546b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80546f:	73 23                	jae    805494 <thread_is_uxstack+0x3a>
+  805471:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805476:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80547a:	72 18                	jb     805494 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  80547c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805480:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805485:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80548b:	75 07                	jne    805494 <thread_is_uxstack+0x3a>
+  80548d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805492:	eb 05                	jmp    805499 <thread_is_uxstack+0x3f>
+  805494:	b8 00 00 00 00       	mov    $0x0,%eax
+  805499:	83 e0 01             	and    $0x1,%eax
+}
+  80549c:	c9                   	leave
+  80549d:	c3                   	ret
+
+000000000080549e <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80549e:	55                   	push   %rbp
+  80549f:	48 89 e5             	mov    %rsp,%rbp
+  8054a2:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  8054a6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8054ad:	00 00 00 
+  8054b0:	8b 40 04             	mov    0x4(%rax),%eax
+  8054b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8054b8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8054bf:	00 00 00 
+  8054c2:	48 98                	cltq
+  8054c4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8054cb:	48 01 d0             	add    %rdx,%rax
+  8054ce:	48 05 08 01 00 00    	add    $0x108,%rax
+  8054d4:	48 8b 00             	mov    (%rax),%rax
+  8054d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8054db:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8054e0:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8054e4:	73 0b                	jae    8054f1 <thread_pftemp+0x53>
+  8054e6:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8054eb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8054ef:	73 07                	jae    8054f8 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8054f1:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8054f6:	eb 26                	jmp    80551e <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8054f8:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8054ff:	ff ff ff 
+  805502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805506:	48 01 d0             	add    %rdx,%rax
+  805509:	48 c1 e8 10          	shr    $0x10,%rax
+  80550d:	48 83 c0 01          	add    $0x1,%rax
+  805511:	48 c1 e0 0c          	shl    $0xc,%rax
+  805515:	48 f7 d8             	neg    %rax
+  805518:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  80551e:	c9                   	leave
+  80551f:	c3                   	ret
+
+0000000000805520 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805520:	55                   	push   %rbp
+  805521:	48 89 e5             	mov    %rsp,%rbp
+  805524:	48 83 ec 08          	sub    $0x8,%rsp
+  805528:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80552b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80552f:	75 10                	jne    805541 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805531:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805538:	00 00 00 
+  80553b:	8b 00                	mov    (%rax),%eax
+  80553d:	48 98                	cltq
+  80553f:	eb 05                	jmp    805546 <vsyscall+0x26>
+  }
+  return 0;
+  805541:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805546:	c9                   	leave
+  805547:	c3                   	ret
+
+0000000000805548 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805548:	55                   	push   %rbp
+  805549:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80554c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805551:	48 b8 20 55 80 00 00 	movabs $0x805520,%rax
+  805558:	00 00 00 
+  80555b:	ff d0                	call   *%rax
+}
+  80555d:	5d                   	pop    %rbp
+  80555e:	c3                   	ret
+
+000000000080555f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80555f:	55                   	push   %rbp
+  805560:	48 89 e5             	mov    %rsp,%rbp
+  805563:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805567:	0f 31                	rdtsc
+  805569:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80556c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80556f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805572:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805575:	48 c1 e2 20          	shl    $0x20,%rdx
+  805579:	48 09 d0             	or     %rdx,%rax
+  80557c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805580:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805584:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805588:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80558f:	00 00 00 
+  805592:	8b 40 08             	mov    0x8(%rax),%eax
+  805595:	48 98                	cltq
+  805597:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80559b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80559f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055a4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8055a8:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8055af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055b8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8055bc:	48 89 d0             	mov    %rdx,%rax
+  8055bf:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8055c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055cb:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8055cf:	48 01 c8             	add    %rcx,%rax
+}
+  8055d2:	c9                   	leave
+  8055d3:	c3                   	ret
+
+00000000008055d4 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8055d4:	55                   	push   %rbp
+  8055d5:	48 89 e5             	mov    %rsp,%rbp
+  8055d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8055dc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8055df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055e2:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8055e5:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8055e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8055ee:	48 89 c7             	mov    %rax,%rdi
+  8055f1:	48 b8 8a 1f 80 00 00 	movabs $0x801f8a,%rax
+  8055f8:	00 00 00 
+  8055fb:	ff d0                	call   *%rax
+}
+  8055fd:	90                   	nop
+  8055fe:	c9                   	leave
+  8055ff:	c3                   	ret
+
+0000000000805600 <getchar>:
+
+int
+getchar(void) {
+  805600:	55                   	push   %rbp
+  805601:	48 89 e5             	mov    %rsp,%rbp
+  805604:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805608:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  80560c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805611:	48 89 c6             	mov    %rax,%rsi
+  805614:	bf 00 00 00 00       	mov    $0x0,%edi
+  805619:	48 b8 f4 36 80 00 00 	movabs $0x8036f4,%rax
+  805620:	00 00 00 
+  805623:	ff d0                	call   *%rax
+  805625:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805628:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80562c:	79 05                	jns    805633 <getchar+0x33>
+    return r;
+  80562e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805631:	eb 14                	jmp    805647 <getchar+0x47>
+  if (r < 1)
+  805633:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805637:	7f 07                	jg     805640 <getchar+0x40>
+    return -E_EOF;
+  805639:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80563e:	eb 07                	jmp    805647 <getchar+0x47>
+  return c;
+  805640:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805644:	0f b6 c0             	movzbl %al,%eax
+}
+  805647:	c9                   	leave
+  805648:	c3                   	ret
+
+0000000000805649 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805649:	55                   	push   %rbp
+  80564a:	48 89 e5             	mov    %rsp,%rbp
+  80564d:	48 83 ec 20          	sub    $0x20,%rsp
+  805651:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805654:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805658:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80565b:	48 89 d6             	mov    %rdx,%rsi
+  80565e:	89 c7                	mov    %eax,%edi
+  805660:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  805667:	00 00 00 
+  80566a:	ff d0                	call   *%rax
+  80566c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80566f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805673:	79 05                	jns    80567a <iscons+0x31>
+    return r;
+  805675:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805678:	eb 1a                	jmp    805694 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80567a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80567e:	8b 10                	mov    (%rax),%edx
+  805680:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805687:	00 00 00 
+  80568a:	8b 00                	mov    (%rax),%eax
+  80568c:	39 c2                	cmp    %eax,%edx
+  80568e:	0f 94 c0             	sete   %al
+  805691:	0f b6 c0             	movzbl %al,%eax
+}
+  805694:	c9                   	leave
+  805695:	c3                   	ret
+
+0000000000805696 <opencons>:
+
+int
+opencons(void) {
+  805696:	55                   	push   %rbp
+  805697:	48 89 e5             	mov    %rsp,%rbp
+  80569a:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80569e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8056a2:	48 89 c7             	mov    %rax,%rdi
+  8056a5:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  8056ac:	00 00 00 
+  8056af:	ff d0                	call   *%rax
+  8056b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b8:	79 05                	jns    8056bf <opencons+0x29>
+    return r;
+  8056ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056bd:	eb 66                	jmp    805725 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8056bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056c3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056c8:	48 89 c6             	mov    %rax,%rsi
+  8056cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056d0:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  8056d7:	00 00 00 
+  8056da:	ff d0                	call   *%rax
+  8056dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056e3:	79 05                	jns    8056ea <opencons+0x54>
+    return r;
+  8056e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056e8:	eb 3b                	jmp    805725 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8056ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056ee:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8056f5:	00 00 00 
+  8056f8:	8b 12                	mov    (%rdx),%edx
+  8056fa:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8056fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805700:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80570b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805712:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805716:	48 89 c7             	mov    %rax,%rdi
+  805719:	48 b8 68 30 80 00 00 	movabs $0x803068,%rax
+  805720:	00 00 00 
+  805723:	ff d0                	call   *%rax
+}
+  805725:	c9                   	leave
+  805726:	c3                   	ret
+
+0000000000805727 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805727:	55                   	push   %rbp
+  805728:	48 89 e5             	mov    %rsp,%rbp
+  80572b:	48 83 ec 20          	sub    $0x20,%rsp
+  80572f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805732:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805735:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805739:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80573c:	48 89 d6             	mov    %rdx,%rsi
+  80573f:	89 c7                	mov    %eax,%edi
+  805741:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  805748:	00 00 00 
+  80574b:	ff d0                	call   *%rax
+  80574d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805750:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805754:	79 05                	jns    80575b <consmode+0x34>
+    return r;
+  805756:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805759:	eb 34                	jmp    80578f <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  80575b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80575f:	8b 10                	mov    (%rax),%edx
+  805761:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805768:	00 00 00 
+  80576b:	8b 00                	mov    (%rax),%eax
+  80576d:	39 c2                	cmp    %eax,%edx
+  80576f:	74 07                	je     805778 <consmode+0x51>
+    return -E_INVAL;
+  805771:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805776:	eb 17                	jmp    80578f <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80577c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80577f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805782:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805786:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805789:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80578c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80578f:	c9                   	leave
+  805790:	c3                   	ret
+
+0000000000805791 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805791:	55                   	push   %rbp
+  805792:	48 89 e5             	mov    %rsp,%rbp
+  805795:	48 83 ec 20          	sub    $0x20,%rsp
+  805799:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80579d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8057a1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8057a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057a9:	8b 50 0c             	mov    0xc(%rax),%edx
+  8057ac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8057b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057b4:	48 89 ce             	mov    %rcx,%rsi
+  8057b7:	48 89 c7             	mov    %rax,%rdi
+  8057ba:	48 b8 fb 24 80 00 00 	movabs $0x8024fb,%rax
+  8057c1:	00 00 00 
+  8057c4:	ff d0                	call   *%rax
+  8057c6:	48 98                	cltq
+}
+  8057c8:	c9                   	leave
+  8057c9:	c3                   	ret
+
+00000000008057ca <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8057ca:	55                   	push   %rbp
+  8057cb:	48 89 e5             	mov    %rsp,%rbp
+  8057ce:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8057d5:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8057dc:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8057e3:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8057ea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8057f1:	eb 74                	jmp    805867 <devcons_write+0x9d>
+    m = n - tot;
+  8057f3:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8057fa:	89 c2                	mov    %eax,%edx
+  8057fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057ff:	29 c2                	sub    %eax,%edx
+  805801:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805804:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805807:	83 f8 7f             	cmp    $0x7f,%eax
+  80580a:	76 07                	jbe    805813 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  80580c:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805813:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805816:	48 63 d0             	movslq %eax,%rdx
+  805819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80581c:	48 63 c8             	movslq %eax,%rcx
+  80581f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805826:	48 01 c1             	add    %rax,%rcx
+  805829:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805830:	48 89 ce             	mov    %rcx,%rsi
+  805833:	48 89 c7             	mov    %rax,%rdi
+  805836:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  80583d:	00 00 00 
+  805840:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805842:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805845:	48 63 d0             	movslq %eax,%rdx
+  805848:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80584f:	48 89 d6             	mov    %rdx,%rsi
+  805852:	48 89 c7             	mov    %rax,%rdi
+  805855:	48 b8 8a 1f 80 00 00 	movabs $0x801f8a,%rax
+  80585c:	00 00 00 
+  80585f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805861:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805864:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805867:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80586a:	48 98                	cltq
+  80586c:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805873:	0f 82 7a ff ff ff    	jb     8057f3 <devcons_write+0x29>
+  }
+  return tot;
+  805879:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80587c:	48 98                	cltq
+}
+  80587e:	c9                   	leave
+  80587f:	c3                   	ret
+
+0000000000805880 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805880:	55                   	push   %rbp
+  805881:	48 89 e5             	mov    %rsp,%rbp
+  805884:	48 83 ec 08          	sub    $0x8,%rsp
+  805888:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80588c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805891:	c9                   	leave
+  805892:	c3                   	ret
+
+0000000000805893 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805893:	55                   	push   %rbp
+  805894:	48 89 e5             	mov    %rsp,%rbp
+  805897:	48 83 ec 10          	sub    $0x10,%rsp
+  80589b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80589f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8058a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058a7:	48 ba 0d 6c 80 00 00 	movabs $0x806c0d,%rdx
+  8058ae:	00 00 00 
+  8058b1:	48 89 d6             	mov    %rdx,%rsi
+  8058b4:	48 89 c7             	mov    %rax,%rdi
+  8058b7:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  8058be:	00 00 00 
+  8058c1:	ff d0                	call   *%rax
+  return 0;
+  8058c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058c8:	c9                   	leave
+  8058c9:	c3                   	ret
+
+00000000008058ca <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8058ca:	55                   	push   %rbp
+  8058cb:	48 89 e5             	mov    %rsp,%rbp
+  8058ce:	48 83 ec 30          	sub    $0x30,%rsp
+  8058d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8058d6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8058d9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8058dd:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8058e4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8058e7:	83 e0 02             	and    $0x2,%eax
+  8058ea:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8058ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058f1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8058f4:	83 f8 01             	cmp    $0x1,%eax
+  8058f7:	75 04                	jne    8058fd <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8058f9:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8058fd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805900:	83 e0 01             	and    $0x1,%eax
+  805903:	85 c0                	test   %eax,%eax
+  805905:	74 44                	je     80594b <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805907:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80590a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80590f:	89 c2                	mov    %eax,%edx
+  805911:	be 00 00 00 00       	mov    $0x0,%esi
+  805916:	bf 00 00 00 00       	mov    $0x0,%edi
+  80591b:	48 b8 e9 25 80 00 00 	movabs $0x8025e9,%rax
+  805922:	00 00 00 
+  805925:	ff d0                	call   *%rax
+  805927:	83 f8 01             	cmp    $0x1,%eax
+  80592a:	75 06                	jne    805932 <devcons_poll+0x68>
+      revents |= POLLIN;
+  80592c:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805930:	eb 19                	jmp    80594b <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805932:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805936:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80593c:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80593f:	89 c2                	mov    %eax,%edx
+  805941:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805945:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  80594b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80594e:	c9                   	leave
+  80594f:	c3                   	ret
+
+0000000000805950 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805950:	55                   	push   %rbp
+  805951:	48 89 e5             	mov    %rsp,%rbp
+  805954:	48 83 ec 20          	sub    $0x20,%rsp
+  805958:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80595c:	48 b8 28 21 80 00 00 	movabs $0x802128,%rax
+  805963:	00 00 00 
+  805966:	ff d0                	call   *%rax
+  805968:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  80596b:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805972:	00 00 00 
+  805975:	48 8b 00             	mov    (%rax),%rax
+  805978:	48 85 c0             	test   %rax,%rax
+  80597b:	75 62                	jne    8059df <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  80597d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805980:	ba 07 00 00 00       	mov    $0x7,%edx
+  805985:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  80598c:	00 00 00 
+  80598f:	48 89 ce             	mov    %rcx,%rsi
+  805992:	89 c7                	mov    %eax,%edi
+  805994:	48 b8 a1 21 80 00 00 	movabs $0x8021a1,%rax
+  80599b:	00 00 00 
+  80599e:	ff d0                	call   *%rax
+  8059a0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8059a3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8059a7:	79 36                	jns    8059df <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8059a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059ac:	89 c1                	mov    %eax,%ecx
+  8059ae:	48 b8 14 6c 80 00 00 	movabs $0x806c14,%rax
+  8059b5:	00 00 00 
+  8059b8:	48 89 c2             	mov    %rax,%rdx
+  8059bb:	be 23 00 00 00       	mov    $0x23,%esi
+  8059c0:	48 b8 2c 6c 80 00 00 	movabs $0x806c2c,%rax
+  8059c7:	00 00 00 
+  8059ca:	48 89 c7             	mov    %rax,%rdi
+  8059cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059d2:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  8059d9:	00 00 00 
+  8059dc:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8059df:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  8059e6:	00 00 00 
+  8059e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059ed:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  8059f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059f3:	48 ba 50 5a 80 00 00 	movabs $0x805a50,%rdx
+  8059fa:	00 00 00 
+  8059fd:	48 89 d6             	mov    %rdx,%rsi
+  805a00:	89 c7                	mov    %eax,%edi
+  805a02:	48 b8 3e 23 80 00 00 	movabs $0x80233e,%rax
+  805a09:	00 00 00 
+  805a0c:	ff d0                	call   *%rax
+  805a0e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805a11:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805a15:	79 36                	jns    805a4d <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805a17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a1a:	89 c1                	mov    %eax,%ecx
+  805a1c:	48 b8 14 6c 80 00 00 	movabs $0x806c14,%rax
+  805a23:	00 00 00 
+  805a26:	48 89 c2             	mov    %rax,%rdx
+  805a29:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805a2e:	48 b8 2c 6c 80 00 00 	movabs $0x806c2c,%rax
+  805a35:	00 00 00 
+  805a38:	48 89 c7             	mov    %rax,%rdi
+  805a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a40:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  805a47:	00 00 00 
+  805a4a:	41 ff d0             	call   *%r8
+}
+  805a4d:	90                   	nop
+  805a4e:	c9                   	leave
+  805a4f:	c3                   	ret
+
+0000000000805a50 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805a50:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805a53:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805a56:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805a5d:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805a61:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805a66:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  805a6d:	00 00 00 
+	call *%rax
+  805a70:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805a72:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805a77:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805a7a:	41 5f                	pop    %r15
+	popq %r15
+  805a7c:	41 5f                	pop    %r15
+	popq %r15
+  805a7e:	41 5f                	pop    %r15
+	popq %r14
+  805a80:	41 5e                	pop    %r14
+	popq %r13
+  805a82:	41 5d                	pop    %r13
+	popq %r12
+  805a84:	41 5c                	pop    %r12
+	popq %r11
+  805a86:	41 5b                	pop    %r11
+	popq %r10
+  805a88:	41 5a                	pop    %r10
+	popq %r9
+  805a8a:	41 59                	pop    %r9
+	popq %r8
+  805a8c:	41 58                	pop    %r8
+	popq %rsi
+  805a8e:	5e                   	pop    %rsi
+	popq %rdi
+  805a8f:	5f                   	pop    %rdi
+	popq %rbp
+  805a90:	5d                   	pop    %rbp
+	popq %rdx
+  805a91:	5a                   	pop    %rdx
+	popq %rcx
+  805a92:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805a93:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805a98:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805a9d:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805aa1:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805aa4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805aa9:	5b                   	pop    %rbx
+	popq %rax
+  805aaa:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805aab:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805aaf:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805ab0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805ab5:	c3                   	ret
+
+0000000000805ab6 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805ab6:	55                   	push   %rbp
+  805ab7:	48 89 e5             	mov    %rsp,%rbp
+  805aba:	48 83 ec 20          	sub    $0x20,%rsp
+  805abe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ac2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805ac6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805aca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ace:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805ad2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ad6:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805add:	48 89 c7             	mov    %rax,%rdi
+  805ae0:	48 b8 ee 5a 80 00 00 	movabs $0x805aee,%rax
+  805ae7:	00 00 00 
+  805aea:	ff d0                	call   *%rax
+}
+  805aec:	c9                   	leave
+  805aed:	c3                   	ret
+
+0000000000805aee <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805aee:	55                   	push   %rbp
+  805aef:	48 89 e5             	mov    %rsp,%rbp
+  805af2:	48 83 ec 30          	sub    $0x30,%rsp
+  805af6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805afa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805afe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805b02:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805b06:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805b0b:	75 0e                	jne    805b1b <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805b0d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b14:	00 00 00 
+  805b17:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805b1b:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805b20:	75 18                	jne    805b3a <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805b22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b26:	48 89 c7             	mov    %rax,%rdi
+  805b29:	48 b8 e1 23 80 00 00 	movabs $0x8023e1,%rax
+  805b30:	00 00 00 
+  805b33:	ff d0                	call   *%rax
+  805b35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b38:	eb 1d                	jmp    805b57 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805b3a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b42:	48 89 d6             	mov    %rdx,%rsi
+  805b45:	48 89 c7             	mov    %rax,%rdi
+  805b48:	48 b8 27 24 80 00 00 	movabs $0x802427,%rax
+  805b4f:	00 00 00 
+  805b52:	ff d0                	call   *%rax
+  805b54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805b57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b5b:	79 2a                	jns    805b87 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805b5d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b62:	74 0a                	je     805b6e <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805b64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b68:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805b6e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805b73:	74 0a                	je     805b7f <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b79:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805b7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b82:	e9 aa 00 00 00       	jmp    805c31 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805b87:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805b8c:	74 36                	je     805bc4 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805b8e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b95:	00 00 00 
+  805b98:	8b 40 04             	mov    0x4(%rax),%eax
+  805b9b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ba0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ba7:	00 00 00 
+  805baa:	48 98                	cltq
+  805bac:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bb3:	48 01 d0             	add    %rdx,%rax
+  805bb6:	48 05 24 01 00 00    	add    $0x124,%rax
+  805bbc:	8b 10                	mov    (%rax),%edx
+  805bbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bc2:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805bc4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805bc9:	74 36                	je     805c01 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805bcb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bd2:	00 00 00 
+  805bd5:	8b 40 04             	mov    0x4(%rax),%eax
+  805bd8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805bdd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805be4:	00 00 00 
+  805be7:	48 98                	cltq
+  805be9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bf0:	48 01 d0             	add    %rdx,%rax
+  805bf3:	48 05 28 01 00 00    	add    $0x128,%rax
+  805bf9:	8b 10                	mov    (%rax),%edx
+  805bfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bff:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805c01:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c08:	00 00 00 
+  805c0b:	8b 40 04             	mov    0x4(%rax),%eax
+  805c0e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c13:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c1a:	00 00 00 
+  805c1d:	48 98                	cltq
+  805c1f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c26:	48 01 d0             	add    %rdx,%rax
+  805c29:	48 05 20 01 00 00    	add    $0x120,%rax
+  805c2f:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805c31:	c9                   	leave
+  805c32:	c3                   	ret
+
+0000000000805c33 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805c33:	55                   	push   %rbp
+  805c34:	48 89 e5             	mov    %rsp,%rbp
+  805c37:	48 83 ec 30          	sub    $0x30,%rsp
+  805c3b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c3e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805c41:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805c45:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805c48:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805c4d:	75 5e                	jne    805cad <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805c4f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c56:	00 00 00 
+  805c59:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c5d:	eb 4e                	jmp    805cad <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805c5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c63:	79 3c                	jns    805ca1 <ipc_send+0x6e>
+  805c65:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805c69:	74 36                	je     805ca1 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805c6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c6e:	89 c1                	mov    %eax,%ecx
+  805c70:	48 b8 40 6c 80 00 00 	movabs $0x806c40,%rax
+  805c77:	00 00 00 
+  805c7a:	48 89 c2             	mov    %rax,%rdx
+  805c7d:	be 54 00 00 00       	mov    $0x54,%esi
+  805c82:	48 b8 66 6c 80 00 00 	movabs $0x806c66,%rax
+  805c89:	00 00 00 
+  805c8c:	48 89 c7             	mov    %rax,%rdi
+  805c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c94:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  805c9b:	00 00 00 
+  805c9e:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805ca1:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  805ca8:	00 00 00 
+  805cab:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805cad:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805cb0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805cb3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cb7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cba:	89 c7                	mov    %eax,%edi
+  805cbc:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  805cc3:	00 00 00 
+  805cc6:	ff d0                	call   *%rax
+  805cc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ccb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ccf:	75 8e                	jne    805c5f <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805cd1:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  805cd8:	00 00 00 
+  805cdb:	ff d0                	call   *%rax
+}
+  805cdd:	90                   	nop
+  805cde:	c9                   	leave
+  805cdf:	c3                   	ret
+
+0000000000805ce0 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805ce0:	55                   	push   %rbp
+  805ce1:	48 89 e5             	mov    %rsp,%rbp
+  805ce4:	48 83 ec 18          	sub    $0x18,%rsp
+  805ce8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805ceb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805cf2:	eb 4d                	jmp    805d41 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805cf4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805cfb:	00 00 00 
+  805cfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d01:	48 98                	cltq
+  805d03:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d0a:	48 01 d0             	add    %rdx,%rax
+  805d0d:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805d13:	8b 00                	mov    (%rax),%eax
+  805d15:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805d18:	75 23                	jne    805d3d <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805d1a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d21:	00 00 00 
+  805d24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d27:	48 98                	cltq
+  805d29:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d30:	48 01 d0             	add    %rdx,%rax
+  805d33:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d39:	8b 00                	mov    (%rax),%eax
+  805d3b:	eb 12                	jmp    805d4f <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805d3d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d41:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d48:	7e aa                	jle    805cf4 <ipc_find_env+0x14>
+  return 0;
+  805d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d4f:	c9                   	leave
+  805d50:	c3                   	ret
+
+0000000000805d51 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805d51:	55                   	push   %rbp
+  805d52:	48 89 e5             	mov    %rsp,%rbp
+  805d55:	48 83 ec 18          	sub    $0x18,%rsp
+  805d59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805d5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d61:	48 c1 e8 27          	shr    $0x27,%rax
+  805d65:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d6a:	48 89 c2             	mov    %rax,%rdx
+  805d6d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805d74:	01 00 00 
+  805d77:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d7b:	83 e0 01             	and    $0x1,%eax
+  805d7e:	48 85 c0             	test   %rax,%rax
+  805d81:	74 63                	je     805de6 <pageref+0x95>
+  805d83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d87:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805d8b:	48 89 c2             	mov    %rax,%rdx
+  805d8e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805d95:	01 00 00 
+  805d98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d9c:	83 e0 01             	and    $0x1,%eax
+  805d9f:	48 85 c0             	test   %rax,%rax
+  805da2:	74 42                	je     805de6 <pageref+0x95>
+  805da4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805da8:	48 c1 e8 15          	shr    $0x15,%rax
+  805dac:	48 89 c2             	mov    %rax,%rdx
+  805daf:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805db6:	01 00 00 
+  805db9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dbd:	83 e0 01             	and    $0x1,%eax
+  805dc0:	48 85 c0             	test   %rax,%rax
+  805dc3:	74 21                	je     805de6 <pageref+0x95>
+  805dc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc9:	48 c1 e8 0c          	shr    $0xc,%rax
+  805dcd:	48 89 c2             	mov    %rax,%rdx
+  805dd0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805dd7:	01 00 00 
+  805dda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dde:	83 e0 01             	and    $0x1,%eax
+  805de1:	48 85 c0             	test   %rax,%rax
+  805de4:	75 07                	jne    805ded <pageref+0x9c>
+    return 0;
+  805de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805deb:	eb 53                	jmp    805e40 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805ded:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805df1:	48 c1 e8 0c          	shr    $0xc,%rax
+  805df5:	48 89 c2             	mov    %rax,%rdx
+  805df8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805dff:	01 00 00 
+  805e02:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e06:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805e0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e0e:	83 e0 01             	and    $0x1,%eax
+  805e11:	48 85 c0             	test   %rax,%rax
+  805e14:	75 07                	jne    805e1d <pageref+0xcc>
+    return 0;
+  805e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e1b:	eb 23                	jmp    805e40 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805e1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e21:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e25:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e2c:	00 00 00 
+  805e2f:	48 c1 e0 04          	shl    $0x4,%rax
+  805e33:	48 01 d0             	add    %rdx,%rax
+  805e36:	48 83 c0 08          	add    $0x8,%rax
+  805e3a:	0f b7 00             	movzwl (%rax),%eax
+  805e3d:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e40:	c9                   	leave
+  805e41:	c3                   	ret
+
+0000000000805e42 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805e42:	55                   	push   %rbp
+  805e43:	48 89 e5             	mov    %rsp,%rbp
+  805e46:	48 83 ec 10          	sub    $0x10,%rsp
+  805e4a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805e4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e50:	be 00 00 00 00       	mov    $0x0,%esi
+  805e55:	89 c7                	mov    %eax,%edi
+  805e57:	48 b8 66 5e 80 00 00 	movabs $0x805e66,%rax
+  805e5e:	00 00 00 
+  805e61:	ff d0                	call   *%rax
+}
+  805e63:	90                   	nop
+  805e64:	c9                   	leave
+  805e65:	c3                   	ret
+
+0000000000805e66 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805e66:	55                   	push   %rbp
+  805e67:	48 89 e5             	mov    %rsp,%rbp
+  805e6a:	48 83 ec 10          	sub    $0x10,%rsp
+  805e6e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805e71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805e75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e79:	75 3e                	jne    805eb9 <waitpid+0x53>
+  805e7b:	48 b8 70 6c 80 00 00 	movabs $0x806c70,%rax
+  805e82:	00 00 00 
+  805e85:	48 89 c1             	mov    %rax,%rcx
+  805e88:	48 b8 7b 6c 80 00 00 	movabs $0x806c7b,%rax
+  805e8f:	00 00 00 
+  805e92:	48 89 c2             	mov    %rax,%rdx
+  805e95:	be 0e 00 00 00       	mov    $0xe,%esi
+  805e9a:	48 b8 90 6c 80 00 00 	movabs $0x806c90,%rax
+  805ea1:	00 00 00 
+  805ea4:	48 89 c7             	mov    %rax,%rdi
+  805ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805eac:	49 b8 04 02 80 00 00 	movabs $0x800204,%r8
+  805eb3:	00 00 00 
+  805eb6:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805eb9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805ebe:	74 0a                	je     805eca <waitpid+0x64>
+    *status = 0;
+  805ec0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ec4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805eca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805ece:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ed1:	48 89 d6             	mov    %rdx,%rsi
+  805ed4:	89 c7                	mov    %eax,%edi
+  805ed6:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  805edd:	00 00 00 
+  805ee0:	ff d0                	call   *%rax
+}
+  805ee2:	c9                   	leave
+  805ee3:	c3                   	ret
+
+0000000000805ee4 <xchg>:
+  805ee4:	55                   	push   %rbp
+  805ee5:	48 89 e5             	mov    %rsp,%rbp
+  805ee8:	48 83 ec 20          	sub    $0x20,%rsp
+  805eec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ef0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ef3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ef7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805efa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805efe:	f0 87 02             	lock xchg %eax,(%rdx)
+  805f01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f07:	c9                   	leave
+  805f08:	c3                   	ret
+
+0000000000805f09 <cmpxchg>:
+  805f09:	55                   	push   %rbp
+  805f0a:	48 89 e5             	mov    %rsp,%rbp
+  805f0d:	48 83 ec 20          	sub    $0x20,%rsp
+  805f11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f15:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f18:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805f1b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805f1f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805f22:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f25:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f29:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805f2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f33:	c9                   	leave
+  805f34:	c3                   	ret
+
+0000000000805f35 <xadd>:
+  805f35:	55                   	push   %rbp
+  805f36:	48 89 e5             	mov    %rsp,%rbp
+  805f39:	48 83 ec 10          	sub    $0x10,%rsp
+  805f3d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f41:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805f44:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805f48:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f4b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f4f:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805f53:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  805f56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805f59:	c9                   	leave
+  805f5a:	c3                   	ret
+
+0000000000805f5b <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805f5b:	55                   	push   %rbp
+  805f5c:	48 89 e5             	mov    %rsp,%rbp
+  805f5f:	48 83 ec 08          	sub    $0x8,%rsp
+  805f63:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  805f67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f6b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805f71:	90                   	nop
+  805f72:	c9                   	leave
+  805f73:	c3                   	ret
+
+0000000000805f74 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805f74:	55                   	push   %rbp
+  805f75:	48 89 e5             	mov    %rsp,%rbp
+  805f78:	48 83 ec 20          	sub    $0x20,%rsp
+  805f7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f84:	ba 01 00 00 00       	mov    $0x1,%edx
+  805f89:	be 00 00 00 00       	mov    $0x0,%esi
+  805f8e:	48 89 c7             	mov    %rax,%rdi
+  805f91:	48 b8 09 5f 80 00 00 	movabs $0x805f09,%rax
+  805f98:	00 00 00 
+  805f9b:	ff d0                	call   *%rax
+  805f9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805fa0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fa4:	74 65                	je     80600b <mutex_lock+0x97>
+  if (c != 2)
+  805fa6:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  805faa:	74 57                	je     806003 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  805fac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb0:	be 02 00 00 00       	mov    $0x2,%esi
+  805fb5:	48 89 c7             	mov    %rax,%rdi
+  805fb8:	48 b8 e4 5e 80 00 00 	movabs $0x805ee4,%rax
+  805fbf:	00 00 00 
+  805fc2:	ff d0                	call   *%rax
+  805fc4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805fc7:	eb 3a                	jmp    806003 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  805fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fcd:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805fd4:	be 02 00 00 00       	mov    $0x2,%esi
+  805fd9:	48 89 c7             	mov    %rax,%rdi
+  805fdc:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  805fe3:	00 00 00 
+  805fe6:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  805fe8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fec:	be 02 00 00 00       	mov    $0x2,%esi
+  805ff1:	48 89 c7             	mov    %rax,%rdi
+  805ff4:	48 b8 e4 5e 80 00 00 	movabs $0x805ee4,%rax
+  805ffb:	00 00 00 
+  805ffe:	ff d0                	call   *%rax
+  806000:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806003:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806007:	75 c0                	jne    805fc9 <mutex_lock+0x55>
+  806009:	eb 01                	jmp    80600c <mutex_lock+0x98>
+    return;
+  80600b:	90                   	nop
+}
+  80600c:	c9                   	leave
+  80600d:	c3                   	ret
+
+000000000080600e <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  80600e:	55                   	push   %rbp
+  80600f:	48 89 e5             	mov    %rsp,%rbp
+  806012:	48 83 ec 08          	sub    $0x8,%rsp
+  806016:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80601a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80601e:	ba 01 00 00 00       	mov    $0x1,%edx
+  806023:	be 00 00 00 00       	mov    $0x0,%esi
+  806028:	48 89 c7             	mov    %rax,%rdi
+  80602b:	48 b8 09 5f 80 00 00 	movabs $0x805f09,%rax
+  806032:	00 00 00 
+  806035:	ff d0                	call   *%rax
+  806037:	85 c0                	test   %eax,%eax
+  806039:	75 07                	jne    806042 <mutex_trylock+0x34>
+  80603b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806040:	eb 05                	jmp    806047 <mutex_trylock+0x39>
+  806042:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806047:	c9                   	leave
+  806048:	c3                   	ret
+
+0000000000806049 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806049:	55                   	push   %rbp
+  80604a:	48 89 e5             	mov    %rsp,%rbp
+  80604d:	48 83 ec 10          	sub    $0x10,%rsp
+  806051:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806055:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806059:	be 00 00 00 00       	mov    $0x0,%esi
+  80605e:	48 89 c7             	mov    %rax,%rdi
+  806061:	48 b8 e4 5e 80 00 00 	movabs $0x805ee4,%rax
+  806068:	00 00 00 
+  80606b:	ff d0                	call   *%rax
+  80606d:	83 f8 02             	cmp    $0x2,%eax
+  806070:	75 18                	jne    80608a <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806076:	be 01 00 00 00       	mov    $0x1,%esi
+  80607b:	48 89 c7             	mov    %rax,%rdi
+  80607e:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  806085:	00 00 00 
+  806088:	ff d0                	call   *%rax
+}
+  80608a:	90                   	nop
+  80608b:	c9                   	leave
+  80608c:	c3                   	ret
+
+000000000080608d <cond_init>:
+cond_init(struct Cond *c) {
+  80608d:	55                   	push   %rbp
+  80608e:	48 89 e5             	mov    %rsp,%rbp
+  806091:	48 83 ec 08          	sub    $0x8,%rsp
+  806095:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806099:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80609d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8060a3:	90                   	nop
+  8060a4:	c9                   	leave
+  8060a5:	c3                   	ret
+
+00000000008060a6 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8060a6:	55                   	push   %rbp
+  8060a7:	48 89 e5             	mov    %rsp,%rbp
+  8060aa:	48 83 ec 30          	sub    $0x30,%rsp
+  8060ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8060b6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8060ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060be:	8b 00                	mov    (%rax),%eax
+  8060c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8060c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060c7:	48 89 c7             	mov    %rax,%rdi
+  8060ca:	48 b8 49 60 80 00 00 	movabs $0x806049,%rax
+  8060d1:	00 00 00 
+  8060d4:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8060d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8060de:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8060e1:	89 ce                	mov    %ecx,%esi
+  8060e3:	48 89 c7             	mov    %rax,%rdi
+  8060e6:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  8060ed:	00 00 00 
+  8060f0:	ff d0                	call   *%rax
+  8060f2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8060f5:	eb 1f                	jmp    806116 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8060f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060fb:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806102:	be 02 00 00 00       	mov    $0x2,%esi
+  806107:	48 89 c7             	mov    %rax,%rdi
+  80610a:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  806111:	00 00 00 
+  806114:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806116:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80611a:	be 02 00 00 00       	mov    $0x2,%esi
+  80611f:	48 89 c7             	mov    %rax,%rdi
+  806122:	48 b8 e4 5e 80 00 00 	movabs $0x805ee4,%rax
+  806129:	00 00 00 
+  80612c:	ff d0                	call   *%rax
+  80612e:	85 c0                	test   %eax,%eax
+  806130:	75 c5                	jne    8060f7 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806132:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806136:	75 07                	jne    80613f <cond_timedwait+0x99>
+  806138:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80613d:	eb 05                	jmp    806144 <cond_timedwait+0x9e>
+  80613f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806144:	c9                   	leave
+  806145:	c3                   	ret
+
+0000000000806146 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806146:	55                   	push   %rbp
+  806147:	48 89 e5             	mov    %rsp,%rbp
+  80614a:	48 83 ec 10          	sub    $0x10,%rsp
+  80614e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806152:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806156:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80615a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80615e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806165:	48 89 ce             	mov    %rcx,%rsi
+  806168:	48 89 c7             	mov    %rax,%rdi
+  80616b:	48 b8 a6 60 80 00 00 	movabs $0x8060a6,%rax
+  806172:	00 00 00 
+  806175:	ff d0                	call   *%rax
+}
+  806177:	90                   	nop
+  806178:	c9                   	leave
+  806179:	c3                   	ret
+
+000000000080617a <cond_signal>:
+cond_signal(struct Cond *c) {
+  80617a:	55                   	push   %rbp
+  80617b:	48 89 e5             	mov    %rsp,%rbp
+  80617e:	48 83 ec 10          	sub    $0x10,%rsp
+  806182:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806186:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80618a:	be 01 00 00 00       	mov    $0x1,%esi
+  80618f:	48 89 c7             	mov    %rax,%rdi
+  806192:	48 b8 35 5f 80 00 00 	movabs $0x805f35,%rax
+  806199:	00 00 00 
+  80619c:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  80619e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8061a7:	48 89 c7             	mov    %rax,%rdi
+  8061aa:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  8061b1:	00 00 00 
+  8061b4:	ff d0                	call   *%rax
+}
+  8061b6:	90                   	nop
+  8061b7:	c9                   	leave
+  8061b8:	c3                   	ret
+
+00000000008061b9 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8061b9:	55                   	push   %rbp
+  8061ba:	48 89 e5             	mov    %rsp,%rbp
+  8061bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8061c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8061c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8061ce:	48 89 c7             	mov    %rax,%rdi
+  8061d1:	48 b8 35 5f 80 00 00 	movabs $0x805f35,%rax
+  8061d8:	00 00 00 
+  8061db:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8061dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061e1:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8061e6:	48 89 c7             	mov    %rax,%rdi
+  8061e9:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  8061f0:	00 00 00 
+  8061f3:	ff d0                	call   *%rax
+}
+  8061f5:	90                   	nop
+  8061f6:	c9                   	leave
+  8061f7:	c3                   	ret
+
+00000000008061f8 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8061f8:	55                   	push   %rbp
+  8061f9:	48 89 e5             	mov    %rsp,%rbp
+  8061fc:	48 83 ec 10          	sub    $0x10,%rsp
+  806200:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806204:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  806207:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80620b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80620e:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806214:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  80621b:	90                   	nop
+  80621c:	c9                   	leave
+  80621d:	c3                   	ret
+
+000000000080621e <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  80621e:	55                   	push   %rbp
+  80621f:	48 89 e5             	mov    %rsp,%rbp
+  806222:	48 83 ec 18          	sub    $0x18,%rsp
+  806226:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80622a:	eb 2a                	jmp    806256 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80622c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80622f:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806232:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806236:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806239:	89 ce                	mov    %ecx,%esi
+  80623b:	48 89 c7             	mov    %rax,%rdi
+  80623e:	48 b8 09 5f 80 00 00 	movabs $0x805f09,%rax
+  806245:	00 00 00 
+  806248:	ff d0                	call   *%rax
+  80624a:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80624d:	75 07                	jne    806256 <sem_trywait+0x38>
+      return 0;
+  80624f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806254:	eb 14                	jmp    80626a <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806256:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80625a:	8b 00                	mov    (%rax),%eax
+  80625c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80625f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806263:	75 c7                	jne    80622c <sem_trywait+0xe>
+  return -E_BUSY;
+  806265:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80626a:	c9                   	leave
+  80626b:	c3                   	ret
+
+000000000080626c <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  80626c:	55                   	push   %rbp
+  80626d:	48 89 e5             	mov    %rsp,%rbp
+  806270:	48 83 ec 30          	sub    $0x30,%rsp
+  806274:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806278:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  80627c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806283:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  806284:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806289:	0f 84 fb 00 00 00    	je     80638a <sem_timedwait+0x11e>
+  80628f:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806294:	0f 84 f0 00 00 00    	je     80638a <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80629a:	48 b8 5f 55 80 00 00 	movabs $0x80555f,%rax
+  8062a1:	00 00 00 
+  8062a4:	ff d0                	call   *%rax
+  8062a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8062aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062ae:	48 f7 d0             	not    %rax
+  8062b1:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8062b5:	73 0d                	jae    8062c4 <sem_timedwait+0x58>
+  8062b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8062bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062bf:	48 01 d0             	add    %rdx,%rax
+  8062c2:	eb 07                	jmp    8062cb <sem_timedwait+0x5f>
+  8062c4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8062cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8062cf:	e9 b6 00 00 00       	jmp    80638a <sem_timedwait+0x11e>
+    if (deadline) {
+  8062d4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8062d9:	74 2d                	je     806308 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8062db:	48 b8 5f 55 80 00 00 	movabs $0x80555f,%rax
+  8062e2:	00 00 00 
+  8062e5:	ff d0                	call   *%rax
+  8062e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8062eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062ef:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8062f3:	73 0a                	jae    8062ff <sem_timedwait+0x93>
+  8062f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062f9:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8062fd:	eb 05                	jmp    806304 <sem_timedwait+0x98>
+  8062ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  806304:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  806308:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80630c:	48 83 c0 04          	add    $0x4,%rax
+  806310:	be 01 00 00 00       	mov    $0x1,%esi
+  806315:	48 89 c7             	mov    %rax,%rdi
+  806318:	48 b8 35 5f 80 00 00 	movabs $0x805f35,%rax
+  80631f:	00 00 00 
+  806322:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806324:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806328:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80632c:	be 00 00 00 00       	mov    $0x0,%esi
+  806331:	48 89 c7             	mov    %rax,%rdi
+  806334:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  80633b:	00 00 00 
+  80633e:	ff d0                	call   *%rax
+  806340:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806343:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806347:	48 83 c0 04          	add    $0x4,%rax
+  80634b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806350:	48 89 c7             	mov    %rax,%rdi
+  806353:	48 b8 35 5f 80 00 00 	movabs $0x805f35,%rax
+  80635a:	00 00 00 
+  80635d:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  80635f:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  806363:	75 25                	jne    80638a <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  806365:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806369:	48 89 c7             	mov    %rax,%rdi
+  80636c:	48 b8 1e 62 80 00 00 	movabs $0x80621e,%rax
+  806373:	00 00 00 
+  806376:	ff d0                	call   *%rax
+  806378:	85 c0                	test   %eax,%eax
+  80637a:	79 07                	jns    806383 <sem_timedwait+0x117>
+  80637c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806381:	eb 27                	jmp    8063aa <sem_timedwait+0x13e>
+  806383:	b8 00 00 00 00       	mov    $0x0,%eax
+  806388:	eb 20                	jmp    8063aa <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80638a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80638e:	48 89 c7             	mov    %rax,%rdi
+  806391:	48 b8 1e 62 80 00 00 	movabs $0x80621e,%rax
+  806398:	00 00 00 
+  80639b:	ff d0                	call   *%rax
+  80639d:	85 c0                	test   %eax,%eax
+  80639f:	0f 88 2f ff ff ff    	js     8062d4 <sem_timedwait+0x68>
+  return 0;
+  8063a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063aa:	c9                   	leave
+  8063ab:	c3                   	ret
+
+00000000008063ac <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8063ac:	55                   	push   %rbp
+  8063ad:	48 89 e5             	mov    %rsp,%rbp
+  8063b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8063b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8063b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063bc:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8063c3:	48 89 c7             	mov    %rax,%rdi
+  8063c6:	48 b8 6c 62 80 00 00 	movabs $0x80626c,%rax
+  8063cd:	00 00 00 
+  8063d0:	ff d0                	call   *%rax
+}
+  8063d2:	90                   	nop
+  8063d3:	c9                   	leave
+  8063d4:	c3                   	ret
+
+00000000008063d5 <sem_post>:
+sem_post(struct Semaphore *s) {
+  8063d5:	55                   	push   %rbp
+  8063d6:	48 89 e5             	mov    %rsp,%rbp
+  8063d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8063dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8063e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8063ea:	48 89 c7             	mov    %rax,%rdi
+  8063ed:	48 b8 35 5f 80 00 00 	movabs $0x805f35,%rax
+  8063f4:	00 00 00 
+  8063f7:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8063f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063fd:	8b 40 04             	mov    0x4(%rax),%eax
+  806400:	85 c0                	test   %eax,%eax
+  806402:	74 18                	je     80641c <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806404:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806408:	be 01 00 00 00       	mov    $0x1,%esi
+  80640d:	48 89 c7             	mov    %rax,%rdi
+  806410:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  806417:	00 00 00 
+  80641a:	ff d0                	call   *%rax
+}
+  80641c:	90                   	nop
+  80641d:	c9                   	leave
+  80641e:	c3                   	ret
+  80641f:	90                   	nop
@@ -0,0 +1,8143 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 83 01 00 00       	call   8001af <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  cprintf("Making sure bss works right...\n");
+  800041:	48 b8 20 51 80 00 00 	movabs $0x805120,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c7             	mov    %rax,%rdi
+  80004e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800053:	48 ba 75 04 80 00 00 	movabs $0x800475,%rdx
+  80005a:	00 00 00 
+  80005d:	ff d2                	call   *%rdx
+  for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800066:	eb 50                	jmp    8000b8 <umain+0x86>
+    if (bigarray[i] != 0)
+  800068:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80006f:	00 00 00 
+  800072:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800075:	48 98                	cltq
+  800077:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	74 36                	je     8000b4 <umain+0x82>
+      panic("bigarray[%d] isn't cleared!\n", i);
+  80007e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800081:	89 c1                	mov    %eax,%ecx
+  800083:	48 b8 40 51 80 00 00 	movabs $0x805140,%rax
+  80008a:	00 00 00 
+  80008d:	48 89 c2             	mov    %rax,%rdx
+  800090:	be 10 00 00 00       	mov    $0x10,%esi
+  800095:	48 b8 5d 51 80 00 00 	movabs $0x80515d,%rax
+  80009c:	00 00 00 
+  80009f:	48 89 c7             	mov    %rax,%rdi
+  8000a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a7:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  8000ae:	00 00 00 
+  8000b1:	41 ff d0             	call   *%r8
+  for (i = 0; i < ARRAYSIZE; i++)
+  8000b4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000b8:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  8000bf:	7e a7                	jle    800068 <umain+0x36>
+  for (i = 0; i < ARRAYSIZE; i++)
+  8000c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000c8:	eb 19                	jmp    8000e3 <umain+0xb1>
+    bigarray[i] = i;
+  8000ca:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8000cd:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  8000d4:	00 00 00 
+  8000d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000da:	48 98                	cltq
+  8000dc:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  for (i = 0; i < ARRAYSIZE; i++)
+  8000df:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000e3:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  8000ea:	7e de                	jle    8000ca <umain+0x98>
+  for (i = 0; i < ARRAYSIZE; i++)
+  8000ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000f3:	eb 53                	jmp    800148 <umain+0x116>
+    if (bigarray[i] != i)
+  8000f5:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8000fc:	00 00 00 
+  8000ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800102:	48 98                	cltq
+  800104:	8b 14 82             	mov    (%rdx,%rax,4),%edx
+  800107:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80010a:	39 c2                	cmp    %eax,%edx
+  80010c:	74 36                	je     800144 <umain+0x112>
+      panic("bigarray[%d] didn't hold its value!\n", i);
+  80010e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800111:	89 c1                	mov    %eax,%ecx
+  800113:	48 b8 70 51 80 00 00 	movabs $0x805170,%rax
+  80011a:	00 00 00 
+  80011d:	48 89 c2             	mov    %rax,%rdx
+  800120:	be 15 00 00 00       	mov    $0x15,%esi
+  800125:	48 b8 5d 51 80 00 00 	movabs $0x80515d,%rax
+  80012c:	00 00 00 
+  80012f:	48 89 c7             	mov    %rax,%rdi
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  80013e:	00 00 00 
+  800141:	41 ff d0             	call   *%r8
+  for (i = 0; i < ARRAYSIZE; i++)
+  800144:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800148:	81 7d fc ff ff 0f 00 	cmpl   $0xfffff,-0x4(%rbp)
+  80014f:	7e a4                	jle    8000f5 <umain+0xc3>
+
+  cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  800151:	48 b8 98 51 80 00 00 	movabs $0x805198,%rax
+  800158:	00 00 00 
+  80015b:	48 89 c7             	mov    %rax,%rdi
+  80015e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800163:	48 ba 75 04 80 00 00 	movabs $0x800475,%rdx
+  80016a:	00 00 00 
+  80016d:	ff d2                	call   *%rdx
+  // Accessing via subscript operator ([]) will result in -Warray-bounds warning.
+  *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  80016f:	48 b8 00 70 c0 02 00 	movabs $0x2c07000,%rax
+  800176:	00 00 00 
+  800179:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  panic("SHOULD HAVE TRAPPED!!!");
+  80017f:	48 b8 cb 51 80 00 00 	movabs $0x8051cb,%rax
+  800186:	00 00 00 
+  800189:	48 89 c2             	mov    %rax,%rdx
+  80018c:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800191:	48 b8 5d 51 80 00 00 	movabs $0x80515d,%rax
+  800198:	00 00 00 
+  80019b:	48 89 c7             	mov    %rax,%rdi
+  80019e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a3:	48 b9 56 02 80 00 00 	movabs $0x800256,%rcx
+  8001aa:	00 00 00 
+  8001ad:	ff d1                	call   *%rcx
+
+00000000008001af <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001af:	55                   	push   %rbp
+  8001b0:	48 89 e5             	mov    %rsp,%rbp
+  8001b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8001b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8001ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8001be:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8001c5:	00 00 00 
+  8001c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001cc:	eb 13                	jmp    8001e1 <libmain+0x32>
+    (*ctor)();
+  8001ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001d2:	48 8b 10             	mov    (%rax),%rdx
+  8001d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001da:	ff d2                	call   *%rdx
+    ctor++;
+  8001dc:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8001e1:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8001e8:	00 00 00 
+  8001eb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8001ef:	72 dd                	jb     8001ce <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001f5:	7e 14                	jle    80020b <libmain+0x5c>
+    binaryname = argv[0];
+  8001f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001fb:	48 8b 00             	mov    (%rax),%rax
+  8001fe:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800205:	00 00 00 
+  800208:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80020b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80020f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800212:	48 89 d6             	mov    %rdx,%rsi
+  800215:	89 c7                	mov    %eax,%edi
+  800217:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80021e:	00 00 00 
+  800221:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800223:	48 b8 32 02 80 00 00 	movabs $0x800232,%rax
+  80022a:	00 00 00 
+  80022d:	ff d0                	call   *%rax
+#endif
+}
+  80022f:	90                   	nop
+  800230:	c9                   	leave
+  800231:	c3                   	ret
+
+0000000000800232 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800232:	55                   	push   %rbp
+  800233:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800236:	48 b8 ca 2c 80 00 00 	movabs $0x802cca,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+  800247:	48 b8 ab 20 80 00 00 	movabs $0x8020ab,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+}
+  800253:	90                   	nop
+  800254:	5d                   	pop    %rbp
+  800255:	c3                   	ret
+
+0000000000800256 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800256:	55                   	push   %rbp
+  800257:	48 89 e5             	mov    %rsp,%rbp
+  80025a:	53                   	push   %rbx
+  80025b:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800262:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800269:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80026f:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800276:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80027d:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800284:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80028b:	84 c0                	test   %al,%al
+  80028d:	74 23                	je     8002b2 <_panic+0x5c>
+  80028f:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800296:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80029a:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80029e:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8002a2:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8002a6:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8002aa:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8002ae:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8002b2:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8002b9:	00 00 00 
+  8002bc:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8002c3:	00 00 00 
+  8002c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ca:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8002d1:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8002d8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002df:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002e6:	00 00 00 
+  8002e9:	48 8b 18             	mov    (%rax),%rbx
+  8002ec:	48 b8 7a 21 80 00 00 	movabs $0x80217a,%rax
+  8002f3:	00 00 00 
+  8002f6:	ff d0                	call   *%rax
+  8002f8:	89 c6                	mov    %eax,%esi
+  8002fa:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800300:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800307:	41 89 d0             	mov    %edx,%r8d
+  80030a:	48 89 c1             	mov    %rax,%rcx
+  80030d:	48 89 da             	mov    %rbx,%rdx
+  800310:	48 b8 f0 51 80 00 00 	movabs $0x8051f0,%rax
+  800317:	00 00 00 
+  80031a:	48 89 c7             	mov    %rax,%rdi
+  80031d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800322:	49 b9 75 04 80 00 00 	movabs $0x800475,%r9
+  800329:	00 00 00 
+  80032c:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80032f:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800336:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80033d:	48 89 d6             	mov    %rdx,%rsi
+  800340:	48 89 c7             	mov    %rax,%rdi
+  800343:	48 b8 ea 03 80 00 00 	movabs $0x8003ea,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+  cprintf("\n");
+  80034f:	48 b8 13 52 80 00 00 	movabs $0x805213,%rax
+  800356:	00 00 00 
+  800359:	48 89 c7             	mov    %rax,%rdi
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	48 ba 75 04 80 00 00 	movabs $0x800475,%rdx
+  800368:	00 00 00 
+  80036b:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80036d:	cc                   	int3
+  80036e:	eb fd                	jmp    80036d <_panic+0x117>
+
+0000000000800370 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800370:	55                   	push   %rbp
+  800371:	48 89 e5             	mov    %rsp,%rbp
+  800374:	48 83 ec 10          	sub    $0x10,%rsp
+  800378:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80037b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80037f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800383:	8b 00                	mov    (%rax),%eax
+  800385:	8d 48 01             	lea    0x1(%rax),%ecx
+  800388:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80038c:	89 0a                	mov    %ecx,(%rdx)
+  80038e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800391:	89 d1                	mov    %edx,%ecx
+  800393:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800397:	48 98                	cltq
+  800399:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80039d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003a1:	8b 00                	mov    (%rax),%eax
+  8003a3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003a8:	75 2c                	jne    8003d6 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8003aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003ae:	8b 00                	mov    (%rax),%eax
+  8003b0:	48 98                	cltq
+  8003b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8003b6:	48 83 c2 08          	add    $0x8,%rdx
+  8003ba:	48 89 c6             	mov    %rax,%rsi
+  8003bd:	48 89 d7             	mov    %rdx,%rdi
+  8003c0:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  8003c7:	00 00 00 
+  8003ca:	ff d0                	call   *%rax
+    b->idx = 0;
+  8003cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003d0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8003d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003da:	8b 40 04             	mov    0x4(%rax),%eax
+  8003dd:	8d 50 01             	lea    0x1(%rax),%edx
+  8003e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003e4:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003e7:	90                   	nop
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+
+00000000008003ea <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003ea:	55                   	push   %rbp
+  8003eb:	48 89 e5             	mov    %rsp,%rbp
+  8003ee:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8003f5:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8003fc:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800403:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80040a:	00 00 00 
+  b.cnt = 0;
+  80040d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800414:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800417:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80041e:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800425:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80042c:	48 89 c6             	mov    %rax,%rsi
+  80042f:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  800436:	00 00 00 
+  800439:	48 89 c7             	mov    %rax,%rdi
+  80043c:	48 b8 cf 07 80 00 00 	movabs $0x8007cf,%rax
+  800443:	00 00 00 
+  800446:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800448:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80044e:	48 98                	cltq
+  800450:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800457:	48 83 c2 08          	add    $0x8,%rdx
+  80045b:	48 89 c6             	mov    %rax,%rsi
+  80045e:	48 89 d7             	mov    %rdx,%rdi
+  800461:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  800468:	00 00 00 
+  80046b:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80046d:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800473:	c9                   	leave
+  800474:	c3                   	ret
+
+0000000000800475 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800480:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800487:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80048e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800495:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80049c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004a3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004aa:	84 c0                	test   %al,%al
+  8004ac:	74 20                	je     8004ce <cprintf+0x59>
+  8004ae:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004b2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004b6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004ba:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004be:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004c2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004c6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004ca:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004ce:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004d5:	00 00 00 
+  8004d8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004df:	00 00 00 
+  8004e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8004ed:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004f4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8004fb:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800502:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800509:	48 89 d6             	mov    %rdx,%rsi
+  80050c:	48 89 c7             	mov    %rax,%rdi
+  80050f:	48 b8 ea 03 80 00 00 	movabs $0x8003ea,%rax
+  800516:	00 00 00 
+  800519:	ff d0                	call   *%rax
+  80051b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800521:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800527:	c9                   	leave
+  800528:	c3                   	ret
+
+0000000000800529 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800529:	55                   	push   %rbp
+  80052a:	48 89 e5             	mov    %rsp,%rbp
+  80052d:	48 83 ec 30          	sub    $0x30,%rsp
+  800531:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800535:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800539:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80053d:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800540:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800544:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800548:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80054b:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80054f:	72 54                	jb     8005a5 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800551:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800554:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800557:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80055a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80055e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800563:	48 f7 f6             	div    %rsi
+  800566:	49 89 c2             	mov    %rax,%r10
+  800569:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80056c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80056f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800577:	41 89 c9             	mov    %ecx,%r9d
+  80057a:	41 89 f8             	mov    %edi,%r8d
+  80057d:	89 d1                	mov    %edx,%ecx
+  80057f:	4c 89 d2             	mov    %r10,%rdx
+  800582:	48 89 c7             	mov    %rax,%rdi
+  800585:	48 b8 29 05 80 00 00 	movabs $0x800529,%rax
+  80058c:	00 00 00 
+  80058f:	ff d0                	call   *%rax
+  800591:	eb 1c                	jmp    8005af <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800593:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800597:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80059a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80059e:	48 89 d6             	mov    %rdx,%rsi
+  8005a1:	89 c7                	mov    %eax,%edi
+  8005a3:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8005a5:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8005a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8005ad:	7f e4                	jg     800593 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8005af:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8005b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005bb:	48 f7 f1             	div    %rcx
+  8005be:	48 b8 50 54 80 00 00 	movabs $0x805450,%rax
+  8005c5:	00 00 00 
+  8005c8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8005cc:	0f be c0             	movsbl %al,%eax
+  8005cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005d3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8005d7:	48 89 d6             	mov    %rdx,%rsi
+  8005da:	89 c7                	mov    %eax,%edi
+  8005dc:	ff d1                	call   *%rcx
+}
+  8005de:	90                   	nop
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+00000000008005e1 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8005e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8005ed:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8005f0:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8005f4:	7e 4b                	jle    800641 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8005f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fa:	8b 00                	mov    (%rax),%eax
+  8005fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ff:	77 24                	ja     800625 <getuint+0x44>
+  800601:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800605:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80060d:	8b 00                	mov    (%rax),%eax
+  80060f:	89 c0                	mov    %eax,%eax
+  800611:	48 01 d0             	add    %rdx,%rax
+  800614:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800618:	8b 12                	mov    (%rdx),%edx
+  80061a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80061d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800621:	89 0a                	mov    %ecx,(%rdx)
+  800623:	eb 14                	jmp    800639 <getuint+0x58>
+  800625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800629:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80062d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800631:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800635:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800639:	48 8b 00             	mov    (%rax),%rax
+  80063c:	e9 95 00 00 00       	jmp    8006d6 <getuint+0xf5>
+  else if (lflag)
+  800641:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800645:	74 48                	je     80068f <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800647:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80064b:	8b 00                	mov    (%rax),%eax
+  80064d:	83 f8 2f             	cmp    $0x2f,%eax
+  800650:	77 24                	ja     800676 <getuint+0x95>
+  800652:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800656:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80065a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80065e:	8b 00                	mov    (%rax),%eax
+  800660:	89 c0                	mov    %eax,%eax
+  800662:	48 01 d0             	add    %rdx,%rax
+  800665:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800669:	8b 12                	mov    (%rdx),%edx
+  80066b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80066e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800672:	89 0a                	mov    %ecx,(%rdx)
+  800674:	eb 14                	jmp    80068a <getuint+0xa9>
+  800676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80067a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80067e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800682:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800686:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80068a:	48 8b 00             	mov    (%rax),%rax
+  80068d:	eb 47                	jmp    8006d6 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80068f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800693:	8b 00                	mov    (%rax),%eax
+  800695:	83 f8 2f             	cmp    $0x2f,%eax
+  800698:	77 24                	ja     8006be <getuint+0xdd>
+  80069a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80069e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006a6:	8b 00                	mov    (%rax),%eax
+  8006a8:	89 c0                	mov    %eax,%eax
+  8006aa:	48 01 d0             	add    %rdx,%rax
+  8006ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006b1:	8b 12                	mov    (%rdx),%edx
+  8006b3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ba:	89 0a                	mov    %ecx,(%rdx)
+  8006bc:	eb 14                	jmp    8006d2 <getuint+0xf1>
+  8006be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006c6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006d2:	8b 00                	mov    (%rax),%eax
+  8006d4:	89 c0                	mov    %eax,%eax
+}
+  8006d6:	c9                   	leave
+  8006d7:	c3                   	ret
+
+00000000008006d8 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8006d8:	55                   	push   %rbp
+  8006d9:	48 89 e5             	mov    %rsp,%rbp
+  8006dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8006e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8006e7:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8006eb:	7e 4b                	jle    800738 <getint+0x60>
+    return va_arg(*ap, long long);
+  8006ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006f1:	8b 00                	mov    (%rax),%eax
+  8006f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f6:	77 24                	ja     80071c <getint+0x44>
+  8006f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006fc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800704:	8b 00                	mov    (%rax),%eax
+  800706:	89 c0                	mov    %eax,%eax
+  800708:	48 01 d0             	add    %rdx,%rax
+  80070b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80070f:	8b 12                	mov    (%rdx),%edx
+  800711:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800714:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800718:	89 0a                	mov    %ecx,(%rdx)
+  80071a:	eb 14                	jmp    800730 <getint+0x58>
+  80071c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800720:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800724:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800728:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80072c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800730:	48 8b 00             	mov    (%rax),%rax
+  800733:	e9 95 00 00 00       	jmp    8007cd <getint+0xf5>
+  else if (lflag)
+  800738:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80073c:	74 48                	je     800786 <getint+0xae>
+    return va_arg(*ap, long);
+  80073e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800742:	8b 00                	mov    (%rax),%eax
+  800744:	83 f8 2f             	cmp    $0x2f,%eax
+  800747:	77 24                	ja     80076d <getint+0x95>
+  800749:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800751:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800755:	8b 00                	mov    (%rax),%eax
+  800757:	89 c0                	mov    %eax,%eax
+  800759:	48 01 d0             	add    %rdx,%rax
+  80075c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800760:	8b 12                	mov    (%rdx),%edx
+  800762:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800765:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800769:	89 0a                	mov    %ecx,(%rdx)
+  80076b:	eb 14                	jmp    800781 <getint+0xa9>
+  80076d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800771:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800775:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800779:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80077d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800781:	48 8b 00             	mov    (%rax),%rax
+  800784:	eb 47                	jmp    8007cd <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078a:	8b 00                	mov    (%rax),%eax
+  80078c:	83 f8 2f             	cmp    $0x2f,%eax
+  80078f:	77 24                	ja     8007b5 <getint+0xdd>
+  800791:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800795:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80079d:	8b 00                	mov    (%rax),%eax
+  80079f:	89 c0                	mov    %eax,%eax
+  8007a1:	48 01 d0             	add    %rdx,%rax
+  8007a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007a8:	8b 12                	mov    (%rdx),%edx
+  8007aa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007b1:	89 0a                	mov    %ecx,(%rdx)
+  8007b3:	eb 14                	jmp    8007c9 <getint+0xf1>
+  8007b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007bd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007c5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007c9:	8b 00                	mov    (%rax),%eax
+  8007cb:	48 98                	cltq
+}
+  8007cd:	c9                   	leave
+  8007ce:	c3                   	ret
+
+00000000008007cf <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8007cf:	55                   	push   %rbp
+  8007d0:	48 89 e5             	mov    %rsp,%rbp
+  8007d3:	41 54                	push   %r12
+  8007d5:	53                   	push   %rbx
+  8007d6:	48 83 ec 60          	sub    $0x60,%rsp
+  8007da:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8007de:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8007e2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8007e6:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8007ea:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007ee:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8007f2:	48 8b 06             	mov    (%rsi),%rax
+  8007f5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007f9:	48 89 01             	mov    %rax,(%rcx)
+  8007fc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800800:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800804:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800808:	eb 17                	jmp    800821 <vprintfmt+0x52>
+      if (ch == '\0')
+  80080a:	85 db                	test   %ebx,%ebx
+  80080c:	0f 84 bf 04 00 00    	je     800cd1 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800812:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800816:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80081a:	48 89 c6             	mov    %rax,%rsi
+  80081d:	89 df                	mov    %ebx,%edi
+  80081f:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800821:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800825:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800829:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80082d:	0f b6 00             	movzbl (%rax),%eax
+  800830:	0f b6 d8             	movzbl %al,%ebx
+  800833:	83 fb 25             	cmp    $0x25,%ebx
+  800836:	75 d2                	jne    80080a <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800838:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  80083c:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800843:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  80084a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800851:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800858:	eb 04                	jmp    80085e <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80085a:	90                   	nop
+  80085b:	eb 01                	jmp    80085e <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80085d:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80085e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800862:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800866:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80086a:	0f b6 00             	movzbl (%rax),%eax
+  80086d:	0f b6 d8             	movzbl %al,%ebx
+  800870:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800873:	83 f8 55             	cmp    $0x55,%eax
+  800876:	0f 87 22 04 00 00    	ja     800c9e <vprintfmt+0x4cf>
+  80087c:	89 c0                	mov    %eax,%eax
+  80087e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800885:	00 
+  800886:	48 b8 78 54 80 00 00 	movabs $0x805478,%rax
+  80088d:	00 00 00 
+  800890:	48 01 d0             	add    %rdx,%rax
+  800893:	48 8b 00             	mov    (%rax),%rax
+  800896:	ff e0                	jmp    *%rax
+        padc = '-';
+  800898:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80089c:	eb c0                	jmp    80085e <vprintfmt+0x8f>
+        padc = '0';
+  80089e:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8008a2:	eb ba                	jmp    80085e <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8008a4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8008ab:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8008ae:	89 d0                	mov    %edx,%eax
+  8008b0:	c1 e0 02             	shl    $0x2,%eax
+  8008b3:	01 d0                	add    %edx,%eax
+  8008b5:	01 c0                	add    %eax,%eax
+  8008b7:	01 d8                	add    %ebx,%eax
+  8008b9:	83 e8 30             	sub    $0x30,%eax
+  8008bc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8008bf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8008c3:	0f b6 00             	movzbl (%rax),%eax
+  8008c6:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8008c9:	83 fb 2f             	cmp    $0x2f,%ebx
+  8008cc:	7e 60                	jle    80092e <vprintfmt+0x15f>
+  8008ce:	83 fb 39             	cmp    $0x39,%ebx
+  8008d1:	7f 5b                	jg     80092e <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8008d3:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8008d8:	eb d1                	jmp    8008ab <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8008da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e0:	77 17                	ja     8008f9 <vprintfmt+0x12a>
+  8008e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008e6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008e9:	89 d2                	mov    %edx,%edx
+  8008eb:	48 01 d0             	add    %rdx,%rax
+  8008ee:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008f1:	83 c2 08             	add    $0x8,%edx
+  8008f4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008f7:	eb 0c                	jmp    800905 <vprintfmt+0x136>
+  8008f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008fd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800901:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800905:	8b 00                	mov    (%rax),%eax
+  800907:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  80090a:	eb 23                	jmp    80092f <vprintfmt+0x160>
+        if (width < 0)
+  80090c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800910:	0f 89 44 ff ff ff    	jns    80085a <vprintfmt+0x8b>
+          width = 0;
+  800916:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  80091d:	e9 38 ff ff ff       	jmp    80085a <vprintfmt+0x8b>
+        altflag = 1;
+  800922:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800929:	e9 30 ff ff ff       	jmp    80085e <vprintfmt+0x8f>
+        goto process_precision;
+  80092e:	90                   	nop
+        if (width < 0)
+  80092f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800933:	0f 89 24 ff ff ff    	jns    80085d <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800939:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80093c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80093f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800946:	e9 12 ff ff ff       	jmp    80085d <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  80094b:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  80094f:	e9 0a ff ff ff       	jmp    80085e <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 17                	ja     800973 <vprintfmt+0x1a4>
+  80095c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800960:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800963:	89 d2                	mov    %edx,%edx
+  800965:	48 01 d0             	add    %rdx,%rax
+  800968:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80096b:	83 c2 08             	add    $0x8,%edx
+  80096e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800971:	eb 0c                	jmp    80097f <vprintfmt+0x1b0>
+  800973:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800977:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80097b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80097f:	8b 00                	mov    (%rax),%eax
+  800981:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800985:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800989:	48 89 d6             	mov    %rdx,%rsi
+  80098c:	89 c7                	mov    %eax,%edi
+  80098e:	ff d1                	call   *%rcx
+        break;
+  800990:	e9 37 03 00 00       	jmp    800ccc <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800998:	83 f8 2f             	cmp    $0x2f,%eax
+  80099b:	77 17                	ja     8009b4 <vprintfmt+0x1e5>
+  80099d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009a1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009a4:	89 d2                	mov    %edx,%edx
+  8009a6:	48 01 d0             	add    %rdx,%rax
+  8009a9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009ac:	83 c2 08             	add    $0x8,%edx
+  8009af:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8009b2:	eb 0c                	jmp    8009c0 <vprintfmt+0x1f1>
+  8009b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8009b8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009bc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8009c0:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  8009c2:	85 db                	test   %ebx,%ebx
+  8009c4:	79 02                	jns    8009c8 <vprintfmt+0x1f9>
+          err = -err;
+  8009c6:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009c8:	83 fb 15             	cmp    $0x15,%ebx
+  8009cb:	7f 16                	jg     8009e3 <vprintfmt+0x214>
+  8009cd:	48 ba a0 53 80 00 00 	movabs $0x8053a0,%rdx
+  8009d4:	00 00 00 
+  8009d7:	48 63 c3             	movslq %ebx,%rax
+  8009da:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  8009de:	4d 85 e4             	test   %r12,%r12
+  8009e1:	75 2e                	jne    800a11 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  8009e3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8009e7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009eb:	89 d9                	mov    %ebx,%ecx
+  8009ed:	48 ba 61 54 80 00 00 	movabs $0x805461,%rdx
+  8009f4:	00 00 00 
+  8009f7:	48 89 c7             	mov    %rax,%rdi
+  8009fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ff:	49 b8 db 0c 80 00 00 	movabs $0x800cdb,%r8
+  800a06:	00 00 00 
+  800a09:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800a0c:	e9 bb 02 00 00       	jmp    800ccc <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800a11:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800a15:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a19:	4c 89 e1             	mov    %r12,%rcx
+  800a1c:	48 ba 6a 54 80 00 00 	movabs $0x80546a,%rdx
+  800a23:	00 00 00 
+  800a26:	48 89 c7             	mov    %rax,%rdi
+  800a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2e:	49 b8 db 0c 80 00 00 	movabs $0x800cdb,%r8
+  800a35:	00 00 00 
+  800a38:	41 ff d0             	call   *%r8
+        break;
+  800a3b:	e9 8c 02 00 00       	jmp    800ccc <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	77 17                	ja     800a5f <vprintfmt+0x290>
+  800a48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a4c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a4f:	89 d2                	mov    %edx,%edx
+  800a51:	48 01 d0             	add    %rdx,%rax
+  800a54:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a57:	83 c2 08             	add    $0x8,%edx
+  800a5a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a5d:	eb 0c                	jmp    800a6b <vprintfmt+0x29c>
+  800a5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a63:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a67:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a6b:	4c 8b 20             	mov    (%rax),%r12
+  800a6e:	4d 85 e4             	test   %r12,%r12
+  800a71:	75 0a                	jne    800a7d <vprintfmt+0x2ae>
+          p = "(null)";
+  800a73:	49 bc 6d 54 80 00 00 	movabs $0x80546d,%r12
+  800a7a:	00 00 00 
+        if (width > 0 && padc != '-')
+  800a7d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a81:	7e 78                	jle    800afb <vprintfmt+0x32c>
+  800a83:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800a87:	74 72                	je     800afb <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800a89:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a8c:	48 98                	cltq
+  800a8e:	48 89 c6             	mov    %rax,%rsi
+  800a91:	4c 89 e7             	mov    %r12,%rdi
+  800a94:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  800a9b:	00 00 00 
+  800a9e:	ff d0                	call   *%rax
+  800aa0:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800aa3:	eb 17                	jmp    800abc <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800aa5:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800aa9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800aad:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ab1:	48 89 d6             	mov    %rdx,%rsi
+  800ab4:	89 c7                	mov    %eax,%edi
+  800ab6:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ab8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800abc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ac0:	7f e3                	jg     800aa5 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ac2:	eb 37                	jmp    800afb <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800ac4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ac8:	74 1e                	je     800ae8 <vprintfmt+0x319>
+  800aca:	83 fb 1f             	cmp    $0x1f,%ebx
+  800acd:	7e 05                	jle    800ad4 <vprintfmt+0x305>
+  800acf:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ad2:	7e 14                	jle    800ae8 <vprintfmt+0x319>
+            putch('?', putdat);
+  800ad4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ad8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800adc:	48 89 c6             	mov    %rax,%rsi
+  800adf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ae4:	ff d2                	call   *%rdx
+  800ae6:	eb 0f                	jmp    800af7 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800ae8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800aec:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800af0:	48 89 c6             	mov    %rax,%rsi
+  800af3:	89 df                	mov    %ebx,%edi
+  800af5:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800af7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800afb:	4c 89 e0             	mov    %r12,%rax
+  800afe:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b02:	0f b6 00             	movzbl (%rax),%eax
+  800b05:	0f be d8             	movsbl %al,%ebx
+  800b08:	85 db                	test   %ebx,%ebx
+  800b0a:	74 28                	je     800b34 <vprintfmt+0x365>
+  800b0c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b10:	78 b2                	js     800ac4 <vprintfmt+0x2f5>
+  800b12:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800b16:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800b1a:	79 a8                	jns    800ac4 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800b1c:	eb 16                	jmp    800b34 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800b1e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b22:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b26:	48 89 c6             	mov    %rax,%rsi
+  800b29:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b2e:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800b30:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800b34:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b38:	7f e4                	jg     800b1e <vprintfmt+0x34f>
+        break;
+  800b3a:	e9 8d 01 00 00       	jmp    800ccc <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800b3f:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b42:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b46:	89 d6                	mov    %edx,%esi
+  800b48:	48 89 c7             	mov    %rax,%rdi
+  800b4b:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  800b52:	00 00 00 
+  800b55:	ff d0                	call   *%rax
+  800b57:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800b5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b5f:	48 85 c0             	test   %rax,%rax
+  800b62:	79 1d                	jns    800b81 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800b64:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b68:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b6c:	48 89 c6             	mov    %rax,%rsi
+  800b6f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b74:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800b76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7a:	48 f7 d8             	neg    %rax
+  800b7d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800b81:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800b88:	e9 d2 00 00 00       	jmp    800c5f <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800b8d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800b90:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800b94:	89 d6                	mov    %edx,%esi
+  800b96:	48 89 c7             	mov    %rax,%rdi
+  800b99:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  800ba0:	00 00 00 
+  800ba3:	ff d0                	call   *%rax
+  800ba5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800ba9:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800bb0:	e9 aa 00 00 00       	jmp    800c5f <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800bb5:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800bb8:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800bbc:	89 d6                	mov    %edx,%esi
+  800bbe:	48 89 c7             	mov    %rax,%rdi
+  800bc1:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  800bc8:	00 00 00 
+  800bcb:	ff d0                	call   *%rax
+  800bcd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800bd1:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800bd8:	e9 82 00 00 00       	jmp    800c5f <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800bdd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800be1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800be5:	48 89 c6             	mov    %rax,%rsi
+  800be8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bed:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800bef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bf3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bf7:	48 89 c6             	mov    %rax,%rsi
+  800bfa:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bff:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c04:	83 f8 2f             	cmp    $0x2f,%eax
+  800c07:	77 17                	ja     800c20 <vprintfmt+0x451>
+  800c09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c0d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c10:	89 d2                	mov    %edx,%edx
+  800c12:	48 01 d0             	add    %rdx,%rax
+  800c15:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c18:	83 c2 08             	add    $0x8,%edx
+  800c1b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c1e:	eb 0c                	jmp    800c2c <vprintfmt+0x45d>
+  800c20:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c24:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c28:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c2c:	48 8b 00             	mov    (%rax),%rax
+  800c2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c33:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800c3a:	eb 23                	jmp    800c5f <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800c3c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c3f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c43:	89 d6                	mov    %edx,%esi
+  800c45:	48 89 c7             	mov    %rax,%rdi
+  800c48:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  800c4f:	00 00 00 
+  800c52:	ff d0                	call   *%rax
+  800c54:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800c58:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800c5f:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800c64:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800c67:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800c6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c72:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c76:	45 89 c1             	mov    %r8d,%r9d
+  800c79:	41 89 f8             	mov    %edi,%r8d
+  800c7c:	48 89 c7             	mov    %rax,%rdi
+  800c7f:	48 b8 29 05 80 00 00 	movabs $0x800529,%rax
+  800c86:	00 00 00 
+  800c89:	ff d0                	call   *%rax
+        break;
+  800c8b:	eb 3f                	jmp    800ccc <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800c8d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c91:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c95:	48 89 c6             	mov    %rax,%rsi
+  800c98:	89 df                	mov    %ebx,%edi
+  800c9a:	ff d2                	call   *%rdx
+        break;
+  800c9c:	eb 2e                	jmp    800ccc <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800c9e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ca2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ca6:	48 89 c6             	mov    %rax,%rsi
+  800ca9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cae:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800cb0:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cb5:	eb 05                	jmp    800cbc <vprintfmt+0x4ed>
+  800cb7:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800cbc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cc0:	48 83 e8 01          	sub    $0x1,%rax
+  800cc4:	0f b6 00             	movzbl (%rax),%eax
+  800cc7:	3c 25                	cmp    $0x25,%al
+  800cc9:	75 ec                	jne    800cb7 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800ccb:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ccc:	e9 50 fb ff ff       	jmp    800821 <vprintfmt+0x52>
+        return;
+  800cd1:	90                   	nop
+    }
+  }
+}
+  800cd2:	48 83 c4 60          	add    $0x60,%rsp
+  800cd6:	5b                   	pop    %rbx
+  800cd7:	41 5c                	pop    %r12
+  800cd9:	5d                   	pop    %rbp
+  800cda:	c3                   	ret
+
+0000000000800cdb <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800cdb:	55                   	push   %rbp
+  800cdc:	48 89 e5             	mov    %rsp,%rbp
+  800cdf:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ce6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ced:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800cf4:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800cfb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d02:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d09:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d10:	84 c0                	test   %al,%al
+  800d12:	74 20                	je     800d34 <printfmt+0x59>
+  800d14:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d18:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d1c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d20:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d24:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d28:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d2c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d30:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800d34:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800d3b:	00 00 00 
+  800d3e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800d45:	00 00 00 
+  800d48:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d4c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800d53:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d5a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800d61:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800d68:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d6f:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800d76:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d7d:	48 89 c7             	mov    %rax,%rdi
+  800d80:	48 b8 cf 07 80 00 00 	movabs $0x8007cf,%rax
+  800d87:	00 00 00 
+  800d8a:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800d8c:	90                   	nop
+  800d8d:	c9                   	leave
+  800d8e:	c3                   	ret
+
+0000000000800d8f <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800d8f:	55                   	push   %rbp
+  800d90:	48 89 e5             	mov    %rsp,%rbp
+  800d93:	48 83 ec 10          	sub    $0x10,%rsp
+  800d97:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800d9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800da2:	8b 40 10             	mov    0x10(%rax),%eax
+  800da5:	8d 50 01             	lea    0x1(%rax),%edx
+  800da8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dac:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800daf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800db3:	48 8b 10             	mov    (%rax),%rdx
+  800db6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800dbe:	48 39 c2             	cmp    %rax,%rdx
+  800dc1:	73 17                	jae    800dda <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800dc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dc7:	48 8b 00             	mov    (%rax),%rax
+  800dca:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800dce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800dd2:	48 89 0a             	mov    %rcx,(%rdx)
+  800dd5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800dd8:	88 10                	mov    %dl,(%rax)
+}
+  800dda:	90                   	nop
+  800ddb:	c9                   	leave
+  800ddc:	c3                   	ret
+
+0000000000800ddd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800ddd:	55                   	push   %rbp
+  800dde:	48 89 e5             	mov    %rsp,%rbp
+  800de1:	48 83 ec 40          	sub    $0x40,%rsp
+  800de5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800de9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800dec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800df0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800df4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800df8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800dfc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800dff:	48 98                	cltq
+  800e01:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800e05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e09:	48 01 d0             	add    %rdx,%rax
+  800e0c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800e10:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800e17:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800e1c:	74 06                	je     800e24 <vsnprintf+0x47>
+  800e1e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e22:	7f 07                	jg     800e2b <vsnprintf+0x4e>
+    return -E_INVAL;
+  800e24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e29:	eb 32                	jmp    800e5d <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800e2b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800e2f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800e33:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800e37:	48 89 c6             	mov    %rax,%rsi
+  800e3a:	48 b8 8f 0d 80 00 00 	movabs $0x800d8f,%rax
+  800e41:	00 00 00 
+  800e44:	48 89 c7             	mov    %rax,%rdi
+  800e47:	48 b8 cf 07 80 00 00 	movabs $0x8007cf,%rax
+  800e4e:	00 00 00 
+  800e51:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800e53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e57:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800e5a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800e5d:	c9                   	leave
+  800e5e:	c3                   	ret
+
+0000000000800e5f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800e5f:	55                   	push   %rbp
+  800e60:	48 89 e5             	mov    %rsp,%rbp
+  800e63:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e6a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e71:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800e77:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e7e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e85:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e8c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e93:	84 c0                	test   %al,%al
+  800e95:	74 20                	je     800eb7 <snprintf+0x58>
+  800e97:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e9b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e9f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ea3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ea7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800eab:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800eaf:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800eb3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800eb7:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800ebe:	00 00 00 
+  800ec1:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ec8:	00 00 00 
+  800ecb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ecf:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800ed6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800edd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800ee4:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800eeb:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ef2:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800ef8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800eff:	48 89 c7             	mov    %rax,%rdi
+  800f02:	48 b8 dd 0d 80 00 00 	movabs $0x800ddd,%rax
+  800f09:	00 00 00 
+  800f0c:	ff d0                	call   *%rax
+  800f0e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800f14:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800f1a:	c9                   	leave
+  800f1b:	c3                   	ret
+
+0000000000800f1c <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800f1c:	55                   	push   %rbp
+  800f1d:	48 89 e5             	mov    %rsp,%rbp
+  800f20:	53                   	push   %rbx
+  800f21:	48 83 ec 38          	sub    $0x38,%rsp
+  800f25:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800f28:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f2c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800f30:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800f34:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800f38:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f40:	89 d1                	mov    %edx,%ecx
+  800f42:	0f a2                	cpuid
+  800f44:	89 de                	mov    %ebx,%esi
+  800f46:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800f49:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800f4c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800f4f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800f52:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f57:	74 09                	je     800f62 <cpuid+0x46>
+}
+  800f59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f5d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800f60:	89 10                	mov    %edx,(%rax)
+
+  800f62:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800f67:	74 09                	je     800f72 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800f69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f6d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800f70:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800f72:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800f77:	74 09                	je     800f82 <cpuid+0x66>
+char *
+  800f79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f7d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f80:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800f82:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800f87:	74 09                	je     800f92 <cpuid+0x76>
+  for (; *s; s++)
+  800f89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f8d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800f90:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800f92:	90                   	nop
+  800f93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f97:	c9                   	leave
+  800f98:	c3                   	ret
+
+0000000000800f99 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800f99:	55                   	push   %rbp
+  800f9a:	48 89 e5             	mov    %rsp,%rbp
+  800f9d:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800fa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800fa7:	89 c1                	mov    %eax,%ecx
+  800fa9:	0f 01 d0             	xgetbv
+  800fac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800faf:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800fb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800fb5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800fb8:	48 c1 e2 20          	shl    $0x20,%rdx
+  800fbc:	48 09 d0             	or     %rdx,%rax
+#else
+  800fbf:	c9                   	leave
+  800fc0:	c3                   	ret
+
+0000000000800fc1 <string_cpu>:
+string_cpu(void) {
+  800fc1:	55                   	push   %rbp
+  800fc2:	48 89 e5             	mov    %rsp,%rbp
+  800fc5:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800fc9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800fd0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800fd7:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fde:	00 00 00 
+  800fe1:	8b 00                	mov    (%rax),%eax
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	78 11                	js     800ff8 <string_cpu+0x37>
+    return string_features;
+  800fe7:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800fee:	00 00 00 
+  800ff1:	8b 00                	mov    (%rax),%eax
+  800ff3:	e9 df 00 00 00       	jmp    8010d7 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800ff8:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100c:	48 89 c6             	mov    %rax,%rsi
+  80100f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801014:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  80101b:	00 00 00 
+  80101e:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801020:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801023:	83 f8 06             	cmp    $0x6,%eax
+  801026:	76 28                	jbe    801050 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801028:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80102c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801032:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801037:	48 89 c2             	mov    %rax,%rdx
+  80103a:	be 00 00 00 00       	mov    $0x0,%esi
+  80103f:	bf 07 00 00 00       	mov    $0x7,%edi
+  801044:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  80104b:	00 00 00 
+  80104e:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801050:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801053:	25 00 02 00 00       	and    $0x200,%eax
+  801058:	85 c0                	test   %eax,%eax
+  80105a:	74 04                	je     801060 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80105c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801060:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80106a:	48 89 c1             	mov    %rax,%rcx
+  80106d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80107c:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  801083:	00 00 00 
+  801086:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801088:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80108b:	83 e0 20             	and    $0x20,%eax
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	74 2a                	je     8010bc <string_cpu+0xfb>
+  801092:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801095:	25 00 00 00 08       	and    $0x8000000,%eax
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	74 1e                	je     8010bc <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80109e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010a3:	48 b8 99 0f 80 00 00 	movabs $0x800f99,%rax
+  8010aa:	00 00 00 
+  8010ad:	ff d0                	call   *%rax
+  8010af:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8010b2:	48 83 f8 06          	cmp    $0x6,%rax
+  8010b6:	75 04                	jne    8010bc <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8010b8:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8010bc:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  8010c3:	00 00 00 
+  8010c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010c9:	89 02                	mov    %eax,(%rdx)
+  8010cb:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8010d2:	00 00 00 
+  8010d5:	8b 00                	mov    (%rax),%eax
+}
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+
+00000000008010d9 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8010e1:	48 83 ec 60          	sub    $0x60,%rsp
+  8010e5:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8010ea:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8010ef:	83 e0 1f             	and    $0x1f,%eax
+  8010f2:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8010f6:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8010fa:	48 f7 d8             	neg    %rax
+  8010fd:	48 89 c2             	mov    %rax,%rdx
+  801100:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801105:	48 01 d0             	add    %rdx,%rax
+  801108:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  80110d:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801111:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801117:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80111c:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801120:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801126:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80112a:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80112e:	89 c2                	mov    %eax,%edx
+  801130:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801134:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801139:	89 c1                	mov    %eax,%ecx
+  80113b:	d3 e6                	shl    %cl,%esi
+  80113d:	89 f0                	mov    %esi,%eax
+  80113f:	21 d0                	and    %edx,%eax
+  801141:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801145:	eb 21                	jmp    801168 <strlen_avx2+0x8f>
+    p += 32;
+  801147:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  80114d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801152:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801156:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80115c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801160:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801164:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801168:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80116d:	74 d8                	je     801147 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80116f:	31 c0                	xor    %eax,%eax
+  801171:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801177:	48 63 d0             	movslq %eax,%rdx
+  80117a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80117f:	48 01 d0             	add    %rdx,%rax
+  801182:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+
+0000000000801189 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801191:	48 83 ec 40          	sub    $0x40,%rsp
+  801195:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80119a:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80119f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8011a4:	eb 77                	jmp    80121d <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8011a6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011ab:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8011af:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8011b3:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8011b8:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8011bc:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8011c0:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8011c4:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8011c8:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8011cd:	74 3c                	je     80120b <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8011cf:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8011d3:	f7 d0                	not    %eax
+  8011d5:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8011d9:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8011dd:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8011e1:	48 63 d0             	movslq %eax,%rdx
+  8011e4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011e9:	48 01 d0             	add    %rdx,%rax
+  8011ec:	0f b6 00             	movzbl (%rax),%eax
+  8011ef:	0f b6 c0             	movzbl %al,%eax
+  8011f2:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8011f6:	48 63 ca             	movslq %edx,%rcx
+  8011f9:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8011fe:	48 01 ca             	add    %rcx,%rdx
+  801201:	0f b6 12             	movzbl (%rdx),%edx
+  801204:	0f b6 d2             	movzbl %dl,%edx
+  801207:	29 d0                	sub    %edx,%eax
+  801209:	eb 6b                	jmp    801276 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80120b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801211:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801217:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80121d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801223:	77 81                	ja     8011a6 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801225:	eb 42                	jmp    801269 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801227:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80122c:	0f b6 10             	movzbl (%rax),%edx
+  80122f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801234:	0f b6 00             	movzbl (%rax),%eax
+  801237:	38 c2                	cmp    %al,%dl
+  801239:	74 1c                	je     801257 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80123b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801240:	0f b6 00             	movzbl (%rax),%eax
+  801243:	0f b6 c8             	movzbl %al,%ecx
+  801246:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80124b:	0f b6 00             	movzbl (%rax),%eax
+  80124e:	0f b6 d0             	movzbl %al,%edx
+  801251:	89 c8                	mov    %ecx,%eax
+  801253:	29 d0                	sub    %edx,%eax
+  801255:	eb 1f                	jmp    801276 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801257:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80125d:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801263:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801269:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80126f:	75 b6                	jne    801227 <memcmp_avx2+0x9e>
+  return 0;
+  801271:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+
+0000000000801278 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801280:	48 83 ec 60          	sub    $0x60,%rsp
+  801284:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801289:	89 f0                	mov    %esi,%eax
+  80128b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801290:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801294:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801299:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80129d:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8012a2:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8012a8:	eb 47                	jmp    8012f1 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8012aa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012af:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012b3:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8012b7:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8012bd:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8012c1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012c5:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8012c9:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8012ce:	74 15                	je     8012e5 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8012d0:	31 c0                	xor    %eax,%eax
+  8012d2:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8012d8:	48 63 d0             	movslq %eax,%rdx
+  8012db:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012e0:	48 01 d0             	add    %rdx,%rax
+  8012e3:	eb 3d                	jmp    801322 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8012e5:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8012eb:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8012f1:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8012f7:	77 b1                	ja     8012aa <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8012f9:	eb 0c                	jmp    801307 <memfind_avx2+0x8f>
+  8012fb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801301:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801307:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80130d:	74 0e                	je     80131d <memfind_avx2+0xa5>
+  80130f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801314:	0f b6 00             	movzbl (%rax),%eax
+  801317:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80131b:	75 de                	jne    8012fb <memfind_avx2+0x83>
+  return s;
+  80131d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801322:	c9                   	leave
+  801323:	c3                   	ret
+
+0000000000801324 <strlen>:
+strlen(const char *s) {
+  801324:	55                   	push   %rbp
+  801325:	48 89 e5             	mov    %rsp,%rbp
+  801328:	48 83 ec 40          	sub    $0x40,%rsp
+  80132c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801330:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801334:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801338:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  80133f:	00 00 00 
+  801342:	ff d0                	call   *%rax
+  801344:	83 e0 02             	and    $0x2,%eax
+  801347:	85 c0                	test   %eax,%eax
+  801349:	74 18                	je     801363 <strlen+0x3f>
+    return strlen_avx2(s);
+  80134b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80134f:	48 89 c7             	mov    %rax,%rdi
+  801352:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801359:	00 00 00 
+  80135c:	ff d0                	call   *%rax
+  80135e:	e9 82 00 00 00       	jmp    8013e5 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801363:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801367:	83 e0 0f             	and    $0xf,%eax
+  80136a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80136d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801370:	48 f7 d8             	neg    %rax
+  801373:	48 89 c2             	mov    %rax,%rdx
+  801376:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80137a:	48 01 d0             	add    %rdx,%rax
+  80137d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801381:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801385:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801389:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80138e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801392:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801396:	89 c2                	mov    %eax,%edx
+  801398:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80139b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8013a0:	89 c1                	mov    %eax,%ecx
+  8013a2:	d3 e6                	shl    %cl,%esi
+  8013a4:	89 f0                	mov    %esi,%eax
+  8013a6:	21 d0                	and    %edx,%eax
+  8013a8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8013ab:	eb 1d                	jmp    8013ca <strlen+0xa6>
+    p += 16;
+  8013ad:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8013b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b6:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8013ba:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8013bf:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8013c3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8013c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8013ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8013ce:	74 dd                	je     8013ad <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8013d0:	31 c0                	xor    %eax,%eax
+  8013d2:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8013d7:	48 63 d0             	movslq %eax,%rdx
+  8013da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013de:	48 01 d0             	add    %rdx,%rax
+  8013e1:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8013e5:	c9                   	leave
+  8013e6:	c3                   	ret
+
+00000000008013e7 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8013ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013fe:	eb 0e                	jmp    80140e <strnlen+0x27>
+    n++;
+  801400:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801404:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801409:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80140e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801413:	74 0b                	je     801420 <strnlen+0x39>
+  801415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801419:	0f b6 00             	movzbl (%rax),%eax
+  80141c:	84 c0                	test   %al,%al
+  80141e:	75 e0                	jne    801400 <strnlen+0x19>
+  return n;
+  801420:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801423:	c9                   	leave
+  801424:	c3                   	ret
+
+0000000000801425 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801425:	55                   	push   %rbp
+  801426:	48 89 e5             	mov    %rsp,%rbp
+  801429:	48 83 ec 20          	sub    $0x20,%rsp
+  80142d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801431:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801435:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801439:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80143d:	90                   	nop
+  80143e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801442:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801446:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80144a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80144e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801452:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801456:	0f b6 12             	movzbl (%rdx),%edx
+  801459:	88 10                	mov    %dl,(%rax)
+  80145b:	0f b6 00             	movzbl (%rax),%eax
+  80145e:	84 c0                	test   %al,%al
+  801460:	75 dc                	jne    80143e <strcpy+0x19>
+  return ret;
+  801462:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801466:	c9                   	leave
+  801467:	c3                   	ret
+
+0000000000801468 <strcat>:
+strcat(char *dst, const char *src) {
+  801468:	55                   	push   %rbp
+  801469:	48 89 e5             	mov    %rsp,%rbp
+  80146c:	48 83 ec 20          	sub    $0x20,%rsp
+  801470:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801474:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801478:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80147c:	48 89 c7             	mov    %rax,%rdi
+  80147f:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  801486:	00 00 00 
+  801489:	ff d0                	call   *%rax
+  80148b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80148e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801491:	48 63 d0             	movslq %eax,%rdx
+  801494:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801498:	48 01 c2             	add    %rax,%rdx
+  80149b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149f:	48 89 c6             	mov    %rax,%rsi
+  8014a2:	48 89 d7             	mov    %rdx,%rdi
+  8014a5:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  8014ac:	00 00 00 
+  8014af:	ff d0                	call   *%rax
+  return dst;
+  8014b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8014b5:	c9                   	leave
+  8014b6:	c3                   	ret
+
+00000000008014b7 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8014b7:	55                   	push   %rbp
+  8014b8:	48 89 e5             	mov    %rsp,%rbp
+  8014bb:	48 83 ec 28          	sub    $0x28,%rsp
+  8014bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014c7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8014cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8014d3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014da:	00 
+  8014db:	eb 2a                	jmp    801507 <strncpy+0x50>
+    *dst++ = *src;
+  8014dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014ed:	0f b6 12             	movzbl (%rdx),%edx
+  8014f0:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8014f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014f6:	0f b6 00             	movzbl (%rax),%eax
+  8014f9:	84 c0                	test   %al,%al
+  8014fb:	74 05                	je     801502 <strncpy+0x4b>
+      src++;
+  8014fd:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801502:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801507:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80150b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80150f:	72 cc                	jb     8014dd <strncpy+0x26>
+  return ret;
+  801511:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801515:	c9                   	leave
+  801516:	c3                   	ret
+
+0000000000801517 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	48 83 ec 28          	sub    $0x28,%rsp
+  80151f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801523:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801527:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80152b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80152f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801533:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801538:	74 3d                	je     801577 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80153a:	eb 1d                	jmp    801559 <strlcpy+0x42>
+      *dst++ = *src++;
+  80153c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801540:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801544:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801548:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80154c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801550:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801554:	0f b6 12             	movzbl (%rdx),%edx
+  801557:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801559:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80155e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801563:	74 0b                	je     801570 <strlcpy+0x59>
+  801565:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801569:	0f b6 00             	movzbl (%rax),%eax
+  80156c:	84 c0                	test   %al,%al
+  80156e:	75 cc                	jne    80153c <strlcpy+0x25>
+    *dst = '\0';
+  801570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801574:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801577:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80157f:	c9                   	leave
+  801580:	c3                   	ret
+
+0000000000801581 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	48 83 ec 30          	sub    $0x30,%rsp
+  801589:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80158d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801591:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801595:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801599:	48 89 c7             	mov    %rax,%rdi
+  80159c:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+  8015a8:	48 98                	cltq
+  8015aa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8015ae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b6:	48 89 d6             	mov    %rdx,%rsi
+  8015b9:	48 89 c7             	mov    %rax,%rdi
+  8015bc:	48 b8 e7 13 80 00 00 	movabs $0x8013e7,%rax
+  8015c3:	00 00 00 
+  8015c6:	ff d0                	call   *%rax
+  8015c8:	48 98                	cltq
+  8015ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8015ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015d6:	75 10                	jne    8015e8 <strlcat+0x67>
+    return maxlen + srclen;
+  8015d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8015dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e0:	48 01 d0             	add    %rdx,%rax
+  8015e3:	e9 86 00 00 00       	jmp    80166e <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8015e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015ec:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8015f0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8015f4:	73 2b                	jae    801621 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8015f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015fe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801606:	48 01 c1             	add    %rax,%rcx
+  801609:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80160d:	48 89 c6             	mov    %rax,%rsi
+  801610:	48 89 cf             	mov    %rcx,%rdi
+  801613:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  80161a:	00 00 00 
+  80161d:	ff d0                	call   *%rax
+  80161f:	eb 42                	jmp    801663 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801621:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801625:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801629:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80162d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801631:	48 01 c1             	add    %rax,%rcx
+  801634:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801638:	48 89 c6             	mov    %rax,%rsi
+  80163b:	48 89 cf             	mov    %rcx,%rdi
+  80163e:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  801645:	00 00 00 
+  801648:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80164a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80164e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801652:	48 01 d0             	add    %rdx,%rax
+  801655:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80165d:	48 01 d0             	add    %rdx,%rax
+  801660:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801663:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801667:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166b:	48 01 d0             	add    %rdx,%rax
+}
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+
+0000000000801670 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801670:	55                   	push   %rbp
+  801671:	48 89 e5             	mov    %rsp,%rbp
+  801674:	48 83 ec 10          	sub    $0x10,%rsp
+  801678:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80167c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801680:	eb 0a                	jmp    80168c <strcmp+0x1c>
+    p++, q++;
+  801682:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801687:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80168c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801690:	0f b6 00             	movzbl (%rax),%eax
+  801693:	84 c0                	test   %al,%al
+  801695:	74 12                	je     8016a9 <strcmp+0x39>
+  801697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80169b:	0f b6 10             	movzbl (%rax),%edx
+  80169e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016a2:	0f b6 00             	movzbl (%rax),%eax
+  8016a5:	38 c2                	cmp    %al,%dl
+  8016a7:	74 d9                	je     801682 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8016a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ad:	0f b6 00             	movzbl (%rax),%eax
+  8016b0:	0f b6 d0             	movzbl %al,%edx
+  8016b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b7:	0f b6 00             	movzbl (%rax),%eax
+  8016ba:	0f b6 c0             	movzbl %al,%eax
+  8016bd:	29 c2                	sub    %eax,%edx
+  8016bf:	89 d0                	mov    %edx,%eax
+}
+  8016c1:	c9                   	leave
+  8016c2:	c3                   	ret
+
+00000000008016c3 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8016c3:	55                   	push   %rbp
+  8016c4:	48 89 e5             	mov    %rsp,%rbp
+  8016c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8016cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016d3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016d7:	eb 0f                	jmp    8016e8 <strncmp+0x25>
+    n--, p++, q++;
+  8016d9:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8016de:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016e3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8016e8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016ed:	74 1d                	je     80170c <strncmp+0x49>
+  8016ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f3:	0f b6 00             	movzbl (%rax),%eax
+  8016f6:	84 c0                	test   %al,%al
+  8016f8:	74 12                	je     80170c <strncmp+0x49>
+  8016fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fe:	0f b6 10             	movzbl (%rax),%edx
+  801701:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801705:	0f b6 00             	movzbl (%rax),%eax
+  801708:	38 c2                	cmp    %al,%dl
+  80170a:	74 cd                	je     8016d9 <strncmp+0x16>
+  if (n == 0)
+  80170c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801711:	75 07                	jne    80171a <strncmp+0x57>
+    return 0;
+  801713:	ba 00 00 00 00       	mov    $0x0,%edx
+  801718:	eb 16                	jmp    801730 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80171a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171e:	0f b6 00             	movzbl (%rax),%eax
+  801721:	0f b6 d0             	movzbl %al,%edx
+  801724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801728:	0f b6 00             	movzbl (%rax),%eax
+  80172b:	0f b6 c0             	movzbl %al,%eax
+  80172e:	29 c2                	sub    %eax,%edx
+}
+  801730:	89 d0                	mov    %edx,%eax
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <strchr>:
+strchr(const char *s, char c) {
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	48 83 ec 60          	sub    $0x60,%rsp
+  80173c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801740:	89 f0                	mov    %esi,%eax
+  801742:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801745:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801749:	83 e0 0f             	and    $0xf,%eax
+  80174c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80174f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801752:	48 f7 d8             	neg    %rax
+  801755:	48 89 c2             	mov    %rax,%rdx
+  801758:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80175c:	48 01 d0             	add    %rdx,%rax
+  80175f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801763:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801767:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80176b:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80176f:	66 0f 6e c0          	movd   %eax,%xmm0
+  801773:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801777:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80177b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801780:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801784:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801788:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80178c:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801790:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801795:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80179a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80179e:	89 c2                	mov    %eax,%edx
+  8017a0:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017a5:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8017aa:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017ae:	09 c2                	or     %eax,%edx
+  8017b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017b3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8017b8:	89 c1                	mov    %eax,%ecx
+  8017ba:	d3 e6                	shl    %cl,%esi
+  8017bc:	89 f0                	mov    %esi,%eax
+  8017be:	21 d0                	and    %edx,%eax
+  8017c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017c3:	eb 34                	jmp    8017f9 <strchr+0xc5>
+    p += 16;
+  8017c5:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8017ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ce:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8017d2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8017d6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017db:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8017e0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017e4:	89 c2                	mov    %eax,%edx
+  8017e6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8017eb:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8017f0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017f4:	09 d0                	or     %edx,%eax
+  8017f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017f9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017fd:	74 c6                	je     8017c5 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8017ff:	31 c0                	xor    %eax,%eax
+  801801:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801806:	48 98                	cltq
+  801808:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  80180c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801810:	0f b6 00             	movzbl (%rax),%eax
+  801813:	84 c0                	test   %al,%al
+  801815:	74 06                	je     80181d <strchr+0xe9>
+  801817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80181b:	eb 05                	jmp    801822 <strchr+0xee>
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <strfind>:
+strfind(const char *s, char c) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	48 83 ec 10          	sub    $0x10,%rsp
+  80182c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801830:	89 f0                	mov    %esi,%eax
+  801832:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801835:	eb 11                	jmp    801848 <strfind+0x24>
+    if (*s == c)
+  801837:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80183b:	0f b6 00             	movzbl (%rax),%eax
+  80183e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801841:	74 12                	je     801855 <strfind+0x31>
+  for (; *s; s++)
+  801843:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184c:	0f b6 00             	movzbl (%rax),%eax
+  80184f:	84 c0                	test   %al,%al
+  801851:	75 e4                	jne    801837 <strfind+0x13>
+  801853:	eb 01                	jmp    801856 <strfind+0x32>
+      break;
+  801855:	90                   	nop
+  return (char *)s;
+  801856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80185a:	c9                   	leave
+  80185b:	c3                   	ret
+
+000000000080185c <memset>:
+memset(void *v, int c, size_t n) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	48 83 ec 38          	sub    $0x38,%rsp
+  801864:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801868:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80186b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80186f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801873:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801877:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80187c:	76 41                	jbe    8018bf <memset+0x63>
+  80187e:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	83 e0 01             	and    $0x1,%eax
+  80188d:	85 c0                	test   %eax,%eax
+  80188f:	74 2e                	je     8018bf <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801891:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801894:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801898:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80189c:	48 89 ce             	mov    %rcx,%rsi
+  80189f:	48 89 f7             	mov    %rsi,%rdi
+  8018a2:	48 89 d1             	mov    %rdx,%rcx
+  8018a5:	fc                   	cld
+  8018a6:	f3 aa                	rep stos %al,%es:(%rdi)
+  8018a8:	48 89 ca             	mov    %rcx,%rdx
+  8018ab:	48 89 fe             	mov    %rdi,%rsi
+  8018ae:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8018b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8018b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ba:	e9 a7 00 00 00       	jmp    801966 <memset+0x10a>
+  if (n >= 8) {
+  8018bf:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8018c4:	0f 86 87 00 00 00    	jbe    801951 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8018ca:	eb 16                	jmp    8018e2 <memset+0x86>
+      *p++ = c;
+  8018cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018d4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018d8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8018db:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8018dd:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8018e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e6:	83 e0 07             	and    $0x7,%eax
+  8018e9:	48 85 c0             	test   %rax,%rax
+  8018ec:	75 de                	jne    8018cc <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8018ee:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8018f1:	0f b6 c0             	movzbl %al,%eax
+  8018f4:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8018fb:	01 01 01 
+  8018fe:	48 0f af c2          	imul   %rdx,%rax
+  801902:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801906:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190a:	48 c1 e8 03          	shr    $0x3,%rax
+  80190e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801912:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801916:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80191a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80191e:	48 89 ce             	mov    %rcx,%rsi
+  801921:	48 89 f7             	mov    %rsi,%rdi
+  801924:	48 89 d1             	mov    %rdx,%rcx
+  801927:	fc                   	cld
+  801928:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80192b:	48 89 ca             	mov    %rcx,%rdx
+  80192e:	48 89 fe             	mov    %rdi,%rsi
+  801931:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801935:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801939:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  80193e:	eb 11                	jmp    801951 <memset+0xf5>
+    *p++ = c;
+  801940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801944:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801948:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80194c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80194f:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801951:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801955:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801959:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	75 de                	jne    801940 <memset+0xe4>
+  return v;
+  801962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	48 83 ec 38          	sub    $0x38,%rsp
+  801970:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801974:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801978:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80197c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801980:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801984:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801988:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80198c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801990:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801994:	0f 83 da 00 00 00    	jae    801a74 <memmove+0x10c>
+  80199a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80199e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019a2:	48 01 d0             	add    %rdx,%rax
+  8019a5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8019a9:	0f 83 c5 00 00 00    	jae    801a74 <memmove+0x10c>
+    s += n;
+  8019af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  8019b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019bb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  8019bf:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8019c4:	0f 86 94 00 00 00    	jbe    801a5e <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  8019ca:	eb 1c                	jmp    8019e8 <memmove+0x80>
+        *--d = *--s;
+  8019cc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8019d1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8019d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019da:	0f b6 10             	movzbl (%rax),%edx
+  8019dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019e1:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  8019e3:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8019e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ec:	83 e0 07             	and    $0x7,%eax
+  8019ef:	48 85 c0             	test   %rax,%rax
+  8019f2:	75 d8                	jne    8019cc <memmove+0x64>
+      nq = n / 8;
+  8019f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019f8:	48 c1 e8 03          	shr    $0x3,%rax
+  8019fc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801a00:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801a05:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801a0a:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801a0f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a1b:	48 89 cf             	mov    %rcx,%rdi
+  801a1e:	48 89 d6             	mov    %rdx,%rsi
+  801a21:	48 89 c1             	mov    %rax,%rcx
+  801a24:	fd                   	std
+  801a25:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a28:	fc                   	cld
+  801a29:	48 89 c8             	mov    %rcx,%rax
+  801a2c:	48 89 f2             	mov    %rsi,%rdx
+  801a2f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801a33:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a37:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801a3b:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801a40:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801a45:	eb 17                	jmp    801a5e <memmove+0xf6>
+      *--d = *--s;
+  801a47:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801a4c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a55:	0f b6 10             	movzbl (%rax),%edx
+  801a58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801a5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a62:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a66:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a6a:	48 85 c0             	test   %rax,%rax
+  801a6d:	75 d8                	jne    801a47 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801a6f:	e9 f4 00 00 00       	jmp    801b68 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a74:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a79:	76 46                	jbe    801ac1 <memmove+0x159>
+  801a7b:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+  801a87:	83 e0 01             	and    $0x1,%eax
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	74 33                	je     801ac1 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801a8e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a92:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a9a:	48 89 cf             	mov    %rcx,%rdi
+  801a9d:	48 89 d6             	mov    %rdx,%rsi
+  801aa0:	48 89 c1             	mov    %rax,%rcx
+  801aa3:	fc                   	cld
+  801aa4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801aa6:	48 89 c8             	mov    %rcx,%rax
+  801aa9:	48 89 f2             	mov    %rsi,%rdx
+  801aac:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ab0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ab4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801ab8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801abc:	e9 ab 00 00 00       	jmp    801b6c <memmove+0x204>
+    if (n >= 8) {
+  801ac1:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ac6:	0f 86 8b 00 00 00    	jbe    801b57 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801acc:	eb 22                	jmp    801af0 <memmove+0x188>
+        *d++ = *s++;
+  801ace:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ad2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ad6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ada:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ade:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ae2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ae6:	0f b6 12             	movzbl (%rdx),%edx
+  801ae9:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801aeb:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801af0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af4:	83 e0 07             	and    $0x7,%eax
+  801af7:	48 85 c0             	test   %rax,%rax
+  801afa:	75 d2                	jne    801ace <memmove+0x166>
+      nq = n / 8;
+  801afc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b00:	48 c1 e8 03          	shr    $0x3,%rax
+  801b04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801b08:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b0c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b14:	48 89 cf             	mov    %rcx,%rdi
+  801b17:	48 89 d6             	mov    %rdx,%rsi
+  801b1a:	48 89 c1             	mov    %rax,%rcx
+  801b1d:	fc                   	cld
+  801b1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b21:	48 89 c8             	mov    %rcx,%rax
+  801b24:	48 89 f2             	mov    %rsi,%rdx
+  801b27:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b2b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b2f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b33:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801b38:	eb 1d                	jmp    801b57 <memmove+0x1ef>
+      *d++ = *s++;
+  801b3a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b3e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801b46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b4e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801b52:	0f b6 12             	movzbl (%rdx),%edx
+  801b55:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b5b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b5f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b63:	48 85 c0             	test   %rax,%rax
+  801b66:	75 d2                	jne    801b3a <memmove+0x1d2>
+  return dst;
+  801b68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+
+0000000000801b6e <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801b6e:	55                   	push   %rbp
+  801b6f:	48 89 e5             	mov    %rsp,%rbp
+  801b72:	48 83 ec 18          	sub    $0x18,%rsp
+  801b76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b7e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801b82:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b86:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b8e:	48 89 ce             	mov    %rcx,%rsi
+  801b91:	48 89 c7             	mov    %rax,%rdi
+  801b94:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+}
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+0000000000801ba2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801ba2:	55                   	push   %rbp
+  801ba3:	48 89 e5             	mov    %rsp,%rbp
+  801ba6:	48 83 ec 40          	sub    $0x40,%rsp
+  801baa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bb2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801bb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801bbe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801bc6:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801bcb:	0f 86 a7 00 00 00    	jbe    801c78 <memcmp+0xd6>
+  801bd1:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	83 e0 02             	and    $0x2,%eax
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	0f 84 90 00 00 00    	je     801c78 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801be8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf4:	48 89 ce             	mov    %rcx,%rsi
+  801bf7:	48 89 c7             	mov    %rax,%rdi
+  801bfa:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+  801c06:	e9 c2 00 00 00       	jmp    801ccd <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c0f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801c13:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801c17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c1b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801c1f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801c23:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801c27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801c2a:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801c31:	74 36                	je     801c69 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801c33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c36:	f7 d0                	not    %eax
+  801c38:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801c3c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801c3f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801c42:	48 63 d0             	movslq %eax,%rdx
+  801c45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c49:	48 01 d0             	add    %rdx,%rax
+  801c4c:	0f b6 00             	movzbl (%rax),%eax
+  801c4f:	0f b6 c0             	movzbl %al,%eax
+  801c52:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801c55:	48 63 ca             	movslq %edx,%rcx
+  801c58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c5c:	48 01 ca             	add    %rcx,%rdx
+  801c5f:	0f b6 12             	movzbl (%rdx),%edx
+  801c62:	0f b6 d2             	movzbl %dl,%edx
+  801c65:	29 d0                	sub    %edx,%eax
+  801c67:	eb 64                	jmp    801ccd <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801c69:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801c6e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801c73:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801c78:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801c7d:	77 8c                	ja     801c0b <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801c7f:	eb 36                	jmp    801cb7 <memcmp+0x115>
+    if (*s1 != *s2)
+  801c81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c85:	0f b6 10             	movzbl (%rax),%edx
+  801c88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c8c:	0f b6 00             	movzbl (%rax),%eax
+  801c8f:	38 c2                	cmp    %al,%dl
+  801c91:	74 1a                	je     801cad <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801c93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c97:	0f b6 00             	movzbl (%rax),%eax
+  801c9a:	0f b6 c8             	movzbl %al,%ecx
+  801c9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ca1:	0f b6 00             	movzbl (%rax),%eax
+  801ca4:	0f b6 d0             	movzbl %al,%edx
+  801ca7:	89 c8                	mov    %ecx,%eax
+  801ca9:	29 d0                	sub    %edx,%eax
+  801cab:	eb 20                	jmp    801ccd <memcmp+0x12b>
+    s1++, s2++;
+  801cad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cb2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801cb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cbb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cbf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cc3:	48 85 c0             	test   %rax,%rax
+  801cc6:	75 b9                	jne    801c81 <memcmp+0xdf>
+  }
+
+  return 0;
+  801cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ccd:	c9                   	leave
+  801cce:	c3                   	ret
+
+0000000000801ccf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ccf:	55                   	push   %rbp
+  801cd0:	48 89 e5             	mov    %rsp,%rbp
+  801cd3:	48 83 ec 50          	sub    $0x50,%rsp
+  801cd7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801cdb:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801cde:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801ce2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ce6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801cea:	48 01 d0             	add    %rdx,%rax
+  801ced:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801cf1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801cf4:	66 0f 6e c0          	movd   %eax,%xmm0
+  801cf8:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801cfc:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801d00:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801d05:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d09:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801d0e:	76 73                	jbe    801d83 <memfind+0xb4>
+  801d10:	48 b8 c1 0f 80 00 00 	movabs $0x800fc1,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+  801d1c:	83 e0 02             	and    $0x2,%eax
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	74 60                	je     801d83 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801d23:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801d26:	0f b6 c8             	movzbl %al,%ecx
+  801d29:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801d2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d31:	89 ce                	mov    %ecx,%esi
+  801d33:	48 89 c7             	mov    %rax,%rdi
+  801d36:	48 b8 78 12 80 00 00 	movabs $0x801278,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+  801d42:	eb 6c                	jmp    801db0 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d48:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d4c:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d50:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801d55:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d59:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d5d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d64:	74 13                	je     801d79 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801d66:	31 c0                	xor    %eax,%eax
+  801d68:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801d6d:	48 63 d0             	movslq %eax,%rdx
+  801d70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d74:	48 01 d0             	add    %rdx,%rax
+  801d77:	eb 37                	jmp    801db0 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801d79:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801d7e:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801d83:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801d88:	77 ba                	ja     801d44 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801d8a:	eb 13                	jmp    801d9f <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801d8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d90:	0f b6 00             	movzbl (%rax),%eax
+  801d93:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801d96:	38 d0                	cmp    %dl,%al
+  801d98:	74 11                	je     801dab <memfind+0xdc>
+  for (; s < ends; s++)
+  801d9a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801d9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801da7:	72 e3                	jb     801d8c <memfind+0xbd>
+  801da9:	eb 01                	jmp    801dac <memfind+0xdd>
+      break;
+  801dab:	90                   	nop
+  return (void *)s;
+  801dac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+0000000000801db2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	48 83 ec 38          	sub    $0x38,%rsp
+  801dba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dbe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dc2:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801dc5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801dcc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801dd3:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801dd4:	eb 05                	jmp    801ddb <strtol+0x29>
+    s++;
+  801dd6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801ddb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ddf:	0f b6 00             	movzbl (%rax),%eax
+  801de2:	3c 20                	cmp    $0x20,%al
+  801de4:	74 f0                	je     801dd6 <strtol+0x24>
+  801de6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dea:	0f b6 00             	movzbl (%rax),%eax
+  801ded:	3c 09                	cmp    $0x9,%al
+  801def:	74 e5                	je     801dd6 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801df1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df5:	0f b6 00             	movzbl (%rax),%eax
+  801df8:	3c 2b                	cmp    $0x2b,%al
+  801dfa:	75 07                	jne    801e03 <strtol+0x51>
+    s++;
+  801dfc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e01:	eb 17                	jmp    801e1a <strtol+0x68>
+  else if (*s == '-')
+  801e03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e07:	0f b6 00             	movzbl (%rax),%eax
+  801e0a:	3c 2d                	cmp    $0x2d,%al
+  801e0c:	75 0c                	jne    801e1a <strtol+0x68>
+    s++, neg = 1;
+  801e0e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e13:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e1a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e1e:	74 06                	je     801e26 <strtol+0x74>
+  801e20:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801e24:	75 28                	jne    801e4e <strtol+0x9c>
+  801e26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e2a:	0f b6 00             	movzbl (%rax),%eax
+  801e2d:	3c 30                	cmp    $0x30,%al
+  801e2f:	75 1d                	jne    801e4e <strtol+0x9c>
+  801e31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e35:	48 83 c0 01          	add    $0x1,%rax
+  801e39:	0f b6 00             	movzbl (%rax),%eax
+  801e3c:	3c 78                	cmp    $0x78,%al
+  801e3e:	75 0e                	jne    801e4e <strtol+0x9c>
+    s += 2, base = 16;
+  801e40:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801e45:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801e4c:	eb 2c                	jmp    801e7a <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801e4e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e52:	75 19                	jne    801e6d <strtol+0xbb>
+  801e54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e58:	0f b6 00             	movzbl (%rax),%eax
+  801e5b:	3c 30                	cmp    $0x30,%al
+  801e5d:	75 0e                	jne    801e6d <strtol+0xbb>
+    s++, base = 8;
+  801e5f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e64:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801e6b:	eb 0d                	jmp    801e7a <strtol+0xc8>
+  else if (base == 0)
+  801e6d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e71:	75 07                	jne    801e7a <strtol+0xc8>
+    base = 10;
+  801e73:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801e7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e7e:	0f b6 00             	movzbl (%rax),%eax
+  801e81:	3c 2f                	cmp    $0x2f,%al
+  801e83:	7e 1d                	jle    801ea2 <strtol+0xf0>
+  801e85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e89:	0f b6 00             	movzbl (%rax),%eax
+  801e8c:	3c 39                	cmp    $0x39,%al
+  801e8e:	7f 12                	jg     801ea2 <strtol+0xf0>
+      dig = *s - '0';
+  801e90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e94:	0f b6 00             	movzbl (%rax),%eax
+  801e97:	0f be c0             	movsbl %al,%eax
+  801e9a:	83 e8 30             	sub    $0x30,%eax
+  801e9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ea0:	eb 4e                	jmp    801ef0 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea6:	0f b6 00             	movzbl (%rax),%eax
+  801ea9:	3c 60                	cmp    $0x60,%al
+  801eab:	7e 1d                	jle    801eca <strtol+0x118>
+  801ead:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eb1:	0f b6 00             	movzbl (%rax),%eax
+  801eb4:	3c 7a                	cmp    $0x7a,%al
+  801eb6:	7f 12                	jg     801eca <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801eb8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ebc:	0f b6 00             	movzbl (%rax),%eax
+  801ebf:	0f be c0             	movsbl %al,%eax
+  801ec2:	83 e8 57             	sub    $0x57,%eax
+  801ec5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ec8:	eb 26                	jmp    801ef0 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801eca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ece:	0f b6 00             	movzbl (%rax),%eax
+  801ed1:	3c 40                	cmp    $0x40,%al
+  801ed3:	7e 47                	jle    801f1c <strtol+0x16a>
+  801ed5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed9:	0f b6 00             	movzbl (%rax),%eax
+  801edc:	3c 5a                	cmp    $0x5a,%al
+  801ede:	7f 3c                	jg     801f1c <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801ee0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee4:	0f b6 00             	movzbl (%rax),%eax
+  801ee7:	0f be c0             	movsbl %al,%eax
+  801eea:	83 e8 37             	sub    $0x37,%eax
+  801eed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801ef0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ef3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ef6:	7d 23                	jge    801f1b <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801ef8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801efd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801f00:	48 98                	cltq
+  801f02:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801f07:	48 89 c2             	mov    %rax,%rdx
+  801f0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f0d:	48 98                	cltq
+  801f0f:	48 01 d0             	add    %rdx,%rax
+  801f12:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801f16:	e9 5f ff ff ff       	jmp    801e7a <strtol+0xc8>
+      break;
+  801f1b:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801f1c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f21:	74 0b                	je     801f2e <strtol+0x17c>
+    *endptr = (char *)s;
+  801f23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f27:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801f2b:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801f2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f32:	74 09                	je     801f3d <strtol+0x18b>
+  801f34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f38:	48 f7 d8             	neg    %rax
+  801f3b:	eb 04                	jmp    801f41 <strtol+0x18f>
+  801f3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801f41:	c9                   	leave
+  801f42:	c3                   	ret
+
+0000000000801f43 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801f43:	55                   	push   %rbp
+  801f44:	48 89 e5             	mov    %rsp,%rbp
+  801f47:	53                   	push   %rbx
+  801f48:	48 83 ec 48          	sub    $0x48,%rsp
+  801f4c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f58:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801f5c:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801f60:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801f64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f68:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f6c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f70:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801f74:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f78:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f7c:	4c 89 c3             	mov    %r8,%rbx
+  801f7f:	cd 30                	int    $0x30
+  801f81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801f85:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f8a:	74 46                	je     801fd2 <syscall+0x8f>
+  801f8c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f91:	7e 3f                	jle    801fd2 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801f93:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f9b:	49 89 d0             	mov    %rdx,%r8
+  801f9e:	48 89 c1             	mov    %rax,%rcx
+  801fa1:	48 b8 28 57 80 00 00 	movabs $0x805728,%rax
+  801fa8:	00 00 00 
+  801fab:	48 89 c2             	mov    %rax,%rdx
+  801fae:	be 22 00 00 00       	mov    $0x22,%esi
+  801fb3:	48 b8 47 57 80 00 00 	movabs $0x805747,%rax
+  801fba:	00 00 00 
+  801fbd:	48 89 c7             	mov    %rax,%rdi
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  801fcc:	00 00 00 
+  801fcf:	41 ff d1             	call   *%r9
+
+  return ret;
+  801fd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801fd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+
+0000000000801fdc <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801fdc:	55                   	push   %rbp
+  801fdd:	48 89 e5             	mov    %rsp,%rbp
+  801fe0:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fe8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801fec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ff0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff8:	6a 00                	push   $0x0
+  801ffa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802000:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802006:	48 89 d1             	mov    %rdx,%rcx
+  802009:	48 89 c2             	mov    %rax,%rdx
+  80200c:	be 00 00 00 00       	mov    $0x0,%esi
+  802011:	bf 00 00 00 00       	mov    $0x0,%edi
+  802016:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+  802022:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802026:	90                   	nop
+  802027:	c9                   	leave
+  802028:	c3                   	ret
+
+0000000000802029 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802029:	55                   	push   %rbp
+  80202a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80202d:	48 83 ec 08          	sub    $0x8,%rsp
+  802031:	6a 00                	push   $0x0
+  802033:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802039:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80203f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802044:	ba 00 00 00 00       	mov    $0x0,%edx
+  802049:	be 00 00 00 00       	mov    $0x0,%esi
+  80204e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802053:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+  80205f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802063:	c9                   	leave
+  802064:	c3                   	ret
+
+0000000000802065 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802065:	55                   	push   %rbp
+  802066:	48 89 e5             	mov    %rsp,%rbp
+  802069:	48 83 ec 10          	sub    $0x10,%rsp
+  80206d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802070:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802073:	48 98                	cltq
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+  802079:	6a 00                	push   $0x0
+  80207b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802087:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208c:	48 89 c2             	mov    %rax,%rdx
+  80208f:	be 01 00 00 00       	mov    $0x1,%esi
+  802094:	bf 03 00 00 00       	mov    $0x3,%edi
+  802099:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a9:	c9                   	leave
+  8020aa:	c3                   	ret
+
+00000000008020ab <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8020ab:	55                   	push   %rbp
+  8020ac:	48 89 e5             	mov    %rsp,%rbp
+  8020af:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8020b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020b9:	48 98                	cltq
+  8020bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8020bf:	6a 00                	push   $0x0
+  8020c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d2:	48 89 c2             	mov    %rax,%rdx
+  8020d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020da:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020df:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ef:	90                   	nop
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+
+00000000008020f2 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8020f2:	55                   	push   %rbp
+  8020f3:	48 89 e5             	mov    %rsp,%rbp
+  8020f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8020fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802101:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802104:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802107:	b8 05 00 00 00       	mov    $0x5,%eax
+  80210c:	cd 30                	int    $0x30
+  80210e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802112:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802116:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80211b:	7e 3d                	jle    80215a <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80211d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802121:	49 89 c0             	mov    %rax,%r8
+  802124:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802129:	48 b8 28 57 80 00 00 	movabs $0x805728,%rax
+  802130:	00 00 00 
+  802133:	48 89 c2             	mov    %rax,%rdx
+  802136:	be 49 00 00 00       	mov    $0x49,%esi
+  80213b:	48 b8 47 57 80 00 00 	movabs $0x805747,%rax
+  802142:	00 00 00 
+  802145:	48 89 c7             	mov    %rax,%rdi
+  802148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214d:	49 b9 56 02 80 00 00 	movabs $0x800256,%r9
+  802154:	00 00 00 
+  802157:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80215a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80215f:	75 13                	jne    802174 <sys_env_wait+0x82>
+  802161:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802166:	74 0c                	je     802174 <sys_env_wait+0x82>
+    *status = st;
+  802168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80216c:	89 c2                	mov    %eax,%edx
+  80216e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802172:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802174:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802178:	c9                   	leave
+  802179:	c3                   	ret
+
+000000000080217a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80217a:	55                   	push   %rbp
+  80217b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80217e:	48 83 ec 08          	sub    $0x8,%rsp
+  802182:	6a 00                	push   $0x0
+  802184:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80218a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802190:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219a:	be 00 00 00 00       	mov    $0x0,%esi
+  80219f:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021a4:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+  8021b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+
+00000000008021b6 <sys_yield>:
+
+void
+sys_yield(void) {
+  8021b6:	55                   	push   %rbp
+  8021b7:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8021be:	6a 00                	push   $0x0
+  8021c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021db:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021e0:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f0:	90                   	nop
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+00000000008021f3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8021fb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8021fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802202:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802205:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802208:	48 63 c8             	movslq %eax,%rcx
+  80220b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80220f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802212:	48 98                	cltq
+  802214:	48 83 ec 08          	sub    $0x8,%rsp
+  802218:	6a 00                	push   $0x0
+  80221a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802220:	49 89 c8             	mov    %rcx,%r8
+  802223:	48 89 d1             	mov    %rdx,%rcx
+  802226:	48 89 c2             	mov    %rax,%rdx
+  802229:	be 01 00 00 00       	mov    $0x1,%esi
+  80222e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802233:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+  80223f:	48 83 c4 10          	add    $0x10,%rsp
+  802243:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802246:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802249:	c9                   	leave
+  80224a:	c3                   	ret
+
+000000000080224b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80224b:	55                   	push   %rbp
+  80224c:	48 89 e5             	mov    %rsp,%rbp
+  80224f:	48 83 ec 20          	sub    $0x20,%rsp
+  802253:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802256:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80225a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80225d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802261:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802265:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802268:	48 63 c8             	movslq %eax,%rcx
+  80226b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80226f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802272:	48 63 f0             	movslq %eax,%rsi
+  802275:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802279:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80227c:	48 98                	cltq
+  80227e:	48 83 ec 08          	sub    $0x8,%rsp
+  802282:	51                   	push   %rcx
+  802283:	49 89 f9             	mov    %rdi,%r9
+  802286:	49 89 f0             	mov    %rsi,%r8
+  802289:	48 89 d1             	mov    %rdx,%rcx
+  80228c:	48 89 c2             	mov    %rax,%rdx
+  80228f:	be 01 00 00 00       	mov    $0x1,%esi
+  802294:	bf 07 00 00 00       	mov    $0x7,%edi
+  802299:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8022a0:	00 00 00 
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+
+00000000008022ab <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8022ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022c1:	48 98                	cltq
+  8022c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c7:	6a 00                	push   $0x0
+  8022c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d5:	48 89 d1             	mov    %rdx,%rcx
+  8022d8:	48 89 c2             	mov    %rax,%rdx
+  8022db:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022e5:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+  8022f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f5:	c9                   	leave
+  8022f6:	c3                   	ret
+
+00000000008022f7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802302:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802305:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802308:	48 63 d0             	movslq %eax,%rdx
+  80230b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80230e:	48 98                	cltq
+  802310:	48 83 ec 08          	sub    $0x8,%rsp
+  802314:	6a 00                	push   $0x0
+  802316:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80231c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802322:	48 89 d1             	mov    %rdx,%rcx
+  802325:	48 89 c2             	mov    %rax,%rdx
+  802328:	be 01 00 00 00       	mov    $0x1,%esi
+  80232d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802332:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802339:	00 00 00 
+  80233c:	ff d0                	call   *%rax
+  80233e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+
+0000000000802344 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+  802348:	48 83 ec 10          	sub    $0x10,%rsp
+  80234c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80234f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802353:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802357:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80235a:	48 98                	cltq
+  80235c:	48 83 ec 08          	sub    $0x8,%rsp
+  802360:	6a 00                	push   $0x0
+  802362:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802368:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80236e:	48 89 d1             	mov    %rdx,%rcx
+  802371:	48 89 c2             	mov    %rax,%rdx
+  802374:	be 01 00 00 00       	mov    $0x1,%esi
+  802379:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80237e:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+  80238a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+
+0000000000802390 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802390:	55                   	push   %rbp
+  802391:	48 89 e5             	mov    %rsp,%rbp
+  802394:	48 83 ec 10          	sub    $0x10,%rsp
+  802398:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80239b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80239f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023a6:	48 98                	cltq
+  8023a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ac:	6a 00                	push   $0x0
+  8023ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023ba:	48 89 d1             	mov    %rdx,%rcx
+  8023bd:	48 89 c2             	mov    %rax,%rdx
+  8023c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023ca:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+00000000008023dc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8023e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023eb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023ef:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8023f2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023f5:	48 63 f0             	movslq %eax,%rsi
+  8023f8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8023fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802400:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802403:	48 98                	cltq
+  802405:	48 83 ec 08          	sub    $0x8,%rsp
+  802409:	6a 00                	push   $0x0
+  80240b:	49 89 f1             	mov    %rsi,%r9
+  80240e:	49 89 c8             	mov    %rcx,%r8
+  802411:	48 89 d1             	mov    %rdx,%rcx
+  802414:	48 89 c2             	mov    %rax,%rdx
+  802417:	be 00 00 00 00       	mov    $0x0,%esi
+  80241c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802421:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+  80242d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+
+0000000000802433 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802433:	55                   	push   %rbp
+  802434:	48 89 e5             	mov    %rsp,%rbp
+  802437:	48 83 ec 10          	sub    $0x10,%rsp
+  80243b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80243f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802443:	48 83 ec 08          	sub    $0x8,%rsp
+  802447:	6a 00                	push   $0x0
+  802449:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80244f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802455:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80245a:	48 89 c2             	mov    %rax,%rdx
+  80245d:	be 01 00 00 00       	mov    $0x1,%esi
+  802462:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802467:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80246e:	00 00 00 
+  802471:	ff d0                	call   *%rax
+  802473:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+0000000000802479 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802479:	55                   	push   %rbp
+  80247a:	48 89 e5             	mov    %rsp,%rbp
+  80247d:	48 83 ec 10          	sub    $0x10,%rsp
+  802481:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802485:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802489:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80248d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802491:	48 83 ec 08          	sub    $0x8,%rsp
+  802495:	6a 00                	push   $0x0
+  802497:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80249d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a3:	48 89 d1             	mov    %rdx,%rcx
+  8024a6:	48 89 c2             	mov    %rax,%rdx
+  8024a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ae:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024b3:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+  8024bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+00000000008024c5 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8024c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cd:	6a 00                	push   $0x0
+  8024cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ea:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024ef:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+  8024fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+0000000000802501 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+  802505:	48 83 ec 10          	sub    $0x10,%rsp
+  802509:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80250d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802511:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802515:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802519:	48 83 ec 08          	sub    $0x8,%rsp
+  80251d:	6a 00                	push   $0x0
+  80251f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80252b:	48 89 d1             	mov    %rdx,%rcx
+  80252e:	48 89 c2             	mov    %rax,%rdx
+  802531:	be 00 00 00 00       	mov    $0x0,%esi
+  802536:	bf 12 00 00 00       	mov    $0x12,%edi
+  80253b:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+  802547:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80254b:	c9                   	leave
+  80254c:	c3                   	ret
+
+000000000080254d <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80254d:	55                   	push   %rbp
+  80254e:	48 89 e5             	mov    %rsp,%rbp
+  802551:	48 83 ec 20          	sub    $0x20,%rsp
+  802555:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802559:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80255d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802560:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802563:	48 63 c8             	movslq %eax,%rcx
+  802566:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80256a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80256e:	48 83 ec 08          	sub    $0x8,%rsp
+  802572:	6a 00                	push   $0x0
+  802574:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257a:	49 89 c8             	mov    %rcx,%r8
+  80257d:	48 89 d1             	mov    %rdx,%rcx
+  802580:	48 89 c2             	mov    %rax,%rdx
+  802583:	be 00 00 00 00       	mov    $0x0,%esi
+  802588:	bf 13 00 00 00       	mov    $0x13,%edi
+  80258d:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+  802599:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025ab:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8025ae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8025b2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025b6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8025b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c9:	49 89 c8             	mov    %rcx,%r8
+  8025cc:	48 89 d1             	mov    %rdx,%rcx
+  8025cf:	48 89 c2             	mov    %rax,%rdx
+  8025d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d7:	bf 14 00 00 00       	mov    $0x14,%edi
+  8025dc:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+  8025e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ec:	c9                   	leave
+  8025ed:	c3                   	ret
+
+00000000008025ee <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8025ee:	55                   	push   %rbp
+  8025ef:	48 89 e5             	mov    %rsp,%rbp
+  8025f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8025f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8025fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802600:	48 63 d0             	movslq %eax,%rdx
+  802603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802607:	48 83 ec 08          	sub    $0x8,%rsp
+  80260b:	6a 00                	push   $0x0
+  80260d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802619:	48 89 d1             	mov    %rdx,%rcx
+  80261c:	48 89 c2             	mov    %rax,%rdx
+  80261f:	be 00 00 00 00       	mov    $0x0,%esi
+  802624:	bf 15 00 00 00       	mov    $0x15,%edi
+  802629:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+  802635:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802639:	c9                   	leave
+  80263a:	c3                   	ret
+
+000000000080263b <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80263b:	55                   	push   %rbp
+  80263c:	48 89 e5             	mov    %rsp,%rbp
+  80263f:	48 83 ec 20          	sub    $0x20,%rsp
+  802643:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802647:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80264a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80264d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802651:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802655:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802658:	48 63 c8             	movslq %eax,%rcx
+  80265b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80265e:	48 63 d0             	movslq %eax,%rdx
+  802661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802665:	48 83 ec 08          	sub    $0x8,%rsp
+  802669:	6a 00                	push   $0x0
+  80266b:	49 89 f1             	mov    %rsi,%r9
+  80266e:	49 89 c8             	mov    %rcx,%r8
+  802671:	48 89 d1             	mov    %rdx,%rcx
+  802674:	48 89 c2             	mov    %rax,%rdx
+  802677:	be 00 00 00 00       	mov    $0x0,%esi
+  80267c:	bf 16 00 00 00       	mov    $0x16,%edi
+  802681:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802688:	00 00 00 
+  80268b:	ff d0                	call   *%rax
+  80268d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+0000000000802693 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802693:	55                   	push   %rbp
+  802694:	48 89 e5             	mov    %rsp,%rbp
+  802697:	48 83 ec 30          	sub    $0x30,%rsp
+  80269b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80269f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026a3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026a7:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8026ab:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8026af:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026b3:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8026b7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8026bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c7:	51                   	push   %rcx
+  8026c8:	49 89 f9             	mov    %rdi,%r9
+  8026cb:	49 89 f0             	mov    %rsi,%r8
+  8026ce:	48 89 d1             	mov    %rdx,%rcx
+  8026d1:	48 89 c2             	mov    %rax,%rdx
+  8026d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d9:	bf 17 00 00 00       	mov    $0x17,%edi
+  8026de:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+00000000008026f0 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8026f0:	55                   	push   %rbp
+  8026f1:	48 89 e5             	mov    %rsp,%rbp
+  8026f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8026fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026fe:	48 98                	cltq
+  802700:	48 83 ec 08          	sub    $0x8,%rsp
+  802704:	6a 00                	push   $0x0
+  802706:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802717:	48 89 c2             	mov    %rax,%rdx
+  80271a:	be 00 00 00 00       	mov    $0x0,%esi
+  80271f:	bf 18 00 00 00       	mov    $0x18,%edi
+  802724:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802734:	90                   	nop
+  802735:	c9                   	leave
+  802736:	c3                   	ret
+
+0000000000802737 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	48 83 ec 30          	sub    $0x30,%rsp
+  80273f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802742:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802746:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80274a:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80274d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802750:	48 63 f0             	movslq %eax,%rsi
+  802753:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802757:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80275b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80275e:	48 98                	cltq
+  802760:	48 83 ec 08          	sub    $0x8,%rsp
+  802764:	6a 00                	push   $0x0
+  802766:	49 89 f1             	mov    %rsi,%r9
+  802769:	49 89 c8             	mov    %rcx,%r8
+  80276c:	48 89 d1             	mov    %rdx,%rcx
+  80276f:	48 89 c2             	mov    %rax,%rdx
+  802772:	be 01 00 00 00       	mov    $0x1,%esi
+  802777:	bf 19 00 00 00       	mov    $0x19,%edi
+  80277c:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802783:	00 00 00 
+  802786:	ff d0                	call   *%rax
+  802788:	48 83 c4 10          	add    $0x10,%rsp
+  80278c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80278f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802792:	c9                   	leave
+  802793:	c3                   	ret
+
+0000000000802794 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802794:	55                   	push   %rbp
+  802795:	48 89 e5             	mov    %rsp,%rbp
+  802798:	48 83 ec 20          	sub    $0x20,%rsp
+  80279c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027a4:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8027a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027aa:	48 63 c8             	movslq %eax,%rcx
+  8027ad:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c1:	49 89 c8             	mov    %rcx,%r8
+  8027c4:	48 89 d1             	mov    %rdx,%rcx
+  8027c7:	48 89 c2             	mov    %rax,%rdx
+  8027ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8027cf:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8027d4:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8027db:	00 00 00 
+  8027de:	ff d0                	call   *%rax
+  8027e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+00000000008027e6 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8027e6:	55                   	push   %rbp
+  8027e7:	48 89 e5             	mov    %rsp,%rbp
+  8027ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8027ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8027fa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802802:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802806:	48 83 ec 08          	sub    $0x8,%rsp
+  80280a:	6a 00                	push   $0x0
+  80280c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802812:	49 89 c8             	mov    %rcx,%r8
+  802815:	48 89 d1             	mov    %rdx,%rcx
+  802818:	48 89 c2             	mov    %rax,%rdx
+  80281b:	be 01 00 00 00       	mov    $0x1,%esi
+  802820:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802825:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  80282c:	00 00 00 
+  80282f:	ff d0                	call   *%rax
+  802831:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802835:	c9                   	leave
+  802836:	c3                   	ret
+
+0000000000802837 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802837:	55                   	push   %rbp
+  802838:	48 89 e5             	mov    %rsp,%rbp
+  80283b:	48 83 ec 30          	sub    $0x30,%rsp
+  80283f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802843:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802847:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  80284a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  80284e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802852:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802855:	48 63 c8             	movslq %eax,%rcx
+  802858:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80285c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802860:	48 83 ec 08          	sub    $0x8,%rsp
+  802864:	6a 00                	push   $0x0
+  802866:	49 89 f1             	mov    %rsi,%r9
+  802869:	49 89 c8             	mov    %rcx,%r8
+  80286c:	48 89 d1             	mov    %rdx,%rcx
+  80286f:	48 89 c2             	mov    %rax,%rdx
+  802872:	be 01 00 00 00       	mov    $0x1,%esi
+  802877:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80287c:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  802883:	00 00 00 
+  802886:	ff d0                	call   *%rax
+  802888:	48 83 c4 10          	add    $0x10,%rsp
+  80288c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80288f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802892:	c9                   	leave
+  802893:	c3                   	ret
+
+0000000000802894 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802894:	55                   	push   %rbp
+  802895:	48 89 e5             	mov    %rsp,%rbp
+  802898:	48 83 ec 10          	sub    $0x10,%rsp
+  80289c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80289f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028a2:	48 98                	cltq
+  8028a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a8:	6a 00                	push   $0x0
+  8028aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028bb:	48 89 c2             	mov    %rax,%rdx
+  8028be:	be 01 00 00 00       	mov    $0x1,%esi
+  8028c3:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8028c8:	48 b8 43 1f 80 00 00 	movabs $0x801f43,%rax
+  8028cf:	00 00 00 
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+00000000008028da <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8028e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ea:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8028f1:	ff ff ff 
+  8028f4:	48 01 d0             	add    %rdx,%rax
+  8028f7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8028fb:	c9                   	leave
+  8028fc:	c3                   	ret
+
+00000000008028fd <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+  802901:	48 83 ec 08          	sub    $0x8,%rsp
+  802905:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802909:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80290d:	48 89 c7             	mov    %rax,%rdi
+  802910:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+  80291c:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802922:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+0000000000802928 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	48 83 ec 18          	sub    $0x18,%rsp
+  802930:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802934:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80293b:	e9 ae 00 00 00       	jmp    8029ee <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802940:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802943:	c1 e0 0c             	shl    $0xc,%eax
+  802946:	48 98                	cltq
+  802948:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80294d:	48 01 d0             	add    %rdx,%rax
+  802950:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802954:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802958:	48 c1 e8 27          	shr    $0x27,%rax
+  80295c:	48 89 c2             	mov    %rax,%rdx
+  80295f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802966:	01 00 00 
+  802969:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80296d:	83 e0 01             	and    $0x1,%eax
+  802970:	48 85 c0             	test   %rax,%rax
+  802973:	74 63                	je     8029d8 <fd_alloc+0xb0>
+  802975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802979:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80297d:	48 89 c2             	mov    %rax,%rdx
+  802980:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802987:	01 00 00 
+  80298a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80298e:	83 e0 01             	and    $0x1,%eax
+  802991:	48 85 c0             	test   %rax,%rax
+  802994:	74 42                	je     8029d8 <fd_alloc+0xb0>
+  802996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80299a:	48 c1 e8 15          	shr    $0x15,%rax
+  80299e:	48 89 c2             	mov    %rax,%rdx
+  8029a1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8029a8:	01 00 00 
+  8029ab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029af:	83 e0 01             	and    $0x1,%eax
+  8029b2:	48 85 c0             	test   %rax,%rax
+  8029b5:	74 21                	je     8029d8 <fd_alloc+0xb0>
+  8029b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029bb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8029bf:	48 89 c2             	mov    %rax,%rdx
+  8029c2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029c9:	01 00 00 
+  8029cc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029d0:	83 e0 01             	and    $0x1,%eax
+  8029d3:	48 85 c0             	test   %rax,%rax
+  8029d6:	75 12                	jne    8029ea <fd_alloc+0xc2>
+      *fd_store = fd;
+  8029d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029e0:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e8:	eb 1e                	jmp    802a08 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8029ea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8029ee:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8029f2:	0f 8e 48 ff ff ff    	jle    802940 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8029f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029fc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802a03:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+
+0000000000802a0a <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802a0a:	55                   	push   %rbp
+  802a0b:	48 89 e5             	mov    %rsp,%rbp
+  802a0e:	48 83 ec 20          	sub    $0x20,%rsp
+  802a12:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a15:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802a19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a1d:	78 06                	js     802a25 <fd_lookup+0x1b>
+  802a1f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a23:	7e 0a                	jle    802a2f <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a2a:	e9 af 00 00 00       	jmp    802ade <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802a2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a32:	c1 e0 0c             	shl    $0xc,%eax
+  802a35:	48 98                	cltq
+  802a37:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802a3c:	48 01 d0             	add    %rdx,%rax
+  802a3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802a43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a47:	48 c1 e8 27          	shr    $0x27,%rax
+  802a4b:	48 89 c2             	mov    %rax,%rdx
+  802a4e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a55:	01 00 00 
+  802a58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a5c:	83 e0 01             	and    $0x1,%eax
+  802a5f:	48 85 c0             	test   %rax,%rax
+  802a62:	74 63                	je     802ac7 <fd_lookup+0xbd>
+  802a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a68:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a6c:	48 89 c2             	mov    %rax,%rdx
+  802a6f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802a76:	01 00 00 
+  802a79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a7d:	83 e0 01             	and    $0x1,%eax
+  802a80:	48 85 c0             	test   %rax,%rax
+  802a83:	74 42                	je     802ac7 <fd_lookup+0xbd>
+  802a85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a89:	48 c1 e8 15          	shr    $0x15,%rax
+  802a8d:	48 89 c2             	mov    %rax,%rdx
+  802a90:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802a97:	01 00 00 
+  802a9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a9e:	83 e0 01             	and    $0x1,%eax
+  802aa1:	48 85 c0             	test   %rax,%rax
+  802aa4:	74 21                	je     802ac7 <fd_lookup+0xbd>
+  802aa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aaa:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aae:	48 89 c2             	mov    %rax,%rdx
+  802ab1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ab8:	01 00 00 
+  802abb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802abf:	83 e0 01             	and    $0x1,%eax
+  802ac2:	48 85 c0             	test   %rax,%rax
+  802ac5:	75 07                	jne    802ace <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802ac7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802acc:	eb 10                	jmp    802ade <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802ace:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ad2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ad6:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+0000000000802ae0 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802ae0:	55                   	push   %rbp
+  802ae1:	48 89 e5             	mov    %rsp,%rbp
+  802ae4:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802aec:	89 f0                	mov    %esi,%eax
+  802aee:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802af5:	48 89 c7             	mov    %rax,%rdi
+  802af8:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  802b04:	89 c2                	mov    %eax,%edx
+  802b06:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802b0a:	48 89 c6             	mov    %rax,%rsi
+  802b0d:	89 d7                	mov    %edx,%edi
+  802b0f:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+  802b1b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b1e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b22:	78 0a                	js     802b2e <fd_close+0x4e>
+  802b24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b28:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802b2c:	74 12                	je     802b40 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802b2e:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802b32:	74 05                	je     802b39 <fd_close+0x59>
+  802b34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b37:	eb 70                	jmp    802ba9 <fd_close+0xc9>
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	eb 69                	jmp    802ba9 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802b40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b44:	8b 00                	mov    (%rax),%eax
+  802b46:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802b4a:	48 89 d6             	mov    %rdx,%rsi
+  802b4d:	89 c7                	mov    %eax,%edi
+  802b4f:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  802b56:	00 00 00 
+  802b59:	ff d0                	call   *%rax
+  802b5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b62:	78 2a                	js     802b8e <fd_close+0xae>
+    if (dev->dev_close)
+  802b64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b68:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b6c:	48 85 c0             	test   %rax,%rax
+  802b6f:	74 16                	je     802b87 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802b71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b75:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802b79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b7d:	48 89 c7             	mov    %rax,%rdi
+  802b80:	ff d2                	call   *%rdx
+  802b82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b85:	eb 07                	jmp    802b8e <fd_close+0xae>
+    else
+      r = 0;
+  802b87:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802b8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b92:	48 89 c6             	mov    %rax,%rsi
+  802b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9a:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  return r;
+  802ba6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ba9:	c9                   	leave
+  802baa:	c3                   	ret
+
+0000000000802bab <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802bab:	55                   	push   %rbp
+  802bac:	48 89 e5             	mov    %rsp,%rbp
+  802baf:	48 83 ec 20          	sub    $0x20,%rsp
+  802bb3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802bb6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802bba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802bc1:	eb 3f                	jmp    802c02 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802bc3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802bca:	00 00 00 
+  802bcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bd0:	48 98                	cltq
+  802bd2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bd6:	8b 00                	mov    (%rax),%eax
+  802bd8:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802bdb:	75 21                	jne    802bfe <dev_lookup+0x53>
+      *dev = devtab[i];
+  802bdd:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802be4:	00 00 00 
+  802be7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bea:	48 98                	cltq
+  802bec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802bf0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bf4:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfc:	eb 7f                	jmp    802c7d <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802bfe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c02:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802c09:	00 00 00 
+  802c0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c0f:	48 98                	cltq
+  802c11:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c15:	48 85 c0             	test   %rax,%rax
+  802c18:	75 a9                	jne    802bc3 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c1a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802c21:	00 00 00 
+  802c24:	8b 40 04             	mov    0x4(%rax),%eax
+  802c27:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c2c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802c33:	00 00 00 
+  802c36:	48 98                	cltq
+  802c38:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802c3f:	48 01 d0             	add    %rdx,%rax
+  802c42:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802c48:	8b 00                	mov    (%rax),%eax
+  802c4a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c4d:	89 c6                	mov    %eax,%esi
+  802c4f:	48 b8 58 57 80 00 00 	movabs $0x805758,%rax
+  802c56:	00 00 00 
+  802c59:	48 89 c7             	mov    %rax,%rdi
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	48 b9 75 04 80 00 00 	movabs $0x800475,%rcx
+  802c68:	00 00 00 
+  802c6b:	ff d1                	call   *%rcx
+  *dev = 0;
+  802c6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c71:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802c78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+
+0000000000802c7f <close>:
+
+int
+close(int fdnum) {
+  802c7f:	55                   	push   %rbp
+  802c80:	48 89 e5             	mov    %rsp,%rbp
+  802c83:	48 83 ec 20          	sub    $0x20,%rsp
+  802c87:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c8a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802c8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c91:	48 89 d6             	mov    %rdx,%rsi
+  802c94:	89 c7                	mov    %eax,%edi
+  802c96:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+  802ca2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ca5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ca9:	79 05                	jns    802cb0 <close+0x31>
+    return r;
+  802cab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cae:	eb 18                	jmp    802cc8 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802cb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb4:	be 01 00 00 00       	mov    $0x1,%esi
+  802cb9:	48 89 c7             	mov    %rax,%rdi
+  802cbc:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+}
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+0000000000802cca <close_all>:
+
+void
+close_all(void) {
+  802cca:	55                   	push   %rbp
+  802ccb:	48 89 e5             	mov    %rsp,%rbp
+  802cce:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802cd2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802cd9:	eb 15                	jmp    802cf0 <close_all+0x26>
+    close(i);
+  802cdb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cde:	89 c7                	mov    %eax,%edi
+  802ce0:	48 b8 7f 2c 80 00 00 	movabs $0x802c7f,%rax
+  802ce7:	00 00 00 
+  802cea:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802cec:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802cf0:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802cf4:	7e e5                	jle    802cdb <close_all+0x11>
+}
+  802cf6:	90                   	nop
+  802cf7:	90                   	nop
+  802cf8:	c9                   	leave
+  802cf9:	c3                   	ret
+
+0000000000802cfa <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802cfa:	55                   	push   %rbp
+  802cfb:	48 89 e5             	mov    %rsp,%rbp
+  802cfe:	48 83 ec 40          	sub    $0x40,%rsp
+  802d02:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802d05:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d08:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802d0c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802d0f:	48 89 d6             	mov    %rdx,%rsi
+  802d12:	89 c7                	mov    %eax,%edi
+  802d14:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802d1b:	00 00 00 
+  802d1e:	ff d0                	call   *%rax
+  802d20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d23:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d27:	79 08                	jns    802d31 <dup+0x37>
+    return r;
+  802d29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d2c:	e9 33 02 00 00       	jmp    802f64 <dup+0x26a>
+  close(newfdnum);
+  802d31:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802d34:	89 c7                	mov    %eax,%edi
+  802d36:	48 b8 7f 2c 80 00 00 	movabs $0x802c7f,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802d42:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802d45:	c1 e0 0c             	shl    $0xc,%eax
+  802d48:	48 98                	cltq
+  802d4a:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802d4f:	48 01 d0             	add    %rdx,%rax
+  802d52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802d56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d5a:	48 89 c7             	mov    %rax,%rdi
+  802d5d:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+  802d69:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802d6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d71:	48 89 c7             	mov    %rax,%rdi
+  802d74:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  802d7b:	00 00 00 
+  802d7e:	ff d0                	call   *%rax
+  802d80:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802d84:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802d8b:	00 
+  802d8c:	e9 19 01 00 00       	jmp    802eaa <dup+0x1b0>
+    off -= PGSIZE;
+  802d91:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802d98:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802d99:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da1:	48 01 d0             	add    %rdx,%rax
+  802da4:	48 c1 e8 27          	shr    $0x27,%rax
+  802da8:	48 89 c2             	mov    %rax,%rdx
+  802dab:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802db2:	01 00 00 
+  802db5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802db9:	83 e0 01             	and    $0x1,%eax
+  802dbc:	48 85 c0             	test   %rax,%rax
+  802dbf:	0f 84 e5 00 00 00    	je     802eaa <dup+0x1b0>
+  802dc5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802dc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dcd:	48 01 d0             	add    %rdx,%rax
+  802dd0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802dd4:	48 89 c2             	mov    %rax,%rdx
+  802dd7:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802dde:	01 00 00 
+  802de1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802de5:	83 e0 01             	and    $0x1,%eax
+  802de8:	48 85 c0             	test   %rax,%rax
+  802deb:	0f 84 b9 00 00 00    	je     802eaa <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802df1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802df5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df9:	48 01 d0             	add    %rdx,%rax
+  802dfc:	48 c1 e8 15          	shr    $0x15,%rax
+  802e00:	48 89 c2             	mov    %rax,%rdx
+  802e03:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802e0a:	01 00 00 
+  802e0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e11:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802e14:	48 85 c0             	test   %rax,%rax
+  802e17:	0f 84 8d 00 00 00    	je     802eaa <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802e1d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e25:	48 01 d0             	add    %rdx,%rax
+  802e28:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e2c:	48 89 c2             	mov    %rax,%rdx
+  802e2f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e36:	01 00 00 
+  802e39:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e3d:	83 e0 01             	and    $0x1,%eax
+  802e40:	48 85 c0             	test   %rax,%rax
+  802e43:	74 65                	je     802eaa <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802e45:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e4d:	48 01 d0             	add    %rdx,%rax
+  802e50:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e54:	48 89 c2             	mov    %rax,%rdx
+  802e57:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e5e:	01 00 00 
+  802e61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e65:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e6a:	89 c6                	mov    %eax,%esi
+  802e6c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e74:	48 01 c2             	add    %rax,%rdx
+  802e77:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e7f:	48 01 c8             	add    %rcx,%rax
+  802e82:	41 89 f0             	mov    %esi,%r8d
+  802e85:	48 89 d1             	mov    %rdx,%rcx
+  802e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8d:	48 89 c6             	mov    %rax,%rsi
+  802e90:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e95:	48 b8 4b 22 80 00 00 	movabs $0x80224b,%rax
+  802e9c:	00 00 00 
+  802e9f:	ff d0                	call   *%rax
+  802ea1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ea4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ea8:	78 60                	js     802f0a <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802eaa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802eaf:	0f 85 dc fe ff ff    	jne    802d91 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802eb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eb9:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ebd:	48 89 c2             	mov    %rax,%rdx
+  802ec0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ec7:	01 00 00 
+  802eca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ece:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ed3:	89 c1                	mov    %eax,%ecx
+  802ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ed9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802edd:	41 89 c8             	mov    %ecx,%r8d
+  802ee0:	48 89 d1             	mov    %rdx,%rcx
+  802ee3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ee8:	48 89 c6             	mov    %rax,%rsi
+  802eeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef0:	48 b8 4b 22 80 00 00 	movabs $0x80224b,%rax
+  802ef7:	00 00 00 
+  802efa:	ff d0                	call   *%rax
+  802efc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802eff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f03:	78 08                	js     802f0d <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802f05:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802f08:	eb 5a                	jmp    802f64 <dup+0x26a>
+        goto err;
+  802f0a:	90                   	nop
+  802f0b:	eb 01                	jmp    802f0e <dup+0x214>
+    goto err;
+  802f0d:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802f0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f12:	48 89 c6             	mov    %rax,%rsi
+  802f15:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1a:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802f26:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f2d:	00 
+  802f2e:	eb 27                	jmp    802f57 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802f30:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f38:	48 01 d0             	add    %rdx,%rax
+  802f3b:	48 89 c6             	mov    %rax,%rsi
+  802f3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f43:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802f4f:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802f56:	00 
+  802f57:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802f5e:	00 
+  802f5f:	76 cf                	jbe    802f30 <dup+0x236>
+  return r;
+  802f61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f64:	c9                   	leave
+  802f65:	c3                   	ret
+
+0000000000802f66 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802f66:	55                   	push   %rbp
+  802f67:	48 89 e5             	mov    %rsp,%rbp
+  802f6a:	48 83 ec 40          	sub    $0x40,%rsp
+  802f6e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f75:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f79:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802f7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f80:	48 89 d6             	mov    %rdx,%rsi
+  802f83:	89 c7                	mov    %eax,%edi
+  802f85:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f98:	78 24                	js     802fbe <read+0x58>
+  802f9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f9e:	8b 00                	mov    (%rax),%eax
+  802fa0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fa4:	48 89 d6             	mov    %rdx,%rsi
+  802fa7:	89 c7                	mov    %eax,%edi
+  802fa9:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  802fb0:	00 00 00 
+  802fb3:	ff d0                	call   *%rax
+  802fb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fbc:	79 0a                	jns    802fc8 <read+0x62>
+    return r;
+  802fbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fc1:	48 98                	cltq
+  802fc3:	e9 9e 00 00 00       	jmp    803066 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fcc:	8b 40 08             	mov    0x8(%rax),%eax
+  802fcf:	83 e0 03             	and    $0x3,%eax
+  802fd2:	83 f8 01             	cmp    $0x1,%eax
+  802fd5:	75 5c                	jne    803033 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802fd7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802fde:	00 00 00 
+  802fe1:	8b 40 04             	mov    0x4(%rax),%eax
+  802fe4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802fe9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802ff0:	00 00 00 
+  802ff3:	48 98                	cltq
+  802ff5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802ffc:	48 01 d0             	add    %rdx,%rax
+  802fff:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803005:	8b 00                	mov    (%rax),%eax
+  803007:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80300a:	89 c6                	mov    %eax,%esi
+  80300c:	48 b8 77 57 80 00 00 	movabs $0x805777,%rax
+  803013:	00 00 00 
+  803016:	48 89 c7             	mov    %rax,%rdi
+  803019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301e:	48 b9 75 04 80 00 00 	movabs $0x800475,%rcx
+  803025:	00 00 00 
+  803028:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80302a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803031:	eb 33                	jmp    803066 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803033:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803037:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80303b:	48 85 c0             	test   %rax,%rax
+  80303e:	75 09                	jne    803049 <read+0xe3>
+    return -E_NOT_SUPP;
+  803040:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803047:	eb 1d                	jmp    803066 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803049:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80304d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803051:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803055:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803059:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80305d:	48 89 ce             	mov    %rcx,%rsi
+  803060:	48 89 c7             	mov    %rax,%rdi
+  803063:	41 ff d0             	call   *%r8
+}
+  803066:	c9                   	leave
+  803067:	c3                   	ret
+
+0000000000803068 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803068:	55                   	push   %rbp
+  803069:	48 89 e5             	mov    %rsp,%rbp
+  80306c:	48 83 ec 30          	sub    $0x30,%rsp
+  803070:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803073:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803077:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80307b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803082:	eb 49                	jmp    8030cd <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803084:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803087:	48 98                	cltq
+  803089:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80308d:	48 29 c2             	sub    %rax,%rdx
+  803090:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803093:	48 63 c8             	movslq %eax,%rcx
+  803096:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80309a:	48 01 c1             	add    %rax,%rcx
+  80309d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030a0:	48 89 ce             	mov    %rcx,%rsi
+  8030a3:	89 c7                	mov    %eax,%edi
+  8030a5:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+  8030b1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8030b4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8030b8:	79 07                	jns    8030c1 <readn+0x59>
+      return m;
+  8030ba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8030bd:	48 98                	cltq
+  8030bf:	eb 1f                	jmp    8030e0 <readn+0x78>
+    if (m == 0)
+  8030c1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8030c5:	74 13                	je     8030da <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8030c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8030ca:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8030cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030d0:	48 98                	cltq
+  8030d2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8030d6:	72 ac                	jb     803084 <readn+0x1c>
+  8030d8:	eb 01                	jmp    8030db <readn+0x73>
+      break;
+  8030da:	90                   	nop
+  }
+  return tot;
+  8030db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030de:	48 98                	cltq
+}
+  8030e0:	c9                   	leave
+  8030e1:	c3                   	ret
+
+00000000008030e2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8030e2:	55                   	push   %rbp
+  8030e3:	48 89 e5             	mov    %rsp,%rbp
+  8030e6:	48 83 ec 40          	sub    $0x40,%rsp
+  8030ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030ed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030f1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030f5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030fc:	48 89 d6             	mov    %rdx,%rsi
+  8030ff:	89 c7                	mov    %eax,%edi
+  803101:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  803108:	00 00 00 
+  80310b:	ff d0                	call   *%rax
+  80310d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803110:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803114:	78 24                	js     80313a <write+0x58>
+  803116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80311a:	8b 00                	mov    (%rax),%eax
+  80311c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803120:	48 89 d6             	mov    %rdx,%rsi
+  803123:	89 c7                	mov    %eax,%edi
+  803125:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+  803131:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803134:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803138:	79 0a                	jns    803144 <write+0x62>
+    return r;
+  80313a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80313d:	48 98                	cltq
+  80313f:	e9 9d 00 00 00       	jmp    8031e1 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803148:	8b 40 08             	mov    0x8(%rax),%eax
+  80314b:	83 e0 03             	and    $0x3,%eax
+  80314e:	85 c0                	test   %eax,%eax
+  803150:	75 5c                	jne    8031ae <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803152:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803159:	00 00 00 
+  80315c:	8b 40 04             	mov    0x4(%rax),%eax
+  80315f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803164:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80316b:	00 00 00 
+  80316e:	48 98                	cltq
+  803170:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803177:	48 01 d0             	add    %rdx,%rax
+  80317a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803180:	8b 00                	mov    (%rax),%eax
+  803182:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803185:	89 c6                	mov    %eax,%esi
+  803187:	48 b8 93 57 80 00 00 	movabs $0x805793,%rax
+  80318e:	00 00 00 
+  803191:	48 89 c7             	mov    %rax,%rdi
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+  803199:	48 b9 75 04 80 00 00 	movabs $0x800475,%rcx
+  8031a0:	00 00 00 
+  8031a3:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8031a5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031ac:	eb 33                	jmp    8031e1 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8031ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031b2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031b6:	48 85 c0             	test   %rax,%rax
+  8031b9:	75 09                	jne    8031c4 <write+0xe2>
+    return -E_NOT_SUPP;
+  8031bb:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8031c2:	eb 1d                	jmp    8031e1 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8031c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c8:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8031cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031d4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031d8:	48 89 ce             	mov    %rcx,%rsi
+  8031db:	48 89 c7             	mov    %rax,%rdi
+  8031de:	41 ff d0             	call   *%r8
+}
+  8031e1:	c9                   	leave
+  8031e2:	c3                   	ret
+
+00000000008031e3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8031e3:	55                   	push   %rbp
+  8031e4:	48 89 e5             	mov    %rsp,%rbp
+  8031e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8031eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031ee:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031f1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031f8:	48 89 d6             	mov    %rdx,%rsi
+  8031fb:	89 c7                	mov    %eax,%edi
+  8031fd:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  803204:	00 00 00 
+  803207:	ff d0                	call   *%rax
+  803209:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80320c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803210:	79 05                	jns    803217 <seek+0x34>
+    return r;
+  803212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803215:	eb 0f                	jmp    803226 <seek+0x43>
+  fd->fd_offset = offset;
+  803217:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80321b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80321e:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803226:	c9                   	leave
+  803227:	c3                   	ret
+
+0000000000803228 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803228:	55                   	push   %rbp
+  803229:	48 89 e5             	mov    %rsp,%rbp
+  80322c:	48 83 ec 30          	sub    $0x30,%rsp
+  803230:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803233:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803236:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80323a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80323d:	48 89 d6             	mov    %rdx,%rsi
+  803240:	89 c7                	mov    %eax,%edi
+  803242:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+  80324e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803251:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803255:	78 24                	js     80327b <ftruncate+0x53>
+  803257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80325b:	8b 00                	mov    (%rax),%eax
+  80325d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803261:	48 89 d6             	mov    %rdx,%rsi
+  803264:	89 c7                	mov    %eax,%edi
+  803266:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  80326d:	00 00 00 
+  803270:	ff d0                	call   *%rax
+  803272:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803275:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803279:	79 08                	jns    803283 <ftruncate+0x5b>
+    return r;
+  80327b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80327e:	e9 92 00 00 00       	jmp    803315 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803287:	8b 40 08             	mov    0x8(%rax),%eax
+  80328a:	83 e0 03             	and    $0x3,%eax
+  80328d:	85 c0                	test   %eax,%eax
+  80328f:	75 5a                	jne    8032eb <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803291:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803298:	00 00 00 
+  80329b:	8b 40 04             	mov    0x4(%rax),%eax
+  80329e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032a3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8032aa:	00 00 00 
+  8032ad:	48 98                	cltq
+  8032af:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8032b6:	48 01 d0             	add    %rdx,%rax
+  8032b9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8032bf:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8032c1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8032c4:	89 c6                	mov    %eax,%esi
+  8032c6:	48 b8 b0 57 80 00 00 	movabs $0x8057b0,%rax
+  8032cd:	00 00 00 
+  8032d0:	48 89 c7             	mov    %rax,%rdi
+  8032d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d8:	48 b9 75 04 80 00 00 	movabs $0x800475,%rcx
+  8032df:	00 00 00 
+  8032e2:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8032e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032e9:	eb 2a                	jmp    803315 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8032eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032ef:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8032f3:	48 85 c0             	test   %rax,%rax
+  8032f6:	75 07                	jne    8032ff <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8032f8:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8032fd:	eb 16                	jmp    803315 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8032ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803303:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80330b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80330e:	89 d6                	mov    %edx,%esi
+  803310:	48 89 c7             	mov    %rax,%rdi
+  803313:	ff d1                	call   *%rcx
+}
+  803315:	c9                   	leave
+  803316:	c3                   	ret
+
+0000000000803317 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803317:	55                   	push   %rbp
+  803318:	48 89 e5             	mov    %rsp,%rbp
+  80331b:	48 83 ec 30          	sub    $0x30,%rsp
+  80331f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803322:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803326:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80332a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80332d:	48 89 d6             	mov    %rdx,%rsi
+  803330:	89 c7                	mov    %eax,%edi
+  803332:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  803339:	00 00 00 
+  80333c:	ff d0                	call   *%rax
+  80333e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803341:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803345:	78 24                	js     80336b <fstat+0x54>
+  803347:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80334b:	8b 00                	mov    (%rax),%eax
+  80334d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803351:	48 89 d6             	mov    %rdx,%rsi
+  803354:	89 c7                	mov    %eax,%edi
+  803356:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803365:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803369:	79 05                	jns    803370 <fstat+0x59>
+    return r;
+  80336b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80336e:	eb 5e                	jmp    8033ce <fstat+0xb7>
+  if (!dev->dev_stat)
+  803370:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803374:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803378:	48 85 c0             	test   %rax,%rax
+  80337b:	75 07                	jne    803384 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80337d:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803382:	eb 4a                	jmp    8033ce <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803384:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803388:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80338b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80338f:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803396:	00 00 00 
+  stat->st_isdir   = 0;
+  803399:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80339d:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8033a4:	00 00 00 
+  stat->st_dev     = dev;
+  8033a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033af:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8033b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033ba:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8033be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033c2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033c6:	48 89 d6             	mov    %rdx,%rsi
+  8033c9:	48 89 c7             	mov    %rax,%rdi
+  8033cc:	ff d1                	call   *%rcx
+}
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+
+00000000008033d0 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8033d0:	55                   	push   %rbp
+  8033d1:	48 89 e5             	mov    %rsp,%rbp
+  8033d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8033d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8033e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e4:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8033ea:	83 f8 20             	cmp    $0x20,%eax
+  8033ed:	75 07                	jne    8033f6 <pollwait_key+0x26>
+    return -E_INVAL;
+  8033ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f4:	eb 5f                	jmp    803455 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8033f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033fa:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803404:	48 63 d2             	movslq %edx,%rdx
+  803407:	48 c1 e2 04          	shl    $0x4,%rdx
+  80340b:	48 01 c2             	add    %rax,%rdx
+  80340e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803412:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803419:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80341f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803423:	8b 00                	mov    (%rax),%eax
+  803425:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803429:	48 63 c9             	movslq %ecx,%rcx
+  80342c:	48 c1 e1 04          	shl    $0x4,%rcx
+  803430:	48 01 ca             	add    %rcx,%rdx
+  803433:	48 83 c2 08          	add    $0x8,%rdx
+  803437:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343d:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803443:	8d 50 01             	lea    0x1(%rax),%edx
+  803446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80344a:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+
+0000000000803457 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803457:	55                   	push   %rbp
+  803458:	48 89 e5             	mov    %rsp,%rbp
+  80345b:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803462:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803469:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80346f:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803476:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80347d:	00 
+  int i, r, ready, ipc = 0;
+  80347e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803485:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80348c:	00 
+  80348d:	74 45                	je     8034d4 <poll+0x7d>
+  80348f:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803496:	ff 
+  803497:	74 3b                	je     8034d4 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803499:	48 b8 92 49 80 00 00 	movabs $0x804992,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+  8034a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8034a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034ad:	48 f7 d0             	not    %rax
+  8034b0:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8034b7:	73 10                	jae    8034c9 <poll+0x72>
+  8034b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034bd:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8034c4:	48 01 d0             	add    %rdx,%rax
+  8034c7:	eb 07                	jmp    8034d0 <poll+0x79>
+  8034c9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8034d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8034d4:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8034db:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8034e2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8034e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8034f0:	e9 46 02 00 00       	jmp    80373b <poll+0x2e4>
+      fds[i].revents = 0;
+  8034f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034f8:	48 63 d0             	movslq %eax,%rdx
+  8034fb:	48 89 d0             	mov    %rdx,%rax
+  8034fe:	48 01 c0             	add    %rax,%rax
+  803501:	48 01 d0             	add    %rdx,%rax
+  803504:	48 c1 e0 02          	shl    $0x2,%rax
+  803508:	48 89 c2             	mov    %rax,%rdx
+  80350b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803512:	48 01 d0             	add    %rdx,%rax
+  803515:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  80351c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80351f:	48 63 d0             	movslq %eax,%rdx
+  803522:	48 89 d0             	mov    %rdx,%rax
+  803525:	48 01 c0             	add    %rax,%rax
+  803528:	48 01 d0             	add    %rdx,%rax
+  80352b:	48 c1 e0 02          	shl    $0x2,%rax
+  80352f:	48 89 c2             	mov    %rax,%rdx
+  803532:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803539:	48 01 d0             	add    %rdx,%rax
+  80353c:	8b 00                	mov    (%rax),%eax
+  80353e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803541:	75 62                	jne    8035a5 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803543:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803546:	48 63 d0             	movslq %eax,%rdx
+  803549:	48 89 d0             	mov    %rdx,%rax
+  80354c:	48 01 c0             	add    %rax,%rax
+  80354f:	48 01 d0             	add    %rdx,%rax
+  803552:	48 c1 e0 02          	shl    $0x2,%rax
+  803556:	48 89 c2             	mov    %rax,%rdx
+  803559:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803560:	48 01 d0             	add    %rdx,%rax
+  803563:	8b 40 04             	mov    0x4(%rax),%eax
+  803566:	83 e0 01             	and    $0x1,%eax
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	0f 84 9b 01 00 00    	je     80370c <poll+0x2b5>
+          fds[i].revents = ipc;
+  803571:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803574:	48 63 d0             	movslq %eax,%rdx
+  803577:	48 89 d0             	mov    %rdx,%rax
+  80357a:	48 01 c0             	add    %rax,%rax
+  80357d:	48 01 d0             	add    %rdx,%rax
+  803580:	48 c1 e0 02          	shl    $0x2,%rax
+  803584:	48 89 c2             	mov    %rax,%rdx
+  803587:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80358e:	48 01 c2             	add    %rax,%rdx
+  803591:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803594:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803597:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80359a:	83 c8 04             	or     $0x4,%eax
+  80359d:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8035a0:	e9 67 01 00 00       	jmp    80370c <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8035a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035a8:	48 63 d0             	movslq %eax,%rdx
+  8035ab:	48 89 d0             	mov    %rdx,%rax
+  8035ae:	48 01 c0             	add    %rax,%rax
+  8035b1:	48 01 d0             	add    %rdx,%rax
+  8035b4:	48 c1 e0 02          	shl    $0x2,%rax
+  8035b8:	48 89 c2             	mov    %rax,%rdx
+  8035bb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035c2:	48 01 d0             	add    %rdx,%rax
+  8035c5:	8b 00                	mov    (%rax),%eax
+  8035c7:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8035ce:	48 89 d6             	mov    %rdx,%rsi
+  8035d1:	89 c7                	mov    %eax,%edi
+  8035d3:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+  8035df:	85 c0                	test   %eax,%eax
+  8035e1:	78 25                	js     803608 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8035e3:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8035ea:	8b 00                	mov    (%rax),%eax
+  8035ec:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8035f3:	48 89 d6             	mov    %rdx,%rsi
+  8035f6:	89 c7                	mov    %eax,%edi
+  8035f8:	48 b8 ab 2b 80 00 00 	movabs $0x802bab,%rax
+  8035ff:	00 00 00 
+  803602:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803604:	85 c0                	test   %eax,%eax
+  803606:	79 2c                	jns    803634 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803608:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80360b:	48 63 d0             	movslq %eax,%rdx
+  80360e:	48 89 d0             	mov    %rdx,%rax
+  803611:	48 01 c0             	add    %rax,%rax
+  803614:	48 01 d0             	add    %rdx,%rax
+  803617:	48 c1 e0 02          	shl    $0x2,%rax
+  80361b:	48 89 c2             	mov    %rax,%rdx
+  80361e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803625:	48 01 d0             	add    %rdx,%rax
+  803628:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80362f:	e9 d8 00 00 00       	jmp    80370c <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803634:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80363b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80363f:	48 85 c0             	test   %rax,%rax
+  803642:	74 7d                	je     8036c1 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803644:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80364b:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80364f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803652:	48 63 d0             	movslq %eax,%rdx
+  803655:	48 89 d0             	mov    %rdx,%rax
+  803658:	48 01 c0             	add    %rax,%rax
+  80365b:	48 01 d0             	add    %rdx,%rax
+  80365e:	48 c1 e0 02          	shl    $0x2,%rax
+  803662:	48 89 c2             	mov    %rax,%rdx
+  803665:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80366c:	48 01 d0             	add    %rdx,%rax
+  80366f:	8b 48 04             	mov    0x4(%rax),%ecx
+  803672:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803679:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803680:	89 ce                	mov    %ecx,%esi
+  803682:	48 89 c7             	mov    %rax,%rdi
+  803685:	41 ff d0             	call   *%r8
+  803688:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80368b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80368f:	79 08                	jns    803699 <poll+0x242>
+          return r;
+  803691:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803694:	e9 45 01 00 00       	jmp    8037de <poll+0x387>
+        fds[i].revents = r;
+  803699:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80369c:	48 63 d0             	movslq %eax,%rdx
+  80369f:	48 89 d0             	mov    %rdx,%rax
+  8036a2:	48 01 c0             	add    %rax,%rax
+  8036a5:	48 01 d0             	add    %rdx,%rax
+  8036a8:	48 c1 e0 02          	shl    $0x2,%rax
+  8036ac:	48 89 c2             	mov    %rax,%rdx
+  8036af:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036b6:	48 01 c2             	add    %rax,%rdx
+  8036b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036bc:	89 42 08             	mov    %eax,0x8(%rdx)
+  8036bf:	eb 4b                	jmp    80370c <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8036c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036c4:	48 63 d0             	movslq %eax,%rdx
+  8036c7:	48 89 d0             	mov    %rdx,%rax
+  8036ca:	48 01 c0             	add    %rax,%rax
+  8036cd:	48 01 d0             	add    %rdx,%rax
+  8036d0:	48 c1 e0 02          	shl    $0x2,%rax
+  8036d4:	48 89 c2             	mov    %rax,%rdx
+  8036d7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8036de:	48 01 d0             	add    %rdx,%rax
+  8036e1:	8b 48 04             	mov    0x4(%rax),%ecx
+  8036e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8036e7:	48 63 d0             	movslq %eax,%rdx
+  8036ea:	48 89 d0             	mov    %rdx,%rax
+  8036ed:	48 01 c0             	add    %rax,%rax
+  8036f0:	48 01 d0             	add    %rdx,%rax
+  8036f3:	48 c1 e0 02          	shl    $0x2,%rax
+  8036f7:	48 89 c2             	mov    %rax,%rdx
+  8036fa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803701:	48 01 d0             	add    %rdx,%rax
+  803704:	83 e1 03             	and    $0x3,%ecx
+  803707:	89 ca                	mov    %ecx,%edx
+  803709:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  80370c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80370f:	48 63 d0             	movslq %eax,%rdx
+  803712:	48 89 d0             	mov    %rdx,%rax
+  803715:	48 01 c0             	add    %rax,%rax
+  803718:	48 01 d0             	add    %rdx,%rax
+  80371b:	48 c1 e0 02          	shl    $0x2,%rax
+  80371f:	48 89 c2             	mov    %rax,%rdx
+  803722:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803729:	48 01 d0             	add    %rdx,%rax
+  80372c:	8b 40 08             	mov    0x8(%rax),%eax
+  80372f:	85 c0                	test   %eax,%eax
+  803731:	74 04                	je     803737 <poll+0x2e0>
+        ready++;
+  803733:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803737:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80373b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80373e:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803744:	0f 8c ab fd ff ff    	jl     8034f5 <poll+0x9e>
+    }
+    if (ready)
+  80374a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80374e:	74 08                	je     803758 <poll+0x301>
+      return ready;
+  803750:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803753:	e9 86 00 00 00       	jmp    8037de <poll+0x387>
+
+    if (deadline) {
+  803758:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80375d:	74 30                	je     80378f <poll+0x338>
+      now     = vsys_clock_ns();
+  80375f:	48 b8 92 49 80 00 00 	movabs $0x804992,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+  80376b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80376f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803773:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803777:	73 0a                	jae    803783 <poll+0x32c>
+  803779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80377d:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803781:	eb 05                	jmp    803788 <poll+0x331>
+  803783:	b8 00 00 00 00       	mov    $0x0,%eax
+  803788:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80378f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803792:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803795:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80379c:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8037a3:	48 89 c7             	mov    %rax,%rdi
+  8037a6:	48 b8 3b 26 80 00 00 	movabs $0x80263b,%rax
+  8037ad:	00 00 00 
+  8037b0:	ff d0                	call   *%rax
+  8037b2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8037b5:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8037b9:	75 07                	jne    8037c2 <poll+0x36b>
+      return 0;
+  8037bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c0:	eb 1c                	jmp    8037de <poll+0x387>
+    if (r < 0)
+  8037c2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037c6:	79 05                	jns    8037cd <poll+0x376>
+      return r;
+  8037c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037cb:	eb 11                	jmp    8037de <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8037cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037d0:	c1 f8 02             	sar    $0x2,%eax
+  8037d3:	83 e0 01             	and    $0x1,%eax
+  8037d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8037d9:	e9 f6 fc ff ff       	jmp    8034d4 <poll+0x7d>
+  }
+}
+  8037de:	c9                   	leave
+  8037df:	c3                   	ret
+
+00000000008037e0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037e0:	55                   	push   %rbp
+  8037e1:	48 89 e5             	mov    %rsp,%rbp
+  8037e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8037e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8037ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8037f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f9:	48 89 c7             	mov    %rax,%rdi
+  8037fc:	48 b8 ce 38 80 00 00 	movabs $0x8038ce,%rax
+  803803:	00 00 00 
+  803806:	ff d0                	call   *%rax
+  803808:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80380b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80380f:	79 05                	jns    803816 <stat+0x36>
+    return fd;
+  803811:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803814:	eb 2f                	jmp    803845 <stat+0x65>
+  r = fstat(fd, stat);
+  803816:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80381a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80381d:	48 89 d6             	mov    %rdx,%rsi
+  803820:	89 c7                	mov    %eax,%edi
+  803822:	48 b8 17 33 80 00 00 	movabs $0x803317,%rax
+  803829:	00 00 00 
+  80382c:	ff d0                	call   *%rax
+  80382e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803831:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803834:	89 c7                	mov    %eax,%edi
+  803836:	48 b8 7f 2c 80 00 00 	movabs $0x802c7f,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+  return r;
+  803842:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803845:	c9                   	leave
+  803846:	c3                   	ret
+
+0000000000803847 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	48 83 ec 10          	sub    $0x10,%rsp
+  80384f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803852:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803856:	48 b8 00 80 c0 00 00 	movabs $0xc08000,%rax
+  80385d:	00 00 00 
+  803860:	8b 00                	mov    (%rax),%eax
+  803862:	85 c0                	test   %eax,%eax
+  803864:	75 1d                	jne    803883 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803866:	bf 03 00 00 00       	mov    $0x3,%edi
+  80386b:	48 b8 ad 4f 80 00 00 	movabs $0x804fad,%rax
+  803872:	00 00 00 
+  803875:	ff d0                	call   *%rax
+  803877:	48 ba 00 80 c0 00 00 	movabs $0xc08000,%rdx
+  80387e:	00 00 00 
+  803881:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803883:	48 b8 00 80 c0 00 00 	movabs $0xc08000,%rax
+  80388a:	00 00 00 
+  80388d:	8b 00                	mov    (%rax),%eax
+  80388f:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803892:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803897:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  80389e:	00 00 00 
+  8038a1:	89 c7                	mov    %eax,%edi
+  8038a3:	48 b8 00 4f 80 00 00 	movabs $0x804f00,%rax
+  8038aa:	00 00 00 
+  8038ad:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8038af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038b8:	48 89 c6             	mov    %rax,%rsi
+  8038bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c0:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+}
+  8038cc:	c9                   	leave
+  8038cd:	c3                   	ret
+
+00000000008038ce <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8038ce:	55                   	push   %rbp
+  8038cf:	48 89 e5             	mov    %rsp,%rbp
+  8038d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8038d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8038da:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8038dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038e1:	48 89 c7             	mov    %rax,%rdi
+  8038e4:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+  8038f0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8038f5:	7e 0a                	jle    803901 <open+0x33>
+    return -E_BAD_PATH;
+  8038f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8038fc:	e9 a8 00 00 00       	jmp    8039a9 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803901:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803905:	48 89 c7             	mov    %rax,%rdi
+  803908:	48 b8 28 29 80 00 00 	movabs $0x802928,%rax
+  80390f:	00 00 00 
+  803912:	ff d0                	call   *%rax
+  803914:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803917:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80391b:	79 08                	jns    803925 <open+0x57>
+    return r;
+  80391d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803920:	e9 84 00 00 00       	jmp    8039a9 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803925:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803929:	48 89 c6             	mov    %rax,%rsi
+  80392c:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  803933:	00 00 00 
+  803936:	48 89 c7             	mov    %rax,%rdi
+  803939:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  803940:	00 00 00 
+  803943:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803945:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  80394c:	00 00 00 
+  80394f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803952:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803958:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80395c:	48 89 c6             	mov    %rax,%rsi
+  80395f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803964:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+  803970:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803973:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803977:	79 1d                	jns    803996 <open+0xc8>
+    fd_close(fd, 0);
+  803979:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80397d:	be 00 00 00 00       	mov    $0x0,%esi
+  803982:	48 89 c7             	mov    %rax,%rdi
+  803985:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+    return r;
+  803991:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803994:	eb 13                	jmp    8039a9 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803996:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80399a:	48 89 c7             	mov    %rax,%rdi
+  80399d:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  8039a4:	00 00 00 
+  8039a7:	ff d0                	call   *%rax
+}
+  8039a9:	c9                   	leave
+  8039aa:	c3                   	ret
+
+00000000008039ab <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8039ab:	55                   	push   %rbp
+  8039ac:	48 89 e5             	mov    %rsp,%rbp
+  8039af:	48 83 ec 10          	sub    $0x10,%rsp
+  8039b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8039b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039bb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039be:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  8039c5:	00 00 00 
+  8039c8:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8039ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8039cf:	bf 06 00 00 00       	mov    $0x6,%edi
+  8039d4:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+}
+  8039e0:	c9                   	leave
+  8039e1:	c3                   	ret
+
+00000000008039e2 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8039e2:	55                   	push   %rbp
+  8039e3:	48 89 e5             	mov    %rsp,%rbp
+  8039e6:	48 83 ec 30          	sub    $0x30,%rsp
+  8039ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8039ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8039f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8039f6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8039fb:	74 07                	je     803a04 <devfile_read+0x22>
+  8039fd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803a02:	75 0a                	jne    803a0e <devfile_read+0x2c>
+  return E_INVAL;
+  803a04:	b8 03 00 00 00       	mov    $0x3,%eax
+  803a09:	e9 b4 00 00 00       	jmp    803ac2 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803a0e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a15:	00 
+  while (n) {
+  803a16:	e9 98 00 00 00       	jmp    803ab3 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a1f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a22:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803a29:	00 00 00 
+  803a2c:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803a2e:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803a35:	00 00 00 
+  803a38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a3c:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803a40:	be 00 00 00 00       	mov    $0x0,%esi
+  803a45:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a4a:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803a51:	00 00 00 
+  803a54:	ff d0                	call   *%rax
+  803a56:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803a59:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803a5d:	7f 13                	jg     803a72 <devfile_read+0x90>
+      return res ? res : res0;
+  803a5f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803a63:	74 07                	je     803a6c <devfile_read+0x8a>
+  803a65:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a68:	48 98                	cltq
+  803a6a:	eb 56                	jmp    803ac2 <devfile_read+0xe0>
+  803a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a70:	eb 50                	jmp    803ac2 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803a72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a75:	48 63 d0             	movslq %eax,%rdx
+  803a78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a7c:	48 b9 00 70 c0 00 00 	movabs $0xc07000,%rcx
+  803a83:	00 00 00 
+  803a86:	48 89 ce             	mov    %rcx,%rsi
+  803a89:	48 89 c7             	mov    %rax,%rdi
+  803a8c:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+
+    buf += res;
+  803a98:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a9b:	48 98                	cltq
+  803a9d:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803aa1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803aa4:	48 98                	cltq
+  803aa6:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803aaa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803aad:	48 98                	cltq
+  803aaf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803ab3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803ab8:	0f 85 5d ff ff ff    	jne    803a1b <devfile_read+0x39>
+  }
+
+  return res0;
+  803abe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803ac2:	c9                   	leave
+  803ac3:	c3                   	ret
+
+0000000000803ac4 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ac4:	55                   	push   %rbp
+  803ac5:	48 89 e5             	mov    %rsp,%rbp
+  803ac8:	48 83 ec 50          	sub    $0x50,%rsp
+  803acc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ad0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ad4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803ad8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803add:	74 07                	je     803ae6 <devfile_write+0x22>
+  803adf:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803ae4:	75 0a                	jne    803af0 <devfile_write+0x2c>
+  return E_INVAL;
+  803ae6:	b8 03 00 00 00       	mov    $0x3,%eax
+  803aeb:	e9 c9 00 00 00       	jmp    803bb9 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803af0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803af7:	00 
+
+  while (n) {
+  803af8:	e9 ad 00 00 00       	jmp    803baa <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803afd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803b01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803b05:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803b0c:	00 
+  803b0d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b15:	48 39 c2             	cmp    %rax,%rdx
+  803b18:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803b1c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803b20:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b24:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b28:	48 89 c6             	mov    %rax,%rsi
+  803b2b:	48 b8 10 70 c0 00 00 	movabs $0xc07010,%rax
+  803b32:	00 00 00 
+  803b35:	48 89 c7             	mov    %rax,%rdi
+  803b38:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b48:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b4b:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803b52:	00 00 00 
+  803b55:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803b57:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803b5e:	00 00 00 
+  803b61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b65:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803b69:	be 00 00 00 00       	mov    $0x0,%esi
+  803b6e:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b73:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803b7a:	00 00 00 
+  803b7d:	ff d0                	call   *%rax
+  803b7f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803b82:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803b86:	79 07                	jns    803b8f <devfile_write+0xcb>
+      return res;
+  803b88:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b8b:	48 98                	cltq
+  803b8d:	eb 2a                	jmp    803bb9 <devfile_write+0xf5>
+
+    buf += res;
+  803b8f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b92:	48 98                	cltq
+  803b94:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803b98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b9b:	48 98                	cltq
+  803b9d:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803ba1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ba4:	48 98                	cltq
+  803ba6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803baa:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803baf:	0f 85 48 ff ff ff    	jne    803afd <devfile_write+0x39>
+  }
+
+  return res0;
+  803bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803bb9:	c9                   	leave
+  803bba:	c3                   	ret
+
+0000000000803bbb <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803bbb:	55                   	push   %rbp
+  803bbc:	48 89 e5             	mov    %rsp,%rbp
+  803bbf:	48 83 ec 20          	sub    $0x20,%rsp
+  803bc3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803bc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bcf:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bd2:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803bd9:	00 00 00 
+  803bdc:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803bde:	be 00 00 00 00       	mov    $0x0,%esi
+  803be3:	bf 05 00 00 00       	mov    $0x5,%edi
+  803be8:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803bef:	00 00 00 
+  803bf2:	ff d0                	call   *%rax
+  803bf4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bf7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bfb:	79 05                	jns    803c02 <devfile_stat+0x47>
+    return r;
+  803bfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c00:	eb 59                	jmp    803c5b <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c06:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803c0d:	00 00 00 
+  803c10:	48 89 d6             	mov    %rdx,%rsi
+  803c13:	48 89 c7             	mov    %rax,%rdi
+  803c16:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803c22:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  803c29:	00 00 00 
+  803c2c:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803c32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c36:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c3c:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  803c43:	00 00 00 
+  803c46:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803c4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c50:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803c56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c5b:	c9                   	leave
+  803c5c:	c3                   	ret
+
+0000000000803c5d <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803c5d:	55                   	push   %rbp
+  803c5e:	48 89 e5             	mov    %rsp,%rbp
+  803c61:	48 83 ec 10          	sub    $0x10,%rsp
+  803c65:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c69:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803c6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c70:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c73:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803c7a:	00 00 00 
+  803c7d:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803c7f:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803c86:	00 00 00 
+  803c89:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c8c:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  803c94:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c99:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803ca0:	00 00 00 
+  803ca3:	ff d0                	call   *%rax
+}
+  803ca5:	c9                   	leave
+  803ca6:	c3                   	ret
+
+0000000000803ca7 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803ca7:	55                   	push   %rbp
+  803ca8:	48 89 e5             	mov    %rsp,%rbp
+  803cab:	48 83 ec 18          	sub    $0x18,%rsp
+  803caf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803cb3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803cb6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803cba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cbd:	83 e0 03             	and    $0x3,%eax
+}
+  803cc0:	c9                   	leave
+  803cc1:	c3                   	ret
+
+0000000000803cc2 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803cc2:	55                   	push   %rbp
+  803cc3:	48 89 e5             	mov    %rsp,%rbp
+  803cc6:	48 83 ec 10          	sub    $0x10,%rsp
+  803cca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cd2:	48 89 c7             	mov    %rax,%rdi
+  803cd5:	48 b8 24 13 80 00 00 	movabs $0x801324,%rax
+  803cdc:	00 00 00 
+  803cdf:	ff d0                	call   *%rax
+  803ce1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803ce6:	7e 07                	jle    803cef <remove+0x2d>
+    return -E_BAD_PATH;
+  803ce8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ced:	eb 36                	jmp    803d25 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803cef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cf3:	48 89 c6             	mov    %rax,%rsi
+  803cf6:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  803cfd:	00 00 00 
+  803d00:	48 89 c7             	mov    %rax,%rdi
+  803d03:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  803d0a:	00 00 00 
+  803d0d:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  803d14:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d19:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803d20:	00 00 00 
+  803d23:	ff d0                	call   *%rax
+}
+  803d25:	c9                   	leave
+  803d26:	c3                   	ret
+
+0000000000803d27 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803d27:	55                   	push   %rbp
+  803d28:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d30:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d35:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803d3c:	00 00 00 
+  803d3f:	ff d0                	call   *%rax
+}
+  803d41:	5d                   	pop    %rbp
+  803d42:	c3                   	ret
+
+0000000000803d43 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803d43:	55                   	push   %rbp
+  803d44:	48 89 e5             	mov    %rsp,%rbp
+  803d47:	48 83 ec 20          	sub    $0x20,%rsp
+  803d4b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803d4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803d54:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d59:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+  803d65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d6c:	79 05                	jns    803d73 <fs_stats+0x30>
+    return r;
+  803d6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d71:	eb 2a                	jmp    803d9d <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803d73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d77:	ba 68 00 00 00       	mov    $0x68,%edx
+  803d7c:	48 b9 00 70 c0 00 00 	movabs $0xc07000,%rcx
+  803d83:	00 00 00 
+  803d86:	48 89 ce             	mov    %rcx,%rsi
+  803d89:	48 89 c7             	mov    %rax,%rdi
+  803d8c:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803d93:	00 00 00 
+  803d96:	ff d0                	call   *%rax
+  return 0;
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d9d:	c9                   	leave
+  803d9e:	c3                   	ret
+
+0000000000803d9f <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803d9f:	55                   	push   %rbp
+  803da0:	48 89 e5             	mov    %rsp,%rbp
+  803da3:	48 83 ec 10          	sub    $0x10,%rsp
+  803da7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803daa:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803db1:	00 00 00 
+  803db4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803db7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803db9:	be 00 00 00 00       	mov    $0x0,%esi
+  803dbe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803dc3:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+}
+  803dcf:	c9                   	leave
+  803dd0:	c3                   	ret
+
+0000000000803dd1 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803dd1:	55                   	push   %rbp
+  803dd2:	48 89 e5             	mov    %rsp,%rbp
+  803dd5:	48 83 ec 10          	sub    $0x10,%rsp
+  803dd9:	89 f8                	mov    %edi,%eax
+  803ddb:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803dde:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803de2:	48 ba 00 70 c0 00 00 	movabs $0xc07000,%rdx
+  803de9:	00 00 00 
+  803dec:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803dee:	be 00 00 00 00       	mov    $0x0,%esi
+  803df3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803df8:	48 b8 47 38 80 00 00 	movabs $0x803847,%rax
+  803dff:	00 00 00 
+  803e02:	ff d0                	call   *%rax
+}
+  803e04:	c9                   	leave
+  803e05:	c3                   	ret
+
+0000000000803e06 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803e06:	55                   	push   %rbp
+  803e07:	48 89 e5             	mov    %rsp,%rbp
+  803e0a:	48 83 ec 10          	sub    $0x10,%rsp
+  803e0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803e12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e16:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803e1b:	48 89 c7             	mov    %rax,%rdi
+  803e1e:	48 b8 2c 3e 80 00 00 	movabs $0x803e2c,%rax
+  803e25:	00 00 00 
+  803e28:	ff d0                	call   *%rax
+}
+  803e2a:	c9                   	leave
+  803e2b:	c3                   	ret
+
+0000000000803e2c <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	48 83 ec 50          	sub    $0x50,%rsp
+  803e34:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803e38:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803e3c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803e43:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803e44:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803e49:	74 0a                	je     803e55 <pipe_size+0x29>
+  803e4b:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803e52:	00 
+  803e53:	76 0a                	jbe    803e5f <pipe_size+0x33>
+    return -E_INVAL;
+  803e55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e5a:	e9 cc 02 00 00       	jmp    80412b <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803e5f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803e63:	48 89 c7             	mov    %rax,%rdi
+  803e66:	48 b8 28 29 80 00 00 	movabs $0x802928,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+  803e72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e79:	0f 88 a8 02 00 00    	js     804127 <pipe_size+0x2fb>
+  803e7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e83:	ba 07 04 00 00       	mov    $0x407,%edx
+  803e88:	48 89 c6             	mov    %rax,%rsi
+  803e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e90:	48 b8 f3 21 80 00 00 	movabs $0x8021f3,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+  803e9c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ea3:	0f 88 7e 02 00 00    	js     804127 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803ea9:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803ead:	48 89 c7             	mov    %rax,%rdi
+  803eb0:	48 b8 28 29 80 00 00 	movabs $0x802928,%rax
+  803eb7:	00 00 00 
+  803eba:	ff d0                	call   *%rax
+  803ebc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ebf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ec3:	0f 88 43 02 00 00    	js     80410c <pipe_size+0x2e0>
+  803ec9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ecd:	ba 07 04 00 00       	mov    $0x407,%edx
+  803ed2:	48 89 c6             	mov    %rax,%rsi
+  803ed5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eda:	48 b8 f3 21 80 00 00 	movabs $0x8021f3,%rax
+  803ee1:	00 00 00 
+  803ee4:	ff d0                	call   *%rax
+  803ee6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ee9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803eed:	0f 88 19 02 00 00    	js     80410c <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803ef3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ef7:	48 89 c7             	mov    %rax,%rdi
+  803efa:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  803f01:	00 00 00 
+  803f04:	ff d0                	call   *%rax
+  803f06:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803f0a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803f11:	00 
+  803f12:	e9 a2 00 00 00       	jmp    803fb9 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f1b:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f1f:	48 89 c2             	mov    %rax,%rdx
+  803f22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f26:	48 01 d0             	add    %rdx,%rax
+  803f29:	ba 07 04 00 00       	mov    $0x407,%edx
+  803f2e:	48 89 c6             	mov    %rax,%rsi
+  803f31:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f36:	48 b8 f3 21 80 00 00 	movabs $0x8021f3,%rax
+  803f3d:	00 00 00 
+  803f40:	ff d0                	call   *%rax
+  803f42:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f45:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f49:	0f 88 37 01 00 00    	js     804086 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803f4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f53:	48 89 c7             	mov    %rax,%rdi
+  803f56:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  803f5d:	00 00 00 
+  803f60:	ff d0                	call   *%rax
+  803f62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f66:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803f6a:	48 01 c2             	add    %rax,%rdx
+  803f6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f71:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f75:	48 89 c1             	mov    %rax,%rcx
+  803f78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f7c:	48 01 c8             	add    %rcx,%rax
+  803f7f:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803f85:	48 89 d1             	mov    %rdx,%rcx
+  803f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f8d:	48 89 c6             	mov    %rax,%rsi
+  803f90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f95:	48 b8 4b 22 80 00 00 	movabs $0x80224b,%rax
+  803f9c:	00 00 00 
+  803f9f:	ff d0                	call   *%rax
+  803fa1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fa4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fa8:	79 0a                	jns    803fb4 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803faa:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803faf:	e9 d3 00 00 00       	jmp    804087 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803fb4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803fb9:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803fc0:	00 
+  803fc1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803fc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fc9:	48 01 d0             	add    %rdx,%rax
+  803fcc:	48 83 c0 1f          	add    $0x1f,%rax
+  803fd0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803fd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fdd:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803fe1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fe5:	48 29 d0             	sub    %rdx,%rax
+  803fe8:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fec:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803ff0:	0f 82 21 ff ff ff    	jb     803f17 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803ff6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ffa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803ffe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804002:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804006:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80400a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80400e:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804015:	00 00 00 
+  804018:	8b 12                	mov    (%rdx),%edx
+  80401a:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  80401c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804020:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804027:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80402b:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804032:	00 00 00 
+  804035:	8b 12                	mov    (%rdx),%edx
+  804037:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804039:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80403d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804044:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804048:	48 89 c7             	mov    %rax,%rdi
+  80404b:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+  804057:	89 c2                	mov    %eax,%edx
+  804059:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80405d:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  80405f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804063:	48 89 c7             	mov    %rax,%rdi
+  804066:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+  804072:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804076:	48 83 c2 04          	add    $0x4,%rdx
+  80407a:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  80407c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804081:	e9 a5 00 00 00       	jmp    80412b <pipe_size+0x2ff>
+      goto err2;
+  804086:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804087:	eb 58                	jmp    8040e1 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804089:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80408d:	48 c1 e0 0c          	shl    $0xc,%rax
+  804091:	48 89 c2             	mov    %rax,%rdx
+  804094:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804098:	48 01 d0             	add    %rdx,%rax
+  80409b:	48 89 c6             	mov    %rax,%rsi
+  80409e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a3:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  8040aa:	00 00 00 
+  8040ad:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8040af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040b3:	48 89 c7             	mov    %rax,%rdi
+  8040b6:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  8040bd:	00 00 00 
+  8040c0:	ff d0                	call   *%rax
+  8040c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040c6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8040ca:	48 01 d0             	add    %rdx,%rax
+  8040cd:	48 89 c6             	mov    %rax,%rsi
+  8040d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d5:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8040e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040e5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8040e9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8040ed:	48 85 c0             	test   %rax,%rax
+  8040f0:	75 97                	jne    804089 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8040f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040f6:	48 89 c6             	mov    %rax,%rsi
+  8040f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fe:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  804105:	00 00 00 
+  804108:	ff d0                	call   *%rax
+  80410a:	eb 01                	jmp    80410d <pipe_size+0x2e1>
+    goto err1;
+  80410c:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  80410d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804111:	48 89 c6             	mov    %rax,%rsi
+  804114:	bf 00 00 00 00       	mov    $0x0,%edi
+  804119:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  804120:	00 00 00 
+  804123:	ff d0                	call   *%rax
+  804125:	eb 01                	jmp    804128 <pipe_size+0x2fc>
+    goto err;
+  804127:	90                   	nop
+err:
+  return r;
+  804128:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80412b:	c9                   	leave
+  80412c:	c3                   	ret
+
+000000000080412d <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80412d:	55                   	push   %rbp
+  80412e:	48 89 e5             	mov    %rsp,%rbp
+  804131:	53                   	push   %rbx
+  804132:	48 83 ec 28          	sub    $0x28,%rsp
+  804136:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80413a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  80413e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804145:	00 00 00 
+  804148:	8b 40 04             	mov    0x4(%rax),%eax
+  80414b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804150:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804157:	00 00 00 
+  80415a:	48 98                	cltq
+  80415c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804163:	48 01 d0             	add    %rdx,%rax
+  804166:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80416c:	8b 00                	mov    (%rax),%eax
+  80416e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804171:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804175:	48 89 c7             	mov    %rax,%rdi
+  804178:	48 b8 1e 50 80 00 00 	movabs $0x80501e,%rax
+  80417f:	00 00 00 
+  804182:	ff d0                	call   *%rax
+  804184:	89 c3                	mov    %eax,%ebx
+  804186:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80418a:	48 89 c7             	mov    %rax,%rdi
+  80418d:	48 b8 1e 50 80 00 00 	movabs $0x80501e,%rax
+  804194:	00 00 00 
+  804197:	ff d0                	call   *%rax
+  804199:	39 c3                	cmp    %eax,%ebx
+  80419b:	0f 94 c0             	sete   %al
+  80419e:	0f b6 c0             	movzbl %al,%eax
+  8041a1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8041a4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8041ab:	00 00 00 
+  8041ae:	8b 40 04             	mov    0x4(%rax),%eax
+  8041b1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8041b6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8041bd:	00 00 00 
+  8041c0:	48 98                	cltq
+  8041c2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8041c9:	48 01 d0             	add    %rdx,%rax
+  8041cc:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8041d2:	8b 00                	mov    (%rax),%eax
+  8041d4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8041d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041da:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8041dd:	75 05                	jne    8041e4 <_pipeisclosed+0xb7>
+      return ret;
+  8041df:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8041e2:	eb 68                	jmp    80424c <_pipeisclosed+0x11f>
+    if (n != nn)
+  8041e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041e7:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8041ea:	0f 84 4e ff ff ff    	je     80413e <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8041f0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8041f7:	00 00 00 
+  8041fa:	8b 40 04             	mov    0x4(%rax),%eax
+  8041fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804202:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804209:	00 00 00 
+  80420c:	48 98                	cltq
+  80420e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804215:	48 01 d0             	add    %rdx,%rax
+  804218:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80421e:	8b 10                	mov    (%rax),%edx
+  804220:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804223:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804226:	89 c6                	mov    %eax,%esi
+  804228:	48 b8 e0 57 80 00 00 	movabs $0x8057e0,%rax
+  80422f:	00 00 00 
+  804232:	48 89 c7             	mov    %rax,%rdi
+  804235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423a:	49 b8 75 04 80 00 00 	movabs $0x800475,%r8
+  804241:	00 00 00 
+  804244:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804247:	e9 f2 fe ff ff       	jmp    80413e <_pipeisclosed+0x11>
+  }
+}
+  80424c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804250:	c9                   	leave
+  804251:	c3                   	ret
+
+0000000000804252 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804252:	55                   	push   %rbp
+  804253:	48 89 e5             	mov    %rsp,%rbp
+  804256:	48 83 ec 30          	sub    $0x30,%rsp
+  80425a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80425d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804261:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804264:	48 89 d6             	mov    %rdx,%rsi
+  804267:	89 c7                	mov    %eax,%edi
+  804269:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804270:	00 00 00 
+  804273:	ff d0                	call   *%rax
+  804275:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804278:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80427c:	79 05                	jns    804283 <pipeisclosed+0x31>
+    return r;
+  80427e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804281:	eb 31                	jmp    8042b4 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804287:	48 89 c7             	mov    %rax,%rdi
+  80428a:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  804291:	00 00 00 
+  804294:	ff d0                	call   *%rax
+  804296:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80429a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80429e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8042a2:	48 89 d6             	mov    %rdx,%rsi
+  8042a5:	48 89 c7             	mov    %rax,%rdi
+  8042a8:	48 b8 2d 41 80 00 00 	movabs $0x80412d,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+}
+  8042b4:	c9                   	leave
+  8042b5:	c3                   	ret
+
+00000000008042b6 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8042b6:	55                   	push   %rbp
+  8042b7:	48 89 e5             	mov    %rsp,%rbp
+  8042ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8042be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8042c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042c6:	8b 40 18             	mov    0x18(%rax),%eax
+  8042c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8042cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d0:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8042d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d7:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8042da:	85 c0                	test   %eax,%eax
+  8042dc:	74 27                	je     804305 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8042de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042e2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8042e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042ed:	48 83 c0 18          	add    $0x18,%rax
+  8042f1:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8042f6:	48 89 c7             	mov    %rax,%rdi
+  8042f9:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  804300:	00 00 00 
+  804303:	ff d0                	call   *%rax
+  }
+}
+  804305:	90                   	nop
+  804306:	c9                   	leave
+  804307:	c3                   	ret
+
+0000000000804308 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804308:	55                   	push   %rbp
+  804309:	48 89 e5             	mov    %rsp,%rbp
+  80430c:	48 83 ec 10          	sub    $0x10,%rsp
+  804310:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804314:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804317:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80431b:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804326:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80432a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80432d:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804334:	89 c6                	mov    %eax,%esi
+  804336:	48 89 cf             	mov    %rcx,%rdi
+  804339:	48 b8 9f 25 80 00 00 	movabs $0x80259f,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+}
+  804345:	90                   	nop
+  804346:	c9                   	leave
+  804347:	c3                   	ret
+
+0000000000804348 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804348:	55                   	push   %rbp
+  804349:	48 89 e5             	mov    %rsp,%rbp
+  80434c:	48 83 ec 70          	sub    $0x70,%rsp
+  804350:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804354:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804358:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80435c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804360:	48 89 c7             	mov    %rax,%rdi
+  804363:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  80436a:	00 00 00 
+  80436d:	ff d0                	call   *%rax
+  80436f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804373:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804378:	75 0a                	jne    804384 <devpipe_read+0x3c>
+    return 0;
+  80437a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437f:	e9 63 01 00 00       	jmp    8044e7 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804384:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804388:	8b 40 18             	mov    0x18(%rax),%eax
+  80438b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80438e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804392:	48 8b 10             	mov    (%rax),%rdx
+  804395:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804399:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80439d:	48 39 c2             	cmp    %rax,%rdx
+  8043a0:	75 42                	jne    8043e4 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8043a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043a6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8043aa:	48 89 d6             	mov    %rdx,%rsi
+  8043ad:	48 89 c7             	mov    %rax,%rdi
+  8043b0:	48 b8 2d 41 80 00 00 	movabs $0x80412d,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+  8043bc:	85 c0                	test   %eax,%eax
+  8043be:	74 0a                	je     8043ca <devpipe_read+0x82>
+      return 0;
+  8043c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c5:	e9 1d 01 00 00       	jmp    8044e7 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8043ca:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8043cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d1:	89 d6                	mov    %edx,%esi
+  8043d3:	48 89 c7             	mov    %rax,%rdi
+  8043d6:	48 b8 08 43 80 00 00 	movabs $0x804308,%rax
+  8043dd:	00 00 00 
+  8043e0:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8043e2:	eb a0                	jmp    804384 <devpipe_read+0x3c>
+      break;
+  8043e4:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8043e5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8043e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8043ed:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8043f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8043f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043f9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8043fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804401:	48 8b 00             	mov    (%rax),%rax
+  804404:	48 29 c2             	sub    %rax,%rdx
+  804407:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80440b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80440f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804413:	48 39 c2             	cmp    %rax,%rdx
+  804416:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80441a:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80441e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804422:	48 8b 00             	mov    (%rax),%rax
+  804425:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804429:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80442d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804432:	48 f7 f1             	div    %rcx
+  804435:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804439:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80443d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804441:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804445:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804449:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80444d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804451:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804455:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804459:	48 39 c2             	cmp    %rax,%rdx
+  80445c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804460:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804468:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80446c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804470:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804474:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804478:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80447c:	48 89 ce             	mov    %rcx,%rsi
+  80447f:	48 89 c7             	mov    %rax,%rdi
+  804482:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80448e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804492:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804496:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80449a:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80449e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8044a2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044a6:	48 01 d1             	add    %rdx,%rcx
+  8044a9:	48 89 c2             	mov    %rax,%rdx
+  8044ac:	48 89 cf             	mov    %rcx,%rdi
+  8044af:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  8044b6:	00 00 00 
+  8044b9:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8044bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044bf:	48 8b 10             	mov    (%rax),%rdx
+  8044c2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8044c6:	48 01 c2             	add    %rax,%rdx
+  8044c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044cd:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8044d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044d4:	48 89 c7             	mov    %rax,%rdi
+  8044d7:	48 b8 b6 42 80 00 00 	movabs $0x8042b6,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+  return n;
+  8044e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8044e7:	c9                   	leave
+  8044e8:	c3                   	ret
+
+00000000008044e9 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8044e9:	55                   	push   %rbp
+  8044ea:	48 89 e5             	mov    %rsp,%rbp
+  8044ed:	48 83 ec 70          	sub    $0x70,%rsp
+  8044f1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8044f5:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8044f9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8044fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804501:	48 89 c7             	mov    %rax,%rdi
+  804504:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+  804510:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804514:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804518:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  80451c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804523:	00 
+  804524:	e9 b8 01 00 00       	jmp    8046e1 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80452d:	8b 40 18             	mov    0x18(%rax),%eax
+  804530:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804533:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804537:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80453b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80453f:	48 8b 00             	mov    (%rax),%rax
+  804542:	48 29 c2             	sub    %rax,%rdx
+  804545:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804549:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80454d:	48 39 c2             	cmp    %rax,%rdx
+  804550:	75 4d                	jne    80459f <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804552:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804556:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80455a:	48 89 d6             	mov    %rdx,%rsi
+  80455d:	48 89 c7             	mov    %rax,%rdi
+  804560:	48 b8 2d 41 80 00 00 	movabs $0x80412d,%rax
+  804567:	00 00 00 
+  80456a:	ff d0                	call   *%rax
+  80456c:	85 c0                	test   %eax,%eax
+  80456e:	74 0a                	je     80457a <devpipe_write+0x91>
+        return 0;
+  804570:	b8 00 00 00 00       	mov    $0x0,%eax
+  804575:	e9 79 01 00 00       	jmp    8046f3 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80457a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80457d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804581:	89 d6                	mov    %edx,%esi
+  804583:	48 89 c7             	mov    %rax,%rdi
+  804586:	48 b8 08 43 80 00 00 	movabs $0x804308,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+      m = 0;
+  804592:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804599:	00 
+      continue;
+  80459a:	e9 3a 01 00 00       	jmp    8046d9 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80459f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8045a3:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8045a7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8045ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045af:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8045b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045b7:	48 8b 08             	mov    (%rax),%rcx
+  8045ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045be:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045c2:	48 29 c1             	sub    %rax,%rcx
+  8045c5:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8045c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8045cd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8045d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045d5:	48 39 c2             	cmp    %rax,%rdx
+  8045d8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8045dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8045e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045ec:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8045f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045f5:	48 f7 f1             	div    %rcx
+  8045f8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8045fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804600:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804608:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80460c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804610:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804614:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804618:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80461c:	48 39 c2             	cmp    %rax,%rdx
+  80461f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804623:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804627:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80462b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80462f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804633:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80463b:	48 01 d1             	add    %rdx,%rcx
+  80463e:	48 89 c2             	mov    %rax,%rdx
+  804641:	48 89 cf             	mov    %rcx,%rdi
+  804644:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  80464b:	00 00 00 
+  80464e:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804654:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804658:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80465c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804660:	73 4d                	jae    8046af <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804666:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80466a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80466e:	48 29 c2             	sub    %rax,%rdx
+  804671:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804675:	48 01 c2             	add    %rax,%rdx
+  804678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80467c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804680:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804684:	48 89 c1             	mov    %rax,%rcx
+  804687:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80468b:	48 01 c1             	add    %rax,%rcx
+  80468e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804692:	48 01 c1             	add    %rax,%rcx
+  804695:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804699:	48 83 c0 20          	add    $0x20,%rax
+  80469d:	48 89 ce             	mov    %rcx,%rsi
+  8046a0:	48 89 c7             	mov    %rax,%rdi
+  8046a3:	48 b8 6e 1b 80 00 00 	movabs $0x801b6e,%rax
+  8046aa:	00 00 00 
+  8046ad:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8046af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8046b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046bb:	48 01 c2             	add    %rax,%rdx
+  8046be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046c2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8046c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ca:	48 89 c7             	mov    %rax,%rdi
+  8046cd:	48 b8 b6 42 80 00 00 	movabs $0x8042b6,%rax
+  8046d4:	00 00 00 
+  8046d7:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8046d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046dd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8046e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e5:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8046e9:	0f 82 3a fe ff ff    	jb     804529 <devpipe_write+0x40>
+  }
+
+  return i;
+  8046ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8046f3:	c9                   	leave
+  8046f4:	c3                   	ret
+
+00000000008046f5 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8046f5:	55                   	push   %rbp
+  8046f6:	48 89 e5             	mov    %rsp,%rbp
+  8046f9:	48 83 ec 40          	sub    $0x40,%rsp
+  8046fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804701:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804704:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804708:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80470c:	48 89 c7             	mov    %rax,%rdi
+  80470f:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  804716:	00 00 00 
+  804719:	ff d0                	call   *%rax
+  80471b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80471f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804726:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80472a:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80472e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804732:	48 89 d6             	mov    %rdx,%rsi
+  804735:	48 89 c7             	mov    %rax,%rdi
+  804738:	48 b8 d0 33 80 00 00 	movabs $0x8033d0,%rax
+  80473f:	00 00 00 
+  804742:	ff d0                	call   *%rax
+  804744:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804747:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80474b:	79 08                	jns    804755 <devpipe_poll+0x60>
+    return r;
+  80474d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804750:	e9 85 00 00 00       	jmp    8047da <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804755:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804758:	83 e0 01             	and    $0x1,%eax
+  80475b:	85 c0                	test   %eax,%eax
+  80475d:	74 18                	je     804777 <devpipe_poll+0x82>
+  80475f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804763:	48 8b 10             	mov    (%rax),%rdx
+  804766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80476a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80476e:	48 39 c2             	cmp    %rax,%rdx
+  804771:	74 04                	je     804777 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804773:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804777:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80477a:	83 e0 02             	and    $0x2,%eax
+  80477d:	85 c0                	test   %eax,%eax
+  80477f:	74 23                	je     8047a4 <devpipe_poll+0xaf>
+  804781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804785:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804789:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80478d:	48 8b 00             	mov    (%rax),%rax
+  804790:	48 29 c2             	sub    %rax,%rdx
+  804793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804797:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80479b:	48 39 c2             	cmp    %rax,%rdx
+  80479e:	73 04                	jae    8047a4 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8047a0:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8047a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8047a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047ac:	48 89 d6             	mov    %rdx,%rsi
+  8047af:	48 89 c7             	mov    %rax,%rdi
+  8047b2:	48 b8 2d 41 80 00 00 	movabs $0x80412d,%rax
+  8047b9:	00 00 00 
+  8047bc:	ff d0                	call   *%rax
+  8047be:	85 c0                	test   %eax,%eax
+  8047c0:	74 04                	je     8047c6 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8047c2:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8047c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047ca:	75 0b                	jne    8047d7 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8047cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047d0:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8047d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8047da:	c9                   	leave
+  8047db:	c3                   	ret
+
+00000000008047dc <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8047dc:	55                   	push   %rbp
+  8047dd:	48 89 e5             	mov    %rsp,%rbp
+  8047e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8047e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8047e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8047ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f0:	48 89 c7             	mov    %rax,%rdi
+  8047f3:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  8047fa:	00 00 00 
+  8047fd:	ff d0                	call   *%rax
+  8047ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804803:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804807:	48 ba 11 58 80 00 00 	movabs $0x805811,%rdx
+  80480e:	00 00 00 
+  804811:	48 89 d6             	mov    %rdx,%rsi
+  804814:	48 89 c7             	mov    %rax,%rdi
+  804817:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  80481e:	00 00 00 
+  804821:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804823:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804827:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80482b:	89 c1                	mov    %eax,%ecx
+  80482d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804831:	48 8b 00             	mov    (%rax),%rax
+  804834:	89 c2                	mov    %eax,%edx
+  804836:	89 c8                	mov    %ecx,%eax
+  804838:	29 d0                	sub    %edx,%eax
+  80483a:	89 c2                	mov    %eax,%edx
+  80483c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804840:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804846:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80484a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804851:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804854:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804858:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  80485f:	00 00 00 
+  804862:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804869:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80486e:	c9                   	leave
+  80486f:	c3                   	ret
+
+0000000000804870 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804870:	55                   	push   %rbp
+  804871:	48 89 e5             	mov    %rsp,%rbp
+  804874:	48 83 ec 40          	sub    $0x40,%rsp
+  804878:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80487c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804880:	48 89 c7             	mov    %rax,%rdi
+  804883:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  80488a:	00 00 00 
+  80488d:	ff d0                	call   *%rax
+  80488f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804893:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80489a:	00 
+  80489b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80489f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8048a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048a7:	48 01 d0             	add    %rdx,%rax
+  8048aa:	48 83 c0 1f          	add    $0x1f,%rax
+  8048ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8048b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048bb:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8048bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048c3:	48 29 d0             	sub    %rdx,%rax
+  8048c6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8048ca:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8048ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048d2:	48 89 c6             	mov    %rax,%rsi
+  8048d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048da:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  8048e1:	00 00 00 
+  8048e4:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8048e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048ea:	48 89 c7             	mov    %rax,%rdi
+  8048ed:	48 b8 b6 42 80 00 00 	movabs $0x8042b6,%rax
+  8048f4:	00 00 00 
+  8048f7:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8048f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804901:	eb 2f                	jmp    804932 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804903:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804907:	48 83 e8 01          	sub    $0x1,%rax
+  80490b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80490f:	48 89 c2             	mov    %rax,%rdx
+  804912:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804916:	48 01 d0             	add    %rdx,%rax
+  804919:	48 89 c6             	mov    %rax,%rsi
+  80491c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804921:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  804928:	00 00 00 
+  80492b:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80492d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804932:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804937:	77 ca                	ja     804903 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804939:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80493d:	48 89 c6             	mov    %rax,%rsi
+  804940:	bf 00 00 00 00       	mov    $0x0,%edi
+  804945:	48 b8 ab 22 80 00 00 	movabs $0x8022ab,%rax
+  80494c:	00 00 00 
+  80494f:	ff d0                	call   *%rax
+}
+  804951:	c9                   	leave
+  804952:	c3                   	ret
+
+0000000000804953 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804953:	55                   	push   %rbp
+  804954:	48 89 e5             	mov    %rsp,%rbp
+  804957:	48 83 ec 08          	sub    $0x8,%rsp
+  80495b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  80495e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804962:	75 10                	jne    804974 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804964:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80496b:	00 00 00 
+  80496e:	8b 00                	mov    (%rax),%eax
+  804970:	48 98                	cltq
+  804972:	eb 05                	jmp    804979 <vsyscall+0x26>
+  }
+  return 0;
+  804974:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804979:	c9                   	leave
+  80497a:	c3                   	ret
+
+000000000080497b <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  80497b:	55                   	push   %rbp
+  80497c:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80497f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804984:	48 b8 53 49 80 00 00 	movabs $0x804953,%rax
+  80498b:	00 00 00 
+  80498e:	ff d0                	call   *%rax
+}
+  804990:	5d                   	pop    %rbp
+  804991:	c3                   	ret
+
+0000000000804992 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804992:	55                   	push   %rbp
+  804993:	48 89 e5             	mov    %rsp,%rbp
+  804996:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80499a:	0f 31                	rdtsc
+  80499c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80499f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8049a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049a5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049a8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8049ac:	48 09 d0             	or     %rdx,%rax
+  8049af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8049b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8049b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8049bb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8049c2:	00 00 00 
+  8049c5:	8b 40 08             	mov    0x8(%rax),%eax
+  8049c8:	48 98                	cltq
+  8049ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8049ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8049db:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8049e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049eb:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8049ef:	48 89 d0             	mov    %rdx,%rax
+  8049f2:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8049f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049fe:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804a02:	48 01 c8             	add    %rcx,%rax
+}
+  804a05:	c9                   	leave
+  804a06:	c3                   	ret
+
+0000000000804a07 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804a07:	55                   	push   %rbp
+  804a08:	48 89 e5             	mov    %rsp,%rbp
+  804a0b:	48 83 ec 20          	sub    $0x20,%rsp
+  804a0f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804a12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a15:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804a18:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804a1c:	be 01 00 00 00       	mov    $0x1,%esi
+  804a21:	48 89 c7             	mov    %rax,%rdi
+  804a24:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  804a2b:	00 00 00 
+  804a2e:	ff d0                	call   *%rax
+}
+  804a30:	90                   	nop
+  804a31:	c9                   	leave
+  804a32:	c3                   	ret
+
+0000000000804a33 <getchar>:
+
+int
+getchar(void) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+  804a37:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804a3b:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804a3f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a44:	48 89 c6             	mov    %rax,%rsi
+  804a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a4c:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  804a53:	00 00 00 
+  804a56:	ff d0                	call   *%rax
+  804a58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804a5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a5f:	79 05                	jns    804a66 <getchar+0x33>
+    return r;
+  804a61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a64:	eb 14                	jmp    804a7a <getchar+0x47>
+  if (r < 1)
+  804a66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a6a:	7f 07                	jg     804a73 <getchar+0x40>
+    return -E_EOF;
+  804a6c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804a71:	eb 07                	jmp    804a7a <getchar+0x47>
+  return c;
+  804a73:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804a77:	0f b6 c0             	movzbl %al,%eax
+}
+  804a7a:	c9                   	leave
+  804a7b:	c3                   	ret
+
+0000000000804a7c <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804a7c:	55                   	push   %rbp
+  804a7d:	48 89 e5             	mov    %rsp,%rbp
+  804a80:	48 83 ec 20          	sub    $0x20,%rsp
+  804a84:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804a87:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804a8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a8e:	48 89 d6             	mov    %rdx,%rsi
+  804a91:	89 c7                	mov    %eax,%edi
+  804a93:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804a9a:	00 00 00 
+  804a9d:	ff d0                	call   *%rax
+  804a9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804aa2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804aa6:	79 05                	jns    804aad <iscons+0x31>
+    return r;
+  804aa8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804aab:	eb 1a                	jmp    804ac7 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804aad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ab1:	8b 10                	mov    (%rax),%edx
+  804ab3:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804aba:	00 00 00 
+  804abd:	8b 00                	mov    (%rax),%eax
+  804abf:	39 c2                	cmp    %eax,%edx
+  804ac1:	0f 94 c0             	sete   %al
+  804ac4:	0f b6 c0             	movzbl %al,%eax
+}
+  804ac7:	c9                   	leave
+  804ac8:	c3                   	ret
+
+0000000000804ac9 <opencons>:
+
+int
+opencons(void) {
+  804ac9:	55                   	push   %rbp
+  804aca:	48 89 e5             	mov    %rsp,%rbp
+  804acd:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804ad1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804ad5:	48 89 c7             	mov    %rax,%rdi
+  804ad8:	48 b8 28 29 80 00 00 	movabs $0x802928,%rax
+  804adf:	00 00 00 
+  804ae2:	ff d0                	call   *%rax
+  804ae4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ae7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804aeb:	79 05                	jns    804af2 <opencons+0x29>
+    return r;
+  804aed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804af0:	eb 66                	jmp    804b58 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804af2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804af6:	ba 07 04 00 00       	mov    $0x407,%edx
+  804afb:	48 89 c6             	mov    %rax,%rsi
+  804afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b03:	48 b8 f3 21 80 00 00 	movabs $0x8021f3,%rax
+  804b0a:	00 00 00 
+  804b0d:	ff d0                	call   *%rax
+  804b0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b16:	79 05                	jns    804b1d <opencons+0x54>
+    return r;
+  804b18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b1b:	eb 3b                	jmp    804b58 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804b1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b21:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804b28:	00 00 00 
+  804b2b:	8b 12                	mov    (%rdx),%edx
+  804b2d:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804b2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b33:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804b3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b3e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804b45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b49:	48 89 c7             	mov    %rax,%rdi
+  804b4c:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  804b53:	00 00 00 
+  804b56:	ff d0                	call   *%rax
+}
+  804b58:	c9                   	leave
+  804b59:	c3                   	ret
+
+0000000000804b5a <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804b5a:	55                   	push   %rbp
+  804b5b:	48 89 e5             	mov    %rsp,%rbp
+  804b5e:	48 83 ec 20          	sub    $0x20,%rsp
+  804b62:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b65:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b68:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804b6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b6f:	48 89 d6             	mov    %rdx,%rsi
+  804b72:	89 c7                	mov    %eax,%edi
+  804b74:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+  804b80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b87:	79 05                	jns    804b8e <consmode+0x34>
+    return r;
+  804b89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b8c:	eb 34                	jmp    804bc2 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804b8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b92:	8b 10                	mov    (%rax),%edx
+  804b94:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804b9b:	00 00 00 
+  804b9e:	8b 00                	mov    (%rax),%eax
+  804ba0:	39 c2                	cmp    %eax,%edx
+  804ba2:	74 07                	je     804bab <consmode+0x51>
+    return -E_INVAL;
+  804ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804ba9:	eb 17                	jmp    804bc2 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804bab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804baf:	8b 40 0c             	mov    0xc(%rax),%eax
+  804bb2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804bb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bb9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804bbc:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804bc2:	c9                   	leave
+  804bc3:	c3                   	ret
+
+0000000000804bc4 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804bc4:	55                   	push   %rbp
+  804bc5:	48 89 e5             	mov    %rsp,%rbp
+  804bc8:	48 83 ec 20          	sub    $0x20,%rsp
+  804bcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bd0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804bd4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804bd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bdc:	8b 50 0c             	mov    0xc(%rax),%edx
+  804bdf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804be3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804be7:	48 89 ce             	mov    %rcx,%rsi
+  804bea:	48 89 c7             	mov    %rax,%rdi
+  804bed:	48 b8 4d 25 80 00 00 	movabs $0x80254d,%rax
+  804bf4:	00 00 00 
+  804bf7:	ff d0                	call   *%rax
+  804bf9:	48 98                	cltq
+}
+  804bfb:	c9                   	leave
+  804bfc:	c3                   	ret
+
+0000000000804bfd <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804bfd:	55                   	push   %rbp
+  804bfe:	48 89 e5             	mov    %rsp,%rbp
+  804c01:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804c08:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804c0f:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804c16:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804c1d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804c24:	eb 74                	jmp    804c9a <devcons_write+0x9d>
+    m = n - tot;
+  804c26:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804c2d:	89 c2                	mov    %eax,%edx
+  804c2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c32:	29 c2                	sub    %eax,%edx
+  804c34:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804c37:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804c3a:	83 f8 7f             	cmp    $0x7f,%eax
+  804c3d:	76 07                	jbe    804c46 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804c3f:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804c46:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804c49:	48 63 d0             	movslq %eax,%rdx
+  804c4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c4f:	48 63 c8             	movslq %eax,%rcx
+  804c52:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804c59:	48 01 c1             	add    %rax,%rcx
+  804c5c:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804c63:	48 89 ce             	mov    %rcx,%rsi
+  804c66:	48 89 c7             	mov    %rax,%rdi
+  804c69:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  804c70:	00 00 00 
+  804c73:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804c75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804c78:	48 63 d0             	movslq %eax,%rdx
+  804c7b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804c82:	48 89 d6             	mov    %rdx,%rsi
+  804c85:	48 89 c7             	mov    %rax,%rdi
+  804c88:	48 b8 dc 1f 80 00 00 	movabs $0x801fdc,%rax
+  804c8f:	00 00 00 
+  804c92:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804c94:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804c97:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804c9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c9d:	48 98                	cltq
+  804c9f:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804ca6:	0f 82 7a ff ff ff    	jb     804c26 <devcons_write+0x29>
+  }
+  return tot;
+  804cac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804caf:	48 98                	cltq
+}
+  804cb1:	c9                   	leave
+  804cb2:	c3                   	ret
+
+0000000000804cb3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804cb3:	55                   	push   %rbp
+  804cb4:	48 89 e5             	mov    %rsp,%rbp
+  804cb7:	48 83 ec 08          	sub    $0x8,%rsp
+  804cbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cc4:	c9                   	leave
+  804cc5:	c3                   	ret
+
+0000000000804cc6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804cc6:	55                   	push   %rbp
+  804cc7:	48 89 e5             	mov    %rsp,%rbp
+  804cca:	48 83 ec 10          	sub    $0x10,%rsp
+  804cce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cd2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cda:	48 ba 1d 58 80 00 00 	movabs $0x80581d,%rdx
+  804ce1:	00 00 00 
+  804ce4:	48 89 d6             	mov    %rdx,%rsi
+  804ce7:	48 89 c7             	mov    %rax,%rdi
+  804cea:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  804cf1:	00 00 00 
+  804cf4:	ff d0                	call   *%rax
+  return 0;
+  804cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cfb:	c9                   	leave
+  804cfc:	c3                   	ret
+
+0000000000804cfd <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804cfd:	55                   	push   %rbp
+  804cfe:	48 89 e5             	mov    %rsp,%rbp
+  804d01:	48 83 ec 30          	sub    $0x30,%rsp
+  804d05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d09:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804d0c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804d10:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804d17:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d1a:	83 e0 02             	and    $0x2,%eax
+  804d1d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804d20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d24:	8b 40 0c             	mov    0xc(%rax),%eax
+  804d27:	83 f8 01             	cmp    $0x1,%eax
+  804d2a:	75 04                	jne    804d30 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804d2c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804d30:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d33:	83 e0 01             	and    $0x1,%eax
+  804d36:	85 c0                	test   %eax,%eax
+  804d38:	74 44                	je     804d7e <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804d3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d42:	89 c2                	mov    %eax,%edx
+  804d44:	be 00 00 00 00       	mov    $0x0,%esi
+  804d49:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d4e:	48 b8 3b 26 80 00 00 	movabs $0x80263b,%rax
+  804d55:	00 00 00 
+  804d58:	ff d0                	call   *%rax
+  804d5a:	83 f8 01             	cmp    $0x1,%eax
+  804d5d:	75 06                	jne    804d65 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804d5f:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804d63:	eb 19                	jmp    804d7e <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804d65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d69:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804d6f:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804d72:	89 c2                	mov    %eax,%edx
+  804d74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d78:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804d7e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804d81:	c9                   	leave
+  804d82:	c3                   	ret
+
+0000000000804d83 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804d83:	55                   	push   %rbp
+  804d84:	48 89 e5             	mov    %rsp,%rbp
+  804d87:	48 83 ec 20          	sub    $0x20,%rsp
+  804d8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d8f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d93:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804d97:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d9b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804d9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804da3:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804daa:	48 89 c7             	mov    %rax,%rdi
+  804dad:	48 b8 bb 4d 80 00 00 	movabs $0x804dbb,%rax
+  804db4:	00 00 00 
+  804db7:	ff d0                	call   *%rax
+}
+  804db9:	c9                   	leave
+  804dba:	c3                   	ret
+
+0000000000804dbb <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804dbb:	55                   	push   %rbp
+  804dbc:	48 89 e5             	mov    %rsp,%rbp
+  804dbf:	48 83 ec 30          	sub    $0x30,%rsp
+  804dc3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804dc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804dcb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804dcf:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804dd3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804dd8:	75 0e                	jne    804de8 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804dda:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804de1:	00 00 00 
+  804de4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804de8:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804ded:	75 18                	jne    804e07 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804def:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804df3:	48 89 c7             	mov    %rax,%rdi
+  804df6:	48 b8 33 24 80 00 00 	movabs $0x802433,%rax
+  804dfd:	00 00 00 
+  804e00:	ff d0                	call   *%rax
+  804e02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e05:	eb 1d                	jmp    804e24 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804e07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e0f:	48 89 d6             	mov    %rdx,%rsi
+  804e12:	48 89 c7             	mov    %rax,%rdi
+  804e15:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  804e1c:	00 00 00 
+  804e1f:	ff d0                	call   *%rax
+  804e21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804e24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e28:	79 2a                	jns    804e54 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804e2a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e2f:	74 0a                	je     804e3b <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804e31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e35:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804e3b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e40:	74 0a                	je     804e4c <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804e42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e46:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804e4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e4f:	e9 aa 00 00 00       	jmp    804efe <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804e54:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e59:	74 36                	je     804e91 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804e5b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e62:	00 00 00 
+  804e65:	8b 40 04             	mov    0x4(%rax),%eax
+  804e68:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e6d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e74:	00 00 00 
+  804e77:	48 98                	cltq
+  804e79:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e80:	48 01 d0             	add    %rdx,%rax
+  804e83:	48 05 24 01 00 00    	add    $0x124,%rax
+  804e89:	8b 10                	mov    (%rax),%edx
+  804e8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e8f:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804e91:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e96:	74 36                	je     804ece <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804e98:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e9f:	00 00 00 
+  804ea2:	8b 40 04             	mov    0x4(%rax),%eax
+  804ea5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804eaa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eb1:	00 00 00 
+  804eb4:	48 98                	cltq
+  804eb6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ebd:	48 01 d0             	add    %rdx,%rax
+  804ec0:	48 05 28 01 00 00    	add    $0x128,%rax
+  804ec6:	8b 10                	mov    (%rax),%edx
+  804ec8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ecc:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804ece:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ed5:	00 00 00 
+  804ed8:	8b 40 04             	mov    0x4(%rax),%eax
+  804edb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ee0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ee7:	00 00 00 
+  804eea:	48 98                	cltq
+  804eec:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ef3:	48 01 d0             	add    %rdx,%rax
+  804ef6:	48 05 20 01 00 00    	add    $0x120,%rax
+  804efc:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804efe:	c9                   	leave
+  804eff:	c3                   	ret
+
+0000000000804f00 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804f00:	55                   	push   %rbp
+  804f01:	48 89 e5             	mov    %rsp,%rbp
+  804f04:	48 83 ec 30          	sub    $0x30,%rsp
+  804f08:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f0b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804f0e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804f12:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804f15:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804f1a:	75 5e                	jne    804f7a <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804f1c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804f23:	00 00 00 
+  804f26:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f2a:	eb 4e                	jmp    804f7a <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804f2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f30:	79 3c                	jns    804f6e <ipc_send+0x6e>
+  804f32:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804f36:	74 36                	je     804f6e <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804f38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f3b:	89 c1                	mov    %eax,%ecx
+  804f3d:	48 b8 28 58 80 00 00 	movabs $0x805828,%rax
+  804f44:	00 00 00 
+  804f47:	48 89 c2             	mov    %rax,%rdx
+  804f4a:	be 54 00 00 00       	mov    $0x54,%esi
+  804f4f:	48 b8 4e 58 80 00 00 	movabs $0x80584e,%rax
+  804f56:	00 00 00 
+  804f59:	48 89 c7             	mov    %rax,%rdi
+  804f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f61:	49 b8 56 02 80 00 00 	movabs $0x800256,%r8
+  804f68:	00 00 00 
+  804f6b:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804f6e:	48 b8 b6 21 80 00 00 	movabs $0x8021b6,%rax
+  804f75:	00 00 00 
+  804f78:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f7a:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804f7d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804f80:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f87:	89 c7                	mov    %eax,%edi
+  804f89:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  804f90:	00 00 00 
+  804f93:	ff d0                	call   *%rax
+  804f95:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f98:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f9c:	75 8e                	jne    804f2c <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804f9e:	48 b8 b6 21 80 00 00 	movabs $0x8021b6,%rax
+  804fa5:	00 00 00 
+  804fa8:	ff d0                	call   *%rax
+}
+  804faa:	90                   	nop
+  804fab:	c9                   	leave
+  804fac:	c3                   	ret
+
+0000000000804fad <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804fad:	55                   	push   %rbp
+  804fae:	48 89 e5             	mov    %rsp,%rbp
+  804fb1:	48 83 ec 18          	sub    $0x18,%rsp
+  804fb5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804fb8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804fbf:	eb 4d                	jmp    80500e <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804fc1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fc8:	00 00 00 
+  804fcb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fce:	48 98                	cltq
+  804fd0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804fd7:	48 01 d0             	add    %rdx,%rax
+  804fda:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804fe0:	8b 00                	mov    (%rax),%eax
+  804fe2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804fe5:	75 23                	jne    80500a <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804fe7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804fee:	00 00 00 
+  804ff1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ff4:	48 98                	cltq
+  804ff6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ffd:	48 01 d0             	add    %rdx,%rax
+  805000:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805006:	8b 00                	mov    (%rax),%eax
+  805008:	eb 12                	jmp    80501c <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  80500a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80500e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805015:	7e aa                	jle    804fc1 <ipc_find_env+0x14>
+  return 0;
+  805017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80501c:	c9                   	leave
+  80501d:	c3                   	ret
+
+000000000080501e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  80501e:	55                   	push   %rbp
+  80501f:	48 89 e5             	mov    %rsp,%rbp
+  805022:	48 83 ec 18          	sub    $0x18,%rsp
+  805026:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80502a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80502e:	48 c1 e8 27          	shr    $0x27,%rax
+  805032:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805037:	48 89 c2             	mov    %rax,%rdx
+  80503a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805041:	01 00 00 
+  805044:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805048:	83 e0 01             	and    $0x1,%eax
+  80504b:	48 85 c0             	test   %rax,%rax
+  80504e:	74 63                	je     8050b3 <pageref+0x95>
+  805050:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805054:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805058:	48 89 c2             	mov    %rax,%rdx
+  80505b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805062:	01 00 00 
+  805065:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805069:	83 e0 01             	and    $0x1,%eax
+  80506c:	48 85 c0             	test   %rax,%rax
+  80506f:	74 42                	je     8050b3 <pageref+0x95>
+  805071:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805075:	48 c1 e8 15          	shr    $0x15,%rax
+  805079:	48 89 c2             	mov    %rax,%rdx
+  80507c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805083:	01 00 00 
+  805086:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80508a:	83 e0 01             	and    $0x1,%eax
+  80508d:	48 85 c0             	test   %rax,%rax
+  805090:	74 21                	je     8050b3 <pageref+0x95>
+  805092:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805096:	48 c1 e8 0c          	shr    $0xc,%rax
+  80509a:	48 89 c2             	mov    %rax,%rdx
+  80509d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050a4:	01 00 00 
+  8050a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050ab:	83 e0 01             	and    $0x1,%eax
+  8050ae:	48 85 c0             	test   %rax,%rax
+  8050b1:	75 07                	jne    8050ba <pageref+0x9c>
+    return 0;
+  8050b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050b8:	eb 53                	jmp    80510d <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8050ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050be:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050c2:	48 89 c2             	mov    %rax,%rdx
+  8050c5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050cc:	01 00 00 
+  8050cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8050d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050db:	83 e0 01             	and    $0x1,%eax
+  8050de:	48 85 c0             	test   %rax,%rax
+  8050e1:	75 07                	jne    8050ea <pageref+0xcc>
+    return 0;
+  8050e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050e8:	eb 23                	jmp    80510d <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8050ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ee:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050f2:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8050f9:	00 00 00 
+  8050fc:	48 c1 e0 04          	shl    $0x4,%rax
+  805100:	48 01 d0             	add    %rdx,%rax
+  805103:	48 83 c0 08          	add    $0x8,%rax
+  805107:	0f b7 00             	movzwl (%rax),%eax
+  80510a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80510d:	c9                   	leave
+  80510e:	c3                   	ret
+  80510f:	90                   	nop
@@ -0,0 +1,10248 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 3f 03 00 00       	call   80036b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r, n, n2;
+
+  if ((fd = open("motd", O_RDONLY)) < 0)
+  800041:	be 00 00 00 00       	mov    $0x0,%esi
+  800046:	48 b8 40 66 80 00 00 	movabs $0x806640,%rax
+  80004d:	00 00 00 
+  800050:	48 89 c7             	mov    %rax,%rdi
+  800053:	48 b8 6a 42 80 00 00 	movabs $0x80426a,%rax
+  80005a:	00 00 00 
+  80005d:	ff d0                	call   *%rax
+  80005f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800062:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800066:	79 36                	jns    80009e <umain+0x6c>
+    panic("open motd: %i", fd);
+  800068:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80006b:	89 c1                	mov    %eax,%ecx
+  80006d:	48 b8 45 66 80 00 00 	movabs $0x806645,%rax
+  800074:	00 00 00 
+  800077:	48 89 c2             	mov    %rax,%rdx
+  80007a:	be 0b 00 00 00       	mov    $0xb,%esi
+  80007f:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  800086:	00 00 00 
+  800089:	48 89 c7             	mov    %rax,%rdi
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  800098:	00 00 00 
+  80009b:	41 ff d0             	call   *%r8
+  seek(fd, 0);
+  80009e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a6:	89 c7                	mov    %eax,%edi
+  8000a8:	48 b8 7f 3b 80 00 00 	movabs $0x803b7f,%rax
+  8000af:	00 00 00 
+  8000b2:	ff d0                	call   *%rax
+  if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  8000b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000b7:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000bc:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8000c3:	00 00 00 
+  8000c6:	48 89 ce             	mov    %rcx,%rsi
+  8000c9:	89 c7                	mov    %eax,%edi
+  8000cb:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+  8000d7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000da:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000de:	7f 36                	jg     800116 <umain+0xe4>
+    panic("readn: %i", n);
+  8000e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000e3:	89 c1                	mov    %eax,%ecx
+  8000e5:	48 b8 68 66 80 00 00 	movabs $0x806668,%rax
+  8000ec:	00 00 00 
+  8000ef:	48 89 c2             	mov    %rax,%rdx
+  8000f2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000f7:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  8000fe:	00 00 00 
+  800101:	48 89 c7             	mov    %rax,%rdi
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+  800109:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  800110:	00 00 00 
+  800113:	41 ff d0             	call   *%r8
+
+  if ((r = fork()) < 0)
+  800116:	48 b8 48 32 80 00 00 	movabs $0x803248,%rax
+  80011d:	00 00 00 
+  800120:	ff d0                	call   *%rax
+  800122:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800125:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800129:	79 36                	jns    800161 <umain+0x12f>
+    panic("fork: %i", r);
+  80012b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 b8 72 66 80 00 00 	movabs $0x806672,%rax
+  800137:	00 00 00 
+  80013a:	48 89 c2             	mov    %rax,%rdx
+  80013d:	be 11 00 00 00       	mov    $0x11,%esi
+  800142:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  800149:	00 00 00 
+  80014c:	48 89 c7             	mov    %rax,%rdi
+  80014f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800154:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  80015b:	00 00 00 
+  80015e:	41 ff d0             	call   *%r8
+  if (r == 0) {
+  800161:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800165:	0f 85 51 01 00 00    	jne    8002bc <umain+0x28a>
+    seek(fd, 0);
+  80016b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80016e:	be 00 00 00 00       	mov    $0x0,%esi
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	48 b8 7f 3b 80 00 00 	movabs $0x803b7f,%rax
+  80017c:	00 00 00 
+  80017f:	ff d0                	call   *%rax
+    cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  800181:	48 b8 80 66 80 00 00 	movabs $0x806680,%rax
+  800188:	00 00 00 
+  80018b:	48 89 c7             	mov    %rax,%rdi
+  80018e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800193:	48 ba 31 06 80 00 00 	movabs $0x800631,%rdx
+  80019a:	00 00 00 
+  80019d:	ff d2                	call   *%rdx
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  80019f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001a2:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001a7:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  8001ae:	00 00 00 
+  8001b1:	48 89 ce             	mov    %rcx,%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+  8001c2:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8001c5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8001c8:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+  8001cb:	74 3c                	je     800209 <umain+0x1d7>
+      panic("read in parent got %d, read in child got %d", n, n2);
+  8001cd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8001d0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8001d3:	41 89 d0             	mov    %edx,%r8d
+  8001d6:	89 c1                	mov    %eax,%ecx
+  8001d8:	48 b8 c8 66 80 00 00 	movabs $0x8066c8,%rax
+  8001df:	00 00 00 
+  8001e2:	48 89 c2             	mov    %rax,%rdx
+  8001e5:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ea:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  8001f1:	00 00 00 
+  8001f4:	48 89 c7             	mov    %rax,%rdi
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b9 12 04 80 00 00 	movabs $0x800412,%r9
+  800203:	00 00 00 
+  800206:	41 ff d1             	call   *%r9
+    if (memcmp(buf, buf2, n) != 0)
+  800209:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80020c:	48 98                	cltq
+  80020e:	48 89 c2             	mov    %rax,%rdx
+  800211:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  800218:	00 00 00 
+  80021b:	48 89 c6             	mov    %rax,%rsi
+  80021e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800225:	00 00 00 
+  800228:	48 89 c7             	mov    %rax,%rdi
+  80022b:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  800232:	00 00 00 
+  800235:	ff d0                	call   *%rax
+  800237:	85 c0                	test   %eax,%eax
+  800239:	74 30                	je     80026b <umain+0x239>
+      panic("read in parent got different bytes from read in child");
+  80023b:	48 b8 f8 66 80 00 00 	movabs $0x8066f8,%rax
+  800242:	00 00 00 
+  800245:	48 89 c2             	mov    %rax,%rdx
+  800248:	be 18 00 00 00       	mov    $0x18,%esi
+  80024d:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  800254:	00 00 00 
+  800257:	48 89 c7             	mov    %rax,%rdi
+  80025a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025f:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  800266:	00 00 00 
+  800269:	ff d1                	call   *%rcx
+    cprintf("read in child succeeded\n");
+  80026b:	48 b8 2e 67 80 00 00 	movabs $0x80672e,%rax
+  800272:	00 00 00 
+  800275:	48 89 c7             	mov    %rax,%rdi
+  800278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027d:	48 ba 31 06 80 00 00 	movabs $0x800631,%rdx
+  800284:	00 00 00 
+  800287:	ff d2                	call   *%rdx
+    seek(fd, 0);
+  800289:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80028c:	be 00 00 00 00       	mov    $0x0,%esi
+  800291:	89 c7                	mov    %eax,%edi
+  800293:	48 b8 7f 3b 80 00 00 	movabs $0x803b7f,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+    close(fd);
+  80029f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002a2:	89 c7                	mov    %eax,%edi
+  8002a4:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  8002ab:	00 00 00 
+  8002ae:	ff d0                	call   *%rax
+    exit();
+  8002b0:	48 b8 ee 03 80 00 00 	movabs $0x8003ee,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+  }
+  wait(r);
+  8002bc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8002bf:	89 c7                	mov    %eax,%edi
+  8002c1:	48 b8 ef 52 80 00 00 	movabs $0x8052ef,%rax
+  8002c8:	00 00 00 
+  8002cb:	ff d0                	call   *%rax
+  if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8002cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002d5:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  8002dc:	00 00 00 
+  8002df:	48 89 ce             	mov    %rcx,%rsi
+  8002e2:	89 c7                	mov    %eax,%edi
+  8002e4:	48 b8 04 3a 80 00 00 	movabs $0x803a04,%rax
+  8002eb:	00 00 00 
+  8002ee:	ff d0                	call   *%rax
+  8002f0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8002f3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8002f6:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+  8002f9:	74 3c                	je     800337 <umain+0x305>
+    panic("read in parent got %d, then got %d", n, n2);
+  8002fb:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8002fe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800301:	41 89 d0             	mov    %edx,%r8d
+  800304:	89 c1                	mov    %eax,%ecx
+  800306:	48 b8 48 67 80 00 00 	movabs $0x806748,%rax
+  80030d:	00 00 00 
+  800310:	48 89 c2             	mov    %rax,%rdx
+  800313:	be 20 00 00 00       	mov    $0x20,%esi
+  800318:	48 b8 53 66 80 00 00 	movabs $0x806653,%rax
+  80031f:	00 00 00 
+  800322:	48 89 c7             	mov    %rax,%rdi
+  800325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032a:	49 b9 12 04 80 00 00 	movabs $0x800412,%r9
+  800331:	00 00 00 
+  800334:	41 ff d1             	call   *%r9
+  cprintf("read in parent succeeded\n");
+  800337:	48 b8 6b 67 80 00 00 	movabs $0x80676b,%rax
+  80033e:	00 00 00 
+  800341:	48 89 c7             	mov    %rax,%rdi
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	48 ba 31 06 80 00 00 	movabs $0x800631,%rdx
+  800350:	00 00 00 
+  800353:	ff d2                	call   *%rdx
+  close(fd);
+  800355:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800358:	89 c7                	mov    %eax,%edi
+  80035a:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+static __inline void wrmsr(uint32_t msr, uint64_t val) __attribute__((always_inline));
+static __inline void wbinvd(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void) {
+  __asm __volatile("int3");
+  800366:	cc                   	int3
+}
+  800367:	90                   	nop
+
+  breakpoint();
+}
+  800368:	90                   	nop
+  800369:	c9                   	leave
+  80036a:	c3                   	ret
+
+000000000080036b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80036b:	55                   	push   %rbp
+  80036c:	48 89 e5             	mov    %rsp,%rbp
+  80036f:	48 83 ec 20          	sub    $0x20,%rsp
+  800373:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800376:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80037a:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800381:	00 00 00 
+  800384:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800388:	eb 13                	jmp    80039d <libmain+0x32>
+    (*ctor)();
+  80038a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80038e:	48 8b 10             	mov    (%rax),%rdx
+  800391:	b8 00 00 00 00       	mov    $0x0,%eax
+  800396:	ff d2                	call   *%rdx
+    ctor++;
+  800398:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80039d:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8003ab:	72 dd                	jb     80038a <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8003b1:	7e 14                	jle    8003c7 <libmain+0x5c>
+    binaryname = argv[0];
+  8003b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003b7:	48 8b 00             	mov    (%rax),%rax
+  8003ba:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8003c1:	00 00 00 
+  8003c4:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8003c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ce:	48 89 d6             	mov    %rdx,%rsi
+  8003d1:	89 c7                	mov    %eax,%edi
+  8003d3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003da:	00 00 00 
+  8003dd:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8003df:	48 b8 ee 03 80 00 00 	movabs $0x8003ee,%rax
+  8003e6:	00 00 00 
+  8003e9:	ff d0                	call   *%rax
+#endif
+}
+  8003eb:	90                   	nop
+  8003ec:	c9                   	leave
+  8003ed:	c3                   	ret
+
+00000000008003ee <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003ee:	55                   	push   %rbp
+  8003ef:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8003f2:	48 b8 66 36 80 00 00 	movabs $0x803666,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8003fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800403:	48 b8 67 22 80 00 00 	movabs $0x802267,%rax
+  80040a:	00 00 00 
+  80040d:	ff d0                	call   *%rax
+}
+  80040f:	90                   	nop
+  800410:	5d                   	pop    %rbp
+  800411:	c3                   	ret
+
+0000000000800412 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800412:	55                   	push   %rbp
+  800413:	48 89 e5             	mov    %rsp,%rbp
+  800416:	53                   	push   %rbx
+  800417:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80041e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800425:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80042b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800432:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800439:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800440:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800447:	84 c0                	test   %al,%al
+  800449:	74 23                	je     80046e <_panic+0x5c>
+  80044b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800452:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800456:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80045a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80045e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800462:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800466:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80046a:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80046e:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800475:	00 00 00 
+  800478:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80047f:	00 00 00 
+  800482:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800486:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  80048d:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800494:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80049b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8004a2:	00 00 00 
+  8004a5:	48 8b 18             	mov    (%rax),%rbx
+  8004a8:	48 b8 36 23 80 00 00 	movabs $0x802336,%rax
+  8004af:	00 00 00 
+  8004b2:	ff d0                	call   *%rax
+  8004b4:	89 c6                	mov    %eax,%esi
+  8004b6:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8004bc:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8004c3:	41 89 d0             	mov    %edx,%r8d
+  8004c6:	48 89 c1             	mov    %rax,%rcx
+  8004c9:	48 89 da             	mov    %rbx,%rdx
+  8004cc:	48 b8 90 67 80 00 00 	movabs $0x806790,%rax
+  8004d3:	00 00 00 
+  8004d6:	48 89 c7             	mov    %rax,%rdi
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	49 b9 31 06 80 00 00 	movabs $0x800631,%r9
+  8004e5:	00 00 00 
+  8004e8:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004eb:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8004f2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004f9:	48 89 d6             	mov    %rdx,%rsi
+  8004fc:	48 89 c7             	mov    %rax,%rdi
+  8004ff:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  800506:	00 00 00 
+  800509:	ff d0                	call   *%rax
+  cprintf("\n");
+  80050b:	48 b8 b3 67 80 00 00 	movabs $0x8067b3,%rax
+  800512:	00 00 00 
+  800515:	48 89 c7             	mov    %rax,%rdi
+  800518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051d:	48 ba 31 06 80 00 00 	movabs $0x800631,%rdx
+  800524:	00 00 00 
+  800527:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800529:	cc                   	int3
+  80052a:	eb fd                	jmp    800529 <_panic+0x117>
+
+000000000080052c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80052c:	55                   	push   %rbp
+  80052d:	48 89 e5             	mov    %rsp,%rbp
+  800530:	48 83 ec 10          	sub    $0x10,%rsp
+  800534:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800537:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80053b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80053f:	8b 00                	mov    (%rax),%eax
+  800541:	8d 48 01             	lea    0x1(%rax),%ecx
+  800544:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800548:	89 0a                	mov    %ecx,(%rdx)
+  80054a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80054d:	89 d1                	mov    %edx,%ecx
+  80054f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800553:	48 98                	cltq
+  800555:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800559:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80055d:	8b 00                	mov    (%rax),%eax
+  80055f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800564:	75 2c                	jne    800592 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800566:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80056a:	8b 00                	mov    (%rax),%eax
+  80056c:	48 98                	cltq
+  80056e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800572:	48 83 c2 08          	add    $0x8,%rdx
+  800576:	48 89 c6             	mov    %rax,%rsi
+  800579:	48 89 d7             	mov    %rdx,%rdi
+  80057c:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  800583:	00 00 00 
+  800586:	ff d0                	call   *%rax
+    b->idx = 0;
+  800588:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80058c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800592:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800596:	8b 40 04             	mov    0x4(%rax),%eax
+  800599:	8d 50 01             	lea    0x1(%rax),%edx
+  80059c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005a0:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8005a3:	90                   	nop
+  8005a4:	c9                   	leave
+  8005a5:	c3                   	ret
+
+00000000008005a6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8005b1:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8005b8:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8005bf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8005c6:	00 00 00 
+  b.cnt = 0;
+  8005c9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8005d0:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8005d3:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8005da:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8005e1:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8005e8:	48 89 c6             	mov    %rax,%rsi
+  8005eb:	48 b8 2c 05 80 00 00 	movabs $0x80052c,%rax
+  8005f2:	00 00 00 
+  8005f5:	48 89 c7             	mov    %rax,%rdi
+  8005f8:	48 b8 8b 09 80 00 00 	movabs $0x80098b,%rax
+  8005ff:	00 00 00 
+  800602:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800604:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80060a:	48 98                	cltq
+  80060c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800613:	48 83 c2 08          	add    $0x8,%rdx
+  800617:	48 89 c6             	mov    %rax,%rsi
+  80061a:	48 89 d7             	mov    %rdx,%rdi
+  80061d:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  800624:	00 00 00 
+  800627:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800629:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80062f:	c9                   	leave
+  800630:	c3                   	ret
+
+0000000000800631 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  800635:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80063c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800643:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80064a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800651:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800658:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80065f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800666:	84 c0                	test   %al,%al
+  800668:	74 20                	je     80068a <cprintf+0x59>
+  80066a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80066e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800672:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800676:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80067a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80067e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800682:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800686:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80068a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800691:	00 00 00 
+  800694:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80069b:	00 00 00 
+  80069e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006a9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006b0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8006b7:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8006be:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8006c5:	48 89 d6             	mov    %rdx,%rsi
+  8006c8:	48 89 c7             	mov    %rax,%rdi
+  8006cb:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  8006d2:	00 00 00 
+  8006d5:	ff d0                	call   *%rax
+  8006d7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8006dd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006e3:	c9                   	leave
+  8006e4:	c3                   	ret
+
+00000000008006e5 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8006e5:	55                   	push   %rbp
+  8006e6:	48 89 e5             	mov    %rsp,%rbp
+  8006e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8006ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006f5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8006f9:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8006fc:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800700:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800704:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800707:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80070b:	72 54                	jb     800761 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80070d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800710:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800713:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800716:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80071f:	48 f7 f6             	div    %rsi
+  800722:	49 89 c2             	mov    %rax,%r10
+  800725:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800728:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80072b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80072f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800733:	41 89 c9             	mov    %ecx,%r9d
+  800736:	41 89 f8             	mov    %edi,%r8d
+  800739:	89 d1                	mov    %edx,%ecx
+  80073b:	4c 89 d2             	mov    %r10,%rdx
+  80073e:	48 89 c7             	mov    %rax,%rdi
+  800741:	48 b8 e5 06 80 00 00 	movabs $0x8006e5,%rax
+  800748:	00 00 00 
+  80074b:	ff d0                	call   *%rax
+  80074d:	eb 1c                	jmp    80076b <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80074f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800753:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800756:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80075a:	48 89 d6             	mov    %rdx,%rsi
+  80075d:	89 c7                	mov    %eax,%edi
+  80075f:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800761:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800765:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800769:	7f e4                	jg     80074f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80076b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80076e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800772:	ba 00 00 00 00       	mov    $0x0,%edx
+  800777:	48 f7 f1             	div    %rcx
+  80077a:	48 b8 f0 69 80 00 00 	movabs $0x8069f0,%rax
+  800781:	00 00 00 
+  800784:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800788:	0f be c0             	movsbl %al,%eax
+  80078b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80078f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800793:	48 89 d6             	mov    %rdx,%rsi
+  800796:	89 c7                	mov    %eax,%edi
+  800798:	ff d1                	call   *%rcx
+}
+  80079a:	90                   	nop
+  80079b:	c9                   	leave
+  80079c:	c3                   	ret
+
+000000000080079d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80079d:	55                   	push   %rbp
+  80079e:	48 89 e5             	mov    %rsp,%rbp
+  8007a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8007a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8007ac:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8007b0:	7e 4b                	jle    8007fd <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8007b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b6:	8b 00                	mov    (%rax),%eax
+  8007b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bb:	77 24                	ja     8007e1 <getuint+0x44>
+  8007bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c9:	8b 00                	mov    (%rax),%eax
+  8007cb:	89 c0                	mov    %eax,%eax
+  8007cd:	48 01 d0             	add    %rdx,%rax
+  8007d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007d4:	8b 12                	mov    (%rdx),%edx
+  8007d6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007dd:	89 0a                	mov    %ecx,(%rdx)
+  8007df:	eb 14                	jmp    8007f5 <getuint+0x58>
+  8007e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007e9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007f1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007f5:	48 8b 00             	mov    (%rax),%rax
+  8007f8:	e9 95 00 00 00       	jmp    800892 <getuint+0xf5>
+  else if (lflag)
+  8007fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800801:	74 48                	je     80084b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800807:	8b 00                	mov    (%rax),%eax
+  800809:	83 f8 2f             	cmp    $0x2f,%eax
+  80080c:	77 24                	ja     800832 <getuint+0x95>
+  80080e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800812:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081a:	8b 00                	mov    (%rax),%eax
+  80081c:	89 c0                	mov    %eax,%eax
+  80081e:	48 01 d0             	add    %rdx,%rax
+  800821:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800825:	8b 12                	mov    (%rdx),%edx
+  800827:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80082a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80082e:	89 0a                	mov    %ecx,(%rdx)
+  800830:	eb 14                	jmp    800846 <getuint+0xa9>
+  800832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800836:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80083a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80083e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800842:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800846:	48 8b 00             	mov    (%rax),%rax
+  800849:	eb 47                	jmp    800892 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80084b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80084f:	8b 00                	mov    (%rax),%eax
+  800851:	83 f8 2f             	cmp    $0x2f,%eax
+  800854:	77 24                	ja     80087a <getuint+0xdd>
+  800856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80085a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80085e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800862:	8b 00                	mov    (%rax),%eax
+  800864:	89 c0                	mov    %eax,%eax
+  800866:	48 01 d0             	add    %rdx,%rax
+  800869:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80086d:	8b 12                	mov    (%rdx),%edx
+  80086f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800872:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800876:	89 0a                	mov    %ecx,(%rdx)
+  800878:	eb 14                	jmp    80088e <getuint+0xf1>
+  80087a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800882:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800886:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80088a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80088e:	8b 00                	mov    (%rax),%eax
+  800890:	89 c0                	mov    %eax,%eax
+}
+  800892:	c9                   	leave
+  800893:	c3                   	ret
+
+0000000000800894 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800894:	55                   	push   %rbp
+  800895:	48 89 e5             	mov    %rsp,%rbp
+  800898:	48 83 ec 10          	sub    $0x10,%rsp
+  80089c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008a0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8008a3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8008a7:	7e 4b                	jle    8008f4 <getint+0x60>
+    return va_arg(*ap, long long);
+  8008a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ad:	8b 00                	mov    (%rax),%eax
+  8008af:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b2:	77 24                	ja     8008d8 <getint+0x44>
+  8008b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c0:	8b 00                	mov    (%rax),%eax
+  8008c2:	89 c0                	mov    %eax,%eax
+  8008c4:	48 01 d0             	add    %rdx,%rax
+  8008c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008cb:	8b 12                	mov    (%rdx),%edx
+  8008cd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d4:	89 0a                	mov    %ecx,(%rdx)
+  8008d6:	eb 14                	jmp    8008ec <getint+0x58>
+  8008d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008e0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008ec:	48 8b 00             	mov    (%rax),%rax
+  8008ef:	e9 95 00 00 00       	jmp    800989 <getint+0xf5>
+  else if (lflag)
+  8008f4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008f8:	74 48                	je     800942 <getint+0xae>
+    return va_arg(*ap, long);
+  8008fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008fe:	8b 00                	mov    (%rax),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 24                	ja     800929 <getint+0x95>
+  800905:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800909:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80090d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800911:	8b 00                	mov    (%rax),%eax
+  800913:	89 c0                	mov    %eax,%eax
+  800915:	48 01 d0             	add    %rdx,%rax
+  800918:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80091c:	8b 12                	mov    (%rdx),%edx
+  80091e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800921:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800925:	89 0a                	mov    %ecx,(%rdx)
+  800927:	eb 14                	jmp    80093d <getint+0xa9>
+  800929:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80092d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800931:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800935:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800939:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80093d:	48 8b 00             	mov    (%rax),%rax
+  800940:	eb 47                	jmp    800989 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800942:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800946:	8b 00                	mov    (%rax),%eax
+  800948:	83 f8 2f             	cmp    $0x2f,%eax
+  80094b:	77 24                	ja     800971 <getint+0xdd>
+  80094d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800951:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800955:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800959:	8b 00                	mov    (%rax),%eax
+  80095b:	89 c0                	mov    %eax,%eax
+  80095d:	48 01 d0             	add    %rdx,%rax
+  800960:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800964:	8b 12                	mov    (%rdx),%edx
+  800966:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800969:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80096d:	89 0a                	mov    %ecx,(%rdx)
+  80096f:	eb 14                	jmp    800985 <getint+0xf1>
+  800971:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800975:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800979:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80097d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800981:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800985:	8b 00                	mov    (%rax),%eax
+  800987:	48 98                	cltq
+}
+  800989:	c9                   	leave
+  80098a:	c3                   	ret
+
+000000000080098b <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80098b:	55                   	push   %rbp
+  80098c:	48 89 e5             	mov    %rsp,%rbp
+  80098f:	41 54                	push   %r12
+  800991:	53                   	push   %rbx
+  800992:	48 83 ec 60          	sub    $0x60,%rsp
+  800996:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80099a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80099e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009a2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8009a6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8009aa:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8009ae:	48 8b 06             	mov    (%rsi),%rax
+  8009b1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009b5:	48 89 01             	mov    %rax,(%rcx)
+  8009b8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009bc:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009c0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8009c4:	eb 17                	jmp    8009dd <vprintfmt+0x52>
+      if (ch == '\0')
+  8009c6:	85 db                	test   %ebx,%ebx
+  8009c8:	0f 84 bf 04 00 00    	je     800e8d <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8009ce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009d2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009d6:	48 89 c6             	mov    %rax,%rsi
+  8009d9:	89 df                	mov    %ebx,%edi
+  8009db:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8009dd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009e5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009e9:	0f b6 00             	movzbl (%rax),%eax
+  8009ec:	0f b6 d8             	movzbl %al,%ebx
+  8009ef:	83 fb 25             	cmp    $0x25,%ebx
+  8009f2:	75 d2                	jne    8009c6 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8009f4:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8009f8:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8009ff:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800a06:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800a0d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800a14:	eb 04                	jmp    800a1a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800a16:	90                   	nop
+  800a17:	eb 01                	jmp    800a1a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800a19:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800a1a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a1e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a22:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a26:	0f b6 00             	movzbl (%rax),%eax
+  800a29:	0f b6 d8             	movzbl %al,%ebx
+  800a2c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a2f:	83 f8 55             	cmp    $0x55,%eax
+  800a32:	0f 87 22 04 00 00    	ja     800e5a <vprintfmt+0x4cf>
+  800a38:	89 c0                	mov    %eax,%eax
+  800a3a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a41:	00 
+  800a42:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  800a49:	00 00 00 
+  800a4c:	48 01 d0             	add    %rdx,%rax
+  800a4f:	48 8b 00             	mov    (%rax),%rax
+  800a52:	ff e0                	jmp    *%rax
+        padc = '-';
+  800a54:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a58:	eb c0                	jmp    800a1a <vprintfmt+0x8f>
+        padc = '0';
+  800a5a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a5e:	eb ba                	jmp    800a1a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a60:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a67:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a6a:	89 d0                	mov    %edx,%eax
+  800a6c:	c1 e0 02             	shl    $0x2,%eax
+  800a6f:	01 d0                	add    %edx,%eax
+  800a71:	01 c0                	add    %eax,%eax
+  800a73:	01 d8                	add    %ebx,%eax
+  800a75:	83 e8 30             	sub    $0x30,%eax
+  800a78:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800a7b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a7f:	0f b6 00             	movzbl (%rax),%eax
+  800a82:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800a85:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a88:	7e 60                	jle    800aea <vprintfmt+0x15f>
+  800a8a:	83 fb 39             	cmp    $0x39,%ebx
+  800a8d:	7f 5b                	jg     800aea <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800a8f:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a94:	eb d1                	jmp    800a67 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a99:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9c:	77 17                	ja     800ab5 <vprintfmt+0x12a>
+  800a9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aa2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aa5:	89 d2                	mov    %edx,%edx
+  800aa7:	48 01 d0             	add    %rdx,%rax
+  800aaa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aad:	83 c2 08             	add    $0x8,%edx
+  800ab0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ab3:	eb 0c                	jmp    800ac1 <vprintfmt+0x136>
+  800ab5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ab9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800abd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ac1:	8b 00                	mov    (%rax),%eax
+  800ac3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800ac6:	eb 23                	jmp    800aeb <vprintfmt+0x160>
+        if (width < 0)
+  800ac8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800acc:	0f 89 44 ff ff ff    	jns    800a16 <vprintfmt+0x8b>
+          width = 0;
+  800ad2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800ad9:	e9 38 ff ff ff       	jmp    800a16 <vprintfmt+0x8b>
+        altflag = 1;
+  800ade:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800ae5:	e9 30 ff ff ff       	jmp    800a1a <vprintfmt+0x8f>
+        goto process_precision;
+  800aea:	90                   	nop
+        if (width < 0)
+  800aeb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800aef:	0f 89 24 ff ff ff    	jns    800a19 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800af5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800af8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800afb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800b02:	e9 12 ff ff ff       	jmp    800a19 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800b07:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800b0b:	e9 0a ff ff ff       	jmp    800a1a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800b10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b13:	83 f8 2f             	cmp    $0x2f,%eax
+  800b16:	77 17                	ja     800b2f <vprintfmt+0x1a4>
+  800b18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b1c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b1f:	89 d2                	mov    %edx,%edx
+  800b21:	48 01 d0             	add    %rdx,%rax
+  800b24:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b27:	83 c2 08             	add    $0x8,%edx
+  800b2a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b2d:	eb 0c                	jmp    800b3b <vprintfmt+0x1b0>
+  800b2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b33:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b37:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b3b:	8b 00                	mov    (%rax),%eax
+  800b3d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b41:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b45:	48 89 d6             	mov    %rdx,%rsi
+  800b48:	89 c7                	mov    %eax,%edi
+  800b4a:	ff d1                	call   *%rcx
+        break;
+  800b4c:	e9 37 03 00 00       	jmp    800e88 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800b51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b54:	83 f8 2f             	cmp    $0x2f,%eax
+  800b57:	77 17                	ja     800b70 <vprintfmt+0x1e5>
+  800b59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b5d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b60:	89 d2                	mov    %edx,%edx
+  800b62:	48 01 d0             	add    %rdx,%rax
+  800b65:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b68:	83 c2 08             	add    $0x8,%edx
+  800b6b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b6e:	eb 0c                	jmp    800b7c <vprintfmt+0x1f1>
+  800b70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b74:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b78:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b7c:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800b7e:	85 db                	test   %ebx,%ebx
+  800b80:	79 02                	jns    800b84 <vprintfmt+0x1f9>
+          err = -err;
+  800b82:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b84:	83 fb 15             	cmp    $0x15,%ebx
+  800b87:	7f 16                	jg     800b9f <vprintfmt+0x214>
+  800b89:	48 ba 40 69 80 00 00 	movabs $0x806940,%rdx
+  800b90:	00 00 00 
+  800b93:	48 63 c3             	movslq %ebx,%rax
+  800b96:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b9a:	4d 85 e4             	test   %r12,%r12
+  800b9d:	75 2e                	jne    800bcd <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b9f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ba3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ba7:	89 d9                	mov    %ebx,%ecx
+  800ba9:	48 ba 01 6a 80 00 00 	movabs $0x806a01,%rdx
+  800bb0:	00 00 00 
+  800bb3:	48 89 c7             	mov    %rax,%rdi
+  800bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbb:	49 b8 97 0e 80 00 00 	movabs $0x800e97,%r8
+  800bc2:	00 00 00 
+  800bc5:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800bc8:	e9 bb 02 00 00       	jmp    800e88 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800bcd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bd1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bd5:	4c 89 e1             	mov    %r12,%rcx
+  800bd8:	48 ba 0a 6a 80 00 00 	movabs $0x806a0a,%rdx
+  800bdf:	00 00 00 
+  800be2:	48 89 c7             	mov    %rax,%rdi
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	49 b8 97 0e 80 00 00 	movabs $0x800e97,%r8
+  800bf1:	00 00 00 
+  800bf4:	41 ff d0             	call   *%r8
+        break;
+  800bf7:	e9 8c 02 00 00       	jmp    800e88 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 17                	ja     800c1b <vprintfmt+0x290>
+  800c04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c08:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c0b:	89 d2                	mov    %edx,%edx
+  800c0d:	48 01 d0             	add    %rdx,%rax
+  800c10:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c13:	83 c2 08             	add    $0x8,%edx
+  800c16:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c19:	eb 0c                	jmp    800c27 <vprintfmt+0x29c>
+  800c1b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c1f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c23:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c27:	4c 8b 20             	mov    (%rax),%r12
+  800c2a:	4d 85 e4             	test   %r12,%r12
+  800c2d:	75 0a                	jne    800c39 <vprintfmt+0x2ae>
+          p = "(null)";
+  800c2f:	49 bc 0d 6a 80 00 00 	movabs $0x806a0d,%r12
+  800c36:	00 00 00 
+        if (width > 0 && padc != '-')
+  800c39:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c3d:	7e 78                	jle    800cb7 <vprintfmt+0x32c>
+  800c3f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800c43:	74 72                	je     800cb7 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c45:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800c48:	48 98                	cltq
+  800c4a:	48 89 c6             	mov    %rax,%rsi
+  800c4d:	4c 89 e7             	mov    %r12,%rdi
+  800c50:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  800c57:	00 00 00 
+  800c5a:	ff d0                	call   *%rax
+  800c5c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c5f:	eb 17                	jmp    800c78 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c61:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c65:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c69:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c6d:	48 89 d6             	mov    %rdx,%rsi
+  800c70:	89 c7                	mov    %eax,%edi
+  800c72:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c74:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c78:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c7c:	7f e3                	jg     800c61 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c7e:	eb 37                	jmp    800cb7 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800c80:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c84:	74 1e                	je     800ca4 <vprintfmt+0x319>
+  800c86:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c89:	7e 05                	jle    800c90 <vprintfmt+0x305>
+  800c8b:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c8e:	7e 14                	jle    800ca4 <vprintfmt+0x319>
+            putch('?', putdat);
+  800c90:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c94:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c98:	48 89 c6             	mov    %rax,%rsi
+  800c9b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ca0:	ff d2                	call   *%rdx
+  800ca2:	eb 0f                	jmp    800cb3 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800ca4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ca8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cac:	48 89 c6             	mov    %rax,%rsi
+  800caf:	89 df                	mov    %ebx,%edi
+  800cb1:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cb3:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cb7:	4c 89 e0             	mov    %r12,%rax
+  800cba:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cbe:	0f b6 00             	movzbl (%rax),%eax
+  800cc1:	0f be d8             	movsbl %al,%ebx
+  800cc4:	85 db                	test   %ebx,%ebx
+  800cc6:	74 28                	je     800cf0 <vprintfmt+0x365>
+  800cc8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ccc:	78 b2                	js     800c80 <vprintfmt+0x2f5>
+  800cce:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800cd2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800cd6:	79 a8                	jns    800c80 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800cd8:	eb 16                	jmp    800cf0 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800cda:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cde:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ce2:	48 89 c6             	mov    %rax,%rsi
+  800ce5:	bf 20 00 00 00       	mov    $0x20,%edi
+  800cea:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800cec:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cf0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cf4:	7f e4                	jg     800cda <vprintfmt+0x34f>
+        break;
+  800cf6:	e9 8d 01 00 00       	jmp    800e88 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800cfb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cfe:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d02:	89 d6                	mov    %edx,%esi
+  800d04:	48 89 c7             	mov    %rax,%rdi
+  800d07:	48 b8 94 08 80 00 00 	movabs $0x800894,%rax
+  800d0e:	00 00 00 
+  800d11:	ff d0                	call   *%rax
+  800d13:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800d17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1b:	48 85 c0             	test   %rax,%rax
+  800d1e:	79 1d                	jns    800d3d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800d20:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d24:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d28:	48 89 c6             	mov    %rax,%rsi
+  800d2b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d30:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800d32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d36:	48 f7 d8             	neg    %rax
+  800d39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800d3d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d44:	e9 d2 00 00 00       	jmp    800e1b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800d49:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d4c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d50:	89 d6                	mov    %edx,%esi
+  800d52:	48 89 c7             	mov    %rax,%rdi
+  800d55:	48 b8 9d 07 80 00 00 	movabs $0x80079d,%rax
+  800d5c:	00 00 00 
+  800d5f:	ff d0                	call   *%rax
+  800d61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d65:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d6c:	e9 aa 00 00 00       	jmp    800e1b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800d71:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d74:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d78:	89 d6                	mov    %edx,%esi
+  800d7a:	48 89 c7             	mov    %rax,%rdi
+  800d7d:	48 b8 9d 07 80 00 00 	movabs $0x80079d,%rax
+  800d84:	00 00 00 
+  800d87:	ff d0                	call   *%rax
+  800d89:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800d8d:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d94:	e9 82 00 00 00       	jmp    800e1b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d9d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800da1:	48 89 c6             	mov    %rax,%rsi
+  800da4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800da9:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800dab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800daf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800db3:	48 89 c6             	mov    %rax,%rsi
+  800db6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800dbb:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc3:	77 17                	ja     800ddc <vprintfmt+0x451>
+  800dc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dc9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dcc:	89 d2                	mov    %edx,%edx
+  800dce:	48 01 d0             	add    %rdx,%rax
+  800dd1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dd4:	83 c2 08             	add    $0x8,%edx
+  800dd7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800dda:	eb 0c                	jmp    800de8 <vprintfmt+0x45d>
+  800ddc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800de0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800de4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800de8:	48 8b 00             	mov    (%rax),%rax
+  800deb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800def:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800df6:	eb 23                	jmp    800e1b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800df8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dfb:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dff:	89 d6                	mov    %edx,%esi
+  800e01:	48 89 c7             	mov    %rax,%rdi
+  800e04:	48 b8 9d 07 80 00 00 	movabs $0x80079d,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+  800e10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e14:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800e1b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800e20:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800e23:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800e26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e2a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e2e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e32:	45 89 c1             	mov    %r8d,%r9d
+  800e35:	41 89 f8             	mov    %edi,%r8d
+  800e38:	48 89 c7             	mov    %rax,%rdi
+  800e3b:	48 b8 e5 06 80 00 00 	movabs $0x8006e5,%rax
+  800e42:	00 00 00 
+  800e45:	ff d0                	call   *%rax
+        break;
+  800e47:	eb 3f                	jmp    800e88 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800e49:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e4d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e51:	48 89 c6             	mov    %rax,%rsi
+  800e54:	89 df                	mov    %ebx,%edi
+  800e56:	ff d2                	call   *%rdx
+        break;
+  800e58:	eb 2e                	jmp    800e88 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e5a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e5e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e62:	48 89 c6             	mov    %rax,%rsi
+  800e65:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e6a:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800e6c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e71:	eb 05                	jmp    800e78 <vprintfmt+0x4ed>
+  800e73:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e78:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e7c:	48 83 e8 01          	sub    $0x1,%rax
+  800e80:	0f b6 00             	movzbl (%rax),%eax
+  800e83:	3c 25                	cmp    $0x25,%al
+  800e85:	75 ec                	jne    800e73 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800e87:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800e88:	e9 50 fb ff ff       	jmp    8009dd <vprintfmt+0x52>
+        return;
+  800e8d:	90                   	nop
+    }
+  }
+}
+  800e8e:	48 83 c4 60          	add    $0x60,%rsp
+  800e92:	5b                   	pop    %rbx
+  800e93:	41 5c                	pop    %r12
+  800e95:	5d                   	pop    %rbp
+  800e96:	c3                   	ret
+
+0000000000800e97 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e97:	55                   	push   %rbp
+  800e98:	48 89 e5             	mov    %rsp,%rbp
+  800e9b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ea2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ea9:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800eb0:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800eb7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ebe:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ec5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ecc:	84 c0                	test   %al,%al
+  800ece:	74 20                	je     800ef0 <printfmt+0x59>
+  800ed0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ed4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ed8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800edc:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ee0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ee4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ee8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800eec:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ef0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ef7:	00 00 00 
+  800efa:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f01:	00 00 00 
+  800f04:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f08:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f0f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f16:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800f1d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f24:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f2b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f32:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f39:	48 89 c7             	mov    %rax,%rdi
+  800f3c:	48 b8 8b 09 80 00 00 	movabs $0x80098b,%rax
+  800f43:	00 00 00 
+  800f46:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800f48:	90                   	nop
+  800f49:	c9                   	leave
+  800f4a:	c3                   	ret
+
+0000000000800f4b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800f4b:	55                   	push   %rbp
+  800f4c:	48 89 e5             	mov    %rsp,%rbp
+  800f4f:	48 83 ec 10          	sub    $0x10,%rsp
+  800f53:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f5e:	8b 40 10             	mov    0x10(%rax),%eax
+  800f61:	8d 50 01             	lea    0x1(%rax),%edx
+  800f64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f68:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800f6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f6f:	48 8b 10             	mov    (%rax),%rdx
+  800f72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f76:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f7a:	48 39 c2             	cmp    %rax,%rdx
+  800f7d:	73 17                	jae    800f96 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800f7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f83:	48 8b 00             	mov    (%rax),%rax
+  800f86:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f8a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f8e:	48 89 0a             	mov    %rcx,(%rdx)
+  800f91:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f94:	88 10                	mov    %dl,(%rax)
+}
+  800f96:	90                   	nop
+  800f97:	c9                   	leave
+  800f98:	c3                   	ret
+
+0000000000800f99 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f99:	55                   	push   %rbp
+  800f9a:	48 89 e5             	mov    %rsp,%rbp
+  800f9d:	48 83 ec 40          	sub    $0x40,%rsp
+  800fa1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800fa5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800fa8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fac:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800fb0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fb4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800fb8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800fbb:	48 98                	cltq
+  800fbd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800fc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fc5:	48 01 d0             	add    %rdx,%rax
+  800fc8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800fcc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800fd3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800fd8:	74 06                	je     800fe0 <vsnprintf+0x47>
+  800fda:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800fde:	7f 07                	jg     800fe7 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800fe0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fe5:	eb 32                	jmp    801019 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800fe7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800feb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800fef:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800ff3:	48 89 c6             	mov    %rax,%rsi
+  800ff6:	48 b8 4b 0f 80 00 00 	movabs $0x800f4b,%rax
+  800ffd:	00 00 00 
+  801000:	48 89 c7             	mov    %rax,%rdi
+  801003:	48 b8 8b 09 80 00 00 	movabs $0x80098b,%rax
+  80100a:	00 00 00 
+  80100d:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80100f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801013:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801016:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801019:	c9                   	leave
+  80101a:	c3                   	ret
+
+000000000080101b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  80101b:	55                   	push   %rbp
+  80101c:	48 89 e5             	mov    %rsp,%rbp
+  80101f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801026:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80102d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801033:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80103a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801041:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801048:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80104f:	84 c0                	test   %al,%al
+  801051:	74 20                	je     801073 <snprintf+0x58>
+  801053:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801057:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80105b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80105f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801063:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801067:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80106b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80106f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801073:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80107a:	00 00 00 
+  80107d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801084:	00 00 00 
+  801087:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80108b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801092:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801099:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8010a0:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8010a7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010ae:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8010b4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010bb:	48 89 c7             	mov    %rax,%rdi
+  8010be:	48 b8 99 0f 80 00 00 	movabs $0x800f99,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+  8010ca:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8010d0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8010d6:	c9                   	leave
+  8010d7:	c3                   	ret
+
+00000000008010d8 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8010d8:	55                   	push   %rbp
+  8010d9:	48 89 e5             	mov    %rsp,%rbp
+  8010dc:	53                   	push   %rbx
+  8010dd:	48 83 ec 38          	sub    $0x38,%rsp
+  8010e1:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8010e4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010e8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8010ec:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8010f0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8010f4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	89 d1                	mov    %edx,%ecx
+  8010fe:	0f a2                	cpuid
+  801100:	89 de                	mov    %ebx,%esi
+  801102:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801105:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801108:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80110b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  80110e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801113:	74 09                	je     80111e <cpuid+0x46>
+}
+  801115:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801119:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80111c:	89 10                	mov    %edx,(%rax)
+
+  80111e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801123:	74 09                	je     80112e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801125:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801129:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80112c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80112e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801133:	74 09                	je     80113e <cpuid+0x66>
+char *
+  801135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801139:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80113c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80113e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801143:	74 09                	je     80114e <cpuid+0x76>
+  for (; *s; s++)
+  801145:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801149:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80114c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80114e:	90                   	nop
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	48 83 ec 18          	sub    $0x18,%rsp
+  80115d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801160:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801163:	89 c1                	mov    %eax,%ecx
+  801165:	0f 01 d0             	xgetbv
+  801168:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80116b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80116e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801171:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801174:	48 c1 e2 20          	shl    $0x20,%rdx
+  801178:	48 09 d0             	or     %rdx,%rax
+#else
+  80117b:	c9                   	leave
+  80117c:	c3                   	ret
+
+000000000080117d <string_cpu>:
+string_cpu(void) {
+  80117d:	55                   	push   %rbp
+  80117e:	48 89 e5             	mov    %rsp,%rbp
+  801181:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801185:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80118c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801193:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80119a:	00 00 00 
+  80119d:	8b 00                	mov    (%rax),%eax
+  80119f:	85 c0                	test   %eax,%eax
+  8011a1:	78 11                	js     8011b4 <string_cpu+0x37>
+    return string_features;
+  8011a3:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8011aa:	00 00 00 
+  8011ad:	8b 00                	mov    (%rax),%eax
+  8011af:	e9 df 00 00 00       	jmp    801293 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8011b4:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8011b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c8:	48 89 c6             	mov    %rax,%rsi
+  8011cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d0:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  8011d7:	00 00 00 
+  8011da:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8011dc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011df:	83 f8 06             	cmp    $0x6,%eax
+  8011e2:	76 28                	jbe    80120c <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8011e4:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8011e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f3:	48 89 c2             	mov    %rax,%rdx
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	bf 07 00 00 00       	mov    $0x7,%edi
+  801200:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  801207:	00 00 00 
+  80120a:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80120c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80120f:	25 00 02 00 00       	and    $0x200,%eax
+  801214:	85 c0                	test   %eax,%eax
+  801216:	74 04                	je     80121c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801218:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80121c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801226:	48 89 c1             	mov    %rax,%rcx
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122e:	be 00 00 00 00       	mov    $0x0,%esi
+  801233:	bf 01 00 00 00       	mov    $0x1,%edi
+  801238:	48 b8 d8 10 80 00 00 	movabs $0x8010d8,%rax
+  80123f:	00 00 00 
+  801242:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801244:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801247:	83 e0 20             	and    $0x20,%eax
+  80124a:	85 c0                	test   %eax,%eax
+  80124c:	74 2a                	je     801278 <string_cpu+0xfb>
+  80124e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801251:	25 00 00 00 08       	and    $0x8000000,%eax
+  801256:	85 c0                	test   %eax,%eax
+  801258:	74 1e                	je     801278 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80125a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80125f:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  801266:	00 00 00 
+  801269:	ff d0                	call   *%rax
+  80126b:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80126e:	48 83 f8 06          	cmp    $0x6,%rax
+  801272:	75 04                	jne    801278 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801274:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801278:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80127f:	00 00 00 
+  801282:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801285:	89 02                	mov    %eax,(%rdx)
+  801287:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80128e:	00 00 00 
+  801291:	8b 00                	mov    (%rax),%eax
+}
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80129d:	48 83 ec 60          	sub    $0x60,%rsp
+  8012a1:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8012a6:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8012ab:	83 e0 1f             	and    $0x1f,%eax
+  8012ae:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8012b2:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012b6:	48 f7 d8             	neg    %rax
+  8012b9:	48 89 c2             	mov    %rax,%rdx
+  8012bc:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8012c1:	48 01 d0             	add    %rdx,%rax
+  8012c4:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8012c9:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8012cd:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8012d3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012d8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012dc:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012e2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012e6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012ea:	89 c2                	mov    %eax,%edx
+  8012ec:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8012f5:	89 c1                	mov    %eax,%ecx
+  8012f7:	d3 e6                	shl    %cl,%esi
+  8012f9:	89 f0                	mov    %esi,%eax
+  8012fb:	21 d0                	and    %edx,%eax
+  8012fd:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801301:	eb 21                	jmp    801324 <strlen_avx2+0x8f>
+    p += 32;
+  801303:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801309:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80130e:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801312:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801318:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80131c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801320:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801324:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801329:	74 d8                	je     801303 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80132b:	31 c0                	xor    %eax,%eax
+  80132d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801333:	48 63 d0             	movslq %eax,%rdx
+  801336:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80133b:	48 01 d0             	add    %rdx,%rax
+  80133e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+
+0000000000801345 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801345:	55                   	push   %rbp
+  801346:	48 89 e5             	mov    %rsp,%rbp
+  801349:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80134d:	48 83 ec 40          	sub    $0x40,%rsp
+  801351:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801356:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80135b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801360:	eb 77                	jmp    8013d9 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801362:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801367:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80136b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80136f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801374:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801378:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80137c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801380:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801384:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801389:	74 3c                	je     8013c7 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80138b:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80138f:	f7 d0                	not    %eax
+  801391:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801395:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801399:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80139d:	48 63 d0             	movslq %eax,%rdx
+  8013a0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013a5:	48 01 d0             	add    %rdx,%rax
+  8013a8:	0f b6 00             	movzbl (%rax),%eax
+  8013ab:	0f b6 c0             	movzbl %al,%eax
+  8013ae:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8013b2:	48 63 ca             	movslq %edx,%rcx
+  8013b5:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8013ba:	48 01 ca             	add    %rcx,%rdx
+  8013bd:	0f b6 12             	movzbl (%rdx),%edx
+  8013c0:	0f b6 d2             	movzbl %dl,%edx
+  8013c3:	29 d0                	sub    %edx,%eax
+  8013c5:	eb 6b                	jmp    801432 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8013c7:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8013cd:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8013d3:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8013d9:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8013df:	77 81                	ja     801362 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8013e1:	eb 42                	jmp    801425 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8013e3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013e8:	0f b6 10             	movzbl (%rax),%edx
+  8013eb:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013f0:	0f b6 00             	movzbl (%rax),%eax
+  8013f3:	38 c2                	cmp    %al,%dl
+  8013f5:	74 1c                	je     801413 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8013f7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013fc:	0f b6 00             	movzbl (%rax),%eax
+  8013ff:	0f b6 c8             	movzbl %al,%ecx
+  801402:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801407:	0f b6 00             	movzbl (%rax),%eax
+  80140a:	0f b6 d0             	movzbl %al,%edx
+  80140d:	89 c8                	mov    %ecx,%eax
+  80140f:	29 d0                	sub    %edx,%eax
+  801411:	eb 1f                	jmp    801432 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801413:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801419:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80141f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801425:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80142b:	75 b6                	jne    8013e3 <memcmp_avx2+0x9e>
+  return 0;
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801432:	c9                   	leave
+  801433:	c3                   	ret
+
+0000000000801434 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80143c:	48 83 ec 60          	sub    $0x60,%rsp
+  801440:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801445:	89 f0                	mov    %esi,%eax
+  801447:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80144c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801450:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801455:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801459:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80145e:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801464:	eb 47                	jmp    8014ad <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801466:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80146b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80146f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801473:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801479:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80147d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801481:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801485:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80148a:	74 15                	je     8014a1 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80148c:	31 c0                	xor    %eax,%eax
+  80148e:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801494:	48 63 d0             	movslq %eax,%rdx
+  801497:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80149c:	48 01 d0             	add    %rdx,%rax
+  80149f:	eb 3d                	jmp    8014de <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8014a1:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8014a7:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8014ad:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8014b3:	77 b1                	ja     801466 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8014b5:	eb 0c                	jmp    8014c3 <memfind_avx2+0x8f>
+  8014b7:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8014bd:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8014c3:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014c9:	74 0e                	je     8014d9 <memfind_avx2+0xa5>
+  8014cb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014d0:	0f b6 00             	movzbl (%rax),%eax
+  8014d3:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8014d7:	75 de                	jne    8014b7 <memfind_avx2+0x83>
+  return s;
+  8014d9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8014de:	c9                   	leave
+  8014df:	c3                   	ret
+
+00000000008014e0 <strlen>:
+strlen(const char *s) {
+  8014e0:	55                   	push   %rbp
+  8014e1:	48 89 e5             	mov    %rsp,%rbp
+  8014e4:	48 83 ec 40          	sub    $0x40,%rsp
+  8014e8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8014ec:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8014f0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8014f4:	48 b8 7d 11 80 00 00 	movabs $0x80117d,%rax
+  8014fb:	00 00 00 
+  8014fe:	ff d0                	call   *%rax
+  801500:	83 e0 02             	and    $0x2,%eax
+  801503:	85 c0                	test   %eax,%eax
+  801505:	74 18                	je     80151f <strlen+0x3f>
+    return strlen_avx2(s);
+  801507:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80150b:	48 89 c7             	mov    %rax,%rdi
+  80150e:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  801515:	00 00 00 
+  801518:	ff d0                	call   *%rax
+  80151a:	e9 82 00 00 00       	jmp    8015a1 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80151f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801523:	83 e0 0f             	and    $0xf,%eax
+  801526:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801529:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80152c:	48 f7 d8             	neg    %rax
+  80152f:	48 89 c2             	mov    %rax,%rdx
+  801532:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801536:	48 01 d0             	add    %rdx,%rax
+  801539:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80153d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801541:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801545:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80154a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80154e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801552:	89 c2                	mov    %eax,%edx
+  801554:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801557:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80155c:	89 c1                	mov    %eax,%ecx
+  80155e:	d3 e6                	shl    %cl,%esi
+  801560:	89 f0                	mov    %esi,%eax
+  801562:	21 d0                	and    %edx,%eax
+  801564:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801567:	eb 1d                	jmp    801586 <strlen+0xa6>
+    p += 16;
+  801569:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80156e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801572:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801576:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80157b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80157f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801583:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801586:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80158a:	74 dd                	je     801569 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80158c:	31 c0                	xor    %eax,%eax
+  80158e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801593:	48 63 d0             	movslq %eax,%rdx
+  801596:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80159a:	48 01 d0             	add    %rdx,%rax
+  80159d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+
+00000000008015a3 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8015a3:	55                   	push   %rbp
+  8015a4:	48 89 e5             	mov    %rsp,%rbp
+  8015a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8015ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015ba:	eb 0e                	jmp    8015ca <strnlen+0x27>
+    n++;
+  8015bc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015c0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015c5:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015ca:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8015cf:	74 0b                	je     8015dc <strnlen+0x39>
+  8015d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d5:	0f b6 00             	movzbl (%rax),%eax
+  8015d8:	84 c0                	test   %al,%al
+  8015da:	75 e0                	jne    8015bc <strnlen+0x19>
+  return n;
+  8015dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015df:	c9                   	leave
+  8015e0:	c3                   	ret
+
+00000000008015e1 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+  8015e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8015e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8015f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8015f9:	90                   	nop
+  8015fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015fe:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801602:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80160e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801612:	0f b6 12             	movzbl (%rdx),%edx
+  801615:	88 10                	mov    %dl,(%rax)
+  801617:	0f b6 00             	movzbl (%rax),%eax
+  80161a:	84 c0                	test   %al,%al
+  80161c:	75 dc                	jne    8015fa <strcpy+0x19>
+  return ret;
+  80161e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801622:	c9                   	leave
+  801623:	c3                   	ret
+
+0000000000801624 <strcat>:
+strcat(char *dst, const char *src) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+  801628:	48 83 ec 20          	sub    $0x20,%rsp
+  80162c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801630:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801638:	48 89 c7             	mov    %rax,%rdi
+  80163b:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+  801647:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80164a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80164d:	48 63 d0             	movslq %eax,%rdx
+  801650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801654:	48 01 c2             	add    %rax,%rdx
+  801657:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80165b:	48 89 c6             	mov    %rax,%rsi
+  80165e:	48 89 d7             	mov    %rdx,%rdi
+  801661:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  801668:	00 00 00 
+  80166b:	ff d0                	call   *%rax
+  return dst;
+  80166d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+
+0000000000801673 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801673:	55                   	push   %rbp
+  801674:	48 89 e5             	mov    %rsp,%rbp
+  801677:	48 83 ec 28          	sub    $0x28,%rsp
+  80167b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80167f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801683:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801687:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80168b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80168f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801696:	00 
+  801697:	eb 2a                	jmp    8016c3 <strncpy+0x50>
+    *dst++ = *src;
+  801699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016a1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016a5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016a9:	0f b6 12             	movzbl (%rdx),%edx
+  8016ac:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8016ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b2:	0f b6 00             	movzbl (%rax),%eax
+  8016b5:	84 c0                	test   %al,%al
+  8016b7:	74 05                	je     8016be <strncpy+0x4b>
+      src++;
+  8016b9:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8016be:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8016cb:	72 cc                	jb     801699 <strncpy+0x26>
+  return ret;
+  8016cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+
+00000000008016d3 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	48 83 ec 28          	sub    $0x28,%rsp
+  8016db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016e3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8016e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8016ef:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016f4:	74 3d                	je     801733 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8016f6:	eb 1d                	jmp    801715 <strlcpy+0x42>
+      *dst++ = *src++;
+  8016f8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016fc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801700:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801708:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80170c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801710:	0f b6 12             	movzbl (%rdx),%edx
+  801713:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801715:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80171a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80171f:	74 0b                	je     80172c <strlcpy+0x59>
+  801721:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801725:	0f b6 00             	movzbl (%rax),%eax
+  801728:	84 c0                	test   %al,%al
+  80172a:	75 cc                	jne    8016f8 <strlcpy+0x25>
+    *dst = '\0';
+  80172c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801730:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801733:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801737:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80173b:	c9                   	leave
+  80173c:	c3                   	ret
+
+000000000080173d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80173d:	55                   	push   %rbp
+  80173e:	48 89 e5             	mov    %rsp,%rbp
+  801741:	48 83 ec 30          	sub    $0x30,%rsp
+  801745:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801749:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80174d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801751:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801755:	48 89 c7             	mov    %rax,%rdi
+  801758:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  80175f:	00 00 00 
+  801762:	ff d0                	call   *%rax
+  801764:	48 98                	cltq
+  801766:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80176a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80176e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801772:	48 89 d6             	mov    %rdx,%rsi
+  801775:	48 89 c7             	mov    %rax,%rdi
+  801778:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  80177f:	00 00 00 
+  801782:	ff d0                	call   *%rax
+  801784:	48 98                	cltq
+  801786:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80178a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801792:	75 10                	jne    8017a4 <strlcat+0x67>
+    return maxlen + srclen;
+  801794:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179c:	48 01 d0             	add    %rdx,%rax
+  80179f:	e9 86 00 00 00       	jmp    80182a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8017a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017a8:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8017ac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8017b0:	73 2b                	jae    8017dd <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8017b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017ba:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c2:	48 01 c1             	add    %rax,%rcx
+  8017c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017c9:	48 89 c6             	mov    %rax,%rsi
+  8017cc:	48 89 cf             	mov    %rcx,%rdi
+  8017cf:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  8017d6:	00 00 00 
+  8017d9:	ff d0                	call   *%rax
+  8017db:	eb 42                	jmp    80181f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8017dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017e5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ed:	48 01 c1             	add    %rax,%rcx
+  8017f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017f4:	48 89 c6             	mov    %rax,%rsi
+  8017f7:	48 89 cf             	mov    %rcx,%rdi
+  8017fa:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  801801:	00 00 00 
+  801804:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801806:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80180a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180e:	48 01 d0             	add    %rdx,%rax
+  801811:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801819:	48 01 d0             	add    %rdx,%rax
+  80181c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80181f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801823:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801827:	48 01 d0             	add    %rdx,%rax
+}
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <strcmp>:
+strcmp(const char *p, const char *q) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	48 83 ec 10          	sub    $0x10,%rsp
+  801834:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801838:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80183c:	eb 0a                	jmp    801848 <strcmp+0x1c>
+    p++, q++;
+  80183e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801843:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184c:	0f b6 00             	movzbl (%rax),%eax
+  80184f:	84 c0                	test   %al,%al
+  801851:	74 12                	je     801865 <strcmp+0x39>
+  801853:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801857:	0f b6 10             	movzbl (%rax),%edx
+  80185a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185e:	0f b6 00             	movzbl (%rax),%eax
+  801861:	38 c2                	cmp    %al,%dl
+  801863:	74 d9                	je     80183e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801869:	0f b6 00             	movzbl (%rax),%eax
+  80186c:	0f b6 d0             	movzbl %al,%edx
+  80186f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801873:	0f b6 00             	movzbl (%rax),%eax
+  801876:	0f b6 c0             	movzbl %al,%eax
+  801879:	29 c2                	sub    %eax,%edx
+  80187b:	89 d0                	mov    %edx,%eax
+}
+  80187d:	c9                   	leave
+  80187e:	c3                   	ret
+
+000000000080187f <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80187f:	55                   	push   %rbp
+  801880:	48 89 e5             	mov    %rsp,%rbp
+  801883:	48 83 ec 18          	sub    $0x18,%rsp
+  801887:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80188b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80188f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801893:	eb 0f                	jmp    8018a4 <strncmp+0x25>
+    n--, p++, q++;
+  801895:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80189a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8018a4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a9:	74 1d                	je     8018c8 <strncmp+0x49>
+  8018ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018af:	0f b6 00             	movzbl (%rax),%eax
+  8018b2:	84 c0                	test   %al,%al
+  8018b4:	74 12                	je     8018c8 <strncmp+0x49>
+  8018b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ba:	0f b6 10             	movzbl (%rax),%edx
+  8018bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018c1:	0f b6 00             	movzbl (%rax),%eax
+  8018c4:	38 c2                	cmp    %al,%dl
+  8018c6:	74 cd                	je     801895 <strncmp+0x16>
+  if (n == 0)
+  8018c8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018cd:	75 07                	jne    8018d6 <strncmp+0x57>
+    return 0;
+  8018cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d4:	eb 16                	jmp    8018ec <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	0f b6 d0             	movzbl %al,%edx
+  8018e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e4:	0f b6 00             	movzbl (%rax),%eax
+  8018e7:	0f b6 c0             	movzbl %al,%eax
+  8018ea:	29 c2                	sub    %eax,%edx
+}
+  8018ec:	89 d0                	mov    %edx,%eax
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+00000000008018f0 <strchr>:
+strchr(const char *s, char c) {
+  8018f0:	55                   	push   %rbp
+  8018f1:	48 89 e5             	mov    %rsp,%rbp
+  8018f4:	48 83 ec 60          	sub    $0x60,%rsp
+  8018f8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8018fc:	89 f0                	mov    %esi,%eax
+  8018fe:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801901:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801905:	83 e0 0f             	and    $0xf,%eax
+  801908:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80190b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80190e:	48 f7 d8             	neg    %rax
+  801911:	48 89 c2             	mov    %rax,%rdx
+  801914:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801918:	48 01 d0             	add    %rdx,%rax
+  80191b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80191f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801923:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801927:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80192b:	66 0f 6e c0          	movd   %eax,%xmm0
+  80192f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801933:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801937:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80193c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801940:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801944:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801948:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80194c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801951:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801956:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80195a:	89 c2                	mov    %eax,%edx
+  80195c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801961:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801966:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80196a:	09 c2                	or     %eax,%edx
+  80196c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80196f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801974:	89 c1                	mov    %eax,%ecx
+  801976:	d3 e6                	shl    %cl,%esi
+  801978:	89 f0                	mov    %esi,%eax
+  80197a:	21 d0                	and    %edx,%eax
+  80197c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80197f:	eb 34                	jmp    8019b5 <strchr+0xc5>
+    p += 16;
+  801981:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801986:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80198e:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801992:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801997:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80199c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019a0:	89 c2                	mov    %eax,%edx
+  8019a2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019a7:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8019ac:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019b0:	09 d0                	or     %edx,%eax
+  8019b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019b9:	74 c6                	je     801981 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8019bb:	31 c0                	xor    %eax,%eax
+  8019bd:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8019c2:	48 98                	cltq
+  8019c4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8019c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019cc:	0f b6 00             	movzbl (%rax),%eax
+  8019cf:	84 c0                	test   %al,%al
+  8019d1:	74 06                	je     8019d9 <strchr+0xe9>
+  8019d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d7:	eb 05                	jmp    8019de <strchr+0xee>
+  8019d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019de:	c9                   	leave
+  8019df:	c3                   	ret
+
+00000000008019e0 <strfind>:
+strfind(const char *s, char c) {
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8019e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019ec:	89 f0                	mov    %esi,%eax
+  8019ee:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8019f1:	eb 11                	jmp    801a04 <strfind+0x24>
+    if (*s == c)
+  8019f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f7:	0f b6 00             	movzbl (%rax),%eax
+  8019fa:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019fd:	74 12                	je     801a11 <strfind+0x31>
+  for (; *s; s++)
+  8019ff:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a08:	0f b6 00             	movzbl (%rax),%eax
+  801a0b:	84 c0                	test   %al,%al
+  801a0d:	75 e4                	jne    8019f3 <strfind+0x13>
+  801a0f:	eb 01                	jmp    801a12 <strfind+0x32>
+      break;
+  801a11:	90                   	nop
+  return (char *)s;
+  801a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a16:	c9                   	leave
+  801a17:	c3                   	ret
+
+0000000000801a18 <memset>:
+memset(void *v, int c, size_t n) {
+  801a18:	55                   	push   %rbp
+  801a19:	48 89 e5             	mov    %rsp,%rbp
+  801a1c:	48 83 ec 38          	sub    $0x38,%rsp
+  801a20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a24:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a27:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801a2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a33:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a38:	76 41                	jbe    801a7b <memset+0x63>
+  801a3a:	48 b8 7d 11 80 00 00 	movabs $0x80117d,%rax
+  801a41:	00 00 00 
+  801a44:	ff d0                	call   *%rax
+  801a46:	83 e0 01             	and    $0x1,%eax
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	74 2e                	je     801a7b <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801a4d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a50:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a54:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a58:	48 89 ce             	mov    %rcx,%rsi
+  801a5b:	48 89 f7             	mov    %rsi,%rdi
+  801a5e:	48 89 d1             	mov    %rdx,%rcx
+  801a61:	fc                   	cld
+  801a62:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a64:	48 89 ca             	mov    %rcx,%rdx
+  801a67:	48 89 fe             	mov    %rdi,%rsi
+  801a6a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a6e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801a72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a76:	e9 a7 00 00 00       	jmp    801b22 <memset+0x10a>
+  if (n >= 8) {
+  801a7b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a80:	0f 86 87 00 00 00    	jbe    801b0d <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801a86:	eb 16                	jmp    801a9e <memset+0x86>
+      *p++ = c;
+  801a88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a90:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a94:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a97:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a99:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa2:	83 e0 07             	and    $0x7,%eax
+  801aa5:	48 85 c0             	test   %rax,%rax
+  801aa8:	75 de                	jne    801a88 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801aaa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801aad:	0f b6 c0             	movzbl %al,%eax
+  801ab0:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801ab7:	01 01 01 
+  801aba:	48 0f af c2          	imul   %rdx,%rax
+  801abe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801ac2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ac6:	48 c1 e8 03          	shr    $0x3,%rax
+  801aca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801ace:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ad6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ada:	48 89 ce             	mov    %rcx,%rsi
+  801add:	48 89 f7             	mov    %rsi,%rdi
+  801ae0:	48 89 d1             	mov    %rdx,%rcx
+  801ae3:	fc                   	cld
+  801ae4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ae7:	48 89 ca             	mov    %rcx,%rdx
+  801aea:	48 89 fe             	mov    %rdi,%rsi
+  801aed:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801af1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801af5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801afa:	eb 11                	jmp    801b0d <memset+0xf5>
+    *p++ = c;
+  801afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b00:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b04:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b08:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b0b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801b0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b11:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b15:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b19:	48 85 c0             	test   %rax,%rax
+  801b1c:	75 de                	jne    801afc <memset+0xe4>
+  return v;
+  801b1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b22:	c9                   	leave
+  801b23:	c3                   	ret
+
+0000000000801b24 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	48 83 ec 38          	sub    $0x38,%rsp
+  801b2c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b30:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b34:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801b38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801b40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b44:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b4c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b50:	0f 83 da 00 00 00    	jae    801c30 <memmove+0x10c>
+  801b56:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b5e:	48 01 d0             	add    %rdx,%rax
+  801b61:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b65:	0f 83 c5 00 00 00    	jae    801c30 <memmove+0x10c>
+    s += n;
+  801b6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b6f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801b73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b77:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801b7b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b80:	0f 86 94 00 00 00    	jbe    801c1a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801b86:	eb 1c                	jmp    801ba4 <memmove+0x80>
+        *--d = *--s;
+  801b88:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b8d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b96:	0f b6 10             	movzbl (%rax),%edx
+  801b99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b9d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b9f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ba8:	83 e0 07             	and    $0x7,%eax
+  801bab:	48 85 c0             	test   %rax,%rax
+  801bae:	75 d8                	jne    801b88 <memmove+0x64>
+      nq = n / 8;
+  801bb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb4:	48 c1 e8 03          	shr    $0x3,%rax
+  801bb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801bbc:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801bc1:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801bc6:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801bcb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801bcf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bd7:	48 89 cf             	mov    %rcx,%rdi
+  801bda:	48 89 d6             	mov    %rdx,%rsi
+  801bdd:	48 89 c1             	mov    %rax,%rcx
+  801be0:	fd                   	std
+  801be1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801be4:	fc                   	cld
+  801be5:	48 89 c8             	mov    %rcx,%rax
+  801be8:	48 89 f2             	mov    %rsi,%rdx
+  801beb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bef:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bf3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801bf7:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801bfc:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801c01:	eb 17                	jmp    801c1a <memmove+0xf6>
+      *--d = *--s;
+  801c03:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c08:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c11:	0f b6 10             	movzbl (%rax),%edx
+  801c14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c18:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c22:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c26:	48 85 c0             	test   %rax,%rax
+  801c29:	75 d8                	jne    801c03 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801c2b:	e9 f4 00 00 00       	jmp    801d24 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c30:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c35:	76 46                	jbe    801c7d <memmove+0x159>
+  801c37:	48 b8 7d 11 80 00 00 	movabs $0x80117d,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+  801c43:	83 e0 01             	and    $0x1,%eax
+  801c46:	85 c0                	test   %eax,%eax
+  801c48:	74 33                	je     801c7d <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801c4a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c56:	48 89 cf             	mov    %rcx,%rdi
+  801c59:	48 89 d6             	mov    %rdx,%rsi
+  801c5c:	48 89 c1             	mov    %rax,%rcx
+  801c5f:	fc                   	cld
+  801c60:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c62:	48 89 c8             	mov    %rcx,%rax
+  801c65:	48 89 f2             	mov    %rsi,%rdx
+  801c68:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c6c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801c74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c78:	e9 ab 00 00 00       	jmp    801d28 <memmove+0x204>
+    if (n >= 8) {
+  801c7d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c82:	0f 86 8b 00 00 00    	jbe    801d13 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801c88:	eb 22                	jmp    801cac <memmove+0x188>
+        *d++ = *s++;
+  801c8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c8e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c92:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c9a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c9e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ca2:	0f b6 12             	movzbl (%rdx),%edx
+  801ca5:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801ca7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cb0:	83 e0 07             	and    $0x7,%eax
+  801cb3:	48 85 c0             	test   %rax,%rax
+  801cb6:	75 d2                	jne    801c8a <memmove+0x166>
+      nq = n / 8;
+  801cb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cbc:	48 c1 e8 03          	shr    $0x3,%rax
+  801cc0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801cc4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cc8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ccc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cd0:	48 89 cf             	mov    %rcx,%rdi
+  801cd3:	48 89 d6             	mov    %rdx,%rsi
+  801cd6:	48 89 c1             	mov    %rax,%rcx
+  801cd9:	fc                   	cld
+  801cda:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801cdd:	48 89 c8             	mov    %rcx,%rax
+  801ce0:	48 89 f2             	mov    %rsi,%rdx
+  801ce3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ce7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ceb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801cef:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801cf4:	eb 1d                	jmp    801d13 <memmove+0x1ef>
+      *d++ = *s++;
+  801cf6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cfa:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cfe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d06:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d0a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d0e:	0f b6 12             	movzbl (%rdx),%edx
+  801d11:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d17:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d1b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d1f:	48 85 c0             	test   %rax,%rax
+  801d22:	75 d2                	jne    801cf6 <memmove+0x1d2>
+  return dst;
+  801d24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d28:	c9                   	leave
+  801d29:	c3                   	ret
+
+0000000000801d2a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801d2a:	55                   	push   %rbp
+  801d2b:	48 89 e5             	mov    %rsp,%rbp
+  801d2e:	48 83 ec 18          	sub    $0x18,%rsp
+  801d32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801d3e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d42:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d4a:	48 89 ce             	mov    %rcx,%rsi
+  801d4d:	48 89 c7             	mov    %rax,%rdi
+  801d50:	48 b8 24 1b 80 00 00 	movabs $0x801b24,%rax
+  801d57:	00 00 00 
+  801d5a:	ff d0                	call   *%rax
+}
+  801d5c:	c9                   	leave
+  801d5d:	c3                   	ret
+
+0000000000801d5e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d5e:	55                   	push   %rbp
+  801d5f:	48 89 e5             	mov    %rsp,%rbp
+  801d62:	48 83 ec 40          	sub    $0x40,%rsp
+  801d66:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d6a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d6e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801d72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d76:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801d7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d82:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801d87:	0f 86 a7 00 00 00    	jbe    801e34 <memcmp+0xd6>
+  801d8d:	48 b8 7d 11 80 00 00 	movabs $0x80117d,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+  801d99:	83 e0 02             	and    $0x2,%eax
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	0f 84 90 00 00 00    	je     801e34 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801da4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801da8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801db0:	48 89 ce             	mov    %rcx,%rsi
+  801db3:	48 89 c7             	mov    %rax,%rdi
+  801db6:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+  801dc2:	e9 c2 00 00 00       	jmp    801e89 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801dc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dcb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801dcf:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801dd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dd7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ddb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ddf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801de3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801de6:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801ded:	74 36                	je     801e25 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801def:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801df2:	f7 d0                	not    %eax
+  801df4:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801df8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801dfb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801dfe:	48 63 d0             	movslq %eax,%rdx
+  801e01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e05:	48 01 d0             	add    %rdx,%rax
+  801e08:	0f b6 00             	movzbl (%rax),%eax
+  801e0b:	0f b6 c0             	movzbl %al,%eax
+  801e0e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801e11:	48 63 ca             	movslq %edx,%rcx
+  801e14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e18:	48 01 ca             	add    %rcx,%rdx
+  801e1b:	0f b6 12             	movzbl (%rdx),%edx
+  801e1e:	0f b6 d2             	movzbl %dl,%edx
+  801e21:	29 d0                	sub    %edx,%eax
+  801e23:	eb 64                	jmp    801e89 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801e25:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801e2a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801e2f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801e34:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801e39:	77 8c                	ja     801dc7 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801e3b:	eb 36                	jmp    801e73 <memcmp+0x115>
+    if (*s1 != *s2)
+  801e3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e41:	0f b6 10             	movzbl (%rax),%edx
+  801e44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e48:	0f b6 00             	movzbl (%rax),%eax
+  801e4b:	38 c2                	cmp    %al,%dl
+  801e4d:	74 1a                	je     801e69 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801e4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e53:	0f b6 00             	movzbl (%rax),%eax
+  801e56:	0f b6 c8             	movzbl %al,%ecx
+  801e59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e5d:	0f b6 00             	movzbl (%rax),%eax
+  801e60:	0f b6 d0             	movzbl %al,%edx
+  801e63:	89 c8                	mov    %ecx,%eax
+  801e65:	29 d0                	sub    %edx,%eax
+  801e67:	eb 20                	jmp    801e89 <memcmp+0x12b>
+    s1++, s2++;
+  801e69:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e6e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801e73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e77:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e7b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e7f:	48 85 c0             	test   %rax,%rax
+  801e82:	75 b9                	jne    801e3d <memcmp+0xdf>
+  }
+
+  return 0;
+  801e84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e89:	c9                   	leave
+  801e8a:	c3                   	ret
+
+0000000000801e8b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801e8b:	55                   	push   %rbp
+  801e8c:	48 89 e5             	mov    %rsp,%rbp
+  801e8f:	48 83 ec 50          	sub    $0x50,%rsp
+  801e93:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e97:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e9a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e9e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ea2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801ea6:	48 01 d0             	add    %rdx,%rax
+  801ea9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801ead:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801eb0:	66 0f 6e c0          	movd   %eax,%xmm0
+  801eb4:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801eb8:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801ebc:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801ec1:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ec5:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801eca:	76 73                	jbe    801f3f <memfind+0xb4>
+  801ecc:	48 b8 7d 11 80 00 00 	movabs $0x80117d,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	83 e0 02             	and    $0x2,%eax
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	74 60                	je     801f3f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801edf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ee2:	0f b6 c8             	movzbl %al,%ecx
+  801ee5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ee9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eed:	89 ce                	mov    %ecx,%esi
+  801eef:	48 89 c7             	mov    %rax,%rdi
+  801ef2:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  801efe:	eb 6c                	jmp    801f6c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801f00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f04:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f08:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801f0c:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801f11:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f15:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f19:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801f1c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801f20:	74 13                	je     801f35 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801f22:	31 c0                	xor    %eax,%eax
+  801f24:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801f29:	48 63 d0             	movslq %eax,%rdx
+  801f2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f30:	48 01 d0             	add    %rdx,%rax
+  801f33:	eb 37                	jmp    801f6c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801f35:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801f3a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801f3f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f44:	77 ba                	ja     801f00 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f46:	eb 13                	jmp    801f5b <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801f48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f4c:	0f b6 00             	movzbl (%rax),%eax
+  801f4f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f52:	38 d0                	cmp    %dl,%al
+  801f54:	74 11                	je     801f67 <memfind+0xdc>
+  for (; s < ends; s++)
+  801f56:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f63:	72 e3                	jb     801f48 <memfind+0xbd>
+  801f65:	eb 01                	jmp    801f68 <memfind+0xdd>
+      break;
+  801f67:	90                   	nop
+  return (void *)s;
+  801f68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f6c:	c9                   	leave
+  801f6d:	c3                   	ret
+
+0000000000801f6e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f6e:	55                   	push   %rbp
+  801f6f:	48 89 e5             	mov    %rsp,%rbp
+  801f72:	48 83 ec 38          	sub    $0x38,%rsp
+  801f76:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f7a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f7e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801f81:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801f88:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801f8f:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f90:	eb 05                	jmp    801f97 <strtol+0x29>
+    s++;
+  801f92:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f9b:	0f b6 00             	movzbl (%rax),%eax
+  801f9e:	3c 20                	cmp    $0x20,%al
+  801fa0:	74 f0                	je     801f92 <strtol+0x24>
+  801fa2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa6:	0f b6 00             	movzbl (%rax),%eax
+  801fa9:	3c 09                	cmp    $0x9,%al
+  801fab:	74 e5                	je     801f92 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801fad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb1:	0f b6 00             	movzbl (%rax),%eax
+  801fb4:	3c 2b                	cmp    $0x2b,%al
+  801fb6:	75 07                	jne    801fbf <strtol+0x51>
+    s++;
+  801fb8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fbd:	eb 17                	jmp    801fd6 <strtol+0x68>
+  else if (*s == '-')
+  801fbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc3:	0f b6 00             	movzbl (%rax),%eax
+  801fc6:	3c 2d                	cmp    $0x2d,%al
+  801fc8:	75 0c                	jne    801fd6 <strtol+0x68>
+    s++, neg = 1;
+  801fca:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fcf:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801fd6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fda:	74 06                	je     801fe2 <strtol+0x74>
+  801fdc:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801fe0:	75 28                	jne    80200a <strtol+0x9c>
+  801fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe6:	0f b6 00             	movzbl (%rax),%eax
+  801fe9:	3c 30                	cmp    $0x30,%al
+  801feb:	75 1d                	jne    80200a <strtol+0x9c>
+  801fed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff1:	48 83 c0 01          	add    $0x1,%rax
+  801ff5:	0f b6 00             	movzbl (%rax),%eax
+  801ff8:	3c 78                	cmp    $0x78,%al
+  801ffa:	75 0e                	jne    80200a <strtol+0x9c>
+    s += 2, base = 16;
+  801ffc:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802001:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802008:	eb 2c                	jmp    802036 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  80200a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80200e:	75 19                	jne    802029 <strtol+0xbb>
+  802010:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802014:	0f b6 00             	movzbl (%rax),%eax
+  802017:	3c 30                	cmp    $0x30,%al
+  802019:	75 0e                	jne    802029 <strtol+0xbb>
+    s++, base = 8;
+  80201b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802020:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802027:	eb 0d                	jmp    802036 <strtol+0xc8>
+  else if (base == 0)
+  802029:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80202d:	75 07                	jne    802036 <strtol+0xc8>
+    base = 10;
+  80202f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802036:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80203a:	0f b6 00             	movzbl (%rax),%eax
+  80203d:	3c 2f                	cmp    $0x2f,%al
+  80203f:	7e 1d                	jle    80205e <strtol+0xf0>
+  802041:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802045:	0f b6 00             	movzbl (%rax),%eax
+  802048:	3c 39                	cmp    $0x39,%al
+  80204a:	7f 12                	jg     80205e <strtol+0xf0>
+      dig = *s - '0';
+  80204c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802050:	0f b6 00             	movzbl (%rax),%eax
+  802053:	0f be c0             	movsbl %al,%eax
+  802056:	83 e8 30             	sub    $0x30,%eax
+  802059:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80205c:	eb 4e                	jmp    8020ac <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80205e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802062:	0f b6 00             	movzbl (%rax),%eax
+  802065:	3c 60                	cmp    $0x60,%al
+  802067:	7e 1d                	jle    802086 <strtol+0x118>
+  802069:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206d:	0f b6 00             	movzbl (%rax),%eax
+  802070:	3c 7a                	cmp    $0x7a,%al
+  802072:	7f 12                	jg     802086 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802074:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802078:	0f b6 00             	movzbl (%rax),%eax
+  80207b:	0f be c0             	movsbl %al,%eax
+  80207e:	83 e8 57             	sub    $0x57,%eax
+  802081:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802084:	eb 26                	jmp    8020ac <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802086:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208a:	0f b6 00             	movzbl (%rax),%eax
+  80208d:	3c 40                	cmp    $0x40,%al
+  80208f:	7e 47                	jle    8020d8 <strtol+0x16a>
+  802091:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802095:	0f b6 00             	movzbl (%rax),%eax
+  802098:	3c 5a                	cmp    $0x5a,%al
+  80209a:	7f 3c                	jg     8020d8 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  80209c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a0:	0f b6 00             	movzbl (%rax),%eax
+  8020a3:	0f be c0             	movsbl %al,%eax
+  8020a6:	83 e8 37             	sub    $0x37,%eax
+  8020a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8020ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020af:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8020b2:	7d 23                	jge    8020d7 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8020b4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020b9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8020bc:	48 98                	cltq
+  8020be:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8020c3:	48 89 c2             	mov    %rax,%rdx
+  8020c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020c9:	48 98                	cltq
+  8020cb:	48 01 d0             	add    %rdx,%rax
+  8020ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8020d2:	e9 5f ff ff ff       	jmp    802036 <strtol+0xc8>
+      break;
+  8020d7:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8020d8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8020dd:	74 0b                	je     8020ea <strtol+0x17c>
+    *endptr = (char *)s;
+  8020df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020e3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8020e7:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8020ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020ee:	74 09                	je     8020f9 <strtol+0x18b>
+  8020f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020f4:	48 f7 d8             	neg    %rax
+  8020f7:	eb 04                	jmp    8020fd <strtol+0x18f>
+  8020f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8020fd:	c9                   	leave
+  8020fe:	c3                   	ret
+
+00000000008020ff <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8020ff:	55                   	push   %rbp
+  802100:	48 89 e5             	mov    %rsp,%rbp
+  802103:	53                   	push   %rbx
+  802104:	48 83 ec 48          	sub    $0x48,%rsp
+  802108:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80210c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802110:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802114:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802118:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80211c:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802120:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802124:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802128:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80212c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802130:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802134:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802138:	4c 89 c3             	mov    %r8,%rbx
+  80213b:	cd 30                	int    $0x30
+  80213d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802141:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802146:	74 46                	je     80218e <syscall+0x8f>
+  802148:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80214d:	7e 3f                	jle    80218e <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80214f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802157:	49 89 d0             	mov    %rdx,%r8
+  80215a:	48 89 c1             	mov    %rax,%rcx
+  80215d:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  802164:	00 00 00 
+  802167:	48 89 c2             	mov    %rax,%rdx
+  80216a:	be 22 00 00 00       	mov    $0x22,%esi
+  80216f:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  802176:	00 00 00 
+  802179:	48 89 c7             	mov    %rax,%rdi
+  80217c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802181:	49 b9 12 04 80 00 00 	movabs $0x800412,%r9
+  802188:	00 00 00 
+  80218b:	41 ff d1             	call   *%r9
+
+  return ret;
+  80218e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802192:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802196:	c9                   	leave
+  802197:	c3                   	ret
+
+0000000000802198 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802198:	55                   	push   %rbp
+  802199:	48 89 e5             	mov    %rsp,%rbp
+  80219c:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8021a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b4:	6a 00                	push   $0x0
+  8021b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c2:	48 89 d1             	mov    %rdx,%rcx
+  8021c5:	48 89 c2             	mov    %rax,%rdx
+  8021c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d2:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8021d9:	00 00 00 
+  8021dc:	ff d0                	call   *%rax
+  8021de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e2:	90                   	nop
+  8021e3:	c9                   	leave
+  8021e4:	c3                   	ret
+
+00000000008021e5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8021e5:	55                   	push   %rbp
+  8021e6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ed:	6a 00                	push   $0x0
+  8021ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802200:	ba 00 00 00 00       	mov    $0x0,%edx
+  802205:	be 00 00 00 00       	mov    $0x0,%esi
+  80220a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80220f:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802216:	00 00 00 
+  802219:	ff d0                	call   *%rax
+  80221b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+
+0000000000802221 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802221:	55                   	push   %rbp
+  802222:	48 89 e5             	mov    %rsp,%rbp
+  802225:	48 83 ec 10          	sub    $0x10,%rsp
+  802229:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80222c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80222f:	48 98                	cltq
+  802231:	48 83 ec 08          	sub    $0x8,%rsp
+  802235:	6a 00                	push   $0x0
+  802237:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80223d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802243:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802248:	48 89 c2             	mov    %rax,%rdx
+  80224b:	be 01 00 00 00       	mov    $0x1,%esi
+  802250:	bf 03 00 00 00       	mov    $0x3,%edi
+  802255:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+  802261:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+
+0000000000802267 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802267:	55                   	push   %rbp
+  802268:	48 89 e5             	mov    %rsp,%rbp
+  80226b:	48 83 ec 10          	sub    $0x10,%rsp
+  80226f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802272:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802275:	48 98                	cltq
+  802277:	48 83 ec 08          	sub    $0x8,%rsp
+  80227b:	6a 00                	push   $0x0
+  80227d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802283:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802289:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228e:	48 89 c2             	mov    %rax,%rdx
+  802291:	be 00 00 00 00       	mov    $0x0,%esi
+  802296:	bf 04 00 00 00       	mov    $0x4,%edi
+  80229b:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8022a2:	00 00 00 
+  8022a5:	ff d0                	call   *%rax
+  8022a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ab:	90                   	nop
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+00000000008022ae <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8022ae:	55                   	push   %rbp
+  8022af:	48 89 e5             	mov    %rsp,%rbp
+  8022b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8022b6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8022b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8022bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022c0:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8022c3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022c8:	cd 30                	int    $0x30
+  8022ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8022ce:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8022d2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022d7:	7e 3d                	jle    802316 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8022d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022dd:	49 89 c0             	mov    %rax,%r8
+  8022e0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8022e5:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  8022ec:	00 00 00 
+  8022ef:	48 89 c2             	mov    %rax,%rdx
+  8022f2:	be 49 00 00 00       	mov    $0x49,%esi
+  8022f7:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  8022fe:	00 00 00 
+  802301:	48 89 c7             	mov    %rax,%rdi
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+  802309:	49 b9 12 04 80 00 00 	movabs $0x800412,%r9
+  802310:	00 00 00 
+  802313:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802316:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80231b:	75 13                	jne    802330 <sys_env_wait+0x82>
+  80231d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802322:	74 0c                	je     802330 <sys_env_wait+0x82>
+    *status = st;
+  802324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802328:	89 c2                	mov    %eax,%edx
+  80232a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80232e:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+0000000000802336 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802336:	55                   	push   %rbp
+  802337:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80233a:	48 83 ec 08          	sub    $0x8,%rsp
+  80233e:	6a 00                	push   $0x0
+  802340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80234c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802351:	ba 00 00 00 00       	mov    $0x0,%edx
+  802356:	be 00 00 00 00       	mov    $0x0,%esi
+  80235b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802360:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802367:	00 00 00 
+  80236a:	ff d0                	call   *%rax
+  80236c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802370:	c9                   	leave
+  802371:	c3                   	ret
+
+0000000000802372 <sys_yield>:
+
+void
+sys_yield(void) {
+  802372:	55                   	push   %rbp
+  802373:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802376:	48 83 ec 08          	sub    $0x8,%rsp
+  80237a:	6a 00                	push   $0x0
+  80237c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802382:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802388:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80238d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802392:	be 00 00 00 00       	mov    $0x0,%esi
+  802397:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80239c:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8023a3:	00 00 00 
+  8023a6:	ff d0                	call   *%rax
+  8023a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ac:	90                   	nop
+  8023ad:	c9                   	leave
+  8023ae:	c3                   	ret
+
+00000000008023af <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8023af:	55                   	push   %rbp
+  8023b0:	48 89 e5             	mov    %rsp,%rbp
+  8023b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8023b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8023ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8023be:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8023c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023c4:	48 63 c8             	movslq %eax,%rcx
+  8023c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8023cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ce:	48 98                	cltq
+  8023d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d4:	6a 00                	push   $0x0
+  8023d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023dc:	49 89 c8             	mov    %rcx,%r8
+  8023df:	48 89 d1             	mov    %rdx,%rcx
+  8023e2:	48 89 c2             	mov    %rax,%rdx
+  8023e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ea:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023ef:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8023f6:	00 00 00 
+  8023f9:	ff d0                	call   *%rax
+  8023fb:	48 83 c4 10          	add    $0x10,%rsp
+  8023ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802402:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802405:	c9                   	leave
+  802406:	c3                   	ret
+
+0000000000802407 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	48 83 ec 20          	sub    $0x20,%rsp
+  80240f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802412:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802416:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802419:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80241d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802421:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802424:	48 63 c8             	movslq %eax,%rcx
+  802427:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80242b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80242e:	48 63 f0             	movslq %eax,%rsi
+  802431:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802435:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802438:	48 98                	cltq
+  80243a:	48 83 ec 08          	sub    $0x8,%rsp
+  80243e:	51                   	push   %rcx
+  80243f:	49 89 f9             	mov    %rdi,%r9
+  802442:	49 89 f0             	mov    %rsi,%r8
+  802445:	48 89 d1             	mov    %rdx,%rcx
+  802448:	48 89 c2             	mov    %rax,%rdx
+  80244b:	be 01 00 00 00       	mov    $0x1,%esi
+  802450:	bf 07 00 00 00       	mov    $0x7,%edi
+  802455:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+0000000000802467 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	48 83 ec 10          	sub    $0x10,%rsp
+  80246f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802472:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802476:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80247a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80247d:	48 98                	cltq
+  80247f:	48 83 ec 08          	sub    $0x8,%rsp
+  802483:	6a 00                	push   $0x0
+  802485:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80248b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802491:	48 89 d1             	mov    %rdx,%rcx
+  802494:	48 89 c2             	mov    %rax,%rdx
+  802497:	be 01 00 00 00       	mov    $0x1,%esi
+  80249c:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024a1:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8024a8:	00 00 00 
+  8024ab:	ff d0                	call   *%rax
+  8024ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024b1:	c9                   	leave
+  8024b2:	c3                   	ret
+
+00000000008024b3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8024b3:	55                   	push   %rbp
+  8024b4:	48 89 e5             	mov    %rsp,%rbp
+  8024b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8024bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024be:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8024c1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024c4:	48 63 d0             	movslq %eax,%rdx
+  8024c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ca:	48 98                	cltq
+  8024cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d0:	6a 00                	push   $0x0
+  8024d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024de:	48 89 d1             	mov    %rdx,%rcx
+  8024e1:	48 89 c2             	mov    %rax,%rdx
+  8024e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8024e9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024ee:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+  8024fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fe:	c9                   	leave
+  8024ff:	c3                   	ret
+
+0000000000802500 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	48 83 ec 10          	sub    $0x10,%rsp
+  802508:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80250b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80250f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802513:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802516:	48 98                	cltq
+  802518:	48 83 ec 08          	sub    $0x8,%rsp
+  80251c:	6a 00                	push   $0x0
+  80251e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802524:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80252a:	48 89 d1             	mov    %rdx,%rcx
+  80252d:	48 89 c2             	mov    %rax,%rdx
+  802530:	be 01 00 00 00       	mov    $0x1,%esi
+  802535:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80253a:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802541:	00 00 00 
+  802544:	ff d0                	call   *%rax
+  802546:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80254a:	c9                   	leave
+  80254b:	c3                   	ret
+
+000000000080254c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80254c:	55                   	push   %rbp
+  80254d:	48 89 e5             	mov    %rsp,%rbp
+  802550:	48 83 ec 10          	sub    $0x10,%rsp
+  802554:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802557:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80255b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80255f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802562:	48 98                	cltq
+  802564:	48 83 ec 08          	sub    $0x8,%rsp
+  802568:	6a 00                	push   $0x0
+  80256a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802570:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802576:	48 89 d1             	mov    %rdx,%rcx
+  802579:	48 89 c2             	mov    %rax,%rdx
+  80257c:	be 01 00 00 00       	mov    $0x1,%esi
+  802581:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802586:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+
+0000000000802598 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802598:	55                   	push   %rbp
+  802599:	48 89 e5             	mov    %rsp,%rbp
+  80259c:	48 83 ec 20          	sub    $0x20,%rsp
+  8025a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025a7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025ab:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8025ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8025b1:	48 63 f0             	movslq %eax,%rsi
+  8025b4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025bf:	48 98                	cltq
+  8025c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c5:	6a 00                	push   $0x0
+  8025c7:	49 89 f1             	mov    %rsi,%r9
+  8025ca:	49 89 c8             	mov    %rcx,%r8
+  8025cd:	48 89 d1             	mov    %rdx,%rcx
+  8025d0:	48 89 c2             	mov    %rax,%rdx
+  8025d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025dd:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8025e4:	00 00 00 
+  8025e7:	ff d0                	call   *%rax
+  8025e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ed:	c9                   	leave
+  8025ee:	c3                   	ret
+
+00000000008025ef <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8025ef:	55                   	push   %rbp
+  8025f0:	48 89 e5             	mov    %rsp,%rbp
+  8025f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8025fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802603:	6a 00                	push   $0x0
+  802605:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802616:	48 89 c2             	mov    %rax,%rdx
+  802619:	be 01 00 00 00       	mov    $0x1,%esi
+  80261e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802623:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80262a:	00 00 00 
+  80262d:	ff d0                	call   *%rax
+  80262f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+
+0000000000802635 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	48 83 ec 10          	sub    $0x10,%rsp
+  80263d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802641:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802645:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802649:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80264d:	48 83 ec 08          	sub    $0x8,%rsp
+  802651:	6a 00                	push   $0x0
+  802653:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265f:	48 89 d1             	mov    %rdx,%rcx
+  802662:	48 89 c2             	mov    %rax,%rdx
+  802665:	be 01 00 00 00       	mov    $0x1,%esi
+  80266a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80266f:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+  80267b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267f:	c9                   	leave
+  802680:	c3                   	ret
+
+0000000000802681 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802685:	48 83 ec 08          	sub    $0x8,%rsp
+  802689:	6a 00                	push   $0x0
+  80268b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802691:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a6:	bf 11 00 00 00       	mov    $0x11,%edi
+  8026ab:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+  8026b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026bb:	c9                   	leave
+  8026bc:	c3                   	ret
+
+00000000008026bd <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8026bd:	55                   	push   %rbp
+  8026be:	48 89 e5             	mov    %rsp,%rbp
+  8026c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8026cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026d9:	6a 00                	push   $0x0
+  8026db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026e7:	48 89 d1             	mov    %rdx,%rcx
+  8026ea:	48 89 c2             	mov    %rax,%rdx
+  8026ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f2:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026f7:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8026fe:	00 00 00 
+  802701:	ff d0                	call   *%rax
+  802703:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802707:	c9                   	leave
+  802708:	c3                   	ret
+
+0000000000802709 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802709:	55                   	push   %rbp
+  80270a:	48 89 e5             	mov    %rsp,%rbp
+  80270d:	48 83 ec 20          	sub    $0x20,%rsp
+  802711:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802715:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802719:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80271c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80271f:	48 63 c8             	movslq %eax,%rcx
+  802722:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802726:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80272a:	48 83 ec 08          	sub    $0x8,%rsp
+  80272e:	6a 00                	push   $0x0
+  802730:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802736:	49 89 c8             	mov    %rcx,%r8
+  802739:	48 89 d1             	mov    %rdx,%rcx
+  80273c:	48 89 c2             	mov    %rax,%rdx
+  80273f:	be 00 00 00 00       	mov    $0x0,%esi
+  802744:	bf 13 00 00 00       	mov    $0x13,%edi
+  802749:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+  802755:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802759:	c9                   	leave
+  80275a:	c3                   	ret
+
+000000000080275b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+  80275f:	48 83 ec 20          	sub    $0x20,%rsp
+  802763:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802767:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80276a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80276e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802772:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802779:	48 83 ec 08          	sub    $0x8,%rsp
+  80277d:	6a 00                	push   $0x0
+  80277f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802785:	49 89 c8             	mov    %rcx,%r8
+  802788:	48 89 d1             	mov    %rdx,%rcx
+  80278b:	48 89 c2             	mov    %rax,%rdx
+  80278e:	be 00 00 00 00       	mov    $0x0,%esi
+  802793:	bf 14 00 00 00       	mov    $0x14,%edi
+  802798:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027a8:	c9                   	leave
+  8027a9:	c3                   	ret
+
+00000000008027aa <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8027aa:	55                   	push   %rbp
+  8027ab:	48 89 e5             	mov    %rsp,%rbp
+  8027ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027b6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8027b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027bc:	48 63 d0             	movslq %eax,%rdx
+  8027bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c7:	6a 00                	push   $0x0
+  8027c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d5:	48 89 d1             	mov    %rdx,%rcx
+  8027d8:	48 89 c2             	mov    %rax,%rdx
+  8027db:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e0:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027e5:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+  8027f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+00000000008027f7 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8027f7:	55                   	push   %rbp
+  8027f8:	48 89 e5             	mov    %rsp,%rbp
+  8027fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8027ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802803:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802806:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802809:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80280d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802811:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802814:	48 63 c8             	movslq %eax,%rcx
+  802817:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80281a:	48 63 d0             	movslq %eax,%rdx
+  80281d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802821:	48 83 ec 08          	sub    $0x8,%rsp
+  802825:	6a 00                	push   $0x0
+  802827:	49 89 f1             	mov    %rsi,%r9
+  80282a:	49 89 c8             	mov    %rcx,%r8
+  80282d:	48 89 d1             	mov    %rdx,%rcx
+  802830:	48 89 c2             	mov    %rax,%rdx
+  802833:	be 00 00 00 00       	mov    $0x0,%esi
+  802838:	bf 16 00 00 00       	mov    $0x16,%edi
+  80283d:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+  802849:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284d:	c9                   	leave
+  80284e:	c3                   	ret
+
+000000000080284f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+  802853:	48 83 ec 30          	sub    $0x30,%rsp
+  802857:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80285b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80285f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802863:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802867:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80286b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80286f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802873:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802877:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80287b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80287f:	48 83 ec 08          	sub    $0x8,%rsp
+  802883:	51                   	push   %rcx
+  802884:	49 89 f9             	mov    %rdi,%r9
+  802887:	49 89 f0             	mov    %rsi,%r8
+  80288a:	48 89 d1             	mov    %rdx,%rcx
+  80288d:	48 89 c2             	mov    %rax,%rdx
+  802890:	be 00 00 00 00       	mov    $0x0,%esi
+  802895:	bf 17 00 00 00       	mov    $0x17,%edi
+  80289a:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028aa:	c9                   	leave
+  8028ab:	c3                   	ret
+
+00000000008028ac <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8028ac:	55                   	push   %rbp
+  8028ad:	48 89 e5             	mov    %rsp,%rbp
+  8028b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8028b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028ba:	48 98                	cltq
+  8028bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c0:	6a 00                	push   $0x0
+  8028c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028d3:	48 89 c2             	mov    %rax,%rdx
+  8028d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028db:	bf 18 00 00 00       	mov    $0x18,%edi
+  8028e0:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f0:	90                   	nop
+  8028f1:	c9                   	leave
+  8028f2:	c3                   	ret
+
+00000000008028f3 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8028f3:	55                   	push   %rbp
+  8028f4:	48 89 e5             	mov    %rsp,%rbp
+  8028f7:	48 83 ec 30          	sub    $0x30,%rsp
+  8028fb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802902:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802906:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802909:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80290c:	48 63 f0             	movslq %eax,%rsi
+  80290f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802913:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802917:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80291a:	48 98                	cltq
+  80291c:	48 83 ec 08          	sub    $0x8,%rsp
+  802920:	6a 00                	push   $0x0
+  802922:	49 89 f1             	mov    %rsi,%r9
+  802925:	49 89 c8             	mov    %rcx,%r8
+  802928:	48 89 d1             	mov    %rdx,%rcx
+  80292b:	48 89 c2             	mov    %rax,%rdx
+  80292e:	be 01 00 00 00       	mov    $0x1,%esi
+  802933:	bf 19 00 00 00       	mov    $0x19,%edi
+  802938:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	48 83 c4 10          	add    $0x10,%rsp
+  802948:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80294b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+
+0000000000802950 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802950:	55                   	push   %rbp
+  802951:	48 89 e5             	mov    %rsp,%rbp
+  802954:	48 83 ec 20          	sub    $0x20,%rsp
+  802958:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80295c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802960:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802963:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802966:	48 63 c8             	movslq %eax,%rcx
+  802969:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80296d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802971:	48 83 ec 08          	sub    $0x8,%rsp
+  802975:	6a 00                	push   $0x0
+  802977:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80297d:	49 89 c8             	mov    %rcx,%r8
+  802980:	48 89 d1             	mov    %rdx,%rcx
+  802983:	48 89 c2             	mov    %rax,%rdx
+  802986:	be 01 00 00 00       	mov    $0x1,%esi
+  80298b:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802990:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+00000000008029a2 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8029a2:	55                   	push   %rbp
+  8029a3:	48 89 e5             	mov    %rsp,%rbp
+  8029a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8029aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8029b6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c6:	6a 00                	push   $0x0
+  8029c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029ce:	49 89 c8             	mov    %rcx,%r8
+  8029d1:	48 89 d1             	mov    %rdx,%rcx
+  8029d4:	48 89 c2             	mov    %rax,%rdx
+  8029d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8029dc:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8029e1:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+  8029ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029f1:	c9                   	leave
+  8029f2:	c3                   	ret
+
+00000000008029f3 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8029f3:	55                   	push   %rbp
+  8029f4:	48 89 e5             	mov    %rsp,%rbp
+  8029f7:	48 83 ec 30          	sub    $0x30,%rsp
+  8029fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a03:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802a06:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802a0a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a11:	48 63 c8             	movslq %eax,%rcx
+  802a14:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a20:	6a 00                	push   $0x0
+  802a22:	49 89 f1             	mov    %rsi,%r9
+  802a25:	49 89 c8             	mov    %rcx,%r8
+  802a28:	48 89 d1             	mov    %rdx,%rcx
+  802a2b:	48 89 c2             	mov    %rax,%rdx
+  802a2e:	be 01 00 00 00       	mov    $0x1,%esi
+  802a33:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802a38:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	48 83 c4 10          	add    $0x10,%rsp
+  802a48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a4e:	c9                   	leave
+  802a4f:	c3                   	ret
+
+0000000000802a50 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802a50:	55                   	push   %rbp
+  802a51:	48 89 e5             	mov    %rsp,%rbp
+  802a54:	48 83 ec 10          	sub    $0x10,%rsp
+  802a58:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a5e:	48 98                	cltq
+  802a60:	48 83 ec 08          	sub    $0x8,%rsp
+  802a64:	6a 00                	push   $0x0
+  802a66:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a77:	48 89 c2             	mov    %rax,%rdx
+  802a7a:	be 01 00 00 00       	mov    $0x1,%esi
+  802a7f:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802a84:	48 b8 ff 20 80 00 00 	movabs $0x8020ff,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+  802a90:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+
+0000000000802a96 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	48 83 ec 40          	sub    $0x40,%rsp
+  802a9e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802aa2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802aa6:	48 8b 00             	mov    (%rax),%rax
+  802aa9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802aad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ab5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802abd:	83 e0 02             	and    $0x2,%eax
+  802ac0:	48 85 c0             	test   %rax,%rax
+  802ac3:	74 25                	je     802aea <pgfault+0x54>
+  802ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ac9:	48 c1 e8 0c          	shr    $0xc,%rax
+  802acd:	48 89 c2             	mov    %rax,%rdx
+  802ad0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ad7:	01 00 00 
+  802ada:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ade:	83 e0 02             	and    $0x2,%eax
+  802ae1:	48 85 c0             	test   %rax,%rax
+  802ae4:	0f 85 fe 01 00 00    	jne    802ce8 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802aea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aee:	83 e0 02             	and    $0x2,%eax
+  802af1:	48 85 c0             	test   %rax,%rax
+  802af4:	74 23                	je     802b19 <pgfault+0x83>
+  802af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802afa:	48 c1 e8 0c          	shr    $0xc,%rax
+  802afe:	48 89 c2             	mov    %rax,%rdx
+  802b01:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b08:	01 00 00 
+  802b0b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b0f:	25 00 08 00 00       	and    $0x800,%eax
+  802b14:	48 85 c0             	test   %rax,%rax
+  802b17:	75 3f                	jne    802b58 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802b19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b1d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b21:	49 89 d0             	mov    %rdx,%r8
+  802b24:	48 89 c1             	mov    %rax,%rcx
+  802b27:	48 b8 f8 6c 80 00 00 	movabs $0x806cf8,%rax
+  802b2e:	00 00 00 
+  802b31:	48 89 c2             	mov    %rax,%rdx
+  802b34:	be 26 00 00 00       	mov    $0x26,%esi
+  802b39:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802b40:	00 00 00 
+  802b43:	48 89 c7             	mov    %rax,%rdi
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4b:	49 b9 12 04 80 00 00 	movabs $0x800412,%r9
+  802b52:	00 00 00 
+  802b55:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802b58:	48 b8 4e 57 80 00 00 	movabs $0x80574e,%rax
+  802b5f:	00 00 00 
+  802b62:	ff d0                	call   *%rax
+  802b64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b6c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b71:	48 89 c6             	mov    %rax,%rsi
+  802b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b79:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802b88:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802b8c:	79 36                	jns    802bc4 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802b8e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802b91:	89 c1                	mov    %eax,%ecx
+  802b93:	48 b8 38 6d 80 00 00 	movabs $0x806d38,%rax
+  802b9a:	00 00 00 
+  802b9d:	48 89 c2             	mov    %rax,%rdx
+  802ba0:	be 35 00 00 00       	mov    $0x35,%esi
+  802ba5:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802bac:	00 00 00 
+  802baf:	48 89 c7             	mov    %rax,%rdi
+  802bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb7:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  802bbe:	00 00 00 
+  802bc1:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802bc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bc8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802bcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bd0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802bd6:	48 89 c1             	mov    %rax,%rcx
+  802bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bdd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be2:	48 89 ce             	mov    %rcx,%rsi
+  802be5:	48 89 c7             	mov    %rax,%rdi
+  802be8:	48 b8 24 1b 80 00 00 	movabs $0x801b24,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802bf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bf8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bfc:	48 89 c2             	mov    %rax,%rdx
+  802bff:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c06:	01 00 00 
+  802c09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c0d:	25 00 08 00 00       	and    $0x800,%eax
+  802c12:	48 85 c0             	test   %rax,%rax
+  802c15:	74 7a                	je     802c91 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802c17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c1b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c23:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c29:	48 89 c2             	mov    %rax,%rdx
+  802c2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c30:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c36:	48 89 d1             	mov    %rdx,%rcx
+  802c39:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3e:	48 89 c6             	mov    %rax,%rsi
+  802c41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c46:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  802c52:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c55:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c59:	79 36                	jns    802c91 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802c5b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c5e:	89 c1                	mov    %eax,%ecx
+  802c60:	48 b8 60 6d 80 00 00 	movabs $0x806d60,%rax
+  802c67:	00 00 00 
+  802c6a:	48 89 c2             	mov    %rax,%rdx
+  802c6d:	be 42 00 00 00       	mov    $0x42,%esi
+  802c72:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802c79:	00 00 00 
+  802c7c:	48 89 c7             	mov    %rax,%rdi
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  802c8b:	00 00 00 
+  802c8e:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c95:	48 89 c6             	mov    %rax,%rsi
+  802c98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9d:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  802ca4:	00 00 00 
+  802ca7:	ff d0                	call   *%rax
+  802ca9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802cac:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802cb0:	79 37                	jns    802ce9 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802cb2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802cb5:	89 c1                	mov    %eax,%ecx
+  802cb7:	48 b8 88 6d 80 00 00 	movabs $0x806d88,%rax
+  802cbe:	00 00 00 
+  802cc1:	48 89 c2             	mov    %rax,%rdx
+  802cc4:	be 46 00 00 00       	mov    $0x46,%esi
+  802cc9:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802cd0:	00 00 00 
+  802cd3:	48 89 c7             	mov    %rax,%rdi
+  802cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdb:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  802ce2:	00 00 00 
+  802ce5:	41 ff d0             	call   *%r8
+    return;
+  802ce8:	90                   	nop
+  }
+}
+  802ce9:	c9                   	leave
+  802cea:	c3                   	ret
+
+0000000000802ceb <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802ceb:	55                   	push   %rbp
+  802cec:	48 89 e5             	mov    %rsp,%rbp
+  802cef:	48 83 ec 30          	sub    $0x30,%rsp
+  802cf3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802cf6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802cfa:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d01:	01 00 00 
+  802d04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d08:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d0c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d11:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802d15:	48 b8 36 23 80 00 00 	movabs $0x802336,%rax
+  802d1c:	00 00 00 
+  802d1f:	ff d0                	call   *%rax
+  802d21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802d24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d28:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802d30:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d37:	01 00 00 
+  802d3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d3e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d42:	25 00 04 00 00       	and    $0x400,%eax
+  802d47:	48 85 c0             	test   %rax,%rax
+  802d4a:	74 7b                	je     802dc7 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802d4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d50:	89 c1                	mov    %eax,%ecx
+  802d52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d56:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d5a:	48 89 c2             	mov    %rax,%rdx
+  802d5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d61:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d65:	48 89 c6             	mov    %rax,%rsi
+  802d68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d6b:	41 89 c8             	mov    %ecx,%r8d
+  802d6e:	48 89 d1             	mov    %rdx,%rcx
+  802d71:	89 c2                	mov    %eax,%edx
+  802d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d78:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802d7f:	00 00 00 
+  802d82:	ff d0                	call   *%rax
+  802d84:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d87:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d8b:	0f 89 da 00 00 00    	jns    802e6b <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d94:	89 c1                	mov    %eax,%ecx
+  802d96:	48 b8 b0 6d 80 00 00 	movabs $0x806db0,%rax
+  802d9d:	00 00 00 
+  802da0:	48 89 c2             	mov    %rax,%rdx
+  802da3:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802da8:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802daf:	00 00 00 
+  802db2:	48 89 c7             	mov    %rax,%rdi
+  802db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dba:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  802dc1:	00 00 00 
+  802dc4:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802dc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dcb:	25 02 08 00 00       	and    $0x802,%eax
+  802dd0:	48 85 c0             	test   %rax,%rax
+  802dd3:	74 6e                	je     802e43 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802dd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd9:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802ddf:	80 cc 08             	or     $0x8,%ah
+  802de2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802de6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dea:	89 c7                	mov    %eax,%edi
+  802dec:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802df0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802df3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802df7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dfa:	41 89 f8             	mov    %edi,%r8d
+  802dfd:	89 c7                	mov    %eax,%edi
+  802dff:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802e06:	00 00 00 
+  802e09:	ff d0                	call   *%rax
+  802e0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802e0e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e12:	79 05                	jns    802e19 <duppage+0x12e>
+      return r;
+  802e14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e17:	eb 55                	jmp    802e6e <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802e19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1d:	89 c7                	mov    %eax,%edi
+  802e1f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e23:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e26:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e2d:	41 89 f8             	mov    %edi,%r8d
+  802e30:	89 c7                	mov    %eax,%edi
+  802e32:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802e39:	00 00 00 
+  802e3c:	ff d0                	call   *%rax
+  802e3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e41:	eb 28                	jmp    802e6b <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802e43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e47:	89 c7                	mov    %eax,%edi
+  802e49:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e4d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e50:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e57:	41 89 f8             	mov    %edi,%r8d
+  802e5a:	89 c7                	mov    %eax,%edi
+  802e5c:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802e63:	00 00 00 
+  802e66:	ff d0                	call   *%rax
+  802e68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802e6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+
+0000000000802e70 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+  802e74:	48 83 ec 20          	sub    $0x20,%rsp
+  802e78:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e7b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802e7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e83:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802e8b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e92:	01 00 00 
+  802e95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e99:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e9d:	25 00 08 00 00       	and    $0x800,%eax
+  802ea2:	48 85 c0             	test   %rax,%rax
+  802ea5:	74 0d                	je     802eb4 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802ea7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eab:	0f b6 10             	movzbl (%rax),%edx
+  802eae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb2:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802eb4:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ebb:	01 00 00 
+  802ebe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ec2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ec6:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ecb:	89 c6                	mov    %eax,%esi
+  802ecd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802ed1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ed4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ed8:	41 89 f0             	mov    %esi,%r8d
+  802edb:	48 89 c6             	mov    %rax,%rsi
+  802ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee3:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+}
+  802eef:	c9                   	leave
+  802ef0:	c3                   	ret
+
+0000000000802ef1 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802ef1:	55                   	push   %rbp
+  802ef2:	48 89 e5             	mov    %rsp,%rbp
+  802ef5:	48 83 ec 40          	sub    $0x40,%rsp
+  802ef9:	89 f8                	mov    %edi,%eax
+  802efb:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802efe:	48 b8 96 2a 80 00 00 	movabs $0x802a96,%rax
+  802f05:	00 00 00 
+  802f08:	48 89 c7             	mov    %rax,%rdi
+  802f0b:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802f17:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f1c:	cd 30                	int    $0x30
+  802f1e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802f21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802f24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f2b:	79 36                	jns    802f63 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802f2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f30:	89 c1                	mov    %eax,%ecx
+  802f32:	48 b8 db 6d 80 00 00 	movabs $0x806ddb,%rax
+  802f39:	00 00 00 
+  802f3c:	48 89 c2             	mov    %rax,%rdx
+  802f3f:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802f44:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802f4b:	00 00 00 
+  802f4e:	48 89 c7             	mov    %rax,%rdi
+  802f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f56:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  802f5d:	00 00 00 
+  802f60:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802f63:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f67:	75 0a                	jne    802f73 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6e:	e9 d3 02 00 00       	jmp    803246 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802f73:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f7a:	00 
+  802f7b:	e9 7a 01 00 00       	jmp    8030fa <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802f80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f84:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f88:	48 c1 e8 27          	shr    $0x27,%rax
+  802f8c:	48 89 c2             	mov    %rax,%rdx
+  802f8f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f96:	01 00 00 
+  802f99:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f9d:	83 e0 01             	and    $0x1,%eax
+  802fa0:	48 85 c0             	test   %rax,%rax
+  802fa3:	0f 84 4c 01 00 00    	je     8030f5 <fork_common+0x204>
+  802fa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fad:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fb1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fb5:	48 89 c2             	mov    %rax,%rdx
+  802fb8:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802fbf:	01 00 00 
+  802fc2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fc6:	83 e0 01             	and    $0x1,%eax
+  802fc9:	48 85 c0             	test   %rax,%rax
+  802fcc:	0f 84 23 01 00 00    	je     8030f5 <fork_common+0x204>
+  802fd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fd6:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fda:	48 c1 e8 15          	shr    $0x15,%rax
+  802fde:	48 89 c2             	mov    %rax,%rdx
+  802fe1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802fe8:	01 00 00 
+  802feb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fef:	83 e0 01             	and    $0x1,%eax
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	0f 84 fa 00 00 00    	je     8030f5 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802ffb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fff:	48 c1 e0 0c          	shl    $0xc,%rax
+  803003:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803007:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80300b:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  803012:	00 00 00 
+  803015:	48 39 c2             	cmp    %rax,%rdx
+  803018:	0f 82 d7 00 00 00    	jb     8030f5 <fork_common+0x204>
+  80301e:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  803025:	00 00 00 
+  803028:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  80302c:	0f 84 c3 00 00 00    	je     8030f5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803032:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803036:	48 89 c7             	mov    %rax,%rdi
+  803039:	48 b8 0a 57 80 00 00 	movabs $0x80570a,%rax
+  803040:	00 00 00 
+  803043:	ff d0                	call   *%rax
+  803045:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803048:	84 c0                	test   %al,%al
+  80304a:	0f 84 a5 00 00 00    	je     8030f5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803050:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803054:	48 c1 e8 0c          	shr    $0xc,%rax
+  803058:	48 89 c2             	mov    %rax,%rdx
+  80305b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803062:	01 00 00 
+  803065:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803069:	83 e0 01             	and    $0x1,%eax
+  80306c:	48 85 c0             	test   %rax,%rax
+  80306f:	0f 84 80 00 00 00    	je     8030f5 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  803075:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803079:	74 4a                	je     8030c5 <fork_common+0x1d4>
+  80307b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80307f:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803086:	00 00 00 
+  803089:	48 39 c2             	cmp    %rax,%rdx
+  80308c:	73 13                	jae    8030a1 <fork_common+0x1b0>
+  80308e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803092:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803099:	00 00 00 
+  80309c:	48 39 c2             	cmp    %rax,%rdx
+  80309f:	73 24                	jae    8030c5 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  8030a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030a5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030a9:	48 89 c2             	mov    %rax,%rdx
+  8030ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030af:	48 89 d6             	mov    %rdx,%rsi
+  8030b2:	89 c7                	mov    %eax,%edi
+  8030b4:	48 b8 70 2e 80 00 00 	movabs $0x802e70,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+  8030c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030c3:	eb 22                	jmp    8030e7 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  8030c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030c9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030cd:	48 89 c2             	mov    %rax,%rdx
+  8030d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030d3:	48 89 d6             	mov    %rdx,%rsi
+  8030d6:	89 c7                	mov    %eax,%edi
+  8030d8:	48 b8 eb 2c 80 00 00 	movabs $0x802ceb,%rax
+  8030df:	00 00 00 
+  8030e2:	ff d0                	call   *%rax
+  8030e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8030e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030eb:	79 08                	jns    8030f5 <fork_common+0x204>
+            return r;
+  8030ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030f0:	e9 51 01 00 00       	jmp    803246 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8030f5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8030fa:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803101:	07 
+  803102:	0f 86 78 fe ff ff    	jbe    802f80 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  803108:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80310f:	00 00 00 
+  803112:	8b 40 04             	mov    0x4(%rax),%eax
+  803115:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80311a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803121:	00 00 00 
+  803124:	48 98                	cltq
+  803126:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80312d:	48 01 d0             	add    %rdx,%rax
+  803130:	48 05 00 01 00 00    	add    $0x100,%rax
+  803136:	48 8b 10             	mov    (%rax),%rdx
+  803139:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80313c:	48 89 d6             	mov    %rdx,%rsi
+  80313f:	89 c7                	mov    %eax,%edi
+  803141:	48 b8 4c 25 80 00 00 	movabs $0x80254c,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+  80314d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803150:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803154:	79 36                	jns    80318c <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803159:	89 c1                	mov    %eax,%ecx
+  80315b:	48 b8 f0 6d 80 00 00 	movabs $0x806df0,%rax
+  803162:	00 00 00 
+  803165:	48 89 c2             	mov    %rax,%rdx
+  803168:	be be 00 00 00       	mov    $0xbe,%esi
+  80316d:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  803174:	00 00 00 
+  803177:	48 89 c7             	mov    %rax,%rdi
+  80317a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317f:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  803186:	00 00 00 
+  803189:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  80318c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80318f:	ba 02 00 00 00       	mov    $0x2,%edx
+  803194:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  80319b:	00 00 00 
+  80319e:	48 89 ce             	mov    %rcx,%rsi
+  8031a1:	89 c7                	mov    %eax,%edi
+  8031a3:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  8031aa:	00 00 00 
+  8031ad:	ff d0                	call   *%rax
+  8031af:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031b6:	79 36                	jns    8031ee <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  8031b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031bb:	89 c1                	mov    %eax,%ecx
+  8031bd:	48 b8 20 6e 80 00 00 	movabs $0x806e20,%rax
+  8031c4:	00 00 00 
+  8031c7:	48 89 c2             	mov    %rax,%rdx
+  8031ca:	be c1 00 00 00       	mov    $0xc1,%esi
+  8031cf:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  8031d6:	00 00 00 
+  8031d9:	48 89 c7             	mov    %rax,%rdi
+  8031dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e1:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  8031e8:	00 00 00 
+  8031eb:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8031ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031f1:	be 02 00 00 00       	mov    $0x2,%esi
+  8031f6:	89 c7                	mov    %eax,%edi
+  8031f8:	48 b8 b3 24 80 00 00 	movabs $0x8024b3,%rax
+  8031ff:	00 00 00 
+  803202:	ff d0                	call   *%rax
+  803204:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803207:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80320b:	79 36                	jns    803243 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  80320d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803210:	89 c1                	mov    %eax,%ecx
+  803212:	48 b8 40 6e 80 00 00 	movabs $0x806e40,%rax
+  803219:	00 00 00 
+  80321c:	48 89 c2             	mov    %rax,%rdx
+  80321f:	be d4 00 00 00       	mov    $0xd4,%esi
+  803224:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  80322b:	00 00 00 
+  80322e:	48 89 c7             	mov    %rax,%rdi
+  803231:	b8 00 00 00 00       	mov    $0x0,%eax
+  803236:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  80323d:	00 00 00 
+  803240:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803243:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803246:	c9                   	leave
+  803247:	c3                   	ret
+
+0000000000803248 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803248:	55                   	push   %rbp
+  803249:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80324c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803251:	48 b8 f1 2e 80 00 00 	movabs $0x802ef1,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+}
+  80325d:	5d                   	pop    %rbp
+  80325e:	c3                   	ret
+
+000000000080325f <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803263:	bf 01 00 00 00       	mov    $0x1,%edi
+  803268:	48 b8 f1 2e 80 00 00 	movabs $0x802ef1,%rax
+  80326f:	00 00 00 
+  803272:	ff d0                	call   *%rax
+}
+  803274:	5d                   	pop    %rbp
+  803275:	c3                   	ret
+
+0000000000803276 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803276:	55                   	push   %rbp
+  803277:	48 89 e5             	mov    %rsp,%rbp
+  80327a:	48 83 ec 08          	sub    $0x8,%rsp
+  80327e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803286:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80328d:	ff ff ff 
+  803290:	48 01 d0             	add    %rdx,%rax
+  803293:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803297:	c9                   	leave
+  803298:	c3                   	ret
+
+0000000000803299 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803299:	55                   	push   %rbp
+  80329a:	48 89 e5             	mov    %rsp,%rbp
+  80329d:	48 83 ec 08          	sub    $0x8,%rsp
+  8032a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8032a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032a9:	48 89 c7             	mov    %rax,%rdi
+  8032ac:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+  8032b8:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8032be:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8032c2:	c9                   	leave
+  8032c3:	c3                   	ret
+
+00000000008032c4 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8032c4:	55                   	push   %rbp
+  8032c5:	48 89 e5             	mov    %rsp,%rbp
+  8032c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8032d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032d7:	e9 ae 00 00 00       	jmp    80338a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8032dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032df:	c1 e0 0c             	shl    $0xc,%eax
+  8032e2:	48 98                	cltq
+  8032e4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8032e9:	48 01 d0             	add    %rdx,%rax
+  8032ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8032f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032f4:	48 c1 e8 27          	shr    $0x27,%rax
+  8032f8:	48 89 c2             	mov    %rax,%rdx
+  8032fb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803302:	01 00 00 
+  803305:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803309:	83 e0 01             	and    $0x1,%eax
+  80330c:	48 85 c0             	test   %rax,%rax
+  80330f:	74 63                	je     803374 <fd_alloc+0xb0>
+  803311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803315:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803319:	48 89 c2             	mov    %rax,%rdx
+  80331c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803323:	01 00 00 
+  803326:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80332a:	83 e0 01             	and    $0x1,%eax
+  80332d:	48 85 c0             	test   %rax,%rax
+  803330:	74 42                	je     803374 <fd_alloc+0xb0>
+  803332:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803336:	48 c1 e8 15          	shr    $0x15,%rax
+  80333a:	48 89 c2             	mov    %rax,%rdx
+  80333d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803344:	01 00 00 
+  803347:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80334b:	83 e0 01             	and    $0x1,%eax
+  80334e:	48 85 c0             	test   %rax,%rax
+  803351:	74 21                	je     803374 <fd_alloc+0xb0>
+  803353:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803357:	48 c1 e8 0c          	shr    $0xc,%rax
+  80335b:	48 89 c2             	mov    %rax,%rdx
+  80335e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803365:	01 00 00 
+  803368:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80336c:	83 e0 01             	and    $0x1,%eax
+  80336f:	48 85 c0             	test   %rax,%rax
+  803372:	75 12                	jne    803386 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803374:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803378:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80337c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80337f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803384:	eb 1e                	jmp    8033a4 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803386:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80338a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80338e:	0f 8e 48 ff ff ff    	jle    8032dc <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803394:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803398:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80339f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8033a4:	c9                   	leave
+  8033a5:	c3                   	ret
+
+00000000008033a6 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033a6:	55                   	push   %rbp
+  8033a7:	48 89 e5             	mov    %rsp,%rbp
+  8033aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8033ae:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8033b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033b9:	78 06                	js     8033c1 <fd_lookup+0x1b>
+  8033bb:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8033bf:	7e 0a                	jle    8033cb <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8033c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c6:	e9 af 00 00 00       	jmp    80347a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8033cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ce:	c1 e0 0c             	shl    $0xc,%eax
+  8033d1:	48 98                	cltq
+  8033d3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033d8:	48 01 d0             	add    %rdx,%rax
+  8033db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8033df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e3:	48 c1 e8 27          	shr    $0x27,%rax
+  8033e7:	48 89 c2             	mov    %rax,%rdx
+  8033ea:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033f1:	01 00 00 
+  8033f4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f8:	83 e0 01             	and    $0x1,%eax
+  8033fb:	48 85 c0             	test   %rax,%rax
+  8033fe:	74 63                	je     803463 <fd_lookup+0xbd>
+  803400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803404:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803408:	48 89 c2             	mov    %rax,%rdx
+  80340b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803412:	01 00 00 
+  803415:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803419:	83 e0 01             	and    $0x1,%eax
+  80341c:	48 85 c0             	test   %rax,%rax
+  80341f:	74 42                	je     803463 <fd_lookup+0xbd>
+  803421:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803425:	48 c1 e8 15          	shr    $0x15,%rax
+  803429:	48 89 c2             	mov    %rax,%rdx
+  80342c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803433:	01 00 00 
+  803436:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80343a:	83 e0 01             	and    $0x1,%eax
+  80343d:	48 85 c0             	test   %rax,%rax
+  803440:	74 21                	je     803463 <fd_lookup+0xbd>
+  803442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803446:	48 c1 e8 0c          	shr    $0xc,%rax
+  80344a:	48 89 c2             	mov    %rax,%rdx
+  80344d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803454:	01 00 00 
+  803457:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80345b:	83 e0 01             	and    $0x1,%eax
+  80345e:	48 85 c0             	test   %rax,%rax
+  803461:	75 07                	jne    80346a <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803463:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803468:	eb 10                	jmp    80347a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80346a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80346e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803472:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803475:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80347a:	c9                   	leave
+  80347b:	c3                   	ret
+
+000000000080347c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80347c:	55                   	push   %rbp
+  80347d:	48 89 e5             	mov    %rsp,%rbp
+  803480:	48 83 ec 30          	sub    $0x30,%rsp
+  803484:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803488:	89 f0                	mov    %esi,%eax
+  80348a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80348d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803491:	48 89 c7             	mov    %rax,%rdi
+  803494:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+  8034a0:	89 c2                	mov    %eax,%edx
+  8034a2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8034a6:	48 89 c6             	mov    %rax,%rsi
+  8034a9:	89 d7                	mov    %edx,%edi
+  8034ab:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+  8034b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034be:	78 0a                	js     8034ca <fd_close+0x4e>
+  8034c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8034c4:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8034c8:	74 12                	je     8034dc <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8034ca:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8034ce:	74 05                	je     8034d5 <fd_close+0x59>
+  8034d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d3:	eb 70                	jmp    803545 <fd_close+0xc9>
+  8034d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034da:	eb 69                	jmp    803545 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034e0:	8b 00                	mov    (%rax),%eax
+  8034e2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8034e6:	48 89 d6             	mov    %rdx,%rsi
+  8034e9:	89 c7                	mov    %eax,%edi
+  8034eb:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  8034f2:	00 00 00 
+  8034f5:	ff d0                	call   *%rax
+  8034f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034fa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034fe:	78 2a                	js     80352a <fd_close+0xae>
+    if (dev->dev_close)
+  803500:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803504:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803508:	48 85 c0             	test   %rax,%rax
+  80350b:	74 16                	je     803523 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80350d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803511:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803515:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803519:	48 89 c7             	mov    %rax,%rdi
+  80351c:	ff d2                	call   *%rdx
+  80351e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803521:	eb 07                	jmp    80352a <fd_close+0xae>
+    else
+      r = 0;
+  803523:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80352a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80352e:	48 89 c6             	mov    %rax,%rsi
+  803531:	bf 00 00 00 00       	mov    $0x0,%edi
+  803536:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  80353d:	00 00 00 
+  803540:	ff d0                	call   *%rax
+  return r;
+  803542:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803545:	c9                   	leave
+  803546:	c3                   	ret
+
+0000000000803547 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803547:	55                   	push   %rbp
+  803548:	48 89 e5             	mov    %rsp,%rbp
+  80354b:	48 83 ec 20          	sub    $0x20,%rsp
+  80354f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803552:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803556:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80355d:	eb 3f                	jmp    80359e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80355f:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803566:	00 00 00 
+  803569:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80356c:	48 98                	cltq
+  80356e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803572:	8b 00                	mov    (%rax),%eax
+  803574:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803577:	75 21                	jne    80359a <dev_lookup+0x53>
+      *dev = devtab[i];
+  803579:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803580:	00 00 00 
+  803583:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803586:	48 98                	cltq
+  803588:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80358c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803590:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803593:	b8 00 00 00 00       	mov    $0x0,%eax
+  803598:	eb 7f                	jmp    803619 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80359a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80359e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035a5:	00 00 00 
+  8035a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035ab:	48 98                	cltq
+  8035ad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035b1:	48 85 c0             	test   %rax,%rax
+  8035b4:	75 a9                	jne    80355f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8035b6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8035bd:	00 00 00 
+  8035c0:	8b 40 04             	mov    0x4(%rax),%eax
+  8035c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035c8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035cf:	00 00 00 
+  8035d2:	48 98                	cltq
+  8035d4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035db:	48 01 d0             	add    %rdx,%rax
+  8035de:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035e4:	8b 00                	mov    (%rax),%eax
+  8035e6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8035e9:	89 c6                	mov    %eax,%esi
+  8035eb:	48 b8 68 6e 80 00 00 	movabs $0x806e68,%rax
+  8035f2:	00 00 00 
+  8035f5:	48 89 c7             	mov    %rax,%rdi
+  8035f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035fd:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  803604:	00 00 00 
+  803607:	ff d1                	call   *%rcx
+  *dev = 0;
+  803609:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80360d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803614:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803619:	c9                   	leave
+  80361a:	c3                   	ret
+
+000000000080361b <close>:
+
+int
+close(int fdnum) {
+  80361b:	55                   	push   %rbp
+  80361c:	48 89 e5             	mov    %rsp,%rbp
+  80361f:	48 83 ec 20          	sub    $0x20,%rsp
+  803623:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803626:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80362a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80362d:	48 89 d6             	mov    %rdx,%rsi
+  803630:	89 c7                	mov    %eax,%edi
+  803632:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803639:	00 00 00 
+  80363c:	ff d0                	call   *%rax
+  80363e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803641:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803645:	79 05                	jns    80364c <close+0x31>
+    return r;
+  803647:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80364a:	eb 18                	jmp    803664 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80364c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803650:	be 01 00 00 00       	mov    $0x1,%esi
+  803655:	48 89 c7             	mov    %rax,%rdi
+  803658:	48 b8 7c 34 80 00 00 	movabs $0x80347c,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+}
+  803664:	c9                   	leave
+  803665:	c3                   	ret
+
+0000000000803666 <close_all>:
+
+void
+close_all(void) {
+  803666:	55                   	push   %rbp
+  803667:	48 89 e5             	mov    %rsp,%rbp
+  80366a:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80366e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803675:	eb 15                	jmp    80368c <close_all+0x26>
+    close(i);
+  803677:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80367a:	89 c7                	mov    %eax,%edi
+  80367c:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803688:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80368c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803690:	7e e5                	jle    803677 <close_all+0x11>
+}
+  803692:	90                   	nop
+  803693:	90                   	nop
+  803694:	c9                   	leave
+  803695:	c3                   	ret
+
+0000000000803696 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803696:	55                   	push   %rbp
+  803697:	48 89 e5             	mov    %rsp,%rbp
+  80369a:	48 83 ec 40          	sub    $0x40,%rsp
+  80369e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036a1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036a4:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8036a8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8036ab:	48 89 d6             	mov    %rdx,%rsi
+  8036ae:	89 c7                	mov    %eax,%edi
+  8036b0:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+  8036bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036c3:	79 08                	jns    8036cd <dup+0x37>
+    return r;
+  8036c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c8:	e9 33 02 00 00       	jmp    803900 <dup+0x26a>
+  close(newfdnum);
+  8036cd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036d0:	89 c7                	mov    %eax,%edi
+  8036d2:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  8036d9:	00 00 00 
+  8036dc:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8036de:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036e1:	c1 e0 0c             	shl    $0xc,%eax
+  8036e4:	48 98                	cltq
+  8036e6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8036eb:	48 01 d0             	add    %rdx,%rax
+  8036ee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8036f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036f6:	48 89 c7             	mov    %rax,%rdi
+  8036f9:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  803700:	00 00 00 
+  803703:	ff d0                	call   *%rax
+  803705:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803709:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80370d:	48 89 c7             	mov    %rax,%rdi
+  803710:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+  80371c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803720:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803727:	00 
+  803728:	e9 19 01 00 00       	jmp    803846 <dup+0x1b0>
+    off -= PGSIZE;
+  80372d:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803734:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803735:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803739:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80373d:	48 01 d0             	add    %rdx,%rax
+  803740:	48 c1 e8 27          	shr    $0x27,%rax
+  803744:	48 89 c2             	mov    %rax,%rdx
+  803747:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80374e:	01 00 00 
+  803751:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803755:	83 e0 01             	and    $0x1,%eax
+  803758:	48 85 c0             	test   %rax,%rax
+  80375b:	0f 84 e5 00 00 00    	je     803846 <dup+0x1b0>
+  803761:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803769:	48 01 d0             	add    %rdx,%rax
+  80376c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803770:	48 89 c2             	mov    %rax,%rdx
+  803773:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80377a:	01 00 00 
+  80377d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803781:	83 e0 01             	and    $0x1,%eax
+  803784:	48 85 c0             	test   %rax,%rax
+  803787:	0f 84 b9 00 00 00    	je     803846 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80378d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803791:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803795:	48 01 d0             	add    %rdx,%rax
+  803798:	48 c1 e8 15          	shr    $0x15,%rax
+  80379c:	48 89 c2             	mov    %rax,%rdx
+  80379f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8037a6:	01 00 00 
+  8037a9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037ad:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8037b0:	48 85 c0             	test   %rax,%rax
+  8037b3:	0f 84 8d 00 00 00    	je     803846 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8037b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c1:	48 01 d0             	add    %rdx,%rax
+  8037c4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037c8:	48 89 c2             	mov    %rax,%rdx
+  8037cb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037d2:	01 00 00 
+  8037d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037d9:	83 e0 01             	and    $0x1,%eax
+  8037dc:	48 85 c0             	test   %rax,%rax
+  8037df:	74 65                	je     803846 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8037e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037e9:	48 01 d0             	add    %rdx,%rax
+  8037ec:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037f0:	48 89 c2             	mov    %rax,%rdx
+  8037f3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037fa:	01 00 00 
+  8037fd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803801:	25 07 0e 00 00       	and    $0xe07,%eax
+  803806:	89 c6                	mov    %eax,%esi
+  803808:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80380c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803810:	48 01 c2             	add    %rax,%rdx
+  803813:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803817:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80381b:	48 01 c8             	add    %rcx,%rax
+  80381e:	41 89 f0             	mov    %esi,%r8d
+  803821:	48 89 d1             	mov    %rdx,%rcx
+  803824:	ba 00 00 00 00       	mov    $0x0,%edx
+  803829:	48 89 c6             	mov    %rax,%rsi
+  80382c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803831:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  803838:	00 00 00 
+  80383b:	ff d0                	call   *%rax
+  80383d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803840:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803844:	78 60                	js     8038a6 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803846:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80384b:	0f 85 dc fe ff ff    	jne    80372d <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803851:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803855:	48 c1 e8 0c          	shr    $0xc,%rax
+  803859:	48 89 c2             	mov    %rax,%rdx
+  80385c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803863:	01 00 00 
+  803866:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80386a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80386f:	89 c1                	mov    %eax,%ecx
+  803871:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803875:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803879:	41 89 c8             	mov    %ecx,%r8d
+  80387c:	48 89 d1             	mov    %rdx,%rcx
+  80387f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803884:	48 89 c6             	mov    %rax,%rsi
+  803887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80388c:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+  803898:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80389b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80389f:	78 08                	js     8038a9 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8038a1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8038a4:	eb 5a                	jmp    803900 <dup+0x26a>
+        goto err;
+  8038a6:	90                   	nop
+  8038a7:	eb 01                	jmp    8038aa <dup+0x214>
+    goto err;
+  8038a9:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8038aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038ae:	48 89 c6             	mov    %rax,%rsi
+  8038b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b6:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8038bd:	00 00 00 
+  8038c0:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8038c2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8038c9:	00 
+  8038ca:	eb 27                	jmp    8038f3 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8038cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038d4:	48 01 d0             	add    %rdx,%rax
+  8038d7:	48 89 c6             	mov    %rax,%rsi
+  8038da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038df:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8038e6:	00 00 00 
+  8038e9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8038eb:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8038f2:	00 
+  8038f3:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8038fa:	00 
+  8038fb:	76 cf                	jbe    8038cc <dup+0x236>
+  return r;
+  8038fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803900:	c9                   	leave
+  803901:	c3                   	ret
+
+0000000000803902 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803902:	55                   	push   %rbp
+  803903:	48 89 e5             	mov    %rsp,%rbp
+  803906:	48 83 ec 40          	sub    $0x40,%rsp
+  80390a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80390d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803911:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803915:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803919:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80391c:	48 89 d6             	mov    %rdx,%rsi
+  80391f:	89 c7                	mov    %eax,%edi
+  803921:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803928:	00 00 00 
+  80392b:	ff d0                	call   *%rax
+  80392d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803930:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803934:	78 24                	js     80395a <read+0x58>
+  803936:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80393a:	8b 00                	mov    (%rax),%eax
+  80393c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803940:	48 89 d6             	mov    %rdx,%rsi
+  803943:	89 c7                	mov    %eax,%edi
+  803945:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  80394c:	00 00 00 
+  80394f:	ff d0                	call   *%rax
+  803951:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803954:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803958:	79 0a                	jns    803964 <read+0x62>
+    return r;
+  80395a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80395d:	48 98                	cltq
+  80395f:	e9 9e 00 00 00       	jmp    803a02 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803964:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803968:	8b 40 08             	mov    0x8(%rax),%eax
+  80396b:	83 e0 03             	and    $0x3,%eax
+  80396e:	83 f8 01             	cmp    $0x1,%eax
+  803971:	75 5c                	jne    8039cf <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803973:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80397a:	00 00 00 
+  80397d:	8b 40 04             	mov    0x4(%rax),%eax
+  803980:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803985:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80398c:	00 00 00 
+  80398f:	48 98                	cltq
+  803991:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803998:	48 01 d0             	add    %rdx,%rax
+  80399b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8039a1:	8b 00                	mov    (%rax),%eax
+  8039a3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8039a6:	89 c6                	mov    %eax,%esi
+  8039a8:	48 b8 87 6e 80 00 00 	movabs $0x806e87,%rax
+  8039af:	00 00 00 
+  8039b2:	48 89 c7             	mov    %rax,%rdi
+  8039b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ba:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  8039c1:	00 00 00 
+  8039c4:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8039c6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8039cd:	eb 33                	jmp    803a02 <read+0x100>
+  }
+  if (!dev->dev_read)
+  8039cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8039d7:	48 85 c0             	test   %rax,%rax
+  8039da:	75 09                	jne    8039e5 <read+0xe3>
+    return -E_NOT_SUPP;
+  8039dc:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8039e3:	eb 1d                	jmp    803a02 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8039e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039e9:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8039ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039f1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8039f5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8039f9:	48 89 ce             	mov    %rcx,%rsi
+  8039fc:	48 89 c7             	mov    %rax,%rdi
+  8039ff:	41 ff d0             	call   *%r8
+}
+  803a02:	c9                   	leave
+  803a03:	c3                   	ret
+
+0000000000803a04 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a04:	55                   	push   %rbp
+  803a05:	48 89 e5             	mov    %rsp,%rbp
+  803a08:	48 83 ec 30          	sub    $0x30,%rsp
+  803a0c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803a0f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a13:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803a17:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a1e:	eb 49                	jmp    803a69 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a23:	48 98                	cltq
+  803a25:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a29:	48 29 c2             	sub    %rax,%rdx
+  803a2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a2f:	48 63 c8             	movslq %eax,%rcx
+  803a32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a36:	48 01 c1             	add    %rax,%rcx
+  803a39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a3c:	48 89 ce             	mov    %rcx,%rsi
+  803a3f:	89 c7                	mov    %eax,%edi
+  803a41:	48 b8 02 39 80 00 00 	movabs $0x803902,%rax
+  803a48:	00 00 00 
+  803a4b:	ff d0                	call   *%rax
+  803a4d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803a50:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a54:	79 07                	jns    803a5d <readn+0x59>
+      return m;
+  803a56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a59:	48 98                	cltq
+  803a5b:	eb 1f                	jmp    803a7c <readn+0x78>
+    if (m == 0)
+  803a5d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a61:	74 13                	je     803a76 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803a63:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a66:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803a69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a6c:	48 98                	cltq
+  803a6e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803a72:	72 ac                	jb     803a20 <readn+0x1c>
+  803a74:	eb 01                	jmp    803a77 <readn+0x73>
+      break;
+  803a76:	90                   	nop
+  }
+  return tot;
+  803a77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a7a:	48 98                	cltq
+}
+  803a7c:	c9                   	leave
+  803a7d:	c3                   	ret
+
+0000000000803a7e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a7e:	55                   	push   %rbp
+  803a7f:	48 89 e5             	mov    %rsp,%rbp
+  803a82:	48 83 ec 40          	sub    $0x40,%rsp
+  803a86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a89:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803a8d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a91:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a98:	48 89 d6             	mov    %rdx,%rsi
+  803a9b:	89 c7                	mov    %eax,%edi
+  803a9d:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+  803aa9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ab0:	78 24                	js     803ad6 <write+0x58>
+  803ab2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ab6:	8b 00                	mov    (%rax),%eax
+  803ab8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803abc:	48 89 d6             	mov    %rdx,%rsi
+  803abf:	89 c7                	mov    %eax,%edi
+  803ac1:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  803ac8:	00 00 00 
+  803acb:	ff d0                	call   *%rax
+  803acd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ad0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ad4:	79 0a                	jns    803ae0 <write+0x62>
+    return r;
+  803ad6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ad9:	48 98                	cltq
+  803adb:	e9 9d 00 00 00       	jmp    803b7d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ae4:	8b 40 08             	mov    0x8(%rax),%eax
+  803ae7:	83 e0 03             	and    $0x3,%eax
+  803aea:	85 c0                	test   %eax,%eax
+  803aec:	75 5c                	jne    803b4a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803aee:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803af5:	00 00 00 
+  803af8:	8b 40 04             	mov    0x4(%rax),%eax
+  803afb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b00:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b07:	00 00 00 
+  803b0a:	48 98                	cltq
+  803b0c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b13:	48 01 d0             	add    %rdx,%rax
+  803b16:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b1c:	8b 00                	mov    (%rax),%eax
+  803b1e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b21:	89 c6                	mov    %eax,%esi
+  803b23:	48 b8 a3 6e 80 00 00 	movabs $0x806ea3,%rax
+  803b2a:	00 00 00 
+  803b2d:	48 89 c7             	mov    %rax,%rdi
+  803b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b35:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  803b3c:	00 00 00 
+  803b3f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803b41:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b48:	eb 33                	jmp    803b7d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b4e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b52:	48 85 c0             	test   %rax,%rax
+  803b55:	75 09                	jne    803b60 <write+0xe2>
+    return -E_NOT_SUPP;
+  803b57:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803b5e:	eb 1d                	jmp    803b7d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b64:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b6c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b70:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803b74:	48 89 ce             	mov    %rcx,%rsi
+  803b77:	48 89 c7             	mov    %rax,%rdi
+  803b7a:	41 ff d0             	call   *%r8
+}
+  803b7d:	c9                   	leave
+  803b7e:	c3                   	ret
+
+0000000000803b7f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803b7f:	55                   	push   %rbp
+  803b80:	48 89 e5             	mov    %rsp,%rbp
+  803b83:	48 83 ec 18          	sub    $0x18,%rsp
+  803b87:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b8a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b8d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b94:	48 89 d6             	mov    %rdx,%rsi
+  803b97:	89 c7                	mov    %eax,%edi
+  803b99:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803ba0:	00 00 00 
+  803ba3:	ff d0                	call   *%rax
+  803ba5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ba8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bac:	79 05                	jns    803bb3 <seek+0x34>
+    return r;
+  803bae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bb1:	eb 0f                	jmp    803bc2 <seek+0x43>
+  fd->fd_offset = offset;
+  803bb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bb7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803bba:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bc2:	c9                   	leave
+  803bc3:	c3                   	ret
+
+0000000000803bc4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803bc4:	55                   	push   %rbp
+  803bc5:	48 89 e5             	mov    %rsp,%rbp
+  803bc8:	48 83 ec 30          	sub    $0x30,%rsp
+  803bcc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803bcf:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803bd2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803bd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bd9:	48 89 d6             	mov    %rdx,%rsi
+  803bdc:	89 c7                	mov    %eax,%edi
+  803bde:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803be5:	00 00 00 
+  803be8:	ff d0                	call   *%rax
+  803bea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bf1:	78 24                	js     803c17 <ftruncate+0x53>
+  803bf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bf7:	8b 00                	mov    (%rax),%eax
+  803bf9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bfd:	48 89 d6             	mov    %rdx,%rsi
+  803c00:	89 c7                	mov    %eax,%edi
+  803c02:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+  803c0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c15:	79 08                	jns    803c1f <ftruncate+0x5b>
+    return r;
+  803c17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c1a:	e9 92 00 00 00       	jmp    803cb1 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c23:	8b 40 08             	mov    0x8(%rax),%eax
+  803c26:	83 e0 03             	and    $0x3,%eax
+  803c29:	85 c0                	test   %eax,%eax
+  803c2b:	75 5a                	jne    803c87 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803c2d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c34:	00 00 00 
+  803c37:	8b 40 04             	mov    0x4(%rax),%eax
+  803c3a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c3f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c46:	00 00 00 
+  803c49:	48 98                	cltq
+  803c4b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803c52:	48 01 d0             	add    %rdx,%rax
+  803c55:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c5b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c5d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c60:	89 c6                	mov    %eax,%esi
+  803c62:	48 b8 c0 6e 80 00 00 	movabs $0x806ec0,%rax
+  803c69:	00 00 00 
+  803c6c:	48 89 c7             	mov    %rax,%rdi
+  803c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c74:	48 b9 31 06 80 00 00 	movabs $0x800631,%rcx
+  803c7b:	00 00 00 
+  803c7e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c85:	eb 2a                	jmp    803cb1 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c8b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803c8f:	48 85 c0             	test   %rax,%rax
+  803c92:	75 07                	jne    803c9b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803c94:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803c99:	eb 16                	jmp    803cb1 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803c9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c9f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803ca3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ca7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803caa:	89 d6                	mov    %edx,%esi
+  803cac:	48 89 c7             	mov    %rax,%rdi
+  803caf:	ff d1                	call   *%rcx
+}
+  803cb1:	c9                   	leave
+  803cb2:	c3                   	ret
+
+0000000000803cb3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803cb3:	55                   	push   %rbp
+  803cb4:	48 89 e5             	mov    %rsp,%rbp
+  803cb7:	48 83 ec 30          	sub    $0x30,%rsp
+  803cbb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803cbe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803cc2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803cc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cc9:	48 89 d6             	mov    %rdx,%rsi
+  803ccc:	89 c7                	mov    %eax,%edi
+  803cce:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803cd5:	00 00 00 
+  803cd8:	ff d0                	call   *%rax
+  803cda:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cdd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ce1:	78 24                	js     803d07 <fstat+0x54>
+  803ce3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ce7:	8b 00                	mov    (%rax),%eax
+  803ce9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ced:	48 89 d6             	mov    %rdx,%rsi
+  803cf0:	89 c7                	mov    %eax,%edi
+  803cf2:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+  803cfe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d05:	79 05                	jns    803d0c <fstat+0x59>
+    return r;
+  803d07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d0a:	eb 5e                	jmp    803d6a <fstat+0xb7>
+  if (!dev->dev_stat)
+  803d0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d10:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d14:	48 85 c0             	test   %rax,%rax
+  803d17:	75 07                	jne    803d20 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803d19:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d1e:	eb 4a                	jmp    803d6a <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803d20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d24:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803d27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d2b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d32:	00 00 00 
+  stat->st_isdir   = 0;
+  803d35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d39:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d40:	00 00 00 
+  stat->st_dev     = dev;
+  803d43:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d4b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803d52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d56:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803d5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d5e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d62:	48 89 d6             	mov    %rdx,%rsi
+  803d65:	48 89 c7             	mov    %rax,%rdi
+  803d68:	ff d1                	call   *%rcx
+}
+  803d6a:	c9                   	leave
+  803d6b:	c3                   	ret
+
+0000000000803d6c <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	48 83 ec 10          	sub    $0x10,%rsp
+  803d74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d78:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d80:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d86:	83 f8 20             	cmp    $0x20,%eax
+  803d89:	75 07                	jne    803d92 <pollwait_key+0x26>
+    return -E_INVAL;
+  803d8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d90:	eb 5f                	jmp    803df1 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803d92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d96:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803d9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803da0:	48 63 d2             	movslq %edx,%rdx
+  803da3:	48 c1 e2 04          	shl    $0x4,%rdx
+  803da7:	48 01 c2             	add    %rax,%rdx
+  803daa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dae:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803db1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db5:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803dbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dbf:	8b 00                	mov    (%rax),%eax
+  803dc1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803dc5:	48 63 c9             	movslq %ecx,%rcx
+  803dc8:	48 c1 e1 04          	shl    $0x4,%rcx
+  803dcc:	48 01 ca             	add    %rcx,%rdx
+  803dcf:	48 83 c2 08          	add    $0x8,%rdx
+  803dd3:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803dd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dd9:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803ddf:	8d 50 01             	lea    0x1(%rax),%edx
+  803de2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803de6:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803dec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803df1:	c9                   	leave
+  803df2:	c3                   	ret
+
+0000000000803df3 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803df3:	55                   	push   %rbp
+  803df4:	48 89 e5             	mov    %rsp,%rbp
+  803df7:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803dfe:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803e05:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803e0b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803e12:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e19:	00 
+  int i, r, ready, ipc = 0;
+  803e1a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803e21:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803e28:	00 
+  803e29:	74 45                	je     803e70 <poll+0x7d>
+  803e2b:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803e32:	ff 
+  803e33:	74 3b                	je     803e70 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803e35:	48 b8 0f 58 80 00 00 	movabs $0x80580f,%rax
+  803e3c:	00 00 00 
+  803e3f:	ff d0                	call   *%rax
+  803e41:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803e45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e49:	48 f7 d0             	not    %rax
+  803e4c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803e53:	73 10                	jae    803e65 <poll+0x72>
+  803e55:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e59:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803e60:	48 01 d0             	add    %rdx,%rax
+  803e63:	eb 07                	jmp    803e6c <poll+0x79>
+  803e65:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803e6c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803e70:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803e77:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803e7e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803e85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803e8c:	e9 46 02 00 00       	jmp    8040d7 <poll+0x2e4>
+      fds[i].revents = 0;
+  803e91:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e94:	48 63 d0             	movslq %eax,%rdx
+  803e97:	48 89 d0             	mov    %rdx,%rax
+  803e9a:	48 01 c0             	add    %rax,%rax
+  803e9d:	48 01 d0             	add    %rdx,%rax
+  803ea0:	48 c1 e0 02          	shl    $0x2,%rax
+  803ea4:	48 89 c2             	mov    %rax,%rdx
+  803ea7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eae:	48 01 d0             	add    %rdx,%rax
+  803eb1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803eb8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ebb:	48 63 d0             	movslq %eax,%rdx
+  803ebe:	48 89 d0             	mov    %rdx,%rax
+  803ec1:	48 01 c0             	add    %rax,%rax
+  803ec4:	48 01 d0             	add    %rdx,%rax
+  803ec7:	48 c1 e0 02          	shl    $0x2,%rax
+  803ecb:	48 89 c2             	mov    %rax,%rdx
+  803ece:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ed5:	48 01 d0             	add    %rdx,%rax
+  803ed8:	8b 00                	mov    (%rax),%eax
+  803eda:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803edd:	75 62                	jne    803f41 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803edf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ee2:	48 63 d0             	movslq %eax,%rdx
+  803ee5:	48 89 d0             	mov    %rdx,%rax
+  803ee8:	48 01 c0             	add    %rax,%rax
+  803eeb:	48 01 d0             	add    %rdx,%rax
+  803eee:	48 c1 e0 02          	shl    $0x2,%rax
+  803ef2:	48 89 c2             	mov    %rax,%rdx
+  803ef5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803efc:	48 01 d0             	add    %rdx,%rax
+  803eff:	8b 40 04             	mov    0x4(%rax),%eax
+  803f02:	83 e0 01             	and    $0x1,%eax
+  803f05:	85 c0                	test   %eax,%eax
+  803f07:	0f 84 9b 01 00 00    	je     8040a8 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803f0d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f10:	48 63 d0             	movslq %eax,%rdx
+  803f13:	48 89 d0             	mov    %rdx,%rax
+  803f16:	48 01 c0             	add    %rax,%rax
+  803f19:	48 01 d0             	add    %rdx,%rax
+  803f1c:	48 c1 e0 02          	shl    $0x2,%rax
+  803f20:	48 89 c2             	mov    %rax,%rdx
+  803f23:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f2a:	48 01 c2             	add    %rax,%rdx
+  803f2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f30:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803f33:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f36:	83 c8 04             	or     $0x4,%eax
+  803f39:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803f3c:	e9 67 01 00 00       	jmp    8040a8 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f41:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f44:	48 63 d0             	movslq %eax,%rdx
+  803f47:	48 89 d0             	mov    %rdx,%rax
+  803f4a:	48 01 c0             	add    %rax,%rax
+  803f4d:	48 01 d0             	add    %rdx,%rax
+  803f50:	48 c1 e0 02          	shl    $0x2,%rax
+  803f54:	48 89 c2             	mov    %rax,%rdx
+  803f57:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f5e:	48 01 d0             	add    %rdx,%rax
+  803f61:	8b 00                	mov    (%rax),%eax
+  803f63:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803f6a:	48 89 d6             	mov    %rdx,%rsi
+  803f6d:	89 c7                	mov    %eax,%edi
+  803f6f:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  803f76:	00 00 00 
+  803f79:	ff d0                	call   *%rax
+  803f7b:	85 c0                	test   %eax,%eax
+  803f7d:	78 25                	js     803fa4 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803f7f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803f86:	8b 00                	mov    (%rax),%eax
+  803f88:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803f8f:	48 89 d6             	mov    %rdx,%rsi
+  803f92:	89 c7                	mov    %eax,%edi
+  803f94:	48 b8 47 35 80 00 00 	movabs $0x803547,%rax
+  803f9b:	00 00 00 
+  803f9e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803fa0:	85 c0                	test   %eax,%eax
+  803fa2:	79 2c                	jns    803fd0 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803fa4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fa7:	48 63 d0             	movslq %eax,%rdx
+  803faa:	48 89 d0             	mov    %rdx,%rax
+  803fad:	48 01 c0             	add    %rax,%rax
+  803fb0:	48 01 d0             	add    %rdx,%rax
+  803fb3:	48 c1 e0 02          	shl    $0x2,%rax
+  803fb7:	48 89 c2             	mov    %rax,%rdx
+  803fba:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fc1:	48 01 d0             	add    %rdx,%rax
+  803fc4:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803fcb:	e9 d8 00 00 00       	jmp    8040a8 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803fd0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803fd7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803fdb:	48 85 c0             	test   %rax,%rax
+  803fde:	74 7d                	je     80405d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803fe0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803fe7:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803feb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fee:	48 63 d0             	movslq %eax,%rdx
+  803ff1:	48 89 d0             	mov    %rdx,%rax
+  803ff4:	48 01 c0             	add    %rax,%rax
+  803ff7:	48 01 d0             	add    %rdx,%rax
+  803ffa:	48 c1 e0 02          	shl    $0x2,%rax
+  803ffe:	48 89 c2             	mov    %rax,%rdx
+  804001:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804008:	48 01 d0             	add    %rdx,%rax
+  80400b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80400e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804015:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80401c:	89 ce                	mov    %ecx,%esi
+  80401e:	48 89 c7             	mov    %rax,%rdi
+  804021:	41 ff d0             	call   *%r8
+  804024:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804027:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80402b:	79 08                	jns    804035 <poll+0x242>
+          return r;
+  80402d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804030:	e9 45 01 00 00       	jmp    80417a <poll+0x387>
+        fds[i].revents = r;
+  804035:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804038:	48 63 d0             	movslq %eax,%rdx
+  80403b:	48 89 d0             	mov    %rdx,%rax
+  80403e:	48 01 c0             	add    %rax,%rax
+  804041:	48 01 d0             	add    %rdx,%rax
+  804044:	48 c1 e0 02          	shl    $0x2,%rax
+  804048:	48 89 c2             	mov    %rax,%rdx
+  80404b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804052:	48 01 c2             	add    %rax,%rdx
+  804055:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804058:	89 42 08             	mov    %eax,0x8(%rdx)
+  80405b:	eb 4b                	jmp    8040a8 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80405d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804060:	48 63 d0             	movslq %eax,%rdx
+  804063:	48 89 d0             	mov    %rdx,%rax
+  804066:	48 01 c0             	add    %rax,%rax
+  804069:	48 01 d0             	add    %rdx,%rax
+  80406c:	48 c1 e0 02          	shl    $0x2,%rax
+  804070:	48 89 c2             	mov    %rax,%rdx
+  804073:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80407a:	48 01 d0             	add    %rdx,%rax
+  80407d:	8b 48 04             	mov    0x4(%rax),%ecx
+  804080:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804083:	48 63 d0             	movslq %eax,%rdx
+  804086:	48 89 d0             	mov    %rdx,%rax
+  804089:	48 01 c0             	add    %rax,%rax
+  80408c:	48 01 d0             	add    %rdx,%rax
+  80408f:	48 c1 e0 02          	shl    $0x2,%rax
+  804093:	48 89 c2             	mov    %rax,%rdx
+  804096:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80409d:	48 01 d0             	add    %rdx,%rax
+  8040a0:	83 e1 03             	and    $0x3,%ecx
+  8040a3:	89 ca                	mov    %ecx,%edx
+  8040a5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8040a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040ab:	48 63 d0             	movslq %eax,%rdx
+  8040ae:	48 89 d0             	mov    %rdx,%rax
+  8040b1:	48 01 c0             	add    %rax,%rax
+  8040b4:	48 01 d0             	add    %rdx,%rax
+  8040b7:	48 c1 e0 02          	shl    $0x2,%rax
+  8040bb:	48 89 c2             	mov    %rax,%rdx
+  8040be:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040c5:	48 01 d0             	add    %rdx,%rax
+  8040c8:	8b 40 08             	mov    0x8(%rax),%eax
+  8040cb:	85 c0                	test   %eax,%eax
+  8040cd:	74 04                	je     8040d3 <poll+0x2e0>
+        ready++;
+  8040cf:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8040d3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8040d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040da:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8040e0:	0f 8c ab fd ff ff    	jl     803e91 <poll+0x9e>
+    }
+    if (ready)
+  8040e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8040ea:	74 08                	je     8040f4 <poll+0x301>
+      return ready;
+  8040ec:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8040ef:	e9 86 00 00 00       	jmp    80417a <poll+0x387>
+
+    if (deadline) {
+  8040f4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8040f9:	74 30                	je     80412b <poll+0x338>
+      now     = vsys_clock_ns();
+  8040fb:	48 b8 0f 58 80 00 00 	movabs $0x80580f,%rax
+  804102:	00 00 00 
+  804105:	ff d0                	call   *%rax
+  804107:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80410b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80410f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804113:	73 0a                	jae    80411f <poll+0x32c>
+  804115:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804119:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80411d:	eb 05                	jmp    804124 <poll+0x331>
+  80411f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804124:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80412b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80412e:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804131:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804138:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80413f:	48 89 c7             	mov    %rax,%rdi
+  804142:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  804149:	00 00 00 
+  80414c:	ff d0                	call   *%rax
+  80414e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804151:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804155:	75 07                	jne    80415e <poll+0x36b>
+      return 0;
+  804157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415c:	eb 1c                	jmp    80417a <poll+0x387>
+    if (r < 0)
+  80415e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804162:	79 05                	jns    804169 <poll+0x376>
+      return r;
+  804164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804167:	eb 11                	jmp    80417a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804169:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80416c:	c1 f8 02             	sar    $0x2,%eax
+  80416f:	83 e0 01             	and    $0x1,%eax
+  804172:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804175:	e9 f6 fc ff ff       	jmp    803e70 <poll+0x7d>
+  }
+}
+  80417a:	c9                   	leave
+  80417b:	c3                   	ret
+
+000000000080417c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80417c:	55                   	push   %rbp
+  80417d:	48 89 e5             	mov    %rsp,%rbp
+  804180:	48 83 ec 20          	sub    $0x20,%rsp
+  804184:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804188:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80418c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804190:	be 00 00 00 00       	mov    $0x0,%esi
+  804195:	48 89 c7             	mov    %rax,%rdi
+  804198:	48 b8 6a 42 80 00 00 	movabs $0x80426a,%rax
+  80419f:	00 00 00 
+  8041a2:	ff d0                	call   *%rax
+  8041a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041ab:	79 05                	jns    8041b2 <stat+0x36>
+    return fd;
+  8041ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041b0:	eb 2f                	jmp    8041e1 <stat+0x65>
+  r = fstat(fd, stat);
+  8041b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041b9:	48 89 d6             	mov    %rdx,%rsi
+  8041bc:	89 c7                	mov    %eax,%edi
+  8041be:	48 b8 b3 3c 80 00 00 	movabs $0x803cb3,%rax
+  8041c5:	00 00 00 
+  8041c8:	ff d0                	call   *%rax
+  8041ca:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8041cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041d0:	89 c7                	mov    %eax,%edi
+  8041d2:	48 b8 1b 36 80 00 00 	movabs $0x80361b,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  return r;
+  8041de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8041e1:	c9                   	leave
+  8041e2:	c3                   	ret
+
+00000000008041e3 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8041e3:	55                   	push   %rbp
+  8041e4:	48 89 e5             	mov    %rsp,%rbp
+  8041e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8041eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8041ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8041f2:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8041f9:	00 00 00 
+  8041fc:	8b 00                	mov    (%rax),%eax
+  8041fe:	85 c0                	test   %eax,%eax
+  804200:	75 1d                	jne    80421f <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804202:	bf 03 00 00 00       	mov    $0x3,%edi
+  804207:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  80420e:	00 00 00 
+  804211:	ff d0                	call   *%rax
+  804213:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80421a:	00 00 00 
+  80421d:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80421f:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804226:	00 00 00 
+  804229:	8b 00                	mov    (%rax),%eax
+  80422b:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80422e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804233:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80423a:	00 00 00 
+  80423d:	89 c7                	mov    %eax,%edi
+  80423f:	48 b8 e3 5e 80 00 00 	movabs $0x805ee3,%rax
+  804246:	00 00 00 
+  804249:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80424b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80424f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804254:	48 89 c6             	mov    %rax,%rsi
+  804257:	bf 00 00 00 00       	mov    $0x0,%edi
+  80425c:	48 b8 66 5d 80 00 00 	movabs $0x805d66,%rax
+  804263:	00 00 00 
+  804266:	ff d0                	call   *%rax
+}
+  804268:	c9                   	leave
+  804269:	c3                   	ret
+
+000000000080426a <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80426a:	55                   	push   %rbp
+  80426b:	48 89 e5             	mov    %rsp,%rbp
+  80426e:	48 83 ec 20          	sub    $0x20,%rsp
+  804272:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804276:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804279:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80427d:	48 89 c7             	mov    %rax,%rdi
+  804280:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  804287:	00 00 00 
+  80428a:	ff d0                	call   *%rax
+  80428c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804291:	7e 0a                	jle    80429d <open+0x33>
+    return -E_BAD_PATH;
+  804293:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804298:	e9 a8 00 00 00       	jmp    804345 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80429d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8042a1:	48 89 c7             	mov    %rax,%rdi
+  8042a4:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  8042ab:	00 00 00 
+  8042ae:	ff d0                	call   *%rax
+  8042b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042b7:	79 08                	jns    8042c1 <open+0x57>
+    return r;
+  8042b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042bc:	e9 84 00 00 00       	jmp    804345 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8042c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042c5:	48 89 c6             	mov    %rax,%rsi
+  8042c8:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042cf:	00 00 00 
+  8042d2:	48 89 c7             	mov    %rax,%rdi
+  8042d5:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  8042dc:	00 00 00 
+  8042df:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8042e1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8042e8:	00 00 00 
+  8042eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042ee:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8042f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f8:	48 89 c6             	mov    %rax,%rsi
+  8042fb:	bf 01 00 00 00       	mov    $0x1,%edi
+  804300:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  804307:	00 00 00 
+  80430a:	ff d0                	call   *%rax
+  80430c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80430f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804313:	79 1d                	jns    804332 <open+0xc8>
+    fd_close(fd, 0);
+  804315:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804319:	be 00 00 00 00       	mov    $0x0,%esi
+  80431e:	48 89 c7             	mov    %rax,%rdi
+  804321:	48 b8 7c 34 80 00 00 	movabs $0x80347c,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+    return r;
+  80432d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804330:	eb 13                	jmp    804345 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804332:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804336:	48 89 c7             	mov    %rax,%rdi
+  804339:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+}
+  804345:	c9                   	leave
+  804346:	c3                   	ret
+
+0000000000804347 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	48 83 ec 10          	sub    $0x10,%rsp
+  80434f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804357:	8b 40 0c             	mov    0xc(%rax),%eax
+  80435a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804361:	00 00 00 
+  804364:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804366:	be 00 00 00 00       	mov    $0x0,%esi
+  80436b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804370:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  804377:	00 00 00 
+  80437a:	ff d0                	call   *%rax
+}
+  80437c:	c9                   	leave
+  80437d:	c3                   	ret
+
+000000000080437e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80437e:	55                   	push   %rbp
+  80437f:	48 89 e5             	mov    %rsp,%rbp
+  804382:	48 83 ec 30          	sub    $0x30,%rsp
+  804386:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80438a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80438e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804392:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804397:	74 07                	je     8043a0 <devfile_read+0x22>
+  804399:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80439e:	75 0a                	jne    8043aa <devfile_read+0x2c>
+  return E_INVAL;
+  8043a0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8043a5:	e9 b4 00 00 00       	jmp    80445e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8043aa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043b1:	00 
+  while (n) {
+  8043b2:	e9 98 00 00 00       	jmp    80444f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8043b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043bb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8043be:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8043c5:	00 00 00 
+  8043c8:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8043ca:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8043d1:	00 00 00 
+  8043d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043d8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8043dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8043e1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8043e6:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8043ed:	00 00 00 
+  8043f0:	ff d0                	call   *%rax
+  8043f2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8043f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043f9:	7f 13                	jg     80440e <devfile_read+0x90>
+      return res ? res : res0;
+  8043fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043ff:	74 07                	je     804408 <devfile_read+0x8a>
+  804401:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804404:	48 98                	cltq
+  804406:	eb 56                	jmp    80445e <devfile_read+0xe0>
+  804408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80440c:	eb 50                	jmp    80445e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80440e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804411:	48 63 d0             	movslq %eax,%rdx
+  804414:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804418:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80441f:	00 00 00 
+  804422:	48 89 ce             	mov    %rcx,%rsi
+  804425:	48 89 c7             	mov    %rax,%rdi
+  804428:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  80442f:	00 00 00 
+  804432:	ff d0                	call   *%rax
+
+    buf += res;
+  804434:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804437:	48 98                	cltq
+  804439:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80443d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804440:	48 98                	cltq
+  804442:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804446:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804449:	48 98                	cltq
+  80444b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80444f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804454:	0f 85 5d ff ff ff    	jne    8043b7 <devfile_read+0x39>
+  }
+
+  return res0;
+  80445a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80445e:	c9                   	leave
+  80445f:	c3                   	ret
+
+0000000000804460 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804460:	55                   	push   %rbp
+  804461:	48 89 e5             	mov    %rsp,%rbp
+  804464:	48 83 ec 50          	sub    $0x50,%rsp
+  804468:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80446c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804470:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804474:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804479:	74 07                	je     804482 <devfile_write+0x22>
+  80447b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804480:	75 0a                	jne    80448c <devfile_write+0x2c>
+  return E_INVAL;
+  804482:	b8 03 00 00 00       	mov    $0x3,%eax
+  804487:	e9 c9 00 00 00       	jmp    804555 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80448c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804493:	00 
+
+  while (n) {
+  804494:	e9 ad 00 00 00       	jmp    804546 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804499:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80449d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8044a1:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8044a8:	00 
+  8044a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8044ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044b1:	48 39 c2             	cmp    %rax,%rdx
+  8044b4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8044b8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8044bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044c0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044c4:	48 89 c6             	mov    %rax,%rsi
+  8044c7:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  8044ce:	00 00 00 
+  8044d1:	48 89 c7             	mov    %rax,%rdi
+  8044d4:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  8044db:	00 00 00 
+  8044de:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8044e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044e4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044e7:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044ee:	00 00 00 
+  8044f1:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8044f3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044fa:	00 00 00 
+  8044fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804501:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804505:	be 00 00 00 00       	mov    $0x0,%esi
+  80450a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80450f:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  804516:	00 00 00 
+  804519:	ff d0                	call   *%rax
+  80451b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80451e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804522:	79 07                	jns    80452b <devfile_write+0xcb>
+      return res;
+  804524:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804527:	48 98                	cltq
+  804529:	eb 2a                	jmp    804555 <devfile_write+0xf5>
+
+    buf += res;
+  80452b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80452e:	48 98                	cltq
+  804530:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804534:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804537:	48 98                	cltq
+  804539:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80453d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804540:	48 98                	cltq
+  804542:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804546:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80454b:	0f 85 48 ff ff ff    	jne    804499 <devfile_write+0x39>
+  }
+
+  return res0;
+  804551:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804555:	c9                   	leave
+  804556:	c3                   	ret
+
+0000000000804557 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804557:	55                   	push   %rbp
+  804558:	48 89 e5             	mov    %rsp,%rbp
+  80455b:	48 83 ec 20          	sub    $0x20,%rsp
+  80455f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804563:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80456b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80456e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804575:	00 00 00 
+  804578:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80457a:	be 00 00 00 00       	mov    $0x0,%esi
+  80457f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804584:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80458b:	00 00 00 
+  80458e:	ff d0                	call   *%rax
+  804590:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804593:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804597:	79 05                	jns    80459e <devfile_stat+0x47>
+    return r;
+  804599:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80459c:	eb 59                	jmp    8045f7 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80459e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045a9:	00 00 00 
+  8045ac:	48 89 d6             	mov    %rdx,%rsi
+  8045af:	48 89 c7             	mov    %rax,%rdi
+  8045b2:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  8045b9:	00 00 00 
+  8045bc:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  8045be:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8045c5:	00 00 00 
+  8045c8:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8045ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045d2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8045d8:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8045df:	00 00 00 
+  8045e2:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8045e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ec:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8045f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045f7:	c9                   	leave
+  8045f8:	c3                   	ret
+
+00000000008045f9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8045f9:	55                   	push   %rbp
+  8045fa:	48 89 e5             	mov    %rsp,%rbp
+  8045fd:	48 83 ec 10          	sub    $0x10,%rsp
+  804601:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804605:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80460c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80460f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804616:	00 00 00 
+  804619:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80461b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804622:	00 00 00 
+  804625:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804628:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80462b:	be 00 00 00 00       	mov    $0x0,%esi
+  804630:	bf 02 00 00 00       	mov    $0x2,%edi
+  804635:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80463c:	00 00 00 
+  80463f:	ff d0                	call   *%rax
+}
+  804641:	c9                   	leave
+  804642:	c3                   	ret
+
+0000000000804643 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804643:	55                   	push   %rbp
+  804644:	48 89 e5             	mov    %rsp,%rbp
+  804647:	48 83 ec 18          	sub    $0x18,%rsp
+  80464b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80464f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804652:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804656:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804659:	83 e0 03             	and    $0x3,%eax
+}
+  80465c:	c9                   	leave
+  80465d:	c3                   	ret
+
+000000000080465e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80465e:	55                   	push   %rbp
+  80465f:	48 89 e5             	mov    %rsp,%rbp
+  804662:	48 83 ec 10          	sub    $0x10,%rsp
+  804666:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  80466a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80466e:	48 89 c7             	mov    %rax,%rdi
+  804671:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  804678:	00 00 00 
+  80467b:	ff d0                	call   *%rax
+  80467d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804682:	7e 07                	jle    80468b <remove+0x2d>
+    return -E_BAD_PATH;
+  804684:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804689:	eb 36                	jmp    8046c1 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  80468b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80468f:	48 89 c6             	mov    %rax,%rsi
+  804692:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804699:	00 00 00 
+  80469c:	48 89 c7             	mov    %rax,%rdi
+  80469f:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  8046a6:	00 00 00 
+  8046a9:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8046ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8046b0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8046b5:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8046bc:	00 00 00 
+  8046bf:	ff d0                	call   *%rax
+}
+  8046c1:	c9                   	leave
+  8046c2:	c3                   	ret
+
+00000000008046c3 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  8046c3:	55                   	push   %rbp
+  8046c4:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8046c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8046cc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8046d1:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8046d8:	00 00 00 
+  8046db:	ff d0                	call   *%rax
+}
+  8046dd:	5d                   	pop    %rbp
+  8046de:	c3                   	ret
+
+00000000008046df <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8046df:	55                   	push   %rbp
+  8046e0:	48 89 e5             	mov    %rsp,%rbp
+  8046e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8046e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8046eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8046f0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8046f5:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  8046fc:	00 00 00 
+  8046ff:	ff d0                	call   *%rax
+  804701:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804704:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804708:	79 05                	jns    80470f <fs_stats+0x30>
+    return r;
+  80470a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80470d:	eb 2a                	jmp    804739 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  80470f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804713:	ba 68 00 00 00       	mov    $0x68,%edx
+  804718:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80471f:	00 00 00 
+  804722:	48 89 ce             	mov    %rcx,%rsi
+  804725:	48 89 c7             	mov    %rax,%rdi
+  804728:	48 b8 24 1b 80 00 00 	movabs $0x801b24,%rax
+  80472f:	00 00 00 
+  804732:	ff d0                	call   *%rax
+  return 0;
+  804734:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804739:	c9                   	leave
+  80473a:	c3                   	ret
+
+000000000080473b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80473b:	55                   	push   %rbp
+  80473c:	48 89 e5             	mov    %rsp,%rbp
+  80473f:	48 83 ec 10          	sub    $0x10,%rsp
+  804743:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804746:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80474d:	00 00 00 
+  804750:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804753:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804755:	be 00 00 00 00       	mov    $0x0,%esi
+  80475a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80475f:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  804766:	00 00 00 
+  804769:	ff d0                	call   *%rax
+}
+  80476b:	c9                   	leave
+  80476c:	c3                   	ret
+
+000000000080476d <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  80476d:	55                   	push   %rbp
+  80476e:	48 89 e5             	mov    %rsp,%rbp
+  804771:	48 83 ec 10          	sub    $0x10,%rsp
+  804775:	89 f8                	mov    %edi,%eax
+  804777:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  80477a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  80477e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804785:	00 00 00 
+  804788:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  80478a:	be 00 00 00 00       	mov    $0x0,%esi
+  80478f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804794:	48 b8 e3 41 80 00 00 	movabs $0x8041e3,%rax
+  80479b:	00 00 00 
+  80479e:	ff d0                	call   *%rax
+}
+  8047a0:	c9                   	leave
+  8047a1:	c3                   	ret
+
+00000000008047a2 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8047a2:	55                   	push   %rbp
+  8047a3:	48 89 e5             	mov    %rsp,%rbp
+  8047a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8047aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8047ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047b2:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8047b7:	48 89 c7             	mov    %rax,%rdi
+  8047ba:	48 b8 c8 47 80 00 00 	movabs $0x8047c8,%rax
+  8047c1:	00 00 00 
+  8047c4:	ff d0                	call   *%rax
+}
+  8047c6:	c9                   	leave
+  8047c7:	c3                   	ret
+
+00000000008047c8 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8047c8:	55                   	push   %rbp
+  8047c9:	48 89 e5             	mov    %rsp,%rbp
+  8047cc:	48 83 ec 50          	sub    $0x50,%rsp
+  8047d0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8047d4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8047d8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8047df:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8047e0:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8047e5:	74 0a                	je     8047f1 <pipe_size+0x29>
+  8047e7:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8047ee:	00 
+  8047ef:	76 0a                	jbe    8047fb <pipe_size+0x33>
+    return -E_INVAL;
+  8047f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047f6:	e9 cc 02 00 00       	jmp    804ac7 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8047fb:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8047ff:	48 89 c7             	mov    %rax,%rdi
+  804802:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  804809:	00 00 00 
+  80480c:	ff d0                	call   *%rax
+  80480e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804811:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804815:	0f 88 a8 02 00 00    	js     804ac3 <pipe_size+0x2fb>
+  80481b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80481f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804824:	48 89 c6             	mov    %rax,%rsi
+  804827:	bf 00 00 00 00       	mov    $0x0,%edi
+  80482c:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  804833:	00 00 00 
+  804836:	ff d0                	call   *%rax
+  804838:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80483b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80483f:	0f 88 7e 02 00 00    	js     804ac3 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804845:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804849:	48 89 c7             	mov    %rax,%rdi
+  80484c:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  804853:	00 00 00 
+  804856:	ff d0                	call   *%rax
+  804858:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80485b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80485f:	0f 88 43 02 00 00    	js     804aa8 <pipe_size+0x2e0>
+  804865:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804869:	ba 07 04 00 00       	mov    $0x407,%edx
+  80486e:	48 89 c6             	mov    %rax,%rsi
+  804871:	bf 00 00 00 00       	mov    $0x0,%edi
+  804876:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  80487d:	00 00 00 
+  804880:	ff d0                	call   *%rax
+  804882:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804885:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804889:	0f 88 19 02 00 00    	js     804aa8 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80488f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804893:	48 89 c7             	mov    %rax,%rdi
+  804896:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  80489d:	00 00 00 
+  8048a0:	ff d0                	call   *%rax
+  8048a2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8048a6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8048ad:	00 
+  8048ae:	e9 a2 00 00 00       	jmp    804955 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8048b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048b7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8048bb:	48 89 c2             	mov    %rax,%rdx
+  8048be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c2:	48 01 d0             	add    %rdx,%rax
+  8048c5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048ca:	48 89 c6             	mov    %rax,%rsi
+  8048cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d2:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  8048d9:	00 00 00 
+  8048dc:	ff d0                	call   *%rax
+  8048de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048e5:	0f 88 37 01 00 00    	js     804a22 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8048eb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048ef:	48 89 c7             	mov    %rax,%rdi
+  8048f2:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  8048f9:	00 00 00 
+  8048fc:	ff d0                	call   *%rax
+  8048fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804902:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804906:	48 01 c2             	add    %rax,%rdx
+  804909:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80490d:	48 c1 e0 0c          	shl    $0xc,%rax
+  804911:	48 89 c1             	mov    %rax,%rcx
+  804914:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804918:	48 01 c8             	add    %rcx,%rax
+  80491b:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804921:	48 89 d1             	mov    %rdx,%rcx
+  804924:	ba 00 00 00 00       	mov    $0x0,%edx
+  804929:	48 89 c6             	mov    %rax,%rsi
+  80492c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804931:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  804938:	00 00 00 
+  80493b:	ff d0                	call   *%rax
+  80493d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804940:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804944:	79 0a                	jns    804950 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804946:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  80494b:	e9 d3 00 00 00       	jmp    804a23 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804950:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804955:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  80495c:	00 
+  80495d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804961:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804965:	48 01 d0             	add    %rdx,%rax
+  804968:	48 83 c0 1f          	add    $0x1f,%rax
+  80496c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804970:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804974:	ba 00 00 00 00       	mov    $0x0,%edx
+  804979:	48 f7 75 e0          	divq   -0x20(%rbp)
+  80497d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804981:	48 29 d0             	sub    %rdx,%rax
+  804984:	48 c1 e8 0c          	shr    $0xc,%rax
+  804988:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80498c:	0f 82 21 ff ff ff    	jb     8048b3 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804996:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  80499a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80499e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049a2:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8049a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049aa:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8049b1:	00 00 00 
+  8049b4:	8b 12                	mov    (%rdx),%edx
+  8049b6:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  8049b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049bc:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  8049c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049c7:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8049ce:	00 00 00 
+  8049d1:	8b 12                	mov    (%rdx),%edx
+  8049d3:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8049d5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049d9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8049e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049e4:	48 89 c7             	mov    %rax,%rdi
+  8049e7:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  8049ee:	00 00 00 
+  8049f1:	ff d0                	call   *%rax
+  8049f3:	89 c2                	mov    %eax,%edx
+  8049f5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049f9:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8049fb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049ff:	48 89 c7             	mov    %rax,%rdi
+  804a02:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  804a09:	00 00 00 
+  804a0c:	ff d0                	call   *%rax
+  804a0e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a12:	48 83 c2 04          	add    $0x4,%rdx
+  804a16:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a1d:	e9 a5 00 00 00       	jmp    804ac7 <pipe_size+0x2ff>
+      goto err2;
+  804a22:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804a23:	eb 58                	jmp    804a7d <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a29:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a2d:	48 89 c2             	mov    %rax,%rdx
+  804a30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a34:	48 01 d0             	add    %rdx,%rax
+  804a37:	48 89 c6             	mov    %rax,%rsi
+  804a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a3f:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  804a46:	00 00 00 
+  804a49:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804a4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a4f:	48 89 c7             	mov    %rax,%rdi
+  804a52:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  804a59:	00 00 00 
+  804a5c:	ff d0                	call   *%rax
+  804a5e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a62:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804a66:	48 01 d0             	add    %rdx,%rax
+  804a69:	48 89 c6             	mov    %rax,%rsi
+  804a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a71:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  804a78:	00 00 00 
+  804a7b:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a81:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a85:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804a89:	48 85 c0             	test   %rax,%rax
+  804a8c:	75 97                	jne    804a25 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804a8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a92:	48 89 c6             	mov    %rax,%rsi
+  804a95:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a9a:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  804aa1:	00 00 00 
+  804aa4:	ff d0                	call   *%rax
+  804aa6:	eb 01                	jmp    804aa9 <pipe_size+0x2e1>
+    goto err1;
+  804aa8:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804aa9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aad:	48 89 c6             	mov    %rax,%rsi
+  804ab0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab5:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+  804ac1:	eb 01                	jmp    804ac4 <pipe_size+0x2fc>
+    goto err;
+  804ac3:	90                   	nop
+err:
+  return r;
+  804ac4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804ac7:	c9                   	leave
+  804ac8:	c3                   	ret
+
+0000000000804ac9 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804ac9:	55                   	push   %rbp
+  804aca:	48 89 e5             	mov    %rsp,%rbp
+  804acd:	53                   	push   %rbx
+  804ace:	48 83 ec 28          	sub    $0x28,%rsp
+  804ad2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ad6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804ada:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ae1:	00 00 00 
+  804ae4:	8b 40 04             	mov    0x4(%rax),%eax
+  804ae7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804aec:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804af3:	00 00 00 
+  804af6:	48 98                	cltq
+  804af8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804aff:	48 01 d0             	add    %rdx,%rax
+  804b02:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b08:	8b 00                	mov    (%rax),%eax
+  804b0a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804b0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b11:	48 89 c7             	mov    %rax,%rdi
+  804b14:	48 b8 01 60 80 00 00 	movabs $0x806001,%rax
+  804b1b:	00 00 00 
+  804b1e:	ff d0                	call   *%rax
+  804b20:	89 c3                	mov    %eax,%ebx
+  804b22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b26:	48 89 c7             	mov    %rax,%rdi
+  804b29:	48 b8 01 60 80 00 00 	movabs $0x806001,%rax
+  804b30:	00 00 00 
+  804b33:	ff d0                	call   *%rax
+  804b35:	39 c3                	cmp    %eax,%ebx
+  804b37:	0f 94 c0             	sete   %al
+  804b3a:	0f b6 c0             	movzbl %al,%eax
+  804b3d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804b40:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b47:	00 00 00 
+  804b4a:	8b 40 04             	mov    0x4(%rax),%eax
+  804b4d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b52:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b59:	00 00 00 
+  804b5c:	48 98                	cltq
+  804b5e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b65:	48 01 d0             	add    %rdx,%rax
+  804b68:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b6e:	8b 00                	mov    (%rax),%eax
+  804b70:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804b73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b76:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b79:	75 05                	jne    804b80 <_pipeisclosed+0xb7>
+      return ret;
+  804b7b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b7e:	eb 68                	jmp    804be8 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804b80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b83:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b86:	0f 84 4e ff ff ff    	je     804ada <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804b8c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b93:	00 00 00 
+  804b96:	8b 40 04             	mov    0x4(%rax),%eax
+  804b99:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b9e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ba5:	00 00 00 
+  804ba8:	48 98                	cltq
+  804baa:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bb1:	48 01 d0             	add    %rdx,%rax
+  804bb4:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bba:	8b 10                	mov    (%rax),%edx
+  804bbc:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804bbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc2:	89 c6                	mov    %eax,%esi
+  804bc4:	48 b8 f0 6e 80 00 00 	movabs $0x806ef0,%rax
+  804bcb:	00 00 00 
+  804bce:	48 89 c7             	mov    %rax,%rdi
+  804bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd6:	49 b8 31 06 80 00 00 	movabs $0x800631,%r8
+  804bdd:	00 00 00 
+  804be0:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804be3:	e9 f2 fe ff ff       	jmp    804ada <_pipeisclosed+0x11>
+  }
+}
+  804be8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804bec:	c9                   	leave
+  804bed:	c3                   	ret
+
+0000000000804bee <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804bee:	55                   	push   %rbp
+  804bef:	48 89 e5             	mov    %rsp,%rbp
+  804bf2:	48 83 ec 30          	sub    $0x30,%rsp
+  804bf6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bf9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804bfd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c00:	48 89 d6             	mov    %rdx,%rsi
+  804c03:	89 c7                	mov    %eax,%edi
+  804c05:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  804c0c:	00 00 00 
+  804c0f:	ff d0                	call   *%rax
+  804c11:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c14:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c18:	79 05                	jns    804c1f <pipeisclosed+0x31>
+    return r;
+  804c1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c1d:	eb 31                	jmp    804c50 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804c1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c23:	48 89 c7             	mov    %rax,%rdi
+  804c26:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  804c2d:	00 00 00 
+  804c30:	ff d0                	call   *%rax
+  804c32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c3a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c3e:	48 89 d6             	mov    %rdx,%rsi
+  804c41:	48 89 c7             	mov    %rax,%rdi
+  804c44:	48 b8 c9 4a 80 00 00 	movabs $0x804ac9,%rax
+  804c4b:	00 00 00 
+  804c4e:	ff d0                	call   *%rax
+}
+  804c50:	c9                   	leave
+  804c51:	c3                   	ret
+
+0000000000804c52 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804c52:	55                   	push   %rbp
+  804c53:	48 89 e5             	mov    %rsp,%rbp
+  804c56:	48 83 ec 10          	sub    $0x10,%rsp
+  804c5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804c5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c62:	8b 40 18             	mov    0x18(%rax),%eax
+  804c65:	8d 50 01             	lea    0x1(%rax),%edx
+  804c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c6c:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c73:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804c76:	85 c0                	test   %eax,%eax
+  804c78:	74 27                	je     804ca1 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c7e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c89:	48 83 c0 18          	add    $0x18,%rax
+  804c8d:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804c92:	48 89 c7             	mov    %rax,%rdi
+  804c95:	48 b8 aa 27 80 00 00 	movabs $0x8027aa,%rax
+  804c9c:	00 00 00 
+  804c9f:	ff d0                	call   *%rax
+  }
+}
+  804ca1:	90                   	nop
+  804ca2:	c9                   	leave
+  804ca3:	c3                   	ret
+
+0000000000804ca4 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804ca4:	55                   	push   %rbp
+  804ca5:	48 89 e5             	mov    %rsp,%rbp
+  804ca8:	48 83 ec 10          	sub    $0x10,%rsp
+  804cac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804cb0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804cb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cb7:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804cbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc2:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804cc6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804cc9:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804cd0:	89 c6                	mov    %eax,%esi
+  804cd2:	48 89 cf             	mov    %rcx,%rdi
+  804cd5:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  804cdc:	00 00 00 
+  804cdf:	ff d0                	call   *%rax
+}
+  804ce1:	90                   	nop
+  804ce2:	c9                   	leave
+  804ce3:	c3                   	ret
+
+0000000000804ce4 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804ce4:	55                   	push   %rbp
+  804ce5:	48 89 e5             	mov    %rsp,%rbp
+  804ce8:	48 83 ec 70          	sub    $0x70,%rsp
+  804cec:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804cf0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804cf4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804cf8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804cfc:	48 89 c7             	mov    %rax,%rdi
+  804cff:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  804d06:	00 00 00 
+  804d09:	ff d0                	call   *%rax
+  804d0b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804d0f:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804d14:	75 0a                	jne    804d20 <devpipe_read+0x3c>
+    return 0;
+  804d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1b:	e9 63 01 00 00       	jmp    804e83 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804d20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d24:	8b 40 18             	mov    0x18(%rax),%eax
+  804d27:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804d2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d2e:	48 8b 10             	mov    (%rax),%rdx
+  804d31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d39:	48 39 c2             	cmp    %rax,%rdx
+  804d3c:	75 42                	jne    804d80 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804d3e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d42:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d46:	48 89 d6             	mov    %rdx,%rsi
+  804d49:	48 89 c7             	mov    %rax,%rdi
+  804d4c:	48 b8 c9 4a 80 00 00 	movabs $0x804ac9,%rax
+  804d53:	00 00 00 
+  804d56:	ff d0                	call   *%rax
+  804d58:	85 c0                	test   %eax,%eax
+  804d5a:	74 0a                	je     804d66 <devpipe_read+0x82>
+      return 0;
+  804d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d61:	e9 1d 01 00 00       	jmp    804e83 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804d66:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d6d:	89 d6                	mov    %edx,%esi
+  804d6f:	48 89 c7             	mov    %rax,%rdi
+  804d72:	48 b8 a4 4c 80 00 00 	movabs $0x804ca4,%rax
+  804d79:	00 00 00 
+  804d7c:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804d7e:	eb a0                	jmp    804d20 <devpipe_read+0x3c>
+      break;
+  804d80:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804d81:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d85:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804d89:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d8d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d95:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9d:	48 8b 00             	mov    (%rax),%rax
+  804da0:	48 29 c2             	sub    %rax,%rdx
+  804da3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804da7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804dab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804daf:	48 39 c2             	cmp    %rax,%rdx
+  804db2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804db6:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804dba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dbe:	48 8b 00             	mov    (%rax),%rax
+  804dc1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dc5:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dce:	48 f7 f1             	div    %rcx
+  804dd1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804dd5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804dd9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ddd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804de1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804de5:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804de9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ded:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804df1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804df5:	48 39 c2             	cmp    %rax,%rdx
+  804df8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804dfc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804e00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e04:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804e08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e0c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e10:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e18:	48 89 ce             	mov    %rcx,%rsi
+  804e1b:	48 89 c7             	mov    %rax,%rdi
+  804e1e:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  804e25:	00 00 00 
+  804e28:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804e2a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e2e:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804e32:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e36:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804e3a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e3e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e42:	48 01 d1             	add    %rdx,%rcx
+  804e45:	48 89 c2             	mov    %rax,%rdx
+  804e48:	48 89 cf             	mov    %rcx,%rdi
+  804e4b:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  804e52:	00 00 00 
+  804e55:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5b:	48 8b 10             	mov    (%rax),%rdx
+  804e5e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e62:	48 01 c2             	add    %rax,%rdx
+  804e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e69:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e70:	48 89 c7             	mov    %rax,%rdi
+  804e73:	48 b8 52 4c 80 00 00 	movabs $0x804c52,%rax
+  804e7a:	00 00 00 
+  804e7d:	ff d0                	call   *%rax
+  return n;
+  804e7f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804e83:	c9                   	leave
+  804e84:	c3                   	ret
+
+0000000000804e85 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e85:	55                   	push   %rbp
+  804e86:	48 89 e5             	mov    %rsp,%rbp
+  804e89:	48 83 ec 70          	sub    $0x70,%rsp
+  804e8d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e91:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e95:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804e99:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e9d:	48 89 c7             	mov    %rax,%rdi
+  804ea0:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  804ea7:	00 00 00 
+  804eaa:	ff d0                	call   *%rax
+  804eac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804eb0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804eb4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804eb8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804ebf:	00 
+  804ec0:	e9 b8 01 00 00       	jmp    80507d <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804ec5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec9:	8b 40 18             	mov    0x18(%rax),%eax
+  804ecc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804ecf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804ed7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804edb:	48 8b 00             	mov    (%rax),%rax
+  804ede:	48 29 c2             	sub    %rax,%rdx
+  804ee1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ee9:	48 39 c2             	cmp    %rax,%rdx
+  804eec:	75 4d                	jne    804f3b <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804eee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ef2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ef6:	48 89 d6             	mov    %rdx,%rsi
+  804ef9:	48 89 c7             	mov    %rax,%rdi
+  804efc:	48 b8 c9 4a 80 00 00 	movabs $0x804ac9,%rax
+  804f03:	00 00 00 
+  804f06:	ff d0                	call   *%rax
+  804f08:	85 c0                	test   %eax,%eax
+  804f0a:	74 0a                	je     804f16 <devpipe_write+0x91>
+        return 0;
+  804f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f11:	e9 79 01 00 00       	jmp    80508f <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804f16:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804f19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f1d:	89 d6                	mov    %edx,%esi
+  804f1f:	48 89 c7             	mov    %rax,%rdi
+  804f22:	48 b8 a4 4c 80 00 00 	movabs $0x804ca4,%rax
+  804f29:	00 00 00 
+  804f2c:	ff d0                	call   *%rax
+      m = 0;
+  804f2e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804f35:	00 
+      continue;
+  804f36:	e9 3a 01 00 00       	jmp    805075 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804f3b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f3f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804f43:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f4b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f53:	48 8b 08             	mov    (%rax),%rcx
+  804f56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f5e:	48 29 c1             	sub    %rax,%rcx
+  804f61:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804f65:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f69:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f71:	48 39 c2             	cmp    %rax,%rdx
+  804f74:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804f7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f80:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f88:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f91:	48 f7 f1             	div    %rcx
+  804f94:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804f98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f9c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804fa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fa8:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fac:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804fb0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804fb4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fb8:	48 39 c2             	cmp    %rax,%rdx
+  804fbb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fbf:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804fc3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fc7:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804fcb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fcf:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804fd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fd7:	48 01 d1             	add    %rdx,%rcx
+  804fda:	48 89 c2             	mov    %rax,%rdx
+  804fdd:	48 89 cf             	mov    %rcx,%rdi
+  804fe0:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  804fe7:	00 00 00 
+  804fea:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804fec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ff4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804ff8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804ffc:	73 4d                	jae    80504b <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804ffe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805002:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805006:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80500a:	48 29 c2             	sub    %rax,%rdx
+  80500d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805011:	48 01 c2             	add    %rax,%rdx
+  805014:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805018:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80501c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805020:	48 89 c1             	mov    %rax,%rcx
+  805023:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805027:	48 01 c1             	add    %rax,%rcx
+  80502a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80502e:	48 01 c1             	add    %rax,%rcx
+  805031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805035:	48 83 c0 20          	add    $0x20,%rax
+  805039:	48 89 ce             	mov    %rcx,%rsi
+  80503c:	48 89 c7             	mov    %rax,%rdi
+  80503f:	48 b8 2a 1d 80 00 00 	movabs $0x801d2a,%rax
+  805046:	00 00 00 
+  805049:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80504b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80504f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805053:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805057:	48 01 c2             	add    %rax,%rdx
+  80505a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80505e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805062:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805066:	48 89 c7             	mov    %rax,%rdi
+  805069:	48 b8 52 4c 80 00 00 	movabs $0x804c52,%rax
+  805070:	00 00 00 
+  805073:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805079:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80507d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805081:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805085:	0f 82 3a fe ff ff    	jb     804ec5 <devpipe_write+0x40>
+  }
+
+  return i;
+  80508b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80508f:	c9                   	leave
+  805090:	c3                   	ret
+
+0000000000805091 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805091:	55                   	push   %rbp
+  805092:	48 89 e5             	mov    %rsp,%rbp
+  805095:	48 83 ec 40          	sub    $0x40,%rsp
+  805099:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80509d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8050a0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050a8:	48 89 c7             	mov    %rax,%rdi
+  8050ab:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  8050b2:	00 00 00 
+  8050b5:	ff d0                	call   *%rax
+  8050b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8050bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8050c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050c6:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8050ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050ce:	48 89 d6             	mov    %rdx,%rsi
+  8050d1:	48 89 c7             	mov    %rax,%rdi
+  8050d4:	48 b8 6c 3d 80 00 00 	movabs $0x803d6c,%rax
+  8050db:	00 00 00 
+  8050de:	ff d0                	call   *%rax
+  8050e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050e7:	79 08                	jns    8050f1 <devpipe_poll+0x60>
+    return r;
+  8050e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050ec:	e9 85 00 00 00       	jmp    805176 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8050f1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050f4:	83 e0 01             	and    $0x1,%eax
+  8050f7:	85 c0                	test   %eax,%eax
+  8050f9:	74 18                	je     805113 <devpipe_poll+0x82>
+  8050fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050ff:	48 8b 10             	mov    (%rax),%rdx
+  805102:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805106:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80510a:	48 39 c2             	cmp    %rax,%rdx
+  80510d:	74 04                	je     805113 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80510f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805113:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805116:	83 e0 02             	and    $0x2,%eax
+  805119:	85 c0                	test   %eax,%eax
+  80511b:	74 23                	je     805140 <devpipe_poll+0xaf>
+  80511d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805121:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805129:	48 8b 00             	mov    (%rax),%rax
+  80512c:	48 29 c2             	sub    %rax,%rdx
+  80512f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805133:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805137:	48 39 c2             	cmp    %rax,%rdx
+  80513a:	73 04                	jae    805140 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80513c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805140:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805144:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805148:	48 89 d6             	mov    %rdx,%rsi
+  80514b:	48 89 c7             	mov    %rax,%rdi
+  80514e:	48 b8 c9 4a 80 00 00 	movabs $0x804ac9,%rax
+  805155:	00 00 00 
+  805158:	ff d0                	call   *%rax
+  80515a:	85 c0                	test   %eax,%eax
+  80515c:	74 04                	je     805162 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80515e:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805162:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805166:	75 0b                	jne    805173 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80516c:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805173:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805176:	c9                   	leave
+  805177:	c3                   	ret
+
+0000000000805178 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805178:	55                   	push   %rbp
+  805179:	48 89 e5             	mov    %rsp,%rbp
+  80517c:	48 83 ec 20          	sub    $0x20,%rsp
+  805180:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805184:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805188:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80518c:	48 89 c7             	mov    %rax,%rdi
+  80518f:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  805196:	00 00 00 
+  805199:	ff d0                	call   *%rax
+  80519b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80519f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a3:	48 ba 21 6f 80 00 00 	movabs $0x806f21,%rdx
+  8051aa:	00 00 00 
+  8051ad:	48 89 d6             	mov    %rdx,%rsi
+  8051b0:	48 89 c7             	mov    %rax,%rdi
+  8051b3:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  8051ba:	00 00 00 
+  8051bd:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8051bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051c7:	89 c1                	mov    %eax,%ecx
+  8051c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051cd:	48 8b 00             	mov    (%rax),%rax
+  8051d0:	89 c2                	mov    %eax,%edx
+  8051d2:	89 c8                	mov    %ecx,%eax
+  8051d4:	29 d0                	sub    %edx,%eax
+  8051d6:	89 c2                	mov    %eax,%edx
+  8051d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051dc:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8051e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e6:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8051ed:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8051f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051f4:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8051fb:	00 00 00 
+  8051fe:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805205:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80520a:	c9                   	leave
+  80520b:	c3                   	ret
+
+000000000080520c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80520c:	55                   	push   %rbp
+  80520d:	48 89 e5             	mov    %rsp,%rbp
+  805210:	48 83 ec 40          	sub    $0x40,%rsp
+  805214:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805218:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80521c:	48 89 c7             	mov    %rax,%rdi
+  80521f:	48 b8 99 32 80 00 00 	movabs $0x803299,%rax
+  805226:	00 00 00 
+  805229:	ff d0                	call   *%rax
+  80522b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80522f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805236:	00 
+  805237:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80523b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80523f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805243:	48 01 d0             	add    %rdx,%rax
+  805246:	48 83 c0 1f          	add    $0x1f,%rax
+  80524a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80524e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805252:	ba 00 00 00 00       	mov    $0x0,%edx
+  805257:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80525b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80525f:	48 29 d0             	sub    %rdx,%rax
+  805262:	48 c1 e8 0c          	shr    $0xc,%rax
+  805266:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80526a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80526e:	48 89 c6             	mov    %rax,%rsi
+  805271:	bf 00 00 00 00       	mov    $0x0,%edi
+  805276:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  80527d:	00 00 00 
+  805280:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805282:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805286:	48 89 c7             	mov    %rax,%rdi
+  805289:	48 b8 52 4c 80 00 00 	movabs $0x804c52,%rax
+  805290:	00 00 00 
+  805293:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805295:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805299:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80529d:	eb 2f                	jmp    8052ce <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80529f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052a3:	48 83 e8 01          	sub    $0x1,%rax
+  8052a7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8052ab:	48 89 c2             	mov    %rax,%rdx
+  8052ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b2:	48 01 d0             	add    %rdx,%rax
+  8052b5:	48 89 c6             	mov    %rax,%rsi
+  8052b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052bd:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8052c4:	00 00 00 
+  8052c7:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8052c9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8052ce:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8052d3:	77 ca                	ja     80529f <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8052d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052d9:	48 89 c6             	mov    %rax,%rsi
+  8052dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052e1:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8052e8:	00 00 00 
+  8052eb:	ff d0                	call   *%rax
+}
+  8052ed:	c9                   	leave
+  8052ee:	c3                   	ret
+
+00000000008052ef <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  8052ef:	55                   	push   %rbp
+  8052f0:	48 89 e5             	mov    %rsp,%rbp
+  8052f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8052f7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  8052fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052fd:	be 00 00 00 00       	mov    $0x0,%esi
+  805302:	89 c7                	mov    %eax,%edi
+  805304:	48 b8 13 53 80 00 00 	movabs $0x805313,%rax
+  80530b:	00 00 00 
+  80530e:	ff d0                	call   *%rax
+}
+  805310:	90                   	nop
+  805311:	c9                   	leave
+  805312:	c3                   	ret
+
+0000000000805313 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805313:	55                   	push   %rbp
+  805314:	48 89 e5             	mov    %rsp,%rbp
+  805317:	48 83 ec 10          	sub    $0x10,%rsp
+  80531b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80531e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805322:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805326:	75 3e                	jne    805366 <waitpid+0x53>
+  805328:	48 b8 28 6f 80 00 00 	movabs $0x806f28,%rax
+  80532f:	00 00 00 
+  805332:	48 89 c1             	mov    %rax,%rcx
+  805335:	48 b8 33 6f 80 00 00 	movabs $0x806f33,%rax
+  80533c:	00 00 00 
+  80533f:	48 89 c2             	mov    %rax,%rdx
+  805342:	be 0e 00 00 00       	mov    $0xe,%esi
+  805347:	48 b8 48 6f 80 00 00 	movabs $0x806f48,%rax
+  80534e:	00 00 00 
+  805351:	48 89 c7             	mov    %rax,%rdi
+  805354:	b8 00 00 00 00       	mov    $0x0,%eax
+  805359:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  805360:	00 00 00 
+  805363:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805366:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80536b:	74 0a                	je     805377 <waitpid+0x64>
+    *status = 0;
+  80536d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805371:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805377:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80537b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80537e:	48 89 d6             	mov    %rdx,%rsi
+  805381:	89 c7                	mov    %eax,%edi
+  805383:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  80538a:	00 00 00 
+  80538d:	ff d0                	call   *%rax
+}
+  80538f:	c9                   	leave
+  805390:	c3                   	ret
+
+0000000000805391 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  805391:	55                   	push   %rbp
+  805392:	48 89 e5             	mov    %rsp,%rbp
+  805395:	48 83 ec 10          	sub    $0x10,%rsp
+  805399:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80539d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8053a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053a9:	48 89 c7             	mov    %rax,%rdi
+  8053ac:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8053ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b3:	48 b8 f5 55 80 00 00 	movabs $0x8055f5,%rax
+  8053ba:	00 00 00 
+  8053bd:	ff d0                	call   *%rax
+}
+  8053bf:	90                   	nop
+  8053c0:	c9                   	leave
+  8053c1:	c3                   	ret
+
+00000000008053c2 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8053c2:	55                   	push   %rbp
+  8053c3:	48 89 e5             	mov    %rsp,%rbp
+  8053c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8053ca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8053cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053d0:	c1 e0 10             	shl    $0x10,%eax
+  8053d3:	48 98                	cltq
+  8053d5:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8053da:	48 01 d0             	add    %rdx,%rax
+  8053dd:	48 89 c6             	mov    %rax,%rsi
+  8053e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053e5:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  8053ec:	00 00 00 
+  8053ef:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8053f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053f4:	83 c0 01             	add    $0x1,%eax
+  8053f7:	c1 e0 10             	shl    $0x10,%eax
+  8053fa:	48 98                	cltq
+  8053fc:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805401:	48 01 d0             	add    %rdx,%rax
+  805404:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805408:	eb 20                	jmp    80542a <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80540a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80540e:	48 89 c6             	mov    %rax,%rsi
+  805411:	bf 00 00 00 00       	mov    $0x0,%edi
+  805416:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  80541d:	00 00 00 
+  805420:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805422:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805429:	00 
+  80542a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80542d:	83 c0 01             	add    $0x1,%eax
+  805430:	c1 e0 10             	shl    $0x10,%eax
+  805433:	48 98                	cltq
+  805435:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80543a:	48 01 d0             	add    %rdx,%rax
+  80543d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805441:	72 c7                	jb     80540a <slot_unmap+0x48>
+}
+  805443:	90                   	nop
+  805444:	90                   	nop
+  805445:	c9                   	leave
+  805446:	c3                   	ret
+
+0000000000805447 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805447:	55                   	push   %rbp
+  805448:	48 89 e5             	mov    %rsp,%rbp
+  80544b:	48 83 ec 30          	sub    $0x30,%rsp
+  80544f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805453:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805457:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80545e:	00 00 00 
+  805461:	48 89 c7             	mov    %rax,%rdi
+  805464:	48 b8 82 61 80 00 00 	movabs $0x806182,%rax
+  80546b:	00 00 00 
+  80546e:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805470:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805477:	eb 04                	jmp    80547d <thread_create+0x36>
+  805479:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80547d:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805481:	7f 16                	jg     805499 <thread_create+0x52>
+  805483:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80548a:	00 00 00 
+  80548d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805490:	48 98                	cltq
+  805492:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805495:	85 c0                	test   %eax,%eax
+  805497:	75 e0                	jne    805479 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  805499:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  80549d:	75 0c                	jne    8054ab <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  80549f:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8054a6:	e9 2c 01 00 00       	jmp    8055d7 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8054ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054ae:	c1 e0 10             	shl    $0x10,%eax
+  8054b1:	48 98                	cltq
+  8054b3:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8054b8:	48 01 d0             	add    %rdx,%rax
+  8054bb:	ba 07 00 00 00       	mov    $0x7,%edx
+  8054c0:	48 89 c6             	mov    %rax,%rsi
+  8054c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c8:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  8054cf:	00 00 00 
+  8054d2:	ff d0                	call   *%rax
+  8054d4:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8054d7:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8054db:	0f 88 f5 00 00 00    	js     8055d6 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8054e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054e4:	83 c0 01             	add    $0x1,%eax
+  8054e7:	c1 e0 10             	shl    $0x10,%eax
+  8054ea:	48 98                	cltq
+  8054ec:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8054f1:	48 01 d0             	add    %rdx,%rax
+  8054f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8054f8:	eb 32                	jmp    80552c <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  8054fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054fe:	ba 07 00 00 00       	mov    $0x7,%edx
+  805503:	48 89 c6             	mov    %rax,%rsi
+  805506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80550b:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  805512:	00 00 00 
+  805515:	ff d0                	call   *%rax
+  805517:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80551a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80551e:	0f 88 9e 00 00 00    	js     8055c2 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805524:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80552b:	00 
+  80552c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80552f:	83 c0 01             	add    $0x1,%eax
+  805532:	c1 e0 10             	shl    $0x10,%eax
+  805535:	48 98                	cltq
+  805537:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80553c:	48 01 d0             	add    %rdx,%rax
+  80553f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805543:	72 b5                	jb     8054fa <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805545:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805549:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80554d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805550:	c1 e2 10             	shl    $0x10,%edx
+  805553:	48 63 d2             	movslq %edx,%rdx
+  805556:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  80555b:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80555e:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805561:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805564:	83 c2 01             	add    $0x1,%edx
+  805567:	c1 e2 10             	shl    $0x10,%edx
+  80556a:	48 63 d2             	movslq %edx,%rdx
+  80556d:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805572:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805575:	48 bf 91 53 80 00 00 	movabs $0x805391,%rdi
+  80557c:	00 00 00 
+  80557f:	49 89 c8             	mov    %rcx,%r8
+  805582:	48 89 c1             	mov    %rax,%rcx
+  805585:	4c 89 ca             	mov    %r9,%rdx
+  805588:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  80558f:	00 00 00 
+  805592:	ff d0                	call   *%rax
+  805594:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805597:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80559b:	79 08                	jns    8055a5 <thread_create+0x15e>
+    r = id;
+  80559d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055a0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8055a3:	eb 1e                	jmp    8055c3 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8055a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055a8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8055ab:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  8055b2:	00 00 00 
+  8055b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055b8:	48 98                	cltq
+  8055ba:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8055bd:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8055c0:	eb 15                	jmp    8055d7 <thread_create+0x190>
+      goto fail;
+  8055c2:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8055c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8055c6:	89 c7                	mov    %eax,%edi
+  8055c8:	48 b8 c2 53 80 00 00 	movabs $0x8053c2,%rax
+  8055cf:	00 00 00 
+  8055d2:	ff d0                	call   *%rax
+  8055d4:	eb 01                	jmp    8055d7 <thread_create+0x190>
+    goto out;
+  8055d6:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8055d7:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8055de:	00 00 00 
+  8055e1:	48 89 c7             	mov    %rax,%rdi
+  8055e4:	48 b8 57 62 80 00 00 	movabs $0x806257,%rax
+  8055eb:	00 00 00 
+  8055ee:	ff d0                	call   *%rax
+  return r;
+  8055f0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8055f3:	c9                   	leave
+  8055f4:	c3                   	ret
+
+00000000008055f5 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  8055f5:	55                   	push   %rbp
+  8055f6:	48 89 e5             	mov    %rsp,%rbp
+  8055f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8055fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805600:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805603:	89 c7                	mov    %eax,%edi
+  805605:	48 b8 ac 28 80 00 00 	movabs $0x8028ac,%rax
+  80560c:	00 00 00 
+  80560f:	ff d0                	call   *%rax
+}
+  805611:	90                   	nop
+  805612:	c9                   	leave
+  805613:	c3                   	ret
+
+0000000000805614 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805614:	55                   	push   %rbp
+  805615:	48 89 e5             	mov    %rsp,%rbp
+  805618:	48 83 ec 20          	sub    $0x20,%rsp
+  80561c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80561f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805623:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80562a:	00 00 00 
+  80562d:	48 89 c7             	mov    %rax,%rdi
+  805630:	48 b8 82 61 80 00 00 	movabs $0x806182,%rax
+  805637:	00 00 00 
+  80563a:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  80563c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805643:	eb 04                	jmp    805649 <thread_join+0x35>
+  805645:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805649:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80564d:	7f 17                	jg     805666 <thread_join+0x52>
+  80564f:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805656:	00 00 00 
+  805659:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80565c:	48 98                	cltq
+  80565e:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805661:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805664:	75 df                	jne    805645 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805666:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80566d:	00 00 00 
+  805670:	48 89 c7             	mov    %rax,%rdi
+  805673:	48 b8 57 62 80 00 00 	movabs $0x806257,%rax
+  80567a:	00 00 00 
+  80567d:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80567f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805683:	74 06                	je     80568b <thread_join+0x77>
+  805685:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805689:	75 07                	jne    805692 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  80568b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805690:	eb 76                	jmp    805708 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  805692:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805696:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805699:	48 89 d6             	mov    %rdx,%rsi
+  80569c:	89 c7                	mov    %eax,%edi
+  80569e:	48 b8 13 53 80 00 00 	movabs $0x805313,%rax
+  8056a5:	00 00 00 
+  8056a8:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8056aa:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8056b1:	00 00 00 
+  8056b4:	48 89 c7             	mov    %rax,%rdi
+  8056b7:	48 b8 82 61 80 00 00 	movabs $0x806182,%rax
+  8056be:	00 00 00 
+  8056c1:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8056c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056c6:	89 c7                	mov    %eax,%edi
+  8056c8:	48 b8 c2 53 80 00 00 	movabs $0x8053c2,%rax
+  8056cf:	00 00 00 
+  8056d2:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8056d4:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8056db:	00 00 00 
+  8056de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056e1:	48 98                	cltq
+  8056e3:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  8056ea:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8056f1:	00 00 00 
+  8056f4:	48 89 c7             	mov    %rax,%rdi
+  8056f7:	48 b8 57 62 80 00 00 	movabs $0x806257,%rax
+  8056fe:	00 00 00 
+  805701:	ff d0                	call   *%rax
+  return 0;
+  805703:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805708:	c9                   	leave
+  805709:	c3                   	ret
+
+000000000080570a <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  80570a:	55                   	push   %rbp
+  80570b:	48 89 e5             	mov    %rsp,%rbp
+  80570e:	48 83 ec 08          	sub    $0x8,%rsp
+  805712:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805716:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80571b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80571f:	73 23                	jae    805744 <thread_is_uxstack+0x3a>
+  805721:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805726:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80572a:	72 18                	jb     805744 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  80572c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805730:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805735:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80573b:	75 07                	jne    805744 <thread_is_uxstack+0x3a>
+  80573d:	b8 01 00 00 00       	mov    $0x1,%eax
+  805742:	eb 05                	jmp    805749 <thread_is_uxstack+0x3f>
+  805744:	b8 00 00 00 00       	mov    $0x0,%eax
+  805749:	83 e0 01             	and    $0x1,%eax
+}
+  80574c:	c9                   	leave
+  80574d:	c3                   	ret
+
+000000000080574e <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80574e:	55                   	push   %rbp
+  80574f:	48 89 e5             	mov    %rsp,%rbp
+  805752:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805756:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80575d:	00 00 00 
+  805760:	8b 40 04             	mov    0x4(%rax),%eax
+  805763:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805768:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80576f:	00 00 00 
+  805772:	48 98                	cltq
+  805774:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80577b:	48 01 d0             	add    %rdx,%rax
+  80577e:	48 05 08 01 00 00    	add    $0x108,%rax
+  805784:	48 8b 00             	mov    (%rax),%rax
+  805787:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  80578b:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805790:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805794:	73 0b                	jae    8057a1 <thread_pftemp+0x53>
+  805796:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80579b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80579f:	73 07                	jae    8057a8 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8057a1:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8057a6:	eb 26                	jmp    8057ce <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8057a8:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8057af:	ff ff ff 
+  8057b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057b6:	48 01 d0             	add    %rdx,%rax
+  8057b9:	48 c1 e8 10          	shr    $0x10,%rax
+  8057bd:	48 83 c0 01          	add    $0x1,%rax
+  8057c1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8057c5:	48 f7 d8             	neg    %rax
+  8057c8:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  8057ce:	c9                   	leave
+  8057cf:	c3                   	ret
+
+00000000008057d0 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8057d0:	55                   	push   %rbp
+  8057d1:	48 89 e5             	mov    %rsp,%rbp
+  8057d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8057d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8057db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057df:	75 10                	jne    8057f1 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8057e1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057e8:	00 00 00 
+  8057eb:	8b 00                	mov    (%rax),%eax
+  8057ed:	48 98                	cltq
+  8057ef:	eb 05                	jmp    8057f6 <vsyscall+0x26>
+  }
+  return 0;
+  8057f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057f6:	c9                   	leave
+  8057f7:	c3                   	ret
+
+00000000008057f8 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8057f8:	55                   	push   %rbp
+  8057f9:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8057fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805801:	48 b8 d0 57 80 00 00 	movabs $0x8057d0,%rax
+  805808:	00 00 00 
+  80580b:	ff d0                	call   *%rax
+}
+  80580d:	5d                   	pop    %rbp
+  80580e:	c3                   	ret
+
+000000000080580f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80580f:	55                   	push   %rbp
+  805810:	48 89 e5             	mov    %rsp,%rbp
+  805813:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805817:	0f 31                	rdtsc
+  805819:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80581c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80581f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805822:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805825:	48 c1 e2 20          	shl    $0x20,%rdx
+  805829:	48 09 d0             	or     %rdx,%rax
+  80582c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805830:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805834:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805838:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80583f:	00 00 00 
+  805842:	8b 40 08             	mov    0x8(%rax),%eax
+  805845:	48 98                	cltq
+  805847:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80584b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80584f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805854:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805858:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80585f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805863:	ba 00 00 00 00       	mov    $0x0,%edx
+  805868:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80586c:	48 89 d0             	mov    %rdx,%rax
+  80586f:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80587b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80587f:	48 01 c8             	add    %rcx,%rax
+}
+  805882:	c9                   	leave
+  805883:	c3                   	ret
+
+0000000000805884 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805884:	55                   	push   %rbp
+  805885:	48 89 e5             	mov    %rsp,%rbp
+  805888:	48 83 ec 20          	sub    $0x20,%rsp
+  80588c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80588f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805892:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805895:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805899:	be 01 00 00 00       	mov    $0x1,%esi
+  80589e:	48 89 c7             	mov    %rax,%rdi
+  8058a1:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8058a8:	00 00 00 
+  8058ab:	ff d0                	call   *%rax
+}
+  8058ad:	90                   	nop
+  8058ae:	c9                   	leave
+  8058af:	c3                   	ret
+
+00000000008058b0 <getchar>:
+
+int
+getchar(void) {
+  8058b0:	55                   	push   %rbp
+  8058b1:	48 89 e5             	mov    %rsp,%rbp
+  8058b4:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8058b8:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8058bc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8058c1:	48 89 c6             	mov    %rax,%rsi
+  8058c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058c9:	48 b8 02 39 80 00 00 	movabs $0x803902,%rax
+  8058d0:	00 00 00 
+  8058d3:	ff d0                	call   *%rax
+  8058d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8058d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058dc:	79 05                	jns    8058e3 <getchar+0x33>
+    return r;
+  8058de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058e1:	eb 14                	jmp    8058f7 <getchar+0x47>
+  if (r < 1)
+  8058e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058e7:	7f 07                	jg     8058f0 <getchar+0x40>
+    return -E_EOF;
+  8058e9:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8058ee:	eb 07                	jmp    8058f7 <getchar+0x47>
+  return c;
+  8058f0:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8058f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8058f7:	c9                   	leave
+  8058f8:	c3                   	ret
+
+00000000008058f9 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8058f9:	55                   	push   %rbp
+  8058fa:	48 89 e5             	mov    %rsp,%rbp
+  8058fd:	48 83 ec 20          	sub    $0x20,%rsp
+  805901:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805904:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805908:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80590b:	48 89 d6             	mov    %rdx,%rsi
+  80590e:	89 c7                	mov    %eax,%edi
+  805910:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  805917:	00 00 00 
+  80591a:	ff d0                	call   *%rax
+  80591c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80591f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805923:	79 05                	jns    80592a <iscons+0x31>
+    return r;
+  805925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805928:	eb 1a                	jmp    805944 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80592a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80592e:	8b 10                	mov    (%rax),%edx
+  805930:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805937:	00 00 00 
+  80593a:	8b 00                	mov    (%rax),%eax
+  80593c:	39 c2                	cmp    %eax,%edx
+  80593e:	0f 94 c0             	sete   %al
+  805941:	0f b6 c0             	movzbl %al,%eax
+}
+  805944:	c9                   	leave
+  805945:	c3                   	ret
+
+0000000000805946 <opencons>:
+
+int
+opencons(void) {
+  805946:	55                   	push   %rbp
+  805947:	48 89 e5             	mov    %rsp,%rbp
+  80594a:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80594e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805952:	48 89 c7             	mov    %rax,%rdi
+  805955:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  80595c:	00 00 00 
+  80595f:	ff d0                	call   *%rax
+  805961:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805964:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805968:	79 05                	jns    80596f <opencons+0x29>
+    return r;
+  80596a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80596d:	eb 66                	jmp    8059d5 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80596f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805973:	ba 07 04 00 00       	mov    $0x407,%edx
+  805978:	48 89 c6             	mov    %rax,%rsi
+  80597b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805980:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  805987:	00 00 00 
+  80598a:	ff d0                	call   *%rax
+  80598c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80598f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805993:	79 05                	jns    80599a <opencons+0x54>
+    return r;
+  805995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805998:	eb 3b                	jmp    8059d5 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  80599a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80599e:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8059a5:	00 00 00 
+  8059a8:	8b 12                	mov    (%rdx),%edx
+  8059aa:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8059ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059b0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8059b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059bb:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8059c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059c6:	48 89 c7             	mov    %rax,%rdi
+  8059c9:	48 b8 76 32 80 00 00 	movabs $0x803276,%rax
+  8059d0:	00 00 00 
+  8059d3:	ff d0                	call   *%rax
+}
+  8059d5:	c9                   	leave
+  8059d6:	c3                   	ret
+
+00000000008059d7 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8059d7:	55                   	push   %rbp
+  8059d8:	48 89 e5             	mov    %rsp,%rbp
+  8059db:	48 83 ec 20          	sub    $0x20,%rsp
+  8059df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059e2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8059e5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8059e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059ec:	48 89 d6             	mov    %rdx,%rsi
+  8059ef:	89 c7                	mov    %eax,%edi
+  8059f1:	48 b8 a6 33 80 00 00 	movabs $0x8033a6,%rax
+  8059f8:	00 00 00 
+  8059fb:	ff d0                	call   *%rax
+  8059fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a04:	79 05                	jns    805a0b <consmode+0x34>
+    return r;
+  805a06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a09:	eb 34                	jmp    805a3f <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805a0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a0f:	8b 10                	mov    (%rax),%edx
+  805a11:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805a18:	00 00 00 
+  805a1b:	8b 00                	mov    (%rax),%eax
+  805a1d:	39 c2                	cmp    %eax,%edx
+  805a1f:	74 07                	je     805a28 <consmode+0x51>
+    return -E_INVAL;
+  805a21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a26:	eb 17                	jmp    805a3f <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a2c:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a36:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a39:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805a3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805a3f:	c9                   	leave
+  805a40:	c3                   	ret
+
+0000000000805a41 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805a41:	55                   	push   %rbp
+  805a42:	48 89 e5             	mov    %rsp,%rbp
+  805a45:	48 83 ec 20          	sub    $0x20,%rsp
+  805a49:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a4d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a51:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a59:	8b 50 0c             	mov    0xc(%rax),%edx
+  805a5c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805a60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a64:	48 89 ce             	mov    %rcx,%rsi
+  805a67:	48 89 c7             	mov    %rax,%rdi
+  805a6a:	48 b8 09 27 80 00 00 	movabs $0x802709,%rax
+  805a71:	00 00 00 
+  805a74:	ff d0                	call   *%rax
+  805a76:	48 98                	cltq
+}
+  805a78:	c9                   	leave
+  805a79:	c3                   	ret
+
+0000000000805a7a <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805a7a:	55                   	push   %rbp
+  805a7b:	48 89 e5             	mov    %rsp,%rbp
+  805a7e:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805a85:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805a8c:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805a93:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805a9a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805aa1:	eb 74                	jmp    805b17 <devcons_write+0x9d>
+    m = n - tot;
+  805aa3:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805aaa:	89 c2                	mov    %eax,%edx
+  805aac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805aaf:	29 c2                	sub    %eax,%edx
+  805ab1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805ab4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ab7:	83 f8 7f             	cmp    $0x7f,%eax
+  805aba:	76 07                	jbe    805ac3 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805abc:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805ac3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ac6:	48 63 d0             	movslq %eax,%rdx
+  805ac9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805acc:	48 63 c8             	movslq %eax,%rcx
+  805acf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805ad6:	48 01 c1             	add    %rax,%rcx
+  805ad9:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805ae0:	48 89 ce             	mov    %rcx,%rsi
+  805ae3:	48 89 c7             	mov    %rax,%rdi
+  805ae6:	48 b8 24 1b 80 00 00 	movabs $0x801b24,%rax
+  805aed:	00 00 00 
+  805af0:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805af2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805af5:	48 63 d0             	movslq %eax,%rdx
+  805af8:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805aff:	48 89 d6             	mov    %rdx,%rsi
+  805b02:	48 89 c7             	mov    %rax,%rdi
+  805b05:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  805b0c:	00 00 00 
+  805b0f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805b11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b14:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805b17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b1a:	48 98                	cltq
+  805b1c:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805b23:	0f 82 7a ff ff ff    	jb     805aa3 <devcons_write+0x29>
+  }
+  return tot;
+  805b29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b2c:	48 98                	cltq
+}
+  805b2e:	c9                   	leave
+  805b2f:	c3                   	ret
+
+0000000000805b30 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805b30:	55                   	push   %rbp
+  805b31:	48 89 e5             	mov    %rsp,%rbp
+  805b34:	48 83 ec 08          	sub    $0x8,%rsp
+  805b38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b41:	c9                   	leave
+  805b42:	c3                   	ret
+
+0000000000805b43 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805b43:	55                   	push   %rbp
+  805b44:	48 89 e5             	mov    %rsp,%rbp
+  805b47:	48 83 ec 10          	sub    $0x10,%rsp
+  805b4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b4f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805b53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b57:	48 ba 58 6f 80 00 00 	movabs $0x806f58,%rdx
+  805b5e:	00 00 00 
+  805b61:	48 89 d6             	mov    %rdx,%rsi
+  805b64:	48 89 c7             	mov    %rax,%rdi
+  805b67:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  805b6e:	00 00 00 
+  805b71:	ff d0                	call   *%rax
+  return 0;
+  805b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b78:	c9                   	leave
+  805b79:	c3                   	ret
+
+0000000000805b7a <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805b7a:	55                   	push   %rbp
+  805b7b:	48 89 e5             	mov    %rsp,%rbp
+  805b7e:	48 83 ec 30          	sub    $0x30,%rsp
+  805b82:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b86:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805b89:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805b8d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805b94:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b97:	83 e0 02             	and    $0x2,%eax
+  805b9a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805b9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ba1:	8b 40 0c             	mov    0xc(%rax),%eax
+  805ba4:	83 f8 01             	cmp    $0x1,%eax
+  805ba7:	75 04                	jne    805bad <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805ba9:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805bad:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bb0:	83 e0 01             	and    $0x1,%eax
+  805bb3:	85 c0                	test   %eax,%eax
+  805bb5:	74 44                	je     805bfb <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805bb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805bbf:	89 c2                	mov    %eax,%edx
+  805bc1:	be 00 00 00 00       	mov    $0x0,%esi
+  805bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bcb:	48 b8 f7 27 80 00 00 	movabs $0x8027f7,%rax
+  805bd2:	00 00 00 
+  805bd5:	ff d0                	call   *%rax
+  805bd7:	83 f8 01             	cmp    $0x1,%eax
+  805bda:	75 06                	jne    805be2 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805bdc:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805be0:	eb 19                	jmp    805bfb <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805be2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805be6:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805bec:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805bef:	89 c2                	mov    %eax,%edx
+  805bf1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bf5:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805bfb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805bfe:	c9                   	leave
+  805bff:	c3                   	ret
+
+0000000000805c00 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805c00:	55                   	push   %rbp
+  805c01:	48 89 e5             	mov    %rsp,%rbp
+  805c04:	48 83 ec 20          	sub    $0x20,%rsp
+  805c08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805c0c:	48 b8 36 23 80 00 00 	movabs $0x802336,%rax
+  805c13:	00 00 00 
+  805c16:	ff d0                	call   *%rax
+  805c18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805c1b:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805c22:	00 00 00 
+  805c25:	48 8b 00             	mov    (%rax),%rax
+  805c28:	48 85 c0             	test   %rax,%rax
+  805c2b:	75 62                	jne    805c8f <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805c2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c30:	ba 07 00 00 00       	mov    $0x7,%edx
+  805c35:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805c3c:	00 00 00 
+  805c3f:	48 89 ce             	mov    %rcx,%rsi
+  805c42:	89 c7                	mov    %eax,%edi
+  805c44:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  805c4b:	00 00 00 
+  805c4e:	ff d0                	call   *%rax
+  805c50:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805c53:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c57:	79 36                	jns    805c8f <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805c59:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c5c:	89 c1                	mov    %eax,%ecx
+  805c5e:	48 b8 5f 6f 80 00 00 	movabs $0x806f5f,%rax
+  805c65:	00 00 00 
+  805c68:	48 89 c2             	mov    %rax,%rdx
+  805c6b:	be 23 00 00 00       	mov    $0x23,%esi
+  805c70:	48 b8 77 6f 80 00 00 	movabs $0x806f77,%rax
+  805c77:	00 00 00 
+  805c7a:	48 89 c7             	mov    %rax,%rdi
+  805c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c82:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  805c89:	00 00 00 
+  805c8c:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805c8f:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  805c96:	00 00 00 
+  805c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c9d:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805ca0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ca3:	48 ba 00 5d 80 00 00 	movabs $0x805d00,%rdx
+  805caa:	00 00 00 
+  805cad:	48 89 d6             	mov    %rdx,%rsi
+  805cb0:	89 c7                	mov    %eax,%edi
+  805cb2:	48 b8 4c 25 80 00 00 	movabs $0x80254c,%rax
+  805cb9:	00 00 00 
+  805cbc:	ff d0                	call   *%rax
+  805cbe:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805cc1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805cc5:	79 36                	jns    805cfd <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805cc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805cca:	89 c1                	mov    %eax,%ecx
+  805ccc:	48 b8 5f 6f 80 00 00 	movabs $0x806f5f,%rax
+  805cd3:	00 00 00 
+  805cd6:	48 89 c2             	mov    %rax,%rdx
+  805cd9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805cde:	48 b8 77 6f 80 00 00 	movabs $0x806f77,%rax
+  805ce5:	00 00 00 
+  805ce8:	48 89 c7             	mov    %rax,%rdi
+  805ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cf0:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  805cf7:	00 00 00 
+  805cfa:	41 ff d0             	call   *%r8
+}
+  805cfd:	90                   	nop
+  805cfe:	c9                   	leave
+  805cff:	c3                   	ret
+
+0000000000805d00 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805d00:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805d03:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805d06:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805d0d:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805d11:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805d16:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  805d1d:	00 00 00 
+	call *%rax
+  805d20:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805d22:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805d27:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805d2a:	41 5f                	pop    %r15
+	popq %r15
+  805d2c:	41 5f                	pop    %r15
+	popq %r15
+  805d2e:	41 5f                	pop    %r15
+	popq %r14
+  805d30:	41 5e                	pop    %r14
+	popq %r13
+  805d32:	41 5d                	pop    %r13
+	popq %r12
+  805d34:	41 5c                	pop    %r12
+	popq %r11
+  805d36:	41 5b                	pop    %r11
+	popq %r10
+  805d38:	41 5a                	pop    %r10
+	popq %r9
+  805d3a:	41 59                	pop    %r9
+	popq %r8
+  805d3c:	41 58                	pop    %r8
+	popq %rsi
+  805d3e:	5e                   	pop    %rsi
+	popq %rdi
+  805d3f:	5f                   	pop    %rdi
+	popq %rbp
+  805d40:	5d                   	pop    %rbp
+	popq %rdx
+  805d41:	5a                   	pop    %rdx
+	popq %rcx
+  805d42:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805d43:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805d48:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805d4d:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805d51:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805d54:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805d59:	5b                   	pop    %rbx
+	popq %rax
+  805d5a:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805d5b:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805d5f:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805d60:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805d65:	c3                   	ret
+
+0000000000805d66 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805d66:	55                   	push   %rbp
+  805d67:	48 89 e5             	mov    %rsp,%rbp
+  805d6a:	48 83 ec 20          	sub    $0x20,%rsp
+  805d6e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d72:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805d76:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805d7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d7e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805d82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d86:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805d8d:	48 89 c7             	mov    %rax,%rdi
+  805d90:	48 b8 9e 5d 80 00 00 	movabs $0x805d9e,%rax
+  805d97:	00 00 00 
+  805d9a:	ff d0                	call   *%rax
+}
+  805d9c:	c9                   	leave
+  805d9d:	c3                   	ret
+
+0000000000805d9e <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805d9e:	55                   	push   %rbp
+  805d9f:	48 89 e5             	mov    %rsp,%rbp
+  805da2:	48 83 ec 30          	sub    $0x30,%rsp
+  805da6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805daa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805dae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805db2:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805db6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805dbb:	75 0e                	jne    805dcb <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805dbd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805dc4:	00 00 00 
+  805dc7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805dcb:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805dd0:	75 18                	jne    805dea <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805dd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dd6:	48 89 c7             	mov    %rax,%rdi
+  805dd9:	48 b8 ef 25 80 00 00 	movabs $0x8025ef,%rax
+  805de0:	00 00 00 
+  805de3:	ff d0                	call   *%rax
+  805de5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805de8:	eb 1d                	jmp    805e07 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805dea:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805dee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805df2:	48 89 d6             	mov    %rdx,%rsi
+  805df5:	48 89 c7             	mov    %rax,%rdi
+  805df8:	48 b8 35 26 80 00 00 	movabs $0x802635,%rax
+  805dff:	00 00 00 
+  805e02:	ff d0                	call   *%rax
+  805e04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805e07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e0b:	79 2a                	jns    805e37 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805e0d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e12:	74 0a                	je     805e1e <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805e14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e18:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805e1e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e23:	74 0a                	je     805e2f <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805e25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e29:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805e2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e32:	e9 aa 00 00 00       	jmp    805ee1 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805e37:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e3c:	74 36                	je     805e74 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805e3e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e45:	00 00 00 
+  805e48:	8b 40 04             	mov    0x4(%rax),%eax
+  805e4b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e50:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e57:	00 00 00 
+  805e5a:	48 98                	cltq
+  805e5c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e63:	48 01 d0             	add    %rdx,%rax
+  805e66:	48 05 24 01 00 00    	add    $0x124,%rax
+  805e6c:	8b 10                	mov    (%rax),%edx
+  805e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e72:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805e74:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e79:	74 36                	je     805eb1 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805e7b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e82:	00 00 00 
+  805e85:	8b 40 04             	mov    0x4(%rax),%eax
+  805e88:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e8d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e94:	00 00 00 
+  805e97:	48 98                	cltq
+  805e99:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ea0:	48 01 d0             	add    %rdx,%rax
+  805ea3:	48 05 28 01 00 00    	add    $0x128,%rax
+  805ea9:	8b 10                	mov    (%rax),%edx
+  805eab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805eaf:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805eb1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805eb8:	00 00 00 
+  805ebb:	8b 40 04             	mov    0x4(%rax),%eax
+  805ebe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ec3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805eca:	00 00 00 
+  805ecd:	48 98                	cltq
+  805ecf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ed6:	48 01 d0             	add    %rdx,%rax
+  805ed9:	48 05 20 01 00 00    	add    $0x120,%rax
+  805edf:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805ee1:	c9                   	leave
+  805ee2:	c3                   	ret
+
+0000000000805ee3 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805ee3:	55                   	push   %rbp
+  805ee4:	48 89 e5             	mov    %rsp,%rbp
+  805ee7:	48 83 ec 30          	sub    $0x30,%rsp
+  805eeb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805eee:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805ef1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805ef5:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805ef8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805efd:	75 5e                	jne    805f5d <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805eff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805f06:	00 00 00 
+  805f09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f0d:	eb 4e                	jmp    805f5d <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805f0f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f13:	79 3c                	jns    805f51 <ipc_send+0x6e>
+  805f15:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805f19:	74 36                	je     805f51 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805f1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f1e:	89 c1                	mov    %eax,%ecx
+  805f20:	48 b8 88 6f 80 00 00 	movabs $0x806f88,%rax
+  805f27:	00 00 00 
+  805f2a:	48 89 c2             	mov    %rax,%rdx
+  805f2d:	be 54 00 00 00       	mov    $0x54,%esi
+  805f32:	48 b8 ae 6f 80 00 00 	movabs $0x806fae,%rax
+  805f39:	00 00 00 
+  805f3c:	48 89 c7             	mov    %rax,%rdi
+  805f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f44:	49 b8 12 04 80 00 00 	movabs $0x800412,%r8
+  805f4b:	00 00 00 
+  805f4e:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805f51:	48 b8 72 23 80 00 00 	movabs $0x802372,%rax
+  805f58:	00 00 00 
+  805f5b:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f5d:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805f60:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805f63:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f6a:	89 c7                	mov    %eax,%edi
+  805f6c:	48 b8 98 25 80 00 00 	movabs $0x802598,%rax
+  805f73:	00 00 00 
+  805f76:	ff d0                	call   *%rax
+  805f78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f7f:	75 8e                	jne    805f0f <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805f81:	48 b8 72 23 80 00 00 	movabs $0x802372,%rax
+  805f88:	00 00 00 
+  805f8b:	ff d0                	call   *%rax
+}
+  805f8d:	90                   	nop
+  805f8e:	c9                   	leave
+  805f8f:	c3                   	ret
+
+0000000000805f90 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805f90:	55                   	push   %rbp
+  805f91:	48 89 e5             	mov    %rsp,%rbp
+  805f94:	48 83 ec 18          	sub    $0x18,%rsp
+  805f98:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805f9b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805fa2:	eb 4d                	jmp    805ff1 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805fa4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805fab:	00 00 00 
+  805fae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fb1:	48 98                	cltq
+  805fb3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805fba:	48 01 d0             	add    %rdx,%rax
+  805fbd:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805fc3:	8b 00                	mov    (%rax),%eax
+  805fc5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805fc8:	75 23                	jne    805fed <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805fca:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805fd1:	00 00 00 
+  805fd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fd7:	48 98                	cltq
+  805fd9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805fe0:	48 01 d0             	add    %rdx,%rax
+  805fe3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805fe9:	8b 00                	mov    (%rax),%eax
+  805feb:	eb 12                	jmp    805fff <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805fed:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805ff1:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805ff8:	7e aa                	jle    805fa4 <ipc_find_env+0x14>
+  return 0;
+  805ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fff:	c9                   	leave
+  806000:	c3                   	ret
+
+0000000000806001 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806001:	55                   	push   %rbp
+  806002:	48 89 e5             	mov    %rsp,%rbp
+  806005:	48 83 ec 18          	sub    $0x18,%rsp
+  806009:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80600d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806011:	48 c1 e8 27          	shr    $0x27,%rax
+  806015:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80601a:	48 89 c2             	mov    %rax,%rdx
+  80601d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806024:	01 00 00 
+  806027:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80602b:	83 e0 01             	and    $0x1,%eax
+  80602e:	48 85 c0             	test   %rax,%rax
+  806031:	74 63                	je     806096 <pageref+0x95>
+  806033:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806037:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80603b:	48 89 c2             	mov    %rax,%rdx
+  80603e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806045:	01 00 00 
+  806048:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80604c:	83 e0 01             	and    $0x1,%eax
+  80604f:	48 85 c0             	test   %rax,%rax
+  806052:	74 42                	je     806096 <pageref+0x95>
+  806054:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806058:	48 c1 e8 15          	shr    $0x15,%rax
+  80605c:	48 89 c2             	mov    %rax,%rdx
+  80605f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  806066:	01 00 00 
+  806069:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80606d:	83 e0 01             	and    $0x1,%eax
+  806070:	48 85 c0             	test   %rax,%rax
+  806073:	74 21                	je     806096 <pageref+0x95>
+  806075:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806079:	48 c1 e8 0c          	shr    $0xc,%rax
+  80607d:	48 89 c2             	mov    %rax,%rdx
+  806080:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806087:	01 00 00 
+  80608a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80608e:	83 e0 01             	and    $0x1,%eax
+  806091:	48 85 c0             	test   %rax,%rax
+  806094:	75 07                	jne    80609d <pageref+0x9c>
+    return 0;
+  806096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80609b:	eb 53                	jmp    8060f0 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  80609d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060a1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060a5:	48 89 c2             	mov    %rax,%rdx
+  8060a8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8060af:	01 00 00 
+  8060b2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8060b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8060ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060be:	83 e0 01             	and    $0x1,%eax
+  8060c1:	48 85 c0             	test   %rax,%rax
+  8060c4:	75 07                	jne    8060cd <pageref+0xcc>
+    return 0;
+  8060c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060cb:	eb 23                	jmp    8060f0 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8060cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060d1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8060d5:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8060dc:	00 00 00 
+  8060df:	48 c1 e0 04          	shl    $0x4,%rax
+  8060e3:	48 01 d0             	add    %rdx,%rax
+  8060e6:	48 83 c0 08          	add    $0x8,%rax
+  8060ea:	0f b7 00             	movzwl (%rax),%eax
+  8060ed:	0f b7 c0             	movzwl %ax,%eax
+}
+  8060f0:	c9                   	leave
+  8060f1:	c3                   	ret
+
+00000000008060f2 <xchg>:
+  8060f2:	55                   	push   %rbp
+  8060f3:	48 89 e5             	mov    %rsp,%rbp
+  8060f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8060fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060fe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806101:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806105:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806108:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80610c:	f0 87 02             	lock xchg %eax,(%rdx)
+  80610f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806112:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806115:	c9                   	leave
+  806116:	c3                   	ret
+
+0000000000806117 <cmpxchg>:
+  806117:	55                   	push   %rbp
+  806118:	48 89 e5             	mov    %rsp,%rbp
+  80611b:	48 83 ec 20          	sub    $0x20,%rsp
+  80611f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806123:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806126:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  806129:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80612d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806130:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806133:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806137:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  80613b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80613e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806141:	c9                   	leave
+  806142:	c3                   	ret
+
+0000000000806143 <xadd>:
+  806143:	55                   	push   %rbp
+  806144:	48 89 e5             	mov    %rsp,%rbp
+  806147:	48 83 ec 10          	sub    $0x10,%rsp
+  80614b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80614f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806152:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806156:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806159:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80615d:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  806161:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  806164:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806167:	c9                   	leave
+  806168:	c3                   	ret
+
+0000000000806169 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806169:	55                   	push   %rbp
+  80616a:	48 89 e5             	mov    %rsp,%rbp
+  80616d:	48 83 ec 08          	sub    $0x8,%rsp
+  806171:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  806175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806179:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80617f:	90                   	nop
+  806180:	c9                   	leave
+  806181:	c3                   	ret
+
+0000000000806182 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  806182:	55                   	push   %rbp
+  806183:	48 89 e5             	mov    %rsp,%rbp
+  806186:	48 83 ec 20          	sub    $0x20,%rsp
+  80618a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80618e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806192:	ba 01 00 00 00       	mov    $0x1,%edx
+  806197:	be 00 00 00 00       	mov    $0x0,%esi
+  80619c:	48 89 c7             	mov    %rax,%rdi
+  80619f:	48 b8 17 61 80 00 00 	movabs $0x806117,%rax
+  8061a6:	00 00 00 
+  8061a9:	ff d0                	call   *%rax
+  8061ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8061ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8061b2:	74 65                	je     806219 <mutex_lock+0x97>
+  if (c != 2)
+  8061b4:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8061b8:	74 57                	je     806211 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8061ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061be:	be 02 00 00 00       	mov    $0x2,%esi
+  8061c3:	48 89 c7             	mov    %rax,%rdi
+  8061c6:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  8061cd:	00 00 00 
+  8061d0:	ff d0                	call   *%rax
+  8061d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8061d5:	eb 3a                	jmp    806211 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8061d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061db:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8061e2:	be 02 00 00 00       	mov    $0x2,%esi
+  8061e7:	48 89 c7             	mov    %rax,%rdi
+  8061ea:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  8061f1:	00 00 00 
+  8061f4:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8061f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061fa:	be 02 00 00 00       	mov    $0x2,%esi
+  8061ff:	48 89 c7             	mov    %rax,%rdi
+  806202:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  806209:	00 00 00 
+  80620c:	ff d0                	call   *%rax
+  80620e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806211:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806215:	75 c0                	jne    8061d7 <mutex_lock+0x55>
+  806217:	eb 01                	jmp    80621a <mutex_lock+0x98>
+    return;
+  806219:	90                   	nop
+}
+  80621a:	c9                   	leave
+  80621b:	c3                   	ret
+
+000000000080621c <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  80621c:	55                   	push   %rbp
+  80621d:	48 89 e5             	mov    %rsp,%rbp
+  806220:	48 83 ec 08          	sub    $0x8,%rsp
+  806224:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80622c:	ba 01 00 00 00       	mov    $0x1,%edx
+  806231:	be 00 00 00 00       	mov    $0x0,%esi
+  806236:	48 89 c7             	mov    %rax,%rdi
+  806239:	48 b8 17 61 80 00 00 	movabs $0x806117,%rax
+  806240:	00 00 00 
+  806243:	ff d0                	call   *%rax
+  806245:	85 c0                	test   %eax,%eax
+  806247:	75 07                	jne    806250 <mutex_trylock+0x34>
+  806249:	b8 00 00 00 00       	mov    $0x0,%eax
+  80624e:	eb 05                	jmp    806255 <mutex_trylock+0x39>
+  806250:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806255:	c9                   	leave
+  806256:	c3                   	ret
+
+0000000000806257 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806257:	55                   	push   %rbp
+  806258:	48 89 e5             	mov    %rsp,%rbp
+  80625b:	48 83 ec 10          	sub    $0x10,%rsp
+  80625f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806263:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806267:	be 00 00 00 00       	mov    $0x0,%esi
+  80626c:	48 89 c7             	mov    %rax,%rdi
+  80626f:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  806276:	00 00 00 
+  806279:	ff d0                	call   *%rax
+  80627b:	83 f8 02             	cmp    $0x2,%eax
+  80627e:	75 18                	jne    806298 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806280:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806284:	be 01 00 00 00       	mov    $0x1,%esi
+  806289:	48 89 c7             	mov    %rax,%rdi
+  80628c:	48 b8 aa 27 80 00 00 	movabs $0x8027aa,%rax
+  806293:	00 00 00 
+  806296:	ff d0                	call   *%rax
+}
+  806298:	90                   	nop
+  806299:	c9                   	leave
+  80629a:	c3                   	ret
+
+000000000080629b <cond_init>:
+cond_init(struct Cond *c) {
+  80629b:	55                   	push   %rbp
+  80629c:	48 89 e5             	mov    %rsp,%rbp
+  80629f:	48 83 ec 08          	sub    $0x8,%rsp
+  8062a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  8062a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062ab:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8062b1:	90                   	nop
+  8062b2:	c9                   	leave
+  8062b3:	c3                   	ret
+
+00000000008062b4 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8062b4:	55                   	push   %rbp
+  8062b5:	48 89 e5             	mov    %rsp,%rbp
+  8062b8:	48 83 ec 30          	sub    $0x30,%rsp
+  8062bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8062c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8062c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062cc:	8b 00                	mov    (%rax),%eax
+  8062ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8062d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062d5:	48 89 c7             	mov    %rax,%rdi
+  8062d8:	48 b8 57 62 80 00 00 	movabs $0x806257,%rax
+  8062df:	00 00 00 
+  8062e2:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8062e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8062ec:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8062ef:	89 ce                	mov    %ecx,%esi
+  8062f1:	48 89 c7             	mov    %rax,%rdi
+  8062f4:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  8062fb:	00 00 00 
+  8062fe:	ff d0                	call   *%rax
+  806300:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  806303:	eb 1f                	jmp    806324 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806305:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806309:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806310:	be 02 00 00 00       	mov    $0x2,%esi
+  806315:	48 89 c7             	mov    %rax,%rdi
+  806318:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  80631f:	00 00 00 
+  806322:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806324:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806328:	be 02 00 00 00       	mov    $0x2,%esi
+  80632d:	48 89 c7             	mov    %rax,%rdi
+  806330:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  806337:	00 00 00 
+  80633a:	ff d0                	call   *%rax
+  80633c:	85 c0                	test   %eax,%eax
+  80633e:	75 c5                	jne    806305 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806340:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806344:	75 07                	jne    80634d <cond_timedwait+0x99>
+  806346:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80634b:	eb 05                	jmp    806352 <cond_timedwait+0x9e>
+  80634d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806352:	c9                   	leave
+  806353:	c3                   	ret
+
+0000000000806354 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806354:	55                   	push   %rbp
+  806355:	48 89 e5             	mov    %rsp,%rbp
+  806358:	48 83 ec 10          	sub    $0x10,%rsp
+  80635c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806360:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806364:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80636c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806373:	48 89 ce             	mov    %rcx,%rsi
+  806376:	48 89 c7             	mov    %rax,%rdi
+  806379:	48 b8 b4 62 80 00 00 	movabs $0x8062b4,%rax
+  806380:	00 00 00 
+  806383:	ff d0                	call   *%rax
+}
+  806385:	90                   	nop
+  806386:	c9                   	leave
+  806387:	c3                   	ret
+
+0000000000806388 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806388:	55                   	push   %rbp
+  806389:	48 89 e5             	mov    %rsp,%rbp
+  80638c:	48 83 ec 10          	sub    $0x10,%rsp
+  806390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806398:	be 01 00 00 00       	mov    $0x1,%esi
+  80639d:	48 89 c7             	mov    %rax,%rdi
+  8063a0:	48 b8 43 61 80 00 00 	movabs $0x806143,%rax
+  8063a7:	00 00 00 
+  8063aa:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8063ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8063b5:	48 89 c7             	mov    %rax,%rdi
+  8063b8:	48 b8 aa 27 80 00 00 	movabs $0x8027aa,%rax
+  8063bf:	00 00 00 
+  8063c2:	ff d0                	call   *%rax
+}
+  8063c4:	90                   	nop
+  8063c5:	c9                   	leave
+  8063c6:	c3                   	ret
+
+00000000008063c7 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8063c7:	55                   	push   %rbp
+  8063c8:	48 89 e5             	mov    %rsp,%rbp
+  8063cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8063cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8063d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8063dc:	48 89 c7             	mov    %rax,%rdi
+  8063df:	48 b8 43 61 80 00 00 	movabs $0x806143,%rax
+  8063e6:	00 00 00 
+  8063e9:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8063eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063ef:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8063f4:	48 89 c7             	mov    %rax,%rdi
+  8063f7:	48 b8 aa 27 80 00 00 	movabs $0x8027aa,%rax
+  8063fe:	00 00 00 
+  806401:	ff d0                	call   *%rax
+}
+  806403:	90                   	nop
+  806404:	c9                   	leave
+  806405:	c3                   	ret
+
+0000000000806406 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  806406:	55                   	push   %rbp
+  806407:	48 89 e5             	mov    %rsp,%rbp
+  80640a:	48 83 ec 10          	sub    $0x10,%rsp
+  80640e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806412:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  806415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806419:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80641c:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  80641e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806422:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806429:	90                   	nop
+  80642a:	c9                   	leave
+  80642b:	c3                   	ret
+
+000000000080642c <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  80642c:	55                   	push   %rbp
+  80642d:	48 89 e5             	mov    %rsp,%rbp
+  806430:	48 83 ec 18          	sub    $0x18,%rsp
+  806434:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806438:	eb 2a                	jmp    806464 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80643a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80643d:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806444:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806447:	89 ce                	mov    %ecx,%esi
+  806449:	48 89 c7             	mov    %rax,%rdi
+  80644c:	48 b8 17 61 80 00 00 	movabs $0x806117,%rax
+  806453:	00 00 00 
+  806456:	ff d0                	call   *%rax
+  806458:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80645b:	75 07                	jne    806464 <sem_trywait+0x38>
+      return 0;
+  80645d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806462:	eb 14                	jmp    806478 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806468:	8b 00                	mov    (%rax),%eax
+  80646a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80646d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806471:	75 c7                	jne    80643a <sem_trywait+0xe>
+  return -E_BUSY;
+  806473:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806478:	c9                   	leave
+  806479:	c3                   	ret
+
+000000000080647a <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  80647a:	55                   	push   %rbp
+  80647b:	48 89 e5             	mov    %rsp,%rbp
+  80647e:	48 83 ec 30          	sub    $0x30,%rsp
+  806482:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806486:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  80648a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806491:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  806492:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806497:	0f 84 fb 00 00 00    	je     806598 <sem_timedwait+0x11e>
+  80649d:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8064a2:	0f 84 f0 00 00 00    	je     806598 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  8064a8:	48 b8 0f 58 80 00 00 	movabs $0x80580f,%rax
+  8064af:	00 00 00 
+  8064b2:	ff d0                	call   *%rax
+  8064b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8064b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8064bc:	48 f7 d0             	not    %rax
+  8064bf:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8064c3:	73 0d                	jae    8064d2 <sem_timedwait+0x58>
+  8064c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8064c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064cd:	48 01 d0             	add    %rdx,%rax
+  8064d0:	eb 07                	jmp    8064d9 <sem_timedwait+0x5f>
+  8064d2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8064d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8064dd:	e9 b6 00 00 00       	jmp    806598 <sem_timedwait+0x11e>
+    if (deadline) {
+  8064e2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8064e7:	74 2d                	je     806516 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8064e9:	48 b8 0f 58 80 00 00 	movabs $0x80580f,%rax
+  8064f0:	00 00 00 
+  8064f3:	ff d0                	call   *%rax
+  8064f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8064f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8064fd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806501:	73 0a                	jae    80650d <sem_timedwait+0x93>
+  806503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806507:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80650b:	eb 05                	jmp    806512 <sem_timedwait+0x98>
+  80650d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806512:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  806516:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80651a:	48 83 c0 04          	add    $0x4,%rax
+  80651e:	be 01 00 00 00       	mov    $0x1,%esi
+  806523:	48 89 c7             	mov    %rax,%rdi
+  806526:	48 b8 43 61 80 00 00 	movabs $0x806143,%rax
+  80652d:	00 00 00 
+  806530:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806532:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806536:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80653a:	be 00 00 00 00       	mov    $0x0,%esi
+  80653f:	48 89 c7             	mov    %rax,%rdi
+  806542:	48 b8 5b 27 80 00 00 	movabs $0x80275b,%rax
+  806549:	00 00 00 
+  80654c:	ff d0                	call   *%rax
+  80654e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806551:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806555:	48 83 c0 04          	add    $0x4,%rax
+  806559:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80655e:	48 89 c7             	mov    %rax,%rdi
+  806561:	48 b8 43 61 80 00 00 	movabs $0x806143,%rax
+  806568:	00 00 00 
+  80656b:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  80656d:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  806571:	75 25                	jne    806598 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  806573:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806577:	48 89 c7             	mov    %rax,%rdi
+  80657a:	48 b8 2c 64 80 00 00 	movabs $0x80642c,%rax
+  806581:	00 00 00 
+  806584:	ff d0                	call   *%rax
+  806586:	85 c0                	test   %eax,%eax
+  806588:	79 07                	jns    806591 <sem_timedwait+0x117>
+  80658a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80658f:	eb 27                	jmp    8065b8 <sem_timedwait+0x13e>
+  806591:	b8 00 00 00 00       	mov    $0x0,%eax
+  806596:	eb 20                	jmp    8065b8 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806598:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80659c:	48 89 c7             	mov    %rax,%rdi
+  80659f:	48 b8 2c 64 80 00 00 	movabs $0x80642c,%rax
+  8065a6:	00 00 00 
+  8065a9:	ff d0                	call   *%rax
+  8065ab:	85 c0                	test   %eax,%eax
+  8065ad:	0f 88 2f ff ff ff    	js     8064e2 <sem_timedwait+0x68>
+  return 0;
+  8065b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8065b8:	c9                   	leave
+  8065b9:	c3                   	ret
+
+00000000008065ba <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8065ba:	55                   	push   %rbp
+  8065bb:	48 89 e5             	mov    %rsp,%rbp
+  8065be:	48 83 ec 10          	sub    $0x10,%rsp
+  8065c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8065c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ca:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8065d1:	48 89 c7             	mov    %rax,%rdi
+  8065d4:	48 b8 7a 64 80 00 00 	movabs $0x80647a,%rax
+  8065db:	00 00 00 
+  8065de:	ff d0                	call   *%rax
+}
+  8065e0:	90                   	nop
+  8065e1:	c9                   	leave
+  8065e2:	c3                   	ret
+
+00000000008065e3 <sem_post>:
+sem_post(struct Semaphore *s) {
+  8065e3:	55                   	push   %rbp
+  8065e4:	48 89 e5             	mov    %rsp,%rbp
+  8065e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8065eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8065ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8065f8:	48 89 c7             	mov    %rax,%rdi
+  8065fb:	48 b8 43 61 80 00 00 	movabs $0x806143,%rax
+  806602:	00 00 00 
+  806605:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  806607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80660b:	8b 40 04             	mov    0x4(%rax),%eax
+  80660e:	85 c0                	test   %eax,%eax
+  806610:	74 18                	je     80662a <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806616:	be 01 00 00 00       	mov    $0x1,%esi
+  80661b:	48 89 c7             	mov    %rax,%rdi
+  80661e:	48 b8 aa 27 80 00 00 	movabs $0x8027aa,%rax
+  806625:	00 00 00 
+  806628:	ff d0                	call   *%rax
+}
+  80662a:	90                   	nop
+  80662b:	c9                   	leave
+  80662c:	c3                   	ret
+  80662d:	0f 1f 00             	nopl   (%rax)
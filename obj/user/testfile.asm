@@ -0,0 +1,9048 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 33 0e 00 00       	call   800e5f <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80003e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  extern union Fsipc fsipcbuf;
+  envid_t fsenv;
+
+  strcpy(fsipcbuf.open.req_path, path);
+  800041:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800045:	48 89 c6             	mov    %rax,%rsi
+  800048:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80004f:	00 00 00 
+  800052:	48 89 c7             	mov    %rax,%rdi
+  800055:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  800061:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800068:	00 00 00 
+  80006b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80006e:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  fsenv = ipc_find_env(ENV_TYPE_FS);
+  800074:	bf 03 00 00 00       	mov    $0x3,%edi
+  800079:	48 b8 b4 37 80 00 00 	movabs $0x8037b4,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800088:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80008b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800090:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800097:	00 00 00 
+  80009a:	be 01 00 00 00       	mov    $0x1,%esi
+  80009f:	89 c7                	mov    %eax,%edi
+  8000a1:	48 b8 07 37 80 00 00 	movabs $0x803707,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  return ipc_recv(NULL, FVA, NULL);
+  8000ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b2:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8000b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000bc:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+}
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+00000000008000ca <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000ca:	55                   	push   %rbp
+  8000cb:	48 89 e5             	mov    %rsp,%rbp
+  8000ce:	53                   	push   %rbx
+  8000cf:	48 81 ec d8 02 00 00 	sub    $0x2d8,%rsp
+  8000d6:	89 bd 2c fd ff ff    	mov    %edi,-0x2d4(%rbp)
+  8000dc:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  struct Fd fdcopy;
+  struct Stat st;
+  char buf[512];
+
+  // We open files manually first, to avoid the FD layer
+  if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8000e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e8:	48 b8 e6 5d 80 00 00 	movabs $0x805de6,%rax
+  8000ef:	00 00 00 
+  8000f2:	48 89 c7             	mov    %rax,%rdi
+  8000f5:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8000fc:	00 00 00 
+  8000ff:	ff d0                	call   *%rax
+  800101:	48 98                	cltq
+  800103:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800107:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80010c:	79 3f                	jns    80014d <umain+0x83>
+  80010e:	48 83 7d e0 f2       	cmpq   $0xfffffffffffffff2,-0x20(%rbp)
+  800113:	74 38                	je     80014d <umain+0x83>
+    panic("serve_open /not-found: %ld", (long)r);
+  800115:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800119:	48 89 c1             	mov    %rax,%rcx
+  80011c:	48 b8 f1 5d 80 00 00 	movabs $0x805df1,%rax
+  800123:	00 00 00 
+  800126:	48 89 c2             	mov    %rax,%rdx
+  800129:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80012e:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800135:	00 00 00 
+  800138:	48 89 c7             	mov    %rax,%rdi
+  80013b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800140:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800147:	00 00 00 
+  80014a:	41 ff d0             	call   *%r8
+  else if (r >= 0)
+  80014d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800152:	78 30                	js     800184 <umain+0xba>
+    panic("serve_open /not-found succeeded!");
+  800154:	48 b8 20 5e 80 00 00 	movabs $0x805e20,%rax
+  80015b:	00 00 00 
+  80015e:	48 89 c2             	mov    %rax,%rdx
+  800161:	be 20 00 00 00       	mov    $0x20,%esi
+  800166:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  80016d:	00 00 00 
+  800170:	48 89 c7             	mov    %rax,%rdi
+  800173:	b8 00 00 00 00       	mov    $0x0,%eax
+  800178:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  80017f:	00 00 00 
+  800182:	ff d1                	call   *%rcx
+
+  if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  800184:	be 00 00 00 00       	mov    $0x0,%esi
+  800189:	48 b8 41 5e 80 00 00 	movabs $0x805e41,%rax
+  800190:	00 00 00 
+  800193:	48 89 c7             	mov    %rax,%rdi
+  800196:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	48 98                	cltq
+  8001a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8001a8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8001ad:	79 38                	jns    8001e7 <umain+0x11d>
+    panic("serve_open /newmotd: %ld", (long)r);
+  8001af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001b3:	48 89 c1             	mov    %rax,%rcx
+  8001b6:	48 b8 4a 5e 80 00 00 	movabs $0x805e4a,%rax
+  8001bd:	00 00 00 
+  8001c0:	48 89 c2             	mov    %rax,%rdx
+  8001c3:	be 23 00 00 00       	mov    $0x23,%esi
+  8001c8:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8001cf:	00 00 00 
+  8001d2:	48 89 c7             	mov    %rax,%rdi
+  8001d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001da:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8001e1:	00 00 00 
+  8001e4:	41 ff d0             	call   *%r8
+  if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8001e7:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+  8001ec:	8b 00                	mov    (%rax),%eax
+  8001ee:	83 f8 66             	cmp    $0x66,%eax
+  8001f1:	75 18                	jne    80020b <umain+0x141>
+  8001f3:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+  8001f8:	8b 40 04             	mov    0x4(%rax),%eax
+  8001fb:	85 c0                	test   %eax,%eax
+  8001fd:	75 0c                	jne    80020b <umain+0x141>
+  8001ff:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+  800204:	8b 40 08             	mov    0x8(%rax),%eax
+  800207:	85 c0                	test   %eax,%eax
+  800209:	74 30                	je     80023b <umain+0x171>
+    panic("serve_open did not fill struct Fd correctly\n");
+  80020b:	48 b8 68 5e 80 00 00 	movabs $0x805e68,%rax
+  800212:	00 00 00 
+  800215:	48 89 c2             	mov    %rax,%rdx
+  800218:	be 25 00 00 00       	mov    $0x25,%esi
+  80021d:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800224:	00 00 00 
+  800227:	48 89 c7             	mov    %rax,%rdi
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  800236:	00 00 00 
+  800239:	ff d1                	call   *%rcx
+  cprintf("serve_open is good\n");
+  80023b:	48 b8 95 5e 80 00 00 	movabs $0x805e95,%rax
+  800242:	00 00 00 
+  800245:	48 89 c7             	mov    %rax,%rdi
+  800248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024d:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  800254:	00 00 00 
+  800257:	ff d2                	call   *%rdx
+
+  if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800259:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800260:	00 00 00 
+  800263:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  800267:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80026e:	48 89 c6             	mov    %rax,%rsi
+  800271:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800276:	ff d2                	call   *%rdx
+  800278:	48 98                	cltq
+  80027a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80027e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800283:	79 38                	jns    8002bd <umain+0x1f3>
+    panic("file_stat: %ld", (long)r);
+  800285:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800289:	48 89 c1             	mov    %rax,%rcx
+  80028c:	48 b8 a9 5e 80 00 00 	movabs $0x805ea9,%rax
+  800293:	00 00 00 
+  800296:	48 89 c2             	mov    %rax,%rdx
+  800299:	be 29 00 00 00       	mov    $0x29,%esi
+  80029e:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8002a5:	00 00 00 
+  8002a8:	48 89 c7             	mov    %rax,%rdi
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8002b7:	00 00 00 
+  8002ba:	41 ff d0             	call   *%r8
+  if (strlen(msg) != st.st_size)
+  8002bd:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8002c4:	00 00 00 
+  8002c7:	48 8b 00             	mov    (%rax),%rax
+  8002ca:	48 89 c7             	mov    %rax,%rdi
+  8002cd:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8002d4:	00 00 00 
+  8002d7:	ff d0                	call   *%rax
+  8002d9:	89 c2                	mov    %eax,%edx
+  8002db:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8002de:	39 c2                	cmp    %eax,%edx
+  8002e0:	74 5a                	je     80033c <umain+0x272>
+    panic("file_stat returned size %ld wanted %d\n", (long)st.st_size, strlen(msg));
+  8002e2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8002e9:	00 00 00 
+  8002ec:	48 8b 00             	mov    (%rax),%rax
+  8002ef:	48 89 c7             	mov    %rax,%rdi
+  8002f2:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  8002f9:	00 00 00 
+  8002fc:	ff d0                	call   *%rax
+  8002fe:	89 c2                	mov    %eax,%edx
+  800300:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  800303:	48 98                	cltq
+  800305:	41 89 d0             	mov    %edx,%r8d
+  800308:	48 89 c1             	mov    %rax,%rcx
+  80030b:	48 b8 b8 5e 80 00 00 	movabs $0x805eb8,%rax
+  800312:	00 00 00 
+  800315:	48 89 c2             	mov    %rax,%rdx
+  800318:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80031d:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800324:	00 00 00 
+  800327:	48 89 c7             	mov    %rax,%rdi
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  800336:	00 00 00 
+  800339:	41 ff d1             	call   *%r9
+  cprintf("file_stat is good\n");
+  80033c:	48 b8 df 5e 80 00 00 	movabs $0x805edf,%rax
+  800343:	00 00 00 
+  800346:	48 89 c7             	mov    %rax,%rdi
+  800349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034e:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  800355:	00 00 00 
+  800358:	ff d2                	call   *%rdx
+
+  memset(buf, 0, sizeof buf);
+  80035a:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800361:	ba 00 02 00 00       	mov    $0x200,%edx
+  800366:	be 00 00 00 00       	mov    $0x0,%esi
+  80036b:	48 89 c7             	mov    %rax,%rdi
+  80036e:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+  if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  80037a:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800381:	00 00 00 
+  800384:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  800388:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  80038f:	ba 00 02 00 00       	mov    $0x200,%edx
+  800394:	48 89 c6             	mov    %rax,%rsi
+  800397:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80039c:	ff d1                	call   *%rcx
+  80039e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8003a2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8003a7:	79 38                	jns    8003e1 <umain+0x317>
+    panic("file_read: %ld", (long)r);
+  8003a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003ad:	48 89 c1             	mov    %rax,%rcx
+  8003b0:	48 b8 f2 5e 80 00 00 	movabs $0x805ef2,%rax
+  8003b7:	00 00 00 
+  8003ba:	48 89 c2             	mov    %rax,%rdx
+  8003bd:	be 30 00 00 00       	mov    $0x30,%esi
+  8003c2:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8003c9:	00 00 00 
+  8003cc:	48 89 c7             	mov    %rax,%rdi
+  8003cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d4:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8003db:	00 00 00 
+  8003de:	41 ff d0             	call   *%r8
+  if (strcmp(buf, msg) != 0)
+  8003e1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8003e8:	00 00 00 
+  8003eb:	48 8b 10             	mov    (%rax),%rdx
+  8003ee:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  8003f5:	48 89 d6             	mov    %rdx,%rsi
+  8003f8:	48 89 c7             	mov    %rax,%rdi
+  8003fb:	48 b8 20 23 80 00 00 	movabs $0x802320,%rax
+  800402:	00 00 00 
+  800405:	ff d0                	call   *%rax
+  800407:	85 c0                	test   %eax,%eax
+  800409:	74 30                	je     80043b <umain+0x371>
+    panic("file_read returned wrong data");
+  80040b:	48 b8 01 5f 80 00 00 	movabs $0x805f01,%rax
+  800412:	00 00 00 
+  800415:	48 89 c2             	mov    %rax,%rdx
+  800418:	be 32 00 00 00       	mov    $0x32,%esi
+  80041d:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800424:	00 00 00 
+  800427:	48 89 c7             	mov    %rax,%rdi
+  80042a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042f:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  800436:	00 00 00 
+  800439:	ff d1                	call   *%rcx
+  cprintf("file_read is good\n");
+  80043b:	48 b8 1f 5f 80 00 00 	movabs $0x805f1f,%rax
+  800442:	00 00 00 
+  800445:	48 89 c7             	mov    %rax,%rdi
+  800448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044d:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  800454:	00 00 00 
+  800457:	ff d2                	call   *%rdx
+
+  if ((r = devfile.dev_close(FVA)) < 0)
+  800459:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800460:	00 00 00 
+  800463:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800467:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80046c:	ff d0                	call   *%rax
+  80046e:	48 98                	cltq
+  800470:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800474:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800479:	79 38                	jns    8004b3 <umain+0x3e9>
+    panic("file_close: %ld", (long)r);
+  80047b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80047f:	48 89 c1             	mov    %rax,%rcx
+  800482:	48 b8 32 5f 80 00 00 	movabs $0x805f32,%rax
+  800489:	00 00 00 
+  80048c:	48 89 c2             	mov    %rax,%rdx
+  80048f:	be 36 00 00 00       	mov    $0x36,%esi
+  800494:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  80049b:	00 00 00 
+  80049e:	48 89 c7             	mov    %rax,%rdi
+  8004a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a6:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8004ad:	00 00 00 
+  8004b0:	41 ff d0             	call   *%r8
+  cprintf("file_close is good\n");
+  8004b3:	48 b8 42 5f 80 00 00 	movabs $0x805f42,%rax
+  8004ba:	00 00 00 
+  8004bd:	48 89 c7             	mov    %rax,%rdi
+  8004c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c5:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  8004cc:	00 00 00 
+  8004cf:	ff d2                	call   *%rdx
+
+  // We're about to unmap the FD, but still need a way to get
+  // the stale filenum to serve_read, so we make a local copy.
+  // The file server won't think it's stale until we unmap the
+  // FD page.
+  fdcopy = *FVA;
+  8004d1:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+  8004d6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8004da:	48 8b 00             	mov    (%rax),%rax
+  8004dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  sys_page_unmap(0, FVA);
+  8004e5:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8004ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004ef:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+
+  if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8004fb:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800502:	00 00 00 
+  800505:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  800509:	48 8d 8d 30 fd ff ff 	lea    -0x2d0(%rbp),%rcx
+  800510:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  800514:	ba 00 02 00 00       	mov    $0x200,%edx
+  800519:	48 89 ce             	mov    %rcx,%rsi
+  80051c:	48 89 c7             	mov    %rax,%rdi
+  80051f:	41 ff d0             	call   *%r8
+  800522:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800526:	48 83 7d e0 fd       	cmpq   $0xfffffffffffffffd,-0x20(%rbp)
+  80052b:	74 38                	je     800565 <umain+0x49b>
+    panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  80052d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800531:	48 89 c1             	mov    %rax,%rcx
+  800534:	48 b8 58 5f 80 00 00 	movabs $0x805f58,%rax
+  80053b:	00 00 00 
+  80053e:	48 89 c2             	mov    %rax,%rdx
+  800541:	be 41 00 00 00       	mov    $0x41,%esi
+  800546:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  80054d:	00 00 00 
+  800550:	48 89 c7             	mov    %rax,%rdi
+  800553:	b8 00 00 00 00       	mov    $0x0,%eax
+  800558:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  80055f:	00 00 00 
+  800562:	41 ff d0             	call   *%r8
+  cprintf("stale fileid is good\n");
+  800565:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  80056c:	00 00 00 
+  80056f:	48 89 c7             	mov    %rax,%rdi
+  800572:	b8 00 00 00 00       	mov    $0x0,%eax
+  800577:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  80057e:	00 00 00 
+  800581:	ff d2                	call   *%rdx
+
+  // Try writing
+  if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  800583:	be 02 01 00 00       	mov    $0x102,%esi
+  800588:	48 b8 a6 5f 80 00 00 	movabs $0x805fa6,%rax
+  80058f:	00 00 00 
+  800592:	48 89 c7             	mov    %rax,%rdi
+  800595:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80059c:	00 00 00 
+  80059f:	ff d0                	call   *%rax
+  8005a1:	48 98                	cltq
+  8005a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8005a7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8005ac:	79 38                	jns    8005e6 <umain+0x51c>
+    panic("serve_open /new-file: %ld", (long)r);
+  8005ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005b2:	48 89 c1             	mov    %rax,%rcx
+  8005b5:	48 b8 b0 5f 80 00 00 	movabs $0x805fb0,%rax
+  8005bc:	00 00 00 
+  8005bf:	48 89 c2             	mov    %rax,%rdx
+  8005c2:	be 46 00 00 00       	mov    $0x46,%esi
+  8005c7:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8005ce:	00 00 00 
+  8005d1:	48 89 c7             	mov    %rax,%rdi
+  8005d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d9:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8005e0:	00 00 00 
+  8005e3:	41 ff d0             	call   *%r8
+
+  if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  8005e6:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8005ed:	00 00 00 
+  8005f0:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  8005f4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8005fb:	00 00 00 
+  8005fe:	48 8b 00             	mov    (%rax),%rax
+  800601:	48 89 c7             	mov    %rax,%rdi
+  800604:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  80060b:	00 00 00 
+  80060e:	ff d0                	call   *%rax
+  800610:	48 63 d0             	movslq %eax,%rdx
+  800613:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80061a:	00 00 00 
+  80061d:	48 8b 00             	mov    (%rax),%rax
+  800620:	48 89 c6             	mov    %rax,%rsi
+  800623:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800628:	ff d3                	call   *%rbx
+  80062a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80062e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800635:	00 00 00 
+  800638:	48 8b 00             	mov    (%rax),%rax
+  80063b:	48 89 c7             	mov    %rax,%rdi
+  80063e:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  800645:	00 00 00 
+  800648:	ff d0                	call   *%rax
+  80064a:	48 98                	cltq
+  80064c:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  800650:	74 38                	je     80068a <umain+0x5c0>
+    panic("file_write: %ld", (long)r);
+  800652:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800656:	48 89 c1             	mov    %rax,%rcx
+  800659:	48 b8 ca 5f 80 00 00 	movabs $0x805fca,%rax
+  800660:	00 00 00 
+  800663:	48 89 c2             	mov    %rax,%rdx
+  800666:	be 49 00 00 00       	mov    $0x49,%esi
+  80066b:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800672:	00 00 00 
+  800675:	48 89 c7             	mov    %rax,%rdi
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800684:	00 00 00 
+  800687:	41 ff d0             	call   *%r8
+  cprintf("file_write is good\n");
+  80068a:	48 b8 da 5f 80 00 00 	movabs $0x805fda,%rax
+  800691:	00 00 00 
+  800694:	48 89 c7             	mov    %rax,%rdi
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069c:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  8006a3:	00 00 00 
+  8006a6:	ff d2                	call   *%rdx
+
+  FVA->fd_offset = 0;
+  8006a8:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+  8006ad:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  memset(buf, 0, sizeof buf);
+  8006b4:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  8006bb:	ba 00 02 00 00       	mov    $0x200,%edx
+  8006c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c5:	48 89 c7             	mov    %rax,%rdi
+  8006c8:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  8006cf:	00 00 00 
+  8006d2:	ff d0                	call   *%rax
+  if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8006d4:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  8006db:	00 00 00 
+  8006de:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  8006e2:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  8006e9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8006ee:	48 89 c6             	mov    %rax,%rsi
+  8006f1:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8006f6:	ff d1                	call   *%rcx
+  8006f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8006fc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800701:	79 38                	jns    80073b <umain+0x671>
+    panic("file_read after file_write: %ld", (long)r);
+  800703:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800707:	48 89 c1             	mov    %rax,%rcx
+  80070a:	48 b8 f0 5f 80 00 00 	movabs $0x805ff0,%rax
+  800711:	00 00 00 
+  800714:	48 89 c2             	mov    %rax,%rdx
+  800717:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80071c:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800723:	00 00 00 
+  800726:	48 89 c7             	mov    %rax,%rdi
+  800729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072e:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800735:	00 00 00 
+  800738:	41 ff d0             	call   *%r8
+  if (r != strlen(msg))
+  80073b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800742:	00 00 00 
+  800745:	48 8b 00             	mov    (%rax),%rax
+  800748:	48 89 c7             	mov    %rax,%rdi
+  80074b:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  800752:	00 00 00 
+  800755:	ff d0                	call   *%rax
+  800757:	48 98                	cltq
+  800759:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  80075d:	74 38                	je     800797 <umain+0x6cd>
+    panic("file_read after file_write returned wrong length: %ld", (long)r);
+  80075f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800763:	48 89 c1             	mov    %rax,%rcx
+  800766:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80076d:	00 00 00 
+  800770:	48 89 c2             	mov    %rax,%rdx
+  800773:	be 51 00 00 00       	mov    $0x51,%esi
+  800778:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  80077f:	00 00 00 
+  800782:	48 89 c7             	mov    %rax,%rdi
+  800785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078a:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800791:	00 00 00 
+  800794:	41 ff d0             	call   *%r8
+  if (strcmp(buf, msg) != 0)
+  800797:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80079e:	00 00 00 
+  8007a1:	48 8b 10             	mov    (%rax),%rdx
+  8007a4:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  8007ab:	48 89 d6             	mov    %rdx,%rsi
+  8007ae:	48 89 c7             	mov    %rax,%rdi
+  8007b1:	48 b8 20 23 80 00 00 	movabs $0x802320,%rax
+  8007b8:	00 00 00 
+  8007bb:	ff d0                	call   *%rax
+  8007bd:	85 c0                	test   %eax,%eax
+  8007bf:	74 30                	je     8007f1 <umain+0x727>
+    panic("file_read after file_write returned wrong data");
+  8007c1:	48 b8 48 60 80 00 00 	movabs $0x806048,%rax
+  8007c8:	00 00 00 
+  8007cb:	48 89 c2             	mov    %rax,%rdx
+  8007ce:	be 53 00 00 00       	mov    $0x53,%esi
+  8007d3:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8007da:	00 00 00 
+  8007dd:	48 89 c7             	mov    %rax,%rdi
+  8007e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e5:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  8007ec:	00 00 00 
+  8007ef:	ff d1                	call   *%rcx
+  cprintf("file_read after file_write is good\n");
+  8007f1:	48 b8 78 60 80 00 00 	movabs $0x806078,%rax
+  8007f8:	00 00 00 
+  8007fb:	48 89 c7             	mov    %rax,%rdi
+  8007fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800803:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  80080a:	00 00 00 
+  80080d:	ff d2                	call   *%rdx
+
+  // Now we'll try out open
+  if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80080f:	be 00 00 00 00       	mov    $0x0,%esi
+  800814:	48 b8 e6 5d 80 00 00 	movabs $0x805de6,%rax
+  80081b:	00 00 00 
+  80081e:	48 89 c7             	mov    %rax,%rdi
+  800821:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  800828:	00 00 00 
+  80082b:	ff d0                	call   *%rax
+  80082d:	48 98                	cltq
+  80082f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800833:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800838:	79 3f                	jns    800879 <umain+0x7af>
+  80083a:	48 83 7d e0 f2       	cmpq   $0xfffffffffffffff2,-0x20(%rbp)
+  80083f:	74 38                	je     800879 <umain+0x7af>
+    panic("open /not-found: %ld", (long)r);
+  800841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800845:	48 89 c1             	mov    %rax,%rcx
+  800848:	48 b8 9c 60 80 00 00 	movabs $0x80609c,%rax
+  80084f:	00 00 00 
+  800852:	48 89 c2             	mov    %rax,%rdx
+  800855:	be 58 00 00 00       	mov    $0x58,%esi
+  80085a:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800861:	00 00 00 
+  800864:	48 89 c7             	mov    %rax,%rdi
+  800867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086c:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800873:	00 00 00 
+  800876:	41 ff d0             	call   *%r8
+  else if (r >= 0)
+  800879:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80087e:	78 30                	js     8008b0 <umain+0x7e6>
+    panic("open /not-found succeeded!");
+  800880:	48 b8 b1 60 80 00 00 	movabs $0x8060b1,%rax
+  800887:	00 00 00 
+  80088a:	48 89 c2             	mov    %rax,%rdx
+  80088d:	be 5a 00 00 00       	mov    $0x5a,%esi
+  800892:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800899:	00 00 00 
+  80089c:	48 89 c7             	mov    %rax,%rdi
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  8008ab:	00 00 00 
+  8008ae:	ff d1                	call   *%rcx
+
+  if ((r = open("/newmotd", O_RDONLY)) < 0)
+  8008b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8008b5:	48 b8 41 5e 80 00 00 	movabs $0x805e41,%rax
+  8008bc:	00 00 00 
+  8008bf:	48 89 c7             	mov    %rax,%rdi
+  8008c2:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  8008c9:	00 00 00 
+  8008cc:	ff d0                	call   *%rax
+  8008ce:	48 98                	cltq
+  8008d0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8008d4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8008d9:	79 38                	jns    800913 <umain+0x849>
+    panic("open /newmotd: %ld", (long)r);
+  8008db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008df:	48 89 c1             	mov    %rax,%rcx
+  8008e2:	48 b8 cc 60 80 00 00 	movabs $0x8060cc,%rax
+  8008e9:	00 00 00 
+  8008ec:	48 89 c2             	mov    %rax,%rdx
+  8008ef:	be 5d 00 00 00       	mov    $0x5d,%esi
+  8008f4:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8008fb:	00 00 00 
+  8008fe:	48 89 c7             	mov    %rax,%rdi
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  80090d:	00 00 00 
+  800910:	41 ff d0             	call   *%r8
+  fd = (struct Fd *)(0xD0000000 + r * PGSIZE);
+  800913:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800917:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80091d:	48 c1 e0 0c          	shl    $0xc,%rax
+  800921:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800925:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800929:	8b 00                	mov    (%rax),%eax
+  80092b:	83 f8 66             	cmp    $0x66,%eax
+  80092e:	75 16                	jne    800946 <umain+0x87c>
+  800930:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800934:	8b 40 04             	mov    0x4(%rax),%eax
+  800937:	85 c0                	test   %eax,%eax
+  800939:	75 0b                	jne    800946 <umain+0x87c>
+  80093b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80093f:	8b 40 08             	mov    0x8(%rax),%eax
+  800942:	85 c0                	test   %eax,%eax
+  800944:	74 30                	je     800976 <umain+0x8ac>
+    panic("open did not fill struct Fd correctly\n");
+  800946:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80094d:	00 00 00 
+  800950:	48 89 c2             	mov    %rax,%rdx
+  800953:	be 60 00 00 00       	mov    $0x60,%esi
+  800958:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  80095f:	00 00 00 
+  800962:	48 89 c7             	mov    %rax,%rdi
+  800965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096a:	48 b9 06 0f 80 00 00 	movabs $0x800f06,%rcx
+  800971:	00 00 00 
+  800974:	ff d1                	call   *%rcx
+  cprintf("open is good\n");
+  800976:	48 b8 07 61 80 00 00 	movabs $0x806107,%rax
+  80097d:	00 00 00 
+  800980:	48 89 c7             	mov    %rax,%rdi
+  800983:	b8 00 00 00 00       	mov    $0x0,%eax
+  800988:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  80098f:	00 00 00 
+  800992:	ff d2                	call   *%rdx
+
+  // Try files with indirect blocks
+  if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  800994:	be 01 01 00 00       	mov    $0x101,%esi
+  800999:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  8009a0:	00 00 00 
+  8009a3:	48 89 c7             	mov    %rax,%rdi
+  8009a6:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+  8009b2:	48 98                	cltq
+  8009b4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8009b8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8009bd:	79 38                	jns    8009f7 <umain+0x92d>
+    panic("creat /big: %ld", (long)f);
+  8009bf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009c3:	48 89 c1             	mov    %rax,%rcx
+  8009c6:	48 b8 1a 61 80 00 00 	movabs $0x80611a,%rax
+  8009cd:	00 00 00 
+  8009d0:	48 89 c2             	mov    %rax,%rdx
+  8009d3:	be 65 00 00 00       	mov    $0x65,%esi
+  8009d8:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  8009df:	00 00 00 
+  8009e2:	48 89 c7             	mov    %rax,%rdi
+  8009e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ea:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  8009f1:	00 00 00 
+  8009f4:	41 ff d0             	call   *%r8
+  memset(buf, 0, sizeof(buf));
+  8009f7:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  8009fe:	ba 00 02 00 00       	mov    $0x200,%edx
+  800a03:	be 00 00 00 00       	mov    $0x0,%esi
+  800a08:	48 89 c7             	mov    %rax,%rdi
+  800a0b:	48 b8 0c 25 80 00 00 	movabs $0x80250c,%rax
+  800a12:	00 00 00 
+  800a15:	ff d0                	call   *%rax
+  for (i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800a17:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800a1e:	00 
+  800a1f:	e9 88 00 00 00       	jmp    800aac <umain+0x9e2>
+    *(int *)buf = i;
+  800a24:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800a2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a2f:	89 10                	mov    %edx,(%rax)
+    if ((r = write(f, buf, sizeof(buf))) < 0)
+  800a31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a35:	89 c1                	mov    %eax,%ecx
+  800a37:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800a3e:	ba 00 02 00 00       	mov    $0x200,%edx
+  800a43:	48 89 c6             	mov    %rax,%rsi
+  800a46:	89 cf                	mov    %ecx,%edi
+  800a48:	48 b8 2d 40 80 00 00 	movabs $0x80402d,%rax
+  800a4f:	00 00 00 
+  800a52:	ff d0                	call   *%rax
+  800a54:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800a58:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800a5d:	79 3f                	jns    800a9e <umain+0x9d4>
+      panic("write /big@%ld: %ld", (long)i, (long)r);
+  800a5f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a67:	49 89 d0             	mov    %rdx,%r8
+  800a6a:	48 89 c1             	mov    %rax,%rcx
+  800a6d:	48 b8 2a 61 80 00 00 	movabs $0x80612a,%rax
+  800a74:	00 00 00 
+  800a77:	48 89 c2             	mov    %rax,%rdx
+  800a7a:	be 6a 00 00 00       	mov    $0x6a,%esi
+  800a7f:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800a86:	00 00 00 
+  800a89:	48 89 c7             	mov    %rax,%rdi
+  800a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a91:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  800a98:	00 00 00 
+  800a9b:	41 ff d1             	call   *%r9
+  for (i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800a9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa2:	48 05 00 02 00 00    	add    $0x200,%rax
+  800aa8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800aac:	48 81 7d e8 ff df 01 	cmpq   $0x1dfff,-0x18(%rbp)
+  800ab3:	00 
+  800ab4:	0f 8e 6a ff ff ff    	jle    800a24 <umain+0x95a>
+  }
+  close(f);
+  800aba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800abe:	89 c7                	mov    %eax,%edi
+  800ac0:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  800ac7:	00 00 00 
+  800aca:	ff d0                	call   *%rax
+
+  if ((f = open("/big", O_RDONLY)) < 0)
+  800acc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ad1:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  800ad8:	00 00 00 
+  800adb:	48 89 c7             	mov    %rax,%rdi
+  800ade:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  800ae5:	00 00 00 
+  800ae8:	ff d0                	call   *%rax
+  800aea:	48 98                	cltq
+  800aec:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800af0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800af5:	79 38                	jns    800b2f <umain+0xa65>
+    panic("open /big: %ld", (long)f);
+  800af7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800afb:	48 89 c1             	mov    %rax,%rcx
+  800afe:	48 b8 3e 61 80 00 00 	movabs $0x80613e,%rax
+  800b05:	00 00 00 
+  800b08:	48 89 c2             	mov    %rax,%rdx
+  800b0b:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b10:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800b17:	00 00 00 
+  800b1a:	48 89 c7             	mov    %rax,%rdi
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b22:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800b29:	00 00 00 
+  800b2c:	41 ff d0             	call   *%r8
+  for (i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800b2f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800b36:	00 
+  800b37:	e9 2c 01 00 00       	jmp    800c68 <umain+0xb9e>
+    *(int *)buf = i;
+  800b3c:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800b43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b47:	89 10                	mov    %edx,(%rax)
+    if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800b49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b4d:	89 c1                	mov    %eax,%ecx
+  800b4f:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800b56:	ba 00 02 00 00       	mov    $0x200,%edx
+  800b5b:	48 89 c6             	mov    %rax,%rsi
+  800b5e:	89 cf                	mov    %ecx,%edi
+  800b60:	48 b8 b3 3f 80 00 00 	movabs $0x803fb3,%rax
+  800b67:	00 00 00 
+  800b6a:	ff d0                	call   *%rax
+  800b6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800b70:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800b75:	79 3f                	jns    800bb6 <umain+0xaec>
+      panic("read /big@%ld: %ld", (long)i, (long)r);
+  800b77:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7f:	49 89 d0             	mov    %rdx,%r8
+  800b82:	48 89 c1             	mov    %rax,%rcx
+  800b85:	48 b8 4d 61 80 00 00 	movabs $0x80614d,%rax
+  800b8c:	00 00 00 
+  800b8f:	48 89 c2             	mov    %rax,%rdx
+  800b92:	be 73 00 00 00       	mov    $0x73,%esi
+  800b97:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800b9e:	00 00 00 
+  800ba1:	48 89 c7             	mov    %rax,%rdi
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  800bb0:	00 00 00 
+  800bb3:	41 ff d1             	call   *%r9
+    if (r != sizeof(buf))
+  800bb6:	48 81 7d e0 00 02 00 	cmpq   $0x200,-0x20(%rbp)
+  800bbd:	00 
+  800bbe:	74 45                	je     800c05 <umain+0xb3b>
+      panic("read /big from %ld returned %ld < %d bytes",
+  800bc0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc8:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800bce:	49 89 d0             	mov    %rdx,%r8
+  800bd1:	48 89 c1             	mov    %rax,%rcx
+  800bd4:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  800bdb:	00 00 00 
+  800bde:	48 89 c2             	mov    %rax,%rdx
+  800be1:	be 75 00 00 00       	mov    $0x75,%esi
+  800be6:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800bed:	00 00 00 
+  800bf0:	48 89 c7             	mov    %rax,%rdi
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	49 ba 06 0f 80 00 00 	movabs $0x800f06,%r10
+  800bff:	00 00 00 
+  800c02:	41 ff d2             	call   *%r10
+            (long)i, (long)r, (uint32_t)sizeof(buf));
+    if (*(int *)buf != i)
+  800c05:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800c0c:	8b 00                	mov    (%rax),%eax
+  800c0e:	48 98                	cltq
+  800c10:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800c14:	74 44                	je     800c5a <umain+0xb90>
+      panic("read /big from %ld returned bad data %d",
+  800c16:	48 8d 85 30 fd ff ff 	lea    -0x2d0(%rbp),%rax
+  800c1d:	8b 10                	mov    (%rax),%edx
+  800c1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c23:	41 89 d0             	mov    %edx,%r8d
+  800c26:	48 89 c1             	mov    %rax,%rcx
+  800c29:	48 b8 90 61 80 00 00 	movabs $0x806190,%rax
+  800c30:	00 00 00 
+  800c33:	48 89 c2             	mov    %rax,%rdx
+  800c36:	be 78 00 00 00       	mov    $0x78,%esi
+  800c3b:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800c42:	00 00 00 
+  800c45:	48 89 c7             	mov    %rax,%rdi
+  800c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4d:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  800c54:	00 00 00 
+  800c57:	41 ff d1             	call   *%r9
+  for (i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c5e:	48 05 00 02 00 00    	add    $0x200,%rax
+  800c64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c68:	48 81 7d e8 ff df 01 	cmpq   $0x1dfff,-0x18(%rbp)
+  800c6f:	00 
+  800c70:	0f 8e c6 fe ff ff    	jle    800b3c <umain+0xa72>
+            (long)i, *(int *)buf);
+  }
+  close(f);
+  800c76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c7a:	89 c7                	mov    %eax,%edi
+  800c7c:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  800c83:	00 00 00 
+  800c86:	ff d0                	call   *%rax
+  cprintf("large file is good\n");
+  800c88:	48 b8 b8 61 80 00 00 	movabs $0x8061b8,%rax
+  800c8f:	00 00 00 
+  800c92:	48 89 c7             	mov    %rax,%rdi
+  800c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9a:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  800ca1:	00 00 00 
+  800ca4:	ff d2                	call   *%rdx
+
+  // An open file cannot be removed from under its readers.
+  if ((f = open("/big", O_RDONLY)) < 0)
+  800ca6:	be 00 00 00 00       	mov    $0x0,%esi
+  800cab:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  800cb2:	00 00 00 
+  800cb5:	48 89 c7             	mov    %rax,%rdi
+  800cb8:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  800cbf:	00 00 00 
+  800cc2:	ff d0                	call   *%rax
+  800cc4:	48 98                	cltq
+  800cc6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800cca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ccf:	79 38                	jns    800d09 <umain+0xc3f>
+    panic("open /big: %ld", (long)f);
+  800cd1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cd5:	48 89 c1             	mov    %rax,%rcx
+  800cd8:	48 b8 3e 61 80 00 00 	movabs $0x80613e,%rax
+  800cdf:	00 00 00 
+  800ce2:	48 89 c2             	mov    %rax,%rdx
+  800ce5:	be 80 00 00 00       	mov    $0x80,%esi
+  800cea:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800cf1:	00 00 00 
+  800cf4:	48 89 c7             	mov    %rax,%rdi
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800d03:	00 00 00 
+  800d06:	41 ff d0             	call   *%r8
+  if ((r = remove("/big")) != -E_BUSY)
+  800d09:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  800d10:	00 00 00 
+  800d13:	48 89 c7             	mov    %rax,%rdi
+  800d16:	48 b8 0d 4c 80 00 00 	movabs $0x804c0d,%rax
+  800d1d:	00 00 00 
+  800d20:	ff d0                	call   *%rax
+  800d22:	48 98                	cltq
+  800d24:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800d28:	48 83 7d e0 eb       	cmpq   $0xffffffffffffffeb,-0x20(%rbp)
+  800d2d:	74 38                	je     800d67 <umain+0xc9d>
+    panic("remove of open /big returned %ld", (long)r);
+  800d2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d33:	48 89 c1             	mov    %rax,%rcx
+  800d36:	48 b8 d0 61 80 00 00 	movabs $0x8061d0,%rax
+  800d3d:	00 00 00 
+  800d40:	48 89 c2             	mov    %rax,%rdx
+  800d43:	be 82 00 00 00       	mov    $0x82,%esi
+  800d48:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800d4f:	00 00 00 
+  800d52:	48 89 c7             	mov    %rax,%rdi
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5a:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800d61:	00 00 00 
+  800d64:	41 ff d0             	call   *%r8
+  close(f);
+  800d67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d6b:	89 c7                	mov    %eax,%edi
+  800d6d:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  800d74:	00 00 00 
+  800d77:	ff d0                	call   *%rax
+  if ((r = remove("/big")) < 0)
+  800d79:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  800d80:	00 00 00 
+  800d83:	48 89 c7             	mov    %rax,%rdi
+  800d86:	48 b8 0d 4c 80 00 00 	movabs $0x804c0d,%rax
+  800d8d:	00 00 00 
+  800d90:	ff d0                	call   *%rax
+  800d92:	48 98                	cltq
+  800d94:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800d98:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800d9d:	79 38                	jns    800dd7 <umain+0xd0d>
+    panic("remove /big: %ld", (long)r);
+  800d9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800da3:	48 89 c1             	mov    %rax,%rcx
+  800da6:	48 b8 f1 61 80 00 00 	movabs $0x8061f1,%rax
+  800dad:	00 00 00 
+  800db0:	48 89 c2             	mov    %rax,%rdx
+  800db3:	be 85 00 00 00       	mov    $0x85,%esi
+  800db8:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800dbf:	00 00 00 
+  800dc2:	48 89 c7             	mov    %rax,%rdi
+  800dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dca:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800dd1:	00 00 00 
+  800dd4:	41 ff d0             	call   *%r8
+  if ((r = open("/big", O_RDONLY)) != -E_NOT_FOUND)
+  800dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ddc:	48 b8 15 61 80 00 00 	movabs $0x806115,%rax
+  800de3:	00 00 00 
+  800de6:	48 89 c7             	mov    %rax,%rdi
+  800de9:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  800df0:	00 00 00 
+  800df3:	ff d0                	call   *%rax
+  800df5:	48 98                	cltq
+  800df7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800dfb:	48 83 7d e0 f2       	cmpq   $0xfffffffffffffff2,-0x20(%rbp)
+  800e00:	74 38                	je     800e3a <umain+0xd70>
+    panic("open of removed /big returned %ld", (long)r);
+  800e02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e06:	48 89 c1             	mov    %rax,%rcx
+  800e09:	48 b8 08 62 80 00 00 	movabs $0x806208,%rax
+  800e10:	00 00 00 
+  800e13:	48 89 c2             	mov    %rax,%rdx
+  800e16:	be 87 00 00 00       	mov    $0x87,%esi
+  800e1b:	48 b8 0c 5e 80 00 00 	movabs $0x805e0c,%rax
+  800e22:	00 00 00 
+  800e25:	48 89 c7             	mov    %rax,%rdi
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  800e34:	00 00 00 
+  800e37:	41 ff d0             	call   *%r8
+  cprintf("remove is good\n");
+  800e3a:	48 b8 2a 62 80 00 00 	movabs $0x80622a,%rax
+  800e41:	00 00 00 
+  800e44:	48 89 c7             	mov    %rax,%rdi
+  800e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4c:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  800e53:	00 00 00 
+  800e56:	ff d2                	call   *%rdx
+}
+  800e58:	90                   	nop
+  800e59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e5d:	c9                   	leave
+  800e5e:	c3                   	ret
+
+0000000000800e5f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800e5f:	55                   	push   %rbp
+  800e60:	48 89 e5             	mov    %rsp,%rbp
+  800e63:	48 83 ec 20          	sub    $0x20,%rsp
+  800e67:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800e6a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800e6e:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800e75:	00 00 00 
+  800e78:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800e7c:	eb 13                	jmp    800e91 <libmain+0x32>
+    (*ctor)();
+  800e7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e82:	48 8b 10             	mov    (%rax),%rdx
+  800e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8a:	ff d2                	call   *%rdx
+    ctor++;
+  800e8c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800e91:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800e98:	00 00 00 
+  800e9b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800e9f:	72 dd                	jb     800e7e <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800ea1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800ea5:	7e 14                	jle    800ebb <libmain+0x5c>
+    binaryname = argv[0];
+  800ea7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800eab:	48 8b 00             	mov    (%rax),%rax
+  800eae:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  800eb5:	00 00 00 
+  800eb8:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800ebb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ebf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800ec2:	48 89 d6             	mov    %rdx,%rsi
+  800ec5:	89 c7                	mov    %eax,%edi
+  800ec7:	48 b8 ca 00 80 00 00 	movabs $0x8000ca,%rax
+  800ece:	00 00 00 
+  800ed1:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800ed3:	48 b8 e2 0e 80 00 00 	movabs $0x800ee2,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+#endif
+}
+  800edf:	90                   	nop
+  800ee0:	c9                   	leave
+  800ee1:	c3                   	ret
+
+0000000000800ee2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800ee2:	55                   	push   %rbp
+  800ee3:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800ee6:	48 b8 15 3c 80 00 00 	movabs $0x803c15,%rax
+  800eed:	00 00 00 
+  800ef0:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef7:	48 b8 5b 2d 80 00 00 	movabs $0x802d5b,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+}
+  800f03:	90                   	nop
+  800f04:	5d                   	pop    %rbp
+  800f05:	c3                   	ret
+
+0000000000800f06 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800f06:	55                   	push   %rbp
+  800f07:	48 89 e5             	mov    %rsp,%rbp
+  800f0a:	53                   	push   %rbx
+  800f0b:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800f12:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800f19:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800f1f:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800f26:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800f2d:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800f34:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800f3b:	84 c0                	test   %al,%al
+  800f3d:	74 23                	je     800f62 <_panic+0x5c>
+  800f3f:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800f46:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800f4a:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800f4e:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800f52:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800f56:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800f5a:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800f5e:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f62:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800f69:	00 00 00 
+  800f6c:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800f73:	00 00 00 
+  800f76:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f7a:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800f81:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800f88:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800f8f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f96:	00 00 00 
+  800f99:	48 8b 18             	mov    (%rax),%rbx
+  800f9c:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  800fa3:	00 00 00 
+  800fa6:	ff d0                	call   *%rax
+  800fa8:	89 c6                	mov    %eax,%esi
+  800faa:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800fb0:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800fb7:	41 89 d0             	mov    %edx,%r8d
+  800fba:	48 89 c1             	mov    %rax,%rcx
+  800fbd:	48 89 da             	mov    %rbx,%rdx
+  800fc0:	48 b8 48 62 80 00 00 	movabs $0x806248,%rax
+  800fc7:	00 00 00 
+  800fca:	48 89 c7             	mov    %rax,%rdi
+  800fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd2:	49 b9 25 11 80 00 00 	movabs $0x801125,%r9
+  800fd9:	00 00 00 
+  800fdc:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800fdf:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800fe6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800fed:	48 89 d6             	mov    %rdx,%rsi
+  800ff0:	48 89 c7             	mov    %rax,%rdi
+  800ff3:	48 b8 9a 10 80 00 00 	movabs $0x80109a,%rax
+  800ffa:	00 00 00 
+  800ffd:	ff d0                	call   *%rax
+  cprintf("\n");
+  800fff:	48 b8 6b 62 80 00 00 	movabs $0x80626b,%rax
+  801006:	00 00 00 
+  801009:	48 89 c7             	mov    %rax,%rdi
+  80100c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801011:	48 ba 25 11 80 00 00 	movabs $0x801125,%rdx
+  801018:	00 00 00 
+  80101b:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80101d:	cc                   	int3
+  80101e:	eb fd                	jmp    80101d <_panic+0x117>
+
+0000000000801020 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  801020:	55                   	push   %rbp
+  801021:	48 89 e5             	mov    %rsp,%rbp
+  801024:	48 83 ec 10          	sub    $0x10,%rsp
+  801028:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80102b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80102f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801033:	8b 00                	mov    (%rax),%eax
+  801035:	8d 48 01             	lea    0x1(%rax),%ecx
+  801038:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80103c:	89 0a                	mov    %ecx,(%rdx)
+  80103e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801041:	89 d1                	mov    %edx,%ecx
+  801043:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801047:	48 98                	cltq
+  801049:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80104d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801051:	8b 00                	mov    (%rax),%eax
+  801053:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801058:	75 2c                	jne    801086 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80105a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80105e:	8b 00                	mov    (%rax),%eax
+  801060:	48 98                	cltq
+  801062:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801066:	48 83 c2 08          	add    $0x8,%rdx
+  80106a:	48 89 c6             	mov    %rax,%rsi
+  80106d:	48 89 d7             	mov    %rdx,%rdi
+  801070:	48 b8 8c 2c 80 00 00 	movabs $0x802c8c,%rax
+  801077:	00 00 00 
+  80107a:	ff d0                	call   *%rax
+    b->idx = 0;
+  80107c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801080:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  801086:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80108a:	8b 40 04             	mov    0x4(%rax),%eax
+  80108d:	8d 50 01             	lea    0x1(%rax),%edx
+  801090:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801094:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  801097:	90                   	nop
+  801098:	c9                   	leave
+  801099:	c3                   	ret
+
+000000000080109a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80109a:	55                   	push   %rbp
+  80109b:	48 89 e5             	mov    %rsp,%rbp
+  80109e:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8010a5:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8010ac:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8010b3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8010ba:	00 00 00 
+  b.cnt = 0;
+  8010bd:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8010c4:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8010c7:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8010ce:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8010d5:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8010dc:	48 89 c6             	mov    %rax,%rsi
+  8010df:	48 b8 20 10 80 00 00 	movabs $0x801020,%rax
+  8010e6:	00 00 00 
+  8010e9:	48 89 c7             	mov    %rax,%rdi
+  8010ec:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  8010f3:	00 00 00 
+  8010f6:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8010f8:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8010fe:	48 98                	cltq
+  801100:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  801107:	48 83 c2 08          	add    $0x8,%rdx
+  80110b:	48 89 c6             	mov    %rax,%rsi
+  80110e:	48 89 d7             	mov    %rdx,%rdi
+  801111:	48 b8 8c 2c 80 00 00 	movabs $0x802c8c,%rax
+  801118:	00 00 00 
+  80111b:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80111d:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  801123:	c9                   	leave
+  801124:	c3                   	ret
+
+0000000000801125 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+  801129:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  801130:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801137:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80113e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  801145:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80114c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801153:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80115a:	84 c0                	test   %al,%al
+  80115c:	74 20                	je     80117e <cprintf+0x59>
+  80115e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801162:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801166:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80116a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80116e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801172:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801176:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80117a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80117e:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  801185:	00 00 00 
+  801188:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80118f:	00 00 00 
+  801192:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801196:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80119d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011a4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8011ab:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8011b2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8011b9:	48 89 d6             	mov    %rdx,%rsi
+  8011bc:	48 89 c7             	mov    %rax,%rdi
+  8011bf:	48 b8 9a 10 80 00 00 	movabs $0x80109a,%rax
+  8011c6:	00 00 00 
+  8011c9:	ff d0                	call   *%rax
+  8011cb:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8011d1:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8011d7:	c9                   	leave
+  8011d8:	c3                   	ret
+
+00000000008011d9 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+  8011dd:	48 83 ec 30          	sub    $0x30,%rsp
+  8011e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8011ed:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8011f0:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8011f4:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8011f8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8011fb:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8011ff:	72 54                	jb     801255 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  801201:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801204:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801207:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80120a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801213:	48 f7 f6             	div    %rsi
+  801216:	49 89 c2             	mov    %rax,%r10
+  801219:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80121c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80121f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801223:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801227:	41 89 c9             	mov    %ecx,%r9d
+  80122a:	41 89 f8             	mov    %edi,%r8d
+  80122d:	89 d1                	mov    %edx,%ecx
+  80122f:	4c 89 d2             	mov    %r10,%rdx
+  801232:	48 89 c7             	mov    %rax,%rdi
+  801235:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  80123c:	00 00 00 
+  80123f:	ff d0                	call   *%rax
+  801241:	eb 1c                	jmp    80125f <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  801243:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801247:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80124a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80124e:	48 89 d6             	mov    %rdx,%rsi
+  801251:	89 c7                	mov    %eax,%edi
+  801253:	ff d1                	call   *%rcx
+    while (--width > 0)
+  801255:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  801259:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80125d:	7f e4                	jg     801243 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80125f:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801262:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126b:	48 f7 f1             	div    %rcx
+  80126e:	48 b8 b0 64 80 00 00 	movabs $0x8064b0,%rax
+  801275:	00 00 00 
+  801278:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80127c:	0f be c0             	movsbl %al,%eax
+  80127f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801283:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801287:	48 89 d6             	mov    %rdx,%rsi
+  80128a:	89 c7                	mov    %eax,%edi
+  80128c:	ff d1                	call   *%rcx
+}
+  80128e:	90                   	nop
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+
+0000000000801291 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  801291:	55                   	push   %rbp
+  801292:	48 89 e5             	mov    %rsp,%rbp
+  801295:	48 83 ec 10          	sub    $0x10,%rsp
+  801299:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80129d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8012a0:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8012a4:	7e 4b                	jle    8012f1 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8012a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012aa:	8b 00                	mov    (%rax),%eax
+  8012ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8012af:	77 24                	ja     8012d5 <getuint+0x44>
+  8012b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012bd:	8b 00                	mov    (%rax),%eax
+  8012bf:	89 c0                	mov    %eax,%eax
+  8012c1:	48 01 d0             	add    %rdx,%rax
+  8012c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012c8:	8b 12                	mov    (%rdx),%edx
+  8012ca:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012d1:	89 0a                	mov    %ecx,(%rdx)
+  8012d3:	eb 14                	jmp    8012e9 <getuint+0x58>
+  8012d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012dd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012e5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012e9:	48 8b 00             	mov    (%rax),%rax
+  8012ec:	e9 95 00 00 00       	jmp    801386 <getuint+0xf5>
+  else if (lflag)
+  8012f1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8012f5:	74 48                	je     80133f <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8012f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012fb:	8b 00                	mov    (%rax),%eax
+  8012fd:	83 f8 2f             	cmp    $0x2f,%eax
+  801300:	77 24                	ja     801326 <getuint+0x95>
+  801302:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801306:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80130a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80130e:	8b 00                	mov    (%rax),%eax
+  801310:	89 c0                	mov    %eax,%eax
+  801312:	48 01 d0             	add    %rdx,%rax
+  801315:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801319:	8b 12                	mov    (%rdx),%edx
+  80131b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80131e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801322:	89 0a                	mov    %ecx,(%rdx)
+  801324:	eb 14                	jmp    80133a <getuint+0xa9>
+  801326:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80132a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80132e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801332:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801336:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80133a:	48 8b 00             	mov    (%rax),%rax
+  80133d:	eb 47                	jmp    801386 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80133f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801343:	8b 00                	mov    (%rax),%eax
+  801345:	83 f8 2f             	cmp    $0x2f,%eax
+  801348:	77 24                	ja     80136e <getuint+0xdd>
+  80134a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80134e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801352:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801356:	8b 00                	mov    (%rax),%eax
+  801358:	89 c0                	mov    %eax,%eax
+  80135a:	48 01 d0             	add    %rdx,%rax
+  80135d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801361:	8b 12                	mov    (%rdx),%edx
+  801363:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801366:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80136a:	89 0a                	mov    %ecx,(%rdx)
+  80136c:	eb 14                	jmp    801382 <getuint+0xf1>
+  80136e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801372:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801376:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80137a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80137e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801382:	8b 00                	mov    (%rax),%eax
+  801384:	89 c0                	mov    %eax,%eax
+}
+  801386:	c9                   	leave
+  801387:	c3                   	ret
+
+0000000000801388 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  801388:	55                   	push   %rbp
+  801389:	48 89 e5             	mov    %rsp,%rbp
+  80138c:	48 83 ec 10          	sub    $0x10,%rsp
+  801390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801394:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  801397:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80139b:	7e 4b                	jle    8013e8 <getint+0x60>
+    return va_arg(*ap, long long);
+  80139d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a1:	8b 00                	mov    (%rax),%eax
+  8013a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8013a6:	77 24                	ja     8013cc <getint+0x44>
+  8013a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b4:	8b 00                	mov    (%rax),%eax
+  8013b6:	89 c0                	mov    %eax,%eax
+  8013b8:	48 01 d0             	add    %rdx,%rax
+  8013bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013bf:	8b 12                	mov    (%rdx),%edx
+  8013c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013c8:	89 0a                	mov    %ecx,(%rdx)
+  8013ca:	eb 14                	jmp    8013e0 <getint+0x58>
+  8013cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013e0:	48 8b 00             	mov    (%rax),%rax
+  8013e3:	e9 95 00 00 00       	jmp    80147d <getint+0xf5>
+  else if (lflag)
+  8013e8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8013ec:	74 48                	je     801436 <getint+0xae>
+    return va_arg(*ap, long);
+  8013ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f2:	8b 00                	mov    (%rax),%eax
+  8013f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f7:	77 24                	ja     80141d <getint+0x95>
+  8013f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013fd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801405:	8b 00                	mov    (%rax),%eax
+  801407:	89 c0                	mov    %eax,%eax
+  801409:	48 01 d0             	add    %rdx,%rax
+  80140c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801410:	8b 12                	mov    (%rdx),%edx
+  801412:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801415:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801419:	89 0a                	mov    %ecx,(%rdx)
+  80141b:	eb 14                	jmp    801431 <getint+0xa9>
+  80141d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801421:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801425:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801429:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80142d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801431:	48 8b 00             	mov    (%rax),%rax
+  801434:	eb 47                	jmp    80147d <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  801436:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80143a:	8b 00                	mov    (%rax),%eax
+  80143c:	83 f8 2f             	cmp    $0x2f,%eax
+  80143f:	77 24                	ja     801465 <getint+0xdd>
+  801441:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801445:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801449:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144d:	8b 00                	mov    (%rax),%eax
+  80144f:	89 c0                	mov    %eax,%eax
+  801451:	48 01 d0             	add    %rdx,%rax
+  801454:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801458:	8b 12                	mov    (%rdx),%edx
+  80145a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80145d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801461:	89 0a                	mov    %ecx,(%rdx)
+  801463:	eb 14                	jmp    801479 <getint+0xf1>
+  801465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801469:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80146d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801471:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801475:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801479:	8b 00                	mov    (%rax),%eax
+  80147b:	48 98                	cltq
+}
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+
+000000000080147f <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80147f:	55                   	push   %rbp
+  801480:	48 89 e5             	mov    %rsp,%rbp
+  801483:	41 54                	push   %r12
+  801485:	53                   	push   %rbx
+  801486:	48 83 ec 60          	sub    $0x60,%rsp
+  80148a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80148e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801492:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801496:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  80149a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80149e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8014a2:	48 8b 06             	mov    (%rsi),%rax
+  8014a5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8014a9:	48 89 01             	mov    %rax,(%rcx)
+  8014ac:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8014b0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8014b4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8014b8:	eb 17                	jmp    8014d1 <vprintfmt+0x52>
+      if (ch == '\0')
+  8014ba:	85 db                	test   %ebx,%ebx
+  8014bc:	0f 84 bf 04 00 00    	je     801981 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8014c2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8014c6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8014ca:	48 89 c6             	mov    %rax,%rsi
+  8014cd:	89 df                	mov    %ebx,%edi
+  8014cf:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8014d1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8014d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014d9:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8014dd:	0f b6 00             	movzbl (%rax),%eax
+  8014e0:	0f b6 d8             	movzbl %al,%ebx
+  8014e3:	83 fb 25             	cmp    $0x25,%ebx
+  8014e6:	75 d2                	jne    8014ba <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8014e8:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8014ec:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8014f3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8014fa:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  801501:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  801508:	eb 04                	jmp    80150e <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  80150a:	90                   	nop
+  80150b:	eb 01                	jmp    80150e <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  80150d:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80150e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801512:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801516:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80151a:	0f b6 00             	movzbl (%rax),%eax
+  80151d:	0f b6 d8             	movzbl %al,%ebx
+  801520:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801523:	83 f8 55             	cmp    $0x55,%eax
+  801526:	0f 87 22 04 00 00    	ja     80194e <vprintfmt+0x4cf>
+  80152c:	89 c0                	mov    %eax,%eax
+  80152e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801535:	00 
+  801536:	48 b8 d8 64 80 00 00 	movabs $0x8064d8,%rax
+  80153d:	00 00 00 
+  801540:	48 01 d0             	add    %rdx,%rax
+  801543:	48 8b 00             	mov    (%rax),%rax
+  801546:	ff e0                	jmp    *%rax
+        padc = '-';
+  801548:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  80154c:	eb c0                	jmp    80150e <vprintfmt+0x8f>
+        padc = '0';
+  80154e:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  801552:	eb ba                	jmp    80150e <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  801554:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  80155b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80155e:	89 d0                	mov    %edx,%eax
+  801560:	c1 e0 02             	shl    $0x2,%eax
+  801563:	01 d0                	add    %edx,%eax
+  801565:	01 c0                	add    %eax,%eax
+  801567:	01 d8                	add    %ebx,%eax
+  801569:	83 e8 30             	sub    $0x30,%eax
+  80156c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80156f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801573:	0f b6 00             	movzbl (%rax),%eax
+  801576:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  801579:	83 fb 2f             	cmp    $0x2f,%ebx
+  80157c:	7e 60                	jle    8015de <vprintfmt+0x15f>
+  80157e:	83 fb 39             	cmp    $0x39,%ebx
+  801581:	7f 5b                	jg     8015de <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  801583:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  801588:	eb d1                	jmp    80155b <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  80158a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80158d:	83 f8 2f             	cmp    $0x2f,%eax
+  801590:	77 17                	ja     8015a9 <vprintfmt+0x12a>
+  801592:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801596:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801599:	89 d2                	mov    %edx,%edx
+  80159b:	48 01 d0             	add    %rdx,%rax
+  80159e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015a1:	83 c2 08             	add    $0x8,%edx
+  8015a4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8015a7:	eb 0c                	jmp    8015b5 <vprintfmt+0x136>
+  8015a9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8015ad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8015b1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8015b5:	8b 00                	mov    (%rax),%eax
+  8015b7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  8015ba:	eb 23                	jmp    8015df <vprintfmt+0x160>
+        if (width < 0)
+  8015bc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8015c0:	0f 89 44 ff ff ff    	jns    80150a <vprintfmt+0x8b>
+          width = 0;
+  8015c6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8015cd:	e9 38 ff ff ff       	jmp    80150a <vprintfmt+0x8b>
+        altflag = 1;
+  8015d2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8015d9:	e9 30 ff ff ff       	jmp    80150e <vprintfmt+0x8f>
+        goto process_precision;
+  8015de:	90                   	nop
+        if (width < 0)
+  8015df:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8015e3:	0f 89 24 ff ff ff    	jns    80150d <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8015e9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8015ec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8015ef:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8015f6:	e9 12 ff ff ff       	jmp    80150d <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8015fb:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8015ff:	e9 0a ff ff ff       	jmp    80150e <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  801604:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801607:	83 f8 2f             	cmp    $0x2f,%eax
+  80160a:	77 17                	ja     801623 <vprintfmt+0x1a4>
+  80160c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801610:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801613:	89 d2                	mov    %edx,%edx
+  801615:	48 01 d0             	add    %rdx,%rax
+  801618:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80161b:	83 c2 08             	add    $0x8,%edx
+  80161e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801621:	eb 0c                	jmp    80162f <vprintfmt+0x1b0>
+  801623:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801627:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80162b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80162f:	8b 00                	mov    (%rax),%eax
+  801631:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801635:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801639:	48 89 d6             	mov    %rdx,%rsi
+  80163c:	89 c7                	mov    %eax,%edi
+  80163e:	ff d1                	call   *%rcx
+        break;
+  801640:	e9 37 03 00 00       	jmp    80197c <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  801645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801648:	83 f8 2f             	cmp    $0x2f,%eax
+  80164b:	77 17                	ja     801664 <vprintfmt+0x1e5>
+  80164d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801651:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801654:	89 d2                	mov    %edx,%edx
+  801656:	48 01 d0             	add    %rdx,%rax
+  801659:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80165c:	83 c2 08             	add    $0x8,%edx
+  80165f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801662:	eb 0c                	jmp    801670 <vprintfmt+0x1f1>
+  801664:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801668:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80166c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801670:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  801672:	85 db                	test   %ebx,%ebx
+  801674:	79 02                	jns    801678 <vprintfmt+0x1f9>
+          err = -err;
+  801676:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801678:	83 fb 15             	cmp    $0x15,%ebx
+  80167b:	7f 16                	jg     801693 <vprintfmt+0x214>
+  80167d:	48 ba 00 64 80 00 00 	movabs $0x806400,%rdx
+  801684:	00 00 00 
+  801687:	48 63 c3             	movslq %ebx,%rax
+  80168a:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80168e:	4d 85 e4             	test   %r12,%r12
+  801691:	75 2e                	jne    8016c1 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  801693:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801697:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80169b:	89 d9                	mov    %ebx,%ecx
+  80169d:	48 ba c1 64 80 00 00 	movabs $0x8064c1,%rdx
+  8016a4:	00 00 00 
+  8016a7:	48 89 c7             	mov    %rax,%rdi
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016af:	49 b8 8b 19 80 00 00 	movabs $0x80198b,%r8
+  8016b6:	00 00 00 
+  8016b9:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  8016bc:	e9 bb 02 00 00       	jmp    80197c <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  8016c1:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8016c5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016c9:	4c 89 e1             	mov    %r12,%rcx
+  8016cc:	48 ba ca 64 80 00 00 	movabs $0x8064ca,%rdx
+  8016d3:	00 00 00 
+  8016d6:	48 89 c7             	mov    %rax,%rdi
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	49 b8 8b 19 80 00 00 	movabs $0x80198b,%r8
+  8016e5:	00 00 00 
+  8016e8:	41 ff d0             	call   *%r8
+        break;
+  8016eb:	e9 8c 02 00 00       	jmp    80197c <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8016f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8016f6:	77 17                	ja     80170f <vprintfmt+0x290>
+  8016f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016fc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8016ff:	89 d2                	mov    %edx,%edx
+  801701:	48 01 d0             	add    %rdx,%rax
+  801704:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801707:	83 c2 08             	add    $0x8,%edx
+  80170a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80170d:	eb 0c                	jmp    80171b <vprintfmt+0x29c>
+  80170f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801713:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801717:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80171b:	4c 8b 20             	mov    (%rax),%r12
+  80171e:	4d 85 e4             	test   %r12,%r12
+  801721:	75 0a                	jne    80172d <vprintfmt+0x2ae>
+          p = "(null)";
+  801723:	49 bc cd 64 80 00 00 	movabs $0x8064cd,%r12
+  80172a:	00 00 00 
+        if (width > 0 && padc != '-')
+  80172d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801731:	7e 78                	jle    8017ab <vprintfmt+0x32c>
+  801733:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801737:	74 72                	je     8017ab <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801739:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80173c:	48 98                	cltq
+  80173e:	48 89 c6             	mov    %rax,%rsi
+  801741:	4c 89 e7             	mov    %r12,%rdi
+  801744:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80174b:	00 00 00 
+  80174e:	ff d0                	call   *%rax
+  801750:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  801753:	eb 17                	jmp    80176c <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  801755:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801759:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80175d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801761:	48 89 d6             	mov    %rdx,%rsi
+  801764:	89 c7                	mov    %eax,%edi
+  801766:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801768:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80176c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801770:	7f e3                	jg     801755 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801772:	eb 37                	jmp    8017ab <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  801774:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801778:	74 1e                	je     801798 <vprintfmt+0x319>
+  80177a:	83 fb 1f             	cmp    $0x1f,%ebx
+  80177d:	7e 05                	jle    801784 <vprintfmt+0x305>
+  80177f:	83 fb 7e             	cmp    $0x7e,%ebx
+  801782:	7e 14                	jle    801798 <vprintfmt+0x319>
+            putch('?', putdat);
+  801784:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801788:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80178c:	48 89 c6             	mov    %rax,%rsi
+  80178f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801794:	ff d2                	call   *%rdx
+  801796:	eb 0f                	jmp    8017a7 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  801798:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80179c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8017a0:	48 89 c6             	mov    %rax,%rsi
+  8017a3:	89 df                	mov    %ebx,%edi
+  8017a5:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8017a7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8017ab:	4c 89 e0             	mov    %r12,%rax
+  8017ae:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8017b2:	0f b6 00             	movzbl (%rax),%eax
+  8017b5:	0f be d8             	movsbl %al,%ebx
+  8017b8:	85 db                	test   %ebx,%ebx
+  8017ba:	74 28                	je     8017e4 <vprintfmt+0x365>
+  8017bc:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8017c0:	78 b2                	js     801774 <vprintfmt+0x2f5>
+  8017c2:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8017c6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8017ca:	79 a8                	jns    801774 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8017cc:	eb 16                	jmp    8017e4 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8017ce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8017d2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8017d6:	48 89 c6             	mov    %rax,%rsi
+  8017d9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8017de:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8017e0:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8017e4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8017e8:	7f e4                	jg     8017ce <vprintfmt+0x34f>
+        break;
+  8017ea:	e9 8d 01 00 00       	jmp    80197c <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8017ef:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8017f2:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8017f6:	89 d6                	mov    %edx,%esi
+  8017f8:	48 89 c7             	mov    %rax,%rdi
+  8017fb:	48 b8 88 13 80 00 00 	movabs $0x801388,%rax
+  801802:	00 00 00 
+  801805:	ff d0                	call   *%rax
+  801807:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  80180b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180f:	48 85 c0             	test   %rax,%rax
+  801812:	79 1d                	jns    801831 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  801814:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801818:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80181c:	48 89 c6             	mov    %rax,%rsi
+  80181f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801824:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  801826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182a:	48 f7 d8             	neg    %rax
+  80182d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  801831:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801838:	e9 d2 00 00 00       	jmp    80190f <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  80183d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801840:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801844:	89 d6                	mov    %edx,%esi
+  801846:	48 89 c7             	mov    %rax,%rdi
+  801849:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  801850:	00 00 00 
+  801853:	ff d0                	call   *%rax
+  801855:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  801859:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801860:	e9 aa 00 00 00       	jmp    80190f <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  801865:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801868:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80186c:	89 d6                	mov    %edx,%esi
+  80186e:	48 89 c7             	mov    %rax,%rdi
+  801871:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  801878:	00 00 00 
+  80187b:	ff d0                	call   *%rax
+  80187d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  801881:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  801888:	e9 82 00 00 00       	jmp    80190f <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  80188d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801891:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801895:	48 89 c6             	mov    %rax,%rsi
+  801898:	bf 30 00 00 00       	mov    $0x30,%edi
+  80189d:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80189f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018a3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018a7:	48 89 c6             	mov    %rax,%rsi
+  8018aa:	bf 78 00 00 00       	mov    $0x78,%edi
+  8018af:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  8018b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8018b7:	77 17                	ja     8018d0 <vprintfmt+0x451>
+  8018b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018bd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8018c0:	89 d2                	mov    %edx,%edx
+  8018c2:	48 01 d0             	add    %rdx,%rax
+  8018c5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8018c8:	83 c2 08             	add    $0x8,%edx
+  8018cb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8018ce:	eb 0c                	jmp    8018dc <vprintfmt+0x45d>
+  8018d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8018d8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8018dc:	48 8b 00             	mov    (%rax),%rax
+  8018df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8018e3:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8018ea:	eb 23                	jmp    80190f <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8018ec:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8018ef:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8018f3:	89 d6                	mov    %edx,%esi
+  8018f5:	48 89 c7             	mov    %rax,%rdi
+  8018f8:	48 b8 91 12 80 00 00 	movabs $0x801291,%rax
+  8018ff:	00 00 00 
+  801902:	ff d0                	call   *%rax
+  801904:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801908:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80190f:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801914:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801917:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80191a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80191e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801922:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801926:	45 89 c1             	mov    %r8d,%r9d
+  801929:	41 89 f8             	mov    %edi,%r8d
+  80192c:	48 89 c7             	mov    %rax,%rdi
+  80192f:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+        break;
+  80193b:	eb 3f                	jmp    80197c <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  80193d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801941:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801945:	48 89 c6             	mov    %rax,%rsi
+  801948:	89 df                	mov    %ebx,%edi
+  80194a:	ff d2                	call   *%rdx
+        break;
+  80194c:	eb 2e                	jmp    80197c <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80194e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801952:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801956:	48 89 c6             	mov    %rax,%rsi
+  801959:	bf 25 00 00 00       	mov    $0x25,%edi
+  80195e:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801960:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801965:	eb 05                	jmp    80196c <vprintfmt+0x4ed>
+  801967:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80196c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801970:	48 83 e8 01          	sub    $0x1,%rax
+  801974:	0f b6 00             	movzbl (%rax),%eax
+  801977:	3c 25                	cmp    $0x25,%al
+  801979:	75 ec                	jne    801967 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  80197b:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80197c:	e9 50 fb ff ff       	jmp    8014d1 <vprintfmt+0x52>
+        return;
+  801981:	90                   	nop
+    }
+  }
+}
+  801982:	48 83 c4 60          	add    $0x60,%rsp
+  801986:	5b                   	pop    %rbx
+  801987:	41 5c                	pop    %r12
+  801989:	5d                   	pop    %rbp
+  80198a:	c3                   	ret
+
+000000000080198b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80198b:	55                   	push   %rbp
+  80198c:	48 89 e5             	mov    %rsp,%rbp
+  80198f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801996:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80199d:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8019a4:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8019ab:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8019b2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8019b9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8019c0:	84 c0                	test   %al,%al
+  8019c2:	74 20                	je     8019e4 <printfmt+0x59>
+  8019c4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8019c8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8019cc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8019d0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8019d4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8019d8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8019dc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8019e0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8019e4:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8019eb:	00 00 00 
+  8019ee:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8019f5:	00 00 00 
+  8019f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019fc:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801a03:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801a0a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801a11:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801a18:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801a1f:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801a26:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801a2d:	48 89 c7             	mov    %rax,%rdi
+  801a30:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801a3c:	90                   	nop
+  801a3d:	c9                   	leave
+  801a3e:	c3                   	ret
+
+0000000000801a3f <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801a3f:	55                   	push   %rbp
+  801a40:	48 89 e5             	mov    %rsp,%rbp
+  801a43:	48 83 ec 10          	sub    $0x10,%rsp
+  801a47:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a4a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801a4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a52:	8b 40 10             	mov    0x10(%rax),%eax
+  801a55:	8d 50 01             	lea    0x1(%rax),%edx
+  801a58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5c:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801a5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a63:	48 8b 10             	mov    (%rax),%rdx
+  801a66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a6e:	48 39 c2             	cmp    %rax,%rdx
+  801a71:	73 17                	jae    801a8a <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801a73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a77:	48 8b 00             	mov    (%rax),%rax
+  801a7a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a7e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a82:	48 89 0a             	mov    %rcx,(%rdx)
+  801a85:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801a88:	88 10                	mov    %dl,(%rax)
+}
+  801a8a:	90                   	nop
+  801a8b:	c9                   	leave
+  801a8c:	c3                   	ret
+
+0000000000801a8d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801a8d:	55                   	push   %rbp
+  801a8e:	48 89 e5             	mov    %rsp,%rbp
+  801a91:	48 83 ec 40          	sub    $0x40,%rsp
+  801a95:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a99:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a9c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801aa0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801aa4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801aac:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801aaf:	48 98                	cltq
+  801ab1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ab5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab9:	48 01 d0             	add    %rdx,%rax
+  801abc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801ac0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801ac7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801acc:	74 06                	je     801ad4 <vsnprintf+0x47>
+  801ace:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801ad2:	7f 07                	jg     801adb <vsnprintf+0x4e>
+    return -E_INVAL;
+  801ad4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad9:	eb 32                	jmp    801b0d <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801adb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801adf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ae3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801ae7:	48 89 c6             	mov    %rax,%rsi
+  801aea:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  801af1:	00 00 00 
+  801af4:	48 89 c7             	mov    %rax,%rdi
+  801af7:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801b03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b07:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801b0a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801b0d:	c9                   	leave
+  801b0e:	c3                   	ret
+
+0000000000801b0f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801b0f:	55                   	push   %rbp
+  801b10:	48 89 e5             	mov    %rsp,%rbp
+  801b13:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801b1a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801b21:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801b27:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801b2e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801b35:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801b3c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801b43:	84 c0                	test   %al,%al
+  801b45:	74 20                	je     801b67 <snprintf+0x58>
+  801b47:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801b4b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801b4f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801b53:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801b57:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801b5b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801b5f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801b63:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801b67:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801b6e:	00 00 00 
+  801b71:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801b78:	00 00 00 
+  801b7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b7f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801b86:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801b8d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801b94:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801b9b:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801ba2:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801ba8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801baf:	48 89 c7             	mov    %rax,%rdi
+  801bb2:	48 b8 8d 1a 80 00 00 	movabs $0x801a8d,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801bc4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801bca:	c9                   	leave
+  801bcb:	c3                   	ret
+
+0000000000801bcc <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801bcc:	55                   	push   %rbp
+  801bcd:	48 89 e5             	mov    %rsp,%rbp
+  801bd0:	53                   	push   %rbx
+  801bd1:	48 83 ec 38          	sub    $0x38,%rsp
+  801bd5:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801bd8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801bdc:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801be0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801be4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801be8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf0:	89 d1                	mov    %edx,%ecx
+  801bf2:	0f a2                	cpuid
+  801bf4:	89 de                	mov    %ebx,%esi
+  801bf6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801bf9:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801bfc:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801bff:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801c02:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c07:	74 09                	je     801c12 <cpuid+0x46>
+}
+  801c09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801c10:	89 10                	mov    %edx,(%rax)
+
+  801c12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801c17:	74 09                	je     801c22 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801c19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c1d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801c20:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801c22:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c27:	74 09                	je     801c32 <cpuid+0x66>
+char *
+  801c29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801c30:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801c32:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801c37:	74 09                	je     801c42 <cpuid+0x76>
+  for (; *s; s++)
+  801c39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c3d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801c40:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801c42:	90                   	nop
+  801c43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+
+0000000000801c49 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801c49:	55                   	push   %rbp
+  801c4a:	48 89 e5             	mov    %rsp,%rbp
+  801c4d:	48 83 ec 18          	sub    $0x18,%rsp
+  801c51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c57:	89 c1                	mov    %eax,%ecx
+  801c59:	0f 01 d0             	xgetbv
+  801c5c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801c5f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801c62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c65:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801c68:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c6c:	48 09 d0             	or     %rdx,%rax
+#else
+  801c6f:	c9                   	leave
+  801c70:	c3                   	ret
+
+0000000000801c71 <string_cpu>:
+string_cpu(void) {
+  801c71:	55                   	push   %rbp
+  801c72:	48 89 e5             	mov    %rsp,%rbp
+  801c75:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801c79:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801c80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801c87:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801c8e:	00 00 00 
+  801c91:	8b 00                	mov    (%rax),%eax
+  801c93:	85 c0                	test   %eax,%eax
+  801c95:	78 11                	js     801ca8 <string_cpu+0x37>
+    return string_features;
+  801c97:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801c9e:	00 00 00 
+  801ca1:	8b 00                	mov    (%rax),%eax
+  801ca3:	e9 df 00 00 00       	jmp    801d87 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801ca8:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801cac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbc:	48 89 c6             	mov    %rax,%rsi
+  801cbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc4:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801ccb:	00 00 00 
+  801cce:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801cd0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801cd3:	83 f8 06             	cmp    $0x6,%eax
+  801cd6:	76 28                	jbe    801d00 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801cd8:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801cdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ce7:	48 89 c2             	mov    %rax,%rdx
+  801cea:	be 00 00 00 00       	mov    $0x0,%esi
+  801cef:	bf 07 00 00 00       	mov    $0x7,%edi
+  801cf4:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801cfb:	00 00 00 
+  801cfe:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801d00:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d03:	25 00 02 00 00       	and    $0x200,%eax
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	74 04                	je     801d10 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801d0c:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801d10:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801d14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d1a:	48 89 c1             	mov    %rax,%rcx
+  801d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d22:	be 00 00 00 00       	mov    $0x0,%esi
+  801d27:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d2c:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801d38:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d3b:	83 e0 20             	and    $0x20,%eax
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	74 2a                	je     801d6c <string_cpu+0xfb>
+  801d42:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801d45:	25 00 00 00 08       	and    $0x8000000,%eax
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	74 1e                	je     801d6c <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d53:	48 b8 49 1c 80 00 00 	movabs $0x801c49,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+  801d5f:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801d62:	48 83 f8 06          	cmp    $0x6,%rax
+  801d66:	75 04                	jne    801d6c <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801d68:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801d6c:	48 ba 10 70 80 00 00 	movabs $0x807010,%rdx
+  801d73:	00 00 00 
+  801d76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d79:	89 02                	mov    %eax,(%rdx)
+  801d7b:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  801d82:	00 00 00 
+  801d85:	8b 00                	mov    (%rax),%eax
+}
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+0000000000801d89 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801d89:	55                   	push   %rbp
+  801d8a:	48 89 e5             	mov    %rsp,%rbp
+  801d8d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801d91:	48 83 ec 60          	sub    $0x60,%rsp
+  801d95:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801d9a:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801d9f:	83 e0 1f             	and    $0x1f,%eax
+  801da2:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801da6:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801daa:	48 f7 d8             	neg    %rax
+  801dad:	48 89 c2             	mov    %rax,%rdx
+  801db0:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801db5:	48 01 d0             	add    %rdx,%rax
+  801db8:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801dbd:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801dc1:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801dc7:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801dcc:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801dd0:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801dd6:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801dda:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801dde:	89 c2                	mov    %eax,%edx
+  801de0:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801de4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801de9:	89 c1                	mov    %eax,%ecx
+  801deb:	d3 e6                	shl    %cl,%esi
+  801ded:	89 f0                	mov    %esi,%eax
+  801def:	21 d0                	and    %edx,%eax
+  801df1:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801df5:	eb 21                	jmp    801e18 <strlen_avx2+0x8f>
+    p += 32;
+  801df7:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801dfd:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801e02:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801e06:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801e0c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801e10:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801e14:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801e18:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801e1d:	74 d8                	je     801df7 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801e1f:	31 c0                	xor    %eax,%eax
+  801e21:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801e27:	48 63 d0             	movslq %eax,%rdx
+  801e2a:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801e2f:	48 01 d0             	add    %rdx,%rax
+  801e32:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801e37:	c9                   	leave
+  801e38:	c3                   	ret
+
+0000000000801e39 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801e39:	55                   	push   %rbp
+  801e3a:	48 89 e5             	mov    %rsp,%rbp
+  801e3d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801e41:	48 83 ec 40          	sub    $0x40,%rsp
+  801e45:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801e4a:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801e4f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801e54:	eb 77                	jmp    801ecd <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801e56:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e5b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801e5f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801e63:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801e68:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801e6c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801e70:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801e74:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801e78:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801e7d:	74 3c                	je     801ebb <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801e7f:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801e83:	f7 d0                	not    %eax
+  801e85:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801e89:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801e8d:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801e91:	48 63 d0             	movslq %eax,%rdx
+  801e94:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e99:	48 01 d0             	add    %rdx,%rax
+  801e9c:	0f b6 00             	movzbl (%rax),%eax
+  801e9f:	0f b6 c0             	movzbl %al,%eax
+  801ea2:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801ea6:	48 63 ca             	movslq %edx,%rcx
+  801ea9:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801eae:	48 01 ca             	add    %rcx,%rdx
+  801eb1:	0f b6 12             	movzbl (%rdx),%edx
+  801eb4:	0f b6 d2             	movzbl %dl,%edx
+  801eb7:	29 d0                	sub    %edx,%eax
+  801eb9:	eb 6b                	jmp    801f26 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801ebb:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801ec1:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801ec7:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801ecd:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801ed3:	77 81                	ja     801e56 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801ed5:	eb 42                	jmp    801f19 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801ed7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801edc:	0f b6 10             	movzbl (%rax),%edx
+  801edf:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801ee4:	0f b6 00             	movzbl (%rax),%eax
+  801ee7:	38 c2                	cmp    %al,%dl
+  801ee9:	74 1c                	je     801f07 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801eeb:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801ef0:	0f b6 00             	movzbl (%rax),%eax
+  801ef3:	0f b6 c8             	movzbl %al,%ecx
+  801ef6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801efb:	0f b6 00             	movzbl (%rax),%eax
+  801efe:	0f b6 d0             	movzbl %al,%edx
+  801f01:	89 c8                	mov    %ecx,%eax
+  801f03:	29 d0                	sub    %edx,%eax
+  801f05:	eb 1f                	jmp    801f26 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801f07:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801f0d:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801f13:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801f19:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801f1f:	75 b6                	jne    801ed7 <memcmp_avx2+0x9e>
+  return 0;
+  801f21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+0000000000801f28 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801f28:	55                   	push   %rbp
+  801f29:	48 89 e5             	mov    %rsp,%rbp
+  801f2c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801f30:	48 83 ec 60          	sub    $0x60,%rsp
+  801f34:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801f39:	89 f0                	mov    %esi,%eax
+  801f3b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801f40:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801f44:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801f49:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801f4d:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801f52:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801f58:	eb 47                	jmp    801fa1 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801f5a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f5f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801f63:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801f67:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801f6d:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801f71:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801f75:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801f79:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801f7e:	74 15                	je     801f95 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801f80:	31 c0                	xor    %eax,%eax
+  801f82:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801f88:	48 63 d0             	movslq %eax,%rdx
+  801f8b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f90:	48 01 d0             	add    %rdx,%rax
+  801f93:	eb 3d                	jmp    801fd2 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801f95:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801f9b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801fa1:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801fa7:	77 b1                	ja     801f5a <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801fa9:	eb 0c                	jmp    801fb7 <memfind_avx2+0x8f>
+  801fab:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801fb1:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801fb7:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801fbd:	74 0e                	je     801fcd <memfind_avx2+0xa5>
+  801fbf:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801fc4:	0f b6 00             	movzbl (%rax),%eax
+  801fc7:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801fcb:	75 de                	jne    801fab <memfind_avx2+0x83>
+  return s;
+  801fcd:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801fd2:	c9                   	leave
+  801fd3:	c3                   	ret
+
+0000000000801fd4 <strlen>:
+strlen(const char *s) {
+  801fd4:	55                   	push   %rbp
+  801fd5:	48 89 e5             	mov    %rsp,%rbp
+  801fd8:	48 83 ec 40          	sub    $0x40,%rsp
+  801fdc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801fe0:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801fe4:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801fe8:	48 b8 71 1c 80 00 00 	movabs $0x801c71,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+  801ff4:	83 e0 02             	and    $0x2,%eax
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	74 18                	je     802013 <strlen+0x3f>
+    return strlen_avx2(s);
+  801ffb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fff:	48 89 c7             	mov    %rax,%rdi
+  802002:	48 b8 89 1d 80 00 00 	movabs $0x801d89,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+  80200e:	e9 82 00 00 00       	jmp    802095 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  802013:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802017:	83 e0 0f             	and    $0xf,%eax
+  80201a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80201d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802020:	48 f7 d8             	neg    %rax
+  802023:	48 89 c2             	mov    %rax,%rdx
+  802026:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80202a:	48 01 d0             	add    %rdx,%rax
+  80202d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  802031:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802035:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802039:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80203e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802042:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802046:	89 c2                	mov    %eax,%edx
+  802048:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80204b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  802050:	89 c1                	mov    %eax,%ecx
+  802052:	d3 e6                	shl    %cl,%esi
+  802054:	89 f0                	mov    %esi,%eax
+  802056:	21 d0                	and    %edx,%eax
+  802058:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80205b:	eb 1d                	jmp    80207a <strlen+0xa6>
+    p += 16;
+  80205d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  802062:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802066:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80206a:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80206f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802073:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802077:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80207a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80207e:	74 dd                	je     80205d <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  802080:	31 c0                	xor    %eax,%eax
+  802082:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  802087:	48 63 d0             	movslq %eax,%rdx
+  80208a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80208e:	48 01 d0             	add    %rdx,%rax
+  802091:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+
+0000000000802097 <strnlen>:
+strnlen(const char *s, size_t size) {
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	48 83 ec 20          	sub    $0x20,%rsp
+  80209f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8020a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8020ae:	eb 0e                	jmp    8020be <strnlen+0x27>
+    n++;
+  8020b0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8020b4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8020b9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8020be:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8020c3:	74 0b                	je     8020d0 <strnlen+0x39>
+  8020c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020c9:	0f b6 00             	movzbl (%rax),%eax
+  8020cc:	84 c0                	test   %al,%al
+  8020ce:	75 e0                	jne    8020b0 <strnlen+0x19>
+  return n;
+  8020d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+00000000008020d5 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8020d5:	55                   	push   %rbp
+  8020d6:	48 89 e5             	mov    %rsp,%rbp
+  8020d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8020dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8020e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8020ed:	90                   	nop
+  8020ee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8020f2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8020f6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8020fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020fe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802102:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802106:	0f b6 12             	movzbl (%rdx),%edx
+  802109:	88 10                	mov    %dl,(%rax)
+  80210b:	0f b6 00             	movzbl (%rax),%eax
+  80210e:	84 c0                	test   %al,%al
+  802110:	75 dc                	jne    8020ee <strcpy+0x19>
+  return ret;
+  802112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802116:	c9                   	leave
+  802117:	c3                   	ret
+
+0000000000802118 <strcat>:
+strcat(char *dst, const char *src) {
+  802118:	55                   	push   %rbp
+  802119:	48 89 e5             	mov    %rsp,%rbp
+  80211c:	48 83 ec 20          	sub    $0x20,%rsp
+  802120:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802124:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  802128:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80212c:	48 89 c7             	mov    %rax,%rdi
+  80212f:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802136:	00 00 00 
+  802139:	ff d0                	call   *%rax
+  80213b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80213e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802141:	48 63 d0             	movslq %eax,%rdx
+  802144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802148:	48 01 c2             	add    %rax,%rdx
+  80214b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80214f:	48 89 c6             	mov    %rax,%rsi
+  802152:	48 89 d7             	mov    %rdx,%rdi
+  802155:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+  return dst;
+  802161:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802165:	c9                   	leave
+  802166:	c3                   	ret
+
+0000000000802167 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  802167:	55                   	push   %rbp
+  802168:	48 89 e5             	mov    %rsp,%rbp
+  80216b:	48 83 ec 28          	sub    $0x28,%rsp
+  80216f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802173:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802177:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80217b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80217f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  802183:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80218a:	00 
+  80218b:	eb 2a                	jmp    8021b7 <strncpy+0x50>
+    *dst++ = *src;
+  80218d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802191:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802195:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802199:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80219d:	0f b6 12             	movzbl (%rdx),%edx
+  8021a0:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8021a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021a6:	0f b6 00             	movzbl (%rax),%eax
+  8021a9:	84 c0                	test   %al,%al
+  8021ab:	74 05                	je     8021b2 <strncpy+0x4b>
+      src++;
+  8021ad:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8021b2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8021b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021bb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8021bf:	72 cc                	jb     80218d <strncpy+0x26>
+  return ret;
+  8021c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8021c5:	c9                   	leave
+  8021c6:	c3                   	ret
+
+00000000008021c7 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+  8021cb:	48 83 ec 28          	sub    $0x28,%rsp
+  8021cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021d3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021d7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8021db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8021e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8021e8:	74 3d                	je     802227 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8021ea:	eb 1d                	jmp    802209 <strlcpy+0x42>
+      *dst++ = *src++;
+  8021ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8021f0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8021f4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8021f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802200:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802204:	0f b6 12             	movzbl (%rdx),%edx
+  802207:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  802209:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80220e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802213:	74 0b                	je     802220 <strlcpy+0x59>
+  802215:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802219:	0f b6 00             	movzbl (%rax),%eax
+  80221c:	84 c0                	test   %al,%al
+  80221e:	75 cc                	jne    8021ec <strlcpy+0x25>
+    *dst = '\0';
+  802220:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802224:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  802227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80222b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80222f:	c9                   	leave
+  802230:	c3                   	ret
+
+0000000000802231 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	48 83 ec 30          	sub    $0x30,%rsp
+  802239:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80223d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802241:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  802245:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802249:	48 89 c7             	mov    %rax,%rdi
+  80224c:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+  802258:	48 98                	cltq
+  80225a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80225e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802262:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802266:	48 89 d6             	mov    %rdx,%rsi
+  802269:	48 89 c7             	mov    %rax,%rdi
+  80226c:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802273:	00 00 00 
+  802276:	ff d0                	call   *%rax
+  802278:	48 98                	cltq
+  80227a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80227e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802282:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802286:	75 10                	jne    802298 <strlcat+0x67>
+    return maxlen + srclen;
+  802288:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80228c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802290:	48 01 d0             	add    %rdx,%rax
+  802293:	e9 86 00 00 00       	jmp    80231e <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  802298:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80229c:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8022a0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8022a4:	73 2b                	jae    8022d1 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8022a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8022ae:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8022b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022b6:	48 01 c1             	add    %rax,%rcx
+  8022b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022bd:	48 89 c6             	mov    %rax,%rsi
+  8022c0:	48 89 cf             	mov    %rcx,%rdi
+  8022c3:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+  8022cf:	eb 42                	jmp    802313 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8022d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022d9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8022dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022e1:	48 01 c1             	add    %rax,%rcx
+  8022e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022e8:	48 89 c6             	mov    %rax,%rsi
+  8022eb:	48 89 cf             	mov    %rcx,%rdi
+  8022ee:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  8022f5:	00 00 00 
+  8022f8:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8022fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802302:	48 01 d0             	add    %rdx,%rax
+  802305:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80230d:	48 01 d0             	add    %rdx,%rax
+  802310:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  802313:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802317:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231b:	48 01 d0             	add    %rdx,%rax
+}
+  80231e:	c9                   	leave
+  80231f:	c3                   	ret
+
+0000000000802320 <strcmp>:
+strcmp(const char *p, const char *q) {
+  802320:	55                   	push   %rbp
+  802321:	48 89 e5             	mov    %rsp,%rbp
+  802324:	48 83 ec 10          	sub    $0x10,%rsp
+  802328:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80232c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  802330:	eb 0a                	jmp    80233c <strcmp+0x1c>
+    p++, q++;
+  802332:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802337:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80233c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802340:	0f b6 00             	movzbl (%rax),%eax
+  802343:	84 c0                	test   %al,%al
+  802345:	74 12                	je     802359 <strcmp+0x39>
+  802347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80234b:	0f b6 10             	movzbl (%rax),%edx
+  80234e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802352:	0f b6 00             	movzbl (%rax),%eax
+  802355:	38 c2                	cmp    %al,%dl
+  802357:	74 d9                	je     802332 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802359:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80235d:	0f b6 00             	movzbl (%rax),%eax
+  802360:	0f b6 d0             	movzbl %al,%edx
+  802363:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802367:	0f b6 00             	movzbl (%rax),%eax
+  80236a:	0f b6 c0             	movzbl %al,%eax
+  80236d:	29 c2                	sub    %eax,%edx
+  80236f:	89 d0                	mov    %edx,%eax
+}
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+0000000000802373 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  802373:	55                   	push   %rbp
+  802374:	48 89 e5             	mov    %rsp,%rbp
+  802377:	48 83 ec 18          	sub    $0x18,%rsp
+  80237b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80237f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802383:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  802387:	eb 0f                	jmp    802398 <strncmp+0x25>
+    n--, p++, q++;
+  802389:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80238e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802393:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  802398:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80239d:	74 1d                	je     8023bc <strncmp+0x49>
+  80239f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a3:	0f b6 00             	movzbl (%rax),%eax
+  8023a6:	84 c0                	test   %al,%al
+  8023a8:	74 12                	je     8023bc <strncmp+0x49>
+  8023aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ae:	0f b6 10             	movzbl (%rax),%edx
+  8023b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023b5:	0f b6 00             	movzbl (%rax),%eax
+  8023b8:	38 c2                	cmp    %al,%dl
+  8023ba:	74 cd                	je     802389 <strncmp+0x16>
+  if (n == 0)
+  8023bc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8023c1:	75 07                	jne    8023ca <strncmp+0x57>
+    return 0;
+  8023c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c8:	eb 16                	jmp    8023e0 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8023ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023ce:	0f b6 00             	movzbl (%rax),%eax
+  8023d1:	0f b6 d0             	movzbl %al,%edx
+  8023d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023d8:	0f b6 00             	movzbl (%rax),%eax
+  8023db:	0f b6 c0             	movzbl %al,%eax
+  8023de:	29 c2                	sub    %eax,%edx
+}
+  8023e0:	89 d0                	mov    %edx,%eax
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+
+00000000008023e4 <strchr>:
+strchr(const char *s, char c) {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	48 83 ec 60          	sub    $0x60,%rsp
+  8023ec:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8023f0:	89 f0                	mov    %esi,%eax
+  8023f2:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8023f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023f9:	83 e0 0f             	and    $0xf,%eax
+  8023fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8023ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802402:	48 f7 d8             	neg    %rax
+  802405:	48 89 c2             	mov    %rax,%rdx
+  802408:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80240c:	48 01 d0             	add    %rdx,%rax
+  80240f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  802413:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  802417:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80241b:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80241f:	66 0f 6e c0          	movd   %eax,%xmm0
+  802423:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  802427:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80242b:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802430:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  802434:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802438:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80243c:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  802440:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802445:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80244a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80244e:	89 c2                	mov    %eax,%edx
+  802450:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802455:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80245a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80245e:	09 c2                	or     %eax,%edx
+  802460:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802463:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  802468:	89 c1                	mov    %eax,%ecx
+  80246a:	d3 e6                	shl    %cl,%esi
+  80246c:	89 f0                	mov    %esi,%eax
+  80246e:	21 d0                	and    %edx,%eax
+  802470:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802473:	eb 34                	jmp    8024a9 <strchr+0xc5>
+    p += 16;
+  802475:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  80247a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80247e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802482:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  802486:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80248b:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  802490:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802494:	89 c2                	mov    %eax,%edx
+  802496:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80249b:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8024a0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8024a4:	09 d0                	or     %edx,%eax
+  8024a6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8024a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024ad:	74 c6                	je     802475 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8024af:	31 c0                	xor    %eax,%eax
+  8024b1:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8024b6:	48 98                	cltq
+  8024b8:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8024bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024c0:	0f b6 00             	movzbl (%rax),%eax
+  8024c3:	84 c0                	test   %al,%al
+  8024c5:	74 06                	je     8024cd <strchr+0xe9>
+  8024c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024cb:	eb 05                	jmp    8024d2 <strchr+0xee>
+  8024cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d2:	c9                   	leave
+  8024d3:	c3                   	ret
+
+00000000008024d4 <strfind>:
+strfind(const char *s, char c) {
+  8024d4:	55                   	push   %rbp
+  8024d5:	48 89 e5             	mov    %rsp,%rbp
+  8024d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8024dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024e0:	89 f0                	mov    %esi,%eax
+  8024e2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8024e5:	eb 11                	jmp    8024f8 <strfind+0x24>
+    if (*s == c)
+  8024e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024eb:	0f b6 00             	movzbl (%rax),%eax
+  8024ee:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8024f1:	74 12                	je     802505 <strfind+0x31>
+  for (; *s; s++)
+  8024f3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8024f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024fc:	0f b6 00             	movzbl (%rax),%eax
+  8024ff:	84 c0                	test   %al,%al
+  802501:	75 e4                	jne    8024e7 <strfind+0x13>
+  802503:	eb 01                	jmp    802506 <strfind+0x32>
+      break;
+  802505:	90                   	nop
+  return (char *)s;
+  802506:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+000000000080250c <memset>:
+memset(void *v, int c, size_t n) {
+  80250c:	55                   	push   %rbp
+  80250d:	48 89 e5             	mov    %rsp,%rbp
+  802510:	48 83 ec 38          	sub    $0x38,%rsp
+  802514:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802518:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80251b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80251f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802523:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802527:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  80252c:	76 41                	jbe    80256f <memset+0x63>
+  80252e:	48 b8 71 1c 80 00 00 	movabs $0x801c71,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+  80253a:	83 e0 01             	and    $0x1,%eax
+  80253d:	85 c0                	test   %eax,%eax
+  80253f:	74 2e                	je     80256f <memset+0x63>
+    asm volatile("cld; rep stosb"
+  802541:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802544:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802548:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80254c:	48 89 ce             	mov    %rcx,%rsi
+  80254f:	48 89 f7             	mov    %rsi,%rdi
+  802552:	48 89 d1             	mov    %rdx,%rcx
+  802555:	fc                   	cld
+  802556:	f3 aa                	rep stos %al,%es:(%rdi)
+  802558:	48 89 ca             	mov    %rcx,%rdx
+  80255b:	48 89 fe             	mov    %rdi,%rsi
+  80255e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  802562:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  802566:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80256a:	e9 a7 00 00 00       	jmp    802616 <memset+0x10a>
+  if (n >= 8) {
+  80256f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802574:	0f 86 87 00 00 00    	jbe    802601 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  80257a:	eb 16                	jmp    802592 <memset+0x86>
+      *p++ = c;
+  80257c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802580:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802584:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802588:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80258b:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80258d:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802596:	83 e0 07             	and    $0x7,%eax
+  802599:	48 85 c0             	test   %rax,%rax
+  80259c:	75 de                	jne    80257c <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80259e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8025a1:	0f b6 c0             	movzbl %al,%eax
+  8025a4:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  8025ab:	01 01 01 
+  8025ae:	48 0f af c2          	imul   %rdx,%rax
+  8025b2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  8025b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025ba:	48 c1 e8 03          	shr    $0x3,%rax
+  8025be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  8025c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025c6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8025ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8025ce:	48 89 ce             	mov    %rcx,%rsi
+  8025d1:	48 89 f7             	mov    %rsi,%rdi
+  8025d4:	48 89 d1             	mov    %rdx,%rcx
+  8025d7:	fc                   	cld
+  8025d8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8025db:	48 89 ca             	mov    %rcx,%rdx
+  8025de:	48 89 fe             	mov    %rdi,%rsi
+  8025e1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8025e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8025e9:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8025ee:	eb 11                	jmp    802601 <memset+0xf5>
+    *p++ = c;
+  8025f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025f4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8025f8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8025fc:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8025ff:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  802601:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802605:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802609:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80260d:	48 85 c0             	test   %rax,%rax
+  802610:	75 de                	jne    8025f0 <memset+0xe4>
+  return v;
+  802612:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+0000000000802618 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  802618:	55                   	push   %rbp
+  802619:	48 89 e5             	mov    %rsp,%rbp
+  80261c:	48 83 ec 38          	sub    $0x38,%rsp
+  802620:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802624:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802628:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  80262c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802630:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  802634:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802638:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  80263c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802640:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802644:	0f 83 da 00 00 00    	jae    802724 <memmove+0x10c>
+  80264a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80264e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802652:	48 01 d0             	add    %rdx,%rax
+  802655:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802659:	0f 83 c5 00 00 00    	jae    802724 <memmove+0x10c>
+    s += n;
+  80265f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802663:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  802667:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80266b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80266f:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802674:	0f 86 94 00 00 00    	jbe    80270e <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  80267a:	eb 1c                	jmp    802698 <memmove+0x80>
+        *--d = *--s;
+  80267c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802681:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  802686:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80268a:	0f b6 10             	movzbl (%rax),%edx
+  80268d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802691:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  802693:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802698:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80269c:	83 e0 07             	and    $0x7,%eax
+  80269f:	48 85 c0             	test   %rax,%rax
+  8026a2:	75 d8                	jne    80267c <memmove+0x64>
+      nq = n / 8;
+  8026a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026a8:	48 c1 e8 03          	shr    $0x3,%rax
+  8026ac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8026b0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  8026b5:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  8026ba:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  8026bf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026cb:	48 89 cf             	mov    %rcx,%rdi
+  8026ce:	48 89 d6             	mov    %rdx,%rsi
+  8026d1:	48 89 c1             	mov    %rax,%rcx
+  8026d4:	fd                   	std
+  8026d5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8026d8:	fc                   	cld
+  8026d9:	48 89 c8             	mov    %rcx,%rax
+  8026dc:	48 89 f2             	mov    %rsi,%rdx
+  8026df:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8026e3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8026e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8026eb:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8026f0:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8026f5:	eb 17                	jmp    80270e <memmove+0xf6>
+      *--d = *--s;
+  8026f7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8026fc:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  802701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802705:	0f b6 10             	movzbl (%rax),%edx
+  802708:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80270c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  80270e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802712:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802716:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80271a:	48 85 c0             	test   %rax,%rax
+  80271d:	75 d8                	jne    8026f7 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  80271f:	e9 f4 00 00 00       	jmp    802818 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802724:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802729:	76 46                	jbe    802771 <memmove+0x159>
+  80272b:	48 b8 71 1c 80 00 00 	movabs $0x801c71,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+  802737:	83 e0 01             	and    $0x1,%eax
+  80273a:	85 c0                	test   %eax,%eax
+  80273c:	74 33                	je     802771 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80273e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802742:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802746:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80274a:	48 89 cf             	mov    %rcx,%rdi
+  80274d:	48 89 d6             	mov    %rdx,%rsi
+  802750:	48 89 c1             	mov    %rax,%rcx
+  802753:	fc                   	cld
+  802754:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802756:	48 89 c8             	mov    %rcx,%rax
+  802759:	48 89 f2             	mov    %rsi,%rdx
+  80275c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802760:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802764:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  802768:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80276c:	e9 ab 00 00 00       	jmp    80281c <memmove+0x204>
+    if (n >= 8) {
+  802771:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802776:	0f 86 8b 00 00 00    	jbe    802807 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  80277c:	eb 22                	jmp    8027a0 <memmove+0x188>
+        *d++ = *s++;
+  80277e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802782:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802786:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80278a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80278e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802792:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802796:	0f b6 12             	movzbl (%rdx),%edx
+  802799:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80279b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8027a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a4:	83 e0 07             	and    $0x7,%eax
+  8027a7:	48 85 c0             	test   %rax,%rax
+  8027aa:	75 d2                	jne    80277e <memmove+0x166>
+      nq = n / 8;
+  8027ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b0:	48 c1 e8 03          	shr    $0x3,%rax
+  8027b4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  8027b8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c4:	48 89 cf             	mov    %rcx,%rdi
+  8027c7:	48 89 d6             	mov    %rdx,%rsi
+  8027ca:	48 89 c1             	mov    %rax,%rcx
+  8027cd:	fc                   	cld
+  8027ce:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8027d1:	48 89 c8             	mov    %rcx,%rax
+  8027d4:	48 89 f2             	mov    %rsi,%rdx
+  8027d7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8027db:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8027df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8027e3:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8027e8:	eb 1d                	jmp    802807 <memmove+0x1ef>
+      *d++ = *s++;
+  8027ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027ee:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8027f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8027f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027fa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8027fe:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802802:	0f b6 12             	movzbl (%rdx),%edx
+  802805:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  802807:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80280b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80280f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802813:	48 85 c0             	test   %rax,%rax
+  802816:	75 d2                	jne    8027ea <memmove+0x1d2>
+  return dst;
+  802818:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  80281c:	c9                   	leave
+  80281d:	c3                   	ret
+
+000000000080281e <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80281e:	55                   	push   %rbp
+  80281f:	48 89 e5             	mov    %rsp,%rbp
+  802822:	48 83 ec 18          	sub    $0x18,%rsp
+  802826:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80282a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80282e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  802832:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802836:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80283a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283e:	48 89 ce             	mov    %rcx,%rsi
+  802841:	48 89 c7             	mov    %rax,%rdi
+  802844:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  80284b:	00 00 00 
+  80284e:	ff d0                	call   *%rax
+}
+  802850:	c9                   	leave
+  802851:	c3                   	ret
+
+0000000000802852 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  802852:	55                   	push   %rbp
+  802853:	48 89 e5             	mov    %rsp,%rbp
+  802856:	48 83 ec 40          	sub    $0x40,%rsp
+  80285a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80285e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802862:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  802866:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80286a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80286e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802872:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802876:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  80287b:	0f 86 a7 00 00 00    	jbe    802928 <memcmp+0xd6>
+  802881:	48 b8 71 1c 80 00 00 	movabs $0x801c71,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+  80288d:	83 e0 02             	and    $0x2,%eax
+  802890:	85 c0                	test   %eax,%eax
+  802892:	0f 84 90 00 00 00    	je     802928 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  802898:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80289c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028a4:	48 89 ce             	mov    %rcx,%rsi
+  8028a7:	48 89 c7             	mov    %rax,%rdi
+  8028aa:	48 b8 39 1e 80 00 00 	movabs $0x801e39,%rax
+  8028b1:	00 00 00 
+  8028b4:	ff d0                	call   *%rax
+  8028b6:	e9 c2 00 00 00       	jmp    80297d <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  8028bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028bf:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8028c3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8028c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028cb:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8028cf:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8028d3:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8028d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8028da:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8028e1:	74 36                	je     802919 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8028e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028e6:	f7 d0                	not    %eax
+  8028e8:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8028ec:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8028ef:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8028f2:	48 63 d0             	movslq %eax,%rdx
+  8028f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028f9:	48 01 d0             	add    %rdx,%rax
+  8028fc:	0f b6 00             	movzbl (%rax),%eax
+  8028ff:	0f b6 c0             	movzbl %al,%eax
+  802902:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802905:	48 63 ca             	movslq %edx,%rcx
+  802908:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80290c:	48 01 ca             	add    %rcx,%rdx
+  80290f:	0f b6 12             	movzbl (%rdx),%edx
+  802912:	0f b6 d2             	movzbl %dl,%edx
+  802915:	29 d0                	sub    %edx,%eax
+  802917:	eb 64                	jmp    80297d <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  802919:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  80291e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802923:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802928:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  80292d:	77 8c                	ja     8028bb <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80292f:	eb 36                	jmp    802967 <memcmp+0x115>
+    if (*s1 != *s2)
+  802931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802935:	0f b6 10             	movzbl (%rax),%edx
+  802938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80293c:	0f b6 00             	movzbl (%rax),%eax
+  80293f:	38 c2                	cmp    %al,%dl
+  802941:	74 1a                	je     80295d <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802947:	0f b6 00             	movzbl (%rax),%eax
+  80294a:	0f b6 c8             	movzbl %al,%ecx
+  80294d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802951:	0f b6 00             	movzbl (%rax),%eax
+  802954:	0f b6 d0             	movzbl %al,%edx
+  802957:	89 c8                	mov    %ecx,%eax
+  802959:	29 d0                	sub    %edx,%eax
+  80295b:	eb 20                	jmp    80297d <memcmp+0x12b>
+    s1++, s2++;
+  80295d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802962:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  802967:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80296b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80296f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802973:	48 85 c0             	test   %rax,%rax
+  802976:	75 b9                	jne    802931 <memcmp+0xdf>
+  }
+
+  return 0;
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+000000000080297f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  80297f:	55                   	push   %rbp
+  802980:	48 89 e5             	mov    %rsp,%rbp
+  802983:	48 83 ec 50          	sub    $0x50,%rsp
+  802987:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80298b:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80298e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802992:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802996:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80299a:	48 01 d0             	add    %rdx,%rax
+  80299d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8029a1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029a4:	66 0f 6e c0          	movd   %eax,%xmm0
+  8029a8:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8029ac:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8029b0:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8029b5:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8029b9:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  8029be:	76 73                	jbe    802a33 <memfind+0xb4>
+  8029c0:	48 b8 71 1c 80 00 00 	movabs $0x801c71,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+  8029cc:	83 e0 02             	and    $0x2,%eax
+  8029cf:	85 c0                	test   %eax,%eax
+  8029d1:	74 60                	je     802a33 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8029d3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029d6:	0f b6 c8             	movzbl %al,%ecx
+  8029d9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8029dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e1:	89 ce                	mov    %ecx,%esi
+  8029e3:	48 89 c7             	mov    %rax,%rdi
+  8029e6:	48 b8 28 1f 80 00 00 	movabs $0x801f28,%rax
+  8029ed:	00 00 00 
+  8029f0:	ff d0                	call   *%rax
+  8029f2:	eb 6c                	jmp    802a60 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8029f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f8:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8029fc:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802a00:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802a05:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802a09:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802a0d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802a10:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802a14:	74 13                	je     802a29 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802a16:	31 c0                	xor    %eax,%eax
+  802a18:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802a1d:	48 63 d0             	movslq %eax,%rdx
+  802a20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a24:	48 01 d0             	add    %rdx,%rax
+  802a27:	eb 37                	jmp    802a60 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802a29:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802a2e:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802a33:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802a38:	77 ba                	ja     8029f4 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802a3a:	eb 13                	jmp    802a4f <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802a3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a40:	0f b6 00             	movzbl (%rax),%eax
+  802a43:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802a46:	38 d0                	cmp    %dl,%al
+  802a48:	74 11                	je     802a5b <memfind+0xdc>
+  for (; s < ends; s++)
+  802a4a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802a4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a53:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802a57:	72 e3                	jb     802a3c <memfind+0xbd>
+  802a59:	eb 01                	jmp    802a5c <memfind+0xdd>
+      break;
+  802a5b:	90                   	nop
+  return (void *)s;
+  802a5c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802a60:	c9                   	leave
+  802a61:	c3                   	ret
+
+0000000000802a62 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a62:	55                   	push   %rbp
+  802a63:	48 89 e5             	mov    %rsp,%rbp
+  802a66:	48 83 ec 38          	sub    $0x38,%rsp
+  802a6a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a6e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802a72:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802a75:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802a7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a83:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802a84:	eb 05                	jmp    802a8b <strtol+0x29>
+    s++;
+  802a86:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802a8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a8f:	0f b6 00             	movzbl (%rax),%eax
+  802a92:	3c 20                	cmp    $0x20,%al
+  802a94:	74 f0                	je     802a86 <strtol+0x24>
+  802a96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a9a:	0f b6 00             	movzbl (%rax),%eax
+  802a9d:	3c 09                	cmp    $0x9,%al
+  802a9f:	74 e5                	je     802a86 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802aa1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aa5:	0f b6 00             	movzbl (%rax),%eax
+  802aa8:	3c 2b                	cmp    $0x2b,%al
+  802aaa:	75 07                	jne    802ab3 <strtol+0x51>
+    s++;
+  802aac:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802ab1:	eb 17                	jmp    802aca <strtol+0x68>
+  else if (*s == '-')
+  802ab3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab7:	0f b6 00             	movzbl (%rax),%eax
+  802aba:	3c 2d                	cmp    $0x2d,%al
+  802abc:	75 0c                	jne    802aca <strtol+0x68>
+    s++, neg = 1;
+  802abe:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802ac3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802aca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802ace:	74 06                	je     802ad6 <strtol+0x74>
+  802ad0:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802ad4:	75 28                	jne    802afe <strtol+0x9c>
+  802ad6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ada:	0f b6 00             	movzbl (%rax),%eax
+  802add:	3c 30                	cmp    $0x30,%al
+  802adf:	75 1d                	jne    802afe <strtol+0x9c>
+  802ae1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ae5:	48 83 c0 01          	add    $0x1,%rax
+  802ae9:	0f b6 00             	movzbl (%rax),%eax
+  802aec:	3c 78                	cmp    $0x78,%al
+  802aee:	75 0e                	jne    802afe <strtol+0x9c>
+    s += 2, base = 16;
+  802af0:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802af5:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802afc:	eb 2c                	jmp    802b2a <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802afe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b02:	75 19                	jne    802b1d <strtol+0xbb>
+  802b04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b08:	0f b6 00             	movzbl (%rax),%eax
+  802b0b:	3c 30                	cmp    $0x30,%al
+  802b0d:	75 0e                	jne    802b1d <strtol+0xbb>
+    s++, base = 8;
+  802b0f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802b14:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802b1b:	eb 0d                	jmp    802b2a <strtol+0xc8>
+  else if (base == 0)
+  802b1d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b21:	75 07                	jne    802b2a <strtol+0xc8>
+    base = 10;
+  802b23:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b2e:	0f b6 00             	movzbl (%rax),%eax
+  802b31:	3c 2f                	cmp    $0x2f,%al
+  802b33:	7e 1d                	jle    802b52 <strtol+0xf0>
+  802b35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b39:	0f b6 00             	movzbl (%rax),%eax
+  802b3c:	3c 39                	cmp    $0x39,%al
+  802b3e:	7f 12                	jg     802b52 <strtol+0xf0>
+      dig = *s - '0';
+  802b40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b44:	0f b6 00             	movzbl (%rax),%eax
+  802b47:	0f be c0             	movsbl %al,%eax
+  802b4a:	83 e8 30             	sub    $0x30,%eax
+  802b4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b50:	eb 4e                	jmp    802ba0 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802b52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b56:	0f b6 00             	movzbl (%rax),%eax
+  802b59:	3c 60                	cmp    $0x60,%al
+  802b5b:	7e 1d                	jle    802b7a <strtol+0x118>
+  802b5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b61:	0f b6 00             	movzbl (%rax),%eax
+  802b64:	3c 7a                	cmp    $0x7a,%al
+  802b66:	7f 12                	jg     802b7a <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802b68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b6c:	0f b6 00             	movzbl (%rax),%eax
+  802b6f:	0f be c0             	movsbl %al,%eax
+  802b72:	83 e8 57             	sub    $0x57,%eax
+  802b75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b78:	eb 26                	jmp    802ba0 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802b7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b7e:	0f b6 00             	movzbl (%rax),%eax
+  802b81:	3c 40                	cmp    $0x40,%al
+  802b83:	7e 47                	jle    802bcc <strtol+0x16a>
+  802b85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b89:	0f b6 00             	movzbl (%rax),%eax
+  802b8c:	3c 5a                	cmp    $0x5a,%al
+  802b8e:	7f 3c                	jg     802bcc <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802b90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b94:	0f b6 00             	movzbl (%rax),%eax
+  802b97:	0f be c0             	movsbl %al,%eax
+  802b9a:	83 e8 37             	sub    $0x37,%eax
+  802b9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ba3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802ba6:	7d 23                	jge    802bcb <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802ba8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802bad:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802bb0:	48 98                	cltq
+  802bb2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802bb7:	48 89 c2             	mov    %rax,%rdx
+  802bba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bbd:	48 98                	cltq
+  802bbf:	48 01 d0             	add    %rdx,%rax
+  802bc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802bc6:	e9 5f ff ff ff       	jmp    802b2a <strtol+0xc8>
+      break;
+  802bcb:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802bcc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802bd1:	74 0b                	je     802bde <strtol+0x17c>
+    *endptr = (char *)s;
+  802bd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bd7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802bdb:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802bde:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802be2:	74 09                	je     802bed <strtol+0x18b>
+  802be4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802be8:	48 f7 d8             	neg    %rax
+  802beb:	eb 04                	jmp    802bf1 <strtol+0x18f>
+  802bed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+
+0000000000802bf3 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	53                   	push   %rbx
+  802bf8:	48 83 ec 48          	sub    $0x48,%rsp
+  802bfc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802c00:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802c04:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802c08:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802c0c:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802c10:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802c14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c18:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802c1c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c20:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802c24:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802c28:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802c2c:	4c 89 c3             	mov    %r8,%rbx
+  802c2f:	cd 30                	int    $0x30
+  802c31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802c35:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802c3a:	74 46                	je     802c82 <syscall+0x8f>
+  802c3c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802c41:	7e 3f                	jle    802c82 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802c43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802c47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c4b:	49 89 d0             	mov    %rdx,%r8
+  802c4e:	48 89 c1             	mov    %rax,%rcx
+  802c51:	48 b8 88 67 80 00 00 	movabs $0x806788,%rax
+  802c58:	00 00 00 
+  802c5b:	48 89 c2             	mov    %rax,%rdx
+  802c5e:	be 22 00 00 00       	mov    $0x22,%esi
+  802c63:	48 b8 a7 67 80 00 00 	movabs $0x8067a7,%rax
+  802c6a:	00 00 00 
+  802c6d:	48 89 c7             	mov    %rax,%rdi
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  802c7c:	00 00 00 
+  802c7f:	41 ff d1             	call   *%r9
+
+  return ret;
+  802c82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802c86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c8a:	c9                   	leave
+  802c8b:	c3                   	ret
+
+0000000000802c8c <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802c8c:	55                   	push   %rbp
+  802c8d:	48 89 e5             	mov    %rsp,%rbp
+  802c90:	48 83 ec 10          	sub    $0x10,%rsp
+  802c94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802c9c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ca4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca8:	6a 00                	push   $0x0
+  802caa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cb6:	48 89 d1             	mov    %rdx,%rcx
+  802cb9:	48 89 c2             	mov    %rax,%rdx
+  802cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc6:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802ccd:	00 00 00 
+  802cd0:	ff d0                	call   *%rax
+  802cd2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cd6:	90                   	nop
+  802cd7:	c9                   	leave
+  802cd8:	c3                   	ret
+
+0000000000802cd9 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802cd9:	55                   	push   %rbp
+  802cda:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802cdd:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce1:	6a 00                	push   $0x0
+  802ce3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ce9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfe:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d03:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+  802d0f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d13:	c9                   	leave
+  802d14:	c3                   	ret
+
+0000000000802d15 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802d15:	55                   	push   %rbp
+  802d16:	48 89 e5             	mov    %rsp,%rbp
+  802d19:	48 83 ec 10          	sub    $0x10,%rsp
+  802d1d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802d20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d23:	48 98                	cltq
+  802d25:	48 83 ec 08          	sub    $0x8,%rsp
+  802d29:	6a 00                	push   $0x0
+  802d2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d3c:	48 89 c2             	mov    %rax,%rdx
+  802d3f:	be 01 00 00 00       	mov    $0x1,%esi
+  802d44:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d49:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802d50:	00 00 00 
+  802d53:	ff d0                	call   *%rax
+  802d55:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d59:	c9                   	leave
+  802d5a:	c3                   	ret
+
+0000000000802d5b <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	48 83 ec 10          	sub    $0x10,%rsp
+  802d63:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802d66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d69:	48 98                	cltq
+  802d6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6f:	6a 00                	push   $0x0
+  802d71:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d82:	48 89 c2             	mov    %rax,%rdx
+  802d85:	be 00 00 00 00       	mov    $0x0,%esi
+  802d8a:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d8f:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802d96:	00 00 00 
+  802d99:	ff d0                	call   *%rax
+  802d9b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d9f:	90                   	nop
+  802da0:	c9                   	leave
+  802da1:	c3                   	ret
+
+0000000000802da2 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802da2:	55                   	push   %rbp
+  802da3:	48 89 e5             	mov    %rsp,%rbp
+  802da6:	48 83 ec 20          	sub    $0x20,%rsp
+  802daa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802dad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802db1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802db4:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802db7:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dbc:	cd 30                	int    $0x30
+  802dbe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802dc2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802dc6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802dcb:	7e 3d                	jle    802e0a <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802dcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dd1:	49 89 c0             	mov    %rax,%r8
+  802dd4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802dd9:	48 b8 88 67 80 00 00 	movabs $0x806788,%rax
+  802de0:	00 00 00 
+  802de3:	48 89 c2             	mov    %rax,%rdx
+  802de6:	be 49 00 00 00       	mov    $0x49,%esi
+  802deb:	48 b8 a7 67 80 00 00 	movabs $0x8067a7,%rax
+  802df2:	00 00 00 
+  802df5:	48 89 c7             	mov    %rax,%rdi
+  802df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfd:	49 b9 06 0f 80 00 00 	movabs $0x800f06,%r9
+  802e04:	00 00 00 
+  802e07:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802e0a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802e0f:	75 13                	jne    802e24 <sys_env_wait+0x82>
+  802e11:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802e16:	74 0c                	je     802e24 <sys_env_wait+0x82>
+    *status = st;
+  802e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1c:	89 c2                	mov    %eax,%edx
+  802e1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e22:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802e28:	c9                   	leave
+  802e29:	c3                   	ret
+
+0000000000802e2a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802e2a:	55                   	push   %rbp
+  802e2b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802e2e:	48 83 ec 08          	sub    $0x8,%rsp
+  802e32:	6a 00                	push   $0x0
+  802e34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e54:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e64:	c9                   	leave
+  802e65:	c3                   	ret
+
+0000000000802e66 <sys_yield>:
+
+void
+sys_yield(void) {
+  802e66:	55                   	push   %rbp
+  802e67:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e6e:	6a 00                	push   $0x0
+  802e70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e76:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e81:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e86:	be 00 00 00 00       	mov    $0x0,%esi
+  802e8b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802e90:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802e97:	00 00 00 
+  802e9a:	ff d0                	call   *%rax
+  802e9c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ea0:	90                   	nop
+  802ea1:	c9                   	leave
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+  802ea7:	48 83 ec 20          	sub    $0x20,%rsp
+  802eab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802eae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802eb2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802eb5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802eb8:	48 63 c8             	movslq %eax,%rcx
+  802ebb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ebf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ec2:	48 98                	cltq
+  802ec4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ec8:	6a 00                	push   $0x0
+  802eca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ed0:	49 89 c8             	mov    %rcx,%r8
+  802ed3:	48 89 d1             	mov    %rdx,%rcx
+  802ed6:	48 89 c2             	mov    %rax,%rdx
+  802ed9:	be 01 00 00 00       	mov    $0x1,%esi
+  802ede:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ee3:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+  802eef:	48 83 c4 10          	add    $0x10,%rsp
+  802ef3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802ef6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ef9:	c9                   	leave
+  802efa:	c3                   	ret
+
+0000000000802efb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802efb:	55                   	push   %rbp
+  802efc:	48 89 e5             	mov    %rsp,%rbp
+  802eff:	48 83 ec 20          	sub    $0x20,%rsp
+  802f03:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f0a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802f0d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f11:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802f15:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802f18:	48 63 c8             	movslq %eax,%rcx
+  802f1b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802f1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802f22:	48 63 f0             	movslq %eax,%rsi
+  802f25:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f2c:	48 98                	cltq
+  802f2e:	48 83 ec 08          	sub    $0x8,%rsp
+  802f32:	51                   	push   %rcx
+  802f33:	49 89 f9             	mov    %rdi,%r9
+  802f36:	49 89 f0             	mov    %rsi,%r8
+  802f39:	48 89 d1             	mov    %rdx,%rcx
+  802f3c:	48 89 c2             	mov    %rax,%rdx
+  802f3f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f44:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f49:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802f50:	00 00 00 
+  802f53:	ff d0                	call   *%rax
+  802f55:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f59:	c9                   	leave
+  802f5a:	c3                   	ret
+
+0000000000802f5b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802f5b:	55                   	push   %rbp
+  802f5c:	48 89 e5             	mov    %rsp,%rbp
+  802f5f:	48 83 ec 10          	sub    $0x10,%rsp
+  802f63:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f66:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802f6a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f71:	48 98                	cltq
+  802f73:	48 83 ec 08          	sub    $0x8,%rsp
+  802f77:	6a 00                	push   $0x0
+  802f79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f85:	48 89 d1             	mov    %rdx,%rcx
+  802f88:	48 89 c2             	mov    %rax,%rdx
+  802f8b:	be 01 00 00 00       	mov    $0x1,%esi
+  802f90:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f95:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802f9c:	00 00 00 
+  802f9f:	ff d0                	call   *%rax
+  802fa1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fa5:	c9                   	leave
+  802fa6:	c3                   	ret
+
+0000000000802fa7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802fa7:	55                   	push   %rbp
+  802fa8:	48 89 e5             	mov    %rsp,%rbp
+  802fab:	48 83 ec 10          	sub    $0x10,%rsp
+  802faf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fb2:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802fb5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802fb8:	48 63 d0             	movslq %eax,%rdx
+  802fbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fbe:	48 98                	cltq
+  802fc0:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc4:	6a 00                	push   $0x0
+  802fc6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fd2:	48 89 d1             	mov    %rdx,%rcx
+  802fd5:	48 89 c2             	mov    %rax,%rdx
+  802fd8:	be 01 00 00 00       	mov    $0x1,%esi
+  802fdd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802fe2:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  802fe9:	00 00 00 
+  802fec:	ff d0                	call   *%rax
+  802fee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ff2:	c9                   	leave
+  802ff3:	c3                   	ret
+
+0000000000802ff4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802ff4:	55                   	push   %rbp
+  802ff5:	48 89 e5             	mov    %rsp,%rbp
+  802ff8:	48 83 ec 10          	sub    $0x10,%rsp
+  802ffc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  803003:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803007:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80300a:	48 98                	cltq
+  80300c:	48 83 ec 08          	sub    $0x8,%rsp
+  803010:	6a 00                	push   $0x0
+  803012:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803018:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80301e:	48 89 d1             	mov    %rdx,%rcx
+  803021:	48 89 c2             	mov    %rax,%rdx
+  803024:	be 01 00 00 00       	mov    $0x1,%esi
+  803029:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80302e:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803035:	00 00 00 
+  803038:	ff d0                	call   *%rax
+  80303a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80303e:	c9                   	leave
+  80303f:	c3                   	ret
+
+0000000000803040 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803040:	55                   	push   %rbp
+  803041:	48 89 e5             	mov    %rsp,%rbp
+  803044:	48 83 ec 10          	sub    $0x10,%rsp
+  803048:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80304b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80304f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803053:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803056:	48 98                	cltq
+  803058:	48 83 ec 08          	sub    $0x8,%rsp
+  80305c:	6a 00                	push   $0x0
+  80305e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80306a:	48 89 d1             	mov    %rdx,%rcx
+  80306d:	48 89 c2             	mov    %rax,%rdx
+  803070:	be 01 00 00 00       	mov    $0x1,%esi
+  803075:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80307a:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+  803086:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80308a:	c9                   	leave
+  80308b:	c3                   	ret
+
+000000000080308c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80308c:	55                   	push   %rbp
+  80308d:	48 89 e5             	mov    %rsp,%rbp
+  803090:	48 83 ec 20          	sub    $0x20,%rsp
+  803094:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803097:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80309b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80309f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8030a2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8030a5:	48 63 f0             	movslq %eax,%rsi
+  8030a8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030b3:	48 98                	cltq
+  8030b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8030b9:	6a 00                	push   $0x0
+  8030bb:	49 89 f1             	mov    %rsi,%r9
+  8030be:	49 89 c8             	mov    %rcx,%r8
+  8030c1:	48 89 d1             	mov    %rdx,%rcx
+  8030c4:	48 89 c2             	mov    %rax,%rdx
+  8030c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cc:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8030d1:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+  8030dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030e1:	c9                   	leave
+  8030e2:	c3                   	ret
+
+00000000008030e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8030e3:	55                   	push   %rbp
+  8030e4:	48 89 e5             	mov    %rsp,%rbp
+  8030e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8030eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8030ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8030f7:	6a 00                	push   $0x0
+  8030f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803105:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80310a:	48 89 c2             	mov    %rax,%rdx
+  80310d:	be 01 00 00 00       	mov    $0x1,%esi
+  803112:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803117:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+  803123:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803127:	c9                   	leave
+  803128:	c3                   	ret
+
+0000000000803129 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  803129:	55                   	push   %rbp
+  80312a:	48 89 e5             	mov    %rsp,%rbp
+  80312d:	48 83 ec 10          	sub    $0x10,%rsp
+  803131:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803135:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  803139:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80313d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803141:	48 83 ec 08          	sub    $0x8,%rsp
+  803145:	6a 00                	push   $0x0
+  803147:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80314d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803153:	48 89 d1             	mov    %rdx,%rcx
+  803156:	48 89 c2             	mov    %rax,%rdx
+  803159:	be 01 00 00 00       	mov    $0x1,%esi
+  80315e:	bf 10 00 00 00       	mov    $0x10,%edi
+  803163:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+  80316f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+
+0000000000803175 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803175:	55                   	push   %rbp
+  803176:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  803179:	48 83 ec 08          	sub    $0x8,%rsp
+  80317d:	6a 00                	push   $0x0
+  80317f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80318b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803190:	ba 00 00 00 00       	mov    $0x0,%edx
+  803195:	be 00 00 00 00       	mov    $0x0,%esi
+  80319a:	bf 11 00 00 00       	mov    $0x11,%edi
+  80319f:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8031a6:	00 00 00 
+  8031a9:	ff d0                	call   *%rax
+  8031ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031af:	c9                   	leave
+  8031b0:	c3                   	ret
+
+00000000008031b1 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8031b1:	55                   	push   %rbp
+  8031b2:	48 89 e5             	mov    %rsp,%rbp
+  8031b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8031b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8031bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8031c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8031c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031cd:	6a 00                	push   $0x0
+  8031cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031db:	48 89 d1             	mov    %rdx,%rcx
+  8031de:	48 89 c2             	mov    %rax,%rdx
+  8031e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e6:	bf 12 00 00 00       	mov    $0x12,%edi
+  8031eb:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8031f2:	00 00 00 
+  8031f5:	ff d0                	call   *%rax
+  8031f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031fb:	c9                   	leave
+  8031fc:	c3                   	ret
+
+00000000008031fd <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8031fd:	55                   	push   %rbp
+  8031fe:	48 89 e5             	mov    %rsp,%rbp
+  803201:	48 83 ec 20          	sub    $0x20,%rsp
+  803205:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803209:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80320d:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  803210:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803213:	48 63 c8             	movslq %eax,%rcx
+  803216:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80321a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80321e:	48 83 ec 08          	sub    $0x8,%rsp
+  803222:	6a 00                	push   $0x0
+  803224:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80322a:	49 89 c8             	mov    %rcx,%r8
+  80322d:	48 89 d1             	mov    %rdx,%rcx
+  803230:	48 89 c2             	mov    %rax,%rdx
+  803233:	be 00 00 00 00       	mov    $0x0,%esi
+  803238:	bf 13 00 00 00       	mov    $0x13,%edi
+  80323d:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803244:	00 00 00 
+  803247:	ff d0                	call   *%rax
+  803249:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80324d:	c9                   	leave
+  80324e:	c3                   	ret
+
+000000000080324f <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80324f:	55                   	push   %rbp
+  803250:	48 89 e5             	mov    %rsp,%rbp
+  803253:	48 83 ec 20          	sub    $0x20,%rsp
+  803257:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80325b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80325e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  803262:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803266:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803269:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80326d:	48 83 ec 08          	sub    $0x8,%rsp
+  803271:	6a 00                	push   $0x0
+  803273:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803279:	49 89 c8             	mov    %rcx,%r8
+  80327c:	48 89 d1             	mov    %rdx,%rcx
+  80327f:	48 89 c2             	mov    %rax,%rdx
+  803282:	be 00 00 00 00       	mov    $0x0,%esi
+  803287:	bf 14 00 00 00       	mov    $0x14,%edi
+  80328c:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803293:	00 00 00 
+  803296:	ff d0                	call   *%rax
+  803298:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80329c:	c9                   	leave
+  80329d:	c3                   	ret
+
+000000000080329e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80329e:	55                   	push   %rbp
+  80329f:	48 89 e5             	mov    %rsp,%rbp
+  8032a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8032a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032aa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8032ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032b0:	48 63 d0             	movslq %eax,%rdx
+  8032b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bb:	6a 00                	push   $0x0
+  8032bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8032c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032c9:	48 89 d1             	mov    %rdx,%rcx
+  8032cc:	48 89 c2             	mov    %rax,%rdx
+  8032cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d4:	bf 15 00 00 00       	mov    $0x15,%edi
+  8032d9:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8032e0:	00 00 00 
+  8032e3:	ff d0                	call   *%rax
+  8032e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032e9:	c9                   	leave
+  8032ea:	c3                   	ret
+
+00000000008032eb <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8032eb:	55                   	push   %rbp
+  8032ec:	48 89 e5             	mov    %rsp,%rbp
+  8032ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8032f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032f7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8032fa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8032fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  803301:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  803305:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803308:	48 63 c8             	movslq %eax,%rcx
+  80330b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80330e:	48 63 d0             	movslq %eax,%rdx
+  803311:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803315:	48 83 ec 08          	sub    $0x8,%rsp
+  803319:	6a 00                	push   $0x0
+  80331b:	49 89 f1             	mov    %rsi,%r9
+  80331e:	49 89 c8             	mov    %rcx,%r8
+  803321:	48 89 d1             	mov    %rdx,%rcx
+  803324:	48 89 c2             	mov    %rax,%rdx
+  803327:	be 00 00 00 00       	mov    $0x0,%esi
+  80332c:	bf 16 00 00 00       	mov    $0x16,%edi
+  803331:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803338:	00 00 00 
+  80333b:	ff d0                	call   *%rax
+  80333d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803341:	c9                   	leave
+  803342:	c3                   	ret
+
+0000000000803343 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  803343:	55                   	push   %rbp
+  803344:	48 89 e5             	mov    %rsp,%rbp
+  803347:	48 83 ec 30          	sub    $0x30,%rsp
+  80334b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80334f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803353:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803357:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80335b:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80335f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803363:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803367:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80336b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80336f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803373:	48 83 ec 08          	sub    $0x8,%rsp
+  803377:	51                   	push   %rcx
+  803378:	49 89 f9             	mov    %rdi,%r9
+  80337b:	49 89 f0             	mov    %rsi,%r8
+  80337e:	48 89 d1             	mov    %rdx,%rcx
+  803381:	48 89 c2             	mov    %rax,%rdx
+  803384:	be 00 00 00 00       	mov    $0x0,%esi
+  803389:	bf 17 00 00 00       	mov    $0x17,%edi
+  80338e:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803395:	00 00 00 
+  803398:	ff d0                	call   *%rax
+  80339a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+
+00000000008033a0 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8033a0:	55                   	push   %rbp
+  8033a1:	48 89 e5             	mov    %rsp,%rbp
+  8033a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8033a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8033ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033ae:	48 98                	cltq
+  8033b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b4:	6a 00                	push   $0x0
+  8033b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8033c7:	48 89 c2             	mov    %rax,%rdx
+  8033ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8033cf:	bf 18 00 00 00       	mov    $0x18,%edi
+  8033d4:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8033db:	00 00 00 
+  8033de:	ff d0                	call   *%rax
+  8033e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8033e4:	90                   	nop
+  8033e5:	c9                   	leave
+  8033e6:	c3                   	ret
+
+00000000008033e7 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8033e7:	55                   	push   %rbp
+  8033e8:	48 89 e5             	mov    %rsp,%rbp
+  8033eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8033ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8033f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8033fa:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8033fd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803400:	48 63 f0             	movslq %eax,%rsi
+  803403:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803407:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80340b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80340e:	48 98                	cltq
+  803410:	48 83 ec 08          	sub    $0x8,%rsp
+  803414:	6a 00                	push   $0x0
+  803416:	49 89 f1             	mov    %rsi,%r9
+  803419:	49 89 c8             	mov    %rcx,%r8
+  80341c:	48 89 d1             	mov    %rdx,%rcx
+  80341f:	48 89 c2             	mov    %rax,%rdx
+  803422:	be 01 00 00 00       	mov    $0x1,%esi
+  803427:	bf 19 00 00 00       	mov    $0x19,%edi
+  80342c:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+  803438:	48 83 c4 10          	add    $0x10,%rsp
+  80343c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80343f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803442:	c9                   	leave
+  803443:	c3                   	ret
+
+0000000000803444 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  803444:	55                   	push   %rbp
+  803445:	48 89 e5             	mov    %rsp,%rbp
+  803448:	48 83 ec 20          	sub    $0x20,%rsp
+  80344c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803450:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803454:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  803457:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80345a:	48 63 c8             	movslq %eax,%rcx
+  80345d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803465:	48 83 ec 08          	sub    $0x8,%rsp
+  803469:	6a 00                	push   $0x0
+  80346b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803471:	49 89 c8             	mov    %rcx,%r8
+  803474:	48 89 d1             	mov    %rdx,%rcx
+  803477:	48 89 c2             	mov    %rax,%rdx
+  80347a:	be 01 00 00 00       	mov    $0x1,%esi
+  80347f:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  803484:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+  803490:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803494:	c9                   	leave
+  803495:	c3                   	ret
+
+0000000000803496 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  803496:	55                   	push   %rbp
+  803497:	48 89 e5             	mov    %rsp,%rbp
+  80349a:	48 83 ec 20          	sub    $0x20,%rsp
+  80349e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8034a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8034a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8034aa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8034ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8034b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ba:	6a 00                	push   $0x0
+  8034bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8034c2:	49 89 c8             	mov    %rcx,%r8
+  8034c5:	48 89 d1             	mov    %rdx,%rcx
+  8034c8:	48 89 c2             	mov    %rax,%rdx
+  8034cb:	be 01 00 00 00       	mov    $0x1,%esi
+  8034d0:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8034d5:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  8034dc:	00 00 00 
+  8034df:	ff d0                	call   *%rax
+  8034e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8034e5:	c9                   	leave
+  8034e6:	c3                   	ret
+
+00000000008034e7 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8034e7:	55                   	push   %rbp
+  8034e8:	48 89 e5             	mov    %rsp,%rbp
+  8034eb:	48 83 ec 30          	sub    $0x30,%rsp
+  8034ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8034f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8034f7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8034fa:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8034fe:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803502:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803505:	48 63 c8             	movslq %eax,%rcx
+  803508:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80350c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803510:	48 83 ec 08          	sub    $0x8,%rsp
+  803514:	6a 00                	push   $0x0
+  803516:	49 89 f1             	mov    %rsi,%r9
+  803519:	49 89 c8             	mov    %rcx,%r8
+  80351c:	48 89 d1             	mov    %rdx,%rcx
+  80351f:	48 89 c2             	mov    %rax,%rdx
+  803522:	be 01 00 00 00       	mov    $0x1,%esi
+  803527:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  80352c:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+  803538:	48 83 c4 10          	add    $0x10,%rsp
+  80353c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80353f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803542:	c9                   	leave
+  803543:	c3                   	ret
+
+0000000000803544 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  803544:	55                   	push   %rbp
+  803545:	48 89 e5             	mov    %rsp,%rbp
+  803548:	48 83 ec 10          	sub    $0x10,%rsp
+  80354c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80354f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803552:	48 98                	cltq
+  803554:	48 83 ec 08          	sub    $0x8,%rsp
+  803558:	6a 00                	push   $0x0
+  80355a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803560:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803566:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80356b:	48 89 c2             	mov    %rax,%rdx
+  80356e:	be 01 00 00 00       	mov    $0x1,%esi
+  803573:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  803578:	48 b8 f3 2b 80 00 00 	movabs $0x802bf3,%rax
+  80357f:	00 00 00 
+  803582:	ff d0                	call   *%rax
+  803584:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803588:	c9                   	leave
+  803589:	c3                   	ret
+
+000000000080358a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80358a:	55                   	push   %rbp
+  80358b:	48 89 e5             	mov    %rsp,%rbp
+  80358e:	48 83 ec 20          	sub    $0x20,%rsp
+  803592:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803596:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80359a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80359e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8035a2:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8035a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035aa:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8035b1:	48 89 c7             	mov    %rax,%rdi
+  8035b4:	48 b8 c2 35 80 00 00 	movabs $0x8035c2,%rax
+  8035bb:	00 00 00 
+  8035be:	ff d0                	call   *%rax
+}
+  8035c0:	c9                   	leave
+  8035c1:	c3                   	ret
+
+00000000008035c2 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8035c2:	55                   	push   %rbp
+  8035c3:	48 89 e5             	mov    %rsp,%rbp
+  8035c6:	48 83 ec 30          	sub    $0x30,%rsp
+  8035ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8035ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035d2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8035d6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8035da:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8035df:	75 0e                	jne    8035ef <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8035e1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8035e8:	00 00 00 
+  8035eb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8035ef:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8035f4:	75 18                	jne    80360e <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8035f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035fa:	48 89 c7             	mov    %rax,%rdi
+  8035fd:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  803604:	00 00 00 
+  803607:	ff d0                	call   *%rax
+  803609:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80360c:	eb 1d                	jmp    80362b <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  80360e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803612:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803616:	48 89 d6             	mov    %rdx,%rsi
+  803619:	48 89 c7             	mov    %rax,%rdi
+  80361c:	48 b8 29 31 80 00 00 	movabs $0x803129,%rax
+  803623:	00 00 00 
+  803626:	ff d0                	call   *%rax
+  803628:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80362b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80362f:	79 2a                	jns    80365b <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  803631:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803636:	74 0a                	je     803642 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  803638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80363c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  803642:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803647:	74 0a                	je     803653 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  803649:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80364d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  803653:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803656:	e9 aa 00 00 00       	jmp    803705 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80365b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803660:	74 36                	je     803698 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  803662:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803669:	00 00 00 
+  80366c:	8b 40 04             	mov    0x4(%rax),%eax
+  80366f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803674:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80367b:	00 00 00 
+  80367e:	48 98                	cltq
+  803680:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803687:	48 01 d0             	add    %rdx,%rax
+  80368a:	48 05 24 01 00 00    	add    $0x124,%rax
+  803690:	8b 10                	mov    (%rax),%edx
+  803692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803696:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  803698:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80369d:	74 36                	je     8036d5 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80369f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8036a6:	00 00 00 
+  8036a9:	8b 40 04             	mov    0x4(%rax),%eax
+  8036ac:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036b1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8036b8:	00 00 00 
+  8036bb:	48 98                	cltq
+  8036bd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036c4:	48 01 d0             	add    %rdx,%rax
+  8036c7:	48 05 28 01 00 00    	add    $0x128,%rax
+  8036cd:	8b 10                	mov    (%rax),%edx
+  8036cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036d3:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8036d5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8036dc:	00 00 00 
+  8036df:	8b 40 04             	mov    0x4(%rax),%eax
+  8036e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036e7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8036ee:	00 00 00 
+  8036f1:	48 98                	cltq
+  8036f3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036fa:	48 01 d0             	add    %rdx,%rax
+  8036fd:	48 05 20 01 00 00    	add    $0x120,%rax
+  803703:	8b 00                	mov    (%rax),%eax
+  }
+}
+  803705:	c9                   	leave
+  803706:	c3                   	ret
+
+0000000000803707 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  803707:	55                   	push   %rbp
+  803708:	48 89 e5             	mov    %rsp,%rbp
+  80370b:	48 83 ec 30          	sub    $0x30,%rsp
+  80370f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803712:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803715:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803719:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80371c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803721:	75 5e                	jne    803781 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  803723:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80372a:	00 00 00 
+  80372d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803731:	eb 4e                	jmp    803781 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  803733:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803737:	79 3c                	jns    803775 <ipc_send+0x6e>
+  803739:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80373d:	74 36                	je     803775 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80373f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803742:	89 c1                	mov    %eax,%ecx
+  803744:	48 b8 b8 67 80 00 00 	movabs $0x8067b8,%rax
+  80374b:	00 00 00 
+  80374e:	48 89 c2             	mov    %rax,%rdx
+  803751:	be 54 00 00 00       	mov    $0x54,%esi
+  803756:	48 b8 de 67 80 00 00 	movabs $0x8067de,%rax
+  80375d:	00 00 00 
+  803760:	48 89 c7             	mov    %rax,%rdi
+  803763:	b8 00 00 00 00       	mov    $0x0,%eax
+  803768:	49 b8 06 0f 80 00 00 	movabs $0x800f06,%r8
+  80376f:	00 00 00 
+  803772:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  803775:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  80377c:	00 00 00 
+  80377f:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803781:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803784:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803787:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80378b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80378e:	89 c7                	mov    %eax,%edi
+  803790:	48 b8 8c 30 80 00 00 	movabs $0x80308c,%rax
+  803797:	00 00 00 
+  80379a:	ff d0                	call   *%rax
+  80379c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80379f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037a3:	75 8e                	jne    803733 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8037a5:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  8037ac:	00 00 00 
+  8037af:	ff d0                	call   *%rax
+}
+  8037b1:	90                   	nop
+  8037b2:	c9                   	leave
+  8037b3:	c3                   	ret
+
+00000000008037b4 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8037b4:	55                   	push   %rbp
+  8037b5:	48 89 e5             	mov    %rsp,%rbp
+  8037b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8037bc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8037bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8037c6:	eb 4d                	jmp    803815 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8037c8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8037cf:	00 00 00 
+  8037d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037d5:	48 98                	cltq
+  8037d7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8037de:	48 01 d0             	add    %rdx,%rax
+  8037e1:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8037e7:	8b 00                	mov    (%rax),%eax
+  8037e9:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8037ec:	75 23                	jne    803811 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8037ee:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8037f5:	00 00 00 
+  8037f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037fb:	48 98                	cltq
+  8037fd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803804:	48 01 d0             	add    %rdx,%rax
+  803807:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80380d:	8b 00                	mov    (%rax),%eax
+  80380f:	eb 12                	jmp    803823 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  803811:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803815:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80381c:	7e aa                	jle    8037c8 <ipc_find_env+0x14>
+  return 0;
+  80381e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803823:	c9                   	leave
+  803824:	c3                   	ret
+
+0000000000803825 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803825:	55                   	push   %rbp
+  803826:	48 89 e5             	mov    %rsp,%rbp
+  803829:	48 83 ec 08          	sub    $0x8,%rsp
+  80382d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803835:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80383c:	ff ff ff 
+  80383f:	48 01 d0             	add    %rdx,%rax
+  803842:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803846:	c9                   	leave
+  803847:	c3                   	ret
+
+0000000000803848 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803848:	55                   	push   %rbp
+  803849:	48 89 e5             	mov    %rsp,%rbp
+  80384c:	48 83 ec 08          	sub    $0x8,%rsp
+  803850:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803854:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803858:	48 89 c7             	mov    %rax,%rdi
+  80385b:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80386d:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803871:	c9                   	leave
+  803872:	c3                   	ret
+
+0000000000803873 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803873:	55                   	push   %rbp
+  803874:	48 89 e5             	mov    %rsp,%rbp
+  803877:	48 83 ec 18          	sub    $0x18,%rsp
+  80387b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80387f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803886:	e9 ae 00 00 00       	jmp    803939 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80388b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80388e:	c1 e0 0c             	shl    $0xc,%eax
+  803891:	48 98                	cltq
+  803893:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803898:	48 01 d0             	add    %rdx,%rax
+  80389b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80389f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038a3:	48 c1 e8 27          	shr    $0x27,%rax
+  8038a7:	48 89 c2             	mov    %rax,%rdx
+  8038aa:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8038b1:	01 00 00 
+  8038b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038b8:	83 e0 01             	and    $0x1,%eax
+  8038bb:	48 85 c0             	test   %rax,%rax
+  8038be:	74 63                	je     803923 <fd_alloc+0xb0>
+  8038c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038c4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038c8:	48 89 c2             	mov    %rax,%rdx
+  8038cb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8038d2:	01 00 00 
+  8038d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038d9:	83 e0 01             	and    $0x1,%eax
+  8038dc:	48 85 c0             	test   %rax,%rax
+  8038df:	74 42                	je     803923 <fd_alloc+0xb0>
+  8038e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8038e9:	48 89 c2             	mov    %rax,%rdx
+  8038ec:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8038f3:	01 00 00 
+  8038f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038fa:	83 e0 01             	and    $0x1,%eax
+  8038fd:	48 85 c0             	test   %rax,%rax
+  803900:	74 21                	je     803923 <fd_alloc+0xb0>
+  803902:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803906:	48 c1 e8 0c          	shr    $0xc,%rax
+  80390a:	48 89 c2             	mov    %rax,%rdx
+  80390d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803914:	01 00 00 
+  803917:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80391b:	83 e0 01             	and    $0x1,%eax
+  80391e:	48 85 c0             	test   %rax,%rax
+  803921:	75 12                	jne    803935 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803923:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803927:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80392b:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80392e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803933:	eb 1e                	jmp    803953 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803935:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803939:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80393d:	0f 8e 48 ff ff ff    	jle    80388b <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803943:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803947:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80394e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803953:	c9                   	leave
+  803954:	c3                   	ret
+
+0000000000803955 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803955:	55                   	push   %rbp
+  803956:	48 89 e5             	mov    %rsp,%rbp
+  803959:	48 83 ec 20          	sub    $0x20,%rsp
+  80395d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803960:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803964:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803968:	78 06                	js     803970 <fd_lookup+0x1b>
+  80396a:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80396e:	7e 0a                	jle    80397a <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803970:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803975:	e9 af 00 00 00       	jmp    803a29 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80397a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80397d:	c1 e0 0c             	shl    $0xc,%eax
+  803980:	48 98                	cltq
+  803982:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803987:	48 01 d0             	add    %rdx,%rax
+  80398a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80398e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803992:	48 c1 e8 27          	shr    $0x27,%rax
+  803996:	48 89 c2             	mov    %rax,%rdx
+  803999:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8039a0:	01 00 00 
+  8039a3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039a7:	83 e0 01             	and    $0x1,%eax
+  8039aa:	48 85 c0             	test   %rax,%rax
+  8039ad:	74 63                	je     803a12 <fd_lookup+0xbd>
+  8039af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039b3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039b7:	48 89 c2             	mov    %rax,%rdx
+  8039ba:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8039c1:	01 00 00 
+  8039c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039c8:	83 e0 01             	and    $0x1,%eax
+  8039cb:	48 85 c0             	test   %rax,%rax
+  8039ce:	74 42                	je     803a12 <fd_lookup+0xbd>
+  8039d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039d4:	48 c1 e8 15          	shr    $0x15,%rax
+  8039d8:	48 89 c2             	mov    %rax,%rdx
+  8039db:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8039e2:	01 00 00 
+  8039e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039e9:	83 e0 01             	and    $0x1,%eax
+  8039ec:	48 85 c0             	test   %rax,%rax
+  8039ef:	74 21                	je     803a12 <fd_lookup+0xbd>
+  8039f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039f9:	48 89 c2             	mov    %rax,%rdx
+  8039fc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a03:	01 00 00 
+  803a06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a0a:	83 e0 01             	and    $0x1,%eax
+  803a0d:	48 85 c0             	test   %rax,%rax
+  803a10:	75 07                	jne    803a19 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803a12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a17:	eb 10                	jmp    803a29 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803a19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a21:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803a24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a29:	c9                   	leave
+  803a2a:	c3                   	ret
+
+0000000000803a2b <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803a2b:	55                   	push   %rbp
+  803a2c:	48 89 e5             	mov    %rsp,%rbp
+  803a2f:	48 83 ec 30          	sub    $0x30,%rsp
+  803a33:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803a37:	89 f0                	mov    %esi,%eax
+  803a39:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803a3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a40:	48 89 c7             	mov    %rax,%rdi
+  803a43:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  803a4a:	00 00 00 
+  803a4d:	ff d0                	call   *%rax
+  803a4f:	89 c2                	mov    %eax,%edx
+  803a51:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a55:	48 89 c6             	mov    %rax,%rsi
+  803a58:	89 d7                	mov    %edx,%edi
+  803a5a:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  803a61:	00 00 00 
+  803a64:	ff d0                	call   *%rax
+  803a66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a69:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a6d:	78 0a                	js     803a79 <fd_close+0x4e>
+  803a6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a73:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803a77:	74 12                	je     803a8b <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803a79:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803a7d:	74 05                	je     803a84 <fd_close+0x59>
+  803a7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a82:	eb 70                	jmp    803af4 <fd_close+0xc9>
+  803a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a89:	eb 69                	jmp    803af4 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803a8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a8f:	8b 00                	mov    (%rax),%eax
+  803a91:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a95:	48 89 d6             	mov    %rdx,%rsi
+  803a98:	89 c7                	mov    %eax,%edi
+  803a9a:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+  803aa6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aa9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aad:	78 2a                	js     803ad9 <fd_close+0xae>
+    if (dev->dev_close)
+  803aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ab3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803ab7:	48 85 c0             	test   %rax,%rax
+  803aba:	74 16                	je     803ad2 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803abc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ac0:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803ac4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ac8:	48 89 c7             	mov    %rax,%rdi
+  803acb:	ff d2                	call   *%rdx
+  803acd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ad0:	eb 07                	jmp    803ad9 <fd_close+0xae>
+    else
+      r = 0;
+  803ad2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803add:	48 89 c6             	mov    %rax,%rsi
+  803ae0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae5:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  803aec:	00 00 00 
+  803aef:	ff d0                	call   *%rax
+  return r;
+  803af1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803af4:	c9                   	leave
+  803af5:	c3                   	ret
+
+0000000000803af6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803af6:	55                   	push   %rbp
+  803af7:	48 89 e5             	mov    %rsp,%rbp
+  803afa:	48 83 ec 20          	sub    $0x20,%rsp
+  803afe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b01:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803b05:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803b0c:	eb 3f                	jmp    803b4d <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803b0e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803b15:	00 00 00 
+  803b18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b1b:	48 98                	cltq
+  803b1d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b21:	8b 00                	mov    (%rax),%eax
+  803b23:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803b26:	75 21                	jne    803b49 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803b28:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803b2f:	00 00 00 
+  803b32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b35:	48 98                	cltq
+  803b37:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b3f:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b47:	eb 7f                	jmp    803bc8 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803b49:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803b4d:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803b54:	00 00 00 
+  803b57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b5a:	48 98                	cltq
+  803b5c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b60:	48 85 c0             	test   %rax,%rax
+  803b63:	75 a9                	jne    803b0e <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803b65:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b6c:	00 00 00 
+  803b6f:	8b 40 04             	mov    0x4(%rax),%eax
+  803b72:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b77:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b7e:	00 00 00 
+  803b81:	48 98                	cltq
+  803b83:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b8a:	48 01 d0             	add    %rdx,%rax
+  803b8d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b93:	8b 00                	mov    (%rax),%eax
+  803b95:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803b98:	89 c6                	mov    %eax,%esi
+  803b9a:	48 b8 e8 67 80 00 00 	movabs $0x8067e8,%rax
+  803ba1:	00 00 00 
+  803ba4:	48 89 c7             	mov    %rax,%rdi
+  803ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bac:	48 b9 25 11 80 00 00 	movabs $0x801125,%rcx
+  803bb3:	00 00 00 
+  803bb6:	ff d1                	call   *%rcx
+  *dev = 0;
+  803bb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bbc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803bc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803bc8:	c9                   	leave
+  803bc9:	c3                   	ret
+
+0000000000803bca <close>:
+
+int
+close(int fdnum) {
+  803bca:	55                   	push   %rbp
+  803bcb:	48 89 e5             	mov    %rsp,%rbp
+  803bce:	48 83 ec 20          	sub    $0x20,%rsp
+  803bd2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bd5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bdc:	48 89 d6             	mov    %rdx,%rsi
+  803bdf:	89 c7                	mov    %eax,%edi
+  803be1:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  803be8:	00 00 00 
+  803beb:	ff d0                	call   *%rax
+  803bed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bf0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bf4:	79 05                	jns    803bfb <close+0x31>
+    return r;
+  803bf6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bf9:	eb 18                	jmp    803c13 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803bfb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bff:	be 01 00 00 00       	mov    $0x1,%esi
+  803c04:	48 89 c7             	mov    %rax,%rdi
+  803c07:	48 b8 2b 3a 80 00 00 	movabs $0x803a2b,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+}
+  803c13:	c9                   	leave
+  803c14:	c3                   	ret
+
+0000000000803c15 <close_all>:
+
+void
+close_all(void) {
+  803c15:	55                   	push   %rbp
+  803c16:	48 89 e5             	mov    %rsp,%rbp
+  803c19:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803c1d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c24:	eb 15                	jmp    803c3b <close_all+0x26>
+    close(i);
+  803c26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c29:	89 c7                	mov    %eax,%edi
+  803c2b:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803c32:	00 00 00 
+  803c35:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803c37:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803c3b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803c3f:	7e e5                	jle    803c26 <close_all+0x11>
+}
+  803c41:	90                   	nop
+  803c42:	90                   	nop
+  803c43:	c9                   	leave
+  803c44:	c3                   	ret
+
+0000000000803c45 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803c45:	55                   	push   %rbp
+  803c46:	48 89 e5             	mov    %rsp,%rbp
+  803c49:	48 83 ec 40          	sub    $0x40,%rsp
+  803c4d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c50:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803c53:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803c57:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803c5a:	48 89 d6             	mov    %rdx,%rsi
+  803c5d:	89 c7                	mov    %eax,%edi
+  803c5f:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  803c66:	00 00 00 
+  803c69:	ff d0                	call   *%rax
+  803c6b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c6e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c72:	79 08                	jns    803c7c <dup+0x37>
+    return r;
+  803c74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c77:	e9 33 02 00 00       	jmp    803eaf <dup+0x26a>
+  close(newfdnum);
+  803c7c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803c7f:	89 c7                	mov    %eax,%edi
+  803c81:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  803c88:	00 00 00 
+  803c8b:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803c8d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803c90:	c1 e0 0c             	shl    $0xc,%eax
+  803c93:	48 98                	cltq
+  803c95:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803c9a:	48 01 d0             	add    %rdx,%rax
+  803c9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803ca1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ca5:	48 89 c7             	mov    %rax,%rdi
+  803ca8:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  803caf:	00 00 00 
+  803cb2:	ff d0                	call   *%rax
+  803cb4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803cb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cbc:	48 89 c7             	mov    %rax,%rdi
+  803cbf:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  803cc6:	00 00 00 
+  803cc9:	ff d0                	call   *%rax
+  803ccb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803ccf:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803cd6:	00 
+  803cd7:	e9 19 01 00 00       	jmp    803df5 <dup+0x1b0>
+    off -= PGSIZE;
+  803cdc:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803ce3:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803ce4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ce8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cec:	48 01 d0             	add    %rdx,%rax
+  803cef:	48 c1 e8 27          	shr    $0x27,%rax
+  803cf3:	48 89 c2             	mov    %rax,%rdx
+  803cf6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803cfd:	01 00 00 
+  803d00:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d04:	83 e0 01             	and    $0x1,%eax
+  803d07:	48 85 c0             	test   %rax,%rax
+  803d0a:	0f 84 e5 00 00 00    	je     803df5 <dup+0x1b0>
+  803d10:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d18:	48 01 d0             	add    %rdx,%rax
+  803d1b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d1f:	48 89 c2             	mov    %rax,%rdx
+  803d22:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803d29:	01 00 00 
+  803d2c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d30:	83 e0 01             	and    $0x1,%eax
+  803d33:	48 85 c0             	test   %rax,%rax
+  803d36:	0f 84 b9 00 00 00    	je     803df5 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803d3c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d44:	48 01 d0             	add    %rdx,%rax
+  803d47:	48 c1 e8 15          	shr    $0x15,%rax
+  803d4b:	48 89 c2             	mov    %rax,%rdx
+  803d4e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803d55:	01 00 00 
+  803d58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d5c:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803d5f:	48 85 c0             	test   %rax,%rax
+  803d62:	0f 84 8d 00 00 00    	je     803df5 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803d68:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d70:	48 01 d0             	add    %rdx,%rax
+  803d73:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d77:	48 89 c2             	mov    %rax,%rdx
+  803d7a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803d81:	01 00 00 
+  803d84:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d88:	83 e0 01             	and    $0x1,%eax
+  803d8b:	48 85 c0             	test   %rax,%rax
+  803d8e:	74 65                	je     803df5 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803d90:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d98:	48 01 d0             	add    %rdx,%rax
+  803d9b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d9f:	48 89 c2             	mov    %rax,%rdx
+  803da2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803da9:	01 00 00 
+  803dac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803db0:	25 07 0e 00 00       	and    $0xe07,%eax
+  803db5:	89 c6                	mov    %eax,%esi
+  803db7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803dbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dbf:	48 01 c2             	add    %rax,%rdx
+  803dc2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803dc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dca:	48 01 c8             	add    %rcx,%rax
+  803dcd:	41 89 f0             	mov    %esi,%r8d
+  803dd0:	48 89 d1             	mov    %rdx,%rcx
+  803dd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd8:	48 89 c6             	mov    %rax,%rsi
+  803ddb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803de0:	48 b8 fb 2e 80 00 00 	movabs $0x802efb,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+  803dec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803def:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803df3:	78 60                	js     803e55 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803df5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803dfa:	0f 85 dc fe ff ff    	jne    803cdc <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803e00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e04:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e08:	48 89 c2             	mov    %rax,%rdx
+  803e0b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e12:	01 00 00 
+  803e15:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e19:	25 07 0e 00 00       	and    $0xe07,%eax
+  803e1e:	89 c1                	mov    %eax,%ecx
+  803e20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803e28:	41 89 c8             	mov    %ecx,%r8d
+  803e2b:	48 89 d1             	mov    %rdx,%rcx
+  803e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e33:	48 89 c6             	mov    %rax,%rsi
+  803e36:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e3b:	48 b8 fb 2e 80 00 00 	movabs $0x802efb,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+  803e47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e4e:	78 08                	js     803e58 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803e50:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803e53:	eb 5a                	jmp    803eaf <dup+0x26a>
+        goto err;
+  803e55:	90                   	nop
+  803e56:	eb 01                	jmp    803e59 <dup+0x214>
+    goto err;
+  803e58:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803e59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e5d:	48 89 c6             	mov    %rax,%rsi
+  803e60:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e65:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  803e6c:	00 00 00 
+  803e6f:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803e71:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803e78:	00 
+  803e79:	eb 27                	jmp    803ea2 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803e7b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e83:	48 01 d0             	add    %rdx,%rax
+  803e86:	48 89 c6             	mov    %rax,%rsi
+  803e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8e:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  803e95:	00 00 00 
+  803e98:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803e9a:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803ea1:	00 
+  803ea2:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803ea9:	00 
+  803eaa:	76 cf                	jbe    803e7b <dup+0x236>
+  return r;
+  803eac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803eaf:	c9                   	leave
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803eb1:	55                   	push   %rbp
+  803eb2:	48 89 e5             	mov    %rsp,%rbp
+  803eb5:	48 83 ec 40          	sub    $0x40,%rsp
+  803eb9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ebc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ec0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ec4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ec8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ecb:	48 89 d6             	mov    %rdx,%rsi
+  803ece:	89 c7                	mov    %eax,%edi
+  803ed0:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  803ed7:	00 00 00 
+  803eda:	ff d0                	call   *%rax
+  803edc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803edf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ee3:	78 24                	js     803f09 <read+0x58>
+  803ee5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ee9:	8b 00                	mov    (%rax),%eax
+  803eeb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803eef:	48 89 d6             	mov    %rdx,%rsi
+  803ef2:	89 c7                	mov    %eax,%edi
+  803ef4:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  803efb:	00 00 00 
+  803efe:	ff d0                	call   *%rax
+  803f00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f07:	79 0a                	jns    803f13 <read+0x62>
+    return r;
+  803f09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f0c:	48 98                	cltq
+  803f0e:	e9 9e 00 00 00       	jmp    803fb1 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803f13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f17:	8b 40 08             	mov    0x8(%rax),%eax
+  803f1a:	83 e0 03             	and    $0x3,%eax
+  803f1d:	83 f8 01             	cmp    $0x1,%eax
+  803f20:	75 5c                	jne    803f7e <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f22:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f29:	00 00 00 
+  803f2c:	8b 40 04             	mov    0x4(%rax),%eax
+  803f2f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f34:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f3b:	00 00 00 
+  803f3e:	48 98                	cltq
+  803f40:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f47:	48 01 d0             	add    %rdx,%rax
+  803f4a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803f50:	8b 00                	mov    (%rax),%eax
+  803f52:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f55:	89 c6                	mov    %eax,%esi
+  803f57:	48 b8 07 68 80 00 00 	movabs $0x806807,%rax
+  803f5e:	00 00 00 
+  803f61:	48 89 c7             	mov    %rax,%rdi
+  803f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f69:	48 b9 25 11 80 00 00 	movabs $0x801125,%rcx
+  803f70:	00 00 00 
+  803f73:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803f75:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803f7c:	eb 33                	jmp    803fb1 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803f7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f82:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803f86:	48 85 c0             	test   %rax,%rax
+  803f89:	75 09                	jne    803f94 <read+0xe3>
+    return -E_NOT_SUPP;
+  803f8b:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803f92:	eb 1d                	jmp    803fb1 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803f94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f98:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803f9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fa0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803fa4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803fa8:	48 89 ce             	mov    %rcx,%rsi
+  803fab:	48 89 c7             	mov    %rax,%rdi
+  803fae:	41 ff d0             	call   *%r8
+}
+  803fb1:	c9                   	leave
+  803fb2:	c3                   	ret
+
+0000000000803fb3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803fb3:	55                   	push   %rbp
+  803fb4:	48 89 e5             	mov    %rsp,%rbp
+  803fb7:	48 83 ec 30          	sub    $0x30,%rsp
+  803fbb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803fbe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803fc2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803fc6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803fcd:	eb 49                	jmp    804018 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803fcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fd2:	48 98                	cltq
+  803fd4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fd8:	48 29 c2             	sub    %rax,%rdx
+  803fdb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fde:	48 63 c8             	movslq %eax,%rcx
+  803fe1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fe5:	48 01 c1             	add    %rax,%rcx
+  803fe8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803feb:	48 89 ce             	mov    %rcx,%rsi
+  803fee:	89 c7                	mov    %eax,%edi
+  803ff0:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+  803ffc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803fff:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804003:	79 07                	jns    80400c <readn+0x59>
+      return m;
+  804005:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804008:	48 98                	cltq
+  80400a:	eb 1f                	jmp    80402b <readn+0x78>
+    if (m == 0)
+  80400c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804010:	74 13                	je     804025 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  804012:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804015:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804018:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80401b:	48 98                	cltq
+  80401d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804021:	72 ac                	jb     803fcf <readn+0x1c>
+  804023:	eb 01                	jmp    804026 <readn+0x73>
+      break;
+  804025:	90                   	nop
+  }
+  return tot;
+  804026:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804029:	48 98                	cltq
+}
+  80402b:	c9                   	leave
+  80402c:	c3                   	ret
+
+000000000080402d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80402d:	55                   	push   %rbp
+  80402e:	48 89 e5             	mov    %rsp,%rbp
+  804031:	48 83 ec 40          	sub    $0x40,%rsp
+  804035:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804038:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80403c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804040:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804044:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804047:	48 89 d6             	mov    %rdx,%rsi
+  80404a:	89 c7                	mov    %eax,%edi
+  80404c:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  804053:	00 00 00 
+  804056:	ff d0                	call   *%rax
+  804058:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80405b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80405f:	78 24                	js     804085 <write+0x58>
+  804061:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804065:	8b 00                	mov    (%rax),%eax
+  804067:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80406b:	48 89 d6             	mov    %rdx,%rsi
+  80406e:	89 c7                	mov    %eax,%edi
+  804070:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  804077:	00 00 00 
+  80407a:	ff d0                	call   *%rax
+  80407c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80407f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804083:	79 0a                	jns    80408f <write+0x62>
+    return r;
+  804085:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804088:	48 98                	cltq
+  80408a:	e9 9d 00 00 00       	jmp    80412c <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80408f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804093:	8b 40 08             	mov    0x8(%rax),%eax
+  804096:	83 e0 03             	and    $0x3,%eax
+  804099:	85 c0                	test   %eax,%eax
+  80409b:	75 5c                	jne    8040f9 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80409d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8040a4:	00 00 00 
+  8040a7:	8b 40 04             	mov    0x4(%rax),%eax
+  8040aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040af:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8040b6:	00 00 00 
+  8040b9:	48 98                	cltq
+  8040bb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8040c2:	48 01 d0             	add    %rdx,%rax
+  8040c5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8040cb:	8b 00                	mov    (%rax),%eax
+  8040cd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8040d0:	89 c6                	mov    %eax,%esi
+  8040d2:	48 b8 23 68 80 00 00 	movabs $0x806823,%rax
+  8040d9:	00 00 00 
+  8040dc:	48 89 c7             	mov    %rax,%rdi
+  8040df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e4:	48 b9 25 11 80 00 00 	movabs $0x801125,%rcx
+  8040eb:	00 00 00 
+  8040ee:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8040f0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8040f7:	eb 33                	jmp    80412c <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8040f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040fd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804101:	48 85 c0             	test   %rax,%rax
+  804104:	75 09                	jne    80410f <write+0xe2>
+    return -E_NOT_SUPP;
+  804106:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80410d:	eb 1d                	jmp    80412c <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  80410f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804113:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804117:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80411b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80411f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804123:	48 89 ce             	mov    %rcx,%rsi
+  804126:	48 89 c7             	mov    %rax,%rdi
+  804129:	41 ff d0             	call   *%r8
+}
+  80412c:	c9                   	leave
+  80412d:	c3                   	ret
+
+000000000080412e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80412e:	55                   	push   %rbp
+  80412f:	48 89 e5             	mov    %rsp,%rbp
+  804132:	48 83 ec 18          	sub    $0x18,%rsp
+  804136:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804139:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80413c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804140:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804143:	48 89 d6             	mov    %rdx,%rsi
+  804146:	89 c7                	mov    %eax,%edi
+  804148:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  80414f:	00 00 00 
+  804152:	ff d0                	call   *%rax
+  804154:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804157:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80415b:	79 05                	jns    804162 <seek+0x34>
+    return r;
+  80415d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804160:	eb 0f                	jmp    804171 <seek+0x43>
+  fd->fd_offset = offset;
+  804162:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804166:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804169:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80416c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804171:	c9                   	leave
+  804172:	c3                   	ret
+
+0000000000804173 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804173:	55                   	push   %rbp
+  804174:	48 89 e5             	mov    %rsp,%rbp
+  804177:	48 83 ec 30          	sub    $0x30,%rsp
+  80417b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80417e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804181:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804185:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804188:	48 89 d6             	mov    %rdx,%rsi
+  80418b:	89 c7                	mov    %eax,%edi
+  80418d:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  804194:	00 00 00 
+  804197:	ff d0                	call   *%rax
+  804199:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80419c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041a0:	78 24                	js     8041c6 <ftruncate+0x53>
+  8041a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a6:	8b 00                	mov    (%rax),%eax
+  8041a8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8041ac:	48 89 d6             	mov    %rdx,%rsi
+  8041af:	89 c7                	mov    %eax,%edi
+  8041b1:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  8041b8:	00 00 00 
+  8041bb:	ff d0                	call   *%rax
+  8041bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041c4:	79 08                	jns    8041ce <ftruncate+0x5b>
+    return r;
+  8041c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041c9:	e9 92 00 00 00       	jmp    804260 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8041ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d2:	8b 40 08             	mov    0x8(%rax),%eax
+  8041d5:	83 e0 03             	and    $0x3,%eax
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	75 5a                	jne    804236 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8041dc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8041e3:	00 00 00 
+  8041e6:	8b 40 04             	mov    0x4(%rax),%eax
+  8041e9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8041ee:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8041f5:	00 00 00 
+  8041f8:	48 98                	cltq
+  8041fa:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804201:	48 01 d0             	add    %rdx,%rax
+  804204:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80420a:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80420c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80420f:	89 c6                	mov    %eax,%esi
+  804211:	48 b8 40 68 80 00 00 	movabs $0x806840,%rax
+  804218:	00 00 00 
+  80421b:	48 89 c7             	mov    %rax,%rdi
+  80421e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804223:	48 b9 25 11 80 00 00 	movabs $0x801125,%rcx
+  80422a:	00 00 00 
+  80422d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80422f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804234:	eb 2a                	jmp    804260 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  804236:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80423a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80423e:	48 85 c0             	test   %rax,%rax
+  804241:	75 07                	jne    80424a <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  804243:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  804248:	eb 16                	jmp    804260 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80424a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80424e:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804256:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804259:	89 d6                	mov    %edx,%esi
+  80425b:	48 89 c7             	mov    %rax,%rdi
+  80425e:	ff d1                	call   *%rcx
+}
+  804260:	c9                   	leave
+  804261:	c3                   	ret
+
+0000000000804262 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804262:	55                   	push   %rbp
+  804263:	48 89 e5             	mov    %rsp,%rbp
+  804266:	48 83 ec 30          	sub    $0x30,%rsp
+  80426a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80426d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804271:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804275:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804278:	48 89 d6             	mov    %rdx,%rsi
+  80427b:	89 c7                	mov    %eax,%edi
+  80427d:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  804284:	00 00 00 
+  804287:	ff d0                	call   *%rax
+  804289:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80428c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804290:	78 24                	js     8042b6 <fstat+0x54>
+  804292:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804296:	8b 00                	mov    (%rax),%eax
+  804298:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80429c:	48 89 d6             	mov    %rdx,%rsi
+  80429f:	89 c7                	mov    %eax,%edi
+  8042a1:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  8042a8:	00 00 00 
+  8042ab:	ff d0                	call   *%rax
+  8042ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042b4:	79 05                	jns    8042bb <fstat+0x59>
+    return r;
+  8042b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042b9:	eb 5e                	jmp    804319 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8042bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042bf:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8042c3:	48 85 c0             	test   %rax,%rax
+  8042c6:	75 07                	jne    8042cf <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8042c8:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8042cd:	eb 4a                	jmp    804319 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8042cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042d3:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8042d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042da:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8042e1:	00 00 00 
+  stat->st_isdir   = 0;
+  8042e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042e8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8042ef:	00 00 00 
+  stat->st_dev     = dev;
+  8042f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8042f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042fa:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  804301:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804305:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80430d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804311:	48 89 d6             	mov    %rdx,%rsi
+  804314:	48 89 c7             	mov    %rax,%rdi
+  804317:	ff d1                	call   *%rcx
+}
+  804319:	c9                   	leave
+  80431a:	c3                   	ret
+
+000000000080431b <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80431b:	55                   	push   %rbp
+  80431c:	48 89 e5             	mov    %rsp,%rbp
+  80431f:	48 83 ec 10          	sub    $0x10,%rsp
+  804323:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804327:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80432b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80432f:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804335:	83 f8 20             	cmp    $0x20,%eax
+  804338:	75 07                	jne    804341 <pollwait_key+0x26>
+    return -E_INVAL;
+  80433a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80433f:	eb 5f                	jmp    8043a0 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  804341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804345:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80434b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80434f:	48 63 d2             	movslq %edx,%rdx
+  804352:	48 c1 e2 04          	shl    $0x4,%rdx
+  804356:	48 01 c2             	add    %rax,%rdx
+  804359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80435d:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804360:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804364:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80436a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80436e:	8b 00                	mov    (%rax),%eax
+  804370:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804374:	48 63 c9             	movslq %ecx,%rcx
+  804377:	48 c1 e1 04          	shl    $0x4,%rcx
+  80437b:	48 01 ca             	add    %rcx,%rdx
+  80437e:	48 83 c2 08          	add    $0x8,%rdx
+  804382:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  804384:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804388:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80438e:	8d 50 01             	lea    0x1(%rax),%edx
+  804391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804395:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80439b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043a0:	c9                   	leave
+  8043a1:	c3                   	ret
+
+00000000008043a2 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8043a2:	55                   	push   %rbp
+  8043a3:	48 89 e5             	mov    %rsp,%rbp
+  8043a6:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8043ad:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8043b4:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8043ba:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8043c1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043c8:	00 
+  int i, r, ready, ipc = 0;
+  8043c9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8043d0:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8043d7:	00 
+  8043d8:	74 45                	je     80441f <poll+0x7d>
+  8043da:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8043e1:	ff 
+  8043e2:	74 3b                	je     80441f <poll+0x7d>
+    now      = vsys_clock_ns();
+  8043e4:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  8043eb:	00 00 00 
+  8043ee:	ff d0                	call   *%rax
+  8043f0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8043f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043f8:	48 f7 d0             	not    %rax
+  8043fb:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  804402:	73 10                	jae    804414 <poll+0x72>
+  804404:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804408:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80440f:	48 01 d0             	add    %rdx,%rax
+  804412:	eb 07                	jmp    80441b <poll+0x79>
+  804414:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80441b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80441f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804426:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80442d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804434:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80443b:	e9 46 02 00 00       	jmp    804686 <poll+0x2e4>
+      fds[i].revents = 0;
+  804440:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804443:	48 63 d0             	movslq %eax,%rdx
+  804446:	48 89 d0             	mov    %rdx,%rax
+  804449:	48 01 c0             	add    %rax,%rax
+  80444c:	48 01 d0             	add    %rdx,%rax
+  80444f:	48 c1 e0 02          	shl    $0x2,%rax
+  804453:	48 89 c2             	mov    %rax,%rdx
+  804456:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80445d:	48 01 d0             	add    %rdx,%rax
+  804460:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804467:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80446a:	48 63 d0             	movslq %eax,%rdx
+  80446d:	48 89 d0             	mov    %rdx,%rax
+  804470:	48 01 c0             	add    %rax,%rax
+  804473:	48 01 d0             	add    %rdx,%rax
+  804476:	48 c1 e0 02          	shl    $0x2,%rax
+  80447a:	48 89 c2             	mov    %rax,%rdx
+  80447d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804484:	48 01 d0             	add    %rdx,%rax
+  804487:	8b 00                	mov    (%rax),%eax
+  804489:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80448c:	75 62                	jne    8044f0 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80448e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804491:	48 63 d0             	movslq %eax,%rdx
+  804494:	48 89 d0             	mov    %rdx,%rax
+  804497:	48 01 c0             	add    %rax,%rax
+  80449a:	48 01 d0             	add    %rdx,%rax
+  80449d:	48 c1 e0 02          	shl    $0x2,%rax
+  8044a1:	48 89 c2             	mov    %rax,%rdx
+  8044a4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044ab:	48 01 d0             	add    %rdx,%rax
+  8044ae:	8b 40 04             	mov    0x4(%rax),%eax
+  8044b1:	83 e0 01             	and    $0x1,%eax
+  8044b4:	85 c0                	test   %eax,%eax
+  8044b6:	0f 84 9b 01 00 00    	je     804657 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8044bc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044bf:	48 63 d0             	movslq %eax,%rdx
+  8044c2:	48 89 d0             	mov    %rdx,%rax
+  8044c5:	48 01 c0             	add    %rax,%rax
+  8044c8:	48 01 d0             	add    %rdx,%rax
+  8044cb:	48 c1 e0 02          	shl    $0x2,%rax
+  8044cf:	48 89 c2             	mov    %rax,%rdx
+  8044d2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044d9:	48 01 c2             	add    %rax,%rdx
+  8044dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044df:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8044e2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8044e5:	83 c8 04             	or     $0x4,%eax
+  8044e8:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8044eb:	e9 67 01 00 00       	jmp    804657 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8044f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044f3:	48 63 d0             	movslq %eax,%rdx
+  8044f6:	48 89 d0             	mov    %rdx,%rax
+  8044f9:	48 01 c0             	add    %rax,%rax
+  8044fc:	48 01 d0             	add    %rdx,%rax
+  8044ff:	48 c1 e0 02          	shl    $0x2,%rax
+  804503:	48 89 c2             	mov    %rax,%rdx
+  804506:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80450d:	48 01 d0             	add    %rdx,%rax
+  804510:	8b 00                	mov    (%rax),%eax
+  804512:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804519:	48 89 d6             	mov    %rdx,%rsi
+  80451c:	89 c7                	mov    %eax,%edi
+  80451e:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  804525:	00 00 00 
+  804528:	ff d0                	call   *%rax
+  80452a:	85 c0                	test   %eax,%eax
+  80452c:	78 25                	js     804553 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80452e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804535:	8b 00                	mov    (%rax),%eax
+  804537:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80453e:	48 89 d6             	mov    %rdx,%rsi
+  804541:	89 c7                	mov    %eax,%edi
+  804543:	48 b8 f6 3a 80 00 00 	movabs $0x803af6,%rax
+  80454a:	00 00 00 
+  80454d:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80454f:	85 c0                	test   %eax,%eax
+  804551:	79 2c                	jns    80457f <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  804553:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804556:	48 63 d0             	movslq %eax,%rdx
+  804559:	48 89 d0             	mov    %rdx,%rax
+  80455c:	48 01 c0             	add    %rax,%rax
+  80455f:	48 01 d0             	add    %rdx,%rax
+  804562:	48 c1 e0 02          	shl    $0x2,%rax
+  804566:	48 89 c2             	mov    %rax,%rdx
+  804569:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804570:	48 01 d0             	add    %rdx,%rax
+  804573:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80457a:	e9 d8 00 00 00       	jmp    804657 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80457f:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804586:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80458a:	48 85 c0             	test   %rax,%rax
+  80458d:	74 7d                	je     80460c <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80458f:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804596:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80459a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80459d:	48 63 d0             	movslq %eax,%rdx
+  8045a0:	48 89 d0             	mov    %rdx,%rax
+  8045a3:	48 01 c0             	add    %rax,%rax
+  8045a6:	48 01 d0             	add    %rdx,%rax
+  8045a9:	48 c1 e0 02          	shl    $0x2,%rax
+  8045ad:	48 89 c2             	mov    %rax,%rdx
+  8045b0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8045b7:	48 01 d0             	add    %rdx,%rax
+  8045ba:	8b 48 04             	mov    0x4(%rax),%ecx
+  8045bd:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8045c4:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8045cb:	89 ce                	mov    %ecx,%esi
+  8045cd:	48 89 c7             	mov    %rax,%rdi
+  8045d0:	41 ff d0             	call   *%r8
+  8045d3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8045d6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8045da:	79 08                	jns    8045e4 <poll+0x242>
+          return r;
+  8045dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045df:	e9 45 01 00 00       	jmp    804729 <poll+0x387>
+        fds[i].revents = r;
+  8045e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045e7:	48 63 d0             	movslq %eax,%rdx
+  8045ea:	48 89 d0             	mov    %rdx,%rax
+  8045ed:	48 01 c0             	add    %rax,%rax
+  8045f0:	48 01 d0             	add    %rdx,%rax
+  8045f3:	48 c1 e0 02          	shl    $0x2,%rax
+  8045f7:	48 89 c2             	mov    %rax,%rdx
+  8045fa:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804601:	48 01 c2             	add    %rax,%rdx
+  804604:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804607:	89 42 08             	mov    %eax,0x8(%rdx)
+  80460a:	eb 4b                	jmp    804657 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80460c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80460f:	48 63 d0             	movslq %eax,%rdx
+  804612:	48 89 d0             	mov    %rdx,%rax
+  804615:	48 01 c0             	add    %rax,%rax
+  804618:	48 01 d0             	add    %rdx,%rax
+  80461b:	48 c1 e0 02          	shl    $0x2,%rax
+  80461f:	48 89 c2             	mov    %rax,%rdx
+  804622:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804629:	48 01 d0             	add    %rdx,%rax
+  80462c:	8b 48 04             	mov    0x4(%rax),%ecx
+  80462f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804632:	48 63 d0             	movslq %eax,%rdx
+  804635:	48 89 d0             	mov    %rdx,%rax
+  804638:	48 01 c0             	add    %rax,%rax
+  80463b:	48 01 d0             	add    %rdx,%rax
+  80463e:	48 c1 e0 02          	shl    $0x2,%rax
+  804642:	48 89 c2             	mov    %rax,%rdx
+  804645:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80464c:	48 01 d0             	add    %rdx,%rax
+  80464f:	83 e1 03             	and    $0x3,%ecx
+  804652:	89 ca                	mov    %ecx,%edx
+  804654:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804657:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80465a:	48 63 d0             	movslq %eax,%rdx
+  80465d:	48 89 d0             	mov    %rdx,%rax
+  804660:	48 01 c0             	add    %rax,%rax
+  804663:	48 01 d0             	add    %rdx,%rax
+  804666:	48 c1 e0 02          	shl    $0x2,%rax
+  80466a:	48 89 c2             	mov    %rax,%rdx
+  80466d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804674:	48 01 d0             	add    %rdx,%rax
+  804677:	8b 40 08             	mov    0x8(%rax),%eax
+  80467a:	85 c0                	test   %eax,%eax
+  80467c:	74 04                	je     804682 <poll+0x2e0>
+        ready++;
+  80467e:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804682:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804686:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804689:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80468f:	0f 8c ab fd ff ff    	jl     804440 <poll+0x9e>
+    }
+    if (ready)
+  804695:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  804699:	74 08                	je     8046a3 <poll+0x301>
+      return ready;
+  80469b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80469e:	e9 86 00 00 00       	jmp    804729 <poll+0x387>
+
+    if (deadline) {
+  8046a3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8046a8:	74 30                	je     8046da <poll+0x338>
+      now     = vsys_clock_ns();
+  8046aa:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  8046b1:	00 00 00 
+  8046b4:	ff d0                	call   *%rax
+  8046b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8046ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046be:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8046c2:	73 0a                	jae    8046ce <poll+0x32c>
+  8046c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c8:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8046cc:	eb 05                	jmp    8046d3 <poll+0x331>
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d3:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8046da:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8046dd:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8046e0:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8046e7:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8046ee:	48 89 c7             	mov    %rax,%rdi
+  8046f1:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  8046f8:	00 00 00 
+  8046fb:	ff d0                	call   *%rax
+  8046fd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804700:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804704:	75 07                	jne    80470d <poll+0x36b>
+      return 0;
+  804706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470b:	eb 1c                	jmp    804729 <poll+0x387>
+    if (r < 0)
+  80470d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804711:	79 05                	jns    804718 <poll+0x376>
+      return r;
+  804713:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804716:	eb 11                	jmp    804729 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804718:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80471b:	c1 f8 02             	sar    $0x2,%eax
+  80471e:	83 e0 01             	and    $0x1,%eax
+  804721:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804724:	e9 f6 fc ff ff       	jmp    80441f <poll+0x7d>
+  }
+}
+  804729:	c9                   	leave
+  80472a:	c3                   	ret
+
+000000000080472b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80472b:	55                   	push   %rbp
+  80472c:	48 89 e5             	mov    %rsp,%rbp
+  80472f:	48 83 ec 20          	sub    $0x20,%rsp
+  804733:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804737:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80473b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80473f:	be 00 00 00 00       	mov    $0x0,%esi
+  804744:	48 89 c7             	mov    %rax,%rdi
+  804747:	48 b8 19 48 80 00 00 	movabs $0x804819,%rax
+  80474e:	00 00 00 
+  804751:	ff d0                	call   *%rax
+  804753:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804756:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80475a:	79 05                	jns    804761 <stat+0x36>
+    return fd;
+  80475c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80475f:	eb 2f                	jmp    804790 <stat+0x65>
+  r = fstat(fd, stat);
+  804761:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804765:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804768:	48 89 d6             	mov    %rdx,%rsi
+  80476b:	89 c7                	mov    %eax,%edi
+  80476d:	48 b8 62 42 80 00 00 	movabs $0x804262,%rax
+  804774:	00 00 00 
+  804777:	ff d0                	call   *%rax
+  804779:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80477c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80477f:	89 c7                	mov    %eax,%edi
+  804781:	48 b8 ca 3b 80 00 00 	movabs $0x803bca,%rax
+  804788:	00 00 00 
+  80478b:	ff d0                	call   *%rax
+  return r;
+  80478d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804790:	c9                   	leave
+  804791:	c3                   	ret
+
+0000000000804792 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804792:	55                   	push   %rbp
+  804793:	48 89 e5             	mov    %rsp,%rbp
+  804796:	48 83 ec 10          	sub    $0x10,%rsp
+  80479a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80479d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8047a1:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8047a8:	00 00 00 
+  8047ab:	8b 00                	mov    (%rax),%eax
+  8047ad:	85 c0                	test   %eax,%eax
+  8047af:	75 1d                	jne    8047ce <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8047b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8047b6:	48 b8 b4 37 80 00 00 	movabs $0x8037b4,%rax
+  8047bd:	00 00 00 
+  8047c0:	ff d0                	call   *%rax
+  8047c2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047c9:	00 00 00 
+  8047cc:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8047ce:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8047d5:	00 00 00 
+  8047d8:	8b 00                	mov    (%rax),%eax
+  8047da:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8047dd:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8047e2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8047e9:	00 00 00 
+  8047ec:	89 c7                	mov    %eax,%edi
+  8047ee:	48 b8 07 37 80 00 00 	movabs $0x803707,%rax
+  8047f5:	00 00 00 
+  8047f8:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8047fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  804803:	48 89 c6             	mov    %rax,%rsi
+  804806:	bf 00 00 00 00       	mov    $0x0,%edi
+  80480b:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  804812:	00 00 00 
+  804815:	ff d0                	call   *%rax
+}
+  804817:	c9                   	leave
+  804818:	c3                   	ret
+
+0000000000804819 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804819:	55                   	push   %rbp
+  80481a:	48 89 e5             	mov    %rsp,%rbp
+  80481d:	48 83 ec 20          	sub    $0x20,%rsp
+  804821:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804825:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80482c:	48 89 c7             	mov    %rax,%rdi
+  80482f:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  804836:	00 00 00 
+  804839:	ff d0                	call   *%rax
+  80483b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804840:	7e 0a                	jle    80484c <open+0x33>
+    return -E_BAD_PATH;
+  804842:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804847:	e9 a8 00 00 00       	jmp    8048f4 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80484c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804850:	48 89 c7             	mov    %rax,%rdi
+  804853:	48 b8 73 38 80 00 00 	movabs $0x803873,%rax
+  80485a:	00 00 00 
+  80485d:	ff d0                	call   *%rax
+  80485f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804862:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804866:	79 08                	jns    804870 <open+0x57>
+    return r;
+  804868:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80486b:	e9 84 00 00 00       	jmp    8048f4 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804874:	48 89 c6             	mov    %rax,%rsi
+  804877:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80487e:	00 00 00 
+  804881:	48 89 c7             	mov    %rax,%rdi
+  804884:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  80488b:	00 00 00 
+  80488e:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804890:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804897:	00 00 00 
+  80489a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80489d:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8048a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048a7:	48 89 c6             	mov    %rax,%rsi
+  8048aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8048af:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  8048b6:	00 00 00 
+  8048b9:	ff d0                	call   *%rax
+  8048bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048c2:	79 1d                	jns    8048e1 <open+0xc8>
+    fd_close(fd, 0);
+  8048c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8048cd:	48 89 c7             	mov    %rax,%rdi
+  8048d0:	48 b8 2b 3a 80 00 00 	movabs $0x803a2b,%rax
+  8048d7:	00 00 00 
+  8048da:	ff d0                	call   *%rax
+    return r;
+  8048dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048df:	eb 13                	jmp    8048f4 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8048e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e5:	48 89 c7             	mov    %rax,%rdi
+  8048e8:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  8048ef:	00 00 00 
+  8048f2:	ff d0                	call   *%rax
+}
+  8048f4:	c9                   	leave
+  8048f5:	c3                   	ret
+
+00000000008048f6 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8048f6:	55                   	push   %rbp
+  8048f7:	48 89 e5             	mov    %rsp,%rbp
+  8048fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8048fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804906:	8b 40 0c             	mov    0xc(%rax),%eax
+  804909:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804910:	00 00 00 
+  804913:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804915:	be 00 00 00 00       	mov    $0x0,%esi
+  80491a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80491f:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804926:	00 00 00 
+  804929:	ff d0                	call   *%rax
+}
+  80492b:	c9                   	leave
+  80492c:	c3                   	ret
+
+000000000080492d <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80492d:	55                   	push   %rbp
+  80492e:	48 89 e5             	mov    %rsp,%rbp
+  804931:	48 83 ec 30          	sub    $0x30,%rsp
+  804935:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804939:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80493d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804941:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804946:	74 07                	je     80494f <devfile_read+0x22>
+  804948:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80494d:	75 0a                	jne    804959 <devfile_read+0x2c>
+  return E_INVAL;
+  80494f:	b8 03 00 00 00       	mov    $0x3,%eax
+  804954:	e9 b4 00 00 00       	jmp    804a0d <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804959:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804960:	00 
+  while (n) {
+  804961:	e9 98 00 00 00       	jmp    8049fe <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804966:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80496a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80496d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804974:	00 00 00 
+  804977:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804979:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804980:	00 00 00 
+  804983:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804987:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80498b:	be 00 00 00 00       	mov    $0x0,%esi
+  804990:	bf 03 00 00 00       	mov    $0x3,%edi
+  804995:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  80499c:	00 00 00 
+  80499f:	ff d0                	call   *%rax
+  8049a1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8049a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8049a8:	7f 13                	jg     8049bd <devfile_read+0x90>
+      return res ? res : res0;
+  8049aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8049ae:	74 07                	je     8049b7 <devfile_read+0x8a>
+  8049b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049b3:	48 98                	cltq
+  8049b5:	eb 56                	jmp    804a0d <devfile_read+0xe0>
+  8049b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049bb:	eb 50                	jmp    804a0d <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8049bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049c0:	48 63 d0             	movslq %eax,%rdx
+  8049c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c7:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8049ce:	00 00 00 
+  8049d1:	48 89 ce             	mov    %rcx,%rsi
+  8049d4:	48 89 c7             	mov    %rax,%rdi
+  8049d7:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  8049de:	00 00 00 
+  8049e1:	ff d0                	call   *%rax
+
+    buf += res;
+  8049e3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049e6:	48 98                	cltq
+  8049e8:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8049ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049ef:	48 98                	cltq
+  8049f1:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8049f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049f8:	48 98                	cltq
+  8049fa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8049fe:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804a03:	0f 85 5d ff ff ff    	jne    804966 <devfile_read+0x39>
+  }
+
+  return res0;
+  804a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804a0d:	c9                   	leave
+  804a0e:	c3                   	ret
+
+0000000000804a0f <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804a0f:	55                   	push   %rbp
+  804a10:	48 89 e5             	mov    %rsp,%rbp
+  804a13:	48 83 ec 50          	sub    $0x50,%rsp
+  804a17:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804a1b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804a1f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804a23:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804a28:	74 07                	je     804a31 <devfile_write+0x22>
+  804a2a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804a2f:	75 0a                	jne    804a3b <devfile_write+0x2c>
+  return E_INVAL;
+  804a31:	b8 03 00 00 00       	mov    $0x3,%eax
+  804a36:	e9 c9 00 00 00       	jmp    804b04 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804a3b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804a42:	00 
+
+  while (n) {
+  804a43:	e9 ad 00 00 00       	jmp    804af5 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804a48:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a4c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804a50:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804a57:	00 
+  804a58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a60:	48 39 c2             	cmp    %rax,%rdx
+  804a63:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804a6b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a6f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a73:	48 89 c6             	mov    %rax,%rsi
+  804a76:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  804a7d:	00 00 00 
+  804a80:	48 89 c7             	mov    %rax,%rdi
+  804a83:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  804a8a:	00 00 00 
+  804a8d:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804a8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a93:	8b 40 0c             	mov    0xc(%rax),%eax
+  804a96:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804a9d:	00 00 00 
+  804aa0:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804aa2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804aa9:	00 00 00 
+  804aac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ab0:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804ab4:	be 00 00 00 00       	mov    $0x0,%esi
+  804ab9:	bf 04 00 00 00       	mov    $0x4,%edi
+  804abe:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804ac5:	00 00 00 
+  804ac8:	ff d0                	call   *%rax
+  804aca:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804acd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804ad1:	79 07                	jns    804ada <devfile_write+0xcb>
+      return res;
+  804ad3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ad6:	48 98                	cltq
+  804ad8:	eb 2a                	jmp    804b04 <devfile_write+0xf5>
+
+    buf += res;
+  804ada:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804add:	48 98                	cltq
+  804adf:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804ae3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ae6:	48 98                	cltq
+  804ae8:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804aec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804aef:	48 98                	cltq
+  804af1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804af5:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804afa:	0f 85 48 ff ff ff    	jne    804a48 <devfile_write+0x39>
+  }
+
+  return res0;
+  804b00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804b04:	c9                   	leave
+  804b05:	c3                   	ret
+
+0000000000804b06 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804b06:	55                   	push   %rbp
+  804b07:	48 89 e5             	mov    %rsp,%rbp
+  804b0a:	48 83 ec 20          	sub    $0x20,%rsp
+  804b0e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b12:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804b16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b1a:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b1d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804b24:	00 00 00 
+  804b27:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804b29:	be 00 00 00 00       	mov    $0x0,%esi
+  804b2e:	bf 05 00 00 00       	mov    $0x5,%edi
+  804b33:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804b3a:	00 00 00 
+  804b3d:	ff d0                	call   *%rax
+  804b3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b42:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b46:	79 05                	jns    804b4d <devfile_stat+0x47>
+    return r;
+  804b48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b4b:	eb 59                	jmp    804ba6 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804b4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b51:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804b58:	00 00 00 
+  804b5b:	48 89 d6             	mov    %rdx,%rsi
+  804b5e:	48 89 c7             	mov    %rax,%rdi
+  804b61:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  804b68:	00 00 00 
+  804b6b:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804b6d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804b74:	00 00 00 
+  804b77:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804b7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b81:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804b87:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804b8e:	00 00 00 
+  804b91:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804b97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b9b:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ba6:	c9                   	leave
+  804ba7:	c3                   	ret
+
+0000000000804ba8 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804ba8:	55                   	push   %rbp
+  804ba9:	48 89 e5             	mov    %rsp,%rbp
+  804bac:	48 83 ec 10          	sub    $0x10,%rsp
+  804bb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bb4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804bb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bbb:	8b 40 0c             	mov    0xc(%rax),%eax
+  804bbe:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804bc5:	00 00 00 
+  804bc8:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804bca:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804bd1:	00 00 00 
+  804bd4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804bd7:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804bda:	be 00 00 00 00       	mov    $0x0,%esi
+  804bdf:	bf 02 00 00 00       	mov    $0x2,%edi
+  804be4:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804beb:	00 00 00 
+  804bee:	ff d0                	call   *%rax
+}
+  804bf0:	c9                   	leave
+  804bf1:	c3                   	ret
+
+0000000000804bf2 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804bf2:	55                   	push   %rbp
+  804bf3:	48 89 e5             	mov    %rsp,%rbp
+  804bf6:	48 83 ec 18          	sub    $0x18,%rsp
+  804bfa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bfe:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804c01:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804c05:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c08:	83 e0 03             	and    $0x3,%eax
+}
+  804c0b:	c9                   	leave
+  804c0c:	c3                   	ret
+
+0000000000804c0d <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804c0d:	55                   	push   %rbp
+  804c0e:	48 89 e5             	mov    %rsp,%rbp
+  804c11:	48 83 ec 10          	sub    $0x10,%rsp
+  804c15:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c1d:	48 89 c7             	mov    %rax,%rdi
+  804c20:	48 b8 d4 1f 80 00 00 	movabs $0x801fd4,%rax
+  804c27:	00 00 00 
+  804c2a:	ff d0                	call   *%rax
+  804c2c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c31:	7e 07                	jle    804c3a <remove+0x2d>
+    return -E_BAD_PATH;
+  804c33:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804c38:	eb 36                	jmp    804c70 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3e:	48 89 c6             	mov    %rax,%rsi
+  804c41:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804c48:	00 00 00 
+  804c4b:	48 89 c7             	mov    %rax,%rdi
+  804c4e:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  804c55:	00 00 00 
+  804c58:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804c5a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c5f:	bf 07 00 00 00       	mov    $0x7,%edi
+  804c64:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804c6b:	00 00 00 
+  804c6e:	ff d0                	call   *%rax
+}
+  804c70:	c9                   	leave
+  804c71:	c3                   	ret
+
+0000000000804c72 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804c72:	55                   	push   %rbp
+  804c73:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804c76:	be 00 00 00 00       	mov    $0x0,%esi
+  804c7b:	bf 08 00 00 00       	mov    $0x8,%edi
+  804c80:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804c87:	00 00 00 
+  804c8a:	ff d0                	call   *%rax
+}
+  804c8c:	5d                   	pop    %rbp
+  804c8d:	c3                   	ret
+
+0000000000804c8e <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804c8e:	55                   	push   %rbp
+  804c8f:	48 89 e5             	mov    %rsp,%rbp
+  804c92:	48 83 ec 20          	sub    $0x20,%rsp
+  804c96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804c9a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c9f:	bf 09 00 00 00       	mov    $0x9,%edi
+  804ca4:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804cab:	00 00 00 
+  804cae:	ff d0                	call   *%rax
+  804cb0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cb3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cb7:	79 05                	jns    804cbe <fs_stats+0x30>
+    return r;
+  804cb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cbc:	eb 2a                	jmp    804ce8 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cc2:	ba 68 00 00 00       	mov    $0x68,%edx
+  804cc7:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804cce:	00 00 00 
+  804cd1:	48 89 ce             	mov    %rcx,%rsi
+  804cd4:	48 89 c7             	mov    %rax,%rdi
+  804cd7:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  804cde:	00 00 00 
+  804ce1:	ff d0                	call   *%rax
+  return 0;
+  804ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ce8:	c9                   	leave
+  804ce9:	c3                   	ret
+
+0000000000804cea <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804cea:	55                   	push   %rbp
+  804ceb:	48 89 e5             	mov    %rsp,%rbp
+  804cee:	48 83 ec 10          	sub    $0x10,%rsp
+  804cf2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804cf5:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804cfc:	00 00 00 
+  804cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d02:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804d04:	be 00 00 00 00       	mov    $0x0,%esi
+  804d09:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804d0e:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804d15:	00 00 00 
+  804d18:	ff d0                	call   *%rax
+}
+  804d1a:	c9                   	leave
+  804d1b:	c3                   	ret
+
+0000000000804d1c <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804d1c:	55                   	push   %rbp
+  804d1d:	48 89 e5             	mov    %rsp,%rbp
+  804d20:	48 83 ec 10          	sub    $0x10,%rsp
+  804d24:	89 f8                	mov    %edi,%eax
+  804d26:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804d29:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804d2d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804d34:	00 00 00 
+  804d37:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804d39:	be 00 00 00 00       	mov    $0x0,%esi
+  804d3e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804d43:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  804d4a:	00 00 00 
+  804d4d:	ff d0                	call   *%rax
+}
+  804d4f:	c9                   	leave
+  804d50:	c3                   	ret
+
+0000000000804d51 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804d51:	55                   	push   %rbp
+  804d52:	48 89 e5             	mov    %rsp,%rbp
+  804d55:	48 83 ec 10          	sub    $0x10,%rsp
+  804d59:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804d5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d61:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804d66:	48 89 c7             	mov    %rax,%rdi
+  804d69:	48 b8 77 4d 80 00 00 	movabs $0x804d77,%rax
+  804d70:	00 00 00 
+  804d73:	ff d0                	call   *%rax
+}
+  804d75:	c9                   	leave
+  804d76:	c3                   	ret
+
+0000000000804d77 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804d77:	55                   	push   %rbp
+  804d78:	48 89 e5             	mov    %rsp,%rbp
+  804d7b:	48 83 ec 50          	sub    $0x50,%rsp
+  804d7f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804d83:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804d87:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804d8e:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804d8f:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804d94:	74 0a                	je     804da0 <pipe_size+0x29>
+  804d96:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804d9d:	00 
+  804d9e:	76 0a                	jbe    804daa <pipe_size+0x33>
+    return -E_INVAL;
+  804da0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804da5:	e9 cc 02 00 00       	jmp    805076 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804daa:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804dae:	48 89 c7             	mov    %rax,%rdi
+  804db1:	48 b8 73 38 80 00 00 	movabs $0x803873,%rax
+  804db8:	00 00 00 
+  804dbb:	ff d0                	call   *%rax
+  804dbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dc4:	0f 88 a8 02 00 00    	js     805072 <pipe_size+0x2fb>
+  804dca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dce:	ba 07 04 00 00       	mov    $0x407,%edx
+  804dd3:	48 89 c6             	mov    %rax,%rsi
+  804dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ddb:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  804de2:	00 00 00 
+  804de5:	ff d0                	call   *%rax
+  804de7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dee:	0f 88 7e 02 00 00    	js     805072 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804df4:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804df8:	48 89 c7             	mov    %rax,%rdi
+  804dfb:	48 b8 73 38 80 00 00 	movabs $0x803873,%rax
+  804e02:	00 00 00 
+  804e05:	ff d0                	call   *%rax
+  804e07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e0a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e0e:	0f 88 43 02 00 00    	js     805057 <pipe_size+0x2e0>
+  804e14:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e18:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e1d:	48 89 c6             	mov    %rax,%rsi
+  804e20:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e25:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  804e2c:	00 00 00 
+  804e2f:	ff d0                	call   *%rax
+  804e31:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e34:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e38:	0f 88 19 02 00 00    	js     805057 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804e3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e42:	48 89 c7             	mov    %rax,%rdi
+  804e45:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  804e4c:	00 00 00 
+  804e4f:	ff d0                	call   *%rax
+  804e51:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804e55:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804e5c:	00 
+  804e5d:	e9 a2 00 00 00       	jmp    804f04 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804e62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e66:	48 c1 e0 0c          	shl    $0xc,%rax
+  804e6a:	48 89 c2             	mov    %rax,%rdx
+  804e6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e71:	48 01 d0             	add    %rdx,%rax
+  804e74:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e79:	48 89 c6             	mov    %rax,%rsi
+  804e7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e81:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  804e88:	00 00 00 
+  804e8b:	ff d0                	call   *%rax
+  804e8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e94:	0f 88 37 01 00 00    	js     804fd1 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804e9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e9e:	48 89 c7             	mov    %rax,%rdi
+  804ea1:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  804ea8:	00 00 00 
+  804eab:	ff d0                	call   *%rax
+  804ead:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804eb1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804eb5:	48 01 c2             	add    %rax,%rdx
+  804eb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ebc:	48 c1 e0 0c          	shl    $0xc,%rax
+  804ec0:	48 89 c1             	mov    %rax,%rcx
+  804ec3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec7:	48 01 c8             	add    %rcx,%rax
+  804eca:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804ed0:	48 89 d1             	mov    %rdx,%rcx
+  804ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ed8:	48 89 c6             	mov    %rax,%rsi
+  804edb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee0:	48 b8 fb 2e 80 00 00 	movabs $0x802efb,%rax
+  804ee7:	00 00 00 
+  804eea:	ff d0                	call   *%rax
+  804eec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804eef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ef3:	79 0a                	jns    804eff <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804ef5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804efa:	e9 d3 00 00 00       	jmp    804fd2 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804eff:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804f04:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804f0b:	00 
+  804f0c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804f10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f14:	48 01 d0             	add    %rdx,%rax
+  804f17:	48 83 c0 1f          	add    $0x1f,%rax
+  804f1b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804f1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f23:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f28:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804f2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f30:	48 29 d0             	sub    %rdx,%rax
+  804f33:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f37:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804f3b:	0f 82 21 ff ff ff    	jb     804e62 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f45:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804f49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f4d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804f51:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804f55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f59:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804f60:	00 00 00 
+  804f63:	8b 12                	mov    (%rdx),%edx
+  804f65:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804f67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f6b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804f72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f76:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804f7d:	00 00 00 
+  804f80:	8b 12                	mov    (%rdx),%edx
+  804f82:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804f84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f88:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804f8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f93:	48 89 c7             	mov    %rax,%rdi
+  804f96:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  804f9d:	00 00 00 
+  804fa0:	ff d0                	call   *%rax
+  804fa2:	89 c2                	mov    %eax,%edx
+  804fa4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804fa8:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804faa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fae:	48 89 c7             	mov    %rax,%rdi
+  804fb1:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  804fb8:	00 00 00 
+  804fbb:	ff d0                	call   *%rax
+  804fbd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804fc1:	48 83 c2 04          	add    $0x4,%rdx
+  804fc5:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fcc:	e9 a5 00 00 00       	jmp    805076 <pipe_size+0x2ff>
+      goto err2;
+  804fd1:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804fd2:	eb 58                	jmp    80502c <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804fd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fd8:	48 c1 e0 0c          	shl    $0xc,%rax
+  804fdc:	48 89 c2             	mov    %rax,%rdx
+  804fdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fe3:	48 01 d0             	add    %rdx,%rax
+  804fe6:	48 89 c6             	mov    %rax,%rsi
+  804fe9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fee:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  804ff5:	00 00 00 
+  804ff8:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804ffa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ffe:	48 89 c7             	mov    %rax,%rdi
+  805001:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  805008:	00 00 00 
+  80500b:	ff d0                	call   *%rax
+  80500d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805011:	48 c1 e2 0c          	shl    $0xc,%rdx
+  805015:	48 01 d0             	add    %rdx,%rax
+  805018:	48 89 c6             	mov    %rax,%rsi
+  80501b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805020:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  805027:	00 00 00 
+  80502a:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  80502c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805030:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805034:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  805038:	48 85 c0             	test   %rax,%rax
+  80503b:	75 97                	jne    804fd4 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  80503d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805041:	48 89 c6             	mov    %rax,%rsi
+  805044:	bf 00 00 00 00       	mov    $0x0,%edi
+  805049:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  805050:	00 00 00 
+  805053:	ff d0                	call   *%rax
+  805055:	eb 01                	jmp    805058 <pipe_size+0x2e1>
+    goto err1;
+  805057:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  805058:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80505c:	48 89 c6             	mov    %rax,%rsi
+  80505f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805064:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  80506b:	00 00 00 
+  80506e:	ff d0                	call   *%rax
+  805070:	eb 01                	jmp    805073 <pipe_size+0x2fc>
+    goto err;
+  805072:	90                   	nop
+err:
+  return r;
+  805073:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805076:	c9                   	leave
+  805077:	c3                   	ret
+
+0000000000805078 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  805078:	55                   	push   %rbp
+  805079:	48 89 e5             	mov    %rsp,%rbp
+  80507c:	53                   	push   %rbx
+  80507d:	48 83 ec 28          	sub    $0x28,%rsp
+  805081:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805085:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  805089:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805090:	00 00 00 
+  805093:	8b 40 04             	mov    0x4(%rax),%eax
+  805096:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80509b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8050a2:	00 00 00 
+  8050a5:	48 98                	cltq
+  8050a7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8050ae:	48 01 d0             	add    %rdx,%rax
+  8050b1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8050b7:	8b 00                	mov    (%rax),%eax
+  8050b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8050bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050c0:	48 89 c7             	mov    %rax,%rdi
+  8050c3:	48 b8 ce 5c 80 00 00 	movabs $0x805cce,%rax
+  8050ca:	00 00 00 
+  8050cd:	ff d0                	call   *%rax
+  8050cf:	89 c3                	mov    %eax,%ebx
+  8050d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050d5:	48 89 c7             	mov    %rax,%rdi
+  8050d8:	48 b8 ce 5c 80 00 00 	movabs $0x805cce,%rax
+  8050df:	00 00 00 
+  8050e2:	ff d0                	call   *%rax
+  8050e4:	39 c3                	cmp    %eax,%ebx
+  8050e6:	0f 94 c0             	sete   %al
+  8050e9:	0f b6 c0             	movzbl %al,%eax
+  8050ec:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8050ef:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8050f6:	00 00 00 
+  8050f9:	8b 40 04             	mov    0x4(%rax),%eax
+  8050fc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805101:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805108:	00 00 00 
+  80510b:	48 98                	cltq
+  80510d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805114:	48 01 d0             	add    %rdx,%rax
+  805117:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80511d:	8b 00                	mov    (%rax),%eax
+  80511f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  805122:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805125:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805128:	75 05                	jne    80512f <_pipeisclosed+0xb7>
+      return ret;
+  80512a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80512d:	eb 68                	jmp    805197 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80512f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805132:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805135:	0f 84 4e ff ff ff    	je     805089 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80513b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805142:	00 00 00 
+  805145:	8b 40 04             	mov    0x4(%rax),%eax
+  805148:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80514d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805154:	00 00 00 
+  805157:	48 98                	cltq
+  805159:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805160:	48 01 d0             	add    %rdx,%rax
+  805163:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805169:	8b 10                	mov    (%rax),%edx
+  80516b:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80516e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805171:	89 c6                	mov    %eax,%esi
+  805173:	48 b8 70 68 80 00 00 	movabs $0x806870,%rax
+  80517a:	00 00 00 
+  80517d:	48 89 c7             	mov    %rax,%rdi
+  805180:	b8 00 00 00 00       	mov    $0x0,%eax
+  805185:	49 b8 25 11 80 00 00 	movabs $0x801125,%r8
+  80518c:	00 00 00 
+  80518f:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  805192:	e9 f2 fe ff ff       	jmp    805089 <_pipeisclosed+0x11>
+  }
+}
+  805197:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80519b:	c9                   	leave
+  80519c:	c3                   	ret
+
+000000000080519d <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  80519d:	55                   	push   %rbp
+  80519e:	48 89 e5             	mov    %rsp,%rbp
+  8051a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8051a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8051a8:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8051ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051af:	48 89 d6             	mov    %rdx,%rsi
+  8051b2:	89 c7                	mov    %eax,%edi
+  8051b4:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  8051bb:	00 00 00 
+  8051be:	ff d0                	call   *%rax
+  8051c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051c7:	79 05                	jns    8051ce <pipeisclosed+0x31>
+    return r;
+  8051c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8051cc:	eb 31                	jmp    8051ff <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8051ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d2:	48 89 c7             	mov    %rax,%rdi
+  8051d5:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  8051dc:	00 00 00 
+  8051df:	ff d0                	call   *%rax
+  8051e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8051e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8051ed:	48 89 d6             	mov    %rdx,%rsi
+  8051f0:	48 89 c7             	mov    %rax,%rdi
+  8051f3:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  8051fa:	00 00 00 
+  8051fd:	ff d0                	call   *%rax
+}
+  8051ff:	c9                   	leave
+  805200:	c3                   	ret
+
+0000000000805201 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  805201:	55                   	push   %rbp
+  805202:	48 89 e5             	mov    %rsp,%rbp
+  805205:	48 83 ec 10          	sub    $0x10,%rsp
+  805209:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80520d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805211:	8b 40 18             	mov    0x18(%rax),%eax
+  805214:	8d 50 01             	lea    0x1(%rax),%edx
+  805217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80521b:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  80521e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805222:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805225:	85 c0                	test   %eax,%eax
+  805227:	74 27                	je     805250 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  805229:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80522d:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805234:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805238:	48 83 c0 18          	add    $0x18,%rax
+  80523c:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  805241:	48 89 c7             	mov    %rax,%rdi
+  805244:	48 b8 9e 32 80 00 00 	movabs $0x80329e,%rax
+  80524b:	00 00 00 
+  80524e:	ff d0                	call   *%rax
+  }
+}
+  805250:	90                   	nop
+  805251:	c9                   	leave
+  805252:	c3                   	ret
+
+0000000000805253 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  805253:	55                   	push   %rbp
+  805254:	48 89 e5             	mov    %rsp,%rbp
+  805257:	48 83 ec 10          	sub    $0x10,%rsp
+  80525b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80525f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  805262:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805266:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80526d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805271:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805275:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805278:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80527f:	89 c6                	mov    %eax,%esi
+  805281:	48 89 cf             	mov    %rcx,%rdi
+  805284:	48 b8 4f 32 80 00 00 	movabs $0x80324f,%rax
+  80528b:	00 00 00 
+  80528e:	ff d0                	call   *%rax
+}
+  805290:	90                   	nop
+  805291:	c9                   	leave
+  805292:	c3                   	ret
+
+0000000000805293 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805293:	55                   	push   %rbp
+  805294:	48 89 e5             	mov    %rsp,%rbp
+  805297:	48 83 ec 70          	sub    $0x70,%rsp
+  80529b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80529f:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8052a3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8052a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8052ab:	48 89 c7             	mov    %rax,%rdi
+  8052ae:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  8052b5:	00 00 00 
+  8052b8:	ff d0                	call   *%rax
+  8052ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8052be:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8052c3:	75 0a                	jne    8052cf <devpipe_read+0x3c>
+    return 0;
+  8052c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ca:	e9 63 01 00 00       	jmp    805432 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8052cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052d3:	8b 40 18             	mov    0x18(%rax),%eax
+  8052d6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8052d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052dd:	48 8b 10             	mov    (%rax),%rdx
+  8052e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8052e8:	48 39 c2             	cmp    %rax,%rdx
+  8052eb:	75 42                	jne    80532f <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8052ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8052f5:	48 89 d6             	mov    %rdx,%rsi
+  8052f8:	48 89 c7             	mov    %rax,%rdi
+  8052fb:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  805302:	00 00 00 
+  805305:	ff d0                	call   *%rax
+  805307:	85 c0                	test   %eax,%eax
+  805309:	74 0a                	je     805315 <devpipe_read+0x82>
+      return 0;
+  80530b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805310:	e9 1d 01 00 00       	jmp    805432 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  805315:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80531c:	89 d6                	mov    %edx,%esi
+  80531e:	48 89 c7             	mov    %rax,%rdi
+  805321:	48 b8 53 52 80 00 00 	movabs $0x805253,%rax
+  805328:	00 00 00 
+  80532b:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80532d:	eb a0                	jmp    8052cf <devpipe_read+0x3c>
+      break;
+  80532f:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  805330:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805334:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  805338:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80533c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805344:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80534c:	48 8b 00             	mov    (%rax),%rax
+  80534f:	48 29 c2             	sub    %rax,%rdx
+  805352:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805356:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80535a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80535e:	48 39 c2             	cmp    %rax,%rdx
+  805361:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805365:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  805369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80536d:	48 8b 00             	mov    (%rax),%rax
+  805370:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805374:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80537d:	48 f7 f1             	div    %rcx
+  805380:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805384:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805388:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80538c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805390:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805394:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805398:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80539c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053a4:	48 39 c2             	cmp    %rax,%rdx
+  8053a7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8053ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8053af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053b3:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8053b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053bb:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8053bf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8053c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053c7:	48 89 ce             	mov    %rcx,%rsi
+  8053ca:	48 89 c7             	mov    %rax,%rdi
+  8053cd:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  8053d4:	00 00 00 
+  8053d7:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8053d9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8053dd:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8053e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053e5:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8053e9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8053ed:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8053f1:	48 01 d1             	add    %rdx,%rcx
+  8053f4:	48 89 c2             	mov    %rax,%rdx
+  8053f7:	48 89 cf             	mov    %rcx,%rdi
+  8053fa:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  805401:	00 00 00 
+  805404:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  805406:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80540a:	48 8b 10             	mov    (%rax),%rdx
+  80540d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805411:	48 01 c2             	add    %rax,%rdx
+  805414:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805418:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80541b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80541f:	48 89 c7             	mov    %rax,%rdi
+  805422:	48 b8 01 52 80 00 00 	movabs $0x805201,%rax
+  805429:	00 00 00 
+  80542c:	ff d0                	call   *%rax
+  return n;
+  80542e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  805432:	c9                   	leave
+  805433:	c3                   	ret
+
+0000000000805434 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805434:	55                   	push   %rbp
+  805435:	48 89 e5             	mov    %rsp,%rbp
+  805438:	48 83 ec 70          	sub    $0x70,%rsp
+  80543c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805440:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805444:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805448:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80544c:	48 89 c7             	mov    %rax,%rdi
+  80544f:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  805456:	00 00 00 
+  805459:	ff d0                	call   *%rax
+  80545b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80545f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805463:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805467:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80546e:	00 
+  80546f:	e9 b8 01 00 00       	jmp    80562c <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805478:	8b 40 18             	mov    0x18(%rax),%eax
+  80547b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80547e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805482:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80548a:	48 8b 00             	mov    (%rax),%rax
+  80548d:	48 29 c2             	sub    %rax,%rdx
+  805490:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805494:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805498:	48 39 c2             	cmp    %rax,%rdx
+  80549b:	75 4d                	jne    8054ea <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80549d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8054a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8054a5:	48 89 d6             	mov    %rdx,%rsi
+  8054a8:	48 89 c7             	mov    %rax,%rdi
+  8054ab:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  8054b2:	00 00 00 
+  8054b5:	ff d0                	call   *%rax
+  8054b7:	85 c0                	test   %eax,%eax
+  8054b9:	74 0a                	je     8054c5 <devpipe_write+0x91>
+        return 0;
+  8054bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054c0:	e9 79 01 00 00       	jmp    80563e <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8054c5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8054c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054cc:	89 d6                	mov    %edx,%esi
+  8054ce:	48 89 c7             	mov    %rax,%rdi
+  8054d1:	48 b8 53 52 80 00 00 	movabs $0x805253,%rax
+  8054d8:	00 00 00 
+  8054db:	ff d0                	call   *%rax
+      m = 0;
+  8054dd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8054e4:	00 
+      continue;
+  8054e5:	e9 3a 01 00 00       	jmp    805624 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8054ea:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8054ee:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8054f2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8054f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054fa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8054fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805502:	48 8b 08             	mov    (%rax),%rcx
+  805505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805509:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80550d:	48 29 c1             	sub    %rax,%rcx
+  805510:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  805514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805518:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80551c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805520:	48 39 c2             	cmp    %rax,%rdx
+  805523:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805527:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80552b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80552f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805533:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805537:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80553b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805540:	48 f7 f1             	div    %rcx
+  805543:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805547:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80554b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80554f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805553:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805557:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80555b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80555f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805563:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805567:	48 39 c2             	cmp    %rax,%rdx
+  80556a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80556e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805572:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805576:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80557a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80557e:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805582:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805586:	48 01 d1             	add    %rdx,%rcx
+  805589:	48 89 c2             	mov    %rax,%rdx
+  80558c:	48 89 cf             	mov    %rcx,%rdi
+  80558f:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  805596:	00 00 00 
+  805599:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80559b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80559f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8055a3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8055a7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8055ab:	73 4d                	jae    8055fa <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8055ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8055b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8055b9:	48 29 c2             	sub    %rax,%rdx
+  8055bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055c0:	48 01 c2             	add    %rax,%rdx
+  8055c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8055cb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8055cf:	48 89 c1             	mov    %rax,%rcx
+  8055d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055d6:	48 01 c1             	add    %rax,%rcx
+  8055d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055dd:	48 01 c1             	add    %rax,%rcx
+  8055e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055e4:	48 83 c0 20          	add    $0x20,%rax
+  8055e8:	48 89 ce             	mov    %rcx,%rsi
+  8055eb:	48 89 c7             	mov    %rax,%rdi
+  8055ee:	48 b8 1e 28 80 00 00 	movabs $0x80281e,%rax
+  8055f5:	00 00 00 
+  8055f8:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8055fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055fe:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805606:	48 01 c2             	add    %rax,%rdx
+  805609:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80560d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805611:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805615:	48 89 c7             	mov    %rax,%rdi
+  805618:	48 b8 01 52 80 00 00 	movabs $0x805201,%rax
+  80561f:	00 00 00 
+  805622:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805624:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805628:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80562c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805630:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805634:	0f 82 3a fe ff ff    	jb     805474 <devpipe_write+0x40>
+  }
+
+  return i;
+  80563a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80563e:	c9                   	leave
+  80563f:	c3                   	ret
+
+0000000000805640 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805640:	55                   	push   %rbp
+  805641:	48 89 e5             	mov    %rsp,%rbp
+  805644:	48 83 ec 40          	sub    $0x40,%rsp
+  805648:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80564c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80564f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805653:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805657:	48 89 c7             	mov    %rax,%rdi
+  80565a:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  805661:	00 00 00 
+  805664:	ff d0                	call   *%rax
+  805666:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80566a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805671:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805675:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805679:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80567d:	48 89 d6             	mov    %rdx,%rsi
+  805680:	48 89 c7             	mov    %rax,%rdi
+  805683:	48 b8 1b 43 80 00 00 	movabs $0x80431b,%rax
+  80568a:	00 00 00 
+  80568d:	ff d0                	call   *%rax
+  80568f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805692:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805696:	79 08                	jns    8056a0 <devpipe_poll+0x60>
+    return r;
+  805698:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80569b:	e9 85 00 00 00       	jmp    805725 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8056a0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8056a3:	83 e0 01             	and    $0x1,%eax
+  8056a6:	85 c0                	test   %eax,%eax
+  8056a8:	74 18                	je     8056c2 <devpipe_poll+0x82>
+  8056aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056ae:	48 8b 10             	mov    (%rax),%rdx
+  8056b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8056b9:	48 39 c2             	cmp    %rax,%rdx
+  8056bc:	74 04                	je     8056c2 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8056be:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8056c2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8056c5:	83 e0 02             	and    $0x2,%eax
+  8056c8:	85 c0                	test   %eax,%eax
+  8056ca:	74 23                	je     8056ef <devpipe_poll+0xaf>
+  8056cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056d0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8056d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056d8:	48 8b 00             	mov    (%rax),%rax
+  8056db:	48 29 c2             	sub    %rax,%rdx
+  8056de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056e2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8056e6:	48 39 c2             	cmp    %rax,%rdx
+  8056e9:	73 04                	jae    8056ef <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8056eb:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8056ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8056f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056f7:	48 89 d6             	mov    %rdx,%rsi
+  8056fa:	48 89 c7             	mov    %rax,%rdi
+  8056fd:	48 b8 78 50 80 00 00 	movabs $0x805078,%rax
+  805704:	00 00 00 
+  805707:	ff d0                	call   *%rax
+  805709:	85 c0                	test   %eax,%eax
+  80570b:	74 04                	je     805711 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80570d:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805711:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805715:	75 0b                	jne    805722 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805717:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80571b:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805722:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805725:	c9                   	leave
+  805726:	c3                   	ret
+
+0000000000805727 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805727:	55                   	push   %rbp
+  805728:	48 89 e5             	mov    %rsp,%rbp
+  80572b:	48 83 ec 20          	sub    $0x20,%rsp
+  80572f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805733:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80573b:	48 89 c7             	mov    %rax,%rdi
+  80573e:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  805745:	00 00 00 
+  805748:	ff d0                	call   *%rax
+  80574a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80574e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805752:	48 ba a1 68 80 00 00 	movabs $0x8068a1,%rdx
+  805759:	00 00 00 
+  80575c:	48 89 d6             	mov    %rdx,%rsi
+  80575f:	48 89 c7             	mov    %rax,%rdi
+  805762:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  805769:	00 00 00 
+  80576c:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80576e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805772:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805776:	89 c1                	mov    %eax,%ecx
+  805778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80577c:	48 8b 00             	mov    (%rax),%rax
+  80577f:	89 c2                	mov    %eax,%edx
+  805781:	89 c8                	mov    %ecx,%eax
+  805783:	29 d0                	sub    %edx,%eax
+  805785:	89 c2                	mov    %eax,%edx
+  805787:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80578b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805791:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805795:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80579c:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80579f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057a3:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8057aa:	00 00 00 
+  8057ad:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8057b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b9:	c9                   	leave
+  8057ba:	c3                   	ret
+
+00000000008057bb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8057bb:	55                   	push   %rbp
+  8057bc:	48 89 e5             	mov    %rsp,%rbp
+  8057bf:	48 83 ec 40          	sub    $0x40,%rsp
+  8057c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8057c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057cb:	48 89 c7             	mov    %rax,%rdi
+  8057ce:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  8057d5:	00 00 00 
+  8057d8:	ff d0                	call   *%rax
+  8057da:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8057de:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8057e5:	00 
+  8057e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057ea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8057ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057f2:	48 01 d0             	add    %rdx,%rax
+  8057f5:	48 83 c0 1f          	add    $0x1f,%rax
+  8057f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8057fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805801:	ba 00 00 00 00       	mov    $0x0,%edx
+  805806:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80580a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80580e:	48 29 d0             	sub    %rdx,%rax
+  805811:	48 c1 e8 0c          	shr    $0xc,%rax
+  805815:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805819:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80581d:	48 89 c6             	mov    %rax,%rsi
+  805820:	bf 00 00 00 00       	mov    $0x0,%edi
+  805825:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  80582c:	00 00 00 
+  80582f:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805835:	48 89 c7             	mov    %rax,%rdi
+  805838:	48 b8 01 52 80 00 00 	movabs $0x805201,%rax
+  80583f:	00 00 00 
+  805842:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805844:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805848:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80584c:	eb 2f                	jmp    80587d <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80584e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805852:	48 83 e8 01          	sub    $0x1,%rax
+  805856:	48 c1 e0 0c          	shl    $0xc,%rax
+  80585a:	48 89 c2             	mov    %rax,%rdx
+  80585d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805861:	48 01 d0             	add    %rdx,%rax
+  805864:	48 89 c6             	mov    %rax,%rsi
+  805867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80586c:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  805873:	00 00 00 
+  805876:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805878:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80587d:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805882:	77 ca                	ja     80584e <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805884:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805888:	48 89 c6             	mov    %rax,%rsi
+  80588b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805890:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  805897:	00 00 00 
+  80589a:	ff d0                	call   *%rax
+}
+  80589c:	c9                   	leave
+  80589d:	c3                   	ret
+
+000000000080589e <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80589e:	55                   	push   %rbp
+  80589f:	48 89 e5             	mov    %rsp,%rbp
+  8058a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8058a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8058a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058ad:	75 10                	jne    8058bf <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8058af:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8058b6:	00 00 00 
+  8058b9:	8b 00                	mov    (%rax),%eax
+  8058bb:	48 98                	cltq
+  8058bd:	eb 05                	jmp    8058c4 <vsyscall+0x26>
+  }
+  return 0;
+  8058bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058c4:	c9                   	leave
+  8058c5:	c3                   	ret
+
+00000000008058c6 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8058c6:	55                   	push   %rbp
+  8058c7:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8058ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058cf:	48 b8 9e 58 80 00 00 	movabs $0x80589e,%rax
+  8058d6:	00 00 00 
+  8058d9:	ff d0                	call   *%rax
+}
+  8058db:	5d                   	pop    %rbp
+  8058dc:	c3                   	ret
+
+00000000008058dd <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8058dd:	55                   	push   %rbp
+  8058de:	48 89 e5             	mov    %rsp,%rbp
+  8058e1:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8058e5:	0f 31                	rdtsc
+  8058e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058ea:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8058ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058f0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8058f3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8058f7:	48 09 d0             	or     %rdx,%rax
+  8058fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8058fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805902:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805906:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80590d:	00 00 00 
+  805910:	8b 40 08             	mov    0x8(%rax),%eax
+  805913:	48 98                	cltq
+  805915:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805919:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80591d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805922:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805926:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80592d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805931:	ba 00 00 00 00       	mov    $0x0,%edx
+  805936:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80593a:	48 89 d0             	mov    %rdx,%rax
+  80593d:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805944:	ba 00 00 00 00       	mov    $0x0,%edx
+  805949:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80594d:	48 01 c8             	add    %rcx,%rax
+}
+  805950:	c9                   	leave
+  805951:	c3                   	ret
+
+0000000000805952 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805952:	55                   	push   %rbp
+  805953:	48 89 e5             	mov    %rsp,%rbp
+  805956:	48 83 ec 20          	sub    $0x20,%rsp
+  80595a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80595d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805960:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805963:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805967:	be 01 00 00 00       	mov    $0x1,%esi
+  80596c:	48 89 c7             	mov    %rax,%rdi
+  80596f:	48 b8 8c 2c 80 00 00 	movabs $0x802c8c,%rax
+  805976:	00 00 00 
+  805979:	ff d0                	call   *%rax
+}
+  80597b:	90                   	nop
+  80597c:	c9                   	leave
+  80597d:	c3                   	ret
+
+000000000080597e <getchar>:
+
+int
+getchar(void) {
+  80597e:	55                   	push   %rbp
+  80597f:	48 89 e5             	mov    %rsp,%rbp
+  805982:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805986:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  80598a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80598f:	48 89 c6             	mov    %rax,%rsi
+  805992:	bf 00 00 00 00       	mov    $0x0,%edi
+  805997:	48 b8 b1 3e 80 00 00 	movabs $0x803eb1,%rax
+  80599e:	00 00 00 
+  8059a1:	ff d0                	call   *%rax
+  8059a3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8059a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059aa:	79 05                	jns    8059b1 <getchar+0x33>
+    return r;
+  8059ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059af:	eb 14                	jmp    8059c5 <getchar+0x47>
+  if (r < 1)
+  8059b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059b5:	7f 07                	jg     8059be <getchar+0x40>
+    return -E_EOF;
+  8059b7:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8059bc:	eb 07                	jmp    8059c5 <getchar+0x47>
+  return c;
+  8059be:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8059c2:	0f b6 c0             	movzbl %al,%eax
+}
+  8059c5:	c9                   	leave
+  8059c6:	c3                   	ret
+
+00000000008059c7 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8059c7:	55                   	push   %rbp
+  8059c8:	48 89 e5             	mov    %rsp,%rbp
+  8059cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8059cf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8059d2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8059d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059d9:	48 89 d6             	mov    %rdx,%rsi
+  8059dc:	89 c7                	mov    %eax,%edi
+  8059de:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  8059e5:	00 00 00 
+  8059e8:	ff d0                	call   *%rax
+  8059ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059f1:	79 05                	jns    8059f8 <iscons+0x31>
+    return r;
+  8059f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059f6:	eb 1a                	jmp    805a12 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8059f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059fc:	8b 10                	mov    (%rax),%edx
+  8059fe:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805a05:	00 00 00 
+  805a08:	8b 00                	mov    (%rax),%eax
+  805a0a:	39 c2                	cmp    %eax,%edx
+  805a0c:	0f 94 c0             	sete   %al
+  805a0f:	0f b6 c0             	movzbl %al,%eax
+}
+  805a12:	c9                   	leave
+  805a13:	c3                   	ret
+
+0000000000805a14 <opencons>:
+
+int
+opencons(void) {
+  805a14:	55                   	push   %rbp
+  805a15:	48 89 e5             	mov    %rsp,%rbp
+  805a18:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805a1c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805a20:	48 89 c7             	mov    %rax,%rdi
+  805a23:	48 b8 73 38 80 00 00 	movabs $0x803873,%rax
+  805a2a:	00 00 00 
+  805a2d:	ff d0                	call   *%rax
+  805a2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a36:	79 05                	jns    805a3d <opencons+0x29>
+    return r;
+  805a38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a3b:	eb 66                	jmp    805aa3 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805a3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a41:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a46:	48 89 c6             	mov    %rax,%rsi
+  805a49:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a4e:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  805a55:	00 00 00 
+  805a58:	ff d0                	call   *%rax
+  805a5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a61:	79 05                	jns    805a68 <opencons+0x54>
+    return r;
+  805a63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a66:	eb 3b                	jmp    805aa3 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805a68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a6c:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805a73:	00 00 00 
+  805a76:	8b 12                	mov    (%rdx),%edx
+  805a78:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805a7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a7e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a89:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a94:	48 89 c7             	mov    %rax,%rdi
+  805a97:	48 b8 25 38 80 00 00 	movabs $0x803825,%rax
+  805a9e:	00 00 00 
+  805aa1:	ff d0                	call   *%rax
+}
+  805aa3:	c9                   	leave
+  805aa4:	c3                   	ret
+
+0000000000805aa5 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805aa5:	55                   	push   %rbp
+  805aa6:	48 89 e5             	mov    %rsp,%rbp
+  805aa9:	48 83 ec 20          	sub    $0x20,%rsp
+  805aad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805ab0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805ab3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805ab7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aba:	48 89 d6             	mov    %rdx,%rsi
+  805abd:	89 c7                	mov    %eax,%edi
+  805abf:	48 b8 55 39 80 00 00 	movabs $0x803955,%rax
+  805ac6:	00 00 00 
+  805ac9:	ff d0                	call   *%rax
+  805acb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ace:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ad2:	79 05                	jns    805ad9 <consmode+0x34>
+    return r;
+  805ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ad7:	eb 34                	jmp    805b0d <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805ad9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805add:	8b 10                	mov    (%rax),%edx
+  805adf:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805ae6:	00 00 00 
+  805ae9:	8b 00                	mov    (%rax),%eax
+  805aeb:	39 c2                	cmp    %eax,%edx
+  805aed:	74 07                	je     805af6 <consmode+0x51>
+    return -E_INVAL;
+  805aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805af4:	eb 17                	jmp    805b0d <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805afa:	8b 40 0c             	mov    0xc(%rax),%eax
+  805afd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805b00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b04:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b07:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805b0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805b0d:	c9                   	leave
+  805b0e:	c3                   	ret
+
+0000000000805b0f <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805b0f:	55                   	push   %rbp
+  805b10:	48 89 e5             	mov    %rsp,%rbp
+  805b13:	48 83 ec 20          	sub    $0x20,%rsp
+  805b17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805b1f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805b23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b27:	8b 50 0c             	mov    0xc(%rax),%edx
+  805b2a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805b2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b32:	48 89 ce             	mov    %rcx,%rsi
+  805b35:	48 89 c7             	mov    %rax,%rdi
+  805b38:	48 b8 fd 31 80 00 00 	movabs $0x8031fd,%rax
+  805b3f:	00 00 00 
+  805b42:	ff d0                	call   *%rax
+  805b44:	48 98                	cltq
+}
+  805b46:	c9                   	leave
+  805b47:	c3                   	ret
+
+0000000000805b48 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805b48:	55                   	push   %rbp
+  805b49:	48 89 e5             	mov    %rsp,%rbp
+  805b4c:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805b53:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805b5a:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805b61:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805b68:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805b6f:	eb 74                	jmp    805be5 <devcons_write+0x9d>
+    m = n - tot;
+  805b71:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805b78:	89 c2                	mov    %eax,%edx
+  805b7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b7d:	29 c2                	sub    %eax,%edx
+  805b7f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805b82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b85:	83 f8 7f             	cmp    $0x7f,%eax
+  805b88:	76 07                	jbe    805b91 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805b8a:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805b91:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b94:	48 63 d0             	movslq %eax,%rdx
+  805b97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b9a:	48 63 c8             	movslq %eax,%rcx
+  805b9d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805ba4:	48 01 c1             	add    %rax,%rcx
+  805ba7:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805bae:	48 89 ce             	mov    %rcx,%rsi
+  805bb1:	48 89 c7             	mov    %rax,%rdi
+  805bb4:	48 b8 18 26 80 00 00 	movabs $0x802618,%rax
+  805bbb:	00 00 00 
+  805bbe:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805bc0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805bc3:	48 63 d0             	movslq %eax,%rdx
+  805bc6:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805bcd:	48 89 d6             	mov    %rdx,%rsi
+  805bd0:	48 89 c7             	mov    %rax,%rdi
+  805bd3:	48 b8 8c 2c 80 00 00 	movabs $0x802c8c,%rax
+  805bda:	00 00 00 
+  805bdd:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805bdf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805be2:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805be5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805be8:	48 98                	cltq
+  805bea:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805bf1:	0f 82 7a ff ff ff    	jb     805b71 <devcons_write+0x29>
+  }
+  return tot;
+  805bf7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bfa:	48 98                	cltq
+}
+  805bfc:	c9                   	leave
+  805bfd:	c3                   	ret
+
+0000000000805bfe <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805bfe:	55                   	push   %rbp
+  805bff:	48 89 e5             	mov    %rsp,%rbp
+  805c02:	48 83 ec 08          	sub    $0x8,%rsp
+  805c06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c0f:	c9                   	leave
+  805c10:	c3                   	ret
+
+0000000000805c11 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805c11:	55                   	push   %rbp
+  805c12:	48 89 e5             	mov    %rsp,%rbp
+  805c15:	48 83 ec 10          	sub    $0x10,%rsp
+  805c19:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805c1d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805c21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c25:	48 ba ad 68 80 00 00 	movabs $0x8068ad,%rdx
+  805c2c:	00 00 00 
+  805c2f:	48 89 d6             	mov    %rdx,%rsi
+  805c32:	48 89 c7             	mov    %rax,%rdi
+  805c35:	48 b8 d5 20 80 00 00 	movabs $0x8020d5,%rax
+  805c3c:	00 00 00 
+  805c3f:	ff d0                	call   *%rax
+  return 0;
+  805c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c46:	c9                   	leave
+  805c47:	c3                   	ret
+
+0000000000805c48 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805c48:	55                   	push   %rbp
+  805c49:	48 89 e5             	mov    %rsp,%rbp
+  805c4c:	48 83 ec 30          	sub    $0x30,%rsp
+  805c50:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805c54:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805c57:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805c5b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805c62:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c65:	83 e0 02             	and    $0x2,%eax
+  805c68:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805c6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c6f:	8b 40 0c             	mov    0xc(%rax),%eax
+  805c72:	83 f8 01             	cmp    $0x1,%eax
+  805c75:	75 04                	jne    805c7b <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805c77:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805c7b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c7e:	83 e0 01             	and    $0x1,%eax
+  805c81:	85 c0                	test   %eax,%eax
+  805c83:	74 44                	je     805cc9 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805c85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805c8d:	89 c2                	mov    %eax,%edx
+  805c8f:	be 00 00 00 00       	mov    $0x0,%esi
+  805c94:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c99:	48 b8 eb 32 80 00 00 	movabs $0x8032eb,%rax
+  805ca0:	00 00 00 
+  805ca3:	ff d0                	call   *%rax
+  805ca5:	83 f8 01             	cmp    $0x1,%eax
+  805ca8:	75 06                	jne    805cb0 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805caa:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805cae:	eb 19                	jmp    805cc9 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805cb0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cb4:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805cba:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805cbd:	89 c2                	mov    %eax,%edx
+  805cbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cc3:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805cc9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805ccc:	c9                   	leave
+  805ccd:	c3                   	ret
+
+0000000000805cce <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805cce:	55                   	push   %rbp
+  805ccf:	48 89 e5             	mov    %rsp,%rbp
+  805cd2:	48 83 ec 18          	sub    $0x18,%rsp
+  805cd6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805cda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cde:	48 c1 e8 27          	shr    $0x27,%rax
+  805ce2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805ce7:	48 89 c2             	mov    %rax,%rdx
+  805cea:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805cf1:	01 00 00 
+  805cf4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805cf8:	83 e0 01             	and    $0x1,%eax
+  805cfb:	48 85 c0             	test   %rax,%rax
+  805cfe:	74 63                	je     805d63 <pageref+0x95>
+  805d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d04:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805d08:	48 89 c2             	mov    %rax,%rdx
+  805d0b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805d12:	01 00 00 
+  805d15:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d19:	83 e0 01             	and    $0x1,%eax
+  805d1c:	48 85 c0             	test   %rax,%rax
+  805d1f:	74 42                	je     805d63 <pageref+0x95>
+  805d21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d25:	48 c1 e8 15          	shr    $0x15,%rax
+  805d29:	48 89 c2             	mov    %rax,%rdx
+  805d2c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805d33:	01 00 00 
+  805d36:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d3a:	83 e0 01             	and    $0x1,%eax
+  805d3d:	48 85 c0             	test   %rax,%rax
+  805d40:	74 21                	je     805d63 <pageref+0x95>
+  805d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d46:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d4a:	48 89 c2             	mov    %rax,%rdx
+  805d4d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805d54:	01 00 00 
+  805d57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d5b:	83 e0 01             	and    $0x1,%eax
+  805d5e:	48 85 c0             	test   %rax,%rax
+  805d61:	75 07                	jne    805d6a <pageref+0x9c>
+    return 0;
+  805d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d68:	eb 53                	jmp    805dbd <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805d6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d6e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d72:	48 89 c2             	mov    %rax,%rdx
+  805d75:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805d7c:	01 00 00 
+  805d7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d83:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d8b:	83 e0 01             	and    $0x1,%eax
+  805d8e:	48 85 c0             	test   %rax,%rax
+  805d91:	75 07                	jne    805d9a <pageref+0xcc>
+    return 0;
+  805d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d98:	eb 23                	jmp    805dbd <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805d9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d9e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805da2:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805da9:	00 00 00 
+  805dac:	48 c1 e0 04          	shl    $0x4,%rax
+  805db0:	48 01 d0             	add    %rdx,%rax
+  805db3:	48 83 c0 08          	add    $0x8,%rax
+  805db7:	0f b7 00             	movzwl (%rax),%eax
+  805dba:	0f b7 c0             	movzwl %ax,%eax
+}
+  805dbd:	c9                   	leave
+  805dbe:	c3                   	ret
+  805dbf:	90                   	nop
@@ -0,0 +1,10249 @@
+
+obj/user/testfpu:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 fb 02 00 00       	call   800327 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <sum>:
+
+// Each env keeps a running sum in SIMD registers across context
+// switches; if the kernel mixed up their FPU state, the sums would
+// come out wrong.
+static double
+sum(double step, int n) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	f2 0f 11 45 e8       	movsd  %xmm0,-0x18(%rbp)
+  80003f:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  double x = 0;
+  800042:	48 b8 70 66 80 00 00 	movabs $0x806670,%rax
+  800049:	00 00 00 
+  80004c:	f2 0f 10 00          	movsd  (%rax),%xmm0
+  800050:	f2 0f 11 45 f8       	movsd  %xmm0,-0x8(%rbp)
+  int i;
+
+  for (i = 0; i < n; i++) {
+  800055:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80005c:	eb 45                	jmp    8000a3 <sum+0x71>
+    x += step;
+  80005e:	f2 0f 10 45 f8       	movsd  -0x8(%rbp),%xmm0
+  800063:	f2 0f 58 45 e8       	addsd  -0x18(%rbp),%xmm0
+  800068:	f2 0f 11 45 f8       	movsd  %xmm0,-0x8(%rbp)
+    if (i % 100 == 0)
+  80006d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800070:	48 63 c2             	movslq %edx,%rax
+  800073:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  80007a:	48 c1 e8 20          	shr    $0x20,%rax
+  80007e:	c1 f8 05             	sar    $0x5,%eax
+  800081:	89 d1                	mov    %edx,%ecx
+  800083:	c1 f9 1f             	sar    $0x1f,%ecx
+  800086:	29 c8                	sub    %ecx,%eax
+  800088:	6b c8 64             	imul   $0x64,%eax,%ecx
+  80008b:	89 d0                	mov    %edx,%eax
+  80008d:	29 c8                	sub    %ecx,%eax
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	75 0c                	jne    80009f <sum+0x6d>
+      sys_yield();
+  800093:	48 b8 2e 23 80 00 00 	movabs $0x80232e,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i++) {
+  80009f:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8000a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000a6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8000a9:	7c b3                	jl     80005e <sum+0x2c>
+  }
+  return x;
+  8000ab:	f2 0f 10 45 f8       	movsd  -0x8(%rbp),%xmm0
+  8000b0:	66 48 0f 7e c0       	movq   %xmm0,%rax
+}
+  8000b5:	66 48 0f 6e c0       	movq   %rax,%xmm0
+  8000ba:	c9                   	leave
+  8000bb:	c3                   	ret
+
+00000000008000bc <cow_keeps_xmm>:
+static char cow[16][PGSIZE] __attribute__((aligned(PGSIZE)));
+
+// Write to each page of 'cow' with a value live in %xmm0: the page
+// fault handler copying the page must leave it alone.
+static bool
+cow_keeps_xmm(double v) {
+  8000bc:	55                   	push   %rbp
+  8000bd:	48 89 e5             	mov    %rsp,%rbp
+  8000c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8000c4:	f2 0f 11 45 e8       	movsd  %xmm0,-0x18(%rbp)
+  double out;
+  int i;
+
+  for (i = 0; i < 16; i++) {
+  8000c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8000d0:	eb 47                	jmp    800119 <cow_keeps_xmm+0x5d>
+    asm volatile("movsd %1, %%xmm0\n"
+  8000d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000d5:	48 98                	cltq
+  8000d7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8000db:	48 89 c2             	mov    %rax,%rdx
+  8000de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000e5:	00 00 00 
+  8000e8:	48 01 d0             	add    %rdx,%rax
+  8000eb:	f2 0f 10 45 e8       	movsd  -0x18(%rbp),%xmm0
+  8000f0:	c6 00 01             	movb   $0x1,(%rax)
+  8000f3:	f2 0f 11 45 f0       	movsd  %xmm0,-0x10(%rbp)
+                 "movb $1, (%2)\n"
+                 "movsd %%xmm0, %0"
+                 : "=m"(out)
+                 : "m"(v), "r"(cow[i])
+                 : "xmm0", "memory");
+    if (out != v)
+  8000f8:	f2 0f 10 45 f0       	movsd  -0x10(%rbp),%xmm0
+  8000fd:	f2 0f 10 4d e8       	movsd  -0x18(%rbp),%xmm1
+  800102:	66 0f 2e c1          	ucomisd %xmm1,%xmm0
+  800106:	7a 06                	jp     80010e <cow_keeps_xmm+0x52>
+  800108:	66 0f 2e c1          	ucomisd %xmm1,%xmm0
+  80010c:	74 07                	je     800115 <cow_keeps_xmm+0x59>
+      return 0;
+  80010e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800113:	eb 0f                	jmp    800124 <cow_keeps_xmm+0x68>
+  for (i = 0; i < 16; i++) {
+  800115:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800119:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+  80011d:	7e b3                	jle    8000d2 <cow_keeps_xmm+0x16>
+  }
+  return 1;
+  80011f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800124:	c9                   	leave
+  800125:	c3                   	ret
+
+0000000000800126 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800126:	55                   	push   %rbp
+  800127:	48 89 e5             	mov    %rsp,%rbp
+  80012a:	48 83 ec 30          	sub    $0x30,%rsp
+  80012e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800131:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  envid_t pid;
+  double step, x;
+
+  memset(cow, 0, sizeof(cow));
+  800135:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80013a:	be 00 00 00 00       	mov    $0x0,%esi
+  80013f:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800146:	00 00 00 
+  800149:	48 89 c7             	mov    %rax,%rdi
+  80014c:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  800153:	00 00 00 
+  800156:	ff d0                	call   *%rax
+  if ((pid = fork()) < 0)
+  800158:	48 b8 04 32 80 00 00 	movabs $0x803204,%rax
+  80015f:	00 00 00 
+  800162:	ff d0                	call   *%rax
+  800164:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800167:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80016b:	79 36                	jns    8001a3 <umain+0x7d>
+    panic("fork: %i", pid);
+  80016d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800170:	89 c1                	mov    %eax,%ecx
+  800172:	48 b8 00 66 80 00 00 	movabs $0x806600,%rax
+  800179:	00 00 00 
+  80017c:	48 89 c2             	mov    %rax,%rdx
+  80017f:	be 31 00 00 00       	mov    $0x31,%esi
+  800184:	48 b8 09 66 80 00 00 	movabs $0x806609,%rax
+  80018b:	00 00 00 
+  80018e:	48 89 c7             	mov    %rax,%rdi
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  80019d:	00 00 00 
+  8001a0:	41 ff d0             	call   *%r8
+  step = pid ? 0.5 : 0.25;
+  8001a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001a7:	74 10                	je     8001b9 <umain+0x93>
+  8001a9:	48 b8 78 66 80 00 00 	movabs $0x806678,%rax
+  8001b0:	00 00 00 
+  8001b3:	f2 0f 10 00          	movsd  (%rax),%xmm0
+  8001b7:	eb 0e                	jmp    8001c7 <umain+0xa1>
+  8001b9:	48 b8 80 66 80 00 00 	movabs $0x806680,%rax
+  8001c0:	00 00 00 
+  8001c3:	f2 0f 10 00          	movsd  (%rax),%xmm0
+  8001c7:	f2 0f 11 45 f0       	movsd  %xmm0,-0x10(%rbp)
+  x    = sum(step, 1000);
+  8001cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001d0:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  8001d5:	66 48 0f 6e c0       	movq   %rax,%xmm0
+  8001da:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+  8001e6:	66 48 0f 7e c0       	movq   %xmm0,%rax
+  8001eb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (x != step * 1000)
+  8001ef:	f2 0f 10 4d f0       	movsd  -0x10(%rbp),%xmm1
+  8001f4:	48 b8 88 66 80 00 00 	movabs $0x806688,%rax
+  8001fb:	00 00 00 
+  8001fe:	f2 0f 10 00          	movsd  (%rax),%xmm0
+  800202:	f2 0f 59 c1          	mulsd  %xmm1,%xmm0
+  800206:	66 0f 2e 45 e8       	ucomisd -0x18(%rbp),%xmm0
+  80020b:	7a 07                	jp     800214 <umain+0xee>
+  80020d:	66 0f 2e 45 e8       	ucomisd -0x18(%rbp),%xmm0
+  800212:	74 50                	je     800264 <umain+0x13e>
+    panic("%s: sum is off", pid ? "parent" : "child");
+  800214:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800218:	74 0c                	je     800226 <umain+0x100>
+  80021a:	48 b8 18 66 80 00 00 	movabs $0x806618,%rax
+  800221:	00 00 00 
+  800224:	eb 0a                	jmp    800230 <umain+0x10a>
+  800226:	48 b8 1f 66 80 00 00 	movabs $0x80661f,%rax
+  80022d:	00 00 00 
+  800230:	48 89 c1             	mov    %rax,%rcx
+  800233:	48 b8 25 66 80 00 00 	movabs $0x806625,%rax
+  80023a:	00 00 00 
+  80023d:	48 89 c2             	mov    %rax,%rdx
+  800240:	be 35 00 00 00       	mov    $0x35,%esi
+  800245:	48 b8 09 66 80 00 00 	movabs $0x806609,%rax
+  80024c:	00 00 00 
+  80024f:	48 89 c7             	mov    %rax,%rdi
+  800252:	b8 00 00 00 00       	mov    $0x0,%eax
+  800257:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  80025e:	00 00 00 
+  800261:	41 ff d0             	call   *%r8
+  if (!cow_keeps_xmm(step))
+  800264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800268:	66 48 0f 6e c0       	movq   %rax,%xmm0
+  80026d:	48 b8 bc 00 80 00 00 	movabs $0x8000bc,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+  800279:	83 f0 01             	xor    $0x1,%eax
+  80027c:	84 c0                	test   %al,%al
+  80027e:	74 50                	je     8002d0 <umain+0x1aa>
+    panic("%s: page fault clobbered %%xmm0", pid ? "parent" : "child");
+  800280:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800284:	74 0c                	je     800292 <umain+0x16c>
+  800286:	48 b8 18 66 80 00 00 	movabs $0x806618,%rax
+  80028d:	00 00 00 
+  800290:	eb 0a                	jmp    80029c <umain+0x176>
+  800292:	48 b8 1f 66 80 00 00 	movabs $0x80661f,%rax
+  800299:	00 00 00 
+  80029c:	48 89 c1             	mov    %rax,%rcx
+  80029f:	48 b8 38 66 80 00 00 	movabs $0x806638,%rax
+  8002a6:	00 00 00 
+  8002a9:	48 89 c2             	mov    %rax,%rdx
+  8002ac:	be 37 00 00 00       	mov    $0x37,%esi
+  8002b1:	48 b8 09 66 80 00 00 	movabs $0x806609,%rax
+  8002b8:	00 00 00 
+  8002bb:	48 89 c7             	mov    %rax,%rdi
+  8002be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c3:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  8002ca:	00 00 00 
+  8002cd:	41 ff d0             	call   *%r8
+  if (pid)
+  8002d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8002d4:	74 11                	je     8002e7 <umain+0x1c1>
+    wait(pid);
+  8002d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d9:	89 c7                	mov    %eax,%edi
+  8002db:	48 b8 ab 52 80 00 00 	movabs $0x8052ab,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+  cprintf("%s: fpu test passed\n", pid ? "parent" : "child");
+  8002e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8002eb:	74 0c                	je     8002f9 <umain+0x1d3>
+  8002ed:	48 b8 18 66 80 00 00 	movabs $0x806618,%rax
+  8002f4:	00 00 00 
+  8002f7:	eb 0a                	jmp    800303 <umain+0x1dd>
+  8002f9:	48 b8 1f 66 80 00 00 	movabs $0x80661f,%rax
+  800300:	00 00 00 
+  800303:	48 89 c6             	mov    %rax,%rsi
+  800306:	48 b8 58 66 80 00 00 	movabs $0x806658,%rax
+  80030d:	00 00 00 
+  800310:	48 89 c7             	mov    %rax,%rdi
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	48 ba ed 05 80 00 00 	movabs $0x8005ed,%rdx
+  80031f:	00 00 00 
+  800322:	ff d2                	call   *%rdx
+}
+  800324:	90                   	nop
+  800325:	c9                   	leave
+  800326:	c3                   	ret
+
+0000000000800327 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	48 83 ec 20          	sub    $0x20,%rsp
+  80032f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800332:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800336:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80033d:	00 00 00 
+  800340:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800344:	eb 13                	jmp    800359 <libmain+0x32>
+    (*ctor)();
+  800346:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80034a:	48 8b 10             	mov    (%rax),%rdx
+  80034d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800352:	ff d2                	call   *%rdx
+    ctor++;
+  800354:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800359:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800360:	00 00 00 
+  800363:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800367:	72 dd                	jb     800346 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800369:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80036d:	7e 14                	jle    800383 <libmain+0x5c>
+    binaryname = argv[0];
+  80036f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800373:	48 8b 00             	mov    (%rax),%rax
+  800376:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80037d:	00 00 00 
+  800380:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800383:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800387:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80038a:	48 89 d6             	mov    %rdx,%rsi
+  80038d:	89 c7                	mov    %eax,%edi
+  80038f:	48 b8 26 01 80 00 00 	movabs $0x800126,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80039b:	48 b8 aa 03 80 00 00 	movabs $0x8003aa,%rax
+  8003a2:	00 00 00 
+  8003a5:	ff d0                	call   *%rax
+#endif
+}
+  8003a7:	90                   	nop
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+
+00000000008003aa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003aa:	55                   	push   %rbp
+  8003ab:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8003ae:	48 b8 22 36 80 00 00 	movabs $0x803622,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8003ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003bf:	48 b8 23 22 80 00 00 	movabs $0x802223,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+}
+  8003cb:	90                   	nop
+  8003cc:	5d                   	pop    %rbp
+  8003cd:	c3                   	ret
+
+00000000008003ce <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003ce:	55                   	push   %rbp
+  8003cf:	48 89 e5             	mov    %rsp,%rbp
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8003da:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8003e1:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8003e7:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8003ee:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8003f5:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8003fc:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800403:	84 c0                	test   %al,%al
+  800405:	74 23                	je     80042a <_panic+0x5c>
+  800407:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80040e:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800412:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800416:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  80041a:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80041e:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800422:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800426:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80042a:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800431:	00 00 00 
+  800434:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80043b:	00 00 00 
+  80043e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800442:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800449:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800450:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800457:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80045e:	00 00 00 
+  800461:	48 8b 18             	mov    (%rax),%rbx
+  800464:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  80046b:	00 00 00 
+  80046e:	ff d0                	call   *%rax
+  800470:	89 c6                	mov    %eax,%esi
+  800472:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800478:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80047f:	41 89 d0             	mov    %edx,%r8d
+  800482:	48 89 c1             	mov    %rax,%rcx
+  800485:	48 89 da             	mov    %rbx,%rdx
+  800488:	48 b8 a0 66 80 00 00 	movabs $0x8066a0,%rax
+  80048f:	00 00 00 
+  800492:	48 89 c7             	mov    %rax,%rdi
+  800495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049a:	49 b9 ed 05 80 00 00 	movabs $0x8005ed,%r9
+  8004a1:	00 00 00 
+  8004a4:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004a7:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8004ae:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004b5:	48 89 d6             	mov    %rdx,%rsi
+  8004b8:	48 89 c7             	mov    %rax,%rdi
+  8004bb:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  8004c2:	00 00 00 
+  8004c5:	ff d0                	call   *%rax
+  cprintf("\n");
+  8004c7:	48 b8 c3 66 80 00 00 	movabs $0x8066c3,%rax
+  8004ce:	00 00 00 
+  8004d1:	48 89 c7             	mov    %rax,%rdi
+  8004d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d9:	48 ba ed 05 80 00 00 	movabs $0x8005ed,%rdx
+  8004e0:	00 00 00 
+  8004e3:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8004e5:	cc                   	int3
+  8004e6:	eb fd                	jmp    8004e5 <_panic+0x117>
+
+00000000008004e8 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8004e8:	55                   	push   %rbp
+  8004e9:	48 89 e5             	mov    %rsp,%rbp
+  8004ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8004f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8004f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8004f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004fb:	8b 00                	mov    (%rax),%eax
+  8004fd:	8d 48 01             	lea    0x1(%rax),%ecx
+  800500:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800504:	89 0a                	mov    %ecx,(%rdx)
+  800506:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800509:	89 d1                	mov    %edx,%ecx
+  80050b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80050f:	48 98                	cltq
+  800511:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800515:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800519:	8b 00                	mov    (%rax),%eax
+  80051b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800520:	75 2c                	jne    80054e <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800522:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800526:	8b 00                	mov    (%rax),%eax
+  800528:	48 98                	cltq
+  80052a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80052e:	48 83 c2 08          	add    $0x8,%rdx
+  800532:	48 89 c6             	mov    %rax,%rsi
+  800535:	48 89 d7             	mov    %rdx,%rdi
+  800538:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  80053f:	00 00 00 
+  800542:	ff d0                	call   *%rax
+    b->idx = 0;
+  800544:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800548:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80054e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800552:	8b 40 04             	mov    0x4(%rax),%eax
+  800555:	8d 50 01             	lea    0x1(%rax),%edx
+  800558:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80055c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80055f:	90                   	nop
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+
+0000000000800562 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+  800566:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80056d:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800574:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80057b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800582:	00 00 00 
+  b.cnt = 0;
+  800585:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80058c:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80058f:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800596:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80059d:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8005a4:	48 89 c6             	mov    %rax,%rsi
+  8005a7:	48 b8 e8 04 80 00 00 	movabs $0x8004e8,%rax
+  8005ae:	00 00 00 
+  8005b1:	48 89 c7             	mov    %rax,%rdi
+  8005b4:	48 b8 47 09 80 00 00 	movabs $0x800947,%rax
+  8005bb:	00 00 00 
+  8005be:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8005c0:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8005c6:	48 98                	cltq
+  8005c8:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8005cf:	48 83 c2 08          	add    $0x8,%rdx
+  8005d3:	48 89 c6             	mov    %rax,%rsi
+  8005d6:	48 89 d7             	mov    %rdx,%rdi
+  8005d9:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  8005e0:	00 00 00 
+  8005e3:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8005e5:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8005eb:	c9                   	leave
+  8005ec:	c3                   	ret
+
+00000000008005ed <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8005f8:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8005ff:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800606:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80060d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800614:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80061b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800622:	84 c0                	test   %al,%al
+  800624:	74 20                	je     800646 <cprintf+0x59>
+  800626:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80062a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80062e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800632:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800636:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80063a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80063e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800642:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800646:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80064d:	00 00 00 
+  800650:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800657:	00 00 00 
+  80065a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80065e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800665:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80066c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800673:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80067a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800681:	48 89 d6             	mov    %rdx,%rsi
+  800684:	48 89 c7             	mov    %rax,%rdi
+  800687:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  80068e:	00 00 00 
+  800691:	ff d0                	call   *%rax
+  800693:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800699:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80069f:	c9                   	leave
+  8006a0:	c3                   	ret
+
+00000000008006a1 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	48 83 ec 30          	sub    $0x30,%rsp
+  8006a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8006b5:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8006b8:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8006bc:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8006c0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8006c3:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8006c7:	72 54                	jb     80071d <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006c9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8006cc:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006cf:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8006d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006db:	48 f7 f6             	div    %rsi
+  8006de:	49 89 c2             	mov    %rax,%r10
+  8006e1:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8006e4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8006e7:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8006eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006ef:	41 89 c9             	mov    %ecx,%r9d
+  8006f2:	41 89 f8             	mov    %edi,%r8d
+  8006f5:	89 d1                	mov    %edx,%ecx
+  8006f7:	4c 89 d2             	mov    %r10,%rdx
+  8006fa:	48 89 c7             	mov    %rax,%rdi
+  8006fd:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  800704:	00 00 00 
+  800707:	ff d0                	call   *%rax
+  800709:	eb 1c                	jmp    800727 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80070b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80070f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800712:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800716:	48 89 d6             	mov    %rdx,%rsi
+  800719:	89 c7                	mov    %eax,%edi
+  80071b:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80071d:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800721:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800725:	7f e4                	jg     80070b <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800727:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80072a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800733:	48 f7 f1             	div    %rcx
+  800736:	48 b8 10 69 80 00 00 	movabs $0x806910,%rax
+  80073d:	00 00 00 
+  800740:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800744:	0f be c0             	movsbl %al,%eax
+  800747:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80074b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80074f:	48 89 d6             	mov    %rdx,%rsi
+  800752:	89 c7                	mov    %eax,%edi
+  800754:	ff d1                	call   *%rcx
+}
+  800756:	90                   	nop
+  800757:	c9                   	leave
+  800758:	c3                   	ret
+
+0000000000800759 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800759:	55                   	push   %rbp
+  80075a:	48 89 e5             	mov    %rsp,%rbp
+  80075d:	48 83 ec 10          	sub    $0x10,%rsp
+  800761:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800765:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800768:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80076c:	7e 4b                	jle    8007b9 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80076e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800772:	8b 00                	mov    (%rax),%eax
+  800774:	83 f8 2f             	cmp    $0x2f,%eax
+  800777:	77 24                	ja     80079d <getuint+0x44>
+  800779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80077d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800781:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800785:	8b 00                	mov    (%rax),%eax
+  800787:	89 c0                	mov    %eax,%eax
+  800789:	48 01 d0             	add    %rdx,%rax
+  80078c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800790:	8b 12                	mov    (%rdx),%edx
+  800792:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800795:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800799:	89 0a                	mov    %ecx,(%rdx)
+  80079b:	eb 14                	jmp    8007b1 <getuint+0x58>
+  80079d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007a5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ad:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007b1:	48 8b 00             	mov    (%rax),%rax
+  8007b4:	e9 95 00 00 00       	jmp    80084e <getuint+0xf5>
+  else if (lflag)
+  8007b9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007bd:	74 48                	je     800807 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8007bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c3:	8b 00                	mov    (%rax),%eax
+  8007c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c8:	77 24                	ja     8007ee <getuint+0x95>
+  8007ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007d6:	8b 00                	mov    (%rax),%eax
+  8007d8:	89 c0                	mov    %eax,%eax
+  8007da:	48 01 d0             	add    %rdx,%rax
+  8007dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007e1:	8b 12                	mov    (%rdx),%edx
+  8007e3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ea:	89 0a                	mov    %ecx,(%rdx)
+  8007ec:	eb 14                	jmp    800802 <getuint+0xa9>
+  8007ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007f6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007fe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800802:	48 8b 00             	mov    (%rax),%rax
+  800805:	eb 47                	jmp    80084e <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800807:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080b:	8b 00                	mov    (%rax),%eax
+  80080d:	83 f8 2f             	cmp    $0x2f,%eax
+  800810:	77 24                	ja     800836 <getuint+0xdd>
+  800812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800816:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80081a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081e:	8b 00                	mov    (%rax),%eax
+  800820:	89 c0                	mov    %eax,%eax
+  800822:	48 01 d0             	add    %rdx,%rax
+  800825:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800829:	8b 12                	mov    (%rdx),%edx
+  80082b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80082e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800832:	89 0a                	mov    %ecx,(%rdx)
+  800834:	eb 14                	jmp    80084a <getuint+0xf1>
+  800836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80083e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800842:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800846:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80084a:	8b 00                	mov    (%rax),%eax
+  80084c:	89 c0                	mov    %eax,%eax
+}
+  80084e:	c9                   	leave
+  80084f:	c3                   	ret
+
+0000000000800850 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800850:	55                   	push   %rbp
+  800851:	48 89 e5             	mov    %rsp,%rbp
+  800854:	48 83 ec 10          	sub    $0x10,%rsp
+  800858:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80085c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80085f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800863:	7e 4b                	jle    8008b0 <getint+0x60>
+    return va_arg(*ap, long long);
+  800865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800869:	8b 00                	mov    (%rax),%eax
+  80086b:	83 f8 2f             	cmp    $0x2f,%eax
+  80086e:	77 24                	ja     800894 <getint+0x44>
+  800870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800874:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087c:	8b 00                	mov    (%rax),%eax
+  80087e:	89 c0                	mov    %eax,%eax
+  800880:	48 01 d0             	add    %rdx,%rax
+  800883:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800887:	8b 12                	mov    (%rdx),%edx
+  800889:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80088c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800890:	89 0a                	mov    %ecx,(%rdx)
+  800892:	eb 14                	jmp    8008a8 <getint+0x58>
+  800894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800898:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80089c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008a8:	48 8b 00             	mov    (%rax),%rax
+  8008ab:	e9 95 00 00 00       	jmp    800945 <getint+0xf5>
+  else if (lflag)
+  8008b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008b4:	74 48                	je     8008fe <getint+0xae>
+    return va_arg(*ap, long);
+  8008b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ba:	8b 00                	mov    (%rax),%eax
+  8008bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bf:	77 24                	ja     8008e5 <getint+0x95>
+  8008c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008cd:	8b 00                	mov    (%rax),%eax
+  8008cf:	89 c0                	mov    %eax,%eax
+  8008d1:	48 01 d0             	add    %rdx,%rax
+  8008d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d8:	8b 12                	mov    (%rdx),%edx
+  8008da:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e1:	89 0a                	mov    %ecx,(%rdx)
+  8008e3:	eb 14                	jmp    8008f9 <getint+0xa9>
+  8008e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008ed:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008f5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008f9:	48 8b 00             	mov    (%rax),%rax
+  8008fc:	eb 47                	jmp    800945 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8008fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800902:	8b 00                	mov    (%rax),%eax
+  800904:	83 f8 2f             	cmp    $0x2f,%eax
+  800907:	77 24                	ja     80092d <getint+0xdd>
+  800909:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80090d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800911:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800915:	8b 00                	mov    (%rax),%eax
+  800917:	89 c0                	mov    %eax,%eax
+  800919:	48 01 d0             	add    %rdx,%rax
+  80091c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800920:	8b 12                	mov    (%rdx),%edx
+  800922:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800925:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800929:	89 0a                	mov    %ecx,(%rdx)
+  80092b:	eb 14                	jmp    800941 <getint+0xf1>
+  80092d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800931:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800935:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800939:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80093d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800941:	8b 00                	mov    (%rax),%eax
+  800943:	48 98                	cltq
+}
+  800945:	c9                   	leave
+  800946:	c3                   	ret
+
+0000000000800947 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800947:	55                   	push   %rbp
+  800948:	48 89 e5             	mov    %rsp,%rbp
+  80094b:	41 54                	push   %r12
+  80094d:	53                   	push   %rbx
+  80094e:	48 83 ec 60          	sub    $0x60,%rsp
+  800952:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800956:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80095a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80095e:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800962:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800966:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80096a:	48 8b 06             	mov    (%rsi),%rax
+  80096d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800971:	48 89 01             	mov    %rax,(%rcx)
+  800974:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800978:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80097c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800980:	eb 17                	jmp    800999 <vprintfmt+0x52>
+      if (ch == '\0')
+  800982:	85 db                	test   %ebx,%ebx
+  800984:	0f 84 bf 04 00 00    	je     800e49 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80098a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80098e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800992:	48 89 c6             	mov    %rax,%rsi
+  800995:	89 df                	mov    %ebx,%edi
+  800997:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800999:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80099d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009a1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009a5:	0f b6 00             	movzbl (%rax),%eax
+  8009a8:	0f b6 d8             	movzbl %al,%ebx
+  8009ab:	83 fb 25             	cmp    $0x25,%ebx
+  8009ae:	75 d2                	jne    800982 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8009b0:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8009b4:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8009bb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8009c2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8009c9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8009d0:	eb 04                	jmp    8009d6 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8009d2:	90                   	nop
+  8009d3:	eb 01                	jmp    8009d6 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8009d5:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8009d6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009da:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009de:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009e2:	0f b6 00             	movzbl (%rax),%eax
+  8009e5:	0f b6 d8             	movzbl %al,%ebx
+  8009e8:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8009eb:	83 f8 55             	cmp    $0x55,%eax
+  8009ee:	0f 87 22 04 00 00    	ja     800e16 <vprintfmt+0x4cf>
+  8009f4:	89 c0                	mov    %eax,%eax
+  8009f6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009fd:	00 
+  8009fe:	48 b8 38 69 80 00 00 	movabs $0x806938,%rax
+  800a05:	00 00 00 
+  800a08:	48 01 d0             	add    %rdx,%rax
+  800a0b:	48 8b 00             	mov    (%rax),%rax
+  800a0e:	ff e0                	jmp    *%rax
+        padc = '-';
+  800a10:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a14:	eb c0                	jmp    8009d6 <vprintfmt+0x8f>
+        padc = '0';
+  800a16:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a1a:	eb ba                	jmp    8009d6 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a1c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a23:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a26:	89 d0                	mov    %edx,%eax
+  800a28:	c1 e0 02             	shl    $0x2,%eax
+  800a2b:	01 d0                	add    %edx,%eax
+  800a2d:	01 c0                	add    %eax,%eax
+  800a2f:	01 d8                	add    %ebx,%eax
+  800a31:	83 e8 30             	sub    $0x30,%eax
+  800a34:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800a37:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a3b:	0f b6 00             	movzbl (%rax),%eax
+  800a3e:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800a41:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a44:	7e 60                	jle    800aa6 <vprintfmt+0x15f>
+  800a46:	83 fb 39             	cmp    $0x39,%ebx
+  800a49:	7f 5b                	jg     800aa6 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800a4b:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a50:	eb d1                	jmp    800a23 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	77 17                	ja     800a71 <vprintfmt+0x12a>
+  800a5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a5e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a61:	89 d2                	mov    %edx,%edx
+  800a63:	48 01 d0             	add    %rdx,%rax
+  800a66:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a69:	83 c2 08             	add    $0x8,%edx
+  800a6c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a6f:	eb 0c                	jmp    800a7d <vprintfmt+0x136>
+  800a71:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a75:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a79:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a7d:	8b 00                	mov    (%rax),%eax
+  800a7f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800a82:	eb 23                	jmp    800aa7 <vprintfmt+0x160>
+        if (width < 0)
+  800a84:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a88:	0f 89 44 ff ff ff    	jns    8009d2 <vprintfmt+0x8b>
+          width = 0;
+  800a8e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800a95:	e9 38 ff ff ff       	jmp    8009d2 <vprintfmt+0x8b>
+        altflag = 1;
+  800a9a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800aa1:	e9 30 ff ff ff       	jmp    8009d6 <vprintfmt+0x8f>
+        goto process_precision;
+  800aa6:	90                   	nop
+        if (width < 0)
+  800aa7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800aab:	0f 89 24 ff ff ff    	jns    8009d5 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800ab1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ab4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ab7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800abe:	e9 12 ff ff ff       	jmp    8009d5 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800ac3:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800ac7:	e9 0a ff ff ff       	jmp    8009d6 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 17                	ja     800aeb <vprintfmt+0x1a4>
+  800ad4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ad8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800adb:	89 d2                	mov    %edx,%edx
+  800add:	48 01 d0             	add    %rdx,%rax
+  800ae0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae3:	83 c2 08             	add    $0x8,%edx
+  800ae6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ae9:	eb 0c                	jmp    800af7 <vprintfmt+0x1b0>
+  800aeb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800aef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800af3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800af7:	8b 00                	mov    (%rax),%eax
+  800af9:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800afd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b01:	48 89 d6             	mov    %rdx,%rsi
+  800b04:	89 c7                	mov    %eax,%edi
+  800b06:	ff d1                	call   *%rcx
+        break;
+  800b08:	e9 37 03 00 00       	jmp    800e44 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800b0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b10:	83 f8 2f             	cmp    $0x2f,%eax
+  800b13:	77 17                	ja     800b2c <vprintfmt+0x1e5>
+  800b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b19:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b1c:	89 d2                	mov    %edx,%edx
+  800b1e:	48 01 d0             	add    %rdx,%rax
+  800b21:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b24:	83 c2 08             	add    $0x8,%edx
+  800b27:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b2a:	eb 0c                	jmp    800b38 <vprintfmt+0x1f1>
+  800b2c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b30:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b34:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b38:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800b3a:	85 db                	test   %ebx,%ebx
+  800b3c:	79 02                	jns    800b40 <vprintfmt+0x1f9>
+          err = -err;
+  800b3e:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b40:	83 fb 15             	cmp    $0x15,%ebx
+  800b43:	7f 16                	jg     800b5b <vprintfmt+0x214>
+  800b45:	48 ba 60 68 80 00 00 	movabs $0x806860,%rdx
+  800b4c:	00 00 00 
+  800b4f:	48 63 c3             	movslq %ebx,%rax
+  800b52:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b56:	4d 85 e4             	test   %r12,%r12
+  800b59:	75 2e                	jne    800b89 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b5b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b5f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b63:	89 d9                	mov    %ebx,%ecx
+  800b65:	48 ba 21 69 80 00 00 	movabs $0x806921,%rdx
+  800b6c:	00 00 00 
+  800b6f:	48 89 c7             	mov    %rax,%rdi
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b77:	49 b8 53 0e 80 00 00 	movabs $0x800e53,%r8
+  800b7e:	00 00 00 
+  800b81:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800b84:	e9 bb 02 00 00       	jmp    800e44 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800b89:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b8d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b91:	4c 89 e1             	mov    %r12,%rcx
+  800b94:	48 ba 2a 69 80 00 00 	movabs $0x80692a,%rdx
+  800b9b:	00 00 00 
+  800b9e:	48 89 c7             	mov    %rax,%rdi
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba6:	49 b8 53 0e 80 00 00 	movabs $0x800e53,%r8
+  800bad:	00 00 00 
+  800bb0:	41 ff d0             	call   *%r8
+        break;
+  800bb3:	e9 8c 02 00 00       	jmp    800e44 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 17                	ja     800bd7 <vprintfmt+0x290>
+  800bc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bc4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bc7:	89 d2                	mov    %edx,%edx
+  800bc9:	48 01 d0             	add    %rdx,%rax
+  800bcc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bcf:	83 c2 08             	add    $0x8,%edx
+  800bd2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bd5:	eb 0c                	jmp    800be3 <vprintfmt+0x29c>
+  800bd7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bdb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bdf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800be3:	4c 8b 20             	mov    (%rax),%r12
+  800be6:	4d 85 e4             	test   %r12,%r12
+  800be9:	75 0a                	jne    800bf5 <vprintfmt+0x2ae>
+          p = "(null)";
+  800beb:	49 bc 2d 69 80 00 00 	movabs $0x80692d,%r12
+  800bf2:	00 00 00 
+        if (width > 0 && padc != '-')
+  800bf5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bf9:	7e 78                	jle    800c73 <vprintfmt+0x32c>
+  800bfb:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800bff:	74 72                	je     800c73 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c01:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800c04:	48 98                	cltq
+  800c06:	48 89 c6             	mov    %rax,%rsi
+  800c09:	4c 89 e7             	mov    %r12,%rdi
+  800c0c:	48 b8 5f 15 80 00 00 	movabs $0x80155f,%rax
+  800c13:	00 00 00 
+  800c16:	ff d0                	call   *%rax
+  800c18:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c1b:	eb 17                	jmp    800c34 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c1d:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c21:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c25:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c29:	48 89 d6             	mov    %rdx,%rsi
+  800c2c:	89 c7                	mov    %eax,%edi
+  800c2e:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c30:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c34:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c38:	7f e3                	jg     800c1d <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c3a:	eb 37                	jmp    800c73 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800c3c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c40:	74 1e                	je     800c60 <vprintfmt+0x319>
+  800c42:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c45:	7e 05                	jle    800c4c <vprintfmt+0x305>
+  800c47:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c4a:	7e 14                	jle    800c60 <vprintfmt+0x319>
+            putch('?', putdat);
+  800c4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c50:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c54:	48 89 c6             	mov    %rax,%rsi
+  800c57:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c5c:	ff d2                	call   *%rdx
+  800c5e:	eb 0f                	jmp    800c6f <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800c60:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c64:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c68:	48 89 c6             	mov    %rax,%rsi
+  800c6b:	89 df                	mov    %ebx,%edi
+  800c6d:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c6f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c73:	4c 89 e0             	mov    %r12,%rax
+  800c76:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c7a:	0f b6 00             	movzbl (%rax),%eax
+  800c7d:	0f be d8             	movsbl %al,%ebx
+  800c80:	85 db                	test   %ebx,%ebx
+  800c82:	74 28                	je     800cac <vprintfmt+0x365>
+  800c84:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c88:	78 b2                	js     800c3c <vprintfmt+0x2f5>
+  800c8a:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800c8e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c92:	79 a8                	jns    800c3c <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800c94:	eb 16                	jmp    800cac <vprintfmt+0x365>
+          putch(' ', putdat);
+  800c96:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c9a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c9e:	48 89 c6             	mov    %rax,%rsi
+  800ca1:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ca6:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ca8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cac:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cb0:	7f e4                	jg     800c96 <vprintfmt+0x34f>
+        break;
+  800cb2:	e9 8d 01 00 00       	jmp    800e44 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800cb7:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cba:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cbe:	89 d6                	mov    %edx,%esi
+  800cc0:	48 89 c7             	mov    %rax,%rdi
+  800cc3:	48 b8 50 08 80 00 00 	movabs $0x800850,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+  800ccf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800cd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd7:	48 85 c0             	test   %rax,%rax
+  800cda:	79 1d                	jns    800cf9 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800cdc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ce0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ce4:	48 89 c6             	mov    %rax,%rsi
+  800ce7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cec:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800cee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf2:	48 f7 d8             	neg    %rax
+  800cf5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800cf9:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d00:	e9 d2 00 00 00       	jmp    800dd7 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800d05:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d08:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d0c:	89 d6                	mov    %edx,%esi
+  800d0e:	48 89 c7             	mov    %rax,%rdi
+  800d11:	48 b8 59 07 80 00 00 	movabs $0x800759,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+  800d1d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d21:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d28:	e9 aa 00 00 00       	jmp    800dd7 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800d2d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d30:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d34:	89 d6                	mov    %edx,%esi
+  800d36:	48 89 c7             	mov    %rax,%rdi
+  800d39:	48 b8 59 07 80 00 00 	movabs $0x800759,%rax
+  800d40:	00 00 00 
+  800d43:	ff d0                	call   *%rax
+  800d45:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800d49:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d50:	e9 82 00 00 00       	jmp    800dd7 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d55:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d59:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d5d:	48 89 c6             	mov    %rax,%rsi
+  800d60:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d65:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800d67:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d6b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d6f:	48 89 c6             	mov    %rax,%rsi
+  800d72:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d77:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7f:	77 17                	ja     800d98 <vprintfmt+0x451>
+  800d81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d85:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d88:	89 d2                	mov    %edx,%edx
+  800d8a:	48 01 d0             	add    %rdx,%rax
+  800d8d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d90:	83 c2 08             	add    $0x8,%edx
+  800d93:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d96:	eb 0c                	jmp    800da4 <vprintfmt+0x45d>
+  800d98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d9c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800da0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800da4:	48 8b 00             	mov    (%rax),%rax
+  800da7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800dab:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800db2:	eb 23                	jmp    800dd7 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800db4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800db7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	48 89 c7             	mov    %rax,%rdi
+  800dc0:	48 b8 59 07 80 00 00 	movabs $0x800759,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+  800dcc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800dd0:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800dd7:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ddc:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800ddf:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800de2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800de6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800dea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dee:	45 89 c1             	mov    %r8d,%r9d
+  800df1:	41 89 f8             	mov    %edi,%r8d
+  800df4:	48 89 c7             	mov    %rax,%rdi
+  800df7:	48 b8 a1 06 80 00 00 	movabs $0x8006a1,%rax
+  800dfe:	00 00 00 
+  800e01:	ff d0                	call   *%rax
+        break;
+  800e03:	eb 3f                	jmp    800e44 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800e05:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e09:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e0d:	48 89 c6             	mov    %rax,%rsi
+  800e10:	89 df                	mov    %ebx,%edi
+  800e12:	ff d2                	call   *%rdx
+        break;
+  800e14:	eb 2e                	jmp    800e44 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e16:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e1a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e1e:	48 89 c6             	mov    %rax,%rsi
+  800e21:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e26:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800e28:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e2d:	eb 05                	jmp    800e34 <vprintfmt+0x4ed>
+  800e2f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e34:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e38:	48 83 e8 01          	sub    $0x1,%rax
+  800e3c:	0f b6 00             	movzbl (%rax),%eax
+  800e3f:	3c 25                	cmp    $0x25,%al
+  800e41:	75 ec                	jne    800e2f <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800e43:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800e44:	e9 50 fb ff ff       	jmp    800999 <vprintfmt+0x52>
+        return;
+  800e49:	90                   	nop
+    }
+  }
+}
+  800e4a:	48 83 c4 60          	add    $0x60,%rsp
+  800e4e:	5b                   	pop    %rbx
+  800e4f:	41 5c                	pop    %r12
+  800e51:	5d                   	pop    %rbp
+  800e52:	c3                   	ret
+
+0000000000800e53 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e53:	55                   	push   %rbp
+  800e54:	48 89 e5             	mov    %rsp,%rbp
+  800e57:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e5e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e65:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e6c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e73:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e7a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e81:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e88:	84 c0                	test   %al,%al
+  800e8a:	74 20                	je     800eac <printfmt+0x59>
+  800e8c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e90:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e94:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e98:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e9c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ea0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ea4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ea8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800eac:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800eb3:	00 00 00 
+  800eb6:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800ebd:	00 00 00 
+  800ec0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ec4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ecb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ed2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800ed9:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ee0:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ee7:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800eee:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ef5:	48 89 c7             	mov    %rax,%rdi
+  800ef8:	48 b8 47 09 80 00 00 	movabs $0x800947,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800f04:	90                   	nop
+  800f05:	c9                   	leave
+  800f06:	c3                   	ret
+
+0000000000800f07 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800f07:	55                   	push   %rbp
+  800f08:	48 89 e5             	mov    %rsp,%rbp
+  800f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  800f0f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f12:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f1a:	8b 40 10             	mov    0x10(%rax),%eax
+  800f1d:	8d 50 01             	lea    0x1(%rax),%edx
+  800f20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f24:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f2b:	48 8b 10             	mov    (%rax),%rdx
+  800f2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f36:	48 39 c2             	cmp    %rax,%rdx
+  800f39:	73 17                	jae    800f52 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800f3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f3f:	48 8b 00             	mov    (%rax),%rax
+  800f42:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f46:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f4a:	48 89 0a             	mov    %rcx,(%rdx)
+  800f4d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f50:	88 10                	mov    %dl,(%rax)
+}
+  800f52:	90                   	nop
+  800f53:	c9                   	leave
+  800f54:	c3                   	ret
+
+0000000000800f55 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f55:	55                   	push   %rbp
+  800f56:	48 89 e5             	mov    %rsp,%rbp
+  800f59:	48 83 ec 40          	sub    $0x40,%rsp
+  800f5d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800f61:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800f64:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f68:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f74:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f77:	48 98                	cltq
+  800f79:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f81:	48 01 d0             	add    %rdx,%rax
+  800f84:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f88:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800f8f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f94:	74 06                	je     800f9c <vsnprintf+0x47>
+  800f96:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800f9a:	7f 07                	jg     800fa3 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800f9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fa1:	eb 32                	jmp    800fd5 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800fa3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800fa7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800fab:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800faf:	48 89 c6             	mov    %rax,%rsi
+  800fb2:	48 b8 07 0f 80 00 00 	movabs $0x800f07,%rax
+  800fb9:	00 00 00 
+  800fbc:	48 89 c7             	mov    %rax,%rdi
+  800fbf:	48 b8 47 09 80 00 00 	movabs $0x800947,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800fcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fcf:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800fd2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800fd5:	c9                   	leave
+  800fd6:	c3                   	ret
+
+0000000000800fd7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800fd7:	55                   	push   %rbp
+  800fd8:	48 89 e5             	mov    %rsp,%rbp
+  800fdb:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800fe2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800fe9:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800fef:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ff6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ffd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801004:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80100b:	84 c0                	test   %al,%al
+  80100d:	74 20                	je     80102f <snprintf+0x58>
+  80100f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801013:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801017:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80101b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80101f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801023:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801027:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80102b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80102f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801036:	00 00 00 
+  801039:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801040:	00 00 00 
+  801043:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801047:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80104e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801055:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80105c:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801063:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80106a:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801070:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801077:	48 89 c7             	mov    %rax,%rdi
+  80107a:	48 b8 55 0f 80 00 00 	movabs $0x800f55,%rax
+  801081:	00 00 00 
+  801084:	ff d0                	call   *%rax
+  801086:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  80108c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801092:	c9                   	leave
+  801093:	c3                   	ret
+
+0000000000801094 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+  801098:	53                   	push   %rbx
+  801099:	48 83 ec 38          	sub    $0x38,%rsp
+  80109d:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8010a0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010a4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8010a8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8010ac:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8010b0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8010b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b8:	89 d1                	mov    %edx,%ecx
+  8010ba:	0f a2                	cpuid
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8010c1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8010c4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8010c7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8010ca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010cf:	74 09                	je     8010da <cpuid+0x46>
+}
+  8010d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010d5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010d8:	89 10                	mov    %edx,(%rax)
+
+  8010da:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010df:	74 09                	je     8010ea <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8010e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010e5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8010e8:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8010ea:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8010ef:	74 09                	je     8010fa <cpuid+0x66>
+char *
+  8010f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010f5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8010f8:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8010fa:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8010ff:	74 09                	je     80110a <cpuid+0x76>
+  for (; *s; s++)
+  801101:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801105:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801108:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80110a:	90                   	nop
+  80110b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110f:	c9                   	leave
+  801110:	c3                   	ret
+
+0000000000801111 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801111:	55                   	push   %rbp
+  801112:	48 89 e5             	mov    %rsp,%rbp
+  801115:	48 83 ec 18          	sub    $0x18,%rsp
+  801119:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80111c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80111f:	89 c1                	mov    %eax,%ecx
+  801121:	0f 01 d0             	xgetbv
+  801124:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801127:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80112a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80112d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801130:	48 c1 e2 20          	shl    $0x20,%rdx
+  801134:	48 09 d0             	or     %rdx,%rax
+#else
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+
+0000000000801139 <string_cpu>:
+string_cpu(void) {
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+  80113d:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801141:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801148:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80114f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801156:	00 00 00 
+  801159:	8b 00                	mov    (%rax),%eax
+  80115b:	85 c0                	test   %eax,%eax
+  80115d:	78 11                	js     801170 <string_cpu+0x37>
+    return string_features;
+  80115f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801166:	00 00 00 
+  801169:	8b 00                	mov    (%rax),%eax
+  80116b:	e9 df 00 00 00       	jmp    80124f <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801170:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80117a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	48 89 c6             	mov    %rax,%rsi
+  801187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80118c:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  801193:	00 00 00 
+  801196:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801198:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80119b:	83 f8 06             	cmp    $0x6,%eax
+  80119e:	76 28                	jbe    8011c8 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8011a0:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8011a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011af:	48 89 c2             	mov    %rax,%rdx
+  8011b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8011bc:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  8011c3:	00 00 00 
+  8011c6:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8011c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011cb:	25 00 02 00 00       	and    $0x200,%eax
+  8011d0:	85 c0                	test   %eax,%eax
+  8011d2:	74 04                	je     8011d8 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8011d4:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8011d8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8011dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e2:	48 89 c1             	mov    %rax,%rcx
+  8011e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011f4:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801200:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801203:	83 e0 20             	and    $0x20,%eax
+  801206:	85 c0                	test   %eax,%eax
+  801208:	74 2a                	je     801234 <string_cpu+0xfb>
+  80120a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80120d:	25 00 00 00 08       	and    $0x8000000,%eax
+  801212:	85 c0                	test   %eax,%eax
+  801214:	74 1e                	je     801234 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80121b:	48 b8 11 11 80 00 00 	movabs $0x801111,%rax
+  801222:	00 00 00 
+  801225:	ff d0                	call   *%rax
+  801227:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80122a:	48 83 f8 06          	cmp    $0x6,%rax
+  80122e:	75 04                	jne    801234 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801230:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801234:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80123b:	00 00 00 
+  80123e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801241:	89 02                	mov    %eax,(%rdx)
+  801243:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  80124a:	00 00 00 
+  80124d:	8b 00                	mov    (%rax),%eax
+}
+  80124f:	c9                   	leave
+  801250:	c3                   	ret
+
+0000000000801251 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+  801255:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801259:	48 83 ec 60          	sub    $0x60,%rsp
+  80125d:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801262:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801267:	83 e0 1f             	and    $0x1f,%eax
+  80126a:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80126e:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801272:	48 f7 d8             	neg    %rax
+  801275:	48 89 c2             	mov    %rax,%rdx
+  801278:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80127d:	48 01 d0             	add    %rdx,%rax
+  801280:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801285:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801289:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80128f:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801294:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801298:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80129e:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012a2:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012a6:	89 c2                	mov    %eax,%edx
+  8012a8:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012ac:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8012b1:	89 c1                	mov    %eax,%ecx
+  8012b3:	d3 e6                	shl    %cl,%esi
+  8012b5:	89 f0                	mov    %esi,%eax
+  8012b7:	21 d0                	and    %edx,%eax
+  8012b9:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012bd:	eb 21                	jmp    8012e0 <strlen_avx2+0x8f>
+    p += 32;
+  8012bf:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8012c5:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012ca:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012ce:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012d4:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012d8:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012dc:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012e0:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8012e5:	74 d8                	je     8012bf <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8012e7:	31 c0                	xor    %eax,%eax
+  8012e9:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8012ef:	48 63 d0             	movslq %eax,%rdx
+  8012f2:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012f7:	48 01 d0             	add    %rdx,%rax
+  8012fa:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+
+0000000000801301 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801309:	48 83 ec 40          	sub    $0x40,%rsp
+  80130d:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801312:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801317:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80131c:	eb 77                	jmp    801395 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80131e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801323:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801327:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80132b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801330:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801334:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801338:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80133c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801340:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801345:	74 3c                	je     801383 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801347:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80134b:	f7 d0                	not    %eax
+  80134d:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801351:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801355:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801359:	48 63 d0             	movslq %eax,%rdx
+  80135c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801361:	48 01 d0             	add    %rdx,%rax
+  801364:	0f b6 00             	movzbl (%rax),%eax
+  801367:	0f b6 c0             	movzbl %al,%eax
+  80136a:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80136e:	48 63 ca             	movslq %edx,%rcx
+  801371:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801376:	48 01 ca             	add    %rcx,%rdx
+  801379:	0f b6 12             	movzbl (%rdx),%edx
+  80137c:	0f b6 d2             	movzbl %dl,%edx
+  80137f:	29 d0                	sub    %edx,%eax
+  801381:	eb 6b                	jmp    8013ee <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801383:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801389:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80138f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801395:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80139b:	77 81                	ja     80131e <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80139d:	eb 42                	jmp    8013e1 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80139f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013a4:	0f b6 10             	movzbl (%rax),%edx
+  8013a7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013ac:	0f b6 00             	movzbl (%rax),%eax
+  8013af:	38 c2                	cmp    %al,%dl
+  8013b1:	74 1c                	je     8013cf <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8013b3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013b8:	0f b6 00             	movzbl (%rax),%eax
+  8013bb:	0f b6 c8             	movzbl %al,%ecx
+  8013be:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013c3:	0f b6 00             	movzbl (%rax),%eax
+  8013c6:	0f b6 d0             	movzbl %al,%edx
+  8013c9:	89 c8                	mov    %ecx,%eax
+  8013cb:	29 d0                	sub    %edx,%eax
+  8013cd:	eb 1f                	jmp    8013ee <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8013cf:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8013d5:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8013db:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8013e1:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8013e7:	75 b6                	jne    80139f <memcmp_avx2+0x9e>
+  return 0;
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ee:	c9                   	leave
+  8013ef:	c3                   	ret
+
+00000000008013f0 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8013f0:	55                   	push   %rbp
+  8013f1:	48 89 e5             	mov    %rsp,%rbp
+  8013f4:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013f8:	48 83 ec 60          	sub    $0x60,%rsp
+  8013fc:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801401:	89 f0                	mov    %esi,%eax
+  801403:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801408:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80140c:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801411:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801415:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80141a:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801420:	eb 47                	jmp    801469 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801422:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801427:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80142b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80142f:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801435:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801439:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80143d:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801441:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801446:	74 15                	je     80145d <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801448:	31 c0                	xor    %eax,%eax
+  80144a:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801450:	48 63 d0             	movslq %eax,%rdx
+  801453:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801458:	48 01 d0             	add    %rdx,%rax
+  80145b:	eb 3d                	jmp    80149a <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80145d:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801463:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801469:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80146f:	77 b1                	ja     801422 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801471:	eb 0c                	jmp    80147f <memfind_avx2+0x8f>
+  801473:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801479:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80147f:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801485:	74 0e                	je     801495 <memfind_avx2+0xa5>
+  801487:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80148c:	0f b6 00             	movzbl (%rax),%eax
+  80148f:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801493:	75 de                	jne    801473 <memfind_avx2+0x83>
+  return s;
+  801495:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80149a:	c9                   	leave
+  80149b:	c3                   	ret
+
+000000000080149c <strlen>:
+strlen(const char *s) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8014a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8014a8:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8014ac:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8014b0:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+  8014bc:	83 e0 02             	and    $0x2,%eax
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	74 18                	je     8014db <strlen+0x3f>
+    return strlen_avx2(s);
+  8014c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014c7:	48 89 c7             	mov    %rax,%rdi
+  8014ca:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+  8014d6:	e9 82 00 00 00       	jmp    80155d <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8014db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014df:	83 e0 0f             	and    $0xf,%eax
+  8014e2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8014e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014e8:	48 f7 d8             	neg    %rax
+  8014eb:	48 89 c2             	mov    %rax,%rdx
+  8014ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014f2:	48 01 d0             	add    %rdx,%rax
+  8014f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8014f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014fd:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801501:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801506:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80150a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80150e:	89 c2                	mov    %eax,%edx
+  801510:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801513:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801518:	89 c1                	mov    %eax,%ecx
+  80151a:	d3 e6                	shl    %cl,%esi
+  80151c:	89 f0                	mov    %esi,%eax
+  80151e:	21 d0                	and    %edx,%eax
+  801520:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801523:	eb 1d                	jmp    801542 <strlen+0xa6>
+    p += 16;
+  801525:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80152a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152e:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801532:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801537:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80153b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80153f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801542:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801546:	74 dd                	je     801525 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801548:	31 c0                	xor    %eax,%eax
+  80154a:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80154f:	48 63 d0             	movslq %eax,%rdx
+  801552:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801556:	48 01 d0             	add    %rdx,%rax
+  801559:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80155d:	c9                   	leave
+  80155e:	c3                   	ret
+
+000000000080155f <strnlen>:
+strnlen(const char *s, size_t size) {
+  80155f:	55                   	push   %rbp
+  801560:	48 89 e5             	mov    %rsp,%rbp
+  801563:	48 83 ec 20          	sub    $0x20,%rsp
+  801567:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80156b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80156f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801576:	eb 0e                	jmp    801586 <strnlen+0x27>
+    n++;
+  801578:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80157c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801581:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801586:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80158b:	74 0b                	je     801598 <strnlen+0x39>
+  80158d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801591:	0f b6 00             	movzbl (%rax),%eax
+  801594:	84 c0                	test   %al,%al
+  801596:	75 e0                	jne    801578 <strnlen+0x19>
+  return n;
+  801598:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80159b:	c9                   	leave
+  80159c:	c3                   	ret
+
+000000000080159d <strcpy>:
+strcpy(char *dst, const char *src) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8015a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8015ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8015b5:	90                   	nop
+  8015b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015ba:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015ce:	0f b6 12             	movzbl (%rdx),%edx
+  8015d1:	88 10                	mov    %dl,(%rax)
+  8015d3:	0f b6 00             	movzbl (%rax),%eax
+  8015d6:	84 c0                	test   %al,%al
+  8015d8:	75 dc                	jne    8015b6 <strcpy+0x19>
+  return ret;
+  8015da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+
+00000000008015e0 <strcat>:
+strcat(char *dst, const char *src) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8015e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8015f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015f4:	48 89 c7             	mov    %rax,%rdi
+  8015f7:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  8015fe:	00 00 00 
+  801601:	ff d0                	call   *%rax
+  801603:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801606:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801609:	48 63 d0             	movslq %eax,%rdx
+  80160c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801610:	48 01 c2             	add    %rax,%rdx
+  801613:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801617:	48 89 c6             	mov    %rax,%rsi
+  80161a:	48 89 d7             	mov    %rdx,%rdi
+  80161d:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  801624:	00 00 00 
+  801627:	ff d0                	call   *%rax
+  return dst;
+  801629:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80162d:	c9                   	leave
+  80162e:	c3                   	ret
+
+000000000080162f <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+  801633:	48 83 ec 28          	sub    $0x28,%rsp
+  801637:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80163b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80163f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801647:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80164b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801652:	00 
+  801653:	eb 2a                	jmp    80167f <strncpy+0x50>
+    *dst++ = *src;
+  801655:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801659:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80165d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801661:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801665:	0f b6 12             	movzbl (%rdx),%edx
+  801668:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80166a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80166e:	0f b6 00             	movzbl (%rax),%eax
+  801671:	84 c0                	test   %al,%al
+  801673:	74 05                	je     80167a <strncpy+0x4b>
+      src++;
+  801675:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80167a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80167f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801683:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801687:	72 cc                	jb     801655 <strncpy+0x26>
+  return ret;
+  801689:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80168d:	c9                   	leave
+  80168e:	c3                   	ret
+
+000000000080168f <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80168f:	55                   	push   %rbp
+  801690:	48 89 e5             	mov    %rsp,%rbp
+  801693:	48 83 ec 28          	sub    $0x28,%rsp
+  801697:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80169b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80169f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8016a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8016ab:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016b0:	74 3d                	je     8016ef <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8016b2:	eb 1d                	jmp    8016d1 <strlcpy+0x42>
+      *dst++ = *src++;
+  8016b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016b8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016cc:	0f b6 12             	movzbl (%rdx),%edx
+  8016cf:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8016d1:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016d6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016db:	74 0b                	je     8016e8 <strlcpy+0x59>
+  8016dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e1:	0f b6 00             	movzbl (%rax),%eax
+  8016e4:	84 c0                	test   %al,%al
+  8016e6:	75 cc                	jne    8016b4 <strlcpy+0x25>
+    *dst = '\0';
+  8016e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ec:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8016ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f3:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016f7:	c9                   	leave
+  8016f8:	c3                   	ret
+
+00000000008016f9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8016f9:	55                   	push   %rbp
+  8016fa:	48 89 e5             	mov    %rsp,%rbp
+  8016fd:	48 83 ec 30          	sub    $0x30,%rsp
+  801701:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801705:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801709:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80170d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801711:	48 89 c7             	mov    %rax,%rdi
+  801714:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  80171b:	00 00 00 
+  80171e:	ff d0                	call   *%rax
+  801720:	48 98                	cltq
+  801722:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801726:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80172a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80172e:	48 89 d6             	mov    %rdx,%rsi
+  801731:	48 89 c7             	mov    %rax,%rdi
+  801734:	48 b8 5f 15 80 00 00 	movabs $0x80155f,%rax
+  80173b:	00 00 00 
+  80173e:	ff d0                	call   *%rax
+  801740:	48 98                	cltq
+  801742:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801746:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80174a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80174e:	75 10                	jne    801760 <strlcat+0x67>
+    return maxlen + srclen;
+  801750:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801754:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801758:	48 01 d0             	add    %rdx,%rax
+  80175b:	e9 86 00 00 00       	jmp    8017e6 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801760:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801764:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801768:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80176c:	73 2b                	jae    801799 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80176e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801772:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801776:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80177a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177e:	48 01 c1             	add    %rax,%rcx
+  801781:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801785:	48 89 c6             	mov    %rax,%rsi
+  801788:	48 89 cf             	mov    %rcx,%rdi
+  80178b:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  801792:	00 00 00 
+  801795:	ff d0                	call   *%rax
+  801797:	eb 42                	jmp    8017db <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801799:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80179d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017a1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a9:	48 01 c1             	add    %rax,%rcx
+  8017ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b0:	48 89 c6             	mov    %rax,%rsi
+  8017b3:	48 89 cf             	mov    %rcx,%rdi
+  8017b6:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8017c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ca:	48 01 d0             	add    %rdx,%rax
+  8017cd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d5:	48 01 d0             	add    %rdx,%rax
+  8017d8:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8017db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e3:	48 01 d0             	add    %rdx,%rax
+}
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+
+00000000008017e8 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8017e8:	55                   	push   %rbp
+  8017e9:	48 89 e5             	mov    %rsp,%rbp
+  8017ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8017f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8017f8:	eb 0a                	jmp    801804 <strcmp+0x1c>
+    p++, q++;
+  8017fa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ff:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801808:	0f b6 00             	movzbl (%rax),%eax
+  80180b:	84 c0                	test   %al,%al
+  80180d:	74 12                	je     801821 <strcmp+0x39>
+  80180f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801813:	0f b6 10             	movzbl (%rax),%edx
+  801816:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80181a:	0f b6 00             	movzbl (%rax),%eax
+  80181d:	38 c2                	cmp    %al,%dl
+  80181f:	74 d9                	je     8017fa <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801825:	0f b6 00             	movzbl (%rax),%eax
+  801828:	0f b6 d0             	movzbl %al,%edx
+  80182b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182f:	0f b6 00             	movzbl (%rax),%eax
+  801832:	0f b6 c0             	movzbl %al,%eax
+  801835:	29 c2                	sub    %eax,%edx
+  801837:	89 d0                	mov    %edx,%eax
+}
+  801839:	c9                   	leave
+  80183a:	c3                   	ret
+
+000000000080183b <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80183b:	55                   	push   %rbp
+  80183c:	48 89 e5             	mov    %rsp,%rbp
+  80183f:	48 83 ec 18          	sub    $0x18,%rsp
+  801843:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801847:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80184b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80184f:	eb 0f                	jmp    801860 <strncmp+0x25>
+    n--, p++, q++;
+  801851:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801856:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80185b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801860:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801865:	74 1d                	je     801884 <strncmp+0x49>
+  801867:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80186b:	0f b6 00             	movzbl (%rax),%eax
+  80186e:	84 c0                	test   %al,%al
+  801870:	74 12                	je     801884 <strncmp+0x49>
+  801872:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801876:	0f b6 10             	movzbl (%rax),%edx
+  801879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80187d:	0f b6 00             	movzbl (%rax),%eax
+  801880:	38 c2                	cmp    %al,%dl
+  801882:	74 cd                	je     801851 <strncmp+0x16>
+  if (n == 0)
+  801884:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801889:	75 07                	jne    801892 <strncmp+0x57>
+    return 0;
+  80188b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801890:	eb 16                	jmp    8018a8 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801896:	0f b6 00             	movzbl (%rax),%eax
+  801899:	0f b6 d0             	movzbl %al,%edx
+  80189c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a0:	0f b6 00             	movzbl (%rax),%eax
+  8018a3:	0f b6 c0             	movzbl %al,%eax
+  8018a6:	29 c2                	sub    %eax,%edx
+}
+  8018a8:	89 d0                	mov    %edx,%eax
+  8018aa:	c9                   	leave
+  8018ab:	c3                   	ret
+
+00000000008018ac <strchr>:
+strchr(const char *s, char c) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	48 83 ec 60          	sub    $0x60,%rsp
+  8018b4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8018b8:	89 f0                	mov    %esi,%eax
+  8018ba:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8018bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018c1:	83 e0 0f             	and    $0xf,%eax
+  8018c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8018c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018ca:	48 f7 d8             	neg    %rax
+  8018cd:	48 89 c2             	mov    %rax,%rdx
+  8018d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018d4:	48 01 d0             	add    %rdx,%rax
+  8018d7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8018db:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8018df:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8018e3:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8018e7:	66 0f 6e c0          	movd   %eax,%xmm0
+  8018eb:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8018ef:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8018f3:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8018f8:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8018fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801900:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801904:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801908:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80190d:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801912:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801916:	89 c2                	mov    %eax,%edx
+  801918:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80191d:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801922:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801926:	09 c2                	or     %eax,%edx
+  801928:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80192b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801930:	89 c1                	mov    %eax,%ecx
+  801932:	d3 e6                	shl    %cl,%esi
+  801934:	89 f0                	mov    %esi,%eax
+  801936:	21 d0                	and    %edx,%eax
+  801938:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80193b:	eb 34                	jmp    801971 <strchr+0xc5>
+    p += 16;
+  80193d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801942:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801946:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80194a:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80194e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801953:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801958:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80195c:	89 c2                	mov    %eax,%edx
+  80195e:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801963:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801968:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80196c:	09 d0                	or     %edx,%eax
+  80196e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801971:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801975:	74 c6                	je     80193d <strchr+0x91>
+  p += __builtin_ctz(m);
+  801977:	31 c0                	xor    %eax,%eax
+  801979:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80197e:	48 98                	cltq
+  801980:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801988:	0f b6 00             	movzbl (%rax),%eax
+  80198b:	84 c0                	test   %al,%al
+  80198d:	74 06                	je     801995 <strchr+0xe9>
+  80198f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801993:	eb 05                	jmp    80199a <strchr+0xee>
+  801995:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80199a:	c9                   	leave
+  80199b:	c3                   	ret
+
+000000000080199c <strfind>:
+strfind(const char *s, char c) {
+  80199c:	55                   	push   %rbp
+  80199d:	48 89 e5             	mov    %rsp,%rbp
+  8019a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8019a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019a8:	89 f0                	mov    %esi,%eax
+  8019aa:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8019ad:	eb 11                	jmp    8019c0 <strfind+0x24>
+    if (*s == c)
+  8019af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b3:	0f b6 00             	movzbl (%rax),%eax
+  8019b6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019b9:	74 12                	je     8019cd <strfind+0x31>
+  for (; *s; s++)
+  8019bb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c4:	0f b6 00             	movzbl (%rax),%eax
+  8019c7:	84 c0                	test   %al,%al
+  8019c9:	75 e4                	jne    8019af <strfind+0x13>
+  8019cb:	eb 01                	jmp    8019ce <strfind+0x32>
+      break;
+  8019cd:	90                   	nop
+  return (char *)s;
+  8019ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+
+00000000008019d4 <memset>:
+memset(void *v, int c, size_t n) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	48 83 ec 38          	sub    $0x38,%rsp
+  8019dc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019e0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8019e3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8019e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8019ef:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8019f4:	76 41                	jbe    801a37 <memset+0x63>
+  8019f6:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+  801a02:	83 e0 01             	and    $0x1,%eax
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	74 2e                	je     801a37 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801a09:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a0c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a10:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a14:	48 89 ce             	mov    %rcx,%rsi
+  801a17:	48 89 f7             	mov    %rsi,%rdi
+  801a1a:	48 89 d1             	mov    %rdx,%rcx
+  801a1d:	fc                   	cld
+  801a1e:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a20:	48 89 ca             	mov    %rcx,%rdx
+  801a23:	48 89 fe             	mov    %rdi,%rsi
+  801a26:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a2a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801a2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a32:	e9 a7 00 00 00       	jmp    801ade <memset+0x10a>
+  if (n >= 8) {
+  801a37:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a3c:	0f 86 87 00 00 00    	jbe    801ac9 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801a42:	eb 16                	jmp    801a5a <memset+0x86>
+      *p++ = c;
+  801a44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a48:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a4c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a50:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a53:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a55:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a5e:	83 e0 07             	and    $0x7,%eax
+  801a61:	48 85 c0             	test   %rax,%rax
+  801a64:	75 de                	jne    801a44 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801a66:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a69:	0f b6 c0             	movzbl %al,%eax
+  801a6c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a73:	01 01 01 
+  801a76:	48 0f af c2          	imul   %rdx,%rax
+  801a7a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a7e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a82:	48 c1 e8 03          	shr    $0x3,%rax
+  801a86:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801a8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a8e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a92:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a96:	48 89 ce             	mov    %rcx,%rsi
+  801a99:	48 89 f7             	mov    %rsi,%rdi
+  801a9c:	48 89 d1             	mov    %rdx,%rcx
+  801a9f:	fc                   	cld
+  801aa0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801aa3:	48 89 ca             	mov    %rcx,%rdx
+  801aa6:	48 89 fe             	mov    %rdi,%rsi
+  801aa9:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801aad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801ab1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ab6:	eb 11                	jmp    801ac9 <memset+0xf5>
+    *p++ = c;
+  801ab8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ac0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ac4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801ac7:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801ac9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801acd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ad1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ad5:	48 85 c0             	test   %rax,%rax
+  801ad8:	75 de                	jne    801ab8 <memset+0xe4>
+  return v;
+  801ada:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+0000000000801ae0 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	48 83 ec 38          	sub    $0x38,%rsp
+  801ae8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801aec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801af0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801af4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801af8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801afc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801b04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b08:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b0c:	0f 83 da 00 00 00    	jae    801bec <memmove+0x10c>
+  801b12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1a:	48 01 d0             	add    %rdx,%rax
+  801b1d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b21:	0f 83 c5 00 00 00    	jae    801bec <memmove+0x10c>
+    s += n;
+  801b27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b2b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801b2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b33:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801b37:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b3c:	0f 86 94 00 00 00    	jbe    801bd6 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801b42:	eb 1c                	jmp    801b60 <memmove+0x80>
+        *--d = *--s;
+  801b44:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b49:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b52:	0f b6 10             	movzbl (%rax),%edx
+  801b55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b59:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b5b:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b64:	83 e0 07             	and    $0x7,%eax
+  801b67:	48 85 c0             	test   %rax,%rax
+  801b6a:	75 d8                	jne    801b44 <memmove+0x64>
+      nq = n / 8;
+  801b6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b70:	48 c1 e8 03          	shr    $0x3,%rax
+  801b74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b78:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b7d:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801b82:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801b87:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b8b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b93:	48 89 cf             	mov    %rcx,%rdi
+  801b96:	48 89 d6             	mov    %rdx,%rsi
+  801b99:	48 89 c1             	mov    %rax,%rcx
+  801b9c:	fd                   	std
+  801b9d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801ba0:	fc                   	cld
+  801ba1:	48 89 c8             	mov    %rcx,%rax
+  801ba4:	48 89 f2             	mov    %rsi,%rdx
+  801ba7:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bab:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801baf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801bb3:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801bb8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801bbd:	eb 17                	jmp    801bd6 <memmove+0xf6>
+      *--d = *--s;
+  801bbf:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801bc4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801bc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bcd:	0f b6 10             	movzbl (%rax),%edx
+  801bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bd4:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801bd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bda:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bde:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801be2:	48 85 c0             	test   %rax,%rax
+  801be5:	75 d8                	jne    801bbf <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801be7:	e9 f4 00 00 00       	jmp    801ce0 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801bec:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801bf1:	76 46                	jbe    801c39 <memmove+0x159>
+  801bf3:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  801bfa:	00 00 00 
+  801bfd:	ff d0                	call   *%rax
+  801bff:	83 e0 01             	and    $0x1,%eax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	74 33                	je     801c39 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801c06:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c12:	48 89 cf             	mov    %rcx,%rdi
+  801c15:	48 89 d6             	mov    %rdx,%rsi
+  801c18:	48 89 c1             	mov    %rax,%rcx
+  801c1b:	fc                   	cld
+  801c1c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c1e:	48 89 c8             	mov    %rcx,%rax
+  801c21:	48 89 f2             	mov    %rsi,%rdx
+  801c24:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c28:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801c30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c34:	e9 ab 00 00 00       	jmp    801ce4 <memmove+0x204>
+    if (n >= 8) {
+  801c39:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c3e:	0f 86 8b 00 00 00    	jbe    801ccf <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801c44:	eb 22                	jmp    801c68 <memmove+0x188>
+        *d++ = *s++;
+  801c46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c4a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c56:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c5a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c5e:	0f b6 12             	movzbl (%rdx),%edx
+  801c61:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c63:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c6c:	83 e0 07             	and    $0x7,%eax
+  801c6f:	48 85 c0             	test   %rax,%rax
+  801c72:	75 d2                	jne    801c46 <memmove+0x166>
+      nq = n / 8;
+  801c74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c78:	48 c1 e8 03          	shr    $0x3,%rax
+  801c7c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c80:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c84:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c8c:	48 89 cf             	mov    %rcx,%rdi
+  801c8f:	48 89 d6             	mov    %rdx,%rsi
+  801c92:	48 89 c1             	mov    %rax,%rcx
+  801c95:	fc                   	cld
+  801c96:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c99:	48 89 c8             	mov    %rcx,%rax
+  801c9c:	48 89 f2             	mov    %rsi,%rdx
+  801c9f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ca3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ca7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801cab:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801cb0:	eb 1d                	jmp    801ccf <memmove+0x1ef>
+      *d++ = *s++;
+  801cb2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cb6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801cbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cc2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cc6:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801cca:	0f b6 12             	movzbl (%rdx),%edx
+  801ccd:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ccf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cd3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cd7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cdb:	48 85 c0             	test   %rax,%rax
+  801cde:	75 d2                	jne    801cb2 <memmove+0x1d2>
+  return dst;
+  801ce0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801ce4:	c9                   	leave
+  801ce5:	c3                   	ret
+
+0000000000801ce6 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ce6:	55                   	push   %rbp
+  801ce7:	48 89 e5             	mov    %rsp,%rbp
+  801cea:	48 83 ec 18          	sub    $0x18,%rsp
+  801cee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cf2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801cf6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801cfa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cfe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d06:	48 89 ce             	mov    %rcx,%rsi
+  801d09:	48 89 c7             	mov    %rax,%rdi
+  801d0c:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+}
+  801d18:	c9                   	leave
+  801d19:	c3                   	ret
+
+0000000000801d1a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d1a:	55                   	push   %rbp
+  801d1b:	48 89 e5             	mov    %rsp,%rbp
+  801d1e:	48 83 ec 40          	sub    $0x40,%rsp
+  801d22:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d26:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d2a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801d2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d32:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801d36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d3a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d3e:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801d43:	0f 86 a7 00 00 00    	jbe    801df0 <memcmp+0xd6>
+  801d49:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  801d50:	00 00 00 
+  801d53:	ff d0                	call   *%rax
+  801d55:	83 e0 02             	and    $0x2,%eax
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	0f 84 90 00 00 00    	je     801df0 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801d60:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d64:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d6c:	48 89 ce             	mov    %rcx,%rsi
+  801d6f:	48 89 c7             	mov    %rax,%rdi
+  801d72:	48 b8 01 13 80 00 00 	movabs $0x801301,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	e9 c2 00 00 00       	jmp    801e45 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801d83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d87:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d8b:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d93:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d97:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d9b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801da2:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801da9:	74 36                	je     801de1 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801dab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dae:	f7 d0                	not    %eax
+  801db0:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801db4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801db7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801dba:	48 63 d0             	movslq %eax,%rdx
+  801dbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dc1:	48 01 d0             	add    %rdx,%rax
+  801dc4:	0f b6 00             	movzbl (%rax),%eax
+  801dc7:	0f b6 c0             	movzbl %al,%eax
+  801dca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801dcd:	48 63 ca             	movslq %edx,%rcx
+  801dd0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dd4:	48 01 ca             	add    %rcx,%rdx
+  801dd7:	0f b6 12             	movzbl (%rdx),%edx
+  801dda:	0f b6 d2             	movzbl %dl,%edx
+  801ddd:	29 d0                	sub    %edx,%eax
+  801ddf:	eb 64                	jmp    801e45 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801de1:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801de6:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801deb:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801df0:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801df5:	77 8c                	ja     801d83 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801df7:	eb 36                	jmp    801e2f <memcmp+0x115>
+    if (*s1 != *s2)
+  801df9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dfd:	0f b6 10             	movzbl (%rax),%edx
+  801e00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e04:	0f b6 00             	movzbl (%rax),%eax
+  801e07:	38 c2                	cmp    %al,%dl
+  801e09:	74 1a                	je     801e25 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801e0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e0f:	0f b6 00             	movzbl (%rax),%eax
+  801e12:	0f b6 c8             	movzbl %al,%ecx
+  801e15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e19:	0f b6 00             	movzbl (%rax),%eax
+  801e1c:	0f b6 d0             	movzbl %al,%edx
+  801e1f:	89 c8                	mov    %ecx,%eax
+  801e21:	29 d0                	sub    %edx,%eax
+  801e23:	eb 20                	jmp    801e45 <memcmp+0x12b>
+    s1++, s2++;
+  801e25:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e2a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801e2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e33:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e3b:	48 85 c0             	test   %rax,%rax
+  801e3e:	75 b9                	jne    801df9 <memcmp+0xdf>
+  }
+
+  return 0;
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+
+0000000000801e47 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801e47:	55                   	push   %rbp
+  801e48:	48 89 e5             	mov    %rsp,%rbp
+  801e4b:	48 83 ec 50          	sub    $0x50,%rsp
+  801e4f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e53:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e56:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e5a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e5e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801e62:	48 01 d0             	add    %rdx,%rax
+  801e65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801e69:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e6c:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e70:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e74:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e78:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e7d:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e81:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801e86:	76 73                	jbe    801efb <memfind+0xb4>
+  801e88:	48 b8 39 11 80 00 00 	movabs $0x801139,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+  801e94:	83 e0 02             	and    $0x2,%eax
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	74 60                	je     801efb <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801e9b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e9e:	0f b6 c8             	movzbl %al,%ecx
+  801ea1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ea5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea9:	89 ce                	mov    %ecx,%esi
+  801eab:	48 89 c7             	mov    %rax,%rdi
+  801eae:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+  801eba:	eb 6c                	jmp    801f28 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801ebc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ec0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ec4:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ec8:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801ecd:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ed1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ed5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801ed8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801edc:	74 13                	je     801ef1 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801ede:	31 c0                	xor    %eax,%eax
+  801ee0:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801ee5:	48 63 d0             	movslq %eax,%rdx
+  801ee8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eec:	48 01 d0             	add    %rdx,%rax
+  801eef:	eb 37                	jmp    801f28 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801ef1:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801ef6:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801efb:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f00:	77 ba                	ja     801ebc <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f02:	eb 13                	jmp    801f17 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801f04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f08:	0f b6 00             	movzbl (%rax),%eax
+  801f0b:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f0e:	38 d0                	cmp    %dl,%al
+  801f10:	74 11                	je     801f23 <memfind+0xdc>
+  for (; s < ends; s++)
+  801f12:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f1b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f1f:	72 e3                	jb     801f04 <memfind+0xbd>
+  801f21:	eb 01                	jmp    801f24 <memfind+0xdd>
+      break;
+  801f23:	90                   	nop
+  return (void *)s;
+  801f24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+0000000000801f2a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	48 83 ec 38          	sub    $0x38,%rsp
+  801f32:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f36:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f3a:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801f3d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801f44:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801f4b:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f4c:	eb 05                	jmp    801f53 <strtol+0x29>
+    s++;
+  801f4e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f57:	0f b6 00             	movzbl (%rax),%eax
+  801f5a:	3c 20                	cmp    $0x20,%al
+  801f5c:	74 f0                	je     801f4e <strtol+0x24>
+  801f5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f62:	0f b6 00             	movzbl (%rax),%eax
+  801f65:	3c 09                	cmp    $0x9,%al
+  801f67:	74 e5                	je     801f4e <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801f69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f6d:	0f b6 00             	movzbl (%rax),%eax
+  801f70:	3c 2b                	cmp    $0x2b,%al
+  801f72:	75 07                	jne    801f7b <strtol+0x51>
+    s++;
+  801f74:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f79:	eb 17                	jmp    801f92 <strtol+0x68>
+  else if (*s == '-')
+  801f7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f7f:	0f b6 00             	movzbl (%rax),%eax
+  801f82:	3c 2d                	cmp    $0x2d,%al
+  801f84:	75 0c                	jne    801f92 <strtol+0x68>
+    s++, neg = 1;
+  801f86:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f8b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f92:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f96:	74 06                	je     801f9e <strtol+0x74>
+  801f98:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f9c:	75 28                	jne    801fc6 <strtol+0x9c>
+  801f9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa2:	0f b6 00             	movzbl (%rax),%eax
+  801fa5:	3c 30                	cmp    $0x30,%al
+  801fa7:	75 1d                	jne    801fc6 <strtol+0x9c>
+  801fa9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fad:	48 83 c0 01          	add    $0x1,%rax
+  801fb1:	0f b6 00             	movzbl (%rax),%eax
+  801fb4:	3c 78                	cmp    $0x78,%al
+  801fb6:	75 0e                	jne    801fc6 <strtol+0x9c>
+    s += 2, base = 16;
+  801fb8:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801fbd:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801fc4:	eb 2c                	jmp    801ff2 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801fc6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fca:	75 19                	jne    801fe5 <strtol+0xbb>
+  801fcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd0:	0f b6 00             	movzbl (%rax),%eax
+  801fd3:	3c 30                	cmp    $0x30,%al
+  801fd5:	75 0e                	jne    801fe5 <strtol+0xbb>
+    s++, base = 8;
+  801fd7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801fdc:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801fe3:	eb 0d                	jmp    801ff2 <strtol+0xc8>
+  else if (base == 0)
+  801fe5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fe9:	75 07                	jne    801ff2 <strtol+0xc8>
+    base = 10;
+  801feb:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801ff2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff6:	0f b6 00             	movzbl (%rax),%eax
+  801ff9:	3c 2f                	cmp    $0x2f,%al
+  801ffb:	7e 1d                	jle    80201a <strtol+0xf0>
+  801ffd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802001:	0f b6 00             	movzbl (%rax),%eax
+  802004:	3c 39                	cmp    $0x39,%al
+  802006:	7f 12                	jg     80201a <strtol+0xf0>
+      dig = *s - '0';
+  802008:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80200c:	0f b6 00             	movzbl (%rax),%eax
+  80200f:	0f be c0             	movsbl %al,%eax
+  802012:	83 e8 30             	sub    $0x30,%eax
+  802015:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802018:	eb 4e                	jmp    802068 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80201a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80201e:	0f b6 00             	movzbl (%rax),%eax
+  802021:	3c 60                	cmp    $0x60,%al
+  802023:	7e 1d                	jle    802042 <strtol+0x118>
+  802025:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802029:	0f b6 00             	movzbl (%rax),%eax
+  80202c:	3c 7a                	cmp    $0x7a,%al
+  80202e:	7f 12                	jg     802042 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802030:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802034:	0f b6 00             	movzbl (%rax),%eax
+  802037:	0f be c0             	movsbl %al,%eax
+  80203a:	83 e8 57             	sub    $0x57,%eax
+  80203d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802040:	eb 26                	jmp    802068 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802042:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802046:	0f b6 00             	movzbl (%rax),%eax
+  802049:	3c 40                	cmp    $0x40,%al
+  80204b:	7e 47                	jle    802094 <strtol+0x16a>
+  80204d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802051:	0f b6 00             	movzbl (%rax),%eax
+  802054:	3c 5a                	cmp    $0x5a,%al
+  802056:	7f 3c                	jg     802094 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802058:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80205c:	0f b6 00             	movzbl (%rax),%eax
+  80205f:	0f be c0             	movsbl %al,%eax
+  802062:	83 e8 37             	sub    $0x37,%eax
+  802065:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802068:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80206b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80206e:	7d 23                	jge    802093 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802070:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802075:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802078:	48 98                	cltq
+  80207a:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80207f:	48 89 c2             	mov    %rax,%rdx
+  802082:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802085:	48 98                	cltq
+  802087:	48 01 d0             	add    %rdx,%rax
+  80208a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80208e:	e9 5f ff ff ff       	jmp    801ff2 <strtol+0xc8>
+      break;
+  802093:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802094:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802099:	74 0b                	je     8020a6 <strtol+0x17c>
+    *endptr = (char *)s;
+  80209b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8020a3:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8020a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020aa:	74 09                	je     8020b5 <strtol+0x18b>
+  8020ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020b0:	48 f7 d8             	neg    %rax
+  8020b3:	eb 04                	jmp    8020b9 <strtol+0x18f>
+  8020b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8020b9:	c9                   	leave
+  8020ba:	c3                   	ret
+
+00000000008020bb <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8020bb:	55                   	push   %rbp
+  8020bc:	48 89 e5             	mov    %rsp,%rbp
+  8020bf:	53                   	push   %rbx
+  8020c0:	48 83 ec 48          	sub    $0x48,%rsp
+  8020c4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8020c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8020cc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020d0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8020d4:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8020d8:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8020dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020e8:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8020ec:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020f0:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8020f4:	4c 89 c3             	mov    %r8,%rbx
+  8020f7:	cd 30                	int    $0x30
+  8020f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8020fd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802102:	74 46                	je     80214a <syscall+0x8f>
+  802104:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802109:	7e 3f                	jle    80214a <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80210b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80210f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802113:	49 89 d0             	mov    %rdx,%r8
+  802116:	48 89 c1             	mov    %rax,%rcx
+  802119:	48 b8 e8 6b 80 00 00 	movabs $0x806be8,%rax
+  802120:	00 00 00 
+  802123:	48 89 c2             	mov    %rax,%rdx
+  802126:	be 22 00 00 00       	mov    $0x22,%esi
+  80212b:	48 b8 07 6c 80 00 00 	movabs $0x806c07,%rax
+  802132:	00 00 00 
+  802135:	48 89 c7             	mov    %rax,%rdi
+  802138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80213d:	49 b9 ce 03 80 00 00 	movabs $0x8003ce,%r9
+  802144:	00 00 00 
+  802147:	41 ff d1             	call   *%r9
+
+  return ret;
+  80214a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80214e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+
+0000000000802154 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+  802158:	48 83 ec 10          	sub    $0x10,%rsp
+  80215c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802160:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802164:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802168:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80216c:	48 83 ec 08          	sub    $0x8,%rsp
+  802170:	6a 00                	push   $0x0
+  802172:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802178:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217e:	48 89 d1             	mov    %rdx,%rcx
+  802181:	48 89 c2             	mov    %rax,%rdx
+  802184:	be 00 00 00 00       	mov    $0x0,%esi
+  802189:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218e:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+  80219a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219e:	90                   	nop
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+00000000008021a1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8021a1:	55                   	push   %rbp
+  8021a2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a9:	6a 00                	push   $0x0
+  8021ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021cb:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+  8021d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+
+00000000008021dd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8021dd:	55                   	push   %rbp
+  8021de:	48 89 e5             	mov    %rsp,%rbp
+  8021e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021eb:	48 98                	cltq
+  8021ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f1:	6a 00                	push   $0x0
+  8021f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802204:	48 89 c2             	mov    %rax,%rdx
+  802207:	be 01 00 00 00       	mov    $0x1,%esi
+  80220c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802211:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+  80221d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802221:	c9                   	leave
+  802222:	c3                   	ret
+
+0000000000802223 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802223:	55                   	push   %rbp
+  802224:	48 89 e5             	mov    %rsp,%rbp
+  802227:	48 83 ec 10          	sub    $0x10,%rsp
+  80222b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80222e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802231:	48 98                	cltq
+  802233:	48 83 ec 08          	sub    $0x8,%rsp
+  802237:	6a 00                	push   $0x0
+  802239:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80223f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80224a:	48 89 c2             	mov    %rax,%rdx
+  80224d:	be 00 00 00 00       	mov    $0x0,%esi
+  802252:	bf 04 00 00 00       	mov    $0x4,%edi
+  802257:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80225e:	00 00 00 
+  802261:	ff d0                	call   *%rax
+  802263:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802267:	90                   	nop
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+
+000000000080226a <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	48 83 ec 20          	sub    $0x20,%rsp
+  802272:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802275:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802279:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80227c:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80227f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802284:	cd 30                	int    $0x30
+  802286:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80228a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80228e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802293:	7e 3d                	jle    8022d2 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802295:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802299:	49 89 c0             	mov    %rax,%r8
+  80229c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8022a1:	48 b8 e8 6b 80 00 00 	movabs $0x806be8,%rax
+  8022a8:	00 00 00 
+  8022ab:	48 89 c2             	mov    %rax,%rdx
+  8022ae:	be 49 00 00 00       	mov    $0x49,%esi
+  8022b3:	48 b8 07 6c 80 00 00 	movabs $0x806c07,%rax
+  8022ba:	00 00 00 
+  8022bd:	48 89 c7             	mov    %rax,%rdi
+  8022c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c5:	49 b9 ce 03 80 00 00 	movabs $0x8003ce,%r9
+  8022cc:	00 00 00 
+  8022cf:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8022d2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022d7:	75 13                	jne    8022ec <sys_env_wait+0x82>
+  8022d9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8022de:	74 0c                	je     8022ec <sys_env_wait+0x82>
+    *status = st;
+  8022e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022e4:	89 c2                	mov    %eax,%edx
+  8022e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022ea:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8022ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+00000000008022f2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8022f2:	55                   	push   %rbp
+  8022f3:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8022f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802302:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802308:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80230d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802312:	be 00 00 00 00       	mov    $0x0,%esi
+  802317:	bf 02 00 00 00       	mov    $0x2,%edi
+  80231c:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+  802328:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+000000000080232e <sys_yield>:
+
+void
+sys_yield(void) {
+  80232e:	55                   	push   %rbp
+  80232f:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802332:	48 83 ec 08          	sub    $0x8,%rsp
+  802336:	6a 00                	push   $0x0
+  802338:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80233e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802344:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234e:	be 00 00 00 00       	mov    $0x0,%esi
+  802353:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802358:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802368:	90                   	nop
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+000000000080236b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80236b:	55                   	push   %rbp
+  80236c:	48 89 e5             	mov    %rsp,%rbp
+  80236f:	48 83 ec 20          	sub    $0x20,%rsp
+  802373:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802376:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80237a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80237d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802380:	48 63 c8             	movslq %eax,%rcx
+  802383:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802387:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80238a:	48 98                	cltq
+  80238c:	48 83 ec 08          	sub    $0x8,%rsp
+  802390:	6a 00                	push   $0x0
+  802392:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802398:	49 89 c8             	mov    %rcx,%r8
+  80239b:	48 89 d1             	mov    %rdx,%rcx
+  80239e:	48 89 c2             	mov    %rax,%rdx
+  8023a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023ab:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	48 83 c4 10          	add    $0x10,%rsp
+  8023bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8023be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+
+00000000008023c3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8023c3:	55                   	push   %rbp
+  8023c4:	48 89 e5             	mov    %rsp,%rbp
+  8023c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8023cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023d2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8023d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023d9:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8023dd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023e0:	48 63 c8             	movslq %eax,%rcx
+  8023e3:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023e7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023ea:	48 63 f0             	movslq %eax,%rsi
+  8023ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023f4:	48 98                	cltq
+  8023f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fa:	51                   	push   %rcx
+  8023fb:	49 89 f9             	mov    %rdi,%r9
+  8023fe:	49 89 f0             	mov    %rsi,%r8
+  802401:	48 89 d1             	mov    %rdx,%rcx
+  802404:	48 89 c2             	mov    %rax,%rdx
+  802407:	be 01 00 00 00       	mov    $0x1,%esi
+  80240c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802411:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802421:	c9                   	leave
+  802422:	c3                   	ret
+
+0000000000802423 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	48 83 ec 10          	sub    $0x10,%rsp
+  80242b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802432:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802436:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802439:	48 98                	cltq
+  80243b:	48 83 ec 08          	sub    $0x8,%rsp
+  80243f:	6a 00                	push   $0x0
+  802441:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80244d:	48 89 d1             	mov    %rdx,%rcx
+  802450:	48 89 c2             	mov    %rax,%rdx
+  802453:	be 01 00 00 00       	mov    $0x1,%esi
+  802458:	bf 08 00 00 00       	mov    $0x8,%edi
+  80245d:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+  802469:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80246d:	c9                   	leave
+  80246e:	c3                   	ret
+
+000000000080246f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80246f:	55                   	push   %rbp
+  802470:	48 89 e5             	mov    %rsp,%rbp
+  802473:	48 83 ec 10          	sub    $0x10,%rsp
+  802477:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80247a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80247d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802480:	48 63 d0             	movslq %eax,%rdx
+  802483:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802486:	48 98                	cltq
+  802488:	48 83 ec 08          	sub    $0x8,%rsp
+  80248c:	6a 00                	push   $0x0
+  80248e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80249a:	48 89 d1             	mov    %rdx,%rcx
+  80249d:	48 89 c2             	mov    %rax,%rdx
+  8024a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024aa:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8024b1:	00 00 00 
+  8024b4:	ff d0                	call   *%rax
+  8024b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ba:	c9                   	leave
+  8024bb:	c3                   	ret
+
+00000000008024bc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8024bc:	55                   	push   %rbp
+  8024bd:	48 89 e5             	mov    %rsp,%rbp
+  8024c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8024cb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024d2:	48 98                	cltq
+  8024d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d8:	6a 00                	push   $0x0
+  8024da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024e6:	48 89 d1             	mov    %rdx,%rcx
+  8024e9:	48 89 c2             	mov    %rax,%rdx
+  8024ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8024f6:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+  802502:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802506:	c9                   	leave
+  802507:	c3                   	ret
+
+0000000000802508 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802508:	55                   	push   %rbp
+  802509:	48 89 e5             	mov    %rsp,%rbp
+  80250c:	48 83 ec 10          	sub    $0x10,%rsp
+  802510:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802513:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802517:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80251b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80251e:	48 98                	cltq
+  802520:	48 83 ec 08          	sub    $0x8,%rsp
+  802524:	6a 00                	push   $0x0
+  802526:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80252c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802532:	48 89 d1             	mov    %rdx,%rcx
+  802535:	48 89 c2             	mov    %rax,%rdx
+  802538:	be 01 00 00 00       	mov    $0x1,%esi
+  80253d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802542:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802549:	00 00 00 
+  80254c:	ff d0                	call   *%rax
+  80254e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+0000000000802554 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+  802558:	48 83 ec 20          	sub    $0x20,%rsp
+  80255c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80255f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802563:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802567:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80256a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80256d:	48 63 f0             	movslq %eax,%rsi
+  802570:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802574:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802578:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80257b:	48 98                	cltq
+  80257d:	48 83 ec 08          	sub    $0x8,%rsp
+  802581:	6a 00                	push   $0x0
+  802583:	49 89 f1             	mov    %rsi,%r9
+  802586:	49 89 c8             	mov    %rcx,%r8
+  802589:	48 89 d1             	mov    %rdx,%rcx
+  80258c:	48 89 c2             	mov    %rax,%rdx
+  80258f:	be 00 00 00 00       	mov    $0x0,%esi
+  802594:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802599:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+  8025a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a9:	c9                   	leave
+  8025aa:	c3                   	ret
+
+00000000008025ab <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+  8025af:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8025b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bf:	6a 00                	push   $0x0
+  8025c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d2:	48 89 c2             	mov    %rax,%rdx
+  8025d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8025da:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025df:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ef:	c9                   	leave
+  8025f0:	c3                   	ret
+
+00000000008025f1 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8025f1:	55                   	push   %rbp
+  8025f2:	48 89 e5             	mov    %rsp,%rbp
+  8025f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8025f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802601:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802605:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802609:	48 83 ec 08          	sub    $0x8,%rsp
+  80260d:	6a 00                	push   $0x0
+  80260f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80261b:	48 89 d1             	mov    %rdx,%rcx
+  80261e:	48 89 c2             	mov    %rax,%rdx
+  802621:	be 01 00 00 00       	mov    $0x1,%esi
+  802626:	bf 10 00 00 00       	mov    $0x10,%edi
+  80262b:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  802637:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+000000000080263d <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802641:	48 83 ec 08          	sub    $0x8,%rsp
+  802645:	6a 00                	push   $0x0
+  802647:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802653:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265d:	be 00 00 00 00       	mov    $0x0,%esi
+  802662:	bf 11 00 00 00       	mov    $0x11,%edi
+  802667:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802677:	c9                   	leave
+  802678:	c3                   	ret
+
+0000000000802679 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802679:	55                   	push   %rbp
+  80267a:	48 89 e5             	mov    %rsp,%rbp
+  80267d:	48 83 ec 10          	sub    $0x10,%rsp
+  802681:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802685:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802689:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80268d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802691:	48 83 ec 08          	sub    $0x8,%rsp
+  802695:	6a 00                	push   $0x0
+  802697:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80269d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026a3:	48 89 d1             	mov    %rdx,%rcx
+  8026a6:	48 89 c2             	mov    %rax,%rdx
+  8026a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ae:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026b3:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8026ba:	00 00 00 
+  8026bd:	ff d0                	call   *%rax
+  8026bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c3:	c9                   	leave
+  8026c4:	c3                   	ret
+
+00000000008026c5 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8026c5:	55                   	push   %rbp
+  8026c6:	48 89 e5             	mov    %rsp,%rbp
+  8026c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8026cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026d5:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8026d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026db:	48 63 c8             	movslq %eax,%rcx
+  8026de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ea:	6a 00                	push   $0x0
+  8026ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f2:	49 89 c8             	mov    %rcx,%r8
+  8026f5:	48 89 d1             	mov    %rdx,%rcx
+  8026f8:	48 89 c2             	mov    %rax,%rdx
+  8026fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802700:	bf 13 00 00 00       	mov    $0x13,%edi
+  802705:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80270c:	00 00 00 
+  80270f:	ff d0                	call   *%rax
+  802711:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+0000000000802717 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	48 83 ec 20          	sub    $0x20,%rsp
+  80271f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802723:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802726:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80272a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80272e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802731:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802735:	48 83 ec 08          	sub    $0x8,%rsp
+  802739:	6a 00                	push   $0x0
+  80273b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802741:	49 89 c8             	mov    %rcx,%r8
+  802744:	48 89 d1             	mov    %rdx,%rcx
+  802747:	48 89 c2             	mov    %rax,%rdx
+  80274a:	be 00 00 00 00       	mov    $0x0,%esi
+  80274f:	bf 14 00 00 00       	mov    $0x14,%edi
+  802754:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802764:	c9                   	leave
+  802765:	c3                   	ret
+
+0000000000802766 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802766:	55                   	push   %rbp
+  802767:	48 89 e5             	mov    %rsp,%rbp
+  80276a:	48 83 ec 10          	sub    $0x10,%rsp
+  80276e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802772:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802775:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802778:	48 63 d0             	movslq %eax,%rdx
+  80277b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80277f:	48 83 ec 08          	sub    $0x8,%rsp
+  802783:	6a 00                	push   $0x0
+  802785:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802791:	48 89 d1             	mov    %rdx,%rcx
+  802794:	48 89 c2             	mov    %rax,%rdx
+  802797:	be 00 00 00 00       	mov    $0x0,%esi
+  80279c:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027a1:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8027a8:	00 00 00 
+  8027ab:	ff d0                	call   *%rax
+  8027ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b1:	c9                   	leave
+  8027b2:	c3                   	ret
+
+00000000008027b3 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8027b3:	55                   	push   %rbp
+  8027b4:	48 89 e5             	mov    %rsp,%rbp
+  8027b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8027bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027bf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027c2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8027c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8027c9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027cd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8027d0:	48 63 c8             	movslq %eax,%rcx
+  8027d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027d6:	48 63 d0             	movslq %eax,%rdx
+  8027d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e1:	6a 00                	push   $0x0
+  8027e3:	49 89 f1             	mov    %rsi,%r9
+  8027e6:	49 89 c8             	mov    %rcx,%r8
+  8027e9:	48 89 d1             	mov    %rdx,%rcx
+  8027ec:	48 89 c2             	mov    %rax,%rdx
+  8027ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f4:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027f9:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+  802805:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802809:	c9                   	leave
+  80280a:	c3                   	ret
+
+000000000080280b <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80280b:	55                   	push   %rbp
+  80280c:	48 89 e5             	mov    %rsp,%rbp
+  80280f:	48 83 ec 30          	sub    $0x30,%rsp
+  802813:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802817:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80281b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80281f:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802823:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802827:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80282b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80282f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802833:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802837:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283b:	48 83 ec 08          	sub    $0x8,%rsp
+  80283f:	51                   	push   %rcx
+  802840:	49 89 f9             	mov    %rdi,%r9
+  802843:	49 89 f0             	mov    %rsi,%r8
+  802846:	48 89 d1             	mov    %rdx,%rcx
+  802849:	48 89 c2             	mov    %rax,%rdx
+  80284c:	be 00 00 00 00       	mov    $0x0,%esi
+  802851:	bf 17 00 00 00       	mov    $0x17,%edi
+  802856:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  80285d:	00 00 00 
+  802860:	ff d0                	call   *%rax
+  802862:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+0000000000802868 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802868:	55                   	push   %rbp
+  802869:	48 89 e5             	mov    %rsp,%rbp
+  80286c:	48 83 ec 10          	sub    $0x10,%rsp
+  802870:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802873:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802876:	48 98                	cltq
+  802878:	48 83 ec 08          	sub    $0x8,%rsp
+  80287c:	6a 00                	push   $0x0
+  80287e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802884:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80288a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80288f:	48 89 c2             	mov    %rax,%rdx
+  802892:	be 00 00 00 00       	mov    $0x0,%esi
+  802897:	bf 18 00 00 00       	mov    $0x18,%edi
+  80289c:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ac:	90                   	nop
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+
+00000000008028af <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8028af:	55                   	push   %rbp
+  8028b0:	48 89 e5             	mov    %rsp,%rbp
+  8028b3:	48 83 ec 30          	sub    $0x30,%rsp
+  8028b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028be:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8028c2:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8028c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8028c8:	48 63 f0             	movslq %eax,%rsi
+  8028cb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8028d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028d6:	48 98                	cltq
+  8028d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028dc:	6a 00                	push   $0x0
+  8028de:	49 89 f1             	mov    %rsi,%r9
+  8028e1:	49 89 c8             	mov    %rcx,%r8
+  8028e4:	48 89 d1             	mov    %rdx,%rcx
+  8028e7:	48 89 c2             	mov    %rax,%rdx
+  8028ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ef:	bf 19 00 00 00       	mov    $0x19,%edi
+  8028f4:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8028fb:	00 00 00 
+  8028fe:	ff d0                	call   *%rax
+  802900:	48 83 c4 10          	add    $0x10,%rsp
+  802904:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802907:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+
+000000000080290c <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80290c:	55                   	push   %rbp
+  80290d:	48 89 e5             	mov    %rsp,%rbp
+  802910:	48 83 ec 20          	sub    $0x20,%rsp
+  802914:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802918:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80291c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80291f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802922:	48 63 c8             	movslq %eax,%rcx
+  802925:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802929:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80292d:	48 83 ec 08          	sub    $0x8,%rsp
+  802931:	6a 00                	push   $0x0
+  802933:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802939:	49 89 c8             	mov    %rcx,%r8
+  80293c:	48 89 d1             	mov    %rdx,%rcx
+  80293f:	48 89 c2             	mov    %rax,%rdx
+  802942:	be 01 00 00 00       	mov    $0x1,%esi
+  802947:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80294c:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802953:	00 00 00 
+  802956:	ff d0                	call   *%rax
+  802958:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80295c:	c9                   	leave
+  80295d:	c3                   	ret
+
+000000000080295e <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80295e:	55                   	push   %rbp
+  80295f:	48 89 e5             	mov    %rsp,%rbp
+  802962:	48 83 ec 20          	sub    $0x20,%rsp
+  802966:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80296a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80296e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802972:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802976:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80297a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80297e:	48 83 ec 08          	sub    $0x8,%rsp
+  802982:	6a 00                	push   $0x0
+  802984:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80298a:	49 89 c8             	mov    %rcx,%r8
+  80298d:	48 89 d1             	mov    %rdx,%rcx
+  802990:	48 89 c2             	mov    %rax,%rdx
+  802993:	be 01 00 00 00       	mov    $0x1,%esi
+  802998:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80299d:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+  8029a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+00000000008029af <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	48 83 ec 30          	sub    $0x30,%rsp
+  8029b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029bf:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8029c2:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8029c6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8029ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029cd:	48 63 c8             	movslq %eax,%rcx
+  8029d0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8029dc:	6a 00                	push   $0x0
+  8029de:	49 89 f1             	mov    %rsi,%r9
+  8029e1:	49 89 c8             	mov    %rcx,%r8
+  8029e4:	48 89 d1             	mov    %rdx,%rcx
+  8029e7:	48 89 c2             	mov    %rax,%rdx
+  8029ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ef:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8029f4:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	48 83 c4 10          	add    $0x10,%rsp
+  802a04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a0a:	c9                   	leave
+  802a0b:	c3                   	ret
+
+0000000000802a0c <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802a0c:	55                   	push   %rbp
+  802a0d:	48 89 e5             	mov    %rsp,%rbp
+  802a10:	48 83 ec 10          	sub    $0x10,%rsp
+  802a14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a1a:	48 98                	cltq
+  802a1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a20:	6a 00                	push   $0x0
+  802a22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a33:	48 89 c2             	mov    %rax,%rdx
+  802a36:	be 01 00 00 00       	mov    $0x1,%esi
+  802a3b:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802a40:	48 b8 bb 20 80 00 00 	movabs $0x8020bb,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+  802a4c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+
+0000000000802a52 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802a52:	55                   	push   %rbp
+  802a53:	48 89 e5             	mov    %rsp,%rbp
+  802a56:	48 83 ec 40          	sub    $0x40,%rsp
+  802a5a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802a5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a62:	48 8b 00             	mov    (%rax),%rax
+  802a65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802a69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a6d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a71:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802a75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a79:	83 e0 02             	and    $0x2,%eax
+  802a7c:	48 85 c0             	test   %rax,%rax
+  802a7f:	74 25                	je     802aa6 <pgfault+0x54>
+  802a81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a85:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a89:	48 89 c2             	mov    %rax,%rdx
+  802a8c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a93:	01 00 00 
+  802a96:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a9a:	83 e0 02             	and    $0x2,%eax
+  802a9d:	48 85 c0             	test   %rax,%rax
+  802aa0:	0f 85 fe 01 00 00    	jne    802ca4 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802aa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802aaa:	83 e0 02             	and    $0x2,%eax
+  802aad:	48 85 c0             	test   %rax,%rax
+  802ab0:	74 23                	je     802ad5 <pgfault+0x83>
+  802ab2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aba:	48 89 c2             	mov    %rax,%rdx
+  802abd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ac4:	01 00 00 
+  802ac7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802acb:	25 00 08 00 00       	and    $0x800,%eax
+  802ad0:	48 85 c0             	test   %rax,%rax
+  802ad3:	75 3f                	jne    802b14 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802ad5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ad9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802add:	49 89 d0             	mov    %rdx,%r8
+  802ae0:	48 89 c1             	mov    %rax,%rcx
+  802ae3:	48 b8 18 6c 80 00 00 	movabs $0x806c18,%rax
+  802aea:	00 00 00 
+  802aed:	48 89 c2             	mov    %rax,%rdx
+  802af0:	be 26 00 00 00       	mov    $0x26,%esi
+  802af5:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802afc:	00 00 00 
+  802aff:	48 89 c7             	mov    %rax,%rdi
+  802b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b07:	49 b9 ce 03 80 00 00 	movabs $0x8003ce,%r9
+  802b0e:	00 00 00 
+  802b11:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802b14:	48 b8 0a 57 80 00 00 	movabs $0x80570a,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+  802b20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b28:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b2d:	48 89 c6             	mov    %rax,%rsi
+  802b30:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b35:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+  802b41:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802b44:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802b48:	79 36                	jns    802b80 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802b4a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802b4d:	89 c1                	mov    %eax,%ecx
+  802b4f:	48 b8 58 6c 80 00 00 	movabs $0x806c58,%rax
+  802b56:	00 00 00 
+  802b59:	48 89 c2             	mov    %rax,%rdx
+  802b5c:	be 35 00 00 00       	mov    $0x35,%esi
+  802b61:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802b68:	00 00 00 
+  802b6b:	48 89 c7             	mov    %rax,%rdi
+  802b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b73:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  802b7a:	00 00 00 
+  802b7d:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b84:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802b88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b8c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b92:	48 89 c1             	mov    %rax,%rcx
+  802b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9e:	48 89 ce             	mov    %rcx,%rsi
+  802ba1:	48 89 c7             	mov    %rax,%rdi
+  802ba4:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bb8:	48 89 c2             	mov    %rax,%rdx
+  802bbb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bc2:	01 00 00 
+  802bc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc9:	25 00 08 00 00       	and    $0x800,%eax
+  802bce:	48 85 c0             	test   %rax,%rax
+  802bd1:	74 7a                	je     802c4d <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bd7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802bdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bdf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802be5:	48 89 c2             	mov    %rax,%rdx
+  802be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bec:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802bf2:	48 89 d1             	mov    %rdx,%rcx
+  802bf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfa:	48 89 c6             	mov    %rax,%rsi
+  802bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c02:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802c09:	00 00 00 
+  802c0c:	ff d0                	call   *%rax
+  802c0e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c11:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c15:	79 36                	jns    802c4d <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802c17:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c1a:	89 c1                	mov    %eax,%ecx
+  802c1c:	48 b8 80 6c 80 00 00 	movabs $0x806c80,%rax
+  802c23:	00 00 00 
+  802c26:	48 89 c2             	mov    %rax,%rdx
+  802c29:	be 42 00 00 00       	mov    $0x42,%esi
+  802c2e:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802c35:	00 00 00 
+  802c38:	48 89 c7             	mov    %rax,%rdi
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c40:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  802c47:	00 00 00 
+  802c4a:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802c4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c51:	48 89 c6             	mov    %rax,%rsi
+  802c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c59:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+  802c65:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802c68:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c6c:	79 37                	jns    802ca5 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802c6e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c71:	89 c1                	mov    %eax,%ecx
+  802c73:	48 b8 a8 6c 80 00 00 	movabs $0x806ca8,%rax
+  802c7a:	00 00 00 
+  802c7d:	48 89 c2             	mov    %rax,%rdx
+  802c80:	be 46 00 00 00       	mov    $0x46,%esi
+  802c85:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802c8c:	00 00 00 
+  802c8f:	48 89 c7             	mov    %rax,%rdi
+  802c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c97:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  802c9e:	00 00 00 
+  802ca1:	41 ff d0             	call   *%r8
+    return;
+  802ca4:	90                   	nop
+  }
+}
+  802ca5:	c9                   	leave
+  802ca6:	c3                   	ret
+
+0000000000802ca7 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802ca7:	55                   	push   %rbp
+  802ca8:	48 89 e5             	mov    %rsp,%rbp
+  802cab:	48 83 ec 30          	sub    $0x30,%rsp
+  802caf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802cb2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802cb6:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802cbd:	01 00 00 
+  802cc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cc4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cc8:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ccd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802cd1:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  802cd8:	00 00 00 
+  802cdb:	ff d0                	call   *%rax
+  802cdd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802ce0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ce4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ce8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802cec:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802cf3:	01 00 00 
+  802cf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cfa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cfe:	25 00 04 00 00       	and    $0x400,%eax
+  802d03:	48 85 c0             	test   %rax,%rax
+  802d06:	74 7b                	je     802d83 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802d08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d0c:	89 c1                	mov    %eax,%ecx
+  802d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d12:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d16:	48 89 c2             	mov    %rax,%rdx
+  802d19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d1d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d21:	48 89 c6             	mov    %rax,%rsi
+  802d24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d27:	41 89 c8             	mov    %ecx,%r8d
+  802d2a:	48 89 d1             	mov    %rdx,%rcx
+  802d2d:	89 c2                	mov    %eax,%edx
+  802d2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d34:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802d3b:	00 00 00 
+  802d3e:	ff d0                	call   *%rax
+  802d40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d47:	0f 89 da 00 00 00    	jns    802e27 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802d4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d50:	89 c1                	mov    %eax,%ecx
+  802d52:	48 b8 d0 6c 80 00 00 	movabs $0x806cd0,%rax
+  802d59:	00 00 00 
+  802d5c:	48 89 c2             	mov    %rax,%rdx
+  802d5f:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802d64:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802d6b:	00 00 00 
+  802d6e:	48 89 c7             	mov    %rax,%rdi
+  802d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d76:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  802d7d:	00 00 00 
+  802d80:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802d83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d87:	25 02 08 00 00       	and    $0x802,%eax
+  802d8c:	48 85 c0             	test   %rax,%rax
+  802d8f:	74 6e                	je     802dff <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802d91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d95:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802d9b:	80 cc 08             	or     $0x8,%ah
+  802d9e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802da2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da6:	89 c7                	mov    %eax,%edi
+  802da8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802dac:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802daf:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802db3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802db6:	41 89 f8             	mov    %edi,%r8d
+  802db9:	89 c7                	mov    %eax,%edi
+  802dbb:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802dc2:	00 00 00 
+  802dc5:	ff d0                	call   *%rax
+  802dc7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802dca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dce:	79 05                	jns    802dd5 <duppage+0x12e>
+      return r;
+  802dd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dd3:	eb 55                	jmp    802e2a <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802dd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dd9:	89 c7                	mov    %eax,%edi
+  802ddb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ddf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802de2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802de6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802de9:	41 89 f8             	mov    %edi,%r8d
+  802dec:	89 c7                	mov    %eax,%edi
+  802dee:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802df5:	00 00 00 
+  802df8:	ff d0                	call   *%rax
+  802dfa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dfd:	eb 28                	jmp    802e27 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802dff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e03:	89 c7                	mov    %eax,%edi
+  802e05:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e09:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e0c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e13:	41 89 f8             	mov    %edi,%r8d
+  802e16:	89 c7                	mov    %eax,%edi
+  802e18:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802e1f:	00 00 00 
+  802e22:	ff d0                	call   *%rax
+  802e24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802e27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e2a:	c9                   	leave
+  802e2b:	c3                   	ret
+
+0000000000802e2c <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802e2c:	55                   	push   %rbp
+  802e2d:	48 89 e5             	mov    %rsp,%rbp
+  802e30:	48 83 ec 20          	sub    $0x20,%rsp
+  802e34:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e37:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802e3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e3f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e43:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802e47:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e4e:	01 00 00 
+  802e51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e59:	25 00 08 00 00       	and    $0x800,%eax
+  802e5e:	48 85 c0             	test   %rax,%rax
+  802e61:	74 0d                	je     802e70 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802e63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e67:	0f b6 10             	movzbl (%rax),%edx
+  802e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e6e:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802e70:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e77:	01 00 00 
+  802e7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e7e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e82:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e87:	89 c6                	mov    %eax,%esi
+  802e89:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802e8d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e94:	41 89 f0             	mov    %esi,%r8d
+  802e97:	48 89 c6             	mov    %rax,%rsi
+  802e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e9f:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  802ea6:	00 00 00 
+  802ea9:	ff d0                	call   *%rax
+}
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+0000000000802ead <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802ead:	55                   	push   %rbp
+  802eae:	48 89 e5             	mov    %rsp,%rbp
+  802eb1:	48 83 ec 40          	sub    $0x40,%rsp
+  802eb5:	89 f8                	mov    %edi,%eax
+  802eb7:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802eba:	48 b8 52 2a 80 00 00 	movabs $0x802a52,%rax
+  802ec1:	00 00 00 
+  802ec4:	48 89 c7             	mov    %rax,%rdi
+  802ec7:	48 b8 bc 5b 80 00 00 	movabs $0x805bbc,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802ed3:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ed8:	cd 30                	int    $0x30
+  802eda:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802edd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802ee0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ee3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ee7:	79 36                	jns    802f1f <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802ee9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eec:	89 c1                	mov    %eax,%ecx
+  802eee:	48 b8 fb 6c 80 00 00 	movabs $0x806cfb,%rax
+  802ef5:	00 00 00 
+  802ef8:	48 89 c2             	mov    %rax,%rdx
+  802efb:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802f00:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  802f07:	00 00 00 
+  802f0a:	48 89 c7             	mov    %rax,%rdi
+  802f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f12:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  802f19:	00 00 00 
+  802f1c:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802f1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f23:	75 0a                	jne    802f2f <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2a:	e9 d3 02 00 00       	jmp    803202 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802f2f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f36:	00 
+  802f37:	e9 7a 01 00 00       	jmp    8030b6 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802f3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f40:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f44:	48 c1 e8 27          	shr    $0x27,%rax
+  802f48:	48 89 c2             	mov    %rax,%rdx
+  802f4b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f52:	01 00 00 
+  802f55:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f59:	83 e0 01             	and    $0x1,%eax
+  802f5c:	48 85 c0             	test   %rax,%rax
+  802f5f:	0f 84 4c 01 00 00    	je     8030b1 <fork_common+0x204>
+  802f65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f69:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f6d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f71:	48 89 c2             	mov    %rax,%rdx
+  802f74:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f7b:	01 00 00 
+  802f7e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f82:	83 e0 01             	and    $0x1,%eax
+  802f85:	48 85 c0             	test   %rax,%rax
+  802f88:	0f 84 23 01 00 00    	je     8030b1 <fork_common+0x204>
+  802f8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f92:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f96:	48 c1 e8 15          	shr    $0x15,%rax
+  802f9a:	48 89 c2             	mov    %rax,%rdx
+  802f9d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802fa4:	01 00 00 
+  802fa7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fab:	83 e0 01             	and    $0x1,%eax
+  802fae:	48 85 c0             	test   %rax,%rax
+  802fb1:	0f 84 fa 00 00 00    	je     8030b1 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802fb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fbb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fbf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802fc3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fc7:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802fce:	00 00 00 
+  802fd1:	48 39 c2             	cmp    %rax,%rdx
+  802fd4:	0f 82 d7 00 00 00    	jb     8030b1 <fork_common+0x204>
+  802fda:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802fe1:	00 00 00 
+  802fe4:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802fe8:	0f 84 c3 00 00 00    	je     8030b1 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802fee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ff2:	48 89 c7             	mov    %rax,%rdi
+  802ff5:	48 b8 c6 56 80 00 00 	movabs $0x8056c6,%rax
+  802ffc:	00 00 00 
+  802fff:	ff d0                	call   *%rax
+  803001:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803004:	84 c0                	test   %al,%al
+  803006:	0f 84 a5 00 00 00    	je     8030b1 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  80300c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803010:	48 c1 e8 0c          	shr    $0xc,%rax
+  803014:	48 89 c2             	mov    %rax,%rdx
+  803017:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80301e:	01 00 00 
+  803021:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803025:	83 e0 01             	and    $0x1,%eax
+  803028:	48 85 c0             	test   %rax,%rax
+  80302b:	0f 84 80 00 00 00    	je     8030b1 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  803031:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803035:	74 4a                	je     803081 <fork_common+0x1d4>
+  803037:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80303b:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803042:	00 00 00 
+  803045:	48 39 c2             	cmp    %rax,%rdx
+  803048:	73 13                	jae    80305d <fork_common+0x1b0>
+  80304a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80304e:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803055:	00 00 00 
+  803058:	48 39 c2             	cmp    %rax,%rdx
+  80305b:	73 24                	jae    803081 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  80305d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803061:	48 c1 e8 0c          	shr    $0xc,%rax
+  803065:	48 89 c2             	mov    %rax,%rdx
+  803068:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80306b:	48 89 d6             	mov    %rdx,%rsi
+  80306e:	89 c7                	mov    %eax,%edi
+  803070:	48 b8 2c 2e 80 00 00 	movabs $0x802e2c,%rax
+  803077:	00 00 00 
+  80307a:	ff d0                	call   *%rax
+  80307c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80307f:	eb 22                	jmp    8030a3 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  803081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803085:	48 c1 e8 0c          	shr    $0xc,%rax
+  803089:	48 89 c2             	mov    %rax,%rdx
+  80308c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80308f:	48 89 d6             	mov    %rdx,%rsi
+  803092:	89 c7                	mov    %eax,%edi
+  803094:	48 b8 a7 2c 80 00 00 	movabs $0x802ca7,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+  8030a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8030a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030a7:	79 08                	jns    8030b1 <fork_common+0x204>
+            return r;
+  8030a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030ac:	e9 51 01 00 00       	jmp    803202 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8030b1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8030b6:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8030bd:	07 
+  8030be:	0f 86 78 fe ff ff    	jbe    802f3c <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8030c4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030cb:	00 00 00 
+  8030ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8030d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030d6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030dd:	00 00 00 
+  8030e0:	48 98                	cltq
+  8030e2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8030e9:	48 01 d0             	add    %rdx,%rax
+  8030ec:	48 05 00 01 00 00    	add    $0x100,%rax
+  8030f2:	48 8b 10             	mov    (%rax),%rdx
+  8030f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030f8:	48 89 d6             	mov    %rdx,%rsi
+  8030fb:	89 c7                	mov    %eax,%edi
+  8030fd:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  803104:	00 00 00 
+  803107:	ff d0                	call   *%rax
+  803109:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80310c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803110:	79 36                	jns    803148 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803112:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803115:	89 c1                	mov    %eax,%ecx
+  803117:	48 b8 10 6d 80 00 00 	movabs $0x806d10,%rax
+  80311e:	00 00 00 
+  803121:	48 89 c2             	mov    %rax,%rdx
+  803124:	be be 00 00 00       	mov    $0xbe,%esi
+  803129:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  803130:	00 00 00 
+  803133:	48 89 c7             	mov    %rax,%rdi
+  803136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313b:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  803142:	00 00 00 
+  803145:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803148:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80314b:	ba 02 00 00 00       	mov    $0x2,%edx
+  803150:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803157:	00 00 00 
+  80315a:	48 89 ce             	mov    %rcx,%rsi
+  80315d:	89 c7                	mov    %eax,%edi
+  80315f:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  803166:	00 00 00 
+  803169:	ff d0                	call   *%rax
+  80316b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80316e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803172:	79 36                	jns    8031aa <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803174:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803177:	89 c1                	mov    %eax,%ecx
+  803179:	48 b8 40 6d 80 00 00 	movabs $0x806d40,%rax
+  803180:	00 00 00 
+  803183:	48 89 c2             	mov    %rax,%rdx
+  803186:	be c1 00 00 00       	mov    $0xc1,%esi
+  80318b:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  803192:	00 00 00 
+  803195:	48 89 c7             	mov    %rax,%rdi
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319d:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  8031a4:	00 00 00 
+  8031a7:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8031aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031ad:	be 02 00 00 00       	mov    $0x2,%esi
+  8031b2:	89 c7                	mov    %eax,%edi
+  8031b4:	48 b8 6f 24 80 00 00 	movabs $0x80246f,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+  8031c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031c7:	79 36                	jns    8031ff <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  8031c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031cc:	89 c1                	mov    %eax,%ecx
+  8031ce:	48 b8 60 6d 80 00 00 	movabs $0x806d60,%rax
+  8031d5:	00 00 00 
+  8031d8:	48 89 c2             	mov    %rax,%rdx
+  8031db:	be d4 00 00 00       	mov    $0xd4,%esi
+  8031e0:	48 b8 46 6c 80 00 00 	movabs $0x806c46,%rax
+  8031e7:	00 00 00 
+  8031ea:	48 89 c7             	mov    %rax,%rdi
+  8031ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f2:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  8031f9:	00 00 00 
+  8031fc:	41 ff d0             	call   *%r8
+    }
+    return e;
+  8031ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+
+0000000000803204 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803208:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320d:	48 b8 ad 2e 80 00 00 	movabs $0x802ead,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+}
+  803219:	5d                   	pop    %rbp
+  80321a:	c3                   	ret
+
+000000000080321b <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  80321b:	55                   	push   %rbp
+  80321c:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  80321f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803224:	48 b8 ad 2e 80 00 00 	movabs $0x802ead,%rax
+  80322b:	00 00 00 
+  80322e:	ff d0                	call   *%rax
+}
+  803230:	5d                   	pop    %rbp
+  803231:	c3                   	ret
+
+0000000000803232 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	48 83 ec 08          	sub    $0x8,%rsp
+  80323a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80323e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803242:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803249:	ff ff ff 
+  80324c:	48 01 d0             	add    %rdx,%rax
+  80324f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803253:	c9                   	leave
+  803254:	c3                   	ret
+
+0000000000803255 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803255:	55                   	push   %rbp
+  803256:	48 89 e5             	mov    %rsp,%rbp
+  803259:	48 83 ec 08          	sub    $0x8,%rsp
+  80325d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803261:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803265:	48 89 c7             	mov    %rax,%rdi
+  803268:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  80326f:	00 00 00 
+  803272:	ff d0                	call   *%rax
+  803274:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80327a:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80327e:	c9                   	leave
+  80327f:	c3                   	ret
+
+0000000000803280 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803280:	55                   	push   %rbp
+  803281:	48 89 e5             	mov    %rsp,%rbp
+  803284:	48 83 ec 18          	sub    $0x18,%rsp
+  803288:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80328c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803293:	e9 ae 00 00 00       	jmp    803346 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803298:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80329b:	c1 e0 0c             	shl    $0xc,%eax
+  80329e:	48 98                	cltq
+  8032a0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8032a5:	48 01 d0             	add    %rdx,%rax
+  8032a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8032ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b0:	48 c1 e8 27          	shr    $0x27,%rax
+  8032b4:	48 89 c2             	mov    %rax,%rdx
+  8032b7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8032be:	01 00 00 
+  8032c1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032c5:	83 e0 01             	and    $0x1,%eax
+  8032c8:	48 85 c0             	test   %rax,%rax
+  8032cb:	74 63                	je     803330 <fd_alloc+0xb0>
+  8032cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032d1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032d5:	48 89 c2             	mov    %rax,%rdx
+  8032d8:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8032df:	01 00 00 
+  8032e2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032e6:	83 e0 01             	and    $0x1,%eax
+  8032e9:	48 85 c0             	test   %rax,%rax
+  8032ec:	74 42                	je     803330 <fd_alloc+0xb0>
+  8032ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032f2:	48 c1 e8 15          	shr    $0x15,%rax
+  8032f6:	48 89 c2             	mov    %rax,%rdx
+  8032f9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803300:	01 00 00 
+  803303:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803307:	83 e0 01             	and    $0x1,%eax
+  80330a:	48 85 c0             	test   %rax,%rax
+  80330d:	74 21                	je     803330 <fd_alloc+0xb0>
+  80330f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803313:	48 c1 e8 0c          	shr    $0xc,%rax
+  803317:	48 89 c2             	mov    %rax,%rdx
+  80331a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803321:	01 00 00 
+  803324:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803328:	83 e0 01             	and    $0x1,%eax
+  80332b:	48 85 c0             	test   %rax,%rax
+  80332e:	75 12                	jne    803342 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803334:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803338:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80333b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803340:	eb 1e                	jmp    803360 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803342:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803346:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80334a:	0f 8e 48 ff ff ff    	jle    803298 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803354:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80335b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+0000000000803362 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803362:	55                   	push   %rbp
+  803363:	48 89 e5             	mov    %rsp,%rbp
+  803366:	48 83 ec 20          	sub    $0x20,%rsp
+  80336a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80336d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803371:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803375:	78 06                	js     80337d <fd_lookup+0x1b>
+  803377:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80337b:	7e 0a                	jle    803387 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80337d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803382:	e9 af 00 00 00       	jmp    803436 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803387:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80338a:	c1 e0 0c             	shl    $0xc,%eax
+  80338d:	48 98                	cltq
+  80338f:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803394:	48 01 d0             	add    %rdx,%rax
+  803397:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80339b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80339f:	48 c1 e8 27          	shr    $0x27,%rax
+  8033a3:	48 89 c2             	mov    %rax,%rdx
+  8033a6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033ad:	01 00 00 
+  8033b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033b4:	83 e0 01             	and    $0x1,%eax
+  8033b7:	48 85 c0             	test   %rax,%rax
+  8033ba:	74 63                	je     80341f <fd_lookup+0xbd>
+  8033bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033c0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033c4:	48 89 c2             	mov    %rax,%rdx
+  8033c7:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033ce:	01 00 00 
+  8033d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033d5:	83 e0 01             	and    $0x1,%eax
+  8033d8:	48 85 c0             	test   %rax,%rax
+  8033db:	74 42                	je     80341f <fd_lookup+0xbd>
+  8033dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e1:	48 c1 e8 15          	shr    $0x15,%rax
+  8033e5:	48 89 c2             	mov    %rax,%rdx
+  8033e8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8033ef:	01 00 00 
+  8033f2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f6:	83 e0 01             	and    $0x1,%eax
+  8033f9:	48 85 c0             	test   %rax,%rax
+  8033fc:	74 21                	je     80341f <fd_lookup+0xbd>
+  8033fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803402:	48 c1 e8 0c          	shr    $0xc,%rax
+  803406:	48 89 c2             	mov    %rax,%rdx
+  803409:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803410:	01 00 00 
+  803413:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803417:	83 e0 01             	and    $0x1,%eax
+  80341a:	48 85 c0             	test   %rax,%rax
+  80341d:	75 07                	jne    803426 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80341f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803424:	eb 10                	jmp    803436 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803426:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80342a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80342e:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803431:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803436:	c9                   	leave
+  803437:	c3                   	ret
+
+0000000000803438 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803438:	55                   	push   %rbp
+  803439:	48 89 e5             	mov    %rsp,%rbp
+  80343c:	48 83 ec 30          	sub    $0x30,%rsp
+  803440:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803444:	89 f0                	mov    %esi,%eax
+  803446:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803449:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80344d:	48 89 c7             	mov    %rax,%rdi
+  803450:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  803457:	00 00 00 
+  80345a:	ff d0                	call   *%rax
+  80345c:	89 c2                	mov    %eax,%edx
+  80345e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803462:	48 89 c6             	mov    %rax,%rsi
+  803465:	89 d7                	mov    %edx,%edi
+  803467:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  80346e:	00 00 00 
+  803471:	ff d0                	call   *%rax
+  803473:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803476:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80347a:	78 0a                	js     803486 <fd_close+0x4e>
+  80347c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803480:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803484:	74 12                	je     803498 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803486:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80348a:	74 05                	je     803491 <fd_close+0x59>
+  80348c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80348f:	eb 70                	jmp    803501 <fd_close+0xc9>
+  803491:	b8 00 00 00 00       	mov    $0x0,%eax
+  803496:	eb 69                	jmp    803501 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803498:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80349c:	8b 00                	mov    (%rax),%eax
+  80349e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8034a2:	48 89 d6             	mov    %rdx,%rsi
+  8034a5:	89 c7                	mov    %eax,%edi
+  8034a7:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  8034ae:	00 00 00 
+  8034b1:	ff d0                	call   *%rax
+  8034b3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034ba:	78 2a                	js     8034e6 <fd_close+0xae>
+    if (dev->dev_close)
+  8034bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034c0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034c4:	48 85 c0             	test   %rax,%rax
+  8034c7:	74 16                	je     8034df <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8034c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034cd:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034d5:	48 89 c7             	mov    %rax,%rdi
+  8034d8:	ff d2                	call   *%rdx
+  8034da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034dd:	eb 07                	jmp    8034e6 <fd_close+0xae>
+    else
+      r = 0;
+  8034df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8034e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034ea:	48 89 c6             	mov    %rax,%rsi
+  8034ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f2:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8034f9:	00 00 00 
+  8034fc:	ff d0                	call   *%rax
+  return r;
+  8034fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+
+0000000000803503 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803503:	55                   	push   %rbp
+  803504:	48 89 e5             	mov    %rsp,%rbp
+  803507:	48 83 ec 20          	sub    $0x20,%rsp
+  80350b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80350e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803512:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803519:	eb 3f                	jmp    80355a <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80351b:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803522:	00 00 00 
+  803525:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803528:	48 98                	cltq
+  80352a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80352e:	8b 00                	mov    (%rax),%eax
+  803530:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803533:	75 21                	jne    803556 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803535:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80353c:	00 00 00 
+  80353f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803542:	48 98                	cltq
+  803544:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803548:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80354c:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80354f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803554:	eb 7f                	jmp    8035d5 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803556:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80355a:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803561:	00 00 00 
+  803564:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803567:	48 98                	cltq
+  803569:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80356d:	48 85 c0             	test   %rax,%rax
+  803570:	75 a9                	jne    80351b <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803572:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803579:	00 00 00 
+  80357c:	8b 40 04             	mov    0x4(%rax),%eax
+  80357f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803584:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80358b:	00 00 00 
+  80358e:	48 98                	cltq
+  803590:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803597:	48 01 d0             	add    %rdx,%rax
+  80359a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035a0:	8b 00                	mov    (%rax),%eax
+  8035a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8035a5:	89 c6                	mov    %eax,%esi
+  8035a7:	48 b8 88 6d 80 00 00 	movabs $0x806d88,%rax
+  8035ae:	00 00 00 
+  8035b1:	48 89 c7             	mov    %rax,%rdi
+  8035b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b9:	48 b9 ed 05 80 00 00 	movabs $0x8005ed,%rcx
+  8035c0:	00 00 00 
+  8035c3:	ff d1                	call   *%rcx
+  *dev = 0;
+  8035c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035c9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8035d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8035d5:	c9                   	leave
+  8035d6:	c3                   	ret
+
+00000000008035d7 <close>:
+
+int
+close(int fdnum) {
+  8035d7:	55                   	push   %rbp
+  8035d8:	48 89 e5             	mov    %rsp,%rbp
+  8035db:	48 83 ec 20          	sub    $0x20,%rsp
+  8035df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035e2:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8035e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035e9:	48 89 d6             	mov    %rdx,%rsi
+  8035ec:	89 c7                	mov    %eax,%edi
+  8035ee:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+  8035fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803601:	79 05                	jns    803608 <close+0x31>
+    return r;
+  803603:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803606:	eb 18                	jmp    803620 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803608:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80360c:	be 01 00 00 00       	mov    $0x1,%esi
+  803611:	48 89 c7             	mov    %rax,%rdi
+  803614:	48 b8 38 34 80 00 00 	movabs $0x803438,%rax
+  80361b:	00 00 00 
+  80361e:	ff d0                	call   *%rax
+}
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+0000000000803622 <close_all>:
+
+void
+close_all(void) {
+  803622:	55                   	push   %rbp
+  803623:	48 89 e5             	mov    %rsp,%rbp
+  803626:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80362a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803631:	eb 15                	jmp    803648 <close_all+0x26>
+    close(i);
+  803633:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803636:	89 c7                	mov    %eax,%edi
+  803638:	48 b8 d7 35 80 00 00 	movabs $0x8035d7,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803644:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803648:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80364c:	7e e5                	jle    803633 <close_all+0x11>
+}
+  80364e:	90                   	nop
+  80364f:	90                   	nop
+  803650:	c9                   	leave
+  803651:	c3                   	ret
+
+0000000000803652 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803652:	55                   	push   %rbp
+  803653:	48 89 e5             	mov    %rsp,%rbp
+  803656:	48 83 ec 40          	sub    $0x40,%rsp
+  80365a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80365d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803660:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803664:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803667:	48 89 d6             	mov    %rdx,%rsi
+  80366a:	89 c7                	mov    %eax,%edi
+  80366c:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+  803678:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80367b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80367f:	79 08                	jns    803689 <dup+0x37>
+    return r;
+  803681:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803684:	e9 33 02 00 00       	jmp    8038bc <dup+0x26a>
+  close(newfdnum);
+  803689:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80368c:	89 c7                	mov    %eax,%edi
+  80368e:	48 b8 d7 35 80 00 00 	movabs $0x8035d7,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  80369a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80369d:	c1 e0 0c             	shl    $0xc,%eax
+  8036a0:	48 98                	cltq
+  8036a2:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8036a7:	48 01 d0             	add    %rdx,%rax
+  8036aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8036ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036b2:	48 89 c7             	mov    %rax,%rdi
+  8036b5:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+  8036c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8036c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036c9:	48 89 c7             	mov    %rax,%rdi
+  8036cc:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+  8036d8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8036dc:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8036e3:	00 
+  8036e4:	e9 19 01 00 00       	jmp    803802 <dup+0x1b0>
+    off -= PGSIZE;
+  8036e9:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8036f0:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8036f1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036f9:	48 01 d0             	add    %rdx,%rax
+  8036fc:	48 c1 e8 27          	shr    $0x27,%rax
+  803700:	48 89 c2             	mov    %rax,%rdx
+  803703:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80370a:	01 00 00 
+  80370d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803711:	83 e0 01             	and    $0x1,%eax
+  803714:	48 85 c0             	test   %rax,%rax
+  803717:	0f 84 e5 00 00 00    	je     803802 <dup+0x1b0>
+  80371d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803721:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803725:	48 01 d0             	add    %rdx,%rax
+  803728:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80372c:	48 89 c2             	mov    %rax,%rdx
+  80372f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803736:	01 00 00 
+  803739:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80373d:	83 e0 01             	and    $0x1,%eax
+  803740:	48 85 c0             	test   %rax,%rax
+  803743:	0f 84 b9 00 00 00    	je     803802 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803749:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80374d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803751:	48 01 d0             	add    %rdx,%rax
+  803754:	48 c1 e8 15          	shr    $0x15,%rax
+  803758:	48 89 c2             	mov    %rax,%rdx
+  80375b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803762:	01 00 00 
+  803765:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803769:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80376c:	48 85 c0             	test   %rax,%rax
+  80376f:	0f 84 8d 00 00 00    	je     803802 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803775:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80377d:	48 01 d0             	add    %rdx,%rax
+  803780:	48 c1 e8 0c          	shr    $0xc,%rax
+  803784:	48 89 c2             	mov    %rax,%rdx
+  803787:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80378e:	01 00 00 
+  803791:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803795:	83 e0 01             	and    $0x1,%eax
+  803798:	48 85 c0             	test   %rax,%rax
+  80379b:	74 65                	je     803802 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80379d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037a5:	48 01 d0             	add    %rdx,%rax
+  8037a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037ac:	48 89 c2             	mov    %rax,%rdx
+  8037af:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037b6:	01 00 00 
+  8037b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037c2:	89 c6                	mov    %eax,%esi
+  8037c4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8037c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037cc:	48 01 c2             	add    %rax,%rdx
+  8037cf:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8037d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037d7:	48 01 c8             	add    %rcx,%rax
+  8037da:	41 89 f0             	mov    %esi,%r8d
+  8037dd:	48 89 d1             	mov    %rdx,%rcx
+  8037e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e5:	48 89 c6             	mov    %rax,%rsi
+  8037e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ed:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  8037f4:	00 00 00 
+  8037f7:	ff d0                	call   *%rax
+  8037f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803800:	78 60                	js     803862 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803802:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803807:	0f 85 dc fe ff ff    	jne    8036e9 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80380d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803811:	48 c1 e8 0c          	shr    $0xc,%rax
+  803815:	48 89 c2             	mov    %rax,%rdx
+  803818:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80381f:	01 00 00 
+  803822:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803826:	25 07 0e 00 00       	and    $0xe07,%eax
+  80382b:	89 c1                	mov    %eax,%ecx
+  80382d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803831:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803835:	41 89 c8             	mov    %ecx,%r8d
+  803838:	48 89 d1             	mov    %rdx,%rcx
+  80383b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803840:	48 89 c6             	mov    %rax,%rsi
+  803843:	bf 00 00 00 00       	mov    $0x0,%edi
+  803848:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  80384f:	00 00 00 
+  803852:	ff d0                	call   *%rax
+  803854:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803857:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80385b:	78 08                	js     803865 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80385d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803860:	eb 5a                	jmp    8038bc <dup+0x26a>
+        goto err;
+  803862:	90                   	nop
+  803863:	eb 01                	jmp    803866 <dup+0x214>
+    goto err;
+  803865:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803866:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80386a:	48 89 c6             	mov    %rax,%rsi
+  80386d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803872:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  803879:	00 00 00 
+  80387c:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80387e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803885:	00 
+  803886:	eb 27                	jmp    8038af <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803888:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80388c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803890:	48 01 d0             	add    %rdx,%rax
+  803893:	48 89 c6             	mov    %rax,%rsi
+  803896:	bf 00 00 00 00       	mov    $0x0,%edi
+  80389b:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8038a2:	00 00 00 
+  8038a5:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8038a7:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8038ae:	00 
+  8038af:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8038b6:	00 
+  8038b7:	76 cf                	jbe    803888 <dup+0x236>
+  return r;
+  8038b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8038bc:	c9                   	leave
+  8038bd:	c3                   	ret
+
+00000000008038be <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8038be:	55                   	push   %rbp
+  8038bf:	48 89 e5             	mov    %rsp,%rbp
+  8038c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8038c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8038cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038d1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8038d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038d8:	48 89 d6             	mov    %rdx,%rsi
+  8038db:	89 c7                	mov    %eax,%edi
+  8038dd:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8038e4:	00 00 00 
+  8038e7:	ff d0                	call   *%rax
+  8038e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038f0:	78 24                	js     803916 <read+0x58>
+  8038f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038f6:	8b 00                	mov    (%rax),%eax
+  8038f8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038fc:	48 89 d6             	mov    %rdx,%rsi
+  8038ff:	89 c7                	mov    %eax,%edi
+  803901:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  803908:	00 00 00 
+  80390b:	ff d0                	call   *%rax
+  80390d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803910:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803914:	79 0a                	jns    803920 <read+0x62>
+    return r;
+  803916:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803919:	48 98                	cltq
+  80391b:	e9 9e 00 00 00       	jmp    8039be <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803920:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803924:	8b 40 08             	mov    0x8(%rax),%eax
+  803927:	83 e0 03             	and    $0x3,%eax
+  80392a:	83 f8 01             	cmp    $0x1,%eax
+  80392d:	75 5c                	jne    80398b <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80392f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803936:	00 00 00 
+  803939:	8b 40 04             	mov    0x4(%rax),%eax
+  80393c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803941:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803948:	00 00 00 
+  80394b:	48 98                	cltq
+  80394d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803954:	48 01 d0             	add    %rdx,%rax
+  803957:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80395d:	8b 00                	mov    (%rax),%eax
+  80395f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803962:	89 c6                	mov    %eax,%esi
+  803964:	48 b8 a7 6d 80 00 00 	movabs $0x806da7,%rax
+  80396b:	00 00 00 
+  80396e:	48 89 c7             	mov    %rax,%rdi
+  803971:	b8 00 00 00 00       	mov    $0x0,%eax
+  803976:	48 b9 ed 05 80 00 00 	movabs $0x8005ed,%rcx
+  80397d:	00 00 00 
+  803980:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803982:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803989:	eb 33                	jmp    8039be <read+0x100>
+  }
+  if (!dev->dev_read)
+  80398b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80398f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803993:	48 85 c0             	test   %rax,%rax
+  803996:	75 09                	jne    8039a1 <read+0xe3>
+    return -E_NOT_SUPP;
+  803998:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80399f:	eb 1d                	jmp    8039be <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8039a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039a5:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8039a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ad:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8039b1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8039b5:	48 89 ce             	mov    %rcx,%rsi
+  8039b8:	48 89 c7             	mov    %rax,%rdi
+  8039bb:	41 ff d0             	call   *%r8
+}
+  8039be:	c9                   	leave
+  8039bf:	c3                   	ret
+
+00000000008039c0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	48 83 ec 30          	sub    $0x30,%rsp
+  8039c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8039cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8039cf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8039d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8039da:	eb 49                	jmp    803a25 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8039dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039df:	48 98                	cltq
+  8039e1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8039e5:	48 29 c2             	sub    %rax,%rdx
+  8039e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039eb:	48 63 c8             	movslq %eax,%rcx
+  8039ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f2:	48 01 c1             	add    %rax,%rcx
+  8039f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039f8:	48 89 ce             	mov    %rcx,%rsi
+  8039fb:	89 c7                	mov    %eax,%edi
+  8039fd:	48 b8 be 38 80 00 00 	movabs $0x8038be,%rax
+  803a04:	00 00 00 
+  803a07:	ff d0                	call   *%rax
+  803a09:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803a0c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a10:	79 07                	jns    803a19 <readn+0x59>
+      return m;
+  803a12:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a15:	48 98                	cltq
+  803a17:	eb 1f                	jmp    803a38 <readn+0x78>
+    if (m == 0)
+  803a19:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a1d:	74 13                	je     803a32 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803a1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a22:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803a25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a28:	48 98                	cltq
+  803a2a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803a2e:	72 ac                	jb     8039dc <readn+0x1c>
+  803a30:	eb 01                	jmp    803a33 <readn+0x73>
+      break;
+  803a32:	90                   	nop
+  }
+  return tot;
+  803a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a36:	48 98                	cltq
+}
+  803a38:	c9                   	leave
+  803a39:	c3                   	ret
+
+0000000000803a3a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a3a:	55                   	push   %rbp
+  803a3b:	48 89 e5             	mov    %rsp,%rbp
+  803a3e:	48 83 ec 40          	sub    $0x40,%rsp
+  803a42:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a45:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803a49:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a4d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a54:	48 89 d6             	mov    %rdx,%rsi
+  803a57:	89 c7                	mov    %eax,%edi
+  803a59:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803a60:	00 00 00 
+  803a63:	ff d0                	call   *%rax
+  803a65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a6c:	78 24                	js     803a92 <write+0x58>
+  803a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a72:	8b 00                	mov    (%rax),%eax
+  803a74:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a78:	48 89 d6             	mov    %rdx,%rsi
+  803a7b:	89 c7                	mov    %eax,%edi
+  803a7d:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+  803a89:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a90:	79 0a                	jns    803a9c <write+0x62>
+    return r;
+  803a92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a95:	48 98                	cltq
+  803a97:	e9 9d 00 00 00       	jmp    803b39 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aa0:	8b 40 08             	mov    0x8(%rax),%eax
+  803aa3:	83 e0 03             	and    $0x3,%eax
+  803aa6:	85 c0                	test   %eax,%eax
+  803aa8:	75 5c                	jne    803b06 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803aaa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ab1:	00 00 00 
+  803ab4:	8b 40 04             	mov    0x4(%rax),%eax
+  803ab7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803abc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803ac3:	00 00 00 
+  803ac6:	48 98                	cltq
+  803ac8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803acf:	48 01 d0             	add    %rdx,%rax
+  803ad2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803ad8:	8b 00                	mov    (%rax),%eax
+  803ada:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803add:	89 c6                	mov    %eax,%esi
+  803adf:	48 b8 c3 6d 80 00 00 	movabs $0x806dc3,%rax
+  803ae6:	00 00 00 
+  803ae9:	48 89 c7             	mov    %rax,%rdi
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af1:	48 b9 ed 05 80 00 00 	movabs $0x8005ed,%rcx
+  803af8:	00 00 00 
+  803afb:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803afd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b04:	eb 33                	jmp    803b39 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803b06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b0a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b0e:	48 85 c0             	test   %rax,%rax
+  803b11:	75 09                	jne    803b1c <write+0xe2>
+    return -E_NOT_SUPP;
+  803b13:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803b1a:	eb 1d                	jmp    803b39 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803b1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b20:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b28:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b2c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803b30:	48 89 ce             	mov    %rcx,%rsi
+  803b33:	48 89 c7             	mov    %rax,%rdi
+  803b36:	41 ff d0             	call   *%r8
+}
+  803b39:	c9                   	leave
+  803b3a:	c3                   	ret
+
+0000000000803b3b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803b3b:	55                   	push   %rbp
+  803b3c:	48 89 e5             	mov    %rsp,%rbp
+  803b3f:	48 83 ec 18          	sub    $0x18,%rsp
+  803b43:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b46:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b49:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b50:	48 89 d6             	mov    %rdx,%rsi
+  803b53:	89 c7                	mov    %eax,%edi
+  803b55:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803b5c:	00 00 00 
+  803b5f:	ff d0                	call   *%rax
+  803b61:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b64:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b68:	79 05                	jns    803b6f <seek+0x34>
+    return r;
+  803b6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b6d:	eb 0f                	jmp    803b7e <seek+0x43>
+  fd->fd_offset = offset;
+  803b6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b73:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b76:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803b79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b7e:	c9                   	leave
+  803b7f:	c3                   	ret
+
+0000000000803b80 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b80:	55                   	push   %rbp
+  803b81:	48 89 e5             	mov    %rsp,%rbp
+  803b84:	48 83 ec 30          	sub    $0x30,%rsp
+  803b88:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b8b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b8e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b95:	48 89 d6             	mov    %rdx,%rsi
+  803b98:	89 c7                	mov    %eax,%edi
+  803b9a:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803ba1:	00 00 00 
+  803ba4:	ff d0                	call   *%rax
+  803ba6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ba9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bad:	78 24                	js     803bd3 <ftruncate+0x53>
+  803baf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bb3:	8b 00                	mov    (%rax),%eax
+  803bb5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bb9:	48 89 d6             	mov    %rdx,%rsi
+  803bbc:	89 c7                	mov    %eax,%edi
+  803bbe:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  803bc5:	00 00 00 
+  803bc8:	ff d0                	call   *%rax
+  803bca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bcd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bd1:	79 08                	jns    803bdb <ftruncate+0x5b>
+    return r;
+  803bd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bd6:	e9 92 00 00 00       	jmp    803c6d <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803bdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bdf:	8b 40 08             	mov    0x8(%rax),%eax
+  803be2:	83 e0 03             	and    $0x3,%eax
+  803be5:	85 c0                	test   %eax,%eax
+  803be7:	75 5a                	jne    803c43 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803be9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803bf0:	00 00 00 
+  803bf3:	8b 40 04             	mov    0x4(%rax),%eax
+  803bf6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803bfb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c02:	00 00 00 
+  803c05:	48 98                	cltq
+  803c07:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803c0e:	48 01 d0             	add    %rdx,%rax
+  803c11:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c17:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c19:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c1c:	89 c6                	mov    %eax,%esi
+  803c1e:	48 b8 e0 6d 80 00 00 	movabs $0x806de0,%rax
+  803c25:	00 00 00 
+  803c28:	48 89 c7             	mov    %rax,%rdi
+  803c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c30:	48 b9 ed 05 80 00 00 	movabs $0x8005ed,%rcx
+  803c37:	00 00 00 
+  803c3a:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c41:	eb 2a                	jmp    803c6d <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803c43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c47:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803c4b:	48 85 c0             	test   %rax,%rax
+  803c4e:	75 07                	jne    803c57 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803c50:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803c55:	eb 16                	jmp    803c6d <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803c57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c5b:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803c5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c63:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803c66:	89 d6                	mov    %edx,%esi
+  803c68:	48 89 c7             	mov    %rax,%rdi
+  803c6b:	ff d1                	call   *%rcx
+}
+  803c6d:	c9                   	leave
+  803c6e:	c3                   	ret
+
+0000000000803c6f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c6f:	55                   	push   %rbp
+  803c70:	48 89 e5             	mov    %rsp,%rbp
+  803c73:	48 83 ec 30          	sub    $0x30,%rsp
+  803c77:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c7a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c7e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c82:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c85:	48 89 d6             	mov    %rdx,%rsi
+  803c88:	89 c7                	mov    %eax,%edi
+  803c8a:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803c91:	00 00 00 
+  803c94:	ff d0                	call   *%rax
+  803c96:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c99:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c9d:	78 24                	js     803cc3 <fstat+0x54>
+  803c9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ca3:	8b 00                	mov    (%rax),%eax
+  803ca5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ca9:	48 89 d6             	mov    %rdx,%rsi
+  803cac:	89 c7                	mov    %eax,%edi
+  803cae:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  803cb5:	00 00 00 
+  803cb8:	ff d0                	call   *%rax
+  803cba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cbd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cc1:	79 05                	jns    803cc8 <fstat+0x59>
+    return r;
+  803cc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cc6:	eb 5e                	jmp    803d26 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ccc:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803cd0:	48 85 c0             	test   %rax,%rax
+  803cd3:	75 07                	jne    803cdc <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803cd5:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803cda:	eb 4a                	jmp    803d26 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803cdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ce0:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803ce3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ce7:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803cee:	00 00 00 
+  stat->st_isdir   = 0;
+  803cf1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cf5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803cfc:	00 00 00 
+  stat->st_dev     = dev;
+  803cff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d07:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803d0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d12:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803d16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d1a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d1e:	48 89 d6             	mov    %rdx,%rsi
+  803d21:	48 89 c7             	mov    %rax,%rdi
+  803d24:	ff d1                	call   *%rcx
+}
+  803d26:	c9                   	leave
+  803d27:	c3                   	ret
+
+0000000000803d28 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803d28:	55                   	push   %rbp
+  803d29:	48 89 e5             	mov    %rsp,%rbp
+  803d2c:	48 83 ec 10          	sub    $0x10,%rsp
+  803d30:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d34:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d3c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d42:	83 f8 20             	cmp    $0x20,%eax
+  803d45:	75 07                	jne    803d4e <pollwait_key+0x26>
+    return -E_INVAL;
+  803d47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d4c:	eb 5f                	jmp    803dad <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803d4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d52:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d5c:	48 63 d2             	movslq %edx,%rdx
+  803d5f:	48 c1 e2 04          	shl    $0x4,%rdx
+  803d63:	48 01 c2             	add    %rax,%rdx
+  803d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d6a:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d71:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803d77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d7b:	8b 00                	mov    (%rax),%eax
+  803d7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d81:	48 63 c9             	movslq %ecx,%rcx
+  803d84:	48 c1 e1 04          	shl    $0x4,%rcx
+  803d88:	48 01 ca             	add    %rcx,%rdx
+  803d8b:	48 83 c2 08          	add    $0x8,%rdx
+  803d8f:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803d91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d95:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d9b:	8d 50 01             	lea    0x1(%rax),%edx
+  803d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803da2:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803da8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dad:	c9                   	leave
+  803dae:	c3                   	ret
+
+0000000000803daf <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803daf:	55                   	push   %rbp
+  803db0:	48 89 e5             	mov    %rsp,%rbp
+  803db3:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803dba:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803dc1:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803dc7:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803dce:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803dd5:	00 
+  int i, r, ready, ipc = 0;
+  803dd6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803ddd:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803de4:	00 
+  803de5:	74 45                	je     803e2c <poll+0x7d>
+  803de7:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803dee:	ff 
+  803def:	74 3b                	je     803e2c <poll+0x7d>
+    now      = vsys_clock_ns();
+  803df1:	48 b8 cb 57 80 00 00 	movabs $0x8057cb,%rax
+  803df8:	00 00 00 
+  803dfb:	ff d0                	call   *%rax
+  803dfd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803e01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e05:	48 f7 d0             	not    %rax
+  803e08:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803e0f:	73 10                	jae    803e21 <poll+0x72>
+  803e11:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e15:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803e1c:	48 01 d0             	add    %rdx,%rax
+  803e1f:	eb 07                	jmp    803e28 <poll+0x79>
+  803e21:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803e28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803e2c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803e33:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803e3a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803e41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803e48:	e9 46 02 00 00       	jmp    804093 <poll+0x2e4>
+      fds[i].revents = 0;
+  803e4d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e50:	48 63 d0             	movslq %eax,%rdx
+  803e53:	48 89 d0             	mov    %rdx,%rax
+  803e56:	48 01 c0             	add    %rax,%rax
+  803e59:	48 01 d0             	add    %rdx,%rax
+  803e5c:	48 c1 e0 02          	shl    $0x2,%rax
+  803e60:	48 89 c2             	mov    %rax,%rdx
+  803e63:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e6a:	48 01 d0             	add    %rdx,%rax
+  803e6d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803e74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e77:	48 63 d0             	movslq %eax,%rdx
+  803e7a:	48 89 d0             	mov    %rdx,%rax
+  803e7d:	48 01 c0             	add    %rax,%rax
+  803e80:	48 01 d0             	add    %rdx,%rax
+  803e83:	48 c1 e0 02          	shl    $0x2,%rax
+  803e87:	48 89 c2             	mov    %rax,%rdx
+  803e8a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e91:	48 01 d0             	add    %rdx,%rax
+  803e94:	8b 00                	mov    (%rax),%eax
+  803e96:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803e99:	75 62                	jne    803efd <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803e9b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e9e:	48 63 d0             	movslq %eax,%rdx
+  803ea1:	48 89 d0             	mov    %rdx,%rax
+  803ea4:	48 01 c0             	add    %rax,%rax
+  803ea7:	48 01 d0             	add    %rdx,%rax
+  803eaa:	48 c1 e0 02          	shl    $0x2,%rax
+  803eae:	48 89 c2             	mov    %rax,%rdx
+  803eb1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eb8:	48 01 d0             	add    %rdx,%rax
+  803ebb:	8b 40 04             	mov    0x4(%rax),%eax
+  803ebe:	83 e0 01             	and    $0x1,%eax
+  803ec1:	85 c0                	test   %eax,%eax
+  803ec3:	0f 84 9b 01 00 00    	je     804064 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803ec9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ecc:	48 63 d0             	movslq %eax,%rdx
+  803ecf:	48 89 d0             	mov    %rdx,%rax
+  803ed2:	48 01 c0             	add    %rax,%rax
+  803ed5:	48 01 d0             	add    %rdx,%rax
+  803ed8:	48 c1 e0 02          	shl    $0x2,%rax
+  803edc:	48 89 c2             	mov    %rax,%rdx
+  803edf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ee6:	48 01 c2             	add    %rax,%rdx
+  803ee9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eec:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803eef:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ef2:	83 c8 04             	or     $0x4,%eax
+  803ef5:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803ef8:	e9 67 01 00 00       	jmp    804064 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803efd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f00:	48 63 d0             	movslq %eax,%rdx
+  803f03:	48 89 d0             	mov    %rdx,%rax
+  803f06:	48 01 c0             	add    %rax,%rax
+  803f09:	48 01 d0             	add    %rdx,%rax
+  803f0c:	48 c1 e0 02          	shl    $0x2,%rax
+  803f10:	48 89 c2             	mov    %rax,%rdx
+  803f13:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f1a:	48 01 d0             	add    %rdx,%rax
+  803f1d:	8b 00                	mov    (%rax),%eax
+  803f1f:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803f26:	48 89 d6             	mov    %rdx,%rsi
+  803f29:	89 c7                	mov    %eax,%edi
+  803f2b:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+  803f37:	85 c0                	test   %eax,%eax
+  803f39:	78 25                	js     803f60 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803f3b:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803f42:	8b 00                	mov    (%rax),%eax
+  803f44:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803f4b:	48 89 d6             	mov    %rdx,%rsi
+  803f4e:	89 c7                	mov    %eax,%edi
+  803f50:	48 b8 03 35 80 00 00 	movabs $0x803503,%rax
+  803f57:	00 00 00 
+  803f5a:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f5c:	85 c0                	test   %eax,%eax
+  803f5e:	79 2c                	jns    803f8c <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803f60:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f63:	48 63 d0             	movslq %eax,%rdx
+  803f66:	48 89 d0             	mov    %rdx,%rax
+  803f69:	48 01 c0             	add    %rax,%rax
+  803f6c:	48 01 d0             	add    %rdx,%rax
+  803f6f:	48 c1 e0 02          	shl    $0x2,%rax
+  803f73:	48 89 c2             	mov    %rax,%rdx
+  803f76:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f7d:	48 01 d0             	add    %rdx,%rax
+  803f80:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803f87:	e9 d8 00 00 00       	jmp    804064 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803f8c:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803f93:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803f97:	48 85 c0             	test   %rax,%rax
+  803f9a:	74 7d                	je     804019 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803f9c:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803fa3:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803fa7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803faa:	48 63 d0             	movslq %eax,%rdx
+  803fad:	48 89 d0             	mov    %rdx,%rax
+  803fb0:	48 01 c0             	add    %rax,%rax
+  803fb3:	48 01 d0             	add    %rdx,%rax
+  803fb6:	48 c1 e0 02          	shl    $0x2,%rax
+  803fba:	48 89 c2             	mov    %rax,%rdx
+  803fbd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fc4:	48 01 d0             	add    %rdx,%rax
+  803fc7:	8b 48 04             	mov    0x4(%rax),%ecx
+  803fca:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803fd1:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803fd8:	89 ce                	mov    %ecx,%esi
+  803fda:	48 89 c7             	mov    %rax,%rdi
+  803fdd:	41 ff d0             	call   *%r8
+  803fe0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803fe3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803fe7:	79 08                	jns    803ff1 <poll+0x242>
+          return r;
+  803fe9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fec:	e9 45 01 00 00       	jmp    804136 <poll+0x387>
+        fds[i].revents = r;
+  803ff1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ff4:	48 63 d0             	movslq %eax,%rdx
+  803ff7:	48 89 d0             	mov    %rdx,%rax
+  803ffa:	48 01 c0             	add    %rax,%rax
+  803ffd:	48 01 d0             	add    %rdx,%rax
+  804000:	48 c1 e0 02          	shl    $0x2,%rax
+  804004:	48 89 c2             	mov    %rax,%rdx
+  804007:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80400e:	48 01 c2             	add    %rax,%rdx
+  804011:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804014:	89 42 08             	mov    %eax,0x8(%rdx)
+  804017:	eb 4b                	jmp    804064 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804019:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80401c:	48 63 d0             	movslq %eax,%rdx
+  80401f:	48 89 d0             	mov    %rdx,%rax
+  804022:	48 01 c0             	add    %rax,%rax
+  804025:	48 01 d0             	add    %rdx,%rax
+  804028:	48 c1 e0 02          	shl    $0x2,%rax
+  80402c:	48 89 c2             	mov    %rax,%rdx
+  80402f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804036:	48 01 d0             	add    %rdx,%rax
+  804039:	8b 48 04             	mov    0x4(%rax),%ecx
+  80403c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80403f:	48 63 d0             	movslq %eax,%rdx
+  804042:	48 89 d0             	mov    %rdx,%rax
+  804045:	48 01 c0             	add    %rax,%rax
+  804048:	48 01 d0             	add    %rdx,%rax
+  80404b:	48 c1 e0 02          	shl    $0x2,%rax
+  80404f:	48 89 c2             	mov    %rax,%rdx
+  804052:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804059:	48 01 d0             	add    %rdx,%rax
+  80405c:	83 e1 03             	and    $0x3,%ecx
+  80405f:	89 ca                	mov    %ecx,%edx
+  804061:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804064:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804067:	48 63 d0             	movslq %eax,%rdx
+  80406a:	48 89 d0             	mov    %rdx,%rax
+  80406d:	48 01 c0             	add    %rax,%rax
+  804070:	48 01 d0             	add    %rdx,%rax
+  804073:	48 c1 e0 02          	shl    $0x2,%rax
+  804077:	48 89 c2             	mov    %rax,%rdx
+  80407a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804081:	48 01 d0             	add    %rdx,%rax
+  804084:	8b 40 08             	mov    0x8(%rax),%eax
+  804087:	85 c0                	test   %eax,%eax
+  804089:	74 04                	je     80408f <poll+0x2e0>
+        ready++;
+  80408b:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80408f:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804093:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804096:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80409c:	0f 8c ab fd ff ff    	jl     803e4d <poll+0x9e>
+    }
+    if (ready)
+  8040a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8040a6:	74 08                	je     8040b0 <poll+0x301>
+      return ready;
+  8040a8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8040ab:	e9 86 00 00 00       	jmp    804136 <poll+0x387>
+
+    if (deadline) {
+  8040b0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8040b5:	74 30                	je     8040e7 <poll+0x338>
+      now     = vsys_clock_ns();
+  8040b7:	48 b8 cb 57 80 00 00 	movabs $0x8057cb,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+  8040c3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8040c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040cb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8040cf:	73 0a                	jae    8040db <poll+0x32c>
+  8040d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040d5:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8040d9:	eb 05                	jmp    8040e0 <poll+0x331>
+  8040db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e0:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8040e7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8040ea:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8040ed:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8040f4:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8040fb:	48 89 c7             	mov    %rax,%rdi
+  8040fe:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  804105:	00 00 00 
+  804108:	ff d0                	call   *%rax
+  80410a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80410d:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804111:	75 07                	jne    80411a <poll+0x36b>
+      return 0;
+  804113:	b8 00 00 00 00       	mov    $0x0,%eax
+  804118:	eb 1c                	jmp    804136 <poll+0x387>
+    if (r < 0)
+  80411a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80411e:	79 05                	jns    804125 <poll+0x376>
+      return r;
+  804120:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804123:	eb 11                	jmp    804136 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804125:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804128:	c1 f8 02             	sar    $0x2,%eax
+  80412b:	83 e0 01             	and    $0x1,%eax
+  80412e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804131:	e9 f6 fc ff ff       	jmp    803e2c <poll+0x7d>
+  }
+}
+  804136:	c9                   	leave
+  804137:	c3                   	ret
+
+0000000000804138 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804138:	55                   	push   %rbp
+  804139:	48 89 e5             	mov    %rsp,%rbp
+  80413c:	48 83 ec 20          	sub    $0x20,%rsp
+  804140:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804144:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804148:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80414c:	be 00 00 00 00       	mov    $0x0,%esi
+  804151:	48 89 c7             	mov    %rax,%rdi
+  804154:	48 b8 26 42 80 00 00 	movabs $0x804226,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+  804160:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804163:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804167:	79 05                	jns    80416e <stat+0x36>
+    return fd;
+  804169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80416c:	eb 2f                	jmp    80419d <stat+0x65>
+  r = fstat(fd, stat);
+  80416e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804172:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804175:	48 89 d6             	mov    %rdx,%rsi
+  804178:	89 c7                	mov    %eax,%edi
+  80417a:	48 b8 6f 3c 80 00 00 	movabs $0x803c6f,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+  804186:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804189:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80418c:	89 c7                	mov    %eax,%edi
+  80418e:	48 b8 d7 35 80 00 00 	movabs $0x8035d7,%rax
+  804195:	00 00 00 
+  804198:	ff d0                	call   *%rax
+  return r;
+  80419a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80419d:	c9                   	leave
+  80419e:	c3                   	ret
+
+000000000080419f <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80419f:	55                   	push   %rbp
+  8041a0:	48 89 e5             	mov    %rsp,%rbp
+  8041a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8041a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8041aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8041ae:	48 b8 00 90 81 00 00 	movabs $0x819000,%rax
+  8041b5:	00 00 00 
+  8041b8:	8b 00                	mov    (%rax),%eax
+  8041ba:	85 c0                	test   %eax,%eax
+  8041bc:	75 1d                	jne    8041db <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8041be:	bf 03 00 00 00       	mov    $0x3,%edi
+  8041c3:	48 b8 4c 5f 80 00 00 	movabs $0x805f4c,%rax
+  8041ca:	00 00 00 
+  8041cd:	ff d0                	call   *%rax
+  8041cf:	48 ba 00 90 81 00 00 	movabs $0x819000,%rdx
+  8041d6:	00 00 00 
+  8041d9:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8041db:	48 b8 00 90 81 00 00 	movabs $0x819000,%rax
+  8041e2:	00 00 00 
+  8041e5:	8b 00                	mov    (%rax),%eax
+  8041e7:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8041ea:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8041ef:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8041f6:	00 00 00 
+  8041f9:	89 c7                	mov    %eax,%edi
+  8041fb:	48 b8 9f 5e 80 00 00 	movabs $0x805e9f,%rax
+  804202:	00 00 00 
+  804205:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804207:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80420b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804210:	48 89 c6             	mov    %rax,%rsi
+  804213:	bf 00 00 00 00       	mov    $0x0,%edi
+  804218:	48 b8 22 5d 80 00 00 	movabs $0x805d22,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+}
+  804224:	c9                   	leave
+  804225:	c3                   	ret
+
+0000000000804226 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804226:	55                   	push   %rbp
+  804227:	48 89 e5             	mov    %rsp,%rbp
+  80422a:	48 83 ec 20          	sub    $0x20,%rsp
+  80422e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804232:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804239:	48 89 c7             	mov    %rax,%rdi
+  80423c:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  804243:	00 00 00 
+  804246:	ff d0                	call   *%rax
+  804248:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80424d:	7e 0a                	jle    804259 <open+0x33>
+    return -E_BAD_PATH;
+  80424f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804254:	e9 a8 00 00 00       	jmp    804301 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804259:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80425d:	48 89 c7             	mov    %rax,%rdi
+  804260:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  804267:	00 00 00 
+  80426a:	ff d0                	call   *%rax
+  80426c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80426f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804273:	79 08                	jns    80427d <open+0x57>
+    return r;
+  804275:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804278:	e9 84 00 00 00       	jmp    804301 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80427d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804281:	48 89 c6             	mov    %rax,%rsi
+  804284:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  80428b:	00 00 00 
+  80428e:	48 89 c7             	mov    %rax,%rdi
+  804291:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  804298:	00 00 00 
+  80429b:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80429d:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8042a4:	00 00 00 
+  8042a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042aa:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8042b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042b4:	48 89 c6             	mov    %rax,%rsi
+  8042b7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042bc:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  8042c3:	00 00 00 
+  8042c6:	ff d0                	call   *%rax
+  8042c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042cf:	79 1d                	jns    8042ee <open+0xc8>
+    fd_close(fd, 0);
+  8042d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8042da:	48 89 c7             	mov    %rax,%rdi
+  8042dd:	48 b8 38 34 80 00 00 	movabs $0x803438,%rax
+  8042e4:	00 00 00 
+  8042e7:	ff d0                	call   *%rax
+    return r;
+  8042e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042ec:	eb 13                	jmp    804301 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8042ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f2:	48 89 c7             	mov    %rax,%rdi
+  8042f5:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+}
+  804301:	c9                   	leave
+  804302:	c3                   	ret
+
+0000000000804303 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	48 83 ec 10          	sub    $0x10,%rsp
+  80430b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80430f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804313:	8b 40 0c             	mov    0xc(%rax),%eax
+  804316:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  80431d:	00 00 00 
+  804320:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804322:	be 00 00 00 00       	mov    $0x0,%esi
+  804327:	bf 06 00 00 00       	mov    $0x6,%edi
+  80432c:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804333:	00 00 00 
+  804336:	ff d0                	call   *%rax
+}
+  804338:	c9                   	leave
+  804339:	c3                   	ret
+
+000000000080433a <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	48 83 ec 30          	sub    $0x30,%rsp
+  804342:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804346:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80434a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80434e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804353:	74 07                	je     80435c <devfile_read+0x22>
+  804355:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80435a:	75 0a                	jne    804366 <devfile_read+0x2c>
+  return E_INVAL;
+  80435c:	b8 03 00 00 00       	mov    $0x3,%eax
+  804361:	e9 b4 00 00 00       	jmp    80441a <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804366:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80436d:	00 
+  while (n) {
+  80436e:	e9 98 00 00 00       	jmp    80440b <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804373:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804377:	8b 40 0c             	mov    0xc(%rax),%eax
+  80437a:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804381:	00 00 00 
+  804384:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804386:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  80438d:	00 00 00 
+  804390:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804394:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804398:	be 00 00 00 00       	mov    $0x0,%esi
+  80439d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8043a2:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  8043a9:	00 00 00 
+  8043ac:	ff d0                	call   *%rax
+  8043ae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8043b1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043b5:	7f 13                	jg     8043ca <devfile_read+0x90>
+      return res ? res : res0;
+  8043b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043bb:	74 07                	je     8043c4 <devfile_read+0x8a>
+  8043bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043c0:	48 98                	cltq
+  8043c2:	eb 56                	jmp    80441a <devfile_read+0xe0>
+  8043c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043c8:	eb 50                	jmp    80441a <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8043ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043cd:	48 63 d0             	movslq %eax,%rdx
+  8043d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043d4:	48 b9 00 80 81 00 00 	movabs $0x818000,%rcx
+  8043db:	00 00 00 
+  8043de:	48 89 ce             	mov    %rcx,%rsi
+  8043e1:	48 89 c7             	mov    %rax,%rdi
+  8043e4:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  8043eb:	00 00 00 
+  8043ee:	ff d0                	call   *%rax
+
+    buf += res;
+  8043f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043f3:	48 98                	cltq
+  8043f5:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8043f9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043fc:	48 98                	cltq
+  8043fe:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804402:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804405:	48 98                	cltq
+  804407:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80440b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804410:	0f 85 5d ff ff ff    	jne    804373 <devfile_read+0x39>
+  }
+
+  return res0;
+  804416:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80441a:	c9                   	leave
+  80441b:	c3                   	ret
+
+000000000080441c <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80441c:	55                   	push   %rbp
+  80441d:	48 89 e5             	mov    %rsp,%rbp
+  804420:	48 83 ec 50          	sub    $0x50,%rsp
+  804424:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804428:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80442c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804430:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804435:	74 07                	je     80443e <devfile_write+0x22>
+  804437:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80443c:	75 0a                	jne    804448 <devfile_write+0x2c>
+  return E_INVAL;
+  80443e:	b8 03 00 00 00       	mov    $0x3,%eax
+  804443:	e9 c9 00 00 00       	jmp    804511 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804448:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80444f:	00 
+
+  while (n) {
+  804450:	e9 ad 00 00 00       	jmp    804502 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804455:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804459:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80445d:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804464:	00 
+  804465:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804469:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80446d:	48 39 c2             	cmp    %rax,%rdx
+  804470:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804474:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804478:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80447c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804480:	48 89 c6             	mov    %rax,%rsi
+  804483:	48 b8 10 80 81 00 00 	movabs $0x818010,%rax
+  80448a:	00 00 00 
+  80448d:	48 89 c7             	mov    %rax,%rdi
+  804490:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  804497:	00 00 00 
+  80449a:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80449c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044a0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044a3:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8044aa:	00 00 00 
+  8044ad:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8044af:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8044b6:	00 00 00 
+  8044b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044bd:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8044c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8044c6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8044cb:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  8044d2:	00 00 00 
+  8044d5:	ff d0                	call   *%rax
+  8044d7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8044da:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8044de:	79 07                	jns    8044e7 <devfile_write+0xcb>
+      return res;
+  8044e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044e3:	48 98                	cltq
+  8044e5:	eb 2a                	jmp    804511 <devfile_write+0xf5>
+
+    buf += res;
+  8044e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044ea:	48 98                	cltq
+  8044ec:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8044f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044f3:	48 98                	cltq
+  8044f5:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8044f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044fc:	48 98                	cltq
+  8044fe:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804502:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804507:	0f 85 48 ff ff ff    	jne    804455 <devfile_write+0x39>
+  }
+
+  return res0;
+  80450d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804511:	c9                   	leave
+  804512:	c3                   	ret
+
+0000000000804513 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804513:	55                   	push   %rbp
+  804514:	48 89 e5             	mov    %rsp,%rbp
+  804517:	48 83 ec 20          	sub    $0x20,%rsp
+  80451b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80451f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804523:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804527:	8b 40 0c             	mov    0xc(%rax),%eax
+  80452a:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804531:	00 00 00 
+  804534:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804536:	be 00 00 00 00       	mov    $0x0,%esi
+  80453b:	bf 05 00 00 00       	mov    $0x5,%edi
+  804540:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804547:	00 00 00 
+  80454a:	ff d0                	call   *%rax
+  80454c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80454f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804553:	79 05                	jns    80455a <devfile_stat+0x47>
+    return r;
+  804555:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804558:	eb 59                	jmp    8045b3 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80455a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80455e:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804565:	00 00 00 
+  804568:	48 89 d6             	mov    %rdx,%rsi
+  80456b:	48 89 c7             	mov    %rax,%rdi
+  80456e:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  804575:	00 00 00 
+  804578:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80457a:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  804581:	00 00 00 
+  804584:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80458a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80458e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804594:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  80459b:	00 00 00 
+  80459e:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8045a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a8:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8045ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045b3:	c9                   	leave
+  8045b4:	c3                   	ret
+
+00000000008045b5 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8045b5:	55                   	push   %rbp
+  8045b6:	48 89 e5             	mov    %rsp,%rbp
+  8045b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8045bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8045c1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8045c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045c8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045cb:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8045d2:	00 00 00 
+  8045d5:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8045d7:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  8045de:	00 00 00 
+  8045e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045e4:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8045e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ec:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045f1:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  8045f8:	00 00 00 
+  8045fb:	ff d0                	call   *%rax
+}
+  8045fd:	c9                   	leave
+  8045fe:	c3                   	ret
+
+00000000008045ff <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8045ff:	55                   	push   %rbp
+  804600:	48 89 e5             	mov    %rsp,%rbp
+  804603:	48 83 ec 18          	sub    $0x18,%rsp
+  804607:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80460b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80460e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804612:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804615:	83 e0 03             	and    $0x3,%eax
+}
+  804618:	c9                   	leave
+  804619:	c3                   	ret
+
+000000000080461a <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80461a:	55                   	push   %rbp
+  80461b:	48 89 e5             	mov    %rsp,%rbp
+  80461e:	48 83 ec 10          	sub    $0x10,%rsp
+  804622:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80462a:	48 89 c7             	mov    %rax,%rdi
+  80462d:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  804634:	00 00 00 
+  804637:	ff d0                	call   *%rax
+  804639:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80463e:	7e 07                	jle    804647 <remove+0x2d>
+    return -E_BAD_PATH;
+  804640:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804645:	eb 36                	jmp    80467d <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804647:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80464b:	48 89 c6             	mov    %rax,%rsi
+  80464e:	48 b8 00 80 81 00 00 	movabs $0x818000,%rax
+  804655:	00 00 00 
+  804658:	48 89 c7             	mov    %rax,%rdi
+  80465b:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  804662:	00 00 00 
+  804665:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804667:	be 00 00 00 00       	mov    $0x0,%esi
+  80466c:	bf 07 00 00 00       	mov    $0x7,%edi
+  804671:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804678:	00 00 00 
+  80467b:	ff d0                	call   *%rax
+}
+  80467d:	c9                   	leave
+  80467e:	c3                   	ret
+
+000000000080467f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80467f:	55                   	push   %rbp
+  804680:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804683:	be 00 00 00 00       	mov    $0x0,%esi
+  804688:	bf 08 00 00 00       	mov    $0x8,%edi
+  80468d:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804694:	00 00 00 
+  804697:	ff d0                	call   *%rax
+}
+  804699:	5d                   	pop    %rbp
+  80469a:	c3                   	ret
+
+000000000080469b <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  80469b:	55                   	push   %rbp
+  80469c:	48 89 e5             	mov    %rsp,%rbp
+  80469f:	48 83 ec 20          	sub    $0x20,%rsp
+  8046a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8046a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8046ac:	bf 09 00 00 00       	mov    $0x9,%edi
+  8046b1:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  8046b8:	00 00 00 
+  8046bb:	ff d0                	call   *%rax
+  8046bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046c4:	79 05                	jns    8046cb <fs_stats+0x30>
+    return r;
+  8046c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046c9:	eb 2a                	jmp    8046f5 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8046cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046cf:	ba 68 00 00 00       	mov    $0x68,%edx
+  8046d4:	48 b9 00 80 81 00 00 	movabs $0x818000,%rcx
+  8046db:	00 00 00 
+  8046de:	48 89 ce             	mov    %rcx,%rsi
+  8046e1:	48 89 c7             	mov    %rax,%rdi
+  8046e4:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  8046eb:	00 00 00 
+  8046ee:	ff d0                	call   *%rax
+  return 0;
+  8046f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046f5:	c9                   	leave
+  8046f6:	c3                   	ret
+
+00000000008046f7 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8046f7:	55                   	push   %rbp
+  8046f8:	48 89 e5             	mov    %rsp,%rbp
+  8046fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8046ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804702:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804709:	00 00 00 
+  80470c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80470f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804711:	be 00 00 00 00       	mov    $0x0,%esi
+  804716:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80471b:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804722:	00 00 00 
+  804725:	ff d0                	call   *%rax
+}
+  804727:	c9                   	leave
+  804728:	c3                   	ret
+
+0000000000804729 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804729:	55                   	push   %rbp
+  80472a:	48 89 e5             	mov    %rsp,%rbp
+  80472d:	48 83 ec 10          	sub    $0x10,%rsp
+  804731:	89 f8                	mov    %edi,%eax
+  804733:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804736:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  80473a:	48 ba 00 80 81 00 00 	movabs $0x818000,%rdx
+  804741:	00 00 00 
+  804744:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804746:	be 00 00 00 00       	mov    $0x0,%esi
+  80474b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804750:	48 b8 9f 41 80 00 00 	movabs $0x80419f,%rax
+  804757:	00 00 00 
+  80475a:	ff d0                	call   *%rax
+}
+  80475c:	c9                   	leave
+  80475d:	c3                   	ret
+
+000000000080475e <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80475e:	55                   	push   %rbp
+  80475f:	48 89 e5             	mov    %rsp,%rbp
+  804762:	48 83 ec 10          	sub    $0x10,%rsp
+  804766:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  80476a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80476e:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804773:	48 89 c7             	mov    %rax,%rdi
+  804776:	48 b8 84 47 80 00 00 	movabs $0x804784,%rax
+  80477d:	00 00 00 
+  804780:	ff d0                	call   *%rax
+}
+  804782:	c9                   	leave
+  804783:	c3                   	ret
+
+0000000000804784 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804784:	55                   	push   %rbp
+  804785:	48 89 e5             	mov    %rsp,%rbp
+  804788:	48 83 ec 50          	sub    $0x50,%rsp
+  80478c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804790:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804794:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80479b:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80479c:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8047a1:	74 0a                	je     8047ad <pipe_size+0x29>
+  8047a3:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8047aa:	00 
+  8047ab:	76 0a                	jbe    8047b7 <pipe_size+0x33>
+    return -E_INVAL;
+  8047ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047b2:	e9 cc 02 00 00       	jmp    804a83 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8047b7:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8047bb:	48 89 c7             	mov    %rax,%rdi
+  8047be:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  8047c5:	00 00 00 
+  8047c8:	ff d0                	call   *%rax
+  8047ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047d1:	0f 88 a8 02 00 00    	js     804a7f <pipe_size+0x2fb>
+  8047d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047db:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047e0:	48 89 c6             	mov    %rax,%rsi
+  8047e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047e8:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8047ef:	00 00 00 
+  8047f2:	ff d0                	call   *%rax
+  8047f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047fb:	0f 88 7e 02 00 00    	js     804a7f <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804801:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804805:	48 89 c7             	mov    %rax,%rdi
+  804808:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  80480f:	00 00 00 
+  804812:	ff d0                	call   *%rax
+  804814:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804817:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80481b:	0f 88 43 02 00 00    	js     804a64 <pipe_size+0x2e0>
+  804821:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804825:	ba 07 04 00 00       	mov    $0x407,%edx
+  80482a:	48 89 c6             	mov    %rax,%rsi
+  80482d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804832:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  804839:	00 00 00 
+  80483c:	ff d0                	call   *%rax
+  80483e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804841:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804845:	0f 88 19 02 00 00    	js     804a64 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80484b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80484f:	48 89 c7             	mov    %rax,%rdi
+  804852:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  804859:	00 00 00 
+  80485c:	ff d0                	call   *%rax
+  80485e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804862:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804869:	00 
+  80486a:	e9 a2 00 00 00       	jmp    804911 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80486f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804873:	48 c1 e0 0c          	shl    $0xc,%rax
+  804877:	48 89 c2             	mov    %rax,%rdx
+  80487a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80487e:	48 01 d0             	add    %rdx,%rax
+  804881:	ba 07 04 00 00       	mov    $0x407,%edx
+  804886:	48 89 c6             	mov    %rax,%rsi
+  804889:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488e:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  804895:	00 00 00 
+  804898:	ff d0                	call   *%rax
+  80489a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80489d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048a1:	0f 88 37 01 00 00    	js     8049de <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8048a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048ab:	48 89 c7             	mov    %rax,%rdi
+  8048ae:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8048b5:	00 00 00 
+  8048b8:	ff d0                	call   *%rax
+  8048ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048be:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8048c2:	48 01 c2             	add    %rax,%rdx
+  8048c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8048cd:	48 89 c1             	mov    %rax,%rcx
+  8048d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048d4:	48 01 c8             	add    %rcx,%rax
+  8048d7:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8048dd:	48 89 d1             	mov    %rdx,%rcx
+  8048e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048e5:	48 89 c6             	mov    %rax,%rsi
+  8048e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ed:	48 b8 c3 23 80 00 00 	movabs $0x8023c3,%rax
+  8048f4:	00 00 00 
+  8048f7:	ff d0                	call   *%rax
+  8048f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804900:	79 0a                	jns    80490c <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804902:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804907:	e9 d3 00 00 00       	jmp    8049df <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80490c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804911:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804918:	00 
+  804919:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80491d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804921:	48 01 d0             	add    %rdx,%rax
+  804924:	48 83 c0 1f          	add    $0x1f,%rax
+  804928:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80492c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804930:	ba 00 00 00 00       	mov    $0x0,%edx
+  804935:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804939:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80493d:	48 29 d0             	sub    %rdx,%rax
+  804940:	48 c1 e8 0c          	shr    $0xc,%rax
+  804944:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804948:	0f 82 21 ff ff ff    	jb     80486f <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80494e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804952:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804956:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80495a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80495e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804962:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804966:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  80496d:	00 00 00 
+  804970:	8b 12                	mov    (%rdx),%edx
+  804972:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804974:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804978:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80497f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804983:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  80498a:	00 00 00 
+  80498d:	8b 12                	mov    (%rdx),%edx
+  80498f:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804991:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804995:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80499c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049a0:	48 89 c7             	mov    %rax,%rdi
+  8049a3:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  8049aa:	00 00 00 
+  8049ad:	ff d0                	call   *%rax
+  8049af:	89 c2                	mov    %eax,%edx
+  8049b1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049b5:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8049b7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049bb:	48 89 c7             	mov    %rax,%rdi
+  8049be:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  8049c5:	00 00 00 
+  8049c8:	ff d0                	call   *%rax
+  8049ca:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8049ce:	48 83 c2 04          	add    $0x4,%rdx
+  8049d2:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8049d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d9:	e9 a5 00 00 00       	jmp    804a83 <pipe_size+0x2ff>
+      goto err2;
+  8049de:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8049df:	eb 58                	jmp    804a39 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8049e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049e5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8049e9:	48 89 c2             	mov    %rax,%rdx
+  8049ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049f0:	48 01 d0             	add    %rdx,%rax
+  8049f3:	48 89 c6             	mov    %rax,%rsi
+  8049f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049fb:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  804a02:	00 00 00 
+  804a05:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804a07:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a0b:	48 89 c7             	mov    %rax,%rdi
+  804a0e:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  804a15:	00 00 00 
+  804a18:	ff d0                	call   *%rax
+  804a1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a1e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804a22:	48 01 d0             	add    %rdx,%rax
+  804a25:	48 89 c6             	mov    %rax,%rsi
+  804a28:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a2d:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  804a34:	00 00 00 
+  804a37:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804a39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a3d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a41:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804a45:	48 85 c0             	test   %rax,%rax
+  804a48:	75 97                	jne    8049e1 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804a4a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a4e:	48 89 c6             	mov    %rax,%rsi
+  804a51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a56:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  804a5d:	00 00 00 
+  804a60:	ff d0                	call   *%rax
+  804a62:	eb 01                	jmp    804a65 <pipe_size+0x2e1>
+    goto err1;
+  804a64:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804a65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a69:	48 89 c6             	mov    %rax,%rsi
+  804a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a71:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  804a78:	00 00 00 
+  804a7b:	ff d0                	call   *%rax
+  804a7d:	eb 01                	jmp    804a80 <pipe_size+0x2fc>
+    goto err;
+  804a7f:	90                   	nop
+err:
+  return r;
+  804a80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804a83:	c9                   	leave
+  804a84:	c3                   	ret
+
+0000000000804a85 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804a85:	55                   	push   %rbp
+  804a86:	48 89 e5             	mov    %rsp,%rbp
+  804a89:	53                   	push   %rbx
+  804a8a:	48 83 ec 28          	sub    $0x28,%rsp
+  804a8e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a92:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804a96:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a9d:	00 00 00 
+  804aa0:	8b 40 04             	mov    0x4(%rax),%eax
+  804aa3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804aa8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804aaf:	00 00 00 
+  804ab2:	48 98                	cltq
+  804ab4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804abb:	48 01 d0             	add    %rdx,%rax
+  804abe:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ac4:	8b 00                	mov    (%rax),%eax
+  804ac6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804ac9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acd:	48 89 c7             	mov    %rax,%rdi
+  804ad0:	48 b8 bd 5f 80 00 00 	movabs $0x805fbd,%rax
+  804ad7:	00 00 00 
+  804ada:	ff d0                	call   *%rax
+  804adc:	89 c3                	mov    %eax,%ebx
+  804ade:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ae2:	48 89 c7             	mov    %rax,%rdi
+  804ae5:	48 b8 bd 5f 80 00 00 	movabs $0x805fbd,%rax
+  804aec:	00 00 00 
+  804aef:	ff d0                	call   *%rax
+  804af1:	39 c3                	cmp    %eax,%ebx
+  804af3:	0f 94 c0             	sete   %al
+  804af6:	0f b6 c0             	movzbl %al,%eax
+  804af9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804afc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b03:	00 00 00 
+  804b06:	8b 40 04             	mov    0x4(%rax),%eax
+  804b09:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b0e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b15:	00 00 00 
+  804b18:	48 98                	cltq
+  804b1a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b21:	48 01 d0             	add    %rdx,%rax
+  804b24:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b2a:	8b 00                	mov    (%rax),%eax
+  804b2c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804b2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b32:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b35:	75 05                	jne    804b3c <_pipeisclosed+0xb7>
+      return ret;
+  804b37:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b3a:	eb 68                	jmp    804ba4 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804b3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b3f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b42:	0f 84 4e ff ff ff    	je     804a96 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804b48:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b4f:	00 00 00 
+  804b52:	8b 40 04             	mov    0x4(%rax),%eax
+  804b55:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b5a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b61:	00 00 00 
+  804b64:	48 98                	cltq
+  804b66:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b6d:	48 01 d0             	add    %rdx,%rax
+  804b70:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b76:	8b 10                	mov    (%rax),%edx
+  804b78:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804b7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b7e:	89 c6                	mov    %eax,%esi
+  804b80:	48 b8 10 6e 80 00 00 	movabs $0x806e10,%rax
+  804b87:	00 00 00 
+  804b8a:	48 89 c7             	mov    %rax,%rdi
+  804b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b92:	49 b8 ed 05 80 00 00 	movabs $0x8005ed,%r8
+  804b99:	00 00 00 
+  804b9c:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804b9f:	e9 f2 fe ff ff       	jmp    804a96 <_pipeisclosed+0x11>
+  }
+}
+  804ba4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804ba8:	c9                   	leave
+  804ba9:	c3                   	ret
+
+0000000000804baa <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804baa:	55                   	push   %rbp
+  804bab:	48 89 e5             	mov    %rsp,%rbp
+  804bae:	48 83 ec 30          	sub    $0x30,%rsp
+  804bb2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bb5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804bb9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804bbc:	48 89 d6             	mov    %rdx,%rsi
+  804bbf:	89 c7                	mov    %eax,%edi
+  804bc1:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  804bc8:	00 00 00 
+  804bcb:	ff d0                	call   *%rax
+  804bcd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bd4:	79 05                	jns    804bdb <pipeisclosed+0x31>
+    return r;
+  804bd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bd9:	eb 31                	jmp    804c0c <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804bdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bdf:	48 89 c7             	mov    %rax,%rdi
+  804be2:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  804be9:	00 00 00 
+  804bec:	ff d0                	call   *%rax
+  804bee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804bf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bf6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bfa:	48 89 d6             	mov    %rdx,%rsi
+  804bfd:	48 89 c7             	mov    %rax,%rdi
+  804c00:	48 b8 85 4a 80 00 00 	movabs $0x804a85,%rax
+  804c07:	00 00 00 
+  804c0a:	ff d0                	call   *%rax
+}
+  804c0c:	c9                   	leave
+  804c0d:	c3                   	ret
+
+0000000000804c0e <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804c0e:	55                   	push   %rbp
+  804c0f:	48 89 e5             	mov    %rsp,%rbp
+  804c12:	48 83 ec 10          	sub    $0x10,%rsp
+  804c16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c1e:	8b 40 18             	mov    0x18(%rax),%eax
+  804c21:	8d 50 01             	lea    0x1(%rax),%edx
+  804c24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c28:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804c2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c2f:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804c32:	85 c0                	test   %eax,%eax
+  804c34:	74 27                	je     804c5d <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804c41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c45:	48 83 c0 18          	add    $0x18,%rax
+  804c49:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804c4e:	48 89 c7             	mov    %rax,%rdi
+  804c51:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  804c58:	00 00 00 
+  804c5b:	ff d0                	call   *%rax
+  }
+}
+  804c5d:	90                   	nop
+  804c5e:	c9                   	leave
+  804c5f:	c3                   	ret
+
+0000000000804c60 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804c60:	55                   	push   %rbp
+  804c61:	48 89 e5             	mov    %rsp,%rbp
+  804c64:	48 83 ec 10          	sub    $0x10,%rsp
+  804c68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c6c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c73:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c7e:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804c82:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c85:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804c8c:	89 c6                	mov    %eax,%esi
+  804c8e:	48 89 cf             	mov    %rcx,%rdi
+  804c91:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  804c98:	00 00 00 
+  804c9b:	ff d0                	call   *%rax
+}
+  804c9d:	90                   	nop
+  804c9e:	c9                   	leave
+  804c9f:	c3                   	ret
+
+0000000000804ca0 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804ca0:	55                   	push   %rbp
+  804ca1:	48 89 e5             	mov    %rsp,%rbp
+  804ca4:	48 83 ec 70          	sub    $0x70,%rsp
+  804ca8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804cac:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804cb0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804cb4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804cb8:	48 89 c7             	mov    %rax,%rdi
+  804cbb:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  804cc2:	00 00 00 
+  804cc5:	ff d0                	call   *%rax
+  804cc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804ccb:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804cd0:	75 0a                	jne    804cdc <devpipe_read+0x3c>
+    return 0;
+  804cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd7:	e9 63 01 00 00       	jmp    804e3f <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804cdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce0:	8b 40 18             	mov    0x18(%rax),%eax
+  804ce3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804ce6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cea:	48 8b 10             	mov    (%rax),%rdx
+  804ced:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cf1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804cf5:	48 39 c2             	cmp    %rax,%rdx
+  804cf8:	75 42                	jne    804d3c <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804cfa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804cfe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d02:	48 89 d6             	mov    %rdx,%rsi
+  804d05:	48 89 c7             	mov    %rax,%rdi
+  804d08:	48 b8 85 4a 80 00 00 	movabs $0x804a85,%rax
+  804d0f:	00 00 00 
+  804d12:	ff d0                	call   *%rax
+  804d14:	85 c0                	test   %eax,%eax
+  804d16:	74 0a                	je     804d22 <devpipe_read+0x82>
+      return 0;
+  804d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1d:	e9 1d 01 00 00       	jmp    804e3f <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804d22:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d29:	89 d6                	mov    %edx,%esi
+  804d2b:	48 89 c7             	mov    %rax,%rdi
+  804d2e:	48 b8 60 4c 80 00 00 	movabs $0x804c60,%rax
+  804d35:	00 00 00 
+  804d38:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804d3a:	eb a0                	jmp    804cdc <devpipe_read+0x3c>
+      break;
+  804d3c:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804d3d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d41:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804d45:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d49:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d51:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d59:	48 8b 00             	mov    (%rax),%rax
+  804d5c:	48 29 c2             	sub    %rax,%rdx
+  804d5f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804d63:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d6b:	48 39 c2             	cmp    %rax,%rdx
+  804d6e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d72:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804d76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d7a:	48 8b 00             	mov    (%rax),%rax
+  804d7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d81:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804d85:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d8a:	48 f7 f1             	div    %rcx
+  804d8d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804d91:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804da1:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804da5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804da9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804dad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804db1:	48 39 c2             	cmp    %rax,%rdx
+  804db4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804db8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804dbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc0:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804dc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dc8:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804dcc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dd4:	48 89 ce             	mov    %rcx,%rsi
+  804dd7:	48 89 c7             	mov    %rax,%rdi
+  804dda:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  804de1:	00 00 00 
+  804de4:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804de6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804dea:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804dee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804df2:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804df6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804dfa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804dfe:	48 01 d1             	add    %rdx,%rcx
+  804e01:	48 89 c2             	mov    %rax,%rdx
+  804e04:	48 89 cf             	mov    %rcx,%rdi
+  804e07:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  804e0e:	00 00 00 
+  804e11:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e17:	48 8b 10             	mov    (%rax),%rdx
+  804e1a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e1e:	48 01 c2             	add    %rax,%rdx
+  804e21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e25:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804e28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e2c:	48 89 c7             	mov    %rax,%rdi
+  804e2f:	48 b8 0e 4c 80 00 00 	movabs $0x804c0e,%rax
+  804e36:	00 00 00 
+  804e39:	ff d0                	call   *%rax
+  return n;
+  804e3b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804e3f:	c9                   	leave
+  804e40:	c3                   	ret
+
+0000000000804e41 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e41:	55                   	push   %rbp
+  804e42:	48 89 e5             	mov    %rsp,%rbp
+  804e45:	48 83 ec 70          	sub    $0x70,%rsp
+  804e49:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e4d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e51:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804e55:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e59:	48 89 c7             	mov    %rax,%rdi
+  804e5c:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  804e63:	00 00 00 
+  804e66:	ff d0                	call   *%rax
+  804e68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804e6c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804e74:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e7b:	00 
+  804e7c:	e9 b8 01 00 00       	jmp    805039 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e85:	8b 40 18             	mov    0x18(%rax),%eax
+  804e88:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804e8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e8f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e97:	48 8b 00             	mov    (%rax),%rax
+  804e9a:	48 29 c2             	sub    %rax,%rdx
+  804e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ea5:	48 39 c2             	cmp    %rax,%rdx
+  804ea8:	75 4d                	jne    804ef7 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804eaa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804eae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804eb2:	48 89 d6             	mov    %rdx,%rsi
+  804eb5:	48 89 c7             	mov    %rax,%rdi
+  804eb8:	48 b8 85 4a 80 00 00 	movabs $0x804a85,%rax
+  804ebf:	00 00 00 
+  804ec2:	ff d0                	call   *%rax
+  804ec4:	85 c0                	test   %eax,%eax
+  804ec6:	74 0a                	je     804ed2 <devpipe_write+0x91>
+        return 0;
+  804ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ecd:	e9 79 01 00 00       	jmp    80504b <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804ed2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ed5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed9:	89 d6                	mov    %edx,%esi
+  804edb:	48 89 c7             	mov    %rax,%rdi
+  804ede:	48 b8 60 4c 80 00 00 	movabs $0x804c60,%rax
+  804ee5:	00 00 00 
+  804ee8:	ff d0                	call   *%rax
+      m = 0;
+  804eea:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ef1:	00 
+      continue;
+  804ef2:	e9 3a 01 00 00       	jmp    805031 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804ef7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804efb:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804eff:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f07:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0f:	48 8b 08             	mov    (%rax),%rcx
+  804f12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f1a:	48 29 c1             	sub    %rax,%rcx
+  804f1d:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804f21:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f25:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f2d:	48 39 c2             	cmp    %rax,%rdx
+  804f30:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804f38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f40:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f44:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f4d:	48 f7 f1             	div    %rcx
+  804f50:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804f54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f58:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804f5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f60:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f64:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f68:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804f6c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f70:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f74:	48 39 c2             	cmp    %rax,%rdx
+  804f77:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f7b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804f7f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f83:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804f87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f8b:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804f8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f93:	48 01 d1             	add    %rdx,%rcx
+  804f96:	48 89 c2             	mov    %rax,%rdx
+  804f99:	48 89 cf             	mov    %rcx,%rdi
+  804f9c:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  804fa3:	00 00 00 
+  804fa6:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804fa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fac:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fb0:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fb4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804fb8:	73 4d                	jae    805007 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804fba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fbe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fc6:	48 29 c2             	sub    %rax,%rdx
+  804fc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fcd:	48 01 c2             	add    %rax,%rdx
+  804fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fd8:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fdc:	48 89 c1             	mov    %rax,%rcx
+  804fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fe3:	48 01 c1             	add    %rax,%rcx
+  804fe6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fea:	48 01 c1             	add    %rax,%rcx
+  804fed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff1:	48 83 c0 20          	add    $0x20,%rax
+  804ff5:	48 89 ce             	mov    %rcx,%rsi
+  804ff8:	48 89 c7             	mov    %rax,%rdi
+  804ffb:	48 b8 e6 1c 80 00 00 	movabs $0x801ce6,%rax
+  805002:	00 00 00 
+  805005:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80500b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80500f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805013:	48 01 c2             	add    %rax,%rdx
+  805016:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80501e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805022:	48 89 c7             	mov    %rax,%rdi
+  805025:	48 b8 0e 4c 80 00 00 	movabs $0x804c0e,%rax
+  80502c:	00 00 00 
+  80502f:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805031:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805035:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805039:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80503d:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805041:	0f 82 3a fe ff ff    	jb     804e81 <devpipe_write+0x40>
+  }
+
+  return i;
+  805047:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80504b:	c9                   	leave
+  80504c:	c3                   	ret
+
+000000000080504d <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80504d:	55                   	push   %rbp
+  80504e:	48 89 e5             	mov    %rsp,%rbp
+  805051:	48 83 ec 40          	sub    $0x40,%rsp
+  805055:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805059:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80505c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805060:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805064:	48 89 c7             	mov    %rax,%rdi
+  805067:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  80506e:	00 00 00 
+  805071:	ff d0                	call   *%rax
+  805073:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805077:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80507e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805082:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805086:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80508a:	48 89 d6             	mov    %rdx,%rsi
+  80508d:	48 89 c7             	mov    %rax,%rdi
+  805090:	48 b8 28 3d 80 00 00 	movabs $0x803d28,%rax
+  805097:	00 00 00 
+  80509a:	ff d0                	call   *%rax
+  80509c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80509f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050a3:	79 08                	jns    8050ad <devpipe_poll+0x60>
+    return r;
+  8050a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050a8:	e9 85 00 00 00       	jmp    805132 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8050ad:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050b0:	83 e0 01             	and    $0x1,%eax
+  8050b3:	85 c0                	test   %eax,%eax
+  8050b5:	74 18                	je     8050cf <devpipe_poll+0x82>
+  8050b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050bb:	48 8b 10             	mov    (%rax),%rdx
+  8050be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8050c6:	48 39 c2             	cmp    %rax,%rdx
+  8050c9:	74 04                	je     8050cf <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8050cb:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8050cf:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050d2:	83 e0 02             	and    $0x2,%eax
+  8050d5:	85 c0                	test   %eax,%eax
+  8050d7:	74 23                	je     8050fc <devpipe_poll+0xaf>
+  8050d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050dd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8050e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050e5:	48 8b 00             	mov    (%rax),%rax
+  8050e8:	48 29 c2             	sub    %rax,%rdx
+  8050eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050ef:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050f3:	48 39 c2             	cmp    %rax,%rdx
+  8050f6:	73 04                	jae    8050fc <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8050f8:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8050fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805104:	48 89 d6             	mov    %rdx,%rsi
+  805107:	48 89 c7             	mov    %rax,%rdi
+  80510a:	48 b8 85 4a 80 00 00 	movabs $0x804a85,%rax
+  805111:	00 00 00 
+  805114:	ff d0                	call   *%rax
+  805116:	85 c0                	test   %eax,%eax
+  805118:	74 04                	je     80511e <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80511a:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80511e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805122:	75 0b                	jne    80512f <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805124:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805128:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80512f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805132:	c9                   	leave
+  805133:	c3                   	ret
+
+0000000000805134 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805134:	55                   	push   %rbp
+  805135:	48 89 e5             	mov    %rsp,%rbp
+  805138:	48 83 ec 20          	sub    $0x20,%rsp
+  80513c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805140:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805148:	48 89 c7             	mov    %rax,%rdi
+  80514b:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  805152:	00 00 00 
+  805155:	ff d0                	call   *%rax
+  805157:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80515b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80515f:	48 ba 41 6e 80 00 00 	movabs $0x806e41,%rdx
+  805166:	00 00 00 
+  805169:	48 89 d6             	mov    %rdx,%rsi
+  80516c:	48 89 c7             	mov    %rax,%rdi
+  80516f:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  805176:	00 00 00 
+  805179:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80517b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80517f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805183:	89 c1                	mov    %eax,%ecx
+  805185:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805189:	48 8b 00             	mov    (%rax),%rax
+  80518c:	89 c2                	mov    %eax,%edx
+  80518e:	89 c8                	mov    %ecx,%eax
+  805190:	29 d0                	sub    %edx,%eax
+  805192:	89 c2                	mov    %eax,%edx
+  805194:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805198:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80519e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a2:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8051a9:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8051ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051b0:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8051b7:	00 00 00 
+  8051ba:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8051c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051c6:	c9                   	leave
+  8051c7:	c3                   	ret
+
+00000000008051c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8051c8:	55                   	push   %rbp
+  8051c9:	48 89 e5             	mov    %rsp,%rbp
+  8051cc:	48 83 ec 40          	sub    $0x40,%rsp
+  8051d0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8051d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051d8:	48 89 c7             	mov    %rax,%rdi
+  8051db:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8051e2:	00 00 00 
+  8051e5:	ff d0                	call   *%rax
+  8051e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8051eb:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8051f2:	00 
+  8051f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8051fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051ff:	48 01 d0             	add    %rdx,%rax
+  805202:	48 83 c0 1f          	add    $0x1f,%rax
+  805206:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80520a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80520e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805213:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805217:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80521b:	48 29 d0             	sub    %rdx,%rax
+  80521e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805222:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805226:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80522a:	48 89 c6             	mov    %rax,%rsi
+  80522d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805232:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  805239:	00 00 00 
+  80523c:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80523e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805242:	48 89 c7             	mov    %rax,%rdi
+  805245:	48 b8 0e 4c 80 00 00 	movabs $0x804c0e,%rax
+  80524c:	00 00 00 
+  80524f:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805251:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805255:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805259:	eb 2f                	jmp    80528a <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80525b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80525f:	48 83 e8 01          	sub    $0x1,%rax
+  805263:	48 c1 e0 0c          	shl    $0xc,%rax
+  805267:	48 89 c2             	mov    %rax,%rdx
+  80526a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80526e:	48 01 d0             	add    %rdx,%rax
+  805271:	48 89 c6             	mov    %rax,%rsi
+  805274:	bf 00 00 00 00       	mov    $0x0,%edi
+  805279:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  805280:	00 00 00 
+  805283:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805285:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80528a:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80528f:	77 ca                	ja     80525b <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805291:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805295:	48 89 c6             	mov    %rax,%rsi
+  805298:	bf 00 00 00 00       	mov    $0x0,%edi
+  80529d:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8052a4:	00 00 00 
+  8052a7:	ff d0                	call   *%rax
+}
+  8052a9:	c9                   	leave
+  8052aa:	c3                   	ret
+
+00000000008052ab <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  8052ab:	55                   	push   %rbp
+  8052ac:	48 89 e5             	mov    %rsp,%rbp
+  8052af:	48 83 ec 10          	sub    $0x10,%rsp
+  8052b3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  8052b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8052be:	89 c7                	mov    %eax,%edi
+  8052c0:	48 b8 cf 52 80 00 00 	movabs $0x8052cf,%rax
+  8052c7:	00 00 00 
+  8052ca:	ff d0                	call   *%rax
+}
+  8052cc:	90                   	nop
+  8052cd:	c9                   	leave
+  8052ce:	c3                   	ret
+
+00000000008052cf <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  8052cf:	55                   	push   %rbp
+  8052d0:	48 89 e5             	mov    %rsp,%rbp
+  8052d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8052d7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8052da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  8052de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8052e2:	75 3e                	jne    805322 <waitpid+0x53>
+  8052e4:	48 b8 48 6e 80 00 00 	movabs $0x806e48,%rax
+  8052eb:	00 00 00 
+  8052ee:	48 89 c1             	mov    %rax,%rcx
+  8052f1:	48 b8 53 6e 80 00 00 	movabs $0x806e53,%rax
+  8052f8:	00 00 00 
+  8052fb:	48 89 c2             	mov    %rax,%rdx
+  8052fe:	be 0e 00 00 00       	mov    $0xe,%esi
+  805303:	48 b8 68 6e 80 00 00 	movabs $0x806e68,%rax
+  80530a:	00 00 00 
+  80530d:	48 89 c7             	mov    %rax,%rdi
+  805310:	b8 00 00 00 00       	mov    $0x0,%eax
+  805315:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  80531c:	00 00 00 
+  80531f:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805322:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805327:	74 0a                	je     805333 <waitpid+0x64>
+    *status = 0;
+  805329:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80532d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805333:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805337:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80533a:	48 89 d6             	mov    %rdx,%rsi
+  80533d:	89 c7                	mov    %eax,%edi
+  80533f:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  805346:	00 00 00 
+  805349:	ff d0                	call   *%rax
+}
+  80534b:	c9                   	leave
+  80534c:	c3                   	ret
+
+000000000080534d <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  80534d:	55                   	push   %rbp
+  80534e:	48 89 e5             	mov    %rsp,%rbp
+  805351:	48 83 ec 10          	sub    $0x10,%rsp
+  805355:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805359:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  80535d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805365:	48 89 c7             	mov    %rax,%rdi
+  805368:	ff d2                	call   *%rdx
+  thread_exit(0);
+  80536a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80536f:	48 b8 b1 55 80 00 00 	movabs $0x8055b1,%rax
+  805376:	00 00 00 
+  805379:	ff d0                	call   *%rax
+}
+  80537b:	90                   	nop
+  80537c:	c9                   	leave
+  80537d:	c3                   	ret
+
+000000000080537e <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  80537e:	55                   	push   %rbp
+  80537f:	48 89 e5             	mov    %rsp,%rbp
+  805382:	48 83 ec 20          	sub    $0x20,%rsp
+  805386:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805389:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80538c:	c1 e0 10             	shl    $0x10,%eax
+  80538f:	48 98                	cltq
+  805391:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805396:	48 01 d0             	add    %rdx,%rax
+  805399:	48 89 c6             	mov    %rax,%rsi
+  80539c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053a1:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8053a8:	00 00 00 
+  8053ab:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8053ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b0:	83 c0 01             	add    $0x1,%eax
+  8053b3:	c1 e0 10             	shl    $0x10,%eax
+  8053b6:	48 98                	cltq
+  8053b8:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8053bd:	48 01 d0             	add    %rdx,%rax
+  8053c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8053c4:	eb 20                	jmp    8053e6 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  8053c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053ca:	48 89 c6             	mov    %rax,%rsi
+  8053cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d2:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  8053d9:	00 00 00 
+  8053dc:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8053de:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8053e5:	00 
+  8053e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e9:	83 c0 01             	add    $0x1,%eax
+  8053ec:	c1 e0 10             	shl    $0x10,%eax
+  8053ef:	48 98                	cltq
+  8053f1:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8053f6:	48 01 d0             	add    %rdx,%rax
+  8053f9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8053fd:	72 c7                	jb     8053c6 <slot_unmap+0x48>
+}
+  8053ff:	90                   	nop
+  805400:	90                   	nop
+  805401:	c9                   	leave
+  805402:	c3                   	ret
+
+0000000000805403 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805403:	55                   	push   %rbp
+  805404:	48 89 e5             	mov    %rsp,%rbp
+  805407:	48 83 ec 30          	sub    $0x30,%rsp
+  80540b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80540f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805413:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  80541a:	00 00 00 
+  80541d:	48 89 c7             	mov    %rax,%rdi
+  805420:	48 b8 3e 61 80 00 00 	movabs $0x80613e,%rax
+  805427:	00 00 00 
+  80542a:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  80542c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805433:	eb 04                	jmp    805439 <thread_create+0x36>
+  805435:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805439:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  80543d:	7f 16                	jg     805455 <thread_create+0x52>
+  80543f:	48 ba 40 90 81 00 00 	movabs $0x819040,%rdx
+  805446:	00 00 00 
+  805449:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80544c:	48 98                	cltq
+  80544e:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805451:	85 c0                	test   %eax,%eax
+  805453:	75 e0                	jne    805435 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  805455:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  805459:	75 0c                	jne    805467 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  80545b:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  805462:	e9 2c 01 00 00       	jmp    805593 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805467:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80546a:	c1 e0 10             	shl    $0x10,%eax
+  80546d:	48 98                	cltq
+  80546f:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805474:	48 01 d0             	add    %rdx,%rax
+  805477:	ba 07 00 00 00       	mov    $0x7,%edx
+  80547c:	48 89 c6             	mov    %rax,%rsi
+  80547f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805484:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  80548b:	00 00 00 
+  80548e:	ff d0                	call   *%rax
+  805490:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805493:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805497:	0f 88 f5 00 00 00    	js     805592 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80549d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054a0:	83 c0 01             	add    $0x1,%eax
+  8054a3:	c1 e0 10             	shl    $0x10,%eax
+  8054a6:	48 98                	cltq
+  8054a8:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8054ad:	48 01 d0             	add    %rdx,%rax
+  8054b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8054b4:	eb 32                	jmp    8054e8 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  8054b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054ba:	ba 07 00 00 00       	mov    $0x7,%edx
+  8054bf:	48 89 c6             	mov    %rax,%rsi
+  8054c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c7:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8054ce:	00 00 00 
+  8054d1:	ff d0                	call   *%rax
+  8054d3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8054d6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8054da:	0f 88 9e 00 00 00    	js     80557e <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8054e0:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8054e7:	00 
+  8054e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054eb:	83 c0 01             	add    $0x1,%eax
+  8054ee:	c1 e0 10             	shl    $0x10,%eax
+  8054f1:	48 98                	cltq
+  8054f3:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8054f8:	48 01 d0             	add    %rdx,%rax
+  8054fb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8054ff:	72 b5                	jb     8054b6 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805501:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805505:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805509:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80550c:	c1 e2 10             	shl    $0x10,%edx
+  80550f:	48 63 d2             	movslq %edx,%rdx
+  805512:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805517:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80551a:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80551d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805520:	83 c2 01             	add    $0x1,%edx
+  805523:	c1 e2 10             	shl    $0x10,%edx
+  805526:	48 63 d2             	movslq %edx,%rdx
+  805529:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  80552e:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805531:	48 bf 4d 53 80 00 00 	movabs $0x80534d,%rdi
+  805538:	00 00 00 
+  80553b:	49 89 c8             	mov    %rcx,%r8
+  80553e:	48 89 c1             	mov    %rax,%rcx
+  805541:	4c 89 ca             	mov    %r9,%rdx
+  805544:	48 b8 0b 28 80 00 00 	movabs $0x80280b,%rax
+  80554b:	00 00 00 
+  80554e:	ff d0                	call   *%rax
+  805550:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805553:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805557:	79 08                	jns    805561 <thread_create+0x15e>
+    r = id;
+  805559:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555c:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  80555f:	eb 1e                	jmp    80557f <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  805561:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805564:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805567:	48 b9 40 90 81 00 00 	movabs $0x819040,%rcx
+  80556e:	00 00 00 
+  805571:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805574:	48 98                	cltq
+  805576:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805579:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  80557c:	eb 15                	jmp    805593 <thread_create+0x190>
+      goto fail;
+  80557e:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  80557f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805582:	89 c7                	mov    %eax,%edi
+  805584:	48 b8 7e 53 80 00 00 	movabs $0x80537e,%rax
+  80558b:	00 00 00 
+  80558e:	ff d0                	call   *%rax
+  805590:	eb 01                	jmp    805593 <thread_create+0x190>
+    goto out;
+  805592:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805593:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  80559a:	00 00 00 
+  80559d:	48 89 c7             	mov    %rax,%rdi
+  8055a0:	48 b8 13 62 80 00 00 	movabs $0x806213,%rax
+  8055a7:	00 00 00 
+  8055aa:	ff d0                	call   *%rax
+  return r;
+  8055ac:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8055af:	c9                   	leave
+  8055b0:	c3                   	ret
+
+00000000008055b1 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  8055b1:	55                   	push   %rbp
+  8055b2:	48 89 e5             	mov    %rsp,%rbp
+  8055b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8055b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  8055bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055bf:	89 c7                	mov    %eax,%edi
+  8055c1:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  8055c8:	00 00 00 
+  8055cb:	ff d0                	call   *%rax
+}
+  8055cd:	90                   	nop
+  8055ce:	c9                   	leave
+  8055cf:	c3                   	ret
+
+00000000008055d0 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  8055d0:	55                   	push   %rbp
+  8055d1:	48 89 e5             	mov    %rsp,%rbp
+  8055d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8055d8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  8055df:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  8055e6:	00 00 00 
+  8055e9:	48 89 c7             	mov    %rax,%rdi
+  8055ec:	48 b8 3e 61 80 00 00 	movabs $0x80613e,%rax
+  8055f3:	00 00 00 
+  8055f6:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  8055f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8055ff:	eb 04                	jmp    805605 <thread_join+0x35>
+  805601:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805605:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805609:	7f 17                	jg     805622 <thread_join+0x52>
+  80560b:	48 ba 40 90 81 00 00 	movabs $0x819040,%rdx
+  805612:	00 00 00 
+  805615:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805618:	48 98                	cltq
+  80561a:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80561d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805620:	75 df                	jne    805601 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805622:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  805629:	00 00 00 
+  80562c:	48 89 c7             	mov    %rax,%rdi
+  80562f:	48 b8 13 62 80 00 00 	movabs $0x806213,%rax
+  805636:	00 00 00 
+  805639:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80563b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80563f:	74 06                	je     805647 <thread_join+0x77>
+  805641:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805645:	75 07                	jne    80564e <thread_join+0x7e>
+    return -E_BAD_ENV;
+  805647:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80564c:	eb 76                	jmp    8056c4 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  80564e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805652:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805655:	48 89 d6             	mov    %rdx,%rsi
+  805658:	89 c7                	mov    %eax,%edi
+  80565a:	48 b8 cf 52 80 00 00 	movabs $0x8052cf,%rax
+  805661:	00 00 00 
+  805664:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  805666:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  80566d:	00 00 00 
+  805670:	48 89 c7             	mov    %rax,%rdi
+  805673:	48 b8 3e 61 80 00 00 	movabs $0x80613e,%rax
+  80567a:	00 00 00 
+  80567d:	ff d0                	call   *%rax
+  slot_unmap(i);
+  80567f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805682:	89 c7                	mov    %eax,%edi
+  805684:	48 b8 7e 53 80 00 00 	movabs $0x80537e,%rax
+  80568b:	00 00 00 
+  80568e:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805690:	48 ba 40 90 81 00 00 	movabs $0x819040,%rdx
+  805697:	00 00 00 
+  80569a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80569d:	48 98                	cltq
+  80569f:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  8056a6:	48 b8 20 90 81 00 00 	movabs $0x819020,%rax
+  8056ad:	00 00 00 
+  8056b0:	48 89 c7             	mov    %rax,%rdi
+  8056b3:	48 b8 13 62 80 00 00 	movabs $0x806213,%rax
+  8056ba:	00 00 00 
+  8056bd:	ff d0                	call   *%rax
+  return 0;
+  8056bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056c4:	c9                   	leave
+  8056c5:	c3                   	ret
+
+00000000008056c6 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  8056c6:	55                   	push   %rbp
+  8056c7:	48 89 e5             	mov    %rsp,%rbp
+  8056ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8056ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8056d2:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8056d7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056db:	73 23                	jae    805700 <thread_is_uxstack+0x3a>
+  8056dd:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8056e2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056e6:	72 18                	jb     805700 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  8056e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056ec:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8056f1:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8056f7:	75 07                	jne    805700 <thread_is_uxstack+0x3a>
+  8056f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8056fe:	eb 05                	jmp    805705 <thread_is_uxstack+0x3f>
+  805700:	b8 00 00 00 00       	mov    $0x0,%eax
+  805705:	83 e0 01             	and    $0x1,%eax
+}
+  805708:	c9                   	leave
+  805709:	c3                   	ret
+
+000000000080570a <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  80570a:	55                   	push   %rbp
+  80570b:	48 89 e5             	mov    %rsp,%rbp
+  80570e:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805712:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805719:	00 00 00 
+  80571c:	8b 40 04             	mov    0x4(%rax),%eax
+  80571f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805724:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80572b:	00 00 00 
+  80572e:	48 98                	cltq
+  805730:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805737:	48 01 d0             	add    %rdx,%rax
+  80573a:	48 05 08 01 00 00    	add    $0x108,%rax
+  805740:	48 8b 00             	mov    (%rax),%rax
+  805743:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805747:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80574c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805750:	73 0b                	jae    80575d <thread_pftemp+0x53>
+  805752:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805757:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80575b:	73 07                	jae    805764 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  80575d:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805762:	eb 26                	jmp    80578a <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805764:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  80576b:	ff ff ff 
+  80576e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805772:	48 01 d0             	add    %rdx,%rax
+  805775:	48 c1 e8 10          	shr    $0x10,%rax
+  805779:	48 83 c0 01          	add    $0x1,%rax
+  80577d:	48 c1 e0 0c          	shl    $0xc,%rax
+  805781:	48 f7 d8             	neg    %rax
+  805784:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  80578a:	c9                   	leave
+  80578b:	c3                   	ret
+
+000000000080578c <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80578c:	55                   	push   %rbp
+  80578d:	48 89 e5             	mov    %rsp,%rbp
+  805790:	48 83 ec 08          	sub    $0x8,%rsp
+  805794:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805797:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80579b:	75 10                	jne    8057ad <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80579d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057a4:	00 00 00 
+  8057a7:	8b 00                	mov    (%rax),%eax
+  8057a9:	48 98                	cltq
+  8057ab:	eb 05                	jmp    8057b2 <vsyscall+0x26>
+  }
+  return 0;
+  8057ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b2:	c9                   	leave
+  8057b3:	c3                   	ret
+
+00000000008057b4 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8057b4:	55                   	push   %rbp
+  8057b5:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8057b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057bd:	48 b8 8c 57 80 00 00 	movabs $0x80578c,%rax
+  8057c4:	00 00 00 
+  8057c7:	ff d0                	call   *%rax
+}
+  8057c9:	5d                   	pop    %rbp
+  8057ca:	c3                   	ret
+
+00000000008057cb <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8057cb:	55                   	push   %rbp
+  8057cc:	48 89 e5             	mov    %rsp,%rbp
+  8057cf:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8057d3:	0f 31                	rdtsc
+  8057d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057d8:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8057db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057de:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8057e1:	48 c1 e2 20          	shl    $0x20,%rdx
+  8057e5:	48 09 d0             	or     %rdx,%rax
+  8057e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8057ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8057f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8057f4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057fb:	00 00 00 
+  8057fe:	8b 40 08             	mov    0x8(%rax),%eax
+  805801:	48 98                	cltq
+  805803:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805807:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80580b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805810:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805814:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80581b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80581f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805824:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805828:	48 89 d0             	mov    %rdx,%rax
+  80582b:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805832:	ba 00 00 00 00       	mov    $0x0,%edx
+  805837:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80583b:	48 01 c8             	add    %rcx,%rax
+}
+  80583e:	c9                   	leave
+  80583f:	c3                   	ret
+
+0000000000805840 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805840:	55                   	push   %rbp
+  805841:	48 89 e5             	mov    %rsp,%rbp
+  805844:	48 83 ec 20          	sub    $0x20,%rsp
+  805848:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80584b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80584e:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805851:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805855:	be 01 00 00 00       	mov    $0x1,%esi
+  80585a:	48 89 c7             	mov    %rax,%rdi
+  80585d:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  805864:	00 00 00 
+  805867:	ff d0                	call   *%rax
+}
+  805869:	90                   	nop
+  80586a:	c9                   	leave
+  80586b:	c3                   	ret
+
+000000000080586c <getchar>:
+
+int
+getchar(void) {
+  80586c:	55                   	push   %rbp
+  80586d:	48 89 e5             	mov    %rsp,%rbp
+  805870:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805874:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805878:	ba 01 00 00 00       	mov    $0x1,%edx
+  80587d:	48 89 c6             	mov    %rax,%rsi
+  805880:	bf 00 00 00 00       	mov    $0x0,%edi
+  805885:	48 b8 be 38 80 00 00 	movabs $0x8038be,%rax
+  80588c:	00 00 00 
+  80588f:	ff d0                	call   *%rax
+  805891:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805894:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805898:	79 05                	jns    80589f <getchar+0x33>
+    return r;
+  80589a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80589d:	eb 14                	jmp    8058b3 <getchar+0x47>
+  if (r < 1)
+  80589f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058a3:	7f 07                	jg     8058ac <getchar+0x40>
+    return -E_EOF;
+  8058a5:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8058aa:	eb 07                	jmp    8058b3 <getchar+0x47>
+  return c;
+  8058ac:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8058b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8058b3:	c9                   	leave
+  8058b4:	c3                   	ret
+
+00000000008058b5 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8058b5:	55                   	push   %rbp
+  8058b6:	48 89 e5             	mov    %rsp,%rbp
+  8058b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8058bd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8058c0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8058c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058c7:	48 89 d6             	mov    %rdx,%rsi
+  8058ca:	89 c7                	mov    %eax,%edi
+  8058cc:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8058d3:	00 00 00 
+  8058d6:	ff d0                	call   *%rax
+  8058d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058df:	79 05                	jns    8058e6 <iscons+0x31>
+    return r;
+  8058e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058e4:	eb 1a                	jmp    805900 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8058e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058ea:	8b 10                	mov    (%rax),%edx
+  8058ec:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8058f3:	00 00 00 
+  8058f6:	8b 00                	mov    (%rax),%eax
+  8058f8:	39 c2                	cmp    %eax,%edx
+  8058fa:	0f 94 c0             	sete   %al
+  8058fd:	0f b6 c0             	movzbl %al,%eax
+}
+  805900:	c9                   	leave
+  805901:	c3                   	ret
+
+0000000000805902 <opencons>:
+
+int
+opencons(void) {
+  805902:	55                   	push   %rbp
+  805903:	48 89 e5             	mov    %rsp,%rbp
+  805906:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80590a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80590e:	48 89 c7             	mov    %rax,%rdi
+  805911:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  805918:	00 00 00 
+  80591b:	ff d0                	call   *%rax
+  80591d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805920:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805924:	79 05                	jns    80592b <opencons+0x29>
+    return r;
+  805926:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805929:	eb 66                	jmp    805991 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80592b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80592f:	ba 07 04 00 00       	mov    $0x407,%edx
+  805934:	48 89 c6             	mov    %rax,%rsi
+  805937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80593c:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  805943:	00 00 00 
+  805946:	ff d0                	call   *%rax
+  805948:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80594b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80594f:	79 05                	jns    805956 <opencons+0x54>
+    return r;
+  805951:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805954:	eb 3b                	jmp    805991 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80595a:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805961:	00 00 00 
+  805964:	8b 12                	mov    (%rdx),%edx
+  805966:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805968:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80596c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805973:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805977:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80597e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805982:	48 89 c7             	mov    %rax,%rdi
+  805985:	48 b8 32 32 80 00 00 	movabs $0x803232,%rax
+  80598c:	00 00 00 
+  80598f:	ff d0                	call   *%rax
+}
+  805991:	c9                   	leave
+  805992:	c3                   	ret
+
+0000000000805993 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805993:	55                   	push   %rbp
+  805994:	48 89 e5             	mov    %rsp,%rbp
+  805997:	48 83 ec 20          	sub    $0x20,%rsp
+  80599b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80599e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8059a1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8059a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059a8:	48 89 d6             	mov    %rdx,%rsi
+  8059ab:	89 c7                	mov    %eax,%edi
+  8059ad:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8059b4:	00 00 00 
+  8059b7:	ff d0                	call   *%rax
+  8059b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8059bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8059c0:	79 05                	jns    8059c7 <consmode+0x34>
+    return r;
+  8059c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059c5:	eb 34                	jmp    8059fb <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8059c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059cb:	8b 10                	mov    (%rax),%edx
+  8059cd:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8059d4:	00 00 00 
+  8059d7:	8b 00                	mov    (%rax),%eax
+  8059d9:	39 c2                	cmp    %eax,%edx
+  8059db:	74 07                	je     8059e4 <consmode+0x51>
+    return -E_INVAL;
+  8059dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059e2:	eb 17                	jmp    8059fb <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8059e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059e8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8059eb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8059ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059f2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059f5:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8059f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8059fb:	c9                   	leave
+  8059fc:	c3                   	ret
+
+00000000008059fd <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8059fd:	55                   	push   %rbp
+  8059fe:	48 89 e5             	mov    %rsp,%rbp
+  805a01:	48 83 ec 20          	sub    $0x20,%rsp
+  805a05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a09:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805a0d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805a11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a15:	8b 50 0c             	mov    0xc(%rax),%edx
+  805a18:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805a1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a20:	48 89 ce             	mov    %rcx,%rsi
+  805a23:	48 89 c7             	mov    %rax,%rdi
+  805a26:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  805a2d:	00 00 00 
+  805a30:	ff d0                	call   *%rax
+  805a32:	48 98                	cltq
+}
+  805a34:	c9                   	leave
+  805a35:	c3                   	ret
+
+0000000000805a36 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805a36:	55                   	push   %rbp
+  805a37:	48 89 e5             	mov    %rsp,%rbp
+  805a3a:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805a41:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805a48:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805a4f:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805a56:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805a5d:	eb 74                	jmp    805ad3 <devcons_write+0x9d>
+    m = n - tot;
+  805a5f:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805a66:	89 c2                	mov    %eax,%edx
+  805a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a6b:	29 c2                	sub    %eax,%edx
+  805a6d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805a70:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a73:	83 f8 7f             	cmp    $0x7f,%eax
+  805a76:	76 07                	jbe    805a7f <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805a78:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805a7f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a82:	48 63 d0             	movslq %eax,%rdx
+  805a85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a88:	48 63 c8             	movslq %eax,%rcx
+  805a8b:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805a92:	48 01 c1             	add    %rax,%rcx
+  805a95:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a9c:	48 89 ce             	mov    %rcx,%rsi
+  805a9f:	48 89 c7             	mov    %rax,%rdi
+  805aa2:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  805aa9:	00 00 00 
+  805aac:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805aae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ab1:	48 63 d0             	movslq %eax,%rdx
+  805ab4:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805abb:	48 89 d6             	mov    %rdx,%rsi
+  805abe:	48 89 c7             	mov    %rax,%rdi
+  805ac1:	48 b8 54 21 80 00 00 	movabs $0x802154,%rax
+  805ac8:	00 00 00 
+  805acb:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805acd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ad0:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805ad3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ad6:	48 98                	cltq
+  805ad8:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805adf:	0f 82 7a ff ff ff    	jb     805a5f <devcons_write+0x29>
+  }
+  return tot;
+  805ae5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ae8:	48 98                	cltq
+}
+  805aea:	c9                   	leave
+  805aeb:	c3                   	ret
+
+0000000000805aec <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805aec:	55                   	push   %rbp
+  805aed:	48 89 e5             	mov    %rsp,%rbp
+  805af0:	48 83 ec 08          	sub    $0x8,%rsp
+  805af4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805af8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805afd:	c9                   	leave
+  805afe:	c3                   	ret
+
+0000000000805aff <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805aff:	55                   	push   %rbp
+  805b00:	48 89 e5             	mov    %rsp,%rbp
+  805b03:	48 83 ec 10          	sub    $0x10,%rsp
+  805b07:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b0b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805b0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b13:	48 ba 78 6e 80 00 00 	movabs $0x806e78,%rdx
+  805b1a:	00 00 00 
+  805b1d:	48 89 d6             	mov    %rdx,%rsi
+  805b20:	48 89 c7             	mov    %rax,%rdi
+  805b23:	48 b8 9d 15 80 00 00 	movabs $0x80159d,%rax
+  805b2a:	00 00 00 
+  805b2d:	ff d0                	call   *%rax
+  return 0;
+  805b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b34:	c9                   	leave
+  805b35:	c3                   	ret
+
+0000000000805b36 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805b36:	55                   	push   %rbp
+  805b37:	48 89 e5             	mov    %rsp,%rbp
+  805b3a:	48 83 ec 30          	sub    $0x30,%rsp
+  805b3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b42:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805b45:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805b49:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805b50:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b53:	83 e0 02             	and    $0x2,%eax
+  805b56:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805b59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b5d:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b60:	83 f8 01             	cmp    $0x1,%eax
+  805b63:	75 04                	jne    805b69 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805b65:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805b69:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b6c:	83 e0 01             	and    $0x1,%eax
+  805b6f:	85 c0                	test   %eax,%eax
+  805b71:	74 44                	je     805bb7 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805b73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b7b:	89 c2                	mov    %eax,%edx
+  805b7d:	be 00 00 00 00       	mov    $0x0,%esi
+  805b82:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b87:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  805b8e:	00 00 00 
+  805b91:	ff d0                	call   *%rax
+  805b93:	83 f8 01             	cmp    $0x1,%eax
+  805b96:	75 06                	jne    805b9e <devcons_poll+0x68>
+      revents |= POLLIN;
+  805b98:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805b9c:	eb 19                	jmp    805bb7 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805b9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ba2:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805ba8:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805bab:	89 c2                	mov    %eax,%edx
+  805bad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bb1:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805bb7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805bba:	c9                   	leave
+  805bbb:	c3                   	ret
+
+0000000000805bbc <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805bbc:	55                   	push   %rbp
+  805bbd:	48 89 e5             	mov    %rsp,%rbp
+  805bc0:	48 83 ec 20          	sub    $0x20,%rsp
+  805bc4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805bc8:	48 b8 f2 22 80 00 00 	movabs $0x8022f2,%rax
+  805bcf:	00 00 00 
+  805bd2:	ff d0                	call   *%rax
+  805bd4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805bd7:	48 b8 40 91 81 00 00 	movabs $0x819140,%rax
+  805bde:	00 00 00 
+  805be1:	48 8b 00             	mov    (%rax),%rax
+  805be4:	48 85 c0             	test   %rax,%rax
+  805be7:	75 62                	jne    805c4b <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805be9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bec:	ba 07 00 00 00       	mov    $0x7,%edx
+  805bf1:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805bf8:	00 00 00 
+  805bfb:	48 89 ce             	mov    %rcx,%rsi
+  805bfe:	89 c7                	mov    %eax,%edi
+  805c00:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  805c07:	00 00 00 
+  805c0a:	ff d0                	call   *%rax
+  805c0c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805c0f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c13:	79 36                	jns    805c4b <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805c15:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c18:	89 c1                	mov    %eax,%ecx
+  805c1a:	48 b8 7f 6e 80 00 00 	movabs $0x806e7f,%rax
+  805c21:	00 00 00 
+  805c24:	48 89 c2             	mov    %rax,%rdx
+  805c27:	be 23 00 00 00       	mov    $0x23,%esi
+  805c2c:	48 b8 97 6e 80 00 00 	movabs $0x806e97,%rax
+  805c33:	00 00 00 
+  805c36:	48 89 c7             	mov    %rax,%rdi
+  805c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c3e:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  805c45:	00 00 00 
+  805c48:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805c4b:	48 ba 40 91 81 00 00 	movabs $0x819140,%rdx
+  805c52:	00 00 00 
+  805c55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c59:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805c5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c5f:	48 ba bc 5c 80 00 00 	movabs $0x805cbc,%rdx
+  805c66:	00 00 00 
+  805c69:	48 89 d6             	mov    %rdx,%rsi
+  805c6c:	89 c7                	mov    %eax,%edi
+  805c6e:	48 b8 08 25 80 00 00 	movabs $0x802508,%rax
+  805c75:	00 00 00 
+  805c78:	ff d0                	call   *%rax
+  805c7a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805c7d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805c81:	79 36                	jns    805cb9 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805c83:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c86:	89 c1                	mov    %eax,%ecx
+  805c88:	48 b8 7f 6e 80 00 00 	movabs $0x806e7f,%rax
+  805c8f:	00 00 00 
+  805c92:	48 89 c2             	mov    %rax,%rdx
+  805c95:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805c9a:	48 b8 97 6e 80 00 00 	movabs $0x806e97,%rax
+  805ca1:	00 00 00 
+  805ca4:	48 89 c7             	mov    %rax,%rdi
+  805ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cac:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  805cb3:	00 00 00 
+  805cb6:	41 ff d0             	call   *%r8
+}
+  805cb9:	90                   	nop
+  805cba:	c9                   	leave
+  805cbb:	c3                   	ret
+
+0000000000805cbc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805cbc:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805cbf:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805cc2:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805cc9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805ccd:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805cd2:	48 a1 40 91 81 00 00 	movabs 0x819140,%rax
+  805cd9:	00 00 00 
+	call *%rax
+  805cdc:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805cde:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805ce3:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805ce6:	41 5f                	pop    %r15
+	popq %r15
+  805ce8:	41 5f                	pop    %r15
+	popq %r15
+  805cea:	41 5f                	pop    %r15
+	popq %r14
+  805cec:	41 5e                	pop    %r14
+	popq %r13
+  805cee:	41 5d                	pop    %r13
+	popq %r12
+  805cf0:	41 5c                	pop    %r12
+	popq %r11
+  805cf2:	41 5b                	pop    %r11
+	popq %r10
+  805cf4:	41 5a                	pop    %r10
+	popq %r9
+  805cf6:	41 59                	pop    %r9
+	popq %r8
+  805cf8:	41 58                	pop    %r8
+	popq %rsi
+  805cfa:	5e                   	pop    %rsi
+	popq %rdi
+  805cfb:	5f                   	pop    %rdi
+	popq %rbp
+  805cfc:	5d                   	pop    %rbp
+	popq %rdx
+  805cfd:	5a                   	pop    %rdx
+	popq %rcx
+  805cfe:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805cff:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805d04:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805d09:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805d0d:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805d10:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805d15:	5b                   	pop    %rbx
+	popq %rax
+  805d16:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805d17:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805d1b:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805d1c:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805d21:	c3                   	ret
+
+0000000000805d22 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805d22:	55                   	push   %rbp
+  805d23:	48 89 e5             	mov    %rsp,%rbp
+  805d26:	48 83 ec 20          	sub    $0x20,%rsp
+  805d2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805d32:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805d36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d3a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805d3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d42:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805d49:	48 89 c7             	mov    %rax,%rdi
+  805d4c:	48 b8 5a 5d 80 00 00 	movabs $0x805d5a,%rax
+  805d53:	00 00 00 
+  805d56:	ff d0                	call   *%rax
+}
+  805d58:	c9                   	leave
+  805d59:	c3                   	ret
+
+0000000000805d5a <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805d5a:	55                   	push   %rbp
+  805d5b:	48 89 e5             	mov    %rsp,%rbp
+  805d5e:	48 83 ec 30          	sub    $0x30,%rsp
+  805d62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805d66:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805d6a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805d6e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805d72:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805d77:	75 0e                	jne    805d87 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805d79:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805d80:	00 00 00 
+  805d83:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805d87:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805d8c:	75 18                	jne    805da6 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805d8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d92:	48 89 c7             	mov    %rax,%rdi
+  805d95:	48 b8 ab 25 80 00 00 	movabs $0x8025ab,%rax
+  805d9c:	00 00 00 
+  805d9f:	ff d0                	call   *%rax
+  805da1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805da4:	eb 1d                	jmp    805dc3 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805da6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805daa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dae:	48 89 d6             	mov    %rdx,%rsi
+  805db1:	48 89 c7             	mov    %rax,%rdi
+  805db4:	48 b8 f1 25 80 00 00 	movabs $0x8025f1,%rax
+  805dbb:	00 00 00 
+  805dbe:	ff d0                	call   *%rax
+  805dc0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805dc3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805dc7:	79 2a                	jns    805df3 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805dc9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805dce:	74 0a                	je     805dda <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805dda:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805ddf:	74 0a                	je     805deb <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805de1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805de5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805dee:	e9 aa 00 00 00       	jmp    805e9d <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805df3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805df8:	74 36                	je     805e30 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805dfa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e01:	00 00 00 
+  805e04:	8b 40 04             	mov    0x4(%rax),%eax
+  805e07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e13:	00 00 00 
+  805e16:	48 98                	cltq
+  805e18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e1f:	48 01 d0             	add    %rdx,%rax
+  805e22:	48 05 24 01 00 00    	add    $0x124,%rax
+  805e28:	8b 10                	mov    (%rax),%edx
+  805e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e2e:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805e30:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e35:	74 36                	je     805e6d <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805e37:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e3e:	00 00 00 
+  805e41:	8b 40 04             	mov    0x4(%rax),%eax
+  805e44:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e49:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e50:	00 00 00 
+  805e53:	48 98                	cltq
+  805e55:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e5c:	48 01 d0             	add    %rdx,%rax
+  805e5f:	48 05 28 01 00 00    	add    $0x128,%rax
+  805e65:	8b 10                	mov    (%rax),%edx
+  805e67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e6b:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805e6d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e74:	00 00 00 
+  805e77:	8b 40 04             	mov    0x4(%rax),%eax
+  805e7a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e7f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e86:	00 00 00 
+  805e89:	48 98                	cltq
+  805e8b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e92:	48 01 d0             	add    %rdx,%rax
+  805e95:	48 05 20 01 00 00    	add    $0x120,%rax
+  805e9b:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805e9d:	c9                   	leave
+  805e9e:	c3                   	ret
+
+0000000000805e9f <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805e9f:	55                   	push   %rbp
+  805ea0:	48 89 e5             	mov    %rsp,%rbp
+  805ea3:	48 83 ec 30          	sub    $0x30,%rsp
+  805ea7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805eaa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805ead:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805eb1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805eb4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805eb9:	75 5e                	jne    805f19 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805ebb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ec2:	00 00 00 
+  805ec5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805ec9:	eb 4e                	jmp    805f19 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805ecb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ecf:	79 3c                	jns    805f0d <ipc_send+0x6e>
+  805ed1:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805ed5:	74 36                	je     805f0d <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eda:	89 c1                	mov    %eax,%ecx
+  805edc:	48 b8 a8 6e 80 00 00 	movabs $0x806ea8,%rax
+  805ee3:	00 00 00 
+  805ee6:	48 89 c2             	mov    %rax,%rdx
+  805ee9:	be 54 00 00 00       	mov    $0x54,%esi
+  805eee:	48 b8 ce 6e 80 00 00 	movabs $0x806ece,%rax
+  805ef5:	00 00 00 
+  805ef8:	48 89 c7             	mov    %rax,%rdi
+  805efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f00:	49 b8 ce 03 80 00 00 	movabs $0x8003ce,%r8
+  805f07:	00 00 00 
+  805f0a:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805f0d:	48 b8 2e 23 80 00 00 	movabs $0x80232e,%rax
+  805f14:	00 00 00 
+  805f17:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805f19:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805f1c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805f1f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f26:	89 c7                	mov    %eax,%edi
+  805f28:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  805f2f:	00 00 00 
+  805f32:	ff d0                	call   *%rax
+  805f34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f37:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f3b:	75 8e                	jne    805ecb <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805f3d:	48 b8 2e 23 80 00 00 	movabs $0x80232e,%rax
+  805f44:	00 00 00 
+  805f47:	ff d0                	call   *%rax
+}
+  805f49:	90                   	nop
+  805f4a:	c9                   	leave
+  805f4b:	c3                   	ret
+
+0000000000805f4c <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805f4c:	55                   	push   %rbp
+  805f4d:	48 89 e5             	mov    %rsp,%rbp
+  805f50:	48 83 ec 18          	sub    $0x18,%rsp
+  805f54:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805f57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805f5e:	eb 4d                	jmp    805fad <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805f60:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805f67:	00 00 00 
+  805f6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f6d:	48 98                	cltq
+  805f6f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805f76:	48 01 d0             	add    %rdx,%rax
+  805f79:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805f7f:	8b 00                	mov    (%rax),%eax
+  805f81:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805f84:	75 23                	jne    805fa9 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805f86:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805f8d:	00 00 00 
+  805f90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f93:	48 98                	cltq
+  805f95:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805f9c:	48 01 d0             	add    %rdx,%rax
+  805f9f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805fa5:	8b 00                	mov    (%rax),%eax
+  805fa7:	eb 12                	jmp    805fbb <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805fa9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805fad:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805fb4:	7e aa                	jle    805f60 <ipc_find_env+0x14>
+  return 0;
+  805fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fbb:	c9                   	leave
+  805fbc:	c3                   	ret
+
+0000000000805fbd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805fbd:	55                   	push   %rbp
+  805fbe:	48 89 e5             	mov    %rsp,%rbp
+  805fc1:	48 83 ec 18          	sub    $0x18,%rsp
+  805fc5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fcd:	48 c1 e8 27          	shr    $0x27,%rax
+  805fd1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805fd6:	48 89 c2             	mov    %rax,%rdx
+  805fd9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805fe0:	01 00 00 
+  805fe3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805fe7:	83 e0 01             	and    $0x1,%eax
+  805fea:	48 85 c0             	test   %rax,%rax
+  805fed:	74 63                	je     806052 <pageref+0x95>
+  805fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ff3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805ff7:	48 89 c2             	mov    %rax,%rdx
+  805ffa:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806001:	01 00 00 
+  806004:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806008:	83 e0 01             	and    $0x1,%eax
+  80600b:	48 85 c0             	test   %rax,%rax
+  80600e:	74 42                	je     806052 <pageref+0x95>
+  806010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806014:	48 c1 e8 15          	shr    $0x15,%rax
+  806018:	48 89 c2             	mov    %rax,%rdx
+  80601b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  806022:	01 00 00 
+  806025:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806029:	83 e0 01             	and    $0x1,%eax
+  80602c:	48 85 c0             	test   %rax,%rax
+  80602f:	74 21                	je     806052 <pageref+0x95>
+  806031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806035:	48 c1 e8 0c          	shr    $0xc,%rax
+  806039:	48 89 c2             	mov    %rax,%rdx
+  80603c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806043:	01 00 00 
+  806046:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80604a:	83 e0 01             	and    $0x1,%eax
+  80604d:	48 85 c0             	test   %rax,%rax
+  806050:	75 07                	jne    806059 <pageref+0x9c>
+    return 0;
+  806052:	b8 00 00 00 00       	mov    $0x0,%eax
+  806057:	eb 53                	jmp    8060ac <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  806059:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80605d:	48 c1 e8 0c          	shr    $0xc,%rax
+  806061:	48 89 c2             	mov    %rax,%rdx
+  806064:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80606b:	01 00 00 
+  80606e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806072:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  806076:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80607a:	83 e0 01             	and    $0x1,%eax
+  80607d:	48 85 c0             	test   %rax,%rax
+  806080:	75 07                	jne    806089 <pageref+0xcc>
+    return 0;
+  806082:	b8 00 00 00 00       	mov    $0x0,%eax
+  806087:	eb 23                	jmp    8060ac <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806089:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80608d:	48 c1 e8 0c          	shr    $0xc,%rax
+  806091:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  806098:	00 00 00 
+  80609b:	48 c1 e0 04          	shl    $0x4,%rax
+  80609f:	48 01 d0             	add    %rdx,%rax
+  8060a2:	48 83 c0 08          	add    $0x8,%rax
+  8060a6:	0f b7 00             	movzwl (%rax),%eax
+  8060a9:	0f b7 c0             	movzwl %ax,%eax
+}
+  8060ac:	c9                   	leave
+  8060ad:	c3                   	ret
+
+00000000008060ae <xchg>:
+  8060ae:	55                   	push   %rbp
+  8060af:	48 89 e5             	mov    %rsp,%rbp
+  8060b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8060b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060ba:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8060bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8060c1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060c4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8060c8:	f0 87 02             	lock xchg %eax,(%rdx)
+  8060cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8060ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060d1:	c9                   	leave
+  8060d2:	c3                   	ret
+
+00000000008060d3 <cmpxchg>:
+  8060d3:	55                   	push   %rbp
+  8060d4:	48 89 e5             	mov    %rsp,%rbp
+  8060d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8060db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060df:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8060e2:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8060e5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8060e9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8060ec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060ef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8060f3:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  8060f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8060fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060fd:	c9                   	leave
+  8060fe:	c3                   	ret
+
+00000000008060ff <xadd>:
+  8060ff:	55                   	push   %rbp
+  806100:	48 89 e5             	mov    %rsp,%rbp
+  806103:	48 83 ec 10          	sub    $0x10,%rsp
+  806107:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80610b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80610e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806112:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806115:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806119:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  80611d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  806120:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806123:	c9                   	leave
+  806124:	c3                   	ret
+
+0000000000806125 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806125:	55                   	push   %rbp
+  806126:	48 89 e5             	mov    %rsp,%rbp
+  806129:	48 83 ec 08          	sub    $0x8,%rsp
+  80612d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  806131:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806135:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80613b:	90                   	nop
+  80613c:	c9                   	leave
+  80613d:	c3                   	ret
+
+000000000080613e <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  80613e:	55                   	push   %rbp
+  80613f:	48 89 e5             	mov    %rsp,%rbp
+  806142:	48 83 ec 20          	sub    $0x20,%rsp
+  806146:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80614a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614e:	ba 01 00 00 00       	mov    $0x1,%edx
+  806153:	be 00 00 00 00       	mov    $0x0,%esi
+  806158:	48 89 c7             	mov    %rax,%rdi
+  80615b:	48 b8 d3 60 80 00 00 	movabs $0x8060d3,%rax
+  806162:	00 00 00 
+  806165:	ff d0                	call   *%rax
+  806167:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80616a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80616e:	74 65                	je     8061d5 <mutex_lock+0x97>
+  if (c != 2)
+  806170:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806174:	74 57                	je     8061cd <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806176:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80617a:	be 02 00 00 00       	mov    $0x2,%esi
+  80617f:	48 89 c7             	mov    %rax,%rdi
+  806182:	48 b8 ae 60 80 00 00 	movabs $0x8060ae,%rax
+  806189:	00 00 00 
+  80618c:	ff d0                	call   *%rax
+  80618e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806191:	eb 3a                	jmp    8061cd <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806193:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806197:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80619e:	be 02 00 00 00       	mov    $0x2,%esi
+  8061a3:	48 89 c7             	mov    %rax,%rdi
+  8061a6:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8061ad:	00 00 00 
+  8061b0:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8061b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b6:	be 02 00 00 00       	mov    $0x2,%esi
+  8061bb:	48 89 c7             	mov    %rax,%rdi
+  8061be:	48 b8 ae 60 80 00 00 	movabs $0x8060ae,%rax
+  8061c5:	00 00 00 
+  8061c8:	ff d0                	call   *%rax
+  8061ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8061cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8061d1:	75 c0                	jne    806193 <mutex_lock+0x55>
+  8061d3:	eb 01                	jmp    8061d6 <mutex_lock+0x98>
+    return;
+  8061d5:	90                   	nop
+}
+  8061d6:	c9                   	leave
+  8061d7:	c3                   	ret
+
+00000000008061d8 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8061d8:	55                   	push   %rbp
+  8061d9:	48 89 e5             	mov    %rsp,%rbp
+  8061dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8061e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  8061e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8061ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8061f2:	48 89 c7             	mov    %rax,%rdi
+  8061f5:	48 b8 d3 60 80 00 00 	movabs $0x8060d3,%rax
+  8061fc:	00 00 00 
+  8061ff:	ff d0                	call   *%rax
+  806201:	85 c0                	test   %eax,%eax
+  806203:	75 07                	jne    80620c <mutex_trylock+0x34>
+  806205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80620a:	eb 05                	jmp    806211 <mutex_trylock+0x39>
+  80620c:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806211:	c9                   	leave
+  806212:	c3                   	ret
+
+0000000000806213 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806213:	55                   	push   %rbp
+  806214:	48 89 e5             	mov    %rsp,%rbp
+  806217:	48 83 ec 10          	sub    $0x10,%rsp
+  80621b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80621f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806223:	be 00 00 00 00       	mov    $0x0,%esi
+  806228:	48 89 c7             	mov    %rax,%rdi
+  80622b:	48 b8 ae 60 80 00 00 	movabs $0x8060ae,%rax
+  806232:	00 00 00 
+  806235:	ff d0                	call   *%rax
+  806237:	83 f8 02             	cmp    $0x2,%eax
+  80623a:	75 18                	jne    806254 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  80623c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806240:	be 01 00 00 00       	mov    $0x1,%esi
+  806245:	48 89 c7             	mov    %rax,%rdi
+  806248:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  80624f:	00 00 00 
+  806252:	ff d0                	call   *%rax
+}
+  806254:	90                   	nop
+  806255:	c9                   	leave
+  806256:	c3                   	ret
+
+0000000000806257 <cond_init>:
+cond_init(struct Cond *c) {
+  806257:	55                   	push   %rbp
+  806258:	48 89 e5             	mov    %rsp,%rbp
+  80625b:	48 83 ec 08          	sub    $0x8,%rsp
+  80625f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806263:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806267:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80626d:	90                   	nop
+  80626e:	c9                   	leave
+  80626f:	c3                   	ret
+
+0000000000806270 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  806270:	55                   	push   %rbp
+  806271:	48 89 e5             	mov    %rsp,%rbp
+  806274:	48 83 ec 30          	sub    $0x30,%rsp
+  806278:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80627c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806280:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  806284:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806288:	8b 00                	mov    (%rax),%eax
+  80628a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  80628d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806291:	48 89 c7             	mov    %rax,%rdi
+  806294:	48 b8 13 62 80 00 00 	movabs $0x806213,%rax
+  80629b:	00 00 00 
+  80629e:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8062a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062a4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8062a8:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8062ab:	89 ce                	mov    %ecx,%esi
+  8062ad:	48 89 c7             	mov    %rax,%rdi
+  8062b0:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8062b7:	00 00 00 
+  8062ba:	ff d0                	call   *%rax
+  8062bc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8062bf:	eb 1f                	jmp    8062e0 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8062c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062c5:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8062cc:	be 02 00 00 00       	mov    $0x2,%esi
+  8062d1:	48 89 c7             	mov    %rax,%rdi
+  8062d4:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8062db:	00 00 00 
+  8062de:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8062e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062e4:	be 02 00 00 00       	mov    $0x2,%esi
+  8062e9:	48 89 c7             	mov    %rax,%rdi
+  8062ec:	48 b8 ae 60 80 00 00 	movabs $0x8060ae,%rax
+  8062f3:	00 00 00 
+  8062f6:	ff d0                	call   *%rax
+  8062f8:	85 c0                	test   %eax,%eax
+  8062fa:	75 c5                	jne    8062c1 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  8062fc:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806300:	75 07                	jne    806309 <cond_timedwait+0x99>
+  806302:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806307:	eb 05                	jmp    80630e <cond_timedwait+0x9e>
+  806309:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80630e:	c9                   	leave
+  80630f:	c3                   	ret
+
+0000000000806310 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806310:	55                   	push   %rbp
+  806311:	48 89 e5             	mov    %rsp,%rbp
+  806314:	48 83 ec 10          	sub    $0x10,%rsp
+  806318:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80631c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806320:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806324:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806328:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80632f:	48 89 ce             	mov    %rcx,%rsi
+  806332:	48 89 c7             	mov    %rax,%rdi
+  806335:	48 b8 70 62 80 00 00 	movabs $0x806270,%rax
+  80633c:	00 00 00 
+  80633f:	ff d0                	call   *%rax
+}
+  806341:	90                   	nop
+  806342:	c9                   	leave
+  806343:	c3                   	ret
+
+0000000000806344 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806344:	55                   	push   %rbp
+  806345:	48 89 e5             	mov    %rsp,%rbp
+  806348:	48 83 ec 10          	sub    $0x10,%rsp
+  80634c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806354:	be 01 00 00 00       	mov    $0x1,%esi
+  806359:	48 89 c7             	mov    %rax,%rdi
+  80635c:	48 b8 ff 60 80 00 00 	movabs $0x8060ff,%rax
+  806363:	00 00 00 
+  806366:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80636c:	be 01 00 00 00       	mov    $0x1,%esi
+  806371:	48 89 c7             	mov    %rax,%rdi
+  806374:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  80637b:	00 00 00 
+  80637e:	ff d0                	call   *%rax
+}
+  806380:	90                   	nop
+  806381:	c9                   	leave
+  806382:	c3                   	ret
+
+0000000000806383 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  806383:	55                   	push   %rbp
+  806384:	48 89 e5             	mov    %rsp,%rbp
+  806387:	48 83 ec 10          	sub    $0x10,%rsp
+  80638b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80638f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806393:	be 01 00 00 00       	mov    $0x1,%esi
+  806398:	48 89 c7             	mov    %rax,%rdi
+  80639b:	48 b8 ff 60 80 00 00 	movabs $0x8060ff,%rax
+  8063a2:	00 00 00 
+  8063a5:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8063a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063ab:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8063b0:	48 89 c7             	mov    %rax,%rdi
+  8063b3:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  8063ba:	00 00 00 
+  8063bd:	ff d0                	call   *%rax
+}
+  8063bf:	90                   	nop
+  8063c0:	c9                   	leave
+  8063c1:	c3                   	ret
+
+00000000008063c2 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8063c2:	55                   	push   %rbp
+  8063c3:	48 89 e5             	mov    %rsp,%rbp
+  8063c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8063ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8063ce:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8063d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063d5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8063d8:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8063da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063de:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8063e5:	90                   	nop
+  8063e6:	c9                   	leave
+  8063e7:	c3                   	ret
+
+00000000008063e8 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8063e8:	55                   	push   %rbp
+  8063e9:	48 89 e5             	mov    %rsp,%rbp
+  8063ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8063f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8063f4:	eb 2a                	jmp    806420 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8063f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8063f9:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8063fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806400:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806403:	89 ce                	mov    %ecx,%esi
+  806405:	48 89 c7             	mov    %rax,%rdi
+  806408:	48 b8 d3 60 80 00 00 	movabs $0x8060d3,%rax
+  80640f:	00 00 00 
+  806412:	ff d0                	call   *%rax
+  806414:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806417:	75 07                	jne    806420 <sem_trywait+0x38>
+      return 0;
+  806419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80641e:	eb 14                	jmp    806434 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806420:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806424:	8b 00                	mov    (%rax),%eax
+  806426:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806429:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80642d:	75 c7                	jne    8063f6 <sem_trywait+0xe>
+  return -E_BUSY;
+  80642f:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806434:	c9                   	leave
+  806435:	c3                   	ret
+
+0000000000806436 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806436:	55                   	push   %rbp
+  806437:	48 89 e5             	mov    %rsp,%rbp
+  80643a:	48 83 ec 30          	sub    $0x30,%rsp
+  80643e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806442:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806446:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80644d:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80644e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806453:	0f 84 fb 00 00 00    	je     806554 <sem_timedwait+0x11e>
+  806459:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80645e:	0f 84 f0 00 00 00    	je     806554 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806464:	48 b8 cb 57 80 00 00 	movabs $0x8057cb,%rax
+  80646b:	00 00 00 
+  80646e:	ff d0                	call   *%rax
+  806470:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806474:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806478:	48 f7 d0             	not    %rax
+  80647b:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80647f:	73 0d                	jae    80648e <sem_timedwait+0x58>
+  806481:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806485:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806489:	48 01 d0             	add    %rdx,%rax
+  80648c:	eb 07                	jmp    806495 <sem_timedwait+0x5f>
+  80648e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  806495:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  806499:	e9 b6 00 00 00       	jmp    806554 <sem_timedwait+0x11e>
+    if (deadline) {
+  80649e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8064a3:	74 2d                	je     8064d2 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8064a5:	48 b8 cb 57 80 00 00 	movabs $0x8057cb,%rax
+  8064ac:	00 00 00 
+  8064af:	ff d0                	call   *%rax
+  8064b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8064b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8064b9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8064bd:	73 0a                	jae    8064c9 <sem_timedwait+0x93>
+  8064bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064c3:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8064c7:	eb 05                	jmp    8064ce <sem_timedwait+0x98>
+  8064c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064ce:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8064d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064d6:	48 83 c0 04          	add    $0x4,%rax
+  8064da:	be 01 00 00 00       	mov    $0x1,%esi
+  8064df:	48 89 c7             	mov    %rax,%rdi
+  8064e2:	48 b8 ff 60 80 00 00 	movabs $0x8060ff,%rax
+  8064e9:	00 00 00 
+  8064ec:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8064ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064f2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8064f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8064fb:	48 89 c7             	mov    %rax,%rdi
+  8064fe:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  806505:	00 00 00 
+  806508:	ff d0                	call   *%rax
+  80650a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80650d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806511:	48 83 c0 04          	add    $0x4,%rax
+  806515:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80651a:	48 89 c7             	mov    %rax,%rdi
+  80651d:	48 b8 ff 60 80 00 00 	movabs $0x8060ff,%rax
+  806524:	00 00 00 
+  806527:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806529:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80652d:	75 25                	jne    806554 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80652f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806533:	48 89 c7             	mov    %rax,%rdi
+  806536:	48 b8 e8 63 80 00 00 	movabs $0x8063e8,%rax
+  80653d:	00 00 00 
+  806540:	ff d0                	call   *%rax
+  806542:	85 c0                	test   %eax,%eax
+  806544:	79 07                	jns    80654d <sem_timedwait+0x117>
+  806546:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80654b:	eb 27                	jmp    806574 <sem_timedwait+0x13e>
+  80654d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806552:	eb 20                	jmp    806574 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806554:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806558:	48 89 c7             	mov    %rax,%rdi
+  80655b:	48 b8 e8 63 80 00 00 	movabs $0x8063e8,%rax
+  806562:	00 00 00 
+  806565:	ff d0                	call   *%rax
+  806567:	85 c0                	test   %eax,%eax
+  806569:	0f 88 2f ff ff ff    	js     80649e <sem_timedwait+0x68>
+  return 0;
+  80656f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806574:	c9                   	leave
+  806575:	c3                   	ret
+
+0000000000806576 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806576:	55                   	push   %rbp
+  806577:	48 89 e5             	mov    %rsp,%rbp
+  80657a:	48 83 ec 10          	sub    $0x10,%rsp
+  80657e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  806582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806586:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  80658d:	48 89 c7             	mov    %rax,%rdi
+  806590:	48 b8 36 64 80 00 00 	movabs $0x806436,%rax
+  806597:	00 00 00 
+  80659a:	ff d0                	call   *%rax
+}
+  80659c:	90                   	nop
+  80659d:	c9                   	leave
+  80659e:	c3                   	ret
+
+000000000080659f <sem_post>:
+sem_post(struct Semaphore *s) {
+  80659f:	55                   	push   %rbp
+  8065a0:	48 89 e5             	mov    %rsp,%rbp
+  8065a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8065a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8065ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065af:	be 01 00 00 00       	mov    $0x1,%esi
+  8065b4:	48 89 c7             	mov    %rax,%rdi
+  8065b7:	48 b8 ff 60 80 00 00 	movabs $0x8060ff,%rax
+  8065be:	00 00 00 
+  8065c1:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8065c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065c7:	8b 40 04             	mov    0x4(%rax),%eax
+  8065ca:	85 c0                	test   %eax,%eax
+  8065cc:	74 18                	je     8065e6 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8065ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8065d7:	48 89 c7             	mov    %rax,%rdi
+  8065da:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  8065e1:	00 00 00 
+  8065e4:	ff d0                	call   *%rax
+}
+  8065e6:	90                   	nop
+  8065e7:	c9                   	leave
+  8065e8:	c3                   	ret
+  8065e9:	0f 1f 00             	nopl   (%rax)